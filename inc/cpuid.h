@@ -1,6 +1,8 @@
 #ifndef JOS_INC_CPUID_H
 #define JOS_INC_CPUID_H
 
+#include <inc/x86.h>
+
 #define CPUID_BIT(base, off)	((base) * 32 + (off))
 
 enum {
@@ -151,4 +153,19 @@ enum {
 
 void cpuid_print(void);
 
+// Can this CPU make system calls with sysenter/sysexit?  The earliest
+// Pentium Pros (family 6, model < 3, stepping < 3) report SEP without
+// supporting the instructions.
+static inline bool
+cpuid_sysenter(void)
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+		 && (eax & 0xf) < 3);
+}
+
 #endif // !JOS_INC_CPUID_H
@@ -6,6 +6,7 @@
 #include <inc/types.h>
 #include <inc/trap.h>
 #include <inc/memlayout.h>
+#include <inc/time.h>
 
 typedef int32_t envid_t;
 
@@ -38,6 +39,28 @@ enum {
 	ENV_NOT_RUNNABLE
 };
 
+// Most pages the kernel resolves ahead of a page fault
+#define FAULT_AROUND_MAX	16
+
+// A register IPC message (sys_ipc_send_msg, sys_ipc_call,
+// sys_ipc_reply_wait).  The words travel in ECX, EBX, EDI, ESI and EBP;
+// EDX names the other env and EAX carries the system call number in and
+// the result out.  Plain sys_ipc_try_send puts its value in word 0.
+#define IPC_MSG_WORDS		5
+
+struct ipc_msg {
+	uint32_t m_w[IPC_MSG_WORDS];
+};
+
+// IPC endpoints (sys_ep_*).  An endpoint ID has a generation above
+// the endpoint's index, EPX(epid), like an envid, so that a stale ID
+// stops working once its endpoint is destroyed.
+typedef int32_t epid_t;
+
+#define LOG2NENDPOINT		8
+#define NENDPOINT		(1 << LOG2NENDPOINT)
+#define EPX(epid)		((epid) & (NENDPOINT - 1))
+
 // Special environment types
 enum EnvType {
 	ENV_TYPE_USER = 0,
@@ -55,6 +78,9 @@ struct Env {
 
 	// Address space
 	pde_t *env_pgdir;		// Kernel virtual address of page dir
+	const uint8_t *env_binary;	// Embedded ELF image loaded on demand
+	uint64_t env_load_cycles;	// Cycles spent in load_icode
+	size_t env_stack_limit;		// Bytes the stack may grow to
 
 	// Exception handling
 	void *env_pgfault_upcall;	// Page fault upcall entry point
@@ -62,9 +88,53 @@ struct Env {
 	// Lab 4 IPC
 	bool env_ipc_recving;		// Env is blocked receiving
 	void *env_ipc_dstva;		// VA at which to map received page
-	uint32_t env_ipc_value;		// Data value sent to us
+	size_t env_ipc_dstnpages;	// Pages that fit at env_ipc_dstva
+	struct ipc_msg env_ipc_msg;	// Message sent to us
 	envid_t env_ipc_from;		// envid of the sender
 	int env_ipc_perm;		// Perm of page mapping received
+	size_t env_ipc_npages;		// Pages received at env_ipc_dstva
+
+	// IPC send queue (kern/ipc.c)
+	struct Env *env_ipc_qhead;	// Senders blocked on us, oldest first
+	struct Env *env_ipc_qtail;
+	struct Env *env_ipc_qnext;	// Next sender in the queue we're in
+	envid_t env_ipc_sendto;		// Env whose queue we're in, or 0
+	struct ipc_msg env_ipc_send_msg;	// Our queued message
+	void *env_ipc_send_srcva;
+	size_t env_ipc_send_npages;
+	int env_ipc_send_perm;
+	uint32_t env_ipc_qlen;		// Senders in our queue now
+	uint32_t env_ipc_queued;	// Senders ever queued on us
+	uint32_t env_ipc_drops;		// Sends refused with -E_AGAIN
+	bool env_ipc_send_call;		// Queued message is an ipc_call
+
+	// Synchronous call/reply (kern/ipc.c)
+	envid_t env_ipc_replyfrom;	// Env we called and await a reply from
+	bool env_ipc_inregs;		// Receiving in registers (reply_wait)
+
+	// IPC endpoints (kern/endpoint.c)
+	uint32_t env_ep_caps[NENDPOINT / 32];	// Endpoints we may send to
+	uint32_t env_ep_waitset[NENDPOINT / 32];	// Endpoints we wait on
+	bool env_ep_waiting;		// Env is blocked in sys_ep_recv
+	epid_t env_ep_sendto;		// Endpoint whose queue we're in, or 0
+	struct Env *env_ep_qnext;	// Next sender in that queue
+	uint32_t env_ep_last;		// Index of the endpoint served last
+
+	// Futex wait (kern/futex.c)
+	physaddr_t env_futex_pa;	// Word we sleep on, or 0
+	struct Env *env_futex_next;	// Next sleeper in our hash chain
+	nanoseconds_t env_futex_deadline;	// Wake with -E_TIMEOUT, or 0
+
+	// Batched system calls (kern/sysring.c)
+	void *env_sysring;		// User address of our struct sysring
+
+	// Page fault statistics and fault-around (kern/trap.c)
+	uint32_t env_faults;		// Page faults taken
+	uint32_t env_prefaults;		// Pages resolved ahead of a fault
+	uint32_t env_prefault_hits;	// Of those, pages written later
+	uint32_t env_fault_around;	// Pages to resolve after the next fault
+	uint32_t env_nprefault;		// Pages resolved after the last fault
+	uintptr_t env_prefault_va;	// First of those pages
 };
 
 #endif // !JOS_INC_ENV_H
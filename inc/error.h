@@ -16,6 +16,11 @@ enum {
 
 	E_IPC_NOT_RECV	,	// Attempt to send to env that is not recving
 	E_EOF		,	// Unexpected end of file
+	E_NOT_EXEC	,	// File not a valid executable
+	E_NOT_FOUND	,	// Named object not found
+	E_EXISTS	,	// Named object already exists
+	E_AGAIN		,	// Resource busy, try again later
+	E_TIMEOUT	,	// Timed out waiting
 
 	MAXERROR
 };
@@ -18,6 +18,10 @@
 #include <inc/memlayout.h>
 #include <inc/syscall.h>
 #include <inc/sysinfo.h>
+#include <inc/vdso.h>
+#include <inc/ring.h>
+#include <inc/mutex.h>
+#include <inc/sysring.h>
 #include <inc/trap.h>
 
 #define USED(x)		(void)(x)
@@ -30,6 +34,7 @@ extern const char *binaryname;
 extern const volatile struct Env *thisenv;
 extern const volatile struct Env envs[NENV];
 extern const volatile struct PageInfo pages[];
+extern const volatile struct vdso vdso;
 
 // exit.c
 void	exit(void);
@@ -41,6 +46,7 @@ void	set_pgfault_handler(void (*handler)(struct UTrapframe *utf));
 char*	readline(const char *buf);
 
 // syscall.c
+extern int syscall_sysenter;
 void	sys_cputs(const char *string, size_t len);
 int	sys_cgetc(void);
 envid_t	sys_getenvid(void);
@@ -49,13 +55,51 @@ int	sys_page_alloc(envid_t env, void *pg, int perm);
 int	sys_page_map(envid_t src_env, void *src_pg,
 		     envid_t dst_env, void *dst_pg, int perm);
 int	sys_page_unmap(envid_t env, void *pg);
+int	sys_page_copy(envid_t src_env, void *src_pg,
+		      envid_t dst_env, void *dst_pg, int perm);
 void	sys_yield(void);
 static envid_t sys_exofork(void);
 int	sys_env_set_status(envid_t env, int status);
+int	sys_env_set_trapframe(envid_t env, struct Trapframe *tf);
+int	sys_env_set_stack_limit(envid_t env, size_t size);
 int	sys_env_set_pgfault_upcall(envid_t env, void *upcall);
 int	sys_sysinfo(struct sysinfo *info);
 int	sys_ipc_try_send(envid_t to_env, uint32_t value, void *pg, int perm);
+int	sys_ipc_send(envid_t to_env, uint32_t value, void *pg, int perm);
 int	sys_ipc_recv(void *rcv_pg);
+int	sys_ipc_send_range(envid_t to_env, uint32_t value, void *pg,
+			   size_t npages, int perm);
+int	sys_ipc_recv_range(void *rcv_pg, size_t npages);
+int	sys_ipc_call(envid_t to_env, struct ipc_msg *msg);
+envid_t	sys_ipc_reply_wait(envid_t to_env, struct ipc_msg *msg);
+int	sys_ipc_send_msg(envid_t to_env, const struct ipc_msg *msg);
+envid_t	sys_fork(void);
+int	sys_page_alloc_vec(envid_t env, const struct page_range *vec, size_t n,
+			   size_t *done);
+int	sys_page_map_vec(envid_t src_env, envid_t dst_env,
+			 const struct page_range *vec, size_t n, size_t *done);
+int	sys_page_unmap_vec(envid_t env, const struct page_range *vec, size_t n,
+			   size_t *done);
+int	sys_vm_ranges(envid_t env, void *va, struct page_range *ranges,
+		      size_t n);
+envid_t	sys_spawn(const void *binary, size_t size, const char **argv);
+int	sys_shm_create(const char *name, size_t npages);
+int	sys_shm_attach(envid_t env, const char *name, void *va, int perm);
+int	sys_shm_detach(envid_t env, const char *name, void *va);
+int	sys_shm_remove(const char *name);
+// Futex words must be in PTE_SHARE or shm memory: waiters and wakers
+// on a copy-on-write page end up on different pages and miss wakeups.
+int	sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+		       nanoseconds_t timeout);
+int	sys_futex_wake(volatile uint32_t *addr, int n);
+epid_t	sys_ep_create(void);
+int	sys_ep_destroy(epid_t epid);
+int	sys_ep_grant(epid_t epid, envid_t envid);
+int	sys_ep_send(epid_t epid, const struct ipc_msg *msg);
+epid_t	sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+		    envid_t *from_env_store);
+int	sys_sysring_setup(struct sysring *ring);
+int	sys_sysring_enter(void);
 
 // This must be inlined.  Exercise for reader: why?
 static inline envid_t __attribute__((always_inline))
@@ -71,13 +115,50 @@ sys_exofork(void)
 // ipc.c
 void	ipc_send(envid_t to_env, uint32_t value, void *pg, int perm);
 int32_t ipc_recv(envid_t *from_env_store, void *pg, int *perm_store);
+void	ipc_send_range(envid_t to_env, uint32_t value, void *pg, size_t npages,
+		       int perm);
+int32_t ipc_recv_range(envid_t *from_env_store, void *pg, size_t *npages,
+		       int *perm_store);
+void	ipc_send_msg(envid_t to_env, const struct ipc_msg *msg);
+envid_t	ipc_recv_msg(struct ipc_msg *msg);
+int	ipc_call(envid_t to_env, struct ipc_msg *msg);
+envid_t	ipc_reply_wait(envid_t to_env, struct ipc_msg *msg);
+int	ep_send(epid_t epid, const struct ipc_msg *msg);
 envid_t	ipc_find_env(enum EnvType type);
 
 // fork.c
-#define	PTE_SHARE	0x400
 envid_t	fork(void);
+envid_t	ufork(void);
 envid_t	sfork(void);	// Challenge!
 
+// mutex.c
+void	mutex_init(struct mutex *m);
+void	mutex_lock(struct mutex *m);
+bool	mutex_trylock(struct mutex *m);
+void	mutex_unlock(struct mutex *m);
+void	cond_init(struct cond *c);
+void	cond_wait(struct cond *c, struct mutex *m);
+int	cond_timedwait(struct cond *c, struct mutex *m, nanoseconds_t timeout);
+void	cond_signal(struct cond *c);
+void	cond_broadcast(struct cond *c);
+
+// ring.c
+int	ring_init(struct ring *r, size_t size, size_t msgsize);
+bool	ring_put(struct ring *r, const void *msg);
+bool	ring_get(struct ring *r, void *msg);
+
+// sysring.c
+int	sysring_init(struct sysring *sr);
+bool	sysring_push(struct sysring *sr, const struct sysring_sqe *sqe);
+int	sysring_submit(struct sysring *sr);
+bool	sysring_reap(struct sysring *sr, struct sysring_cqe *cqe);
+void	ring_send(struct ring *r, const void *msg);
+void	ring_recv(struct ring *r, void *msg);
+
+// spawn.c
+envid_t	spawn(const void *binary, size_t size, const char **argv);
+envid_t	uspawn(const void *binary, size_t size, const char **argv);
+
 // time.c
 nanoseconds_t	uptime(void);
 void	nanosleep(nanoseconds_t nanoseconds);
@@ -50,14 +50,19 @@
  *    UVPT      ---->  +------------------------------+ 0xef400000
  *                     |          RO PAGES            | R-/R-  PTSIZE
  *    UPAGES    ---->  +------------------------------+ 0xef000000
+ *                     |       RO VDSO (one page)     | R-/R-  PGSIZE
+ *    UVDSO     ---->  + - - - - - - - - - - - - - - -+ 0xeefff000
  *                     |           RO ENVS            | R-/R-  PTSIZE
  * UTOP,UENVS ------>  +------------------------------+ 0xeec00000
  * UXSTACKTOP -/       |     User Exception Stack     | RW/RW  PGSIZE
  *                     +------------------------------+ 0xeebff000
  *                     |       Empty Memory (*)       | --/--  PGSIZE
  *    USTACKTOP  --->  +------------------------------+ 0xeebfe000
- *                     |      Normal User Stack       | RW/RW  PGSIZE
- *                     +------------------------------+ 0xeebfd000
+ *                     |      Normal User Stack       | RW/RW  USTACKSIZE
+ *                     |  (mapped as it grows down)   |
+ *                     +------------------------------+ 0xeeafe000
+ *                     |   Stack Guard Page (*)       | --/--  PGSIZE
+ *                     +------------------------------+ 0xeeafd000
  *                     |                              |
  *                     |                              |
  *                     ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -114,6 +119,9 @@
 #define UPAGES		(UVPT - PTSIZE)
 // Read-only copies of the global env structures
 #define UENVS		(UPAGES - PTSIZE)
+// Kernel-updated time and system information (struct vdso), in the
+// last page of the UENVS slot
+#define UVDSO		(UPAGES - PGSIZE)
 
 /*
  * Top of user VM. User can manipulate VA from UTOP-1 and down!
@@ -126,6 +134,10 @@
 // Next page left invalid to guard against exception stack overflow; then:
 // Top of normal user stack
 #define USTACKTOP	(UTOP - 2*PGSIZE)
+// Most a user stack may grow to.  Only the top page is mapped when an
+// env starts; the kernel maps the rest as the stack grows into it, up
+// to the env's limit, and the page below the limit is never mapped.
+#define USTACKSIZE	(256*PGSIZE)
 
 // Where user programs generally begin
 #define UTEXT		(2*PTSIZE)
@@ -187,6 +199,9 @@ struct PageInfo {
 	// boot_alloc do not have valid reference count fields.
 
 	uint16_t pp_ref;
+
+	// Kernel bookkeeping flags (PP_* in kern/pmap.h).
+	uint16_t pp_flags;
 };
 
 #endif /* !__ASSEMBLER__ */
@@ -0,0 +1,19 @@
+#ifndef JOS_INC_MUTEX_H
+#define JOS_INC_MUTEX_H
+
+#include <inc/types.h>
+
+// A sleeping lock for envs that share memory (PTE_SHARE pages or a
+// shared-memory segment, see sys_shm_create).  An uncontended lock and
+// unlock stay in user space; only waiters make system calls, to block
+// in sys_futex_wait.  See lib/mutex.c.
+struct mutex {
+	volatile uint32_t m_state;	// 0 free, 1 held, 2 held with waiters
+};
+
+// A condition variable to use with a struct mutex.
+struct cond {
+	volatile uint32_t c_seq;	// bumped by every signal
+};
+
+#endif	// !JOS_INC_MUTEX_H
@@ -0,0 +1,22 @@
+#ifndef JOS_INC_RING_H
+#define JOS_INC_RING_H
+
+#include <inc/types.h>
+
+// A lock-free ring of fixed-size messages for exactly one producer and
+// one consumer, laid out in memory both can see (a shared-memory
+// segment, see sys_shm_create).  Neither side makes a system call per
+// message: the producer only ever writes r_head and the consumer only
+// r_tail, each in its own cache line.
+struct ring {
+	volatile uint32_t r_head;	// messages put so far
+	uint8_t r_pad0[60];
+	volatile uint32_t r_tail;	// messages taken so far
+	uint8_t r_pad1[60];
+	uint32_t r_nslots;		// a power of two
+	uint32_t r_msgsize;
+	uint8_t r_pad2[56];
+	uint8_t r_data[];
+};
+
+#endif	// !JOS_INC_RING_H
@@ -1,6 +1,8 @@
 #ifndef JOS_INC_SYSCALL_H
 #define JOS_INC_SYSCALL_H
 
+#include <inc/types.h>
+
 /* system call numbers */
 enum {
 	SYS_cputs = 0,
@@ -17,7 +19,65 @@ enum {
 	SYS_sysinfo,
 	SYS_ipc_try_send,
 	SYS_ipc_recv,
+	SYS_fork,
+	SYS_page_alloc_vec,
+	SYS_page_map_vec,
+	SYS_page_unmap_vec,
+	SYS_vm_ranges,
+	SYS_env_set_trapframe,
+	SYS_spawn,
+	SYS_shm_create,
+	SYS_shm_attach,
+	SYS_shm_detach,
+	SYS_shm_remove,
+	SYS_env_set_stack_limit,
+	SYS_ipc_send,
+	SYS_ipc_call,
+	SYS_ipc_reply_wait,
+	SYS_ipc_send_msg,
+	SYS_ipc_send_range,
+	SYS_ipc_recv_range,
+	SYS_futex_wait,
+	SYS_futex_wake,
+	SYS_ep_create,
+	SYS_ep_destroy,
+	SYS_ep_grant,
+	SYS_ep_send,
+	SYS_ep_recv,
+	SYS_sysring_setup,
+	SYS_sysring_enter,
+	SYS_page_copy,
 	NSYSCALLS
 };
 
+// Flags that may be or'ed into the 'perm' argument of the page system
+// calls.  They live above the PTE bits and never reach a page table.
+#define PAGE_ZERO_FILL	0x1000	// sys_page_alloc: share the zero page
+				// until the first write
+#define PAGE_MOVE	0x2000	// sys_page_map, IPC page sends: unmap
+				// the source in the same operation
+
+// A run of pages for the vector page system calls (sys_page_alloc_vec,
+// sys_page_map_vec, sys_page_unmap_vec, sys_vm_ranges).  Each call
+// takes an array of at most PAGE_VEC_MAX of these, and the kernel works
+// through at most PAGE_VEC_MAXPAGES pages of them per call.
+struct page_range {
+	void *pr_va;		// first page
+	size_t pr_npages;	// number of pages
+	int pr_perm;		// perm for every page (alloc, map)
+	void *pr_dstva;		// first destination page (map only)
+};
+
+#define PAGE_VEC_MAX	32
+#define PAGE_VEC_MAXPAGES	1024
+
+// Named shared-memory segments (sys_shm_*): the longest name, including
+// the terminating NUL, and the largest segment in pages.
+#define SHM_NAMELEN	32
+#define SHM_MAXPAGES	1024
+
+// Most pages one message can carry (sys_ipc_send_range) or one
+// receive window can hold (sys_ipc_recv_range).
+#define IPC_RANGE_MAX	1024
+
 #endif /* !JOS_INC_SYSCALL_H */
@@ -9,6 +9,17 @@ struct sysinfo {
 	size_t totalpages, freepages;
 	uint64_t inblocks, outblocks;
 	uint64_t inpackets, outpackets;
+	// Page faults resolved by the kernel and the cycles it spent on
+	// them, and page faults passed to a user-level handler.
+	uint64_t kfaults, kfault_cycles;
+	uint64_t upcalls;
+	// Same-page merging: mappings merged and broken again so far,
+	// merged pages in use, and physical pages saved by them.
+	uint32_t ksm_merges, ksm_unmerges;
+	uint32_t ksm_shared, ksm_saved;
+	// ELF image cache: binaries and pages held, and physical pages
+	// saved by mapping them into several envs.
+	uint32_t elfcache_images, elfcache_pages, elfcache_saved;
 };
 
 #endif	// !JOS_INC_SYSINFO_H
@@ -0,0 +1,41 @@
+#ifndef JOS_INC_SYSRING_H
+#define JOS_INC_SYSRING_H
+
+#include <inc/types.h>
+
+// Slots in each half of a struct sysring; a power of two.
+#define SYSRING_NENTRIES	64
+
+// A queued system call: the number and arguments syscall() would take,
+// plus a tag that comes back unchanged in its completion.
+struct sysring_sqe {
+	uint32_t se_num;
+	uint32_t se_args[5];
+	uint32_t se_data;
+};
+
+// The result of one queued system call.
+struct sysring_cqe {
+	uint32_t ce_data;		// se_data of the call
+	int32_t ce_result;		// what the system call returned
+};
+
+// A submission ring and a completion ring in one user page, registered
+// with sys_sysring_setup.  The env queues system calls in sr_sq and
+// sys_sysring_enter runs all of them in one trap, posting results to
+// sr_cq.  Counters only grow; entry i lives in slot i % SYSRING_NENTRIES.
+// Each counter is written by one side only, in its own cache line.
+struct sysring {
+	volatile uint32_t sr_sq_tail;	// calls queued (user)
+	uint8_t sr_pad0[60];
+	volatile uint32_t sr_sq_head;	// calls taken (kernel)
+	uint8_t sr_pad1[60];
+	volatile uint32_t sr_cq_tail;	// results posted (kernel)
+	uint8_t sr_pad2[60];
+	volatile uint32_t sr_cq_head;	// results taken (user)
+	uint8_t sr_pad3[60];
+	struct sysring_sqe sr_sq[SYSRING_NENTRIES];
+	struct sysring_cqe sr_cq[SYSRING_NENTRIES];
+};
+
+#endif	// !JOS_INC_SYSRING_H
@@ -0,0 +1,56 @@
+#ifndef JOS_INC_VDSO_H
+#define JOS_INC_VDSO_H
+
+#include <inc/types.h>
+#include <inc/time.h>
+
+// Room for every CPU the kernel supports (NCPU in kern/cpu.h).
+#define VDSO_NCPU	8
+
+// The page the kernel maps read-only into every env at UVDSO.
+//
+// CPU 0 rewrites the time and memory fields on every clock tick.  A
+// reader copies them out between two reads of vd_seq and retries if
+// vd_seq was odd (an update in progress) or changed (see vdso_begin
+// and vdso_retry).
+struct vdso {
+	volatile uint32_t vd_seq;	// seqcount, odd during an update
+
+	// Time: vd_uptime was the uptime when the TSC read vd_tick_tsc.
+	// The TSC advances about vd_tsc_per_tick per vd_ns_per_tick, so
+	// readers can interpolate between ticks.
+	nanoseconds_t vd_uptime;
+	nanoseconds_t vd_ns_per_tick;
+	uint64_t vd_tick_tsc;
+	uint64_t vd_tsc_per_tick;	// 0 until calibrated
+
+	// Physical memory, in pages.
+	uint32_t vd_totalpages, vd_freepages;
+
+	// Per-CPU data, as of the last tick.
+	uint32_t vd_ncpu;
+	struct {
+		int32_t vc_envid;	// env running there, or 0
+		uint32_t vc_halted;	// idle in sched_halt
+	} vd_cpus[VDSO_NCPU];
+};
+
+static inline uint32_t
+vdso_begin(const volatile struct vdso *vd)
+{
+	uint32_t seq;
+
+	while ((seq = vd->vd_seq) & 1)
+		asm volatile("pause");
+	asm volatile("" : : : "memory");
+	return seq;
+}
+
+static inline bool
+vdso_retry(const volatile struct vdso *vd, uint32_t seq)
+{
+	asm volatile("" : : : "memory");
+	return vd->vd_seq != seq;
+}
+
+#endif	// !JOS_INC_VDSO_H
@@ -273,6 +273,11 @@ xchg(volatile uint32_t *addr, uint32_t newval)
 	return result;
 }
 
+// Model-specific registers that set up sysenter.
+#define MSR_IA32_SYSENTER_CS	0x174
+#define MSR_IA32_SYSENTER_ESP	0x175
+#define MSR_IA32_SYSENTER_EIP	0x176
+
 static inline uint64_t
 read_msr(uint32_t msr)
 {
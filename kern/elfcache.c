@@ -0,0 +1,231 @@
+// Demand loading of the binaries embedded in the kernel, and a cache
+// of their pages.
+//
+// load_icode maps nothing but the stack: it records the image in
+// env_binary, and elfcache_fault() maps each page of an ELF_PROG_LOAD
+// segment the first time the env touches it.  Pages holding file data
+// come from a per-binary cache, filled from the image on first use.
+// The cache keeps a reference to each page for good, and every env of
+// the same binary maps that page instead of getting a copy: read-only
+// segments (text, rodata) are mapped read-only, writable ones (data)
+// copy-on-write, so an env only pays for the data pages it writes.
+// Whole pages of bss are mapped to the zero page.
+//
+// Embedded binaries never change or go away, so the image address is
+// the cache key and nothing is ever evicted.  A binary the cache can't
+// take is demand-loaded into private pages instead.
+
+#include <inc/assert.h>
+#include <inc/elf.h>
+#include <inc/error.h>
+#include <inc/string.h>
+
+#include <kern/env.h>
+#include <kern/pmap.h>
+#include <kern/elfcache.h>
+
+// The pages of an image, in segment and address order, are listed in
+// one page of pointers, which bounds the file data of an image.
+#define ELFCACHE_MAXPAGES	(PGSIZE / sizeof(struct PageInfo *))
+
+struct elf_image {
+	const uint8_t *ei_binary;
+	struct PageInfo **ei_pages;	// NULL until first touched
+	size_t ei_npages;
+};
+
+static struct elf_image elf_images[ELFCACHE_NIMAGES];
+
+// Page-aligned range of the file data of segment 'ph'.
+static void
+segment_data(const struct Proghdr *ph, uintptr_t *start, uintptr_t *end)
+{
+	*start = ROUNDDOWN(ph->p_va, PGSIZE);
+	*end = ROUNDUP(ph->p_va + ph->p_filesz, PGSIZE);
+}
+
+// Copy the file data of 'binary' that belongs at page 'va' into the
+// zeroed page at kernel address 'kva'.
+static void
+image_fill_page(const uint8_t *binary, uintptr_t va, char *kva)
+{
+	const struct Elf *elf = (const struct Elf *) binary;
+	const struct Proghdr *ph, *eph;
+	uintptr_t start, end;
+
+	ph = (const struct Proghdr *) (binary + elf->e_phoff);
+	eph = ph + elf->e_phnum;
+	for (; ph < eph; ph++) {
+		if (ph->p_type != ELF_PROG_LOAD)
+			continue;
+		start = MAX(va, ph->p_va);
+		end = MIN(va + PGSIZE, ph->p_va + ph->p_filesz);
+		if (start < end)
+			memcpy(kva + PGOFF(start),
+			       binary + ph->p_offset + (start - ph->p_va),
+			       end - start);
+	}
+}
+
+// Set up a cache slot for 'binary'.  Returns -E_INVAL if the binary is
+// too big for the cache or two segments share a page, -E_NO_MEM if out
+// of memory.
+static int
+elfcache_fill(struct elf_image *ei, const uint8_t *binary)
+{
+	const struct Elf *elf = (const struct Elf *) binary;
+	const struct Proghdr *ph, *eph;
+	struct PageInfo *pp;
+	uintptr_t start, end, prev_end = 0;
+	size_t n = 0;
+
+	ph = (const struct Proghdr *) (binary + elf->e_phoff);
+	eph = ph + elf->e_phnum;
+	for (; ph < eph; ph++) {
+		if (ph->p_type != ELF_PROG_LOAD)
+			continue;
+		if (ROUNDDOWN(ph->p_va, PGSIZE) < prev_end)
+			return -E_INVAL;
+		segment_data(ph, &start, &end);
+		n += (end - start) / PGSIZE;
+		prev_end = ROUNDUP(ph->p_va + ph->p_memsz, PGSIZE);
+	}
+	if (n > ELFCACHE_MAXPAGES)
+		return -E_INVAL;
+
+	if (!(pp = page_alloc(ALLOC_ZERO)))
+		return -E_NO_MEM;
+	pp->pp_ref++;
+	ei->ei_pages = page2kva(pp);
+	ei->ei_npages = n;
+	return 0;
+}
+
+// Find 'binary' in the cache, setting up a free slot if it is not there.
+static struct elf_image *
+elfcache_lookup(const uint8_t *binary)
+{
+	struct elf_image *ei, *free = NULL;
+
+	for (ei = elf_images; ei < elf_images + ELFCACHE_NIMAGES; ei++) {
+		if (ei->ei_binary == binary)
+			return ei;
+		if (!ei->ei_binary && !free)
+			free = ei;
+	}
+	if (!free || elfcache_fill(free, binary) < 0)
+		return NULL;
+	free->ei_binary = binary;
+	return free;
+}
+
+// Return the cached page at 'va' for 'ei', page 'i' of its file data,
+// reading it from the image on first use.
+static struct PageInfo *
+elfcache_page(struct elf_image *ei, size_t i, uintptr_t va)
+{
+	struct PageInfo *pp;
+
+	if ((pp = ei->ei_pages[i]))
+		return pp;
+	if (!(pp = page_alloc(ALLOC_ZERO)))
+		return NULL;
+	image_fill_page(ei->ei_binary, va, page2kva(pp));
+	pp->pp_ref++;
+	ei->ei_pages[i] = pp;
+	return pp;
+}
+
+//
+// Map the page at 'va' for env 'e' from its embedded binary, if 'va'
+// lies in one of the binary's loadable segments and nothing is mapped
+// there yet.  File data is mapped from the cache (read-only, or copy-
+// on-write for writable segments); whole pages of bss are mapped to
+// the zero page.  A write to the page will fault again and get a copy.
+//
+// "Nothing mapped" is all we go by: there is no record of which pages
+// were loaded before.  So a page of the image that the env unmaps on
+// purpose comes back, as the image has it, on the next touch instead
+// of faulting; data written there before the unmap is lost.  An env
+// that wants a hole in its image must map something else there.
+//
+// Returns 0 if the page was mapped, -E_INVAL if 'va' is not a page of
+// e's binary that is still to be loaded, -E_NO_MEM if out of memory.
+//
+int
+elfcache_fault(struct Env *e, uintptr_t va)
+{
+	const uint8_t *binary = e->env_binary;
+	const struct Elf *elf = (const struct Elf *) binary;
+	const struct Proghdr *ph, *eph;
+	struct elf_image *ei;
+	struct PageInfo *pp;
+	uintptr_t start = 0, end = 0;
+	size_t i = 0;
+	int perm, r;
+
+	if (!binary || va >= UTOP)
+		return -E_INVAL;
+	va = ROUNDDOWN(va, PGSIZE);
+	if (page_lookup(e->env_pgdir, (void *) va, NULL))
+		return -E_INVAL;
+
+	ph = (const struct Proghdr *) (binary + elf->e_phoff);
+	eph = ph + elf->e_phnum;
+	for (; ph < eph; ph++) {
+		if (ph->p_type != ELF_PROG_LOAD)
+			continue;
+		segment_data(ph, &start, &end);
+		if (va >= start && va < ph->p_va + ph->p_memsz)
+			break;
+		i += (end - start) / PGSIZE;
+	}
+	if (ph == eph)
+		return -E_INVAL;
+	if (va >= end)
+		return page_map_zero(e->env_pgdir, (void *) va,
+				     PTE_P | PTE_U | PTE_W);
+
+	i += (va - start) / PGSIZE;
+	perm = PTE_P | PTE_U;
+	if ((ei = elfcache_lookup(binary))) {
+		if (!(pp = elfcache_page(ei, i, va)))
+			return -E_NO_MEM;
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+			perm |= PTE_COW;
+		return page_insert(e->env_pgdir, pp, (void *) va, perm);
+	}
+
+	// Not cacheable: demand-load a private copy.
+	if (!(pp = page_alloc(ALLOC_ZERO)))
+		return -E_NO_MEM;
+	image_fill_page(binary, va, page2kva(pp));
+	if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+		perm |= PTE_W;
+	if ((r = page_insert(e->env_pgdir, pp, (void *) va, perm)) < 0)
+		page_free(pp);
+	return r;
+}
+
+void
+elfcache_get_stats(struct elfcache_stats *stats)
+{
+	struct elf_image *ei;
+	size_t i;
+
+	memset(stats, 0, sizeof(*stats));
+	for (ei = elf_images; ei < elf_images + ELFCACHE_NIMAGES; ei++) {
+		if (!ei->ei_binary)
+			continue;
+		stats->images++;
+		// The cache's own reference plus one env would be one
+		// private copy; every further mapping is a page saved.
+		for (i = 0; i < ei->ei_npages; i++) {
+			if (!ei->ei_pages[i])
+				continue;
+			stats->pages++;
+			if (ei->ei_pages[i]->pp_ref > 2)
+				stats->saved += ei->ei_pages[i]->pp_ref - 2;
+		}
+	}
+}
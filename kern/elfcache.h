@@ -0,0 +1,23 @@
+#ifndef JOS_KERN_ELFCACHE_H
+#define JOS_KERN_ELFCACHE_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+
+struct Env;
+
+// Number of distinct embedded binaries whose pages can be cached.
+#define ELFCACHE_NIMAGES	16
+
+struct elfcache_stats {
+	uint32_t images;	// binaries in the cache
+	uint32_t pages;		// physical pages held by the cache
+	uint32_t saved;		// pages saved over a private copy per env
+};
+
+int	elfcache_fault(struct Env *e, uintptr_t va);
+void	elfcache_get_stats(struct elfcache_stats *stats);
+
+#endif	// !JOS_KERN_ELFCACHE_H
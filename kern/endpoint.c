@@ -0,0 +1,311 @@
+// IPC endpoints.
+//
+// An endpoint is a kernel channel owned by the env that created it.
+// Only its owner receives from it, and only envs holding a capability
+// for it may send to it.  The owner starts with the capability, and
+// any holder can grant it to another env (ep_grant), so the handle is
+// passed on like a capability rather than guessed.  Capabilities are
+// a bitmap in struct Env indexed by EPX(epid); destroying an endpoint
+// clears its bit everywhere and bumps the generation in its ID.
+//
+// The owner waits on any set of its endpoints at once (ep_recv) and
+// learns which one fired, so one server env can serve many separate
+// channels.  Messages are struct ipc_msg in registers, as for
+// sys_ipc_call.  A sender that finds the owner waiting on the endpoint
+// hands the message over at once; otherwise it sleeps in the
+// endpoint's FIFO queue, of at most EP_QUEUE_MAX senders, until the
+// owner takes its message.
+
+#include <inc/assert.h>
+#include <inc/error.h>
+#include <inc/string.h>
+
+#include <kern/env.h>
+#include <kern/sched.h>
+#include <kern/usercopy.h>
+#include <kern/ipc.h>
+#include <kern/endpoint.h>
+
+struct endpoint {
+	epid_t ep_id;			// last ID given out for this slot
+	envid_t ep_owner;		// 0 if the slot is free
+	struct Env *ep_qhead;		// senders waiting, oldest first
+	struct Env *ep_qtail;
+	uint32_t ep_qlen;
+};
+
+static struct endpoint endpoints[NENDPOINT];
+
+static bool
+ep_bit(const uint32_t *map, int x)
+{
+	return map[x / 32] & (1U << (x % 32));
+}
+
+static void
+ep_bit_set(uint32_t *map, int x)
+{
+	map[x / 32] |= 1U << (x % 32);
+}
+
+static void
+ep_bit_clear(uint32_t *map, int x)
+{
+	map[x / 32] &= ~(1U << (x % 32));
+}
+
+// Find the live endpoint with ID 'epid'.
+static struct endpoint *
+ep_lookup(epid_t epid)
+{
+	struct endpoint *ep;
+
+	if (epid <= 0)
+		return NULL;
+	ep = &endpoints[EPX(epid)];
+	if (!ep->ep_owner || ep->ep_id != epid)
+		return NULL;
+	return ep;
+}
+
+// Give 'e' the message 'msg' from 'from' on 'ep', as the result of the
+// sys_ep_recv it is in: the endpoint in AX, the sender in DX and the
+// message in the message registers.  Returns the endpoint ID.
+static epid_t
+ep_deliver(struct endpoint *ep, struct Env *e, envid_t from,
+	   const struct ipc_msg *msg)
+{
+	e->env_ep_waiting = 0;
+	e->env_ep_last = EPX(ep->ep_id);
+	e->env_tf.tf_regs.reg_edx = from;
+	ipc_msg_put(&e->env_tf.tf_regs, msg);
+	return ep->ep_id;
+}
+
+// Take the first sender off ep's queue.
+static struct Env *
+ep_dequeue(struct endpoint *ep)
+{
+	struct Env *s = ep->ep_qhead;
+
+	if (s) {
+		if (!(ep->ep_qhead = s->env_ep_qnext))
+			ep->ep_qtail = NULL;
+		ep->ep_qlen--;
+		s->env_ep_qnext = NULL;
+		s->env_ep_sendto = 0;
+	}
+	return s;
+}
+
+// Let 'e' return 'r' from the system call it is blocked in.
+static void
+ep_wake(struct Env *e, int r)
+{
+	e->env_tf.tf_regs.reg_eax = r;
+	e->env_status = ENV_RUNNABLE;
+}
+
+// Free 'ep': fail the senders waiting on it and take away every
+// capability for it.
+static void
+ep_release(struct endpoint *ep)
+{
+	struct Env *s;
+	int x = EPX(ep->ep_id), i;
+
+	while ((s = ep_dequeue(ep)))
+		ep_wake(s, -E_NOT_FOUND);
+	for (i = 0; i < NENV; i++) {
+		ep_bit_clear(envs[i].env_ep_caps, x);
+		ep_bit_clear(envs[i].env_ep_waitset, x);
+	}
+	ep->ep_owner = 0;
+}
+
+//
+// Create an endpoint owned by the current env, which gets the
+// capability to send to it.
+// Returns the new endpoint's ID, or -E_NO_MEM if all NENDPOINT
+// endpoints are in use.
+//
+int
+ep_create(void)
+{
+	struct endpoint *ep;
+	int32_t generation;
+	int i;
+
+	for (i = 0; i < NENDPOINT; i++)
+		if (!endpoints[i].ep_owner)
+			break;
+	if (i == NENDPOINT)
+		return -E_NO_MEM;
+
+	ep = &endpoints[i];
+	generation = (ep->ep_id + (1 << LOG2NENDPOINT)) & ~(NENDPOINT - 1);
+	if (generation <= 0)	// Don't create a negative epid.
+		generation = 1 << LOG2NENDPOINT;
+	ep->ep_id = generation | i;
+	ep->ep_owner = curenv->env_id;
+	ep->ep_qhead = ep->ep_qtail = NULL;
+	ep->ep_qlen = 0;
+	ep_bit_set(curenv->env_ep_caps, i);
+	return ep->ep_id;
+}
+
+//
+// Destroy endpoint 'epid', which the current env must own.
+// Senders waiting on it fail with -E_NOT_FOUND.
+// Returns 0 on success, -E_NOT_FOUND if there is no such endpoint of
+// ours.
+//
+int
+ep_destroy(epid_t epid)
+{
+	struct endpoint *ep;
+
+	if (!(ep = ep_lookup(epid)) || ep->ep_owner != curenv->env_id)
+		return -E_NOT_FOUND;
+	ep_release(ep);
+	return 0;
+}
+
+//
+// Let 'e' send to endpoint 'epid'.  The current env must hold the
+// capability itself.
+// Returns 0 on success, -E_NOT_FOUND if there is no such endpoint or
+// we may not send to it.
+//
+int
+ep_grant(epid_t epid, struct Env *e)
+{
+	if (!ep_lookup(epid) || !ep_bit(curenv->env_ep_caps, EPX(epid)))
+		return -E_NOT_FOUND;
+	ep_bit_set(e->env_ep_caps, EPX(epid));
+	return 0;
+}
+
+//
+// Send 'msg' to endpoint 'epid'.  If its owner is waiting on it, the
+// owner gets the message at once.  Otherwise wait in the endpoint's
+// queue: the call does not return, and the sender's system call later
+// returns 0, or -E_NOT_FOUND if the endpoint is destroyed first.
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NOT_FOUND if there is no such endpoint or we may not send to it.
+//	-E_INVAL if we own the endpoint.
+//	-E_AGAIN if EP_QUEUE_MAX senders are already waiting.
+//
+int
+ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+	struct endpoint *ep;
+	struct Env *owner, *src = curenv;
+
+	if (!(ep = ep_lookup(epid)) || !ep_bit(src->env_ep_caps, EPX(epid)))
+		return -E_NOT_FOUND;
+	owner = &envs[ENVX(ep->ep_owner)];
+	if (owner == src)
+		return -E_INVAL;
+
+	if (owner->env_ep_waiting && ep_bit(owner->env_ep_waitset, EPX(epid))) {
+		ep_wake(owner, ep_deliver(ep, owner, src->env_id, msg));
+		return 0;
+	}
+	if (ep->ep_qlen == EP_QUEUE_MAX)
+		return -E_AGAIN;
+
+	assert(!src->env_ep_sendto);
+	src->env_ipc_send_msg = *msg;
+	src->env_ep_sendto = epid;
+	src->env_ep_qnext = NULL;
+	if (ep->ep_qtail)
+		ep->ep_qtail->env_ep_qnext = src;
+	else
+		ep->ep_qhead = src;
+	ep->ep_qtail = src;
+	ep->ep_qlen++;
+
+	src->env_status = ENV_NOT_RUNNABLE;
+	sched_yield();
+}
+
+//
+// Receive a message on any of the 'n' endpoints whose IDs are in the
+// user array 'uepids'.  The current env must own them all.  If senders
+// are queued, serve the first endpoint after the one served last, so
+// that a busy endpoint cannot starve the others.  Otherwise block
+// until a message arrives, and never return.
+// The system call returns the ID of the endpoint that fired, with the
+// sender's envid in DX and the message in the message registers.
+// Returns < 0 on error.  Errors are:
+//	-E_INVAL if n is 0 or more than NENDPOINT.
+//	-E_NOT_FOUND if an ID is not an endpoint we own.
+//	-E_FAULT if uepids can't be read.
+//
+int
+ep_recv(const epid_t *uepids, size_t n)
+{
+	struct Env *e = curenv, *s;
+	uint32_t set[NENDPOINT / 32];
+	struct endpoint *ep;
+	epid_t epid;
+	size_t i;
+	int x, r;
+
+	if (n == 0 || n > NENDPOINT)
+		return -E_INVAL;
+	memset(set, 0, sizeof(set));
+	for (i = 0; i < n; i++) {
+		if ((r = copyin(&epid, &uepids[i], sizeof(epid))) < 0)
+			return r;
+		if (!(ep = ep_lookup(epid)) || ep->ep_owner != e->env_id)
+			return -E_NOT_FOUND;
+		ep_bit_set(set, EPX(epid));
+	}
+
+	for (i = 1; i <= NENDPOINT; i++) {
+		x = (e->env_ep_last + i) % NENDPOINT;
+		if (!ep_bit(set, x) || !(s = ep_dequeue(&endpoints[x])))
+			continue;
+		ep_wake(s, 0);
+		return ep_deliver(&endpoints[x], e, s->env_id,
+				  &s->env_ipc_send_msg);
+	}
+
+	memmove(e->env_ep_waitset, set, sizeof(set));
+	e->env_ep_waiting = 1;
+	e->env_status = ENV_NOT_RUNNABLE;
+	sched_yield();
+}
+
+//
+// Env 'e' is being freed: leave the endpoint queue it waits in, and
+// destroy the endpoints it owns.  Its capabilities go with it.
+//
+void
+ep_env_free(struct Env *e)
+{
+	struct endpoint *ep;
+	struct Env **pp, *prev = NULL;
+	int i;
+
+	if (e->env_ep_sendto && (ep = ep_lookup(e->env_ep_sendto))) {
+		for (pp = &ep->ep_qhead; *pp;
+		     prev = *pp, pp = &(*pp)->env_ep_qnext)
+			if (*pp == e) {
+				*pp = e->env_ep_qnext;
+				if (ep->ep_qtail == e)
+					ep->ep_qtail = prev;
+				ep->ep_qlen--;
+				break;
+			}
+	}
+	e->env_ep_sendto = 0;
+	e->env_ep_qnext = NULL;
+	e->env_ep_waiting = 0;
+
+	for (i = 0; i < NENDPOINT; i++)
+		if (endpoints[i].ep_owner == e->env_id)
+			ep_release(&endpoints[i]);
+}
@@ -0,0 +1,22 @@
+#ifndef JOS_KERN_ENDPOINT_H
+#define JOS_KERN_ENDPOINT_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+
+struct Env;
+struct ipc_msg;
+
+// Most senders that can wait in one endpoint's queue.
+#define EP_QUEUE_MAX	8
+
+int	ep_create(void);
+int	ep_destroy(epid_t epid);
+int	ep_grant(epid_t epid, struct Env *e);
+int	ep_send(epid_t epid, const struct ipc_msg *msg);
+int	ep_recv(const epid_t *uepids, size_t n);
+void	ep_env_free(struct Env *e);
+
+#endif	// !JOS_KERN_ENDPOINT_H
@@ -14,6 +14,10 @@
 #include <kern/sched.h>
 #include <kern/cpu.h>
 #include <kern/spinlock.h>
+#include <kern/usercopy.h>
+#include <kern/ipc.h>
+#include <kern/futex.h>
+#include <kern/endpoint.h>
 
 struct Env *envs = NULL;		// All environments
 static struct Env *env_free_list;	// Free environment list
@@ -259,11 +263,44 @@ env_alloc(struct Env **newenv_store, envid_t parent_id)
 	// Enable interrupts while in user mode.
 	// LAB 4: Your code here.
 
+	// Nothing to demand-load until load_icode says so.
+	e->env_binary = NULL;
+	e->env_load_cycles = 0;
+	e->env_stack_limit = USTACKSIZE;
+
 	// Clear the page fault handler until user installs one.
 	e->env_pgfault_upcall = 0;
 
-	// Also clear the IPC receiving flag.
+	// Also clear the IPC receiving flag, and start with an empty queue.
 	e->env_ipc_recving = 0;
+	e->env_ipc_qhead = e->env_ipc_qtail = e->env_ipc_qnext = NULL;
+	e->env_ipc_sendto = 0;
+	e->env_ipc_qlen = e->env_ipc_queued = e->env_ipc_drops = 0;
+	e->env_ipc_replyfrom = 0;
+	e->env_ipc_inregs = 0;
+
+	// No endpoints yet: capabilities are not inherited.
+	memset(e->env_ep_caps, 0, sizeof(e->env_ep_caps));
+	memset(e->env_ep_waitset, 0, sizeof(e->env_ep_waitset));
+	e->env_ep_waiting = 0;
+	e->env_ep_sendto = 0;
+	e->env_ep_qnext = NULL;
+	e->env_ep_last = 0;
+
+	// Not sleeping on a futex.
+	e->env_futex_pa = 0;
+	e->env_futex_next = NULL;
+	e->env_futex_deadline = 0;
+
+	// No system call ring; a forked child registers its own.
+	e->env_sysring = NULL;
+
+	// Start fault-around small; it grows if it pays off.
+	e->env_faults = 0;
+	e->env_prefaults = 0;
+	e->env_prefault_hits = 0;
+	e->env_fault_around = 1;
+	e->env_nprefault = 0;
 
 	// commit the allocation
 	env_free_list = e->env_link;
@@ -361,17 +398,17 @@ load_icode(struct Env *e, uint8_t *binary)
 
   ph = (struct Proghdr *) ((uint8_t *) bin + bin->e_phoff);
   eph = ph + bin->e_phnum;
-  
-  for (; ph < eph; ph++) {
-    region_alloc(e, (void*) ph->p_va, ph->p_memsz);
-
-    if (ph->p_type == ELF_PROG_LOAD) {
-      lcr3(PADDR(e->env_pgdir));
-      memset((void*) ph->p_va, 0, ph->p_memsz);
-      memcpy((void*) ph->p_va, binary+ph->p_offset, ph->p_filesz);
-      lcr3(PADDR(kern_pgdir));
-    } 
-  }
+
+  // Nothing is loaded yet: elfcache_fault() maps each page of the
+  // segments from the image the first time the env touches it.
+  for (; ph < eph; ph++)
+    if (ph->p_type == ELF_PROG_LOAD
+        && (ph->p_filesz > ph->p_memsz
+            || ph->p_va + ph->p_memsz < ph->p_va
+            || ph->p_va + ph->p_memsz > UTOP))
+      panic("load_icode: bad segment at %08x", ph->p_va);
+  e->env_binary = binary;
+
   // Now map one page for the program's initial stack
 	// at virtual address USTACKTOP - PGSIZE.
 
@@ -395,8 +432,222 @@ env_create(uint8_t *binary, enum EnvType type)
 	struct Env *e;
 	env_alloc(&e, 0);
   e->env_type = type;
-  
+
+  uint64_t start = read_tsc();
   load_icode(e, binary);
+  e->env_load_cycles = read_tsc() - start;
+}
+
+//
+// Map the page at 'va' in env 'e' for a segment being loaded, reusing
+// the page if an earlier segment already put one there.
+// Returns the page, or NULL if out of memory.
+//
+static struct PageInfo *
+segment_page(struct Env *e, uintptr_t va)
+{
+	struct PageInfo *pp;
+
+	if ((pp = page_lookup(e->env_pgdir, (void *) va, NULL))
+	    && pp != zero_page)
+		return pp;
+	if (!(pp = page_alloc(ALLOC_ZERO)))
+		return NULL;
+	if (page_insert(e->env_pgdir, pp, (void *) va,
+			PTE_P | PTE_U | PTE_W) < 0) {
+		page_free(pp);
+		return NULL;
+	}
+	return pp;
+}
+
+//
+// Load one ELF_PROG_LOAD segment whose file data is at user address
+// 'data' in the current env.  The data is copied straight into the
+// new pages through their kernel mappings, so 'e's page directory
+// never has to be loaded.  Whole pages of bss share the zero page.
+//
+static int
+segment_load(struct Env *e, const struct Proghdr *ph, const uint8_t *data)
+{
+	struct PageInfo *pp;
+	uintptr_t va, start, end;
+	uintptr_t data_end = ph->p_va + ph->p_filesz;
+	int r;
+
+	for (va = ROUNDDOWN(ph->p_va, PGSIZE); va < ph->p_va + ph->p_memsz;
+	     va += PGSIZE) {
+		if (va >= data_end) {
+			if (page_lookup(e->env_pgdir, (void *) va, NULL))
+				continue;
+			if ((r = page_map_zero(e->env_pgdir, (void *) va,
+					       PTE_P | PTE_U | PTE_W)) < 0)
+				return r;
+			continue;
+		}
+		if (!(pp = segment_page(e, va)))
+			return -E_NO_MEM;
+		start = MAX(va, ph->p_va);
+		end = MIN(va + PGSIZE, data_end);
+		if ((r = copyin((char *) page2kva(pp) + PGOFF(start),
+				data + (start - ph->p_va), end - start)) < 0)
+			return r;
+	}
+	return 0;
+}
+
+//
+// Load the ELF image of 'size' bytes at user address 'binary' in the
+// current env into the fresh env 'e', and set its entry point.
+// This is load_icode for images in user memory: every header is
+// checked against 'size' and UTOP before it is trusted.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NOT_EXEC if the image is not a valid ELF executable.
+//	-E_FAULT if the image is not readable by the current env.
+//	-E_NO_MEM on memory exhaustion.
+//
+int
+env_load_elf(struct Env *e, const uint8_t *binary, size_t size)
+{
+	struct Elf elf;
+	struct Proghdr ph;
+	uint32_t off;
+	int i, r;
+
+	if (size < sizeof(elf))
+		return -E_NOT_EXEC;
+	if ((r = copyin(&elf, binary, sizeof(elf))) < 0)
+		return r;
+	if (elf.e_magic != ELF_MAGIC)
+		return -E_NOT_EXEC;
+
+	for (i = 0; i < elf.e_phnum; i++) {
+		off = elf.e_phoff + i * sizeof(ph);
+		if (off < elf.e_phoff || off + sizeof(ph) > size)
+			return -E_NOT_EXEC;
+		if ((r = copyin(&ph, binary + off, sizeof(ph))) < 0)
+			return r;
+		if (ph.p_type != ELF_PROG_LOAD)
+			continue;
+		if (ph.p_filesz > ph.p_memsz
+		    || ph.p_va + ph.p_memsz < ph.p_va
+		    || ph.p_va + ph.p_memsz > UTOP
+		    || ph.p_offset + ph.p_filesz < ph.p_offset
+		    || ph.p_offset + ph.p_filesz > size)
+			return -E_NOT_EXEC;
+		if ((r = segment_load(e, &ph, binary + ph.p_offset)) < 0)
+			return r;
+	}
+	e->env_tf.tf_eip = elf.e_entry;
+	return 0;
+}
+
+//
+// Map the initial stack page for env 'e' and lay out the argument
+// strings from the NULL-terminated user array 'argv' (in the current
+// env) on it, the way lib/entry.S expects to find them:
+//
+//	USTACKTOP:	argument strings
+//			argv[0..argc-1], NULL
+//	esp:		argc, argv
+//
+// 'argv' may be NULL for no arguments.  Everything has to fit in the
+// one stack page.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_FAULT if argv or a string in it is not readable.
+//	-E_INVAL if the arguments do not fit on the stack page.
+//	-E_NO_MEM on memory exhaustion.
+//
+int
+env_init_stack(struct Env *e, const char **argv)
+{
+	struct PageInfo *pp;
+	char *stack, *strs;
+	uintptr_t *offs, *uargv;
+	const char *arg;
+	int argc, len, r;
+
+	if (!(pp = page_alloc(ALLOC_ZERO)))
+		return -E_NO_MEM;
+	if ((r = page_insert(e->env_pgdir, pp, (void *) (USTACKTOP - PGSIZE),
+			     PTE_P | PTE_U | PTE_W)) < 0) {
+		page_free(pp);
+		return r;
+	}
+
+	// Copy the strings down from the top of the page, recording
+	// their offsets from the bottom of the page up.
+	stack = page2kva(pp);
+	strs = stack + PGSIZE;
+	offs = (uintptr_t *) stack;
+	for (argc = 0; argv; argc++) {
+		if ((r = copyin(&arg, &argv[argc], sizeof(arg))) < 0)
+			return r;
+		if (!arg)
+			break;
+		if ((char *) &offs[argc + 1] >= strs)
+			return -E_INVAL;
+		len = copyinstr(stack + sizeof(offs[0]) * (argc + 1), arg,
+				strs - (char *) &offs[argc + 1]);
+		if (len < 0)
+			return len;
+		strs -= len + 1;
+		memmove(strs, stack + sizeof(offs[0]) * (argc + 1), len + 1);
+		offs[argc] = strs - stack;
+	}
+
+	// Now move the offsets up under the strings as the argv array,
+	// turning them into user addresses, and push argc and argv.
+	uargv = (uintptr_t *) ROUNDDOWN((uintptr_t) strs, 4) - (argc + 1);
+	if ((char *) (uargv - 2) < stack)
+		return -E_INVAL;
+	memmove(uargv, offs, argc * sizeof(offs[0]));
+	memset(stack, 0, (char *) uargv - stack);
+	for (r = 0; r < argc; r++)
+		uargv[r] += USTACKTOP - PGSIZE;
+	uargv[argc] = 0;
+	uargv[-1] = USTACKTOP - PGSIZE + ((char *) uargv - stack);
+	uargv[-2] = argc;
+	e->env_tf.tf_esp = USTACKTOP - PGSIZE + ((char *) (uargv - 2) - stack);
+	return 0;
+}
+
+//
+// Grow env e's stack down to the page holding 'va', if 'va' is within
+// e's stack limit and nothing is mapped there yet.
+// Returns 0 if a page was mapped, -E_INVAL if 'va' is not a stack page
+// still to be grown into, -E_NO_MEM if out of memory.
+//
+int
+env_stack_grow(struct Env *e, uintptr_t va)
+{
+	struct PageInfo *pp;
+	int r;
+
+	if (va >= USTACKTOP || va < USTACKTOP - e->env_stack_limit)
+		return -E_INVAL;
+	va = ROUNDDOWN(va, PGSIZE);
+	if (page_lookup(e->env_pgdir, (void *) va, NULL))
+		return -E_INVAL;
+	if (!(pp = page_alloc(ALLOC_ZERO)))
+		return -E_NO_MEM;
+	if ((r = page_insert(e->env_pgdir, pp, (void *) va,
+			     PTE_P | PTE_U | PTE_W)) < 0)
+		page_free(pp);
+	return r;
+}
+
+//
+// Is 'va' in the guard page below env e's stack?
+//
+bool
+env_stack_guard(struct Env *e, uintptr_t va)
+{
+	uintptr_t guard = USTACKTOP - e->env_stack_limit - PGSIZE;
+
+	return va >= guard && va < guard + PGSIZE;
 }
 
 //
@@ -418,6 +669,11 @@ env_free(struct Env *e)
 	// Note the environment's demise.
 	cprintf("[%08x] free env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
 
+	// Leave any IPC queue, and fail the sends waiting on us.
+	ipc_env_free(e);
+	futex_env_free(e);
+	ep_env_free(e);
+
 	// Flush all mapped pages in the user portion of the address space
 	static_assert(UTOP % PTSIZE == 0);
 	for (pdeno = 0; pdeno < PDX(UTOP); pdeno++) {
@@ -430,6 +686,14 @@ env_free(struct Env *e)
 		pa = PTE_ADDR(e->env_pgdir[pdeno]);
 		pt = (pte_t*) KADDR(pa);
 
+		// a page table still shared with another env after fork
+		// keeps its mappings for that env
+		if ((e->env_pgdir[pdeno] & PTE_COW) && pa2page(pa)->pp_ref > 1) {
+			e->env_pgdir[pdeno] = 0;
+			page_decref(pa2page(pa));
+			continue;
+		}
+
 		// unmap all PTEs in this page table
 		for (pteno = 0; pteno <= PTX(~0); pteno++) {
 			if (pt[pteno] & PTE_P)
@@ -15,6 +15,10 @@ void	env_init_percpu(void);
 int	env_alloc(struct Env **e, envid_t parent_id);
 void	env_free(struct Env *e);
 void	env_create(uint8_t *binary, enum EnvType type);
+int	env_load_elf(struct Env *e, const uint8_t *binary, size_t size);
+int	env_init_stack(struct Env *e, const char **argv);
+int	env_stack_grow(struct Env *e, uintptr_t va);
+bool	env_stack_guard(struct Env *e, uintptr_t va);
 void	env_destroy(struct Env *e);	// Does not return if e == curenv
 
 int	envid2env(envid_t envid, struct Env **env_store, bool checkperm);
@@ -0,0 +1,218 @@
+// Futexes: blocking on a word of user memory.
+//
+// futex_wait() puts the current env to sleep if the 32-bit word at a
+// user address still holds the value the caller expects, and
+// futex_wake() wakes envs sleeping on the same word.  A word is known
+// by its physical address, so envs that map one page at different
+// addresses (PTE_SHARE pages, shared-memory segments) meet on the same
+// word.  A word in a copy-on-write page (after fork, or a merged or
+// zero page) is known by the page mapped now: once a write breaks the
+// copy-on-write, the waiter and the waker are on different pages and
+// the wakeup is lost.  Futexes must live in PTE_SHARE pages or
+// shared-memory segments.
+//
+// Sleepers are kept in FUTEX_NBUCKETS hash chains linked through
+// env_futex_next, oldest first, so wakeups on one word are FIFO.
+// The kernel lock orders the check in futex_wait against the wake, so
+// a store followed by futex_wake() cannot slip between them.  A sleeper
+// may give a timeout; futex_tick() wakes it with -E_TIMEOUT once the
+// deadline passes.  Deadlines are kept in time_now() terms, which the
+// TSC keeps moving while no timer ticks arrive, and are checked on
+// every CPU's timer tick, every system call and every sched_yield().
+// A timeout can still run late while every CPU stays in user mode.
+
+#include <inc/assert.h>
+#include <inc/error.h>
+
+#include <kern/env.h>
+#include <kern/pmap.h>
+#include <kern/sched.h>
+#include <kern/sysinfo.h>
+#include <kern/usercopy.h>
+#include <kern/futex.h>
+
+struct futex_bucket {
+	struct Env *fb_head;
+	struct Env *fb_tail;
+};
+
+static struct futex_bucket futex_buckets[FUTEX_NBUCKETS];
+
+// Sleepers with a deadline, and a time no later than the earliest of
+// them, so that futex_tick() has nothing to do most of the time.
+static uint32_t futex_ntimed;
+static nanoseconds_t futex_next_deadline;
+
+static struct futex_bucket *
+futex_bucket(physaddr_t pa)
+{
+	return &futex_buckets[(pa >> 2) % FUTEX_NBUCKETS];
+}
+
+// Find the physical address of the word at 'uaddr' in the current env.
+// Returns 0 if nothing is mapped there.
+static physaddr_t
+futex_key(const uint32_t *uaddr)
+{
+	struct PageInfo *pp;
+
+	if (!(pp = page_lookup(curenv->env_pgdir, (void *) uaddr, NULL)))
+		return 0;
+	return page2pa(pp) + PGOFF(uaddr);
+}
+
+// Take sleeping env 'e' off its chain and let it return 'r'.
+static void
+futex_unlink(struct Env *e, int r)
+{
+	struct futex_bucket *b = futex_bucket(e->env_futex_pa);
+	struct Env **pp, *prev = NULL;
+
+	for (pp = &b->fb_head; *pp; prev = *pp, pp = &(*pp)->env_futex_next)
+		if (*pp == e) {
+			*pp = e->env_futex_next;
+			if (b->fb_tail == e)
+				b->fb_tail = prev;
+			break;
+		}
+	if (e->env_futex_deadline)
+		futex_ntimed--;
+	e->env_futex_pa = 0;
+	e->env_futex_next = NULL;
+	e->env_futex_deadline = 0;
+	e->env_tf.tf_regs.reg_eax = r;
+	if (e->env_status == ENV_NOT_RUNNABLE)
+		e->env_status = ENV_RUNNABLE;
+}
+
+//
+// Sleep on the word at 'uaddr' if it still holds 'expected', until
+// futex_wake() wakes us or, if 'timeout' is not 0, until 'timeout'
+// nanoseconds have passed.  Does not return if the env sleeps: its
+// system call later returns 0 when woken, or -E_TIMEOUT.
+// Returns < 0 on error.  Errors are:
+//	-E_INVAL if uaddr is not 4-byte aligned or is above UTOP.
+//	-E_FAULT if uaddr can't be read.
+//	-E_AGAIN if the word does not hold 'expected'.
+//
+int
+futex_wait(const uint32_t *uaddr, uint32_t expected, nanoseconds_t timeout)
+{
+	struct Env *e = curenv;
+	struct futex_bucket *b;
+	uint32_t val;
+	int r;
+
+	if ((uintptr_t) uaddr % 4 || (uintptr_t) uaddr >= UTOP)
+		return -E_INVAL;
+	if ((r = copyin(&val, uaddr, sizeof(val))) < 0)
+		return r;
+	if (val != expected)
+		return -E_AGAIN;
+
+	assert(!e->env_futex_pa);
+	e->env_futex_pa = futex_key(uaddr);
+	assert(e->env_futex_pa);
+	e->env_futex_next = NULL;
+	e->env_futex_deadline = 0;
+	if (timeout) {
+		e->env_futex_deadline = time_now() + timeout;
+		if (!futex_ntimed++
+		    || e->env_futex_deadline < futex_next_deadline)
+			futex_next_deadline = e->env_futex_deadline;
+	}
+	b = futex_bucket(e->env_futex_pa);
+	if (b->fb_tail)
+		b->fb_tail->env_futex_next = e;
+	else
+		b->fb_head = e;
+	b->fb_tail = e;
+
+	e->env_status = ENV_NOT_RUNNABLE;
+	sched_yield();
+}
+
+//
+// Wake up to 'n' envs sleeping on the word at 'uaddr', oldest first.
+// Returns the number woken, which is 0 if nothing is mapped at uaddr,
+// or -E_INVAL if uaddr is not 4-byte aligned or is above UTOP.
+//
+int
+futex_wake(const uint32_t *uaddr, int n)
+{
+	struct Env *e, *next;
+	physaddr_t pa;
+	int woken = 0;
+
+	if ((uintptr_t) uaddr % 4 || (uintptr_t) uaddr >= UTOP)
+		return -E_INVAL;
+	if (!(pa = futex_key(uaddr)))
+		return 0;
+	for (e = futex_bucket(pa)->fb_head; e && woken < n; e = next) {
+		next = e->env_futex_next;
+		if (e->env_futex_pa == pa) {
+			futex_unlink(e, 0);
+			woken++;
+		}
+	}
+	return woken;
+}
+
+//
+// Wake the sleepers whose deadline has passed.  Cheap unless one has:
+// called on timer ticks, system calls and sched_yield().
+//
+void
+futex_tick(void)
+{
+	nanoseconds_t now, next_deadline = 0;
+	struct Env *e, *next;
+	int i;
+
+	if (!futex_ntimed || (now = time_now()) < futex_next_deadline)
+		return;
+	for (i = 0; i < FUTEX_NBUCKETS; i++)
+		for (e = futex_buckets[i].fb_head; e; e = next) {
+			next = e->env_futex_next;
+			if (!e->env_futex_deadline)
+				continue;
+			if (e->env_futex_deadline <= now)
+				futex_unlink(e, -E_TIMEOUT);
+			else if (!next_deadline
+				 || e->env_futex_deadline < next_deadline)
+				next_deadline = e->env_futex_deadline;
+		}
+	futex_next_deadline = next_deadline;
+}
+
+// Is anyone waiting for a deadline?  An idle machine must keep taking
+// timer ticks for them instead of dropping into the monitor.
+bool
+futex_timers_pending(void)
+{
+	return futex_ntimed > 0;
+}
+
+// Is anyone asleep on a word in the physical page at 'pa'?  Such a
+// page must stay where it is: same-page merging would move the word
+// to another page and the sleepers would never be found.
+bool
+futex_page_busy(physaddr_t pa)
+{
+	struct Env *e;
+	int i;
+
+	for (i = 0; i < FUTEX_NBUCKETS; i++)
+		for (e = futex_buckets[i].fb_head; e; e = e->env_futex_next)
+			if (PTE_ADDR(e->env_futex_pa) == pa)
+				return 1;
+	return 0;
+}
+
+// Take env 'e', which is being freed, off the chain it sleeps in.
+void
+futex_env_free(struct Env *e)
+{
+	if (e->env_futex_pa)
+		futex_unlink(e, -E_BAD_ENV);
+}
@@ -0,0 +1,23 @@
+#ifndef JOS_KERN_FUTEX_H
+#define JOS_KERN_FUTEX_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+#include <inc/time.h>
+
+struct Env;
+
+// Number of hash chains that futex waiters are kept in.
+#define FUTEX_NBUCKETS	64
+
+int	futex_wait(const uint32_t *uaddr, uint32_t expected,
+		   nanoseconds_t timeout);
+int	futex_wake(const uint32_t *uaddr, int n);
+void	futex_tick(void);
+bool	futex_timers_pending(void);
+bool	futex_page_busy(physaddr_t pa);
+void	futex_env_free(struct Env *e);
+
+#endif	// !JOS_KERN_FUTEX_H
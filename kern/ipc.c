@@ -0,0 +1,471 @@
+// Inter-environment communication.
+//
+// A receiver blocks in ipc_recv until a message arrives.  A sender
+// that finds its target receiving hands the message over at once.
+// Otherwise a blocking sender joins the target's queue, a FIFO of at
+// most IPC_QUEUE_MAX blocked senders linked through env_ipc_qnext, and
+// sleeps until the target's next ipc_recv takes its message.  A sender
+// that finds the queue full gets -E_AGAIN instead of spinning in the
+// kernel.  Queue depth and counters are in struct Env, which user
+// programs can read through envs[].
+//
+// ipc_call and ipc_reply_wait are the synchronous client/server pair.
+// A call to an env that is receiving switches this CPU straight to it
+// with env_run(), and the caller sleeps until the reply.  A reply to a
+// waiting caller, when no other call is queued, switches straight back.
+// Neither direction goes through sched_yield(), and the message travels
+// in the trap frame's registers rather than through envs[].
+//
+// A page-carrying message may carry a run of up to IPC_RANGE_MAX
+// contiguous pages (ipc_send with npages > 1).  The receiver names a
+// window of pages to map them into; the pages that fit are checked
+// once, mapped in one go and the receiver is woken once.  With
+// PAGE_MOVE in the perm the pages change hands: each is unmapped from
+// the sender as it is mapped in the receiver (page_move).
+//
+// A message is IPC_MSG_WORDS words (struct ipc_msg).  The register
+// system calls read it from ECX, EBX, EDI, ESI and EBP of the sender's
+// trap frame and write it to the same registers of the receiver's.
+
+#include <inc/assert.h>
+#include <inc/error.h>
+#include <inc/syscall.h>
+
+#include <kern/env.h>
+#include <kern/pmap.h>
+#include <kern/sched.h>
+#include <kern/ipc.h>
+
+//
+// Read the message in the registers 'regs', or write 'm' to them.
+//
+void
+ipc_msg_get(struct ipc_msg *m, const struct PushRegs *regs)
+{
+	m->m_w[0] = regs->reg_ecx;
+	m->m_w[1] = regs->reg_ebx;
+	m->m_w[2] = regs->reg_edi;
+	m->m_w[3] = regs->reg_esi;
+	m->m_w[4] = regs->reg_ebp;
+}
+
+void
+ipc_msg_put(struct PushRegs *regs, const struct ipc_msg *m)
+{
+	regs->reg_ecx = m->m_w[0];
+	regs->reg_ebx = m->m_w[1];
+	regs->reg_edi = m->m_w[2];
+	regs->reg_esi = m->m_w[3];
+	regs->reg_ebp = m->m_w[4];
+}
+
+// Is [va, va + npages pages) a page-aligned range below UTOP?
+static bool
+ipc_range_ok(void *va, size_t npages)
+{
+	return !PGOFF(va) && npages >= 1 && npages <= IPC_RANGE_MAX
+		&& (uintptr_t) va + npages * PGSIZE <= UTOP;
+}
+
+// Check that 'src' may send the 'npages' pages at 'srcva' with 'perm'.
+static int
+ipc_check(struct Env *src, void *srcva, size_t npages, unsigned perm)
+{
+	pte_t *pte;
+	size_t i;
+
+	if ((uintptr_t) srcva >= UTOP)
+		return 0;
+	if (!ipc_range_ok(srcva, npages))
+		return -E_INVAL;
+	if ((perm & (PTE_U | PTE_P)) != (PTE_U | PTE_P)
+	    || (perm & ~(PTE_SYSCALL | PAGE_MOVE)))
+		return -E_INVAL;
+	for (i = 0; i < npages; i++) {
+		if (!page_lookup(src->env_pgdir, srcva + i * PGSIZE, &pte))
+			return -E_INVAL;
+		if ((perm & PTE_W) && !(*pte & (PTE_W | PTE_COW)))
+			return -E_INVAL;
+	}
+	return 0;
+}
+
+// Give 'e' a private writable copy of the page at 'va' if it is
+// copy-on-write, so that it can be shared writable.
+static int
+ipc_make_writable(struct Env *e, void *va)
+{
+	pte_t *pte;
+	int r;
+
+	if ((r = pgdir_unshare(e->env_pgdir, va)) < 0)
+		return r;
+	if (page_lookup(e->env_pgdir, va, &pte) && (*pte & PTE_COW))
+		return page_cow_break(e->env_pgdir, va);
+	return 0;
+}
+
+// Map the page at 'srcva' in 'src' at 'dstva' in 'dst', or move it
+// there if 'perm' has PAGE_MOVE.  ipc_prepare has made sure this can't
+// fail.
+static int
+ipc_map(struct Env *src, void *srcva, struct Env *dst, void *dstva,
+	unsigned perm)
+{
+	struct PageInfo *pp;
+
+	if (perm & PAGE_MOVE)
+		return page_move(src->env_pgdir, srcva, dst->env_pgdir, dstva,
+				 perm & ~PAGE_MOVE);
+	if (!(pp = page_lookup(src->env_pgdir, srcva, NULL)))
+		return -E_INVAL;
+	return page_insert(dst->env_pgdir, pp, dstva, perm);
+}
+
+// Pages mapped into the receiver cannot simply be taken out again if a
+// later one fails: they may have replaced mappings it had.  So before
+// mapping or moving any, check that all 'n' pages are still at 'srcva'
+// and may still be sent with 'perm', break copy-on-write on them if
+// they are to be shared writable, make sure each can take one more
+// reference, and give both envs the page tables they need: then
+// ipc_map cannot fail.
+//
+// ipc_check saw a queued send's pages when it was queued; since then
+// the sender's parent may have mapped something else there, such as a
+// read-only text page shared by every instance of a binary.
+static int
+ipc_prepare(struct Env *src, void *srcva, struct Env *dst, void *dstva,
+	    size_t n, unsigned perm)
+{
+	struct PageInfo *pp;
+	pte_t *pte;
+	void *va;
+	size_t i;
+	int r;
+
+	for (i = 0; i < n; i++) {
+		va = srcva + i * PGSIZE;
+		if ((r = pgdir_unshare(src->env_pgdir, va)) < 0)
+			return r;
+		if (!page_lookup(src->env_pgdir, va, &pte))
+			return -E_INVAL;
+		if ((perm & PTE_W) && !(*pte & (PTE_W | PTE_COW)))
+			return -E_INVAL;
+		if (!(perm & PAGE_MOVE) && (perm & PTE_W)
+		    && (r = ipc_make_writable(src, va)) < 0)
+			return r;
+		if (!(pp = page_lookup(src->env_pgdir, va, NULL)))
+			return -E_INVAL;
+		// A page may appear in the range more than once.
+		if (!(perm & PAGE_MOVE) && pp->pp_ref > PAGE_MAXREF - n)
+			return -E_NO_MEM;
+		if (!pgdir_walk(dst->env_pgdir, dstva + i * PGSIZE, 1))
+			return -E_NO_MEM;
+	}
+	return 0;
+}
+
+// Deliver a message from 'src' to 'dst', which is receiving: map (or
+// move) as many of the 'npages' pages as fit in dst's window if both
+// sides want pages, and fill in dst's ipc fields.  Either every page
+// is delivered or, on error, none is and dst is unchanged.  The caller
+// decides how dst gets to run again.
+static int
+ipc_transfer(struct Env *src, struct Env *dst, const struct ipc_msg *msg,
+	     void *srcva, size_t npages, unsigned perm)
+{
+	size_t i, n;
+	int r;
+
+	if ((uintptr_t) srcva < UTOP && (uintptr_t) dst->env_ipc_dstva < UTOP) {
+		n = MIN(npages, dst->env_ipc_dstnpages);
+		if ((r = ipc_prepare(src, srcva, dst, dst->env_ipc_dstva,
+				     n, perm)) < 0)
+			return r;
+		for (i = 0; i < n; i++)
+			if ((r = ipc_map(src, srcva + i * PGSIZE, dst,
+					 dst->env_ipc_dstva + i * PGSIZE,
+					 perm)) < 0)
+				panic("ipc_transfer: prepared map failed: %e", r);
+		dst->env_ipc_perm = perm & ~PAGE_MOVE;
+		dst->env_ipc_npages = n;
+	} else {
+		dst->env_ipc_perm = 0;
+		dst->env_ipc_npages = 0;
+	}
+	dst->env_ipc_recving = 0;
+	dst->env_ipc_from = src->env_id;
+	dst->env_ipc_msg = *msg;
+	return 0;
+}
+
+// Let 'e' return 'r' from the system call it is blocked in.
+static void
+ipc_wake(struct Env *e, int r)
+{
+	e->env_tf.tf_regs.reg_eax = r;
+	e->env_status = ENV_RUNNABLE;
+}
+
+// What the receive 'dst' is blocked in returns once a message is in
+// its ipc fields: 0 from ipc_recv, or the sender's envid, with the
+// message in registers, from ipc_reply_wait.
+static int
+ipc_result(struct Env *dst)
+{
+	if (!dst->env_ipc_inregs)
+		return 0;
+	ipc_msg_put(&dst->env_tf.tf_regs, &dst->env_ipc_msg);
+	return dst->env_ipc_from;
+}
+
+// Put the current env at the end of dst's queue with its message,
+// and give up the CPU.
+static void
+ipc_enqueue(struct Env *dst, const struct ipc_msg *msg, void *srcva,
+	    size_t npages, unsigned perm, bool call)
+{
+	struct Env *src = curenv;
+
+	assert(!src->env_ipc_sendto);
+	src->env_ipc_sendto = dst->env_id;
+	src->env_ipc_send_msg = *msg;
+	src->env_ipc_send_srcva = srcva;
+	src->env_ipc_send_npages = npages;
+	src->env_ipc_send_perm = perm;
+	src->env_ipc_send_call = call;
+	src->env_ipc_qnext = NULL;
+	if (dst->env_ipc_qtail)
+		dst->env_ipc_qtail->env_ipc_qnext = src;
+	else
+		dst->env_ipc_qhead = src;
+	dst->env_ipc_qtail = src;
+	dst->env_ipc_qlen++;
+	dst->env_ipc_queued++;
+
+	src->env_status = ENV_NOT_RUNNABLE;
+	sched_yield();
+}
+
+//
+// Send 'msg', and the 'npages' pages at 'srcva' with 'perm' if
+// srcva < UTOP, from the current env to 'dst'.  If 'dst' is not
+// receiving, a blocking send waits in dst's queue: it does not return,
+// and the sender later returns 0 (or an error) from its system call.
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if srcva, npages or perm is inappropriate (see
+//		sys_ipc_try_send), or dst is the current env.
+//	-E_IPC_NOT_RECV if dst is not receiving and block is false.
+//	-E_AGAIN if dst's queue is full.
+//	-E_NO_MEM if there's not enough memory to map srcva in dst.
+//
+int
+ipc_send(struct Env *dst, const struct ipc_msg *msg, void *srcva,
+	 size_t npages, unsigned perm, bool block)
+{
+	struct Env *src = curenv;
+	int r;
+
+	if (dst == src)
+		return -E_INVAL;
+	if ((r = ipc_check(src, srcva, npages, perm)) < 0)
+		return r;
+
+	if (dst->env_ipc_recving) {
+		if ((r = ipc_transfer(src, dst, msg, srcva, npages,
+				      perm)) < 0)
+			return r;
+		ipc_wake(dst, ipc_result(dst));
+		return 0;
+	}
+	if (!block)
+		return -E_IPC_NOT_RECV;
+	if (dst->env_ipc_qlen == IPC_QUEUE_MAX) {
+		dst->env_ipc_drops++;
+		return -E_AGAIN;
+	}
+	ipc_enqueue(dst, msg, srcva, npages, perm, 0);
+	return 0;
+}
+
+//
+// Send 'msg' from the current env to 'dst' and wait for dst to answer
+// with ipc_reply_wait.  If dst is receiving, run it on this CPU right
+// away.  Otherwise wait in dst's queue like a blocking send.
+// Does not return on success: the caller's system call later returns
+// 0 with the reply in its message registers.
+// Returns < 0 on error.  Errors are:
+//	-E_INVAL if dst is the current env.
+//	-E_AGAIN if dst's queue is full.
+//
+int
+ipc_call(struct Env *dst, const struct ipc_msg *msg)
+{
+	struct Env *src = curenv;
+
+	if (dst == src)
+		return -E_INVAL;
+
+	if (dst->env_ipc_recving) {
+		// Without a page the transfer cannot fail.
+		ipc_transfer(src, dst, msg, (void *) UTOP, 0, 0);
+		src->env_ipc_replyfrom = dst->env_id;
+		src->env_status = ENV_NOT_RUNNABLE;
+		dst->env_tf.tf_regs.reg_eax = ipc_result(dst);
+		env_run(dst);
+	}
+	if (dst->env_ipc_qlen == IPC_QUEUE_MAX) {
+		dst->env_ipc_drops++;
+		return -E_AGAIN;
+	}
+	src->env_ipc_replyfrom = dst->env_id;
+	ipc_enqueue(dst, msg, (void *) UTOP, 0, 0, 1);
+	return 0;
+}
+
+// Take the first sender off e's queue.
+static struct Env *
+ipc_dequeue(struct Env *e)
+{
+	struct Env *s = e->env_ipc_qhead;
+
+	if (s) {
+		if (!(e->env_ipc_qhead = s->env_ipc_qnext))
+			e->env_ipc_qtail = NULL;
+		e->env_ipc_qlen--;
+		s->env_ipc_qnext = NULL;
+		s->env_ipc_sendto = 0;
+	}
+	return s;
+}
+
+// Take the message of the first sender in e's queue whose transfer
+// succeeds.  A plain sender can run again; a caller keeps waiting for
+// e's reply.  Returns whether a message was taken.
+static bool
+ipc_take(struct Env *e)
+{
+	struct Env *s;
+	int r;
+
+	while ((s = ipc_dequeue(e))) {
+		e->env_ipc_recving = 1;
+		r = ipc_transfer(s, e, &s->env_ipc_send_msg,
+				 s->env_ipc_send_srcva, s->env_ipc_send_npages,
+				 s->env_ipc_send_perm);
+		if (s->env_ipc_send_call && r == 0)
+			return 1;
+		s->env_ipc_replyfrom = 0;
+		ipc_wake(s, r);
+		if (r == 0)
+			return 1;
+	}
+	return 0;
+}
+
+//
+// Receive a message into the current env, mapping up to 'npages'
+// pages sent into the window at 'dstva' if dstva < UTOP.  If a sender
+// is queued, its message is taken at once and the sender can run
+// again; otherwise block until someone sends, and never return.
+// Returns 0 on success, -E_INVAL if dstva < UTOP but the window is
+// not page-aligned or does not fit below UTOP.
+//
+int
+ipc_recv(void *dstva, size_t npages)
+{
+	struct Env *e = curenv;
+
+	if ((uintptr_t) dstva < UTOP && !ipc_range_ok(dstva, npages))
+		return -E_INVAL;
+	e->env_ipc_dstva = dstva;
+	e->env_ipc_dstnpages = npages;
+	e->env_ipc_inregs = 0;
+
+	if (ipc_take(e))
+		return 0;
+
+	e->env_ipc_recving = 1;
+	e->env_status = ENV_NOT_RUNNABLE;
+	sched_yield();
+}
+
+//
+// Answer the ipc_call of env 'to' with 'reply', unless 'to' is 0, and
+// receive the next message into registers.  If a message is queued,
+// return its sender at once; otherwise block and, if we just replied,
+// run the caller on this CPU right away.  Either way the system call
+// returns the sender's envid with the message in registers.
+// Returns < 0 on error.  Errors are:
+//	-E_BAD_ENV if 'to' does not exist.
+//	-E_IPC_NOT_RECV if 'to' is not waiting for our reply.
+//
+int
+ipc_reply_wait(envid_t to, const struct ipc_msg *reply)
+{
+	struct Env *e = curenv, *c = NULL;
+	int r;
+
+	if (to) {
+		if ((r = envid2env(to, &c, 0)) < 0)
+			return r;
+		if (c->env_ipc_replyfrom != e->env_id || c->env_ipc_sendto
+		    || c->env_status != ENV_NOT_RUNNABLE)
+			return -E_IPC_NOT_RECV;
+		c->env_ipc_replyfrom = 0;
+		ipc_msg_put(&c->env_tf.tf_regs, reply);
+		ipc_wake(c, 0);
+	}
+
+	e->env_ipc_dstva = (void *) UTOP;
+	e->env_ipc_dstnpages = 0;
+	e->env_ipc_inregs = 1;
+	if (ipc_take(e))
+		return ipc_result(e);
+
+	e->env_ipc_recving = 1;
+	e->env_status = ENV_NOT_RUNNABLE;
+	if (c)
+		env_run(c);
+	sched_yield();
+}
+
+//
+// Take env 'e', which is being freed, out of the queue it is waiting
+// in, and fail the sends of everyone waiting in its own queue or for
+// its reply.
+//
+void
+ipc_env_free(struct Env *e)
+{
+	struct Env *dst, **pp, *prev = NULL;
+	int i;
+
+	if (e->env_ipc_sendto) {
+		dst = &envs[ENVX(e->env_ipc_sendto)];
+		for (pp = &dst->env_ipc_qhead; *pp;
+		     prev = *pp, pp = &(*pp)->env_ipc_qnext)
+			if (*pp == e) {
+				*pp = e->env_ipc_qnext;
+				if (dst->env_ipc_qtail == e)
+					dst->env_ipc_qtail = prev;
+				dst->env_ipc_qlen--;
+				break;
+			}
+		e->env_ipc_sendto = 0;
+		e->env_ipc_qnext = NULL;
+	}
+
+	e->env_ipc_replyfrom = 0;
+
+	while ((dst = ipc_dequeue(e))) {
+		dst->env_ipc_replyfrom = 0;
+		ipc_wake(dst, -E_BAD_ENV);
+	}
+	for (i = 0; i < NENV; i++)
+		if (envs[i].env_ipc_replyfrom == e->env_id
+		    && envs[i].env_status == ENV_NOT_RUNNABLE) {
+			envs[i].env_ipc_replyfrom = 0;
+			ipc_wake(&envs[i], -E_BAD_ENV);
+		}
+}
@@ -0,0 +1,25 @@
+#ifndef JOS_KERN_IPC_H
+#define JOS_KERN_IPC_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+
+struct Env;
+struct ipc_msg;
+struct PushRegs;
+
+// Most senders that can wait in one env's IPC queue.
+#define IPC_QUEUE_MAX	8
+
+void	ipc_msg_get(struct ipc_msg *m, const struct PushRegs *regs);
+void	ipc_msg_put(struct PushRegs *regs, const struct ipc_msg *m);
+int	ipc_send(struct Env *dst, const struct ipc_msg *msg, void *srcva,
+		 size_t npages, unsigned perm, bool block);
+int	ipc_recv(void *dstva, size_t npages);
+int	ipc_call(struct Env *dst, const struct ipc_msg *msg);
+int	ipc_reply_wait(envid_t to, const struct ipc_msg *reply);
+void	ipc_env_free(struct Env *e);
+
+#endif	// !JOS_KERN_IPC_H
@@ -0,0 +1,260 @@
+// Same-page merging for user memory.
+//
+// Idle CPUs call ksm_scan() from sched_halt().  Each call looks at a
+// handful of user pages, walking every env's address space in turn,
+// and hashes the contents of each private writable page.  Pages are
+// remembered in a small direct-mapped table indexed by that hash.  When
+// two pages turn out to hold the same bytes, both mappings are pointed
+// at one physical page, marked PTE_COW and PP_KSM, and the duplicate is
+// freed.  A later write to a merged page is resolved by ksm_fault(),
+// which hands the writer a private copy again.
+//
+// Page tables still shared after fork (PTE_COW in the page directory)
+// are never touched: a page in one has pp_ref 1 but is mapped by every
+// sharer, and a sharer running on another CPU would keep using the
+// old page through its TLB.  Nor is a page merged away while a futex
+// sleeper is keyed on its physical address.
+//
+// pmap reports every reference taken or dropped on a merged page
+// through ksm_page_ref(), so the shared and saved counts are kept
+// current and reading them never walks pages[].
+
+#include <inc/assert.h>
+#include <inc/error.h>
+#include <inc/string.h>
+
+#include <kern/env.h>
+#include <kern/pmap.h>
+#include <kern/futex.h>
+#include <kern/ksm.h>
+#include <kern/sysinfo.h>
+
+#define KSM_NSLOTS	1024
+
+struct ksm_slot {
+	uint32_t ks_hash;
+	struct PageInfo *ks_page;	// merged page, while PP_KSM is set
+	envid_t ks_envid;		// otherwise, a candidate mapping
+	uintptr_t ks_va;
+};
+
+static struct ksm_slot ksm_table[KSM_NSLOTS];
+
+// Scan cursor: the next page to look at is ksm_va in envs[ksm_envx].
+static int ksm_envx;
+static uintptr_t ksm_va;
+
+static uint32_t ksm_merges, ksm_unmerges;
+static uint32_t ksm_shared, ksm_saved;
+
+static uint32_t
+ksm_hash(const uint32_t *p)
+{
+	uint32_t h = 2166136261U;
+	int i;
+
+	for (i = 0; i < PGSIZE / 4; i++)
+		h = (h ^ p[i]) * 16777619U;
+	return h;
+}
+
+// Only envs that are not running anywhere may have their page tables
+// rewritten: a running env could still hold writable TLB entries.
+static bool
+ksm_scannable(struct Env *e)
+{
+	return (e->env_status == ENV_RUNNABLE
+		|| e->env_status == ENV_NOT_RUNNABLE) && e->env_pgdir;
+}
+
+// Is the page behind 'pte' private memory we are allowed to merge?
+static bool
+ksm_mergeable(pte_t pte, struct PageInfo *pp)
+{
+	return (pte & (PTE_P | PTE_U | PTE_SHARE)) == (PTE_P | PTE_U)
+		&& (pte & (PTE_W | PTE_COW))
+		&& !(pp->pp_flags & PP_KSM)
+		&& pp->pp_ref == 1;
+}
+
+// Point the mapping behind 'pte' at the merged page 'kp'.
+static void
+ksm_merge(pte_t *pte, struct PageInfo *kp)
+{
+	struct PageInfo *pp = pa2page(PTE_ADDR(*pte));
+
+	kp->pp_ref++;
+	ksm_saved++;
+	*pte = page2pa(kp) | (*pte & PTE_SYSCALL & ~PTE_W) | PTE_COW;
+	page_decref(pp);
+	ksm_merges++;
+}
+
+// Look up the candidate recorded in 'slot'.  Returns its page and PTE
+// if the mapping still exists and is still mergeable.
+static struct PageInfo *
+ksm_candidate(struct ksm_slot *slot, pte_t **pte_store)
+{
+	struct Env *e;
+	struct PageInfo *pp;
+
+	if (!slot->ks_envid || envid2env(slot->ks_envid, &e, 0) < 0
+	    || !ksm_scannable(e) || (e->env_pgdir[PDX(slot->ks_va)] & PTE_COW))
+		return NULL;
+	pp = page_lookup(e->env_pgdir, (void *) slot->ks_va, pte_store);
+	if (!pp || !ksm_mergeable(**pte_store, pp))
+		return NULL;
+	return pp;
+}
+
+static void
+ksm_scan_page(struct Env *e, uintptr_t va, pte_t *pte)
+{
+	struct PageInfo *pp, *kp;
+	struct ksm_slot *slot;
+	pte_t *kpte;
+	uint32_t hash;
+
+	pp = pa2page(PTE_ADDR(*pte));
+	if (!ksm_mergeable(*pte, pp))
+		return;
+
+	// A page written since the last pass is likely to change again.
+	// Clear the dirty bit and wait for it to stay clean for a pass.
+	if (*pte & PTE_D) {
+		*pte &= ~PTE_D;
+		return;
+	}
+
+	hash = ksm_hash(page2kva(pp));
+	slot = &ksm_table[hash % KSM_NSLOTS];
+
+	if (slot->ks_hash == hash && slot->ks_page
+	    && (slot->ks_page->pp_flags & PP_KSM)) {
+		kp = slot->ks_page;
+		if (memcmp(page2kva(kp), page2kva(pp), PGSIZE) == 0
+		    && !futex_page_busy(page2pa(pp)))
+			ksm_merge(pte, kp);
+		return;
+	}
+
+	if (slot->ks_hash == hash && (kp = ksm_candidate(slot, &kpte))
+	    && kp != pp && memcmp(page2kva(kp), page2kva(pp), PGSIZE) == 0
+	    && !futex_page_busy(page2pa(pp))) {
+		// Write-protect the candidate and make it the shared copy.
+		*kpte = (*kpte & ~PTE_W) | PTE_COW;
+		kp->pp_flags |= PP_KSM;
+		ksm_shared++;
+		slot->ks_page = kp;
+		slot->ks_envid = 0;
+		ksm_merge(pte, kp);
+		return;
+	}
+
+	// Remember this page, unless the slot holds a live merged page.
+	if (slot->ks_page && (slot->ks_page->pp_flags & PP_KSM))
+		return;
+	slot->ks_hash = hash;
+	slot->ks_page = NULL;
+	slot->ks_envid = e->env_id;
+	slot->ks_va = va;
+}
+
+//
+// Examine up to 'npages' mapped user pages, merging duplicates.
+// Called with the kernel lock held and no env loaded on this CPU.
+// Hashing pages holds up every other CPU waiting for the lock, so
+// however many CPUs go idle, only one batch runs per KSM_SCAN_PERIOD.
+//
+void
+ksm_scan(int npages)
+{
+	static nanoseconds_t next_scan;
+	nanoseconds_t now = time_now();
+	struct Env *e;
+	pte_t *pte;
+	int nswitch = 0;
+
+	if (now < next_scan)
+		return;
+	next_scan = now + KSM_SCAN_PERIOD;
+
+	while (npages > 0 && nswitch <= NENV) {
+		e = &envs[ksm_envx];
+		if (ksm_va >= UTOP || !ksm_scannable(e)) {
+			ksm_envx = (ksm_envx + 1) % NENV;
+			ksm_va = 0;
+			nswitch++;
+			continue;
+		}
+		// Skip missing page tables, and tables still shared after
+		// fork: their entries belong to more than one env.
+		if ((e->env_pgdir[PDX(ksm_va)] & (PTE_P | PTE_COW)) != PTE_P) {
+			ksm_va = ROUNDDOWN(ksm_va, PTSIZE) + PTSIZE;
+			continue;
+		}
+		pte = pgdir_walk(e->env_pgdir, (void *) ksm_va, 0);
+		if (*pte & PTE_P) {
+			ksm_scan_page(e, ksm_va, pte);
+			npages--;
+		}
+		ksm_va += PGSIZE;
+	}
+}
+
+//
+// Handle a write to 'va' in env 'e' if it hit a merged page.
+// Returns 0 if the fault was resolved, < 0 if it wasn't ours
+// (-E_INVAL) or there was no memory for the copy (-E_NO_MEM).
+//
+int
+ksm_fault(struct Env *e, uintptr_t va)
+{
+	struct PageInfo *pp;
+	pte_t *pte;
+	int r;
+
+	if (va >= UTOP)
+		return -E_INVAL;
+	pp = page_lookup(e->env_pgdir, (void *) ROUNDDOWN(va, PGSIZE), &pte);
+	if (!pp || !(*pte & PTE_COW) || !(pp->pp_flags & PP_KSM))
+		return -E_INVAL;
+	if ((r = page_cow_break(e->env_pgdir, (void *) va)) < 0)
+		return r;
+	ksm_unmerges++;
+	return 0;
+}
+
+//
+// Account for a reference to the merged page 'pp' having been taken
+// (delta 1) or dropped (delta -1).  pp_ref already holds the new count.
+//
+void
+ksm_page_ref(struct PageInfo *pp, int delta)
+{
+	if (pp->pp_ref == 0)
+		ksm_shared--;
+	else
+		ksm_saved += delta;
+}
+
+//
+// Turn the merged page 'pp', now mapped just once, back into a
+// private page.
+//
+void
+ksm_page_unmerge(struct PageInfo *pp)
+{
+	assert(pp->pp_ref == 1);
+	pp->pp_flags &= ~PP_KSM;
+	ksm_shared--;
+}
+
+void
+ksm_get_stats(struct ksm_stats *stats)
+{
+	stats->merges = ksm_merges;
+	stats->unmerges = ksm_unmerges;
+	stats->shared = ksm_shared;
+	stats->saved = ksm_saved;
+}
@@ -0,0 +1,31 @@
+#ifndef JOS_KERN_KSM_H
+#define JOS_KERN_KSM_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+#include <inc/time.h>
+
+struct Env;
+struct PageInfo;
+
+// Number of user pages examined each time an idle CPU calls ksm_scan(),
+// and the least time between two such batches.
+#define KSM_SCAN_BATCH	64
+#define KSM_SCAN_PERIOD	(20 * NANOSECONDS_PER_MILLISECOND)
+
+struct ksm_stats {
+	uint32_t merges;	// mappings redirected to a shared page
+	uint32_t unmerges;	// merged mappings broken by a write
+	uint32_t shared;	// distinct merged pages still in use
+	uint32_t saved;		// physical pages saved by merging right now
+};
+
+void	ksm_scan(int npages);
+int	ksm_fault(struct Env *e, uintptr_t va);
+void	ksm_page_ref(struct PageInfo *pp, int delta);
+void	ksm_page_unmerge(struct PageInfo *pp);
+void	ksm_get_stats(struct ksm_stats *stats);
+
+#endif	// !JOS_KERN_KSM_H
@@ -11,6 +11,7 @@
 #include <kern/monitor.h>
 #include <kern/kdebug.h>
 #include <kern/trap.h>
+#include <kern/ksm.h>
 
 #define CMDBUF_SIZE	80	// enough for one VGA text line
 
@@ -26,6 +27,7 @@ static struct Command commands[] = {
 	{ "help", "Display this list of commands", mon_help },
 	{ "kerninfo", "Display information about the kernel", mon_kerninfo },
 	{ "backtrace", "Display backtrace of the kernel", mon_backtrace },
+	{ "ksm", "Display same-page merging statistics", mon_ksm },
 };
 
 /***** Implementations of basic kernel monitor commands *****/
@@ -79,6 +81,19 @@ mon_backtrace(int argc, char **argv, struct Trapframe *tf)
 	return 0;
 }
 
+int
+mon_ksm(int argc, char **argv, struct Trapframe *tf)
+{
+	struct ksm_stats stats;
+
+	ksm_get_stats(&stats);
+	cprintf("merges    %u\n", stats.merges);
+	cprintf("unmerges  %u\n", stats.unmerges);
+	cprintf("shared    %u pages\n", stats.shared);
+	cprintf("saved     %u pages\n", stats.saved);
+	return 0;
+}
+
 
 
 /***** Kernel monitor command interpreter *****/
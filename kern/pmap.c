@@ -10,6 +10,9 @@
 #include <kern/pmap.h>
 #include <kern/env.h>
 #include <kern/cpu.h>
+#include <kern/ksm.h>
+#include <kern/elfcache.h>
+#include <kern/sysinfo.h>
 
 // This is set by detect_memory()
 size_t npages;			// Amount of physical memory (in pages)
@@ -19,6 +22,7 @@ size_t nfreepages;
 pde_t *kern_pgdir;		// Kernel's initial page directory
 struct PageInfo *pages;		// Physical page state array
 static struct PageInfo *page_free_list;	// Free list of physical pages
+struct PageInfo *zero_page;		// Shared all-zero page
 
 
 // --------------------------------------------------------------
@@ -184,6 +188,11 @@ mem_init(void)
 	np = ROUNDUP(NENV*sizeof(struct Env), PGSIZE);
   boot_map_region(kern_pgdir, UENVS, np/PGSIZE, PADDR(envs), PTE_P | PTE_U);
 
+	//////////////////////////////////////////////////////////////////////
+	// Map the vdso page read-only by the user at UVDSO, just above the
+	// envs array (kern/sysinfo.c).
+	vdso_init();
+
 	//////////////////////////////////////////////////////////////////////
 	// Use the physical memory that 'bootstack' refers to as the kernel
 	// stack.  The kernel stack grows down from virtual address KSTACKTOP.
@@ -238,6 +247,12 @@ mem_init(void)
 
 	// Some more checks, only possible after kern_pgdir is installed.
 	check_page_installed_pgdir();
+
+	// The zero page backs demand-zero user memory.  Its reference
+	// from here keeps it from ever being freed.
+	if (!(zero_page = page_alloc(ALLOC_ZERO)))
+		panic("mem_init: no memory for the zero page");
+	zero_page->pp_ref = 1;
 }
 
 // Modify mappings in kern_pgdir to support SMP
@@ -368,6 +383,7 @@ page_alloc(int alloc_flags)
   page_free_list = ret->pp_link;
   ret->pp_link = NULL;
   ret->pp_ref = 0;
+  ret->pp_flags = 0;
 
   if (alloc_flags & ALLOC_ZERO)
 	  memset(page2kva(ret), 0, PGSIZE);
@@ -388,6 +404,7 @@ page_free(struct PageInfo *pp)
 	// pp->pp_link is not NULL.
 	if (pp == NULL || pp->pp_ref != 0 || pp->pp_link != NULL)
     panic("Invalid pp passed to page_free");
+  pp->pp_flags = 0;
   pp->pp_link = page_free_list;
   page_free_list = pp;
   nfreepages++;
@@ -400,7 +417,10 @@ page_free(struct PageInfo *pp)
 void
 page_decref(struct PageInfo* pp)
 {
-	if (--pp->pp_ref == 0)
+	pp->pp_ref--;
+	if (pp->pp_flags & PP_KSM)
+		ksm_page_ref(pp, -1);
+	if (pp->pp_ref == 0)
 		page_free(pp);
 }
 
@@ -425,12 +445,16 @@ page_decref(struct PageInfo* pp)
 //
 // Hint 3: look at inc/mmu.h for useful macros that mainipulate page
 // table and page directory entries.
+// A page table shared copy-on-write with other address spaces (see
+// pgdir_fork) is unshared first when create is true, since the caller
+// is about to change an entry in it.
 //
 pte_t *
 pgdir_walk(pde_t *pgdir, const void *va, int create)
 {
 	pde_t *table_addr = (pde_t *) &pgdir[PDX(va)];
   pte_t *pgtab;
+  if (create && pgdir_unshare(pgdir, va) < 0) return NULL;
   if(*table_addr & PTE_P) {
     pgtab = KADDR(PTE_ADDR(*table_addr));
   }
@@ -488,7 +512,8 @@ boot_map_region(pde_t *pgdir, uintptr_t va, size_t size, physaddr_t pa, int perm
 //
 // RETURNS:
 //   0 on success
-//   -E_NO_MEM, if page table couldn't be allocated
+//   -E_NO_MEM, if page table couldn't be allocated, or if pp already
+//     has PAGE_MAXREF references
 //
 // Hint: The TA solution is implemented using pgdir_walk, page_remove,
 // and page2pa.
@@ -501,7 +526,17 @@ page_insert(pde_t *pgdir, struct PageInfo *pp, void *va, int perm)
   if (!pte)
     return -1*E_NO_MEM;
 
+  // Don't let the 16-bit pp_ref wrap: any env could otherwise map the
+  // zero page, or a page of its own, until the page is freed while
+  // still mapped.  Mapping it again where it is already mapped takes
+  // no new reference.
+  if (pp->pp_ref >= PAGE_MAXREF
+      && (!(*pte & PTE_P) || PTE_ADDR(*pte) != page2pa(pp)))
+    return -E_NO_MEM;
+
   pp->pp_ref++;
+  if (pp->pp_flags & PP_KSM)
+    ksm_page_ref(pp, 1);
   if (*pte & PTE_P) {
     page_remove(pgdir, va);
   }
@@ -556,6 +591,9 @@ page_remove(pde_t *pgdir, void *va)
 	// Fill this function in
   pte_t *pte;
   struct PageInfo *pi = page_lookup(pgdir, va, &pte);
+  if (pi && pgdir_unshare(pgdir, va) < 0)
+    panic("page_remove: out of memory unsharing page table");
+  pi = page_lookup(pgdir, va, &pte);
   if (pi) {
     page_decref(pi);
     *pte = 0;
@@ -563,6 +601,283 @@ page_remove(pde_t *pgdir, void *va)
   }
 }
 
+//
+// Resolve a write to the copy-on-write page mapped at 'va' in 'pgdir'.
+// If nobody else maps the page any more it is simply made writable
+// again; otherwise 'pgdir' gets its own writable copy of it.
+//
+// RETURNS:
+//   0 on success
+//   -E_INVAL, if 'va' isn't mapped copy-on-write
+//   -E_NO_MEM, if the copy couldn't be allocated
+//
+int
+page_cow_break(pde_t *pgdir, void *va)
+{
+	struct PageInfo *pp, *np;
+	pte_t *pte;
+	int perm, r;
+
+	va = ROUNDDOWN(va, PGSIZE);
+	if (!(pp = page_lookup(pgdir, va, &pte)) || !(*pte & PTE_COW))
+		return -E_INVAL;
+	if ((r = pgdir_unshare(pgdir, va)) < 0)
+		return r;
+	pp = page_lookup(pgdir, va, &pte);
+	perm = (*pte & PTE_SYSCALL & ~PTE_COW) | PTE_W;
+
+	if (pp->pp_ref == 1) {
+		if (pp->pp_flags & PP_KSM)
+			ksm_page_unmerge(pp);
+		*pte = page2pa(pp) | perm;
+		tlb_invalidate(pgdir, va);
+		return 0;
+	}
+
+	if (pp == zero_page)
+		np = page_alloc(ALLOC_ZERO);
+	else if ((np = page_alloc(0)))
+		memcpy(page2kva(np), page2kva(pp), PGSIZE);
+	if (!np)
+		return -E_NO_MEM;
+	if ((r = page_insert(pgdir, np, va, perm)) < 0) {
+		page_free(np);
+		return r;
+	}
+	return 0;
+}
+
+//
+// Move the mapping of the page at 'srcva' in 'srcpgdir' to 'dstva' in
+// 'dstpgdir' with permissions 'perm', leaving 'srcva' unmapped.  The
+// page changes hands without its pp_ref changing.  A copy-on-write
+// page stays copy-on-write when 'perm' asks for write access.
+// Anything already mapped at 'dstva' is removed first.
+//
+// RETURNS:
+//   0 on success
+//   -E_INVAL, if nothing is mapped at 'srcva'
+//   -E_NO_MEM, if a page table couldn't be allocated
+//
+int
+page_move(pde_t *srcpgdir, void *srcva, pde_t *dstpgdir, void *dstva,
+	  int perm)
+{
+	struct PageInfo *pp;
+	pte_t *spte, *dpte;
+	int r;
+
+	if ((r = pgdir_unshare(srcpgdir, srcva)) < 0)
+		return r;
+	if (!(dpte = pgdir_walk(dstpgdir, dstva, 1)))
+		return -E_NO_MEM;
+	if (!(pp = page_lookup(srcpgdir, srcva, &spte)))
+		return -E_INVAL;
+
+	if ((*spte & PTE_COW) && (perm & PTE_W))
+		perm = (perm & ~PTE_W) | PTE_COW;
+	if (dpte != spte) {
+		if (*dpte & PTE_P)
+			page_remove(dstpgdir, dstva);
+		*spte = 0;
+		tlb_invalidate(srcpgdir, srcva);
+	}
+	*dpte = page2pa(pp) | perm | PTE_P;
+	tlb_invalidate(dstpgdir, dstva);
+	return 0;
+}
+
+//
+// Map the shared zero page at 'va' in place of a freshly zeroed page.
+// A writable mapping is entered as PTE_COW, so the real page is only
+// allocated (by page_cow_break) when the env first writes to it.
+// Falls back to a real page once the zero page's pp_ref is nearly full.
+//
+// RETURNS:
+//   0 on success
+//   -E_NO_MEM, if a page or page table couldn't be allocated
+//
+int
+page_map_zero(pde_t *pgdir, void *va, int perm)
+{
+	struct PageInfo *pp;
+	int r;
+
+	if (zero_page->pp_ref < ZERO_PAGE_MAXREF) {
+		if (perm & PTE_W)
+			perm = (perm & ~PTE_W) | PTE_COW;
+		return page_insert(pgdir, zero_page, va, perm);
+	}
+
+	if (!(pp = page_alloc(ALLOC_ZERO)))
+		return -E_NO_MEM;
+	if ((r = page_insert(pgdir, pp, va, perm)) < 0)
+		page_free(pp);
+	return r;
+}
+
+//
+// Fill the empty page table 'dst' with the entries of 'src', as fork
+// would: writable and copy-on-write pages not marked PTE_SHARE become
+// copy-on-write in both tables, and every mapped page gains a
+// reference.  Entry 'skip' is left out (pass -1 to copy them all).
+// Returns 0 on success, -E_NO_MEM if a page ran out; 'dst' is left
+// empty on failure.
+//
+static int
+pgtable_copy(pte_t *dst, pte_t *src, int skip)
+{
+	struct PageInfo *pp;
+	pte_t pte;
+	int i;
+
+	for (i = 0; i < NPTENTRIES; i++) {
+		pte = src[i];
+		if (!(pte & PTE_P) || i == skip)
+			continue;
+		if (!(pte & PTE_SHARE) && (pte & (PTE_W | PTE_COW)))
+			src[i] = pte = (pte & ~PTE_W) | PTE_COW;
+		pp = pa2page(PTE_ADDR(pte));
+		if (pp == zero_page && pp->pp_ref >= ZERO_PAGE_MAXREF) {
+			// The zero page is full; use a zeroed page instead.
+			if (!(pp = page_alloc(ALLOC_ZERO)))
+				goto nomem;
+			pte = page2pa(pp) | (pte & PTE_SYSCALL & ~PTE_COW)
+				| (pte & PTE_COW ? PTE_W : 0);
+		}
+		pp->pp_ref++;
+		if (pp->pp_flags & PP_KSM)
+			ksm_page_ref(pp, 1);
+		dst[i] = PTE_ADDR(pte) | (pte & PTE_SYSCALL);
+	}
+	return 0;
+
+nomem:
+	while (--i >= 0)
+		if (dst[i] & PTE_P) {
+			page_decref(pa2page(PTE_ADDR(dst[i])));
+			dst[i] = 0;
+		}
+	return -E_NO_MEM;
+}
+
+//
+// Copy the user part of address space 'src' into the empty address
+// space 'dst' for fork.
+//
+// Page tables are not copied.  Both page directories point at the
+// same table, with the PDE made read-only and marked PTE_COW, and the
+// table's pp_ref counts the directories sharing it.  The first change
+// to a mapping in that 4MB region, or the first write to a page in it,
+// gives the writer its own copy of the table (pgdir_unshare); only
+// then do the pages in it become copy-on-write.
+//
+// The table holding the user exception stack is copied right away,
+// since both sides are about to use their stacks, and the exception
+// stack itself is left out: the child must get a fresh one.
+//
+// The caller must flush the TLB for 'src' afterwards if it is loaded.
+// Returns 0 on success, -E_NO_MEM if a page table could not be
+// allocated.  On failure 'dst' is partly filled and should be freed.
+//
+int
+pgdir_fork(pde_t *dst, pde_t *src)
+{
+	struct PageInfo *tp;
+	uint32_t pdx;
+
+	for (pdx = 0; pdx < PDX(UTOP); pdx++) {
+		if (!(src[pdx] & PTE_P))
+			continue;
+		if (pdx == PDX(UXSTACKTOP - PGSIZE)) {
+			if (!(tp = page_alloc(ALLOC_ZERO)))
+				return -E_NO_MEM;
+			if (pgtable_copy(page2kva(tp), KADDR(PTE_ADDR(src[pdx])),
+					 PTX(UXSTACKTOP - PGSIZE)) < 0) {
+				page_free(tp);
+				return -E_NO_MEM;
+			}
+			tp->pp_ref = 1;
+			dst[pdx] = page2pa(tp) | PTE_P | PTE_W | PTE_U;
+			continue;
+		}
+		src[pdx] = (src[pdx] & ~PTE_W) | PTE_COW;
+		dst[pdx] = src[pdx];
+		pa2page(PTE_ADDR(src[pdx]))->pp_ref++;
+	}
+	return 0;
+}
+
+//
+// Make sure the page table covering 'va' in 'pgdir' belongs to 'pgdir'
+// alone, so that its entries may be changed.  A table shared by
+// pgdir_fork is copied, or simply made writable again if no other
+// page directory uses it any more.
+//
+// RETURNS:
+//   0 on success, including when the table is not shared
+//   -E_NO_MEM, if the copy couldn't be allocated
+//
+int
+pgdir_unshare(pde_t *pgdir, const void *va)
+{
+	pde_t *pde = &pgdir[PDX(va)];
+	struct PageInfo *tp, *np;
+
+	if ((*pde & (PTE_P | PTE_COW)) != (PTE_P | PTE_COW))
+		return 0;
+
+	tp = pa2page(PTE_ADDR(*pde));
+	if (tp->pp_ref == 1)
+		*pde = (*pde & ~PTE_COW) | PTE_W;
+	else {
+		if (!(np = page_alloc(ALLOC_ZERO)))
+			return -E_NO_MEM;
+		if (pgtable_copy(page2kva(np), page2kva(tp), -1) < 0) {
+			page_free(np);
+			return -E_NO_MEM;
+		}
+		np->pp_ref = 1;
+		tp->pp_ref--;
+		*pde = page2pa(np) | PTE_P | PTE_W | PTE_U;
+	}
+
+	// The whole 4MB region changed; flush it if it is loaded.
+	if (rcr3() == PADDR(pgdir))
+		lcr3(PADDR(pgdir));
+	return 0;
+}
+
+//
+// Find the first page mapped in 'pgdir' at or above '*va' and below
+// 'end' (at most UTOP).  Absent page tables are skipped 4MB at a time,
+// so the cost depends on the page tables in use, not on the size of
+// the range.  Returns the page's PTE and sets '*va' to its address, or
+// returns NULL if nothing is mapped there.
+//
+pte_t *
+pgdir_next_mapped(pde_t *pgdir, uintptr_t *va, uintptr_t end)
+{
+	uintptr_t a = ROUNDDOWN(*va, PGSIZE);
+	pte_t *pt;
+
+	while (a < end) {
+		if (!(pgdir[PDX(a)] & PTE_P)) {
+			a = ROUNDDOWN(a, PTSIZE) + PTSIZE;
+			continue;
+		}
+		pt = KADDR(PTE_ADDR(pgdir[PDX(a)]));
+		do {
+			if (pt[PTX(a)] & PTE_P) {
+				*va = a;
+				return &pt[PTX(a)];
+			}
+			a += PGSIZE;
+		} while (a < end && PTX(a) != 0);
+	}
+	return NULL;
+}
+
 //
 // Invalidate a TLB entry, but only if the page tables being
 // edited are the ones currently in use by the processor.
@@ -632,6 +947,9 @@ static uintptr_t user_mem_check_addr;
 // If there is an error, set the 'user_mem_check_addr' variable to the first
 // erroneous virtual address.
 //
+// A copy-on-write page counts as writable: if 'perm' asks for PTE_W, the
+// page is copied here so that the kernel can write to it directly.
+//
 // Returns 0 if the user program can access this range of addresses,
 // and -E_FAULT otherwise.
 //
@@ -646,8 +964,22 @@ user_mem_check(struct Env *env, const void *va, size_t len, int perm)
       user_mem_check_addr = (i == pg_start) ? (uint32_t) va : (uint32_t) i;
       return -E_FAULT;
     }
+    // A write needs the page table to itself (see pgdir_fork).
+    if ((perm & PTE_W) && i < UTOP
+        && pgdir_unshare(env->env_pgdir, (void*) i) < 0) {
+      user_mem_check_addr = (i == pg_start) ? (uint32_t) va : (uint32_t) i;
+      return -E_FAULT;
+    }
     pte_t *pte_store;
     struct PageInfo* pp = page_lookup(env->env_pgdir, (void*) i, &pte_store);
+    // Pages of the env's binary may not have been loaded yet, and
+    // the stack may not have grown this far.
+    if (!pp && (elfcache_fault(env, i) == 0 || env_stack_grow(env, i) == 0))
+      pp = page_lookup(env->env_pgdir, (void*) i, &pte_store);
+    if (pp && (perm & PTE_W) && (*pte_store & PTE_COW)
+        && (ksm_fault(env, i) == 0
+            || page_cow_break(env->env_pgdir, (void*) i) == 0))
+      pp = page_lookup(env->env_pgdir, (void*) i, &pte_store);
     if (!pp || ((*pte_store & (perm)) ^ (perm))) {
       user_mem_check_addr = (i == pg_start) ? (uint32_t) va : (uint32_t) i;
       return -E_FAULT;
@@ -666,11 +998,21 @@ user_mem_check(struct Env *env, const void *va, size_t len, int perm)
 void
 user_mem_assert(struct Env *env, const void *va, size_t len, int perm)
 {
-	if (user_mem_check(env, va, len, perm | PTE_U) < 0) {
-		cprintf("[%08x] user_mem_check assertion failure for "
-			"va %08x\n", env->env_id, user_mem_check_addr);
-		env_destroy(env);	// may not return
-	}
+	if (user_mem_check(env, va, len, perm | PTE_U) < 0)
+		user_mem_fault(env, user_mem_check_addr);
+}
+
+//
+// Report that 'env' gave the kernel a bad user address 'va', as found
+// by user_mem_check or copyin/copyout, and destroy it.  If env is the
+// current environment, this function will not return.
+//
+void
+user_mem_fault(struct Env *env, uintptr_t va)
+{
+	cprintf("[%08x] user_mem_check assertion failure for "
+		"va %08x\n", env->env_id, va);
+	env_destroy(env);	// may not return
 }
 
 
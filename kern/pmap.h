@@ -16,6 +16,14 @@ extern struct PageInfo *pages;
 extern size_t npages, nfreepages;
 
 extern pde_t *kern_pgdir;
+extern struct PageInfo *zero_page;
+
+// page_insert refuses to map a page with this many references, before
+// its 16-bit pp_ref can overflow.
+#define PAGE_MAXREF		0xFF00
+
+// Stop sharing the zero page before its 16-bit pp_ref can overflow.
+#define ZERO_PAGE_MAXREF	PAGE_MAXREF
 
 
 /* This macro takes a kernel virtual address -- an address that points above
@@ -51,6 +59,12 @@ enum {
 	ALLOC_ZERO = 1<<0,
 };
 
+enum {
+	// Page was merged by the same-page scanner (kern/ksm.c) and is
+	// mapped copy-on-write by everyone who uses it.
+	PP_KSM = 1<<0,
+};
+
 void	mem_init(void);
 
 void	page_init(void);
@@ -60,6 +74,13 @@ int	page_insert(pde_t *pgdir, struct PageInfo *pp, void *va, int perm);
 void	page_remove(pde_t *pgdir, void *va);
 struct PageInfo *page_lookup(pde_t *pgdir, void *va, pte_t **pte_store);
 void	page_decref(struct PageInfo *pp);
+int	page_cow_break(pde_t *pgdir, void *va);
+int	page_move(pde_t *srcpgdir, void *srcva, pde_t *dstpgdir, void *dstva,
+		  int perm);
+int	page_map_zero(pde_t *pgdir, void *va, int perm);
+int	pgdir_fork(pde_t *dst, pde_t *src);
+int	pgdir_unshare(pde_t *pgdir, const void *va);
+pte_t	*pgdir_next_mapped(pde_t *pgdir, uintptr_t *va, uintptr_t end);
 
 void	tlb_invalidate(pde_t *pgdir, void *va);
 
@@ -121,6 +142,7 @@ mmio_write64(volatile void *addr, uint64_t v)
 
 int	user_mem_check(struct Env *env, const void *va, size_t len, int perm);
 void	user_mem_assert(struct Env *env, const void *va, size_t len, int perm);
+void	user_mem_fault(struct Env *env, uintptr_t va);
 
 static inline physaddr_t
 page2pa(struct PageInfo *pp)
@@ -4,6 +4,8 @@
 #include <kern/env.h>
 #include <kern/pmap.h>
 #include <kern/monitor.h>
+#include <kern/ksm.h>
+#include <kern/futex.h>
 
 void sched_halt(void);
 
@@ -29,6 +31,10 @@ sched_yield(void)
 	// below to halt the cpu.
 
 	// LAB 4: Your code here.
+  // Sleepers whose futex timeout has passed become runnable first.
+  // Every CPU's timer tick comes through here.
+  futex_tick();
+
   int runningEnv = 0;
   for (int i = 0; i < NENV; i++) { // start at env last running
     if (&envs[i] == curenv) {
@@ -45,8 +51,8 @@ sched_yield(void)
     }
   }
 
-  if (curenv->env_status == ENV_RUNNING) {
-    //env_run(curenv);
+  if (curenv && curenv->env_status == ENV_RUNNING) {
+    env_run(curenv);
   }
 
 	// sched_halt never returns
@@ -69,7 +75,8 @@ sched_halt(void)
 		     envs[i].env_status == ENV_DYING))
 			break;
 	}
-	if (i == NENV) {
+	// Envs sleeping with a timeout will run again after a few ticks.
+	if (i == NENV && !futex_timers_pending()) {
 		cprintf("No runnable environments in the system!\n");
 		while (1)
 			monitor(NULL);
@@ -79,6 +86,9 @@ sched_halt(void)
 	curenv = NULL;
 	lcr3(PADDR(kern_pgdir));
 
+	// Put the idle time to use merging duplicate user pages.
+	ksm_scan(KSM_SCAN_BATCH);
+
 	// Mark that this CPU is in the HALT state, so that when
 	// timer interupts come in, we know we should re-acquire the
 	// big kernel lock
@@ -0,0 +1,176 @@
+// Named shared-memory segments.
+//
+// A segment is a run of zeroed pages with a name.  Any env can attach
+// it by name at a virtual address of its choosing, and every env that
+// does maps the same physical pages, marked PTE_SHARE so that fork
+// passes them on as they are.  The table holds one reference to each
+// page; shm_remove drops it, and the pages are freed once the last env
+// has detached (or exited).
+
+#include <inc/assert.h>
+#include <inc/error.h>
+#include <inc/string.h>
+#include <inc/syscall.h>
+
+#include <kern/env.h>
+#include <kern/pmap.h>
+#include <kern/shm.h>
+
+struct shm_seg {
+	char ss_name[SHM_NAMELEN];	// empty if the slot is free
+	struct PageInfo **ss_pages;	// a page of pointers
+	size_t ss_npages;
+};
+
+static struct shm_seg shm_segs[SHM_NSEGS];
+
+static struct shm_seg *
+shm_lookup(const char *name)
+{
+	struct shm_seg *ss;
+
+	for (ss = shm_segs; ss < shm_segs + SHM_NSEGS; ss++)
+		if (ss->ss_name[0] && strcmp(ss->ss_name, name) == 0)
+			return ss;
+	return NULL;
+}
+
+static void
+shm_release(struct shm_seg *ss)
+{
+	size_t i;
+
+	for (i = 0; i < ss->ss_npages; i++)
+		page_decref(ss->ss_pages[i]);
+	page_decref(pa2page(PADDR(ss->ss_pages)));
+	memset(ss, 0, sizeof(*ss));
+}
+
+//
+// Create a segment of 'npages' zeroed pages called 'name'.
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if the name is empty or npages is 0 or over SHM_MAXPAGES.
+//	-E_EXISTS if a segment of that name exists.
+//	-E_NO_MEM if out of memory or segment slots.
+//
+int
+shm_create(const char *name, size_t npages)
+{
+	struct shm_seg *ss, *free = NULL;
+	struct PageInfo *pp;
+
+	if (!name[0] || npages == 0 || npages > SHM_MAXPAGES)
+		return -E_INVAL;
+	for (ss = shm_segs; ss < shm_segs + SHM_NSEGS; ss++) {
+		if (ss->ss_name[0] && strcmp(ss->ss_name, name) == 0)
+			return -E_EXISTS;
+		if (!ss->ss_name[0] && !free)
+			free = ss;
+	}
+	if (!free || !(pp = page_alloc(ALLOC_ZERO)))
+		return -E_NO_MEM;
+	pp->pp_ref++;
+	ss = free;
+	ss->ss_pages = page2kva(pp);
+	for (ss->ss_npages = 0; ss->ss_npages < npages; ss->ss_npages++) {
+		if (!(pp = page_alloc(ALLOC_ZERO))) {
+			shm_release(ss);
+			return -E_NO_MEM;
+		}
+		pp->pp_ref++;
+		ss->ss_pages[ss->ss_npages] = pp;
+	}
+	strncpy(ss->ss_name, name, SHM_NAMELEN - 1);
+	return 0;
+}
+
+//
+// Map all of segment 'name' into env 'e' at 'va', where nothing may be
+// mapped yet.  'perm' is PTE_U | PTE_P, optionally with PTE_W;
+// PTE_SHARE is added.
+// Returns the segment's size in pages on success, < 0 on error.
+// Errors are:
+//	-E_NOT_FOUND if there is no segment of that name.
+//	-E_INVAL if va is not page-aligned, the segment would not fit
+//		below UTOP, something is already mapped in the range, or
+//		perm is inappropriate.
+//	-E_NO_MEM if out of memory for page tables, or a page has too
+//		many mappings.
+// On error nothing is mapped and e's mappings are as they were.
+//
+int
+shm_attach(struct Env *e, const char *name, void *va, int perm)
+{
+	struct shm_seg *ss;
+	uintptr_t start = (uintptr_t) va;
+	size_t i;
+	int r;
+
+	if (!(ss = shm_lookup(name)))
+		return -E_NOT_FOUND;
+	if (PGOFF(start) || start >= UTOP
+	    || ss->ss_npages > (UTOP - start) / PGSIZE)
+		return -E_INVAL;
+	if ((perm & (PTE_U | PTE_P)) != (PTE_U | PTE_P)
+	    || (perm & ~(PTE_U | PTE_P | PTE_W)))
+		return -E_INVAL;
+
+	// Check the whole range and make its page tables before mapping
+	// anything, so that no page_insert below can fail halfway.
+	for (i = 0; i < ss->ss_npages; i++) {
+		if (page_lookup(e->env_pgdir, (void *) (start + i * PGSIZE),
+				NULL))
+			return -E_INVAL;
+		if (!pgdir_walk(e->env_pgdir, (void *) (start + i * PGSIZE), 1)
+		    || ss->ss_pages[i]->pp_ref >= PAGE_MAXREF)
+			return -E_NO_MEM;
+	}
+
+	for (i = 0; i < ss->ss_npages; i++)
+		if ((r = page_insert(e->env_pgdir, ss->ss_pages[i],
+				     (void *) (start + i * PGSIZE),
+				     perm | PTE_SHARE)) < 0)
+			panic("shm_attach: prepared insert failed: %e", r);
+	return ss->ss_npages;
+}
+
+//
+// Unmap segment 'name' from env 'e', where it was attached at 'va'.
+// Pages at those addresses that are not the segment's are left alone.
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NOT_FOUND if there is no segment of that name.
+//	-E_INVAL if va is not page-aligned or not below UTOP.
+//
+int
+shm_detach(struct Env *e, const char *name, void *va)
+{
+	struct shm_seg *ss;
+	uintptr_t start = (uintptr_t) va;
+	size_t i;
+
+	if (!(ss = shm_lookup(name)))
+		return -E_NOT_FOUND;
+	if (PGOFF(start) || start >= UTOP)
+		return -E_INVAL;
+	for (i = 0; i < ss->ss_npages && start + i * PGSIZE < UTOP; i++)
+		if (page_lookup(e->env_pgdir, (void *) (start + i * PGSIZE), NULL)
+		    == ss->ss_pages[i])
+			page_remove(e->env_pgdir, (void *) (start + i * PGSIZE));
+	return 0;
+}
+
+//
+// Remove the name 'name'.  Envs that have the segment attached keep
+// it until they detach; the name can be reused right away.
+// Returns 0 on success, -E_NOT_FOUND if there is no such segment.
+//
+int
+shm_remove(const char *name)
+{
+	struct shm_seg *ss;
+
+	if (!(ss = shm_lookup(name)))
+		return -E_NOT_FOUND;
+	shm_release(ss);
+	return 0;
+}
@@ -0,0 +1,19 @@
+#ifndef JOS_KERN_SHM_H
+#define JOS_KERN_SHM_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+
+struct Env;
+
+// Number of named shared-memory segments that can exist at once.
+#define SHM_NSEGS	32
+
+int	shm_create(const char *name, size_t npages);
+int	shm_attach(struct Env *e, const char *name, void *va, int perm);
+int	shm_detach(struct Env *e, const char *name, void *va);
+int	shm_remove(const char *name);
+
+#endif	// !JOS_KERN_SHM_H
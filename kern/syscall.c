@@ -12,6 +12,12 @@
 #include <kern/console.h>
 #include <kern/sched.h>
 #include <kern/sysinfo.h>
+#include <kern/usercopy.h>
+#include <kern/shm.h>
+#include <kern/ipc.h>
+#include <kern/futex.h>
+#include <kern/endpoint.h>
+#include <kern/sysring.h>
 
 // Print a string to the system console.
 // The string is exactly 'len' characters long.
@@ -23,9 +29,16 @@ sys_cputs(const char *s, size_t len)
 	// Destroy the environment if not.
 
 	// LAB 3: Your code here.
+	char buf[256];
+	size_t n;
 
-	// Print the string supplied by the user.
-	cprintf("%.*s", len, s);
+	// Print the string supplied by the user, a bufferful at a time.
+	for (; len > 0; s += n, len -= n) {
+		n = MIN(len, sizeof(buf));
+		if (copyin(buf, s, n) < 0)
+			user_mem_fault(curenv, usercopy_fault_va);
+		cprintf("%.*s", n, buf);
+	}
 }
 
 // Read a character from the system console without blocking.
@@ -64,6 +77,111 @@ sys_env_destroy(envid_t envid)
 	return 0;
 }
 
+// The page system calls below, after looking up their environments.
+// The vector forms look each environment up once and call these for
+// every page.
+
+static int
+env_page_alloc(struct Env *e, void *va, int perm)
+{
+	struct PageInfo *pp;
+	int zero_fill = perm & PAGE_ZERO_FILL;
+	int r;
+
+	perm &= ~PAGE_ZERO_FILL;
+	if ((uintptr_t) va >= UTOP || PGOFF(va))
+		return -E_INVAL;
+	if ((perm & (PTE_U | PTE_P)) != (PTE_U | PTE_P) || (perm & ~PTE_SYSCALL))
+		return -E_INVAL;
+
+	if (zero_fill)
+		return page_map_zero(e->env_pgdir, va, perm);
+
+	if (!(pp = page_alloc(ALLOC_ZERO)))
+		return -E_NO_MEM;
+	if ((r = page_insert(e->env_pgdir, pp, va, perm)) < 0) {
+		page_free(pp);
+		return r;
+	}
+	return 0;
+}
+
+static int
+env_page_map(struct Env *esrc, void *srcva, struct Env *edst, void *dstva,
+	     int perm)
+{
+	struct PageInfo *pp;
+	pte_t *pte;
+	int move = perm & PAGE_MOVE;
+	int r;
+
+	perm &= ~PAGE_MOVE;
+	if ((uintptr_t) srcva >= UTOP || PGOFF(srcva)
+	    || (uintptr_t) dstva >= UTOP || PGOFF(dstva))
+		return -E_INVAL;
+	if ((perm & (PTE_U | PTE_P)) != (PTE_U | PTE_P) || (perm & ~PTE_SYSCALL))
+		return -E_INVAL;
+
+	// A page in a page table shared after fork is only writable once
+	// the table is unshared, which may turn it copy-on-write.
+	if ((perm & PTE_W) && (r = pgdir_unshare(esrc->env_pgdir, srcva)) < 0)
+		return r;
+
+	if (!(pp = page_lookup(esrc->env_pgdir, srcva, &pte)))
+		return -E_INVAL;
+	// A moved copy-on-write page stays copy-on-write (see page_move).
+	if ((perm & PTE_W) && !(*pte & (move ? PTE_W | PTE_COW : PTE_W)))
+		return -E_INVAL;
+	if (move)
+		return page_move(esrc->env_pgdir, srcva, edst->env_pgdir,
+				 dstva, perm);
+	return page_insert(edst->env_pgdir, pp, dstva, perm);
+}
+
+static int
+env_page_unmap(struct Env *e, void *va)
+{
+	int r;
+
+	if ((uintptr_t) va >= UTOP || PGOFF(va))
+		return -E_INVAL;
+	if (page_lookup(e->env_pgdir, va, 0)
+	    && (r = pgdir_unshare(e->env_pgdir, va)) < 0)
+		return r;
+	page_remove(e->env_pgdir, va);
+	return 0;
+}
+
+static int
+env_page_copy(struct Env *esrc, void *srcva, struct Env *edst, void *dstva,
+	      int perm)
+{
+	struct PageInfo *pp, *np;
+	pte_t *pte;
+	int r;
+
+	if ((uintptr_t) srcva >= UTOP || PGOFF(srcva)
+	    || (uintptr_t) dstva >= UTOP || PGOFF(dstva))
+		return -E_INVAL;
+	if ((perm & (PTE_U | PTE_P)) != (PTE_U | PTE_P) || (perm & ~PTE_SYSCALL))
+		return -E_INVAL;
+
+	if (!(pp = page_lookup(esrc->env_pgdir, srcva, &pte))
+	    || !(*pte & PTE_U))
+		return -E_INVAL;
+	if (pp == zero_page)
+		np = page_alloc(ALLOC_ZERO);
+	else if ((np = page_alloc(0)))
+		memcpy(page2kva(np), page2kva(pp), PGSIZE);
+	if (!np)
+		return -E_NO_MEM;
+	if ((r = page_insert(edst->env_pgdir, np, dstva, perm)) < 0) {
+		page_free(np);
+		return r;
+	}
+	return 0;
+}
+
 // Allocate a page of memory and map it at 'va' with permission
 // 'perm' in the address space of 'envid'.
 // The page's contents are set to 0.
@@ -72,6 +190,8 @@ sys_env_destroy(envid_t envid)
 //
 // perm -- PTE_U | PTE_P must be set, PTE_AVAIL | PTE_W may or may not be set,
 //         but no other bits may be set.  See PTE_SYSCALL in inc/mmu.h.
+//         PAGE_ZERO_FILL may also be set: the shared zero page is mapped
+//         instead, and a real page is allocated on the first write.
 //
 // Return 0 on success, < 0 on error.  Errors are:
 //	-E_BAD_ENV if environment envid doesn't currently exist,
@@ -91,24 +211,12 @@ sys_page_alloc(envid_t envid, void *va, int perm)
 	//   allocated!
 
 	// LAB 3: Your code here.
-  if ((uint32_t) va >= UTOP || ((uint32_t) va % PGSIZE) != 0) return -E_INVAL;
-  // check if perm is inappropriate TODO
-
   // find proper env
   struct Env *e;
-  int ret = envid2env(envid, &e, perm);
-  if (!ret) return ret;
-
-  struct PageInfo *newp = page_alloc(ALLOC_ZERO);
-  if (!newp) return -E_NO_MEM;
-
-  ret = page_insert(e->env_pgdir, newp, va, perm);
-  if (!ret) {
-    page_free(newp);
-    return ret;
-  }
+  int ret = envid2env(envid, &e, 1);
+  if (ret < 0) return ret;
 
-  return 0;
+  return env_page_alloc(e, va, perm);
 }
 
 // Map the page of memory at 'srcva' in srcenvid's address space
@@ -117,6 +225,11 @@ sys_page_alloc(envid_t envid, void *va, int perm)
 // that it also must not grant write access to a read-only
 // page.
 //
+// If perm has PAGE_MOVE, srcva is unmapped in the same operation: the
+// page changes hands without its reference count going up and down.
+// A copy-on-write page may then be moved writable; it stays
+// copy-on-write.
+//
 // Return 0 on success, < 0 on error.  Errors are:
 //	-E_BAD_ENV if srcenvid and/or dstenvid doesn't currently exist,
 //		or the caller doesn't have permission to change one of them.
@@ -126,7 +239,9 @@ sys_page_alloc(envid_t envid, void *va, int perm)
 //	-E_INVAL if perm is inappropriate (see sys_page_alloc).
 //	-E_INVAL if (perm & PTE_W), but srcva is read-only in srcenvid's
 //		address space.
-//	-E_NO_MEM if there's no memory to allocate any necessary page tables.
+//	-E_NO_MEM if there's no memory to allocate any necessary page tables,
+//		or the page at srcva is already mapped PAGE_MAXREF times
+//		(the shared zero page may be).
 static int
 sys_page_map(envid_t srcenvid, void *srcva,
 	     envid_t dstenvid, void *dstva, int perm)
@@ -139,31 +254,17 @@ sys_page_map(envid_t srcenvid, void *srcva,
 	//   check the current permissions on the page.
 
 	// LAB 3: Your code here.
-  if ((uint32_t) srcva >= UTOP || ((uint32_t) srcva % PGSIZE) != 0) return -E_INVAL;
-  if ((uint32_t) dstva >= UTOP || ((uint32_t) dstva % PGSIZE) != 0) return -E_INVAL;
-  // check if perm is inappropriate TODO
-
   // find proper env for source
   struct Env *esrc;
-  int ret = envid2env(srcenvid, &esrc, perm);
-  if (!ret) return ret;
+  int ret = envid2env(srcenvid, &esrc, 1);
+  if (ret < 0) return ret;
 
   // find proper env for dest
   struct Env *edest;
-  ret = envid2env(dstenvid, &edest, perm);
-  if (!ret) return ret;
-
-  pte_t *pstor;
-  struct PageInfo *srcpp = page_lookup(esrc->env_pgdir, srcva, &pstor);
-  if (!srcpp) return -E_INVAL;
-  // TODO check if srcva is read only in srcvids address space
-
-  ret = page_insert(edest->env_pgdir, srcpp, dstva, perm);
-  if (!ret) return ret;
-
-  return 0;
-
+  ret = envid2env(dstenvid, &edest, 1);
+  if (ret < 0) return ret;
 
+  return env_page_map(esrc, srcva, edest, dstva, perm);
 }
 
 // Unmap the page of memory at 'va' in the address space of 'envid'.
@@ -179,17 +280,215 @@ sys_page_unmap(envid_t envid, void *va)
 	// Hint: This function is a wrapper around page_remove().
 
 	// LAB 3: Your code here.
-  if ((uint32_t) va >= UTOP || ((uint32_t) va % PGSIZE) != 0) return -E_INVAL;
-  // check if perm is inappropriate TODO
-
   // find proper env
   struct Env *e;
-  int ret = envid2env(envid, &e, PTE_U); // TODO is this correct perm arg?
-  if (!ret) return ret;
+  int ret = envid2env(envid, &e, 1);
+  if (ret < 0) return ret;
 
-  page_remove(e->env_pgdir, va);
+  return env_page_unmap(e, va);
+}
 
-  return 0;
+// Allocate a page, copy the page at 'srcva' in srcenvid's address
+// space into it, and map it at 'dstva' in dstenvid's address space
+// with permission 'perm', in one system call.  This is what a user
+// copy-on-write fault handler needs; srcva and dstva may be the same
+// page of the same environment, which then gets a private copy.
+// Whatever was mapped at dstva is unmapped.
+//
+// Return 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if srcenvid and/or dstenvid doesn't currently exist,
+//		or the caller doesn't have permission to change one of them.
+//	-E_INVAL if srcva >= UTOP or srcva is not page-aligned,
+//		or dstva >= UTOP or dstva is not page-aligned.
+//	-E_INVAL is srcva is not mapped in srcenvid's address space.
+//	-E_INVAL if perm is inappropriate (see sys_page_alloc).
+//	-E_NO_MEM if there's no memory to allocate the new page,
+//		or to allocate any necessary page tables.
+static int
+sys_page_copy(envid_t srcenvid, void *srcva, envid_t dstenvid, void *dstva,
+	      int perm)
+{
+	struct Env *esrc, *edst;
+	int r;
+
+	if ((r = envid2env(srcenvid, &esrc, 1)) < 0
+	    || (r = envid2env(dstenvid, &edst, 1)) < 0)
+		return r;
+	return env_page_copy(esrc, srcva, edst, dstva, perm);
+}
+
+// Read a user array of 'n' page ranges into 'kvec', which holds
+// PAGE_VEC_MAX entries.
+static int
+page_vec_fetch(struct page_range *kvec, const struct page_range *vec, size_t n)
+{
+	if (n > PAGE_VEC_MAX)
+		return -E_INVAL;
+	return copyin(kvec, vec, n * sizeof(*vec));
+}
+
+// Has a vector call used up its pages for this trap?  Returns
+// -E_AGAIN once 'ndone' pages are done, so one call can't hold the
+// kernel lock for more than PAGE_VEC_MAXPAGES pages.
+static int
+page_vec_limit(size_t ndone)
+{
+	return ndone < PAGE_VEC_MAXPAGES ? 0 : -E_AGAIN;
+}
+
+// Report back how many pages a vector call got through.  The call may
+// have unmapped 'done' itself, in which case the count is lost.
+static void
+page_vec_done(size_t *done, size_t ndone)
+{
+	if (done)
+		copyout(done, &ndone, sizeof(ndone));
+}
+
+// Allocate every page in the 'n' ranges in 'vec', as if by calling
+// sys_page_alloc(envid, va, range's perm) on each page in order.
+// 'n' must be at most PAGE_VEC_MAX.
+//
+// The work stops at the first error, which is returned.  If 'done' is
+// not null, the number of pages that were allocated before that point
+// is stored there, so that the caller can undo them.
+//
+// At most PAGE_VEC_MAXPAGES pages are done per call.  If more remain,
+// the call returns -E_AGAIN with 'done' set, and the caller resubmits
+// the rest (the lib wrappers do this for you).
+//
+// Return 0 on success, < 0 on error.  Errors are those of
+// sys_page_alloc, plus -E_INVAL if 'n' is too large, -E_FAULT if
+// 'vec' can't be read, and -E_AGAIN as above.
+static int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+	struct page_range kvec[PAGE_VEC_MAX];
+	struct Env *e;
+	size_t i, j, ndone = 0;
+	int r;
+
+	if ((r = page_vec_fetch(kvec, vec, n)) < 0
+	    || (r = envid2env(envid, &e, 1)) < 0)
+		goto out;
+	for (i = 0; i < n; i++)
+		for (j = 0; j < kvec[i].pr_npages; j++, ndone++)
+			if ((r = page_vec_limit(ndone)) < 0
+			    || (r = env_page_alloc(e, kvec[i].pr_va + j * PGSIZE,
+						   kvec[i].pr_perm)) < 0)
+				goto out;
+out:
+	page_vec_done(done, ndone);
+	return r;
+}
+
+// Map every page in the 'n' ranges in 'vec' from srcenvid to dstenvid,
+// as if by calling sys_page_map(srcenvid, va, dstenvid, dstva, perm)
+// on each page in order.  Otherwise like sys_page_alloc_vec.
+static int
+sys_page_map_vec(envid_t srcenvid, envid_t dstenvid,
+		 const struct page_range *vec, size_t n, size_t *done)
+{
+	struct page_range kvec[PAGE_VEC_MAX];
+	struct Env *esrc, *edst;
+	size_t i, j, ndone = 0;
+	int r;
+
+	if ((r = page_vec_fetch(kvec, vec, n)) < 0
+	    || (r = envid2env(srcenvid, &esrc, 1)) < 0
+	    || (r = envid2env(dstenvid, &edst, 1)) < 0)
+		goto out;
+	for (i = 0; i < n; i++)
+		for (j = 0; j < kvec[i].pr_npages; j++, ndone++)
+			if ((r = page_vec_limit(ndone)) < 0
+			    || (r = env_page_map(esrc, kvec[i].pr_va + j * PGSIZE,
+						 edst, kvec[i].pr_dstva + j * PGSIZE,
+						 kvec[i].pr_perm)) < 0)
+				goto out;
+out:
+	page_vec_done(done, ndone);
+	return r;
+}
+
+// Unmap every page in the 'n' ranges in 'vec', as if by calling
+// sys_page_unmap(envid, va) on each page in order.  Otherwise like
+// sys_page_alloc_vec.
+static int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+	struct page_range kvec[PAGE_VEC_MAX];
+	struct Env *e;
+	size_t i, j, ndone = 0;
+	int r;
+
+	if ((r = page_vec_fetch(kvec, vec, n)) < 0
+	    || (r = envid2env(envid, &e, 1)) < 0)
+		goto out;
+	for (i = 0; i < n; i++)
+		for (j = 0; j < kvec[i].pr_npages; j++, ndone++)
+			if ((r = page_vec_limit(ndone)) < 0
+			    || (r = env_page_unmap(e, kvec[i].pr_va + j * PGSIZE)) < 0)
+				goto out;
+out:
+	page_vec_done(done, ndone);
+	return r;
+}
+
+// Describe the pages mapped in envid's address space at or above 'va',
+// as up to 'n' runs of consecutive pages with the same permissions.
+// Each run is stored in 'ranges' as pr_va, pr_npages and pr_perm
+// (pr_dstva is unused).  A page in a page table still shared after
+// fork is reported copy-on-write rather than writable, since that is
+// how it behaves.  'n' must be at most PAGE_VEC_MAX.
+//
+// Returns the number of runs stored, 0 if nothing is mapped at or
+// above 'va', or < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_INVAL if 'n' is too large.
+//	-E_FAULT if 'ranges' can't be written.
+static int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+	struct page_range kranges[PAGE_VEC_MAX], *r;
+	struct Env *e;
+	uintptr_t a = (uintptr_t) va;
+	pte_t *pte;
+	size_t nr = 0;
+	int perm, err;
+
+	if (n > PAGE_VEC_MAX)
+		return -E_INVAL;
+	if ((err = envid2env(envid, &e, 1)) < 0)
+		return err;
+
+	for (; n > 0 && (pte = pgdir_next_mapped(e->env_pgdir, &a, UTOP));
+	     a += PGSIZE) {
+		perm = *pte & PTE_SYSCALL;
+		if ((e->env_pgdir[PDX(a)] & PTE_COW) && (perm & PTE_W)
+		    && !(perm & PTE_SHARE))
+			perm = (perm & ~PTE_W) | PTE_COW;
+
+		r = nr > 0 ? &kranges[nr - 1] : NULL;
+		if (r && r->pr_perm == perm
+		    && (uintptr_t) r->pr_va + r->pr_npages * PGSIZE == a) {
+			r->pr_npages++;
+			continue;
+		}
+		if (nr == n)
+			break;
+		r = &kranges[nr++];
+		r->pr_va = (void *) a;
+		r->pr_npages = 1;
+		r->pr_perm = perm;
+		r->pr_dstva = 0;
+	}
+
+	if (copyout(ranges, kranges, nr * sizeof(*ranges)) < 0)
+		return -E_FAULT;
+	return nr;
 }
 
 // Deschedule current environment and pick a different one to run.
@@ -222,17 +521,36 @@ sys_exofork(void)
   e->env_status = ENV_NOT_RUNNABLE;
   e->env_tf = curenv->env_tf;
   e->env_tf.tf_regs.reg_eax = 0;
+  // Pages the parent never touched are still to be demand-loaded, if
+  // the child goes on running the parent's image (a user-level fork).
+  // sys_env_set_trapframe drops it for a child given a new image.
+  e->env_binary = curenv->env_binary;
+  e->env_stack_limit = curenv->env_stack_limit;
 
   return e->env_id;
 }
 
+// Is 'e' asleep in a system call that the kernel will end for it: on a
+// futex, in an IPC or endpoint send queue, or receiving?  Waking it any
+// other way would leave it linked into the queue, and the next wait
+// would link it in a second time.
+static bool
+env_blocked(struct Env *e)
+{
+	return e->env_futex_pa || e->env_ipc_sendto || e->env_ipc_recving
+		|| e->env_ipc_replyfrom || e->env_ep_sendto
+		|| e->env_ep_waiting;
+}
+
 // Set envid's env_status to status, which must be ENV_RUNNABLE
-// or ENV_NOT_RUNNABLE.
+// or ENV_NOT_RUNNABLE.  An env blocked in the kernel (a futex, IPC
+// or endpoint wait) can't be changed until it is woken.
 //
 // Returns 0 on success, < 0 on error.  Errors are:
 //	-E_BAD_ENV if environment envid doesn't currently exist,
 //		or the caller doesn't have permission to change envid.
 //	-E_INVAL if status is not a valid status for an environment.
+//	-E_AGAIN if envid is blocked in the kernel.
 static int
 sys_env_set_status(envid_t envid, int status)
 {
@@ -253,12 +571,73 @@ sys_env_set_status(envid_t envid, int status)
   int ret = envid2env(envid, &e, 1);
   if (ret < 0)
     return ret;
+  if (env_blocked(e))
+    return -E_AGAIN;
 
   e->env_status = status;
 
   return 0;
 }
 
+// Set envid's trap frame to 'tf'.
+// tf is modified to make sure that user environments always run at code
+// protection level 3 (CPL 3) with I/O privilege level 0, and with
+// interrupts disabled, as env_alloc leaves them.
+//
+// Setting another env's trap frame starts it on an image of the
+// caller's making (see uspawn), so it stops demand-loading pages from
+// the binary it inherited through sys_exofork: a fault there must not
+// bring in the parent's text and data.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_FAULT if tf is not readable.
+static int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+	struct Env *e;
+	struct Trapframe ktf;
+	int r;
+
+	if ((r = envid2env(envid, &e, 1)) < 0)
+		return r;
+	if ((r = copyin(&ktf, tf, sizeof(ktf))) < 0)
+		return r;
+	ktf.tf_ds = GD_UD | 3;
+	ktf.tf_es = GD_UD | 3;
+	ktf.tf_ss = GD_UD | 3;
+	ktf.tf_cs = GD_UT | 3;
+	ktf.tf_eflags &= ~(FL_IOPL_MASK | FL_IF);
+	e->env_tf = ktf;
+	if (e != curenv)
+		e->env_binary = NULL;
+	return 0;
+}
+
+// Set how far envid's stack may grow below USTACKTOP, rounded up to
+// whole pages.  The stack grows a page at a time as it is touched; the
+// page just below the limit is a guard, and touching it kills the env.
+// Pages already mapped below a lowered limit stay mapped.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_INVAL if size is 0 or more than USTACKSIZE.
+static int
+sys_env_set_stack_limit(envid_t envid, size_t size)
+{
+	struct Env *e;
+	int r;
+
+	if (size == 0 || size > USTACKSIZE)
+		return -E_INVAL;
+	if ((r = envid2env(envid, &e, 1)) < 0)
+		return r;
+	e->env_stack_limit = ROUNDUP(size, PGSIZE);
+	return 0;
+}
+
 // Set the page fault upcall for 'envid' by modifying the corresponding struct
 // Env's 'env_pgfault_upcall' field.  When 'envid' causes a page fault, the
 // kernel will push a fault record onto the exception stack, then branch to
@@ -271,7 +650,194 @@ static int
 sys_env_set_pgfault_upcall(envid_t envid, void *func)
 {
 	// LAB 4: Your code here.
-	panic("sys_env_set_pgfault_upcall not implemented");
+	struct Env *e;
+	int r;
+
+	if ((r = envid2env(envid, &e, 1)) < 0)
+		return r;
+	e->env_pgfault_upcall = func;
+	return 0;
+}
+
+// Create a copy of the current environment, like exofork followed by
+// duppage on every page, but without leaving the kernel.  Writable
+// pages become copy-on-write in both environments; the child gets a
+// fresh, zeroed user exception stack if the parent has one, and
+// inherits the parent's page fault upcall.  The child is runnable.
+//
+// Returns envid of new environment to the parent and 0 to the child,
+// or < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if no free environment is available.
+//	-E_NO_MEM on memory exhaustion.
+static envid_t
+sys_fork(void)
+{
+	struct Env *e;
+	struct PageInfo *pp;
+	int r;
+
+	if ((r = env_alloc(&e, curenv->env_id)) < 0)
+		return r;
+	e->env_tf = curenv->env_tf;
+	e->env_tf.tf_regs.reg_eax = 0;
+	e->env_pgfault_upcall = curenv->env_pgfault_upcall;
+	e->env_binary = curenv->env_binary;
+	e->env_stack_limit = curenv->env_stack_limit;
+
+	r = pgdir_fork(e->env_pgdir, curenv->env_pgdir);
+	// The parent's writable mappings are now read-only.
+	lcr3(PADDR(curenv->env_pgdir));
+	if (r < 0)
+		goto fail;
+
+	if (page_lookup(curenv->env_pgdir, (void *) (UXSTACKTOP - PGSIZE), 0)) {
+		r = -E_NO_MEM;
+		if (!(pp = page_alloc(ALLOC_ZERO)))
+			goto fail;
+		if ((r = page_insert(e->env_pgdir, pp, (void *) (UXSTACKTOP - PGSIZE),
+				     PTE_P | PTE_U | PTE_W)) < 0) {
+			page_free(pp);
+			goto fail;
+		}
+	}
+
+	e->env_status = ENV_RUNNABLE;
+	return e->env_id;
+
+fail:
+	env_destroy(e);
+	return r;
+}
+
+// Create a child environment running the ELF image of 'size' bytes at
+// 'binary', with the NULL-terminated argument list 'argv' (which may be
+// NULL) on its stack.  This replaces exofork followed by a page
+// syscall for every page of the image: the segments are copied from
+// the caller's memory straight into the child's pages, bss is mapped
+// to the zero page, and the child is runnable on return.
+//
+// Returns envid of new environment, or < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if no free environment is available.
+//	-E_NO_MEM on memory exhaustion.
+//	-E_NOT_EXEC if the image is not a valid ELF executable.
+//	-E_FAULT if the image or the arguments are not readable.
+//	-E_INVAL if the arguments do not fit on one stack page.
+static envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+	struct Env *e;
+	int r;
+
+	if ((r = env_alloc(&e, curenv->env_id)) < 0)
+		return r;
+	e->env_status = ENV_NOT_RUNNABLE;
+	if ((r = env_load_elf(e, binary, size)) < 0
+	    || (r = env_init_stack(e, argv)) < 0) {
+		env_destroy(e);
+		return r;
+	}
+	e->env_status = ENV_RUNNABLE;
+	return e->env_id;
+}
+
+// Copy the shared-memory segment name at user address 'uname' into
+// 'name', which has room for SHM_NAMELEN bytes.
+static int
+shm_name(char *name, const char *uname)
+{
+	int r;
+
+	if ((r = copyinstr(name, uname, SHM_NAMELEN)) < 0)
+		return r;
+	return 0;
+}
+
+// Create a named shared-memory segment of 'npages' zeroed pages.
+// The segment exists until sys_shm_remove, even if no env has it
+// attached.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if the name is empty or longer than SHM_NAMELEN - 1,
+//		or npages is 0 or more than SHM_MAXPAGES.
+//	-E_EXISTS if a segment of that name exists.
+//	-E_NO_MEM on memory exhaustion, or if there are too many segments.
+//	-E_FAULT if the name is not readable.
+static int
+sys_shm_create(const char *name, size_t npages)
+{
+	char kname[SHM_NAMELEN];
+	int r;
+
+	if ((r = shm_name(kname, name)) < 0)
+		return r;
+	return shm_create(kname, npages);
+}
+
+// Map the whole of segment 'name' at 'va' in envid's address space,
+// with 'perm' (PTE_U | PTE_P, and PTE_W if it should be writable).
+// Nothing may be mapped there yet.  The pages are mapped PTE_SHARE,
+// so they stay shared across fork.
+//
+// Returns the segment's size in pages, or < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_NOT_FOUND if there is no segment of that name.
+//	-E_INVAL if va is not page-aligned, the segment doesn't fit
+//		below UTOP, the range is not empty, or perm is
+//		inappropriate.
+//	-E_NO_MEM on memory exhaustion.
+//	-E_FAULT if the name is not readable.
+static int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+	char kname[SHM_NAMELEN];
+	struct Env *e;
+	int r;
+
+	if ((r = envid2env(envid, &e, 1)) < 0)
+		return r;
+	if ((r = shm_name(kname, name)) < 0)
+		return r;
+	return shm_attach(e, kname, va, perm);
+}
+
+// Unmap segment 'name', attached at 'va', from envid's address space.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_NOT_FOUND if there is no segment of that name.
+//	-E_INVAL if va is not page-aligned or va >= UTOP.
+//	-E_FAULT if the name is not readable.
+static int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+	char kname[SHM_NAMELEN];
+	struct Env *e;
+	int r;
+
+	if ((r = envid2env(envid, &e, 1)) < 0)
+		return r;
+	if ((r = shm_name(kname, name)) < 0)
+		return r;
+	return shm_detach(e, kname, va);
+}
+
+// Remove the name of segment 'name'.  Its memory is freed once every
+// env has detached it.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NOT_FOUND if there is no segment of that name.
+//	-E_FAULT if the name is not readable.
+static int
+sys_shm_remove(const char *name)
+{
+	char kname[SHM_NAMELEN];
+	int r;
+
+	if ((r = shm_name(kname, name)) < 0)
+		return r;
+	return shm_remove(kname);
 }
 
 // Return the current system information.
@@ -279,12 +845,19 @@ static int
 sys_sysinfo(struct sysinfo *info)
 {
 	// LAB 4: Your code here.
-	panic("sys_sysinfo not implemented");
+	struct sysinfo kinfo;
+	int r;
+
+	if ((r = sysinfo(&kinfo)) < 0)
+		return r;
+	return copyout(info, &kinfo, sizeof(kinfo));
 }
 
 // Try to send 'value' to the target env 'envid'.
 // If srcva < UTOP, then also send page currently mapped at 'srcva',
 // so that receiver gets a duplicate mapping of the same page.
+// If perm has PAGE_MOVE, the page is moved instead, as by sys_page_map:
+// srcva is unmapped once the receiver has it.
 //
 // The send fails with a return value of -E_IPC_NOT_RECV if the
 // target is not blocked, waiting for an IPC.
@@ -295,8 +868,9 @@ sys_sysinfo(struct sysinfo *info)
 // updated as follows:
 //    env_ipc_recving is set to 0 to block future sends;
 //    env_ipc_from is set to the sending envid;
-//    env_ipc_value is set to the 'value' parameter;
-//    env_ipc_perm is set to 'perm' if a page was transferred, 0 otherwise.
+//    env_ipc_msg is set to a message holding 'value' in word 0;
+//    env_ipc_perm is set to 'perm' (without PAGE_MOVE) if a page was
+//	transferred, 0 otherwise.
 // The target environment is marked runnable again, returning 0
 // from the paused sys_ipc_recv system call.  (Hint: does the
 // sys_ipc_recv function ever actually return?)
@@ -324,7 +898,76 @@ static int
 sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
 {
 	// LAB 4: Your code here.
-	panic("sys_ipc_try_send not implemented");
+	struct Env *e;
+	struct ipc_msg msg = { { value } };
+	int r;
+
+	if ((r = envid2env(envid, &e, 0)) < 0)
+		return r;
+	return ipc_send(e, &msg, srcva, 1, perm, 0);
+}
+
+// Like sys_ipc_try_send, but if envid is not receiving, wait for it in
+// its queue of senders instead of failing.  Senders are served in the
+// order they arrive.  The system call returns once the message has been
+// received.
+//
+// Returns 0 on success, < 0 on error.  Errors are those of
+// sys_ipc_try_send, except -E_IPC_NOT_RECV, and:
+//	-E_AGAIN if IPC_QUEUE_MAX senders are already waiting for envid.
+//	-E_BAD_ENV if envid exits while we wait.
+//	-E_INVAL if envid is the current environment.
+static int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
+{
+	struct Env *e;
+	struct ipc_msg msg = { { value } };
+	int r;
+
+	if ((r = envid2env(envid, &e, 0)) < 0)
+		return r;
+	return ipc_send(e, &msg, srcva, 1, perm, 1);
+}
+
+// Like sys_ipc_send, but send the 'npages' contiguous pages at 'srcva'.
+// Every page is checked before any is mapped, and the receiver is woken
+// once.  The receiver gets as many of them as fit in the window it gave
+// sys_ipc_recv_range (one page for sys_ipc_recv), mapped in order from
+// the start of the window; env_ipc_npages says how many.
+//
+// Returns 0 on success, < 0 on error.  Errors are those of
+// sys_ipc_send, and:
+//	-E_INVAL if npages is 0 or more than IPC_RANGE_MAX, or the range
+//		does not fit below UTOP, or any page in it is unmapped or
+//		read-only when perm has PTE_W.
+static int
+sys_ipc_send_range(envid_t envid, uint32_t value, void *srcva, size_t npages,
+		   unsigned perm)
+{
+	struct Env *e;
+	struct ipc_msg msg = { { value } };
+	int r;
+
+	if ((r = envid2env(envid, &e, 0)) < 0)
+		return r;
+	return ipc_send(e, &msg, srcva, npages, perm, 1);
+}
+
+// Like sys_ipc_send, but send the IPC_MSG_WORDS words of the message in
+// the caller's registers (see struct ipc_msg) and no page.  A receiver
+// in sys_ipc_reply_wait gets them in registers; one in sys_ipc_recv
+// finds them in env_ipc_msg.
+static int
+sys_ipc_send_msg(envid_t envid)
+{
+	struct Env *e;
+	struct ipc_msg msg;
+	int r;
+
+	if ((r = envid2env(envid, &e, 0)) < 0)
+		return r;
+	ipc_msg_get(&msg, &curenv->env_tf.tf_regs);
+	return ipc_send(e, &msg, (void *) UTOP, 0, 0, 1);
 }
 
 // Block until a value is ready.  Record that you want to receive
@@ -338,12 +981,195 @@ sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
 // return 0 on success.
 // Return < 0 on error.  Errors are:
 //	-E_INVAL if dstva < UTOP but dstva is not page-aligned.
+//
+// A sender waiting in our queue (see sys_ipc_send) is served at once.
 static int
 sys_ipc_recv(void *dstva)
 {
 	// LAB 4: Your code here.
-	panic("sys_ipc_recv not implemented");
-	return 0;
+	return ipc_recv(dstva, 1);
+}
+
+// Like sys_ipc_recv, but accept up to 'npages' pages into the window
+// that starts at 'dstva'.
+// Return < 0 on error.  Errors are:
+//	-E_INVAL if dstva < UTOP but is not page-aligned, or npages is 0
+//		or more than IPC_RANGE_MAX, or the window does not fit
+//		below UTOP.
+static int
+sys_ipc_recv_range(void *dstva, size_t npages)
+{
+	return ipc_recv(dstva, npages);
+}
+
+// Send the message in the caller's registers to envid and wait for its
+// reply, switching straight to envid if it is receiving.  Carries no
+// page.  On success the system call returns 0 with the reply in the
+// message registers, once envid calls sys_ipc_reply_wait naming us.
+//
+// Returns < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or exits before replying.
+//	-E_INVAL if envid is the current environment.
+//	-E_AGAIN if IPC_QUEUE_MAX senders are already waiting for envid.
+static int
+sys_ipc_call(envid_t envid)
+{
+	struct Env *e;
+	struct ipc_msg msg;
+	int r;
+
+	if ((r = envid2env(envid, &e, 0)) < 0)
+		return r;
+	ipc_msg_get(&msg, &curenv->env_tf.tf_regs);
+	return ipc_call(e, &msg);
+}
+
+// Reply the message in the caller's registers to the sys_ipc_call of
+// envid (if envid is not 0), then block for the next message, switching
+// straight back to envid if nothing is queued.  On success the system
+// call returns the sender's envid with its message in the registers.  The server of a call/reply pair loops
+// on this one system call.
+//
+// Returns < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist.
+//	-E_IPC_NOT_RECV if envid is not waiting for our reply.
+static int
+sys_ipc_reply_wait(envid_t envid)
+{
+	struct ipc_msg reply;
+
+	ipc_msg_get(&reply, &curenv->env_tf.tf_regs);
+	return ipc_reply_wait(envid, &reply);
+}
+
+// Block until the 32-bit word at 'addr' changes, if it still holds
+// 'expected'.  The timeout, in nanoseconds, comes in two halves; 0
+// means no timeout.  Envs mapping the same physical page meet on the
+// same word, whatever address each maps it at.
+//
+// Returns 0 once woken by sys_futex_wake, < 0 on error.  Errors are:
+//	-E_AGAIN if the word does not hold 'expected'.
+//	-E_TIMEOUT if the timeout passes first.
+//	-E_INVAL if addr is not 4-byte aligned or is above UTOP.
+//	-E_FAULT if addr can't be read.
+static int
+sys_futex_wait(const uint32_t *addr, uint32_t expected, uint32_t timeout_lo,
+	       uint32_t timeout_hi)
+{
+	return futex_wait(addr, expected,
+			  ((nanoseconds_t) timeout_hi << 32) | timeout_lo);
+}
+
+// Wake up to 'n' envs blocked in sys_futex_wait on the word at 'addr',
+// in the order they went to sleep.
+//
+// Returns the number of envs woken, < 0 on error.  Errors are:
+//	-E_INVAL if addr is not 4-byte aligned or is above UTOP.
+static int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+	return futex_wake(addr, n);
+}
+
+// Create an IPC endpoint owned by the current environment, which may
+// receive on it and send to it.  Other environments may only send to
+// it once granted (sys_ep_grant).
+//
+// Returns the endpoint's ID, < 0 on error.  Errors are:
+//	-E_NO_MEM if NENDPOINT endpoints already exist.
+static int
+sys_ep_create(void)
+{
+	return ep_create();
+}
+
+// Destroy endpoint epid, which the current environment owns.  Senders
+// waiting on it fail with -E_NOT_FOUND, and every capability for it is
+// revoked.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NOT_FOUND if epid is not an endpoint we own.
+static int
+sys_ep_destroy(epid_t epid)
+{
+	return ep_destroy(epid);
+}
+
+// Let envid send to endpoint epid.  The current environment must be
+// able to send to it (or own it).  Any environment may be granted an
+// endpoint; handing out the capability is up to its holders.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist.
+//	-E_NOT_FOUND if epid is not an endpoint we may send to.
+static int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+	struct Env *e;
+	int r;
+
+	if ((r = envid2env(envid, &e, 0)) < 0)
+		return r;
+	return ep_grant(epid, e);
+}
+
+// Send the message in the caller's registers (see struct ipc_msg) to
+// endpoint epid, waiting in its queue if its owner is not receiving on
+// it.  Returns once the owner has the message.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NOT_FOUND if epid is not an endpoint we may send to, or it is
+//		destroyed while we wait.
+//	-E_INVAL if we own epid.
+//	-E_AGAIN if EP_QUEUE_MAX senders are already waiting on epid.
+static int
+sys_ep_send(epid_t epid)
+{
+	struct ipc_msg msg;
+
+	ipc_msg_get(&msg, &curenv->env_tf.tf_regs);
+	return ep_send(epid, &msg);
+}
+
+// Wait for a message on any of the n endpoints listed in 'epids', all
+// owned by the current environment.  On success the system call
+// returns the ID of the endpoint that fired, with the sender's envid
+// in DX and the message in the message registers.
+//
+// Return < 0 on error.  Errors are:
+//	-E_INVAL if n is 0 or more than NENDPOINT.
+//	-E_NOT_FOUND if an ID is not an endpoint we own.
+//	-E_FAULT if epids can't be read.
+static int
+sys_ep_recv(const epid_t *epids, size_t n)
+{
+	return ep_recv(epids, n);
+}
+
+// Register the page at 'va', which holds a struct sysring, as the
+// current environment's system call ring (NULL drops it).
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if va is not page-aligned or is above UTOP.
+//	-E_FAULT if va is not mapped writable.
+static int
+sys_sysring_setup(void *va)
+{
+	return sysring_setup(va);
+}
+
+// Run every system call queued in the current environment's ring, in
+// one trap, posting each result to its completion ring.  Calls that
+// could block or switch environments fail with -E_INVAL.
+//
+// Returns the number of calls run, < 0 on error.  Errors are:
+//	-E_INVAL if no ring is registered, or it is corrupt.
+//	-E_FAULT if the ring is no longer mapped writable.
+static int
+sys_sysring_enter(void)
+{
+	return sysring_enter();
 }
 
 // Dispatches to the correct kernel function, passing the arguments.
@@ -356,7 +1182,6 @@ syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4,
   switch (syscallno) {
     // add cases for each syscall enum (as in the header file)
     case SYS_cputs:
-      user_mem_assert(curenv, (void*) a1, (size_t) a2, PTE_U);
       sys_cputs((const char *) a1, (size_t) a2);
       return 0;
       break;
@@ -389,6 +1214,109 @@ syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4,
     case SYS_env_set_status:
       return sys_env_set_status((envid_t) a1, (int) a2);
       break;
+    case SYS_page_alloc_vec:
+      return sys_page_alloc_vec((envid_t) a1, (const struct page_range *) a2,
+          (size_t) a3, (size_t *) a4);
+      break;
+    case SYS_page_map_vec:
+      return sys_page_map_vec((envid_t) a1, (envid_t) a2,
+          (const struct page_range *) a3, (size_t) a4, (size_t *) a5);
+      break;
+    case SYS_page_unmap_vec:
+      return sys_page_unmap_vec((envid_t) a1, (const struct page_range *) a2,
+          (size_t) a3, (size_t *) a4);
+      break;
+    case SYS_vm_ranges:
+      return sys_vm_ranges((envid_t) a1, (void *) a2, (struct page_range *) a3,
+          (size_t) a4);
+      break;
+    case SYS_env_set_trapframe:
+      return sys_env_set_trapframe((envid_t) a1, (struct Trapframe *) a2);
+      break;
+    case SYS_spawn:
+      return sys_spawn((const void *) a1, (size_t) a2, (const char **) a3);
+      break;
+    case SYS_shm_create:
+      return sys_shm_create((const char *) a1, (size_t) a2);
+      break;
+    case SYS_shm_attach:
+      return sys_shm_attach((envid_t) a1, (const char *) a2, (void *) a3,
+          (int) a4);
+      break;
+    case SYS_shm_detach:
+      return sys_shm_detach((envid_t) a1, (const char *) a2, (void *) a3);
+      break;
+    case SYS_shm_remove:
+      return sys_shm_remove((const char *) a1);
+      break;
+    case SYS_env_set_stack_limit:
+      return sys_env_set_stack_limit((envid_t) a1, (size_t) a2);
+      break;
+    case SYS_env_set_pgfault_upcall:
+      return sys_env_set_pgfault_upcall((envid_t) a1, (void *) a2);
+      break;
+    case SYS_fork:
+      return sys_fork();
+      break;
+    case SYS_sysinfo:
+      return sys_sysinfo((struct sysinfo *) a1);
+      break;
+    case SYS_ipc_try_send:
+      return sys_ipc_try_send((envid_t) a1, a2, (void *) a3, (unsigned) a4);
+      break;
+    case SYS_ipc_send:
+      return sys_ipc_send((envid_t) a1, a2, (void *) a3, (unsigned) a4);
+      break;
+    case SYS_ipc_recv:
+      return sys_ipc_recv((void *) a1);
+      break;
+    case SYS_ipc_call:
+      return sys_ipc_call((envid_t) a1);
+      break;
+    case SYS_ipc_reply_wait:
+      return sys_ipc_reply_wait((envid_t) a1);
+      break;
+    case SYS_ipc_send_msg:
+      return sys_ipc_send_msg((envid_t) a1);
+      break;
+    case SYS_ipc_send_range:
+      return sys_ipc_send_range((envid_t) a1, a2, (void *) a3, (size_t) a4,
+                                (unsigned) a5);
+      break;
+    case SYS_ipc_recv_range:
+      return sys_ipc_recv_range((void *) a1, (size_t) a2);
+      break;
+    case SYS_futex_wait:
+      return sys_futex_wait((const uint32_t *) a1, a2, a3, a4);
+      break;
+    case SYS_futex_wake:
+      return sys_futex_wake((const uint32_t *) a1, (int) a2);
+      break;
+    case SYS_ep_create:
+      return sys_ep_create();
+      break;
+    case SYS_ep_destroy:
+      return sys_ep_destroy((epid_t) a1);
+      break;
+    case SYS_ep_grant:
+      return sys_ep_grant((epid_t) a1, (envid_t) a2);
+      break;
+    case SYS_ep_send:
+      return sys_ep_send((epid_t) a1);
+      break;
+    case SYS_ep_recv:
+      return sys_ep_recv((const epid_t *) a1, (size_t) a2);
+      break;
+    case SYS_sysring_setup:
+      return sys_sysring_setup((void *) a1);
+      break;
+    case SYS_sysring_enter:
+      return sys_sysring_enter();
+      break;
+    case SYS_page_copy:
+      return sys_page_copy((envid_t) a1, (void *) a2, (envid_t) a3,
+          (void *) a4, (int) a5);
+      break;
     default:
       return -E_INVAL;
   }
@@ -1,16 +1,93 @@
 #include <inc/assert.h>
 #include <inc/error.h>
 #include <inc/string.h>
+#include <inc/x86.h>
 
 #include <kern/cpu.h>
 #include <kern/sysinfo.h>
 #include <kern/pmap.h>
+#include <kern/ksm.h>
+#include <kern/elfcache.h>
+#include <kern/env.h>
 
 #define NANOSECONDS_PER_TICK	(10 * NANOSECONDS_PER_MILLISECOND)
 
 static uint64_t ticks = 0;
 uint64_t inblocks, outblocks;
 uint64_t inpackets, outpackets;
+uint64_t kfaults, kfault_cycles, upcalls;
+
+// The page mapped read-only at UVDSO in every env.
+static struct vdso *vdso;
+
+// Allocate the vdso page and map it at UVDSO, in the kernel's page
+// table for the UENVS slot, which every env shares.
+void
+vdso_init(void)
+{
+	struct PageInfo *pp;
+
+	static_assert(VDSO_NCPU >= NCPU);
+	static_assert(NENV * sizeof(struct Env) <= UVDSO - UENVS);
+
+	if (!(pp = page_alloc(ALLOC_ZERO)))
+		panic("vdso_init: out of memory");
+	if (page_insert(kern_pgdir, pp, (void *) UVDSO, PTE_U) < 0)
+		panic("vdso_init: out of memory");
+	vdso = page2kva(pp);
+	vdso->vd_ns_per_tick = NANOSECONDS_PER_TICK;
+	vdso->vd_totalpages = npages;
+}
+
+// Convert 'delta' TSC cycles to nanoseconds, at 'per_tick' cycles a
+// tick.
+static nanoseconds_t
+tsc_to_ns(uint64_t delta, uint64_t per_tick)
+{
+	return delta / per_tick * NANOSECONDS_PER_TICK
+		+ delta % per_tick * NANOSECONDS_PER_TICK / per_tick;
+}
+
+// Refresh the vdso page.  Only CPU 0 calls this, so there is a single
+// writer; x86 keeps its stores in order, so the compiler barriers are
+// enough for readers to see vd_seq go odd before the data changes.
+static void
+vdso_update(void)
+{
+	uint64_t tsc = read_tsc(), delta;
+	int i;
+
+	vdso->vd_seq++;
+	asm volatile("" : : : "memory");
+
+	// Once the TSC is calibrated it carries the clock, so that time
+	// keeps moving across ticks lost while interrupts were off, and
+	// readers interpolating from the last update never see it go
+	// backwards.  Until then, count ticks.
+	delta = tsc - vdso->vd_tick_tsc;
+	if (vdso->vd_tsc_per_tick)
+		vdso->vd_uptime += tsc_to_ns(delta, vdso->vd_tsc_per_tick);
+	else
+		vdso->vd_uptime = ticks * NANOSECONDS_PER_TICK;
+
+	// Calibrate the TSC against the clock.  A long gap means ticks
+	// were lost while interrupts were off; don't count it.
+	if (vdso->vd_tick_tsc && !vdso->vd_tsc_per_tick)
+		vdso->vd_tsc_per_tick = delta;
+	else if (vdso->vd_tick_tsc && delta < 2 * vdso->vd_tsc_per_tick)
+		vdso->vd_tsc_per_tick = (3 * vdso->vd_tsc_per_tick + delta) / 4;
+	vdso->vd_tick_tsc = tsc;
+	vdso->vd_freepages = nfreepages;
+	vdso->vd_ncpu = ncpu;
+	for (i = 0; i < ncpu; i++) {
+		vdso->vd_cpus[i].vc_envid =
+			cpus[i].cpu_env ? cpus[i].cpu_env->env_id : 0;
+		vdso->vd_cpus[i].vc_halted = cpus[i].cpu_status == CPU_HALTED;
+	}
+
+	asm volatile("" : : : "memory");
+	vdso->vd_seq++;
+}
 
 // This should be called once per timer interrupt.  A timer interrupt
 // fires every 10 ms.
@@ -20,17 +97,55 @@ time_tick(void)
 	++ticks;
 	if (ticks > UINT64_MAX / NANOSECONDS_PER_TICK)
 		panic("time_tick: time overflowed");
+	vdso_update();
+}
+
+// Time since boot, to the last tick.
+nanoseconds_t
+time_uptime(void)
+{
+	return vdso->vd_uptime;
+}
+
+// Time since boot, carried past the last tick with the TSC.  Envs run
+// with interrupts off, so ticks only arrive while CPU 0 is idle and the
+// tick count falls behind on a busy machine; the TSC does not.  Until
+// CPU 0 has calibrated the TSC this is just time_uptime().
+nanoseconds_t
+time_now(void)
+{
+	uint64_t per_tick = vdso->vd_tsc_per_tick;
+
+	if (!per_tick)
+		return time_uptime();
+	return vdso->vd_uptime + tsc_to_ns(read_tsc() - vdso->vd_tick_tsc,
+					   per_tick);
 }
 
 int
 sysinfo(struct sysinfo *info)
 {
-	info->uptime = ticks * NANOSECONDS_PER_TICK;
+	struct ksm_stats ksm;
+	struct elfcache_stats ec;
+
+	info->uptime = time_now();
 	info->totalpages = npages;
 	info->freepages = nfreepages;
 	info->inblocks = inblocks;
 	info->outblocks = outblocks;
 	info->inpackets = inpackets;
 	info->outpackets = outpackets;
+	info->kfaults = kfaults;
+	info->kfault_cycles = kfault_cycles;
+	info->upcalls = upcalls;
+	ksm_get_stats(&ksm);
+	info->ksm_merges = ksm.merges;
+	info->ksm_unmerges = ksm.unmerges;
+	info->ksm_shared = ksm.shared;
+	info->ksm_saved = ksm.saved;
+	elfcache_get_stats(&ec);
+	info->elfcache_images = ec.images;
+	info->elfcache_pages = ec.pages;
+	info->elfcache_saved = ec.saved;
 	return 0;
 }
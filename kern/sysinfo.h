@@ -5,11 +5,16 @@
 #endif
 
 #include <inc/sysinfo.h>
+#include <inc/vdso.h>
 
 extern uint64_t inblocks, outblocks;
 extern uint64_t inpackets, outpackets;
+extern uint64_t kfaults, kfault_cycles, upcalls;
 
+void	vdso_init(void);
 void	time_tick(void);
+nanoseconds_t time_uptime(void);
+nanoseconds_t time_now(void);
 int	sysinfo(struct sysinfo *info);
 
 #endif	// !JOS_KERN_SYSINFO_H
@@ -0,0 +1,155 @@
+// Batched system calls through a ring in user memory.
+//
+// An env registers one page holding a struct sysring (sysring_setup).
+// It queues system calls there without trapping, then makes a single
+// sys_sysring_enter, which runs every queued call through syscall()
+// and posts each result to the completion ring.  The trap entry, the
+// kernel lock and the Trapframe copy are paid once per batch instead
+// of once per call.
+//
+// The kernel reaches the ring through its physical page, so it never
+// faults on it, and holds a reference while it works so that a queued
+// sys_page_unmap of the ring itself can't free it underneath us.
+// Only calls that return to the caller are allowed: anything that may
+// block, switch envs or rebuild the trap frame completes with -E_INVAL.
+
+#include <inc/assert.h>
+#include <inc/error.h>
+
+#include <kern/env.h>
+#include <kern/pmap.h>
+#include <kern/syscall.h>
+#include <kern/sysring.h>
+
+#define barrier()	asm volatile("" : : : "memory")
+
+// May 'sqe' be run from the ring?  Returns 0 if so, < 0 to fail it.
+static int
+sysring_check(const struct sysring_sqe *sqe)
+{
+	switch (sqe->se_num) {
+	case SYS_cputs:
+		// sys_cputs would destroy us on a bad string, with the
+		// ring page still held; fail just the one call instead.
+		if (user_mem_check(curenv, (const void *) sqe->se_args[0],
+				   sqe->se_args[1], PTE_U) < 0)
+			return -E_FAULT;
+		return 0;
+	case SYS_getenvid:
+	case SYS_page_alloc:
+	case SYS_page_map:
+	case SYS_page_unmap:
+	case SYS_page_copy:
+	case SYS_page_alloc_vec:
+	case SYS_page_map_vec:
+	case SYS_page_unmap_vec:
+	case SYS_env_set_status:
+	case SYS_ipc_try_send:
+	case SYS_futex_wake:
+		return 0;
+	default:
+		return -E_INVAL;
+	}
+}
+
+// Find the page behind the current env's ring, making sure writes to
+// it through the kernel mapping are seen at the env's address alone:
+// a page table still shared after fork is copied, and a copy-on-write
+// page is broken first.
+static struct PageInfo *
+sysring_page(void)
+{
+	pde_t *pgdir = curenv->env_pgdir;
+	void *va = curenv->env_sysring;
+	struct PageInfo *pp;
+	pte_t *pte;
+
+	if (pgdir_unshare(pgdir, va) < 0)
+		return NULL;
+	if (!(pp = page_lookup(pgdir, va, &pte)) || !(*pte & PTE_U))
+		return NULL;
+	if (*pte & PTE_COW) {
+		if (page_cow_break(pgdir, va) < 0)
+			return NULL;
+		pp = page_lookup(pgdir, va, &pte);
+	}
+	if (!(*pte & PTE_W))
+		return NULL;
+	return pp;
+}
+
+//
+// Register the struct sysring at 'va' for the current environment,
+// replacing any earlier one, or drop it if va is NULL.  The ring must
+// be set up (counters zero) before it is registered.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if va is not page-aligned or is above UTOP.
+//	-E_FAULT if va is not mapped writable.
+//
+int
+sysring_setup(void *va)
+{
+	static_assert(sizeof(struct sysring) <= PGSIZE);
+
+	if ((uintptr_t) va >= UTOP || PGOFF(va))
+		return -E_INVAL;
+	curenv->env_sysring = va;
+	if (va && !sysring_page()) {
+		curenv->env_sysring = NULL;
+		return -E_FAULT;
+	}
+	return 0;
+}
+
+//
+// Run the system calls queued in the current environment's ring, in
+// order, until it is empty or the completion ring is full.
+//
+// Returns the number of calls run, < 0 on error.  Errors are:
+//	-E_INVAL if no ring is registered, or its counters are corrupt.
+//	-E_FAULT if the ring is no longer mapped writable.
+//
+int
+sysring_enter(void)
+{
+	struct PageInfo *pp;
+	struct sysring *ring;
+	struct sysring_sqe sqe;
+	struct sysring_cqe *cqe;
+	int32_t r;
+	int n = 0;
+
+	if (!curenv->env_sysring)
+		return -E_INVAL;
+	if (!(pp = sysring_page()))
+		return -E_FAULT;
+	ring = page2kva(pp);
+	if (ring->sr_sq_tail - ring->sr_sq_head > SYSRING_NENTRIES
+	    || ring->sr_cq_tail - ring->sr_cq_head > SYSRING_NENTRIES)
+		return -E_INVAL;
+
+	pp->pp_ref++;
+	while (ring->sr_sq_head != ring->sr_sq_tail
+	       && ring->sr_cq_tail - ring->sr_cq_head < SYSRING_NENTRIES) {
+		// Copy the entry out: the env may be rewriting the slot
+		// from another CPU as soon as sr_sq_head moves past it.
+		sqe = ring->sr_sq[ring->sr_sq_head % SYSRING_NENTRIES];
+		barrier();
+		ring->sr_sq_head++;
+
+		if ((r = sysring_check(&sqe)) == 0)
+			r = syscall(sqe.se_num, sqe.se_args[0], sqe.se_args[1],
+				    sqe.se_args[2], sqe.se_args[3],
+				    sqe.se_args[4]);
+
+		cqe = &ring->sr_cq[ring->sr_cq_tail % SYSRING_NENTRIES];
+		cqe->ce_data = sqe.se_data;
+		cqe->ce_result = r;
+		barrier();
+		ring->sr_cq_tail++;
+		n++;
+	}
+	page_decref(pp);
+	return n;
+}
@@ -0,0 +1,12 @@
+#ifndef JOS_KERN_SYSRING_H
+#define JOS_KERN_SYSRING_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/sysring.h>
+
+int	sysring_setup(void *va);
+int	sysring_enter(void);
+
+#endif	// !JOS_KERN_SYSRING_H
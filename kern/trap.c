@@ -1,6 +1,8 @@
 #include <inc/mmu.h>
 #include <inc/x86.h>
 #include <inc/assert.h>
+#include <inc/cpuid.h>
+#include <inc/string.h>
 
 #include <kern/pmap.h>
 #include <kern/trap.h>
@@ -12,6 +14,10 @@
 #include <kern/cpu.h>
 #include <kern/spinlock.h>
 #include <kern/sysinfo.h>
+#include <kern/ksm.h>
+#include <kern/elfcache.h>
+#include <kern/usercopy.h>
+#include <kern/futex.h>
 
 static struct Taskstate ts;
 
@@ -83,6 +89,11 @@ void align();
 void mchk();
 void simderr();
 void syscallh();
+void irq_timer();
+void irq_kbd();
+void irq_serial();
+void irq_spurious();
+void sysenter_entry();
 
 void
 trap_init(void)
@@ -110,6 +121,10 @@ trap_init(void)
   SETGATE(idt[T_SIMDERR], 1, GD_KT, &simderr, 0);
   SETGATE(idt[T_SYSCALL], 1, GD_KT, &syscallh, 3);
   SETGATE(idt[T_DEFAULT], 1, GD_KT, &simderr, 3);
+  SETGATE(idt[IRQ_OFFSET + IRQ_TIMER], 0, GD_KT, &irq_timer, 0);
+  SETGATE(idt[IRQ_OFFSET + IRQ_KBD], 0, GD_KT, &irq_kbd, 0);
+  SETGATE(idt[IRQ_OFFSET + IRQ_SERIAL], 0, GD_KT, &irq_serial, 0);
+  SETGATE(idt[IRQ_OFFSET + IRQ_SPURIOUS], 0, GD_KT, &irq_spurious, 0);
 
 	// Per-CPU setup
 	trap_init_percpu();
@@ -156,6 +171,16 @@ trap_init_percpu(void)
   // bottom three bits are special; we leave them 0)
   ltr(((GD_TSS0 >> 3) + i) << 3);
 
+  // Let user code enter the kernel with sysenter: it arrives at
+  // sysenter_entry on this CPU's kernel stack.  sysenter and sysexit
+  // derive the other three segments from GD_KT, which is why GD_KD,
+  // GD_UT and GD_UD follow it in the GDT.
+  if (cpuid_sysenter()) {
+    write_msr(MSR_IA32_SYSENTER_CS, GD_KT);
+    write_msr(MSR_IA32_SYSENTER_ESP, kstacktop_i);
+    write_msr(MSR_IA32_SYSENTER_EIP, (uint32_t) sysenter_entry);
+  }
+
   // Load the IDT
   lidt(&idt_pd);
 }
@@ -211,8 +236,10 @@ trap_dispatch(struct Trapframe *tf)
 {
 	// Handle processor exceptions.
 	// LAB 3: Your code here.
-  if (tf->tf_trapno == T_PGFLT)
+  if (tf->tf_trapno == T_PGFLT) {
     page_fault_handler(tf);
+    return;
+  }
 
   if (tf->tf_trapno == T_BRKPT) {
     // handle breakpoint exercise 6
@@ -229,7 +256,8 @@ trap_dispatch(struct Trapframe *tf)
     uint32_t arg3 = tf->tf_regs.reg_ebx;
     uint32_t arg4 = tf->tf_regs.reg_edi;
     uint32_t arg5 = tf->tf_regs.reg_esi;
-    syscall(syscall_num, arg1, arg2, arg3, arg4, arg5);
+    futex_tick();
+    tf->tf_regs.reg_eax = syscall(syscall_num, arg1, arg2, arg3, arg4, arg5);
     return;
   }
 
@@ -250,7 +278,35 @@ trap_dispatch(struct Trapframe *tf)
 	// Be careful! In multiprocessors, clock interrupts are
 	// triggered on every CPU.
 	// LAB 4: Your code here.
+	if (tf->tf_trapno == IRQ_OFFSET + IRQ_TIMER) {
+		lapic_eoi();
+		if (cpunum() == 0)
+			time_tick();
+		sched_yield();
+	}
 
+	if (tf->tf_trapno == IRQ_OFFSET + IRQ_KBD) {
+		lapic_eoi();
+		kbd_intr();
+		return;
+	}
+
+	if (tf->tf_trapno == IRQ_OFFSET + IRQ_SERIAL) {
+		lapic_eoi();
+		serial_intr();
+		return;
+	}
+
+	// An env that single-steps into sysenter takes the debug trap on
+	// the first instruction of sysenter_entry, before it can clear TF.
+	// Clear it there and carry on with the system call; sysenter_trap
+	// gives it back to the env.
+	if (tf->tf_trapno == T_DEBUG && tf->tf_cs == GD_KT
+	    && tf->tf_eip == (uintptr_t) sysenter_entry) {
+		tf->tf_eflags &= ~FL_TF;
+		thiscpu->cpu_sysenter_tf = 1;
+		return;
+	}
 
 	// Unexpected trap: The user process or the kernel has a bug.
 	print_trapframe(tf);
@@ -313,6 +369,13 @@ trap(struct Trapframe *tf)
 	// Dispatch based on what type of trap occurred
 	trap_dispatch(tf);
 
+	// A kernel page fault that page_fault_handler recovered from, or
+	// the debug trap on sysenter_entry, goes straight back to the
+	// kernel code that took it (via trapret).
+	if ((tf->tf_trapno == T_PGFLT || tf->tf_trapno == T_DEBUG)
+	    && (tf->tf_cs & 3) == 0)
+		return;
+
 	// If we made it to this point, then no other environment was
 	// scheduled, so we should return to the current environment
 	// if doing so makes sense.
@@ -322,11 +385,175 @@ trap(struct Trapframe *tf)
 		sched_yield();
 }
 
+// Return to curenv with the registers in 'tf' by sysexit, which takes
+// the new EIP from EDX and ESP from ECX: the user stub treats both as
+// clobbered.  EFLAGS is restored while we are still in the kernel, so
+// this is only for an env running with IF and TF clear.
+static void __attribute__((noreturn))
+sysexit_pop_tf(struct Trapframe *tf)
+{
+	curenv->env_cpunum = cpunum();
+
+	asm volatile(
+		"\tmovl %0,%%esp\n"
+		"\tpopal\n"
+		"\tpopl %%es\n"
+		"\tpopl %%ds\n"
+		"\taddl $0x8,%%esp\n" /* skip tf_trapno and tf_errcode */
+		"\tpopl %%edx\n"      /* tf_eip */
+		"\taddl $0x4,%%esp\n" /* skip tf_cs */
+		"\tpopfl\n"
+		"\tpopl %%ecx\n"      /* tf_esp */
+		"\tsysexit\n"
+		: : "g" (tf) : "memory");
+	panic("sysexit failed");  /* mostly to placate the compiler */
+}
+
+//
+// System calls made with sysenter come here from sysenter_entry.  The
+// call runs as if it had come in through int $T_SYSCALL, and blocking,
+// switching envs or exiting work just the same: curenv->env_tf holds
+// a full trap frame, which env_run restores with iret.  The fast path
+// is a call that returns to the same env and leaves its trap frame
+// alone apart from EAX, as most do; that env goes back by sysexit.
+//
+void
+sysenter_trap(struct Trapframe *tf)
+{
+	extern char *panicstr;
+	struct Trapframe entry;
+	uint32_t eip;
+	int32_t r;
+
+	asm volatile("cld" ::: "cc");
+	if (panicstr)
+		asm volatile("hlt");
+	assert(!(read_eflags() & FL_IF));
+
+	// A single-stepping env had TF cleared on the way in (see
+	// trap_dispatch).  Put it back, which also sends the env home by
+	// iret rather than sysexit.
+	if (thiscpu->cpu_sysenter_tf) {
+		tf->tf_eflags |= FL_TF;
+		thiscpu->cpu_sysenter_tf = 0;
+	}
+
+	lock_kernel();
+	assert(curenv);
+	if (curenv->env_status == ENV_DYING) {
+		env_free(curenv);
+		curenv = NULL;
+		sched_yield();
+	}
+
+	// sysenter keeps neither the user EIP nor IF.  The stub left the
+	// EIP on top of its stack; IF is as it was when the env last
+	// entered the kernel, since user code can't change it.
+	if (copyin(&eip, (const void *) tf->tf_esp, sizeof(eip)) < 0) {
+		cprintf("[%08x] bad sysenter stack %08x\n",
+			curenv->env_id, tf->tf_esp);
+		env_destroy(curenv);
+	}
+	tf->tf_eip = eip;
+	tf->tf_eflags |= curenv->env_tf.tf_eflags & FL_IF;
+
+	curenv->env_tf = *tf;
+	tf = &curenv->env_tf;
+	last_tf = tf;
+	entry = *tf;
+
+	futex_tick();
+	r = syscall(tf->tf_regs.reg_eax, tf->tf_regs.reg_edx,
+		    tf->tf_regs.reg_ecx, tf->tf_regs.reg_ebx,
+		    tf->tf_regs.reg_edi, tf->tf_regs.reg_esi);
+	tf->tf_regs.reg_eax = r;
+
+	if (!curenv || curenv->env_status != ENV_RUNNING)
+		sched_yield();
+	entry.tf_regs.reg_eax = r;
+	if (memcmp(&entry, tf, sizeof(entry)) != 0
+	    || (tf->tf_eflags & (FL_IF | FL_TF)))
+		env_run(curenv);
+
+	curenv->env_runs++;
+	unlock_kernel();
+	sysexit_pop_tf(tf);
+}
+
+
+// Resolve a user write to 'va' that hit copy-on-write memory: a page
+// table still shared after fork, a merged page, the zero page, or a
+// page fork made copy-on-write.  Once a shared page table is copied
+// the write is retried, and may fault again on a copy-on-write page.
+// Returns 0 if the fault was resolved, < 0 if it is the env's problem.
+static int
+page_fault_cow(uintptr_t va)
+{
+	if (curenv->env_pgdir[PDX(va)] & PTE_COW)
+		return pgdir_unshare(curenv->env_pgdir, (void *) va);
+	if (ksm_fault(curenv, va) == 0)
+		return 0;
+	return page_cow_break(curenv->env_pgdir, (void *) va);
+}
+
+// Score the pages fault_around() resolved after e's last fault: a page
+// whose dirty bit is now set was worth it.  Grow the window if at
+// least half were written, otherwise shrink it.
+static void
+fault_around_adapt(struct Env *e)
+{
+	uint32_t i, hits = 0;
+	pte_t *pte;
+
+	if (!e->env_nprefault)
+		return;
+	for (i = 0; i < e->env_nprefault; i++) {
+		pte = pgdir_walk(e->env_pgdir,
+				 (void *) (e->env_prefault_va + i * PGSIZE), 0);
+		if (pte && (*pte & (PTE_P | PTE_D)) == (PTE_P | PTE_D))
+			hits++;
+	}
+	e->env_prefault_hits += hits;
+	if (2 * hits >= e->env_nprefault)
+		e->env_fault_around = MIN(2 * e->env_fault_around,
+					  FAULT_AROUND_MAX);
+	else
+		e->env_fault_around = MAX(e->env_fault_around / 2, 1);
+	e->env_nprefault = 0;
+}
+
+// After a copy-on-write fault at 'va', resolve up to env_fault_around
+// of the following pages in the same page table, as long as they are
+// copy-on-write too.  Streaming writers then take one fault per window
+// instead of one per page.  Merged pages are left alone.
+static void
+fault_around(struct Env *e, uintptr_t va)
+{
+	struct PageInfo *pp;
+	pte_t *pte;
+	uintptr_t end;
+
+	va = ROUNDDOWN(va, PGSIZE) + PGSIZE;
+	end = MIN(va + e->env_fault_around * PGSIZE,
+		  ROUNDDOWN(va - PGSIZE, PTSIZE) + PTSIZE);
+	e->env_prefault_va = va;
+	for (; va < end && va < UTOP; va += PGSIZE) {
+		pp = page_lookup(e->env_pgdir, (void *) va, &pte);
+		if (!pp || !(*pte & PTE_COW) || (pp->pp_flags & PP_KSM)
+		    || page_cow_break(e->env_pgdir, (void *) va) < 0)
+			break;
+		e->env_nprefault++;
+		e->env_prefaults++;
+	}
+}
 
 void
 page_fault_handler(struct Trapframe *tf)
 {
 	uint32_t fault_va;
+	uintptr_t fixup;
+	uint64_t start;
+	bool shared;
 
 	// Read processor's CR2 register to find the faulting address
 	fault_va = rcr2();
@@ -334,10 +561,64 @@ page_fault_handler(struct Trapframe *tf)
 	// Handle kernel-mode page faults.
 
 	// LAB 3: Your code here.
-  // if (tf->tf_cs & GD_KT) panic("page fault in kernel mode"); TODO
+	// copyin/copyout fault on user memory on purpose.  Load pages of the
+	// env's binary, grow its stack and resolve copy-on-write faults as
+	// if the env had made the access, and send any other fault to the
+	// copy's fixup code.
+	if ((tf->tf_cs & 3) == 0) {
+		fixup = curenv ? extable_fixup(tf->tf_eip) : 0;
+		if (!fixup)
+			panic("kernel page fault va %08x ip %08x",
+			      fault_va, tf->tf_eip);
+		if (!(tf->tf_err & FEC_PR)
+		    && (elfcache_fault(curenv, fault_va) == 0
+			|| env_stack_grow(curenv, fault_va) == 0))
+			return;
+		if ((tf->tf_err & FEC_WR) && fault_va < UTOP
+		    && page_fault_cow(fault_va) == 0)
+			return;
+		usercopy_fault_va = fault_va;
+		tf->tf_eip = fixup;
+		return;
+	}
+
 	// We've already handled kernel-mode exceptions, so if we get here,
 	// the page fault happened in user mode.
 
+	// Pages of the env's binary are loaded and the stack grows on first
+	// touch, and writes to copy-on-write memory are resolved right here,
+	// without a round trip through the env's own handler.
+	start = read_tsc();
+	curenv->env_faults++;
+	fault_around_adapt(curenv);
+	if (!(tf->tf_err & FEC_PR)
+	    && (elfcache_fault(curenv, fault_va) == 0
+		|| env_stack_grow(curenv, fault_va) == 0)) {
+		kfaults++;
+		kfault_cycles += read_tsc() - start;
+		return;
+	}
+	// Only a missing page counts as a guard hit: a limit lowered by
+	// sys_env_set_stack_limit can leave pages mapped in the guard
+	// slot, and protection faults on them (copy-on-write after fork)
+	// must be resolved as usual.
+	if (!(tf->tf_err & FEC_PR) && env_stack_guard(curenv, fault_va)) {
+		cprintf("[%08x] user stack overflow va %08x ip %08x\n",
+			curenv->env_id, fault_va, tf->tf_eip);
+		env_destroy(curenv);
+		return;
+	}
+	shared = fault_va < UTOP && (curenv->env_pgdir[PDX(fault_va)] & PTE_COW);
+	if ((tf->tf_err & FEC_WR) && fault_va < UTOP
+	    && page_fault_cow(fault_va) == 0) {
+		// A fault that only unshared a page table will be retried.
+		if (!shared)
+			fault_around(curenv, fault_va);
+		kfaults++;
+		kfault_cycles += read_tsc() - start;
+		return;
+	}
+
 	// Call the environment's page fault upcall, if one exists.  Set up a
 	// page fault stack frame on the user exception stack (below
 	// UXSTACKTOP), then branch to curenv->env_pgfault_upcall.
@@ -367,6 +648,35 @@ page_fault_handler(struct Trapframe *tf)
 	//   (the 'tf' variable points at 'curenv->env_tf').
 
 	// LAB 4: Your code here.
+	if (curenv->env_pgfault_upcall) {
+		struct UTrapframe utf;
+		uintptr_t top;
+
+		if (tf->tf_esp >= UXSTACKTOP - PGSIZE && tf->tf_esp < UXSTACKTOP)
+			top = tf->tf_esp - 4;
+		else
+			top = UXSTACKTOP;
+		if (top - sizeof(utf) < UXSTACKTOP - PGSIZE) {
+			cprintf("[%08x] user exception stack overflow\n",
+				curenv->env_id);
+			env_destroy(curenv);
+			return;
+		}
+
+		utf.utf_fault_va = fault_va;
+		utf.utf_err = tf->tf_err;
+		utf.utf_regs = tf->tf_regs;
+		utf.utf_eip = tf->tf_eip;
+		utf.utf_eflags = tf->tf_eflags;
+		utf.utf_esp = tf->tf_esp;
+		if (copyout((void *) (top - sizeof(utf)), &utf, sizeof(utf)) < 0)
+			user_mem_fault(curenv, usercopy_fault_va);
+
+		tf->tf_eip = (uintptr_t) curenv->env_pgfault_upcall;
+		tf->tf_esp = top - sizeof(utf);
+		upcalls++;
+		env_run(curenv);
+	}
 
 	// Destroy the environment that caused the fault.
 	cprintf("[%08x] user fault va %08x ip %08x\n",
@@ -0,0 +1,106 @@
+// Copying between the kernel and user memory.
+//
+// copyin and copyout touch user memory directly instead of walking
+// the page tables first.  A fault in the copy is caught by
+// page_fault_handler, which looks the faulting instruction up in the
+// exception table (kern/extable.S) and resumes at its fixup code, so
+// the copy returns -E_FAULT.  Copy-on-write faults are resolved on the
+// way, as if the env had made the access itself.
+
+#include <inc/error.h>
+#include <inc/memlayout.h>
+#include <inc/string.h>
+
+#include <kern/usercopy.h>
+
+extern const struct extable_entry extable[], extable_end[];
+
+int usercopy(void *dst, const void *src, size_t len);
+
+uintptr_t usercopy_fault_va;
+
+// Is [va, va+len) a user range of at most 'limit'?
+static bool
+user_range_ok(const void *va, size_t len, uintptr_t limit)
+{
+	uintptr_t start = (uintptr_t) va;
+
+	if (start + len < start || start + len > limit) {
+		usercopy_fault_va = start;
+		return 0;
+	}
+	return 1;
+}
+
+//
+// Copy 'len' bytes from user address 'usrc' into the kernel at 'dst'.
+// The current env's address space must be loaded.
+// Returns 0 on success, -E_FAULT if any of the source is not readable
+// by the user (usercopy_fault_va says where).
+// The copy runs in supervisor mode, so it could read what the user
+// can't.  Below ULIM that is only the page table entries for kernel
+// memory, at the end of the UVPT window: the source must end below
+// UVPT.  No system call needs to read from the window.
+//
+int
+copyin(void *dst, const void *usrc, size_t len)
+{
+	if (!user_range_ok(usrc, len, UVPT) || usercopy(dst, usrc, len))
+		return -E_FAULT;
+	return 0;
+}
+
+//
+// Copy the NUL-terminated string at user address 'usrc' into 'dst',
+// which has room for 'size' bytes including the NUL.  The string is
+// read a page at a time, so a string ending just before an unmapped
+// page is fine.
+// Returns the length of the string, -E_FAULT if it is not readable,
+// or -E_INVAL if it does not fit.
+//
+int
+copyinstr(char *dst, const char *usrc, size_t size)
+{
+	size_t len = 0, n;
+	char *nul;
+
+	while (len < size) {
+		n = MIN(size - len, PGSIZE - PGOFF(usrc + len));
+		if (copyin(dst + len, usrc + len, n) < 0)
+			return -E_FAULT;
+		nul = memfind(dst + len, 0, n);
+		if (nul < dst + len + n)
+			return nul - dst;
+		len += n;
+	}
+	return -E_INVAL;
+}
+
+//
+// Copy 'len' bytes from the kernel at 'src' to user address 'udst'.
+// The current env's address space must be loaded.
+// Returns 0 on success, -E_FAULT if any of the destination is not
+// writable by the user (usercopy_fault_va says where).
+//
+int
+copyout(void *udst, const void *src, size_t len)
+{
+	if (!user_range_ok(udst, len, UTOP) || usercopy(udst, src, len))
+		return -E_FAULT;
+	return 0;
+}
+
+//
+// Return the fixup address for a fault at kernel address 'eip', or 0
+// if 'eip' is not in the exception table.
+//
+uintptr_t
+extable_fixup(uintptr_t eip)
+{
+	const struct extable_entry *ex;
+
+	for (ex = extable; ex < extable_end; ex++)
+		if (ex->insn == eip)
+			return ex->fixup;
+	return 0;
+}
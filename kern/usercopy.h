@@ -0,0 +1,24 @@
+#ifndef JOS_KERN_USERCOPY_H
+#define JOS_KERN_USERCOPY_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+
+// An entry in the kernel exception table: if the instruction at 'insn'
+// faults on a user address, execution continues at 'fixup' instead.
+struct extable_entry {
+	uintptr_t insn;
+	uintptr_t fixup;
+};
+
+// The user address that made the last copyin/copyout fail.
+extern uintptr_t usercopy_fault_va;
+
+int	copyin(void *dst, const void *usrc, size_t len);
+int	copyinstr(char *dst, const char *usrc, size_t size);
+int	copyout(void *udst, const void *src, size_t len);
+uintptr_t extable_fixup(uintptr_t eip);
+
+#endif	// !JOS_KERN_USERCOPY_H
@@ -3,13 +3,11 @@
 #include <inc/string.h>
 #include <inc/lib.h>
 
-// PTE_COW marks copy-on-write page table entries.
-// It is one of the bits explicitly allocated to user processes (PTE_AVAIL).
-#define PTE_COW		0x800
-
 //
 // Custom page fault handler - if faulting page is copy-on-write,
 // map in our own private writable copy.
+// The kernel normally resolves these faults itself (page_fault_cow in
+// kern/trap.c); we only get here if it ran out of memory doing so.
 //
 static void
 pgfault(struct UTrapframe *utf)
@@ -25,37 +23,52 @@ pgfault(struct UTrapframe *utf)
 	//   (see <inc/memlayout.h>).
 
 	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+	    || !(uvpt[PGNUM(addr)] & PTE_COW))
+		panic("pgfault: va %08x err %x is not a copy-on-write write",
+		      addr, err);
 
-	// Allocate a new page, map it at a temporary location (PFTEMP),
-	// copy the data from the old page to the new page, then move the new
-	// page to the old page's address.
-	// Hint:
-	//   You should make three system calls.
+	// Replace the page with a private writable copy of itself.  The
+	// kernel allocates, copies and maps it in one system call, so no
+	// temporary mapping at PFTEMP is needed.
 
 	// LAB 4: Your code here.
-
-	panic("pgfault not implemented");
+	addr = ROUNDDOWN(addr, PGSIZE);
+	if ((r = sys_page_copy(0, addr, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+		panic("pgfault: sys_page_copy: %e", r);
 }
 
 //
-// Map our virtual page pn (address pn*PGSIZE) into the target envid
-// at the same virtual address.  If the page is writable or copy-on-write,
-// the new mapping must be created copy-on-write, and then our mapping must be
-// marked copy-on-write as well.  (Exercise: Why do we need to mark ours
-// copy-on-write again if it was already copy-on-write at the beginning of
-// this function?)
+// Map the 'n' runs of our pages in 'vec' (as returned by sys_vm_ranges)
+// into the target envid at the same virtual addresses.  Shared pages
+// keep their permissions and read-only pages stay read-only.  Writable
+// or copy-on-write pages are mapped copy-on-write in the child, and
+// then our mappings are marked copy-on-write as well.  (Exercise: Why
+// do we need to mark ours copy-on-write again if it was already
+// copy-on-write at the beginning of this function?)
 //
 // Returns: 0 on success, < 0 on error.
-// It is also OK to panic on error.
 //
 static int
-duppage(envid_t envid, unsigned pn)
+duppages(envid_t envid, struct page_range *vec, size_t n)
 {
+	struct page_range cow[PAGE_VEC_MAX];
+	size_t i, ncow = 0;
 	int r;
 
 	// LAB 4: Your code here.
-	panic("duppage not implemented");
-	return 0;
+	for (i = 0; i < n; i++) {
+		vec[i].pr_dstva = vec[i].pr_va;
+		if (vec[i].pr_perm & PTE_SHARE)
+			continue;
+		if (vec[i].pr_perm & (PTE_W | PTE_COW)) {
+			vec[i].pr_perm = (vec[i].pr_perm & ~PTE_W) | PTE_COW;
+			cow[ncow++] = vec[i];
+		}
+	}
+	if ((r = sys_page_map_vec(0, envid, vec, n, 0)) < 0)
+		return r;
+	return sys_page_map_vec(0, 0, cow, ncow, 0);
 }
 
 //
@@ -69,16 +82,76 @@ duppage(envid_t envid, unsigned pn)
 // It is also OK to panic on error.
 //
 // Hint:
-//   Use uvpd, uvpt, and duppage.
+//   Use sys_vm_ranges and duppages.
 //   Remember to fix "thisenv" in the child process.
 //   Neither user exception stack should ever be marked copy-on-write,
 //   so you must allocate a new page for the child's user exception stack.
 //
 envid_t
-fork(void)
+ufork(void)
 {
 	// LAB 4: Your code here.
-	panic("fork not implemented");
+	envid_t envid;
+	struct page_range vec[PAGE_VEC_MAX], *last;
+	uintptr_t va;
+	size_t n;
+	int r;
+
+	set_pgfault_handler(pgfault);
+
+	envid = sys_exofork();
+	if (envid < 0)
+		return envid;
+	if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	// Copy every run of mapped pages below the exception stack, which
+	// must not be shared.
+	va = 0;
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+		n = r;
+		last = &vec[n - 1];
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+			n--;
+		if ((r = duppages(envid, vec, n)) < 0)
+			goto fail;
+	}
+	if (r < 0)
+		goto fail;
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE),
+				PTE_P | PTE_U | PTE_W)) < 0
+	    || (r = sys_env_set_pgfault_upcall(envid,
+			thisenv->env_pgfault_upcall)) < 0
+	    || (r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+		goto fail;
+	return envid;
+
+fail:
+	sys_env_destroy(envid);
+	return r;
+}
+
+//
+// Fork with copy-on-write, letting the kernel copy the address space
+// in a single system call (see sys_fork in kern/syscall.c).  The
+// kernel also resolves the copy-on-write faults afterwards, so no
+// page fault handler is needed.
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+	envid_t envid;
+
+	envid = sys_fork();
+	if (envid == 0)
+		thisenv = &envs[ENVX(sys_getenvid())];
+	return envid;
 }
 
 // Challenge!
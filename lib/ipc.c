@@ -23,23 +23,146 @@ int32_t
 ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
 {
 	// LAB 4: Your code here.
-	panic("ipc_recv not implemented");
-	return 0;
+	int r;
+
+	if ((r = sys_ipc_recv(pg ? pg : (void *) UTOP)) < 0) {
+		if (from_env_store)
+			*from_env_store = 0;
+		if (perm_store)
+			*perm_store = 0;
+		return r;
+	}
+	if (from_env_store)
+		*from_env_store = thisenv->env_ipc_from;
+	if (perm_store)
+		*perm_store = thisenv->env_ipc_perm;
+	return thisenv->env_ipc_msg.m_w[0];
 }
 
 // Send 'val' (and 'pg' with 'perm', if 'pg' is nonnull) to 'toenv'.
 // This function keeps trying until it succeeds.
-// It should panic() on any error other than -E_IPC_NOT_RECV.
+// It should panic() on any error other than -E_AGAIN.
 //
-// Hint:
-//   Use sys_yield() to be CPU-friendly.
-//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
-//   as meaning "no page".  (Zero is not the right value.)
+// The kernel queues us behind any other senders until 'toenv'
+// receives, so we only come back to retry if its queue was full.
 void
 ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
 {
 	// LAB 4: Your code here.
-	panic("ipc_send not implemented");
+	int r;
+
+	while ((r = sys_ipc_send(to_env, val, pg ? pg : (void *) UTOP, perm))
+	       == -E_AGAIN)
+		sys_yield();
+	if (r < 0)
+		panic("ipc_send: %e", r);
+}
+
+// Like ipc_send, but send the 'npages' contiguous pages at 'pg' in one
+// message.  The receiver maps as many as fit in its window.
+void
+ipc_send_range(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+	int r;
+
+	while ((r = sys_ipc_send_range(to_env, val, pg, npages, perm))
+	       == -E_AGAIN)
+		sys_yield();
+	if (r < 0)
+		panic("ipc_send_range: %e", r);
+}
+
+// Like ipc_recv, but accept up to *npages pages into the window at 'pg'
+// (which must not be null).  On return *npages holds the number of
+// pages received, which is 0 on error or if the sender sent none.
+int32_t
+ipc_recv_range(envid_t *from_env_store, void *pg, size_t *npages,
+	       int *perm_store)
+{
+	int r;
+
+	if ((r = sys_ipc_recv_range(pg, *npages)) < 0) {
+		if (from_env_store)
+			*from_env_store = 0;
+		if (perm_store)
+			*perm_store = 0;
+		*npages = 0;
+		return r;
+	}
+	if (from_env_store)
+		*from_env_store = thisenv->env_ipc_from;
+	if (perm_store)
+		*perm_store = thisenv->env_ipc_perm;
+	*npages = thisenv->env_ipc_npages;
+	return thisenv->env_ipc_msg.m_w[0];
+}
+
+// Send the IPC_MSG_WORDS words of 'msg' to 'to_env', in registers and
+// without a page.  Waits like ipc_send until 'to_env' takes them, and
+// panics on any error other than -E_AGAIN.
+void
+ipc_send_msg(envid_t to_env, const struct ipc_msg *msg)
+{
+	int r;
+
+	while ((r = sys_ipc_send_msg(to_env, msg)) == -E_AGAIN)
+		sys_yield();
+	if (r < 0)
+		panic("ipc_send_msg: %e", r);
+}
+
+// Receive a message into *msg.  Whether it was sent with ipc_send_msg,
+// ipc_call or plain ipc_send (whose value is word 0, and whose page is
+// not taken), it arrives in registers and needs no page.
+// Returns the sender's envid, < 0 on error.
+envid_t
+ipc_recv_msg(struct ipc_msg *msg)
+{
+	return sys_ipc_reply_wait(0, msg);
+}
+
+// Send 'msg' to 'to_env' and wait for its answer, which replaces *msg.
+// The kernel switches straight to 'to_env' if it is waiting in
+// ipc_reply_wait (or ipc_recv), and straight back when it replies.
+// Retries while to_env's queue is full.
+// Returns 0 on success, < 0 on error.
+int
+ipc_call(envid_t to_env, struct ipc_msg *msg)
+{
+	int r;
+
+	while ((r = sys_ipc_call(to_env, msg)) == -E_AGAIN)
+		sys_yield();
+	return r;
+}
+
+// Answer the ipc_call of 'to_env' with *msg, unless 'to_env' is 0, and
+// wait for the next message, which replaces *msg.  A server runs its
+// loop on this one call:
+//
+//	who = ipc_reply_wait(0, &msg);
+//	for (;;) {
+//		serve(&msg);
+//		who = ipc_reply_wait(who, &msg);
+//	}
+//
+// Returns the envid of the sender, < 0 on error.
+envid_t
+ipc_reply_wait(envid_t to_env, struct ipc_msg *msg)
+{
+	return sys_ipc_reply_wait(to_env, msg);
+}
+
+// Send 'msg' to endpoint 'epid', waiting while its queue is full.
+// Returns 0 on success, < 0 if the endpoint is gone or not ours to use.
+int
+ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+	int r;
+
+	while ((r = sys_ep_send(epid, msg)) == -E_AGAIN)
+		sys_yield();
+	return r;
 }
 
 // Find the first environment of the given type.  We'll use this to
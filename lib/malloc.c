@@ -27,24 +27,48 @@ static uint8_t *mend   = (uint8_t*) 0x10000000;
 static uint8_t *mptr;
 
 static int
-isfree(void *v, size_t n)
+ismapped(uintptr_t va)
 {
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+}
+
+/*
+ * is [v, v+n) free address space?  if not, return where to look
+ * next.  the page tables answer that for free; a single mapped page
+ * in the way is simply stepped over, and only a longer run costs a
+ * sys_vm_ranges call, which skips all of it at once.
+ */
+static uint8_t*
+next_free(void *v, size_t n)
+{
+	struct page_range r;
 	uintptr_t va, end_va = (uintptr_t) v + n;
 
-	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
-		if (va >= (uintptr_t) mend
-		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
-			return 0;
-	return 1;
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE) {
+		if (va >= (uintptr_t) mend)
+			return mend;
+		if (ismapped(va))
+			break;
+	}
+	if (va >= end_va)
+		return 0;
+	va += PGSIZE;
+	if (va >= (uintptr_t) mend || !ismapped(va)
+	    || sys_vm_ranges(0, (void*) va, &r, 1) <= 0)
+		return (uint8_t*) va;
+	return (uint8_t*) r.pr_va + r.pr_npages * PGSIZE;
 }
 
 void*
 malloc(size_t n)
 {
-	int i, cont;
+	int i;
 	int nwrap;
 	uint32_t *ref;
 	void *v;
+	uint8_t *next;
+	struct page_range vec[2];
+	size_t npages, done;
 
 	if (mptr == 0)
 		mptr = mbegin;
@@ -82,10 +106,10 @@ malloc(size_t n)
 	 */
 	nwrap = 0;
 	while (1) {
-		if (isfree(mptr, n + 4))
+		if (!(next = next_free(mptr, n + 4)))
 			break;
-		mptr += PGSIZE;
-		if (mptr == mend) {
+		mptr = next;
+		if (mptr >= mend) {
 			mptr = mbegin;
 			if (++nwrap == 2)
 				return 0;	/* out of address space */
@@ -94,15 +118,22 @@ malloc(size_t n)
 
 	/*
 	 * allocate at mptr - the +4 makes sure we allocate a ref count.
+	 * every page but the last is PTE_CONTINUED; map them all in
+	 * one system call.
 	 */
-	for (i = 0; i < n + 4; i += PGSIZE){
-		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
-		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
-			for (; i >= 0; i -= PGSIZE)
-				sys_page_unmap(0, mptr + i);
-			return 0;	/* out of physical memory */
-		}
+	npages = ROUNDUP(n + 4, PGSIZE) / PGSIZE;
+	vec[0].pr_va = mptr;
+	vec[0].pr_npages = npages - 1;
+	vec[0].pr_perm = PTE_P|PTE_U|PTE_W|PTE_CONTINUED|PAGE_ZERO_FILL;
+	vec[1].pr_va = mptr + (npages - 1) * PGSIZE;
+	vec[1].pr_npages = 1;
+	vec[1].pr_perm = PTE_P|PTE_U|PTE_W|PAGE_ZERO_FILL;
+	if (sys_page_alloc_vec(0, vec, 2, &done) < 0) {
+		vec[0].pr_npages = done;
+		sys_page_unmap_vec(0, vec, 1, 0);
+		return 0;	/* out of physical memory */
 	}
+	i = npages * PGSIZE;
 
 	ref = (uint32_t*) (mptr + i - 4);
 	*ref = 2;	/* reference for mptr, reference for returned block */
@@ -118,6 +149,7 @@ free(void *v)
 {
 	uint8_t *c;
 	uint32_t *ref;
+	struct page_range range;
 
 	if (v == 0)
 		return;
@@ -125,11 +157,15 @@ free(void *v)
 
 	c = ROUNDDOWN(v, PGSIZE);
 
+	range.pr_va = c;
+	range.pr_npages = 0;
 	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
-		sys_page_unmap(0, c);
+		range.pr_npages++;
 		c += PGSIZE;
 		assert(mbegin <= c && c < mend);
 	}
+	if (range.pr_npages)
+		sys_page_unmap_vec(0, &range, 1, 0);
 
 	/*
 	 * c is just a piece of this page, so dec the ref count
@@ -0,0 +1,91 @@
+// Mutexes and condition variables on top of sys_futex_wait and
+// sys_futex_wake.
+//
+// The mutex is the three-state lock from Drepper's "Futexes Are
+// Tricky": a free lock is taken with one compare-and-swap, and the
+// holder only calls into the kernel on unlock if the state says
+// someone may be sleeping.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+mutex_init(struct mutex *m)
+{
+	m->m_state = 0;
+}
+
+// Take 'm' the slow way: mark it contended and sleep until it is
+// free.  Used whenever other envs might be sleeping on it.
+static void
+mutex_lock_contended(struct mutex *m)
+{
+	while (xchg(&m->m_state, 2) != 0)
+		sys_futex_wait(&m->m_state, 2, 0);
+}
+
+void
+mutex_lock(struct mutex *m)
+{
+	if (__sync_val_compare_and_swap(&m->m_state, 0, 1) != 0)
+		mutex_lock_contended(m);
+}
+
+// Take 'm' if it is free.  Returns whether we got it.
+bool
+mutex_trylock(struct mutex *m)
+{
+	return __sync_val_compare_and_swap(&m->m_state, 0, 1) == 0;
+}
+
+void
+mutex_unlock(struct mutex *m)
+{
+	if (__sync_fetch_and_sub(&m->m_state, 1) != 1) {
+		m->m_state = 0;
+		sys_futex_wake(&m->m_state, 1);
+	}
+}
+
+void
+cond_init(struct cond *c)
+{
+	c->c_seq = 0;
+}
+
+// Release 'm', sleep until 'c' is signalled, and take 'm' again.  As
+// with any condition variable, the caller re-checks its condition.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+	cond_timedwait(c, m, 0);
+}
+
+// Like cond_wait, but give up after 'timeout' nanoseconds (0 means
+// never).  Returns 0, or -E_TIMEOUT if the time ran out.
+int
+cond_timedwait(struct cond *c, struct mutex *m, nanoseconds_t timeout)
+{
+	uint32_t seq = c->c_seq;
+	int r;
+
+	mutex_unlock(m);
+	r = sys_futex_wait(&c->c_seq, seq, timeout);
+	// Others woken with us may be asleep on the mutex by now.
+	mutex_lock_contended(m);
+	return r == -E_TIMEOUT ? r : 0;
+}
+
+void
+cond_signal(struct cond *c)
+{
+	__sync_fetch_and_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+}
+
+void
+cond_broadcast(struct cond *c)
+{
+	__sync_fetch_and_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, INT_MAX);
+}
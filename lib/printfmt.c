@@ -28,6 +28,11 @@ static const char * const error_string[MAXERROR] =
 	[E_FAULT]	= "segmentation fault",
 	[E_IPC_NOT_RECV]= "env is not recving",
 	[E_EOF]		= "unexpected end of file",
+	[E_NOT_EXEC]	= "file is not a valid executable",
+	[E_NOT_FOUND]	= "not found",
+	[E_EXISTS]	= "already exists",
+	[E_AGAIN]	= "resource temporarily unavailable",
+	[E_TIMEOUT]	= "timed out",
 };
 
 /*
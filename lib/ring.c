@@ -0,0 +1,84 @@
+// Single-producer, single-consumer rings in shared memory.
+//
+// x86 does not reorder stores with other stores or loads with other
+// loads, so compiler barriers are enough: the producer fills a slot
+// before it publishes the new head, and the consumer copies a slot out
+// before it gives the slot back by advancing the tail.
+
+#include <inc/lib.h>
+
+#define barrier()	asm volatile("" : : : "memory")
+
+//
+// Set up a ring in the 'size' bytes at 'r', for messages of 'msgsize'
+// bytes.  Only one side should do this, before the other uses it.
+// Returns the number of slots, or -E_INVAL if not even one fits.
+//
+int
+ring_init(struct ring *r, size_t size, size_t msgsize)
+{
+	uint32_t nslots = 1;
+
+	if (msgsize == 0 || size < sizeof(*r) + msgsize)
+		return -E_INVAL;
+	while (2 * nslots * msgsize <= size - sizeof(*r))
+		nslots *= 2;
+	r->r_head = r->r_tail = 0;
+	r->r_nslots = nslots;
+	r->r_msgsize = msgsize;
+	return nslots;
+}
+
+//
+// Add a copy of the message at 'msg' to the ring.
+// Returns 1 on success, 0 if the ring is full.
+//
+bool
+ring_put(struct ring *r, const void *msg)
+{
+	uint32_t head = r->r_head;
+
+	if (head - r->r_tail == r->r_nslots)
+		return 0;
+	barrier();
+	memcpy(r->r_data + (head & (r->r_nslots - 1)) * r->r_msgsize, msg,
+	       r->r_msgsize);
+	barrier();
+	r->r_head = head + 1;
+	return 1;
+}
+
+//
+// Take the oldest message off the ring, copying it to 'msg'.
+// Returns 1 on success, 0 if the ring is empty.
+//
+bool
+ring_get(struct ring *r, void *msg)
+{
+	uint32_t tail = r->r_tail;
+
+	if (r->r_head == tail)
+		return 0;
+	barrier();
+	memcpy(msg, r->r_data + (tail & (r->r_nslots - 1)) * r->r_msgsize,
+	       r->r_msgsize);
+	barrier();
+	r->r_tail = tail + 1;
+	return 1;
+}
+
+// Blocking forms: yield the CPU until there is room or a message.
+
+void
+ring_send(struct ring *r, const void *msg)
+{
+	while (!ring_put(r, msg))
+		sys_yield();
+}
+
+void
+ring_recv(struct ring *r, void *msg)
+{
+	while (!ring_get(r, msg))
+		sys_yield();
+}
@@ -0,0 +1,158 @@
+// Start a new environment running an ELF image held in memory.
+
+#include <inc/elf.h>
+#include <inc/lib.h>
+
+// Where the stack page is put together before it goes to the child.
+#define UTEMP2USTACK(addr)	((void *) (addr) + (USTACKTOP - PGSIZE) - UTEMP)
+
+//
+// Spawn a child running the ELF image of 'size' bytes at 'binary',
+// with the NULL-terminated arguments 'argv'.  The kernel builds the
+// whole child in one system call (sys_spawn).
+//
+// Returns the child's envid on success, < 0 on failure.
+//
+envid_t
+spawn(const void *binary, size_t size, const char **argv)
+{
+	return sys_spawn(binary, size, argv);
+}
+
+//
+// Lay out 'argv' on a stack page for 'child', as lib/entry.S expects,
+// and map it at USTACKTOP - PGSIZE there.  Sets *esp to the child's
+// initial stack pointer.
+//
+static int
+init_stack(envid_t child, const char **argv, uintptr_t *esp)
+{
+	size_t string_size = 0;
+	int argc, i, r;
+	char *string_store;
+	uintptr_t *argv_store;
+
+	for (argc = 0; argv && argv[argc]; argc++)
+		string_size += strlen(argv[argc]) + 1;
+
+	string_store = (char *) UTEMP + PGSIZE - string_size;
+	argv_store = (uintptr_t *) (ROUNDDOWN((uintptr_t) string_store, 4)
+				    - 4 * (argc + 1));
+	if ((void *) (argv_store - 2) < (void *) UTEMP)
+		return -E_INVAL;
+
+	if ((r = sys_page_alloc(0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+		return r;
+
+	for (i = 0; i < argc; i++) {
+		argv_store[i] = (uintptr_t) UTEMP2USTACK(string_store);
+		strcpy(string_store, argv[i]);
+		string_store += strlen(argv[i]) + 1;
+	}
+	argv_store[argc] = 0;
+	argv_store[-1] = (uintptr_t) UTEMP2USTACK(argv_store);
+	argv_store[-2] = argc;
+	*esp = (uintptr_t) UTEMP2USTACK(&argv_store[-2]);
+
+	if ((r = sys_page_map(0, UTEMP, child, (void *) (USTACKTOP - PGSIZE),
+			      PTE_P | PTE_U | PTE_W)) < 0)
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+		goto error;
+	return 0;
+
+error:
+	sys_page_unmap(0, UTEMP);
+	return r;
+}
+
+//
+// Copy one loadable segment into 'child' a page at a time, through a
+// page allocated and filled at UTEMP.  Pages past the file data are
+// allocated zeroed directly in the child.
+//
+static int
+map_segment(envid_t child, const struct Proghdr *ph, const uint8_t *data)
+{
+	uintptr_t va, start, end;
+	uintptr_t data_end = ph->p_va + ph->p_filesz;
+	int r;
+
+	for (va = ROUNDDOWN(ph->p_va, PGSIZE); va < ph->p_va + ph->p_memsz;
+	     va += PGSIZE) {
+		if (va >= data_end) {
+			if ((r = sys_page_alloc(child, (void *) va,
+						PTE_P | PTE_U | PTE_W)) < 0)
+				return r;
+			continue;
+		}
+		if ((r = sys_page_alloc(0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+			return r;
+		start = MAX(va, ph->p_va);
+		end = MIN(va + PGSIZE, data_end);
+		memmove(UTEMP + PGOFF(start), data + (start - ph->p_va),
+			end - start);
+		if ((r = sys_page_map(0, UTEMP, child, (void *) va,
+				      PTE_P | PTE_U | PTE_W)) < 0)
+			return r;
+		sys_page_unmap(0, UTEMP);
+	}
+	return 0;
+}
+
+//
+// Spawn a child the way it is done without kernel help: exofork an
+// empty child, then load the image into it from user space with a few
+// page system calls per page, set its trap frame and mark it runnable.
+// Same interface as spawn(); kept to compare the two (user/spawnbench).
+// Segments must not share a page with each other.
+//
+envid_t
+uspawn(const void *binary, size_t size, const char **argv)
+{
+	const struct Elf *elf = binary;
+	const struct Proghdr *ph;
+	struct Trapframe child_tf;
+	uintptr_t esp;
+	envid_t child;
+	int i, r;
+
+	if (size < sizeof(*elf) || elf->e_magic != ELF_MAGIC
+	    || elf->e_phoff + elf->e_phnum * sizeof(*ph) > size)
+		return -E_NOT_EXEC;
+
+	if ((r = sys_exofork()) < 0)
+		return r;
+	child = r;
+
+	child_tf = envs[ENVX(child)].env_tf;
+	child_tf.tf_eip = elf->e_entry;
+	if ((r = init_stack(child, argv, &esp)) < 0)
+		goto error;
+	child_tf.tf_esp = esp;
+
+	ph = (const struct Proghdr *) ((const uint8_t *) binary + elf->e_phoff);
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+		if (ph->p_type != ELF_PROG_LOAD)
+			continue;
+		if (ph->p_filesz > ph->p_memsz
+		    || ph->p_offset + ph->p_filesz > size) {
+			r = -E_NOT_EXEC;
+			goto error;
+		}
+		if ((r = map_segment(child, ph,
+				     (const uint8_t *) binary + ph->p_offset)) < 0)
+			goto error;
+	}
+
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+		goto error;
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+		goto error;
+	return child;
+
+error:
+	sys_page_unmap(0, UTEMP);
+	sys_env_destroy(child);
+	return r;
+}
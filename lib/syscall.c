@@ -1,8 +1,40 @@
 // System call stubs.
 
 #include <inc/syscall.h>
+#include <inc/cpuid.h>
 #include <inc/lib.h>
 
+// How syscall() enters the kernel: 1 for sysenter, 0 for int
+// $T_SYSCALL, or -1 until the first system call asks cpuid.  Programs
+// may set it to 0 to force the int path.
+int syscall_sysenter = -1;
+
+// Enter the kernel with sysenter (see sysenter_entry in
+// kern/trapentry.S), with the same registers as the int path.  The
+// kernel learns where to come back from our stack pointer, left in
+// BP, and the return address pushed there; sysexit uses DX and CX to
+// carry them back, so those are lost.
+static inline int32_t
+syscall_fast(int num, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4,
+	     uint32_t a5)
+{
+	int32_t ret;
+
+	asm volatile("pushl %%ebp\n"
+		     "pushl $1f\n"
+		     "movl %%esp, %%ebp\n"
+		     "sysenter\n"
+		     "1: addl $4, %%esp\n"
+		     "popl %%ebp\n"
+		     : "=a" (ret), "+d" (a1), "+c" (a2)
+		     : "a" (num),
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+	return ret;
+}
+
 static inline int32_t
 syscall(int num, int check, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
 {
@@ -19,17 +51,24 @@ syscall(int num, int check, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4,
 	// The last clause tells the assembler that this can
 	// potentially change the condition codes and arbitrary
 	// memory locations.
+	//
+	// Where the CPU has it, sysenter does the same job faster.
 
-	asm volatile("int %1\n"
-		     : "=a" (ret)
-		     : "i" (T_SYSCALL),
-		       "a" (num),
-		       "d" (a1),
-		       "c" (a2),
-		       "b" (a3),
-		       "D" (a4),
-		       "S" (a5)
-		     : "cc", "memory");
+	if (syscall_sysenter < 0)
+		syscall_sysenter = cpuid_sysenter();
+	if (syscall_sysenter)
+		ret = syscall_fast(num, a1, a2, a3, a4, a5);
+	else
+		asm volatile("int %1\n"
+			     : "=a" (ret)
+			     : "i" (T_SYSCALL),
+			       "a" (num),
+			       "d" (a1),
+			       "c" (a2),
+			       "b" (a3),
+			       "D" (a4),
+			       "S" (a5)
+			     : "cc", "memory");
 
 	if(check && ret > 0)
 		panic("syscall %d returned %d (> 0)", num, ret);
@@ -37,6 +76,44 @@ syscall(int num, int check, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4,
 	return ret;
 }
 
+// System calls that carry a struct ipc_msg in registers: the words go
+// in CX, BX, DI, SI and BP, the other env (or endpoint) in DX.  The
+// kernel leaves the registers alone unless a message comes back in
+// them, so 'msg' is simply reloaded from them afterwards, and DX is
+// stored in *dx_store if that is not null.  BP may be the frame
+// pointer, so it is saved around the trap along with the message
+// pointer.
+static inline int32_t
+syscall_msg(int num, uint32_t a1, struct ipc_msg *msg, uint32_t *dx_store)
+{
+	int32_t ret;
+
+	asm volatile("pushl %%ebp\n"
+		     "pushl %%esi\n"
+		     "movl 0(%%esi), %%ecx\n"
+		     "movl 4(%%esi), %%ebx\n"
+		     "movl 8(%%esi), %%edi\n"
+		     "movl 16(%%esi), %%ebp\n"
+		     "movl 12(%%esi), %%esi\n"
+		     "int %2\n"
+		     "xchgl %%esi, (%%esp)\n"
+		     "movl %%ecx, 0(%%esi)\n"
+		     "movl %%ebx, 4(%%esi)\n"
+		     "movl %%edi, 8(%%esi)\n"
+		     "movl %%ebp, 16(%%esi)\n"
+		     "popl 12(%%esi)\n"
+		     "popl %%ebp\n"
+		     : "=a" (ret), "+d" (a1)
+		     : "i" (T_SYSCALL),
+		       "a" (num),
+		       "S" (msg)
+		     : "ecx", "ebx", "edi", "cc", "memory");
+
+	if (dx_store)
+		*dx_store = a1;
+	return ret;
+}
+
 void
 sys_cputs(const char *s, size_t len)
 {
@@ -79,6 +156,14 @@ sys_page_unmap(envid_t envid, void *va)
 	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
 }
 
+int
+sys_page_copy(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva,
+	      int perm)
+{
+	return syscall(SYS_page_copy, 1, srcenv, (uint32_t) srcva, dstenv,
+		       (uint32_t) dstva, perm);
+}
+
 void
 sys_yield(void)
 {
@@ -99,6 +184,18 @@ sys_sysinfo(struct sysinfo *info)
 	return syscall(SYS_sysinfo, 1, (uint32_t)info, 0, 0, 0, 0);
 }
 
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+
+int
+sys_env_set_stack_limit(envid_t envid, size_t size)
+{
+	return syscall(SYS_env_set_stack_limit, 1, envid, size, 0, 0, 0);
+}
+
 int
 sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
 {
@@ -111,8 +208,229 @@ sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
 	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
 }
 
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+
 int
 sys_ipc_recv(void *dstva)
 {
 	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
 }
+
+int
+sys_ipc_send_range(envid_t envid, uint32_t value, void *srcva, size_t npages,
+		   int perm)
+{
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+		       npages, perm);
+}
+
+int
+sys_ipc_recv_range(void *dstva, size_t npages)
+{
+	return syscall(SYS_ipc_recv_range, 1, (uint32_t) dstva, npages, 0, 0, 0);
+}
+
+int
+sys_ipc_call(envid_t envid, struct ipc_msg *msg)
+{
+	return syscall_msg(SYS_ipc_call, envid, msg, NULL);
+}
+
+envid_t
+sys_ipc_reply_wait(envid_t envid, struct ipc_msg *msg)
+{
+	return syscall_msg(SYS_ipc_reply_wait, envid, msg, NULL);
+}
+
+int
+sys_ipc_send_msg(envid_t envid, const struct ipc_msg *msg)
+{
+	struct ipc_msg m = *msg;
+
+	return syscall_msg(SYS_ipc_send_msg, envid, &m, NULL);
+}
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+
+// The kernel does at most PAGE_VEC_MAXPAGES pages of a vector call per
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+	int r;
+
+	while (1) {
+		ndone = 0;
+		if (num == SYS_page_map_vec)
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+		if (r != -E_AGAIN)
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+			vec++;
+			n--;
+		}
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+		rest[0].pr_va += ndone * PGSIZE;
+		rest[0].pr_dstva += ndone * PGSIZE;
+		rest[0].pr_npages -= ndone;
+		vec = rest;
+	}
+	if (done)
+		*done = total;
+	return r;
+}
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+}
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+}
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+}
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+
+int
+sys_shm_remove(const char *name)
+{
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+
+epid_t
+sys_ep_create(void)
+{
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+
+int
+sys_ep_destroy(epid_t epid)
+{
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+	struct ipc_msg m = *msg;
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+		*from_env_store = r < 0 ? 0 : from;
+	return r;
+}
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+
+int
+sys_sysring_enter(void)
+{
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
@@ -0,0 +1,69 @@
+// Batched system calls: queue calls in a struct sysring and run them
+// all with one sys_sysring_enter (see kern/sysring.c).
+//
+// Only this env and the kernel touch the ring, and the kernel only
+// while we are in sys_sysring_enter, so compiler barriers keep the
+// slot writes and the counter updates in order.
+
+#include <inc/lib.h>
+
+#define barrier()	asm volatile("" : : : "memory")
+
+//
+// Clear the page-aligned ring at 'sr' and register it with the kernel.
+// The page must already be mapped writable.
+// Returns 0 on success, < 0 on error.
+//
+int
+sysring_init(struct sysring *sr)
+{
+	memset(sr, 0, sizeof(*sr));
+	return sys_sysring_setup(sr);
+}
+
+//
+// Queue a copy of the call in 'sqe'.  Nothing runs until
+// sysring_submit.  Returns 1 on success, 0 if the ring is full.
+//
+bool
+sysring_push(struct sysring *sr, const struct sysring_sqe *sqe)
+{
+	uint32_t tail = sr->sr_sq_tail;
+
+	if (tail - sr->sr_sq_head == SYSRING_NENTRIES)
+		return 0;
+	sr->sr_sq[tail % SYSRING_NENTRIES] = *sqe;
+	barrier();
+	sr->sr_sq_tail = tail + 1;
+	return 1;
+}
+
+//
+// Run the queued calls in one trap.  The kernel stops early if the
+// completion ring fills up; reap the results and submit again.
+// Returns the number of calls run, < 0 on error.
+//
+int
+sysring_submit(struct sysring *sr)
+{
+	USED(sr);
+	return sys_sysring_enter();
+}
+
+//
+// Take the oldest result off the completion ring, copying it to 'cqe'.
+// Returns 1 on success, 0 if there is none.
+//
+bool
+sysring_reap(struct sysring *sr, struct sysring_cqe *cqe)
+{
+	uint32_t head = sr->sr_cq_head;
+
+	if (sr->sr_cq_tail == head)
+		return 0;
+	barrier();
+	*cqe = sr->sr_cq[head % SYSRING_NENTRIES];
+	barrier();
+	sr->sr_cq_head = head + 1;
+	return 1;
+}
@@ -1,26 +1,53 @@
 #include <inc/lib.h>
+#include <inc/x86.h>
 
+// Read the uptime from the vdso page, without a system call.  The
+// vdso is only refreshed on CPU 0's timer ticks, which stop while envs
+// keep every CPU busy, so the time since the last refresh is carried
+// with the TSC however long it is, as time_now() does in the kernel.
+// The kernel advances vd_uptime by the TSC too, so the result does not
+// go backwards when the next refresh comes.
 nanoseconds_t
 uptime(void)
 {
-	struct sysinfo info;
+	nanoseconds_t now, ns_per_tick;
+	uint64_t tick_tsc, tsc_per_tick, delta;
+	uint32_t seq;
 
-	sys_sysinfo(&info);
-	return info.uptime;
+	do {
+		seq = vdso_begin(&vdso);
+		now = vdso.vd_uptime;
+		ns_per_tick = vdso.vd_ns_per_tick;
+		tick_tsc = vdso.vd_tick_tsc;
+		tsc_per_tick = vdso.vd_tsc_per_tick;
+	} while (vdso_retry(&vdso, seq));
+
+	if (tsc_per_tick) {
+		delta = read_tsc() - tick_tsc;
+		now += delta / tsc_per_tick * ns_per_tick
+			+ delta % tsc_per_tick * ns_per_tick / tsc_per_tick;
+	}
+	return now;
 }
 
+// Sleep in the kernel, on a futex word nobody wakes, until the timeout
+// runs out, rather than spinning through sys_yield.
 void
 nanosleep(nanoseconds_t nanoseconds)
 {
+	volatile uint32_t word = 0;
 	nanoseconds_t now, end;
+	int r;
 
 	now = uptime();
 	end = now + nanoseconds;
 	if (end < now)
 		panic("nanosleep: wrap");
 
-	while (uptime() < end)
-		sys_yield();
+	while ((now = uptime()) < end)
+		if ((r = sys_futex_wait(&word, 0, end - now)) < 0
+		    && r != -E_TIMEOUT)
+			sys_yield();
 }
 
 void
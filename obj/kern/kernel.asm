@@ -0,0 +1,20338 @@
+
+obj/kern/kernel:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+f0100000 <_start+0xeffffff4>:
+f0100000:	02 b0 ad 1b 02 00    	add    0x21bad(%eax),%dh
+f0100006:	00 00                	add    %al,(%eax)
+f0100008:	fc                   	cld
+f0100009:	4f                   	dec    %edi
+f010000a:	52                   	push   %edx
+f010000b:	e4                   	.byte 0xe4
+
+f010000c <entry>:
+.globl _start
+_start = RELOC(entry)
+
+.globl entry
+entry:
+	movw	$0x1234, 0x472			# warm boot
+f010000c:	66 c7 05 72 04 00 00 	movw   $0x1234,0x472
+f0100013:	34 12 
+	# sufficient until we set up our real page table in mem_init
+	# in lab 2.
+
+	# Load the physical address of entry_pgdir into cr3.  entry_pgdir
+	# is defined in entrypgdir.c.
+	movl	$(RELOC(entry_pgdir)), %ecx
+f0100015:	b9 00 70 11 00       	mov    $0x117000,%ecx
+	movl	%ecx, %cr3
+f010001a:	0f 22 d9             	mov    %ecx,%cr3
+	# Turn on paging.
+	movl	%cr0, %ecx
+f010001d:	0f 20 c1             	mov    %cr0,%ecx
+	orl	$(CR0_PE|CR0_PG|CR0_WP), %ecx
+f0100020:	81 c9 01 00 01 80    	or     $0x80010001,%ecx
+	movl	%ecx, %cr0
+f0100026:	0f 22 c1             	mov    %ecx,%cr0
+
+	# Now paging is enabled, but we're still running at a low EIP
+	# (why is this okay?).  Jump up above KERNBASE before entering
+	# C code.
+	mov	$relocated, %ecx
+f0100029:	b9 30 00 10 f0       	mov    $0xf0100030,%ecx
+	jmp	*%ecx
+f010002e:	ff e1                	jmp    *%ecx
+
+f0100030 <relocated>:
+relocated:
+
+	# Clear the frame pointer register (EBP)
+	# so that once we get into debugging C code,
+	# stack backtraces will be terminated properly.
+	movl	$0x0, %ebp			# nuke frame pointer
+f0100030:	bd 00 00 00 00       	mov    $0x0,%ebp
+
+	# Set the stack pointer
+	movl	$(bootstacktop),%esp
+f0100035:	bc 00 70 11 f0       	mov    $0xf0117000,%esp
+
+	# pointer to struct multiboot_info
+	pushl	%ebx
+f010003a:	53                   	push   %ebx
+	# saved magic value
+	pushl	%eax
+f010003b:	50                   	push   %eax
+
+	# now to C code
+	call	i386_init
+f010003c:	e8 eb 00 00 00       	call   f010012c <i386_init>
+
+f0100041 <spin>:
+
+	# Should never get here, but in case we do, just spin.
+spin:	jmp	spin
+f0100041:	eb fe                	jmp    f0100041 <spin>
+
+f0100043 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: mesg", and then enters the kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt,...)
+{
+f0100043:	55                   	push   %ebp
+f0100044:	89 e5                	mov    %esp,%ebp
+f0100046:	53                   	push   %ebx
+f0100047:	83 ec 04             	sub    $0x4,%esp
+	va_list ap;
+
+	if (panicstr)
+f010004a:	83 3d 00 40 79 f0 00 	cmpl   $0x0,0xf0794000
+f0100051:	74 0f                	je     f0100062 <_panic+0x1f>
+	va_end(ap);
+
+dead:
+	/* break into the kernel monitor */
+	while (1)
+		monitor(NULL);
+f0100053:	83 ec 0c             	sub    $0xc,%esp
+f0100056:	6a 00                	push   $0x0
+f0100058:	e8 a8 09 00 00       	call   f0100a05 <monitor>
+f010005d:	83 c4 10             	add    $0x10,%esp
+f0100060:	eb f1                	jmp    f0100053 <_panic+0x10>
+	panicstr = fmt;
+f0100062:	8b 45 10             	mov    0x10(%ebp),%eax
+f0100065:	a3 00 40 79 f0       	mov    %eax,0xf0794000
+	asm volatile("cli; cld");
+f010006a:	fa                   	cli
+f010006b:	fc                   	cld
+	va_start(ap, fmt);
+f010006c:	8d 5d 14             	lea    0x14(%ebp),%ebx
+	cprintf("kernel panic on CPU %d at %s:%d: ", cpunum(), file, line);
+f010006f:	e8 c3 8b 00 00       	call   f0108c37 <cpunum>
+f0100074:	ff 75 0c             	push   0xc(%ebp)
+f0100077:	ff 75 08             	push   0x8(%ebp)
+f010007a:	50                   	push   %eax
+f010007b:	68 00 be 10 f0       	push   $0xf010be00
+f0100080:	e8 30 4b 00 00       	call   f0104bb5 <cprintf>
+	vcprintf(fmt, ap);
+f0100085:	83 c4 08             	add    $0x8,%esp
+f0100088:	53                   	push   %ebx
+f0100089:	ff 75 10             	push   0x10(%ebp)
+f010008c:	e8 fe 4a 00 00       	call   f0104b8f <vcprintf>
+	cprintf("\n");
+f0100091:	c7 04 24 84 d1 10 f0 	movl   $0xf010d184,(%esp)
+f0100098:	e8 18 4b 00 00       	call   f0104bb5 <cprintf>
+f010009d:	83 c4 10             	add    $0x10,%esp
+f01000a0:	eb b1                	jmp    f0100053 <_panic+0x10>
+
+f01000a2 <mp_main>:
+{
+f01000a2:	55                   	push   %ebp
+f01000a3:	89 e5                	mov    %esp,%ebp
+f01000a5:	53                   	push   %ebx
+f01000a6:	83 ec 04             	sub    $0x4,%esp
+	lcr3(PADDR(kern_pgdir));
+f01000a9:	a1 6c 47 79 f0       	mov    0xf079476c,%eax
+#define PADDR(kva) _paddr(__FILE__, __LINE__, kva)
+
+static inline physaddr_t
+_paddr(const char *file, int line, void *kva)
+{
+	if ((uint32_t)kva < KERNBASE)
+f01000ae:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01000b3:	76 62                	jbe    f0100117 <mp_main+0x75>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+	return (physaddr_t)kva - KERNBASE;
+f01000b5:	05 00 00 00 10       	add    $0x10000000,%eax
+}
+
+static inline void
+lcr3(uint32_t val)
+{
+	asm volatile("movl %0,%%cr3" : : "r" (val));
+f01000ba:	0f 22 d8             	mov    %eax,%cr3
+	cprintf("  AP #%d [apicid %02x] starting\n", cpunum(), thiscpu->cpu_apicid);
+f01000bd:	e8 75 8b 00 00       	call   f0108c37 <cpunum>
+f01000c2:	6b c0 78             	imul   $0x78,%eax,%eax
+f01000c5:	0f b6 98 20 60 7d f0 	movzbl -0xf829fe0(%eax),%ebx
+f01000cc:	e8 66 8b 00 00       	call   f0108c37 <cpunum>
+f01000d1:	83 ec 04             	sub    $0x4,%esp
+f01000d4:	53                   	push   %ebx
+f01000d5:	50                   	push   %eax
+f01000d6:	68 48 be 10 f0       	push   $0xf010be48
+f01000db:	e8 d5 4a 00 00       	call   f0104bb5 <cprintf>
+	lapic_init();
+f01000e0:	e8 ae 8b 00 00       	call   f0108c93 <lapic_init>
+	env_init_percpu();
+f01000e5:	e8 ad 3c 00 00       	call   f0103d97 <env_init_percpu>
+	trap_init_percpu();
+f01000ea:	e8 5f 4b 00 00       	call   f0104c4e <trap_init_percpu>
+	xchg(&thiscpu->cpu_status, CPU_STARTED); // tell boot_aps() we're up
+f01000ef:	e8 43 8b 00 00       	call   f0108c37 <cpunum>
+f01000f4:	6b d0 78             	imul   $0x78,%eax,%edx
+f01000f7:	83 c2 04             	add    $0x4,%edx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+f01000fa:	b8 01 00 00 00       	mov    $0x1,%eax
+f01000ff:	f0 87 82 20 60 7d f0 	lock xchg %eax,-0xf829fe0(%edx)
+extern struct spinlock kernel_lock;
+
+static inline void
+lock_kernel(void)
+{
+	spin_lock(&kernel_lock);
+f0100106:	c7 04 24 c0 a3 11 f0 	movl   $0xf011a3c0,(%esp)
+f010010d:	e8 04 8f 00 00       	call   f0109016 <spin_lock>
+  sched_yield();
+f0100112:	e8 1a 60 00 00       	call   f0106131 <sched_yield>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0100117:	50                   	push   %eax
+f0100118:	68 24 be 10 f0       	push   $0xf010be24
+f010011d:	68 81 00 00 00       	push   $0x81
+f0100122:	68 b3 be 10 f0       	push   $0xf010beb3
+f0100127:	e8 17 ff ff ff       	call   f0100043 <_panic>
+
+f010012c <i386_init>:
+{
+f010012c:	55                   	push   %ebp
+f010012d:	89 e5                	mov    %esp,%ebp
+f010012f:	53                   	push   %ebx
+f0100130:	83 ec 08             	sub    $0x8,%esp
+	memset(edata, 0, end - edata);
+f0100133:	b8 40 c0 7d f0       	mov    $0xf07dc040,%eax
+f0100138:	2d 54 38 79 f0       	sub    $0xf0793854,%eax
+f010013d:	50                   	push   %eax
+f010013e:	6a 00                	push   $0x0
+f0100140:	68 54 38 79 f0       	push   $0xf0793854
+f0100145:	e8 f1 83 00 00       	call   f010853b <memset>
+	cons_init();
+f010014a:	e8 a8 05 00 00       	call   f01006f7 <cons_init>
+	assert(magic == MULTIBOOT_BOOTLOADER_MAGIC);
+f010014f:	83 c4 10             	add    $0x10,%esp
+f0100152:	81 7d 08 02 b0 ad 2b 	cmpl   $0x2badb002,0x8(%ebp)
+f0100159:	74 16                	je     f0100171 <i386_init+0x45>
+f010015b:	68 6c be 10 f0       	push   $0xf010be6c
+f0100160:	68 bf be 10 f0       	push   $0xf010bebf
+f0100165:	6a 26                	push   $0x26
+f0100167:	68 b3 be 10 f0       	push   $0xf010beb3
+f010016c:	e8 d2 fe ff ff       	call   f0100043 <_panic>
+	cprintf("451 decimal is %o octal!\n", 451);
+f0100171:	83 ec 08             	sub    $0x8,%esp
+f0100174:	68 c3 01 00 00       	push   $0x1c3
+f0100179:	68 d4 be 10 f0       	push   $0xf010bed4
+f010017e:	e8 32 4a 00 00       	call   f0104bb5 <cprintf>
+	cpuid_print();
+f0100183:	e8 44 7a 00 00       	call   f0107bcc <cpuid_print>
+	e820_init(addr);
+f0100188:	83 c4 04             	add    $0x4,%esp
+f010018b:	ff 75 0c             	push   0xc(%ebp)
+f010018e:	e8 b9 09 00 00       	call   f0100b4c <e820_init>
+	mem_init();
+f0100193:	e8 14 1d 00 00       	call   f0101eac <mem_init>
+	env_init();
+f0100198:	e8 26 3c 00 00       	call   f0103dc3 <env_init>
+	trap_init();
+f010019d:	e8 c9 4b 00 00       	call   f0104d6b <trap_init>
+	acpi_init();
+f01001a2:	e8 39 87 00 00       	call   f01088e0 <acpi_init>
+	mp_init();
+f01001a7:	e8 c6 89 00 00       	call   f0108b72 <mp_init>
+	lapic_init();
+f01001ac:	e8 e2 8a 00 00       	call   f0108c93 <lapic_init>
+	pic_init();
+f01001b1:	e8 39 49 00 00       	call   f0104aef <pic_init>
+	ioapic_init();
+f01001b6:	e8 6a 8d 00 00       	call   f0108f25 <ioapic_init>
+	ioapic_enable(IRQ_KBD, bootcpu->cpu_apicid);
+f01001bb:	83 c4 08             	add    $0x8,%esp
+f01001be:	0f b6 05 20 60 7d f0 	movzbl 0xf07d6020,%eax
+f01001c5:	50                   	push   %eax
+f01001c6:	6a 01                	push   $0x1
+f01001c8:	e8 07 8e 00 00       	call   f0108fd4 <ioapic_enable>
+	ioapic_enable(IRQ_SERIAL, bootcpu->cpu_apicid);
+f01001cd:	83 c4 08             	add    $0x8,%esp
+f01001d0:	0f b6 05 20 60 7d f0 	movzbl 0xf07d6020,%eax
+f01001d7:	50                   	push   %eax
+f01001d8:	6a 04                	push   $0x4
+f01001da:	e8 f5 8d 00 00       	call   f0108fd4 <ioapic_enable>
+f01001df:	c7 04 24 c0 a3 11 f0 	movl   $0xf011a3c0,(%esp)
+f01001e6:	e8 2b 8e 00 00       	call   f0109016 <spin_lock>
+	if (ncpu <= 1)
+f01001eb:	83 c4 10             	add    $0x10,%esp
+f01001ee:	83 3d 00 60 7d f0 01 	cmpl   $0x1,0xf07d6000
+f01001f5:	0f 8e b9 00 00 00    	jle    f01002b4 <i386_init+0x188>
+	cprintf("SMP: BSP #%d [apicid %02x]\n", cpunum(), thiscpu->cpu_apicid);
+f01001fb:	e8 37 8a 00 00       	call   f0108c37 <cpunum>
+f0100200:	6b c0 78             	imul   $0x78,%eax,%eax
+f0100203:	0f b6 98 20 60 7d f0 	movzbl -0xf829fe0(%eax),%ebx
+f010020a:	e8 28 8a 00 00       	call   f0108c37 <cpunum>
+f010020f:	83 ec 04             	sub    $0x4,%esp
+f0100212:	53                   	push   %ebx
+f0100213:	50                   	push   %eax
+f0100214:	68 ee be 10 f0       	push   $0xf010beee
+f0100219:	e8 97 49 00 00       	call   f0104bb5 <cprintf>
+#define KADDR(pa) _kaddr(__FILE__, __LINE__, pa)
+
+static inline void*
+_kaddr(const char *file, int line, physaddr_t pa)
+{
+	if (PGNUM(pa) >= npages)
+f010021e:	83 c4 10             	add    $0x10,%esp
+f0100221:	83 3d 74 47 79 f0 07 	cmpl   $0x7,0xf0794774
+f0100228:	76 74                	jbe    f010029e <i386_init+0x172>
+	memmove(code, mpentry_start, mpentry_end - mpentry_start);
+f010022a:	83 ec 04             	sub    $0x4,%esp
+f010022d:	b8 aa 87 10 f0       	mov    $0xf01087aa,%eax
+f0100232:	2d 30 87 10 f0       	sub    $0xf0108730,%eax
+f0100237:	50                   	push   %eax
+f0100238:	68 30 87 10 f0       	push   $0xf0108730
+f010023d:	68 00 70 00 f0       	push   $0xf0007000
+f0100242:	e8 29 83 00 00       	call   f0108570 <memmove>
+	for (c = cpus + 1; c < cpus + ncpu; c++) {
+f0100247:	83 c4 10             	add    $0x10,%esp
+f010024a:	bb 98 60 7d f0       	mov    $0xf07d6098,%ebx
+f010024f:	6b 05 00 60 7d f0 78 	imul   $0x78,0xf07d6000,%eax
+f0100256:	05 20 60 7d f0       	add    $0xf07d6020,%eax
+f010025b:	39 c3                	cmp    %eax,%ebx
+f010025d:	73 55                	jae    f01002b4 <i386_init+0x188>
+		mpentry_kstack = percpu_kstacks[c - cpus] + KSTKSIZE;
+f010025f:	89 d8                	mov    %ebx,%eax
+f0100261:	2d 20 60 7d f0       	sub    $0xf07d6020,%eax
+f0100266:	c1 f8 03             	sar    $0x3,%eax
+f0100269:	69 c0 ef ee ee ee    	imul   $0xeeeeeeef,%eax,%eax
+f010026f:	c1 e0 0f             	shl    $0xf,%eax
+f0100272:	8d 80 00 e0 79 f0    	lea    -0xf862000(%eax),%eax
+f0100278:	a3 04 40 79 f0       	mov    %eax,0xf0794004
+		lapic_startap(c->cpu_apicid, PADDR(code));
+f010027d:	83 ec 08             	sub    $0x8,%esp
+f0100280:	68 00 70 00 00       	push   $0x7000
+f0100285:	0f b6 03             	movzbl (%ebx),%eax
+f0100288:	50                   	push   %eax
+f0100289:	e8 aa 8b 00 00       	call   f0108e38 <lapic_startap>
+		while(c->cpu_status != CPU_STARTED)
+f010028e:	83 c4 10             	add    $0x10,%esp
+f0100291:	8b 43 04             	mov    0x4(%ebx),%eax
+f0100294:	83 f8 01             	cmp    $0x1,%eax
+f0100297:	75 f8                	jne    f0100291 <i386_init+0x165>
+	for (c = cpus + 1; c < cpus + ncpu; c++) {
+f0100299:	83 c3 78             	add    $0x78,%ebx
+f010029c:	eb b1                	jmp    f010024f <i386_init+0x123>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f010029e:	68 00 70 00 00       	push   $0x7000
+f01002a3:	68 90 be 10 f0       	push   $0xf010be90
+f01002a8:	6a 6d                	push   $0x6d
+f01002aa:	68 b3 be 10 f0       	push   $0xf010beb3
+f01002af:	e8 8f fd ff ff       	call   f0100043 <_panic>
+	ENV_CREATE(user_yield, ENV_TYPE_USER);
+f01002b4:	83 ec 08             	sub    $0x8,%esp
+f01002b7:	6a 00                	push   $0x0
+f01002b9:	68 9c bc 26 f0       	push   $0xf026bc9c
+f01002be:	e8 14 3e 00 00       	call   f01040d7 <env_create>
+	ENV_CREATE(user_yield, ENV_TYPE_USER);
+f01002c3:	83 c4 08             	add    $0x8,%esp
+f01002c6:	6a 00                	push   $0x0
+f01002c8:	68 9c bc 26 f0       	push   $0xf026bc9c
+f01002cd:	e8 05 3e 00 00       	call   f01040d7 <env_create>
+	ENV_CREATE(user_yield, ENV_TYPE_USER);
+f01002d2:	83 c4 08             	add    $0x8,%esp
+f01002d5:	6a 00                	push   $0x0
+f01002d7:	68 9c bc 26 f0       	push   $0xf026bc9c
+f01002dc:	e8 f6 3d 00 00       	call   f01040d7 <env_create>
+	sched_yield();
+f01002e1:	e8 4b 5e 00 00       	call   f0106131 <sched_yield>
+
+f01002e6 <_warn>:
+}
+
+/* like panic, but don't */
+void
+_warn(const char *file, int line, const char *fmt,...)
+{
+f01002e6:	55                   	push   %ebp
+f01002e7:	89 e5                	mov    %esp,%ebp
+f01002e9:	53                   	push   %ebx
+f01002ea:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+
+	va_start(ap, fmt);
+f01002ed:	8d 5d 14             	lea    0x14(%ebp),%ebx
+	cprintf("kernel warning at %s:%d: ", file, line);
+f01002f0:	ff 75 0c             	push   0xc(%ebp)
+f01002f3:	ff 75 08             	push   0x8(%ebp)
+f01002f6:	68 0a bf 10 f0       	push   $0xf010bf0a
+f01002fb:	e8 b5 48 00 00       	call   f0104bb5 <cprintf>
+	vcprintf(fmt, ap);
+f0100300:	83 c4 08             	add    $0x8,%esp
+f0100303:	53                   	push   %ebx
+f0100304:	ff 75 10             	push   0x10(%ebp)
+f0100307:	e8 83 48 00 00       	call   f0104b8f <vcprintf>
+	cprintf("\n");
+f010030c:	c7 04 24 84 d1 10 f0 	movl   $0xf010d184,(%esp)
+f0100313:	e8 9d 48 00 00       	call   f0104bb5 <cprintf>
+	va_end(ap);
+}
+f0100318:	83 c4 10             	add    $0x10,%esp
+f010031b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010031e:	c9                   	leave
+f010031f:	c3                   	ret
+
+f0100320 <serial_proc_data>:
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100320:	ba fd 03 00 00       	mov    $0x3fd,%edx
+f0100325:	ec                   	in     (%dx),%al
+static bool serial_exists;
+
+static int
+serial_proc_data(void)
+{
+	if (!(inb(COM1+COM_LSR) & COM_LSR_DATA))
+f0100326:	a8 01                	test   $0x1,%al
+f0100328:	74 0a                	je     f0100334 <serial_proc_data+0x14>
+f010032a:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f010032f:	ec                   	in     (%dx),%al
+		return -1;
+	return inb(COM1+COM_RX);
+f0100330:	0f b6 c0             	movzbl %al,%eax
+f0100333:	c3                   	ret
+		return -1;
+f0100334:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+f0100339:	c3                   	ret
+
+f010033a <cons_intr>:
+
+// called by device interrupt routines to feed input characters
+// into the circular console input buffer.
+static void
+cons_intr(int (*proc)(void))
+{
+f010033a:	55                   	push   %ebp
+f010033b:	89 e5                	mov    %esp,%ebp
+f010033d:	53                   	push   %ebx
+f010033e:	83 ec 04             	sub    $0x4,%esp
+f0100341:	89 c3                	mov    %eax,%ebx
+	int c;
+
+	while ((c = (*proc)()) != -1) {
+f0100343:	eb 23                	jmp    f0100368 <cons_intr+0x2e>
+		if (c == 0)
+			continue;
+		cons.buf[cons.wpos++] = c;
+f0100345:	8b 0d 44 42 79 f0    	mov    0xf0794244,%ecx
+f010034b:	8d 51 01             	lea    0x1(%ecx),%edx
+f010034e:	88 81 40 40 79 f0    	mov    %al,-0xf86bfc0(%ecx)
+		if (cons.wpos == CONSBUFSIZE)
+f0100354:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+			cons.wpos = 0;
+f010035a:	b8 00 00 00 00       	mov    $0x0,%eax
+f010035f:	0f 44 d0             	cmove  %eax,%edx
+f0100362:	89 15 44 42 79 f0    	mov    %edx,0xf0794244
+	while ((c = (*proc)()) != -1) {
+f0100368:	ff d3                	call   *%ebx
+f010036a:	83 f8 ff             	cmp    $0xffffffff,%eax
+f010036d:	74 06                	je     f0100375 <cons_intr+0x3b>
+		if (c == 0)
+f010036f:	85 c0                	test   %eax,%eax
+f0100371:	75 d2                	jne    f0100345 <cons_intr+0xb>
+f0100373:	eb f3                	jmp    f0100368 <cons_intr+0x2e>
+	}
+}
+f0100375:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0100378:	c9                   	leave
+f0100379:	c3                   	ret
+
+f010037a <kbd_proc_data>:
+{
+f010037a:	55                   	push   %ebp
+f010037b:	89 e5                	mov    %esp,%ebp
+f010037d:	53                   	push   %ebx
+f010037e:	83 ec 04             	sub    $0x4,%esp
+f0100381:	ba 64 00 00 00       	mov    $0x64,%edx
+f0100386:	ec                   	in     (%dx),%al
+	if ((stat & KBS_DIB) == 0)
+f0100387:	a8 01                	test   $0x1,%al
+f0100389:	0f 84 ee 00 00 00    	je     f010047d <kbd_proc_data+0x103>
+	if (stat & KBS_TERR)
+f010038f:	a8 20                	test   $0x20,%al
+f0100391:	0f 85 ed 00 00 00    	jne    f0100484 <kbd_proc_data+0x10a>
+f0100397:	ba 60 00 00 00       	mov    $0x60,%edx
+f010039c:	ec                   	in     (%dx),%al
+f010039d:	89 c2                	mov    %eax,%edx
+	if (data == 0xE0) {
+f010039f:	3c e0                	cmp    $0xe0,%al
+f01003a1:	74 61                	je     f0100404 <kbd_proc_data+0x8a>
+	} else if (data & 0x80) {
+f01003a3:	84 c0                	test   %al,%al
+f01003a5:	78 70                	js     f0100417 <kbd_proc_data+0x9d>
+	} else if (shift & E0ESC) {
+f01003a7:	8b 0d 20 40 79 f0    	mov    0xf0794020,%ecx
+f01003ad:	f6 c1 40             	test   $0x40,%cl
+f01003b0:	74 0e                	je     f01003c0 <kbd_proc_data+0x46>
+		data |= 0x80;
+f01003b2:	83 c8 80             	or     $0xffffff80,%eax
+f01003b5:	89 c2                	mov    %eax,%edx
+		shift &= ~E0ESC;
+f01003b7:	83 e1 bf             	and    $0xffffffbf,%ecx
+f01003ba:	89 0d 20 40 79 f0    	mov    %ecx,0xf0794020
+	shift |= shiftcode[data];
+f01003c0:	0f b6 d2             	movzbl %dl,%edx
+f01003c3:	0f b6 82 80 c0 10 f0 	movzbl -0xfef3f80(%edx),%eax
+f01003ca:	0b 05 20 40 79 f0    	or     0xf0794020,%eax
+	shift ^= togglecode[data];
+f01003d0:	0f b6 8a 80 bf 10 f0 	movzbl -0xfef4080(%edx),%ecx
+f01003d7:	31 c8                	xor    %ecx,%eax
+f01003d9:	a3 20 40 79 f0       	mov    %eax,0xf0794020
+	c = charcode[shift & (CTL | SHIFT)][data];
+f01003de:	89 c1                	mov    %eax,%ecx
+f01003e0:	83 e1 03             	and    $0x3,%ecx
+f01003e3:	8b 0c 8d 60 bf 10 f0 	mov    -0xfef40a0(,%ecx,4),%ecx
+f01003ea:	0f b6 14 11          	movzbl (%ecx,%edx,1),%edx
+f01003ee:	0f b6 da             	movzbl %dl,%ebx
+	if (shift & CAPSLOCK) {
+f01003f1:	a8 08                	test   $0x8,%al
+f01003f3:	74 5d                	je     f0100452 <kbd_proc_data+0xd8>
+		if ('a' <= c && c <= 'z')
+f01003f5:	89 da                	mov    %ebx,%edx
+f01003f7:	8d 4b 9f             	lea    -0x61(%ebx),%ecx
+f01003fa:	83 f9 19             	cmp    $0x19,%ecx
+f01003fd:	77 47                	ja     f0100446 <kbd_proc_data+0xcc>
+			c += 'A' - 'a';
+f01003ff:	83 eb 20             	sub    $0x20,%ebx
+	if (!(~shift & (CTL | ALT)) && c == KEY_DEL) {
+f0100402:	eb 0c                	jmp    f0100410 <kbd_proc_data+0x96>
+		shift |= E0ESC;
+f0100404:	83 0d 20 40 79 f0 40 	orl    $0x40,0xf0794020
+		return 0;
+f010040b:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+f0100410:	89 d8                	mov    %ebx,%eax
+f0100412:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0100415:	c9                   	leave
+f0100416:	c3                   	ret
+		data = (shift & E0ESC ? data : data & 0x7F);
+f0100417:	8b 0d 20 40 79 f0    	mov    0xf0794020,%ecx
+f010041d:	83 e0 7f             	and    $0x7f,%eax
+f0100420:	f6 c1 40             	test   $0x40,%cl
+f0100423:	0f 44 d0             	cmove  %eax,%edx
+		shift &= ~(shiftcode[data] | E0ESC);
+f0100426:	0f b6 d2             	movzbl %dl,%edx
+f0100429:	0f b6 82 80 c0 10 f0 	movzbl -0xfef3f80(%edx),%eax
+f0100430:	83 c8 40             	or     $0x40,%eax
+f0100433:	0f b6 c0             	movzbl %al,%eax
+f0100436:	f7 d0                	not    %eax
+f0100438:	21 c8                	and    %ecx,%eax
+f010043a:	a3 20 40 79 f0       	mov    %eax,0xf0794020
+		return 0;
+f010043f:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0100444:	eb ca                	jmp    f0100410 <kbd_proc_data+0x96>
+		else if ('A' <= c && c <= 'Z')
+f0100446:	83 ea 41             	sub    $0x41,%edx
+			c += 'a' - 'A';
+f0100449:	8d 4b 20             	lea    0x20(%ebx),%ecx
+f010044c:	83 fa 1a             	cmp    $0x1a,%edx
+f010044f:	0f 42 d9             	cmovb  %ecx,%ebx
+	if (!(~shift & (CTL | ALT)) && c == KEY_DEL) {
+f0100452:	f7 d0                	not    %eax
+f0100454:	a8 06                	test   $0x6,%al
+f0100456:	75 b8                	jne    f0100410 <kbd_proc_data+0x96>
+f0100458:	81 fb e9 00 00 00    	cmp    $0xe9,%ebx
+f010045e:	75 b0                	jne    f0100410 <kbd_proc_data+0x96>
+		cprintf("Rebooting!\n");
+f0100460:	83 ec 0c             	sub    $0xc,%esp
+f0100463:	68 24 bf 10 f0       	push   $0xf010bf24
+f0100468:	e8 48 47 00 00       	call   f0104bb5 <cprintf>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f010046d:	b8 03 00 00 00       	mov    $0x3,%eax
+f0100472:	ba 92 00 00 00       	mov    $0x92,%edx
+f0100477:	ee                   	out    %al,(%dx)
+}
+f0100478:	83 c4 10             	add    $0x10,%esp
+f010047b:	eb 93                	jmp    f0100410 <kbd_proc_data+0x96>
+		return -1;
+f010047d:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+f0100482:	eb 8c                	jmp    f0100410 <kbd_proc_data+0x96>
+		return -1;
+f0100484:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+f0100489:	eb 85                	jmp    f0100410 <kbd_proc_data+0x96>
+
+f010048b <cons_putc>:
+}
+
+// output a character to the console
+static void
+cons_putc(int c)
+{
+f010048b:	55                   	push   %ebp
+f010048c:	89 e5                	mov    %esp,%ebp
+f010048e:	57                   	push   %edi
+f010048f:	56                   	push   %esi
+f0100490:	53                   	push   %ebx
+f0100491:	83 ec 1c             	sub    $0x1c,%esp
+f0100494:	89 c7                	mov    %eax,%edi
+	for (i = 0;
+f0100496:	bb 00 00 00 00       	mov    $0x0,%ebx
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f010049b:	be fd 03 00 00       	mov    $0x3fd,%esi
+f01004a0:	b9 84 00 00 00       	mov    $0x84,%ecx
+f01004a5:	89 f2                	mov    %esi,%edx
+f01004a7:	ec                   	in     (%dx),%al
+	     !(inb(COM1 + COM_LSR) & COM_LSR_TXRDY) && i < 12800;
+f01004a8:	a8 20                	test   $0x20,%al
+f01004aa:	75 13                	jne    f01004bf <cons_putc+0x34>
+f01004ac:	81 fb ff 31 00 00    	cmp    $0x31ff,%ebx
+f01004b2:	7f 0b                	jg     f01004bf <cons_putc+0x34>
+f01004b4:	89 ca                	mov    %ecx,%edx
+f01004b6:	ec                   	in     (%dx),%al
+f01004b7:	ec                   	in     (%dx),%al
+f01004b8:	ec                   	in     (%dx),%al
+f01004b9:	ec                   	in     (%dx),%al
+	     i++)
+f01004ba:	83 c3 01             	add    $0x1,%ebx
+f01004bd:	eb e6                	jmp    f01004a5 <cons_putc+0x1a>
+	outb(COM1 + COM_TX, c);
+f01004bf:	89 f8                	mov    %edi,%eax
+f01004c1:	88 45 e7             	mov    %al,-0x19(%ebp)
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f01004c4:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f01004c9:	ee                   	out    %al,(%dx)
+	for (i = 0; !(inb(0x378+1) & 0x80) && i < 12800; i++)
+f01004ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f01004cf:	be 79 03 00 00       	mov    $0x379,%esi
+f01004d4:	b9 84 00 00 00       	mov    $0x84,%ecx
+f01004d9:	89 f2                	mov    %esi,%edx
+f01004db:	ec                   	in     (%dx),%al
+f01004dc:	81 fb ff 31 00 00    	cmp    $0x31ff,%ebx
+f01004e2:	7f 0f                	jg     f01004f3 <cons_putc+0x68>
+f01004e4:	84 c0                	test   %al,%al
+f01004e6:	78 0b                	js     f01004f3 <cons_putc+0x68>
+f01004e8:	89 ca                	mov    %ecx,%edx
+f01004ea:	ec                   	in     (%dx),%al
+f01004eb:	ec                   	in     (%dx),%al
+f01004ec:	ec                   	in     (%dx),%al
+f01004ed:	ec                   	in     (%dx),%al
+f01004ee:	83 c3 01             	add    $0x1,%ebx
+f01004f1:	eb e6                	jmp    f01004d9 <cons_putc+0x4e>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f01004f3:	ba 78 03 00 00       	mov    $0x378,%edx
+f01004f8:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+f01004fc:	ee                   	out    %al,(%dx)
+f01004fd:	ba 7a 03 00 00       	mov    $0x37a,%edx
+f0100502:	b8 0d 00 00 00       	mov    $0xd,%eax
+f0100507:	ee                   	out    %al,(%dx)
+f0100508:	b8 08 00 00 00       	mov    $0x8,%eax
+f010050d:	ee                   	out    %al,(%dx)
+		c |= 0x0700;
+f010050e:	89 f8                	mov    %edi,%eax
+f0100510:	80 cc 07             	or     $0x7,%ah
+f0100513:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+f0100519:	0f 42 f8             	cmovb  %eax,%edi
+	switch (c & 0xff) {
+f010051c:	89 f8                	mov    %edi,%eax
+f010051e:	0f b6 c0             	movzbl %al,%eax
+f0100521:	89 fb                	mov    %edi,%ebx
+f0100523:	80 fb 0a             	cmp    $0xa,%bl
+f0100526:	0f 84 e1 00 00 00    	je     f010060d <cons_putc+0x182>
+f010052c:	83 f8 0a             	cmp    $0xa,%eax
+f010052f:	7f 46                	jg     f0100577 <cons_putc+0xec>
+f0100531:	83 f8 08             	cmp    $0x8,%eax
+f0100534:	0f 84 a7 00 00 00    	je     f01005e1 <cons_putc+0x156>
+f010053a:	83 f8 09             	cmp    $0x9,%eax
+f010053d:	0f 85 d7 00 00 00    	jne    f010061a <cons_putc+0x18f>
+		cons_putc(' ');
+f0100543:	b8 20 00 00 00       	mov    $0x20,%eax
+f0100548:	e8 3e ff ff ff       	call   f010048b <cons_putc>
+		cons_putc(' ');
+f010054d:	b8 20 00 00 00       	mov    $0x20,%eax
+f0100552:	e8 34 ff ff ff       	call   f010048b <cons_putc>
+		cons_putc(' ');
+f0100557:	b8 20 00 00 00       	mov    $0x20,%eax
+f010055c:	e8 2a ff ff ff       	call   f010048b <cons_putc>
+		cons_putc(' ');
+f0100561:	b8 20 00 00 00       	mov    $0x20,%eax
+f0100566:	e8 20 ff ff ff       	call   f010048b <cons_putc>
+		cons_putc(' ');
+f010056b:	b8 20 00 00 00       	mov    $0x20,%eax
+f0100570:	e8 16 ff ff ff       	call   f010048b <cons_putc>
+		break;
+f0100575:	eb 25                	jmp    f010059c <cons_putc+0x111>
+	switch (c & 0xff) {
+f0100577:	83 f8 0d             	cmp    $0xd,%eax
+f010057a:	0f 85 9a 00 00 00    	jne    f010061a <cons_putc+0x18f>
+		crt_pos -= (crt_pos % CRT_COLS);
+f0100580:	0f b7 05 48 42 79 f0 	movzwl 0xf0794248,%eax
+f0100587:	69 c0 cd cc 00 00    	imul   $0xcccd,%eax,%eax
+f010058d:	c1 e8 16             	shr    $0x16,%eax
+f0100590:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f0100593:	c1 e0 04             	shl    $0x4,%eax
+f0100596:	66 a3 48 42 79 f0    	mov    %ax,0xf0794248
+	if (crt_pos >= CRT_SIZE) {
+f010059c:	66 81 3d 48 42 79 f0 	cmpw   $0x7cf,0xf0794248
+f01005a3:	cf 07 
+f01005a5:	0f 87 92 00 00 00    	ja     f010063d <cons_putc+0x1b2>
+	outb(addr_6845, 14);
+f01005ab:	8b 0d 50 42 79 f0    	mov    0xf0794250,%ecx
+f01005b1:	b8 0e 00 00 00       	mov    $0xe,%eax
+f01005b6:	89 ca                	mov    %ecx,%edx
+f01005b8:	ee                   	out    %al,(%dx)
+	outb(addr_6845 + 1, crt_pos >> 8);
+f01005b9:	0f b7 1d 48 42 79 f0 	movzwl 0xf0794248,%ebx
+f01005c0:	8d 71 01             	lea    0x1(%ecx),%esi
+f01005c3:	89 d8                	mov    %ebx,%eax
+f01005c5:	66 c1 e8 08          	shr    $0x8,%ax
+f01005c9:	89 f2                	mov    %esi,%edx
+f01005cb:	ee                   	out    %al,(%dx)
+f01005cc:	b8 0f 00 00 00       	mov    $0xf,%eax
+f01005d1:	89 ca                	mov    %ecx,%edx
+f01005d3:	ee                   	out    %al,(%dx)
+f01005d4:	89 d8                	mov    %ebx,%eax
+f01005d6:	89 f2                	mov    %esi,%edx
+f01005d8:	ee                   	out    %al,(%dx)
+	serial_putc(c);
+	lpt_putc(c);
+	cga_putc(c);
+}
+f01005d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01005dc:	5b                   	pop    %ebx
+f01005dd:	5e                   	pop    %esi
+f01005de:	5f                   	pop    %edi
+f01005df:	5d                   	pop    %ebp
+f01005e0:	c3                   	ret
+		if (crt_pos > 0) {
+f01005e1:	0f b7 05 48 42 79 f0 	movzwl 0xf0794248,%eax
+f01005e8:	66 85 c0             	test   %ax,%ax
+f01005eb:	74 be                	je     f01005ab <cons_putc+0x120>
+			crt_pos--;
+f01005ed:	83 e8 01             	sub    $0x1,%eax
+f01005f0:	66 a3 48 42 79 f0    	mov    %ax,0xf0794248
+			crt_buf[crt_pos] = (c & ~0xff) | ' ';
+f01005f6:	0f b7 c0             	movzwl %ax,%eax
+f01005f9:	66 81 e7 00 ff       	and    $0xff00,%di
+f01005fe:	83 cf 20             	or     $0x20,%edi
+f0100601:	8b 15 4c 42 79 f0    	mov    0xf079424c,%edx
+f0100607:	66 89 3c 42          	mov    %di,(%edx,%eax,2)
+f010060b:	eb 8f                	jmp    f010059c <cons_putc+0x111>
+		crt_pos += CRT_COLS;
+f010060d:	66 83 05 48 42 79 f0 	addw   $0x50,0xf0794248
+f0100614:	50 
+f0100615:	e9 66 ff ff ff       	jmp    f0100580 <cons_putc+0xf5>
+		crt_buf[crt_pos++] = c;		/* write the character */
+f010061a:	0f b7 05 48 42 79 f0 	movzwl 0xf0794248,%eax
+f0100621:	8d 50 01             	lea    0x1(%eax),%edx
+f0100624:	66 89 15 48 42 79 f0 	mov    %dx,0xf0794248
+f010062b:	0f b7 c0             	movzwl %ax,%eax
+f010062e:	8b 15 4c 42 79 f0    	mov    0xf079424c,%edx
+f0100634:	66 89 3c 42          	mov    %di,(%edx,%eax,2)
+		break;
+f0100638:	e9 5f ff ff ff       	jmp    f010059c <cons_putc+0x111>
+		memmove(crt_buf, crt_buf + CRT_COLS, (CRT_SIZE - CRT_COLS) * sizeof(uint16_t));
+f010063d:	a1 4c 42 79 f0       	mov    0xf079424c,%eax
+f0100642:	83 ec 04             	sub    $0x4,%esp
+f0100645:	68 00 0f 00 00       	push   $0xf00
+f010064a:	8d 90 a0 00 00 00    	lea    0xa0(%eax),%edx
+f0100650:	52                   	push   %edx
+f0100651:	50                   	push   %eax
+f0100652:	e8 19 7f 00 00       	call   f0108570 <memmove>
+			crt_buf[i] = 0x0700 | ' ';
+f0100657:	8b 15 4c 42 79 f0    	mov    0xf079424c,%edx
+f010065d:	8d 82 00 0f 00 00    	lea    0xf00(%edx),%eax
+f0100663:	81 c2 a0 0f 00 00    	add    $0xfa0,%edx
+		for (i = CRT_SIZE - CRT_COLS; i < CRT_SIZE; i++)
+f0100669:	83 c4 10             	add    $0x10,%esp
+f010066c:	eb 08                	jmp    f0100676 <cons_putc+0x1eb>
+			crt_buf[i] = 0x0700 | ' ';
+f010066e:	66 c7 00 20 07       	movw   $0x720,(%eax)
+		for (i = CRT_SIZE - CRT_COLS; i < CRT_SIZE; i++)
+f0100673:	83 c0 02             	add    $0x2,%eax
+f0100676:	39 d0                	cmp    %edx,%eax
+f0100678:	75 f4                	jne    f010066e <cons_putc+0x1e3>
+		crt_pos -= CRT_COLS;
+f010067a:	66 83 2d 48 42 79 f0 	subw   $0x50,0xf0794248
+f0100681:	50 
+f0100682:	e9 24 ff ff ff       	jmp    f01005ab <cons_putc+0x120>
+
+f0100687 <serial_intr>:
+	if (serial_exists)
+f0100687:	80 3d 54 42 79 f0 00 	cmpb   $0x0,0xf0794254
+f010068e:	75 01                	jne    f0100691 <serial_intr+0xa>
+f0100690:	c3                   	ret
+{
+f0100691:	55                   	push   %ebp
+f0100692:	89 e5                	mov    %esp,%ebp
+f0100694:	83 ec 08             	sub    $0x8,%esp
+		cons_intr(serial_proc_data);
+f0100697:	b8 20 03 10 f0       	mov    $0xf0100320,%eax
+f010069c:	e8 99 fc ff ff       	call   f010033a <cons_intr>
+}
+f01006a1:	c9                   	leave
+f01006a2:	c3                   	ret
+
+f01006a3 <kbd_intr>:
+{
+f01006a3:	55                   	push   %ebp
+f01006a4:	89 e5                	mov    %esp,%ebp
+f01006a6:	83 ec 08             	sub    $0x8,%esp
+	cons_intr(kbd_proc_data);
+f01006a9:	b8 7a 03 10 f0       	mov    $0xf010037a,%eax
+f01006ae:	e8 87 fc ff ff       	call   f010033a <cons_intr>
+}
+f01006b3:	c9                   	leave
+f01006b4:	c3                   	ret
+
+f01006b5 <cons_getc>:
+{
+f01006b5:	55                   	push   %ebp
+f01006b6:	89 e5                	mov    %esp,%ebp
+f01006b8:	83 ec 08             	sub    $0x8,%esp
+	serial_intr();
+f01006bb:	e8 c7 ff ff ff       	call   f0100687 <serial_intr>
+	kbd_intr();
+f01006c0:	e8 de ff ff ff       	call   f01006a3 <kbd_intr>
+	if (cons.rpos != cons.wpos) {
+f01006c5:	a1 40 42 79 f0       	mov    0xf0794240,%eax
+	return 0;
+f01006ca:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (cons.rpos != cons.wpos) {
+f01006cf:	3b 05 44 42 79 f0    	cmp    0xf0794244,%eax
+f01006d5:	74 1c                	je     f01006f3 <cons_getc+0x3e>
+		c = cons.buf[cons.rpos++];
+f01006d7:	8d 48 01             	lea    0x1(%eax),%ecx
+f01006da:	0f b6 90 40 40 79 f0 	movzbl -0xf86bfc0(%eax),%edx
+			cons.rpos = 0;
+f01006e1:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+f01006e6:	b8 00 00 00 00       	mov    $0x0,%eax
+f01006eb:	0f 45 c1             	cmovne %ecx,%eax
+f01006ee:	a3 40 42 79 f0       	mov    %eax,0xf0794240
+}
+f01006f3:	89 d0                	mov    %edx,%eax
+f01006f5:	c9                   	leave
+f01006f6:	c3                   	ret
+
+f01006f7 <cons_init>:
+
+// initialize the console devices
+void
+cons_init(void)
+{
+f01006f7:	55                   	push   %ebp
+f01006f8:	89 e5                	mov    %esp,%ebp
+f01006fa:	57                   	push   %edi
+f01006fb:	56                   	push   %esi
+f01006fc:	53                   	push   %ebx
+f01006fd:	83 ec 0c             	sub    $0xc,%esp
+	was = *cp;
+f0100700:	0f b7 15 00 80 0b f0 	movzwl 0xf00b8000,%edx
+	*cp = (uint16_t) 0xA55A;
+f0100707:	66 c7 05 00 80 0b f0 	movw   $0xa55a,0xf00b8000
+f010070e:	5a a5 
+	if (*cp != 0xA55A) {
+f0100710:	0f b7 05 00 80 0b f0 	movzwl 0xf00b8000,%eax
+f0100717:	bb b4 03 00 00       	mov    $0x3b4,%ebx
+		cp = (uint16_t*) (KERNBASE + MONO_BUF);
+f010071c:	be 00 00 0b f0       	mov    $0xf00b0000,%esi
+	if (*cp != 0xA55A) {
+f0100721:	66 3d 5a a5          	cmp    $0xa55a,%ax
+f0100725:	0f 84 ab 00 00 00    	je     f01007d6 <cons_init+0xdf>
+		addr_6845 = MONO_BASE;
+f010072b:	89 1d 50 42 79 f0    	mov    %ebx,0xf0794250
+f0100731:	b8 0e 00 00 00       	mov    $0xe,%eax
+f0100736:	89 da                	mov    %ebx,%edx
+f0100738:	ee                   	out    %al,(%dx)
+	pos = inb(addr_6845 + 1) << 8;
+f0100739:	8d 7b 01             	lea    0x1(%ebx),%edi
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f010073c:	89 fa                	mov    %edi,%edx
+f010073e:	ec                   	in     (%dx),%al
+f010073f:	0f b6 c8             	movzbl %al,%ecx
+f0100742:	c1 e1 08             	shl    $0x8,%ecx
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0100745:	b8 0f 00 00 00       	mov    $0xf,%eax
+f010074a:	89 da                	mov    %ebx,%edx
+f010074c:	ee                   	out    %al,(%dx)
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f010074d:	89 fa                	mov    %edi,%edx
+f010074f:	ec                   	in     (%dx),%al
+	crt_buf = (uint16_t*) cp;
+f0100750:	89 35 4c 42 79 f0    	mov    %esi,0xf079424c
+	pos |= inb(addr_6845 + 1);
+f0100756:	0f b6 c0             	movzbl %al,%eax
+f0100759:	09 c8                	or     %ecx,%eax
+	crt_pos = pos;
+f010075b:	66 a3 48 42 79 f0    	mov    %ax,0xf0794248
+	kbd_intr();
+f0100761:	e8 3d ff ff ff       	call   f01006a3 <kbd_intr>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0100766:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010076b:	bb fa 03 00 00       	mov    $0x3fa,%ebx
+f0100770:	89 c8                	mov    %ecx,%eax
+f0100772:	89 da                	mov    %ebx,%edx
+f0100774:	ee                   	out    %al,(%dx)
+f0100775:	bf fb 03 00 00       	mov    $0x3fb,%edi
+f010077a:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+f010077f:	89 fa                	mov    %edi,%edx
+f0100781:	ee                   	out    %al,(%dx)
+f0100782:	b8 0c 00 00 00       	mov    $0xc,%eax
+f0100787:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f010078c:	ee                   	out    %al,(%dx)
+f010078d:	be f9 03 00 00       	mov    $0x3f9,%esi
+f0100792:	89 c8                	mov    %ecx,%eax
+f0100794:	89 f2                	mov    %esi,%edx
+f0100796:	ee                   	out    %al,(%dx)
+f0100797:	b8 03 00 00 00       	mov    $0x3,%eax
+f010079c:	89 fa                	mov    %edi,%edx
+f010079e:	ee                   	out    %al,(%dx)
+f010079f:	ba fc 03 00 00       	mov    $0x3fc,%edx
+f01007a4:	89 c8                	mov    %ecx,%eax
+f01007a6:	ee                   	out    %al,(%dx)
+f01007a7:	b8 01 00 00 00       	mov    $0x1,%eax
+f01007ac:	89 f2                	mov    %esi,%edx
+f01007ae:	ee                   	out    %al,(%dx)
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f01007af:	ba fd 03 00 00       	mov    $0x3fd,%edx
+f01007b4:	ec                   	in     (%dx),%al
+f01007b5:	89 c1                	mov    %eax,%ecx
+	serial_exists = (inb(COM1+COM_LSR) != 0xFF);
+f01007b7:	3c ff                	cmp    $0xff,%al
+f01007b9:	0f 95 05 54 42 79 f0 	setne  0xf0794254
+f01007c0:	89 da                	mov    %ebx,%edx
+f01007c2:	ec                   	in     (%dx),%al
+f01007c3:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f01007c8:	ec                   	in     (%dx),%al
+	cga_init();
+	kbd_init();
+	serial_init();
+
+	if (!serial_exists)
+f01007c9:	80 f9 ff             	cmp    $0xff,%cl
+f01007cc:	74 1e                	je     f01007ec <cons_init+0xf5>
+		cprintf("Serial port does not exist!\n");
+}
+f01007ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01007d1:	5b                   	pop    %ebx
+f01007d2:	5e                   	pop    %esi
+f01007d3:	5f                   	pop    %edi
+f01007d4:	5d                   	pop    %ebp
+f01007d5:	c3                   	ret
+		*cp = was;
+f01007d6:	66 89 15 00 80 0b f0 	mov    %dx,0xf00b8000
+f01007dd:	bb d4 03 00 00       	mov    $0x3d4,%ebx
+	cp = (uint16_t*) (KERNBASE + CGA_BUF);
+f01007e2:	be 00 80 0b f0       	mov    $0xf00b8000,%esi
+f01007e7:	e9 3f ff ff ff       	jmp    f010072b <cons_init+0x34>
+		cprintf("Serial port does not exist!\n");
+f01007ec:	83 ec 0c             	sub    $0xc,%esp
+f01007ef:	68 30 bf 10 f0       	push   $0xf010bf30
+f01007f4:	e8 bc 43 00 00       	call   f0104bb5 <cprintf>
+f01007f9:	83 c4 10             	add    $0x10,%esp
+}
+f01007fc:	eb d0                	jmp    f01007ce <cons_init+0xd7>
+
+f01007fe <cputchar>:
+
+// `High'-level console I/O.  Used by readline and cprintf.
+
+void
+cputchar(int c)
+{
+f01007fe:	55                   	push   %ebp
+f01007ff:	89 e5                	mov    %esp,%ebp
+f0100801:	83 ec 08             	sub    $0x8,%esp
+	cons_putc(c);
+f0100804:	8b 45 08             	mov    0x8(%ebp),%eax
+f0100807:	e8 7f fc ff ff       	call   f010048b <cons_putc>
+}
+f010080c:	c9                   	leave
+f010080d:	c3                   	ret
+
+f010080e <getchar>:
+
+int
+getchar(void)
+{
+f010080e:	55                   	push   %ebp
+f010080f:	89 e5                	mov    %esp,%ebp
+f0100811:	83 ec 08             	sub    $0x8,%esp
+	int c;
+
+	while ((c = cons_getc()) == 0)
+f0100814:	e8 9c fe ff ff       	call   f01006b5 <cons_getc>
+f0100819:	85 c0                	test   %eax,%eax
+f010081b:	74 f7                	je     f0100814 <getchar+0x6>
+		/* do nothing */;
+	return c;
+}
+f010081d:	c9                   	leave
+f010081e:	c3                   	ret
+
+f010081f <iscons>:
+int
+iscons(int fdnum)
+{
+	// used by readline
+	return 1;
+}
+f010081f:	b8 01 00 00 00       	mov    $0x1,%eax
+f0100824:	c3                   	ret
+
+f0100825 <mon_help>:
+
+/***** Implementations of basic kernel monitor commands *****/
+
+int
+mon_help(int argc, char **argv, struct Trapframe *tf)
+{
+f0100825:	55                   	push   %ebp
+f0100826:	89 e5                	mov    %esp,%ebp
+f0100828:	83 ec 0c             	sub    $0xc,%esp
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(commands); i++)
+		cprintf("%s - %s\n", commands[i].name, commands[i].desc);
+f010082b:	68 80 c1 10 f0       	push   $0xf010c180
+f0100830:	68 9e c1 10 f0       	push   $0xf010c19e
+f0100835:	68 a3 c1 10 f0       	push   $0xf010c1a3
+f010083a:	e8 76 43 00 00       	call   f0104bb5 <cprintf>
+f010083f:	83 c4 0c             	add    $0xc,%esp
+f0100842:	68 78 c2 10 f0       	push   $0xf010c278
+f0100847:	68 ac c1 10 f0       	push   $0xf010c1ac
+f010084c:	68 a3 c1 10 f0       	push   $0xf010c1a3
+f0100851:	e8 5f 43 00 00       	call   f0104bb5 <cprintf>
+f0100856:	83 c4 0c             	add    $0xc,%esp
+f0100859:	68 a0 c2 10 f0       	push   $0xf010c2a0
+f010085e:	68 b5 c1 10 f0       	push   $0xf010c1b5
+f0100863:	68 a3 c1 10 f0       	push   $0xf010c1a3
+f0100868:	e8 48 43 00 00       	call   f0104bb5 <cprintf>
+f010086d:	83 c4 0c             	add    $0xc,%esp
+f0100870:	68 c0 c2 10 f0       	push   $0xf010c2c0
+f0100875:	68 bf c1 10 f0       	push   $0xf010c1bf
+f010087a:	68 a3 c1 10 f0       	push   $0xf010c1a3
+f010087f:	e8 31 43 00 00       	call   f0104bb5 <cprintf>
+	return 0;
+}
+f0100884:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100889:	c9                   	leave
+f010088a:	c3                   	ret
+
+f010088b <mon_kerninfo>:
+
+int
+mon_kerninfo(int argc, char **argv, struct Trapframe *tf)
+{
+f010088b:	55                   	push   %ebp
+f010088c:	89 e5                	mov    %esp,%ebp
+f010088e:	83 ec 14             	sub    $0x14,%esp
+	extern char _start[], entry[], etext[], edata[], end[];
+
+	cprintf("Special kernel symbols:\n");
+f0100891:	68 c3 c1 10 f0       	push   $0xf010c1c3
+f0100896:	e8 1a 43 00 00       	call   f0104bb5 <cprintf>
+	cprintf("  _start                  %08x (phys)\n", _start);
+f010089b:	83 c4 08             	add    $0x8,%esp
+f010089e:	68 0c 00 10 00       	push   $0x10000c
+f01008a3:	68 e8 c2 10 f0       	push   $0xf010c2e8
+f01008a8:	e8 08 43 00 00       	call   f0104bb5 <cprintf>
+	cprintf("  entry  %08x (virt)  %08x (phys)\n", entry, entry - KERNBASE);
+f01008ad:	83 c4 0c             	add    $0xc,%esp
+f01008b0:	68 0c 00 10 00       	push   $0x10000c
+f01008b5:	68 0c 00 10 f0       	push   $0xf010000c
+f01008ba:	68 10 c3 10 f0       	push   $0xf010c310
+f01008bf:	e8 f1 42 00 00       	call   f0104bb5 <cprintf>
+	cprintf("  etext  %08x (virt)  %08x (phys)\n", etext, etext - KERNBASE);
+f01008c4:	83 c4 0c             	add    $0xc,%esp
+f01008c7:	68 e4 bd 10 00       	push   $0x10bde4
+f01008cc:	68 e4 bd 10 f0       	push   $0xf010bde4
+f01008d1:	68 34 c3 10 f0       	push   $0xf010c334
+f01008d6:	e8 da 42 00 00       	call   f0104bb5 <cprintf>
+	cprintf("  edata  %08x (virt)  %08x (phys)\n", edata, edata - KERNBASE);
+f01008db:	83 c4 0c             	add    $0xc,%esp
+f01008de:	68 54 38 79 00       	push   $0x793854
+f01008e3:	68 54 38 79 f0       	push   $0xf0793854
+f01008e8:	68 58 c3 10 f0       	push   $0xf010c358
+f01008ed:	e8 c3 42 00 00       	call   f0104bb5 <cprintf>
+	cprintf("  end    %08x (virt)  %08x (phys)\n", end, end - KERNBASE);
+f01008f2:	83 c4 0c             	add    $0xc,%esp
+f01008f5:	68 40 c0 7d 00       	push   $0x7dc040
+f01008fa:	68 40 c0 7d f0       	push   $0xf07dc040
+f01008ff:	68 7c c3 10 f0       	push   $0xf010c37c
+f0100904:	e8 ac 42 00 00       	call   f0104bb5 <cprintf>
+	cprintf("Kernel executable memory footprint: %dKB\n",
+f0100909:	83 c4 08             	add    $0x8,%esp
+		ROUNDUP(end - entry, 1024) / 1024);
+f010090c:	b8 40 c0 7d f0       	mov    $0xf07dc040,%eax
+f0100911:	2d 0d fc 0f f0       	sub    $0xf00ffc0d,%eax
+	cprintf("Kernel executable memory footprint: %dKB\n",
+f0100916:	c1 f8 0a             	sar    $0xa,%eax
+f0100919:	50                   	push   %eax
+f010091a:	68 a0 c3 10 f0       	push   $0xf010c3a0
+f010091f:	e8 91 42 00 00       	call   f0104bb5 <cprintf>
+	return 0;
+}
+f0100924:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100929:	c9                   	leave
+f010092a:	c3                   	ret
+
+f010092b <mon_backtrace>:
+
+int
+mon_backtrace(int argc, char **argv, struct Trapframe *tf)
+{
+f010092b:	55                   	push   %ebp
+f010092c:	89 e5                	mov    %esp,%ebp
+f010092e:	56                   	push   %esi
+f010092f:	53                   	push   %ebx
+f0100930:	83 ec 2c             	sub    $0x2c,%esp
+	asm volatile("movl %%ebp,%0" : "=r" (ebp));
+f0100933:	89 eb                	mov    %ebp,%ebx
+	// int's are 32 bit this works
+  int *ebp = (int *) read_ebp();
+
+	cprintf("Stack backtrace:\n");
+f0100935:	68 dc c1 10 f0       	push   $0xf010c1dc
+f010093a:	e8 76 42 00 00       	call   f0104bb5 <cprintf>
+  while(ebp != 0) {
+f010093f:	83 c4 10             	add    $0x10,%esp
+	  cprintf("ebp %08x  eip %08x  args %08x %08x %08x %08x %08x \n",
+        ebp, ebp[1], ebp[2], ebp[3], ebp[4], ebp[5]);
+
+    struct Eipdebuginfo info;
+    debuginfo_eip((uintptr_t) ebp[1], &info);
+f0100942:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  while(ebp != 0) {
+f0100945:	eb 58                	jmp    f010099f <mon_backtrace+0x74>
+	  cprintf("ebp %08x  eip %08x  args %08x %08x %08x %08x %08x \n",
+f0100947:	83 ec 04             	sub    $0x4,%esp
+f010094a:	ff 73 14             	push   0x14(%ebx)
+f010094d:	ff 73 10             	push   0x10(%ebx)
+f0100950:	ff 73 0c             	push   0xc(%ebx)
+f0100953:	ff 73 08             	push   0x8(%ebx)
+f0100956:	ff 73 04             	push   0x4(%ebx)
+f0100959:	53                   	push   %ebx
+f010095a:	68 cc c3 10 f0       	push   $0xf010c3cc
+f010095f:	e8 51 42 00 00       	call   f0104bb5 <cprintf>
+    debuginfo_eip((uintptr_t) ebp[1], &info);
+f0100964:	83 c4 18             	add    $0x18,%esp
+f0100967:	56                   	push   %esi
+f0100968:	ff 73 04             	push   0x4(%ebx)
+f010096b:	e8 91 6f 00 00       	call   f0107901 <debuginfo_eip>
+
+	  cprintf("%s:%d: ", info.eip_file, info.eip_line);
+f0100970:	83 c4 0c             	add    $0xc,%esp
+f0100973:	ff 75 e4             	push   -0x1c(%ebp)
+f0100976:	ff 75 e0             	push   -0x20(%ebp)
+f0100979:	68 1c bf 10 f0       	push   $0xf010bf1c
+f010097e:	e8 32 42 00 00       	call   f0104bb5 <cprintf>
+    cprintf("%.*s+%u\n", info.eip_fn_namelen, info.eip_fn_name, ebp[1] - info.eip_fn_addr);
+f0100983:	8b 43 04             	mov    0x4(%ebx),%eax
+f0100986:	2b 45 f0             	sub    -0x10(%ebp),%eax
+f0100989:	50                   	push   %eax
+f010098a:	ff 75 e8             	push   -0x18(%ebp)
+f010098d:	ff 75 ec             	push   -0x14(%ebp)
+f0100990:	68 ee c1 10 f0       	push   $0xf010c1ee
+f0100995:	e8 1b 42 00 00       	call   f0104bb5 <cprintf>
+
+    ebp = (int *) *ebp;
+f010099a:	8b 1b                	mov    (%ebx),%ebx
+f010099c:	83 c4 20             	add    $0x20,%esp
+  while(ebp != 0) {
+f010099f:	85 db                	test   %ebx,%ebx
+f01009a1:	75 a4                	jne    f0100947 <mon_backtrace+0x1c>
+  }
+
+	return 0;
+}
+f01009a3:	b8 00 00 00 00       	mov    $0x0,%eax
+f01009a8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01009ab:	5b                   	pop    %ebx
+f01009ac:	5e                   	pop    %esi
+f01009ad:	5d                   	pop    %ebp
+f01009ae:	c3                   	ret
+
+f01009af <mon_ksm>:
+
+int
+mon_ksm(int argc, char **argv, struct Trapframe *tf)
+{
+f01009af:	55                   	push   %ebp
+f01009b0:	89 e5                	mov    %esp,%ebp
+f01009b2:	83 ec 24             	sub    $0x24,%esp
+	struct ksm_stats stats;
+
+	ksm_get_stats(&stats);
+f01009b5:	8d 45 e8             	lea    -0x18(%ebp),%eax
+f01009b8:	50                   	push   %eax
+f01009b9:	e8 c9 91 00 00       	call   f0109b87 <ksm_get_stats>
+	cprintf("merges    %u\n", stats.merges);
+f01009be:	83 c4 08             	add    $0x8,%esp
+f01009c1:	ff 75 e8             	push   -0x18(%ebp)
+f01009c4:	68 f7 c1 10 f0       	push   $0xf010c1f7
+f01009c9:	e8 e7 41 00 00       	call   f0104bb5 <cprintf>
+	cprintf("unmerges  %u\n", stats.unmerges);
+f01009ce:	83 c4 08             	add    $0x8,%esp
+f01009d1:	ff 75 ec             	push   -0x14(%ebp)
+f01009d4:	68 05 c2 10 f0       	push   $0xf010c205
+f01009d9:	e8 d7 41 00 00       	call   f0104bb5 <cprintf>
+	cprintf("shared    %u pages\n", stats.shared);
+f01009de:	83 c4 08             	add    $0x8,%esp
+f01009e1:	ff 75 f0             	push   -0x10(%ebp)
+f01009e4:	68 13 c2 10 f0       	push   $0xf010c213
+f01009e9:	e8 c7 41 00 00       	call   f0104bb5 <cprintf>
+	cprintf("saved     %u pages\n", stats.saved);
+f01009ee:	83 c4 08             	add    $0x8,%esp
+f01009f1:	ff 75 f4             	push   -0xc(%ebp)
+f01009f4:	68 27 c2 10 f0       	push   $0xf010c227
+f01009f9:	e8 b7 41 00 00       	call   f0104bb5 <cprintf>
+	return 0;
+}
+f01009fe:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100a03:	c9                   	leave
+f0100a04:	c3                   	ret
+
+f0100a05 <monitor>:
+	return 0;
+}
+
+void
+monitor(struct Trapframe *tf)
+{
+f0100a05:	55                   	push   %ebp
+f0100a06:	89 e5                	mov    %esp,%ebp
+f0100a08:	57                   	push   %edi
+f0100a09:	56                   	push   %esi
+f0100a0a:	53                   	push   %ebx
+f0100a0b:	83 ec 58             	sub    $0x58,%esp
+	char *buf;
+
+	cprintf("Welcome to the JOS kernel monitor!\n");
+f0100a0e:	68 00 c4 10 f0       	push   $0xf010c400
+f0100a13:	e8 9d 41 00 00       	call   f0104bb5 <cprintf>
+	cprintf("Type 'help' for a list of commands.\n");
+f0100a18:	c7 04 24 24 c4 10 f0 	movl   $0xf010c424,(%esp)
+f0100a1f:	e8 91 41 00 00       	call   f0104bb5 <cprintf>
+
+	if (tf != NULL)
+f0100a24:	83 c4 10             	add    $0x10,%esp
+f0100a27:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+f0100a2b:	74 57                	je     f0100a84 <monitor+0x7f>
+		print_trapframe(tf);
+f0100a2d:	83 ec 0c             	sub    $0xc,%esp
+f0100a30:	ff 75 08             	push   0x8(%ebp)
+f0100a33:	e8 d4 47 00 00       	call   f010520c <print_trapframe>
+f0100a38:	83 c4 10             	add    $0x10,%esp
+f0100a3b:	eb 47                	jmp    f0100a84 <monitor+0x7f>
+		while (*buf && strchr(WHITESPACE, *buf))
+f0100a3d:	83 ec 08             	sub    $0x8,%esp
+f0100a40:	0f be c0             	movsbl %al,%eax
+f0100a43:	50                   	push   %eax
+f0100a44:	68 3f c2 10 f0       	push   $0xf010c23f
+f0100a49:	e8 ae 7a 00 00       	call   f01084fc <strchr>
+f0100a4e:	83 c4 10             	add    $0x10,%esp
+f0100a51:	85 c0                	test   %eax,%eax
+f0100a53:	74 0a                	je     f0100a5f <monitor+0x5a>
+			*buf++ = 0;
+f0100a55:	c6 03 00             	movb   $0x0,(%ebx)
+f0100a58:	89 f7                	mov    %esi,%edi
+f0100a5a:	8d 5b 01             	lea    0x1(%ebx),%ebx
+f0100a5d:	eb 6b                	jmp    f0100aca <monitor+0xc5>
+		if (*buf == 0)
+f0100a5f:	80 3b 00             	cmpb   $0x0,(%ebx)
+f0100a62:	74 73                	je     f0100ad7 <monitor+0xd2>
+		if (argc == MAXARGS-1) {
+f0100a64:	83 fe 0f             	cmp    $0xf,%esi
+f0100a67:	74 09                	je     f0100a72 <monitor+0x6d>
+		argv[argc++] = buf;
+f0100a69:	8d 7e 01             	lea    0x1(%esi),%edi
+f0100a6c:	89 5c b5 a8          	mov    %ebx,-0x58(%ebp,%esi,4)
+		while (*buf && !strchr(WHITESPACE, *buf))
+f0100a70:	eb 39                	jmp    f0100aab <monitor+0xa6>
+			cprintf("Too many arguments (max %d)\n", MAXARGS);
+f0100a72:	83 ec 08             	sub    $0x8,%esp
+f0100a75:	6a 10                	push   $0x10
+f0100a77:	68 44 c2 10 f0       	push   $0xf010c244
+f0100a7c:	e8 34 41 00 00       	call   f0104bb5 <cprintf>
+			return 0;
+f0100a81:	83 c4 10             	add    $0x10,%esp
+
+	while (1) {
+		buf = readline("K> ");
+f0100a84:	83 ec 0c             	sub    $0xc,%esp
+f0100a87:	68 3b c2 10 f0       	push   $0xf010c23b
+f0100a8c:	e8 3c 78 00 00       	call   f01082cd <readline>
+f0100a91:	89 c3                	mov    %eax,%ebx
+		if (buf != NULL)
+f0100a93:	83 c4 10             	add    $0x10,%esp
+f0100a96:	85 c0                	test   %eax,%eax
+f0100a98:	74 ea                	je     f0100a84 <monitor+0x7f>
+	argv[argc] = 0;
+f0100a9a:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%ebp)
+	argc = 0;
+f0100aa1:	be 00 00 00 00       	mov    $0x0,%esi
+f0100aa6:	eb 24                	jmp    f0100acc <monitor+0xc7>
+			buf++;
+f0100aa8:	83 c3 01             	add    $0x1,%ebx
+		while (*buf && !strchr(WHITESPACE, *buf))
+f0100aab:	0f b6 03             	movzbl (%ebx),%eax
+f0100aae:	84 c0                	test   %al,%al
+f0100ab0:	74 18                	je     f0100aca <monitor+0xc5>
+f0100ab2:	83 ec 08             	sub    $0x8,%esp
+f0100ab5:	0f be c0             	movsbl %al,%eax
+f0100ab8:	50                   	push   %eax
+f0100ab9:	68 3f c2 10 f0       	push   $0xf010c23f
+f0100abe:	e8 39 7a 00 00       	call   f01084fc <strchr>
+f0100ac3:	83 c4 10             	add    $0x10,%esp
+f0100ac6:	85 c0                	test   %eax,%eax
+f0100ac8:	74 de                	je     f0100aa8 <monitor+0xa3>
+			*buf++ = 0;
+f0100aca:	89 fe                	mov    %edi,%esi
+		while (*buf && strchr(WHITESPACE, *buf))
+f0100acc:	0f b6 03             	movzbl (%ebx),%eax
+f0100acf:	84 c0                	test   %al,%al
+f0100ad1:	0f 85 66 ff ff ff    	jne    f0100a3d <monitor+0x38>
+	argv[argc] = 0;
+f0100ad7:	c7 44 b5 a8 00 00 00 	movl   $0x0,-0x58(%ebp,%esi,4)
+f0100ade:	00 
+	if (argc == 0)
+f0100adf:	85 f6                	test   %esi,%esi
+f0100ae1:	74 a1                	je     f0100a84 <monitor+0x7f>
+	for (i = 0; i < ARRAY_SIZE(commands); i++) {
+f0100ae3:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (strcmp(argv[0], commands[i].name) == 0)
+f0100ae8:	83 ec 08             	sub    $0x8,%esp
+f0100aeb:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f0100aee:	ff 34 85 60 c4 10 f0 	push   -0xfef3ba0(,%eax,4)
+f0100af5:	ff 75 a8             	push   -0x58(%ebp)
+f0100af8:	e8 9e 79 00 00       	call   f010849b <strcmp>
+f0100afd:	83 c4 10             	add    $0x10,%esp
+f0100b00:	85 c0                	test   %eax,%eax
+f0100b02:	74 20                	je     f0100b24 <monitor+0x11f>
+	for (i = 0; i < ARRAY_SIZE(commands); i++) {
+f0100b04:	83 c3 01             	add    $0x1,%ebx
+f0100b07:	83 fb 04             	cmp    $0x4,%ebx
+f0100b0a:	75 dc                	jne    f0100ae8 <monitor+0xe3>
+	cprintf("Unknown command '%s'\n", argv[0]);
+f0100b0c:	83 ec 08             	sub    $0x8,%esp
+f0100b0f:	ff 75 a8             	push   -0x58(%ebp)
+f0100b12:	68 61 c2 10 f0       	push   $0xf010c261
+f0100b17:	e8 99 40 00 00       	call   f0104bb5 <cprintf>
+	return 0;
+f0100b1c:	83 c4 10             	add    $0x10,%esp
+f0100b1f:	e9 60 ff ff ff       	jmp    f0100a84 <monitor+0x7f>
+			return commands[i].func(argc, argv, tf);
+f0100b24:	83 ec 04             	sub    $0x4,%esp
+f0100b27:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f0100b2a:	ff 75 08             	push   0x8(%ebp)
+f0100b2d:	8d 55 a8             	lea    -0x58(%ebp),%edx
+f0100b30:	52                   	push   %edx
+f0100b31:	56                   	push   %esi
+f0100b32:	ff 14 85 68 c4 10 f0 	call   *-0xfef3b98(,%eax,4)
+			if (runcmd(buf, tf) < 0)
+f0100b39:	83 c4 10             	add    $0x10,%esp
+f0100b3c:	85 c0                	test   %eax,%eax
+f0100b3e:	0f 89 40 ff ff ff    	jns    f0100a84 <monitor+0x7f>
+				break;
+	}
+}
+f0100b44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100b47:	5b                   	pop    %ebx
+f0100b48:	5e                   	pop    %esi
+f0100b49:	5f                   	pop    %edi
+f0100b4a:	5d                   	pop    %ebp
+f0100b4b:	c3                   	ret
+
+f0100b4c <e820_init>:
+
+// This function may ONLY be used during initialization,
+// before page_init().
+void
+e820_init(physaddr_t mbi_pa)
+{
+f0100b4c:	55                   	push   %ebp
+f0100b4d:	89 e5                	mov    %esp,%ebp
+f0100b4f:	57                   	push   %edi
+f0100b50:	56                   	push   %esi
+f0100b51:	53                   	push   %ebx
+f0100b52:	83 ec 1c             	sub    $0x1c,%esp
+f0100b55:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct multiboot_info *mbi;
+	uint32_t addr, addr_end, i;
+
+	mbi = (struct multiboot_info *)mbi_pa;
+	assert(mbi->flags & MULTIBOOT_INFO_MEM_MAP);
+f0100b58:	f6 06 40             	testb  $0x40,(%esi)
+f0100b5b:	74 32                	je     f0100b8f <e820_init+0x43>
+	cprintf("E820: physical memory map [mem 0x%08x-0x%08x]\n",
+		mbi->mmap_addr, mbi->mmap_addr + mbi->mmap_length - 1);
+f0100b5d:	8b 56 30             	mov    0x30(%esi),%edx
+	cprintf("E820: physical memory map [mem 0x%08x-0x%08x]\n",
+f0100b60:	83 ec 04             	sub    $0x4,%esp
+		mbi->mmap_addr, mbi->mmap_addr + mbi->mmap_length - 1);
+f0100b63:	89 d0                	mov    %edx,%eax
+f0100b65:	03 46 2c             	add    0x2c(%esi),%eax
+	cprintf("E820: physical memory map [mem 0x%08x-0x%08x]\n",
+f0100b68:	83 e8 01             	sub    $0x1,%eax
+f0100b6b:	50                   	push   %eax
+f0100b6c:	52                   	push   %edx
+f0100b6d:	68 b4 c4 10 f0       	push   $0xf010c4b4
+f0100b72:	e8 3e 40 00 00       	call   f0104bb5 <cprintf>
+
+	addr = mbi->mmap_addr;
+f0100b77:	8b 5e 30             	mov    0x30(%esi),%ebx
+	addr_end = mbi->mmap_addr + mbi->mmap_length;
+f0100b7a:	89 d8                	mov    %ebx,%eax
+f0100b7c:	03 46 2c             	add    0x2c(%esi),%eax
+f0100b7f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (i = 0; addr < addr_end; ++i) {
+f0100b82:	83 c4 10             	add    $0x10,%esp
+f0100b85:	bf 00 00 00 00       	mov    $0x0,%edi
+f0100b8a:	e9 94 00 00 00       	jmp    f0100c23 <e820_init+0xd7>
+	assert(mbi->flags & MULTIBOOT_INFO_MEM_MAP);
+f0100b8f:	68 90 c4 10 f0       	push   $0xf010c490
+f0100b94:	68 bf be 10 f0       	push   $0xf010bebf
+f0100b99:	6a 26                	push   $0x26
+f0100b9b:	68 e3 c4 10 f0       	push   $0xf010c4e3
+f0100ba0:	e8 9e f4 ff ff       	call   f0100043 <_panic>
+		struct multiboot_mmap_entry *e;
+
+		// Print memory mapping.
+		assert(addr_end - addr >= sizeof(*e));
+f0100ba5:	68 ef c4 10 f0       	push   $0xf010c4ef
+f0100baa:	68 bf be 10 f0       	push   $0xf010bebf
+f0100baf:	6a 30                	push   $0x30
+f0100bb1:	68 e3 c4 10 f0       	push   $0xf010c4e3
+f0100bb6:	e8 88 f4 ff ff       	call   f0100043 <_panic>
+		cprintf("type %u", type);
+f0100bbb:	83 ec 08             	sub    $0x8,%esp
+f0100bbe:	50                   	push   %eax
+f0100bbf:	68 20 c5 10 f0       	push   $0xf010c520
+f0100bc4:	e8 ec 3f 00 00       	call   f0104bb5 <cprintf>
+		break;
+f0100bc9:	83 c4 10             	add    $0x10,%esp
+		e = (struct multiboot_mmap_entry *)addr;
+		cprintf("  [mem %08p-%08p] ",
+			(uintptr_t)e->e820.addr,
+			(uintptr_t)(e->e820.addr + e->e820.len - 1));
+		print_e820_map_type(e->e820.type);
+		cprintf("\n");
+f0100bcc:	83 ec 0c             	sub    $0xc,%esp
+f0100bcf:	68 84 d1 10 f0       	push   $0xf010d184
+f0100bd4:	e8 dc 3f 00 00       	call   f0104bb5 <cprintf>
+
+		// Save a copy.
+		assert(i < E820_NR_MAX);
+f0100bd9:	83 c4 10             	add    $0x10,%esp
+f0100bdc:	83 ff 40             	cmp    $0x40,%edi
+f0100bdf:	0f 84 98 00 00 00    	je     f0100c7d <e820_init+0x131>
+		e820_map.entries[i] = e->e820;
+f0100be5:	8d 04 bf             	lea    (%edi,%edi,4),%eax
+f0100be8:	8b 56 04             	mov    0x4(%esi),%edx
+f0100beb:	89 14 85 64 42 79 f0 	mov    %edx,-0xf86bd9c(,%eax,4)
+f0100bf2:	8b 56 08             	mov    0x8(%esi),%edx
+f0100bf5:	89 14 85 68 42 79 f0 	mov    %edx,-0xf86bd98(,%eax,4)
+f0100bfc:	8b 56 0c             	mov    0xc(%esi),%edx
+f0100bff:	89 14 85 6c 42 79 f0 	mov    %edx,-0xf86bd94(,%eax,4)
+f0100c06:	8b 56 10             	mov    0x10(%esi),%edx
+f0100c09:	89 14 85 70 42 79 f0 	mov    %edx,-0xf86bd90(,%eax,4)
+f0100c10:	8b 56 14             	mov    0x14(%esi),%edx
+f0100c13:	89 14 85 74 42 79 f0 	mov    %edx,-0xf86bd8c(,%eax,4)
+		addr += (e->size + 4);
+f0100c1a:	8b 06                	mov    (%esi),%eax
+f0100c1c:	8d 5c 03 04          	lea    0x4(%ebx,%eax,1),%ebx
+	for (i = 0; addr < addr_end; ++i) {
+f0100c20:	83 c7 01             	add    $0x1,%edi
+f0100c23:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0100c26:	39 c3                	cmp    %eax,%ebx
+f0100c28:	73 69                	jae    f0100c93 <e820_init+0x147>
+		assert(addr_end - addr >= sizeof(*e));
+f0100c2a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0100c2d:	29 d8                	sub    %ebx,%eax
+f0100c2f:	83 f8 17             	cmp    $0x17,%eax
+f0100c32:	0f 86 6d ff ff ff    	jbe    f0100ba5 <e820_init+0x59>
+		e = (struct multiboot_mmap_entry *)addr;
+f0100c38:	89 de                	mov    %ebx,%esi
+			(uintptr_t)(e->e820.addr + e->e820.len - 1));
+f0100c3a:	8b 53 04             	mov    0x4(%ebx),%edx
+		cprintf("  [mem %08p-%08p] ",
+f0100c3d:	83 ec 04             	sub    $0x4,%esp
+			(uintptr_t)(e->e820.addr + e->e820.len - 1));
+f0100c40:	89 d0                	mov    %edx,%eax
+f0100c42:	03 43 0c             	add    0xc(%ebx),%eax
+		cprintf("  [mem %08p-%08p] ",
+f0100c45:	83 e8 01             	sub    $0x1,%eax
+f0100c48:	50                   	push   %eax
+f0100c49:	52                   	push   %edx
+f0100c4a:	68 0d c5 10 f0       	push   $0xf010c50d
+f0100c4f:	e8 61 3f 00 00       	call   f0104bb5 <cprintf>
+		print_e820_map_type(e->e820.type);
+f0100c54:	8b 43 14             	mov    0x14(%ebx),%eax
+	switch (type) {
+f0100c57:	8d 50 ff             	lea    -0x1(%eax),%edx
+f0100c5a:	83 c4 10             	add    $0x10,%esp
+f0100c5d:	83 fa 04             	cmp    $0x4,%edx
+f0100c60:	0f 87 55 ff ff ff    	ja     f0100bbb <e820_init+0x6f>
+		cprintf(e820_map_types[type - 1]);
+f0100c66:	83 ec 0c             	sub    $0xc,%esp
+f0100c69:	ff 34 95 70 c5 10 f0 	push   -0xfef3a90(,%edx,4)
+f0100c70:	e8 40 3f 00 00       	call   f0104bb5 <cprintf>
+		break;
+f0100c75:	83 c4 10             	add    $0x10,%esp
+f0100c78:	e9 4f ff ff ff       	jmp    f0100bcc <e820_init+0x80>
+		assert(i < E820_NR_MAX);
+f0100c7d:	68 28 c5 10 f0       	push   $0xf010c528
+f0100c82:	68 bf be 10 f0       	push   $0xf010bebf
+f0100c87:	6a 39                	push   $0x39
+f0100c89:	68 e3 c4 10 f0       	push   $0xf010c4e3
+f0100c8e:	e8 b0 f3 ff ff       	call   f0100043 <_panic>
+	}
+	e820_map.nr = i;
+f0100c93:	89 3d 60 42 79 f0    	mov    %edi,0xf0794260
+}
+f0100c99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100c9c:	5b                   	pop    %ebx
+f0100c9d:	5e                   	pop    %esi
+f0100c9e:	5f                   	pop    %edi
+f0100c9f:	5d                   	pop    %ebp
+f0100ca0:	c3                   	ret
+
+f0100ca1 <boot_alloc>:
+	// Initialize nextfree if this is the first time.
+	// 'end' is a magic symbol automatically generated by the linker,
+	// which points to the end of the kernel's bss segment:
+	// the first virtual address that the linker did *not* assign
+	// to any kernel code or global variables.
+	if (!nextfree) {
+f0100ca1:	83 3d 78 47 79 f0 00 	cmpl   $0x0,0xf0794778
+f0100ca8:	74 1a                	je     f0100cc4 <boot_alloc+0x23>
+	// Allocate a chunk large enough to hold 'n' bytes, then update
+	// nextfree.  Make sure nextfree is kept aligned
+	// to a multiple of PGSIZE.
+	//
+	// LAB 2: Your code here.
+  result = nextfree;
+f0100caa:	8b 15 78 47 79 f0    	mov    0xf0794778,%edx
+  nextfree = ROUNDUP(nextfree + n, PGSIZE);
+f0100cb0:	8d 84 02 ff 0f 00 00 	lea    0xfff(%edx,%eax,1),%eax
+f0100cb7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0100cbc:	a3 78 47 79 f0       	mov    %eax,0xf0794778
+
+	return result;
+}
+f0100cc1:	89 d0                	mov    %edx,%eax
+f0100cc3:	c3                   	ret
+		nextfree = ROUNDUP((char *) end, PGSIZE);
+f0100cc4:	ba 3f d0 7d f0       	mov    $0xf07dd03f,%edx
+f0100cc9:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f0100ccf:	89 15 78 47 79 f0    	mov    %edx,0xf0794778
+f0100cd5:	eb d3                	jmp    f0100caa <boot_alloc+0x9>
+
+f0100cd7 <check_va2pa>:
+static physaddr_t
+check_va2pa(pde_t *pgdir, uintptr_t va)
+{
+	pte_t *p;
+
+	pgdir = &pgdir[PDX(va)];
+f0100cd7:	89 d1                	mov    %edx,%ecx
+f0100cd9:	c1 e9 16             	shr    $0x16,%ecx
+	if (!(*pgdir & PTE_P))
+f0100cdc:	8b 04 88             	mov    (%eax,%ecx,4),%eax
+f0100cdf:	a8 01                	test   $0x1,%al
+f0100ce1:	74 51                	je     f0100d34 <check_va2pa+0x5d>
+		return ~0;
+	p = (pte_t*) KADDR(PTE_ADDR(*pgdir));
+f0100ce3:	89 c1                	mov    %eax,%ecx
+f0100ce5:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	if (PGNUM(pa) >= npages)
+f0100ceb:	c1 e8 0c             	shr    $0xc,%eax
+f0100cee:	3b 05 74 47 79 f0    	cmp    0xf0794774,%eax
+f0100cf4:	73 23                	jae    f0100d19 <check_va2pa+0x42>
+	if (!(p[PTX(va)] & PTE_P))
+f0100cf6:	c1 ea 0c             	shr    $0xc,%edx
+f0100cf9:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+f0100cff:	8b 94 91 00 00 00 f0 	mov    -0x10000000(%ecx,%edx,4),%edx
+		return ~0;
+	return PTE_ADDR(p[PTX(va)]);
+f0100d06:	89 d0                	mov    %edx,%eax
+f0100d08:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0100d0d:	f6 c2 01             	test   $0x1,%dl
+f0100d10:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+f0100d15:	0f 44 c2             	cmove  %edx,%eax
+f0100d18:	c3                   	ret
+{
+f0100d19:	55                   	push   %ebp
+f0100d1a:	89 e5                	mov    %esp,%ebp
+f0100d1c:	83 ec 08             	sub    $0x8,%esp
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0100d1f:	51                   	push   %ecx
+f0100d20:	68 90 be 10 f0       	push   $0xf010be90
+f0100d25:	68 d2 04 00 00       	push   $0x4d2
+f0100d2a:	68 89 ce 10 f0       	push   $0xf010ce89
+f0100d2f:	e8 0f f3 ff ff       	call   f0100043 <_panic>
+		return ~0;
+f0100d34:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+f0100d39:	c3                   	ret
+
+f0100d3a <check_page_free_list>:
+{
+f0100d3a:	55                   	push   %ebp
+f0100d3b:	89 e5                	mov    %esp,%ebp
+f0100d3d:	57                   	push   %edi
+f0100d3e:	56                   	push   %esi
+f0100d3f:	53                   	push   %ebx
+f0100d40:	83 ec 2c             	sub    $0x2c,%esp
+	unsigned pdx_limit = only_low_memory ? 1 : NPDENTRIES;
+f0100d43:	84 c0                	test   %al,%al
+f0100d45:	0f 85 7b 02 00 00    	jne    f0100fc6 <check_page_free_list+0x28c>
+	if (!page_free_list)
+f0100d4b:	83 3d 80 47 79 f0 00 	cmpl   $0x0,0xf0794780
+f0100d52:	74 0a                	je     f0100d5e <check_page_free_list+0x24>
+	unsigned pdx_limit = only_low_memory ? 1 : NPDENTRIES;
+f0100d54:	be 00 04 00 00       	mov    $0x400,%esi
+f0100d59:	e9 c3 02 00 00       	jmp    f0101021 <check_page_free_list+0x2e7>
+		panic("'page_free_list' is a null pointer!");
+f0100d5e:	83 ec 04             	sub    $0x4,%esp
+f0100d61:	68 84 c5 10 f0       	push   $0xf010c584
+f0100d66:	68 0b 04 00 00       	push   $0x40b
+f0100d6b:	68 89 ce 10 f0       	push   $0xf010ce89
+f0100d70:	e8 ce f2 ff ff       	call   f0100043 <_panic>
+f0100d75:	50                   	push   %eax
+f0100d76:	68 90 be 10 f0       	push   $0xf010be90
+f0100d7b:	68 a4 00 00 00       	push   $0xa4
+f0100d80:	68 95 ce 10 f0       	push   $0xf010ce95
+f0100d85:	e8 b9 f2 ff ff       	call   f0100043 <_panic>
+	for (pp = page_free_list; pp; pp = pp->pp_link)
+f0100d8a:	8b 1b                	mov    (%ebx),%ebx
+f0100d8c:	85 db                	test   %ebx,%ebx
+f0100d8e:	74 41                	je     f0100dd1 <check_page_free_list+0x97>
+void	user_mem_fault(struct Env *env, uintptr_t va);
+
+static inline physaddr_t
+page2pa(struct PageInfo *pp)
+{
+	return (pp - pages) << PGSHIFT;
+f0100d90:	89 d8                	mov    %ebx,%eax
+f0100d92:	2b 05 68 47 79 f0    	sub    0xf0794768,%eax
+f0100d98:	c1 f8 03             	sar    $0x3,%eax
+f0100d9b:	c1 e0 0c             	shl    $0xc,%eax
+		if (PDX(page2pa(pp)) < pdx_limit)
+f0100d9e:	89 c2                	mov    %eax,%edx
+f0100da0:	c1 ea 16             	shr    $0x16,%edx
+f0100da3:	39 f2                	cmp    %esi,%edx
+f0100da5:	73 e3                	jae    f0100d8a <check_page_free_list+0x50>
+	if (PGNUM(pa) >= npages)
+f0100da7:	89 c2                	mov    %eax,%edx
+f0100da9:	c1 ea 0c             	shr    $0xc,%edx
+f0100dac:	3b 15 74 47 79 f0    	cmp    0xf0794774,%edx
+f0100db2:	73 c1                	jae    f0100d75 <check_page_free_list+0x3b>
+			memset(page2kva(pp), 0x97, 128);
+f0100db4:	83 ec 04             	sub    $0x4,%esp
+f0100db7:	68 80 00 00 00       	push   $0x80
+f0100dbc:	68 97 00 00 00       	push   $0x97
+	return (void *)(pa + KERNBASE);
+f0100dc1:	2d 00 00 00 10       	sub    $0x10000000,%eax
+f0100dc6:	50                   	push   %eax
+f0100dc7:	e8 6f 77 00 00       	call   f010853b <memset>
+f0100dcc:	83 c4 10             	add    $0x10,%esp
+f0100dcf:	eb b9                	jmp    f0100d8a <check_page_free_list+0x50>
+	first_free_page = (char *) boot_alloc(0);
+f0100dd1:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100dd6:	e8 c6 fe ff ff       	call   f0100ca1 <boot_alloc>
+f0100ddb:	89 45 c8             	mov    %eax,-0x38(%ebp)
+	for (pp = page_free_list; pp; pp = pp->pp_link) {
+f0100dde:	8b 15 80 47 79 f0    	mov    0xf0794780,%edx
+		assert(pp >= pages);
+f0100de4:	8b 0d 68 47 79 f0    	mov    0xf0794768,%ecx
+		assert(pp < pages + npages);
+f0100dea:	a1 74 47 79 f0       	mov    0xf0794774,%eax
+f0100def:	89 45 cc             	mov    %eax,-0x34(%ebp)
+f0100df2:	8d 34 c1             	lea    (%ecx,%eax,8),%esi
+	int nfree_basemem = 0, nfree_extmem = 0;
+f0100df5:	bf 00 00 00 00       	mov    $0x0,%edi
+f0100dfa:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+f0100dfd:	89 7d d0             	mov    %edi,-0x30(%ebp)
+	for (pp = page_free_list; pp; pp = pp->pp_link) {
+f0100e00:	e9 01 01 00 00       	jmp    f0100f06 <check_page_free_list+0x1cc>
+		assert(pp >= pages);
+f0100e05:	68 a3 ce 10 f0       	push   $0xf010cea3
+f0100e0a:	68 bf be 10 f0       	push   $0xf010bebf
+f0100e0f:	68 25 04 00 00       	push   $0x425
+f0100e14:	68 89 ce 10 f0       	push   $0xf010ce89
+f0100e19:	e8 25 f2 ff ff       	call   f0100043 <_panic>
+		assert(pp < pages + npages);
+f0100e1e:	68 af ce 10 f0       	push   $0xf010ceaf
+f0100e23:	68 bf be 10 f0       	push   $0xf010bebf
+f0100e28:	68 26 04 00 00       	push   $0x426
+f0100e2d:	68 89 ce 10 f0       	push   $0xf010ce89
+f0100e32:	e8 0c f2 ff ff       	call   f0100043 <_panic>
+		assert(((char *) pp - (char *) pages) % sizeof(*pp) == 0);
+f0100e37:	68 a8 c5 10 f0       	push   $0xf010c5a8
+f0100e3c:	68 bf be 10 f0       	push   $0xf010bebf
+f0100e41:	68 27 04 00 00       	push   $0x427
+f0100e46:	68 89 ce 10 f0       	push   $0xf010ce89
+f0100e4b:	e8 f3 f1 ff ff       	call   f0100043 <_panic>
+		assert(page2pa(pp) != 0);
+f0100e50:	68 c3 ce 10 f0       	push   $0xf010cec3
+f0100e55:	68 bf be 10 f0       	push   $0xf010bebf
+f0100e5a:	68 2a 04 00 00       	push   $0x42a
+f0100e5f:	68 89 ce 10 f0       	push   $0xf010ce89
+f0100e64:	e8 da f1 ff ff       	call   f0100043 <_panic>
+		assert(page2pa(pp) != IOPHYSMEM);
+f0100e69:	68 d4 ce 10 f0       	push   $0xf010ced4
+f0100e6e:	68 bf be 10 f0       	push   $0xf010bebf
+f0100e73:	68 2b 04 00 00       	push   $0x42b
+f0100e78:	68 89 ce 10 f0       	push   $0xf010ce89
+f0100e7d:	e8 c1 f1 ff ff       	call   f0100043 <_panic>
+		assert(page2pa(pp) != EXTPHYSMEM - PGSIZE);
+f0100e82:	68 dc c5 10 f0       	push   $0xf010c5dc
+f0100e87:	68 bf be 10 f0       	push   $0xf010bebf
+f0100e8c:	68 2c 04 00 00       	push   $0x42c
+f0100e91:	68 89 ce 10 f0       	push   $0xf010ce89
+f0100e96:	e8 a8 f1 ff ff       	call   f0100043 <_panic>
+		assert(page2pa(pp) != EXTPHYSMEM);
+f0100e9b:	68 ed ce 10 f0       	push   $0xf010ceed
+f0100ea0:	68 bf be 10 f0       	push   $0xf010bebf
+f0100ea5:	68 2d 04 00 00       	push   $0x42d
+f0100eaa:	68 89 ce 10 f0       	push   $0xf010ce89
+f0100eaf:	e8 8f f1 ff ff       	call   f0100043 <_panic>
+	if (PGNUM(pa) >= npages)
+f0100eb4:	89 c3                	mov    %eax,%ebx
+f0100eb6:	c1 eb 0c             	shr    $0xc,%ebx
+f0100eb9:	8b 7d cc             	mov    -0x34(%ebp),%edi
+f0100ebc:	39 fb                	cmp    %edi,%ebx
+f0100ebe:	73 12                	jae    f0100ed2 <check_page_free_list+0x198>
+	return (void *)(pa + KERNBASE);
+f0100ec0:	2d 00 00 00 10       	sub    $0x10000000,%eax
+		assert(page2pa(pp) < EXTPHYSMEM || (char *) page2kva(pp) >= first_free_page);
+f0100ec5:	8b 7d c8             	mov    -0x38(%ebp),%edi
+f0100ec8:	39 f8                	cmp    %edi,%eax
+f0100eca:	72 1b                	jb     f0100ee7 <check_page_free_list+0x1ad>
+			++nfree_extmem;
+f0100ecc:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+f0100ed0:	eb 32                	jmp    f0100f04 <check_page_free_list+0x1ca>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0100ed2:	50                   	push   %eax
+f0100ed3:	68 90 be 10 f0       	push   $0xf010be90
+f0100ed8:	68 a4 00 00 00       	push   $0xa4
+f0100edd:	68 95 ce 10 f0       	push   $0xf010ce95
+f0100ee2:	e8 5c f1 ff ff       	call   f0100043 <_panic>
+		assert(page2pa(pp) < EXTPHYSMEM || (char *) page2kva(pp) >= first_free_page);
+f0100ee7:	68 00 c6 10 f0       	push   $0xf010c600
+f0100eec:	68 bf be 10 f0       	push   $0xf010bebf
+f0100ef1:	68 2e 04 00 00       	push   $0x42e
+f0100ef6:	68 89 ce 10 f0       	push   $0xf010ce89
+f0100efb:	e8 43 f1 ff ff       	call   f0100043 <_panic>
+			++nfree_basemem;
+f0100f00:	83 45 d4 01          	addl   $0x1,-0x2c(%ebp)
+	for (pp = page_free_list; pp; pp = pp->pp_link) {
+f0100f04:	8b 12                	mov    (%edx),%edx
+f0100f06:	85 d2                	test   %edx,%edx
+f0100f08:	74 74                	je     f0100f7e <check_page_free_list+0x244>
+		assert(pp >= pages);
+f0100f0a:	39 ca                	cmp    %ecx,%edx
+f0100f0c:	0f 82 f3 fe ff ff    	jb     f0100e05 <check_page_free_list+0xcb>
+		assert(pp < pages + npages);
+f0100f12:	39 f2                	cmp    %esi,%edx
+f0100f14:	0f 83 04 ff ff ff    	jae    f0100e1e <check_page_free_list+0xe4>
+		assert(((char *) pp - (char *) pages) % sizeof(*pp) == 0);
+f0100f1a:	89 d0                	mov    %edx,%eax
+f0100f1c:	29 c8                	sub    %ecx,%eax
+f0100f1e:	a8 07                	test   $0x7,%al
+f0100f20:	0f 85 11 ff ff ff    	jne    f0100e37 <check_page_free_list+0xfd>
+	return (pp - pages) << PGSHIFT;
+f0100f26:	c1 f8 03             	sar    $0x3,%eax
+		assert(page2pa(pp) != 0);
+f0100f29:	c1 e0 0c             	shl    $0xc,%eax
+f0100f2c:	0f 84 1e ff ff ff    	je     f0100e50 <check_page_free_list+0x116>
+		assert(page2pa(pp) != IOPHYSMEM);
+f0100f32:	3d 00 00 0a 00       	cmp    $0xa0000,%eax
+f0100f37:	0f 84 2c ff ff ff    	je     f0100e69 <check_page_free_list+0x12f>
+		assert(page2pa(pp) != EXTPHYSMEM - PGSIZE);
+f0100f3d:	3d 00 f0 0f 00       	cmp    $0xff000,%eax
+f0100f42:	0f 84 3a ff ff ff    	je     f0100e82 <check_page_free_list+0x148>
+		assert(page2pa(pp) != EXTPHYSMEM);
+f0100f48:	3d 00 00 10 00       	cmp    $0x100000,%eax
+f0100f4d:	0f 84 48 ff ff ff    	je     f0100e9b <check_page_free_list+0x161>
+		assert(page2pa(pp) < EXTPHYSMEM || (char *) page2kva(pp) >= first_free_page);
+f0100f53:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+f0100f58:	0f 87 56 ff ff ff    	ja     f0100eb4 <check_page_free_list+0x17a>
+		assert(page2pa(pp) != MPENTRY_PADDR);
+f0100f5e:	3d 00 70 00 00       	cmp    $0x7000,%eax
+f0100f63:	75 9b                	jne    f0100f00 <check_page_free_list+0x1c6>
+f0100f65:	68 07 cf 10 f0       	push   $0xf010cf07
+f0100f6a:	68 bf be 10 f0       	push   $0xf010bebf
+f0100f6f:	68 30 04 00 00       	push   $0x430
+f0100f74:	68 89 ce 10 f0       	push   $0xf010ce89
+f0100f79:	e8 c5 f0 ff ff       	call   f0100043 <_panic>
+	assert(nfree_basemem > 0);
+f0100f7e:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+f0100f81:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f0100f84:	85 db                	test   %ebx,%ebx
+f0100f86:	7e 0c                	jle    f0100f94 <check_page_free_list+0x25a>
+	assert(nfree_extmem > 0);
+f0100f88:	85 ff                	test   %edi,%edi
+f0100f8a:	7e 21                	jle    f0100fad <check_page_free_list+0x273>
+}
+f0100f8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100f8f:	5b                   	pop    %ebx
+f0100f90:	5e                   	pop    %esi
+f0100f91:	5f                   	pop    %edi
+f0100f92:	5d                   	pop    %ebp
+f0100f93:	c3                   	ret
+	assert(nfree_basemem > 0);
+f0100f94:	68 24 cf 10 f0       	push   $0xf010cf24
+f0100f99:	68 bf be 10 f0       	push   $0xf010bebf
+f0100f9e:	68 38 04 00 00       	push   $0x438
+f0100fa3:	68 89 ce 10 f0       	push   $0xf010ce89
+f0100fa8:	e8 96 f0 ff ff       	call   f0100043 <_panic>
+	assert(nfree_extmem > 0);
+f0100fad:	68 36 cf 10 f0       	push   $0xf010cf36
+f0100fb2:	68 bf be 10 f0       	push   $0xf010bebf
+f0100fb7:	68 39 04 00 00       	push   $0x439
+f0100fbc:	68 89 ce 10 f0       	push   $0xf010ce89
+f0100fc1:	e8 7d f0 ff ff       	call   f0100043 <_panic>
+	if (!page_free_list)
+f0100fc6:	a1 80 47 79 f0       	mov    0xf0794780,%eax
+f0100fcb:	85 c0                	test   %eax,%eax
+f0100fcd:	0f 84 8b fd ff ff    	je     f0100d5e <check_page_free_list+0x24>
+		struct PageInfo **tp[2] = { &pp1, &pp2 };
+f0100fd3:	8d 55 d8             	lea    -0x28(%ebp),%edx
+f0100fd6:	89 55 e0             	mov    %edx,-0x20(%ebp)
+f0100fd9:	8d 55 dc             	lea    -0x24(%ebp),%edx
+f0100fdc:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f0100fdf:	89 c2                	mov    %eax,%edx
+f0100fe1:	2b 15 68 47 79 f0    	sub    0xf0794768,%edx
+			int pagetype = PDX(page2pa(pp)) >= pdx_limit;
+f0100fe7:	f7 c2 00 e0 7f 00    	test   $0x7fe000,%edx
+f0100fed:	0f 95 c2             	setne  %dl
+f0100ff0:	0f b6 d2             	movzbl %dl,%edx
+			*tp[pagetype] = pp;
+f0100ff3:	8b 4c 95 e0          	mov    -0x20(%ebp,%edx,4),%ecx
+f0100ff7:	89 01                	mov    %eax,(%ecx)
+			tp[pagetype] = &pp->pp_link;
+f0100ff9:	89 44 95 e0          	mov    %eax,-0x20(%ebp,%edx,4)
+		for (pp = page_free_list; pp; pp = pp->pp_link) {
+f0100ffd:	8b 00                	mov    (%eax),%eax
+f0100fff:	85 c0                	test   %eax,%eax
+f0101001:	75 dc                	jne    f0100fdf <check_page_free_list+0x2a5>
+		*tp[1] = 0;
+f0101003:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0101006:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+		*tp[0] = pp2;
+f010100c:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f010100f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0101012:	89 10                	mov    %edx,(%eax)
+		page_free_list = pp1;
+f0101014:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f0101017:	a3 80 47 79 f0       	mov    %eax,0xf0794780
+	unsigned pdx_limit = only_low_memory ? 1 : NPDENTRIES;
+f010101c:	be 01 00 00 00       	mov    $0x1,%esi
+	for (pp = page_free_list; pp; pp = pp->pp_link)
+f0101021:	8b 1d 80 47 79 f0    	mov    0xf0794780,%ebx
+f0101027:	e9 60 fd ff ff       	jmp    f0100d8c <check_page_free_list+0x52>
+
+f010102c <page_init>:
+{
+f010102c:	55                   	push   %ebp
+f010102d:	89 e5                	mov    %esp,%ebp
+f010102f:	57                   	push   %edi
+f0101030:	56                   	push   %esi
+f0101031:	53                   	push   %ebx
+f0101032:	83 ec 3c             	sub    $0x3c,%esp
+  nfreepages = 0;
+f0101035:	c7 05 70 47 79 f0 00 	movl   $0x0,0xf0794770
+f010103c:	00 00 00 
+	for (i = 0; i < npages; i++) {
+f010103f:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0101044:	e9 b2 00 00 00       	jmp    f01010fb <page_init+0xcf>
+        avail = avail && (e->type == E820_AVAILABLE);
+f0101049:	b8 00 00 00 00       	mov    $0x0,%eax
+f010104e:	80 7d c7 00          	cmpb   $0x0,-0x39(%ebp)
+f0101052:	74 0d                	je     f0101061 <page_init+0x35>
+f0101054:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0101057:	83 78 10 01          	cmpl   $0x1,0x10(%eax)
+f010105b:	0f 94 c0             	sete   %al
+f010105e:	0f b6 c0             	movzbl %al,%eax
+f0101061:	83 e0 01             	and    $0x1,%eax
+f0101064:	88 45 c7             	mov    %al,-0x39(%ebp)
+    for (int j = 0; j != e820_map.nr; ++j, ++e) {
+f0101067:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+f010106b:	83 45 e4 14          	addl   $0x14,-0x1c(%ebp)
+f010106f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0101072:	39 45 e0             	cmp    %eax,-0x20(%ebp)
+f0101075:	74 59                	je     f01010d0 <page_init+0xa4>
+      bool in_loc = (e->addr + e->len > (uint32_t) page_addr &&
+f0101077:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010107a:	8b 50 04             	mov    0x4(%eax),%edx
+f010107d:	8b 00                	mov    (%eax),%eax
+f010107f:	89 c1                	mov    %eax,%ecx
+f0101081:	89 d3                	mov    %edx,%ebx
+f0101083:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0101086:	03 4f 08             	add    0x8(%edi),%ecx
+f0101089:	13 5f 0c             	adc    0xc(%edi),%ebx
+f010108c:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+f010108f:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+f0101092:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+f0101095:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010109a:	89 f7                	mov    %esi,%edi
+f010109c:	39 c6                	cmp    %eax,%esi
+f010109e:	89 de                	mov    %ebx,%esi
+f01010a0:	19 d6                	sbb    %edx,%esi
+f01010a2:	72 0c                	jb     f01010b0 <page_init+0x84>
+f01010a4:	89 fe                	mov    %edi,%esi
+f01010a6:	8b 7d d8             	mov    -0x28(%ebp),%edi
+f01010a9:	39 fe                	cmp    %edi,%esi
+f01010ab:	1b 5d dc             	sbb    -0x24(%ebp),%ebx
+f01010ae:	72 99                	jb     f0101049 <page_init+0x1d>
+      in_loc = in_loc || (e->addr + e->len > (uint32_t) page_addr + PGSIZE &&
+f01010b0:	8b 75 c0             	mov    -0x40(%ebp),%esi
+f01010b3:	39 c6                	cmp    %eax,%esi
+f01010b5:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+f01010b8:	19 d3                	sbb    %edx,%ebx
+f01010ba:	72 ab                	jb     f0101067 <page_init+0x3b>
+f01010bc:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f01010bf:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f01010c2:	39 d6                	cmp    %edx,%esi
+f01010c4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f01010c7:	19 c8                	sbb    %ecx,%eax
+f01010c9:	73 9c                	jae    f0101067 <page_init+0x3b>
+f01010cb:	e9 79 ff ff ff       	jmp    f0101049 <page_init+0x1d>
+    physaddr_t boot_addr = PADDR(boot_alloc(0));
+f01010d0:	8b 5d bc             	mov    -0x44(%ebp),%ebx
+f01010d3:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+f01010d6:	b8 00 00 00 00       	mov    $0x0,%eax
+f01010db:	e8 c1 fb ff ff       	call   f0100ca1 <boot_alloc>
+	if ((uint32_t)kva < KERNBASE)
+f01010e0:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01010e5:	76 69                	jbe    f0101150 <page_init+0x124>
+	return (physaddr_t)kva - KERNBASE;
+f01010e7:	05 00 00 00 10       	add    $0x10000000,%eax
+                ((uint32_t) boot_addr > (uint32_t) page_addr)) ||
+f01010ec:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+f01010f2:	76 71                	jbe    f0101165 <page_init+0x139>
+f01010f4:	39 f0                	cmp    %esi,%eax
+f01010f6:	76 6d                	jbe    f0101165 <page_init+0x139>
+	for (i = 0; i < npages; i++) {
+f01010f8:	83 c3 01             	add    $0x1,%ebx
+f01010fb:	3b 1d 74 47 79 f0    	cmp    0xf0794774,%ebx
+f0101101:	0f 83 d6 00 00 00    	jae    f01011dd <page_init+0x1b1>
+    physaddr_t page_addr = page2pa(&pages[i]);
+f0101107:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+f010110e:	89 45 b8             	mov    %eax,-0x48(%ebp)
+	return (pp - pages) << PGSHIFT;
+f0101111:	89 de                	mov    %ebx,%esi
+f0101113:	c1 e6 0c             	shl    $0xc,%esi
+    for (int j = 0; j != e820_map.nr; ++j, ++e) {
+f0101116:	a1 60 42 79 f0       	mov    0xf0794260,%eax
+f010111b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f010111e:	ba 00 00 00 00       	mov    $0x0,%edx
+    bool avail = true;
+f0101123:	c6 45 c7 01          	movb   $0x1,-0x39(%ebp)
+    e = e820_map.entries;
+f0101127:	bf 64 42 79 f0       	mov    $0xf0794264,%edi
+      in_loc = in_loc || (e->addr + e->len > (uint32_t) page_addr + PGSIZE &&
+f010112c:	8d 86 00 10 00 00    	lea    0x1000(%esi),%eax
+f0101132:	89 45 c0             	mov    %eax,-0x40(%ebp)
+f0101135:	89 45 c8             	mov    %eax,-0x38(%ebp)
+f0101138:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+f010113f:	89 5d bc             	mov    %ebx,-0x44(%ebp)
+f0101142:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+f0101145:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+f0101148:	89 55 e0             	mov    %edx,-0x20(%ebp)
+    for (int j = 0; j != e820_map.nr; ++j, ++e) {
+f010114b:	e9 1f ff ff ff       	jmp    f010106f <page_init+0x43>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0101150:	50                   	push   %eax
+f0101151:	68 24 be 10 f0       	push   $0xf010be24
+f0101156:	68 58 01 00 00       	push   $0x158
+f010115b:	68 89 ce 10 f0       	push   $0xf010ce89
+f0101160:	e8 de ee ff ff       	call   f0100043 <_panic>
+    if (i != 0 && avail && !hol && !ext && !ismpentry) {
+f0101165:	85 db                	test   %ebx,%ebx
+f0101167:	74 8f                	je     f01010f8 <page_init+0xcc>
+f0101169:	80 7d c7 00          	cmpb   $0x0,-0x39(%ebp)
+f010116d:	74 89                	je     f01010f8 <page_init+0xcc>
+                (EXTPHYSMEM <= (uint32_t) page_addr + PGSIZE &&
+f010116f:	8d 96 00 10 00 00    	lea    0x1000(%esi),%edx
+f0101175:	39 c2                	cmp    %eax,%edx
+f0101177:	0f 92 c0             	setb   %al
+                ((uint32_t) boot_addr > (uint32_t) page_addr)) ||
+f010117a:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+f0101180:	0f 97 c2             	seta   %dl
+                (EXTPHYSMEM <= (uint32_t) page_addr + PGSIZE &&
+f0101183:	21 d0                	and    %edx,%eax
+    if (i != 0 && avail && !hol && !ext && !ismpentry) {
+f0101185:	83 f0 01             	xor    $0x1,%eax
+                EXTPHYSMEM > (uint32_t) page_addr)) ||
+f0101188:	8d 96 00 10 f6 ff    	lea    -0x9f000(%esi),%edx
+    if (i != 0 && avail && !hol && !ext && !ismpentry) {
+f010118e:	81 fa ff 0f 06 00    	cmp    $0x60fff,%edx
+f0101194:	0f 97 c2             	seta   %dl
+f0101197:	84 d0                	test   %dl,%al
+f0101199:	0f 84 59 ff ff ff    	je     f01010f8 <page_init+0xcc>
+f010119f:	81 fe 00 70 00 00    	cmp    $0x7000,%esi
+f01011a5:	0f 84 4d ff ff ff    	je     f01010f8 <page_init+0xcc>
+		  pages[i].pp_ref = 0;
+f01011ab:	8b 4d b8             	mov    -0x48(%ebp),%ecx
+f01011ae:	89 c8                	mov    %ecx,%eax
+f01011b0:	03 05 68 47 79 f0    	add    0xf0794768,%eax
+f01011b6:	66 c7 40 04 00 00    	movw   $0x0,0x4(%eax)
+		  pages[i].pp_link = page_free_list;
+f01011bc:	8b 15 80 47 79 f0    	mov    0xf0794780,%edx
+f01011c2:	89 10                	mov    %edx,(%eax)
+		  page_free_list = &pages[i];
+f01011c4:	89 c8                	mov    %ecx,%eax
+f01011c6:	03 05 68 47 79 f0    	add    0xf0794768,%eax
+f01011cc:	a3 80 47 79 f0       	mov    %eax,0xf0794780
+      nfreepages++;
+f01011d1:	83 05 70 47 79 f0 01 	addl   $0x1,0xf0794770
+f01011d8:	e9 1b ff ff ff       	jmp    f01010f8 <page_init+0xcc>
+}
+f01011dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01011e0:	5b                   	pop    %ebx
+f01011e1:	5e                   	pop    %esi
+f01011e2:	5f                   	pop    %edi
+f01011e3:	5d                   	pop    %ebp
+f01011e4:	c3                   	ret
+
+f01011e5 <page_alloc>:
+{
+f01011e5:	55                   	push   %ebp
+f01011e6:	89 e5                	mov    %esp,%ebp
+f01011e8:	53                   	push   %ebx
+f01011e9:	83 ec 04             	sub    $0x4,%esp
+	if (page_free_list == NULL)
+f01011ec:	8b 1d 80 47 79 f0    	mov    0xf0794780,%ebx
+f01011f2:	85 db                	test   %ebx,%ebx
+f01011f4:	74 26                	je     f010121c <page_alloc+0x37>
+  page_free_list = ret->pp_link;
+f01011f6:	8b 03                	mov    (%ebx),%eax
+f01011f8:	a3 80 47 79 f0       	mov    %eax,0xf0794780
+  ret->pp_link = NULL;
+f01011fd:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  ret->pp_ref = 0;
+f0101203:	66 c7 43 04 00 00    	movw   $0x0,0x4(%ebx)
+  ret->pp_flags = 0;
+f0101209:	66 c7 43 06 00 00    	movw   $0x0,0x6(%ebx)
+  if (alloc_flags & ALLOC_ZERO)
+f010120f:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+f0101213:	75 0e                	jne    f0101223 <page_alloc+0x3e>
+  nfreepages--;
+f0101215:	83 2d 70 47 79 f0 01 	subl   $0x1,0xf0794770
+}
+f010121c:	89 d8                	mov    %ebx,%eax
+f010121e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0101221:	c9                   	leave
+f0101222:	c3                   	ret
+	return (pp - pages) << PGSHIFT;
+f0101223:	89 d8                	mov    %ebx,%eax
+f0101225:	2b 05 68 47 79 f0    	sub    0xf0794768,%eax
+f010122b:	c1 f8 03             	sar    $0x3,%eax
+f010122e:	89 c2                	mov    %eax,%edx
+f0101230:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0101233:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0101238:	3b 05 74 47 79 f0    	cmp    0xf0794774,%eax
+f010123e:	73 1b                	jae    f010125b <page_alloc+0x76>
+	  memset(page2kva(ret), 0, PGSIZE);
+f0101240:	83 ec 04             	sub    $0x4,%esp
+f0101243:	68 00 10 00 00       	push   $0x1000
+f0101248:	6a 00                	push   $0x0
+	return (void *)(pa + KERNBASE);
+f010124a:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0101250:	52                   	push   %edx
+f0101251:	e8 e5 72 00 00       	call   f010853b <memset>
+f0101256:	83 c4 10             	add    $0x10,%esp
+f0101259:	eb ba                	jmp    f0101215 <page_alloc+0x30>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f010125b:	52                   	push   %edx
+f010125c:	68 90 be 10 f0       	push   $0xf010be90
+f0101261:	68 a4 00 00 00       	push   $0xa4
+f0101266:	68 95 ce 10 f0       	push   $0xf010ce95
+f010126b:	e8 d3 ed ff ff       	call   f0100043 <_panic>
+
+f0101270 <page_free>:
+{
+f0101270:	55                   	push   %ebp
+f0101271:	89 e5                	mov    %esp,%ebp
+f0101273:	83 ec 08             	sub    $0x8,%esp
+f0101276:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (pp == NULL || pp->pp_ref != 0 || pp->pp_link != NULL)
+f0101279:	85 c0                	test   %eax,%eax
+f010127b:	74 28                	je     f01012a5 <page_free+0x35>
+f010127d:	66 83 78 04 00       	cmpw   $0x0,0x4(%eax)
+f0101282:	75 21                	jne    f01012a5 <page_free+0x35>
+f0101284:	83 38 00             	cmpl   $0x0,(%eax)
+f0101287:	75 1c                	jne    f01012a5 <page_free+0x35>
+  pp->pp_flags = 0;
+f0101289:	66 c7 40 06 00 00    	movw   $0x0,0x6(%eax)
+  pp->pp_link = page_free_list;
+f010128f:	8b 15 80 47 79 f0    	mov    0xf0794780,%edx
+f0101295:	89 10                	mov    %edx,(%eax)
+  page_free_list = pp;
+f0101297:	a3 80 47 79 f0       	mov    %eax,0xf0794780
+  nfreepages++;
+f010129c:	83 05 70 47 79 f0 01 	addl   $0x1,0xf0794770
+}
+f01012a3:	c9                   	leave
+f01012a4:	c3                   	ret
+    panic("Invalid pp passed to page_free");
+f01012a5:	83 ec 04             	sub    $0x4,%esp
+f01012a8:	68 48 c6 10 f0       	push   $0xf010c648
+f01012ad:	68 96 01 00 00       	push   $0x196
+f01012b2:	68 89 ce 10 f0       	push   $0xf010ce89
+f01012b7:	e8 87 ed ff ff       	call   f0100043 <_panic>
+
+f01012bc <page_decref>:
+{
+f01012bc:	55                   	push   %ebp
+f01012bd:	89 e5                	mov    %esp,%ebp
+f01012bf:	53                   	push   %ebx
+f01012c0:	83 ec 04             	sub    $0x4,%esp
+f01012c3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pp->pp_ref--;
+f01012c6:	66 83 6b 04 01       	subw   $0x1,0x4(%ebx)
+	if (pp->pp_flags & PP_KSM)
+f01012cb:	f6 43 06 01          	testb  $0x1,0x6(%ebx)
+f01012cf:	75 0c                	jne    f01012dd <page_decref+0x21>
+	if (pp->pp_ref == 0)
+f01012d1:	66 83 7b 04 00       	cmpw   $0x0,0x4(%ebx)
+f01012d6:	74 15                	je     f01012ed <page_decref+0x31>
+}
+f01012d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01012db:	c9                   	leave
+f01012dc:	c3                   	ret
+		ksm_page_ref(pp, -1);
+f01012dd:	83 ec 08             	sub    $0x8,%esp
+f01012e0:	6a ff                	push   $0xffffffff
+f01012e2:	53                   	push   %ebx
+f01012e3:	e8 47 88 00 00       	call   f0109b2f <ksm_page_ref>
+f01012e8:	83 c4 10             	add    $0x10,%esp
+f01012eb:	eb e4                	jmp    f01012d1 <page_decref+0x15>
+		page_free(pp);
+f01012ed:	83 ec 0c             	sub    $0xc,%esp
+f01012f0:	53                   	push   %ebx
+f01012f1:	e8 7a ff ff ff       	call   f0101270 <page_free>
+f01012f6:	83 c4 10             	add    $0x10,%esp
+}
+f01012f9:	eb dd                	jmp    f01012d8 <page_decref+0x1c>
+
+f01012fb <pgtable_copy>:
+{
+f01012fb:	55                   	push   %ebp
+f01012fc:	89 e5                	mov    %esp,%ebp
+f01012fe:	57                   	push   %edi
+f01012ff:	56                   	push   %esi
+f0101300:	53                   	push   %ebx
+f0101301:	83 ec 1c             	sub    $0x1c,%esp
+f0101304:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f0101307:	89 d7                	mov    %edx,%edi
+f0101309:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	for (i = 0; i < NPTENTRIES; i++) {
+f010130c:	be 00 00 00 00       	mov    $0x0,%esi
+f0101311:	eb 4b                	jmp    f010135e <pgtable_copy+0x63>
+}
+
+static inline struct PageInfo*
+pa2page(physaddr_t pa)
+{
+	if (PGNUM(pa) >= npages)
+f0101313:	89 d8                	mov    %ebx,%eax
+f0101315:	c1 e8 0c             	shr    $0xc,%eax
+f0101318:	3b 05 74 47 79 f0    	cmp    0xf0794774,%eax
+f010131e:	73 6b                	jae    f010138b <pgtable_copy+0x90>
+		panic("pa2page called with invalid pa");
+	return &pages[PGNUM(pa)];
+f0101320:	8b 15 68 47 79 f0    	mov    0xf0794768,%edx
+f0101326:	8d 04 c2             	lea    (%edx,%eax,8),%eax
+		if (pp == zero_page && pp->pp_ref >= ZERO_PAGE_MAXREF) {
+f0101329:	39 05 64 47 79 f0    	cmp    %eax,0xf0794764
+f010132f:	74 71                	je     f01013a2 <pgtable_copy+0xa7>
+		pp->pp_ref++;
+f0101331:	66 83 40 04 01       	addw   $0x1,0x4(%eax)
+		if (pp->pp_flags & PP_KSM)
+f0101336:	f6 40 06 01          	testb  $0x1,0x6(%eax)
+f010133a:	0f 85 a4 00 00 00    	jne    f01013e4 <pgtable_copy+0xe9>
+		dst[i] = PTE_ADDR(pte) | (pte & PTE_SYSCALL);
+f0101340:	81 e3 07 fe ff ff    	and    $0xfffffe07,%ebx
+f0101346:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0101349:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f010134c:	89 1c 90             	mov    %ebx,(%eax,%edx,4)
+	for (i = 0; i < NPTENTRIES; i++) {
+f010134f:	83 c6 01             	add    $0x1,%esi
+f0101352:	81 fe 00 04 00 00    	cmp    $0x400,%esi
+f0101358:	0f 84 99 00 00 00    	je     f01013f7 <pgtable_copy+0xfc>
+		pte = src[i];
+f010135e:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+f0101361:	8b 1c b7             	mov    (%edi,%esi,4),%ebx
+		if (!(pte & PTE_P) || i == skip)
+f0101364:	f6 c3 01             	test   $0x1,%bl
+f0101367:	74 e6                	je     f010134f <pgtable_copy+0x54>
+f0101369:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f010136c:	39 ce                	cmp    %ecx,%esi
+f010136e:	74 df                	je     f010134f <pgtable_copy+0x54>
+		if (!(pte & PTE_SHARE) && (pte & (PTE_W | PTE_COW)))
+f0101370:	f6 c7 04             	test   $0x4,%bh
+f0101373:	75 9e                	jne    f0101313 <pgtable_copy+0x18>
+f0101375:	f7 c3 02 08 00 00    	test   $0x802,%ebx
+f010137b:	74 96                	je     f0101313 <pgtable_copy+0x18>
+			src[i] = pte = (pte & ~PTE_W) | PTE_COW;
+f010137d:	81 e3 fd f7 ff ff    	and    $0xfffff7fd,%ebx
+f0101383:	80 cf 08             	or     $0x8,%bh
+f0101386:	89 1c b7             	mov    %ebx,(%edi,%esi,4)
+f0101389:	eb 88                	jmp    f0101313 <pgtable_copy+0x18>
+		panic("pa2page called with invalid pa");
+f010138b:	83 ec 04             	sub    $0x4,%esp
+f010138e:	68 68 c6 10 f0       	push   $0xf010c668
+f0101393:	68 9d 00 00 00       	push   $0x9d
+f0101398:	68 95 ce 10 f0       	push   $0xf010ce95
+f010139d:	e8 a1 ec ff ff       	call   f0100043 <_panic>
+		if (pp == zero_page && pp->pp_ref >= ZERO_PAGE_MAXREF) {
+f01013a2:	66 81 78 04 ff fe    	cmpw   $0xfeff,0x4(%eax)
+f01013a8:	76 87                	jbe    f0101331 <pgtable_copy+0x36>
+			if (!(pp = page_alloc(ALLOC_ZERO)))
+f01013aa:	83 ec 0c             	sub    $0xc,%esp
+f01013ad:	6a 01                	push   $0x1
+f01013af:	e8 31 fe ff ff       	call   f01011e5 <page_alloc>
+f01013b4:	83 c4 10             	add    $0x10,%esp
+f01013b7:	85 c0                	test   %eax,%eax
+f01013b9:	0f 84 8f 00 00 00    	je     f010144e <pgtable_copy+0x153>
+				| (pte & PTE_COW ? PTE_W : 0);
+f01013bf:	89 da                	mov    %ebx,%edx
+f01013c1:	c1 ea 0a             	shr    $0xa,%edx
+f01013c4:	83 e2 02             	and    $0x2,%edx
+			pte = page2pa(pp) | (pte & PTE_SYSCALL & ~PTE_COW)
+f01013c7:	81 e3 07 06 00 00    	and    $0x607,%ebx
+f01013cd:	09 da                	or     %ebx,%edx
+	return (pp - pages) << PGSHIFT;
+f01013cf:	89 c3                	mov    %eax,%ebx
+f01013d1:	2b 1d 68 47 79 f0    	sub    0xf0794768,%ebx
+f01013d7:	c1 fb 03             	sar    $0x3,%ebx
+f01013da:	c1 e3 0c             	shl    $0xc,%ebx
+f01013dd:	09 d3                	or     %edx,%ebx
+f01013df:	e9 4d ff ff ff       	jmp    f0101331 <pgtable_copy+0x36>
+			ksm_page_ref(pp, 1);
+f01013e4:	83 ec 08             	sub    $0x8,%esp
+f01013e7:	6a 01                	push   $0x1
+f01013e9:	50                   	push   %eax
+f01013ea:	e8 40 87 00 00       	call   f0109b2f <ksm_page_ref>
+f01013ef:	83 c4 10             	add    $0x10,%esp
+f01013f2:	e9 49 ff ff ff       	jmp    f0101340 <pgtable_copy+0x45>
+	return 0;
+f01013f7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f01013fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01013ff:	5b                   	pop    %ebx
+f0101400:	5e                   	pop    %esi
+f0101401:	5f                   	pop    %edi
+f0101402:	5d                   	pop    %ebp
+f0101403:	c3                   	ret
+			page_decref(pa2page(PTE_ADDR(dst[i])));
+f0101404:	83 ec 0c             	sub    $0xc,%esp
+	return &pages[PGNUM(pa)];
+f0101407:	8b 15 68 47 79 f0    	mov    0xf0794768,%edx
+f010140d:	8d 04 c2             	lea    (%edx,%eax,8),%eax
+f0101410:	50                   	push   %eax
+f0101411:	e8 a6 fe ff ff       	call   f01012bc <page_decref>
+			dst[i] = 0;
+f0101416:	c7 04 b3 00 00 00 00 	movl   $0x0,(%ebx,%esi,4)
+f010141d:	83 c4 10             	add    $0x10,%esp
+	while (--i >= 0)
+f0101420:	83 ee 01             	sub    $0x1,%esi
+f0101423:	78 2e                	js     f0101453 <pgtable_copy+0x158>
+		if (dst[i] & PTE_P) {
+f0101425:	8b 04 b3             	mov    (%ebx,%esi,4),%eax
+f0101428:	a8 01                	test   $0x1,%al
+f010142a:	74 f4                	je     f0101420 <pgtable_copy+0x125>
+	if (PGNUM(pa) >= npages)
+f010142c:	c1 e8 0c             	shr    $0xc,%eax
+f010142f:	3b 05 74 47 79 f0    	cmp    0xf0794774,%eax
+f0101435:	72 cd                	jb     f0101404 <pgtable_copy+0x109>
+		panic("pa2page called with invalid pa");
+f0101437:	83 ec 04             	sub    $0x4,%esp
+f010143a:	68 68 c6 10 f0       	push   $0xf010c668
+f010143f:	68 9d 00 00 00       	push   $0x9d
+f0101444:	68 95 ce 10 f0       	push   $0xf010ce95
+f0101449:	e8 f5 eb ff ff       	call   f0100043 <_panic>
+f010144e:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f0101451:	eb cd                	jmp    f0101420 <pgtable_copy+0x125>
+	return -E_NO_MEM;
+f0101453:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0101458:	eb a2                	jmp    f01013fc <pgtable_copy+0x101>
+
+f010145a <pgdir_fork>:
+{
+f010145a:	55                   	push   %ebp
+f010145b:	89 e5                	mov    %esp,%ebp
+f010145d:	57                   	push   %edi
+f010145e:	56                   	push   %esi
+f010145f:	53                   	push   %ebx
+f0101460:	83 ec 1c             	sub    $0x1c,%esp
+f0101463:	8b 75 0c             	mov    0xc(%ebp),%esi
+	for (pdx = 0; pdx < PDX(UTOP); pdx++) {
+f0101466:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010146b:	8b 7d 08             	mov    0x8(%ebp),%edi
+f010146e:	e9 e5 00 00 00       	jmp    f0101558 <pgdir_fork+0xfe>
+			if (!(tp = page_alloc(ALLOC_ZERO)))
+f0101473:	83 ec 0c             	sub    $0xc,%esp
+f0101476:	6a 01                	push   $0x1
+f0101478:	e8 68 fd ff ff       	call   f01011e5 <page_alloc>
+f010147d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0101480:	83 c4 10             	add    $0x10,%esp
+f0101483:	85 c0                	test   %eax,%eax
+f0101485:	0f 84 20 01 00 00    	je     f01015ab <pgdir_fork+0x151>
+			if (pgtable_copy(page2kva(tp), KADDR(PTE_ADDR(src[pdx])),
+f010148b:	8b 86 e8 0e 00 00    	mov    0xee8(%esi),%eax
+f0101491:	89 c2                	mov    %eax,%edx
+f0101493:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+	if (PGNUM(pa) >= npages)
+f0101499:	8b 0d 74 47 79 f0    	mov    0xf0794774,%ecx
+f010149f:	c1 e8 0c             	shr    $0xc,%eax
+f01014a2:	39 c8                	cmp    %ecx,%eax
+f01014a4:	73 5b                	jae    f0101501 <pgdir_fork+0xa7>
+	return (void *)(pa + KERNBASE);
+f01014a6:	8d 82 00 00 00 f0    	lea    -0x10000000(%edx),%eax
+f01014ac:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	return (pp - pages) << PGSHIFT;
+f01014af:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01014b2:	2b 05 68 47 79 f0    	sub    0xf0794768,%eax
+f01014b8:	c1 f8 03             	sar    $0x3,%eax
+f01014bb:	89 c2                	mov    %eax,%edx
+f01014bd:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f01014c0:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f01014c5:	39 c8                	cmp    %ecx,%eax
+f01014c7:	73 4d                	jae    f0101516 <pgdir_fork+0xbc>
+	return (void *)(pa + KERNBASE);
+f01014c9:	89 d0                	mov    %edx,%eax
+f01014cb:	2d 00 00 00 10       	sub    $0x10000000,%eax
+f01014d0:	b9 ff 03 00 00       	mov    $0x3ff,%ecx
+f01014d5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f01014d8:	e8 1e fe ff ff       	call   f01012fb <pgtable_copy>
+f01014dd:	85 c0                	test   %eax,%eax
+f01014df:	78 4a                	js     f010152b <pgdir_fork+0xd1>
+			tp->pp_ref = 1;
+f01014e1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01014e4:	66 c7 40 04 01 00    	movw   $0x1,0x4(%eax)
+	return (pp - pages) << PGSHIFT;
+f01014ea:	2b 05 68 47 79 f0    	sub    0xf0794768,%eax
+f01014f0:	c1 f8 03             	sar    $0x3,%eax
+f01014f3:	c1 e0 0c             	shl    $0xc,%eax
+			dst[pdx] = page2pa(tp) | PTE_P | PTE_W | PTE_U;
+f01014f6:	83 c8 07             	or     $0x7,%eax
+f01014f9:	89 87 e8 0e 00 00    	mov    %eax,0xee8(%edi)
+			continue;
+f01014ff:	eb 4c                	jmp    f010154d <pgdir_fork+0xf3>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0101501:	52                   	push   %edx
+f0101502:	68 90 be 10 f0       	push   $0xf010be90
+f0101507:	68 1b 03 00 00       	push   $0x31b
+f010150c:	68 89 ce 10 f0       	push   $0xf010ce89
+f0101511:	e8 2d eb ff ff       	call   f0100043 <_panic>
+f0101516:	52                   	push   %edx
+f0101517:	68 90 be 10 f0       	push   $0xf010be90
+f010151c:	68 a4 00 00 00       	push   $0xa4
+f0101521:	68 95 ce 10 f0       	push   $0xf010ce95
+f0101526:	e8 18 eb ff ff       	call   f0100043 <_panic>
+				page_free(tp);
+f010152b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f010152e:	83 ec 0c             	sub    $0xc,%esp
+f0101531:	57                   	push   %edi
+f0101532:	e8 39 fd ff ff       	call   f0101270 <page_free>
+				return -E_NO_MEM;
+f0101537:	83 c4 10             	add    $0x10,%esp
+f010153a:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f010153f:	eb 62                	jmp    f01015a3 <pgdir_fork+0x149>
+	return &pages[PGNUM(pa)];
+f0101541:	8b 15 68 47 79 f0    	mov    0xf0794768,%edx
+		pa2page(PTE_ADDR(src[pdx]))->pp_ref++;
+f0101547:	66 83 44 c2 04 01    	addw   $0x1,0x4(%edx,%eax,8)
+	for (pdx = 0; pdx < PDX(UTOP); pdx++) {
+f010154d:	83 c3 01             	add    $0x1,%ebx
+f0101550:	81 fb bb 03 00 00    	cmp    $0x3bb,%ebx
+f0101556:	74 46                	je     f010159e <pgdir_fork+0x144>
+		if (!(src[pdx] & PTE_P))
+f0101558:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+f010155b:	a8 01                	test   $0x1,%al
+f010155d:	74 ee                	je     f010154d <pgdir_fork+0xf3>
+		if (pdx == PDX(UXSTACKTOP - PGSIZE)) {
+f010155f:	81 fb ba 03 00 00    	cmp    $0x3ba,%ebx
+f0101565:	0f 84 08 ff ff ff    	je     f0101473 <pgdir_fork+0x19>
+		src[pdx] = (src[pdx] & ~PTE_W) | PTE_COW;
+f010156b:	89 c2                	mov    %eax,%edx
+f010156d:	81 e2 fd f7 ff ff    	and    $0xfffff7fd,%edx
+f0101573:	80 ce 08             	or     $0x8,%dh
+f0101576:	89 14 9e             	mov    %edx,(%esi,%ebx,4)
+		dst[pdx] = src[pdx];
+f0101579:	89 14 9f             	mov    %edx,(%edi,%ebx,4)
+	if (PGNUM(pa) >= npages)
+f010157c:	c1 e8 0c             	shr    $0xc,%eax
+f010157f:	3b 05 74 47 79 f0    	cmp    0xf0794774,%eax
+f0101585:	72 ba                	jb     f0101541 <pgdir_fork+0xe7>
+		panic("pa2page called with invalid pa");
+f0101587:	83 ec 04             	sub    $0x4,%esp
+f010158a:	68 68 c6 10 f0       	push   $0xf010c668
+f010158f:	68 9d 00 00 00       	push   $0x9d
+f0101594:	68 95 ce 10 f0       	push   $0xf010ce95
+f0101599:	e8 a5 ea ff ff       	call   f0100043 <_panic>
+	return 0;
+f010159e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f01015a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01015a6:	5b                   	pop    %ebx
+f01015a7:	5e                   	pop    %esi
+f01015a8:	5f                   	pop    %edi
+f01015a9:	5d                   	pop    %ebp
+f01015aa:	c3                   	ret
+				return -E_NO_MEM;
+f01015ab:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f01015b0:	eb f1                	jmp    f01015a3 <pgdir_fork+0x149>
+
+f01015b2 <pgdir_unshare>:
+{
+f01015b2:	55                   	push   %ebp
+f01015b3:	89 e5                	mov    %esp,%ebp
+f01015b5:	57                   	push   %edi
+f01015b6:	56                   	push   %esi
+f01015b7:	53                   	push   %ebx
+f01015b8:	83 ec 1c             	sub    $0x1c,%esp
+	pde_t *pde = &pgdir[PDX(va)];
+f01015bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+f01015be:	c1 e8 16             	shr    $0x16,%eax
+f01015c1:	8b 7d 08             	mov    0x8(%ebp),%edi
+f01015c4:	8d 1c 87             	lea    (%edi,%eax,4),%ebx
+	if ((*pde & (PTE_P | PTE_COW)) != (PTE_P | PTE_COW))
+f01015c7:	8b 03                	mov    (%ebx),%eax
+f01015c9:	89 c1                	mov    %eax,%ecx
+f01015cb:	81 e1 01 08 00 00    	and    $0x801,%ecx
+		return 0;
+f01015d1:	ba 00 00 00 00       	mov    $0x0,%edx
+	if ((*pde & (PTE_P | PTE_COW)) != (PTE_P | PTE_COW))
+f01015d6:	81 f9 01 08 00 00    	cmp    $0x801,%ecx
+f01015dc:	74 0a                	je     f01015e8 <pgdir_unshare+0x36>
+}
+f01015de:	89 d0                	mov    %edx,%eax
+f01015e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01015e3:	5b                   	pop    %ebx
+f01015e4:	5e                   	pop    %esi
+f01015e5:	5f                   	pop    %edi
+f01015e6:	5d                   	pop    %ebp
+f01015e7:	c3                   	ret
+	if (PGNUM(pa) >= npages)
+f01015e8:	89 c2                	mov    %eax,%edx
+f01015ea:	c1 ea 0c             	shr    $0xc,%edx
+f01015ed:	3b 15 74 47 79 f0    	cmp    0xf0794774,%edx
+f01015f3:	73 40                	jae    f0101635 <pgdir_unshare+0x83>
+	return &pages[PGNUM(pa)];
+f01015f5:	8b 0d 68 47 79 f0    	mov    0xf0794768,%ecx
+f01015fb:	8d 34 d1             	lea    (%ecx,%edx,8),%esi
+	if (tp->pp_ref == 1)
+f01015fe:	66 83 7e 04 01       	cmpw   $0x1,0x4(%esi)
+f0101603:	75 47                	jne    f010164c <pgdir_unshare+0x9a>
+		*pde = (*pde & ~PTE_COW) | PTE_W;
+f0101605:	25 fd f7 ff ff       	and    $0xfffff7fd,%eax
+f010160a:	83 c8 02             	or     $0x2,%eax
+f010160d:	89 03                	mov    %eax,(%ebx)
+	asm volatile("movl %%cr3,%0" : "=r" (val));
+f010160f:	0f 20 d9             	mov    %cr3,%ecx
+	if ((uint32_t)kva < KERNBASE)
+f0101612:	81 7d 08 ff ff ff ef 	cmpl   $0xefffffff,0x8(%ebp)
+f0101619:	0f 86 03 01 00 00    	jbe    f0101722 <pgdir_unshare+0x170>
+	return (physaddr_t)kva - KERNBASE;
+f010161f:	8b 45 08             	mov    0x8(%ebp),%eax
+f0101622:	05 00 00 00 10       	add    $0x10000000,%eax
+	return 0;
+f0101627:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (rcr3() == PADDR(pgdir))
+f010162c:	39 c8                	cmp    %ecx,%eax
+f010162e:	75 ae                	jne    f01015de <pgdir_unshare+0x2c>
+	asm volatile("movl %0,%%cr3" : : "r" (val));
+f0101630:	0f 22 d8             	mov    %eax,%cr3
+}
+f0101633:	eb a9                	jmp    f01015de <pgdir_unshare+0x2c>
+		panic("pa2page called with invalid pa");
+f0101635:	83 ec 04             	sub    $0x4,%esp
+f0101638:	68 68 c6 10 f0       	push   $0xf010c668
+f010163d:	68 9d 00 00 00       	push   $0x9d
+f0101642:	68 95 ce 10 f0       	push   $0xf010ce95
+f0101647:	e8 f7 e9 ff ff       	call   f0100043 <_panic>
+		if (!(np = page_alloc(ALLOC_ZERO)))
+f010164c:	83 ec 0c             	sub    $0xc,%esp
+f010164f:	6a 01                	push   $0x1
+f0101651:	e8 8f fb ff ff       	call   f01011e5 <page_alloc>
+f0101656:	89 c7                	mov    %eax,%edi
+f0101658:	83 c4 10             	add    $0x10,%esp
+f010165b:	85 c0                	test   %eax,%eax
+f010165d:	0f 84 d6 00 00 00    	je     f0101739 <pgdir_unshare+0x187>
+	return (pp - pages) << PGSHIFT;
+f0101663:	a1 68 47 79 f0       	mov    0xf0794768,%eax
+f0101668:	89 f2                	mov    %esi,%edx
+f010166a:	29 c2                	sub    %eax,%edx
+f010166c:	c1 fa 03             	sar    $0x3,%edx
+f010166f:	89 d1                	mov    %edx,%ecx
+f0101671:	c1 e1 0c             	shl    $0xc,%ecx
+f0101674:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (PGNUM(pa) >= npages)
+f0101677:	8b 0d 74 47 79 f0    	mov    0xf0794774,%ecx
+f010167d:	81 e2 ff ff 0f 00    	and    $0xfffff,%edx
+f0101683:	39 ca                	cmp    %ecx,%edx
+f0101685:	73 59                	jae    f01016e0 <pgdir_unshare+0x12e>
+	return (void *)(pa + KERNBASE);
+f0101687:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f010168a:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0101690:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	return (pp - pages) << PGSHIFT;
+f0101693:	89 fa                	mov    %edi,%edx
+f0101695:	29 c2                	sub    %eax,%edx
+f0101697:	c1 fa 03             	sar    $0x3,%edx
+f010169a:	89 d0                	mov    %edx,%eax
+f010169c:	c1 e0 0c             	shl    $0xc,%eax
+	if (PGNUM(pa) >= npages)
+f010169f:	81 e2 ff ff 0f 00    	and    $0xfffff,%edx
+f01016a5:	39 ca                	cmp    %ecx,%edx
+f01016a7:	73 4e                	jae    f01016f7 <pgdir_unshare+0x145>
+	return (void *)(pa + KERNBASE);
+f01016a9:	2d 00 00 00 10       	sub    $0x10000000,%eax
+		if (pgtable_copy(page2kva(np), page2kva(tp), -1) < 0) {
+f01016ae:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+f01016b3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f01016b6:	e8 40 fc ff ff       	call   f01012fb <pgtable_copy>
+f01016bb:	85 c0                	test   %eax,%eax
+f01016bd:	78 4d                	js     f010170c <pgdir_unshare+0x15a>
+		np->pp_ref = 1;
+f01016bf:	66 c7 47 04 01 00    	movw   $0x1,0x4(%edi)
+		tp->pp_ref--;
+f01016c5:	66 83 6e 04 01       	subw   $0x1,0x4(%esi)
+	return (pp - pages) << PGSHIFT;
+f01016ca:	89 f8                	mov    %edi,%eax
+f01016cc:	2b 05 68 47 79 f0    	sub    0xf0794768,%eax
+f01016d2:	c1 f8 03             	sar    $0x3,%eax
+f01016d5:	c1 e0 0c             	shl    $0xc,%eax
+		*pde = page2pa(np) | PTE_P | PTE_W | PTE_U;
+f01016d8:	83 c8 07             	or     $0x7,%eax
+f01016db:	e9 2d ff ff ff       	jmp    f010160d <pgdir_unshare+0x5b>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01016e0:	ff 75 e4             	push   -0x1c(%ebp)
+f01016e3:	68 90 be 10 f0       	push   $0xf010be90
+f01016e8:	68 a4 00 00 00       	push   $0xa4
+f01016ed:	68 95 ce 10 f0       	push   $0xf010ce95
+f01016f2:	e8 4c e9 ff ff       	call   f0100043 <_panic>
+f01016f7:	50                   	push   %eax
+f01016f8:	68 90 be 10 f0       	push   $0xf010be90
+f01016fd:	68 a4 00 00 00       	push   $0xa4
+f0101702:	68 95 ce 10 f0       	push   $0xf010ce95
+f0101707:	e8 37 e9 ff ff       	call   f0100043 <_panic>
+			page_free(np);
+f010170c:	83 ec 0c             	sub    $0xc,%esp
+f010170f:	57                   	push   %edi
+f0101710:	e8 5b fb ff ff       	call   f0101270 <page_free>
+			return -E_NO_MEM;
+f0101715:	83 c4 10             	add    $0x10,%esp
+f0101718:	ba fc ff ff ff       	mov    $0xfffffffc,%edx
+f010171d:	e9 bc fe ff ff       	jmp    f01015de <pgdir_unshare+0x2c>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0101722:	ff 75 08             	push   0x8(%ebp)
+f0101725:	68 24 be 10 f0       	push   $0xf010be24
+f010172a:	68 4e 03 00 00       	push   $0x34e
+f010172f:	68 89 ce 10 f0       	push   $0xf010ce89
+f0101734:	e8 0a e9 ff ff       	call   f0100043 <_panic>
+			return -E_NO_MEM;
+f0101739:	ba fc ff ff ff       	mov    $0xfffffffc,%edx
+f010173e:	e9 9b fe ff ff       	jmp    f01015de <pgdir_unshare+0x2c>
+
+f0101743 <pgdir_walk>:
+{
+f0101743:	55                   	push   %ebp
+f0101744:	89 e5                	mov    %esp,%ebp
+f0101746:	56                   	push   %esi
+f0101747:	53                   	push   %ebx
+f0101748:	8b 45 08             	mov    0x8(%ebp),%eax
+f010174b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	pde_t *table_addr = (pde_t *) &pgdir[PDX(va)];
+f010174e:	89 da                	mov    %ebx,%edx
+f0101750:	c1 ea 16             	shr    $0x16,%edx
+f0101753:	8d 34 90             	lea    (%eax,%edx,4),%esi
+  if (create && pgdir_unshare(pgdir, va) < 0) return NULL;
+f0101756:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f010175a:	75 29                	jne    f0101785 <pgdir_walk+0x42>
+  if(*table_addr & PTE_P) {
+f010175c:	8b 06                	mov    (%esi),%eax
+f010175e:	a8 01                	test   $0x1,%al
+f0101760:	0f 84 c9 00 00 00    	je     f010182f <pgdir_walk+0xec>
+    pgtab = KADDR(PTE_ADDR(*table_addr));
+f0101766:	89 c2                	mov    %eax,%edx
+f0101768:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+	if (PGNUM(pa) >= npages)
+f010176e:	c1 e8 0c             	shr    $0xc,%eax
+f0101771:	3b 05 74 47 79 f0    	cmp    0xf0794774,%eax
+f0101777:	0f 83 81 00 00 00    	jae    f01017fe <pgdir_walk+0xbb>
+	return (void *)(pa + KERNBASE);
+f010177d:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0101783:	eb 66                	jmp    f01017eb <pgdir_walk+0xa8>
+  if (create && pgdir_unshare(pgdir, va) < 0) return NULL;
+f0101785:	83 ec 08             	sub    $0x8,%esp
+f0101788:	53                   	push   %ebx
+f0101789:	50                   	push   %eax
+f010178a:	e8 23 fe ff ff       	call   f01015b2 <pgdir_unshare>
+f010178f:	83 c4 10             	add    $0x10,%esp
+f0101792:	85 c0                	test   %eax,%eax
+f0101794:	0f 88 8e 00 00 00    	js     f0101828 <pgdir_walk+0xe5>
+  if(*table_addr & PTE_P) {
+f010179a:	8b 06                	mov    (%esi),%eax
+f010179c:	a8 01                	test   $0x1,%al
+f010179e:	75 c6                	jne    f0101766 <pgdir_walk+0x23>
+    pp = page_alloc(ALLOC_ZERO);
+f01017a0:	83 ec 0c             	sub    $0xc,%esp
+f01017a3:	6a 01                	push   $0x1
+f01017a5:	e8 3b fa ff ff       	call   f01011e5 <page_alloc>
+    if (!pp) return NULL;
+f01017aa:	83 c4 10             	add    $0x10,%esp
+f01017ad:	85 c0                	test   %eax,%eax
+f01017af:	74 46                	je     f01017f7 <pgdir_walk+0xb4>
+    pp->pp_ref = 1;
+f01017b1:	66 c7 40 04 01 00    	movw   $0x1,0x4(%eax)
+	return (pp - pages) << PGSHIFT;
+f01017b7:	89 c2                	mov    %eax,%edx
+f01017b9:	2b 15 68 47 79 f0    	sub    0xf0794768,%edx
+f01017bf:	c1 fa 03             	sar    $0x3,%edx
+f01017c2:	c1 e2 0c             	shl    $0xc,%edx
+    *table_addr = page2pa(pp) | PTE_P | PTE_W | PTE_U;
+f01017c5:	83 ca 07             	or     $0x7,%edx
+f01017c8:	89 16                	mov    %edx,(%esi)
+f01017ca:	2b 05 68 47 79 f0    	sub    0xf0794768,%eax
+f01017d0:	c1 f8 03             	sar    $0x3,%eax
+f01017d3:	89 c2                	mov    %eax,%edx
+f01017d5:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f01017d8:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f01017dd:	3b 05 74 47 79 f0    	cmp    0xf0794774,%eax
+f01017e3:	73 2e                	jae    f0101813 <pgdir_walk+0xd0>
+	return (void *)(pa + KERNBASE);
+f01017e5:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+  return &pgtab[PTX(va)];
+f01017eb:	89 d8                	mov    %ebx,%eax
+f01017ed:	c1 e8 0a             	shr    $0xa,%eax
+f01017f0:	25 fc 0f 00 00       	and    $0xffc,%eax
+f01017f5:	01 d0                	add    %edx,%eax
+}
+f01017f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01017fa:	5b                   	pop    %ebx
+f01017fb:	5e                   	pop    %esi
+f01017fc:	5d                   	pop    %ebp
+f01017fd:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01017fe:	52                   	push   %edx
+f01017ff:	68 90 be 10 f0       	push   $0xf010be90
+f0101804:	68 cb 01 00 00       	push   $0x1cb
+f0101809:	68 89 ce 10 f0       	push   $0xf010ce89
+f010180e:	e8 30 e8 ff ff       	call   f0100043 <_panic>
+f0101813:	52                   	push   %edx
+f0101814:	68 90 be 10 f0       	push   $0xf010be90
+f0101819:	68 a4 00 00 00       	push   $0xa4
+f010181e:	68 95 ce 10 f0       	push   $0xf010ce95
+f0101823:	e8 1b e8 ff ff       	call   f0100043 <_panic>
+  if (create && pgdir_unshare(pgdir, va) < 0) return NULL;
+f0101828:	b8 00 00 00 00       	mov    $0x0,%eax
+f010182d:	eb c8                	jmp    f01017f7 <pgdir_walk+0xb4>
+    if (!create) return NULL;
+f010182f:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101834:	eb c1                	jmp    f01017f7 <pgdir_walk+0xb4>
+
+f0101836 <boot_map_region>:
+{
+f0101836:	55                   	push   %ebp
+f0101837:	89 e5                	mov    %esp,%ebp
+f0101839:	57                   	push   %edi
+f010183a:	56                   	push   %esi
+f010183b:	53                   	push   %ebx
+f010183c:	83 ec 1c             	sub    $0x1c,%esp
+f010183f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0101842:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	for (int i = 0; i < size; i++) {
+f0101845:	89 d3                	mov    %edx,%ebx
+f0101847:	bf 00 00 00 00       	mov    $0x0,%edi
+    uint32_t pai = (uint32_t) pa + i*PGSIZE;
+f010184c:	8b 45 08             	mov    0x8(%ebp),%eax
+f010184f:	29 d0                	sub    %edx,%eax
+f0101851:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	for (int i = 0; i < size; i++) {
+f0101854:	eb 25                	jmp    f010187b <boot_map_region+0x45>
+    uint32_t pai = (uint32_t) pa + i*PGSIZE;
+f0101856:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0101859:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+    pte_t *ppe = pgdir_walk(pgdir, (void *) vai, 1);
+f010185c:	83 ec 04             	sub    $0x4,%esp
+f010185f:	6a 01                	push   $0x1
+f0101861:	53                   	push   %ebx
+f0101862:	ff 75 e0             	push   -0x20(%ebp)
+f0101865:	e8 d9 fe ff ff       	call   f0101743 <pgdir_walk>
+    *ppe = (pte_t) pai | perm;
+f010186a:	0b 75 0c             	or     0xc(%ebp),%esi
+f010186d:	89 30                	mov    %esi,(%eax)
+	for (int i = 0; i < size; i++) {
+f010186f:	83 c7 01             	add    $0x1,%edi
+f0101872:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0101878:	83 c4 10             	add    $0x10,%esp
+f010187b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010187e:	39 c7                	cmp    %eax,%edi
+f0101880:	75 d4                	jne    f0101856 <boot_map_region+0x20>
+}
+f0101882:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101885:	5b                   	pop    %ebx
+f0101886:	5e                   	pop    %esi
+f0101887:	5f                   	pop    %edi
+f0101888:	5d                   	pop    %ebp
+f0101889:	c3                   	ret
+
+f010188a <page_lookup>:
+{
+f010188a:	55                   	push   %ebp
+f010188b:	89 e5                	mov    %esp,%ebp
+f010188d:	53                   	push   %ebx
+f010188e:	83 ec 08             	sub    $0x8,%esp
+f0101891:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	pte_t *pte = pgdir_walk(pgdir, va, 0);
+f0101894:	6a 00                	push   $0x0
+f0101896:	ff 75 0c             	push   0xc(%ebp)
+f0101899:	ff 75 08             	push   0x8(%ebp)
+f010189c:	e8 a2 fe ff ff       	call   f0101743 <pgdir_walk>
+  if (!pte || !(*pte & PTE_P)) return NULL;
+f01018a1:	83 c4 10             	add    $0x10,%esp
+f01018a4:	85 c0                	test   %eax,%eax
+f01018a6:	74 21                	je     f01018c9 <page_lookup+0x3f>
+f01018a8:	f6 00 01             	testb  $0x1,(%eax)
+f01018ab:	74 38                	je     f01018e5 <page_lookup+0x5b>
+  if (pte_store) {
+f01018ad:	85 db                	test   %ebx,%ebx
+f01018af:	74 02                	je     f01018b3 <page_lookup+0x29>
+	  *pte_store = pte;
+f01018b1:	89 03                	mov    %eax,(%ebx)
+	if (PGNUM(pa) >= npages)
+f01018b3:	8b 00                	mov    (%eax),%eax
+f01018b5:	c1 e8 0c             	shr    $0xc,%eax
+f01018b8:	3b 05 74 47 79 f0    	cmp    0xf0794774,%eax
+f01018be:	73 0e                	jae    f01018ce <page_lookup+0x44>
+	return &pages[PGNUM(pa)];
+f01018c0:	8b 15 68 47 79 f0    	mov    0xf0794768,%edx
+f01018c6:	8d 04 c2             	lea    (%edx,%eax,8),%eax
+}
+f01018c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01018cc:	c9                   	leave
+f01018cd:	c3                   	ret
+		panic("pa2page called with invalid pa");
+f01018ce:	83 ec 04             	sub    $0x4,%esp
+f01018d1:	68 68 c6 10 f0       	push   $0xf010c668
+f01018d6:	68 9d 00 00 00       	push   $0x9d
+f01018db:	68 95 ce 10 f0       	push   $0xf010ce95
+f01018e0:	e8 5e e7 ff ff       	call   f0100043 <_panic>
+  if (!pte || !(*pte & PTE_P)) return NULL;
+f01018e5:	b8 00 00 00 00       	mov    $0x0,%eax
+f01018ea:	eb dd                	jmp    f01018c9 <page_lookup+0x3f>
+
+f01018ec <pgdir_next_mapped>:
+{
+f01018ec:	55                   	push   %ebp
+f01018ed:	89 e5                	mov    %esp,%ebp
+f01018ef:	57                   	push   %edi
+f01018f0:	56                   	push   %esi
+f01018f1:	53                   	push   %ebx
+f01018f2:	83 ec 1c             	sub    $0x1c,%esp
+f01018f5:	8b 75 08             	mov    0x8(%ebp),%esi
+f01018f8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	uintptr_t a = ROUNDDOWN(*va, PGSIZE);
+f01018fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+f01018fe:	8b 00                	mov    (%eax),%eax
+f0101900:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0101903:	89 c2                	mov    %eax,%edx
+f0101905:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+	if (PGNUM(pa) >= npages)
+f010190b:	8b 3d 74 47 79 f0    	mov    0xf0794774,%edi
+	while (a < end) {
+f0101911:	39 ca                	cmp    %ecx,%edx
+f0101913:	73 76                	jae    f010198b <pgdir_next_mapped+0x9f>
+		if (!(pgdir[PDX(a)] & PTE_P)) {
+f0101915:	89 d0                	mov    %edx,%eax
+f0101917:	c1 e8 16             	shr    $0x16,%eax
+f010191a:	8b 04 86             	mov    (%esi,%eax,4),%eax
+f010191d:	a8 01                	test   $0x1,%al
+f010191f:	75 0e                	jne    f010192f <pgdir_next_mapped+0x43>
+			a = ROUNDDOWN(a, PTSIZE) + PTSIZE;
+f0101921:	81 e2 00 00 c0 ff    	and    $0xffc00000,%edx
+f0101927:	81 c2 00 00 40 00    	add    $0x400000,%edx
+			continue;
+f010192d:	eb e2                	jmp    f0101911 <pgdir_next_mapped+0x25>
+		pt = KADDR(PTE_ADDR(pgdir[PDX(a)]));
+f010192f:	89 c3                	mov    %eax,%ebx
+f0101931:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+f0101937:	c1 e8 0c             	shr    $0xc,%eax
+f010193a:	39 f8                	cmp    %edi,%eax
+f010193c:	73 2b                	jae    f0101969 <pgdir_next_mapped+0x7d>
+	return (void *)(pa + KERNBASE);
+f010193e:	81 eb 00 00 00 10    	sub    $0x10000000,%ebx
+			if (pt[PTX(a)] & PTE_P) {
+f0101944:	89 d0                	mov    %edx,%eax
+f0101946:	c1 e8 0a             	shr    $0xa,%eax
+f0101949:	25 fc 0f 00 00       	and    $0xffc,%eax
+f010194e:	01 d8                	add    %ebx,%eax
+f0101950:	f6 00 01             	testb  $0x1,(%eax)
+f0101953:	75 29                	jne    f010197e <pgdir_next_mapped+0x92>
+			a += PGSIZE;
+f0101955:	81 c2 00 10 00 00    	add    $0x1000,%edx
+		} while (a < end && PTX(a) != 0);
+f010195b:	39 ca                	cmp    %ecx,%edx
+f010195d:	73 b2                	jae    f0101911 <pgdir_next_mapped+0x25>
+f010195f:	f7 c2 00 f0 3f 00    	test   $0x3ff000,%edx
+f0101965:	75 dd                	jne    f0101944 <pgdir_next_mapped+0x58>
+f0101967:	eb a8                	jmp    f0101911 <pgdir_next_mapped+0x25>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0101969:	53                   	push   %ebx
+f010196a:	68 90 be 10 f0       	push   $0xf010be90
+f010196f:	68 65 03 00 00       	push   $0x365
+f0101974:	68 89 ce 10 f0       	push   $0xf010ce89
+f0101979:	e8 c5 e6 ff ff       	call   f0100043 <_panic>
+				*va = a;
+f010197e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+f0101981:	89 17                	mov    %edx,(%edi)
+}
+f0101983:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101986:	5b                   	pop    %ebx
+f0101987:	5e                   	pop    %esi
+f0101988:	5f                   	pop    %edi
+f0101989:	5d                   	pop    %ebp
+f010198a:	c3                   	ret
+	return NULL;
+f010198b:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101990:	eb f1                	jmp    f0101983 <pgdir_next_mapped+0x97>
+
+f0101992 <tlb_invalidate>:
+{
+f0101992:	55                   	push   %ebp
+f0101993:	89 e5                	mov    %esp,%ebp
+f0101995:	83 ec 08             	sub    $0x8,%esp
+	if (!curenv || curenv->env_pgdir == pgdir)
+f0101998:	e8 9a 72 00 00       	call   f0108c37 <cpunum>
+f010199d:	6b c0 78             	imul   $0x78,%eax,%eax
+f01019a0:	83 b8 28 60 7d f0 00 	cmpl   $0x0,-0xf829fd8(%eax)
+f01019a7:	74 16                	je     f01019bf <tlb_invalidate+0x2d>
+f01019a9:	e8 89 72 00 00       	call   f0108c37 <cpunum>
+f01019ae:	6b c0 78             	imul   $0x78,%eax,%eax
+f01019b1:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f01019b7:	8b 55 08             	mov    0x8(%ebp),%edx
+f01019ba:	39 50 60             	cmp    %edx,0x60(%eax)
+f01019bd:	75 06                	jne    f01019c5 <tlb_invalidate+0x33>
+	asm volatile("invlpg (%0)" : : "r" (addr) : "memory");
+f01019bf:	8b 45 0c             	mov    0xc(%ebp),%eax
+f01019c2:	0f 01 38             	invlpg (%eax)
+}
+f01019c5:	c9                   	leave
+f01019c6:	c3                   	ret
+
+f01019c7 <page_remove>:
+{
+f01019c7:	55                   	push   %ebp
+f01019c8:	89 e5                	mov    %esp,%ebp
+f01019ca:	56                   	push   %esi
+f01019cb:	53                   	push   %ebx
+f01019cc:	83 ec 14             	sub    $0x14,%esp
+f01019cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f01019d2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  struct PageInfo *pi = page_lookup(pgdir, va, &pte);
+f01019d5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f01019d8:	50                   	push   %eax
+f01019d9:	56                   	push   %esi
+f01019da:	53                   	push   %ebx
+f01019db:	e8 aa fe ff ff       	call   f010188a <page_lookup>
+  if (pi && pgdir_unshare(pgdir, va) < 0)
+f01019e0:	83 c4 10             	add    $0x10,%esp
+f01019e3:	85 c0                	test   %eax,%eax
+f01019e5:	74 11                	je     f01019f8 <page_remove+0x31>
+f01019e7:	83 ec 08             	sub    $0x8,%esp
+f01019ea:	56                   	push   %esi
+f01019eb:	53                   	push   %ebx
+f01019ec:	e8 c1 fb ff ff       	call   f01015b2 <pgdir_unshare>
+f01019f1:	83 c4 10             	add    $0x10,%esp
+f01019f4:	85 c0                	test   %eax,%eax
+f01019f6:	78 3b                	js     f0101a33 <page_remove+0x6c>
+  pi = page_lookup(pgdir, va, &pte);
+f01019f8:	83 ec 04             	sub    $0x4,%esp
+f01019fb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f01019fe:	50                   	push   %eax
+f01019ff:	56                   	push   %esi
+f0101a00:	53                   	push   %ebx
+f0101a01:	e8 84 fe ff ff       	call   f010188a <page_lookup>
+  if (pi) {
+f0101a06:	83 c4 10             	add    $0x10,%esp
+f0101a09:	85 c0                	test   %eax,%eax
+f0101a0b:	74 1f                	je     f0101a2c <page_remove+0x65>
+    page_decref(pi);
+f0101a0d:	83 ec 0c             	sub    $0xc,%esp
+f0101a10:	50                   	push   %eax
+f0101a11:	e8 a6 f8 ff ff       	call   f01012bc <page_decref>
+    *pte = 0;
+f0101a16:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f0101a19:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    tlb_invalidate(pgdir, va);
+f0101a1f:	83 c4 08             	add    $0x8,%esp
+f0101a22:	56                   	push   %esi
+f0101a23:	53                   	push   %ebx
+f0101a24:	e8 69 ff ff ff       	call   f0101992 <tlb_invalidate>
+f0101a29:	83 c4 10             	add    $0x10,%esp
+}
+f0101a2c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0101a2f:	5b                   	pop    %ebx
+f0101a30:	5e                   	pop    %esi
+f0101a31:	5d                   	pop    %ebp
+f0101a32:	c3                   	ret
+    panic("page_remove: out of memory unsharing page table");
+f0101a33:	83 ec 04             	sub    $0x4,%esp
+f0101a36:	68 88 c6 10 f0       	push   $0xf010c688
+f0101a3b:	68 53 02 00 00       	push   $0x253
+f0101a40:	68 89 ce 10 f0       	push   $0xf010ce89
+f0101a45:	e8 f9 e5 ff ff       	call   f0100043 <_panic>
+
+f0101a4a <page_insert>:
+{
+f0101a4a:	55                   	push   %ebp
+f0101a4b:	89 e5                	mov    %esp,%ebp
+f0101a4d:	57                   	push   %edi
+f0101a4e:	56                   	push   %esi
+f0101a4f:	53                   	push   %ebx
+f0101a50:	83 ec 10             	sub    $0x10,%esp
+f0101a53:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0101a56:	8b 7d 10             	mov    0x10(%ebp),%edi
+	pte_t *pte = pgdir_walk(pgdir, va, 1);
+f0101a59:	6a 01                	push   $0x1
+f0101a5b:	57                   	push   %edi
+f0101a5c:	ff 75 08             	push   0x8(%ebp)
+f0101a5f:	e8 df fc ff ff       	call   f0101743 <pgdir_walk>
+  if (!pte)
+f0101a64:	83 c4 10             	add    $0x10,%esp
+f0101a67:	85 c0                	test   %eax,%eax
+f0101a69:	74 7f                	je     f0101aea <page_insert+0xa0>
+f0101a6b:	89 c6                	mov    %eax,%esi
+  if (pp->pp_ref >= PAGE_MAXREF
+f0101a6d:	0f b7 43 04          	movzwl 0x4(%ebx),%eax
+f0101a71:	66 3d ff fe          	cmp    $0xfeff,%ax
+f0101a75:	76 1f                	jbe    f0101a96 <page_insert+0x4c>
+      && (!(*pte & PTE_P) || PTE_ADDR(*pte) != page2pa(pp)))
+f0101a77:	8b 0e                	mov    (%esi),%ecx
+f0101a79:	f6 c1 01             	test   $0x1,%cl
+f0101a7c:	74 73                	je     f0101af1 <page_insert+0xa7>
+f0101a7e:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	return (pp - pages) << PGSHIFT;
+f0101a84:	89 da                	mov    %ebx,%edx
+f0101a86:	2b 15 68 47 79 f0    	sub    0xf0794768,%edx
+f0101a8c:	c1 fa 03             	sar    $0x3,%edx
+f0101a8f:	c1 e2 0c             	shl    $0xc,%edx
+f0101a92:	39 d1                	cmp    %edx,%ecx
+f0101a94:	75 62                	jne    f0101af8 <page_insert+0xae>
+  pp->pp_ref++;
+f0101a96:	83 c0 01             	add    $0x1,%eax
+f0101a99:	66 89 43 04          	mov    %ax,0x4(%ebx)
+  if (pp->pp_flags & PP_KSM)
+f0101a9d:	f6 43 06 01          	testb  $0x1,0x6(%ebx)
+f0101aa1:	75 26                	jne    f0101ac9 <page_insert+0x7f>
+  if (*pte & PTE_P) {
+f0101aa3:	f6 06 01             	testb  $0x1,(%esi)
+f0101aa6:	75 31                	jne    f0101ad9 <page_insert+0x8f>
+f0101aa8:	2b 1d 68 47 79 f0    	sub    0xf0794768,%ebx
+f0101aae:	c1 fb 03             	sar    $0x3,%ebx
+f0101ab1:	c1 e3 0c             	shl    $0xc,%ebx
+  *pte = pa | perm | PTE_P;
+f0101ab4:	0b 5d 14             	or     0x14(%ebp),%ebx
+f0101ab7:	83 cb 01             	or     $0x1,%ebx
+f0101aba:	89 1e                	mov    %ebx,(%esi)
+	return 0;
+f0101abc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0101ac1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101ac4:	5b                   	pop    %ebx
+f0101ac5:	5e                   	pop    %esi
+f0101ac6:	5f                   	pop    %edi
+f0101ac7:	5d                   	pop    %ebp
+f0101ac8:	c3                   	ret
+    ksm_page_ref(pp, 1);
+f0101ac9:	83 ec 08             	sub    $0x8,%esp
+f0101acc:	6a 01                	push   $0x1
+f0101ace:	53                   	push   %ebx
+f0101acf:	e8 5b 80 00 00       	call   f0109b2f <ksm_page_ref>
+f0101ad4:	83 c4 10             	add    $0x10,%esp
+f0101ad7:	eb ca                	jmp    f0101aa3 <page_insert+0x59>
+    page_remove(pgdir, va);
+f0101ad9:	83 ec 08             	sub    $0x8,%esp
+f0101adc:	57                   	push   %edi
+f0101add:	ff 75 08             	push   0x8(%ebp)
+f0101ae0:	e8 e2 fe ff ff       	call   f01019c7 <page_remove>
+f0101ae5:	83 c4 10             	add    $0x10,%esp
+f0101ae8:	eb be                	jmp    f0101aa8 <page_insert+0x5e>
+    return -1*E_NO_MEM;
+f0101aea:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0101aef:	eb d0                	jmp    f0101ac1 <page_insert+0x77>
+    return -E_NO_MEM;
+f0101af1:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0101af6:	eb c9                	jmp    f0101ac1 <page_insert+0x77>
+f0101af8:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0101afd:	eb c2                	jmp    f0101ac1 <page_insert+0x77>
+
+f0101aff <page_map_zero>:
+{
+f0101aff:	55                   	push   %ebp
+f0101b00:	89 e5                	mov    %esp,%ebp
+f0101b02:	56                   	push   %esi
+f0101b03:	53                   	push   %ebx
+f0101b04:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (zero_page->pp_ref < ZERO_PAGE_MAXREF) {
+f0101b07:	a1 64 47 79 f0       	mov    0xf0794764,%eax
+f0101b0c:	66 81 78 04 ff fe    	cmpw   $0xfeff,0x4(%eax)
+f0101b12:	77 2c                	ja     f0101b40 <page_map_zero+0x41>
+			perm = (perm & ~PTE_W) | PTE_COW;
+f0101b14:	89 da                	mov    %ebx,%edx
+f0101b16:	81 e2 fd f7 ff ff    	and    $0xfffff7fd,%edx
+f0101b1c:	80 ce 08             	or     $0x8,%dh
+f0101b1f:	f6 c3 02             	test   $0x2,%bl
+f0101b22:	0f 45 da             	cmovne %edx,%ebx
+		return page_insert(pgdir, zero_page, va, perm);
+f0101b25:	53                   	push   %ebx
+f0101b26:	ff 75 0c             	push   0xc(%ebp)
+f0101b29:	50                   	push   %eax
+f0101b2a:	ff 75 08             	push   0x8(%ebp)
+f0101b2d:	e8 18 ff ff ff       	call   f0101a4a <page_insert>
+f0101b32:	89 c3                	mov    %eax,%ebx
+f0101b34:	83 c4 10             	add    $0x10,%esp
+}
+f0101b37:	89 d8                	mov    %ebx,%eax
+f0101b39:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0101b3c:	5b                   	pop    %ebx
+f0101b3d:	5e                   	pop    %esi
+f0101b3e:	5d                   	pop    %ebp
+f0101b3f:	c3                   	ret
+	if (!(pp = page_alloc(ALLOC_ZERO)))
+f0101b40:	83 ec 0c             	sub    $0xc,%esp
+f0101b43:	6a 01                	push   $0x1
+f0101b45:	e8 9b f6 ff ff       	call   f01011e5 <page_alloc>
+f0101b4a:	89 c6                	mov    %eax,%esi
+f0101b4c:	83 c4 10             	add    $0x10,%esp
+f0101b4f:	85 c0                	test   %eax,%eax
+f0101b51:	74 24                	je     f0101b77 <page_map_zero+0x78>
+	if ((r = page_insert(pgdir, pp, va, perm)) < 0)
+f0101b53:	53                   	push   %ebx
+f0101b54:	ff 75 0c             	push   0xc(%ebp)
+f0101b57:	50                   	push   %eax
+f0101b58:	ff 75 08             	push   0x8(%ebp)
+f0101b5b:	e8 ea fe ff ff       	call   f0101a4a <page_insert>
+f0101b60:	89 c3                	mov    %eax,%ebx
+f0101b62:	83 c4 10             	add    $0x10,%esp
+f0101b65:	85 c0                	test   %eax,%eax
+f0101b67:	79 ce                	jns    f0101b37 <page_map_zero+0x38>
+		page_free(pp);
+f0101b69:	83 ec 0c             	sub    $0xc,%esp
+f0101b6c:	56                   	push   %esi
+f0101b6d:	e8 fe f6 ff ff       	call   f0101270 <page_free>
+f0101b72:	83 c4 10             	add    $0x10,%esp
+f0101b75:	eb c0                	jmp    f0101b37 <page_map_zero+0x38>
+		return -E_NO_MEM;
+f0101b77:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+f0101b7c:	eb b9                	jmp    f0101b37 <page_map_zero+0x38>
+
+f0101b7e <page_cow_break>:
+{
+f0101b7e:	55                   	push   %ebp
+f0101b7f:	89 e5                	mov    %esp,%ebp
+f0101b81:	57                   	push   %edi
+f0101b82:	56                   	push   %esi
+f0101b83:	53                   	push   %ebx
+f0101b84:	83 ec 30             	sub    $0x30,%esp
+	va = ROUNDDOWN(va, PGSIZE);
+f0101b87:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0101b8a:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!(pp = page_lookup(pgdir, va, &pte)) || !(*pte & PTE_COW))
+f0101b90:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0101b93:	50                   	push   %eax
+f0101b94:	56                   	push   %esi
+f0101b95:	ff 75 08             	push   0x8(%ebp)
+f0101b98:	e8 ed fc ff ff       	call   f010188a <page_lookup>
+f0101b9d:	83 c4 10             	add    $0x10,%esp
+f0101ba0:	85 c0                	test   %eax,%eax
+f0101ba2:	0f 84 91 01 00 00    	je     f0101d39 <page_cow_break+0x1bb>
+f0101ba8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0101bab:	8b 00                	mov    (%eax),%eax
+f0101bad:	f6 c4 08             	test   $0x8,%ah
+f0101bb0:	0f 84 8d 01 00 00    	je     f0101d43 <page_cow_break+0x1c5>
+	if ((r = pgdir_unshare(pgdir, va)) < 0)
+f0101bb6:	83 ec 08             	sub    $0x8,%esp
+f0101bb9:	56                   	push   %esi
+f0101bba:	ff 75 08             	push   0x8(%ebp)
+f0101bbd:	e8 f0 f9 ff ff       	call   f01015b2 <pgdir_unshare>
+f0101bc2:	89 c3                	mov    %eax,%ebx
+f0101bc4:	83 c4 10             	add    $0x10,%esp
+f0101bc7:	85 c0                	test   %eax,%eax
+f0101bc9:	0f 88 ce 00 00 00    	js     f0101c9d <page_cow_break+0x11f>
+	pp = page_lookup(pgdir, va, &pte);
+f0101bcf:	83 ec 04             	sub    $0x4,%esp
+f0101bd2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0101bd5:	50                   	push   %eax
+f0101bd6:	56                   	push   %esi
+f0101bd7:	ff 75 08             	push   0x8(%ebp)
+f0101bda:	e8 ab fc ff ff       	call   f010188a <page_lookup>
+f0101bdf:	89 c3                	mov    %eax,%ebx
+	perm = (*pte & PTE_SYSCALL & ~PTE_COW) | PTE_W;
+f0101be1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0101be4:	8b 07                	mov    (%edi),%eax
+f0101be6:	25 05 06 00 00       	and    $0x605,%eax
+f0101beb:	83 c8 02             	or     $0x2,%eax
+f0101bee:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	if (pp->pp_ref == 1) {
+f0101bf1:	83 c4 10             	add    $0x10,%esp
+f0101bf4:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f0101bf9:	0f 84 a8 00 00 00    	je     f0101ca7 <page_cow_break+0x129>
+	if (pp == zero_page)
+f0101bff:	39 1d 64 47 79 f0    	cmp    %ebx,0xf0794764
+f0101c05:	0f 84 d9 00 00 00    	je     f0101ce4 <page_cow_break+0x166>
+	else if ((np = page_alloc(0)))
+f0101c0b:	83 ec 0c             	sub    $0xc,%esp
+f0101c0e:	6a 00                	push   $0x0
+f0101c10:	e8 d0 f5 ff ff       	call   f01011e5 <page_alloc>
+f0101c15:	89 c7                	mov    %eax,%edi
+f0101c17:	83 c4 10             	add    $0x10,%esp
+f0101c1a:	85 c0                	test   %eax,%eax
+f0101c1c:	0f 84 2b 01 00 00    	je     f0101d4d <page_cow_break+0x1cf>
+f0101c22:	8b 15 68 47 79 f0    	mov    0xf0794768,%edx
+f0101c28:	29 d3                	sub    %edx,%ebx
+f0101c2a:	89 d8                	mov    %ebx,%eax
+f0101c2c:	c1 f8 03             	sar    $0x3,%eax
+f0101c2f:	89 c1                	mov    %eax,%ecx
+f0101c31:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f0101c34:	8b 1d 74 47 79 f0    	mov    0xf0794774,%ebx
+f0101c3a:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0101c3f:	39 d8                	cmp    %ebx,%eax
+f0101c41:	0f 83 b7 00 00 00    	jae    f0101cfe <page_cow_break+0x180>
+	return (void *)(pa + KERNBASE);
+f0101c47:	81 e9 00 00 00 10    	sub    $0x10000000,%ecx
+	return (pp - pages) << PGSHIFT;
+f0101c4d:	89 f8                	mov    %edi,%eax
+f0101c4f:	29 d0                	sub    %edx,%eax
+f0101c51:	c1 f8 03             	sar    $0x3,%eax
+f0101c54:	89 c2                	mov    %eax,%edx
+f0101c56:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0101c59:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0101c5e:	39 d8                	cmp    %ebx,%eax
+f0101c60:	0f 83 ad 00 00 00    	jae    f0101d13 <page_cow_break+0x195>
+		memcpy(page2kva(np), page2kva(pp), PGSIZE);
+f0101c66:	83 ec 04             	sub    $0x4,%esp
+f0101c69:	68 00 10 00 00       	push   $0x1000
+f0101c6e:	51                   	push   %ecx
+	return (void *)(pa + KERNBASE);
+f0101c6f:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0101c75:	52                   	push   %edx
+f0101c76:	e8 57 69 00 00       	call   f01085d2 <memcpy>
+f0101c7b:	83 c4 10             	add    $0x10,%esp
+	if ((r = page_insert(pgdir, np, va, perm)) < 0) {
+f0101c7e:	ff 75 d4             	push   -0x2c(%ebp)
+f0101c81:	56                   	push   %esi
+f0101c82:	57                   	push   %edi
+f0101c83:	ff 75 08             	push   0x8(%ebp)
+f0101c86:	e8 bf fd ff ff       	call   f0101a4a <page_insert>
+f0101c8b:	89 c3                	mov    %eax,%ebx
+f0101c8d:	83 c4 10             	add    $0x10,%esp
+f0101c90:	85 c0                	test   %eax,%eax
+f0101c92:	0f 88 90 00 00 00    	js     f0101d28 <page_cow_break+0x1aa>
+	return 0;
+f0101c98:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+f0101c9d:	89 d8                	mov    %ebx,%eax
+f0101c9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101ca2:	5b                   	pop    %ebx
+f0101ca3:	5e                   	pop    %esi
+f0101ca4:	5f                   	pop    %edi
+f0101ca5:	5d                   	pop    %ebp
+f0101ca6:	c3                   	ret
+		if (pp->pp_flags & PP_KSM)
+f0101ca7:	f6 43 06 01          	testb  $0x1,0x6(%ebx)
+f0101cab:	75 29                	jne    f0101cd6 <page_cow_break+0x158>
+	return (pp - pages) << PGSHIFT;
+f0101cad:	2b 1d 68 47 79 f0    	sub    0xf0794768,%ebx
+f0101cb3:	c1 fb 03             	sar    $0x3,%ebx
+f0101cb6:	c1 e3 0c             	shl    $0xc,%ebx
+		*pte = page2pa(pp) | perm;
+f0101cb9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0101cbc:	09 c3                	or     %eax,%ebx
+f0101cbe:	89 1f                	mov    %ebx,(%edi)
+		tlb_invalidate(pgdir, va);
+f0101cc0:	83 ec 08             	sub    $0x8,%esp
+f0101cc3:	56                   	push   %esi
+f0101cc4:	ff 75 08             	push   0x8(%ebp)
+f0101cc7:	e8 c6 fc ff ff       	call   f0101992 <tlb_invalidate>
+		return 0;
+f0101ccc:	83 c4 10             	add    $0x10,%esp
+f0101ccf:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0101cd4:	eb c7                	jmp    f0101c9d <page_cow_break+0x11f>
+			ksm_page_unmerge(pp);
+f0101cd6:	83 ec 0c             	sub    $0xc,%esp
+f0101cd9:	53                   	push   %ebx
+f0101cda:	e8 71 7e 00 00       	call   f0109b50 <ksm_page_unmerge>
+f0101cdf:	83 c4 10             	add    $0x10,%esp
+f0101ce2:	eb c9                	jmp    f0101cad <page_cow_break+0x12f>
+		np = page_alloc(ALLOC_ZERO);
+f0101ce4:	83 ec 0c             	sub    $0xc,%esp
+f0101ce7:	6a 01                	push   $0x1
+f0101ce9:	e8 f7 f4 ff ff       	call   f01011e5 <page_alloc>
+f0101cee:	89 c7                	mov    %eax,%edi
+	if (!np)
+f0101cf0:	83 c4 10             	add    $0x10,%esp
+f0101cf3:	85 c0                	test   %eax,%eax
+f0101cf5:	75 87                	jne    f0101c7e <page_cow_break+0x100>
+		return -E_NO_MEM;
+f0101cf7:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+f0101cfc:	eb 9f                	jmp    f0101c9d <page_cow_break+0x11f>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0101cfe:	51                   	push   %ecx
+f0101cff:	68 90 be 10 f0       	push   $0xf010be90
+f0101d04:	68 a4 00 00 00       	push   $0xa4
+f0101d09:	68 95 ce 10 f0       	push   $0xf010ce95
+f0101d0e:	e8 30 e3 ff ff       	call   f0100043 <_panic>
+f0101d13:	52                   	push   %edx
+f0101d14:	68 90 be 10 f0       	push   $0xf010be90
+f0101d19:	68 a4 00 00 00       	push   $0xa4
+f0101d1e:	68 95 ce 10 f0       	push   $0xf010ce95
+f0101d23:	e8 1b e3 ff ff       	call   f0100043 <_panic>
+		page_free(np);
+f0101d28:	83 ec 0c             	sub    $0xc,%esp
+f0101d2b:	57                   	push   %edi
+f0101d2c:	e8 3f f5 ff ff       	call   f0101270 <page_free>
+		return r;
+f0101d31:	83 c4 10             	add    $0x10,%esp
+f0101d34:	e9 64 ff ff ff       	jmp    f0101c9d <page_cow_break+0x11f>
+		return -E_INVAL;
+f0101d39:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0101d3e:	e9 5a ff ff ff       	jmp    f0101c9d <page_cow_break+0x11f>
+f0101d43:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0101d48:	e9 50 ff ff ff       	jmp    f0101c9d <page_cow_break+0x11f>
+		return -E_NO_MEM;
+f0101d4d:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+f0101d52:	e9 46 ff ff ff       	jmp    f0101c9d <page_cow_break+0x11f>
+
+f0101d57 <page_move>:
+{
+f0101d57:	55                   	push   %ebp
+f0101d58:	89 e5                	mov    %esp,%ebp
+f0101d5a:	57                   	push   %edi
+f0101d5b:	56                   	push   %esi
+f0101d5c:	53                   	push   %ebx
+f0101d5d:	83 ec 24             	sub    $0x24,%esp
+	if ((r = pgdir_unshare(srcpgdir, srcva)) < 0)
+f0101d60:	ff 75 0c             	push   0xc(%ebp)
+f0101d63:	ff 75 08             	push   0x8(%ebp)
+f0101d66:	e8 47 f8 ff ff       	call   f01015b2 <pgdir_unshare>
+f0101d6b:	83 c4 10             	add    $0x10,%esp
+f0101d6e:	85 c0                	test   %eax,%eax
+f0101d70:	0f 88 a7 00 00 00    	js     f0101e1d <page_move+0xc6>
+	if (!(dpte = pgdir_walk(dstpgdir, dstva, 1)))
+f0101d76:	83 ec 04             	sub    $0x4,%esp
+f0101d79:	6a 01                	push   $0x1
+f0101d7b:	ff 75 14             	push   0x14(%ebp)
+f0101d7e:	ff 75 10             	push   0x10(%ebp)
+f0101d81:	e8 bd f9 ff ff       	call   f0101743 <pgdir_walk>
+f0101d86:	89 c6                	mov    %eax,%esi
+f0101d88:	83 c4 10             	add    $0x10,%esp
+f0101d8b:	85 c0                	test   %eax,%eax
+f0101d8d:	0f 84 a5 00 00 00    	je     f0101e38 <page_move+0xe1>
+	if (!(pp = page_lookup(srcpgdir, srcva, &spte)))
+f0101d93:	83 ec 04             	sub    $0x4,%esp
+f0101d96:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0101d99:	50                   	push   %eax
+f0101d9a:	ff 75 0c             	push   0xc(%ebp)
+f0101d9d:	ff 75 08             	push   0x8(%ebp)
+f0101da0:	e8 e5 fa ff ff       	call   f010188a <page_lookup>
+f0101da5:	89 c3                	mov    %eax,%ebx
+f0101da7:	83 c4 10             	add    $0x10,%esp
+f0101daa:	85 c0                	test   %eax,%eax
+f0101dac:	0f 84 8d 00 00 00    	je     f0101e3f <page_move+0xe8>
+	if ((*spte & PTE_COW) && (perm & PTE_W))
+f0101db2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0101db5:	f7 07 00 08 00 00    	testl  $0x800,(%edi)
+f0101dbb:	74 16                	je     f0101dd3 <page_move+0x7c>
+		perm = (perm & ~PTE_W) | PTE_COW;
+f0101dbd:	8b 45 18             	mov    0x18(%ebp),%eax
+f0101dc0:	25 fd f7 ff ff       	and    $0xfffff7fd,%eax
+f0101dc5:	80 cc 08             	or     $0x8,%ah
+f0101dc8:	f6 45 18 02          	testb  $0x2,0x18(%ebp)
+f0101dcc:	0f 44 45 18          	cmove  0x18(%ebp),%eax
+f0101dd0:	89 45 18             	mov    %eax,0x18(%ebp)
+	if (dpte != spte) {
+f0101dd3:	39 f7                	cmp    %esi,%edi
+f0101dd5:	74 1c                	je     f0101df3 <page_move+0x9c>
+		if (*dpte & PTE_P)
+f0101dd7:	f6 06 01             	testb  $0x1,(%esi)
+f0101dda:	75 49                	jne    f0101e25 <page_move+0xce>
+		*spte = 0;
+f0101ddc:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		tlb_invalidate(srcpgdir, srcva);
+f0101de2:	83 ec 08             	sub    $0x8,%esp
+f0101de5:	ff 75 0c             	push   0xc(%ebp)
+f0101de8:	ff 75 08             	push   0x8(%ebp)
+f0101deb:	e8 a2 fb ff ff       	call   f0101992 <tlb_invalidate>
+f0101df0:	83 c4 10             	add    $0x10,%esp
+	return (pp - pages) << PGSHIFT;
+f0101df3:	2b 1d 68 47 79 f0    	sub    0xf0794768,%ebx
+f0101df9:	c1 fb 03             	sar    $0x3,%ebx
+f0101dfc:	c1 e3 0c             	shl    $0xc,%ebx
+	*dpte = page2pa(pp) | perm | PTE_P;
+f0101dff:	0b 5d 18             	or     0x18(%ebp),%ebx
+f0101e02:	83 cb 01             	or     $0x1,%ebx
+f0101e05:	89 1e                	mov    %ebx,(%esi)
+	tlb_invalidate(dstpgdir, dstva);
+f0101e07:	83 ec 08             	sub    $0x8,%esp
+f0101e0a:	ff 75 14             	push   0x14(%ebp)
+f0101e0d:	ff 75 10             	push   0x10(%ebp)
+f0101e10:	e8 7d fb ff ff       	call   f0101992 <tlb_invalidate>
+	return 0;
+f0101e15:	83 c4 10             	add    $0x10,%esp
+f0101e18:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0101e1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101e20:	5b                   	pop    %ebx
+f0101e21:	5e                   	pop    %esi
+f0101e22:	5f                   	pop    %edi
+f0101e23:	5d                   	pop    %ebp
+f0101e24:	c3                   	ret
+			page_remove(dstpgdir, dstva);
+f0101e25:	83 ec 08             	sub    $0x8,%esp
+f0101e28:	ff 75 14             	push   0x14(%ebp)
+f0101e2b:	ff 75 10             	push   0x10(%ebp)
+f0101e2e:	e8 94 fb ff ff       	call   f01019c7 <page_remove>
+f0101e33:	83 c4 10             	add    $0x10,%esp
+f0101e36:	eb a4                	jmp    f0101ddc <page_move+0x85>
+		return -E_NO_MEM;
+f0101e38:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0101e3d:	eb de                	jmp    f0101e1d <page_move+0xc6>
+		return -E_INVAL;
+f0101e3f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0101e44:	eb d7                	jmp    f0101e1d <page_move+0xc6>
+
+f0101e46 <mmio_map_region>:
+{
+f0101e46:	55                   	push   %ebp
+f0101e47:	89 e5                	mov    %esp,%ebp
+f0101e49:	53                   	push   %ebx
+f0101e4a:	83 ec 04             	sub    $0x4,%esp
+  size_t round_size = ROUNDUP(size, PGSIZE);
+f0101e4d:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0101e50:	8d 88 ff 0f 00 00    	lea    0xfff(%eax),%ecx
+f0101e56:	89 cb                	mov    %ecx,%ebx
+f0101e58:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if (base + round_size > MMIOLIM) panic("MMIO size too large");
+f0101e5e:	8b 15 00 a3 11 f0    	mov    0xf011a300,%edx
+f0101e64:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+f0101e67:	3d 00 00 c0 ef       	cmp    $0xefc00000,%eax
+f0101e6c:	77 27                	ja     f0101e95 <mmio_map_region+0x4f>
+  boot_map_region(kern_pgdir, base, round_size/PGSIZE, pa, PTE_P | PTE_PCD | PTE_PWT | PTE_W);
+f0101e6e:	c1 e9 0c             	shr    $0xc,%ecx
+f0101e71:	83 ec 08             	sub    $0x8,%esp
+f0101e74:	6a 1b                	push   $0x1b
+f0101e76:	ff 75 08             	push   0x8(%ebp)
+f0101e79:	a1 6c 47 79 f0       	mov    0xf079476c,%eax
+f0101e7e:	e8 b3 f9 ff ff       	call   f0101836 <boot_map_region>
+  uintptr_t old_base = base;
+f0101e83:	a1 00 a3 11 f0       	mov    0xf011a300,%eax
+  base += round_size;
+f0101e88:	01 c3                	add    %eax,%ebx
+f0101e8a:	89 1d 00 a3 11 f0    	mov    %ebx,0xf011a300
+}
+f0101e90:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0101e93:	c9                   	leave
+f0101e94:	c3                   	ret
+  if (base + round_size > MMIOLIM) panic("MMIO size too large");
+f0101e95:	83 ec 04             	sub    $0x4,%esp
+f0101e98:	68 47 cf 10 f0       	push   $0xf010cf47
+f0101e9d:	68 9e 03 00 00       	push   $0x39e
+f0101ea2:	68 89 ce 10 f0       	push   $0xf010ce89
+f0101ea7:	e8 97 e1 ff ff       	call   f0100043 <_panic>
+
+f0101eac <mem_init>:
+{
+f0101eac:	55                   	push   %ebp
+f0101ead:	89 e5                	mov    %esp,%ebp
+f0101eaf:	57                   	push   %edi
+f0101eb0:	56                   	push   %esi
+f0101eb1:	53                   	push   %ebx
+f0101eb2:	83 ec 3c             	sub    $0x3c,%esp
+	for (i = 0; i != e820_map.nr; ++i, ++e) {
+f0101eb5:	8b 35 60 42 79 f0    	mov    0xf0794260,%esi
+	size_t mem = 0, mem_max = -KERNBASE;
+f0101ebb:	bb 00 00 00 00       	mov    $0x0,%ebx
+	for (i = 0; i != e820_map.nr; ++i, ++e) {
+f0101ec0:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101ec5:	eb 03                	jmp    f0101eca <mem_init+0x1e>
+f0101ec7:	83 c0 01             	add    $0x1,%eax
+f0101eca:	39 f0                	cmp    %esi,%eax
+f0101ecc:	74 2d                	je     f0101efb <mem_init+0x4f>
+		if (e->addr >= mem_max)
+f0101ece:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+f0101ed1:	8b 14 8d 64 42 79 f0 	mov    -0xf86bd9c(,%ecx,4),%edx
+f0101ed8:	bf ff ff ff 0f       	mov    $0xfffffff,%edi
+f0101edd:	39 d7                	cmp    %edx,%edi
+f0101edf:	bf 00 00 00 00       	mov    $0x0,%edi
+f0101ee4:	1b 3c 8d 68 42 79 f0 	sbb    -0xf86bd98(,%ecx,4),%edi
+f0101eeb:	72 da                	jb     f0101ec7 <mem_init+0x1b>
+		mem = MAX(mem, (size_t)(e->addr + e->len));
+f0101eed:	03 14 8d 6c 42 79 f0 	add    -0xf86bd94(,%ecx,4),%edx
+f0101ef4:	39 d3                	cmp    %edx,%ebx
+f0101ef6:	0f 42 da             	cmovb  %edx,%ebx
+f0101ef9:	eb cc                	jmp    f0101ec7 <mem_init+0x1b>
+	mem = MIN(mem, mem_max);
+f0101efb:	b8 00 00 00 10       	mov    $0x10000000,%eax
+f0101f00:	39 c3                	cmp    %eax,%ebx
+f0101f02:	0f 47 d8             	cmova  %eax,%ebx
+	npages = mem / PGSIZE;
+f0101f05:	89 d8                	mov    %ebx,%eax
+f0101f07:	c1 e8 0c             	shr    $0xc,%eax
+f0101f0a:	a3 74 47 79 f0       	mov    %eax,0xf0794774
+	cprintf("E820: physical memory %uMB\n", mem / 1024 / 1024);
+f0101f0f:	83 ec 08             	sub    $0x8,%esp
+f0101f12:	c1 eb 14             	shr    $0x14,%ebx
+f0101f15:	53                   	push   %ebx
+f0101f16:	68 5b cf 10 f0       	push   $0xf010cf5b
+f0101f1b:	e8 95 2c 00 00       	call   f0104bb5 <cprintf>
+	kern_pgdir = (pde_t *) boot_alloc(PGSIZE);
+f0101f20:	b8 00 10 00 00       	mov    $0x1000,%eax
+f0101f25:	e8 77 ed ff ff       	call   f0100ca1 <boot_alloc>
+f0101f2a:	a3 6c 47 79 f0       	mov    %eax,0xf079476c
+	memset(kern_pgdir, 0, PGSIZE);
+f0101f2f:	83 c4 0c             	add    $0xc,%esp
+f0101f32:	68 00 10 00 00       	push   $0x1000
+f0101f37:	6a 00                	push   $0x0
+f0101f39:	50                   	push   %eax
+f0101f3a:	e8 fc 65 00 00       	call   f010853b <memset>
+	kern_pgdir[PDX(UVPT)] = PADDR(kern_pgdir) | PTE_U | PTE_P;
+f0101f3f:	a1 6c 47 79 f0       	mov    0xf079476c,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0101f44:	83 c4 10             	add    $0x10,%esp
+f0101f47:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0101f4c:	0f 86 80 00 00 00    	jbe    f0101fd2 <mem_init+0x126>
+	return (physaddr_t)kva - KERNBASE;
+f0101f52:	8d 90 00 00 00 10    	lea    0x10000000(%eax),%edx
+f0101f58:	83 ca 05             	or     $0x5,%edx
+f0101f5b:	89 90 f4 0e 00 00    	mov    %edx,0xef4(%eax)
+  pages = boot_alloc(npages*sizeof(struct PageInfo));
+f0101f61:	a1 74 47 79 f0       	mov    0xf0794774,%eax
+f0101f66:	c1 e0 03             	shl    $0x3,%eax
+f0101f69:	e8 33 ed ff ff       	call   f0100ca1 <boot_alloc>
+f0101f6e:	a3 68 47 79 f0       	mov    %eax,0xf0794768
+	memset(pages, 0, npages*sizeof(struct PageInfo));
+f0101f73:	83 ec 04             	sub    $0x4,%esp
+f0101f76:	8b 3d 74 47 79 f0    	mov    0xf0794774,%edi
+f0101f7c:	8d 14 fd 00 00 00 00 	lea    0x0(,%edi,8),%edx
+f0101f83:	52                   	push   %edx
+f0101f84:	6a 00                	push   $0x0
+f0101f86:	50                   	push   %eax
+f0101f87:	e8 af 65 00 00       	call   f010853b <memset>
+  envs = boot_alloc(NENV*sizeof(struct Env));
+f0101f8c:	b8 00 a0 05 00       	mov    $0x5a000,%eax
+f0101f91:	e8 0b ed ff ff       	call   f0100ca1 <boot_alloc>
+f0101f96:	a3 84 47 79 f0       	mov    %eax,0xf0794784
+	memset(envs, 0, NENV*sizeof(struct Env));
+f0101f9b:	83 c4 0c             	add    $0xc,%esp
+f0101f9e:	68 00 a0 05 00       	push   $0x5a000
+f0101fa3:	6a 00                	push   $0x0
+f0101fa5:	50                   	push   %eax
+f0101fa6:	e8 90 65 00 00       	call   f010853b <memset>
+	page_init();
+f0101fab:	e8 7c f0 ff ff       	call   f010102c <page_init>
+	check_page_free_list(1);
+f0101fb0:	b8 01 00 00 00       	mov    $0x1,%eax
+f0101fb5:	e8 80 ed ff ff       	call   f0100d3a <check_page_free_list>
+	if (!pages)
+f0101fba:	83 c4 10             	add    $0x10,%esp
+f0101fbd:	83 3d 68 47 79 f0 00 	cmpl   $0x0,0xf0794768
+f0101fc4:	74 21                	je     f0101fe7 <mem_init+0x13b>
+	for (pp = page_free_list, nfree = 0; pp; pp = pp->pp_link)
+f0101fc6:	a1 80 47 79 f0       	mov    0xf0794780,%eax
+f0101fcb:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0101fd0:	eb 31                	jmp    f0102003 <mem_init+0x157>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0101fd2:	50                   	push   %eax
+f0101fd3:	68 24 be 10 f0       	push   $0xf010be24
+f0101fd8:	68 8a 00 00 00       	push   $0x8a
+f0101fdd:	68 89 ce 10 f0       	push   $0xf010ce89
+f0101fe2:	e8 5c e0 ff ff       	call   f0100043 <_panic>
+		panic("'pages' is a null pointer!");
+f0101fe7:	83 ec 04             	sub    $0x4,%esp
+f0101fea:	68 77 cf 10 f0       	push   $0xf010cf77
+f0101fef:	68 4a 04 00 00       	push   $0x44a
+f0101ff4:	68 89 ce 10 f0       	push   $0xf010ce89
+f0101ff9:	e8 45 e0 ff ff       	call   f0100043 <_panic>
+		++nfree;
+f0101ffe:	83 c3 01             	add    $0x1,%ebx
+	for (pp = page_free_list, nfree = 0; pp; pp = pp->pp_link)
+f0102001:	8b 00                	mov    (%eax),%eax
+f0102003:	85 c0                	test   %eax,%eax
+f0102005:	75 f7                	jne    f0101ffe <mem_init+0x152>
+	assert((pp0 = page_alloc(0)));
+f0102007:	83 ec 0c             	sub    $0xc,%esp
+f010200a:	6a 00                	push   $0x0
+f010200c:	e8 d4 f1 ff ff       	call   f01011e5 <page_alloc>
+f0102011:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0102014:	83 c4 10             	add    $0x10,%esp
+f0102017:	85 c0                	test   %eax,%eax
+f0102019:	0f 84 fc 01 00 00    	je     f010221b <mem_init+0x36f>
+	assert((pp1 = page_alloc(0)));
+f010201f:	83 ec 0c             	sub    $0xc,%esp
+f0102022:	6a 00                	push   $0x0
+f0102024:	e8 bc f1 ff ff       	call   f01011e5 <page_alloc>
+f0102029:	89 c7                	mov    %eax,%edi
+f010202b:	83 c4 10             	add    $0x10,%esp
+f010202e:	85 c0                	test   %eax,%eax
+f0102030:	0f 84 fe 01 00 00    	je     f0102234 <mem_init+0x388>
+	assert((pp2 = page_alloc(0)));
+f0102036:	83 ec 0c             	sub    $0xc,%esp
+f0102039:	6a 00                	push   $0x0
+f010203b:	e8 a5 f1 ff ff       	call   f01011e5 <page_alloc>
+f0102040:	89 c6                	mov    %eax,%esi
+f0102042:	83 c4 10             	add    $0x10,%esp
+f0102045:	85 c0                	test   %eax,%eax
+f0102047:	0f 84 00 02 00 00    	je     f010224d <mem_init+0x3a1>
+	assert(pp1 && pp1 != pp0);
+f010204d:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+f0102050:	0f 84 10 02 00 00    	je     f0102266 <mem_init+0x3ba>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f0102056:	39 45 d4             	cmp    %eax,-0x2c(%ebp)
+f0102059:	0f 84 20 02 00 00    	je     f010227f <mem_init+0x3d3>
+f010205f:	39 c7                	cmp    %eax,%edi
+f0102061:	0f 84 18 02 00 00    	je     f010227f <mem_init+0x3d3>
+	return (pp - pages) << PGSHIFT;
+f0102067:	8b 0d 68 47 79 f0    	mov    0xf0794768,%ecx
+	assert(page2pa(pp0) < npages*PGSIZE);
+f010206d:	a1 74 47 79 f0       	mov    0xf0794774,%eax
+f0102072:	c1 e0 0c             	shl    $0xc,%eax
+f0102075:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+f0102078:	29 ca                	sub    %ecx,%edx
+f010207a:	c1 fa 03             	sar    $0x3,%edx
+f010207d:	c1 e2 0c             	shl    $0xc,%edx
+f0102080:	39 c2                	cmp    %eax,%edx
+f0102082:	0f 83 10 02 00 00    	jae    f0102298 <mem_init+0x3ec>
+f0102088:	89 fa                	mov    %edi,%edx
+f010208a:	29 ca                	sub    %ecx,%edx
+f010208c:	c1 fa 03             	sar    $0x3,%edx
+f010208f:	c1 e2 0c             	shl    $0xc,%edx
+	assert(page2pa(pp1) < npages*PGSIZE);
+f0102092:	39 c2                	cmp    %eax,%edx
+f0102094:	0f 83 17 02 00 00    	jae    f01022b1 <mem_init+0x405>
+f010209a:	89 f2                	mov    %esi,%edx
+f010209c:	29 ca                	sub    %ecx,%edx
+f010209e:	c1 fa 03             	sar    $0x3,%edx
+f01020a1:	c1 e2 0c             	shl    $0xc,%edx
+	assert(page2pa(pp2) < npages*PGSIZE);
+f01020a4:	39 c2                	cmp    %eax,%edx
+f01020a6:	0f 83 1e 02 00 00    	jae    f01022ca <mem_init+0x41e>
+	fl = page_free_list;
+f01020ac:	a1 80 47 79 f0       	mov    0xf0794780,%eax
+f01020b1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+	page_free_list = 0;
+f01020b4:	c7 05 80 47 79 f0 00 	movl   $0x0,0xf0794780
+f01020bb:	00 00 00 
+	assert(!page_alloc(0));
+f01020be:	83 ec 0c             	sub    $0xc,%esp
+f01020c1:	6a 00                	push   $0x0
+f01020c3:	e8 1d f1 ff ff       	call   f01011e5 <page_alloc>
+f01020c8:	83 c4 10             	add    $0x10,%esp
+f01020cb:	85 c0                	test   %eax,%eax
+f01020cd:	0f 85 10 02 00 00    	jne    f01022e3 <mem_init+0x437>
+	page_free(pp0);
+f01020d3:	83 ec 0c             	sub    $0xc,%esp
+f01020d6:	ff 75 d4             	push   -0x2c(%ebp)
+f01020d9:	e8 92 f1 ff ff       	call   f0101270 <page_free>
+	page_free(pp1);
+f01020de:	89 3c 24             	mov    %edi,(%esp)
+f01020e1:	e8 8a f1 ff ff       	call   f0101270 <page_free>
+	page_free(pp2);
+f01020e6:	89 34 24             	mov    %esi,(%esp)
+f01020e9:	e8 82 f1 ff ff       	call   f0101270 <page_free>
+	assert((pp0 = page_alloc(0)));
+f01020ee:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+f01020f5:	e8 eb f0 ff ff       	call   f01011e5 <page_alloc>
+f01020fa:	89 c6                	mov    %eax,%esi
+f01020fc:	83 c4 10             	add    $0x10,%esp
+f01020ff:	85 c0                	test   %eax,%eax
+f0102101:	0f 84 f5 01 00 00    	je     f01022fc <mem_init+0x450>
+	assert((pp1 = page_alloc(0)));
+f0102107:	83 ec 0c             	sub    $0xc,%esp
+f010210a:	6a 00                	push   $0x0
+f010210c:	e8 d4 f0 ff ff       	call   f01011e5 <page_alloc>
+f0102111:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0102114:	83 c4 10             	add    $0x10,%esp
+f0102117:	85 c0                	test   %eax,%eax
+f0102119:	0f 84 f6 01 00 00    	je     f0102315 <mem_init+0x469>
+	assert((pp2 = page_alloc(0)));
+f010211f:	83 ec 0c             	sub    $0xc,%esp
+f0102122:	6a 00                	push   $0x0
+f0102124:	e8 bc f0 ff ff       	call   f01011e5 <page_alloc>
+f0102129:	89 c7                	mov    %eax,%edi
+f010212b:	83 c4 10             	add    $0x10,%esp
+f010212e:	85 c0                	test   %eax,%eax
+f0102130:	0f 84 f8 01 00 00    	je     f010232e <mem_init+0x482>
+	assert(pp1 && pp1 != pp0);
+f0102136:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0102139:	39 c6                	cmp    %eax,%esi
+f010213b:	0f 84 06 02 00 00    	je     f0102347 <mem_init+0x49b>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f0102141:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+f0102144:	0f 84 16 02 00 00    	je     f0102360 <mem_init+0x4b4>
+f010214a:	39 fe                	cmp    %edi,%esi
+f010214c:	0f 84 0e 02 00 00    	je     f0102360 <mem_init+0x4b4>
+	assert(!page_alloc(0));
+f0102152:	83 ec 0c             	sub    $0xc,%esp
+f0102155:	6a 00                	push   $0x0
+f0102157:	e8 89 f0 ff ff       	call   f01011e5 <page_alloc>
+f010215c:	83 c4 10             	add    $0x10,%esp
+f010215f:	85 c0                	test   %eax,%eax
+f0102161:	0f 85 12 02 00 00    	jne    f0102379 <mem_init+0x4cd>
+f0102167:	89 f0                	mov    %esi,%eax
+f0102169:	2b 05 68 47 79 f0    	sub    0xf0794768,%eax
+f010216f:	c1 f8 03             	sar    $0x3,%eax
+f0102172:	89 c2                	mov    %eax,%edx
+f0102174:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0102177:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f010217c:	3b 05 74 47 79 f0    	cmp    0xf0794774,%eax
+f0102182:	0f 83 0a 02 00 00    	jae    f0102392 <mem_init+0x4e6>
+	memset(page2kva(pp0), 1, PGSIZE);
+f0102188:	83 ec 04             	sub    $0x4,%esp
+f010218b:	68 00 10 00 00       	push   $0x1000
+f0102190:	6a 01                	push   $0x1
+	return (void *)(pa + KERNBASE);
+f0102192:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0102198:	52                   	push   %edx
+f0102199:	e8 9d 63 00 00       	call   f010853b <memset>
+	page_free(pp0);
+f010219e:	89 34 24             	mov    %esi,(%esp)
+f01021a1:	e8 ca f0 ff ff       	call   f0101270 <page_free>
+	assert((pp = page_alloc(ALLOC_ZERO)));
+f01021a6:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+f01021ad:	e8 33 f0 ff ff       	call   f01011e5 <page_alloc>
+f01021b2:	83 c4 10             	add    $0x10,%esp
+f01021b5:	85 c0                	test   %eax,%eax
+f01021b7:	0f 84 ea 01 00 00    	je     f01023a7 <mem_init+0x4fb>
+	assert(pp && pp0 == pp);
+f01021bd:	39 c6                	cmp    %eax,%esi
+f01021bf:	0f 85 fb 01 00 00    	jne    f01023c0 <mem_init+0x514>
+	return (pp - pages) << PGSHIFT;
+f01021c5:	2b 05 68 47 79 f0    	sub    0xf0794768,%eax
+f01021cb:	c1 f8 03             	sar    $0x3,%eax
+f01021ce:	89 c1                	mov    %eax,%ecx
+f01021d0:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f01021d3:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f01021d8:	3b 05 74 47 79 f0    	cmp    0xf0794774,%eax
+f01021de:	0f 83 f5 01 00 00    	jae    f01023d9 <mem_init+0x52d>
+	return (void *)(pa + KERNBASE);
+f01021e4:	8d 81 00 00 00 f0    	lea    -0x10000000(%ecx),%eax
+	for (i = 0; i < PGSIZE; i++)
+f01021ea:	81 e9 00 f0 ff 0f    	sub    $0xffff000,%ecx
+f01021f0:	39 c8                	cmp    %ecx,%eax
+f01021f2:	0f 84 f6 01 00 00    	je     f01023ee <mem_init+0x542>
+		assert(c[i] == 0);
+f01021f8:	0f b6 10             	movzbl (%eax),%edx
+f01021fb:	83 c0 01             	add    $0x1,%eax
+f01021fe:	84 d2                	test   %dl,%dl
+f0102200:	74 ee                	je     f01021f0 <mem_init+0x344>
+f0102202:	68 7a d0 10 f0       	push   $0xf010d07a
+f0102207:	68 bf be 10 f0       	push   $0xf010bebf
+f010220c:	68 78 04 00 00       	push   $0x478
+f0102211:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102216:	e8 28 de ff ff       	call   f0100043 <_panic>
+	assert((pp0 = page_alloc(0)));
+f010221b:	68 92 cf 10 f0       	push   $0xf010cf92
+f0102220:	68 bf be 10 f0       	push   $0xf010bebf
+f0102225:	68 52 04 00 00       	push   $0x452
+f010222a:	68 89 ce 10 f0       	push   $0xf010ce89
+f010222f:	e8 0f de ff ff       	call   f0100043 <_panic>
+	assert((pp1 = page_alloc(0)));
+f0102234:	68 a8 cf 10 f0       	push   $0xf010cfa8
+f0102239:	68 bf be 10 f0       	push   $0xf010bebf
+f010223e:	68 53 04 00 00       	push   $0x453
+f0102243:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102248:	e8 f6 dd ff ff       	call   f0100043 <_panic>
+	assert((pp2 = page_alloc(0)));
+f010224d:	68 be cf 10 f0       	push   $0xf010cfbe
+f0102252:	68 bf be 10 f0       	push   $0xf010bebf
+f0102257:	68 54 04 00 00       	push   $0x454
+f010225c:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102261:	e8 dd dd ff ff       	call   f0100043 <_panic>
+	assert(pp1 && pp1 != pp0);
+f0102266:	68 d4 cf 10 f0       	push   $0xf010cfd4
+f010226b:	68 bf be 10 f0       	push   $0xf010bebf
+f0102270:	68 57 04 00 00       	push   $0x457
+f0102275:	68 89 ce 10 f0       	push   $0xf010ce89
+f010227a:	e8 c4 dd ff ff       	call   f0100043 <_panic>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f010227f:	68 b8 c6 10 f0       	push   $0xf010c6b8
+f0102284:	68 bf be 10 f0       	push   $0xf010bebf
+f0102289:	68 58 04 00 00       	push   $0x458
+f010228e:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102293:	e8 ab dd ff ff       	call   f0100043 <_panic>
+	assert(page2pa(pp0) < npages*PGSIZE);
+f0102298:	68 e6 cf 10 f0       	push   $0xf010cfe6
+f010229d:	68 bf be 10 f0       	push   $0xf010bebf
+f01022a2:	68 59 04 00 00       	push   $0x459
+f01022a7:	68 89 ce 10 f0       	push   $0xf010ce89
+f01022ac:	e8 92 dd ff ff       	call   f0100043 <_panic>
+	assert(page2pa(pp1) < npages*PGSIZE);
+f01022b1:	68 03 d0 10 f0       	push   $0xf010d003
+f01022b6:	68 bf be 10 f0       	push   $0xf010bebf
+f01022bb:	68 5a 04 00 00       	push   $0x45a
+f01022c0:	68 89 ce 10 f0       	push   $0xf010ce89
+f01022c5:	e8 79 dd ff ff       	call   f0100043 <_panic>
+	assert(page2pa(pp2) < npages*PGSIZE);
+f01022ca:	68 20 d0 10 f0       	push   $0xf010d020
+f01022cf:	68 bf be 10 f0       	push   $0xf010bebf
+f01022d4:	68 5b 04 00 00       	push   $0x45b
+f01022d9:	68 89 ce 10 f0       	push   $0xf010ce89
+f01022de:	e8 60 dd ff ff       	call   f0100043 <_panic>
+	assert(!page_alloc(0));
+f01022e3:	68 3d d0 10 f0       	push   $0xf010d03d
+f01022e8:	68 bf be 10 f0       	push   $0xf010bebf
+f01022ed:	68 62 04 00 00       	push   $0x462
+f01022f2:	68 89 ce 10 f0       	push   $0xf010ce89
+f01022f7:	e8 47 dd ff ff       	call   f0100043 <_panic>
+	assert((pp0 = page_alloc(0)));
+f01022fc:	68 92 cf 10 f0       	push   $0xf010cf92
+f0102301:	68 bf be 10 f0       	push   $0xf010bebf
+f0102306:	68 69 04 00 00       	push   $0x469
+f010230b:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102310:	e8 2e dd ff ff       	call   f0100043 <_panic>
+	assert((pp1 = page_alloc(0)));
+f0102315:	68 a8 cf 10 f0       	push   $0xf010cfa8
+f010231a:	68 bf be 10 f0       	push   $0xf010bebf
+f010231f:	68 6a 04 00 00       	push   $0x46a
+f0102324:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102329:	e8 15 dd ff ff       	call   f0100043 <_panic>
+	assert((pp2 = page_alloc(0)));
+f010232e:	68 be cf 10 f0       	push   $0xf010cfbe
+f0102333:	68 bf be 10 f0       	push   $0xf010bebf
+f0102338:	68 6b 04 00 00       	push   $0x46b
+f010233d:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102342:	e8 fc dc ff ff       	call   f0100043 <_panic>
+	assert(pp1 && pp1 != pp0);
+f0102347:	68 d4 cf 10 f0       	push   $0xf010cfd4
+f010234c:	68 bf be 10 f0       	push   $0xf010bebf
+f0102351:	68 6d 04 00 00       	push   $0x46d
+f0102356:	68 89 ce 10 f0       	push   $0xf010ce89
+f010235b:	e8 e3 dc ff ff       	call   f0100043 <_panic>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f0102360:	68 b8 c6 10 f0       	push   $0xf010c6b8
+f0102365:	68 bf be 10 f0       	push   $0xf010bebf
+f010236a:	68 6e 04 00 00       	push   $0x46e
+f010236f:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102374:	e8 ca dc ff ff       	call   f0100043 <_panic>
+	assert(!page_alloc(0));
+f0102379:	68 3d d0 10 f0       	push   $0xf010d03d
+f010237e:	68 bf be 10 f0       	push   $0xf010bebf
+f0102383:	68 6f 04 00 00       	push   $0x46f
+f0102388:	68 89 ce 10 f0       	push   $0xf010ce89
+f010238d:	e8 b1 dc ff ff       	call   f0100043 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0102392:	52                   	push   %edx
+f0102393:	68 90 be 10 f0       	push   $0xf010be90
+f0102398:	68 a4 00 00 00       	push   $0xa4
+f010239d:	68 95 ce 10 f0       	push   $0xf010ce95
+f01023a2:	e8 9c dc ff ff       	call   f0100043 <_panic>
+	assert((pp = page_alloc(ALLOC_ZERO)));
+f01023a7:	68 4c d0 10 f0       	push   $0xf010d04c
+f01023ac:	68 bf be 10 f0       	push   $0xf010bebf
+f01023b1:	68 74 04 00 00       	push   $0x474
+f01023b6:	68 89 ce 10 f0       	push   $0xf010ce89
+f01023bb:	e8 83 dc ff ff       	call   f0100043 <_panic>
+	assert(pp && pp0 == pp);
+f01023c0:	68 6a d0 10 f0       	push   $0xf010d06a
+f01023c5:	68 bf be 10 f0       	push   $0xf010bebf
+f01023ca:	68 75 04 00 00       	push   $0x475
+f01023cf:	68 89 ce 10 f0       	push   $0xf010ce89
+f01023d4:	e8 6a dc ff ff       	call   f0100043 <_panic>
+f01023d9:	51                   	push   %ecx
+f01023da:	68 90 be 10 f0       	push   $0xf010be90
+f01023df:	68 a4 00 00 00       	push   $0xa4
+f01023e4:	68 95 ce 10 f0       	push   $0xf010ce95
+f01023e9:	e8 55 dc ff ff       	call   f0100043 <_panic>
+	page_free_list = fl;
+f01023ee:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f01023f1:	a3 80 47 79 f0       	mov    %eax,0xf0794780
+	page_free(pp0);
+f01023f6:	83 ec 0c             	sub    $0xc,%esp
+f01023f9:	56                   	push   %esi
+f01023fa:	e8 71 ee ff ff       	call   f0101270 <page_free>
+	page_free(pp1);
+f01023ff:	83 c4 04             	add    $0x4,%esp
+f0102402:	ff 75 d4             	push   -0x2c(%ebp)
+f0102405:	e8 66 ee ff ff       	call   f0101270 <page_free>
+	page_free(pp2);
+f010240a:	89 3c 24             	mov    %edi,(%esp)
+f010240d:	e8 5e ee ff ff       	call   f0101270 <page_free>
+	for (pp = page_free_list; pp; pp = pp->pp_link)
+f0102412:	a1 80 47 79 f0       	mov    0xf0794780,%eax
+f0102417:	83 c4 10             	add    $0x10,%esp
+f010241a:	85 c0                	test   %eax,%eax
+f010241c:	74 07                	je     f0102425 <mem_init+0x579>
+		--nfree;
+f010241e:	83 eb 01             	sub    $0x1,%ebx
+	for (pp = page_free_list; pp; pp = pp->pp_link)
+f0102421:	8b 00                	mov    (%eax),%eax
+f0102423:	eb f5                	jmp    f010241a <mem_init+0x56e>
+	assert(nfree == 0);
+f0102425:	85 db                	test   %ebx,%ebx
+f0102427:	0f 85 7e 06 00 00    	jne    f0102aab <mem_init+0xbff>
+	cprintf("check_page_alloc() succeeded!\n");
+f010242d:	83 ec 0c             	sub    $0xc,%esp
+f0102430:	68 d8 c6 10 f0       	push   $0xf010c6d8
+f0102435:	e8 7b 27 00 00       	call   f0104bb5 <cprintf>
+	int i;
+	extern pde_t entry_pgdir[];
+
+	// should be able to allocate three pages
+	pp0 = pp1 = pp2 = 0;
+	assert((pp0 = page_alloc(0)));
+f010243a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+f0102441:	e8 9f ed ff ff       	call   f01011e5 <page_alloc>
+f0102446:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0102449:	83 c4 10             	add    $0x10,%esp
+f010244c:	85 c0                	test   %eax,%eax
+f010244e:	0f 84 70 06 00 00    	je     f0102ac4 <mem_init+0xc18>
+	assert((pp1 = page_alloc(0)));
+f0102454:	83 ec 0c             	sub    $0xc,%esp
+f0102457:	6a 00                	push   $0x0
+f0102459:	e8 87 ed ff ff       	call   f01011e5 <page_alloc>
+f010245e:	89 c7                	mov    %eax,%edi
+f0102460:	83 c4 10             	add    $0x10,%esp
+f0102463:	85 c0                	test   %eax,%eax
+f0102465:	0f 84 72 06 00 00    	je     f0102add <mem_init+0xc31>
+	assert((pp2 = page_alloc(0)));
+f010246b:	83 ec 0c             	sub    $0xc,%esp
+f010246e:	6a 00                	push   $0x0
+f0102470:	e8 70 ed ff ff       	call   f01011e5 <page_alloc>
+f0102475:	89 c3                	mov    %eax,%ebx
+f0102477:	83 c4 10             	add    $0x10,%esp
+f010247a:	85 c0                	test   %eax,%eax
+f010247c:	0f 84 74 06 00 00    	je     f0102af6 <mem_init+0xc4a>
+
+	assert(pp0);
+	assert(pp1 && pp1 != pp0);
+f0102482:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+f0102485:	0f 84 84 06 00 00    	je     f0102b0f <mem_init+0xc63>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f010248b:	39 45 d4             	cmp    %eax,-0x2c(%ebp)
+f010248e:	0f 84 94 06 00 00    	je     f0102b28 <mem_init+0xc7c>
+f0102494:	39 c7                	cmp    %eax,%edi
+f0102496:	0f 84 8c 06 00 00    	je     f0102b28 <mem_init+0xc7c>
+
+	// temporarily steal the rest of the free pages
+	fl = page_free_list;
+f010249c:	a1 80 47 79 f0       	mov    0xf0794780,%eax
+f01024a1:	89 45 cc             	mov    %eax,-0x34(%ebp)
+	page_free_list = 0;
+f01024a4:	c7 05 80 47 79 f0 00 	movl   $0x0,0xf0794780
+f01024ab:	00 00 00 
+
+	// should be no free memory
+	assert(!page_alloc(0));
+f01024ae:	83 ec 0c             	sub    $0xc,%esp
+f01024b1:	6a 00                	push   $0x0
+f01024b3:	e8 2d ed ff ff       	call   f01011e5 <page_alloc>
+f01024b8:	83 c4 10             	add    $0x10,%esp
+f01024bb:	85 c0                	test   %eax,%eax
+f01024bd:	0f 85 7e 06 00 00    	jne    f0102b41 <mem_init+0xc95>
+
+	// there is no page allocated at address 0
+	assert(page_lookup(kern_pgdir, (void *) 0x0, &ptep) == NULL);
+f01024c3:	83 ec 04             	sub    $0x4,%esp
+f01024c6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01024c9:	50                   	push   %eax
+f01024ca:	6a 00                	push   $0x0
+f01024cc:	ff 35 6c 47 79 f0    	push   0xf079476c
+f01024d2:	e8 b3 f3 ff ff       	call   f010188a <page_lookup>
+f01024d7:	83 c4 10             	add    $0x10,%esp
+f01024da:	85 c0                	test   %eax,%eax
+f01024dc:	0f 85 78 06 00 00    	jne    f0102b5a <mem_init+0xcae>
+
+	// there is no free memory, so we can't allocate a page table
+	assert(page_insert(kern_pgdir, pp1, 0x0, PTE_W) < 0);
+f01024e2:	6a 02                	push   $0x2
+f01024e4:	6a 00                	push   $0x0
+f01024e6:	57                   	push   %edi
+f01024e7:	ff 35 6c 47 79 f0    	push   0xf079476c
+f01024ed:	e8 58 f5 ff ff       	call   f0101a4a <page_insert>
+f01024f2:	83 c4 10             	add    $0x10,%esp
+f01024f5:	85 c0                	test   %eax,%eax
+f01024f7:	0f 89 76 06 00 00    	jns    f0102b73 <mem_init+0xcc7>
+
+	// free pp0 and try again: pp0 should be used for page table
+	page_free(pp0);
+f01024fd:	83 ec 0c             	sub    $0xc,%esp
+f0102500:	ff 75 d4             	push   -0x2c(%ebp)
+f0102503:	e8 68 ed ff ff       	call   f0101270 <page_free>
+	assert(page_insert(kern_pgdir, pp1, 0x0, PTE_W) == 0);
+f0102508:	6a 02                	push   $0x2
+f010250a:	6a 00                	push   $0x0
+f010250c:	57                   	push   %edi
+f010250d:	ff 35 6c 47 79 f0    	push   0xf079476c
+f0102513:	e8 32 f5 ff ff       	call   f0101a4a <page_insert>
+f0102518:	83 c4 20             	add    $0x20,%esp
+f010251b:	85 c0                	test   %eax,%eax
+f010251d:	0f 85 69 06 00 00    	jne    f0102b8c <mem_init+0xce0>
+	assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f0102523:	8b 35 6c 47 79 f0    	mov    0xf079476c,%esi
+	return (pp - pages) << PGSHIFT;
+f0102529:	8b 0d 68 47 79 f0    	mov    0xf0794768,%ecx
+f010252f:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+f0102532:	8b 16                	mov    (%esi),%edx
+f0102534:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f010253a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f010253d:	29 c8                	sub    %ecx,%eax
+f010253f:	c1 f8 03             	sar    $0x3,%eax
+f0102542:	c1 e0 0c             	shl    $0xc,%eax
+f0102545:	39 c2                	cmp    %eax,%edx
+f0102547:	0f 85 58 06 00 00    	jne    f0102ba5 <mem_init+0xcf9>
+	assert(check_va2pa(kern_pgdir, 0x0) == page2pa(pp1));
+f010254d:	ba 00 00 00 00       	mov    $0x0,%edx
+f0102552:	89 f0                	mov    %esi,%eax
+f0102554:	e8 7e e7 ff ff       	call   f0100cd7 <check_va2pa>
+f0102559:	89 c2                	mov    %eax,%edx
+f010255b:	89 f8                	mov    %edi,%eax
+f010255d:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+f0102560:	29 c8                	sub    %ecx,%eax
+f0102562:	c1 f8 03             	sar    $0x3,%eax
+f0102565:	c1 e0 0c             	shl    $0xc,%eax
+f0102568:	39 c2                	cmp    %eax,%edx
+f010256a:	0f 85 4e 06 00 00    	jne    f0102bbe <mem_init+0xd12>
+	assert(pp1->pp_ref == 1);
+f0102570:	66 83 7f 04 01       	cmpw   $0x1,0x4(%edi)
+f0102575:	0f 85 5c 06 00 00    	jne    f0102bd7 <mem_init+0xd2b>
+	assert(pp0->pp_ref == 1);
+f010257b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f010257e:	66 83 78 04 01       	cmpw   $0x1,0x4(%eax)
+f0102583:	0f 85 67 06 00 00    	jne    f0102bf0 <mem_init+0xd44>
+
+	// should be able to map pp2 at PGSIZE because pp0 is already allocated for page table
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W) == 0);
+f0102589:	6a 02                	push   $0x2
+f010258b:	68 00 10 00 00       	push   $0x1000
+f0102590:	53                   	push   %ebx
+f0102591:	56                   	push   %esi
+f0102592:	e8 b3 f4 ff ff       	call   f0101a4a <page_insert>
+f0102597:	83 c4 10             	add    $0x10,%esp
+f010259a:	85 c0                	test   %eax,%eax
+f010259c:	0f 85 67 06 00 00    	jne    f0102c09 <mem_init+0xd5d>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f01025a2:	ba 00 10 00 00       	mov    $0x1000,%edx
+f01025a7:	a1 6c 47 79 f0       	mov    0xf079476c,%eax
+f01025ac:	e8 26 e7 ff ff       	call   f0100cd7 <check_va2pa>
+f01025b1:	89 c2                	mov    %eax,%edx
+f01025b3:	89 d8                	mov    %ebx,%eax
+f01025b5:	2b 05 68 47 79 f0    	sub    0xf0794768,%eax
+f01025bb:	c1 f8 03             	sar    $0x3,%eax
+f01025be:	c1 e0 0c             	shl    $0xc,%eax
+f01025c1:	39 c2                	cmp    %eax,%edx
+f01025c3:	0f 85 59 06 00 00    	jne    f0102c22 <mem_init+0xd76>
+	assert(pp2->pp_ref == 1);
+f01025c9:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f01025ce:	0f 85 67 06 00 00    	jne    f0102c3b <mem_init+0xd8f>
+
+	// should be no free memory
+	assert(!page_alloc(0));
+f01025d4:	83 ec 0c             	sub    $0xc,%esp
+f01025d7:	6a 00                	push   $0x0
+f01025d9:	e8 07 ec ff ff       	call   f01011e5 <page_alloc>
+f01025de:	83 c4 10             	add    $0x10,%esp
+f01025e1:	85 c0                	test   %eax,%eax
+f01025e3:	0f 85 6b 06 00 00    	jne    f0102c54 <mem_init+0xda8>
+
+	// should be able to map pp2 at PGSIZE because it's already there
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W) == 0);
+f01025e9:	6a 02                	push   $0x2
+f01025eb:	68 00 10 00 00       	push   $0x1000
+f01025f0:	53                   	push   %ebx
+f01025f1:	ff 35 6c 47 79 f0    	push   0xf079476c
+f01025f7:	e8 4e f4 ff ff       	call   f0101a4a <page_insert>
+f01025fc:	83 c4 10             	add    $0x10,%esp
+f01025ff:	85 c0                	test   %eax,%eax
+f0102601:	0f 85 66 06 00 00    	jne    f0102c6d <mem_init+0xdc1>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f0102607:	ba 00 10 00 00       	mov    $0x1000,%edx
+f010260c:	a1 6c 47 79 f0       	mov    0xf079476c,%eax
+f0102611:	e8 c1 e6 ff ff       	call   f0100cd7 <check_va2pa>
+f0102616:	89 c2                	mov    %eax,%edx
+f0102618:	89 d8                	mov    %ebx,%eax
+f010261a:	2b 05 68 47 79 f0    	sub    0xf0794768,%eax
+f0102620:	c1 f8 03             	sar    $0x3,%eax
+f0102623:	c1 e0 0c             	shl    $0xc,%eax
+f0102626:	39 c2                	cmp    %eax,%edx
+f0102628:	0f 85 58 06 00 00    	jne    f0102c86 <mem_init+0xdda>
+	assert(pp2->pp_ref == 1);
+f010262e:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f0102633:	0f 85 66 06 00 00    	jne    f0102c9f <mem_init+0xdf3>
+
+	// pp2 should NOT be on the free list
+	// could happen in ref counts are handled sloppily in page_insert
+	assert(!page_alloc(0));
+f0102639:	83 ec 0c             	sub    $0xc,%esp
+f010263c:	6a 00                	push   $0x0
+f010263e:	e8 a2 eb ff ff       	call   f01011e5 <page_alloc>
+f0102643:	83 c4 10             	add    $0x10,%esp
+f0102646:	85 c0                	test   %eax,%eax
+f0102648:	0f 85 6a 06 00 00    	jne    f0102cb8 <mem_init+0xe0c>
+
+	// check that pgdir_walk returns a pointer to the pte
+	ptep = (pte_t *) KADDR(PTE_ADDR(kern_pgdir[PDX(PGSIZE)]));
+f010264e:	8b 15 6c 47 79 f0    	mov    0xf079476c,%edx
+f0102654:	8b 02                	mov    (%edx),%eax
+f0102656:	89 c6                	mov    %eax,%esi
+f0102658:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (PGNUM(pa) >= npages)
+f010265e:	c1 e8 0c             	shr    $0xc,%eax
+f0102661:	3b 05 74 47 79 f0    	cmp    0xf0794774,%eax
+f0102667:	0f 83 64 06 00 00    	jae    f0102cd1 <mem_init+0xe25>
+	assert(pgdir_walk(kern_pgdir, (void*)PGSIZE, 0) == ptep+PTX(PGSIZE));
+f010266d:	83 ec 04             	sub    $0x4,%esp
+f0102670:	6a 00                	push   $0x0
+f0102672:	68 00 10 00 00       	push   $0x1000
+f0102677:	52                   	push   %edx
+f0102678:	e8 c6 f0 ff ff       	call   f0101743 <pgdir_walk>
+f010267d:	81 ee fc ff ff 0f    	sub    $0xffffffc,%esi
+f0102683:	83 c4 10             	add    $0x10,%esp
+f0102686:	39 f0                	cmp    %esi,%eax
+f0102688:	0f 85 58 06 00 00    	jne    f0102ce6 <mem_init+0xe3a>
+
+	// should be able to change permissions too.
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W|PTE_U) == 0);
+f010268e:	6a 06                	push   $0x6
+f0102690:	68 00 10 00 00       	push   $0x1000
+f0102695:	53                   	push   %ebx
+f0102696:	ff 35 6c 47 79 f0    	push   0xf079476c
+f010269c:	e8 a9 f3 ff ff       	call   f0101a4a <page_insert>
+f01026a1:	83 c4 10             	add    $0x10,%esp
+f01026a4:	85 c0                	test   %eax,%eax
+f01026a6:	0f 85 53 06 00 00    	jne    f0102cff <mem_init+0xe53>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f01026ac:	8b 35 6c 47 79 f0    	mov    0xf079476c,%esi
+f01026b2:	ba 00 10 00 00       	mov    $0x1000,%edx
+f01026b7:	89 f0                	mov    %esi,%eax
+f01026b9:	e8 19 e6 ff ff       	call   f0100cd7 <check_va2pa>
+f01026be:	89 c2                	mov    %eax,%edx
+	return (pp - pages) << PGSHIFT;
+f01026c0:	89 d8                	mov    %ebx,%eax
+f01026c2:	2b 05 68 47 79 f0    	sub    0xf0794768,%eax
+f01026c8:	c1 f8 03             	sar    $0x3,%eax
+f01026cb:	c1 e0 0c             	shl    $0xc,%eax
+f01026ce:	39 c2                	cmp    %eax,%edx
+f01026d0:	0f 85 42 06 00 00    	jne    f0102d18 <mem_init+0xe6c>
+	assert(pp2->pp_ref == 1);
+f01026d6:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f01026db:	0f 85 50 06 00 00    	jne    f0102d31 <mem_init+0xe85>
+	assert(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_U);
+f01026e1:	83 ec 04             	sub    $0x4,%esp
+f01026e4:	6a 00                	push   $0x0
+f01026e6:	68 00 10 00 00       	push   $0x1000
+f01026eb:	56                   	push   %esi
+f01026ec:	e8 52 f0 ff ff       	call   f0101743 <pgdir_walk>
+f01026f1:	83 c4 10             	add    $0x10,%esp
+f01026f4:	f6 00 04             	testb  $0x4,(%eax)
+f01026f7:	0f 84 4d 06 00 00    	je     f0102d4a <mem_init+0xe9e>
+	assert(kern_pgdir[0] & PTE_U);
+f01026fd:	a1 6c 47 79 f0       	mov    0xf079476c,%eax
+f0102702:	f6 00 04             	testb  $0x4,(%eax)
+f0102705:	0f 84 58 06 00 00    	je     f0102d63 <mem_init+0xeb7>
+
+	// should be able to remap with fewer permissions
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W) == 0);
+f010270b:	6a 02                	push   $0x2
+f010270d:	68 00 10 00 00       	push   $0x1000
+f0102712:	53                   	push   %ebx
+f0102713:	50                   	push   %eax
+f0102714:	e8 31 f3 ff ff       	call   f0101a4a <page_insert>
+f0102719:	83 c4 10             	add    $0x10,%esp
+f010271c:	85 c0                	test   %eax,%eax
+f010271e:	0f 85 58 06 00 00    	jne    f0102d7c <mem_init+0xed0>
+	assert(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_W);
+f0102724:	83 ec 04             	sub    $0x4,%esp
+f0102727:	6a 00                	push   $0x0
+f0102729:	68 00 10 00 00       	push   $0x1000
+f010272e:	ff 35 6c 47 79 f0    	push   0xf079476c
+f0102734:	e8 0a f0 ff ff       	call   f0101743 <pgdir_walk>
+f0102739:	83 c4 10             	add    $0x10,%esp
+f010273c:	f6 00 02             	testb  $0x2,(%eax)
+f010273f:	0f 84 50 06 00 00    	je     f0102d95 <mem_init+0xee9>
+	assert(!(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_U));
+f0102745:	83 ec 04             	sub    $0x4,%esp
+f0102748:	6a 00                	push   $0x0
+f010274a:	68 00 10 00 00       	push   $0x1000
+f010274f:	ff 35 6c 47 79 f0    	push   0xf079476c
+f0102755:	e8 e9 ef ff ff       	call   f0101743 <pgdir_walk>
+f010275a:	83 c4 10             	add    $0x10,%esp
+f010275d:	f6 00 04             	testb  $0x4,(%eax)
+f0102760:	0f 85 48 06 00 00    	jne    f0102dae <mem_init+0xf02>
+
+	// should not be able to map at PTSIZE because need free page for page table
+	assert(page_insert(kern_pgdir, pp0, (void*) PTSIZE, PTE_W) < 0);
+f0102766:	6a 02                	push   $0x2
+f0102768:	68 00 00 40 00       	push   $0x400000
+f010276d:	ff 75 d4             	push   -0x2c(%ebp)
+f0102770:	ff 35 6c 47 79 f0    	push   0xf079476c
+f0102776:	e8 cf f2 ff ff       	call   f0101a4a <page_insert>
+f010277b:	83 c4 10             	add    $0x10,%esp
+f010277e:	85 c0                	test   %eax,%eax
+f0102780:	0f 89 41 06 00 00    	jns    f0102dc7 <mem_init+0xf1b>
+
+	// insert pp1 at PGSIZE (replacing pp2)
+	assert(page_insert(kern_pgdir, pp1, (void*) PGSIZE, PTE_W) == 0);
+f0102786:	6a 02                	push   $0x2
+f0102788:	68 00 10 00 00       	push   $0x1000
+f010278d:	57                   	push   %edi
+f010278e:	ff 35 6c 47 79 f0    	push   0xf079476c
+f0102794:	e8 b1 f2 ff ff       	call   f0101a4a <page_insert>
+f0102799:	83 c4 10             	add    $0x10,%esp
+f010279c:	85 c0                	test   %eax,%eax
+f010279e:	0f 85 3c 06 00 00    	jne    f0102de0 <mem_init+0xf34>
+	assert(!(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_U));
+f01027a4:	83 ec 04             	sub    $0x4,%esp
+f01027a7:	6a 00                	push   $0x0
+f01027a9:	68 00 10 00 00       	push   $0x1000
+f01027ae:	ff 35 6c 47 79 f0    	push   0xf079476c
+f01027b4:	e8 8a ef ff ff       	call   f0101743 <pgdir_walk>
+f01027b9:	83 c4 10             	add    $0x10,%esp
+f01027bc:	f6 00 04             	testb  $0x4,(%eax)
+f01027bf:	0f 85 34 06 00 00    	jne    f0102df9 <mem_init+0xf4d>
+
+	// should have pp1 at both 0 and PGSIZE, pp2 nowhere, ...
+	assert(check_va2pa(kern_pgdir, 0) == page2pa(pp1));
+f01027c5:	a1 6c 47 79 f0       	mov    0xf079476c,%eax
+f01027ca:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f01027cd:	ba 00 00 00 00       	mov    $0x0,%edx
+f01027d2:	e8 00 e5 ff ff       	call   f0100cd7 <check_va2pa>
+f01027d7:	89 fe                	mov    %edi,%esi
+f01027d9:	2b 35 68 47 79 f0    	sub    0xf0794768,%esi
+f01027df:	c1 fe 03             	sar    $0x3,%esi
+f01027e2:	c1 e6 0c             	shl    $0xc,%esi
+f01027e5:	39 f0                	cmp    %esi,%eax
+f01027e7:	0f 85 25 06 00 00    	jne    f0102e12 <mem_init+0xf66>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp1));
+f01027ed:	ba 00 10 00 00       	mov    $0x1000,%edx
+f01027f2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f01027f5:	e8 dd e4 ff ff       	call   f0100cd7 <check_va2pa>
+f01027fa:	39 c6                	cmp    %eax,%esi
+f01027fc:	0f 85 29 06 00 00    	jne    f0102e2b <mem_init+0xf7f>
+	// ... and ref counts should reflect this
+	assert(pp1->pp_ref == 2);
+f0102802:	66 83 7f 04 02       	cmpw   $0x2,0x4(%edi)
+f0102807:	0f 85 37 06 00 00    	jne    f0102e44 <mem_init+0xf98>
+	assert(pp2->pp_ref == 0);
+f010280d:	66 83 7b 04 00       	cmpw   $0x0,0x4(%ebx)
+f0102812:	0f 85 45 06 00 00    	jne    f0102e5d <mem_init+0xfb1>
+
+	// pp2 should be returned by page_alloc
+	assert((pp = page_alloc(0)) && pp == pp2);
+f0102818:	83 ec 0c             	sub    $0xc,%esp
+f010281b:	6a 00                	push   $0x0
+f010281d:	e8 c3 e9 ff ff       	call   f01011e5 <page_alloc>
+f0102822:	83 c4 10             	add    $0x10,%esp
+f0102825:	85 c0                	test   %eax,%eax
+f0102827:	0f 84 49 06 00 00    	je     f0102e76 <mem_init+0xfca>
+f010282d:	39 c3                	cmp    %eax,%ebx
+f010282f:	0f 85 41 06 00 00    	jne    f0102e76 <mem_init+0xfca>
+
+	// unmapping pp1 at 0 should keep pp1 at PGSIZE
+	page_remove(kern_pgdir, 0x0);
+f0102835:	83 ec 08             	sub    $0x8,%esp
+f0102838:	6a 00                	push   $0x0
+f010283a:	ff 35 6c 47 79 f0    	push   0xf079476c
+f0102840:	e8 82 f1 ff ff       	call   f01019c7 <page_remove>
+	assert(check_va2pa(kern_pgdir, 0x0) == ~0);
+f0102845:	8b 35 6c 47 79 f0    	mov    0xf079476c,%esi
+f010284b:	ba 00 00 00 00       	mov    $0x0,%edx
+f0102850:	89 f0                	mov    %esi,%eax
+f0102852:	e8 80 e4 ff ff       	call   f0100cd7 <check_va2pa>
+f0102857:	83 c4 10             	add    $0x10,%esp
+f010285a:	83 f8 ff             	cmp    $0xffffffff,%eax
+f010285d:	0f 85 2c 06 00 00    	jne    f0102e8f <mem_init+0xfe3>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp1));
+f0102863:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0102868:	89 f0                	mov    %esi,%eax
+f010286a:	e8 68 e4 ff ff       	call   f0100cd7 <check_va2pa>
+f010286f:	89 c2                	mov    %eax,%edx
+f0102871:	89 f8                	mov    %edi,%eax
+f0102873:	2b 05 68 47 79 f0    	sub    0xf0794768,%eax
+f0102879:	c1 f8 03             	sar    $0x3,%eax
+f010287c:	c1 e0 0c             	shl    $0xc,%eax
+f010287f:	39 c2                	cmp    %eax,%edx
+f0102881:	0f 85 21 06 00 00    	jne    f0102ea8 <mem_init+0xffc>
+	assert(pp1->pp_ref == 1);
+f0102887:	66 83 7f 04 01       	cmpw   $0x1,0x4(%edi)
+f010288c:	0f 85 2f 06 00 00    	jne    f0102ec1 <mem_init+0x1015>
+	assert(pp2->pp_ref == 0);
+f0102892:	66 83 7b 04 00       	cmpw   $0x0,0x4(%ebx)
+f0102897:	0f 85 3d 06 00 00    	jne    f0102eda <mem_init+0x102e>
+
+	// test re-inserting pp1 at PGSIZE
+	assert(page_insert(kern_pgdir, pp1, (void*) PGSIZE, 0) == 0);
+f010289d:	6a 00                	push   $0x0
+f010289f:	68 00 10 00 00       	push   $0x1000
+f01028a4:	57                   	push   %edi
+f01028a5:	56                   	push   %esi
+f01028a6:	e8 9f f1 ff ff       	call   f0101a4a <page_insert>
+f01028ab:	83 c4 10             	add    $0x10,%esp
+f01028ae:	85 c0                	test   %eax,%eax
+f01028b0:	0f 85 3d 06 00 00    	jne    f0102ef3 <mem_init+0x1047>
+	assert(pp1->pp_ref);
+f01028b6:	66 83 7f 04 00       	cmpw   $0x0,0x4(%edi)
+f01028bb:	0f 84 4b 06 00 00    	je     f0102f0c <mem_init+0x1060>
+	assert(pp1->pp_link == NULL);
+f01028c1:	83 3f 00             	cmpl   $0x0,(%edi)
+f01028c4:	0f 85 5b 06 00 00    	jne    f0102f25 <mem_init+0x1079>
+
+	// unmapping pp1 at PGSIZE should free it
+	page_remove(kern_pgdir, (void*) PGSIZE);
+f01028ca:	83 ec 08             	sub    $0x8,%esp
+f01028cd:	68 00 10 00 00       	push   $0x1000
+f01028d2:	ff 35 6c 47 79 f0    	push   0xf079476c
+f01028d8:	e8 ea f0 ff ff       	call   f01019c7 <page_remove>
+	assert(check_va2pa(kern_pgdir, 0x0) == ~0);
+f01028dd:	8b 35 6c 47 79 f0    	mov    0xf079476c,%esi
+f01028e3:	ba 00 00 00 00       	mov    $0x0,%edx
+f01028e8:	89 f0                	mov    %esi,%eax
+f01028ea:	e8 e8 e3 ff ff       	call   f0100cd7 <check_va2pa>
+f01028ef:	83 c4 10             	add    $0x10,%esp
+f01028f2:	83 f8 ff             	cmp    $0xffffffff,%eax
+f01028f5:	0f 85 43 06 00 00    	jne    f0102f3e <mem_init+0x1092>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == ~0);
+f01028fb:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0102900:	89 f0                	mov    %esi,%eax
+f0102902:	e8 d0 e3 ff ff       	call   f0100cd7 <check_va2pa>
+f0102907:	83 f8 ff             	cmp    $0xffffffff,%eax
+f010290a:	0f 85 47 06 00 00    	jne    f0102f57 <mem_init+0x10ab>
+	assert(pp1->pp_ref == 0);
+f0102910:	66 83 7f 04 00       	cmpw   $0x0,0x4(%edi)
+f0102915:	0f 85 55 06 00 00    	jne    f0102f70 <mem_init+0x10c4>
+	assert(pp2->pp_ref == 0);
+f010291b:	66 83 7b 04 00       	cmpw   $0x0,0x4(%ebx)
+f0102920:	0f 85 63 06 00 00    	jne    f0102f89 <mem_init+0x10dd>
+
+	// so it should be returned by page_alloc
+	assert((pp = page_alloc(0)) && pp == pp1);
+f0102926:	83 ec 0c             	sub    $0xc,%esp
+f0102929:	6a 00                	push   $0x0
+f010292b:	e8 b5 e8 ff ff       	call   f01011e5 <page_alloc>
+f0102930:	83 c4 10             	add    $0x10,%esp
+f0102933:	39 c7                	cmp    %eax,%edi
+f0102935:	0f 85 67 06 00 00    	jne    f0102fa2 <mem_init+0x10f6>
+f010293b:	85 c0                	test   %eax,%eax
+f010293d:	0f 84 5f 06 00 00    	je     f0102fa2 <mem_init+0x10f6>
+
+	// should be no free memory
+	assert(!page_alloc(0));
+f0102943:	83 ec 0c             	sub    $0xc,%esp
+f0102946:	6a 00                	push   $0x0
+f0102948:	e8 98 e8 ff ff       	call   f01011e5 <page_alloc>
+f010294d:	83 c4 10             	add    $0x10,%esp
+f0102950:	85 c0                	test   %eax,%eax
+f0102952:	0f 85 63 06 00 00    	jne    f0102fbb <mem_init+0x110f>
+
+	// forcibly take pp0 back
+	assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f0102958:	8b 0d 6c 47 79 f0    	mov    0xf079476c,%ecx
+f010295e:	8b 11                	mov    (%ecx),%edx
+f0102960:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f0102966:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0102969:	2b 05 68 47 79 f0    	sub    0xf0794768,%eax
+f010296f:	c1 f8 03             	sar    $0x3,%eax
+f0102972:	c1 e0 0c             	shl    $0xc,%eax
+f0102975:	39 c2                	cmp    %eax,%edx
+f0102977:	0f 85 57 06 00 00    	jne    f0102fd4 <mem_init+0x1128>
+	kern_pgdir[0] = 0;
+f010297d:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+	assert(pp0->pp_ref == 1);
+f0102983:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0102986:	66 83 78 04 01       	cmpw   $0x1,0x4(%eax)
+f010298b:	0f 85 5c 06 00 00    	jne    f0102fed <mem_init+0x1141>
+	pp0->pp_ref = 0;
+f0102991:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0102994:	66 c7 40 04 00 00    	movw   $0x0,0x4(%eax)
+
+	// check pointer arithmetic in pgdir_walk
+	page_free(pp0);
+f010299a:	83 ec 0c             	sub    $0xc,%esp
+f010299d:	50                   	push   %eax
+f010299e:	e8 cd e8 ff ff       	call   f0101270 <page_free>
+	va = (void*)(PGSIZE * NPDENTRIES + PGSIZE);
+	ptep = pgdir_walk(kern_pgdir, va, 1);
+f01029a3:	83 c4 0c             	add    $0xc,%esp
+f01029a6:	6a 01                	push   $0x1
+f01029a8:	68 00 10 40 00       	push   $0x401000
+f01029ad:	ff 35 6c 47 79 f0    	push   0xf079476c
+f01029b3:	e8 8b ed ff ff       	call   f0101743 <pgdir_walk>
+f01029b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+	ptep1 = (pte_t *) KADDR(PTE_ADDR(kern_pgdir[PDX(va)]));
+f01029bb:	8b 0d 6c 47 79 f0    	mov    0xf079476c,%ecx
+f01029c1:	8b 41 04             	mov    0x4(%ecx),%eax
+f01029c4:	89 c6                	mov    %eax,%esi
+f01029c6:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (PGNUM(pa) >= npages)
+f01029cc:	8b 15 74 47 79 f0    	mov    0xf0794774,%edx
+f01029d2:	c1 e8 0c             	shr    $0xc,%eax
+f01029d5:	83 c4 10             	add    $0x10,%esp
+f01029d8:	39 d0                	cmp    %edx,%eax
+f01029da:	0f 83 26 06 00 00    	jae    f0103006 <mem_init+0x115a>
+	assert(ptep == ptep1 + PTX(va));
+f01029e0:	81 ee fc ff ff 0f    	sub    $0xffffffc,%esi
+f01029e6:	39 75 d0             	cmp    %esi,-0x30(%ebp)
+f01029e9:	0f 85 2c 06 00 00    	jne    f010301b <mem_init+0x116f>
+	kern_pgdir[PDX(va)] = 0;
+f01029ef:	c7 41 04 00 00 00 00 	movl   $0x0,0x4(%ecx)
+	pp0->pp_ref = 0;
+f01029f6:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f01029f9:	66 c7 40 04 00 00    	movw   $0x0,0x4(%eax)
+	return (pp - pages) << PGSHIFT;
+f01029ff:	2b 05 68 47 79 f0    	sub    0xf0794768,%eax
+f0102a05:	c1 f8 03             	sar    $0x3,%eax
+f0102a08:	89 c1                	mov    %eax,%ecx
+f0102a0a:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f0102a0d:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0102a12:	39 d0                	cmp    %edx,%eax
+f0102a14:	0f 83 1a 06 00 00    	jae    f0103034 <mem_init+0x1188>
+
+	// check that new page tables get cleared
+	memset(page2kva(pp0), 0xFF, PGSIZE);
+f0102a1a:	83 ec 04             	sub    $0x4,%esp
+f0102a1d:	68 00 10 00 00       	push   $0x1000
+f0102a22:	68 ff 00 00 00       	push   $0xff
+	return (void *)(pa + KERNBASE);
+f0102a27:	81 e9 00 00 00 10    	sub    $0x10000000,%ecx
+f0102a2d:	51                   	push   %ecx
+f0102a2e:	e8 08 5b 00 00       	call   f010853b <memset>
+	page_free(pp0);
+f0102a33:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+f0102a36:	89 34 24             	mov    %esi,(%esp)
+f0102a39:	e8 32 e8 ff ff       	call   f0101270 <page_free>
+	pgdir_walk(kern_pgdir, 0x0, 1);
+f0102a3e:	83 c4 0c             	add    $0xc,%esp
+f0102a41:	6a 01                	push   $0x1
+f0102a43:	6a 00                	push   $0x0
+f0102a45:	ff 35 6c 47 79 f0    	push   0xf079476c
+f0102a4b:	e8 f3 ec ff ff       	call   f0101743 <pgdir_walk>
+	return (pp - pages) << PGSHIFT;
+f0102a50:	89 f0                	mov    %esi,%eax
+f0102a52:	2b 05 68 47 79 f0    	sub    0xf0794768,%eax
+f0102a58:	c1 f8 03             	sar    $0x3,%eax
+f0102a5b:	89 c1                	mov    %eax,%ecx
+f0102a5d:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f0102a60:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0102a65:	83 c4 10             	add    $0x10,%esp
+f0102a68:	3b 05 74 47 79 f0    	cmp    0xf0794774,%eax
+f0102a6e:	0f 83 d5 05 00 00    	jae    f0103049 <mem_init+0x119d>
+	return (void *)(pa + KERNBASE);
+f0102a74:	8d 81 00 00 00 f0    	lea    -0x10000000(%ecx),%eax
+	ptep = (pte_t *) page2kva(pp0);
+	for(i=0; i<NPTENTRIES; i++)
+f0102a7a:	81 e9 00 f0 ff 0f    	sub    $0xffff000,%ecx
+f0102a80:	39 c8                	cmp    %ecx,%eax
+f0102a82:	0f 84 d6 05 00 00    	je     f010305e <mem_init+0x11b2>
+		assert((ptep[i] & PTE_P) == 0);
+f0102a88:	8b 10                	mov    (%eax),%edx
+f0102a8a:	83 c0 04             	add    $0x4,%eax
+f0102a8d:	f6 c2 01             	test   $0x1,%dl
+f0102a90:	74 ee                	je     f0102a80 <mem_init+0xbd4>
+f0102a92:	68 44 d1 10 f0       	push   $0xf010d144
+f0102a97:	68 bf be 10 f0       	push   $0xf010bebf
+f0102a9c:	68 64 05 00 00       	push   $0x564
+f0102aa1:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102aa6:	e8 98 d5 ff ff       	call   f0100043 <_panic>
+	assert(nfree == 0);
+f0102aab:	68 84 d0 10 f0       	push   $0xf010d084
+f0102ab0:	68 bf be 10 f0       	push   $0xf010bebf
+f0102ab5:	68 85 04 00 00       	push   $0x485
+f0102aba:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102abf:	e8 7f d5 ff ff       	call   f0100043 <_panic>
+	assert((pp0 = page_alloc(0)));
+f0102ac4:	68 92 cf 10 f0       	push   $0xf010cf92
+f0102ac9:	68 bf be 10 f0       	push   $0xf010bebf
+f0102ace:	68 e7 04 00 00       	push   $0x4e7
+f0102ad3:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102ad8:	e8 66 d5 ff ff       	call   f0100043 <_panic>
+	assert((pp1 = page_alloc(0)));
+f0102add:	68 a8 cf 10 f0       	push   $0xf010cfa8
+f0102ae2:	68 bf be 10 f0       	push   $0xf010bebf
+f0102ae7:	68 e8 04 00 00       	push   $0x4e8
+f0102aec:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102af1:	e8 4d d5 ff ff       	call   f0100043 <_panic>
+	assert((pp2 = page_alloc(0)));
+f0102af6:	68 be cf 10 f0       	push   $0xf010cfbe
+f0102afb:	68 bf be 10 f0       	push   $0xf010bebf
+f0102b00:	68 e9 04 00 00       	push   $0x4e9
+f0102b05:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102b0a:	e8 34 d5 ff ff       	call   f0100043 <_panic>
+	assert(pp1 && pp1 != pp0);
+f0102b0f:	68 d4 cf 10 f0       	push   $0xf010cfd4
+f0102b14:	68 bf be 10 f0       	push   $0xf010bebf
+f0102b19:	68 ec 04 00 00       	push   $0x4ec
+f0102b1e:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102b23:	e8 1b d5 ff ff       	call   f0100043 <_panic>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f0102b28:	68 b8 c6 10 f0       	push   $0xf010c6b8
+f0102b2d:	68 bf be 10 f0       	push   $0xf010bebf
+f0102b32:	68 ed 04 00 00       	push   $0x4ed
+f0102b37:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102b3c:	e8 02 d5 ff ff       	call   f0100043 <_panic>
+	assert(!page_alloc(0));
+f0102b41:	68 3d d0 10 f0       	push   $0xf010d03d
+f0102b46:	68 bf be 10 f0       	push   $0xf010bebf
+f0102b4b:	68 f4 04 00 00       	push   $0x4f4
+f0102b50:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102b55:	e8 e9 d4 ff ff       	call   f0100043 <_panic>
+	assert(page_lookup(kern_pgdir, (void *) 0x0, &ptep) == NULL);
+f0102b5a:	68 f8 c6 10 f0       	push   $0xf010c6f8
+f0102b5f:	68 bf be 10 f0       	push   $0xf010bebf
+f0102b64:	68 f7 04 00 00       	push   $0x4f7
+f0102b69:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102b6e:	e8 d0 d4 ff ff       	call   f0100043 <_panic>
+	assert(page_insert(kern_pgdir, pp1, 0x0, PTE_W) < 0);
+f0102b73:	68 30 c7 10 f0       	push   $0xf010c730
+f0102b78:	68 bf be 10 f0       	push   $0xf010bebf
+f0102b7d:	68 fa 04 00 00       	push   $0x4fa
+f0102b82:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102b87:	e8 b7 d4 ff ff       	call   f0100043 <_panic>
+	assert(page_insert(kern_pgdir, pp1, 0x0, PTE_W) == 0);
+f0102b8c:	68 60 c7 10 f0       	push   $0xf010c760
+f0102b91:	68 bf be 10 f0       	push   $0xf010bebf
+f0102b96:	68 fe 04 00 00       	push   $0x4fe
+f0102b9b:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102ba0:	e8 9e d4 ff ff       	call   f0100043 <_panic>
+	assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f0102ba5:	68 90 c7 10 f0       	push   $0xf010c790
+f0102baa:	68 bf be 10 f0       	push   $0xf010bebf
+f0102baf:	68 ff 04 00 00       	push   $0x4ff
+f0102bb4:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102bb9:	e8 85 d4 ff ff       	call   f0100043 <_panic>
+	assert(check_va2pa(kern_pgdir, 0x0) == page2pa(pp1));
+f0102bbe:	68 b8 c7 10 f0       	push   $0xf010c7b8
+f0102bc3:	68 bf be 10 f0       	push   $0xf010bebf
+f0102bc8:	68 00 05 00 00       	push   $0x500
+f0102bcd:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102bd2:	e8 6c d4 ff ff       	call   f0100043 <_panic>
+	assert(pp1->pp_ref == 1);
+f0102bd7:	68 8f d0 10 f0       	push   $0xf010d08f
+f0102bdc:	68 bf be 10 f0       	push   $0xf010bebf
+f0102be1:	68 01 05 00 00       	push   $0x501
+f0102be6:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102beb:	e8 53 d4 ff ff       	call   f0100043 <_panic>
+	assert(pp0->pp_ref == 1);
+f0102bf0:	68 a0 d0 10 f0       	push   $0xf010d0a0
+f0102bf5:	68 bf be 10 f0       	push   $0xf010bebf
+f0102bfa:	68 02 05 00 00       	push   $0x502
+f0102bff:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102c04:	e8 3a d4 ff ff       	call   f0100043 <_panic>
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W) == 0);
+f0102c09:	68 e8 c7 10 f0       	push   $0xf010c7e8
+f0102c0e:	68 bf be 10 f0       	push   $0xf010bebf
+f0102c13:	68 05 05 00 00       	push   $0x505
+f0102c18:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102c1d:	e8 21 d4 ff ff       	call   f0100043 <_panic>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f0102c22:	68 24 c8 10 f0       	push   $0xf010c824
+f0102c27:	68 bf be 10 f0       	push   $0xf010bebf
+f0102c2c:	68 06 05 00 00       	push   $0x506
+f0102c31:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102c36:	e8 08 d4 ff ff       	call   f0100043 <_panic>
+	assert(pp2->pp_ref == 1);
+f0102c3b:	68 b1 d0 10 f0       	push   $0xf010d0b1
+f0102c40:	68 bf be 10 f0       	push   $0xf010bebf
+f0102c45:	68 07 05 00 00       	push   $0x507
+f0102c4a:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102c4f:	e8 ef d3 ff ff       	call   f0100043 <_panic>
+	assert(!page_alloc(0));
+f0102c54:	68 3d d0 10 f0       	push   $0xf010d03d
+f0102c59:	68 bf be 10 f0       	push   $0xf010bebf
+f0102c5e:	68 0a 05 00 00       	push   $0x50a
+f0102c63:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102c68:	e8 d6 d3 ff ff       	call   f0100043 <_panic>
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W) == 0);
+f0102c6d:	68 e8 c7 10 f0       	push   $0xf010c7e8
+f0102c72:	68 bf be 10 f0       	push   $0xf010bebf
+f0102c77:	68 0d 05 00 00       	push   $0x50d
+f0102c7c:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102c81:	e8 bd d3 ff ff       	call   f0100043 <_panic>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f0102c86:	68 24 c8 10 f0       	push   $0xf010c824
+f0102c8b:	68 bf be 10 f0       	push   $0xf010bebf
+f0102c90:	68 0e 05 00 00       	push   $0x50e
+f0102c95:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102c9a:	e8 a4 d3 ff ff       	call   f0100043 <_panic>
+	assert(pp2->pp_ref == 1);
+f0102c9f:	68 b1 d0 10 f0       	push   $0xf010d0b1
+f0102ca4:	68 bf be 10 f0       	push   $0xf010bebf
+f0102ca9:	68 0f 05 00 00       	push   $0x50f
+f0102cae:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102cb3:	e8 8b d3 ff ff       	call   f0100043 <_panic>
+	assert(!page_alloc(0));
+f0102cb8:	68 3d d0 10 f0       	push   $0xf010d03d
+f0102cbd:	68 bf be 10 f0       	push   $0xf010bebf
+f0102cc2:	68 13 05 00 00       	push   $0x513
+f0102cc7:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102ccc:	e8 72 d3 ff ff       	call   f0100043 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0102cd1:	56                   	push   %esi
+f0102cd2:	68 90 be 10 f0       	push   $0xf010be90
+f0102cd7:	68 16 05 00 00       	push   $0x516
+f0102cdc:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102ce1:	e8 5d d3 ff ff       	call   f0100043 <_panic>
+	assert(pgdir_walk(kern_pgdir, (void*)PGSIZE, 0) == ptep+PTX(PGSIZE));
+f0102ce6:	68 54 c8 10 f0       	push   $0xf010c854
+f0102ceb:	68 bf be 10 f0       	push   $0xf010bebf
+f0102cf0:	68 17 05 00 00       	push   $0x517
+f0102cf5:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102cfa:	e8 44 d3 ff ff       	call   f0100043 <_panic>
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W|PTE_U) == 0);
+f0102cff:	68 94 c8 10 f0       	push   $0xf010c894
+f0102d04:	68 bf be 10 f0       	push   $0xf010bebf
+f0102d09:	68 1a 05 00 00       	push   $0x51a
+f0102d0e:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102d13:	e8 2b d3 ff ff       	call   f0100043 <_panic>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f0102d18:	68 24 c8 10 f0       	push   $0xf010c824
+f0102d1d:	68 bf be 10 f0       	push   $0xf010bebf
+f0102d22:	68 1b 05 00 00       	push   $0x51b
+f0102d27:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102d2c:	e8 12 d3 ff ff       	call   f0100043 <_panic>
+	assert(pp2->pp_ref == 1);
+f0102d31:	68 b1 d0 10 f0       	push   $0xf010d0b1
+f0102d36:	68 bf be 10 f0       	push   $0xf010bebf
+f0102d3b:	68 1c 05 00 00       	push   $0x51c
+f0102d40:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102d45:	e8 f9 d2 ff ff       	call   f0100043 <_panic>
+	assert(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_U);
+f0102d4a:	68 d4 c8 10 f0       	push   $0xf010c8d4
+f0102d4f:	68 bf be 10 f0       	push   $0xf010bebf
+f0102d54:	68 1d 05 00 00       	push   $0x51d
+f0102d59:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102d5e:	e8 e0 d2 ff ff       	call   f0100043 <_panic>
+	assert(kern_pgdir[0] & PTE_U);
+f0102d63:	68 c2 d0 10 f0       	push   $0xf010d0c2
+f0102d68:	68 bf be 10 f0       	push   $0xf010bebf
+f0102d6d:	68 1e 05 00 00       	push   $0x51e
+f0102d72:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102d77:	e8 c7 d2 ff ff       	call   f0100043 <_panic>
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W) == 0);
+f0102d7c:	68 e8 c7 10 f0       	push   $0xf010c7e8
+f0102d81:	68 bf be 10 f0       	push   $0xf010bebf
+f0102d86:	68 21 05 00 00       	push   $0x521
+f0102d8b:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102d90:	e8 ae d2 ff ff       	call   f0100043 <_panic>
+	assert(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_W);
+f0102d95:	68 08 c9 10 f0       	push   $0xf010c908
+f0102d9a:	68 bf be 10 f0       	push   $0xf010bebf
+f0102d9f:	68 22 05 00 00       	push   $0x522
+f0102da4:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102da9:	e8 95 d2 ff ff       	call   f0100043 <_panic>
+	assert(!(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_U));
+f0102dae:	68 3c c9 10 f0       	push   $0xf010c93c
+f0102db3:	68 bf be 10 f0       	push   $0xf010bebf
+f0102db8:	68 23 05 00 00       	push   $0x523
+f0102dbd:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102dc2:	e8 7c d2 ff ff       	call   f0100043 <_panic>
+	assert(page_insert(kern_pgdir, pp0, (void*) PTSIZE, PTE_W) < 0);
+f0102dc7:	68 74 c9 10 f0       	push   $0xf010c974
+f0102dcc:	68 bf be 10 f0       	push   $0xf010bebf
+f0102dd1:	68 26 05 00 00       	push   $0x526
+f0102dd6:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102ddb:	e8 63 d2 ff ff       	call   f0100043 <_panic>
+	assert(page_insert(kern_pgdir, pp1, (void*) PGSIZE, PTE_W) == 0);
+f0102de0:	68 ac c9 10 f0       	push   $0xf010c9ac
+f0102de5:	68 bf be 10 f0       	push   $0xf010bebf
+f0102dea:	68 29 05 00 00       	push   $0x529
+f0102def:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102df4:	e8 4a d2 ff ff       	call   f0100043 <_panic>
+	assert(!(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_U));
+f0102df9:	68 3c c9 10 f0       	push   $0xf010c93c
+f0102dfe:	68 bf be 10 f0       	push   $0xf010bebf
+f0102e03:	68 2a 05 00 00       	push   $0x52a
+f0102e08:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102e0d:	e8 31 d2 ff ff       	call   f0100043 <_panic>
+	assert(check_va2pa(kern_pgdir, 0) == page2pa(pp1));
+f0102e12:	68 e8 c9 10 f0       	push   $0xf010c9e8
+f0102e17:	68 bf be 10 f0       	push   $0xf010bebf
+f0102e1c:	68 2d 05 00 00       	push   $0x52d
+f0102e21:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102e26:	e8 18 d2 ff ff       	call   f0100043 <_panic>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp1));
+f0102e2b:	68 14 ca 10 f0       	push   $0xf010ca14
+f0102e30:	68 bf be 10 f0       	push   $0xf010bebf
+f0102e35:	68 2e 05 00 00       	push   $0x52e
+f0102e3a:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102e3f:	e8 ff d1 ff ff       	call   f0100043 <_panic>
+	assert(pp1->pp_ref == 2);
+f0102e44:	68 d8 d0 10 f0       	push   $0xf010d0d8
+f0102e49:	68 bf be 10 f0       	push   $0xf010bebf
+f0102e4e:	68 30 05 00 00       	push   $0x530
+f0102e53:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102e58:	e8 e6 d1 ff ff       	call   f0100043 <_panic>
+	assert(pp2->pp_ref == 0);
+f0102e5d:	68 e9 d0 10 f0       	push   $0xf010d0e9
+f0102e62:	68 bf be 10 f0       	push   $0xf010bebf
+f0102e67:	68 31 05 00 00       	push   $0x531
+f0102e6c:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102e71:	e8 cd d1 ff ff       	call   f0100043 <_panic>
+	assert((pp = page_alloc(0)) && pp == pp2);
+f0102e76:	68 44 ca 10 f0       	push   $0xf010ca44
+f0102e7b:	68 bf be 10 f0       	push   $0xf010bebf
+f0102e80:	68 34 05 00 00       	push   $0x534
+f0102e85:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102e8a:	e8 b4 d1 ff ff       	call   f0100043 <_panic>
+	assert(check_va2pa(kern_pgdir, 0x0) == ~0);
+f0102e8f:	68 68 ca 10 f0       	push   $0xf010ca68
+f0102e94:	68 bf be 10 f0       	push   $0xf010bebf
+f0102e99:	68 38 05 00 00       	push   $0x538
+f0102e9e:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102ea3:	e8 9b d1 ff ff       	call   f0100043 <_panic>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp1));
+f0102ea8:	68 14 ca 10 f0       	push   $0xf010ca14
+f0102ead:	68 bf be 10 f0       	push   $0xf010bebf
+f0102eb2:	68 39 05 00 00       	push   $0x539
+f0102eb7:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102ebc:	e8 82 d1 ff ff       	call   f0100043 <_panic>
+	assert(pp1->pp_ref == 1);
+f0102ec1:	68 8f d0 10 f0       	push   $0xf010d08f
+f0102ec6:	68 bf be 10 f0       	push   $0xf010bebf
+f0102ecb:	68 3a 05 00 00       	push   $0x53a
+f0102ed0:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102ed5:	e8 69 d1 ff ff       	call   f0100043 <_panic>
+	assert(pp2->pp_ref == 0);
+f0102eda:	68 e9 d0 10 f0       	push   $0xf010d0e9
+f0102edf:	68 bf be 10 f0       	push   $0xf010bebf
+f0102ee4:	68 3b 05 00 00       	push   $0x53b
+f0102ee9:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102eee:	e8 50 d1 ff ff       	call   f0100043 <_panic>
+	assert(page_insert(kern_pgdir, pp1, (void*) PGSIZE, 0) == 0);
+f0102ef3:	68 8c ca 10 f0       	push   $0xf010ca8c
+f0102ef8:	68 bf be 10 f0       	push   $0xf010bebf
+f0102efd:	68 3e 05 00 00       	push   $0x53e
+f0102f02:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102f07:	e8 37 d1 ff ff       	call   f0100043 <_panic>
+	assert(pp1->pp_ref);
+f0102f0c:	68 fa d0 10 f0       	push   $0xf010d0fa
+f0102f11:	68 bf be 10 f0       	push   $0xf010bebf
+f0102f16:	68 3f 05 00 00       	push   $0x53f
+f0102f1b:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102f20:	e8 1e d1 ff ff       	call   f0100043 <_panic>
+	assert(pp1->pp_link == NULL);
+f0102f25:	68 06 d1 10 f0       	push   $0xf010d106
+f0102f2a:	68 bf be 10 f0       	push   $0xf010bebf
+f0102f2f:	68 40 05 00 00       	push   $0x540
+f0102f34:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102f39:	e8 05 d1 ff ff       	call   f0100043 <_panic>
+	assert(check_va2pa(kern_pgdir, 0x0) == ~0);
+f0102f3e:	68 68 ca 10 f0       	push   $0xf010ca68
+f0102f43:	68 bf be 10 f0       	push   $0xf010bebf
+f0102f48:	68 44 05 00 00       	push   $0x544
+f0102f4d:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102f52:	e8 ec d0 ff ff       	call   f0100043 <_panic>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == ~0);
+f0102f57:	68 c4 ca 10 f0       	push   $0xf010cac4
+f0102f5c:	68 bf be 10 f0       	push   $0xf010bebf
+f0102f61:	68 45 05 00 00       	push   $0x545
+f0102f66:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102f6b:	e8 d3 d0 ff ff       	call   f0100043 <_panic>
+	assert(pp1->pp_ref == 0);
+f0102f70:	68 1b d1 10 f0       	push   $0xf010d11b
+f0102f75:	68 bf be 10 f0       	push   $0xf010bebf
+f0102f7a:	68 46 05 00 00       	push   $0x546
+f0102f7f:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102f84:	e8 ba d0 ff ff       	call   f0100043 <_panic>
+	assert(pp2->pp_ref == 0);
+f0102f89:	68 e9 d0 10 f0       	push   $0xf010d0e9
+f0102f8e:	68 bf be 10 f0       	push   $0xf010bebf
+f0102f93:	68 47 05 00 00       	push   $0x547
+f0102f98:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102f9d:	e8 a1 d0 ff ff       	call   f0100043 <_panic>
+	assert((pp = page_alloc(0)) && pp == pp1);
+f0102fa2:	68 ec ca 10 f0       	push   $0xf010caec
+f0102fa7:	68 bf be 10 f0       	push   $0xf010bebf
+f0102fac:	68 4a 05 00 00       	push   $0x54a
+f0102fb1:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102fb6:	e8 88 d0 ff ff       	call   f0100043 <_panic>
+	assert(!page_alloc(0));
+f0102fbb:	68 3d d0 10 f0       	push   $0xf010d03d
+f0102fc0:	68 bf be 10 f0       	push   $0xf010bebf
+f0102fc5:	68 4d 05 00 00       	push   $0x54d
+f0102fca:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102fcf:	e8 6f d0 ff ff       	call   f0100043 <_panic>
+	assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f0102fd4:	68 90 c7 10 f0       	push   $0xf010c790
+f0102fd9:	68 bf be 10 f0       	push   $0xf010bebf
+f0102fde:	68 50 05 00 00       	push   $0x550
+f0102fe3:	68 89 ce 10 f0       	push   $0xf010ce89
+f0102fe8:	e8 56 d0 ff ff       	call   f0100043 <_panic>
+	assert(pp0->pp_ref == 1);
+f0102fed:	68 a0 d0 10 f0       	push   $0xf010d0a0
+f0102ff2:	68 bf be 10 f0       	push   $0xf010bebf
+f0102ff7:	68 52 05 00 00       	push   $0x552
+f0102ffc:	68 89 ce 10 f0       	push   $0xf010ce89
+f0103001:	e8 3d d0 ff ff       	call   f0100043 <_panic>
+f0103006:	56                   	push   %esi
+f0103007:	68 90 be 10 f0       	push   $0xf010be90
+f010300c:	68 59 05 00 00       	push   $0x559
+f0103011:	68 89 ce 10 f0       	push   $0xf010ce89
+f0103016:	e8 28 d0 ff ff       	call   f0100043 <_panic>
+	assert(ptep == ptep1 + PTX(va));
+f010301b:	68 2c d1 10 f0       	push   $0xf010d12c
+f0103020:	68 bf be 10 f0       	push   $0xf010bebf
+f0103025:	68 5a 05 00 00       	push   $0x55a
+f010302a:	68 89 ce 10 f0       	push   $0xf010ce89
+f010302f:	e8 0f d0 ff ff       	call   f0100043 <_panic>
+f0103034:	51                   	push   %ecx
+f0103035:	68 90 be 10 f0       	push   $0xf010be90
+f010303a:	68 a4 00 00 00       	push   $0xa4
+f010303f:	68 95 ce 10 f0       	push   $0xf010ce95
+f0103044:	e8 fa cf ff ff       	call   f0100043 <_panic>
+f0103049:	51                   	push   %ecx
+f010304a:	68 90 be 10 f0       	push   $0xf010be90
+f010304f:	68 a4 00 00 00       	push   $0xa4
+f0103054:	68 95 ce 10 f0       	push   $0xf010ce95
+f0103059:	e8 e5 cf ff ff       	call   f0100043 <_panic>
+	kern_pgdir[0] = 0;
+f010305e:	a1 6c 47 79 f0       	mov    0xf079476c,%eax
+f0103063:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	pp0->pp_ref = 0;
+f0103069:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f010306c:	66 c7 40 04 00 00    	movw   $0x0,0x4(%eax)
+
+	// give free list back
+	page_free_list = fl;
+f0103072:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+f0103075:	89 0d 80 47 79 f0    	mov    %ecx,0xf0794780
+
+	// free the pages we took
+	page_free(pp0);
+f010307b:	83 ec 0c             	sub    $0xc,%esp
+f010307e:	50                   	push   %eax
+f010307f:	e8 ec e1 ff ff       	call   f0101270 <page_free>
+	page_free(pp1);
+f0103084:	89 3c 24             	mov    %edi,(%esp)
+f0103087:	e8 e4 e1 ff ff       	call   f0101270 <page_free>
+	page_free(pp2);
+f010308c:	89 1c 24             	mov    %ebx,(%esp)
+f010308f:	e8 dc e1 ff ff       	call   f0101270 <page_free>
+
+	// test mmio_map_region
+	mm1 = (uintptr_t) mmio_map_region(0, 4097);
+f0103094:	83 c4 08             	add    $0x8,%esp
+f0103097:	68 01 10 00 00       	push   $0x1001
+f010309c:	6a 00                	push   $0x0
+f010309e:	e8 a3 ed ff ff       	call   f0101e46 <mmio_map_region>
+f01030a3:	89 c6                	mov    %eax,%esi
+	mm2 = (uintptr_t) mmio_map_region(0, 4096);
+f01030a5:	83 c4 08             	add    $0x8,%esp
+f01030a8:	68 00 10 00 00       	push   $0x1000
+f01030ad:	6a 00                	push   $0x0
+f01030af:	e8 92 ed ff ff       	call   f0101e46 <mmio_map_region>
+f01030b4:	89 c7                	mov    %eax,%edi
+	// check that they're in the right region
+	assert(mm1 >= MMIOBASE && mm1 + 8096 < MMIOLIM);
+f01030b6:	8d 86 a0 1f 00 00    	lea    0x1fa0(%esi),%eax
+f01030bc:	83 c4 10             	add    $0x10,%esp
+f01030bf:	81 fe ff ff 7f ef    	cmp    $0xef7fffff,%esi
+f01030c5:	0f 86 47 02 00 00    	jbe    f0103312 <mem_init+0x1466>
+f01030cb:	3d ff ff bf ef       	cmp    $0xefbfffff,%eax
+f01030d0:	0f 87 3c 02 00 00    	ja     f0103312 <mem_init+0x1466>
+	assert(mm2 >= MMIOBASE && mm2 + 8096 < MMIOLIM);
+f01030d6:	8d 97 a0 1f 00 00    	lea    0x1fa0(%edi),%edx
+f01030dc:	81 fa ff ff bf ef    	cmp    $0xefbfffff,%edx
+f01030e2:	0f 87 43 02 00 00    	ja     f010332b <mem_init+0x147f>
+f01030e8:	81 ff ff ff 7f ef    	cmp    $0xef7fffff,%edi
+f01030ee:	0f 86 37 02 00 00    	jbe    f010332b <mem_init+0x147f>
+	// check that they're page-aligned
+	assert(mm1 % PGSIZE == 0 && mm2 % PGSIZE == 0);
+f01030f4:	89 f2                	mov    %esi,%edx
+f01030f6:	09 fa                	or     %edi,%edx
+f01030f8:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+f01030fe:	0f 85 40 02 00 00    	jne    f0103344 <mem_init+0x1498>
+	// check that they don't overlap
+	assert(mm1 + 8096 <= mm2);
+f0103104:	39 c7                	cmp    %eax,%edi
+f0103106:	0f 82 51 02 00 00    	jb     f010335d <mem_init+0x14b1>
+	// check page mappings
+	assert(check_va2pa(kern_pgdir, mm1) == 0);
+f010310c:	8b 1d 6c 47 79 f0    	mov    0xf079476c,%ebx
+f0103112:	89 f2                	mov    %esi,%edx
+f0103114:	89 d8                	mov    %ebx,%eax
+f0103116:	e8 bc db ff ff       	call   f0100cd7 <check_va2pa>
+f010311b:	85 c0                	test   %eax,%eax
+f010311d:	0f 85 53 02 00 00    	jne    f0103376 <mem_init+0x14ca>
+	assert(check_va2pa(kern_pgdir, mm1+PGSIZE) == PGSIZE);
+f0103123:	8d 86 00 10 00 00    	lea    0x1000(%esi),%eax
+f0103129:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f010312c:	89 c2                	mov    %eax,%edx
+f010312e:	89 d8                	mov    %ebx,%eax
+f0103130:	e8 a2 db ff ff       	call   f0100cd7 <check_va2pa>
+f0103135:	3d 00 10 00 00       	cmp    $0x1000,%eax
+f010313a:	0f 85 4f 02 00 00    	jne    f010338f <mem_init+0x14e3>
+	assert(check_va2pa(kern_pgdir, mm2) == 0);
+f0103140:	89 fa                	mov    %edi,%edx
+f0103142:	89 d8                	mov    %ebx,%eax
+f0103144:	e8 8e db ff ff       	call   f0100cd7 <check_va2pa>
+f0103149:	85 c0                	test   %eax,%eax
+f010314b:	0f 85 57 02 00 00    	jne    f01033a8 <mem_init+0x14fc>
+	assert(check_va2pa(kern_pgdir, mm2+PGSIZE) == ~0);
+f0103151:	8d 97 00 10 00 00    	lea    0x1000(%edi),%edx
+f0103157:	89 d8                	mov    %ebx,%eax
+f0103159:	e8 79 db ff ff       	call   f0100cd7 <check_va2pa>
+f010315e:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0103161:	0f 85 5a 02 00 00    	jne    f01033c1 <mem_init+0x1515>
+	// check permissions
+	assert(*pgdir_walk(kern_pgdir, (void*) mm1, 0) & (PTE_W|PTE_PWT|PTE_PCD));
+f0103167:	83 ec 04             	sub    $0x4,%esp
+f010316a:	6a 00                	push   $0x0
+f010316c:	56                   	push   %esi
+f010316d:	53                   	push   %ebx
+f010316e:	e8 d0 e5 ff ff       	call   f0101743 <pgdir_walk>
+f0103173:	83 c4 10             	add    $0x10,%esp
+f0103176:	f6 00 1a             	testb  $0x1a,(%eax)
+f0103179:	0f 84 5b 02 00 00    	je     f01033da <mem_init+0x152e>
+	assert(!(*pgdir_walk(kern_pgdir, (void*) mm1, 0) & PTE_U));
+f010317f:	83 ec 04             	sub    $0x4,%esp
+f0103182:	6a 00                	push   $0x0
+f0103184:	56                   	push   %esi
+f0103185:	ff 35 6c 47 79 f0    	push   0xf079476c
+f010318b:	e8 b3 e5 ff ff       	call   f0101743 <pgdir_walk>
+f0103190:	8b 00                	mov    (%eax),%eax
+f0103192:	83 c4 10             	add    $0x10,%esp
+f0103195:	83 e0 04             	and    $0x4,%eax
+f0103198:	89 c3                	mov    %eax,%ebx
+f010319a:	0f 85 53 02 00 00    	jne    f01033f3 <mem_init+0x1547>
+	// clear the mappings
+	*pgdir_walk(kern_pgdir, (void*) mm1, 0) = 0;
+f01031a0:	83 ec 04             	sub    $0x4,%esp
+f01031a3:	6a 00                	push   $0x0
+f01031a5:	56                   	push   %esi
+f01031a6:	ff 35 6c 47 79 f0    	push   0xf079476c
+f01031ac:	e8 92 e5 ff ff       	call   f0101743 <pgdir_walk>
+f01031b1:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	*pgdir_walk(kern_pgdir, (void*) mm1 + PGSIZE, 0) = 0;
+f01031b7:	83 c4 0c             	add    $0xc,%esp
+f01031ba:	6a 00                	push   $0x0
+f01031bc:	ff 75 d4             	push   -0x2c(%ebp)
+f01031bf:	ff 35 6c 47 79 f0    	push   0xf079476c
+f01031c5:	e8 79 e5 ff ff       	call   f0101743 <pgdir_walk>
+f01031ca:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	*pgdir_walk(kern_pgdir, (void*) mm2, 0) = 0;
+f01031d0:	83 c4 0c             	add    $0xc,%esp
+f01031d3:	6a 00                	push   $0x0
+f01031d5:	57                   	push   %edi
+f01031d6:	ff 35 6c 47 79 f0    	push   0xf079476c
+f01031dc:	e8 62 e5 ff ff       	call   f0101743 <pgdir_walk>
+f01031e1:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+
+	cprintf("check_page() succeeded!\n");
+f01031e7:	c7 04 24 6d d1 10 f0 	movl   $0xf010d16d,(%esp)
+f01031ee:	e8 c2 19 00 00       	call   f0104bb5 <cprintf>
+  int np = ROUNDUP(npages*sizeof(struct PageInfo), PGSIZE);
+f01031f3:	a1 74 47 79 f0       	mov    0xf0794774,%eax
+f01031f8:	8d 0c c5 ff 0f 00 00 	lea    0xfff(,%eax,8),%ecx
+  boot_map_region(kern_pgdir, UPAGES, np/PGSIZE, PADDR(pages), PTE_U | PTE_P);
+f01031ff:	a1 68 47 79 f0       	mov    0xf0794768,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0103204:	83 c4 10             	add    $0x10,%esp
+f0103207:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f010320c:	0f 86 fa 01 00 00    	jbe    f010340c <mem_init+0x1560>
+f0103212:	c1 f9 0c             	sar    $0xc,%ecx
+f0103215:	83 ec 08             	sub    $0x8,%esp
+f0103218:	6a 05                	push   $0x5
+	return (physaddr_t)kva - KERNBASE;
+f010321a:	05 00 00 00 10       	add    $0x10000000,%eax
+f010321f:	50                   	push   %eax
+f0103220:	ba 00 00 00 ef       	mov    $0xef000000,%edx
+f0103225:	a1 6c 47 79 f0       	mov    0xf079476c,%eax
+f010322a:	e8 07 e6 ff ff       	call   f0101836 <boot_map_region>
+  boot_map_region(kern_pgdir, UENVS, np/PGSIZE, PADDR(envs), PTE_P | PTE_U);
+f010322f:	a1 84 47 79 f0       	mov    0xf0794784,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0103234:	83 c4 10             	add    $0x10,%esp
+f0103237:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f010323c:	0f 86 df 01 00 00    	jbe    f0103421 <mem_init+0x1575>
+f0103242:	83 ec 08             	sub    $0x8,%esp
+f0103245:	6a 05                	push   $0x5
+	return (physaddr_t)kva - KERNBASE;
+f0103247:	05 00 00 00 10       	add    $0x10000000,%eax
+f010324c:	50                   	push   %eax
+f010324d:	b9 5a 00 00 00       	mov    $0x5a,%ecx
+f0103252:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+f0103257:	a1 6c 47 79 f0       	mov    0xf079476c,%eax
+f010325c:	e8 d5 e5 ff ff       	call   f0101836 <boot_map_region>
+	vdso_init();
+f0103261:	e8 45 5f 00 00       	call   f01091ab <vdso_init>
+	if ((uint32_t)kva < KERNBASE)
+f0103266:	83 c4 10             	add    $0x10,%esp
+f0103269:	b8 00 f0 10 f0       	mov    $0xf010f000,%eax
+f010326e:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0103273:	0f 86 bd 01 00 00    	jbe    f0103436 <mem_init+0x158a>
+  boot_map_region(kern_pgdir, KSTACKTOP-KSTKSIZE, np/PGSIZE, PADDR(bootstack), PTE_P | PTE_W);
+f0103279:	83 ec 08             	sub    $0x8,%esp
+f010327c:	6a 03                	push   $0x3
+f010327e:	68 00 f0 10 00       	push   $0x10f000
+f0103283:	b9 08 00 00 00       	mov    $0x8,%ecx
+f0103288:	ba 00 80 ff ef       	mov    $0xefff8000,%edx
+f010328d:	a1 6c 47 79 f0       	mov    0xf079476c,%eax
+f0103292:	e8 9f e5 ff ff       	call   f0101836 <boot_map_region>
+  boot_map_region(kern_pgdir, KERNBASE, np / PGSIZE, 0, PTE_P | PTE_W);
+f0103297:	83 c4 08             	add    $0x8,%esp
+f010329a:	6a 03                	push   $0x3
+f010329c:	6a 00                	push   $0x0
+f010329e:	b9 00 00 01 00       	mov    $0x10000,%ecx
+f01032a3:	ba 00 00 00 f0       	mov    $0xf0000000,%edx
+f01032a8:	a1 6c 47 79 f0       	mov    0xf079476c,%eax
+f01032ad:	e8 84 e5 ff ff       	call   f0101836 <boot_map_region>
+  for (uint32_t i = 0; i < NCPU; i++) {
+f01032b2:	c7 45 d4 00 60 79 f0 	movl   $0xf0796000,-0x2c(%ebp)
+f01032b9:	bf 00 60 7d f0       	mov    $0xf07d6000,%edi
+f01032be:	83 c4 10             	add    $0x10,%esp
+f01032c1:	b8 00 60 79 f0       	mov    $0xf0796000,%eax
+f01032c6:	be 00 80 ff ef       	mov    $0xefff8000,%esi
+f01032cb:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+f01032ce:	89 c3                	mov    %eax,%ebx
+f01032d0:	39 fb                	cmp    %edi,%ebx
+f01032d2:	0f 84 88 01 00 00    	je     f0103460 <mem_init+0x15b4>
+f01032d8:	81 fb ff ff ff ef    	cmp    $0xefffffff,%ebx
+f01032de:	0f 86 67 01 00 00    	jbe    f010344b <mem_init+0x159f>
+    boot_map_region(kern_pgdir, base + KSTKGAP, np/PGSIZE, PADDR(percpu_kstacks[i]), PTE_P | PTE_W);
+f01032e4:	83 ec 08             	sub    $0x8,%esp
+f01032e7:	6a 03                	push   $0x3
+	return (physaddr_t)kva - KERNBASE;
+f01032e9:	8d 83 00 00 00 10    	lea    0x10000000(%ebx),%eax
+f01032ef:	50                   	push   %eax
+f01032f0:	b9 08 00 00 00       	mov    $0x8,%ecx
+f01032f5:	89 f2                	mov    %esi,%edx
+f01032f7:	a1 6c 47 79 f0       	mov    0xf079476c,%eax
+f01032fc:	e8 35 e5 ff ff       	call   f0101836 <boot_map_region>
+  for (uint32_t i = 0; i < NCPU; i++) {
+f0103301:	81 ee 00 00 01 00    	sub    $0x10000,%esi
+f0103307:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+f010330d:	83 c4 10             	add    $0x10,%esp
+f0103310:	eb be                	jmp    f01032d0 <mem_init+0x1424>
+	assert(mm1 >= MMIOBASE && mm1 + 8096 < MMIOLIM);
+f0103312:	68 10 cb 10 f0       	push   $0xf010cb10
+f0103317:	68 bf be 10 f0       	push   $0xf010bebf
+f010331c:	68 74 05 00 00       	push   $0x574
+f0103321:	68 89 ce 10 f0       	push   $0xf010ce89
+f0103326:	e8 18 cd ff ff       	call   f0100043 <_panic>
+	assert(mm2 >= MMIOBASE && mm2 + 8096 < MMIOLIM);
+f010332b:	68 38 cb 10 f0       	push   $0xf010cb38
+f0103330:	68 bf be 10 f0       	push   $0xf010bebf
+f0103335:	68 75 05 00 00       	push   $0x575
+f010333a:	68 89 ce 10 f0       	push   $0xf010ce89
+f010333f:	e8 ff cc ff ff       	call   f0100043 <_panic>
+	assert(mm1 % PGSIZE == 0 && mm2 % PGSIZE == 0);
+f0103344:	68 60 cb 10 f0       	push   $0xf010cb60
+f0103349:	68 bf be 10 f0       	push   $0xf010bebf
+f010334e:	68 77 05 00 00       	push   $0x577
+f0103353:	68 89 ce 10 f0       	push   $0xf010ce89
+f0103358:	e8 e6 cc ff ff       	call   f0100043 <_panic>
+	assert(mm1 + 8096 <= mm2);
+f010335d:	68 5b d1 10 f0       	push   $0xf010d15b
+f0103362:	68 bf be 10 f0       	push   $0xf010bebf
+f0103367:	68 79 05 00 00       	push   $0x579
+f010336c:	68 89 ce 10 f0       	push   $0xf010ce89
+f0103371:	e8 cd cc ff ff       	call   f0100043 <_panic>
+	assert(check_va2pa(kern_pgdir, mm1) == 0);
+f0103376:	68 88 cb 10 f0       	push   $0xf010cb88
+f010337b:	68 bf be 10 f0       	push   $0xf010bebf
+f0103380:	68 7b 05 00 00       	push   $0x57b
+f0103385:	68 89 ce 10 f0       	push   $0xf010ce89
+f010338a:	e8 b4 cc ff ff       	call   f0100043 <_panic>
+	assert(check_va2pa(kern_pgdir, mm1+PGSIZE) == PGSIZE);
+f010338f:	68 ac cb 10 f0       	push   $0xf010cbac
+f0103394:	68 bf be 10 f0       	push   $0xf010bebf
+f0103399:	68 7c 05 00 00       	push   $0x57c
+f010339e:	68 89 ce 10 f0       	push   $0xf010ce89
+f01033a3:	e8 9b cc ff ff       	call   f0100043 <_panic>
+	assert(check_va2pa(kern_pgdir, mm2) == 0);
+f01033a8:	68 dc cb 10 f0       	push   $0xf010cbdc
+f01033ad:	68 bf be 10 f0       	push   $0xf010bebf
+f01033b2:	68 7d 05 00 00       	push   $0x57d
+f01033b7:	68 89 ce 10 f0       	push   $0xf010ce89
+f01033bc:	e8 82 cc ff ff       	call   f0100043 <_panic>
+	assert(check_va2pa(kern_pgdir, mm2+PGSIZE) == ~0);
+f01033c1:	68 00 cc 10 f0       	push   $0xf010cc00
+f01033c6:	68 bf be 10 f0       	push   $0xf010bebf
+f01033cb:	68 7e 05 00 00       	push   $0x57e
+f01033d0:	68 89 ce 10 f0       	push   $0xf010ce89
+f01033d5:	e8 69 cc ff ff       	call   f0100043 <_panic>
+	assert(*pgdir_walk(kern_pgdir, (void*) mm1, 0) & (PTE_W|PTE_PWT|PTE_PCD));
+f01033da:	68 2c cc 10 f0       	push   $0xf010cc2c
+f01033df:	68 bf be 10 f0       	push   $0xf010bebf
+f01033e4:	68 80 05 00 00       	push   $0x580
+f01033e9:	68 89 ce 10 f0       	push   $0xf010ce89
+f01033ee:	e8 50 cc ff ff       	call   f0100043 <_panic>
+	assert(!(*pgdir_walk(kern_pgdir, (void*) mm1, 0) & PTE_U));
+f01033f3:	68 70 cc 10 f0       	push   $0xf010cc70
+f01033f8:	68 bf be 10 f0       	push   $0xf010bebf
+f01033fd:	68 81 05 00 00       	push   $0x581
+f0103402:	68 89 ce 10 f0       	push   $0xf010ce89
+f0103407:	e8 37 cc ff ff       	call   f0100043 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f010340c:	50                   	push   %eax
+f010340d:	68 24 be 10 f0       	push   $0xf010be24
+f0103412:	68 b3 00 00 00       	push   $0xb3
+f0103417:	68 89 ce 10 f0       	push   $0xf010ce89
+f010341c:	e8 22 cc ff ff       	call   f0100043 <_panic>
+f0103421:	50                   	push   %eax
+f0103422:	68 24 be 10 f0       	push   $0xf010be24
+f0103427:	68 bd 00 00 00       	push   $0xbd
+f010342c:	68 89 ce 10 f0       	push   $0xf010ce89
+f0103431:	e8 0d cc ff ff       	call   f0100043 <_panic>
+f0103436:	50                   	push   %eax
+f0103437:	68 24 be 10 f0       	push   $0xf010be24
+f010343c:	68 d0 00 00 00       	push   $0xd0
+f0103441:	68 89 ce 10 f0       	push   $0xf010ce89
+f0103446:	e8 f8 cb ff ff       	call   f0100043 <_panic>
+f010344b:	53                   	push   %ebx
+f010344c:	68 24 be 10 f0       	push   $0xf010be24
+f0103451:	68 20 01 00 00       	push   $0x120
+f0103456:	68 89 ce 10 f0       	push   $0xf010ce89
+f010345b:	e8 e3 cb ff ff       	call   f0100043 <_panic>
+	pgdir = kern_pgdir;
+f0103460:	89 5d bc             	mov    %ebx,-0x44(%ebp)
+f0103463:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+f0103466:	8b 3d 6c 47 79 f0    	mov    0xf079476c,%edi
+	n = ROUNDUP(npages*sizeof(struct PageInfo), PGSIZE);
+f010346c:	8b 0d 74 47 79 f0    	mov    0xf0794774,%ecx
+f0103472:	8d 14 cd ff 0f 00 00 	lea    0xfff(,%ecx,8),%edx
+f0103479:	89 d0                	mov    %edx,%eax
+f010347b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		assert(check_va2pa(pgdir, UPAGES + i) == PADDR(pages) + i);
+f0103480:	8b 35 68 47 79 f0    	mov    0xf0794768,%esi
+f0103486:	89 75 cc             	mov    %esi,-0x34(%ebp)
+	return (physaddr_t)kva - KERNBASE;
+f0103489:	8d 96 00 00 00 10    	lea    0x10000000(%esi),%edx
+	for (i = 0; i < n; i += PGSIZE)
+f010348f:	89 de                	mov    %ebx,%esi
+f0103491:	89 7d d0             	mov    %edi,-0x30(%ebp)
+f0103494:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+f0103497:	89 d7                	mov    %edx,%edi
+f0103499:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+f010349c:	89 c3                	mov    %eax,%ebx
+f010349e:	eb 1d                	jmp    f01034bd <mem_init+0x1611>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01034a0:	ff 75 cc             	push   -0x34(%ebp)
+f01034a3:	68 24 be 10 f0       	push   $0xf010be24
+f01034a8:	68 9d 04 00 00       	push   $0x49d
+f01034ad:	68 89 ce 10 f0       	push   $0xf010ce89
+f01034b2:	e8 8c cb ff ff       	call   f0100043 <_panic>
+f01034b7:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f01034bd:	39 de                	cmp    %ebx,%esi
+f01034bf:	73 37                	jae    f01034f8 <mem_init+0x164c>
+		assert(check_va2pa(pgdir, UPAGES + i) == PADDR(pages) + i);
+f01034c1:	8d 96 00 00 00 ef    	lea    -0x11000000(%esi),%edx
+f01034c7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f01034ca:	e8 08 d8 ff ff       	call   f0100cd7 <check_va2pa>
+	if ((uint32_t)kva < KERNBASE)
+f01034cf:	81 7d cc ff ff ff ef 	cmpl   $0xefffffff,-0x34(%ebp)
+f01034d6:	76 c8                	jbe    f01034a0 <mem_init+0x15f4>
+f01034d8:	8d 14 3e             	lea    (%esi,%edi,1),%edx
+f01034db:	39 d0                	cmp    %edx,%eax
+f01034dd:	74 d8                	je     f01034b7 <mem_init+0x160b>
+f01034df:	68 a4 cc 10 f0       	push   $0xf010cca4
+f01034e4:	68 bf be 10 f0       	push   $0xf010bebf
+f01034e9:	68 9d 04 00 00       	push   $0x49d
+f01034ee:	68 89 ce 10 f0       	push   $0xf010ce89
+f01034f3:	e8 4b cb ff ff       	call   f0100043 <_panic>
+	for (i = 0; i < npages * PGSIZE; i += PGSIZE)
+f01034f8:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f01034fb:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+f01034fe:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+f0103501:	89 c8                	mov    %ecx,%eax
+f0103503:	c1 e0 0c             	shl    $0xc,%eax
+f0103506:	89 de                	mov    %ebx,%esi
+f0103508:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+f010350b:	89 c3                	mov    %eax,%ebx
+f010350d:	39 de                	cmp    %ebx,%esi
+f010350f:	73 32                	jae    f0103543 <mem_init+0x1697>
+		assert(check_va2pa(pgdir, KERNBASE + i) == i);
+f0103511:	8d 96 00 00 00 f0    	lea    -0x10000000(%esi),%edx
+f0103517:	89 f8                	mov    %edi,%eax
+f0103519:	e8 b9 d7 ff ff       	call   f0100cd7 <check_va2pa>
+f010351e:	39 c6                	cmp    %eax,%esi
+f0103520:	75 08                	jne    f010352a <mem_init+0x167e>
+	for (i = 0; i < npages * PGSIZE; i += PGSIZE)
+f0103522:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f0103528:	eb e3                	jmp    f010350d <mem_init+0x1661>
+		assert(check_va2pa(pgdir, KERNBASE + i) == i);
+f010352a:	68 d8 cc 10 f0       	push   $0xf010ccd8
+f010352f:	68 bf be 10 f0       	push   $0xf010bebf
+f0103534:	68 a1 04 00 00       	push   $0x4a1
+f0103539:	68 89 ce 10 f0       	push   $0xf010ce89
+f010353e:	e8 00 cb ff ff       	call   f0100043 <_panic>
+f0103543:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+f0103546:	c7 45 c8 00 e0 79 00 	movl   $0x79e000,-0x38(%ebp)
+f010354d:	ba 00 00 ff ef       	mov    $0xefff0000,%edx
+f0103552:	81 ea 00 60 79 f0    	sub    $0xf0796000,%edx
+f0103558:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+	for (i = 0; i < npages * PGSIZE; i += PGSIZE)
+f010355b:	c7 45 cc 00 80 ff ef 	movl   $0xefff8000,-0x34(%ebp)
+f0103562:	89 5d b8             	mov    %ebx,-0x48(%ebp)
+f0103565:	e9 a7 00 00 00       	jmp    f0103611 <mem_init+0x1765>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f010356a:	ff 75 d4             	push   -0x2c(%ebp)
+f010356d:	68 24 be 10 f0       	push   $0xf010be24
+f0103572:	68 a9 04 00 00       	push   $0x4a9
+f0103577:	68 89 ce 10 f0       	push   $0xf010ce89
+f010357c:	e8 c2 ca ff ff       	call   f0100043 <_panic>
+		for (i = 0; i < KSTKSIZE; i += PGSIZE) {
+f0103581:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0103587:	39 f3                	cmp    %esi,%ebx
+f0103589:	74 33                	je     f01035be <mem_init+0x1712>
+			assert(check_va2pa(pgdir, base + KSTKGAP + i)
+f010358b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f010358e:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+f0103591:	89 f8                	mov    %edi,%eax
+f0103593:	e8 3f d7 ff ff       	call   f0100cd7 <check_va2pa>
+	if ((uint32_t)kva < KERNBASE)
+f0103598:	81 7d d4 ff ff ff ef 	cmpl   $0xefffffff,-0x2c(%ebp)
+f010359f:	76 c9                	jbe    f010356a <mem_init+0x16be>
+f01035a1:	39 c3                	cmp    %eax,%ebx
+f01035a3:	74 dc                	je     f0103581 <mem_init+0x16d5>
+f01035a5:	68 00 cd 10 f0       	push   $0xf010cd00
+f01035aa:	68 bf be 10 f0       	push   $0xf010bebf
+f01035af:	68 a8 04 00 00       	push   $0x4a8
+f01035b4:	68 89 ce 10 f0       	push   $0xf010ce89
+f01035b9:	e8 85 ca ff ff       	call   f0100043 <_panic>
+f01035be:	8b 75 c0             	mov    -0x40(%ebp),%esi
+f01035c1:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+		for (i = 0; i < KSTKGAP; i += PGSIZE)
+f01035c4:	39 de                	cmp    %ebx,%esi
+f01035c6:	74 2d                	je     f01035f5 <mem_init+0x1749>
+			assert(check_va2pa(pgdir, base + i) == ~0);
+f01035c8:	89 f2                	mov    %esi,%edx
+f01035ca:	89 f8                	mov    %edi,%eax
+f01035cc:	e8 06 d7 ff ff       	call   f0100cd7 <check_va2pa>
+f01035d1:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f01035d7:	83 f8 ff             	cmp    $0xffffffff,%eax
+f01035da:	74 e8                	je     f01035c4 <mem_init+0x1718>
+f01035dc:	68 48 cd 10 f0       	push   $0xf010cd48
+f01035e1:	68 bf be 10 f0       	push   $0xf010bebf
+f01035e6:	68 ac 04 00 00       	push   $0x4ac
+f01035eb:	68 89 ce 10 f0       	push   $0xf010ce89
+f01035f0:	e8 4e ca ff ff       	call   f0100043 <_panic>
+	for (n = 0; n < NCPU; n++) {
+f01035f5:	81 6d cc 00 00 01 00 	subl   $0x10000,-0x34(%ebp)
+f01035fc:	81 45 d4 00 80 00 00 	addl   $0x8000,-0x2c(%ebp)
+f0103603:	81 45 c8 00 80 00 00 	addl   $0x8000,-0x38(%ebp)
+f010360a:	81 6d c4 00 80 01 00 	subl   $0x18000,-0x3c(%ebp)
+f0103611:	8b 4d bc             	mov    -0x44(%ebp),%ecx
+f0103614:	39 4d d4             	cmp    %ecx,-0x2c(%ebp)
+f0103617:	74 28                	je     f0103641 <mem_init+0x1795>
+		uint32_t base = KSTACKTOP - (KSTKSIZE + KSTKGAP) * (n + 1);
+f0103619:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f010361c:	8d b0 00 80 ff ff    	lea    -0x8000(%eax),%esi
+	return (physaddr_t)kva - KERNBASE;
+f0103622:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0103625:	8d 98 00 00 00 10    	lea    0x10000000(%eax),%ebx
+			assert(check_va2pa(pgdir, base + KSTKGAP + i)
+f010362b:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f010362e:	2d 00 80 ff 0f       	sub    $0xfff8000,%eax
+f0103633:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0103636:	89 75 c0             	mov    %esi,-0x40(%ebp)
+f0103639:	8b 75 c8             	mov    -0x38(%ebp),%esi
+		for (i = 0; i < KSTKSIZE; i += PGSIZE) {
+f010363c:	e9 46 ff ff ff       	jmp    f0103587 <mem_init+0x16db>
+f0103641:	8b 5d b8             	mov    -0x48(%ebp),%ebx
+f0103644:	eb 35                	jmp    f010367b <mem_init+0x17cf>
+			assert(pgdir[i] & PTE_P);
+f0103646:	f6 04 9f 01          	testb  $0x1,(%edi,%ebx,4)
+f010364a:	75 24                	jne    f0103670 <mem_init+0x17c4>
+f010364c:	68 86 d1 10 f0       	push   $0xf010d186
+f0103651:	68 bf be 10 f0       	push   $0xf010bebf
+f0103656:	68 b7 04 00 00       	push   $0x4b7
+f010365b:	68 89 ce 10 f0       	push   $0xf010ce89
+f0103660:	e8 de c9 ff ff       	call   f0100043 <_panic>
+				assert(pgdir[i] & PTE_P);
+f0103665:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+f0103668:	a8 01                	test   $0x1,%al
+f010366a:	74 41                	je     f01036ad <mem_init+0x1801>
+				assert(pgdir[i] & PTE_W);
+f010366c:	a8 02                	test   $0x2,%al
+f010366e:	74 56                	je     f01036c6 <mem_init+0x181a>
+	for (i = 0; i < NPDENTRIES; i++) {
+f0103670:	83 c3 01             	add    $0x1,%ebx
+f0103673:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+f0103679:	74 64                	je     f01036df <mem_init+0x1833>
+		switch (i) {
+f010367b:	8d 83 45 fc ff ff    	lea    -0x3bb(%ebx),%eax
+f0103681:	83 f8 04             	cmp    $0x4,%eax
+f0103684:	76 c0                	jbe    f0103646 <mem_init+0x179a>
+			if (i >= PDX(KERNBASE)) {
+f0103686:	81 fb bf 03 00 00    	cmp    $0x3bf,%ebx
+f010368c:	77 d7                	ja     f0103665 <mem_init+0x17b9>
+				assert(pgdir[i] == 0);
+f010368e:	83 3c 9f 00          	cmpl   $0x0,(%edi,%ebx,4)
+f0103692:	74 dc                	je     f0103670 <mem_init+0x17c4>
+f0103694:	68 a8 d1 10 f0       	push   $0xf010d1a8
+f0103699:	68 bf be 10 f0       	push   $0xf010bebf
+f010369e:	68 be 04 00 00       	push   $0x4be
+f01036a3:	68 89 ce 10 f0       	push   $0xf010ce89
+f01036a8:	e8 96 c9 ff ff       	call   f0100043 <_panic>
+				assert(pgdir[i] & PTE_P);
+f01036ad:	68 86 d1 10 f0       	push   $0xf010d186
+f01036b2:	68 bf be 10 f0       	push   $0xf010bebf
+f01036b7:	68 bb 04 00 00       	push   $0x4bb
+f01036bc:	68 89 ce 10 f0       	push   $0xf010ce89
+f01036c1:	e8 7d c9 ff ff       	call   f0100043 <_panic>
+				assert(pgdir[i] & PTE_W);
+f01036c6:	68 97 d1 10 f0       	push   $0xf010d197
+f01036cb:	68 bf be 10 f0       	push   $0xf010bebf
+f01036d0:	68 bc 04 00 00       	push   $0x4bc
+f01036d5:	68 89 ce 10 f0       	push   $0xf010ce89
+f01036da:	e8 64 c9 ff ff       	call   f0100043 <_panic>
+	cprintf("check_kern_pgdir() succeeded!\n");
+f01036df:	83 ec 0c             	sub    $0xc,%esp
+f01036e2:	68 6c cd 10 f0       	push   $0xf010cd6c
+f01036e7:	e8 c9 14 00 00       	call   f0104bb5 <cprintf>
+	lcr3(PADDR(kern_pgdir));
+f01036ec:	a1 6c 47 79 f0       	mov    0xf079476c,%eax
+	if ((uint32_t)kva < KERNBASE)
+f01036f1:	83 c4 10             	add    $0x10,%esp
+f01036f4:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01036f9:	0f 86 25 02 00 00    	jbe    f0103924 <mem_init+0x1a78>
+	return (physaddr_t)kva - KERNBASE;
+f01036ff:	05 00 00 00 10       	add    $0x10000000,%eax
+	asm volatile("movl %0,%%cr3" : : "r" (val));
+f0103704:	0f 22 d8             	mov    %eax,%cr3
+	check_page_free_list(0);
+f0103707:	b8 00 00 00 00       	mov    $0x0,%eax
+f010370c:	e8 29 d6 ff ff       	call   f0100d3a <check_page_free_list>
+	asm volatile("movl %%cr0,%0" : "=r" (val));
+f0103711:	0f 20 c0             	mov    %cr0,%eax
+	cr0 &= ~(CR0_TS|CR0_EM);
+f0103714:	83 e0 f3             	and    $0xfffffff3,%eax
+f0103717:	0d 23 00 05 80       	or     $0x80050023,%eax
+	asm volatile("movl %0,%%cr0" : : "r" (val));
+f010371c:	0f 22 c0             	mov    %eax,%cr0
+	uintptr_t va;
+	int i;
+
+	// check that we can read and write installed pages
+	pp1 = pp2 = 0;
+	assert((pp0 = page_alloc(0)));
+f010371f:	83 ec 0c             	sub    $0xc,%esp
+f0103722:	6a 00                	push   $0x0
+f0103724:	e8 bc da ff ff       	call   f01011e5 <page_alloc>
+f0103729:	89 c3                	mov    %eax,%ebx
+f010372b:	83 c4 10             	add    $0x10,%esp
+f010372e:	85 c0                	test   %eax,%eax
+f0103730:	0f 84 03 02 00 00    	je     f0103939 <mem_init+0x1a8d>
+	assert((pp1 = page_alloc(0)));
+f0103736:	83 ec 0c             	sub    $0xc,%esp
+f0103739:	6a 00                	push   $0x0
+f010373b:	e8 a5 da ff ff       	call   f01011e5 <page_alloc>
+f0103740:	89 c7                	mov    %eax,%edi
+f0103742:	83 c4 10             	add    $0x10,%esp
+f0103745:	85 c0                	test   %eax,%eax
+f0103747:	0f 84 05 02 00 00    	je     f0103952 <mem_init+0x1aa6>
+	assert((pp2 = page_alloc(0)));
+f010374d:	83 ec 0c             	sub    $0xc,%esp
+f0103750:	6a 00                	push   $0x0
+f0103752:	e8 8e da ff ff       	call   f01011e5 <page_alloc>
+f0103757:	89 c6                	mov    %eax,%esi
+f0103759:	83 c4 10             	add    $0x10,%esp
+f010375c:	85 c0                	test   %eax,%eax
+f010375e:	0f 84 07 02 00 00    	je     f010396b <mem_init+0x1abf>
+	page_free(pp0);
+f0103764:	83 ec 0c             	sub    $0xc,%esp
+f0103767:	53                   	push   %ebx
+f0103768:	e8 03 db ff ff       	call   f0101270 <page_free>
+	return (pp - pages) << PGSHIFT;
+f010376d:	89 f8                	mov    %edi,%eax
+f010376f:	2b 05 68 47 79 f0    	sub    0xf0794768,%eax
+f0103775:	c1 f8 03             	sar    $0x3,%eax
+f0103778:	89 c2                	mov    %eax,%edx
+f010377a:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f010377d:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0103782:	83 c4 10             	add    $0x10,%esp
+f0103785:	3b 05 74 47 79 f0    	cmp    0xf0794774,%eax
+f010378b:	0f 83 f3 01 00 00    	jae    f0103984 <mem_init+0x1ad8>
+	memset(page2kva(pp1), 1, PGSIZE);
+f0103791:	83 ec 04             	sub    $0x4,%esp
+f0103794:	68 00 10 00 00       	push   $0x1000
+f0103799:	6a 01                	push   $0x1
+	return (void *)(pa + KERNBASE);
+f010379b:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f01037a1:	52                   	push   %edx
+f01037a2:	e8 94 4d 00 00       	call   f010853b <memset>
+	return (pp - pages) << PGSHIFT;
+f01037a7:	89 f0                	mov    %esi,%eax
+f01037a9:	2b 05 68 47 79 f0    	sub    0xf0794768,%eax
+f01037af:	c1 f8 03             	sar    $0x3,%eax
+f01037b2:	89 c2                	mov    %eax,%edx
+f01037b4:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f01037b7:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f01037bc:	83 c4 10             	add    $0x10,%esp
+f01037bf:	3b 05 74 47 79 f0    	cmp    0xf0794774,%eax
+f01037c5:	0f 83 ce 01 00 00    	jae    f0103999 <mem_init+0x1aed>
+	memset(page2kva(pp2), 2, PGSIZE);
+f01037cb:	83 ec 04             	sub    $0x4,%esp
+f01037ce:	68 00 10 00 00       	push   $0x1000
+f01037d3:	6a 02                	push   $0x2
+	return (void *)(pa + KERNBASE);
+f01037d5:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f01037db:	52                   	push   %edx
+f01037dc:	e8 5a 4d 00 00       	call   f010853b <memset>
+	page_insert(kern_pgdir, pp1, (void*) PGSIZE, PTE_W);
+f01037e1:	6a 02                	push   $0x2
+f01037e3:	68 00 10 00 00       	push   $0x1000
+f01037e8:	57                   	push   %edi
+f01037e9:	ff 35 6c 47 79 f0    	push   0xf079476c
+f01037ef:	e8 56 e2 ff ff       	call   f0101a4a <page_insert>
+	assert(pp1->pp_ref == 1);
+f01037f4:	83 c4 20             	add    $0x20,%esp
+f01037f7:	66 83 7f 04 01       	cmpw   $0x1,0x4(%edi)
+f01037fc:	0f 85 ac 01 00 00    	jne    f01039ae <mem_init+0x1b02>
+	assert(*(uint32_t *)PGSIZE == 0x01010101U);
+f0103802:	81 3d 00 10 00 00 01 	cmpl   $0x1010101,0x1000
+f0103809:	01 01 01 
+f010380c:	0f 85 b5 01 00 00    	jne    f01039c7 <mem_init+0x1b1b>
+	page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W);
+f0103812:	6a 02                	push   $0x2
+f0103814:	68 00 10 00 00       	push   $0x1000
+f0103819:	56                   	push   %esi
+f010381a:	ff 35 6c 47 79 f0    	push   0xf079476c
+f0103820:	e8 25 e2 ff ff       	call   f0101a4a <page_insert>
+	assert(*(uint32_t *)PGSIZE == 0x02020202U);
+f0103825:	83 c4 10             	add    $0x10,%esp
+f0103828:	81 3d 00 10 00 00 02 	cmpl   $0x2020202,0x1000
+f010382f:	02 02 02 
+f0103832:	0f 85 a8 01 00 00    	jne    f01039e0 <mem_init+0x1b34>
+	assert(pp2->pp_ref == 1);
+f0103838:	66 83 7e 04 01       	cmpw   $0x1,0x4(%esi)
+f010383d:	0f 85 b6 01 00 00    	jne    f01039f9 <mem_init+0x1b4d>
+	assert(pp1->pp_ref == 0);
+f0103843:	66 83 7f 04 00       	cmpw   $0x0,0x4(%edi)
+f0103848:	0f 85 c4 01 00 00    	jne    f0103a12 <mem_init+0x1b66>
+	*(uint32_t *)PGSIZE = 0x03030303U;
+f010384e:	c7 05 00 10 00 00 03 	movl   $0x3030303,0x1000
+f0103855:	03 03 03 
+	return (pp - pages) << PGSHIFT;
+f0103858:	89 f0                	mov    %esi,%eax
+f010385a:	2b 05 68 47 79 f0    	sub    0xf0794768,%eax
+f0103860:	c1 f8 03             	sar    $0x3,%eax
+f0103863:	89 c2                	mov    %eax,%edx
+f0103865:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0103868:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f010386d:	3b 05 74 47 79 f0    	cmp    0xf0794774,%eax
+f0103873:	0f 83 b2 01 00 00    	jae    f0103a2b <mem_init+0x1b7f>
+	assert(*(uint32_t *)page2kva(pp2) == 0x03030303U);
+f0103879:	81 ba 00 00 00 f0 03 	cmpl   $0x3030303,-0x10000000(%edx)
+f0103880:	03 03 03 
+f0103883:	0f 85 b7 01 00 00    	jne    f0103a40 <mem_init+0x1b94>
+	page_remove(kern_pgdir, (void*) PGSIZE);
+f0103889:	83 ec 08             	sub    $0x8,%esp
+f010388c:	68 00 10 00 00       	push   $0x1000
+f0103891:	ff 35 6c 47 79 f0    	push   0xf079476c
+f0103897:	e8 2b e1 ff ff       	call   f01019c7 <page_remove>
+	assert(pp2->pp_ref == 0);
+f010389c:	83 c4 10             	add    $0x10,%esp
+f010389f:	66 83 7e 04 00       	cmpw   $0x0,0x4(%esi)
+f01038a4:	0f 85 af 01 00 00    	jne    f0103a59 <mem_init+0x1bad>
+
+	// forcibly take pp0 back
+	assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f01038aa:	8b 0d 6c 47 79 f0    	mov    0xf079476c,%ecx
+f01038b0:	8b 11                	mov    (%ecx),%edx
+f01038b2:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+	return (pp - pages) << PGSHIFT;
+f01038b8:	89 d8                	mov    %ebx,%eax
+f01038ba:	2b 05 68 47 79 f0    	sub    0xf0794768,%eax
+f01038c0:	c1 f8 03             	sar    $0x3,%eax
+f01038c3:	c1 e0 0c             	shl    $0xc,%eax
+f01038c6:	39 c2                	cmp    %eax,%edx
+f01038c8:	0f 85 a4 01 00 00    	jne    f0103a72 <mem_init+0x1bc6>
+	kern_pgdir[0] = 0;
+f01038ce:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+	assert(pp0->pp_ref == 1);
+f01038d4:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f01038d9:	0f 85 ac 01 00 00    	jne    f0103a8b <mem_init+0x1bdf>
+	pp0->pp_ref = 0;
+f01038df:	66 c7 43 04 00 00    	movw   $0x0,0x4(%ebx)
+
+	// free the pages we took
+	page_free(pp0);
+f01038e5:	83 ec 0c             	sub    $0xc,%esp
+f01038e8:	53                   	push   %ebx
+f01038e9:	e8 82 d9 ff ff       	call   f0101270 <page_free>
+
+	cprintf("check_page_installed_pgdir() succeeded!\n");
+f01038ee:	c7 04 24 00 ce 10 f0 	movl   $0xf010ce00,(%esp)
+f01038f5:	e8 bb 12 00 00       	call   f0104bb5 <cprintf>
+	if (!(zero_page = page_alloc(ALLOC_ZERO)))
+f01038fa:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+f0103901:	e8 df d8 ff ff       	call   f01011e5 <page_alloc>
+f0103906:	a3 64 47 79 f0       	mov    %eax,0xf0794764
+f010390b:	83 c4 10             	add    $0x10,%esp
+f010390e:	85 c0                	test   %eax,%eax
+f0103910:	0f 84 8e 01 00 00    	je     f0103aa4 <mem_init+0x1bf8>
+	zero_page->pp_ref = 1;
+f0103916:	66 c7 40 04 01 00    	movw   $0x1,0x4(%eax)
+}
+f010391c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010391f:	5b                   	pop    %ebx
+f0103920:	5e                   	pop    %esi
+f0103921:	5f                   	pop    %edi
+f0103922:	5d                   	pop    %ebp
+f0103923:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0103924:	50                   	push   %eax
+f0103925:	68 24 be 10 f0       	push   $0xf010be24
+f010392a:	68 ed 00 00 00       	push   $0xed
+f010392f:	68 89 ce 10 f0       	push   $0xf010ce89
+f0103934:	e8 0a c7 ff ff       	call   f0100043 <_panic>
+	assert((pp0 = page_alloc(0)));
+f0103939:	68 92 cf 10 f0       	push   $0xf010cf92
+f010393e:	68 bf be 10 f0       	push   $0xf010bebf
+f0103943:	68 96 05 00 00       	push   $0x596
+f0103948:	68 89 ce 10 f0       	push   $0xf010ce89
+f010394d:	e8 f1 c6 ff ff       	call   f0100043 <_panic>
+	assert((pp1 = page_alloc(0)));
+f0103952:	68 a8 cf 10 f0       	push   $0xf010cfa8
+f0103957:	68 bf be 10 f0       	push   $0xf010bebf
+f010395c:	68 97 05 00 00       	push   $0x597
+f0103961:	68 89 ce 10 f0       	push   $0xf010ce89
+f0103966:	e8 d8 c6 ff ff       	call   f0100043 <_panic>
+	assert((pp2 = page_alloc(0)));
+f010396b:	68 be cf 10 f0       	push   $0xf010cfbe
+f0103970:	68 bf be 10 f0       	push   $0xf010bebf
+f0103975:	68 98 05 00 00       	push   $0x598
+f010397a:	68 89 ce 10 f0       	push   $0xf010ce89
+f010397f:	e8 bf c6 ff ff       	call   f0100043 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0103984:	52                   	push   %edx
+f0103985:	68 90 be 10 f0       	push   $0xf010be90
+f010398a:	68 a4 00 00 00       	push   $0xa4
+f010398f:	68 95 ce 10 f0       	push   $0xf010ce95
+f0103994:	e8 aa c6 ff ff       	call   f0100043 <_panic>
+f0103999:	52                   	push   %edx
+f010399a:	68 90 be 10 f0       	push   $0xf010be90
+f010399f:	68 a4 00 00 00       	push   $0xa4
+f01039a4:	68 95 ce 10 f0       	push   $0xf010ce95
+f01039a9:	e8 95 c6 ff ff       	call   f0100043 <_panic>
+	assert(pp1->pp_ref == 1);
+f01039ae:	68 8f d0 10 f0       	push   $0xf010d08f
+f01039b3:	68 bf be 10 f0       	push   $0xf010bebf
+f01039b8:	68 9d 05 00 00       	push   $0x59d
+f01039bd:	68 89 ce 10 f0       	push   $0xf010ce89
+f01039c2:	e8 7c c6 ff ff       	call   f0100043 <_panic>
+	assert(*(uint32_t *)PGSIZE == 0x01010101U);
+f01039c7:	68 8c cd 10 f0       	push   $0xf010cd8c
+f01039cc:	68 bf be 10 f0       	push   $0xf010bebf
+f01039d1:	68 9e 05 00 00       	push   $0x59e
+f01039d6:	68 89 ce 10 f0       	push   $0xf010ce89
+f01039db:	e8 63 c6 ff ff       	call   f0100043 <_panic>
+	assert(*(uint32_t *)PGSIZE == 0x02020202U);
+f01039e0:	68 b0 cd 10 f0       	push   $0xf010cdb0
+f01039e5:	68 bf be 10 f0       	push   $0xf010bebf
+f01039ea:	68 a0 05 00 00       	push   $0x5a0
+f01039ef:	68 89 ce 10 f0       	push   $0xf010ce89
+f01039f4:	e8 4a c6 ff ff       	call   f0100043 <_panic>
+	assert(pp2->pp_ref == 1);
+f01039f9:	68 b1 d0 10 f0       	push   $0xf010d0b1
+f01039fe:	68 bf be 10 f0       	push   $0xf010bebf
+f0103a03:	68 a1 05 00 00       	push   $0x5a1
+f0103a08:	68 89 ce 10 f0       	push   $0xf010ce89
+f0103a0d:	e8 31 c6 ff ff       	call   f0100043 <_panic>
+	assert(pp1->pp_ref == 0);
+f0103a12:	68 1b d1 10 f0       	push   $0xf010d11b
+f0103a17:	68 bf be 10 f0       	push   $0xf010bebf
+f0103a1c:	68 a2 05 00 00       	push   $0x5a2
+f0103a21:	68 89 ce 10 f0       	push   $0xf010ce89
+f0103a26:	e8 18 c6 ff ff       	call   f0100043 <_panic>
+f0103a2b:	52                   	push   %edx
+f0103a2c:	68 90 be 10 f0       	push   $0xf010be90
+f0103a31:	68 a4 00 00 00       	push   $0xa4
+f0103a36:	68 95 ce 10 f0       	push   $0xf010ce95
+f0103a3b:	e8 03 c6 ff ff       	call   f0100043 <_panic>
+	assert(*(uint32_t *)page2kva(pp2) == 0x03030303U);
+f0103a40:	68 d4 cd 10 f0       	push   $0xf010cdd4
+f0103a45:	68 bf be 10 f0       	push   $0xf010bebf
+f0103a4a:	68 a4 05 00 00       	push   $0x5a4
+f0103a4f:	68 89 ce 10 f0       	push   $0xf010ce89
+f0103a54:	e8 ea c5 ff ff       	call   f0100043 <_panic>
+	assert(pp2->pp_ref == 0);
+f0103a59:	68 e9 d0 10 f0       	push   $0xf010d0e9
+f0103a5e:	68 bf be 10 f0       	push   $0xf010bebf
+f0103a63:	68 a6 05 00 00       	push   $0x5a6
+f0103a68:	68 89 ce 10 f0       	push   $0xf010ce89
+f0103a6d:	e8 d1 c5 ff ff       	call   f0100043 <_panic>
+	assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f0103a72:	68 90 c7 10 f0       	push   $0xf010c790
+f0103a77:	68 bf be 10 f0       	push   $0xf010bebf
+f0103a7c:	68 a9 05 00 00       	push   $0x5a9
+f0103a81:	68 89 ce 10 f0       	push   $0xf010ce89
+f0103a86:	e8 b8 c5 ff ff       	call   f0100043 <_panic>
+	assert(pp0->pp_ref == 1);
+f0103a8b:	68 a0 d0 10 f0       	push   $0xf010d0a0
+f0103a90:	68 bf be 10 f0       	push   $0xf010bebf
+f0103a95:	68 ab 05 00 00       	push   $0x5ab
+f0103a9a:	68 89 ce 10 f0       	push   $0xf010ce89
+f0103a9f:	e8 9f c5 ff ff       	call   f0100043 <_panic>
+		panic("mem_init: no memory for the zero page");
+f0103aa4:	83 ec 04             	sub    $0x4,%esp
+f0103aa7:	68 2c ce 10 f0       	push   $0xf010ce2c
+f0103aac:	68 fe 00 00 00       	push   $0xfe
+f0103ab1:	68 89 ce 10 f0       	push   $0xf010ce89
+f0103ab6:	e8 88 c5 ff ff       	call   f0100043 <_panic>
+
+f0103abb <user_mem_check>:
+{
+f0103abb:	55                   	push   %ebp
+f0103abc:	89 e5                	mov    %esp,%ebp
+f0103abe:	57                   	push   %edi
+f0103abf:	56                   	push   %esi
+f0103ac0:	53                   	push   %ebx
+f0103ac1:	83 ec 3c             	sub    $0x3c,%esp
+f0103ac4:	8b 75 08             	mov    0x8(%ebp),%esi
+f0103ac7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t pg_start = ROUNDDOWN((uint32_t) va, PGSIZE);
+f0103aca:	89 fa                	mov    %edi,%edx
+f0103acc:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  uint32_t pg_end = ROUNDUP((uint32_t) va+len, PGSIZE);
+f0103ad2:	8b 45 10             	mov    0x10(%ebp),%eax
+f0103ad5:	8d 84 07 ff 0f 00 00 	lea    0xfff(%edi,%eax,1),%eax
+f0103adc:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0103ae1:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  for (int i = pg_start; i < pg_end; i+= PGSIZE) {
+f0103ae4:	89 d3                	mov    %edx,%ebx
+    if ((perm & PTE_W) && i < UTOP
+f0103ae6:	8b 45 14             	mov    0x14(%ebp),%eax
+f0103ae9:	83 e0 02             	and    $0x2,%eax
+f0103aec:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0103aef:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+  for (int i = pg_start; i < pg_end; i+= PGSIZE) {
+f0103af2:	eb 62                	jmp    f0103b56 <user_mem_check+0x9b>
+      user_mem_check_addr = (i == pg_start) ? (uint32_t) va : (uint32_t) i;
+f0103af4:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+f0103af7:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+f0103afa:	8b 7d 0c             	mov    0xc(%ebp),%edi
+f0103afd:	39 ca                	cmp    %ecx,%edx
+f0103aff:	0f 44 cf             	cmove  %edi,%ecx
+f0103b02:	e9 73 01 00 00       	jmp    f0103c7a <user_mem_check+0x1bf>
+      user_mem_check_addr = (i == pg_start) ? (uint32_t) va : (uint32_t) i;
+f0103b07:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+f0103b0a:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+f0103b0d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+f0103b10:	39 ca                	cmp    %ecx,%edx
+f0103b12:	0f 44 cf             	cmove  %edi,%ecx
+f0103b15:	e9 60 01 00 00       	jmp    f0103c7a <user_mem_check+0x1bf>
+    struct PageInfo* pp = page_lookup(env->env_pgdir, (void*) i, &pte_store);
+f0103b1a:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+f0103b1d:	83 ec 04             	sub    $0x4,%esp
+f0103b20:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0103b23:	50                   	push   %eax
+f0103b24:	53                   	push   %ebx
+f0103b25:	ff 76 60             	push   0x60(%esi)
+f0103b28:	e8 5d dd ff ff       	call   f010188a <page_lookup>
+f0103b2d:	89 c7                	mov    %eax,%edi
+    if (!pp && (elfcache_fault(env, i) == 0 || env_stack_grow(env, i) == 0))
+f0103b2f:	83 c4 10             	add    $0x10,%esp
+f0103b32:	85 c0                	test   %eax,%eax
+f0103b34:	0f 84 90 00 00 00    	je     f0103bca <user_mem_check+0x10f>
+    if (pp && (perm & PTE_W) && (*pte_store & PTE_COW)
+f0103b3a:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+f0103b3e:	75 6e                	jne    f0103bae <user_mem_check+0xf3>
+    if (!pp || ((*pte_store & (perm)) ^ (perm))) {
+f0103b40:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0103b43:	8b 00                	mov    (%eax),%eax
+f0103b45:	f7 d0                	not    %eax
+f0103b47:	85 45 14             	test   %eax,0x14(%ebp)
+f0103b4a:	0f 85 11 01 00 00    	jne    f0103c61 <user_mem_check+0x1a6>
+  for (int i = pg_start; i < pg_end; i+= PGSIZE) {
+f0103b50:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0103b56:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+f0103b59:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f0103b5c:	39 c3                	cmp    %eax,%ebx
+f0103b5e:	0f 83 29 01 00 00    	jae    f0103c8d <user_mem_check+0x1d2>
+    if (i >= ULIM) {
+f0103b64:	81 fb ff ff 7f ef    	cmp    $0xef7fffff,%ebx
+f0103b6a:	77 88                	ja     f0103af4 <user_mem_check+0x39>
+    if ((perm & PTE_W) && i < UTOP
+f0103b6c:	81 7d d4 ff ff bf ee 	cmpl   $0xeebfffff,-0x2c(%ebp)
+f0103b73:	77 a5                	ja     f0103b1a <user_mem_check+0x5f>
+f0103b75:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+f0103b79:	74 9f                	je     f0103b1a <user_mem_check+0x5f>
+        && pgdir_unshare(env->env_pgdir, (void*) i) < 0) {
+f0103b7b:	83 ec 08             	sub    $0x8,%esp
+f0103b7e:	53                   	push   %ebx
+f0103b7f:	ff 76 60             	push   0x60(%esi)
+f0103b82:	e8 2b da ff ff       	call   f01015b2 <pgdir_unshare>
+f0103b87:	83 c4 10             	add    $0x10,%esp
+f0103b8a:	85 c0                	test   %eax,%eax
+f0103b8c:	0f 88 75 ff ff ff    	js     f0103b07 <user_mem_check+0x4c>
+    struct PageInfo* pp = page_lookup(env->env_pgdir, (void*) i, &pte_store);
+f0103b92:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+f0103b95:	83 ec 04             	sub    $0x4,%esp
+f0103b98:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0103b9b:	50                   	push   %eax
+f0103b9c:	53                   	push   %ebx
+f0103b9d:	ff 76 60             	push   0x60(%esi)
+f0103ba0:	e8 e5 dc ff ff       	call   f010188a <page_lookup>
+f0103ba5:	89 c7                	mov    %eax,%edi
+    if (!pp && (elfcache_fault(env, i) == 0 || env_stack_grow(env, i) == 0))
+f0103ba7:	83 c4 10             	add    $0x10,%esp
+f0103baa:	85 c0                	test   %eax,%eax
+f0103bac:	74 1c                	je     f0103bca <user_mem_check+0x10f>
+    if (pp && (perm & PTE_W) && (*pte_store & PTE_COW)
+f0103bae:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0103bb1:	8b 00                	mov    (%eax),%eax
+f0103bb3:	f6 c4 08             	test   $0x8,%ah
+f0103bb6:	75 61                	jne    f0103c19 <user_mem_check+0x15e>
+    if (!pp || ((*pte_store & (perm)) ^ (perm))) {
+f0103bb8:	85 ff                	test   %edi,%edi
+f0103bba:	75 84                	jne    f0103b40 <user_mem_check+0x85>
+f0103bbc:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+f0103bbf:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+f0103bc2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+f0103bc5:	e9 ab 00 00 00       	jmp    f0103c75 <user_mem_check+0x1ba>
+    if (!pp && (elfcache_fault(env, i) == 0 || env_stack_grow(env, i) == 0))
+f0103bca:	83 ec 08             	sub    $0x8,%esp
+f0103bcd:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+f0103bd0:	57                   	push   %edi
+f0103bd1:	56                   	push   %esi
+f0103bd2:	e8 61 60 00 00       	call   f0109c38 <elfcache_fault>
+f0103bd7:	83 c4 10             	add    $0x10,%esp
+f0103bda:	85 c0                	test   %eax,%eax
+f0103bdc:	74 11                	je     f0103bef <user_mem_check+0x134>
+f0103bde:	83 ec 08             	sub    $0x8,%esp
+f0103be1:	57                   	push   %edi
+f0103be2:	56                   	push   %esi
+f0103be3:	e8 49 0a 00 00       	call   f0104631 <env_stack_grow>
+f0103be8:	83 c4 10             	add    $0x10,%esp
+f0103beb:	85 c0                	test   %eax,%eax
+f0103bed:	75 7d                	jne    f0103c6c <user_mem_check+0x1b1>
+      pp = page_lookup(env->env_pgdir, (void*) i, &pte_store);
+f0103bef:	83 ec 04             	sub    $0x4,%esp
+f0103bf2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0103bf5:	50                   	push   %eax
+f0103bf6:	ff 75 cc             	push   -0x34(%ebp)
+f0103bf9:	ff 76 60             	push   0x60(%esi)
+f0103bfc:	e8 89 dc ff ff       	call   f010188a <page_lookup>
+f0103c01:	89 c7                	mov    %eax,%edi
+    if (pp && (perm & PTE_W) && (*pte_store & PTE_COW)
+f0103c03:	83 c4 10             	add    $0x10,%esp
+f0103c06:	85 c0                	test   %eax,%eax
+f0103c08:	0f 85 2c ff ff ff    	jne    f0103b3a <user_mem_check+0x7f>
+f0103c0e:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+f0103c11:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+f0103c14:	8b 7d 0c             	mov    0xc(%ebp),%edi
+f0103c17:	eb 5c                	jmp    f0103c75 <user_mem_check+0x1ba>
+        && (ksm_fault(env, i) == 0
+f0103c19:	83 ec 08             	sub    $0x8,%esp
+f0103c1c:	ff 75 d4             	push   -0x2c(%ebp)
+f0103c1f:	56                   	push   %esi
+f0103c20:	e8 84 5e 00 00       	call   f0109aa9 <ksm_fault>
+f0103c25:	83 c4 10             	add    $0x10,%esp
+f0103c28:	85 c0                	test   %eax,%eax
+f0103c2a:	74 19                	je     f0103c45 <user_mem_check+0x18a>
+            || page_cow_break(env->env_pgdir, (void*) i) == 0))
+f0103c2c:	83 ec 08             	sub    $0x8,%esp
+f0103c2f:	ff 75 cc             	push   -0x34(%ebp)
+f0103c32:	ff 76 60             	push   0x60(%esi)
+f0103c35:	e8 44 df ff ff       	call   f0101b7e <page_cow_break>
+f0103c3a:	83 c4 10             	add    $0x10,%esp
+f0103c3d:	85 c0                	test   %eax,%eax
+f0103c3f:	0f 85 73 ff ff ff    	jne    f0103bb8 <user_mem_check+0xfd>
+      pp = page_lookup(env->env_pgdir, (void*) i, &pte_store);
+f0103c45:	83 ec 04             	sub    $0x4,%esp
+f0103c48:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0103c4b:	50                   	push   %eax
+f0103c4c:	ff 75 cc             	push   -0x34(%ebp)
+f0103c4f:	ff 76 60             	push   0x60(%esi)
+f0103c52:	e8 33 dc ff ff       	call   f010188a <page_lookup>
+f0103c57:	89 c7                	mov    %eax,%edi
+f0103c59:	83 c4 10             	add    $0x10,%esp
+f0103c5c:	e9 57 ff ff ff       	jmp    f0103bb8 <user_mem_check+0xfd>
+f0103c61:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+f0103c64:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+f0103c67:	8b 7d 0c             	mov    0xc(%ebp),%edi
+f0103c6a:	eb 09                	jmp    f0103c75 <user_mem_check+0x1ba>
+f0103c6c:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+f0103c6f:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+f0103c72:	8b 7d 0c             	mov    0xc(%ebp),%edi
+      user_mem_check_addr = (i == pg_start) ? (uint32_t) va : (uint32_t) i;
+f0103c75:	39 ca                	cmp    %ecx,%edx
+f0103c77:	0f 44 cf             	cmove  %edi,%ecx
+      user_mem_check_addr = (i == pg_start) ? (uint32_t) va : (uint32_t) i;
+f0103c7a:	89 0d 7c 47 79 f0    	mov    %ecx,0xf079477c
+      return -E_FAULT;
+f0103c80:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+}
+f0103c85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103c88:	5b                   	pop    %ebx
+f0103c89:	5e                   	pop    %esi
+f0103c8a:	5f                   	pop    %edi
+f0103c8b:	5d                   	pop    %ebp
+f0103c8c:	c3                   	ret
+	return 0;
+f0103c8d:	b8 00 00 00 00       	mov    $0x0,%eax
+f0103c92:	eb f1                	jmp    f0103c85 <user_mem_check+0x1ca>
+
+f0103c94 <user_mem_fault>:
+{
+f0103c94:	55                   	push   %ebp
+f0103c95:	89 e5                	mov    %esp,%ebp
+f0103c97:	53                   	push   %ebx
+f0103c98:	83 ec 08             	sub    $0x8,%esp
+f0103c9b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("[%08x] user_mem_check assertion failure for "
+f0103c9e:	ff 75 0c             	push   0xc(%ebp)
+f0103ca1:	ff 73 48             	push   0x48(%ebx)
+f0103ca4:	68 54 ce 10 f0       	push   $0xf010ce54
+f0103ca9:	e8 07 0f 00 00       	call   f0104bb5 <cprintf>
+	env_destroy(env);	// may not return
+f0103cae:	89 1c 24             	mov    %ebx,(%esp)
+f0103cb1:	e8 c3 0c 00 00       	call   f0104979 <env_destroy>
+}
+f0103cb6:	83 c4 10             	add    $0x10,%esp
+f0103cb9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0103cbc:	c9                   	leave
+f0103cbd:	c3                   	ret
+
+f0103cbe <user_mem_assert>:
+{
+f0103cbe:	55                   	push   %ebp
+f0103cbf:	89 e5                	mov    %esp,%ebp
+f0103cc1:	53                   	push   %ebx
+f0103cc2:	83 ec 04             	sub    $0x4,%esp
+f0103cc5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (user_mem_check(env, va, len, perm | PTE_U) < 0)
+f0103cc8:	8b 45 14             	mov    0x14(%ebp),%eax
+f0103ccb:	83 c8 04             	or     $0x4,%eax
+f0103cce:	50                   	push   %eax
+f0103ccf:	ff 75 10             	push   0x10(%ebp)
+f0103cd2:	ff 75 0c             	push   0xc(%ebp)
+f0103cd5:	53                   	push   %ebx
+f0103cd6:	e8 e0 fd ff ff       	call   f0103abb <user_mem_check>
+f0103cdb:	83 c4 10             	add    $0x10,%esp
+f0103cde:	85 c0                	test   %eax,%eax
+f0103ce0:	78 05                	js     f0103ce7 <user_mem_assert+0x29>
+}
+f0103ce2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0103ce5:	c9                   	leave
+f0103ce6:	c3                   	ret
+		user_mem_fault(env, user_mem_check_addr);
+f0103ce7:	83 ec 08             	sub    $0x8,%esp
+f0103cea:	ff 35 7c 47 79 f0    	push   0xf079477c
+f0103cf0:	53                   	push   %ebx
+f0103cf1:	e8 9e ff ff ff       	call   f0103c94 <user_mem_fault>
+f0103cf6:	83 c4 10             	add    $0x10,%esp
+}
+f0103cf9:	eb e7                	jmp    f0103ce2 <user_mem_assert+0x24>
+
+f0103cfb <envid2env>:
+//   On success, sets *env_store to the environment.
+//   On error, sets *env_store to NULL.
+//
+int
+envid2env(envid_t envid, struct Env **env_store, bool checkperm)
+{
+f0103cfb:	55                   	push   %ebp
+f0103cfc:	89 e5                	mov    %esp,%ebp
+f0103cfe:	56                   	push   %esi
+f0103cff:	53                   	push   %ebx
+f0103d00:	8b 75 08             	mov    0x8(%ebp),%esi
+f0103d03:	8b 45 10             	mov    0x10(%ebp),%eax
+	struct Env *e;
+
+	// If envid is zero, return the current environment.
+	if (envid == 0) {
+f0103d06:	85 f6                	test   %esi,%esi
+f0103d08:	74 31                	je     f0103d3b <envid2env+0x40>
+	// Look up the Env structure via the index part of the envid,
+	// then check the env_id field in that struct Env
+	// to ensure that the envid is not stale
+	// (i.e., does not refer to a _previous_ environment
+	// that used the same slot in the envs[] array).
+	e = &envs[ENVX(envid)];
+f0103d0a:	89 f3                	mov    %esi,%ebx
+f0103d0c:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+f0103d12:	69 db 68 01 00 00    	imul   $0x168,%ebx,%ebx
+f0103d18:	03 1d 84 47 79 f0    	add    0xf0794784,%ebx
+	if (e->env_status == ENV_FREE || e->env_id != envid) {
+f0103d1e:	83 7b 54 00          	cmpl   $0x0,0x54(%ebx)
+f0103d22:	74 5b                	je     f0103d7f <envid2env+0x84>
+f0103d24:	39 73 48             	cmp    %esi,0x48(%ebx)
+f0103d27:	75 62                	jne    f0103d8b <envid2env+0x90>
+	// Check that the calling environment has legitimate permission
+	// to manipulate the specified environment.
+	// If checkperm is set, the specified environment
+	// must be either the current environment
+	// or an immediate child of the current environment.
+	if (checkperm && e != curenv && e->env_parent_id != curenv->env_id) {
+f0103d29:	84 c0                	test   %al,%al
+f0103d2b:	75 20                	jne    f0103d4d <envid2env+0x52>
+		*env_store = 0;
+		return -E_BAD_ENV;
+	}
+
+	*env_store = e;
+	return 0;
+f0103d2d:	b8 00 00 00 00       	mov    $0x0,%eax
+		*env_store = curenv;
+f0103d32:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0103d35:	89 1a                	mov    %ebx,(%edx)
+}
+f0103d37:	5b                   	pop    %ebx
+f0103d38:	5e                   	pop    %esi
+f0103d39:	5d                   	pop    %ebp
+f0103d3a:	c3                   	ret
+		*env_store = curenv;
+f0103d3b:	e8 f7 4e 00 00       	call   f0108c37 <cpunum>
+f0103d40:	6b c0 78             	imul   $0x78,%eax,%eax
+f0103d43:	8b 98 28 60 7d f0    	mov    -0xf829fd8(%eax),%ebx
+		return 0;
+f0103d49:	89 f0                	mov    %esi,%eax
+f0103d4b:	eb e5                	jmp    f0103d32 <envid2env+0x37>
+	if (checkperm && e != curenv && e->env_parent_id != curenv->env_id) {
+f0103d4d:	e8 e5 4e 00 00       	call   f0108c37 <cpunum>
+f0103d52:	6b c0 78             	imul   $0x78,%eax,%eax
+f0103d55:	39 98 28 60 7d f0    	cmp    %ebx,-0xf829fd8(%eax)
+f0103d5b:	74 d0                	je     f0103d2d <envid2env+0x32>
+f0103d5d:	8b 73 4c             	mov    0x4c(%ebx),%esi
+f0103d60:	e8 d2 4e 00 00       	call   f0108c37 <cpunum>
+f0103d65:	6b c0 78             	imul   $0x78,%eax,%eax
+f0103d68:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0103d6e:	3b 70 48             	cmp    0x48(%eax),%esi
+f0103d71:	74 ba                	je     f0103d2d <envid2env+0x32>
+f0103d73:	bb 00 00 00 00       	mov    $0x0,%ebx
+		return -E_BAD_ENV;
+f0103d78:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0103d7d:	eb b3                	jmp    f0103d32 <envid2env+0x37>
+f0103d7f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		return -E_BAD_ENV;
+f0103d84:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0103d89:	eb a7                	jmp    f0103d32 <envid2env+0x37>
+f0103d8b:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0103d90:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0103d95:	eb 9b                	jmp    f0103d32 <envid2env+0x37>
+
+f0103d97 <env_init_percpu>:
+	asm volatile("lgdt (%0)" : : "r" (p));
+f0103d97:	b8 20 a3 11 f0       	mov    $0xf011a320,%eax
+f0103d9c:	0f 01 10             	lgdtl  (%eax)
+env_init_percpu(void)
+{
+	lgdt(&gdt_pd);
+	// The kernel never uses GS or FS, so we leave those set to
+	// the user data segment.
+	asm volatile("movw %%ax,%%gs" : : "a" (GD_UD|3));
+f0103d9f:	b8 23 00 00 00       	mov    $0x23,%eax
+f0103da4:	8e e8                	mov    %eax,%gs
+	asm volatile("movw %%ax,%%fs" : : "a" (GD_UD|3));
+f0103da6:	8e e0                	mov    %eax,%fs
+	// The kernel does use ES, DS, and SS.  We'll change between
+	// the kernel and user data segments as needed.
+	asm volatile("movw %%ax,%%es" : : "a" (GD_KD));
+f0103da8:	b8 10 00 00 00       	mov    $0x10,%eax
+f0103dad:	8e c0                	mov    %eax,%es
+	asm volatile("movw %%ax,%%ds" : : "a" (GD_KD));
+f0103daf:	8e d8                	mov    %eax,%ds
+	asm volatile("movw %%ax,%%ss" : : "a" (GD_KD));
+f0103db1:	8e d0                	mov    %eax,%ss
+	// Load the kernel text segment into CS.
+	asm volatile("ljmp %0,$1f\n 1:\n" : : "i" (GD_KT));
+f0103db3:	ea ba 3d 10 f0 08 00 	ljmp   $0x8,$0xf0103dba
+	asm volatile("lldt %0" : : "r" (sel));
+f0103dba:	b8 00 00 00 00       	mov    $0x0,%eax
+f0103dbf:	0f 00 d0             	lldt   %ax
+	// For good measure, clear the local descriptor table (LDT),
+	// since we don't use it.
+	lldt(0);
+}
+f0103dc2:	c3                   	ret
+
+f0103dc3 <env_init>:
+{
+f0103dc3:	55                   	push   %ebp
+f0103dc4:	89 e5                	mov    %esp,%ebp
+f0103dc6:	56                   	push   %esi
+f0103dc7:	53                   	push   %ebx
+    envs[i].env_id = 0;
+f0103dc8:	8b 1d 84 47 79 f0    	mov    0xf0794784,%ebx
+f0103dce:	8b 15 88 47 79 f0    	mov    0xf0794788,%edx
+f0103dd4:	8d 83 98 9e 05 00    	lea    0x59e98(%ebx),%eax
+f0103dda:	81 eb 68 01 00 00    	sub    $0x168,%ebx
+  for (int i = NENV-1; i >= 0; i--) {
+f0103de0:	b9 00 00 00 00       	mov    $0x0,%ecx
+    envs[i].env_status = ENV_FREE;
+f0103de5:	be 01 00 00 00       	mov    $0x1,%esi
+  for (int i = NENV-1; i >= 0; i--) {
+f0103dea:	eb 1c                	jmp    f0103e08 <env_init+0x45>
+    envs[i].env_id = 0;
+f0103dec:	89 c1                	mov    %eax,%ecx
+f0103dee:	c7 40 48 00 00 00 00 	movl   $0x0,0x48(%eax)
+    envs[i].env_link = env_free_list;
+f0103df5:	89 50 44             	mov    %edx,0x44(%eax)
+    envs[i].env_status = ENV_FREE;
+f0103df8:	c7 40 54 00 00 00 00 	movl   $0x0,0x54(%eax)
+  for (int i = NENV-1; i >= 0; i--) {
+f0103dff:	2d 68 01 00 00       	sub    $0x168,%eax
+    env_free_list = &envs[i];
+f0103e04:	89 ca                	mov    %ecx,%edx
+    envs[i].env_status = ENV_FREE;
+f0103e06:	89 f1                	mov    %esi,%ecx
+  for (int i = NENV-1; i >= 0; i--) {
+f0103e08:	39 d8                	cmp    %ebx,%eax
+f0103e0a:	75 e0                	jne    f0103dec <env_init+0x29>
+f0103e0c:	84 c9                	test   %cl,%cl
+f0103e0e:	74 06                	je     f0103e16 <env_init+0x53>
+f0103e10:	89 15 88 47 79 f0    	mov    %edx,0xf0794788
+	env_init_percpu();
+f0103e16:	e8 7c ff ff ff       	call   f0103d97 <env_init_percpu>
+}
+f0103e1b:	5b                   	pop    %ebx
+f0103e1c:	5e                   	pop    %esi
+f0103e1d:	5d                   	pop    %ebp
+f0103e1e:	c3                   	ret
+
+f0103e1f <env_alloc>:
+//	-E_NO_FREE_ENV if all NENVS environments are allocated
+//	-E_NO_MEM on memory exhaustion
+//
+int
+env_alloc(struct Env **newenv_store, envid_t parent_id)
+{
+f0103e1f:	55                   	push   %ebp
+f0103e20:	89 e5                	mov    %esp,%ebp
+f0103e22:	57                   	push   %edi
+f0103e23:	56                   	push   %esi
+f0103e24:	53                   	push   %ebx
+f0103e25:	83 ec 0c             	sub    $0xc,%esp
+	int32_t generation;
+	int r;
+	struct Env *e;
+
+	if (!(e = env_free_list))
+f0103e28:	8b 1d 88 47 79 f0    	mov    0xf0794788,%ebx
+f0103e2e:	85 db                	test   %ebx,%ebx
+f0103e30:	0f 84 93 02 00 00    	je     f01040c9 <env_alloc+0x2aa>
+	if (!(p = page_alloc(ALLOC_ZERO)))
+f0103e36:	83 ec 0c             	sub    $0xc,%esp
+f0103e39:	6a 01                	push   $0x1
+f0103e3b:	e8 a5 d3 ff ff       	call   f01011e5 <page_alloc>
+f0103e40:	83 c4 10             	add    $0x10,%esp
+f0103e43:	85 c0                	test   %eax,%eax
+f0103e45:	0f 84 85 02 00 00    	je     f01040d0 <env_alloc+0x2b1>
+	return (pp - pages) << PGSHIFT;
+f0103e4b:	89 c2                	mov    %eax,%edx
+f0103e4d:	2b 15 68 47 79 f0    	sub    0xf0794768,%edx
+f0103e53:	c1 fa 03             	sar    $0x3,%edx
+f0103e56:	89 d7                	mov    %edx,%edi
+f0103e58:	c1 e7 0c             	shl    $0xc,%edi
+	if (PGNUM(pa) >= npages)
+f0103e5b:	81 e2 ff ff 0f 00    	and    $0xfffff,%edx
+f0103e61:	3b 15 74 47 79 f0    	cmp    0xf0794774,%edx
+f0103e67:	0f 83 32 02 00 00    	jae    f010409f <env_alloc+0x280>
+	return (void *)(pa + KERNBASE);
+f0103e6d:	8d b7 00 00 00 f0    	lea    -0x10000000(%edi),%esi
+  p->pp_ref++;
+f0103e73:	66 83 40 04 01       	addw   $0x1,0x4(%eax)
+  memcpy(env_pgdir, kern_pgdir, PGSIZE); 
+f0103e78:	83 ec 04             	sub    $0x4,%esp
+f0103e7b:	68 00 10 00 00       	push   $0x1000
+f0103e80:	ff 35 6c 47 79 f0    	push   0xf079476c
+f0103e86:	56                   	push   %esi
+f0103e87:	e8 46 47 00 00       	call   f01085d2 <memcpy>
+  e->env_pgdir = env_pgdir;
+f0103e8c:	89 73 60             	mov    %esi,0x60(%ebx)
+	if ((uint32_t)kva < KERNBASE)
+f0103e8f:	83 c4 10             	add    $0x10,%esp
+f0103e92:	81 fe ff ff ff ef    	cmp    $0xefffffff,%esi
+f0103e98:	0f 86 16 02 00 00    	jbe    f01040b4 <env_alloc+0x295>
+	e->env_pgdir[PDX(UVPT)] = PADDR(e->env_pgdir) | PTE_P | PTE_U;
+f0103e9e:	83 cf 05             	or     $0x5,%edi
+f0103ea1:	89 be f4 0e 00 00    	mov    %edi,0xef4(%esi)
+	// Allocate and set up the page directory for this environment.
+	if ((r = env_setup_vm(e)) < 0)
+		return r;
+
+	// Generate an env_id for this environment.
+	generation = (e->env_id + (1 << ENVGENSHIFT)) & ~(NENV - 1);
+f0103ea7:	8b 43 48             	mov    0x48(%ebx),%eax
+f0103eaa:	05 00 10 00 00       	add    $0x1000,%eax
+	if (generation <= 0)	// Don't create a negative env_id.
+		generation = 1 << ENVGENSHIFT;
+f0103eaf:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+f0103eb4:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0103eb9:	0f 4e c2             	cmovle %edx,%eax
+	e->env_id = generation | (e - envs);
+f0103ebc:	89 da                	mov    %ebx,%edx
+f0103ebe:	2b 15 84 47 79 f0    	sub    0xf0794784,%edx
+f0103ec4:	c1 fa 03             	sar    $0x3,%edx
+f0103ec7:	69 d2 a5 4f fa a4    	imul   $0xa4fa4fa5,%edx,%edx
+f0103ecd:	09 d0                	or     %edx,%eax
+f0103ecf:	89 43 48             	mov    %eax,0x48(%ebx)
+
+	// Set the basic status variables.
+	e->env_parent_id = parent_id;
+f0103ed2:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0103ed5:	89 43 4c             	mov    %eax,0x4c(%ebx)
+	e->env_type = ENV_TYPE_USER;
+f0103ed8:	c7 43 50 00 00 00 00 	movl   $0x0,0x50(%ebx)
+	e->env_status = ENV_RUNNABLE;
+f0103edf:	c7 43 54 02 00 00 00 	movl   $0x2,0x54(%ebx)
+	e->env_runs = 0;
+f0103ee6:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+
+	// Clear out all the saved register state,
+	// to prevent the register values
+	// of a prior environment inhabiting this Env structure
+	// from "leaking" into our new environment.
+	memset(&e->env_tf, 0, sizeof(e->env_tf));
+f0103eed:	83 ec 04             	sub    $0x4,%esp
+f0103ef0:	6a 44                	push   $0x44
+f0103ef2:	6a 00                	push   $0x0
+f0103ef4:	53                   	push   %ebx
+f0103ef5:	e8 41 46 00 00       	call   f010853b <memset>
+	// The low 2 bits of each segment register contains the
+	// Requestor Privilege Level (RPL); 3 means user mode.  When
+	// we switch privilege levels, the hardware does various
+	// checks involving the RPL and the Descriptor Privilege Level
+	// (DPL) stored in the descriptors themselves.
+	e->env_tf.tf_ds = GD_UD | 3;
+f0103efa:	66 c7 43 24 23 00    	movw   $0x23,0x24(%ebx)
+	e->env_tf.tf_es = GD_UD | 3;
+f0103f00:	66 c7 43 20 23 00    	movw   $0x23,0x20(%ebx)
+	e->env_tf.tf_ss = GD_UD | 3;
+f0103f06:	66 c7 43 40 23 00    	movw   $0x23,0x40(%ebx)
+	e->env_tf.tf_esp = USTACKTOP;
+f0103f0c:	c7 43 3c 00 e0 bf ee 	movl   $0xeebfe000,0x3c(%ebx)
+	e->env_tf.tf_cs = GD_UT | 3;
+f0103f13:	66 c7 43 34 1b 00    	movw   $0x1b,0x34(%ebx)
+
+	// Enable interrupts while in user mode.
+	// LAB 4: Your code here.
+
+	// Nothing to demand-load until load_icode says so.
+	e->env_binary = NULL;
+f0103f19:	c7 43 64 00 00 00 00 	movl   $0x0,0x64(%ebx)
+	e->env_load_cycles = 0;
+f0103f20:	c7 43 68 00 00 00 00 	movl   $0x0,0x68(%ebx)
+f0103f27:	c7 43 6c 00 00 00 00 	movl   $0x0,0x6c(%ebx)
+	e->env_stack_limit = USTACKSIZE;
+f0103f2e:	c7 43 70 00 00 10 00 	movl   $0x100000,0x70(%ebx)
+
+	// Clear the page fault handler until user installs one.
+	e->env_pgfault_upcall = 0;
+f0103f35:	c7 43 74 00 00 00 00 	movl   $0x0,0x74(%ebx)
+
+	// Also clear the IPC receiving flag, and start with an empty queue.
+	e->env_ipc_recving = 0;
+f0103f3c:	c6 43 78 00          	movb   $0x0,0x78(%ebx)
+	e->env_ipc_qhead = e->env_ipc_qtail = e->env_ipc_qnext = NULL;
+f0103f40:	c7 83 ac 00 00 00 00 	movl   $0x0,0xac(%ebx)
+f0103f47:	00 00 00 
+f0103f4a:	c7 83 a8 00 00 00 00 	movl   $0x0,0xa8(%ebx)
+f0103f51:	00 00 00 
+f0103f54:	c7 83 a4 00 00 00 00 	movl   $0x0,0xa4(%ebx)
+f0103f5b:	00 00 00 
+	e->env_ipc_sendto = 0;
+f0103f5e:	c7 83 b0 00 00 00 00 	movl   $0x0,0xb0(%ebx)
+f0103f65:	00 00 00 
+	e->env_ipc_qlen = e->env_ipc_queued = e->env_ipc_drops = 0;
+f0103f68:	c7 83 dc 00 00 00 00 	movl   $0x0,0xdc(%ebx)
+f0103f6f:	00 00 00 
+f0103f72:	c7 83 d8 00 00 00 00 	movl   $0x0,0xd8(%ebx)
+f0103f79:	00 00 00 
+f0103f7c:	c7 83 d4 00 00 00 00 	movl   $0x0,0xd4(%ebx)
+f0103f83:	00 00 00 
+	e->env_ipc_replyfrom = 0;
+f0103f86:	c7 83 e4 00 00 00 00 	movl   $0x0,0xe4(%ebx)
+f0103f8d:	00 00 00 
+	e->env_ipc_inregs = 0;
+f0103f90:	c6 83 e8 00 00 00 00 	movb   $0x0,0xe8(%ebx)
+
+	// No endpoints yet: capabilities are not inherited.
+	memset(e->env_ep_caps, 0, sizeof(e->env_ep_caps));
+f0103f97:	83 c4 0c             	add    $0xc,%esp
+f0103f9a:	6a 20                	push   $0x20
+f0103f9c:	6a 00                	push   $0x0
+f0103f9e:	8d 83 ec 00 00 00    	lea    0xec(%ebx),%eax
+f0103fa4:	50                   	push   %eax
+f0103fa5:	e8 91 45 00 00       	call   f010853b <memset>
+	memset(e->env_ep_waitset, 0, sizeof(e->env_ep_waitset));
+f0103faa:	83 c4 0c             	add    $0xc,%esp
+f0103fad:	6a 20                	push   $0x20
+f0103faf:	6a 00                	push   $0x0
+f0103fb1:	8d 83 0c 01 00 00    	lea    0x10c(%ebx),%eax
+f0103fb7:	50                   	push   %eax
+f0103fb8:	e8 7e 45 00 00       	call   f010853b <memset>
+	e->env_ep_waiting = 0;
+f0103fbd:	c6 83 2c 01 00 00 00 	movb   $0x0,0x12c(%ebx)
+	e->env_ep_sendto = 0;
+f0103fc4:	c7 83 30 01 00 00 00 	movl   $0x0,0x130(%ebx)
+f0103fcb:	00 00 00 
+	e->env_ep_qnext = NULL;
+f0103fce:	c7 83 34 01 00 00 00 	movl   $0x0,0x134(%ebx)
+f0103fd5:	00 00 00 
+	e->env_ep_last = 0;
+f0103fd8:	c7 83 38 01 00 00 00 	movl   $0x0,0x138(%ebx)
+f0103fdf:	00 00 00 
+
+	// Not sleeping on a futex.
+	e->env_futex_pa = 0;
+f0103fe2:	c7 83 3c 01 00 00 00 	movl   $0x0,0x13c(%ebx)
+f0103fe9:	00 00 00 
+	e->env_futex_next = NULL;
+f0103fec:	c7 83 40 01 00 00 00 	movl   $0x0,0x140(%ebx)
+f0103ff3:	00 00 00 
+	e->env_futex_deadline = 0;
+f0103ff6:	c7 83 44 01 00 00 00 	movl   $0x0,0x144(%ebx)
+f0103ffd:	00 00 00 
+f0104000:	c7 83 48 01 00 00 00 	movl   $0x0,0x148(%ebx)
+f0104007:	00 00 00 
+
+	// No system call ring; a forked child registers its own.
+	e->env_sysring = NULL;
+f010400a:	c7 83 4c 01 00 00 00 	movl   $0x0,0x14c(%ebx)
+f0104011:	00 00 00 
+
+	// Start fault-around small; it grows if it pays off.
+	e->env_faults = 0;
+f0104014:	c7 83 50 01 00 00 00 	movl   $0x0,0x150(%ebx)
+f010401b:	00 00 00 
+	e->env_prefaults = 0;
+f010401e:	c7 83 54 01 00 00 00 	movl   $0x0,0x154(%ebx)
+f0104025:	00 00 00 
+	e->env_prefault_hits = 0;
+f0104028:	c7 83 58 01 00 00 00 	movl   $0x0,0x158(%ebx)
+f010402f:	00 00 00 
+	e->env_fault_around = 1;
+f0104032:	c7 83 5c 01 00 00 01 	movl   $0x1,0x15c(%ebx)
+f0104039:	00 00 00 
+	e->env_nprefault = 0;
+f010403c:	c7 83 60 01 00 00 00 	movl   $0x0,0x160(%ebx)
+f0104043:	00 00 00 
+
+	// commit the allocation
+	env_free_list = e->env_link;
+f0104046:	8b 43 44             	mov    0x44(%ebx),%eax
+f0104049:	a3 88 47 79 f0       	mov    %eax,0xf0794788
+	*newenv_store = e;
+f010404e:	8b 45 08             	mov    0x8(%ebp),%eax
+f0104051:	89 18                	mov    %ebx,(%eax)
+
+	cprintf("[%08x] new env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
+f0104053:	8b 5b 48             	mov    0x48(%ebx),%ebx
+f0104056:	e8 dc 4b 00 00       	call   f0108c37 <cpunum>
+f010405b:	6b c0 78             	imul   $0x78,%eax,%eax
+f010405e:	83 c4 10             	add    $0x10,%esp
+f0104061:	ba 00 00 00 00       	mov    $0x0,%edx
+f0104066:	83 b8 28 60 7d f0 00 	cmpl   $0x0,-0xf829fd8(%eax)
+f010406d:	74 11                	je     f0104080 <env_alloc+0x261>
+f010406f:	e8 c3 4b 00 00       	call   f0108c37 <cpunum>
+f0104074:	6b c0 78             	imul   $0x78,%eax,%eax
+f0104077:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f010407d:	8b 50 48             	mov    0x48(%eax),%edx
+f0104080:	83 ec 04             	sub    $0x4,%esp
+f0104083:	53                   	push   %ebx
+f0104084:	52                   	push   %edx
+f0104085:	68 e3 d1 10 f0       	push   $0xf010d1e3
+f010408a:	e8 26 0b 00 00       	call   f0104bb5 <cprintf>
+	return 0;
+f010408f:	83 c4 10             	add    $0x10,%esp
+f0104092:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0104097:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010409a:	5b                   	pop    %ebx
+f010409b:	5e                   	pop    %esi
+f010409c:	5f                   	pop    %edi
+f010409d:	5d                   	pop    %ebp
+f010409e:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f010409f:	57                   	push   %edi
+f01040a0:	68 90 be 10 f0       	push   $0xf010be90
+f01040a5:	68 a4 00 00 00       	push   $0xa4
+f01040aa:	68 95 ce 10 f0       	push   $0xf010ce95
+f01040af:	e8 8f bf ff ff       	call   f0100043 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01040b4:	56                   	push   %esi
+f01040b5:	68 24 be 10 f0       	push   $0xf010be24
+f01040ba:	68 cb 00 00 00       	push   $0xcb
+f01040bf:	68 d8 d1 10 f0       	push   $0xf010d1d8
+f01040c4:	e8 7a bf ff ff       	call   f0100043 <_panic>
+		return -E_NO_FREE_ENV;
+f01040c9:	b8 fb ff ff ff       	mov    $0xfffffffb,%eax
+f01040ce:	eb c7                	jmp    f0104097 <env_alloc+0x278>
+		return -E_NO_MEM;
+f01040d0:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f01040d5:	eb c0                	jmp    f0104097 <env_alloc+0x278>
+
+f01040d7 <env_create>:
+// before running the first user-mode environment.
+// The new env's parent ID is set to 0.
+//
+void
+env_create(uint8_t *binary, enum EnvType type)
+{
+f01040d7:	55                   	push   %ebp
+f01040d8:	89 e5                	mov    %esp,%ebp
+f01040da:	57                   	push   %edi
+f01040db:	56                   	push   %esi
+f01040dc:	53                   	push   %ebx
+f01040dd:	83 ec 34             	sub    $0x34,%esp
+f01040e0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	// LAB 3: Your code here.
+	struct Env *e;
+	env_alloc(&e, 0);
+f01040e3:	6a 00                	push   $0x0
+f01040e5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01040e8:	50                   	push   %eax
+f01040e9:	e8 31 fd ff ff       	call   f0103e1f <env_alloc>
+  e->env_type = type;
+f01040ee:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f01040f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+f01040f4:	89 46 50             	mov    %eax,0x50(%esi)
+	asm volatile("rdtsc" : "=A" (tsc));
+f01040f7:	0f 31                	rdtsc
+f01040f9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f01040fc:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  if (bin->e_magic != ELF_MAGIC) panic("Not an executable");
+f01040ff:	83 c4 10             	add    $0x10,%esp
+f0104102:	81 3b 7f 45 4c 46    	cmpl   $0x464c457f,(%ebx)
+f0104108:	75 10                	jne    f010411a <env_create+0x43>
+  ph = (struct Proghdr *) ((uint8_t *) bin + bin->e_phoff);
+f010410a:	89 d8                	mov    %ebx,%eax
+f010410c:	03 43 1c             	add    0x1c(%ebx),%eax
+  eph = ph + bin->e_phnum;
+f010410f:	0f b7 4b 2c          	movzwl 0x2c(%ebx),%ecx
+f0104113:	c1 e1 05             	shl    $0x5,%ecx
+f0104116:	01 c1                	add    %eax,%ecx
+  for (; ph < eph; ph++)
+f0104118:	eb 1a                	jmp    f0104134 <env_create+0x5d>
+  if (bin->e_magic != ELF_MAGIC) panic("Not an executable");
+f010411a:	83 ec 04             	sub    $0x4,%esp
+f010411d:	68 f8 d1 10 f0       	push   $0xf010d1f8
+f0104122:	68 8d 01 00 00       	push   $0x18d
+f0104127:	68 d8 d1 10 f0       	push   $0xf010d1d8
+f010412c:	e8 12 bf ff ff       	call   f0100043 <_panic>
+  for (; ph < eph; ph++)
+f0104131:	83 c0 20             	add    $0x20,%eax
+f0104134:	39 c8                	cmp    %ecx,%eax
+f0104136:	73 35                	jae    f010416d <env_create+0x96>
+    if (ph->p_type == ELF_PROG_LOAD
+f0104138:	83 38 01             	cmpl   $0x1,(%eax)
+f010413b:	75 f4                	jne    f0104131 <env_create+0x5a>
+        && (ph->p_filesz > ph->p_memsz
+f010413d:	8b 50 14             	mov    0x14(%eax),%edx
+f0104140:	3b 50 10             	cmp    0x10(%eax),%edx
+f0104143:	72 11                	jb     f0104156 <env_create+0x7f>
+            || ph->p_va + ph->p_memsz < ph->p_va
+f0104145:	8b 78 08             	mov    0x8(%eax),%edi
+f0104148:	01 fa                	add    %edi,%edx
+            || ph->p_va + ph->p_memsz > UTOP))
+f010414a:	81 fa 00 00 c0 ee    	cmp    $0xeec00000,%edx
+f0104150:	77 04                	ja     f0104156 <env_create+0x7f>
+f0104152:	39 fa                	cmp    %edi,%edx
+f0104154:	73 db                	jae    f0104131 <env_create+0x5a>
+      panic("load_icode: bad segment at %08x", ph->p_va);
+f0104156:	ff 70 08             	push   0x8(%eax)
+f0104159:	68 b8 d1 10 f0       	push   $0xf010d1b8
+f010415e:	68 99 01 00 00       	push   $0x199
+f0104163:	68 d8 d1 10 f0       	push   $0xf010d1d8
+f0104168:	e8 d6 be ff ff       	call   f0100043 <_panic>
+  e->env_binary = binary;
+f010416d:	89 5e 64             	mov    %ebx,0x64(%esi)
+	  struct PageInfo *pp = page_alloc(0);
+f0104170:	83 ec 0c             	sub    $0xc,%esp
+f0104173:	6a 00                	push   $0x0
+f0104175:	e8 6b d0 ff ff       	call   f01011e5 <page_alloc>
+    if (!pp) panic("Out of Memory");
+f010417a:	83 c4 10             	add    $0x10,%esp
+f010417d:	85 c0                	test   %eax,%eax
+f010417f:	74 3a                	je     f01041bb <env_create+0xe4>
+    if(page_insert(e->env_pgdir, pp, (void*) i, PTE_P | PTE_U | PTE_W) == -1*E_NO_MEM)
+f0104181:	6a 07                	push   $0x7
+f0104183:	68 00 d0 bf ee       	push   $0xeebfd000
+f0104188:	50                   	push   %eax
+f0104189:	ff 76 60             	push   0x60(%esi)
+f010418c:	e8 b9 d8 ff ff       	call   f0101a4a <page_insert>
+f0104191:	83 c4 10             	add    $0x10,%esp
+f0104194:	83 f8 fc             	cmp    $0xfffffffc,%eax
+f0104197:	74 39                	je     f01041d2 <env_create+0xfb>
+  e->env_tf.tf_eip = bin->e_entry;
+f0104199:	8b 43 18             	mov    0x18(%ebx),%eax
+f010419c:	89 46 30             	mov    %eax,0x30(%esi)
+  e->env_tf.tf_eflags = bin->e_flags;
+f010419f:	8b 43 24             	mov    0x24(%ebx),%eax
+f01041a2:	89 46 38             	mov    %eax,0x38(%esi)
+f01041a5:	0f 31                	rdtsc
+
+  uint64_t start = read_tsc();
+  load_icode(e, binary);
+  e->env_load_cycles = read_tsc() - start;
+f01041a7:	2b 45 d0             	sub    -0x30(%ebp),%eax
+f01041aa:	1b 55 d4             	sbb    -0x2c(%ebp),%edx
+f01041ad:	89 46 68             	mov    %eax,0x68(%esi)
+f01041b0:	89 56 6c             	mov    %edx,0x6c(%esi)
+}
+f01041b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01041b6:	5b                   	pop    %ebx
+f01041b7:	5e                   	pop    %esi
+f01041b8:	5f                   	pop    %edi
+f01041b9:	5d                   	pop    %ebp
+f01041ba:	c3                   	ret
+    if (!pp) panic("Out of Memory");
+f01041bb:	83 ec 04             	sub    $0x4,%esp
+f01041be:	68 0a d2 10 f0       	push   $0xf010d20a
+f01041c3:	68 4e 01 00 00       	push   $0x14e
+f01041c8:	68 d8 d1 10 f0       	push   $0xf010d1d8
+f01041cd:	e8 71 be ff ff       	call   f0100043 <_panic>
+      panic("Insert fails: out of memory");
+f01041d2:	83 ec 04             	sub    $0x4,%esp
+f01041d5:	68 18 d2 10 f0       	push   $0xf010d218
+f01041da:	68 50 01 00 00       	push   $0x150
+f01041df:	68 d8 d1 10 f0       	push   $0xf010d1d8
+f01041e4:	e8 5a be ff ff       	call   f0100043 <_panic>
+
+f01041e9 <env_load_elf>:
+//	-E_FAULT if the image is not readable by the current env.
+//	-E_NO_MEM on memory exhaustion.
+//
+int
+env_load_elf(struct Env *e, const uint8_t *binary, size_t size)
+{
+f01041e9:	55                   	push   %ebp
+f01041ea:	89 e5                	mov    %esp,%ebp
+f01041ec:	57                   	push   %edi
+f01041ed:	56                   	push   %esi
+f01041ee:	53                   	push   %ebx
+f01041ef:	83 ec 7c             	sub    $0x7c,%esp
+	struct Elf elf;
+	struct Proghdr ph;
+	uint32_t off;
+	int i, r;
+
+	if (size < sizeof(elf))
+f01041f2:	83 7d 10 33          	cmpl   $0x33,0x10(%ebp)
+f01041f6:	0f 86 ff 01 00 00    	jbe    f01043fb <env_load_elf+0x212>
+		return -E_NOT_EXEC;
+	if ((r = copyin(&elf, binary, sizeof(elf))) < 0)
+f01041fc:	83 ec 04             	sub    $0x4,%esp
+f01041ff:	6a 34                	push   $0x34
+f0104201:	ff 75 0c             	push   0xc(%ebp)
+f0104204:	8d 45 b4             	lea    -0x4c(%ebp),%eax
+f0104207:	50                   	push   %eax
+f0104208:	e8 01 1d 00 00       	call   f0105f0e <copyin>
+f010420d:	83 c4 10             	add    $0x10,%esp
+f0104210:	85 c0                	test   %eax,%eax
+f0104212:	0f 88 fb 00 00 00    	js     f0104313 <env_load_elf+0x12a>
+		return r;
+	if (elf.e_magic != ELF_MAGIC)
+f0104218:	81 7d b4 7f 45 4c 46 	cmpl   $0x464c457f,-0x4c(%ebp)
+f010421f:	0f 85 e0 01 00 00    	jne    f0104405 <env_load_elf+0x21c>
+		return -E_NOT_EXEC;
+
+	for (i = 0; i < elf.e_phnum; i++) {
+f0104225:	bf 00 00 00 00       	mov    $0x0,%edi
+f010422a:	89 7d 80             	mov    %edi,-0x80(%ebp)
+f010422d:	e9 2d 01 00 00       	jmp    f010435f <env_load_elf+0x176>
+	if ((pp = page_lookup(e->env_pgdir, (void *) va, NULL))
+f0104232:	89 df                	mov    %ebx,%edi
+f0104234:	83 ec 04             	sub    $0x4,%esp
+f0104237:	6a 00                	push   $0x0
+f0104239:	53                   	push   %ebx
+f010423a:	8b 45 08             	mov    0x8(%ebp),%eax
+f010423d:	ff 70 60             	push   0x60(%eax)
+f0104240:	e8 45 d6 ff ff       	call   f010188a <page_lookup>
+f0104245:	89 c6                	mov    %eax,%esi
+f0104247:	83 c4 10             	add    $0x10,%esp
+f010424a:	85 c0                	test   %eax,%eax
+f010424c:	0f 84 c9 00 00 00    	je     f010431b <env_load_elf+0x132>
+	    && pp != zero_page)
+f0104252:	3b 05 64 47 79 f0    	cmp    0xf0794764,%eax
+f0104258:	0f 84 bd 00 00 00    	je     f010431b <env_load_elf+0x132>
+		start = MAX(va, ph->p_va);
+f010425e:	8b 7d 9c             	mov    -0x64(%ebp),%edi
+f0104261:	39 fb                	cmp    %edi,%ebx
+f0104263:	89 f9                	mov    %edi,%ecx
+f0104265:	0f 43 cb             	cmovae %ebx,%ecx
+		end = MIN(va + PGSIZE, data_end);
+f0104268:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+f010426e:	8b 55 84             	mov    -0x7c(%ebp),%edx
+f0104271:	39 d0                	cmp    %edx,%eax
+f0104273:	0f 47 c2             	cmova  %edx,%eax
+		if ((r = copyin((char *) page2kva(pp) + PGOFF(start),
+f0104276:	29 c8                	sub    %ecx,%eax
+				data + (start - ph->p_va), end - start)) < 0)
+f0104278:	8b 95 7c ff ff ff    	mov    -0x84(%ebp),%edx
+f010427e:	29 fa                	sub    %edi,%edx
+f0104280:	01 ca                	add    %ecx,%edx
+f0104282:	03 55 0c             	add    0xc(%ebp),%edx
+	return (pp - pages) << PGSHIFT;
+f0104285:	2b 35 68 47 79 f0    	sub    0xf0794768,%esi
+f010428b:	c1 fe 03             	sar    $0x3,%esi
+f010428e:	89 f7                	mov    %esi,%edi
+f0104290:	c1 e7 0c             	shl    $0xc,%edi
+	if (PGNUM(pa) >= npages)
+f0104293:	81 e6 ff ff 0f 00    	and    $0xfffff,%esi
+f0104299:	3b 35 74 47 79 f0    	cmp    0xf0794774,%esi
+f010429f:	0f 83 9c 01 00 00    	jae    f0104441 <env_load_elf+0x258>
+		if ((r = copyin((char *) page2kva(pp) + PGOFF(start),
+f01042a5:	83 ec 04             	sub    $0x4,%esp
+f01042a8:	50                   	push   %eax
+f01042a9:	52                   	push   %edx
+f01042aa:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+f01042b0:	8d 84 0f 00 00 00 f0 	lea    -0x10000000(%edi,%ecx,1),%eax
+f01042b7:	50                   	push   %eax
+f01042b8:	e8 51 1c 00 00       	call   f0105f0e <copyin>
+f01042bd:	83 c4 10             	add    $0x10,%esp
+f01042c0:	85 c0                	test   %eax,%eax
+f01042c2:	78 4f                	js     f0104313 <env_load_elf+0x12a>
+	     va += PGSIZE) {
+f01042c4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+	for (va = ROUNDDOWN(ph->p_va, PGSIZE); va < ph->p_va + ph->p_memsz;
+f01042ca:	8b 45 a8             	mov    -0x58(%ebp),%eax
+f01042cd:	03 45 9c             	add    -0x64(%ebp),%eax
+f01042d0:	39 c3                	cmp    %eax,%ebx
+f01042d2:	0f 83 83 00 00 00    	jae    f010435b <env_load_elf+0x172>
+		if (va >= data_end) {
+f01042d8:	8b 45 84             	mov    -0x7c(%ebp),%eax
+f01042db:	39 c3                	cmp    %eax,%ebx
+f01042dd:	0f 82 4f ff ff ff    	jb     f0104232 <env_load_elf+0x49>
+			if (page_lookup(e->env_pgdir, (void *) va, NULL))
+f01042e3:	83 ec 04             	sub    $0x4,%esp
+f01042e6:	6a 00                	push   $0x0
+f01042e8:	53                   	push   %ebx
+f01042e9:	8b 45 08             	mov    0x8(%ebp),%eax
+f01042ec:	ff 70 60             	push   0x60(%eax)
+f01042ef:	e8 96 d5 ff ff       	call   f010188a <page_lookup>
+f01042f4:	83 c4 10             	add    $0x10,%esp
+f01042f7:	85 c0                	test   %eax,%eax
+f01042f9:	75 c9                	jne    f01042c4 <env_load_elf+0xdb>
+			if ((r = page_map_zero(e->env_pgdir, (void *) va,
+f01042fb:	83 ec 04             	sub    $0x4,%esp
+f01042fe:	6a 07                	push   $0x7
+f0104300:	53                   	push   %ebx
+f0104301:	8b 45 08             	mov    0x8(%ebp),%eax
+f0104304:	ff 70 60             	push   0x60(%eax)
+f0104307:	e8 f3 d7 ff ff       	call   f0101aff <page_map_zero>
+f010430c:	83 c4 10             	add    $0x10,%esp
+f010430f:	85 c0                	test   %eax,%eax
+f0104311:	79 b1                	jns    f01042c4 <env_load_elf+0xdb>
+		if ((r = segment_load(e, &ph, binary + ph.p_offset)) < 0)
+			return r;
+	}
+	e->env_tf.tf_eip = elf.e_entry;
+	return 0;
+}
+f0104313:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0104316:	5b                   	pop    %ebx
+f0104317:	5e                   	pop    %esi
+f0104318:	5f                   	pop    %edi
+f0104319:	5d                   	pop    %ebp
+f010431a:	c3                   	ret
+	if (!(pp = page_alloc(ALLOC_ZERO)))
+f010431b:	83 ec 0c             	sub    $0xc,%esp
+f010431e:	6a 01                	push   $0x1
+f0104320:	e8 c0 ce ff ff       	call   f01011e5 <page_alloc>
+f0104325:	89 c6                	mov    %eax,%esi
+f0104327:	83 c4 10             	add    $0x10,%esp
+f010432a:	85 c0                	test   %eax,%eax
+f010432c:	74 26                	je     f0104354 <env_load_elf+0x16b>
+	if (page_insert(e->env_pgdir, pp, (void *) va,
+f010432e:	6a 07                	push   $0x7
+f0104330:	57                   	push   %edi
+f0104331:	50                   	push   %eax
+f0104332:	8b 45 08             	mov    0x8(%ebp),%eax
+f0104335:	ff 70 60             	push   0x60(%eax)
+f0104338:	e8 0d d7 ff ff       	call   f0101a4a <page_insert>
+f010433d:	83 c4 10             	add    $0x10,%esp
+f0104340:	85 c0                	test   %eax,%eax
+f0104342:	0f 89 16 ff ff ff    	jns    f010425e <env_load_elf+0x75>
+		page_free(pp);
+f0104348:	83 ec 0c             	sub    $0xc,%esp
+f010434b:	56                   	push   %esi
+f010434c:	e8 1f cf ff ff       	call   f0101270 <page_free>
+		return NULL;
+f0104351:	83 c4 10             	add    $0x10,%esp
+			return -E_NO_MEM;
+f0104354:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0104359:	eb b8                	jmp    f0104313 <env_load_elf+0x12a>
+	for (i = 0; i < elf.e_phnum; i++) {
+f010435b:	83 45 80 01          	addl   $0x1,-0x80(%ebp)
+f010435f:	0f b7 45 e0          	movzwl -0x20(%ebp),%eax
+f0104363:	8b 4d 80             	mov    -0x80(%ebp),%ecx
+f0104366:	39 c8                	cmp    %ecx,%eax
+f0104368:	7e 7e                	jle    f01043e8 <env_load_elf+0x1ff>
+		off = elf.e_phoff + i * sizeof(ph);
+f010436a:	8b 45 80             	mov    -0x80(%ebp),%eax
+f010436d:	c1 e0 05             	shl    $0x5,%eax
+		if (off < elf.e_phoff || off + sizeof(ph) > size)
+f0104370:	03 45 d0             	add    -0x30(%ebp),%eax
+f0104373:	0f 82 96 00 00 00    	jb     f010440f <env_load_elf+0x226>
+f0104379:	8d 50 20             	lea    0x20(%eax),%edx
+f010437c:	39 55 10             	cmp    %edx,0x10(%ebp)
+f010437f:	0f 82 94 00 00 00    	jb     f0104419 <env_load_elf+0x230>
+		if ((r = copyin(&ph, binary + off, sizeof(ph))) < 0)
+f0104385:	83 ec 04             	sub    $0x4,%esp
+f0104388:	6a 20                	push   $0x20
+f010438a:	03 45 0c             	add    0xc(%ebp),%eax
+f010438d:	50                   	push   %eax
+f010438e:	8d 45 94             	lea    -0x6c(%ebp),%eax
+f0104391:	50                   	push   %eax
+f0104392:	e8 77 1b 00 00       	call   f0105f0e <copyin>
+f0104397:	83 c4 10             	add    $0x10,%esp
+f010439a:	85 c0                	test   %eax,%eax
+f010439c:	0f 88 71 ff ff ff    	js     f0104313 <env_load_elf+0x12a>
+		if (ph.p_type != ELF_PROG_LOAD)
+f01043a2:	83 7d 94 01          	cmpl   $0x1,-0x6c(%ebp)
+f01043a6:	75 b3                	jne    f010435b <env_load_elf+0x172>
+		if (ph.p_filesz > ph.p_memsz
+f01043a8:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f01043ab:	8b 55 a8             	mov    -0x58(%ebp),%edx
+f01043ae:	39 c2                	cmp    %eax,%edx
+f01043b0:	72 71                	jb     f0104423 <env_load_elf+0x23a>
+		    || ph.p_va + ph.p_memsz < ph.p_va
+f01043b2:	8b 5d 9c             	mov    -0x64(%ebp),%ebx
+f01043b5:	01 da                	add    %ebx,%edx
+		    || ph.p_va + ph.p_memsz > UTOP
+f01043b7:	81 fa 00 00 c0 ee    	cmp    $0xeec00000,%edx
+f01043bd:	77 6e                	ja     f010442d <env_load_elf+0x244>
+f01043bf:	39 da                	cmp    %ebx,%edx
+f01043c1:	72 6a                	jb     f010442d <env_load_elf+0x244>
+		    || ph.p_offset + ph.p_filesz < ph.p_offset
+f01043c3:	8b 4d 98             	mov    -0x68(%ebp),%ecx
+f01043c6:	89 8d 7c ff ff ff    	mov    %ecx,-0x84(%ebp)
+		    || ph.p_offset + ph.p_filesz > size)
+f01043cc:	89 ca                	mov    %ecx,%edx
+f01043ce:	01 c2                	add    %eax,%edx
+f01043d0:	72 65                	jb     f0104437 <env_load_elf+0x24e>
+f01043d2:	39 55 10             	cmp    %edx,0x10(%ebp)
+f01043d5:	72 60                	jb     f0104437 <env_load_elf+0x24e>
+	uintptr_t data_end = ph->p_va + ph->p_filesz;
+f01043d7:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+	for (va = ROUNDDOWN(ph->p_va, PGSIZE); va < ph->p_va + ph->p_memsz;
+f01043da:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+f01043e0:	89 7d 84             	mov    %edi,-0x7c(%ebp)
+f01043e3:	e9 e2 fe ff ff       	jmp    f01042ca <env_load_elf+0xe1>
+	e->env_tf.tf_eip = elf.e_entry;
+f01043e8:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f01043eb:	8b 7d 08             	mov    0x8(%ebp),%edi
+f01043ee:	89 47 30             	mov    %eax,0x30(%edi)
+	return 0;
+f01043f1:	b8 00 00 00 00       	mov    $0x0,%eax
+f01043f6:	e9 18 ff ff ff       	jmp    f0104313 <env_load_elf+0x12a>
+		return -E_NOT_EXEC;
+f01043fb:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+f0104400:	e9 0e ff ff ff       	jmp    f0104313 <env_load_elf+0x12a>
+		return -E_NOT_EXEC;
+f0104405:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+f010440a:	e9 04 ff ff ff       	jmp    f0104313 <env_load_elf+0x12a>
+			return -E_NOT_EXEC;
+f010440f:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+f0104414:	e9 fa fe ff ff       	jmp    f0104313 <env_load_elf+0x12a>
+f0104419:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+f010441e:	e9 f0 fe ff ff       	jmp    f0104313 <env_load_elf+0x12a>
+			return -E_NOT_EXEC;
+f0104423:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+f0104428:	e9 e6 fe ff ff       	jmp    f0104313 <env_load_elf+0x12a>
+f010442d:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+f0104432:	e9 dc fe ff ff       	jmp    f0104313 <env_load_elf+0x12a>
+f0104437:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+f010443c:	e9 d2 fe ff ff       	jmp    f0104313 <env_load_elf+0x12a>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0104441:	57                   	push   %edi
+f0104442:	68 90 be 10 f0       	push   $0xf010be90
+f0104447:	68 a4 00 00 00       	push   $0xa4
+f010444c:	68 95 ce 10 f0       	push   $0xf010ce95
+f0104451:	e8 ed bb ff ff       	call   f0100043 <_panic>
+
+f0104456 <env_init_stack>:
+//	-E_INVAL if the arguments do not fit on the stack page.
+//	-E_NO_MEM on memory exhaustion.
+//
+int
+env_init_stack(struct Env *e, const char **argv)
+{
+f0104456:	55                   	push   %ebp
+f0104457:	89 e5                	mov    %esp,%ebp
+f0104459:	57                   	push   %edi
+f010445a:	56                   	push   %esi
+f010445b:	53                   	push   %ebx
+f010445c:	83 ec 48             	sub    $0x48,%esp
+	char *stack, *strs;
+	uintptr_t *offs, *uargv;
+	const char *arg;
+	int argc, len, r;
+
+	if (!(pp = page_alloc(ALLOC_ZERO)))
+f010445f:	6a 01                	push   $0x1
+f0104461:	e8 7f cd ff ff       	call   f01011e5 <page_alloc>
+f0104466:	83 c4 10             	add    $0x10,%esp
+f0104469:	85 c0                	test   %eax,%eax
+f010446b:	0f 84 a7 01 00 00    	je     f0104618 <env_init_stack+0x1c2>
+f0104471:	89 c6                	mov    %eax,%esi
+		return -E_NO_MEM;
+	if ((r = page_insert(e->env_pgdir, pp, (void *) (USTACKTOP - PGSIZE),
+f0104473:	6a 07                	push   $0x7
+f0104475:	68 00 d0 bf ee       	push   $0xeebfd000
+f010447a:	50                   	push   %eax
+f010447b:	8b 45 08             	mov    0x8(%ebp),%eax
+f010447e:	ff 70 60             	push   0x60(%eax)
+f0104481:	e8 c4 d5 ff ff       	call   f0101a4a <page_insert>
+f0104486:	89 c3                	mov    %eax,%ebx
+f0104488:	83 c4 10             	add    $0x10,%esp
+f010448b:	85 c0                	test   %eax,%eax
+f010448d:	78 38                	js     f01044c7 <env_init_stack+0x71>
+	return (pp - pages) << PGSHIFT;
+f010448f:	2b 35 68 47 79 f0    	sub    0xf0794768,%esi
+f0104495:	c1 fe 03             	sar    $0x3,%esi
+f0104498:	89 f0                	mov    %esi,%eax
+f010449a:	c1 e0 0c             	shl    $0xc,%eax
+	if (PGNUM(pa) >= npages)
+f010449d:	81 e6 ff ff 0f 00    	and    $0xfffff,%esi
+f01044a3:	3b 35 74 47 79 f0    	cmp    0xf0794774,%esi
+f01044a9:	73 2d                	jae    f01044d8 <env_init_stack+0x82>
+	return (void *)(pa + KERNBASE);
+f01044ab:	8d 88 00 00 00 f0    	lea    -0x10000000(%eax),%ecx
+f01044b1:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+	}
+
+	// Copy the strings down from the top of the page, recording
+	// their offsets from the bottom of the page up.
+	stack = page2kva(pp);
+	strs = stack + PGSIZE;
+f01044b4:	8d b8 00 10 00 f0    	lea    -0xffff000(%eax),%edi
+	offs = (uintptr_t *) stack;
+	for (argc = 0; argv; argc++) {
+f01044ba:	8d b0 04 00 00 f0    	lea    -0xffffffc(%eax),%esi
+f01044c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01044c5:	eb 4c                	jmp    f0104513 <env_init_stack+0xbd>
+		page_free(pp);
+f01044c7:	83 ec 0c             	sub    $0xc,%esp
+f01044ca:	56                   	push   %esi
+f01044cb:	e8 a0 cd ff ff       	call   f0101270 <page_free>
+		return r;
+f01044d0:	83 c4 10             	add    $0x10,%esp
+f01044d3:	e9 36 01 00 00       	jmp    f010460e <env_init_stack+0x1b8>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01044d8:	50                   	push   %eax
+f01044d9:	68 90 be 10 f0       	push   $0xf010be90
+f01044de:	68 a4 00 00 00       	push   $0xa4
+f01044e3:	68 95 ce 10 f0       	push   $0xf010ce95
+f01044e8:	e8 56 bb ff ff       	call   f0100043 <_panic>
+			return -E_INVAL;
+		len = copyinstr(stack + sizeof(offs[0]) * (argc + 1), arg,
+				strs - (char *) &offs[argc + 1]);
+		if (len < 0)
+			return len;
+		strs -= len + 1;
+f01044ed:	89 c2                	mov    %eax,%edx
+f01044ef:	f7 d2                	not    %edx
+f01044f1:	01 d7                	add    %edx,%edi
+		memmove(strs, stack + sizeof(offs[0]) * (argc + 1), len + 1);
+f01044f3:	83 ec 04             	sub    $0x4,%esp
+f01044f6:	83 c0 01             	add    $0x1,%eax
+f01044f9:	50                   	push   %eax
+f01044fa:	ff 75 d4             	push   -0x2c(%ebp)
+f01044fd:	57                   	push   %edi
+f01044fe:	e8 6d 40 00 00       	call   f0108570 <memmove>
+		offs[argc] = strs - stack;
+f0104503:	89 f8                	mov    %edi,%eax
+f0104505:	8b 55 cc             	mov    -0x34(%ebp),%edx
+f0104508:	29 d0                	sub    %edx,%eax
+f010450a:	89 46 fc             	mov    %eax,-0x4(%esi)
+f010450d:	83 c4 10             	add    $0x10,%esp
+f0104510:	8b 75 d0             	mov    -0x30(%ebp),%esi
+	for (argc = 0; argv; argc++) {
+f0104513:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+f0104517:	74 58                	je     f0104571 <env_init_stack+0x11b>
+		if ((r = copyin(&arg, &argv[argc], sizeof(arg))) < 0)
+f0104519:	83 ec 04             	sub    $0x4,%esp
+f010451c:	6a 04                	push   $0x4
+f010451e:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0104521:	8d 04 98             	lea    (%eax,%ebx,4),%eax
+f0104524:	50                   	push   %eax
+f0104525:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0104528:	50                   	push   %eax
+f0104529:	e8 e0 19 00 00       	call   f0105f0e <copyin>
+f010452e:	83 c4 10             	add    $0x10,%esp
+f0104531:	85 c0                	test   %eax,%eax
+f0104533:	0f 88 f4 00 00 00    	js     f010462d <env_init_stack+0x1d7>
+		if (!arg)
+f0104539:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010453c:	85 c0                	test   %eax,%eax
+f010453e:	74 31                	je     f0104571 <env_init_stack+0x11b>
+		if ((char *) &offs[argc + 1] >= strs)
+f0104540:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+f0104543:	39 fe                	cmp    %edi,%esi
+f0104545:	0f 83 d4 00 00 00    	jae    f010461f <env_init_stack+0x1c9>
+		len = copyinstr(stack + sizeof(offs[0]) * (argc + 1), arg,
+f010454b:	83 c3 01             	add    $0x1,%ebx
+f010454e:	83 ec 04             	sub    $0x4,%esp
+				strs - (char *) &offs[argc + 1]);
+f0104551:	89 fa                	mov    %edi,%edx
+f0104553:	29 f2                	sub    %esi,%edx
+		len = copyinstr(stack + sizeof(offs[0]) * (argc + 1), arg,
+f0104555:	52                   	push   %edx
+f0104556:	50                   	push   %eax
+f0104557:	56                   	push   %esi
+f0104558:	e8 f5 19 00 00       	call   f0105f52 <copyinstr>
+		if (len < 0)
+f010455d:	8d 4e 04             	lea    0x4(%esi),%ecx
+f0104560:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+f0104563:	83 c4 10             	add    $0x10,%esp
+f0104566:	85 c0                	test   %eax,%eax
+f0104568:	79 83                	jns    f01044ed <env_init_stack+0x97>
+f010456a:	89 c3                	mov    %eax,%ebx
+f010456c:	e9 9d 00 00 00       	jmp    f010460e <env_init_stack+0x1b8>
+	}
+
+	// Now move the offsets up under the strings as the argv array,
+	// turning them into user addresses, and push argc and argv.
+	uargv = (uintptr_t *) ROUNDDOWN((uintptr_t) strs, 4) - (argc + 1);
+f0104571:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+f0104574:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+f0104577:	8d 0c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%ecx
+f010457e:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+f0104581:	89 fb                	mov    %edi,%ebx
+f0104583:	83 e3 fc             	and    $0xfffffffc,%ebx
+f0104586:	83 eb 04             	sub    $0x4,%ebx
+f0104589:	29 cb                	sub    %ecx,%ebx
+f010458b:	89 de                	mov    %ebx,%esi
+	if ((char *) (uargv - 2) < stack)
+f010458d:	8d 7b f8             	lea    -0x8(%ebx),%edi
+f0104590:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+f0104593:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f0104596:	39 c7                	cmp    %eax,%edi
+f0104598:	0f 82 88 00 00 00    	jb     f0104626 <env_init_stack+0x1d0>
+		return -E_INVAL;
+	memmove(uargv, offs, argc * sizeof(offs[0]));
+f010459e:	83 ec 04             	sub    $0x4,%esp
+f01045a1:	51                   	push   %ecx
+f01045a2:	89 c7                	mov    %eax,%edi
+f01045a4:	50                   	push   %eax
+f01045a5:	53                   	push   %ebx
+f01045a6:	e8 c5 3f 00 00       	call   f0108570 <memmove>
+	memset(stack, 0, (char *) uargv - stack);
+f01045ab:	89 d9                	mov    %ebx,%ecx
+f01045ad:	29 f9                	sub    %edi,%ecx
+f01045af:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+f01045b2:	83 c4 0c             	add    $0xc,%esp
+f01045b5:	51                   	push   %ecx
+f01045b6:	6a 00                	push   $0x0
+f01045b8:	57                   	push   %edi
+f01045b9:	e8 7d 3f 00 00       	call   f010853b <memset>
+	for (r = 0; r < argc; r++)
+f01045be:	83 c4 10             	add    $0x10,%esp
+f01045c1:	b8 00 00 00 00       	mov    $0x0,%eax
+f01045c6:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+f01045c9:	eb 0c                	jmp    f01045d7 <env_init_stack+0x181>
+		uargv[r] += USTACKTOP - PGSIZE;
+f01045cb:	81 2b 00 30 40 11    	subl   $0x11403000,(%ebx)
+	for (r = 0; r < argc; r++)
+f01045d1:	83 c0 01             	add    $0x1,%eax
+f01045d4:	83 c3 04             	add    $0x4,%ebx
+f01045d7:	39 c2                	cmp    %eax,%edx
+f01045d9:	7f f0                	jg     f01045cb <env_init_stack+0x175>
+	uargv[argc] = 0;
+f01045db:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f01045de:	c7 04 06 00 00 00 00 	movl   $0x0,(%esi,%eax,1)
+	uargv[-1] = USTACKTOP - PGSIZE + ((char *) uargv - stack);
+f01045e5:	8b 45 c0             	mov    -0x40(%ebp),%eax
+f01045e8:	2d 00 30 40 11       	sub    $0x11403000,%eax
+f01045ed:	89 46 fc             	mov    %eax,-0x4(%esi)
+	uargv[-2] = argc;
+f01045f0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f01045f3:	89 46 f8             	mov    %eax,-0x8(%esi)
+	e->env_tf.tf_esp = USTACKTOP - PGSIZE + ((char *) (uargv - 2) - stack);
+f01045f6:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f01045f9:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+f01045fc:	29 c8                	sub    %ecx,%eax
+f01045fe:	2d 00 30 40 11       	sub    $0x11403000,%eax
+f0104603:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0104606:	89 41 3c             	mov    %eax,0x3c(%ecx)
+	return 0;
+f0104609:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+f010460e:	89 d8                	mov    %ebx,%eax
+f0104610:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0104613:	5b                   	pop    %ebx
+f0104614:	5e                   	pop    %esi
+f0104615:	5f                   	pop    %edi
+f0104616:	5d                   	pop    %ebp
+f0104617:	c3                   	ret
+		return -E_NO_MEM;
+f0104618:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+f010461d:	eb ef                	jmp    f010460e <env_init_stack+0x1b8>
+			return -E_INVAL;
+f010461f:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0104624:	eb e8                	jmp    f010460e <env_init_stack+0x1b8>
+		return -E_INVAL;
+f0104626:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f010462b:	eb e1                	jmp    f010460e <env_init_stack+0x1b8>
+f010462d:	89 c3                	mov    %eax,%ebx
+f010462f:	eb dd                	jmp    f010460e <env_init_stack+0x1b8>
+
+f0104631 <env_stack_grow>:
+// Returns 0 if a page was mapped, -E_INVAL if 'va' is not a stack page
+// still to be grown into, -E_NO_MEM if out of memory.
+//
+int
+env_stack_grow(struct Env *e, uintptr_t va)
+{
+f0104631:	55                   	push   %ebp
+f0104632:	89 e5                	mov    %esp,%ebp
+f0104634:	57                   	push   %edi
+f0104635:	56                   	push   %esi
+f0104636:	53                   	push   %ebx
+f0104637:	83 ec 0c             	sub    $0xc,%esp
+f010463a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f010463d:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct PageInfo *pp;
+	int r;
+
+	if (va >= USTACKTOP || va < USTACKTOP - e->env_stack_limit)
+f0104640:	3d ff df bf ee       	cmp    $0xeebfdfff,%eax
+f0104645:	77 68                	ja     f01046af <env_stack_grow+0x7e>
+f0104647:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+f010464c:	2b 53 70             	sub    0x70(%ebx),%edx
+f010464f:	39 d0                	cmp    %edx,%eax
+f0104651:	72 63                	jb     f01046b6 <env_stack_grow+0x85>
+		return -E_INVAL;
+	va = ROUNDDOWN(va, PGSIZE);
+f0104653:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0104658:	89 c7                	mov    %eax,%edi
+	if (page_lookup(e->env_pgdir, (void *) va, NULL))
+f010465a:	83 ec 04             	sub    $0x4,%esp
+f010465d:	6a 00                	push   $0x0
+f010465f:	50                   	push   %eax
+f0104660:	ff 73 60             	push   0x60(%ebx)
+f0104663:	e8 22 d2 ff ff       	call   f010188a <page_lookup>
+f0104668:	83 c4 10             	add    $0x10,%esp
+f010466b:	85 c0                	test   %eax,%eax
+f010466d:	75 4e                	jne    f01046bd <env_stack_grow+0x8c>
+		return -E_INVAL;
+	if (!(pp = page_alloc(ALLOC_ZERO)))
+f010466f:	83 ec 0c             	sub    $0xc,%esp
+f0104672:	6a 01                	push   $0x1
+f0104674:	e8 6c cb ff ff       	call   f01011e5 <page_alloc>
+f0104679:	89 c6                	mov    %eax,%esi
+f010467b:	83 c4 10             	add    $0x10,%esp
+f010467e:	85 c0                	test   %eax,%eax
+f0104680:	74 42                	je     f01046c4 <env_stack_grow+0x93>
+		return -E_NO_MEM;
+	if ((r = page_insert(e->env_pgdir, pp, (void *) va,
+f0104682:	6a 07                	push   $0x7
+f0104684:	57                   	push   %edi
+f0104685:	50                   	push   %eax
+f0104686:	ff 73 60             	push   0x60(%ebx)
+f0104689:	e8 bc d3 ff ff       	call   f0101a4a <page_insert>
+f010468e:	89 c3                	mov    %eax,%ebx
+f0104690:	83 c4 10             	add    $0x10,%esp
+f0104693:	85 c0                	test   %eax,%eax
+f0104695:	78 0a                	js     f01046a1 <env_stack_grow+0x70>
+			     PTE_P | PTE_U | PTE_W)) < 0)
+		page_free(pp);
+	return r;
+}
+f0104697:	89 d8                	mov    %ebx,%eax
+f0104699:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010469c:	5b                   	pop    %ebx
+f010469d:	5e                   	pop    %esi
+f010469e:	5f                   	pop    %edi
+f010469f:	5d                   	pop    %ebp
+f01046a0:	c3                   	ret
+		page_free(pp);
+f01046a1:	83 ec 0c             	sub    $0xc,%esp
+f01046a4:	56                   	push   %esi
+f01046a5:	e8 c6 cb ff ff       	call   f0101270 <page_free>
+f01046aa:	83 c4 10             	add    $0x10,%esp
+f01046ad:	eb e8                	jmp    f0104697 <env_stack_grow+0x66>
+		return -E_INVAL;
+f01046af:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f01046b4:	eb e1                	jmp    f0104697 <env_stack_grow+0x66>
+f01046b6:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f01046bb:	eb da                	jmp    f0104697 <env_stack_grow+0x66>
+		return -E_INVAL;
+f01046bd:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f01046c2:	eb d3                	jmp    f0104697 <env_stack_grow+0x66>
+		return -E_NO_MEM;
+f01046c4:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+f01046c9:	eb cc                	jmp    f0104697 <env_stack_grow+0x66>
+
+f01046cb <env_stack_guard>:
+//
+// Is 'va' in the guard page below env e's stack?
+//
+bool
+env_stack_guard(struct Env *e, uintptr_t va)
+{
+f01046cb:	55                   	push   %ebp
+f01046cc:	89 e5                	mov    %esp,%ebp
+f01046ce:	53                   	push   %ebx
+f01046cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	uintptr_t guard = USTACKTOP - e->env_stack_limit - PGSIZE;
+f01046d2:	8b 45 08             	mov    0x8(%ebp),%eax
+f01046d5:	8b 58 70             	mov    0x70(%eax),%ebx
+f01046d8:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+f01046dd:	29 da                	sub    %ebx,%edx
+
+	return va >= guard && va < guard + PGSIZE;
+f01046df:	b8 00 00 00 00       	mov    $0x0,%eax
+f01046e4:	39 d1                	cmp    %edx,%ecx
+f01046e6:	72 0f                	jb     f01046f7 <env_stack_guard+0x2c>
+f01046e8:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+f01046ed:	29 d8                	sub    %ebx,%eax
+f01046ef:	39 c1                	cmp    %eax,%ecx
+f01046f1:	0f 92 c0             	setb   %al
+f01046f4:	0f b6 c0             	movzbl %al,%eax
+f01046f7:	83 e0 01             	and    $0x1,%eax
+}
+f01046fa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01046fd:	c9                   	leave
+f01046fe:	c3                   	ret
+
+f01046ff <env_free>:
+//
+// Frees env e and all memory it uses.
+//
+void
+env_free(struct Env *e)
+{
+f01046ff:	55                   	push   %ebp
+f0104700:	89 e5                	mov    %esp,%ebp
+f0104702:	57                   	push   %edi
+f0104703:	56                   	push   %esi
+f0104704:	53                   	push   %ebx
+f0104705:	83 ec 1c             	sub    $0x1c,%esp
+	physaddr_t pa;
+
+	// If freeing the current environment, switch to kern_pgdir
+	// before freeing the page directory, just in case the page
+	// gets reused.
+	if (e == curenv)
+f0104708:	e8 2a 45 00 00       	call   f0108c37 <cpunum>
+f010470d:	6b c0 78             	imul   $0x78,%eax,%eax
+f0104710:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0104713:	39 88 28 60 7d f0    	cmp    %ecx,-0xf829fd8(%eax)
+f0104719:	74 6c                	je     f0104787 <env_free+0x88>
+		lcr3(PADDR(kern_pgdir));
+
+	// Note the environment's demise.
+	cprintf("[%08x] free env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
+f010471b:	8b 45 08             	mov    0x8(%ebp),%eax
+f010471e:	8b 58 48             	mov    0x48(%eax),%ebx
+f0104721:	e8 11 45 00 00       	call   f0108c37 <cpunum>
+f0104726:	6b c0 78             	imul   $0x78,%eax,%eax
+f0104729:	ba 00 00 00 00       	mov    $0x0,%edx
+f010472e:	83 b8 28 60 7d f0 00 	cmpl   $0x0,-0xf829fd8(%eax)
+f0104735:	74 11                	je     f0104748 <env_free+0x49>
+f0104737:	e8 fb 44 00 00       	call   f0108c37 <cpunum>
+f010473c:	6b c0 78             	imul   $0x78,%eax,%eax
+f010473f:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0104745:	8b 50 48             	mov    0x48(%eax),%edx
+f0104748:	83 ec 04             	sub    $0x4,%esp
+f010474b:	53                   	push   %ebx
+f010474c:	52                   	push   %edx
+f010474d:	68 34 d2 10 f0       	push   $0xf010d234
+f0104752:	e8 5e 04 00 00       	call   f0104bb5 <cprintf>
+
+	// Leave any IPC queue, and fail the sends waiting on us.
+	ipc_env_free(e);
+f0104757:	83 c4 04             	add    $0x4,%esp
+f010475a:	ff 75 08             	push   0x8(%ebp)
+f010475d:	e8 c8 65 00 00       	call   f010ad2a <ipc_env_free>
+	futex_env_free(e);
+f0104762:	83 c4 04             	add    $0x4,%esp
+f0104765:	ff 75 08             	push   0x8(%ebp)
+f0104768:	e8 c9 6a 00 00       	call   f010b236 <futex_env_free>
+	ep_env_free(e);
+f010476d:	83 c4 04             	add    $0x4,%esp
+f0104770:	ff 75 08             	push   0x8(%ebp)
+f0104773:	e8 7d 70 00 00       	call   f010b7f5 <ep_env_free>
+f0104778:	83 c4 10             	add    $0x10,%esp
+f010477b:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+f0104782:	e9 ea 00 00 00       	jmp    f0104871 <env_free+0x172>
+		lcr3(PADDR(kern_pgdir));
+f0104787:	a1 6c 47 79 f0       	mov    0xf079476c,%eax
+	if ((uint32_t)kva < KERNBASE)
+f010478c:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0104791:	76 0d                	jbe    f01047a0 <env_free+0xa1>
+	return (physaddr_t)kva - KERNBASE;
+f0104793:	05 00 00 00 10       	add    $0x10000000,%eax
+	asm volatile("movl %0,%%cr3" : : "r" (val));
+f0104798:	0f 22 d8             	mov    %eax,%cr3
+}
+f010479b:	e9 7b ff ff ff       	jmp    f010471b <env_free+0x1c>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01047a0:	50                   	push   %eax
+f01047a1:	68 24 be 10 f0       	push   $0xf010be24
+f01047a6:	68 9b 02 00 00       	push   $0x29b
+f01047ab:	68 d8 d1 10 f0       	push   $0xf010d1d8
+f01047b0:	e8 8e b8 ff ff       	call   f0100043 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01047b5:	56                   	push   %esi
+f01047b6:	68 90 be 10 f0       	push   $0xf010be90
+f01047bb:	68 af 02 00 00       	push   $0x2af
+f01047c0:	68 d8 d1 10 f0       	push   $0xf010d1d8
+f01047c5:	e8 79 b8 ff ff       	call   f0100043 <_panic>
+		pt = (pte_t*) KADDR(pa);
+
+		// a page table still shared with another env after fork
+		// keeps its mappings for that env
+		if ((e->env_pgdir[pdeno] & PTE_COW) && pa2page(pa)->pp_ref > 1) {
+			e->env_pgdir[pdeno] = 0;
+f01047ca:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	if (PGNUM(pa) >= npages)
+f01047d0:	3b 05 74 47 79 f0    	cmp    0xf0794774,%eax
+f01047d6:	73 14                	jae    f01047ec <env_free+0xed>
+			page_decref(pa2page(pa));
+f01047d8:	83 ec 0c             	sub    $0xc,%esp
+	return &pages[PGNUM(pa)];
+f01047db:	03 0d 68 47 79 f0    	add    0xf0794768,%ecx
+f01047e1:	51                   	push   %ecx
+f01047e2:	e8 d5 ca ff ff       	call   f01012bc <page_decref>
+			continue;
+f01047e7:	83 c4 10             	add    $0x10,%esp
+f01047ea:	eb 77                	jmp    f0104863 <env_free+0x164>
+		panic("pa2page called with invalid pa");
+f01047ec:	83 ec 04             	sub    $0x4,%esp
+f01047ef:	68 68 c6 10 f0       	push   $0xf010c668
+f01047f4:	68 9d 00 00 00       	push   $0x9d
+f01047f9:	68 95 ce 10 f0       	push   $0xf010ce95
+f01047fe:	e8 40 b8 ff ff       	call   f0100043 <_panic>
+		}
+
+		// unmap all PTEs in this page table
+		for (pteno = 0; pteno <= PTX(~0); pteno++) {
+f0104803:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0104809:	83 c6 04             	add    $0x4,%esi
+f010480c:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+f0104812:	74 1b                	je     f010482f <env_free+0x130>
+			if (pt[pteno] & PTE_P)
+f0104814:	f6 06 01             	testb  $0x1,(%esi)
+f0104817:	74 ea                	je     f0104803 <env_free+0x104>
+				page_remove(e->env_pgdir, PGADDR(pdeno, pteno, 0));
+f0104819:	83 ec 08             	sub    $0x8,%esp
+f010481c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010481f:	09 d8                	or     %ebx,%eax
+f0104821:	50                   	push   %eax
+f0104822:	ff 77 60             	push   0x60(%edi)
+f0104825:	e8 9d d1 ff ff       	call   f01019c7 <page_remove>
+f010482a:	83 c4 10             	add    $0x10,%esp
+f010482d:	eb d4                	jmp    f0104803 <env_free+0x104>
+		}
+
+		// free the page table itself
+		e->env_pgdir[pdeno] = 0;
+f010482f:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0104832:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0104835:	8b 51 60             	mov    0x60(%ecx),%edx
+f0104838:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f010483b:	c7 04 0a 00 00 00 00 	movl   $0x0,(%edx,%ecx,1)
+	if (PGNUM(pa) >= npages)
+f0104842:	3b 05 74 47 79 f0    	cmp    0xf0794774,%eax
+f0104848:	0f 83 89 00 00 00    	jae    f01048d7 <env_free+0x1d8>
+		page_decref(pa2page(pa));
+f010484e:	83 ec 0c             	sub    $0xc,%esp
+	return &pages[PGNUM(pa)];
+f0104851:	8b 15 68 47 79 f0    	mov    0xf0794768,%edx
+f0104857:	8d 04 c2             	lea    (%edx,%eax,8),%eax
+f010485a:	50                   	push   %eax
+f010485b:	e8 5c ca ff ff       	call   f01012bc <page_decref>
+f0104860:	83 c4 10             	add    $0x10,%esp
+	for (pdeno = 0; pdeno < PDX(UTOP); pdeno++) {
+f0104863:	83 45 e0 04          	addl   $0x4,-0x20(%ebp)
+f0104867:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f010486a:	3d ec 0e 00 00       	cmp    $0xeec,%eax
+f010486f:	74 7d                	je     f01048ee <env_free+0x1ef>
+		if (!(e->env_pgdir[pdeno] & PTE_P))
+f0104871:	8b 45 08             	mov    0x8(%ebp),%eax
+f0104874:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0104877:	03 50 60             	add    0x60(%eax),%edx
+f010487a:	8b 0a                	mov    (%edx),%ecx
+f010487c:	f6 c1 01             	test   $0x1,%cl
+f010487f:	74 e2                	je     f0104863 <env_free+0x164>
+		pa = PTE_ADDR(e->env_pgdir[pdeno]);
+f0104881:	89 ce                	mov    %ecx,%esi
+f0104883:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (PGNUM(pa) >= npages)
+f0104889:	89 c8                	mov    %ecx,%eax
+f010488b:	c1 e8 0c             	shr    $0xc,%eax
+f010488e:	3b 05 74 47 79 f0    	cmp    0xf0794774,%eax
+f0104894:	0f 83 1b ff ff ff    	jae    f01047b5 <env_free+0xb6>
+		if ((e->env_pgdir[pdeno] & PTE_COW) && pa2page(pa)->pp_ref > 1) {
+f010489a:	f6 c5 08             	test   $0x8,%ch
+f010489d:	74 19                	je     f01048b8 <env_free+0x1b9>
+	return &pages[PGNUM(pa)];
+f010489f:	8d 0c c5 00 00 00 00 	lea    0x0(,%eax,8),%ecx
+f01048a6:	8b 1d 68 47 79 f0    	mov    0xf0794768,%ebx
+f01048ac:	66 83 7c c3 04 01    	cmpw   $0x1,0x4(%ebx,%eax,8)
+f01048b2:	0f 87 12 ff ff ff    	ja     f01047ca <env_free+0xcb>
+	return (void *)(pa + KERNBASE);
+f01048b8:	81 ee 00 00 00 10    	sub    $0x10000000,%esi
+f01048be:	8b 7d e0             	mov    -0x20(%ebp),%edi
+f01048c1:	c1 e7 14             	shl    $0x14,%edi
+f01048c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01048c9:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+f01048cc:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f01048cf:	8b 7d 08             	mov    0x8(%ebp),%edi
+f01048d2:	e9 3d ff ff ff       	jmp    f0104814 <env_free+0x115>
+		panic("pa2page called with invalid pa");
+f01048d7:	83 ec 04             	sub    $0x4,%esp
+f01048da:	68 68 c6 10 f0       	push   $0xf010c668
+f01048df:	68 9d 00 00 00       	push   $0x9d
+f01048e4:	68 95 ce 10 f0       	push   $0xf010ce95
+f01048e9:	e8 55 b7 ff ff       	call   f0100043 <_panic>
+	}
+
+	// free the page directory
+	pa = PADDR(e->env_pgdir);
+f01048ee:	8b 45 08             	mov    0x8(%ebp),%eax
+f01048f1:	8b 40 60             	mov    0x60(%eax),%eax
+	if ((uint32_t)kva < KERNBASE)
+f01048f4:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01048f9:	76 52                	jbe    f010494d <env_free+0x24e>
+	e->env_pgdir = 0;
+f01048fb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f01048fe:	c7 41 60 00 00 00 00 	movl   $0x0,0x60(%ecx)
+	return (physaddr_t)kva - KERNBASE;
+f0104905:	05 00 00 00 10       	add    $0x10000000,%eax
+	if (PGNUM(pa) >= npages)
+f010490a:	c1 e8 0c             	shr    $0xc,%eax
+f010490d:	3b 05 74 47 79 f0    	cmp    0xf0794774,%eax
+f0104913:	73 4d                	jae    f0104962 <env_free+0x263>
+	page_decref(pa2page(pa));
+f0104915:	83 ec 0c             	sub    $0xc,%esp
+	return &pages[PGNUM(pa)];
+f0104918:	8b 15 68 47 79 f0    	mov    0xf0794768,%edx
+f010491e:	8d 04 c2             	lea    (%edx,%eax,8),%eax
+f0104921:	50                   	push   %eax
+f0104922:	e8 95 c9 ff ff       	call   f01012bc <page_decref>
+
+	// return the environment to the free list
+	e->env_status = ENV_FREE;
+f0104927:	8b 45 08             	mov    0x8(%ebp),%eax
+f010492a:	c7 40 54 00 00 00 00 	movl   $0x0,0x54(%eax)
+	e->env_link = env_free_list;
+f0104931:	a1 88 47 79 f0       	mov    0xf0794788,%eax
+f0104936:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0104939:	89 41 44             	mov    %eax,0x44(%ecx)
+	env_free_list = e;
+f010493c:	89 0d 88 47 79 f0    	mov    %ecx,0xf0794788
+}
+f0104942:	83 c4 10             	add    $0x10,%esp
+f0104945:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0104948:	5b                   	pop    %ebx
+f0104949:	5e                   	pop    %esi
+f010494a:	5f                   	pop    %edi
+f010494b:	5d                   	pop    %ebp
+f010494c:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f010494d:	50                   	push   %eax
+f010494e:	68 24 be 10 f0       	push   $0xf010be24
+f0104953:	68 c5 02 00 00       	push   $0x2c5
+f0104958:	68 d8 d1 10 f0       	push   $0xf010d1d8
+f010495d:	e8 e1 b6 ff ff       	call   f0100043 <_panic>
+		panic("pa2page called with invalid pa");
+f0104962:	83 ec 04             	sub    $0x4,%esp
+f0104965:	68 68 c6 10 f0       	push   $0xf010c668
+f010496a:	68 9d 00 00 00       	push   $0x9d
+f010496f:	68 95 ce 10 f0       	push   $0xf010ce95
+f0104974:	e8 ca b6 ff ff       	call   f0100043 <_panic>
+
+f0104979 <env_destroy>:
+// If e was the current env, then runs a new environment (and does not return
+// to the caller).
+//
+void
+env_destroy(struct Env *e)
+{
+f0104979:	55                   	push   %ebp
+f010497a:	89 e5                	mov    %esp,%ebp
+f010497c:	53                   	push   %ebx
+f010497d:	83 ec 04             	sub    $0x4,%esp
+f0104980:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	// If e is currently running on other CPUs, we change its state to
+	// ENV_DYING. A zombie environment will be freed the next time
+	// it traps to the kernel.
+	if (e->env_status == ENV_RUNNING && curenv != e) {
+f0104983:	83 7b 54 03          	cmpl   $0x3,0x54(%ebx)
+f0104987:	74 21                	je     f01049aa <env_destroy+0x31>
+		e->env_status = ENV_DYING;
+		return;
+	}
+
+	env_free(e);
+f0104989:	83 ec 0c             	sub    $0xc,%esp
+f010498c:	53                   	push   %ebx
+f010498d:	e8 6d fd ff ff       	call   f01046ff <env_free>
+
+	if (curenv == e) {
+f0104992:	e8 a0 42 00 00       	call   f0108c37 <cpunum>
+f0104997:	6b c0 78             	imul   $0x78,%eax,%eax
+f010499a:	83 c4 10             	add    $0x10,%esp
+f010499d:	39 98 28 60 7d f0    	cmp    %ebx,-0xf829fd8(%eax)
+f01049a3:	74 1e                	je     f01049c3 <env_destroy+0x4a>
+		curenv = NULL;
+		sched_yield();
+	}
+}
+f01049a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01049a8:	c9                   	leave
+f01049a9:	c3                   	ret
+	if (e->env_status == ENV_RUNNING && curenv != e) {
+f01049aa:	e8 88 42 00 00       	call   f0108c37 <cpunum>
+f01049af:	6b c0 78             	imul   $0x78,%eax,%eax
+f01049b2:	39 98 28 60 7d f0    	cmp    %ebx,-0xf829fd8(%eax)
+f01049b8:	74 cf                	je     f0104989 <env_destroy+0x10>
+		e->env_status = ENV_DYING;
+f01049ba:	c7 43 54 01 00 00 00 	movl   $0x1,0x54(%ebx)
+		return;
+f01049c1:	eb e2                	jmp    f01049a5 <env_destroy+0x2c>
+		curenv = NULL;
+f01049c3:	e8 6f 42 00 00       	call   f0108c37 <cpunum>
+f01049c8:	6b c0 78             	imul   $0x78,%eax,%eax
+f01049cb:	c7 80 28 60 7d f0 00 	movl   $0x0,-0xf829fd8(%eax)
+f01049d2:	00 00 00 
+		sched_yield();
+f01049d5:	e8 57 17 00 00       	call   f0106131 <sched_yield>
+
+f01049da <env_pop_tf>:
+//
+// This function does not return.
+//
+void
+env_pop_tf(struct Trapframe *tf)
+{
+f01049da:	55                   	push   %ebp
+f01049db:	89 e5                	mov    %esp,%ebp
+f01049dd:	53                   	push   %ebx
+f01049de:	83 ec 04             	sub    $0x4,%esp
+	// Record the CPU we are running on for user-space debugging
+	curenv->env_cpunum = cpunum();
+f01049e1:	e8 51 42 00 00       	call   f0108c37 <cpunum>
+f01049e6:	6b c0 78             	imul   $0x78,%eax,%eax
+f01049e9:	8b 98 28 60 7d f0    	mov    -0xf829fd8(%eax),%ebx
+f01049ef:	e8 43 42 00 00       	call   f0108c37 <cpunum>
+f01049f4:	89 43 5c             	mov    %eax,0x5c(%ebx)
+
+	asm volatile(
+f01049f7:	8b 65 08             	mov    0x8(%ebp),%esp
+f01049fa:	61                   	popa
+f01049fb:	07                   	pop    %es
+f01049fc:	1f                   	pop    %ds
+f01049fd:	83 c4 08             	add    $0x8,%esp
+f0104a00:	cf                   	iret
+		"\tpopl %%es\n"
+		"\tpopl %%ds\n"
+		"\taddl $0x8,%%esp\n" /* skip tf_trapno and tf_errcode */
+		"\tiret\n"
+		: : "g" (tf) : "memory");
+	panic("iret failed");  /* mostly to placate the compiler */
+f0104a01:	83 ec 04             	sub    $0x4,%esp
+f0104a04:	68 4a d2 10 f0       	push   $0xf010d24a
+f0104a09:	68 fc 02 00 00       	push   $0x2fc
+f0104a0e:	68 d8 d1 10 f0       	push   $0xf010d1d8
+f0104a13:	e8 2b b6 ff ff       	call   f0100043 <_panic>
+
+f0104a18 <env_run>:
+//
+// This function does not return.
+//
+void
+env_run(struct Env *e)
+{
+f0104a18:	55                   	push   %ebp
+f0104a19:	89 e5                	mov    %esp,%ebp
+f0104a1b:	83 ec 08             	sub    $0x8,%esp
+	//	e->env_tf to sensible values.
+
+	// LAB 3: Your code here.
+  
+  // step 1
+  if (curenv && curenv->env_status == ENV_RUNNING) {
+f0104a1e:	e8 14 42 00 00       	call   f0108c37 <cpunum>
+f0104a23:	6b c0 78             	imul   $0x78,%eax,%eax
+f0104a26:	83 b8 28 60 7d f0 00 	cmpl   $0x0,-0xf829fd8(%eax)
+f0104a2d:	74 14                	je     f0104a43 <env_run+0x2b>
+f0104a2f:	e8 03 42 00 00       	call   f0108c37 <cpunum>
+f0104a34:	6b c0 78             	imul   $0x78,%eax,%eax
+f0104a37:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0104a3d:	83 78 54 03          	cmpl   $0x3,0x54(%eax)
+f0104a41:	74 7d                	je     f0104ac0 <env_run+0xa8>
+    curenv->env_status = ENV_RUNNABLE;
+  }
+  curenv = e;
+f0104a43:	e8 ef 41 00 00       	call   f0108c37 <cpunum>
+f0104a48:	6b c0 78             	imul   $0x78,%eax,%eax
+f0104a4b:	8b 55 08             	mov    0x8(%ebp),%edx
+f0104a4e:	89 90 28 60 7d f0    	mov    %edx,-0xf829fd8(%eax)
+  curenv->env_status = ENV_RUNNING;
+f0104a54:	e8 de 41 00 00       	call   f0108c37 <cpunum>
+f0104a59:	6b c0 78             	imul   $0x78,%eax,%eax
+f0104a5c:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0104a62:	c7 40 54 03 00 00 00 	movl   $0x3,0x54(%eax)
+  curenv->env_runs++;
+f0104a69:	e8 c9 41 00 00       	call   f0108c37 <cpunum>
+f0104a6e:	6b c0 78             	imul   $0x78,%eax,%eax
+f0104a71:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0104a77:	83 40 58 01          	addl   $0x1,0x58(%eax)
+  lcr3(PADDR(curenv->env_pgdir));
+f0104a7b:	e8 b7 41 00 00       	call   f0108c37 <cpunum>
+f0104a80:	6b c0 78             	imul   $0x78,%eax,%eax
+f0104a83:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0104a89:	8b 40 60             	mov    0x60(%eax),%eax
+	if ((uint32_t)kva < KERNBASE)
+f0104a8c:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0104a91:	76 47                	jbe    f0104ada <env_run+0xc2>
+	return (physaddr_t)kva - KERNBASE;
+f0104a93:	05 00 00 00 10       	add    $0x10000000,%eax
+	asm volatile("movl %0,%%cr3" : : "r" (val));
+f0104a98:	0f 22 d8             	mov    %eax,%cr3
+}
+
+static inline void
+unlock_kernel(void)
+{
+	spin_unlock(&kernel_lock);
+f0104a9b:	83 ec 0c             	sub    $0xc,%esp
+f0104a9e:	68 c0 a3 11 f0       	push   $0xf011a3c0
+f0104aa3:	e8 08 46 00 00       	call   f01090b0 <spin_unlock>
+
+	// Normally we wouldn't need to do this, but QEMU only runs
+	// one CPU at a time and has a long time-slice.  Without the
+	// pause, this CPU is likely to reacquire the lock before
+	// another CPU has even been given a chance to acquire it.
+	asm volatile("pause");
+f0104aa8:	f3 90                	pause
+ 
+  // step 2
+  unlock_kernel();
+  env_pop_tf(&curenv->env_tf); 
+f0104aaa:	e8 88 41 00 00       	call   f0108c37 <cpunum>
+f0104aaf:	83 c4 04             	add    $0x4,%esp
+f0104ab2:	6b c0 78             	imul   $0x78,%eax,%eax
+f0104ab5:	ff b0 28 60 7d f0    	push   -0xf829fd8(%eax)
+f0104abb:	e8 1a ff ff ff       	call   f01049da <env_pop_tf>
+    curenv->env_status = ENV_RUNNABLE;
+f0104ac0:	e8 72 41 00 00       	call   f0108c37 <cpunum>
+f0104ac5:	6b c0 78             	imul   $0x78,%eax,%eax
+f0104ac8:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0104ace:	c7 40 54 02 00 00 00 	movl   $0x2,0x54(%eax)
+f0104ad5:	e9 69 ff ff ff       	jmp    f0104a43 <env_run+0x2b>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0104ada:	50                   	push   %eax
+f0104adb:	68 24 be 10 f0       	push   $0xf010be24
+f0104ae0:	68 22 03 00 00       	push   $0x322
+f0104ae5:	68 d8 d1 10 f0       	push   $0xf010d1d8
+f0104aea:	e8 54 b5 ff ff       	call   f0100043 <_panic>
+
+f0104aef <pic_init>:
+}
+
+/* Initialize the 8259A interrupt controllers. */
+void
+pic_init(void)
+{
+f0104aef:	55                   	push   %ebp
+f0104af0:	89 e5                	mov    %esp,%ebp
+f0104af2:	57                   	push   %edi
+f0104af3:	56                   	push   %esi
+f0104af4:	53                   	push   %ebx
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0104af5:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+f0104afa:	bb 21 00 00 00       	mov    $0x21,%ebx
+f0104aff:	89 f8                	mov    %edi,%eax
+f0104b01:	89 da                	mov    %ebx,%edx
+f0104b03:	ee                   	out    %al,(%dx)
+f0104b04:	b9 a1 00 00 00       	mov    $0xa1,%ecx
+f0104b09:	89 ca                	mov    %ecx,%edx
+f0104b0b:	ee                   	out    %al,(%dx)
+f0104b0c:	be 11 00 00 00       	mov    $0x11,%esi
+f0104b11:	89 f0                	mov    %esi,%eax
+f0104b13:	ba 20 00 00 00       	mov    $0x20,%edx
+f0104b18:	ee                   	out    %al,(%dx)
+f0104b19:	b8 20 00 00 00       	mov    $0x20,%eax
+f0104b1e:	89 da                	mov    %ebx,%edx
+f0104b20:	ee                   	out    %al,(%dx)
+f0104b21:	b8 04 00 00 00       	mov    $0x4,%eax
+f0104b26:	ee                   	out    %al,(%dx)
+f0104b27:	b8 03 00 00 00       	mov    $0x3,%eax
+f0104b2c:	ee                   	out    %al,(%dx)
+f0104b2d:	89 f0                	mov    %esi,%eax
+f0104b2f:	ba a0 00 00 00       	mov    $0xa0,%edx
+f0104b34:	ee                   	out    %al,(%dx)
+f0104b35:	b8 28 00 00 00       	mov    $0x28,%eax
+f0104b3a:	89 ca                	mov    %ecx,%edx
+f0104b3c:	ee                   	out    %al,(%dx)
+f0104b3d:	b8 02 00 00 00       	mov    $0x2,%eax
+f0104b42:	ee                   	out    %al,(%dx)
+f0104b43:	b8 01 00 00 00       	mov    $0x1,%eax
+f0104b48:	ee                   	out    %al,(%dx)
+f0104b49:	b8 68 00 00 00       	mov    $0x68,%eax
+f0104b4e:	ba 20 00 00 00       	mov    $0x20,%edx
+f0104b53:	ee                   	out    %al,(%dx)
+f0104b54:	be 0a 00 00 00       	mov    $0xa,%esi
+f0104b59:	89 f0                	mov    %esi,%eax
+f0104b5b:	ee                   	out    %al,(%dx)
+f0104b5c:	b8 68 00 00 00       	mov    $0x68,%eax
+f0104b61:	ba a0 00 00 00       	mov    $0xa0,%edx
+f0104b66:	ee                   	out    %al,(%dx)
+f0104b67:	89 f0                	mov    %esi,%eax
+f0104b69:	ee                   	out    %al,(%dx)
+f0104b6a:	b8 fb ff ff ff       	mov    $0xfffffffb,%eax
+f0104b6f:	89 da                	mov    %ebx,%edx
+f0104b71:	ee                   	out    %al,(%dx)
+f0104b72:	89 f8                	mov    %edi,%eax
+f0104b74:	89 ca                	mov    %ecx,%edx
+f0104b76:	ee                   	out    %al,(%dx)
+	outb(IO_PIC2, 0x68);               /* OCW3 */
+	outb(IO_PIC2, 0x0a);               /* OCW3 */
+
+	// Initial IRQ mask has interrupt 2 enabled (for slave 8259A).
+	irq_setmask_8259A(0xffff & ~(BIT(IRQ_SLAVE)));
+}
+f0104b77:	5b                   	pop    %ebx
+f0104b78:	5e                   	pop    %esi
+f0104b79:	5f                   	pop    %edi
+f0104b7a:	5d                   	pop    %ebp
+f0104b7b:	c3                   	ret
+
+f0104b7c <putch>:
+#include <inc/stdarg.h>
+
+
+static void
+putch(int ch, int *cnt)
+{
+f0104b7c:	55                   	push   %ebp
+f0104b7d:	89 e5                	mov    %esp,%ebp
+f0104b7f:	83 ec 14             	sub    $0x14,%esp
+	cputchar(ch);
+f0104b82:	ff 75 08             	push   0x8(%ebp)
+f0104b85:	e8 74 bc ff ff       	call   f01007fe <cputchar>
+	*cnt++;
+}
+f0104b8a:	83 c4 10             	add    $0x10,%esp
+f0104b8d:	c9                   	leave
+f0104b8e:	c3                   	ret
+
+f0104b8f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+f0104b8f:	55                   	push   %ebp
+f0104b90:	89 e5                	mov    %esp,%ebp
+f0104b92:	83 ec 18             	sub    $0x18,%esp
+	int cnt = 0;
+f0104b95:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	vprintfmt((void*)putch, &cnt, fmt, ap);
+f0104b9c:	ff 75 0c             	push   0xc(%ebp)
+f0104b9f:	ff 75 08             	push   0x8(%ebp)
+f0104ba2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f0104ba5:	50                   	push   %eax
+f0104ba6:	68 7c 4b 10 f0       	push   $0xf0104b7c
+f0104bab:	e8 61 32 00 00       	call   f0107e11 <vprintfmt>
+	return cnt;
+}
+f0104bb0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f0104bb3:	c9                   	leave
+f0104bb4:	c3                   	ret
+
+f0104bb5 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+f0104bb5:	55                   	push   %ebp
+f0104bb6:	89 e5                	mov    %esp,%ebp
+f0104bb8:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+f0104bbb:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+f0104bbe:	50                   	push   %eax
+f0104bbf:	ff 75 08             	push   0x8(%ebp)
+f0104bc2:	e8 c8 ff ff ff       	call   f0104b8f <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+f0104bc7:	c9                   	leave
+f0104bc8:	c3                   	ret
+
+f0104bc9 <page_fault_cow>:
+// page fork made copy-on-write.  Once a shared page table is copied
+// the write is retried, and may fault again on a copy-on-write page.
+// Returns 0 if the fault was resolved, < 0 if it is the env's problem.
+static int
+page_fault_cow(uintptr_t va)
+{
+f0104bc9:	55                   	push   %ebp
+f0104bca:	89 e5                	mov    %esp,%ebp
+f0104bcc:	53                   	push   %ebx
+f0104bcd:	83 ec 04             	sub    $0x4,%esp
+f0104bd0:	89 c3                	mov    %eax,%ebx
+	if (curenv->env_pgdir[PDX(va)] & PTE_COW)
+f0104bd2:	e8 60 40 00 00       	call   f0108c37 <cpunum>
+f0104bd7:	6b c0 78             	imul   $0x78,%eax,%eax
+f0104bda:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0104be0:	89 da                	mov    %ebx,%edx
+f0104be2:	c1 ea 16             	shr    $0x16,%edx
+f0104be5:	8b 40 60             	mov    0x60(%eax),%eax
+f0104be8:	f6 44 90 01 08       	testb  $0x8,0x1(%eax,%edx,4)
+f0104bed:	75 3d                	jne    f0104c2c <page_fault_cow+0x63>
+		return pgdir_unshare(curenv->env_pgdir, (void *) va);
+	if (ksm_fault(curenv, va) == 0)
+f0104bef:	e8 43 40 00 00       	call   f0108c37 <cpunum>
+f0104bf4:	83 ec 08             	sub    $0x8,%esp
+f0104bf7:	53                   	push   %ebx
+f0104bf8:	6b c0 78             	imul   $0x78,%eax,%eax
+f0104bfb:	ff b0 28 60 7d f0    	push   -0xf829fd8(%eax)
+f0104c01:	e8 a3 4e 00 00       	call   f0109aa9 <ksm_fault>
+f0104c06:	83 c4 10             	add    $0x10,%esp
+f0104c09:	85 c0                	test   %eax,%eax
+f0104c0b:	74 3c                	je     f0104c49 <page_fault_cow+0x80>
+		return 0;
+	return page_cow_break(curenv->env_pgdir, (void *) va);
+f0104c0d:	e8 25 40 00 00       	call   f0108c37 <cpunum>
+f0104c12:	83 ec 08             	sub    $0x8,%esp
+f0104c15:	53                   	push   %ebx
+f0104c16:	6b c0 78             	imul   $0x78,%eax,%eax
+f0104c19:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0104c1f:	ff 70 60             	push   0x60(%eax)
+f0104c22:	e8 57 cf ff ff       	call   f0101b7e <page_cow_break>
+f0104c27:	83 c4 10             	add    $0x10,%esp
+f0104c2a:	eb 1d                	jmp    f0104c49 <page_fault_cow+0x80>
+		return pgdir_unshare(curenv->env_pgdir, (void *) va);
+f0104c2c:	e8 06 40 00 00       	call   f0108c37 <cpunum>
+f0104c31:	83 ec 08             	sub    $0x8,%esp
+f0104c34:	53                   	push   %ebx
+f0104c35:	6b c0 78             	imul   $0x78,%eax,%eax
+f0104c38:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0104c3e:	ff 70 60             	push   0x60(%eax)
+f0104c41:	e8 6c c9 ff ff       	call   f01015b2 <pgdir_unshare>
+f0104c46:	83 c4 10             	add    $0x10,%esp
+}
+f0104c49:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0104c4c:	c9                   	leave
+f0104c4d:	c3                   	ret
+
+f0104c4e <trap_init_percpu>:
+{
+f0104c4e:	55                   	push   %ebp
+f0104c4f:	89 e5                	mov    %esp,%ebp
+f0104c51:	57                   	push   %edi
+f0104c52:	56                   	push   %esi
+f0104c53:	53                   	push   %ebx
+f0104c54:	83 ec 1c             	sub    $0x1c,%esp
+  uint32_t i = cpunum();
+f0104c57:	e8 db 3f 00 00       	call   f0108c37 <cpunum>
+f0104c5c:	89 c3                	mov    %eax,%ebx
+  uint32_t kstacktop_i = KSTACKTOP - i * (KSTKSIZE + KSTKGAP);
+f0104c5e:	be 00 f0 00 00       	mov    $0xf000,%esi
+f0104c63:	29 c6                	sub    %eax,%esi
+f0104c65:	c1 e6 10             	shl    $0x10,%esi
+  thiscpu->cpu_ts.ts_esp0 = kstacktop_i;
+f0104c68:	e8 ca 3f 00 00       	call   f0108c37 <cpunum>
+f0104c6d:	6b c0 78             	imul   $0x78,%eax,%eax
+f0104c70:	89 b0 30 60 7d f0    	mov    %esi,-0xf829fd0(%eax)
+  thiscpu->cpu_ts.ts_ss0 = GD_KD;
+f0104c76:	e8 bc 3f 00 00       	call   f0108c37 <cpunum>
+f0104c7b:	6b c0 78             	imul   $0x78,%eax,%eax
+f0104c7e:	66 c7 80 34 60 7d f0 	movw   $0x10,-0xf829fcc(%eax)
+f0104c85:	10 00 
+  gdt[(GD_TSS0 >> 3) + i] = SEG16(STS_T32A, (uint32_t) (&thiscpu->cpu_ts),
+f0104c87:	8d 7b 05             	lea    0x5(%ebx),%edi
+f0104c8a:	e8 a8 3f 00 00       	call   f0108c37 <cpunum>
+f0104c8f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0104c92:	e8 a0 3f 00 00       	call   f0108c37 <cpunum>
+f0104c97:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0104c9a:	e8 98 3f 00 00       	call   f0108c37 <cpunum>
+f0104c9f:	66 c7 04 fd 40 a3 11 	movw   $0x67,-0xfee5cc0(,%edi,8)
+f0104ca6:	f0 67 00 
+f0104ca9:	6b 55 e4 78          	imul   $0x78,-0x1c(%ebp),%edx
+f0104cad:	81 c2 2c 60 7d f0    	add    $0xf07d602c,%edx
+f0104cb3:	66 89 14 fd 42 a3 11 	mov    %dx,-0xfee5cbe(,%edi,8)
+f0104cba:	f0 
+f0104cbb:	6b 55 e0 78          	imul   $0x78,-0x20(%ebp),%edx
+f0104cbf:	81 c2 2c 60 7d f0    	add    $0xf07d602c,%edx
+f0104cc5:	c1 ea 10             	shr    $0x10,%edx
+f0104cc8:	88 14 fd 44 a3 11 f0 	mov    %dl,-0xfee5cbc(,%edi,8)
+f0104ccf:	c6 04 fd 46 a3 11 f0 	movb   $0x40,-0xfee5cba(,%edi,8)
+f0104cd6:	40 
+f0104cd7:	6b c0 78             	imul   $0x78,%eax,%eax
+f0104cda:	05 2c 60 7d f0       	add    $0xf07d602c,%eax
+f0104cdf:	c1 e8 18             	shr    $0x18,%eax
+f0104ce2:	88 04 fd 47 a3 11 f0 	mov    %al,-0xfee5cb9(,%edi,8)
+  gdt[(GD_TSS0 >> 3) + i].sd_s = 0;
+f0104ce9:	c6 04 fd 45 a3 11 f0 	movb   $0x89,-0xfee5cbb(,%edi,8)
+f0104cf0:	89 
+  ltr(((GD_TSS0 >> 3) + i) << 3);
+f0104cf1:	8d 1c dd 28 00 00 00 	lea    0x28(,%ebx,8),%ebx
+	asm volatile("ltr %0" : : "r" (sel));
+f0104cf8:	0f 00 db             	ltr    %bx
+	asm volatile("cpuid"
+f0104cfb:	b8 01 00 00 00       	mov    $0x1,%eax
+f0104d00:	0f a2                	cpuid
+cpuid_sysenter(void)
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+f0104d02:	f6 c6 08             	test   $0x8,%dh
+f0104d05:	74 3d                	je     f0104d44 <trap_init_percpu+0xf6>
+		return 0;
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+f0104d07:	89 c2                	mov    %eax,%edx
+f0104d09:	c1 ea 08             	shr    $0x8,%edx
+f0104d0c:	83 e2 0f             	and    $0xf,%edx
+f0104d0f:	83 fa 06             	cmp    $0x6,%edx
+f0104d12:	74 40                	je     f0104d54 <trap_init_percpu+0x106>
+}
+
+static inline void
+write_msr(uint32_t msr, uint64_t val)
+{
+	asm volatile("wrmsr" : : "c" (msr), "A" (val));
+f0104d14:	b9 74 01 00 00       	mov    $0x174,%ecx
+f0104d19:	b8 08 00 00 00       	mov    $0x8,%eax
+f0104d1e:	ba 00 00 00 00       	mov    $0x0,%edx
+f0104d23:	0f 30                	wrmsr
+    write_msr(MSR_IA32_SYSENTER_ESP, kstacktop_i);
+f0104d25:	89 f0                	mov    %esi,%eax
+f0104d27:	ba 00 00 00 00       	mov    $0x0,%edx
+f0104d2c:	b9 75 01 00 00       	mov    $0x175,%ecx
+f0104d31:	0f 30                	wrmsr
+f0104d33:	b9 76 01 00 00       	mov    $0x176,%ecx
+f0104d38:	b8 f0 5e 10 f0       	mov    $0xf0105ef0,%eax
+f0104d3d:	ba 00 00 00 00       	mov    $0x0,%edx
+f0104d42:	0f 30                	wrmsr
+	asm volatile("lidt (%0)" : : "r" (p));
+f0104d44:	b8 a8 a3 11 f0       	mov    $0xf011a3a8,%eax
+f0104d49:	0f 01 18             	lidtl  (%eax)
+}
+f0104d4c:	83 c4 1c             	add    $0x1c,%esp
+f0104d4f:	5b                   	pop    %ebx
+f0104d50:	5e                   	pop    %esi
+f0104d51:	5f                   	pop    %edi
+f0104d52:	5d                   	pop    %ebp
+f0104d53:	c3                   	ret
+f0104d54:	89 c2                	mov    %eax,%edx
+f0104d56:	c1 ea 04             	shr    $0x4,%edx
+f0104d59:	83 e2 0f             	and    $0xf,%edx
+f0104d5c:	83 fa 02             	cmp    $0x2,%edx
+f0104d5f:	77 b3                	ja     f0104d14 <trap_init_percpu+0xc6>
+		 && (eax & 0xf) < 3);
+f0104d61:	83 e0 0f             	and    $0xf,%eax
+  if (cpuid_sysenter()) {
+f0104d64:	83 f8 02             	cmp    $0x2,%eax
+f0104d67:	76 db                	jbe    f0104d44 <trap_init_percpu+0xf6>
+f0104d69:	eb a9                	jmp    f0104d14 <trap_init_percpu+0xc6>
+
+f0104d6b <trap_init>:
+{
+f0104d6b:	55                   	push   %ebp
+f0104d6c:	89 e5                	mov    %esp,%ebp
+f0104d6e:	83 ec 08             	sub    $0x8,%esp
+  SETGATE(idt[T_DIVIDE], 1, GD_KT, &divide, 0);
+f0104d71:	b8 48 5e 10 f0       	mov    $0xf0105e48,%eax
+f0104d76:	66 a3 a0 47 79 f0    	mov    %ax,0xf07947a0
+f0104d7c:	66 c7 05 a2 47 79 f0 	movw   $0x8,0xf07947a2
+f0104d83:	08 00 
+f0104d85:	c6 05 a4 47 79 f0 00 	movb   $0x0,0xf07947a4
+f0104d8c:	c6 05 a5 47 79 f0 8f 	movb   $0x8f,0xf07947a5
+f0104d93:	c1 e8 10             	shr    $0x10,%eax
+f0104d96:	66 a3 a6 47 79 f0    	mov    %ax,0xf07947a6
+  SETGATE(idt[T_DEBUG], 1, GD_KT, &debug, 0);
+f0104d9c:	b8 52 5e 10 f0       	mov    $0xf0105e52,%eax
+f0104da1:	66 a3 a8 47 79 f0    	mov    %ax,0xf07947a8
+f0104da7:	66 c7 05 aa 47 79 f0 	movw   $0x8,0xf07947aa
+f0104dae:	08 00 
+f0104db0:	c6 05 ac 47 79 f0 00 	movb   $0x0,0xf07947ac
+f0104db7:	c6 05 ad 47 79 f0 8f 	movb   $0x8f,0xf07947ad
+f0104dbe:	c1 e8 10             	shr    $0x10,%eax
+f0104dc1:	66 a3 ae 47 79 f0    	mov    %ax,0xf07947ae
+  SETGATE(idt[T_NMI], 1, GD_KT, &nmi, 0);
+f0104dc7:	b8 58 5e 10 f0       	mov    $0xf0105e58,%eax
+f0104dcc:	66 a3 b0 47 79 f0    	mov    %ax,0xf07947b0
+f0104dd2:	66 c7 05 b2 47 79 f0 	movw   $0x8,0xf07947b2
+f0104dd9:	08 00 
+f0104ddb:	c6 05 b4 47 79 f0 00 	movb   $0x0,0xf07947b4
+f0104de2:	c6 05 b5 47 79 f0 8f 	movb   $0x8f,0xf07947b5
+f0104de9:	c1 e8 10             	shr    $0x10,%eax
+f0104dec:	66 a3 b6 47 79 f0    	mov    %ax,0xf07947b6
+  SETGATE(idt[T_BRKPT], 1, GD_KT, &brkpt, 3);
+f0104df2:	b8 5e 5e 10 f0       	mov    $0xf0105e5e,%eax
+f0104df7:	66 a3 b8 47 79 f0    	mov    %ax,0xf07947b8
+f0104dfd:	66 c7 05 ba 47 79 f0 	movw   $0x8,0xf07947ba
+f0104e04:	08 00 
+f0104e06:	c6 05 bc 47 79 f0 00 	movb   $0x0,0xf07947bc
+f0104e0d:	c6 05 bd 47 79 f0 ef 	movb   $0xef,0xf07947bd
+f0104e14:	c1 e8 10             	shr    $0x10,%eax
+f0104e17:	66 a3 be 47 79 f0    	mov    %ax,0xf07947be
+  SETGATE(idt[T_OFLOW], 1, GD_KT, &oflow, 0);
+f0104e1d:	b8 64 5e 10 f0       	mov    $0xf0105e64,%eax
+f0104e22:	66 a3 c0 47 79 f0    	mov    %ax,0xf07947c0
+f0104e28:	66 c7 05 c2 47 79 f0 	movw   $0x8,0xf07947c2
+f0104e2f:	08 00 
+f0104e31:	c6 05 c4 47 79 f0 00 	movb   $0x0,0xf07947c4
+f0104e38:	c6 05 c5 47 79 f0 8f 	movb   $0x8f,0xf07947c5
+f0104e3f:	c1 e8 10             	shr    $0x10,%eax
+f0104e42:	66 a3 c6 47 79 f0    	mov    %ax,0xf07947c6
+  SETGATE(idt[T_BOUND], 1, GD_KT, &bound, 0);
+f0104e48:	b8 6a 5e 10 f0       	mov    $0xf0105e6a,%eax
+f0104e4d:	66 a3 c8 47 79 f0    	mov    %ax,0xf07947c8
+f0104e53:	66 c7 05 ca 47 79 f0 	movw   $0x8,0xf07947ca
+f0104e5a:	08 00 
+f0104e5c:	c6 05 cc 47 79 f0 00 	movb   $0x0,0xf07947cc
+f0104e63:	c6 05 cd 47 79 f0 8f 	movb   $0x8f,0xf07947cd
+f0104e6a:	c1 e8 10             	shr    $0x10,%eax
+f0104e6d:	66 a3 ce 47 79 f0    	mov    %ax,0xf07947ce
+  SETGATE(idt[T_ILLOP], 1, GD_KT, &illop, 0);
+f0104e73:	b8 70 5e 10 f0       	mov    $0xf0105e70,%eax
+f0104e78:	66 a3 d0 47 79 f0    	mov    %ax,0xf07947d0
+f0104e7e:	66 c7 05 d2 47 79 f0 	movw   $0x8,0xf07947d2
+f0104e85:	08 00 
+f0104e87:	c6 05 d4 47 79 f0 00 	movb   $0x0,0xf07947d4
+f0104e8e:	c6 05 d5 47 79 f0 8f 	movb   $0x8f,0xf07947d5
+f0104e95:	c1 e8 10             	shr    $0x10,%eax
+f0104e98:	66 a3 d6 47 79 f0    	mov    %ax,0xf07947d6
+  SETGATE(idt[T_DEVICE], 1, GD_KT, &device, 0);
+f0104e9e:	b8 76 5e 10 f0       	mov    $0xf0105e76,%eax
+f0104ea3:	66 a3 d8 47 79 f0    	mov    %ax,0xf07947d8
+f0104ea9:	66 c7 05 da 47 79 f0 	movw   $0x8,0xf07947da
+f0104eb0:	08 00 
+f0104eb2:	c6 05 dc 47 79 f0 00 	movb   $0x0,0xf07947dc
+f0104eb9:	c6 05 dd 47 79 f0 8f 	movb   $0x8f,0xf07947dd
+f0104ec0:	c1 e8 10             	shr    $0x10,%eax
+f0104ec3:	66 a3 de 47 79 f0    	mov    %ax,0xf07947de
+  SETGATE(idt[T_DBLFLT], 1, GD_KT, &dblflt, 0);
+f0104ec9:	b8 7c 5e 10 f0       	mov    $0xf0105e7c,%eax
+f0104ece:	66 a3 e0 47 79 f0    	mov    %ax,0xf07947e0
+f0104ed4:	66 c7 05 e2 47 79 f0 	movw   $0x8,0xf07947e2
+f0104edb:	08 00 
+f0104edd:	c6 05 e4 47 79 f0 00 	movb   $0x0,0xf07947e4
+f0104ee4:	c6 05 e5 47 79 f0 8f 	movb   $0x8f,0xf07947e5
+f0104eeb:	c1 e8 10             	shr    $0x10,%eax
+f0104eee:	66 a3 e6 47 79 f0    	mov    %ax,0xf07947e6
+  SETGATE(idt[T_TSS], 1, GD_KT, &tss, 0);
+f0104ef4:	b8 80 5e 10 f0       	mov    $0xf0105e80,%eax
+f0104ef9:	66 a3 f0 47 79 f0    	mov    %ax,0xf07947f0
+f0104eff:	66 c7 05 f2 47 79 f0 	movw   $0x8,0xf07947f2
+f0104f06:	08 00 
+f0104f08:	c6 05 f4 47 79 f0 00 	movb   $0x0,0xf07947f4
+f0104f0f:	c6 05 f5 47 79 f0 8f 	movb   $0x8f,0xf07947f5
+f0104f16:	c1 e8 10             	shr    $0x10,%eax
+f0104f19:	66 a3 f6 47 79 f0    	mov    %ax,0xf07947f6
+  SETGATE(idt[T_SEGNP], 1, GD_KT, &segnp, 0);
+f0104f1f:	b8 84 5e 10 f0       	mov    $0xf0105e84,%eax
+f0104f24:	66 a3 f8 47 79 f0    	mov    %ax,0xf07947f8
+f0104f2a:	66 c7 05 fa 47 79 f0 	movw   $0x8,0xf07947fa
+f0104f31:	08 00 
+f0104f33:	c6 05 fc 47 79 f0 00 	movb   $0x0,0xf07947fc
+f0104f3a:	c6 05 fd 47 79 f0 8f 	movb   $0x8f,0xf07947fd
+f0104f41:	c1 e8 10             	shr    $0x10,%eax
+f0104f44:	66 a3 fe 47 79 f0    	mov    %ax,0xf07947fe
+  SETGATE(idt[T_STACK], 1, GD_KT, &stack, 0);
+f0104f4a:	b8 88 5e 10 f0       	mov    $0xf0105e88,%eax
+f0104f4f:	66 a3 00 48 79 f0    	mov    %ax,0xf0794800
+f0104f55:	66 c7 05 02 48 79 f0 	movw   $0x8,0xf0794802
+f0104f5c:	08 00 
+f0104f5e:	c6 05 04 48 79 f0 00 	movb   $0x0,0xf0794804
+f0104f65:	c6 05 05 48 79 f0 8f 	movb   $0x8f,0xf0794805
+f0104f6c:	c1 e8 10             	shr    $0x10,%eax
+f0104f6f:	66 a3 06 48 79 f0    	mov    %ax,0xf0794806
+  SETGATE(idt[T_GPFLT], 1, GD_KT, &gpflt, 0);
+f0104f75:	b8 8c 5e 10 f0       	mov    $0xf0105e8c,%eax
+f0104f7a:	66 a3 08 48 79 f0    	mov    %ax,0xf0794808
+f0104f80:	66 c7 05 0a 48 79 f0 	movw   $0x8,0xf079480a
+f0104f87:	08 00 
+f0104f89:	c6 05 0c 48 79 f0 00 	movb   $0x0,0xf079480c
+f0104f90:	c6 05 0d 48 79 f0 8f 	movb   $0x8f,0xf079480d
+f0104f97:	c1 e8 10             	shr    $0x10,%eax
+f0104f9a:	66 a3 0e 48 79 f0    	mov    %ax,0xf079480e
+  SETGATE(idt[T_PGFLT], 1, GD_KT, &pgflt, 0);
+f0104fa0:	b8 90 5e 10 f0       	mov    $0xf0105e90,%eax
+f0104fa5:	66 a3 10 48 79 f0    	mov    %ax,0xf0794810
+f0104fab:	66 c7 05 12 48 79 f0 	movw   $0x8,0xf0794812
+f0104fb2:	08 00 
+f0104fb4:	c6 05 14 48 79 f0 00 	movb   $0x0,0xf0794814
+f0104fbb:	c6 05 15 48 79 f0 8f 	movb   $0x8f,0xf0794815
+f0104fc2:	c1 e8 10             	shr    $0x10,%eax
+f0104fc5:	66 a3 16 48 79 f0    	mov    %ax,0xf0794816
+  SETGATE(idt[T_FPERR], 1, GD_KT, &fperr, 0);
+f0104fcb:	b8 94 5e 10 f0       	mov    $0xf0105e94,%eax
+f0104fd0:	66 a3 20 48 79 f0    	mov    %ax,0xf0794820
+f0104fd6:	66 c7 05 22 48 79 f0 	movw   $0x8,0xf0794822
+f0104fdd:	08 00 
+f0104fdf:	c6 05 24 48 79 f0 00 	movb   $0x0,0xf0794824
+f0104fe6:	c6 05 25 48 79 f0 8f 	movb   $0x8f,0xf0794825
+f0104fed:	c1 e8 10             	shr    $0x10,%eax
+f0104ff0:	66 a3 26 48 79 f0    	mov    %ax,0xf0794826
+  SETGATE(idt[T_ALIGN], 1, GD_KT, &align, 0);
+f0104ff6:	b8 9a 5e 10 f0       	mov    $0xf0105e9a,%eax
+f0104ffb:	66 a3 28 48 79 f0    	mov    %ax,0xf0794828
+f0105001:	66 c7 05 2a 48 79 f0 	movw   $0x8,0xf079482a
+f0105008:	08 00 
+f010500a:	c6 05 2c 48 79 f0 00 	movb   $0x0,0xf079482c
+f0105011:	c6 05 2d 48 79 f0 8f 	movb   $0x8f,0xf079482d
+f0105018:	c1 e8 10             	shr    $0x10,%eax
+f010501b:	66 a3 2e 48 79 f0    	mov    %ax,0xf079482e
+  SETGATE(idt[T_MCHK], 1, GD_KT, &mchk, 0);
+f0105021:	b8 a0 5e 10 f0       	mov    $0xf0105ea0,%eax
+f0105026:	66 a3 30 48 79 f0    	mov    %ax,0xf0794830
+f010502c:	66 c7 05 32 48 79 f0 	movw   $0x8,0xf0794832
+f0105033:	08 00 
+f0105035:	c6 05 34 48 79 f0 00 	movb   $0x0,0xf0794834
+f010503c:	c6 05 35 48 79 f0 8f 	movb   $0x8f,0xf0794835
+f0105043:	c1 e8 10             	shr    $0x10,%eax
+f0105046:	66 a3 36 48 79 f0    	mov    %ax,0xf0794836
+  SETGATE(idt[T_SIMDERR], 1, GD_KT, &simderr, 0);
+f010504c:	ba a6 5e 10 f0       	mov    $0xf0105ea6,%edx
+f0105051:	66 89 15 38 48 79 f0 	mov    %dx,0xf0794838
+f0105058:	66 c7 05 3a 48 79 f0 	movw   $0x8,0xf079483a
+f010505f:	08 00 
+f0105061:	c6 05 3c 48 79 f0 00 	movb   $0x0,0xf079483c
+f0105068:	c6 05 3d 48 79 f0 8f 	movb   $0x8f,0xf079483d
+f010506f:	89 d1                	mov    %edx,%ecx
+f0105071:	c1 e9 10             	shr    $0x10,%ecx
+f0105074:	66 89 0d 3e 48 79 f0 	mov    %cx,0xf079483e
+  SETGATE(idt[T_SYSCALL], 1, GD_KT, &syscallh, 3);
+f010507b:	b8 ac 5e 10 f0       	mov    $0xf0105eac,%eax
+f0105080:	66 a3 20 49 79 f0    	mov    %ax,0xf0794920
+f0105086:	66 c7 05 22 49 79 f0 	movw   $0x8,0xf0794922
+f010508d:	08 00 
+f010508f:	c6 05 24 49 79 f0 00 	movb   $0x0,0xf0794924
+f0105096:	c6 05 25 49 79 f0 ef 	movb   $0xef,0xf0794925
+f010509d:	c1 e8 10             	shr    $0x10,%eax
+f01050a0:	66 a3 26 49 79 f0    	mov    %ax,0xf0794926
+  SETGATE(idt[T_DEFAULT], 1, GD_KT, &simderr, 3);
+f01050a6:	66 89 15 40 57 79 f0 	mov    %dx,0xf0795740
+f01050ad:	66 c7 05 42 57 79 f0 	movw   $0x8,0xf0795742
+f01050b4:	08 00 
+f01050b6:	c6 05 44 57 79 f0 00 	movb   $0x0,0xf0795744
+f01050bd:	c6 05 45 57 79 f0 ef 	movb   $0xef,0xf0795745
+f01050c4:	66 89 0d 46 57 79 f0 	mov    %cx,0xf0795746
+  SETGATE(idt[IRQ_OFFSET + IRQ_TIMER], 0, GD_KT, &irq_timer, 0);
+f01050cb:	b8 bc 5e 10 f0       	mov    $0xf0105ebc,%eax
+f01050d0:	66 a3 a0 48 79 f0    	mov    %ax,0xf07948a0
+f01050d6:	66 c7 05 a2 48 79 f0 	movw   $0x8,0xf07948a2
+f01050dd:	08 00 
+f01050df:	c6 05 a4 48 79 f0 00 	movb   $0x0,0xf07948a4
+f01050e6:	c6 05 a5 48 79 f0 8e 	movb   $0x8e,0xf07948a5
+f01050ed:	c1 e8 10             	shr    $0x10,%eax
+f01050f0:	66 a3 a6 48 79 f0    	mov    %ax,0xf07948a6
+  SETGATE(idt[IRQ_OFFSET + IRQ_KBD], 0, GD_KT, &irq_kbd, 0);
+f01050f6:	b8 c2 5e 10 f0       	mov    $0xf0105ec2,%eax
+f01050fb:	66 a3 a8 48 79 f0    	mov    %ax,0xf07948a8
+f0105101:	66 c7 05 aa 48 79 f0 	movw   $0x8,0xf07948aa
+f0105108:	08 00 
+f010510a:	c6 05 ac 48 79 f0 00 	movb   $0x0,0xf07948ac
+f0105111:	c6 05 ad 48 79 f0 8e 	movb   $0x8e,0xf07948ad
+f0105118:	c1 e8 10             	shr    $0x10,%eax
+f010511b:	66 a3 ae 48 79 f0    	mov    %ax,0xf07948ae
+  SETGATE(idt[IRQ_OFFSET + IRQ_SERIAL], 0, GD_KT, &irq_serial, 0);
+f0105121:	b8 c8 5e 10 f0       	mov    $0xf0105ec8,%eax
+f0105126:	66 a3 c0 48 79 f0    	mov    %ax,0xf07948c0
+f010512c:	66 c7 05 c2 48 79 f0 	movw   $0x8,0xf07948c2
+f0105133:	08 00 
+f0105135:	c6 05 c4 48 79 f0 00 	movb   $0x0,0xf07948c4
+f010513c:	c6 05 c5 48 79 f0 8e 	movb   $0x8e,0xf07948c5
+f0105143:	c1 e8 10             	shr    $0x10,%eax
+f0105146:	66 a3 c6 48 79 f0    	mov    %ax,0xf07948c6
+  SETGATE(idt[IRQ_OFFSET + IRQ_SPURIOUS], 0, GD_KT, &irq_spurious, 0);
+f010514c:	b8 ce 5e 10 f0       	mov    $0xf0105ece,%eax
+f0105151:	66 a3 d8 48 79 f0    	mov    %ax,0xf07948d8
+f0105157:	66 c7 05 da 48 79 f0 	movw   $0x8,0xf07948da
+f010515e:	08 00 
+f0105160:	c6 05 dc 48 79 f0 00 	movb   $0x0,0xf07948dc
+f0105167:	c6 05 dd 48 79 f0 8e 	movb   $0x8e,0xf07948dd
+f010516e:	c1 e8 10             	shr    $0x10,%eax
+f0105171:	66 a3 de 48 79 f0    	mov    %ax,0xf07948de
+	trap_init_percpu();
+f0105177:	e8 d2 fa ff ff       	call   f0104c4e <trap_init_percpu>
+}
+f010517c:	c9                   	leave
+f010517d:	c3                   	ret
+
+f010517e <print_regs>:
+{
+f010517e:	55                   	push   %ebp
+f010517f:	89 e5                	mov    %esp,%ebp
+f0105181:	53                   	push   %ebx
+f0105182:	83 ec 0c             	sub    $0xc,%esp
+f0105185:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("  edi  0x%08x\n", regs->reg_edi);
+f0105188:	ff 33                	push   (%ebx)
+f010518a:	68 56 d2 10 f0       	push   $0xf010d256
+f010518f:	e8 21 fa ff ff       	call   f0104bb5 <cprintf>
+	cprintf("  esi  0x%08x\n", regs->reg_esi);
+f0105194:	83 c4 08             	add    $0x8,%esp
+f0105197:	ff 73 04             	push   0x4(%ebx)
+f010519a:	68 65 d2 10 f0       	push   $0xf010d265
+f010519f:	e8 11 fa ff ff       	call   f0104bb5 <cprintf>
+	cprintf("  ebp  0x%08x\n", regs->reg_ebp);
+f01051a4:	83 c4 08             	add    $0x8,%esp
+f01051a7:	ff 73 08             	push   0x8(%ebx)
+f01051aa:	68 74 d2 10 f0       	push   $0xf010d274
+f01051af:	e8 01 fa ff ff       	call   f0104bb5 <cprintf>
+	cprintf("  oesp 0x%08x\n", regs->reg_oesp);
+f01051b4:	83 c4 08             	add    $0x8,%esp
+f01051b7:	ff 73 0c             	push   0xc(%ebx)
+f01051ba:	68 83 d2 10 f0       	push   $0xf010d283
+f01051bf:	e8 f1 f9 ff ff       	call   f0104bb5 <cprintf>
+	cprintf("  ebx  0x%08x\n", regs->reg_ebx);
+f01051c4:	83 c4 08             	add    $0x8,%esp
+f01051c7:	ff 73 10             	push   0x10(%ebx)
+f01051ca:	68 92 d2 10 f0       	push   $0xf010d292
+f01051cf:	e8 e1 f9 ff ff       	call   f0104bb5 <cprintf>
+	cprintf("  edx  0x%08x\n", regs->reg_edx);
+f01051d4:	83 c4 08             	add    $0x8,%esp
+f01051d7:	ff 73 14             	push   0x14(%ebx)
+f01051da:	68 a1 d2 10 f0       	push   $0xf010d2a1
+f01051df:	e8 d1 f9 ff ff       	call   f0104bb5 <cprintf>
+	cprintf("  ecx  0x%08x\n", regs->reg_ecx);
+f01051e4:	83 c4 08             	add    $0x8,%esp
+f01051e7:	ff 73 18             	push   0x18(%ebx)
+f01051ea:	68 b0 d2 10 f0       	push   $0xf010d2b0
+f01051ef:	e8 c1 f9 ff ff       	call   f0104bb5 <cprintf>
+	cprintf("  eax  0x%08x\n", regs->reg_eax);
+f01051f4:	83 c4 08             	add    $0x8,%esp
+f01051f7:	ff 73 1c             	push   0x1c(%ebx)
+f01051fa:	68 bf d2 10 f0       	push   $0xf010d2bf
+f01051ff:	e8 b1 f9 ff ff       	call   f0104bb5 <cprintf>
+}
+f0105204:	83 c4 10             	add    $0x10,%esp
+f0105207:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010520a:	c9                   	leave
+f010520b:	c3                   	ret
+
+f010520c <print_trapframe>:
+{
+f010520c:	55                   	push   %ebp
+f010520d:	89 e5                	mov    %esp,%ebp
+f010520f:	56                   	push   %esi
+f0105210:	53                   	push   %ebx
+f0105211:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("TRAP frame at %p from CPU %d\n", tf, cpunum());
+f0105214:	e8 1e 3a 00 00       	call   f0108c37 <cpunum>
+f0105219:	83 ec 04             	sub    $0x4,%esp
+f010521c:	50                   	push   %eax
+f010521d:	53                   	push   %ebx
+f010521e:	68 23 d3 10 f0       	push   $0xf010d323
+f0105223:	e8 8d f9 ff ff       	call   f0104bb5 <cprintf>
+	print_regs(&tf->tf_regs);
+f0105228:	89 1c 24             	mov    %ebx,(%esp)
+f010522b:	e8 4e ff ff ff       	call   f010517e <print_regs>
+	cprintf("  es   0x----%04x\n", tf->tf_es);
+f0105230:	83 c4 08             	add    $0x8,%esp
+f0105233:	0f b7 43 20          	movzwl 0x20(%ebx),%eax
+f0105237:	50                   	push   %eax
+f0105238:	68 41 d3 10 f0       	push   $0xf010d341
+f010523d:	e8 73 f9 ff ff       	call   f0104bb5 <cprintf>
+	cprintf("  ds   0x----%04x\n", tf->tf_ds);
+f0105242:	83 c4 08             	add    $0x8,%esp
+f0105245:	0f b7 43 24          	movzwl 0x24(%ebx),%eax
+f0105249:	50                   	push   %eax
+f010524a:	68 54 d3 10 f0       	push   $0xf010d354
+f010524f:	e8 61 f9 ff ff       	call   f0104bb5 <cprintf>
+	cprintf("  trap 0x%08x %s\n", tf->tf_trapno, trapname(tf->tf_trapno));
+f0105254:	8b 43 28             	mov    0x28(%ebx),%eax
+	if (trapno < ARRAY_SIZE(excnames))
+f0105257:	83 c4 10             	add    $0x10,%esp
+f010525a:	83 f8 13             	cmp    $0x13,%eax
+f010525d:	0f 86 da 00 00 00    	jbe    f010533d <print_trapframe+0x131>
+		return "System call";
+f0105263:	ba ce d2 10 f0       	mov    $0xf010d2ce,%edx
+	if (trapno == T_SYSCALL)
+f0105268:	83 f8 30             	cmp    $0x30,%eax
+f010526b:	74 13                	je     f0105280 <print_trapframe+0x74>
+	if (trapno >= IRQ_OFFSET && trapno < IRQ_OFFSET + 16)
+f010526d:	8d 50 e0             	lea    -0x20(%eax),%edx
+	return "(unknown trap)";
+f0105270:	83 fa 10             	cmp    $0x10,%edx
+f0105273:	ba e9 d2 10 f0       	mov    $0xf010d2e9,%edx
+f0105278:	b9 da d2 10 f0       	mov    $0xf010d2da,%ecx
+f010527d:	0f 43 d1             	cmovae %ecx,%edx
+	cprintf("  trap 0x%08x %s\n", tf->tf_trapno, trapname(tf->tf_trapno));
+f0105280:	83 ec 04             	sub    $0x4,%esp
+f0105283:	52                   	push   %edx
+f0105284:	50                   	push   %eax
+f0105285:	68 67 d3 10 f0       	push   $0xf010d367
+f010528a:	e8 26 f9 ff ff       	call   f0104bb5 <cprintf>
+	if (tf == last_tf && tf->tf_trapno == T_PGFLT)
+f010528f:	83 c4 10             	add    $0x10,%esp
+f0105292:	39 1d a0 4f 79 f0    	cmp    %ebx,0xf0794fa0
+f0105298:	0f 84 ab 00 00 00    	je     f0105349 <print_trapframe+0x13d>
+	cprintf("  err  0x%08x", tf->tf_err);
+f010529e:	83 ec 08             	sub    $0x8,%esp
+f01052a1:	ff 73 2c             	push   0x2c(%ebx)
+f01052a4:	68 88 d3 10 f0       	push   $0xf010d388
+f01052a9:	e8 07 f9 ff ff       	call   f0104bb5 <cprintf>
+	if (tf->tf_trapno == T_PGFLT)
+f01052ae:	83 c4 10             	add    $0x10,%esp
+f01052b1:	83 7b 28 0e          	cmpl   $0xe,0x28(%ebx)
+f01052b5:	0f 85 b1 00 00 00    	jne    f010536c <print_trapframe+0x160>
+			tf->tf_err & 1 ? "protection" : "not-present");
+f01052bb:	8b 43 2c             	mov    0x2c(%ebx),%eax
+		cprintf(" [%s, %s, %s]\n",
+f01052be:	a8 01                	test   $0x1,%al
+f01052c0:	b9 07 d3 10 f0       	mov    $0xf010d307,%ecx
+f01052c5:	ba fc d2 10 f0       	mov    $0xf010d2fc,%edx
+f01052ca:	0f 45 ca             	cmovne %edx,%ecx
+f01052cd:	a8 02                	test   $0x2,%al
+f01052cf:	ba 19 d3 10 f0       	mov    $0xf010d319,%edx
+f01052d4:	be 13 d3 10 f0       	mov    $0xf010d313,%esi
+f01052d9:	0f 45 d6             	cmovne %esi,%edx
+f01052dc:	a8 04                	test   $0x4,%al
+f01052de:	b8 62 d4 10 f0       	mov    $0xf010d462,%eax
+f01052e3:	be 1e d3 10 f0       	mov    $0xf010d31e,%esi
+f01052e8:	0f 45 c6             	cmovne %esi,%eax
+f01052eb:	51                   	push   %ecx
+f01052ec:	52                   	push   %edx
+f01052ed:	50                   	push   %eax
+f01052ee:	68 96 d3 10 f0       	push   $0xf010d396
+f01052f3:	e8 bd f8 ff ff       	call   f0104bb5 <cprintf>
+f01052f8:	83 c4 10             	add    $0x10,%esp
+	cprintf("  eip  0x%08x\n", tf->tf_eip);
+f01052fb:	83 ec 08             	sub    $0x8,%esp
+f01052fe:	ff 73 30             	push   0x30(%ebx)
+f0105301:	68 a5 d3 10 f0       	push   $0xf010d3a5
+f0105306:	e8 aa f8 ff ff       	call   f0104bb5 <cprintf>
+	cprintf("  cs   0x----%04x\n", tf->tf_cs);
+f010530b:	83 c4 08             	add    $0x8,%esp
+f010530e:	0f b7 43 34          	movzwl 0x34(%ebx),%eax
+f0105312:	50                   	push   %eax
+f0105313:	68 b4 d3 10 f0       	push   $0xf010d3b4
+f0105318:	e8 98 f8 ff ff       	call   f0104bb5 <cprintf>
+	cprintf("  flag 0x%08x\n", tf->tf_eflags);
+f010531d:	83 c4 08             	add    $0x8,%esp
+f0105320:	ff 73 38             	push   0x38(%ebx)
+f0105323:	68 c7 d3 10 f0       	push   $0xf010d3c7
+f0105328:	e8 88 f8 ff ff       	call   f0104bb5 <cprintf>
+	if ((tf->tf_cs & 3) != 0) {
+f010532d:	83 c4 10             	add    $0x10,%esp
+f0105330:	f6 43 34 03          	testb  $0x3,0x34(%ebx)
+f0105334:	75 4b                	jne    f0105381 <print_trapframe+0x175>
+}
+f0105336:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0105339:	5b                   	pop    %ebx
+f010533a:	5e                   	pop    %esi
+f010533b:	5d                   	pop    %ebp
+f010533c:	c3                   	ret
+		return excnames[trapno];
+f010533d:	8b 14 85 20 d7 10 f0 	mov    -0xfef28e0(,%eax,4),%edx
+f0105344:	e9 37 ff ff ff       	jmp    f0105280 <print_trapframe+0x74>
+	if (tf == last_tf && tf->tf_trapno == T_PGFLT)
+f0105349:	83 7b 28 0e          	cmpl   $0xe,0x28(%ebx)
+f010534d:	0f 85 4b ff ff ff    	jne    f010529e <print_trapframe+0x92>
+	asm volatile("movl %%cr2,%0" : "=r" (val));
+f0105353:	0f 20 d0             	mov    %cr2,%eax
+		cprintf("  cr2  0x%08x\n", rcr2());
+f0105356:	83 ec 08             	sub    $0x8,%esp
+f0105359:	50                   	push   %eax
+f010535a:	68 79 d3 10 f0       	push   $0xf010d379
+f010535f:	e8 51 f8 ff ff       	call   f0104bb5 <cprintf>
+f0105364:	83 c4 10             	add    $0x10,%esp
+f0105367:	e9 32 ff ff ff       	jmp    f010529e <print_trapframe+0x92>
+		cprintf("\n");
+f010536c:	83 ec 0c             	sub    $0xc,%esp
+f010536f:	68 84 d1 10 f0       	push   $0xf010d184
+f0105374:	e8 3c f8 ff ff       	call   f0104bb5 <cprintf>
+f0105379:	83 c4 10             	add    $0x10,%esp
+f010537c:	e9 7a ff ff ff       	jmp    f01052fb <print_trapframe+0xef>
+		cprintf("  esp  0x%08x\n", tf->tf_esp);
+f0105381:	83 ec 08             	sub    $0x8,%esp
+f0105384:	ff 73 3c             	push   0x3c(%ebx)
+f0105387:	68 d6 d3 10 f0       	push   $0xf010d3d6
+f010538c:	e8 24 f8 ff ff       	call   f0104bb5 <cprintf>
+		cprintf("  ss   0x----%04x\n", tf->tf_ss);
+f0105391:	83 c4 08             	add    $0x8,%esp
+f0105394:	0f b7 43 40          	movzwl 0x40(%ebx),%eax
+f0105398:	50                   	push   %eax
+f0105399:	68 e5 d3 10 f0       	push   $0xf010d3e5
+f010539e:	e8 12 f8 ff ff       	call   f0104bb5 <cprintf>
+f01053a3:	83 c4 10             	add    $0x10,%esp
+}
+f01053a6:	eb 8e                	jmp    f0105336 <print_trapframe+0x12a>
+
+f01053a8 <sysenter_trap>:
+{
+f01053a8:	55                   	push   %ebp
+f01053a9:	89 e5                	mov    %esp,%ebp
+f01053ab:	57                   	push   %edi
+f01053ac:	56                   	push   %esi
+f01053ad:	53                   	push   %ebx
+f01053ae:	83 ec 6c             	sub    $0x6c,%esp
+f01053b1:	8b 75 08             	mov    0x8(%ebp),%esi
+	asm volatile("cld" ::: "cc");
+f01053b4:	fc                   	cld
+	if (panicstr)
+f01053b5:	83 3d 00 40 79 f0 00 	cmpl   $0x0,0xf0794000
+f01053bc:	74 01                	je     f01053bf <sysenter_trap+0x17>
+		asm volatile("hlt");
+f01053be:	f4                   	hlt
+	asm volatile("pushfl; popl %0" : "=r" (eflags));
+f01053bf:	9c                   	pushf
+f01053c0:	58                   	pop    %eax
+	assert(!(read_eflags() & FL_IF));
+f01053c1:	f6 c4 02             	test   $0x2,%ah
+f01053c4:	74 19                	je     f01053df <sysenter_trap+0x37>
+f01053c6:	68 f8 d3 10 f0       	push   $0xf010d3f8
+f01053cb:	68 bf be 10 f0       	push   $0xf010bebf
+f01053d0:	68 af 01 00 00       	push   $0x1af
+f01053d5:	68 11 d4 10 f0       	push   $0xf010d411
+f01053da:	e8 64 ac ff ff       	call   f0100043 <_panic>
+	if (thiscpu->cpu_sysenter_tf) {
+f01053df:	e8 53 38 00 00       	call   f0108c37 <cpunum>
+f01053e4:	6b c0 78             	imul   $0x78,%eax,%eax
+f01053e7:	80 b8 94 60 7d f0 00 	cmpb   $0x0,-0xf829f6c(%eax)
+f01053ee:	0f 85 06 01 00 00    	jne    f01054fa <sysenter_trap+0x152>
+	spin_lock(&kernel_lock);
+f01053f4:	83 ec 0c             	sub    $0xc,%esp
+f01053f7:	68 c0 a3 11 f0       	push   $0xf011a3c0
+f01053fc:	e8 15 3c 00 00       	call   f0109016 <spin_lock>
+	assert(curenv);
+f0105401:	e8 31 38 00 00       	call   f0108c37 <cpunum>
+f0105406:	6b c0 78             	imul   $0x78,%eax,%eax
+f0105409:	83 c4 10             	add    $0x10,%esp
+f010540c:	83 b8 28 60 7d f0 00 	cmpl   $0x0,-0xf829fd8(%eax)
+f0105413:	0f 84 fc 00 00 00    	je     f0105515 <sysenter_trap+0x16d>
+	if (curenv->env_status == ENV_DYING) {
+f0105419:	e8 19 38 00 00       	call   f0108c37 <cpunum>
+f010541e:	6b c0 78             	imul   $0x78,%eax,%eax
+f0105421:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0105427:	83 78 54 01          	cmpl   $0x1,0x54(%eax)
+f010542b:	0f 84 fd 00 00 00    	je     f010552e <sysenter_trap+0x186>
+	if (copyin(&eip, (const void *) tf->tf_esp, sizeof(eip)) < 0) {
+f0105431:	83 ec 04             	sub    $0x4,%esp
+f0105434:	6a 04                	push   $0x4
+f0105436:	ff 76 3c             	push   0x3c(%esi)
+f0105439:	8d 45 a0             	lea    -0x60(%ebp),%eax
+f010543c:	50                   	push   %eax
+f010543d:	e8 cc 0a 00 00       	call   f0105f0e <copyin>
+f0105442:	83 c4 10             	add    $0x10,%esp
+f0105445:	85 c0                	test   %eax,%eax
+f0105447:	0f 88 0e 01 00 00    	js     f010555b <sysenter_trap+0x1b3>
+	tf->tf_eip = eip;
+f010544d:	8b 45 a0             	mov    -0x60(%ebp),%eax
+f0105450:	89 46 30             	mov    %eax,0x30(%esi)
+	tf->tf_eflags |= curenv->env_tf.tf_eflags & FL_IF;
+f0105453:	e8 df 37 00 00       	call   f0108c37 <cpunum>
+f0105458:	6b c0 78             	imul   $0x78,%eax,%eax
+f010545b:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0105461:	8b 40 38             	mov    0x38(%eax),%eax
+f0105464:	25 00 02 00 00       	and    $0x200,%eax
+f0105469:	09 46 38             	or     %eax,0x38(%esi)
+	curenv->env_tf = *tf;
+f010546c:	e8 c6 37 00 00       	call   f0108c37 <cpunum>
+f0105471:	6b c0 78             	imul   $0x78,%eax,%eax
+f0105474:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f010547a:	b9 11 00 00 00       	mov    $0x11,%ecx
+f010547f:	89 c7                	mov    %eax,%edi
+f0105481:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	tf = &curenv->env_tf;
+f0105483:	e8 af 37 00 00       	call   f0108c37 <cpunum>
+f0105488:	6b c0 78             	imul   $0x78,%eax,%eax
+f010548b:	8b 98 28 60 7d f0    	mov    -0xf829fd8(%eax),%ebx
+f0105491:	89 5d 94             	mov    %ebx,-0x6c(%ebp)
+	last_tf = tf;
+f0105494:	89 1d a0 4f 79 f0    	mov    %ebx,0xf0794fa0
+	entry = *tf;
+f010549a:	8d 7d a4             	lea    -0x5c(%ebp),%edi
+f010549d:	b9 11 00 00 00       	mov    $0x11,%ecx
+f01054a2:	89 de                	mov    %ebx,%esi
+f01054a4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	futex_tick();
+f01054a6:	e8 7a 5c 00 00       	call   f010b125 <futex_tick>
+	r = syscall(tf->tf_regs.reg_eax, tf->tf_regs.reg_edx,
+f01054ab:	83 ec 08             	sub    $0x8,%esp
+f01054ae:	ff 73 04             	push   0x4(%ebx)
+f01054b1:	ff 33                	push   (%ebx)
+f01054b3:	ff 73 10             	push   0x10(%ebx)
+f01054b6:	ff 73 18             	push   0x18(%ebx)
+f01054b9:	ff 73 14             	push   0x14(%ebx)
+f01054bc:	ff 73 1c             	push   0x1c(%ebx)
+f01054bf:	e8 bc 14 00 00       	call   f0106980 <syscall>
+f01054c4:	89 c6                	mov    %eax,%esi
+	tf->tf_regs.reg_eax = r;
+f01054c6:	89 43 1c             	mov    %eax,0x1c(%ebx)
+	if (!curenv || curenv->env_status != ENV_RUNNING)
+f01054c9:	83 c4 20             	add    $0x20,%esp
+f01054cc:	e8 66 37 00 00       	call   f0108c37 <cpunum>
+f01054d1:	6b c0 78             	imul   $0x78,%eax,%eax
+f01054d4:	83 b8 28 60 7d f0 00 	cmpl   $0x0,-0xf829fd8(%eax)
+f01054db:	74 18                	je     f01054f5 <sysenter_trap+0x14d>
+f01054dd:	e8 55 37 00 00       	call   f0108c37 <cpunum>
+f01054e2:	6b c0 78             	imul   $0x78,%eax,%eax
+f01054e5:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f01054eb:	83 78 54 03          	cmpl   $0x3,0x54(%eax)
+f01054ef:	0f 84 a6 00 00 00    	je     f010559b <sysenter_trap+0x1f3>
+		sched_yield();
+f01054f5:	e8 37 0c 00 00       	call   f0106131 <sched_yield>
+		tf->tf_eflags |= FL_TF;
+f01054fa:	81 4e 38 00 01 00 00 	orl    $0x100,0x38(%esi)
+		thiscpu->cpu_sysenter_tf = 0;
+f0105501:	e8 31 37 00 00       	call   f0108c37 <cpunum>
+f0105506:	6b c0 78             	imul   $0x78,%eax,%eax
+f0105509:	c6 80 94 60 7d f0 00 	movb   $0x0,-0xf829f6c(%eax)
+f0105510:	e9 df fe ff ff       	jmp    f01053f4 <sysenter_trap+0x4c>
+	assert(curenv);
+f0105515:	68 1d d4 10 f0       	push   $0xf010d41d
+f010551a:	68 bf be 10 f0       	push   $0xf010bebf
+f010551f:	68 ba 01 00 00       	push   $0x1ba
+f0105524:	68 11 d4 10 f0       	push   $0xf010d411
+f0105529:	e8 15 ab ff ff       	call   f0100043 <_panic>
+		env_free(curenv);
+f010552e:	e8 04 37 00 00       	call   f0108c37 <cpunum>
+f0105533:	83 ec 0c             	sub    $0xc,%esp
+f0105536:	6b c0 78             	imul   $0x78,%eax,%eax
+f0105539:	ff b0 28 60 7d f0    	push   -0xf829fd8(%eax)
+f010553f:	e8 bb f1 ff ff       	call   f01046ff <env_free>
+		curenv = NULL;
+f0105544:	e8 ee 36 00 00       	call   f0108c37 <cpunum>
+f0105549:	6b c0 78             	imul   $0x78,%eax,%eax
+f010554c:	c7 80 28 60 7d f0 00 	movl   $0x0,-0xf829fd8(%eax)
+f0105553:	00 00 00 
+		sched_yield();
+f0105556:	e8 d6 0b 00 00       	call   f0106131 <sched_yield>
+		cprintf("[%08x] bad sysenter stack %08x\n",
+f010555b:	8b 5e 3c             	mov    0x3c(%esi),%ebx
+			curenv->env_id, tf->tf_esp);
+f010555e:	e8 d4 36 00 00       	call   f0108c37 <cpunum>
+		cprintf("[%08x] bad sysenter stack %08x\n",
+f0105563:	83 ec 04             	sub    $0x4,%esp
+f0105566:	53                   	push   %ebx
+			curenv->env_id, tf->tf_esp);
+f0105567:	6b c0 78             	imul   $0x78,%eax,%eax
+		cprintf("[%08x] bad sysenter stack %08x\n",
+f010556a:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0105570:	ff 70 48             	push   0x48(%eax)
+f0105573:	68 ac d5 10 f0       	push   $0xf010d5ac
+f0105578:	e8 38 f6 ff ff       	call   f0104bb5 <cprintf>
+		env_destroy(curenv);
+f010557d:	e8 b5 36 00 00       	call   f0108c37 <cpunum>
+f0105582:	83 c4 04             	add    $0x4,%esp
+f0105585:	6b c0 78             	imul   $0x78,%eax,%eax
+f0105588:	ff b0 28 60 7d f0    	push   -0xf829fd8(%eax)
+f010558e:	e8 e6 f3 ff ff       	call   f0104979 <env_destroy>
+f0105593:	83 c4 10             	add    $0x10,%esp
+f0105596:	e9 b2 fe ff ff       	jmp    f010544d <sysenter_trap+0xa5>
+	entry.tf_regs.reg_eax = r;
+f010559b:	89 75 c0             	mov    %esi,-0x40(%ebp)
+	if (memcmp(&entry, tf, sizeof(entry)) != 0
+f010559e:	83 ec 04             	sub    $0x4,%esp
+f01055a1:	6a 44                	push   $0x44
+f01055a3:	53                   	push   %ebx
+f01055a4:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+f01055a7:	50                   	push   %eax
+f01055a8:	e8 3b 30 00 00       	call   f01085e8 <memcmp>
+f01055ad:	83 c4 10             	add    $0x10,%esp
+f01055b0:	85 c0                	test   %eax,%eax
+f01055b2:	75 09                	jne    f01055bd <sysenter_trap+0x215>
+	    || (tf->tf_eflags & (FL_IF | FL_TF)))
+f01055b4:	f7 43 38 00 03 00 00 	testl  $0x300,0x38(%ebx)
+f01055bb:	74 16                	je     f01055d3 <sysenter_trap+0x22b>
+		env_run(curenv);
+f01055bd:	e8 75 36 00 00       	call   f0108c37 <cpunum>
+f01055c2:	83 ec 0c             	sub    $0xc,%esp
+f01055c5:	6b c0 78             	imul   $0x78,%eax,%eax
+f01055c8:	ff b0 28 60 7d f0    	push   -0xf829fd8(%eax)
+f01055ce:	e8 45 f4 ff ff       	call   f0104a18 <env_run>
+	curenv->env_runs++;
+f01055d3:	e8 5f 36 00 00       	call   f0108c37 <cpunum>
+f01055d8:	6b c0 78             	imul   $0x78,%eax,%eax
+f01055db:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f01055e1:	83 40 58 01          	addl   $0x1,0x58(%eax)
+	spin_unlock(&kernel_lock);
+f01055e5:	83 ec 0c             	sub    $0xc,%esp
+f01055e8:	68 c0 a3 11 f0       	push   $0xf011a3c0
+f01055ed:	e8 be 3a 00 00       	call   f01090b0 <spin_unlock>
+	asm volatile("pause");
+f01055f2:	f3 90                	pause
+	curenv->env_cpunum = cpunum();
+f01055f4:	e8 3e 36 00 00       	call   f0108c37 <cpunum>
+f01055f9:	6b c0 78             	imul   $0x78,%eax,%eax
+f01055fc:	8b 98 28 60 7d f0    	mov    -0xf829fd8(%eax),%ebx
+f0105602:	e8 30 36 00 00       	call   f0108c37 <cpunum>
+f0105607:	89 43 5c             	mov    %eax,0x5c(%ebx)
+	asm volatile(
+f010560a:	8b 65 94             	mov    -0x6c(%ebp),%esp
+f010560d:	61                   	popa
+f010560e:	07                   	pop    %es
+f010560f:	1f                   	pop    %ds
+f0105610:	83 c4 08             	add    $0x8,%esp
+f0105613:	5a                   	pop    %edx
+f0105614:	83 c4 04             	add    $0x4,%esp
+f0105617:	9d                   	popf
+f0105618:	59                   	pop    %ecx
+f0105619:	0f 35                	sysexit
+	panic("sysexit failed");  /* mostly to placate the compiler */
+f010561b:	83 c4 0c             	add    $0xc,%esp
+f010561e:	68 24 d4 10 f0       	push   $0xf010d424
+f0105623:	68 99 01 00 00       	push   $0x199
+f0105628:	68 11 d4 10 f0       	push   $0xf010d411
+f010562d:	e8 11 aa ff ff       	call   f0100043 <_panic>
+
+f0105632 <page_fault_handler>:
+	}
+}
+
+void
+page_fault_handler(struct Trapframe *tf)
+{
+f0105632:	55                   	push   %ebp
+f0105633:	89 e5                	mov    %esp,%ebp
+f0105635:	57                   	push   %edi
+f0105636:	56                   	push   %esi
+f0105637:	53                   	push   %ebx
+f0105638:	83 ec 5c             	sub    $0x5c,%esp
+	asm volatile("movl %%cr2,%0" : "=r" (val));
+f010563b:	0f 20 d0             	mov    %cr2,%eax
+f010563e:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	// LAB 3: Your code here.
+	// copyin/copyout fault on user memory on purpose.  Load pages of the
+	// env's binary, grow its stack and resolve copy-on-write faults as
+	// if the env had made the access, and send any other fault to the
+	// copy's fixup code.
+	if ((tf->tf_cs & 3) == 0) {
+f0105641:	8b 45 08             	mov    0x8(%ebp),%eax
+f0105644:	f6 40 34 03          	testb  $0x3,0x34(%eax)
+f0105648:	0f 85 cd 00 00 00    	jne    f010571b <page_fault_handler+0xe9>
+		fixup = curenv ? extable_fixup(tf->tf_eip) : 0;
+f010564e:	e8 e4 35 00 00       	call   f0108c37 <cpunum>
+f0105653:	6b c0 78             	imul   $0x78,%eax,%eax
+f0105656:	83 b8 28 60 7d f0 00 	cmpl   $0x0,-0xf829fd8(%eax)
+f010565d:	74 49                	je     f01056a8 <page_fault_handler+0x76>
+f010565f:	83 ec 0c             	sub    $0xc,%esp
+f0105662:	8b 45 08             	mov    0x8(%ebp),%eax
+f0105665:	ff 70 30             	push   0x30(%eax)
+f0105668:	e8 a4 09 00 00       	call   f0106011 <extable_fixup>
+f010566d:	89 c3                	mov    %eax,%ebx
+		if (!fixup)
+f010566f:	83 c4 10             	add    $0x10,%esp
+f0105672:	85 c0                	test   %eax,%eax
+f0105674:	74 32                	je     f01056a8 <page_fault_handler+0x76>
+			panic("kernel page fault va %08x ip %08x",
+			      fault_va, tf->tf_eip);
+		if (!(tf->tf_err & FEC_PR)
+f0105676:	8b 45 08             	mov    0x8(%ebp),%eax
+f0105679:	f6 40 2c 01          	testb  $0x1,0x2c(%eax)
+f010567d:	74 49                	je     f01056c8 <page_fault_handler+0x96>
+		    && (elfcache_fault(curenv, fault_va) == 0
+			|| env_stack_grow(curenv, fault_va) == 0))
+			return;
+		if ((tf->tf_err & FEC_WR) && fault_va < UTOP
+f010567f:	8b 45 08             	mov    0x8(%ebp),%eax
+f0105682:	f6 40 2c 02          	testb  $0x2,0x2c(%eax)
+f0105686:	74 0a                	je     f0105692 <page_fault_handler+0x60>
+f0105688:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f010568b:	3d ff ff bf ee       	cmp    $0xeebfffff,%eax
+f0105690:	76 7b                	jbe    f010570d <page_fault_handler+0xdb>
+		    && page_fault_cow(fault_va) == 0)
+			return;
+		usercopy_fault_va = fault_va;
+f0105692:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f0105695:	a3 a4 4f 79 f0       	mov    %eax,0xf0794fa4
+		tf->tf_eip = fixup;
+f010569a:	8b 45 08             	mov    0x8(%ebp),%eax
+f010569d:	89 58 30             	mov    %ebx,0x30(%eax)
+	// Destroy the environment that caused the fault.
+	cprintf("[%08x] user fault va %08x ip %08x\n",
+		curenv->env_id, fault_va, tf->tf_eip);
+	print_trapframe(tf);
+	env_destroy(curenv);
+}
+f01056a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01056a3:	5b                   	pop    %ebx
+f01056a4:	5e                   	pop    %esi
+f01056a5:	5f                   	pop    %edi
+f01056a6:	5d                   	pop    %ebp
+f01056a7:	c3                   	ret
+			panic("kernel page fault va %08x ip %08x",
+f01056a8:	83 ec 0c             	sub    $0xc,%esp
+f01056ab:	8b 45 08             	mov    0x8(%ebp),%eax
+f01056ae:	ff 70 30             	push   0x30(%eax)
+f01056b1:	ff 75 a4             	push   -0x5c(%ebp)
+f01056b4:	68 cc d5 10 f0       	push   $0xf010d5cc
+f01056b9:	68 3b 02 00 00       	push   $0x23b
+f01056be:	68 11 d4 10 f0       	push   $0xf010d411
+f01056c3:	e8 7b a9 ff ff       	call   f0100043 <_panic>
+		    && (elfcache_fault(curenv, fault_va) == 0
+f01056c8:	e8 6a 35 00 00       	call   f0108c37 <cpunum>
+f01056cd:	83 ec 08             	sub    $0x8,%esp
+f01056d0:	8b 7d a4             	mov    -0x5c(%ebp),%edi
+f01056d3:	57                   	push   %edi
+f01056d4:	6b c0 78             	imul   $0x78,%eax,%eax
+f01056d7:	ff b0 28 60 7d f0    	push   -0xf829fd8(%eax)
+f01056dd:	e8 56 45 00 00       	call   f0109c38 <elfcache_fault>
+f01056e2:	83 c4 10             	add    $0x10,%esp
+f01056e5:	85 c0                	test   %eax,%eax
+f01056e7:	74 b7                	je     f01056a0 <page_fault_handler+0x6e>
+			|| env_stack_grow(curenv, fault_va) == 0))
+f01056e9:	e8 49 35 00 00       	call   f0108c37 <cpunum>
+f01056ee:	83 ec 08             	sub    $0x8,%esp
+f01056f1:	57                   	push   %edi
+f01056f2:	6b c0 78             	imul   $0x78,%eax,%eax
+f01056f5:	ff b0 28 60 7d f0    	push   -0xf829fd8(%eax)
+f01056fb:	e8 31 ef ff ff       	call   f0104631 <env_stack_grow>
+f0105700:	83 c4 10             	add    $0x10,%esp
+f0105703:	85 c0                	test   %eax,%eax
+f0105705:	0f 85 74 ff ff ff    	jne    f010567f <page_fault_handler+0x4d>
+f010570b:	eb 93                	jmp    f01056a0 <page_fault_handler+0x6e>
+		    && page_fault_cow(fault_va) == 0)
+f010570d:	e8 b7 f4 ff ff       	call   f0104bc9 <page_fault_cow>
+f0105712:	85 c0                	test   %eax,%eax
+f0105714:	74 8a                	je     f01056a0 <page_fault_handler+0x6e>
+f0105716:	e9 77 ff ff ff       	jmp    f0105692 <page_fault_handler+0x60>
+	asm volatile("rdtsc" : "=A" (tsc));
+f010571b:	0f 31                	rdtsc
+f010571d:	89 45 98             	mov    %eax,-0x68(%ebp)
+f0105720:	89 55 9c             	mov    %edx,-0x64(%ebp)
+	curenv->env_faults++;
+f0105723:	e8 0f 35 00 00       	call   f0108c37 <cpunum>
+f0105728:	6b c0 78             	imul   $0x78,%eax,%eax
+f010572b:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0105731:	83 80 50 01 00 00 01 	addl   $0x1,0x150(%eax)
+	fault_around_adapt(curenv);
+f0105738:	e8 fa 34 00 00       	call   f0108c37 <cpunum>
+f010573d:	6b c0 78             	imul   $0x78,%eax,%eax
+f0105740:	8b b0 28 60 7d f0    	mov    -0xf829fd8(%eax),%esi
+	if (!e->env_nprefault)
+f0105746:	83 be 60 01 00 00 00 	cmpl   $0x0,0x160(%esi)
+f010574d:	74 7e                	je     f01057cd <page_fault_handler+0x19b>
+	uint32_t i, hits = 0;
+f010574f:	bf 00 00 00 00       	mov    $0x0,%edi
+	for (i = 0; i < e->env_nprefault; i++) {
+f0105754:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0105759:	eb 13                	jmp    f010576e <page_fault_handler+0x13c>
+		if (pte && (*pte & (PTE_P | PTE_D)) == (PTE_P | PTE_D))
+f010575b:	8b 00                	mov    (%eax),%eax
+f010575d:	83 e0 41             	and    $0x41,%eax
+			hits++;
+f0105760:	83 f8 41             	cmp    $0x41,%eax
+f0105763:	0f 94 c0             	sete   %al
+f0105766:	0f b6 c0             	movzbl %al,%eax
+f0105769:	01 c7                	add    %eax,%edi
+	for (i = 0; i < e->env_nprefault; i++) {
+f010576b:	83 c3 01             	add    $0x1,%ebx
+f010576e:	8b 86 60 01 00 00    	mov    0x160(%esi),%eax
+f0105774:	39 c3                	cmp    %eax,%ebx
+f0105776:	73 22                	jae    f010579a <page_fault_handler+0x168>
+		pte = pgdir_walk(e->env_pgdir,
+f0105778:	83 ec 04             	sub    $0x4,%esp
+f010577b:	6a 00                	push   $0x0
+				 (void *) (e->env_prefault_va + i * PGSIZE), 0);
+f010577d:	89 d8                	mov    %ebx,%eax
+f010577f:	c1 e0 0c             	shl    $0xc,%eax
+f0105782:	03 86 64 01 00 00    	add    0x164(%esi),%eax
+		pte = pgdir_walk(e->env_pgdir,
+f0105788:	50                   	push   %eax
+f0105789:	ff 76 60             	push   0x60(%esi)
+f010578c:	e8 b2 bf ff ff       	call   f0101743 <pgdir_walk>
+		if (pte && (*pte & (PTE_P | PTE_D)) == (PTE_P | PTE_D))
+f0105791:	83 c4 10             	add    $0x10,%esp
+f0105794:	85 c0                	test   %eax,%eax
+f0105796:	75 c3                	jne    f010575b <page_fault_handler+0x129>
+f0105798:	eb d1                	jmp    f010576b <page_fault_handler+0x139>
+	e->env_prefault_hits += hits;
+f010579a:	01 be 58 01 00 00    	add    %edi,0x158(%esi)
+	if (2 * hits >= e->env_nprefault)
+f01057a0:	8d 14 3f             	lea    (%edi,%edi,1),%edx
+f01057a3:	39 c2                	cmp    %eax,%edx
+f01057a5:	0f 82 b7 00 00 00    	jb     f0105862 <page_fault_handler+0x230>
+		e->env_fault_around = MIN(2 * e->env_fault_around,
+f01057ab:	8b 86 5c 01 00 00    	mov    0x15c(%esi),%eax
+f01057b1:	01 c0                	add    %eax,%eax
+f01057b3:	ba 10 00 00 00       	mov    $0x10,%edx
+f01057b8:	39 d0                	cmp    %edx,%eax
+f01057ba:	0f 47 c2             	cmova  %edx,%eax
+f01057bd:	89 86 5c 01 00 00    	mov    %eax,0x15c(%esi)
+	e->env_nprefault = 0;
+f01057c3:	c7 86 60 01 00 00 00 	movl   $0x0,0x160(%esi)
+f01057ca:	00 00 00 
+	if (!(tf->tf_err & FEC_PR)
+f01057cd:	8b 45 08             	mov    0x8(%ebp),%eax
+f01057d0:	f6 40 2c 01          	testb  $0x1,0x2c(%eax)
+f01057d4:	0f 84 9d 00 00 00    	je     f0105877 <page_fault_handler+0x245>
+	shared = fault_va < UTOP && (curenv->env_pgdir[PDX(fault_va)] & PTE_COW);
+f01057da:	81 7d a4 ff ff bf ee 	cmpl   $0xeebfffff,-0x5c(%ebp)
+f01057e1:	0f 86 7a 01 00 00    	jbe    f0105961 <page_fault_handler+0x32f>
+	if (curenv->env_pgfault_upcall) {
+f01057e7:	e8 4b 34 00 00       	call   f0108c37 <cpunum>
+f01057ec:	6b c0 78             	imul   $0x78,%eax,%eax
+f01057ef:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f01057f5:	83 78 74 00          	cmpl   $0x0,0x74(%eax)
+f01057f9:	0f 84 39 03 00 00    	je     f0105b38 <page_fault_handler+0x506>
+		if (tf->tf_esp >= UXSTACKTOP - PGSIZE && tf->tf_esp < UXSTACKTOP)
+f01057ff:	8b 45 08             	mov    0x8(%ebp),%eax
+f0105802:	8b 40 3c             	mov    0x3c(%eax),%eax
+f0105805:	8d 90 00 10 40 11    	lea    0x11401000(%eax),%edx
+f010580b:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+f0105811:	0f 87 78 02 00 00    	ja     f0105a8f <page_fault_handler+0x45d>
+		if (top - sizeof(utf) < UXSTACKTOP - PGSIZE) {
+f0105817:	8d 58 c8             	lea    -0x38(%eax),%ebx
+f010581a:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+f0105820:	0f 87 6e 02 00 00    	ja     f0105a94 <page_fault_handler+0x462>
+				curenv->env_id);
+f0105826:	e8 0c 34 00 00       	call   f0108c37 <cpunum>
+			cprintf("[%08x] user exception stack overflow\n",
+f010582b:	83 ec 08             	sub    $0x8,%esp
+				curenv->env_id);
+f010582e:	6b c0 78             	imul   $0x78,%eax,%eax
+			cprintf("[%08x] user exception stack overflow\n",
+f0105831:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0105837:	ff 70 48             	push   0x48(%eax)
+f010583a:	68 1c d6 10 f0       	push   $0xf010d61c
+f010583f:	e8 71 f3 ff ff       	call   f0104bb5 <cprintf>
+			env_destroy(curenv);
+f0105844:	e8 ee 33 00 00       	call   f0108c37 <cpunum>
+f0105849:	83 c4 04             	add    $0x4,%esp
+f010584c:	6b c0 78             	imul   $0x78,%eax,%eax
+f010584f:	ff b0 28 60 7d f0    	push   -0xf829fd8(%eax)
+f0105855:	e8 1f f1 ff ff       	call   f0104979 <env_destroy>
+			return;
+f010585a:	83 c4 10             	add    $0x10,%esp
+f010585d:	e9 3e fe ff ff       	jmp    f01056a0 <page_fault_handler+0x6e>
+		e->env_fault_around = MAX(e->env_fault_around / 2, 1);
+f0105862:	8b 86 5c 01 00 00    	mov    0x15c(%esi),%eax
+f0105868:	d1 e8                	shr    %eax
+f010586a:	ba 01 00 00 00       	mov    $0x1,%edx
+f010586f:	0f 44 c2             	cmove  %edx,%eax
+f0105872:	e9 46 ff ff ff       	jmp    f01057bd <page_fault_handler+0x18b>
+	    && (elfcache_fault(curenv, fault_va) == 0
+f0105877:	e8 bb 33 00 00       	call   f0108c37 <cpunum>
+f010587c:	83 ec 08             	sub    $0x8,%esp
+f010587f:	8b 7d a4             	mov    -0x5c(%ebp),%edi
+f0105882:	57                   	push   %edi
+f0105883:	6b c0 78             	imul   $0x78,%eax,%eax
+f0105886:	ff b0 28 60 7d f0    	push   -0xf829fd8(%eax)
+f010588c:	e8 a7 43 00 00       	call   f0109c38 <elfcache_fault>
+f0105891:	83 c4 10             	add    $0x10,%esp
+f0105894:	85 c0                	test   %eax,%eax
+f0105896:	75 37                	jne    f01058cf <page_fault_handler+0x29d>
+		kfaults++;
+f0105898:	83 05 00 64 7d f0 01 	addl   $0x1,0xf07d6400
+f010589f:	83 15 04 64 7d f0 00 	adcl   $0x0,0xf07d6404
+f01058a6:	0f 31                	rdtsc
+		kfault_cycles += read_tsc() - start;
+f01058a8:	8b 0d f8 63 7d f0    	mov    0xf07d63f8,%ecx
+f01058ae:	8b 1d fc 63 7d f0    	mov    0xf07d63fc,%ebx
+f01058b4:	2b 4d 98             	sub    -0x68(%ebp),%ecx
+f01058b7:	1b 5d 9c             	sbb    -0x64(%ebp),%ebx
+f01058ba:	01 c1                	add    %eax,%ecx
+f01058bc:	11 d3                	adc    %edx,%ebx
+f01058be:	89 0d f8 63 7d f0    	mov    %ecx,0xf07d63f8
+f01058c4:	89 1d fc 63 7d f0    	mov    %ebx,0xf07d63fc
+		return;
+f01058ca:	e9 d1 fd ff ff       	jmp    f01056a0 <page_fault_handler+0x6e>
+		|| env_stack_grow(curenv, fault_va) == 0)) {
+f01058cf:	e8 63 33 00 00       	call   f0108c37 <cpunum>
+f01058d4:	83 ec 08             	sub    $0x8,%esp
+f01058d7:	57                   	push   %edi
+f01058d8:	6b c0 78             	imul   $0x78,%eax,%eax
+f01058db:	ff b0 28 60 7d f0    	push   -0xf829fd8(%eax)
+f01058e1:	e8 4b ed ff ff       	call   f0104631 <env_stack_grow>
+f01058e6:	83 c4 10             	add    $0x10,%esp
+f01058e9:	85 c0                	test   %eax,%eax
+f01058eb:	74 ab                	je     f0105898 <page_fault_handler+0x266>
+	if (!(tf->tf_err & FEC_PR) && env_stack_guard(curenv, fault_va)) {
+f01058ed:	8b 45 08             	mov    0x8(%ebp),%eax
+f01058f0:	f6 40 2c 01          	testb  $0x1,0x2c(%eax)
+f01058f4:	0f 85 e0 fe ff ff    	jne    f01057da <page_fault_handler+0x1a8>
+f01058fa:	e8 38 33 00 00       	call   f0108c37 <cpunum>
+f01058ff:	83 ec 08             	sub    $0x8,%esp
+f0105902:	ff 75 a4             	push   -0x5c(%ebp)
+f0105905:	6b c0 78             	imul   $0x78,%eax,%eax
+f0105908:	ff b0 28 60 7d f0    	push   -0xf829fd8(%eax)
+f010590e:	e8 b8 ed ff ff       	call   f01046cb <env_stack_guard>
+f0105913:	83 c4 10             	add    $0x10,%esp
+f0105916:	84 c0                	test   %al,%al
+f0105918:	0f 84 bc fe ff ff    	je     f01057da <page_fault_handler+0x1a8>
+		cprintf("[%08x] user stack overflow va %08x ip %08x\n",
+f010591e:	8b 45 08             	mov    0x8(%ebp),%eax
+f0105921:	8b 58 30             	mov    0x30(%eax),%ebx
+			curenv->env_id, fault_va, tf->tf_eip);
+f0105924:	e8 0e 33 00 00       	call   f0108c37 <cpunum>
+		cprintf("[%08x] user stack overflow va %08x ip %08x\n",
+f0105929:	53                   	push   %ebx
+f010592a:	ff 75 a4             	push   -0x5c(%ebp)
+			curenv->env_id, fault_va, tf->tf_eip);
+f010592d:	6b c0 78             	imul   $0x78,%eax,%eax
+		cprintf("[%08x] user stack overflow va %08x ip %08x\n",
+f0105930:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0105936:	ff 70 48             	push   0x48(%eax)
+f0105939:	68 f0 d5 10 f0       	push   $0xf010d5f0
+f010593e:	e8 72 f2 ff ff       	call   f0104bb5 <cprintf>
+		env_destroy(curenv);
+f0105943:	e8 ef 32 00 00       	call   f0108c37 <cpunum>
+f0105948:	83 c4 04             	add    $0x4,%esp
+f010594b:	6b c0 78             	imul   $0x78,%eax,%eax
+f010594e:	ff b0 28 60 7d f0    	push   -0xf829fd8(%eax)
+f0105954:	e8 20 f0 ff ff       	call   f0104979 <env_destroy>
+		return;
+f0105959:	83 c4 10             	add    $0x10,%esp
+f010595c:	e9 3f fd ff ff       	jmp    f01056a0 <page_fault_handler+0x6e>
+	shared = fault_va < UTOP && (curenv->env_pgdir[PDX(fault_va)] & PTE_COW);
+f0105961:	e8 d1 32 00 00       	call   f0108c37 <cpunum>
+f0105966:	6b c0 78             	imul   $0x78,%eax,%eax
+f0105969:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f010596f:	8b 4d a4             	mov    -0x5c(%ebp),%ecx
+f0105972:	89 ca                	mov    %ecx,%edx
+f0105974:	c1 ea 16             	shr    $0x16,%edx
+f0105977:	8b 40 60             	mov    0x60(%eax),%eax
+f010597a:	8b 1c 90             	mov    (%eax,%edx,4),%ebx
+	if ((tf->tf_err & FEC_WR) && fault_va < UTOP
+f010597d:	8b 45 08             	mov    0x8(%ebp),%eax
+f0105980:	f6 40 2c 02          	testb  $0x2,0x2c(%eax)
+f0105984:	0f 84 5d fe ff ff    	je     f01057e7 <page_fault_handler+0x1b5>
+	    && page_fault_cow(fault_va) == 0) {
+f010598a:	89 c8                	mov    %ecx,%eax
+f010598c:	e8 38 f2 ff ff       	call   f0104bc9 <page_fault_cow>
+f0105991:	85 c0                	test   %eax,%eax
+f0105993:	0f 85 4e fe ff ff    	jne    f01057e7 <page_fault_handler+0x1b5>
+		if (!shared)
+f0105999:	f6 c7 08             	test   $0x8,%bh
+f010599c:	74 37                	je     f01059d5 <page_fault_handler+0x3a3>
+		kfaults++;
+f010599e:	83 05 00 64 7d f0 01 	addl   $0x1,0xf07d6400
+f01059a5:	83 15 04 64 7d f0 00 	adcl   $0x0,0xf07d6404
+f01059ac:	0f 31                	rdtsc
+		kfault_cycles += read_tsc() - start;
+f01059ae:	8b 0d f8 63 7d f0    	mov    0xf07d63f8,%ecx
+f01059b4:	8b 1d fc 63 7d f0    	mov    0xf07d63fc,%ebx
+f01059ba:	2b 4d 98             	sub    -0x68(%ebp),%ecx
+f01059bd:	1b 5d 9c             	sbb    -0x64(%ebp),%ebx
+f01059c0:	01 c1                	add    %eax,%ecx
+f01059c2:	11 d3                	adc    %edx,%ebx
+f01059c4:	89 0d f8 63 7d f0    	mov    %ecx,0xf07d63f8
+f01059ca:	89 1d fc 63 7d f0    	mov    %ebx,0xf07d63fc
+		return;
+f01059d0:	e9 cb fc ff ff       	jmp    f01056a0 <page_fault_handler+0x6e>
+			fault_around(curenv, fault_va);
+f01059d5:	e8 5d 32 00 00       	call   f0108c37 <cpunum>
+f01059da:	6b c0 78             	imul   $0x78,%eax,%eax
+f01059dd:	8b b0 28 60 7d f0    	mov    -0xf829fd8(%eax),%esi
+	va = ROUNDDOWN(va, PGSIZE) + PGSIZE;
+f01059e3:	8b 4d a4             	mov    -0x5c(%ebp),%ecx
+f01059e6:	89 cb                	mov    %ecx,%ebx
+f01059e8:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+f01059ee:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+	end = MIN(va + e->env_fault_around * PGSIZE,
+f01059f4:	8b 86 5c 01 00 00    	mov    0x15c(%esi),%eax
+f01059fa:	c1 e0 0c             	shl    $0xc,%eax
+f01059fd:	01 d8                	add    %ebx,%eax
+f01059ff:	81 e1 00 00 c0 ff    	and    $0xffc00000,%ecx
+f0105a05:	89 ca                	mov    %ecx,%edx
+f0105a07:	81 c2 00 00 40 00    	add    $0x400000,%edx
+f0105a0d:	39 d0                	cmp    %edx,%eax
+f0105a0f:	0f 46 d0             	cmovbe %eax,%edx
+f0105a12:	89 d7                	mov    %edx,%edi
+	e->env_prefault_va = va;
+f0105a14:	89 9e 64 01 00 00    	mov    %ebx,0x164(%esi)
+	for (; va < end && va < UTOP; va += PGSIZE) {
+f0105a1a:	39 fb                	cmp    %edi,%ebx
+f0105a1c:	73 80                	jae    f010599e <page_fault_handler+0x36c>
+f0105a1e:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+f0105a24:	0f 87 74 ff ff ff    	ja     f010599e <page_fault_handler+0x36c>
+		pp = page_lookup(e->env_pgdir, (void *) va, &pte);
+f0105a2a:	89 5d a4             	mov    %ebx,-0x5c(%ebp)
+f0105a2d:	83 ec 04             	sub    $0x4,%esp
+f0105a30:	8d 45 b4             	lea    -0x4c(%ebp),%eax
+f0105a33:	50                   	push   %eax
+f0105a34:	53                   	push   %ebx
+f0105a35:	ff 76 60             	push   0x60(%esi)
+f0105a38:	e8 4d be ff ff       	call   f010188a <page_lookup>
+		if (!pp || !(*pte & PTE_COW) || (pp->pp_flags & PP_KSM)
+f0105a3d:	83 c4 10             	add    $0x10,%esp
+f0105a40:	85 c0                	test   %eax,%eax
+f0105a42:	0f 84 56 ff ff ff    	je     f010599e <page_fault_handler+0x36c>
+f0105a48:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+f0105a4b:	8b 12                	mov    (%edx),%edx
+f0105a4d:	f6 c6 08             	test   $0x8,%dh
+f0105a50:	0f 84 48 ff ff ff    	je     f010599e <page_fault_handler+0x36c>
+f0105a56:	f6 40 06 01          	testb  $0x1,0x6(%eax)
+f0105a5a:	0f 85 3e ff ff ff    	jne    f010599e <page_fault_handler+0x36c>
+		    || page_cow_break(e->env_pgdir, (void *) va) < 0)
+f0105a60:	83 ec 08             	sub    $0x8,%esp
+f0105a63:	ff 75 a4             	push   -0x5c(%ebp)
+f0105a66:	ff 76 60             	push   0x60(%esi)
+f0105a69:	e8 10 c1 ff ff       	call   f0101b7e <page_cow_break>
+f0105a6e:	83 c4 10             	add    $0x10,%esp
+f0105a71:	85 c0                	test   %eax,%eax
+f0105a73:	0f 88 25 ff ff ff    	js     f010599e <page_fault_handler+0x36c>
+		e->env_nprefault++;
+f0105a79:	83 86 60 01 00 00 01 	addl   $0x1,0x160(%esi)
+		e->env_prefaults++;
+f0105a80:	83 86 54 01 00 00 01 	addl   $0x1,0x154(%esi)
+	for (; va < end && va < UTOP; va += PGSIZE) {
+f0105a87:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0105a8d:	eb 8b                	jmp    f0105a1a <page_fault_handler+0x3e8>
+		if (top - sizeof(utf) < UXSTACKTOP - PGSIZE) {
+f0105a8f:	bb cc ff bf ee       	mov    $0xeebfffcc,%ebx
+		utf.utf_fault_va = fault_va;
+f0105a94:	8b 4d a4             	mov    -0x5c(%ebp),%ecx
+f0105a97:	89 4d b4             	mov    %ecx,-0x4c(%ebp)
+		utf.utf_err = tf->tf_err;
+f0105a9a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0105a9d:	8b 51 2c             	mov    0x2c(%ecx),%edx
+f0105aa0:	89 55 b8             	mov    %edx,-0x48(%ebp)
+		utf.utf_regs = tf->tf_regs;
+f0105aa3:	8d 7d bc             	lea    -0x44(%ebp),%edi
+f0105aa6:	b9 08 00 00 00       	mov    $0x8,%ecx
+f0105aab:	8b 75 08             	mov    0x8(%ebp),%esi
+f0105aae:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+		utf.utf_eip = tf->tf_eip;
+f0105ab0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0105ab3:	8b 51 30             	mov    0x30(%ecx),%edx
+f0105ab6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+		utf.utf_eflags = tf->tf_eflags;
+f0105ab9:	8b 51 38             	mov    0x38(%ecx),%edx
+f0105abc:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		utf.utf_esp = tf->tf_esp;
+f0105abf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		if (copyout((void *) (top - sizeof(utf)), &utf, sizeof(utf)) < 0)
+f0105ac2:	83 ec 04             	sub    $0x4,%esp
+f0105ac5:	6a 34                	push   $0x34
+f0105ac7:	8d 45 b4             	lea    -0x4c(%ebp),%eax
+f0105aca:	50                   	push   %eax
+f0105acb:	53                   	push   %ebx
+f0105acc:	e8 fc 04 00 00       	call   f0105fcd <copyout>
+f0105ad1:	83 c4 10             	add    $0x10,%esp
+f0105ad4:	85 c0                	test   %eax,%eax
+f0105ad6:	78 3e                	js     f0105b16 <page_fault_handler+0x4e4>
+		tf->tf_eip = (uintptr_t) curenv->env_pgfault_upcall;
+f0105ad8:	e8 5a 31 00 00       	call   f0108c37 <cpunum>
+f0105add:	6b c0 78             	imul   $0x78,%eax,%eax
+f0105ae0:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0105ae6:	8b 40 74             	mov    0x74(%eax),%eax
+f0105ae9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0105aec:	89 41 30             	mov    %eax,0x30(%ecx)
+		tf->tf_esp = top - sizeof(utf);
+f0105aef:	89 59 3c             	mov    %ebx,0x3c(%ecx)
+		upcalls++;
+f0105af2:	83 05 f0 63 7d f0 01 	addl   $0x1,0xf07d63f0
+f0105af9:	83 15 f4 63 7d f0 00 	adcl   $0x0,0xf07d63f4
+		env_run(curenv);
+f0105b00:	e8 32 31 00 00       	call   f0108c37 <cpunum>
+f0105b05:	83 ec 0c             	sub    $0xc,%esp
+f0105b08:	6b c0 78             	imul   $0x78,%eax,%eax
+f0105b0b:	ff b0 28 60 7d f0    	push   -0xf829fd8(%eax)
+f0105b11:	e8 02 ef ff ff       	call   f0104a18 <env_run>
+			user_mem_fault(curenv, usercopy_fault_va);
+f0105b16:	8b 35 a4 4f 79 f0    	mov    0xf0794fa4,%esi
+f0105b1c:	e8 16 31 00 00       	call   f0108c37 <cpunum>
+f0105b21:	83 ec 08             	sub    $0x8,%esp
+f0105b24:	56                   	push   %esi
+f0105b25:	6b c0 78             	imul   $0x78,%eax,%eax
+f0105b28:	ff b0 28 60 7d f0    	push   -0xf829fd8(%eax)
+f0105b2e:	e8 61 e1 ff ff       	call   f0103c94 <user_mem_fault>
+f0105b33:	83 c4 10             	add    $0x10,%esp
+f0105b36:	eb a0                	jmp    f0105ad8 <page_fault_handler+0x4a6>
+	cprintf("[%08x] user fault va %08x ip %08x\n",
+f0105b38:	8b 45 08             	mov    0x8(%ebp),%eax
+f0105b3b:	8b 58 30             	mov    0x30(%eax),%ebx
+		curenv->env_id, fault_va, tf->tf_eip);
+f0105b3e:	e8 f4 30 00 00       	call   f0108c37 <cpunum>
+	cprintf("[%08x] user fault va %08x ip %08x\n",
+f0105b43:	53                   	push   %ebx
+f0105b44:	ff 75 a4             	push   -0x5c(%ebp)
+		curenv->env_id, fault_va, tf->tf_eip);
+f0105b47:	6b c0 78             	imul   $0x78,%eax,%eax
+	cprintf("[%08x] user fault va %08x ip %08x\n",
+f0105b4a:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0105b50:	ff 70 48             	push   0x48(%eax)
+f0105b53:	68 44 d6 10 f0       	push   $0xf010d644
+f0105b58:	e8 58 f0 ff ff       	call   f0104bb5 <cprintf>
+	print_trapframe(tf);
+f0105b5d:	83 c4 04             	add    $0x4,%esp
+f0105b60:	ff 75 08             	push   0x8(%ebp)
+f0105b63:	e8 a4 f6 ff ff       	call   f010520c <print_trapframe>
+	env_destroy(curenv);
+f0105b68:	e8 ca 30 00 00       	call   f0108c37 <cpunum>
+f0105b6d:	83 c4 04             	add    $0x4,%esp
+f0105b70:	6b c0 78             	imul   $0x78,%eax,%eax
+f0105b73:	ff b0 28 60 7d f0    	push   -0xf829fd8(%eax)
+f0105b79:	e8 fb ed ff ff       	call   f0104979 <env_destroy>
+f0105b7e:	83 c4 10             	add    $0x10,%esp
+f0105b81:	e9 1a fb ff ff       	jmp    f01056a0 <page_fault_handler+0x6e>
+
+f0105b86 <trap>:
+{
+f0105b86:	55                   	push   %ebp
+f0105b87:	89 e5                	mov    %esp,%ebp
+f0105b89:	57                   	push   %edi
+f0105b8a:	56                   	push   %esi
+f0105b8b:	53                   	push   %ebx
+f0105b8c:	83 ec 1c             	sub    $0x1c,%esp
+f0105b8f:	8b 75 08             	mov    0x8(%ebp),%esi
+	asm volatile("cld" ::: "cc");
+f0105b92:	fc                   	cld
+	if (panicstr)
+f0105b93:	83 3d 00 40 79 f0 00 	cmpl   $0x0,0xf0794000
+f0105b9a:	74 01                	je     f0105b9d <trap+0x17>
+		asm volatile("hlt");
+f0105b9c:	f4                   	hlt
+	if (xchg(&thiscpu->cpu_status, CPU_STARTED) == CPU_HALTED)
+f0105b9d:	e8 95 30 00 00       	call   f0108c37 <cpunum>
+f0105ba2:	6b d0 78             	imul   $0x78,%eax,%edx
+f0105ba5:	83 c2 04             	add    $0x4,%edx
+	asm volatile("lock; xchgl %0, %1"
+f0105ba8:	b8 01 00 00 00       	mov    $0x1,%eax
+f0105bad:	f0 87 82 20 60 7d f0 	lock xchg %eax,-0xf829fe0(%edx)
+f0105bb4:	83 f8 02             	cmp    $0x2,%eax
+f0105bb7:	74 4b                	je     f0105c04 <trap+0x7e>
+	asm volatile("pushfl; popl %0" : "=r" (eflags));
+f0105bb9:	9c                   	pushf
+f0105bba:	58                   	pop    %eax
+	assert(!(read_eflags() & FL_IF));
+f0105bbb:	f6 c4 02             	test   $0x2,%ah
+f0105bbe:	75 56                	jne    f0105c16 <trap+0x90>
+	if ((tf->tf_cs & 3) == 3) {
+f0105bc0:	0f b7 46 34          	movzwl 0x34(%esi),%eax
+f0105bc4:	83 e0 03             	and    $0x3,%eax
+f0105bc7:	66 83 f8 03          	cmp    $0x3,%ax
+f0105bcb:	74 62                	je     f0105c2f <trap+0xa9>
+	last_tf = tf;
+f0105bcd:	89 35 a0 4f 79 f0    	mov    %esi,0xf0794fa0
+  if (tf->tf_trapno == T_PGFLT) {
+f0105bd3:	8b 46 28             	mov    0x28(%esi),%eax
+f0105bd6:	83 f8 0e             	cmp    $0xe,%eax
+f0105bd9:	0f 84 f5 00 00 00    	je     f0105cd4 <trap+0x14e>
+  if (tf->tf_trapno == T_BRKPT) {
+f0105bdf:	83 f8 03             	cmp    $0x3,%eax
+f0105be2:	0f 84 fd 00 00 00    	je     f0105ce5 <trap+0x15f>
+  if (tf->tf_trapno == T_SYSCALL) {
+f0105be8:	8b 46 28             	mov    0x28(%esi),%eax
+f0105beb:	83 f8 30             	cmp    $0x30,%eax
+f0105bee:	0f 84 02 01 00 00    	je     f0105cf6 <trap+0x170>
+	if (tf->tf_trapno == IRQ_OFFSET + IRQ_SPURIOUS) {
+f0105bf4:	83 f8 27             	cmp    $0x27,%eax
+f0105bf7:	0f 87 8c 01 00 00    	ja     f0105d89 <trap+0x203>
+f0105bfd:	ff 24 85 80 d6 10 f0 	jmp    *-0xfef2980(,%eax,4)
+	spin_lock(&kernel_lock);
+f0105c04:	83 ec 0c             	sub    $0xc,%esp
+f0105c07:	68 c0 a3 11 f0       	push   $0xf011a3c0
+f0105c0c:	e8 05 34 00 00       	call   f0109016 <spin_lock>
+}
+f0105c11:	83 c4 10             	add    $0x10,%esp
+f0105c14:	eb a3                	jmp    f0105bb9 <trap+0x33>
+	assert(!(read_eflags() & FL_IF));
+f0105c16:	68 f8 d3 10 f0       	push   $0xf010d3f8
+f0105c1b:	68 bf be 10 f0       	push   $0xf010bebf
+f0105c20:	68 54 01 00 00       	push   $0x154
+f0105c25:	68 11 d4 10 f0       	push   $0xf010d411
+f0105c2a:	e8 14 a4 ff ff       	call   f0100043 <_panic>
+	spin_lock(&kernel_lock);
+f0105c2f:	83 ec 0c             	sub    $0xc,%esp
+f0105c32:	68 c0 a3 11 f0       	push   $0xf011a3c0
+f0105c37:	e8 da 33 00 00       	call   f0109016 <spin_lock>
+		assert(curenv);
+f0105c3c:	e8 f6 2f 00 00       	call   f0108c37 <cpunum>
+f0105c41:	6b c0 78             	imul   $0x78,%eax,%eax
+f0105c44:	83 c4 10             	add    $0x10,%esp
+f0105c47:	83 b8 28 60 7d f0 00 	cmpl   $0x0,-0xf829fd8(%eax)
+f0105c4e:	74 3e                	je     f0105c8e <trap+0x108>
+		if (curenv->env_status == ENV_DYING) {
+f0105c50:	e8 e2 2f 00 00       	call   f0108c37 <cpunum>
+f0105c55:	6b c0 78             	imul   $0x78,%eax,%eax
+f0105c58:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0105c5e:	83 78 54 01          	cmpl   $0x1,0x54(%eax)
+f0105c62:	74 43                	je     f0105ca7 <trap+0x121>
+		curenv->env_tf = *tf;
+f0105c64:	e8 ce 2f 00 00       	call   f0108c37 <cpunum>
+f0105c69:	6b c0 78             	imul   $0x78,%eax,%eax
+f0105c6c:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0105c72:	b9 11 00 00 00       	mov    $0x11,%ecx
+f0105c77:	89 c7                	mov    %eax,%edi
+f0105c79:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+		tf = &curenv->env_tf;
+f0105c7b:	e8 b7 2f 00 00       	call   f0108c37 <cpunum>
+f0105c80:	6b c0 78             	imul   $0x78,%eax,%eax
+f0105c83:	8b b0 28 60 7d f0    	mov    -0xf829fd8(%eax),%esi
+f0105c89:	e9 3f ff ff ff       	jmp    f0105bcd <trap+0x47>
+		assert(curenv);
+f0105c8e:	68 1d d4 10 f0       	push   $0xf010d41d
+f0105c93:	68 bf be 10 f0       	push   $0xf010bebf
+f0105c98:	68 5c 01 00 00       	push   $0x15c
+f0105c9d:	68 11 d4 10 f0       	push   $0xf010d411
+f0105ca2:	e8 9c a3 ff ff       	call   f0100043 <_panic>
+			env_free(curenv);
+f0105ca7:	e8 8b 2f 00 00       	call   f0108c37 <cpunum>
+f0105cac:	83 ec 0c             	sub    $0xc,%esp
+f0105caf:	6b c0 78             	imul   $0x78,%eax,%eax
+f0105cb2:	ff b0 28 60 7d f0    	push   -0xf829fd8(%eax)
+f0105cb8:	e8 42 ea ff ff       	call   f01046ff <env_free>
+			curenv = NULL;
+f0105cbd:	e8 75 2f 00 00       	call   f0108c37 <cpunum>
+f0105cc2:	6b c0 78             	imul   $0x78,%eax,%eax
+f0105cc5:	c7 80 28 60 7d f0 00 	movl   $0x0,-0xf829fd8(%eax)
+f0105ccc:	00 00 00 
+			sched_yield();
+f0105ccf:	e8 5d 04 00 00       	call   f0106131 <sched_yield>
+    page_fault_handler(tf);
+f0105cd4:	83 ec 0c             	sub    $0xc,%esp
+f0105cd7:	56                   	push   %esi
+f0105cd8:	e8 55 f9 ff ff       	call   f0105632 <page_fault_handler>
+    return;
+f0105cdd:	83 c4 10             	add    $0x10,%esp
+f0105ce0:	e9 d0 00 00 00       	jmp    f0105db5 <trap+0x22f>
+    monitor(tf);
+f0105ce5:	83 ec 0c             	sub    $0xc,%esp
+f0105ce8:	56                   	push   %esi
+f0105ce9:	e8 17 ad ff ff       	call   f0100a05 <monitor>
+f0105cee:	83 c4 10             	add    $0x10,%esp
+f0105cf1:	e9 f2 fe ff ff       	jmp    f0105be8 <trap+0x62>
+    uint32_t syscall_num = tf->tf_regs.reg_eax;
+f0105cf6:	8b 46 1c             	mov    0x1c(%esi),%eax
+f0105cf9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    uint32_t arg1 = tf->tf_regs.reg_edx;
+f0105cfc:	8b 5e 14             	mov    0x14(%esi),%ebx
+f0105cff:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+    uint32_t arg2 = tf->tf_regs.reg_ecx;
+f0105d02:	8b 4e 18             	mov    0x18(%esi),%ecx
+f0105d05:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+    uint32_t arg3 = tf->tf_regs.reg_ebx;
+f0105d08:	8b 5e 10             	mov    0x10(%esi),%ebx
+    uint32_t arg4 = tf->tf_regs.reg_edi;
+f0105d0b:	8b 3e                	mov    (%esi),%edi
+f0105d0d:	89 7d d8             	mov    %edi,-0x28(%ebp)
+    uint32_t arg5 = tf->tf_regs.reg_esi;
+f0105d10:	8b 7e 04             	mov    0x4(%esi),%edi
+    futex_tick();
+f0105d13:	e8 0d 54 00 00       	call   f010b125 <futex_tick>
+    tf->tf_regs.reg_eax = syscall(syscall_num, arg1, arg2, arg3, arg4, arg5);
+f0105d18:	83 ec 08             	sub    $0x8,%esp
+f0105d1b:	57                   	push   %edi
+f0105d1c:	ff 75 d8             	push   -0x28(%ebp)
+f0105d1f:	53                   	push   %ebx
+f0105d20:	ff 75 dc             	push   -0x24(%ebp)
+f0105d23:	ff 75 e0             	push   -0x20(%ebp)
+f0105d26:	ff 75 e4             	push   -0x1c(%ebp)
+f0105d29:	e8 52 0c 00 00       	call   f0106980 <syscall>
+f0105d2e:	89 46 1c             	mov    %eax,0x1c(%esi)
+    return;
+f0105d31:	83 c4 20             	add    $0x20,%esp
+f0105d34:	eb 7f                	jmp    f0105db5 <trap+0x22f>
+		cprintf("Spurious interrupt on irq 7\n");
+f0105d36:	83 ec 0c             	sub    $0xc,%esp
+f0105d39:	68 33 d4 10 f0       	push   $0xf010d433
+f0105d3e:	e8 72 ee ff ff       	call   f0104bb5 <cprintf>
+		print_trapframe(tf);
+f0105d43:	89 34 24             	mov    %esi,(%esp)
+f0105d46:	e8 c1 f4 ff ff       	call   f010520c <print_trapframe>
+		return;
+f0105d4b:	83 c4 10             	add    $0x10,%esp
+f0105d4e:	eb 65                	jmp    f0105db5 <trap+0x22f>
+		lapic_eoi();
+f0105d50:	e8 c2 30 00 00       	call   f0108e17 <lapic_eoi>
+		if (cpunum() == 0)
+f0105d55:	e8 dd 2e 00 00       	call   f0108c37 <cpunum>
+f0105d5a:	85 c0                	test   %eax,%eax
+f0105d5c:	74 05                	je     f0105d63 <trap+0x1dd>
+		sched_yield();
+f0105d5e:	e8 ce 03 00 00       	call   f0106131 <sched_yield>
+			time_tick();
+f0105d63:	e8 ef 34 00 00       	call   f0109257 <time_tick>
+f0105d68:	eb f4                	jmp    f0105d5e <trap+0x1d8>
+		lapic_eoi();
+f0105d6a:	e8 a8 30 00 00       	call   f0108e17 <lapic_eoi>
+		kbd_intr();
+f0105d6f:	e8 2f a9 ff ff       	call   f01006a3 <kbd_intr>
+		return;
+f0105d74:	eb 3f                	jmp    f0105db5 <trap+0x22f>
+		lapic_eoi();
+f0105d76:	e8 9c 30 00 00       	call   f0108e17 <lapic_eoi>
+		serial_intr();
+f0105d7b:	e8 07 a9 ff ff       	call   f0100687 <serial_intr>
+		return;
+f0105d80:	eb 33                	jmp    f0105db5 <trap+0x22f>
+	if (tf->tf_trapno == T_DEBUG && tf->tf_cs == GD_KT
+f0105d82:	66 83 7e 34 08       	cmpw   $0x8,0x34(%esi)
+f0105d87:	74 69                	je     f0105df2 <trap+0x26c>
+	print_trapframe(tf);
+f0105d89:	83 ec 0c             	sub    $0xc,%esp
+f0105d8c:	56                   	push   %esi
+f0105d8d:	e8 7a f4 ff ff       	call   f010520c <print_trapframe>
+	if (tf->tf_cs == GD_KT)
+f0105d92:	83 c4 10             	add    $0x10,%esp
+f0105d95:	66 83 7e 34 08       	cmpw   $0x8,0x34(%esi)
+f0105d9a:	74 77                	je     f0105e13 <trap+0x28d>
+		env_destroy(curenv);
+f0105d9c:	e8 96 2e 00 00       	call   f0108c37 <cpunum>
+f0105da1:	83 ec 0c             	sub    $0xc,%esp
+f0105da4:	6b c0 78             	imul   $0x78,%eax,%eax
+f0105da7:	ff b0 28 60 7d f0    	push   -0xf829fd8(%eax)
+f0105dad:	e8 c7 eb ff ff       	call   f0104979 <env_destroy>
+		return;
+f0105db2:	83 c4 10             	add    $0x10,%esp
+	if ((tf->tf_trapno == T_PGFLT || tf->tf_trapno == T_DEBUG)
+f0105db5:	8b 46 28             	mov    0x28(%esi),%eax
+f0105db8:	83 f8 0e             	cmp    $0xe,%eax
+f0105dbb:	74 05                	je     f0105dc2 <trap+0x23c>
+f0105dbd:	83 f8 01             	cmp    $0x1,%eax
+f0105dc0:	75 06                	jne    f0105dc8 <trap+0x242>
+	    && (tf->tf_cs & 3) == 0)
+f0105dc2:	f6 46 34 03          	testb  $0x3,0x34(%esi)
+f0105dc6:	74 78                	je     f0105e40 <trap+0x2ba>
+	if (curenv && curenv->env_status == ENV_RUNNING)
+f0105dc8:	e8 6a 2e 00 00       	call   f0108c37 <cpunum>
+f0105dcd:	6b c0 78             	imul   $0x78,%eax,%eax
+f0105dd0:	83 b8 28 60 7d f0 00 	cmpl   $0x0,-0xf829fd8(%eax)
+f0105dd7:	74 14                	je     f0105ded <trap+0x267>
+f0105dd9:	e8 59 2e 00 00       	call   f0108c37 <cpunum>
+f0105dde:	6b c0 78             	imul   $0x78,%eax,%eax
+f0105de1:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0105de7:	83 78 54 03          	cmpl   $0x3,0x54(%eax)
+f0105deb:	74 3d                	je     f0105e2a <trap+0x2a4>
+		sched_yield();
+f0105ded:	e8 3f 03 00 00       	call   f0106131 <sched_yield>
+	    && tf->tf_eip == (uintptr_t) sysenter_entry) {
+f0105df2:	81 7e 30 f0 5e 10 f0 	cmpl   $0xf0105ef0,0x30(%esi)
+f0105df9:	75 8e                	jne    f0105d89 <trap+0x203>
+		tf->tf_eflags &= ~FL_TF;
+f0105dfb:	81 66 38 ff fe ff ff 	andl   $0xfffffeff,0x38(%esi)
+		thiscpu->cpu_sysenter_tf = 1;
+f0105e02:	e8 30 2e 00 00       	call   f0108c37 <cpunum>
+f0105e07:	6b c0 78             	imul   $0x78,%eax,%eax
+f0105e0a:	c6 80 94 60 7d f0 01 	movb   $0x1,-0xf829f6c(%eax)
+		return;
+f0105e11:	eb a2                	jmp    f0105db5 <trap+0x22f>
+		panic("unhandled trap in kernel");
+f0105e13:	83 ec 04             	sub    $0x4,%esp
+f0105e16:	68 50 d4 10 f0       	push   $0xf010d450
+f0105e1b:	68 3a 01 00 00       	push   $0x13a
+f0105e20:	68 11 d4 10 f0       	push   $0xf010d411
+f0105e25:	e8 19 a2 ff ff       	call   f0100043 <_panic>
+		env_run(curenv);
+f0105e2a:	e8 08 2e 00 00       	call   f0108c37 <cpunum>
+f0105e2f:	83 ec 0c             	sub    $0xc,%esp
+f0105e32:	6b c0 78             	imul   $0x78,%eax,%eax
+f0105e35:	ff b0 28 60 7d f0    	push   -0xf829fd8(%eax)
+f0105e3b:	e8 d8 eb ff ff       	call   f0104a18 <env_run>
+}
+f0105e40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0105e43:	5b                   	pop    %ebx
+f0105e44:	5e                   	pop    %esi
+f0105e45:	5f                   	pop    %edi
+f0105e46:	5d                   	pop    %ebp
+f0105e47:	c3                   	ret
+
+f0105e48 <divide>:
+.text
+
+/*
+ * Lab 3: Your code here for generating entry points for the different traps.
+ */
+TRAPHANDLER_NOEC(divide, T_DIVIDE)
+f0105e48:	6a 00                	push   $0x0
+f0105e4a:	6a 00                	push   $0x0
+f0105e4c:	e9 83 00 00 00       	jmp    f0105ed4 <_alltraps>
+f0105e51:	90                   	nop
+
+f0105e52 <debug>:
+TRAPHANDLER_NOEC(debug, T_DEBUG)
+f0105e52:	6a 00                	push   $0x0
+f0105e54:	6a 01                	push   $0x1
+f0105e56:	eb 7c                	jmp    f0105ed4 <_alltraps>
+
+f0105e58 <nmi>:
+TRAPHANDLER_NOEC(nmi, T_NMI)
+f0105e58:	6a 00                	push   $0x0
+f0105e5a:	6a 02                	push   $0x2
+f0105e5c:	eb 76                	jmp    f0105ed4 <_alltraps>
+
+f0105e5e <brkpt>:
+TRAPHANDLER_NOEC(brkpt, T_BRKPT)
+f0105e5e:	6a 00                	push   $0x0
+f0105e60:	6a 03                	push   $0x3
+f0105e62:	eb 70                	jmp    f0105ed4 <_alltraps>
+
+f0105e64 <oflow>:
+TRAPHANDLER_NOEC(oflow, T_OFLOW)
+f0105e64:	6a 00                	push   $0x0
+f0105e66:	6a 04                	push   $0x4
+f0105e68:	eb 6a                	jmp    f0105ed4 <_alltraps>
+
+f0105e6a <bound>:
+TRAPHANDLER_NOEC(bound, T_BOUND)
+f0105e6a:	6a 00                	push   $0x0
+f0105e6c:	6a 05                	push   $0x5
+f0105e6e:	eb 64                	jmp    f0105ed4 <_alltraps>
+
+f0105e70 <illop>:
+TRAPHANDLER_NOEC(illop, T_ILLOP)
+f0105e70:	6a 00                	push   $0x0
+f0105e72:	6a 06                	push   $0x6
+f0105e74:	eb 5e                	jmp    f0105ed4 <_alltraps>
+
+f0105e76 <device>:
+TRAPHANDLER_NOEC(device, T_DEVICE)
+f0105e76:	6a 00                	push   $0x0
+f0105e78:	6a 07                	push   $0x7
+f0105e7a:	eb 58                	jmp    f0105ed4 <_alltraps>
+
+f0105e7c <dblflt>:
+TRAPHANDLER(dblflt, T_DBLFLT)
+f0105e7c:	6a 08                	push   $0x8
+f0105e7e:	eb 54                	jmp    f0105ed4 <_alltraps>
+
+f0105e80 <tss>:
+TRAPHANDLER(tss, T_TSS)
+f0105e80:	6a 0a                	push   $0xa
+f0105e82:	eb 50                	jmp    f0105ed4 <_alltraps>
+
+f0105e84 <segnp>:
+TRAPHANDLER(segnp, T_SEGNP)
+f0105e84:	6a 0b                	push   $0xb
+f0105e86:	eb 4c                	jmp    f0105ed4 <_alltraps>
+
+f0105e88 <stack>:
+TRAPHANDLER(stack, T_STACK)
+f0105e88:	6a 0c                	push   $0xc
+f0105e8a:	eb 48                	jmp    f0105ed4 <_alltraps>
+
+f0105e8c <gpflt>:
+TRAPHANDLER(gpflt, T_GPFLT)
+f0105e8c:	6a 0d                	push   $0xd
+f0105e8e:	eb 44                	jmp    f0105ed4 <_alltraps>
+
+f0105e90 <pgflt>:
+TRAPHANDLER(pgflt, T_PGFLT)
+f0105e90:	6a 0e                	push   $0xe
+f0105e92:	eb 40                	jmp    f0105ed4 <_alltraps>
+
+f0105e94 <fperr>:
+TRAPHANDLER_NOEC(fperr, T_FPERR)
+f0105e94:	6a 00                	push   $0x0
+f0105e96:	6a 10                	push   $0x10
+f0105e98:	eb 3a                	jmp    f0105ed4 <_alltraps>
+
+f0105e9a <align>:
+TRAPHANDLER_NOEC(align, T_ALIGN)
+f0105e9a:	6a 00                	push   $0x0
+f0105e9c:	6a 11                	push   $0x11
+f0105e9e:	eb 34                	jmp    f0105ed4 <_alltraps>
+
+f0105ea0 <mchk>:
+TRAPHANDLER_NOEC(mchk, T_MCHK)
+f0105ea0:	6a 00                	push   $0x0
+f0105ea2:	6a 12                	push   $0x12
+f0105ea4:	eb 2e                	jmp    f0105ed4 <_alltraps>
+
+f0105ea6 <simderr>:
+TRAPHANDLER_NOEC(simderr, T_SIMDERR)
+f0105ea6:	6a 00                	push   $0x0
+f0105ea8:	6a 13                	push   $0x13
+f0105eaa:	eb 28                	jmp    f0105ed4 <_alltraps>
+
+f0105eac <syscallh>:
+TRAPHANDLER_NOEC(syscallh, T_SYSCALL)
+f0105eac:	6a 00                	push   $0x0
+f0105eae:	6a 30                	push   $0x30
+f0105eb0:	eb 22                	jmp    f0105ed4 <_alltraps>
+
+f0105eb2 <default>:
+TRAPHANDLER_NOEC(default, T_DEFAULT)
+f0105eb2:	6a 00                	push   $0x0
+f0105eb4:	68 f4 01 00 00       	push   $0x1f4
+f0105eb9:	eb 19                	jmp    f0105ed4 <_alltraps>
+f0105ebb:	90                   	nop
+
+f0105ebc <irq_timer>:
+TRAPHANDLER_NOEC(irq_timer, IRQ_OFFSET + IRQ_TIMER)
+f0105ebc:	6a 00                	push   $0x0
+f0105ebe:	6a 20                	push   $0x20
+f0105ec0:	eb 12                	jmp    f0105ed4 <_alltraps>
+
+f0105ec2 <irq_kbd>:
+TRAPHANDLER_NOEC(irq_kbd, IRQ_OFFSET + IRQ_KBD)
+f0105ec2:	6a 00                	push   $0x0
+f0105ec4:	6a 21                	push   $0x21
+f0105ec6:	eb 0c                	jmp    f0105ed4 <_alltraps>
+
+f0105ec8 <irq_serial>:
+TRAPHANDLER_NOEC(irq_serial, IRQ_OFFSET + IRQ_SERIAL)
+f0105ec8:	6a 00                	push   $0x0
+f0105eca:	6a 24                	push   $0x24
+f0105ecc:	eb 06                	jmp    f0105ed4 <_alltraps>
+
+f0105ece <irq_spurious>:
+TRAPHANDLER_NOEC(irq_spurious, IRQ_OFFSET + IRQ_SPURIOUS)
+f0105ece:	6a 00                	push   $0x0
+f0105ed0:	6a 27                	push   $0x27
+f0105ed2:	eb 00                	jmp    f0105ed4 <_alltraps>
+
+f0105ed4 <_alltraps>:
+/*
+ * Lab 3: Your code here for _alltraps
+ */
+.globl _alltraps
+_alltraps:
+  pushl %ds
+f0105ed4:	1e                   	push   %ds
+  pushl %es
+f0105ed5:	06                   	push   %es
+  pushal
+f0105ed6:	60                   	pusha
+
+  mov $(GD_KD), %eax
+f0105ed7:	b8 10 00 00 00       	mov    $0x10,%eax
+  mov %eax, %ds
+f0105edc:	8e d8                	mov    %eax,%ds
+  mov %eax, %es
+f0105ede:	8e c0                	mov    %eax,%es
+
+  pushl %esp
+f0105ee0:	54                   	push   %esp
+
+  call trap
+f0105ee1:	e8 a0 fc ff ff       	call   f0105b86 <trap>
+
+f0105ee6 <trapret>:
+
+  // trap() only returns here after recovering from a page fault in
+  // the kernel (see copyin/copyout); resume the faulting kernel code.
+.globl trapret
+trapret:
+  addl $4, %esp
+f0105ee6:	83 c4 04             	add    $0x4,%esp
+  popal
+f0105ee9:	61                   	popa
+  popl %es
+f0105eea:	07                   	pop    %es
+  popl %ds
+f0105eeb:	1f                   	pop    %ds
+  addl $8, %esp
+f0105eec:	83 c4 08             	add    $0x8,%esp
+  iret
+f0105eef:	cf                   	iret
+
+f0105ef0 <sysenter_entry>:
+ * tf_eip for sysenter_trap to read from the user stack, and hand it
+ * over.  The system call arguments are still in their registers.
+ */
+.globl sysenter_entry
+sysenter_entry:
+  pushl $(GD_UD | 3)
+f0105ef0:	6a 23                	push   $0x23
+  pushl %ebp
+f0105ef2:	55                   	push   %ebp
+  pushfl
+f0105ef3:	9c                   	pushf
+  pushl $(GD_UT | 3)
+f0105ef4:	6a 1b                	push   $0x1b
+  pushl $0
+f0105ef6:	6a 00                	push   $0x0
+  pushl $0
+f0105ef8:	6a 00                	push   $0x0
+  pushl $(T_SYSCALL)
+f0105efa:	6a 30                	push   $0x30
+  pushl %ds
+f0105efc:	1e                   	push   %ds
+  pushl %es
+f0105efd:	06                   	push   %es
+  pushal
+f0105efe:	60                   	pusha
+
+  mov $(GD_KD), %eax
+f0105eff:	b8 10 00 00 00       	mov    $0x10,%eax
+  mov %eax, %ds
+f0105f04:	8e d8                	mov    %eax,%ds
+  mov %eax, %es
+f0105f06:	8e c0                	mov    %eax,%es
+
+  pushl %esp
+f0105f08:	54                   	push   %esp
+  call sysenter_trap
+f0105f09:	e8 9a f4 ff ff       	call   f01053a8 <sysenter_trap>
+
+f0105f0e <copyin>:
+// memory, at the end of the UVPT window: the source must end below
+// UVPT.  No system call needs to read from the window.
+//
+int
+copyin(void *dst, const void *usrc, size_t len)
+{
+f0105f0e:	55                   	push   %ebp
+f0105f0f:	89 e5                	mov    %esp,%ebp
+f0105f11:	83 ec 08             	sub    $0x8,%esp
+f0105f14:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0105f17:	8b 55 10             	mov    0x10(%ebp),%edx
+	if (start + len < start || start + len > limit) {
+f0105f1a:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+f0105f1d:	81 f9 00 00 40 ef    	cmp    $0xef400000,%ecx
+f0105f23:	77 1a                	ja     f0105f3f <copyin+0x31>
+f0105f25:	39 c8                	cmp    %ecx,%eax
+f0105f27:	77 16                	ja     f0105f3f <copyin+0x31>
+	if (!user_range_ok(usrc, len, UVPT) || usercopy(dst, usrc, len))
+f0105f29:	83 ec 04             	sub    $0x4,%esp
+f0105f2c:	52                   	push   %edx
+f0105f2d:	50                   	push   %eax
+f0105f2e:	ff 75 08             	push   0x8(%ebp)
+f0105f31:	e8 02 01 00 00       	call   f0106038 <usercopy>
+f0105f36:	83 c4 10             	add    $0x10,%esp
+f0105f39:	85 c0                	test   %eax,%eax
+f0105f3b:	75 0e                	jne    f0105f4b <copyin+0x3d>
+		return -E_FAULT;
+	return 0;
+}
+f0105f3d:	c9                   	leave
+f0105f3e:	c3                   	ret
+		usercopy_fault_va = start;
+f0105f3f:	a3 a4 4f 79 f0       	mov    %eax,0xf0794fa4
+		return -E_FAULT;
+f0105f44:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+f0105f49:	eb f2                	jmp    f0105f3d <copyin+0x2f>
+f0105f4b:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+f0105f50:	eb eb                	jmp    f0105f3d <copyin+0x2f>
+
+f0105f52 <copyinstr>:
+// Returns the length of the string, -E_FAULT if it is not readable,
+// or -E_INVAL if it does not fit.
+//
+int
+copyinstr(char *dst, const char *usrc, size_t size)
+{
+f0105f52:	55                   	push   %ebp
+f0105f53:	89 e5                	mov    %esp,%ebp
+f0105f55:	57                   	push   %edi
+f0105f56:	56                   	push   %esi
+f0105f57:	53                   	push   %ebx
+f0105f58:	83 ec 0c             	sub    $0xc,%esp
+	size_t len = 0, n;
+f0105f5b:	bb 00 00 00 00       	mov    $0x0,%ebx
+	char *nul;
+
+	while (len < size) {
+f0105f60:	3b 5d 10             	cmp    0x10(%ebp),%ebx
+f0105f63:	73 54                	jae    f0105fb9 <copyinstr+0x67>
+		n = MIN(size - len, PGSIZE - PGOFF(usrc + len));
+f0105f65:	89 d8                	mov    %ebx,%eax
+f0105f67:	03 45 0c             	add    0xc(%ebp),%eax
+f0105f6a:	89 c2                	mov    %eax,%edx
+f0105f6c:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+f0105f72:	be 00 10 00 00       	mov    $0x1000,%esi
+f0105f77:	29 d6                	sub    %edx,%esi
+f0105f79:	8b 55 10             	mov    0x10(%ebp),%edx
+f0105f7c:	29 da                	sub    %ebx,%edx
+f0105f7e:	39 d6                	cmp    %edx,%esi
+f0105f80:	0f 47 f2             	cmova  %edx,%esi
+		if (copyin(dst + len, usrc + len, n) < 0)
+f0105f83:	89 df                	mov    %ebx,%edi
+f0105f85:	03 7d 08             	add    0x8(%ebp),%edi
+f0105f88:	83 ec 04             	sub    $0x4,%esp
+f0105f8b:	56                   	push   %esi
+f0105f8c:	50                   	push   %eax
+f0105f8d:	57                   	push   %edi
+f0105f8e:	e8 7b ff ff ff       	call   f0105f0e <copyin>
+f0105f93:	83 c4 10             	add    $0x10,%esp
+f0105f96:	85 c0                	test   %eax,%eax
+f0105f98:	78 2c                	js     f0105fc6 <copyinstr+0x74>
+			return -E_FAULT;
+		nul = memfind(dst + len, 0, n);
+f0105f9a:	83 ec 04             	sub    $0x4,%esp
+f0105f9d:	56                   	push   %esi
+f0105f9e:	6a 00                	push   $0x0
+f0105fa0:	57                   	push   %edi
+f0105fa1:	e8 7b 26 00 00       	call   f0108621 <memfind>
+		if (nul < dst + len + n)
+f0105fa6:	01 f3                	add    %esi,%ebx
+f0105fa8:	89 da                	mov    %ebx,%edx
+f0105faa:	03 55 08             	add    0x8(%ebp),%edx
+f0105fad:	83 c4 10             	add    $0x10,%esp
+f0105fb0:	39 d0                	cmp    %edx,%eax
+f0105fb2:	73 ac                	jae    f0105f60 <copyinstr+0xe>
+			return nul - dst;
+f0105fb4:	2b 45 08             	sub    0x8(%ebp),%eax
+f0105fb7:	eb 05                	jmp    f0105fbe <copyinstr+0x6c>
+		len += n;
+	}
+	return -E_INVAL;
+f0105fb9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+f0105fbe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0105fc1:	5b                   	pop    %ebx
+f0105fc2:	5e                   	pop    %esi
+f0105fc3:	5f                   	pop    %edi
+f0105fc4:	5d                   	pop    %ebp
+f0105fc5:	c3                   	ret
+			return -E_FAULT;
+f0105fc6:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+f0105fcb:	eb f1                	jmp    f0105fbe <copyinstr+0x6c>
+
+f0105fcd <copyout>:
+// Returns 0 on success, -E_FAULT if any of the destination is not
+// writable by the user (usercopy_fault_va says where).
+//
+int
+copyout(void *udst, const void *src, size_t len)
+{
+f0105fcd:	55                   	push   %ebp
+f0105fce:	89 e5                	mov    %esp,%ebp
+f0105fd0:	83 ec 08             	sub    $0x8,%esp
+f0105fd3:	8b 45 08             	mov    0x8(%ebp),%eax
+f0105fd6:	8b 55 10             	mov    0x10(%ebp),%edx
+	if (start + len < start || start + len > limit) {
+f0105fd9:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+f0105fdc:	81 f9 00 00 c0 ee    	cmp    $0xeec00000,%ecx
+f0105fe2:	77 1a                	ja     f0105ffe <copyout+0x31>
+f0105fe4:	39 c8                	cmp    %ecx,%eax
+f0105fe6:	77 16                	ja     f0105ffe <copyout+0x31>
+	if (!user_range_ok(udst, len, UTOP) || usercopy(udst, src, len))
+f0105fe8:	83 ec 04             	sub    $0x4,%esp
+f0105feb:	52                   	push   %edx
+f0105fec:	ff 75 0c             	push   0xc(%ebp)
+f0105fef:	50                   	push   %eax
+f0105ff0:	e8 43 00 00 00       	call   f0106038 <usercopy>
+f0105ff5:	83 c4 10             	add    $0x10,%esp
+f0105ff8:	85 c0                	test   %eax,%eax
+f0105ffa:	75 0e                	jne    f010600a <copyout+0x3d>
+		return -E_FAULT;
+	return 0;
+}
+f0105ffc:	c9                   	leave
+f0105ffd:	c3                   	ret
+		usercopy_fault_va = start;
+f0105ffe:	a3 a4 4f 79 f0       	mov    %eax,0xf0794fa4
+		return -E_FAULT;
+f0106003:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+f0106008:	eb f2                	jmp    f0105ffc <copyout+0x2f>
+f010600a:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+f010600f:	eb eb                	jmp    f0105ffc <copyout+0x2f>
+
+f0106011 <extable_fixup>:
+// Return the fixup address for a fault at kernel address 'eip', or 0
+// if 'eip' is not in the exception table.
+//
+uintptr_t
+extable_fixup(uintptr_t eip)
+{
+f0106011:	55                   	push   %ebp
+f0106012:	89 e5                	mov    %esp,%ebp
+f0106014:	8b 55 08             	mov    0x8(%ebp),%edx
+	const struct extable_entry *ex;
+
+	for (ex = extable; ex < extable_end; ex++)
+f0106017:	b8 b0 a3 11 f0       	mov    $0xf011a3b0,%eax
+f010601c:	eb 03                	jmp    f0106021 <extable_fixup+0x10>
+f010601e:	83 c0 08             	add    $0x8,%eax
+f0106021:	3d b8 a3 11 f0       	cmp    $0xf011a3b8,%eax
+f0106026:	73 09                	jae    f0106031 <extable_fixup+0x20>
+		if (ex->insn == eip)
+f0106028:	39 10                	cmp    %edx,(%eax)
+f010602a:	75 f2                	jne    f010601e <extable_fixup+0xd>
+			return ex->fixup;
+f010602c:	8b 40 04             	mov    0x4(%eax),%eax
+f010602f:	eb 05                	jmp    f0106036 <extable_fixup+0x25>
+	return 0;
+f0106031:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0106036:	5d                   	pop    %ebp
+f0106037:	c3                   	ret
+
+f0106038 <usercopy>:
+ * in the exception table below and resumes at its fixup.
+ */
+.text
+.globl usercopy
+usercopy:
+	pushl	%esi
+f0106038:	56                   	push   %esi
+	pushl	%edi
+f0106039:	57                   	push   %edi
+	movl	12(%esp), %edi
+f010603a:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+	movl	16(%esp), %esi
+f010603e:	8b 74 24 10          	mov    0x10(%esp),%esi
+	movl	20(%esp), %ecx
+f0106042:	8b 4c 24 14          	mov    0x14(%esp),%ecx
+
+f0106046 <usercopy_insn>:
+usercopy_insn:
+	rep movsb
+f0106046:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+	xorl	%eax, %eax
+f0106048:	31 c0                	xor    %eax,%eax
+	popl	%edi
+f010604a:	5f                   	pop    %edi
+	popl	%esi
+f010604b:	5e                   	pop    %esi
+	ret
+f010604c:	c3                   	ret
+
+f010604d <usercopy_fault>:
+usercopy_fault:
+	movl	$1, %eax
+f010604d:	b8 01 00 00 00       	mov    $0x1,%eax
+	popl	%edi
+f0106052:	5f                   	pop    %edi
+	popl	%esi
+f0106053:	5e                   	pop    %esi
+	ret
+f0106054:	c3                   	ret
+
+f0106055 <sched_halt>:
+// Halt this CPU when there is nothing to do. Wait until the
+// timer interrupt wakes it up. This function never returns.
+//
+void
+sched_halt(void)
+{
+f0106055:	55                   	push   %ebp
+f0106056:	89 e5                	mov    %esp,%ebp
+f0106058:	83 ec 08             	sub    $0x8,%esp
+	int i;
+
+	// For debugging and testing purposes, if there are no runnable
+	// environments in the system, then drop into the kernel monitor.
+	for (i = 0; i < NENV; i++) {
+f010605b:	a1 84 47 79 f0       	mov    0xf0794784,%eax
+f0106060:	8d 50 54             	lea    0x54(%eax),%edx
+f0106063:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if ((envs[i].env_status == ENV_RUNNABLE ||
+		     envs[i].env_status == ENV_RUNNING ||
+f0106068:	8b 02                	mov    (%edx),%eax
+f010606a:	83 e8 01             	sub    $0x1,%eax
+		if ((envs[i].env_status == ENV_RUNNABLE ||
+f010606d:	81 c2 68 01 00 00    	add    $0x168,%edx
+f0106073:	83 f8 02             	cmp    $0x2,%eax
+f0106076:	76 14                	jbe    f010608c <sched_halt+0x37>
+	for (i = 0; i < NENV; i++) {
+f0106078:	83 c1 01             	add    $0x1,%ecx
+f010607b:	81 f9 00 04 00 00    	cmp    $0x400,%ecx
+f0106081:	75 e5                	jne    f0106068 <sched_halt+0x13>
+		     envs[i].env_status == ENV_DYING))
+			break;
+	}
+	// Envs sleeping with a timeout will run again after a few ticks.
+	if (i == NENV && !futex_timers_pending()) {
+f0106083:	e8 60 51 00 00       	call   f010b1e8 <futex_timers_pending>
+f0106088:	84 c0                	test   %al,%al
+f010608a:	74 74                	je     f0106100 <sched_halt+0xab>
+		while (1)
+			monitor(NULL);
+	}
+
+	// Mark that no environment is running on this CPU
+	curenv = NULL;
+f010608c:	e8 a6 2b 00 00       	call   f0108c37 <cpunum>
+f0106091:	6b c0 78             	imul   $0x78,%eax,%eax
+f0106094:	c7 80 28 60 7d f0 00 	movl   $0x0,-0xf829fd8(%eax)
+f010609b:	00 00 00 
+	lcr3(PADDR(kern_pgdir));
+f010609e:	a1 6c 47 79 f0       	mov    0xf079476c,%eax
+	if ((uint32_t)kva < KERNBASE)
+f01060a3:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01060a8:	76 75                	jbe    f010611f <sched_halt+0xca>
+	return (physaddr_t)kva - KERNBASE;
+f01060aa:	05 00 00 00 10       	add    $0x10000000,%eax
+	asm volatile("movl %0,%%cr3" : : "r" (val));
+f01060af:	0f 22 d8             	mov    %eax,%cr3
+
+	// Put the idle time to use merging duplicate user pages.
+	ksm_scan(KSM_SCAN_BATCH);
+f01060b2:	83 ec 0c             	sub    $0xc,%esp
+f01060b5:	6a 40                	push   $0x40
+f01060b7:	e8 73 35 00 00       	call   f010962f <ksm_scan>
+
+	// Mark that this CPU is in the HALT state, so that when
+	// timer interupts come in, we know we should re-acquire the
+	// big kernel lock
+	xchg(&thiscpu->cpu_status, CPU_HALTED);
+f01060bc:	e8 76 2b 00 00       	call   f0108c37 <cpunum>
+f01060c1:	6b d0 78             	imul   $0x78,%eax,%edx
+f01060c4:	83 c2 04             	add    $0x4,%edx
+	asm volatile("lock; xchgl %0, %1"
+f01060c7:	b8 02 00 00 00       	mov    $0x2,%eax
+f01060cc:	f0 87 82 20 60 7d f0 	lock xchg %eax,-0xf829fe0(%edx)
+	spin_unlock(&kernel_lock);
+f01060d3:	c7 04 24 c0 a3 11 f0 	movl   $0xf011a3c0,(%esp)
+f01060da:	e8 d1 2f 00 00       	call   f01090b0 <spin_unlock>
+	asm volatile("pause");
+f01060df:	f3 90                	pause
+		"pushl $0\n"
+		"sti\n"
+		"1:\n"
+		"hlt\n"
+		"jmp 1b\n"
+	: : "a" (thiscpu->cpu_ts.ts_esp0));
+f01060e1:	e8 51 2b 00 00       	call   f0108c37 <cpunum>
+f01060e6:	6b c0 78             	imul   $0x78,%eax,%eax
+	asm volatile (
+f01060e9:	8b 80 30 60 7d f0    	mov    -0xf829fd0(%eax),%eax
+f01060ef:	bd 00 00 00 00       	mov    $0x0,%ebp
+f01060f4:	89 c4                	mov    %eax,%esp
+f01060f6:	6a 00                	push   $0x0
+f01060f8:	6a 00                	push   $0x0
+f01060fa:	fb                   	sti
+f01060fb:	f4                   	hlt
+f01060fc:	eb fd                	jmp    f01060fb <sched_halt+0xa6>
+}
+f01060fe:	c9                   	leave
+f01060ff:	c3                   	ret
+		cprintf("No runnable environments in the system!\n");
+f0106100:	83 ec 0c             	sub    $0xc,%esp
+f0106103:	68 70 d7 10 f0       	push   $0xf010d770
+f0106108:	e8 a8 ea ff ff       	call   f0104bb5 <cprintf>
+f010610d:	83 c4 10             	add    $0x10,%esp
+			monitor(NULL);
+f0106110:	83 ec 0c             	sub    $0xc,%esp
+f0106113:	6a 00                	push   $0x0
+f0106115:	e8 eb a8 ff ff       	call   f0100a05 <monitor>
+f010611a:	83 c4 10             	add    $0x10,%esp
+f010611d:	eb f1                	jmp    f0106110 <sched_halt+0xbb>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f010611f:	50                   	push   %eax
+f0106120:	68 24 be 10 f0       	push   $0xf010be24
+f0106125:	6a 57                	push   $0x57
+f0106127:	68 99 d7 10 f0       	push   $0xf010d799
+f010612c:	e8 12 9f ff ff       	call   f0100043 <_panic>
+
+f0106131 <sched_yield>:
+{
+f0106131:	55                   	push   %ebp
+f0106132:	89 e5                	mov    %esp,%ebp
+f0106134:	57                   	push   %edi
+f0106135:	56                   	push   %esi
+f0106136:	53                   	push   %ebx
+f0106137:	83 ec 1c             	sub    $0x1c,%esp
+  futex_tick();
+f010613a:	e8 e6 4f 00 00       	call   f010b125 <futex_tick>
+f010613f:	be 00 00 00 00       	mov    $0x0,%esi
+  for (int i = 0; i < NENV; i++) { // start at env last running
+f0106144:	bb 00 00 00 00       	mov    $0x0,%ebx
+  int runningEnv = 0;
+f0106149:	bf 00 00 00 00       	mov    $0x0,%edi
+    if (&envs[i] == curenv) {
+f010614e:	89 f0                	mov    %esi,%eax
+f0106150:	03 05 84 47 79 f0    	add    0xf0794784,%eax
+f0106156:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0106159:	e8 d9 2a 00 00       	call   f0108c37 <cpunum>
+f010615e:	6b c0 78             	imul   $0x78,%eax,%eax
+f0106161:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f0106164:	3b 88 28 60 7d f0    	cmp    -0xf829fd8(%eax),%ecx
+f010616a:	0f 44 fb             	cmove  %ebx,%edi
+  for (int i = 0; i < NENV; i++) { // start at env last running
+f010616d:	83 c3 01             	add    $0x1,%ebx
+f0106170:	81 c6 68 01 00 00    	add    $0x168,%esi
+f0106176:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+f010617c:	75 d0                	jne    f010614e <sched_yield+0x1d>
+    if (envs[envNum].env_status == ENV_RUNNABLE) {
+f010617e:	8b 0d 84 47 79 f0    	mov    0xf0794784,%ecx
+f0106184:	89 fa                	mov    %edi,%edx
+  for (int i = runningEnv; i < NENV + runningEnv; i++) {
+f0106186:	81 c7 ff 03 00 00    	add    $0x3ff,%edi
+f010618c:	39 d7                	cmp    %edx,%edi
+f010618e:	7c 2e                	jl     f01061be <sched_yield+0x8d>
+    int envNum = i % NENV;
+f0106190:	89 d3                	mov    %edx,%ebx
+f0106192:	c1 fb 1f             	sar    $0x1f,%ebx
+f0106195:	c1 eb 16             	shr    $0x16,%ebx
+f0106198:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+f010619b:	25 ff 03 00 00       	and    $0x3ff,%eax
+f01061a0:	29 d8                	sub    %ebx,%eax
+    if (envs[envNum].env_status == ENV_RUNNABLE) {
+f01061a2:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+f01061a8:	01 c8                	add    %ecx,%eax
+f01061aa:	83 78 54 02          	cmpl   $0x2,0x54(%eax)
+f01061ae:	74 05                	je     f01061b5 <sched_yield+0x84>
+  for (int i = runningEnv; i < NENV + runningEnv; i++) {
+f01061b0:	83 c2 01             	add    $0x1,%edx
+f01061b3:	eb d7                	jmp    f010618c <sched_yield+0x5b>
+      env_run(&envs[envNum]);
+f01061b5:	83 ec 0c             	sub    $0xc,%esp
+f01061b8:	50                   	push   %eax
+f01061b9:	e8 5a e8 ff ff       	call   f0104a18 <env_run>
+  if (curenv && curenv->env_status == ENV_RUNNING) {
+f01061be:	e8 74 2a 00 00       	call   f0108c37 <cpunum>
+f01061c3:	6b c0 78             	imul   $0x78,%eax,%eax
+f01061c6:	83 b8 28 60 7d f0 00 	cmpl   $0x0,-0xf829fd8(%eax)
+f01061cd:	74 14                	je     f01061e3 <sched_yield+0xb2>
+f01061cf:	e8 63 2a 00 00       	call   f0108c37 <cpunum>
+f01061d4:	6b c0 78             	imul   $0x78,%eax,%eax
+f01061d7:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f01061dd:	83 78 54 03          	cmpl   $0x3,0x54(%eax)
+f01061e1:	74 0d                	je     f01061f0 <sched_yield+0xbf>
+	sched_halt();
+f01061e3:	e8 6d fe ff ff       	call   f0106055 <sched_halt>
+}
+f01061e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01061eb:	5b                   	pop    %ebx
+f01061ec:	5e                   	pop    %esi
+f01061ed:	5f                   	pop    %edi
+f01061ee:	5d                   	pop    %ebp
+f01061ef:	c3                   	ret
+    env_run(curenv);
+f01061f0:	e8 42 2a 00 00       	call   f0108c37 <cpunum>
+f01061f5:	83 ec 0c             	sub    $0xc,%esp
+f01061f8:	6b c0 78             	imul   $0x78,%eax,%eax
+f01061fb:	ff b0 28 60 7d f0    	push   -0xf829fd8(%eax)
+f0106201:	e8 12 e8 ff ff       	call   f0104a18 <env_run>
+
+f0106206 <env_page_alloc>:
+// The vector forms look each environment up once and call these for
+// every page.
+
+static int
+env_page_alloc(struct Env *e, void *va, int perm)
+{
+f0106206:	55                   	push   %ebp
+f0106207:	89 e5                	mov    %esp,%ebp
+f0106209:	57                   	push   %edi
+f010620a:	56                   	push   %esi
+f010620b:	53                   	push   %ebx
+f010620c:	83 ec 1c             	sub    $0x1c,%esp
+f010620f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	struct PageInfo *pp;
+	int zero_fill = perm & PAGE_ZERO_FILL;
+f0106212:	89 ce                	mov    %ecx,%esi
+f0106214:	81 e6 00 10 00 00    	and    $0x1000,%esi
+	int r;
+
+	perm &= ~PAGE_ZERO_FILL;
+f010621a:	89 cf                	mov    %ecx,%edi
+f010621c:	81 e7 ff ef ff ff    	and    $0xffffefff,%edi
+	if ((uintptr_t) va >= UTOP || PGOFF(va))
+f0106222:	81 fa ff ff bf ee    	cmp    $0xeebfffff,%edx
+f0106228:	77 74                	ja     f010629e <env_page_alloc+0x98>
+f010622a:	89 d3                	mov    %edx,%ebx
+f010622c:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+f0106232:	75 71                	jne    f01062a5 <env_page_alloc+0x9f>
+		return -E_INVAL;
+	if ((perm & (PTE_U | PTE_P)) != (PTE_U | PTE_P) || (perm & ~PTE_SYSCALL))
+f0106234:	81 e1 fd e1 ff ff    	and    $0xffffe1fd,%ecx
+f010623a:	83 f9 05             	cmp    $0x5,%ecx
+f010623d:	75 6d                	jne    f01062ac <env_page_alloc+0xa6>
+		return -E_INVAL;
+
+	if (zero_fill)
+f010623f:	85 f6                	test   %esi,%esi
+f0106241:	75 35                	jne    f0106278 <env_page_alloc+0x72>
+		return page_map_zero(e->env_pgdir, va, perm);
+
+	if (!(pp = page_alloc(ALLOC_ZERO)))
+f0106243:	83 ec 0c             	sub    $0xc,%esp
+f0106246:	6a 01                	push   $0x1
+f0106248:	e8 98 af ff ff       	call   f01011e5 <page_alloc>
+f010624d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0106250:	83 c4 10             	add    $0x10,%esp
+f0106253:	85 c0                	test   %eax,%eax
+f0106255:	74 5c                	je     f01062b3 <env_page_alloc+0xad>
+		return -E_NO_MEM;
+	if ((r = page_insert(e->env_pgdir, pp, va, perm)) < 0) {
+f0106257:	57                   	push   %edi
+f0106258:	53                   	push   %ebx
+f0106259:	50                   	push   %eax
+f010625a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010625d:	ff 70 60             	push   0x60(%eax)
+f0106260:	e8 e5 b7 ff ff       	call   f0101a4a <page_insert>
+f0106265:	89 c3                	mov    %eax,%ebx
+f0106267:	83 c4 10             	add    $0x10,%esp
+f010626a:	85 c0                	test   %eax,%eax
+f010626c:	78 1e                	js     f010628c <env_page_alloc+0x86>
+		page_free(pp);
+		return r;
+	}
+	return 0;
+}
+f010626e:	89 f0                	mov    %esi,%eax
+f0106270:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106273:	5b                   	pop    %ebx
+f0106274:	5e                   	pop    %esi
+f0106275:	5f                   	pop    %edi
+f0106276:	5d                   	pop    %ebp
+f0106277:	c3                   	ret
+		return page_map_zero(e->env_pgdir, va, perm);
+f0106278:	83 ec 04             	sub    $0x4,%esp
+f010627b:	57                   	push   %edi
+f010627c:	52                   	push   %edx
+f010627d:	ff 70 60             	push   0x60(%eax)
+f0106280:	e8 7a b8 ff ff       	call   f0101aff <page_map_zero>
+f0106285:	89 c6                	mov    %eax,%esi
+f0106287:	83 c4 10             	add    $0x10,%esp
+f010628a:	eb e2                	jmp    f010626e <env_page_alloc+0x68>
+		page_free(pp);
+f010628c:	83 ec 0c             	sub    $0xc,%esp
+f010628f:	ff 75 e0             	push   -0x20(%ebp)
+f0106292:	e8 d9 af ff ff       	call   f0101270 <page_free>
+		return r;
+f0106297:	83 c4 10             	add    $0x10,%esp
+f010629a:	89 de                	mov    %ebx,%esi
+f010629c:	eb d0                	jmp    f010626e <env_page_alloc+0x68>
+		return -E_INVAL;
+f010629e:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f01062a3:	eb c9                	jmp    f010626e <env_page_alloc+0x68>
+f01062a5:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f01062aa:	eb c2                	jmp    f010626e <env_page_alloc+0x68>
+		return -E_INVAL;
+f01062ac:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f01062b1:	eb bb                	jmp    f010626e <env_page_alloc+0x68>
+		return -E_NO_MEM;
+f01062b3:	be fc ff ff ff       	mov    $0xfffffffc,%esi
+f01062b8:	eb b4                	jmp    f010626e <env_page_alloc+0x68>
+
+f01062ba <env_page_map>:
+
+static int
+env_page_map(struct Env *esrc, void *srcva, struct Env *edst, void *dstva,
+	     int perm)
+{
+f01062ba:	55                   	push   %ebp
+f01062bb:	89 e5                	mov    %esp,%ebp
+f01062bd:	57                   	push   %edi
+f01062be:	56                   	push   %esi
+f01062bf:	53                   	push   %ebx
+f01062c0:	83 ec 2c             	sub    $0x2c,%esp
+f01062c3:	89 c6                	mov    %eax,%esi
+f01062c5:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+f01062c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct PageInfo *pp;
+	pte_t *pte;
+	int move = perm & PAGE_MOVE;
+f01062cb:	89 c7                	mov    %eax,%edi
+f01062cd:	81 e7 00 20 00 00    	and    $0x2000,%edi
+	int r;
+
+	perm &= ~PAGE_MOVE;
+f01062d3:	89 c1                	mov    %eax,%ecx
+f01062d5:	80 e5 df             	and    $0xdf,%ch
+f01062d8:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+	if ((uintptr_t) srcva >= UTOP || PGOFF(srcva)
+f01062db:	81 fa ff ff bf ee    	cmp    $0xeebfffff,%edx
+f01062e1:	77 7b                	ja     f010635e <env_page_map+0xa4>
+f01062e3:	89 d3                	mov    %edx,%ebx
+f01062e5:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+f01062eb:	75 7b                	jne    f0106368 <env_page_map+0xae>
+	    || (uintptr_t) dstva >= UTOP || PGOFF(dstva))
+f01062ed:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+f01062f4:	77 79                	ja     f010636f <env_page_map+0xb5>
+f01062f6:	f7 45 08 ff 0f 00 00 	testl  $0xfff,0x8(%ebp)
+f01062fd:	75 77                	jne    f0106376 <env_page_map+0xbc>
+		return -E_INVAL;
+	if ((perm & (PTE_U | PTE_P)) != (PTE_U | PTE_P) || (perm & ~PTE_SYSCALL))
+f01062ff:	89 c2                	mov    %eax,%edx
+f0106301:	81 e2 fd d1 ff ff    	and    $0xffffd1fd,%edx
+f0106307:	83 fa 05             	cmp    $0x5,%edx
+f010630a:	75 71                	jne    f010637d <env_page_map+0xc3>
+		return -E_INVAL;
+
+	// A page in a page table shared after fork is only writable once
+	// the table is unshared, which may turn it copy-on-write.
+	if ((perm & PTE_W) && (r = pgdir_unshare(esrc->env_pgdir, srcva)) < 0)
+f010630c:	a8 02                	test   $0x2,%al
+f010630e:	0f 84 aa 00 00 00    	je     f01063be <env_page_map+0x104>
+f0106314:	83 ec 08             	sub    $0x8,%esp
+f0106317:	53                   	push   %ebx
+f0106318:	ff 76 60             	push   0x60(%esi)
+f010631b:	e8 92 b2 ff ff       	call   f01015b2 <pgdir_unshare>
+f0106320:	83 c4 10             	add    $0x10,%esp
+f0106323:	85 c0                	test   %eax,%eax
+f0106325:	0f 88 c3 00 00 00    	js     f01063ee <env_page_map+0x134>
+		return r;
+
+	if (!(pp = page_lookup(esrc->env_pgdir, srcva, &pte)))
+f010632b:	83 ec 04             	sub    $0x4,%esp
+f010632e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0106331:	50                   	push   %eax
+f0106332:	53                   	push   %ebx
+f0106333:	ff 76 60             	push   0x60(%esi)
+f0106336:	e8 4f b5 ff ff       	call   f010188a <page_lookup>
+f010633b:	83 c4 10             	add    $0x10,%esp
+f010633e:	85 c0                	test   %eax,%eax
+f0106340:	74 50                	je     f0106392 <env_page_map+0xd8>
+		return -E_INVAL;
+	// A moved copy-on-write page stays copy-on-write (see page_move).
+	if ((perm & PTE_W) && !(*pte & (move ? PTE_W | PTE_COW : PTE_W)))
+f0106342:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0106345:	8b 12                	mov    (%edx),%edx
+f0106347:	85 ff                	test   %edi,%edi
+f0106349:	75 4e                	jne    f0106399 <env_page_map+0xdf>
+f010634b:	f6 c2 02             	test   $0x2,%dl
+f010634e:	0f 85 85 00 00 00    	jne    f01063d9 <env_page_map+0x11f>
+		return -E_INVAL;
+f0106354:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106359:	e9 90 00 00 00       	jmp    f01063ee <env_page_map+0x134>
+		return -E_INVAL;
+f010635e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106363:	e9 86 00 00 00       	jmp    f01063ee <env_page_map+0x134>
+f0106368:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010636d:	eb 7f                	jmp    f01063ee <env_page_map+0x134>
+f010636f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106374:	eb 78                	jmp    f01063ee <env_page_map+0x134>
+f0106376:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010637b:	eb 71                	jmp    f01063ee <env_page_map+0x134>
+		return -E_INVAL;
+f010637d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106382:	eb 6a                	jmp    f01063ee <env_page_map+0x134>
+		return -E_INVAL;
+f0106384:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106389:	eb 63                	jmp    f01063ee <env_page_map+0x134>
+		return -E_INVAL;
+f010638b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106390:	eb 5c                	jmp    f01063ee <env_page_map+0x134>
+f0106392:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106397:	eb 55                	jmp    f01063ee <env_page_map+0x134>
+	if ((perm & PTE_W) && !(*pte & (move ? PTE_W | PTE_COW : PTE_W)))
+f0106399:	f7 c2 02 08 00 00    	test   $0x802,%edx
+f010639f:	74 e3                	je     f0106384 <env_page_map+0xca>
+	if (move)
+		return page_move(esrc->env_pgdir, srcva, edst->env_pgdir,
+f01063a1:	83 ec 0c             	sub    $0xc,%esp
+f01063a4:	ff 75 d4             	push   -0x2c(%ebp)
+f01063a7:	ff 75 08             	push   0x8(%ebp)
+f01063aa:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f01063ad:	ff 70 60             	push   0x60(%eax)
+f01063b0:	53                   	push   %ebx
+f01063b1:	ff 76 60             	push   0x60(%esi)
+f01063b4:	e8 9e b9 ff ff       	call   f0101d57 <page_move>
+f01063b9:	83 c4 20             	add    $0x20,%esp
+f01063bc:	eb 30                	jmp    f01063ee <env_page_map+0x134>
+	if (!(pp = page_lookup(esrc->env_pgdir, srcva, &pte)))
+f01063be:	83 ec 04             	sub    $0x4,%esp
+f01063c1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01063c4:	50                   	push   %eax
+f01063c5:	53                   	push   %ebx
+f01063c6:	ff 76 60             	push   0x60(%esi)
+f01063c9:	e8 bc b4 ff ff       	call   f010188a <page_lookup>
+f01063ce:	83 c4 10             	add    $0x10,%esp
+f01063d1:	85 c0                	test   %eax,%eax
+f01063d3:	74 b6                	je     f010638b <env_page_map+0xd1>
+	if (move)
+f01063d5:	85 ff                	test   %edi,%edi
+f01063d7:	75 c8                	jne    f01063a1 <env_page_map+0xe7>
+				 dstva, perm);
+	return page_insert(edst->env_pgdir, pp, dstva, perm);
+f01063d9:	ff 75 d4             	push   -0x2c(%ebp)
+f01063dc:	ff 75 08             	push   0x8(%ebp)
+f01063df:	50                   	push   %eax
+f01063e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f01063e3:	ff 70 60             	push   0x60(%eax)
+f01063e6:	e8 5f b6 ff ff       	call   f0101a4a <page_insert>
+f01063eb:	83 c4 10             	add    $0x10,%esp
+}
+f01063ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01063f1:	5b                   	pop    %ebx
+f01063f2:	5e                   	pop    %esi
+f01063f3:	5f                   	pop    %edi
+f01063f4:	5d                   	pop    %ebp
+f01063f5:	c3                   	ret
+
+f01063f6 <env_page_unmap>:
+static int
+env_page_unmap(struct Env *e, void *va)
+{
+	int r;
+
+	if ((uintptr_t) va >= UTOP || PGOFF(va))
+f01063f6:	81 fa ff ff bf ee    	cmp    $0xeebfffff,%edx
+f01063fc:	77 54                	ja     f0106452 <env_page_unmap+0x5c>
+{
+f01063fe:	55                   	push   %ebp
+f01063ff:	89 e5                	mov    %esp,%ebp
+f0106401:	56                   	push   %esi
+f0106402:	53                   	push   %ebx
+f0106403:	89 c6                	mov    %eax,%esi
+f0106405:	89 d3                	mov    %edx,%ebx
+	if ((uintptr_t) va >= UTOP || PGOFF(va))
+f0106407:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+f010640d:	75 49                	jne    f0106458 <env_page_unmap+0x62>
+		return -E_INVAL;
+	if (page_lookup(e->env_pgdir, va, 0)
+f010640f:	83 ec 04             	sub    $0x4,%esp
+f0106412:	6a 00                	push   $0x0
+f0106414:	52                   	push   %edx
+f0106415:	ff 70 60             	push   0x60(%eax)
+f0106418:	e8 6d b4 ff ff       	call   f010188a <page_lookup>
+f010641d:	83 c4 10             	add    $0x10,%esp
+f0106420:	85 c0                	test   %eax,%eax
+f0106422:	74 13                	je     f0106437 <env_page_unmap+0x41>
+	    && (r = pgdir_unshare(e->env_pgdir, va)) < 0)
+f0106424:	83 ec 08             	sub    $0x8,%esp
+f0106427:	53                   	push   %ebx
+f0106428:	ff 76 60             	push   0x60(%esi)
+f010642b:	e8 82 b1 ff ff       	call   f01015b2 <pgdir_unshare>
+f0106430:	83 c4 10             	add    $0x10,%esp
+f0106433:	85 c0                	test   %eax,%eax
+f0106435:	78 14                	js     f010644b <env_page_unmap+0x55>
+		return r;
+	page_remove(e->env_pgdir, va);
+f0106437:	83 ec 08             	sub    $0x8,%esp
+f010643a:	53                   	push   %ebx
+f010643b:	ff 76 60             	push   0x60(%esi)
+f010643e:	e8 84 b5 ff ff       	call   f01019c7 <page_remove>
+	return 0;
+f0106443:	83 c4 10             	add    $0x10,%esp
+f0106446:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f010644b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010644e:	5b                   	pop    %ebx
+f010644f:	5e                   	pop    %esi
+f0106450:	5d                   	pop    %ebp
+f0106451:	c3                   	ret
+		return -E_INVAL;
+f0106452:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+f0106457:	c3                   	ret
+		return -E_INVAL;
+f0106458:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010645d:	eb ec                	jmp    f010644b <env_page_unmap+0x55>
+
+f010645f <sys_page_alloc_vec>:
+// sys_page_alloc, plus -E_INVAL if 'n' is too large, -E_FAULT if
+// 'vec' can't be read, and -E_AGAIN as above.
+static int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+f010645f:	55                   	push   %ebp
+f0106460:	89 e5                	mov    %esp,%ebp
+f0106462:	57                   	push   %edi
+f0106463:	56                   	push   %esi
+f0106464:	53                   	push   %ebx
+f0106465:	81 ec 2c 02 00 00    	sub    $0x22c,%esp
+	if (n > PAGE_VEC_MAX)
+f010646b:	83 f9 20             	cmp    $0x20,%ecx
+f010646e:	0f 87 c0 00 00 00    	ja     f0106534 <sys_page_alloc_vec+0xd5>
+f0106474:	89 c3                	mov    %eax,%ebx
+f0106476:	89 cf                	mov    %ecx,%edi
+	return copyin(kvec, vec, n * sizeof(*vec));
+f0106478:	c1 e7 04             	shl    $0x4,%edi
+f010647b:	83 ec 04             	sub    $0x4,%esp
+f010647e:	57                   	push   %edi
+f010647f:	52                   	push   %edx
+f0106480:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+f0106486:	50                   	push   %eax
+f0106487:	e8 82 fa ff ff       	call   f0105f0e <copyin>
+f010648c:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	struct page_range kvec[PAGE_VEC_MAX];
+	struct Env *e;
+	size_t i, j, ndone = 0;
+	int r;
+
+	if ((r = page_vec_fetch(kvec, vec, n)) < 0
+f0106492:	83 c4 10             	add    $0x10,%esp
+	size_t i, j, ndone = 0;
+f0106495:	be 00 00 00 00       	mov    $0x0,%esi
+	if ((r = page_vec_fetch(kvec, vec, n)) < 0
+f010649a:	85 c0                	test   %eax,%eax
+f010649c:	0f 88 a9 00 00 00    	js     f010654b <sys_page_alloc_vec+0xec>
+	    || (r = envid2env(envid, &e, 1)) < 0)
+f01064a2:	83 ec 04             	sub    $0x4,%esp
+f01064a5:	6a 01                	push   $0x1
+f01064a7:	8d 85 e4 fd ff ff    	lea    -0x21c(%ebp),%eax
+f01064ad:	50                   	push   %eax
+f01064ae:	53                   	push   %ebx
+f01064af:	e8 47 d8 ff ff       	call   f0103cfb <envid2env>
+f01064b4:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+f01064ba:	83 c4 10             	add    $0x10,%esp
+f01064bd:	89 c1                	mov    %eax,%ecx
+f01064bf:	85 c0                	test   %eax,%eax
+f01064c1:	0f 88 84 00 00 00    	js     f010654b <sys_page_alloc_vec+0xec>
+f01064c7:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+f01064cd:	8d 14 3b             	lea    (%ebx,%edi,1),%edx
+		goto out;
+	for (i = 0; i < n; i++)
+f01064d0:	39 d3                	cmp    %edx,%ebx
+f01064d2:	74 58                	je     f010652c <sys_page_alloc_vec+0xcd>
+		for (j = 0; j < kvec[i].pr_npages; j++, ndone++)
+f01064d4:	bf 00 00 00 00       	mov    $0x0,%edi
+f01064d9:	89 95 d4 fd ff ff    	mov    %edx,-0x22c(%ebp)
+f01064df:	89 c8                	mov    %ecx,%eax
+f01064e1:	89 d9                	mov    %ebx,%ecx
+f01064e3:	3b 7b 04             	cmp    0x4(%ebx),%edi
+f01064e6:	73 37                	jae    f010651f <sys_page_alloc_vec+0xc0>
+	return ndone < PAGE_VEC_MAXPAGES ? 0 : -E_AGAIN;
+f01064e8:	81 fe ff 03 00 00    	cmp    $0x3ff,%esi
+f01064ee:	77 23                	ja     f0106513 <sys_page_alloc_vec+0xb4>
+			if ((r = page_vec_limit(ndone)) < 0
+			    || (r = env_page_alloc(e, kvec[i].pr_va + j * PGSIZE,
+f01064f0:	8b 41 08             	mov    0x8(%ecx),%eax
+f01064f3:	89 fa                	mov    %edi,%edx
+f01064f5:	c1 e2 0c             	shl    $0xc,%edx
+f01064f8:	03 11                	add    (%ecx),%edx
+f01064fa:	89 c1                	mov    %eax,%ecx
+f01064fc:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+f0106502:	e8 ff fc ff ff       	call   f0106206 <env_page_alloc>
+f0106507:	85 c0                	test   %eax,%eax
+f0106509:	78 3a                	js     f0106545 <sys_page_alloc_vec+0xe6>
+		for (j = 0; j < kvec[i].pr_npages; j++, ndone++)
+f010650b:	83 c7 01             	add    $0x1,%edi
+f010650e:	83 c6 01             	add    $0x1,%esi
+f0106511:	eb ce                	jmp    f01064e1 <sys_page_alloc_vec+0x82>
+	return ndone < PAGE_VEC_MAXPAGES ? 0 : -E_AGAIN;
+f0106513:	c7 85 d4 fd ff ff f4 	movl   $0xfffffff4,-0x22c(%ebp)
+f010651a:	ff ff ff 
+f010651d:	eb 2c                	jmp    f010654b <sys_page_alloc_vec+0xec>
+f010651f:	8b 95 d4 fd ff ff    	mov    -0x22c(%ebp),%edx
+f0106525:	89 c1                	mov    %eax,%ecx
+	for (i = 0; i < n; i++)
+f0106527:	83 c3 10             	add    $0x10,%ebx
+f010652a:	eb a4                	jmp    f01064d0 <sys_page_alloc_vec+0x71>
+f010652c:	89 8d d4 fd ff ff    	mov    %ecx,-0x22c(%ebp)
+f0106532:	eb 17                	jmp    f010654b <sys_page_alloc_vec+0xec>
+		return -E_INVAL;
+f0106534:	c7 85 d4 fd ff ff fd 	movl   $0xfffffffd,-0x22c(%ebp)
+f010653b:	ff ff ff 
+	size_t i, j, ndone = 0;
+f010653e:	be 00 00 00 00       	mov    $0x0,%esi
+f0106543:	eb 06                	jmp    f010654b <sys_page_alloc_vec+0xec>
+f0106545:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+						   kvec[i].pr_perm)) < 0)
+				goto out;
+out:
+	page_vec_done(done, ndone);
+f010654b:	89 b5 e0 fd ff ff    	mov    %esi,-0x220(%ebp)
+	if (done)
+f0106551:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+f0106555:	74 17                	je     f010656e <sys_page_alloc_vec+0x10f>
+		copyout(done, &ndone, sizeof(ndone));
+f0106557:	83 ec 04             	sub    $0x4,%esp
+f010655a:	6a 04                	push   $0x4
+f010655c:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+f0106562:	50                   	push   %eax
+f0106563:	ff 75 08             	push   0x8(%ebp)
+f0106566:	e8 62 fa ff ff       	call   f0105fcd <copyout>
+f010656b:	83 c4 10             	add    $0x10,%esp
+	return r;
+}
+f010656e:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+f0106574:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106577:	5b                   	pop    %ebx
+f0106578:	5e                   	pop    %esi
+f0106579:	5f                   	pop    %edi
+f010657a:	5d                   	pop    %ebp
+f010657b:	c3                   	ret
+
+f010657c <sys_vm_ranges>:
+//		or the caller doesn't have permission to change envid.
+//	-E_INVAL if 'n' is too large.
+//	-E_FAULT if 'ranges' can't be written.
+static int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+f010657c:	55                   	push   %ebp
+f010657d:	89 e5                	mov    %esp,%ebp
+f010657f:	57                   	push   %edi
+f0106580:	56                   	push   %esi
+f0106581:	53                   	push   %ebx
+f0106582:	81 ec 2c 02 00 00    	sub    $0x22c,%esp
+	struct page_range kranges[PAGE_VEC_MAX], *r;
+	struct Env *e;
+	uintptr_t a = (uintptr_t) va;
+f0106588:	89 95 e0 fd ff ff    	mov    %edx,-0x220(%ebp)
+	pte_t *pte;
+	size_t nr = 0;
+	int perm, err;
+
+	if (n > PAGE_VEC_MAX)
+f010658e:	83 7d 08 20          	cmpl   $0x20,0x8(%ebp)
+f0106592:	0f 87 71 01 00 00    	ja     f0106709 <sys_vm_ranges+0x18d>
+f0106598:	89 ce                	mov    %ecx,%esi
+		return -E_INVAL;
+	if ((err = envid2env(envid, &e, 1)) < 0)
+f010659a:	83 ec 04             	sub    $0x4,%esp
+f010659d:	6a 01                	push   $0x1
+f010659f:	8d 95 e4 fd ff ff    	lea    -0x21c(%ebp),%edx
+f01065a5:	52                   	push   %edx
+f01065a6:	50                   	push   %eax
+f01065a7:	e8 4f d7 ff ff       	call   f0103cfb <envid2env>
+f01065ac:	83 c4 10             	add    $0x10,%esp
+f01065af:	85 c0                	test   %eax,%eax
+f01065b1:	0f 88 4a 01 00 00    	js     f0106701 <sys_vm_ranges+0x185>
+	size_t nr = 0;
+f01065b7:	bf 00 00 00 00       	mov    $0x0,%edi
+f01065bc:	89 b5 d4 fd ff ff    	mov    %esi,-0x22c(%ebp)
+f01065c2:	eb 40                	jmp    f0106604 <sys_vm_ranges+0x88>
+		if (r && r->pr_perm == perm
+		    && (uintptr_t) r->pr_va + r->pr_npages * PGSIZE == a) {
+			r->pr_npages++;
+			continue;
+		}
+		if (nr == n)
+f01065c4:	3b 7d 08             	cmp    0x8(%ebp),%edi
+f01065c7:	0f 84 00 01 00 00    	je     f01066cd <sys_vm_ranges+0x151>
+			break;
+		r = &kranges[nr++];
+		r->pr_va = (void *) a;
+f01065cd:	89 f9                	mov    %edi,%ecx
+f01065cf:	c1 e1 04             	shl    $0x4,%ecx
+f01065d2:	89 84 0d e8 fd ff ff 	mov    %eax,-0x218(%ebp,%ecx,1)
+		r->pr_npages = 1;
+f01065d9:	c7 84 0d ec fd ff ff 	movl   $0x1,-0x214(%ebp,%ecx,1)
+f01065e0:	01 00 00 00 
+		r->pr_perm = perm;
+f01065e4:	89 94 0d f0 fd ff ff 	mov    %edx,-0x210(%ebp,%ecx,1)
+		r->pr_dstva = 0;
+f01065eb:	c7 84 0d f4 fd ff ff 	movl   $0x0,-0x20c(%ebp,%ecx,1)
+f01065f2:	00 00 00 00 
+		r = &kranges[nr++];
+f01065f6:	8d 7f 01             	lea    0x1(%edi),%edi
+	     a += PGSIZE) {
+f01065f9:	05 00 10 00 00       	add    $0x1000,%eax
+f01065fe:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+	for (; n > 0 && (pte = pgdir_next_mapped(e->env_pgdir, &a, UTOP));
+f0106604:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+f0106608:	0f 84 ca 00 00 00    	je     f01066d8 <sys_vm_ranges+0x15c>
+f010660e:	83 ec 04             	sub    $0x4,%esp
+f0106611:	68 00 00 c0 ee       	push   $0xeec00000
+f0106616:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+f010661c:	50                   	push   %eax
+f010661d:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+f0106623:	ff 70 60             	push   0x60(%eax)
+f0106626:	e8 c1 b2 ff ff       	call   f01018ec <pgdir_next_mapped>
+f010662b:	83 c4 10             	add    $0x10,%esp
+f010662e:	85 c0                	test   %eax,%eax
+f0106630:	0f 84 8f 00 00 00    	je     f01066c5 <sys_vm_ranges+0x149>
+		perm = *pte & PTE_SYSCALL;
+f0106636:	8b 08                	mov    (%eax),%ecx
+f0106638:	89 ca                	mov    %ecx,%edx
+f010663a:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+		if ((e->env_pgdir[PDX(a)] & PTE_COW) && (perm & PTE_W)
+f0106640:	8b 85 e0 fd ff ff    	mov    -0x220(%ebp),%eax
+f0106646:	89 c6                	mov    %eax,%esi
+f0106648:	c1 ee 16             	shr    $0x16,%esi
+f010664b:	8b 9d e4 fd ff ff    	mov    -0x21c(%ebp),%ebx
+f0106651:	8b 5b 60             	mov    0x60(%ebx),%ebx
+f0106654:	f6 44 b3 01 08       	testb  $0x8,0x1(%ebx,%esi,4)
+f0106659:	74 17                	je     f0106672 <sys_vm_ranges+0xf6>
+		    && !(perm & PTE_SHARE))
+f010665b:	89 cb                	mov    %ecx,%ebx
+f010665d:	81 e3 02 04 00 00    	and    $0x402,%ebx
+			perm = (perm & ~PTE_W) | PTE_COW;
+f0106663:	81 e1 05 06 00 00    	and    $0x605,%ecx
+f0106669:	80 cd 08             	or     $0x8,%ch
+f010666c:	83 fb 02             	cmp    $0x2,%ebx
+f010666f:	0f 44 d1             	cmove  %ecx,%edx
+		r = nr > 0 ? &kranges[nr - 1] : NULL;
+f0106672:	85 ff                	test   %edi,%edi
+f0106674:	0f 84 53 ff ff ff    	je     f01065cd <sys_vm_ranges+0x51>
+f010667a:	8d 4f ff             	lea    -0x1(%edi),%ecx
+		if (r && r->pr_perm == perm
+f010667d:	89 cb                	mov    %ecx,%ebx
+f010667f:	c1 e3 04             	shl    $0x4,%ebx
+f0106682:	39 94 1d f0 fd ff ff 	cmp    %edx,-0x210(%ebp,%ebx,1)
+f0106689:	0f 85 35 ff ff ff    	jne    f01065c4 <sys_vm_ranges+0x48>
+		    && (uintptr_t) r->pr_va + r->pr_npages * PGSIZE == a) {
+f010668f:	89 de                	mov    %ebx,%esi
+f0106691:	8b 9c 1d ec fd ff ff 	mov    -0x214(%ebp,%ebx,1),%ebx
+f0106698:	89 9d d0 fd ff ff    	mov    %ebx,-0x230(%ebp)
+f010669e:	c1 e3 0c             	shl    $0xc,%ebx
+f01066a1:	03 9c 35 e8 fd ff ff 	add    -0x218(%ebp,%esi,1),%ebx
+f01066a8:	39 d8                	cmp    %ebx,%eax
+f01066aa:	0f 85 14 ff ff ff    	jne    f01065c4 <sys_vm_ranges+0x48>
+			r->pr_npages++;
+f01066b0:	8b 95 d0 fd ff ff    	mov    -0x230(%ebp),%edx
+f01066b6:	83 c2 01             	add    $0x1,%edx
+f01066b9:	89 94 35 ec fd ff ff 	mov    %edx,-0x214(%ebp,%esi,1)
+			continue;
+f01066c0:	e9 34 ff ff ff       	jmp    f01065f9 <sys_vm_ranges+0x7d>
+f01066c5:	8b b5 d4 fd ff ff    	mov    -0x22c(%ebp),%esi
+f01066cb:	eb 11                	jmp    f01066de <sys_vm_ranges+0x162>
+f01066cd:	8b b5 d4 fd ff ff    	mov    -0x22c(%ebp),%esi
+f01066d3:	8b 7d 08             	mov    0x8(%ebp),%edi
+f01066d6:	eb 06                	jmp    f01066de <sys_vm_ranges+0x162>
+f01066d8:	8b b5 d4 fd ff ff    	mov    -0x22c(%ebp),%esi
+	}
+
+	if (copyout(ranges, kranges, nr * sizeof(*ranges)) < 0)
+f01066de:	83 ec 04             	sub    $0x4,%esp
+f01066e1:	89 f8                	mov    %edi,%eax
+f01066e3:	c1 e0 04             	shl    $0x4,%eax
+f01066e6:	50                   	push   %eax
+f01066e7:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+f01066ed:	50                   	push   %eax
+f01066ee:	56                   	push   %esi
+f01066ef:	e8 d9 f8 ff ff       	call   f0105fcd <copyout>
+f01066f4:	83 c4 10             	add    $0x10,%esp
+		return -E_FAULT;
+	return nr;
+f01066f7:	85 c0                	test   %eax,%eax
+f01066f9:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+f01066fe:	0f 49 c7             	cmovns %edi,%eax
+}
+f0106701:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106704:	5b                   	pop    %ebx
+f0106705:	5e                   	pop    %esi
+f0106706:	5f                   	pop    %edi
+f0106707:	5d                   	pop    %ebp
+f0106708:	c3                   	ret
+		return -E_INVAL;
+f0106709:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010670e:	eb f1                	jmp    f0106701 <sys_vm_ranges+0x185>
+
+f0106710 <sys_page_unmap_vec>:
+{
+f0106710:	55                   	push   %ebp
+f0106711:	89 e5                	mov    %esp,%ebp
+f0106713:	57                   	push   %edi
+f0106714:	56                   	push   %esi
+f0106715:	53                   	push   %ebx
+f0106716:	81 ec 2c 02 00 00    	sub    $0x22c,%esp
+	if (n > PAGE_VEC_MAX)
+f010671c:	83 f9 20             	cmp    $0x20,%ecx
+f010671f:	0f 87 bd 00 00 00    	ja     f01067e2 <sys_page_unmap_vec+0xd2>
+f0106725:	89 c3                	mov    %eax,%ebx
+f0106727:	89 ce                	mov    %ecx,%esi
+	return copyin(kvec, vec, n * sizeof(*vec));
+f0106729:	c1 e6 04             	shl    $0x4,%esi
+f010672c:	83 ec 04             	sub    $0x4,%esp
+f010672f:	56                   	push   %esi
+f0106730:	52                   	push   %edx
+f0106731:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+f0106737:	50                   	push   %eax
+f0106738:	e8 d1 f7 ff ff       	call   f0105f0e <copyin>
+f010673d:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	if ((r = page_vec_fetch(kvec, vec, n)) < 0
+f0106743:	83 c4 10             	add    $0x10,%esp
+	size_t i, j, ndone = 0;
+f0106746:	bf 00 00 00 00       	mov    $0x0,%edi
+	if ((r = page_vec_fetch(kvec, vec, n)) < 0
+f010674b:	85 c0                	test   %eax,%eax
+f010674d:	0f 88 a6 00 00 00    	js     f01067f9 <sys_page_unmap_vec+0xe9>
+	    || (r = envid2env(envid, &e, 1)) < 0)
+f0106753:	83 ec 04             	sub    $0x4,%esp
+f0106756:	6a 01                	push   $0x1
+f0106758:	8d 85 e4 fd ff ff    	lea    -0x21c(%ebp),%eax
+f010675e:	50                   	push   %eax
+f010675f:	53                   	push   %ebx
+f0106760:	e8 96 d5 ff ff       	call   f0103cfb <envid2env>
+f0106765:	89 c2                	mov    %eax,%edx
+f0106767:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+f010676d:	83 c4 10             	add    $0x10,%esp
+f0106770:	85 c0                	test   %eax,%eax
+f0106772:	0f 88 81 00 00 00    	js     f01067f9 <sys_page_unmap_vec+0xe9>
+f0106778:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+f010677e:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+f0106781:	89 c1                	mov    %eax,%ecx
+	for (i = 0; i < n; i++)
+f0106783:	39 cb                	cmp    %ecx,%ebx
+f0106785:	74 53                	je     f01067da <sys_page_unmap_vec+0xca>
+		for (j = 0; j < kvec[i].pr_npages; j++, ndone++)
+f0106787:	be 00 00 00 00       	mov    $0x0,%esi
+f010678c:	89 8d d4 fd ff ff    	mov    %ecx,-0x22c(%ebp)
+f0106792:	89 d0                	mov    %edx,%eax
+f0106794:	89 d9                	mov    %ebx,%ecx
+f0106796:	3b 73 04             	cmp    0x4(%ebx),%esi
+f0106799:	73 32                	jae    f01067cd <sys_page_unmap_vec+0xbd>
+	return ndone < PAGE_VEC_MAXPAGES ? 0 : -E_AGAIN;
+f010679b:	81 ff ff 03 00 00    	cmp    $0x3ff,%edi
+f01067a1:	77 1e                	ja     f01067c1 <sys_page_unmap_vec+0xb1>
+			    || (r = env_page_unmap(e, kvec[i].pr_va + j * PGSIZE)) < 0)
+f01067a3:	89 f2                	mov    %esi,%edx
+f01067a5:	c1 e2 0c             	shl    $0xc,%edx
+f01067a8:	03 11                	add    (%ecx),%edx
+f01067aa:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+f01067b0:	e8 41 fc ff ff       	call   f01063f6 <env_page_unmap>
+f01067b5:	85 c0                	test   %eax,%eax
+f01067b7:	78 3a                	js     f01067f3 <sys_page_unmap_vec+0xe3>
+		for (j = 0; j < kvec[i].pr_npages; j++, ndone++)
+f01067b9:	83 c6 01             	add    $0x1,%esi
+f01067bc:	83 c7 01             	add    $0x1,%edi
+f01067bf:	eb d3                	jmp    f0106794 <sys_page_unmap_vec+0x84>
+	return ndone < PAGE_VEC_MAXPAGES ? 0 : -E_AGAIN;
+f01067c1:	c7 85 d4 fd ff ff f4 	movl   $0xfffffff4,-0x22c(%ebp)
+f01067c8:	ff ff ff 
+f01067cb:	eb 2c                	jmp    f01067f9 <sys_page_unmap_vec+0xe9>
+f01067cd:	8b 8d d4 fd ff ff    	mov    -0x22c(%ebp),%ecx
+f01067d3:	89 c2                	mov    %eax,%edx
+	for (i = 0; i < n; i++)
+f01067d5:	83 c3 10             	add    $0x10,%ebx
+f01067d8:	eb a9                	jmp    f0106783 <sys_page_unmap_vec+0x73>
+f01067da:	89 95 d4 fd ff ff    	mov    %edx,-0x22c(%ebp)
+f01067e0:	eb 17                	jmp    f01067f9 <sys_page_unmap_vec+0xe9>
+		return -E_INVAL;
+f01067e2:	c7 85 d4 fd ff ff fd 	movl   $0xfffffffd,-0x22c(%ebp)
+f01067e9:	ff ff ff 
+	size_t i, j, ndone = 0;
+f01067ec:	bf 00 00 00 00       	mov    $0x0,%edi
+f01067f1:	eb 06                	jmp    f01067f9 <sys_page_unmap_vec+0xe9>
+f01067f3:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	page_vec_done(done, ndone);
+f01067f9:	89 bd e0 fd ff ff    	mov    %edi,-0x220(%ebp)
+	if (done)
+f01067ff:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+f0106803:	74 17                	je     f010681c <sys_page_unmap_vec+0x10c>
+		copyout(done, &ndone, sizeof(ndone));
+f0106805:	83 ec 04             	sub    $0x4,%esp
+f0106808:	6a 04                	push   $0x4
+f010680a:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+f0106810:	50                   	push   %eax
+f0106811:	ff 75 08             	push   0x8(%ebp)
+f0106814:	e8 b4 f7 ff ff       	call   f0105fcd <copyout>
+f0106819:	83 c4 10             	add    $0x10,%esp
+}
+f010681c:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+f0106822:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106825:	5b                   	pop    %ebx
+f0106826:	5e                   	pop    %esi
+f0106827:	5f                   	pop    %edi
+f0106828:	5d                   	pop    %ebp
+f0106829:	c3                   	ret
+
+f010682a <sys_page_map_vec>:
+{
+f010682a:	55                   	push   %ebp
+f010682b:	89 e5                	mov    %esp,%ebp
+f010682d:	57                   	push   %edi
+f010682e:	56                   	push   %esi
+f010682f:	53                   	push   %ebx
+f0106830:	81 ec 2c 02 00 00    	sub    $0x22c,%esp
+f0106836:	89 95 d0 fd ff ff    	mov    %edx,-0x230(%ebp)
+f010683c:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (n > PAGE_VEC_MAX)
+f010683f:	83 fe 20             	cmp    $0x20,%esi
+f0106842:	0f 87 f0 00 00 00    	ja     f0106938 <sys_page_map_vec+0x10e>
+f0106848:	89 c7                	mov    %eax,%edi
+	return copyin(kvec, vec, n * sizeof(*vec));
+f010684a:	c1 e6 04             	shl    $0x4,%esi
+f010684d:	83 ec 04             	sub    $0x4,%esp
+f0106850:	56                   	push   %esi
+f0106851:	51                   	push   %ecx
+f0106852:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+f0106858:	50                   	push   %eax
+f0106859:	e8 b0 f6 ff ff       	call   f0105f0e <copyin>
+f010685e:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	if ((r = page_vec_fetch(kvec, vec, n)) < 0
+f0106864:	83 c4 10             	add    $0x10,%esp
+	size_t i, j, ndone = 0;
+f0106867:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((r = page_vec_fetch(kvec, vec, n)) < 0
+f010686c:	85 c0                	test   %eax,%eax
+f010686e:	0f 88 db 00 00 00    	js     f010694f <sys_page_map_vec+0x125>
+	    || (r = envid2env(srcenvid, &esrc, 1)) < 0
+f0106874:	83 ec 04             	sub    $0x4,%esp
+f0106877:	6a 01                	push   $0x1
+f0106879:	8d 85 e4 fd ff ff    	lea    -0x21c(%ebp),%eax
+f010687f:	50                   	push   %eax
+f0106880:	57                   	push   %edi
+f0106881:	e8 75 d4 ff ff       	call   f0103cfb <envid2env>
+f0106886:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+f010688c:	83 c4 10             	add    $0x10,%esp
+f010688f:	85 c0                	test   %eax,%eax
+f0106891:	0f 88 b8 00 00 00    	js     f010694f <sys_page_map_vec+0x125>
+	    || (r = envid2env(dstenvid, &edst, 1)) < 0)
+f0106897:	83 ec 04             	sub    $0x4,%esp
+f010689a:	6a 01                	push   $0x1
+f010689c:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+f01068a2:	50                   	push   %eax
+f01068a3:	ff b5 d0 fd ff ff    	push   -0x230(%ebp)
+f01068a9:	e8 4d d4 ff ff       	call   f0103cfb <envid2env>
+f01068ae:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+f01068b4:	83 c4 10             	add    $0x10,%esp
+f01068b7:	85 c0                	test   %eax,%eax
+f01068b9:	0f 88 90 00 00 00    	js     f010694f <sys_page_map_vec+0x125>
+f01068bf:	8d bd e8 fd ff ff    	lea    -0x218(%ebp),%edi
+f01068c5:	8d 14 37             	lea    (%edi,%esi,1),%edx
+	for (i = 0; i < n; i++)
+f01068c8:	39 d7                	cmp    %edx,%edi
+f01068ca:	74 64                	je     f0106930 <sys_page_map_vec+0x106>
+		for (j = 0; j < kvec[i].pr_npages; j++, ndone++)
+f01068cc:	be 00 00 00 00       	mov    $0x0,%esi
+f01068d1:	89 95 d4 fd ff ff    	mov    %edx,-0x22c(%ebp)
+f01068d7:	89 f9                	mov    %edi,%ecx
+f01068d9:	3b 77 04             	cmp    0x4(%edi),%esi
+f01068dc:	73 47                	jae    f0106925 <sys_page_map_vec+0xfb>
+	return ndone < PAGE_VEC_MAXPAGES ? 0 : -E_AGAIN;
+f01068de:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+f01068e4:	77 33                	ja     f0106919 <sys_page_map_vec+0xef>
+f01068e6:	89 f0                	mov    %esi,%eax
+f01068e8:	c1 e0 0c             	shl    $0xc,%eax
+			    || (r = env_page_map(esrc, kvec[i].pr_va + j * PGSIZE,
+f01068eb:	89 c2                	mov    %eax,%edx
+f01068ed:	03 11                	add    (%ecx),%edx
+f01068ef:	83 ec 08             	sub    $0x8,%esp
+f01068f2:	ff 71 08             	push   0x8(%ecx)
+f01068f5:	03 41 0c             	add    0xc(%ecx),%eax
+f01068f8:	50                   	push   %eax
+f01068f9:	8b 8d e0 fd ff ff    	mov    -0x220(%ebp),%ecx
+f01068ff:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+f0106905:	e8 b0 f9 ff ff       	call   f01062ba <env_page_map>
+f010690a:	83 c4 10             	add    $0x10,%esp
+f010690d:	85 c0                	test   %eax,%eax
+f010690f:	78 38                	js     f0106949 <sys_page_map_vec+0x11f>
+		for (j = 0; j < kvec[i].pr_npages; j++, ndone++)
+f0106911:	83 c6 01             	add    $0x1,%esi
+f0106914:	83 c3 01             	add    $0x1,%ebx
+f0106917:	eb be                	jmp    f01068d7 <sys_page_map_vec+0xad>
+	return ndone < PAGE_VEC_MAXPAGES ? 0 : -E_AGAIN;
+f0106919:	c7 85 d4 fd ff ff f4 	movl   $0xfffffff4,-0x22c(%ebp)
+f0106920:	ff ff ff 
+f0106923:	eb 2a                	jmp    f010694f <sys_page_map_vec+0x125>
+f0106925:	8b 95 d4 fd ff ff    	mov    -0x22c(%ebp),%edx
+	for (i = 0; i < n; i++)
+f010692b:	83 c7 10             	add    $0x10,%edi
+f010692e:	eb 98                	jmp    f01068c8 <sys_page_map_vec+0x9e>
+f0106930:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+f0106936:	eb 17                	jmp    f010694f <sys_page_map_vec+0x125>
+		return -E_INVAL;
+f0106938:	c7 85 d4 fd ff ff fd 	movl   $0xfffffffd,-0x22c(%ebp)
+f010693f:	ff ff ff 
+	size_t i, j, ndone = 0;
+f0106942:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0106947:	eb 06                	jmp    f010694f <sys_page_map_vec+0x125>
+f0106949:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	page_vec_done(done, ndone);
+f010694f:	89 9d dc fd ff ff    	mov    %ebx,-0x224(%ebp)
+	if (done)
+f0106955:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+f0106959:	74 17                	je     f0106972 <sys_page_map_vec+0x148>
+		copyout(done, &ndone, sizeof(ndone));
+f010695b:	83 ec 04             	sub    $0x4,%esp
+f010695e:	6a 04                	push   $0x4
+f0106960:	8d 85 dc fd ff ff    	lea    -0x224(%ebp),%eax
+f0106966:	50                   	push   %eax
+f0106967:	ff 75 0c             	push   0xc(%ebp)
+f010696a:	e8 5e f6 ff ff       	call   f0105fcd <copyout>
+f010696f:	83 c4 10             	add    $0x10,%esp
+}
+f0106972:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+f0106978:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010697b:	5b                   	pop    %ebx
+f010697c:	5e                   	pop    %esi
+f010697d:	5f                   	pop    %edi
+f010697e:	5d                   	pop    %ebp
+f010697f:	c3                   	ret
+
+f0106980 <syscall>:
+}
+
+// Dispatches to the correct kernel function, passing the arguments.
+  int32_t
+syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+f0106980:	55                   	push   %ebp
+f0106981:	89 e5                	mov    %esp,%ebp
+f0106983:	57                   	push   %edi
+f0106984:	56                   	push   %esi
+f0106985:	53                   	push   %ebx
+f0106986:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+f010698c:	8b 45 08             	mov    0x8(%ebp),%eax
+  // Call the function corresponding to the 'syscallno' parameter.
+  // Return any appropriate return value.
+  // LAB 3: Your code here.
+  switch (syscallno) {
+f010698f:	83 f8 29             	cmp    $0x29,%eax
+f0106992:	0f 87 5b 0e 00 00    	ja     f01077f3 <syscall+0xe73>
+f0106998:	ff 24 85 f0 d7 10 f0 	jmp    *-0xfef2810(,%eax,4)
+    // add cases for each syscall enum (as in the header file)
+    case SYS_cputs:
+      sys_cputs((const char *) a1, (size_t) a2);
+f010699f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		if (copyin(buf, s, n) < 0)
+f01069a2:	8d bd e8 fe ff ff    	lea    -0x118(%ebp),%edi
+	for (; len > 0; s += n, len -= n) {
+f01069a8:	eb 17                	jmp    f01069c1 <syscall+0x41>
+		cprintf("%.*s", n, buf);
+f01069aa:	83 ec 04             	sub    $0x4,%esp
+f01069ad:	57                   	push   %edi
+f01069ae:	56                   	push   %esi
+f01069af:	68 a6 d7 10 f0       	push   $0xf010d7a6
+f01069b4:	e8 fc e1 ff ff       	call   f0104bb5 <cprintf>
+	for (; len > 0; s += n, len -= n) {
+f01069b9:	01 f3                	add    %esi,%ebx
+f01069bb:	29 75 10             	sub    %esi,0x10(%ebp)
+f01069be:	83 c4 10             	add    $0x10,%esp
+f01069c1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f01069c5:	74 4a                	je     f0106a11 <syscall+0x91>
+		n = MIN(len, sizeof(buf));
+f01069c7:	be 00 01 00 00       	mov    $0x100,%esi
+f01069cc:	39 75 10             	cmp    %esi,0x10(%ebp)
+f01069cf:	0f 46 75 10          	cmovbe 0x10(%ebp),%esi
+		if (copyin(buf, s, n) < 0)
+f01069d3:	83 ec 04             	sub    $0x4,%esp
+f01069d6:	56                   	push   %esi
+f01069d7:	53                   	push   %ebx
+f01069d8:	57                   	push   %edi
+f01069d9:	e8 30 f5 ff ff       	call   f0105f0e <copyin>
+f01069de:	83 c4 10             	add    $0x10,%esp
+f01069e1:	85 c0                	test   %eax,%eax
+f01069e3:	79 c5                	jns    f01069aa <syscall+0x2a>
+			user_mem_fault(curenv, usercopy_fault_va);
+f01069e5:	a1 a4 4f 79 f0       	mov    0xf0794fa4,%eax
+f01069ea:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+f01069f0:	e8 42 22 00 00       	call   f0108c37 <cpunum>
+f01069f5:	83 ec 08             	sub    $0x8,%esp
+f01069f8:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+f01069fe:	6b c0 78             	imul   $0x78,%eax,%eax
+f0106a01:	ff b0 28 60 7d f0    	push   -0xf829fd8(%eax)
+f0106a07:	e8 88 d2 ff ff       	call   f0103c94 <user_mem_fault>
+f0106a0c:	83 c4 10             	add    $0x10,%esp
+f0106a0f:	eb 99                	jmp    f01069aa <syscall+0x2a>
+      return 0;
+f0106a11:	bb 00 00 00 00       	mov    $0x0,%ebx
+          (void *) a4, (int) a5);
+      break;
+    default:
+      return -E_INVAL;
+  }
+}
+f0106a16:	89 d8                	mov    %ebx,%eax
+f0106a18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106a1b:	5b                   	pop    %ebx
+f0106a1c:	5e                   	pop    %esi
+f0106a1d:	5f                   	pop    %edi
+f0106a1e:	5d                   	pop    %ebp
+f0106a1f:	c3                   	ret
+	return cons_getc();
+f0106a20:	e8 90 9c ff ff       	call   f01006b5 <cons_getc>
+f0106a25:	89 c3                	mov    %eax,%ebx
+      return sys_cgetc();
+f0106a27:	eb ed                	jmp    f0106a16 <syscall+0x96>
+	return curenv->env_id;
+f0106a29:	e8 09 22 00 00       	call   f0108c37 <cpunum>
+f0106a2e:	6b c0 78             	imul   $0x78,%eax,%eax
+f0106a31:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0106a37:	8b 58 48             	mov    0x48(%eax),%ebx
+      return sys_getenvid();
+f0106a3a:	eb da                	jmp    f0106a16 <syscall+0x96>
+	if ((r = envid2env(envid, &e, 1)) < 0)
+f0106a3c:	83 ec 04             	sub    $0x4,%esp
+f0106a3f:	6a 01                	push   $0x1
+f0106a41:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0106a47:	50                   	push   %eax
+f0106a48:	ff 75 0c             	push   0xc(%ebp)
+f0106a4b:	e8 ab d2 ff ff       	call   f0103cfb <envid2env>
+f0106a50:	89 c3                	mov    %eax,%ebx
+f0106a52:	83 c4 10             	add    $0x10,%esp
+f0106a55:	85 c0                	test   %eax,%eax
+f0106a57:	78 bd                	js     f0106a16 <syscall+0x96>
+	if (e == curenv)
+f0106a59:	e8 d9 21 00 00       	call   f0108c37 <cpunum>
+f0106a5e:	8b 95 e8 fe ff ff    	mov    -0x118(%ebp),%edx
+f0106a64:	6b c0 78             	imul   $0x78,%eax,%eax
+f0106a67:	39 90 28 60 7d f0    	cmp    %edx,-0xf829fd8(%eax)
+f0106a6d:	74 40                	je     f0106aaf <syscall+0x12f>
+		cprintf("[%08x] destroying %08x\n", curenv->env_id, e->env_id);
+f0106a6f:	8b 5a 48             	mov    0x48(%edx),%ebx
+f0106a72:	e8 c0 21 00 00       	call   f0108c37 <cpunum>
+f0106a77:	83 ec 04             	sub    $0x4,%esp
+f0106a7a:	53                   	push   %ebx
+f0106a7b:	6b c0 78             	imul   $0x78,%eax,%eax
+f0106a7e:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0106a84:	ff 70 48             	push   0x48(%eax)
+f0106a87:	68 c6 d7 10 f0       	push   $0xf010d7c6
+f0106a8c:	e8 24 e1 ff ff       	call   f0104bb5 <cprintf>
+f0106a91:	83 c4 10             	add    $0x10,%esp
+	env_destroy(e);
+f0106a94:	83 ec 0c             	sub    $0xc,%esp
+f0106a97:	ff b5 e8 fe ff ff    	push   -0x118(%ebp)
+f0106a9d:	e8 d7 de ff ff       	call   f0104979 <env_destroy>
+	return 0;
+f0106aa2:	83 c4 10             	add    $0x10,%esp
+f0106aa5:	bb 00 00 00 00       	mov    $0x0,%ebx
+      return sys_env_destroy((envid_t) a1);
+f0106aaa:	e9 67 ff ff ff       	jmp    f0106a16 <syscall+0x96>
+		cprintf("[%08x] exiting gracefully\n", curenv->env_id);
+f0106aaf:	e8 83 21 00 00       	call   f0108c37 <cpunum>
+f0106ab4:	83 ec 08             	sub    $0x8,%esp
+f0106ab7:	6b c0 78             	imul   $0x78,%eax,%eax
+f0106aba:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0106ac0:	ff 70 48             	push   0x48(%eax)
+f0106ac3:	68 ab d7 10 f0       	push   $0xf010d7ab
+f0106ac8:	e8 e8 e0 ff ff       	call   f0104bb5 <cprintf>
+f0106acd:	83 c4 10             	add    $0x10,%esp
+f0106ad0:	eb c2                	jmp    f0106a94 <syscall+0x114>
+  int ret = envid2env(envid, &e, 1);
+f0106ad2:	83 ec 04             	sub    $0x4,%esp
+f0106ad5:	6a 01                	push   $0x1
+f0106ad7:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0106add:	50                   	push   %eax
+f0106ade:	ff 75 0c             	push   0xc(%ebp)
+f0106ae1:	e8 15 d2 ff ff       	call   f0103cfb <envid2env>
+f0106ae6:	89 c3                	mov    %eax,%ebx
+  if (ret < 0) return ret;
+f0106ae8:	83 c4 10             	add    $0x10,%esp
+f0106aeb:	85 c0                	test   %eax,%eax
+f0106aed:	0f 88 23 ff ff ff    	js     f0106a16 <syscall+0x96>
+  return env_page_alloc(e, va, perm);
+f0106af3:	8b 4d 14             	mov    0x14(%ebp),%ecx
+f0106af6:	8b 55 10             	mov    0x10(%ebp),%edx
+f0106af9:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f0106aff:	e8 02 f7 ff ff       	call   f0106206 <env_page_alloc>
+f0106b04:	89 c3                	mov    %eax,%ebx
+      return sys_page_alloc((envid_t) a1, (void *) a2, (int) a3);
+f0106b06:	e9 0b ff ff ff       	jmp    f0106a16 <syscall+0x96>
+  int ret = envid2env(srcenvid, &esrc, 1);
+f0106b0b:	83 ec 04             	sub    $0x4,%esp
+f0106b0e:	6a 01                	push   $0x1
+f0106b10:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+f0106b16:	50                   	push   %eax
+f0106b17:	ff 75 0c             	push   0xc(%ebp)
+f0106b1a:	e8 dc d1 ff ff       	call   f0103cfb <envid2env>
+f0106b1f:	89 c3                	mov    %eax,%ebx
+  if (ret < 0) return ret;
+f0106b21:	83 c4 10             	add    $0x10,%esp
+f0106b24:	85 c0                	test   %eax,%eax
+f0106b26:	0f 88 ea fe ff ff    	js     f0106a16 <syscall+0x96>
+  ret = envid2env(dstenvid, &edest, 1);
+f0106b2c:	83 ec 04             	sub    $0x4,%esp
+f0106b2f:	6a 01                	push   $0x1
+f0106b31:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0106b37:	50                   	push   %eax
+f0106b38:	ff 75 14             	push   0x14(%ebp)
+f0106b3b:	e8 bb d1 ff ff       	call   f0103cfb <envid2env>
+f0106b40:	89 c3                	mov    %eax,%ebx
+  if (ret < 0) return ret;
+f0106b42:	83 c4 10             	add    $0x10,%esp
+f0106b45:	85 c0                	test   %eax,%eax
+f0106b47:	0f 88 c9 fe ff ff    	js     f0106a16 <syscall+0x96>
+  return env_page_map(esrc, srcva, edest, dstva, perm);
+f0106b4d:	83 ec 08             	sub    $0x8,%esp
+f0106b50:	ff 75 1c             	push   0x1c(%ebp)
+f0106b53:	ff 75 18             	push   0x18(%ebp)
+f0106b56:	8b 8d e8 fe ff ff    	mov    -0x118(%ebp),%ecx
+f0106b5c:	8b 55 10             	mov    0x10(%ebp),%edx
+f0106b5f:	8b 85 e4 fe ff ff    	mov    -0x11c(%ebp),%eax
+f0106b65:	e8 50 f7 ff ff       	call   f01062ba <env_page_map>
+f0106b6a:	89 c3                	mov    %eax,%ebx
+f0106b6c:	83 c4 10             	add    $0x10,%esp
+      return sys_page_map((envid_t) a1, (void *) a2, (envid_t) a3,
+f0106b6f:	e9 a2 fe ff ff       	jmp    f0106a16 <syscall+0x96>
+  int ret = envid2env(envid, &e, 1);
+f0106b74:	83 ec 04             	sub    $0x4,%esp
+f0106b77:	6a 01                	push   $0x1
+f0106b79:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0106b7f:	50                   	push   %eax
+f0106b80:	ff 75 0c             	push   0xc(%ebp)
+f0106b83:	e8 73 d1 ff ff       	call   f0103cfb <envid2env>
+f0106b88:	89 c3                	mov    %eax,%ebx
+  if (ret < 0) return ret;
+f0106b8a:	83 c4 10             	add    $0x10,%esp
+f0106b8d:	85 c0                	test   %eax,%eax
+f0106b8f:	0f 88 81 fe ff ff    	js     f0106a16 <syscall+0x96>
+  return env_page_unmap(e, va);
+f0106b95:	8b 55 10             	mov    0x10(%ebp),%edx
+f0106b98:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f0106b9e:	e8 53 f8 ff ff       	call   f01063f6 <env_page_unmap>
+f0106ba3:	89 c3                	mov    %eax,%ebx
+      return sys_page_unmap((envid_t) a1, (void *) a2);
+f0106ba5:	e9 6c fe ff ff       	jmp    f0106a16 <syscall+0x96>
+      sched_yield();
+f0106baa:	e8 82 f5 ff ff       	call   f0106131 <sched_yield>
+  int ret = env_alloc(&e, curenv->env_id);
+f0106baf:	e8 83 20 00 00       	call   f0108c37 <cpunum>
+f0106bb4:	83 ec 08             	sub    $0x8,%esp
+f0106bb7:	6b c0 78             	imul   $0x78,%eax,%eax
+f0106bba:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0106bc0:	ff 70 48             	push   0x48(%eax)
+f0106bc3:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0106bc9:	50                   	push   %eax
+f0106bca:	e8 50 d2 ff ff       	call   f0103e1f <env_alloc>
+f0106bcf:	89 c3                	mov    %eax,%ebx
+  if (ret < 0)
+f0106bd1:	83 c4 10             	add    $0x10,%esp
+f0106bd4:	85 c0                	test   %eax,%eax
+f0106bd6:	0f 88 3a fe ff ff    	js     f0106a16 <syscall+0x96>
+  e->env_status = ENV_NOT_RUNNABLE;
+f0106bdc:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f0106be2:	c7 40 54 04 00 00 00 	movl   $0x4,0x54(%eax)
+  e->env_tf = curenv->env_tf;
+f0106be9:	e8 49 20 00 00       	call   f0108c37 <cpunum>
+f0106bee:	6b c0 78             	imul   $0x78,%eax,%eax
+f0106bf1:	8b b0 28 60 7d f0    	mov    -0xf829fd8(%eax),%esi
+f0106bf7:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f0106bfd:	b9 11 00 00 00       	mov    $0x11,%ecx
+f0106c02:	89 c7                	mov    %eax,%edi
+f0106c04:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  e->env_tf.tf_regs.reg_eax = 0;
+f0106c06:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  e->env_binary = curenv->env_binary;
+f0106c0d:	e8 25 20 00 00       	call   f0108c37 <cpunum>
+f0106c12:	6b c0 78             	imul   $0x78,%eax,%eax
+f0106c15:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0106c1b:	8b 50 64             	mov    0x64(%eax),%edx
+f0106c1e:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f0106c24:	89 50 64             	mov    %edx,0x64(%eax)
+  e->env_stack_limit = curenv->env_stack_limit;
+f0106c27:	e8 0b 20 00 00       	call   f0108c37 <cpunum>
+f0106c2c:	8b 95 e8 fe ff ff    	mov    -0x118(%ebp),%edx
+f0106c32:	6b c0 78             	imul   $0x78,%eax,%eax
+f0106c35:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0106c3b:	8b 40 70             	mov    0x70(%eax),%eax
+f0106c3e:	89 42 70             	mov    %eax,0x70(%edx)
+  return e->env_id;
+f0106c41:	8b 5a 48             	mov    0x48(%edx),%ebx
+      return sys_exofork();
+f0106c44:	e9 cd fd ff ff       	jmp    f0106a16 <syscall+0x96>
+  if (status != ENV_RUNNABLE && status != ENV_NOT_RUNNABLE) {
+f0106c49:	8b 45 10             	mov    0x10(%ebp),%eax
+f0106c4c:	83 e8 02             	sub    $0x2,%eax
+f0106c4f:	a9 fd ff ff ff       	test   $0xfffffffd,%eax
+f0106c54:	75 7b                	jne    f0106cd1 <syscall+0x351>
+  int ret = envid2env(envid, &e, 1);
+f0106c56:	83 ec 04             	sub    $0x4,%esp
+f0106c59:	6a 01                	push   $0x1
+f0106c5b:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0106c61:	50                   	push   %eax
+f0106c62:	ff 75 0c             	push   0xc(%ebp)
+f0106c65:	e8 91 d0 ff ff       	call   f0103cfb <envid2env>
+f0106c6a:	89 c3                	mov    %eax,%ebx
+  if (ret < 0)
+f0106c6c:	83 c4 10             	add    $0x10,%esp
+f0106c6f:	85 c0                	test   %eax,%eax
+f0106c71:	0f 88 9f fd ff ff    	js     f0106a16 <syscall+0x96>
+  if (env_blocked(e))
+f0106c77:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+    return -E_AGAIN;
+f0106c7d:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+		|| e->env_ep_waiting;
+f0106c82:	83 b8 3c 01 00 00 00 	cmpl   $0x0,0x13c(%eax)
+f0106c89:	0f 85 87 fd ff ff    	jne    f0106a16 <syscall+0x96>
+	return e->env_futex_pa || e->env_ipc_sendto || e->env_ipc_recving
+f0106c8f:	83 b8 b0 00 00 00 00 	cmpl   $0x0,0xb0(%eax)
+f0106c96:	0f 85 7a fd ff ff    	jne    f0106a16 <syscall+0x96>
+f0106c9c:	80 78 78 00          	cmpb   $0x0,0x78(%eax)
+f0106ca0:	0f 85 70 fd ff ff    	jne    f0106a16 <syscall+0x96>
+		|| e->env_ipc_replyfrom || e->env_ep_sendto
+f0106ca6:	83 b8 e4 00 00 00 00 	cmpl   $0x0,0xe4(%eax)
+f0106cad:	0f 85 63 fd ff ff    	jne    f0106a16 <syscall+0x96>
+f0106cb3:	8b 98 30 01 00 00    	mov    0x130(%eax),%ebx
+f0106cb9:	85 db                	test   %ebx,%ebx
+f0106cbb:	75 1e                	jne    f0106cdb <syscall+0x35b>
+  if (env_blocked(e))
+f0106cbd:	80 b8 2c 01 00 00 00 	cmpb   $0x0,0x12c(%eax)
+f0106cc4:	75 1f                	jne    f0106ce5 <syscall+0x365>
+  e->env_status = status;
+f0106cc6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f0106cc9:	89 48 54             	mov    %ecx,0x54(%eax)
+  return 0;
+f0106ccc:	e9 45 fd ff ff       	jmp    f0106a16 <syscall+0x96>
+    return -E_INVAL;
+f0106cd1:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0106cd6:	e9 3b fd ff ff       	jmp    f0106a16 <syscall+0x96>
+    return -E_AGAIN;
+f0106cdb:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+f0106ce0:	e9 31 fd ff ff       	jmp    f0106a16 <syscall+0x96>
+f0106ce5:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+      return sys_env_set_status((envid_t) a1, (int) a2);
+f0106cea:	e9 27 fd ff ff       	jmp    f0106a16 <syscall+0x96>
+      return sys_page_alloc_vec((envid_t) a1, (const struct page_range *) a2,
+f0106cef:	83 ec 0c             	sub    $0xc,%esp
+f0106cf2:	ff 75 18             	push   0x18(%ebp)
+f0106cf5:	8b 4d 14             	mov    0x14(%ebp),%ecx
+f0106cf8:	8b 55 10             	mov    0x10(%ebp),%edx
+f0106cfb:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0106cfe:	e8 5c f7 ff ff       	call   f010645f <sys_page_alloc_vec>
+f0106d03:	89 c3                	mov    %eax,%ebx
+f0106d05:	83 c4 10             	add    $0x10,%esp
+f0106d08:	e9 09 fd ff ff       	jmp    f0106a16 <syscall+0x96>
+      return sys_page_map_vec((envid_t) a1, (envid_t) a2,
+f0106d0d:	83 ec 08             	sub    $0x8,%esp
+f0106d10:	ff 75 1c             	push   0x1c(%ebp)
+f0106d13:	ff 75 18             	push   0x18(%ebp)
+f0106d16:	8b 4d 14             	mov    0x14(%ebp),%ecx
+f0106d19:	8b 55 10             	mov    0x10(%ebp),%edx
+f0106d1c:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0106d1f:	e8 06 fb ff ff       	call   f010682a <sys_page_map_vec>
+f0106d24:	89 c3                	mov    %eax,%ebx
+f0106d26:	83 c4 10             	add    $0x10,%esp
+f0106d29:	e9 e8 fc ff ff       	jmp    f0106a16 <syscall+0x96>
+      return sys_page_unmap_vec((envid_t) a1, (const struct page_range *) a2,
+f0106d2e:	83 ec 0c             	sub    $0xc,%esp
+f0106d31:	ff 75 18             	push   0x18(%ebp)
+f0106d34:	8b 4d 14             	mov    0x14(%ebp),%ecx
+f0106d37:	8b 55 10             	mov    0x10(%ebp),%edx
+f0106d3a:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0106d3d:	e8 ce f9 ff ff       	call   f0106710 <sys_page_unmap_vec>
+f0106d42:	89 c3                	mov    %eax,%ebx
+f0106d44:	83 c4 10             	add    $0x10,%esp
+f0106d47:	e9 ca fc ff ff       	jmp    f0106a16 <syscall+0x96>
+      return sys_vm_ranges((envid_t) a1, (void *) a2, (struct page_range *) a3,
+f0106d4c:	83 ec 0c             	sub    $0xc,%esp
+f0106d4f:	ff 75 18             	push   0x18(%ebp)
+f0106d52:	8b 4d 14             	mov    0x14(%ebp),%ecx
+f0106d55:	8b 55 10             	mov    0x10(%ebp),%edx
+f0106d58:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0106d5b:	e8 1c f8 ff ff       	call   f010657c <sys_vm_ranges>
+f0106d60:	89 c3                	mov    %eax,%ebx
+f0106d62:	83 c4 10             	add    $0x10,%esp
+f0106d65:	e9 ac fc ff ff       	jmp    f0106a16 <syscall+0x96>
+	if ((r = envid2env(envid, &e, 1)) < 0)
+f0106d6a:	83 ec 04             	sub    $0x4,%esp
+f0106d6d:	6a 01                	push   $0x1
+f0106d6f:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+f0106d75:	50                   	push   %eax
+f0106d76:	ff 75 0c             	push   0xc(%ebp)
+f0106d79:	e8 7d cf ff ff       	call   f0103cfb <envid2env>
+f0106d7e:	89 c3                	mov    %eax,%ebx
+f0106d80:	83 c4 10             	add    $0x10,%esp
+f0106d83:	85 c0                	test   %eax,%eax
+f0106d85:	0f 88 8b fc ff ff    	js     f0106a16 <syscall+0x96>
+	if ((r = copyin(&ktf, tf, sizeof(ktf))) < 0)
+f0106d8b:	83 ec 04             	sub    $0x4,%esp
+f0106d8e:	6a 44                	push   $0x44
+f0106d90:	ff 75 10             	push   0x10(%ebp)
+f0106d93:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0106d99:	50                   	push   %eax
+f0106d9a:	e8 6f f1 ff ff       	call   f0105f0e <copyin>
+f0106d9f:	89 c3                	mov    %eax,%ebx
+f0106da1:	83 c4 10             	add    $0x10,%esp
+f0106da4:	85 c0                	test   %eax,%eax
+f0106da6:	0f 88 6a fc ff ff    	js     f0106a16 <syscall+0x96>
+	ktf.tf_ds = GD_UD | 3;
+f0106dac:	66 c7 85 0c ff ff ff 	movw   $0x23,-0xf4(%ebp)
+f0106db3:	23 00 
+	ktf.tf_es = GD_UD | 3;
+f0106db5:	66 c7 85 08 ff ff ff 	movw   $0x23,-0xf8(%ebp)
+f0106dbc:	23 00 
+	ktf.tf_ss = GD_UD | 3;
+f0106dbe:	66 c7 85 28 ff ff ff 	movw   $0x23,-0xd8(%ebp)
+f0106dc5:	23 00 
+	ktf.tf_cs = GD_UT | 3;
+f0106dc7:	66 c7 85 1c ff ff ff 	movw   $0x1b,-0xe4(%ebp)
+f0106dce:	1b 00 
+	ktf.tf_eflags &= ~(FL_IOPL_MASK | FL_IF);
+f0106dd0:	81 a5 20 ff ff ff ff 	andl   $0xffffcdff,-0xe0(%ebp)
+f0106dd7:	cd ff ff 
+	e->env_tf = ktf;
+f0106dda:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+f0106de0:	b9 11 00 00 00       	mov    $0x11,%ecx
+f0106de5:	8b bd e4 fe ff ff    	mov    -0x11c(%ebp),%edi
+f0106deb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	if (e != curenv)
+f0106ded:	e8 45 1e 00 00       	call   f0108c37 <cpunum>
+f0106df2:	8b 95 e4 fe ff ff    	mov    -0x11c(%ebp),%edx
+f0106df8:	6b c0 78             	imul   $0x78,%eax,%eax
+	return 0;
+f0106dfb:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (e != curenv)
+f0106e00:	39 90 28 60 7d f0    	cmp    %edx,-0xf829fd8(%eax)
+f0106e06:	0f 84 0a fc ff ff    	je     f0106a16 <syscall+0x96>
+		e->env_binary = NULL;
+f0106e0c:	c7 42 64 00 00 00 00 	movl   $0x0,0x64(%edx)
+f0106e13:	e9 fe fb ff ff       	jmp    f0106a16 <syscall+0x96>
+	if ((r = env_alloc(&e, curenv->env_id)) < 0)
+f0106e18:	e8 1a 1e 00 00       	call   f0108c37 <cpunum>
+f0106e1d:	83 ec 08             	sub    $0x8,%esp
+f0106e20:	6b c0 78             	imul   $0x78,%eax,%eax
+f0106e23:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0106e29:	ff 70 48             	push   0x48(%eax)
+f0106e2c:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0106e32:	50                   	push   %eax
+f0106e33:	e8 e7 cf ff ff       	call   f0103e1f <env_alloc>
+f0106e38:	89 c3                	mov    %eax,%ebx
+f0106e3a:	83 c4 10             	add    $0x10,%esp
+f0106e3d:	85 c0                	test   %eax,%eax
+f0106e3f:	0f 88 d1 fb ff ff    	js     f0106a16 <syscall+0x96>
+	e->env_status = ENV_NOT_RUNNABLE;
+f0106e45:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f0106e4b:	c7 40 54 04 00 00 00 	movl   $0x4,0x54(%eax)
+	if ((r = env_load_elf(e, binary, size)) < 0
+f0106e52:	83 ec 04             	sub    $0x4,%esp
+f0106e55:	ff 75 10             	push   0x10(%ebp)
+f0106e58:	ff 75 0c             	push   0xc(%ebp)
+f0106e5b:	50                   	push   %eax
+f0106e5c:	e8 88 d3 ff ff       	call   f01041e9 <env_load_elf>
+f0106e61:	89 c3                	mov    %eax,%ebx
+f0106e63:	83 c4 10             	add    $0x10,%esp
+f0106e66:	85 c0                	test   %eax,%eax
+f0106e68:	78 2f                	js     f0106e99 <syscall+0x519>
+	    || (r = env_init_stack(e, argv)) < 0) {
+f0106e6a:	83 ec 08             	sub    $0x8,%esp
+f0106e6d:	ff 75 14             	push   0x14(%ebp)
+f0106e70:	ff b5 e8 fe ff ff    	push   -0x118(%ebp)
+f0106e76:	e8 db d5 ff ff       	call   f0104456 <env_init_stack>
+f0106e7b:	89 c3                	mov    %eax,%ebx
+f0106e7d:	83 c4 10             	add    $0x10,%esp
+f0106e80:	85 c0                	test   %eax,%eax
+f0106e82:	78 15                	js     f0106e99 <syscall+0x519>
+	e->env_status = ENV_RUNNABLE;
+f0106e84:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f0106e8a:	c7 40 54 02 00 00 00 	movl   $0x2,0x54(%eax)
+	return e->env_id;
+f0106e91:	8b 58 48             	mov    0x48(%eax),%ebx
+      return sys_spawn((const void *) a1, (size_t) a2, (const char **) a3);
+f0106e94:	e9 7d fb ff ff       	jmp    f0106a16 <syscall+0x96>
+		env_destroy(e);
+f0106e99:	83 ec 0c             	sub    $0xc,%esp
+f0106e9c:	ff b5 e8 fe ff ff    	push   -0x118(%ebp)
+f0106ea2:	e8 d2 da ff ff       	call   f0104979 <env_destroy>
+		return r;
+f0106ea7:	83 c4 10             	add    $0x10,%esp
+f0106eaa:	e9 67 fb ff ff       	jmp    f0106a16 <syscall+0x96>
+	if ((r = copyinstr(name, uname, SHM_NAMELEN)) < 0)
+f0106eaf:	83 ec 04             	sub    $0x4,%esp
+f0106eb2:	6a 20                	push   $0x20
+f0106eb4:	ff 75 0c             	push   0xc(%ebp)
+f0106eb7:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0106ebd:	50                   	push   %eax
+f0106ebe:	e8 8f f0 ff ff       	call   f0105f52 <copyinstr>
+	if ((r = shm_name(kname, name)) < 0)
+f0106ec3:	83 c4 10             	add    $0x10,%esp
+f0106ec6:	85 c0                	test   %eax,%eax
+f0106ec8:	78 1c                	js     f0106ee6 <syscall+0x566>
+	return shm_create(kname, npages);
+f0106eca:	83 ec 08             	sub    $0x8,%esp
+f0106ecd:	ff 75 10             	push   0x10(%ebp)
+f0106ed0:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0106ed6:	50                   	push   %eax
+f0106ed7:	e8 22 32 00 00       	call   f010a0fe <shm_create>
+f0106edc:	89 c3                	mov    %eax,%ebx
+f0106ede:	83 c4 10             	add    $0x10,%esp
+      return sys_shm_create((const char *) a1, (size_t) a2);
+f0106ee1:	e9 30 fb ff ff       	jmp    f0106a16 <syscall+0x96>
+	if ((r = copyinstr(name, uname, SHM_NAMELEN)) < 0)
+f0106ee6:	ba 00 00 00 00       	mov    $0x0,%edx
+f0106eeb:	0f 4e d0             	cmovle %eax,%edx
+f0106eee:	89 d3                	mov    %edx,%ebx
+f0106ef0:	e9 21 fb ff ff       	jmp    f0106a16 <syscall+0x96>
+	if ((r = envid2env(envid, &e, 1)) < 0)
+f0106ef5:	83 ec 04             	sub    $0x4,%esp
+f0106ef8:	6a 01                	push   $0x1
+f0106efa:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+f0106f00:	50                   	push   %eax
+f0106f01:	ff 75 0c             	push   0xc(%ebp)
+f0106f04:	e8 f2 cd ff ff       	call   f0103cfb <envid2env>
+f0106f09:	89 c3                	mov    %eax,%ebx
+f0106f0b:	83 c4 10             	add    $0x10,%esp
+f0106f0e:	85 c0                	test   %eax,%eax
+f0106f10:	0f 88 00 fb ff ff    	js     f0106a16 <syscall+0x96>
+	if ((r = copyinstr(name, uname, SHM_NAMELEN)) < 0)
+f0106f16:	83 ec 04             	sub    $0x4,%esp
+f0106f19:	6a 20                	push   $0x20
+f0106f1b:	ff 75 10             	push   0x10(%ebp)
+f0106f1e:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0106f24:	50                   	push   %eax
+f0106f25:	e8 28 f0 ff ff       	call   f0105f52 <copyinstr>
+	if ((r = shm_name(kname, name)) < 0)
+f0106f2a:	83 c4 10             	add    $0x10,%esp
+f0106f2d:	85 c0                	test   %eax,%eax
+f0106f2f:	78 22                	js     f0106f53 <syscall+0x5d3>
+	return shm_attach(e, kname, va, perm);
+f0106f31:	ff 75 18             	push   0x18(%ebp)
+f0106f34:	ff 75 14             	push   0x14(%ebp)
+f0106f37:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0106f3d:	50                   	push   %eax
+f0106f3e:	ff b5 e4 fe ff ff    	push   -0x11c(%ebp)
+f0106f44:	e8 02 33 00 00       	call   f010a24b <shm_attach>
+f0106f49:	89 c3                	mov    %eax,%ebx
+f0106f4b:	83 c4 10             	add    $0x10,%esp
+      return sys_shm_attach((envid_t) a1, (const char *) a2, (void *) a3,
+f0106f4e:	e9 c3 fa ff ff       	jmp    f0106a16 <syscall+0x96>
+	if ((r = copyinstr(name, uname, SHM_NAMELEN)) < 0)
+f0106f53:	ba 00 00 00 00       	mov    $0x0,%edx
+f0106f58:	0f 4e d0             	cmovle %eax,%edx
+f0106f5b:	89 d3                	mov    %edx,%ebx
+f0106f5d:	e9 b4 fa ff ff       	jmp    f0106a16 <syscall+0x96>
+	if ((r = envid2env(envid, &e, 1)) < 0)
+f0106f62:	83 ec 04             	sub    $0x4,%esp
+f0106f65:	6a 01                	push   $0x1
+f0106f67:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+f0106f6d:	50                   	push   %eax
+f0106f6e:	ff 75 0c             	push   0xc(%ebp)
+f0106f71:	e8 85 cd ff ff       	call   f0103cfb <envid2env>
+f0106f76:	89 c3                	mov    %eax,%ebx
+f0106f78:	83 c4 10             	add    $0x10,%esp
+f0106f7b:	85 c0                	test   %eax,%eax
+f0106f7d:	0f 88 93 fa ff ff    	js     f0106a16 <syscall+0x96>
+	if ((r = copyinstr(name, uname, SHM_NAMELEN)) < 0)
+f0106f83:	83 ec 04             	sub    $0x4,%esp
+f0106f86:	6a 20                	push   $0x20
+f0106f88:	ff 75 10             	push   0x10(%ebp)
+f0106f8b:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0106f91:	50                   	push   %eax
+f0106f92:	e8 bb ef ff ff       	call   f0105f52 <copyinstr>
+	if ((r = shm_name(kname, name)) < 0)
+f0106f97:	83 c4 10             	add    $0x10,%esp
+f0106f9a:	85 c0                	test   %eax,%eax
+f0106f9c:	78 22                	js     f0106fc0 <syscall+0x640>
+	return shm_detach(e, kname, va);
+f0106f9e:	83 ec 04             	sub    $0x4,%esp
+f0106fa1:	ff 75 14             	push   0x14(%ebp)
+f0106fa4:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0106faa:	50                   	push   %eax
+f0106fab:	ff b5 e4 fe ff ff    	push   -0x11c(%ebp)
+f0106fb1:	e8 ee 33 00 00       	call   f010a3a4 <shm_detach>
+f0106fb6:	89 c3                	mov    %eax,%ebx
+f0106fb8:	83 c4 10             	add    $0x10,%esp
+      return sys_shm_detach((envid_t) a1, (const char *) a2, (void *) a3);
+f0106fbb:	e9 56 fa ff ff       	jmp    f0106a16 <syscall+0x96>
+	if ((r = copyinstr(name, uname, SHM_NAMELEN)) < 0)
+f0106fc0:	ba 00 00 00 00       	mov    $0x0,%edx
+f0106fc5:	0f 4e d0             	cmovle %eax,%edx
+f0106fc8:	89 d3                	mov    %edx,%ebx
+f0106fca:	e9 47 fa ff ff       	jmp    f0106a16 <syscall+0x96>
+f0106fcf:	83 ec 04             	sub    $0x4,%esp
+f0106fd2:	6a 20                	push   $0x20
+f0106fd4:	ff 75 0c             	push   0xc(%ebp)
+f0106fd7:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0106fdd:	50                   	push   %eax
+f0106fde:	e8 6f ef ff ff       	call   f0105f52 <copyinstr>
+	if ((r = shm_name(kname, name)) < 0)
+f0106fe3:	83 c4 10             	add    $0x10,%esp
+f0106fe6:	85 c0                	test   %eax,%eax
+f0106fe8:	78 19                	js     f0107003 <syscall+0x683>
+	return shm_remove(kname);
+f0106fea:	83 ec 0c             	sub    $0xc,%esp
+f0106fed:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0106ff3:	50                   	push   %eax
+f0106ff4:	e8 46 34 00 00       	call   f010a43f <shm_remove>
+f0106ff9:	89 c3                	mov    %eax,%ebx
+f0106ffb:	83 c4 10             	add    $0x10,%esp
+      return sys_shm_remove((const char *) a1);
+f0106ffe:	e9 13 fa ff ff       	jmp    f0106a16 <syscall+0x96>
+	if ((r = copyinstr(name, uname, SHM_NAMELEN)) < 0)
+f0107003:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107008:	0f 4e d0             	cmovle %eax,%edx
+f010700b:	89 d3                	mov    %edx,%ebx
+f010700d:	e9 04 fa ff ff       	jmp    f0106a16 <syscall+0x96>
+	if (size == 0 || size > USTACKSIZE)
+f0107012:	8b 45 10             	mov    0x10(%ebp),%eax
+f0107015:	83 e8 01             	sub    $0x1,%eax
+f0107018:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+f010701d:	77 41                	ja     f0107060 <syscall+0x6e0>
+	if ((r = envid2env(envid, &e, 1)) < 0)
+f010701f:	83 ec 04             	sub    $0x4,%esp
+f0107022:	6a 01                	push   $0x1
+f0107024:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f010702a:	50                   	push   %eax
+f010702b:	ff 75 0c             	push   0xc(%ebp)
+f010702e:	e8 c8 cc ff ff       	call   f0103cfb <envid2env>
+f0107033:	89 c3                	mov    %eax,%ebx
+f0107035:	83 c4 10             	add    $0x10,%esp
+f0107038:	85 c0                	test   %eax,%eax
+f010703a:	0f 88 d6 f9 ff ff    	js     f0106a16 <syscall+0x96>
+	e->env_stack_limit = ROUNDUP(size, PGSIZE);
+f0107040:	8b 45 10             	mov    0x10(%ebp),%eax
+f0107043:	05 ff 0f 00 00       	add    $0xfff,%eax
+f0107048:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f010704d:	8b 95 e8 fe ff ff    	mov    -0x118(%ebp),%edx
+f0107053:	89 42 70             	mov    %eax,0x70(%edx)
+	return 0;
+f0107056:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010705b:	e9 b6 f9 ff ff       	jmp    f0106a16 <syscall+0x96>
+		return -E_INVAL;
+f0107060:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+      return sys_env_set_stack_limit((envid_t) a1, (size_t) a2);
+f0107065:	e9 ac f9 ff ff       	jmp    f0106a16 <syscall+0x96>
+	if ((r = envid2env(envid, &e, 1)) < 0)
+f010706a:	83 ec 04             	sub    $0x4,%esp
+f010706d:	6a 01                	push   $0x1
+f010706f:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0107075:	50                   	push   %eax
+f0107076:	ff 75 0c             	push   0xc(%ebp)
+f0107079:	e8 7d cc ff ff       	call   f0103cfb <envid2env>
+f010707e:	89 c3                	mov    %eax,%ebx
+f0107080:	83 c4 10             	add    $0x10,%esp
+f0107083:	85 c0                	test   %eax,%eax
+f0107085:	0f 88 8b f9 ff ff    	js     f0106a16 <syscall+0x96>
+	e->env_pgfault_upcall = func;
+f010708b:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f0107091:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f0107094:	89 48 74             	mov    %ecx,0x74(%eax)
+	return 0;
+f0107097:	bb 00 00 00 00       	mov    $0x0,%ebx
+      return sys_env_set_pgfault_upcall((envid_t) a1, (void *) a2);
+f010709c:	e9 75 f9 ff ff       	jmp    f0106a16 <syscall+0x96>
+	if ((r = env_alloc(&e, curenv->env_id)) < 0)
+f01070a1:	e8 91 1b 00 00       	call   f0108c37 <cpunum>
+f01070a6:	83 ec 08             	sub    $0x8,%esp
+f01070a9:	6b c0 78             	imul   $0x78,%eax,%eax
+f01070ac:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f01070b2:	ff 70 48             	push   0x48(%eax)
+f01070b5:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f01070bb:	50                   	push   %eax
+f01070bc:	e8 5e cd ff ff       	call   f0103e1f <env_alloc>
+f01070c1:	89 c3                	mov    %eax,%ebx
+f01070c3:	83 c4 10             	add    $0x10,%esp
+f01070c6:	85 c0                	test   %eax,%eax
+f01070c8:	0f 88 48 f9 ff ff    	js     f0106a16 <syscall+0x96>
+	e->env_tf = curenv->env_tf;
+f01070ce:	e8 64 1b 00 00       	call   f0108c37 <cpunum>
+f01070d3:	6b c0 78             	imul   $0x78,%eax,%eax
+f01070d6:	8b b0 28 60 7d f0    	mov    -0xf829fd8(%eax),%esi
+f01070dc:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f01070e2:	b9 11 00 00 00       	mov    $0x11,%ecx
+f01070e7:	89 c7                	mov    %eax,%edi
+f01070e9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	e->env_tf.tf_regs.reg_eax = 0;
+f01070eb:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+	e->env_pgfault_upcall = curenv->env_pgfault_upcall;
+f01070f2:	e8 40 1b 00 00       	call   f0108c37 <cpunum>
+f01070f7:	6b c0 78             	imul   $0x78,%eax,%eax
+f01070fa:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0107100:	8b 50 74             	mov    0x74(%eax),%edx
+f0107103:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f0107109:	89 50 74             	mov    %edx,0x74(%eax)
+	e->env_binary = curenv->env_binary;
+f010710c:	e8 26 1b 00 00       	call   f0108c37 <cpunum>
+f0107111:	6b c0 78             	imul   $0x78,%eax,%eax
+f0107114:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f010711a:	8b 50 64             	mov    0x64(%eax),%edx
+f010711d:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f0107123:	89 50 64             	mov    %edx,0x64(%eax)
+	e->env_stack_limit = curenv->env_stack_limit;
+f0107126:	e8 0c 1b 00 00       	call   f0108c37 <cpunum>
+f010712b:	6b c0 78             	imul   $0x78,%eax,%eax
+f010712e:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0107134:	8b 50 70             	mov    0x70(%eax),%edx
+f0107137:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f010713d:	89 50 70             	mov    %edx,0x70(%eax)
+	r = pgdir_fork(e->env_pgdir, curenv->env_pgdir);
+f0107140:	e8 f2 1a 00 00       	call   f0108c37 <cpunum>
+f0107145:	83 ec 08             	sub    $0x8,%esp
+f0107148:	6b c0 78             	imul   $0x78,%eax,%eax
+f010714b:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0107151:	ff 70 60             	push   0x60(%eax)
+f0107154:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f010715a:	ff 70 60             	push   0x60(%eax)
+f010715d:	e8 f8 a2 ff ff       	call   f010145a <pgdir_fork>
+f0107162:	89 c3                	mov    %eax,%ebx
+	lcr3(PADDR(curenv->env_pgdir));
+f0107164:	e8 ce 1a 00 00       	call   f0108c37 <cpunum>
+f0107169:	6b c0 78             	imul   $0x78,%eax,%eax
+f010716c:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f0107172:	8b 40 60             	mov    0x60(%eax),%eax
+	if ((uint32_t)kva < KERNBASE)
+f0107175:	83 c4 10             	add    $0x10,%esp
+f0107178:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f010717d:	76 7e                	jbe    f01071fd <syscall+0x87d>
+	return (physaddr_t)kva - KERNBASE;
+f010717f:	05 00 00 00 10       	add    $0x10000000,%eax
+	asm volatile("movl %0,%%cr3" : : "r" (val));
+f0107184:	0f 22 d8             	mov    %eax,%cr3
+	if (r < 0)
+f0107187:	85 db                	test   %ebx,%ebx
+f0107189:	0f 88 96 00 00 00    	js     f0107225 <syscall+0x8a5>
+	if (page_lookup(curenv->env_pgdir, (void *) (UXSTACKTOP - PGSIZE), 0)) {
+f010718f:	e8 a3 1a 00 00       	call   f0108c37 <cpunum>
+f0107194:	83 ec 04             	sub    $0x4,%esp
+f0107197:	6a 00                	push   $0x0
+f0107199:	68 00 f0 bf ee       	push   $0xeebff000
+f010719e:	6b c0 78             	imul   $0x78,%eax,%eax
+f01071a1:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f01071a7:	ff 70 60             	push   0x60(%eax)
+f01071aa:	e8 db a6 ff ff       	call   f010188a <page_lookup>
+f01071af:	83 c4 10             	add    $0x10,%esp
+f01071b2:	85 c0                	test   %eax,%eax
+f01071b4:	74 32                	je     f01071e8 <syscall+0x868>
+		if (!(pp = page_alloc(ALLOC_ZERO)))
+f01071b6:	83 ec 0c             	sub    $0xc,%esp
+f01071b9:	6a 01                	push   $0x1
+f01071bb:	e8 25 a0 ff ff       	call   f01011e5 <page_alloc>
+f01071c0:	89 c6                	mov    %eax,%esi
+f01071c2:	83 c4 10             	add    $0x10,%esp
+f01071c5:	85 c0                	test   %eax,%eax
+f01071c7:	74 57                	je     f0107220 <syscall+0x8a0>
+		if ((r = page_insert(e->env_pgdir, pp, (void *) (UXSTACKTOP - PGSIZE),
+f01071c9:	6a 07                	push   $0x7
+f01071cb:	68 00 f0 bf ee       	push   $0xeebff000
+f01071d0:	50                   	push   %eax
+f01071d1:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f01071d7:	ff 70 60             	push   0x60(%eax)
+f01071da:	e8 6b a8 ff ff       	call   f0101a4a <page_insert>
+f01071df:	89 c3                	mov    %eax,%ebx
+f01071e1:	83 c4 10             	add    $0x10,%esp
+f01071e4:	85 c0                	test   %eax,%eax
+f01071e6:	78 2a                	js     f0107212 <syscall+0x892>
+	e->env_status = ENV_RUNNABLE;
+f01071e8:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f01071ee:	c7 40 54 02 00 00 00 	movl   $0x2,0x54(%eax)
+	return e->env_id;
+f01071f5:	8b 58 48             	mov    0x48(%eax),%ebx
+f01071f8:	e9 19 f8 ff ff       	jmp    f0106a16 <syscall+0x96>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01071fd:	50                   	push   %eax
+f01071fe:	68 24 be 10 f0       	push   $0xf010be24
+f0107203:	68 b1 02 00 00       	push   $0x2b1
+f0107208:	68 de d7 10 f0       	push   $0xf010d7de
+f010720d:	e8 31 8e ff ff       	call   f0100043 <_panic>
+			page_free(pp);
+f0107212:	83 ec 0c             	sub    $0xc,%esp
+f0107215:	56                   	push   %esi
+f0107216:	e8 55 a0 ff ff       	call   f0101270 <page_free>
+			goto fail;
+f010721b:	83 c4 10             	add    $0x10,%esp
+f010721e:	eb 05                	jmp    f0107225 <syscall+0x8a5>
+		r = -E_NO_MEM;
+f0107220:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+	env_destroy(e);
+f0107225:	83 ec 0c             	sub    $0xc,%esp
+f0107228:	ff b5 e8 fe ff ff    	push   -0x118(%ebp)
+f010722e:	e8 46 d7 ff ff       	call   f0104979 <env_destroy>
+	return r;
+f0107233:	83 c4 10             	add    $0x10,%esp
+      return sys_fork();
+f0107236:	e9 db f7 ff ff       	jmp    f0106a16 <syscall+0x96>
+	if ((r = sysinfo(&kinfo)) < 0)
+f010723b:	83 ec 0c             	sub    $0xc,%esp
+f010723e:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0107244:	50                   	push   %eax
+f0107245:	e8 90 22 00 00       	call   f01094da <sysinfo>
+f010724a:	89 c3                	mov    %eax,%ebx
+f010724c:	83 c4 10             	add    $0x10,%esp
+f010724f:	85 c0                	test   %eax,%eax
+f0107251:	0f 88 bf f7 ff ff    	js     f0106a16 <syscall+0x96>
+	return copyout(info, &kinfo, sizeof(kinfo));
+f0107257:	83 ec 04             	sub    $0x4,%esp
+f010725a:	6a 64                	push   $0x64
+f010725c:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0107262:	50                   	push   %eax
+f0107263:	ff 75 0c             	push   0xc(%ebp)
+f0107266:	e8 62 ed ff ff       	call   f0105fcd <copyout>
+f010726b:	89 c3                	mov    %eax,%ebx
+f010726d:	83 c4 10             	add    $0x10,%esp
+      return sys_sysinfo((struct sysinfo *) a1);
+f0107270:	e9 a1 f7 ff ff       	jmp    f0106a16 <syscall+0x96>
+	struct ipc_msg msg = { { value } };
+f0107275:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+f010727c:	00 00 00 
+f010727f:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+f0107286:	00 00 00 
+f0107289:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+f0107290:	00 00 00 
+f0107293:	c7 85 f8 fe ff ff 00 	movl   $0x0,-0x108(%ebp)
+f010729a:	00 00 00 
+f010729d:	8b 45 10             	mov    0x10(%ebp),%eax
+f01072a0:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	if ((r = envid2env(envid, &e, 0)) < 0)
+f01072a6:	83 ec 04             	sub    $0x4,%esp
+f01072a9:	6a 00                	push   $0x0
+f01072ab:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+f01072b1:	50                   	push   %eax
+f01072b2:	ff 75 0c             	push   0xc(%ebp)
+f01072b5:	e8 41 ca ff ff       	call   f0103cfb <envid2env>
+f01072ba:	89 c3                	mov    %eax,%ebx
+f01072bc:	83 c4 10             	add    $0x10,%esp
+f01072bf:	85 c0                	test   %eax,%eax
+f01072c1:	0f 88 4f f7 ff ff    	js     f0106a16 <syscall+0x96>
+	return ipc_send(e, &msg, srcva, 1, perm, 0);
+f01072c7:	83 ec 08             	sub    $0x8,%esp
+f01072ca:	6a 00                	push   $0x0
+f01072cc:	ff 75 18             	push   0x18(%ebp)
+f01072cf:	6a 01                	push   $0x1
+f01072d1:	ff 75 14             	push   0x14(%ebp)
+f01072d4:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f01072da:	50                   	push   %eax
+f01072db:	ff b5 e4 fe ff ff    	push   -0x11c(%ebp)
+f01072e1:	e8 43 36 00 00       	call   f010a929 <ipc_send>
+f01072e6:	89 c3                	mov    %eax,%ebx
+f01072e8:	83 c4 20             	add    $0x20,%esp
+      return sys_ipc_try_send((envid_t) a1, a2, (void *) a3, (unsigned) a4);
+f01072eb:	e9 26 f7 ff ff       	jmp    f0106a16 <syscall+0x96>
+	struct ipc_msg msg = { { value } };
+f01072f0:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+f01072f7:	00 00 00 
+f01072fa:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+f0107301:	00 00 00 
+f0107304:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+f010730b:	00 00 00 
+f010730e:	c7 85 f8 fe ff ff 00 	movl   $0x0,-0x108(%ebp)
+f0107315:	00 00 00 
+f0107318:	8b 45 10             	mov    0x10(%ebp),%eax
+f010731b:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	if ((r = envid2env(envid, &e, 0)) < 0)
+f0107321:	83 ec 04             	sub    $0x4,%esp
+f0107324:	6a 00                	push   $0x0
+f0107326:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+f010732c:	50                   	push   %eax
+f010732d:	ff 75 0c             	push   0xc(%ebp)
+f0107330:	e8 c6 c9 ff ff       	call   f0103cfb <envid2env>
+f0107335:	89 c3                	mov    %eax,%ebx
+f0107337:	83 c4 10             	add    $0x10,%esp
+f010733a:	85 c0                	test   %eax,%eax
+f010733c:	0f 88 d4 f6 ff ff    	js     f0106a16 <syscall+0x96>
+	return ipc_send(e, &msg, srcva, 1, perm, 1);
+f0107342:	83 ec 08             	sub    $0x8,%esp
+f0107345:	6a 01                	push   $0x1
+f0107347:	ff 75 18             	push   0x18(%ebp)
+f010734a:	6a 01                	push   $0x1
+f010734c:	ff 75 14             	push   0x14(%ebp)
+f010734f:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0107355:	50                   	push   %eax
+f0107356:	ff b5 e4 fe ff ff    	push   -0x11c(%ebp)
+f010735c:	e8 c8 35 00 00       	call   f010a929 <ipc_send>
+f0107361:	89 c3                	mov    %eax,%ebx
+f0107363:	83 c4 20             	add    $0x20,%esp
+      return sys_ipc_send((envid_t) a1, a2, (void *) a3, (unsigned) a4);
+f0107366:	e9 ab f6 ff ff       	jmp    f0106a16 <syscall+0x96>
+	return ipc_recv(dstva, 1);
+f010736b:	83 ec 08             	sub    $0x8,%esp
+f010736e:	6a 01                	push   $0x1
+f0107370:	ff 75 0c             	push   0xc(%ebp)
+f0107373:	e8 07 38 00 00       	call   f010ab7f <ipc_recv>
+f0107378:	89 c3                	mov    %eax,%ebx
+      return sys_ipc_recv((void *) a1);
+f010737a:	83 c4 10             	add    $0x10,%esp
+f010737d:	e9 94 f6 ff ff       	jmp    f0106a16 <syscall+0x96>
+	if ((r = envid2env(envid, &e, 0)) < 0)
+f0107382:	83 ec 04             	sub    $0x4,%esp
+f0107385:	6a 00                	push   $0x0
+f0107387:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+f010738d:	50                   	push   %eax
+f010738e:	ff 75 0c             	push   0xc(%ebp)
+f0107391:	e8 65 c9 ff ff       	call   f0103cfb <envid2env>
+f0107396:	89 c3                	mov    %eax,%ebx
+f0107398:	83 c4 10             	add    $0x10,%esp
+f010739b:	85 c0                	test   %eax,%eax
+f010739d:	0f 88 73 f6 ff ff    	js     f0106a16 <syscall+0x96>
+	ipc_msg_get(&msg, &curenv->env_tf.tf_regs);
+f01073a3:	e8 8f 18 00 00       	call   f0108c37 <cpunum>
+f01073a8:	83 ec 08             	sub    $0x8,%esp
+f01073ab:	6b c0 78             	imul   $0x78,%eax,%eax
+f01073ae:	ff b0 28 60 7d f0    	push   -0xf829fd8(%eax)
+f01073b4:	8d 9d e8 fe ff ff    	lea    -0x118(%ebp),%ebx
+f01073ba:	53                   	push   %ebx
+f01073bb:	e8 1b 35 00 00       	call   f010a8db <ipc_msg_get>
+	return ipc_call(e, &msg);
+f01073c0:	83 c4 08             	add    $0x8,%esp
+f01073c3:	53                   	push   %ebx
+f01073c4:	ff b5 e4 fe ff ff    	push   -0x11c(%ebp)
+f01073ca:	e8 e5 36 00 00       	call   f010aab4 <ipc_call>
+f01073cf:	89 c3                	mov    %eax,%ebx
+f01073d1:	83 c4 10             	add    $0x10,%esp
+      return sys_ipc_call((envid_t) a1);
+f01073d4:	e9 3d f6 ff ff       	jmp    f0106a16 <syscall+0x96>
+	ipc_msg_get(&reply, &curenv->env_tf.tf_regs);
+f01073d9:	e8 59 18 00 00       	call   f0108c37 <cpunum>
+f01073de:	83 ec 08             	sub    $0x8,%esp
+f01073e1:	6b c0 78             	imul   $0x78,%eax,%eax
+f01073e4:	ff b0 28 60 7d f0    	push   -0xf829fd8(%eax)
+f01073ea:	8d 9d e8 fe ff ff    	lea    -0x118(%ebp),%ebx
+f01073f0:	53                   	push   %ebx
+f01073f1:	e8 e5 34 00 00       	call   f010a8db <ipc_msg_get>
+	return ipc_reply_wait(envid, &reply);
+f01073f6:	83 c4 08             	add    $0x8,%esp
+f01073f9:	53                   	push   %ebx
+f01073fa:	ff 75 0c             	push   0xc(%ebp)
+f01073fd:	e8 0f 38 00 00       	call   f010ac11 <ipc_reply_wait>
+f0107402:	89 c3                	mov    %eax,%ebx
+      return sys_ipc_reply_wait((envid_t) a1);
+f0107404:	83 c4 10             	add    $0x10,%esp
+f0107407:	e9 0a f6 ff ff       	jmp    f0106a16 <syscall+0x96>
+	if ((r = envid2env(envid, &e, 0)) < 0)
+f010740c:	83 ec 04             	sub    $0x4,%esp
+f010740f:	6a 00                	push   $0x0
+f0107411:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+f0107417:	50                   	push   %eax
+f0107418:	ff 75 0c             	push   0xc(%ebp)
+f010741b:	e8 db c8 ff ff       	call   f0103cfb <envid2env>
+f0107420:	89 c3                	mov    %eax,%ebx
+f0107422:	83 c4 10             	add    $0x10,%esp
+f0107425:	85 c0                	test   %eax,%eax
+f0107427:	0f 88 e9 f5 ff ff    	js     f0106a16 <syscall+0x96>
+	ipc_msg_get(&msg, &curenv->env_tf.tf_regs);
+f010742d:	e8 05 18 00 00       	call   f0108c37 <cpunum>
+f0107432:	83 ec 08             	sub    $0x8,%esp
+f0107435:	6b c0 78             	imul   $0x78,%eax,%eax
+f0107438:	ff b0 28 60 7d f0    	push   -0xf829fd8(%eax)
+f010743e:	8d 9d e8 fe ff ff    	lea    -0x118(%ebp),%ebx
+f0107444:	53                   	push   %ebx
+f0107445:	e8 91 34 00 00       	call   f010a8db <ipc_msg_get>
+	return ipc_send(e, &msg, (void *) UTOP, 0, 0, 1);
+f010744a:	83 c4 08             	add    $0x8,%esp
+f010744d:	6a 01                	push   $0x1
+f010744f:	6a 00                	push   $0x0
+f0107451:	6a 00                	push   $0x0
+f0107453:	68 00 00 c0 ee       	push   $0xeec00000
+f0107458:	53                   	push   %ebx
+f0107459:	ff b5 e4 fe ff ff    	push   -0x11c(%ebp)
+f010745f:	e8 c5 34 00 00       	call   f010a929 <ipc_send>
+f0107464:	89 c3                	mov    %eax,%ebx
+f0107466:	83 c4 20             	add    $0x20,%esp
+      return sys_ipc_send_msg((envid_t) a1);
+f0107469:	e9 a8 f5 ff ff       	jmp    f0106a16 <syscall+0x96>
+	struct ipc_msg msg = { { value } };
+f010746e:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+f0107475:	00 00 00 
+f0107478:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+f010747f:	00 00 00 
+f0107482:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+f0107489:	00 00 00 
+f010748c:	c7 85 f8 fe ff ff 00 	movl   $0x0,-0x108(%ebp)
+f0107493:	00 00 00 
+f0107496:	8b 45 10             	mov    0x10(%ebp),%eax
+f0107499:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	if ((r = envid2env(envid, &e, 0)) < 0)
+f010749f:	83 ec 04             	sub    $0x4,%esp
+f01074a2:	6a 00                	push   $0x0
+f01074a4:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+f01074aa:	50                   	push   %eax
+f01074ab:	ff 75 0c             	push   0xc(%ebp)
+f01074ae:	e8 48 c8 ff ff       	call   f0103cfb <envid2env>
+f01074b3:	89 c3                	mov    %eax,%ebx
+f01074b5:	83 c4 10             	add    $0x10,%esp
+f01074b8:	85 c0                	test   %eax,%eax
+f01074ba:	0f 88 56 f5 ff ff    	js     f0106a16 <syscall+0x96>
+	return ipc_send(e, &msg, srcva, npages, perm, 1);
+f01074c0:	83 ec 08             	sub    $0x8,%esp
+f01074c3:	6a 01                	push   $0x1
+f01074c5:	ff 75 1c             	push   0x1c(%ebp)
+f01074c8:	ff 75 18             	push   0x18(%ebp)
+f01074cb:	ff 75 14             	push   0x14(%ebp)
+f01074ce:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f01074d4:	50                   	push   %eax
+f01074d5:	ff b5 e4 fe ff ff    	push   -0x11c(%ebp)
+f01074db:	e8 49 34 00 00       	call   f010a929 <ipc_send>
+f01074e0:	89 c3                	mov    %eax,%ebx
+f01074e2:	83 c4 20             	add    $0x20,%esp
+      return sys_ipc_send_range((envid_t) a1, a2, (void *) a3, (size_t) a4,
+f01074e5:	e9 2c f5 ff ff       	jmp    f0106a16 <syscall+0x96>
+	return ipc_recv(dstva, npages);
+f01074ea:	83 ec 08             	sub    $0x8,%esp
+f01074ed:	ff 75 10             	push   0x10(%ebp)
+f01074f0:	ff 75 0c             	push   0xc(%ebp)
+f01074f3:	e8 87 36 00 00       	call   f010ab7f <ipc_recv>
+f01074f8:	89 c3                	mov    %eax,%ebx
+      return sys_ipc_recv_range((void *) a1, (size_t) a2);
+f01074fa:	83 c4 10             	add    $0x10,%esp
+f01074fd:	e9 14 f5 ff ff       	jmp    f0106a16 <syscall+0x96>
+	return futex_wait(addr, expected,
+f0107502:	8b 5d 18             	mov    0x18(%ebp),%ebx
+f0107505:	8b 4d 14             	mov    0x14(%ebp),%ecx
+f0107508:	53                   	push   %ebx
+f0107509:	51                   	push   %ecx
+f010750a:	ff 75 10             	push   0x10(%ebp)
+f010750d:	ff 75 0c             	push   0xc(%ebp)
+f0107510:	e8 3c 3a 00 00       	call   f010af51 <futex_wait>
+f0107515:	89 c3                	mov    %eax,%ebx
+      return sys_futex_wait((const uint32_t *) a1, a2, a3, a4);
+f0107517:	83 c4 10             	add    $0x10,%esp
+f010751a:	e9 f7 f4 ff ff       	jmp    f0106a16 <syscall+0x96>
+	return futex_wake(addr, n);
+f010751f:	83 ec 08             	sub    $0x8,%esp
+f0107522:	ff 75 10             	push   0x10(%ebp)
+f0107525:	ff 75 0c             	push   0xc(%ebp)
+f0107528:	e8 8b 3b 00 00       	call   f010b0b8 <futex_wake>
+f010752d:	89 c3                	mov    %eax,%ebx
+      return sys_futex_wake((const uint32_t *) a1, (int) a2);
+f010752f:	83 c4 10             	add    $0x10,%esp
+f0107532:	e9 df f4 ff ff       	jmp    f0106a16 <syscall+0x96>
+	return ep_create();
+f0107537:	e8 3b 3e 00 00       	call   f010b377 <ep_create>
+f010753c:	89 c3                	mov    %eax,%ebx
+      return sys_ep_create();
+f010753e:	e9 d3 f4 ff ff       	jmp    f0106a16 <syscall+0x96>
+	return ep_destroy(epid);
+f0107543:	83 ec 0c             	sub    $0xc,%esp
+f0107546:	ff 75 0c             	push   0xc(%ebp)
+f0107549:	e8 e5 3e 00 00       	call   f010b433 <ep_destroy>
+f010754e:	89 c3                	mov    %eax,%ebx
+      return sys_ep_destroy((epid_t) a1);
+f0107550:	83 c4 10             	add    $0x10,%esp
+f0107553:	e9 be f4 ff ff       	jmp    f0106a16 <syscall+0x96>
+	if ((r = envid2env(envid, &e, 0)) < 0)
+f0107558:	83 ec 04             	sub    $0x4,%esp
+f010755b:	6a 00                	push   $0x0
+f010755d:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0107563:	50                   	push   %eax
+f0107564:	ff 75 10             	push   0x10(%ebp)
+f0107567:	e8 8f c7 ff ff       	call   f0103cfb <envid2env>
+f010756c:	89 c3                	mov    %eax,%ebx
+f010756e:	83 c4 10             	add    $0x10,%esp
+f0107571:	85 c0                	test   %eax,%eax
+f0107573:	0f 88 9d f4 ff ff    	js     f0106a16 <syscall+0x96>
+	return ep_grant(epid, e);
+f0107579:	83 ec 08             	sub    $0x8,%esp
+f010757c:	ff b5 e8 fe ff ff    	push   -0x118(%ebp)
+f0107582:	ff 75 0c             	push   0xc(%ebp)
+f0107585:	e8 f0 3e 00 00       	call   f010b47a <ep_grant>
+f010758a:	89 c3                	mov    %eax,%ebx
+f010758c:	83 c4 10             	add    $0x10,%esp
+      return sys_ep_grant((epid_t) a1, (envid_t) a2);
+f010758f:	e9 82 f4 ff ff       	jmp    f0106a16 <syscall+0x96>
+	ipc_msg_get(&msg, &curenv->env_tf.tf_regs);
+f0107594:	e8 9e 16 00 00       	call   f0108c37 <cpunum>
+f0107599:	83 ec 08             	sub    $0x8,%esp
+f010759c:	6b c0 78             	imul   $0x78,%eax,%eax
+f010759f:	ff b0 28 60 7d f0    	push   -0xf829fd8(%eax)
+f01075a5:	8d 9d e8 fe ff ff    	lea    -0x118(%ebp),%ebx
+f01075ab:	53                   	push   %ebx
+f01075ac:	e8 2a 33 00 00       	call   f010a8db <ipc_msg_get>
+	return ep_send(epid, &msg);
+f01075b1:	83 c4 08             	add    $0x8,%esp
+f01075b4:	53                   	push   %ebx
+f01075b5:	ff 75 0c             	push   0xc(%ebp)
+f01075b8:	e8 1a 3f 00 00       	call   f010b4d7 <ep_send>
+f01075bd:	89 c3                	mov    %eax,%ebx
+      return sys_ep_send((epid_t) a1);
+f01075bf:	83 c4 10             	add    $0x10,%esp
+f01075c2:	e9 4f f4 ff ff       	jmp    f0106a16 <syscall+0x96>
+	return ep_recv(epids, n);
+f01075c7:	83 ec 08             	sub    $0x8,%esp
+f01075ca:	ff 75 10             	push   0x10(%ebp)
+f01075cd:	ff 75 0c             	push   0xc(%ebp)
+f01075d0:	e8 82 40 00 00       	call   f010b657 <ep_recv>
+f01075d5:	89 c3                	mov    %eax,%ebx
+      return sys_ep_recv((const epid_t *) a1, (size_t) a2);
+f01075d7:	83 c4 10             	add    $0x10,%esp
+f01075da:	e9 37 f4 ff ff       	jmp    f0106a16 <syscall+0x96>
+	return sysring_setup(va);
+f01075df:	83 ec 0c             	sub    $0xc,%esp
+f01075e2:	ff 75 0c             	push   0xc(%ebp)
+f01075e5:	e8 5a 43 00 00       	call   f010b944 <sysring_setup>
+f01075ea:	89 c3                	mov    %eax,%ebx
+      return sys_sysring_setup((void *) a1);
+f01075ec:	83 c4 10             	add    $0x10,%esp
+f01075ef:	e9 22 f4 ff ff       	jmp    f0106a16 <syscall+0x96>
+	return sysring_enter();
+f01075f4:	e8 c2 43 00 00       	call   f010b9bb <sysring_enter>
+f01075f9:	89 c3                	mov    %eax,%ebx
+      return sys_sysring_enter();
+f01075fb:	e9 16 f4 ff ff       	jmp    f0106a16 <syscall+0x96>
+	if ((r = envid2env(srcenvid, &esrc, 1)) < 0
+f0107600:	83 ec 04             	sub    $0x4,%esp
+f0107603:	6a 01                	push   $0x1
+f0107605:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+f010760b:	50                   	push   %eax
+f010760c:	ff 75 0c             	push   0xc(%ebp)
+f010760f:	e8 e7 c6 ff ff       	call   f0103cfb <envid2env>
+f0107614:	89 c3                	mov    %eax,%ebx
+f0107616:	83 c4 10             	add    $0x10,%esp
+f0107619:	85 c0                	test   %eax,%eax
+f010761b:	0f 88 f5 f3 ff ff    	js     f0106a16 <syscall+0x96>
+	    || (r = envid2env(dstenvid, &edst, 1)) < 0)
+f0107621:	83 ec 04             	sub    $0x4,%esp
+f0107624:	6a 01                	push   $0x1
+f0107626:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+f010762c:	50                   	push   %eax
+f010762d:	ff 75 14             	push   0x14(%ebp)
+f0107630:	e8 c6 c6 ff ff       	call   f0103cfb <envid2env>
+f0107635:	89 c3                	mov    %eax,%ebx
+f0107637:	83 c4 10             	add    $0x10,%esp
+f010763a:	85 c0                	test   %eax,%eax
+f010763c:	0f 88 d4 f3 ff ff    	js     f0106a16 <syscall+0x96>
+	return env_page_copy(esrc, srcva, edst, dstva, perm);
+f0107642:	8b 9d e4 fe ff ff    	mov    -0x11c(%ebp),%ebx
+f0107648:	8b 85 e0 fe ff ff    	mov    -0x120(%ebp),%eax
+	if ((uintptr_t) srcva >= UTOP || PGOFF(srcva)
+f010764e:	81 7d 10 ff ff bf ee 	cmpl   $0xeebfffff,0x10(%ebp)
+f0107655:	0f 87 52 01 00 00    	ja     f01077ad <syscall+0xe2d>
+	    || (uintptr_t) dstva >= UTOP || PGOFF(dstva))
+f010765b:	81 7d 18 ff ff bf ee 	cmpl   $0xeebfffff,0x18(%ebp)
+f0107662:	0f 87 4f 01 00 00    	ja     f01077b7 <syscall+0xe37>
+f0107668:	8b 55 18             	mov    0x18(%ebp),%edx
+f010766b:	0b 55 10             	or     0x10(%ebp),%edx
+f010766e:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+f0107674:	0f 85 47 01 00 00    	jne    f01077c1 <syscall+0xe41>
+	if ((perm & (PTE_U | PTE_P)) != (PTE_U | PTE_P) || (perm & ~PTE_SYSCALL))
+f010767a:	8b 55 1c             	mov    0x1c(%ebp),%edx
+f010767d:	81 e2 fd f1 ff ff    	and    $0xfffff1fd,%edx
+f0107683:	83 fa 05             	cmp    $0x5,%edx
+f0107686:	0f 85 3f 01 00 00    	jne    f01077cb <syscall+0xe4b>
+	if (!(pp = page_lookup(esrc->env_pgdir, srcva, &pte))
+f010768c:	83 ec 04             	sub    $0x4,%esp
+f010768f:	8d 95 e8 fe ff ff    	lea    -0x118(%ebp),%edx
+f0107695:	52                   	push   %edx
+f0107696:	ff 75 10             	push   0x10(%ebp)
+f0107699:	ff 70 60             	push   0x60(%eax)
+f010769c:	e8 e9 a1 ff ff       	call   f010188a <page_lookup>
+f01076a1:	89 c7                	mov    %eax,%edi
+f01076a3:	83 c4 10             	add    $0x10,%esp
+f01076a6:	85 c0                	test   %eax,%eax
+f01076a8:	0f 84 27 01 00 00    	je     f01077d5 <syscall+0xe55>
+	    || !(*pte & PTE_U))
+f01076ae:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f01076b4:	f6 00 04             	testb  $0x4,(%eax)
+f01076b7:	0f 84 22 01 00 00    	je     f01077df <syscall+0xe5f>
+	if (pp == zero_page)
+f01076bd:	3b 3d 64 47 79 f0    	cmp    0xf0794764,%edi
+f01076c3:	0f 84 8c 00 00 00    	je     f0107755 <syscall+0xdd5>
+	else if ((np = page_alloc(0)))
+f01076c9:	83 ec 0c             	sub    $0xc,%esp
+f01076cc:	6a 00                	push   $0x0
+f01076ce:	e8 12 9b ff ff       	call   f01011e5 <page_alloc>
+f01076d3:	89 c6                	mov    %eax,%esi
+f01076d5:	83 c4 10             	add    $0x10,%esp
+f01076d8:	85 c0                	test   %eax,%eax
+f01076da:	0f 84 09 01 00 00    	je     f01077e9 <syscall+0xe69>
+	return (pp - pages) << PGSHIFT;
+f01076e0:	8b 15 68 47 79 f0    	mov    0xf0794768,%edx
+f01076e6:	29 d7                	sub    %edx,%edi
+f01076e8:	c1 ff 03             	sar    $0x3,%edi
+f01076eb:	89 f8                	mov    %edi,%eax
+f01076ed:	c1 e0 0c             	shl    $0xc,%eax
+	if (PGNUM(pa) >= npages)
+f01076f0:	8b 0d 74 47 79 f0    	mov    0xf0794774,%ecx
+f01076f6:	81 e7 ff ff 0f 00    	and    $0xfffff,%edi
+f01076fc:	39 cf                	cmp    %ecx,%edi
+f01076fe:	73 72                	jae    f0107772 <syscall+0xdf2>
+	return (void *)(pa + KERNBASE);
+f0107700:	2d 00 00 00 10       	sub    $0x10000000,%eax
+	return (pp - pages) << PGSHIFT;
+f0107705:	89 f7                	mov    %esi,%edi
+f0107707:	29 d7                	sub    %edx,%edi
+f0107709:	c1 ff 03             	sar    $0x3,%edi
+f010770c:	89 fa                	mov    %edi,%edx
+f010770e:	c1 e7 0c             	shl    $0xc,%edi
+	if (PGNUM(pa) >= npages)
+f0107711:	81 e2 ff ff 0f 00    	and    $0xfffff,%edx
+f0107717:	39 ca                	cmp    %ecx,%edx
+f0107719:	73 6c                	jae    f0107787 <syscall+0xe07>
+		memcpy(page2kva(np), page2kva(pp), PGSIZE);
+f010771b:	83 ec 04             	sub    $0x4,%esp
+f010771e:	68 00 10 00 00       	push   $0x1000
+f0107723:	50                   	push   %eax
+	return (void *)(pa + KERNBASE);
+f0107724:	81 ef 00 00 00 10    	sub    $0x10000000,%edi
+f010772a:	57                   	push   %edi
+f010772b:	e8 a2 0e 00 00       	call   f01085d2 <memcpy>
+f0107730:	83 c4 10             	add    $0x10,%esp
+	if ((r = page_insert(edst->env_pgdir, np, dstva, perm)) < 0) {
+f0107733:	ff 75 1c             	push   0x1c(%ebp)
+f0107736:	ff 75 18             	push   0x18(%ebp)
+f0107739:	56                   	push   %esi
+f010773a:	ff 73 60             	push   0x60(%ebx)
+f010773d:	e8 08 a3 ff ff       	call   f0101a4a <page_insert>
+f0107742:	89 c3                	mov    %eax,%ebx
+f0107744:	83 c4 10             	add    $0x10,%esp
+f0107747:	85 c0                	test   %eax,%eax
+f0107749:	78 51                	js     f010779c <syscall+0xe1c>
+	return 0;
+f010774b:	bb 00 00 00 00       	mov    $0x0,%ebx
+      return sys_page_copy((envid_t) a1, (void *) a2, (envid_t) a3,
+f0107750:	e9 c1 f2 ff ff       	jmp    f0106a16 <syscall+0x96>
+		np = page_alloc(ALLOC_ZERO);
+f0107755:	83 ec 0c             	sub    $0xc,%esp
+f0107758:	6a 01                	push   $0x1
+f010775a:	e8 86 9a ff ff       	call   f01011e5 <page_alloc>
+f010775f:	89 c6                	mov    %eax,%esi
+	if (!np)
+f0107761:	83 c4 10             	add    $0x10,%esp
+f0107764:	85 c0                	test   %eax,%eax
+f0107766:	75 cb                	jne    f0107733 <syscall+0xdb3>
+		return -E_NO_MEM;
+f0107768:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+f010776d:	e9 a4 f2 ff ff       	jmp    f0106a16 <syscall+0x96>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0107772:	50                   	push   %eax
+f0107773:	68 90 be 10 f0       	push   $0xf010be90
+f0107778:	68 a4 00 00 00       	push   $0xa4
+f010777d:	68 95 ce 10 f0       	push   $0xf010ce95
+f0107782:	e8 bc 88 ff ff       	call   f0100043 <_panic>
+f0107787:	57                   	push   %edi
+f0107788:	68 90 be 10 f0       	push   $0xf010be90
+f010778d:	68 a4 00 00 00       	push   $0xa4
+f0107792:	68 95 ce 10 f0       	push   $0xf010ce95
+f0107797:	e8 a7 88 ff ff       	call   f0100043 <_panic>
+		page_free(np);
+f010779c:	83 ec 0c             	sub    $0xc,%esp
+f010779f:	56                   	push   %esi
+f01077a0:	e8 cb 9a ff ff       	call   f0101270 <page_free>
+		return r;
+f01077a5:	83 c4 10             	add    $0x10,%esp
+f01077a8:	e9 69 f2 ff ff       	jmp    f0106a16 <syscall+0x96>
+		return -E_INVAL;
+f01077ad:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f01077b2:	e9 5f f2 ff ff       	jmp    f0106a16 <syscall+0x96>
+f01077b7:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f01077bc:	e9 55 f2 ff ff       	jmp    f0106a16 <syscall+0x96>
+f01077c1:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f01077c6:	e9 4b f2 ff ff       	jmp    f0106a16 <syscall+0x96>
+		return -E_INVAL;
+f01077cb:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f01077d0:	e9 41 f2 ff ff       	jmp    f0106a16 <syscall+0x96>
+		return -E_INVAL;
+f01077d5:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f01077da:	e9 37 f2 ff ff       	jmp    f0106a16 <syscall+0x96>
+f01077df:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f01077e4:	e9 2d f2 ff ff       	jmp    f0106a16 <syscall+0x96>
+		return -E_NO_MEM;
+f01077e9:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+f01077ee:	e9 23 f2 ff ff       	jmp    f0106a16 <syscall+0x96>
+  switch (syscallno) {
+f01077f3:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f01077f8:	e9 19 f2 ff ff       	jmp    f0106a16 <syscall+0x96>
+
+f01077fd <stab_binsearch>:
+//	will exit setting left = 118, right = 554.
+//
+static void
+stab_binsearch(const struct Stab *stabs, int *region_left, int *region_right,
+	       int type, uintptr_t addr)
+{
+f01077fd:	55                   	push   %ebp
+f01077fe:	89 e5                	mov    %esp,%ebp
+f0107800:	57                   	push   %edi
+f0107801:	56                   	push   %esi
+f0107802:	53                   	push   %ebx
+f0107803:	83 ec 14             	sub    $0x14,%esp
+f0107806:	89 45 f0             	mov    %eax,-0x10(%ebp)
+f0107809:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f010780c:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	int l = *region_left, r = *region_right, any_matches = 0;
+f010780f:	8b 1a                	mov    (%edx),%ebx
+f0107811:	8b 09                	mov    (%ecx),%ecx
+f0107813:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+
+	while (l <= r) {
+f010781a:	eb 4f                	jmp    f010786b <stab_binsearch+0x6e>
+		int true_m = (l + r) / 2, m = true_m;
+
+		// search for earliest stab with right type
+		while (m >= l && stabs[m].n_type != type)
+			m--;
+f010781c:	83 e8 01             	sub    $0x1,%eax
+		while (m >= l && stabs[m].n_type != type)
+f010781f:	39 c3                	cmp    %eax,%ebx
+f0107821:	0f 8f cc 00 00 00    	jg     f01078f3 <stab_binsearch+0xf6>
+f0107827:	0f b6 0a             	movzbl (%edx),%ecx
+f010782a:	83 ea 0c             	sub    $0xc,%edx
+f010782d:	39 f1                	cmp    %esi,%ecx
+f010782f:	75 eb                	jne    f010781c <stab_binsearch+0x1f>
+f0107831:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+f0107834:	89 75 08             	mov    %esi,0x8(%ebp)
+			continue;
+		}
+
+		// actual binary search
+		any_matches = 1;
+		if (stabs[m].n_value < addr) {
+f0107837:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f010783a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+f010783d:	8b 54 96 08          	mov    0x8(%esi,%edx,4),%edx
+f0107841:	3b 55 0c             	cmp    0xc(%ebp),%edx
+f0107844:	72 16                	jb     f010785c <stab_binsearch+0x5f>
+			*region_left = m;
+			l = true_m + 1;
+		} else if (stabs[m].n_value > addr) {
+f0107846:	39 55 0c             	cmp    %edx,0xc(%ebp)
+f0107849:	73 48                	jae    f0107893 <stab_binsearch+0x96>
+			*region_right = m - 1;
+f010784b:	8d 48 ff             	lea    -0x1(%eax),%ecx
+f010784e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0107851:	89 08                	mov    %ecx,(%eax)
+		any_matches = 1;
+f0107853:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+f010785a:	eb 0f                	jmp    f010786b <stab_binsearch+0x6e>
+			*region_left = m;
+f010785c:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f010785f:	89 06                	mov    %eax,(%esi)
+			l = true_m + 1;
+f0107861:	8d 5f 01             	lea    0x1(%edi),%ebx
+		any_matches = 1;
+f0107864:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+	while (l <= r) {
+f010786b:	39 cb                	cmp    %ecx,%ebx
+f010786d:	7f 38                	jg     f01078a7 <stab_binsearch+0xaa>
+		int true_m = (l + r) / 2, m = true_m;
+f010786f:	8d 04 0b             	lea    (%ebx,%ecx,1),%eax
+f0107872:	89 c2                	mov    %eax,%edx
+f0107874:	c1 ea 1f             	shr    $0x1f,%edx
+f0107877:	01 d0                	add    %edx,%eax
+f0107879:	89 c7                	mov    %eax,%edi
+f010787b:	d1 ff                	sar    %edi
+		while (m >= l && stabs[m].n_type != type)
+f010787d:	83 e0 fe             	and    $0xfffffffe,%eax
+f0107880:	01 f8                	add    %edi,%eax
+f0107882:	8b 55 f0             	mov    -0x10(%ebp),%edx
+f0107885:	8d 54 82 04          	lea    0x4(%edx,%eax,4),%edx
+		int true_m = (l + r) / 2, m = true_m;
+f0107889:	89 f8                	mov    %edi,%eax
+f010788b:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+f010788e:	8b 75 08             	mov    0x8(%ebp),%esi
+		while (m >= l && stabs[m].n_type != type)
+f0107891:	eb 8c                	jmp    f010781f <stab_binsearch+0x22>
+			r = m - 1;
+		} else {
+			// exact match for 'addr', but continue loop to find
+			// *region_right
+			*region_left = m;
+f0107893:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0107896:	89 07                	mov    %eax,(%edi)
+			l = m;
+			addr++;
+f0107898:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+f010789c:	89 c3                	mov    %eax,%ebx
+		any_matches = 1;
+f010789e:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+f01078a5:	eb c4                	jmp    f010786b <stab_binsearch+0x6e>
+		}
+	}
+
+	if (!any_matches)
+f01078a7:	8b 75 08             	mov    0x8(%ebp),%esi
+f01078aa:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+f01078ae:	75 15                	jne    f01078c5 <stab_binsearch+0xc8>
+		*region_right = *region_left - 1;
+f01078b0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01078b3:	8b 00                	mov    (%eax),%eax
+f01078b5:	83 e8 01             	sub    $0x1,%eax
+f01078b8:	8b 7d e0             	mov    -0x20(%ebp),%edi
+f01078bb:	89 07                	mov    %eax,(%edi)
+		     l > *region_left && stabs[l].n_type != type;
+		     l--)
+			/* do nothing */;
+		*region_left = l;
+	}
+}
+f01078bd:	83 c4 14             	add    $0x14,%esp
+f01078c0:	5b                   	pop    %ebx
+f01078c1:	5e                   	pop    %esi
+f01078c2:	5f                   	pop    %edi
+f01078c3:	5d                   	pop    %ebp
+f01078c4:	c3                   	ret
+		for (l = *region_right;
+f01078c5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01078c8:	8b 00                	mov    (%eax),%eax
+		     l > *region_left && stabs[l].n_type != type;
+f01078ca:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f01078cd:	8b 0f                	mov    (%edi),%ecx
+f01078cf:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f01078d2:	8b 7d f0             	mov    -0x10(%ebp),%edi
+f01078d5:	8d 54 97 04          	lea    0x4(%edi,%edx,4),%edx
+f01078d9:	39 c1                	cmp    %eax,%ecx
+f01078db:	7d 0f                	jge    f01078ec <stab_binsearch+0xef>
+f01078dd:	0f b6 1a             	movzbl (%edx),%ebx
+f01078e0:	83 ea 0c             	sub    $0xc,%edx
+f01078e3:	39 f3                	cmp    %esi,%ebx
+f01078e5:	74 05                	je     f01078ec <stab_binsearch+0xef>
+		     l--)
+f01078e7:	83 e8 01             	sub    $0x1,%eax
+f01078ea:	eb ed                	jmp    f01078d9 <stab_binsearch+0xdc>
+		*region_left = l;
+f01078ec:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f01078ef:	89 07                	mov    %eax,(%edi)
+}
+f01078f1:	eb ca                	jmp    f01078bd <stab_binsearch+0xc0>
+			l = true_m + 1;
+f01078f3:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+f01078f6:	89 75 08             	mov    %esi,0x8(%ebp)
+f01078f9:	8d 5f 01             	lea    0x1(%edi),%ebx
+			continue;
+f01078fc:	e9 6a ff ff ff       	jmp    f010786b <stab_binsearch+0x6e>
+
+f0107901 <debuginfo_eip>:
+//	negative if not.  But even if it returns negative it has stored some
+//	information into '*info'.
+//
+int
+debuginfo_eip(uintptr_t addr, struct Eipdebuginfo *info)
+{
+f0107901:	55                   	push   %ebp
+f0107902:	89 e5                	mov    %esp,%ebp
+f0107904:	57                   	push   %edi
+f0107905:	56                   	push   %esi
+f0107906:	53                   	push   %ebx
+f0107907:	83 ec 3c             	sub    $0x3c,%esp
+	const struct Stab *stabs, *stab_end;
+	const char *stabstr, *stabstr_end;
+	int lfile, rfile, lfun, rfun, lline, rline;
+
+	// Initialize *info
+	info->eip_file = "<unknown>";
+f010790a:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010790d:	c7 00 98 d8 10 f0    	movl   $0xf010d898,(%eax)
+	info->eip_line = 0;
+f0107913:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	info->eip_fn_name = "<unknown>";
+f010791a:	c7 40 08 98 d8 10 f0 	movl   $0xf010d898,0x8(%eax)
+	info->eip_fn_namelen = 9;
+f0107921:	c7 40 0c 09 00 00 00 	movl   $0x9,0xc(%eax)
+	info->eip_fn_addr = addr;
+f0107928:	8b 7d 08             	mov    0x8(%ebp),%edi
+f010792b:	89 78 10             	mov    %edi,0x10(%eax)
+	info->eip_fn_narg = 0;
+f010792e:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+
+	// Find the relevant set of stabs
+	if (addr >= ULIM) {
+f0107935:	81 ff ff ff 7f ef    	cmp    $0xef7fffff,%edi
+f010793b:	0f 86 2b 01 00 00    	jbe    f0107a6c <debuginfo_eip+0x16b>
+		stabs = __STAB_BEGIN__;
+		stab_end = __STAB_END__;
+		stabstr = __STABSTR_BEGIN__;
+		stabstr_end = __STABSTR_END__;
+f0107941:	c7 45 c4 c1 e3 10 f0 	movl   $0xf010e3c1,-0x3c(%ebp)
+		stabstr = __STABSTR_BEGIN__;
+f0107948:	c7 45 c0 c1 e3 10 f0 	movl   $0xf010e3c1,-0x40(%ebp)
+		stab_end = __STAB_END__;
+f010794f:	be c0 e3 10 f0       	mov    $0xf010e3c0,%esi
+		stabs = __STAB_BEGIN__;
+f0107954:	bf c0 e3 10 f0       	mov    $0xf010e3c0,%edi
+		if (user_mem_check(curenv, stabs, stab_end - stabs, PTE_P) < 0) return -1;
+		if (user_mem_check(curenv, stabstr, stabstr_end - stabstr, PTE_P) < 0) return -1;
+	}
+
+	// String table validity checks
+	if (stabstr_end <= stabstr || stabstr_end[-1] != 0)
+f0107959:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+f010795c:	39 4d c0             	cmp    %ecx,-0x40(%ebp)
+f010795f:	0f 83 3e 02 00 00    	jae    f0107ba3 <debuginfo_eip+0x2a2>
+f0107965:	80 79 ff 00          	cmpb   $0x0,-0x1(%ecx)
+f0107969:	0f 85 3b 02 00 00    	jne    f0107baa <debuginfo_eip+0x2a9>
+	// 'eip'.  First, we find the basic source file containing 'eip'.
+	// Then, we look in that source file for the function.  Then we look
+	// for the line number.
+
+	// Search the entire set of stabs for the source file (type N_SO).
+	lfile = 0;
+f010796f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	rfile = (stab_end - stabs) - 1;
+f0107976:	29 fe                	sub    %edi,%esi
+f0107978:	c1 fe 02             	sar    $0x2,%esi
+f010797b:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+f0107981:	83 e8 01             	sub    $0x1,%eax
+f0107984:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	stab_binsearch(stabs, &lfile, &rfile, N_SO, addr);
+f0107987:	83 ec 08             	sub    $0x8,%esp
+f010798a:	ff 75 08             	push   0x8(%ebp)
+f010798d:	6a 64                	push   $0x64
+f010798f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f0107992:	89 c1                	mov    %eax,%ecx
+f0107994:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+f0107997:	89 f8                	mov    %edi,%eax
+f0107999:	e8 5f fe ff ff       	call   f01077fd <stab_binsearch>
+	if (lfile == 0)
+f010799e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f01079a1:	83 c4 10             	add    $0x10,%esp
+f01079a4:	85 f6                	test   %esi,%esi
+f01079a6:	0f 84 05 02 00 00    	je     f0107bb1 <debuginfo_eip+0x2b0>
+		return -1;
+
+	// Search within that file's stabs for the function definition
+	// (N_FUN).
+	lfun = lfile;
+f01079ac:	89 75 dc             	mov    %esi,-0x24(%ebp)
+	rfun = rfile;
+f01079af:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f01079b2:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+	stab_binsearch(stabs, &lfun, &rfun, N_FUN, addr);
+f01079b5:	83 ec 08             	sub    $0x8,%esp
+f01079b8:	ff 75 08             	push   0x8(%ebp)
+f01079bb:	6a 24                	push   $0x24
+f01079bd:	8d 45 d8             	lea    -0x28(%ebp),%eax
+f01079c0:	89 c1                	mov    %eax,%ecx
+f01079c2:	8d 55 dc             	lea    -0x24(%ebp),%edx
+f01079c5:	89 f8                	mov    %edi,%eax
+f01079c7:	e8 31 fe ff ff       	call   f01077fd <stab_binsearch>
+
+	if (lfun <= rfun) {
+f01079cc:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f01079cf:	89 45 bc             	mov    %eax,-0x44(%ebp)
+f01079d2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f01079d5:	89 55 b8             	mov    %edx,-0x48(%ebp)
+f01079d8:	83 c4 10             	add    $0x10,%esp
+f01079db:	39 d0                	cmp    %edx,%eax
+f01079dd:	0f 8f 30 01 00 00    	jg     f0107b13 <debuginfo_eip+0x212>
+		// stabs[lfun] points to the function name
+		// in the string table, but check bounds just in case.
+		if (stabs[lfun].n_strx < stabstr_end - stabstr)
+f01079e3:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f01079e6:	8d 14 87             	lea    (%edi,%eax,4),%edx
+f01079e9:	8b 02                	mov    (%edx),%eax
+f01079eb:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+f01079ee:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+f01079f1:	29 d9                	sub    %ebx,%ecx
+f01079f3:	39 c8                	cmp    %ecx,%eax
+f01079f5:	73 08                	jae    f01079ff <debuginfo_eip+0xfe>
+			info->eip_fn_name = stabstr + stabs[lfun].n_strx;
+f01079f7:	01 d8                	add    %ebx,%eax
+f01079f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f01079fc:	89 43 08             	mov    %eax,0x8(%ebx)
+		info->eip_fn_addr = stabs[lfun].n_value;
+f01079ff:	8b 42 08             	mov    0x8(%edx),%eax
+		addr -= info->eip_fn_addr;
+f0107a02:	29 45 08             	sub    %eax,0x8(%ebp)
+		// Search within the function definition for the line number.
+		lline = lfun;
+		rline = rfun;
+f0107a05:	8b 55 bc             	mov    -0x44(%ebp),%edx
+f0107a08:	8b 5d b8             	mov    -0x48(%ebp),%ebx
+		info->eip_fn_addr = stabs[lfun].n_value;
+f0107a0b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0107a0e:	89 41 10             	mov    %eax,0x10(%ecx)
+		lline = lfun;
+f0107a11:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+		rline = rfun;
+f0107a14:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+		info->eip_fn_addr = addr;
+		lline = lfile;
+		rline = rfile;
+	}
+	// Ignore stuff after the colon.
+	info->eip_fn_namelen = strfind(info->eip_fn_name, ':') - info->eip_fn_name;
+f0107a17:	83 ec 08             	sub    $0x8,%esp
+f0107a1a:	6a 3a                	push   $0x3a
+f0107a1c:	ff 71 08             	push   0x8(%ecx)
+f0107a1f:	e8 fb 0a 00 00       	call   f010851f <strfind>
+f0107a24:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0107a27:	2b 43 08             	sub    0x8(%ebx),%eax
+f0107a2a:	89 43 0c             	mov    %eax,0xc(%ebx)
+	// Hint:
+	//	There's a particular stabs type used for line numbers.
+	//	Look at the STABS documentation and <inc/stab.h> to find
+	//	which one.
+	// Your code here.
+  stab_binsearch(stabs, &lline, &rline, N_SLINE, addr);
+f0107a2d:	83 c4 08             	add    $0x8,%esp
+f0107a30:	ff 75 08             	push   0x8(%ebp)
+f0107a33:	6a 44                	push   $0x44
+f0107a35:	8d 4d d0             	lea    -0x30(%ebp),%ecx
+f0107a38:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+f0107a3b:	89 f8                	mov    %edi,%eax
+f0107a3d:	e8 bb fd ff ff       	call   f01077fd <stab_binsearch>
+	if (lline <= rline) {
+f0107a42:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0107a45:	83 c4 10             	add    $0x10,%esp
+f0107a48:	3b 45 d0             	cmp    -0x30(%ebp),%eax
+f0107a4b:	0f 8f 67 01 00 00    	jg     f0107bb8 <debuginfo_eip+0x2b7>
+    info->eip_line = stabs[lline].n_value;
+f0107a51:	89 c2                	mov    %eax,%edx
+f0107a53:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f0107a56:	c1 e0 02             	shl    $0x2,%eax
+f0107a59:	8b 4c 07 08          	mov    0x8(%edi,%eax,1),%ecx
+f0107a5d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0107a60:	89 4b 04             	mov    %ecx,0x4(%ebx)
+	// Search backwards from the line number for the relevant filename
+	// stab.
+	// We can't just use the "lfile" stab because inlined functions
+	// can interpolate code from a different file!
+	// Such included source files use the N_SOL stab type.
+	while (lline >= lfile
+f0107a63:	8d 44 07 04          	lea    0x4(%edi,%eax,1),%eax
+f0107a67:	e9 b7 00 00 00       	jmp    f0107b23 <debuginfo_eip+0x222>
+		if (user_mem_check(curenv, usd, sizeof(struct UserStabData), PTE_P) < 0) return -1;
+f0107a6c:	e8 c6 11 00 00       	call   f0108c37 <cpunum>
+f0107a71:	6a 01                	push   $0x1
+f0107a73:	6a 10                	push   $0x10
+f0107a75:	68 00 00 20 00       	push   $0x200000
+f0107a7a:	6b c0 78             	imul   $0x78,%eax,%eax
+f0107a7d:	ff b0 28 60 7d f0    	push   -0xf829fd8(%eax)
+f0107a83:	e8 33 c0 ff ff       	call   f0103abb <user_mem_check>
+f0107a88:	83 c4 10             	add    $0x10,%esp
+f0107a8b:	85 c0                	test   %eax,%eax
+f0107a8d:	0f 88 02 01 00 00    	js     f0107b95 <debuginfo_eip+0x294>
+		stabs = usd->stabs;
+f0107a93:	8b 3d 00 00 20 00    	mov    0x200000,%edi
+		stab_end = usd->stab_end;
+f0107a99:	8b 35 04 00 20 00    	mov    0x200004,%esi
+		stabstr = usd->stabstr;
+f0107a9f:	8b 1d 08 00 20 00    	mov    0x200008,%ebx
+f0107aa5:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+		stabstr_end = usd->stabstr_end;
+f0107aa8:	8b 15 0c 00 20 00    	mov    0x20000c,%edx
+f0107aae:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+		if (user_mem_check(curenv, stabs, stab_end - stabs, PTE_P) < 0) return -1;
+f0107ab1:	e8 81 11 00 00       	call   f0108c37 <cpunum>
+f0107ab6:	89 c2                	mov    %eax,%edx
+f0107ab8:	6a 01                	push   $0x1
+f0107aba:	89 f0                	mov    %esi,%eax
+f0107abc:	29 f8                	sub    %edi,%eax
+f0107abe:	c1 f8 02             	sar    $0x2,%eax
+f0107ac1:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0107ac7:	50                   	push   %eax
+f0107ac8:	57                   	push   %edi
+f0107ac9:	6b d2 78             	imul   $0x78,%edx,%edx
+f0107acc:	ff b2 28 60 7d f0    	push   -0xf829fd8(%edx)
+f0107ad2:	e8 e4 bf ff ff       	call   f0103abb <user_mem_check>
+f0107ad7:	83 c4 10             	add    $0x10,%esp
+f0107ada:	85 c0                	test   %eax,%eax
+f0107adc:	0f 88 ba 00 00 00    	js     f0107b9c <debuginfo_eip+0x29b>
+		if (user_mem_check(curenv, stabstr, stabstr_end - stabstr, PTE_P) < 0) return -1;
+f0107ae2:	e8 50 11 00 00       	call   f0108c37 <cpunum>
+f0107ae7:	6a 01                	push   $0x1
+f0107ae9:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+f0107aec:	29 da                	sub    %ebx,%edx
+f0107aee:	52                   	push   %edx
+f0107aef:	53                   	push   %ebx
+f0107af0:	6b c0 78             	imul   $0x78,%eax,%eax
+f0107af3:	ff b0 28 60 7d f0    	push   -0xf829fd8(%eax)
+f0107af9:	e8 bd bf ff ff       	call   f0103abb <user_mem_check>
+f0107afe:	83 c4 10             	add    $0x10,%esp
+f0107b01:	85 c0                	test   %eax,%eax
+f0107b03:	0f 89 50 fe ff ff    	jns    f0107959 <debuginfo_eip+0x58>
+f0107b09:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0107b0e:	e9 b1 00 00 00       	jmp    f0107bc4 <debuginfo_eip+0x2c3>
+f0107b13:	8b 45 08             	mov    0x8(%ebp),%eax
+f0107b16:	89 f2                	mov    %esi,%edx
+f0107b18:	e9 ee fe ff ff       	jmp    f0107a0b <debuginfo_eip+0x10a>
+	       && stabs[lline].n_type != N_SOL
+	       && (stabs[lline].n_type != N_SO || !stabs[lline].n_value))
+		lline--;
+f0107b1d:	83 ea 01             	sub    $0x1,%edx
+f0107b20:	83 e8 0c             	sub    $0xc,%eax
+	       && (stabs[lline].n_type != N_SO || !stabs[lline].n_value))
+f0107b23:	39 d6                	cmp    %edx,%esi
+f0107b25:	7f 31                	jg     f0107b58 <debuginfo_eip+0x257>
+	       && stabs[lline].n_type != N_SOL
+f0107b27:	0f b6 08             	movzbl (%eax),%ecx
+f0107b2a:	80 f9 84             	cmp    $0x84,%cl
+f0107b2d:	74 0b                	je     f0107b3a <debuginfo_eip+0x239>
+	       && (stabs[lline].n_type != N_SO || !stabs[lline].n_value))
+f0107b2f:	80 f9 64             	cmp    $0x64,%cl
+f0107b32:	75 e9                	jne    f0107b1d <debuginfo_eip+0x21c>
+f0107b34:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+f0107b38:	74 e3                	je     f0107b1d <debuginfo_eip+0x21c>
+	if (lline >= lfile && stabs[lline].n_strx < stabstr_end - stabstr)
+f0107b3a:	8d 04 52             	lea    (%edx,%edx,2),%eax
+f0107b3d:	8b 14 87             	mov    (%edi,%eax,4),%edx
+f0107b40:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f0107b43:	8b 75 c0             	mov    -0x40(%ebp),%esi
+f0107b46:	29 f0                	sub    %esi,%eax
+f0107b48:	39 c2                	cmp    %eax,%edx
+f0107b4a:	73 0c                	jae    f0107b58 <debuginfo_eip+0x257>
+		info->eip_file = stabstr + stabs[lline].n_strx;
+f0107b4c:	8b 45 c0             	mov    -0x40(%ebp),%eax
+f0107b4f:	01 d0                	add    %edx,%eax
+f0107b51:	89 c2                	mov    %eax,%edx
+f0107b53:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0107b56:	89 10                	mov    %edx,(%eax)
+		for (lline = lfun + 1;
+		     lline < rfun && stabs[lline].n_type == N_PSYM;
+		     lline++)
+			info->eip_fn_narg++;
+
+	return 0;
+f0107b58:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (lfun < rfun)
+f0107b5d:	8b 5d bc             	mov    -0x44(%ebp),%ebx
+f0107b60:	8b 75 b8             	mov    -0x48(%ebp),%esi
+f0107b63:	39 f3                	cmp    %esi,%ebx
+f0107b65:	7d 5d                	jge    f0107bc4 <debuginfo_eip+0x2c3>
+		for (lline = lfun + 1;
+f0107b67:	89 d8                	mov    %ebx,%eax
+f0107b69:	83 c0 01             	add    $0x1,%eax
+f0107b6c:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0107b6f:	8d 54 97 04          	lea    0x4(%edi,%edx,4),%edx
+f0107b73:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0107b76:	eb 04                	jmp    f0107b7c <debuginfo_eip+0x27b>
+			info->eip_fn_narg++;
+f0107b78:	83 43 14 01          	addl   $0x1,0x14(%ebx)
+		     lline < rfun && stabs[lline].n_type == N_PSYM;
+f0107b7c:	39 c6                	cmp    %eax,%esi
+f0107b7e:	7e 3f                	jle    f0107bbf <debuginfo_eip+0x2be>
+f0107b80:	0f b6 0a             	movzbl (%edx),%ecx
+f0107b83:	83 c0 01             	add    $0x1,%eax
+f0107b86:	83 c2 0c             	add    $0xc,%edx
+f0107b89:	80 f9 a0             	cmp    $0xa0,%cl
+f0107b8c:	74 ea                	je     f0107b78 <debuginfo_eip+0x277>
+	return 0;
+f0107b8e:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107b93:	eb 2f                	jmp    f0107bc4 <debuginfo_eip+0x2c3>
+		if (user_mem_check(curenv, usd, sizeof(struct UserStabData), PTE_P) < 0) return -1;
+f0107b95:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0107b9a:	eb 28                	jmp    f0107bc4 <debuginfo_eip+0x2c3>
+		if (user_mem_check(curenv, stabs, stab_end - stabs, PTE_P) < 0) return -1;
+f0107b9c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0107ba1:	eb 21                	jmp    f0107bc4 <debuginfo_eip+0x2c3>
+		return -1;
+f0107ba3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0107ba8:	eb 1a                	jmp    f0107bc4 <debuginfo_eip+0x2c3>
+f0107baa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0107baf:	eb 13                	jmp    f0107bc4 <debuginfo_eip+0x2c3>
+		return -1;
+f0107bb1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0107bb6:	eb 0c                	jmp    f0107bc4 <debuginfo_eip+0x2c3>
+    return -1;
+f0107bb8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0107bbd:	eb 05                	jmp    f0107bc4 <debuginfo_eip+0x2c3>
+	return 0;
+f0107bbf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0107bc4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107bc7:	5b                   	pop    %ebx
+f0107bc8:	5e                   	pop    %esi
+f0107bc9:	5f                   	pop    %edi
+f0107bca:	5d                   	pop    %ebp
+f0107bcb:	c3                   	ret
+
+f0107bcc <cpuid_print>:
+	return feature[bit / 32] & BIT(bit % 32);
+}
+
+void
+cpuid_print(void)
+{
+f0107bcc:	55                   	push   %ebp
+f0107bcd:	89 e5                	mov    %esp,%ebp
+f0107bcf:	57                   	push   %edi
+f0107bd0:	56                   	push   %esi
+f0107bd1:	53                   	push   %ebx
+f0107bd2:	83 ec 6c             	sub    $0x6c,%esp
+	uint32_t eax, brand[12], feature[CPUID_NR_FLAGS] = {0};
+f0107bd5:	c7 45 ac 00 00 00 00 	movl   $0x0,-0x54(%ebp)
+	asm volatile("cpuid"
+f0107bdc:	b8 00 00 00 80       	mov    $0x80000000,%eax
+f0107be1:	0f a2                	cpuid
+
+	cpuid(0x80000000, &eax, NULL, NULL, NULL);
+	if (eax < 0x80000004)
+f0107be3:	3d 03 00 00 80       	cmp    $0x80000003,%eax
+f0107be8:	76 78                	jbe    f0107c62 <cpuid_print+0x96>
+f0107bea:	b8 02 00 00 80       	mov    $0x80000002,%eax
+f0107bef:	0f a2                	cpuid
+		*eaxp = eax;
+f0107bf1:	89 45 b8             	mov    %eax,-0x48(%ebp)
+		*ebxp = ebx;
+f0107bf4:	89 5d bc             	mov    %ebx,-0x44(%ebp)
+		*ecxp = ecx;
+f0107bf7:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+		*edxp = edx;
+f0107bfa:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+	asm volatile("cpuid"
+f0107bfd:	b8 03 00 00 80       	mov    $0x80000003,%eax
+f0107c02:	0f a2                	cpuid
+		*eaxp = eax;
+f0107c04:	89 45 c8             	mov    %eax,-0x38(%ebp)
+		*ebxp = ebx;
+f0107c07:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+		*ecxp = ecx;
+f0107c0a:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		*edxp = edx;
+f0107c0d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+	asm volatile("cpuid"
+f0107c10:	b8 04 00 00 80       	mov    $0x80000004,%eax
+f0107c15:	0f a2                	cpuid
+		*eaxp = eax;
+f0107c17:	89 45 d8             	mov    %eax,-0x28(%ebp)
+		*ebxp = ebx;
+f0107c1a:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		*ecxp = ecx;
+f0107c1d:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+		*edxp = edx;
+f0107c20:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+		panic("CPU too old!");
+
+	cpuid(0x80000002, &brand[0], &brand[1], &brand[2], &brand[3]);
+	cpuid(0x80000003, &brand[4], &brand[5], &brand[6], &brand[7]);
+	cpuid(0x80000004, &brand[8], &brand[9], &brand[10], &brand[11]);
+	cprintf("CPU: %.48s\n", brand);
+f0107c23:	83 ec 08             	sub    $0x8,%esp
+f0107c26:	8d 45 b8             	lea    -0x48(%ebp),%eax
+f0107c29:	50                   	push   %eax
+f0107c2a:	68 bb d8 10 f0       	push   $0xf010d8bb
+f0107c2f:	e8 81 cf ff ff       	call   f0104bb5 <cprintf>
+	asm volatile("cpuid"
+f0107c34:	b8 01 00 00 00       	mov    $0x1,%eax
+f0107c39:	0f a2                	cpuid
+f0107c3b:	89 55 90             	mov    %edx,-0x70(%ebp)
+		*ecxp = ecx;
+f0107c3e:	89 4d a8             	mov    %ecx,-0x58(%ebp)
+		*edxp = edx;
+f0107c41:	89 55 a4             	mov    %edx,-0x5c(%ebp)
+	asm volatile("cpuid"
+f0107c44:	b8 01 00 00 80       	mov    $0x80000001,%eax
+f0107c49:	0f a2                	cpuid
+		*ecxp = ecx;
+f0107c4b:	89 4d b4             	mov    %ecx,-0x4c(%ebp)
+		*edxp = edx;
+f0107c4e:	89 55 b0             	mov    %edx,-0x50(%ebp)
+f0107c51:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < CPUID_NR_FLAGS; ++i) {
+f0107c54:	c7 45 94 00 00 00 00 	movl   $0x0,-0x6c(%ebp)
+f0107c5b:	be 00 00 00 00       	mov    $0x0,%esi
+f0107c60:	eb 61                	jmp    f0107cc3 <cpuid_print+0xf7>
+		panic("CPU too old!");
+f0107c62:	83 ec 04             	sub    $0x4,%esp
+f0107c65:	68 a2 d8 10 f0       	push   $0xf010d8a2
+f0107c6a:	68 8d 00 00 00       	push   $0x8d
+f0107c6f:	68 af d8 10 f0       	push   $0xf010d8af
+f0107c74:	e8 ca 83 ff ff       	call   f0100043 <_panic>
+				cprintf(" %s", name);
+f0107c79:	83 ec 08             	sub    $0x8,%esp
+f0107c7c:	50                   	push   %eax
+f0107c7d:	68 d0 be 10 f0       	push   $0xf010bed0
+f0107c82:	e8 2e cf ff ff       	call   f0104bb5 <cprintf>
+f0107c87:	83 c4 10             	add    $0x10,%esp
+		for (j = 0; j < 32; ++j) {
+f0107c8a:	83 c3 01             	add    $0x1,%ebx
+f0107c8d:	83 fb 20             	cmp    $0x20,%ebx
+f0107c90:	74 12                	je     f0107ca4 <cpuid_print+0xd8>
+			const char *name = names[CPUID_BIT(i, j)];
+f0107c92:	8b 84 9e 20 db 10 f0 	mov    -0xfef24e0(%esi,%ebx,4),%eax
+			if ((feature[i] & BIT(j)) && name)
+f0107c99:	0f a3 df             	bt     %ebx,%edi
+f0107c9c:	73 ec                	jae    f0107c8a <cpuid_print+0xbe>
+f0107c9e:	85 c0                	test   %eax,%eax
+f0107ca0:	74 e8                	je     f0107c8a <cpuid_print+0xbe>
+f0107ca2:	eb d5                	jmp    f0107c79 <cpuid_print+0xad>
+		cprintf("\n");
+f0107ca4:	83 ec 0c             	sub    $0xc,%esp
+f0107ca7:	68 84 d1 10 f0       	push   $0xf010d184
+f0107cac:	e8 04 cf ff ff       	call   f0104bb5 <cprintf>
+f0107cb1:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < CPUID_NR_FLAGS; ++i) {
+f0107cb4:	83 45 94 01          	addl   $0x1,-0x6c(%ebp)
+f0107cb8:	8b 45 94             	mov    -0x6c(%ebp),%eax
+f0107cbb:	83 ee 80             	sub    $0xffffff80,%esi
+f0107cbe:	83 f8 05             	cmp    $0x5,%eax
+f0107cc1:	74 22                	je     f0107ce5 <cpuid_print+0x119>
+		if (!feature[i])
+f0107cc3:	8b 45 94             	mov    -0x6c(%ebp),%eax
+f0107cc6:	8b 7c 85 a4          	mov    -0x5c(%ebp,%eax,4),%edi
+f0107cca:	85 ff                	test   %edi,%edi
+f0107ccc:	74 e6                	je     f0107cb4 <cpuid_print+0xe8>
+		cprintf(" ");
+f0107cce:	83 ec 0c             	sub    $0xc,%esp
+f0107cd1:	68 42 c2 10 f0       	push   $0xf010c242
+f0107cd6:	e8 da ce ff ff       	call   f0104bb5 <cprintf>
+f0107cdb:	83 c4 10             	add    $0x10,%esp
+		for (j = 0; j < 32; ++j) {
+f0107cde:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0107ce3:	eb ad                	jmp    f0107c92 <cpuid_print+0xc6>
+	      &feature[CPUID_1_ECX], &feature[CPUID_1_EDX]);
+	cpuid(0x80000001, NULL, NULL,
+	      &feature[CPUID_80000001_ECX], &feature[CPUID_80000001_EDX]);
+	print_feature(feature);
+	// Check feature bits.
+	assert(cpuid_has(feature, CPUID_FEATURE_PSE));
+f0107ce5:	f6 45 90 08          	testb  $0x8,-0x70(%ebp)
+f0107ce9:	74 11                	je     f0107cfc <cpuid_print+0x130>
+	assert(cpuid_has(feature, CPUID_FEATURE_APIC));
+f0107ceb:	f7 45 90 00 02 00 00 	testl  $0x200,-0x70(%ebp)
+f0107cf2:	74 21                	je     f0107d15 <cpuid_print+0x149>
+}
+f0107cf4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107cf7:	5b                   	pop    %ebx
+f0107cf8:	5e                   	pop    %esi
+f0107cf9:	5f                   	pop    %edi
+f0107cfa:	5d                   	pop    %ebp
+f0107cfb:	c3                   	ret
+	assert(cpuid_has(feature, CPUID_FEATURE_PSE));
+f0107cfc:	68 c0 da 10 f0       	push   $0xf010dac0
+f0107d01:	68 bf be 10 f0       	push   $0xf010bebf
+f0107d06:	68 9a 00 00 00       	push   $0x9a
+f0107d0b:	68 af d8 10 f0       	push   $0xf010d8af
+f0107d10:	e8 2e 83 ff ff       	call   f0100043 <_panic>
+	assert(cpuid_has(feature, CPUID_FEATURE_APIC));
+f0107d15:	68 e8 da 10 f0       	push   $0xf010dae8
+f0107d1a:	68 bf be 10 f0       	push   $0xf010bebf
+f0107d1f:	68 9b 00 00 00       	push   $0x9b
+f0107d24:	68 af d8 10 f0       	push   $0xf010d8af
+f0107d29:	e8 15 83 ff ff       	call   f0100043 <_panic>
+
+f0107d2e <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+f0107d2e:	55                   	push   %ebp
+f0107d2f:	89 e5                	mov    %esp,%ebp
+f0107d31:	57                   	push   %edi
+f0107d32:	56                   	push   %esi
+f0107d33:	53                   	push   %ebx
+f0107d34:	83 ec 1c             	sub    $0x1c,%esp
+f0107d37:	89 c7                	mov    %eax,%edi
+f0107d39:	89 d6                	mov    %edx,%esi
+f0107d3b:	8b 45 08             	mov    0x8(%ebp),%eax
+f0107d3e:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0107d41:	89 d1                	mov    %edx,%ecx
+f0107d43:	89 c2                	mov    %eax,%edx
+f0107d45:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f0107d48:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f0107d4b:	8b 45 10             	mov    0x10(%ebp),%eax
+f0107d4e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+f0107d51:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0107d54:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+f0107d5b:	39 c2                	cmp    %eax,%edx
+f0107d5d:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+f0107d60:	72 3e                	jb     f0107da0 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+f0107d62:	83 ec 0c             	sub    $0xc,%esp
+f0107d65:	ff 75 18             	push   0x18(%ebp)
+f0107d68:	83 eb 01             	sub    $0x1,%ebx
+f0107d6b:	53                   	push   %ebx
+f0107d6c:	50                   	push   %eax
+f0107d6d:	83 ec 08             	sub    $0x8,%esp
+f0107d70:	ff 75 e4             	push   -0x1c(%ebp)
+f0107d73:	ff 75 e0             	push   -0x20(%ebp)
+f0107d76:	ff 75 dc             	push   -0x24(%ebp)
+f0107d79:	ff 75 d8             	push   -0x28(%ebp)
+f0107d7c:	e8 30 3f 00 00       	call   f010bcb1 <__udivdi3>
+f0107d81:	83 c4 18             	add    $0x18,%esp
+f0107d84:	52                   	push   %edx
+f0107d85:	50                   	push   %eax
+f0107d86:	89 f2                	mov    %esi,%edx
+f0107d88:	89 f8                	mov    %edi,%eax
+f0107d8a:	e8 9f ff ff ff       	call   f0107d2e <printnum>
+f0107d8f:	83 c4 20             	add    $0x20,%esp
+f0107d92:	eb 13                	jmp    f0107da7 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+f0107d94:	83 ec 08             	sub    $0x8,%esp
+f0107d97:	56                   	push   %esi
+f0107d98:	ff 75 18             	push   0x18(%ebp)
+f0107d9b:	ff d7                	call   *%edi
+f0107d9d:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+f0107da0:	83 eb 01             	sub    $0x1,%ebx
+f0107da3:	85 db                	test   %ebx,%ebx
+f0107da5:	7f ed                	jg     f0107d94 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+f0107da7:	83 ec 08             	sub    $0x8,%esp
+f0107daa:	56                   	push   %esi
+f0107dab:	83 ec 04             	sub    $0x4,%esp
+f0107dae:	ff 75 e4             	push   -0x1c(%ebp)
+f0107db1:	ff 75 e0             	push   -0x20(%ebp)
+f0107db4:	ff 75 dc             	push   -0x24(%ebp)
+f0107db7:	ff 75 d8             	push   -0x28(%ebp)
+f0107dba:	e8 10 3f 00 00       	call   f010bccf <__umoddi3>
+f0107dbf:	83 c4 14             	add    $0x14,%esp
+f0107dc2:	0f be 80 a0 dd 10 f0 	movsbl -0xfef2260(%eax),%eax
+f0107dc9:	50                   	push   %eax
+f0107dca:	ff d7                	call   *%edi
+}
+f0107dcc:	83 c4 10             	add    $0x10,%esp
+f0107dcf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107dd2:	5b                   	pop    %ebx
+f0107dd3:	5e                   	pop    %esi
+f0107dd4:	5f                   	pop    %edi
+f0107dd5:	5d                   	pop    %ebp
+f0107dd6:	c3                   	ret
+
+f0107dd7 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+f0107dd7:	55                   	push   %ebp
+f0107dd8:	89 e5                	mov    %esp,%ebp
+f0107dda:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+f0107ddd:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+f0107de1:	8b 10                	mov    (%eax),%edx
+f0107de3:	3b 50 04             	cmp    0x4(%eax),%edx
+f0107de6:	73 0a                	jae    f0107df2 <sprintputch+0x1b>
+		*b->buf++ = ch;
+f0107de8:	8d 4a 01             	lea    0x1(%edx),%ecx
+f0107deb:	89 08                	mov    %ecx,(%eax)
+f0107ded:	8b 45 08             	mov    0x8(%ebp),%eax
+f0107df0:	88 02                	mov    %al,(%edx)
+}
+f0107df2:	5d                   	pop    %ebp
+f0107df3:	c3                   	ret
+
+f0107df4 <printfmt>:
+{
+f0107df4:	55                   	push   %ebp
+f0107df5:	89 e5                	mov    %esp,%ebp
+f0107df7:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+f0107dfa:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+f0107dfd:	50                   	push   %eax
+f0107dfe:	ff 75 10             	push   0x10(%ebp)
+f0107e01:	ff 75 0c             	push   0xc(%ebp)
+f0107e04:	ff 75 08             	push   0x8(%ebp)
+f0107e07:	e8 05 00 00 00       	call   f0107e11 <vprintfmt>
+}
+f0107e0c:	83 c4 10             	add    $0x10,%esp
+f0107e0f:	c9                   	leave
+f0107e10:	c3                   	ret
+
+f0107e11 <vprintfmt>:
+{
+f0107e11:	55                   	push   %ebp
+f0107e12:	89 e5                	mov    %esp,%ebp
+f0107e14:	57                   	push   %edi
+f0107e15:	56                   	push   %esi
+f0107e16:	53                   	push   %ebx
+f0107e17:	83 ec 2c             	sub    $0x2c,%esp
+f0107e1a:	8b 75 08             	mov    0x8(%ebp),%esi
+f0107e1d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0107e20:	8b 7d 10             	mov    0x10(%ebp),%edi
+f0107e23:	eb 0a                	jmp    f0107e2f <vprintfmt+0x1e>
+			putch(ch, putdat);
+f0107e25:	83 ec 08             	sub    $0x8,%esp
+f0107e28:	53                   	push   %ebx
+f0107e29:	50                   	push   %eax
+f0107e2a:	ff d6                	call   *%esi
+f0107e2c:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+f0107e2f:	83 c7 01             	add    $0x1,%edi
+f0107e32:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+f0107e36:	83 f8 25             	cmp    $0x25,%eax
+f0107e39:	74 0c                	je     f0107e47 <vprintfmt+0x36>
+			if (ch == '\0')
+f0107e3b:	85 c0                	test   %eax,%eax
+f0107e3d:	75 e6                	jne    f0107e25 <vprintfmt+0x14>
+}
+f0107e3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107e42:	5b                   	pop    %ebx
+f0107e43:	5e                   	pop    %esi
+f0107e44:	5f                   	pop    %edi
+f0107e45:	5d                   	pop    %ebp
+f0107e46:	c3                   	ret
+		padc = ' ';
+f0107e47:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+f0107e4b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+f0107e52:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+f0107e59:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+f0107e60:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+f0107e65:	8d 47 01             	lea    0x1(%edi),%eax
+f0107e68:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0107e6b:	0f b6 17             	movzbl (%edi),%edx
+f0107e6e:	8d 42 dd             	lea    -0x23(%edx),%eax
+f0107e71:	3c 55                	cmp    $0x55,%al
+f0107e73:	0f 87 cf 03 00 00    	ja     f0108248 <vprintfmt+0x437>
+f0107e79:	0f b6 c0             	movzbl %al,%eax
+f0107e7c:	ff 24 85 80 de 10 f0 	jmp    *-0xfef2180(,%eax,4)
+f0107e83:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+f0107e86:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+f0107e8a:	eb d9                	jmp    f0107e65 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+f0107e8c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0107e8f:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+f0107e93:	eb d0                	jmp    f0107e65 <vprintfmt+0x54>
+f0107e95:	0f b6 d2             	movzbl %dl,%edx
+f0107e98:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+f0107e9b:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107ea0:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+f0107ea3:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f0107ea6:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+f0107eaa:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+f0107ead:	8d 4a d0             	lea    -0x30(%edx),%ecx
+f0107eb0:	83 f9 09             	cmp    $0x9,%ecx
+f0107eb3:	77 55                	ja     f0107f0a <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+f0107eb5:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+f0107eb8:	eb e9                	jmp    f0107ea3 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+f0107eba:	8b 45 14             	mov    0x14(%ebp),%eax
+f0107ebd:	8b 00                	mov    (%eax),%eax
+f0107ebf:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0107ec2:	8b 45 14             	mov    0x14(%ebp),%eax
+f0107ec5:	8d 40 04             	lea    0x4(%eax),%eax
+f0107ec8:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+f0107ecb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+f0107ece:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+f0107ed2:	79 91                	jns    f0107e65 <vprintfmt+0x54>
+				width = precision, precision = -1;
+f0107ed4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0107ed7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0107eda:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+f0107ee1:	eb 82                	jmp    f0107e65 <vprintfmt+0x54>
+			if (width < 0)
+f0107ee3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0107ee6:	85 d2                	test   %edx,%edx
+f0107ee8:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107eed:	0f 49 c2             	cmovns %edx,%eax
+f0107ef0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+f0107ef3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+f0107ef6:	e9 6a ff ff ff       	jmp    f0107e65 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+f0107efb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+f0107efe:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+f0107f05:	e9 5b ff ff ff       	jmp    f0107e65 <vprintfmt+0x54>
+f0107f0a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f0107f0d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0107f10:	eb bc                	jmp    f0107ece <vprintfmt+0xbd>
+			lflag++;
+f0107f12:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+f0107f15:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+f0107f18:	e9 48 ff ff ff       	jmp    f0107e65 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+f0107f1d:	8b 45 14             	mov    0x14(%ebp),%eax
+f0107f20:	8d 78 04             	lea    0x4(%eax),%edi
+f0107f23:	83 ec 08             	sub    $0x8,%esp
+f0107f26:	53                   	push   %ebx
+f0107f27:	ff 30                	push   (%eax)
+f0107f29:	ff d6                	call   *%esi
+			break;
+f0107f2b:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+f0107f2e:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+f0107f31:	e9 b1 02 00 00       	jmp    f01081e7 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+f0107f36:	8b 45 14             	mov    0x14(%ebp),%eax
+f0107f39:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+f0107f3c:	8b 10                	mov    (%eax),%edx
+f0107f3e:	89 d0                	mov    %edx,%eax
+f0107f40:	f7 d8                	neg    %eax
+f0107f42:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+f0107f45:	83 f8 0d             	cmp    $0xd,%eax
+f0107f48:	7f 23                	jg     f0107f6d <vprintfmt+0x15c>
+f0107f4a:	8b 14 85 e0 df 10 f0 	mov    -0xfef2020(,%eax,4),%edx
+f0107f51:	85 d2                	test   %edx,%edx
+f0107f53:	74 18                	je     f0107f6d <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+f0107f55:	52                   	push   %edx
+f0107f56:	68 d1 be 10 f0       	push   $0xf010bed1
+f0107f5b:	53                   	push   %ebx
+f0107f5c:	56                   	push   %esi
+f0107f5d:	e8 92 fe ff ff       	call   f0107df4 <printfmt>
+f0107f62:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+f0107f65:	89 7d 14             	mov    %edi,0x14(%ebp)
+f0107f68:	e9 7a 02 00 00       	jmp    f01081e7 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+f0107f6d:	50                   	push   %eax
+f0107f6e:	68 b8 dd 10 f0       	push   $0xf010ddb8
+f0107f73:	53                   	push   %ebx
+f0107f74:	56                   	push   %esi
+f0107f75:	e8 7a fe ff ff       	call   f0107df4 <printfmt>
+f0107f7a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+f0107f7d:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+f0107f80:	e9 62 02 00 00       	jmp    f01081e7 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+f0107f85:	8b 45 14             	mov    0x14(%ebp),%eax
+f0107f88:	83 c0 04             	add    $0x4,%eax
+f0107f8b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+f0107f8e:	8b 45 14             	mov    0x14(%ebp),%eax
+f0107f91:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+f0107f93:	85 c9                	test   %ecx,%ecx
+f0107f95:	b8 b1 dd 10 f0       	mov    $0xf010ddb1,%eax
+f0107f9a:	0f 45 c1             	cmovne %ecx,%eax
+f0107f9d:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+f0107fa0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+f0107fa4:	7e 06                	jle    f0107fac <vprintfmt+0x19b>
+f0107fa6:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+f0107faa:	75 0b                	jne    f0107fb7 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+f0107fac:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+f0107faf:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f0107fb2:	89 75 08             	mov    %esi,0x8(%ebp)
+f0107fb5:	eb 5c                	jmp    f0108013 <vprintfmt+0x202>
+f0107fb7:	83 ec 08             	sub    $0x8,%esp
+f0107fba:	ff 75 d0             	push   -0x30(%ebp)
+f0107fbd:	ff 75 cc             	push   -0x34(%ebp)
+f0107fc0:	e8 02 04 00 00       	call   f01083c7 <strnlen>
+f0107fc5:	89 c2                	mov    %eax,%edx
+f0107fc7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0107fca:	29 d0                	sub    %edx,%eax
+f0107fcc:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+f0107fcf:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+f0107fd3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0107fd6:	89 75 08             	mov    %esi,0x8(%ebp)
+f0107fd9:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+f0107fdb:	eb 0e                	jmp    f0107feb <vprintfmt+0x1da>
+					putch(padc, putdat);
+f0107fdd:	83 ec 08             	sub    $0x8,%esp
+f0107fe0:	53                   	push   %ebx
+f0107fe1:	57                   	push   %edi
+f0107fe2:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+f0107fe5:	83 ee 01             	sub    $0x1,%esi
+f0107fe8:	83 c4 10             	add    $0x10,%esp
+f0107feb:	85 f6                	test   %esi,%esi
+f0107fed:	7f ee                	jg     f0107fdd <vprintfmt+0x1cc>
+f0107fef:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0107ff2:	8b 75 08             	mov    0x8(%ebp),%esi
+f0107ff5:	85 c0                	test   %eax,%eax
+f0107ff7:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107ffc:	0f 49 d0             	cmovns %eax,%edx
+f0107fff:	29 d0                	sub    %edx,%eax
+f0108001:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0108004:	eb a6                	jmp    f0107fac <vprintfmt+0x19b>
+					putch(ch, putdat);
+f0108006:	83 ec 08             	sub    $0x8,%esp
+f0108009:	53                   	push   %ebx
+f010800a:	52                   	push   %edx
+f010800b:	ff 55 08             	call   *0x8(%ebp)
+f010800e:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+f0108011:	89 f1                	mov    %esi,%ecx
+f0108013:	8d 71 01             	lea    0x1(%ecx),%esi
+f0108016:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+f010801a:	0f be d0             	movsbl %al,%edx
+f010801d:	85 d2                	test   %edx,%edx
+f010801f:	74 28                	je     f0108049 <vprintfmt+0x238>
+f0108021:	85 ff                	test   %edi,%edi
+f0108023:	78 05                	js     f010802a <vprintfmt+0x219>
+f0108025:	83 ef 01             	sub    $0x1,%edi
+f0108028:	78 30                	js     f010805a <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+f010802a:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+f010802e:	74 d6                	je     f0108006 <vprintfmt+0x1f5>
+f0108030:	0f be c0             	movsbl %al,%eax
+f0108033:	83 e8 20             	sub    $0x20,%eax
+f0108036:	83 f8 5e             	cmp    $0x5e,%eax
+f0108039:	76 cb                	jbe    f0108006 <vprintfmt+0x1f5>
+					putch('?', putdat);
+f010803b:	83 ec 08             	sub    $0x8,%esp
+f010803e:	53                   	push   %ebx
+f010803f:	6a 3f                	push   $0x3f
+f0108041:	ff 55 08             	call   *0x8(%ebp)
+f0108044:	83 c4 10             	add    $0x10,%esp
+f0108047:	eb c8                	jmp    f0108011 <vprintfmt+0x200>
+f0108049:	8b 75 08             	mov    0x8(%ebp),%esi
+f010804c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f010804f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0108052:	01 d0                	add    %edx,%eax
+f0108054:	29 c8                	sub    %ecx,%eax
+f0108056:	89 c7                	mov    %eax,%edi
+f0108058:	eb 13                	jmp    f010806d <vprintfmt+0x25c>
+f010805a:	8b 75 08             	mov    0x8(%ebp),%esi
+f010805d:	eb ed                	jmp    f010804c <vprintfmt+0x23b>
+				putch(' ', putdat);
+f010805f:	83 ec 08             	sub    $0x8,%esp
+f0108062:	53                   	push   %ebx
+f0108063:	6a 20                	push   $0x20
+f0108065:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+f0108067:	83 ef 01             	sub    $0x1,%edi
+f010806a:	83 c4 10             	add    $0x10,%esp
+f010806d:	85 ff                	test   %edi,%edi
+f010806f:	7f ee                	jg     f010805f <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+f0108071:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f0108074:	89 45 14             	mov    %eax,0x14(%ebp)
+f0108077:	e9 6b 01 00 00       	jmp    f01081e7 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+f010807c:	83 f9 01             	cmp    $0x1,%ecx
+f010807f:	7f 1f                	jg     f01080a0 <vprintfmt+0x28f>
+	else if (lflag)
+f0108081:	85 c9                	test   %ecx,%ecx
+f0108083:	74 67                	je     f01080ec <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+f0108085:	8b 45 14             	mov    0x14(%ebp),%eax
+f0108088:	8b 00                	mov    (%eax),%eax
+f010808a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f010808d:	89 c1                	mov    %eax,%ecx
+f010808f:	c1 f9 1f             	sar    $0x1f,%ecx
+f0108092:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f0108095:	8b 45 14             	mov    0x14(%ebp),%eax
+f0108098:	8d 40 04             	lea    0x4(%eax),%eax
+f010809b:	89 45 14             	mov    %eax,0x14(%ebp)
+f010809e:	eb 17                	jmp    f01080b7 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+f01080a0:	8b 45 14             	mov    0x14(%ebp),%eax
+f01080a3:	8b 50 04             	mov    0x4(%eax),%edx
+f01080a6:	8b 00                	mov    (%eax),%eax
+f01080a8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f01080ab:	89 55 dc             	mov    %edx,-0x24(%ebp)
+f01080ae:	8b 45 14             	mov    0x14(%ebp),%eax
+f01080b1:	8d 40 08             	lea    0x8(%eax),%eax
+f01080b4:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+f01080b7:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f01080ba:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+f01080bd:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+f01080c2:	85 c9                	test   %ecx,%ecx
+f01080c4:	0f 89 03 01 00 00    	jns    f01081cd <vprintfmt+0x3bc>
+				putch('-', putdat);
+f01080ca:	83 ec 08             	sub    $0x8,%esp
+f01080cd:	53                   	push   %ebx
+f01080ce:	6a 2d                	push   $0x2d
+f01080d0:	ff d6                	call   *%esi
+				num = -(long long) num;
+f01080d2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f01080d5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f01080d8:	f7 da                	neg    %edx
+f01080da:	83 d1 00             	adc    $0x0,%ecx
+f01080dd:	f7 d9                	neg    %ecx
+f01080df:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+f01080e2:	bf 0a 00 00 00       	mov    $0xa,%edi
+f01080e7:	e9 e1 00 00 00       	jmp    f01081cd <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+f01080ec:	8b 45 14             	mov    0x14(%ebp),%eax
+f01080ef:	8b 00                	mov    (%eax),%eax
+f01080f1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f01080f4:	89 c1                	mov    %eax,%ecx
+f01080f6:	c1 f9 1f             	sar    $0x1f,%ecx
+f01080f9:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f01080fc:	8b 45 14             	mov    0x14(%ebp),%eax
+f01080ff:	8d 40 04             	lea    0x4(%eax),%eax
+f0108102:	89 45 14             	mov    %eax,0x14(%ebp)
+f0108105:	eb b0                	jmp    f01080b7 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+f0108107:	83 f9 01             	cmp    $0x1,%ecx
+f010810a:	7f 1e                	jg     f010812a <vprintfmt+0x319>
+	else if (lflag)
+f010810c:	85 c9                	test   %ecx,%ecx
+f010810e:	74 32                	je     f0108142 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+f0108110:	8b 45 14             	mov    0x14(%ebp),%eax
+f0108113:	8b 10                	mov    (%eax),%edx
+f0108115:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010811a:	8d 40 04             	lea    0x4(%eax),%eax
+f010811d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+f0108120:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+f0108125:	e9 a3 00 00 00       	jmp    f01081cd <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+f010812a:	8b 45 14             	mov    0x14(%ebp),%eax
+f010812d:	8b 10                	mov    (%eax),%edx
+f010812f:	8b 48 04             	mov    0x4(%eax),%ecx
+f0108132:	8d 40 08             	lea    0x8(%eax),%eax
+f0108135:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+f0108138:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+f010813d:	e9 8b 00 00 00       	jmp    f01081cd <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+f0108142:	8b 45 14             	mov    0x14(%ebp),%eax
+f0108145:	8b 10                	mov    (%eax),%edx
+f0108147:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010814c:	8d 40 04             	lea    0x4(%eax),%eax
+f010814f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+f0108152:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+f0108157:	eb 74                	jmp    f01081cd <vprintfmt+0x3bc>
+	if (lflag >= 2)
+f0108159:	83 f9 01             	cmp    $0x1,%ecx
+f010815c:	7f 1b                	jg     f0108179 <vprintfmt+0x368>
+	else if (lflag)
+f010815e:	85 c9                	test   %ecx,%ecx
+f0108160:	74 2c                	je     f010818e <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+f0108162:	8b 45 14             	mov    0x14(%ebp),%eax
+f0108165:	8b 10                	mov    (%eax),%edx
+f0108167:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010816c:	8d 40 04             	lea    0x4(%eax),%eax
+f010816f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+f0108172:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+f0108177:	eb 54                	jmp    f01081cd <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+f0108179:	8b 45 14             	mov    0x14(%ebp),%eax
+f010817c:	8b 10                	mov    (%eax),%edx
+f010817e:	8b 48 04             	mov    0x4(%eax),%ecx
+f0108181:	8d 40 08             	lea    0x8(%eax),%eax
+f0108184:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+f0108187:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+f010818c:	eb 3f                	jmp    f01081cd <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+f010818e:	8b 45 14             	mov    0x14(%ebp),%eax
+f0108191:	8b 10                	mov    (%eax),%edx
+f0108193:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0108198:	8d 40 04             	lea    0x4(%eax),%eax
+f010819b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+f010819e:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+f01081a3:	eb 28                	jmp    f01081cd <vprintfmt+0x3bc>
+			putch('0', putdat);
+f01081a5:	83 ec 08             	sub    $0x8,%esp
+f01081a8:	53                   	push   %ebx
+f01081a9:	6a 30                	push   $0x30
+f01081ab:	ff d6                	call   *%esi
+			putch('x', putdat);
+f01081ad:	83 c4 08             	add    $0x8,%esp
+f01081b0:	53                   	push   %ebx
+f01081b1:	6a 78                	push   $0x78
+f01081b3:	ff d6                	call   *%esi
+			num = (unsigned long long)
+f01081b5:	8b 45 14             	mov    0x14(%ebp),%eax
+f01081b8:	8b 10                	mov    (%eax),%edx
+f01081ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+f01081bf:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+f01081c2:	8d 40 04             	lea    0x4(%eax),%eax
+f01081c5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f01081c8:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+f01081cd:	83 ec 0c             	sub    $0xc,%esp
+f01081d0:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+f01081d4:	50                   	push   %eax
+f01081d5:	ff 75 e0             	push   -0x20(%ebp)
+f01081d8:	57                   	push   %edi
+f01081d9:	51                   	push   %ecx
+f01081da:	52                   	push   %edx
+f01081db:	89 da                	mov    %ebx,%edx
+f01081dd:	89 f0                	mov    %esi,%eax
+f01081df:	e8 4a fb ff ff       	call   f0107d2e <printnum>
+			break;
+f01081e4:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+f01081e7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+f01081ea:	e9 40 fc ff ff       	jmp    f0107e2f <vprintfmt+0x1e>
+	if (lflag >= 2)
+f01081ef:	83 f9 01             	cmp    $0x1,%ecx
+f01081f2:	7f 1b                	jg     f010820f <vprintfmt+0x3fe>
+	else if (lflag)
+f01081f4:	85 c9                	test   %ecx,%ecx
+f01081f6:	74 2c                	je     f0108224 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+f01081f8:	8b 45 14             	mov    0x14(%ebp),%eax
+f01081fb:	8b 10                	mov    (%eax),%edx
+f01081fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0108202:	8d 40 04             	lea    0x4(%eax),%eax
+f0108205:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f0108208:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+f010820d:	eb be                	jmp    f01081cd <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+f010820f:	8b 45 14             	mov    0x14(%ebp),%eax
+f0108212:	8b 10                	mov    (%eax),%edx
+f0108214:	8b 48 04             	mov    0x4(%eax),%ecx
+f0108217:	8d 40 08             	lea    0x8(%eax),%eax
+f010821a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f010821d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+f0108222:	eb a9                	jmp    f01081cd <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+f0108224:	8b 45 14             	mov    0x14(%ebp),%eax
+f0108227:	8b 10                	mov    (%eax),%edx
+f0108229:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010822e:	8d 40 04             	lea    0x4(%eax),%eax
+f0108231:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f0108234:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+f0108239:	eb 92                	jmp    f01081cd <vprintfmt+0x3bc>
+			putch(ch, putdat);
+f010823b:	83 ec 08             	sub    $0x8,%esp
+f010823e:	53                   	push   %ebx
+f010823f:	6a 25                	push   $0x25
+f0108241:	ff d6                	call   *%esi
+			break;
+f0108243:	83 c4 10             	add    $0x10,%esp
+f0108246:	eb 9f                	jmp    f01081e7 <vprintfmt+0x3d6>
+			putch('%', putdat);
+f0108248:	83 ec 08             	sub    $0x8,%esp
+f010824b:	53                   	push   %ebx
+f010824c:	6a 25                	push   $0x25
+f010824e:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+f0108250:	83 c4 10             	add    $0x10,%esp
+f0108253:	89 f8                	mov    %edi,%eax
+f0108255:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+f0108259:	74 05                	je     f0108260 <vprintfmt+0x44f>
+f010825b:	83 e8 01             	sub    $0x1,%eax
+f010825e:	eb f5                	jmp    f0108255 <vprintfmt+0x444>
+f0108260:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0108263:	eb 82                	jmp    f01081e7 <vprintfmt+0x3d6>
+
+f0108265 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+f0108265:	55                   	push   %ebp
+f0108266:	89 e5                	mov    %esp,%ebp
+f0108268:	83 ec 18             	sub    $0x18,%esp
+f010826b:	8b 45 08             	mov    0x8(%ebp),%eax
+f010826e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+f0108271:	89 45 ec             	mov    %eax,-0x14(%ebp)
+f0108274:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+f0108278:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+f010827b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+f0108282:	85 c0                	test   %eax,%eax
+f0108284:	74 26                	je     f01082ac <vsnprintf+0x47>
+f0108286:	85 d2                	test   %edx,%edx
+f0108288:	7e 22                	jle    f01082ac <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+f010828a:	ff 75 14             	push   0x14(%ebp)
+f010828d:	ff 75 10             	push   0x10(%ebp)
+f0108290:	8d 45 ec             	lea    -0x14(%ebp),%eax
+f0108293:	50                   	push   %eax
+f0108294:	68 d7 7d 10 f0       	push   $0xf0107dd7
+f0108299:	e8 73 fb ff ff       	call   f0107e11 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+f010829e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+f01082a1:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+f01082a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f01082a7:	83 c4 10             	add    $0x10,%esp
+}
+f01082aa:	c9                   	leave
+f01082ab:	c3                   	ret
+		return -E_INVAL;
+f01082ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01082b1:	eb f7                	jmp    f01082aa <vsnprintf+0x45>
+
+f01082b3 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+f01082b3:	55                   	push   %ebp
+f01082b4:	89 e5                	mov    %esp,%ebp
+f01082b6:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+f01082b9:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+f01082bc:	50                   	push   %eax
+f01082bd:	ff 75 10             	push   0x10(%ebp)
+f01082c0:	ff 75 0c             	push   0xc(%ebp)
+f01082c3:	ff 75 08             	push   0x8(%ebp)
+f01082c6:	e8 9a ff ff ff       	call   f0108265 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+f01082cb:	c9                   	leave
+f01082cc:	c3                   	ret
+
+f01082cd <readline>:
+#define BUFLEN 1024
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt)
+{
+f01082cd:	55                   	push   %ebp
+f01082ce:	89 e5                	mov    %esp,%ebp
+f01082d0:	57                   	push   %edi
+f01082d1:	56                   	push   %esi
+f01082d2:	53                   	push   %ebx
+f01082d3:	83 ec 0c             	sub    $0xc,%esp
+f01082d6:	8b 45 08             	mov    0x8(%ebp),%eax
+	int i, c, echoing;
+
+	if (prompt != NULL)
+f01082d9:	85 c0                	test   %eax,%eax
+f01082db:	74 11                	je     f01082ee <readline+0x21>
+		cprintf("%s", prompt);
+f01082dd:	83 ec 08             	sub    $0x8,%esp
+f01082e0:	50                   	push   %eax
+f01082e1:	68 d1 be 10 f0       	push   $0xf010bed1
+f01082e6:	e8 ca c8 ff ff       	call   f0104bb5 <cprintf>
+f01082eb:	83 c4 10             	add    $0x10,%esp
+
+	i = 0;
+	echoing = iscons(0);
+f01082ee:	83 ec 0c             	sub    $0xc,%esp
+f01082f1:	6a 00                	push   $0x0
+f01082f3:	e8 27 85 ff ff       	call   f010081f <iscons>
+f01082f8:	89 c7                	mov    %eax,%edi
+f01082fa:	83 c4 10             	add    $0x10,%esp
+	i = 0;
+f01082fd:	be 00 00 00 00       	mov    $0x0,%esi
+f0108302:	eb 3f                	jmp    f0108343 <readline+0x76>
+	while (1) {
+		c = getchar();
+		if (c < 0) {
+			cprintf("read error: %e\n", c);
+f0108304:	83 ec 08             	sub    $0x8,%esp
+f0108307:	50                   	push   %eax
+f0108308:	68 59 e0 10 f0       	push   $0xf010e059
+f010830d:	e8 a3 c8 ff ff       	call   f0104bb5 <cprintf>
+			return NULL;
+f0108312:	83 c4 10             	add    $0x10,%esp
+f0108315:	b8 00 00 00 00       	mov    $0x0,%eax
+				cputchar('\n');
+			buf[i] = 0;
+			return buf;
+		}
+	}
+}
+f010831a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010831d:	5b                   	pop    %ebx
+f010831e:	5e                   	pop    %esi
+f010831f:	5f                   	pop    %edi
+f0108320:	5d                   	pop    %ebp
+f0108321:	c3                   	ret
+			if (echoing)
+f0108322:	85 ff                	test   %edi,%edi
+f0108324:	75 05                	jne    f010832b <readline+0x5e>
+			i--;
+f0108326:	83 ee 01             	sub    $0x1,%esi
+f0108329:	eb 18                	jmp    f0108343 <readline+0x76>
+				cputchar('\b');
+f010832b:	83 ec 0c             	sub    $0xc,%esp
+f010832e:	6a 08                	push   $0x8
+f0108330:	e8 c9 84 ff ff       	call   f01007fe <cputchar>
+f0108335:	83 c4 10             	add    $0x10,%esp
+f0108338:	eb ec                	jmp    f0108326 <readline+0x59>
+			buf[i++] = c;
+f010833a:	88 9e c0 4f 79 f0    	mov    %bl,-0xf86b040(%esi)
+f0108340:	8d 76 01             	lea    0x1(%esi),%esi
+		c = getchar();
+f0108343:	e8 c6 84 ff ff       	call   f010080e <getchar>
+f0108348:	89 c3                	mov    %eax,%ebx
+		if (c < 0) {
+f010834a:	85 c0                	test   %eax,%eax
+f010834c:	78 b6                	js     f0108304 <readline+0x37>
+		} else if ((c == '\b' || c == '\x7f') && i > 0) {
+f010834e:	83 f8 08             	cmp    $0x8,%eax
+f0108351:	0f 94 c0             	sete   %al
+f0108354:	83 fb 7f             	cmp    $0x7f,%ebx
+f0108357:	0f 94 c2             	sete   %dl
+f010835a:	08 d0                	or     %dl,%al
+f010835c:	74 04                	je     f0108362 <readline+0x95>
+f010835e:	85 f6                	test   %esi,%esi
+f0108360:	7f c0                	jg     f0108322 <readline+0x55>
+		} else if (c >= ' ' && i < BUFLEN-1) {
+f0108362:	83 fb 1f             	cmp    $0x1f,%ebx
+f0108365:	7e 1a                	jle    f0108381 <readline+0xb4>
+f0108367:	81 fe fe 03 00 00    	cmp    $0x3fe,%esi
+f010836d:	7f 12                	jg     f0108381 <readline+0xb4>
+			if (echoing)
+f010836f:	85 ff                	test   %edi,%edi
+f0108371:	74 c7                	je     f010833a <readline+0x6d>
+				cputchar(c);
+f0108373:	83 ec 0c             	sub    $0xc,%esp
+f0108376:	53                   	push   %ebx
+f0108377:	e8 82 84 ff ff       	call   f01007fe <cputchar>
+f010837c:	83 c4 10             	add    $0x10,%esp
+f010837f:	eb b9                	jmp    f010833a <readline+0x6d>
+		} else if (c == '\n' || c == '\r') {
+f0108381:	83 fb 0a             	cmp    $0xa,%ebx
+f0108384:	74 05                	je     f010838b <readline+0xbe>
+f0108386:	83 fb 0d             	cmp    $0xd,%ebx
+f0108389:	75 b8                	jne    f0108343 <readline+0x76>
+			if (echoing)
+f010838b:	85 ff                	test   %edi,%edi
+f010838d:	75 11                	jne    f01083a0 <readline+0xd3>
+			buf[i] = 0;
+f010838f:	c6 86 c0 4f 79 f0 00 	movb   $0x0,-0xf86b040(%esi)
+			return buf;
+f0108396:	b8 c0 4f 79 f0       	mov    $0xf0794fc0,%eax
+f010839b:	e9 7a ff ff ff       	jmp    f010831a <readline+0x4d>
+				cputchar('\n');
+f01083a0:	83 ec 0c             	sub    $0xc,%esp
+f01083a3:	6a 0a                	push   $0xa
+f01083a5:	e8 54 84 ff ff       	call   f01007fe <cputchar>
+f01083aa:	83 c4 10             	add    $0x10,%esp
+f01083ad:	eb e0                	jmp    f010838f <readline+0xc2>
+
+f01083af <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+f01083af:	55                   	push   %ebp
+f01083b0:	89 e5                	mov    %esp,%ebp
+f01083b2:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+f01083b5:	b8 00 00 00 00       	mov    $0x0,%eax
+f01083ba:	eb 03                	jmp    f01083bf <strlen+0x10>
+		n++;
+f01083bc:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+f01083bf:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+f01083c3:	75 f7                	jne    f01083bc <strlen+0xd>
+	return n;
+}
+f01083c5:	5d                   	pop    %ebp
+f01083c6:	c3                   	ret
+
+f01083c7 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+f01083c7:	55                   	push   %ebp
+f01083c8:	89 e5                	mov    %esp,%ebp
+f01083ca:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+f01083cd:	8b 55 0c             	mov    0xc(%ebp),%edx
+f01083d0:	b8 00 00 00 00       	mov    $0x0,%eax
+f01083d5:	eb 03                	jmp    f01083da <strnlen+0x13>
+		n++;
+f01083d7:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+f01083da:	39 d0                	cmp    %edx,%eax
+f01083dc:	74 08                	je     f01083e6 <strnlen+0x1f>
+f01083de:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+f01083e2:	75 f3                	jne    f01083d7 <strnlen+0x10>
+f01083e4:	89 c2                	mov    %eax,%edx
+	return n;
+}
+f01083e6:	89 d0                	mov    %edx,%eax
+f01083e8:	5d                   	pop    %ebp
+f01083e9:	c3                   	ret
+
+f01083ea <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+f01083ea:	55                   	push   %ebp
+f01083eb:	89 e5                	mov    %esp,%ebp
+f01083ed:	53                   	push   %ebx
+f01083ee:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f01083f1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+f01083f4:	b8 00 00 00 00       	mov    $0x0,%eax
+f01083f9:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+f01083fd:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+f0108400:	83 c0 01             	add    $0x1,%eax
+f0108403:	84 d2                	test   %dl,%dl
+f0108405:	75 f2                	jne    f01083f9 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+f0108407:	89 c8                	mov    %ecx,%eax
+f0108409:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010840c:	c9                   	leave
+f010840d:	c3                   	ret
+
+f010840e <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+f010840e:	55                   	push   %ebp
+f010840f:	89 e5                	mov    %esp,%ebp
+f0108411:	53                   	push   %ebx
+f0108412:	83 ec 10             	sub    $0x10,%esp
+f0108415:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+f0108418:	53                   	push   %ebx
+f0108419:	e8 91 ff ff ff       	call   f01083af <strlen>
+f010841e:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+f0108421:	ff 75 0c             	push   0xc(%ebp)
+f0108424:	01 d8                	add    %ebx,%eax
+f0108426:	50                   	push   %eax
+f0108427:	e8 be ff ff ff       	call   f01083ea <strcpy>
+	return dst;
+}
+f010842c:	89 d8                	mov    %ebx,%eax
+f010842e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0108431:	c9                   	leave
+f0108432:	c3                   	ret
+
+f0108433 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+f0108433:	55                   	push   %ebp
+f0108434:	89 e5                	mov    %esp,%ebp
+f0108436:	56                   	push   %esi
+f0108437:	53                   	push   %ebx
+f0108438:	8b 75 08             	mov    0x8(%ebp),%esi
+f010843b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+f010843e:	89 f3                	mov    %esi,%ebx
+f0108440:	03 5d 10             	add    0x10(%ebp),%ebx
+f0108443:	89 f0                	mov    %esi,%eax
+f0108445:	eb 0f                	jmp    f0108456 <strncpy+0x23>
+		*dst++ = *src;
+f0108447:	83 c0 01             	add    $0x1,%eax
+f010844a:	0f b6 0a             	movzbl (%edx),%ecx
+f010844d:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+f0108450:	80 f9 01             	cmp    $0x1,%cl
+f0108453:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+f0108456:	39 d8                	cmp    %ebx,%eax
+f0108458:	75 ed                	jne    f0108447 <strncpy+0x14>
+	}
+	return ret;
+}
+f010845a:	89 f0                	mov    %esi,%eax
+f010845c:	5b                   	pop    %ebx
+f010845d:	5e                   	pop    %esi
+f010845e:	5d                   	pop    %ebp
+f010845f:	c3                   	ret
+
+f0108460 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+f0108460:	55                   	push   %ebp
+f0108461:	89 e5                	mov    %esp,%ebp
+f0108463:	56                   	push   %esi
+f0108464:	53                   	push   %ebx
+f0108465:	8b 75 08             	mov    0x8(%ebp),%esi
+f0108468:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f010846b:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+f010846e:	89 f0                	mov    %esi,%eax
+f0108470:	85 d2                	test   %edx,%edx
+f0108472:	74 21                	je     f0108495 <strlcpy+0x35>
+f0108474:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+f0108478:	89 f2                	mov    %esi,%edx
+f010847a:	eb 09                	jmp    f0108485 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+f010847c:	83 c1 01             	add    $0x1,%ecx
+f010847f:	83 c2 01             	add    $0x1,%edx
+f0108482:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+f0108485:	39 c2                	cmp    %eax,%edx
+f0108487:	74 09                	je     f0108492 <strlcpy+0x32>
+f0108489:	0f b6 19             	movzbl (%ecx),%ebx
+f010848c:	84 db                	test   %bl,%bl
+f010848e:	75 ec                	jne    f010847c <strlcpy+0x1c>
+f0108490:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+f0108492:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+f0108495:	29 f0                	sub    %esi,%eax
+}
+f0108497:	5b                   	pop    %ebx
+f0108498:	5e                   	pop    %esi
+f0108499:	5d                   	pop    %ebp
+f010849a:	c3                   	ret
+
+f010849b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+f010849b:	55                   	push   %ebp
+f010849c:	89 e5                	mov    %esp,%ebp
+f010849e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f01084a1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+f01084a4:	eb 06                	jmp    f01084ac <strcmp+0x11>
+		p++, q++;
+f01084a6:	83 c1 01             	add    $0x1,%ecx
+f01084a9:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+f01084ac:	0f b6 01             	movzbl (%ecx),%eax
+f01084af:	84 c0                	test   %al,%al
+f01084b1:	74 04                	je     f01084b7 <strcmp+0x1c>
+f01084b3:	3a 02                	cmp    (%edx),%al
+f01084b5:	74 ef                	je     f01084a6 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+f01084b7:	0f b6 c0             	movzbl %al,%eax
+f01084ba:	0f b6 12             	movzbl (%edx),%edx
+f01084bd:	29 d0                	sub    %edx,%eax
+}
+f01084bf:	5d                   	pop    %ebp
+f01084c0:	c3                   	ret
+
+f01084c1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+f01084c1:	55                   	push   %ebp
+f01084c2:	89 e5                	mov    %esp,%ebp
+f01084c4:	53                   	push   %ebx
+f01084c5:	8b 45 08             	mov    0x8(%ebp),%eax
+f01084c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f01084cb:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+f01084ce:	eb 09                	jmp    f01084d9 <strncmp+0x18>
+		n--, p++, q++;
+f01084d0:	83 ea 01             	sub    $0x1,%edx
+f01084d3:	83 c0 01             	add    $0x1,%eax
+f01084d6:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+f01084d9:	85 d2                	test   %edx,%edx
+f01084db:	74 18                	je     f01084f5 <strncmp+0x34>
+f01084dd:	0f b6 18             	movzbl (%eax),%ebx
+f01084e0:	84 db                	test   %bl,%bl
+f01084e2:	74 04                	je     f01084e8 <strncmp+0x27>
+f01084e4:	3a 19                	cmp    (%ecx),%bl
+f01084e6:	74 e8                	je     f01084d0 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+f01084e8:	0f b6 00             	movzbl (%eax),%eax
+f01084eb:	0f b6 11             	movzbl (%ecx),%edx
+f01084ee:	29 d0                	sub    %edx,%eax
+}
+f01084f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01084f3:	c9                   	leave
+f01084f4:	c3                   	ret
+		return 0;
+f01084f5:	b8 00 00 00 00       	mov    $0x0,%eax
+f01084fa:	eb f4                	jmp    f01084f0 <strncmp+0x2f>
+
+f01084fc <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+f01084fc:	55                   	push   %ebp
+f01084fd:	89 e5                	mov    %esp,%ebp
+f01084ff:	8b 45 08             	mov    0x8(%ebp),%eax
+f0108502:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+f0108506:	eb 03                	jmp    f010850b <strchr+0xf>
+f0108508:	83 c0 01             	add    $0x1,%eax
+f010850b:	0f b6 10             	movzbl (%eax),%edx
+f010850e:	84 d2                	test   %dl,%dl
+f0108510:	74 06                	je     f0108518 <strchr+0x1c>
+		if (*s == c)
+f0108512:	38 ca                	cmp    %cl,%dl
+f0108514:	75 f2                	jne    f0108508 <strchr+0xc>
+f0108516:	eb 05                	jmp    f010851d <strchr+0x21>
+			return (char *) s;
+	return 0;
+f0108518:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f010851d:	5d                   	pop    %ebp
+f010851e:	c3                   	ret
+
+f010851f <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+f010851f:	55                   	push   %ebp
+f0108520:	89 e5                	mov    %esp,%ebp
+f0108522:	8b 45 08             	mov    0x8(%ebp),%eax
+f0108525:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+f0108529:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+f010852c:	38 ca                	cmp    %cl,%dl
+f010852e:	74 09                	je     f0108539 <strfind+0x1a>
+f0108530:	84 d2                	test   %dl,%dl
+f0108532:	74 05                	je     f0108539 <strfind+0x1a>
+	for (; *s; s++)
+f0108534:	83 c0 01             	add    $0x1,%eax
+f0108537:	eb f0                	jmp    f0108529 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+f0108539:	5d                   	pop    %ebp
+f010853a:	c3                   	ret
+
+f010853b <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+f010853b:	55                   	push   %ebp
+f010853c:	89 e5                	mov    %esp,%ebp
+f010853e:	57                   	push   %edi
+f010853f:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0108542:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+f0108545:	85 c9                	test   %ecx,%ecx
+f0108547:	74 20                	je     f0108569 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+f0108549:	89 f8                	mov    %edi,%eax
+f010854b:	09 c8                	or     %ecx,%eax
+f010854d:	a8 03                	test   $0x3,%al
+f010854f:	75 12                	jne    f0108563 <memset+0x28>
+		c &= 0xFF;
+f0108551:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+f0108555:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+f010855b:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+f010855e:	fc                   	cld
+f010855f:	f3 ab                	rep stos %eax,%es:(%edi)
+f0108561:	eb 06                	jmp    f0108569 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+f0108563:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0108566:	fc                   	cld
+f0108567:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+f0108569:	89 f8                	mov    %edi,%eax
+f010856b:	8b 7d fc             	mov    -0x4(%ebp),%edi
+f010856e:	c9                   	leave
+f010856f:	c3                   	ret
+
+f0108570 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+f0108570:	55                   	push   %ebp
+f0108571:	89 e5                	mov    %esp,%ebp
+f0108573:	57                   	push   %edi
+f0108574:	56                   	push   %esi
+f0108575:	8b 45 08             	mov    0x8(%ebp),%eax
+f0108578:	8b 75 0c             	mov    0xc(%ebp),%esi
+f010857b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+f010857e:	39 c6                	cmp    %eax,%esi
+f0108580:	73 32                	jae    f01085b4 <memmove+0x44>
+f0108582:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+f0108585:	39 d0                	cmp    %edx,%eax
+f0108587:	73 2b                	jae    f01085b4 <memmove+0x44>
+		s += n;
+		d += n;
+f0108589:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+f010858c:	89 d6                	mov    %edx,%esi
+f010858e:	09 fe                	or     %edi,%esi
+f0108590:	09 ce                	or     %ecx,%esi
+f0108592:	f7 c6 03 00 00 00    	test   $0x3,%esi
+f0108598:	75 0e                	jne    f01085a8 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+f010859a:	83 ef 04             	sub    $0x4,%edi
+f010859d:	8d 72 fc             	lea    -0x4(%edx),%esi
+f01085a0:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+f01085a3:	fd                   	std
+f01085a4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f01085a6:	eb 09                	jmp    f01085b1 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+f01085a8:	83 ef 01             	sub    $0x1,%edi
+f01085ab:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+f01085ae:	fd                   	std
+f01085af:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+f01085b1:	fc                   	cld
+f01085b2:	eb 1a                	jmp    f01085ce <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+f01085b4:	89 f2                	mov    %esi,%edx
+f01085b6:	09 c2                	or     %eax,%edx
+f01085b8:	09 ca                	or     %ecx,%edx
+f01085ba:	f6 c2 03             	test   $0x3,%dl
+f01085bd:	75 0a                	jne    f01085c9 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+f01085bf:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+f01085c2:	89 c7                	mov    %eax,%edi
+f01085c4:	fc                   	cld
+f01085c5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f01085c7:	eb 05                	jmp    f01085ce <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+f01085c9:	89 c7                	mov    %eax,%edi
+f01085cb:	fc                   	cld
+f01085cc:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+f01085ce:	5e                   	pop    %esi
+f01085cf:	5f                   	pop    %edi
+f01085d0:	5d                   	pop    %ebp
+f01085d1:	c3                   	ret
+
+f01085d2 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+f01085d2:	55                   	push   %ebp
+f01085d3:	89 e5                	mov    %esp,%ebp
+f01085d5:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+f01085d8:	ff 75 10             	push   0x10(%ebp)
+f01085db:	ff 75 0c             	push   0xc(%ebp)
+f01085de:	ff 75 08             	push   0x8(%ebp)
+f01085e1:	e8 8a ff ff ff       	call   f0108570 <memmove>
+}
+f01085e6:	c9                   	leave
+f01085e7:	c3                   	ret
+
+f01085e8 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+f01085e8:	55                   	push   %ebp
+f01085e9:	89 e5                	mov    %esp,%ebp
+f01085eb:	56                   	push   %esi
+f01085ec:	53                   	push   %ebx
+f01085ed:	8b 45 08             	mov    0x8(%ebp),%eax
+f01085f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+f01085f3:	89 c6                	mov    %eax,%esi
+f01085f5:	03 75 10             	add    0x10(%ebp),%esi
+f01085f8:	eb 06                	jmp    f0108600 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+f01085fa:	83 c0 01             	add    $0x1,%eax
+f01085fd:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+f0108600:	39 f0                	cmp    %esi,%eax
+f0108602:	74 14                	je     f0108618 <memcmp+0x30>
+		if (*s1 != *s2)
+f0108604:	0f b6 08             	movzbl (%eax),%ecx
+f0108607:	0f b6 1a             	movzbl (%edx),%ebx
+f010860a:	38 d9                	cmp    %bl,%cl
+f010860c:	74 ec                	je     f01085fa <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+f010860e:	0f b6 c1             	movzbl %cl,%eax
+f0108611:	0f b6 db             	movzbl %bl,%ebx
+f0108614:	29 d8                	sub    %ebx,%eax
+f0108616:	eb 05                	jmp    f010861d <memcmp+0x35>
+	}
+
+	return 0;
+f0108618:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f010861d:	5b                   	pop    %ebx
+f010861e:	5e                   	pop    %esi
+f010861f:	5d                   	pop    %ebp
+f0108620:	c3                   	ret
+
+f0108621 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+f0108621:	55                   	push   %ebp
+f0108622:	89 e5                	mov    %esp,%ebp
+f0108624:	8b 45 08             	mov    0x8(%ebp),%eax
+f0108627:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+f010862a:	89 c2                	mov    %eax,%edx
+f010862c:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+f010862f:	eb 03                	jmp    f0108634 <memfind+0x13>
+f0108631:	83 c0 01             	add    $0x1,%eax
+f0108634:	39 d0                	cmp    %edx,%eax
+f0108636:	73 04                	jae    f010863c <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+f0108638:	38 08                	cmp    %cl,(%eax)
+f010863a:	75 f5                	jne    f0108631 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+f010863c:	5d                   	pop    %ebp
+f010863d:	c3                   	ret
+
+f010863e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+f010863e:	55                   	push   %ebp
+f010863f:	89 e5                	mov    %esp,%ebp
+f0108641:	57                   	push   %edi
+f0108642:	56                   	push   %esi
+f0108643:	53                   	push   %ebx
+f0108644:	8b 55 08             	mov    0x8(%ebp),%edx
+f0108647:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+f010864a:	eb 03                	jmp    f010864f <strtol+0x11>
+		s++;
+f010864c:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+f010864f:	0f b6 02             	movzbl (%edx),%eax
+f0108652:	3c 20                	cmp    $0x20,%al
+f0108654:	74 f6                	je     f010864c <strtol+0xe>
+f0108656:	3c 09                	cmp    $0x9,%al
+f0108658:	74 f2                	je     f010864c <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+f010865a:	3c 2b                	cmp    $0x2b,%al
+f010865c:	74 2a                	je     f0108688 <strtol+0x4a>
+	int neg = 0;
+f010865e:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+f0108663:	3c 2d                	cmp    $0x2d,%al
+f0108665:	74 2b                	je     f0108692 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+f0108667:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+f010866d:	75 0f                	jne    f010867e <strtol+0x40>
+f010866f:	80 3a 30             	cmpb   $0x30,(%edx)
+f0108672:	74 28                	je     f010869c <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+f0108674:	85 db                	test   %ebx,%ebx
+f0108676:	b8 0a 00 00 00       	mov    $0xa,%eax
+f010867b:	0f 44 d8             	cmove  %eax,%ebx
+f010867e:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0108683:	89 5d 10             	mov    %ebx,0x10(%ebp)
+f0108686:	eb 46                	jmp    f01086ce <strtol+0x90>
+		s++;
+f0108688:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+f010868b:	bf 00 00 00 00       	mov    $0x0,%edi
+f0108690:	eb d5                	jmp    f0108667 <strtol+0x29>
+		s++, neg = 1;
+f0108692:	83 c2 01             	add    $0x1,%edx
+f0108695:	bf 01 00 00 00       	mov    $0x1,%edi
+f010869a:	eb cb                	jmp    f0108667 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+f010869c:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+f01086a0:	74 0e                	je     f01086b0 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+f01086a2:	85 db                	test   %ebx,%ebx
+f01086a4:	75 d8                	jne    f010867e <strtol+0x40>
+		s++, base = 8;
+f01086a6:	83 c2 01             	add    $0x1,%edx
+f01086a9:	bb 08 00 00 00       	mov    $0x8,%ebx
+f01086ae:	eb ce                	jmp    f010867e <strtol+0x40>
+		s += 2, base = 16;
+f01086b0:	83 c2 02             	add    $0x2,%edx
+f01086b3:	bb 10 00 00 00       	mov    $0x10,%ebx
+f01086b8:	eb c4                	jmp    f010867e <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+f01086ba:	0f be c0             	movsbl %al,%eax
+f01086bd:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+f01086c0:	3b 45 10             	cmp    0x10(%ebp),%eax
+f01086c3:	7d 3a                	jge    f01086ff <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+f01086c5:	83 c2 01             	add    $0x1,%edx
+f01086c8:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+f01086cc:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+f01086ce:	0f b6 02             	movzbl (%edx),%eax
+f01086d1:	8d 70 d0             	lea    -0x30(%eax),%esi
+f01086d4:	89 f3                	mov    %esi,%ebx
+f01086d6:	80 fb 09             	cmp    $0x9,%bl
+f01086d9:	76 df                	jbe    f01086ba <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+f01086db:	8d 70 9f             	lea    -0x61(%eax),%esi
+f01086de:	89 f3                	mov    %esi,%ebx
+f01086e0:	80 fb 19             	cmp    $0x19,%bl
+f01086e3:	77 08                	ja     f01086ed <strtol+0xaf>
+			dig = *s - 'a' + 10;
+f01086e5:	0f be c0             	movsbl %al,%eax
+f01086e8:	83 e8 57             	sub    $0x57,%eax
+f01086eb:	eb d3                	jmp    f01086c0 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+f01086ed:	8d 70 bf             	lea    -0x41(%eax),%esi
+f01086f0:	89 f3                	mov    %esi,%ebx
+f01086f2:	80 fb 19             	cmp    $0x19,%bl
+f01086f5:	77 08                	ja     f01086ff <strtol+0xc1>
+			dig = *s - 'A' + 10;
+f01086f7:	0f be c0             	movsbl %al,%eax
+f01086fa:	83 e8 37             	sub    $0x37,%eax
+f01086fd:	eb c1                	jmp    f01086c0 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+f01086ff:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+f0108703:	74 05                	je     f010870a <strtol+0xcc>
+		*endptr = (char *) s;
+f0108705:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0108708:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+f010870a:	89 c8                	mov    %ecx,%eax
+f010870c:	f7 d8                	neg    %eax
+f010870e:	85 ff                	test   %edi,%edi
+f0108710:	0f 45 c8             	cmovne %eax,%ecx
+}
+f0108713:	89 c8                	mov    %ecx,%eax
+f0108715:	5b                   	pop    %ebx
+f0108716:	5e                   	pop    %esi
+f0108717:	5f                   	pop    %edi
+f0108718:	5d                   	pop    %ebp
+f0108719:	c3                   	ret
+
+f010871a <atoi>:
+
+int
+atoi(const char *s)
+{
+f010871a:	55                   	push   %ebp
+f010871b:	89 e5                	mov    %esp,%ebp
+f010871d:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+f0108720:	6a 0a                	push   $0xa
+f0108722:	6a 00                	push   $0x0
+f0108724:	ff 75 08             	push   0x8(%ebp)
+f0108727:	e8 12 ff ff ff       	call   f010863e <strtol>
+}
+f010872c:	c9                   	leave
+f010872d:	c3                   	ret
+f010872e:	66 90                	xchg   %ax,%ax
+
+f0108730 <mpentry_start>:
+.set PROT_MODE_DSEG, 0x10			# kernel data segment selector
+
+.code16
+.globl mpentry_start
+mpentry_start:
+	cli
+f0108730:	fa                   	cli
+
+	xorw	%ax, %ax
+f0108731:	31 c0                	xor    %eax,%eax
+	movw	%ax, %ds
+f0108733:	8e d8                	mov    %eax,%ds
+	movw	%ax, %es
+f0108735:	8e c0                	mov    %eax,%es
+	movw	%ax, %ss
+f0108737:	8e d0                	mov    %eax,%ss
+
+	lgdt	MPBOOTPHYS(gdtdesc)
+f0108739:	0f 01 16             	lgdtl  (%esi)
+f010873c:	74 70                	je     f01087ae <print_table_header+0x3>
+	movl	%cr0, %eax
+f010873e:	0f 20 c0             	mov    %cr0,%eax
+	orl	$CR0_PE, %eax
+f0108741:	66 83 c8 01          	or     $0x1,%ax
+	movl	%eax, %cr0
+f0108745:	0f 22 c0             	mov    %eax,%cr0
+
+	ljmpl	$(PROT_MODE_CSEG), $(MPBOOTPHYS(start32))
+f0108748:	66 ea 20 70 00 00    	ljmpw  $0x0,$0x7020
+f010874e:	08 00                	or     %al,(%eax)
+
+f0108750 <start32>:
+
+.code32
+start32:
+	movw	$(PROT_MODE_DSEG), %ax
+f0108750:	66 b8 10 00          	mov    $0x10,%ax
+	movw	%ax, %ds
+f0108754:	8e d8                	mov    %eax,%ds
+	movw	%ax, %es
+f0108756:	8e c0                	mov    %eax,%es
+	movw	%ax, %ss
+f0108758:	8e d0                	mov    %eax,%ss
+	movw	$0, %ax
+f010875a:	66 b8 00 00          	mov    $0x0,%ax
+	movw	%ax, %fs
+f010875e:	8e e0                	mov    %eax,%fs
+	movw	%ax, %gs
+f0108760:	8e e8                	mov    %eax,%gs
+
+	# Set up initial page table. We cannot use kern_pgdir yet because
+	# we are still running at a low EIP.
+	movl	$(RELOC(entry_pgdir)), %eax
+f0108762:	b8 00 70 11 00       	mov    $0x117000,%eax
+	movl	%eax, %cr3
+f0108767:	0f 22 d8             	mov    %eax,%cr3
+	# Turn on paging.
+	movl	%cr0, %eax
+f010876a:	0f 20 c0             	mov    %cr0,%eax
+	orl	$(CR0_PE|CR0_PG|CR0_WP), %eax
+f010876d:	0d 01 00 01 80       	or     $0x80010001,%eax
+	movl	%eax, %cr0
+f0108772:	0f 22 c0             	mov    %eax,%cr0
+
+	# Switch to the per-cpu stack allocated in boot_aps()
+	movl	mpentry_kstack, %esp
+f0108775:	8b 25 04 40 79 f0    	mov    0xf0794004,%esp
+	movl	$0x0, %ebp			# nuke frame pointer
+f010877b:	bd 00 00 00 00       	mov    $0x0,%ebp
+
+	# Call mp_main().  (Exercise for the reader: why the indirect call?)
+	movl	$mp_main, %eax
+f0108780:	b8 a2 00 10 f0       	mov    $0xf01000a2,%eax
+	call	*%eax
+f0108785:	ff d0                	call   *%eax
+
+f0108787 <spin>:
+
+	# If mp_main returns (it shouldn't), loop.
+spin:
+	jmp	spin
+f0108787:	eb fe                	jmp    f0108787 <spin>
+f0108789:	8d 76 00             	lea    0x0(%esi),%esi
+
+f010878c <gdt>:
+	...
+f0108794:	ff                   	(bad)
+f0108795:	ff 00                	incl   (%eax)
+f0108797:	00 00                	add    %al,(%eax)
+f0108799:	9a cf 00 ff ff 00 00 	lcall  $0x0,$0xffff00cf
+f01087a0:	00                   	.byte 0x0
+f01087a1:	92                   	xchg   %eax,%edx
+f01087a2:	cf                   	iret
+	...
+
+f01087a4 <gdtdesc>:
+f01087a4:	17                   	pop    %ss
+f01087a5:	00 5c 70 00          	add    %bl,0x0(%eax,%esi,2)
+	...
+
+f01087aa <mpentry_end>:
+	.word	0x17				# sizeof(gdt) - 1
+	.long	MPBOOTPHYS(gdt)			# address gdt
+
+.globl mpentry_end
+mpentry_end:
+	nop
+f01087aa:	90                   	nop
+
+f01087ab <print_table_header>:
+		rsdp->revision, rsdp->oem_id);
+}
+
+static void
+print_table_header(struct acpi_table_header *hdr)
+{
+f01087ab:	55                   	push   %ebp
+f01087ac:	89 e5                	mov    %esp,%ebp
+f01087ae:	57                   	push   %edi
+f01087af:	56                   	push   %esi
+f01087b0:	53                   	push   %ebx
+f01087b1:	83 ec 1c             	sub    $0x1c,%esp
+f01087b4:	89 c2                	mov    %eax,%edx
+	cprintf("ACPI: %.4s %08p %06x v%02d %.6s %.8s %02d %.4s %02d\n",
+f01087b6:	8b 78 20             	mov    0x20(%eax),%edi
+		hdr->signature, PADDR(hdr), hdr->length, hdr->revision,
+		hdr->oem_id, hdr->oem_table_id, hdr->oem_revision,
+		hdr->asl_compiler_id, hdr->asl_compiler_revision);
+f01087b9:	8d 70 1c             	lea    0x1c(%eax),%esi
+	cprintf("ACPI: %.4s %08p %06x v%02d %.6s %.8s %02d %.4s %02d\n",
+f01087bc:	8b 58 18             	mov    0x18(%eax),%ebx
+		hdr->oem_id, hdr->oem_table_id, hdr->oem_revision,
+f01087bf:	8d 48 10             	lea    0x10(%eax),%ecx
+f01087c2:	8d 40 0a             	lea    0xa(%eax),%eax
+f01087c5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	cprintf("ACPI: %.4s %08p %06x v%02d %.6s %.8s %02d %.4s %02d\n",
+f01087c8:	0f b6 42 08          	movzbl 0x8(%edx),%eax
+f01087cc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f01087cf:	8b 42 04             	mov    0x4(%edx),%eax
+	if ((uint32_t)kva < KERNBASE)
+f01087d2:	81 fa ff ff ff ef    	cmp    $0xefffffff,%edx
+f01087d8:	76 2b                	jbe    f0108805 <print_table_header+0x5a>
+f01087da:	83 ec 08             	sub    $0x8,%esp
+f01087dd:	57                   	push   %edi
+f01087de:	56                   	push   %esi
+f01087df:	53                   	push   %ebx
+f01087e0:	51                   	push   %ecx
+f01087e1:	ff 75 e4             	push   -0x1c(%ebp)
+f01087e4:	ff 75 e0             	push   -0x20(%ebp)
+f01087e7:	50                   	push   %eax
+	return (physaddr_t)kva - KERNBASE;
+f01087e8:	8d 82 00 00 00 10    	lea    0x10000000(%edx),%eax
+f01087ee:	50                   	push   %eax
+f01087ef:	52                   	push   %edx
+f01087f0:	68 6c e0 10 f0       	push   $0xf010e06c
+f01087f5:	e8 bb c3 ff ff       	call   f0104bb5 <cprintf>
+}
+f01087fa:	83 c4 30             	add    $0x30,%esp
+f01087fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108800:	5b                   	pop    %ebx
+f0108801:	5e                   	pop    %esi
+f0108802:	5f                   	pop    %edi
+f0108803:	5d                   	pop    %ebp
+f0108804:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0108805:	52                   	push   %edx
+f0108806:	68 24 be 10 f0       	push   $0xf010be24
+f010880b:	6a 1e                	push   $0x1e
+f010880d:	68 c5 e0 10 f0       	push   $0xf010e0c5
+f0108812:	e8 2c 78 ff ff       	call   f0100043 <_panic>
+
+f0108817 <rsdp_search1>:
+}
+
+// Look for the RSDP in the len bytes at physical address addr.
+static struct acpi_table_rsdp *
+rsdp_search1(physaddr_t a, int len)
+{
+f0108817:	55                   	push   %ebp
+f0108818:	89 e5                	mov    %esp,%ebp
+f010881a:	57                   	push   %edi
+f010881b:	56                   	push   %esi
+f010881c:	53                   	push   %ebx
+f010881d:	83 ec 1c             	sub    $0x1c,%esp
+f0108820:	89 c3                	mov    %eax,%ebx
+	if (PGNUM(pa) >= npages)
+f0108822:	8b 0d 74 47 79 f0    	mov    0xf0794774,%ecx
+f0108828:	c1 e8 0c             	shr    $0xc,%eax
+f010882b:	39 c8                	cmp    %ecx,%eax
+f010882d:	73 22                	jae    f0108851 <rsdp_search1+0x3a>
+	return (void *)(pa + KERNBASE);
+f010882f:	8d b3 00 00 00 f0    	lea    -0x10000000(%ebx),%esi
+	void *p = KADDR(a), *e = KADDR(a + len);
+f0108835:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+	if (PGNUM(pa) >= npages)
+f0108838:	89 c2                	mov    %eax,%edx
+f010883a:	c1 ea 0c             	shr    $0xc,%edx
+f010883d:	39 ca                	cmp    %ecx,%edx
+f010883f:	73 22                	jae    f0108863 <rsdp_search1+0x4c>
+	return (void *)(pa + KERNBASE);
+f0108841:	2d 00 00 00 10       	sub    $0x10000000,%eax
+f0108846:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+	// The signature is on a 16-byte boundary.
+	for (; p < e; p += 16) {
+f0108849:	81 eb ec ff ff 0f    	sub    $0xfffffec,%ebx
+f010884f:	eb 62                	jmp    f01088b3 <rsdp_search1+0x9c>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0108851:	53                   	push   %ebx
+f0108852:	68 90 be 10 f0       	push   $0xf010be90
+f0108857:	6a 32                	push   $0x32
+f0108859:	68 c5 e0 10 f0       	push   $0xf010e0c5
+f010885e:	e8 e0 77 ff ff       	call   f0100043 <_panic>
+f0108863:	50                   	push   %eax
+f0108864:	68 90 be 10 f0       	push   $0xf010be90
+f0108869:	6a 32                	push   $0x32
+f010886b:	68 c5 e0 10 f0       	push   $0xf010e0c5
+f0108870:	e8 ce 77 ff ff       	call   f0100043 <_panic>
+		sum += ((uint8_t *)addr)[i];
+f0108875:	0f b6 38             	movzbl (%eax),%edi
+f0108878:	01 f9                	add    %edi,%ecx
+	for (i = 0; i < len; i++)
+f010887a:	83 c0 01             	add    $0x1,%eax
+f010887d:	39 d8                	cmp    %ebx,%eax
+f010887f:	75 f4                	jne    f0108875 <rsdp_search1+0x5e>
+		struct acpi_table_rsdp *rsdp = p;
+
+		if (memcmp(rsdp->signature, ACPI_SIG_RSDP, 8) ||
+f0108881:	84 c9                	test   %cl,%cl
+f0108883:	75 28                	jne    f01088ad <rsdp_search1+0x96>
+		    sum(rsdp, 20))
+			continue;
+		// ACPI 2.0+
+		if (rsdp->revision && sum(rsdp, rsdp->length))
+f0108885:	80 7e 0f 00          	cmpb   $0x0,0xf(%esi)
+f0108889:	74 18                	je     f01088a3 <rsdp_search1+0x8c>
+f010888b:	8b 7e 14             	mov    0x14(%esi),%edi
+	sum = 0;
+f010888e:	89 d0                	mov    %edx,%eax
+	for (i = 0; i < len; i++)
+f0108890:	39 d7                	cmp    %edx,%edi
+f0108892:	7e 0b                	jle    f010889f <rsdp_search1+0x88>
+		sum += ((uint8_t *)addr)[i];
+f0108894:	0f b6 0c 16          	movzbl (%esi,%edx,1),%ecx
+f0108898:	01 c8                	add    %ecx,%eax
+	for (i = 0; i < len; i++)
+f010889a:	83 c2 01             	add    $0x1,%edx
+f010889d:	eb f1                	jmp    f0108890 <rsdp_search1+0x79>
+		if (rsdp->revision && sum(rsdp, rsdp->length))
+f010889f:	84 c0                	test   %al,%al
+f01088a1:	75 0a                	jne    f01088ad <rsdp_search1+0x96>
+			continue;
+		return rsdp;
+	}
+	return NULL;
+}
+f01088a3:	89 f0                	mov    %esi,%eax
+f01088a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01088a8:	5b                   	pop    %ebx
+f01088a9:	5e                   	pop    %esi
+f01088aa:	5f                   	pop    %edi
+f01088ab:	5d                   	pop    %ebp
+f01088ac:	c3                   	ret
+	for (; p < e; p += 16) {
+f01088ad:	83 c6 10             	add    $0x10,%esi
+f01088b0:	83 c3 10             	add    $0x10,%ebx
+f01088b3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01088b6:	39 c6                	cmp    %eax,%esi
+f01088b8:	73 1f                	jae    f01088d9 <rsdp_search1+0xc2>
+		if (memcmp(rsdp->signature, ACPI_SIG_RSDP, 8) ||
+f01088ba:	83 ec 04             	sub    $0x4,%esp
+f01088bd:	6a 08                	push   $0x8
+f01088bf:	68 d1 e0 10 f0       	push   $0xf010e0d1
+f01088c4:	56                   	push   %esi
+f01088c5:	e8 1e fd ff ff       	call   f01085e8 <memcmp>
+f01088ca:	89 c2                	mov    %eax,%edx
+f01088cc:	83 c4 10             	add    $0x10,%esp
+f01088cf:	85 c0                	test   %eax,%eax
+f01088d1:	75 da                	jne    f01088ad <rsdp_search1+0x96>
+f01088d3:	89 f0                	mov    %esi,%eax
+	sum = 0;
+f01088d5:	89 d1                	mov    %edx,%ecx
+f01088d7:	eb a4                	jmp    f010887d <rsdp_search1+0x66>
+	return NULL;
+f01088d9:	be 00 00 00 00       	mov    $0x0,%esi
+f01088de:	eb c3                	jmp    f01088a3 <rsdp_search1+0x8c>
+
+f01088e0 <acpi_init>:
+	return rsdp_search1(0xE0000, 0x20000);
+}
+
+void
+acpi_init(void)
+{
+f01088e0:	55                   	push   %ebp
+f01088e1:	89 e5                	mov    %esp,%ebp
+f01088e3:	57                   	push   %edi
+f01088e4:	56                   	push   %esi
+f01088e5:	53                   	push   %ebx
+f01088e6:	83 ec 1c             	sub    $0x1c,%esp
+	if (PGNUM(pa) >= npages)
+f01088e9:	83 3d 74 47 79 f0 00 	cmpl   $0x0,0xf0794774
+f01088f0:	0f 84 bf 00 00 00    	je     f01089b5 <acpi_init+0xd5>
+	ebda = *(uint16_t *) KADDR(0x40E);
+f01088f6:	0f b7 05 0e 04 00 f0 	movzwl 0xf000040e,%eax
+	ebda <<= 4;
+f01088fd:	c1 e0 04             	shl    $0x4,%eax
+	if ((rsdp = rsdp_search1(ebda, 1024)))
+f0108900:	ba 00 04 00 00       	mov    $0x400,%edx
+f0108905:	e8 0d ff ff ff       	call   f0108817 <rsdp_search1>
+f010890a:	89 c3                	mov    %eax,%ebx
+f010890c:	85 c0                	test   %eax,%eax
+f010890e:	0f 84 b7 00 00 00    	je     f01089cb <acpi_init+0xeb>
+		rsdp->revision, rsdp->oem_id);
+f0108914:	8d 73 09             	lea    0x9(%ebx),%esi
+f0108917:	0f b6 43 0f          	movzbl 0xf(%ebx),%eax
+	cprintf("ACPI: RSDP %08p %06x v%02d %.6s\n",
+f010891b:	0f b6 c8             	movzbl %al,%ecx
+f010891e:	ba 14 00 00 00       	mov    $0x14,%edx
+f0108923:	84 c0                	test   %al,%al
+f0108925:	74 03                	je     f010892a <acpi_init+0x4a>
+f0108927:	8b 53 14             	mov    0x14(%ebx),%edx
+	if ((uint32_t)kva < KERNBASE)
+f010892a:	81 fb ff ff ff ef    	cmp    $0xefffffff,%ebx
+f0108930:	0f 86 c2 00 00 00    	jbe    f01089f8 <acpi_init+0x118>
+f0108936:	83 ec 0c             	sub    $0xc,%esp
+f0108939:	56                   	push   %esi
+f010893a:	51                   	push   %ecx
+f010893b:	52                   	push   %edx
+	return (physaddr_t)kva - KERNBASE;
+f010893c:	8d 83 00 00 00 10    	lea    0x10000000(%ebx),%eax
+f0108942:	50                   	push   %eax
+f0108943:	68 a4 e0 10 f0       	push   $0xf010e0a4
+f0108948:	e8 68 c2 ff ff       	call   f0104bb5 <cprintf>
+	rsdp = rsdp_search();
+	if (!rsdp)
+		panic("ACPI: No RSDP found");
+	print_table_rsdp(rsdp);
+
+	if (rsdp->revision) {
+f010894d:	83 c4 20             	add    $0x20,%esp
+f0108950:	80 7b 0f 00          	cmpb   $0x0,0xf(%ebx)
+f0108954:	0f 84 c2 00 00 00    	je     f0108a1c <acpi_init+0x13c>
+		hdr = KADDR(rsdp->xsdt_physical_address);
+f010895a:	8b 5b 18             	mov    0x18(%ebx),%ebx
+	if (PGNUM(pa) >= npages)
+f010895d:	89 d8                	mov    %ebx,%eax
+f010895f:	c1 e8 0c             	shr    $0xc,%eax
+f0108962:	3b 05 74 47 79 f0    	cmp    0xf0794774,%eax
+f0108968:	0f 83 9c 00 00 00    	jae    f0108a0a <acpi_init+0x12a>
+	return (void *)(pa + KERNBASE);
+f010896e:	81 eb 00 00 00 10    	sub    $0x10000000,%ebx
+		sig = ACPI_SIG_XSDT;
+		entry_size = 8;
+f0108974:	c7 45 d8 08 00 00 00 	movl   $0x8,-0x28(%ebp)
+		sig = ACPI_SIG_XSDT;
+f010897b:	bf da e0 10 f0       	mov    $0xf010e0da,%edi
+		hdr = KADDR(rsdp->rsdt_physical_address);
+		sig = ACPI_SIG_RSDT;
+		entry_size = 4;
+	}
+
+	if (memcmp(hdr->signature, sig, 4))
+f0108980:	83 ec 04             	sub    $0x4,%esp
+f0108983:	6a 04                	push   $0x4
+f0108985:	57                   	push   %edi
+f0108986:	53                   	push   %ebx
+f0108987:	e8 5c fc ff ff       	call   f01085e8 <memcmp>
+f010898c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f010898f:	83 c4 10             	add    $0x10,%esp
+f0108992:	85 c0                	test   %eax,%eax
+f0108994:	0f 85 bb 00 00 00    	jne    f0108a55 <acpi_init+0x175>
+		panic("ACPI: Incorrect %s signature", sig);
+	if (sum(hdr, hdr->length))
+f010899a:	8b 73 04             	mov    0x4(%ebx),%esi
+	sum = 0;
+f010899d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01089a0:	89 c2                	mov    %eax,%edx
+	for (i = 0; i < len; i++)
+f01089a2:	39 c6                	cmp    %eax,%esi
+f01089a4:	0f 8e bd 00 00 00    	jle    f0108a67 <acpi_init+0x187>
+		sum += ((uint8_t *)addr)[i];
+f01089aa:	0f b6 0c 03          	movzbl (%ebx,%eax,1),%ecx
+f01089ae:	01 ca                	add    %ecx,%edx
+	for (i = 0; i < len; i++)
+f01089b0:	83 c0 01             	add    $0x1,%eax
+f01089b3:	eb ed                	jmp    f01089a2 <acpi_init+0xc2>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01089b5:	68 0e 04 00 00       	push   $0x40e
+f01089ba:	68 90 be 10 f0       	push   $0xf010be90
+f01089bf:	6a 4d                	push   $0x4d
+f01089c1:	68 c5 e0 10 f0       	push   $0xf010e0c5
+f01089c6:	e8 78 76 ff ff       	call   f0100043 <_panic>
+	return rsdp_search1(0xE0000, 0x20000);
+f01089cb:	ba 00 00 02 00       	mov    $0x20000,%edx
+f01089d0:	b8 00 00 0e 00       	mov    $0xe0000,%eax
+f01089d5:	e8 3d fe ff ff       	call   f0108817 <rsdp_search1>
+f01089da:	89 c3                	mov    %eax,%ebx
+	if (!rsdp)
+f01089dc:	85 c0                	test   %eax,%eax
+f01089de:	0f 85 30 ff ff ff    	jne    f0108914 <acpi_init+0x34>
+		panic("ACPI: No RSDP found");
+f01089e4:	83 ec 04             	sub    $0x4,%esp
+f01089e7:	68 e4 e0 10 f0       	push   $0xf010e0e4
+f01089ec:	6a 60                	push   $0x60
+f01089ee:	68 c5 e0 10 f0       	push   $0xf010e0c5
+f01089f3:	e8 4b 76 ff ff       	call   f0100043 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01089f8:	53                   	push   %ebx
+f01089f9:	68 24 be 10 f0       	push   $0xf010be24
+f01089fe:	6a 16                	push   $0x16
+f0108a00:	68 c5 e0 10 f0       	push   $0xf010e0c5
+f0108a05:	e8 39 76 ff ff       	call   f0100043 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0108a0a:	53                   	push   %ebx
+f0108a0b:	68 90 be 10 f0       	push   $0xf010be90
+f0108a10:	6a 64                	push   $0x64
+f0108a12:	68 c5 e0 10 f0       	push   $0xf010e0c5
+f0108a17:	e8 27 76 ff ff       	call   f0100043 <_panic>
+		hdr = KADDR(rsdp->rsdt_physical_address);
+f0108a1c:	8b 5b 10             	mov    0x10(%ebx),%ebx
+	if (PGNUM(pa) >= npages)
+f0108a1f:	89 d8                	mov    %ebx,%eax
+f0108a21:	c1 e8 0c             	shr    $0xc,%eax
+f0108a24:	3b 05 74 47 79 f0    	cmp    0xf0794774,%eax
+f0108a2a:	73 17                	jae    f0108a43 <acpi_init+0x163>
+	return (void *)(pa + KERNBASE);
+f0108a2c:	81 eb 00 00 00 10    	sub    $0x10000000,%ebx
+		entry_size = 4;
+f0108a32:	c7 45 d8 04 00 00 00 	movl   $0x4,-0x28(%ebp)
+		sig = ACPI_SIG_RSDT;
+f0108a39:	bf df e0 10 f0       	mov    $0xf010e0df,%edi
+f0108a3e:	e9 3d ff ff ff       	jmp    f0108980 <acpi_init+0xa0>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0108a43:	53                   	push   %ebx
+f0108a44:	68 90 be 10 f0       	push   $0xf010be90
+f0108a49:	6a 68                	push   $0x68
+f0108a4b:	68 c5 e0 10 f0       	push   $0xf010e0c5
+f0108a50:	e8 ee 75 ff ff       	call   f0100043 <_panic>
+		panic("ACPI: Incorrect %s signature", sig);
+f0108a55:	57                   	push   %edi
+f0108a56:	68 f8 e0 10 f0       	push   $0xf010e0f8
+f0108a5b:	6a 6e                	push   $0x6e
+f0108a5d:	68 c5 e0 10 f0       	push   $0xf010e0c5
+f0108a62:	e8 dc 75 ff ff       	call   f0100043 <_panic>
+	if (sum(hdr, hdr->length))
+f0108a67:	84 d2                	test   %dl,%dl
+f0108a69:	75 19                	jne    f0108a84 <acpi_init+0x1a4>
+		panic("ACPI: Bad %s checksum", sig);
+	print_table_header(hdr);
+f0108a6b:	89 d8                	mov    %ebx,%eax
+f0108a6d:	e8 39 fd ff ff       	call   f01087ab <print_table_header>
+
+	p = hdr + 1;
+f0108a72:	8d 73 24             	lea    0x24(%ebx),%esi
+	e = (void *)hdr + hdr->length;
+f0108a75:	03 5b 04             	add    0x4(%ebx),%ebx
+f0108a78:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+	for (i = 0; p < e; p += entry_size) {
+f0108a7b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+f0108a82:	eb 57                	jmp    f0108adb <acpi_init+0x1fb>
+		panic("ACPI: Bad %s checksum", sig);
+f0108a84:	57                   	push   %edi
+f0108a85:	68 15 e1 10 f0       	push   $0xf010e115
+f0108a8a:	6a 70                	push   $0x70
+f0108a8c:	68 c5 e0 10 f0       	push   $0xf010e0c5
+f0108a91:	e8 ad 75 ff ff       	call   f0100043 <_panic>
+f0108a96:	53                   	push   %ebx
+f0108a97:	68 90 be 10 f0       	push   $0xf010be90
+f0108a9c:	6a 76                	push   $0x76
+f0108a9e:	68 c5 e0 10 f0       	push   $0xf010e0c5
+f0108aa3:	e8 9b 75 ff ff       	call   f0100043 <_panic>
+		sum += ((uint8_t *)addr)[i];
+f0108aa8:	0f b6 0c 18          	movzbl (%eax,%ebx,1),%ecx
+f0108aac:	01 ca                	add    %ecx,%edx
+	for (i = 0; i < len; i++)
+f0108aae:	83 c0 01             	add    $0x1,%eax
+f0108ab1:	39 c7                	cmp    %eax,%edi
+f0108ab3:	7f f3                	jg     f0108aa8 <acpi_init+0x1c8>
+		hdr = KADDR(*(uint32_t *)p);
+		if (sum(hdr, hdr->length))
+f0108ab5:	84 d2                	test   %dl,%dl
+f0108ab7:	75 1d                	jne    f0108ad6 <acpi_init+0x1f6>
+			continue;
+		print_table_header(hdr);
+f0108ab9:	89 d8                	mov    %ebx,%eax
+f0108abb:	e8 eb fc ff ff       	call   f01087ab <print_table_header>
+		assert(i < ACPI_NR_MAX);
+f0108ac0:	83 7d e4 1f          	cmpl   $0x1f,-0x1c(%ebp)
+f0108ac4:	77 3b                	ja     f0108b01 <acpi_init+0x221>
+		acpi_tables.entries[i++] = hdr;
+f0108ac6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0108ac9:	89 1c 85 c4 53 79 f0 	mov    %ebx,-0xf86ac3c(,%eax,4)
+f0108ad0:	8d 40 01             	lea    0x1(%eax),%eax
+f0108ad3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (i = 0; p < e; p += entry_size) {
+f0108ad6:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f0108ad9:	01 c6                	add    %eax,%esi
+f0108adb:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0108ade:	39 c6                	cmp    %eax,%esi
+f0108ae0:	73 35                	jae    f0108b17 <acpi_init+0x237>
+		hdr = KADDR(*(uint32_t *)p);
+f0108ae2:	8b 1e                	mov    (%esi),%ebx
+	if (PGNUM(pa) >= npages)
+f0108ae4:	89 d8                	mov    %ebx,%eax
+f0108ae6:	c1 e8 0c             	shr    $0xc,%eax
+f0108ae9:	3b 05 74 47 79 f0    	cmp    0xf0794774,%eax
+f0108aef:	73 a5                	jae    f0108a96 <acpi_init+0x1b6>
+	return (void *)(pa + KERNBASE);
+f0108af1:	81 eb 00 00 00 10    	sub    $0x10000000,%ebx
+		if (sum(hdr, hdr->length))
+f0108af7:	8b 7b 04             	mov    0x4(%ebx),%edi
+	sum = 0;
+f0108afa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0108afd:	89 c2                	mov    %eax,%edx
+f0108aff:	eb b0                	jmp    f0108ab1 <acpi_init+0x1d1>
+		assert(i < ACPI_NR_MAX);
+f0108b01:	68 2b e1 10 f0       	push   $0xf010e12b
+f0108b06:	68 bf be 10 f0       	push   $0xf010bebf
+f0108b0b:	6a 7a                	push   $0x7a
+f0108b0d:	68 c5 e0 10 f0       	push   $0xf010e0c5
+f0108b12:	e8 2c 75 ff ff       	call   f0100043 <_panic>
+	}
+	acpi_tables.nr = i;
+f0108b17:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0108b1a:	a3 c0 53 79 f0       	mov    %eax,0xf07953c0
+}
+f0108b1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108b22:	5b                   	pop    %ebx
+f0108b23:	5e                   	pop    %esi
+f0108b24:	5f                   	pop    %edi
+f0108b25:	5d                   	pop    %ebp
+f0108b26:	c3                   	ret
+
+f0108b27 <acpi_get_table>:
+
+void *
+acpi_get_table(const char *signature)
+{
+f0108b27:	55                   	push   %ebp
+f0108b28:	89 e5                	mov    %esp,%ebp
+f0108b2a:	57                   	push   %edi
+f0108b2b:	56                   	push   %esi
+f0108b2c:	53                   	push   %ebx
+f0108b2d:	83 ec 0c             	sub    $0xc,%esp
+f0108b30:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uint32_t i;
+	struct acpi_table_header **phdr = acpi_tables.entries;
+f0108b33:	be c4 53 79 f0       	mov    $0xf07953c4,%esi
+
+	for (i = 0; i < acpi_tables.nr; ++i, ++phdr) {
+f0108b38:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0108b3d:	eb 06                	jmp    f0108b45 <acpi_get_table+0x1e>
+f0108b3f:	83 c3 01             	add    $0x1,%ebx
+f0108b42:	83 c6 04             	add    $0x4,%esi
+f0108b45:	3b 1d c0 53 79 f0    	cmp    0xf07953c0,%ebx
+f0108b4b:	73 18                	jae    f0108b65 <acpi_get_table+0x3e>
+		if (!memcmp((*phdr)->signature, signature, 4))
+f0108b4d:	83 ec 04             	sub    $0x4,%esp
+f0108b50:	6a 04                	push   $0x4
+f0108b52:	57                   	push   %edi
+f0108b53:	ff 36                	push   (%esi)
+f0108b55:	e8 8e fa ff ff       	call   f01085e8 <memcmp>
+f0108b5a:	83 c4 10             	add    $0x10,%esp
+f0108b5d:	85 c0                	test   %eax,%eax
+f0108b5f:	75 de                	jne    f0108b3f <acpi_get_table+0x18>
+			return *phdr;
+f0108b61:	8b 06                	mov    (%esi),%eax
+f0108b63:	eb 05                	jmp    f0108b6a <acpi_get_table+0x43>
+	}
+	return NULL;
+f0108b65:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0108b6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108b6d:	5b                   	pop    %ebx
+f0108b6e:	5e                   	pop    %esi
+f0108b6f:	5f                   	pop    %edi
+f0108b70:	5d                   	pop    %ebp
+f0108b71:	c3                   	ret
+
+f0108b72 <mp_init>:
+unsigned char percpu_kstacks[NCPU][KSTKSIZE]
+__attribute__ ((aligned(PGSIZE)));
+
+void
+mp_init(void)
+{
+f0108b72:	55                   	push   %ebp
+f0108b73:	89 e5                	mov    %esp,%ebp
+f0108b75:	56                   	push   %esi
+f0108b76:	53                   	push   %ebx
+	struct acpi_subtable_header *hdr, *end;
+
+	// 5.2.12.1 MADT Processor Local APIC / SAPIC Structure Entry Order
+	// * initialize processors in the order that they appear in MADT;
+	// * the boot processor is the first processor entry.
+	bootcpu->cpu_status = CPU_STARTED;
+f0108b77:	c7 05 24 60 7d f0 01 	movl   $0x1,0xf07d6024
+f0108b7e:	00 00 00 
+
+	madt = acpi_get_table(ACPI_SIG_MADT);
+f0108b81:	83 ec 0c             	sub    $0xc,%esp
+f0108b84:	68 3b e1 10 f0       	push   $0xf010e13b
+f0108b89:	e8 99 ff ff ff       	call   f0108b27 <acpi_get_table>
+	if (!madt)
+f0108b8e:	83 c4 10             	add    $0x10,%esp
+f0108b91:	85 c0                	test   %eax,%eax
+f0108b93:	74 11                	je     f0108ba6 <mp_init+0x34>
+		panic("ACPI: No MADT found");
+
+	lapic_addr = madt->address;
+f0108b95:	8b 50 24             	mov    0x24(%eax),%edx
+f0108b98:	89 15 e0 63 7d f0    	mov    %edx,0xf07d63e0
+
+	hdr = (void *)madt + sizeof(*madt);
+f0108b9e:	8d 50 2c             	lea    0x2c(%eax),%edx
+	end = (void *)madt + madt->header.length;
+f0108ba1:	03 40 04             	add    0x4(%eax),%eax
+	for (; hdr < end; hdr = (void *)hdr + hdr->length) {
+f0108ba4:	eb 2b                	jmp    f0108bd1 <mp_init+0x5f>
+		panic("ACPI: No MADT found");
+f0108ba6:	83 ec 04             	sub    $0x4,%esp
+f0108ba9:	68 40 e1 10 f0       	push   $0xf010e140
+f0108bae:	6a 1c                	push   $0x1c
+f0108bb0:	68 54 e1 10 f0       	push   $0xf010e154
+f0108bb5:	e8 89 74 ff ff       	call   f0100043 <_panic>
+		switch (hdr->type) {
+		case ACPI_MADT_TYPE_LOCAL_APIC: {
+			struct acpi_madt_local_apic *p = (void *)hdr;
+			bool enabled = p->lapic_flags & BIT(0);
+
+			if (ncpu < NCPU && enabled) {
+f0108bba:	8b 35 00 60 7d f0    	mov    0xf07d6000,%esi
+f0108bc0:	f6 42 04 01          	testb  $0x1,0x4(%edx)
+f0108bc4:	74 05                	je     f0108bcb <mp_init+0x59>
+f0108bc6:	83 fe 07             	cmp    $0x7,%esi
+f0108bc9:	7e 27                	jle    f0108bf2 <mp_init+0x80>
+	for (; hdr < end; hdr = (void *)hdr + hdr->length) {
+f0108bcb:	0f b6 4a 01          	movzbl 0x1(%edx),%ecx
+f0108bcf:	01 ca                	add    %ecx,%edx
+f0108bd1:	39 c2                	cmp    %eax,%edx
+f0108bd3:	73 35                	jae    f0108c0a <mp_init+0x98>
+		switch (hdr->type) {
+f0108bd5:	0f b6 0a             	movzbl (%edx),%ecx
+f0108bd8:	84 c9                	test   %cl,%cl
+f0108bda:	74 de                	je     f0108bba <mp_init+0x48>
+f0108bdc:	80 f9 01             	cmp    $0x1,%cl
+f0108bdf:	75 ea                	jne    f0108bcb <mp_init+0x59>
+		}
+		case ACPI_MADT_TYPE_IO_APIC: {
+			struct acpi_madt_io_apic *p = (void *)hdr;
+
+			// We use one IOAPIC.
+			if (p->global_irq_base == 0)
+f0108be1:	83 7a 08 00          	cmpl   $0x0,0x8(%edx)
+f0108be5:	75 e4                	jne    f0108bcb <mp_init+0x59>
+				ioapic_addr = p->address;
+f0108be7:	8b 4a 04             	mov    0x4(%edx),%ecx
+f0108bea:	89 0d e8 63 7d f0    	mov    %ecx,0xf07d63e8
+f0108bf0:	eb d9                	jmp    f0108bcb <mp_init+0x59>
+				cpus[ncpu].cpu_apicid = p->id;
+f0108bf2:	6b de 78             	imul   $0x78,%esi,%ebx
+f0108bf5:	0f b6 4a 03          	movzbl 0x3(%edx),%ecx
+f0108bf9:	88 8b 20 60 7d f0    	mov    %cl,-0xf829fe0(%ebx)
+				ncpu++;
+f0108bff:	8d 4e 01             	lea    0x1(%esi),%ecx
+f0108c02:	89 0d 00 60 7d f0    	mov    %ecx,0xf07d6000
+f0108c08:	eb c1                	jmp    f0108bcb <mp_init+0x59>
+		default:
+			break;
+		}
+	}
+
+	cprintf("SMP: %d CPU(s)\n", ncpu);
+f0108c0a:	83 ec 08             	sub    $0x8,%esp
+f0108c0d:	ff 35 00 60 7d f0    	push   0xf07d6000
+f0108c13:	68 64 e1 10 f0       	push   $0xf010e164
+f0108c18:	e8 98 bf ff ff       	call   f0104bb5 <cprintf>
+}
+f0108c1d:	83 c4 10             	add    $0x10,%esp
+f0108c20:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0108c23:	5b                   	pop    %ebx
+f0108c24:	5e                   	pop    %esi
+f0108c25:	5d                   	pop    %ebp
+f0108c26:	c3                   	ret
+
+f0108c27 <lapic_write>:
+	return lapic[index];
+}
+
+static void
+lapic_write(uint32_t index, uint32_t value)
+{
+f0108c27:	89 c1                	mov    %eax,%ecx
+	lapic[index] = value;
+f0108c29:	a1 e4 63 7d f0       	mov    0xf07d63e4,%eax
+f0108c2e:	8d 0c 88             	lea    (%eax,%ecx,4),%ecx
+f0108c31:	89 11                	mov    %edx,(%ecx)
+	lapic[ID];  // wait for write to finish, by reading
+f0108c33:	8b 40 20             	mov    0x20(%eax),%eax
+}
+f0108c36:	c3                   	ret
+
+f0108c37 <cpunum>:
+int
+cpunum(void)
+{
+	int apicid, i;
+
+	if (!lapic)
+f0108c37:	a1 e4 63 7d f0       	mov    0xf07d63e4,%eax
+f0108c3c:	85 c0                	test   %eax,%eax
+f0108c3e:	74 48                	je     f0108c88 <cpunum+0x51>
+{
+f0108c40:	55                   	push   %ebp
+f0108c41:	89 e5                	mov    %esp,%ebp
+f0108c43:	53                   	push   %ebx
+f0108c44:	83 ec 04             	sub    $0x4,%esp
+	return lapic[index];
+f0108c47:	8b 48 20             	mov    0x20(%eax),%ecx
+		return 0;
+	apicid = lapic_read(ID) >> 24;
+f0108c4a:	c1 e9 18             	shr    $0x18,%ecx
+	for (i = 0; i < ncpu; ++i) {
+f0108c4d:	8b 1d 00 60 7d f0    	mov    0xf07d6000,%ebx
+f0108c53:	b8 00 00 00 00       	mov    $0x0,%eax
+f0108c58:	39 c3                	cmp    %eax,%ebx
+f0108c5a:	7e 13                	jle    f0108c6f <cpunum+0x38>
+		if (cpus[i].cpu_apicid == apicid)
+f0108c5c:	6b d0 78             	imul   $0x78,%eax,%edx
+f0108c5f:	0f b6 92 20 60 7d f0 	movzbl -0xf829fe0(%edx),%edx
+f0108c66:	39 ca                	cmp    %ecx,%edx
+f0108c68:	74 24                	je     f0108c8e <cpunum+0x57>
+	for (i = 0; i < ncpu; ++i) {
+f0108c6a:	83 c0 01             	add    $0x1,%eax
+f0108c6d:	eb e9                	jmp    f0108c58 <cpunum+0x21>
+			return i;
+	}
+	assert(0);
+f0108c6f:	68 d2 ce 10 f0       	push   $0xf010ced2
+f0108c74:	68 bf be 10 f0       	push   $0xf010bebf
+f0108c79:	68 86 00 00 00       	push   $0x86
+f0108c7e:	68 74 e1 10 f0       	push   $0xf010e174
+f0108c83:	e8 bb 73 ff ff       	call   f0100043 <_panic>
+		return 0;
+f0108c88:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0108c8d:	c3                   	ret
+f0108c8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0108c91:	c9                   	leave
+f0108c92:	c3                   	ret
+
+f0108c93 <lapic_init>:
+{
+f0108c93:	55                   	push   %ebp
+f0108c94:	89 e5                	mov    %esp,%ebp
+f0108c96:	53                   	push   %ebx
+f0108c97:	83 ec 04             	sub    $0x4,%esp
+	assert(lapic_addr);
+f0108c9a:	a1 e0 63 7d f0       	mov    0xf07d63e0,%eax
+f0108c9f:	85 c0                	test   %eax,%eax
+f0108ca1:	0f 84 10 01 00 00    	je     f0108db7 <lapic_init+0x124>
+	lapic = mmio_map_region(lapic_addr, 4096);
+f0108ca7:	83 ec 08             	sub    $0x8,%esp
+f0108caa:	68 00 10 00 00       	push   $0x1000
+f0108caf:	50                   	push   %eax
+f0108cb0:	e8 91 91 ff ff       	call   f0101e46 <mmio_map_region>
+f0108cb5:	89 c3                	mov    %eax,%ebx
+f0108cb7:	a3 e4 63 7d f0       	mov    %eax,0xf07d63e4
+	if (thiscpu == bootcpu)
+f0108cbc:	e8 76 ff ff ff       	call   f0108c37 <cpunum>
+f0108cc1:	6b c0 78             	imul   $0x78,%eax,%eax
+f0108cc4:	83 c4 10             	add    $0x10,%esp
+f0108cc7:	85 c0                	test   %eax,%eax
+f0108cc9:	0f 84 fe 00 00 00    	je     f0108dcd <lapic_init+0x13a>
+	lapic_write(SVR, ENABLE | (IRQ_OFFSET + IRQ_SPURIOUS));
+f0108ccf:	ba 27 01 00 00       	mov    $0x127,%edx
+f0108cd4:	b8 3c 00 00 00       	mov    $0x3c,%eax
+f0108cd9:	e8 49 ff ff ff       	call   f0108c27 <lapic_write>
+	lapic_write(TDCR, X1);
+f0108cde:	ba 0b 00 00 00       	mov    $0xb,%edx
+f0108ce3:	b8 f8 00 00 00       	mov    $0xf8,%eax
+f0108ce8:	e8 3a ff ff ff       	call   f0108c27 <lapic_write>
+	lapic_write(TIMER, PERIODIC | (IRQ_OFFSET + IRQ_TIMER));
+f0108ced:	ba 20 00 02 00       	mov    $0x20020,%edx
+f0108cf2:	b8 c8 00 00 00       	mov    $0xc8,%eax
+f0108cf7:	e8 2b ff ff ff       	call   f0108c27 <lapic_write>
+	lapic_write(TICR, 10000000);
+f0108cfc:	ba 80 96 98 00       	mov    $0x989680,%edx
+f0108d01:	b8 e0 00 00 00       	mov    $0xe0,%eax
+f0108d06:	e8 1c ff ff ff       	call   f0108c27 <lapic_write>
+	if (thiscpu != bootcpu)
+f0108d0b:	e8 27 ff ff ff       	call   f0108c37 <cpunum>
+f0108d10:	6b c0 78             	imul   $0x78,%eax,%eax
+f0108d13:	85 c0                	test   %eax,%eax
+f0108d15:	0f 85 d4 00 00 00    	jne    f0108def <lapic_init+0x15c>
+	lapic_write(LINT1, MASKED);
+f0108d1b:	ba 00 00 01 00       	mov    $0x10000,%edx
+f0108d20:	b8 d8 00 00 00       	mov    $0xd8,%eax
+f0108d25:	e8 fd fe ff ff       	call   f0108c27 <lapic_write>
+	return lapic[index];
+f0108d2a:	8b 1d e4 63 7d f0    	mov    0xf07d63e4,%ebx
+f0108d30:	8b 43 30             	mov    0x30(%ebx),%eax
+	if (((lapic_read(VER)>>16) & 0xFF) >= 4)
+f0108d33:	c1 e8 10             	shr    $0x10,%eax
+f0108d36:	a8 fc                	test   $0xfc,%al
+f0108d38:	0f 85 c5 00 00 00    	jne    f0108e03 <lapic_init+0x170>
+	lapic_write(ERROR, IRQ_OFFSET + IRQ_ERROR);
+f0108d3e:	ba 33 00 00 00       	mov    $0x33,%edx
+f0108d43:	b8 dc 00 00 00       	mov    $0xdc,%eax
+f0108d48:	e8 da fe ff ff       	call   f0108c27 <lapic_write>
+	lapic_write(ESR, 0);
+f0108d4d:	ba 00 00 00 00       	mov    $0x0,%edx
+f0108d52:	b8 a0 00 00 00       	mov    $0xa0,%eax
+f0108d57:	e8 cb fe ff ff       	call   f0108c27 <lapic_write>
+	lapic_write(ESR, 0);
+f0108d5c:	ba 00 00 00 00       	mov    $0x0,%edx
+f0108d61:	b8 a0 00 00 00       	mov    $0xa0,%eax
+f0108d66:	e8 bc fe ff ff       	call   f0108c27 <lapic_write>
+	lapic_write(EOI, 0);
+f0108d6b:	ba 00 00 00 00       	mov    $0x0,%edx
+f0108d70:	b8 2c 00 00 00       	mov    $0x2c,%eax
+f0108d75:	e8 ad fe ff ff       	call   f0108c27 <lapic_write>
+	lapic_write(ICRHI, 0);
+f0108d7a:	ba 00 00 00 00       	mov    $0x0,%edx
+f0108d7f:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f0108d84:	e8 9e fe ff ff       	call   f0108c27 <lapic_write>
+	lapic_write(ICRLO, BCAST | INIT | LEVEL);
+f0108d89:	ba 00 85 08 00       	mov    $0x88500,%edx
+f0108d8e:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0108d93:	e8 8f fe ff ff       	call   f0108c27 <lapic_write>
+	return lapic[index];
+f0108d98:	8b 83 00 03 00 00    	mov    0x300(%ebx),%eax
+	while(lapic_read(ICRLO) & DELIVS)
+f0108d9e:	f6 c4 10             	test   $0x10,%ah
+f0108da1:	75 f5                	jne    f0108d98 <lapic_init+0x105>
+	lapic_write(TPR, 0);
+f0108da3:	ba 00 00 00 00       	mov    $0x0,%edx
+f0108da8:	b8 20 00 00 00       	mov    $0x20,%eax
+f0108dad:	e8 75 fe ff ff       	call   f0108c27 <lapic_write>
+}
+f0108db2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0108db5:	c9                   	leave
+f0108db6:	c3                   	ret
+	assert(lapic_addr);
+f0108db7:	68 81 e1 10 f0       	push   $0xf010e181
+f0108dbc:	68 bf be 10 f0       	push   $0xf010bebf
+f0108dc1:	6a 40                	push   $0x40
+f0108dc3:	68 74 e1 10 f0       	push   $0xf010e174
+f0108dc8:	e8 76 72 ff ff       	call   f0100043 <_panic>
+	return lapic[index];
+f0108dcd:	8b 43 30             	mov    0x30(%ebx),%eax
+		cprintf("SMP: LAPIC %08p v%02x\n", lapic_addr, lapic_read(VER) & 0xFF);
+f0108dd0:	83 ec 04             	sub    $0x4,%esp
+f0108dd3:	0f b6 c0             	movzbl %al,%eax
+f0108dd6:	50                   	push   %eax
+f0108dd7:	ff 35 e0 63 7d f0    	push   0xf07d63e0
+f0108ddd:	68 8c e1 10 f0       	push   $0xf010e18c
+f0108de2:	e8 ce bd ff ff       	call   f0104bb5 <cprintf>
+f0108de7:	83 c4 10             	add    $0x10,%esp
+f0108dea:	e9 e0 fe ff ff       	jmp    f0108ccf <lapic_init+0x3c>
+		lapic_write(LINT0, MASKED);
+f0108def:	ba 00 00 01 00       	mov    $0x10000,%edx
+f0108df4:	b8 d4 00 00 00       	mov    $0xd4,%eax
+f0108df9:	e8 29 fe ff ff       	call   f0108c27 <lapic_write>
+f0108dfe:	e9 18 ff ff ff       	jmp    f0108d1b <lapic_init+0x88>
+		lapic_write(PCINT, MASKED);
+f0108e03:	ba 00 00 01 00       	mov    $0x10000,%edx
+f0108e08:	b8 d0 00 00 00       	mov    $0xd0,%eax
+f0108e0d:	e8 15 fe ff ff       	call   f0108c27 <lapic_write>
+f0108e12:	e9 27 ff ff ff       	jmp    f0108d3e <lapic_init+0xab>
+
+f0108e17 <lapic_eoi>:
+
+// Acknowledge interrupt.
+void
+lapic_eoi(void)
+{
+	if (lapic)
+f0108e17:	83 3d e4 63 7d f0 00 	cmpl   $0x0,0xf07d63e4
+f0108e1e:	74 17                	je     f0108e37 <lapic_eoi+0x20>
+{
+f0108e20:	55                   	push   %ebp
+f0108e21:	89 e5                	mov    %esp,%ebp
+f0108e23:	83 ec 08             	sub    $0x8,%esp
+		lapic_write(EOI, 0);
+f0108e26:	ba 00 00 00 00       	mov    $0x0,%edx
+f0108e2b:	b8 2c 00 00 00       	mov    $0x2c,%eax
+f0108e30:	e8 f2 fd ff ff       	call   f0108c27 <lapic_write>
+}
+f0108e35:	c9                   	leave
+f0108e36:	c3                   	ret
+f0108e37:	c3                   	ret
+
+f0108e38 <lapic_startap>:
+
+// Start additional processor running entry code at addr.
+// See Appendix B of MultiProcessor Specification.
+void
+lapic_startap(uint8_t apicid, uint32_t addr)
+{
+f0108e38:	55                   	push   %ebp
+f0108e39:	89 e5                	mov    %esp,%ebp
+f0108e3b:	56                   	push   %esi
+f0108e3c:	53                   	push   %ebx
+f0108e3d:	8b 75 08             	mov    0x8(%ebp),%esi
+f0108e40:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0108e43:	b8 0f 00 00 00       	mov    $0xf,%eax
+f0108e48:	ba 70 00 00 00       	mov    $0x70,%edx
+f0108e4d:	ee                   	out    %al,(%dx)
+f0108e4e:	b8 0a 00 00 00       	mov    $0xa,%eax
+f0108e53:	ba 71 00 00 00       	mov    $0x71,%edx
+f0108e58:	ee                   	out    %al,(%dx)
+	if (PGNUM(pa) >= npages)
+f0108e59:	83 3d 74 47 79 f0 00 	cmpl   $0x0,0xf0794774
+f0108e60:	74 7e                	je     f0108ee0 <lapic_startap+0xa8>
+	// and the warm reset vector (DWORD based at 40:67) to point at
+	// the AP startup code prior to the [universal startup algorithm]."
+	outb(IO_RTC, 0xF);  // offset 0xF is shutdown code
+	outb(IO_RTC+1, 0x0A);
+	wrv = (uint16_t *)KADDR((0x40 << 4 | 0x67));  // Warm reset vector
+	wrv[0] = 0;
+f0108e62:	66 c7 05 67 04 00 f0 	movw   $0x0,0xf0000467
+f0108e69:	00 00 
+	wrv[1] = addr >> 4;
+f0108e6b:	89 d8                	mov    %ebx,%eax
+f0108e6d:	c1 e8 04             	shr    $0x4,%eax
+f0108e70:	66 a3 69 04 00 f0    	mov    %ax,0xf0000469
+
+	// "Universal startup algorithm."
+	// Send INIT (level-triggered) interrupt to reset other CPU.
+	lapic_write(ICRHI, apicid << 24);
+f0108e76:	c1 e6 18             	shl    $0x18,%esi
+f0108e79:	89 f2                	mov    %esi,%edx
+f0108e7b:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f0108e80:	e8 a2 fd ff ff       	call   f0108c27 <lapic_write>
+	lapic_write(ICRLO, INIT | LEVEL | ASSERT);
+f0108e85:	ba 00 c5 00 00       	mov    $0xc500,%edx
+f0108e8a:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0108e8f:	e8 93 fd ff ff       	call   f0108c27 <lapic_write>
+	microdelay(200);
+	lapic_write(ICRLO, INIT | LEVEL);
+f0108e94:	ba 00 85 00 00       	mov    $0x8500,%edx
+f0108e99:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0108e9e:	e8 84 fd ff ff       	call   f0108c27 <lapic_write>
+	// when it is in the halted state due to an INIT.  So the second
+	// should be ignored, but it is part of the official Intel algorithm.
+	// Bochs complains about the second one.  Too bad for Bochs.
+	for (i = 0; i < 2; i++) {
+		lapic_write(ICRHI, apicid << 24);
+		lapic_write(ICRLO, STARTUP | (addr >> 12));
+f0108ea3:	c1 eb 0c             	shr    $0xc,%ebx
+f0108ea6:	80 cf 06             	or     $0x6,%bh
+		lapic_write(ICRHI, apicid << 24);
+f0108ea9:	89 f2                	mov    %esi,%edx
+f0108eab:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f0108eb0:	e8 72 fd ff ff       	call   f0108c27 <lapic_write>
+		lapic_write(ICRLO, STARTUP | (addr >> 12));
+f0108eb5:	89 da                	mov    %ebx,%edx
+f0108eb7:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0108ebc:	e8 66 fd ff ff       	call   f0108c27 <lapic_write>
+		lapic_write(ICRHI, apicid << 24);
+f0108ec1:	89 f2                	mov    %esi,%edx
+f0108ec3:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f0108ec8:	e8 5a fd ff ff       	call   f0108c27 <lapic_write>
+		lapic_write(ICRLO, STARTUP | (addr >> 12));
+f0108ecd:	89 da                	mov    %ebx,%edx
+f0108ecf:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0108ed4:	e8 4e fd ff ff       	call   f0108c27 <lapic_write>
+		microdelay(200);
+	}
+}
+f0108ed9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0108edc:	5b                   	pop    %ebx
+f0108edd:	5e                   	pop    %esi
+f0108ede:	5d                   	pop    %ebp
+f0108edf:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0108ee0:	68 67 04 00 00       	push   $0x467
+f0108ee5:	68 90 be 10 f0       	push   $0xf010be90
+f0108eea:	68 a7 00 00 00       	push   $0xa7
+f0108eef:	68 74 e1 10 f0       	push   $0xf010e174
+f0108ef4:	e8 4a 71 ff ff       	call   f0100043 <_panic>
+
+f0108ef9 <lapic_ipi>:
+
+void
+lapic_ipi(int vector)
+{
+f0108ef9:	55                   	push   %ebp
+f0108efa:	89 e5                	mov    %esp,%ebp
+f0108efc:	83 ec 08             	sub    $0x8,%esp
+	lapic_write(ICRLO, OTHERS | FIXED | vector);
+f0108eff:	8b 55 08             	mov    0x8(%ebp),%edx
+f0108f02:	81 ca 00 00 0c 00    	or     $0xc0000,%edx
+f0108f08:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0108f0d:	e8 15 fd ff ff       	call   f0108c27 <lapic_write>
+	return lapic[index];
+f0108f12:	8b 15 e4 63 7d f0    	mov    0xf07d63e4,%edx
+f0108f18:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+	while (lapic_read(ICRLO) & DELIVS)
+f0108f1e:	f6 c4 10             	test   $0x10,%ah
+f0108f21:	75 f5                	jne    f0108f18 <lapic_ipi+0x1f>
+		;
+}
+f0108f23:	c9                   	leave
+f0108f24:	c3                   	ret
+
+f0108f25 <ioapic_init>:
+	*(ioapic + IOWIN) = data;
+}
+
+void
+ioapic_init(void)
+{
+f0108f25:	55                   	push   %ebp
+f0108f26:	89 e5                	mov    %esp,%ebp
+f0108f28:	57                   	push   %edi
+f0108f29:	56                   	push   %esi
+f0108f2a:	53                   	push   %ebx
+f0108f2b:	83 ec 0c             	sub    $0xc,%esp
+	int i, reg_ver, ver, pins;
+
+	// Default physical address.
+	assert(ioapic_addr == 0xfec00000);
+f0108f2e:	81 3d e8 63 7d f0 00 	cmpl   $0xfec00000,0xf07d63e8
+f0108f35:	00 c0 fe 
+f0108f38:	0f 85 80 00 00 00    	jne    f0108fbe <ioapic_init+0x99>
+
+	// IOAPIC is the default physical address.  Map it in to
+	// virtual memory so we can access it.
+	ioapic = mmio_map_region(ioapic_addr, 4096);
+f0108f3e:	83 ec 08             	sub    $0x8,%esp
+f0108f41:	68 00 10 00 00       	push   $0x1000
+f0108f46:	68 00 00 c0 fe       	push   $0xfec00000
+f0108f4b:	e8 f6 8e ff ff       	call   f0101e46 <mmio_map_region>
+f0108f50:	a3 ec 63 7d f0       	mov    %eax,0xf07d63ec
+	*(ioapic + IOREGSEL) = reg;
+f0108f55:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	return *(ioapic + IOWIN);
+f0108f5b:	8b 40 10             	mov    0x10(%eax),%eax
+
+	reg_ver = ioapic_read(IOAPICVER);
+	ver = reg_ver & 0xff;
+	pins = ((reg_ver >> 16) & 0xff) + 1;
+f0108f5e:	89 c2                	mov    %eax,%edx
+f0108f60:	c1 fa 10             	sar    $0x10,%edx
+f0108f63:	0f b6 f2             	movzbl %dl,%esi
+	cprintf("SMP: IOAPIC %08p v%02x [global_irq %02d-%02d]\n",
+f0108f66:	89 34 24             	mov    %esi,(%esp)
+f0108f69:	6a 00                	push   $0x0
+	ver = reg_ver & 0xff;
+f0108f6b:	0f b6 c0             	movzbl %al,%eax
+	cprintf("SMP: IOAPIC %08p v%02x [global_irq %02d-%02d]\n",
+f0108f6e:	50                   	push   %eax
+f0108f6f:	ff 35 e8 63 7d f0    	push   0xf07d63e8
+f0108f75:	68 cc e1 10 f0       	push   $0xf010e1cc
+f0108f7a:	e8 36 bc ff ff       	call   f0104bb5 <cprintf>
+	*(ioapic + IOREGSEL) = reg;
+f0108f7f:	8b 0d ec 63 7d f0    	mov    0xf07d63ec,%ecx
+f0108f85:	83 c6 21             	add    $0x21,%esi
+		ioapic_addr, ver, 0, pins - 1);
+
+	// Mark all interrupts edge-triggered, active high, disabled,
+	// and not routed to any CPUs.
+	for (i = 0; i < pins; ++i) {
+f0108f88:	83 c4 20             	add    $0x20,%esp
+	*(ioapic + IOREGSEL) = reg;
+f0108f8b:	b8 20 00 00 00       	mov    $0x20,%eax
+		ioapic_write(IOREDTBL+2*i, INT_DISABLED | (IRQ_OFFSET + i));
+f0108f90:	89 c3                	mov    %eax,%ebx
+f0108f92:	81 cb 00 00 01 00    	or     $0x10000,%ebx
+	*(ioapic + IOREGSEL) = reg;
+f0108f98:	8d 14 00             	lea    (%eax,%eax,1),%edx
+f0108f9b:	8d 7a d0             	lea    -0x30(%edx),%edi
+f0108f9e:	89 39                	mov    %edi,(%ecx)
+	*(ioapic + IOWIN) = data;
+f0108fa0:	89 59 10             	mov    %ebx,0x10(%ecx)
+	*(ioapic + IOREGSEL) = reg;
+f0108fa3:	83 ea 2f             	sub    $0x2f,%edx
+f0108fa6:	89 11                	mov    %edx,(%ecx)
+	*(ioapic + IOWIN) = data;
+f0108fa8:	c7 41 10 00 00 00 00 	movl   $0x0,0x10(%ecx)
+	for (i = 0; i < pins; ++i) {
+f0108faf:	83 c0 01             	add    $0x1,%eax
+f0108fb2:	39 f0                	cmp    %esi,%eax
+f0108fb4:	75 da                	jne    f0108f90 <ioapic_init+0x6b>
+		ioapic_write(IOREDTBL+2*i+1, 0);
+	}
+}
+f0108fb6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108fb9:	5b                   	pop    %ebx
+f0108fba:	5e                   	pop    %esi
+f0108fbb:	5f                   	pop    %edi
+f0108fbc:	5d                   	pop    %ebp
+f0108fbd:	c3                   	ret
+	assert(ioapic_addr == 0xfec00000);
+f0108fbe:	68 a3 e1 10 f0       	push   $0xf010e1a3
+f0108fc3:	68 bf be 10 f0       	push   $0xf010bebf
+f0108fc8:	6a 33                	push   $0x33
+f0108fca:	68 bd e1 10 f0       	push   $0xf010e1bd
+f0108fcf:	e8 6f 70 ff ff       	call   f0100043 <_panic>
+
+f0108fd4 <ioapic_enable>:
+
+void
+ioapic_enable(int irq, int apicid)
+{
+f0108fd4:	55                   	push   %ebp
+f0108fd5:	89 e5                	mov    %esp,%ebp
+f0108fd7:	8b 45 08             	mov    0x8(%ebp),%eax
+	// Mark interrupt edge-triggered, active high, enabled,
+	// and routed to the given cpu's APIC ID.
+	ioapic_write(IOREDTBL+2*irq, IRQ_OFFSET + irq);
+f0108fda:	8d 48 20             	lea    0x20(%eax),%ecx
+f0108fdd:	8d 54 00 10          	lea    0x10(%eax,%eax,1),%edx
+	*(ioapic + IOREGSEL) = reg;
+f0108fe1:	a1 ec 63 7d f0       	mov    0xf07d63ec,%eax
+f0108fe6:	89 10                	mov    %edx,(%eax)
+	*(ioapic + IOWIN) = data;
+f0108fe8:	89 48 10             	mov    %ecx,0x10(%eax)
+	ioapic_write(IOREDTBL+2*irq+1, apicid << 24);
+f0108feb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0108fee:	c1 e1 18             	shl    $0x18,%ecx
+f0108ff1:	83 c2 01             	add    $0x1,%edx
+	*(ioapic + IOREGSEL) = reg;
+f0108ff4:	89 10                	mov    %edx,(%eax)
+	*(ioapic + IOWIN) = data;
+f0108ff6:	89 48 10             	mov    %ecx,0x10(%eax)
+}
+f0108ff9:	5d                   	pop    %ebp
+f0108ffa:	c3                   	ret
+
+f0108ffb <__spin_initlock>:
+}
+#endif
+
+void
+__spin_initlock(struct spinlock *lk, char *name)
+{
+f0108ffb:	55                   	push   %ebp
+f0108ffc:	89 e5                	mov    %esp,%ebp
+f0108ffe:	8b 45 08             	mov    0x8(%ebp),%eax
+	lk->locked = 0;
+f0109001:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+#ifdef DEBUG_SPINLOCK
+	lk->name = name;
+f0109007:	8b 55 0c             	mov    0xc(%ebp),%edx
+f010900a:	89 50 04             	mov    %edx,0x4(%eax)
+	lk->cpu = 0;
+f010900d:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+#endif
+}
+f0109014:	5d                   	pop    %ebp
+f0109015:	c3                   	ret
+
+f0109016 <spin_lock>:
+// Loops (spins) until the lock is acquired.
+// Holding a lock for a long time may cause
+// other CPUs to waste time spinning to acquire it.
+void
+spin_lock(struct spinlock *lk)
+{
+f0109016:	55                   	push   %ebp
+f0109017:	89 e5                	mov    %esp,%ebp
+f0109019:	56                   	push   %esi
+f010901a:	53                   	push   %ebx
+f010901b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	return lock->locked && lock->cpu == thiscpu;
+f010901e:	83 3b 00             	cmpl   $0x0,(%ebx)
+f0109021:	75 07                	jne    f010902a <spin_lock+0x14>
+	asm volatile("lock; xchgl %0, %1"
+f0109023:	ba 01 00 00 00       	mov    $0x1,%edx
+f0109028:	eb 34                	jmp    f010905e <spin_lock+0x48>
+f010902a:	8b 73 08             	mov    0x8(%ebx),%esi
+f010902d:	e8 05 fc ff ff       	call   f0108c37 <cpunum>
+f0109032:	6b c0 78             	imul   $0x78,%eax,%eax
+f0109035:	05 20 60 7d f0       	add    $0xf07d6020,%eax
+#ifdef DEBUG_SPINLOCK
+	if (holding(lk))
+f010903a:	39 c6                	cmp    %eax,%esi
+f010903c:	75 e5                	jne    f0109023 <spin_lock+0xd>
+		panic("CPU %d cannot acquire %s: already holding", cpunum(), lk->name);
+f010903e:	8b 5b 04             	mov    0x4(%ebx),%ebx
+f0109041:	e8 f1 fb ff ff       	call   f0108c37 <cpunum>
+f0109046:	83 ec 0c             	sub    $0xc,%esp
+f0109049:	53                   	push   %ebx
+f010904a:	50                   	push   %eax
+f010904b:	68 fc e1 10 f0       	push   $0xf010e1fc
+f0109050:	6a 41                	push   $0x41
+f0109052:	68 5e e2 10 f0       	push   $0xf010e25e
+f0109057:	e8 e7 6f ff ff       	call   f0100043 <_panic>
+
+	// The xchg is atomic.
+	// It also serializes, so that reads after acquire are not
+	// reordered before it. 
+	while (xchg(&lk->locked, 1) != 0)
+		asm volatile ("pause");
+f010905c:	f3 90                	pause
+f010905e:	89 d0                	mov    %edx,%eax
+f0109060:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&lk->locked, 1) != 0)
+f0109063:	85 c0                	test   %eax,%eax
+f0109065:	75 f5                	jne    f010905c <spin_lock+0x46>
+
+	// Record info about lock acquisition for debugging.
+#ifdef DEBUG_SPINLOCK
+	lk->cpu = thiscpu;
+f0109067:	e8 cb fb ff ff       	call   f0108c37 <cpunum>
+f010906c:	6b c0 78             	imul   $0x78,%eax,%eax
+f010906f:	05 20 60 7d f0       	add    $0xf07d6020,%eax
+f0109074:	89 43 08             	mov    %eax,0x8(%ebx)
+	asm volatile("movl %%ebp,%0" : "=r" (ebp));
+f0109077:	89 ea                	mov    %ebp,%edx
+	for (i = 0; i < 10; i++){
+f0109079:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (ebp == 0 || ebp < (uint32_t *)ULIM)
+f010907e:	83 f8 09             	cmp    $0x9,%eax
+f0109081:	7f 21                	jg     f01090a4 <spin_lock+0x8e>
+f0109083:	81 fa ff ff 7f ef    	cmp    $0xef7fffff,%edx
+f0109089:	76 19                	jbe    f01090a4 <spin_lock+0x8e>
+		pcs[i] = ebp[1];          // saved %eip
+f010908b:	8b 4a 04             	mov    0x4(%edx),%ecx
+f010908e:	89 4c 83 0c          	mov    %ecx,0xc(%ebx,%eax,4)
+		ebp = (uint32_t *)ebp[0]; // saved %ebp
+f0109092:	8b 12                	mov    (%edx),%edx
+	for (i = 0; i < 10; i++){
+f0109094:	83 c0 01             	add    $0x1,%eax
+f0109097:	eb e5                	jmp    f010907e <spin_lock+0x68>
+		pcs[i] = 0;
+f0109099:	c7 44 83 0c 00 00 00 	movl   $0x0,0xc(%ebx,%eax,4)
+f01090a0:	00 
+	for (; i < 10; i++)
+f01090a1:	83 c0 01             	add    $0x1,%eax
+f01090a4:	83 f8 09             	cmp    $0x9,%eax
+f01090a7:	7e f0                	jle    f0109099 <spin_lock+0x83>
+	get_caller_pcs(lk->pcs);
+#endif
+}
+f01090a9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01090ac:	5b                   	pop    %ebx
+f01090ad:	5e                   	pop    %esi
+f01090ae:	5d                   	pop    %ebp
+f01090af:	c3                   	ret
+
+f01090b0 <spin_unlock>:
+
+// Release the lock.
+void
+spin_unlock(struct spinlock *lk)
+{
+f01090b0:	55                   	push   %ebp
+f01090b1:	89 e5                	mov    %esp,%ebp
+f01090b3:	57                   	push   %edi
+f01090b4:	56                   	push   %esi
+f01090b5:	53                   	push   %ebx
+f01090b6:	83 ec 5c             	sub    $0x5c,%esp
+f01090b9:	8b 75 08             	mov    0x8(%ebp),%esi
+	return lock->locked && lock->cpu == thiscpu;
+f01090bc:	83 3e 00             	cmpl   $0x0,(%esi)
+f01090bf:	75 44                	jne    f0109105 <spin_unlock+0x55>
+#ifdef DEBUG_SPINLOCK
+	if (!holding(lk)) {
+		int i;
+		uint32_t pcs[10];
+		// Nab the acquiring EIP chain before it gets released
+		memmove(pcs, lk->pcs, sizeof pcs);
+f01090c1:	83 ec 04             	sub    $0x4,%esp
+f01090c4:	6a 28                	push   $0x28
+f01090c6:	8d 46 0c             	lea    0xc(%esi),%eax
+f01090c9:	50                   	push   %eax
+f01090ca:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+f01090cd:	53                   	push   %ebx
+f01090ce:	e8 9d f4 ff ff       	call   f0108570 <memmove>
+		cprintf("CPU %d cannot release %s: held by CPU %d\nAcquired at:", 
+			cpunum(), lk->name, lk->cpu - cpus);
+f01090d3:	8b 7e 08             	mov    0x8(%esi),%edi
+f01090d6:	81 ef 20 60 7d f0    	sub    $0xf07d6020,%edi
+		cprintf("CPU %d cannot release %s: held by CPU %d\nAcquired at:", 
+f01090dc:	c1 ff 03             	sar    $0x3,%edi
+f01090df:	69 ff ef ee ee ee    	imul   $0xeeeeeeef,%edi,%edi
+f01090e5:	8b 76 04             	mov    0x4(%esi),%esi
+f01090e8:	e8 4a fb ff ff       	call   f0108c37 <cpunum>
+f01090ed:	57                   	push   %edi
+f01090ee:	56                   	push   %esi
+f01090ef:	50                   	push   %eax
+f01090f0:	68 28 e2 10 f0       	push   $0xf010e228
+f01090f5:	e8 bb ba ff ff       	call   f0104bb5 <cprintf>
+		for (i = 0; i < 10 && pcs[i]; i++) {
+f01090fa:	8d 7d e8             	lea    -0x18(%ebp),%edi
+f01090fd:	83 c4 20             	add    $0x20,%esp
+			struct Eipdebuginfo info;
+			if (debuginfo_eip(pcs[i], &info) >= 0)
+f0109100:	8d 75 a8             	lea    -0x58(%ebp),%esi
+		for (i = 0; i < 10 && pcs[i]; i++) {
+f0109103:	eb 4a                	jmp    f010914f <spin_unlock+0x9f>
+	return lock->locked && lock->cpu == thiscpu;
+f0109105:	8b 5e 08             	mov    0x8(%esi),%ebx
+f0109108:	e8 2a fb ff ff       	call   f0108c37 <cpunum>
+f010910d:	6b c0 78             	imul   $0x78,%eax,%eax
+f0109110:	05 20 60 7d f0       	add    $0xf07d6020,%eax
+	if (!holding(lk)) {
+f0109115:	39 c3                	cmp    %eax,%ebx
+f0109117:	75 a8                	jne    f01090c1 <spin_unlock+0x11>
+				cprintf("  %08x\n", pcs[i]);
+		}
+		panic("spin_unlock");
+	}
+
+	lk->pcs[0] = 0;
+f0109119:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+	lk->cpu = 0;
+f0109120:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+	asm volatile("lock; xchgl %0, %1"
+f0109127:	b8 00 00 00 00       	mov    $0x0,%eax
+f010912c:	f0 87 06             	lock xchg %eax,(%esi)
+	// Paper says that Intel 64 and IA-32 will not move a load
+	// after a store. So lock->locked = 0 would work here.
+	// The xchg being asm volatile ensures gcc emits it after
+	// the above assignments (and after the critical section).
+	xchg(&lk->locked, 0);
+}
+f010912f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0109132:	5b                   	pop    %ebx
+f0109133:	5e                   	pop    %esi
+f0109134:	5f                   	pop    %edi
+f0109135:	5d                   	pop    %ebp
+f0109136:	c3                   	ret
+				cprintf("  %08x\n", pcs[i]);
+f0109137:	83 ec 08             	sub    $0x8,%esp
+f010913a:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f010913d:	ff 30                	push   (%eax)
+f010913f:	68 85 e2 10 f0       	push   $0xf010e285
+f0109144:	e8 6c ba ff ff       	call   f0104bb5 <cprintf>
+f0109149:	83 c4 10             	add    $0x10,%esp
+		for (i = 0; i < 10 && pcs[i]; i++) {
+f010914c:	83 c3 04             	add    $0x4,%ebx
+f010914f:	39 fb                	cmp    %edi,%ebx
+f0109151:	74 44                	je     f0109197 <spin_unlock+0xe7>
+f0109153:	89 5d a4             	mov    %ebx,-0x5c(%ebp)
+f0109156:	8b 03                	mov    (%ebx),%eax
+f0109158:	85 c0                	test   %eax,%eax
+f010915a:	74 3b                	je     f0109197 <spin_unlock+0xe7>
+			if (debuginfo_eip(pcs[i], &info) >= 0)
+f010915c:	83 ec 08             	sub    $0x8,%esp
+f010915f:	56                   	push   %esi
+f0109160:	50                   	push   %eax
+f0109161:	e8 9b e7 ff ff       	call   f0107901 <debuginfo_eip>
+f0109166:	83 c4 10             	add    $0x10,%esp
+f0109169:	85 c0                	test   %eax,%eax
+f010916b:	78 ca                	js     f0109137 <spin_unlock+0x87>
+					pcs[i] - info.eip_fn_addr);
+f010916d:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f0109170:	8b 00                	mov    (%eax),%eax
+				cprintf("  %08x %s:%d: %.*s+%x\n", pcs[i],
+f0109172:	83 ec 04             	sub    $0x4,%esp
+f0109175:	89 c2                	mov    %eax,%edx
+f0109177:	2b 55 b8             	sub    -0x48(%ebp),%edx
+f010917a:	52                   	push   %edx
+f010917b:	ff 75 b0             	push   -0x50(%ebp)
+f010917e:	ff 75 b4             	push   -0x4c(%ebp)
+f0109181:	ff 75 ac             	push   -0x54(%ebp)
+f0109184:	ff 75 a8             	push   -0x58(%ebp)
+f0109187:	50                   	push   %eax
+f0109188:	68 6e e2 10 f0       	push   $0xf010e26e
+f010918d:	e8 23 ba ff ff       	call   f0104bb5 <cprintf>
+f0109192:	83 c4 20             	add    $0x20,%esp
+f0109195:	eb b5                	jmp    f010914c <spin_unlock+0x9c>
+		panic("spin_unlock");
+f0109197:	83 ec 04             	sub    $0x4,%esp
+f010919a:	68 8d e2 10 f0       	push   $0xf010e28d
+f010919f:	6a 67                	push   $0x67
+f01091a1:	68 5e e2 10 f0       	push   $0xf010e25e
+f01091a6:	e8 98 6e ff ff       	call   f0100043 <_panic>
+
+f01091ab <vdso_init>:
+
+// Allocate the vdso page and map it at UVDSO, in the kernel's page
+// table for the UENVS slot, which every env shares.
+void
+vdso_init(void)
+{
+f01091ab:	55                   	push   %ebp
+f01091ac:	89 e5                	mov    %esp,%ebp
+f01091ae:	53                   	push   %ebx
+f01091af:	83 ec 10             	sub    $0x10,%esp
+	struct PageInfo *pp;
+
+	static_assert(VDSO_NCPU >= NCPU);
+	static_assert(NENV * sizeof(struct Env) <= UVDSO - UENVS);
+
+	if (!(pp = page_alloc(ALLOC_ZERO)))
+f01091b2:	6a 01                	push   $0x1
+f01091b4:	e8 2c 80 ff ff       	call   f01011e5 <page_alloc>
+f01091b9:	83 c4 10             	add    $0x10,%esp
+f01091bc:	85 c0                	test   %eax,%eax
+f01091be:	74 5a                	je     f010921a <vdso_init+0x6f>
+f01091c0:	89 c3                	mov    %eax,%ebx
+		panic("vdso_init: out of memory");
+	if (page_insert(kern_pgdir, pp, (void *) UVDSO, PTE_U) < 0)
+f01091c2:	6a 04                	push   $0x4
+f01091c4:	68 00 f0 ff ee       	push   $0xeefff000
+f01091c9:	50                   	push   %eax
+f01091ca:	ff 35 6c 47 79 f0    	push   0xf079476c
+f01091d0:	e8 75 88 ff ff       	call   f0101a4a <page_insert>
+f01091d5:	83 c4 10             	add    $0x10,%esp
+f01091d8:	85 c0                	test   %eax,%eax
+f01091da:	78 52                	js     f010922e <vdso_init+0x83>
+	return (pp - pages) << PGSHIFT;
+f01091dc:	2b 1d 68 47 79 f0    	sub    0xf0794768,%ebx
+f01091e2:	c1 fb 03             	sar    $0x3,%ebx
+f01091e5:	89 d8                	mov    %ebx,%eax
+f01091e7:	c1 e0 0c             	shl    $0xc,%eax
+	if (PGNUM(pa) >= npages)
+f01091ea:	8b 15 74 47 79 f0    	mov    0xf0794774,%edx
+f01091f0:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+f01091f6:	39 d3                	cmp    %edx,%ebx
+f01091f8:	73 48                	jae    f0109242 <vdso_init+0x97>
+	return (void *)(pa + KERNBASE);
+f01091fa:	2d 00 00 00 10       	sub    $0x10000000,%eax
+		panic("vdso_init: out of memory");
+	vdso = page2kva(pp);
+f01091ff:	a3 28 64 7d f0       	mov    %eax,0xf07d6428
+	vdso->vd_ns_per_tick = NANOSECONDS_PER_TICK;
+f0109204:	c7 40 0c 80 96 98 00 	movl   $0x989680,0xc(%eax)
+f010920b:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+	vdso->vd_totalpages = npages;
+f0109212:	89 50 24             	mov    %edx,0x24(%eax)
+}
+f0109215:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0109218:	c9                   	leave
+f0109219:	c3                   	ret
+		panic("vdso_init: out of memory");
+f010921a:	83 ec 04             	sub    $0x4,%esp
+f010921d:	68 a5 e2 10 f0       	push   $0xf010e2a5
+f0109222:	6a 22                	push   $0x22
+f0109224:	68 be e2 10 f0       	push   $0xf010e2be
+f0109229:	e8 15 6e ff ff       	call   f0100043 <_panic>
+		panic("vdso_init: out of memory");
+f010922e:	83 ec 04             	sub    $0x4,%esp
+f0109231:	68 a5 e2 10 f0       	push   $0xf010e2a5
+f0109236:	6a 24                	push   $0x24
+f0109238:	68 be e2 10 f0       	push   $0xf010e2be
+f010923d:	e8 01 6e ff ff       	call   f0100043 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0109242:	50                   	push   %eax
+f0109243:	68 90 be 10 f0       	push   $0xf010be90
+f0109248:	68 a4 00 00 00       	push   $0xa4
+f010924d:	68 95 ce 10 f0       	push   $0xf010ce95
+f0109252:	e8 ec 6d ff ff       	call   f0100043 <_panic>
+
+f0109257 <time_tick>:
+
+// This should be called once per timer interrupt.  A timer interrupt
+// fires every 10 ms.
+void
+time_tick(void)
+{
+f0109257:	55                   	push   %ebp
+f0109258:	89 e5                	mov    %esp,%ebp
+f010925a:	57                   	push   %edi
+f010925b:	56                   	push   %esi
+f010925c:	53                   	push   %ebx
+f010925d:	83 ec 2c             	sub    $0x2c,%esp
+	++ticks;
+f0109260:	a1 30 64 7d f0       	mov    0xf07d6430,%eax
+f0109265:	8b 15 34 64 7d f0    	mov    0xf07d6434,%edx
+f010926b:	83 c0 01             	add    $0x1,%eax
+f010926e:	83 d2 00             	adc    $0x0,%edx
+f0109271:	a3 30 64 7d f0       	mov    %eax,0xf07d6430
+f0109276:	89 15 34 64 7d f0    	mov    %edx,0xf07d6434
+	if (ticks > UINT64_MAX / NANOSECONDS_PER_TICK)
+f010927c:	b9 ca ab 29 7f       	mov    $0x7f29abca,%ecx
+f0109281:	39 c1                	cmp    %eax,%ecx
+f0109283:	b8 ad 01 00 00       	mov    $0x1ad,%eax
+f0109288:	19 d0                	sbb    %edx,%eax
+f010928a:	0f 82 ea 00 00 00    	jb     f010937a <time_tick+0x123>
+	asm volatile("rdtsc" : "=A" (tsc));
+f0109290:	0f 31                	rdtsc
+f0109292:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0109295:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+	vdso->vd_seq++;
+f0109298:	8b 15 28 64 7d f0    	mov    0xf07d6428,%edx
+f010929e:	8b 02                	mov    (%edx),%eax
+f01092a0:	83 c0 01             	add    $0x1,%eax
+f01092a3:	89 02                	mov    %eax,(%edx)
+	delta = tsc - vdso->vd_tick_tsc;
+f01092a5:	8b 3d 28 64 7d f0    	mov    0xf07d6428,%edi
+f01092ab:	8b 5f 14             	mov    0x14(%edi),%ebx
+f01092ae:	8b 77 18             	mov    0x18(%edi),%esi
+f01092b1:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f01092b4:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+f01092b7:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+f01092ba:	89 75 dc             	mov    %esi,-0x24(%ebp)
+f01092bd:	29 d8                	sub    %ebx,%eax
+f01092bf:	19 f2                	sbb    %esi,%edx
+f01092c1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f01092c4:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	if (vdso->vd_tsc_per_tick)
+f01092c7:	8b 5f 1c             	mov    0x1c(%edi),%ebx
+f01092ca:	8b 77 20             	mov    0x20(%edi),%esi
+f01092cd:	89 f1                	mov    %esi,%ecx
+f01092cf:	09 d9                	or     %ebx,%ecx
+f01092d1:	0f 84 b7 00 00 00    	je     f010938e <time_tick+0x137>
+	return delta / per_tick * NANOSECONDS_PER_TICK
+f01092d7:	56                   	push   %esi
+f01092d8:	53                   	push   %ebx
+f01092d9:	52                   	push   %edx
+f01092da:	50                   	push   %eax
+f01092db:	e8 d1 29 00 00       	call   f010bcb1 <__udivdi3>
+f01092e0:	83 c4 10             	add    $0x10,%esp
+f01092e3:	69 ca 80 96 98 00    	imul   $0x989680,%edx,%ecx
+f01092e9:	ba 80 96 98 00       	mov    $0x989680,%edx
+f01092ee:	f7 e2                	mul    %edx
+f01092f0:	01 ca                	add    %ecx,%edx
+		vdso->vd_uptime += tsc_to_ns(delta, vdso->vd_tsc_per_tick);
+f01092f2:	89 d1                	mov    %edx,%ecx
+f01092f4:	89 c2                	mov    %eax,%edx
+f01092f6:	03 57 04             	add    0x4(%edi),%edx
+f01092f9:	13 4f 08             	adc    0x8(%edi),%ecx
+f01092fc:	89 55 c8             	mov    %edx,-0x38(%ebp)
+f01092ff:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+		+ delta % per_tick * NANOSECONDS_PER_TICK / per_tick;
+f0109302:	56                   	push   %esi
+f0109303:	53                   	push   %ebx
+f0109304:	ff 75 e4             	push   -0x1c(%ebp)
+f0109307:	ff 75 e0             	push   -0x20(%ebp)
+f010930a:	e8 c0 29 00 00       	call   f010bccf <__umoddi3>
+f010930f:	83 c4 10             	add    $0x10,%esp
+f0109312:	69 ca 80 96 98 00    	imul   $0x989680,%edx,%ecx
+f0109318:	ba 80 96 98 00       	mov    $0x989680,%edx
+f010931d:	f7 e2                	mul    %edx
+f010931f:	01 ca                	add    %ecx,%edx
+f0109321:	56                   	push   %esi
+f0109322:	53                   	push   %ebx
+f0109323:	52                   	push   %edx
+f0109324:	50                   	push   %eax
+f0109325:	e8 87 29 00 00       	call   f010bcb1 <__udivdi3>
+f010932a:	83 c4 10             	add    $0x10,%esp
+		vdso->vd_uptime += tsc_to_ns(delta, vdso->vd_tsc_per_tick);
+f010932d:	03 45 c8             	add    -0x38(%ebp),%eax
+f0109330:	13 55 cc             	adc    -0x34(%ebp),%edx
+f0109333:	89 47 04             	mov    %eax,0x4(%edi)
+f0109336:	89 57 08             	mov    %edx,0x8(%edi)
+	else if (vdso->vd_tick_tsc && delta < 2 * vdso->vd_tsc_per_tick)
+f0109339:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f010933c:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f010933f:	89 d1                	mov    %edx,%ecx
+f0109341:	09 c1                	or     %eax,%ecx
+f0109343:	74 7e                	je     f01093c3 <time_tick+0x16c>
+f0109345:	89 d8                	mov    %ebx,%eax
+f0109347:	89 f2                	mov    %esi,%edx
+f0109349:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+f010934d:	01 c0                	add    %eax,%eax
+f010934f:	39 45 e0             	cmp    %eax,-0x20(%ebp)
+f0109352:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f0109355:	19 d1                	sbb    %edx,%ecx
+f0109357:	73 6a                	jae    f01093c3 <time_tick+0x16c>
+		vdso->vd_tsc_per_tick = (3 * vdso->vd_tsc_per_tick + delta) / 4;
+f0109359:	6b ce 03             	imul   $0x3,%esi,%ecx
+f010935c:	b8 03 00 00 00       	mov    $0x3,%eax
+f0109361:	f7 e3                	mul    %ebx
+f0109363:	01 ca                	add    %ecx,%edx
+f0109365:	03 45 e0             	add    -0x20(%ebp),%eax
+f0109368:	13 55 e4             	adc    -0x1c(%ebp),%edx
+f010936b:	0f ac d0 02          	shrd   $0x2,%edx,%eax
+f010936f:	c1 ea 02             	shr    $0x2,%edx
+f0109372:	89 47 1c             	mov    %eax,0x1c(%edi)
+f0109375:	89 57 20             	mov    %edx,0x20(%edi)
+f0109378:	eb 49                	jmp    f01093c3 <time_tick+0x16c>
+		panic("time_tick: time overflowed");
+f010937a:	83 ec 04             	sub    $0x4,%esp
+f010937d:	68 cd e2 10 f0       	push   $0xf010e2cd
+f0109382:	6a 63                	push   $0x63
+f0109384:	68 be e2 10 f0       	push   $0xf010e2be
+f0109389:	e8 b5 6c ff ff       	call   f0100043 <_panic>
+		vdso->vd_uptime = ticks * NANOSECONDS_PER_TICK;
+f010938e:	69 0d 34 64 7d f0 80 	imul   $0x989680,0xf07d6434,%ecx
+f0109395:	96 98 00 
+f0109398:	b8 80 96 98 00       	mov    $0x989680,%eax
+f010939d:	f7 25 30 64 7d f0    	mull   0xf07d6430
+f01093a3:	01 ca                	add    %ecx,%edx
+f01093a5:	89 47 04             	mov    %eax,0x4(%edi)
+f01093a8:	89 57 08             	mov    %edx,0x8(%edi)
+	if (vdso->vd_tick_tsc && !vdso->vd_tsc_per_tick)
+f01093ab:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f01093ae:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f01093b1:	89 d6                	mov    %edx,%esi
+f01093b3:	09 c6                	or     %eax,%esi
+f01093b5:	74 0c                	je     f01093c3 <time_tick+0x16c>
+		vdso->vd_tsc_per_tick = delta;
+f01093b7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01093ba:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f01093bd:	89 47 1c             	mov    %eax,0x1c(%edi)
+f01093c0:	89 57 20             	mov    %edx,0x20(%edi)
+	vdso->vd_tick_tsc = tsc;
+f01093c3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f01093c6:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+f01093c9:	89 47 14             	mov    %eax,0x14(%edi)
+f01093cc:	89 57 18             	mov    %edx,0x18(%edi)
+	vdso->vd_freepages = nfreepages;
+f01093cf:	a1 70 47 79 f0       	mov    0xf0794770,%eax
+f01093d4:	89 47 28             	mov    %eax,0x28(%edi)
+	vdso->vd_ncpu = ncpu;
+f01093d7:	8b 35 00 60 7d f0    	mov    0xf07d6000,%esi
+f01093dd:	89 77 2c             	mov    %esi,0x2c(%edi)
+	for (i = 0; i < ncpu; i++) {
+f01093e0:	b8 00 00 00 00       	mov    $0x0,%eax
+f01093e5:	eb 23                	jmp    f010940a <time_tick+0x1b3>
+			cpus[i].cpu_env ? cpus[i].cpu_env->env_id : 0;
+f01093e7:	8b 53 48             	mov    0x48(%ebx),%edx
+		vdso->vd_cpus[i].vc_envid =
+f01093ea:	89 54 cf 30          	mov    %edx,0x30(%edi,%ecx,8)
+		vdso->vd_cpus[i].vc_halted = cpus[i].cpu_status == CPU_HALTED;
+f01093ee:	6b d0 78             	imul   $0x78,%eax,%edx
+f01093f1:	81 c2 20 60 7d f0    	add    $0xf07d6020,%edx
+f01093f7:	8b 52 04             	mov    0x4(%edx),%edx
+f01093fa:	83 fa 02             	cmp    $0x2,%edx
+f01093fd:	0f 94 c2             	sete   %dl
+f0109400:	0f b6 d2             	movzbl %dl,%edx
+f0109403:	89 54 cf 34          	mov    %edx,0x34(%edi,%ecx,8)
+	for (i = 0; i < ncpu; i++) {
+f0109407:	83 c0 01             	add    $0x1,%eax
+f010940a:	39 c6                	cmp    %eax,%esi
+f010940c:	7e 16                	jle    f0109424 <time_tick+0x1cd>
+		vdso->vd_cpus[i].vc_envid =
+f010940e:	89 c1                	mov    %eax,%ecx
+			cpus[i].cpu_env ? cpus[i].cpu_env->env_id : 0;
+f0109410:	6b d0 78             	imul   $0x78,%eax,%edx
+f0109413:	8b 9a 28 60 7d f0    	mov    -0xf829fd8(%edx),%ebx
+f0109419:	ba 00 00 00 00       	mov    $0x0,%edx
+f010941e:	85 db                	test   %ebx,%ebx
+f0109420:	75 c5                	jne    f01093e7 <time_tick+0x190>
+f0109422:	eb c6                	jmp    f01093ea <time_tick+0x193>
+	vdso->vd_seq++;
+f0109424:	8b 15 28 64 7d f0    	mov    0xf07d6428,%edx
+f010942a:	8b 02                	mov    (%edx),%eax
+f010942c:	83 c0 01             	add    $0x1,%eax
+f010942f:	89 02                	mov    %eax,(%edx)
+	vdso_update();
+}
+f0109431:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0109434:	5b                   	pop    %ebx
+f0109435:	5e                   	pop    %esi
+f0109436:	5f                   	pop    %edi
+f0109437:	5d                   	pop    %ebp
+f0109438:	c3                   	ret
+
+f0109439 <time_uptime>:
+
+// Time since boot, to the last tick.
+nanoseconds_t
+time_uptime(void)
+{
+	return vdso->vd_uptime;
+f0109439:	a1 28 64 7d f0       	mov    0xf07d6428,%eax
+f010943e:	8b 50 08             	mov    0x8(%eax),%edx
+f0109441:	8b 40 04             	mov    0x4(%eax),%eax
+}
+f0109444:	c3                   	ret
+
+f0109445 <time_now>:
+// with interrupts off, so ticks only arrive while CPU 0 is idle and the
+// tick count falls behind on a busy machine; the TSC does not.  Until
+// CPU 0 has calibrated the TSC this is just time_uptime().
+nanoseconds_t
+time_now(void)
+{
+f0109445:	55                   	push   %ebp
+f0109446:	89 e5                	mov    %esp,%ebp
+f0109448:	57                   	push   %edi
+f0109449:	56                   	push   %esi
+f010944a:	53                   	push   %ebx
+f010944b:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t per_tick = vdso->vd_tsc_per_tick;
+f010944e:	8b 1d 28 64 7d f0    	mov    0xf07d6428,%ebx
+f0109454:	8b 73 1c             	mov    0x1c(%ebx),%esi
+f0109457:	8b 7b 20             	mov    0x20(%ebx),%edi
+
+	if (!per_tick)
+f010945a:	89 f8                	mov    %edi,%eax
+f010945c:	09 f0                	or     %esi,%eax
+f010945e:	74 72                	je     f01094d2 <time_now+0x8d>
+f0109460:	0f 31                	rdtsc
+		return time_uptime();
+	return vdso->vd_uptime + tsc_to_ns(read_tsc() - vdso->vd_tick_tsc,
+f0109462:	2b 43 14             	sub    0x14(%ebx),%eax
+f0109465:	1b 53 18             	sbb    0x18(%ebx),%edx
+	return delta / per_tick * NANOSECONDS_PER_TICK
+f0109468:	57                   	push   %edi
+f0109469:	56                   	push   %esi
+f010946a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f010946d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f0109470:	52                   	push   %edx
+f0109471:	50                   	push   %eax
+f0109472:	e8 3a 28 00 00       	call   f010bcb1 <__udivdi3>
+f0109477:	83 c4 10             	add    $0x10,%esp
+f010947a:	69 ca 80 96 98 00    	imul   $0x989680,%edx,%ecx
+f0109480:	ba 80 96 98 00       	mov    $0x989680,%edx
+f0109485:	f7 e2                	mul    %edx
+f0109487:	01 ca                	add    %ecx,%edx
+	return vdso->vd_uptime + tsc_to_ns(read_tsc() - vdso->vd_tick_tsc,
+f0109489:	89 d1                	mov    %edx,%ecx
+f010948b:	89 c2                	mov    %eax,%edx
+f010948d:	03 53 04             	add    0x4(%ebx),%edx
+f0109490:	13 4b 08             	adc    0x8(%ebx),%ecx
+f0109493:	89 55 d8             	mov    %edx,-0x28(%ebp)
+f0109496:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+		+ delta % per_tick * NANOSECONDS_PER_TICK / per_tick;
+f0109499:	57                   	push   %edi
+f010949a:	56                   	push   %esi
+f010949b:	ff 75 e4             	push   -0x1c(%ebp)
+f010949e:	ff 75 e0             	push   -0x20(%ebp)
+f01094a1:	e8 29 28 00 00       	call   f010bccf <__umoddi3>
+f01094a6:	83 c4 10             	add    $0x10,%esp
+f01094a9:	69 ca 80 96 98 00    	imul   $0x989680,%edx,%ecx
+f01094af:	bb 80 96 98 00       	mov    $0x989680,%ebx
+f01094b4:	f7 e3                	mul    %ebx
+f01094b6:	01 ca                	add    %ecx,%edx
+f01094b8:	57                   	push   %edi
+f01094b9:	56                   	push   %esi
+f01094ba:	52                   	push   %edx
+f01094bb:	50                   	push   %eax
+f01094bc:	e8 f0 27 00 00       	call   f010bcb1 <__udivdi3>
+f01094c1:	83 c4 10             	add    $0x10,%esp
+	return vdso->vd_uptime + tsc_to_ns(read_tsc() - vdso->vd_tick_tsc,
+f01094c4:	03 45 d8             	add    -0x28(%ebp),%eax
+f01094c7:	13 55 dc             	adc    -0x24(%ebp),%edx
+					   per_tick);
+}
+f01094ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01094cd:	5b                   	pop    %ebx
+f01094ce:	5e                   	pop    %esi
+f01094cf:	5f                   	pop    %edi
+f01094d0:	5d                   	pop    %ebp
+f01094d1:	c3                   	ret
+	return vdso->vd_uptime;
+f01094d2:	8b 43 04             	mov    0x4(%ebx),%eax
+f01094d5:	8b 53 08             	mov    0x8(%ebx),%edx
+		return time_uptime();
+f01094d8:	eb f0                	jmp    f01094ca <time_now+0x85>
+
+f01094da <sysinfo>:
+
+int
+sysinfo(struct sysinfo *info)
+{
+f01094da:	55                   	push   %ebp
+f01094db:	89 e5                	mov    %esp,%ebp
+f01094dd:	53                   	push   %ebx
+f01094de:	83 ec 24             	sub    $0x24,%esp
+f01094e1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct ksm_stats ksm;
+	struct elfcache_stats ec;
+
+	info->uptime = time_now();
+f01094e4:	e8 5c ff ff ff       	call   f0109445 <time_now>
+f01094e9:	89 03                	mov    %eax,(%ebx)
+f01094eb:	89 53 04             	mov    %edx,0x4(%ebx)
+	info->totalpages = npages;
+f01094ee:	a1 74 47 79 f0       	mov    0xf0794774,%eax
+f01094f3:	89 43 08             	mov    %eax,0x8(%ebx)
+	info->freepages = nfreepages;
+f01094f6:	a1 70 47 79 f0       	mov    0xf0794770,%eax
+f01094fb:	89 43 0c             	mov    %eax,0xc(%ebx)
+	info->inblocks = inblocks;
+f01094fe:	a1 20 64 7d f0       	mov    0xf07d6420,%eax
+f0109503:	8b 15 24 64 7d f0    	mov    0xf07d6424,%edx
+f0109509:	89 43 10             	mov    %eax,0x10(%ebx)
+f010950c:	89 53 14             	mov    %edx,0x14(%ebx)
+	info->outblocks = outblocks;
+f010950f:	a1 18 64 7d f0       	mov    0xf07d6418,%eax
+f0109514:	8b 15 1c 64 7d f0    	mov    0xf07d641c,%edx
+f010951a:	89 43 18             	mov    %eax,0x18(%ebx)
+f010951d:	89 53 1c             	mov    %edx,0x1c(%ebx)
+	info->inpackets = inpackets;
+f0109520:	a1 10 64 7d f0       	mov    0xf07d6410,%eax
+f0109525:	8b 15 14 64 7d f0    	mov    0xf07d6414,%edx
+f010952b:	89 43 20             	mov    %eax,0x20(%ebx)
+f010952e:	89 53 24             	mov    %edx,0x24(%ebx)
+	info->outpackets = outpackets;
+f0109531:	a1 08 64 7d f0       	mov    0xf07d6408,%eax
+f0109536:	8b 15 0c 64 7d f0    	mov    0xf07d640c,%edx
+f010953c:	89 43 28             	mov    %eax,0x28(%ebx)
+f010953f:	89 53 2c             	mov    %edx,0x2c(%ebx)
+	info->kfaults = kfaults;
+f0109542:	a1 00 64 7d f0       	mov    0xf07d6400,%eax
+f0109547:	8b 15 04 64 7d f0    	mov    0xf07d6404,%edx
+f010954d:	89 43 30             	mov    %eax,0x30(%ebx)
+f0109550:	89 53 34             	mov    %edx,0x34(%ebx)
+	info->kfault_cycles = kfault_cycles;
+f0109553:	a1 f8 63 7d f0       	mov    0xf07d63f8,%eax
+f0109558:	8b 15 fc 63 7d f0    	mov    0xf07d63fc,%edx
+f010955e:	89 43 38             	mov    %eax,0x38(%ebx)
+f0109561:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	info->upcalls = upcalls;
+f0109564:	a1 f0 63 7d f0       	mov    0xf07d63f0,%eax
+f0109569:	8b 15 f4 63 7d f0    	mov    0xf07d63f4,%edx
+f010956f:	89 43 40             	mov    %eax,0x40(%ebx)
+f0109572:	89 53 44             	mov    %edx,0x44(%ebx)
+	ksm_get_stats(&ksm);
+f0109575:	83 ec 0c             	sub    $0xc,%esp
+f0109578:	8d 45 e8             	lea    -0x18(%ebp),%eax
+f010957b:	50                   	push   %eax
+f010957c:	e8 06 06 00 00       	call   f0109b87 <ksm_get_stats>
+	info->ksm_merges = ksm.merges;
+f0109581:	8b 45 e8             	mov    -0x18(%ebp),%eax
+f0109584:	89 43 48             	mov    %eax,0x48(%ebx)
+	info->ksm_unmerges = ksm.unmerges;
+f0109587:	8b 45 ec             	mov    -0x14(%ebp),%eax
+f010958a:	89 43 4c             	mov    %eax,0x4c(%ebx)
+	info->ksm_shared = ksm.shared;
+f010958d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+f0109590:	89 43 50             	mov    %eax,0x50(%ebx)
+	info->ksm_saved = ksm.saved;
+f0109593:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f0109596:	89 43 54             	mov    %eax,0x54(%ebx)
+	elfcache_get_stats(&ec);
+f0109599:	8d 45 dc             	lea    -0x24(%ebp),%eax
+f010959c:	89 04 24             	mov    %eax,(%esp)
+f010959f:	e8 14 0a 00 00       	call   f0109fb8 <elfcache_get_stats>
+	info->elfcache_images = ec.images;
+f01095a4:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f01095a7:	89 43 58             	mov    %eax,0x58(%ebx)
+	info->elfcache_pages = ec.pages;
+f01095aa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01095ad:	89 43 5c             	mov    %eax,0x5c(%ebx)
+	info->elfcache_saved = ec.saved;
+f01095b0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01095b3:	89 43 60             	mov    %eax,0x60(%ebx)
+	return 0;
+}
+f01095b6:	b8 00 00 00 00       	mov    $0x0,%eax
+f01095bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01095be:	c9                   	leave
+f01095bf:	c3                   	ret
+
+f01095c0 <ksm_merge>:
+}
+
+// Point the mapping behind 'pte' at the merged page 'kp'.
+static void
+ksm_merge(pte_t *pte, struct PageInfo *kp)
+{
+f01095c0:	55                   	push   %ebp
+f01095c1:	89 e5                	mov    %esp,%ebp
+f01095c3:	56                   	push   %esi
+f01095c4:	53                   	push   %ebx
+	if (PGNUM(pa) >= npages)
+f01095c5:	8b 08                	mov    (%eax),%ecx
+f01095c7:	c1 e9 0c             	shr    $0xc,%ecx
+f01095ca:	3b 0d 74 47 79 f0    	cmp    0xf0794774,%ecx
+f01095d0:	73 46                	jae    f0109618 <ksm_merge+0x58>
+	return &pages[PGNUM(pa)];
+f01095d2:	8b 1d 68 47 79 f0    	mov    0xf0794768,%ebx
+	struct PageInfo *pp = pa2page(PTE_ADDR(*pte));
+
+	kp->pp_ref++;
+f01095d8:	66 83 42 04 01       	addw   $0x1,0x4(%edx)
+	ksm_saved++;
+f01095dd:	83 05 48 64 7d f0 01 	addl   $0x1,0xf07d6448
+	return (pp - pages) << PGSHIFT;
+f01095e4:	29 da                	sub    %ebx,%edx
+f01095e6:	c1 fa 03             	sar    $0x3,%edx
+f01095e9:	c1 e2 0c             	shl    $0xc,%edx
+	*pte = page2pa(kp) | (*pte & PTE_SYSCALL & ~PTE_W) | PTE_COW;
+f01095ec:	8b 30                	mov    (%eax),%esi
+f01095ee:	81 e6 05 0e 00 00    	and    $0xe05,%esi
+f01095f4:	09 f2                	or     %esi,%edx
+f01095f6:	80 ce 08             	or     $0x8,%dh
+f01095f9:	89 10                	mov    %edx,(%eax)
+	page_decref(pp);
+f01095fb:	83 ec 0c             	sub    $0xc,%esp
+	return &pages[PGNUM(pa)];
+f01095fe:	8d 04 cb             	lea    (%ebx,%ecx,8),%eax
+f0109601:	50                   	push   %eax
+f0109602:	e8 b5 7c ff ff       	call   f01012bc <page_decref>
+	ksm_merges++;
+f0109607:	83 05 54 64 7d f0 01 	addl   $0x1,0xf07d6454
+}
+f010960e:	83 c4 10             	add    $0x10,%esp
+f0109611:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0109614:	5b                   	pop    %ebx
+f0109615:	5e                   	pop    %esi
+f0109616:	5d                   	pop    %ebp
+f0109617:	c3                   	ret
+		panic("pa2page called with invalid pa");
+f0109618:	83 ec 04             	sub    $0x4,%esp
+f010961b:	68 68 c6 10 f0       	push   $0xf010c668
+f0109620:	68 9d 00 00 00       	push   $0x9d
+f0109625:	68 95 ce 10 f0       	push   $0xf010ce95
+f010962a:	e8 14 6a ff ff       	call   f0100043 <_panic>
+
+f010962f <ksm_scan>:
+// Hashing pages holds up every other CPU waiting for the lock, so
+// however many CPUs go idle, only one batch runs per KSM_SCAN_PERIOD.
+//
+void
+ksm_scan(int npages)
+{
+f010962f:	55                   	push   %ebp
+f0109630:	89 e5                	mov    %esp,%ebp
+f0109632:	57                   	push   %edi
+f0109633:	56                   	push   %esi
+f0109634:	53                   	push   %ebx
+f0109635:	83 ec 3c             	sub    $0x3c,%esp
+	static nanoseconds_t next_scan;
+	nanoseconds_t now = time_now();
+f0109638:	e8 08 fe ff ff       	call   f0109445 <time_now>
+	struct Env *e;
+	pte_t *pte;
+	int nswitch = 0;
+
+	if (now < next_scan)
+f010963d:	3b 05 40 64 7d f0    	cmp    0xf07d6440,%eax
+f0109643:	89 d7                	mov    %edx,%edi
+f0109645:	1b 3d 44 64 7d f0    	sbb    0xf07d6444,%edi
+f010964b:	0f 82 50 04 00 00    	jb     f0109aa1 <ksm_scan+0x472>
+		return;
+	next_scan = now + KSM_SCAN_PERIOD;
+f0109651:	05 00 2d 31 01       	add    $0x1312d00,%eax
+f0109656:	83 d2 00             	adc    $0x0,%edx
+f0109659:	a3 40 64 7d f0       	mov    %eax,0xf07d6440
+f010965e:	89 15 44 64 7d f0    	mov    %edx,0xf07d6444
+	int nswitch = 0;
+f0109664:	bf 00 00 00 00       	mov    $0x0,%edi
+
+	while (npages > 0 && nswitch <= NENV) {
+f0109669:	eb 23                	jmp    f010968e <ksm_scan+0x5f>
+		e = &envs[ksm_envx];
+		if (ksm_va >= UTOP || !ksm_scannable(e)) {
+			ksm_envx = (ksm_envx + 1) % NENV;
+f010966b:	83 c0 01             	add    $0x1,%eax
+f010966e:	99                   	cltd
+f010966f:	c1 ea 16             	shr    $0x16,%edx
+f0109672:	01 d0                	add    %edx,%eax
+f0109674:	25 ff 03 00 00       	and    $0x3ff,%eax
+f0109679:	29 d0                	sub    %edx,%eax
+f010967b:	a3 5c 64 7d f0       	mov    %eax,0xf07d645c
+			ksm_va = 0;
+			nswitch++;
+f0109680:	83 c7 01             	add    $0x1,%edi
+			continue;
+f0109683:	ba 00 00 00 00       	mov    $0x0,%edx
+		}
+		// Skip missing page tables, and tables still shared after
+		// fork: their entries belong to more than one env.
+		if ((e->env_pgdir[PDX(ksm_va)] & (PTE_P | PTE_COW)) != PTE_P) {
+			ksm_va = ROUNDDOWN(ksm_va, PTSIZE) + PTSIZE;
+f0109688:	89 15 58 64 7d f0    	mov    %edx,0xf07d6458
+	while (npages > 0 && nswitch <= NENV) {
+f010968e:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+f0109692:	0f 8e 09 04 00 00    	jle    f0109aa1 <ksm_scan+0x472>
+f0109698:	81 ff 00 04 00 00    	cmp    $0x400,%edi
+f010969e:	0f 8f fd 03 00 00    	jg     f0109aa1 <ksm_scan+0x472>
+		e = &envs[ksm_envx];
+f01096a4:	8b 35 84 47 79 f0    	mov    0xf0794784,%esi
+f01096aa:	a1 5c 64 7d f0       	mov    0xf07d645c,%eax
+		if (ksm_va >= UTOP || !ksm_scannable(e)) {
+f01096af:	8b 15 58 64 7d f0    	mov    0xf07d6458,%edx
+f01096b5:	81 fa ff ff bf ee    	cmp    $0xeebfffff,%edx
+f01096bb:	77 ae                	ja     f010966b <ksm_scan+0x3c>
+		e = &envs[ksm_envx];
+f01096bd:	69 c8 68 01 00 00    	imul   $0x168,%eax,%ecx
+f01096c3:	01 ce                	add    %ecx,%esi
+		|| e->env_status == ENV_NOT_RUNNABLE) && e->env_pgdir;
+f01096c5:	8b 4e 54             	mov    0x54(%esi),%ecx
+f01096c8:	83 e9 02             	sub    $0x2,%ecx
+f01096cb:	f7 c1 fd ff ff ff    	test   $0xfffffffd,%ecx
+f01096d1:	75 98                	jne    f010966b <ksm_scan+0x3c>
+f01096d3:	8b 4e 60             	mov    0x60(%esi),%ecx
+		if (ksm_va >= UTOP || !ksm_scannable(e)) {
+f01096d6:	85 c9                	test   %ecx,%ecx
+f01096d8:	74 91                	je     f010966b <ksm_scan+0x3c>
+		if ((e->env_pgdir[PDX(ksm_va)] & (PTE_P | PTE_COW)) != PTE_P) {
+f01096da:	89 d0                	mov    %edx,%eax
+f01096dc:	c1 e8 16             	shr    $0x16,%eax
+f01096df:	8b 04 81             	mov    (%ecx,%eax,4),%eax
+f01096e2:	25 01 08 00 00       	and    $0x801,%eax
+f01096e7:	83 f8 01             	cmp    $0x1,%eax
+f01096ea:	74 0e                	je     f01096fa <ksm_scan+0xcb>
+			ksm_va = ROUNDDOWN(ksm_va, PTSIZE) + PTSIZE;
+f01096ec:	81 e2 00 00 c0 ff    	and    $0xffc00000,%edx
+f01096f2:	81 c2 00 00 40 00    	add    $0x400000,%edx
+			continue;
+f01096f8:	eb 8e                	jmp    f0109688 <ksm_scan+0x59>
+		}
+		pte = pgdir_walk(e->env_pgdir, (void *) ksm_va, 0);
+f01096fa:	83 ec 04             	sub    $0x4,%esp
+f01096fd:	6a 00                	push   $0x0
+f01096ff:	52                   	push   %edx
+f0109700:	51                   	push   %ecx
+f0109701:	e8 3d 80 ff ff       	call   f0101743 <pgdir_walk>
+f0109706:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+		if (*pte & PTE_P) {
+f0109709:	8b 00                	mov    (%eax),%eax
+f010970b:	83 c4 10             	add    $0x10,%esp
+f010970e:	a8 01                	test   $0x1,%al
+f0109710:	75 10                	jne    f0109722 <ksm_scan+0xf3>
+			ksm_scan_page(e, ksm_va, pte);
+			npages--;
+		}
+		ksm_va += PGSIZE;
+f0109712:	a1 58 64 7d f0       	mov    0xf07d6458,%eax
+f0109717:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+f010971d:	e9 66 ff ff ff       	jmp    f0109688 <ksm_scan+0x59>
+			ksm_scan_page(e, ksm_va, pte);
+f0109722:	8b 0d 58 64 7d f0    	mov    0xf07d6458,%ecx
+f0109728:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+	if (PGNUM(pa) >= npages)
+f010972b:	89 c2                	mov    %eax,%edx
+f010972d:	c1 ea 0c             	shr    $0xc,%edx
+f0109730:	8b 0d 74 47 79 f0    	mov    0xf0794774,%ecx
+f0109736:	39 ca                	cmp    %ecx,%edx
+f0109738:	73 1c                	jae    f0109756 <ksm_scan+0x127>
+	return &pages[PGNUM(pa)];
+f010973a:	8b 1d 68 47 79 f0    	mov    0xf0794768,%ebx
+f0109740:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+	return (pte & (PTE_P | PTE_U | PTE_SHARE)) == (PTE_P | PTE_U)
+f0109743:	89 c3                	mov    %eax,%ebx
+f0109745:	81 e3 05 04 00 00    	and    $0x405,%ebx
+		&& pp->pp_ref == 1;
+f010974b:	83 fb 05             	cmp    $0x5,%ebx
+f010974e:	74 1d                	je     f010976d <ksm_scan+0x13e>
+			npages--;
+f0109750:	83 6d 08 01          	subl   $0x1,0x8(%ebp)
+f0109754:	eb bc                	jmp    f0109712 <ksm_scan+0xe3>
+		panic("pa2page called with invalid pa");
+f0109756:	83 ec 04             	sub    $0x4,%esp
+f0109759:	68 68 c6 10 f0       	push   $0xf010c668
+f010975e:	68 9d 00 00 00       	push   $0x9d
+f0109763:	68 95 ce 10 f0       	push   $0xf010ce95
+f0109768:	e8 d6 68 ff ff       	call   f0100043 <_panic>
+		&& (pte & (PTE_W | PTE_COW))
+f010976d:	a9 02 08 00 00       	test   $0x802,%eax
+f0109772:	74 dc                	je     f0109750 <ksm_scan+0x121>
+	return &pages[PGNUM(pa)];
+f0109774:	c1 e2 03             	shl    $0x3,%edx
+f0109777:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+f010977a:	01 d3                	add    %edx,%ebx
+f010977c:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+		&& !(pp->pp_flags & PP_KSM)
+f010977f:	f6 43 06 01          	testb  $0x1,0x6(%ebx)
+f0109783:	75 cb                	jne    f0109750 <ksm_scan+0x121>
+	if (!ksm_mergeable(*pte, pp))
+f0109785:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f010978a:	75 c4                	jne    f0109750 <ksm_scan+0x121>
+	if (*pte & PTE_D) {
+f010978c:	a8 40                	test   $0x40,%al
+f010978e:	74 0a                	je     f010979a <ksm_scan+0x16b>
+		*pte &= ~PTE_D;
+f0109790:	83 e0 bf             	and    $0xffffffbf,%eax
+f0109793:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+f0109796:	89 06                	mov    %eax,(%esi)
+		return;
+f0109798:	eb b6                	jmp    f0109750 <ksm_scan+0x121>
+	return (pp - pages) << PGSHIFT;
+f010979a:	89 d0                	mov    %edx,%eax
+f010979c:	c1 e0 09             	shl    $0x9,%eax
+	if (PGNUM(pa) >= npages)
+f010979f:	c1 ea 03             	shr    $0x3,%edx
+f01097a2:	39 ca                	cmp    %ecx,%edx
+f01097a4:	73 18                	jae    f01097be <ksm_scan+0x18f>
+	return (void *)(pa + KERNBASE);
+f01097a6:	8d 98 00 00 00 f0    	lea    -0x10000000(%eax),%ebx
+f01097ac:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+ksm_hash(const uint32_t *p)
+f01097af:	8d 90 00 10 00 f0    	lea    -0xffff000(%eax),%edx
+f01097b5:	89 d8                	mov    %ebx,%eax
+	uint32_t h = 2166136261U;
+f01097b7:	bb c5 9d 1c 81       	mov    $0x811c9dc5,%ebx
+f01097bc:	eb 20                	jmp    f01097de <ksm_scan+0x1af>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01097be:	50                   	push   %eax
+f01097bf:	68 90 be 10 f0       	push   $0xf010be90
+f01097c4:	68 a4 00 00 00       	push   $0xa4
+f01097c9:	68 95 ce 10 f0       	push   $0xf010ce95
+f01097ce:	e8 70 68 ff ff       	call   f0100043 <_panic>
+		h = (h ^ p[i]) * 16777619U;
+f01097d3:	33 18                	xor    (%eax),%ebx
+f01097d5:	69 db 93 01 00 01    	imul   $0x1000193,%ebx,%ebx
+	for (i = 0; i < PGSIZE / 4; i++)
+f01097db:	83 c0 04             	add    $0x4,%eax
+f01097de:	39 d0                	cmp    %edx,%eax
+f01097e0:	75 f1                	jne    f01097d3 <ksm_scan+0x1a4>
+	slot = &ksm_table[hash % KSM_NSLOTS];
+f01097e2:	89 d8                	mov    %ebx,%eax
+f01097e4:	25 ff 03 00 00       	and    $0x3ff,%eax
+f01097e9:	89 45 c8             	mov    %eax,-0x38(%ebp)
+	if (slot->ks_hash == hash && slot->ks_page
+f01097ec:	c1 e0 04             	shl    $0x4,%eax
+f01097ef:	39 98 60 64 7d f0    	cmp    %ebx,-0xf829ba0(%eax)
+f01097f5:	74 47                	je     f010983e <ksm_scan+0x20f>
+	if (slot->ks_page && (slot->ks_page->pp_flags & PP_KSM))
+f01097f7:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f01097fa:	c1 e0 04             	shl    $0x4,%eax
+f01097fd:	8b 80 64 64 7d f0    	mov    -0xf829b9c(%eax),%eax
+f0109803:	85 c0                	test   %eax,%eax
+f0109805:	74 0a                	je     f0109811 <ksm_scan+0x1e2>
+f0109807:	f6 40 06 01          	testb  $0x1,0x6(%eax)
+f010980b:	0f 85 3f ff ff ff    	jne    f0109750 <ksm_scan+0x121>
+	slot->ks_hash = hash;
+f0109811:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f0109814:	c1 e0 04             	shl    $0x4,%eax
+f0109817:	8d 90 60 64 7d f0    	lea    -0xf829ba0(%eax),%edx
+f010981d:	89 98 60 64 7d f0    	mov    %ebx,-0xf829ba0(%eax)
+	slot->ks_page = NULL;
+f0109823:	c7 80 64 64 7d f0 00 	movl   $0x0,-0xf829b9c(%eax)
+f010982a:	00 00 00 
+	slot->ks_envid = e->env_id;
+f010982d:	8b 46 48             	mov    0x48(%esi),%eax
+f0109830:	89 42 08             	mov    %eax,0x8(%edx)
+	slot->ks_va = va;
+f0109833:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0109836:	89 42 0c             	mov    %eax,0xc(%edx)
+f0109839:	e9 12 ff ff ff       	jmp    f0109750 <ksm_scan+0x121>
+	if (slot->ks_hash == hash && slot->ks_page
+f010983e:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f0109841:	c1 e0 04             	shl    $0x4,%eax
+f0109844:	8b 80 64 64 7d f0    	mov    -0xf829b9c(%eax),%eax
+f010984a:	89 45 bc             	mov    %eax,-0x44(%ebp)
+f010984d:	85 c0                	test   %eax,%eax
+f010984f:	74 0a                	je     f010985b <ksm_scan+0x22c>
+	    && (slot->ks_page->pp_flags & PP_KSM)) {
+f0109851:	f6 40 06 01          	testb  $0x1,0x6(%eax)
+f0109855:	0f 85 9a 01 00 00    	jne    f01099f5 <ksm_scan+0x3c6>
+	if (!slot->ks_envid || envid2env(slot->ks_envid, &e, 0) < 0
+f010985b:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f010985e:	c1 e0 04             	shl    $0x4,%eax
+f0109861:	8b 80 68 64 7d f0    	mov    -0xf829b98(%eax),%eax
+f0109867:	85 c0                	test   %eax,%eax
+f0109869:	74 8c                	je     f01097f7 <ksm_scan+0x1c8>
+f010986b:	83 ec 04             	sub    $0x4,%esp
+f010986e:	6a 00                	push   $0x0
+f0109870:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+f0109873:	52                   	push   %edx
+f0109874:	50                   	push   %eax
+f0109875:	e8 81 a4 ff ff       	call   f0103cfb <envid2env>
+f010987a:	83 c4 10             	add    $0x10,%esp
+f010987d:	85 c0                	test   %eax,%eax
+f010987f:	0f 88 72 ff ff ff    	js     f01097f7 <ksm_scan+0x1c8>
+	    || !ksm_scannable(e) || (e->env_pgdir[PDX(slot->ks_va)] & PTE_COW))
+f0109885:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+		|| e->env_status == ENV_NOT_RUNNABLE) && e->env_pgdir;
+f0109888:	8b 4a 54             	mov    0x54(%edx),%ecx
+f010988b:	8d 41 fe             	lea    -0x2(%ecx),%eax
+f010988e:	a9 fd ff ff ff       	test   $0xfffffffd,%eax
+f0109893:	0f 85 5e ff ff ff    	jne    f01097f7 <ksm_scan+0x1c8>
+f0109899:	8b 42 60             	mov    0x60(%edx),%eax
+	    || !ksm_scannable(e) || (e->env_pgdir[PDX(slot->ks_va)] & PTE_COW))
+f010989c:	85 c0                	test   %eax,%eax
+f010989e:	0f 84 53 ff ff ff    	je     f01097f7 <ksm_scan+0x1c8>
+f01098a4:	8b 55 c8             	mov    -0x38(%ebp),%edx
+f01098a7:	c1 e2 04             	shl    $0x4,%edx
+f01098aa:	8b 92 6c 64 7d f0    	mov    -0xf829b94(%edx),%edx
+f01098b0:	89 d1                	mov    %edx,%ecx
+f01098b2:	c1 e9 16             	shr    $0x16,%ecx
+f01098b5:	f6 44 88 01 08       	testb  $0x8,0x1(%eax,%ecx,4)
+f01098ba:	0f 85 37 ff ff ff    	jne    f01097f7 <ksm_scan+0x1c8>
+	pp = page_lookup(e->env_pgdir, (void *) slot->ks_va, pte_store);
+f01098c0:	83 ec 04             	sub    $0x4,%esp
+f01098c3:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+f01098c6:	51                   	push   %ecx
+f01098c7:	52                   	push   %edx
+f01098c8:	50                   	push   %eax
+f01098c9:	e8 bc 7f ff ff       	call   f010188a <page_lookup>
+f01098ce:	89 45 cc             	mov    %eax,-0x34(%ebp)
+	if (!pp || !ksm_mergeable(**pte_store, pp))
+f01098d1:	83 c4 10             	add    $0x10,%esp
+f01098d4:	85 c0                	test   %eax,%eax
+f01098d6:	0f 84 1b ff ff ff    	je     f01097f7 <ksm_scan+0x1c8>
+f01098dc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01098df:	8b 00                	mov    (%eax),%eax
+	return (pte & (PTE_P | PTE_U | PTE_SHARE)) == (PTE_P | PTE_U)
+f01098e1:	89 c2                	mov    %eax,%edx
+f01098e3:	81 e2 05 04 00 00    	and    $0x405,%edx
+		&& pp->pp_ref == 1;
+f01098e9:	83 fa 05             	cmp    $0x5,%edx
+f01098ec:	0f 85 05 ff ff ff    	jne    f01097f7 <ksm_scan+0x1c8>
+		&& (pte & (PTE_W | PTE_COW))
+f01098f2:	a9 02 08 00 00       	test   $0x802,%eax
+f01098f7:	0f 84 fa fe ff ff    	je     f01097f7 <ksm_scan+0x1c8>
+		&& !(pp->pp_flags & PP_KSM)
+f01098fd:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f0109900:	f6 40 06 01          	testb  $0x1,0x6(%eax)
+f0109904:	0f 85 ed fe ff ff    	jne    f01097f7 <ksm_scan+0x1c8>
+	if (!pp || !ksm_mergeable(**pte_store, pp))
+f010990a:	66 83 78 04 01       	cmpw   $0x1,0x4(%eax)
+f010990f:	0f 85 e2 fe ff ff    	jne    f01097f7 <ksm_scan+0x1c8>
+	    && kp != pp && memcmp(page2kva(kp), page2kva(pp), PGSIZE) == 0
+f0109915:	8b 55 c0             	mov    -0x40(%ebp),%edx
+f0109918:	39 c2                	cmp    %eax,%edx
+f010991a:	0f 84 d7 fe ff ff    	je     f01097f7 <ksm_scan+0x1c8>
+	return (pp - pages) << PGSHIFT;
+f0109920:	8b 0d 68 47 79 f0    	mov    0xf0794768,%ecx
+f0109926:	89 d0                	mov    %edx,%eax
+f0109928:	29 c8                	sub    %ecx,%eax
+f010992a:	c1 f8 03             	sar    $0x3,%eax
+f010992d:	89 c2                	mov    %eax,%edx
+f010992f:	c1 e2 0c             	shl    $0xc,%edx
+f0109932:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+	if (PGNUM(pa) >= npages)
+f0109935:	8b 15 74 47 79 f0    	mov    0xf0794774,%edx
+f010993b:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0109940:	39 d0                	cmp    %edx,%eax
+f0109942:	0f 83 2d 01 00 00    	jae    f0109a75 <ksm_scan+0x446>
+	return (void *)(pa + KERNBASE);
+f0109948:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f010994b:	2d 00 00 00 10       	sub    $0x10000000,%eax
+f0109950:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+	return (pp - pages) << PGSHIFT;
+f0109953:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f0109956:	29 c8                	sub    %ecx,%eax
+f0109958:	c1 f8 03             	sar    $0x3,%eax
+f010995b:	89 c1                	mov    %eax,%ecx
+f010995d:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f0109960:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0109965:	39 d0                	cmp    %edx,%eax
+f0109967:	0f 83 1f 01 00 00    	jae    f0109a8c <ksm_scan+0x45d>
+f010996d:	83 ec 04             	sub    $0x4,%esp
+f0109970:	68 00 10 00 00       	push   $0x1000
+f0109975:	ff 75 c4             	push   -0x3c(%ebp)
+	return (void *)(pa + KERNBASE);
+f0109978:	81 e9 00 00 00 10    	sub    $0x10000000,%ecx
+f010997e:	51                   	push   %ecx
+f010997f:	e8 64 ec ff ff       	call   f01085e8 <memcmp>
+f0109984:	83 c4 10             	add    $0x10,%esp
+f0109987:	85 c0                	test   %eax,%eax
+f0109989:	0f 85 68 fe ff ff    	jne    f01097f7 <ksm_scan+0x1c8>
+	    && !futex_page_busy(page2pa(pp))) {
+f010998f:	83 ec 0c             	sub    $0xc,%esp
+	return (pp - pages) << PGSHIFT;
+f0109992:	8b 45 c0             	mov    -0x40(%ebp),%eax
+f0109995:	2b 05 68 47 79 f0    	sub    0xf0794768,%eax
+f010999b:	c1 f8 03             	sar    $0x3,%eax
+f010999e:	c1 e0 0c             	shl    $0xc,%eax
+f01099a1:	50                   	push   %eax
+f01099a2:	e8 4c 18 00 00       	call   f010b1f3 <futex_page_busy>
+f01099a7:	83 c4 10             	add    $0x10,%esp
+f01099aa:	84 c0                	test   %al,%al
+f01099ac:	0f 85 45 fe ff ff    	jne    f01097f7 <ksm_scan+0x1c8>
+		*kpte = (*kpte & ~PTE_W) | PTE_COW;
+f01099b2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f01099b5:	8b 02                	mov    (%edx),%eax
+f01099b7:	25 fd f7 ff ff       	and    $0xfffff7fd,%eax
+f01099bc:	80 cc 08             	or     $0x8,%ah
+f01099bf:	89 02                	mov    %eax,(%edx)
+		kp->pp_flags |= PP_KSM;
+f01099c1:	8b 75 cc             	mov    -0x34(%ebp),%esi
+f01099c4:	66 83 4e 06 01       	orw    $0x1,0x6(%esi)
+		ksm_shared++;
+f01099c9:	83 05 4c 64 7d f0 01 	addl   $0x1,0xf07d644c
+		slot->ks_page = kp;
+f01099d0:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f01099d3:	c1 e0 04             	shl    $0x4,%eax
+f01099d6:	89 b0 64 64 7d f0    	mov    %esi,-0xf829b9c(%eax)
+		slot->ks_envid = 0;
+f01099dc:	c7 80 68 64 7d f0 00 	movl   $0x0,-0xf829b98(%eax)
+f01099e3:	00 00 00 
+		ksm_merge(pte, kp);
+f01099e6:	89 f2                	mov    %esi,%edx
+f01099e8:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f01099eb:	e8 d0 fb ff ff       	call   f01095c0 <ksm_merge>
+		return;
+f01099f0:	e9 5b fd ff ff       	jmp    f0109750 <ksm_scan+0x121>
+f01099f5:	8b 75 cc             	mov    -0x34(%ebp),%esi
+f01099f8:	29 f0                	sub    %esi,%eax
+f01099fa:	c1 f8 03             	sar    $0x3,%eax
+f01099fd:	89 c2                	mov    %eax,%edx
+f01099ff:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0109a02:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0109a07:	39 c8                	cmp    %ecx,%eax
+f0109a09:	73 55                	jae    f0109a60 <ksm_scan+0x431>
+		if (memcmp(page2kva(kp), page2kva(pp), PGSIZE) == 0
+f0109a0b:	83 ec 04             	sub    $0x4,%esp
+f0109a0e:	68 00 10 00 00       	push   $0x1000
+f0109a13:	ff 75 c4             	push   -0x3c(%ebp)
+	return (void *)(pa + KERNBASE);
+f0109a16:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0109a1c:	52                   	push   %edx
+f0109a1d:	e8 c6 eb ff ff       	call   f01085e8 <memcmp>
+f0109a22:	83 c4 10             	add    $0x10,%esp
+f0109a25:	85 c0                	test   %eax,%eax
+f0109a27:	0f 85 23 fd ff ff    	jne    f0109750 <ksm_scan+0x121>
+		    && !futex_page_busy(page2pa(pp)))
+f0109a2d:	83 ec 0c             	sub    $0xc,%esp
+	return (pp - pages) << PGSHIFT;
+f0109a30:	8b 45 c0             	mov    -0x40(%ebp),%eax
+f0109a33:	2b 05 68 47 79 f0    	sub    0xf0794768,%eax
+f0109a39:	c1 f8 03             	sar    $0x3,%eax
+f0109a3c:	c1 e0 0c             	shl    $0xc,%eax
+f0109a3f:	50                   	push   %eax
+f0109a40:	e8 ae 17 00 00       	call   f010b1f3 <futex_page_busy>
+f0109a45:	83 c4 10             	add    $0x10,%esp
+f0109a48:	84 c0                	test   %al,%al
+f0109a4a:	0f 85 00 fd ff ff    	jne    f0109750 <ksm_scan+0x121>
+			ksm_merge(pte, kp);
+f0109a50:	8b 55 bc             	mov    -0x44(%ebp),%edx
+f0109a53:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0109a56:	e8 65 fb ff ff       	call   f01095c0 <ksm_merge>
+f0109a5b:	e9 f0 fc ff ff       	jmp    f0109750 <ksm_scan+0x121>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0109a60:	52                   	push   %edx
+f0109a61:	68 90 be 10 f0       	push   $0xf010be90
+f0109a66:	68 a4 00 00 00       	push   $0xa4
+f0109a6b:	68 95 ce 10 f0       	push   $0xf010ce95
+f0109a70:	e8 ce 65 ff ff       	call   f0100043 <_panic>
+f0109a75:	ff 75 c4             	push   -0x3c(%ebp)
+f0109a78:	68 90 be 10 f0       	push   $0xf010be90
+f0109a7d:	68 a4 00 00 00       	push   $0xa4
+f0109a82:	68 95 ce 10 f0       	push   $0xf010ce95
+f0109a87:	e8 b7 65 ff ff       	call   f0100043 <_panic>
+f0109a8c:	51                   	push   %ecx
+f0109a8d:	68 90 be 10 f0       	push   $0xf010be90
+f0109a92:	68 a4 00 00 00       	push   $0xa4
+f0109a97:	68 95 ce 10 f0       	push   $0xf010ce95
+f0109a9c:	e8 a2 65 ff ff       	call   f0100043 <_panic>
+	}
+}
+f0109aa1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0109aa4:	5b                   	pop    %ebx
+f0109aa5:	5e                   	pop    %esi
+f0109aa6:	5f                   	pop    %edi
+f0109aa7:	5d                   	pop    %ebp
+f0109aa8:	c3                   	ret
+
+f0109aa9 <ksm_fault>:
+// Returns 0 if the fault was resolved, < 0 if it wasn't ours
+// (-E_INVAL) or there was no memory for the copy (-E_NO_MEM).
+//
+int
+ksm_fault(struct Env *e, uintptr_t va)
+{
+f0109aa9:	55                   	push   %ebp
+f0109aaa:	89 e5                	mov    %esp,%ebp
+f0109aac:	56                   	push   %esi
+f0109aad:	53                   	push   %ebx
+f0109aae:	83 ec 10             	sub    $0x10,%esp
+f0109ab1:	8b 75 08             	mov    0x8(%ebp),%esi
+f0109ab4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct PageInfo *pp;
+	pte_t *pte;
+	int r;
+
+	if (va >= UTOP)
+f0109ab7:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+f0109abd:	77 54                	ja     f0109b13 <ksm_fault+0x6a>
+		return -E_INVAL;
+	pp = page_lookup(e->env_pgdir, (void *) ROUNDDOWN(va, PGSIZE), &pte);
+f0109abf:	83 ec 04             	sub    $0x4,%esp
+f0109ac2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f0109ac5:	50                   	push   %eax
+f0109ac6:	89 d8                	mov    %ebx,%eax
+f0109ac8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0109acd:	50                   	push   %eax
+f0109ace:	ff 76 60             	push   0x60(%esi)
+f0109ad1:	e8 b4 7d ff ff       	call   f010188a <page_lookup>
+	if (!pp || !(*pte & PTE_COW) || !(pp->pp_flags & PP_KSM))
+f0109ad6:	83 c4 10             	add    $0x10,%esp
+f0109ad9:	85 c0                	test   %eax,%eax
+f0109adb:	74 3d                	je     f0109b1a <ksm_fault+0x71>
+f0109add:	8b 55 f4             	mov    -0xc(%ebp),%edx
+f0109ae0:	8b 12                	mov    (%edx),%edx
+f0109ae2:	f6 c6 08             	test   $0x8,%dh
+f0109ae5:	74 3a                	je     f0109b21 <ksm_fault+0x78>
+f0109ae7:	f6 40 06 01          	testb  $0x1,0x6(%eax)
+f0109aeb:	74 3b                	je     f0109b28 <ksm_fault+0x7f>
+		return -E_INVAL;
+	if ((r = page_cow_break(e->env_pgdir, (void *) va)) < 0)
+f0109aed:	83 ec 08             	sub    $0x8,%esp
+f0109af0:	53                   	push   %ebx
+f0109af1:	ff 76 60             	push   0x60(%esi)
+f0109af4:	e8 85 80 ff ff       	call   f0101b7e <page_cow_break>
+f0109af9:	83 c4 10             	add    $0x10,%esp
+f0109afc:	85 c0                	test   %eax,%eax
+f0109afe:	78 0c                	js     f0109b0c <ksm_fault+0x63>
+		return r;
+	ksm_unmerges++;
+f0109b00:	83 05 50 64 7d f0 01 	addl   $0x1,0xf07d6450
+	return 0;
+f0109b07:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0109b0c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0109b0f:	5b                   	pop    %ebx
+f0109b10:	5e                   	pop    %esi
+f0109b11:	5d                   	pop    %ebp
+f0109b12:	c3                   	ret
+		return -E_INVAL;
+f0109b13:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0109b18:	eb f2                	jmp    f0109b0c <ksm_fault+0x63>
+		return -E_INVAL;
+f0109b1a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0109b1f:	eb eb                	jmp    f0109b0c <ksm_fault+0x63>
+f0109b21:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0109b26:	eb e4                	jmp    f0109b0c <ksm_fault+0x63>
+f0109b28:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0109b2d:	eb dd                	jmp    f0109b0c <ksm_fault+0x63>
+
+f0109b2f <ksm_page_ref>:
+// Account for a reference to the merged page 'pp' having been taken
+// (delta 1) or dropped (delta -1).  pp_ref already holds the new count.
+//
+void
+ksm_page_ref(struct PageInfo *pp, int delta)
+{
+f0109b2f:	55                   	push   %ebp
+f0109b30:	89 e5                	mov    %esp,%ebp
+	if (pp->pp_ref == 0)
+f0109b32:	8b 45 08             	mov    0x8(%ebp),%eax
+f0109b35:	66 83 78 04 00       	cmpw   $0x0,0x4(%eax)
+f0109b3a:	75 09                	jne    f0109b45 <ksm_page_ref+0x16>
+		ksm_shared--;
+f0109b3c:	83 2d 4c 64 7d f0 01 	subl   $0x1,0xf07d644c
+	else
+		ksm_saved += delta;
+}
+f0109b43:	5d                   	pop    %ebp
+f0109b44:	c3                   	ret
+		ksm_saved += delta;
+f0109b45:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0109b48:	01 05 48 64 7d f0    	add    %eax,0xf07d6448
+}
+f0109b4e:	eb f3                	jmp    f0109b43 <ksm_page_ref+0x14>
+
+f0109b50 <ksm_page_unmerge>:
+// Turn the merged page 'pp', now mapped just once, back into a
+// private page.
+//
+void
+ksm_page_unmerge(struct PageInfo *pp)
+{
+f0109b50:	55                   	push   %ebp
+f0109b51:	89 e5                	mov    %esp,%ebp
+f0109b53:	83 ec 08             	sub    $0x8,%esp
+f0109b56:	8b 45 08             	mov    0x8(%ebp),%eax
+	assert(pp->pp_ref == 1);
+f0109b59:	66 83 78 04 01       	cmpw   $0x1,0x4(%eax)
+f0109b5e:	75 0e                	jne    f0109b6e <ksm_page_unmerge+0x1e>
+	pp->pp_flags &= ~PP_KSM;
+f0109b60:	66 83 60 06 fe       	andw   $0xfffe,0x6(%eax)
+	ksm_shared--;
+f0109b65:	83 2d 4c 64 7d f0 01 	subl   $0x1,0xf07d644c
+}
+f0109b6c:	c9                   	leave
+f0109b6d:	c3                   	ret
+	assert(pp->pp_ref == 1);
+f0109b6e:	68 e8 e2 10 f0       	push   $0xf010e2e8
+f0109b73:	68 bf be 10 f0       	push   $0xf010bebf
+f0109b78:	68 f8 00 00 00       	push   $0xf8
+f0109b7d:	68 f8 e2 10 f0       	push   $0xf010e2f8
+f0109b82:	e8 bc 64 ff ff       	call   f0100043 <_panic>
+
+f0109b87 <ksm_get_stats>:
+
+void
+ksm_get_stats(struct ksm_stats *stats)
+{
+f0109b87:	55                   	push   %ebp
+f0109b88:	89 e5                	mov    %esp,%ebp
+f0109b8a:	8b 45 08             	mov    0x8(%ebp),%eax
+	stats->merges = ksm_merges;
+f0109b8d:	8b 15 54 64 7d f0    	mov    0xf07d6454,%edx
+f0109b93:	89 10                	mov    %edx,(%eax)
+	stats->unmerges = ksm_unmerges;
+f0109b95:	8b 15 50 64 7d f0    	mov    0xf07d6450,%edx
+f0109b9b:	89 50 04             	mov    %edx,0x4(%eax)
+	stats->shared = ksm_shared;
+f0109b9e:	8b 15 4c 64 7d f0    	mov    0xf07d644c,%edx
+f0109ba4:	89 50 08             	mov    %edx,0x8(%eax)
+	stats->saved = ksm_saved;
+f0109ba7:	8b 15 48 64 7d f0    	mov    0xf07d6448,%edx
+f0109bad:	89 50 0c             	mov    %edx,0xc(%eax)
+}
+f0109bb0:	5d                   	pop    %ebp
+f0109bb1:	c3                   	ret
+
+f0109bb2 <image_fill_page>:
+
+// Copy the file data of 'binary' that belongs at page 'va' into the
+// zeroed page at kernel address 'kva'.
+static void
+image_fill_page(const uint8_t *binary, uintptr_t va, char *kva)
+{
+f0109bb2:	55                   	push   %ebp
+f0109bb3:	89 e5                	mov    %esp,%ebp
+f0109bb5:	57                   	push   %edi
+f0109bb6:	56                   	push   %esi
+f0109bb7:	53                   	push   %ebx
+f0109bb8:	83 ec 1c             	sub    $0x1c,%esp
+f0109bbb:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f0109bbe:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+	const struct Elf *elf = (const struct Elf *) binary;
+	const struct Proghdr *ph, *eph;
+	uintptr_t start, end;
+
+	ph = (const struct Proghdr *) (binary + elf->e_phoff);
+f0109bc1:	89 c3                	mov    %eax,%ebx
+f0109bc3:	03 58 1c             	add    0x1c(%eax),%ebx
+	eph = ph + elf->e_phnum;
+f0109bc6:	0f b7 70 2c          	movzwl 0x2c(%eax),%esi
+f0109bca:	c1 e6 05             	shl    $0x5,%esi
+f0109bcd:	01 de                	add    %ebx,%esi
+	for (; ph < eph; ph++) {
+		if (ph->p_type != ELF_PROG_LOAD)
+			continue;
+		start = MAX(va, ph->p_va);
+		end = MIN(va + PGSIZE, ph->p_va + ph->p_filesz);
+f0109bcf:	8d 82 00 10 00 00    	lea    0x1000(%edx),%eax
+f0109bd5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0109bd8:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	for (; ph < eph; ph++) {
+f0109bdb:	eb 03                	jmp    f0109be0 <image_fill_page+0x2e>
+f0109bdd:	83 c3 20             	add    $0x20,%ebx
+f0109be0:	39 f3                	cmp    %esi,%ebx
+f0109be2:	73 4c                	jae    f0109c30 <image_fill_page+0x7e>
+		if (ph->p_type != ELF_PROG_LOAD)
+f0109be4:	83 3b 01             	cmpl   $0x1,(%ebx)
+f0109be7:	75 f4                	jne    f0109bdd <image_fill_page+0x2b>
+		start = MAX(va, ph->p_va);
+f0109be9:	8b 53 08             	mov    0x8(%ebx),%edx
+f0109bec:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0109bef:	39 d0                	cmp    %edx,%eax
+f0109bf1:	89 d1                	mov    %edx,%ecx
+f0109bf3:	0f 43 c8             	cmovae %eax,%ecx
+		end = MIN(va + PGSIZE, ph->p_va + ph->p_filesz);
+f0109bf6:	89 d0                	mov    %edx,%eax
+f0109bf8:	03 43 10             	add    0x10(%ebx),%eax
+f0109bfb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0109bfe:	39 f8                	cmp    %edi,%eax
+f0109c00:	0f 47 c7             	cmova  %edi,%eax
+		if (start < end)
+f0109c03:	39 c1                	cmp    %eax,%ecx
+f0109c05:	73 d6                	jae    f0109bdd <image_fill_page+0x2b>
+			memcpy(kva + PGOFF(start),
+f0109c07:	83 ec 04             	sub    $0x4,%esp
+f0109c0a:	29 c8                	sub    %ecx,%eax
+f0109c0c:	50                   	push   %eax
+			       binary + ph->p_offset + (start - ph->p_va),
+f0109c0d:	89 c8                	mov    %ecx,%eax
+f0109c0f:	29 d0                	sub    %edx,%eax
+f0109c11:	03 43 04             	add    0x4(%ebx),%eax
+f0109c14:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f0109c17:	01 d0                	add    %edx,%eax
+			memcpy(kva + PGOFF(start),
+f0109c19:	50                   	push   %eax
+f0109c1a:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+f0109c20:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f0109c23:	01 c1                	add    %eax,%ecx
+f0109c25:	51                   	push   %ecx
+f0109c26:	e8 a7 e9 ff ff       	call   f01085d2 <memcpy>
+f0109c2b:	83 c4 10             	add    $0x10,%esp
+f0109c2e:	eb ad                	jmp    f0109bdd <image_fill_page+0x2b>
+			       end - start);
+	}
+}
+f0109c30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0109c33:	5b                   	pop    %ebx
+f0109c34:	5e                   	pop    %esi
+f0109c35:	5f                   	pop    %edi
+f0109c36:	5d                   	pop    %ebp
+f0109c37:	c3                   	ret
+
+f0109c38 <elfcache_fault>:
+// Returns 0 if the page was mapped, -E_INVAL if 'va' is not a page of
+// e's binary that is still to be loaded, -E_NO_MEM if out of memory.
+//
+int
+elfcache_fault(struct Env *e, uintptr_t va)
+{
+f0109c38:	55                   	push   %ebp
+f0109c39:	89 e5                	mov    %esp,%ebp
+f0109c3b:	57                   	push   %edi
+f0109c3c:	56                   	push   %esi
+f0109c3d:	53                   	push   %ebx
+f0109c3e:	83 ec 2c             	sub    $0x2c,%esp
+f0109c41:	8b 45 0c             	mov    0xc(%ebp),%eax
+	const uint8_t *binary = e->env_binary;
+f0109c44:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0109c47:	8b 77 64             	mov    0x64(%edi),%esi
+f0109c4a:	89 75 dc             	mov    %esi,-0x24(%ebp)
+	struct PageInfo *pp;
+	uintptr_t start = 0, end = 0;
+	size_t i = 0;
+	int perm, r;
+
+	if (!binary || va >= UTOP)
+f0109c4d:	85 f6                	test   %esi,%esi
+f0109c4f:	0f 84 ae 02 00 00    	je     f0109f03 <elfcache_fault+0x2cb>
+f0109c55:	3d ff ff bf ee       	cmp    $0xeebfffff,%eax
+f0109c5a:	0f 87 a3 02 00 00    	ja     f0109f03 <elfcache_fault+0x2cb>
+		return -E_INVAL;
+	va = ROUNDDOWN(va, PGSIZE);
+f0109c60:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0109c65:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (page_lookup(e->env_pgdir, (void *) va, NULL))
+f0109c68:	83 ec 04             	sub    $0x4,%esp
+f0109c6b:	6a 00                	push   $0x0
+f0109c6d:	50                   	push   %eax
+f0109c6e:	ff 77 60             	push   0x60(%edi)
+f0109c71:	e8 14 7c ff ff       	call   f010188a <page_lookup>
+f0109c76:	89 c7                	mov    %eax,%edi
+f0109c78:	83 c4 10             	add    $0x10,%esp
+f0109c7b:	85 c0                	test   %eax,%eax
+f0109c7d:	0f 85 8a 02 00 00    	jne    f0109f0d <elfcache_fault+0x2d5>
+		return -E_INVAL;
+
+	ph = (const struct Proghdr *) (binary + elf->e_phoff);
+f0109c83:	89 f2                	mov    %esi,%edx
+f0109c85:	03 56 1c             	add    0x1c(%esi),%edx
+	eph = ph + elf->e_phnum;
+f0109c88:	0f b7 46 2c          	movzwl 0x2c(%esi),%eax
+f0109c8c:	c1 e0 05             	shl    $0x5,%eax
+f0109c8f:	01 d0                	add    %edx,%eax
+	ph = (const struct Proghdr *) (binary + elf->e_phoff);
+f0109c91:	89 d3                	mov    %edx,%ebx
+	uintptr_t start = 0, end = 0;
+f0109c93:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0109c98:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+	size_t i = 0;
+f0109c9f:	be 00 00 00 00       	mov    $0x0,%esi
+f0109ca4:	89 7d d8             	mov    %edi,-0x28(%ebp)
+f0109ca7:	89 f7                	mov    %esi,%edi
+f0109ca9:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+	for (; ph < eph; ph++) {
+f0109cac:	eb 0c                	jmp    f0109cba <elfcache_fault+0x82>
+		if (ph->p_type != ELF_PROG_LOAD)
+			continue;
+		segment_data(ph, &start, &end);
+		if (va >= start && va < ph->p_va + ph->p_memsz)
+			break;
+		i += (end - start) / PGSIZE;
+f0109cae:	89 ca                	mov    %ecx,%edx
+f0109cb0:	29 f2                	sub    %esi,%edx
+f0109cb2:	c1 ea 0c             	shr    $0xc,%edx
+f0109cb5:	01 d7                	add    %edx,%edi
+	for (; ph < eph; ph++) {
+f0109cb7:	83 c3 20             	add    $0x20,%ebx
+f0109cba:	39 c3                	cmp    %eax,%ebx
+f0109cbc:	73 3c                	jae    f0109cfa <elfcache_fault+0xc2>
+		if (ph->p_type != ELF_PROG_LOAD)
+f0109cbe:	83 3b 01             	cmpl   $0x1,(%ebx)
+f0109cc1:	75 f4                	jne    f0109cb7 <elfcache_fault+0x7f>
+	*start = ROUNDDOWN(ph->p_va, PGSIZE);
+f0109cc3:	8b 53 08             	mov    0x8(%ebx),%edx
+f0109cc6:	89 d6                	mov    %edx,%esi
+f0109cc8:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	*end = ROUNDUP(ph->p_va + ph->p_filesz, PGSIZE);
+f0109cce:	89 d1                	mov    %edx,%ecx
+f0109cd0:	03 4b 10             	add    0x10(%ebx),%ecx
+f0109cd3:	81 c1 ff 0f 00 00    	add    $0xfff,%ecx
+f0109cd9:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+		if (va >= start && va < ph->p_va + ph->p_memsz)
+f0109cdf:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+f0109ce2:	72 ca                	jb     f0109cae <elfcache_fault+0x76>
+f0109ce4:	03 53 14             	add    0x14(%ebx),%edx
+f0109ce7:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+f0109cea:	73 c2                	jae    f0109cae <elfcache_fault+0x76>
+f0109cec:	89 7d d0             	mov    %edi,-0x30(%ebp)
+f0109cef:	8b 7d d8             	mov    -0x28(%ebp),%edi
+f0109cf2:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+f0109cf5:	89 75 e0             	mov    %esi,-0x20(%ebp)
+f0109cf8:	eb 12                	jmp    f0109d0c <elfcache_fault+0xd4>
+	}
+	if (ph == eph)
+f0109cfa:	89 7d d0             	mov    %edi,-0x30(%ebp)
+f0109cfd:	8b 7d d8             	mov    -0x28(%ebp),%edi
+f0109d00:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+f0109d03:	89 75 e0             	mov    %esi,-0x20(%ebp)
+f0109d06:	0f 84 0b 02 00 00    	je     f0109f17 <elfcache_fault+0x2df>
+	for (ei = elf_images; ei < elf_images + ELFCACHE_NIMAGES; ei++) {
+f0109d0c:	be 60 a4 7d f0       	mov    $0xf07da460,%esi
+		return -E_INVAL;
+	if (va >= end)
+f0109d11:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+f0109d14:	73 41                	jae    f0109d57 <elfcache_fault+0x11f>
+f0109d16:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f0109d19:	89 45 d8             	mov    %eax,-0x28(%ebp)
+		if (ei->ei_binary == binary)
+f0109d1c:	8b 06                	mov    (%esi),%eax
+f0109d1e:	39 c1                	cmp    %eax,%ecx
+f0109d20:	0f 84 f8 00 00 00    	je     f0109e1e <elfcache_fault+0x1e6>
+		if (!ei->ei_binary && !free)
+f0109d26:	09 f8                	or     %edi,%eax
+f0109d28:	0f 44 fe             	cmove  %esi,%edi
+	for (ei = elf_images; ei < elf_images + ELFCACHE_NIMAGES; ei++) {
+f0109d2b:	83 c6 0c             	add    $0xc,%esi
+f0109d2e:	81 fe 20 a5 7d f0    	cmp    $0xf07da520,%esi
+f0109d34:	75 e6                	jne    f0109d1c <elfcache_fault+0xe4>
+	if (!free || elfcache_fill(free, binary) < 0)
+f0109d36:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f0109d39:	85 ff                	test   %edi,%edi
+f0109d3b:	0f 84 f7 01 00 00    	je     f0109f38 <elfcache_fault+0x300>
+	size_t n = 0;
+f0109d41:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	uintptr_t start, end, prev_end = 0;
+f0109d48:	be 00 00 00 00       	mov    $0x0,%esi
+f0109d4d:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+f0109d50:	89 7d cc             	mov    %edi,-0x34(%ebp)
+f0109d53:	89 f1                	mov    %esi,%ecx
+f0109d55:	eb 20                	jmp    f0109d77 <elfcache_fault+0x13f>
+		return page_map_zero(e->env_pgdir, (void *) va,
+f0109d57:	83 ec 04             	sub    $0x4,%esp
+f0109d5a:	6a 07                	push   $0x7
+f0109d5c:	ff 75 e4             	push   -0x1c(%ebp)
+f0109d5f:	8b 45 08             	mov    0x8(%ebp),%eax
+f0109d62:	ff 70 60             	push   0x60(%eax)
+f0109d65:	e8 95 7d ff ff       	call   f0101aff <page_map_zero>
+f0109d6a:	89 c3                	mov    %eax,%ebx
+f0109d6c:	83 c4 10             	add    $0x10,%esp
+f0109d6f:	e9 f1 00 00 00       	jmp    f0109e65 <elfcache_fault+0x22d>
+	for (; ph < eph; ph++) {
+f0109d74:	83 c2 20             	add    $0x20,%edx
+f0109d77:	39 c2                	cmp    %eax,%edx
+f0109d79:	73 43                	jae    f0109dbe <elfcache_fault+0x186>
+		if (ph->p_type != ELF_PROG_LOAD)
+f0109d7b:	83 3a 01             	cmpl   $0x1,(%edx)
+f0109d7e:	75 f4                	jne    f0109d74 <elfcache_fault+0x13c>
+		if (ROUNDDOWN(ph->p_va, PGSIZE) < prev_end)
+f0109d80:	8b 5a 08             	mov    0x8(%edx),%ebx
+f0109d83:	89 df                	mov    %ebx,%edi
+f0109d85:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+f0109d8b:	39 cf                	cmp    %ecx,%edi
+f0109d8d:	0f 82 a2 01 00 00    	jb     f0109f35 <elfcache_fault+0x2fd>
+	*end = ROUNDUP(ph->p_va + ph->p_filesz, PGSIZE);
+f0109d93:	89 d9                	mov    %ebx,%ecx
+f0109d95:	03 4a 10             	add    0x10(%edx),%ecx
+f0109d98:	81 c1 ff 0f 00 00    	add    $0xfff,%ecx
+		n += (end - start) / PGSIZE;
+f0109d9e:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+f0109da4:	29 f9                	sub    %edi,%ecx
+f0109da6:	c1 e9 0c             	shr    $0xc,%ecx
+f0109da9:	01 ce                	add    %ecx,%esi
+		prev_end = ROUNDUP(ph->p_va + ph->p_memsz, PGSIZE);
+f0109dab:	03 5a 14             	add    0x14(%edx),%ebx
+f0109dae:	81 c3 ff 0f 00 00    	add    $0xfff,%ebx
+f0109db4:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+f0109dba:	89 d9                	mov    %ebx,%ecx
+f0109dbc:	eb b6                	jmp    f0109d74 <elfcache_fault+0x13c>
+	if (n > ELFCACHE_MAXPAGES)
+f0109dbe:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+f0109dc1:	8b 7d cc             	mov    -0x34(%ebp),%edi
+f0109dc4:	89 75 d8             	mov    %esi,-0x28(%ebp)
+f0109dc7:	81 fe 00 04 00 00    	cmp    $0x400,%esi
+f0109dcd:	0f 87 65 01 00 00    	ja     f0109f38 <elfcache_fault+0x300>
+	if (!(pp = page_alloc(ALLOC_ZERO)))
+f0109dd3:	83 ec 0c             	sub    $0xc,%esp
+f0109dd6:	6a 01                	push   $0x1
+f0109dd8:	e8 08 74 ff ff       	call   f01011e5 <page_alloc>
+f0109ddd:	83 c4 10             	add    $0x10,%esp
+f0109de0:	85 c0                	test   %eax,%eax
+f0109de2:	0f 84 50 01 00 00    	je     f0109f38 <elfcache_fault+0x300>
+	pp->pp_ref++;
+f0109de8:	66 83 40 04 01       	addw   $0x1,0x4(%eax)
+	return (pp - pages) << PGSHIFT;
+f0109ded:	2b 05 68 47 79 f0    	sub    0xf0794768,%eax
+f0109df3:	c1 f8 03             	sar    $0x3,%eax
+f0109df6:	89 c2                	mov    %eax,%edx
+f0109df8:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0109dfb:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0109e00:	3b 05 74 47 79 f0    	cmp    0xf0794774,%eax
+f0109e06:	73 67                	jae    f0109e6f <elfcache_fault+0x237>
+	return (void *)(pa + KERNBASE);
+f0109e08:	8d 82 00 00 00 f0    	lea    -0x10000000(%edx),%eax
+f0109e0e:	89 47 04             	mov    %eax,0x4(%edi)
+	ei->ei_npages = n;
+f0109e11:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f0109e14:	89 47 08             	mov    %eax,0x8(%edi)
+	free->ei_binary = binary;
+f0109e17:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0109e1a:	89 07                	mov    %eax,(%edi)
+f0109e1c:	89 fe                	mov    %edi,%esi
+				     PTE_P | PTE_U | PTE_W);
+
+	i += (va - start) / PGSIZE;
+f0109e1e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0109e21:	8b 7d e0             	mov    -0x20(%ebp),%edi
+f0109e24:	29 f8                	sub    %edi,%eax
+f0109e26:	c1 e8 0c             	shr    $0xc,%eax
+f0109e29:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f0109e2c:	01 c7                	add    %eax,%edi
+f0109e2e:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	if ((pp = ei->ei_pages[i]))
+f0109e31:	8b 46 04             	mov    0x4(%esi),%eax
+f0109e34:	8b 3c b8             	mov    (%eax,%edi,4),%edi
+f0109e37:	85 ff                	test   %edi,%edi
+f0109e39:	74 49                	je     f0109e84 <elfcache_fault+0x24c>
+	perm = PTE_P | PTE_U;
+	if ((ei = elfcache_lookup(binary))) {
+		if (!(pp = elfcache_page(ei, i, va)))
+			return -E_NO_MEM;
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+f0109e3b:	8b 43 18             	mov    0x18(%ebx),%eax
+f0109e3e:	83 e0 02             	and    $0x2,%eax
+	perm = PTE_P | PTE_U;
+f0109e41:	83 f8 01             	cmp    $0x1,%eax
+f0109e44:	19 c0                	sbb    %eax,%eax
+f0109e46:	25 00 f8 ff ff       	and    $0xfffff800,%eax
+f0109e4b:	05 05 08 00 00       	add    $0x805,%eax
+			perm |= PTE_COW;
+		return page_insert(e->env_pgdir, pp, (void *) va, perm);
+f0109e50:	50                   	push   %eax
+f0109e51:	ff 75 e4             	push   -0x1c(%ebp)
+f0109e54:	57                   	push   %edi
+f0109e55:	8b 45 08             	mov    0x8(%ebp),%eax
+f0109e58:	ff 70 60             	push   0x60(%eax)
+f0109e5b:	e8 ea 7b ff ff       	call   f0101a4a <page_insert>
+f0109e60:	89 c3                	mov    %eax,%ebx
+f0109e62:	83 c4 10             	add    $0x10,%esp
+	if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+		perm |= PTE_W;
+	if ((r = page_insert(e->env_pgdir, pp, (void *) va, perm)) < 0)
+		page_free(pp);
+	return r;
+}
+f0109e65:	89 d8                	mov    %ebx,%eax
+f0109e67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0109e6a:	5b                   	pop    %ebx
+f0109e6b:	5e                   	pop    %esi
+f0109e6c:	5f                   	pop    %edi
+f0109e6d:	5d                   	pop    %ebp
+f0109e6e:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0109e6f:	52                   	push   %edx
+f0109e70:	68 90 be 10 f0       	push   $0xf010be90
+f0109e75:	68 a4 00 00 00       	push   $0xa4
+f0109e7a:	68 95 ce 10 f0       	push   $0xf010ce95
+f0109e7f:	e8 bf 61 ff ff       	call   f0100043 <_panic>
+	if (!(pp = page_alloc(ALLOC_ZERO)))
+f0109e84:	83 ec 0c             	sub    $0xc,%esp
+f0109e87:	6a 01                	push   $0x1
+f0109e89:	e8 57 73 ff ff       	call   f01011e5 <page_alloc>
+f0109e8e:	89 c7                	mov    %eax,%edi
+f0109e90:	83 c4 10             	add    $0x10,%esp
+f0109e93:	85 c0                	test   %eax,%eax
+f0109e95:	0f 84 86 00 00 00    	je     f0109f21 <elfcache_fault+0x2e9>
+	return (pp - pages) << PGSHIFT;
+f0109e9b:	2b 05 68 47 79 f0    	sub    0xf0794768,%eax
+f0109ea1:	c1 f8 03             	sar    $0x3,%eax
+f0109ea4:	89 c2                	mov    %eax,%edx
+f0109ea6:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0109ea9:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0109eae:	3b 05 74 47 79 f0    	cmp    0xf0794774,%eax
+f0109eb4:	73 23                	jae    f0109ed9 <elfcache_fault+0x2a1>
+	return (void *)(pa + KERNBASE);
+f0109eb6:	8d 8a 00 00 00 f0    	lea    -0x10000000(%edx),%ecx
+	image_fill_page(ei->ei_binary, va, page2kva(pp));
+f0109ebc:	8b 06                	mov    (%esi),%eax
+f0109ebe:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0109ec1:	e8 ec fc ff ff       	call   f0109bb2 <image_fill_page>
+	pp->pp_ref++;
+f0109ec6:	66 83 47 04 01       	addw   $0x1,0x4(%edi)
+	ei->ei_pages[i] = pp;
+f0109ecb:	8b 46 04             	mov    0x4(%esi),%eax
+f0109ece:	8b 75 e0             	mov    -0x20(%ebp),%esi
+f0109ed1:	89 3c b0             	mov    %edi,(%eax,%esi,4)
+	return pp;
+f0109ed4:	e9 62 ff ff ff       	jmp    f0109e3b <elfcache_fault+0x203>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0109ed9:	52                   	push   %edx
+f0109eda:	68 90 be 10 f0       	push   $0xf010be90
+f0109edf:	68 a4 00 00 00       	push   $0xa4
+f0109ee4:	68 95 ce 10 f0       	push   $0xf010ce95
+f0109ee9:	e8 55 61 ff ff       	call   f0100043 <_panic>
+f0109eee:	52                   	push   %edx
+f0109eef:	68 90 be 10 f0       	push   $0xf010be90
+f0109ef4:	68 a4 00 00 00       	push   $0xa4
+f0109ef9:	68 95 ce 10 f0       	push   $0xf010ce95
+f0109efe:	e8 40 61 ff ff       	call   f0100043 <_panic>
+		return -E_INVAL;
+f0109f03:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0109f08:	e9 58 ff ff ff       	jmp    f0109e65 <elfcache_fault+0x22d>
+		return -E_INVAL;
+f0109f0d:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0109f12:	e9 4e ff ff ff       	jmp    f0109e65 <elfcache_fault+0x22d>
+		return -E_INVAL;
+f0109f17:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0109f1c:	e9 44 ff ff ff       	jmp    f0109e65 <elfcache_fault+0x22d>
+			return -E_NO_MEM;
+f0109f21:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+f0109f26:	e9 3a ff ff ff       	jmp    f0109e65 <elfcache_fault+0x22d>
+		return -E_NO_MEM;
+f0109f2b:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+f0109f30:	e9 30 ff ff ff       	jmp    f0109e65 <elfcache_fault+0x22d>
+f0109f35:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+	if (!(pp = page_alloc(ALLOC_ZERO)))
+f0109f38:	83 ec 0c             	sub    $0xc,%esp
+f0109f3b:	6a 01                	push   $0x1
+f0109f3d:	e8 a3 72 ff ff       	call   f01011e5 <page_alloc>
+f0109f42:	89 c6                	mov    %eax,%esi
+f0109f44:	83 c4 10             	add    $0x10,%esp
+f0109f47:	85 c0                	test   %eax,%eax
+f0109f49:	74 e0                	je     f0109f2b <elfcache_fault+0x2f3>
+	return (pp - pages) << PGSHIFT;
+f0109f4b:	89 f0                	mov    %esi,%eax
+f0109f4d:	2b 05 68 47 79 f0    	sub    0xf0794768,%eax
+f0109f53:	c1 f8 03             	sar    $0x3,%eax
+f0109f56:	89 c2                	mov    %eax,%edx
+f0109f58:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0109f5b:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0109f60:	3b 05 74 47 79 f0    	cmp    0xf0794774,%eax
+f0109f66:	73 86                	jae    f0109eee <elfcache_fault+0x2b6>
+	return (void *)(pa + KERNBASE);
+f0109f68:	8d 8a 00 00 00 f0    	lea    -0x10000000(%edx),%ecx
+	image_fill_page(binary, va, page2kva(pp));
+f0109f6e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0109f71:	89 fa                	mov    %edi,%edx
+f0109f73:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0109f76:	e8 37 fc ff ff       	call   f0109bb2 <image_fill_page>
+	if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+f0109f7b:	8b 43 18             	mov    0x18(%ebx),%eax
+f0109f7e:	83 e0 02             	and    $0x2,%eax
+	perm = PTE_P | PTE_U;
+f0109f81:	83 f8 01             	cmp    $0x1,%eax
+f0109f84:	19 c0                	sbb    %eax,%eax
+f0109f86:	83 e0 fe             	and    $0xfffffffe,%eax
+f0109f89:	83 c0 07             	add    $0x7,%eax
+	if ((r = page_insert(e->env_pgdir, pp, (void *) va, perm)) < 0)
+f0109f8c:	50                   	push   %eax
+f0109f8d:	57                   	push   %edi
+f0109f8e:	56                   	push   %esi
+f0109f8f:	8b 45 08             	mov    0x8(%ebp),%eax
+f0109f92:	ff 70 60             	push   0x60(%eax)
+f0109f95:	e8 b0 7a ff ff       	call   f0101a4a <page_insert>
+f0109f9a:	89 c3                	mov    %eax,%ebx
+f0109f9c:	83 c4 10             	add    $0x10,%esp
+f0109f9f:	85 c0                	test   %eax,%eax
+f0109fa1:	0f 89 be fe ff ff    	jns    f0109e65 <elfcache_fault+0x22d>
+		page_free(pp);
+f0109fa7:	83 ec 0c             	sub    $0xc,%esp
+f0109faa:	56                   	push   %esi
+f0109fab:	e8 c0 72 ff ff       	call   f0101270 <page_free>
+f0109fb0:	83 c4 10             	add    $0x10,%esp
+f0109fb3:	e9 ad fe ff ff       	jmp    f0109e65 <elfcache_fault+0x22d>
+
+f0109fb8 <elfcache_get_stats>:
+
+void
+elfcache_get_stats(struct elfcache_stats *stats)
+{
+f0109fb8:	55                   	push   %ebp
+f0109fb9:	89 e5                	mov    %esp,%ebp
+f0109fbb:	56                   	push   %esi
+f0109fbc:	53                   	push   %ebx
+f0109fbd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct elf_image *ei;
+	size_t i;
+
+	memset(stats, 0, sizeof(*stats));
+f0109fc0:	83 ec 04             	sub    $0x4,%esp
+f0109fc3:	6a 0c                	push   $0xc
+f0109fc5:	6a 00                	push   $0x0
+f0109fc7:	53                   	push   %ebx
+f0109fc8:	e8 6e e5 ff ff       	call   f010853b <memset>
+f0109fcd:	83 c4 10             	add    $0x10,%esp
+	for (ei = elf_images; ei < elf_images + ELFCACHE_NIMAGES; ei++) {
+f0109fd0:	ba 60 a4 7d f0       	mov    $0xf07da460,%edx
+f0109fd5:	eb 3f                	jmp    f010a016 <elfcache_get_stats+0x5e>
+		if (!ei->ei_binary)
+			continue;
+		stats->images++;
+		// The cache's own reference plus one env would be one
+		// private copy; every further mapping is a page saved.
+		for (i = 0; i < ei->ei_npages; i++) {
+f0109fd7:	83 c0 01             	add    $0x1,%eax
+f0109fda:	3b 42 08             	cmp    0x8(%edx),%eax
+f0109fdd:	73 2c                	jae    f010a00b <elfcache_get_stats+0x53>
+			if (!ei->ei_pages[i])
+f0109fdf:	8b 4a 04             	mov    0x4(%edx),%ecx
+f0109fe2:	83 3c 81 00          	cmpl   $0x0,(%ecx,%eax,4)
+f0109fe6:	74 ef                	je     f0109fd7 <elfcache_get_stats+0x1f>
+				continue;
+			stats->pages++;
+f0109fe8:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+			if (ei->ei_pages[i]->pp_ref > 2)
+f0109fec:	8b 4a 04             	mov    0x4(%edx),%ecx
+f0109fef:	8b 0c 81             	mov    (%ecx,%eax,4),%ecx
+f0109ff2:	0f b7 49 04          	movzwl 0x4(%ecx),%ecx
+f0109ff6:	66 83 f9 02          	cmp    $0x2,%cx
+f0109ffa:	76 db                	jbe    f0109fd7 <elfcache_get_stats+0x1f>
+				stats->saved += ei->ei_pages[i]->pp_ref - 2;
+f0109ffc:	0f b7 c9             	movzwl %cx,%ecx
+f0109fff:	8b 73 08             	mov    0x8(%ebx),%esi
+f010a002:	8d 4c 0e fe          	lea    -0x2(%esi,%ecx,1),%ecx
+f010a006:	89 4b 08             	mov    %ecx,0x8(%ebx)
+f010a009:	eb cc                	jmp    f0109fd7 <elfcache_get_stats+0x1f>
+	for (ei = elf_images; ei < elf_images + ELFCACHE_NIMAGES; ei++) {
+f010a00b:	83 c2 0c             	add    $0xc,%edx
+f010a00e:	81 fa 20 a5 7d f0    	cmp    $0xf07da520,%edx
+f010a014:	74 0f                	je     f010a025 <elfcache_get_stats+0x6d>
+		if (!ei->ei_binary)
+f010a016:	83 3a 00             	cmpl   $0x0,(%edx)
+f010a019:	74 f0                	je     f010a00b <elfcache_get_stats+0x53>
+		stats->images++;
+f010a01b:	83 03 01             	addl   $0x1,(%ebx)
+		for (i = 0; i < ei->ei_npages; i++) {
+f010a01e:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a023:	eb b5                	jmp    f0109fda <elfcache_get_stats+0x22>
+		}
+	}
+}
+f010a025:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010a028:	5b                   	pop    %ebx
+f010a029:	5e                   	pop    %esi
+f010a02a:	5d                   	pop    %ebp
+f010a02b:	c3                   	ret
+
+f010a02c <shm_lookup>:
+
+static struct shm_seg shm_segs[SHM_NSEGS];
+
+static struct shm_seg *
+shm_lookup(const char *name)
+{
+f010a02c:	55                   	push   %ebp
+f010a02d:	89 e5                	mov    %esp,%ebp
+f010a02f:	56                   	push   %esi
+f010a030:	53                   	push   %ebx
+f010a031:	89 c6                	mov    %eax,%esi
+	struct shm_seg *ss;
+
+	for (ss = shm_segs; ss < shm_segs + SHM_NSEGS; ss++)
+f010a033:	bb 20 a5 7d f0       	mov    $0xf07da520,%ebx
+f010a038:	eb 0b                	jmp    f010a045 <shm_lookup+0x19>
+f010a03a:	83 c3 28             	add    $0x28,%ebx
+f010a03d:	81 fb 20 aa 7d f0    	cmp    $0xf07daa20,%ebx
+f010a043:	74 18                	je     f010a05d <shm_lookup+0x31>
+		if (ss->ss_name[0] && strcmp(ss->ss_name, name) == 0)
+f010a045:	80 3b 00             	cmpb   $0x0,(%ebx)
+f010a048:	74 f0                	je     f010a03a <shm_lookup+0xe>
+f010a04a:	83 ec 08             	sub    $0x8,%esp
+f010a04d:	56                   	push   %esi
+f010a04e:	53                   	push   %ebx
+f010a04f:	e8 47 e4 ff ff       	call   f010849b <strcmp>
+f010a054:	83 c4 10             	add    $0x10,%esp
+f010a057:	85 c0                	test   %eax,%eax
+f010a059:	75 df                	jne    f010a03a <shm_lookup+0xe>
+f010a05b:	eb 05                	jmp    f010a062 <shm_lookup+0x36>
+			return ss;
+	return NULL;
+f010a05d:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+f010a062:	89 d8                	mov    %ebx,%eax
+f010a064:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010a067:	5b                   	pop    %ebx
+f010a068:	5e                   	pop    %esi
+f010a069:	5d                   	pop    %ebp
+f010a06a:	c3                   	ret
+
+f010a06b <shm_release>:
+
+static void
+shm_release(struct shm_seg *ss)
+{
+f010a06b:	55                   	push   %ebp
+f010a06c:	89 e5                	mov    %esp,%ebp
+f010a06e:	56                   	push   %esi
+f010a06f:	53                   	push   %ebx
+f010a070:	89 c6                	mov    %eax,%esi
+	size_t i;
+
+	for (i = 0; i < ss->ss_npages; i++)
+f010a072:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010a077:	eb 14                	jmp    f010a08d <shm_release+0x22>
+		page_decref(ss->ss_pages[i]);
+f010a079:	83 ec 0c             	sub    $0xc,%esp
+f010a07c:	8b 46 20             	mov    0x20(%esi),%eax
+f010a07f:	ff 34 98             	push   (%eax,%ebx,4)
+f010a082:	e8 35 72 ff ff       	call   f01012bc <page_decref>
+	for (i = 0; i < ss->ss_npages; i++)
+f010a087:	83 c3 01             	add    $0x1,%ebx
+f010a08a:	83 c4 10             	add    $0x10,%esp
+f010a08d:	3b 5e 24             	cmp    0x24(%esi),%ebx
+f010a090:	72 e7                	jb     f010a079 <shm_release+0xe>
+	page_decref(pa2page(PADDR(ss->ss_pages)));
+f010a092:	8b 46 20             	mov    0x20(%esi),%eax
+	if ((uint32_t)kva < KERNBASE)
+f010a095:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f010a09a:	76 39                	jbe    f010a0d5 <shm_release+0x6a>
+	return (physaddr_t)kva - KERNBASE;
+f010a09c:	05 00 00 00 10       	add    $0x10000000,%eax
+	if (PGNUM(pa) >= npages)
+f010a0a1:	c1 e8 0c             	shr    $0xc,%eax
+f010a0a4:	3b 05 74 47 79 f0    	cmp    0xf0794774,%eax
+f010a0aa:	73 3b                	jae    f010a0e7 <shm_release+0x7c>
+f010a0ac:	83 ec 0c             	sub    $0xc,%esp
+	return &pages[PGNUM(pa)];
+f010a0af:	8b 15 68 47 79 f0    	mov    0xf0794768,%edx
+f010a0b5:	8d 04 c2             	lea    (%edx,%eax,8),%eax
+f010a0b8:	50                   	push   %eax
+f010a0b9:	e8 fe 71 ff ff       	call   f01012bc <page_decref>
+	memset(ss, 0, sizeof(*ss));
+f010a0be:	83 c4 0c             	add    $0xc,%esp
+f010a0c1:	6a 28                	push   $0x28
+f010a0c3:	6a 00                	push   $0x0
+f010a0c5:	56                   	push   %esi
+f010a0c6:	e8 70 e4 ff ff       	call   f010853b <memset>
+}
+f010a0cb:	83 c4 10             	add    $0x10,%esp
+f010a0ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010a0d1:	5b                   	pop    %ebx
+f010a0d2:	5e                   	pop    %esi
+f010a0d3:	5d                   	pop    %ebp
+f010a0d4:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f010a0d5:	50                   	push   %eax
+f010a0d6:	68 24 be 10 f0       	push   $0xf010be24
+f010a0db:	6a 2d                	push   $0x2d
+f010a0dd:	68 2b e3 10 f0       	push   $0xf010e32b
+f010a0e2:	e8 5c 5f ff ff       	call   f0100043 <_panic>
+		panic("pa2page called with invalid pa");
+f010a0e7:	83 ec 04             	sub    $0x4,%esp
+f010a0ea:	68 68 c6 10 f0       	push   $0xf010c668
+f010a0ef:	68 9d 00 00 00       	push   $0x9d
+f010a0f4:	68 95 ce 10 f0       	push   $0xf010ce95
+f010a0f9:	e8 45 5f ff ff       	call   f0100043 <_panic>
+
+f010a0fe <shm_create>:
+//	-E_EXISTS if a segment of that name exists.
+//	-E_NO_MEM if out of memory or segment slots.
+//
+int
+shm_create(const char *name, size_t npages)
+{
+f010a0fe:	55                   	push   %ebp
+f010a0ff:	89 e5                	mov    %esp,%ebp
+f010a101:	57                   	push   %edi
+f010a102:	56                   	push   %esi
+f010a103:	53                   	push   %ebx
+f010a104:	83 ec 0c             	sub    $0xc,%esp
+f010a107:	8b 7d 08             	mov    0x8(%ebp),%edi
+	struct shm_seg *ss, *free = NULL;
+	struct PageInfo *pp;
+
+	if (!name[0] || npages == 0 || npages > SHM_MAXPAGES)
+f010a10a:	80 3f 00             	cmpb   $0x0,(%edi)
+f010a10d:	0f 84 10 01 00 00    	je     f010a223 <shm_create+0x125>
+f010a113:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010a116:	83 e8 01             	sub    $0x1,%eax
+f010a119:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+f010a11e:	0f 87 09 01 00 00    	ja     f010a22d <shm_create+0x12f>
+	struct shm_seg *ss, *free = NULL;
+f010a124:	be 00 00 00 00       	mov    $0x0,%esi
+		return -E_INVAL;
+	for (ss = shm_segs; ss < shm_segs + SHM_NSEGS; ss++) {
+f010a129:	bb 20 a5 7d f0       	mov    $0xf07da520,%ebx
+f010a12e:	eb 29                	jmp    f010a159 <shm_create+0x5b>
+		if (ss->ss_name[0] && strcmp(ss->ss_name, name) == 0)
+f010a130:	83 ec 08             	sub    $0x8,%esp
+f010a133:	57                   	push   %edi
+f010a134:	53                   	push   %ebx
+f010a135:	e8 61 e3 ff ff       	call   f010849b <strcmp>
+f010a13a:	83 c4 10             	add    $0x10,%esp
+f010a13d:	85 c0                	test   %eax,%eax
+f010a13f:	75 1d                	jne    f010a15e <shm_create+0x60>
+			return -E_EXISTS;
+f010a141:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+		pp->pp_ref++;
+		ss->ss_pages[ss->ss_npages] = pp;
+	}
+	strncpy(ss->ss_name, name, SHM_NAMELEN - 1);
+	return 0;
+}
+f010a146:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010a149:	5b                   	pop    %ebx
+f010a14a:	5e                   	pop    %esi
+f010a14b:	5f                   	pop    %edi
+f010a14c:	5d                   	pop    %ebp
+f010a14d:	c3                   	ret
+	for (ss = shm_segs; ss < shm_segs + SHM_NSEGS; ss++) {
+f010a14e:	83 c3 28             	add    $0x28,%ebx
+f010a151:	81 fb 20 aa 7d f0    	cmp    $0xf07daa20,%ebx
+f010a157:	74 11                	je     f010a16a <shm_create+0x6c>
+		if (ss->ss_name[0] && strcmp(ss->ss_name, name) == 0)
+f010a159:	80 3b 00             	cmpb   $0x0,(%ebx)
+f010a15c:	75 d2                	jne    f010a130 <shm_create+0x32>
+		if (!ss->ss_name[0] && !free)
+f010a15e:	80 3b 00             	cmpb   $0x0,(%ebx)
+f010a161:	75 eb                	jne    f010a14e <shm_create+0x50>
+f010a163:	85 f6                	test   %esi,%esi
+f010a165:	0f 44 f3             	cmove  %ebx,%esi
+f010a168:	eb e4                	jmp    f010a14e <shm_create+0x50>
+	if (!free || !(pp = page_alloc(ALLOC_ZERO)))
+f010a16a:	85 f6                	test   %esi,%esi
+f010a16c:	0f 84 c5 00 00 00    	je     f010a237 <shm_create+0x139>
+f010a172:	83 ec 0c             	sub    $0xc,%esp
+f010a175:	6a 01                	push   $0x1
+f010a177:	e8 69 70 ff ff       	call   f01011e5 <page_alloc>
+f010a17c:	83 c4 10             	add    $0x10,%esp
+f010a17f:	85 c0                	test   %eax,%eax
+f010a181:	0f 84 ba 00 00 00    	je     f010a241 <shm_create+0x143>
+	pp->pp_ref++;
+f010a187:	66 83 40 04 01       	addw   $0x1,0x4(%eax)
+	return (pp - pages) << PGSHIFT;
+f010a18c:	2b 05 68 47 79 f0    	sub    0xf0794768,%eax
+f010a192:	c1 f8 03             	sar    $0x3,%eax
+f010a195:	89 c2                	mov    %eax,%edx
+f010a197:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f010a19a:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f010a19f:	3b 05 74 47 79 f0    	cmp    0xf0794774,%eax
+f010a1a5:	73 3d                	jae    f010a1e4 <shm_create+0xe6>
+	return (void *)(pa + KERNBASE);
+f010a1a7:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f010a1ad:	89 56 20             	mov    %edx,0x20(%esi)
+	for (ss->ss_npages = 0; ss->ss_npages < npages; ss->ss_npages++) {
+f010a1b0:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a1b5:	89 46 24             	mov    %eax,0x24(%esi)
+f010a1b8:	3b 45 0c             	cmp    0xc(%ebp),%eax
+f010a1bb:	73 4d                	jae    f010a20a <shm_create+0x10c>
+		if (!(pp = page_alloc(ALLOC_ZERO))) {
+f010a1bd:	83 ec 0c             	sub    $0xc,%esp
+f010a1c0:	6a 01                	push   $0x1
+f010a1c2:	e8 1e 70 ff ff       	call   f01011e5 <page_alloc>
+f010a1c7:	83 c4 10             	add    $0x10,%esp
+f010a1ca:	85 c0                	test   %eax,%eax
+f010a1cc:	74 2b                	je     f010a1f9 <shm_create+0xfb>
+		pp->pp_ref++;
+f010a1ce:	66 83 40 04 01       	addw   $0x1,0x4(%eax)
+		ss->ss_pages[ss->ss_npages] = pp;
+f010a1d3:	8b 4e 24             	mov    0x24(%esi),%ecx
+f010a1d6:	8b 56 20             	mov    0x20(%esi),%edx
+f010a1d9:	89 04 8a             	mov    %eax,(%edx,%ecx,4)
+	for (ss->ss_npages = 0; ss->ss_npages < npages; ss->ss_npages++) {
+f010a1dc:	8b 46 24             	mov    0x24(%esi),%eax
+f010a1df:	83 c0 01             	add    $0x1,%eax
+f010a1e2:	eb d1                	jmp    f010a1b5 <shm_create+0xb7>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f010a1e4:	52                   	push   %edx
+f010a1e5:	68 90 be 10 f0       	push   $0xf010be90
+f010a1ea:	68 a4 00 00 00       	push   $0xa4
+f010a1ef:	68 95 ce 10 f0       	push   $0xf010ce95
+f010a1f4:	e8 4a 5e ff ff       	call   f0100043 <_panic>
+			shm_release(ss);
+f010a1f9:	89 f0                	mov    %esi,%eax
+f010a1fb:	e8 6b fe ff ff       	call   f010a06b <shm_release>
+			return -E_NO_MEM;
+f010a200:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f010a205:	e9 3c ff ff ff       	jmp    f010a146 <shm_create+0x48>
+	strncpy(ss->ss_name, name, SHM_NAMELEN - 1);
+f010a20a:	83 ec 04             	sub    $0x4,%esp
+f010a20d:	6a 1f                	push   $0x1f
+f010a20f:	57                   	push   %edi
+f010a210:	56                   	push   %esi
+f010a211:	e8 1d e2 ff ff       	call   f0108433 <strncpy>
+	return 0;
+f010a216:	83 c4 10             	add    $0x10,%esp
+f010a219:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a21e:	e9 23 ff ff ff       	jmp    f010a146 <shm_create+0x48>
+		return -E_INVAL;
+f010a223:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010a228:	e9 19 ff ff ff       	jmp    f010a146 <shm_create+0x48>
+f010a22d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010a232:	e9 0f ff ff ff       	jmp    f010a146 <shm_create+0x48>
+		return -E_NO_MEM;
+f010a237:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f010a23c:	e9 05 ff ff ff       	jmp    f010a146 <shm_create+0x48>
+f010a241:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f010a246:	e9 fb fe ff ff       	jmp    f010a146 <shm_create+0x48>
+
+f010a24b <shm_attach>:
+//		many mappings.
+// On error nothing is mapped and e's mappings are as they were.
+//
+int
+shm_attach(struct Env *e, const char *name, void *va, int perm)
+{
+f010a24b:	55                   	push   %ebp
+f010a24c:	89 e5                	mov    %esp,%ebp
+f010a24e:	57                   	push   %edi
+f010a24f:	56                   	push   %esi
+f010a250:	53                   	push   %ebx
+f010a251:	83 ec 1c             	sub    $0x1c,%esp
+f010a254:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct shm_seg *ss;
+	uintptr_t start = (uintptr_t) va;
+f010a257:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+	size_t i;
+	int r;
+
+	if (!(ss = shm_lookup(name)))
+f010a25a:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010a25d:	e8 ca fd ff ff       	call   f010a02c <shm_lookup>
+f010a262:	85 c0                	test   %eax,%eax
+f010a264:	0f 84 fc 00 00 00    	je     f010a366 <shm_attach+0x11b>
+f010a26a:	89 c7                	mov    %eax,%edi
+		return -E_NOT_FOUND;
+	if (PGOFF(start) || start >= UTOP
+f010a26c:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+f010a272:	0f 85 f5 00 00 00    	jne    f010a36d <shm_attach+0x122>
+f010a278:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+f010a27e:	0f 87 e9 00 00 00    	ja     f010a36d <shm_attach+0x122>
+	    || ss->ss_npages > (UTOP - start) / PGSIZE)
+f010a284:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+f010a289:	29 d8                	sub    %ebx,%eax
+f010a28b:	c1 e8 0c             	shr    $0xc,%eax
+f010a28e:	3b 47 24             	cmp    0x24(%edi),%eax
+f010a291:	0f 82 dd 00 00 00    	jb     f010a374 <shm_attach+0x129>
+		return -E_INVAL;
+	if ((perm & (PTE_U | PTE_P)) != (PTE_U | PTE_P)
+f010a297:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a29a:	83 e0 05             	and    $0x5,%eax
+f010a29d:	83 f8 05             	cmp    $0x5,%eax
+f010a2a0:	0f 85 d5 00 00 00    	jne    f010a37b <shm_attach+0x130>
+	    || (perm & ~(PTE_U | PTE_P | PTE_W)))
+f010a2a6:	83 7d 14 07          	cmpl   $0x7,0x14(%ebp)
+f010a2aa:	0f 87 d2 00 00 00    	ja     f010a382 <shm_attach+0x137>
+		return -E_INVAL;
+
+	// Check the whole range and make its page tables before mapping
+	// anything, so that no page_insert below can fail halfway.
+	for (i = 0; i < ss->ss_npages; i++) {
+f010a2b0:	be 00 00 00 00       	mov    $0x0,%esi
+f010a2b5:	3b 77 24             	cmp    0x24(%edi),%esi
+f010a2b8:	73 55                	jae    f010a30f <shm_attach+0xc4>
+		if (page_lookup(e->env_pgdir, (void *) (start + i * PGSIZE),
+f010a2ba:	83 ec 04             	sub    $0x4,%esp
+f010a2bd:	6a 00                	push   $0x0
+f010a2bf:	53                   	push   %ebx
+f010a2c0:	8b 45 08             	mov    0x8(%ebp),%eax
+f010a2c3:	ff 70 60             	push   0x60(%eax)
+f010a2c6:	e8 bf 75 ff ff       	call   f010188a <page_lookup>
+f010a2cb:	83 c4 10             	add    $0x10,%esp
+f010a2ce:	85 c0                	test   %eax,%eax
+f010a2d0:	0f 85 b3 00 00 00    	jne    f010a389 <shm_attach+0x13e>
+				NULL))
+			return -E_INVAL;
+		if (!pgdir_walk(e->env_pgdir, (void *) (start + i * PGSIZE), 1)
+f010a2d6:	83 ec 04             	sub    $0x4,%esp
+f010a2d9:	6a 01                	push   $0x1
+f010a2db:	53                   	push   %ebx
+f010a2dc:	8b 45 08             	mov    0x8(%ebp),%eax
+f010a2df:	ff 70 60             	push   0x60(%eax)
+f010a2e2:	e8 5c 74 ff ff       	call   f0101743 <pgdir_walk>
+f010a2e7:	83 c4 10             	add    $0x10,%esp
+f010a2ea:	85 c0                	test   %eax,%eax
+f010a2ec:	0f 84 a4 00 00 00    	je     f010a396 <shm_attach+0x14b>
+		    || ss->ss_pages[i]->pp_ref >= PAGE_MAXREF)
+f010a2f2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f010a2f8:	8b 47 20             	mov    0x20(%edi),%eax
+f010a2fb:	8b 04 b0             	mov    (%eax,%esi,4),%eax
+f010a2fe:	66 81 78 04 ff fe    	cmpw   $0xfeff,0x4(%eax)
+f010a304:	0f 87 93 00 00 00    	ja     f010a39d <shm_attach+0x152>
+	for (i = 0; i < ss->ss_npages; i++) {
+f010a30a:	83 c6 01             	add    $0x1,%esi
+f010a30d:	eb a6                	jmp    f010a2b5 <shm_attach+0x6a>
+			return -E_NO_MEM;
+	}
+
+	for (i = 0; i < ss->ss_npages; i++)
+f010a30f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if ((r = page_insert(e->env_pgdir, ss->ss_pages[i],
+f010a314:	8b 75 14             	mov    0x14(%ebp),%esi
+f010a317:	81 ce 00 04 00 00    	or     $0x400,%esi
+f010a31d:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+f010a320:	8b 75 e0             	mov    -0x20(%ebp),%esi
+f010a323:	eb 03                	jmp    f010a328 <shm_attach+0xdd>
+	for (i = 0; i < ss->ss_npages; i++)
+f010a325:	83 c3 01             	add    $0x1,%ebx
+f010a328:	8b 47 24             	mov    0x24(%edi),%eax
+f010a32b:	39 c3                	cmp    %eax,%ebx
+f010a32d:	73 5f                	jae    f010a38e <shm_attach+0x143>
+		if ((r = page_insert(e->env_pgdir, ss->ss_pages[i],
+f010a32f:	ff 75 e4             	push   -0x1c(%ebp)
+f010a332:	56                   	push   %esi
+f010a333:	8b 47 20             	mov    0x20(%edi),%eax
+f010a336:	ff 34 98             	push   (%eax,%ebx,4)
+f010a339:	8b 45 08             	mov    0x8(%ebp),%eax
+f010a33c:	ff 70 60             	push   0x60(%eax)
+f010a33f:	e8 06 77 ff ff       	call   f0101a4a <page_insert>
+f010a344:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f010a34a:	83 c4 10             	add    $0x10,%esp
+f010a34d:	85 c0                	test   %eax,%eax
+f010a34f:	79 d4                	jns    f010a325 <shm_attach+0xda>
+				     (void *) (start + i * PGSIZE),
+				     perm | PTE_SHARE)) < 0)
+			panic("shm_attach: prepared insert failed: %e", r);
+f010a351:	50                   	push   %eax
+f010a352:	68 04 e3 10 f0       	push   $0xf010e304
+f010a357:	68 85 00 00 00       	push   $0x85
+f010a35c:	68 2b e3 10 f0       	push   $0xf010e32b
+f010a361:	e8 dd 5c ff ff       	call   f0100043 <_panic>
+		return -E_NOT_FOUND;
+f010a366:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+f010a36b:	eb 21                	jmp    f010a38e <shm_attach+0x143>
+		return -E_INVAL;
+f010a36d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010a372:	eb 1a                	jmp    f010a38e <shm_attach+0x143>
+f010a374:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010a379:	eb 13                	jmp    f010a38e <shm_attach+0x143>
+		return -E_INVAL;
+f010a37b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010a380:	eb 0c                	jmp    f010a38e <shm_attach+0x143>
+f010a382:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010a387:	eb 05                	jmp    f010a38e <shm_attach+0x143>
+			return -E_INVAL;
+f010a389:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+	return ss->ss_npages;
+}
+f010a38e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010a391:	5b                   	pop    %ebx
+f010a392:	5e                   	pop    %esi
+f010a393:	5f                   	pop    %edi
+f010a394:	5d                   	pop    %ebp
+f010a395:	c3                   	ret
+			return -E_NO_MEM;
+f010a396:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f010a39b:	eb f1                	jmp    f010a38e <shm_attach+0x143>
+f010a39d:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f010a3a2:	eb ea                	jmp    f010a38e <shm_attach+0x143>
+
+f010a3a4 <shm_detach>:
+//	-E_NOT_FOUND if there is no segment of that name.
+//	-E_INVAL if va is not page-aligned or not below UTOP.
+//
+int
+shm_detach(struct Env *e, const char *name, void *va)
+{
+f010a3a4:	55                   	push   %ebp
+f010a3a5:	89 e5                	mov    %esp,%ebp
+f010a3a7:	57                   	push   %edi
+f010a3a8:	56                   	push   %esi
+f010a3a9:	53                   	push   %ebx
+f010a3aa:	83 ec 0c             	sub    $0xc,%esp
+f010a3ad:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct shm_seg *ss;
+	uintptr_t start = (uintptr_t) va;
+	size_t i;
+
+	if (!(ss = shm_lookup(name)))
+f010a3b0:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010a3b3:	e8 74 fc ff ff       	call   f010a02c <shm_lookup>
+f010a3b8:	85 c0                	test   %eax,%eax
+f010a3ba:	74 68                	je     f010a424 <shm_detach+0x80>
+f010a3bc:	89 f3                	mov    %esi,%ebx
+f010a3be:	89 c7                	mov    %eax,%edi
+		return -E_NOT_FOUND;
+	if (PGOFF(start) || start >= UTOP)
+f010a3c0:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+f010a3c6:	75 63                	jne    f010a42b <shm_detach+0x87>
+f010a3c8:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+f010a3ce:	77 5b                	ja     f010a42b <shm_detach+0x87>
+		return -E_INVAL;
+	for (i = 0; i < ss->ss_npages && start + i * PGSIZE < UTOP; i++)
+f010a3d0:	be 00 00 00 00       	mov    $0x0,%esi
+f010a3d5:	eb 09                	jmp    f010a3e0 <shm_detach+0x3c>
+f010a3d7:	83 c6 01             	add    $0x1,%esi
+f010a3da:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f010a3e0:	3b 77 24             	cmp    0x24(%edi),%esi
+f010a3e3:	73 4d                	jae    f010a432 <shm_detach+0x8e>
+f010a3e5:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+f010a3eb:	77 30                	ja     f010a41d <shm_detach+0x79>
+		if (page_lookup(e->env_pgdir, (void *) (start + i * PGSIZE), NULL)
+f010a3ed:	83 ec 04             	sub    $0x4,%esp
+f010a3f0:	6a 00                	push   $0x0
+f010a3f2:	53                   	push   %ebx
+f010a3f3:	8b 45 08             	mov    0x8(%ebp),%eax
+f010a3f6:	ff 70 60             	push   0x60(%eax)
+f010a3f9:	e8 8c 74 ff ff       	call   f010188a <page_lookup>
+		    == ss->ss_pages[i])
+f010a3fe:	8b 57 20             	mov    0x20(%edi),%edx
+		if (page_lookup(e->env_pgdir, (void *) (start + i * PGSIZE), NULL)
+f010a401:	83 c4 10             	add    $0x10,%esp
+f010a404:	39 04 b2             	cmp    %eax,(%edx,%esi,4)
+f010a407:	75 ce                	jne    f010a3d7 <shm_detach+0x33>
+			page_remove(e->env_pgdir, (void *) (start + i * PGSIZE));
+f010a409:	83 ec 08             	sub    $0x8,%esp
+f010a40c:	53                   	push   %ebx
+f010a40d:	8b 45 08             	mov    0x8(%ebp),%eax
+f010a410:	ff 70 60             	push   0x60(%eax)
+f010a413:	e8 af 75 ff ff       	call   f01019c7 <page_remove>
+f010a418:	83 c4 10             	add    $0x10,%esp
+f010a41b:	eb ba                	jmp    f010a3d7 <shm_detach+0x33>
+	return 0;
+f010a41d:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a422:	eb 13                	jmp    f010a437 <shm_detach+0x93>
+		return -E_NOT_FOUND;
+f010a424:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+f010a429:	eb 0c                	jmp    f010a437 <shm_detach+0x93>
+		return -E_INVAL;
+f010a42b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010a430:	eb 05                	jmp    f010a437 <shm_detach+0x93>
+	return 0;
+f010a432:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f010a437:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010a43a:	5b                   	pop    %ebx
+f010a43b:	5e                   	pop    %esi
+f010a43c:	5f                   	pop    %edi
+f010a43d:	5d                   	pop    %ebp
+f010a43e:	c3                   	ret
+
+f010a43f <shm_remove>:
+// it until they detach; the name can be reused right away.
+// Returns 0 on success, -E_NOT_FOUND if there is no such segment.
+//
+int
+shm_remove(const char *name)
+{
+f010a43f:	55                   	push   %ebp
+f010a440:	89 e5                	mov    %esp,%ebp
+f010a442:	83 ec 08             	sub    $0x8,%esp
+	struct shm_seg *ss;
+
+	if (!(ss = shm_lookup(name)))
+f010a445:	8b 45 08             	mov    0x8(%ebp),%eax
+f010a448:	e8 df fb ff ff       	call   f010a02c <shm_lookup>
+f010a44d:	85 c0                	test   %eax,%eax
+f010a44f:	74 0c                	je     f010a45d <shm_remove+0x1e>
+		return -E_NOT_FOUND;
+	shm_release(ss);
+f010a451:	e8 15 fc ff ff       	call   f010a06b <shm_release>
+	return 0;
+f010a456:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f010a45b:	c9                   	leave
+f010a45c:	c3                   	ret
+		return -E_NOT_FOUND;
+f010a45d:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+f010a462:	eb f7                	jmp    f010a45b <shm_remove+0x1c>
+
+f010a464 <ipc_transfer>:
+// is delivered or, on error, none is and dst is unchanged.  The caller
+// decides how dst gets to run again.
+static int
+ipc_transfer(struct Env *src, struct Env *dst, const struct ipc_msg *msg,
+	     void *srcva, size_t npages, unsigned perm)
+{
+f010a464:	55                   	push   %ebp
+f010a465:	89 e5                	mov    %esp,%ebp
+f010a467:	57                   	push   %edi
+f010a468:	56                   	push   %esi
+f010a469:	53                   	push   %ebx
+f010a46a:	83 ec 3c             	sub    $0x3c,%esp
+f010a46d:	89 c3                	mov    %eax,%ebx
+f010a46f:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t i, n;
+	int r;
+
+	if ((uintptr_t) srcva < UTOP && (uintptr_t) dst->env_ipc_dstva < UTOP) {
+f010a472:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+f010a475:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+f010a47b:	0f 87 46 02 00 00    	ja     f010a6c7 <ipc_transfer+0x263>
+f010a481:	8b 7a 7c             	mov    0x7c(%edx),%edi
+f010a484:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a489:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+f010a490:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+f010a496:	0f 87 37 02 00 00    	ja     f010a6d3 <ipc_transfer+0x26f>
+		n = MIN(npages, dst->env_ipc_dstnpages);
+f010a49c:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+f010a4a2:	39 45 0c             	cmp    %eax,0xc(%ebp)
+f010a4a5:	0f 46 45 0c          	cmovbe 0xc(%ebp),%eax
+f010a4a9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	for (i = 0; i < n; i++) {
+f010a4ac:	89 75 d0             	mov    %esi,-0x30(%ebp)
+f010a4af:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+		if (!(perm & PAGE_MOVE) && pp->pp_ref > PAGE_MAXREF - n)
+f010a4b6:	b8 00 ff 00 00       	mov    $0xff00,%eax
+f010a4bb:	89 c6                	mov    %eax,%esi
+f010a4bd:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f010a4c0:	29 c6                	sub    %eax,%esi
+f010a4c2:	89 75 c0             	mov    %esi,-0x40(%ebp)
+f010a4c5:	8b 75 d0             	mov    -0x30(%ebp),%esi
+f010a4c8:	89 55 c8             	mov    %edx,-0x38(%ebp)
+f010a4cb:	89 4d bc             	mov    %ecx,-0x44(%ebp)
+	for (i = 0; i < n; i++) {
+f010a4ce:	eb 6e                	jmp    f010a53e <ipc_transfer+0xda>
+		if (!(perm & PAGE_MOVE) && (perm & PTE_W)
+f010a4d0:	8b 45 10             	mov    0x10(%ebp),%eax
+f010a4d3:	25 02 20 00 00       	and    $0x2002,%eax
+f010a4d8:	83 f8 02             	cmp    $0x2,%eax
+f010a4db:	0f 84 c1 00 00 00    	je     f010a5a2 <ipc_transfer+0x13e>
+		if (!(pp = page_lookup(src->env_pgdir, va, NULL)))
+f010a4e1:	83 ec 04             	sub    $0x4,%esp
+f010a4e4:	6a 00                	push   $0x0
+f010a4e6:	ff 75 d0             	push   -0x30(%ebp)
+f010a4e9:	ff 73 60             	push   0x60(%ebx)
+f010a4ec:	e8 99 73 ff ff       	call   f010188a <page_lookup>
+f010a4f1:	83 c4 10             	add    $0x10,%esp
+f010a4f4:	85 c0                	test   %eax,%eax
+f010a4f6:	0f 84 33 02 00 00    	je     f010a72f <ipc_transfer+0x2cb>
+		if (!(perm & PAGE_MOVE) && pp->pp_ref > PAGE_MAXREF - n)
+f010a4fc:	f7 45 10 00 20 00 00 	testl  $0x2000,0x10(%ebp)
+f010a503:	75 0d                	jne    f010a512 <ipc_transfer+0xae>
+f010a505:	0f b7 40 04          	movzwl 0x4(%eax),%eax
+f010a509:	39 45 c0             	cmp    %eax,-0x40(%ebp)
+f010a50c:	0f 82 24 02 00 00    	jb     f010a736 <ipc_transfer+0x2d2>
+		if (!pgdir_walk(dst->env_pgdir, dstva + i * PGSIZE, 1))
+f010a512:	83 ec 04             	sub    $0x4,%esp
+f010a515:	6a 01                	push   $0x1
+f010a517:	57                   	push   %edi
+f010a518:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f010a51b:	ff 70 60             	push   0x60(%eax)
+f010a51e:	e8 20 72 ff ff       	call   f0101743 <pgdir_walk>
+f010a523:	81 c7 00 10 00 00    	add    $0x1000,%edi
+f010a529:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f010a52f:	83 c4 10             	add    $0x10,%esp
+f010a532:	85 c0                	test   %eax,%eax
+f010a534:	0f 84 03 02 00 00    	je     f010a73d <ipc_transfer+0x2d9>
+	for (i = 0; i < n; i++) {
+f010a53a:	83 45 cc 01          	addl   $0x1,-0x34(%ebp)
+f010a53e:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+f010a541:	39 4d d4             	cmp    %ecx,-0x2c(%ebp)
+f010a544:	0f 84 ba 00 00 00    	je     f010a604 <ipc_transfer+0x1a0>
+		va = srcva + i * PGSIZE;
+f010a54a:	89 75 d0             	mov    %esi,-0x30(%ebp)
+		if ((r = pgdir_unshare(src->env_pgdir, va)) < 0)
+f010a54d:	83 ec 08             	sub    $0x8,%esp
+f010a550:	56                   	push   %esi
+f010a551:	ff 73 60             	push   0x60(%ebx)
+f010a554:	e8 59 70 ff ff       	call   f01015b2 <pgdir_unshare>
+f010a559:	83 c4 10             	add    $0x10,%esp
+f010a55c:	85 c0                	test   %eax,%eax
+f010a55e:	0f 88 bc 01 00 00    	js     f010a720 <ipc_transfer+0x2bc>
+		if (!page_lookup(src->env_pgdir, va, &pte))
+f010a564:	83 ec 04             	sub    $0x4,%esp
+f010a567:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f010a56a:	50                   	push   %eax
+f010a56b:	56                   	push   %esi
+f010a56c:	ff 73 60             	push   0x60(%ebx)
+f010a56f:	e8 16 73 ff ff       	call   f010188a <page_lookup>
+f010a574:	83 c4 10             	add    $0x10,%esp
+f010a577:	85 c0                	test   %eax,%eax
+f010a579:	0f 84 a9 01 00 00    	je     f010a728 <ipc_transfer+0x2c4>
+		if ((perm & PTE_W) && !(*pte & (PTE_W | PTE_COW)))
+f010a57f:	f6 45 10 02          	testb  $0x2,0x10(%ebp)
+f010a583:	0f 84 47 ff ff ff    	je     f010a4d0 <ipc_transfer+0x6c>
+f010a589:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f010a58c:	f7 00 02 08 00 00    	testl  $0x802,(%eax)
+f010a592:	0f 85 38 ff ff ff    	jne    f010a4d0 <ipc_transfer+0x6c>
+			return -E_INVAL;
+f010a598:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010a59d:	e9 7e 01 00 00       	jmp    f010a720 <ipc_transfer+0x2bc>
+	if ((r = pgdir_unshare(e->env_pgdir, va)) < 0)
+f010a5a2:	83 ec 08             	sub    $0x8,%esp
+f010a5a5:	ff 75 d0             	push   -0x30(%ebp)
+f010a5a8:	ff 73 60             	push   0x60(%ebx)
+f010a5ab:	e8 02 70 ff ff       	call   f01015b2 <pgdir_unshare>
+f010a5b0:	83 c4 10             	add    $0x10,%esp
+f010a5b3:	85 c0                	test   %eax,%eax
+f010a5b5:	0f 88 65 01 00 00    	js     f010a720 <ipc_transfer+0x2bc>
+	if (page_lookup(e->env_pgdir, va, &pte) && (*pte & PTE_COW))
+f010a5bb:	83 ec 04             	sub    $0x4,%esp
+f010a5be:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f010a5c1:	50                   	push   %eax
+f010a5c2:	ff 75 d0             	push   -0x30(%ebp)
+f010a5c5:	ff 73 60             	push   0x60(%ebx)
+f010a5c8:	e8 bd 72 ff ff       	call   f010188a <page_lookup>
+f010a5cd:	83 c4 10             	add    $0x10,%esp
+f010a5d0:	85 c0                	test   %eax,%eax
+f010a5d2:	0f 84 09 ff ff ff    	je     f010a4e1 <ipc_transfer+0x7d>
+f010a5d8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010a5db:	8b 00                	mov    (%eax),%eax
+f010a5dd:	f6 c4 08             	test   $0x8,%ah
+f010a5e0:	0f 84 fb fe ff ff    	je     f010a4e1 <ipc_transfer+0x7d>
+		return page_cow_break(e->env_pgdir, va);
+f010a5e6:	83 ec 08             	sub    $0x8,%esp
+f010a5e9:	ff 75 d0             	push   -0x30(%ebp)
+f010a5ec:	ff 73 60             	push   0x60(%ebx)
+f010a5ef:	e8 8a 75 ff ff       	call   f0101b7e <page_cow_break>
+		    && (r = ipc_make_writable(src, va)) < 0)
+f010a5f4:	83 c4 10             	add    $0x10,%esp
+f010a5f7:	85 c0                	test   %eax,%eax
+f010a5f9:	0f 89 e2 fe ff ff    	jns    f010a4e1 <ipc_transfer+0x7d>
+f010a5ff:	e9 1c 01 00 00       	jmp    f010a720 <ipc_transfer+0x2bc>
+f010a604:	8b 55 c8             	mov    -0x38(%ebp),%edx
+f010a607:	8b 4d bc             	mov    -0x44(%ebp),%ecx
+		if ((r = ipc_prepare(src, srcva, dst, dst->env_ipc_dstva,
+				     n, perm)) < 0)
+			return r;
+		for (i = 0; i < n; i++)
+f010a60a:	be 00 00 00 00       	mov    $0x0,%esi
+	if (perm & PAGE_MOVE)
+f010a60f:	8b 45 10             	mov    0x10(%ebp),%eax
+f010a612:	25 00 20 00 00       	and    $0x2000,%eax
+f010a617:	89 45 c8             	mov    %eax,-0x38(%ebp)
+		return page_move(src->env_pgdir, srcva, dst->env_pgdir, dstva,
+f010a61a:	8b 45 10             	mov    0x10(%ebp),%eax
+f010a61d:	80 e4 df             	and    $0xdf,%ah
+f010a620:	89 45 c0             	mov    %eax,-0x40(%ebp)
+f010a623:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+f010a626:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+f010a629:	89 55 d0             	mov    %edx,-0x30(%ebp)
+f010a62c:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+f010a62f:	eb 26                	jmp    f010a657 <ipc_transfer+0x1f3>
+f010a631:	83 ec 0c             	sub    $0xc,%esp
+f010a634:	ff 75 c0             	push   -0x40(%ebp)
+f010a637:	53                   	push   %ebx
+f010a638:	ff 70 60             	push   0x60(%eax)
+f010a63b:	57                   	push   %edi
+f010a63c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f010a63f:	ff 70 60             	push   0x60(%eax)
+f010a642:	e8 10 77 ff ff       	call   f0101d57 <page_move>
+f010a647:	83 c4 20             	add    $0x20,%esp
+			if ((r = ipc_map(src, srcva + i * PGSIZE, dst,
+f010a64a:	81 c7 00 10 00 00    	add    $0x1000,%edi
+f010a650:	85 c0                	test   %eax,%eax
+f010a652:	78 4d                	js     f010a6a1 <ipc_transfer+0x23d>
+		for (i = 0; i < n; i++)
+f010a654:	83 c6 01             	add    $0x1,%esi
+f010a657:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f010a65a:	39 c6                	cmp    %eax,%esi
+f010a65c:	74 58                	je     f010a6b6 <ipc_transfer+0x252>
+			if ((r = ipc_map(src, srcva + i * PGSIZE, dst,
+f010a65e:	89 f3                	mov    %esi,%ebx
+f010a660:	c1 e3 0c             	shl    $0xc,%ebx
+f010a663:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f010a666:	03 58 7c             	add    0x7c(%eax),%ebx
+	if (perm & PAGE_MOVE)
+f010a669:	83 7d c8 00          	cmpl   $0x0,-0x38(%ebp)
+f010a66d:	75 c2                	jne    f010a631 <ipc_transfer+0x1cd>
+	if (!(pp = page_lookup(src->env_pgdir, srcva, NULL)))
+f010a66f:	83 ec 04             	sub    $0x4,%esp
+f010a672:	6a 00                	push   $0x0
+f010a674:	57                   	push   %edi
+f010a675:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f010a678:	ff 70 60             	push   0x60(%eax)
+f010a67b:	e8 0a 72 ff ff       	call   f010188a <page_lookup>
+f010a680:	83 c4 10             	add    $0x10,%esp
+f010a683:	85 c0                	test   %eax,%eax
+f010a685:	74 15                	je     f010a69c <ipc_transfer+0x238>
+	return page_insert(dst->env_pgdir, pp, dstva, perm);
+f010a687:	ff 75 10             	push   0x10(%ebp)
+f010a68a:	53                   	push   %ebx
+f010a68b:	50                   	push   %eax
+f010a68c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f010a68f:	ff 70 60             	push   0x60(%eax)
+f010a692:	e8 b3 73 ff ff       	call   f0101a4a <page_insert>
+f010a697:	83 c4 10             	add    $0x10,%esp
+f010a69a:	eb ae                	jmp    f010a64a <ipc_transfer+0x1e6>
+		return -E_INVAL;
+f010a69c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+					 dst->env_ipc_dstva + i * PGSIZE,
+					 perm)) < 0)
+				panic("ipc_transfer: prepared map failed: %e", r);
+f010a6a1:	50                   	push   %eax
+f010a6a2:	68 38 e3 10 f0       	push   $0xf010e338
+f010a6a7:	68 bd 00 00 00       	push   $0xbd
+f010a6ac:	68 5e e3 10 f0       	push   $0xf010e35e
+f010a6b1:	e8 8d 59 ff ff       	call   f0100043 <_panic>
+		dst->env_ipc_perm = perm & ~PAGE_MOVE;
+f010a6b6:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+f010a6b9:	8b 55 d0             	mov    -0x30(%ebp),%edx
+f010a6bc:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+f010a6bf:	8b 45 10             	mov    0x10(%ebp),%eax
+f010a6c2:	80 e4 df             	and    $0xdf,%ah
+		dst->env_ipc_npages = n;
+f010a6c5:	eb 0c                	jmp    f010a6d3 <ipc_transfer+0x26f>
+f010a6c7:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a6cc:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+		dst->env_ipc_perm = perm & ~PAGE_MOVE;
+f010a6d3:	89 82 9c 00 00 00    	mov    %eax,0x9c(%edx)
+		dst->env_ipc_npages = n;
+f010a6d9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f010a6dc:	89 82 a0 00 00 00    	mov    %eax,0xa0(%edx)
+	} else {
+		dst->env_ipc_perm = 0;
+		dst->env_ipc_npages = 0;
+	}
+	dst->env_ipc_recving = 0;
+f010a6e2:	c6 42 78 00          	movb   $0x0,0x78(%edx)
+	dst->env_ipc_from = src->env_id;
+f010a6e6:	8b 43 48             	mov    0x48(%ebx),%eax
+f010a6e9:	89 82 98 00 00 00    	mov    %eax,0x98(%edx)
+	dst->env_ipc_msg = *msg;
+f010a6ef:	8b 01                	mov    (%ecx),%eax
+f010a6f1:	89 82 84 00 00 00    	mov    %eax,0x84(%edx)
+f010a6f7:	8b 41 04             	mov    0x4(%ecx),%eax
+f010a6fa:	89 82 88 00 00 00    	mov    %eax,0x88(%edx)
+f010a700:	8b 41 08             	mov    0x8(%ecx),%eax
+f010a703:	89 82 8c 00 00 00    	mov    %eax,0x8c(%edx)
+f010a709:	8b 41 0c             	mov    0xc(%ecx),%eax
+f010a70c:	89 82 90 00 00 00    	mov    %eax,0x90(%edx)
+f010a712:	8b 41 10             	mov    0x10(%ecx),%eax
+f010a715:	89 82 94 00 00 00    	mov    %eax,0x94(%edx)
+	return 0;
+f010a71b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f010a720:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010a723:	5b                   	pop    %ebx
+f010a724:	5e                   	pop    %esi
+f010a725:	5f                   	pop    %edi
+f010a726:	5d                   	pop    %ebp
+f010a727:	c3                   	ret
+			return -E_INVAL;
+f010a728:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010a72d:	eb f1                	jmp    f010a720 <ipc_transfer+0x2bc>
+			return -E_INVAL;
+f010a72f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010a734:	eb ea                	jmp    f010a720 <ipc_transfer+0x2bc>
+			return -E_NO_MEM;
+f010a736:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f010a73b:	eb e3                	jmp    f010a720 <ipc_transfer+0x2bc>
+			return -E_NO_MEM;
+f010a73d:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f010a742:	eb dc                	jmp    f010a720 <ipc_transfer+0x2bc>
+
+f010a744 <ipc_take>:
+// Take the message of the first sender in e's queue whose transfer
+// succeeds.  A plain sender can run again; a caller keeps waiting for
+// e's reply.  Returns whether a message was taken.
+static bool
+ipc_take(struct Env *e)
+{
+f010a744:	55                   	push   %ebp
+f010a745:	89 e5                	mov    %esp,%ebp
+f010a747:	56                   	push   %esi
+f010a748:	53                   	push   %ebx
+f010a749:	89 c6                	mov    %eax,%esi
+	struct Env *s;
+	int r;
+
+	while ((s = ipc_dequeue(e))) {
+f010a74b:	eb 6d                	jmp    f010a7ba <ipc_take+0x76>
+		e->env_ipc_qlen--;
+f010a74d:	83 ae d4 00 00 00 01 	subl   $0x1,0xd4(%esi)
+		s->env_ipc_qnext = NULL;
+f010a754:	c7 83 ac 00 00 00 00 	movl   $0x0,0xac(%ebx)
+f010a75b:	00 00 00 
+		s->env_ipc_sendto = 0;
+f010a75e:	c7 83 b0 00 00 00 00 	movl   $0x0,0xb0(%ebx)
+f010a765:	00 00 00 
+		e->env_ipc_recving = 1;
+f010a768:	c6 46 78 01          	movb   $0x1,0x78(%esi)
+		r = ipc_transfer(s, e, &s->env_ipc_send_msg,
+f010a76c:	8d 8b b4 00 00 00    	lea    0xb4(%ebx),%ecx
+f010a772:	83 ec 04             	sub    $0x4,%esp
+f010a775:	ff b3 d0 00 00 00    	push   0xd0(%ebx)
+f010a77b:	ff b3 cc 00 00 00    	push   0xcc(%ebx)
+f010a781:	ff b3 c8 00 00 00    	push   0xc8(%ebx)
+f010a787:	89 f2                	mov    %esi,%edx
+f010a789:	89 d8                	mov    %ebx,%eax
+f010a78b:	e8 d4 fc ff ff       	call   f010a464 <ipc_transfer>
+f010a790:	89 c2                	mov    %eax,%edx
+				 s->env_ipc_send_srcva, s->env_ipc_send_npages,
+				 s->env_ipc_send_perm);
+		if (s->env_ipc_send_call && r == 0)
+f010a792:	83 c4 10             	add    $0x10,%esp
+f010a795:	85 c0                	test   %eax,%eax
+f010a797:	0f 94 c0             	sete   %al
+f010a79a:	22 83 e0 00 00 00    	and    0xe0(%ebx),%al
+f010a7a0:	75 51                	jne    f010a7f3 <ipc_take+0xaf>
+			return 1;
+		s->env_ipc_replyfrom = 0;
+f010a7a2:	c7 83 e4 00 00 00 00 	movl   $0x0,0xe4(%ebx)
+f010a7a9:	00 00 00 
+	e->env_tf.tf_regs.reg_eax = r;
+f010a7ac:	89 53 1c             	mov    %edx,0x1c(%ebx)
+	e->env_status = ENV_RUNNABLE;
+f010a7af:	c7 43 54 02 00 00 00 	movl   $0x2,0x54(%ebx)
+		ipc_wake(s, r);
+		if (r == 0)
+f010a7b6:	85 d2                	test   %edx,%edx
+f010a7b8:	74 2d                	je     f010a7e7 <ipc_take+0xa3>
+	struct Env *s = e->env_ipc_qhead;
+f010a7ba:	8b 9e a4 00 00 00    	mov    0xa4(%esi),%ebx
+	if (s) {
+f010a7c0:	85 db                	test   %ebx,%ebx
+f010a7c2:	74 2a                	je     f010a7ee <ipc_take+0xaa>
+		if (!(e->env_ipc_qhead = s->env_ipc_qnext))
+f010a7c4:	8b 83 ac 00 00 00    	mov    0xac(%ebx),%eax
+f010a7ca:	89 86 a4 00 00 00    	mov    %eax,0xa4(%esi)
+f010a7d0:	85 c0                	test   %eax,%eax
+f010a7d2:	0f 85 75 ff ff ff    	jne    f010a74d <ipc_take+0x9>
+			e->env_ipc_qtail = NULL;
+f010a7d8:	c7 86 a8 00 00 00 00 	movl   $0x0,0xa8(%esi)
+f010a7df:	00 00 00 
+f010a7e2:	e9 66 ff ff ff       	jmp    f010a74d <ipc_take+0x9>
+			return 1;
+f010a7e7:	b8 01 00 00 00       	mov    $0x1,%eax
+f010a7ec:	eb 05                	jmp    f010a7f3 <ipc_take+0xaf>
+	}
+	return 0;
+f010a7ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f010a7f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010a7f6:	5b                   	pop    %ebx
+f010a7f7:	5e                   	pop    %esi
+f010a7f8:	5d                   	pop    %ebp
+f010a7f9:	c3                   	ret
+
+f010a7fa <ipc_enqueue>:
+{
+f010a7fa:	55                   	push   %ebp
+f010a7fb:	89 e5                	mov    %esp,%ebp
+f010a7fd:	57                   	push   %edi
+f010a7fe:	56                   	push   %esi
+f010a7ff:	53                   	push   %ebx
+f010a800:	83 ec 1c             	sub    $0x1c,%esp
+f010a803:	89 c3                	mov    %eax,%ebx
+f010a805:	89 d6                	mov    %edx,%esi
+f010a807:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+f010a80a:	8b 7d 10             	mov    0x10(%ebp),%edi
+	struct Env *src = curenv;
+f010a80d:	e8 25 e4 ff ff       	call   f0108c37 <cpunum>
+f010a812:	6b c0 78             	imul   $0x78,%eax,%eax
+f010a815:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+	assert(!src->env_ipc_sendto);
+f010a81b:	83 b8 b0 00 00 00 00 	cmpl   $0x0,0xb0(%eax)
+f010a822:	0f 85 92 00 00 00    	jne    f010a8ba <ipc_enqueue+0xc0>
+	src->env_ipc_sendto = dst->env_id;
+f010a828:	8b 53 48             	mov    0x48(%ebx),%edx
+f010a82b:	89 90 b0 00 00 00    	mov    %edx,0xb0(%eax)
+	src->env_ipc_send_msg = *msg;
+f010a831:	8b 16                	mov    (%esi),%edx
+f010a833:	89 90 b4 00 00 00    	mov    %edx,0xb4(%eax)
+f010a839:	8b 56 04             	mov    0x4(%esi),%edx
+f010a83c:	89 90 b8 00 00 00    	mov    %edx,0xb8(%eax)
+f010a842:	8b 56 08             	mov    0x8(%esi),%edx
+f010a845:	89 90 bc 00 00 00    	mov    %edx,0xbc(%eax)
+f010a84b:	8b 56 0c             	mov    0xc(%esi),%edx
+f010a84e:	89 90 c0 00 00 00    	mov    %edx,0xc0(%eax)
+f010a854:	8b 56 10             	mov    0x10(%esi),%edx
+f010a857:	89 90 c4 00 00 00    	mov    %edx,0xc4(%eax)
+	src->env_ipc_send_srcva = srcva;
+f010a85d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f010a860:	89 88 c8 00 00 00    	mov    %ecx,0xc8(%eax)
+	src->env_ipc_send_npages = npages;
+f010a866:	8b 55 08             	mov    0x8(%ebp),%edx
+f010a869:	89 90 cc 00 00 00    	mov    %edx,0xcc(%eax)
+	src->env_ipc_send_perm = perm;
+f010a86f:	8b 55 0c             	mov    0xc(%ebp),%edx
+f010a872:	89 90 d0 00 00 00    	mov    %edx,0xd0(%eax)
+	src->env_ipc_send_call = call;
+f010a878:	89 f9                	mov    %edi,%ecx
+f010a87a:	88 88 e0 00 00 00    	mov    %cl,0xe0(%eax)
+	src->env_ipc_qnext = NULL;
+f010a880:	c7 80 ac 00 00 00 00 	movl   $0x0,0xac(%eax)
+f010a887:	00 00 00 
+	if (dst->env_ipc_qtail)
+f010a88a:	8b 93 a8 00 00 00    	mov    0xa8(%ebx),%edx
+f010a890:	85 d2                	test   %edx,%edx
+f010a892:	74 3f                	je     f010a8d3 <ipc_enqueue+0xd9>
+		dst->env_ipc_qtail->env_ipc_qnext = src;
+f010a894:	89 82 ac 00 00 00    	mov    %eax,0xac(%edx)
+	dst->env_ipc_qtail = src;
+f010a89a:	89 83 a8 00 00 00    	mov    %eax,0xa8(%ebx)
+	dst->env_ipc_qlen++;
+f010a8a0:	83 83 d4 00 00 00 01 	addl   $0x1,0xd4(%ebx)
+	dst->env_ipc_queued++;
+f010a8a7:	83 83 d8 00 00 00 01 	addl   $0x1,0xd8(%ebx)
+	src->env_status = ENV_NOT_RUNNABLE;
+f010a8ae:	c7 40 54 04 00 00 00 	movl   $0x4,0x54(%eax)
+	sched_yield();
+f010a8b5:	e8 77 b8 ff ff       	call   f0106131 <sched_yield>
+	assert(!src->env_ipc_sendto);
+f010a8ba:	68 69 e3 10 f0       	push   $0xf010e369
+f010a8bf:	68 bf be 10 f0       	push   $0xf010bebf
+f010a8c4:	68 e6 00 00 00       	push   $0xe6
+f010a8c9:	68 5e e3 10 f0       	push   $0xf010e35e
+f010a8ce:	e8 70 57 ff ff       	call   f0100043 <_panic>
+		dst->env_ipc_qhead = src;
+f010a8d3:	89 83 a4 00 00 00    	mov    %eax,0xa4(%ebx)
+f010a8d9:	eb bf                	jmp    f010a89a <ipc_enqueue+0xa0>
+
+f010a8db <ipc_msg_get>:
+{
+f010a8db:	55                   	push   %ebp
+f010a8dc:	89 e5                	mov    %esp,%ebp
+f010a8de:	8b 45 08             	mov    0x8(%ebp),%eax
+f010a8e1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	m->m_w[0] = regs->reg_ecx;
+f010a8e4:	8b 4a 18             	mov    0x18(%edx),%ecx
+f010a8e7:	89 08                	mov    %ecx,(%eax)
+	m->m_w[1] = regs->reg_ebx;
+f010a8e9:	8b 4a 10             	mov    0x10(%edx),%ecx
+f010a8ec:	89 48 04             	mov    %ecx,0x4(%eax)
+	m->m_w[2] = regs->reg_edi;
+f010a8ef:	8b 0a                	mov    (%edx),%ecx
+f010a8f1:	89 48 08             	mov    %ecx,0x8(%eax)
+	m->m_w[3] = regs->reg_esi;
+f010a8f4:	8b 4a 04             	mov    0x4(%edx),%ecx
+f010a8f7:	89 48 0c             	mov    %ecx,0xc(%eax)
+	m->m_w[4] = regs->reg_ebp;
+f010a8fa:	8b 52 08             	mov    0x8(%edx),%edx
+f010a8fd:	89 50 10             	mov    %edx,0x10(%eax)
+}
+f010a900:	5d                   	pop    %ebp
+f010a901:	c3                   	ret
+
+f010a902 <ipc_msg_put>:
+{
+f010a902:	55                   	push   %ebp
+f010a903:	89 e5                	mov    %esp,%ebp
+f010a905:	8b 45 08             	mov    0x8(%ebp),%eax
+f010a908:	8b 55 0c             	mov    0xc(%ebp),%edx
+	regs->reg_ecx = m->m_w[0];
+f010a90b:	8b 0a                	mov    (%edx),%ecx
+f010a90d:	89 48 18             	mov    %ecx,0x18(%eax)
+	regs->reg_ebx = m->m_w[1];
+f010a910:	8b 4a 04             	mov    0x4(%edx),%ecx
+f010a913:	89 48 10             	mov    %ecx,0x10(%eax)
+	regs->reg_edi = m->m_w[2];
+f010a916:	8b 4a 08             	mov    0x8(%edx),%ecx
+f010a919:	89 08                	mov    %ecx,(%eax)
+	regs->reg_esi = m->m_w[3];
+f010a91b:	8b 4a 0c             	mov    0xc(%edx),%ecx
+f010a91e:	89 48 04             	mov    %ecx,0x4(%eax)
+	regs->reg_ebp = m->m_w[4];
+f010a921:	8b 52 10             	mov    0x10(%edx),%edx
+f010a924:	89 50 08             	mov    %edx,0x8(%eax)
+}
+f010a927:	5d                   	pop    %ebp
+f010a928:	c3                   	ret
+
+f010a929 <ipc_send>:
+{
+f010a929:	55                   	push   %ebp
+f010a92a:	89 e5                	mov    %esp,%ebp
+f010a92c:	57                   	push   %edi
+f010a92d:	56                   	push   %esi
+f010a92e:	53                   	push   %ebx
+f010a92f:	83 ec 2c             	sub    $0x2c,%esp
+f010a932:	8b 45 1c             	mov    0x1c(%ebp),%eax
+f010a935:	89 45 d0             	mov    %eax,-0x30(%ebp)
+	struct Env *src = curenv;
+f010a938:	e8 fa e2 ff ff       	call   f0108c37 <cpunum>
+f010a93d:	6b c0 78             	imul   $0x78,%eax,%eax
+f010a940:	8b b8 28 60 7d f0    	mov    -0xf829fd8(%eax),%edi
+	if (dst == src)
+f010a946:	3b 7d 08             	cmp    0x8(%ebp),%edi
+f010a949:	0f 84 47 01 00 00    	je     f010aa96 <ipc_send+0x16d>
+	if ((uintptr_t) srcva >= UTOP)
+f010a94f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+f010a952:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+f010a958:	0f 87 89 00 00 00    	ja     f010a9e7 <ipc_send+0xbe>
+		&& (uintptr_t) va + npages * PGSIZE <= UTOP;
+f010a95e:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+f010a964:	0f 85 40 01 00 00    	jne    f010aaaa <ipc_send+0x181>
+	return !PGOFF(va) && npages >= 1 && npages <= IPC_RANGE_MAX
+f010a96a:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a96d:	8d 50 ff             	lea    -0x1(%eax),%edx
+f010a970:	81 fa ff 03 00 00    	cmp    $0x3ff,%edx
+f010a976:	0f 87 2e 01 00 00    	ja     f010aaaa <ipc_send+0x181>
+		&& (uintptr_t) va + npages * PGSIZE <= UTOP;
+f010a97c:	89 c1                	mov    %eax,%ecx
+f010a97e:	c1 e1 0c             	shl    $0xc,%ecx
+f010a981:	01 d9                	add    %ebx,%ecx
+f010a983:	89 ce                	mov    %ecx,%esi
+	if (!ipc_range_ok(srcva, npages))
+f010a985:	81 f9 00 00 c0 ee    	cmp    $0xeec00000,%ecx
+f010a98b:	0f 87 19 01 00 00    	ja     f010aaaa <ipc_send+0x181>
+	    || (perm & ~(PTE_SYSCALL | PAGE_MOVE)))
+f010a991:	8b 55 18             	mov    0x18(%ebp),%edx
+f010a994:	81 e2 fd d1 ff ff    	and    $0xffffd1fd,%edx
+	if ((perm & (PTE_U | PTE_P)) != (PTE_U | PTE_P)
+f010a99a:	83 fa 05             	cmp    $0x5,%edx
+f010a99d:	0f 85 07 01 00 00    	jne    f010aaaa <ipc_send+0x181>
+		if ((perm & PTE_W) && !(*pte & (PTE_W | PTE_COW)))
+f010a9a3:	8b 45 18             	mov    0x18(%ebp),%eax
+f010a9a6:	83 e0 02             	and    $0x2,%eax
+f010a9a9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f010a9ac:	eb 06                	jmp    f010a9b4 <ipc_send+0x8b>
+	for (i = 0; i < npages; i++) {
+f010a9ae:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f010a9b4:	39 f3                	cmp    %esi,%ebx
+f010a9b6:	74 2f                	je     f010a9e7 <ipc_send+0xbe>
+		if (!page_lookup(src->env_pgdir, srcva + i * PGSIZE, &pte))
+f010a9b8:	83 ec 04             	sub    $0x4,%esp
+f010a9bb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f010a9be:	50                   	push   %eax
+f010a9bf:	53                   	push   %ebx
+f010a9c0:	ff 77 60             	push   0x60(%edi)
+f010a9c3:	e8 c2 6e ff ff       	call   f010188a <page_lookup>
+f010a9c8:	83 c4 10             	add    $0x10,%esp
+f010a9cb:	85 c0                	test   %eax,%eax
+f010a9cd:	74 11                	je     f010a9e0 <ipc_send+0xb7>
+		if ((perm & PTE_W) && !(*pte & (PTE_W | PTE_COW)))
+f010a9cf:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+f010a9d3:	74 d9                	je     f010a9ae <ipc_send+0x85>
+f010a9d5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010a9d8:	f7 00 02 08 00 00    	testl  $0x802,(%eax)
+f010a9de:	75 ce                	jne    f010a9ae <ipc_send+0x85>
+f010a9e0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010a9e5:	eb 2b                	jmp    f010aa12 <ipc_send+0xe9>
+	if (dst->env_ipc_recving) {
+f010a9e7:	8b 45 08             	mov    0x8(%ebp),%eax
+f010a9ea:	80 78 78 00          	cmpb   $0x0,0x78(%eax)
+f010a9ee:	75 2a                	jne    f010aa1a <ipc_send+0xf1>
+	if (!block)
+f010a9f0:	80 7d d0 00          	cmpb   $0x0,-0x30(%ebp)
+f010a9f4:	0f 84 a6 00 00 00    	je     f010aaa0 <ipc_send+0x177>
+	if (dst->env_ipc_qlen == IPC_QUEUE_MAX) {
+f010a9fa:	8b 45 08             	mov    0x8(%ebp),%eax
+f010a9fd:	83 b8 d4 00 00 00 08 	cmpl   $0x8,0xd4(%eax)
+f010aa04:	75 77                	jne    f010aa7d <ipc_send+0x154>
+		dst->env_ipc_drops++;
+f010aa06:	83 80 dc 00 00 00 01 	addl   $0x1,0xdc(%eax)
+		return -E_AGAIN;
+f010aa0d:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+}
+f010aa12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010aa15:	5b                   	pop    %ebx
+f010aa16:	5e                   	pop    %esi
+f010aa17:	5f                   	pop    %edi
+f010aa18:	5d                   	pop    %ebp
+f010aa19:	c3                   	ret
+		if ((r = ipc_transfer(src, dst, msg, srcva, npages,
+f010aa1a:	83 ec 04             	sub    $0x4,%esp
+f010aa1d:	ff 75 18             	push   0x18(%ebp)
+f010aa20:	ff 75 14             	push   0x14(%ebp)
+f010aa23:	ff 75 10             	push   0x10(%ebp)
+f010aa26:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f010aa29:	89 c2                	mov    %eax,%edx
+f010aa2b:	89 f8                	mov    %edi,%eax
+f010aa2d:	e8 32 fa ff ff       	call   f010a464 <ipc_transfer>
+f010aa32:	83 c4 10             	add    $0x10,%esp
+f010aa35:	85 c0                	test   %eax,%eax
+f010aa37:	78 d9                	js     f010aa12 <ipc_send+0xe9>
+		return 0;
+f010aa39:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!dst->env_ipc_inregs)
+f010aa3e:	8b 55 08             	mov    0x8(%ebp),%edx
+f010aa41:	80 ba e8 00 00 00 00 	cmpb   $0x0,0xe8(%edx)
+f010aa48:	75 14                	jne    f010aa5e <ipc_send+0x135>
+	e->env_tf.tf_regs.reg_eax = r;
+f010aa4a:	8b 55 08             	mov    0x8(%ebp),%edx
+f010aa4d:	89 42 1c             	mov    %eax,0x1c(%edx)
+	e->env_status = ENV_RUNNABLE;
+f010aa50:	c7 42 54 02 00 00 00 	movl   $0x2,0x54(%edx)
+		return 0;
+f010aa57:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f010aa5c:	eb b4                	jmp    f010aa12 <ipc_send+0xe9>
+	ipc_msg_put(&dst->env_tf.tf_regs, &dst->env_ipc_msg);
+f010aa5e:	83 ec 08             	sub    $0x8,%esp
+f010aa61:	89 d0                	mov    %edx,%eax
+f010aa63:	05 84 00 00 00       	add    $0x84,%eax
+f010aa68:	50                   	push   %eax
+f010aa69:	52                   	push   %edx
+f010aa6a:	e8 93 fe ff ff       	call   f010a902 <ipc_msg_put>
+	return dst->env_ipc_from;
+f010aa6f:	8b 45 08             	mov    0x8(%ebp),%eax
+f010aa72:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+f010aa78:	83 c4 10             	add    $0x10,%esp
+f010aa7b:	eb cd                	jmp    f010aa4a <ipc_send+0x121>
+	ipc_enqueue(dst, msg, srcva, npages, perm, 0);
+f010aa7d:	83 ec 04             	sub    $0x4,%esp
+f010aa80:	6a 00                	push   $0x0
+f010aa82:	ff 75 18             	push   0x18(%ebp)
+f010aa85:	ff 75 14             	push   0x14(%ebp)
+f010aa88:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f010aa8b:	8b 55 0c             	mov    0xc(%ebp),%edx
+f010aa8e:	8b 45 08             	mov    0x8(%ebp),%eax
+f010aa91:	e8 64 fd ff ff       	call   f010a7fa <ipc_enqueue>
+		return -E_INVAL;
+f010aa96:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010aa9b:	e9 72 ff ff ff       	jmp    f010aa12 <ipc_send+0xe9>
+		return -E_IPC_NOT_RECV;
+f010aaa0:	b8 f9 ff ff ff       	mov    $0xfffffff9,%eax
+f010aaa5:	e9 68 ff ff ff       	jmp    f010aa12 <ipc_send+0xe9>
+f010aaaa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010aaaf:	e9 5e ff ff ff       	jmp    f010aa12 <ipc_send+0xe9>
+
+f010aab4 <ipc_call>:
+{
+f010aab4:	55                   	push   %ebp
+f010aab5:	89 e5                	mov    %esp,%ebp
+f010aab7:	56                   	push   %esi
+f010aab8:	53                   	push   %ebx
+f010aab9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct Env *src = curenv;
+f010aabc:	e8 76 e1 ff ff       	call   f0108c37 <cpunum>
+f010aac1:	6b c0 78             	imul   $0x78,%eax,%eax
+f010aac4:	8b b0 28 60 7d f0    	mov    -0xf829fd8(%eax),%esi
+	if (dst == src)
+f010aaca:	39 de                	cmp    %ebx,%esi
+f010aacc:	0f 84 a3 00 00 00    	je     f010ab75 <ipc_call+0xc1>
+	if (dst->env_ipc_recving) {
+f010aad2:	80 7b 78 00          	cmpb   $0x0,0x78(%ebx)
+f010aad6:	75 1c                	jne    f010aaf4 <ipc_call+0x40>
+	if (dst->env_ipc_qlen == IPC_QUEUE_MAX) {
+f010aad8:	83 bb d4 00 00 00 08 	cmpl   $0x8,0xd4(%ebx)
+f010aadf:	75 73                	jne    f010ab54 <ipc_call+0xa0>
+		dst->env_ipc_drops++;
+f010aae1:	83 83 dc 00 00 00 01 	addl   $0x1,0xdc(%ebx)
+		return -E_AGAIN;
+f010aae8:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+}
+f010aaed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010aaf0:	5b                   	pop    %ebx
+f010aaf1:	5e                   	pop    %esi
+f010aaf2:	5d                   	pop    %ebp
+f010aaf3:	c3                   	ret
+		ipc_transfer(src, dst, msg, (void *) UTOP, 0, 0);
+f010aaf4:	83 ec 04             	sub    $0x4,%esp
+f010aaf7:	6a 00                	push   $0x0
+f010aaf9:	6a 00                	push   $0x0
+f010aafb:	68 00 00 c0 ee       	push   $0xeec00000
+f010ab00:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f010ab03:	89 da                	mov    %ebx,%edx
+f010ab05:	89 f0                	mov    %esi,%eax
+f010ab07:	e8 58 f9 ff ff       	call   f010a464 <ipc_transfer>
+		src->env_ipc_replyfrom = dst->env_id;
+f010ab0c:	8b 43 48             	mov    0x48(%ebx),%eax
+f010ab0f:	89 86 e4 00 00 00    	mov    %eax,0xe4(%esi)
+		src->env_status = ENV_NOT_RUNNABLE;
+f010ab15:	c7 46 54 04 00 00 00 	movl   $0x4,0x54(%esi)
+	if (!dst->env_ipc_inregs)
+f010ab1c:	83 c4 10             	add    $0x10,%esp
+		return 0;
+f010ab1f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!dst->env_ipc_inregs)
+f010ab24:	80 bb e8 00 00 00 00 	cmpb   $0x0,0xe8(%ebx)
+f010ab2b:	75 0c                	jne    f010ab39 <ipc_call+0x85>
+		dst->env_tf.tf_regs.reg_eax = ipc_result(dst);
+f010ab2d:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		env_run(dst);
+f010ab30:	83 ec 0c             	sub    $0xc,%esp
+f010ab33:	53                   	push   %ebx
+f010ab34:	e8 df 9e ff ff       	call   f0104a18 <env_run>
+	ipc_msg_put(&dst->env_tf.tf_regs, &dst->env_ipc_msg);
+f010ab39:	83 ec 08             	sub    $0x8,%esp
+f010ab3c:	8d 83 84 00 00 00    	lea    0x84(%ebx),%eax
+f010ab42:	50                   	push   %eax
+f010ab43:	53                   	push   %ebx
+f010ab44:	e8 b9 fd ff ff       	call   f010a902 <ipc_msg_put>
+	return dst->env_ipc_from;
+f010ab49:	8b 83 98 00 00 00    	mov    0x98(%ebx),%eax
+f010ab4f:	83 c4 10             	add    $0x10,%esp
+f010ab52:	eb d9                	jmp    f010ab2d <ipc_call+0x79>
+	src->env_ipc_replyfrom = dst->env_id;
+f010ab54:	8b 43 48             	mov    0x48(%ebx),%eax
+f010ab57:	89 86 e4 00 00 00    	mov    %eax,0xe4(%esi)
+	ipc_enqueue(dst, msg, (void *) UTOP, 0, 0, 1);
+f010ab5d:	83 ec 04             	sub    $0x4,%esp
+f010ab60:	6a 01                	push   $0x1
+f010ab62:	6a 00                	push   $0x0
+f010ab64:	6a 00                	push   $0x0
+f010ab66:	b9 00 00 c0 ee       	mov    $0xeec00000,%ecx
+f010ab6b:	8b 55 0c             	mov    0xc(%ebp),%edx
+f010ab6e:	89 d8                	mov    %ebx,%eax
+f010ab70:	e8 85 fc ff ff       	call   f010a7fa <ipc_enqueue>
+		return -E_INVAL;
+f010ab75:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010ab7a:	e9 6e ff ff ff       	jmp    f010aaed <ipc_call+0x39>
+
+f010ab7f <ipc_recv>:
+// Returns 0 on success, -E_INVAL if dstva < UTOP but the window is
+// not page-aligned or does not fit below UTOP.
+//
+int
+ipc_recv(void *dstva, size_t npages)
+{
+f010ab7f:	55                   	push   %ebp
+f010ab80:	89 e5                	mov    %esp,%ebp
+f010ab82:	57                   	push   %edi
+f010ab83:	56                   	push   %esi
+f010ab84:	53                   	push   %ebx
+f010ab85:	83 ec 0c             	sub    $0xc,%esp
+f010ab88:	8b 75 08             	mov    0x8(%ebp),%esi
+f010ab8b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	struct Env *e = curenv;
+f010ab8e:	e8 a4 e0 ff ff       	call   f0108c37 <cpunum>
+f010ab93:	6b c0 78             	imul   $0x78,%eax,%eax
+f010ab96:	8b 98 28 60 7d f0    	mov    -0xf829fd8(%eax),%ebx
+
+	if ((uintptr_t) dstva < UTOP && !ipc_range_ok(dstva, npages))
+f010ab9c:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+f010aba2:	77 20                	ja     f010abc4 <ipc_recv+0x45>
+		&& (uintptr_t) va + npages * PGSIZE <= UTOP;
+f010aba4:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+f010abaa:	75 50                	jne    f010abfc <ipc_recv+0x7d>
+	return !PGOFF(va) && npages >= 1 && npages <= IPC_RANGE_MAX
+f010abac:	8d 47 ff             	lea    -0x1(%edi),%eax
+f010abaf:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+f010abb4:	77 4d                	ja     f010ac03 <ipc_recv+0x84>
+		&& (uintptr_t) va + npages * PGSIZE <= UTOP;
+f010abb6:	89 f8                	mov    %edi,%eax
+f010abb8:	c1 e0 0c             	shl    $0xc,%eax
+f010abbb:	01 f0                	add    %esi,%eax
+	if ((uintptr_t) dstva < UTOP && !ipc_range_ok(dstva, npages))
+f010abbd:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+f010abc2:	77 46                	ja     f010ac0a <ipc_recv+0x8b>
+		return -E_INVAL;
+	e->env_ipc_dstva = dstva;
+f010abc4:	89 73 7c             	mov    %esi,0x7c(%ebx)
+	e->env_ipc_dstnpages = npages;
+f010abc7:	89 bb 80 00 00 00    	mov    %edi,0x80(%ebx)
+	e->env_ipc_inregs = 0;
+f010abcd:	c6 83 e8 00 00 00 00 	movb   $0x0,0xe8(%ebx)
+
+	if (ipc_take(e))
+f010abd4:	89 d8                	mov    %ebx,%eax
+f010abd6:	e8 69 fb ff ff       	call   f010a744 <ipc_take>
+f010abdb:	84 c0                	test   %al,%al
+f010abdd:	74 0d                	je     f010abec <ipc_recv+0x6d>
+		return 0;
+f010abdf:	b8 00 00 00 00       	mov    $0x0,%eax
+
+	e->env_ipc_recving = 1;
+	e->env_status = ENV_NOT_RUNNABLE;
+	sched_yield();
+}
+f010abe4:	83 c4 0c             	add    $0xc,%esp
+f010abe7:	5b                   	pop    %ebx
+f010abe8:	5e                   	pop    %esi
+f010abe9:	5f                   	pop    %edi
+f010abea:	5d                   	pop    %ebp
+f010abeb:	c3                   	ret
+	e->env_ipc_recving = 1;
+f010abec:	c6 43 78 01          	movb   $0x1,0x78(%ebx)
+	e->env_status = ENV_NOT_RUNNABLE;
+f010abf0:	c7 43 54 04 00 00 00 	movl   $0x4,0x54(%ebx)
+	sched_yield();
+f010abf7:	e8 35 b5 ff ff       	call   f0106131 <sched_yield>
+		return -E_INVAL;
+f010abfc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010ac01:	eb e1                	jmp    f010abe4 <ipc_recv+0x65>
+f010ac03:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010ac08:	eb da                	jmp    f010abe4 <ipc_recv+0x65>
+f010ac0a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010ac0f:	eb d3                	jmp    f010abe4 <ipc_recv+0x65>
+
+f010ac11 <ipc_reply_wait>:
+//	-E_BAD_ENV if 'to' does not exist.
+//	-E_IPC_NOT_RECV if 'to' is not waiting for our reply.
+//
+int
+ipc_reply_wait(envid_t to, const struct ipc_msg *reply)
+{
+f010ac11:	55                   	push   %ebp
+f010ac12:	89 e5                	mov    %esp,%ebp
+f010ac14:	56                   	push   %esi
+f010ac15:	53                   	push   %ebx
+f010ac16:	83 ec 10             	sub    $0x10,%esp
+f010ac19:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Env *e = curenv, *c = NULL;
+f010ac1c:	e8 16 e0 ff ff       	call   f0108c37 <cpunum>
+f010ac21:	6b c0 78             	imul   $0x78,%eax,%eax
+f010ac24:	8b 98 28 60 7d f0    	mov    -0xf829fd8(%eax),%ebx
+f010ac2a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+	int r;
+
+	if (to) {
+f010ac31:	85 f6                	test   %esi,%esi
+f010ac33:	74 6d                	je     f010aca2 <ipc_reply_wait+0x91>
+		if ((r = envid2env(to, &c, 0)) < 0)
+f010ac35:	83 ec 04             	sub    $0x4,%esp
+f010ac38:	6a 00                	push   $0x0
+f010ac3a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f010ac3d:	50                   	push   %eax
+f010ac3e:	56                   	push   %esi
+f010ac3f:	e8 b7 90 ff ff       	call   f0103cfb <envid2env>
+f010ac44:	83 c4 10             	add    $0x10,%esp
+f010ac47:	85 c0                	test   %eax,%eax
+f010ac49:	0f 88 9f 00 00 00    	js     f010acee <ipc_reply_wait+0xdd>
+			return r;
+		if (c->env_ipc_replyfrom != e->env_id || c->env_ipc_sendto
+f010ac4f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f010ac52:	8b 53 48             	mov    0x48(%ebx),%edx
+f010ac55:	39 90 e4 00 00 00    	cmp    %edx,0xe4(%eax)
+f010ac5b:	0f 85 b4 00 00 00    	jne    f010ad15 <ipc_reply_wait+0x104>
+f010ac61:	83 b8 b0 00 00 00 00 	cmpl   $0x0,0xb0(%eax)
+f010ac68:	0f 85 ae 00 00 00    	jne    f010ad1c <ipc_reply_wait+0x10b>
+		    || c->env_status != ENV_NOT_RUNNABLE)
+f010ac6e:	83 78 54 04          	cmpl   $0x4,0x54(%eax)
+f010ac72:	0f 85 ab 00 00 00    	jne    f010ad23 <ipc_reply_wait+0x112>
+			return -E_IPC_NOT_RECV;
+		c->env_ipc_replyfrom = 0;
+f010ac78:	c7 80 e4 00 00 00 00 	movl   $0x0,0xe4(%eax)
+f010ac7f:	00 00 00 
+		ipc_msg_put(&c->env_tf.tf_regs, reply);
+f010ac82:	83 ec 08             	sub    $0x8,%esp
+f010ac85:	ff 75 0c             	push   0xc(%ebp)
+f010ac88:	50                   	push   %eax
+f010ac89:	e8 74 fc ff ff       	call   f010a902 <ipc_msg_put>
+		ipc_wake(c, 0);
+f010ac8e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+	e->env_tf.tf_regs.reg_eax = r;
+f010ac91:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+	e->env_status = ENV_RUNNABLE;
+f010ac98:	c7 40 54 02 00 00 00 	movl   $0x2,0x54(%eax)
+}
+f010ac9f:	83 c4 10             	add    $0x10,%esp
+	}
+
+	e->env_ipc_dstva = (void *) UTOP;
+f010aca2:	c7 43 7c 00 00 c0 ee 	movl   $0xeec00000,0x7c(%ebx)
+	e->env_ipc_dstnpages = 0;
+f010aca9:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+f010acb0:	00 00 00 
+	e->env_ipc_inregs = 1;
+f010acb3:	c6 83 e8 00 00 00 01 	movb   $0x1,0xe8(%ebx)
+	if (ipc_take(e))
+f010acba:	89 d8                	mov    %ebx,%eax
+f010acbc:	e8 83 fa ff ff       	call   f010a744 <ipc_take>
+f010acc1:	84 c0                	test   %al,%al
+f010acc3:	75 1b                	jne    f010ace0 <ipc_reply_wait+0xcf>
+		return ipc_result(e);
+
+	e->env_ipc_recving = 1;
+f010acc5:	c6 43 78 01          	movb   $0x1,0x78(%ebx)
+	e->env_status = ENV_NOT_RUNNABLE;
+f010acc9:	c7 43 54 04 00 00 00 	movl   $0x4,0x54(%ebx)
+	if (c)
+f010acd0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f010acd3:	85 c0                	test   %eax,%eax
+f010acd5:	74 39                	je     f010ad10 <ipc_reply_wait+0xff>
+		env_run(c);
+f010acd7:	83 ec 0c             	sub    $0xc,%esp
+f010acda:	50                   	push   %eax
+f010acdb:	e8 38 9d ff ff       	call   f0104a18 <env_run>
+		return 0;
+f010ace0:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!dst->env_ipc_inregs)
+f010ace5:	80 bb e8 00 00 00 00 	cmpb   $0x0,0xe8(%ebx)
+f010acec:	75 07                	jne    f010acf5 <ipc_reply_wait+0xe4>
+	sched_yield();
+}
+f010acee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010acf1:	5b                   	pop    %ebx
+f010acf2:	5e                   	pop    %esi
+f010acf3:	5d                   	pop    %ebp
+f010acf4:	c3                   	ret
+	ipc_msg_put(&dst->env_tf.tf_regs, &dst->env_ipc_msg);
+f010acf5:	83 ec 08             	sub    $0x8,%esp
+f010acf8:	8d 83 84 00 00 00    	lea    0x84(%ebx),%eax
+f010acfe:	50                   	push   %eax
+f010acff:	53                   	push   %ebx
+f010ad00:	e8 fd fb ff ff       	call   f010a902 <ipc_msg_put>
+	return dst->env_ipc_from;
+f010ad05:	8b 83 98 00 00 00    	mov    0x98(%ebx),%eax
+f010ad0b:	83 c4 10             	add    $0x10,%esp
+f010ad0e:	eb de                	jmp    f010acee <ipc_reply_wait+0xdd>
+	sched_yield();
+f010ad10:	e8 1c b4 ff ff       	call   f0106131 <sched_yield>
+			return -E_IPC_NOT_RECV;
+f010ad15:	b8 f9 ff ff ff       	mov    $0xfffffff9,%eax
+f010ad1a:	eb d2                	jmp    f010acee <ipc_reply_wait+0xdd>
+f010ad1c:	b8 f9 ff ff ff       	mov    $0xfffffff9,%eax
+f010ad21:	eb cb                	jmp    f010acee <ipc_reply_wait+0xdd>
+f010ad23:	b8 f9 ff ff ff       	mov    $0xfffffff9,%eax
+f010ad28:	eb c4                	jmp    f010acee <ipc_reply_wait+0xdd>
+
+f010ad2a <ipc_env_free>:
+// in, and fail the sends of everyone waiting in its own queue or for
+// its reply.
+//
+void
+ipc_env_free(struct Env *e)
+{
+f010ad2a:	55                   	push   %ebp
+f010ad2b:	89 e5                	mov    %esp,%ebp
+f010ad2d:	56                   	push   %esi
+f010ad2e:	53                   	push   %ebx
+f010ad2f:	8b 55 08             	mov    0x8(%ebp),%edx
+	struct Env *dst, **pp, *prev = NULL;
+	int i;
+
+	if (e->env_ipc_sendto) {
+f010ad32:	8b 82 b0 00 00 00    	mov    0xb0(%edx),%eax
+f010ad38:	85 c0                	test   %eax,%eax
+f010ad3a:	74 65                	je     f010ada1 <ipc_env_free+0x77>
+		dst = &envs[ENVX(e->env_ipc_sendto)];
+f010ad3c:	25 ff 03 00 00       	and    $0x3ff,%eax
+f010ad41:	69 c8 68 01 00 00    	imul   $0x168,%eax,%ecx
+f010ad47:	03 0d 84 47 79 f0    	add    0xf0794784,%ecx
+		for (pp = &dst->env_ipc_qhead; *pp;
+f010ad4d:	8d 99 a4 00 00 00    	lea    0xa4(%ecx),%ebx
+f010ad53:	8b 81 a4 00 00 00    	mov    0xa4(%ecx),%eax
+	struct Env *dst, **pp, *prev = NULL;
+f010ad59:	be 00 00 00 00       	mov    $0x0,%esi
+		for (pp = &dst->env_ipc_qhead; *pp;
+f010ad5e:	85 c0                	test   %eax,%eax
+f010ad60:	74 2b                	je     f010ad8d <ipc_env_free+0x63>
+		     prev = *pp, pp = &(*pp)->env_ipc_qnext)
+			if (*pp == e) {
+f010ad62:	39 d0                	cmp    %edx,%eax
+f010ad64:	74 10                	je     f010ad76 <ipc_env_free+0x4c>
+		     prev = *pp, pp = &(*pp)->env_ipc_qnext)
+f010ad66:	8d 98 ac 00 00 00    	lea    0xac(%eax),%ebx
+f010ad6c:	89 c6                	mov    %eax,%esi
+f010ad6e:	8b 80 ac 00 00 00    	mov    0xac(%eax),%eax
+f010ad74:	eb e8                	jmp    f010ad5e <ipc_env_free+0x34>
+				*pp = e->env_ipc_qnext;
+f010ad76:	8b 82 ac 00 00 00    	mov    0xac(%edx),%eax
+f010ad7c:	89 03                	mov    %eax,(%ebx)
+				if (dst->env_ipc_qtail == e)
+f010ad7e:	39 91 a8 00 00 00    	cmp    %edx,0xa8(%ecx)
+f010ad84:	74 27                	je     f010adad <ipc_env_free+0x83>
+					dst->env_ipc_qtail = prev;
+				dst->env_ipc_qlen--;
+f010ad86:	83 a9 d4 00 00 00 01 	subl   $0x1,0xd4(%ecx)
+				break;
+			}
+		e->env_ipc_sendto = 0;
+f010ad8d:	c7 82 b0 00 00 00 00 	movl   $0x0,0xb0(%edx)
+f010ad94:	00 00 00 
+		e->env_ipc_qnext = NULL;
+f010ad97:	c7 82 ac 00 00 00 00 	movl   $0x0,0xac(%edx)
+f010ad9e:	00 00 00 
+	}
+
+	e->env_ipc_replyfrom = 0;
+f010ada1:	c7 82 e4 00 00 00 00 	movl   $0x0,0xe4(%edx)
+f010ada8:	00 00 00 
+
+	while ((dst = ipc_dequeue(e))) {
+f010adab:	eb 3b                	jmp    f010ade8 <ipc_env_free+0xbe>
+					dst->env_ipc_qtail = prev;
+f010adad:	89 b1 a8 00 00 00    	mov    %esi,0xa8(%ecx)
+f010adb3:	eb d1                	jmp    f010ad86 <ipc_env_free+0x5c>
+		e->env_ipc_qlen--;
+f010adb5:	83 aa d4 00 00 00 01 	subl   $0x1,0xd4(%edx)
+		s->env_ipc_qnext = NULL;
+f010adbc:	c7 80 ac 00 00 00 00 	movl   $0x0,0xac(%eax)
+f010adc3:	00 00 00 
+		s->env_ipc_sendto = 0;
+f010adc6:	c7 80 b0 00 00 00 00 	movl   $0x0,0xb0(%eax)
+f010adcd:	00 00 00 
+		dst->env_ipc_replyfrom = 0;
+f010add0:	c7 80 e4 00 00 00 00 	movl   $0x0,0xe4(%eax)
+f010add7:	00 00 00 
+	e->env_tf.tf_regs.reg_eax = r;
+f010adda:	c7 40 1c fe ff ff ff 	movl   $0xfffffffe,0x1c(%eax)
+	e->env_status = ENV_RUNNABLE;
+f010ade1:	c7 40 54 02 00 00 00 	movl   $0x2,0x54(%eax)
+	struct Env *s = e->env_ipc_qhead;
+f010ade8:	8b 82 a4 00 00 00    	mov    0xa4(%edx),%eax
+	if (s) {
+f010adee:	85 c0                	test   %eax,%eax
+f010adf0:	74 1c                	je     f010ae0e <ipc_env_free+0xe4>
+		if (!(e->env_ipc_qhead = s->env_ipc_qnext))
+f010adf2:	8b 88 ac 00 00 00    	mov    0xac(%eax),%ecx
+f010adf8:	89 8a a4 00 00 00    	mov    %ecx,0xa4(%edx)
+f010adfe:	85 c9                	test   %ecx,%ecx
+f010ae00:	75 b3                	jne    f010adb5 <ipc_env_free+0x8b>
+			e->env_ipc_qtail = NULL;
+f010ae02:	c7 82 a8 00 00 00 00 	movl   $0x0,0xa8(%edx)
+f010ae09:	00 00 00 
+f010ae0c:	eb a7                	jmp    f010adb5 <ipc_env_free+0x8b>
+		ipc_wake(dst, -E_BAD_ENV);
+	}
+	for (i = 0; i < NENV; i++)
+		if (envs[i].env_ipc_replyfrom == e->env_id
+f010ae0e:	8b 1d 84 47 79 f0    	mov    0xf0794784,%ebx
+f010ae14:	8d 43 1c             	lea    0x1c(%ebx),%eax
+f010ae17:	81 c3 1c a0 05 00    	add    $0x5a01c,%ebx
+f010ae1d:	eb 05                	jmp    f010ae24 <ipc_env_free+0xfa>
+	for (i = 0; i < NENV; i++)
+f010ae1f:	05 68 01 00 00       	add    $0x168,%eax
+f010ae24:	39 d8                	cmp    %ebx,%eax
+f010ae26:	74 2a                	je     f010ae52 <ipc_env_free+0x128>
+		if (envs[i].env_ipc_replyfrom == e->env_id
+f010ae28:	8b 72 48             	mov    0x48(%edx),%esi
+f010ae2b:	39 b0 c8 00 00 00    	cmp    %esi,0xc8(%eax)
+f010ae31:	75 ec                	jne    f010ae1f <ipc_env_free+0xf5>
+		    && envs[i].env_status == ENV_NOT_RUNNABLE) {
+f010ae33:	83 78 38 04          	cmpl   $0x4,0x38(%eax)
+f010ae37:	75 e6                	jne    f010ae1f <ipc_env_free+0xf5>
+			envs[i].env_ipc_replyfrom = 0;
+f010ae39:	c7 80 c8 00 00 00 00 	movl   $0x0,0xc8(%eax)
+f010ae40:	00 00 00 
+	e->env_tf.tf_regs.reg_eax = r;
+f010ae43:	c7 00 fe ff ff ff    	movl   $0xfffffffe,(%eax)
+	e->env_status = ENV_RUNNABLE;
+f010ae49:	c7 40 38 02 00 00 00 	movl   $0x2,0x38(%eax)
+}
+f010ae50:	eb cd                	jmp    f010ae1f <ipc_env_free+0xf5>
+			ipc_wake(&envs[i], -E_BAD_ENV);
+		}
+}
+f010ae52:	5b                   	pop    %ebx
+f010ae53:	5e                   	pop    %esi
+f010ae54:	5d                   	pop    %ebp
+f010ae55:	c3                   	ret
+
+f010ae56 <futex_unlink>:
+}
+
+// Take sleeping env 'e' off its chain and let it return 'r'.
+static void
+futex_unlink(struct Env *e, int r)
+{
+f010ae56:	55                   	push   %ebp
+f010ae57:	89 e5                	mov    %esp,%ebp
+f010ae59:	57                   	push   %edi
+f010ae5a:	56                   	push   %esi
+f010ae5b:	53                   	push   %ebx
+f010ae5c:	89 c1                	mov    %eax,%ecx
+f010ae5e:	89 d7                	mov    %edx,%edi
+	return &futex_buckets[(pa >> 2) % FUTEX_NBUCKETS];
+f010ae60:	8b b0 3c 01 00 00    	mov    0x13c(%eax),%esi
+f010ae66:	c1 ee 02             	shr    $0x2,%esi
+f010ae69:	83 e6 3f             	and    $0x3f,%esi
+f010ae6c:	8d 14 f5 40 aa 7d f0 	lea    -0xf8255c0(,%esi,8),%edx
+	struct futex_bucket *b = futex_bucket(e->env_futex_pa);
+	struct Env **pp, *prev = NULL;
+
+	for (pp = &b->fb_head; *pp; prev = *pp, pp = &(*pp)->env_futex_next)
+f010ae73:	8b 04 f5 40 aa 7d f0 	mov    -0xf8255c0(,%esi,8),%eax
+	struct Env **pp, *prev = NULL;
+f010ae7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+	for (pp = &b->fb_head; *pp; prev = *pp, pp = &(*pp)->env_futex_next)
+f010ae7f:	eb 17                	jmp    f010ae98 <futex_unlink+0x42>
+		if (*pp == e) {
+			*pp = e->env_futex_next;
+			if (b->fb_tail == e)
+				b->fb_tail = prev;
+f010ae81:	89 1c f5 44 aa 7d f0 	mov    %ebx,-0xf8255bc(,%esi,8)
+f010ae88:	eb 27                	jmp    f010aeb1 <futex_unlink+0x5b>
+	for (pp = &b->fb_head; *pp; prev = *pp, pp = &(*pp)->env_futex_next)
+f010ae8a:	8d 90 40 01 00 00    	lea    0x140(%eax),%edx
+f010ae90:	89 c3                	mov    %eax,%ebx
+f010ae92:	8b 80 40 01 00 00    	mov    0x140(%eax),%eax
+f010ae98:	85 c0                	test   %eax,%eax
+f010ae9a:	74 15                	je     f010aeb1 <futex_unlink+0x5b>
+		if (*pp == e) {
+f010ae9c:	39 c8                	cmp    %ecx,%eax
+f010ae9e:	75 ea                	jne    f010ae8a <futex_unlink+0x34>
+			*pp = e->env_futex_next;
+f010aea0:	8b 81 40 01 00 00    	mov    0x140(%ecx),%eax
+f010aea6:	89 02                	mov    %eax,(%edx)
+			if (b->fb_tail == e)
+f010aea8:	39 0c f5 44 aa 7d f0 	cmp    %ecx,-0xf8255bc(,%esi,8)
+f010aeaf:	74 d0                	je     f010ae81 <futex_unlink+0x2b>
+			break;
+		}
+	if (e->env_futex_deadline)
+f010aeb1:	8b 81 48 01 00 00    	mov    0x148(%ecx),%eax
+f010aeb7:	0b 81 44 01 00 00    	or     0x144(%ecx),%eax
+f010aebd:	74 07                	je     f010aec6 <futex_unlink+0x70>
+		futex_ntimed--;
+f010aebf:	83 2d 28 aa 7d f0 01 	subl   $0x1,0xf07daa28
+	e->env_futex_pa = 0;
+f010aec6:	c7 81 3c 01 00 00 00 	movl   $0x0,0x13c(%ecx)
+f010aecd:	00 00 00 
+	e->env_futex_next = NULL;
+f010aed0:	c7 81 40 01 00 00 00 	movl   $0x0,0x140(%ecx)
+f010aed7:	00 00 00 
+	e->env_futex_deadline = 0;
+f010aeda:	c7 81 44 01 00 00 00 	movl   $0x0,0x144(%ecx)
+f010aee1:	00 00 00 
+f010aee4:	c7 81 48 01 00 00 00 	movl   $0x0,0x148(%ecx)
+f010aeeb:	00 00 00 
+	e->env_tf.tf_regs.reg_eax = r;
+f010aeee:	89 79 1c             	mov    %edi,0x1c(%ecx)
+	if (e->env_status == ENV_NOT_RUNNABLE)
+f010aef1:	83 79 54 04          	cmpl   $0x4,0x54(%ecx)
+f010aef5:	74 05                	je     f010aefc <futex_unlink+0xa6>
+		e->env_status = ENV_RUNNABLE;
+}
+f010aef7:	5b                   	pop    %ebx
+f010aef8:	5e                   	pop    %esi
+f010aef9:	5f                   	pop    %edi
+f010aefa:	5d                   	pop    %ebp
+f010aefb:	c3                   	ret
+		e->env_status = ENV_RUNNABLE;
+f010aefc:	c7 41 54 02 00 00 00 	movl   $0x2,0x54(%ecx)
+}
+f010af03:	eb f2                	jmp    f010aef7 <futex_unlink+0xa1>
+
+f010af05 <futex_key>:
+{
+f010af05:	55                   	push   %ebp
+f010af06:	89 e5                	mov    %esp,%ebp
+f010af08:	53                   	push   %ebx
+f010af09:	83 ec 04             	sub    $0x4,%esp
+f010af0c:	89 c3                	mov    %eax,%ebx
+	if (!(pp = page_lookup(curenv->env_pgdir, (void *) uaddr, NULL)))
+f010af0e:	e8 24 dd ff ff       	call   f0108c37 <cpunum>
+f010af13:	83 ec 04             	sub    $0x4,%esp
+f010af16:	6a 00                	push   $0x0
+f010af18:	53                   	push   %ebx
+f010af19:	6b c0 78             	imul   $0x78,%eax,%eax
+f010af1c:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f010af22:	ff 70 60             	push   0x60(%eax)
+f010af25:	e8 60 69 ff ff       	call   f010188a <page_lookup>
+f010af2a:	83 c4 10             	add    $0x10,%esp
+f010af2d:	85 c0                	test   %eax,%eax
+f010af2f:	74 19                	je     f010af4a <futex_key+0x45>
+	return (pp - pages) << PGSHIFT;
+f010af31:	2b 05 68 47 79 f0    	sub    0xf0794768,%eax
+f010af37:	c1 f8 03             	sar    $0x3,%eax
+f010af3a:	c1 e0 0c             	shl    $0xc,%eax
+	return page2pa(pp) + PGOFF(uaddr);
+f010af3d:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+f010af43:	01 d8                	add    %ebx,%eax
+}
+f010af45:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010af48:	c9                   	leave
+f010af49:	c3                   	ret
+		return 0;
+f010af4a:	b8 00 00 00 00       	mov    $0x0,%eax
+f010af4f:	eb f4                	jmp    f010af45 <futex_key+0x40>
+
+f010af51 <futex_wait>:
+//	-E_FAULT if uaddr can't be read.
+//	-E_AGAIN if the word does not hold 'expected'.
+//
+int
+futex_wait(const uint32_t *uaddr, uint32_t expected, nanoseconds_t timeout)
+{
+f010af51:	55                   	push   %ebp
+f010af52:	89 e5                	mov    %esp,%ebp
+f010af54:	57                   	push   %edi
+f010af55:	56                   	push   %esi
+f010af56:	53                   	push   %ebx
+f010af57:	83 ec 1c             	sub    $0x1c,%esp
+f010af5a:	8b 75 10             	mov    0x10(%ebp),%esi
+f010af5d:	8b 7d 14             	mov    0x14(%ebp),%edi
+	struct Env *e = curenv;
+f010af60:	e8 d2 dc ff ff       	call   f0108c37 <cpunum>
+f010af65:	6b c0 78             	imul   $0x78,%eax,%eax
+f010af68:	8b 98 28 60 7d f0    	mov    -0xf829fd8(%eax),%ebx
+	struct futex_bucket *b;
+	uint32_t val;
+	int r;
+
+	if ((uintptr_t) uaddr % 4 || (uintptr_t) uaddr >= UTOP)
+f010af6e:	f6 45 08 03          	testb  $0x3,0x8(%ebp)
+f010af72:	0f 85 2c 01 00 00    	jne    f010b0a4 <futex_wait+0x153>
+f010af78:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+f010af7f:	0f 87 1f 01 00 00    	ja     f010b0a4 <futex_wait+0x153>
+		return -E_INVAL;
+	if ((r = copyin(&val, uaddr, sizeof(val))) < 0)
+f010af85:	83 ec 04             	sub    $0x4,%esp
+f010af88:	6a 04                	push   $0x4
+f010af8a:	ff 75 08             	push   0x8(%ebp)
+f010af8d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f010af90:	50                   	push   %eax
+f010af91:	e8 78 af ff ff       	call   f0105f0e <copyin>
+f010af96:	83 c4 10             	add    $0x10,%esp
+f010af99:	85 c0                	test   %eax,%eax
+f010af9b:	0f 88 08 01 00 00    	js     f010b0a9 <futex_wait+0x158>
+		return r;
+	if (val != expected)
+f010afa1:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010afa4:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+f010afa7:	0f 85 04 01 00 00    	jne    f010b0b1 <futex_wait+0x160>
+		return -E_AGAIN;
+
+	assert(!e->env_futex_pa);
+f010afad:	83 bb 3c 01 00 00 00 	cmpl   $0x0,0x13c(%ebx)
+f010afb4:	75 6a                	jne    f010b020 <futex_wait+0xcf>
+	e->env_futex_pa = futex_key(uaddr);
+f010afb6:	8b 45 08             	mov    0x8(%ebp),%eax
+f010afb9:	e8 47 ff ff ff       	call   f010af05 <futex_key>
+f010afbe:	89 83 3c 01 00 00    	mov    %eax,0x13c(%ebx)
+	assert(e->env_futex_pa);
+f010afc4:	85 c0                	test   %eax,%eax
+f010afc6:	74 6e                	je     f010b036 <futex_wait+0xe5>
+	e->env_futex_next = NULL;
+f010afc8:	c7 83 40 01 00 00 00 	movl   $0x0,0x140(%ebx)
+f010afcf:	00 00 00 
+	e->env_futex_deadline = 0;
+f010afd2:	c7 83 44 01 00 00 00 	movl   $0x0,0x144(%ebx)
+f010afd9:	00 00 00 
+f010afdc:	c7 83 48 01 00 00 00 	movl   $0x0,0x148(%ebx)
+f010afe3:	00 00 00 
+	if (timeout) {
+f010afe6:	89 f8                	mov    %edi,%eax
+f010afe8:	09 f0                	or     %esi,%eax
+f010afea:	75 60                	jne    f010b04c <futex_wait+0xfb>
+	return &futex_buckets[(pa >> 2) % FUTEX_NBUCKETS];
+f010afec:	8b 83 3c 01 00 00    	mov    0x13c(%ebx),%eax
+f010aff2:	c1 e8 02             	shr    $0x2,%eax
+f010aff5:	83 e0 3f             	and    $0x3f,%eax
+		if (!futex_ntimed++
+		    || e->env_futex_deadline < futex_next_deadline)
+			futex_next_deadline = e->env_futex_deadline;
+	}
+	b = futex_bucket(e->env_futex_pa);
+	if (b->fb_tail)
+f010aff8:	8b 14 c5 44 aa 7d f0 	mov    -0xf8255bc(,%eax,8),%edx
+f010afff:	85 d2                	test   %edx,%edx
+f010b001:	0f 84 91 00 00 00    	je     f010b098 <futex_wait+0x147>
+		b->fb_tail->env_futex_next = e;
+f010b007:	89 9a 40 01 00 00    	mov    %ebx,0x140(%edx)
+	else
+		b->fb_head = e;
+	b->fb_tail = e;
+f010b00d:	89 1c c5 44 aa 7d f0 	mov    %ebx,-0xf8255bc(,%eax,8)
+
+	e->env_status = ENV_NOT_RUNNABLE;
+f010b014:	c7 43 54 04 00 00 00 	movl   $0x4,0x54(%ebx)
+	sched_yield();
+f010b01b:	e8 11 b1 ff ff       	call   f0106131 <sched_yield>
+	assert(!e->env_futex_pa);
+f010b020:	68 7e e3 10 f0       	push   $0xf010e37e
+f010b025:	68 bf be 10 f0       	push   $0xf010bebf
+f010b02a:	6a 71                	push   $0x71
+f010b02c:	68 8f e3 10 f0       	push   $0xf010e38f
+f010b031:	e8 0d 50 ff ff       	call   f0100043 <_panic>
+	assert(e->env_futex_pa);
+f010b036:	68 7f e3 10 f0       	push   $0xf010e37f
+f010b03b:	68 bf be 10 f0       	push   $0xf010bebf
+f010b040:	6a 73                	push   $0x73
+f010b042:	68 8f e3 10 f0       	push   $0xf010e38f
+f010b047:	e8 f7 4f ff ff       	call   f0100043 <_panic>
+		e->env_futex_deadline = time_now() + timeout;
+f010b04c:	e8 f4 e3 ff ff       	call   f0109445 <time_now>
+f010b051:	01 f0                	add    %esi,%eax
+f010b053:	11 fa                	adc    %edi,%edx
+f010b055:	89 83 44 01 00 00    	mov    %eax,0x144(%ebx)
+f010b05b:	89 93 48 01 00 00    	mov    %edx,0x148(%ebx)
+		if (!futex_ntimed++
+f010b061:	8b 0d 28 aa 7d f0    	mov    0xf07daa28,%ecx
+f010b067:	8d 71 01             	lea    0x1(%ecx),%esi
+f010b06a:	89 35 28 aa 7d f0    	mov    %esi,0xf07daa28
+f010b070:	85 c9                	test   %ecx,%ecx
+f010b072:	74 14                	je     f010b088 <futex_wait+0x137>
+		    || e->env_futex_deadline < futex_next_deadline)
+f010b074:	3b 05 20 aa 7d f0    	cmp    0xf07daa20,%eax
+f010b07a:	89 d7                	mov    %edx,%edi
+f010b07c:	1b 3d 24 aa 7d f0    	sbb    0xf07daa24,%edi
+f010b082:	0f 83 64 ff ff ff    	jae    f010afec <futex_wait+0x9b>
+			futex_next_deadline = e->env_futex_deadline;
+f010b088:	a3 20 aa 7d f0       	mov    %eax,0xf07daa20
+f010b08d:	89 15 24 aa 7d f0    	mov    %edx,0xf07daa24
+f010b093:	e9 54 ff ff ff       	jmp    f010afec <futex_wait+0x9b>
+		b->fb_head = e;
+f010b098:	89 1c c5 40 aa 7d f0 	mov    %ebx,-0xf8255c0(,%eax,8)
+f010b09f:	e9 69 ff ff ff       	jmp    f010b00d <futex_wait+0xbc>
+		return -E_INVAL;
+f010b0a4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+f010b0a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010b0ac:	5b                   	pop    %ebx
+f010b0ad:	5e                   	pop    %esi
+f010b0ae:	5f                   	pop    %edi
+f010b0af:	5d                   	pop    %ebp
+f010b0b0:	c3                   	ret
+		return -E_AGAIN;
+f010b0b1:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+f010b0b6:	eb f1                	jmp    f010b0a9 <futex_wait+0x158>
+
+f010b0b8 <futex_wake>:
+// Returns the number woken, which is 0 if nothing is mapped at uaddr,
+// or -E_INVAL if uaddr is not 4-byte aligned or is above UTOP.
+//
+int
+futex_wake(const uint32_t *uaddr, int n)
+{
+f010b0b8:	55                   	push   %ebp
+f010b0b9:	89 e5                	mov    %esp,%ebp
+f010b0bb:	57                   	push   %edi
+f010b0bc:	56                   	push   %esi
+f010b0bd:	53                   	push   %ebx
+f010b0be:	83 ec 0c             	sub    $0xc,%esp
+f010b0c1:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Env *e, *next;
+	physaddr_t pa;
+	int woken = 0;
+
+	if ((uintptr_t) uaddr % 4 || (uintptr_t) uaddr >= UTOP)
+f010b0c4:	a8 03                	test   $0x3,%al
+f010b0c6:	75 4e                	jne    f010b116 <futex_wake+0x5e>
+f010b0c8:	3d ff ff bf ee       	cmp    $0xeebfffff,%eax
+f010b0cd:	77 47                	ja     f010b116 <futex_wake+0x5e>
+		return -E_INVAL;
+	if (!(pa = futex_key(uaddr)))
+f010b0cf:	e8 31 fe ff ff       	call   f010af05 <futex_key>
+f010b0d4:	89 c7                	mov    %eax,%edi
+		return 0;
+f010b0d6:	be 00 00 00 00       	mov    $0x0,%esi
+	if (!(pa = futex_key(uaddr)))
+f010b0db:	85 c0                	test   %eax,%eax
+f010b0dd:	74 3c                	je     f010b11b <futex_wake+0x63>
+	return &futex_buckets[(pa >> 2) % FUTEX_NBUCKETS];
+f010b0df:	c1 e8 02             	shr    $0x2,%eax
+f010b0e2:	83 e0 3f             	and    $0x3f,%eax
+	for (e = futex_bucket(pa)->fb_head; e && woken < n; e = next) {
+f010b0e5:	8b 04 c5 40 aa 7d f0 	mov    -0xf8255c0(,%eax,8),%eax
+f010b0ec:	eb 02                	jmp    f010b0f0 <futex_wake+0x38>
+{
+f010b0ee:	89 d8                	mov    %ebx,%eax
+	for (e = futex_bucket(pa)->fb_head; e && woken < n; e = next) {
+f010b0f0:	85 c0                	test   %eax,%eax
+f010b0f2:	74 27                	je     f010b11b <futex_wake+0x63>
+f010b0f4:	3b 75 0c             	cmp    0xc(%ebp),%esi
+f010b0f7:	7d 22                	jge    f010b11b <futex_wake+0x63>
+		next = e->env_futex_next;
+f010b0f9:	8b 98 40 01 00 00    	mov    0x140(%eax),%ebx
+		if (e->env_futex_pa == pa) {
+f010b0ff:	39 b8 3c 01 00 00    	cmp    %edi,0x13c(%eax)
+f010b105:	75 e7                	jne    f010b0ee <futex_wake+0x36>
+			futex_unlink(e, 0);
+f010b107:	ba 00 00 00 00       	mov    $0x0,%edx
+f010b10c:	e8 45 fd ff ff       	call   f010ae56 <futex_unlink>
+			woken++;
+f010b111:	83 c6 01             	add    $0x1,%esi
+f010b114:	eb d8                	jmp    f010b0ee <futex_wake+0x36>
+		return -E_INVAL;
+f010b116:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+		}
+	}
+	return woken;
+}
+f010b11b:	89 f0                	mov    %esi,%eax
+f010b11d:	83 c4 0c             	add    $0xc,%esp
+f010b120:	5b                   	pop    %ebx
+f010b121:	5e                   	pop    %esi
+f010b122:	5f                   	pop    %edi
+f010b123:	5d                   	pop    %ebp
+f010b124:	c3                   	ret
+
+f010b125 <futex_tick>:
+{
+	nanoseconds_t now, next_deadline = 0;
+	struct Env *e, *next;
+	int i;
+
+	if (!futex_ntimed || (now = time_now()) < futex_next_deadline)
+f010b125:	83 3d 28 aa 7d f0 00 	cmpl   $0x0,0xf07daa28
+f010b12c:	75 01                	jne    f010b12f <futex_tick+0xa>
+f010b12e:	c3                   	ret
+{
+f010b12f:	55                   	push   %ebp
+f010b130:	89 e5                	mov    %esp,%ebp
+f010b132:	57                   	push   %edi
+f010b133:	56                   	push   %esi
+f010b134:	53                   	push   %ebx
+f010b135:	83 ec 1c             	sub    $0x1c,%esp
+	if (!futex_ntimed || (now = time_now()) < futex_next_deadline)
+f010b138:	e8 08 e3 ff ff       	call   f0109445 <time_now>
+f010b13d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f010b140:	89 55 dc             	mov    %edx,-0x24(%ebp)
+f010b143:	3b 05 20 aa 7d f0    	cmp    0xf07daa20,%eax
+f010b149:	1b 15 24 aa 7d f0    	sbb    0xf07daa24,%edx
+f010b14f:	0f 82 8b 00 00 00    	jb     f010b1e0 <futex_tick+0xbb>
+		return;
+	for (i = 0; i < FUTEX_NBUCKETS; i++)
+f010b155:	bf 00 00 00 00       	mov    $0x0,%edi
+	nanoseconds_t now, next_deadline = 0;
+f010b15a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+f010b161:	be 00 00 00 00       	mov    $0x0,%esi
+f010b166:	eb 5e                	jmp    f010b1c6 <futex_tick+0xa1>
+		for (e = futex_buckets[i].fb_head; e; e = next) {
+			next = e->env_futex_next;
+			if (!e->env_futex_deadline)
+				continue;
+			if (e->env_futex_deadline <= now)
+				futex_unlink(e, -E_TIMEOUT);
+f010b168:	ba f3 ff ff ff       	mov    $0xfffffff3,%edx
+f010b16d:	e8 e4 fc ff ff       	call   f010ae56 <futex_unlink>
+f010b172:	eb 05                	jmp    f010b179 <futex_tick+0x54>
+			else if (!next_deadline
+				 || e->env_futex_deadline < next_deadline)
+				next_deadline = e->env_futex_deadline;
+f010b174:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+f010b177:	89 d6                	mov    %edx,%esi
+f010b179:	89 d8                	mov    %ebx,%eax
+		for (e = futex_buckets[i].fb_head; e; e = next) {
+f010b17b:	85 c0                	test   %eax,%eax
+f010b17d:	74 3c                	je     f010b1bb <futex_tick+0x96>
+			next = e->env_futex_next;
+f010b17f:	8b 98 40 01 00 00    	mov    0x140(%eax),%ebx
+			if (!e->env_futex_deadline)
+f010b185:	8b 88 44 01 00 00    	mov    0x144(%eax),%ecx
+f010b18b:	8b 90 48 01 00 00    	mov    0x148(%eax),%edx
+f010b191:	89 d7                	mov    %edx,%edi
+f010b193:	09 cf                	or     %ecx,%edi
+f010b195:	74 e2                	je     f010b179 <futex_tick+0x54>
+			if (e->env_futex_deadline <= now)
+f010b197:	39 4d e0             	cmp    %ecx,-0x20(%ebp)
+f010b19a:	8b 7d dc             	mov    -0x24(%ebp),%edi
+f010b19d:	19 d7                	sbb    %edx,%edi
+f010b19f:	73 c7                	jae    f010b168 <futex_tick+0x43>
+			else if (!next_deadline
+f010b1a1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010b1a4:	89 c7                	mov    %eax,%edi
+f010b1a6:	09 f7                	or     %esi,%edi
+f010b1a8:	74 ca                	je     f010b174 <futex_tick+0x4f>
+f010b1aa:	39 c1                	cmp    %eax,%ecx
+f010b1ac:	89 d7                	mov    %edx,%edi
+f010b1ae:	19 f7                	sbb    %esi,%edi
+f010b1b0:	0f 43 c8             	cmovae %eax,%ecx
+f010b1b3:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+f010b1b6:	0f 42 f2             	cmovb  %edx,%esi
+f010b1b9:	eb be                	jmp    f010b179 <futex_tick+0x54>
+	for (i = 0; i < FUTEX_NBUCKETS; i++)
+f010b1bb:	8b 7d d8             	mov    -0x28(%ebp),%edi
+f010b1be:	83 c7 01             	add    $0x1,%edi
+f010b1c1:	83 ff 40             	cmp    $0x40,%edi
+f010b1c4:	74 0c                	je     f010b1d2 <futex_tick+0xad>
+		for (e = futex_buckets[i].fb_head; e; e = next) {
+f010b1c6:	8b 04 fd 40 aa 7d f0 	mov    -0xf8255c0(,%edi,8),%eax
+f010b1cd:	89 7d d8             	mov    %edi,-0x28(%ebp)
+f010b1d0:	eb a9                	jmp    f010b17b <futex_tick+0x56>
+		}
+	futex_next_deadline = next_deadline;
+f010b1d2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010b1d5:	a3 20 aa 7d f0       	mov    %eax,0xf07daa20
+f010b1da:	89 35 24 aa 7d f0    	mov    %esi,0xf07daa24
+}
+f010b1e0:	83 c4 1c             	add    $0x1c,%esp
+f010b1e3:	5b                   	pop    %ebx
+f010b1e4:	5e                   	pop    %esi
+f010b1e5:	5f                   	pop    %edi
+f010b1e6:	5d                   	pop    %ebp
+f010b1e7:	c3                   	ret
+
+f010b1e8 <futex_timers_pending>:
+// Is anyone waiting for a deadline?  An idle machine must keep taking
+// timer ticks for them instead of dropping into the monitor.
+bool
+futex_timers_pending(void)
+{
+	return futex_ntimed > 0;
+f010b1e8:	83 3d 28 aa 7d f0 00 	cmpl   $0x0,0xf07daa28
+f010b1ef:	0f 95 c0             	setne  %al
+}
+f010b1f2:	c3                   	ret
+
+f010b1f3 <futex_page_busy>:
+// Is anyone asleep on a word in the physical page at 'pa'?  Such a
+// page must stay where it is: same-page merging would move the word
+// to another page and the sleepers would never be found.
+bool
+futex_page_busy(physaddr_t pa)
+{
+f010b1f3:	55                   	push   %ebp
+f010b1f4:	89 e5                	mov    %esp,%ebp
+f010b1f6:	53                   	push   %ebx
+f010b1f7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	struct Env *e;
+	int i;
+
+	for (i = 0; i < FUTEX_NBUCKETS; i++)
+f010b1fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+		for (e = futex_buckets[i].fb_head; e; e = e->env_futex_next)
+f010b1ff:	8b 04 dd 40 aa 7d f0 	mov    -0xf8255c0(,%ebx,8),%eax
+f010b206:	eb 06                	jmp    f010b20e <futex_page_busy+0x1b>
+f010b208:	8b 80 40 01 00 00    	mov    0x140(%eax),%eax
+f010b20e:	85 c0                	test   %eax,%eax
+f010b210:	74 1a                	je     f010b22c <futex_page_busy+0x39>
+			if (PTE_ADDR(e->env_futex_pa) == pa)
+f010b212:	8b 90 3c 01 00 00    	mov    0x13c(%eax),%edx
+f010b218:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f010b21e:	39 ca                	cmp    %ecx,%edx
+f010b220:	75 e6                	jne    f010b208 <futex_page_busy+0x15>
+				return 1;
+f010b222:	b8 01 00 00 00       	mov    $0x1,%eax
+	return 0;
+}
+f010b227:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010b22a:	c9                   	leave
+f010b22b:	c3                   	ret
+	for (i = 0; i < FUTEX_NBUCKETS; i++)
+f010b22c:	83 c3 01             	add    $0x1,%ebx
+f010b22f:	83 fb 40             	cmp    $0x40,%ebx
+f010b232:	75 cb                	jne    f010b1ff <futex_page_busy+0xc>
+f010b234:	eb f1                	jmp    f010b227 <futex_page_busy+0x34>
+
+f010b236 <futex_env_free>:
+
+// Take env 'e', which is being freed, off the chain it sleeps in.
+void
+futex_env_free(struct Env *e)
+{
+f010b236:	55                   	push   %ebp
+f010b237:	89 e5                	mov    %esp,%ebp
+f010b239:	83 ec 08             	sub    $0x8,%esp
+f010b23c:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (e->env_futex_pa)
+f010b23f:	83 b8 3c 01 00 00 00 	cmpl   $0x0,0x13c(%eax)
+f010b246:	75 02                	jne    f010b24a <futex_env_free+0x14>
+		futex_unlink(e, -E_BAD_ENV);
+}
+f010b248:	c9                   	leave
+f010b249:	c3                   	ret
+		futex_unlink(e, -E_BAD_ENV);
+f010b24a:	ba fe ff ff ff       	mov    $0xfffffffe,%edx
+f010b24f:	e8 02 fc ff ff       	call   f010ae56 <futex_unlink>
+}
+f010b254:	eb f2                	jmp    f010b248 <futex_env_free+0x12>
+
+f010b256 <ep_bit>:
+
+static struct endpoint endpoints[NENDPOINT];
+
+static bool
+ep_bit(const uint32_t *map, int x)
+{
+f010b256:	55                   	push   %ebp
+f010b257:	89 e5                	mov    %esp,%ebp
+f010b259:	53                   	push   %ebx
+f010b25a:	89 c3                	mov    %eax,%ebx
+f010b25c:	89 d1                	mov    %edx,%ecx
+	return map[x / 32] & (1U << (x % 32));
+f010b25e:	8d 52 1f             	lea    0x1f(%edx),%edx
+f010b261:	85 c9                	test   %ecx,%ecx
+f010b263:	0f 49 d1             	cmovns %ecx,%edx
+f010b266:	c1 fa 05             	sar    $0x5,%edx
+f010b269:	b8 01 00 00 00       	mov    $0x1,%eax
+f010b26e:	d3 e0                	shl    %cl,%eax
+f010b270:	23 04 93             	and    (%ebx,%edx,4),%eax
+f010b273:	0f 95 c0             	setne  %al
+}
+f010b276:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010b279:	c9                   	leave
+f010b27a:	c3                   	ret
+
+f010b27b <ep_bit_set>:
+
+static void
+ep_bit_set(uint32_t *map, int x)
+{
+f010b27b:	55                   	push   %ebp
+f010b27c:	89 e5                	mov    %esp,%ebp
+f010b27e:	53                   	push   %ebx
+f010b27f:	89 c3                	mov    %eax,%ebx
+f010b281:	89 d1                	mov    %edx,%ecx
+	map[x / 32] |= 1U << (x % 32);
+f010b283:	8d 42 1f             	lea    0x1f(%edx),%eax
+f010b286:	85 d2                	test   %edx,%edx
+f010b288:	0f 49 c2             	cmovns %edx,%eax
+f010b28b:	c1 f8 05             	sar    $0x5,%eax
+f010b28e:	ba 01 00 00 00       	mov    $0x1,%edx
+f010b293:	d3 e2                	shl    %cl,%edx
+f010b295:	09 14 83             	or     %edx,(%ebx,%eax,4)
+}
+f010b298:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010b29b:	c9                   	leave
+f010b29c:	c3                   	ret
+
+f010b29d <ep_lookup>:
+}
+
+// Find the live endpoint with ID 'epid'.
+static struct endpoint *
+ep_lookup(epid_t epid)
+{
+f010b29d:	55                   	push   %ebp
+f010b29e:	89 e5                	mov    %esp,%ebp
+f010b2a0:	53                   	push   %ebx
+	struct endpoint *ep;
+
+	if (epid <= 0)
+f010b2a1:	85 c0                	test   %eax,%eax
+f010b2a3:	7e 2c                	jle    f010b2d1 <ep_lookup+0x34>
+		return NULL;
+	ep = &endpoints[EPX(epid)];
+f010b2a5:	0f b6 d0             	movzbl %al,%edx
+	if (!ep->ep_owner || ep->ep_id != epid)
+f010b2a8:	8d 0c 92             	lea    (%edx,%edx,4),%ecx
+f010b2ab:	83 3c 8d 44 ac 7d f0 	cmpl   $0x0,-0xf8253bc(,%ecx,4)
+f010b2b2:	00 
+f010b2b3:	74 23                	je     f010b2d8 <ep_lookup+0x3b>
+		return NULL;
+f010b2b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (!ep->ep_owner || ep->ep_id != epid)
+f010b2ba:	39 04 8d 40 ac 7d f0 	cmp    %eax,-0xf8253c0(,%ecx,4)
+f010b2c1:	75 07                	jne    f010b2ca <ep_lookup+0x2d>
+	ep = &endpoints[EPX(epid)];
+f010b2c3:	8d 1c 8d 40 ac 7d f0 	lea    -0xf8253c0(,%ecx,4),%ebx
+	return ep;
+}
+f010b2ca:	89 d8                	mov    %ebx,%eax
+f010b2cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010b2cf:	c9                   	leave
+f010b2d0:	c3                   	ret
+		return NULL;
+f010b2d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010b2d6:	eb f2                	jmp    f010b2ca <ep_lookup+0x2d>
+		return NULL;
+f010b2d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010b2dd:	eb eb                	jmp    f010b2ca <ep_lookup+0x2d>
+
+f010b2df <ep_release>:
+
+// Free 'ep': fail the senders waiting on it and take away every
+// capability for it.
+static void
+ep_release(struct endpoint *ep)
+{
+f010b2df:	55                   	push   %ebp
+f010b2e0:	89 e5                	mov    %esp,%ebp
+f010b2e2:	56                   	push   %esi
+f010b2e3:	53                   	push   %ebx
+f010b2e4:	89 c3                	mov    %eax,%ebx
+	struct Env *s;
+	int x = EPX(ep->ep_id), i;
+f010b2e6:	8b 08                	mov    (%eax),%ecx
+f010b2e8:	0f b6 d1             	movzbl %cl,%edx
+
+	while ((s = ep_dequeue(ep)))
+f010b2eb:	eb 26                	jmp    f010b313 <ep_release+0x34>
+		ep->ep_qlen--;
+f010b2ed:	83 6b 10 01          	subl   $0x1,0x10(%ebx)
+		s->env_ep_qnext = NULL;
+f010b2f1:	c7 80 34 01 00 00 00 	movl   $0x0,0x134(%eax)
+f010b2f8:	00 00 00 
+		s->env_ep_sendto = 0;
+f010b2fb:	c7 80 30 01 00 00 00 	movl   $0x0,0x130(%eax)
+f010b302:	00 00 00 
+	e->env_tf.tf_regs.reg_eax = r;
+f010b305:	c7 40 1c f6 ff ff ff 	movl   $0xfffffff6,0x1c(%eax)
+	e->env_status = ENV_RUNNABLE;
+f010b30c:	c7 40 54 02 00 00 00 	movl   $0x2,0x54(%eax)
+	struct Env *s = ep->ep_qhead;
+f010b313:	8b 43 08             	mov    0x8(%ebx),%eax
+	if (s) {
+f010b316:	85 c0                	test   %eax,%eax
+f010b318:	74 16                	je     f010b330 <ep_release+0x51>
+		if (!(ep->ep_qhead = s->env_ep_qnext))
+f010b31a:	8b b0 34 01 00 00    	mov    0x134(%eax),%esi
+f010b320:	89 73 08             	mov    %esi,0x8(%ebx)
+f010b323:	85 f6                	test   %esi,%esi
+f010b325:	75 c6                	jne    f010b2ed <ep_release+0xe>
+			ep->ep_qtail = NULL;
+f010b327:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+f010b32e:	eb bd                	jmp    f010b2ed <ep_release+0xe>
+	map[x / 32] &= ~(1U << (x % 32));
+f010b330:	c1 ea 05             	shr    $0x5,%edx
+f010b333:	c1 e2 02             	shl    $0x2,%edx
+f010b336:	be fe ff ff ff       	mov    $0xfffffffe,%esi
+f010b33b:	d3 c6                	rol    %cl,%esi
+f010b33d:	b8 00 00 00 00       	mov    $0x0,%eax
+		ep_wake(s, -E_NOT_FOUND);
+	for (i = 0; i < NENV; i++) {
+		ep_bit_clear(envs[i].env_ep_caps, x);
+f010b342:	89 c1                	mov    %eax,%ecx
+f010b344:	03 0d 84 47 79 f0    	add    0xf0794784,%ecx
+	map[x / 32] &= ~(1U << (x % 32));
+f010b34a:	21 b4 0a ec 00 00 00 	and    %esi,0xec(%edx,%ecx,1)
+		ep_bit_clear(envs[i].env_ep_waitset, x);
+f010b351:	89 c1                	mov    %eax,%ecx
+f010b353:	03 0d 84 47 79 f0    	add    0xf0794784,%ecx
+	map[x / 32] &= ~(1U << (x % 32));
+f010b359:	21 b4 0a 0c 01 00 00 	and    %esi,0x10c(%edx,%ecx,1)
+	for (i = 0; i < NENV; i++) {
+f010b360:	05 68 01 00 00       	add    $0x168,%eax
+f010b365:	3d 00 a0 05 00       	cmp    $0x5a000,%eax
+f010b36a:	75 d6                	jne    f010b342 <ep_release+0x63>
+	}
+	ep->ep_owner = 0;
+f010b36c:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+f010b373:	5b                   	pop    %ebx
+f010b374:	5e                   	pop    %esi
+f010b375:	5d                   	pop    %ebp
+f010b376:	c3                   	ret
+
+f010b377 <ep_create>:
+// Returns the new endpoint's ID, or -E_NO_MEM if all NENDPOINT
+// endpoints are in use.
+//
+int
+ep_create(void)
+{
+f010b377:	55                   	push   %ebp
+f010b378:	89 e5                	mov    %esp,%ebp
+f010b37a:	57                   	push   %edi
+f010b37b:	56                   	push   %esi
+f010b37c:	53                   	push   %ebx
+f010b37d:	83 ec 0c             	sub    $0xc,%esp
+	struct endpoint *ep;
+	int32_t generation;
+	int i;
+
+	for (i = 0; i < NENDPOINT; i++)
+f010b380:	b8 44 ac 7d f0       	mov    $0xf07dac44,%eax
+f010b385:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!endpoints[i].ep_owner)
+f010b38a:	83 c0 14             	add    $0x14,%eax
+f010b38d:	83 78 ec 00          	cmpl   $0x0,-0x14(%eax)
+f010b391:	74 15                	je     f010b3a8 <ep_create+0x31>
+	for (i = 0; i < NENDPOINT; i++)
+f010b393:	83 c3 01             	add    $0x1,%ebx
+f010b396:	81 fb 00 01 00 00    	cmp    $0x100,%ebx
+f010b39c:	75 ec                	jne    f010b38a <ep_create+0x13>
+			break;
+	if (i == NENDPOINT)
+		return -E_NO_MEM;
+f010b39e:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f010b3a3:	e9 83 00 00 00       	jmp    f010b42b <ep_create+0xb4>
+
+	ep = &endpoints[i];
+	generation = (ep->ep_id + (1 << LOG2NENDPOINT)) & ~(NENDPOINT - 1);
+f010b3a8:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+f010b3ab:	8b 04 85 40 ac 7d f0 	mov    -0xf8253c0(,%eax,4),%eax
+f010b3b2:	05 00 01 00 00       	add    $0x100,%eax
+	if (generation <= 0)	// Don't create a negative epid.
+		generation = 1 << LOG2NENDPOINT;
+f010b3b7:	25 00 ff ff ff       	and    $0xffffff00,%eax
+f010b3bc:	ba 00 01 00 00       	mov    $0x100,%edx
+f010b3c1:	0f 4e c2             	cmovle %edx,%eax
+	ep->ep_id = generation | i;
+f010b3c4:	8d 34 9d 00 00 00 00 	lea    0x0(,%ebx,4),%esi
+f010b3cb:	8d 14 1e             	lea    (%esi,%ebx,1),%edx
+f010b3ce:	c1 e2 02             	shl    $0x2,%edx
+f010b3d1:	8d ba 40 ac 7d f0    	lea    -0xf8253c0(%edx),%edi
+f010b3d7:	09 d8                	or     %ebx,%eax
+f010b3d9:	89 82 40 ac 7d f0    	mov    %eax,-0xf8253c0(%edx)
+	ep->ep_owner = curenv->env_id;
+f010b3df:	e8 53 d8 ff ff       	call   f0108c37 <cpunum>
+f010b3e4:	6b c0 78             	imul   $0x78,%eax,%eax
+f010b3e7:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f010b3ed:	8b 40 48             	mov    0x48(%eax),%eax
+f010b3f0:	89 47 04             	mov    %eax,0x4(%edi)
+	ep->ep_qhead = ep->ep_qtail = NULL;
+f010b3f3:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+f010b3fa:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+	ep->ep_qlen = 0;
+f010b401:	c7 47 10 00 00 00 00 	movl   $0x0,0x10(%edi)
+	ep_bit_set(curenv->env_ep_caps, i);
+f010b408:	e8 2a d8 ff ff       	call   f0108c37 <cpunum>
+f010b40d:	6b c0 78             	imul   $0x78,%eax,%eax
+f010b410:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f010b416:	05 ec 00 00 00       	add    $0xec,%eax
+f010b41b:	89 da                	mov    %ebx,%edx
+f010b41d:	e8 59 fe ff ff       	call   f010b27b <ep_bit_set>
+	return ep->ep_id;
+f010b422:	01 de                	add    %ebx,%esi
+f010b424:	8b 04 b5 40 ac 7d f0 	mov    -0xf8253c0(,%esi,4),%eax
+}
+f010b42b:	83 c4 0c             	add    $0xc,%esp
+f010b42e:	5b                   	pop    %ebx
+f010b42f:	5e                   	pop    %esi
+f010b430:	5f                   	pop    %edi
+f010b431:	5d                   	pop    %ebp
+f010b432:	c3                   	ret
+
+f010b433 <ep_destroy>:
+// Returns 0 on success, -E_NOT_FOUND if there is no such endpoint of
+// ours.
+//
+int
+ep_destroy(epid_t epid)
+{
+f010b433:	55                   	push   %ebp
+f010b434:	89 e5                	mov    %esp,%ebp
+f010b436:	56                   	push   %esi
+f010b437:	53                   	push   %ebx
+	struct endpoint *ep;
+
+	if (!(ep = ep_lookup(epid)) || ep->ep_owner != curenv->env_id)
+f010b438:	8b 45 08             	mov    0x8(%ebp),%eax
+f010b43b:	e8 5d fe ff ff       	call   f010b29d <ep_lookup>
+f010b440:	85 c0                	test   %eax,%eax
+f010b442:	74 28                	je     f010b46c <ep_destroy+0x39>
+f010b444:	89 c3                	mov    %eax,%ebx
+f010b446:	8b 70 04             	mov    0x4(%eax),%esi
+f010b449:	e8 e9 d7 ff ff       	call   f0108c37 <cpunum>
+f010b44e:	6b c0 78             	imul   $0x78,%eax,%eax
+f010b451:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f010b457:	3b 70 48             	cmp    0x48(%eax),%esi
+f010b45a:	75 17                	jne    f010b473 <ep_destroy+0x40>
+		return -E_NOT_FOUND;
+	ep_release(ep);
+f010b45c:	89 d8                	mov    %ebx,%eax
+f010b45e:	e8 7c fe ff ff       	call   f010b2df <ep_release>
+	return 0;
+f010b463:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f010b468:	5b                   	pop    %ebx
+f010b469:	5e                   	pop    %esi
+f010b46a:	5d                   	pop    %ebp
+f010b46b:	c3                   	ret
+		return -E_NOT_FOUND;
+f010b46c:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+f010b471:	eb f5                	jmp    f010b468 <ep_destroy+0x35>
+f010b473:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+f010b478:	eb ee                	jmp    f010b468 <ep_destroy+0x35>
+
+f010b47a <ep_grant>:
+// Returns 0 on success, -E_NOT_FOUND if there is no such endpoint or
+// we may not send to it.
+//
+int
+ep_grant(epid_t epid, struct Env *e)
+{
+f010b47a:	55                   	push   %ebp
+f010b47b:	89 e5                	mov    %esp,%ebp
+f010b47d:	53                   	push   %ebx
+f010b47e:	83 ec 04             	sub    $0x4,%esp
+f010b481:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!ep_lookup(epid) || !ep_bit(curenv->env_ep_caps, EPX(epid)))
+f010b484:	89 d8                	mov    %ebx,%eax
+f010b486:	e8 12 fe ff ff       	call   f010b29d <ep_lookup>
+f010b48b:	85 c0                	test   %eax,%eax
+f010b48d:	74 3a                	je     f010b4c9 <ep_grant+0x4f>
+f010b48f:	0f b6 db             	movzbl %bl,%ebx
+f010b492:	e8 a0 d7 ff ff       	call   f0108c37 <cpunum>
+f010b497:	6b c0 78             	imul   $0x78,%eax,%eax
+f010b49a:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f010b4a0:	05 ec 00 00 00       	add    $0xec,%eax
+f010b4a5:	89 da                	mov    %ebx,%edx
+f010b4a7:	e8 aa fd ff ff       	call   f010b256 <ep_bit>
+f010b4ac:	84 c0                	test   %al,%al
+f010b4ae:	74 20                	je     f010b4d0 <ep_grant+0x56>
+		return -E_NOT_FOUND;
+	ep_bit_set(e->env_ep_caps, EPX(epid));
+f010b4b0:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010b4b3:	05 ec 00 00 00       	add    $0xec,%eax
+f010b4b8:	89 da                	mov    %ebx,%edx
+f010b4ba:	e8 bc fd ff ff       	call   f010b27b <ep_bit_set>
+	return 0;
+f010b4bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f010b4c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010b4c7:	c9                   	leave
+f010b4c8:	c3                   	ret
+		return -E_NOT_FOUND;
+f010b4c9:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+f010b4ce:	eb f4                	jmp    f010b4c4 <ep_grant+0x4a>
+f010b4d0:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+f010b4d5:	eb ed                	jmp    f010b4c4 <ep_grant+0x4a>
+
+f010b4d7 <ep_send>:
+//	-E_INVAL if we own the endpoint.
+//	-E_AGAIN if EP_QUEUE_MAX senders are already waiting.
+//
+int
+ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+f010b4d7:	55                   	push   %ebp
+f010b4d8:	89 e5                	mov    %esp,%ebp
+f010b4da:	57                   	push   %edi
+f010b4db:	56                   	push   %esi
+f010b4dc:	53                   	push   %ebx
+f010b4dd:	83 ec 1c             	sub    $0x1c,%esp
+	struct endpoint *ep;
+	struct Env *owner, *src = curenv;
+f010b4e0:	e8 52 d7 ff ff       	call   f0108c37 <cpunum>
+f010b4e5:	6b c0 78             	imul   $0x78,%eax,%eax
+f010b4e8:	8b b0 28 60 7d f0    	mov    -0xf829fd8(%eax),%esi
+
+	if (!(ep = ep_lookup(epid)) || !ep_bit(src->env_ep_caps, EPX(epid)))
+f010b4ee:	8b 45 08             	mov    0x8(%ebp),%eax
+f010b4f1:	e8 a7 fd ff ff       	call   f010b29d <ep_lookup>
+f010b4f6:	85 c0                	test   %eax,%eax
+f010b4f8:	0f 84 3d 01 00 00    	je     f010b63b <ep_send+0x164>
+f010b4fe:	89 c7                	mov    %eax,%edi
+f010b500:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+f010b504:	89 c1                	mov    %eax,%ecx
+f010b506:	8d 86 ec 00 00 00    	lea    0xec(%esi),%eax
+f010b50c:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+f010b50f:	89 ca                	mov    %ecx,%edx
+f010b511:	e8 40 fd ff ff       	call   f010b256 <ep_bit>
+f010b516:	84 c0                	test   %al,%al
+f010b518:	0f 84 24 01 00 00    	je     f010b642 <ep_send+0x16b>
+		return -E_NOT_FOUND;
+	owner = &envs[ENVX(ep->ep_owner)];
+f010b51e:	8b 5f 04             	mov    0x4(%edi),%ebx
+f010b521:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+f010b527:	69 db 68 01 00 00    	imul   $0x168,%ebx,%ebx
+f010b52d:	03 1d 84 47 79 f0    	add    0xf0794784,%ebx
+	if (owner == src)
+f010b533:	39 de                	cmp    %ebx,%esi
+f010b535:	0f 84 0e 01 00 00    	je     f010b649 <ep_send+0x172>
+		return -E_INVAL;
+
+	if (owner->env_ep_waiting && ep_bit(owner->env_ep_waitset, EPX(epid))) {
+f010b53b:	80 bb 2c 01 00 00 00 	cmpb   $0x0,0x12c(%ebx)
+f010b542:	74 16                	je     f010b55a <ep_send+0x83>
+f010b544:	8d 83 0c 01 00 00    	lea    0x10c(%ebx),%eax
+f010b54a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f010b54d:	e8 04 fd ff ff       	call   f010b256 <ep_bit>
+f010b552:	84 c0                	test   %al,%al
+f010b554:	0f 85 85 00 00 00    	jne    f010b5df <ep_send+0x108>
+		ep_wake(owner, ep_deliver(ep, owner, src->env_id, msg));
+		return 0;
+	}
+	if (ep->ep_qlen == EP_QUEUE_MAX)
+f010b55a:	83 7f 10 08          	cmpl   $0x8,0x10(%edi)
+f010b55e:	0f 84 ec 00 00 00    	je     f010b650 <ep_send+0x179>
+		return -E_AGAIN;
+
+	assert(!src->env_ep_sendto);
+f010b564:	83 be 30 01 00 00 00 	cmpl   $0x0,0x130(%esi)
+f010b56b:	0f 85 ac 00 00 00    	jne    f010b61d <ep_send+0x146>
+	src->env_ipc_send_msg = *msg;
+f010b571:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010b574:	8b 00                	mov    (%eax),%eax
+f010b576:	89 86 b4 00 00 00    	mov    %eax,0xb4(%esi)
+f010b57c:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010b57f:	8b 40 04             	mov    0x4(%eax),%eax
+f010b582:	89 86 b8 00 00 00    	mov    %eax,0xb8(%esi)
+f010b588:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010b58b:	8b 40 08             	mov    0x8(%eax),%eax
+f010b58e:	89 86 bc 00 00 00    	mov    %eax,0xbc(%esi)
+f010b594:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010b597:	8b 40 0c             	mov    0xc(%eax),%eax
+f010b59a:	89 86 c0 00 00 00    	mov    %eax,0xc0(%esi)
+f010b5a0:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010b5a3:	8b 40 10             	mov    0x10(%eax),%eax
+f010b5a6:	89 86 c4 00 00 00    	mov    %eax,0xc4(%esi)
+	src->env_ep_sendto = epid;
+f010b5ac:	8b 45 08             	mov    0x8(%ebp),%eax
+f010b5af:	89 86 30 01 00 00    	mov    %eax,0x130(%esi)
+	src->env_ep_qnext = NULL;
+f010b5b5:	c7 86 34 01 00 00 00 	movl   $0x0,0x134(%esi)
+f010b5bc:	00 00 00 
+	if (ep->ep_qtail)
+f010b5bf:	8b 47 0c             	mov    0xc(%edi),%eax
+f010b5c2:	85 c0                	test   %eax,%eax
+f010b5c4:	74 70                	je     f010b636 <ep_send+0x15f>
+		ep->ep_qtail->env_ep_qnext = src;
+f010b5c6:	89 b0 34 01 00 00    	mov    %esi,0x134(%eax)
+	else
+		ep->ep_qhead = src;
+	ep->ep_qtail = src;
+f010b5cc:	89 77 0c             	mov    %esi,0xc(%edi)
+	ep->ep_qlen++;
+f010b5cf:	83 47 10 01          	addl   $0x1,0x10(%edi)
+
+	src->env_status = ENV_NOT_RUNNABLE;
+f010b5d3:	c7 46 54 04 00 00 00 	movl   $0x4,0x54(%esi)
+	sched_yield();
+f010b5da:	e8 52 ab ff ff       	call   f0106131 <sched_yield>
+		ep_wake(owner, ep_deliver(ep, owner, src->env_id, msg));
+f010b5df:	8b 46 48             	mov    0x48(%esi),%eax
+	e->env_ep_waiting = 0;
+f010b5e2:	c6 83 2c 01 00 00 00 	movb   $0x0,0x12c(%ebx)
+	e->env_ep_last = EPX(ep->ep_id);
+f010b5e9:	0f b6 17             	movzbl (%edi),%edx
+f010b5ec:	89 93 38 01 00 00    	mov    %edx,0x138(%ebx)
+	e->env_tf.tf_regs.reg_edx = from;
+f010b5f2:	89 43 14             	mov    %eax,0x14(%ebx)
+	ipc_msg_put(&e->env_tf.tf_regs, msg);
+f010b5f5:	83 ec 08             	sub    $0x8,%esp
+f010b5f8:	ff 75 0c             	push   0xc(%ebp)
+f010b5fb:	53                   	push   %ebx
+f010b5fc:	e8 01 f3 ff ff       	call   f010a902 <ipc_msg_put>
+	e->env_tf.tf_regs.reg_eax = r;
+f010b601:	8b 07                	mov    (%edi),%eax
+f010b603:	89 43 1c             	mov    %eax,0x1c(%ebx)
+	e->env_status = ENV_RUNNABLE;
+f010b606:	c7 43 54 02 00 00 00 	movl   $0x2,0x54(%ebx)
+}
+f010b60d:	83 c4 10             	add    $0x10,%esp
+		return 0;
+f010b610:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f010b615:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010b618:	5b                   	pop    %ebx
+f010b619:	5e                   	pop    %esi
+f010b61a:	5f                   	pop    %edi
+f010b61b:	5d                   	pop    %ebp
+f010b61c:	c3                   	ret
+	assert(!src->env_ep_sendto);
+f010b61d:	68 9c e3 10 f0       	push   $0xf010e39c
+f010b622:	68 bf be 10 f0       	push   $0xf010bebf
+f010b627:	68 da 00 00 00       	push   $0xda
+f010b62c:	68 b0 e3 10 f0       	push   $0xf010e3b0
+f010b631:	e8 0d 4a ff ff       	call   f0100043 <_panic>
+		ep->ep_qhead = src;
+f010b636:	89 77 08             	mov    %esi,0x8(%edi)
+f010b639:	eb 91                	jmp    f010b5cc <ep_send+0xf5>
+		return -E_NOT_FOUND;
+f010b63b:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+f010b640:	eb d3                	jmp    f010b615 <ep_send+0x13e>
+f010b642:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+f010b647:	eb cc                	jmp    f010b615 <ep_send+0x13e>
+		return -E_INVAL;
+f010b649:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010b64e:	eb c5                	jmp    f010b615 <ep_send+0x13e>
+		return -E_AGAIN;
+f010b650:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+f010b655:	eb be                	jmp    f010b615 <ep_send+0x13e>
+
+f010b657 <ep_recv>:
+//	-E_NOT_FOUND if an ID is not an endpoint we own.
+//	-E_FAULT if uepids can't be read.
+//
+int
+ep_recv(const epid_t *uepids, size_t n)
+{
+f010b657:	55                   	push   %ebp
+f010b658:	89 e5                	mov    %esp,%ebp
+f010b65a:	57                   	push   %edi
+f010b65b:	56                   	push   %esi
+f010b65c:	53                   	push   %ebx
+f010b65d:	83 ec 4c             	sub    $0x4c,%esp
+f010b660:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Env *e = curenv, *s;
+f010b663:	e8 cf d5 ff ff       	call   f0108c37 <cpunum>
+f010b668:	6b c0 78             	imul   $0x78,%eax,%eax
+f010b66b:	8b b8 28 60 7d f0    	mov    -0xf829fd8(%eax),%edi
+	struct endpoint *ep;
+	epid_t epid;
+	size_t i;
+	int x, r;
+
+	if (n == 0 || n > NENDPOINT)
+f010b671:	8d 43 ff             	lea    -0x1(%ebx),%eax
+f010b674:	3d ff 00 00 00       	cmp    $0xff,%eax
+f010b679:	0f 87 68 01 00 00    	ja     f010b7e7 <ep_recv+0x190>
+		return -E_INVAL;
+	memset(set, 0, sizeof(set));
+f010b67f:	83 ec 04             	sub    $0x4,%esp
+f010b682:	6a 20                	push   $0x20
+f010b684:	6a 00                	push   $0x0
+f010b686:	8d 45 c8             	lea    -0x38(%ebp),%eax
+f010b689:	50                   	push   %eax
+f010b68a:	e8 ac ce ff ff       	call   f010853b <memset>
+	for (i = 0; i < n; i++) {
+f010b68f:	8b 75 08             	mov    0x8(%ebp),%esi
+f010b692:	8d 04 9e             	lea    (%esi,%ebx,4),%eax
+f010b695:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+f010b698:	83 c4 10             	add    $0x10,%esp
+f010b69b:	eb 0b                	jmp    f010b6a8 <ep_recv+0x51>
+		if ((r = copyin(&epid, &uepids[i], sizeof(epid))) < 0)
+			return r;
+		if (!(ep = ep_lookup(epid)) || ep->ep_owner != e->env_id)
+			return -E_NOT_FOUND;
+		ep_bit_set(set, EPX(epid));
+f010b69d:	0f b6 d3             	movzbl %bl,%edx
+f010b6a0:	8d 45 c8             	lea    -0x38(%ebp),%eax
+f010b6a3:	e8 d3 fb ff ff       	call   f010b27b <ep_bit_set>
+	for (i = 0; i < n; i++) {
+f010b6a8:	39 75 b4             	cmp    %esi,-0x4c(%ebp)
+f010b6ab:	74 41                	je     f010b6ee <ep_recv+0x97>
+		if ((r = copyin(&epid, &uepids[i], sizeof(epid))) < 0)
+f010b6ad:	83 ec 04             	sub    $0x4,%esp
+f010b6b0:	6a 04                	push   $0x4
+f010b6b2:	56                   	push   %esi
+f010b6b3:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+f010b6b6:	50                   	push   %eax
+f010b6b7:	e8 52 a8 ff ff       	call   f0105f0e <copyin>
+f010b6bc:	83 c4 10             	add    $0x10,%esp
+f010b6bf:	85 c0                	test   %eax,%eax
+f010b6c1:	0f 88 f0 00 00 00    	js     f010b7b7 <ep_recv+0x160>
+		if (!(ep = ep_lookup(epid)) || ep->ep_owner != e->env_id)
+f010b6c7:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+f010b6ca:	89 d8                	mov    %ebx,%eax
+f010b6cc:	e8 cc fb ff ff       	call   f010b29d <ep_lookup>
+f010b6d1:	85 c0                	test   %eax,%eax
+f010b6d3:	0f 84 15 01 00 00    	je     f010b7ee <ep_recv+0x197>
+f010b6d9:	83 c6 04             	add    $0x4,%esi
+f010b6dc:	8b 4f 48             	mov    0x48(%edi),%ecx
+f010b6df:	39 48 04             	cmp    %ecx,0x4(%eax)
+f010b6e2:	74 b9                	je     f010b69d <ep_recv+0x46>
+			return -E_NOT_FOUND;
+f010b6e4:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+f010b6e9:	e9 c9 00 00 00       	jmp    f010b7b7 <ep_recv+0x160>
+	}
+
+	for (i = 1; i <= NENDPOINT; i++) {
+f010b6ee:	be 01 00 00 00       	mov    $0x1,%esi
+f010b6f3:	eb 1c                	jmp    f010b711 <ep_recv+0xba>
+			ep->ep_qtail = NULL;
+f010b6f5:	c7 04 8d 4c ac 7d f0 	movl   $0x0,-0xf8253b4(,%ecx,4)
+f010b6fc:	00 00 00 00 
+f010b700:	eb 4a                	jmp    f010b74c <ep_recv+0xf5>
+	for (i = 1; i <= NENDPOINT; i++) {
+f010b702:	83 c6 01             	add    $0x1,%esi
+f010b705:	81 fe 01 01 00 00    	cmp    $0x101,%esi
+f010b70b:	0f 84 ae 00 00 00    	je     f010b7bf <ep_recv+0x168>
+		x = (e->env_ep_last + i) % NENDPOINT;
+f010b711:	89 f3                	mov    %esi,%ebx
+f010b713:	03 9f 38 01 00 00    	add    0x138(%edi),%ebx
+f010b719:	0f b6 db             	movzbl %bl,%ebx
+		if (!ep_bit(set, x) || !(s = ep_dequeue(&endpoints[x])))
+f010b71c:	89 da                	mov    %ebx,%edx
+f010b71e:	8d 45 c8             	lea    -0x38(%ebp),%eax
+f010b721:	e8 30 fb ff ff       	call   f010b256 <ep_bit>
+f010b726:	84 c0                	test   %al,%al
+f010b728:	74 d8                	je     f010b702 <ep_recv+0xab>
+	struct Env *s = ep->ep_qhead;
+f010b72a:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+f010b72d:	8b 04 85 48 ac 7d f0 	mov    -0xf8253b8(,%eax,4),%eax
+	if (s) {
+f010b734:	85 c0                	test   %eax,%eax
+f010b736:	74 ca                	je     f010b702 <ep_recv+0xab>
+		if (!(ep->ep_qhead = s->env_ep_qnext))
+f010b738:	8b 90 34 01 00 00    	mov    0x134(%eax),%edx
+f010b73e:	8d 0c 9b             	lea    (%ebx,%ebx,4),%ecx
+f010b741:	89 14 8d 48 ac 7d f0 	mov    %edx,-0xf8253b8(,%ecx,4)
+f010b748:	85 d2                	test   %edx,%edx
+f010b74a:	74 a9                	je     f010b6f5 <ep_recv+0x9e>
+		ep->ep_qlen--;
+f010b74c:	8d 34 9d 00 00 00 00 	lea    0x0(,%ebx,4),%esi
+f010b753:	8d 14 1e             	lea    (%esi,%ebx,1),%edx
+f010b756:	c1 e2 02             	shl    $0x2,%edx
+f010b759:	83 aa 50 ac 7d f0 01 	subl   $0x1,-0xf8253b0(%edx)
+		s->env_ep_qnext = NULL;
+f010b760:	c7 80 34 01 00 00 00 	movl   $0x0,0x134(%eax)
+f010b767:	00 00 00 
+		s->env_ep_sendto = 0;
+f010b76a:	c7 80 30 01 00 00 00 	movl   $0x0,0x130(%eax)
+f010b771:	00 00 00 
+	e->env_tf.tf_regs.reg_eax = r;
+f010b774:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+	e->env_status = ENV_RUNNABLE;
+f010b77b:	c7 40 54 02 00 00 00 	movl   $0x2,0x54(%eax)
+			continue;
+		ep_wake(s, 0);
+		return ep_deliver(&endpoints[x], e, s->env_id,
+f010b782:	8b 48 48             	mov    0x48(%eax),%ecx
+	e->env_ep_waiting = 0;
+f010b785:	c6 87 2c 01 00 00 00 	movb   $0x0,0x12c(%edi)
+	e->env_ep_last = EPX(ep->ep_id);
+f010b78c:	0f b6 92 40 ac 7d f0 	movzbl -0xf8253c0(%edx),%edx
+f010b793:	89 97 38 01 00 00    	mov    %edx,0x138(%edi)
+	e->env_tf.tf_regs.reg_edx = from;
+f010b799:	89 4f 14             	mov    %ecx,0x14(%edi)
+	ipc_msg_put(&e->env_tf.tf_regs, msg);
+f010b79c:	83 ec 08             	sub    $0x8,%esp
+				  &s->env_ipc_send_msg);
+f010b79f:	05 b4 00 00 00       	add    $0xb4,%eax
+	ipc_msg_put(&e->env_tf.tf_regs, msg);
+f010b7a4:	50                   	push   %eax
+f010b7a5:	57                   	push   %edi
+f010b7a6:	e8 57 f1 ff ff       	call   f010a902 <ipc_msg_put>
+	return ep->ep_id;
+f010b7ab:	01 de                	add    %ebx,%esi
+f010b7ad:	8b 04 b5 40 ac 7d f0 	mov    -0xf8253c0(,%esi,4),%eax
+		return ep_deliver(&endpoints[x], e, s->env_id,
+f010b7b4:	83 c4 10             	add    $0x10,%esp
+
+	memmove(e->env_ep_waitset, set, sizeof(set));
+	e->env_ep_waiting = 1;
+	e->env_status = ENV_NOT_RUNNABLE;
+	sched_yield();
+}
+f010b7b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010b7ba:	5b                   	pop    %ebx
+f010b7bb:	5e                   	pop    %esi
+f010b7bc:	5f                   	pop    %edi
+f010b7bd:	5d                   	pop    %ebp
+f010b7be:	c3                   	ret
+	memmove(e->env_ep_waitset, set, sizeof(set));
+f010b7bf:	83 ec 04             	sub    $0x4,%esp
+f010b7c2:	6a 20                	push   $0x20
+f010b7c4:	8d 45 c8             	lea    -0x38(%ebp),%eax
+f010b7c7:	50                   	push   %eax
+f010b7c8:	8d 87 0c 01 00 00    	lea    0x10c(%edi),%eax
+f010b7ce:	50                   	push   %eax
+f010b7cf:	e8 9c cd ff ff       	call   f0108570 <memmove>
+	e->env_ep_waiting = 1;
+f010b7d4:	c6 87 2c 01 00 00 01 	movb   $0x1,0x12c(%edi)
+	e->env_status = ENV_NOT_RUNNABLE;
+f010b7db:	c7 47 54 04 00 00 00 	movl   $0x4,0x54(%edi)
+	sched_yield();
+f010b7e2:	e8 4a a9 ff ff       	call   f0106131 <sched_yield>
+		return -E_INVAL;
+f010b7e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010b7ec:	eb c9                	jmp    f010b7b7 <ep_recv+0x160>
+			return -E_NOT_FOUND;
+f010b7ee:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+f010b7f3:	eb c2                	jmp    f010b7b7 <ep_recv+0x160>
+
+f010b7f5 <ep_env_free>:
+// Env 'e' is being freed: leave the endpoint queue it waits in, and
+// destroy the endpoints it owns.  Its capabilities go with it.
+//
+void
+ep_env_free(struct Env *e)
+{
+f010b7f5:	55                   	push   %ebp
+f010b7f6:	89 e5                	mov    %esp,%ebp
+f010b7f8:	57                   	push   %edi
+f010b7f9:	56                   	push   %esi
+f010b7fa:	53                   	push   %ebx
+f010b7fb:	83 ec 0c             	sub    $0xc,%esp
+f010b7fe:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct endpoint *ep;
+	struct Env **pp, *prev = NULL;
+	int i;
+
+	if (e->env_ep_sendto && (ep = ep_lookup(e->env_ep_sendto))) {
+f010b801:	8b 86 30 01 00 00    	mov    0x130(%esi),%eax
+f010b807:	85 c0                	test   %eax,%eax
+f010b809:	74 3d                	je     f010b848 <ep_env_free+0x53>
+f010b80b:	e8 8d fa ff ff       	call   f010b29d <ep_lookup>
+f010b810:	85 c0                	test   %eax,%eax
+f010b812:	74 34                	je     f010b848 <ep_env_free+0x53>
+		for (pp = &ep->ep_qhead; *pp;
+f010b814:	8d 58 08             	lea    0x8(%eax),%ebx
+f010b817:	8b 50 08             	mov    0x8(%eax),%edx
+	struct Env **pp, *prev = NULL;
+f010b81a:	b9 00 00 00 00       	mov    $0x0,%ecx
+		for (pp = &ep->ep_qhead; *pp;
+f010b81f:	85 d2                	test   %edx,%edx
+f010b821:	74 25                	je     f010b848 <ep_env_free+0x53>
+		     prev = *pp, pp = &(*pp)->env_ep_qnext)
+			if (*pp == e) {
+f010b823:	39 f2                	cmp    %esi,%edx
+f010b825:	74 10                	je     f010b837 <ep_env_free+0x42>
+		     prev = *pp, pp = &(*pp)->env_ep_qnext)
+f010b827:	8d 9a 34 01 00 00    	lea    0x134(%edx),%ebx
+f010b82d:	89 d1                	mov    %edx,%ecx
+f010b82f:	8b 92 34 01 00 00    	mov    0x134(%edx),%edx
+f010b835:	eb e8                	jmp    f010b81f <ep_env_free+0x2a>
+				*pp = e->env_ep_qnext;
+f010b837:	8b 96 34 01 00 00    	mov    0x134(%esi),%edx
+f010b83d:	89 13                	mov    %edx,(%ebx)
+				if (ep->ep_qtail == e)
+f010b83f:	39 70 0c             	cmp    %esi,0xc(%eax)
+f010b842:	74 2b                	je     f010b86f <ep_env_free+0x7a>
+					ep->ep_qtail = prev;
+				ep->ep_qlen--;
+f010b844:	83 68 10 01          	subl   $0x1,0x10(%eax)
+				break;
+			}
+	}
+	e->env_ep_sendto = 0;
+f010b848:	c7 86 30 01 00 00 00 	movl   $0x0,0x130(%esi)
+f010b84f:	00 00 00 
+	e->env_ep_qnext = NULL;
+f010b852:	c7 86 34 01 00 00 00 	movl   $0x0,0x134(%esi)
+f010b859:	00 00 00 
+	e->env_ep_waiting = 0;
+f010b85c:	c6 86 2c 01 00 00 00 	movb   $0x0,0x12c(%esi)
+
+	for (i = 0; i < NENDPOINT; i++)
+f010b863:	bb 40 ac 7d f0       	mov    $0xf07dac40,%ebx
+f010b868:	bf 40 c0 7d f0       	mov    $0xf07dc040,%edi
+f010b86d:	eb 08                	jmp    f010b877 <ep_env_free+0x82>
+					ep->ep_qtail = prev;
+f010b86f:	89 48 0c             	mov    %ecx,0xc(%eax)
+f010b872:	eb d0                	jmp    f010b844 <ep_env_free+0x4f>
+	for (i = 0; i < NENDPOINT; i++)
+f010b874:	83 c3 14             	add    $0x14,%ebx
+f010b877:	39 fb                	cmp    %edi,%ebx
+f010b879:	74 11                	je     f010b88c <ep_env_free+0x97>
+		if (endpoints[i].ep_owner == e->env_id)
+f010b87b:	8b 46 48             	mov    0x48(%esi),%eax
+f010b87e:	39 43 04             	cmp    %eax,0x4(%ebx)
+f010b881:	75 f1                	jne    f010b874 <ep_env_free+0x7f>
+			ep_release(&endpoints[i]);
+f010b883:	89 d8                	mov    %ebx,%eax
+f010b885:	e8 55 fa ff ff       	call   f010b2df <ep_release>
+f010b88a:	eb e8                	jmp    f010b874 <ep_env_free+0x7f>
+}
+f010b88c:	83 c4 0c             	add    $0xc,%esp
+f010b88f:	5b                   	pop    %ebx
+f010b890:	5e                   	pop    %esi
+f010b891:	5f                   	pop    %edi
+f010b892:	5d                   	pop    %ebp
+f010b893:	c3                   	ret
+
+f010b894 <sysring_page>:
+// it through the kernel mapping are seen at the env's address alone:
+// a page table still shared after fork is copied, and a copy-on-write
+// page is broken first.
+static struct PageInfo *
+sysring_page(void)
+{
+f010b894:	55                   	push   %ebp
+f010b895:	89 e5                	mov    %esp,%ebp
+f010b897:	56                   	push   %esi
+f010b898:	53                   	push   %ebx
+f010b899:	83 ec 10             	sub    $0x10,%esp
+	pde_t *pgdir = curenv->env_pgdir;
+f010b89c:	e8 96 d3 ff ff       	call   f0108c37 <cpunum>
+f010b8a1:	6b c0 78             	imul   $0x78,%eax,%eax
+f010b8a4:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f010b8aa:	8b 58 60             	mov    0x60(%eax),%ebx
+	void *va = curenv->env_sysring;
+f010b8ad:	e8 85 d3 ff ff       	call   f0108c37 <cpunum>
+f010b8b2:	6b c0 78             	imul   $0x78,%eax,%eax
+f010b8b5:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f010b8bb:	8b b0 4c 01 00 00    	mov    0x14c(%eax),%esi
+	struct PageInfo *pp;
+	pte_t *pte;
+
+	if (pgdir_unshare(pgdir, va) < 0)
+f010b8c1:	83 ec 08             	sub    $0x8,%esp
+f010b8c4:	56                   	push   %esi
+f010b8c5:	53                   	push   %ebx
+f010b8c6:	e8 e7 5c ff ff       	call   f01015b2 <pgdir_unshare>
+f010b8cb:	89 c2                	mov    %eax,%edx
+f010b8cd:	83 c4 10             	add    $0x10,%esp
+		return NULL;
+f010b8d0:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pgdir_unshare(pgdir, va) < 0)
+f010b8d5:	85 d2                	test   %edx,%edx
+f010b8d7:	78 32                	js     f010b90b <sysring_page+0x77>
+	if (!(pp = page_lookup(pgdir, va, &pte)) || !(*pte & PTE_U))
+f010b8d9:	83 ec 04             	sub    $0x4,%esp
+f010b8dc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f010b8df:	50                   	push   %eax
+f010b8e0:	56                   	push   %esi
+f010b8e1:	53                   	push   %ebx
+f010b8e2:	e8 a3 5f ff ff       	call   f010188a <page_lookup>
+f010b8e7:	83 c4 10             	add    $0x10,%esp
+f010b8ea:	85 c0                	test   %eax,%eax
+f010b8ec:	74 1d                	je     f010b90b <sysring_page+0x77>
+f010b8ee:	8b 55 f4             	mov    -0xc(%ebp),%edx
+f010b8f1:	8b 12                	mov    (%edx),%edx
+f010b8f3:	f6 c2 04             	test   $0x4,%dl
+f010b8f6:	74 45                	je     f010b93d <sysring_page+0xa9>
+		return NULL;
+	if (*pte & PTE_COW) {
+f010b8f8:	f6 c6 08             	test   $0x8,%dh
+f010b8fb:	75 15                	jne    f010b912 <sysring_page+0x7e>
+		if (page_cow_break(pgdir, va) < 0)
+			return NULL;
+		pp = page_lookup(pgdir, va, &pte);
+	}
+	if (!(*pte & PTE_W))
+		return NULL;
+f010b8fd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+f010b900:	f6 02 02             	testb  $0x2,(%edx)
+f010b903:	ba 00 00 00 00       	mov    $0x0,%edx
+f010b908:	0f 44 c2             	cmove  %edx,%eax
+	return pp;
+}
+f010b90b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010b90e:	5b                   	pop    %ebx
+f010b90f:	5e                   	pop    %esi
+f010b910:	5d                   	pop    %ebp
+f010b911:	c3                   	ret
+		if (page_cow_break(pgdir, va) < 0)
+f010b912:	83 ec 08             	sub    $0x8,%esp
+f010b915:	56                   	push   %esi
+f010b916:	53                   	push   %ebx
+f010b917:	e8 62 62 ff ff       	call   f0101b7e <page_cow_break>
+f010b91c:	89 c2                	mov    %eax,%edx
+f010b91e:	83 c4 10             	add    $0x10,%esp
+			return NULL;
+f010b921:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (page_cow_break(pgdir, va) < 0)
+f010b926:	85 d2                	test   %edx,%edx
+f010b928:	78 e1                	js     f010b90b <sysring_page+0x77>
+		pp = page_lookup(pgdir, va, &pte);
+f010b92a:	83 ec 04             	sub    $0x4,%esp
+f010b92d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f010b930:	50                   	push   %eax
+f010b931:	56                   	push   %esi
+f010b932:	53                   	push   %ebx
+f010b933:	e8 52 5f ff ff       	call   f010188a <page_lookup>
+f010b938:	83 c4 10             	add    $0x10,%esp
+f010b93b:	eb c0                	jmp    f010b8fd <sysring_page+0x69>
+		return NULL;
+f010b93d:	b8 00 00 00 00       	mov    $0x0,%eax
+f010b942:	eb c7                	jmp    f010b90b <sysring_page+0x77>
+
+f010b944 <sysring_setup>:
+//	-E_INVAL if va is not page-aligned or is above UTOP.
+//	-E_FAULT if va is not mapped writable.
+//
+int
+sysring_setup(void *va)
+{
+f010b944:	55                   	push   %ebp
+f010b945:	89 e5                	mov    %esp,%ebp
+f010b947:	53                   	push   %ebx
+f010b948:	83 ec 04             	sub    $0x4,%esp
+f010b94b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	static_assert(sizeof(struct sysring) <= PGSIZE);
+
+	if ((uintptr_t) va >= UTOP || PGOFF(va))
+f010b94e:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+f010b954:	77 57                	ja     f010b9ad <sysring_setup+0x69>
+f010b956:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+f010b95c:	75 56                	jne    f010b9b4 <sysring_setup+0x70>
+		return -E_INVAL;
+	curenv->env_sysring = va;
+f010b95e:	e8 d4 d2 ff ff       	call   f0108c37 <cpunum>
+f010b963:	6b c0 78             	imul   $0x78,%eax,%eax
+f010b966:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f010b96c:	89 98 4c 01 00 00    	mov    %ebx,0x14c(%eax)
+	if (va && !sysring_page()) {
+		curenv->env_sysring = NULL;
+		return -E_FAULT;
+	}
+	return 0;
+f010b972:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (va && !sysring_page()) {
+f010b977:	85 db                	test   %ebx,%ebx
+f010b979:	74 0e                	je     f010b989 <sysring_setup+0x45>
+f010b97b:	e8 14 ff ff ff       	call   f010b894 <sysring_page>
+f010b980:	85 c0                	test   %eax,%eax
+f010b982:	74 0a                	je     f010b98e <sysring_setup+0x4a>
+	return 0;
+f010b984:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f010b989:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010b98c:	c9                   	leave
+f010b98d:	c3                   	ret
+		curenv->env_sysring = NULL;
+f010b98e:	e8 a4 d2 ff ff       	call   f0108c37 <cpunum>
+f010b993:	6b c0 78             	imul   $0x78,%eax,%eax
+f010b996:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f010b99c:	c7 80 4c 01 00 00 00 	movl   $0x0,0x14c(%eax)
+f010b9a3:	00 00 00 
+		return -E_FAULT;
+f010b9a6:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+f010b9ab:	eb dc                	jmp    f010b989 <sysring_setup+0x45>
+		return -E_INVAL;
+f010b9ad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010b9b2:	eb d5                	jmp    f010b989 <sysring_setup+0x45>
+f010b9b4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010b9b9:	eb ce                	jmp    f010b989 <sysring_setup+0x45>
+
+f010b9bb <sysring_enter>:
+//	-E_INVAL if no ring is registered, or its counters are corrupt.
+//	-E_FAULT if the ring is no longer mapped writable.
+//
+int
+sysring_enter(void)
+{
+f010b9bb:	55                   	push   %ebp
+f010b9bc:	89 e5                	mov    %esp,%ebp
+f010b9be:	57                   	push   %edi
+f010b9bf:	56                   	push   %esi
+f010b9c0:	53                   	push   %ebx
+f010b9c1:	83 ec 2c             	sub    $0x2c,%esp
+	struct sysring_sqe sqe;
+	struct sysring_cqe *cqe;
+	int32_t r;
+	int n = 0;
+
+	if (!curenv->env_sysring)
+f010b9c4:	e8 6e d2 ff ff       	call   f0108c37 <cpunum>
+f010b9c9:	6b c0 78             	imul   $0x78,%eax,%eax
+f010b9cc:	8b 80 28 60 7d f0    	mov    -0xf829fd8(%eax),%eax
+f010b9d2:	83 b8 4c 01 00 00 00 	cmpl   $0x0,0x14c(%eax)
+f010b9d9:	0f 84 d5 01 00 00    	je     f010bbb4 <sysring_enter+0x1f9>
+		return -E_INVAL;
+	if (!(pp = sysring_page()))
+f010b9df:	e8 b0 fe ff ff       	call   f010b894 <sysring_page>
+f010b9e4:	89 c3                	mov    %eax,%ebx
+f010b9e6:	85 c0                	test   %eax,%eax
+f010b9e8:	0f 84 cf 01 00 00    	je     f010bbbd <sysring_enter+0x202>
+f010b9ee:	2b 05 68 47 79 f0    	sub    0xf0794768,%eax
+f010b9f4:	c1 f8 03             	sar    $0x3,%eax
+f010b9f7:	89 c2                	mov    %eax,%edx
+f010b9f9:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f010b9fc:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f010ba01:	3b 05 74 47 79 f0    	cmp    0xf0794774,%eax
+f010ba07:	73 42                	jae    f010ba4b <sysring_enter+0x90>
+	return (void *)(pa + KERNBASE);
+f010ba09:	8d ba 00 00 00 f0    	lea    -0x10000000(%edx),%edi
+		return -E_FAULT;
+	ring = page2kva(pp);
+	if (ring->sr_sq_tail - ring->sr_sq_head > SYSRING_NENTRIES
+f010ba0f:	8b 82 00 00 00 f0    	mov    -0x10000000(%edx),%eax
+f010ba15:	8b 57 40             	mov    0x40(%edi),%edx
+f010ba18:	29 d0                	sub    %edx,%eax
+f010ba1a:	83 f8 40             	cmp    $0x40,%eax
+f010ba1d:	0f 87 a3 01 00 00    	ja     f010bbc6 <sysring_enter+0x20b>
+	    || ring->sr_cq_tail - ring->sr_cq_head > SYSRING_NENTRIES)
+f010ba23:	8b 87 80 00 00 00    	mov    0x80(%edi),%eax
+f010ba29:	8b 97 c0 00 00 00    	mov    0xc0(%edi),%edx
+f010ba2f:	29 d0                	sub    %edx,%eax
+f010ba31:	83 f8 40             	cmp    $0x40,%eax
+f010ba34:	0f 87 95 01 00 00    	ja     f010bbcf <sysring_enter+0x214>
+		return -E_INVAL;
+
+	pp->pp_ref++;
+f010ba3a:	66 83 43 04 01       	addw   $0x1,0x4(%ebx)
+	int n = 0;
+f010ba3f:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+f010ba46:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+	while (ring->sr_sq_head != ring->sr_sq_tail
+f010ba49:	eb 53                	jmp    f010ba9e <sysring_enter+0xe3>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f010ba4b:	52                   	push   %edx
+f010ba4c:	68 90 be 10 f0       	push   $0xf010be90
+f010ba51:	68 a4 00 00 00       	push   $0xa4
+f010ba56:	68 95 ce 10 f0       	push   $0xf010ce95
+f010ba5b:	e8 e3 45 ff ff       	call   f0100043 <_panic>
+	switch (sqe->se_num) {
+f010ba60:	8d 43 f4             	lea    -0xc(%ebx),%eax
+f010ba63:	b9 39 00 20 20       	mov    $0x20200039,%ecx
+f010ba68:	0f a3 c1             	bt     %eax,%ecx
+f010ba6b:	0f 82 cc 00 00 00    	jb     f010bb3d <sysring_enter+0x182>
+f010ba71:	ba fd ff ff ff       	mov    $0xfffffffd,%edx
+		if ((r = sysring_check(&sqe)) == 0)
+			r = syscall(sqe.se_num, sqe.se_args[0], sqe.se_args[1],
+				    sqe.se_args[2], sqe.se_args[3],
+				    sqe.se_args[4]);
+
+		cqe = &ring->sr_cq[ring->sr_cq_tail % SYSRING_NENTRIES];
+f010ba76:	8b 87 80 00 00 00    	mov    0x80(%edi),%eax
+f010ba7c:	83 e0 3f             	and    $0x3f,%eax
+		cqe->ce_data = sqe.se_data;
+f010ba7f:	05 00 01 00 00       	add    $0x100,%eax
+f010ba84:	89 34 c7             	mov    %esi,(%edi,%eax,8)
+		cqe->ce_result = r;
+f010ba87:	89 54 c7 04          	mov    %edx,0x4(%edi,%eax,8)
+		barrier();
+		ring->sr_cq_tail++;
+f010ba8b:	8b 87 80 00 00 00    	mov    0x80(%edi),%eax
+f010ba91:	83 c0 01             	add    $0x1,%eax
+f010ba94:	89 87 80 00 00 00    	mov    %eax,0x80(%edi)
+		n++;
+f010ba9a:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+	while (ring->sr_sq_head != ring->sr_sq_tail
+f010ba9e:	8b 57 40             	mov    0x40(%edi),%edx
+f010baa1:	8b 07                	mov    (%edi),%eax
+	       && ring->sr_cq_tail - ring->sr_cq_head < SYSRING_NENTRIES) {
+f010baa3:	39 c2                	cmp    %eax,%edx
+f010baa5:	0f 84 ef 00 00 00    	je     f010bb9a <sysring_enter+0x1df>
+f010baab:	8b 87 80 00 00 00    	mov    0x80(%edi),%eax
+f010bab1:	8b 97 c0 00 00 00    	mov    0xc0(%edi),%edx
+f010bab7:	29 d0                	sub    %edx,%eax
+f010bab9:	83 f8 3f             	cmp    $0x3f,%eax
+f010babc:	0f 87 d8 00 00 00    	ja     f010bb9a <sysring_enter+0x1df>
+		sqe = ring->sr_sq[ring->sr_sq_head % SYSRING_NENTRIES];
+f010bac2:	8b 47 40             	mov    0x40(%edi),%eax
+f010bac5:	83 e0 3f             	and    $0x3f,%eax
+f010bac8:	6b c0 1c             	imul   $0x1c,%eax,%eax
+f010bacb:	01 f8                	add    %edi,%eax
+f010bacd:	8b 98 00 01 00 00    	mov    0x100(%eax),%ebx
+f010bad3:	8b 88 04 01 00 00    	mov    0x104(%eax),%ecx
+f010bad9:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+f010badc:	8b 88 08 01 00 00    	mov    0x108(%eax),%ecx
+f010bae2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+f010bae5:	8b b0 0c 01 00 00    	mov    0x10c(%eax),%esi
+f010baeb:	89 75 d8             	mov    %esi,-0x28(%ebp)
+f010baee:	8b 88 10 01 00 00    	mov    0x110(%eax),%ecx
+f010baf4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f010baf7:	8b b0 14 01 00 00    	mov    0x114(%eax),%esi
+f010bafd:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+f010bb00:	8b b0 18 01 00 00    	mov    0x118(%eax),%esi
+		ring->sr_sq_head++;
+f010bb06:	8b 47 40             	mov    0x40(%edi),%eax
+f010bb09:	83 c0 01             	add    $0x1,%eax
+f010bb0c:	89 47 40             	mov    %eax,0x40(%edi)
+	switch (sqe->se_num) {
+f010bb0f:	85 db                	test   %ebx,%ebx
+f010bb11:	74 5b                	je     f010bb6e <sysring_enter+0x1b3>
+f010bb13:	83 fb 29             	cmp    $0x29,%ebx
+f010bb16:	0f 87 bc 00 00 00    	ja     f010bbd8 <sysring_enter+0x21d>
+f010bb1c:	83 fb 0b             	cmp    $0xb,%ebx
+f010bb1f:	0f 87 3b ff ff ff    	ja     f010ba60 <sysring_enter+0xa5>
+f010bb25:	83 fb 06             	cmp    $0x6,%ebx
+f010bb28:	77 35                	ja     f010bb5f <sysring_enter+0x1a4>
+f010bb2a:	83 fb 03             	cmp    $0x3,%ebx
+f010bb2d:	77 0e                	ja     f010bb3d <sysring_enter+0x182>
+f010bb2f:	ba fd ff ff ff       	mov    $0xfffffffd,%edx
+f010bb34:	83 fb 02             	cmp    $0x2,%ebx
+f010bb37:	0f 85 39 ff ff ff    	jne    f010ba76 <sysring_enter+0xbb>
+			r = syscall(sqe.se_num, sqe.se_args[0], sqe.se_args[1],
+f010bb3d:	83 ec 08             	sub    $0x8,%esp
+f010bb40:	ff 75 d4             	push   -0x2c(%ebp)
+f010bb43:	ff 75 dc             	push   -0x24(%ebp)
+f010bb46:	ff 75 d8             	push   -0x28(%ebp)
+f010bb49:	ff 75 e4             	push   -0x1c(%ebp)
+f010bb4c:	ff 75 e0             	push   -0x20(%ebp)
+f010bb4f:	53                   	push   %ebx
+f010bb50:	e8 2b ae ff ff       	call   f0106980 <syscall>
+f010bb55:	89 c2                	mov    %eax,%edx
+f010bb57:	83 c4 20             	add    $0x20,%esp
+f010bb5a:	e9 17 ff ff ff       	jmp    f010ba76 <sysring_enter+0xbb>
+	switch (sqe->se_num) {
+f010bb5f:	ba fd ff ff ff       	mov    $0xfffffffd,%edx
+f010bb64:	83 fb 08             	cmp    $0x8,%ebx
+f010bb67:	74 d4                	je     f010bb3d <sysring_enter+0x182>
+f010bb69:	e9 08 ff ff ff       	jmp    f010ba76 <sysring_enter+0xbb>
+		if (user_mem_check(curenv, (const void *) sqe->se_args[0],
+f010bb6e:	e8 c4 d0 ff ff       	call   f0108c37 <cpunum>
+f010bb73:	6a 04                	push   $0x4
+f010bb75:	ff 75 e4             	push   -0x1c(%ebp)
+f010bb78:	ff 75 e0             	push   -0x20(%ebp)
+f010bb7b:	6b c0 78             	imul   $0x78,%eax,%eax
+f010bb7e:	ff b0 28 60 7d f0    	push   -0xf829fd8(%eax)
+f010bb84:	e8 32 7f ff ff       	call   f0103abb <user_mem_check>
+f010bb89:	83 c4 10             	add    $0x10,%esp
+f010bb8c:	85 c0                	test   %eax,%eax
+f010bb8e:	79 ad                	jns    f010bb3d <sysring_enter+0x182>
+			return -E_FAULT;
+f010bb90:	ba fa ff ff ff       	mov    $0xfffffffa,%edx
+f010bb95:	e9 dc fe ff ff       	jmp    f010ba76 <sysring_enter+0xbb>
+	}
+	page_decref(pp);
+f010bb9a:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+f010bb9d:	83 ec 0c             	sub    $0xc,%esp
+f010bba0:	53                   	push   %ebx
+f010bba1:	e8 16 57 ff ff       	call   f01012bc <page_decref>
+	return n;
+f010bba6:	83 c4 10             	add    $0x10,%esp
+}
+f010bba9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f010bbac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010bbaf:	5b                   	pop    %ebx
+f010bbb0:	5e                   	pop    %esi
+f010bbb1:	5f                   	pop    %edi
+f010bbb2:	5d                   	pop    %ebp
+f010bbb3:	c3                   	ret
+		return -E_INVAL;
+f010bbb4:	c7 45 d0 fd ff ff ff 	movl   $0xfffffffd,-0x30(%ebp)
+f010bbbb:	eb ec                	jmp    f010bba9 <sysring_enter+0x1ee>
+		return -E_FAULT;
+f010bbbd:	c7 45 d0 fa ff ff ff 	movl   $0xfffffffa,-0x30(%ebp)
+f010bbc4:	eb e3                	jmp    f010bba9 <sysring_enter+0x1ee>
+		return -E_INVAL;
+f010bbc6:	c7 45 d0 fd ff ff ff 	movl   $0xfffffffd,-0x30(%ebp)
+f010bbcd:	eb da                	jmp    f010bba9 <sysring_enter+0x1ee>
+f010bbcf:	c7 45 d0 fd ff ff ff 	movl   $0xfffffffd,-0x30(%ebp)
+f010bbd6:	eb d1                	jmp    f010bba9 <sysring_enter+0x1ee>
+	switch (sqe->se_num) {
+f010bbd8:	ba fd ff ff ff       	mov    $0xfffffffd,%edx
+f010bbdd:	e9 94 fe ff ff       	jmp    f010ba76 <sysring_enter+0xbb>
+
+f010bbe2 <dm>:
+f010bbe2:	55                   	push   %ebp
+f010bbe3:	57                   	push   %edi
+f010bbe4:	56                   	push   %esi
+f010bbe5:	53                   	push   %ebx
+f010bbe6:	83 ec 24             	sub    $0x24,%esp
+f010bbe9:	89 44 24 08          	mov    %eax,0x8(%esp)
+f010bbed:	89 54 24 0c          	mov    %edx,0xc(%esp)
+f010bbf1:	8b 44 24 38          	mov    0x38(%esp),%eax
+f010bbf5:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+f010bbf9:	89 44 24 10          	mov    %eax,0x10(%esp)
+f010bbfd:	89 54 24 14          	mov    %edx,0x14(%esp)
+f010bc01:	8b 7c 24 40          	mov    0x40(%esp),%edi
+f010bc05:	b8 00 00 00 00       	mov    $0x0,%eax
+f010bc0a:	ba 00 00 00 00       	mov    $0x0,%edx
+f010bc0f:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+f010bc14:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+f010bc1b:	00 
+f010bc1c:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+f010bc23:	00 
+f010bc24:	89 fb                	mov    %edi,%ebx
+f010bc26:	eb 08                	jmp    f010bc30 <dm+0x4e>
+f010bc28:	83 e9 01             	sub    $0x1,%ecx
+f010bc2b:	83 f9 ff             	cmp    $0xffffffff,%ecx
+f010bc2e:	74 68                	je     f010bc98 <dm+0xb6>
+f010bc30:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+f010bc34:	01 c0                	add    %eax,%eax
+f010bc36:	89 c6                	mov    %eax,%esi
+f010bc38:	89 d7                	mov    %edx,%edi
+f010bc3a:	8b 44 24 08          	mov    0x8(%esp),%eax
+f010bc3e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+f010bc42:	0f ad d0             	shrd   %cl,%edx,%eax
+f010bc45:	d3 ea                	shr    %cl,%edx
+f010bc47:	f6 c1 20             	test   $0x20,%cl
+f010bc4a:	74 04                	je     f010bc50 <dm+0x6e>
+f010bc4c:	89 d0                	mov    %edx,%eax
+f010bc4e:	31 d2                	xor    %edx,%edx
+f010bc50:	83 e0 01             	and    $0x1,%eax
+f010bc53:	89 04 24             	mov    %eax,(%esp)
+f010bc56:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+f010bc5d:	00 
+f010bc5e:	8b 04 24             	mov    (%esp),%eax
+f010bc61:	8b 54 24 04          	mov    0x4(%esp),%edx
+f010bc65:	09 f0                	or     %esi,%eax
+f010bc67:	09 fa                	or     %edi,%edx
+f010bc69:	8b 74 24 10          	mov    0x10(%esp),%esi
+f010bc6d:	8b 7c 24 14          	mov    0x14(%esp),%edi
+f010bc71:	39 f0                	cmp    %esi,%eax
+f010bc73:	89 d5                	mov    %edx,%ebp
+f010bc75:	19 fd                	sbb    %edi,%ebp
+f010bc77:	72 af                	jb     f010bc28 <dm+0x46>
+f010bc79:	29 f0                	sub    %esi,%eax
+f010bc7b:	19 fa                	sbb    %edi,%edx
+f010bc7d:	89 cf                	mov    %ecx,%edi
+f010bc7f:	c1 ef 05             	shr    $0x5,%edi
+f010bc82:	83 e7 01             	and    $0x1,%edi
+f010bc85:	89 fe                	mov    %edi,%esi
+f010bc87:	83 f6 01             	xor    $0x1,%esi
+f010bc8a:	d3 e6                	shl    %cl,%esi
+f010bc8c:	d3 e7                	shl    %cl,%edi
+f010bc8e:	09 74 24 18          	or     %esi,0x18(%esp)
+f010bc92:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+f010bc96:	eb 90                	jmp    f010bc28 <dm+0x46>
+f010bc98:	85 db                	test   %ebx,%ebx
+f010bc9a:	74 05                	je     f010bca1 <dm+0xbf>
+f010bc9c:	89 03                	mov    %eax,(%ebx)
+f010bc9e:	89 53 04             	mov    %edx,0x4(%ebx)
+f010bca1:	8b 44 24 18          	mov    0x18(%esp),%eax
+f010bca5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+f010bca9:	83 c4 24             	add    $0x24,%esp
+f010bcac:	5b                   	pop    %ebx
+f010bcad:	5e                   	pop    %esi
+f010bcae:	5f                   	pop    %edi
+f010bcaf:	5d                   	pop    %ebp
+f010bcb0:	c3                   	ret
+
+f010bcb1 <__udivdi3>:
+f010bcb1:	83 ec 08             	sub    $0x8,%esp
+f010bcb4:	6a 00                	push   $0x0
+f010bcb6:	ff 74 24 1c          	push   0x1c(%esp)
+f010bcba:	ff 74 24 1c          	push   0x1c(%esp)
+f010bcbe:	8b 44 24 18          	mov    0x18(%esp),%eax
+f010bcc2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+f010bcc6:	e8 17 ff ff ff       	call   f010bbe2 <dm>
+f010bccb:	83 c4 14             	add    $0x14,%esp
+f010bcce:	c3                   	ret
+
+f010bccf <__umoddi3>:
+f010bccf:	83 ec 18             	sub    $0x18,%esp
+f010bcd2:	8d 44 24 0c          	lea    0xc(%esp),%eax
+f010bcd6:	50                   	push   %eax
+f010bcd7:	ff 74 24 2c          	push   0x2c(%esp)
+f010bcdb:	ff 74 24 2c          	push   0x2c(%esp)
+f010bcdf:	8b 44 24 28          	mov    0x28(%esp),%eax
+f010bce3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+f010bce7:	e8 f6 fe ff ff       	call   f010bbe2 <dm>
+f010bcec:	8b 44 24 18          	mov    0x18(%esp),%eax
+f010bcf0:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+f010bcf4:	83 c4 24             	add    $0x24,%esp
+f010bcf7:	c3                   	ret
+
+f010bcf8 <__divdi3>:
+f010bcf8:	53                   	push   %ebx
+f010bcf9:	8b 44 24 08          	mov    0x8(%esp),%eax
+f010bcfd:	8b 54 24 0c          	mov    0xc(%esp),%edx
+f010bd01:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+f010bd05:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+f010bd09:	85 d2                	test   %edx,%edx
+f010bd0b:	78 15                	js     f010bd22 <__divdi3+0x2a>
+f010bd0d:	85 db                	test   %ebx,%ebx
+f010bd0f:	78 34                	js     f010bd45 <__divdi3+0x4d>
+f010bd11:	83 ec 04             	sub    $0x4,%esp
+f010bd14:	6a 00                	push   $0x0
+f010bd16:	53                   	push   %ebx
+f010bd17:	51                   	push   %ecx
+f010bd18:	e8 c5 fe ff ff       	call   f010bbe2 <dm>
+f010bd1d:	83 c4 10             	add    $0x10,%esp
+f010bd20:	eb 21                	jmp    f010bd43 <__divdi3+0x4b>
+f010bd22:	f7 d8                	neg    %eax
+f010bd24:	83 d2 00             	adc    $0x0,%edx
+f010bd27:	f7 da                	neg    %edx
+f010bd29:	85 db                	test   %ebx,%ebx
+f010bd2b:	78 30                	js     f010bd5d <__divdi3+0x65>
+f010bd2d:	83 ec 04             	sub    $0x4,%esp
+f010bd30:	6a 00                	push   $0x0
+f010bd32:	53                   	push   %ebx
+f010bd33:	51                   	push   %ecx
+f010bd34:	e8 a9 fe ff ff       	call   f010bbe2 <dm>
+f010bd39:	83 c4 10             	add    $0x10,%esp
+f010bd3c:	f7 d8                	neg    %eax
+f010bd3e:	83 d2 00             	adc    $0x0,%edx
+f010bd41:	f7 da                	neg    %edx
+f010bd43:	5b                   	pop    %ebx
+f010bd44:	c3                   	ret
+f010bd45:	83 ec 04             	sub    $0x4,%esp
+f010bd48:	6a 00                	push   $0x0
+f010bd4a:	f7 d9                	neg    %ecx
+f010bd4c:	83 d3 00             	adc    $0x0,%ebx
+f010bd4f:	f7 db                	neg    %ebx
+f010bd51:	53                   	push   %ebx
+f010bd52:	51                   	push   %ecx
+f010bd53:	e8 8a fe ff ff       	call   f010bbe2 <dm>
+f010bd58:	83 c4 10             	add    $0x10,%esp
+f010bd5b:	eb df                	jmp    f010bd3c <__divdi3+0x44>
+f010bd5d:	83 ec 04             	sub    $0x4,%esp
+f010bd60:	6a 00                	push   $0x0
+f010bd62:	f7 d9                	neg    %ecx
+f010bd64:	83 d3 00             	adc    $0x0,%ebx
+f010bd67:	f7 db                	neg    %ebx
+f010bd69:	53                   	push   %ebx
+f010bd6a:	51                   	push   %ecx
+f010bd6b:	e8 72 fe ff ff       	call   f010bbe2 <dm>
+f010bd70:	83 c4 10             	add    $0x10,%esp
+f010bd73:	eb ce                	jmp    f010bd43 <__divdi3+0x4b>
+
+f010bd75 <__moddi3>:
+f010bd75:	55                   	push   %ebp
+f010bd76:	57                   	push   %edi
+f010bd77:	56                   	push   %esi
+f010bd78:	53                   	push   %ebx
+f010bd79:	83 ec 18             	sub    $0x18,%esp
+f010bd7c:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+f010bd80:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+f010bd84:	89 f1                	mov    %esi,%ecx
+f010bd86:	f7 d9                	neg    %ecx
+f010bd88:	89 da                	mov    %ebx,%edx
+f010bd8a:	83 d2 00             	adc    $0x0,%edx
+f010bd8d:	f7 da                	neg    %edx
+f010bd8f:	0f 48 ce             	cmovs  %esi,%ecx
+f010bd92:	0f 48 d3             	cmovs  %ebx,%edx
+f010bd95:	8d 44 24 0c          	lea    0xc(%esp),%eax
+f010bd99:	50                   	push   %eax
+f010bd9a:	8b 74 24 38          	mov    0x38(%esp),%esi
+f010bd9e:	f7 de                	neg    %esi
+f010bda0:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+f010bda4:	83 d0 00             	adc    $0x0,%eax
+f010bda7:	f7 d8                	neg    %eax
+f010bda9:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+f010bdae:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+f010bdb3:	50                   	push   %eax
+f010bdb4:	56                   	push   %esi
+f010bdb5:	89 c8                	mov    %ecx,%eax
+f010bdb7:	e8 26 fe ff ff       	call   f010bbe2 <dm>
+f010bdbc:	83 c4 10             	add    $0x10,%esp
+f010bdbf:	85 db                	test   %ebx,%ebx
+f010bdc1:	78 10                	js     f010bdd3 <__moddi3+0x5e>
+f010bdc3:	8b 44 24 08          	mov    0x8(%esp),%eax
+f010bdc7:	8b 54 24 0c          	mov    0xc(%esp),%edx
+f010bdcb:	83 c4 14             	add    $0x14,%esp
+f010bdce:	5b                   	pop    %ebx
+f010bdcf:	5e                   	pop    %esi
+f010bdd0:	5f                   	pop    %edi
+f010bdd1:	5d                   	pop    %ebp
+f010bdd2:	c3                   	ret
+f010bdd3:	8b 44 24 08          	mov    0x8(%esp),%eax
+f010bdd7:	8b 54 24 0c          	mov    0xc(%esp),%edx
+f010bddb:	f7 d8                	neg    %eax
+f010bddd:	83 d2 00             	adc    $0x0,%edx
+f010bde0:	f7 da                	neg    %edx
+f010bde2:	eb e7                	jmp    f010bdcb <__moddi3+0x56>
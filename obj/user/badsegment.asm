@@ -0,0 +1,5032 @@
+
+obj/user/badsegment:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 09 00 00 00       	call   80003a <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+	// Try to load the kernel's TSS selector into the DS register.
+	asm volatile("movw $0x28,%ax; movw %ax,%ds");
+  800033:	66 b8 28 00          	mov    $0x28,%ax
+  800037:	8e d8                	mov    %eax,%ds
+}
+  800039:	c3                   	ret
+
+0080003a <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80003a:	55                   	push   %ebp
+  80003b:	89 e5                	mov    %esp,%ebp
+  80003d:	56                   	push   %esi
+  80003e:	53                   	push   %ebx
+  80003f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800042:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  800045:	e8 9d 04 00 00       	call   8004e7 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  80004a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80004f:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  800055:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80005a:	a3 08 30 80 00       	mov    %eax,0x803008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80005f:	85 db                	test   %ebx,%ebx
+  800061:	7e 07                	jle    80006a <libmain+0x30>
+		binaryname = argv[0];
+  800063:	8b 06                	mov    (%esi),%eax
+  800065:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  80006a:	83 ec 08             	sub    $0x8,%esp
+  80006d:	56                   	push   %esi
+  80006e:	53                   	push   %ebx
+  80006f:	e8 bf ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800074:	e8 0a 00 00 00       	call   800083 <exit>
+}
+  800079:	83 c4 10             	add    $0x10,%esp
+  80007c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80007f:	5b                   	pop    %ebx
+  800080:	5e                   	pop    %esi
+  800081:	5d                   	pop    %ebp
+  800082:	c3                   	ret
+
+00800083 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800083:	55                   	push   %ebp
+  800084:	89 e5                	mov    %esp,%ebp
+  800086:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  800089:	6a 00                	push   $0x0
+  80008b:	e8 95 03 00 00       	call   800425 <sys_env_destroy>
+}
+  800090:	83 c4 10             	add    $0x10,%esp
+  800093:	c9                   	leave
+  800094:	c3                   	ret
+
+00800095 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800095:	55                   	push   %ebp
+  800096:	89 e5                	mov    %esp,%ebp
+  800098:	57                   	push   %edi
+  800099:	56                   	push   %esi
+  80009a:	53                   	push   %ebx
+  80009b:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  8000a1:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  8000a7:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  8000ad:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  8000b3:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  8000ba:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  8000bd:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  8000c4:	00 00 00 
+		if (num == SYS_page_map_vec)
+  8000c7:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  8000ce:	74 76                	je     800146 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  8000d0:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  8000d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8000d9:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  8000df:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8000e6:	0f 88 06 01 00 00    	js     8001f2 <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  8000ec:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8000f3:	0f 84 48 01 00 00    	je     800241 <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  8000f9:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  8000ff:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800105:	be 00 00 00 00       	mov    $0x0,%esi
+  80010a:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800110:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800113:	55                   	push   %ebp
+  800114:	68 1d 01 80 00       	push   $0x80011d
+  800119:	89 e5                	mov    %esp,%ebp
+  80011b:	0f 34                	sysenter
+  80011d:	83 c4 04             	add    $0x4,%esp
+  800120:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800121:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800127:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  80012d:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800130:	0f 85 9a 01 00 00    	jne    8002d0 <page_vec_call+0x23b>
+  800136:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80013b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80013e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800141:	e9 29 01 00 00       	jmp    80026f <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800146:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  80014c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80014f:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800151:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800158:	78 2f                	js     800189 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  80015a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800161:	74 72                	je     8001d5 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800163:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800169:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  80016f:	b8 10 00 00 00       	mov    $0x10,%eax
+  800174:	89 fb                	mov    %edi,%ebx
+  800176:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800179:	55                   	push   %ebp
+  80017a:	68 83 01 80 00       	push   $0x800183
+  80017f:	89 e5                	mov    %esp,%ebp
+  800181:	0f 34                	sysenter
+  800183:	83 c4 04             	add    $0x4,%esp
+  800186:	5d                   	pop    %ebp
+	return ret;
+  800187:	eb 98                	jmp    800121 <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800189:	b8 01 00 00 00       	mov    $0x1,%eax
+  80018e:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800190:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800195:	f6 c6 08             	test   $0x8,%dh
+  800198:	74 15                	je     8001af <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80019a:	89 c2                	mov    %eax,%edx
+  80019c:	c1 ea 08             	shr    $0x8,%edx
+  80019f:	83 e2 0f             	and    $0xf,%edx
+  8001a2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8001a7:	83 fa 06             	cmp    $0x6,%edx
+  8001aa:	74 0e                	je     8001ba <page_vec_call+0x125>
+  8001ac:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8001af:	0f b6 c9             	movzbl %cl,%ecx
+  8001b2:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8001b8:	eb a0                	jmp    80015a <page_vec_call+0xc5>
+  8001ba:	89 c2                	mov    %eax,%edx
+  8001bc:	c1 ea 04             	shr    $0x4,%edx
+  8001bf:	83 e2 0f             	and    $0xf,%edx
+  8001c2:	83 fa 02             	cmp    $0x2,%edx
+  8001c5:	77 e5                	ja     8001ac <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  8001c7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8001ca:	83 f8 02             	cmp    $0x2,%eax
+  8001cd:	0f 97 c1             	seta   %cl
+  8001d0:	0f b6 c9             	movzbl %cl,%ecx
+  8001d3:	eb d7                	jmp    8001ac <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  8001d5:	b8 10 00 00 00       	mov    $0x10,%eax
+  8001da:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  8001e0:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  8001e6:	89 fb                	mov    %edi,%ebx
+  8001e8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8001eb:	cd 30                	int    $0x30
+  8001ed:	e9 2f ff ff ff       	jmp    800121 <page_vec_call+0x8c>
+  8001f2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8001f7:	0f a2                	cpuid
+		return 0;
+  8001f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8001fe:	f6 c6 08             	test   $0x8,%dh
+  800201:	74 15                	je     800218 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800203:	89 c2                	mov    %eax,%edx
+  800205:	c1 ea 08             	shr    $0x8,%edx
+  800208:	83 e2 0f             	and    $0xf,%edx
+  80020b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800210:	83 fa 06             	cmp    $0x6,%edx
+  800213:	74 11                	je     800226 <page_vec_call+0x191>
+  800215:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800218:	0f b6 c9             	movzbl %cl,%ecx
+  80021b:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800221:	e9 c6 fe ff ff       	jmp    8000ec <page_vec_call+0x57>
+  800226:	89 c2                	mov    %eax,%edx
+  800228:	c1 ea 04             	shr    $0x4,%edx
+  80022b:	83 e2 0f             	and    $0xf,%edx
+  80022e:	83 fa 02             	cmp    $0x2,%edx
+  800231:	77 e2                	ja     800215 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800233:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800236:	83 f8 02             	cmp    $0x2,%eax
+  800239:	0f 97 c1             	seta   %cl
+  80023c:	0f b6 c9             	movzbl %cl,%ecx
+  80023f:	eb d4                	jmp    800215 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800241:	be 00 00 00 00       	mov    $0x0,%esi
+  800246:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  80024c:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800252:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800258:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80025b:	cd 30                	int    $0x30
+  80025d:	e9 bf fe ff ff       	jmp    800121 <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800262:	29 da                	sub    %ebx,%edx
+			vec++;
+  800264:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800267:	83 e8 01             	sub    $0x1,%eax
+  80026a:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  80026f:	85 c0                	test   %eax,%eax
+  800271:	74 58                	je     8002cb <page_vec_call+0x236>
+  800273:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800276:	39 da                	cmp    %ebx,%edx
+  800278:	73 e8                	jae    800262 <page_vec_call+0x1cd>
+  80027a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80027d:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800280:	84 c9                	test   %cl,%cl
+  800282:	74 06                	je     80028a <page_vec_call+0x1f5>
+  800284:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  80028a:	83 ec 04             	sub    $0x4,%esp
+  80028d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800290:	c1 e0 04             	shl    $0x4,%eax
+  800293:	50                   	push   %eax
+  800294:	ff 75 08             	push   0x8(%ebp)
+  800297:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  80029d:	53                   	push   %ebx
+  80029e:	e8 41 21 00 00       	call   8023e4 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  8002a3:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  8002a9:	89 c2                	mov    %eax,%edx
+  8002ab:	c1 e2 0c             	shl    $0xc,%edx
+  8002ae:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  8002b4:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  8002ba:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  8002c0:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  8002c3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  8002c6:	e9 f2 fd ff ff       	jmp    8000bd <page_vec_call+0x28>
+			r = 0;
+  8002cb:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  8002d0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8002d4:	74 0b                	je     8002e1 <page_vec_call+0x24c>
+		*done = total;
+  8002d6:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002d9:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  8002df:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  8002e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002e4:	5b                   	pop    %ebx
+  8002e5:	5e                   	pop    %esi
+  8002e6:	5f                   	pop    %edi
+  8002e7:	5d                   	pop    %ebp
+  8002e8:	c3                   	ret
+
+008002e9 <sys_cputs>:
+{
+  8002e9:	55                   	push   %ebp
+  8002ea:	89 e5                	mov    %esp,%ebp
+  8002ec:	57                   	push   %edi
+  8002ed:	56                   	push   %esi
+  8002ee:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8002ef:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8002f6:	78 2d                	js     800325 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  8002f8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8002ff:	74 70                	je     800371 <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800301:	b8 00 00 00 00       	mov    $0x0,%eax
+  800306:	8b 55 08             	mov    0x8(%ebp),%edx
+  800309:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80030c:	89 c3                	mov    %eax,%ebx
+  80030e:	89 c7                	mov    %eax,%edi
+  800310:	89 c6                	mov    %eax,%esi
+  800312:	55                   	push   %ebp
+  800313:	68 1c 03 80 00       	push   $0x80031c
+  800318:	89 e5                	mov    %esp,%ebp
+  80031a:	0f 34                	sysenter
+  80031c:	83 c4 04             	add    $0x4,%esp
+  80031f:	5d                   	pop    %ebp
+}
+  800320:	5b                   	pop    %ebx
+  800321:	5e                   	pop    %esi
+  800322:	5f                   	pop    %edi
+  800323:	5d                   	pop    %ebp
+  800324:	c3                   	ret
+  800325:	b8 01 00 00 00       	mov    $0x1,%eax
+  80032a:	0f a2                	cpuid
+		return 0;
+  80032c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800331:	f6 c6 08             	test   $0x8,%dh
+  800334:	74 15                	je     80034b <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800336:	89 c2                	mov    %eax,%edx
+  800338:	c1 ea 08             	shr    $0x8,%edx
+  80033b:	83 e2 0f             	and    $0xf,%edx
+  80033e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800343:	83 fa 06             	cmp    $0x6,%edx
+  800346:	74 0e                	je     800356 <sys_cputs+0x6d>
+  800348:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80034b:	0f b6 c9             	movzbl %cl,%ecx
+  80034e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800354:	eb a2                	jmp    8002f8 <sys_cputs+0xf>
+  800356:	89 c2                	mov    %eax,%edx
+  800358:	c1 ea 04             	shr    $0x4,%edx
+  80035b:	83 e2 0f             	and    $0xf,%edx
+  80035e:	83 fa 02             	cmp    $0x2,%edx
+  800361:	77 e5                	ja     800348 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800363:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800366:	83 f8 02             	cmp    $0x2,%eax
+  800369:	0f 97 c1             	seta   %cl
+  80036c:	0f b6 c9             	movzbl %cl,%ecx
+  80036f:	eb d7                	jmp    800348 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800371:	b8 00 00 00 00       	mov    $0x0,%eax
+  800376:	8b 55 08             	mov    0x8(%ebp),%edx
+  800379:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80037c:	89 c3                	mov    %eax,%ebx
+  80037e:	89 c7                	mov    %eax,%edi
+  800380:	89 c6                	mov    %eax,%esi
+  800382:	cd 30                	int    $0x30
+}
+  800384:	eb 9a                	jmp    800320 <sys_cputs+0x37>
+
+00800386 <sys_cgetc>:
+{
+  800386:	55                   	push   %ebp
+  800387:	89 e5                	mov    %esp,%ebp
+  800389:	57                   	push   %edi
+  80038a:	56                   	push   %esi
+  80038b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80038c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800393:	78 2e                	js     8003c3 <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  800395:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80039c:	74 71                	je     80040f <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  80039e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003a3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8003a8:	89 d1                	mov    %edx,%ecx
+  8003aa:	89 d3                	mov    %edx,%ebx
+  8003ac:	89 d7                	mov    %edx,%edi
+  8003ae:	89 d6                	mov    %edx,%esi
+  8003b0:	55                   	push   %ebp
+  8003b1:	68 ba 03 80 00       	push   $0x8003ba
+  8003b6:	89 e5                	mov    %esp,%ebp
+  8003b8:	0f 34                	sysenter
+  8003ba:	83 c4 04             	add    $0x4,%esp
+  8003bd:	5d                   	pop    %ebp
+}
+  8003be:	5b                   	pop    %ebx
+  8003bf:	5e                   	pop    %esi
+  8003c0:	5f                   	pop    %edi
+  8003c1:	5d                   	pop    %ebp
+  8003c2:	c3                   	ret
+  8003c3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8003c8:	0f a2                	cpuid
+		return 0;
+  8003ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8003cf:	f6 c6 08             	test   $0x8,%dh
+  8003d2:	74 15                	je     8003e9 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8003d4:	89 c2                	mov    %eax,%edx
+  8003d6:	c1 ea 08             	shr    $0x8,%edx
+  8003d9:	83 e2 0f             	and    $0xf,%edx
+  8003dc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8003e1:	83 fa 06             	cmp    $0x6,%edx
+  8003e4:	74 0e                	je     8003f4 <sys_cgetc+0x6e>
+  8003e6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8003e9:	0f b6 c9             	movzbl %cl,%ecx
+  8003ec:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8003f2:	eb a1                	jmp    800395 <sys_cgetc+0xf>
+  8003f4:	89 c2                	mov    %eax,%edx
+  8003f6:	c1 ea 04             	shr    $0x4,%edx
+  8003f9:	83 e2 0f             	and    $0xf,%edx
+  8003fc:	83 fa 02             	cmp    $0x2,%edx
+  8003ff:	77 e5                	ja     8003e6 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  800401:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800404:	83 f8 02             	cmp    $0x2,%eax
+  800407:	0f 97 c1             	seta   %cl
+  80040a:	0f b6 c9             	movzbl %cl,%ecx
+  80040d:	eb d7                	jmp    8003e6 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  80040f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800414:	b8 01 00 00 00       	mov    $0x1,%eax
+  800419:	89 d1                	mov    %edx,%ecx
+  80041b:	89 d3                	mov    %edx,%ebx
+  80041d:	89 d7                	mov    %edx,%edi
+  80041f:	89 d6                	mov    %edx,%esi
+  800421:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800423:	eb 99                	jmp    8003be <sys_cgetc+0x38>
+
+00800425 <sys_env_destroy>:
+{
+  800425:	55                   	push   %ebp
+  800426:	89 e5                	mov    %esp,%ebp
+  800428:	57                   	push   %edi
+  800429:	56                   	push   %esi
+  80042a:	53                   	push   %ebx
+  80042b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80042e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800435:	78 36                	js     80046d <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  800437:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80043e:	74 79                	je     8004b9 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  800440:	8b 55 08             	mov    0x8(%ebp),%edx
+  800443:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800448:	b8 03 00 00 00       	mov    $0x3,%eax
+  80044d:	89 cb                	mov    %ecx,%ebx
+  80044f:	89 cf                	mov    %ecx,%edi
+  800451:	89 ce                	mov    %ecx,%esi
+  800453:	55                   	push   %ebp
+  800454:	68 5d 04 80 00       	push   $0x80045d
+  800459:	89 e5                	mov    %esp,%ebp
+  80045b:	0f 34                	sysenter
+  80045d:	83 c4 04             	add    $0x4,%esp
+  800460:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800461:	85 c0                	test   %eax,%eax
+  800463:	7f 6b                	jg     8004d0 <sys_env_destroy+0xab>
+}
+  800465:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800468:	5b                   	pop    %ebx
+  800469:	5e                   	pop    %esi
+  80046a:	5f                   	pop    %edi
+  80046b:	5d                   	pop    %ebp
+  80046c:	c3                   	ret
+  80046d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800472:	0f a2                	cpuid
+		return 0;
+  800474:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800479:	f6 c6 08             	test   $0x8,%dh
+  80047c:	74 15                	je     800493 <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80047e:	89 c2                	mov    %eax,%edx
+  800480:	c1 ea 08             	shr    $0x8,%edx
+  800483:	83 e2 0f             	and    $0xf,%edx
+  800486:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80048b:	83 fa 06             	cmp    $0x6,%edx
+  80048e:	74 0e                	je     80049e <sys_env_destroy+0x79>
+  800490:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800493:	0f b6 c9             	movzbl %cl,%ecx
+  800496:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80049c:	eb 99                	jmp    800437 <sys_env_destroy+0x12>
+  80049e:	89 c2                	mov    %eax,%edx
+  8004a0:	c1 ea 04             	shr    $0x4,%edx
+  8004a3:	83 e2 0f             	and    $0xf,%edx
+  8004a6:	83 fa 02             	cmp    $0x2,%edx
+  8004a9:	77 e5                	ja     800490 <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  8004ab:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8004ae:	83 f8 02             	cmp    $0x2,%eax
+  8004b1:	0f 97 c1             	seta   %cl
+  8004b4:	0f b6 c9             	movzbl %cl,%ecx
+  8004b7:	eb d7                	jmp    800490 <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  8004b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004be:	b8 03 00 00 00       	mov    $0x3,%eax
+  8004c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004c6:	89 cb                	mov    %ecx,%ebx
+  8004c8:	89 cf                	mov    %ecx,%edi
+  8004ca:	89 ce                	mov    %ecx,%esi
+  8004cc:	cd 30                	int    $0x30
+  8004ce:	eb 91                	jmp    800461 <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004d0:	83 ec 0c             	sub    $0xc,%esp
+  8004d3:	50                   	push   %eax
+  8004d4:	6a 03                	push   $0x3
+  8004d6:	68 ca 27 80 00       	push   $0x8027ca
+  8004db:	6a 4a                	push   $0x4a
+  8004dd:	68 e7 27 80 00       	push   $0x8027e7
+  8004e2:	e8 1e 17 00 00       	call   801c05 <_panic>
+
+008004e7 <sys_getenvid>:
+{
+  8004e7:	55                   	push   %ebp
+  8004e8:	89 e5                	mov    %esp,%ebp
+  8004ea:	57                   	push   %edi
+  8004eb:	56                   	push   %esi
+  8004ec:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8004ed:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8004f4:	78 2e                	js     800524 <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  8004f6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8004fd:	74 71                	je     800570 <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  8004ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  800504:	b8 02 00 00 00       	mov    $0x2,%eax
+  800509:	89 d1                	mov    %edx,%ecx
+  80050b:	89 d3                	mov    %edx,%ebx
+  80050d:	89 d7                	mov    %edx,%edi
+  80050f:	89 d6                	mov    %edx,%esi
+  800511:	55                   	push   %ebp
+  800512:	68 1b 05 80 00       	push   $0x80051b
+  800517:	89 e5                	mov    %esp,%ebp
+  800519:	0f 34                	sysenter
+  80051b:	83 c4 04             	add    $0x4,%esp
+  80051e:	5d                   	pop    %ebp
+}
+  80051f:	5b                   	pop    %ebx
+  800520:	5e                   	pop    %esi
+  800521:	5f                   	pop    %edi
+  800522:	5d                   	pop    %ebp
+  800523:	c3                   	ret
+  800524:	b8 01 00 00 00       	mov    $0x1,%eax
+  800529:	0f a2                	cpuid
+		return 0;
+  80052b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800530:	f6 c6 08             	test   $0x8,%dh
+  800533:	74 15                	je     80054a <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800535:	89 c2                	mov    %eax,%edx
+  800537:	c1 ea 08             	shr    $0x8,%edx
+  80053a:	83 e2 0f             	and    $0xf,%edx
+  80053d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800542:	83 fa 06             	cmp    $0x6,%edx
+  800545:	74 0e                	je     800555 <sys_getenvid+0x6e>
+  800547:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80054a:	0f b6 c9             	movzbl %cl,%ecx
+  80054d:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800553:	eb a1                	jmp    8004f6 <sys_getenvid+0xf>
+  800555:	89 c2                	mov    %eax,%edx
+  800557:	c1 ea 04             	shr    $0x4,%edx
+  80055a:	83 e2 0f             	and    $0xf,%edx
+  80055d:	83 fa 02             	cmp    $0x2,%edx
+  800560:	77 e5                	ja     800547 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  800562:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800565:	83 f8 02             	cmp    $0x2,%eax
+  800568:	0f 97 c1             	seta   %cl
+  80056b:	0f b6 c9             	movzbl %cl,%ecx
+  80056e:	eb d7                	jmp    800547 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  800570:	ba 00 00 00 00       	mov    $0x0,%edx
+  800575:	b8 02 00 00 00       	mov    $0x2,%eax
+  80057a:	89 d1                	mov    %edx,%ecx
+  80057c:	89 d3                	mov    %edx,%ebx
+  80057e:	89 d7                	mov    %edx,%edi
+  800580:	89 d6                	mov    %edx,%esi
+  800582:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  800584:	eb 99                	jmp    80051f <sys_getenvid+0x38>
+
+00800586 <sys_page_alloc>:
+{
+  800586:	55                   	push   %ebp
+  800587:	89 e5                	mov    %esp,%ebp
+  800589:	57                   	push   %edi
+  80058a:	56                   	push   %esi
+  80058b:	53                   	push   %ebx
+  80058c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80058f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800596:	78 38                	js     8005d0 <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  800598:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80059f:	74 7b                	je     80061c <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  8005a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8005a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005ac:	b8 04 00 00 00       	mov    $0x4,%eax
+  8005b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005b4:	89 f7                	mov    %esi,%edi
+  8005b6:	55                   	push   %ebp
+  8005b7:	68 c0 05 80 00       	push   $0x8005c0
+  8005bc:	89 e5                	mov    %esp,%ebp
+  8005be:	0f 34                	sysenter
+  8005c0:	83 c4 04             	add    $0x4,%esp
+  8005c3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8005c4:	85 c0                	test   %eax,%eax
+  8005c6:	7f 6d                	jg     800635 <sys_page_alloc+0xaf>
+}
+  8005c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005cb:	5b                   	pop    %ebx
+  8005cc:	5e                   	pop    %esi
+  8005cd:	5f                   	pop    %edi
+  8005ce:	5d                   	pop    %ebp
+  8005cf:	c3                   	ret
+  8005d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8005d5:	0f a2                	cpuid
+		return 0;
+  8005d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8005dc:	f6 c6 08             	test   $0x8,%dh
+  8005df:	74 15                	je     8005f6 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8005e1:	89 c2                	mov    %eax,%edx
+  8005e3:	c1 ea 08             	shr    $0x8,%edx
+  8005e6:	83 e2 0f             	and    $0xf,%edx
+  8005e9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8005ee:	83 fa 06             	cmp    $0x6,%edx
+  8005f1:	74 0e                	je     800601 <sys_page_alloc+0x7b>
+  8005f3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8005f6:	0f b6 c9             	movzbl %cl,%ecx
+  8005f9:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8005ff:	eb 97                	jmp    800598 <sys_page_alloc+0x12>
+  800601:	89 c2                	mov    %eax,%edx
+  800603:	c1 ea 04             	shr    $0x4,%edx
+  800606:	83 e2 0f             	and    $0xf,%edx
+  800609:	83 fa 02             	cmp    $0x2,%edx
+  80060c:	77 e5                	ja     8005f3 <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  80060e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800611:	83 f8 02             	cmp    $0x2,%eax
+  800614:	0f 97 c1             	seta   %cl
+  800617:	0f b6 c9             	movzbl %cl,%ecx
+  80061a:	eb d7                	jmp    8005f3 <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  80061c:	be 00 00 00 00       	mov    $0x0,%esi
+  800621:	b8 04 00 00 00       	mov    $0x4,%eax
+  800626:	8b 55 08             	mov    0x8(%ebp),%edx
+  800629:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80062c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80062f:	89 f7                	mov    %esi,%edi
+  800631:	cd 30                	int    $0x30
+  800633:	eb 8f                	jmp    8005c4 <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800635:	83 ec 0c             	sub    $0xc,%esp
+  800638:	50                   	push   %eax
+  800639:	6a 04                	push   $0x4
+  80063b:	68 ca 27 80 00       	push   $0x8027ca
+  800640:	6a 4a                	push   $0x4a
+  800642:	68 e7 27 80 00       	push   $0x8027e7
+  800647:	e8 b9 15 00 00       	call   801c05 <_panic>
+
+0080064c <sys_page_map>:
+{
+  80064c:	55                   	push   %ebp
+  80064d:	89 e5                	mov    %esp,%ebp
+  80064f:	57                   	push   %edi
+  800650:	56                   	push   %esi
+  800651:	53                   	push   %ebx
+  800652:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800655:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80065c:	78 37                	js     800695 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  80065e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800665:	74 7a                	je     8006e1 <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  800667:	8b 55 08             	mov    0x8(%ebp),%edx
+  80066a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80066d:	b8 05 00 00 00       	mov    $0x5,%eax
+  800672:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800675:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800678:	8b 75 18             	mov    0x18(%ebp),%esi
+  80067b:	55                   	push   %ebp
+  80067c:	68 85 06 80 00       	push   $0x800685
+  800681:	89 e5                	mov    %esp,%ebp
+  800683:	0f 34                	sysenter
+  800685:	83 c4 04             	add    $0x4,%esp
+  800688:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800689:	85 c0                	test   %eax,%eax
+  80068b:	7f 6c                	jg     8006f9 <sys_page_map+0xad>
+}
+  80068d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800690:	5b                   	pop    %ebx
+  800691:	5e                   	pop    %esi
+  800692:	5f                   	pop    %edi
+  800693:	5d                   	pop    %ebp
+  800694:	c3                   	ret
+  800695:	b8 01 00 00 00       	mov    $0x1,%eax
+  80069a:	0f a2                	cpuid
+		return 0;
+  80069c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8006a1:	f6 c6 08             	test   $0x8,%dh
+  8006a4:	74 15                	je     8006bb <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8006a6:	89 c2                	mov    %eax,%edx
+  8006a8:	c1 ea 08             	shr    $0x8,%edx
+  8006ab:	83 e2 0f             	and    $0xf,%edx
+  8006ae:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8006b3:	83 fa 06             	cmp    $0x6,%edx
+  8006b6:	74 0e                	je     8006c6 <sys_page_map+0x7a>
+  8006b8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8006bb:	0f b6 c9             	movzbl %cl,%ecx
+  8006be:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8006c4:	eb 98                	jmp    80065e <sys_page_map+0x12>
+  8006c6:	89 c2                	mov    %eax,%edx
+  8006c8:	c1 ea 04             	shr    $0x4,%edx
+  8006cb:	83 e2 0f             	and    $0xf,%edx
+  8006ce:	83 fa 02             	cmp    $0x2,%edx
+  8006d1:	77 e5                	ja     8006b8 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  8006d3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8006d6:	83 f8 02             	cmp    $0x2,%eax
+  8006d9:	0f 97 c1             	seta   %cl
+  8006dc:	0f b6 c9             	movzbl %cl,%ecx
+  8006df:	eb d7                	jmp    8006b8 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  8006e1:	b8 05 00 00 00       	mov    $0x5,%eax
+  8006e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006ec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8006ef:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8006f2:	8b 75 18             	mov    0x18(%ebp),%esi
+  8006f5:	cd 30                	int    $0x30
+  8006f7:	eb 90                	jmp    800689 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8006f9:	83 ec 0c             	sub    $0xc,%esp
+  8006fc:	50                   	push   %eax
+  8006fd:	6a 05                	push   $0x5
+  8006ff:	68 ca 27 80 00       	push   $0x8027ca
+  800704:	6a 4a                	push   $0x4a
+  800706:	68 e7 27 80 00       	push   $0x8027e7
+  80070b:	e8 f5 14 00 00       	call   801c05 <_panic>
+
+00800710 <sys_page_unmap>:
+{
+  800710:	55                   	push   %ebp
+  800711:	89 e5                	mov    %esp,%ebp
+  800713:	57                   	push   %edi
+  800714:	56                   	push   %esi
+  800715:	53                   	push   %ebx
+  800716:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800719:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800720:	78 37                	js     800759 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  800722:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800729:	74 7a                	je     8007a5 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  80072b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800730:	8b 55 08             	mov    0x8(%ebp),%edx
+  800733:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800736:	b8 06 00 00 00       	mov    $0x6,%eax
+  80073b:	89 df                	mov    %ebx,%edi
+  80073d:	89 de                	mov    %ebx,%esi
+  80073f:	55                   	push   %ebp
+  800740:	68 49 07 80 00       	push   $0x800749
+  800745:	89 e5                	mov    %esp,%ebp
+  800747:	0f 34                	sysenter
+  800749:	83 c4 04             	add    $0x4,%esp
+  80074c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80074d:	85 c0                	test   %eax,%eax
+  80074f:	7f 6c                	jg     8007bd <sys_page_unmap+0xad>
+}
+  800751:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800754:	5b                   	pop    %ebx
+  800755:	5e                   	pop    %esi
+  800756:	5f                   	pop    %edi
+  800757:	5d                   	pop    %ebp
+  800758:	c3                   	ret
+  800759:	b8 01 00 00 00       	mov    $0x1,%eax
+  80075e:	0f a2                	cpuid
+		return 0;
+  800760:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800765:	f6 c6 08             	test   $0x8,%dh
+  800768:	74 15                	je     80077f <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80076a:	89 c2                	mov    %eax,%edx
+  80076c:	c1 ea 08             	shr    $0x8,%edx
+  80076f:	83 e2 0f             	and    $0xf,%edx
+  800772:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800777:	83 fa 06             	cmp    $0x6,%edx
+  80077a:	74 0e                	je     80078a <sys_page_unmap+0x7a>
+  80077c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80077f:	0f b6 c9             	movzbl %cl,%ecx
+  800782:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800788:	eb 98                	jmp    800722 <sys_page_unmap+0x12>
+  80078a:	89 c2                	mov    %eax,%edx
+  80078c:	c1 ea 04             	shr    $0x4,%edx
+  80078f:	83 e2 0f             	and    $0xf,%edx
+  800792:	83 fa 02             	cmp    $0x2,%edx
+  800795:	77 e5                	ja     80077c <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  800797:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80079a:	83 f8 02             	cmp    $0x2,%eax
+  80079d:	0f 97 c1             	seta   %cl
+  8007a0:	0f b6 c9             	movzbl %cl,%ecx
+  8007a3:	eb d7                	jmp    80077c <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  8007a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007aa:	b8 06 00 00 00       	mov    $0x6,%eax
+  8007af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007b5:	89 df                	mov    %ebx,%edi
+  8007b7:	89 de                	mov    %ebx,%esi
+  8007b9:	cd 30                	int    $0x30
+  8007bb:	eb 90                	jmp    80074d <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8007bd:	83 ec 0c             	sub    $0xc,%esp
+  8007c0:	50                   	push   %eax
+  8007c1:	6a 06                	push   $0x6
+  8007c3:	68 ca 27 80 00       	push   $0x8027ca
+  8007c8:	6a 4a                	push   $0x4a
+  8007ca:	68 e7 27 80 00       	push   $0x8027e7
+  8007cf:	e8 31 14 00 00       	call   801c05 <_panic>
+
+008007d4 <sys_page_copy>:
+{
+  8007d4:	55                   	push   %ebp
+  8007d5:	89 e5                	mov    %esp,%ebp
+  8007d7:	57                   	push   %edi
+  8007d8:	56                   	push   %esi
+  8007d9:	53                   	push   %ebx
+  8007da:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8007dd:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8007e4:	78 37                	js     80081d <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  8007e6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8007ed:	74 7a                	je     800869 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  8007ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007f5:	b8 29 00 00 00       	mov    $0x29,%eax
+  8007fa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8007fd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800800:	8b 75 18             	mov    0x18(%ebp),%esi
+  800803:	55                   	push   %ebp
+  800804:	68 0d 08 80 00       	push   $0x80080d
+  800809:	89 e5                	mov    %esp,%ebp
+  80080b:	0f 34                	sysenter
+  80080d:	83 c4 04             	add    $0x4,%esp
+  800810:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800811:	85 c0                	test   %eax,%eax
+  800813:	7f 6c                	jg     800881 <sys_page_copy+0xad>
+}
+  800815:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800818:	5b                   	pop    %ebx
+  800819:	5e                   	pop    %esi
+  80081a:	5f                   	pop    %edi
+  80081b:	5d                   	pop    %ebp
+  80081c:	c3                   	ret
+  80081d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800822:	0f a2                	cpuid
+		return 0;
+  800824:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800829:	f6 c6 08             	test   $0x8,%dh
+  80082c:	74 15                	je     800843 <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80082e:	89 c2                	mov    %eax,%edx
+  800830:	c1 ea 08             	shr    $0x8,%edx
+  800833:	83 e2 0f             	and    $0xf,%edx
+  800836:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80083b:	83 fa 06             	cmp    $0x6,%edx
+  80083e:	74 0e                	je     80084e <sys_page_copy+0x7a>
+  800840:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800843:	0f b6 c9             	movzbl %cl,%ecx
+  800846:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80084c:	eb 98                	jmp    8007e6 <sys_page_copy+0x12>
+  80084e:	89 c2                	mov    %eax,%edx
+  800850:	c1 ea 04             	shr    $0x4,%edx
+  800853:	83 e2 0f             	and    $0xf,%edx
+  800856:	83 fa 02             	cmp    $0x2,%edx
+  800859:	77 e5                	ja     800840 <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  80085b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80085e:	83 f8 02             	cmp    $0x2,%eax
+  800861:	0f 97 c1             	seta   %cl
+  800864:	0f b6 c9             	movzbl %cl,%ecx
+  800867:	eb d7                	jmp    800840 <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  800869:	b8 29 00 00 00       	mov    $0x29,%eax
+  80086e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800871:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800874:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800877:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80087a:	8b 75 18             	mov    0x18(%ebp),%esi
+  80087d:	cd 30                	int    $0x30
+  80087f:	eb 90                	jmp    800811 <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800881:	83 ec 0c             	sub    $0xc,%esp
+  800884:	50                   	push   %eax
+  800885:	6a 29                	push   $0x29
+  800887:	68 ca 27 80 00       	push   $0x8027ca
+  80088c:	6a 4a                	push   $0x4a
+  80088e:	68 e7 27 80 00       	push   $0x8027e7
+  800893:	e8 6d 13 00 00       	call   801c05 <_panic>
+
+00800898 <sys_yield>:
+{
+  800898:	55                   	push   %ebp
+  800899:	89 e5                	mov    %esp,%ebp
+  80089b:	57                   	push   %edi
+  80089c:	56                   	push   %esi
+  80089d:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80089e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8008a5:	78 2e                	js     8008d5 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  8008a7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8008ae:	74 71                	je     800921 <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  8008b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008b5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8008ba:	89 d1                	mov    %edx,%ecx
+  8008bc:	89 d3                	mov    %edx,%ebx
+  8008be:	89 d7                	mov    %edx,%edi
+  8008c0:	89 d6                	mov    %edx,%esi
+  8008c2:	55                   	push   %ebp
+  8008c3:	68 cc 08 80 00       	push   $0x8008cc
+  8008c8:	89 e5                	mov    %esp,%ebp
+  8008ca:	0f 34                	sysenter
+  8008cc:	83 c4 04             	add    $0x4,%esp
+  8008cf:	5d                   	pop    %ebp
+}
+  8008d0:	5b                   	pop    %ebx
+  8008d1:	5e                   	pop    %esi
+  8008d2:	5f                   	pop    %edi
+  8008d3:	5d                   	pop    %ebp
+  8008d4:	c3                   	ret
+  8008d5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8008da:	0f a2                	cpuid
+		return 0;
+  8008dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8008e1:	f6 c6 08             	test   $0x8,%dh
+  8008e4:	74 15                	je     8008fb <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8008e6:	89 c2                	mov    %eax,%edx
+  8008e8:	c1 ea 08             	shr    $0x8,%edx
+  8008eb:	83 e2 0f             	and    $0xf,%edx
+  8008ee:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8008f3:	83 fa 06             	cmp    $0x6,%edx
+  8008f6:	74 0e                	je     800906 <sys_yield+0x6e>
+  8008f8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8008fb:	0f b6 c9             	movzbl %cl,%ecx
+  8008fe:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800904:	eb a1                	jmp    8008a7 <sys_yield+0xf>
+  800906:	89 c2                	mov    %eax,%edx
+  800908:	c1 ea 04             	shr    $0x4,%edx
+  80090b:	83 e2 0f             	and    $0xf,%edx
+  80090e:	83 fa 02             	cmp    $0x2,%edx
+  800911:	77 e5                	ja     8008f8 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  800913:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800916:	83 f8 02             	cmp    $0x2,%eax
+  800919:	0f 97 c1             	seta   %cl
+  80091c:	0f b6 c9             	movzbl %cl,%ecx
+  80091f:	eb d7                	jmp    8008f8 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  800921:	ba 00 00 00 00       	mov    $0x0,%edx
+  800926:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80092b:	89 d1                	mov    %edx,%ecx
+  80092d:	89 d3                	mov    %edx,%ebx
+  80092f:	89 d7                	mov    %edx,%edi
+  800931:	89 d6                	mov    %edx,%esi
+  800933:	cd 30                	int    $0x30
+}
+  800935:	eb 99                	jmp    8008d0 <sys_yield+0x38>
+
+00800937 <sys_env_set_status>:
+{
+  800937:	55                   	push   %ebp
+  800938:	89 e5                	mov    %esp,%ebp
+  80093a:	57                   	push   %edi
+  80093b:	56                   	push   %esi
+  80093c:	53                   	push   %ebx
+  80093d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800940:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800947:	78 37                	js     800980 <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  800949:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800950:	74 7a                	je     8009cc <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  800952:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800957:	8b 55 08             	mov    0x8(%ebp),%edx
+  80095a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80095d:	b8 08 00 00 00       	mov    $0x8,%eax
+  800962:	89 df                	mov    %ebx,%edi
+  800964:	89 de                	mov    %ebx,%esi
+  800966:	55                   	push   %ebp
+  800967:	68 70 09 80 00       	push   $0x800970
+  80096c:	89 e5                	mov    %esp,%ebp
+  80096e:	0f 34                	sysenter
+  800970:	83 c4 04             	add    $0x4,%esp
+  800973:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800974:	85 c0                	test   %eax,%eax
+  800976:	7f 6c                	jg     8009e4 <sys_env_set_status+0xad>
+}
+  800978:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80097b:	5b                   	pop    %ebx
+  80097c:	5e                   	pop    %esi
+  80097d:	5f                   	pop    %edi
+  80097e:	5d                   	pop    %ebp
+  80097f:	c3                   	ret
+  800980:	b8 01 00 00 00       	mov    $0x1,%eax
+  800985:	0f a2                	cpuid
+		return 0;
+  800987:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80098c:	f6 c6 08             	test   $0x8,%dh
+  80098f:	74 15                	je     8009a6 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800991:	89 c2                	mov    %eax,%edx
+  800993:	c1 ea 08             	shr    $0x8,%edx
+  800996:	83 e2 0f             	and    $0xf,%edx
+  800999:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80099e:	83 fa 06             	cmp    $0x6,%edx
+  8009a1:	74 0e                	je     8009b1 <sys_env_set_status+0x7a>
+  8009a3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8009a6:	0f b6 c9             	movzbl %cl,%ecx
+  8009a9:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8009af:	eb 98                	jmp    800949 <sys_env_set_status+0x12>
+  8009b1:	89 c2                	mov    %eax,%edx
+  8009b3:	c1 ea 04             	shr    $0x4,%edx
+  8009b6:	83 e2 0f             	and    $0xf,%edx
+  8009b9:	83 fa 02             	cmp    $0x2,%edx
+  8009bc:	77 e5                	ja     8009a3 <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  8009be:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8009c1:	83 f8 02             	cmp    $0x2,%eax
+  8009c4:	0f 97 c1             	seta   %cl
+  8009c7:	0f b6 c9             	movzbl %cl,%ecx
+  8009ca:	eb d7                	jmp    8009a3 <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  8009cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009d1:	b8 08 00 00 00       	mov    $0x8,%eax
+  8009d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009dc:	89 df                	mov    %ebx,%edi
+  8009de:	89 de                	mov    %ebx,%esi
+  8009e0:	cd 30                	int    $0x30
+  8009e2:	eb 90                	jmp    800974 <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8009e4:	83 ec 0c             	sub    $0xc,%esp
+  8009e7:	50                   	push   %eax
+  8009e8:	6a 08                	push   $0x8
+  8009ea:	68 ca 27 80 00       	push   $0x8027ca
+  8009ef:	6a 4a                	push   $0x4a
+  8009f1:	68 e7 27 80 00       	push   $0x8027e7
+  8009f6:	e8 0a 12 00 00       	call   801c05 <_panic>
+
+008009fb <sys_sysinfo>:
+{
+  8009fb:	55                   	push   %ebp
+  8009fc:	89 e5                	mov    %esp,%ebp
+  8009fe:	57                   	push   %edi
+  8009ff:	56                   	push   %esi
+  800a00:	53                   	push   %ebx
+  800a01:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800a04:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800a0b:	78 36                	js     800a43 <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  800a0d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800a14:	74 79                	je     800a8f <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  800a16:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a19:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a1e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800a23:	89 cb                	mov    %ecx,%ebx
+  800a25:	89 cf                	mov    %ecx,%edi
+  800a27:	89 ce                	mov    %ecx,%esi
+  800a29:	55                   	push   %ebp
+  800a2a:	68 33 0a 80 00       	push   $0x800a33
+  800a2f:	89 e5                	mov    %esp,%ebp
+  800a31:	0f 34                	sysenter
+  800a33:	83 c4 04             	add    $0x4,%esp
+  800a36:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800a37:	85 c0                	test   %eax,%eax
+  800a39:	7f 6b                	jg     800aa6 <sys_sysinfo+0xab>
+}
+  800a3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a3e:	5b                   	pop    %ebx
+  800a3f:	5e                   	pop    %esi
+  800a40:	5f                   	pop    %edi
+  800a41:	5d                   	pop    %ebp
+  800a42:	c3                   	ret
+  800a43:	b8 01 00 00 00       	mov    $0x1,%eax
+  800a48:	0f a2                	cpuid
+		return 0;
+  800a4a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800a4f:	f6 c6 08             	test   $0x8,%dh
+  800a52:	74 15                	je     800a69 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800a54:	89 c2                	mov    %eax,%edx
+  800a56:	c1 ea 08             	shr    $0x8,%edx
+  800a59:	83 e2 0f             	and    $0xf,%edx
+  800a5c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800a61:	83 fa 06             	cmp    $0x6,%edx
+  800a64:	74 0e                	je     800a74 <sys_sysinfo+0x79>
+  800a66:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800a69:	0f b6 c9             	movzbl %cl,%ecx
+  800a6c:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800a72:	eb 99                	jmp    800a0d <sys_sysinfo+0x12>
+  800a74:	89 c2                	mov    %eax,%edx
+  800a76:	c1 ea 04             	shr    $0x4,%edx
+  800a79:	83 e2 0f             	and    $0xf,%edx
+  800a7c:	83 fa 02             	cmp    $0x2,%edx
+  800a7f:	77 e5                	ja     800a66 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  800a81:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800a84:	83 f8 02             	cmp    $0x2,%eax
+  800a87:	0f 97 c1             	seta   %cl
+  800a8a:	0f b6 c9             	movzbl %cl,%ecx
+  800a8d:	eb d7                	jmp    800a66 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  800a8f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a94:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800a99:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a9c:	89 cb                	mov    %ecx,%ebx
+  800a9e:	89 cf                	mov    %ecx,%edi
+  800aa0:	89 ce                	mov    %ecx,%esi
+  800aa2:	cd 30                	int    $0x30
+  800aa4:	eb 91                	jmp    800a37 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800aa6:	83 ec 0c             	sub    $0xc,%esp
+  800aa9:	50                   	push   %eax
+  800aaa:	6a 0b                	push   $0xb
+  800aac:	68 ca 27 80 00       	push   $0x8027ca
+  800ab1:	6a 4a                	push   $0x4a
+  800ab3:	68 e7 27 80 00       	push   $0x8027e7
+  800ab8:	e8 48 11 00 00       	call   801c05 <_panic>
+
+00800abd <sys_env_set_trapframe>:
+{
+  800abd:	55                   	push   %ebp
+  800abe:	89 e5                	mov    %esp,%ebp
+  800ac0:	57                   	push   %edi
+  800ac1:	56                   	push   %esi
+  800ac2:	53                   	push   %ebx
+  800ac3:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800ac6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800acd:	78 37                	js     800b06 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  800acf:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ad6:	74 7a                	je     800b52 <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  800ad8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800add:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ae0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ae3:	b8 13 00 00 00       	mov    $0x13,%eax
+  800ae8:	89 df                	mov    %ebx,%edi
+  800aea:	89 de                	mov    %ebx,%esi
+  800aec:	55                   	push   %ebp
+  800aed:	68 f6 0a 80 00       	push   $0x800af6
+  800af2:	89 e5                	mov    %esp,%ebp
+  800af4:	0f 34                	sysenter
+  800af6:	83 c4 04             	add    $0x4,%esp
+  800af9:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800afa:	85 c0                	test   %eax,%eax
+  800afc:	7f 6c                	jg     800b6a <sys_env_set_trapframe+0xad>
+}
+  800afe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b01:	5b                   	pop    %ebx
+  800b02:	5e                   	pop    %esi
+  800b03:	5f                   	pop    %edi
+  800b04:	5d                   	pop    %ebp
+  800b05:	c3                   	ret
+  800b06:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b0b:	0f a2                	cpuid
+		return 0;
+  800b0d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800b12:	f6 c6 08             	test   $0x8,%dh
+  800b15:	74 15                	je     800b2c <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800b17:	89 c2                	mov    %eax,%edx
+  800b19:	c1 ea 08             	shr    $0x8,%edx
+  800b1c:	83 e2 0f             	and    $0xf,%edx
+  800b1f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800b24:	83 fa 06             	cmp    $0x6,%edx
+  800b27:	74 0e                	je     800b37 <sys_env_set_trapframe+0x7a>
+  800b29:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800b2c:	0f b6 c9             	movzbl %cl,%ecx
+  800b2f:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800b35:	eb 98                	jmp    800acf <sys_env_set_trapframe+0x12>
+  800b37:	89 c2                	mov    %eax,%edx
+  800b39:	c1 ea 04             	shr    $0x4,%edx
+  800b3c:	83 e2 0f             	and    $0xf,%edx
+  800b3f:	83 fa 02             	cmp    $0x2,%edx
+  800b42:	77 e5                	ja     800b29 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  800b44:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800b47:	83 f8 02             	cmp    $0x2,%eax
+  800b4a:	0f 97 c1             	seta   %cl
+  800b4d:	0f b6 c9             	movzbl %cl,%ecx
+  800b50:	eb d7                	jmp    800b29 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  800b52:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b57:	b8 13 00 00 00       	mov    $0x13,%eax
+  800b5c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b5f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b62:	89 df                	mov    %ebx,%edi
+  800b64:	89 de                	mov    %ebx,%esi
+  800b66:	cd 30                	int    $0x30
+  800b68:	eb 90                	jmp    800afa <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b6a:	83 ec 0c             	sub    $0xc,%esp
+  800b6d:	50                   	push   %eax
+  800b6e:	6a 13                	push   $0x13
+  800b70:	68 ca 27 80 00       	push   $0x8027ca
+  800b75:	6a 4a                	push   $0x4a
+  800b77:	68 e7 27 80 00       	push   $0x8027e7
+  800b7c:	e8 84 10 00 00       	call   801c05 <_panic>
+
+00800b81 <sys_env_set_stack_limit>:
+{
+  800b81:	55                   	push   %ebp
+  800b82:	89 e5                	mov    %esp,%ebp
+  800b84:	57                   	push   %edi
+  800b85:	56                   	push   %esi
+  800b86:	53                   	push   %ebx
+  800b87:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800b8a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b91:	78 37                	js     800bca <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  800b93:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b9a:	74 7a                	je     800c16 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  800b9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ba1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ba4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ba7:	b8 19 00 00 00       	mov    $0x19,%eax
+  800bac:	89 df                	mov    %ebx,%edi
+  800bae:	89 de                	mov    %ebx,%esi
+  800bb0:	55                   	push   %ebp
+  800bb1:	68 ba 0b 80 00       	push   $0x800bba
+  800bb6:	89 e5                	mov    %esp,%ebp
+  800bb8:	0f 34                	sysenter
+  800bba:	83 c4 04             	add    $0x4,%esp
+  800bbd:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800bbe:	85 c0                	test   %eax,%eax
+  800bc0:	7f 6c                	jg     800c2e <sys_env_set_stack_limit+0xad>
+}
+  800bc2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bc5:	5b                   	pop    %ebx
+  800bc6:	5e                   	pop    %esi
+  800bc7:	5f                   	pop    %edi
+  800bc8:	5d                   	pop    %ebp
+  800bc9:	c3                   	ret
+  800bca:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bcf:	0f a2                	cpuid
+		return 0;
+  800bd1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800bd6:	f6 c6 08             	test   $0x8,%dh
+  800bd9:	74 15                	je     800bf0 <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800bdb:	89 c2                	mov    %eax,%edx
+  800bdd:	c1 ea 08             	shr    $0x8,%edx
+  800be0:	83 e2 0f             	and    $0xf,%edx
+  800be3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800be8:	83 fa 06             	cmp    $0x6,%edx
+  800beb:	74 0e                	je     800bfb <sys_env_set_stack_limit+0x7a>
+  800bed:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800bf0:	0f b6 c9             	movzbl %cl,%ecx
+  800bf3:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800bf9:	eb 98                	jmp    800b93 <sys_env_set_stack_limit+0x12>
+  800bfb:	89 c2                	mov    %eax,%edx
+  800bfd:	c1 ea 04             	shr    $0x4,%edx
+  800c00:	83 e2 0f             	and    $0xf,%edx
+  800c03:	83 fa 02             	cmp    $0x2,%edx
+  800c06:	77 e5                	ja     800bed <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  800c08:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c0b:	83 f8 02             	cmp    $0x2,%eax
+  800c0e:	0f 97 c1             	seta   %cl
+  800c11:	0f b6 c9             	movzbl %cl,%ecx
+  800c14:	eb d7                	jmp    800bed <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  800c16:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c1b:	b8 19 00 00 00       	mov    $0x19,%eax
+  800c20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c26:	89 df                	mov    %ebx,%edi
+  800c28:	89 de                	mov    %ebx,%esi
+  800c2a:	cd 30                	int    $0x30
+  800c2c:	eb 90                	jmp    800bbe <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c2e:	83 ec 0c             	sub    $0xc,%esp
+  800c31:	50                   	push   %eax
+  800c32:	6a 19                	push   $0x19
+  800c34:	68 ca 27 80 00       	push   $0x8027ca
+  800c39:	6a 4a                	push   $0x4a
+  800c3b:	68 e7 27 80 00       	push   $0x8027e7
+  800c40:	e8 c0 0f 00 00       	call   801c05 <_panic>
+
+00800c45 <sys_env_set_pgfault_upcall>:
+{
+  800c45:	55                   	push   %ebp
+  800c46:	89 e5                	mov    %esp,%ebp
+  800c48:	57                   	push   %edi
+  800c49:	56                   	push   %esi
+  800c4a:	53                   	push   %ebx
+  800c4b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800c4e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800c55:	78 37                	js     800c8e <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  800c57:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800c5e:	74 7a                	je     800cda <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  800c60:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c65:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c68:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c6b:	b8 09 00 00 00       	mov    $0x9,%eax
+  800c70:	89 df                	mov    %ebx,%edi
+  800c72:	89 de                	mov    %ebx,%esi
+  800c74:	55                   	push   %ebp
+  800c75:	68 7e 0c 80 00       	push   $0x800c7e
+  800c7a:	89 e5                	mov    %esp,%ebp
+  800c7c:	0f 34                	sysenter
+  800c7e:	83 c4 04             	add    $0x4,%esp
+  800c81:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c82:	85 c0                	test   %eax,%eax
+  800c84:	7f 6c                	jg     800cf2 <sys_env_set_pgfault_upcall+0xad>
+}
+  800c86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c89:	5b                   	pop    %ebx
+  800c8a:	5e                   	pop    %esi
+  800c8b:	5f                   	pop    %edi
+  800c8c:	5d                   	pop    %ebp
+  800c8d:	c3                   	ret
+  800c8e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c93:	0f a2                	cpuid
+		return 0;
+  800c95:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800c9a:	f6 c6 08             	test   $0x8,%dh
+  800c9d:	74 15                	je     800cb4 <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c9f:	89 c2                	mov    %eax,%edx
+  800ca1:	c1 ea 08             	shr    $0x8,%edx
+  800ca4:	83 e2 0f             	and    $0xf,%edx
+  800ca7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800cac:	83 fa 06             	cmp    $0x6,%edx
+  800caf:	74 0e                	je     800cbf <sys_env_set_pgfault_upcall+0x7a>
+  800cb1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800cb4:	0f b6 c9             	movzbl %cl,%ecx
+  800cb7:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800cbd:	eb 98                	jmp    800c57 <sys_env_set_pgfault_upcall+0x12>
+  800cbf:	89 c2                	mov    %eax,%edx
+  800cc1:	c1 ea 04             	shr    $0x4,%edx
+  800cc4:	83 e2 0f             	and    $0xf,%edx
+  800cc7:	83 fa 02             	cmp    $0x2,%edx
+  800cca:	77 e5                	ja     800cb1 <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  800ccc:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ccf:	83 f8 02             	cmp    $0x2,%eax
+  800cd2:	0f 97 c1             	seta   %cl
+  800cd5:	0f b6 c9             	movzbl %cl,%ecx
+  800cd8:	eb d7                	jmp    800cb1 <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  800cda:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cdf:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ce4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cea:	89 df                	mov    %ebx,%edi
+  800cec:	89 de                	mov    %ebx,%esi
+  800cee:	cd 30                	int    $0x30
+  800cf0:	eb 90                	jmp    800c82 <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cf2:	83 ec 0c             	sub    $0xc,%esp
+  800cf5:	50                   	push   %eax
+  800cf6:	6a 09                	push   $0x9
+  800cf8:	68 ca 27 80 00       	push   $0x8027ca
+  800cfd:	6a 4a                	push   $0x4a
+  800cff:	68 e7 27 80 00       	push   $0x8027e7
+  800d04:	e8 fc 0e 00 00       	call   801c05 <_panic>
+
+00800d09 <sys_ipc_try_send>:
+{
+  800d09:	55                   	push   %ebp
+  800d0a:	89 e5                	mov    %esp,%ebp
+  800d0c:	57                   	push   %edi
+  800d0d:	56                   	push   %esi
+  800d0e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800d0f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d16:	78 32                	js     800d4a <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  800d18:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d1f:	74 75                	je     800d96 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  800d21:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d27:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d2c:	be 00 00 00 00       	mov    $0x0,%esi
+  800d31:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d34:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d37:	55                   	push   %ebp
+  800d38:	68 41 0d 80 00       	push   $0x800d41
+  800d3d:	89 e5                	mov    %esp,%ebp
+  800d3f:	0f 34                	sysenter
+  800d41:	83 c4 04             	add    $0x4,%esp
+  800d44:	5d                   	pop    %ebp
+}
+  800d45:	5b                   	pop    %ebx
+  800d46:	5e                   	pop    %esi
+  800d47:	5f                   	pop    %edi
+  800d48:	5d                   	pop    %ebp
+  800d49:	c3                   	ret
+  800d4a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d4f:	0f a2                	cpuid
+		return 0;
+  800d51:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800d56:	f6 c6 08             	test   $0x8,%dh
+  800d59:	74 15                	je     800d70 <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d5b:	89 c2                	mov    %eax,%edx
+  800d5d:	c1 ea 08             	shr    $0x8,%edx
+  800d60:	83 e2 0f             	and    $0xf,%edx
+  800d63:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d68:	83 fa 06             	cmp    $0x6,%edx
+  800d6b:	74 0e                	je     800d7b <sys_ipc_try_send+0x72>
+  800d6d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800d70:	0f b6 c9             	movzbl %cl,%ecx
+  800d73:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800d79:	eb 9d                	jmp    800d18 <sys_ipc_try_send+0xf>
+  800d7b:	89 c2                	mov    %eax,%edx
+  800d7d:	c1 ea 04             	shr    $0x4,%edx
+  800d80:	83 e2 0f             	and    $0xf,%edx
+  800d83:	83 fa 02             	cmp    $0x2,%edx
+  800d86:	77 e5                	ja     800d6d <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  800d88:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d8b:	83 f8 02             	cmp    $0x2,%eax
+  800d8e:	0f 97 c1             	seta   %cl
+  800d91:	0f b6 c9             	movzbl %cl,%ecx
+  800d94:	eb d7                	jmp    800d6d <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  800d96:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d9b:	be 00 00 00 00       	mov    $0x0,%esi
+  800da0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800da9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dac:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  800dae:	eb 95                	jmp    800d45 <sys_ipc_try_send+0x3c>
+
+00800db0 <sys_ipc_send>:
+{
+  800db0:	55                   	push   %ebp
+  800db1:	89 e5                	mov    %esp,%ebp
+  800db3:	57                   	push   %edi
+  800db4:	56                   	push   %esi
+  800db5:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800db6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800dbd:	78 32                	js     800df1 <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  800dbf:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800dc6:	74 75                	je     800e3d <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  800dc8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dcb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dce:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800dd3:	be 00 00 00 00       	mov    $0x0,%esi
+  800dd8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ddb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dde:	55                   	push   %ebp
+  800ddf:	68 e8 0d 80 00       	push   $0x800de8
+  800de4:	89 e5                	mov    %esp,%ebp
+  800de6:	0f 34                	sysenter
+  800de8:	83 c4 04             	add    $0x4,%esp
+  800deb:	5d                   	pop    %ebp
+}
+  800dec:	5b                   	pop    %ebx
+  800ded:	5e                   	pop    %esi
+  800dee:	5f                   	pop    %edi
+  800def:	5d                   	pop    %ebp
+  800df0:	c3                   	ret
+  800df1:	b8 01 00 00 00       	mov    $0x1,%eax
+  800df6:	0f a2                	cpuid
+		return 0;
+  800df8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800dfd:	f6 c6 08             	test   $0x8,%dh
+  800e00:	74 15                	je     800e17 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e02:	89 c2                	mov    %eax,%edx
+  800e04:	c1 ea 08             	shr    $0x8,%edx
+  800e07:	83 e2 0f             	and    $0xf,%edx
+  800e0a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e0f:	83 fa 06             	cmp    $0x6,%edx
+  800e12:	74 0e                	je     800e22 <sys_ipc_send+0x72>
+  800e14:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e17:	0f b6 c9             	movzbl %cl,%ecx
+  800e1a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800e20:	eb 9d                	jmp    800dbf <sys_ipc_send+0xf>
+  800e22:	89 c2                	mov    %eax,%edx
+  800e24:	c1 ea 04             	shr    $0x4,%edx
+  800e27:	83 e2 0f             	and    $0xf,%edx
+  800e2a:	83 fa 02             	cmp    $0x2,%edx
+  800e2d:	77 e5                	ja     800e14 <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  800e2f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e32:	83 f8 02             	cmp    $0x2,%eax
+  800e35:	0f 97 c1             	seta   %cl
+  800e38:	0f b6 c9             	movzbl %cl,%ecx
+  800e3b:	eb d7                	jmp    800e14 <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  800e3d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800e42:	be 00 00 00 00       	mov    $0x0,%esi
+  800e47:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e4d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e50:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e53:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  800e55:	eb 95                	jmp    800dec <sys_ipc_send+0x3c>
+
+00800e57 <sys_ipc_recv>:
+{
+  800e57:	55                   	push   %ebp
+  800e58:	89 e5                	mov    %esp,%ebp
+  800e5a:	57                   	push   %edi
+  800e5b:	56                   	push   %esi
+  800e5c:	53                   	push   %ebx
+  800e5d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800e60:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e67:	78 36                	js     800e9f <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  800e69:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e70:	74 79                	je     800eeb <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  800e72:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e75:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e7a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e7f:	89 cb                	mov    %ecx,%ebx
+  800e81:	89 cf                	mov    %ecx,%edi
+  800e83:	89 ce                	mov    %ecx,%esi
+  800e85:	55                   	push   %ebp
+  800e86:	68 8f 0e 80 00       	push   $0x800e8f
+  800e8b:	89 e5                	mov    %esp,%ebp
+  800e8d:	0f 34                	sysenter
+  800e8f:	83 c4 04             	add    $0x4,%esp
+  800e92:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e93:	85 c0                	test   %eax,%eax
+  800e95:	7f 6b                	jg     800f02 <sys_ipc_recv+0xab>
+}
+  800e97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e9a:	5b                   	pop    %ebx
+  800e9b:	5e                   	pop    %esi
+  800e9c:	5f                   	pop    %edi
+  800e9d:	5d                   	pop    %ebp
+  800e9e:	c3                   	ret
+  800e9f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ea4:	0f a2                	cpuid
+		return 0;
+  800ea6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800eab:	f6 c6 08             	test   $0x8,%dh
+  800eae:	74 15                	je     800ec5 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800eb0:	89 c2                	mov    %eax,%edx
+  800eb2:	c1 ea 08             	shr    $0x8,%edx
+  800eb5:	83 e2 0f             	and    $0xf,%edx
+  800eb8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ebd:	83 fa 06             	cmp    $0x6,%edx
+  800ec0:	74 0e                	je     800ed0 <sys_ipc_recv+0x79>
+  800ec2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800ec5:	0f b6 c9             	movzbl %cl,%ecx
+  800ec8:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800ece:	eb 99                	jmp    800e69 <sys_ipc_recv+0x12>
+  800ed0:	89 c2                	mov    %eax,%edx
+  800ed2:	c1 ea 04             	shr    $0x4,%edx
+  800ed5:	83 e2 0f             	and    $0xf,%edx
+  800ed8:	83 fa 02             	cmp    $0x2,%edx
+  800edb:	77 e5                	ja     800ec2 <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  800edd:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ee0:	83 f8 02             	cmp    $0x2,%eax
+  800ee3:	0f 97 c1             	seta   %cl
+  800ee6:	0f b6 c9             	movzbl %cl,%ecx
+  800ee9:	eb d7                	jmp    800ec2 <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  800eeb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ef0:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ef5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef8:	89 cb                	mov    %ecx,%ebx
+  800efa:	89 cf                	mov    %ecx,%edi
+  800efc:	89 ce                	mov    %ecx,%esi
+  800efe:	cd 30                	int    $0x30
+  800f00:	eb 91                	jmp    800e93 <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f02:	83 ec 0c             	sub    $0xc,%esp
+  800f05:	50                   	push   %eax
+  800f06:	6a 0d                	push   $0xd
+  800f08:	68 ca 27 80 00       	push   $0x8027ca
+  800f0d:	6a 4a                	push   $0x4a
+  800f0f:	68 e7 27 80 00       	push   $0x8027e7
+  800f14:	e8 ec 0c 00 00       	call   801c05 <_panic>
+
+00800f19 <sys_ipc_send_range>:
+{
+  800f19:	55                   	push   %ebp
+  800f1a:	89 e5                	mov    %esp,%ebp
+  800f1c:	57                   	push   %edi
+  800f1d:	56                   	push   %esi
+  800f1e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800f1f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f26:	78 30                	js     800f58 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  800f28:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f2f:	74 73                	je     800fa4 <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  800f31:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f34:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f37:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  800f3c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f3f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f42:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f45:	55                   	push   %ebp
+  800f46:	68 4f 0f 80 00       	push   $0x800f4f
+  800f4b:	89 e5                	mov    %esp,%ebp
+  800f4d:	0f 34                	sysenter
+  800f4f:	83 c4 04             	add    $0x4,%esp
+  800f52:	5d                   	pop    %ebp
+}
+  800f53:	5b                   	pop    %ebx
+  800f54:	5e                   	pop    %esi
+  800f55:	5f                   	pop    %edi
+  800f56:	5d                   	pop    %ebp
+  800f57:	c3                   	ret
+  800f58:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f5d:	0f a2                	cpuid
+		return 0;
+  800f5f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f64:	f6 c6 08             	test   $0x8,%dh
+  800f67:	74 15                	je     800f7e <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f69:	89 c2                	mov    %eax,%edx
+  800f6b:	c1 ea 08             	shr    $0x8,%edx
+  800f6e:	83 e2 0f             	and    $0xf,%edx
+  800f71:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f76:	83 fa 06             	cmp    $0x6,%edx
+  800f79:	74 0e                	je     800f89 <sys_ipc_send_range+0x70>
+  800f7b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f7e:	0f b6 c9             	movzbl %cl,%ecx
+  800f81:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800f87:	eb 9f                	jmp    800f28 <sys_ipc_send_range+0xf>
+  800f89:	89 c2                	mov    %eax,%edx
+  800f8b:	c1 ea 04             	shr    $0x4,%edx
+  800f8e:	83 e2 0f             	and    $0xf,%edx
+  800f91:	83 fa 02             	cmp    $0x2,%edx
+  800f94:	77 e5                	ja     800f7b <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  800f96:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f99:	83 f8 02             	cmp    $0x2,%eax
+  800f9c:	0f 97 c1             	seta   %cl
+  800f9f:	0f b6 c9             	movzbl %cl,%ecx
+  800fa2:	eb d7                	jmp    800f7b <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  800fa4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  800fa9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800faf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fb2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fb5:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fb8:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  800fba:	eb 97                	jmp    800f53 <sys_ipc_send_range+0x3a>
+
+00800fbc <sys_ipc_recv_range>:
+{
+  800fbc:	55                   	push   %ebp
+  800fbd:	89 e5                	mov    %esp,%ebp
+  800fbf:	57                   	push   %edi
+  800fc0:	56                   	push   %esi
+  800fc1:	53                   	push   %ebx
+  800fc2:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800fc5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fcc:	78 37                	js     801005 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  800fce:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fd5:	74 7a                	je     801051 <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  800fd7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fdc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe2:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800fe7:	89 df                	mov    %ebx,%edi
+  800fe9:	89 de                	mov    %ebx,%esi
+  800feb:	55                   	push   %ebp
+  800fec:	68 f5 0f 80 00       	push   $0x800ff5
+  800ff1:	89 e5                	mov    %esp,%ebp
+  800ff3:	0f 34                	sysenter
+  800ff5:	83 c4 04             	add    $0x4,%esp
+  800ff8:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ff9:	85 c0                	test   %eax,%eax
+  800ffb:	7f 6c                	jg     801069 <sys_ipc_recv_range+0xad>
+}
+  800ffd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801000:	5b                   	pop    %ebx
+  801001:	5e                   	pop    %esi
+  801002:	5f                   	pop    %edi
+  801003:	5d                   	pop    %ebp
+  801004:	c3                   	ret
+  801005:	b8 01 00 00 00       	mov    $0x1,%eax
+  80100a:	0f a2                	cpuid
+		return 0;
+  80100c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801011:	f6 c6 08             	test   $0x8,%dh
+  801014:	74 15                	je     80102b <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801016:	89 c2                	mov    %eax,%edx
+  801018:	c1 ea 08             	shr    $0x8,%edx
+  80101b:	83 e2 0f             	and    $0xf,%edx
+  80101e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801023:	83 fa 06             	cmp    $0x6,%edx
+  801026:	74 0e                	je     801036 <sys_ipc_recv_range+0x7a>
+  801028:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80102b:	0f b6 c9             	movzbl %cl,%ecx
+  80102e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801034:	eb 98                	jmp    800fce <sys_ipc_recv_range+0x12>
+  801036:	89 c2                	mov    %eax,%edx
+  801038:	c1 ea 04             	shr    $0x4,%edx
+  80103b:	83 e2 0f             	and    $0xf,%edx
+  80103e:	83 fa 02             	cmp    $0x2,%edx
+  801041:	77 e5                	ja     801028 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801043:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801046:	83 f8 02             	cmp    $0x2,%eax
+  801049:	0f 97 c1             	seta   %cl
+  80104c:	0f b6 c9             	movzbl %cl,%ecx
+  80104f:	eb d7                	jmp    801028 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801051:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801056:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80105b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801061:	89 df                	mov    %ebx,%edi
+  801063:	89 de                	mov    %ebx,%esi
+  801065:	cd 30                	int    $0x30
+  801067:	eb 90                	jmp    800ff9 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801069:	83 ec 0c             	sub    $0xc,%esp
+  80106c:	50                   	push   %eax
+  80106d:	6a 1f                	push   $0x1f
+  80106f:	68 ca 27 80 00       	push   $0x8027ca
+  801074:	6a 4a                	push   $0x4a
+  801076:	68 e7 27 80 00       	push   $0x8027e7
+  80107b:	e8 85 0b 00 00       	call   801c05 <_panic>
+
+00801080 <sys_ipc_call>:
+{
+  801080:	55                   	push   %ebp
+  801081:	89 e5                	mov    %esp,%ebp
+  801083:	57                   	push   %edi
+  801084:	56                   	push   %esi
+  801085:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801086:	8b 55 08             	mov    0x8(%ebp),%edx
+  801089:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80108e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801091:	55                   	push   %ebp
+  801092:	56                   	push   %esi
+  801093:	8b 0e                	mov    (%esi),%ecx
+  801095:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801098:	8b 7e 08             	mov    0x8(%esi),%edi
+  80109b:	8b 6e 10             	mov    0x10(%esi),%ebp
+  80109e:	8b 76 0c             	mov    0xc(%esi),%esi
+  8010a1:	cd 30                	int    $0x30
+  8010a3:	87 34 24             	xchg   %esi,(%esp)
+  8010a6:	89 0e                	mov    %ecx,(%esi)
+  8010a8:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8010ab:	89 7e 08             	mov    %edi,0x8(%esi)
+  8010ae:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8010b1:	8f 46 0c             	pop    0xc(%esi)
+  8010b4:	5d                   	pop    %ebp
+}
+  8010b5:	5b                   	pop    %ebx
+  8010b6:	5e                   	pop    %esi
+  8010b7:	5f                   	pop    %edi
+  8010b8:	5d                   	pop    %ebp
+  8010b9:	c3                   	ret
+
+008010ba <sys_ipc_reply_wait>:
+{
+  8010ba:	55                   	push   %ebp
+  8010bb:	89 e5                	mov    %esp,%ebp
+  8010bd:	57                   	push   %edi
+  8010be:	56                   	push   %esi
+  8010bf:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8010c8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8010cb:	55                   	push   %ebp
+  8010cc:	56                   	push   %esi
+  8010cd:	8b 0e                	mov    (%esi),%ecx
+  8010cf:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8010d2:	8b 7e 08             	mov    0x8(%esi),%edi
+  8010d5:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8010d8:	8b 76 0c             	mov    0xc(%esi),%esi
+  8010db:	cd 30                	int    $0x30
+  8010dd:	87 34 24             	xchg   %esi,(%esp)
+  8010e0:	89 0e                	mov    %ecx,(%esi)
+  8010e2:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8010e5:	89 7e 08             	mov    %edi,0x8(%esi)
+  8010e8:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8010eb:	8f 46 0c             	pop    0xc(%esi)
+  8010ee:	5d                   	pop    %ebp
+}
+  8010ef:	5b                   	pop    %ebx
+  8010f0:	5e                   	pop    %esi
+  8010f1:	5f                   	pop    %edi
+  8010f2:	5d                   	pop    %ebp
+  8010f3:	c3                   	ret
+
+008010f4 <sys_ipc_send_msg>:
+{
+  8010f4:	55                   	push   %ebp
+  8010f5:	89 e5                	mov    %esp,%ebp
+  8010f7:	57                   	push   %edi
+  8010f8:	56                   	push   %esi
+  8010f9:	53                   	push   %ebx
+  8010fa:	83 ec 20             	sub    $0x20,%esp
+  8010fd:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801100:	8b 10                	mov    (%eax),%edx
+  801102:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801105:	8b 50 04             	mov    0x4(%eax),%edx
+  801108:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80110b:	8b 50 08             	mov    0x8(%eax),%edx
+  80110e:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801111:	8b 50 0c             	mov    0xc(%eax),%edx
+  801114:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801117:	8b 40 10             	mov    0x10(%eax),%eax
+  80111a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  80111d:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801120:	8b 55 08             	mov    0x8(%ebp),%edx
+  801123:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801128:	55                   	push   %ebp
+  801129:	56                   	push   %esi
+  80112a:	8b 0e                	mov    (%esi),%ecx
+  80112c:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80112f:	8b 7e 08             	mov    0x8(%esi),%edi
+  801132:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801135:	8b 76 0c             	mov    0xc(%esi),%esi
+  801138:	cd 30                	int    $0x30
+  80113a:	87 34 24             	xchg   %esi,(%esp)
+  80113d:	89 0e                	mov    %ecx,(%esi)
+  80113f:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801142:	89 7e 08             	mov    %edi,0x8(%esi)
+  801145:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801148:	8f 46 0c             	pop    0xc(%esi)
+  80114b:	5d                   	pop    %ebp
+}
+  80114c:	83 c4 20             	add    $0x20,%esp
+  80114f:	5b                   	pop    %ebx
+  801150:	5e                   	pop    %esi
+  801151:	5f                   	pop    %edi
+  801152:	5d                   	pop    %ebp
+  801153:	c3                   	ret
+
+00801154 <sys_fork>:
+{
+  801154:	55                   	push   %ebp
+  801155:	89 e5                	mov    %esp,%ebp
+  801157:	57                   	push   %edi
+  801158:	56                   	push   %esi
+  801159:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80115a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801161:	78 2e                	js     801191 <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801163:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80116a:	74 71                	je     8011dd <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  80116c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801171:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801176:	89 d1                	mov    %edx,%ecx
+  801178:	89 d3                	mov    %edx,%ebx
+  80117a:	89 d7                	mov    %edx,%edi
+  80117c:	89 d6                	mov    %edx,%esi
+  80117e:	55                   	push   %ebp
+  80117f:	68 88 11 80 00       	push   $0x801188
+  801184:	89 e5                	mov    %esp,%ebp
+  801186:	0f 34                	sysenter
+  801188:	83 c4 04             	add    $0x4,%esp
+  80118b:	5d                   	pop    %ebp
+}
+  80118c:	5b                   	pop    %ebx
+  80118d:	5e                   	pop    %esi
+  80118e:	5f                   	pop    %edi
+  80118f:	5d                   	pop    %ebp
+  801190:	c3                   	ret
+  801191:	b8 01 00 00 00       	mov    $0x1,%eax
+  801196:	0f a2                	cpuid
+		return 0;
+  801198:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80119d:	f6 c6 08             	test   $0x8,%dh
+  8011a0:	74 15                	je     8011b7 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011a2:	89 c2                	mov    %eax,%edx
+  8011a4:	c1 ea 08             	shr    $0x8,%edx
+  8011a7:	83 e2 0f             	and    $0xf,%edx
+  8011aa:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011af:	83 fa 06             	cmp    $0x6,%edx
+  8011b2:	74 0e                	je     8011c2 <sys_fork+0x6e>
+  8011b4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8011b7:	0f b6 c9             	movzbl %cl,%ecx
+  8011ba:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8011c0:	eb a1                	jmp    801163 <sys_fork+0xf>
+  8011c2:	89 c2                	mov    %eax,%edx
+  8011c4:	c1 ea 04             	shr    $0x4,%edx
+  8011c7:	83 e2 0f             	and    $0xf,%edx
+  8011ca:	83 fa 02             	cmp    $0x2,%edx
+  8011cd:	77 e5                	ja     8011b4 <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  8011cf:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011d2:	83 f8 02             	cmp    $0x2,%eax
+  8011d5:	0f 97 c1             	seta   %cl
+  8011d8:	0f b6 c9             	movzbl %cl,%ecx
+  8011db:	eb d7                	jmp    8011b4 <sys_fork+0x60>
+		asm volatile("int %1\n"
+  8011dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011e2:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011e7:	89 d1                	mov    %edx,%ecx
+  8011e9:	89 d3                	mov    %edx,%ebx
+  8011eb:	89 d7                	mov    %edx,%edi
+  8011ed:	89 d6                	mov    %edx,%esi
+  8011ef:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  8011f1:	eb 99                	jmp    80118c <sys_fork+0x38>
+
+008011f3 <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  8011f3:	55                   	push   %ebp
+  8011f4:	89 e5                	mov    %esp,%ebp
+  8011f6:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  8011f9:	ff 75 14             	push   0x14(%ebp)
+  8011fc:	ff 75 10             	push   0x10(%ebp)
+  8011ff:	ff 75 0c             	push   0xc(%ebp)
+  801202:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801207:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80120f:	e8 81 ee ff ff       	call   800095 <page_vec_call>
+}
+  801214:	c9                   	leave
+  801215:	c3                   	ret
+
+00801216 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801216:	55                   	push   %ebp
+  801217:	89 e5                	mov    %esp,%ebp
+  801219:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  80121c:	ff 75 18             	push   0x18(%ebp)
+  80121f:	ff 75 14             	push   0x14(%ebp)
+  801222:	ff 75 10             	push   0x10(%ebp)
+  801225:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801228:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122b:	b8 10 00 00 00       	mov    $0x10,%eax
+  801230:	e8 60 ee ff ff       	call   800095 <page_vec_call>
+}
+  801235:	c9                   	leave
+  801236:	c3                   	ret
+
+00801237 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801237:	55                   	push   %ebp
+  801238:	89 e5                	mov    %esp,%ebp
+  80123a:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  80123d:	ff 75 14             	push   0x14(%ebp)
+  801240:	ff 75 10             	push   0x10(%ebp)
+  801243:	ff 75 0c             	push   0xc(%ebp)
+  801246:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80124b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124e:	b8 11 00 00 00       	mov    $0x11,%eax
+  801253:	e8 3d ee ff ff       	call   800095 <page_vec_call>
+}
+  801258:	c9                   	leave
+  801259:	c3                   	ret
+
+0080125a <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  80125a:	55                   	push   %ebp
+  80125b:	89 e5                	mov    %esp,%ebp
+  80125d:	57                   	push   %edi
+  80125e:	56                   	push   %esi
+  80125f:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801260:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801267:	78 32                	js     80129b <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801269:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801270:	74 75                	je     8012e7 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801272:	8b 55 08             	mov    0x8(%ebp),%edx
+  801275:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801278:	b8 12 00 00 00       	mov    $0x12,%eax
+  80127d:	be 00 00 00 00       	mov    $0x0,%esi
+  801282:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801285:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801288:	55                   	push   %ebp
+  801289:	68 92 12 80 00       	push   $0x801292
+  80128e:	89 e5                	mov    %esp,%ebp
+  801290:	0f 34                	sysenter
+  801292:	83 c4 04             	add    $0x4,%esp
+  801295:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801296:	5b                   	pop    %ebx
+  801297:	5e                   	pop    %esi
+  801298:	5f                   	pop    %edi
+  801299:	5d                   	pop    %ebp
+  80129a:	c3                   	ret
+  80129b:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012a0:	0f a2                	cpuid
+		return 0;
+  8012a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8012a7:	f6 c6 08             	test   $0x8,%dh
+  8012aa:	74 15                	je     8012c1 <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012ac:	89 c2                	mov    %eax,%edx
+  8012ae:	c1 ea 08             	shr    $0x8,%edx
+  8012b1:	83 e2 0f             	and    $0xf,%edx
+  8012b4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012b9:	83 fa 06             	cmp    $0x6,%edx
+  8012bc:	74 0e                	je     8012cc <sys_vm_ranges+0x72>
+  8012be:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8012c1:	0f b6 c9             	movzbl %cl,%ecx
+  8012c4:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8012ca:	eb 9d                	jmp    801269 <sys_vm_ranges+0xf>
+  8012cc:	89 c2                	mov    %eax,%edx
+  8012ce:	c1 ea 04             	shr    $0x4,%edx
+  8012d1:	83 e2 0f             	and    $0xf,%edx
+  8012d4:	83 fa 02             	cmp    $0x2,%edx
+  8012d7:	77 e5                	ja     8012be <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  8012d9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012dc:	83 f8 02             	cmp    $0x2,%eax
+  8012df:	0f 97 c1             	seta   %cl
+  8012e2:	0f b6 c9             	movzbl %cl,%ecx
+  8012e5:	eb d7                	jmp    8012be <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  8012e7:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012fa:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012fd:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  8012ff:	eb 95                	jmp    801296 <sys_vm_ranges+0x3c>
+
+00801301 <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801301:	55                   	push   %ebp
+  801302:	89 e5                	mov    %esp,%ebp
+  801304:	57                   	push   %edi
+  801305:	56                   	push   %esi
+  801306:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801307:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80130e:	78 31                	js     801341 <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801310:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801317:	74 74                	je     80138d <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801319:	be 00 00 00 00       	mov    $0x0,%esi
+  80131e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801321:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801324:	b8 14 00 00 00       	mov    $0x14,%eax
+  801329:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80132c:	89 f7                	mov    %esi,%edi
+  80132e:	55                   	push   %ebp
+  80132f:	68 38 13 80 00       	push   $0x801338
+  801334:	89 e5                	mov    %esp,%ebp
+  801336:	0f 34                	sysenter
+  801338:	83 c4 04             	add    $0x4,%esp
+  80133b:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  80133c:	5b                   	pop    %ebx
+  80133d:	5e                   	pop    %esi
+  80133e:	5f                   	pop    %edi
+  80133f:	5d                   	pop    %ebp
+  801340:	c3                   	ret
+  801341:	b8 01 00 00 00       	mov    $0x1,%eax
+  801346:	0f a2                	cpuid
+		return 0;
+  801348:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80134d:	f6 c6 08             	test   $0x8,%dh
+  801350:	74 15                	je     801367 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801352:	89 c2                	mov    %eax,%edx
+  801354:	c1 ea 08             	shr    $0x8,%edx
+  801357:	83 e2 0f             	and    $0xf,%edx
+  80135a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80135f:	83 fa 06             	cmp    $0x6,%edx
+  801362:	74 0e                	je     801372 <sys_spawn+0x71>
+  801364:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801367:	0f b6 c9             	movzbl %cl,%ecx
+  80136a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801370:	eb 9e                	jmp    801310 <sys_spawn+0xf>
+  801372:	89 c2                	mov    %eax,%edx
+  801374:	c1 ea 04             	shr    $0x4,%edx
+  801377:	83 e2 0f             	and    $0xf,%edx
+  80137a:	83 fa 02             	cmp    $0x2,%edx
+  80137d:	77 e5                	ja     801364 <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  80137f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801382:	83 f8 02             	cmp    $0x2,%eax
+  801385:	0f 97 c1             	seta   %cl
+  801388:	0f b6 c9             	movzbl %cl,%ecx
+  80138b:	eb d7                	jmp    801364 <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  80138d:	be 00 00 00 00       	mov    $0x0,%esi
+  801392:	b8 14 00 00 00       	mov    $0x14,%eax
+  801397:	8b 55 08             	mov    0x8(%ebp),%edx
+  80139a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80139d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013a0:	89 f7                	mov    %esi,%edi
+  8013a2:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  8013a4:	eb 96                	jmp    80133c <sys_spawn+0x3b>
+
+008013a6 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  8013a6:	55                   	push   %ebp
+  8013a7:	89 e5                	mov    %esp,%ebp
+  8013a9:	57                   	push   %edi
+  8013aa:	56                   	push   %esi
+  8013ab:	53                   	push   %ebx
+  8013ac:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8013af:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8013b6:	78 37                	js     8013ef <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  8013b8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8013bf:	74 7a                	je     80143b <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  8013c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013cc:	b8 15 00 00 00       	mov    $0x15,%eax
+  8013d1:	89 df                	mov    %ebx,%edi
+  8013d3:	89 de                	mov    %ebx,%esi
+  8013d5:	55                   	push   %ebp
+  8013d6:	68 df 13 80 00       	push   $0x8013df
+  8013db:	89 e5                	mov    %esp,%ebp
+  8013dd:	0f 34                	sysenter
+  8013df:	83 c4 04             	add    $0x4,%esp
+  8013e2:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8013e3:	85 c0                	test   %eax,%eax
+  8013e5:	7f 6c                	jg     801453 <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  8013e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013ea:	5b                   	pop    %ebx
+  8013eb:	5e                   	pop    %esi
+  8013ec:	5f                   	pop    %edi
+  8013ed:	5d                   	pop    %ebp
+  8013ee:	c3                   	ret
+  8013ef:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013f4:	0f a2                	cpuid
+		return 0;
+  8013f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8013fb:	f6 c6 08             	test   $0x8,%dh
+  8013fe:	74 15                	je     801415 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801400:	89 c2                	mov    %eax,%edx
+  801402:	c1 ea 08             	shr    $0x8,%edx
+  801405:	83 e2 0f             	and    $0xf,%edx
+  801408:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80140d:	83 fa 06             	cmp    $0x6,%edx
+  801410:	74 0e                	je     801420 <sys_shm_create+0x7a>
+  801412:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801415:	0f b6 c9             	movzbl %cl,%ecx
+  801418:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80141e:	eb 98                	jmp    8013b8 <sys_shm_create+0x12>
+  801420:	89 c2                	mov    %eax,%edx
+  801422:	c1 ea 04             	shr    $0x4,%edx
+  801425:	83 e2 0f             	and    $0xf,%edx
+  801428:	83 fa 02             	cmp    $0x2,%edx
+  80142b:	77 e5                	ja     801412 <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  80142d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801430:	83 f8 02             	cmp    $0x2,%eax
+  801433:	0f 97 c1             	seta   %cl
+  801436:	0f b6 c9             	movzbl %cl,%ecx
+  801439:	eb d7                	jmp    801412 <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  80143b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801440:	b8 15 00 00 00       	mov    $0x15,%eax
+  801445:	8b 55 08             	mov    0x8(%ebp),%edx
+  801448:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80144b:	89 df                	mov    %ebx,%edi
+  80144d:	89 de                	mov    %ebx,%esi
+  80144f:	cd 30                	int    $0x30
+  801451:	eb 90                	jmp    8013e3 <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801453:	83 ec 0c             	sub    $0xc,%esp
+  801456:	50                   	push   %eax
+  801457:	6a 15                	push   $0x15
+  801459:	68 ca 27 80 00       	push   $0x8027ca
+  80145e:	6a 4a                	push   $0x4a
+  801460:	68 e7 27 80 00       	push   $0x8027e7
+  801465:	e8 9b 07 00 00       	call   801c05 <_panic>
+
+0080146a <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  80146a:	55                   	push   %ebp
+  80146b:	89 e5                	mov    %esp,%ebp
+  80146d:	57                   	push   %edi
+  80146e:	56                   	push   %esi
+  80146f:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801470:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801477:	78 32                	js     8014ab <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  801479:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801480:	74 75                	je     8014f7 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801482:	8b 55 08             	mov    0x8(%ebp),%edx
+  801485:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801488:	b8 16 00 00 00       	mov    $0x16,%eax
+  80148d:	be 00 00 00 00       	mov    $0x0,%esi
+  801492:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801495:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801498:	55                   	push   %ebp
+  801499:	68 a2 14 80 00       	push   $0x8014a2
+  80149e:	89 e5                	mov    %esp,%ebp
+  8014a0:	0f 34                	sysenter
+  8014a2:	83 c4 04             	add    $0x4,%esp
+  8014a5:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  8014a6:	5b                   	pop    %ebx
+  8014a7:	5e                   	pop    %esi
+  8014a8:	5f                   	pop    %edi
+  8014a9:	5d                   	pop    %ebp
+  8014aa:	c3                   	ret
+  8014ab:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014b0:	0f a2                	cpuid
+		return 0;
+  8014b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8014b7:	f6 c6 08             	test   $0x8,%dh
+  8014ba:	74 15                	je     8014d1 <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014bc:	89 c2                	mov    %eax,%edx
+  8014be:	c1 ea 08             	shr    $0x8,%edx
+  8014c1:	83 e2 0f             	and    $0xf,%edx
+  8014c4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8014c9:	83 fa 06             	cmp    $0x6,%edx
+  8014cc:	74 0e                	je     8014dc <sys_shm_attach+0x72>
+  8014ce:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8014d1:	0f b6 c9             	movzbl %cl,%ecx
+  8014d4:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8014da:	eb 9d                	jmp    801479 <sys_shm_attach+0xf>
+  8014dc:	89 c2                	mov    %eax,%edx
+  8014de:	c1 ea 04             	shr    $0x4,%edx
+  8014e1:	83 e2 0f             	and    $0xf,%edx
+  8014e4:	83 fa 02             	cmp    $0x2,%edx
+  8014e7:	77 e5                	ja     8014ce <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  8014e9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014ec:	83 f8 02             	cmp    $0x2,%eax
+  8014ef:	0f 97 c1             	seta   %cl
+  8014f2:	0f b6 c9             	movzbl %cl,%ecx
+  8014f5:	eb d7                	jmp    8014ce <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  8014f7:	b8 16 00 00 00       	mov    $0x16,%eax
+  8014fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801501:	8b 55 08             	mov    0x8(%ebp),%edx
+  801504:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801507:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80150a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80150d:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  80150f:	eb 95                	jmp    8014a6 <sys_shm_attach+0x3c>
+
+00801511 <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  801511:	55                   	push   %ebp
+  801512:	89 e5                	mov    %esp,%ebp
+  801514:	57                   	push   %edi
+  801515:	56                   	push   %esi
+  801516:	53                   	push   %ebx
+  801517:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80151a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801521:	78 38                	js     80155b <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  801523:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80152a:	74 7b                	je     8015a7 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  80152c:	be 00 00 00 00       	mov    $0x0,%esi
+  801531:	8b 55 08             	mov    0x8(%ebp),%edx
+  801534:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801537:	b8 17 00 00 00       	mov    $0x17,%eax
+  80153c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80153f:	89 f7                	mov    %esi,%edi
+  801541:	55                   	push   %ebp
+  801542:	68 4b 15 80 00       	push   $0x80154b
+  801547:	89 e5                	mov    %esp,%ebp
+  801549:	0f 34                	sysenter
+  80154b:	83 c4 04             	add    $0x4,%esp
+  80154e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80154f:	85 c0                	test   %eax,%eax
+  801551:	7f 6d                	jg     8015c0 <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  801553:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801556:	5b                   	pop    %ebx
+  801557:	5e                   	pop    %esi
+  801558:	5f                   	pop    %edi
+  801559:	5d                   	pop    %ebp
+  80155a:	c3                   	ret
+  80155b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801560:	0f a2                	cpuid
+		return 0;
+  801562:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801567:	f6 c6 08             	test   $0x8,%dh
+  80156a:	74 15                	je     801581 <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80156c:	89 c2                	mov    %eax,%edx
+  80156e:	c1 ea 08             	shr    $0x8,%edx
+  801571:	83 e2 0f             	and    $0xf,%edx
+  801574:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801579:	83 fa 06             	cmp    $0x6,%edx
+  80157c:	74 0e                	je     80158c <sys_shm_detach+0x7b>
+  80157e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801581:	0f b6 c9             	movzbl %cl,%ecx
+  801584:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80158a:	eb 97                	jmp    801523 <sys_shm_detach+0x12>
+  80158c:	89 c2                	mov    %eax,%edx
+  80158e:	c1 ea 04             	shr    $0x4,%edx
+  801591:	83 e2 0f             	and    $0xf,%edx
+  801594:	83 fa 02             	cmp    $0x2,%edx
+  801597:	77 e5                	ja     80157e <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  801599:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80159c:	83 f8 02             	cmp    $0x2,%eax
+  80159f:	0f 97 c1             	seta   %cl
+  8015a2:	0f b6 c9             	movzbl %cl,%ecx
+  8015a5:	eb d7                	jmp    80157e <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  8015a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ac:	b8 17 00 00 00       	mov    $0x17,%eax
+  8015b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015ba:	89 f7                	mov    %esi,%edi
+  8015bc:	cd 30                	int    $0x30
+  8015be:	eb 8f                	jmp    80154f <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015c0:	83 ec 0c             	sub    $0xc,%esp
+  8015c3:	50                   	push   %eax
+  8015c4:	6a 17                	push   $0x17
+  8015c6:	68 ca 27 80 00       	push   $0x8027ca
+  8015cb:	6a 4a                	push   $0x4a
+  8015cd:	68 e7 27 80 00       	push   $0x8027e7
+  8015d2:	e8 2e 06 00 00       	call   801c05 <_panic>
+
+008015d7 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  8015d7:	55                   	push   %ebp
+  8015d8:	89 e5                	mov    %esp,%ebp
+  8015da:	57                   	push   %edi
+  8015db:	56                   	push   %esi
+  8015dc:	53                   	push   %ebx
+  8015dd:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8015e0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8015e7:	78 36                	js     80161f <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  8015e9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8015f0:	74 79                	je     80166b <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  8015f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015fa:	b8 18 00 00 00       	mov    $0x18,%eax
+  8015ff:	89 cb                	mov    %ecx,%ebx
+  801601:	89 cf                	mov    %ecx,%edi
+  801603:	89 ce                	mov    %ecx,%esi
+  801605:	55                   	push   %ebp
+  801606:	68 0f 16 80 00       	push   $0x80160f
+  80160b:	89 e5                	mov    %esp,%ebp
+  80160d:	0f 34                	sysenter
+  80160f:	83 c4 04             	add    $0x4,%esp
+  801612:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801613:	85 c0                	test   %eax,%eax
+  801615:	7f 6b                	jg     801682 <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  801617:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80161a:	5b                   	pop    %ebx
+  80161b:	5e                   	pop    %esi
+  80161c:	5f                   	pop    %edi
+  80161d:	5d                   	pop    %ebp
+  80161e:	c3                   	ret
+  80161f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801624:	0f a2                	cpuid
+		return 0;
+  801626:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80162b:	f6 c6 08             	test   $0x8,%dh
+  80162e:	74 15                	je     801645 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801630:	89 c2                	mov    %eax,%edx
+  801632:	c1 ea 08             	shr    $0x8,%edx
+  801635:	83 e2 0f             	and    $0xf,%edx
+  801638:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80163d:	83 fa 06             	cmp    $0x6,%edx
+  801640:	74 0e                	je     801650 <sys_shm_remove+0x79>
+  801642:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801645:	0f b6 c9             	movzbl %cl,%ecx
+  801648:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80164e:	eb 99                	jmp    8015e9 <sys_shm_remove+0x12>
+  801650:	89 c2                	mov    %eax,%edx
+  801652:	c1 ea 04             	shr    $0x4,%edx
+  801655:	83 e2 0f             	and    $0xf,%edx
+  801658:	83 fa 02             	cmp    $0x2,%edx
+  80165b:	77 e5                	ja     801642 <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  80165d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801660:	83 f8 02             	cmp    $0x2,%eax
+  801663:	0f 97 c1             	seta   %cl
+  801666:	0f b6 c9             	movzbl %cl,%ecx
+  801669:	eb d7                	jmp    801642 <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  80166b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801670:	b8 18 00 00 00       	mov    $0x18,%eax
+  801675:	8b 55 08             	mov    0x8(%ebp),%edx
+  801678:	89 cb                	mov    %ecx,%ebx
+  80167a:	89 cf                	mov    %ecx,%edi
+  80167c:	89 ce                	mov    %ecx,%esi
+  80167e:	cd 30                	int    $0x30
+  801680:	eb 91                	jmp    801613 <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801682:	83 ec 0c             	sub    $0xc,%esp
+  801685:	50                   	push   %eax
+  801686:	6a 18                	push   $0x18
+  801688:	68 ca 27 80 00       	push   $0x8027ca
+  80168d:	6a 4a                	push   $0x4a
+  80168f:	68 e7 27 80 00       	push   $0x8027e7
+  801694:	e8 6c 05 00 00       	call   801c05 <_panic>
+
+00801699 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  801699:	55                   	push   %ebp
+  80169a:	89 e5                	mov    %esp,%ebp
+  80169c:	57                   	push   %edi
+  80169d:	56                   	push   %esi
+  80169e:	53                   	push   %ebx
+  80169f:	83 ec 0c             	sub    $0xc,%esp
+  8016a2:	8b 45 10             	mov    0x10(%ebp),%eax
+  8016a5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8016a8:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  8016ab:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8016b2:	78 32                	js     8016e6 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  8016b4:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8016bb:	74 75                	je     801732 <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  8016bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016c3:	b8 20 00 00 00       	mov    $0x20,%eax
+  8016c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8016cd:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8016d0:	55                   	push   %ebp
+  8016d1:	68 da 16 80 00       	push   $0x8016da
+  8016d6:	89 e5                	mov    %esp,%ebp
+  8016d8:	0f 34                	sysenter
+  8016da:	83 c4 04             	add    $0x4,%esp
+  8016dd:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  8016de:	83 c4 0c             	add    $0xc,%esp
+  8016e1:	5b                   	pop    %ebx
+  8016e2:	5e                   	pop    %esi
+  8016e3:	5f                   	pop    %edi
+  8016e4:	5d                   	pop    %ebp
+  8016e5:	c3                   	ret
+  8016e6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016eb:	0f a2                	cpuid
+		return 0;
+  8016ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8016f2:	f6 c6 08             	test   $0x8,%dh
+  8016f5:	74 15                	je     80170c <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016f7:	89 c2                	mov    %eax,%edx
+  8016f9:	c1 ea 08             	shr    $0x8,%edx
+  8016fc:	83 e2 0f             	and    $0xf,%edx
+  8016ff:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801704:	83 fa 06             	cmp    $0x6,%edx
+  801707:	74 0e                	je     801717 <sys_futex_wait+0x7e>
+  801709:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80170c:	0f b6 c9             	movzbl %cl,%ecx
+  80170f:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801715:	eb 9d                	jmp    8016b4 <sys_futex_wait+0x1b>
+  801717:	89 c2                	mov    %eax,%edx
+  801719:	c1 ea 04             	shr    $0x4,%edx
+  80171c:	83 e2 0f             	and    $0xf,%edx
+  80171f:	83 fa 02             	cmp    $0x2,%edx
+  801722:	77 e5                	ja     801709 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  801724:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801727:	83 f8 02             	cmp    $0x2,%eax
+  80172a:	0f 97 c1             	seta   %cl
+  80172d:	0f b6 c9             	movzbl %cl,%ecx
+  801730:	eb d7                	jmp    801709 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  801732:	b8 20 00 00 00       	mov    $0x20,%eax
+  801737:	be 00 00 00 00       	mov    $0x0,%esi
+  80173c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80173f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801742:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  801745:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  801747:	eb 95                	jmp    8016de <sys_futex_wait+0x45>
+
+00801749 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801749:	55                   	push   %ebp
+  80174a:	89 e5                	mov    %esp,%ebp
+  80174c:	57                   	push   %edi
+  80174d:	56                   	push   %esi
+  80174e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80174f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801756:	78 30                	js     801788 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  801758:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80175f:	74 73                	je     8017d4 <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801761:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801766:	8b 55 08             	mov    0x8(%ebp),%edx
+  801769:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80176c:	b8 21 00 00 00       	mov    $0x21,%eax
+  801771:	89 df                	mov    %ebx,%edi
+  801773:	89 de                	mov    %ebx,%esi
+  801775:	55                   	push   %ebp
+  801776:	68 7f 17 80 00       	push   $0x80177f
+  80177b:	89 e5                	mov    %esp,%ebp
+  80177d:	0f 34                	sysenter
+  80177f:	83 c4 04             	add    $0x4,%esp
+  801782:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801783:	5b                   	pop    %ebx
+  801784:	5e                   	pop    %esi
+  801785:	5f                   	pop    %edi
+  801786:	5d                   	pop    %ebp
+  801787:	c3                   	ret
+  801788:	b8 01 00 00 00       	mov    $0x1,%eax
+  80178d:	0f a2                	cpuid
+		return 0;
+  80178f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801794:	f6 c6 08             	test   $0x8,%dh
+  801797:	74 15                	je     8017ae <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801799:	89 c2                	mov    %eax,%edx
+  80179b:	c1 ea 08             	shr    $0x8,%edx
+  80179e:	83 e2 0f             	and    $0xf,%edx
+  8017a1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017a6:	83 fa 06             	cmp    $0x6,%edx
+  8017a9:	74 0e                	je     8017b9 <sys_futex_wake+0x70>
+  8017ab:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8017ae:	0f b6 c9             	movzbl %cl,%ecx
+  8017b1:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8017b7:	eb 9f                	jmp    801758 <sys_futex_wake+0xf>
+  8017b9:	89 c2                	mov    %eax,%edx
+  8017bb:	c1 ea 04             	shr    $0x4,%edx
+  8017be:	83 e2 0f             	and    $0xf,%edx
+  8017c1:	83 fa 02             	cmp    $0x2,%edx
+  8017c4:	77 e5                	ja     8017ab <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  8017c6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017c9:	83 f8 02             	cmp    $0x2,%eax
+  8017cc:	0f 97 c1             	seta   %cl
+  8017cf:	0f b6 c9             	movzbl %cl,%ecx
+  8017d2:	eb d7                	jmp    8017ab <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  8017d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d9:	b8 21 00 00 00       	mov    $0x21,%eax
+  8017de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017e4:	89 df                	mov    %ebx,%edi
+  8017e6:	89 de                	mov    %ebx,%esi
+  8017e8:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  8017ea:	eb 97                	jmp    801783 <sys_futex_wake+0x3a>
+
+008017ec <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  8017ec:	55                   	push   %ebp
+  8017ed:	89 e5                	mov    %esp,%ebp
+  8017ef:	57                   	push   %edi
+  8017f0:	56                   	push   %esi
+  8017f1:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8017f2:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8017f9:	78 2e                	js     801829 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  8017fb:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801802:	74 71                	je     801875 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  801804:	ba 00 00 00 00       	mov    $0x0,%edx
+  801809:	b8 22 00 00 00       	mov    $0x22,%eax
+  80180e:	89 d1                	mov    %edx,%ecx
+  801810:	89 d3                	mov    %edx,%ebx
+  801812:	89 d7                	mov    %edx,%edi
+  801814:	89 d6                	mov    %edx,%esi
+  801816:	55                   	push   %ebp
+  801817:	68 20 18 80 00       	push   $0x801820
+  80181c:	89 e5                	mov    %esp,%ebp
+  80181e:	0f 34                	sysenter
+  801820:	83 c4 04             	add    $0x4,%esp
+  801823:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  801824:	5b                   	pop    %ebx
+  801825:	5e                   	pop    %esi
+  801826:	5f                   	pop    %edi
+  801827:	5d                   	pop    %ebp
+  801828:	c3                   	ret
+  801829:	b8 01 00 00 00       	mov    $0x1,%eax
+  80182e:	0f a2                	cpuid
+		return 0;
+  801830:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801835:	f6 c6 08             	test   $0x8,%dh
+  801838:	74 15                	je     80184f <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80183a:	89 c2                	mov    %eax,%edx
+  80183c:	c1 ea 08             	shr    $0x8,%edx
+  80183f:	83 e2 0f             	and    $0xf,%edx
+  801842:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801847:	83 fa 06             	cmp    $0x6,%edx
+  80184a:	74 0e                	je     80185a <sys_ep_create+0x6e>
+  80184c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80184f:	0f b6 c9             	movzbl %cl,%ecx
+  801852:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801858:	eb a1                	jmp    8017fb <sys_ep_create+0xf>
+  80185a:	89 c2                	mov    %eax,%edx
+  80185c:	c1 ea 04             	shr    $0x4,%edx
+  80185f:	83 e2 0f             	and    $0xf,%edx
+  801862:	83 fa 02             	cmp    $0x2,%edx
+  801865:	77 e5                	ja     80184c <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  801867:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80186a:	83 f8 02             	cmp    $0x2,%eax
+  80186d:	0f 97 c1             	seta   %cl
+  801870:	0f b6 c9             	movzbl %cl,%ecx
+  801873:	eb d7                	jmp    80184c <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  801875:	ba 00 00 00 00       	mov    $0x0,%edx
+  80187a:	b8 22 00 00 00       	mov    $0x22,%eax
+  80187f:	89 d1                	mov    %edx,%ecx
+  801881:	89 d3                	mov    %edx,%ebx
+  801883:	89 d7                	mov    %edx,%edi
+  801885:	89 d6                	mov    %edx,%esi
+  801887:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  801889:	eb 99                	jmp    801824 <sys_ep_create+0x38>
+
+0080188b <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  80188b:	55                   	push   %ebp
+  80188c:	89 e5                	mov    %esp,%ebp
+  80188e:	57                   	push   %edi
+  80188f:	56                   	push   %esi
+  801890:	53                   	push   %ebx
+  801891:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801894:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80189b:	78 36                	js     8018d3 <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  80189d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8018a4:	74 79                	je     80191f <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  8018a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018ae:	b8 23 00 00 00       	mov    $0x23,%eax
+  8018b3:	89 cb                	mov    %ecx,%ebx
+  8018b5:	89 cf                	mov    %ecx,%edi
+  8018b7:	89 ce                	mov    %ecx,%esi
+  8018b9:	55                   	push   %ebp
+  8018ba:	68 c3 18 80 00       	push   $0x8018c3
+  8018bf:	89 e5                	mov    %esp,%ebp
+  8018c1:	0f 34                	sysenter
+  8018c3:	83 c4 04             	add    $0x4,%esp
+  8018c6:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8018c7:	85 c0                	test   %eax,%eax
+  8018c9:	7f 6b                	jg     801936 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  8018cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018ce:	5b                   	pop    %ebx
+  8018cf:	5e                   	pop    %esi
+  8018d0:	5f                   	pop    %edi
+  8018d1:	5d                   	pop    %ebp
+  8018d2:	c3                   	ret
+  8018d3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018d8:	0f a2                	cpuid
+		return 0;
+  8018da:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018df:	f6 c6 08             	test   $0x8,%dh
+  8018e2:	74 15                	je     8018f9 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018e4:	89 c2                	mov    %eax,%edx
+  8018e6:	c1 ea 08             	shr    $0x8,%edx
+  8018e9:	83 e2 0f             	and    $0xf,%edx
+  8018ec:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018f1:	83 fa 06             	cmp    $0x6,%edx
+  8018f4:	74 0e                	je     801904 <sys_ep_destroy+0x79>
+  8018f6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8018f9:	0f b6 c9             	movzbl %cl,%ecx
+  8018fc:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801902:	eb 99                	jmp    80189d <sys_ep_destroy+0x12>
+  801904:	89 c2                	mov    %eax,%edx
+  801906:	c1 ea 04             	shr    $0x4,%edx
+  801909:	83 e2 0f             	and    $0xf,%edx
+  80190c:	83 fa 02             	cmp    $0x2,%edx
+  80190f:	77 e5                	ja     8018f6 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  801911:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801914:	83 f8 02             	cmp    $0x2,%eax
+  801917:	0f 97 c1             	seta   %cl
+  80191a:	0f b6 c9             	movzbl %cl,%ecx
+  80191d:	eb d7                	jmp    8018f6 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  80191f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801924:	b8 23 00 00 00       	mov    $0x23,%eax
+  801929:	8b 55 08             	mov    0x8(%ebp),%edx
+  80192c:	89 cb                	mov    %ecx,%ebx
+  80192e:	89 cf                	mov    %ecx,%edi
+  801930:	89 ce                	mov    %ecx,%esi
+  801932:	cd 30                	int    $0x30
+  801934:	eb 91                	jmp    8018c7 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801936:	83 ec 0c             	sub    $0xc,%esp
+  801939:	50                   	push   %eax
+  80193a:	6a 23                	push   $0x23
+  80193c:	68 ca 27 80 00       	push   $0x8027ca
+  801941:	6a 4a                	push   $0x4a
+  801943:	68 e7 27 80 00       	push   $0x8027e7
+  801948:	e8 b8 02 00 00       	call   801c05 <_panic>
+
+0080194d <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  80194d:	55                   	push   %ebp
+  80194e:	89 e5                	mov    %esp,%ebp
+  801950:	57                   	push   %edi
+  801951:	56                   	push   %esi
+  801952:	53                   	push   %ebx
+  801953:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801956:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80195d:	78 37                	js     801996 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  80195f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801966:	74 7a                	je     8019e2 <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  801968:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80196d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801970:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801973:	b8 24 00 00 00       	mov    $0x24,%eax
+  801978:	89 df                	mov    %ebx,%edi
+  80197a:	89 de                	mov    %ebx,%esi
+  80197c:	55                   	push   %ebp
+  80197d:	68 86 19 80 00       	push   $0x801986
+  801982:	89 e5                	mov    %esp,%ebp
+  801984:	0f 34                	sysenter
+  801986:	83 c4 04             	add    $0x4,%esp
+  801989:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80198a:	85 c0                	test   %eax,%eax
+  80198c:	7f 6c                	jg     8019fa <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  80198e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801991:	5b                   	pop    %ebx
+  801992:	5e                   	pop    %esi
+  801993:	5f                   	pop    %edi
+  801994:	5d                   	pop    %ebp
+  801995:	c3                   	ret
+  801996:	b8 01 00 00 00       	mov    $0x1,%eax
+  80199b:	0f a2                	cpuid
+		return 0;
+  80199d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8019a2:	f6 c6 08             	test   $0x8,%dh
+  8019a5:	74 15                	je     8019bc <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019a7:	89 c2                	mov    %eax,%edx
+  8019a9:	c1 ea 08             	shr    $0x8,%edx
+  8019ac:	83 e2 0f             	and    $0xf,%edx
+  8019af:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019b4:	83 fa 06             	cmp    $0x6,%edx
+  8019b7:	74 0e                	je     8019c7 <sys_ep_grant+0x7a>
+  8019b9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8019bc:	0f b6 c9             	movzbl %cl,%ecx
+  8019bf:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8019c5:	eb 98                	jmp    80195f <sys_ep_grant+0x12>
+  8019c7:	89 c2                	mov    %eax,%edx
+  8019c9:	c1 ea 04             	shr    $0x4,%edx
+  8019cc:	83 e2 0f             	and    $0xf,%edx
+  8019cf:	83 fa 02             	cmp    $0x2,%edx
+  8019d2:	77 e5                	ja     8019b9 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  8019d4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019d7:	83 f8 02             	cmp    $0x2,%eax
+  8019da:	0f 97 c1             	seta   %cl
+  8019dd:	0f b6 c9             	movzbl %cl,%ecx
+  8019e0:	eb d7                	jmp    8019b9 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  8019e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019e7:	b8 24 00 00 00       	mov    $0x24,%eax
+  8019ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019f2:	89 df                	mov    %ebx,%edi
+  8019f4:	89 de                	mov    %ebx,%esi
+  8019f6:	cd 30                	int    $0x30
+  8019f8:	eb 90                	jmp    80198a <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8019fa:	83 ec 0c             	sub    $0xc,%esp
+  8019fd:	50                   	push   %eax
+  8019fe:	6a 24                	push   $0x24
+  801a00:	68 ca 27 80 00       	push   $0x8027ca
+  801a05:	6a 4a                	push   $0x4a
+  801a07:	68 e7 27 80 00       	push   $0x8027e7
+  801a0c:	e8 f4 01 00 00       	call   801c05 <_panic>
+
+00801a11 <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  801a11:	55                   	push   %ebp
+  801a12:	89 e5                	mov    %esp,%ebp
+  801a14:	57                   	push   %edi
+  801a15:	56                   	push   %esi
+  801a16:	53                   	push   %ebx
+  801a17:	83 ec 20             	sub    $0x20,%esp
+  801a1a:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801a1d:	8b 10                	mov    (%eax),%edx
+  801a1f:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801a22:	8b 50 04             	mov    0x4(%eax),%edx
+  801a25:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801a28:	8b 50 08             	mov    0x8(%eax),%edx
+  801a2b:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801a2e:	8b 50 0c             	mov    0xc(%eax),%edx
+  801a31:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801a34:	8b 40 10             	mov    0x10(%eax),%eax
+  801a37:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801a3a:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801a3d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a40:	b8 25 00 00 00       	mov    $0x25,%eax
+  801a45:	55                   	push   %ebp
+  801a46:	56                   	push   %esi
+  801a47:	8b 0e                	mov    (%esi),%ecx
+  801a49:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801a4c:	8b 7e 08             	mov    0x8(%esi),%edi
+  801a4f:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801a52:	8b 76 0c             	mov    0xc(%esi),%esi
+  801a55:	cd 30                	int    $0x30
+  801a57:	87 34 24             	xchg   %esi,(%esp)
+  801a5a:	89 0e                	mov    %ecx,(%esi)
+  801a5c:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801a5f:	89 7e 08             	mov    %edi,0x8(%esi)
+  801a62:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801a65:	8f 46 0c             	pop    0xc(%esi)
+  801a68:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  801a69:	83 c4 20             	add    $0x20,%esp
+  801a6c:	5b                   	pop    %ebx
+  801a6d:	5e                   	pop    %esi
+  801a6e:	5f                   	pop    %edi
+  801a6f:	5d                   	pop    %ebp
+  801a70:	c3                   	ret
+
+00801a71 <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  801a71:	55                   	push   %ebp
+  801a72:	89 e5                	mov    %esp,%ebp
+  801a74:	57                   	push   %edi
+  801a75:	56                   	push   %esi
+  801a76:	53                   	push   %ebx
+  801a77:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  801a7a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a7d:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  801a7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a82:	b8 26 00 00 00       	mov    $0x26,%eax
+  801a87:	55                   	push   %ebp
+  801a88:	56                   	push   %esi
+  801a89:	8b 0e                	mov    (%esi),%ecx
+  801a8b:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801a8e:	8b 7e 08             	mov    0x8(%esi),%edi
+  801a91:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801a94:	8b 76 0c             	mov    0xc(%esi),%esi
+  801a97:	cd 30                	int    $0x30
+  801a99:	87 34 24             	xchg   %esi,(%esp)
+  801a9c:	89 0e                	mov    %ecx,(%esi)
+  801a9e:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801aa1:	89 7e 08             	mov    %edi,0x8(%esi)
+  801aa4:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801aa7:	8f 46 0c             	pop    0xc(%esi)
+  801aaa:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  801aab:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  801aaf:	74 0f                	je     801ac0 <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  801ab1:	85 c0                	test   %eax,%eax
+  801ab3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ab8:	0f 48 d1             	cmovs  %ecx,%edx
+  801abb:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  801abe:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  801ac0:	5b                   	pop    %ebx
+  801ac1:	5e                   	pop    %esi
+  801ac2:	5f                   	pop    %edi
+  801ac3:	5d                   	pop    %ebp
+  801ac4:	c3                   	ret
+
+00801ac5 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  801ac5:	55                   	push   %ebp
+  801ac6:	89 e5                	mov    %esp,%ebp
+  801ac8:	57                   	push   %edi
+  801ac9:	56                   	push   %esi
+  801aca:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801acb:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801ad2:	78 2f                	js     801b03 <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  801ad4:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801adb:	74 72                	je     801b4f <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  801add:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ae0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ae5:	b8 27 00 00 00       	mov    $0x27,%eax
+  801aea:	89 cb                	mov    %ecx,%ebx
+  801aec:	89 cf                	mov    %ecx,%edi
+  801aee:	89 ce                	mov    %ecx,%esi
+  801af0:	55                   	push   %ebp
+  801af1:	68 fa 1a 80 00       	push   $0x801afa
+  801af6:	89 e5                	mov    %esp,%ebp
+  801af8:	0f 34                	sysenter
+  801afa:	83 c4 04             	add    $0x4,%esp
+  801afd:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  801afe:	5b                   	pop    %ebx
+  801aff:	5e                   	pop    %esi
+  801b00:	5f                   	pop    %edi
+  801b01:	5d                   	pop    %ebp
+  801b02:	c3                   	ret
+  801b03:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b08:	0f a2                	cpuid
+		return 0;
+  801b0a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b0f:	f6 c6 08             	test   $0x8,%dh
+  801b12:	74 15                	je     801b29 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b14:	89 c2                	mov    %eax,%edx
+  801b16:	c1 ea 08             	shr    $0x8,%edx
+  801b19:	83 e2 0f             	and    $0xf,%edx
+  801b1c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b21:	83 fa 06             	cmp    $0x6,%edx
+  801b24:	74 0e                	je     801b34 <sys_sysring_setup+0x6f>
+  801b26:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b29:	0f b6 c9             	movzbl %cl,%ecx
+  801b2c:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801b32:	eb a0                	jmp    801ad4 <sys_sysring_setup+0xf>
+  801b34:	89 c2                	mov    %eax,%edx
+  801b36:	c1 ea 04             	shr    $0x4,%edx
+  801b39:	83 e2 0f             	and    $0xf,%edx
+  801b3c:	83 fa 02             	cmp    $0x2,%edx
+  801b3f:	77 e5                	ja     801b26 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  801b41:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b44:	83 f8 02             	cmp    $0x2,%eax
+  801b47:	0f 97 c1             	seta   %cl
+  801b4a:	0f b6 c9             	movzbl %cl,%ecx
+  801b4d:	eb d7                	jmp    801b26 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  801b4f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b54:	b8 27 00 00 00       	mov    $0x27,%eax
+  801b59:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b5c:	89 cb                	mov    %ecx,%ebx
+  801b5e:	89 cf                	mov    %ecx,%edi
+  801b60:	89 ce                	mov    %ecx,%esi
+  801b62:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  801b64:	eb 98                	jmp    801afe <sys_sysring_setup+0x39>
+
+00801b66 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  801b66:	55                   	push   %ebp
+  801b67:	89 e5                	mov    %esp,%ebp
+  801b69:	57                   	push   %edi
+  801b6a:	56                   	push   %esi
+  801b6b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801b6c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b73:	78 2e                	js     801ba3 <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  801b75:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b7c:	74 71                	je     801bef <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  801b7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b83:	b8 28 00 00 00       	mov    $0x28,%eax
+  801b88:	89 d1                	mov    %edx,%ecx
+  801b8a:	89 d3                	mov    %edx,%ebx
+  801b8c:	89 d7                	mov    %edx,%edi
+  801b8e:	89 d6                	mov    %edx,%esi
+  801b90:	55                   	push   %ebp
+  801b91:	68 9a 1b 80 00       	push   $0x801b9a
+  801b96:	89 e5                	mov    %esp,%ebp
+  801b98:	0f 34                	sysenter
+  801b9a:	83 c4 04             	add    $0x4,%esp
+  801b9d:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801b9e:	5b                   	pop    %ebx
+  801b9f:	5e                   	pop    %esi
+  801ba0:	5f                   	pop    %edi
+  801ba1:	5d                   	pop    %ebp
+  801ba2:	c3                   	ret
+  801ba3:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ba8:	0f a2                	cpuid
+		return 0;
+  801baa:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801baf:	f6 c6 08             	test   $0x8,%dh
+  801bb2:	74 15                	je     801bc9 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bb4:	89 c2                	mov    %eax,%edx
+  801bb6:	c1 ea 08             	shr    $0x8,%edx
+  801bb9:	83 e2 0f             	and    $0xf,%edx
+  801bbc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801bc1:	83 fa 06             	cmp    $0x6,%edx
+  801bc4:	74 0e                	je     801bd4 <sys_sysring_enter+0x6e>
+  801bc6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801bc9:	0f b6 c9             	movzbl %cl,%ecx
+  801bcc:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801bd2:	eb a1                	jmp    801b75 <sys_sysring_enter+0xf>
+  801bd4:	89 c2                	mov    %eax,%edx
+  801bd6:	c1 ea 04             	shr    $0x4,%edx
+  801bd9:	83 e2 0f             	and    $0xf,%edx
+  801bdc:	83 fa 02             	cmp    $0x2,%edx
+  801bdf:	77 e5                	ja     801bc6 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  801be1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801be4:	83 f8 02             	cmp    $0x2,%eax
+  801be7:	0f 97 c1             	seta   %cl
+  801bea:	0f b6 c9             	movzbl %cl,%ecx
+  801bed:	eb d7                	jmp    801bc6 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  801bef:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bf4:	b8 28 00 00 00       	mov    $0x28,%eax
+  801bf9:	89 d1                	mov    %edx,%ecx
+  801bfb:	89 d3                	mov    %edx,%ebx
+  801bfd:	89 d7                	mov    %edx,%edi
+  801bff:	89 d6                	mov    %edx,%esi
+  801c01:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  801c03:	eb 99                	jmp    801b9e <sys_sysring_enter+0x38>
+
+00801c05 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801c05:	55                   	push   %ebp
+  801c06:	89 e5                	mov    %esp,%ebp
+  801c08:	57                   	push   %edi
+  801c09:	56                   	push   %esi
+  801c0a:	53                   	push   %ebx
+  801c0b:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  801c11:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  801c14:	8b 1d 00 30 80 00    	mov    0x803000,%ebx
+  801c1a:	e8 c8 e8 ff ff       	call   8004e7 <sys_getenvid>
+  801c1f:	83 ec 04             	sub    $0x4,%esp
+  801c22:	ff 75 0c             	push   0xc(%ebp)
+  801c25:	ff 75 08             	push   0x8(%ebp)
+  801c28:	53                   	push   %ebx
+  801c29:	50                   	push   %eax
+  801c2a:	68 f8 27 80 00       	push   $0x8027f8
+  801c2f:	68 00 01 00 00       	push   $0x100
+  801c34:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  801c3a:	56                   	push   %esi
+  801c3b:	e8 c9 05 00 00       	call   802209 <snprintf>
+  801c40:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  801c42:	83 c4 20             	add    $0x20,%esp
+  801c45:	57                   	push   %edi
+  801c46:	ff 75 10             	push   0x10(%ebp)
+  801c49:	bf 00 01 00 00       	mov    $0x100,%edi
+  801c4e:	89 f8                	mov    %edi,%eax
+  801c50:	29 d8                	sub    %ebx,%eax
+  801c52:	50                   	push   %eax
+  801c53:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801c56:	50                   	push   %eax
+  801c57:	e8 5f 05 00 00       	call   8021bb <vsnprintf>
+  801c5c:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  801c5e:	83 c4 0c             	add    $0xc,%esp
+  801c61:	68 1b 28 80 00       	push   $0x80281b
+  801c66:	29 df                	sub    %ebx,%edi
+  801c68:	57                   	push   %edi
+  801c69:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801c6c:	50                   	push   %eax
+  801c6d:	e8 97 05 00 00       	call   802209 <snprintf>
+	sys_cputs(buf, r);
+  801c72:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  801c75:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  801c77:	53                   	push   %ebx
+  801c78:	56                   	push   %esi
+  801c79:	e8 6b e6 ff ff       	call   8002e9 <sys_cputs>
+  801c7e:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801c81:	cc                   	int3
+	while (1)
+  801c82:	eb fd                	jmp    801c81 <_panic+0x7c>
+
+00801c84 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801c84:	55                   	push   %ebp
+  801c85:	89 e5                	mov    %esp,%ebp
+  801c87:	57                   	push   %edi
+  801c88:	56                   	push   %esi
+  801c89:	53                   	push   %ebx
+  801c8a:	83 ec 1c             	sub    $0x1c,%esp
+  801c8d:	89 c7                	mov    %eax,%edi
+  801c8f:	89 d6                	mov    %edx,%esi
+  801c91:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c94:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c97:	89 d1                	mov    %edx,%ecx
+  801c99:	89 c2                	mov    %eax,%edx
+  801c9b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801c9e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801ca1:	8b 45 10             	mov    0x10(%ebp),%eax
+  801ca4:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  801ca7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801caa:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801cb1:	39 c2                	cmp    %eax,%edx
+  801cb3:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  801cb6:	72 3e                	jb     801cf6 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801cb8:	83 ec 0c             	sub    $0xc,%esp
+  801cbb:	ff 75 18             	push   0x18(%ebp)
+  801cbe:	83 eb 01             	sub    $0x1,%ebx
+  801cc1:	53                   	push   %ebx
+  801cc2:	50                   	push   %eax
+  801cc3:	83 ec 08             	sub    $0x8,%esp
+  801cc6:	ff 75 e4             	push   -0x1c(%ebp)
+  801cc9:	ff 75 e0             	push   -0x20(%ebp)
+  801ccc:	ff 75 dc             	push   -0x24(%ebp)
+  801ccf:	ff 75 d8             	push   -0x28(%ebp)
+  801cd2:	e8 9a 09 00 00       	call   802671 <__udivdi3>
+  801cd7:	83 c4 18             	add    $0x18,%esp
+  801cda:	52                   	push   %edx
+  801cdb:	50                   	push   %eax
+  801cdc:	89 f2                	mov    %esi,%edx
+  801cde:	89 f8                	mov    %edi,%eax
+  801ce0:	e8 9f ff ff ff       	call   801c84 <printnum>
+  801ce5:	83 c4 20             	add    $0x20,%esp
+  801ce8:	eb 13                	jmp    801cfd <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  801cea:	83 ec 08             	sub    $0x8,%esp
+  801ced:	56                   	push   %esi
+  801cee:	ff 75 18             	push   0x18(%ebp)
+  801cf1:	ff d7                	call   *%edi
+  801cf3:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  801cf6:	83 eb 01             	sub    $0x1,%ebx
+  801cf9:	85 db                	test   %ebx,%ebx
+  801cfb:	7f ed                	jg     801cea <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  801cfd:	83 ec 08             	sub    $0x8,%esp
+  801d00:	56                   	push   %esi
+  801d01:	83 ec 04             	sub    $0x4,%esp
+  801d04:	ff 75 e4             	push   -0x1c(%ebp)
+  801d07:	ff 75 e0             	push   -0x20(%ebp)
+  801d0a:	ff 75 dc             	push   -0x24(%ebp)
+  801d0d:	ff 75 d8             	push   -0x28(%ebp)
+  801d10:	e8 7a 09 00 00       	call   80268f <__umoddi3>
+  801d15:	83 c4 14             	add    $0x14,%esp
+  801d18:	0f be 80 1d 28 80 00 	movsbl 0x80281d(%eax),%eax
+  801d1f:	50                   	push   %eax
+  801d20:	ff d7                	call   *%edi
+}
+  801d22:	83 c4 10             	add    $0x10,%esp
+  801d25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d28:	5b                   	pop    %ebx
+  801d29:	5e                   	pop    %esi
+  801d2a:	5f                   	pop    %edi
+  801d2b:	5d                   	pop    %ebp
+  801d2c:	c3                   	ret
+
+00801d2d <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801d2d:	55                   	push   %ebp
+  801d2e:	89 e5                	mov    %esp,%ebp
+  801d30:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  801d33:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  801d37:	8b 10                	mov    (%eax),%edx
+  801d39:	3b 50 04             	cmp    0x4(%eax),%edx
+  801d3c:	73 0a                	jae    801d48 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  801d3e:	8d 4a 01             	lea    0x1(%edx),%ecx
+  801d41:	89 08                	mov    %ecx,(%eax)
+  801d43:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d46:	88 02                	mov    %al,(%edx)
+}
+  801d48:	5d                   	pop    %ebp
+  801d49:	c3                   	ret
+
+00801d4a <printfmt>:
+{
+  801d4a:	55                   	push   %ebp
+  801d4b:	89 e5                	mov    %esp,%ebp
+  801d4d:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  801d50:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  801d53:	50                   	push   %eax
+  801d54:	ff 75 10             	push   0x10(%ebp)
+  801d57:	ff 75 0c             	push   0xc(%ebp)
+  801d5a:	ff 75 08             	push   0x8(%ebp)
+  801d5d:	e8 05 00 00 00       	call   801d67 <vprintfmt>
+}
+  801d62:	83 c4 10             	add    $0x10,%esp
+  801d65:	c9                   	leave
+  801d66:	c3                   	ret
+
+00801d67 <vprintfmt>:
+{
+  801d67:	55                   	push   %ebp
+  801d68:	89 e5                	mov    %esp,%ebp
+  801d6a:	57                   	push   %edi
+  801d6b:	56                   	push   %esi
+  801d6c:	53                   	push   %ebx
+  801d6d:	83 ec 2c             	sub    $0x2c,%esp
+  801d70:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d73:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801d76:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801d79:	eb 0a                	jmp    801d85 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  801d7b:	83 ec 08             	sub    $0x8,%esp
+  801d7e:	53                   	push   %ebx
+  801d7f:	50                   	push   %eax
+  801d80:	ff d6                	call   *%esi
+  801d82:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801d85:	83 c7 01             	add    $0x1,%edi
+  801d88:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801d8c:	83 f8 25             	cmp    $0x25,%eax
+  801d8f:	74 0c                	je     801d9d <vprintfmt+0x36>
+			if (ch == '\0')
+  801d91:	85 c0                	test   %eax,%eax
+  801d93:	75 e6                	jne    801d7b <vprintfmt+0x14>
+}
+  801d95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d98:	5b                   	pop    %ebx
+  801d99:	5e                   	pop    %esi
+  801d9a:	5f                   	pop    %edi
+  801d9b:	5d                   	pop    %ebp
+  801d9c:	c3                   	ret
+		padc = ' ';
+  801d9d:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801da1:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  801da8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801daf:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  801db6:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801dbb:	8d 47 01             	lea    0x1(%edi),%eax
+  801dbe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801dc1:	0f b6 17             	movzbl (%edi),%edx
+  801dc4:	8d 42 dd             	lea    -0x23(%edx),%eax
+  801dc7:	3c 55                	cmp    $0x55,%al
+  801dc9:	0f 87 cf 03 00 00    	ja     80219e <vprintfmt+0x437>
+  801dcf:	0f b6 c0             	movzbl %al,%eax
+  801dd2:	ff 24 85 00 29 80 00 	jmp    *0x802900(,%eax,4)
+  801dd9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801ddc:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801de0:	eb d9                	jmp    801dbb <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801de2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801de5:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  801de9:	eb d0                	jmp    801dbb <vprintfmt+0x54>
+  801deb:	0f b6 d2             	movzbl %dl,%edx
+  801dee:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  801df1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df6:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  801df9:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801dfc:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  801e00:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  801e03:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  801e06:	83 f9 09             	cmp    $0x9,%ecx
+  801e09:	77 55                	ja     801e60 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  801e0b:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  801e0e:	eb e9                	jmp    801df9 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  801e10:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e13:	8b 00                	mov    (%eax),%eax
+  801e15:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801e18:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e1b:	8d 40 04             	lea    0x4(%eax),%eax
+  801e1e:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801e21:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  801e24:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801e28:	79 91                	jns    801dbb <vprintfmt+0x54>
+				width = precision, precision = -1;
+  801e2a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801e2d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801e30:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  801e37:	eb 82                	jmp    801dbb <vprintfmt+0x54>
+			if (width < 0)
+  801e39:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801e3c:	85 d2                	test   %edx,%edx
+  801e3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e43:	0f 49 c2             	cmovns %edx,%eax
+  801e46:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801e49:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801e4c:	e9 6a ff ff ff       	jmp    801dbb <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801e51:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  801e54:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  801e5b:	e9 5b ff ff ff       	jmp    801dbb <vprintfmt+0x54>
+  801e60:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801e63:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801e66:	eb bc                	jmp    801e24 <vprintfmt+0xbd>
+			lflag++;
+  801e68:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801e6b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801e6e:	e9 48 ff ff ff       	jmp    801dbb <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  801e73:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e76:	8d 78 04             	lea    0x4(%eax),%edi
+  801e79:	83 ec 08             	sub    $0x8,%esp
+  801e7c:	53                   	push   %ebx
+  801e7d:	ff 30                	push   (%eax)
+  801e7f:	ff d6                	call   *%esi
+			break;
+  801e81:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801e84:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  801e87:	e9 b1 02 00 00       	jmp    80213d <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  801e8c:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e8f:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801e92:	8b 10                	mov    (%eax),%edx
+  801e94:	89 d0                	mov    %edx,%eax
+  801e96:	f7 d8                	neg    %eax
+  801e98:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801e9b:	83 f8 0d             	cmp    $0xd,%eax
+  801e9e:	7f 23                	jg     801ec3 <vprintfmt+0x15c>
+  801ea0:	8b 14 85 60 2a 80 00 	mov    0x802a60(,%eax,4),%edx
+  801ea7:	85 d2                	test   %edx,%edx
+  801ea9:	74 18                	je     801ec3 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801eab:	52                   	push   %edx
+  801eac:	68 3e 28 80 00       	push   $0x80283e
+  801eb1:	53                   	push   %ebx
+  801eb2:	56                   	push   %esi
+  801eb3:	e8 92 fe ff ff       	call   801d4a <printfmt>
+  801eb8:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801ebb:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801ebe:	e9 7a 02 00 00       	jmp    80213d <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  801ec3:	50                   	push   %eax
+  801ec4:	68 35 28 80 00       	push   $0x802835
+  801ec9:	53                   	push   %ebx
+  801eca:	56                   	push   %esi
+  801ecb:	e8 7a fe ff ff       	call   801d4a <printfmt>
+  801ed0:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801ed3:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801ed6:	e9 62 02 00 00       	jmp    80213d <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801edb:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ede:	83 c0 04             	add    $0x4,%eax
+  801ee1:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801ee4:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ee7:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801ee9:	85 c9                	test   %ecx,%ecx
+  801eeb:	b8 2e 28 80 00       	mov    $0x80282e,%eax
+  801ef0:	0f 45 c1             	cmovne %ecx,%eax
+  801ef3:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801ef6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801efa:	7e 06                	jle    801f02 <vprintfmt+0x19b>
+  801efc:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801f00:	75 0b                	jne    801f0d <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f02:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801f05:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801f08:	89 75 08             	mov    %esi,0x8(%ebp)
+  801f0b:	eb 5c                	jmp    801f69 <vprintfmt+0x202>
+  801f0d:	83 ec 08             	sub    $0x8,%esp
+  801f10:	ff 75 d0             	push   -0x30(%ebp)
+  801f13:	ff 75 cc             	push   -0x34(%ebp)
+  801f16:	e8 20 03 00 00       	call   80223b <strnlen>
+  801f1b:	89 c2                	mov    %eax,%edx
+  801f1d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f20:	29 d0                	sub    %edx,%eax
+  801f22:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801f25:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  801f29:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801f2c:	89 75 08             	mov    %esi,0x8(%ebp)
+  801f2f:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f31:	eb 0e                	jmp    801f41 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801f33:	83 ec 08             	sub    $0x8,%esp
+  801f36:	53                   	push   %ebx
+  801f37:	57                   	push   %edi
+  801f38:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f3b:	83 ee 01             	sub    $0x1,%esi
+  801f3e:	83 c4 10             	add    $0x10,%esp
+  801f41:	85 f6                	test   %esi,%esi
+  801f43:	7f ee                	jg     801f33 <vprintfmt+0x1cc>
+  801f45:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f48:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f4b:	85 c0                	test   %eax,%eax
+  801f4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f52:	0f 49 d0             	cmovns %eax,%edx
+  801f55:	29 d0                	sub    %edx,%eax
+  801f57:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801f5a:	eb a6                	jmp    801f02 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801f5c:	83 ec 08             	sub    $0x8,%esp
+  801f5f:	53                   	push   %ebx
+  801f60:	52                   	push   %edx
+  801f61:	ff 55 08             	call   *0x8(%ebp)
+  801f64:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801f67:	89 f1                	mov    %esi,%ecx
+  801f69:	8d 71 01             	lea    0x1(%ecx),%esi
+  801f6c:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801f70:	0f be d0             	movsbl %al,%edx
+  801f73:	85 d2                	test   %edx,%edx
+  801f75:	74 28                	je     801f9f <vprintfmt+0x238>
+  801f77:	85 ff                	test   %edi,%edi
+  801f79:	78 05                	js     801f80 <vprintfmt+0x219>
+  801f7b:	83 ef 01             	sub    $0x1,%edi
+  801f7e:	78 30                	js     801fb0 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801f80:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801f84:	74 d6                	je     801f5c <vprintfmt+0x1f5>
+  801f86:	0f be c0             	movsbl %al,%eax
+  801f89:	83 e8 20             	sub    $0x20,%eax
+  801f8c:	83 f8 5e             	cmp    $0x5e,%eax
+  801f8f:	76 cb                	jbe    801f5c <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801f91:	83 ec 08             	sub    $0x8,%esp
+  801f94:	53                   	push   %ebx
+  801f95:	6a 3f                	push   $0x3f
+  801f97:	ff 55 08             	call   *0x8(%ebp)
+  801f9a:	83 c4 10             	add    $0x10,%esp
+  801f9d:	eb c8                	jmp    801f67 <vprintfmt+0x200>
+  801f9f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fa2:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801fa5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801fa8:	01 d0                	add    %edx,%eax
+  801faa:	29 c8                	sub    %ecx,%eax
+  801fac:	89 c7                	mov    %eax,%edi
+  801fae:	eb 13                	jmp    801fc3 <vprintfmt+0x25c>
+  801fb0:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fb3:	eb ed                	jmp    801fa2 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801fb5:	83 ec 08             	sub    $0x8,%esp
+  801fb8:	53                   	push   %ebx
+  801fb9:	6a 20                	push   $0x20
+  801fbb:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801fbd:	83 ef 01             	sub    $0x1,%edi
+  801fc0:	83 c4 10             	add    $0x10,%esp
+  801fc3:	85 ff                	test   %edi,%edi
+  801fc5:	7f ee                	jg     801fb5 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801fc7:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801fca:	89 45 14             	mov    %eax,0x14(%ebp)
+  801fcd:	e9 6b 01 00 00       	jmp    80213d <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  801fd2:	83 f9 01             	cmp    $0x1,%ecx
+  801fd5:	7f 1f                	jg     801ff6 <vprintfmt+0x28f>
+	else if (lflag)
+  801fd7:	85 c9                	test   %ecx,%ecx
+  801fd9:	74 67                	je     802042 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  801fdb:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fde:	8b 00                	mov    (%eax),%eax
+  801fe0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801fe3:	89 c1                	mov    %eax,%ecx
+  801fe5:	c1 f9 1f             	sar    $0x1f,%ecx
+  801fe8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801feb:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fee:	8d 40 04             	lea    0x4(%eax),%eax
+  801ff1:	89 45 14             	mov    %eax,0x14(%ebp)
+  801ff4:	eb 17                	jmp    80200d <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  801ff6:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ff9:	8b 50 04             	mov    0x4(%eax),%edx
+  801ffc:	8b 00                	mov    (%eax),%eax
+  801ffe:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802001:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802004:	8b 45 14             	mov    0x14(%ebp),%eax
+  802007:	8d 40 08             	lea    0x8(%eax),%eax
+  80200a:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80200d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802010:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  802013:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  802018:	85 c9                	test   %ecx,%ecx
+  80201a:	0f 89 03 01 00 00    	jns    802123 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  802020:	83 ec 08             	sub    $0x8,%esp
+  802023:	53                   	push   %ebx
+  802024:	6a 2d                	push   $0x2d
+  802026:	ff d6                	call   *%esi
+				num = -(long long) num;
+  802028:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80202b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80202e:	f7 da                	neg    %edx
+  802030:	83 d1 00             	adc    $0x0,%ecx
+  802033:	f7 d9                	neg    %ecx
+  802035:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  802038:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80203d:	e9 e1 00 00 00       	jmp    802123 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  802042:	8b 45 14             	mov    0x14(%ebp),%eax
+  802045:	8b 00                	mov    (%eax),%eax
+  802047:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80204a:	89 c1                	mov    %eax,%ecx
+  80204c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80204f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802052:	8b 45 14             	mov    0x14(%ebp),%eax
+  802055:	8d 40 04             	lea    0x4(%eax),%eax
+  802058:	89 45 14             	mov    %eax,0x14(%ebp)
+  80205b:	eb b0                	jmp    80200d <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80205d:	83 f9 01             	cmp    $0x1,%ecx
+  802060:	7f 1e                	jg     802080 <vprintfmt+0x319>
+	else if (lflag)
+  802062:	85 c9                	test   %ecx,%ecx
+  802064:	74 32                	je     802098 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  802066:	8b 45 14             	mov    0x14(%ebp),%eax
+  802069:	8b 10                	mov    (%eax),%edx
+  80206b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802070:	8d 40 04             	lea    0x4(%eax),%eax
+  802073:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802076:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80207b:	e9 a3 00 00 00       	jmp    802123 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802080:	8b 45 14             	mov    0x14(%ebp),%eax
+  802083:	8b 10                	mov    (%eax),%edx
+  802085:	8b 48 04             	mov    0x4(%eax),%ecx
+  802088:	8d 40 08             	lea    0x8(%eax),%eax
+  80208b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80208e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  802093:	e9 8b 00 00 00       	jmp    802123 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802098:	8b 45 14             	mov    0x14(%ebp),%eax
+  80209b:	8b 10                	mov    (%eax),%edx
+  80209d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020a2:	8d 40 04             	lea    0x4(%eax),%eax
+  8020a5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8020a8:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8020ad:	eb 74                	jmp    802123 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8020af:	83 f9 01             	cmp    $0x1,%ecx
+  8020b2:	7f 1b                	jg     8020cf <vprintfmt+0x368>
+	else if (lflag)
+  8020b4:	85 c9                	test   %ecx,%ecx
+  8020b6:	74 2c                	je     8020e4 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8020b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020bb:	8b 10                	mov    (%eax),%edx
+  8020bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020c2:	8d 40 04             	lea    0x4(%eax),%eax
+  8020c5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8020c8:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8020cd:	eb 54                	jmp    802123 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8020cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020d2:	8b 10                	mov    (%eax),%edx
+  8020d4:	8b 48 04             	mov    0x4(%eax),%ecx
+  8020d7:	8d 40 08             	lea    0x8(%eax),%eax
+  8020da:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8020dd:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8020e2:	eb 3f                	jmp    802123 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8020e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020e7:	8b 10                	mov    (%eax),%edx
+  8020e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020ee:	8d 40 04             	lea    0x4(%eax),%eax
+  8020f1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8020f4:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8020f9:	eb 28                	jmp    802123 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8020fb:	83 ec 08             	sub    $0x8,%esp
+  8020fe:	53                   	push   %ebx
+  8020ff:	6a 30                	push   $0x30
+  802101:	ff d6                	call   *%esi
+			putch('x', putdat);
+  802103:	83 c4 08             	add    $0x8,%esp
+  802106:	53                   	push   %ebx
+  802107:	6a 78                	push   $0x78
+  802109:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80210b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80210e:	8b 10                	mov    (%eax),%edx
+  802110:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  802115:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  802118:	8d 40 04             	lea    0x4(%eax),%eax
+  80211b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80211e:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  802123:	83 ec 0c             	sub    $0xc,%esp
+  802126:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80212a:	50                   	push   %eax
+  80212b:	ff 75 e0             	push   -0x20(%ebp)
+  80212e:	57                   	push   %edi
+  80212f:	51                   	push   %ecx
+  802130:	52                   	push   %edx
+  802131:	89 da                	mov    %ebx,%edx
+  802133:	89 f0                	mov    %esi,%eax
+  802135:	e8 4a fb ff ff       	call   801c84 <printnum>
+			break;
+  80213a:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80213d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802140:	e9 40 fc ff ff       	jmp    801d85 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  802145:	83 f9 01             	cmp    $0x1,%ecx
+  802148:	7f 1b                	jg     802165 <vprintfmt+0x3fe>
+	else if (lflag)
+  80214a:	85 c9                	test   %ecx,%ecx
+  80214c:	74 2c                	je     80217a <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  80214e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802151:	8b 10                	mov    (%eax),%edx
+  802153:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802158:	8d 40 04             	lea    0x4(%eax),%eax
+  80215b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80215e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  802163:	eb be                	jmp    802123 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802165:	8b 45 14             	mov    0x14(%ebp),%eax
+  802168:	8b 10                	mov    (%eax),%edx
+  80216a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80216d:	8d 40 08             	lea    0x8(%eax),%eax
+  802170:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802173:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  802178:	eb a9                	jmp    802123 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80217a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80217d:	8b 10                	mov    (%eax),%edx
+  80217f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802184:	8d 40 04             	lea    0x4(%eax),%eax
+  802187:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80218a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80218f:	eb 92                	jmp    802123 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  802191:	83 ec 08             	sub    $0x8,%esp
+  802194:	53                   	push   %ebx
+  802195:	6a 25                	push   $0x25
+  802197:	ff d6                	call   *%esi
+			break;
+  802199:	83 c4 10             	add    $0x10,%esp
+  80219c:	eb 9f                	jmp    80213d <vprintfmt+0x3d6>
+			putch('%', putdat);
+  80219e:	83 ec 08             	sub    $0x8,%esp
+  8021a1:	53                   	push   %ebx
+  8021a2:	6a 25                	push   $0x25
+  8021a4:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8021a6:	83 c4 10             	add    $0x10,%esp
+  8021a9:	89 f8                	mov    %edi,%eax
+  8021ab:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8021af:	74 05                	je     8021b6 <vprintfmt+0x44f>
+  8021b1:	83 e8 01             	sub    $0x1,%eax
+  8021b4:	eb f5                	jmp    8021ab <vprintfmt+0x444>
+  8021b6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8021b9:	eb 82                	jmp    80213d <vprintfmt+0x3d6>
+
+008021bb <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8021bb:	55                   	push   %ebp
+  8021bc:	89 e5                	mov    %esp,%ebp
+  8021be:	83 ec 18             	sub    $0x18,%esp
+  8021c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021c4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8021c7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8021ca:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8021ce:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8021d1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8021d8:	85 c0                	test   %eax,%eax
+  8021da:	74 26                	je     802202 <vsnprintf+0x47>
+  8021dc:	85 d2                	test   %edx,%edx
+  8021de:	7e 22                	jle    802202 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8021e0:	ff 75 14             	push   0x14(%ebp)
+  8021e3:	ff 75 10             	push   0x10(%ebp)
+  8021e6:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8021e9:	50                   	push   %eax
+  8021ea:	68 2d 1d 80 00       	push   $0x801d2d
+  8021ef:	e8 73 fb ff ff       	call   801d67 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8021f4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8021f7:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8021fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021fd:	83 c4 10             	add    $0x10,%esp
+}
+  802200:	c9                   	leave
+  802201:	c3                   	ret
+		return -E_INVAL;
+  802202:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802207:	eb f7                	jmp    802200 <vsnprintf+0x45>
+
+00802209 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  802209:	55                   	push   %ebp
+  80220a:	89 e5                	mov    %esp,%ebp
+  80220c:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80220f:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  802212:	50                   	push   %eax
+  802213:	ff 75 10             	push   0x10(%ebp)
+  802216:	ff 75 0c             	push   0xc(%ebp)
+  802219:	ff 75 08             	push   0x8(%ebp)
+  80221c:	e8 9a ff ff ff       	call   8021bb <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  802221:	c9                   	leave
+  802222:	c3                   	ret
+
+00802223 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  802223:	55                   	push   %ebp
+  802224:	89 e5                	mov    %esp,%ebp
+  802226:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  802229:	b8 00 00 00 00       	mov    $0x0,%eax
+  80222e:	eb 03                	jmp    802233 <strlen+0x10>
+		n++;
+  802230:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  802233:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802237:	75 f7                	jne    802230 <strlen+0xd>
+	return n;
+}
+  802239:	5d                   	pop    %ebp
+  80223a:	c3                   	ret
+
+0080223b <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80223b:	55                   	push   %ebp
+  80223c:	89 e5                	mov    %esp,%ebp
+  80223e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802241:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802244:	b8 00 00 00 00       	mov    $0x0,%eax
+  802249:	eb 03                	jmp    80224e <strnlen+0x13>
+		n++;
+  80224b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80224e:	39 d0                	cmp    %edx,%eax
+  802250:	74 08                	je     80225a <strnlen+0x1f>
+  802252:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802256:	75 f3                	jne    80224b <strnlen+0x10>
+  802258:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80225a:	89 d0                	mov    %edx,%eax
+  80225c:	5d                   	pop    %ebp
+  80225d:	c3                   	ret
+
+0080225e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80225e:	55                   	push   %ebp
+  80225f:	89 e5                	mov    %esp,%ebp
+  802261:	53                   	push   %ebx
+  802262:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802265:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  802268:	b8 00 00 00 00       	mov    $0x0,%eax
+  80226d:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  802271:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  802274:	83 c0 01             	add    $0x1,%eax
+  802277:	84 d2                	test   %dl,%dl
+  802279:	75 f2                	jne    80226d <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80227b:	89 c8                	mov    %ecx,%eax
+  80227d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802280:	c9                   	leave
+  802281:	c3                   	ret
+
+00802282 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  802282:	55                   	push   %ebp
+  802283:	89 e5                	mov    %esp,%ebp
+  802285:	53                   	push   %ebx
+  802286:	83 ec 10             	sub    $0x10,%esp
+  802289:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80228c:	53                   	push   %ebx
+  80228d:	e8 91 ff ff ff       	call   802223 <strlen>
+  802292:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  802295:	ff 75 0c             	push   0xc(%ebp)
+  802298:	01 d8                	add    %ebx,%eax
+  80229a:	50                   	push   %eax
+  80229b:	e8 be ff ff ff       	call   80225e <strcpy>
+	return dst;
+}
+  8022a0:	89 d8                	mov    %ebx,%eax
+  8022a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022a5:	c9                   	leave
+  8022a6:	c3                   	ret
+
+008022a7 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8022a7:	55                   	push   %ebp
+  8022a8:	89 e5                	mov    %esp,%ebp
+  8022aa:	56                   	push   %esi
+  8022ab:	53                   	push   %ebx
+  8022ac:	8b 75 08             	mov    0x8(%ebp),%esi
+  8022af:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8022b2:	89 f3                	mov    %esi,%ebx
+  8022b4:	03 5d 10             	add    0x10(%ebp),%ebx
+  8022b7:	89 f0                	mov    %esi,%eax
+  8022b9:	eb 0f                	jmp    8022ca <strncpy+0x23>
+		*dst++ = *src;
+  8022bb:	83 c0 01             	add    $0x1,%eax
+  8022be:	0f b6 0a             	movzbl (%edx),%ecx
+  8022c1:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8022c4:	80 f9 01             	cmp    $0x1,%cl
+  8022c7:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8022ca:	39 d8                	cmp    %ebx,%eax
+  8022cc:	75 ed                	jne    8022bb <strncpy+0x14>
+	}
+	return ret;
+}
+  8022ce:	89 f0                	mov    %esi,%eax
+  8022d0:	5b                   	pop    %ebx
+  8022d1:	5e                   	pop    %esi
+  8022d2:	5d                   	pop    %ebp
+  8022d3:	c3                   	ret
+
+008022d4 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8022d4:	55                   	push   %ebp
+  8022d5:	89 e5                	mov    %esp,%ebp
+  8022d7:	56                   	push   %esi
+  8022d8:	53                   	push   %ebx
+  8022d9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8022dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022df:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8022e2:	89 f0                	mov    %esi,%eax
+  8022e4:	85 d2                	test   %edx,%edx
+  8022e6:	74 21                	je     802309 <strlcpy+0x35>
+  8022e8:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8022ec:	89 f2                	mov    %esi,%edx
+  8022ee:	eb 09                	jmp    8022f9 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8022f0:	83 c1 01             	add    $0x1,%ecx
+  8022f3:	83 c2 01             	add    $0x1,%edx
+  8022f6:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8022f9:	39 c2                	cmp    %eax,%edx
+  8022fb:	74 09                	je     802306 <strlcpy+0x32>
+  8022fd:	0f b6 19             	movzbl (%ecx),%ebx
+  802300:	84 db                	test   %bl,%bl
+  802302:	75 ec                	jne    8022f0 <strlcpy+0x1c>
+  802304:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  802306:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  802309:	29 f0                	sub    %esi,%eax
+}
+  80230b:	5b                   	pop    %ebx
+  80230c:	5e                   	pop    %esi
+  80230d:	5d                   	pop    %ebp
+  80230e:	c3                   	ret
+
+0080230f <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80230f:	55                   	push   %ebp
+  802310:	89 e5                	mov    %esp,%ebp
+  802312:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802315:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  802318:	eb 06                	jmp    802320 <strcmp+0x11>
+		p++, q++;
+  80231a:	83 c1 01             	add    $0x1,%ecx
+  80231d:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  802320:	0f b6 01             	movzbl (%ecx),%eax
+  802323:	84 c0                	test   %al,%al
+  802325:	74 04                	je     80232b <strcmp+0x1c>
+  802327:	3a 02                	cmp    (%edx),%al
+  802329:	74 ef                	je     80231a <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80232b:	0f b6 c0             	movzbl %al,%eax
+  80232e:	0f b6 12             	movzbl (%edx),%edx
+  802331:	29 d0                	sub    %edx,%eax
+}
+  802333:	5d                   	pop    %ebp
+  802334:	c3                   	ret
+
+00802335 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  802335:	55                   	push   %ebp
+  802336:	89 e5                	mov    %esp,%ebp
+  802338:	53                   	push   %ebx
+  802339:	8b 45 08             	mov    0x8(%ebp),%eax
+  80233c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80233f:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  802342:	eb 09                	jmp    80234d <strncmp+0x18>
+		n--, p++, q++;
+  802344:	83 ea 01             	sub    $0x1,%edx
+  802347:	83 c0 01             	add    $0x1,%eax
+  80234a:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80234d:	85 d2                	test   %edx,%edx
+  80234f:	74 18                	je     802369 <strncmp+0x34>
+  802351:	0f b6 18             	movzbl (%eax),%ebx
+  802354:	84 db                	test   %bl,%bl
+  802356:	74 04                	je     80235c <strncmp+0x27>
+  802358:	3a 19                	cmp    (%ecx),%bl
+  80235a:	74 e8                	je     802344 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80235c:	0f b6 00             	movzbl (%eax),%eax
+  80235f:	0f b6 11             	movzbl (%ecx),%edx
+  802362:	29 d0                	sub    %edx,%eax
+}
+  802364:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802367:	c9                   	leave
+  802368:	c3                   	ret
+		return 0;
+  802369:	b8 00 00 00 00       	mov    $0x0,%eax
+  80236e:	eb f4                	jmp    802364 <strncmp+0x2f>
+
+00802370 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  802370:	55                   	push   %ebp
+  802371:	89 e5                	mov    %esp,%ebp
+  802373:	8b 45 08             	mov    0x8(%ebp),%eax
+  802376:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80237a:	eb 03                	jmp    80237f <strchr+0xf>
+  80237c:	83 c0 01             	add    $0x1,%eax
+  80237f:	0f b6 10             	movzbl (%eax),%edx
+  802382:	84 d2                	test   %dl,%dl
+  802384:	74 06                	je     80238c <strchr+0x1c>
+		if (*s == c)
+  802386:	38 ca                	cmp    %cl,%dl
+  802388:	75 f2                	jne    80237c <strchr+0xc>
+  80238a:	eb 05                	jmp    802391 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80238c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802391:	5d                   	pop    %ebp
+  802392:	c3                   	ret
+
+00802393 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  802393:	55                   	push   %ebp
+  802394:	89 e5                	mov    %esp,%ebp
+  802396:	8b 45 08             	mov    0x8(%ebp),%eax
+  802399:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80239d:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8023a0:	38 ca                	cmp    %cl,%dl
+  8023a2:	74 09                	je     8023ad <strfind+0x1a>
+  8023a4:	84 d2                	test   %dl,%dl
+  8023a6:	74 05                	je     8023ad <strfind+0x1a>
+	for (; *s; s++)
+  8023a8:	83 c0 01             	add    $0x1,%eax
+  8023ab:	eb f0                	jmp    80239d <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8023ad:	5d                   	pop    %ebp
+  8023ae:	c3                   	ret
+
+008023af <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8023af:	55                   	push   %ebp
+  8023b0:	89 e5                	mov    %esp,%ebp
+  8023b2:	57                   	push   %edi
+  8023b3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8023b6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8023b9:	85 c9                	test   %ecx,%ecx
+  8023bb:	74 20                	je     8023dd <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8023bd:	89 f8                	mov    %edi,%eax
+  8023bf:	09 c8                	or     %ecx,%eax
+  8023c1:	a8 03                	test   $0x3,%al
+  8023c3:	75 12                	jne    8023d7 <memset+0x28>
+		c &= 0xFF;
+  8023c5:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8023c9:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8023cf:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8023d2:	fc                   	cld
+  8023d3:	f3 ab                	rep stos %eax,%es:(%edi)
+  8023d5:	eb 06                	jmp    8023dd <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8023d7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023da:	fc                   	cld
+  8023db:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8023dd:	89 f8                	mov    %edi,%eax
+  8023df:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8023e2:	c9                   	leave
+  8023e3:	c3                   	ret
+
+008023e4 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8023e4:	55                   	push   %ebp
+  8023e5:	89 e5                	mov    %esp,%ebp
+  8023e7:	57                   	push   %edi
+  8023e8:	56                   	push   %esi
+  8023e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023ec:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8023ef:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8023f2:	39 c6                	cmp    %eax,%esi
+  8023f4:	73 32                	jae    802428 <memmove+0x44>
+  8023f6:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8023f9:	39 d0                	cmp    %edx,%eax
+  8023fb:	73 2b                	jae    802428 <memmove+0x44>
+		s += n;
+		d += n;
+  8023fd:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802400:	89 d6                	mov    %edx,%esi
+  802402:	09 fe                	or     %edi,%esi
+  802404:	09 ce                	or     %ecx,%esi
+  802406:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80240c:	75 0e                	jne    80241c <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80240e:	83 ef 04             	sub    $0x4,%edi
+  802411:	8d 72 fc             	lea    -0x4(%edx),%esi
+  802414:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  802417:	fd                   	std
+  802418:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80241a:	eb 09                	jmp    802425 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80241c:	83 ef 01             	sub    $0x1,%edi
+  80241f:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  802422:	fd                   	std
+  802423:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  802425:	fc                   	cld
+  802426:	eb 1a                	jmp    802442 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802428:	89 f2                	mov    %esi,%edx
+  80242a:	09 c2                	or     %eax,%edx
+  80242c:	09 ca                	or     %ecx,%edx
+  80242e:	f6 c2 03             	test   $0x3,%dl
+  802431:	75 0a                	jne    80243d <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  802433:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  802436:	89 c7                	mov    %eax,%edi
+  802438:	fc                   	cld
+  802439:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80243b:	eb 05                	jmp    802442 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80243d:	89 c7                	mov    %eax,%edi
+  80243f:	fc                   	cld
+  802440:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  802442:	5e                   	pop    %esi
+  802443:	5f                   	pop    %edi
+  802444:	5d                   	pop    %ebp
+  802445:	c3                   	ret
+
+00802446 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  802446:	55                   	push   %ebp
+  802447:	89 e5                	mov    %esp,%ebp
+  802449:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80244c:	ff 75 10             	push   0x10(%ebp)
+  80244f:	ff 75 0c             	push   0xc(%ebp)
+  802452:	ff 75 08             	push   0x8(%ebp)
+  802455:	e8 8a ff ff ff       	call   8023e4 <memmove>
+}
+  80245a:	c9                   	leave
+  80245b:	c3                   	ret
+
+0080245c <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80245c:	55                   	push   %ebp
+  80245d:	89 e5                	mov    %esp,%ebp
+  80245f:	56                   	push   %esi
+  802460:	53                   	push   %ebx
+  802461:	8b 45 08             	mov    0x8(%ebp),%eax
+  802464:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  802467:	89 c6                	mov    %eax,%esi
+  802469:	03 75 10             	add    0x10(%ebp),%esi
+  80246c:	eb 06                	jmp    802474 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  80246e:	83 c0 01             	add    $0x1,%eax
+  802471:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  802474:	39 f0                	cmp    %esi,%eax
+  802476:	74 14                	je     80248c <memcmp+0x30>
+		if (*s1 != *s2)
+  802478:	0f b6 08             	movzbl (%eax),%ecx
+  80247b:	0f b6 1a             	movzbl (%edx),%ebx
+  80247e:	38 d9                	cmp    %bl,%cl
+  802480:	74 ec                	je     80246e <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  802482:	0f b6 c1             	movzbl %cl,%eax
+  802485:	0f b6 db             	movzbl %bl,%ebx
+  802488:	29 d8                	sub    %ebx,%eax
+  80248a:	eb 05                	jmp    802491 <memcmp+0x35>
+	}
+
+	return 0;
+  80248c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802491:	5b                   	pop    %ebx
+  802492:	5e                   	pop    %esi
+  802493:	5d                   	pop    %ebp
+  802494:	c3                   	ret
+
+00802495 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802495:	55                   	push   %ebp
+  802496:	89 e5                	mov    %esp,%ebp
+  802498:	8b 45 08             	mov    0x8(%ebp),%eax
+  80249b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80249e:	89 c2                	mov    %eax,%edx
+  8024a0:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8024a3:	eb 03                	jmp    8024a8 <memfind+0x13>
+  8024a5:	83 c0 01             	add    $0x1,%eax
+  8024a8:	39 d0                	cmp    %edx,%eax
+  8024aa:	73 04                	jae    8024b0 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8024ac:	38 08                	cmp    %cl,(%eax)
+  8024ae:	75 f5                	jne    8024a5 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8024b0:	5d                   	pop    %ebp
+  8024b1:	c3                   	ret
+
+008024b2 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8024b2:	55                   	push   %ebp
+  8024b3:	89 e5                	mov    %esp,%ebp
+  8024b5:	57                   	push   %edi
+  8024b6:	56                   	push   %esi
+  8024b7:	53                   	push   %ebx
+  8024b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024bb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8024be:	eb 03                	jmp    8024c3 <strtol+0x11>
+		s++;
+  8024c0:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8024c3:	0f b6 02             	movzbl (%edx),%eax
+  8024c6:	3c 20                	cmp    $0x20,%al
+  8024c8:	74 f6                	je     8024c0 <strtol+0xe>
+  8024ca:	3c 09                	cmp    $0x9,%al
+  8024cc:	74 f2                	je     8024c0 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8024ce:	3c 2b                	cmp    $0x2b,%al
+  8024d0:	74 2a                	je     8024fc <strtol+0x4a>
+	int neg = 0;
+  8024d2:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8024d7:	3c 2d                	cmp    $0x2d,%al
+  8024d9:	74 2b                	je     802506 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8024db:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8024e1:	75 0f                	jne    8024f2 <strtol+0x40>
+  8024e3:	80 3a 30             	cmpb   $0x30,(%edx)
+  8024e6:	74 28                	je     802510 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8024e8:	85 db                	test   %ebx,%ebx
+  8024ea:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8024ef:	0f 44 d8             	cmove  %eax,%ebx
+  8024f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024f7:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8024fa:	eb 46                	jmp    802542 <strtol+0x90>
+		s++;
+  8024fc:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8024ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  802504:	eb d5                	jmp    8024db <strtol+0x29>
+		s++, neg = 1;
+  802506:	83 c2 01             	add    $0x1,%edx
+  802509:	bf 01 00 00 00       	mov    $0x1,%edi
+  80250e:	eb cb                	jmp    8024db <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802510:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802514:	74 0e                	je     802524 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  802516:	85 db                	test   %ebx,%ebx
+  802518:	75 d8                	jne    8024f2 <strtol+0x40>
+		s++, base = 8;
+  80251a:	83 c2 01             	add    $0x1,%edx
+  80251d:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802522:	eb ce                	jmp    8024f2 <strtol+0x40>
+		s += 2, base = 16;
+  802524:	83 c2 02             	add    $0x2,%edx
+  802527:	bb 10 00 00 00       	mov    $0x10,%ebx
+  80252c:	eb c4                	jmp    8024f2 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  80252e:	0f be c0             	movsbl %al,%eax
+  802531:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  802534:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802537:	7d 3a                	jge    802573 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  802539:	83 c2 01             	add    $0x1,%edx
+  80253c:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802540:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  802542:	0f b6 02             	movzbl (%edx),%eax
+  802545:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802548:	89 f3                	mov    %esi,%ebx
+  80254a:	80 fb 09             	cmp    $0x9,%bl
+  80254d:	76 df                	jbe    80252e <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  80254f:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802552:	89 f3                	mov    %esi,%ebx
+  802554:	80 fb 19             	cmp    $0x19,%bl
+  802557:	77 08                	ja     802561 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  802559:	0f be c0             	movsbl %al,%eax
+  80255c:	83 e8 57             	sub    $0x57,%eax
+  80255f:	eb d3                	jmp    802534 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  802561:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802564:	89 f3                	mov    %esi,%ebx
+  802566:	80 fb 19             	cmp    $0x19,%bl
+  802569:	77 08                	ja     802573 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  80256b:	0f be c0             	movsbl %al,%eax
+  80256e:	83 e8 37             	sub    $0x37,%eax
+  802571:	eb c1                	jmp    802534 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  802573:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802577:	74 05                	je     80257e <strtol+0xcc>
+		*endptr = (char *) s;
+  802579:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80257c:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  80257e:	89 c8                	mov    %ecx,%eax
+  802580:	f7 d8                	neg    %eax
+  802582:	85 ff                	test   %edi,%edi
+  802584:	0f 45 c8             	cmovne %eax,%ecx
+}
+  802587:	89 c8                	mov    %ecx,%eax
+  802589:	5b                   	pop    %ebx
+  80258a:	5e                   	pop    %esi
+  80258b:	5f                   	pop    %edi
+  80258c:	5d                   	pop    %ebp
+  80258d:	c3                   	ret
+
+0080258e <atoi>:
+
+int
+atoi(const char *s)
+{
+  80258e:	55                   	push   %ebp
+  80258f:	89 e5                	mov    %esp,%ebp
+  802591:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  802594:	6a 0a                	push   $0xa
+  802596:	6a 00                	push   $0x0
+  802598:	ff 75 08             	push   0x8(%ebp)
+  80259b:	e8 12 ff ff ff       	call   8024b2 <strtol>
+}
+  8025a0:	c9                   	leave
+  8025a1:	c3                   	ret
+
+008025a2 <dm>:
+  8025a2:	55                   	push   %ebp
+  8025a3:	57                   	push   %edi
+  8025a4:	56                   	push   %esi
+  8025a5:	53                   	push   %ebx
+  8025a6:	83 ec 24             	sub    $0x24,%esp
+  8025a9:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8025ad:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8025b1:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8025b5:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8025b9:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8025bd:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8025c1:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8025c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025cf:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025d4:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8025db:	00 
+  8025dc:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8025e3:	00 
+  8025e4:	89 fb                	mov    %edi,%ebx
+  8025e6:	eb 08                	jmp    8025f0 <dm+0x4e>
+  8025e8:	83 e9 01             	sub    $0x1,%ecx
+  8025eb:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8025ee:	74 68                	je     802658 <dm+0xb6>
+  8025f0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8025f4:	01 c0                	add    %eax,%eax
+  8025f6:	89 c6                	mov    %eax,%esi
+  8025f8:	89 d7                	mov    %edx,%edi
+  8025fa:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8025fe:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802602:	0f ad d0             	shrd   %cl,%edx,%eax
+  802605:	d3 ea                	shr    %cl,%edx
+  802607:	f6 c1 20             	test   $0x20,%cl
+  80260a:	74 04                	je     802610 <dm+0x6e>
+  80260c:	89 d0                	mov    %edx,%eax
+  80260e:	31 d2                	xor    %edx,%edx
+  802610:	83 e0 01             	and    $0x1,%eax
+  802613:	89 04 24             	mov    %eax,(%esp)
+  802616:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80261d:	00 
+  80261e:	8b 04 24             	mov    (%esp),%eax
+  802621:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802625:	09 f0                	or     %esi,%eax
+  802627:	09 fa                	or     %edi,%edx
+  802629:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80262d:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802631:	39 f0                	cmp    %esi,%eax
+  802633:	89 d5                	mov    %edx,%ebp
+  802635:	19 fd                	sbb    %edi,%ebp
+  802637:	72 af                	jb     8025e8 <dm+0x46>
+  802639:	29 f0                	sub    %esi,%eax
+  80263b:	19 fa                	sbb    %edi,%edx
+  80263d:	89 cf                	mov    %ecx,%edi
+  80263f:	c1 ef 05             	shr    $0x5,%edi
+  802642:	83 e7 01             	and    $0x1,%edi
+  802645:	89 fe                	mov    %edi,%esi
+  802647:	83 f6 01             	xor    $0x1,%esi
+  80264a:	d3 e6                	shl    %cl,%esi
+  80264c:	d3 e7                	shl    %cl,%edi
+  80264e:	09 74 24 18          	or     %esi,0x18(%esp)
+  802652:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802656:	eb 90                	jmp    8025e8 <dm+0x46>
+  802658:	85 db                	test   %ebx,%ebx
+  80265a:	74 05                	je     802661 <dm+0xbf>
+  80265c:	89 03                	mov    %eax,(%ebx)
+  80265e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802661:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802665:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802669:	83 c4 24             	add    $0x24,%esp
+  80266c:	5b                   	pop    %ebx
+  80266d:	5e                   	pop    %esi
+  80266e:	5f                   	pop    %edi
+  80266f:	5d                   	pop    %ebp
+  802670:	c3                   	ret
+
+00802671 <__udivdi3>:
+  802671:	83 ec 08             	sub    $0x8,%esp
+  802674:	6a 00                	push   $0x0
+  802676:	ff 74 24 1c          	push   0x1c(%esp)
+  80267a:	ff 74 24 1c          	push   0x1c(%esp)
+  80267e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802682:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802686:	e8 17 ff ff ff       	call   8025a2 <dm>
+  80268b:	83 c4 14             	add    $0x14,%esp
+  80268e:	c3                   	ret
+
+0080268f <__umoddi3>:
+  80268f:	83 ec 18             	sub    $0x18,%esp
+  802692:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802696:	50                   	push   %eax
+  802697:	ff 74 24 2c          	push   0x2c(%esp)
+  80269b:	ff 74 24 2c          	push   0x2c(%esp)
+  80269f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8026a3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8026a7:	e8 f6 fe ff ff       	call   8025a2 <dm>
+  8026ac:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8026b0:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8026b4:	83 c4 24             	add    $0x24,%esp
+  8026b7:	c3                   	ret
+
+008026b8 <__divdi3>:
+  8026b8:	53                   	push   %ebx
+  8026b9:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8026bd:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026c1:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8026c5:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8026c9:	85 d2                	test   %edx,%edx
+  8026cb:	78 15                	js     8026e2 <__divdi3+0x2a>
+  8026cd:	85 db                	test   %ebx,%ebx
+  8026cf:	78 34                	js     802705 <__divdi3+0x4d>
+  8026d1:	83 ec 04             	sub    $0x4,%esp
+  8026d4:	6a 00                	push   $0x0
+  8026d6:	53                   	push   %ebx
+  8026d7:	51                   	push   %ecx
+  8026d8:	e8 c5 fe ff ff       	call   8025a2 <dm>
+  8026dd:	83 c4 10             	add    $0x10,%esp
+  8026e0:	eb 21                	jmp    802703 <__divdi3+0x4b>
+  8026e2:	f7 d8                	neg    %eax
+  8026e4:	83 d2 00             	adc    $0x0,%edx
+  8026e7:	f7 da                	neg    %edx
+  8026e9:	85 db                	test   %ebx,%ebx
+  8026eb:	78 30                	js     80271d <__divdi3+0x65>
+  8026ed:	83 ec 04             	sub    $0x4,%esp
+  8026f0:	6a 00                	push   $0x0
+  8026f2:	53                   	push   %ebx
+  8026f3:	51                   	push   %ecx
+  8026f4:	e8 a9 fe ff ff       	call   8025a2 <dm>
+  8026f9:	83 c4 10             	add    $0x10,%esp
+  8026fc:	f7 d8                	neg    %eax
+  8026fe:	83 d2 00             	adc    $0x0,%edx
+  802701:	f7 da                	neg    %edx
+  802703:	5b                   	pop    %ebx
+  802704:	c3                   	ret
+  802705:	83 ec 04             	sub    $0x4,%esp
+  802708:	6a 00                	push   $0x0
+  80270a:	f7 d9                	neg    %ecx
+  80270c:	83 d3 00             	adc    $0x0,%ebx
+  80270f:	f7 db                	neg    %ebx
+  802711:	53                   	push   %ebx
+  802712:	51                   	push   %ecx
+  802713:	e8 8a fe ff ff       	call   8025a2 <dm>
+  802718:	83 c4 10             	add    $0x10,%esp
+  80271b:	eb df                	jmp    8026fc <__divdi3+0x44>
+  80271d:	83 ec 04             	sub    $0x4,%esp
+  802720:	6a 00                	push   $0x0
+  802722:	f7 d9                	neg    %ecx
+  802724:	83 d3 00             	adc    $0x0,%ebx
+  802727:	f7 db                	neg    %ebx
+  802729:	53                   	push   %ebx
+  80272a:	51                   	push   %ecx
+  80272b:	e8 72 fe ff ff       	call   8025a2 <dm>
+  802730:	83 c4 10             	add    $0x10,%esp
+  802733:	eb ce                	jmp    802703 <__divdi3+0x4b>
+
+00802735 <__moddi3>:
+  802735:	55                   	push   %ebp
+  802736:	57                   	push   %edi
+  802737:	56                   	push   %esi
+  802738:	53                   	push   %ebx
+  802739:	83 ec 18             	sub    $0x18,%esp
+  80273c:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802740:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802744:	89 f1                	mov    %esi,%ecx
+  802746:	f7 d9                	neg    %ecx
+  802748:	89 da                	mov    %ebx,%edx
+  80274a:	83 d2 00             	adc    $0x0,%edx
+  80274d:	f7 da                	neg    %edx
+  80274f:	0f 48 ce             	cmovs  %esi,%ecx
+  802752:	0f 48 d3             	cmovs  %ebx,%edx
+  802755:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802759:	50                   	push   %eax
+  80275a:	8b 74 24 38          	mov    0x38(%esp),%esi
+  80275e:	f7 de                	neg    %esi
+  802760:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802764:	83 d0 00             	adc    $0x0,%eax
+  802767:	f7 d8                	neg    %eax
+  802769:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  80276e:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802773:	50                   	push   %eax
+  802774:	56                   	push   %esi
+  802775:	89 c8                	mov    %ecx,%eax
+  802777:	e8 26 fe ff ff       	call   8025a2 <dm>
+  80277c:	83 c4 10             	add    $0x10,%esp
+  80277f:	85 db                	test   %ebx,%ebx
+  802781:	78 10                	js     802793 <__moddi3+0x5e>
+  802783:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802787:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80278b:	83 c4 14             	add    $0x14,%esp
+  80278e:	5b                   	pop    %ebx
+  80278f:	5e                   	pop    %esi
+  802790:	5f                   	pop    %edi
+  802791:	5d                   	pop    %ebp
+  802792:	c3                   	ret
+  802793:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802797:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80279b:	f7 d8                	neg    %eax
+  80279d:	83 d2 00             	adc    $0x0,%edx
+  8027a0:	f7 da                	neg    %edx
+  8027a2:	eb e7                	jmp    80278b <__moddi3+0x56>
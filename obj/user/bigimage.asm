@@ -0,0 +1,5270 @@
+
+obj/user/bigimage:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 34 01 00 00       	call   800165 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <resident>:
+extern char etext[], end[];
+
+// Count the pages mapped in [UTEXT, end).
+static size_t
+resident(void)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	81 ec 1c 02 00 00    	sub    $0x21c,%esp
+	struct page_range ranges[PAGE_VEC_MAX];
+	uintptr_t va = UTEXT, lo, hi;
+	size_t n = 0;
+  80003f:	c7 85 e0 fd ff ff 00 	movl   $0x0,-0x220(%ebp)
+  800046:	00 00 00 
+	uintptr_t va = UTEXT, lo, hi;
+  800049:	b8 00 00 80 00       	mov    $0x800000,%eax
+		for (i = 0; i < r; i++) {
+			lo = (uintptr_t) ranges[i].pr_va;
+			hi = lo + ranges[i].pr_npages * PGSIZE;
+			if (lo >= (uintptr_t) end)
+				return n;
+			n += (MIN(hi, ROUNDUP((uintptr_t) end, PGSIZE)) - lo) / PGSIZE;
+  80004e:	bb 0b 40 a0 00       	mov    $0xa0400b,%ebx
+  800053:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while ((r = sys_vm_ranges(0, (void *) va, ranges, PAGE_VEC_MAX)) > 0) {
+  800059:	6a 20                	push   $0x20
+  80005b:	8d 95 e8 fd ff ff    	lea    -0x218(%ebp),%edx
+  800061:	52                   	push   %edx
+  800062:	50                   	push   %eax
+  800063:	6a 00                	push   $0x0
+  800065:	e8 61 1d 00 00       	call   801dcb <sys_vm_ranges>
+  80006a:	89 85 e4 fd ff ff    	mov    %eax,-0x21c(%ebp)
+  800070:	83 c4 10             	add    $0x10,%esp
+  800073:	85 c0                	test   %eax,%eax
+  800075:	7e 3f                	jle    8000b6 <resident+0x83>
+  800077:	8d 8d e8 fd ff ff    	lea    -0x218(%ebp),%ecx
+		for (i = 0; i < r; i++) {
+  80007d:	bf 00 00 00 00       	mov    $0x0,%edi
+			lo = (uintptr_t) ranges[i].pr_va;
+  800082:	8b 31                	mov    (%ecx),%esi
+			hi = lo + ranges[i].pr_npages * PGSIZE;
+  800084:	8b 41 04             	mov    0x4(%ecx),%eax
+  800087:	c1 e0 0c             	shl    $0xc,%eax
+  80008a:	01 f0                	add    %esi,%eax
+			if (lo >= (uintptr_t) end)
+  80008c:	83 c1 10             	add    $0x10,%ecx
+  80008f:	81 fe 0c 30 a0 00    	cmp    $0xa0300c,%esi
+  800095:	73 28                	jae    8000bf <resident+0x8c>
+			n += (MIN(hi, ROUNDUP((uintptr_t) end, PGSIZE)) - lo) / PGSIZE;
+  800097:	39 c3                	cmp    %eax,%ebx
+  800099:	89 c2                	mov    %eax,%edx
+  80009b:	0f 46 d3             	cmovbe %ebx,%edx
+  80009e:	29 f2                	sub    %esi,%edx
+  8000a0:	c1 ea 0c             	shr    $0xc,%edx
+  8000a3:	01 95 e0 fd ff ff    	add    %edx,-0x220(%ebp)
+		for (i = 0; i < r; i++) {
+  8000a9:	83 c7 01             	add    $0x1,%edi
+  8000ac:	39 bd e4 fd ff ff    	cmp    %edi,-0x21c(%ebp)
+  8000b2:	75 ce                	jne    800082 <resident+0x4f>
+  8000b4:	eb a3                	jmp    800059 <resident+0x26>
+			va = hi;
+		}
+	}
+	if (r < 0)
+  8000b6:	83 bd e4 fd ff ff 00 	cmpl   $0x0,-0x21c(%ebp)
+  8000bd:	78 0e                	js     8000cd <resident+0x9a>
+		panic("sys_vm_ranges: %e", r);
+	return n;
+}
+  8000bf:	8b 85 e0 fd ff ff    	mov    -0x220(%ebp),%eax
+  8000c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000c8:	5b                   	pop    %ebx
+  8000c9:	5e                   	pop    %esi
+  8000ca:	5f                   	pop    %edi
+  8000cb:	5d                   	pop    %ebp
+  8000cc:	c3                   	ret
+		panic("sys_vm_ranges: %e", r);
+  8000cd:	ff b5 e4 fd ff ff    	push   -0x21c(%ebp)
+  8000d3:	68 80 29 80 00       	push   $0x802980
+  8000d8:	6a 27                	push   $0x27
+  8000da:	68 92 29 80 00       	push   $0x802992
+  8000df:	e8 dc 00 00 00       	call   8001c0 <_panic>
+
+008000e4 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000e4:	55                   	push   %ebp
+  8000e5:	89 e5                	mov    %esp,%ebp
+  8000e7:	53                   	push   %ebx
+  8000e8:	83 ec 04             	sub    $0x4,%esp
+	size_t image = (ROUNDUP((uintptr_t) end, PGSIZE) - UTEXT) / PGSIZE;
+	uint32_t sum = 0;
+	int i;
+
+	cprintf("image: %d pages, load_icode: %llu cycles\n",
+		image, thisenv->env_load_cycles);
+  8000eb:	a1 08 30 a0 00       	mov    0xa03008,%eax
+  8000f0:	8b 50 6c             	mov    0x6c(%eax),%edx
+  8000f3:	8b 40 68             	mov    0x68(%eax),%eax
+	cprintf("image: %d pages, load_icode: %llu cycles\n",
+  8000f6:	52                   	push   %edx
+  8000f7:	50                   	push   %eax
+	size_t image = (ROUNDUP((uintptr_t) end, PGSIZE) - UTEXT) / PGSIZE;
+  8000f8:	b8 0b 40 a0 00       	mov    $0xa0400b,%eax
+  8000fd:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800102:	2d 00 00 80 00       	sub    $0x800000,%eax
+  800107:	c1 e8 0c             	shr    $0xc,%eax
+	cprintf("image: %d pages, load_icode: %llu cycles\n",
+  80010a:	50                   	push   %eax
+  80010b:	68 c0 29 80 00       	push   $0x8029c0
+  800110:	e8 bf 01 00 00       	call   8002d4 <cprintf>
+	cprintf("resident at start: %d pages\n", resident());
+  800115:	e8 19 ff ff ff       	call   800033 <resident>
+  80011a:	83 c4 08             	add    $0x8,%esp
+  80011d:	50                   	push   %eax
+  80011e:	68 a2 29 80 00       	push   $0x8029a2
+  800123:	e8 ac 01 00 00       	call   8002d4 <cprintf>
+  800128:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < TABLE_SIZE; i += STRIDE)
+  80012b:	b8 00 00 00 00       	mov    $0x0,%eax
+	uint32_t sum = 0;
+  800130:	bb 00 00 00 00       	mov    $0x0,%ebx
+		sum += table[i];
+  800135:	0f be 90 40 2a 80 00 	movsbl 0x802a40(%eax),%edx
+  80013c:	01 d3                	add    %edx,%ebx
+	for (i = 0; i < TABLE_SIZE; i += STRIDE)
+  80013e:	05 00 00 01 00       	add    $0x10000,%eax
+  800143:	3d 00 00 20 00       	cmp    $0x200000,%eax
+  800148:	75 eb                	jne    800135 <umain+0x51>
+	cprintf("resident after reading %d table pages: %d pages (sum %d)\n",
+  80014a:	e8 e4 fe ff ff       	call   800033 <resident>
+  80014f:	53                   	push   %ebx
+  800150:	50                   	push   %eax
+  800151:	6a 20                	push   $0x20
+  800153:	68 ec 29 80 00       	push   $0x8029ec
+  800158:	e8 77 01 00 00       	call   8002d4 <cprintf>
+		TABLE_SIZE / STRIDE, resident(), sum);
+}
+  80015d:	83 c4 10             	add    $0x10,%esp
+  800160:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800163:	c9                   	leave
+  800164:	c3                   	ret
+
+00800165 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800165:	55                   	push   %ebp
+  800166:	89 e5                	mov    %esp,%ebp
+  800168:	56                   	push   %esi
+  800169:	53                   	push   %ebx
+  80016a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80016d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  800170:	e8 e3 0e 00 00       	call   801058 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  800175:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80017a:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  800180:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800185:	a3 08 30 a0 00       	mov    %eax,0xa03008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80018a:	85 db                	test   %ebx,%ebx
+  80018c:	7e 07                	jle    800195 <libmain+0x30>
+		binaryname = argv[0];
+  80018e:	8b 06                	mov    (%esi),%eax
+  800190:	a3 00 30 a0 00       	mov    %eax,0xa03000
+
+	// call user main routine
+	umain(argc, argv);
+  800195:	83 ec 08             	sub    $0x8,%esp
+  800198:	56                   	push   %esi
+  800199:	53                   	push   %ebx
+  80019a:	e8 45 ff ff ff       	call   8000e4 <umain>
+
+	// exit gracefully
+	exit();
+  80019f:	e8 0a 00 00 00       	call   8001ae <exit>
+}
+  8001a4:	83 c4 10             	add    $0x10,%esp
+  8001a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001aa:	5b                   	pop    %ebx
+  8001ab:	5e                   	pop    %esi
+  8001ac:	5d                   	pop    %ebp
+  8001ad:	c3                   	ret
+
+008001ae <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001ae:	55                   	push   %ebp
+  8001af:	89 e5                	mov    %esp,%ebp
+  8001b1:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  8001b4:	6a 00                	push   $0x0
+  8001b6:	e8 db 0d 00 00       	call   800f96 <sys_env_destroy>
+}
+  8001bb:	83 c4 10             	add    $0x10,%esp
+  8001be:	c9                   	leave
+  8001bf:	c3                   	ret
+
+008001c0 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001c0:	55                   	push   %ebp
+  8001c1:	89 e5                	mov    %esp,%ebp
+  8001c3:	57                   	push   %edi
+  8001c4:	56                   	push   %esi
+  8001c5:	53                   	push   %ebx
+  8001c6:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  8001cc:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  8001cf:	8b 1d 00 30 a0 00    	mov    0xa03000,%ebx
+  8001d5:	e8 7e 0e 00 00       	call   801058 <sys_getenvid>
+  8001da:	83 ec 04             	sub    $0x4,%esp
+  8001dd:	ff 75 0c             	push   0xc(%ebp)
+  8001e0:	ff 75 08             	push   0x8(%ebp)
+  8001e3:	53                   	push   %ebx
+  8001e4:	50                   	push   %eax
+  8001e5:	68 4c 2a a0 00       	push   $0xa02a4c
+  8001ea:	68 00 01 00 00       	push   $0x100
+  8001ef:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  8001f5:	56                   	push   %esi
+  8001f6:	e8 72 06 00 00       	call   80086d <snprintf>
+  8001fb:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  8001fd:	83 c4 20             	add    $0x20,%esp
+  800200:	57                   	push   %edi
+  800201:	ff 75 10             	push   0x10(%ebp)
+  800204:	bf 00 01 00 00       	mov    $0x100,%edi
+  800209:	89 f8                	mov    %edi,%eax
+  80020b:	29 d8                	sub    %ebx,%eax
+  80020d:	50                   	push   %eax
+  80020e:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  800211:	50                   	push   %eax
+  800212:	e8 08 06 00 00       	call   80081f <vsnprintf>
+  800217:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  800219:	83 c4 0c             	add    $0xc,%esp
+  80021c:	68 bd 29 80 00       	push   $0x8029bd
+  800221:	29 df                	sub    %ebx,%edi
+  800223:	57                   	push   %edi
+  800224:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  800227:	50                   	push   %eax
+  800228:	e8 40 06 00 00       	call   80086d <snprintf>
+	sys_cputs(buf, r);
+  80022d:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  800230:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  800232:	53                   	push   %ebx
+  800233:	56                   	push   %esi
+  800234:	e8 21 0c 00 00       	call   800e5a <sys_cputs>
+  800239:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80023c:	cc                   	int3
+	while (1)
+  80023d:	eb fd                	jmp    80023c <_panic+0x7c>
+
+0080023f <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80023f:	55                   	push   %ebp
+  800240:	89 e5                	mov    %esp,%ebp
+  800242:	53                   	push   %ebx
+  800243:	83 ec 04             	sub    $0x4,%esp
+  800246:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800249:	8b 13                	mov    (%ebx),%edx
+  80024b:	8d 42 01             	lea    0x1(%edx),%eax
+  80024e:	89 03                	mov    %eax,(%ebx)
+  800250:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800253:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800257:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80025c:	74 09                	je     800267 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80025e:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800262:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800265:	c9                   	leave
+  800266:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800267:	83 ec 08             	sub    $0x8,%esp
+  80026a:	68 ff 00 00 00       	push   $0xff
+  80026f:	8d 43 08             	lea    0x8(%ebx),%eax
+  800272:	50                   	push   %eax
+  800273:	e8 e2 0b 00 00       	call   800e5a <sys_cputs>
+		b->idx = 0;
+  800278:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80027e:	83 c4 10             	add    $0x10,%esp
+  800281:	eb db                	jmp    80025e <putch+0x1f>
+
+00800283 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800283:	55                   	push   %ebp
+  800284:	89 e5                	mov    %esp,%ebp
+  800286:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80028c:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800293:	00 00 00 
+	b.cnt = 0;
+  800296:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80029d:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002a0:	ff 75 0c             	push   0xc(%ebp)
+  8002a3:	ff 75 08             	push   0x8(%ebp)
+  8002a6:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002ac:	50                   	push   %eax
+  8002ad:	68 3f 02 80 00       	push   $0x80023f
+  8002b2:	e8 14 01 00 00       	call   8003cb <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002b7:	83 c4 08             	add    $0x8,%esp
+  8002ba:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002c0:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002c6:	50                   	push   %eax
+  8002c7:	e8 8e 0b 00 00       	call   800e5a <sys_cputs>
+
+	return b.cnt;
+}
+  8002cc:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002d2:	c9                   	leave
+  8002d3:	c3                   	ret
+
+008002d4 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002d4:	55                   	push   %ebp
+  8002d5:	89 e5                	mov    %esp,%ebp
+  8002d7:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002da:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002dd:	50                   	push   %eax
+  8002de:	ff 75 08             	push   0x8(%ebp)
+  8002e1:	e8 9d ff ff ff       	call   800283 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002e6:	c9                   	leave
+  8002e7:	c3                   	ret
+
+008002e8 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8002e8:	55                   	push   %ebp
+  8002e9:	89 e5                	mov    %esp,%ebp
+  8002eb:	57                   	push   %edi
+  8002ec:	56                   	push   %esi
+  8002ed:	53                   	push   %ebx
+  8002ee:	83 ec 1c             	sub    $0x1c,%esp
+  8002f1:	89 c7                	mov    %eax,%edi
+  8002f3:	89 d6                	mov    %edx,%esi
+  8002f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002fb:	89 d1                	mov    %edx,%ecx
+  8002fd:	89 c2                	mov    %eax,%edx
+  8002ff:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800302:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800305:	8b 45 10             	mov    0x10(%ebp),%eax
+  800308:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80030b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80030e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800315:	39 c2                	cmp    %eax,%edx
+  800317:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80031a:	72 3e                	jb     80035a <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80031c:	83 ec 0c             	sub    $0xc,%esp
+  80031f:	ff 75 18             	push   0x18(%ebp)
+  800322:	83 eb 01             	sub    $0x1,%ebx
+  800325:	53                   	push   %ebx
+  800326:	50                   	push   %eax
+  800327:	83 ec 08             	sub    $0x8,%esp
+  80032a:	ff 75 e4             	push   -0x1c(%ebp)
+  80032d:	ff 75 e0             	push   -0x20(%ebp)
+  800330:	ff 75 dc             	push   -0x24(%ebp)
+  800333:	ff 75 d8             	push   -0x28(%ebp)
+  800336:	e8 0a 25 00 00       	call   802845 <__udivdi3>
+  80033b:	83 c4 18             	add    $0x18,%esp
+  80033e:	52                   	push   %edx
+  80033f:	50                   	push   %eax
+  800340:	89 f2                	mov    %esi,%edx
+  800342:	89 f8                	mov    %edi,%eax
+  800344:	e8 9f ff ff ff       	call   8002e8 <printnum>
+  800349:	83 c4 20             	add    $0x20,%esp
+  80034c:	eb 13                	jmp    800361 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80034e:	83 ec 08             	sub    $0x8,%esp
+  800351:	56                   	push   %esi
+  800352:	ff 75 18             	push   0x18(%ebp)
+  800355:	ff d7                	call   *%edi
+  800357:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80035a:	83 eb 01             	sub    $0x1,%ebx
+  80035d:	85 db                	test   %ebx,%ebx
+  80035f:	7f ed                	jg     80034e <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800361:	83 ec 08             	sub    $0x8,%esp
+  800364:	56                   	push   %esi
+  800365:	83 ec 04             	sub    $0x4,%esp
+  800368:	ff 75 e4             	push   -0x1c(%ebp)
+  80036b:	ff 75 e0             	push   -0x20(%ebp)
+  80036e:	ff 75 dc             	push   -0x24(%ebp)
+  800371:	ff 75 d8             	push   -0x28(%ebp)
+  800374:	e8 ea 24 00 00       	call   802863 <__umoddi3>
+  800379:	83 c4 14             	add    $0x14,%esp
+  80037c:	0f be 80 6f 2a a0 00 	movsbl 0xa02a6f(%eax),%eax
+  800383:	50                   	push   %eax
+  800384:	ff d7                	call   *%edi
+}
+  800386:	83 c4 10             	add    $0x10,%esp
+  800389:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80038c:	5b                   	pop    %ebx
+  80038d:	5e                   	pop    %esi
+  80038e:	5f                   	pop    %edi
+  80038f:	5d                   	pop    %ebp
+  800390:	c3                   	ret
+
+00800391 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800391:	55                   	push   %ebp
+  800392:	89 e5                	mov    %esp,%ebp
+  800394:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800397:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80039b:	8b 10                	mov    (%eax),%edx
+  80039d:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003a0:	73 0a                	jae    8003ac <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003a2:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003a5:	89 08                	mov    %ecx,(%eax)
+  8003a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003aa:	88 02                	mov    %al,(%edx)
+}
+  8003ac:	5d                   	pop    %ebp
+  8003ad:	c3                   	ret
+
+008003ae <printfmt>:
+{
+  8003ae:	55                   	push   %ebp
+  8003af:	89 e5                	mov    %esp,%ebp
+  8003b1:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003b4:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003b7:	50                   	push   %eax
+  8003b8:	ff 75 10             	push   0x10(%ebp)
+  8003bb:	ff 75 0c             	push   0xc(%ebp)
+  8003be:	ff 75 08             	push   0x8(%ebp)
+  8003c1:	e8 05 00 00 00       	call   8003cb <vprintfmt>
+}
+  8003c6:	83 c4 10             	add    $0x10,%esp
+  8003c9:	c9                   	leave
+  8003ca:	c3                   	ret
+
+008003cb <vprintfmt>:
+{
+  8003cb:	55                   	push   %ebp
+  8003cc:	89 e5                	mov    %esp,%ebp
+  8003ce:	57                   	push   %edi
+  8003cf:	56                   	push   %esi
+  8003d0:	53                   	push   %ebx
+  8003d1:	83 ec 2c             	sub    $0x2c,%esp
+  8003d4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8003d7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8003da:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003dd:	eb 0a                	jmp    8003e9 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8003df:	83 ec 08             	sub    $0x8,%esp
+  8003e2:	53                   	push   %ebx
+  8003e3:	50                   	push   %eax
+  8003e4:	ff d6                	call   *%esi
+  8003e6:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003e9:	83 c7 01             	add    $0x1,%edi
+  8003ec:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8003f0:	83 f8 25             	cmp    $0x25,%eax
+  8003f3:	74 0c                	je     800401 <vprintfmt+0x36>
+			if (ch == '\0')
+  8003f5:	85 c0                	test   %eax,%eax
+  8003f7:	75 e6                	jne    8003df <vprintfmt+0x14>
+}
+  8003f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003fc:	5b                   	pop    %ebx
+  8003fd:	5e                   	pop    %esi
+  8003fe:	5f                   	pop    %edi
+  8003ff:	5d                   	pop    %ebp
+  800400:	c3                   	ret
+		padc = ' ';
+  800401:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800405:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80040c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800413:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80041a:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80041f:	8d 47 01             	lea    0x1(%edi),%eax
+  800422:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800425:	0f b6 17             	movzbl (%edi),%edx
+  800428:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80042b:	3c 55                	cmp    $0x55,%al
+  80042d:	0f 87 cf 03 00 00    	ja     800802 <vprintfmt+0x437>
+  800433:	0f b6 c0             	movzbl %al,%eax
+  800436:	ff 24 85 60 2b a0 00 	jmp    *0xa02b60(,%eax,4)
+  80043d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800440:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800444:	eb d9                	jmp    80041f <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800446:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800449:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80044d:	eb d0                	jmp    80041f <vprintfmt+0x54>
+  80044f:	0f b6 d2             	movzbl %dl,%edx
+  800452:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800455:	b8 00 00 00 00       	mov    $0x0,%eax
+  80045a:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80045d:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800460:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800464:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800467:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80046a:	83 f9 09             	cmp    $0x9,%ecx
+  80046d:	77 55                	ja     8004c4 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80046f:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800472:	eb e9                	jmp    80045d <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800474:	8b 45 14             	mov    0x14(%ebp),%eax
+  800477:	8b 00                	mov    (%eax),%eax
+  800479:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80047c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80047f:	8d 40 04             	lea    0x4(%eax),%eax
+  800482:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800485:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800488:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80048c:	79 91                	jns    80041f <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80048e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800491:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800494:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80049b:	eb 82                	jmp    80041f <vprintfmt+0x54>
+			if (width < 0)
+  80049d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004a0:	85 d2                	test   %edx,%edx
+  8004a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004a7:	0f 49 c2             	cmovns %edx,%eax
+  8004aa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ad:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004b0:	e9 6a ff ff ff       	jmp    80041f <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004b5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8004b8:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004bf:	e9 5b ff ff ff       	jmp    80041f <vprintfmt+0x54>
+  8004c4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004c7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004ca:	eb bc                	jmp    800488 <vprintfmt+0xbd>
+			lflag++;
+  8004cc:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004cf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004d2:	e9 48 ff ff ff       	jmp    80041f <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8004d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004da:	8d 78 04             	lea    0x4(%eax),%edi
+  8004dd:	83 ec 08             	sub    $0x8,%esp
+  8004e0:	53                   	push   %ebx
+  8004e1:	ff 30                	push   (%eax)
+  8004e3:	ff d6                	call   *%esi
+			break;
+  8004e5:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8004e8:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8004eb:	e9 b1 02 00 00       	jmp    8007a1 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8004f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f3:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8004f6:	8b 10                	mov    (%eax),%edx
+  8004f8:	89 d0                	mov    %edx,%eax
+  8004fa:	f7 d8                	neg    %eax
+  8004fc:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004ff:	83 f8 0d             	cmp    $0xd,%eax
+  800502:	7f 23                	jg     800527 <vprintfmt+0x15c>
+  800504:	8b 14 85 c0 2c a0 00 	mov    0xa02cc0(,%eax,4),%edx
+  80050b:	85 d2                	test   %edx,%edx
+  80050d:	74 18                	je     800527 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80050f:	52                   	push   %edx
+  800510:	68 90 2a a0 00       	push   $0xa02a90
+  800515:	53                   	push   %ebx
+  800516:	56                   	push   %esi
+  800517:	e8 92 fe ff ff       	call   8003ae <printfmt>
+  80051c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80051f:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800522:	e9 7a 02 00 00       	jmp    8007a1 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800527:	50                   	push   %eax
+  800528:	68 87 2a a0 00       	push   $0xa02a87
+  80052d:	53                   	push   %ebx
+  80052e:	56                   	push   %esi
+  80052f:	e8 7a fe ff ff       	call   8003ae <printfmt>
+  800534:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800537:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80053a:	e9 62 02 00 00       	jmp    8007a1 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80053f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800542:	83 c0 04             	add    $0x4,%eax
+  800545:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800548:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054b:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80054d:	85 c9                	test   %ecx,%ecx
+  80054f:	b8 80 2a a0 00       	mov    $0xa02a80,%eax
+  800554:	0f 45 c1             	cmovne %ecx,%eax
+  800557:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80055a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80055e:	7e 06                	jle    800566 <vprintfmt+0x19b>
+  800560:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800564:	75 0b                	jne    800571 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800566:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800569:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80056c:	89 75 08             	mov    %esi,0x8(%ebp)
+  80056f:	eb 5c                	jmp    8005cd <vprintfmt+0x202>
+  800571:	83 ec 08             	sub    $0x8,%esp
+  800574:	ff 75 d0             	push   -0x30(%ebp)
+  800577:	ff 75 cc             	push   -0x34(%ebp)
+  80057a:	e8 20 03 00 00       	call   80089f <strnlen>
+  80057f:	89 c2                	mov    %eax,%edx
+  800581:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800584:	29 d0                	sub    %edx,%eax
+  800586:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800589:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80058d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800590:	89 75 08             	mov    %esi,0x8(%ebp)
+  800593:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800595:	eb 0e                	jmp    8005a5 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800597:	83 ec 08             	sub    $0x8,%esp
+  80059a:	53                   	push   %ebx
+  80059b:	57                   	push   %edi
+  80059c:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80059f:	83 ee 01             	sub    $0x1,%esi
+  8005a2:	83 c4 10             	add    $0x10,%esp
+  8005a5:	85 f6                	test   %esi,%esi
+  8005a7:	7f ee                	jg     800597 <vprintfmt+0x1cc>
+  8005a9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005ac:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005af:	85 c0                	test   %eax,%eax
+  8005b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b6:	0f 49 d0             	cmovns %eax,%edx
+  8005b9:	29 d0                	sub    %edx,%eax
+  8005bb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005be:	eb a6                	jmp    800566 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8005c0:	83 ec 08             	sub    $0x8,%esp
+  8005c3:	53                   	push   %ebx
+  8005c4:	52                   	push   %edx
+  8005c5:	ff 55 08             	call   *0x8(%ebp)
+  8005c8:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005cb:	89 f1                	mov    %esi,%ecx
+  8005cd:	8d 71 01             	lea    0x1(%ecx),%esi
+  8005d0:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005d4:	0f be d0             	movsbl %al,%edx
+  8005d7:	85 d2                	test   %edx,%edx
+  8005d9:	74 28                	je     800603 <vprintfmt+0x238>
+  8005db:	85 ff                	test   %edi,%edi
+  8005dd:	78 05                	js     8005e4 <vprintfmt+0x219>
+  8005df:	83 ef 01             	sub    $0x1,%edi
+  8005e2:	78 30                	js     800614 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005e4:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005e8:	74 d6                	je     8005c0 <vprintfmt+0x1f5>
+  8005ea:	0f be c0             	movsbl %al,%eax
+  8005ed:	83 e8 20             	sub    $0x20,%eax
+  8005f0:	83 f8 5e             	cmp    $0x5e,%eax
+  8005f3:	76 cb                	jbe    8005c0 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8005f5:	83 ec 08             	sub    $0x8,%esp
+  8005f8:	53                   	push   %ebx
+  8005f9:	6a 3f                	push   $0x3f
+  8005fb:	ff 55 08             	call   *0x8(%ebp)
+  8005fe:	83 c4 10             	add    $0x10,%esp
+  800601:	eb c8                	jmp    8005cb <vprintfmt+0x200>
+  800603:	8b 75 08             	mov    0x8(%ebp),%esi
+  800606:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800609:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80060c:	01 d0                	add    %edx,%eax
+  80060e:	29 c8                	sub    %ecx,%eax
+  800610:	89 c7                	mov    %eax,%edi
+  800612:	eb 13                	jmp    800627 <vprintfmt+0x25c>
+  800614:	8b 75 08             	mov    0x8(%ebp),%esi
+  800617:	eb ed                	jmp    800606 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800619:	83 ec 08             	sub    $0x8,%esp
+  80061c:	53                   	push   %ebx
+  80061d:	6a 20                	push   $0x20
+  80061f:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800621:	83 ef 01             	sub    $0x1,%edi
+  800624:	83 c4 10             	add    $0x10,%esp
+  800627:	85 ff                	test   %edi,%edi
+  800629:	7f ee                	jg     800619 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80062b:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80062e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800631:	e9 6b 01 00 00       	jmp    8007a1 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800636:	83 f9 01             	cmp    $0x1,%ecx
+  800639:	7f 1f                	jg     80065a <vprintfmt+0x28f>
+	else if (lflag)
+  80063b:	85 c9                	test   %ecx,%ecx
+  80063d:	74 67                	je     8006a6 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80063f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800642:	8b 00                	mov    (%eax),%eax
+  800644:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800647:	89 c1                	mov    %eax,%ecx
+  800649:	c1 f9 1f             	sar    $0x1f,%ecx
+  80064c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80064f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800652:	8d 40 04             	lea    0x4(%eax),%eax
+  800655:	89 45 14             	mov    %eax,0x14(%ebp)
+  800658:	eb 17                	jmp    800671 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80065a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065d:	8b 50 04             	mov    0x4(%eax),%edx
+  800660:	8b 00                	mov    (%eax),%eax
+  800662:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800665:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800668:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066b:	8d 40 08             	lea    0x8(%eax),%eax
+  80066e:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800671:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800674:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800677:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80067c:	85 c9                	test   %ecx,%ecx
+  80067e:	0f 89 03 01 00 00    	jns    800787 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800684:	83 ec 08             	sub    $0x8,%esp
+  800687:	53                   	push   %ebx
+  800688:	6a 2d                	push   $0x2d
+  80068a:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80068c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80068f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800692:	f7 da                	neg    %edx
+  800694:	83 d1 00             	adc    $0x0,%ecx
+  800697:	f7 d9                	neg    %ecx
+  800699:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80069c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006a1:	e9 e1 00 00 00       	jmp    800787 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8006a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a9:	8b 00                	mov    (%eax),%eax
+  8006ab:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006ae:	89 c1                	mov    %eax,%ecx
+  8006b0:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006b3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006bc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006bf:	eb b0                	jmp    800671 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8006c1:	83 f9 01             	cmp    $0x1,%ecx
+  8006c4:	7f 1e                	jg     8006e4 <vprintfmt+0x319>
+	else if (lflag)
+  8006c6:	85 c9                	test   %ecx,%ecx
+  8006c8:	74 32                	je     8006fc <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8006ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cd:	8b 10                	mov    (%eax),%edx
+  8006cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006d4:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006da:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8006df:	e9 a3 00 00 00       	jmp    800787 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e7:	8b 10                	mov    (%eax),%edx
+  8006e9:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006ec:	8d 40 08             	lea    0x8(%eax),%eax
+  8006ef:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006f2:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8006f7:	e9 8b 00 00 00       	jmp    800787 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ff:	8b 10                	mov    (%eax),%edx
+  800701:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800706:	8d 40 04             	lea    0x4(%eax),%eax
+  800709:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80070c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800711:	eb 74                	jmp    800787 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800713:	83 f9 01             	cmp    $0x1,%ecx
+  800716:	7f 1b                	jg     800733 <vprintfmt+0x368>
+	else if (lflag)
+  800718:	85 c9                	test   %ecx,%ecx
+  80071a:	74 2c                	je     800748 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  80071c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071f:	8b 10                	mov    (%eax),%edx
+  800721:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800726:	8d 40 04             	lea    0x4(%eax),%eax
+  800729:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80072c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800731:	eb 54                	jmp    800787 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800733:	8b 45 14             	mov    0x14(%ebp),%eax
+  800736:	8b 10                	mov    (%eax),%edx
+  800738:	8b 48 04             	mov    0x4(%eax),%ecx
+  80073b:	8d 40 08             	lea    0x8(%eax),%eax
+  80073e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800741:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800746:	eb 3f                	jmp    800787 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800748:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074b:	8b 10                	mov    (%eax),%edx
+  80074d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800752:	8d 40 04             	lea    0x4(%eax),%eax
+  800755:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800758:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80075d:	eb 28                	jmp    800787 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  80075f:	83 ec 08             	sub    $0x8,%esp
+  800762:	53                   	push   %ebx
+  800763:	6a 30                	push   $0x30
+  800765:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800767:	83 c4 08             	add    $0x8,%esp
+  80076a:	53                   	push   %ebx
+  80076b:	6a 78                	push   $0x78
+  80076d:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80076f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800772:	8b 10                	mov    (%eax),%edx
+  800774:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800779:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80077c:	8d 40 04             	lea    0x4(%eax),%eax
+  80077f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800782:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800787:	83 ec 0c             	sub    $0xc,%esp
+  80078a:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80078e:	50                   	push   %eax
+  80078f:	ff 75 e0             	push   -0x20(%ebp)
+  800792:	57                   	push   %edi
+  800793:	51                   	push   %ecx
+  800794:	52                   	push   %edx
+  800795:	89 da                	mov    %ebx,%edx
+  800797:	89 f0                	mov    %esi,%eax
+  800799:	e8 4a fb ff ff       	call   8002e8 <printnum>
+			break;
+  80079e:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8007a1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8007a4:	e9 40 fc ff ff       	jmp    8003e9 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8007a9:	83 f9 01             	cmp    $0x1,%ecx
+  8007ac:	7f 1b                	jg     8007c9 <vprintfmt+0x3fe>
+	else if (lflag)
+  8007ae:	85 c9                	test   %ecx,%ecx
+  8007b0:	74 2c                	je     8007de <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8007b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b5:	8b 10                	mov    (%eax),%edx
+  8007b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007bc:	8d 40 04             	lea    0x4(%eax),%eax
+  8007bf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007c2:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8007c7:	eb be                	jmp    800787 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8007c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007cc:	8b 10                	mov    (%eax),%edx
+  8007ce:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007d1:	8d 40 08             	lea    0x8(%eax),%eax
+  8007d4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007d7:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8007dc:	eb a9                	jmp    800787 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8007de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e1:	8b 10                	mov    (%eax),%edx
+  8007e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007e8:	8d 40 04             	lea    0x4(%eax),%eax
+  8007eb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007ee:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8007f3:	eb 92                	jmp    800787 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8007f5:	83 ec 08             	sub    $0x8,%esp
+  8007f8:	53                   	push   %ebx
+  8007f9:	6a 25                	push   $0x25
+  8007fb:	ff d6                	call   *%esi
+			break;
+  8007fd:	83 c4 10             	add    $0x10,%esp
+  800800:	eb 9f                	jmp    8007a1 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800802:	83 ec 08             	sub    $0x8,%esp
+  800805:	53                   	push   %ebx
+  800806:	6a 25                	push   $0x25
+  800808:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80080a:	83 c4 10             	add    $0x10,%esp
+  80080d:	89 f8                	mov    %edi,%eax
+  80080f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800813:	74 05                	je     80081a <vprintfmt+0x44f>
+  800815:	83 e8 01             	sub    $0x1,%eax
+  800818:	eb f5                	jmp    80080f <vprintfmt+0x444>
+  80081a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80081d:	eb 82                	jmp    8007a1 <vprintfmt+0x3d6>
+
+0080081f <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80081f:	55                   	push   %ebp
+  800820:	89 e5                	mov    %esp,%ebp
+  800822:	83 ec 18             	sub    $0x18,%esp
+  800825:	8b 45 08             	mov    0x8(%ebp),%eax
+  800828:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80082b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80082e:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800832:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800835:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80083c:	85 c0                	test   %eax,%eax
+  80083e:	74 26                	je     800866 <vsnprintf+0x47>
+  800840:	85 d2                	test   %edx,%edx
+  800842:	7e 22                	jle    800866 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800844:	ff 75 14             	push   0x14(%ebp)
+  800847:	ff 75 10             	push   0x10(%ebp)
+  80084a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80084d:	50                   	push   %eax
+  80084e:	68 91 03 80 00       	push   $0x800391
+  800853:	e8 73 fb ff ff       	call   8003cb <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800858:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80085b:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80085e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800861:	83 c4 10             	add    $0x10,%esp
+}
+  800864:	c9                   	leave
+  800865:	c3                   	ret
+		return -E_INVAL;
+  800866:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80086b:	eb f7                	jmp    800864 <vsnprintf+0x45>
+
+0080086d <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80086d:	55                   	push   %ebp
+  80086e:	89 e5                	mov    %esp,%ebp
+  800870:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800873:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800876:	50                   	push   %eax
+  800877:	ff 75 10             	push   0x10(%ebp)
+  80087a:	ff 75 0c             	push   0xc(%ebp)
+  80087d:	ff 75 08             	push   0x8(%ebp)
+  800880:	e8 9a ff ff ff       	call   80081f <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800885:	c9                   	leave
+  800886:	c3                   	ret
+
+00800887 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800887:	55                   	push   %ebp
+  800888:	89 e5                	mov    %esp,%ebp
+  80088a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80088d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800892:	eb 03                	jmp    800897 <strlen+0x10>
+		n++;
+  800894:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800897:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80089b:	75 f7                	jne    800894 <strlen+0xd>
+	return n;
+}
+  80089d:	5d                   	pop    %ebp
+  80089e:	c3                   	ret
+
+0080089f <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80089f:	55                   	push   %ebp
+  8008a0:	89 e5                	mov    %esp,%ebp
+  8008a2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ad:	eb 03                	jmp    8008b2 <strnlen+0x13>
+		n++;
+  8008af:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008b2:	39 d0                	cmp    %edx,%eax
+  8008b4:	74 08                	je     8008be <strnlen+0x1f>
+  8008b6:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008ba:	75 f3                	jne    8008af <strnlen+0x10>
+  8008bc:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008be:	89 d0                	mov    %edx,%eax
+  8008c0:	5d                   	pop    %ebp
+  8008c1:	c3                   	ret
+
+008008c2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008c2:	55                   	push   %ebp
+  8008c3:	89 e5                	mov    %esp,%ebp
+  8008c5:	53                   	push   %ebx
+  8008c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d1:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008d5:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008d8:	83 c0 01             	add    $0x1,%eax
+  8008db:	84 d2                	test   %dl,%dl
+  8008dd:	75 f2                	jne    8008d1 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008df:	89 c8                	mov    %ecx,%eax
+  8008e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008e4:	c9                   	leave
+  8008e5:	c3                   	ret
+
+008008e6 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008e6:	55                   	push   %ebp
+  8008e7:	89 e5                	mov    %esp,%ebp
+  8008e9:	53                   	push   %ebx
+  8008ea:	83 ec 10             	sub    $0x10,%esp
+  8008ed:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008f0:	53                   	push   %ebx
+  8008f1:	e8 91 ff ff ff       	call   800887 <strlen>
+  8008f6:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008f9:	ff 75 0c             	push   0xc(%ebp)
+  8008fc:	01 d8                	add    %ebx,%eax
+  8008fe:	50                   	push   %eax
+  8008ff:	e8 be ff ff ff       	call   8008c2 <strcpy>
+	return dst;
+}
+  800904:	89 d8                	mov    %ebx,%eax
+  800906:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800909:	c9                   	leave
+  80090a:	c3                   	ret
+
+0080090b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80090b:	55                   	push   %ebp
+  80090c:	89 e5                	mov    %esp,%ebp
+  80090e:	56                   	push   %esi
+  80090f:	53                   	push   %ebx
+  800910:	8b 75 08             	mov    0x8(%ebp),%esi
+  800913:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800916:	89 f3                	mov    %esi,%ebx
+  800918:	03 5d 10             	add    0x10(%ebp),%ebx
+  80091b:	89 f0                	mov    %esi,%eax
+  80091d:	eb 0f                	jmp    80092e <strncpy+0x23>
+		*dst++ = *src;
+  80091f:	83 c0 01             	add    $0x1,%eax
+  800922:	0f b6 0a             	movzbl (%edx),%ecx
+  800925:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800928:	80 f9 01             	cmp    $0x1,%cl
+  80092b:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80092e:	39 d8                	cmp    %ebx,%eax
+  800930:	75 ed                	jne    80091f <strncpy+0x14>
+	}
+	return ret;
+}
+  800932:	89 f0                	mov    %esi,%eax
+  800934:	5b                   	pop    %ebx
+  800935:	5e                   	pop    %esi
+  800936:	5d                   	pop    %ebp
+  800937:	c3                   	ret
+
+00800938 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800938:	55                   	push   %ebp
+  800939:	89 e5                	mov    %esp,%ebp
+  80093b:	56                   	push   %esi
+  80093c:	53                   	push   %ebx
+  80093d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800940:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800943:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800946:	89 f0                	mov    %esi,%eax
+  800948:	85 d2                	test   %edx,%edx
+  80094a:	74 21                	je     80096d <strlcpy+0x35>
+  80094c:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800950:	89 f2                	mov    %esi,%edx
+  800952:	eb 09                	jmp    80095d <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800954:	83 c1 01             	add    $0x1,%ecx
+  800957:	83 c2 01             	add    $0x1,%edx
+  80095a:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80095d:	39 c2                	cmp    %eax,%edx
+  80095f:	74 09                	je     80096a <strlcpy+0x32>
+  800961:	0f b6 19             	movzbl (%ecx),%ebx
+  800964:	84 db                	test   %bl,%bl
+  800966:	75 ec                	jne    800954 <strlcpy+0x1c>
+  800968:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80096a:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80096d:	29 f0                	sub    %esi,%eax
+}
+  80096f:	5b                   	pop    %ebx
+  800970:	5e                   	pop    %esi
+  800971:	5d                   	pop    %ebp
+  800972:	c3                   	ret
+
+00800973 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800973:	55                   	push   %ebp
+  800974:	89 e5                	mov    %esp,%ebp
+  800976:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800979:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80097c:	eb 06                	jmp    800984 <strcmp+0x11>
+		p++, q++;
+  80097e:	83 c1 01             	add    $0x1,%ecx
+  800981:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800984:	0f b6 01             	movzbl (%ecx),%eax
+  800987:	84 c0                	test   %al,%al
+  800989:	74 04                	je     80098f <strcmp+0x1c>
+  80098b:	3a 02                	cmp    (%edx),%al
+  80098d:	74 ef                	je     80097e <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80098f:	0f b6 c0             	movzbl %al,%eax
+  800992:	0f b6 12             	movzbl (%edx),%edx
+  800995:	29 d0                	sub    %edx,%eax
+}
+  800997:	5d                   	pop    %ebp
+  800998:	c3                   	ret
+
+00800999 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800999:	55                   	push   %ebp
+  80099a:	89 e5                	mov    %esp,%ebp
+  80099c:	53                   	push   %ebx
+  80099d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009a3:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009a6:	eb 09                	jmp    8009b1 <strncmp+0x18>
+		n--, p++, q++;
+  8009a8:	83 ea 01             	sub    $0x1,%edx
+  8009ab:	83 c0 01             	add    $0x1,%eax
+  8009ae:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009b1:	85 d2                	test   %edx,%edx
+  8009b3:	74 18                	je     8009cd <strncmp+0x34>
+  8009b5:	0f b6 18             	movzbl (%eax),%ebx
+  8009b8:	84 db                	test   %bl,%bl
+  8009ba:	74 04                	je     8009c0 <strncmp+0x27>
+  8009bc:	3a 19                	cmp    (%ecx),%bl
+  8009be:	74 e8                	je     8009a8 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009c0:	0f b6 00             	movzbl (%eax),%eax
+  8009c3:	0f b6 11             	movzbl (%ecx),%edx
+  8009c6:	29 d0                	sub    %edx,%eax
+}
+  8009c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009cb:	c9                   	leave
+  8009cc:	c3                   	ret
+		return 0;
+  8009cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d2:	eb f4                	jmp    8009c8 <strncmp+0x2f>
+
+008009d4 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009d4:	55                   	push   %ebp
+  8009d5:	89 e5                	mov    %esp,%ebp
+  8009d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009da:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009de:	eb 03                	jmp    8009e3 <strchr+0xf>
+  8009e0:	83 c0 01             	add    $0x1,%eax
+  8009e3:	0f b6 10             	movzbl (%eax),%edx
+  8009e6:	84 d2                	test   %dl,%dl
+  8009e8:	74 06                	je     8009f0 <strchr+0x1c>
+		if (*s == c)
+  8009ea:	38 ca                	cmp    %cl,%dl
+  8009ec:	75 f2                	jne    8009e0 <strchr+0xc>
+  8009ee:	eb 05                	jmp    8009f5 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009f5:	5d                   	pop    %ebp
+  8009f6:	c3                   	ret
+
+008009f7 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009f7:	55                   	push   %ebp
+  8009f8:	89 e5                	mov    %esp,%ebp
+  8009fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009fd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a01:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a04:	38 ca                	cmp    %cl,%dl
+  800a06:	74 09                	je     800a11 <strfind+0x1a>
+  800a08:	84 d2                	test   %dl,%dl
+  800a0a:	74 05                	je     800a11 <strfind+0x1a>
+	for (; *s; s++)
+  800a0c:	83 c0 01             	add    $0x1,%eax
+  800a0f:	eb f0                	jmp    800a01 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a11:	5d                   	pop    %ebp
+  800a12:	c3                   	ret
+
+00800a13 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a13:	55                   	push   %ebp
+  800a14:	89 e5                	mov    %esp,%ebp
+  800a16:	57                   	push   %edi
+  800a17:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a1a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a1d:	85 c9                	test   %ecx,%ecx
+  800a1f:	74 20                	je     800a41 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a21:	89 f8                	mov    %edi,%eax
+  800a23:	09 c8                	or     %ecx,%eax
+  800a25:	a8 03                	test   $0x3,%al
+  800a27:	75 12                	jne    800a3b <memset+0x28>
+		c &= 0xFF;
+  800a29:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a2d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a33:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a36:	fc                   	cld
+  800a37:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a39:	eb 06                	jmp    800a41 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a3b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a3e:	fc                   	cld
+  800a3f:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a41:	89 f8                	mov    %edi,%eax
+  800a43:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a46:	c9                   	leave
+  800a47:	c3                   	ret
+
+00800a48 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a48:	55                   	push   %ebp
+  800a49:	89 e5                	mov    %esp,%ebp
+  800a4b:	57                   	push   %edi
+  800a4c:	56                   	push   %esi
+  800a4d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a50:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a53:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a56:	39 c6                	cmp    %eax,%esi
+  800a58:	73 32                	jae    800a8c <memmove+0x44>
+  800a5a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a5d:	39 d0                	cmp    %edx,%eax
+  800a5f:	73 2b                	jae    800a8c <memmove+0x44>
+		s += n;
+		d += n;
+  800a61:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a64:	89 d6                	mov    %edx,%esi
+  800a66:	09 fe                	or     %edi,%esi
+  800a68:	09 ce                	or     %ecx,%esi
+  800a6a:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a70:	75 0e                	jne    800a80 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a72:	83 ef 04             	sub    $0x4,%edi
+  800a75:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a78:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a7b:	fd                   	std
+  800a7c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a7e:	eb 09                	jmp    800a89 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a80:	83 ef 01             	sub    $0x1,%edi
+  800a83:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a86:	fd                   	std
+  800a87:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a89:	fc                   	cld
+  800a8a:	eb 1a                	jmp    800aa6 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a8c:	89 f2                	mov    %esi,%edx
+  800a8e:	09 c2                	or     %eax,%edx
+  800a90:	09 ca                	or     %ecx,%edx
+  800a92:	f6 c2 03             	test   $0x3,%dl
+  800a95:	75 0a                	jne    800aa1 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a97:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a9a:	89 c7                	mov    %eax,%edi
+  800a9c:	fc                   	cld
+  800a9d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a9f:	eb 05                	jmp    800aa6 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800aa1:	89 c7                	mov    %eax,%edi
+  800aa3:	fc                   	cld
+  800aa4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800aa6:	5e                   	pop    %esi
+  800aa7:	5f                   	pop    %edi
+  800aa8:	5d                   	pop    %ebp
+  800aa9:	c3                   	ret
+
+00800aaa <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800aaa:	55                   	push   %ebp
+  800aab:	89 e5                	mov    %esp,%ebp
+  800aad:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ab0:	ff 75 10             	push   0x10(%ebp)
+  800ab3:	ff 75 0c             	push   0xc(%ebp)
+  800ab6:	ff 75 08             	push   0x8(%ebp)
+  800ab9:	e8 8a ff ff ff       	call   800a48 <memmove>
+}
+  800abe:	c9                   	leave
+  800abf:	c3                   	ret
+
+00800ac0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800ac0:	55                   	push   %ebp
+  800ac1:	89 e5                	mov    %esp,%ebp
+  800ac3:	56                   	push   %esi
+  800ac4:	53                   	push   %ebx
+  800ac5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ac8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800acb:	89 c6                	mov    %eax,%esi
+  800acd:	03 75 10             	add    0x10(%ebp),%esi
+  800ad0:	eb 06                	jmp    800ad8 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ad2:	83 c0 01             	add    $0x1,%eax
+  800ad5:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800ad8:	39 f0                	cmp    %esi,%eax
+  800ada:	74 14                	je     800af0 <memcmp+0x30>
+		if (*s1 != *s2)
+  800adc:	0f b6 08             	movzbl (%eax),%ecx
+  800adf:	0f b6 1a             	movzbl (%edx),%ebx
+  800ae2:	38 d9                	cmp    %bl,%cl
+  800ae4:	74 ec                	je     800ad2 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800ae6:	0f b6 c1             	movzbl %cl,%eax
+  800ae9:	0f b6 db             	movzbl %bl,%ebx
+  800aec:	29 d8                	sub    %ebx,%eax
+  800aee:	eb 05                	jmp    800af5 <memcmp+0x35>
+	}
+
+	return 0;
+  800af0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800af5:	5b                   	pop    %ebx
+  800af6:	5e                   	pop    %esi
+  800af7:	5d                   	pop    %ebp
+  800af8:	c3                   	ret
+
+00800af9 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800af9:	55                   	push   %ebp
+  800afa:	89 e5                	mov    %esp,%ebp
+  800afc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b02:	89 c2                	mov    %eax,%edx
+  800b04:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b07:	eb 03                	jmp    800b0c <memfind+0x13>
+  800b09:	83 c0 01             	add    $0x1,%eax
+  800b0c:	39 d0                	cmp    %edx,%eax
+  800b0e:	73 04                	jae    800b14 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b10:	38 08                	cmp    %cl,(%eax)
+  800b12:	75 f5                	jne    800b09 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b14:	5d                   	pop    %ebp
+  800b15:	c3                   	ret
+
+00800b16 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b16:	55                   	push   %ebp
+  800b17:	89 e5                	mov    %esp,%ebp
+  800b19:	57                   	push   %edi
+  800b1a:	56                   	push   %esi
+  800b1b:	53                   	push   %ebx
+  800b1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b1f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b22:	eb 03                	jmp    800b27 <strtol+0x11>
+		s++;
+  800b24:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b27:	0f b6 02             	movzbl (%edx),%eax
+  800b2a:	3c 20                	cmp    $0x20,%al
+  800b2c:	74 f6                	je     800b24 <strtol+0xe>
+  800b2e:	3c 09                	cmp    $0x9,%al
+  800b30:	74 f2                	je     800b24 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b32:	3c 2b                	cmp    $0x2b,%al
+  800b34:	74 2a                	je     800b60 <strtol+0x4a>
+	int neg = 0;
+  800b36:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b3b:	3c 2d                	cmp    $0x2d,%al
+  800b3d:	74 2b                	je     800b6a <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b3f:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b45:	75 0f                	jne    800b56 <strtol+0x40>
+  800b47:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b4a:	74 28                	je     800b74 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b4c:	85 db                	test   %ebx,%ebx
+  800b4e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b53:	0f 44 d8             	cmove  %eax,%ebx
+  800b56:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b5b:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b5e:	eb 46                	jmp    800ba6 <strtol+0x90>
+		s++;
+  800b60:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b63:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b68:	eb d5                	jmp    800b3f <strtol+0x29>
+		s++, neg = 1;
+  800b6a:	83 c2 01             	add    $0x1,%edx
+  800b6d:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b72:	eb cb                	jmp    800b3f <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b74:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b78:	74 0e                	je     800b88 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b7a:	85 db                	test   %ebx,%ebx
+  800b7c:	75 d8                	jne    800b56 <strtol+0x40>
+		s++, base = 8;
+  800b7e:	83 c2 01             	add    $0x1,%edx
+  800b81:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b86:	eb ce                	jmp    800b56 <strtol+0x40>
+		s += 2, base = 16;
+  800b88:	83 c2 02             	add    $0x2,%edx
+  800b8b:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b90:	eb c4                	jmp    800b56 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b92:	0f be c0             	movsbl %al,%eax
+  800b95:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b98:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b9b:	7d 3a                	jge    800bd7 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b9d:	83 c2 01             	add    $0x1,%edx
+  800ba0:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ba4:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ba6:	0f b6 02             	movzbl (%edx),%eax
+  800ba9:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bac:	89 f3                	mov    %esi,%ebx
+  800bae:	80 fb 09             	cmp    $0x9,%bl
+  800bb1:	76 df                	jbe    800b92 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800bb3:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bb6:	89 f3                	mov    %esi,%ebx
+  800bb8:	80 fb 19             	cmp    $0x19,%bl
+  800bbb:	77 08                	ja     800bc5 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800bbd:	0f be c0             	movsbl %al,%eax
+  800bc0:	83 e8 57             	sub    $0x57,%eax
+  800bc3:	eb d3                	jmp    800b98 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bc5:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bc8:	89 f3                	mov    %esi,%ebx
+  800bca:	80 fb 19             	cmp    $0x19,%bl
+  800bcd:	77 08                	ja     800bd7 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800bcf:	0f be c0             	movsbl %al,%eax
+  800bd2:	83 e8 37             	sub    $0x37,%eax
+  800bd5:	eb c1                	jmp    800b98 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800bd7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800bdb:	74 05                	je     800be2 <strtol+0xcc>
+		*endptr = (char *) s;
+  800bdd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800be0:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800be2:	89 c8                	mov    %ecx,%eax
+  800be4:	f7 d8                	neg    %eax
+  800be6:	85 ff                	test   %edi,%edi
+  800be8:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800beb:	89 c8                	mov    %ecx,%eax
+  800bed:	5b                   	pop    %ebx
+  800bee:	5e                   	pop    %esi
+  800bef:	5f                   	pop    %edi
+  800bf0:	5d                   	pop    %ebp
+  800bf1:	c3                   	ret
+
+00800bf2 <atoi>:
+
+int
+atoi(const char *s)
+{
+  800bf2:	55                   	push   %ebp
+  800bf3:	89 e5                	mov    %esp,%ebp
+  800bf5:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800bf8:	6a 0a                	push   $0xa
+  800bfa:	6a 00                	push   $0x0
+  800bfc:	ff 75 08             	push   0x8(%ebp)
+  800bff:	e8 12 ff ff ff       	call   800b16 <strtol>
+}
+  800c04:	c9                   	leave
+  800c05:	c3                   	ret
+
+00800c06 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800c06:	55                   	push   %ebp
+  800c07:	89 e5                	mov    %esp,%ebp
+  800c09:	57                   	push   %edi
+  800c0a:	56                   	push   %esi
+  800c0b:	53                   	push   %ebx
+  800c0c:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800c12:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800c18:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800c1e:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800c24:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800c2b:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800c2e:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800c35:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800c38:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800c3f:	74 76                	je     800cb7 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800c41:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800c47:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c4a:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800c50:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  800c57:	0f 88 06 01 00 00    	js     800d63 <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800c5d:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  800c64:	0f 84 48 01 00 00    	je     800db2 <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800c6a:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800c70:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800c76:	be 00 00 00 00       	mov    $0x0,%esi
+  800c7b:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800c81:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c84:	55                   	push   %ebp
+  800c85:	68 8e 0c 80 00       	push   $0x800c8e
+  800c8a:	89 e5                	mov    %esp,%ebp
+  800c8c:	0f 34                	sysenter
+  800c8e:	83 c4 04             	add    $0x4,%esp
+  800c91:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800c92:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800c98:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800c9e:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800ca1:	0f 85 9a 01 00 00    	jne    800e41 <page_vec_call+0x23b>
+  800ca7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cac:	8b 75 08             	mov    0x8(%ebp),%esi
+  800caf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cb2:	e9 29 01 00 00       	jmp    800de0 <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800cb7:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800cbd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cc0:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800cc2:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  800cc9:	78 2f                	js     800cfa <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800ccb:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  800cd2:	74 72                	je     800d46 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800cd4:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800cda:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800ce0:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ce5:	89 fb                	mov    %edi,%ebx
+  800ce7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800cea:	55                   	push   %ebp
+  800ceb:	68 f4 0c 80 00       	push   $0x800cf4
+  800cf0:	89 e5                	mov    %esp,%ebp
+  800cf2:	0f 34                	sysenter
+  800cf4:	83 c4 04             	add    $0x4,%esp
+  800cf7:	5d                   	pop    %ebp
+	return ret;
+  800cf8:	eb 98                	jmp    800c92 <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800cfa:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cff:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800d01:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800d06:	f6 c6 08             	test   $0x8,%dh
+  800d09:	74 15                	je     800d20 <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d0b:	89 c2                	mov    %eax,%edx
+  800d0d:	c1 ea 08             	shr    $0x8,%edx
+  800d10:	83 e2 0f             	and    $0xf,%edx
+  800d13:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d18:	83 fa 06             	cmp    $0x6,%edx
+  800d1b:	74 0e                	je     800d2b <page_vec_call+0x125>
+  800d1d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800d20:	0f b6 c9             	movzbl %cl,%ecx
+  800d23:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  800d29:	eb a0                	jmp    800ccb <page_vec_call+0xc5>
+  800d2b:	89 c2                	mov    %eax,%edx
+  800d2d:	c1 ea 04             	shr    $0x4,%edx
+  800d30:	83 e2 0f             	and    $0xf,%edx
+  800d33:	83 fa 02             	cmp    $0x2,%edx
+  800d36:	77 e5                	ja     800d1d <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800d38:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d3b:	83 f8 02             	cmp    $0x2,%eax
+  800d3e:	0f 97 c1             	seta   %cl
+  800d41:	0f b6 c9             	movzbl %cl,%ecx
+  800d44:	eb d7                	jmp    800d1d <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800d46:	b8 10 00 00 00       	mov    $0x10,%eax
+  800d4b:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800d51:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800d57:	89 fb                	mov    %edi,%ebx
+  800d59:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800d5c:	cd 30                	int    $0x30
+  800d5e:	e9 2f ff ff ff       	jmp    800c92 <page_vec_call+0x8c>
+  800d63:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d68:	0f a2                	cpuid
+		return 0;
+  800d6a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800d6f:	f6 c6 08             	test   $0x8,%dh
+  800d72:	74 15                	je     800d89 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d74:	89 c2                	mov    %eax,%edx
+  800d76:	c1 ea 08             	shr    $0x8,%edx
+  800d79:	83 e2 0f             	and    $0xf,%edx
+  800d7c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d81:	83 fa 06             	cmp    $0x6,%edx
+  800d84:	74 11                	je     800d97 <page_vec_call+0x191>
+  800d86:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800d89:	0f b6 c9             	movzbl %cl,%ecx
+  800d8c:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  800d92:	e9 c6 fe ff ff       	jmp    800c5d <page_vec_call+0x57>
+  800d97:	89 c2                	mov    %eax,%edx
+  800d99:	c1 ea 04             	shr    $0x4,%edx
+  800d9c:	83 e2 0f             	and    $0xf,%edx
+  800d9f:	83 fa 02             	cmp    $0x2,%edx
+  800da2:	77 e2                	ja     800d86 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800da4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800da7:	83 f8 02             	cmp    $0x2,%eax
+  800daa:	0f 97 c1             	seta   %cl
+  800dad:	0f b6 c9             	movzbl %cl,%ecx
+  800db0:	eb d4                	jmp    800d86 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800db2:	be 00 00 00 00       	mov    $0x0,%esi
+  800db7:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800dbd:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800dc3:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800dc9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800dcc:	cd 30                	int    $0x30
+  800dce:	e9 bf fe ff ff       	jmp    800c92 <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800dd3:	29 da                	sub    %ebx,%edx
+			vec++;
+  800dd5:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800dd8:	83 e8 01             	sub    $0x1,%eax
+  800ddb:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800de0:	85 c0                	test   %eax,%eax
+  800de2:	74 58                	je     800e3c <page_vec_call+0x236>
+  800de4:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800de7:	39 da                	cmp    %ebx,%edx
+  800de9:	73 e8                	jae    800dd3 <page_vec_call+0x1cd>
+  800deb:	89 75 08             	mov    %esi,0x8(%ebp)
+  800dee:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800df1:	84 c9                	test   %cl,%cl
+  800df3:	74 06                	je     800dfb <page_vec_call+0x1f5>
+  800df5:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800dfb:	83 ec 04             	sub    $0x4,%esp
+  800dfe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e01:	c1 e0 04             	shl    $0x4,%eax
+  800e04:	50                   	push   %eax
+  800e05:	ff 75 08             	push   0x8(%ebp)
+  800e08:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800e0e:	53                   	push   %ebx
+  800e0f:	e8 34 fc ff ff       	call   800a48 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800e14:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800e1a:	89 c2                	mov    %eax,%edx
+  800e1c:	c1 e2 0c             	shl    $0xc,%edx
+  800e1f:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  800e25:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  800e2b:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  800e31:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  800e34:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  800e37:	e9 f2 fd ff ff       	jmp    800c2e <page_vec_call+0x28>
+			r = 0;
+  800e3c:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  800e41:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800e45:	74 0b                	je     800e52 <page_vec_call+0x24c>
+		*done = total;
+  800e47:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800e4a:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  800e50:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  800e52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e55:	5b                   	pop    %ebx
+  800e56:	5e                   	pop    %esi
+  800e57:	5f                   	pop    %edi
+  800e58:	5d                   	pop    %ebp
+  800e59:	c3                   	ret
+
+00800e5a <sys_cputs>:
+{
+  800e5a:	55                   	push   %ebp
+  800e5b:	89 e5                	mov    %esp,%ebp
+  800e5d:	57                   	push   %edi
+  800e5e:	56                   	push   %esi
+  800e5f:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800e60:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  800e67:	78 2d                	js     800e96 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800e69:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  800e70:	74 70                	je     800ee2 <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800e72:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e77:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7d:	89 c3                	mov    %eax,%ebx
+  800e7f:	89 c7                	mov    %eax,%edi
+  800e81:	89 c6                	mov    %eax,%esi
+  800e83:	55                   	push   %ebp
+  800e84:	68 8d 0e 80 00       	push   $0x800e8d
+  800e89:	89 e5                	mov    %esp,%ebp
+  800e8b:	0f 34                	sysenter
+  800e8d:	83 c4 04             	add    $0x4,%esp
+  800e90:	5d                   	pop    %ebp
+}
+  800e91:	5b                   	pop    %ebx
+  800e92:	5e                   	pop    %esi
+  800e93:	5f                   	pop    %edi
+  800e94:	5d                   	pop    %ebp
+  800e95:	c3                   	ret
+  800e96:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e9b:	0f a2                	cpuid
+		return 0;
+  800e9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800ea2:	f6 c6 08             	test   $0x8,%dh
+  800ea5:	74 15                	je     800ebc <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ea7:	89 c2                	mov    %eax,%edx
+  800ea9:	c1 ea 08             	shr    $0x8,%edx
+  800eac:	83 e2 0f             	and    $0xf,%edx
+  800eaf:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800eb4:	83 fa 06             	cmp    $0x6,%edx
+  800eb7:	74 0e                	je     800ec7 <sys_cputs+0x6d>
+  800eb9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800ebc:	0f b6 c9             	movzbl %cl,%ecx
+  800ebf:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  800ec5:	eb a2                	jmp    800e69 <sys_cputs+0xf>
+  800ec7:	89 c2                	mov    %eax,%edx
+  800ec9:	c1 ea 04             	shr    $0x4,%edx
+  800ecc:	83 e2 0f             	and    $0xf,%edx
+  800ecf:	83 fa 02             	cmp    $0x2,%edx
+  800ed2:	77 e5                	ja     800eb9 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800ed4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ed7:	83 f8 02             	cmp    $0x2,%eax
+  800eda:	0f 97 c1             	seta   %cl
+  800edd:	0f b6 c9             	movzbl %cl,%ecx
+  800ee0:	eb d7                	jmp    800eb9 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800ee2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ee7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eed:	89 c3                	mov    %eax,%ebx
+  800eef:	89 c7                	mov    %eax,%edi
+  800ef1:	89 c6                	mov    %eax,%esi
+  800ef3:	cd 30                	int    $0x30
+}
+  800ef5:	eb 9a                	jmp    800e91 <sys_cputs+0x37>
+
+00800ef7 <sys_cgetc>:
+{
+  800ef7:	55                   	push   %ebp
+  800ef8:	89 e5                	mov    %esp,%ebp
+  800efa:	57                   	push   %edi
+  800efb:	56                   	push   %esi
+  800efc:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800efd:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  800f04:	78 2e                	js     800f34 <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  800f06:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  800f0d:	74 71                	je     800f80 <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  800f0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f14:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f19:	89 d1                	mov    %edx,%ecx
+  800f1b:	89 d3                	mov    %edx,%ebx
+  800f1d:	89 d7                	mov    %edx,%edi
+  800f1f:	89 d6                	mov    %edx,%esi
+  800f21:	55                   	push   %ebp
+  800f22:	68 2b 0f 80 00       	push   $0x800f2b
+  800f27:	89 e5                	mov    %esp,%ebp
+  800f29:	0f 34                	sysenter
+  800f2b:	83 c4 04             	add    $0x4,%esp
+  800f2e:	5d                   	pop    %ebp
+}
+  800f2f:	5b                   	pop    %ebx
+  800f30:	5e                   	pop    %esi
+  800f31:	5f                   	pop    %edi
+  800f32:	5d                   	pop    %ebp
+  800f33:	c3                   	ret
+  800f34:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f39:	0f a2                	cpuid
+		return 0;
+  800f3b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f40:	f6 c6 08             	test   $0x8,%dh
+  800f43:	74 15                	je     800f5a <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f45:	89 c2                	mov    %eax,%edx
+  800f47:	c1 ea 08             	shr    $0x8,%edx
+  800f4a:	83 e2 0f             	and    $0xf,%edx
+  800f4d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f52:	83 fa 06             	cmp    $0x6,%edx
+  800f55:	74 0e                	je     800f65 <sys_cgetc+0x6e>
+  800f57:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f5a:	0f b6 c9             	movzbl %cl,%ecx
+  800f5d:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  800f63:	eb a1                	jmp    800f06 <sys_cgetc+0xf>
+  800f65:	89 c2                	mov    %eax,%edx
+  800f67:	c1 ea 04             	shr    $0x4,%edx
+  800f6a:	83 e2 0f             	and    $0xf,%edx
+  800f6d:	83 fa 02             	cmp    $0x2,%edx
+  800f70:	77 e5                	ja     800f57 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  800f72:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f75:	83 f8 02             	cmp    $0x2,%eax
+  800f78:	0f 97 c1             	seta   %cl
+  800f7b:	0f b6 c9             	movzbl %cl,%ecx
+  800f7e:	eb d7                	jmp    800f57 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  800f80:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f85:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8a:	89 d1                	mov    %edx,%ecx
+  800f8c:	89 d3                	mov    %edx,%ebx
+  800f8e:	89 d7                	mov    %edx,%edi
+  800f90:	89 d6                	mov    %edx,%esi
+  800f92:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800f94:	eb 99                	jmp    800f2f <sys_cgetc+0x38>
+
+00800f96 <sys_env_destroy>:
+{
+  800f96:	55                   	push   %ebp
+  800f97:	89 e5                	mov    %esp,%ebp
+  800f99:	57                   	push   %edi
+  800f9a:	56                   	push   %esi
+  800f9b:	53                   	push   %ebx
+  800f9c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800f9f:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  800fa6:	78 36                	js     800fde <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  800fa8:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  800faf:	74 79                	je     80102a <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  800fb1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fb9:	b8 03 00 00 00       	mov    $0x3,%eax
+  800fbe:	89 cb                	mov    %ecx,%ebx
+  800fc0:	89 cf                	mov    %ecx,%edi
+  800fc2:	89 ce                	mov    %ecx,%esi
+  800fc4:	55                   	push   %ebp
+  800fc5:	68 ce 0f 80 00       	push   $0x800fce
+  800fca:	89 e5                	mov    %esp,%ebp
+  800fcc:	0f 34                	sysenter
+  800fce:	83 c4 04             	add    $0x4,%esp
+  800fd1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800fd2:	85 c0                	test   %eax,%eax
+  800fd4:	7f 6b                	jg     801041 <sys_env_destroy+0xab>
+}
+  800fd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fd9:	5b                   	pop    %ebx
+  800fda:	5e                   	pop    %esi
+  800fdb:	5f                   	pop    %edi
+  800fdc:	5d                   	pop    %ebp
+  800fdd:	c3                   	ret
+  800fde:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fe3:	0f a2                	cpuid
+		return 0;
+  800fe5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800fea:	f6 c6 08             	test   $0x8,%dh
+  800fed:	74 15                	je     801004 <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800fef:	89 c2                	mov    %eax,%edx
+  800ff1:	c1 ea 08             	shr    $0x8,%edx
+  800ff4:	83 e2 0f             	and    $0xf,%edx
+  800ff7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ffc:	83 fa 06             	cmp    $0x6,%edx
+  800fff:	74 0e                	je     80100f <sys_env_destroy+0x79>
+  801001:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801004:	0f b6 c9             	movzbl %cl,%ecx
+  801007:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  80100d:	eb 99                	jmp    800fa8 <sys_env_destroy+0x12>
+  80100f:	89 c2                	mov    %eax,%edx
+  801011:	c1 ea 04             	shr    $0x4,%edx
+  801014:	83 e2 0f             	and    $0xf,%edx
+  801017:	83 fa 02             	cmp    $0x2,%edx
+  80101a:	77 e5                	ja     801001 <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  80101c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80101f:	83 f8 02             	cmp    $0x2,%eax
+  801022:	0f 97 c1             	seta   %cl
+  801025:	0f b6 c9             	movzbl %cl,%ecx
+  801028:	eb d7                	jmp    801001 <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  80102a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80102f:	b8 03 00 00 00       	mov    $0x3,%eax
+  801034:	8b 55 08             	mov    0x8(%ebp),%edx
+  801037:	89 cb                	mov    %ecx,%ebx
+  801039:	89 cf                	mov    %ecx,%edi
+  80103b:	89 ce                	mov    %ecx,%esi
+  80103d:	cd 30                	int    $0x30
+  80103f:	eb 91                	jmp    800fd2 <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801041:	83 ec 0c             	sub    $0xc,%esp
+  801044:	50                   	push   %eax
+  801045:	6a 03                	push   $0x3
+  801047:	68 39 2d a0 00       	push   $0xa02d39
+  80104c:	6a 4a                	push   $0x4a
+  80104e:	68 56 2d a0 00       	push   $0xa02d56
+  801053:	e8 68 f1 ff ff       	call   8001c0 <_panic>
+
+00801058 <sys_getenvid>:
+{
+  801058:	55                   	push   %ebp
+  801059:	89 e5                	mov    %esp,%ebp
+  80105b:	57                   	push   %edi
+  80105c:	56                   	push   %esi
+  80105d:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80105e:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  801065:	78 2e                	js     801095 <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  801067:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  80106e:	74 71                	je     8010e1 <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  801070:	ba 00 00 00 00       	mov    $0x0,%edx
+  801075:	b8 02 00 00 00       	mov    $0x2,%eax
+  80107a:	89 d1                	mov    %edx,%ecx
+  80107c:	89 d3                	mov    %edx,%ebx
+  80107e:	89 d7                	mov    %edx,%edi
+  801080:	89 d6                	mov    %edx,%esi
+  801082:	55                   	push   %ebp
+  801083:	68 8c 10 80 00       	push   $0x80108c
+  801088:	89 e5                	mov    %esp,%ebp
+  80108a:	0f 34                	sysenter
+  80108c:	83 c4 04             	add    $0x4,%esp
+  80108f:	5d                   	pop    %ebp
+}
+  801090:	5b                   	pop    %ebx
+  801091:	5e                   	pop    %esi
+  801092:	5f                   	pop    %edi
+  801093:	5d                   	pop    %ebp
+  801094:	c3                   	ret
+  801095:	b8 01 00 00 00       	mov    $0x1,%eax
+  80109a:	0f a2                	cpuid
+		return 0;
+  80109c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8010a1:	f6 c6 08             	test   $0x8,%dh
+  8010a4:	74 15                	je     8010bb <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010a6:	89 c2                	mov    %eax,%edx
+  8010a8:	c1 ea 08             	shr    $0x8,%edx
+  8010ab:	83 e2 0f             	and    $0xf,%edx
+  8010ae:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8010b3:	83 fa 06             	cmp    $0x6,%edx
+  8010b6:	74 0e                	je     8010c6 <sys_getenvid+0x6e>
+  8010b8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8010bb:	0f b6 c9             	movzbl %cl,%ecx
+  8010be:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  8010c4:	eb a1                	jmp    801067 <sys_getenvid+0xf>
+  8010c6:	89 c2                	mov    %eax,%edx
+  8010c8:	c1 ea 04             	shr    $0x4,%edx
+  8010cb:	83 e2 0f             	and    $0xf,%edx
+  8010ce:	83 fa 02             	cmp    $0x2,%edx
+  8010d1:	77 e5                	ja     8010b8 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  8010d3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010d6:	83 f8 02             	cmp    $0x2,%eax
+  8010d9:	0f 97 c1             	seta   %cl
+  8010dc:	0f b6 c9             	movzbl %cl,%ecx
+  8010df:	eb d7                	jmp    8010b8 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  8010e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010e6:	b8 02 00 00 00       	mov    $0x2,%eax
+  8010eb:	89 d1                	mov    %edx,%ecx
+  8010ed:	89 d3                	mov    %edx,%ebx
+  8010ef:	89 d7                	mov    %edx,%edi
+  8010f1:	89 d6                	mov    %edx,%esi
+  8010f3:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  8010f5:	eb 99                	jmp    801090 <sys_getenvid+0x38>
+
+008010f7 <sys_page_alloc>:
+{
+  8010f7:	55                   	push   %ebp
+  8010f8:	89 e5                	mov    %esp,%ebp
+  8010fa:	57                   	push   %edi
+  8010fb:	56                   	push   %esi
+  8010fc:	53                   	push   %ebx
+  8010fd:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801100:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  801107:	78 38                	js     801141 <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  801109:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  801110:	74 7b                	je     80118d <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  801112:	be 00 00 00 00       	mov    $0x0,%esi
+  801117:	8b 55 08             	mov    0x8(%ebp),%edx
+  80111a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111d:	b8 04 00 00 00       	mov    $0x4,%eax
+  801122:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801125:	89 f7                	mov    %esi,%edi
+  801127:	55                   	push   %ebp
+  801128:	68 31 11 80 00       	push   $0x801131
+  80112d:	89 e5                	mov    %esp,%ebp
+  80112f:	0f 34                	sysenter
+  801131:	83 c4 04             	add    $0x4,%esp
+  801134:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801135:	85 c0                	test   %eax,%eax
+  801137:	7f 6d                	jg     8011a6 <sys_page_alloc+0xaf>
+}
+  801139:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80113c:	5b                   	pop    %ebx
+  80113d:	5e                   	pop    %esi
+  80113e:	5f                   	pop    %edi
+  80113f:	5d                   	pop    %ebp
+  801140:	c3                   	ret
+  801141:	b8 01 00 00 00       	mov    $0x1,%eax
+  801146:	0f a2                	cpuid
+		return 0;
+  801148:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80114d:	f6 c6 08             	test   $0x8,%dh
+  801150:	74 15                	je     801167 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801152:	89 c2                	mov    %eax,%edx
+  801154:	c1 ea 08             	shr    $0x8,%edx
+  801157:	83 e2 0f             	and    $0xf,%edx
+  80115a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80115f:	83 fa 06             	cmp    $0x6,%edx
+  801162:	74 0e                	je     801172 <sys_page_alloc+0x7b>
+  801164:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801167:	0f b6 c9             	movzbl %cl,%ecx
+  80116a:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  801170:	eb 97                	jmp    801109 <sys_page_alloc+0x12>
+  801172:	89 c2                	mov    %eax,%edx
+  801174:	c1 ea 04             	shr    $0x4,%edx
+  801177:	83 e2 0f             	and    $0xf,%edx
+  80117a:	83 fa 02             	cmp    $0x2,%edx
+  80117d:	77 e5                	ja     801164 <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  80117f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801182:	83 f8 02             	cmp    $0x2,%eax
+  801185:	0f 97 c1             	seta   %cl
+  801188:	0f b6 c9             	movzbl %cl,%ecx
+  80118b:	eb d7                	jmp    801164 <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  80118d:	be 00 00 00 00       	mov    $0x0,%esi
+  801192:	b8 04 00 00 00       	mov    $0x4,%eax
+  801197:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80119d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011a0:	89 f7                	mov    %esi,%edi
+  8011a2:	cd 30                	int    $0x30
+  8011a4:	eb 8f                	jmp    801135 <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011a6:	83 ec 0c             	sub    $0xc,%esp
+  8011a9:	50                   	push   %eax
+  8011aa:	6a 04                	push   $0x4
+  8011ac:	68 39 2d a0 00       	push   $0xa02d39
+  8011b1:	6a 4a                	push   $0x4a
+  8011b3:	68 56 2d a0 00       	push   $0xa02d56
+  8011b8:	e8 03 f0 ff ff       	call   8001c0 <_panic>
+
+008011bd <sys_page_map>:
+{
+  8011bd:	55                   	push   %ebp
+  8011be:	89 e5                	mov    %esp,%ebp
+  8011c0:	57                   	push   %edi
+  8011c1:	56                   	push   %esi
+  8011c2:	53                   	push   %ebx
+  8011c3:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8011c6:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  8011cd:	78 37                	js     801206 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  8011cf:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  8011d6:	74 7a                	je     801252 <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  8011d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011de:	b8 05 00 00 00       	mov    $0x5,%eax
+  8011e3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011e6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011e9:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011ec:	55                   	push   %ebp
+  8011ed:	68 f6 11 80 00       	push   $0x8011f6
+  8011f2:	89 e5                	mov    %esp,%ebp
+  8011f4:	0f 34                	sysenter
+  8011f6:	83 c4 04             	add    $0x4,%esp
+  8011f9:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8011fa:	85 c0                	test   %eax,%eax
+  8011fc:	7f 6c                	jg     80126a <sys_page_map+0xad>
+}
+  8011fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801201:	5b                   	pop    %ebx
+  801202:	5e                   	pop    %esi
+  801203:	5f                   	pop    %edi
+  801204:	5d                   	pop    %ebp
+  801205:	c3                   	ret
+  801206:	b8 01 00 00 00       	mov    $0x1,%eax
+  80120b:	0f a2                	cpuid
+		return 0;
+  80120d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801212:	f6 c6 08             	test   $0x8,%dh
+  801215:	74 15                	je     80122c <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801217:	89 c2                	mov    %eax,%edx
+  801219:	c1 ea 08             	shr    $0x8,%edx
+  80121c:	83 e2 0f             	and    $0xf,%edx
+  80121f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801224:	83 fa 06             	cmp    $0x6,%edx
+  801227:	74 0e                	je     801237 <sys_page_map+0x7a>
+  801229:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80122c:	0f b6 c9             	movzbl %cl,%ecx
+  80122f:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  801235:	eb 98                	jmp    8011cf <sys_page_map+0x12>
+  801237:	89 c2                	mov    %eax,%edx
+  801239:	c1 ea 04             	shr    $0x4,%edx
+  80123c:	83 e2 0f             	and    $0xf,%edx
+  80123f:	83 fa 02             	cmp    $0x2,%edx
+  801242:	77 e5                	ja     801229 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  801244:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801247:	83 f8 02             	cmp    $0x2,%eax
+  80124a:	0f 97 c1             	seta   %cl
+  80124d:	0f b6 c9             	movzbl %cl,%ecx
+  801250:	eb d7                	jmp    801229 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  801252:	b8 05 00 00 00       	mov    $0x5,%eax
+  801257:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80125d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801260:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801263:	8b 75 18             	mov    0x18(%ebp),%esi
+  801266:	cd 30                	int    $0x30
+  801268:	eb 90                	jmp    8011fa <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80126a:	83 ec 0c             	sub    $0xc,%esp
+  80126d:	50                   	push   %eax
+  80126e:	6a 05                	push   $0x5
+  801270:	68 39 2d a0 00       	push   $0xa02d39
+  801275:	6a 4a                	push   $0x4a
+  801277:	68 56 2d a0 00       	push   $0xa02d56
+  80127c:	e8 3f ef ff ff       	call   8001c0 <_panic>
+
+00801281 <sys_page_unmap>:
+{
+  801281:	55                   	push   %ebp
+  801282:	89 e5                	mov    %esp,%ebp
+  801284:	57                   	push   %edi
+  801285:	56                   	push   %esi
+  801286:	53                   	push   %ebx
+  801287:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80128a:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  801291:	78 37                	js     8012ca <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  801293:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  80129a:	74 7a                	je     801316 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  80129c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a7:	b8 06 00 00 00       	mov    $0x6,%eax
+  8012ac:	89 df                	mov    %ebx,%edi
+  8012ae:	89 de                	mov    %ebx,%esi
+  8012b0:	55                   	push   %ebp
+  8012b1:	68 ba 12 80 00       	push   $0x8012ba
+  8012b6:	89 e5                	mov    %esp,%ebp
+  8012b8:	0f 34                	sysenter
+  8012ba:	83 c4 04             	add    $0x4,%esp
+  8012bd:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8012be:	85 c0                	test   %eax,%eax
+  8012c0:	7f 6c                	jg     80132e <sys_page_unmap+0xad>
+}
+  8012c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012c5:	5b                   	pop    %ebx
+  8012c6:	5e                   	pop    %esi
+  8012c7:	5f                   	pop    %edi
+  8012c8:	5d                   	pop    %ebp
+  8012c9:	c3                   	ret
+  8012ca:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012cf:	0f a2                	cpuid
+		return 0;
+  8012d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8012d6:	f6 c6 08             	test   $0x8,%dh
+  8012d9:	74 15                	je     8012f0 <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012db:	89 c2                	mov    %eax,%edx
+  8012dd:	c1 ea 08             	shr    $0x8,%edx
+  8012e0:	83 e2 0f             	and    $0xf,%edx
+  8012e3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012e8:	83 fa 06             	cmp    $0x6,%edx
+  8012eb:	74 0e                	je     8012fb <sys_page_unmap+0x7a>
+  8012ed:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8012f0:	0f b6 c9             	movzbl %cl,%ecx
+  8012f3:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  8012f9:	eb 98                	jmp    801293 <sys_page_unmap+0x12>
+  8012fb:	89 c2                	mov    %eax,%edx
+  8012fd:	c1 ea 04             	shr    $0x4,%edx
+  801300:	83 e2 0f             	and    $0xf,%edx
+  801303:	83 fa 02             	cmp    $0x2,%edx
+  801306:	77 e5                	ja     8012ed <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  801308:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80130b:	83 f8 02             	cmp    $0x2,%eax
+  80130e:	0f 97 c1             	seta   %cl
+  801311:	0f b6 c9             	movzbl %cl,%ecx
+  801314:	eb d7                	jmp    8012ed <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  801316:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80131b:	b8 06 00 00 00       	mov    $0x6,%eax
+  801320:	8b 55 08             	mov    0x8(%ebp),%edx
+  801323:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801326:	89 df                	mov    %ebx,%edi
+  801328:	89 de                	mov    %ebx,%esi
+  80132a:	cd 30                	int    $0x30
+  80132c:	eb 90                	jmp    8012be <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80132e:	83 ec 0c             	sub    $0xc,%esp
+  801331:	50                   	push   %eax
+  801332:	6a 06                	push   $0x6
+  801334:	68 39 2d a0 00       	push   $0xa02d39
+  801339:	6a 4a                	push   $0x4a
+  80133b:	68 56 2d a0 00       	push   $0xa02d56
+  801340:	e8 7b ee ff ff       	call   8001c0 <_panic>
+
+00801345 <sys_page_copy>:
+{
+  801345:	55                   	push   %ebp
+  801346:	89 e5                	mov    %esp,%ebp
+  801348:	57                   	push   %edi
+  801349:	56                   	push   %esi
+  80134a:	53                   	push   %ebx
+  80134b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80134e:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  801355:	78 37                	js     80138e <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  801357:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  80135e:	74 7a                	je     8013da <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  801360:	8b 55 08             	mov    0x8(%ebp),%edx
+  801363:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801366:	b8 29 00 00 00       	mov    $0x29,%eax
+  80136b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80136e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801371:	8b 75 18             	mov    0x18(%ebp),%esi
+  801374:	55                   	push   %ebp
+  801375:	68 7e 13 80 00       	push   $0x80137e
+  80137a:	89 e5                	mov    %esp,%ebp
+  80137c:	0f 34                	sysenter
+  80137e:	83 c4 04             	add    $0x4,%esp
+  801381:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801382:	85 c0                	test   %eax,%eax
+  801384:	7f 6c                	jg     8013f2 <sys_page_copy+0xad>
+}
+  801386:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801389:	5b                   	pop    %ebx
+  80138a:	5e                   	pop    %esi
+  80138b:	5f                   	pop    %edi
+  80138c:	5d                   	pop    %ebp
+  80138d:	c3                   	ret
+  80138e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801393:	0f a2                	cpuid
+		return 0;
+  801395:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80139a:	f6 c6 08             	test   $0x8,%dh
+  80139d:	74 15                	je     8013b4 <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80139f:	89 c2                	mov    %eax,%edx
+  8013a1:	c1 ea 08             	shr    $0x8,%edx
+  8013a4:	83 e2 0f             	and    $0xf,%edx
+  8013a7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8013ac:	83 fa 06             	cmp    $0x6,%edx
+  8013af:	74 0e                	je     8013bf <sys_page_copy+0x7a>
+  8013b1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8013b4:	0f b6 c9             	movzbl %cl,%ecx
+  8013b7:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  8013bd:	eb 98                	jmp    801357 <sys_page_copy+0x12>
+  8013bf:	89 c2                	mov    %eax,%edx
+  8013c1:	c1 ea 04             	shr    $0x4,%edx
+  8013c4:	83 e2 0f             	and    $0xf,%edx
+  8013c7:	83 fa 02             	cmp    $0x2,%edx
+  8013ca:	77 e5                	ja     8013b1 <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  8013cc:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013cf:	83 f8 02             	cmp    $0x2,%eax
+  8013d2:	0f 97 c1             	seta   %cl
+  8013d5:	0f b6 c9             	movzbl %cl,%ecx
+  8013d8:	eb d7                	jmp    8013b1 <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  8013da:	b8 29 00 00 00       	mov    $0x29,%eax
+  8013df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013e8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013eb:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013ee:	cd 30                	int    $0x30
+  8013f0:	eb 90                	jmp    801382 <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013f2:	83 ec 0c             	sub    $0xc,%esp
+  8013f5:	50                   	push   %eax
+  8013f6:	6a 29                	push   $0x29
+  8013f8:	68 39 2d a0 00       	push   $0xa02d39
+  8013fd:	6a 4a                	push   $0x4a
+  8013ff:	68 56 2d a0 00       	push   $0xa02d56
+  801404:	e8 b7 ed ff ff       	call   8001c0 <_panic>
+
+00801409 <sys_yield>:
+{
+  801409:	55                   	push   %ebp
+  80140a:	89 e5                	mov    %esp,%ebp
+  80140c:	57                   	push   %edi
+  80140d:	56                   	push   %esi
+  80140e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80140f:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  801416:	78 2e                	js     801446 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  801418:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  80141f:	74 71                	je     801492 <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  801421:	ba 00 00 00 00       	mov    $0x0,%edx
+  801426:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80142b:	89 d1                	mov    %edx,%ecx
+  80142d:	89 d3                	mov    %edx,%ebx
+  80142f:	89 d7                	mov    %edx,%edi
+  801431:	89 d6                	mov    %edx,%esi
+  801433:	55                   	push   %ebp
+  801434:	68 3d 14 80 00       	push   $0x80143d
+  801439:	89 e5                	mov    %esp,%ebp
+  80143b:	0f 34                	sysenter
+  80143d:	83 c4 04             	add    $0x4,%esp
+  801440:	5d                   	pop    %ebp
+}
+  801441:	5b                   	pop    %ebx
+  801442:	5e                   	pop    %esi
+  801443:	5f                   	pop    %edi
+  801444:	5d                   	pop    %ebp
+  801445:	c3                   	ret
+  801446:	b8 01 00 00 00       	mov    $0x1,%eax
+  80144b:	0f a2                	cpuid
+		return 0;
+  80144d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801452:	f6 c6 08             	test   $0x8,%dh
+  801455:	74 15                	je     80146c <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801457:	89 c2                	mov    %eax,%edx
+  801459:	c1 ea 08             	shr    $0x8,%edx
+  80145c:	83 e2 0f             	and    $0xf,%edx
+  80145f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801464:	83 fa 06             	cmp    $0x6,%edx
+  801467:	74 0e                	je     801477 <sys_yield+0x6e>
+  801469:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80146c:	0f b6 c9             	movzbl %cl,%ecx
+  80146f:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  801475:	eb a1                	jmp    801418 <sys_yield+0xf>
+  801477:	89 c2                	mov    %eax,%edx
+  801479:	c1 ea 04             	shr    $0x4,%edx
+  80147c:	83 e2 0f             	and    $0xf,%edx
+  80147f:	83 fa 02             	cmp    $0x2,%edx
+  801482:	77 e5                	ja     801469 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  801484:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801487:	83 f8 02             	cmp    $0x2,%eax
+  80148a:	0f 97 c1             	seta   %cl
+  80148d:	0f b6 c9             	movzbl %cl,%ecx
+  801490:	eb d7                	jmp    801469 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  801492:	ba 00 00 00 00       	mov    $0x0,%edx
+  801497:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80149c:	89 d1                	mov    %edx,%ecx
+  80149e:	89 d3                	mov    %edx,%ebx
+  8014a0:	89 d7                	mov    %edx,%edi
+  8014a2:	89 d6                	mov    %edx,%esi
+  8014a4:	cd 30                	int    $0x30
+}
+  8014a6:	eb 99                	jmp    801441 <sys_yield+0x38>
+
+008014a8 <sys_env_set_status>:
+{
+  8014a8:	55                   	push   %ebp
+  8014a9:	89 e5                	mov    %esp,%ebp
+  8014ab:	57                   	push   %edi
+  8014ac:	56                   	push   %esi
+  8014ad:	53                   	push   %ebx
+  8014ae:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8014b1:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  8014b8:	78 37                	js     8014f1 <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  8014ba:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  8014c1:	74 7a                	je     80153d <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  8014c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ce:	b8 08 00 00 00       	mov    $0x8,%eax
+  8014d3:	89 df                	mov    %ebx,%edi
+  8014d5:	89 de                	mov    %ebx,%esi
+  8014d7:	55                   	push   %ebp
+  8014d8:	68 e1 14 80 00       	push   $0x8014e1
+  8014dd:	89 e5                	mov    %esp,%ebp
+  8014df:	0f 34                	sysenter
+  8014e1:	83 c4 04             	add    $0x4,%esp
+  8014e4:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8014e5:	85 c0                	test   %eax,%eax
+  8014e7:	7f 6c                	jg     801555 <sys_env_set_status+0xad>
+}
+  8014e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ec:	5b                   	pop    %ebx
+  8014ed:	5e                   	pop    %esi
+  8014ee:	5f                   	pop    %edi
+  8014ef:	5d                   	pop    %ebp
+  8014f0:	c3                   	ret
+  8014f1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014f6:	0f a2                	cpuid
+		return 0;
+  8014f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8014fd:	f6 c6 08             	test   $0x8,%dh
+  801500:	74 15                	je     801517 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801502:	89 c2                	mov    %eax,%edx
+  801504:	c1 ea 08             	shr    $0x8,%edx
+  801507:	83 e2 0f             	and    $0xf,%edx
+  80150a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80150f:	83 fa 06             	cmp    $0x6,%edx
+  801512:	74 0e                	je     801522 <sys_env_set_status+0x7a>
+  801514:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801517:	0f b6 c9             	movzbl %cl,%ecx
+  80151a:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  801520:	eb 98                	jmp    8014ba <sys_env_set_status+0x12>
+  801522:	89 c2                	mov    %eax,%edx
+  801524:	c1 ea 04             	shr    $0x4,%edx
+  801527:	83 e2 0f             	and    $0xf,%edx
+  80152a:	83 fa 02             	cmp    $0x2,%edx
+  80152d:	77 e5                	ja     801514 <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  80152f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801532:	83 f8 02             	cmp    $0x2,%eax
+  801535:	0f 97 c1             	seta   %cl
+  801538:	0f b6 c9             	movzbl %cl,%ecx
+  80153b:	eb d7                	jmp    801514 <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  80153d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801542:	b8 08 00 00 00       	mov    $0x8,%eax
+  801547:	8b 55 08             	mov    0x8(%ebp),%edx
+  80154a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80154d:	89 df                	mov    %ebx,%edi
+  80154f:	89 de                	mov    %ebx,%esi
+  801551:	cd 30                	int    $0x30
+  801553:	eb 90                	jmp    8014e5 <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801555:	83 ec 0c             	sub    $0xc,%esp
+  801558:	50                   	push   %eax
+  801559:	6a 08                	push   $0x8
+  80155b:	68 39 2d a0 00       	push   $0xa02d39
+  801560:	6a 4a                	push   $0x4a
+  801562:	68 56 2d a0 00       	push   $0xa02d56
+  801567:	e8 54 ec ff ff       	call   8001c0 <_panic>
+
+0080156c <sys_sysinfo>:
+{
+  80156c:	55                   	push   %ebp
+  80156d:	89 e5                	mov    %esp,%ebp
+  80156f:	57                   	push   %edi
+  801570:	56                   	push   %esi
+  801571:	53                   	push   %ebx
+  801572:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801575:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  80157c:	78 36                	js     8015b4 <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  80157e:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  801585:	74 79                	je     801600 <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  801587:	8b 55 08             	mov    0x8(%ebp),%edx
+  80158a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80158f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801594:	89 cb                	mov    %ecx,%ebx
+  801596:	89 cf                	mov    %ecx,%edi
+  801598:	89 ce                	mov    %ecx,%esi
+  80159a:	55                   	push   %ebp
+  80159b:	68 a4 15 80 00       	push   $0x8015a4
+  8015a0:	89 e5                	mov    %esp,%ebp
+  8015a2:	0f 34                	sysenter
+  8015a4:	83 c4 04             	add    $0x4,%esp
+  8015a7:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8015a8:	85 c0                	test   %eax,%eax
+  8015aa:	7f 6b                	jg     801617 <sys_sysinfo+0xab>
+}
+  8015ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015af:	5b                   	pop    %ebx
+  8015b0:	5e                   	pop    %esi
+  8015b1:	5f                   	pop    %edi
+  8015b2:	5d                   	pop    %ebp
+  8015b3:	c3                   	ret
+  8015b4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015b9:	0f a2                	cpuid
+		return 0;
+  8015bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8015c0:	f6 c6 08             	test   $0x8,%dh
+  8015c3:	74 15                	je     8015da <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015c5:	89 c2                	mov    %eax,%edx
+  8015c7:	c1 ea 08             	shr    $0x8,%edx
+  8015ca:	83 e2 0f             	and    $0xf,%edx
+  8015cd:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8015d2:	83 fa 06             	cmp    $0x6,%edx
+  8015d5:	74 0e                	je     8015e5 <sys_sysinfo+0x79>
+  8015d7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8015da:	0f b6 c9             	movzbl %cl,%ecx
+  8015dd:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  8015e3:	eb 99                	jmp    80157e <sys_sysinfo+0x12>
+  8015e5:	89 c2                	mov    %eax,%edx
+  8015e7:	c1 ea 04             	shr    $0x4,%edx
+  8015ea:	83 e2 0f             	and    $0xf,%edx
+  8015ed:	83 fa 02             	cmp    $0x2,%edx
+  8015f0:	77 e5                	ja     8015d7 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  8015f2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015f5:	83 f8 02             	cmp    $0x2,%eax
+  8015f8:	0f 97 c1             	seta   %cl
+  8015fb:	0f b6 c9             	movzbl %cl,%ecx
+  8015fe:	eb d7                	jmp    8015d7 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  801600:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801605:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80160a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80160d:	89 cb                	mov    %ecx,%ebx
+  80160f:	89 cf                	mov    %ecx,%edi
+  801611:	89 ce                	mov    %ecx,%esi
+  801613:	cd 30                	int    $0x30
+  801615:	eb 91                	jmp    8015a8 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801617:	83 ec 0c             	sub    $0xc,%esp
+  80161a:	50                   	push   %eax
+  80161b:	6a 0b                	push   $0xb
+  80161d:	68 39 2d a0 00       	push   $0xa02d39
+  801622:	6a 4a                	push   $0x4a
+  801624:	68 56 2d a0 00       	push   $0xa02d56
+  801629:	e8 92 eb ff ff       	call   8001c0 <_panic>
+
+0080162e <sys_env_set_trapframe>:
+{
+  80162e:	55                   	push   %ebp
+  80162f:	89 e5                	mov    %esp,%ebp
+  801631:	57                   	push   %edi
+  801632:	56                   	push   %esi
+  801633:	53                   	push   %ebx
+  801634:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801637:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  80163e:	78 37                	js     801677 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  801640:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  801647:	74 7a                	je     8016c3 <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  801649:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80164e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801651:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801654:	b8 13 00 00 00       	mov    $0x13,%eax
+  801659:	89 df                	mov    %ebx,%edi
+  80165b:	89 de                	mov    %ebx,%esi
+  80165d:	55                   	push   %ebp
+  80165e:	68 67 16 80 00       	push   $0x801667
+  801663:	89 e5                	mov    %esp,%ebp
+  801665:	0f 34                	sysenter
+  801667:	83 c4 04             	add    $0x4,%esp
+  80166a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80166b:	85 c0                	test   %eax,%eax
+  80166d:	7f 6c                	jg     8016db <sys_env_set_trapframe+0xad>
+}
+  80166f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801672:	5b                   	pop    %ebx
+  801673:	5e                   	pop    %esi
+  801674:	5f                   	pop    %edi
+  801675:	5d                   	pop    %ebp
+  801676:	c3                   	ret
+  801677:	b8 01 00 00 00       	mov    $0x1,%eax
+  80167c:	0f a2                	cpuid
+		return 0;
+  80167e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801683:	f6 c6 08             	test   $0x8,%dh
+  801686:	74 15                	je     80169d <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801688:	89 c2                	mov    %eax,%edx
+  80168a:	c1 ea 08             	shr    $0x8,%edx
+  80168d:	83 e2 0f             	and    $0xf,%edx
+  801690:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801695:	83 fa 06             	cmp    $0x6,%edx
+  801698:	74 0e                	je     8016a8 <sys_env_set_trapframe+0x7a>
+  80169a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80169d:	0f b6 c9             	movzbl %cl,%ecx
+  8016a0:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  8016a6:	eb 98                	jmp    801640 <sys_env_set_trapframe+0x12>
+  8016a8:	89 c2                	mov    %eax,%edx
+  8016aa:	c1 ea 04             	shr    $0x4,%edx
+  8016ad:	83 e2 0f             	and    $0xf,%edx
+  8016b0:	83 fa 02             	cmp    $0x2,%edx
+  8016b3:	77 e5                	ja     80169a <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  8016b5:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016b8:	83 f8 02             	cmp    $0x2,%eax
+  8016bb:	0f 97 c1             	seta   %cl
+  8016be:	0f b6 c9             	movzbl %cl,%ecx
+  8016c1:	eb d7                	jmp    80169a <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  8016c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016c8:	b8 13 00 00 00       	mov    $0x13,%eax
+  8016cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016d3:	89 df                	mov    %ebx,%edi
+  8016d5:	89 de                	mov    %ebx,%esi
+  8016d7:	cd 30                	int    $0x30
+  8016d9:	eb 90                	jmp    80166b <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016db:	83 ec 0c             	sub    $0xc,%esp
+  8016de:	50                   	push   %eax
+  8016df:	6a 13                	push   $0x13
+  8016e1:	68 39 2d a0 00       	push   $0xa02d39
+  8016e6:	6a 4a                	push   $0x4a
+  8016e8:	68 56 2d a0 00       	push   $0xa02d56
+  8016ed:	e8 ce ea ff ff       	call   8001c0 <_panic>
+
+008016f2 <sys_env_set_stack_limit>:
+{
+  8016f2:	55                   	push   %ebp
+  8016f3:	89 e5                	mov    %esp,%ebp
+  8016f5:	57                   	push   %edi
+  8016f6:	56                   	push   %esi
+  8016f7:	53                   	push   %ebx
+  8016f8:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8016fb:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  801702:	78 37                	js     80173b <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  801704:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  80170b:	74 7a                	je     801787 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  80170d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801712:	8b 55 08             	mov    0x8(%ebp),%edx
+  801715:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801718:	b8 19 00 00 00       	mov    $0x19,%eax
+  80171d:	89 df                	mov    %ebx,%edi
+  80171f:	89 de                	mov    %ebx,%esi
+  801721:	55                   	push   %ebp
+  801722:	68 2b 17 80 00       	push   $0x80172b
+  801727:	89 e5                	mov    %esp,%ebp
+  801729:	0f 34                	sysenter
+  80172b:	83 c4 04             	add    $0x4,%esp
+  80172e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80172f:	85 c0                	test   %eax,%eax
+  801731:	7f 6c                	jg     80179f <sys_env_set_stack_limit+0xad>
+}
+  801733:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801736:	5b                   	pop    %ebx
+  801737:	5e                   	pop    %esi
+  801738:	5f                   	pop    %edi
+  801739:	5d                   	pop    %ebp
+  80173a:	c3                   	ret
+  80173b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801740:	0f a2                	cpuid
+		return 0;
+  801742:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801747:	f6 c6 08             	test   $0x8,%dh
+  80174a:	74 15                	je     801761 <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80174c:	89 c2                	mov    %eax,%edx
+  80174e:	c1 ea 08             	shr    $0x8,%edx
+  801751:	83 e2 0f             	and    $0xf,%edx
+  801754:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801759:	83 fa 06             	cmp    $0x6,%edx
+  80175c:	74 0e                	je     80176c <sys_env_set_stack_limit+0x7a>
+  80175e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801761:	0f b6 c9             	movzbl %cl,%ecx
+  801764:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  80176a:	eb 98                	jmp    801704 <sys_env_set_stack_limit+0x12>
+  80176c:	89 c2                	mov    %eax,%edx
+  80176e:	c1 ea 04             	shr    $0x4,%edx
+  801771:	83 e2 0f             	and    $0xf,%edx
+  801774:	83 fa 02             	cmp    $0x2,%edx
+  801777:	77 e5                	ja     80175e <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  801779:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80177c:	83 f8 02             	cmp    $0x2,%eax
+  80177f:	0f 97 c1             	seta   %cl
+  801782:	0f b6 c9             	movzbl %cl,%ecx
+  801785:	eb d7                	jmp    80175e <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  801787:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80178c:	b8 19 00 00 00       	mov    $0x19,%eax
+  801791:	8b 55 08             	mov    0x8(%ebp),%edx
+  801794:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801797:	89 df                	mov    %ebx,%edi
+  801799:	89 de                	mov    %ebx,%esi
+  80179b:	cd 30                	int    $0x30
+  80179d:	eb 90                	jmp    80172f <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80179f:	83 ec 0c             	sub    $0xc,%esp
+  8017a2:	50                   	push   %eax
+  8017a3:	6a 19                	push   $0x19
+  8017a5:	68 39 2d a0 00       	push   $0xa02d39
+  8017aa:	6a 4a                	push   $0x4a
+  8017ac:	68 56 2d a0 00       	push   $0xa02d56
+  8017b1:	e8 0a ea ff ff       	call   8001c0 <_panic>
+
+008017b6 <sys_env_set_pgfault_upcall>:
+{
+  8017b6:	55                   	push   %ebp
+  8017b7:	89 e5                	mov    %esp,%ebp
+  8017b9:	57                   	push   %edi
+  8017ba:	56                   	push   %esi
+  8017bb:	53                   	push   %ebx
+  8017bc:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8017bf:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  8017c6:	78 37                	js     8017ff <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  8017c8:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  8017cf:	74 7a                	je     80184b <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  8017d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017dc:	b8 09 00 00 00       	mov    $0x9,%eax
+  8017e1:	89 df                	mov    %ebx,%edi
+  8017e3:	89 de                	mov    %ebx,%esi
+  8017e5:	55                   	push   %ebp
+  8017e6:	68 ef 17 80 00       	push   $0x8017ef
+  8017eb:	89 e5                	mov    %esp,%ebp
+  8017ed:	0f 34                	sysenter
+  8017ef:	83 c4 04             	add    $0x4,%esp
+  8017f2:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8017f3:	85 c0                	test   %eax,%eax
+  8017f5:	7f 6c                	jg     801863 <sys_env_set_pgfault_upcall+0xad>
+}
+  8017f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017fa:	5b                   	pop    %ebx
+  8017fb:	5e                   	pop    %esi
+  8017fc:	5f                   	pop    %edi
+  8017fd:	5d                   	pop    %ebp
+  8017fe:	c3                   	ret
+  8017ff:	b8 01 00 00 00       	mov    $0x1,%eax
+  801804:	0f a2                	cpuid
+		return 0;
+  801806:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80180b:	f6 c6 08             	test   $0x8,%dh
+  80180e:	74 15                	je     801825 <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801810:	89 c2                	mov    %eax,%edx
+  801812:	c1 ea 08             	shr    $0x8,%edx
+  801815:	83 e2 0f             	and    $0xf,%edx
+  801818:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80181d:	83 fa 06             	cmp    $0x6,%edx
+  801820:	74 0e                	je     801830 <sys_env_set_pgfault_upcall+0x7a>
+  801822:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801825:	0f b6 c9             	movzbl %cl,%ecx
+  801828:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  80182e:	eb 98                	jmp    8017c8 <sys_env_set_pgfault_upcall+0x12>
+  801830:	89 c2                	mov    %eax,%edx
+  801832:	c1 ea 04             	shr    $0x4,%edx
+  801835:	83 e2 0f             	and    $0xf,%edx
+  801838:	83 fa 02             	cmp    $0x2,%edx
+  80183b:	77 e5                	ja     801822 <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  80183d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801840:	83 f8 02             	cmp    $0x2,%eax
+  801843:	0f 97 c1             	seta   %cl
+  801846:	0f b6 c9             	movzbl %cl,%ecx
+  801849:	eb d7                	jmp    801822 <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  80184b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801850:	b8 09 00 00 00       	mov    $0x9,%eax
+  801855:	8b 55 08             	mov    0x8(%ebp),%edx
+  801858:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80185b:	89 df                	mov    %ebx,%edi
+  80185d:	89 de                	mov    %ebx,%esi
+  80185f:	cd 30                	int    $0x30
+  801861:	eb 90                	jmp    8017f3 <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801863:	83 ec 0c             	sub    $0xc,%esp
+  801866:	50                   	push   %eax
+  801867:	6a 09                	push   $0x9
+  801869:	68 39 2d a0 00       	push   $0xa02d39
+  80186e:	6a 4a                	push   $0x4a
+  801870:	68 56 2d a0 00       	push   $0xa02d56
+  801875:	e8 46 e9 ff ff       	call   8001c0 <_panic>
+
+0080187a <sys_ipc_try_send>:
+{
+  80187a:	55                   	push   %ebp
+  80187b:	89 e5                	mov    %esp,%ebp
+  80187d:	57                   	push   %edi
+  80187e:	56                   	push   %esi
+  80187f:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801880:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  801887:	78 32                	js     8018bb <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  801889:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  801890:	74 75                	je     801907 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801892:	8b 55 08             	mov    0x8(%ebp),%edx
+  801895:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801898:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80189d:	be 00 00 00 00       	mov    $0x0,%esi
+  8018a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018a5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8018a8:	55                   	push   %ebp
+  8018a9:	68 b2 18 80 00       	push   $0x8018b2
+  8018ae:	89 e5                	mov    %esp,%ebp
+  8018b0:	0f 34                	sysenter
+  8018b2:	83 c4 04             	add    $0x4,%esp
+  8018b5:	5d                   	pop    %ebp
+}
+  8018b6:	5b                   	pop    %ebx
+  8018b7:	5e                   	pop    %esi
+  8018b8:	5f                   	pop    %edi
+  8018b9:	5d                   	pop    %ebp
+  8018ba:	c3                   	ret
+  8018bb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018c0:	0f a2                	cpuid
+		return 0;
+  8018c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018c7:	f6 c6 08             	test   $0x8,%dh
+  8018ca:	74 15                	je     8018e1 <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018cc:	89 c2                	mov    %eax,%edx
+  8018ce:	c1 ea 08             	shr    $0x8,%edx
+  8018d1:	83 e2 0f             	and    $0xf,%edx
+  8018d4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018d9:	83 fa 06             	cmp    $0x6,%edx
+  8018dc:	74 0e                	je     8018ec <sys_ipc_try_send+0x72>
+  8018de:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8018e1:	0f b6 c9             	movzbl %cl,%ecx
+  8018e4:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  8018ea:	eb 9d                	jmp    801889 <sys_ipc_try_send+0xf>
+  8018ec:	89 c2                	mov    %eax,%edx
+  8018ee:	c1 ea 04             	shr    $0x4,%edx
+  8018f1:	83 e2 0f             	and    $0xf,%edx
+  8018f4:	83 fa 02             	cmp    $0x2,%edx
+  8018f7:	77 e5                	ja     8018de <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  8018f9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018fc:	83 f8 02             	cmp    $0x2,%eax
+  8018ff:	0f 97 c1             	seta   %cl
+  801902:	0f b6 c9             	movzbl %cl,%ecx
+  801905:	eb d7                	jmp    8018de <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  801907:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80190c:	be 00 00 00 00       	mov    $0x0,%esi
+  801911:	8b 55 08             	mov    0x8(%ebp),%edx
+  801914:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801917:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80191a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80191d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  80191f:	eb 95                	jmp    8018b6 <sys_ipc_try_send+0x3c>
+
+00801921 <sys_ipc_send>:
+{
+  801921:	55                   	push   %ebp
+  801922:	89 e5                	mov    %esp,%ebp
+  801924:	57                   	push   %edi
+  801925:	56                   	push   %esi
+  801926:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801927:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  80192e:	78 32                	js     801962 <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  801930:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  801937:	74 75                	je     8019ae <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801939:	8b 55 08             	mov    0x8(%ebp),%edx
+  80193c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80193f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801944:	be 00 00 00 00       	mov    $0x0,%esi
+  801949:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80194c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80194f:	55                   	push   %ebp
+  801950:	68 59 19 80 00       	push   $0x801959
+  801955:	89 e5                	mov    %esp,%ebp
+  801957:	0f 34                	sysenter
+  801959:	83 c4 04             	add    $0x4,%esp
+  80195c:	5d                   	pop    %ebp
+}
+  80195d:	5b                   	pop    %ebx
+  80195e:	5e                   	pop    %esi
+  80195f:	5f                   	pop    %edi
+  801960:	5d                   	pop    %ebp
+  801961:	c3                   	ret
+  801962:	b8 01 00 00 00       	mov    $0x1,%eax
+  801967:	0f a2                	cpuid
+		return 0;
+  801969:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80196e:	f6 c6 08             	test   $0x8,%dh
+  801971:	74 15                	je     801988 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801973:	89 c2                	mov    %eax,%edx
+  801975:	c1 ea 08             	shr    $0x8,%edx
+  801978:	83 e2 0f             	and    $0xf,%edx
+  80197b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801980:	83 fa 06             	cmp    $0x6,%edx
+  801983:	74 0e                	je     801993 <sys_ipc_send+0x72>
+  801985:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801988:	0f b6 c9             	movzbl %cl,%ecx
+  80198b:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  801991:	eb 9d                	jmp    801930 <sys_ipc_send+0xf>
+  801993:	89 c2                	mov    %eax,%edx
+  801995:	c1 ea 04             	shr    $0x4,%edx
+  801998:	83 e2 0f             	and    $0xf,%edx
+  80199b:	83 fa 02             	cmp    $0x2,%edx
+  80199e:	77 e5                	ja     801985 <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  8019a0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019a3:	83 f8 02             	cmp    $0x2,%eax
+  8019a6:	0f 97 c1             	seta   %cl
+  8019a9:	0f b6 c9             	movzbl %cl,%ecx
+  8019ac:	eb d7                	jmp    801985 <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  8019ae:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8019b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8019b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019be:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019c1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8019c4:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  8019c6:	eb 95                	jmp    80195d <sys_ipc_send+0x3c>
+
+008019c8 <sys_ipc_recv>:
+{
+  8019c8:	55                   	push   %ebp
+  8019c9:	89 e5                	mov    %esp,%ebp
+  8019cb:	57                   	push   %edi
+  8019cc:	56                   	push   %esi
+  8019cd:	53                   	push   %ebx
+  8019ce:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8019d1:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  8019d8:	78 36                	js     801a10 <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  8019da:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  8019e1:	74 79                	je     801a5c <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  8019e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019eb:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8019f0:	89 cb                	mov    %ecx,%ebx
+  8019f2:	89 cf                	mov    %ecx,%edi
+  8019f4:	89 ce                	mov    %ecx,%esi
+  8019f6:	55                   	push   %ebp
+  8019f7:	68 00 1a 80 00       	push   $0x801a00
+  8019fc:	89 e5                	mov    %esp,%ebp
+  8019fe:	0f 34                	sysenter
+  801a00:	83 c4 04             	add    $0x4,%esp
+  801a03:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801a04:	85 c0                	test   %eax,%eax
+  801a06:	7f 6b                	jg     801a73 <sys_ipc_recv+0xab>
+}
+  801a08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a0b:	5b                   	pop    %ebx
+  801a0c:	5e                   	pop    %esi
+  801a0d:	5f                   	pop    %edi
+  801a0e:	5d                   	pop    %ebp
+  801a0f:	c3                   	ret
+  801a10:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a15:	0f a2                	cpuid
+		return 0;
+  801a17:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801a1c:	f6 c6 08             	test   $0x8,%dh
+  801a1f:	74 15                	je     801a36 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a21:	89 c2                	mov    %eax,%edx
+  801a23:	c1 ea 08             	shr    $0x8,%edx
+  801a26:	83 e2 0f             	and    $0xf,%edx
+  801a29:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a2e:	83 fa 06             	cmp    $0x6,%edx
+  801a31:	74 0e                	je     801a41 <sys_ipc_recv+0x79>
+  801a33:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a36:	0f b6 c9             	movzbl %cl,%ecx
+  801a39:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  801a3f:	eb 99                	jmp    8019da <sys_ipc_recv+0x12>
+  801a41:	89 c2                	mov    %eax,%edx
+  801a43:	c1 ea 04             	shr    $0x4,%edx
+  801a46:	83 e2 0f             	and    $0xf,%edx
+  801a49:	83 fa 02             	cmp    $0x2,%edx
+  801a4c:	77 e5                	ja     801a33 <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  801a4e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a51:	83 f8 02             	cmp    $0x2,%eax
+  801a54:	0f 97 c1             	seta   %cl
+  801a57:	0f b6 c9             	movzbl %cl,%ecx
+  801a5a:	eb d7                	jmp    801a33 <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  801a5c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a61:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801a66:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a69:	89 cb                	mov    %ecx,%ebx
+  801a6b:	89 cf                	mov    %ecx,%edi
+  801a6d:	89 ce                	mov    %ecx,%esi
+  801a6f:	cd 30                	int    $0x30
+  801a71:	eb 91                	jmp    801a04 <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a73:	83 ec 0c             	sub    $0xc,%esp
+  801a76:	50                   	push   %eax
+  801a77:	6a 0d                	push   $0xd
+  801a79:	68 39 2d a0 00       	push   $0xa02d39
+  801a7e:	6a 4a                	push   $0x4a
+  801a80:	68 56 2d a0 00       	push   $0xa02d56
+  801a85:	e8 36 e7 ff ff       	call   8001c0 <_panic>
+
+00801a8a <sys_ipc_send_range>:
+{
+  801a8a:	55                   	push   %ebp
+  801a8b:	89 e5                	mov    %esp,%ebp
+  801a8d:	57                   	push   %edi
+  801a8e:	56                   	push   %esi
+  801a8f:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801a90:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  801a97:	78 30                	js     801ac9 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  801a99:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  801aa0:	74 73                	je     801b15 <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801aa2:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aa5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801aa8:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801aad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ab0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ab3:	8b 75 18             	mov    0x18(%ebp),%esi
+  801ab6:	55                   	push   %ebp
+  801ab7:	68 c0 1a 80 00       	push   $0x801ac0
+  801abc:	89 e5                	mov    %esp,%ebp
+  801abe:	0f 34                	sysenter
+  801ac0:	83 c4 04             	add    $0x4,%esp
+  801ac3:	5d                   	pop    %ebp
+}
+  801ac4:	5b                   	pop    %ebx
+  801ac5:	5e                   	pop    %esi
+  801ac6:	5f                   	pop    %edi
+  801ac7:	5d                   	pop    %ebp
+  801ac8:	c3                   	ret
+  801ac9:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ace:	0f a2                	cpuid
+		return 0;
+  801ad0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801ad5:	f6 c6 08             	test   $0x8,%dh
+  801ad8:	74 15                	je     801aef <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ada:	89 c2                	mov    %eax,%edx
+  801adc:	c1 ea 08             	shr    $0x8,%edx
+  801adf:	83 e2 0f             	and    $0xf,%edx
+  801ae2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ae7:	83 fa 06             	cmp    $0x6,%edx
+  801aea:	74 0e                	je     801afa <sys_ipc_send_range+0x70>
+  801aec:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801aef:	0f b6 c9             	movzbl %cl,%ecx
+  801af2:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  801af8:	eb 9f                	jmp    801a99 <sys_ipc_send_range+0xf>
+  801afa:	89 c2                	mov    %eax,%edx
+  801afc:	c1 ea 04             	shr    $0x4,%edx
+  801aff:	83 e2 0f             	and    $0xf,%edx
+  801b02:	83 fa 02             	cmp    $0x2,%edx
+  801b05:	77 e5                	ja     801aec <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  801b07:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b0a:	83 f8 02             	cmp    $0x2,%eax
+  801b0d:	0f 97 c1             	seta   %cl
+  801b10:	0f b6 c9             	movzbl %cl,%ecx
+  801b13:	eb d7                	jmp    801aec <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  801b15:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801b1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b1d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b20:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b23:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801b26:	8b 75 18             	mov    0x18(%ebp),%esi
+  801b29:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  801b2b:	eb 97                	jmp    801ac4 <sys_ipc_send_range+0x3a>
+
+00801b2d <sys_ipc_recv_range>:
+{
+  801b2d:	55                   	push   %ebp
+  801b2e:	89 e5                	mov    %esp,%ebp
+  801b30:	57                   	push   %edi
+  801b31:	56                   	push   %esi
+  801b32:	53                   	push   %ebx
+  801b33:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801b36:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  801b3d:	78 37                	js     801b76 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  801b3f:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  801b46:	74 7a                	je     801bc2 <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  801b48:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b4d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b50:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b53:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801b58:	89 df                	mov    %ebx,%edi
+  801b5a:	89 de                	mov    %ebx,%esi
+  801b5c:	55                   	push   %ebp
+  801b5d:	68 66 1b 80 00       	push   $0x801b66
+  801b62:	89 e5                	mov    %esp,%ebp
+  801b64:	0f 34                	sysenter
+  801b66:	83 c4 04             	add    $0x4,%esp
+  801b69:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801b6a:	85 c0                	test   %eax,%eax
+  801b6c:	7f 6c                	jg     801bda <sys_ipc_recv_range+0xad>
+}
+  801b6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b71:	5b                   	pop    %ebx
+  801b72:	5e                   	pop    %esi
+  801b73:	5f                   	pop    %edi
+  801b74:	5d                   	pop    %ebp
+  801b75:	c3                   	ret
+  801b76:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b7b:	0f a2                	cpuid
+		return 0;
+  801b7d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b82:	f6 c6 08             	test   $0x8,%dh
+  801b85:	74 15                	je     801b9c <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b87:	89 c2                	mov    %eax,%edx
+  801b89:	c1 ea 08             	shr    $0x8,%edx
+  801b8c:	83 e2 0f             	and    $0xf,%edx
+  801b8f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b94:	83 fa 06             	cmp    $0x6,%edx
+  801b97:	74 0e                	je     801ba7 <sys_ipc_recv_range+0x7a>
+  801b99:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b9c:	0f b6 c9             	movzbl %cl,%ecx
+  801b9f:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  801ba5:	eb 98                	jmp    801b3f <sys_ipc_recv_range+0x12>
+  801ba7:	89 c2                	mov    %eax,%edx
+  801ba9:	c1 ea 04             	shr    $0x4,%edx
+  801bac:	83 e2 0f             	and    $0xf,%edx
+  801baf:	83 fa 02             	cmp    $0x2,%edx
+  801bb2:	77 e5                	ja     801b99 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801bb4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bb7:	83 f8 02             	cmp    $0x2,%eax
+  801bba:	0f 97 c1             	seta   %cl
+  801bbd:	0f b6 c9             	movzbl %cl,%ecx
+  801bc0:	eb d7                	jmp    801b99 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801bc2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bc7:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801bcc:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bcf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bd2:	89 df                	mov    %ebx,%edi
+  801bd4:	89 de                	mov    %ebx,%esi
+  801bd6:	cd 30                	int    $0x30
+  801bd8:	eb 90                	jmp    801b6a <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801bda:	83 ec 0c             	sub    $0xc,%esp
+  801bdd:	50                   	push   %eax
+  801bde:	6a 1f                	push   $0x1f
+  801be0:	68 39 2d a0 00       	push   $0xa02d39
+  801be5:	6a 4a                	push   $0x4a
+  801be7:	68 56 2d a0 00       	push   $0xa02d56
+  801bec:	e8 cf e5 ff ff       	call   8001c0 <_panic>
+
+00801bf1 <sys_ipc_call>:
+{
+  801bf1:	55                   	push   %ebp
+  801bf2:	89 e5                	mov    %esp,%ebp
+  801bf4:	57                   	push   %edi
+  801bf5:	56                   	push   %esi
+  801bf6:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801bf7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bfa:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801bff:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801c02:	55                   	push   %ebp
+  801c03:	56                   	push   %esi
+  801c04:	8b 0e                	mov    (%esi),%ecx
+  801c06:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801c09:	8b 7e 08             	mov    0x8(%esi),%edi
+  801c0c:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801c0f:	8b 76 0c             	mov    0xc(%esi),%esi
+  801c12:	cd 30                	int    $0x30
+  801c14:	87 34 24             	xchg   %esi,(%esp)
+  801c17:	89 0e                	mov    %ecx,(%esi)
+  801c19:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801c1c:	89 7e 08             	mov    %edi,0x8(%esi)
+  801c1f:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801c22:	8f 46 0c             	pop    0xc(%esi)
+  801c25:	5d                   	pop    %ebp
+}
+  801c26:	5b                   	pop    %ebx
+  801c27:	5e                   	pop    %esi
+  801c28:	5f                   	pop    %edi
+  801c29:	5d                   	pop    %ebp
+  801c2a:	c3                   	ret
+
+00801c2b <sys_ipc_reply_wait>:
+{
+  801c2b:	55                   	push   %ebp
+  801c2c:	89 e5                	mov    %esp,%ebp
+  801c2e:	57                   	push   %edi
+  801c2f:	56                   	push   %esi
+  801c30:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801c31:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c34:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801c39:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801c3c:	55                   	push   %ebp
+  801c3d:	56                   	push   %esi
+  801c3e:	8b 0e                	mov    (%esi),%ecx
+  801c40:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801c43:	8b 7e 08             	mov    0x8(%esi),%edi
+  801c46:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801c49:	8b 76 0c             	mov    0xc(%esi),%esi
+  801c4c:	cd 30                	int    $0x30
+  801c4e:	87 34 24             	xchg   %esi,(%esp)
+  801c51:	89 0e                	mov    %ecx,(%esi)
+  801c53:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801c56:	89 7e 08             	mov    %edi,0x8(%esi)
+  801c59:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801c5c:	8f 46 0c             	pop    0xc(%esi)
+  801c5f:	5d                   	pop    %ebp
+}
+  801c60:	5b                   	pop    %ebx
+  801c61:	5e                   	pop    %esi
+  801c62:	5f                   	pop    %edi
+  801c63:	5d                   	pop    %ebp
+  801c64:	c3                   	ret
+
+00801c65 <sys_ipc_send_msg>:
+{
+  801c65:	55                   	push   %ebp
+  801c66:	89 e5                	mov    %esp,%ebp
+  801c68:	57                   	push   %edi
+  801c69:	56                   	push   %esi
+  801c6a:	53                   	push   %ebx
+  801c6b:	83 ec 20             	sub    $0x20,%esp
+  801c6e:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801c71:	8b 10                	mov    (%eax),%edx
+  801c73:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801c76:	8b 50 04             	mov    0x4(%eax),%edx
+  801c79:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801c7c:	8b 50 08             	mov    0x8(%eax),%edx
+  801c7f:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801c82:	8b 50 0c             	mov    0xc(%eax),%edx
+  801c85:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801c88:	8b 40 10             	mov    0x10(%eax),%eax
+  801c8b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801c8e:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801c91:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c94:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801c99:	55                   	push   %ebp
+  801c9a:	56                   	push   %esi
+  801c9b:	8b 0e                	mov    (%esi),%ecx
+  801c9d:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801ca0:	8b 7e 08             	mov    0x8(%esi),%edi
+  801ca3:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801ca6:	8b 76 0c             	mov    0xc(%esi),%esi
+  801ca9:	cd 30                	int    $0x30
+  801cab:	87 34 24             	xchg   %esi,(%esp)
+  801cae:	89 0e                	mov    %ecx,(%esi)
+  801cb0:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801cb3:	89 7e 08             	mov    %edi,0x8(%esi)
+  801cb6:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801cb9:	8f 46 0c             	pop    0xc(%esi)
+  801cbc:	5d                   	pop    %ebp
+}
+  801cbd:	83 c4 20             	add    $0x20,%esp
+  801cc0:	5b                   	pop    %ebx
+  801cc1:	5e                   	pop    %esi
+  801cc2:	5f                   	pop    %edi
+  801cc3:	5d                   	pop    %ebp
+  801cc4:	c3                   	ret
+
+00801cc5 <sys_fork>:
+{
+  801cc5:	55                   	push   %ebp
+  801cc6:	89 e5                	mov    %esp,%ebp
+  801cc8:	57                   	push   %edi
+  801cc9:	56                   	push   %esi
+  801cca:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801ccb:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  801cd2:	78 2e                	js     801d02 <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801cd4:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  801cdb:	74 71                	je     801d4e <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801cdd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ce2:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801ce7:	89 d1                	mov    %edx,%ecx
+  801ce9:	89 d3                	mov    %edx,%ebx
+  801ceb:	89 d7                	mov    %edx,%edi
+  801ced:	89 d6                	mov    %edx,%esi
+  801cef:	55                   	push   %ebp
+  801cf0:	68 f9 1c 80 00       	push   $0x801cf9
+  801cf5:	89 e5                	mov    %esp,%ebp
+  801cf7:	0f 34                	sysenter
+  801cf9:	83 c4 04             	add    $0x4,%esp
+  801cfc:	5d                   	pop    %ebp
+}
+  801cfd:	5b                   	pop    %ebx
+  801cfe:	5e                   	pop    %esi
+  801cff:	5f                   	pop    %edi
+  801d00:	5d                   	pop    %ebp
+  801d01:	c3                   	ret
+  801d02:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d07:	0f a2                	cpuid
+		return 0;
+  801d09:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801d0e:	f6 c6 08             	test   $0x8,%dh
+  801d11:	74 15                	je     801d28 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d13:	89 c2                	mov    %eax,%edx
+  801d15:	c1 ea 08             	shr    $0x8,%edx
+  801d18:	83 e2 0f             	and    $0xf,%edx
+  801d1b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d20:	83 fa 06             	cmp    $0x6,%edx
+  801d23:	74 0e                	je     801d33 <sys_fork+0x6e>
+  801d25:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801d28:	0f b6 c9             	movzbl %cl,%ecx
+  801d2b:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  801d31:	eb a1                	jmp    801cd4 <sys_fork+0xf>
+  801d33:	89 c2                	mov    %eax,%edx
+  801d35:	c1 ea 04             	shr    $0x4,%edx
+  801d38:	83 e2 0f             	and    $0xf,%edx
+  801d3b:	83 fa 02             	cmp    $0x2,%edx
+  801d3e:	77 e5                	ja     801d25 <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801d40:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d43:	83 f8 02             	cmp    $0x2,%eax
+  801d46:	0f 97 c1             	seta   %cl
+  801d49:	0f b6 c9             	movzbl %cl,%ecx
+  801d4c:	eb d7                	jmp    801d25 <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801d4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d53:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801d58:	89 d1                	mov    %edx,%ecx
+  801d5a:	89 d3                	mov    %edx,%ebx
+  801d5c:	89 d7                	mov    %edx,%edi
+  801d5e:	89 d6                	mov    %edx,%esi
+  801d60:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801d62:	eb 99                	jmp    801cfd <sys_fork+0x38>
+
+00801d64 <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801d64:	55                   	push   %ebp
+  801d65:	89 e5                	mov    %esp,%ebp
+  801d67:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801d6a:	ff 75 14             	push   0x14(%ebp)
+  801d6d:	ff 75 10             	push   0x10(%ebp)
+  801d70:	ff 75 0c             	push   0xc(%ebp)
+  801d73:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d78:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d7b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801d80:	e8 81 ee ff ff       	call   800c06 <page_vec_call>
+}
+  801d85:	c9                   	leave
+  801d86:	c3                   	ret
+
+00801d87 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801d87:	55                   	push   %ebp
+  801d88:	89 e5                	mov    %esp,%ebp
+  801d8a:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801d8d:	ff 75 18             	push   0x18(%ebp)
+  801d90:	ff 75 14             	push   0x14(%ebp)
+  801d93:	ff 75 10             	push   0x10(%ebp)
+  801d96:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d99:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d9c:	b8 10 00 00 00       	mov    $0x10,%eax
+  801da1:	e8 60 ee ff ff       	call   800c06 <page_vec_call>
+}
+  801da6:	c9                   	leave
+  801da7:	c3                   	ret
+
+00801da8 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801da8:	55                   	push   %ebp
+  801da9:	89 e5                	mov    %esp,%ebp
+  801dab:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801dae:	ff 75 14             	push   0x14(%ebp)
+  801db1:	ff 75 10             	push   0x10(%ebp)
+  801db4:	ff 75 0c             	push   0xc(%ebp)
+  801db7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801dbc:	8b 55 08             	mov    0x8(%ebp),%edx
+  801dbf:	b8 11 00 00 00       	mov    $0x11,%eax
+  801dc4:	e8 3d ee ff ff       	call   800c06 <page_vec_call>
+}
+  801dc9:	c9                   	leave
+  801dca:	c3                   	ret
+
+00801dcb <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801dcb:	55                   	push   %ebp
+  801dcc:	89 e5                	mov    %esp,%ebp
+  801dce:	57                   	push   %edi
+  801dcf:	56                   	push   %esi
+  801dd0:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801dd1:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  801dd8:	78 32                	js     801e0c <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801dda:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  801de1:	74 75                	je     801e58 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801de3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801de6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801de9:	b8 12 00 00 00       	mov    $0x12,%eax
+  801dee:	be 00 00 00 00       	mov    $0x0,%esi
+  801df3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801df6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801df9:	55                   	push   %ebp
+  801dfa:	68 03 1e 80 00       	push   $0x801e03
+  801dff:	89 e5                	mov    %esp,%ebp
+  801e01:	0f 34                	sysenter
+  801e03:	83 c4 04             	add    $0x4,%esp
+  801e06:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801e07:	5b                   	pop    %ebx
+  801e08:	5e                   	pop    %esi
+  801e09:	5f                   	pop    %edi
+  801e0a:	5d                   	pop    %ebp
+  801e0b:	c3                   	ret
+  801e0c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e11:	0f a2                	cpuid
+		return 0;
+  801e13:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801e18:	f6 c6 08             	test   $0x8,%dh
+  801e1b:	74 15                	je     801e32 <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e1d:	89 c2                	mov    %eax,%edx
+  801e1f:	c1 ea 08             	shr    $0x8,%edx
+  801e22:	83 e2 0f             	and    $0xf,%edx
+  801e25:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e2a:	83 fa 06             	cmp    $0x6,%edx
+  801e2d:	74 0e                	je     801e3d <sys_vm_ranges+0x72>
+  801e2f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801e32:	0f b6 c9             	movzbl %cl,%ecx
+  801e35:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  801e3b:	eb 9d                	jmp    801dda <sys_vm_ranges+0xf>
+  801e3d:	89 c2                	mov    %eax,%edx
+  801e3f:	c1 ea 04             	shr    $0x4,%edx
+  801e42:	83 e2 0f             	and    $0xf,%edx
+  801e45:	83 fa 02             	cmp    $0x2,%edx
+  801e48:	77 e5                	ja     801e2f <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  801e4a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e4d:	83 f8 02             	cmp    $0x2,%eax
+  801e50:	0f 97 c1             	seta   %cl
+  801e53:	0f b6 c9             	movzbl %cl,%ecx
+  801e56:	eb d7                	jmp    801e2f <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801e58:	b8 12 00 00 00       	mov    $0x12,%eax
+  801e5d:	be 00 00 00 00       	mov    $0x0,%esi
+  801e62:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e65:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e68:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e6b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801e6e:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801e70:	eb 95                	jmp    801e07 <sys_vm_ranges+0x3c>
+
+00801e72 <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801e72:	55                   	push   %ebp
+  801e73:	89 e5                	mov    %esp,%ebp
+  801e75:	57                   	push   %edi
+  801e76:	56                   	push   %esi
+  801e77:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801e78:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  801e7f:	78 31                	js     801eb2 <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801e81:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  801e88:	74 74                	je     801efe <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801e8a:	be 00 00 00 00       	mov    $0x0,%esi
+  801e8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e92:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e95:	b8 14 00 00 00       	mov    $0x14,%eax
+  801e9a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e9d:	89 f7                	mov    %esi,%edi
+  801e9f:	55                   	push   %ebp
+  801ea0:	68 a9 1e 80 00       	push   $0x801ea9
+  801ea5:	89 e5                	mov    %esp,%ebp
+  801ea7:	0f 34                	sysenter
+  801ea9:	83 c4 04             	add    $0x4,%esp
+  801eac:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801ead:	5b                   	pop    %ebx
+  801eae:	5e                   	pop    %esi
+  801eaf:	5f                   	pop    %edi
+  801eb0:	5d                   	pop    %ebp
+  801eb1:	c3                   	ret
+  801eb2:	b8 01 00 00 00       	mov    $0x1,%eax
+  801eb7:	0f a2                	cpuid
+		return 0;
+  801eb9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801ebe:	f6 c6 08             	test   $0x8,%dh
+  801ec1:	74 15                	je     801ed8 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ec3:	89 c2                	mov    %eax,%edx
+  801ec5:	c1 ea 08             	shr    $0x8,%edx
+  801ec8:	83 e2 0f             	and    $0xf,%edx
+  801ecb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ed0:	83 fa 06             	cmp    $0x6,%edx
+  801ed3:	74 0e                	je     801ee3 <sys_spawn+0x71>
+  801ed5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801ed8:	0f b6 c9             	movzbl %cl,%ecx
+  801edb:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  801ee1:	eb 9e                	jmp    801e81 <sys_spawn+0xf>
+  801ee3:	89 c2                	mov    %eax,%edx
+  801ee5:	c1 ea 04             	shr    $0x4,%edx
+  801ee8:	83 e2 0f             	and    $0xf,%edx
+  801eeb:	83 fa 02             	cmp    $0x2,%edx
+  801eee:	77 e5                	ja     801ed5 <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  801ef0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ef3:	83 f8 02             	cmp    $0x2,%eax
+  801ef6:	0f 97 c1             	seta   %cl
+  801ef9:	0f b6 c9             	movzbl %cl,%ecx
+  801efc:	eb d7                	jmp    801ed5 <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  801efe:	be 00 00 00 00       	mov    $0x0,%esi
+  801f03:	b8 14 00 00 00       	mov    $0x14,%eax
+  801f08:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f0b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f0e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f11:	89 f7                	mov    %esi,%edi
+  801f13:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  801f15:	eb 96                	jmp    801ead <sys_spawn+0x3b>
+
+00801f17 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  801f17:	55                   	push   %ebp
+  801f18:	89 e5                	mov    %esp,%ebp
+  801f1a:	57                   	push   %edi
+  801f1b:	56                   	push   %esi
+  801f1c:	53                   	push   %ebx
+  801f1d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801f20:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  801f27:	78 37                	js     801f60 <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  801f29:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  801f30:	74 7a                	je     801fac <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  801f32:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f37:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f3a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f3d:	b8 15 00 00 00       	mov    $0x15,%eax
+  801f42:	89 df                	mov    %ebx,%edi
+  801f44:	89 de                	mov    %ebx,%esi
+  801f46:	55                   	push   %ebp
+  801f47:	68 50 1f 80 00       	push   $0x801f50
+  801f4c:	89 e5                	mov    %esp,%ebp
+  801f4e:	0f 34                	sysenter
+  801f50:	83 c4 04             	add    $0x4,%esp
+  801f53:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801f54:	85 c0                	test   %eax,%eax
+  801f56:	7f 6c                	jg     801fc4 <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  801f58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f5b:	5b                   	pop    %ebx
+  801f5c:	5e                   	pop    %esi
+  801f5d:	5f                   	pop    %edi
+  801f5e:	5d                   	pop    %ebp
+  801f5f:	c3                   	ret
+  801f60:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f65:	0f a2                	cpuid
+		return 0;
+  801f67:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801f6c:	f6 c6 08             	test   $0x8,%dh
+  801f6f:	74 15                	je     801f86 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f71:	89 c2                	mov    %eax,%edx
+  801f73:	c1 ea 08             	shr    $0x8,%edx
+  801f76:	83 e2 0f             	and    $0xf,%edx
+  801f79:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f7e:	83 fa 06             	cmp    $0x6,%edx
+  801f81:	74 0e                	je     801f91 <sys_shm_create+0x7a>
+  801f83:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801f86:	0f b6 c9             	movzbl %cl,%ecx
+  801f89:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  801f8f:	eb 98                	jmp    801f29 <sys_shm_create+0x12>
+  801f91:	89 c2                	mov    %eax,%edx
+  801f93:	c1 ea 04             	shr    $0x4,%edx
+  801f96:	83 e2 0f             	and    $0xf,%edx
+  801f99:	83 fa 02             	cmp    $0x2,%edx
+  801f9c:	77 e5                	ja     801f83 <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  801f9e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fa1:	83 f8 02             	cmp    $0x2,%eax
+  801fa4:	0f 97 c1             	seta   %cl
+  801fa7:	0f b6 c9             	movzbl %cl,%ecx
+  801faa:	eb d7                	jmp    801f83 <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  801fac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fb1:	b8 15 00 00 00       	mov    $0x15,%eax
+  801fb6:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fb9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fbc:	89 df                	mov    %ebx,%edi
+  801fbe:	89 de                	mov    %ebx,%esi
+  801fc0:	cd 30                	int    $0x30
+  801fc2:	eb 90                	jmp    801f54 <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801fc4:	83 ec 0c             	sub    $0xc,%esp
+  801fc7:	50                   	push   %eax
+  801fc8:	6a 15                	push   $0x15
+  801fca:	68 39 2d a0 00       	push   $0xa02d39
+  801fcf:	6a 4a                	push   $0x4a
+  801fd1:	68 56 2d a0 00       	push   $0xa02d56
+  801fd6:	e8 e5 e1 ff ff       	call   8001c0 <_panic>
+
+00801fdb <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  801fdb:	55                   	push   %ebp
+  801fdc:	89 e5                	mov    %esp,%ebp
+  801fde:	57                   	push   %edi
+  801fdf:	56                   	push   %esi
+  801fe0:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801fe1:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  801fe8:	78 32                	js     80201c <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  801fea:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  801ff1:	74 75                	je     802068 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801ff3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ff6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ff9:	b8 16 00 00 00       	mov    $0x16,%eax
+  801ffe:	be 00 00 00 00       	mov    $0x0,%esi
+  802003:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802006:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802009:	55                   	push   %ebp
+  80200a:	68 13 20 80 00       	push   $0x802013
+  80200f:	89 e5                	mov    %esp,%ebp
+  802011:	0f 34                	sysenter
+  802013:	83 c4 04             	add    $0x4,%esp
+  802016:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  802017:	5b                   	pop    %ebx
+  802018:	5e                   	pop    %esi
+  802019:	5f                   	pop    %edi
+  80201a:	5d                   	pop    %ebp
+  80201b:	c3                   	ret
+  80201c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802021:	0f a2                	cpuid
+		return 0;
+  802023:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802028:	f6 c6 08             	test   $0x8,%dh
+  80202b:	74 15                	je     802042 <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80202d:	89 c2                	mov    %eax,%edx
+  80202f:	c1 ea 08             	shr    $0x8,%edx
+  802032:	83 e2 0f             	and    $0xf,%edx
+  802035:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80203a:	83 fa 06             	cmp    $0x6,%edx
+  80203d:	74 0e                	je     80204d <sys_shm_attach+0x72>
+  80203f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802042:	0f b6 c9             	movzbl %cl,%ecx
+  802045:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  80204b:	eb 9d                	jmp    801fea <sys_shm_attach+0xf>
+  80204d:	89 c2                	mov    %eax,%edx
+  80204f:	c1 ea 04             	shr    $0x4,%edx
+  802052:	83 e2 0f             	and    $0xf,%edx
+  802055:	83 fa 02             	cmp    $0x2,%edx
+  802058:	77 e5                	ja     80203f <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  80205a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80205d:	83 f8 02             	cmp    $0x2,%eax
+  802060:	0f 97 c1             	seta   %cl
+  802063:	0f b6 c9             	movzbl %cl,%ecx
+  802066:	eb d7                	jmp    80203f <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  802068:	b8 16 00 00 00       	mov    $0x16,%eax
+  80206d:	be 00 00 00 00       	mov    $0x0,%esi
+  802072:	8b 55 08             	mov    0x8(%ebp),%edx
+  802075:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802078:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80207b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80207e:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  802080:	eb 95                	jmp    802017 <sys_shm_attach+0x3c>
+
+00802082 <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  802082:	55                   	push   %ebp
+  802083:	89 e5                	mov    %esp,%ebp
+  802085:	57                   	push   %edi
+  802086:	56                   	push   %esi
+  802087:	53                   	push   %ebx
+  802088:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80208b:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  802092:	78 38                	js     8020cc <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  802094:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  80209b:	74 7b                	je     802118 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  80209d:	be 00 00 00 00       	mov    $0x0,%esi
+  8020a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020a8:	b8 17 00 00 00       	mov    $0x17,%eax
+  8020ad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8020b0:	89 f7                	mov    %esi,%edi
+  8020b2:	55                   	push   %ebp
+  8020b3:	68 bc 20 80 00       	push   $0x8020bc
+  8020b8:	89 e5                	mov    %esp,%ebp
+  8020ba:	0f 34                	sysenter
+  8020bc:	83 c4 04             	add    $0x4,%esp
+  8020bf:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8020c0:	85 c0                	test   %eax,%eax
+  8020c2:	7f 6d                	jg     802131 <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  8020c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020c7:	5b                   	pop    %ebx
+  8020c8:	5e                   	pop    %esi
+  8020c9:	5f                   	pop    %edi
+  8020ca:	5d                   	pop    %ebp
+  8020cb:	c3                   	ret
+  8020cc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020d1:	0f a2                	cpuid
+		return 0;
+  8020d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8020d8:	f6 c6 08             	test   $0x8,%dh
+  8020db:	74 15                	je     8020f2 <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020dd:	89 c2                	mov    %eax,%edx
+  8020df:	c1 ea 08             	shr    $0x8,%edx
+  8020e2:	83 e2 0f             	and    $0xf,%edx
+  8020e5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8020ea:	83 fa 06             	cmp    $0x6,%edx
+  8020ed:	74 0e                	je     8020fd <sys_shm_detach+0x7b>
+  8020ef:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8020f2:	0f b6 c9             	movzbl %cl,%ecx
+  8020f5:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  8020fb:	eb 97                	jmp    802094 <sys_shm_detach+0x12>
+  8020fd:	89 c2                	mov    %eax,%edx
+  8020ff:	c1 ea 04             	shr    $0x4,%edx
+  802102:	83 e2 0f             	and    $0xf,%edx
+  802105:	83 fa 02             	cmp    $0x2,%edx
+  802108:	77 e5                	ja     8020ef <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  80210a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80210d:	83 f8 02             	cmp    $0x2,%eax
+  802110:	0f 97 c1             	seta   %cl
+  802113:	0f b6 c9             	movzbl %cl,%ecx
+  802116:	eb d7                	jmp    8020ef <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  802118:	be 00 00 00 00       	mov    $0x0,%esi
+  80211d:	b8 17 00 00 00       	mov    $0x17,%eax
+  802122:	8b 55 08             	mov    0x8(%ebp),%edx
+  802125:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802128:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80212b:	89 f7                	mov    %esi,%edi
+  80212d:	cd 30                	int    $0x30
+  80212f:	eb 8f                	jmp    8020c0 <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802131:	83 ec 0c             	sub    $0xc,%esp
+  802134:	50                   	push   %eax
+  802135:	6a 17                	push   $0x17
+  802137:	68 39 2d a0 00       	push   $0xa02d39
+  80213c:	6a 4a                	push   $0x4a
+  80213e:	68 56 2d a0 00       	push   $0xa02d56
+  802143:	e8 78 e0 ff ff       	call   8001c0 <_panic>
+
+00802148 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  802148:	55                   	push   %ebp
+  802149:	89 e5                	mov    %esp,%ebp
+  80214b:	57                   	push   %edi
+  80214c:	56                   	push   %esi
+  80214d:	53                   	push   %ebx
+  80214e:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802151:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  802158:	78 36                	js     802190 <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  80215a:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  802161:	74 79                	je     8021dc <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  802163:	8b 55 08             	mov    0x8(%ebp),%edx
+  802166:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80216b:	b8 18 00 00 00       	mov    $0x18,%eax
+  802170:	89 cb                	mov    %ecx,%ebx
+  802172:	89 cf                	mov    %ecx,%edi
+  802174:	89 ce                	mov    %ecx,%esi
+  802176:	55                   	push   %ebp
+  802177:	68 80 21 80 00       	push   $0x802180
+  80217c:	89 e5                	mov    %esp,%ebp
+  80217e:	0f 34                	sysenter
+  802180:	83 c4 04             	add    $0x4,%esp
+  802183:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802184:	85 c0                	test   %eax,%eax
+  802186:	7f 6b                	jg     8021f3 <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  802188:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80218b:	5b                   	pop    %ebx
+  80218c:	5e                   	pop    %esi
+  80218d:	5f                   	pop    %edi
+  80218e:	5d                   	pop    %ebp
+  80218f:	c3                   	ret
+  802190:	b8 01 00 00 00       	mov    $0x1,%eax
+  802195:	0f a2                	cpuid
+		return 0;
+  802197:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80219c:	f6 c6 08             	test   $0x8,%dh
+  80219f:	74 15                	je     8021b6 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021a1:	89 c2                	mov    %eax,%edx
+  8021a3:	c1 ea 08             	shr    $0x8,%edx
+  8021a6:	83 e2 0f             	and    $0xf,%edx
+  8021a9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8021ae:	83 fa 06             	cmp    $0x6,%edx
+  8021b1:	74 0e                	je     8021c1 <sys_shm_remove+0x79>
+  8021b3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8021b6:	0f b6 c9             	movzbl %cl,%ecx
+  8021b9:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  8021bf:	eb 99                	jmp    80215a <sys_shm_remove+0x12>
+  8021c1:	89 c2                	mov    %eax,%edx
+  8021c3:	c1 ea 04             	shr    $0x4,%edx
+  8021c6:	83 e2 0f             	and    $0xf,%edx
+  8021c9:	83 fa 02             	cmp    $0x2,%edx
+  8021cc:	77 e5                	ja     8021b3 <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  8021ce:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021d1:	83 f8 02             	cmp    $0x2,%eax
+  8021d4:	0f 97 c1             	seta   %cl
+  8021d7:	0f b6 c9             	movzbl %cl,%ecx
+  8021da:	eb d7                	jmp    8021b3 <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  8021dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021e1:	b8 18 00 00 00       	mov    $0x18,%eax
+  8021e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021e9:	89 cb                	mov    %ecx,%ebx
+  8021eb:	89 cf                	mov    %ecx,%edi
+  8021ed:	89 ce                	mov    %ecx,%esi
+  8021ef:	cd 30                	int    $0x30
+  8021f1:	eb 91                	jmp    802184 <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8021f3:	83 ec 0c             	sub    $0xc,%esp
+  8021f6:	50                   	push   %eax
+  8021f7:	6a 18                	push   $0x18
+  8021f9:	68 39 2d a0 00       	push   $0xa02d39
+  8021fe:	6a 4a                	push   $0x4a
+  802200:	68 56 2d a0 00       	push   $0xa02d56
+  802205:	e8 b6 df ff ff       	call   8001c0 <_panic>
+
+0080220a <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  80220a:	55                   	push   %ebp
+  80220b:	89 e5                	mov    %esp,%ebp
+  80220d:	57                   	push   %edi
+  80220e:	56                   	push   %esi
+  80220f:	53                   	push   %ebx
+  802210:	83 ec 0c             	sub    $0xc,%esp
+  802213:	8b 45 10             	mov    0x10(%ebp),%eax
+  802216:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802219:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  80221c:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  802223:	78 32                	js     802257 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  802225:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  80222c:	74 75                	je     8022a3 <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  80222e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802231:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802234:	b8 20 00 00 00       	mov    $0x20,%eax
+  802239:	be 00 00 00 00       	mov    $0x0,%esi
+  80223e:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802241:	55                   	push   %ebp
+  802242:	68 4b 22 80 00       	push   $0x80224b
+  802247:	89 e5                	mov    %esp,%ebp
+  802249:	0f 34                	sysenter
+  80224b:	83 c4 04             	add    $0x4,%esp
+  80224e:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  80224f:	83 c4 0c             	add    $0xc,%esp
+  802252:	5b                   	pop    %ebx
+  802253:	5e                   	pop    %esi
+  802254:	5f                   	pop    %edi
+  802255:	5d                   	pop    %ebp
+  802256:	c3                   	ret
+  802257:	b8 01 00 00 00       	mov    $0x1,%eax
+  80225c:	0f a2                	cpuid
+		return 0;
+  80225e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802263:	f6 c6 08             	test   $0x8,%dh
+  802266:	74 15                	je     80227d <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802268:	89 c2                	mov    %eax,%edx
+  80226a:	c1 ea 08             	shr    $0x8,%edx
+  80226d:	83 e2 0f             	and    $0xf,%edx
+  802270:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802275:	83 fa 06             	cmp    $0x6,%edx
+  802278:	74 0e                	je     802288 <sys_futex_wait+0x7e>
+  80227a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80227d:	0f b6 c9             	movzbl %cl,%ecx
+  802280:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  802286:	eb 9d                	jmp    802225 <sys_futex_wait+0x1b>
+  802288:	89 c2                	mov    %eax,%edx
+  80228a:	c1 ea 04             	shr    $0x4,%edx
+  80228d:	83 e2 0f             	and    $0xf,%edx
+  802290:	83 fa 02             	cmp    $0x2,%edx
+  802293:	77 e5                	ja     80227a <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  802295:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802298:	83 f8 02             	cmp    $0x2,%eax
+  80229b:	0f 97 c1             	seta   %cl
+  80229e:	0f b6 c9             	movzbl %cl,%ecx
+  8022a1:	eb d7                	jmp    80227a <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  8022a3:	b8 20 00 00 00       	mov    $0x20,%eax
+  8022a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8022ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022b3:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8022b6:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  8022b8:	eb 95                	jmp    80224f <sys_futex_wait+0x45>
+
+008022ba <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8022ba:	55                   	push   %ebp
+  8022bb:	89 e5                	mov    %esp,%ebp
+  8022bd:	57                   	push   %edi
+  8022be:	56                   	push   %esi
+  8022bf:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8022c0:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  8022c7:	78 30                	js     8022f9 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  8022c9:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  8022d0:	74 73                	je     802345 <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  8022d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022dd:	b8 21 00 00 00       	mov    $0x21,%eax
+  8022e2:	89 df                	mov    %ebx,%edi
+  8022e4:	89 de                	mov    %ebx,%esi
+  8022e6:	55                   	push   %ebp
+  8022e7:	68 f0 22 80 00       	push   $0x8022f0
+  8022ec:	89 e5                	mov    %esp,%ebp
+  8022ee:	0f 34                	sysenter
+  8022f0:	83 c4 04             	add    $0x4,%esp
+  8022f3:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8022f4:	5b                   	pop    %ebx
+  8022f5:	5e                   	pop    %esi
+  8022f6:	5f                   	pop    %edi
+  8022f7:	5d                   	pop    %ebp
+  8022f8:	c3                   	ret
+  8022f9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022fe:	0f a2                	cpuid
+		return 0;
+  802300:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802305:	f6 c6 08             	test   $0x8,%dh
+  802308:	74 15                	je     80231f <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80230a:	89 c2                	mov    %eax,%edx
+  80230c:	c1 ea 08             	shr    $0x8,%edx
+  80230f:	83 e2 0f             	and    $0xf,%edx
+  802312:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802317:	83 fa 06             	cmp    $0x6,%edx
+  80231a:	74 0e                	je     80232a <sys_futex_wake+0x70>
+  80231c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80231f:	0f b6 c9             	movzbl %cl,%ecx
+  802322:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  802328:	eb 9f                	jmp    8022c9 <sys_futex_wake+0xf>
+  80232a:	89 c2                	mov    %eax,%edx
+  80232c:	c1 ea 04             	shr    $0x4,%edx
+  80232f:	83 e2 0f             	and    $0xf,%edx
+  802332:	83 fa 02             	cmp    $0x2,%edx
+  802335:	77 e5                	ja     80231c <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  802337:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80233a:	83 f8 02             	cmp    $0x2,%eax
+  80233d:	0f 97 c1             	seta   %cl
+  802340:	0f b6 c9             	movzbl %cl,%ecx
+  802343:	eb d7                	jmp    80231c <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  802345:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80234a:	b8 21 00 00 00       	mov    $0x21,%eax
+  80234f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802352:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802355:	89 df                	mov    %ebx,%edi
+  802357:	89 de                	mov    %ebx,%esi
+  802359:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  80235b:	eb 97                	jmp    8022f4 <sys_futex_wake+0x3a>
+
+0080235d <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  80235d:	55                   	push   %ebp
+  80235e:	89 e5                	mov    %esp,%ebp
+  802360:	57                   	push   %edi
+  802361:	56                   	push   %esi
+  802362:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802363:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  80236a:	78 2e                	js     80239a <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  80236c:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  802373:	74 71                	je     8023e6 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  802375:	ba 00 00 00 00       	mov    $0x0,%edx
+  80237a:	b8 22 00 00 00       	mov    $0x22,%eax
+  80237f:	89 d1                	mov    %edx,%ecx
+  802381:	89 d3                	mov    %edx,%ebx
+  802383:	89 d7                	mov    %edx,%edi
+  802385:	89 d6                	mov    %edx,%esi
+  802387:	55                   	push   %ebp
+  802388:	68 91 23 80 00       	push   $0x802391
+  80238d:	89 e5                	mov    %esp,%ebp
+  80238f:	0f 34                	sysenter
+  802391:	83 c4 04             	add    $0x4,%esp
+  802394:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  802395:	5b                   	pop    %ebx
+  802396:	5e                   	pop    %esi
+  802397:	5f                   	pop    %edi
+  802398:	5d                   	pop    %ebp
+  802399:	c3                   	ret
+  80239a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80239f:	0f a2                	cpuid
+		return 0;
+  8023a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8023a6:	f6 c6 08             	test   $0x8,%dh
+  8023a9:	74 15                	je     8023c0 <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023ab:	89 c2                	mov    %eax,%edx
+  8023ad:	c1 ea 08             	shr    $0x8,%edx
+  8023b0:	83 e2 0f             	and    $0xf,%edx
+  8023b3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8023b8:	83 fa 06             	cmp    $0x6,%edx
+  8023bb:	74 0e                	je     8023cb <sys_ep_create+0x6e>
+  8023bd:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8023c0:	0f b6 c9             	movzbl %cl,%ecx
+  8023c3:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  8023c9:	eb a1                	jmp    80236c <sys_ep_create+0xf>
+  8023cb:	89 c2                	mov    %eax,%edx
+  8023cd:	c1 ea 04             	shr    $0x4,%edx
+  8023d0:	83 e2 0f             	and    $0xf,%edx
+  8023d3:	83 fa 02             	cmp    $0x2,%edx
+  8023d6:	77 e5                	ja     8023bd <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  8023d8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023db:	83 f8 02             	cmp    $0x2,%eax
+  8023de:	0f 97 c1             	seta   %cl
+  8023e1:	0f b6 c9             	movzbl %cl,%ecx
+  8023e4:	eb d7                	jmp    8023bd <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  8023e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023eb:	b8 22 00 00 00       	mov    $0x22,%eax
+  8023f0:	89 d1                	mov    %edx,%ecx
+  8023f2:	89 d3                	mov    %edx,%ebx
+  8023f4:	89 d7                	mov    %edx,%edi
+  8023f6:	89 d6                	mov    %edx,%esi
+  8023f8:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  8023fa:	eb 99                	jmp    802395 <sys_ep_create+0x38>
+
+008023fc <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  8023fc:	55                   	push   %ebp
+  8023fd:	89 e5                	mov    %esp,%ebp
+  8023ff:	57                   	push   %edi
+  802400:	56                   	push   %esi
+  802401:	53                   	push   %ebx
+  802402:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802405:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  80240c:	78 36                	js     802444 <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  80240e:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  802415:	74 79                	je     802490 <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  802417:	8b 55 08             	mov    0x8(%ebp),%edx
+  80241a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80241f:	b8 23 00 00 00       	mov    $0x23,%eax
+  802424:	89 cb                	mov    %ecx,%ebx
+  802426:	89 cf                	mov    %ecx,%edi
+  802428:	89 ce                	mov    %ecx,%esi
+  80242a:	55                   	push   %ebp
+  80242b:	68 34 24 80 00       	push   $0x802434
+  802430:	89 e5                	mov    %esp,%ebp
+  802432:	0f 34                	sysenter
+  802434:	83 c4 04             	add    $0x4,%esp
+  802437:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802438:	85 c0                	test   %eax,%eax
+  80243a:	7f 6b                	jg     8024a7 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  80243c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80243f:	5b                   	pop    %ebx
+  802440:	5e                   	pop    %esi
+  802441:	5f                   	pop    %edi
+  802442:	5d                   	pop    %ebp
+  802443:	c3                   	ret
+  802444:	b8 01 00 00 00       	mov    $0x1,%eax
+  802449:	0f a2                	cpuid
+		return 0;
+  80244b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802450:	f6 c6 08             	test   $0x8,%dh
+  802453:	74 15                	je     80246a <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802455:	89 c2                	mov    %eax,%edx
+  802457:	c1 ea 08             	shr    $0x8,%edx
+  80245a:	83 e2 0f             	and    $0xf,%edx
+  80245d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802462:	83 fa 06             	cmp    $0x6,%edx
+  802465:	74 0e                	je     802475 <sys_ep_destroy+0x79>
+  802467:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80246a:	0f b6 c9             	movzbl %cl,%ecx
+  80246d:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  802473:	eb 99                	jmp    80240e <sys_ep_destroy+0x12>
+  802475:	89 c2                	mov    %eax,%edx
+  802477:	c1 ea 04             	shr    $0x4,%edx
+  80247a:	83 e2 0f             	and    $0xf,%edx
+  80247d:	83 fa 02             	cmp    $0x2,%edx
+  802480:	77 e5                	ja     802467 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  802482:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802485:	83 f8 02             	cmp    $0x2,%eax
+  802488:	0f 97 c1             	seta   %cl
+  80248b:	0f b6 c9             	movzbl %cl,%ecx
+  80248e:	eb d7                	jmp    802467 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  802490:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802495:	b8 23 00 00 00       	mov    $0x23,%eax
+  80249a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80249d:	89 cb                	mov    %ecx,%ebx
+  80249f:	89 cf                	mov    %ecx,%edi
+  8024a1:	89 ce                	mov    %ecx,%esi
+  8024a3:	cd 30                	int    $0x30
+  8024a5:	eb 91                	jmp    802438 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8024a7:	83 ec 0c             	sub    $0xc,%esp
+  8024aa:	50                   	push   %eax
+  8024ab:	6a 23                	push   $0x23
+  8024ad:	68 39 2d a0 00       	push   $0xa02d39
+  8024b2:	6a 4a                	push   $0x4a
+  8024b4:	68 56 2d a0 00       	push   $0xa02d56
+  8024b9:	e8 02 dd ff ff       	call   8001c0 <_panic>
+
+008024be <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  8024be:	55                   	push   %ebp
+  8024bf:	89 e5                	mov    %esp,%ebp
+  8024c1:	57                   	push   %edi
+  8024c2:	56                   	push   %esi
+  8024c3:	53                   	push   %ebx
+  8024c4:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8024c7:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  8024ce:	78 37                	js     802507 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  8024d0:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  8024d7:	74 7a                	je     802553 <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  8024d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024e4:	b8 24 00 00 00       	mov    $0x24,%eax
+  8024e9:	89 df                	mov    %ebx,%edi
+  8024eb:	89 de                	mov    %ebx,%esi
+  8024ed:	55                   	push   %ebp
+  8024ee:	68 f7 24 80 00       	push   $0x8024f7
+  8024f3:	89 e5                	mov    %esp,%ebp
+  8024f5:	0f 34                	sysenter
+  8024f7:	83 c4 04             	add    $0x4,%esp
+  8024fa:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8024fb:	85 c0                	test   %eax,%eax
+  8024fd:	7f 6c                	jg     80256b <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  8024ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802502:	5b                   	pop    %ebx
+  802503:	5e                   	pop    %esi
+  802504:	5f                   	pop    %edi
+  802505:	5d                   	pop    %ebp
+  802506:	c3                   	ret
+  802507:	b8 01 00 00 00       	mov    $0x1,%eax
+  80250c:	0f a2                	cpuid
+		return 0;
+  80250e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802513:	f6 c6 08             	test   $0x8,%dh
+  802516:	74 15                	je     80252d <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802518:	89 c2                	mov    %eax,%edx
+  80251a:	c1 ea 08             	shr    $0x8,%edx
+  80251d:	83 e2 0f             	and    $0xf,%edx
+  802520:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802525:	83 fa 06             	cmp    $0x6,%edx
+  802528:	74 0e                	je     802538 <sys_ep_grant+0x7a>
+  80252a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80252d:	0f b6 c9             	movzbl %cl,%ecx
+  802530:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  802536:	eb 98                	jmp    8024d0 <sys_ep_grant+0x12>
+  802538:	89 c2                	mov    %eax,%edx
+  80253a:	c1 ea 04             	shr    $0x4,%edx
+  80253d:	83 e2 0f             	and    $0xf,%edx
+  802540:	83 fa 02             	cmp    $0x2,%edx
+  802543:	77 e5                	ja     80252a <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  802545:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802548:	83 f8 02             	cmp    $0x2,%eax
+  80254b:	0f 97 c1             	seta   %cl
+  80254e:	0f b6 c9             	movzbl %cl,%ecx
+  802551:	eb d7                	jmp    80252a <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  802553:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802558:	b8 24 00 00 00       	mov    $0x24,%eax
+  80255d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802560:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802563:	89 df                	mov    %ebx,%edi
+  802565:	89 de                	mov    %ebx,%esi
+  802567:	cd 30                	int    $0x30
+  802569:	eb 90                	jmp    8024fb <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80256b:	83 ec 0c             	sub    $0xc,%esp
+  80256e:	50                   	push   %eax
+  80256f:	6a 24                	push   $0x24
+  802571:	68 39 2d a0 00       	push   $0xa02d39
+  802576:	6a 4a                	push   $0x4a
+  802578:	68 56 2d a0 00       	push   $0xa02d56
+  80257d:	e8 3e dc ff ff       	call   8001c0 <_panic>
+
+00802582 <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  802582:	55                   	push   %ebp
+  802583:	89 e5                	mov    %esp,%ebp
+  802585:	57                   	push   %edi
+  802586:	56                   	push   %esi
+  802587:	53                   	push   %ebx
+  802588:	83 ec 20             	sub    $0x20,%esp
+  80258b:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  80258e:	8b 10                	mov    (%eax),%edx
+  802590:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802593:	8b 50 04             	mov    0x4(%eax),%edx
+  802596:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802599:	8b 50 08             	mov    0x8(%eax),%edx
+  80259c:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  80259f:	8b 50 0c             	mov    0xc(%eax),%edx
+  8025a2:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  8025a5:	8b 40 10             	mov    0x10(%eax),%eax
+  8025a8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  8025ab:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  8025ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025b1:	b8 25 00 00 00       	mov    $0x25,%eax
+  8025b6:	55                   	push   %ebp
+  8025b7:	56                   	push   %esi
+  8025b8:	8b 0e                	mov    (%esi),%ecx
+  8025ba:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8025bd:	8b 7e 08             	mov    0x8(%esi),%edi
+  8025c0:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8025c3:	8b 76 0c             	mov    0xc(%esi),%esi
+  8025c6:	cd 30                	int    $0x30
+  8025c8:	87 34 24             	xchg   %esi,(%esp)
+  8025cb:	89 0e                	mov    %ecx,(%esi)
+  8025cd:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8025d0:	89 7e 08             	mov    %edi,0x8(%esi)
+  8025d3:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8025d6:	8f 46 0c             	pop    0xc(%esi)
+  8025d9:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  8025da:	83 c4 20             	add    $0x20,%esp
+  8025dd:	5b                   	pop    %ebx
+  8025de:	5e                   	pop    %esi
+  8025df:	5f                   	pop    %edi
+  8025e0:	5d                   	pop    %ebp
+  8025e1:	c3                   	ret
+
+008025e2 <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  8025e2:	55                   	push   %ebp
+  8025e3:	89 e5                	mov    %esp,%ebp
+  8025e5:	57                   	push   %edi
+  8025e6:	56                   	push   %esi
+  8025e7:	53                   	push   %ebx
+  8025e8:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  8025eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025ee:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  8025f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025f3:	b8 26 00 00 00       	mov    $0x26,%eax
+  8025f8:	55                   	push   %ebp
+  8025f9:	56                   	push   %esi
+  8025fa:	8b 0e                	mov    (%esi),%ecx
+  8025fc:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8025ff:	8b 7e 08             	mov    0x8(%esi),%edi
+  802602:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802605:	8b 76 0c             	mov    0xc(%esi),%esi
+  802608:	cd 30                	int    $0x30
+  80260a:	87 34 24             	xchg   %esi,(%esp)
+  80260d:	89 0e                	mov    %ecx,(%esi)
+  80260f:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802612:	89 7e 08             	mov    %edi,0x8(%esi)
+  802615:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802618:	8f 46 0c             	pop    0xc(%esi)
+  80261b:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  80261c:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  802620:	74 0f                	je     802631 <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  802622:	85 c0                	test   %eax,%eax
+  802624:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802629:	0f 48 d1             	cmovs  %ecx,%edx
+  80262c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  80262f:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  802631:	5b                   	pop    %ebx
+  802632:	5e                   	pop    %esi
+  802633:	5f                   	pop    %edi
+  802634:	5d                   	pop    %ebp
+  802635:	c3                   	ret
+
+00802636 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  802636:	55                   	push   %ebp
+  802637:	89 e5                	mov    %esp,%ebp
+  802639:	57                   	push   %edi
+  80263a:	56                   	push   %esi
+  80263b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80263c:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  802643:	78 2f                	js     802674 <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  802645:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  80264c:	74 72                	je     8026c0 <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  80264e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802651:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802656:	b8 27 00 00 00       	mov    $0x27,%eax
+  80265b:	89 cb                	mov    %ecx,%ebx
+  80265d:	89 cf                	mov    %ecx,%edi
+  80265f:	89 ce                	mov    %ecx,%esi
+  802661:	55                   	push   %ebp
+  802662:	68 6b 26 80 00       	push   $0x80266b
+  802667:	89 e5                	mov    %esp,%ebp
+  802669:	0f 34                	sysenter
+  80266b:	83 c4 04             	add    $0x4,%esp
+  80266e:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  80266f:	5b                   	pop    %ebx
+  802670:	5e                   	pop    %esi
+  802671:	5f                   	pop    %edi
+  802672:	5d                   	pop    %ebp
+  802673:	c3                   	ret
+  802674:	b8 01 00 00 00       	mov    $0x1,%eax
+  802679:	0f a2                	cpuid
+		return 0;
+  80267b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802680:	f6 c6 08             	test   $0x8,%dh
+  802683:	74 15                	je     80269a <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802685:	89 c2                	mov    %eax,%edx
+  802687:	c1 ea 08             	shr    $0x8,%edx
+  80268a:	83 e2 0f             	and    $0xf,%edx
+  80268d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802692:	83 fa 06             	cmp    $0x6,%edx
+  802695:	74 0e                	je     8026a5 <sys_sysring_setup+0x6f>
+  802697:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80269a:	0f b6 c9             	movzbl %cl,%ecx
+  80269d:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  8026a3:	eb a0                	jmp    802645 <sys_sysring_setup+0xf>
+  8026a5:	89 c2                	mov    %eax,%edx
+  8026a7:	c1 ea 04             	shr    $0x4,%edx
+  8026aa:	83 e2 0f             	and    $0xf,%edx
+  8026ad:	83 fa 02             	cmp    $0x2,%edx
+  8026b0:	77 e5                	ja     802697 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  8026b2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8026b5:	83 f8 02             	cmp    $0x2,%eax
+  8026b8:	0f 97 c1             	seta   %cl
+  8026bb:	0f b6 c9             	movzbl %cl,%ecx
+  8026be:	eb d7                	jmp    802697 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  8026c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026c5:	b8 27 00 00 00       	mov    $0x27,%eax
+  8026ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8026cd:	89 cb                	mov    %ecx,%ebx
+  8026cf:	89 cf                	mov    %ecx,%edi
+  8026d1:	89 ce                	mov    %ecx,%esi
+  8026d3:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  8026d5:	eb 98                	jmp    80266f <sys_sysring_setup+0x39>
+
+008026d7 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  8026d7:	55                   	push   %ebp
+  8026d8:	89 e5                	mov    %esp,%ebp
+  8026da:	57                   	push   %edi
+  8026db:	56                   	push   %esi
+  8026dc:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8026dd:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  8026e4:	78 2e                	js     802714 <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  8026e6:	83 3d 04 30 a0 00 00 	cmpl   $0x0,0xa03004
+  8026ed:	74 71                	je     802760 <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  8026ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026f4:	b8 28 00 00 00       	mov    $0x28,%eax
+  8026f9:	89 d1                	mov    %edx,%ecx
+  8026fb:	89 d3                	mov    %edx,%ebx
+  8026fd:	89 d7                	mov    %edx,%edi
+  8026ff:	89 d6                	mov    %edx,%esi
+  802701:	55                   	push   %ebp
+  802702:	68 0b 27 80 00       	push   $0x80270b
+  802707:	89 e5                	mov    %esp,%ebp
+  802709:	0f 34                	sysenter
+  80270b:	83 c4 04             	add    $0x4,%esp
+  80270e:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  80270f:	5b                   	pop    %ebx
+  802710:	5e                   	pop    %esi
+  802711:	5f                   	pop    %edi
+  802712:	5d                   	pop    %ebp
+  802713:	c3                   	ret
+  802714:	b8 01 00 00 00       	mov    $0x1,%eax
+  802719:	0f a2                	cpuid
+		return 0;
+  80271b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802720:	f6 c6 08             	test   $0x8,%dh
+  802723:	74 15                	je     80273a <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802725:	89 c2                	mov    %eax,%edx
+  802727:	c1 ea 08             	shr    $0x8,%edx
+  80272a:	83 e2 0f             	and    $0xf,%edx
+  80272d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802732:	83 fa 06             	cmp    $0x6,%edx
+  802735:	74 0e                	je     802745 <sys_sysring_enter+0x6e>
+  802737:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80273a:	0f b6 c9             	movzbl %cl,%ecx
+  80273d:	89 0d 04 30 a0 00    	mov    %ecx,0xa03004
+  802743:	eb a1                	jmp    8026e6 <sys_sysring_enter+0xf>
+  802745:	89 c2                	mov    %eax,%edx
+  802747:	c1 ea 04             	shr    $0x4,%edx
+  80274a:	83 e2 0f             	and    $0xf,%edx
+  80274d:	83 fa 02             	cmp    $0x2,%edx
+  802750:	77 e5                	ja     802737 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  802752:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802755:	83 f8 02             	cmp    $0x2,%eax
+  802758:	0f 97 c1             	seta   %cl
+  80275b:	0f b6 c9             	movzbl %cl,%ecx
+  80275e:	eb d7                	jmp    802737 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  802760:	ba 00 00 00 00       	mov    $0x0,%edx
+  802765:	b8 28 00 00 00       	mov    $0x28,%eax
+  80276a:	89 d1                	mov    %edx,%ecx
+  80276c:	89 d3                	mov    %edx,%ebx
+  80276e:	89 d7                	mov    %edx,%edi
+  802770:	89 d6                	mov    %edx,%esi
+  802772:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  802774:	eb 99                	jmp    80270f <sys_sysring_enter+0x38>
+
+00802776 <dm>:
+  802776:	55                   	push   %ebp
+  802777:	57                   	push   %edi
+  802778:	56                   	push   %esi
+  802779:	53                   	push   %ebx
+  80277a:	83 ec 24             	sub    $0x24,%esp
+  80277d:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802781:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802785:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802789:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80278d:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802791:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802795:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802799:	b8 00 00 00 00       	mov    $0x0,%eax
+  80279e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027a3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8027a8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8027af:	00 
+  8027b0:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8027b7:	00 
+  8027b8:	89 fb                	mov    %edi,%ebx
+  8027ba:	eb 08                	jmp    8027c4 <dm+0x4e>
+  8027bc:	83 e9 01             	sub    $0x1,%ecx
+  8027bf:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8027c2:	74 68                	je     80282c <dm+0xb6>
+  8027c4:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8027c8:	01 c0                	add    %eax,%eax
+  8027ca:	89 c6                	mov    %eax,%esi
+  8027cc:	89 d7                	mov    %edx,%edi
+  8027ce:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8027d2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8027d6:	0f ad d0             	shrd   %cl,%edx,%eax
+  8027d9:	d3 ea                	shr    %cl,%edx
+  8027db:	f6 c1 20             	test   $0x20,%cl
+  8027de:	74 04                	je     8027e4 <dm+0x6e>
+  8027e0:	89 d0                	mov    %edx,%eax
+  8027e2:	31 d2                	xor    %edx,%edx
+  8027e4:	83 e0 01             	and    $0x1,%eax
+  8027e7:	89 04 24             	mov    %eax,(%esp)
+  8027ea:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8027f1:	00 
+  8027f2:	8b 04 24             	mov    (%esp),%eax
+  8027f5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8027f9:	09 f0                	or     %esi,%eax
+  8027fb:	09 fa                	or     %edi,%edx
+  8027fd:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802801:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802805:	39 f0                	cmp    %esi,%eax
+  802807:	89 d5                	mov    %edx,%ebp
+  802809:	19 fd                	sbb    %edi,%ebp
+  80280b:	72 af                	jb     8027bc <dm+0x46>
+  80280d:	29 f0                	sub    %esi,%eax
+  80280f:	19 fa                	sbb    %edi,%edx
+  802811:	89 cf                	mov    %ecx,%edi
+  802813:	c1 ef 05             	shr    $0x5,%edi
+  802816:	83 e7 01             	and    $0x1,%edi
+  802819:	89 fe                	mov    %edi,%esi
+  80281b:	83 f6 01             	xor    $0x1,%esi
+  80281e:	d3 e6                	shl    %cl,%esi
+  802820:	d3 e7                	shl    %cl,%edi
+  802822:	09 74 24 18          	or     %esi,0x18(%esp)
+  802826:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80282a:	eb 90                	jmp    8027bc <dm+0x46>
+  80282c:	85 db                	test   %ebx,%ebx
+  80282e:	74 05                	je     802835 <dm+0xbf>
+  802830:	89 03                	mov    %eax,(%ebx)
+  802832:	89 53 04             	mov    %edx,0x4(%ebx)
+  802835:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802839:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80283d:	83 c4 24             	add    $0x24,%esp
+  802840:	5b                   	pop    %ebx
+  802841:	5e                   	pop    %esi
+  802842:	5f                   	pop    %edi
+  802843:	5d                   	pop    %ebp
+  802844:	c3                   	ret
+
+00802845 <__udivdi3>:
+  802845:	83 ec 08             	sub    $0x8,%esp
+  802848:	6a 00                	push   $0x0
+  80284a:	ff 74 24 1c          	push   0x1c(%esp)
+  80284e:	ff 74 24 1c          	push   0x1c(%esp)
+  802852:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802856:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80285a:	e8 17 ff ff ff       	call   802776 <dm>
+  80285f:	83 c4 14             	add    $0x14,%esp
+  802862:	c3                   	ret
+
+00802863 <__umoddi3>:
+  802863:	83 ec 18             	sub    $0x18,%esp
+  802866:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80286a:	50                   	push   %eax
+  80286b:	ff 74 24 2c          	push   0x2c(%esp)
+  80286f:	ff 74 24 2c          	push   0x2c(%esp)
+  802873:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802877:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80287b:	e8 f6 fe ff ff       	call   802776 <dm>
+  802880:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802884:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802888:	83 c4 24             	add    $0x24,%esp
+  80288b:	c3                   	ret
+
+0080288c <__divdi3>:
+  80288c:	53                   	push   %ebx
+  80288d:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802891:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802895:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  802899:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80289d:	85 d2                	test   %edx,%edx
+  80289f:	78 15                	js     8028b6 <__divdi3+0x2a>
+  8028a1:	85 db                	test   %ebx,%ebx
+  8028a3:	78 34                	js     8028d9 <__divdi3+0x4d>
+  8028a5:	83 ec 04             	sub    $0x4,%esp
+  8028a8:	6a 00                	push   $0x0
+  8028aa:	53                   	push   %ebx
+  8028ab:	51                   	push   %ecx
+  8028ac:	e8 c5 fe ff ff       	call   802776 <dm>
+  8028b1:	83 c4 10             	add    $0x10,%esp
+  8028b4:	eb 21                	jmp    8028d7 <__divdi3+0x4b>
+  8028b6:	f7 d8                	neg    %eax
+  8028b8:	83 d2 00             	adc    $0x0,%edx
+  8028bb:	f7 da                	neg    %edx
+  8028bd:	85 db                	test   %ebx,%ebx
+  8028bf:	78 30                	js     8028f1 <__divdi3+0x65>
+  8028c1:	83 ec 04             	sub    $0x4,%esp
+  8028c4:	6a 00                	push   $0x0
+  8028c6:	53                   	push   %ebx
+  8028c7:	51                   	push   %ecx
+  8028c8:	e8 a9 fe ff ff       	call   802776 <dm>
+  8028cd:	83 c4 10             	add    $0x10,%esp
+  8028d0:	f7 d8                	neg    %eax
+  8028d2:	83 d2 00             	adc    $0x0,%edx
+  8028d5:	f7 da                	neg    %edx
+  8028d7:	5b                   	pop    %ebx
+  8028d8:	c3                   	ret
+  8028d9:	83 ec 04             	sub    $0x4,%esp
+  8028dc:	6a 00                	push   $0x0
+  8028de:	f7 d9                	neg    %ecx
+  8028e0:	83 d3 00             	adc    $0x0,%ebx
+  8028e3:	f7 db                	neg    %ebx
+  8028e5:	53                   	push   %ebx
+  8028e6:	51                   	push   %ecx
+  8028e7:	e8 8a fe ff ff       	call   802776 <dm>
+  8028ec:	83 c4 10             	add    $0x10,%esp
+  8028ef:	eb df                	jmp    8028d0 <__divdi3+0x44>
+  8028f1:	83 ec 04             	sub    $0x4,%esp
+  8028f4:	6a 00                	push   $0x0
+  8028f6:	f7 d9                	neg    %ecx
+  8028f8:	83 d3 00             	adc    $0x0,%ebx
+  8028fb:	f7 db                	neg    %ebx
+  8028fd:	53                   	push   %ebx
+  8028fe:	51                   	push   %ecx
+  8028ff:	e8 72 fe ff ff       	call   802776 <dm>
+  802904:	83 c4 10             	add    $0x10,%esp
+  802907:	eb ce                	jmp    8028d7 <__divdi3+0x4b>
+
+00802909 <__moddi3>:
+  802909:	55                   	push   %ebp
+  80290a:	57                   	push   %edi
+  80290b:	56                   	push   %esi
+  80290c:	53                   	push   %ebx
+  80290d:	83 ec 18             	sub    $0x18,%esp
+  802910:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802914:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802918:	89 f1                	mov    %esi,%ecx
+  80291a:	f7 d9                	neg    %ecx
+  80291c:	89 da                	mov    %ebx,%edx
+  80291e:	83 d2 00             	adc    $0x0,%edx
+  802921:	f7 da                	neg    %edx
+  802923:	0f 48 ce             	cmovs  %esi,%ecx
+  802926:	0f 48 d3             	cmovs  %ebx,%edx
+  802929:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80292d:	50                   	push   %eax
+  80292e:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802932:	f7 de                	neg    %esi
+  802934:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802938:	83 d0 00             	adc    $0x0,%eax
+  80293b:	f7 d8                	neg    %eax
+  80293d:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802942:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802947:	50                   	push   %eax
+  802948:	56                   	push   %esi
+  802949:	89 c8                	mov    %ecx,%eax
+  80294b:	e8 26 fe ff ff       	call   802776 <dm>
+  802950:	83 c4 10             	add    $0x10,%esp
+  802953:	85 db                	test   %ebx,%ebx
+  802955:	78 10                	js     802967 <__moddi3+0x5e>
+  802957:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80295b:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80295f:	83 c4 14             	add    $0x14,%esp
+  802962:	5b                   	pop    %ebx
+  802963:	5e                   	pop    %esi
+  802964:	5f                   	pop    %edi
+  802965:	5d                   	pop    %ebp
+  802966:	c3                   	ret
+  802967:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80296b:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80296f:	f7 d8                	neg    %eax
+  802971:	83 d2 00             	adc    $0x0,%edx
+  802974:	f7 da                	neg    %edx
+  802976:	eb e7                	jmp    80295f <__moddi3+0x56>
@@ -0,0 +1,5031 @@
+
+obj/user/breakpoint:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 04 00 00 00       	call   800035 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	asm volatile("int $3");
+  800033:	cc                   	int3
+}
+  800034:	c3                   	ret
+
+00800035 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	56                   	push   %esi
+  800039:	53                   	push   %ebx
+  80003a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  800040:	e8 9d 04 00 00       	call   8004e2 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  800045:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80004a:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  800050:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800055:	a3 08 30 80 00       	mov    %eax,0x803008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80005a:	85 db                	test   %ebx,%ebx
+  80005c:	7e 07                	jle    800065 <libmain+0x30>
+		binaryname = argv[0];
+  80005e:	8b 06                	mov    (%esi),%eax
+  800060:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  800065:	83 ec 08             	sub    $0x8,%esp
+  800068:	56                   	push   %esi
+  800069:	53                   	push   %ebx
+  80006a:	e8 c4 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80006f:	e8 0a 00 00 00       	call   80007e <exit>
+}
+  800074:	83 c4 10             	add    $0x10,%esp
+  800077:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80007a:	5b                   	pop    %ebx
+  80007b:	5e                   	pop    %esi
+  80007c:	5d                   	pop    %ebp
+  80007d:	c3                   	ret
+
+0080007e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80007e:	55                   	push   %ebp
+  80007f:	89 e5                	mov    %esp,%ebp
+  800081:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  800084:	6a 00                	push   $0x0
+  800086:	e8 95 03 00 00       	call   800420 <sys_env_destroy>
+}
+  80008b:	83 c4 10             	add    $0x10,%esp
+  80008e:	c9                   	leave
+  80008f:	c3                   	ret
+
+00800090 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800090:	55                   	push   %ebp
+  800091:	89 e5                	mov    %esp,%ebp
+  800093:	57                   	push   %edi
+  800094:	56                   	push   %esi
+  800095:	53                   	push   %ebx
+  800096:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  80009c:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  8000a2:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  8000a8:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  8000ae:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  8000b5:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  8000b8:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  8000bf:	00 00 00 
+		if (num == SYS_page_map_vec)
+  8000c2:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  8000c9:	74 76                	je     800141 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  8000cb:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  8000d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8000d4:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  8000da:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8000e1:	0f 88 06 01 00 00    	js     8001ed <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  8000e7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8000ee:	0f 84 48 01 00 00    	je     80023c <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  8000f4:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  8000fa:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800100:	be 00 00 00 00       	mov    $0x0,%esi
+  800105:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  80010b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80010e:	55                   	push   %ebp
+  80010f:	68 18 01 80 00       	push   $0x800118
+  800114:	89 e5                	mov    %esp,%ebp
+  800116:	0f 34                	sysenter
+  800118:	83 c4 04             	add    $0x4,%esp
+  80011b:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  80011c:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800122:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800128:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  80012b:	0f 85 9a 01 00 00    	jne    8002cb <page_vec_call+0x23b>
+  800131:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800136:	8b 75 08             	mov    0x8(%ebp),%esi
+  800139:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80013c:	e9 29 01 00 00       	jmp    80026a <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800141:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800147:	8b 45 08             	mov    0x8(%ebp),%eax
+  80014a:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  80014c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800153:	78 2f                	js     800184 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800155:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80015c:	74 72                	je     8001d0 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  80015e:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800164:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  80016a:	b8 10 00 00 00       	mov    $0x10,%eax
+  80016f:	89 fb                	mov    %edi,%ebx
+  800171:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800174:	55                   	push   %ebp
+  800175:	68 7e 01 80 00       	push   $0x80017e
+  80017a:	89 e5                	mov    %esp,%ebp
+  80017c:	0f 34                	sysenter
+  80017e:	83 c4 04             	add    $0x4,%esp
+  800181:	5d                   	pop    %ebp
+	return ret;
+  800182:	eb 98                	jmp    80011c <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800184:	b8 01 00 00 00       	mov    $0x1,%eax
+  800189:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  80018b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800190:	f6 c6 08             	test   $0x8,%dh
+  800193:	74 15                	je     8001aa <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800195:	89 c2                	mov    %eax,%edx
+  800197:	c1 ea 08             	shr    $0x8,%edx
+  80019a:	83 e2 0f             	and    $0xf,%edx
+  80019d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8001a2:	83 fa 06             	cmp    $0x6,%edx
+  8001a5:	74 0e                	je     8001b5 <page_vec_call+0x125>
+  8001a7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8001aa:	0f b6 c9             	movzbl %cl,%ecx
+  8001ad:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8001b3:	eb a0                	jmp    800155 <page_vec_call+0xc5>
+  8001b5:	89 c2                	mov    %eax,%edx
+  8001b7:	c1 ea 04             	shr    $0x4,%edx
+  8001ba:	83 e2 0f             	and    $0xf,%edx
+  8001bd:	83 fa 02             	cmp    $0x2,%edx
+  8001c0:	77 e5                	ja     8001a7 <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  8001c2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8001c5:	83 f8 02             	cmp    $0x2,%eax
+  8001c8:	0f 97 c1             	seta   %cl
+  8001cb:	0f b6 c9             	movzbl %cl,%ecx
+  8001ce:	eb d7                	jmp    8001a7 <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  8001d0:	b8 10 00 00 00       	mov    $0x10,%eax
+  8001d5:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  8001db:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  8001e1:	89 fb                	mov    %edi,%ebx
+  8001e3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8001e6:	cd 30                	int    $0x30
+  8001e8:	e9 2f ff ff ff       	jmp    80011c <page_vec_call+0x8c>
+  8001ed:	b8 01 00 00 00       	mov    $0x1,%eax
+  8001f2:	0f a2                	cpuid
+		return 0;
+  8001f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8001f9:	f6 c6 08             	test   $0x8,%dh
+  8001fc:	74 15                	je     800213 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8001fe:	89 c2                	mov    %eax,%edx
+  800200:	c1 ea 08             	shr    $0x8,%edx
+  800203:	83 e2 0f             	and    $0xf,%edx
+  800206:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80020b:	83 fa 06             	cmp    $0x6,%edx
+  80020e:	74 11                	je     800221 <page_vec_call+0x191>
+  800210:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800213:	0f b6 c9             	movzbl %cl,%ecx
+  800216:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80021c:	e9 c6 fe ff ff       	jmp    8000e7 <page_vec_call+0x57>
+  800221:	89 c2                	mov    %eax,%edx
+  800223:	c1 ea 04             	shr    $0x4,%edx
+  800226:	83 e2 0f             	and    $0xf,%edx
+  800229:	83 fa 02             	cmp    $0x2,%edx
+  80022c:	77 e2                	ja     800210 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  80022e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800231:	83 f8 02             	cmp    $0x2,%eax
+  800234:	0f 97 c1             	seta   %cl
+  800237:	0f b6 c9             	movzbl %cl,%ecx
+  80023a:	eb d4                	jmp    800210 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  80023c:	be 00 00 00 00       	mov    $0x0,%esi
+  800241:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800247:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  80024d:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800253:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800256:	cd 30                	int    $0x30
+  800258:	e9 bf fe ff ff       	jmp    80011c <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  80025d:	29 da                	sub    %ebx,%edx
+			vec++;
+  80025f:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800262:	83 e8 01             	sub    $0x1,%eax
+  800265:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  80026a:	85 c0                	test   %eax,%eax
+  80026c:	74 58                	je     8002c6 <page_vec_call+0x236>
+  80026e:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800271:	39 da                	cmp    %ebx,%edx
+  800273:	73 e8                	jae    80025d <page_vec_call+0x1cd>
+  800275:	89 75 08             	mov    %esi,0x8(%ebp)
+  800278:	89 45 0c             	mov    %eax,0xc(%ebp)
+  80027b:	84 c9                	test   %cl,%cl
+  80027d:	74 06                	je     800285 <page_vec_call+0x1f5>
+  80027f:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800285:	83 ec 04             	sub    $0x4,%esp
+  800288:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80028b:	c1 e0 04             	shl    $0x4,%eax
+  80028e:	50                   	push   %eax
+  80028f:	ff 75 08             	push   0x8(%ebp)
+  800292:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800298:	53                   	push   %ebx
+  800299:	e8 41 21 00 00       	call   8023df <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  80029e:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  8002a4:	89 c2                	mov    %eax,%edx
+  8002a6:	c1 e2 0c             	shl    $0xc,%edx
+  8002a9:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  8002af:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  8002b5:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  8002bb:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  8002be:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  8002c1:	e9 f2 fd ff ff       	jmp    8000b8 <page_vec_call+0x28>
+			r = 0;
+  8002c6:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  8002cb:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8002cf:	74 0b                	je     8002dc <page_vec_call+0x24c>
+		*done = total;
+  8002d1:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002d4:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  8002da:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  8002dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002df:	5b                   	pop    %ebx
+  8002e0:	5e                   	pop    %esi
+  8002e1:	5f                   	pop    %edi
+  8002e2:	5d                   	pop    %ebp
+  8002e3:	c3                   	ret
+
+008002e4 <sys_cputs>:
+{
+  8002e4:	55                   	push   %ebp
+  8002e5:	89 e5                	mov    %esp,%ebp
+  8002e7:	57                   	push   %edi
+  8002e8:	56                   	push   %esi
+  8002e9:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8002ea:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8002f1:	78 2d                	js     800320 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  8002f3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8002fa:	74 70                	je     80036c <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  8002fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800301:	8b 55 08             	mov    0x8(%ebp),%edx
+  800304:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800307:	89 c3                	mov    %eax,%ebx
+  800309:	89 c7                	mov    %eax,%edi
+  80030b:	89 c6                	mov    %eax,%esi
+  80030d:	55                   	push   %ebp
+  80030e:	68 17 03 80 00       	push   $0x800317
+  800313:	89 e5                	mov    %esp,%ebp
+  800315:	0f 34                	sysenter
+  800317:	83 c4 04             	add    $0x4,%esp
+  80031a:	5d                   	pop    %ebp
+}
+  80031b:	5b                   	pop    %ebx
+  80031c:	5e                   	pop    %esi
+  80031d:	5f                   	pop    %edi
+  80031e:	5d                   	pop    %ebp
+  80031f:	c3                   	ret
+  800320:	b8 01 00 00 00       	mov    $0x1,%eax
+  800325:	0f a2                	cpuid
+		return 0;
+  800327:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80032c:	f6 c6 08             	test   $0x8,%dh
+  80032f:	74 15                	je     800346 <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800331:	89 c2                	mov    %eax,%edx
+  800333:	c1 ea 08             	shr    $0x8,%edx
+  800336:	83 e2 0f             	and    $0xf,%edx
+  800339:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80033e:	83 fa 06             	cmp    $0x6,%edx
+  800341:	74 0e                	je     800351 <sys_cputs+0x6d>
+  800343:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800346:	0f b6 c9             	movzbl %cl,%ecx
+  800349:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80034f:	eb a2                	jmp    8002f3 <sys_cputs+0xf>
+  800351:	89 c2                	mov    %eax,%edx
+  800353:	c1 ea 04             	shr    $0x4,%edx
+  800356:	83 e2 0f             	and    $0xf,%edx
+  800359:	83 fa 02             	cmp    $0x2,%edx
+  80035c:	77 e5                	ja     800343 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  80035e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800361:	83 f8 02             	cmp    $0x2,%eax
+  800364:	0f 97 c1             	seta   %cl
+  800367:	0f b6 c9             	movzbl %cl,%ecx
+  80036a:	eb d7                	jmp    800343 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  80036c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800371:	8b 55 08             	mov    0x8(%ebp),%edx
+  800374:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800377:	89 c3                	mov    %eax,%ebx
+  800379:	89 c7                	mov    %eax,%edi
+  80037b:	89 c6                	mov    %eax,%esi
+  80037d:	cd 30                	int    $0x30
+}
+  80037f:	eb 9a                	jmp    80031b <sys_cputs+0x37>
+
+00800381 <sys_cgetc>:
+{
+  800381:	55                   	push   %ebp
+  800382:	89 e5                	mov    %esp,%ebp
+  800384:	57                   	push   %edi
+  800385:	56                   	push   %esi
+  800386:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800387:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80038e:	78 2e                	js     8003be <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  800390:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800397:	74 71                	je     80040a <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  800399:	ba 00 00 00 00       	mov    $0x0,%edx
+  80039e:	b8 01 00 00 00       	mov    $0x1,%eax
+  8003a3:	89 d1                	mov    %edx,%ecx
+  8003a5:	89 d3                	mov    %edx,%ebx
+  8003a7:	89 d7                	mov    %edx,%edi
+  8003a9:	89 d6                	mov    %edx,%esi
+  8003ab:	55                   	push   %ebp
+  8003ac:	68 b5 03 80 00       	push   $0x8003b5
+  8003b1:	89 e5                	mov    %esp,%ebp
+  8003b3:	0f 34                	sysenter
+  8003b5:	83 c4 04             	add    $0x4,%esp
+  8003b8:	5d                   	pop    %ebp
+}
+  8003b9:	5b                   	pop    %ebx
+  8003ba:	5e                   	pop    %esi
+  8003bb:	5f                   	pop    %edi
+  8003bc:	5d                   	pop    %ebp
+  8003bd:	c3                   	ret
+  8003be:	b8 01 00 00 00       	mov    $0x1,%eax
+  8003c3:	0f a2                	cpuid
+		return 0;
+  8003c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8003ca:	f6 c6 08             	test   $0x8,%dh
+  8003cd:	74 15                	je     8003e4 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8003cf:	89 c2                	mov    %eax,%edx
+  8003d1:	c1 ea 08             	shr    $0x8,%edx
+  8003d4:	83 e2 0f             	and    $0xf,%edx
+  8003d7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8003dc:	83 fa 06             	cmp    $0x6,%edx
+  8003df:	74 0e                	je     8003ef <sys_cgetc+0x6e>
+  8003e1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8003e4:	0f b6 c9             	movzbl %cl,%ecx
+  8003e7:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8003ed:	eb a1                	jmp    800390 <sys_cgetc+0xf>
+  8003ef:	89 c2                	mov    %eax,%edx
+  8003f1:	c1 ea 04             	shr    $0x4,%edx
+  8003f4:	83 e2 0f             	and    $0xf,%edx
+  8003f7:	83 fa 02             	cmp    $0x2,%edx
+  8003fa:	77 e5                	ja     8003e1 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  8003fc:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8003ff:	83 f8 02             	cmp    $0x2,%eax
+  800402:	0f 97 c1             	seta   %cl
+  800405:	0f b6 c9             	movzbl %cl,%ecx
+  800408:	eb d7                	jmp    8003e1 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  80040a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80040f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800414:	89 d1                	mov    %edx,%ecx
+  800416:	89 d3                	mov    %edx,%ebx
+  800418:	89 d7                	mov    %edx,%edi
+  80041a:	89 d6                	mov    %edx,%esi
+  80041c:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  80041e:	eb 99                	jmp    8003b9 <sys_cgetc+0x38>
+
+00800420 <sys_env_destroy>:
+{
+  800420:	55                   	push   %ebp
+  800421:	89 e5                	mov    %esp,%ebp
+  800423:	57                   	push   %edi
+  800424:	56                   	push   %esi
+  800425:	53                   	push   %ebx
+  800426:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800429:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800430:	78 36                	js     800468 <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  800432:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800439:	74 79                	je     8004b4 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  80043b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80043e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800443:	b8 03 00 00 00       	mov    $0x3,%eax
+  800448:	89 cb                	mov    %ecx,%ebx
+  80044a:	89 cf                	mov    %ecx,%edi
+  80044c:	89 ce                	mov    %ecx,%esi
+  80044e:	55                   	push   %ebp
+  80044f:	68 58 04 80 00       	push   $0x800458
+  800454:	89 e5                	mov    %esp,%ebp
+  800456:	0f 34                	sysenter
+  800458:	83 c4 04             	add    $0x4,%esp
+  80045b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80045c:	85 c0                	test   %eax,%eax
+  80045e:	7f 6b                	jg     8004cb <sys_env_destroy+0xab>
+}
+  800460:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800463:	5b                   	pop    %ebx
+  800464:	5e                   	pop    %esi
+  800465:	5f                   	pop    %edi
+  800466:	5d                   	pop    %ebp
+  800467:	c3                   	ret
+  800468:	b8 01 00 00 00       	mov    $0x1,%eax
+  80046d:	0f a2                	cpuid
+		return 0;
+  80046f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800474:	f6 c6 08             	test   $0x8,%dh
+  800477:	74 15                	je     80048e <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800479:	89 c2                	mov    %eax,%edx
+  80047b:	c1 ea 08             	shr    $0x8,%edx
+  80047e:	83 e2 0f             	and    $0xf,%edx
+  800481:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800486:	83 fa 06             	cmp    $0x6,%edx
+  800489:	74 0e                	je     800499 <sys_env_destroy+0x79>
+  80048b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80048e:	0f b6 c9             	movzbl %cl,%ecx
+  800491:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800497:	eb 99                	jmp    800432 <sys_env_destroy+0x12>
+  800499:	89 c2                	mov    %eax,%edx
+  80049b:	c1 ea 04             	shr    $0x4,%edx
+  80049e:	83 e2 0f             	and    $0xf,%edx
+  8004a1:	83 fa 02             	cmp    $0x2,%edx
+  8004a4:	77 e5                	ja     80048b <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  8004a6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8004a9:	83 f8 02             	cmp    $0x2,%eax
+  8004ac:	0f 97 c1             	seta   %cl
+  8004af:	0f b6 c9             	movzbl %cl,%ecx
+  8004b2:	eb d7                	jmp    80048b <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  8004b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004b9:	b8 03 00 00 00       	mov    $0x3,%eax
+  8004be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004c1:	89 cb                	mov    %ecx,%ebx
+  8004c3:	89 cf                	mov    %ecx,%edi
+  8004c5:	89 ce                	mov    %ecx,%esi
+  8004c7:	cd 30                	int    $0x30
+  8004c9:	eb 91                	jmp    80045c <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004cb:	83 ec 0c             	sub    $0xc,%esp
+  8004ce:	50                   	push   %eax
+  8004cf:	6a 03                	push   $0x3
+  8004d1:	68 aa 27 80 00       	push   $0x8027aa
+  8004d6:	6a 4a                	push   $0x4a
+  8004d8:	68 c7 27 80 00       	push   $0x8027c7
+  8004dd:	e8 1e 17 00 00       	call   801c00 <_panic>
+
+008004e2 <sys_getenvid>:
+{
+  8004e2:	55                   	push   %ebp
+  8004e3:	89 e5                	mov    %esp,%ebp
+  8004e5:	57                   	push   %edi
+  8004e6:	56                   	push   %esi
+  8004e7:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8004e8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8004ef:	78 2e                	js     80051f <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  8004f1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8004f8:	74 71                	je     80056b <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  8004fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004ff:	b8 02 00 00 00       	mov    $0x2,%eax
+  800504:	89 d1                	mov    %edx,%ecx
+  800506:	89 d3                	mov    %edx,%ebx
+  800508:	89 d7                	mov    %edx,%edi
+  80050a:	89 d6                	mov    %edx,%esi
+  80050c:	55                   	push   %ebp
+  80050d:	68 16 05 80 00       	push   $0x800516
+  800512:	89 e5                	mov    %esp,%ebp
+  800514:	0f 34                	sysenter
+  800516:	83 c4 04             	add    $0x4,%esp
+  800519:	5d                   	pop    %ebp
+}
+  80051a:	5b                   	pop    %ebx
+  80051b:	5e                   	pop    %esi
+  80051c:	5f                   	pop    %edi
+  80051d:	5d                   	pop    %ebp
+  80051e:	c3                   	ret
+  80051f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800524:	0f a2                	cpuid
+		return 0;
+  800526:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80052b:	f6 c6 08             	test   $0x8,%dh
+  80052e:	74 15                	je     800545 <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800530:	89 c2                	mov    %eax,%edx
+  800532:	c1 ea 08             	shr    $0x8,%edx
+  800535:	83 e2 0f             	and    $0xf,%edx
+  800538:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80053d:	83 fa 06             	cmp    $0x6,%edx
+  800540:	74 0e                	je     800550 <sys_getenvid+0x6e>
+  800542:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800545:	0f b6 c9             	movzbl %cl,%ecx
+  800548:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80054e:	eb a1                	jmp    8004f1 <sys_getenvid+0xf>
+  800550:	89 c2                	mov    %eax,%edx
+  800552:	c1 ea 04             	shr    $0x4,%edx
+  800555:	83 e2 0f             	and    $0xf,%edx
+  800558:	83 fa 02             	cmp    $0x2,%edx
+  80055b:	77 e5                	ja     800542 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  80055d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800560:	83 f8 02             	cmp    $0x2,%eax
+  800563:	0f 97 c1             	seta   %cl
+  800566:	0f b6 c9             	movzbl %cl,%ecx
+  800569:	eb d7                	jmp    800542 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  80056b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800570:	b8 02 00 00 00       	mov    $0x2,%eax
+  800575:	89 d1                	mov    %edx,%ecx
+  800577:	89 d3                	mov    %edx,%ebx
+  800579:	89 d7                	mov    %edx,%edi
+  80057b:	89 d6                	mov    %edx,%esi
+  80057d:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80057f:	eb 99                	jmp    80051a <sys_getenvid+0x38>
+
+00800581 <sys_page_alloc>:
+{
+  800581:	55                   	push   %ebp
+  800582:	89 e5                	mov    %esp,%ebp
+  800584:	57                   	push   %edi
+  800585:	56                   	push   %esi
+  800586:	53                   	push   %ebx
+  800587:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80058a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800591:	78 38                	js     8005cb <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  800593:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80059a:	74 7b                	je     800617 <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  80059c:	be 00 00 00 00       	mov    $0x0,%esi
+  8005a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005a7:	b8 04 00 00 00       	mov    $0x4,%eax
+  8005ac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005af:	89 f7                	mov    %esi,%edi
+  8005b1:	55                   	push   %ebp
+  8005b2:	68 bb 05 80 00       	push   $0x8005bb
+  8005b7:	89 e5                	mov    %esp,%ebp
+  8005b9:	0f 34                	sysenter
+  8005bb:	83 c4 04             	add    $0x4,%esp
+  8005be:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8005bf:	85 c0                	test   %eax,%eax
+  8005c1:	7f 6d                	jg     800630 <sys_page_alloc+0xaf>
+}
+  8005c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005c6:	5b                   	pop    %ebx
+  8005c7:	5e                   	pop    %esi
+  8005c8:	5f                   	pop    %edi
+  8005c9:	5d                   	pop    %ebp
+  8005ca:	c3                   	ret
+  8005cb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8005d0:	0f a2                	cpuid
+		return 0;
+  8005d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8005d7:	f6 c6 08             	test   $0x8,%dh
+  8005da:	74 15                	je     8005f1 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8005dc:	89 c2                	mov    %eax,%edx
+  8005de:	c1 ea 08             	shr    $0x8,%edx
+  8005e1:	83 e2 0f             	and    $0xf,%edx
+  8005e4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8005e9:	83 fa 06             	cmp    $0x6,%edx
+  8005ec:	74 0e                	je     8005fc <sys_page_alloc+0x7b>
+  8005ee:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8005f1:	0f b6 c9             	movzbl %cl,%ecx
+  8005f4:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8005fa:	eb 97                	jmp    800593 <sys_page_alloc+0x12>
+  8005fc:	89 c2                	mov    %eax,%edx
+  8005fe:	c1 ea 04             	shr    $0x4,%edx
+  800601:	83 e2 0f             	and    $0xf,%edx
+  800604:	83 fa 02             	cmp    $0x2,%edx
+  800607:	77 e5                	ja     8005ee <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  800609:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80060c:	83 f8 02             	cmp    $0x2,%eax
+  80060f:	0f 97 c1             	seta   %cl
+  800612:	0f b6 c9             	movzbl %cl,%ecx
+  800615:	eb d7                	jmp    8005ee <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  800617:	be 00 00 00 00       	mov    $0x0,%esi
+  80061c:	b8 04 00 00 00       	mov    $0x4,%eax
+  800621:	8b 55 08             	mov    0x8(%ebp),%edx
+  800624:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800627:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80062a:	89 f7                	mov    %esi,%edi
+  80062c:	cd 30                	int    $0x30
+  80062e:	eb 8f                	jmp    8005bf <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800630:	83 ec 0c             	sub    $0xc,%esp
+  800633:	50                   	push   %eax
+  800634:	6a 04                	push   $0x4
+  800636:	68 aa 27 80 00       	push   $0x8027aa
+  80063b:	6a 4a                	push   $0x4a
+  80063d:	68 c7 27 80 00       	push   $0x8027c7
+  800642:	e8 b9 15 00 00       	call   801c00 <_panic>
+
+00800647 <sys_page_map>:
+{
+  800647:	55                   	push   %ebp
+  800648:	89 e5                	mov    %esp,%ebp
+  80064a:	57                   	push   %edi
+  80064b:	56                   	push   %esi
+  80064c:	53                   	push   %ebx
+  80064d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800650:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800657:	78 37                	js     800690 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  800659:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800660:	74 7a                	je     8006dc <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  800662:	8b 55 08             	mov    0x8(%ebp),%edx
+  800665:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800668:	b8 05 00 00 00       	mov    $0x5,%eax
+  80066d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800670:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800673:	8b 75 18             	mov    0x18(%ebp),%esi
+  800676:	55                   	push   %ebp
+  800677:	68 80 06 80 00       	push   $0x800680
+  80067c:	89 e5                	mov    %esp,%ebp
+  80067e:	0f 34                	sysenter
+  800680:	83 c4 04             	add    $0x4,%esp
+  800683:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800684:	85 c0                	test   %eax,%eax
+  800686:	7f 6c                	jg     8006f4 <sys_page_map+0xad>
+}
+  800688:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80068b:	5b                   	pop    %ebx
+  80068c:	5e                   	pop    %esi
+  80068d:	5f                   	pop    %edi
+  80068e:	5d                   	pop    %ebp
+  80068f:	c3                   	ret
+  800690:	b8 01 00 00 00       	mov    $0x1,%eax
+  800695:	0f a2                	cpuid
+		return 0;
+  800697:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80069c:	f6 c6 08             	test   $0x8,%dh
+  80069f:	74 15                	je     8006b6 <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8006a1:	89 c2                	mov    %eax,%edx
+  8006a3:	c1 ea 08             	shr    $0x8,%edx
+  8006a6:	83 e2 0f             	and    $0xf,%edx
+  8006a9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8006ae:	83 fa 06             	cmp    $0x6,%edx
+  8006b1:	74 0e                	je     8006c1 <sys_page_map+0x7a>
+  8006b3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8006b6:	0f b6 c9             	movzbl %cl,%ecx
+  8006b9:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8006bf:	eb 98                	jmp    800659 <sys_page_map+0x12>
+  8006c1:	89 c2                	mov    %eax,%edx
+  8006c3:	c1 ea 04             	shr    $0x4,%edx
+  8006c6:	83 e2 0f             	and    $0xf,%edx
+  8006c9:	83 fa 02             	cmp    $0x2,%edx
+  8006cc:	77 e5                	ja     8006b3 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  8006ce:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8006d1:	83 f8 02             	cmp    $0x2,%eax
+  8006d4:	0f 97 c1             	seta   %cl
+  8006d7:	0f b6 c9             	movzbl %cl,%ecx
+  8006da:	eb d7                	jmp    8006b3 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  8006dc:	b8 05 00 00 00       	mov    $0x5,%eax
+  8006e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006e7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8006ea:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8006ed:	8b 75 18             	mov    0x18(%ebp),%esi
+  8006f0:	cd 30                	int    $0x30
+  8006f2:	eb 90                	jmp    800684 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8006f4:	83 ec 0c             	sub    $0xc,%esp
+  8006f7:	50                   	push   %eax
+  8006f8:	6a 05                	push   $0x5
+  8006fa:	68 aa 27 80 00       	push   $0x8027aa
+  8006ff:	6a 4a                	push   $0x4a
+  800701:	68 c7 27 80 00       	push   $0x8027c7
+  800706:	e8 f5 14 00 00       	call   801c00 <_panic>
+
+0080070b <sys_page_unmap>:
+{
+  80070b:	55                   	push   %ebp
+  80070c:	89 e5                	mov    %esp,%ebp
+  80070e:	57                   	push   %edi
+  80070f:	56                   	push   %esi
+  800710:	53                   	push   %ebx
+  800711:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800714:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80071b:	78 37                	js     800754 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  80071d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800724:	74 7a                	je     8007a0 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  800726:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80072b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80072e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800731:	b8 06 00 00 00       	mov    $0x6,%eax
+  800736:	89 df                	mov    %ebx,%edi
+  800738:	89 de                	mov    %ebx,%esi
+  80073a:	55                   	push   %ebp
+  80073b:	68 44 07 80 00       	push   $0x800744
+  800740:	89 e5                	mov    %esp,%ebp
+  800742:	0f 34                	sysenter
+  800744:	83 c4 04             	add    $0x4,%esp
+  800747:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800748:	85 c0                	test   %eax,%eax
+  80074a:	7f 6c                	jg     8007b8 <sys_page_unmap+0xad>
+}
+  80074c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80074f:	5b                   	pop    %ebx
+  800750:	5e                   	pop    %esi
+  800751:	5f                   	pop    %edi
+  800752:	5d                   	pop    %ebp
+  800753:	c3                   	ret
+  800754:	b8 01 00 00 00       	mov    $0x1,%eax
+  800759:	0f a2                	cpuid
+		return 0;
+  80075b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800760:	f6 c6 08             	test   $0x8,%dh
+  800763:	74 15                	je     80077a <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800765:	89 c2                	mov    %eax,%edx
+  800767:	c1 ea 08             	shr    $0x8,%edx
+  80076a:	83 e2 0f             	and    $0xf,%edx
+  80076d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800772:	83 fa 06             	cmp    $0x6,%edx
+  800775:	74 0e                	je     800785 <sys_page_unmap+0x7a>
+  800777:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80077a:	0f b6 c9             	movzbl %cl,%ecx
+  80077d:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800783:	eb 98                	jmp    80071d <sys_page_unmap+0x12>
+  800785:	89 c2                	mov    %eax,%edx
+  800787:	c1 ea 04             	shr    $0x4,%edx
+  80078a:	83 e2 0f             	and    $0xf,%edx
+  80078d:	83 fa 02             	cmp    $0x2,%edx
+  800790:	77 e5                	ja     800777 <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  800792:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800795:	83 f8 02             	cmp    $0x2,%eax
+  800798:	0f 97 c1             	seta   %cl
+  80079b:	0f b6 c9             	movzbl %cl,%ecx
+  80079e:	eb d7                	jmp    800777 <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  8007a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007a5:	b8 06 00 00 00       	mov    $0x6,%eax
+  8007aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007b0:	89 df                	mov    %ebx,%edi
+  8007b2:	89 de                	mov    %ebx,%esi
+  8007b4:	cd 30                	int    $0x30
+  8007b6:	eb 90                	jmp    800748 <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8007b8:	83 ec 0c             	sub    $0xc,%esp
+  8007bb:	50                   	push   %eax
+  8007bc:	6a 06                	push   $0x6
+  8007be:	68 aa 27 80 00       	push   $0x8027aa
+  8007c3:	6a 4a                	push   $0x4a
+  8007c5:	68 c7 27 80 00       	push   $0x8027c7
+  8007ca:	e8 31 14 00 00       	call   801c00 <_panic>
+
+008007cf <sys_page_copy>:
+{
+  8007cf:	55                   	push   %ebp
+  8007d0:	89 e5                	mov    %esp,%ebp
+  8007d2:	57                   	push   %edi
+  8007d3:	56                   	push   %esi
+  8007d4:	53                   	push   %ebx
+  8007d5:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8007d8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8007df:	78 37                	js     800818 <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  8007e1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8007e8:	74 7a                	je     800864 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  8007ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007f0:	b8 29 00 00 00       	mov    $0x29,%eax
+  8007f5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8007f8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8007fb:	8b 75 18             	mov    0x18(%ebp),%esi
+  8007fe:	55                   	push   %ebp
+  8007ff:	68 08 08 80 00       	push   $0x800808
+  800804:	89 e5                	mov    %esp,%ebp
+  800806:	0f 34                	sysenter
+  800808:	83 c4 04             	add    $0x4,%esp
+  80080b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80080c:	85 c0                	test   %eax,%eax
+  80080e:	7f 6c                	jg     80087c <sys_page_copy+0xad>
+}
+  800810:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800813:	5b                   	pop    %ebx
+  800814:	5e                   	pop    %esi
+  800815:	5f                   	pop    %edi
+  800816:	5d                   	pop    %ebp
+  800817:	c3                   	ret
+  800818:	b8 01 00 00 00       	mov    $0x1,%eax
+  80081d:	0f a2                	cpuid
+		return 0;
+  80081f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800824:	f6 c6 08             	test   $0x8,%dh
+  800827:	74 15                	je     80083e <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800829:	89 c2                	mov    %eax,%edx
+  80082b:	c1 ea 08             	shr    $0x8,%edx
+  80082e:	83 e2 0f             	and    $0xf,%edx
+  800831:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800836:	83 fa 06             	cmp    $0x6,%edx
+  800839:	74 0e                	je     800849 <sys_page_copy+0x7a>
+  80083b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80083e:	0f b6 c9             	movzbl %cl,%ecx
+  800841:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800847:	eb 98                	jmp    8007e1 <sys_page_copy+0x12>
+  800849:	89 c2                	mov    %eax,%edx
+  80084b:	c1 ea 04             	shr    $0x4,%edx
+  80084e:	83 e2 0f             	and    $0xf,%edx
+  800851:	83 fa 02             	cmp    $0x2,%edx
+  800854:	77 e5                	ja     80083b <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  800856:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800859:	83 f8 02             	cmp    $0x2,%eax
+  80085c:	0f 97 c1             	seta   %cl
+  80085f:	0f b6 c9             	movzbl %cl,%ecx
+  800862:	eb d7                	jmp    80083b <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  800864:	b8 29 00 00 00       	mov    $0x29,%eax
+  800869:	8b 55 08             	mov    0x8(%ebp),%edx
+  80086c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80086f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800872:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800875:	8b 75 18             	mov    0x18(%ebp),%esi
+  800878:	cd 30                	int    $0x30
+  80087a:	eb 90                	jmp    80080c <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80087c:	83 ec 0c             	sub    $0xc,%esp
+  80087f:	50                   	push   %eax
+  800880:	6a 29                	push   $0x29
+  800882:	68 aa 27 80 00       	push   $0x8027aa
+  800887:	6a 4a                	push   $0x4a
+  800889:	68 c7 27 80 00       	push   $0x8027c7
+  80088e:	e8 6d 13 00 00       	call   801c00 <_panic>
+
+00800893 <sys_yield>:
+{
+  800893:	55                   	push   %ebp
+  800894:	89 e5                	mov    %esp,%ebp
+  800896:	57                   	push   %edi
+  800897:	56                   	push   %esi
+  800898:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800899:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8008a0:	78 2e                	js     8008d0 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  8008a2:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8008a9:	74 71                	je     80091c <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  8008ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008b0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8008b5:	89 d1                	mov    %edx,%ecx
+  8008b7:	89 d3                	mov    %edx,%ebx
+  8008b9:	89 d7                	mov    %edx,%edi
+  8008bb:	89 d6                	mov    %edx,%esi
+  8008bd:	55                   	push   %ebp
+  8008be:	68 c7 08 80 00       	push   $0x8008c7
+  8008c3:	89 e5                	mov    %esp,%ebp
+  8008c5:	0f 34                	sysenter
+  8008c7:	83 c4 04             	add    $0x4,%esp
+  8008ca:	5d                   	pop    %ebp
+}
+  8008cb:	5b                   	pop    %ebx
+  8008cc:	5e                   	pop    %esi
+  8008cd:	5f                   	pop    %edi
+  8008ce:	5d                   	pop    %ebp
+  8008cf:	c3                   	ret
+  8008d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8008d5:	0f a2                	cpuid
+		return 0;
+  8008d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8008dc:	f6 c6 08             	test   $0x8,%dh
+  8008df:	74 15                	je     8008f6 <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8008e1:	89 c2                	mov    %eax,%edx
+  8008e3:	c1 ea 08             	shr    $0x8,%edx
+  8008e6:	83 e2 0f             	and    $0xf,%edx
+  8008e9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8008ee:	83 fa 06             	cmp    $0x6,%edx
+  8008f1:	74 0e                	je     800901 <sys_yield+0x6e>
+  8008f3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8008f6:	0f b6 c9             	movzbl %cl,%ecx
+  8008f9:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8008ff:	eb a1                	jmp    8008a2 <sys_yield+0xf>
+  800901:	89 c2                	mov    %eax,%edx
+  800903:	c1 ea 04             	shr    $0x4,%edx
+  800906:	83 e2 0f             	and    $0xf,%edx
+  800909:	83 fa 02             	cmp    $0x2,%edx
+  80090c:	77 e5                	ja     8008f3 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  80090e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800911:	83 f8 02             	cmp    $0x2,%eax
+  800914:	0f 97 c1             	seta   %cl
+  800917:	0f b6 c9             	movzbl %cl,%ecx
+  80091a:	eb d7                	jmp    8008f3 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  80091c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800921:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800926:	89 d1                	mov    %edx,%ecx
+  800928:	89 d3                	mov    %edx,%ebx
+  80092a:	89 d7                	mov    %edx,%edi
+  80092c:	89 d6                	mov    %edx,%esi
+  80092e:	cd 30                	int    $0x30
+}
+  800930:	eb 99                	jmp    8008cb <sys_yield+0x38>
+
+00800932 <sys_env_set_status>:
+{
+  800932:	55                   	push   %ebp
+  800933:	89 e5                	mov    %esp,%ebp
+  800935:	57                   	push   %edi
+  800936:	56                   	push   %esi
+  800937:	53                   	push   %ebx
+  800938:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80093b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800942:	78 37                	js     80097b <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  800944:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80094b:	74 7a                	je     8009c7 <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  80094d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800952:	8b 55 08             	mov    0x8(%ebp),%edx
+  800955:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800958:	b8 08 00 00 00       	mov    $0x8,%eax
+  80095d:	89 df                	mov    %ebx,%edi
+  80095f:	89 de                	mov    %ebx,%esi
+  800961:	55                   	push   %ebp
+  800962:	68 6b 09 80 00       	push   $0x80096b
+  800967:	89 e5                	mov    %esp,%ebp
+  800969:	0f 34                	sysenter
+  80096b:	83 c4 04             	add    $0x4,%esp
+  80096e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80096f:	85 c0                	test   %eax,%eax
+  800971:	7f 6c                	jg     8009df <sys_env_set_status+0xad>
+}
+  800973:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800976:	5b                   	pop    %ebx
+  800977:	5e                   	pop    %esi
+  800978:	5f                   	pop    %edi
+  800979:	5d                   	pop    %ebp
+  80097a:	c3                   	ret
+  80097b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800980:	0f a2                	cpuid
+		return 0;
+  800982:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800987:	f6 c6 08             	test   $0x8,%dh
+  80098a:	74 15                	je     8009a1 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80098c:	89 c2                	mov    %eax,%edx
+  80098e:	c1 ea 08             	shr    $0x8,%edx
+  800991:	83 e2 0f             	and    $0xf,%edx
+  800994:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800999:	83 fa 06             	cmp    $0x6,%edx
+  80099c:	74 0e                	je     8009ac <sys_env_set_status+0x7a>
+  80099e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8009a1:	0f b6 c9             	movzbl %cl,%ecx
+  8009a4:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8009aa:	eb 98                	jmp    800944 <sys_env_set_status+0x12>
+  8009ac:	89 c2                	mov    %eax,%edx
+  8009ae:	c1 ea 04             	shr    $0x4,%edx
+  8009b1:	83 e2 0f             	and    $0xf,%edx
+  8009b4:	83 fa 02             	cmp    $0x2,%edx
+  8009b7:	77 e5                	ja     80099e <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  8009b9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8009bc:	83 f8 02             	cmp    $0x2,%eax
+  8009bf:	0f 97 c1             	seta   %cl
+  8009c2:	0f b6 c9             	movzbl %cl,%ecx
+  8009c5:	eb d7                	jmp    80099e <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  8009c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009cc:	b8 08 00 00 00       	mov    $0x8,%eax
+  8009d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009d7:	89 df                	mov    %ebx,%edi
+  8009d9:	89 de                	mov    %ebx,%esi
+  8009db:	cd 30                	int    $0x30
+  8009dd:	eb 90                	jmp    80096f <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8009df:	83 ec 0c             	sub    $0xc,%esp
+  8009e2:	50                   	push   %eax
+  8009e3:	6a 08                	push   $0x8
+  8009e5:	68 aa 27 80 00       	push   $0x8027aa
+  8009ea:	6a 4a                	push   $0x4a
+  8009ec:	68 c7 27 80 00       	push   $0x8027c7
+  8009f1:	e8 0a 12 00 00       	call   801c00 <_panic>
+
+008009f6 <sys_sysinfo>:
+{
+  8009f6:	55                   	push   %ebp
+  8009f7:	89 e5                	mov    %esp,%ebp
+  8009f9:	57                   	push   %edi
+  8009fa:	56                   	push   %esi
+  8009fb:	53                   	push   %ebx
+  8009fc:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8009ff:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800a06:	78 36                	js     800a3e <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  800a08:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800a0f:	74 79                	je     800a8a <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  800a11:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a14:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a19:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800a1e:	89 cb                	mov    %ecx,%ebx
+  800a20:	89 cf                	mov    %ecx,%edi
+  800a22:	89 ce                	mov    %ecx,%esi
+  800a24:	55                   	push   %ebp
+  800a25:	68 2e 0a 80 00       	push   $0x800a2e
+  800a2a:	89 e5                	mov    %esp,%ebp
+  800a2c:	0f 34                	sysenter
+  800a2e:	83 c4 04             	add    $0x4,%esp
+  800a31:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800a32:	85 c0                	test   %eax,%eax
+  800a34:	7f 6b                	jg     800aa1 <sys_sysinfo+0xab>
+}
+  800a36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a39:	5b                   	pop    %ebx
+  800a3a:	5e                   	pop    %esi
+  800a3b:	5f                   	pop    %edi
+  800a3c:	5d                   	pop    %ebp
+  800a3d:	c3                   	ret
+  800a3e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800a43:	0f a2                	cpuid
+		return 0;
+  800a45:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800a4a:	f6 c6 08             	test   $0x8,%dh
+  800a4d:	74 15                	je     800a64 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800a4f:	89 c2                	mov    %eax,%edx
+  800a51:	c1 ea 08             	shr    $0x8,%edx
+  800a54:	83 e2 0f             	and    $0xf,%edx
+  800a57:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800a5c:	83 fa 06             	cmp    $0x6,%edx
+  800a5f:	74 0e                	je     800a6f <sys_sysinfo+0x79>
+  800a61:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800a64:	0f b6 c9             	movzbl %cl,%ecx
+  800a67:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800a6d:	eb 99                	jmp    800a08 <sys_sysinfo+0x12>
+  800a6f:	89 c2                	mov    %eax,%edx
+  800a71:	c1 ea 04             	shr    $0x4,%edx
+  800a74:	83 e2 0f             	and    $0xf,%edx
+  800a77:	83 fa 02             	cmp    $0x2,%edx
+  800a7a:	77 e5                	ja     800a61 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  800a7c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800a7f:	83 f8 02             	cmp    $0x2,%eax
+  800a82:	0f 97 c1             	seta   %cl
+  800a85:	0f b6 c9             	movzbl %cl,%ecx
+  800a88:	eb d7                	jmp    800a61 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  800a8a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a8f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800a94:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a97:	89 cb                	mov    %ecx,%ebx
+  800a99:	89 cf                	mov    %ecx,%edi
+  800a9b:	89 ce                	mov    %ecx,%esi
+  800a9d:	cd 30                	int    $0x30
+  800a9f:	eb 91                	jmp    800a32 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800aa1:	83 ec 0c             	sub    $0xc,%esp
+  800aa4:	50                   	push   %eax
+  800aa5:	6a 0b                	push   $0xb
+  800aa7:	68 aa 27 80 00       	push   $0x8027aa
+  800aac:	6a 4a                	push   $0x4a
+  800aae:	68 c7 27 80 00       	push   $0x8027c7
+  800ab3:	e8 48 11 00 00       	call   801c00 <_panic>
+
+00800ab8 <sys_env_set_trapframe>:
+{
+  800ab8:	55                   	push   %ebp
+  800ab9:	89 e5                	mov    %esp,%ebp
+  800abb:	57                   	push   %edi
+  800abc:	56                   	push   %esi
+  800abd:	53                   	push   %ebx
+  800abe:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800ac1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ac8:	78 37                	js     800b01 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  800aca:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ad1:	74 7a                	je     800b4d <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  800ad3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ad8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800adb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ade:	b8 13 00 00 00       	mov    $0x13,%eax
+  800ae3:	89 df                	mov    %ebx,%edi
+  800ae5:	89 de                	mov    %ebx,%esi
+  800ae7:	55                   	push   %ebp
+  800ae8:	68 f1 0a 80 00       	push   $0x800af1
+  800aed:	89 e5                	mov    %esp,%ebp
+  800aef:	0f 34                	sysenter
+  800af1:	83 c4 04             	add    $0x4,%esp
+  800af4:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800af5:	85 c0                	test   %eax,%eax
+  800af7:	7f 6c                	jg     800b65 <sys_env_set_trapframe+0xad>
+}
+  800af9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800afc:	5b                   	pop    %ebx
+  800afd:	5e                   	pop    %esi
+  800afe:	5f                   	pop    %edi
+  800aff:	5d                   	pop    %ebp
+  800b00:	c3                   	ret
+  800b01:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b06:	0f a2                	cpuid
+		return 0;
+  800b08:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800b0d:	f6 c6 08             	test   $0x8,%dh
+  800b10:	74 15                	je     800b27 <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800b12:	89 c2                	mov    %eax,%edx
+  800b14:	c1 ea 08             	shr    $0x8,%edx
+  800b17:	83 e2 0f             	and    $0xf,%edx
+  800b1a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800b1f:	83 fa 06             	cmp    $0x6,%edx
+  800b22:	74 0e                	je     800b32 <sys_env_set_trapframe+0x7a>
+  800b24:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800b27:	0f b6 c9             	movzbl %cl,%ecx
+  800b2a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800b30:	eb 98                	jmp    800aca <sys_env_set_trapframe+0x12>
+  800b32:	89 c2                	mov    %eax,%edx
+  800b34:	c1 ea 04             	shr    $0x4,%edx
+  800b37:	83 e2 0f             	and    $0xf,%edx
+  800b3a:	83 fa 02             	cmp    $0x2,%edx
+  800b3d:	77 e5                	ja     800b24 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  800b3f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800b42:	83 f8 02             	cmp    $0x2,%eax
+  800b45:	0f 97 c1             	seta   %cl
+  800b48:	0f b6 c9             	movzbl %cl,%ecx
+  800b4b:	eb d7                	jmp    800b24 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  800b4d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b52:	b8 13 00 00 00       	mov    $0x13,%eax
+  800b57:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b5d:	89 df                	mov    %ebx,%edi
+  800b5f:	89 de                	mov    %ebx,%esi
+  800b61:	cd 30                	int    $0x30
+  800b63:	eb 90                	jmp    800af5 <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b65:	83 ec 0c             	sub    $0xc,%esp
+  800b68:	50                   	push   %eax
+  800b69:	6a 13                	push   $0x13
+  800b6b:	68 aa 27 80 00       	push   $0x8027aa
+  800b70:	6a 4a                	push   $0x4a
+  800b72:	68 c7 27 80 00       	push   $0x8027c7
+  800b77:	e8 84 10 00 00       	call   801c00 <_panic>
+
+00800b7c <sys_env_set_stack_limit>:
+{
+  800b7c:	55                   	push   %ebp
+  800b7d:	89 e5                	mov    %esp,%ebp
+  800b7f:	57                   	push   %edi
+  800b80:	56                   	push   %esi
+  800b81:	53                   	push   %ebx
+  800b82:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800b85:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b8c:	78 37                	js     800bc5 <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  800b8e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b95:	74 7a                	je     800c11 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  800b97:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b9c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b9f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ba2:	b8 19 00 00 00       	mov    $0x19,%eax
+  800ba7:	89 df                	mov    %ebx,%edi
+  800ba9:	89 de                	mov    %ebx,%esi
+  800bab:	55                   	push   %ebp
+  800bac:	68 b5 0b 80 00       	push   $0x800bb5
+  800bb1:	89 e5                	mov    %esp,%ebp
+  800bb3:	0f 34                	sysenter
+  800bb5:	83 c4 04             	add    $0x4,%esp
+  800bb8:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800bb9:	85 c0                	test   %eax,%eax
+  800bbb:	7f 6c                	jg     800c29 <sys_env_set_stack_limit+0xad>
+}
+  800bbd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bc0:	5b                   	pop    %ebx
+  800bc1:	5e                   	pop    %esi
+  800bc2:	5f                   	pop    %edi
+  800bc3:	5d                   	pop    %ebp
+  800bc4:	c3                   	ret
+  800bc5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bca:	0f a2                	cpuid
+		return 0;
+  800bcc:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800bd1:	f6 c6 08             	test   $0x8,%dh
+  800bd4:	74 15                	je     800beb <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800bd6:	89 c2                	mov    %eax,%edx
+  800bd8:	c1 ea 08             	shr    $0x8,%edx
+  800bdb:	83 e2 0f             	and    $0xf,%edx
+  800bde:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800be3:	83 fa 06             	cmp    $0x6,%edx
+  800be6:	74 0e                	je     800bf6 <sys_env_set_stack_limit+0x7a>
+  800be8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800beb:	0f b6 c9             	movzbl %cl,%ecx
+  800bee:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800bf4:	eb 98                	jmp    800b8e <sys_env_set_stack_limit+0x12>
+  800bf6:	89 c2                	mov    %eax,%edx
+  800bf8:	c1 ea 04             	shr    $0x4,%edx
+  800bfb:	83 e2 0f             	and    $0xf,%edx
+  800bfe:	83 fa 02             	cmp    $0x2,%edx
+  800c01:	77 e5                	ja     800be8 <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  800c03:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c06:	83 f8 02             	cmp    $0x2,%eax
+  800c09:	0f 97 c1             	seta   %cl
+  800c0c:	0f b6 c9             	movzbl %cl,%ecx
+  800c0f:	eb d7                	jmp    800be8 <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  800c11:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c16:	b8 19 00 00 00       	mov    $0x19,%eax
+  800c1b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c1e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c21:	89 df                	mov    %ebx,%edi
+  800c23:	89 de                	mov    %ebx,%esi
+  800c25:	cd 30                	int    $0x30
+  800c27:	eb 90                	jmp    800bb9 <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c29:	83 ec 0c             	sub    $0xc,%esp
+  800c2c:	50                   	push   %eax
+  800c2d:	6a 19                	push   $0x19
+  800c2f:	68 aa 27 80 00       	push   $0x8027aa
+  800c34:	6a 4a                	push   $0x4a
+  800c36:	68 c7 27 80 00       	push   $0x8027c7
+  800c3b:	e8 c0 0f 00 00       	call   801c00 <_panic>
+
+00800c40 <sys_env_set_pgfault_upcall>:
+{
+  800c40:	55                   	push   %ebp
+  800c41:	89 e5                	mov    %esp,%ebp
+  800c43:	57                   	push   %edi
+  800c44:	56                   	push   %esi
+  800c45:	53                   	push   %ebx
+  800c46:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800c49:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800c50:	78 37                	js     800c89 <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  800c52:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800c59:	74 7a                	je     800cd5 <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  800c5b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c60:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c63:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c66:	b8 09 00 00 00       	mov    $0x9,%eax
+  800c6b:	89 df                	mov    %ebx,%edi
+  800c6d:	89 de                	mov    %ebx,%esi
+  800c6f:	55                   	push   %ebp
+  800c70:	68 79 0c 80 00       	push   $0x800c79
+  800c75:	89 e5                	mov    %esp,%ebp
+  800c77:	0f 34                	sysenter
+  800c79:	83 c4 04             	add    $0x4,%esp
+  800c7c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c7d:	85 c0                	test   %eax,%eax
+  800c7f:	7f 6c                	jg     800ced <sys_env_set_pgfault_upcall+0xad>
+}
+  800c81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c84:	5b                   	pop    %ebx
+  800c85:	5e                   	pop    %esi
+  800c86:	5f                   	pop    %edi
+  800c87:	5d                   	pop    %ebp
+  800c88:	c3                   	ret
+  800c89:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c8e:	0f a2                	cpuid
+		return 0;
+  800c90:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800c95:	f6 c6 08             	test   $0x8,%dh
+  800c98:	74 15                	je     800caf <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c9a:	89 c2                	mov    %eax,%edx
+  800c9c:	c1 ea 08             	shr    $0x8,%edx
+  800c9f:	83 e2 0f             	and    $0xf,%edx
+  800ca2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ca7:	83 fa 06             	cmp    $0x6,%edx
+  800caa:	74 0e                	je     800cba <sys_env_set_pgfault_upcall+0x7a>
+  800cac:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800caf:	0f b6 c9             	movzbl %cl,%ecx
+  800cb2:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800cb8:	eb 98                	jmp    800c52 <sys_env_set_pgfault_upcall+0x12>
+  800cba:	89 c2                	mov    %eax,%edx
+  800cbc:	c1 ea 04             	shr    $0x4,%edx
+  800cbf:	83 e2 0f             	and    $0xf,%edx
+  800cc2:	83 fa 02             	cmp    $0x2,%edx
+  800cc5:	77 e5                	ja     800cac <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  800cc7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800cca:	83 f8 02             	cmp    $0x2,%eax
+  800ccd:	0f 97 c1             	seta   %cl
+  800cd0:	0f b6 c9             	movzbl %cl,%ecx
+  800cd3:	eb d7                	jmp    800cac <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  800cd5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cda:	b8 09 00 00 00       	mov    $0x9,%eax
+  800cdf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce5:	89 df                	mov    %ebx,%edi
+  800ce7:	89 de                	mov    %ebx,%esi
+  800ce9:	cd 30                	int    $0x30
+  800ceb:	eb 90                	jmp    800c7d <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ced:	83 ec 0c             	sub    $0xc,%esp
+  800cf0:	50                   	push   %eax
+  800cf1:	6a 09                	push   $0x9
+  800cf3:	68 aa 27 80 00       	push   $0x8027aa
+  800cf8:	6a 4a                	push   $0x4a
+  800cfa:	68 c7 27 80 00       	push   $0x8027c7
+  800cff:	e8 fc 0e 00 00       	call   801c00 <_panic>
+
+00800d04 <sys_ipc_try_send>:
+{
+  800d04:	55                   	push   %ebp
+  800d05:	89 e5                	mov    %esp,%ebp
+  800d07:	57                   	push   %edi
+  800d08:	56                   	push   %esi
+  800d09:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800d0a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d11:	78 32                	js     800d45 <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  800d13:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d1a:	74 75                	je     800d91 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  800d1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d1f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d22:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d27:	be 00 00 00 00       	mov    $0x0,%esi
+  800d2c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d2f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d32:	55                   	push   %ebp
+  800d33:	68 3c 0d 80 00       	push   $0x800d3c
+  800d38:	89 e5                	mov    %esp,%ebp
+  800d3a:	0f 34                	sysenter
+  800d3c:	83 c4 04             	add    $0x4,%esp
+  800d3f:	5d                   	pop    %ebp
+}
+  800d40:	5b                   	pop    %ebx
+  800d41:	5e                   	pop    %esi
+  800d42:	5f                   	pop    %edi
+  800d43:	5d                   	pop    %ebp
+  800d44:	c3                   	ret
+  800d45:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d4a:	0f a2                	cpuid
+		return 0;
+  800d4c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800d51:	f6 c6 08             	test   $0x8,%dh
+  800d54:	74 15                	je     800d6b <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d56:	89 c2                	mov    %eax,%edx
+  800d58:	c1 ea 08             	shr    $0x8,%edx
+  800d5b:	83 e2 0f             	and    $0xf,%edx
+  800d5e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d63:	83 fa 06             	cmp    $0x6,%edx
+  800d66:	74 0e                	je     800d76 <sys_ipc_try_send+0x72>
+  800d68:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800d6b:	0f b6 c9             	movzbl %cl,%ecx
+  800d6e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800d74:	eb 9d                	jmp    800d13 <sys_ipc_try_send+0xf>
+  800d76:	89 c2                	mov    %eax,%edx
+  800d78:	c1 ea 04             	shr    $0x4,%edx
+  800d7b:	83 e2 0f             	and    $0xf,%edx
+  800d7e:	83 fa 02             	cmp    $0x2,%edx
+  800d81:	77 e5                	ja     800d68 <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  800d83:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d86:	83 f8 02             	cmp    $0x2,%eax
+  800d89:	0f 97 c1             	seta   %cl
+  800d8c:	0f b6 c9             	movzbl %cl,%ecx
+  800d8f:	eb d7                	jmp    800d68 <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  800d91:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d96:	be 00 00 00 00       	mov    $0x0,%esi
+  800d9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800da4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800da7:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  800da9:	eb 95                	jmp    800d40 <sys_ipc_try_send+0x3c>
+
+00800dab <sys_ipc_send>:
+{
+  800dab:	55                   	push   %ebp
+  800dac:	89 e5                	mov    %esp,%ebp
+  800dae:	57                   	push   %edi
+  800daf:	56                   	push   %esi
+  800db0:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800db1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800db8:	78 32                	js     800dec <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  800dba:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800dc1:	74 75                	je     800e38 <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  800dc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800dce:	be 00 00 00 00       	mov    $0x0,%esi
+  800dd3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dd6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dd9:	55                   	push   %ebp
+  800dda:	68 e3 0d 80 00       	push   $0x800de3
+  800ddf:	89 e5                	mov    %esp,%ebp
+  800de1:	0f 34                	sysenter
+  800de3:	83 c4 04             	add    $0x4,%esp
+  800de6:	5d                   	pop    %ebp
+}
+  800de7:	5b                   	pop    %ebx
+  800de8:	5e                   	pop    %esi
+  800de9:	5f                   	pop    %edi
+  800dea:	5d                   	pop    %ebp
+  800deb:	c3                   	ret
+  800dec:	b8 01 00 00 00       	mov    $0x1,%eax
+  800df1:	0f a2                	cpuid
+		return 0;
+  800df3:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800df8:	f6 c6 08             	test   $0x8,%dh
+  800dfb:	74 15                	je     800e12 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800dfd:	89 c2                	mov    %eax,%edx
+  800dff:	c1 ea 08             	shr    $0x8,%edx
+  800e02:	83 e2 0f             	and    $0xf,%edx
+  800e05:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e0a:	83 fa 06             	cmp    $0x6,%edx
+  800e0d:	74 0e                	je     800e1d <sys_ipc_send+0x72>
+  800e0f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e12:	0f b6 c9             	movzbl %cl,%ecx
+  800e15:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800e1b:	eb 9d                	jmp    800dba <sys_ipc_send+0xf>
+  800e1d:	89 c2                	mov    %eax,%edx
+  800e1f:	c1 ea 04             	shr    $0x4,%edx
+  800e22:	83 e2 0f             	and    $0xf,%edx
+  800e25:	83 fa 02             	cmp    $0x2,%edx
+  800e28:	77 e5                	ja     800e0f <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  800e2a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e2d:	83 f8 02             	cmp    $0x2,%eax
+  800e30:	0f 97 c1             	seta   %cl
+  800e33:	0f b6 c9             	movzbl %cl,%ecx
+  800e36:	eb d7                	jmp    800e0f <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  800e38:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800e3d:	be 00 00 00 00       	mov    $0x0,%esi
+  800e42:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e45:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e48:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e4b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e4e:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  800e50:	eb 95                	jmp    800de7 <sys_ipc_send+0x3c>
+
+00800e52 <sys_ipc_recv>:
+{
+  800e52:	55                   	push   %ebp
+  800e53:	89 e5                	mov    %esp,%ebp
+  800e55:	57                   	push   %edi
+  800e56:	56                   	push   %esi
+  800e57:	53                   	push   %ebx
+  800e58:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800e5b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e62:	78 36                	js     800e9a <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  800e64:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e6b:	74 79                	je     800ee6 <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  800e6d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e70:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e75:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e7a:	89 cb                	mov    %ecx,%ebx
+  800e7c:	89 cf                	mov    %ecx,%edi
+  800e7e:	89 ce                	mov    %ecx,%esi
+  800e80:	55                   	push   %ebp
+  800e81:	68 8a 0e 80 00       	push   $0x800e8a
+  800e86:	89 e5                	mov    %esp,%ebp
+  800e88:	0f 34                	sysenter
+  800e8a:	83 c4 04             	add    $0x4,%esp
+  800e8d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e8e:	85 c0                	test   %eax,%eax
+  800e90:	7f 6b                	jg     800efd <sys_ipc_recv+0xab>
+}
+  800e92:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e95:	5b                   	pop    %ebx
+  800e96:	5e                   	pop    %esi
+  800e97:	5f                   	pop    %edi
+  800e98:	5d                   	pop    %ebp
+  800e99:	c3                   	ret
+  800e9a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e9f:	0f a2                	cpuid
+		return 0;
+  800ea1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800ea6:	f6 c6 08             	test   $0x8,%dh
+  800ea9:	74 15                	je     800ec0 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800eab:	89 c2                	mov    %eax,%edx
+  800ead:	c1 ea 08             	shr    $0x8,%edx
+  800eb0:	83 e2 0f             	and    $0xf,%edx
+  800eb3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800eb8:	83 fa 06             	cmp    $0x6,%edx
+  800ebb:	74 0e                	je     800ecb <sys_ipc_recv+0x79>
+  800ebd:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800ec0:	0f b6 c9             	movzbl %cl,%ecx
+  800ec3:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800ec9:	eb 99                	jmp    800e64 <sys_ipc_recv+0x12>
+  800ecb:	89 c2                	mov    %eax,%edx
+  800ecd:	c1 ea 04             	shr    $0x4,%edx
+  800ed0:	83 e2 0f             	and    $0xf,%edx
+  800ed3:	83 fa 02             	cmp    $0x2,%edx
+  800ed6:	77 e5                	ja     800ebd <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  800ed8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800edb:	83 f8 02             	cmp    $0x2,%eax
+  800ede:	0f 97 c1             	seta   %cl
+  800ee1:	0f b6 c9             	movzbl %cl,%ecx
+  800ee4:	eb d7                	jmp    800ebd <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  800ee6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800eeb:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ef0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef3:	89 cb                	mov    %ecx,%ebx
+  800ef5:	89 cf                	mov    %ecx,%edi
+  800ef7:	89 ce                	mov    %ecx,%esi
+  800ef9:	cd 30                	int    $0x30
+  800efb:	eb 91                	jmp    800e8e <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800efd:	83 ec 0c             	sub    $0xc,%esp
+  800f00:	50                   	push   %eax
+  800f01:	6a 0d                	push   $0xd
+  800f03:	68 aa 27 80 00       	push   $0x8027aa
+  800f08:	6a 4a                	push   $0x4a
+  800f0a:	68 c7 27 80 00       	push   $0x8027c7
+  800f0f:	e8 ec 0c 00 00       	call   801c00 <_panic>
+
+00800f14 <sys_ipc_send_range>:
+{
+  800f14:	55                   	push   %ebp
+  800f15:	89 e5                	mov    %esp,%ebp
+  800f17:	57                   	push   %edi
+  800f18:	56                   	push   %esi
+  800f19:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800f1a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f21:	78 30                	js     800f53 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  800f23:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f2a:	74 73                	je     800f9f <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  800f2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f32:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  800f37:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f3a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f3d:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f40:	55                   	push   %ebp
+  800f41:	68 4a 0f 80 00       	push   $0x800f4a
+  800f46:	89 e5                	mov    %esp,%ebp
+  800f48:	0f 34                	sysenter
+  800f4a:	83 c4 04             	add    $0x4,%esp
+  800f4d:	5d                   	pop    %ebp
+}
+  800f4e:	5b                   	pop    %ebx
+  800f4f:	5e                   	pop    %esi
+  800f50:	5f                   	pop    %edi
+  800f51:	5d                   	pop    %ebp
+  800f52:	c3                   	ret
+  800f53:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f58:	0f a2                	cpuid
+		return 0;
+  800f5a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f5f:	f6 c6 08             	test   $0x8,%dh
+  800f62:	74 15                	je     800f79 <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f64:	89 c2                	mov    %eax,%edx
+  800f66:	c1 ea 08             	shr    $0x8,%edx
+  800f69:	83 e2 0f             	and    $0xf,%edx
+  800f6c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f71:	83 fa 06             	cmp    $0x6,%edx
+  800f74:	74 0e                	je     800f84 <sys_ipc_send_range+0x70>
+  800f76:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f79:	0f b6 c9             	movzbl %cl,%ecx
+  800f7c:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800f82:	eb 9f                	jmp    800f23 <sys_ipc_send_range+0xf>
+  800f84:	89 c2                	mov    %eax,%edx
+  800f86:	c1 ea 04             	shr    $0x4,%edx
+  800f89:	83 e2 0f             	and    $0xf,%edx
+  800f8c:	83 fa 02             	cmp    $0x2,%edx
+  800f8f:	77 e5                	ja     800f76 <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  800f91:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f94:	83 f8 02             	cmp    $0x2,%eax
+  800f97:	0f 97 c1             	seta   %cl
+  800f9a:	0f b6 c9             	movzbl %cl,%ecx
+  800f9d:	eb d7                	jmp    800f76 <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  800f9f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  800fa4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800faa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fad:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fb0:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fb3:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  800fb5:	eb 97                	jmp    800f4e <sys_ipc_send_range+0x3a>
+
+00800fb7 <sys_ipc_recv_range>:
+{
+  800fb7:	55                   	push   %ebp
+  800fb8:	89 e5                	mov    %esp,%ebp
+  800fba:	57                   	push   %edi
+  800fbb:	56                   	push   %esi
+  800fbc:	53                   	push   %ebx
+  800fbd:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800fc0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fc7:	78 37                	js     801000 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  800fc9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fd0:	74 7a                	je     80104c <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  800fd2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fda:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fdd:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800fe2:	89 df                	mov    %ebx,%edi
+  800fe4:	89 de                	mov    %ebx,%esi
+  800fe6:	55                   	push   %ebp
+  800fe7:	68 f0 0f 80 00       	push   $0x800ff0
+  800fec:	89 e5                	mov    %esp,%ebp
+  800fee:	0f 34                	sysenter
+  800ff0:	83 c4 04             	add    $0x4,%esp
+  800ff3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ff4:	85 c0                	test   %eax,%eax
+  800ff6:	7f 6c                	jg     801064 <sys_ipc_recv_range+0xad>
+}
+  800ff8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ffb:	5b                   	pop    %ebx
+  800ffc:	5e                   	pop    %esi
+  800ffd:	5f                   	pop    %edi
+  800ffe:	5d                   	pop    %ebp
+  800fff:	c3                   	ret
+  801000:	b8 01 00 00 00       	mov    $0x1,%eax
+  801005:	0f a2                	cpuid
+		return 0;
+  801007:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80100c:	f6 c6 08             	test   $0x8,%dh
+  80100f:	74 15                	je     801026 <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801011:	89 c2                	mov    %eax,%edx
+  801013:	c1 ea 08             	shr    $0x8,%edx
+  801016:	83 e2 0f             	and    $0xf,%edx
+  801019:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80101e:	83 fa 06             	cmp    $0x6,%edx
+  801021:	74 0e                	je     801031 <sys_ipc_recv_range+0x7a>
+  801023:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801026:	0f b6 c9             	movzbl %cl,%ecx
+  801029:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80102f:	eb 98                	jmp    800fc9 <sys_ipc_recv_range+0x12>
+  801031:	89 c2                	mov    %eax,%edx
+  801033:	c1 ea 04             	shr    $0x4,%edx
+  801036:	83 e2 0f             	and    $0xf,%edx
+  801039:	83 fa 02             	cmp    $0x2,%edx
+  80103c:	77 e5                	ja     801023 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  80103e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801041:	83 f8 02             	cmp    $0x2,%eax
+  801044:	0f 97 c1             	seta   %cl
+  801047:	0f b6 c9             	movzbl %cl,%ecx
+  80104a:	eb d7                	jmp    801023 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  80104c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801051:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801056:	8b 55 08             	mov    0x8(%ebp),%edx
+  801059:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80105c:	89 df                	mov    %ebx,%edi
+  80105e:	89 de                	mov    %ebx,%esi
+  801060:	cd 30                	int    $0x30
+  801062:	eb 90                	jmp    800ff4 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801064:	83 ec 0c             	sub    $0xc,%esp
+  801067:	50                   	push   %eax
+  801068:	6a 1f                	push   $0x1f
+  80106a:	68 aa 27 80 00       	push   $0x8027aa
+  80106f:	6a 4a                	push   $0x4a
+  801071:	68 c7 27 80 00       	push   $0x8027c7
+  801076:	e8 85 0b 00 00       	call   801c00 <_panic>
+
+0080107b <sys_ipc_call>:
+{
+  80107b:	55                   	push   %ebp
+  80107c:	89 e5                	mov    %esp,%ebp
+  80107e:	57                   	push   %edi
+  80107f:	56                   	push   %esi
+  801080:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801081:	8b 55 08             	mov    0x8(%ebp),%edx
+  801084:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801089:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80108c:	55                   	push   %ebp
+  80108d:	56                   	push   %esi
+  80108e:	8b 0e                	mov    (%esi),%ecx
+  801090:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801093:	8b 7e 08             	mov    0x8(%esi),%edi
+  801096:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801099:	8b 76 0c             	mov    0xc(%esi),%esi
+  80109c:	cd 30                	int    $0x30
+  80109e:	87 34 24             	xchg   %esi,(%esp)
+  8010a1:	89 0e                	mov    %ecx,(%esi)
+  8010a3:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8010a6:	89 7e 08             	mov    %edi,0x8(%esi)
+  8010a9:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8010ac:	8f 46 0c             	pop    0xc(%esi)
+  8010af:	5d                   	pop    %ebp
+}
+  8010b0:	5b                   	pop    %ebx
+  8010b1:	5e                   	pop    %esi
+  8010b2:	5f                   	pop    %edi
+  8010b3:	5d                   	pop    %ebp
+  8010b4:	c3                   	ret
+
+008010b5 <sys_ipc_reply_wait>:
+{
+  8010b5:	55                   	push   %ebp
+  8010b6:	89 e5                	mov    %esp,%ebp
+  8010b8:	57                   	push   %edi
+  8010b9:	56                   	push   %esi
+  8010ba:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010be:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8010c3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8010c6:	55                   	push   %ebp
+  8010c7:	56                   	push   %esi
+  8010c8:	8b 0e                	mov    (%esi),%ecx
+  8010ca:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8010cd:	8b 7e 08             	mov    0x8(%esi),%edi
+  8010d0:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8010d3:	8b 76 0c             	mov    0xc(%esi),%esi
+  8010d6:	cd 30                	int    $0x30
+  8010d8:	87 34 24             	xchg   %esi,(%esp)
+  8010db:	89 0e                	mov    %ecx,(%esi)
+  8010dd:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8010e0:	89 7e 08             	mov    %edi,0x8(%esi)
+  8010e3:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8010e6:	8f 46 0c             	pop    0xc(%esi)
+  8010e9:	5d                   	pop    %ebp
+}
+  8010ea:	5b                   	pop    %ebx
+  8010eb:	5e                   	pop    %esi
+  8010ec:	5f                   	pop    %edi
+  8010ed:	5d                   	pop    %ebp
+  8010ee:	c3                   	ret
+
+008010ef <sys_ipc_send_msg>:
+{
+  8010ef:	55                   	push   %ebp
+  8010f0:	89 e5                	mov    %esp,%ebp
+  8010f2:	57                   	push   %edi
+  8010f3:	56                   	push   %esi
+  8010f4:	53                   	push   %ebx
+  8010f5:	83 ec 20             	sub    $0x20,%esp
+  8010f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  8010fb:	8b 10                	mov    (%eax),%edx
+  8010fd:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801100:	8b 50 04             	mov    0x4(%eax),%edx
+  801103:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801106:	8b 50 08             	mov    0x8(%eax),%edx
+  801109:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  80110c:	8b 50 0c             	mov    0xc(%eax),%edx
+  80110f:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801112:	8b 40 10             	mov    0x10(%eax),%eax
+  801115:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801118:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  80111b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80111e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801123:	55                   	push   %ebp
+  801124:	56                   	push   %esi
+  801125:	8b 0e                	mov    (%esi),%ecx
+  801127:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80112a:	8b 7e 08             	mov    0x8(%esi),%edi
+  80112d:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801130:	8b 76 0c             	mov    0xc(%esi),%esi
+  801133:	cd 30                	int    $0x30
+  801135:	87 34 24             	xchg   %esi,(%esp)
+  801138:	89 0e                	mov    %ecx,(%esi)
+  80113a:	89 5e 04             	mov    %ebx,0x4(%esi)
+  80113d:	89 7e 08             	mov    %edi,0x8(%esi)
+  801140:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801143:	8f 46 0c             	pop    0xc(%esi)
+  801146:	5d                   	pop    %ebp
+}
+  801147:	83 c4 20             	add    $0x20,%esp
+  80114a:	5b                   	pop    %ebx
+  80114b:	5e                   	pop    %esi
+  80114c:	5f                   	pop    %edi
+  80114d:	5d                   	pop    %ebp
+  80114e:	c3                   	ret
+
+0080114f <sys_fork>:
+{
+  80114f:	55                   	push   %ebp
+  801150:	89 e5                	mov    %esp,%ebp
+  801152:	57                   	push   %edi
+  801153:	56                   	push   %esi
+  801154:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801155:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80115c:	78 2e                	js     80118c <sys_fork+0x3d>
+	if (syscall_sysenter)
+  80115e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801165:	74 71                	je     8011d8 <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801167:	ba 00 00 00 00       	mov    $0x0,%edx
+  80116c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801171:	89 d1                	mov    %edx,%ecx
+  801173:	89 d3                	mov    %edx,%ebx
+  801175:	89 d7                	mov    %edx,%edi
+  801177:	89 d6                	mov    %edx,%esi
+  801179:	55                   	push   %ebp
+  80117a:	68 83 11 80 00       	push   $0x801183
+  80117f:	89 e5                	mov    %esp,%ebp
+  801181:	0f 34                	sysenter
+  801183:	83 c4 04             	add    $0x4,%esp
+  801186:	5d                   	pop    %ebp
+}
+  801187:	5b                   	pop    %ebx
+  801188:	5e                   	pop    %esi
+  801189:	5f                   	pop    %edi
+  80118a:	5d                   	pop    %ebp
+  80118b:	c3                   	ret
+  80118c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801191:	0f a2                	cpuid
+		return 0;
+  801193:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801198:	f6 c6 08             	test   $0x8,%dh
+  80119b:	74 15                	je     8011b2 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80119d:	89 c2                	mov    %eax,%edx
+  80119f:	c1 ea 08             	shr    $0x8,%edx
+  8011a2:	83 e2 0f             	and    $0xf,%edx
+  8011a5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011aa:	83 fa 06             	cmp    $0x6,%edx
+  8011ad:	74 0e                	je     8011bd <sys_fork+0x6e>
+  8011af:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8011b2:	0f b6 c9             	movzbl %cl,%ecx
+  8011b5:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8011bb:	eb a1                	jmp    80115e <sys_fork+0xf>
+  8011bd:	89 c2                	mov    %eax,%edx
+  8011bf:	c1 ea 04             	shr    $0x4,%edx
+  8011c2:	83 e2 0f             	and    $0xf,%edx
+  8011c5:	83 fa 02             	cmp    $0x2,%edx
+  8011c8:	77 e5                	ja     8011af <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  8011ca:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011cd:	83 f8 02             	cmp    $0x2,%eax
+  8011d0:	0f 97 c1             	seta   %cl
+  8011d3:	0f b6 c9             	movzbl %cl,%ecx
+  8011d6:	eb d7                	jmp    8011af <sys_fork+0x60>
+		asm volatile("int %1\n"
+  8011d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011dd:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011e2:	89 d1                	mov    %edx,%ecx
+  8011e4:	89 d3                	mov    %edx,%ebx
+  8011e6:	89 d7                	mov    %edx,%edi
+  8011e8:	89 d6                	mov    %edx,%esi
+  8011ea:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  8011ec:	eb 99                	jmp    801187 <sys_fork+0x38>
+
+008011ee <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  8011ee:	55                   	push   %ebp
+  8011ef:	89 e5                	mov    %esp,%ebp
+  8011f1:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  8011f4:	ff 75 14             	push   0x14(%ebp)
+  8011f7:	ff 75 10             	push   0x10(%ebp)
+  8011fa:	ff 75 0c             	push   0xc(%ebp)
+  8011fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801202:	8b 55 08             	mov    0x8(%ebp),%edx
+  801205:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80120a:	e8 81 ee ff ff       	call   800090 <page_vec_call>
+}
+  80120f:	c9                   	leave
+  801210:	c3                   	ret
+
+00801211 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801211:	55                   	push   %ebp
+  801212:	89 e5                	mov    %esp,%ebp
+  801214:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801217:	ff 75 18             	push   0x18(%ebp)
+  80121a:	ff 75 14             	push   0x14(%ebp)
+  80121d:	ff 75 10             	push   0x10(%ebp)
+  801220:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801223:	8b 55 08             	mov    0x8(%ebp),%edx
+  801226:	b8 10 00 00 00       	mov    $0x10,%eax
+  80122b:	e8 60 ee ff ff       	call   800090 <page_vec_call>
+}
+  801230:	c9                   	leave
+  801231:	c3                   	ret
+
+00801232 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801232:	55                   	push   %ebp
+  801233:	89 e5                	mov    %esp,%ebp
+  801235:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801238:	ff 75 14             	push   0x14(%ebp)
+  80123b:	ff 75 10             	push   0x10(%ebp)
+  80123e:	ff 75 0c             	push   0xc(%ebp)
+  801241:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801246:	8b 55 08             	mov    0x8(%ebp),%edx
+  801249:	b8 11 00 00 00       	mov    $0x11,%eax
+  80124e:	e8 3d ee ff ff       	call   800090 <page_vec_call>
+}
+  801253:	c9                   	leave
+  801254:	c3                   	ret
+
+00801255 <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801255:	55                   	push   %ebp
+  801256:	89 e5                	mov    %esp,%ebp
+  801258:	57                   	push   %edi
+  801259:	56                   	push   %esi
+  80125a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80125b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801262:	78 32                	js     801296 <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801264:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80126b:	74 75                	je     8012e2 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  80126d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801270:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801273:	b8 12 00 00 00       	mov    $0x12,%eax
+  801278:	be 00 00 00 00       	mov    $0x0,%esi
+  80127d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801280:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801283:	55                   	push   %ebp
+  801284:	68 8d 12 80 00       	push   $0x80128d
+  801289:	89 e5                	mov    %esp,%ebp
+  80128b:	0f 34                	sysenter
+  80128d:	83 c4 04             	add    $0x4,%esp
+  801290:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801291:	5b                   	pop    %ebx
+  801292:	5e                   	pop    %esi
+  801293:	5f                   	pop    %edi
+  801294:	5d                   	pop    %ebp
+  801295:	c3                   	ret
+  801296:	b8 01 00 00 00       	mov    $0x1,%eax
+  80129b:	0f a2                	cpuid
+		return 0;
+  80129d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8012a2:	f6 c6 08             	test   $0x8,%dh
+  8012a5:	74 15                	je     8012bc <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012a7:	89 c2                	mov    %eax,%edx
+  8012a9:	c1 ea 08             	shr    $0x8,%edx
+  8012ac:	83 e2 0f             	and    $0xf,%edx
+  8012af:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012b4:	83 fa 06             	cmp    $0x6,%edx
+  8012b7:	74 0e                	je     8012c7 <sys_vm_ranges+0x72>
+  8012b9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8012bc:	0f b6 c9             	movzbl %cl,%ecx
+  8012bf:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8012c5:	eb 9d                	jmp    801264 <sys_vm_ranges+0xf>
+  8012c7:	89 c2                	mov    %eax,%edx
+  8012c9:	c1 ea 04             	shr    $0x4,%edx
+  8012cc:	83 e2 0f             	and    $0xf,%edx
+  8012cf:	83 fa 02             	cmp    $0x2,%edx
+  8012d2:	77 e5                	ja     8012b9 <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  8012d4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012d7:	83 f8 02             	cmp    $0x2,%eax
+  8012da:	0f 97 c1             	seta   %cl
+  8012dd:	0f b6 c9             	movzbl %cl,%ecx
+  8012e0:	eb d7                	jmp    8012b9 <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  8012e2:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012f5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012f8:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  8012fa:	eb 95                	jmp    801291 <sys_vm_ranges+0x3c>
+
+008012fc <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  8012fc:	55                   	push   %ebp
+  8012fd:	89 e5                	mov    %esp,%ebp
+  8012ff:	57                   	push   %edi
+  801300:	56                   	push   %esi
+  801301:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801302:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801309:	78 31                	js     80133c <sys_spawn+0x40>
+	if (syscall_sysenter)
+  80130b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801312:	74 74                	je     801388 <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801314:	be 00 00 00 00       	mov    $0x0,%esi
+  801319:	8b 55 08             	mov    0x8(%ebp),%edx
+  80131c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80131f:	b8 14 00 00 00       	mov    $0x14,%eax
+  801324:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801327:	89 f7                	mov    %esi,%edi
+  801329:	55                   	push   %ebp
+  80132a:	68 33 13 80 00       	push   $0x801333
+  80132f:	89 e5                	mov    %esp,%ebp
+  801331:	0f 34                	sysenter
+  801333:	83 c4 04             	add    $0x4,%esp
+  801336:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801337:	5b                   	pop    %ebx
+  801338:	5e                   	pop    %esi
+  801339:	5f                   	pop    %edi
+  80133a:	5d                   	pop    %ebp
+  80133b:	c3                   	ret
+  80133c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801341:	0f a2                	cpuid
+		return 0;
+  801343:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801348:	f6 c6 08             	test   $0x8,%dh
+  80134b:	74 15                	je     801362 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80134d:	89 c2                	mov    %eax,%edx
+  80134f:	c1 ea 08             	shr    $0x8,%edx
+  801352:	83 e2 0f             	and    $0xf,%edx
+  801355:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80135a:	83 fa 06             	cmp    $0x6,%edx
+  80135d:	74 0e                	je     80136d <sys_spawn+0x71>
+  80135f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801362:	0f b6 c9             	movzbl %cl,%ecx
+  801365:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80136b:	eb 9e                	jmp    80130b <sys_spawn+0xf>
+  80136d:	89 c2                	mov    %eax,%edx
+  80136f:	c1 ea 04             	shr    $0x4,%edx
+  801372:	83 e2 0f             	and    $0xf,%edx
+  801375:	83 fa 02             	cmp    $0x2,%edx
+  801378:	77 e5                	ja     80135f <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  80137a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80137d:	83 f8 02             	cmp    $0x2,%eax
+  801380:	0f 97 c1             	seta   %cl
+  801383:	0f b6 c9             	movzbl %cl,%ecx
+  801386:	eb d7                	jmp    80135f <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  801388:	be 00 00 00 00       	mov    $0x0,%esi
+  80138d:	b8 14 00 00 00       	mov    $0x14,%eax
+  801392:	8b 55 08             	mov    0x8(%ebp),%edx
+  801395:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801398:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80139b:	89 f7                	mov    %esi,%edi
+  80139d:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  80139f:	eb 96                	jmp    801337 <sys_spawn+0x3b>
+
+008013a1 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  8013a1:	55                   	push   %ebp
+  8013a2:	89 e5                	mov    %esp,%ebp
+  8013a4:	57                   	push   %edi
+  8013a5:	56                   	push   %esi
+  8013a6:	53                   	push   %ebx
+  8013a7:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8013aa:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8013b1:	78 37                	js     8013ea <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  8013b3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8013ba:	74 7a                	je     801436 <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  8013bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c7:	b8 15 00 00 00       	mov    $0x15,%eax
+  8013cc:	89 df                	mov    %ebx,%edi
+  8013ce:	89 de                	mov    %ebx,%esi
+  8013d0:	55                   	push   %ebp
+  8013d1:	68 da 13 80 00       	push   $0x8013da
+  8013d6:	89 e5                	mov    %esp,%ebp
+  8013d8:	0f 34                	sysenter
+  8013da:	83 c4 04             	add    $0x4,%esp
+  8013dd:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8013de:	85 c0                	test   %eax,%eax
+  8013e0:	7f 6c                	jg     80144e <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  8013e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e5:	5b                   	pop    %ebx
+  8013e6:	5e                   	pop    %esi
+  8013e7:	5f                   	pop    %edi
+  8013e8:	5d                   	pop    %ebp
+  8013e9:	c3                   	ret
+  8013ea:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013ef:	0f a2                	cpuid
+		return 0;
+  8013f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8013f6:	f6 c6 08             	test   $0x8,%dh
+  8013f9:	74 15                	je     801410 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013fb:	89 c2                	mov    %eax,%edx
+  8013fd:	c1 ea 08             	shr    $0x8,%edx
+  801400:	83 e2 0f             	and    $0xf,%edx
+  801403:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801408:	83 fa 06             	cmp    $0x6,%edx
+  80140b:	74 0e                	je     80141b <sys_shm_create+0x7a>
+  80140d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801410:	0f b6 c9             	movzbl %cl,%ecx
+  801413:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801419:	eb 98                	jmp    8013b3 <sys_shm_create+0x12>
+  80141b:	89 c2                	mov    %eax,%edx
+  80141d:	c1 ea 04             	shr    $0x4,%edx
+  801420:	83 e2 0f             	and    $0xf,%edx
+  801423:	83 fa 02             	cmp    $0x2,%edx
+  801426:	77 e5                	ja     80140d <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  801428:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80142b:	83 f8 02             	cmp    $0x2,%eax
+  80142e:	0f 97 c1             	seta   %cl
+  801431:	0f b6 c9             	movzbl %cl,%ecx
+  801434:	eb d7                	jmp    80140d <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  801436:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80143b:	b8 15 00 00 00       	mov    $0x15,%eax
+  801440:	8b 55 08             	mov    0x8(%ebp),%edx
+  801443:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801446:	89 df                	mov    %ebx,%edi
+  801448:	89 de                	mov    %ebx,%esi
+  80144a:	cd 30                	int    $0x30
+  80144c:	eb 90                	jmp    8013de <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80144e:	83 ec 0c             	sub    $0xc,%esp
+  801451:	50                   	push   %eax
+  801452:	6a 15                	push   $0x15
+  801454:	68 aa 27 80 00       	push   $0x8027aa
+  801459:	6a 4a                	push   $0x4a
+  80145b:	68 c7 27 80 00       	push   $0x8027c7
+  801460:	e8 9b 07 00 00       	call   801c00 <_panic>
+
+00801465 <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  801465:	55                   	push   %ebp
+  801466:	89 e5                	mov    %esp,%ebp
+  801468:	57                   	push   %edi
+  801469:	56                   	push   %esi
+  80146a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80146b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801472:	78 32                	js     8014a6 <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  801474:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80147b:	74 75                	je     8014f2 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  80147d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801480:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801483:	b8 16 00 00 00       	mov    $0x16,%eax
+  801488:	be 00 00 00 00       	mov    $0x0,%esi
+  80148d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801490:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801493:	55                   	push   %ebp
+  801494:	68 9d 14 80 00       	push   $0x80149d
+  801499:	89 e5                	mov    %esp,%ebp
+  80149b:	0f 34                	sysenter
+  80149d:	83 c4 04             	add    $0x4,%esp
+  8014a0:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  8014a1:	5b                   	pop    %ebx
+  8014a2:	5e                   	pop    %esi
+  8014a3:	5f                   	pop    %edi
+  8014a4:	5d                   	pop    %ebp
+  8014a5:	c3                   	ret
+  8014a6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014ab:	0f a2                	cpuid
+		return 0;
+  8014ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8014b2:	f6 c6 08             	test   $0x8,%dh
+  8014b5:	74 15                	je     8014cc <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014b7:	89 c2                	mov    %eax,%edx
+  8014b9:	c1 ea 08             	shr    $0x8,%edx
+  8014bc:	83 e2 0f             	and    $0xf,%edx
+  8014bf:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8014c4:	83 fa 06             	cmp    $0x6,%edx
+  8014c7:	74 0e                	je     8014d7 <sys_shm_attach+0x72>
+  8014c9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8014cc:	0f b6 c9             	movzbl %cl,%ecx
+  8014cf:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8014d5:	eb 9d                	jmp    801474 <sys_shm_attach+0xf>
+  8014d7:	89 c2                	mov    %eax,%edx
+  8014d9:	c1 ea 04             	shr    $0x4,%edx
+  8014dc:	83 e2 0f             	and    $0xf,%edx
+  8014df:	83 fa 02             	cmp    $0x2,%edx
+  8014e2:	77 e5                	ja     8014c9 <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  8014e4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014e7:	83 f8 02             	cmp    $0x2,%eax
+  8014ea:	0f 97 c1             	seta   %cl
+  8014ed:	0f b6 c9             	movzbl %cl,%ecx
+  8014f0:	eb d7                	jmp    8014c9 <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  8014f2:	b8 16 00 00 00       	mov    $0x16,%eax
+  8014f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8014fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801502:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801505:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801508:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  80150a:	eb 95                	jmp    8014a1 <sys_shm_attach+0x3c>
+
+0080150c <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  80150c:	55                   	push   %ebp
+  80150d:	89 e5                	mov    %esp,%ebp
+  80150f:	57                   	push   %edi
+  801510:	56                   	push   %esi
+  801511:	53                   	push   %ebx
+  801512:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801515:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80151c:	78 38                	js     801556 <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  80151e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801525:	74 7b                	je     8015a2 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  801527:	be 00 00 00 00       	mov    $0x0,%esi
+  80152c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80152f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801532:	b8 17 00 00 00       	mov    $0x17,%eax
+  801537:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80153a:	89 f7                	mov    %esi,%edi
+  80153c:	55                   	push   %ebp
+  80153d:	68 46 15 80 00       	push   $0x801546
+  801542:	89 e5                	mov    %esp,%ebp
+  801544:	0f 34                	sysenter
+  801546:	83 c4 04             	add    $0x4,%esp
+  801549:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80154a:	85 c0                	test   %eax,%eax
+  80154c:	7f 6d                	jg     8015bb <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  80154e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801551:	5b                   	pop    %ebx
+  801552:	5e                   	pop    %esi
+  801553:	5f                   	pop    %edi
+  801554:	5d                   	pop    %ebp
+  801555:	c3                   	ret
+  801556:	b8 01 00 00 00       	mov    $0x1,%eax
+  80155b:	0f a2                	cpuid
+		return 0;
+  80155d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801562:	f6 c6 08             	test   $0x8,%dh
+  801565:	74 15                	je     80157c <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801567:	89 c2                	mov    %eax,%edx
+  801569:	c1 ea 08             	shr    $0x8,%edx
+  80156c:	83 e2 0f             	and    $0xf,%edx
+  80156f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801574:	83 fa 06             	cmp    $0x6,%edx
+  801577:	74 0e                	je     801587 <sys_shm_detach+0x7b>
+  801579:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80157c:	0f b6 c9             	movzbl %cl,%ecx
+  80157f:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801585:	eb 97                	jmp    80151e <sys_shm_detach+0x12>
+  801587:	89 c2                	mov    %eax,%edx
+  801589:	c1 ea 04             	shr    $0x4,%edx
+  80158c:	83 e2 0f             	and    $0xf,%edx
+  80158f:	83 fa 02             	cmp    $0x2,%edx
+  801592:	77 e5                	ja     801579 <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  801594:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801597:	83 f8 02             	cmp    $0x2,%eax
+  80159a:	0f 97 c1             	seta   %cl
+  80159d:	0f b6 c9             	movzbl %cl,%ecx
+  8015a0:	eb d7                	jmp    801579 <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  8015a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8015a7:	b8 17 00 00 00       	mov    $0x17,%eax
+  8015ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015b5:	89 f7                	mov    %esi,%edi
+  8015b7:	cd 30                	int    $0x30
+  8015b9:	eb 8f                	jmp    80154a <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015bb:	83 ec 0c             	sub    $0xc,%esp
+  8015be:	50                   	push   %eax
+  8015bf:	6a 17                	push   $0x17
+  8015c1:	68 aa 27 80 00       	push   $0x8027aa
+  8015c6:	6a 4a                	push   $0x4a
+  8015c8:	68 c7 27 80 00       	push   $0x8027c7
+  8015cd:	e8 2e 06 00 00       	call   801c00 <_panic>
+
+008015d2 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  8015d2:	55                   	push   %ebp
+  8015d3:	89 e5                	mov    %esp,%ebp
+  8015d5:	57                   	push   %edi
+  8015d6:	56                   	push   %esi
+  8015d7:	53                   	push   %ebx
+  8015d8:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8015db:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8015e2:	78 36                	js     80161a <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  8015e4:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8015eb:	74 79                	je     801666 <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  8015ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015f5:	b8 18 00 00 00       	mov    $0x18,%eax
+  8015fa:	89 cb                	mov    %ecx,%ebx
+  8015fc:	89 cf                	mov    %ecx,%edi
+  8015fe:	89 ce                	mov    %ecx,%esi
+  801600:	55                   	push   %ebp
+  801601:	68 0a 16 80 00       	push   $0x80160a
+  801606:	89 e5                	mov    %esp,%ebp
+  801608:	0f 34                	sysenter
+  80160a:	83 c4 04             	add    $0x4,%esp
+  80160d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80160e:	85 c0                	test   %eax,%eax
+  801610:	7f 6b                	jg     80167d <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  801612:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801615:	5b                   	pop    %ebx
+  801616:	5e                   	pop    %esi
+  801617:	5f                   	pop    %edi
+  801618:	5d                   	pop    %ebp
+  801619:	c3                   	ret
+  80161a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80161f:	0f a2                	cpuid
+		return 0;
+  801621:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801626:	f6 c6 08             	test   $0x8,%dh
+  801629:	74 15                	je     801640 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80162b:	89 c2                	mov    %eax,%edx
+  80162d:	c1 ea 08             	shr    $0x8,%edx
+  801630:	83 e2 0f             	and    $0xf,%edx
+  801633:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801638:	83 fa 06             	cmp    $0x6,%edx
+  80163b:	74 0e                	je     80164b <sys_shm_remove+0x79>
+  80163d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801640:	0f b6 c9             	movzbl %cl,%ecx
+  801643:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801649:	eb 99                	jmp    8015e4 <sys_shm_remove+0x12>
+  80164b:	89 c2                	mov    %eax,%edx
+  80164d:	c1 ea 04             	shr    $0x4,%edx
+  801650:	83 e2 0f             	and    $0xf,%edx
+  801653:	83 fa 02             	cmp    $0x2,%edx
+  801656:	77 e5                	ja     80163d <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  801658:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80165b:	83 f8 02             	cmp    $0x2,%eax
+  80165e:	0f 97 c1             	seta   %cl
+  801661:	0f b6 c9             	movzbl %cl,%ecx
+  801664:	eb d7                	jmp    80163d <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  801666:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80166b:	b8 18 00 00 00       	mov    $0x18,%eax
+  801670:	8b 55 08             	mov    0x8(%ebp),%edx
+  801673:	89 cb                	mov    %ecx,%ebx
+  801675:	89 cf                	mov    %ecx,%edi
+  801677:	89 ce                	mov    %ecx,%esi
+  801679:	cd 30                	int    $0x30
+  80167b:	eb 91                	jmp    80160e <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80167d:	83 ec 0c             	sub    $0xc,%esp
+  801680:	50                   	push   %eax
+  801681:	6a 18                	push   $0x18
+  801683:	68 aa 27 80 00       	push   $0x8027aa
+  801688:	6a 4a                	push   $0x4a
+  80168a:	68 c7 27 80 00       	push   $0x8027c7
+  80168f:	e8 6c 05 00 00       	call   801c00 <_panic>
+
+00801694 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  801694:	55                   	push   %ebp
+  801695:	89 e5                	mov    %esp,%ebp
+  801697:	57                   	push   %edi
+  801698:	56                   	push   %esi
+  801699:	53                   	push   %ebx
+  80169a:	83 ec 0c             	sub    $0xc,%esp
+  80169d:	8b 45 10             	mov    0x10(%ebp),%eax
+  8016a0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8016a3:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  8016a6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8016ad:	78 32                	js     8016e1 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  8016af:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8016b6:	74 75                	je     80172d <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  8016b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016be:	b8 20 00 00 00       	mov    $0x20,%eax
+  8016c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8016c8:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8016cb:	55                   	push   %ebp
+  8016cc:	68 d5 16 80 00       	push   $0x8016d5
+  8016d1:	89 e5                	mov    %esp,%ebp
+  8016d3:	0f 34                	sysenter
+  8016d5:	83 c4 04             	add    $0x4,%esp
+  8016d8:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  8016d9:	83 c4 0c             	add    $0xc,%esp
+  8016dc:	5b                   	pop    %ebx
+  8016dd:	5e                   	pop    %esi
+  8016de:	5f                   	pop    %edi
+  8016df:	5d                   	pop    %ebp
+  8016e0:	c3                   	ret
+  8016e1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016e6:	0f a2                	cpuid
+		return 0;
+  8016e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8016ed:	f6 c6 08             	test   $0x8,%dh
+  8016f0:	74 15                	je     801707 <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016f2:	89 c2                	mov    %eax,%edx
+  8016f4:	c1 ea 08             	shr    $0x8,%edx
+  8016f7:	83 e2 0f             	and    $0xf,%edx
+  8016fa:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8016ff:	83 fa 06             	cmp    $0x6,%edx
+  801702:	74 0e                	je     801712 <sys_futex_wait+0x7e>
+  801704:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801707:	0f b6 c9             	movzbl %cl,%ecx
+  80170a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801710:	eb 9d                	jmp    8016af <sys_futex_wait+0x1b>
+  801712:	89 c2                	mov    %eax,%edx
+  801714:	c1 ea 04             	shr    $0x4,%edx
+  801717:	83 e2 0f             	and    $0xf,%edx
+  80171a:	83 fa 02             	cmp    $0x2,%edx
+  80171d:	77 e5                	ja     801704 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  80171f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801722:	83 f8 02             	cmp    $0x2,%eax
+  801725:	0f 97 c1             	seta   %cl
+  801728:	0f b6 c9             	movzbl %cl,%ecx
+  80172b:	eb d7                	jmp    801704 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  80172d:	b8 20 00 00 00       	mov    $0x20,%eax
+  801732:	be 00 00 00 00       	mov    $0x0,%esi
+  801737:	8b 55 08             	mov    0x8(%ebp),%edx
+  80173a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80173d:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  801740:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  801742:	eb 95                	jmp    8016d9 <sys_futex_wait+0x45>
+
+00801744 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801744:	55                   	push   %ebp
+  801745:	89 e5                	mov    %esp,%ebp
+  801747:	57                   	push   %edi
+  801748:	56                   	push   %esi
+  801749:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80174a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801751:	78 30                	js     801783 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  801753:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80175a:	74 73                	je     8017cf <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  80175c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801761:	8b 55 08             	mov    0x8(%ebp),%edx
+  801764:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801767:	b8 21 00 00 00       	mov    $0x21,%eax
+  80176c:	89 df                	mov    %ebx,%edi
+  80176e:	89 de                	mov    %ebx,%esi
+  801770:	55                   	push   %ebp
+  801771:	68 7a 17 80 00       	push   $0x80177a
+  801776:	89 e5                	mov    %esp,%ebp
+  801778:	0f 34                	sysenter
+  80177a:	83 c4 04             	add    $0x4,%esp
+  80177d:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80177e:	5b                   	pop    %ebx
+  80177f:	5e                   	pop    %esi
+  801780:	5f                   	pop    %edi
+  801781:	5d                   	pop    %ebp
+  801782:	c3                   	ret
+  801783:	b8 01 00 00 00       	mov    $0x1,%eax
+  801788:	0f a2                	cpuid
+		return 0;
+  80178a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80178f:	f6 c6 08             	test   $0x8,%dh
+  801792:	74 15                	je     8017a9 <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801794:	89 c2                	mov    %eax,%edx
+  801796:	c1 ea 08             	shr    $0x8,%edx
+  801799:	83 e2 0f             	and    $0xf,%edx
+  80179c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017a1:	83 fa 06             	cmp    $0x6,%edx
+  8017a4:	74 0e                	je     8017b4 <sys_futex_wake+0x70>
+  8017a6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8017a9:	0f b6 c9             	movzbl %cl,%ecx
+  8017ac:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8017b2:	eb 9f                	jmp    801753 <sys_futex_wake+0xf>
+  8017b4:	89 c2                	mov    %eax,%edx
+  8017b6:	c1 ea 04             	shr    $0x4,%edx
+  8017b9:	83 e2 0f             	and    $0xf,%edx
+  8017bc:	83 fa 02             	cmp    $0x2,%edx
+  8017bf:	77 e5                	ja     8017a6 <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  8017c1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017c4:	83 f8 02             	cmp    $0x2,%eax
+  8017c7:	0f 97 c1             	seta   %cl
+  8017ca:	0f b6 c9             	movzbl %cl,%ecx
+  8017cd:	eb d7                	jmp    8017a6 <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  8017cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d4:	b8 21 00 00 00       	mov    $0x21,%eax
+  8017d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017df:	89 df                	mov    %ebx,%edi
+  8017e1:	89 de                	mov    %ebx,%esi
+  8017e3:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  8017e5:	eb 97                	jmp    80177e <sys_futex_wake+0x3a>
+
+008017e7 <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  8017e7:	55                   	push   %ebp
+  8017e8:	89 e5                	mov    %esp,%ebp
+  8017ea:	57                   	push   %edi
+  8017eb:	56                   	push   %esi
+  8017ec:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8017ed:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8017f4:	78 2e                	js     801824 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  8017f6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8017fd:	74 71                	je     801870 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  8017ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  801804:	b8 22 00 00 00       	mov    $0x22,%eax
+  801809:	89 d1                	mov    %edx,%ecx
+  80180b:	89 d3                	mov    %edx,%ebx
+  80180d:	89 d7                	mov    %edx,%edi
+  80180f:	89 d6                	mov    %edx,%esi
+  801811:	55                   	push   %ebp
+  801812:	68 1b 18 80 00       	push   $0x80181b
+  801817:	89 e5                	mov    %esp,%ebp
+  801819:	0f 34                	sysenter
+  80181b:	83 c4 04             	add    $0x4,%esp
+  80181e:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  80181f:	5b                   	pop    %ebx
+  801820:	5e                   	pop    %esi
+  801821:	5f                   	pop    %edi
+  801822:	5d                   	pop    %ebp
+  801823:	c3                   	ret
+  801824:	b8 01 00 00 00       	mov    $0x1,%eax
+  801829:	0f a2                	cpuid
+		return 0;
+  80182b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801830:	f6 c6 08             	test   $0x8,%dh
+  801833:	74 15                	je     80184a <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801835:	89 c2                	mov    %eax,%edx
+  801837:	c1 ea 08             	shr    $0x8,%edx
+  80183a:	83 e2 0f             	and    $0xf,%edx
+  80183d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801842:	83 fa 06             	cmp    $0x6,%edx
+  801845:	74 0e                	je     801855 <sys_ep_create+0x6e>
+  801847:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80184a:	0f b6 c9             	movzbl %cl,%ecx
+  80184d:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801853:	eb a1                	jmp    8017f6 <sys_ep_create+0xf>
+  801855:	89 c2                	mov    %eax,%edx
+  801857:	c1 ea 04             	shr    $0x4,%edx
+  80185a:	83 e2 0f             	and    $0xf,%edx
+  80185d:	83 fa 02             	cmp    $0x2,%edx
+  801860:	77 e5                	ja     801847 <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  801862:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801865:	83 f8 02             	cmp    $0x2,%eax
+  801868:	0f 97 c1             	seta   %cl
+  80186b:	0f b6 c9             	movzbl %cl,%ecx
+  80186e:	eb d7                	jmp    801847 <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  801870:	ba 00 00 00 00       	mov    $0x0,%edx
+  801875:	b8 22 00 00 00       	mov    $0x22,%eax
+  80187a:	89 d1                	mov    %edx,%ecx
+  80187c:	89 d3                	mov    %edx,%ebx
+  80187e:	89 d7                	mov    %edx,%edi
+  801880:	89 d6                	mov    %edx,%esi
+  801882:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  801884:	eb 99                	jmp    80181f <sys_ep_create+0x38>
+
+00801886 <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  801886:	55                   	push   %ebp
+  801887:	89 e5                	mov    %esp,%ebp
+  801889:	57                   	push   %edi
+  80188a:	56                   	push   %esi
+  80188b:	53                   	push   %ebx
+  80188c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80188f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801896:	78 36                	js     8018ce <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  801898:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80189f:	74 79                	je     80191a <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  8018a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018a9:	b8 23 00 00 00       	mov    $0x23,%eax
+  8018ae:	89 cb                	mov    %ecx,%ebx
+  8018b0:	89 cf                	mov    %ecx,%edi
+  8018b2:	89 ce                	mov    %ecx,%esi
+  8018b4:	55                   	push   %ebp
+  8018b5:	68 be 18 80 00       	push   $0x8018be
+  8018ba:	89 e5                	mov    %esp,%ebp
+  8018bc:	0f 34                	sysenter
+  8018be:	83 c4 04             	add    $0x4,%esp
+  8018c1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8018c2:	85 c0                	test   %eax,%eax
+  8018c4:	7f 6b                	jg     801931 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  8018c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018c9:	5b                   	pop    %ebx
+  8018ca:	5e                   	pop    %esi
+  8018cb:	5f                   	pop    %edi
+  8018cc:	5d                   	pop    %ebp
+  8018cd:	c3                   	ret
+  8018ce:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018d3:	0f a2                	cpuid
+		return 0;
+  8018d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018da:	f6 c6 08             	test   $0x8,%dh
+  8018dd:	74 15                	je     8018f4 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018df:	89 c2                	mov    %eax,%edx
+  8018e1:	c1 ea 08             	shr    $0x8,%edx
+  8018e4:	83 e2 0f             	and    $0xf,%edx
+  8018e7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018ec:	83 fa 06             	cmp    $0x6,%edx
+  8018ef:	74 0e                	je     8018ff <sys_ep_destroy+0x79>
+  8018f1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8018f4:	0f b6 c9             	movzbl %cl,%ecx
+  8018f7:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8018fd:	eb 99                	jmp    801898 <sys_ep_destroy+0x12>
+  8018ff:	89 c2                	mov    %eax,%edx
+  801901:	c1 ea 04             	shr    $0x4,%edx
+  801904:	83 e2 0f             	and    $0xf,%edx
+  801907:	83 fa 02             	cmp    $0x2,%edx
+  80190a:	77 e5                	ja     8018f1 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  80190c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80190f:	83 f8 02             	cmp    $0x2,%eax
+  801912:	0f 97 c1             	seta   %cl
+  801915:	0f b6 c9             	movzbl %cl,%ecx
+  801918:	eb d7                	jmp    8018f1 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  80191a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80191f:	b8 23 00 00 00       	mov    $0x23,%eax
+  801924:	8b 55 08             	mov    0x8(%ebp),%edx
+  801927:	89 cb                	mov    %ecx,%ebx
+  801929:	89 cf                	mov    %ecx,%edi
+  80192b:	89 ce                	mov    %ecx,%esi
+  80192d:	cd 30                	int    $0x30
+  80192f:	eb 91                	jmp    8018c2 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801931:	83 ec 0c             	sub    $0xc,%esp
+  801934:	50                   	push   %eax
+  801935:	6a 23                	push   $0x23
+  801937:	68 aa 27 80 00       	push   $0x8027aa
+  80193c:	6a 4a                	push   $0x4a
+  80193e:	68 c7 27 80 00       	push   $0x8027c7
+  801943:	e8 b8 02 00 00       	call   801c00 <_panic>
+
+00801948 <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  801948:	55                   	push   %ebp
+  801949:	89 e5                	mov    %esp,%ebp
+  80194b:	57                   	push   %edi
+  80194c:	56                   	push   %esi
+  80194d:	53                   	push   %ebx
+  80194e:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801951:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801958:	78 37                	js     801991 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  80195a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801961:	74 7a                	je     8019dd <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  801963:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801968:	8b 55 08             	mov    0x8(%ebp),%edx
+  80196b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80196e:	b8 24 00 00 00       	mov    $0x24,%eax
+  801973:	89 df                	mov    %ebx,%edi
+  801975:	89 de                	mov    %ebx,%esi
+  801977:	55                   	push   %ebp
+  801978:	68 81 19 80 00       	push   $0x801981
+  80197d:	89 e5                	mov    %esp,%ebp
+  80197f:	0f 34                	sysenter
+  801981:	83 c4 04             	add    $0x4,%esp
+  801984:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801985:	85 c0                	test   %eax,%eax
+  801987:	7f 6c                	jg     8019f5 <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  801989:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80198c:	5b                   	pop    %ebx
+  80198d:	5e                   	pop    %esi
+  80198e:	5f                   	pop    %edi
+  80198f:	5d                   	pop    %ebp
+  801990:	c3                   	ret
+  801991:	b8 01 00 00 00       	mov    $0x1,%eax
+  801996:	0f a2                	cpuid
+		return 0;
+  801998:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80199d:	f6 c6 08             	test   $0x8,%dh
+  8019a0:	74 15                	je     8019b7 <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019a2:	89 c2                	mov    %eax,%edx
+  8019a4:	c1 ea 08             	shr    $0x8,%edx
+  8019a7:	83 e2 0f             	and    $0xf,%edx
+  8019aa:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019af:	83 fa 06             	cmp    $0x6,%edx
+  8019b2:	74 0e                	je     8019c2 <sys_ep_grant+0x7a>
+  8019b4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8019b7:	0f b6 c9             	movzbl %cl,%ecx
+  8019ba:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8019c0:	eb 98                	jmp    80195a <sys_ep_grant+0x12>
+  8019c2:	89 c2                	mov    %eax,%edx
+  8019c4:	c1 ea 04             	shr    $0x4,%edx
+  8019c7:	83 e2 0f             	and    $0xf,%edx
+  8019ca:	83 fa 02             	cmp    $0x2,%edx
+  8019cd:	77 e5                	ja     8019b4 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  8019cf:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019d2:	83 f8 02             	cmp    $0x2,%eax
+  8019d5:	0f 97 c1             	seta   %cl
+  8019d8:	0f b6 c9             	movzbl %cl,%ecx
+  8019db:	eb d7                	jmp    8019b4 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  8019dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019e2:	b8 24 00 00 00       	mov    $0x24,%eax
+  8019e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019ea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019ed:	89 df                	mov    %ebx,%edi
+  8019ef:	89 de                	mov    %ebx,%esi
+  8019f1:	cd 30                	int    $0x30
+  8019f3:	eb 90                	jmp    801985 <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8019f5:	83 ec 0c             	sub    $0xc,%esp
+  8019f8:	50                   	push   %eax
+  8019f9:	6a 24                	push   $0x24
+  8019fb:	68 aa 27 80 00       	push   $0x8027aa
+  801a00:	6a 4a                	push   $0x4a
+  801a02:	68 c7 27 80 00       	push   $0x8027c7
+  801a07:	e8 f4 01 00 00       	call   801c00 <_panic>
+
+00801a0c <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  801a0c:	55                   	push   %ebp
+  801a0d:	89 e5                	mov    %esp,%ebp
+  801a0f:	57                   	push   %edi
+  801a10:	56                   	push   %esi
+  801a11:	53                   	push   %ebx
+  801a12:	83 ec 20             	sub    $0x20,%esp
+  801a15:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801a18:	8b 10                	mov    (%eax),%edx
+  801a1a:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801a1d:	8b 50 04             	mov    0x4(%eax),%edx
+  801a20:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801a23:	8b 50 08             	mov    0x8(%eax),%edx
+  801a26:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801a29:	8b 50 0c             	mov    0xc(%eax),%edx
+  801a2c:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801a2f:	8b 40 10             	mov    0x10(%eax),%eax
+  801a32:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801a35:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801a38:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a3b:	b8 25 00 00 00       	mov    $0x25,%eax
+  801a40:	55                   	push   %ebp
+  801a41:	56                   	push   %esi
+  801a42:	8b 0e                	mov    (%esi),%ecx
+  801a44:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801a47:	8b 7e 08             	mov    0x8(%esi),%edi
+  801a4a:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801a4d:	8b 76 0c             	mov    0xc(%esi),%esi
+  801a50:	cd 30                	int    $0x30
+  801a52:	87 34 24             	xchg   %esi,(%esp)
+  801a55:	89 0e                	mov    %ecx,(%esi)
+  801a57:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801a5a:	89 7e 08             	mov    %edi,0x8(%esi)
+  801a5d:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801a60:	8f 46 0c             	pop    0xc(%esi)
+  801a63:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  801a64:	83 c4 20             	add    $0x20,%esp
+  801a67:	5b                   	pop    %ebx
+  801a68:	5e                   	pop    %esi
+  801a69:	5f                   	pop    %edi
+  801a6a:	5d                   	pop    %ebp
+  801a6b:	c3                   	ret
+
+00801a6c <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  801a6c:	55                   	push   %ebp
+  801a6d:	89 e5                	mov    %esp,%ebp
+  801a6f:	57                   	push   %edi
+  801a70:	56                   	push   %esi
+  801a71:	53                   	push   %ebx
+  801a72:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  801a75:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a78:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  801a7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a7d:	b8 26 00 00 00       	mov    $0x26,%eax
+  801a82:	55                   	push   %ebp
+  801a83:	56                   	push   %esi
+  801a84:	8b 0e                	mov    (%esi),%ecx
+  801a86:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801a89:	8b 7e 08             	mov    0x8(%esi),%edi
+  801a8c:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801a8f:	8b 76 0c             	mov    0xc(%esi),%esi
+  801a92:	cd 30                	int    $0x30
+  801a94:	87 34 24             	xchg   %esi,(%esp)
+  801a97:	89 0e                	mov    %ecx,(%esi)
+  801a99:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801a9c:	89 7e 08             	mov    %edi,0x8(%esi)
+  801a9f:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801aa2:	8f 46 0c             	pop    0xc(%esi)
+  801aa5:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  801aa6:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  801aaa:	74 0f                	je     801abb <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  801aac:	85 c0                	test   %eax,%eax
+  801aae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ab3:	0f 48 d1             	cmovs  %ecx,%edx
+  801ab6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  801ab9:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  801abb:	5b                   	pop    %ebx
+  801abc:	5e                   	pop    %esi
+  801abd:	5f                   	pop    %edi
+  801abe:	5d                   	pop    %ebp
+  801abf:	c3                   	ret
+
+00801ac0 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  801ac0:	55                   	push   %ebp
+  801ac1:	89 e5                	mov    %esp,%ebp
+  801ac3:	57                   	push   %edi
+  801ac4:	56                   	push   %esi
+  801ac5:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801ac6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801acd:	78 2f                	js     801afe <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  801acf:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801ad6:	74 72                	je     801b4a <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  801ad8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801adb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ae0:	b8 27 00 00 00       	mov    $0x27,%eax
+  801ae5:	89 cb                	mov    %ecx,%ebx
+  801ae7:	89 cf                	mov    %ecx,%edi
+  801ae9:	89 ce                	mov    %ecx,%esi
+  801aeb:	55                   	push   %ebp
+  801aec:	68 f5 1a 80 00       	push   $0x801af5
+  801af1:	89 e5                	mov    %esp,%ebp
+  801af3:	0f 34                	sysenter
+  801af5:	83 c4 04             	add    $0x4,%esp
+  801af8:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  801af9:	5b                   	pop    %ebx
+  801afa:	5e                   	pop    %esi
+  801afb:	5f                   	pop    %edi
+  801afc:	5d                   	pop    %ebp
+  801afd:	c3                   	ret
+  801afe:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b03:	0f a2                	cpuid
+		return 0;
+  801b05:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b0a:	f6 c6 08             	test   $0x8,%dh
+  801b0d:	74 15                	je     801b24 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b0f:	89 c2                	mov    %eax,%edx
+  801b11:	c1 ea 08             	shr    $0x8,%edx
+  801b14:	83 e2 0f             	and    $0xf,%edx
+  801b17:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b1c:	83 fa 06             	cmp    $0x6,%edx
+  801b1f:	74 0e                	je     801b2f <sys_sysring_setup+0x6f>
+  801b21:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b24:	0f b6 c9             	movzbl %cl,%ecx
+  801b27:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801b2d:	eb a0                	jmp    801acf <sys_sysring_setup+0xf>
+  801b2f:	89 c2                	mov    %eax,%edx
+  801b31:	c1 ea 04             	shr    $0x4,%edx
+  801b34:	83 e2 0f             	and    $0xf,%edx
+  801b37:	83 fa 02             	cmp    $0x2,%edx
+  801b3a:	77 e5                	ja     801b21 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  801b3c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b3f:	83 f8 02             	cmp    $0x2,%eax
+  801b42:	0f 97 c1             	seta   %cl
+  801b45:	0f b6 c9             	movzbl %cl,%ecx
+  801b48:	eb d7                	jmp    801b21 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  801b4a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b4f:	b8 27 00 00 00       	mov    $0x27,%eax
+  801b54:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b57:	89 cb                	mov    %ecx,%ebx
+  801b59:	89 cf                	mov    %ecx,%edi
+  801b5b:	89 ce                	mov    %ecx,%esi
+  801b5d:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  801b5f:	eb 98                	jmp    801af9 <sys_sysring_setup+0x39>
+
+00801b61 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  801b61:	55                   	push   %ebp
+  801b62:	89 e5                	mov    %esp,%ebp
+  801b64:	57                   	push   %edi
+  801b65:	56                   	push   %esi
+  801b66:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801b67:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b6e:	78 2e                	js     801b9e <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  801b70:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b77:	74 71                	je     801bea <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  801b79:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b7e:	b8 28 00 00 00       	mov    $0x28,%eax
+  801b83:	89 d1                	mov    %edx,%ecx
+  801b85:	89 d3                	mov    %edx,%ebx
+  801b87:	89 d7                	mov    %edx,%edi
+  801b89:	89 d6                	mov    %edx,%esi
+  801b8b:	55                   	push   %ebp
+  801b8c:	68 95 1b 80 00       	push   $0x801b95
+  801b91:	89 e5                	mov    %esp,%ebp
+  801b93:	0f 34                	sysenter
+  801b95:	83 c4 04             	add    $0x4,%esp
+  801b98:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801b99:	5b                   	pop    %ebx
+  801b9a:	5e                   	pop    %esi
+  801b9b:	5f                   	pop    %edi
+  801b9c:	5d                   	pop    %ebp
+  801b9d:	c3                   	ret
+  801b9e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ba3:	0f a2                	cpuid
+		return 0;
+  801ba5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801baa:	f6 c6 08             	test   $0x8,%dh
+  801bad:	74 15                	je     801bc4 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801baf:	89 c2                	mov    %eax,%edx
+  801bb1:	c1 ea 08             	shr    $0x8,%edx
+  801bb4:	83 e2 0f             	and    $0xf,%edx
+  801bb7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801bbc:	83 fa 06             	cmp    $0x6,%edx
+  801bbf:	74 0e                	je     801bcf <sys_sysring_enter+0x6e>
+  801bc1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801bc4:	0f b6 c9             	movzbl %cl,%ecx
+  801bc7:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801bcd:	eb a1                	jmp    801b70 <sys_sysring_enter+0xf>
+  801bcf:	89 c2                	mov    %eax,%edx
+  801bd1:	c1 ea 04             	shr    $0x4,%edx
+  801bd4:	83 e2 0f             	and    $0xf,%edx
+  801bd7:	83 fa 02             	cmp    $0x2,%edx
+  801bda:	77 e5                	ja     801bc1 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  801bdc:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bdf:	83 f8 02             	cmp    $0x2,%eax
+  801be2:	0f 97 c1             	seta   %cl
+  801be5:	0f b6 c9             	movzbl %cl,%ecx
+  801be8:	eb d7                	jmp    801bc1 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  801bea:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bef:	b8 28 00 00 00       	mov    $0x28,%eax
+  801bf4:	89 d1                	mov    %edx,%ecx
+  801bf6:	89 d3                	mov    %edx,%ebx
+  801bf8:	89 d7                	mov    %edx,%edi
+  801bfa:	89 d6                	mov    %edx,%esi
+  801bfc:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  801bfe:	eb 99                	jmp    801b99 <sys_sysring_enter+0x38>
+
+00801c00 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801c00:	55                   	push   %ebp
+  801c01:	89 e5                	mov    %esp,%ebp
+  801c03:	57                   	push   %edi
+  801c04:	56                   	push   %esi
+  801c05:	53                   	push   %ebx
+  801c06:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  801c0c:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  801c0f:	8b 1d 00 30 80 00    	mov    0x803000,%ebx
+  801c15:	e8 c8 e8 ff ff       	call   8004e2 <sys_getenvid>
+  801c1a:	83 ec 04             	sub    $0x4,%esp
+  801c1d:	ff 75 0c             	push   0xc(%ebp)
+  801c20:	ff 75 08             	push   0x8(%ebp)
+  801c23:	53                   	push   %ebx
+  801c24:	50                   	push   %eax
+  801c25:	68 d8 27 80 00       	push   $0x8027d8
+  801c2a:	68 00 01 00 00       	push   $0x100
+  801c2f:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  801c35:	56                   	push   %esi
+  801c36:	e8 c9 05 00 00       	call   802204 <snprintf>
+  801c3b:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  801c3d:	83 c4 20             	add    $0x20,%esp
+  801c40:	57                   	push   %edi
+  801c41:	ff 75 10             	push   0x10(%ebp)
+  801c44:	bf 00 01 00 00       	mov    $0x100,%edi
+  801c49:	89 f8                	mov    %edi,%eax
+  801c4b:	29 d8                	sub    %ebx,%eax
+  801c4d:	50                   	push   %eax
+  801c4e:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801c51:	50                   	push   %eax
+  801c52:	e8 5f 05 00 00       	call   8021b6 <vsnprintf>
+  801c57:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  801c59:	83 c4 0c             	add    $0xc,%esp
+  801c5c:	68 fb 27 80 00       	push   $0x8027fb
+  801c61:	29 df                	sub    %ebx,%edi
+  801c63:	57                   	push   %edi
+  801c64:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801c67:	50                   	push   %eax
+  801c68:	e8 97 05 00 00       	call   802204 <snprintf>
+	sys_cputs(buf, r);
+  801c6d:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  801c70:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  801c72:	53                   	push   %ebx
+  801c73:	56                   	push   %esi
+  801c74:	e8 6b e6 ff ff       	call   8002e4 <sys_cputs>
+  801c79:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801c7c:	cc                   	int3
+	while (1)
+  801c7d:	eb fd                	jmp    801c7c <_panic+0x7c>
+
+00801c7f <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801c7f:	55                   	push   %ebp
+  801c80:	89 e5                	mov    %esp,%ebp
+  801c82:	57                   	push   %edi
+  801c83:	56                   	push   %esi
+  801c84:	53                   	push   %ebx
+  801c85:	83 ec 1c             	sub    $0x1c,%esp
+  801c88:	89 c7                	mov    %eax,%edi
+  801c8a:	89 d6                	mov    %edx,%esi
+  801c8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c8f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c92:	89 d1                	mov    %edx,%ecx
+  801c94:	89 c2                	mov    %eax,%edx
+  801c96:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801c99:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801c9c:	8b 45 10             	mov    0x10(%ebp),%eax
+  801c9f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  801ca2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801ca5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801cac:	39 c2                	cmp    %eax,%edx
+  801cae:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  801cb1:	72 3e                	jb     801cf1 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801cb3:	83 ec 0c             	sub    $0xc,%esp
+  801cb6:	ff 75 18             	push   0x18(%ebp)
+  801cb9:	83 eb 01             	sub    $0x1,%ebx
+  801cbc:	53                   	push   %ebx
+  801cbd:	50                   	push   %eax
+  801cbe:	83 ec 08             	sub    $0x8,%esp
+  801cc1:	ff 75 e4             	push   -0x1c(%ebp)
+  801cc4:	ff 75 e0             	push   -0x20(%ebp)
+  801cc7:	ff 75 dc             	push   -0x24(%ebp)
+  801cca:	ff 75 d8             	push   -0x28(%ebp)
+  801ccd:	e8 9a 09 00 00       	call   80266c <__udivdi3>
+  801cd2:	83 c4 18             	add    $0x18,%esp
+  801cd5:	52                   	push   %edx
+  801cd6:	50                   	push   %eax
+  801cd7:	89 f2                	mov    %esi,%edx
+  801cd9:	89 f8                	mov    %edi,%eax
+  801cdb:	e8 9f ff ff ff       	call   801c7f <printnum>
+  801ce0:	83 c4 20             	add    $0x20,%esp
+  801ce3:	eb 13                	jmp    801cf8 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  801ce5:	83 ec 08             	sub    $0x8,%esp
+  801ce8:	56                   	push   %esi
+  801ce9:	ff 75 18             	push   0x18(%ebp)
+  801cec:	ff d7                	call   *%edi
+  801cee:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  801cf1:	83 eb 01             	sub    $0x1,%ebx
+  801cf4:	85 db                	test   %ebx,%ebx
+  801cf6:	7f ed                	jg     801ce5 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  801cf8:	83 ec 08             	sub    $0x8,%esp
+  801cfb:	56                   	push   %esi
+  801cfc:	83 ec 04             	sub    $0x4,%esp
+  801cff:	ff 75 e4             	push   -0x1c(%ebp)
+  801d02:	ff 75 e0             	push   -0x20(%ebp)
+  801d05:	ff 75 dc             	push   -0x24(%ebp)
+  801d08:	ff 75 d8             	push   -0x28(%ebp)
+  801d0b:	e8 7a 09 00 00       	call   80268a <__umoddi3>
+  801d10:	83 c4 14             	add    $0x14,%esp
+  801d13:	0f be 80 fd 27 80 00 	movsbl 0x8027fd(%eax),%eax
+  801d1a:	50                   	push   %eax
+  801d1b:	ff d7                	call   *%edi
+}
+  801d1d:	83 c4 10             	add    $0x10,%esp
+  801d20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d23:	5b                   	pop    %ebx
+  801d24:	5e                   	pop    %esi
+  801d25:	5f                   	pop    %edi
+  801d26:	5d                   	pop    %ebp
+  801d27:	c3                   	ret
+
+00801d28 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801d28:	55                   	push   %ebp
+  801d29:	89 e5                	mov    %esp,%ebp
+  801d2b:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  801d2e:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  801d32:	8b 10                	mov    (%eax),%edx
+  801d34:	3b 50 04             	cmp    0x4(%eax),%edx
+  801d37:	73 0a                	jae    801d43 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  801d39:	8d 4a 01             	lea    0x1(%edx),%ecx
+  801d3c:	89 08                	mov    %ecx,(%eax)
+  801d3e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d41:	88 02                	mov    %al,(%edx)
+}
+  801d43:	5d                   	pop    %ebp
+  801d44:	c3                   	ret
+
+00801d45 <printfmt>:
+{
+  801d45:	55                   	push   %ebp
+  801d46:	89 e5                	mov    %esp,%ebp
+  801d48:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  801d4b:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  801d4e:	50                   	push   %eax
+  801d4f:	ff 75 10             	push   0x10(%ebp)
+  801d52:	ff 75 0c             	push   0xc(%ebp)
+  801d55:	ff 75 08             	push   0x8(%ebp)
+  801d58:	e8 05 00 00 00       	call   801d62 <vprintfmt>
+}
+  801d5d:	83 c4 10             	add    $0x10,%esp
+  801d60:	c9                   	leave
+  801d61:	c3                   	ret
+
+00801d62 <vprintfmt>:
+{
+  801d62:	55                   	push   %ebp
+  801d63:	89 e5                	mov    %esp,%ebp
+  801d65:	57                   	push   %edi
+  801d66:	56                   	push   %esi
+  801d67:	53                   	push   %ebx
+  801d68:	83 ec 2c             	sub    $0x2c,%esp
+  801d6b:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d6e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801d71:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801d74:	eb 0a                	jmp    801d80 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  801d76:	83 ec 08             	sub    $0x8,%esp
+  801d79:	53                   	push   %ebx
+  801d7a:	50                   	push   %eax
+  801d7b:	ff d6                	call   *%esi
+  801d7d:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801d80:	83 c7 01             	add    $0x1,%edi
+  801d83:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801d87:	83 f8 25             	cmp    $0x25,%eax
+  801d8a:	74 0c                	je     801d98 <vprintfmt+0x36>
+			if (ch == '\0')
+  801d8c:	85 c0                	test   %eax,%eax
+  801d8e:	75 e6                	jne    801d76 <vprintfmt+0x14>
+}
+  801d90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d93:	5b                   	pop    %ebx
+  801d94:	5e                   	pop    %esi
+  801d95:	5f                   	pop    %edi
+  801d96:	5d                   	pop    %ebp
+  801d97:	c3                   	ret
+		padc = ' ';
+  801d98:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801d9c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  801da3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801daa:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  801db1:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801db6:	8d 47 01             	lea    0x1(%edi),%eax
+  801db9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801dbc:	0f b6 17             	movzbl (%edi),%edx
+  801dbf:	8d 42 dd             	lea    -0x23(%edx),%eax
+  801dc2:	3c 55                	cmp    $0x55,%al
+  801dc4:	0f 87 cf 03 00 00    	ja     802199 <vprintfmt+0x437>
+  801dca:	0f b6 c0             	movzbl %al,%eax
+  801dcd:	ff 24 85 e0 28 80 00 	jmp    *0x8028e0(,%eax,4)
+  801dd4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801dd7:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801ddb:	eb d9                	jmp    801db6 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801ddd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801de0:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  801de4:	eb d0                	jmp    801db6 <vprintfmt+0x54>
+  801de6:	0f b6 d2             	movzbl %dl,%edx
+  801de9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  801dec:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df1:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  801df4:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801df7:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  801dfb:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  801dfe:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  801e01:	83 f9 09             	cmp    $0x9,%ecx
+  801e04:	77 55                	ja     801e5b <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  801e06:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  801e09:	eb e9                	jmp    801df4 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  801e0b:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e0e:	8b 00                	mov    (%eax),%eax
+  801e10:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801e13:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e16:	8d 40 04             	lea    0x4(%eax),%eax
+  801e19:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801e1c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  801e1f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801e23:	79 91                	jns    801db6 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  801e25:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801e28:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801e2b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  801e32:	eb 82                	jmp    801db6 <vprintfmt+0x54>
+			if (width < 0)
+  801e34:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801e37:	85 d2                	test   %edx,%edx
+  801e39:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e3e:	0f 49 c2             	cmovns %edx,%eax
+  801e41:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801e44:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801e47:	e9 6a ff ff ff       	jmp    801db6 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801e4c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  801e4f:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  801e56:	e9 5b ff ff ff       	jmp    801db6 <vprintfmt+0x54>
+  801e5b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801e5e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801e61:	eb bc                	jmp    801e1f <vprintfmt+0xbd>
+			lflag++;
+  801e63:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801e66:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801e69:	e9 48 ff ff ff       	jmp    801db6 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  801e6e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e71:	8d 78 04             	lea    0x4(%eax),%edi
+  801e74:	83 ec 08             	sub    $0x8,%esp
+  801e77:	53                   	push   %ebx
+  801e78:	ff 30                	push   (%eax)
+  801e7a:	ff d6                	call   *%esi
+			break;
+  801e7c:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801e7f:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  801e82:	e9 b1 02 00 00       	jmp    802138 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  801e87:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e8a:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801e8d:	8b 10                	mov    (%eax),%edx
+  801e8f:	89 d0                	mov    %edx,%eax
+  801e91:	f7 d8                	neg    %eax
+  801e93:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801e96:	83 f8 0d             	cmp    $0xd,%eax
+  801e99:	7f 23                	jg     801ebe <vprintfmt+0x15c>
+  801e9b:	8b 14 85 40 2a 80 00 	mov    0x802a40(,%eax,4),%edx
+  801ea2:	85 d2                	test   %edx,%edx
+  801ea4:	74 18                	je     801ebe <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801ea6:	52                   	push   %edx
+  801ea7:	68 1e 28 80 00       	push   $0x80281e
+  801eac:	53                   	push   %ebx
+  801ead:	56                   	push   %esi
+  801eae:	e8 92 fe ff ff       	call   801d45 <printfmt>
+  801eb3:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801eb6:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801eb9:	e9 7a 02 00 00       	jmp    802138 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  801ebe:	50                   	push   %eax
+  801ebf:	68 15 28 80 00       	push   $0x802815
+  801ec4:	53                   	push   %ebx
+  801ec5:	56                   	push   %esi
+  801ec6:	e8 7a fe ff ff       	call   801d45 <printfmt>
+  801ecb:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801ece:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801ed1:	e9 62 02 00 00       	jmp    802138 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801ed6:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ed9:	83 c0 04             	add    $0x4,%eax
+  801edc:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801edf:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ee2:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801ee4:	85 c9                	test   %ecx,%ecx
+  801ee6:	b8 0e 28 80 00       	mov    $0x80280e,%eax
+  801eeb:	0f 45 c1             	cmovne %ecx,%eax
+  801eee:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801ef1:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801ef5:	7e 06                	jle    801efd <vprintfmt+0x19b>
+  801ef7:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801efb:	75 0b                	jne    801f08 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801efd:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801f00:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801f03:	89 75 08             	mov    %esi,0x8(%ebp)
+  801f06:	eb 5c                	jmp    801f64 <vprintfmt+0x202>
+  801f08:	83 ec 08             	sub    $0x8,%esp
+  801f0b:	ff 75 d0             	push   -0x30(%ebp)
+  801f0e:	ff 75 cc             	push   -0x34(%ebp)
+  801f11:	e8 20 03 00 00       	call   802236 <strnlen>
+  801f16:	89 c2                	mov    %eax,%edx
+  801f18:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f1b:	29 d0                	sub    %edx,%eax
+  801f1d:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801f20:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  801f24:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801f27:	89 75 08             	mov    %esi,0x8(%ebp)
+  801f2a:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f2c:	eb 0e                	jmp    801f3c <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801f2e:	83 ec 08             	sub    $0x8,%esp
+  801f31:	53                   	push   %ebx
+  801f32:	57                   	push   %edi
+  801f33:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f36:	83 ee 01             	sub    $0x1,%esi
+  801f39:	83 c4 10             	add    $0x10,%esp
+  801f3c:	85 f6                	test   %esi,%esi
+  801f3e:	7f ee                	jg     801f2e <vprintfmt+0x1cc>
+  801f40:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f43:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f46:	85 c0                	test   %eax,%eax
+  801f48:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f4d:	0f 49 d0             	cmovns %eax,%edx
+  801f50:	29 d0                	sub    %edx,%eax
+  801f52:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801f55:	eb a6                	jmp    801efd <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801f57:	83 ec 08             	sub    $0x8,%esp
+  801f5a:	53                   	push   %ebx
+  801f5b:	52                   	push   %edx
+  801f5c:	ff 55 08             	call   *0x8(%ebp)
+  801f5f:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801f62:	89 f1                	mov    %esi,%ecx
+  801f64:	8d 71 01             	lea    0x1(%ecx),%esi
+  801f67:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801f6b:	0f be d0             	movsbl %al,%edx
+  801f6e:	85 d2                	test   %edx,%edx
+  801f70:	74 28                	je     801f9a <vprintfmt+0x238>
+  801f72:	85 ff                	test   %edi,%edi
+  801f74:	78 05                	js     801f7b <vprintfmt+0x219>
+  801f76:	83 ef 01             	sub    $0x1,%edi
+  801f79:	78 30                	js     801fab <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801f7b:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801f7f:	74 d6                	je     801f57 <vprintfmt+0x1f5>
+  801f81:	0f be c0             	movsbl %al,%eax
+  801f84:	83 e8 20             	sub    $0x20,%eax
+  801f87:	83 f8 5e             	cmp    $0x5e,%eax
+  801f8a:	76 cb                	jbe    801f57 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801f8c:	83 ec 08             	sub    $0x8,%esp
+  801f8f:	53                   	push   %ebx
+  801f90:	6a 3f                	push   $0x3f
+  801f92:	ff 55 08             	call   *0x8(%ebp)
+  801f95:	83 c4 10             	add    $0x10,%esp
+  801f98:	eb c8                	jmp    801f62 <vprintfmt+0x200>
+  801f9a:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f9d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801fa0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801fa3:	01 d0                	add    %edx,%eax
+  801fa5:	29 c8                	sub    %ecx,%eax
+  801fa7:	89 c7                	mov    %eax,%edi
+  801fa9:	eb 13                	jmp    801fbe <vprintfmt+0x25c>
+  801fab:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fae:	eb ed                	jmp    801f9d <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801fb0:	83 ec 08             	sub    $0x8,%esp
+  801fb3:	53                   	push   %ebx
+  801fb4:	6a 20                	push   $0x20
+  801fb6:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801fb8:	83 ef 01             	sub    $0x1,%edi
+  801fbb:	83 c4 10             	add    $0x10,%esp
+  801fbe:	85 ff                	test   %edi,%edi
+  801fc0:	7f ee                	jg     801fb0 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801fc2:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801fc5:	89 45 14             	mov    %eax,0x14(%ebp)
+  801fc8:	e9 6b 01 00 00       	jmp    802138 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  801fcd:	83 f9 01             	cmp    $0x1,%ecx
+  801fd0:	7f 1f                	jg     801ff1 <vprintfmt+0x28f>
+	else if (lflag)
+  801fd2:	85 c9                	test   %ecx,%ecx
+  801fd4:	74 67                	je     80203d <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  801fd6:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fd9:	8b 00                	mov    (%eax),%eax
+  801fdb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801fde:	89 c1                	mov    %eax,%ecx
+  801fe0:	c1 f9 1f             	sar    $0x1f,%ecx
+  801fe3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801fe6:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fe9:	8d 40 04             	lea    0x4(%eax),%eax
+  801fec:	89 45 14             	mov    %eax,0x14(%ebp)
+  801fef:	eb 17                	jmp    802008 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  801ff1:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ff4:	8b 50 04             	mov    0x4(%eax),%edx
+  801ff7:	8b 00                	mov    (%eax),%eax
+  801ff9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801ffc:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801fff:	8b 45 14             	mov    0x14(%ebp),%eax
+  802002:	8d 40 08             	lea    0x8(%eax),%eax
+  802005:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  802008:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80200b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80200e:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  802013:	85 c9                	test   %ecx,%ecx
+  802015:	0f 89 03 01 00 00    	jns    80211e <vprintfmt+0x3bc>
+				putch('-', putdat);
+  80201b:	83 ec 08             	sub    $0x8,%esp
+  80201e:	53                   	push   %ebx
+  80201f:	6a 2d                	push   $0x2d
+  802021:	ff d6                	call   *%esi
+				num = -(long long) num;
+  802023:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802026:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802029:	f7 da                	neg    %edx
+  80202b:	83 d1 00             	adc    $0x0,%ecx
+  80202e:	f7 d9                	neg    %ecx
+  802030:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  802033:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802038:	e9 e1 00 00 00       	jmp    80211e <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80203d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802040:	8b 00                	mov    (%eax),%eax
+  802042:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802045:	89 c1                	mov    %eax,%ecx
+  802047:	c1 f9 1f             	sar    $0x1f,%ecx
+  80204a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80204d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802050:	8d 40 04             	lea    0x4(%eax),%eax
+  802053:	89 45 14             	mov    %eax,0x14(%ebp)
+  802056:	eb b0                	jmp    802008 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  802058:	83 f9 01             	cmp    $0x1,%ecx
+  80205b:	7f 1e                	jg     80207b <vprintfmt+0x319>
+	else if (lflag)
+  80205d:	85 c9                	test   %ecx,%ecx
+  80205f:	74 32                	je     802093 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  802061:	8b 45 14             	mov    0x14(%ebp),%eax
+  802064:	8b 10                	mov    (%eax),%edx
+  802066:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80206b:	8d 40 04             	lea    0x4(%eax),%eax
+  80206e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802071:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  802076:	e9 a3 00 00 00       	jmp    80211e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80207b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80207e:	8b 10                	mov    (%eax),%edx
+  802080:	8b 48 04             	mov    0x4(%eax),%ecx
+  802083:	8d 40 08             	lea    0x8(%eax),%eax
+  802086:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802089:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80208e:	e9 8b 00 00 00       	jmp    80211e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802093:	8b 45 14             	mov    0x14(%ebp),%eax
+  802096:	8b 10                	mov    (%eax),%edx
+  802098:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80209d:	8d 40 04             	lea    0x4(%eax),%eax
+  8020a0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8020a3:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8020a8:	eb 74                	jmp    80211e <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8020aa:	83 f9 01             	cmp    $0x1,%ecx
+  8020ad:	7f 1b                	jg     8020ca <vprintfmt+0x368>
+	else if (lflag)
+  8020af:	85 c9                	test   %ecx,%ecx
+  8020b1:	74 2c                	je     8020df <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8020b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020b6:	8b 10                	mov    (%eax),%edx
+  8020b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020bd:	8d 40 04             	lea    0x4(%eax),%eax
+  8020c0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8020c3:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8020c8:	eb 54                	jmp    80211e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8020ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020cd:	8b 10                	mov    (%eax),%edx
+  8020cf:	8b 48 04             	mov    0x4(%eax),%ecx
+  8020d2:	8d 40 08             	lea    0x8(%eax),%eax
+  8020d5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8020d8:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8020dd:	eb 3f                	jmp    80211e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8020df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020e2:	8b 10                	mov    (%eax),%edx
+  8020e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020e9:	8d 40 04             	lea    0x4(%eax),%eax
+  8020ec:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8020ef:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8020f4:	eb 28                	jmp    80211e <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8020f6:	83 ec 08             	sub    $0x8,%esp
+  8020f9:	53                   	push   %ebx
+  8020fa:	6a 30                	push   $0x30
+  8020fc:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8020fe:	83 c4 08             	add    $0x8,%esp
+  802101:	53                   	push   %ebx
+  802102:	6a 78                	push   $0x78
+  802104:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  802106:	8b 45 14             	mov    0x14(%ebp),%eax
+  802109:	8b 10                	mov    (%eax),%edx
+  80210b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  802110:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  802113:	8d 40 04             	lea    0x4(%eax),%eax
+  802116:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802119:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80211e:	83 ec 0c             	sub    $0xc,%esp
+  802121:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  802125:	50                   	push   %eax
+  802126:	ff 75 e0             	push   -0x20(%ebp)
+  802129:	57                   	push   %edi
+  80212a:	51                   	push   %ecx
+  80212b:	52                   	push   %edx
+  80212c:	89 da                	mov    %ebx,%edx
+  80212e:	89 f0                	mov    %esi,%eax
+  802130:	e8 4a fb ff ff       	call   801c7f <printnum>
+			break;
+  802135:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  802138:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80213b:	e9 40 fc ff ff       	jmp    801d80 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  802140:	83 f9 01             	cmp    $0x1,%ecx
+  802143:	7f 1b                	jg     802160 <vprintfmt+0x3fe>
+	else if (lflag)
+  802145:	85 c9                	test   %ecx,%ecx
+  802147:	74 2c                	je     802175 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  802149:	8b 45 14             	mov    0x14(%ebp),%eax
+  80214c:	8b 10                	mov    (%eax),%edx
+  80214e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802153:	8d 40 04             	lea    0x4(%eax),%eax
+  802156:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802159:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80215e:	eb be                	jmp    80211e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802160:	8b 45 14             	mov    0x14(%ebp),%eax
+  802163:	8b 10                	mov    (%eax),%edx
+  802165:	8b 48 04             	mov    0x4(%eax),%ecx
+  802168:	8d 40 08             	lea    0x8(%eax),%eax
+  80216b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80216e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  802173:	eb a9                	jmp    80211e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802175:	8b 45 14             	mov    0x14(%ebp),%eax
+  802178:	8b 10                	mov    (%eax),%edx
+  80217a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80217f:	8d 40 04             	lea    0x4(%eax),%eax
+  802182:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802185:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80218a:	eb 92                	jmp    80211e <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  80218c:	83 ec 08             	sub    $0x8,%esp
+  80218f:	53                   	push   %ebx
+  802190:	6a 25                	push   $0x25
+  802192:	ff d6                	call   *%esi
+			break;
+  802194:	83 c4 10             	add    $0x10,%esp
+  802197:	eb 9f                	jmp    802138 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  802199:	83 ec 08             	sub    $0x8,%esp
+  80219c:	53                   	push   %ebx
+  80219d:	6a 25                	push   $0x25
+  80219f:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8021a1:	83 c4 10             	add    $0x10,%esp
+  8021a4:	89 f8                	mov    %edi,%eax
+  8021a6:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8021aa:	74 05                	je     8021b1 <vprintfmt+0x44f>
+  8021ac:	83 e8 01             	sub    $0x1,%eax
+  8021af:	eb f5                	jmp    8021a6 <vprintfmt+0x444>
+  8021b1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8021b4:	eb 82                	jmp    802138 <vprintfmt+0x3d6>
+
+008021b6 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8021b6:	55                   	push   %ebp
+  8021b7:	89 e5                	mov    %esp,%ebp
+  8021b9:	83 ec 18             	sub    $0x18,%esp
+  8021bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021bf:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8021c2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8021c5:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8021c9:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8021cc:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8021d3:	85 c0                	test   %eax,%eax
+  8021d5:	74 26                	je     8021fd <vsnprintf+0x47>
+  8021d7:	85 d2                	test   %edx,%edx
+  8021d9:	7e 22                	jle    8021fd <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8021db:	ff 75 14             	push   0x14(%ebp)
+  8021de:	ff 75 10             	push   0x10(%ebp)
+  8021e1:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8021e4:	50                   	push   %eax
+  8021e5:	68 28 1d 80 00       	push   $0x801d28
+  8021ea:	e8 73 fb ff ff       	call   801d62 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8021ef:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8021f2:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8021f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021f8:	83 c4 10             	add    $0x10,%esp
+}
+  8021fb:	c9                   	leave
+  8021fc:	c3                   	ret
+		return -E_INVAL;
+  8021fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802202:	eb f7                	jmp    8021fb <vsnprintf+0x45>
+
+00802204 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  802204:	55                   	push   %ebp
+  802205:	89 e5                	mov    %esp,%ebp
+  802207:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80220a:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80220d:	50                   	push   %eax
+  80220e:	ff 75 10             	push   0x10(%ebp)
+  802211:	ff 75 0c             	push   0xc(%ebp)
+  802214:	ff 75 08             	push   0x8(%ebp)
+  802217:	e8 9a ff ff ff       	call   8021b6 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80221c:	c9                   	leave
+  80221d:	c3                   	ret
+
+0080221e <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80221e:	55                   	push   %ebp
+  80221f:	89 e5                	mov    %esp,%ebp
+  802221:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  802224:	b8 00 00 00 00       	mov    $0x0,%eax
+  802229:	eb 03                	jmp    80222e <strlen+0x10>
+		n++;
+  80222b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80222e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802232:	75 f7                	jne    80222b <strlen+0xd>
+	return n;
+}
+  802234:	5d                   	pop    %ebp
+  802235:	c3                   	ret
+
+00802236 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  802236:	55                   	push   %ebp
+  802237:	89 e5                	mov    %esp,%ebp
+  802239:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80223c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80223f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802244:	eb 03                	jmp    802249 <strnlen+0x13>
+		n++;
+  802246:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802249:	39 d0                	cmp    %edx,%eax
+  80224b:	74 08                	je     802255 <strnlen+0x1f>
+  80224d:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802251:	75 f3                	jne    802246 <strnlen+0x10>
+  802253:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  802255:	89 d0                	mov    %edx,%eax
+  802257:	5d                   	pop    %ebp
+  802258:	c3                   	ret
+
+00802259 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  802259:	55                   	push   %ebp
+  80225a:	89 e5                	mov    %esp,%ebp
+  80225c:	53                   	push   %ebx
+  80225d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802260:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  802263:	b8 00 00 00 00       	mov    $0x0,%eax
+  802268:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80226c:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80226f:	83 c0 01             	add    $0x1,%eax
+  802272:	84 d2                	test   %dl,%dl
+  802274:	75 f2                	jne    802268 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  802276:	89 c8                	mov    %ecx,%eax
+  802278:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80227b:	c9                   	leave
+  80227c:	c3                   	ret
+
+0080227d <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80227d:	55                   	push   %ebp
+  80227e:	89 e5                	mov    %esp,%ebp
+  802280:	53                   	push   %ebx
+  802281:	83 ec 10             	sub    $0x10,%esp
+  802284:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  802287:	53                   	push   %ebx
+  802288:	e8 91 ff ff ff       	call   80221e <strlen>
+  80228d:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  802290:	ff 75 0c             	push   0xc(%ebp)
+  802293:	01 d8                	add    %ebx,%eax
+  802295:	50                   	push   %eax
+  802296:	e8 be ff ff ff       	call   802259 <strcpy>
+	return dst;
+}
+  80229b:	89 d8                	mov    %ebx,%eax
+  80229d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022a0:	c9                   	leave
+  8022a1:	c3                   	ret
+
+008022a2 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8022a2:	55                   	push   %ebp
+  8022a3:	89 e5                	mov    %esp,%ebp
+  8022a5:	56                   	push   %esi
+  8022a6:	53                   	push   %ebx
+  8022a7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8022aa:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8022ad:	89 f3                	mov    %esi,%ebx
+  8022af:	03 5d 10             	add    0x10(%ebp),%ebx
+  8022b2:	89 f0                	mov    %esi,%eax
+  8022b4:	eb 0f                	jmp    8022c5 <strncpy+0x23>
+		*dst++ = *src;
+  8022b6:	83 c0 01             	add    $0x1,%eax
+  8022b9:	0f b6 0a             	movzbl (%edx),%ecx
+  8022bc:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8022bf:	80 f9 01             	cmp    $0x1,%cl
+  8022c2:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8022c5:	39 d8                	cmp    %ebx,%eax
+  8022c7:	75 ed                	jne    8022b6 <strncpy+0x14>
+	}
+	return ret;
+}
+  8022c9:	89 f0                	mov    %esi,%eax
+  8022cb:	5b                   	pop    %ebx
+  8022cc:	5e                   	pop    %esi
+  8022cd:	5d                   	pop    %ebp
+  8022ce:	c3                   	ret
+
+008022cf <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8022cf:	55                   	push   %ebp
+  8022d0:	89 e5                	mov    %esp,%ebp
+  8022d2:	56                   	push   %esi
+  8022d3:	53                   	push   %ebx
+  8022d4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8022d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022da:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8022dd:	89 f0                	mov    %esi,%eax
+  8022df:	85 d2                	test   %edx,%edx
+  8022e1:	74 21                	je     802304 <strlcpy+0x35>
+  8022e3:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8022e7:	89 f2                	mov    %esi,%edx
+  8022e9:	eb 09                	jmp    8022f4 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8022eb:	83 c1 01             	add    $0x1,%ecx
+  8022ee:	83 c2 01             	add    $0x1,%edx
+  8022f1:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8022f4:	39 c2                	cmp    %eax,%edx
+  8022f6:	74 09                	je     802301 <strlcpy+0x32>
+  8022f8:	0f b6 19             	movzbl (%ecx),%ebx
+  8022fb:	84 db                	test   %bl,%bl
+  8022fd:	75 ec                	jne    8022eb <strlcpy+0x1c>
+  8022ff:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  802301:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  802304:	29 f0                	sub    %esi,%eax
+}
+  802306:	5b                   	pop    %ebx
+  802307:	5e                   	pop    %esi
+  802308:	5d                   	pop    %ebp
+  802309:	c3                   	ret
+
+0080230a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80230a:	55                   	push   %ebp
+  80230b:	89 e5                	mov    %esp,%ebp
+  80230d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802310:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  802313:	eb 06                	jmp    80231b <strcmp+0x11>
+		p++, q++;
+  802315:	83 c1 01             	add    $0x1,%ecx
+  802318:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80231b:	0f b6 01             	movzbl (%ecx),%eax
+  80231e:	84 c0                	test   %al,%al
+  802320:	74 04                	je     802326 <strcmp+0x1c>
+  802322:	3a 02                	cmp    (%edx),%al
+  802324:	74 ef                	je     802315 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  802326:	0f b6 c0             	movzbl %al,%eax
+  802329:	0f b6 12             	movzbl (%edx),%edx
+  80232c:	29 d0                	sub    %edx,%eax
+}
+  80232e:	5d                   	pop    %ebp
+  80232f:	c3                   	ret
+
+00802330 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  802330:	55                   	push   %ebp
+  802331:	89 e5                	mov    %esp,%ebp
+  802333:	53                   	push   %ebx
+  802334:	8b 45 08             	mov    0x8(%ebp),%eax
+  802337:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80233a:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80233d:	eb 09                	jmp    802348 <strncmp+0x18>
+		n--, p++, q++;
+  80233f:	83 ea 01             	sub    $0x1,%edx
+  802342:	83 c0 01             	add    $0x1,%eax
+  802345:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  802348:	85 d2                	test   %edx,%edx
+  80234a:	74 18                	je     802364 <strncmp+0x34>
+  80234c:	0f b6 18             	movzbl (%eax),%ebx
+  80234f:	84 db                	test   %bl,%bl
+  802351:	74 04                	je     802357 <strncmp+0x27>
+  802353:	3a 19                	cmp    (%ecx),%bl
+  802355:	74 e8                	je     80233f <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  802357:	0f b6 00             	movzbl (%eax),%eax
+  80235a:	0f b6 11             	movzbl (%ecx),%edx
+  80235d:	29 d0                	sub    %edx,%eax
+}
+  80235f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802362:	c9                   	leave
+  802363:	c3                   	ret
+		return 0;
+  802364:	b8 00 00 00 00       	mov    $0x0,%eax
+  802369:	eb f4                	jmp    80235f <strncmp+0x2f>
+
+0080236b <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80236b:	55                   	push   %ebp
+  80236c:	89 e5                	mov    %esp,%ebp
+  80236e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802371:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  802375:	eb 03                	jmp    80237a <strchr+0xf>
+  802377:	83 c0 01             	add    $0x1,%eax
+  80237a:	0f b6 10             	movzbl (%eax),%edx
+  80237d:	84 d2                	test   %dl,%dl
+  80237f:	74 06                	je     802387 <strchr+0x1c>
+		if (*s == c)
+  802381:	38 ca                	cmp    %cl,%dl
+  802383:	75 f2                	jne    802377 <strchr+0xc>
+  802385:	eb 05                	jmp    80238c <strchr+0x21>
+			return (char *) s;
+	return 0;
+  802387:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80238c:	5d                   	pop    %ebp
+  80238d:	c3                   	ret
+
+0080238e <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80238e:	55                   	push   %ebp
+  80238f:	89 e5                	mov    %esp,%ebp
+  802391:	8b 45 08             	mov    0x8(%ebp),%eax
+  802394:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  802398:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80239b:	38 ca                	cmp    %cl,%dl
+  80239d:	74 09                	je     8023a8 <strfind+0x1a>
+  80239f:	84 d2                	test   %dl,%dl
+  8023a1:	74 05                	je     8023a8 <strfind+0x1a>
+	for (; *s; s++)
+  8023a3:	83 c0 01             	add    $0x1,%eax
+  8023a6:	eb f0                	jmp    802398 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8023a8:	5d                   	pop    %ebp
+  8023a9:	c3                   	ret
+
+008023aa <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8023aa:	55                   	push   %ebp
+  8023ab:	89 e5                	mov    %esp,%ebp
+  8023ad:	57                   	push   %edi
+  8023ae:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8023b1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8023b4:	85 c9                	test   %ecx,%ecx
+  8023b6:	74 20                	je     8023d8 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8023b8:	89 f8                	mov    %edi,%eax
+  8023ba:	09 c8                	or     %ecx,%eax
+  8023bc:	a8 03                	test   $0x3,%al
+  8023be:	75 12                	jne    8023d2 <memset+0x28>
+		c &= 0xFF;
+  8023c0:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8023c4:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8023ca:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8023cd:	fc                   	cld
+  8023ce:	f3 ab                	rep stos %eax,%es:(%edi)
+  8023d0:	eb 06                	jmp    8023d8 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8023d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023d5:	fc                   	cld
+  8023d6:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8023d8:	89 f8                	mov    %edi,%eax
+  8023da:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8023dd:	c9                   	leave
+  8023de:	c3                   	ret
+
+008023df <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8023df:	55                   	push   %ebp
+  8023e0:	89 e5                	mov    %esp,%ebp
+  8023e2:	57                   	push   %edi
+  8023e3:	56                   	push   %esi
+  8023e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023e7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8023ea:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8023ed:	39 c6                	cmp    %eax,%esi
+  8023ef:	73 32                	jae    802423 <memmove+0x44>
+  8023f1:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8023f4:	39 d0                	cmp    %edx,%eax
+  8023f6:	73 2b                	jae    802423 <memmove+0x44>
+		s += n;
+		d += n;
+  8023f8:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8023fb:	89 d6                	mov    %edx,%esi
+  8023fd:	09 fe                	or     %edi,%esi
+  8023ff:	09 ce                	or     %ecx,%esi
+  802401:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  802407:	75 0e                	jne    802417 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  802409:	83 ef 04             	sub    $0x4,%edi
+  80240c:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80240f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  802412:	fd                   	std
+  802413:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802415:	eb 09                	jmp    802420 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  802417:	83 ef 01             	sub    $0x1,%edi
+  80241a:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80241d:	fd                   	std
+  80241e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  802420:	fc                   	cld
+  802421:	eb 1a                	jmp    80243d <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802423:	89 f2                	mov    %esi,%edx
+  802425:	09 c2                	or     %eax,%edx
+  802427:	09 ca                	or     %ecx,%edx
+  802429:	f6 c2 03             	test   $0x3,%dl
+  80242c:	75 0a                	jne    802438 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80242e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  802431:	89 c7                	mov    %eax,%edi
+  802433:	fc                   	cld
+  802434:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802436:	eb 05                	jmp    80243d <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  802438:	89 c7                	mov    %eax,%edi
+  80243a:	fc                   	cld
+  80243b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80243d:	5e                   	pop    %esi
+  80243e:	5f                   	pop    %edi
+  80243f:	5d                   	pop    %ebp
+  802440:	c3                   	ret
+
+00802441 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  802441:	55                   	push   %ebp
+  802442:	89 e5                	mov    %esp,%ebp
+  802444:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  802447:	ff 75 10             	push   0x10(%ebp)
+  80244a:	ff 75 0c             	push   0xc(%ebp)
+  80244d:	ff 75 08             	push   0x8(%ebp)
+  802450:	e8 8a ff ff ff       	call   8023df <memmove>
+}
+  802455:	c9                   	leave
+  802456:	c3                   	ret
+
+00802457 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  802457:	55                   	push   %ebp
+  802458:	89 e5                	mov    %esp,%ebp
+  80245a:	56                   	push   %esi
+  80245b:	53                   	push   %ebx
+  80245c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80245f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  802462:	89 c6                	mov    %eax,%esi
+  802464:	03 75 10             	add    0x10(%ebp),%esi
+  802467:	eb 06                	jmp    80246f <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  802469:	83 c0 01             	add    $0x1,%eax
+  80246c:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  80246f:	39 f0                	cmp    %esi,%eax
+  802471:	74 14                	je     802487 <memcmp+0x30>
+		if (*s1 != *s2)
+  802473:	0f b6 08             	movzbl (%eax),%ecx
+  802476:	0f b6 1a             	movzbl (%edx),%ebx
+  802479:	38 d9                	cmp    %bl,%cl
+  80247b:	74 ec                	je     802469 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  80247d:	0f b6 c1             	movzbl %cl,%eax
+  802480:	0f b6 db             	movzbl %bl,%ebx
+  802483:	29 d8                	sub    %ebx,%eax
+  802485:	eb 05                	jmp    80248c <memcmp+0x35>
+	}
+
+	return 0;
+  802487:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80248c:	5b                   	pop    %ebx
+  80248d:	5e                   	pop    %esi
+  80248e:	5d                   	pop    %ebp
+  80248f:	c3                   	ret
+
+00802490 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802490:	55                   	push   %ebp
+  802491:	89 e5                	mov    %esp,%ebp
+  802493:	8b 45 08             	mov    0x8(%ebp),%eax
+  802496:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  802499:	89 c2                	mov    %eax,%edx
+  80249b:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  80249e:	eb 03                	jmp    8024a3 <memfind+0x13>
+  8024a0:	83 c0 01             	add    $0x1,%eax
+  8024a3:	39 d0                	cmp    %edx,%eax
+  8024a5:	73 04                	jae    8024ab <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8024a7:	38 08                	cmp    %cl,(%eax)
+  8024a9:	75 f5                	jne    8024a0 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8024ab:	5d                   	pop    %ebp
+  8024ac:	c3                   	ret
+
+008024ad <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8024ad:	55                   	push   %ebp
+  8024ae:	89 e5                	mov    %esp,%ebp
+  8024b0:	57                   	push   %edi
+  8024b1:	56                   	push   %esi
+  8024b2:	53                   	push   %ebx
+  8024b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024b6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8024b9:	eb 03                	jmp    8024be <strtol+0x11>
+		s++;
+  8024bb:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8024be:	0f b6 02             	movzbl (%edx),%eax
+  8024c1:	3c 20                	cmp    $0x20,%al
+  8024c3:	74 f6                	je     8024bb <strtol+0xe>
+  8024c5:	3c 09                	cmp    $0x9,%al
+  8024c7:	74 f2                	je     8024bb <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8024c9:	3c 2b                	cmp    $0x2b,%al
+  8024cb:	74 2a                	je     8024f7 <strtol+0x4a>
+	int neg = 0;
+  8024cd:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8024d2:	3c 2d                	cmp    $0x2d,%al
+  8024d4:	74 2b                	je     802501 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8024d6:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8024dc:	75 0f                	jne    8024ed <strtol+0x40>
+  8024de:	80 3a 30             	cmpb   $0x30,(%edx)
+  8024e1:	74 28                	je     80250b <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8024e3:	85 db                	test   %ebx,%ebx
+  8024e5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8024ea:	0f 44 d8             	cmove  %eax,%ebx
+  8024ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024f2:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8024f5:	eb 46                	jmp    80253d <strtol+0x90>
+		s++;
+  8024f7:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8024fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024ff:	eb d5                	jmp    8024d6 <strtol+0x29>
+		s++, neg = 1;
+  802501:	83 c2 01             	add    $0x1,%edx
+  802504:	bf 01 00 00 00       	mov    $0x1,%edi
+  802509:	eb cb                	jmp    8024d6 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80250b:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  80250f:	74 0e                	je     80251f <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  802511:	85 db                	test   %ebx,%ebx
+  802513:	75 d8                	jne    8024ed <strtol+0x40>
+		s++, base = 8;
+  802515:	83 c2 01             	add    $0x1,%edx
+  802518:	bb 08 00 00 00       	mov    $0x8,%ebx
+  80251d:	eb ce                	jmp    8024ed <strtol+0x40>
+		s += 2, base = 16;
+  80251f:	83 c2 02             	add    $0x2,%edx
+  802522:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802527:	eb c4                	jmp    8024ed <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  802529:	0f be c0             	movsbl %al,%eax
+  80252c:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  80252f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802532:	7d 3a                	jge    80256e <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  802534:	83 c2 01             	add    $0x1,%edx
+  802537:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  80253b:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  80253d:	0f b6 02             	movzbl (%edx),%eax
+  802540:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802543:	89 f3                	mov    %esi,%ebx
+  802545:	80 fb 09             	cmp    $0x9,%bl
+  802548:	76 df                	jbe    802529 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  80254a:	8d 70 9f             	lea    -0x61(%eax),%esi
+  80254d:	89 f3                	mov    %esi,%ebx
+  80254f:	80 fb 19             	cmp    $0x19,%bl
+  802552:	77 08                	ja     80255c <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  802554:	0f be c0             	movsbl %al,%eax
+  802557:	83 e8 57             	sub    $0x57,%eax
+  80255a:	eb d3                	jmp    80252f <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  80255c:	8d 70 bf             	lea    -0x41(%eax),%esi
+  80255f:	89 f3                	mov    %esi,%ebx
+  802561:	80 fb 19             	cmp    $0x19,%bl
+  802564:	77 08                	ja     80256e <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  802566:	0f be c0             	movsbl %al,%eax
+  802569:	83 e8 37             	sub    $0x37,%eax
+  80256c:	eb c1                	jmp    80252f <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  80256e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802572:	74 05                	je     802579 <strtol+0xcc>
+		*endptr = (char *) s;
+  802574:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802577:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  802579:	89 c8                	mov    %ecx,%eax
+  80257b:	f7 d8                	neg    %eax
+  80257d:	85 ff                	test   %edi,%edi
+  80257f:	0f 45 c8             	cmovne %eax,%ecx
+}
+  802582:	89 c8                	mov    %ecx,%eax
+  802584:	5b                   	pop    %ebx
+  802585:	5e                   	pop    %esi
+  802586:	5f                   	pop    %edi
+  802587:	5d                   	pop    %ebp
+  802588:	c3                   	ret
+
+00802589 <atoi>:
+
+int
+atoi(const char *s)
+{
+  802589:	55                   	push   %ebp
+  80258a:	89 e5                	mov    %esp,%ebp
+  80258c:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  80258f:	6a 0a                	push   $0xa
+  802591:	6a 00                	push   $0x0
+  802593:	ff 75 08             	push   0x8(%ebp)
+  802596:	e8 12 ff ff ff       	call   8024ad <strtol>
+}
+  80259b:	c9                   	leave
+  80259c:	c3                   	ret
+
+0080259d <dm>:
+  80259d:	55                   	push   %ebp
+  80259e:	57                   	push   %edi
+  80259f:	56                   	push   %esi
+  8025a0:	53                   	push   %ebx
+  8025a1:	83 ec 24             	sub    $0x24,%esp
+  8025a4:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8025a8:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8025ac:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8025b0:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8025b4:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8025b8:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8025bc:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8025c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025ca:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025cf:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8025d6:	00 
+  8025d7:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8025de:	00 
+  8025df:	89 fb                	mov    %edi,%ebx
+  8025e1:	eb 08                	jmp    8025eb <dm+0x4e>
+  8025e3:	83 e9 01             	sub    $0x1,%ecx
+  8025e6:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8025e9:	74 68                	je     802653 <dm+0xb6>
+  8025eb:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8025ef:	01 c0                	add    %eax,%eax
+  8025f1:	89 c6                	mov    %eax,%esi
+  8025f3:	89 d7                	mov    %edx,%edi
+  8025f5:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8025f9:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8025fd:	0f ad d0             	shrd   %cl,%edx,%eax
+  802600:	d3 ea                	shr    %cl,%edx
+  802602:	f6 c1 20             	test   $0x20,%cl
+  802605:	74 04                	je     80260b <dm+0x6e>
+  802607:	89 d0                	mov    %edx,%eax
+  802609:	31 d2                	xor    %edx,%edx
+  80260b:	83 e0 01             	and    $0x1,%eax
+  80260e:	89 04 24             	mov    %eax,(%esp)
+  802611:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802618:	00 
+  802619:	8b 04 24             	mov    (%esp),%eax
+  80261c:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802620:	09 f0                	or     %esi,%eax
+  802622:	09 fa                	or     %edi,%edx
+  802624:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802628:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80262c:	39 f0                	cmp    %esi,%eax
+  80262e:	89 d5                	mov    %edx,%ebp
+  802630:	19 fd                	sbb    %edi,%ebp
+  802632:	72 af                	jb     8025e3 <dm+0x46>
+  802634:	29 f0                	sub    %esi,%eax
+  802636:	19 fa                	sbb    %edi,%edx
+  802638:	89 cf                	mov    %ecx,%edi
+  80263a:	c1 ef 05             	shr    $0x5,%edi
+  80263d:	83 e7 01             	and    $0x1,%edi
+  802640:	89 fe                	mov    %edi,%esi
+  802642:	83 f6 01             	xor    $0x1,%esi
+  802645:	d3 e6                	shl    %cl,%esi
+  802647:	d3 e7                	shl    %cl,%edi
+  802649:	09 74 24 18          	or     %esi,0x18(%esp)
+  80264d:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802651:	eb 90                	jmp    8025e3 <dm+0x46>
+  802653:	85 db                	test   %ebx,%ebx
+  802655:	74 05                	je     80265c <dm+0xbf>
+  802657:	89 03                	mov    %eax,(%ebx)
+  802659:	89 53 04             	mov    %edx,0x4(%ebx)
+  80265c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802660:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802664:	83 c4 24             	add    $0x24,%esp
+  802667:	5b                   	pop    %ebx
+  802668:	5e                   	pop    %esi
+  802669:	5f                   	pop    %edi
+  80266a:	5d                   	pop    %ebp
+  80266b:	c3                   	ret
+
+0080266c <__udivdi3>:
+  80266c:	83 ec 08             	sub    $0x8,%esp
+  80266f:	6a 00                	push   $0x0
+  802671:	ff 74 24 1c          	push   0x1c(%esp)
+  802675:	ff 74 24 1c          	push   0x1c(%esp)
+  802679:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80267d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802681:	e8 17 ff ff ff       	call   80259d <dm>
+  802686:	83 c4 14             	add    $0x14,%esp
+  802689:	c3                   	ret
+
+0080268a <__umoddi3>:
+  80268a:	83 ec 18             	sub    $0x18,%esp
+  80268d:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802691:	50                   	push   %eax
+  802692:	ff 74 24 2c          	push   0x2c(%esp)
+  802696:	ff 74 24 2c          	push   0x2c(%esp)
+  80269a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80269e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8026a2:	e8 f6 fe ff ff       	call   80259d <dm>
+  8026a7:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8026ab:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8026af:	83 c4 24             	add    $0x24,%esp
+  8026b2:	c3                   	ret
+
+008026b3 <__divdi3>:
+  8026b3:	53                   	push   %ebx
+  8026b4:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8026b8:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026bc:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8026c0:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8026c4:	85 d2                	test   %edx,%edx
+  8026c6:	78 15                	js     8026dd <__divdi3+0x2a>
+  8026c8:	85 db                	test   %ebx,%ebx
+  8026ca:	78 34                	js     802700 <__divdi3+0x4d>
+  8026cc:	83 ec 04             	sub    $0x4,%esp
+  8026cf:	6a 00                	push   $0x0
+  8026d1:	53                   	push   %ebx
+  8026d2:	51                   	push   %ecx
+  8026d3:	e8 c5 fe ff ff       	call   80259d <dm>
+  8026d8:	83 c4 10             	add    $0x10,%esp
+  8026db:	eb 21                	jmp    8026fe <__divdi3+0x4b>
+  8026dd:	f7 d8                	neg    %eax
+  8026df:	83 d2 00             	adc    $0x0,%edx
+  8026e2:	f7 da                	neg    %edx
+  8026e4:	85 db                	test   %ebx,%ebx
+  8026e6:	78 30                	js     802718 <__divdi3+0x65>
+  8026e8:	83 ec 04             	sub    $0x4,%esp
+  8026eb:	6a 00                	push   $0x0
+  8026ed:	53                   	push   %ebx
+  8026ee:	51                   	push   %ecx
+  8026ef:	e8 a9 fe ff ff       	call   80259d <dm>
+  8026f4:	83 c4 10             	add    $0x10,%esp
+  8026f7:	f7 d8                	neg    %eax
+  8026f9:	83 d2 00             	adc    $0x0,%edx
+  8026fc:	f7 da                	neg    %edx
+  8026fe:	5b                   	pop    %ebx
+  8026ff:	c3                   	ret
+  802700:	83 ec 04             	sub    $0x4,%esp
+  802703:	6a 00                	push   $0x0
+  802705:	f7 d9                	neg    %ecx
+  802707:	83 d3 00             	adc    $0x0,%ebx
+  80270a:	f7 db                	neg    %ebx
+  80270c:	53                   	push   %ebx
+  80270d:	51                   	push   %ecx
+  80270e:	e8 8a fe ff ff       	call   80259d <dm>
+  802713:	83 c4 10             	add    $0x10,%esp
+  802716:	eb df                	jmp    8026f7 <__divdi3+0x44>
+  802718:	83 ec 04             	sub    $0x4,%esp
+  80271b:	6a 00                	push   $0x0
+  80271d:	f7 d9                	neg    %ecx
+  80271f:	83 d3 00             	adc    $0x0,%ebx
+  802722:	f7 db                	neg    %ebx
+  802724:	53                   	push   %ebx
+  802725:	51                   	push   %ecx
+  802726:	e8 72 fe ff ff       	call   80259d <dm>
+  80272b:	83 c4 10             	add    $0x10,%esp
+  80272e:	eb ce                	jmp    8026fe <__divdi3+0x4b>
+
+00802730 <__moddi3>:
+  802730:	55                   	push   %ebp
+  802731:	57                   	push   %edi
+  802732:	56                   	push   %esi
+  802733:	53                   	push   %ebx
+  802734:	83 ec 18             	sub    $0x18,%esp
+  802737:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  80273b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80273f:	89 f1                	mov    %esi,%ecx
+  802741:	f7 d9                	neg    %ecx
+  802743:	89 da                	mov    %ebx,%edx
+  802745:	83 d2 00             	adc    $0x0,%edx
+  802748:	f7 da                	neg    %edx
+  80274a:	0f 48 ce             	cmovs  %esi,%ecx
+  80274d:	0f 48 d3             	cmovs  %ebx,%edx
+  802750:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802754:	50                   	push   %eax
+  802755:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802759:	f7 de                	neg    %esi
+  80275b:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  80275f:	83 d0 00             	adc    $0x0,%eax
+  802762:	f7 d8                	neg    %eax
+  802764:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802769:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  80276e:	50                   	push   %eax
+  80276f:	56                   	push   %esi
+  802770:	89 c8                	mov    %ecx,%eax
+  802772:	e8 26 fe ff ff       	call   80259d <dm>
+  802777:	83 c4 10             	add    $0x10,%esp
+  80277a:	85 db                	test   %ebx,%ebx
+  80277c:	78 10                	js     80278e <__moddi3+0x5e>
+  80277e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802782:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802786:	83 c4 14             	add    $0x14,%esp
+  802789:	5b                   	pop    %ebx
+  80278a:	5e                   	pop    %esi
+  80278b:	5f                   	pop    %edi
+  80278c:	5d                   	pop    %ebp
+  80278d:	c3                   	ret
+  80278e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802792:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802796:	f7 d8                	neg    %eax
+  802798:	83 d2 00             	adc    $0x0,%edx
+  80279b:	f7 da                	neg    %edx
+  80279d:	eb e7                	jmp    802786 <__moddi3+0x56>
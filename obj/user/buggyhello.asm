@@ -0,0 +1,5039 @@
+
+obj/user/buggyhello:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 16 00 00 00       	call   800047 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	sys_cputs((char*)1, 1);
+  800039:	6a 01                	push   $0x1
+  80003b:	6a 01                	push   $0x1
+  80003d:	e8 b4 02 00 00       	call   8002f6 <sys_cputs>
+}
+  800042:	83 c4 10             	add    $0x10,%esp
+  800045:	c9                   	leave
+  800046:	c3                   	ret
+
+00800047 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800047:	55                   	push   %ebp
+  800048:	89 e5                	mov    %esp,%ebp
+  80004a:	56                   	push   %esi
+  80004b:	53                   	push   %ebx
+  80004c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80004f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  800052:	e8 9d 04 00 00       	call   8004f4 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  800057:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80005c:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  800062:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800067:	a3 08 30 80 00       	mov    %eax,0x803008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80006c:	85 db                	test   %ebx,%ebx
+  80006e:	7e 07                	jle    800077 <libmain+0x30>
+		binaryname = argv[0];
+  800070:	8b 06                	mov    (%esi),%eax
+  800072:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  800077:	83 ec 08             	sub    $0x8,%esp
+  80007a:	56                   	push   %esi
+  80007b:	53                   	push   %ebx
+  80007c:	e8 b2 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800081:	e8 0a 00 00 00       	call   800090 <exit>
+}
+  800086:	83 c4 10             	add    $0x10,%esp
+  800089:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008c:	5b                   	pop    %ebx
+  80008d:	5e                   	pop    %esi
+  80008e:	5d                   	pop    %ebp
+  80008f:	c3                   	ret
+
+00800090 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800090:	55                   	push   %ebp
+  800091:	89 e5                	mov    %esp,%ebp
+  800093:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  800096:	6a 00                	push   $0x0
+  800098:	e8 95 03 00 00       	call   800432 <sys_env_destroy>
+}
+  80009d:	83 c4 10             	add    $0x10,%esp
+  8000a0:	c9                   	leave
+  8000a1:	c3                   	ret
+
+008000a2 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  8000a2:	55                   	push   %ebp
+  8000a3:	89 e5                	mov    %esp,%ebp
+  8000a5:	57                   	push   %edi
+  8000a6:	56                   	push   %esi
+  8000a7:	53                   	push   %ebx
+  8000a8:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  8000ae:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  8000b4:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  8000ba:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  8000c0:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  8000c7:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  8000ca:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  8000d1:	00 00 00 
+		if (num == SYS_page_map_vec)
+  8000d4:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  8000db:	74 76                	je     800153 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  8000dd:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  8000e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8000e6:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  8000ec:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8000f3:	0f 88 06 01 00 00    	js     8001ff <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  8000f9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800100:	0f 84 48 01 00 00    	je     80024e <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800106:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  80010c:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800112:	be 00 00 00 00       	mov    $0x0,%esi
+  800117:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  80011d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800120:	55                   	push   %ebp
+  800121:	68 2a 01 80 00       	push   $0x80012a
+  800126:	89 e5                	mov    %esp,%ebp
+  800128:	0f 34                	sysenter
+  80012a:	83 c4 04             	add    $0x4,%esp
+  80012d:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  80012e:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800134:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  80013a:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  80013d:	0f 85 9a 01 00 00    	jne    8002dd <page_vec_call+0x23b>
+  800143:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800148:	8b 75 08             	mov    0x8(%ebp),%esi
+  80014b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80014e:	e9 29 01 00 00       	jmp    80027c <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800153:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800159:	8b 45 08             	mov    0x8(%ebp),%eax
+  80015c:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  80015e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800165:	78 2f                	js     800196 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800167:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80016e:	74 72                	je     8001e2 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800170:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800176:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  80017c:	b8 10 00 00 00       	mov    $0x10,%eax
+  800181:	89 fb                	mov    %edi,%ebx
+  800183:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800186:	55                   	push   %ebp
+  800187:	68 90 01 80 00       	push   $0x800190
+  80018c:	89 e5                	mov    %esp,%ebp
+  80018e:	0f 34                	sysenter
+  800190:	83 c4 04             	add    $0x4,%esp
+  800193:	5d                   	pop    %ebp
+	return ret;
+  800194:	eb 98                	jmp    80012e <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800196:	b8 01 00 00 00       	mov    $0x1,%eax
+  80019b:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  80019d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8001a2:	f6 c6 08             	test   $0x8,%dh
+  8001a5:	74 15                	je     8001bc <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8001a7:	89 c2                	mov    %eax,%edx
+  8001a9:	c1 ea 08             	shr    $0x8,%edx
+  8001ac:	83 e2 0f             	and    $0xf,%edx
+  8001af:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8001b4:	83 fa 06             	cmp    $0x6,%edx
+  8001b7:	74 0e                	je     8001c7 <page_vec_call+0x125>
+  8001b9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8001bc:	0f b6 c9             	movzbl %cl,%ecx
+  8001bf:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8001c5:	eb a0                	jmp    800167 <page_vec_call+0xc5>
+  8001c7:	89 c2                	mov    %eax,%edx
+  8001c9:	c1 ea 04             	shr    $0x4,%edx
+  8001cc:	83 e2 0f             	and    $0xf,%edx
+  8001cf:	83 fa 02             	cmp    $0x2,%edx
+  8001d2:	77 e5                	ja     8001b9 <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  8001d4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8001d7:	83 f8 02             	cmp    $0x2,%eax
+  8001da:	0f 97 c1             	seta   %cl
+  8001dd:	0f b6 c9             	movzbl %cl,%ecx
+  8001e0:	eb d7                	jmp    8001b9 <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  8001e2:	b8 10 00 00 00       	mov    $0x10,%eax
+  8001e7:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  8001ed:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  8001f3:	89 fb                	mov    %edi,%ebx
+  8001f5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8001f8:	cd 30                	int    $0x30
+  8001fa:	e9 2f ff ff ff       	jmp    80012e <page_vec_call+0x8c>
+  8001ff:	b8 01 00 00 00       	mov    $0x1,%eax
+  800204:	0f a2                	cpuid
+		return 0;
+  800206:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80020b:	f6 c6 08             	test   $0x8,%dh
+  80020e:	74 15                	je     800225 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800210:	89 c2                	mov    %eax,%edx
+  800212:	c1 ea 08             	shr    $0x8,%edx
+  800215:	83 e2 0f             	and    $0xf,%edx
+  800218:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80021d:	83 fa 06             	cmp    $0x6,%edx
+  800220:	74 11                	je     800233 <page_vec_call+0x191>
+  800222:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800225:	0f b6 c9             	movzbl %cl,%ecx
+  800228:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80022e:	e9 c6 fe ff ff       	jmp    8000f9 <page_vec_call+0x57>
+  800233:	89 c2                	mov    %eax,%edx
+  800235:	c1 ea 04             	shr    $0x4,%edx
+  800238:	83 e2 0f             	and    $0xf,%edx
+  80023b:	83 fa 02             	cmp    $0x2,%edx
+  80023e:	77 e2                	ja     800222 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800240:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800243:	83 f8 02             	cmp    $0x2,%eax
+  800246:	0f 97 c1             	seta   %cl
+  800249:	0f b6 c9             	movzbl %cl,%ecx
+  80024c:	eb d4                	jmp    800222 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  80024e:	be 00 00 00 00       	mov    $0x0,%esi
+  800253:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800259:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  80025f:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800265:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800268:	cd 30                	int    $0x30
+  80026a:	e9 bf fe ff ff       	jmp    80012e <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  80026f:	29 da                	sub    %ebx,%edx
+			vec++;
+  800271:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800274:	83 e8 01             	sub    $0x1,%eax
+  800277:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  80027c:	85 c0                	test   %eax,%eax
+  80027e:	74 58                	je     8002d8 <page_vec_call+0x236>
+  800280:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800283:	39 da                	cmp    %ebx,%edx
+  800285:	73 e8                	jae    80026f <page_vec_call+0x1cd>
+  800287:	89 75 08             	mov    %esi,0x8(%ebp)
+  80028a:	89 45 0c             	mov    %eax,0xc(%ebp)
+  80028d:	84 c9                	test   %cl,%cl
+  80028f:	74 06                	je     800297 <page_vec_call+0x1f5>
+  800291:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800297:	83 ec 04             	sub    $0x4,%esp
+  80029a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80029d:	c1 e0 04             	shl    $0x4,%eax
+  8002a0:	50                   	push   %eax
+  8002a1:	ff 75 08             	push   0x8(%ebp)
+  8002a4:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  8002aa:	53                   	push   %ebx
+  8002ab:	e8 41 21 00 00       	call   8023f1 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  8002b0:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  8002b6:	89 c2                	mov    %eax,%edx
+  8002b8:	c1 e2 0c             	shl    $0xc,%edx
+  8002bb:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  8002c1:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  8002c7:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  8002cd:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  8002d0:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  8002d3:	e9 f2 fd ff ff       	jmp    8000ca <page_vec_call+0x28>
+			r = 0;
+  8002d8:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  8002dd:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8002e1:	74 0b                	je     8002ee <page_vec_call+0x24c>
+		*done = total;
+  8002e3:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002e6:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  8002ec:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  8002ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002f1:	5b                   	pop    %ebx
+  8002f2:	5e                   	pop    %esi
+  8002f3:	5f                   	pop    %edi
+  8002f4:	5d                   	pop    %ebp
+  8002f5:	c3                   	ret
+
+008002f6 <sys_cputs>:
+{
+  8002f6:	55                   	push   %ebp
+  8002f7:	89 e5                	mov    %esp,%ebp
+  8002f9:	57                   	push   %edi
+  8002fa:	56                   	push   %esi
+  8002fb:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8002fc:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800303:	78 2d                	js     800332 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800305:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80030c:	74 70                	je     80037e <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  80030e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800313:	8b 55 08             	mov    0x8(%ebp),%edx
+  800316:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800319:	89 c3                	mov    %eax,%ebx
+  80031b:	89 c7                	mov    %eax,%edi
+  80031d:	89 c6                	mov    %eax,%esi
+  80031f:	55                   	push   %ebp
+  800320:	68 29 03 80 00       	push   $0x800329
+  800325:	89 e5                	mov    %esp,%ebp
+  800327:	0f 34                	sysenter
+  800329:	83 c4 04             	add    $0x4,%esp
+  80032c:	5d                   	pop    %ebp
+}
+  80032d:	5b                   	pop    %ebx
+  80032e:	5e                   	pop    %esi
+  80032f:	5f                   	pop    %edi
+  800330:	5d                   	pop    %ebp
+  800331:	c3                   	ret
+  800332:	b8 01 00 00 00       	mov    $0x1,%eax
+  800337:	0f a2                	cpuid
+		return 0;
+  800339:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80033e:	f6 c6 08             	test   $0x8,%dh
+  800341:	74 15                	je     800358 <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800343:	89 c2                	mov    %eax,%edx
+  800345:	c1 ea 08             	shr    $0x8,%edx
+  800348:	83 e2 0f             	and    $0xf,%edx
+  80034b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800350:	83 fa 06             	cmp    $0x6,%edx
+  800353:	74 0e                	je     800363 <sys_cputs+0x6d>
+  800355:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800358:	0f b6 c9             	movzbl %cl,%ecx
+  80035b:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800361:	eb a2                	jmp    800305 <sys_cputs+0xf>
+  800363:	89 c2                	mov    %eax,%edx
+  800365:	c1 ea 04             	shr    $0x4,%edx
+  800368:	83 e2 0f             	and    $0xf,%edx
+  80036b:	83 fa 02             	cmp    $0x2,%edx
+  80036e:	77 e5                	ja     800355 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800370:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800373:	83 f8 02             	cmp    $0x2,%eax
+  800376:	0f 97 c1             	seta   %cl
+  800379:	0f b6 c9             	movzbl %cl,%ecx
+  80037c:	eb d7                	jmp    800355 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  80037e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800383:	8b 55 08             	mov    0x8(%ebp),%edx
+  800386:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800389:	89 c3                	mov    %eax,%ebx
+  80038b:	89 c7                	mov    %eax,%edi
+  80038d:	89 c6                	mov    %eax,%esi
+  80038f:	cd 30                	int    $0x30
+}
+  800391:	eb 9a                	jmp    80032d <sys_cputs+0x37>
+
+00800393 <sys_cgetc>:
+{
+  800393:	55                   	push   %ebp
+  800394:	89 e5                	mov    %esp,%ebp
+  800396:	57                   	push   %edi
+  800397:	56                   	push   %esi
+  800398:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800399:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8003a0:	78 2e                	js     8003d0 <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  8003a2:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8003a9:	74 71                	je     80041c <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  8003ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8003b5:	89 d1                	mov    %edx,%ecx
+  8003b7:	89 d3                	mov    %edx,%ebx
+  8003b9:	89 d7                	mov    %edx,%edi
+  8003bb:	89 d6                	mov    %edx,%esi
+  8003bd:	55                   	push   %ebp
+  8003be:	68 c7 03 80 00       	push   $0x8003c7
+  8003c3:	89 e5                	mov    %esp,%ebp
+  8003c5:	0f 34                	sysenter
+  8003c7:	83 c4 04             	add    $0x4,%esp
+  8003ca:	5d                   	pop    %ebp
+}
+  8003cb:	5b                   	pop    %ebx
+  8003cc:	5e                   	pop    %esi
+  8003cd:	5f                   	pop    %edi
+  8003ce:	5d                   	pop    %ebp
+  8003cf:	c3                   	ret
+  8003d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8003d5:	0f a2                	cpuid
+		return 0;
+  8003d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8003dc:	f6 c6 08             	test   $0x8,%dh
+  8003df:	74 15                	je     8003f6 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8003e1:	89 c2                	mov    %eax,%edx
+  8003e3:	c1 ea 08             	shr    $0x8,%edx
+  8003e6:	83 e2 0f             	and    $0xf,%edx
+  8003e9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8003ee:	83 fa 06             	cmp    $0x6,%edx
+  8003f1:	74 0e                	je     800401 <sys_cgetc+0x6e>
+  8003f3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8003f6:	0f b6 c9             	movzbl %cl,%ecx
+  8003f9:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8003ff:	eb a1                	jmp    8003a2 <sys_cgetc+0xf>
+  800401:	89 c2                	mov    %eax,%edx
+  800403:	c1 ea 04             	shr    $0x4,%edx
+  800406:	83 e2 0f             	and    $0xf,%edx
+  800409:	83 fa 02             	cmp    $0x2,%edx
+  80040c:	77 e5                	ja     8003f3 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  80040e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800411:	83 f8 02             	cmp    $0x2,%eax
+  800414:	0f 97 c1             	seta   %cl
+  800417:	0f b6 c9             	movzbl %cl,%ecx
+  80041a:	eb d7                	jmp    8003f3 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  80041c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800421:	b8 01 00 00 00       	mov    $0x1,%eax
+  800426:	89 d1                	mov    %edx,%ecx
+  800428:	89 d3                	mov    %edx,%ebx
+  80042a:	89 d7                	mov    %edx,%edi
+  80042c:	89 d6                	mov    %edx,%esi
+  80042e:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800430:	eb 99                	jmp    8003cb <sys_cgetc+0x38>
+
+00800432 <sys_env_destroy>:
+{
+  800432:	55                   	push   %ebp
+  800433:	89 e5                	mov    %esp,%ebp
+  800435:	57                   	push   %edi
+  800436:	56                   	push   %esi
+  800437:	53                   	push   %ebx
+  800438:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80043b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800442:	78 36                	js     80047a <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  800444:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80044b:	74 79                	je     8004c6 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  80044d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800450:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800455:	b8 03 00 00 00       	mov    $0x3,%eax
+  80045a:	89 cb                	mov    %ecx,%ebx
+  80045c:	89 cf                	mov    %ecx,%edi
+  80045e:	89 ce                	mov    %ecx,%esi
+  800460:	55                   	push   %ebp
+  800461:	68 6a 04 80 00       	push   $0x80046a
+  800466:	89 e5                	mov    %esp,%ebp
+  800468:	0f 34                	sysenter
+  80046a:	83 c4 04             	add    $0x4,%esp
+  80046d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80046e:	85 c0                	test   %eax,%eax
+  800470:	7f 6b                	jg     8004dd <sys_env_destroy+0xab>
+}
+  800472:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800475:	5b                   	pop    %ebx
+  800476:	5e                   	pop    %esi
+  800477:	5f                   	pop    %edi
+  800478:	5d                   	pop    %ebp
+  800479:	c3                   	ret
+  80047a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80047f:	0f a2                	cpuid
+		return 0;
+  800481:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800486:	f6 c6 08             	test   $0x8,%dh
+  800489:	74 15                	je     8004a0 <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80048b:	89 c2                	mov    %eax,%edx
+  80048d:	c1 ea 08             	shr    $0x8,%edx
+  800490:	83 e2 0f             	and    $0xf,%edx
+  800493:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800498:	83 fa 06             	cmp    $0x6,%edx
+  80049b:	74 0e                	je     8004ab <sys_env_destroy+0x79>
+  80049d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8004a0:	0f b6 c9             	movzbl %cl,%ecx
+  8004a3:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8004a9:	eb 99                	jmp    800444 <sys_env_destroy+0x12>
+  8004ab:	89 c2                	mov    %eax,%edx
+  8004ad:	c1 ea 04             	shr    $0x4,%edx
+  8004b0:	83 e2 0f             	and    $0xf,%edx
+  8004b3:	83 fa 02             	cmp    $0x2,%edx
+  8004b6:	77 e5                	ja     80049d <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  8004b8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8004bb:	83 f8 02             	cmp    $0x2,%eax
+  8004be:	0f 97 c1             	seta   %cl
+  8004c1:	0f b6 c9             	movzbl %cl,%ecx
+  8004c4:	eb d7                	jmp    80049d <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  8004c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004cb:	b8 03 00 00 00       	mov    $0x3,%eax
+  8004d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004d3:	89 cb                	mov    %ecx,%ebx
+  8004d5:	89 cf                	mov    %ecx,%edi
+  8004d7:	89 ce                	mov    %ecx,%esi
+  8004d9:	cd 30                	int    $0x30
+  8004db:	eb 91                	jmp    80046e <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004dd:	83 ec 0c             	sub    $0xc,%esp
+  8004e0:	50                   	push   %eax
+  8004e1:	6a 03                	push   $0x3
+  8004e3:	68 ca 27 80 00       	push   $0x8027ca
+  8004e8:	6a 4a                	push   $0x4a
+  8004ea:	68 e7 27 80 00       	push   $0x8027e7
+  8004ef:	e8 1e 17 00 00       	call   801c12 <_panic>
+
+008004f4 <sys_getenvid>:
+{
+  8004f4:	55                   	push   %ebp
+  8004f5:	89 e5                	mov    %esp,%ebp
+  8004f7:	57                   	push   %edi
+  8004f8:	56                   	push   %esi
+  8004f9:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8004fa:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800501:	78 2e                	js     800531 <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  800503:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80050a:	74 71                	je     80057d <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  80050c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800511:	b8 02 00 00 00       	mov    $0x2,%eax
+  800516:	89 d1                	mov    %edx,%ecx
+  800518:	89 d3                	mov    %edx,%ebx
+  80051a:	89 d7                	mov    %edx,%edi
+  80051c:	89 d6                	mov    %edx,%esi
+  80051e:	55                   	push   %ebp
+  80051f:	68 28 05 80 00       	push   $0x800528
+  800524:	89 e5                	mov    %esp,%ebp
+  800526:	0f 34                	sysenter
+  800528:	83 c4 04             	add    $0x4,%esp
+  80052b:	5d                   	pop    %ebp
+}
+  80052c:	5b                   	pop    %ebx
+  80052d:	5e                   	pop    %esi
+  80052e:	5f                   	pop    %edi
+  80052f:	5d                   	pop    %ebp
+  800530:	c3                   	ret
+  800531:	b8 01 00 00 00       	mov    $0x1,%eax
+  800536:	0f a2                	cpuid
+		return 0;
+  800538:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80053d:	f6 c6 08             	test   $0x8,%dh
+  800540:	74 15                	je     800557 <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800542:	89 c2                	mov    %eax,%edx
+  800544:	c1 ea 08             	shr    $0x8,%edx
+  800547:	83 e2 0f             	and    $0xf,%edx
+  80054a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80054f:	83 fa 06             	cmp    $0x6,%edx
+  800552:	74 0e                	je     800562 <sys_getenvid+0x6e>
+  800554:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800557:	0f b6 c9             	movzbl %cl,%ecx
+  80055a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800560:	eb a1                	jmp    800503 <sys_getenvid+0xf>
+  800562:	89 c2                	mov    %eax,%edx
+  800564:	c1 ea 04             	shr    $0x4,%edx
+  800567:	83 e2 0f             	and    $0xf,%edx
+  80056a:	83 fa 02             	cmp    $0x2,%edx
+  80056d:	77 e5                	ja     800554 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  80056f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800572:	83 f8 02             	cmp    $0x2,%eax
+  800575:	0f 97 c1             	seta   %cl
+  800578:	0f b6 c9             	movzbl %cl,%ecx
+  80057b:	eb d7                	jmp    800554 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  80057d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800582:	b8 02 00 00 00       	mov    $0x2,%eax
+  800587:	89 d1                	mov    %edx,%ecx
+  800589:	89 d3                	mov    %edx,%ebx
+  80058b:	89 d7                	mov    %edx,%edi
+  80058d:	89 d6                	mov    %edx,%esi
+  80058f:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  800591:	eb 99                	jmp    80052c <sys_getenvid+0x38>
+
+00800593 <sys_page_alloc>:
+{
+  800593:	55                   	push   %ebp
+  800594:	89 e5                	mov    %esp,%ebp
+  800596:	57                   	push   %edi
+  800597:	56                   	push   %esi
+  800598:	53                   	push   %ebx
+  800599:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80059c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8005a3:	78 38                	js     8005dd <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  8005a5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8005ac:	74 7b                	je     800629 <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  8005ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8005b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005b9:	b8 04 00 00 00       	mov    $0x4,%eax
+  8005be:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005c1:	89 f7                	mov    %esi,%edi
+  8005c3:	55                   	push   %ebp
+  8005c4:	68 cd 05 80 00       	push   $0x8005cd
+  8005c9:	89 e5                	mov    %esp,%ebp
+  8005cb:	0f 34                	sysenter
+  8005cd:	83 c4 04             	add    $0x4,%esp
+  8005d0:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8005d1:	85 c0                	test   %eax,%eax
+  8005d3:	7f 6d                	jg     800642 <sys_page_alloc+0xaf>
+}
+  8005d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005d8:	5b                   	pop    %ebx
+  8005d9:	5e                   	pop    %esi
+  8005da:	5f                   	pop    %edi
+  8005db:	5d                   	pop    %ebp
+  8005dc:	c3                   	ret
+  8005dd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8005e2:	0f a2                	cpuid
+		return 0;
+  8005e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8005e9:	f6 c6 08             	test   $0x8,%dh
+  8005ec:	74 15                	je     800603 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8005ee:	89 c2                	mov    %eax,%edx
+  8005f0:	c1 ea 08             	shr    $0x8,%edx
+  8005f3:	83 e2 0f             	and    $0xf,%edx
+  8005f6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8005fb:	83 fa 06             	cmp    $0x6,%edx
+  8005fe:	74 0e                	je     80060e <sys_page_alloc+0x7b>
+  800600:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800603:	0f b6 c9             	movzbl %cl,%ecx
+  800606:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80060c:	eb 97                	jmp    8005a5 <sys_page_alloc+0x12>
+  80060e:	89 c2                	mov    %eax,%edx
+  800610:	c1 ea 04             	shr    $0x4,%edx
+  800613:	83 e2 0f             	and    $0xf,%edx
+  800616:	83 fa 02             	cmp    $0x2,%edx
+  800619:	77 e5                	ja     800600 <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  80061b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80061e:	83 f8 02             	cmp    $0x2,%eax
+  800621:	0f 97 c1             	seta   %cl
+  800624:	0f b6 c9             	movzbl %cl,%ecx
+  800627:	eb d7                	jmp    800600 <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  800629:	be 00 00 00 00       	mov    $0x0,%esi
+  80062e:	b8 04 00 00 00       	mov    $0x4,%eax
+  800633:	8b 55 08             	mov    0x8(%ebp),%edx
+  800636:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800639:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80063c:	89 f7                	mov    %esi,%edi
+  80063e:	cd 30                	int    $0x30
+  800640:	eb 8f                	jmp    8005d1 <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800642:	83 ec 0c             	sub    $0xc,%esp
+  800645:	50                   	push   %eax
+  800646:	6a 04                	push   $0x4
+  800648:	68 ca 27 80 00       	push   $0x8027ca
+  80064d:	6a 4a                	push   $0x4a
+  80064f:	68 e7 27 80 00       	push   $0x8027e7
+  800654:	e8 b9 15 00 00       	call   801c12 <_panic>
+
+00800659 <sys_page_map>:
+{
+  800659:	55                   	push   %ebp
+  80065a:	89 e5                	mov    %esp,%ebp
+  80065c:	57                   	push   %edi
+  80065d:	56                   	push   %esi
+  80065e:	53                   	push   %ebx
+  80065f:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800662:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800669:	78 37                	js     8006a2 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  80066b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800672:	74 7a                	je     8006ee <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  800674:	8b 55 08             	mov    0x8(%ebp),%edx
+  800677:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80067a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80067f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800682:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800685:	8b 75 18             	mov    0x18(%ebp),%esi
+  800688:	55                   	push   %ebp
+  800689:	68 92 06 80 00       	push   $0x800692
+  80068e:	89 e5                	mov    %esp,%ebp
+  800690:	0f 34                	sysenter
+  800692:	83 c4 04             	add    $0x4,%esp
+  800695:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800696:	85 c0                	test   %eax,%eax
+  800698:	7f 6c                	jg     800706 <sys_page_map+0xad>
+}
+  80069a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80069d:	5b                   	pop    %ebx
+  80069e:	5e                   	pop    %esi
+  80069f:	5f                   	pop    %edi
+  8006a0:	5d                   	pop    %ebp
+  8006a1:	c3                   	ret
+  8006a2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8006a7:	0f a2                	cpuid
+		return 0;
+  8006a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8006ae:	f6 c6 08             	test   $0x8,%dh
+  8006b1:	74 15                	je     8006c8 <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8006b3:	89 c2                	mov    %eax,%edx
+  8006b5:	c1 ea 08             	shr    $0x8,%edx
+  8006b8:	83 e2 0f             	and    $0xf,%edx
+  8006bb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8006c0:	83 fa 06             	cmp    $0x6,%edx
+  8006c3:	74 0e                	je     8006d3 <sys_page_map+0x7a>
+  8006c5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8006c8:	0f b6 c9             	movzbl %cl,%ecx
+  8006cb:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8006d1:	eb 98                	jmp    80066b <sys_page_map+0x12>
+  8006d3:	89 c2                	mov    %eax,%edx
+  8006d5:	c1 ea 04             	shr    $0x4,%edx
+  8006d8:	83 e2 0f             	and    $0xf,%edx
+  8006db:	83 fa 02             	cmp    $0x2,%edx
+  8006de:	77 e5                	ja     8006c5 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  8006e0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8006e3:	83 f8 02             	cmp    $0x2,%eax
+  8006e6:	0f 97 c1             	seta   %cl
+  8006e9:	0f b6 c9             	movzbl %cl,%ecx
+  8006ec:	eb d7                	jmp    8006c5 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  8006ee:	b8 05 00 00 00       	mov    $0x5,%eax
+  8006f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8006fc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8006ff:	8b 75 18             	mov    0x18(%ebp),%esi
+  800702:	cd 30                	int    $0x30
+  800704:	eb 90                	jmp    800696 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800706:	83 ec 0c             	sub    $0xc,%esp
+  800709:	50                   	push   %eax
+  80070a:	6a 05                	push   $0x5
+  80070c:	68 ca 27 80 00       	push   $0x8027ca
+  800711:	6a 4a                	push   $0x4a
+  800713:	68 e7 27 80 00       	push   $0x8027e7
+  800718:	e8 f5 14 00 00       	call   801c12 <_panic>
+
+0080071d <sys_page_unmap>:
+{
+  80071d:	55                   	push   %ebp
+  80071e:	89 e5                	mov    %esp,%ebp
+  800720:	57                   	push   %edi
+  800721:	56                   	push   %esi
+  800722:	53                   	push   %ebx
+  800723:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800726:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80072d:	78 37                	js     800766 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  80072f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800736:	74 7a                	je     8007b2 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  800738:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80073d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800740:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800743:	b8 06 00 00 00       	mov    $0x6,%eax
+  800748:	89 df                	mov    %ebx,%edi
+  80074a:	89 de                	mov    %ebx,%esi
+  80074c:	55                   	push   %ebp
+  80074d:	68 56 07 80 00       	push   $0x800756
+  800752:	89 e5                	mov    %esp,%ebp
+  800754:	0f 34                	sysenter
+  800756:	83 c4 04             	add    $0x4,%esp
+  800759:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80075a:	85 c0                	test   %eax,%eax
+  80075c:	7f 6c                	jg     8007ca <sys_page_unmap+0xad>
+}
+  80075e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800761:	5b                   	pop    %ebx
+  800762:	5e                   	pop    %esi
+  800763:	5f                   	pop    %edi
+  800764:	5d                   	pop    %ebp
+  800765:	c3                   	ret
+  800766:	b8 01 00 00 00       	mov    $0x1,%eax
+  80076b:	0f a2                	cpuid
+		return 0;
+  80076d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800772:	f6 c6 08             	test   $0x8,%dh
+  800775:	74 15                	je     80078c <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800777:	89 c2                	mov    %eax,%edx
+  800779:	c1 ea 08             	shr    $0x8,%edx
+  80077c:	83 e2 0f             	and    $0xf,%edx
+  80077f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800784:	83 fa 06             	cmp    $0x6,%edx
+  800787:	74 0e                	je     800797 <sys_page_unmap+0x7a>
+  800789:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80078c:	0f b6 c9             	movzbl %cl,%ecx
+  80078f:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800795:	eb 98                	jmp    80072f <sys_page_unmap+0x12>
+  800797:	89 c2                	mov    %eax,%edx
+  800799:	c1 ea 04             	shr    $0x4,%edx
+  80079c:	83 e2 0f             	and    $0xf,%edx
+  80079f:	83 fa 02             	cmp    $0x2,%edx
+  8007a2:	77 e5                	ja     800789 <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  8007a4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8007a7:	83 f8 02             	cmp    $0x2,%eax
+  8007aa:	0f 97 c1             	seta   %cl
+  8007ad:	0f b6 c9             	movzbl %cl,%ecx
+  8007b0:	eb d7                	jmp    800789 <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  8007b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007b7:	b8 06 00 00 00       	mov    $0x6,%eax
+  8007bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007c2:	89 df                	mov    %ebx,%edi
+  8007c4:	89 de                	mov    %ebx,%esi
+  8007c6:	cd 30                	int    $0x30
+  8007c8:	eb 90                	jmp    80075a <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8007ca:	83 ec 0c             	sub    $0xc,%esp
+  8007cd:	50                   	push   %eax
+  8007ce:	6a 06                	push   $0x6
+  8007d0:	68 ca 27 80 00       	push   $0x8027ca
+  8007d5:	6a 4a                	push   $0x4a
+  8007d7:	68 e7 27 80 00       	push   $0x8027e7
+  8007dc:	e8 31 14 00 00       	call   801c12 <_panic>
+
+008007e1 <sys_page_copy>:
+{
+  8007e1:	55                   	push   %ebp
+  8007e2:	89 e5                	mov    %esp,%ebp
+  8007e4:	57                   	push   %edi
+  8007e5:	56                   	push   %esi
+  8007e6:	53                   	push   %ebx
+  8007e7:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8007ea:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8007f1:	78 37                	js     80082a <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  8007f3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8007fa:	74 7a                	je     800876 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  8007fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800802:	b8 29 00 00 00       	mov    $0x29,%eax
+  800807:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80080a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80080d:	8b 75 18             	mov    0x18(%ebp),%esi
+  800810:	55                   	push   %ebp
+  800811:	68 1a 08 80 00       	push   $0x80081a
+  800816:	89 e5                	mov    %esp,%ebp
+  800818:	0f 34                	sysenter
+  80081a:	83 c4 04             	add    $0x4,%esp
+  80081d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80081e:	85 c0                	test   %eax,%eax
+  800820:	7f 6c                	jg     80088e <sys_page_copy+0xad>
+}
+  800822:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800825:	5b                   	pop    %ebx
+  800826:	5e                   	pop    %esi
+  800827:	5f                   	pop    %edi
+  800828:	5d                   	pop    %ebp
+  800829:	c3                   	ret
+  80082a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80082f:	0f a2                	cpuid
+		return 0;
+  800831:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800836:	f6 c6 08             	test   $0x8,%dh
+  800839:	74 15                	je     800850 <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80083b:	89 c2                	mov    %eax,%edx
+  80083d:	c1 ea 08             	shr    $0x8,%edx
+  800840:	83 e2 0f             	and    $0xf,%edx
+  800843:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800848:	83 fa 06             	cmp    $0x6,%edx
+  80084b:	74 0e                	je     80085b <sys_page_copy+0x7a>
+  80084d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800850:	0f b6 c9             	movzbl %cl,%ecx
+  800853:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800859:	eb 98                	jmp    8007f3 <sys_page_copy+0x12>
+  80085b:	89 c2                	mov    %eax,%edx
+  80085d:	c1 ea 04             	shr    $0x4,%edx
+  800860:	83 e2 0f             	and    $0xf,%edx
+  800863:	83 fa 02             	cmp    $0x2,%edx
+  800866:	77 e5                	ja     80084d <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  800868:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80086b:	83 f8 02             	cmp    $0x2,%eax
+  80086e:	0f 97 c1             	seta   %cl
+  800871:	0f b6 c9             	movzbl %cl,%ecx
+  800874:	eb d7                	jmp    80084d <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  800876:	b8 29 00 00 00       	mov    $0x29,%eax
+  80087b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80087e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800881:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800884:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800887:	8b 75 18             	mov    0x18(%ebp),%esi
+  80088a:	cd 30                	int    $0x30
+  80088c:	eb 90                	jmp    80081e <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80088e:	83 ec 0c             	sub    $0xc,%esp
+  800891:	50                   	push   %eax
+  800892:	6a 29                	push   $0x29
+  800894:	68 ca 27 80 00       	push   $0x8027ca
+  800899:	6a 4a                	push   $0x4a
+  80089b:	68 e7 27 80 00       	push   $0x8027e7
+  8008a0:	e8 6d 13 00 00       	call   801c12 <_panic>
+
+008008a5 <sys_yield>:
+{
+  8008a5:	55                   	push   %ebp
+  8008a6:	89 e5                	mov    %esp,%ebp
+  8008a8:	57                   	push   %edi
+  8008a9:	56                   	push   %esi
+  8008aa:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8008ab:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8008b2:	78 2e                	js     8008e2 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  8008b4:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8008bb:	74 71                	je     80092e <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  8008bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008c2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8008c7:	89 d1                	mov    %edx,%ecx
+  8008c9:	89 d3                	mov    %edx,%ebx
+  8008cb:	89 d7                	mov    %edx,%edi
+  8008cd:	89 d6                	mov    %edx,%esi
+  8008cf:	55                   	push   %ebp
+  8008d0:	68 d9 08 80 00       	push   $0x8008d9
+  8008d5:	89 e5                	mov    %esp,%ebp
+  8008d7:	0f 34                	sysenter
+  8008d9:	83 c4 04             	add    $0x4,%esp
+  8008dc:	5d                   	pop    %ebp
+}
+  8008dd:	5b                   	pop    %ebx
+  8008de:	5e                   	pop    %esi
+  8008df:	5f                   	pop    %edi
+  8008e0:	5d                   	pop    %ebp
+  8008e1:	c3                   	ret
+  8008e2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8008e7:	0f a2                	cpuid
+		return 0;
+  8008e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8008ee:	f6 c6 08             	test   $0x8,%dh
+  8008f1:	74 15                	je     800908 <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8008f3:	89 c2                	mov    %eax,%edx
+  8008f5:	c1 ea 08             	shr    $0x8,%edx
+  8008f8:	83 e2 0f             	and    $0xf,%edx
+  8008fb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800900:	83 fa 06             	cmp    $0x6,%edx
+  800903:	74 0e                	je     800913 <sys_yield+0x6e>
+  800905:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800908:	0f b6 c9             	movzbl %cl,%ecx
+  80090b:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800911:	eb a1                	jmp    8008b4 <sys_yield+0xf>
+  800913:	89 c2                	mov    %eax,%edx
+  800915:	c1 ea 04             	shr    $0x4,%edx
+  800918:	83 e2 0f             	and    $0xf,%edx
+  80091b:	83 fa 02             	cmp    $0x2,%edx
+  80091e:	77 e5                	ja     800905 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  800920:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800923:	83 f8 02             	cmp    $0x2,%eax
+  800926:	0f 97 c1             	seta   %cl
+  800929:	0f b6 c9             	movzbl %cl,%ecx
+  80092c:	eb d7                	jmp    800905 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  80092e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800933:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800938:	89 d1                	mov    %edx,%ecx
+  80093a:	89 d3                	mov    %edx,%ebx
+  80093c:	89 d7                	mov    %edx,%edi
+  80093e:	89 d6                	mov    %edx,%esi
+  800940:	cd 30                	int    $0x30
+}
+  800942:	eb 99                	jmp    8008dd <sys_yield+0x38>
+
+00800944 <sys_env_set_status>:
+{
+  800944:	55                   	push   %ebp
+  800945:	89 e5                	mov    %esp,%ebp
+  800947:	57                   	push   %edi
+  800948:	56                   	push   %esi
+  800949:	53                   	push   %ebx
+  80094a:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80094d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800954:	78 37                	js     80098d <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  800956:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80095d:	74 7a                	je     8009d9 <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  80095f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800964:	8b 55 08             	mov    0x8(%ebp),%edx
+  800967:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80096a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80096f:	89 df                	mov    %ebx,%edi
+  800971:	89 de                	mov    %ebx,%esi
+  800973:	55                   	push   %ebp
+  800974:	68 7d 09 80 00       	push   $0x80097d
+  800979:	89 e5                	mov    %esp,%ebp
+  80097b:	0f 34                	sysenter
+  80097d:	83 c4 04             	add    $0x4,%esp
+  800980:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800981:	85 c0                	test   %eax,%eax
+  800983:	7f 6c                	jg     8009f1 <sys_env_set_status+0xad>
+}
+  800985:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800988:	5b                   	pop    %ebx
+  800989:	5e                   	pop    %esi
+  80098a:	5f                   	pop    %edi
+  80098b:	5d                   	pop    %ebp
+  80098c:	c3                   	ret
+  80098d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800992:	0f a2                	cpuid
+		return 0;
+  800994:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800999:	f6 c6 08             	test   $0x8,%dh
+  80099c:	74 15                	je     8009b3 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80099e:	89 c2                	mov    %eax,%edx
+  8009a0:	c1 ea 08             	shr    $0x8,%edx
+  8009a3:	83 e2 0f             	and    $0xf,%edx
+  8009a6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8009ab:	83 fa 06             	cmp    $0x6,%edx
+  8009ae:	74 0e                	je     8009be <sys_env_set_status+0x7a>
+  8009b0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8009b3:	0f b6 c9             	movzbl %cl,%ecx
+  8009b6:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8009bc:	eb 98                	jmp    800956 <sys_env_set_status+0x12>
+  8009be:	89 c2                	mov    %eax,%edx
+  8009c0:	c1 ea 04             	shr    $0x4,%edx
+  8009c3:	83 e2 0f             	and    $0xf,%edx
+  8009c6:	83 fa 02             	cmp    $0x2,%edx
+  8009c9:	77 e5                	ja     8009b0 <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  8009cb:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8009ce:	83 f8 02             	cmp    $0x2,%eax
+  8009d1:	0f 97 c1             	seta   %cl
+  8009d4:	0f b6 c9             	movzbl %cl,%ecx
+  8009d7:	eb d7                	jmp    8009b0 <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  8009d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009de:	b8 08 00 00 00       	mov    $0x8,%eax
+  8009e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009e9:	89 df                	mov    %ebx,%edi
+  8009eb:	89 de                	mov    %ebx,%esi
+  8009ed:	cd 30                	int    $0x30
+  8009ef:	eb 90                	jmp    800981 <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8009f1:	83 ec 0c             	sub    $0xc,%esp
+  8009f4:	50                   	push   %eax
+  8009f5:	6a 08                	push   $0x8
+  8009f7:	68 ca 27 80 00       	push   $0x8027ca
+  8009fc:	6a 4a                	push   $0x4a
+  8009fe:	68 e7 27 80 00       	push   $0x8027e7
+  800a03:	e8 0a 12 00 00       	call   801c12 <_panic>
+
+00800a08 <sys_sysinfo>:
+{
+  800a08:	55                   	push   %ebp
+  800a09:	89 e5                	mov    %esp,%ebp
+  800a0b:	57                   	push   %edi
+  800a0c:	56                   	push   %esi
+  800a0d:	53                   	push   %ebx
+  800a0e:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800a11:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800a18:	78 36                	js     800a50 <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  800a1a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800a21:	74 79                	je     800a9c <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  800a23:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a26:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a2b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800a30:	89 cb                	mov    %ecx,%ebx
+  800a32:	89 cf                	mov    %ecx,%edi
+  800a34:	89 ce                	mov    %ecx,%esi
+  800a36:	55                   	push   %ebp
+  800a37:	68 40 0a 80 00       	push   $0x800a40
+  800a3c:	89 e5                	mov    %esp,%ebp
+  800a3e:	0f 34                	sysenter
+  800a40:	83 c4 04             	add    $0x4,%esp
+  800a43:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800a44:	85 c0                	test   %eax,%eax
+  800a46:	7f 6b                	jg     800ab3 <sys_sysinfo+0xab>
+}
+  800a48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a4b:	5b                   	pop    %ebx
+  800a4c:	5e                   	pop    %esi
+  800a4d:	5f                   	pop    %edi
+  800a4e:	5d                   	pop    %ebp
+  800a4f:	c3                   	ret
+  800a50:	b8 01 00 00 00       	mov    $0x1,%eax
+  800a55:	0f a2                	cpuid
+		return 0;
+  800a57:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800a5c:	f6 c6 08             	test   $0x8,%dh
+  800a5f:	74 15                	je     800a76 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800a61:	89 c2                	mov    %eax,%edx
+  800a63:	c1 ea 08             	shr    $0x8,%edx
+  800a66:	83 e2 0f             	and    $0xf,%edx
+  800a69:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800a6e:	83 fa 06             	cmp    $0x6,%edx
+  800a71:	74 0e                	je     800a81 <sys_sysinfo+0x79>
+  800a73:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800a76:	0f b6 c9             	movzbl %cl,%ecx
+  800a79:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800a7f:	eb 99                	jmp    800a1a <sys_sysinfo+0x12>
+  800a81:	89 c2                	mov    %eax,%edx
+  800a83:	c1 ea 04             	shr    $0x4,%edx
+  800a86:	83 e2 0f             	and    $0xf,%edx
+  800a89:	83 fa 02             	cmp    $0x2,%edx
+  800a8c:	77 e5                	ja     800a73 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  800a8e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800a91:	83 f8 02             	cmp    $0x2,%eax
+  800a94:	0f 97 c1             	seta   %cl
+  800a97:	0f b6 c9             	movzbl %cl,%ecx
+  800a9a:	eb d7                	jmp    800a73 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  800a9c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aa1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800aa6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aa9:	89 cb                	mov    %ecx,%ebx
+  800aab:	89 cf                	mov    %ecx,%edi
+  800aad:	89 ce                	mov    %ecx,%esi
+  800aaf:	cd 30                	int    $0x30
+  800ab1:	eb 91                	jmp    800a44 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ab3:	83 ec 0c             	sub    $0xc,%esp
+  800ab6:	50                   	push   %eax
+  800ab7:	6a 0b                	push   $0xb
+  800ab9:	68 ca 27 80 00       	push   $0x8027ca
+  800abe:	6a 4a                	push   $0x4a
+  800ac0:	68 e7 27 80 00       	push   $0x8027e7
+  800ac5:	e8 48 11 00 00       	call   801c12 <_panic>
+
+00800aca <sys_env_set_trapframe>:
+{
+  800aca:	55                   	push   %ebp
+  800acb:	89 e5                	mov    %esp,%ebp
+  800acd:	57                   	push   %edi
+  800ace:	56                   	push   %esi
+  800acf:	53                   	push   %ebx
+  800ad0:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800ad3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ada:	78 37                	js     800b13 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  800adc:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ae3:	74 7a                	je     800b5f <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  800ae5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800aea:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800af0:	b8 13 00 00 00       	mov    $0x13,%eax
+  800af5:	89 df                	mov    %ebx,%edi
+  800af7:	89 de                	mov    %ebx,%esi
+  800af9:	55                   	push   %ebp
+  800afa:	68 03 0b 80 00       	push   $0x800b03
+  800aff:	89 e5                	mov    %esp,%ebp
+  800b01:	0f 34                	sysenter
+  800b03:	83 c4 04             	add    $0x4,%esp
+  800b06:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800b07:	85 c0                	test   %eax,%eax
+  800b09:	7f 6c                	jg     800b77 <sys_env_set_trapframe+0xad>
+}
+  800b0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b0e:	5b                   	pop    %ebx
+  800b0f:	5e                   	pop    %esi
+  800b10:	5f                   	pop    %edi
+  800b11:	5d                   	pop    %ebp
+  800b12:	c3                   	ret
+  800b13:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b18:	0f a2                	cpuid
+		return 0;
+  800b1a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800b1f:	f6 c6 08             	test   $0x8,%dh
+  800b22:	74 15                	je     800b39 <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800b24:	89 c2                	mov    %eax,%edx
+  800b26:	c1 ea 08             	shr    $0x8,%edx
+  800b29:	83 e2 0f             	and    $0xf,%edx
+  800b2c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800b31:	83 fa 06             	cmp    $0x6,%edx
+  800b34:	74 0e                	je     800b44 <sys_env_set_trapframe+0x7a>
+  800b36:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800b39:	0f b6 c9             	movzbl %cl,%ecx
+  800b3c:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800b42:	eb 98                	jmp    800adc <sys_env_set_trapframe+0x12>
+  800b44:	89 c2                	mov    %eax,%edx
+  800b46:	c1 ea 04             	shr    $0x4,%edx
+  800b49:	83 e2 0f             	and    $0xf,%edx
+  800b4c:	83 fa 02             	cmp    $0x2,%edx
+  800b4f:	77 e5                	ja     800b36 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  800b51:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800b54:	83 f8 02             	cmp    $0x2,%eax
+  800b57:	0f 97 c1             	seta   %cl
+  800b5a:	0f b6 c9             	movzbl %cl,%ecx
+  800b5d:	eb d7                	jmp    800b36 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  800b5f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b64:	b8 13 00 00 00       	mov    $0x13,%eax
+  800b69:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b6c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b6f:	89 df                	mov    %ebx,%edi
+  800b71:	89 de                	mov    %ebx,%esi
+  800b73:	cd 30                	int    $0x30
+  800b75:	eb 90                	jmp    800b07 <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b77:	83 ec 0c             	sub    $0xc,%esp
+  800b7a:	50                   	push   %eax
+  800b7b:	6a 13                	push   $0x13
+  800b7d:	68 ca 27 80 00       	push   $0x8027ca
+  800b82:	6a 4a                	push   $0x4a
+  800b84:	68 e7 27 80 00       	push   $0x8027e7
+  800b89:	e8 84 10 00 00       	call   801c12 <_panic>
+
+00800b8e <sys_env_set_stack_limit>:
+{
+  800b8e:	55                   	push   %ebp
+  800b8f:	89 e5                	mov    %esp,%ebp
+  800b91:	57                   	push   %edi
+  800b92:	56                   	push   %esi
+  800b93:	53                   	push   %ebx
+  800b94:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800b97:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b9e:	78 37                	js     800bd7 <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  800ba0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ba7:	74 7a                	je     800c23 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  800ba9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bae:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bb1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bb4:	b8 19 00 00 00       	mov    $0x19,%eax
+  800bb9:	89 df                	mov    %ebx,%edi
+  800bbb:	89 de                	mov    %ebx,%esi
+  800bbd:	55                   	push   %ebp
+  800bbe:	68 c7 0b 80 00       	push   $0x800bc7
+  800bc3:	89 e5                	mov    %esp,%ebp
+  800bc5:	0f 34                	sysenter
+  800bc7:	83 c4 04             	add    $0x4,%esp
+  800bca:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800bcb:	85 c0                	test   %eax,%eax
+  800bcd:	7f 6c                	jg     800c3b <sys_env_set_stack_limit+0xad>
+}
+  800bcf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bd2:	5b                   	pop    %ebx
+  800bd3:	5e                   	pop    %esi
+  800bd4:	5f                   	pop    %edi
+  800bd5:	5d                   	pop    %ebp
+  800bd6:	c3                   	ret
+  800bd7:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bdc:	0f a2                	cpuid
+		return 0;
+  800bde:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800be3:	f6 c6 08             	test   $0x8,%dh
+  800be6:	74 15                	je     800bfd <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800be8:	89 c2                	mov    %eax,%edx
+  800bea:	c1 ea 08             	shr    $0x8,%edx
+  800bed:	83 e2 0f             	and    $0xf,%edx
+  800bf0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800bf5:	83 fa 06             	cmp    $0x6,%edx
+  800bf8:	74 0e                	je     800c08 <sys_env_set_stack_limit+0x7a>
+  800bfa:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800bfd:	0f b6 c9             	movzbl %cl,%ecx
+  800c00:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800c06:	eb 98                	jmp    800ba0 <sys_env_set_stack_limit+0x12>
+  800c08:	89 c2                	mov    %eax,%edx
+  800c0a:	c1 ea 04             	shr    $0x4,%edx
+  800c0d:	83 e2 0f             	and    $0xf,%edx
+  800c10:	83 fa 02             	cmp    $0x2,%edx
+  800c13:	77 e5                	ja     800bfa <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  800c15:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c18:	83 f8 02             	cmp    $0x2,%eax
+  800c1b:	0f 97 c1             	seta   %cl
+  800c1e:	0f b6 c9             	movzbl %cl,%ecx
+  800c21:	eb d7                	jmp    800bfa <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  800c23:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c28:	b8 19 00 00 00       	mov    $0x19,%eax
+  800c2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c33:	89 df                	mov    %ebx,%edi
+  800c35:	89 de                	mov    %ebx,%esi
+  800c37:	cd 30                	int    $0x30
+  800c39:	eb 90                	jmp    800bcb <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c3b:	83 ec 0c             	sub    $0xc,%esp
+  800c3e:	50                   	push   %eax
+  800c3f:	6a 19                	push   $0x19
+  800c41:	68 ca 27 80 00       	push   $0x8027ca
+  800c46:	6a 4a                	push   $0x4a
+  800c48:	68 e7 27 80 00       	push   $0x8027e7
+  800c4d:	e8 c0 0f 00 00       	call   801c12 <_panic>
+
+00800c52 <sys_env_set_pgfault_upcall>:
+{
+  800c52:	55                   	push   %ebp
+  800c53:	89 e5                	mov    %esp,%ebp
+  800c55:	57                   	push   %edi
+  800c56:	56                   	push   %esi
+  800c57:	53                   	push   %ebx
+  800c58:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800c5b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800c62:	78 37                	js     800c9b <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  800c64:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800c6b:	74 7a                	je     800ce7 <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  800c6d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c72:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c75:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c78:	b8 09 00 00 00       	mov    $0x9,%eax
+  800c7d:	89 df                	mov    %ebx,%edi
+  800c7f:	89 de                	mov    %ebx,%esi
+  800c81:	55                   	push   %ebp
+  800c82:	68 8b 0c 80 00       	push   $0x800c8b
+  800c87:	89 e5                	mov    %esp,%ebp
+  800c89:	0f 34                	sysenter
+  800c8b:	83 c4 04             	add    $0x4,%esp
+  800c8e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c8f:	85 c0                	test   %eax,%eax
+  800c91:	7f 6c                	jg     800cff <sys_env_set_pgfault_upcall+0xad>
+}
+  800c93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c96:	5b                   	pop    %ebx
+  800c97:	5e                   	pop    %esi
+  800c98:	5f                   	pop    %edi
+  800c99:	5d                   	pop    %ebp
+  800c9a:	c3                   	ret
+  800c9b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ca0:	0f a2                	cpuid
+		return 0;
+  800ca2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800ca7:	f6 c6 08             	test   $0x8,%dh
+  800caa:	74 15                	je     800cc1 <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800cac:	89 c2                	mov    %eax,%edx
+  800cae:	c1 ea 08             	shr    $0x8,%edx
+  800cb1:	83 e2 0f             	and    $0xf,%edx
+  800cb4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800cb9:	83 fa 06             	cmp    $0x6,%edx
+  800cbc:	74 0e                	je     800ccc <sys_env_set_pgfault_upcall+0x7a>
+  800cbe:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800cc1:	0f b6 c9             	movzbl %cl,%ecx
+  800cc4:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800cca:	eb 98                	jmp    800c64 <sys_env_set_pgfault_upcall+0x12>
+  800ccc:	89 c2                	mov    %eax,%edx
+  800cce:	c1 ea 04             	shr    $0x4,%edx
+  800cd1:	83 e2 0f             	and    $0xf,%edx
+  800cd4:	83 fa 02             	cmp    $0x2,%edx
+  800cd7:	77 e5                	ja     800cbe <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  800cd9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800cdc:	83 f8 02             	cmp    $0x2,%eax
+  800cdf:	0f 97 c1             	seta   %cl
+  800ce2:	0f b6 c9             	movzbl %cl,%ecx
+  800ce5:	eb d7                	jmp    800cbe <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  800ce7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cec:	b8 09 00 00 00       	mov    $0x9,%eax
+  800cf1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf7:	89 df                	mov    %ebx,%edi
+  800cf9:	89 de                	mov    %ebx,%esi
+  800cfb:	cd 30                	int    $0x30
+  800cfd:	eb 90                	jmp    800c8f <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cff:	83 ec 0c             	sub    $0xc,%esp
+  800d02:	50                   	push   %eax
+  800d03:	6a 09                	push   $0x9
+  800d05:	68 ca 27 80 00       	push   $0x8027ca
+  800d0a:	6a 4a                	push   $0x4a
+  800d0c:	68 e7 27 80 00       	push   $0x8027e7
+  800d11:	e8 fc 0e 00 00       	call   801c12 <_panic>
+
+00800d16 <sys_ipc_try_send>:
+{
+  800d16:	55                   	push   %ebp
+  800d17:	89 e5                	mov    %esp,%ebp
+  800d19:	57                   	push   %edi
+  800d1a:	56                   	push   %esi
+  800d1b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800d1c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d23:	78 32                	js     800d57 <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  800d25:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d2c:	74 75                	je     800da3 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  800d2e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d34:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d39:	be 00 00 00 00       	mov    $0x0,%esi
+  800d3e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d41:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d44:	55                   	push   %ebp
+  800d45:	68 4e 0d 80 00       	push   $0x800d4e
+  800d4a:	89 e5                	mov    %esp,%ebp
+  800d4c:	0f 34                	sysenter
+  800d4e:	83 c4 04             	add    $0x4,%esp
+  800d51:	5d                   	pop    %ebp
+}
+  800d52:	5b                   	pop    %ebx
+  800d53:	5e                   	pop    %esi
+  800d54:	5f                   	pop    %edi
+  800d55:	5d                   	pop    %ebp
+  800d56:	c3                   	ret
+  800d57:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d5c:	0f a2                	cpuid
+		return 0;
+  800d5e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800d63:	f6 c6 08             	test   $0x8,%dh
+  800d66:	74 15                	je     800d7d <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d68:	89 c2                	mov    %eax,%edx
+  800d6a:	c1 ea 08             	shr    $0x8,%edx
+  800d6d:	83 e2 0f             	and    $0xf,%edx
+  800d70:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d75:	83 fa 06             	cmp    $0x6,%edx
+  800d78:	74 0e                	je     800d88 <sys_ipc_try_send+0x72>
+  800d7a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800d7d:	0f b6 c9             	movzbl %cl,%ecx
+  800d80:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800d86:	eb 9d                	jmp    800d25 <sys_ipc_try_send+0xf>
+  800d88:	89 c2                	mov    %eax,%edx
+  800d8a:	c1 ea 04             	shr    $0x4,%edx
+  800d8d:	83 e2 0f             	and    $0xf,%edx
+  800d90:	83 fa 02             	cmp    $0x2,%edx
+  800d93:	77 e5                	ja     800d7a <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  800d95:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d98:	83 f8 02             	cmp    $0x2,%eax
+  800d9b:	0f 97 c1             	seta   %cl
+  800d9e:	0f b6 c9             	movzbl %cl,%ecx
+  800da1:	eb d7                	jmp    800d7a <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  800da3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800da8:	be 00 00 00 00       	mov    $0x0,%esi
+  800dad:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800db6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800db9:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  800dbb:	eb 95                	jmp    800d52 <sys_ipc_try_send+0x3c>
+
+00800dbd <sys_ipc_send>:
+{
+  800dbd:	55                   	push   %ebp
+  800dbe:	89 e5                	mov    %esp,%ebp
+  800dc0:	57                   	push   %edi
+  800dc1:	56                   	push   %esi
+  800dc2:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800dc3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800dca:	78 32                	js     800dfe <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  800dcc:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800dd3:	74 75                	je     800e4a <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  800dd5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ddb:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800de0:	be 00 00 00 00       	mov    $0x0,%esi
+  800de5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800de8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800deb:	55                   	push   %ebp
+  800dec:	68 f5 0d 80 00       	push   $0x800df5
+  800df1:	89 e5                	mov    %esp,%ebp
+  800df3:	0f 34                	sysenter
+  800df5:	83 c4 04             	add    $0x4,%esp
+  800df8:	5d                   	pop    %ebp
+}
+  800df9:	5b                   	pop    %ebx
+  800dfa:	5e                   	pop    %esi
+  800dfb:	5f                   	pop    %edi
+  800dfc:	5d                   	pop    %ebp
+  800dfd:	c3                   	ret
+  800dfe:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e03:	0f a2                	cpuid
+		return 0;
+  800e05:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800e0a:	f6 c6 08             	test   $0x8,%dh
+  800e0d:	74 15                	je     800e24 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e0f:	89 c2                	mov    %eax,%edx
+  800e11:	c1 ea 08             	shr    $0x8,%edx
+  800e14:	83 e2 0f             	and    $0xf,%edx
+  800e17:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e1c:	83 fa 06             	cmp    $0x6,%edx
+  800e1f:	74 0e                	je     800e2f <sys_ipc_send+0x72>
+  800e21:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e24:	0f b6 c9             	movzbl %cl,%ecx
+  800e27:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800e2d:	eb 9d                	jmp    800dcc <sys_ipc_send+0xf>
+  800e2f:	89 c2                	mov    %eax,%edx
+  800e31:	c1 ea 04             	shr    $0x4,%edx
+  800e34:	83 e2 0f             	and    $0xf,%edx
+  800e37:	83 fa 02             	cmp    $0x2,%edx
+  800e3a:	77 e5                	ja     800e21 <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  800e3c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e3f:	83 f8 02             	cmp    $0x2,%eax
+  800e42:	0f 97 c1             	seta   %cl
+  800e45:	0f b6 c9             	movzbl %cl,%ecx
+  800e48:	eb d7                	jmp    800e21 <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  800e4a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800e4f:	be 00 00 00 00       	mov    $0x0,%esi
+  800e54:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e57:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e5a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e5d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e60:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  800e62:	eb 95                	jmp    800df9 <sys_ipc_send+0x3c>
+
+00800e64 <sys_ipc_recv>:
+{
+  800e64:	55                   	push   %ebp
+  800e65:	89 e5                	mov    %esp,%ebp
+  800e67:	57                   	push   %edi
+  800e68:	56                   	push   %esi
+  800e69:	53                   	push   %ebx
+  800e6a:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800e6d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e74:	78 36                	js     800eac <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  800e76:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e7d:	74 79                	je     800ef8 <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  800e7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e82:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e87:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e8c:	89 cb                	mov    %ecx,%ebx
+  800e8e:	89 cf                	mov    %ecx,%edi
+  800e90:	89 ce                	mov    %ecx,%esi
+  800e92:	55                   	push   %ebp
+  800e93:	68 9c 0e 80 00       	push   $0x800e9c
+  800e98:	89 e5                	mov    %esp,%ebp
+  800e9a:	0f 34                	sysenter
+  800e9c:	83 c4 04             	add    $0x4,%esp
+  800e9f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ea0:	85 c0                	test   %eax,%eax
+  800ea2:	7f 6b                	jg     800f0f <sys_ipc_recv+0xab>
+}
+  800ea4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea7:	5b                   	pop    %ebx
+  800ea8:	5e                   	pop    %esi
+  800ea9:	5f                   	pop    %edi
+  800eaa:	5d                   	pop    %ebp
+  800eab:	c3                   	ret
+  800eac:	b8 01 00 00 00       	mov    $0x1,%eax
+  800eb1:	0f a2                	cpuid
+		return 0;
+  800eb3:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800eb8:	f6 c6 08             	test   $0x8,%dh
+  800ebb:	74 15                	je     800ed2 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ebd:	89 c2                	mov    %eax,%edx
+  800ebf:	c1 ea 08             	shr    $0x8,%edx
+  800ec2:	83 e2 0f             	and    $0xf,%edx
+  800ec5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800eca:	83 fa 06             	cmp    $0x6,%edx
+  800ecd:	74 0e                	je     800edd <sys_ipc_recv+0x79>
+  800ecf:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800ed2:	0f b6 c9             	movzbl %cl,%ecx
+  800ed5:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800edb:	eb 99                	jmp    800e76 <sys_ipc_recv+0x12>
+  800edd:	89 c2                	mov    %eax,%edx
+  800edf:	c1 ea 04             	shr    $0x4,%edx
+  800ee2:	83 e2 0f             	and    $0xf,%edx
+  800ee5:	83 fa 02             	cmp    $0x2,%edx
+  800ee8:	77 e5                	ja     800ecf <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  800eea:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800eed:	83 f8 02             	cmp    $0x2,%eax
+  800ef0:	0f 97 c1             	seta   %cl
+  800ef3:	0f b6 c9             	movzbl %cl,%ecx
+  800ef6:	eb d7                	jmp    800ecf <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  800ef8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800efd:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f02:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f05:	89 cb                	mov    %ecx,%ebx
+  800f07:	89 cf                	mov    %ecx,%edi
+  800f09:	89 ce                	mov    %ecx,%esi
+  800f0b:	cd 30                	int    $0x30
+  800f0d:	eb 91                	jmp    800ea0 <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f0f:	83 ec 0c             	sub    $0xc,%esp
+  800f12:	50                   	push   %eax
+  800f13:	6a 0d                	push   $0xd
+  800f15:	68 ca 27 80 00       	push   $0x8027ca
+  800f1a:	6a 4a                	push   $0x4a
+  800f1c:	68 e7 27 80 00       	push   $0x8027e7
+  800f21:	e8 ec 0c 00 00       	call   801c12 <_panic>
+
+00800f26 <sys_ipc_send_range>:
+{
+  800f26:	55                   	push   %ebp
+  800f27:	89 e5                	mov    %esp,%ebp
+  800f29:	57                   	push   %edi
+  800f2a:	56                   	push   %esi
+  800f2b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800f2c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f33:	78 30                	js     800f65 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  800f35:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f3c:	74 73                	je     800fb1 <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  800f3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f41:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f44:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  800f49:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f4c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f4f:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f52:	55                   	push   %ebp
+  800f53:	68 5c 0f 80 00       	push   $0x800f5c
+  800f58:	89 e5                	mov    %esp,%ebp
+  800f5a:	0f 34                	sysenter
+  800f5c:	83 c4 04             	add    $0x4,%esp
+  800f5f:	5d                   	pop    %ebp
+}
+  800f60:	5b                   	pop    %ebx
+  800f61:	5e                   	pop    %esi
+  800f62:	5f                   	pop    %edi
+  800f63:	5d                   	pop    %ebp
+  800f64:	c3                   	ret
+  800f65:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f6a:	0f a2                	cpuid
+		return 0;
+  800f6c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f71:	f6 c6 08             	test   $0x8,%dh
+  800f74:	74 15                	je     800f8b <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f76:	89 c2                	mov    %eax,%edx
+  800f78:	c1 ea 08             	shr    $0x8,%edx
+  800f7b:	83 e2 0f             	and    $0xf,%edx
+  800f7e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f83:	83 fa 06             	cmp    $0x6,%edx
+  800f86:	74 0e                	je     800f96 <sys_ipc_send_range+0x70>
+  800f88:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f8b:	0f b6 c9             	movzbl %cl,%ecx
+  800f8e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800f94:	eb 9f                	jmp    800f35 <sys_ipc_send_range+0xf>
+  800f96:	89 c2                	mov    %eax,%edx
+  800f98:	c1 ea 04             	shr    $0x4,%edx
+  800f9b:	83 e2 0f             	and    $0xf,%edx
+  800f9e:	83 fa 02             	cmp    $0x2,%edx
+  800fa1:	77 e5                	ja     800f88 <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  800fa3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800fa6:	83 f8 02             	cmp    $0x2,%eax
+  800fa9:	0f 97 c1             	seta   %cl
+  800fac:	0f b6 c9             	movzbl %cl,%ecx
+  800faf:	eb d7                	jmp    800f88 <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  800fb1:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  800fb6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fbf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fc2:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fc5:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  800fc7:	eb 97                	jmp    800f60 <sys_ipc_send_range+0x3a>
+
+00800fc9 <sys_ipc_recv_range>:
+{
+  800fc9:	55                   	push   %ebp
+  800fca:	89 e5                	mov    %esp,%ebp
+  800fcc:	57                   	push   %edi
+  800fcd:	56                   	push   %esi
+  800fce:	53                   	push   %ebx
+  800fcf:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800fd2:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fd9:	78 37                	js     801012 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  800fdb:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fe2:	74 7a                	je     80105e <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  800fe4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fef:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800ff4:	89 df                	mov    %ebx,%edi
+  800ff6:	89 de                	mov    %ebx,%esi
+  800ff8:	55                   	push   %ebp
+  800ff9:	68 02 10 80 00       	push   $0x801002
+  800ffe:	89 e5                	mov    %esp,%ebp
+  801000:	0f 34                	sysenter
+  801002:	83 c4 04             	add    $0x4,%esp
+  801005:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801006:	85 c0                	test   %eax,%eax
+  801008:	7f 6c                	jg     801076 <sys_ipc_recv_range+0xad>
+}
+  80100a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80100d:	5b                   	pop    %ebx
+  80100e:	5e                   	pop    %esi
+  80100f:	5f                   	pop    %edi
+  801010:	5d                   	pop    %ebp
+  801011:	c3                   	ret
+  801012:	b8 01 00 00 00       	mov    $0x1,%eax
+  801017:	0f a2                	cpuid
+		return 0;
+  801019:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80101e:	f6 c6 08             	test   $0x8,%dh
+  801021:	74 15                	je     801038 <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801023:	89 c2                	mov    %eax,%edx
+  801025:	c1 ea 08             	shr    $0x8,%edx
+  801028:	83 e2 0f             	and    $0xf,%edx
+  80102b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801030:	83 fa 06             	cmp    $0x6,%edx
+  801033:	74 0e                	je     801043 <sys_ipc_recv_range+0x7a>
+  801035:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801038:	0f b6 c9             	movzbl %cl,%ecx
+  80103b:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801041:	eb 98                	jmp    800fdb <sys_ipc_recv_range+0x12>
+  801043:	89 c2                	mov    %eax,%edx
+  801045:	c1 ea 04             	shr    $0x4,%edx
+  801048:	83 e2 0f             	and    $0xf,%edx
+  80104b:	83 fa 02             	cmp    $0x2,%edx
+  80104e:	77 e5                	ja     801035 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801050:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801053:	83 f8 02             	cmp    $0x2,%eax
+  801056:	0f 97 c1             	seta   %cl
+  801059:	0f b6 c9             	movzbl %cl,%ecx
+  80105c:	eb d7                	jmp    801035 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  80105e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801063:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801068:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80106e:	89 df                	mov    %ebx,%edi
+  801070:	89 de                	mov    %ebx,%esi
+  801072:	cd 30                	int    $0x30
+  801074:	eb 90                	jmp    801006 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801076:	83 ec 0c             	sub    $0xc,%esp
+  801079:	50                   	push   %eax
+  80107a:	6a 1f                	push   $0x1f
+  80107c:	68 ca 27 80 00       	push   $0x8027ca
+  801081:	6a 4a                	push   $0x4a
+  801083:	68 e7 27 80 00       	push   $0x8027e7
+  801088:	e8 85 0b 00 00       	call   801c12 <_panic>
+
+0080108d <sys_ipc_call>:
+{
+  80108d:	55                   	push   %ebp
+  80108e:	89 e5                	mov    %esp,%ebp
+  801090:	57                   	push   %edi
+  801091:	56                   	push   %esi
+  801092:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801093:	8b 55 08             	mov    0x8(%ebp),%edx
+  801096:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80109b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80109e:	55                   	push   %ebp
+  80109f:	56                   	push   %esi
+  8010a0:	8b 0e                	mov    (%esi),%ecx
+  8010a2:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8010a5:	8b 7e 08             	mov    0x8(%esi),%edi
+  8010a8:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8010ab:	8b 76 0c             	mov    0xc(%esi),%esi
+  8010ae:	cd 30                	int    $0x30
+  8010b0:	87 34 24             	xchg   %esi,(%esp)
+  8010b3:	89 0e                	mov    %ecx,(%esi)
+  8010b5:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8010b8:	89 7e 08             	mov    %edi,0x8(%esi)
+  8010bb:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8010be:	8f 46 0c             	pop    0xc(%esi)
+  8010c1:	5d                   	pop    %ebp
+}
+  8010c2:	5b                   	pop    %ebx
+  8010c3:	5e                   	pop    %esi
+  8010c4:	5f                   	pop    %edi
+  8010c5:	5d                   	pop    %ebp
+  8010c6:	c3                   	ret
+
+008010c7 <sys_ipc_reply_wait>:
+{
+  8010c7:	55                   	push   %ebp
+  8010c8:	89 e5                	mov    %esp,%ebp
+  8010ca:	57                   	push   %edi
+  8010cb:	56                   	push   %esi
+  8010cc:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8010d5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8010d8:	55                   	push   %ebp
+  8010d9:	56                   	push   %esi
+  8010da:	8b 0e                	mov    (%esi),%ecx
+  8010dc:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8010df:	8b 7e 08             	mov    0x8(%esi),%edi
+  8010e2:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8010e5:	8b 76 0c             	mov    0xc(%esi),%esi
+  8010e8:	cd 30                	int    $0x30
+  8010ea:	87 34 24             	xchg   %esi,(%esp)
+  8010ed:	89 0e                	mov    %ecx,(%esi)
+  8010ef:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8010f2:	89 7e 08             	mov    %edi,0x8(%esi)
+  8010f5:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8010f8:	8f 46 0c             	pop    0xc(%esi)
+  8010fb:	5d                   	pop    %ebp
+}
+  8010fc:	5b                   	pop    %ebx
+  8010fd:	5e                   	pop    %esi
+  8010fe:	5f                   	pop    %edi
+  8010ff:	5d                   	pop    %ebp
+  801100:	c3                   	ret
+
+00801101 <sys_ipc_send_msg>:
+{
+  801101:	55                   	push   %ebp
+  801102:	89 e5                	mov    %esp,%ebp
+  801104:	57                   	push   %edi
+  801105:	56                   	push   %esi
+  801106:	53                   	push   %ebx
+  801107:	83 ec 20             	sub    $0x20,%esp
+  80110a:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  80110d:	8b 10                	mov    (%eax),%edx
+  80110f:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801112:	8b 50 04             	mov    0x4(%eax),%edx
+  801115:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801118:	8b 50 08             	mov    0x8(%eax),%edx
+  80111b:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  80111e:	8b 50 0c             	mov    0xc(%eax),%edx
+  801121:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801124:	8b 40 10             	mov    0x10(%eax),%eax
+  801127:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  80112a:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  80112d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801130:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801135:	55                   	push   %ebp
+  801136:	56                   	push   %esi
+  801137:	8b 0e                	mov    (%esi),%ecx
+  801139:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80113c:	8b 7e 08             	mov    0x8(%esi),%edi
+  80113f:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801142:	8b 76 0c             	mov    0xc(%esi),%esi
+  801145:	cd 30                	int    $0x30
+  801147:	87 34 24             	xchg   %esi,(%esp)
+  80114a:	89 0e                	mov    %ecx,(%esi)
+  80114c:	89 5e 04             	mov    %ebx,0x4(%esi)
+  80114f:	89 7e 08             	mov    %edi,0x8(%esi)
+  801152:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801155:	8f 46 0c             	pop    0xc(%esi)
+  801158:	5d                   	pop    %ebp
+}
+  801159:	83 c4 20             	add    $0x20,%esp
+  80115c:	5b                   	pop    %ebx
+  80115d:	5e                   	pop    %esi
+  80115e:	5f                   	pop    %edi
+  80115f:	5d                   	pop    %ebp
+  801160:	c3                   	ret
+
+00801161 <sys_fork>:
+{
+  801161:	55                   	push   %ebp
+  801162:	89 e5                	mov    %esp,%ebp
+  801164:	57                   	push   %edi
+  801165:	56                   	push   %esi
+  801166:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801167:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80116e:	78 2e                	js     80119e <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801170:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801177:	74 71                	je     8011ea <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801179:	ba 00 00 00 00       	mov    $0x0,%edx
+  80117e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801183:	89 d1                	mov    %edx,%ecx
+  801185:	89 d3                	mov    %edx,%ebx
+  801187:	89 d7                	mov    %edx,%edi
+  801189:	89 d6                	mov    %edx,%esi
+  80118b:	55                   	push   %ebp
+  80118c:	68 95 11 80 00       	push   $0x801195
+  801191:	89 e5                	mov    %esp,%ebp
+  801193:	0f 34                	sysenter
+  801195:	83 c4 04             	add    $0x4,%esp
+  801198:	5d                   	pop    %ebp
+}
+  801199:	5b                   	pop    %ebx
+  80119a:	5e                   	pop    %esi
+  80119b:	5f                   	pop    %edi
+  80119c:	5d                   	pop    %ebp
+  80119d:	c3                   	ret
+  80119e:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011a3:	0f a2                	cpuid
+		return 0;
+  8011a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8011aa:	f6 c6 08             	test   $0x8,%dh
+  8011ad:	74 15                	je     8011c4 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011af:	89 c2                	mov    %eax,%edx
+  8011b1:	c1 ea 08             	shr    $0x8,%edx
+  8011b4:	83 e2 0f             	and    $0xf,%edx
+  8011b7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011bc:	83 fa 06             	cmp    $0x6,%edx
+  8011bf:	74 0e                	je     8011cf <sys_fork+0x6e>
+  8011c1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8011c4:	0f b6 c9             	movzbl %cl,%ecx
+  8011c7:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8011cd:	eb a1                	jmp    801170 <sys_fork+0xf>
+  8011cf:	89 c2                	mov    %eax,%edx
+  8011d1:	c1 ea 04             	shr    $0x4,%edx
+  8011d4:	83 e2 0f             	and    $0xf,%edx
+  8011d7:	83 fa 02             	cmp    $0x2,%edx
+  8011da:	77 e5                	ja     8011c1 <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  8011dc:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011df:	83 f8 02             	cmp    $0x2,%eax
+  8011e2:	0f 97 c1             	seta   %cl
+  8011e5:	0f b6 c9             	movzbl %cl,%ecx
+  8011e8:	eb d7                	jmp    8011c1 <sys_fork+0x60>
+		asm volatile("int %1\n"
+  8011ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011ef:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011f4:	89 d1                	mov    %edx,%ecx
+  8011f6:	89 d3                	mov    %edx,%ebx
+  8011f8:	89 d7                	mov    %edx,%edi
+  8011fa:	89 d6                	mov    %edx,%esi
+  8011fc:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  8011fe:	eb 99                	jmp    801199 <sys_fork+0x38>
+
+00801200 <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801200:	55                   	push   %ebp
+  801201:	89 e5                	mov    %esp,%ebp
+  801203:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801206:	ff 75 14             	push   0x14(%ebp)
+  801209:	ff 75 10             	push   0x10(%ebp)
+  80120c:	ff 75 0c             	push   0xc(%ebp)
+  80120f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801214:	8b 55 08             	mov    0x8(%ebp),%edx
+  801217:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80121c:	e8 81 ee ff ff       	call   8000a2 <page_vec_call>
+}
+  801221:	c9                   	leave
+  801222:	c3                   	ret
+
+00801223 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801223:	55                   	push   %ebp
+  801224:	89 e5                	mov    %esp,%ebp
+  801226:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801229:	ff 75 18             	push   0x18(%ebp)
+  80122c:	ff 75 14             	push   0x14(%ebp)
+  80122f:	ff 75 10             	push   0x10(%ebp)
+  801232:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801235:	8b 55 08             	mov    0x8(%ebp),%edx
+  801238:	b8 10 00 00 00       	mov    $0x10,%eax
+  80123d:	e8 60 ee ff ff       	call   8000a2 <page_vec_call>
+}
+  801242:	c9                   	leave
+  801243:	c3                   	ret
+
+00801244 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801244:	55                   	push   %ebp
+  801245:	89 e5                	mov    %esp,%ebp
+  801247:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  80124a:	ff 75 14             	push   0x14(%ebp)
+  80124d:	ff 75 10             	push   0x10(%ebp)
+  801250:	ff 75 0c             	push   0xc(%ebp)
+  801253:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801258:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125b:	b8 11 00 00 00       	mov    $0x11,%eax
+  801260:	e8 3d ee ff ff       	call   8000a2 <page_vec_call>
+}
+  801265:	c9                   	leave
+  801266:	c3                   	ret
+
+00801267 <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801267:	55                   	push   %ebp
+  801268:	89 e5                	mov    %esp,%ebp
+  80126a:	57                   	push   %edi
+  80126b:	56                   	push   %esi
+  80126c:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80126d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801274:	78 32                	js     8012a8 <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801276:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80127d:	74 75                	je     8012f4 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  80127f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801282:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801285:	b8 12 00 00 00       	mov    $0x12,%eax
+  80128a:	be 00 00 00 00       	mov    $0x0,%esi
+  80128f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801292:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801295:	55                   	push   %ebp
+  801296:	68 9f 12 80 00       	push   $0x80129f
+  80129b:	89 e5                	mov    %esp,%ebp
+  80129d:	0f 34                	sysenter
+  80129f:	83 c4 04             	add    $0x4,%esp
+  8012a2:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  8012a3:	5b                   	pop    %ebx
+  8012a4:	5e                   	pop    %esi
+  8012a5:	5f                   	pop    %edi
+  8012a6:	5d                   	pop    %ebp
+  8012a7:	c3                   	ret
+  8012a8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012ad:	0f a2                	cpuid
+		return 0;
+  8012af:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8012b4:	f6 c6 08             	test   $0x8,%dh
+  8012b7:	74 15                	je     8012ce <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012b9:	89 c2                	mov    %eax,%edx
+  8012bb:	c1 ea 08             	shr    $0x8,%edx
+  8012be:	83 e2 0f             	and    $0xf,%edx
+  8012c1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012c6:	83 fa 06             	cmp    $0x6,%edx
+  8012c9:	74 0e                	je     8012d9 <sys_vm_ranges+0x72>
+  8012cb:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8012ce:	0f b6 c9             	movzbl %cl,%ecx
+  8012d1:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8012d7:	eb 9d                	jmp    801276 <sys_vm_ranges+0xf>
+  8012d9:	89 c2                	mov    %eax,%edx
+  8012db:	c1 ea 04             	shr    $0x4,%edx
+  8012de:	83 e2 0f             	and    $0xf,%edx
+  8012e1:	83 fa 02             	cmp    $0x2,%edx
+  8012e4:	77 e5                	ja     8012cb <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  8012e6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012e9:	83 f8 02             	cmp    $0x2,%eax
+  8012ec:	0f 97 c1             	seta   %cl
+  8012ef:	0f b6 c9             	movzbl %cl,%ecx
+  8012f2:	eb d7                	jmp    8012cb <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  8012f4:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8012fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801301:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801304:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801307:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80130a:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  80130c:	eb 95                	jmp    8012a3 <sys_vm_ranges+0x3c>
+
+0080130e <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  80130e:	55                   	push   %ebp
+  80130f:	89 e5                	mov    %esp,%ebp
+  801311:	57                   	push   %edi
+  801312:	56                   	push   %esi
+  801313:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801314:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80131b:	78 31                	js     80134e <sys_spawn+0x40>
+	if (syscall_sysenter)
+  80131d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801324:	74 74                	je     80139a <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801326:	be 00 00 00 00       	mov    $0x0,%esi
+  80132b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80132e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801331:	b8 14 00 00 00       	mov    $0x14,%eax
+  801336:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801339:	89 f7                	mov    %esi,%edi
+  80133b:	55                   	push   %ebp
+  80133c:	68 45 13 80 00       	push   $0x801345
+  801341:	89 e5                	mov    %esp,%ebp
+  801343:	0f 34                	sysenter
+  801345:	83 c4 04             	add    $0x4,%esp
+  801348:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801349:	5b                   	pop    %ebx
+  80134a:	5e                   	pop    %esi
+  80134b:	5f                   	pop    %edi
+  80134c:	5d                   	pop    %ebp
+  80134d:	c3                   	ret
+  80134e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801353:	0f a2                	cpuid
+		return 0;
+  801355:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80135a:	f6 c6 08             	test   $0x8,%dh
+  80135d:	74 15                	je     801374 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80135f:	89 c2                	mov    %eax,%edx
+  801361:	c1 ea 08             	shr    $0x8,%edx
+  801364:	83 e2 0f             	and    $0xf,%edx
+  801367:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80136c:	83 fa 06             	cmp    $0x6,%edx
+  80136f:	74 0e                	je     80137f <sys_spawn+0x71>
+  801371:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801374:	0f b6 c9             	movzbl %cl,%ecx
+  801377:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80137d:	eb 9e                	jmp    80131d <sys_spawn+0xf>
+  80137f:	89 c2                	mov    %eax,%edx
+  801381:	c1 ea 04             	shr    $0x4,%edx
+  801384:	83 e2 0f             	and    $0xf,%edx
+  801387:	83 fa 02             	cmp    $0x2,%edx
+  80138a:	77 e5                	ja     801371 <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  80138c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80138f:	83 f8 02             	cmp    $0x2,%eax
+  801392:	0f 97 c1             	seta   %cl
+  801395:	0f b6 c9             	movzbl %cl,%ecx
+  801398:	eb d7                	jmp    801371 <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  80139a:	be 00 00 00 00       	mov    $0x0,%esi
+  80139f:	b8 14 00 00 00       	mov    $0x14,%eax
+  8013a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013aa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013ad:	89 f7                	mov    %esi,%edi
+  8013af:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  8013b1:	eb 96                	jmp    801349 <sys_spawn+0x3b>
+
+008013b3 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  8013b3:	55                   	push   %ebp
+  8013b4:	89 e5                	mov    %esp,%ebp
+  8013b6:	57                   	push   %edi
+  8013b7:	56                   	push   %esi
+  8013b8:	53                   	push   %ebx
+  8013b9:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8013bc:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8013c3:	78 37                	js     8013fc <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  8013c5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8013cc:	74 7a                	je     801448 <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  8013ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d9:	b8 15 00 00 00       	mov    $0x15,%eax
+  8013de:	89 df                	mov    %ebx,%edi
+  8013e0:	89 de                	mov    %ebx,%esi
+  8013e2:	55                   	push   %ebp
+  8013e3:	68 ec 13 80 00       	push   $0x8013ec
+  8013e8:	89 e5                	mov    %esp,%ebp
+  8013ea:	0f 34                	sysenter
+  8013ec:	83 c4 04             	add    $0x4,%esp
+  8013ef:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8013f0:	85 c0                	test   %eax,%eax
+  8013f2:	7f 6c                	jg     801460 <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  8013f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013f7:	5b                   	pop    %ebx
+  8013f8:	5e                   	pop    %esi
+  8013f9:	5f                   	pop    %edi
+  8013fa:	5d                   	pop    %ebp
+  8013fb:	c3                   	ret
+  8013fc:	b8 01 00 00 00       	mov    $0x1,%eax
+  801401:	0f a2                	cpuid
+		return 0;
+  801403:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801408:	f6 c6 08             	test   $0x8,%dh
+  80140b:	74 15                	je     801422 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80140d:	89 c2                	mov    %eax,%edx
+  80140f:	c1 ea 08             	shr    $0x8,%edx
+  801412:	83 e2 0f             	and    $0xf,%edx
+  801415:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80141a:	83 fa 06             	cmp    $0x6,%edx
+  80141d:	74 0e                	je     80142d <sys_shm_create+0x7a>
+  80141f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801422:	0f b6 c9             	movzbl %cl,%ecx
+  801425:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80142b:	eb 98                	jmp    8013c5 <sys_shm_create+0x12>
+  80142d:	89 c2                	mov    %eax,%edx
+  80142f:	c1 ea 04             	shr    $0x4,%edx
+  801432:	83 e2 0f             	and    $0xf,%edx
+  801435:	83 fa 02             	cmp    $0x2,%edx
+  801438:	77 e5                	ja     80141f <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  80143a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80143d:	83 f8 02             	cmp    $0x2,%eax
+  801440:	0f 97 c1             	seta   %cl
+  801443:	0f b6 c9             	movzbl %cl,%ecx
+  801446:	eb d7                	jmp    80141f <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  801448:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80144d:	b8 15 00 00 00       	mov    $0x15,%eax
+  801452:	8b 55 08             	mov    0x8(%ebp),%edx
+  801455:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801458:	89 df                	mov    %ebx,%edi
+  80145a:	89 de                	mov    %ebx,%esi
+  80145c:	cd 30                	int    $0x30
+  80145e:	eb 90                	jmp    8013f0 <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801460:	83 ec 0c             	sub    $0xc,%esp
+  801463:	50                   	push   %eax
+  801464:	6a 15                	push   $0x15
+  801466:	68 ca 27 80 00       	push   $0x8027ca
+  80146b:	6a 4a                	push   $0x4a
+  80146d:	68 e7 27 80 00       	push   $0x8027e7
+  801472:	e8 9b 07 00 00       	call   801c12 <_panic>
+
+00801477 <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  801477:	55                   	push   %ebp
+  801478:	89 e5                	mov    %esp,%ebp
+  80147a:	57                   	push   %edi
+  80147b:	56                   	push   %esi
+  80147c:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80147d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801484:	78 32                	js     8014b8 <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  801486:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80148d:	74 75                	je     801504 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  80148f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801492:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801495:	b8 16 00 00 00       	mov    $0x16,%eax
+  80149a:	be 00 00 00 00       	mov    $0x0,%esi
+  80149f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014a2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014a5:	55                   	push   %ebp
+  8014a6:	68 af 14 80 00       	push   $0x8014af
+  8014ab:	89 e5                	mov    %esp,%ebp
+  8014ad:	0f 34                	sysenter
+  8014af:	83 c4 04             	add    $0x4,%esp
+  8014b2:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  8014b3:	5b                   	pop    %ebx
+  8014b4:	5e                   	pop    %esi
+  8014b5:	5f                   	pop    %edi
+  8014b6:	5d                   	pop    %ebp
+  8014b7:	c3                   	ret
+  8014b8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014bd:	0f a2                	cpuid
+		return 0;
+  8014bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8014c4:	f6 c6 08             	test   $0x8,%dh
+  8014c7:	74 15                	je     8014de <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014c9:	89 c2                	mov    %eax,%edx
+  8014cb:	c1 ea 08             	shr    $0x8,%edx
+  8014ce:	83 e2 0f             	and    $0xf,%edx
+  8014d1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8014d6:	83 fa 06             	cmp    $0x6,%edx
+  8014d9:	74 0e                	je     8014e9 <sys_shm_attach+0x72>
+  8014db:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8014de:	0f b6 c9             	movzbl %cl,%ecx
+  8014e1:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8014e7:	eb 9d                	jmp    801486 <sys_shm_attach+0xf>
+  8014e9:	89 c2                	mov    %eax,%edx
+  8014eb:	c1 ea 04             	shr    $0x4,%edx
+  8014ee:	83 e2 0f             	and    $0xf,%edx
+  8014f1:	83 fa 02             	cmp    $0x2,%edx
+  8014f4:	77 e5                	ja     8014db <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  8014f6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014f9:	83 f8 02             	cmp    $0x2,%eax
+  8014fc:	0f 97 c1             	seta   %cl
+  8014ff:	0f b6 c9             	movzbl %cl,%ecx
+  801502:	eb d7                	jmp    8014db <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  801504:	b8 16 00 00 00       	mov    $0x16,%eax
+  801509:	be 00 00 00 00       	mov    $0x0,%esi
+  80150e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801511:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801514:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801517:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80151a:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  80151c:	eb 95                	jmp    8014b3 <sys_shm_attach+0x3c>
+
+0080151e <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  80151e:	55                   	push   %ebp
+  80151f:	89 e5                	mov    %esp,%ebp
+  801521:	57                   	push   %edi
+  801522:	56                   	push   %esi
+  801523:	53                   	push   %ebx
+  801524:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801527:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80152e:	78 38                	js     801568 <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  801530:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801537:	74 7b                	je     8015b4 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  801539:	be 00 00 00 00       	mov    $0x0,%esi
+  80153e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801541:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801544:	b8 17 00 00 00       	mov    $0x17,%eax
+  801549:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80154c:	89 f7                	mov    %esi,%edi
+  80154e:	55                   	push   %ebp
+  80154f:	68 58 15 80 00       	push   $0x801558
+  801554:	89 e5                	mov    %esp,%ebp
+  801556:	0f 34                	sysenter
+  801558:	83 c4 04             	add    $0x4,%esp
+  80155b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80155c:	85 c0                	test   %eax,%eax
+  80155e:	7f 6d                	jg     8015cd <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  801560:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801563:	5b                   	pop    %ebx
+  801564:	5e                   	pop    %esi
+  801565:	5f                   	pop    %edi
+  801566:	5d                   	pop    %ebp
+  801567:	c3                   	ret
+  801568:	b8 01 00 00 00       	mov    $0x1,%eax
+  80156d:	0f a2                	cpuid
+		return 0;
+  80156f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801574:	f6 c6 08             	test   $0x8,%dh
+  801577:	74 15                	je     80158e <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801579:	89 c2                	mov    %eax,%edx
+  80157b:	c1 ea 08             	shr    $0x8,%edx
+  80157e:	83 e2 0f             	and    $0xf,%edx
+  801581:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801586:	83 fa 06             	cmp    $0x6,%edx
+  801589:	74 0e                	je     801599 <sys_shm_detach+0x7b>
+  80158b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80158e:	0f b6 c9             	movzbl %cl,%ecx
+  801591:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801597:	eb 97                	jmp    801530 <sys_shm_detach+0x12>
+  801599:	89 c2                	mov    %eax,%edx
+  80159b:	c1 ea 04             	shr    $0x4,%edx
+  80159e:	83 e2 0f             	and    $0xf,%edx
+  8015a1:	83 fa 02             	cmp    $0x2,%edx
+  8015a4:	77 e5                	ja     80158b <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  8015a6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015a9:	83 f8 02             	cmp    $0x2,%eax
+  8015ac:	0f 97 c1             	seta   %cl
+  8015af:	0f b6 c9             	movzbl %cl,%ecx
+  8015b2:	eb d7                	jmp    80158b <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  8015b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8015b9:	b8 17 00 00 00       	mov    $0x17,%eax
+  8015be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015c4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015c7:	89 f7                	mov    %esi,%edi
+  8015c9:	cd 30                	int    $0x30
+  8015cb:	eb 8f                	jmp    80155c <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015cd:	83 ec 0c             	sub    $0xc,%esp
+  8015d0:	50                   	push   %eax
+  8015d1:	6a 17                	push   $0x17
+  8015d3:	68 ca 27 80 00       	push   $0x8027ca
+  8015d8:	6a 4a                	push   $0x4a
+  8015da:	68 e7 27 80 00       	push   $0x8027e7
+  8015df:	e8 2e 06 00 00       	call   801c12 <_panic>
+
+008015e4 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  8015e4:	55                   	push   %ebp
+  8015e5:	89 e5                	mov    %esp,%ebp
+  8015e7:	57                   	push   %edi
+  8015e8:	56                   	push   %esi
+  8015e9:	53                   	push   %ebx
+  8015ea:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8015ed:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8015f4:	78 36                	js     80162c <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  8015f6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8015fd:	74 79                	je     801678 <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  8015ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801602:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801607:	b8 18 00 00 00       	mov    $0x18,%eax
+  80160c:	89 cb                	mov    %ecx,%ebx
+  80160e:	89 cf                	mov    %ecx,%edi
+  801610:	89 ce                	mov    %ecx,%esi
+  801612:	55                   	push   %ebp
+  801613:	68 1c 16 80 00       	push   $0x80161c
+  801618:	89 e5                	mov    %esp,%ebp
+  80161a:	0f 34                	sysenter
+  80161c:	83 c4 04             	add    $0x4,%esp
+  80161f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801620:	85 c0                	test   %eax,%eax
+  801622:	7f 6b                	jg     80168f <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  801624:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801627:	5b                   	pop    %ebx
+  801628:	5e                   	pop    %esi
+  801629:	5f                   	pop    %edi
+  80162a:	5d                   	pop    %ebp
+  80162b:	c3                   	ret
+  80162c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801631:	0f a2                	cpuid
+		return 0;
+  801633:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801638:	f6 c6 08             	test   $0x8,%dh
+  80163b:	74 15                	je     801652 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80163d:	89 c2                	mov    %eax,%edx
+  80163f:	c1 ea 08             	shr    $0x8,%edx
+  801642:	83 e2 0f             	and    $0xf,%edx
+  801645:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80164a:	83 fa 06             	cmp    $0x6,%edx
+  80164d:	74 0e                	je     80165d <sys_shm_remove+0x79>
+  80164f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801652:	0f b6 c9             	movzbl %cl,%ecx
+  801655:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80165b:	eb 99                	jmp    8015f6 <sys_shm_remove+0x12>
+  80165d:	89 c2                	mov    %eax,%edx
+  80165f:	c1 ea 04             	shr    $0x4,%edx
+  801662:	83 e2 0f             	and    $0xf,%edx
+  801665:	83 fa 02             	cmp    $0x2,%edx
+  801668:	77 e5                	ja     80164f <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  80166a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80166d:	83 f8 02             	cmp    $0x2,%eax
+  801670:	0f 97 c1             	seta   %cl
+  801673:	0f b6 c9             	movzbl %cl,%ecx
+  801676:	eb d7                	jmp    80164f <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  801678:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80167d:	b8 18 00 00 00       	mov    $0x18,%eax
+  801682:	8b 55 08             	mov    0x8(%ebp),%edx
+  801685:	89 cb                	mov    %ecx,%ebx
+  801687:	89 cf                	mov    %ecx,%edi
+  801689:	89 ce                	mov    %ecx,%esi
+  80168b:	cd 30                	int    $0x30
+  80168d:	eb 91                	jmp    801620 <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80168f:	83 ec 0c             	sub    $0xc,%esp
+  801692:	50                   	push   %eax
+  801693:	6a 18                	push   $0x18
+  801695:	68 ca 27 80 00       	push   $0x8027ca
+  80169a:	6a 4a                	push   $0x4a
+  80169c:	68 e7 27 80 00       	push   $0x8027e7
+  8016a1:	e8 6c 05 00 00       	call   801c12 <_panic>
+
+008016a6 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  8016a6:	55                   	push   %ebp
+  8016a7:	89 e5                	mov    %esp,%ebp
+  8016a9:	57                   	push   %edi
+  8016aa:	56                   	push   %esi
+  8016ab:	53                   	push   %ebx
+  8016ac:	83 ec 0c             	sub    $0xc,%esp
+  8016af:	8b 45 10             	mov    0x10(%ebp),%eax
+  8016b2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8016b5:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  8016b8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8016bf:	78 32                	js     8016f3 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  8016c1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8016c8:	74 75                	je     80173f <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  8016ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016d0:	b8 20 00 00 00       	mov    $0x20,%eax
+  8016d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8016da:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8016dd:	55                   	push   %ebp
+  8016de:	68 e7 16 80 00       	push   $0x8016e7
+  8016e3:	89 e5                	mov    %esp,%ebp
+  8016e5:	0f 34                	sysenter
+  8016e7:	83 c4 04             	add    $0x4,%esp
+  8016ea:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  8016eb:	83 c4 0c             	add    $0xc,%esp
+  8016ee:	5b                   	pop    %ebx
+  8016ef:	5e                   	pop    %esi
+  8016f0:	5f                   	pop    %edi
+  8016f1:	5d                   	pop    %ebp
+  8016f2:	c3                   	ret
+  8016f3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016f8:	0f a2                	cpuid
+		return 0;
+  8016fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8016ff:	f6 c6 08             	test   $0x8,%dh
+  801702:	74 15                	je     801719 <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801704:	89 c2                	mov    %eax,%edx
+  801706:	c1 ea 08             	shr    $0x8,%edx
+  801709:	83 e2 0f             	and    $0xf,%edx
+  80170c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801711:	83 fa 06             	cmp    $0x6,%edx
+  801714:	74 0e                	je     801724 <sys_futex_wait+0x7e>
+  801716:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801719:	0f b6 c9             	movzbl %cl,%ecx
+  80171c:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801722:	eb 9d                	jmp    8016c1 <sys_futex_wait+0x1b>
+  801724:	89 c2                	mov    %eax,%edx
+  801726:	c1 ea 04             	shr    $0x4,%edx
+  801729:	83 e2 0f             	and    $0xf,%edx
+  80172c:	83 fa 02             	cmp    $0x2,%edx
+  80172f:	77 e5                	ja     801716 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  801731:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801734:	83 f8 02             	cmp    $0x2,%eax
+  801737:	0f 97 c1             	seta   %cl
+  80173a:	0f b6 c9             	movzbl %cl,%ecx
+  80173d:	eb d7                	jmp    801716 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  80173f:	b8 20 00 00 00       	mov    $0x20,%eax
+  801744:	be 00 00 00 00       	mov    $0x0,%esi
+  801749:	8b 55 08             	mov    0x8(%ebp),%edx
+  80174c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80174f:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  801752:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  801754:	eb 95                	jmp    8016eb <sys_futex_wait+0x45>
+
+00801756 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801756:	55                   	push   %ebp
+  801757:	89 e5                	mov    %esp,%ebp
+  801759:	57                   	push   %edi
+  80175a:	56                   	push   %esi
+  80175b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80175c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801763:	78 30                	js     801795 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  801765:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80176c:	74 73                	je     8017e1 <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  80176e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801773:	8b 55 08             	mov    0x8(%ebp),%edx
+  801776:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801779:	b8 21 00 00 00       	mov    $0x21,%eax
+  80177e:	89 df                	mov    %ebx,%edi
+  801780:	89 de                	mov    %ebx,%esi
+  801782:	55                   	push   %ebp
+  801783:	68 8c 17 80 00       	push   $0x80178c
+  801788:	89 e5                	mov    %esp,%ebp
+  80178a:	0f 34                	sysenter
+  80178c:	83 c4 04             	add    $0x4,%esp
+  80178f:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801790:	5b                   	pop    %ebx
+  801791:	5e                   	pop    %esi
+  801792:	5f                   	pop    %edi
+  801793:	5d                   	pop    %ebp
+  801794:	c3                   	ret
+  801795:	b8 01 00 00 00       	mov    $0x1,%eax
+  80179a:	0f a2                	cpuid
+		return 0;
+  80179c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8017a1:	f6 c6 08             	test   $0x8,%dh
+  8017a4:	74 15                	je     8017bb <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017a6:	89 c2                	mov    %eax,%edx
+  8017a8:	c1 ea 08             	shr    $0x8,%edx
+  8017ab:	83 e2 0f             	and    $0xf,%edx
+  8017ae:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017b3:	83 fa 06             	cmp    $0x6,%edx
+  8017b6:	74 0e                	je     8017c6 <sys_futex_wake+0x70>
+  8017b8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8017bb:	0f b6 c9             	movzbl %cl,%ecx
+  8017be:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8017c4:	eb 9f                	jmp    801765 <sys_futex_wake+0xf>
+  8017c6:	89 c2                	mov    %eax,%edx
+  8017c8:	c1 ea 04             	shr    $0x4,%edx
+  8017cb:	83 e2 0f             	and    $0xf,%edx
+  8017ce:	83 fa 02             	cmp    $0x2,%edx
+  8017d1:	77 e5                	ja     8017b8 <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  8017d3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017d6:	83 f8 02             	cmp    $0x2,%eax
+  8017d9:	0f 97 c1             	seta   %cl
+  8017dc:	0f b6 c9             	movzbl %cl,%ecx
+  8017df:	eb d7                	jmp    8017b8 <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  8017e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017e6:	b8 21 00 00 00       	mov    $0x21,%eax
+  8017eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017f1:	89 df                	mov    %ebx,%edi
+  8017f3:	89 de                	mov    %ebx,%esi
+  8017f5:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  8017f7:	eb 97                	jmp    801790 <sys_futex_wake+0x3a>
+
+008017f9 <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  8017f9:	55                   	push   %ebp
+  8017fa:	89 e5                	mov    %esp,%ebp
+  8017fc:	57                   	push   %edi
+  8017fd:	56                   	push   %esi
+  8017fe:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8017ff:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801806:	78 2e                	js     801836 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  801808:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80180f:	74 71                	je     801882 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  801811:	ba 00 00 00 00       	mov    $0x0,%edx
+  801816:	b8 22 00 00 00       	mov    $0x22,%eax
+  80181b:	89 d1                	mov    %edx,%ecx
+  80181d:	89 d3                	mov    %edx,%ebx
+  80181f:	89 d7                	mov    %edx,%edi
+  801821:	89 d6                	mov    %edx,%esi
+  801823:	55                   	push   %ebp
+  801824:	68 2d 18 80 00       	push   $0x80182d
+  801829:	89 e5                	mov    %esp,%ebp
+  80182b:	0f 34                	sysenter
+  80182d:	83 c4 04             	add    $0x4,%esp
+  801830:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  801831:	5b                   	pop    %ebx
+  801832:	5e                   	pop    %esi
+  801833:	5f                   	pop    %edi
+  801834:	5d                   	pop    %ebp
+  801835:	c3                   	ret
+  801836:	b8 01 00 00 00       	mov    $0x1,%eax
+  80183b:	0f a2                	cpuid
+		return 0;
+  80183d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801842:	f6 c6 08             	test   $0x8,%dh
+  801845:	74 15                	je     80185c <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801847:	89 c2                	mov    %eax,%edx
+  801849:	c1 ea 08             	shr    $0x8,%edx
+  80184c:	83 e2 0f             	and    $0xf,%edx
+  80184f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801854:	83 fa 06             	cmp    $0x6,%edx
+  801857:	74 0e                	je     801867 <sys_ep_create+0x6e>
+  801859:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80185c:	0f b6 c9             	movzbl %cl,%ecx
+  80185f:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801865:	eb a1                	jmp    801808 <sys_ep_create+0xf>
+  801867:	89 c2                	mov    %eax,%edx
+  801869:	c1 ea 04             	shr    $0x4,%edx
+  80186c:	83 e2 0f             	and    $0xf,%edx
+  80186f:	83 fa 02             	cmp    $0x2,%edx
+  801872:	77 e5                	ja     801859 <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  801874:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801877:	83 f8 02             	cmp    $0x2,%eax
+  80187a:	0f 97 c1             	seta   %cl
+  80187d:	0f b6 c9             	movzbl %cl,%ecx
+  801880:	eb d7                	jmp    801859 <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  801882:	ba 00 00 00 00       	mov    $0x0,%edx
+  801887:	b8 22 00 00 00       	mov    $0x22,%eax
+  80188c:	89 d1                	mov    %edx,%ecx
+  80188e:	89 d3                	mov    %edx,%ebx
+  801890:	89 d7                	mov    %edx,%edi
+  801892:	89 d6                	mov    %edx,%esi
+  801894:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  801896:	eb 99                	jmp    801831 <sys_ep_create+0x38>
+
+00801898 <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  801898:	55                   	push   %ebp
+  801899:	89 e5                	mov    %esp,%ebp
+  80189b:	57                   	push   %edi
+  80189c:	56                   	push   %esi
+  80189d:	53                   	push   %ebx
+  80189e:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8018a1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8018a8:	78 36                	js     8018e0 <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  8018aa:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8018b1:	74 79                	je     80192c <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  8018b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018bb:	b8 23 00 00 00       	mov    $0x23,%eax
+  8018c0:	89 cb                	mov    %ecx,%ebx
+  8018c2:	89 cf                	mov    %ecx,%edi
+  8018c4:	89 ce                	mov    %ecx,%esi
+  8018c6:	55                   	push   %ebp
+  8018c7:	68 d0 18 80 00       	push   $0x8018d0
+  8018cc:	89 e5                	mov    %esp,%ebp
+  8018ce:	0f 34                	sysenter
+  8018d0:	83 c4 04             	add    $0x4,%esp
+  8018d3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8018d4:	85 c0                	test   %eax,%eax
+  8018d6:	7f 6b                	jg     801943 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  8018d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018db:	5b                   	pop    %ebx
+  8018dc:	5e                   	pop    %esi
+  8018dd:	5f                   	pop    %edi
+  8018de:	5d                   	pop    %ebp
+  8018df:	c3                   	ret
+  8018e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018e5:	0f a2                	cpuid
+		return 0;
+  8018e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018ec:	f6 c6 08             	test   $0x8,%dh
+  8018ef:	74 15                	je     801906 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018f1:	89 c2                	mov    %eax,%edx
+  8018f3:	c1 ea 08             	shr    $0x8,%edx
+  8018f6:	83 e2 0f             	and    $0xf,%edx
+  8018f9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018fe:	83 fa 06             	cmp    $0x6,%edx
+  801901:	74 0e                	je     801911 <sys_ep_destroy+0x79>
+  801903:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801906:	0f b6 c9             	movzbl %cl,%ecx
+  801909:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80190f:	eb 99                	jmp    8018aa <sys_ep_destroy+0x12>
+  801911:	89 c2                	mov    %eax,%edx
+  801913:	c1 ea 04             	shr    $0x4,%edx
+  801916:	83 e2 0f             	and    $0xf,%edx
+  801919:	83 fa 02             	cmp    $0x2,%edx
+  80191c:	77 e5                	ja     801903 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  80191e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801921:	83 f8 02             	cmp    $0x2,%eax
+  801924:	0f 97 c1             	seta   %cl
+  801927:	0f b6 c9             	movzbl %cl,%ecx
+  80192a:	eb d7                	jmp    801903 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  80192c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801931:	b8 23 00 00 00       	mov    $0x23,%eax
+  801936:	8b 55 08             	mov    0x8(%ebp),%edx
+  801939:	89 cb                	mov    %ecx,%ebx
+  80193b:	89 cf                	mov    %ecx,%edi
+  80193d:	89 ce                	mov    %ecx,%esi
+  80193f:	cd 30                	int    $0x30
+  801941:	eb 91                	jmp    8018d4 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801943:	83 ec 0c             	sub    $0xc,%esp
+  801946:	50                   	push   %eax
+  801947:	6a 23                	push   $0x23
+  801949:	68 ca 27 80 00       	push   $0x8027ca
+  80194e:	6a 4a                	push   $0x4a
+  801950:	68 e7 27 80 00       	push   $0x8027e7
+  801955:	e8 b8 02 00 00       	call   801c12 <_panic>
+
+0080195a <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  80195a:	55                   	push   %ebp
+  80195b:	89 e5                	mov    %esp,%ebp
+  80195d:	57                   	push   %edi
+  80195e:	56                   	push   %esi
+  80195f:	53                   	push   %ebx
+  801960:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801963:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80196a:	78 37                	js     8019a3 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  80196c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801973:	74 7a                	je     8019ef <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  801975:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80197a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80197d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801980:	b8 24 00 00 00       	mov    $0x24,%eax
+  801985:	89 df                	mov    %ebx,%edi
+  801987:	89 de                	mov    %ebx,%esi
+  801989:	55                   	push   %ebp
+  80198a:	68 93 19 80 00       	push   $0x801993
+  80198f:	89 e5                	mov    %esp,%ebp
+  801991:	0f 34                	sysenter
+  801993:	83 c4 04             	add    $0x4,%esp
+  801996:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801997:	85 c0                	test   %eax,%eax
+  801999:	7f 6c                	jg     801a07 <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  80199b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80199e:	5b                   	pop    %ebx
+  80199f:	5e                   	pop    %esi
+  8019a0:	5f                   	pop    %edi
+  8019a1:	5d                   	pop    %ebp
+  8019a2:	c3                   	ret
+  8019a3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019a8:	0f a2                	cpuid
+		return 0;
+  8019aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8019af:	f6 c6 08             	test   $0x8,%dh
+  8019b2:	74 15                	je     8019c9 <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019b4:	89 c2                	mov    %eax,%edx
+  8019b6:	c1 ea 08             	shr    $0x8,%edx
+  8019b9:	83 e2 0f             	and    $0xf,%edx
+  8019bc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019c1:	83 fa 06             	cmp    $0x6,%edx
+  8019c4:	74 0e                	je     8019d4 <sys_ep_grant+0x7a>
+  8019c6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8019c9:	0f b6 c9             	movzbl %cl,%ecx
+  8019cc:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8019d2:	eb 98                	jmp    80196c <sys_ep_grant+0x12>
+  8019d4:	89 c2                	mov    %eax,%edx
+  8019d6:	c1 ea 04             	shr    $0x4,%edx
+  8019d9:	83 e2 0f             	and    $0xf,%edx
+  8019dc:	83 fa 02             	cmp    $0x2,%edx
+  8019df:	77 e5                	ja     8019c6 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  8019e1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019e4:	83 f8 02             	cmp    $0x2,%eax
+  8019e7:	0f 97 c1             	seta   %cl
+  8019ea:	0f b6 c9             	movzbl %cl,%ecx
+  8019ed:	eb d7                	jmp    8019c6 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  8019ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019f4:	b8 24 00 00 00       	mov    $0x24,%eax
+  8019f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019ff:	89 df                	mov    %ebx,%edi
+  801a01:	89 de                	mov    %ebx,%esi
+  801a03:	cd 30                	int    $0x30
+  801a05:	eb 90                	jmp    801997 <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a07:	83 ec 0c             	sub    $0xc,%esp
+  801a0a:	50                   	push   %eax
+  801a0b:	6a 24                	push   $0x24
+  801a0d:	68 ca 27 80 00       	push   $0x8027ca
+  801a12:	6a 4a                	push   $0x4a
+  801a14:	68 e7 27 80 00       	push   $0x8027e7
+  801a19:	e8 f4 01 00 00       	call   801c12 <_panic>
+
+00801a1e <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  801a1e:	55                   	push   %ebp
+  801a1f:	89 e5                	mov    %esp,%ebp
+  801a21:	57                   	push   %edi
+  801a22:	56                   	push   %esi
+  801a23:	53                   	push   %ebx
+  801a24:	83 ec 20             	sub    $0x20,%esp
+  801a27:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801a2a:	8b 10                	mov    (%eax),%edx
+  801a2c:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801a2f:	8b 50 04             	mov    0x4(%eax),%edx
+  801a32:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801a35:	8b 50 08             	mov    0x8(%eax),%edx
+  801a38:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801a3b:	8b 50 0c             	mov    0xc(%eax),%edx
+  801a3e:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801a41:	8b 40 10             	mov    0x10(%eax),%eax
+  801a44:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801a47:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801a4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a4d:	b8 25 00 00 00       	mov    $0x25,%eax
+  801a52:	55                   	push   %ebp
+  801a53:	56                   	push   %esi
+  801a54:	8b 0e                	mov    (%esi),%ecx
+  801a56:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801a59:	8b 7e 08             	mov    0x8(%esi),%edi
+  801a5c:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801a5f:	8b 76 0c             	mov    0xc(%esi),%esi
+  801a62:	cd 30                	int    $0x30
+  801a64:	87 34 24             	xchg   %esi,(%esp)
+  801a67:	89 0e                	mov    %ecx,(%esi)
+  801a69:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801a6c:	89 7e 08             	mov    %edi,0x8(%esi)
+  801a6f:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801a72:	8f 46 0c             	pop    0xc(%esi)
+  801a75:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  801a76:	83 c4 20             	add    $0x20,%esp
+  801a79:	5b                   	pop    %ebx
+  801a7a:	5e                   	pop    %esi
+  801a7b:	5f                   	pop    %edi
+  801a7c:	5d                   	pop    %ebp
+  801a7d:	c3                   	ret
+
+00801a7e <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  801a7e:	55                   	push   %ebp
+  801a7f:	89 e5                	mov    %esp,%ebp
+  801a81:	57                   	push   %edi
+  801a82:	56                   	push   %esi
+  801a83:	53                   	push   %ebx
+  801a84:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  801a87:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a8a:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  801a8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a8f:	b8 26 00 00 00       	mov    $0x26,%eax
+  801a94:	55                   	push   %ebp
+  801a95:	56                   	push   %esi
+  801a96:	8b 0e                	mov    (%esi),%ecx
+  801a98:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801a9b:	8b 7e 08             	mov    0x8(%esi),%edi
+  801a9e:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801aa1:	8b 76 0c             	mov    0xc(%esi),%esi
+  801aa4:	cd 30                	int    $0x30
+  801aa6:	87 34 24             	xchg   %esi,(%esp)
+  801aa9:	89 0e                	mov    %ecx,(%esi)
+  801aab:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801aae:	89 7e 08             	mov    %edi,0x8(%esi)
+  801ab1:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801ab4:	8f 46 0c             	pop    0xc(%esi)
+  801ab7:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  801ab8:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  801abc:	74 0f                	je     801acd <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  801abe:	85 c0                	test   %eax,%eax
+  801ac0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ac5:	0f 48 d1             	cmovs  %ecx,%edx
+  801ac8:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  801acb:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  801acd:	5b                   	pop    %ebx
+  801ace:	5e                   	pop    %esi
+  801acf:	5f                   	pop    %edi
+  801ad0:	5d                   	pop    %ebp
+  801ad1:	c3                   	ret
+
+00801ad2 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  801ad2:	55                   	push   %ebp
+  801ad3:	89 e5                	mov    %esp,%ebp
+  801ad5:	57                   	push   %edi
+  801ad6:	56                   	push   %esi
+  801ad7:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801ad8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801adf:	78 2f                	js     801b10 <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  801ae1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801ae8:	74 72                	je     801b5c <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  801aea:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801af2:	b8 27 00 00 00       	mov    $0x27,%eax
+  801af7:	89 cb                	mov    %ecx,%ebx
+  801af9:	89 cf                	mov    %ecx,%edi
+  801afb:	89 ce                	mov    %ecx,%esi
+  801afd:	55                   	push   %ebp
+  801afe:	68 07 1b 80 00       	push   $0x801b07
+  801b03:	89 e5                	mov    %esp,%ebp
+  801b05:	0f 34                	sysenter
+  801b07:	83 c4 04             	add    $0x4,%esp
+  801b0a:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  801b0b:	5b                   	pop    %ebx
+  801b0c:	5e                   	pop    %esi
+  801b0d:	5f                   	pop    %edi
+  801b0e:	5d                   	pop    %ebp
+  801b0f:	c3                   	ret
+  801b10:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b15:	0f a2                	cpuid
+		return 0;
+  801b17:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b1c:	f6 c6 08             	test   $0x8,%dh
+  801b1f:	74 15                	je     801b36 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b21:	89 c2                	mov    %eax,%edx
+  801b23:	c1 ea 08             	shr    $0x8,%edx
+  801b26:	83 e2 0f             	and    $0xf,%edx
+  801b29:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b2e:	83 fa 06             	cmp    $0x6,%edx
+  801b31:	74 0e                	je     801b41 <sys_sysring_setup+0x6f>
+  801b33:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b36:	0f b6 c9             	movzbl %cl,%ecx
+  801b39:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801b3f:	eb a0                	jmp    801ae1 <sys_sysring_setup+0xf>
+  801b41:	89 c2                	mov    %eax,%edx
+  801b43:	c1 ea 04             	shr    $0x4,%edx
+  801b46:	83 e2 0f             	and    $0xf,%edx
+  801b49:	83 fa 02             	cmp    $0x2,%edx
+  801b4c:	77 e5                	ja     801b33 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  801b4e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b51:	83 f8 02             	cmp    $0x2,%eax
+  801b54:	0f 97 c1             	seta   %cl
+  801b57:	0f b6 c9             	movzbl %cl,%ecx
+  801b5a:	eb d7                	jmp    801b33 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  801b5c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b61:	b8 27 00 00 00       	mov    $0x27,%eax
+  801b66:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b69:	89 cb                	mov    %ecx,%ebx
+  801b6b:	89 cf                	mov    %ecx,%edi
+  801b6d:	89 ce                	mov    %ecx,%esi
+  801b6f:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  801b71:	eb 98                	jmp    801b0b <sys_sysring_setup+0x39>
+
+00801b73 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  801b73:	55                   	push   %ebp
+  801b74:	89 e5                	mov    %esp,%ebp
+  801b76:	57                   	push   %edi
+  801b77:	56                   	push   %esi
+  801b78:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801b79:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b80:	78 2e                	js     801bb0 <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  801b82:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b89:	74 71                	je     801bfc <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  801b8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b90:	b8 28 00 00 00       	mov    $0x28,%eax
+  801b95:	89 d1                	mov    %edx,%ecx
+  801b97:	89 d3                	mov    %edx,%ebx
+  801b99:	89 d7                	mov    %edx,%edi
+  801b9b:	89 d6                	mov    %edx,%esi
+  801b9d:	55                   	push   %ebp
+  801b9e:	68 a7 1b 80 00       	push   $0x801ba7
+  801ba3:	89 e5                	mov    %esp,%ebp
+  801ba5:	0f 34                	sysenter
+  801ba7:	83 c4 04             	add    $0x4,%esp
+  801baa:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801bab:	5b                   	pop    %ebx
+  801bac:	5e                   	pop    %esi
+  801bad:	5f                   	pop    %edi
+  801bae:	5d                   	pop    %ebp
+  801baf:	c3                   	ret
+  801bb0:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bb5:	0f a2                	cpuid
+		return 0;
+  801bb7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801bbc:	f6 c6 08             	test   $0x8,%dh
+  801bbf:	74 15                	je     801bd6 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bc1:	89 c2                	mov    %eax,%edx
+  801bc3:	c1 ea 08             	shr    $0x8,%edx
+  801bc6:	83 e2 0f             	and    $0xf,%edx
+  801bc9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801bce:	83 fa 06             	cmp    $0x6,%edx
+  801bd1:	74 0e                	je     801be1 <sys_sysring_enter+0x6e>
+  801bd3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801bd6:	0f b6 c9             	movzbl %cl,%ecx
+  801bd9:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801bdf:	eb a1                	jmp    801b82 <sys_sysring_enter+0xf>
+  801be1:	89 c2                	mov    %eax,%edx
+  801be3:	c1 ea 04             	shr    $0x4,%edx
+  801be6:	83 e2 0f             	and    $0xf,%edx
+  801be9:	83 fa 02             	cmp    $0x2,%edx
+  801bec:	77 e5                	ja     801bd3 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  801bee:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bf1:	83 f8 02             	cmp    $0x2,%eax
+  801bf4:	0f 97 c1             	seta   %cl
+  801bf7:	0f b6 c9             	movzbl %cl,%ecx
+  801bfa:	eb d7                	jmp    801bd3 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  801bfc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c01:	b8 28 00 00 00       	mov    $0x28,%eax
+  801c06:	89 d1                	mov    %edx,%ecx
+  801c08:	89 d3                	mov    %edx,%ebx
+  801c0a:	89 d7                	mov    %edx,%edi
+  801c0c:	89 d6                	mov    %edx,%esi
+  801c0e:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  801c10:	eb 99                	jmp    801bab <sys_sysring_enter+0x38>
+
+00801c12 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801c12:	55                   	push   %ebp
+  801c13:	89 e5                	mov    %esp,%ebp
+  801c15:	57                   	push   %edi
+  801c16:	56                   	push   %esi
+  801c17:	53                   	push   %ebx
+  801c18:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  801c1e:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  801c21:	8b 1d 00 30 80 00    	mov    0x803000,%ebx
+  801c27:	e8 c8 e8 ff ff       	call   8004f4 <sys_getenvid>
+  801c2c:	83 ec 04             	sub    $0x4,%esp
+  801c2f:	ff 75 0c             	push   0xc(%ebp)
+  801c32:	ff 75 08             	push   0x8(%ebp)
+  801c35:	53                   	push   %ebx
+  801c36:	50                   	push   %eax
+  801c37:	68 f8 27 80 00       	push   $0x8027f8
+  801c3c:	68 00 01 00 00       	push   $0x100
+  801c41:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  801c47:	56                   	push   %esi
+  801c48:	e8 c9 05 00 00       	call   802216 <snprintf>
+  801c4d:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  801c4f:	83 c4 20             	add    $0x20,%esp
+  801c52:	57                   	push   %edi
+  801c53:	ff 75 10             	push   0x10(%ebp)
+  801c56:	bf 00 01 00 00       	mov    $0x100,%edi
+  801c5b:	89 f8                	mov    %edi,%eax
+  801c5d:	29 d8                	sub    %ebx,%eax
+  801c5f:	50                   	push   %eax
+  801c60:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801c63:	50                   	push   %eax
+  801c64:	e8 5f 05 00 00       	call   8021c8 <vsnprintf>
+  801c69:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  801c6b:	83 c4 0c             	add    $0xc,%esp
+  801c6e:	68 1b 28 80 00       	push   $0x80281b
+  801c73:	29 df                	sub    %ebx,%edi
+  801c75:	57                   	push   %edi
+  801c76:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801c79:	50                   	push   %eax
+  801c7a:	e8 97 05 00 00       	call   802216 <snprintf>
+	sys_cputs(buf, r);
+  801c7f:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  801c82:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  801c84:	53                   	push   %ebx
+  801c85:	56                   	push   %esi
+  801c86:	e8 6b e6 ff ff       	call   8002f6 <sys_cputs>
+  801c8b:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801c8e:	cc                   	int3
+	while (1)
+  801c8f:	eb fd                	jmp    801c8e <_panic+0x7c>
+
+00801c91 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801c91:	55                   	push   %ebp
+  801c92:	89 e5                	mov    %esp,%ebp
+  801c94:	57                   	push   %edi
+  801c95:	56                   	push   %esi
+  801c96:	53                   	push   %ebx
+  801c97:	83 ec 1c             	sub    $0x1c,%esp
+  801c9a:	89 c7                	mov    %eax,%edi
+  801c9c:	89 d6                	mov    %edx,%esi
+  801c9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ca1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ca4:	89 d1                	mov    %edx,%ecx
+  801ca6:	89 c2                	mov    %eax,%edx
+  801ca8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801cab:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801cae:	8b 45 10             	mov    0x10(%ebp),%eax
+  801cb1:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  801cb4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801cb7:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801cbe:	39 c2                	cmp    %eax,%edx
+  801cc0:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  801cc3:	72 3e                	jb     801d03 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801cc5:	83 ec 0c             	sub    $0xc,%esp
+  801cc8:	ff 75 18             	push   0x18(%ebp)
+  801ccb:	83 eb 01             	sub    $0x1,%ebx
+  801cce:	53                   	push   %ebx
+  801ccf:	50                   	push   %eax
+  801cd0:	83 ec 08             	sub    $0x8,%esp
+  801cd3:	ff 75 e4             	push   -0x1c(%ebp)
+  801cd6:	ff 75 e0             	push   -0x20(%ebp)
+  801cd9:	ff 75 dc             	push   -0x24(%ebp)
+  801cdc:	ff 75 d8             	push   -0x28(%ebp)
+  801cdf:	e8 9a 09 00 00       	call   80267e <__udivdi3>
+  801ce4:	83 c4 18             	add    $0x18,%esp
+  801ce7:	52                   	push   %edx
+  801ce8:	50                   	push   %eax
+  801ce9:	89 f2                	mov    %esi,%edx
+  801ceb:	89 f8                	mov    %edi,%eax
+  801ced:	e8 9f ff ff ff       	call   801c91 <printnum>
+  801cf2:	83 c4 20             	add    $0x20,%esp
+  801cf5:	eb 13                	jmp    801d0a <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  801cf7:	83 ec 08             	sub    $0x8,%esp
+  801cfa:	56                   	push   %esi
+  801cfb:	ff 75 18             	push   0x18(%ebp)
+  801cfe:	ff d7                	call   *%edi
+  801d00:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  801d03:	83 eb 01             	sub    $0x1,%ebx
+  801d06:	85 db                	test   %ebx,%ebx
+  801d08:	7f ed                	jg     801cf7 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  801d0a:	83 ec 08             	sub    $0x8,%esp
+  801d0d:	56                   	push   %esi
+  801d0e:	83 ec 04             	sub    $0x4,%esp
+  801d11:	ff 75 e4             	push   -0x1c(%ebp)
+  801d14:	ff 75 e0             	push   -0x20(%ebp)
+  801d17:	ff 75 dc             	push   -0x24(%ebp)
+  801d1a:	ff 75 d8             	push   -0x28(%ebp)
+  801d1d:	e8 7a 09 00 00       	call   80269c <__umoddi3>
+  801d22:	83 c4 14             	add    $0x14,%esp
+  801d25:	0f be 80 1d 28 80 00 	movsbl 0x80281d(%eax),%eax
+  801d2c:	50                   	push   %eax
+  801d2d:	ff d7                	call   *%edi
+}
+  801d2f:	83 c4 10             	add    $0x10,%esp
+  801d32:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d35:	5b                   	pop    %ebx
+  801d36:	5e                   	pop    %esi
+  801d37:	5f                   	pop    %edi
+  801d38:	5d                   	pop    %ebp
+  801d39:	c3                   	ret
+
+00801d3a <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801d3a:	55                   	push   %ebp
+  801d3b:	89 e5                	mov    %esp,%ebp
+  801d3d:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  801d40:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  801d44:	8b 10                	mov    (%eax),%edx
+  801d46:	3b 50 04             	cmp    0x4(%eax),%edx
+  801d49:	73 0a                	jae    801d55 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  801d4b:	8d 4a 01             	lea    0x1(%edx),%ecx
+  801d4e:	89 08                	mov    %ecx,(%eax)
+  801d50:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d53:	88 02                	mov    %al,(%edx)
+}
+  801d55:	5d                   	pop    %ebp
+  801d56:	c3                   	ret
+
+00801d57 <printfmt>:
+{
+  801d57:	55                   	push   %ebp
+  801d58:	89 e5                	mov    %esp,%ebp
+  801d5a:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  801d5d:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  801d60:	50                   	push   %eax
+  801d61:	ff 75 10             	push   0x10(%ebp)
+  801d64:	ff 75 0c             	push   0xc(%ebp)
+  801d67:	ff 75 08             	push   0x8(%ebp)
+  801d6a:	e8 05 00 00 00       	call   801d74 <vprintfmt>
+}
+  801d6f:	83 c4 10             	add    $0x10,%esp
+  801d72:	c9                   	leave
+  801d73:	c3                   	ret
+
+00801d74 <vprintfmt>:
+{
+  801d74:	55                   	push   %ebp
+  801d75:	89 e5                	mov    %esp,%ebp
+  801d77:	57                   	push   %edi
+  801d78:	56                   	push   %esi
+  801d79:	53                   	push   %ebx
+  801d7a:	83 ec 2c             	sub    $0x2c,%esp
+  801d7d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d80:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801d83:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801d86:	eb 0a                	jmp    801d92 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  801d88:	83 ec 08             	sub    $0x8,%esp
+  801d8b:	53                   	push   %ebx
+  801d8c:	50                   	push   %eax
+  801d8d:	ff d6                	call   *%esi
+  801d8f:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801d92:	83 c7 01             	add    $0x1,%edi
+  801d95:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801d99:	83 f8 25             	cmp    $0x25,%eax
+  801d9c:	74 0c                	je     801daa <vprintfmt+0x36>
+			if (ch == '\0')
+  801d9e:	85 c0                	test   %eax,%eax
+  801da0:	75 e6                	jne    801d88 <vprintfmt+0x14>
+}
+  801da2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801da5:	5b                   	pop    %ebx
+  801da6:	5e                   	pop    %esi
+  801da7:	5f                   	pop    %edi
+  801da8:	5d                   	pop    %ebp
+  801da9:	c3                   	ret
+		padc = ' ';
+  801daa:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801dae:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  801db5:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801dbc:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  801dc3:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801dc8:	8d 47 01             	lea    0x1(%edi),%eax
+  801dcb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801dce:	0f b6 17             	movzbl (%edi),%edx
+  801dd1:	8d 42 dd             	lea    -0x23(%edx),%eax
+  801dd4:	3c 55                	cmp    $0x55,%al
+  801dd6:	0f 87 cf 03 00 00    	ja     8021ab <vprintfmt+0x437>
+  801ddc:	0f b6 c0             	movzbl %al,%eax
+  801ddf:	ff 24 85 00 29 80 00 	jmp    *0x802900(,%eax,4)
+  801de6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801de9:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801ded:	eb d9                	jmp    801dc8 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801def:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801df2:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  801df6:	eb d0                	jmp    801dc8 <vprintfmt+0x54>
+  801df8:	0f b6 d2             	movzbl %dl,%edx
+  801dfb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  801dfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e03:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  801e06:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801e09:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  801e0d:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  801e10:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  801e13:	83 f9 09             	cmp    $0x9,%ecx
+  801e16:	77 55                	ja     801e6d <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  801e18:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  801e1b:	eb e9                	jmp    801e06 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  801e1d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e20:	8b 00                	mov    (%eax),%eax
+  801e22:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801e25:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e28:	8d 40 04             	lea    0x4(%eax),%eax
+  801e2b:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801e2e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  801e31:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801e35:	79 91                	jns    801dc8 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  801e37:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801e3a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801e3d:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  801e44:	eb 82                	jmp    801dc8 <vprintfmt+0x54>
+			if (width < 0)
+  801e46:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801e49:	85 d2                	test   %edx,%edx
+  801e4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e50:	0f 49 c2             	cmovns %edx,%eax
+  801e53:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801e56:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801e59:	e9 6a ff ff ff       	jmp    801dc8 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801e5e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  801e61:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  801e68:	e9 5b ff ff ff       	jmp    801dc8 <vprintfmt+0x54>
+  801e6d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801e70:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801e73:	eb bc                	jmp    801e31 <vprintfmt+0xbd>
+			lflag++;
+  801e75:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801e78:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801e7b:	e9 48 ff ff ff       	jmp    801dc8 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  801e80:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e83:	8d 78 04             	lea    0x4(%eax),%edi
+  801e86:	83 ec 08             	sub    $0x8,%esp
+  801e89:	53                   	push   %ebx
+  801e8a:	ff 30                	push   (%eax)
+  801e8c:	ff d6                	call   *%esi
+			break;
+  801e8e:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801e91:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  801e94:	e9 b1 02 00 00       	jmp    80214a <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  801e99:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e9c:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801e9f:	8b 10                	mov    (%eax),%edx
+  801ea1:	89 d0                	mov    %edx,%eax
+  801ea3:	f7 d8                	neg    %eax
+  801ea5:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801ea8:	83 f8 0d             	cmp    $0xd,%eax
+  801eab:	7f 23                	jg     801ed0 <vprintfmt+0x15c>
+  801ead:	8b 14 85 60 2a 80 00 	mov    0x802a60(,%eax,4),%edx
+  801eb4:	85 d2                	test   %edx,%edx
+  801eb6:	74 18                	je     801ed0 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801eb8:	52                   	push   %edx
+  801eb9:	68 3e 28 80 00       	push   $0x80283e
+  801ebe:	53                   	push   %ebx
+  801ebf:	56                   	push   %esi
+  801ec0:	e8 92 fe ff ff       	call   801d57 <printfmt>
+  801ec5:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801ec8:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801ecb:	e9 7a 02 00 00       	jmp    80214a <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  801ed0:	50                   	push   %eax
+  801ed1:	68 35 28 80 00       	push   $0x802835
+  801ed6:	53                   	push   %ebx
+  801ed7:	56                   	push   %esi
+  801ed8:	e8 7a fe ff ff       	call   801d57 <printfmt>
+  801edd:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801ee0:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801ee3:	e9 62 02 00 00       	jmp    80214a <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801ee8:	8b 45 14             	mov    0x14(%ebp),%eax
+  801eeb:	83 c0 04             	add    $0x4,%eax
+  801eee:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801ef1:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ef4:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801ef6:	85 c9                	test   %ecx,%ecx
+  801ef8:	b8 2e 28 80 00       	mov    $0x80282e,%eax
+  801efd:	0f 45 c1             	cmovne %ecx,%eax
+  801f00:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801f03:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801f07:	7e 06                	jle    801f0f <vprintfmt+0x19b>
+  801f09:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801f0d:	75 0b                	jne    801f1a <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f0f:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801f12:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801f15:	89 75 08             	mov    %esi,0x8(%ebp)
+  801f18:	eb 5c                	jmp    801f76 <vprintfmt+0x202>
+  801f1a:	83 ec 08             	sub    $0x8,%esp
+  801f1d:	ff 75 d0             	push   -0x30(%ebp)
+  801f20:	ff 75 cc             	push   -0x34(%ebp)
+  801f23:	e8 20 03 00 00       	call   802248 <strnlen>
+  801f28:	89 c2                	mov    %eax,%edx
+  801f2a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f2d:	29 d0                	sub    %edx,%eax
+  801f2f:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801f32:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  801f36:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801f39:	89 75 08             	mov    %esi,0x8(%ebp)
+  801f3c:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f3e:	eb 0e                	jmp    801f4e <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801f40:	83 ec 08             	sub    $0x8,%esp
+  801f43:	53                   	push   %ebx
+  801f44:	57                   	push   %edi
+  801f45:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f48:	83 ee 01             	sub    $0x1,%esi
+  801f4b:	83 c4 10             	add    $0x10,%esp
+  801f4e:	85 f6                	test   %esi,%esi
+  801f50:	7f ee                	jg     801f40 <vprintfmt+0x1cc>
+  801f52:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f55:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f58:	85 c0                	test   %eax,%eax
+  801f5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f5f:	0f 49 d0             	cmovns %eax,%edx
+  801f62:	29 d0                	sub    %edx,%eax
+  801f64:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801f67:	eb a6                	jmp    801f0f <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801f69:	83 ec 08             	sub    $0x8,%esp
+  801f6c:	53                   	push   %ebx
+  801f6d:	52                   	push   %edx
+  801f6e:	ff 55 08             	call   *0x8(%ebp)
+  801f71:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801f74:	89 f1                	mov    %esi,%ecx
+  801f76:	8d 71 01             	lea    0x1(%ecx),%esi
+  801f79:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801f7d:	0f be d0             	movsbl %al,%edx
+  801f80:	85 d2                	test   %edx,%edx
+  801f82:	74 28                	je     801fac <vprintfmt+0x238>
+  801f84:	85 ff                	test   %edi,%edi
+  801f86:	78 05                	js     801f8d <vprintfmt+0x219>
+  801f88:	83 ef 01             	sub    $0x1,%edi
+  801f8b:	78 30                	js     801fbd <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801f8d:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801f91:	74 d6                	je     801f69 <vprintfmt+0x1f5>
+  801f93:	0f be c0             	movsbl %al,%eax
+  801f96:	83 e8 20             	sub    $0x20,%eax
+  801f99:	83 f8 5e             	cmp    $0x5e,%eax
+  801f9c:	76 cb                	jbe    801f69 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801f9e:	83 ec 08             	sub    $0x8,%esp
+  801fa1:	53                   	push   %ebx
+  801fa2:	6a 3f                	push   $0x3f
+  801fa4:	ff 55 08             	call   *0x8(%ebp)
+  801fa7:	83 c4 10             	add    $0x10,%esp
+  801faa:	eb c8                	jmp    801f74 <vprintfmt+0x200>
+  801fac:	8b 75 08             	mov    0x8(%ebp),%esi
+  801faf:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801fb2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801fb5:	01 d0                	add    %edx,%eax
+  801fb7:	29 c8                	sub    %ecx,%eax
+  801fb9:	89 c7                	mov    %eax,%edi
+  801fbb:	eb 13                	jmp    801fd0 <vprintfmt+0x25c>
+  801fbd:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fc0:	eb ed                	jmp    801faf <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801fc2:	83 ec 08             	sub    $0x8,%esp
+  801fc5:	53                   	push   %ebx
+  801fc6:	6a 20                	push   $0x20
+  801fc8:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801fca:	83 ef 01             	sub    $0x1,%edi
+  801fcd:	83 c4 10             	add    $0x10,%esp
+  801fd0:	85 ff                	test   %edi,%edi
+  801fd2:	7f ee                	jg     801fc2 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801fd4:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801fd7:	89 45 14             	mov    %eax,0x14(%ebp)
+  801fda:	e9 6b 01 00 00       	jmp    80214a <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  801fdf:	83 f9 01             	cmp    $0x1,%ecx
+  801fe2:	7f 1f                	jg     802003 <vprintfmt+0x28f>
+	else if (lflag)
+  801fe4:	85 c9                	test   %ecx,%ecx
+  801fe6:	74 67                	je     80204f <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  801fe8:	8b 45 14             	mov    0x14(%ebp),%eax
+  801feb:	8b 00                	mov    (%eax),%eax
+  801fed:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801ff0:	89 c1                	mov    %eax,%ecx
+  801ff2:	c1 f9 1f             	sar    $0x1f,%ecx
+  801ff5:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801ff8:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ffb:	8d 40 04             	lea    0x4(%eax),%eax
+  801ffe:	89 45 14             	mov    %eax,0x14(%ebp)
+  802001:	eb 17                	jmp    80201a <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  802003:	8b 45 14             	mov    0x14(%ebp),%eax
+  802006:	8b 50 04             	mov    0x4(%eax),%edx
+  802009:	8b 00                	mov    (%eax),%eax
+  80200b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80200e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802011:	8b 45 14             	mov    0x14(%ebp),%eax
+  802014:	8d 40 08             	lea    0x8(%eax),%eax
+  802017:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80201a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80201d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  802020:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  802025:	85 c9                	test   %ecx,%ecx
+  802027:	0f 89 03 01 00 00    	jns    802130 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  80202d:	83 ec 08             	sub    $0x8,%esp
+  802030:	53                   	push   %ebx
+  802031:	6a 2d                	push   $0x2d
+  802033:	ff d6                	call   *%esi
+				num = -(long long) num;
+  802035:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802038:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80203b:	f7 da                	neg    %edx
+  80203d:	83 d1 00             	adc    $0x0,%ecx
+  802040:	f7 d9                	neg    %ecx
+  802042:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  802045:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80204a:	e9 e1 00 00 00       	jmp    802130 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80204f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802052:	8b 00                	mov    (%eax),%eax
+  802054:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802057:	89 c1                	mov    %eax,%ecx
+  802059:	c1 f9 1f             	sar    $0x1f,%ecx
+  80205c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80205f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802062:	8d 40 04             	lea    0x4(%eax),%eax
+  802065:	89 45 14             	mov    %eax,0x14(%ebp)
+  802068:	eb b0                	jmp    80201a <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80206a:	83 f9 01             	cmp    $0x1,%ecx
+  80206d:	7f 1e                	jg     80208d <vprintfmt+0x319>
+	else if (lflag)
+  80206f:	85 c9                	test   %ecx,%ecx
+  802071:	74 32                	je     8020a5 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  802073:	8b 45 14             	mov    0x14(%ebp),%eax
+  802076:	8b 10                	mov    (%eax),%edx
+  802078:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80207d:	8d 40 04             	lea    0x4(%eax),%eax
+  802080:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802083:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  802088:	e9 a3 00 00 00       	jmp    802130 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80208d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802090:	8b 10                	mov    (%eax),%edx
+  802092:	8b 48 04             	mov    0x4(%eax),%ecx
+  802095:	8d 40 08             	lea    0x8(%eax),%eax
+  802098:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80209b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8020a0:	e9 8b 00 00 00       	jmp    802130 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8020a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020a8:	8b 10                	mov    (%eax),%edx
+  8020aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020af:	8d 40 04             	lea    0x4(%eax),%eax
+  8020b2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8020b5:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8020ba:	eb 74                	jmp    802130 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8020bc:	83 f9 01             	cmp    $0x1,%ecx
+  8020bf:	7f 1b                	jg     8020dc <vprintfmt+0x368>
+	else if (lflag)
+  8020c1:	85 c9                	test   %ecx,%ecx
+  8020c3:	74 2c                	je     8020f1 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8020c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020c8:	8b 10                	mov    (%eax),%edx
+  8020ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020cf:	8d 40 04             	lea    0x4(%eax),%eax
+  8020d2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8020d5:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8020da:	eb 54                	jmp    802130 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8020dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020df:	8b 10                	mov    (%eax),%edx
+  8020e1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8020e4:	8d 40 08             	lea    0x8(%eax),%eax
+  8020e7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8020ea:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8020ef:	eb 3f                	jmp    802130 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8020f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020f4:	8b 10                	mov    (%eax),%edx
+  8020f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020fb:	8d 40 04             	lea    0x4(%eax),%eax
+  8020fe:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802101:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  802106:	eb 28                	jmp    802130 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  802108:	83 ec 08             	sub    $0x8,%esp
+  80210b:	53                   	push   %ebx
+  80210c:	6a 30                	push   $0x30
+  80210e:	ff d6                	call   *%esi
+			putch('x', putdat);
+  802110:	83 c4 08             	add    $0x8,%esp
+  802113:	53                   	push   %ebx
+  802114:	6a 78                	push   $0x78
+  802116:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  802118:	8b 45 14             	mov    0x14(%ebp),%eax
+  80211b:	8b 10                	mov    (%eax),%edx
+  80211d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  802122:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  802125:	8d 40 04             	lea    0x4(%eax),%eax
+  802128:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80212b:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  802130:	83 ec 0c             	sub    $0xc,%esp
+  802133:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  802137:	50                   	push   %eax
+  802138:	ff 75 e0             	push   -0x20(%ebp)
+  80213b:	57                   	push   %edi
+  80213c:	51                   	push   %ecx
+  80213d:	52                   	push   %edx
+  80213e:	89 da                	mov    %ebx,%edx
+  802140:	89 f0                	mov    %esi,%eax
+  802142:	e8 4a fb ff ff       	call   801c91 <printnum>
+			break;
+  802147:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80214a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80214d:	e9 40 fc ff ff       	jmp    801d92 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  802152:	83 f9 01             	cmp    $0x1,%ecx
+  802155:	7f 1b                	jg     802172 <vprintfmt+0x3fe>
+	else if (lflag)
+  802157:	85 c9                	test   %ecx,%ecx
+  802159:	74 2c                	je     802187 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  80215b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80215e:	8b 10                	mov    (%eax),%edx
+  802160:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802165:	8d 40 04             	lea    0x4(%eax),%eax
+  802168:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80216b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  802170:	eb be                	jmp    802130 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802172:	8b 45 14             	mov    0x14(%ebp),%eax
+  802175:	8b 10                	mov    (%eax),%edx
+  802177:	8b 48 04             	mov    0x4(%eax),%ecx
+  80217a:	8d 40 08             	lea    0x8(%eax),%eax
+  80217d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802180:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  802185:	eb a9                	jmp    802130 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802187:	8b 45 14             	mov    0x14(%ebp),%eax
+  80218a:	8b 10                	mov    (%eax),%edx
+  80218c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802191:	8d 40 04             	lea    0x4(%eax),%eax
+  802194:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802197:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80219c:	eb 92                	jmp    802130 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  80219e:	83 ec 08             	sub    $0x8,%esp
+  8021a1:	53                   	push   %ebx
+  8021a2:	6a 25                	push   $0x25
+  8021a4:	ff d6                	call   *%esi
+			break;
+  8021a6:	83 c4 10             	add    $0x10,%esp
+  8021a9:	eb 9f                	jmp    80214a <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8021ab:	83 ec 08             	sub    $0x8,%esp
+  8021ae:	53                   	push   %ebx
+  8021af:	6a 25                	push   $0x25
+  8021b1:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8021b3:	83 c4 10             	add    $0x10,%esp
+  8021b6:	89 f8                	mov    %edi,%eax
+  8021b8:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8021bc:	74 05                	je     8021c3 <vprintfmt+0x44f>
+  8021be:	83 e8 01             	sub    $0x1,%eax
+  8021c1:	eb f5                	jmp    8021b8 <vprintfmt+0x444>
+  8021c3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8021c6:	eb 82                	jmp    80214a <vprintfmt+0x3d6>
+
+008021c8 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8021c8:	55                   	push   %ebp
+  8021c9:	89 e5                	mov    %esp,%ebp
+  8021cb:	83 ec 18             	sub    $0x18,%esp
+  8021ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8021d4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8021d7:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8021db:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8021de:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8021e5:	85 c0                	test   %eax,%eax
+  8021e7:	74 26                	je     80220f <vsnprintf+0x47>
+  8021e9:	85 d2                	test   %edx,%edx
+  8021eb:	7e 22                	jle    80220f <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8021ed:	ff 75 14             	push   0x14(%ebp)
+  8021f0:	ff 75 10             	push   0x10(%ebp)
+  8021f3:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8021f6:	50                   	push   %eax
+  8021f7:	68 3a 1d 80 00       	push   $0x801d3a
+  8021fc:	e8 73 fb ff ff       	call   801d74 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  802201:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802204:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  802207:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80220a:	83 c4 10             	add    $0x10,%esp
+}
+  80220d:	c9                   	leave
+  80220e:	c3                   	ret
+		return -E_INVAL;
+  80220f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802214:	eb f7                	jmp    80220d <vsnprintf+0x45>
+
+00802216 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  802216:	55                   	push   %ebp
+  802217:	89 e5                	mov    %esp,%ebp
+  802219:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80221c:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80221f:	50                   	push   %eax
+  802220:	ff 75 10             	push   0x10(%ebp)
+  802223:	ff 75 0c             	push   0xc(%ebp)
+  802226:	ff 75 08             	push   0x8(%ebp)
+  802229:	e8 9a ff ff ff       	call   8021c8 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80222e:	c9                   	leave
+  80222f:	c3                   	ret
+
+00802230 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  802230:	55                   	push   %ebp
+  802231:	89 e5                	mov    %esp,%ebp
+  802233:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  802236:	b8 00 00 00 00       	mov    $0x0,%eax
+  80223b:	eb 03                	jmp    802240 <strlen+0x10>
+		n++;
+  80223d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  802240:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802244:	75 f7                	jne    80223d <strlen+0xd>
+	return n;
+}
+  802246:	5d                   	pop    %ebp
+  802247:	c3                   	ret
+
+00802248 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  802248:	55                   	push   %ebp
+  802249:	89 e5                	mov    %esp,%ebp
+  80224b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80224e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802251:	b8 00 00 00 00       	mov    $0x0,%eax
+  802256:	eb 03                	jmp    80225b <strnlen+0x13>
+		n++;
+  802258:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80225b:	39 d0                	cmp    %edx,%eax
+  80225d:	74 08                	je     802267 <strnlen+0x1f>
+  80225f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802263:	75 f3                	jne    802258 <strnlen+0x10>
+  802265:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  802267:	89 d0                	mov    %edx,%eax
+  802269:	5d                   	pop    %ebp
+  80226a:	c3                   	ret
+
+0080226b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80226b:	55                   	push   %ebp
+  80226c:	89 e5                	mov    %esp,%ebp
+  80226e:	53                   	push   %ebx
+  80226f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802272:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  802275:	b8 00 00 00 00       	mov    $0x0,%eax
+  80227a:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80227e:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  802281:	83 c0 01             	add    $0x1,%eax
+  802284:	84 d2                	test   %dl,%dl
+  802286:	75 f2                	jne    80227a <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  802288:	89 c8                	mov    %ecx,%eax
+  80228a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80228d:	c9                   	leave
+  80228e:	c3                   	ret
+
+0080228f <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80228f:	55                   	push   %ebp
+  802290:	89 e5                	mov    %esp,%ebp
+  802292:	53                   	push   %ebx
+  802293:	83 ec 10             	sub    $0x10,%esp
+  802296:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  802299:	53                   	push   %ebx
+  80229a:	e8 91 ff ff ff       	call   802230 <strlen>
+  80229f:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8022a2:	ff 75 0c             	push   0xc(%ebp)
+  8022a5:	01 d8                	add    %ebx,%eax
+  8022a7:	50                   	push   %eax
+  8022a8:	e8 be ff ff ff       	call   80226b <strcpy>
+	return dst;
+}
+  8022ad:	89 d8                	mov    %ebx,%eax
+  8022af:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022b2:	c9                   	leave
+  8022b3:	c3                   	ret
+
+008022b4 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8022b4:	55                   	push   %ebp
+  8022b5:	89 e5                	mov    %esp,%ebp
+  8022b7:	56                   	push   %esi
+  8022b8:	53                   	push   %ebx
+  8022b9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8022bc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8022bf:	89 f3                	mov    %esi,%ebx
+  8022c1:	03 5d 10             	add    0x10(%ebp),%ebx
+  8022c4:	89 f0                	mov    %esi,%eax
+  8022c6:	eb 0f                	jmp    8022d7 <strncpy+0x23>
+		*dst++ = *src;
+  8022c8:	83 c0 01             	add    $0x1,%eax
+  8022cb:	0f b6 0a             	movzbl (%edx),%ecx
+  8022ce:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8022d1:	80 f9 01             	cmp    $0x1,%cl
+  8022d4:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8022d7:	39 d8                	cmp    %ebx,%eax
+  8022d9:	75 ed                	jne    8022c8 <strncpy+0x14>
+	}
+	return ret;
+}
+  8022db:	89 f0                	mov    %esi,%eax
+  8022dd:	5b                   	pop    %ebx
+  8022de:	5e                   	pop    %esi
+  8022df:	5d                   	pop    %ebp
+  8022e0:	c3                   	ret
+
+008022e1 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8022e1:	55                   	push   %ebp
+  8022e2:	89 e5                	mov    %esp,%ebp
+  8022e4:	56                   	push   %esi
+  8022e5:	53                   	push   %ebx
+  8022e6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8022e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022ec:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8022ef:	89 f0                	mov    %esi,%eax
+  8022f1:	85 d2                	test   %edx,%edx
+  8022f3:	74 21                	je     802316 <strlcpy+0x35>
+  8022f5:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8022f9:	89 f2                	mov    %esi,%edx
+  8022fb:	eb 09                	jmp    802306 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8022fd:	83 c1 01             	add    $0x1,%ecx
+  802300:	83 c2 01             	add    $0x1,%edx
+  802303:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  802306:	39 c2                	cmp    %eax,%edx
+  802308:	74 09                	je     802313 <strlcpy+0x32>
+  80230a:	0f b6 19             	movzbl (%ecx),%ebx
+  80230d:	84 db                	test   %bl,%bl
+  80230f:	75 ec                	jne    8022fd <strlcpy+0x1c>
+  802311:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  802313:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  802316:	29 f0                	sub    %esi,%eax
+}
+  802318:	5b                   	pop    %ebx
+  802319:	5e                   	pop    %esi
+  80231a:	5d                   	pop    %ebp
+  80231b:	c3                   	ret
+
+0080231c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80231c:	55                   	push   %ebp
+  80231d:	89 e5                	mov    %esp,%ebp
+  80231f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802322:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  802325:	eb 06                	jmp    80232d <strcmp+0x11>
+		p++, q++;
+  802327:	83 c1 01             	add    $0x1,%ecx
+  80232a:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80232d:	0f b6 01             	movzbl (%ecx),%eax
+  802330:	84 c0                	test   %al,%al
+  802332:	74 04                	je     802338 <strcmp+0x1c>
+  802334:	3a 02                	cmp    (%edx),%al
+  802336:	74 ef                	je     802327 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  802338:	0f b6 c0             	movzbl %al,%eax
+  80233b:	0f b6 12             	movzbl (%edx),%edx
+  80233e:	29 d0                	sub    %edx,%eax
+}
+  802340:	5d                   	pop    %ebp
+  802341:	c3                   	ret
+
+00802342 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  802342:	55                   	push   %ebp
+  802343:	89 e5                	mov    %esp,%ebp
+  802345:	53                   	push   %ebx
+  802346:	8b 45 08             	mov    0x8(%ebp),%eax
+  802349:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80234c:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80234f:	eb 09                	jmp    80235a <strncmp+0x18>
+		n--, p++, q++;
+  802351:	83 ea 01             	sub    $0x1,%edx
+  802354:	83 c0 01             	add    $0x1,%eax
+  802357:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80235a:	85 d2                	test   %edx,%edx
+  80235c:	74 18                	je     802376 <strncmp+0x34>
+  80235e:	0f b6 18             	movzbl (%eax),%ebx
+  802361:	84 db                	test   %bl,%bl
+  802363:	74 04                	je     802369 <strncmp+0x27>
+  802365:	3a 19                	cmp    (%ecx),%bl
+  802367:	74 e8                	je     802351 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  802369:	0f b6 00             	movzbl (%eax),%eax
+  80236c:	0f b6 11             	movzbl (%ecx),%edx
+  80236f:	29 d0                	sub    %edx,%eax
+}
+  802371:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802374:	c9                   	leave
+  802375:	c3                   	ret
+		return 0;
+  802376:	b8 00 00 00 00       	mov    $0x0,%eax
+  80237b:	eb f4                	jmp    802371 <strncmp+0x2f>
+
+0080237d <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80237d:	55                   	push   %ebp
+  80237e:	89 e5                	mov    %esp,%ebp
+  802380:	8b 45 08             	mov    0x8(%ebp),%eax
+  802383:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  802387:	eb 03                	jmp    80238c <strchr+0xf>
+  802389:	83 c0 01             	add    $0x1,%eax
+  80238c:	0f b6 10             	movzbl (%eax),%edx
+  80238f:	84 d2                	test   %dl,%dl
+  802391:	74 06                	je     802399 <strchr+0x1c>
+		if (*s == c)
+  802393:	38 ca                	cmp    %cl,%dl
+  802395:	75 f2                	jne    802389 <strchr+0xc>
+  802397:	eb 05                	jmp    80239e <strchr+0x21>
+			return (char *) s;
+	return 0;
+  802399:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80239e:	5d                   	pop    %ebp
+  80239f:	c3                   	ret
+
+008023a0 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8023a0:	55                   	push   %ebp
+  8023a1:	89 e5                	mov    %esp,%ebp
+  8023a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8023aa:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8023ad:	38 ca                	cmp    %cl,%dl
+  8023af:	74 09                	je     8023ba <strfind+0x1a>
+  8023b1:	84 d2                	test   %dl,%dl
+  8023b3:	74 05                	je     8023ba <strfind+0x1a>
+	for (; *s; s++)
+  8023b5:	83 c0 01             	add    $0x1,%eax
+  8023b8:	eb f0                	jmp    8023aa <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8023ba:	5d                   	pop    %ebp
+  8023bb:	c3                   	ret
+
+008023bc <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8023bc:	55                   	push   %ebp
+  8023bd:	89 e5                	mov    %esp,%ebp
+  8023bf:	57                   	push   %edi
+  8023c0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8023c3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8023c6:	85 c9                	test   %ecx,%ecx
+  8023c8:	74 20                	je     8023ea <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8023ca:	89 f8                	mov    %edi,%eax
+  8023cc:	09 c8                	or     %ecx,%eax
+  8023ce:	a8 03                	test   $0x3,%al
+  8023d0:	75 12                	jne    8023e4 <memset+0x28>
+		c &= 0xFF;
+  8023d2:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8023d6:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8023dc:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8023df:	fc                   	cld
+  8023e0:	f3 ab                	rep stos %eax,%es:(%edi)
+  8023e2:	eb 06                	jmp    8023ea <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8023e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023e7:	fc                   	cld
+  8023e8:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8023ea:	89 f8                	mov    %edi,%eax
+  8023ec:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8023ef:	c9                   	leave
+  8023f0:	c3                   	ret
+
+008023f1 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8023f1:	55                   	push   %ebp
+  8023f2:	89 e5                	mov    %esp,%ebp
+  8023f4:	57                   	push   %edi
+  8023f5:	56                   	push   %esi
+  8023f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8023fc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8023ff:	39 c6                	cmp    %eax,%esi
+  802401:	73 32                	jae    802435 <memmove+0x44>
+  802403:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  802406:	39 d0                	cmp    %edx,%eax
+  802408:	73 2b                	jae    802435 <memmove+0x44>
+		s += n;
+		d += n;
+  80240a:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80240d:	89 d6                	mov    %edx,%esi
+  80240f:	09 fe                	or     %edi,%esi
+  802411:	09 ce                	or     %ecx,%esi
+  802413:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  802419:	75 0e                	jne    802429 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80241b:	83 ef 04             	sub    $0x4,%edi
+  80241e:	8d 72 fc             	lea    -0x4(%edx),%esi
+  802421:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  802424:	fd                   	std
+  802425:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802427:	eb 09                	jmp    802432 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  802429:	83 ef 01             	sub    $0x1,%edi
+  80242c:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80242f:	fd                   	std
+  802430:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  802432:	fc                   	cld
+  802433:	eb 1a                	jmp    80244f <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802435:	89 f2                	mov    %esi,%edx
+  802437:	09 c2                	or     %eax,%edx
+  802439:	09 ca                	or     %ecx,%edx
+  80243b:	f6 c2 03             	test   $0x3,%dl
+  80243e:	75 0a                	jne    80244a <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  802440:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  802443:	89 c7                	mov    %eax,%edi
+  802445:	fc                   	cld
+  802446:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802448:	eb 05                	jmp    80244f <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80244a:	89 c7                	mov    %eax,%edi
+  80244c:	fc                   	cld
+  80244d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80244f:	5e                   	pop    %esi
+  802450:	5f                   	pop    %edi
+  802451:	5d                   	pop    %ebp
+  802452:	c3                   	ret
+
+00802453 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  802453:	55                   	push   %ebp
+  802454:	89 e5                	mov    %esp,%ebp
+  802456:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  802459:	ff 75 10             	push   0x10(%ebp)
+  80245c:	ff 75 0c             	push   0xc(%ebp)
+  80245f:	ff 75 08             	push   0x8(%ebp)
+  802462:	e8 8a ff ff ff       	call   8023f1 <memmove>
+}
+  802467:	c9                   	leave
+  802468:	c3                   	ret
+
+00802469 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  802469:	55                   	push   %ebp
+  80246a:	89 e5                	mov    %esp,%ebp
+  80246c:	56                   	push   %esi
+  80246d:	53                   	push   %ebx
+  80246e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802471:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  802474:	89 c6                	mov    %eax,%esi
+  802476:	03 75 10             	add    0x10(%ebp),%esi
+  802479:	eb 06                	jmp    802481 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  80247b:	83 c0 01             	add    $0x1,%eax
+  80247e:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  802481:	39 f0                	cmp    %esi,%eax
+  802483:	74 14                	je     802499 <memcmp+0x30>
+		if (*s1 != *s2)
+  802485:	0f b6 08             	movzbl (%eax),%ecx
+  802488:	0f b6 1a             	movzbl (%edx),%ebx
+  80248b:	38 d9                	cmp    %bl,%cl
+  80248d:	74 ec                	je     80247b <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  80248f:	0f b6 c1             	movzbl %cl,%eax
+  802492:	0f b6 db             	movzbl %bl,%ebx
+  802495:	29 d8                	sub    %ebx,%eax
+  802497:	eb 05                	jmp    80249e <memcmp+0x35>
+	}
+
+	return 0;
+  802499:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80249e:	5b                   	pop    %ebx
+  80249f:	5e                   	pop    %esi
+  8024a0:	5d                   	pop    %ebp
+  8024a1:	c3                   	ret
+
+008024a2 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8024a2:	55                   	push   %ebp
+  8024a3:	89 e5                	mov    %esp,%ebp
+  8024a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8024ab:	89 c2                	mov    %eax,%edx
+  8024ad:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8024b0:	eb 03                	jmp    8024b5 <memfind+0x13>
+  8024b2:	83 c0 01             	add    $0x1,%eax
+  8024b5:	39 d0                	cmp    %edx,%eax
+  8024b7:	73 04                	jae    8024bd <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8024b9:	38 08                	cmp    %cl,(%eax)
+  8024bb:	75 f5                	jne    8024b2 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8024bd:	5d                   	pop    %ebp
+  8024be:	c3                   	ret
+
+008024bf <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8024bf:	55                   	push   %ebp
+  8024c0:	89 e5                	mov    %esp,%ebp
+  8024c2:	57                   	push   %edi
+  8024c3:	56                   	push   %esi
+  8024c4:	53                   	push   %ebx
+  8024c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024c8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8024cb:	eb 03                	jmp    8024d0 <strtol+0x11>
+		s++;
+  8024cd:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8024d0:	0f b6 02             	movzbl (%edx),%eax
+  8024d3:	3c 20                	cmp    $0x20,%al
+  8024d5:	74 f6                	je     8024cd <strtol+0xe>
+  8024d7:	3c 09                	cmp    $0x9,%al
+  8024d9:	74 f2                	je     8024cd <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8024db:	3c 2b                	cmp    $0x2b,%al
+  8024dd:	74 2a                	je     802509 <strtol+0x4a>
+	int neg = 0;
+  8024df:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8024e4:	3c 2d                	cmp    $0x2d,%al
+  8024e6:	74 2b                	je     802513 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8024e8:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8024ee:	75 0f                	jne    8024ff <strtol+0x40>
+  8024f0:	80 3a 30             	cmpb   $0x30,(%edx)
+  8024f3:	74 28                	je     80251d <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8024f5:	85 db                	test   %ebx,%ebx
+  8024f7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8024fc:	0f 44 d8             	cmove  %eax,%ebx
+  8024ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802504:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802507:	eb 46                	jmp    80254f <strtol+0x90>
+		s++;
+  802509:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  80250c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802511:	eb d5                	jmp    8024e8 <strtol+0x29>
+		s++, neg = 1;
+  802513:	83 c2 01             	add    $0x1,%edx
+  802516:	bf 01 00 00 00       	mov    $0x1,%edi
+  80251b:	eb cb                	jmp    8024e8 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80251d:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802521:	74 0e                	je     802531 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  802523:	85 db                	test   %ebx,%ebx
+  802525:	75 d8                	jne    8024ff <strtol+0x40>
+		s++, base = 8;
+  802527:	83 c2 01             	add    $0x1,%edx
+  80252a:	bb 08 00 00 00       	mov    $0x8,%ebx
+  80252f:	eb ce                	jmp    8024ff <strtol+0x40>
+		s += 2, base = 16;
+  802531:	83 c2 02             	add    $0x2,%edx
+  802534:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802539:	eb c4                	jmp    8024ff <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  80253b:	0f be c0             	movsbl %al,%eax
+  80253e:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  802541:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802544:	7d 3a                	jge    802580 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  802546:	83 c2 01             	add    $0x1,%edx
+  802549:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  80254d:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  80254f:	0f b6 02             	movzbl (%edx),%eax
+  802552:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802555:	89 f3                	mov    %esi,%ebx
+  802557:	80 fb 09             	cmp    $0x9,%bl
+  80255a:	76 df                	jbe    80253b <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  80255c:	8d 70 9f             	lea    -0x61(%eax),%esi
+  80255f:	89 f3                	mov    %esi,%ebx
+  802561:	80 fb 19             	cmp    $0x19,%bl
+  802564:	77 08                	ja     80256e <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  802566:	0f be c0             	movsbl %al,%eax
+  802569:	83 e8 57             	sub    $0x57,%eax
+  80256c:	eb d3                	jmp    802541 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  80256e:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802571:	89 f3                	mov    %esi,%ebx
+  802573:	80 fb 19             	cmp    $0x19,%bl
+  802576:	77 08                	ja     802580 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  802578:	0f be c0             	movsbl %al,%eax
+  80257b:	83 e8 37             	sub    $0x37,%eax
+  80257e:	eb c1                	jmp    802541 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  802580:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802584:	74 05                	je     80258b <strtol+0xcc>
+		*endptr = (char *) s;
+  802586:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802589:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  80258b:	89 c8                	mov    %ecx,%eax
+  80258d:	f7 d8                	neg    %eax
+  80258f:	85 ff                	test   %edi,%edi
+  802591:	0f 45 c8             	cmovne %eax,%ecx
+}
+  802594:	89 c8                	mov    %ecx,%eax
+  802596:	5b                   	pop    %ebx
+  802597:	5e                   	pop    %esi
+  802598:	5f                   	pop    %edi
+  802599:	5d                   	pop    %ebp
+  80259a:	c3                   	ret
+
+0080259b <atoi>:
+
+int
+atoi(const char *s)
+{
+  80259b:	55                   	push   %ebp
+  80259c:	89 e5                	mov    %esp,%ebp
+  80259e:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  8025a1:	6a 0a                	push   $0xa
+  8025a3:	6a 00                	push   $0x0
+  8025a5:	ff 75 08             	push   0x8(%ebp)
+  8025a8:	e8 12 ff ff ff       	call   8024bf <strtol>
+}
+  8025ad:	c9                   	leave
+  8025ae:	c3                   	ret
+
+008025af <dm>:
+  8025af:	55                   	push   %ebp
+  8025b0:	57                   	push   %edi
+  8025b1:	56                   	push   %esi
+  8025b2:	53                   	push   %ebx
+  8025b3:	83 ec 24             	sub    $0x24,%esp
+  8025b6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8025ba:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8025be:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8025c2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8025c6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8025ca:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8025ce:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8025d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025dc:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025e1:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8025e8:	00 
+  8025e9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8025f0:	00 
+  8025f1:	89 fb                	mov    %edi,%ebx
+  8025f3:	eb 08                	jmp    8025fd <dm+0x4e>
+  8025f5:	83 e9 01             	sub    $0x1,%ecx
+  8025f8:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8025fb:	74 68                	je     802665 <dm+0xb6>
+  8025fd:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802601:	01 c0                	add    %eax,%eax
+  802603:	89 c6                	mov    %eax,%esi
+  802605:	89 d7                	mov    %edx,%edi
+  802607:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80260b:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80260f:	0f ad d0             	shrd   %cl,%edx,%eax
+  802612:	d3 ea                	shr    %cl,%edx
+  802614:	f6 c1 20             	test   $0x20,%cl
+  802617:	74 04                	je     80261d <dm+0x6e>
+  802619:	89 d0                	mov    %edx,%eax
+  80261b:	31 d2                	xor    %edx,%edx
+  80261d:	83 e0 01             	and    $0x1,%eax
+  802620:	89 04 24             	mov    %eax,(%esp)
+  802623:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80262a:	00 
+  80262b:	8b 04 24             	mov    (%esp),%eax
+  80262e:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802632:	09 f0                	or     %esi,%eax
+  802634:	09 fa                	or     %edi,%edx
+  802636:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80263a:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80263e:	39 f0                	cmp    %esi,%eax
+  802640:	89 d5                	mov    %edx,%ebp
+  802642:	19 fd                	sbb    %edi,%ebp
+  802644:	72 af                	jb     8025f5 <dm+0x46>
+  802646:	29 f0                	sub    %esi,%eax
+  802648:	19 fa                	sbb    %edi,%edx
+  80264a:	89 cf                	mov    %ecx,%edi
+  80264c:	c1 ef 05             	shr    $0x5,%edi
+  80264f:	83 e7 01             	and    $0x1,%edi
+  802652:	89 fe                	mov    %edi,%esi
+  802654:	83 f6 01             	xor    $0x1,%esi
+  802657:	d3 e6                	shl    %cl,%esi
+  802659:	d3 e7                	shl    %cl,%edi
+  80265b:	09 74 24 18          	or     %esi,0x18(%esp)
+  80265f:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802663:	eb 90                	jmp    8025f5 <dm+0x46>
+  802665:	85 db                	test   %ebx,%ebx
+  802667:	74 05                	je     80266e <dm+0xbf>
+  802669:	89 03                	mov    %eax,(%ebx)
+  80266b:	89 53 04             	mov    %edx,0x4(%ebx)
+  80266e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802672:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802676:	83 c4 24             	add    $0x24,%esp
+  802679:	5b                   	pop    %ebx
+  80267a:	5e                   	pop    %esi
+  80267b:	5f                   	pop    %edi
+  80267c:	5d                   	pop    %ebp
+  80267d:	c3                   	ret
+
+0080267e <__udivdi3>:
+  80267e:	83 ec 08             	sub    $0x8,%esp
+  802681:	6a 00                	push   $0x0
+  802683:	ff 74 24 1c          	push   0x1c(%esp)
+  802687:	ff 74 24 1c          	push   0x1c(%esp)
+  80268b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80268f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802693:	e8 17 ff ff ff       	call   8025af <dm>
+  802698:	83 c4 14             	add    $0x14,%esp
+  80269b:	c3                   	ret
+
+0080269c <__umoddi3>:
+  80269c:	83 ec 18             	sub    $0x18,%esp
+  80269f:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8026a3:	50                   	push   %eax
+  8026a4:	ff 74 24 2c          	push   0x2c(%esp)
+  8026a8:	ff 74 24 2c          	push   0x2c(%esp)
+  8026ac:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8026b0:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8026b4:	e8 f6 fe ff ff       	call   8025af <dm>
+  8026b9:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8026bd:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8026c1:	83 c4 24             	add    $0x24,%esp
+  8026c4:	c3                   	ret
+
+008026c5 <__divdi3>:
+  8026c5:	53                   	push   %ebx
+  8026c6:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8026ca:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026ce:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8026d2:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8026d6:	85 d2                	test   %edx,%edx
+  8026d8:	78 15                	js     8026ef <__divdi3+0x2a>
+  8026da:	85 db                	test   %ebx,%ebx
+  8026dc:	78 34                	js     802712 <__divdi3+0x4d>
+  8026de:	83 ec 04             	sub    $0x4,%esp
+  8026e1:	6a 00                	push   $0x0
+  8026e3:	53                   	push   %ebx
+  8026e4:	51                   	push   %ecx
+  8026e5:	e8 c5 fe ff ff       	call   8025af <dm>
+  8026ea:	83 c4 10             	add    $0x10,%esp
+  8026ed:	eb 21                	jmp    802710 <__divdi3+0x4b>
+  8026ef:	f7 d8                	neg    %eax
+  8026f1:	83 d2 00             	adc    $0x0,%edx
+  8026f4:	f7 da                	neg    %edx
+  8026f6:	85 db                	test   %ebx,%ebx
+  8026f8:	78 30                	js     80272a <__divdi3+0x65>
+  8026fa:	83 ec 04             	sub    $0x4,%esp
+  8026fd:	6a 00                	push   $0x0
+  8026ff:	53                   	push   %ebx
+  802700:	51                   	push   %ecx
+  802701:	e8 a9 fe ff ff       	call   8025af <dm>
+  802706:	83 c4 10             	add    $0x10,%esp
+  802709:	f7 d8                	neg    %eax
+  80270b:	83 d2 00             	adc    $0x0,%edx
+  80270e:	f7 da                	neg    %edx
+  802710:	5b                   	pop    %ebx
+  802711:	c3                   	ret
+  802712:	83 ec 04             	sub    $0x4,%esp
+  802715:	6a 00                	push   $0x0
+  802717:	f7 d9                	neg    %ecx
+  802719:	83 d3 00             	adc    $0x0,%ebx
+  80271c:	f7 db                	neg    %ebx
+  80271e:	53                   	push   %ebx
+  80271f:	51                   	push   %ecx
+  802720:	e8 8a fe ff ff       	call   8025af <dm>
+  802725:	83 c4 10             	add    $0x10,%esp
+  802728:	eb df                	jmp    802709 <__divdi3+0x44>
+  80272a:	83 ec 04             	sub    $0x4,%esp
+  80272d:	6a 00                	push   $0x0
+  80272f:	f7 d9                	neg    %ecx
+  802731:	83 d3 00             	adc    $0x0,%ebx
+  802734:	f7 db                	neg    %ebx
+  802736:	53                   	push   %ebx
+  802737:	51                   	push   %ecx
+  802738:	e8 72 fe ff ff       	call   8025af <dm>
+  80273d:	83 c4 10             	add    $0x10,%esp
+  802740:	eb ce                	jmp    802710 <__divdi3+0x4b>
+
+00802742 <__moddi3>:
+  802742:	55                   	push   %ebp
+  802743:	57                   	push   %edi
+  802744:	56                   	push   %esi
+  802745:	53                   	push   %ebx
+  802746:	83 ec 18             	sub    $0x18,%esp
+  802749:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  80274d:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802751:	89 f1                	mov    %esi,%ecx
+  802753:	f7 d9                	neg    %ecx
+  802755:	89 da                	mov    %ebx,%edx
+  802757:	83 d2 00             	adc    $0x0,%edx
+  80275a:	f7 da                	neg    %edx
+  80275c:	0f 48 ce             	cmovs  %esi,%ecx
+  80275f:	0f 48 d3             	cmovs  %ebx,%edx
+  802762:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802766:	50                   	push   %eax
+  802767:	8b 74 24 38          	mov    0x38(%esp),%esi
+  80276b:	f7 de                	neg    %esi
+  80276d:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802771:	83 d0 00             	adc    $0x0,%eax
+  802774:	f7 d8                	neg    %eax
+  802776:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  80277b:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802780:	50                   	push   %eax
+  802781:	56                   	push   %esi
+  802782:	89 c8                	mov    %ecx,%eax
+  802784:	e8 26 fe ff ff       	call   8025af <dm>
+  802789:	83 c4 10             	add    $0x10,%esp
+  80278c:	85 db                	test   %ebx,%ebx
+  80278e:	78 10                	js     8027a0 <__moddi3+0x5e>
+  802790:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802794:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802798:	83 c4 14             	add    $0x14,%esp
+  80279b:	5b                   	pop    %ebx
+  80279c:	5e                   	pop    %esi
+  80279d:	5f                   	pop    %edi
+  80279e:	5d                   	pop    %ebp
+  80279f:	c3                   	ret
+  8027a0:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8027a4:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8027a8:	f7 d8                	neg    %eax
+  8027aa:	83 d2 00             	adc    $0x0,%edx
+  8027ad:	f7 da                	neg    %edx
+  8027af:	eb e7                	jmp    802798 <__moddi3+0x56>
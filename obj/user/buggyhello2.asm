@@ -0,0 +1,5039 @@
+
+obj/user/buggyhello2:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 1d 00 00 00       	call   80004e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+const char *hello = "hello, world\n";
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	sys_cputs(hello, 1024*1024);
+  800039:	68 00 00 10 00       	push   $0x100000
+  80003e:	ff 35 00 30 80 00    	push   0x803000
+  800044:	e8 b4 02 00 00       	call   8002fd <sys_cputs>
+}
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	56                   	push   %esi
+  800052:	53                   	push   %ebx
+  800053:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800056:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  800059:	e8 9d 04 00 00       	call   8004fb <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  80005e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800063:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  800069:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80006e:	a3 0c 30 80 00       	mov    %eax,0x80300c
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800073:	85 db                	test   %ebx,%ebx
+  800075:	7e 07                	jle    80007e <libmain+0x30>
+		binaryname = argv[0];
+  800077:	8b 06                	mov    (%esi),%eax
+  800079:	a3 04 30 80 00       	mov    %eax,0x803004
+
+	// call user main routine
+	umain(argc, argv);
+  80007e:	83 ec 08             	sub    $0x8,%esp
+  800081:	56                   	push   %esi
+  800082:	53                   	push   %ebx
+  800083:	e8 ab ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800088:	e8 0a 00 00 00       	call   800097 <exit>
+}
+  80008d:	83 c4 10             	add    $0x10,%esp
+  800090:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800093:	5b                   	pop    %ebx
+  800094:	5e                   	pop    %esi
+  800095:	5d                   	pop    %ebp
+  800096:	c3                   	ret
+
+00800097 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800097:	55                   	push   %ebp
+  800098:	89 e5                	mov    %esp,%ebp
+  80009a:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  80009d:	6a 00                	push   $0x0
+  80009f:	e8 95 03 00 00       	call   800439 <sys_env_destroy>
+}
+  8000a4:	83 c4 10             	add    $0x10,%esp
+  8000a7:	c9                   	leave
+  8000a8:	c3                   	ret
+
+008000a9 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  8000a9:	55                   	push   %ebp
+  8000aa:	89 e5                	mov    %esp,%ebp
+  8000ac:	57                   	push   %edi
+  8000ad:	56                   	push   %esi
+  8000ae:	53                   	push   %ebx
+  8000af:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  8000b5:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  8000bb:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  8000c1:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  8000c7:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  8000ce:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  8000d1:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  8000d8:	00 00 00 
+		if (num == SYS_page_map_vec)
+  8000db:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  8000e2:	74 76                	je     80015a <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  8000e4:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  8000ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8000ed:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  8000f3:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8000fa:	0f 88 06 01 00 00    	js     800206 <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800100:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800107:	0f 84 48 01 00 00    	je     800255 <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  80010d:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800113:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800119:	be 00 00 00 00       	mov    $0x0,%esi
+  80011e:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800124:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800127:	55                   	push   %ebp
+  800128:	68 31 01 80 00       	push   $0x800131
+  80012d:	89 e5                	mov    %esp,%ebp
+  80012f:	0f 34                	sysenter
+  800131:	83 c4 04             	add    $0x4,%esp
+  800134:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800135:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  80013b:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800141:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800144:	0f 85 9a 01 00 00    	jne    8002e4 <page_vec_call+0x23b>
+  80014a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80014f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800152:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800155:	e9 29 01 00 00       	jmp    800283 <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  80015a:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800160:	8b 45 08             	mov    0x8(%ebp),%eax
+  800163:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800165:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80016c:	78 2f                	js     80019d <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  80016e:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800175:	74 72                	je     8001e9 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800177:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  80017d:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800183:	b8 10 00 00 00       	mov    $0x10,%eax
+  800188:	89 fb                	mov    %edi,%ebx
+  80018a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80018d:	55                   	push   %ebp
+  80018e:	68 97 01 80 00       	push   $0x800197
+  800193:	89 e5                	mov    %esp,%ebp
+  800195:	0f 34                	sysenter
+  800197:	83 c4 04             	add    $0x4,%esp
+  80019a:	5d                   	pop    %ebp
+	return ret;
+  80019b:	eb 98                	jmp    800135 <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  80019d:	b8 01 00 00 00       	mov    $0x1,%eax
+  8001a2:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  8001a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8001a9:	f6 c6 08             	test   $0x8,%dh
+  8001ac:	74 15                	je     8001c3 <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8001ae:	89 c2                	mov    %eax,%edx
+  8001b0:	c1 ea 08             	shr    $0x8,%edx
+  8001b3:	83 e2 0f             	and    $0xf,%edx
+  8001b6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8001bb:	83 fa 06             	cmp    $0x6,%edx
+  8001be:	74 0e                	je     8001ce <page_vec_call+0x125>
+  8001c0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8001c3:	0f b6 c9             	movzbl %cl,%ecx
+  8001c6:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  8001cc:	eb a0                	jmp    80016e <page_vec_call+0xc5>
+  8001ce:	89 c2                	mov    %eax,%edx
+  8001d0:	c1 ea 04             	shr    $0x4,%edx
+  8001d3:	83 e2 0f             	and    $0xf,%edx
+  8001d6:	83 fa 02             	cmp    $0x2,%edx
+  8001d9:	77 e5                	ja     8001c0 <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  8001db:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8001de:	83 f8 02             	cmp    $0x2,%eax
+  8001e1:	0f 97 c1             	seta   %cl
+  8001e4:	0f b6 c9             	movzbl %cl,%ecx
+  8001e7:	eb d7                	jmp    8001c0 <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  8001e9:	b8 10 00 00 00       	mov    $0x10,%eax
+  8001ee:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  8001f4:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  8001fa:	89 fb                	mov    %edi,%ebx
+  8001fc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8001ff:	cd 30                	int    $0x30
+  800201:	e9 2f ff ff ff       	jmp    800135 <page_vec_call+0x8c>
+  800206:	b8 01 00 00 00       	mov    $0x1,%eax
+  80020b:	0f a2                	cpuid
+		return 0;
+  80020d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800212:	f6 c6 08             	test   $0x8,%dh
+  800215:	74 15                	je     80022c <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800217:	89 c2                	mov    %eax,%edx
+  800219:	c1 ea 08             	shr    $0x8,%edx
+  80021c:	83 e2 0f             	and    $0xf,%edx
+  80021f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800224:	83 fa 06             	cmp    $0x6,%edx
+  800227:	74 11                	je     80023a <page_vec_call+0x191>
+  800229:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80022c:	0f b6 c9             	movzbl %cl,%ecx
+  80022f:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  800235:	e9 c6 fe ff ff       	jmp    800100 <page_vec_call+0x57>
+  80023a:	89 c2                	mov    %eax,%edx
+  80023c:	c1 ea 04             	shr    $0x4,%edx
+  80023f:	83 e2 0f             	and    $0xf,%edx
+  800242:	83 fa 02             	cmp    $0x2,%edx
+  800245:	77 e2                	ja     800229 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800247:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80024a:	83 f8 02             	cmp    $0x2,%eax
+  80024d:	0f 97 c1             	seta   %cl
+  800250:	0f b6 c9             	movzbl %cl,%ecx
+  800253:	eb d4                	jmp    800229 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800255:	be 00 00 00 00       	mov    $0x0,%esi
+  80025a:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800260:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800266:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  80026c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80026f:	cd 30                	int    $0x30
+  800271:	e9 bf fe ff ff       	jmp    800135 <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800276:	29 da                	sub    %ebx,%edx
+			vec++;
+  800278:	83 c6 10             	add    $0x10,%esi
+			n--;
+  80027b:	83 e8 01             	sub    $0x1,%eax
+  80027e:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800283:	85 c0                	test   %eax,%eax
+  800285:	74 58                	je     8002df <page_vec_call+0x236>
+  800287:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80028a:	39 da                	cmp    %ebx,%edx
+  80028c:	73 e8                	jae    800276 <page_vec_call+0x1cd>
+  80028e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800291:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800294:	84 c9                	test   %cl,%cl
+  800296:	74 06                	je     80029e <page_vec_call+0x1f5>
+  800298:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  80029e:	83 ec 04             	sub    $0x4,%esp
+  8002a1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8002a4:	c1 e0 04             	shl    $0x4,%eax
+  8002a7:	50                   	push   %eax
+  8002a8:	ff 75 08             	push   0x8(%ebp)
+  8002ab:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  8002b1:	53                   	push   %ebx
+  8002b2:	e8 41 21 00 00       	call   8023f8 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  8002b7:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  8002bd:	89 c2                	mov    %eax,%edx
+  8002bf:	c1 e2 0c             	shl    $0xc,%edx
+  8002c2:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  8002c8:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  8002ce:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  8002d4:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  8002d7:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  8002da:	e9 f2 fd ff ff       	jmp    8000d1 <page_vec_call+0x28>
+			r = 0;
+  8002df:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  8002e4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8002e8:	74 0b                	je     8002f5 <page_vec_call+0x24c>
+		*done = total;
+  8002ea:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002ed:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  8002f3:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  8002f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002f8:	5b                   	pop    %ebx
+  8002f9:	5e                   	pop    %esi
+  8002fa:	5f                   	pop    %edi
+  8002fb:	5d                   	pop    %ebp
+  8002fc:	c3                   	ret
+
+008002fd <sys_cputs>:
+{
+  8002fd:	55                   	push   %ebp
+  8002fe:	89 e5                	mov    %esp,%ebp
+  800300:	57                   	push   %edi
+  800301:	56                   	push   %esi
+  800302:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800303:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80030a:	78 2d                	js     800339 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  80030c:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800313:	74 70                	je     800385 <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800315:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80031d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800320:	89 c3                	mov    %eax,%ebx
+  800322:	89 c7                	mov    %eax,%edi
+  800324:	89 c6                	mov    %eax,%esi
+  800326:	55                   	push   %ebp
+  800327:	68 30 03 80 00       	push   $0x800330
+  80032c:	89 e5                	mov    %esp,%ebp
+  80032e:	0f 34                	sysenter
+  800330:	83 c4 04             	add    $0x4,%esp
+  800333:	5d                   	pop    %ebp
+}
+  800334:	5b                   	pop    %ebx
+  800335:	5e                   	pop    %esi
+  800336:	5f                   	pop    %edi
+  800337:	5d                   	pop    %ebp
+  800338:	c3                   	ret
+  800339:	b8 01 00 00 00       	mov    $0x1,%eax
+  80033e:	0f a2                	cpuid
+		return 0;
+  800340:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800345:	f6 c6 08             	test   $0x8,%dh
+  800348:	74 15                	je     80035f <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80034a:	89 c2                	mov    %eax,%edx
+  80034c:	c1 ea 08             	shr    $0x8,%edx
+  80034f:	83 e2 0f             	and    $0xf,%edx
+  800352:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800357:	83 fa 06             	cmp    $0x6,%edx
+  80035a:	74 0e                	je     80036a <sys_cputs+0x6d>
+  80035c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80035f:	0f b6 c9             	movzbl %cl,%ecx
+  800362:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  800368:	eb a2                	jmp    80030c <sys_cputs+0xf>
+  80036a:	89 c2                	mov    %eax,%edx
+  80036c:	c1 ea 04             	shr    $0x4,%edx
+  80036f:	83 e2 0f             	and    $0xf,%edx
+  800372:	83 fa 02             	cmp    $0x2,%edx
+  800375:	77 e5                	ja     80035c <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800377:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80037a:	83 f8 02             	cmp    $0x2,%eax
+  80037d:	0f 97 c1             	seta   %cl
+  800380:	0f b6 c9             	movzbl %cl,%ecx
+  800383:	eb d7                	jmp    80035c <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800385:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80038d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800390:	89 c3                	mov    %eax,%ebx
+  800392:	89 c7                	mov    %eax,%edi
+  800394:	89 c6                	mov    %eax,%esi
+  800396:	cd 30                	int    $0x30
+}
+  800398:	eb 9a                	jmp    800334 <sys_cputs+0x37>
+
+0080039a <sys_cgetc>:
+{
+  80039a:	55                   	push   %ebp
+  80039b:	89 e5                	mov    %esp,%ebp
+  80039d:	57                   	push   %edi
+  80039e:	56                   	push   %esi
+  80039f:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8003a0:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8003a7:	78 2e                	js     8003d7 <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  8003a9:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8003b0:	74 71                	je     800423 <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  8003b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003b7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8003bc:	89 d1                	mov    %edx,%ecx
+  8003be:	89 d3                	mov    %edx,%ebx
+  8003c0:	89 d7                	mov    %edx,%edi
+  8003c2:	89 d6                	mov    %edx,%esi
+  8003c4:	55                   	push   %ebp
+  8003c5:	68 ce 03 80 00       	push   $0x8003ce
+  8003ca:	89 e5                	mov    %esp,%ebp
+  8003cc:	0f 34                	sysenter
+  8003ce:	83 c4 04             	add    $0x4,%esp
+  8003d1:	5d                   	pop    %ebp
+}
+  8003d2:	5b                   	pop    %ebx
+  8003d3:	5e                   	pop    %esi
+  8003d4:	5f                   	pop    %edi
+  8003d5:	5d                   	pop    %ebp
+  8003d6:	c3                   	ret
+  8003d7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8003dc:	0f a2                	cpuid
+		return 0;
+  8003de:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8003e3:	f6 c6 08             	test   $0x8,%dh
+  8003e6:	74 15                	je     8003fd <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8003e8:	89 c2                	mov    %eax,%edx
+  8003ea:	c1 ea 08             	shr    $0x8,%edx
+  8003ed:	83 e2 0f             	and    $0xf,%edx
+  8003f0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8003f5:	83 fa 06             	cmp    $0x6,%edx
+  8003f8:	74 0e                	je     800408 <sys_cgetc+0x6e>
+  8003fa:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8003fd:	0f b6 c9             	movzbl %cl,%ecx
+  800400:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  800406:	eb a1                	jmp    8003a9 <sys_cgetc+0xf>
+  800408:	89 c2                	mov    %eax,%edx
+  80040a:	c1 ea 04             	shr    $0x4,%edx
+  80040d:	83 e2 0f             	and    $0xf,%edx
+  800410:	83 fa 02             	cmp    $0x2,%edx
+  800413:	77 e5                	ja     8003fa <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  800415:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800418:	83 f8 02             	cmp    $0x2,%eax
+  80041b:	0f 97 c1             	seta   %cl
+  80041e:	0f b6 c9             	movzbl %cl,%ecx
+  800421:	eb d7                	jmp    8003fa <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  800423:	ba 00 00 00 00       	mov    $0x0,%edx
+  800428:	b8 01 00 00 00       	mov    $0x1,%eax
+  80042d:	89 d1                	mov    %edx,%ecx
+  80042f:	89 d3                	mov    %edx,%ebx
+  800431:	89 d7                	mov    %edx,%edi
+  800433:	89 d6                	mov    %edx,%esi
+  800435:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800437:	eb 99                	jmp    8003d2 <sys_cgetc+0x38>
+
+00800439 <sys_env_destroy>:
+{
+  800439:	55                   	push   %ebp
+  80043a:	89 e5                	mov    %esp,%ebp
+  80043c:	57                   	push   %edi
+  80043d:	56                   	push   %esi
+  80043e:	53                   	push   %ebx
+  80043f:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800442:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800449:	78 36                	js     800481 <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  80044b:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800452:	74 79                	je     8004cd <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  800454:	8b 55 08             	mov    0x8(%ebp),%edx
+  800457:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80045c:	b8 03 00 00 00       	mov    $0x3,%eax
+  800461:	89 cb                	mov    %ecx,%ebx
+  800463:	89 cf                	mov    %ecx,%edi
+  800465:	89 ce                	mov    %ecx,%esi
+  800467:	55                   	push   %ebp
+  800468:	68 71 04 80 00       	push   $0x800471
+  80046d:	89 e5                	mov    %esp,%ebp
+  80046f:	0f 34                	sysenter
+  800471:	83 c4 04             	add    $0x4,%esp
+  800474:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800475:	85 c0                	test   %eax,%eax
+  800477:	7f 6b                	jg     8004e4 <sys_env_destroy+0xab>
+}
+  800479:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80047c:	5b                   	pop    %ebx
+  80047d:	5e                   	pop    %esi
+  80047e:	5f                   	pop    %edi
+  80047f:	5d                   	pop    %ebp
+  800480:	c3                   	ret
+  800481:	b8 01 00 00 00       	mov    $0x1,%eax
+  800486:	0f a2                	cpuid
+		return 0;
+  800488:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80048d:	f6 c6 08             	test   $0x8,%dh
+  800490:	74 15                	je     8004a7 <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800492:	89 c2                	mov    %eax,%edx
+  800494:	c1 ea 08             	shr    $0x8,%edx
+  800497:	83 e2 0f             	and    $0xf,%edx
+  80049a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80049f:	83 fa 06             	cmp    $0x6,%edx
+  8004a2:	74 0e                	je     8004b2 <sys_env_destroy+0x79>
+  8004a4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8004a7:	0f b6 c9             	movzbl %cl,%ecx
+  8004aa:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  8004b0:	eb 99                	jmp    80044b <sys_env_destroy+0x12>
+  8004b2:	89 c2                	mov    %eax,%edx
+  8004b4:	c1 ea 04             	shr    $0x4,%edx
+  8004b7:	83 e2 0f             	and    $0xf,%edx
+  8004ba:	83 fa 02             	cmp    $0x2,%edx
+  8004bd:	77 e5                	ja     8004a4 <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  8004bf:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8004c2:	83 f8 02             	cmp    $0x2,%eax
+  8004c5:	0f 97 c1             	seta   %cl
+  8004c8:	0f b6 c9             	movzbl %cl,%ecx
+  8004cb:	eb d7                	jmp    8004a4 <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  8004cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004d2:	b8 03 00 00 00       	mov    $0x3,%eax
+  8004d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004da:	89 cb                	mov    %ecx,%ebx
+  8004dc:	89 cf                	mov    %ecx,%edi
+  8004de:	89 ce                	mov    %ecx,%esi
+  8004e0:	cd 30                	int    $0x30
+  8004e2:	eb 91                	jmp    800475 <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004e4:	83 ec 0c             	sub    $0xc,%esp
+  8004e7:	50                   	push   %eax
+  8004e8:	6a 03                	push   $0x3
+  8004ea:	68 d8 27 80 00       	push   $0x8027d8
+  8004ef:	6a 4a                	push   $0x4a
+  8004f1:	68 f5 27 80 00       	push   $0x8027f5
+  8004f6:	e8 1e 17 00 00       	call   801c19 <_panic>
+
+008004fb <sys_getenvid>:
+{
+  8004fb:	55                   	push   %ebp
+  8004fc:	89 e5                	mov    %esp,%ebp
+  8004fe:	57                   	push   %edi
+  8004ff:	56                   	push   %esi
+  800500:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800501:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800508:	78 2e                	js     800538 <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  80050a:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800511:	74 71                	je     800584 <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  800513:	ba 00 00 00 00       	mov    $0x0,%edx
+  800518:	b8 02 00 00 00       	mov    $0x2,%eax
+  80051d:	89 d1                	mov    %edx,%ecx
+  80051f:	89 d3                	mov    %edx,%ebx
+  800521:	89 d7                	mov    %edx,%edi
+  800523:	89 d6                	mov    %edx,%esi
+  800525:	55                   	push   %ebp
+  800526:	68 2f 05 80 00       	push   $0x80052f
+  80052b:	89 e5                	mov    %esp,%ebp
+  80052d:	0f 34                	sysenter
+  80052f:	83 c4 04             	add    $0x4,%esp
+  800532:	5d                   	pop    %ebp
+}
+  800533:	5b                   	pop    %ebx
+  800534:	5e                   	pop    %esi
+  800535:	5f                   	pop    %edi
+  800536:	5d                   	pop    %ebp
+  800537:	c3                   	ret
+  800538:	b8 01 00 00 00       	mov    $0x1,%eax
+  80053d:	0f a2                	cpuid
+		return 0;
+  80053f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800544:	f6 c6 08             	test   $0x8,%dh
+  800547:	74 15                	je     80055e <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800549:	89 c2                	mov    %eax,%edx
+  80054b:	c1 ea 08             	shr    $0x8,%edx
+  80054e:	83 e2 0f             	and    $0xf,%edx
+  800551:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800556:	83 fa 06             	cmp    $0x6,%edx
+  800559:	74 0e                	je     800569 <sys_getenvid+0x6e>
+  80055b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80055e:	0f b6 c9             	movzbl %cl,%ecx
+  800561:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  800567:	eb a1                	jmp    80050a <sys_getenvid+0xf>
+  800569:	89 c2                	mov    %eax,%edx
+  80056b:	c1 ea 04             	shr    $0x4,%edx
+  80056e:	83 e2 0f             	and    $0xf,%edx
+  800571:	83 fa 02             	cmp    $0x2,%edx
+  800574:	77 e5                	ja     80055b <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  800576:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800579:	83 f8 02             	cmp    $0x2,%eax
+  80057c:	0f 97 c1             	seta   %cl
+  80057f:	0f b6 c9             	movzbl %cl,%ecx
+  800582:	eb d7                	jmp    80055b <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  800584:	ba 00 00 00 00       	mov    $0x0,%edx
+  800589:	b8 02 00 00 00       	mov    $0x2,%eax
+  80058e:	89 d1                	mov    %edx,%ecx
+  800590:	89 d3                	mov    %edx,%ebx
+  800592:	89 d7                	mov    %edx,%edi
+  800594:	89 d6                	mov    %edx,%esi
+  800596:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  800598:	eb 99                	jmp    800533 <sys_getenvid+0x38>
+
+0080059a <sys_page_alloc>:
+{
+  80059a:	55                   	push   %ebp
+  80059b:	89 e5                	mov    %esp,%ebp
+  80059d:	57                   	push   %edi
+  80059e:	56                   	push   %esi
+  80059f:	53                   	push   %ebx
+  8005a0:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8005a3:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8005aa:	78 38                	js     8005e4 <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  8005ac:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8005b3:	74 7b                	je     800630 <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  8005b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8005ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005c0:	b8 04 00 00 00       	mov    $0x4,%eax
+  8005c5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005c8:	89 f7                	mov    %esi,%edi
+  8005ca:	55                   	push   %ebp
+  8005cb:	68 d4 05 80 00       	push   $0x8005d4
+  8005d0:	89 e5                	mov    %esp,%ebp
+  8005d2:	0f 34                	sysenter
+  8005d4:	83 c4 04             	add    $0x4,%esp
+  8005d7:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8005d8:	85 c0                	test   %eax,%eax
+  8005da:	7f 6d                	jg     800649 <sys_page_alloc+0xaf>
+}
+  8005dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005df:	5b                   	pop    %ebx
+  8005e0:	5e                   	pop    %esi
+  8005e1:	5f                   	pop    %edi
+  8005e2:	5d                   	pop    %ebp
+  8005e3:	c3                   	ret
+  8005e4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8005e9:	0f a2                	cpuid
+		return 0;
+  8005eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8005f0:	f6 c6 08             	test   $0x8,%dh
+  8005f3:	74 15                	je     80060a <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8005f5:	89 c2                	mov    %eax,%edx
+  8005f7:	c1 ea 08             	shr    $0x8,%edx
+  8005fa:	83 e2 0f             	and    $0xf,%edx
+  8005fd:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800602:	83 fa 06             	cmp    $0x6,%edx
+  800605:	74 0e                	je     800615 <sys_page_alloc+0x7b>
+  800607:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80060a:	0f b6 c9             	movzbl %cl,%ecx
+  80060d:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  800613:	eb 97                	jmp    8005ac <sys_page_alloc+0x12>
+  800615:	89 c2                	mov    %eax,%edx
+  800617:	c1 ea 04             	shr    $0x4,%edx
+  80061a:	83 e2 0f             	and    $0xf,%edx
+  80061d:	83 fa 02             	cmp    $0x2,%edx
+  800620:	77 e5                	ja     800607 <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  800622:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800625:	83 f8 02             	cmp    $0x2,%eax
+  800628:	0f 97 c1             	seta   %cl
+  80062b:	0f b6 c9             	movzbl %cl,%ecx
+  80062e:	eb d7                	jmp    800607 <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  800630:	be 00 00 00 00       	mov    $0x0,%esi
+  800635:	b8 04 00 00 00       	mov    $0x4,%eax
+  80063a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80063d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800640:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800643:	89 f7                	mov    %esi,%edi
+  800645:	cd 30                	int    $0x30
+  800647:	eb 8f                	jmp    8005d8 <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800649:	83 ec 0c             	sub    $0xc,%esp
+  80064c:	50                   	push   %eax
+  80064d:	6a 04                	push   $0x4
+  80064f:	68 d8 27 80 00       	push   $0x8027d8
+  800654:	6a 4a                	push   $0x4a
+  800656:	68 f5 27 80 00       	push   $0x8027f5
+  80065b:	e8 b9 15 00 00       	call   801c19 <_panic>
+
+00800660 <sys_page_map>:
+{
+  800660:	55                   	push   %ebp
+  800661:	89 e5                	mov    %esp,%ebp
+  800663:	57                   	push   %edi
+  800664:	56                   	push   %esi
+  800665:	53                   	push   %ebx
+  800666:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800669:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800670:	78 37                	js     8006a9 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  800672:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800679:	74 7a                	je     8006f5 <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  80067b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80067e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800681:	b8 05 00 00 00       	mov    $0x5,%eax
+  800686:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800689:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80068c:	8b 75 18             	mov    0x18(%ebp),%esi
+  80068f:	55                   	push   %ebp
+  800690:	68 99 06 80 00       	push   $0x800699
+  800695:	89 e5                	mov    %esp,%ebp
+  800697:	0f 34                	sysenter
+  800699:	83 c4 04             	add    $0x4,%esp
+  80069c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80069d:	85 c0                	test   %eax,%eax
+  80069f:	7f 6c                	jg     80070d <sys_page_map+0xad>
+}
+  8006a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006a4:	5b                   	pop    %ebx
+  8006a5:	5e                   	pop    %esi
+  8006a6:	5f                   	pop    %edi
+  8006a7:	5d                   	pop    %ebp
+  8006a8:	c3                   	ret
+  8006a9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8006ae:	0f a2                	cpuid
+		return 0;
+  8006b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8006b5:	f6 c6 08             	test   $0x8,%dh
+  8006b8:	74 15                	je     8006cf <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8006ba:	89 c2                	mov    %eax,%edx
+  8006bc:	c1 ea 08             	shr    $0x8,%edx
+  8006bf:	83 e2 0f             	and    $0xf,%edx
+  8006c2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8006c7:	83 fa 06             	cmp    $0x6,%edx
+  8006ca:	74 0e                	je     8006da <sys_page_map+0x7a>
+  8006cc:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8006cf:	0f b6 c9             	movzbl %cl,%ecx
+  8006d2:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  8006d8:	eb 98                	jmp    800672 <sys_page_map+0x12>
+  8006da:	89 c2                	mov    %eax,%edx
+  8006dc:	c1 ea 04             	shr    $0x4,%edx
+  8006df:	83 e2 0f             	and    $0xf,%edx
+  8006e2:	83 fa 02             	cmp    $0x2,%edx
+  8006e5:	77 e5                	ja     8006cc <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  8006e7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8006ea:	83 f8 02             	cmp    $0x2,%eax
+  8006ed:	0f 97 c1             	seta   %cl
+  8006f0:	0f b6 c9             	movzbl %cl,%ecx
+  8006f3:	eb d7                	jmp    8006cc <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  8006f5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8006fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800700:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800703:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800706:	8b 75 18             	mov    0x18(%ebp),%esi
+  800709:	cd 30                	int    $0x30
+  80070b:	eb 90                	jmp    80069d <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80070d:	83 ec 0c             	sub    $0xc,%esp
+  800710:	50                   	push   %eax
+  800711:	6a 05                	push   $0x5
+  800713:	68 d8 27 80 00       	push   $0x8027d8
+  800718:	6a 4a                	push   $0x4a
+  80071a:	68 f5 27 80 00       	push   $0x8027f5
+  80071f:	e8 f5 14 00 00       	call   801c19 <_panic>
+
+00800724 <sys_page_unmap>:
+{
+  800724:	55                   	push   %ebp
+  800725:	89 e5                	mov    %esp,%ebp
+  800727:	57                   	push   %edi
+  800728:	56                   	push   %esi
+  800729:	53                   	push   %ebx
+  80072a:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80072d:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800734:	78 37                	js     80076d <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  800736:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80073d:	74 7a                	je     8007b9 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  80073f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800744:	8b 55 08             	mov    0x8(%ebp),%edx
+  800747:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80074a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80074f:	89 df                	mov    %ebx,%edi
+  800751:	89 de                	mov    %ebx,%esi
+  800753:	55                   	push   %ebp
+  800754:	68 5d 07 80 00       	push   $0x80075d
+  800759:	89 e5                	mov    %esp,%ebp
+  80075b:	0f 34                	sysenter
+  80075d:	83 c4 04             	add    $0x4,%esp
+  800760:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800761:	85 c0                	test   %eax,%eax
+  800763:	7f 6c                	jg     8007d1 <sys_page_unmap+0xad>
+}
+  800765:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800768:	5b                   	pop    %ebx
+  800769:	5e                   	pop    %esi
+  80076a:	5f                   	pop    %edi
+  80076b:	5d                   	pop    %ebp
+  80076c:	c3                   	ret
+  80076d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800772:	0f a2                	cpuid
+		return 0;
+  800774:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800779:	f6 c6 08             	test   $0x8,%dh
+  80077c:	74 15                	je     800793 <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80077e:	89 c2                	mov    %eax,%edx
+  800780:	c1 ea 08             	shr    $0x8,%edx
+  800783:	83 e2 0f             	and    $0xf,%edx
+  800786:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80078b:	83 fa 06             	cmp    $0x6,%edx
+  80078e:	74 0e                	je     80079e <sys_page_unmap+0x7a>
+  800790:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800793:	0f b6 c9             	movzbl %cl,%ecx
+  800796:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  80079c:	eb 98                	jmp    800736 <sys_page_unmap+0x12>
+  80079e:	89 c2                	mov    %eax,%edx
+  8007a0:	c1 ea 04             	shr    $0x4,%edx
+  8007a3:	83 e2 0f             	and    $0xf,%edx
+  8007a6:	83 fa 02             	cmp    $0x2,%edx
+  8007a9:	77 e5                	ja     800790 <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  8007ab:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8007ae:	83 f8 02             	cmp    $0x2,%eax
+  8007b1:	0f 97 c1             	seta   %cl
+  8007b4:	0f b6 c9             	movzbl %cl,%ecx
+  8007b7:	eb d7                	jmp    800790 <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  8007b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007be:	b8 06 00 00 00       	mov    $0x6,%eax
+  8007c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007c9:	89 df                	mov    %ebx,%edi
+  8007cb:	89 de                	mov    %ebx,%esi
+  8007cd:	cd 30                	int    $0x30
+  8007cf:	eb 90                	jmp    800761 <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8007d1:	83 ec 0c             	sub    $0xc,%esp
+  8007d4:	50                   	push   %eax
+  8007d5:	6a 06                	push   $0x6
+  8007d7:	68 d8 27 80 00       	push   $0x8027d8
+  8007dc:	6a 4a                	push   $0x4a
+  8007de:	68 f5 27 80 00       	push   $0x8027f5
+  8007e3:	e8 31 14 00 00       	call   801c19 <_panic>
+
+008007e8 <sys_page_copy>:
+{
+  8007e8:	55                   	push   %ebp
+  8007e9:	89 e5                	mov    %esp,%ebp
+  8007eb:	57                   	push   %edi
+  8007ec:	56                   	push   %esi
+  8007ed:	53                   	push   %ebx
+  8007ee:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8007f1:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8007f8:	78 37                	js     800831 <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  8007fa:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800801:	74 7a                	je     80087d <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  800803:	8b 55 08             	mov    0x8(%ebp),%edx
+  800806:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800809:	b8 29 00 00 00       	mov    $0x29,%eax
+  80080e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800811:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800814:	8b 75 18             	mov    0x18(%ebp),%esi
+  800817:	55                   	push   %ebp
+  800818:	68 21 08 80 00       	push   $0x800821
+  80081d:	89 e5                	mov    %esp,%ebp
+  80081f:	0f 34                	sysenter
+  800821:	83 c4 04             	add    $0x4,%esp
+  800824:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800825:	85 c0                	test   %eax,%eax
+  800827:	7f 6c                	jg     800895 <sys_page_copy+0xad>
+}
+  800829:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80082c:	5b                   	pop    %ebx
+  80082d:	5e                   	pop    %esi
+  80082e:	5f                   	pop    %edi
+  80082f:	5d                   	pop    %ebp
+  800830:	c3                   	ret
+  800831:	b8 01 00 00 00       	mov    $0x1,%eax
+  800836:	0f a2                	cpuid
+		return 0;
+  800838:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80083d:	f6 c6 08             	test   $0x8,%dh
+  800840:	74 15                	je     800857 <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800842:	89 c2                	mov    %eax,%edx
+  800844:	c1 ea 08             	shr    $0x8,%edx
+  800847:	83 e2 0f             	and    $0xf,%edx
+  80084a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80084f:	83 fa 06             	cmp    $0x6,%edx
+  800852:	74 0e                	je     800862 <sys_page_copy+0x7a>
+  800854:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800857:	0f b6 c9             	movzbl %cl,%ecx
+  80085a:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  800860:	eb 98                	jmp    8007fa <sys_page_copy+0x12>
+  800862:	89 c2                	mov    %eax,%edx
+  800864:	c1 ea 04             	shr    $0x4,%edx
+  800867:	83 e2 0f             	and    $0xf,%edx
+  80086a:	83 fa 02             	cmp    $0x2,%edx
+  80086d:	77 e5                	ja     800854 <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  80086f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800872:	83 f8 02             	cmp    $0x2,%eax
+  800875:	0f 97 c1             	seta   %cl
+  800878:	0f b6 c9             	movzbl %cl,%ecx
+  80087b:	eb d7                	jmp    800854 <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  80087d:	b8 29 00 00 00       	mov    $0x29,%eax
+  800882:	8b 55 08             	mov    0x8(%ebp),%edx
+  800885:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800888:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80088b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80088e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800891:	cd 30                	int    $0x30
+  800893:	eb 90                	jmp    800825 <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800895:	83 ec 0c             	sub    $0xc,%esp
+  800898:	50                   	push   %eax
+  800899:	6a 29                	push   $0x29
+  80089b:	68 d8 27 80 00       	push   $0x8027d8
+  8008a0:	6a 4a                	push   $0x4a
+  8008a2:	68 f5 27 80 00       	push   $0x8027f5
+  8008a7:	e8 6d 13 00 00       	call   801c19 <_panic>
+
+008008ac <sys_yield>:
+{
+  8008ac:	55                   	push   %ebp
+  8008ad:	89 e5                	mov    %esp,%ebp
+  8008af:	57                   	push   %edi
+  8008b0:	56                   	push   %esi
+  8008b1:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8008b2:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8008b9:	78 2e                	js     8008e9 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  8008bb:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8008c2:	74 71                	je     800935 <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  8008c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008c9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8008ce:	89 d1                	mov    %edx,%ecx
+  8008d0:	89 d3                	mov    %edx,%ebx
+  8008d2:	89 d7                	mov    %edx,%edi
+  8008d4:	89 d6                	mov    %edx,%esi
+  8008d6:	55                   	push   %ebp
+  8008d7:	68 e0 08 80 00       	push   $0x8008e0
+  8008dc:	89 e5                	mov    %esp,%ebp
+  8008de:	0f 34                	sysenter
+  8008e0:	83 c4 04             	add    $0x4,%esp
+  8008e3:	5d                   	pop    %ebp
+}
+  8008e4:	5b                   	pop    %ebx
+  8008e5:	5e                   	pop    %esi
+  8008e6:	5f                   	pop    %edi
+  8008e7:	5d                   	pop    %ebp
+  8008e8:	c3                   	ret
+  8008e9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8008ee:	0f a2                	cpuid
+		return 0;
+  8008f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8008f5:	f6 c6 08             	test   $0x8,%dh
+  8008f8:	74 15                	je     80090f <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8008fa:	89 c2                	mov    %eax,%edx
+  8008fc:	c1 ea 08             	shr    $0x8,%edx
+  8008ff:	83 e2 0f             	and    $0xf,%edx
+  800902:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800907:	83 fa 06             	cmp    $0x6,%edx
+  80090a:	74 0e                	je     80091a <sys_yield+0x6e>
+  80090c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80090f:	0f b6 c9             	movzbl %cl,%ecx
+  800912:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  800918:	eb a1                	jmp    8008bb <sys_yield+0xf>
+  80091a:	89 c2                	mov    %eax,%edx
+  80091c:	c1 ea 04             	shr    $0x4,%edx
+  80091f:	83 e2 0f             	and    $0xf,%edx
+  800922:	83 fa 02             	cmp    $0x2,%edx
+  800925:	77 e5                	ja     80090c <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  800927:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80092a:	83 f8 02             	cmp    $0x2,%eax
+  80092d:	0f 97 c1             	seta   %cl
+  800930:	0f b6 c9             	movzbl %cl,%ecx
+  800933:	eb d7                	jmp    80090c <sys_yield+0x60>
+		asm volatile("int %1\n"
+  800935:	ba 00 00 00 00       	mov    $0x0,%edx
+  80093a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80093f:	89 d1                	mov    %edx,%ecx
+  800941:	89 d3                	mov    %edx,%ebx
+  800943:	89 d7                	mov    %edx,%edi
+  800945:	89 d6                	mov    %edx,%esi
+  800947:	cd 30                	int    $0x30
+}
+  800949:	eb 99                	jmp    8008e4 <sys_yield+0x38>
+
+0080094b <sys_env_set_status>:
+{
+  80094b:	55                   	push   %ebp
+  80094c:	89 e5                	mov    %esp,%ebp
+  80094e:	57                   	push   %edi
+  80094f:	56                   	push   %esi
+  800950:	53                   	push   %ebx
+  800951:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800954:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80095b:	78 37                	js     800994 <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  80095d:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800964:	74 7a                	je     8009e0 <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  800966:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80096b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80096e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800971:	b8 08 00 00 00       	mov    $0x8,%eax
+  800976:	89 df                	mov    %ebx,%edi
+  800978:	89 de                	mov    %ebx,%esi
+  80097a:	55                   	push   %ebp
+  80097b:	68 84 09 80 00       	push   $0x800984
+  800980:	89 e5                	mov    %esp,%ebp
+  800982:	0f 34                	sysenter
+  800984:	83 c4 04             	add    $0x4,%esp
+  800987:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800988:	85 c0                	test   %eax,%eax
+  80098a:	7f 6c                	jg     8009f8 <sys_env_set_status+0xad>
+}
+  80098c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80098f:	5b                   	pop    %ebx
+  800990:	5e                   	pop    %esi
+  800991:	5f                   	pop    %edi
+  800992:	5d                   	pop    %ebp
+  800993:	c3                   	ret
+  800994:	b8 01 00 00 00       	mov    $0x1,%eax
+  800999:	0f a2                	cpuid
+		return 0;
+  80099b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8009a0:	f6 c6 08             	test   $0x8,%dh
+  8009a3:	74 15                	je     8009ba <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8009a5:	89 c2                	mov    %eax,%edx
+  8009a7:	c1 ea 08             	shr    $0x8,%edx
+  8009aa:	83 e2 0f             	and    $0xf,%edx
+  8009ad:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8009b2:	83 fa 06             	cmp    $0x6,%edx
+  8009b5:	74 0e                	je     8009c5 <sys_env_set_status+0x7a>
+  8009b7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8009ba:	0f b6 c9             	movzbl %cl,%ecx
+  8009bd:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  8009c3:	eb 98                	jmp    80095d <sys_env_set_status+0x12>
+  8009c5:	89 c2                	mov    %eax,%edx
+  8009c7:	c1 ea 04             	shr    $0x4,%edx
+  8009ca:	83 e2 0f             	and    $0xf,%edx
+  8009cd:	83 fa 02             	cmp    $0x2,%edx
+  8009d0:	77 e5                	ja     8009b7 <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  8009d2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8009d5:	83 f8 02             	cmp    $0x2,%eax
+  8009d8:	0f 97 c1             	seta   %cl
+  8009db:	0f b6 c9             	movzbl %cl,%ecx
+  8009de:	eb d7                	jmp    8009b7 <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  8009e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009e5:	b8 08 00 00 00       	mov    $0x8,%eax
+  8009ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009f0:	89 df                	mov    %ebx,%edi
+  8009f2:	89 de                	mov    %ebx,%esi
+  8009f4:	cd 30                	int    $0x30
+  8009f6:	eb 90                	jmp    800988 <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8009f8:	83 ec 0c             	sub    $0xc,%esp
+  8009fb:	50                   	push   %eax
+  8009fc:	6a 08                	push   $0x8
+  8009fe:	68 d8 27 80 00       	push   $0x8027d8
+  800a03:	6a 4a                	push   $0x4a
+  800a05:	68 f5 27 80 00       	push   $0x8027f5
+  800a0a:	e8 0a 12 00 00       	call   801c19 <_panic>
+
+00800a0f <sys_sysinfo>:
+{
+  800a0f:	55                   	push   %ebp
+  800a10:	89 e5                	mov    %esp,%ebp
+  800a12:	57                   	push   %edi
+  800a13:	56                   	push   %esi
+  800a14:	53                   	push   %ebx
+  800a15:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800a18:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800a1f:	78 36                	js     800a57 <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  800a21:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800a28:	74 79                	je     800aa3 <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  800a2a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a2d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a32:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800a37:	89 cb                	mov    %ecx,%ebx
+  800a39:	89 cf                	mov    %ecx,%edi
+  800a3b:	89 ce                	mov    %ecx,%esi
+  800a3d:	55                   	push   %ebp
+  800a3e:	68 47 0a 80 00       	push   $0x800a47
+  800a43:	89 e5                	mov    %esp,%ebp
+  800a45:	0f 34                	sysenter
+  800a47:	83 c4 04             	add    $0x4,%esp
+  800a4a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800a4b:	85 c0                	test   %eax,%eax
+  800a4d:	7f 6b                	jg     800aba <sys_sysinfo+0xab>
+}
+  800a4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a52:	5b                   	pop    %ebx
+  800a53:	5e                   	pop    %esi
+  800a54:	5f                   	pop    %edi
+  800a55:	5d                   	pop    %ebp
+  800a56:	c3                   	ret
+  800a57:	b8 01 00 00 00       	mov    $0x1,%eax
+  800a5c:	0f a2                	cpuid
+		return 0;
+  800a5e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800a63:	f6 c6 08             	test   $0x8,%dh
+  800a66:	74 15                	je     800a7d <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800a68:	89 c2                	mov    %eax,%edx
+  800a6a:	c1 ea 08             	shr    $0x8,%edx
+  800a6d:	83 e2 0f             	and    $0xf,%edx
+  800a70:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800a75:	83 fa 06             	cmp    $0x6,%edx
+  800a78:	74 0e                	je     800a88 <sys_sysinfo+0x79>
+  800a7a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800a7d:	0f b6 c9             	movzbl %cl,%ecx
+  800a80:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  800a86:	eb 99                	jmp    800a21 <sys_sysinfo+0x12>
+  800a88:	89 c2                	mov    %eax,%edx
+  800a8a:	c1 ea 04             	shr    $0x4,%edx
+  800a8d:	83 e2 0f             	and    $0xf,%edx
+  800a90:	83 fa 02             	cmp    $0x2,%edx
+  800a93:	77 e5                	ja     800a7a <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  800a95:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800a98:	83 f8 02             	cmp    $0x2,%eax
+  800a9b:	0f 97 c1             	seta   %cl
+  800a9e:	0f b6 c9             	movzbl %cl,%ecx
+  800aa1:	eb d7                	jmp    800a7a <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  800aa3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aa8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800aad:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ab0:	89 cb                	mov    %ecx,%ebx
+  800ab2:	89 cf                	mov    %ecx,%edi
+  800ab4:	89 ce                	mov    %ecx,%esi
+  800ab6:	cd 30                	int    $0x30
+  800ab8:	eb 91                	jmp    800a4b <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800aba:	83 ec 0c             	sub    $0xc,%esp
+  800abd:	50                   	push   %eax
+  800abe:	6a 0b                	push   $0xb
+  800ac0:	68 d8 27 80 00       	push   $0x8027d8
+  800ac5:	6a 4a                	push   $0x4a
+  800ac7:	68 f5 27 80 00       	push   $0x8027f5
+  800acc:	e8 48 11 00 00       	call   801c19 <_panic>
+
+00800ad1 <sys_env_set_trapframe>:
+{
+  800ad1:	55                   	push   %ebp
+  800ad2:	89 e5                	mov    %esp,%ebp
+  800ad4:	57                   	push   %edi
+  800ad5:	56                   	push   %esi
+  800ad6:	53                   	push   %ebx
+  800ad7:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800ada:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800ae1:	78 37                	js     800b1a <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  800ae3:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800aea:	74 7a                	je     800b66 <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  800aec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800af1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800af4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800af7:	b8 13 00 00 00       	mov    $0x13,%eax
+  800afc:	89 df                	mov    %ebx,%edi
+  800afe:	89 de                	mov    %ebx,%esi
+  800b00:	55                   	push   %ebp
+  800b01:	68 0a 0b 80 00       	push   $0x800b0a
+  800b06:	89 e5                	mov    %esp,%ebp
+  800b08:	0f 34                	sysenter
+  800b0a:	83 c4 04             	add    $0x4,%esp
+  800b0d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800b0e:	85 c0                	test   %eax,%eax
+  800b10:	7f 6c                	jg     800b7e <sys_env_set_trapframe+0xad>
+}
+  800b12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b15:	5b                   	pop    %ebx
+  800b16:	5e                   	pop    %esi
+  800b17:	5f                   	pop    %edi
+  800b18:	5d                   	pop    %ebp
+  800b19:	c3                   	ret
+  800b1a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b1f:	0f a2                	cpuid
+		return 0;
+  800b21:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800b26:	f6 c6 08             	test   $0x8,%dh
+  800b29:	74 15                	je     800b40 <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800b2b:	89 c2                	mov    %eax,%edx
+  800b2d:	c1 ea 08             	shr    $0x8,%edx
+  800b30:	83 e2 0f             	and    $0xf,%edx
+  800b33:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800b38:	83 fa 06             	cmp    $0x6,%edx
+  800b3b:	74 0e                	je     800b4b <sys_env_set_trapframe+0x7a>
+  800b3d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800b40:	0f b6 c9             	movzbl %cl,%ecx
+  800b43:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  800b49:	eb 98                	jmp    800ae3 <sys_env_set_trapframe+0x12>
+  800b4b:	89 c2                	mov    %eax,%edx
+  800b4d:	c1 ea 04             	shr    $0x4,%edx
+  800b50:	83 e2 0f             	and    $0xf,%edx
+  800b53:	83 fa 02             	cmp    $0x2,%edx
+  800b56:	77 e5                	ja     800b3d <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  800b58:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800b5b:	83 f8 02             	cmp    $0x2,%eax
+  800b5e:	0f 97 c1             	seta   %cl
+  800b61:	0f b6 c9             	movzbl %cl,%ecx
+  800b64:	eb d7                	jmp    800b3d <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  800b66:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b6b:	b8 13 00 00 00       	mov    $0x13,%eax
+  800b70:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b73:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b76:	89 df                	mov    %ebx,%edi
+  800b78:	89 de                	mov    %ebx,%esi
+  800b7a:	cd 30                	int    $0x30
+  800b7c:	eb 90                	jmp    800b0e <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b7e:	83 ec 0c             	sub    $0xc,%esp
+  800b81:	50                   	push   %eax
+  800b82:	6a 13                	push   $0x13
+  800b84:	68 d8 27 80 00       	push   $0x8027d8
+  800b89:	6a 4a                	push   $0x4a
+  800b8b:	68 f5 27 80 00       	push   $0x8027f5
+  800b90:	e8 84 10 00 00       	call   801c19 <_panic>
+
+00800b95 <sys_env_set_stack_limit>:
+{
+  800b95:	55                   	push   %ebp
+  800b96:	89 e5                	mov    %esp,%ebp
+  800b98:	57                   	push   %edi
+  800b99:	56                   	push   %esi
+  800b9a:	53                   	push   %ebx
+  800b9b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800b9e:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800ba5:	78 37                	js     800bde <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  800ba7:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800bae:	74 7a                	je     800c2a <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  800bb0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bb5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bb8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bbb:	b8 19 00 00 00       	mov    $0x19,%eax
+  800bc0:	89 df                	mov    %ebx,%edi
+  800bc2:	89 de                	mov    %ebx,%esi
+  800bc4:	55                   	push   %ebp
+  800bc5:	68 ce 0b 80 00       	push   $0x800bce
+  800bca:	89 e5                	mov    %esp,%ebp
+  800bcc:	0f 34                	sysenter
+  800bce:	83 c4 04             	add    $0x4,%esp
+  800bd1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800bd2:	85 c0                	test   %eax,%eax
+  800bd4:	7f 6c                	jg     800c42 <sys_env_set_stack_limit+0xad>
+}
+  800bd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bd9:	5b                   	pop    %ebx
+  800bda:	5e                   	pop    %esi
+  800bdb:	5f                   	pop    %edi
+  800bdc:	5d                   	pop    %ebp
+  800bdd:	c3                   	ret
+  800bde:	b8 01 00 00 00       	mov    $0x1,%eax
+  800be3:	0f a2                	cpuid
+		return 0;
+  800be5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800bea:	f6 c6 08             	test   $0x8,%dh
+  800bed:	74 15                	je     800c04 <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800bef:	89 c2                	mov    %eax,%edx
+  800bf1:	c1 ea 08             	shr    $0x8,%edx
+  800bf4:	83 e2 0f             	and    $0xf,%edx
+  800bf7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800bfc:	83 fa 06             	cmp    $0x6,%edx
+  800bff:	74 0e                	je     800c0f <sys_env_set_stack_limit+0x7a>
+  800c01:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800c04:	0f b6 c9             	movzbl %cl,%ecx
+  800c07:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  800c0d:	eb 98                	jmp    800ba7 <sys_env_set_stack_limit+0x12>
+  800c0f:	89 c2                	mov    %eax,%edx
+  800c11:	c1 ea 04             	shr    $0x4,%edx
+  800c14:	83 e2 0f             	and    $0xf,%edx
+  800c17:	83 fa 02             	cmp    $0x2,%edx
+  800c1a:	77 e5                	ja     800c01 <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  800c1c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c1f:	83 f8 02             	cmp    $0x2,%eax
+  800c22:	0f 97 c1             	seta   %cl
+  800c25:	0f b6 c9             	movzbl %cl,%ecx
+  800c28:	eb d7                	jmp    800c01 <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  800c2a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c2f:	b8 19 00 00 00       	mov    $0x19,%eax
+  800c34:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c3a:	89 df                	mov    %ebx,%edi
+  800c3c:	89 de                	mov    %ebx,%esi
+  800c3e:	cd 30                	int    $0x30
+  800c40:	eb 90                	jmp    800bd2 <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c42:	83 ec 0c             	sub    $0xc,%esp
+  800c45:	50                   	push   %eax
+  800c46:	6a 19                	push   $0x19
+  800c48:	68 d8 27 80 00       	push   $0x8027d8
+  800c4d:	6a 4a                	push   $0x4a
+  800c4f:	68 f5 27 80 00       	push   $0x8027f5
+  800c54:	e8 c0 0f 00 00       	call   801c19 <_panic>
+
+00800c59 <sys_env_set_pgfault_upcall>:
+{
+  800c59:	55                   	push   %ebp
+  800c5a:	89 e5                	mov    %esp,%ebp
+  800c5c:	57                   	push   %edi
+  800c5d:	56                   	push   %esi
+  800c5e:	53                   	push   %ebx
+  800c5f:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800c62:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800c69:	78 37                	js     800ca2 <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  800c6b:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800c72:	74 7a                	je     800cee <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  800c74:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c79:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c7c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c7f:	b8 09 00 00 00       	mov    $0x9,%eax
+  800c84:	89 df                	mov    %ebx,%edi
+  800c86:	89 de                	mov    %ebx,%esi
+  800c88:	55                   	push   %ebp
+  800c89:	68 92 0c 80 00       	push   $0x800c92
+  800c8e:	89 e5                	mov    %esp,%ebp
+  800c90:	0f 34                	sysenter
+  800c92:	83 c4 04             	add    $0x4,%esp
+  800c95:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c96:	85 c0                	test   %eax,%eax
+  800c98:	7f 6c                	jg     800d06 <sys_env_set_pgfault_upcall+0xad>
+}
+  800c9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c9d:	5b                   	pop    %ebx
+  800c9e:	5e                   	pop    %esi
+  800c9f:	5f                   	pop    %edi
+  800ca0:	5d                   	pop    %ebp
+  800ca1:	c3                   	ret
+  800ca2:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ca7:	0f a2                	cpuid
+		return 0;
+  800ca9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800cae:	f6 c6 08             	test   $0x8,%dh
+  800cb1:	74 15                	je     800cc8 <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800cb3:	89 c2                	mov    %eax,%edx
+  800cb5:	c1 ea 08             	shr    $0x8,%edx
+  800cb8:	83 e2 0f             	and    $0xf,%edx
+  800cbb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800cc0:	83 fa 06             	cmp    $0x6,%edx
+  800cc3:	74 0e                	je     800cd3 <sys_env_set_pgfault_upcall+0x7a>
+  800cc5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800cc8:	0f b6 c9             	movzbl %cl,%ecx
+  800ccb:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  800cd1:	eb 98                	jmp    800c6b <sys_env_set_pgfault_upcall+0x12>
+  800cd3:	89 c2                	mov    %eax,%edx
+  800cd5:	c1 ea 04             	shr    $0x4,%edx
+  800cd8:	83 e2 0f             	and    $0xf,%edx
+  800cdb:	83 fa 02             	cmp    $0x2,%edx
+  800cde:	77 e5                	ja     800cc5 <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  800ce0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ce3:	83 f8 02             	cmp    $0x2,%eax
+  800ce6:	0f 97 c1             	seta   %cl
+  800ce9:	0f b6 c9             	movzbl %cl,%ecx
+  800cec:	eb d7                	jmp    800cc5 <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  800cee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cf3:	b8 09 00 00 00       	mov    $0x9,%eax
+  800cf8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cfb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cfe:	89 df                	mov    %ebx,%edi
+  800d00:	89 de                	mov    %ebx,%esi
+  800d02:	cd 30                	int    $0x30
+  800d04:	eb 90                	jmp    800c96 <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d06:	83 ec 0c             	sub    $0xc,%esp
+  800d09:	50                   	push   %eax
+  800d0a:	6a 09                	push   $0x9
+  800d0c:	68 d8 27 80 00       	push   $0x8027d8
+  800d11:	6a 4a                	push   $0x4a
+  800d13:	68 f5 27 80 00       	push   $0x8027f5
+  800d18:	e8 fc 0e 00 00       	call   801c19 <_panic>
+
+00800d1d <sys_ipc_try_send>:
+{
+  800d1d:	55                   	push   %ebp
+  800d1e:	89 e5                	mov    %esp,%ebp
+  800d20:	57                   	push   %edi
+  800d21:	56                   	push   %esi
+  800d22:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800d23:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800d2a:	78 32                	js     800d5e <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  800d2c:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800d33:	74 75                	je     800daa <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  800d35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d3b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d40:	be 00 00 00 00       	mov    $0x0,%esi
+  800d45:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d48:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d4b:	55                   	push   %ebp
+  800d4c:	68 55 0d 80 00       	push   $0x800d55
+  800d51:	89 e5                	mov    %esp,%ebp
+  800d53:	0f 34                	sysenter
+  800d55:	83 c4 04             	add    $0x4,%esp
+  800d58:	5d                   	pop    %ebp
+}
+  800d59:	5b                   	pop    %ebx
+  800d5a:	5e                   	pop    %esi
+  800d5b:	5f                   	pop    %edi
+  800d5c:	5d                   	pop    %ebp
+  800d5d:	c3                   	ret
+  800d5e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d63:	0f a2                	cpuid
+		return 0;
+  800d65:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800d6a:	f6 c6 08             	test   $0x8,%dh
+  800d6d:	74 15                	je     800d84 <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d6f:	89 c2                	mov    %eax,%edx
+  800d71:	c1 ea 08             	shr    $0x8,%edx
+  800d74:	83 e2 0f             	and    $0xf,%edx
+  800d77:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d7c:	83 fa 06             	cmp    $0x6,%edx
+  800d7f:	74 0e                	je     800d8f <sys_ipc_try_send+0x72>
+  800d81:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800d84:	0f b6 c9             	movzbl %cl,%ecx
+  800d87:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  800d8d:	eb 9d                	jmp    800d2c <sys_ipc_try_send+0xf>
+  800d8f:	89 c2                	mov    %eax,%edx
+  800d91:	c1 ea 04             	shr    $0x4,%edx
+  800d94:	83 e2 0f             	and    $0xf,%edx
+  800d97:	83 fa 02             	cmp    $0x2,%edx
+  800d9a:	77 e5                	ja     800d81 <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  800d9c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d9f:	83 f8 02             	cmp    $0x2,%eax
+  800da2:	0f 97 c1             	seta   %cl
+  800da5:	0f b6 c9             	movzbl %cl,%ecx
+  800da8:	eb d7                	jmp    800d81 <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  800daa:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800daf:	be 00 00 00 00       	mov    $0x0,%esi
+  800db4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dbd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dc0:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  800dc2:	eb 95                	jmp    800d59 <sys_ipc_try_send+0x3c>
+
+00800dc4 <sys_ipc_send>:
+{
+  800dc4:	55                   	push   %ebp
+  800dc5:	89 e5                	mov    %esp,%ebp
+  800dc7:	57                   	push   %edi
+  800dc8:	56                   	push   %esi
+  800dc9:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800dca:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800dd1:	78 32                	js     800e05 <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  800dd3:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800dda:	74 75                	je     800e51 <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  800ddc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ddf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de2:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800de7:	be 00 00 00 00       	mov    $0x0,%esi
+  800dec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800def:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800df2:	55                   	push   %ebp
+  800df3:	68 fc 0d 80 00       	push   $0x800dfc
+  800df8:	89 e5                	mov    %esp,%ebp
+  800dfa:	0f 34                	sysenter
+  800dfc:	83 c4 04             	add    $0x4,%esp
+  800dff:	5d                   	pop    %ebp
+}
+  800e00:	5b                   	pop    %ebx
+  800e01:	5e                   	pop    %esi
+  800e02:	5f                   	pop    %edi
+  800e03:	5d                   	pop    %ebp
+  800e04:	c3                   	ret
+  800e05:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e0a:	0f a2                	cpuid
+		return 0;
+  800e0c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800e11:	f6 c6 08             	test   $0x8,%dh
+  800e14:	74 15                	je     800e2b <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e16:	89 c2                	mov    %eax,%edx
+  800e18:	c1 ea 08             	shr    $0x8,%edx
+  800e1b:	83 e2 0f             	and    $0xf,%edx
+  800e1e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e23:	83 fa 06             	cmp    $0x6,%edx
+  800e26:	74 0e                	je     800e36 <sys_ipc_send+0x72>
+  800e28:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e2b:	0f b6 c9             	movzbl %cl,%ecx
+  800e2e:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  800e34:	eb 9d                	jmp    800dd3 <sys_ipc_send+0xf>
+  800e36:	89 c2                	mov    %eax,%edx
+  800e38:	c1 ea 04             	shr    $0x4,%edx
+  800e3b:	83 e2 0f             	and    $0xf,%edx
+  800e3e:	83 fa 02             	cmp    $0x2,%edx
+  800e41:	77 e5                	ja     800e28 <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  800e43:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e46:	83 f8 02             	cmp    $0x2,%eax
+  800e49:	0f 97 c1             	seta   %cl
+  800e4c:	0f b6 c9             	movzbl %cl,%ecx
+  800e4f:	eb d7                	jmp    800e28 <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  800e51:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800e56:	be 00 00 00 00       	mov    $0x0,%esi
+  800e5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e61:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e64:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e67:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  800e69:	eb 95                	jmp    800e00 <sys_ipc_send+0x3c>
+
+00800e6b <sys_ipc_recv>:
+{
+  800e6b:	55                   	push   %ebp
+  800e6c:	89 e5                	mov    %esp,%ebp
+  800e6e:	57                   	push   %edi
+  800e6f:	56                   	push   %esi
+  800e70:	53                   	push   %ebx
+  800e71:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800e74:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800e7b:	78 36                	js     800eb3 <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  800e7d:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800e84:	74 79                	je     800eff <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  800e86:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e89:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e8e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e93:	89 cb                	mov    %ecx,%ebx
+  800e95:	89 cf                	mov    %ecx,%edi
+  800e97:	89 ce                	mov    %ecx,%esi
+  800e99:	55                   	push   %ebp
+  800e9a:	68 a3 0e 80 00       	push   $0x800ea3
+  800e9f:	89 e5                	mov    %esp,%ebp
+  800ea1:	0f 34                	sysenter
+  800ea3:	83 c4 04             	add    $0x4,%esp
+  800ea6:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ea7:	85 c0                	test   %eax,%eax
+  800ea9:	7f 6b                	jg     800f16 <sys_ipc_recv+0xab>
+}
+  800eab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eae:	5b                   	pop    %ebx
+  800eaf:	5e                   	pop    %esi
+  800eb0:	5f                   	pop    %edi
+  800eb1:	5d                   	pop    %ebp
+  800eb2:	c3                   	ret
+  800eb3:	b8 01 00 00 00       	mov    $0x1,%eax
+  800eb8:	0f a2                	cpuid
+		return 0;
+  800eba:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800ebf:	f6 c6 08             	test   $0x8,%dh
+  800ec2:	74 15                	je     800ed9 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ec4:	89 c2                	mov    %eax,%edx
+  800ec6:	c1 ea 08             	shr    $0x8,%edx
+  800ec9:	83 e2 0f             	and    $0xf,%edx
+  800ecc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ed1:	83 fa 06             	cmp    $0x6,%edx
+  800ed4:	74 0e                	je     800ee4 <sys_ipc_recv+0x79>
+  800ed6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800ed9:	0f b6 c9             	movzbl %cl,%ecx
+  800edc:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  800ee2:	eb 99                	jmp    800e7d <sys_ipc_recv+0x12>
+  800ee4:	89 c2                	mov    %eax,%edx
+  800ee6:	c1 ea 04             	shr    $0x4,%edx
+  800ee9:	83 e2 0f             	and    $0xf,%edx
+  800eec:	83 fa 02             	cmp    $0x2,%edx
+  800eef:	77 e5                	ja     800ed6 <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  800ef1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ef4:	83 f8 02             	cmp    $0x2,%eax
+  800ef7:	0f 97 c1             	seta   %cl
+  800efa:	0f b6 c9             	movzbl %cl,%ecx
+  800efd:	eb d7                	jmp    800ed6 <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  800eff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f04:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f09:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0c:	89 cb                	mov    %ecx,%ebx
+  800f0e:	89 cf                	mov    %ecx,%edi
+  800f10:	89 ce                	mov    %ecx,%esi
+  800f12:	cd 30                	int    $0x30
+  800f14:	eb 91                	jmp    800ea7 <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f16:	83 ec 0c             	sub    $0xc,%esp
+  800f19:	50                   	push   %eax
+  800f1a:	6a 0d                	push   $0xd
+  800f1c:	68 d8 27 80 00       	push   $0x8027d8
+  800f21:	6a 4a                	push   $0x4a
+  800f23:	68 f5 27 80 00       	push   $0x8027f5
+  800f28:	e8 ec 0c 00 00       	call   801c19 <_panic>
+
+00800f2d <sys_ipc_send_range>:
+{
+  800f2d:	55                   	push   %ebp
+  800f2e:	89 e5                	mov    %esp,%ebp
+  800f30:	57                   	push   %edi
+  800f31:	56                   	push   %esi
+  800f32:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800f33:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800f3a:	78 30                	js     800f6c <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  800f3c:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800f43:	74 73                	je     800fb8 <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  800f45:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f48:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  800f50:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f53:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f56:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f59:	55                   	push   %ebp
+  800f5a:	68 63 0f 80 00       	push   $0x800f63
+  800f5f:	89 e5                	mov    %esp,%ebp
+  800f61:	0f 34                	sysenter
+  800f63:	83 c4 04             	add    $0x4,%esp
+  800f66:	5d                   	pop    %ebp
+}
+  800f67:	5b                   	pop    %ebx
+  800f68:	5e                   	pop    %esi
+  800f69:	5f                   	pop    %edi
+  800f6a:	5d                   	pop    %ebp
+  800f6b:	c3                   	ret
+  800f6c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f71:	0f a2                	cpuid
+		return 0;
+  800f73:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f78:	f6 c6 08             	test   $0x8,%dh
+  800f7b:	74 15                	je     800f92 <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f7d:	89 c2                	mov    %eax,%edx
+  800f7f:	c1 ea 08             	shr    $0x8,%edx
+  800f82:	83 e2 0f             	and    $0xf,%edx
+  800f85:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f8a:	83 fa 06             	cmp    $0x6,%edx
+  800f8d:	74 0e                	je     800f9d <sys_ipc_send_range+0x70>
+  800f8f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f92:	0f b6 c9             	movzbl %cl,%ecx
+  800f95:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  800f9b:	eb 9f                	jmp    800f3c <sys_ipc_send_range+0xf>
+  800f9d:	89 c2                	mov    %eax,%edx
+  800f9f:	c1 ea 04             	shr    $0x4,%edx
+  800fa2:	83 e2 0f             	and    $0xf,%edx
+  800fa5:	83 fa 02             	cmp    $0x2,%edx
+  800fa8:	77 e5                	ja     800f8f <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  800faa:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800fad:	83 f8 02             	cmp    $0x2,%eax
+  800fb0:	0f 97 c1             	seta   %cl
+  800fb3:	0f b6 c9             	movzbl %cl,%ecx
+  800fb6:	eb d7                	jmp    800f8f <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  800fb8:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  800fbd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fc6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fc9:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fcc:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  800fce:	eb 97                	jmp    800f67 <sys_ipc_send_range+0x3a>
+
+00800fd0 <sys_ipc_recv_range>:
+{
+  800fd0:	55                   	push   %ebp
+  800fd1:	89 e5                	mov    %esp,%ebp
+  800fd3:	57                   	push   %edi
+  800fd4:	56                   	push   %esi
+  800fd5:	53                   	push   %ebx
+  800fd6:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800fd9:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800fe0:	78 37                	js     801019 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  800fe2:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  800fe9:	74 7a                	je     801065 <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  800feb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff6:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800ffb:	89 df                	mov    %ebx,%edi
+  800ffd:	89 de                	mov    %ebx,%esi
+  800fff:	55                   	push   %ebp
+  801000:	68 09 10 80 00       	push   $0x801009
+  801005:	89 e5                	mov    %esp,%ebp
+  801007:	0f 34                	sysenter
+  801009:	83 c4 04             	add    $0x4,%esp
+  80100c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80100d:	85 c0                	test   %eax,%eax
+  80100f:	7f 6c                	jg     80107d <sys_ipc_recv_range+0xad>
+}
+  801011:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801014:	5b                   	pop    %ebx
+  801015:	5e                   	pop    %esi
+  801016:	5f                   	pop    %edi
+  801017:	5d                   	pop    %ebp
+  801018:	c3                   	ret
+  801019:	b8 01 00 00 00       	mov    $0x1,%eax
+  80101e:	0f a2                	cpuid
+		return 0;
+  801020:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801025:	f6 c6 08             	test   $0x8,%dh
+  801028:	74 15                	je     80103f <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80102a:	89 c2                	mov    %eax,%edx
+  80102c:	c1 ea 08             	shr    $0x8,%edx
+  80102f:	83 e2 0f             	and    $0xf,%edx
+  801032:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801037:	83 fa 06             	cmp    $0x6,%edx
+  80103a:	74 0e                	je     80104a <sys_ipc_recv_range+0x7a>
+  80103c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80103f:	0f b6 c9             	movzbl %cl,%ecx
+  801042:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  801048:	eb 98                	jmp    800fe2 <sys_ipc_recv_range+0x12>
+  80104a:	89 c2                	mov    %eax,%edx
+  80104c:	c1 ea 04             	shr    $0x4,%edx
+  80104f:	83 e2 0f             	and    $0xf,%edx
+  801052:	83 fa 02             	cmp    $0x2,%edx
+  801055:	77 e5                	ja     80103c <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801057:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80105a:	83 f8 02             	cmp    $0x2,%eax
+  80105d:	0f 97 c1             	seta   %cl
+  801060:	0f b6 c9             	movzbl %cl,%ecx
+  801063:	eb d7                	jmp    80103c <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801065:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106a:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80106f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801072:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801075:	89 df                	mov    %ebx,%edi
+  801077:	89 de                	mov    %ebx,%esi
+  801079:	cd 30                	int    $0x30
+  80107b:	eb 90                	jmp    80100d <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80107d:	83 ec 0c             	sub    $0xc,%esp
+  801080:	50                   	push   %eax
+  801081:	6a 1f                	push   $0x1f
+  801083:	68 d8 27 80 00       	push   $0x8027d8
+  801088:	6a 4a                	push   $0x4a
+  80108a:	68 f5 27 80 00       	push   $0x8027f5
+  80108f:	e8 85 0b 00 00       	call   801c19 <_panic>
+
+00801094 <sys_ipc_call>:
+{
+  801094:	55                   	push   %ebp
+  801095:	89 e5                	mov    %esp,%ebp
+  801097:	57                   	push   %edi
+  801098:	56                   	push   %esi
+  801099:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80109a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8010a2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8010a5:	55                   	push   %ebp
+  8010a6:	56                   	push   %esi
+  8010a7:	8b 0e                	mov    (%esi),%ecx
+  8010a9:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8010ac:	8b 7e 08             	mov    0x8(%esi),%edi
+  8010af:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8010b2:	8b 76 0c             	mov    0xc(%esi),%esi
+  8010b5:	cd 30                	int    $0x30
+  8010b7:	87 34 24             	xchg   %esi,(%esp)
+  8010ba:	89 0e                	mov    %ecx,(%esi)
+  8010bc:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8010bf:	89 7e 08             	mov    %edi,0x8(%esi)
+  8010c2:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8010c5:	8f 46 0c             	pop    0xc(%esi)
+  8010c8:	5d                   	pop    %ebp
+}
+  8010c9:	5b                   	pop    %ebx
+  8010ca:	5e                   	pop    %esi
+  8010cb:	5f                   	pop    %edi
+  8010cc:	5d                   	pop    %ebp
+  8010cd:	c3                   	ret
+
+008010ce <sys_ipc_reply_wait>:
+{
+  8010ce:	55                   	push   %ebp
+  8010cf:	89 e5                	mov    %esp,%ebp
+  8010d1:	57                   	push   %edi
+  8010d2:	56                   	push   %esi
+  8010d3:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d7:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8010dc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8010df:	55                   	push   %ebp
+  8010e0:	56                   	push   %esi
+  8010e1:	8b 0e                	mov    (%esi),%ecx
+  8010e3:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8010e6:	8b 7e 08             	mov    0x8(%esi),%edi
+  8010e9:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8010ec:	8b 76 0c             	mov    0xc(%esi),%esi
+  8010ef:	cd 30                	int    $0x30
+  8010f1:	87 34 24             	xchg   %esi,(%esp)
+  8010f4:	89 0e                	mov    %ecx,(%esi)
+  8010f6:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8010f9:	89 7e 08             	mov    %edi,0x8(%esi)
+  8010fc:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8010ff:	8f 46 0c             	pop    0xc(%esi)
+  801102:	5d                   	pop    %ebp
+}
+  801103:	5b                   	pop    %ebx
+  801104:	5e                   	pop    %esi
+  801105:	5f                   	pop    %edi
+  801106:	5d                   	pop    %ebp
+  801107:	c3                   	ret
+
+00801108 <sys_ipc_send_msg>:
+{
+  801108:	55                   	push   %ebp
+  801109:	89 e5                	mov    %esp,%ebp
+  80110b:	57                   	push   %edi
+  80110c:	56                   	push   %esi
+  80110d:	53                   	push   %ebx
+  80110e:	83 ec 20             	sub    $0x20,%esp
+  801111:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801114:	8b 10                	mov    (%eax),%edx
+  801116:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801119:	8b 50 04             	mov    0x4(%eax),%edx
+  80111c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80111f:	8b 50 08             	mov    0x8(%eax),%edx
+  801122:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801125:	8b 50 0c             	mov    0xc(%eax),%edx
+  801128:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  80112b:	8b 40 10             	mov    0x10(%eax),%eax
+  80112e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801131:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801134:	8b 55 08             	mov    0x8(%ebp),%edx
+  801137:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80113c:	55                   	push   %ebp
+  80113d:	56                   	push   %esi
+  80113e:	8b 0e                	mov    (%esi),%ecx
+  801140:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801143:	8b 7e 08             	mov    0x8(%esi),%edi
+  801146:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801149:	8b 76 0c             	mov    0xc(%esi),%esi
+  80114c:	cd 30                	int    $0x30
+  80114e:	87 34 24             	xchg   %esi,(%esp)
+  801151:	89 0e                	mov    %ecx,(%esi)
+  801153:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801156:	89 7e 08             	mov    %edi,0x8(%esi)
+  801159:	89 6e 10             	mov    %ebp,0x10(%esi)
+  80115c:	8f 46 0c             	pop    0xc(%esi)
+  80115f:	5d                   	pop    %ebp
+}
+  801160:	83 c4 20             	add    $0x20,%esp
+  801163:	5b                   	pop    %ebx
+  801164:	5e                   	pop    %esi
+  801165:	5f                   	pop    %edi
+  801166:	5d                   	pop    %ebp
+  801167:	c3                   	ret
+
+00801168 <sys_fork>:
+{
+  801168:	55                   	push   %ebp
+  801169:	89 e5                	mov    %esp,%ebp
+  80116b:	57                   	push   %edi
+  80116c:	56                   	push   %esi
+  80116d:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80116e:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801175:	78 2e                	js     8011a5 <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801177:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80117e:	74 71                	je     8011f1 <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801180:	ba 00 00 00 00       	mov    $0x0,%edx
+  801185:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80118a:	89 d1                	mov    %edx,%ecx
+  80118c:	89 d3                	mov    %edx,%ebx
+  80118e:	89 d7                	mov    %edx,%edi
+  801190:	89 d6                	mov    %edx,%esi
+  801192:	55                   	push   %ebp
+  801193:	68 9c 11 80 00       	push   $0x80119c
+  801198:	89 e5                	mov    %esp,%ebp
+  80119a:	0f 34                	sysenter
+  80119c:	83 c4 04             	add    $0x4,%esp
+  80119f:	5d                   	pop    %ebp
+}
+  8011a0:	5b                   	pop    %ebx
+  8011a1:	5e                   	pop    %esi
+  8011a2:	5f                   	pop    %edi
+  8011a3:	5d                   	pop    %ebp
+  8011a4:	c3                   	ret
+  8011a5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011aa:	0f a2                	cpuid
+		return 0;
+  8011ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8011b1:	f6 c6 08             	test   $0x8,%dh
+  8011b4:	74 15                	je     8011cb <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011b6:	89 c2                	mov    %eax,%edx
+  8011b8:	c1 ea 08             	shr    $0x8,%edx
+  8011bb:	83 e2 0f             	and    $0xf,%edx
+  8011be:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011c3:	83 fa 06             	cmp    $0x6,%edx
+  8011c6:	74 0e                	je     8011d6 <sys_fork+0x6e>
+  8011c8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8011cb:	0f b6 c9             	movzbl %cl,%ecx
+  8011ce:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  8011d4:	eb a1                	jmp    801177 <sys_fork+0xf>
+  8011d6:	89 c2                	mov    %eax,%edx
+  8011d8:	c1 ea 04             	shr    $0x4,%edx
+  8011db:	83 e2 0f             	and    $0xf,%edx
+  8011de:	83 fa 02             	cmp    $0x2,%edx
+  8011e1:	77 e5                	ja     8011c8 <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  8011e3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011e6:	83 f8 02             	cmp    $0x2,%eax
+  8011e9:	0f 97 c1             	seta   %cl
+  8011ec:	0f b6 c9             	movzbl %cl,%ecx
+  8011ef:	eb d7                	jmp    8011c8 <sys_fork+0x60>
+		asm volatile("int %1\n"
+  8011f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011f6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011fb:	89 d1                	mov    %edx,%ecx
+  8011fd:	89 d3                	mov    %edx,%ebx
+  8011ff:	89 d7                	mov    %edx,%edi
+  801201:	89 d6                	mov    %edx,%esi
+  801203:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801205:	eb 99                	jmp    8011a0 <sys_fork+0x38>
+
+00801207 <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801207:	55                   	push   %ebp
+  801208:	89 e5                	mov    %esp,%ebp
+  80120a:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  80120d:	ff 75 14             	push   0x14(%ebp)
+  801210:	ff 75 10             	push   0x10(%ebp)
+  801213:	ff 75 0c             	push   0xc(%ebp)
+  801216:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80121b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801223:	e8 81 ee ff ff       	call   8000a9 <page_vec_call>
+}
+  801228:	c9                   	leave
+  801229:	c3                   	ret
+
+0080122a <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  80122a:	55                   	push   %ebp
+  80122b:	89 e5                	mov    %esp,%ebp
+  80122d:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801230:	ff 75 18             	push   0x18(%ebp)
+  801233:	ff 75 14             	push   0x14(%ebp)
+  801236:	ff 75 10             	push   0x10(%ebp)
+  801239:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80123c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123f:	b8 10 00 00 00       	mov    $0x10,%eax
+  801244:	e8 60 ee ff ff       	call   8000a9 <page_vec_call>
+}
+  801249:	c9                   	leave
+  80124a:	c3                   	ret
+
+0080124b <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  80124b:	55                   	push   %ebp
+  80124c:	89 e5                	mov    %esp,%ebp
+  80124e:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801251:	ff 75 14             	push   0x14(%ebp)
+  801254:	ff 75 10             	push   0x10(%ebp)
+  801257:	ff 75 0c             	push   0xc(%ebp)
+  80125a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80125f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801262:	b8 11 00 00 00       	mov    $0x11,%eax
+  801267:	e8 3d ee ff ff       	call   8000a9 <page_vec_call>
+}
+  80126c:	c9                   	leave
+  80126d:	c3                   	ret
+
+0080126e <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  80126e:	55                   	push   %ebp
+  80126f:	89 e5                	mov    %esp,%ebp
+  801271:	57                   	push   %edi
+  801272:	56                   	push   %esi
+  801273:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801274:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80127b:	78 32                	js     8012af <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  80127d:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801284:	74 75                	je     8012fb <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801286:	8b 55 08             	mov    0x8(%ebp),%edx
+  801289:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80128c:	b8 12 00 00 00       	mov    $0x12,%eax
+  801291:	be 00 00 00 00       	mov    $0x0,%esi
+  801296:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801299:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80129c:	55                   	push   %ebp
+  80129d:	68 a6 12 80 00       	push   $0x8012a6
+  8012a2:	89 e5                	mov    %esp,%ebp
+  8012a4:	0f 34                	sysenter
+  8012a6:	83 c4 04             	add    $0x4,%esp
+  8012a9:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  8012aa:	5b                   	pop    %ebx
+  8012ab:	5e                   	pop    %esi
+  8012ac:	5f                   	pop    %edi
+  8012ad:	5d                   	pop    %ebp
+  8012ae:	c3                   	ret
+  8012af:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012b4:	0f a2                	cpuid
+		return 0;
+  8012b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8012bb:	f6 c6 08             	test   $0x8,%dh
+  8012be:	74 15                	je     8012d5 <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012c0:	89 c2                	mov    %eax,%edx
+  8012c2:	c1 ea 08             	shr    $0x8,%edx
+  8012c5:	83 e2 0f             	and    $0xf,%edx
+  8012c8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012cd:	83 fa 06             	cmp    $0x6,%edx
+  8012d0:	74 0e                	je     8012e0 <sys_vm_ranges+0x72>
+  8012d2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8012d5:	0f b6 c9             	movzbl %cl,%ecx
+  8012d8:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  8012de:	eb 9d                	jmp    80127d <sys_vm_ranges+0xf>
+  8012e0:	89 c2                	mov    %eax,%edx
+  8012e2:	c1 ea 04             	shr    $0x4,%edx
+  8012e5:	83 e2 0f             	and    $0xf,%edx
+  8012e8:	83 fa 02             	cmp    $0x2,%edx
+  8012eb:	77 e5                	ja     8012d2 <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  8012ed:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012f0:	83 f8 02             	cmp    $0x2,%eax
+  8012f3:	0f 97 c1             	seta   %cl
+  8012f6:	0f b6 c9             	movzbl %cl,%ecx
+  8012f9:	eb d7                	jmp    8012d2 <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  8012fb:	b8 12 00 00 00       	mov    $0x12,%eax
+  801300:	be 00 00 00 00       	mov    $0x0,%esi
+  801305:	8b 55 08             	mov    0x8(%ebp),%edx
+  801308:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80130b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80130e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801311:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801313:	eb 95                	jmp    8012aa <sys_vm_ranges+0x3c>
+
+00801315 <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801315:	55                   	push   %ebp
+  801316:	89 e5                	mov    %esp,%ebp
+  801318:	57                   	push   %edi
+  801319:	56                   	push   %esi
+  80131a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80131b:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801322:	78 31                	js     801355 <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801324:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80132b:	74 74                	je     8013a1 <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  80132d:	be 00 00 00 00       	mov    $0x0,%esi
+  801332:	8b 55 08             	mov    0x8(%ebp),%edx
+  801335:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801338:	b8 14 00 00 00       	mov    $0x14,%eax
+  80133d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801340:	89 f7                	mov    %esi,%edi
+  801342:	55                   	push   %ebp
+  801343:	68 4c 13 80 00       	push   $0x80134c
+  801348:	89 e5                	mov    %esp,%ebp
+  80134a:	0f 34                	sysenter
+  80134c:	83 c4 04             	add    $0x4,%esp
+  80134f:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801350:	5b                   	pop    %ebx
+  801351:	5e                   	pop    %esi
+  801352:	5f                   	pop    %edi
+  801353:	5d                   	pop    %ebp
+  801354:	c3                   	ret
+  801355:	b8 01 00 00 00       	mov    $0x1,%eax
+  80135a:	0f a2                	cpuid
+		return 0;
+  80135c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801361:	f6 c6 08             	test   $0x8,%dh
+  801364:	74 15                	je     80137b <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801366:	89 c2                	mov    %eax,%edx
+  801368:	c1 ea 08             	shr    $0x8,%edx
+  80136b:	83 e2 0f             	and    $0xf,%edx
+  80136e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801373:	83 fa 06             	cmp    $0x6,%edx
+  801376:	74 0e                	je     801386 <sys_spawn+0x71>
+  801378:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80137b:	0f b6 c9             	movzbl %cl,%ecx
+  80137e:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  801384:	eb 9e                	jmp    801324 <sys_spawn+0xf>
+  801386:	89 c2                	mov    %eax,%edx
+  801388:	c1 ea 04             	shr    $0x4,%edx
+  80138b:	83 e2 0f             	and    $0xf,%edx
+  80138e:	83 fa 02             	cmp    $0x2,%edx
+  801391:	77 e5                	ja     801378 <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  801393:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801396:	83 f8 02             	cmp    $0x2,%eax
+  801399:	0f 97 c1             	seta   %cl
+  80139c:	0f b6 c9             	movzbl %cl,%ecx
+  80139f:	eb d7                	jmp    801378 <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  8013a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a6:	b8 14 00 00 00       	mov    $0x14,%eax
+  8013ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013b4:	89 f7                	mov    %esi,%edi
+  8013b6:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  8013b8:	eb 96                	jmp    801350 <sys_spawn+0x3b>
+
+008013ba <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  8013ba:	55                   	push   %ebp
+  8013bb:	89 e5                	mov    %esp,%ebp
+  8013bd:	57                   	push   %edi
+  8013be:	56                   	push   %esi
+  8013bf:	53                   	push   %ebx
+  8013c0:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8013c3:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8013ca:	78 37                	js     801403 <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  8013cc:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8013d3:	74 7a                	je     80144f <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  8013d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e0:	b8 15 00 00 00       	mov    $0x15,%eax
+  8013e5:	89 df                	mov    %ebx,%edi
+  8013e7:	89 de                	mov    %ebx,%esi
+  8013e9:	55                   	push   %ebp
+  8013ea:	68 f3 13 80 00       	push   $0x8013f3
+  8013ef:	89 e5                	mov    %esp,%ebp
+  8013f1:	0f 34                	sysenter
+  8013f3:	83 c4 04             	add    $0x4,%esp
+  8013f6:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8013f7:	85 c0                	test   %eax,%eax
+  8013f9:	7f 6c                	jg     801467 <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  8013fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013fe:	5b                   	pop    %ebx
+  8013ff:	5e                   	pop    %esi
+  801400:	5f                   	pop    %edi
+  801401:	5d                   	pop    %ebp
+  801402:	c3                   	ret
+  801403:	b8 01 00 00 00       	mov    $0x1,%eax
+  801408:	0f a2                	cpuid
+		return 0;
+  80140a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80140f:	f6 c6 08             	test   $0x8,%dh
+  801412:	74 15                	je     801429 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801414:	89 c2                	mov    %eax,%edx
+  801416:	c1 ea 08             	shr    $0x8,%edx
+  801419:	83 e2 0f             	and    $0xf,%edx
+  80141c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801421:	83 fa 06             	cmp    $0x6,%edx
+  801424:	74 0e                	je     801434 <sys_shm_create+0x7a>
+  801426:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801429:	0f b6 c9             	movzbl %cl,%ecx
+  80142c:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  801432:	eb 98                	jmp    8013cc <sys_shm_create+0x12>
+  801434:	89 c2                	mov    %eax,%edx
+  801436:	c1 ea 04             	shr    $0x4,%edx
+  801439:	83 e2 0f             	and    $0xf,%edx
+  80143c:	83 fa 02             	cmp    $0x2,%edx
+  80143f:	77 e5                	ja     801426 <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  801441:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801444:	83 f8 02             	cmp    $0x2,%eax
+  801447:	0f 97 c1             	seta   %cl
+  80144a:	0f b6 c9             	movzbl %cl,%ecx
+  80144d:	eb d7                	jmp    801426 <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  80144f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801454:	b8 15 00 00 00       	mov    $0x15,%eax
+  801459:	8b 55 08             	mov    0x8(%ebp),%edx
+  80145c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80145f:	89 df                	mov    %ebx,%edi
+  801461:	89 de                	mov    %ebx,%esi
+  801463:	cd 30                	int    $0x30
+  801465:	eb 90                	jmp    8013f7 <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801467:	83 ec 0c             	sub    $0xc,%esp
+  80146a:	50                   	push   %eax
+  80146b:	6a 15                	push   $0x15
+  80146d:	68 d8 27 80 00       	push   $0x8027d8
+  801472:	6a 4a                	push   $0x4a
+  801474:	68 f5 27 80 00       	push   $0x8027f5
+  801479:	e8 9b 07 00 00       	call   801c19 <_panic>
+
+0080147e <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  80147e:	55                   	push   %ebp
+  80147f:	89 e5                	mov    %esp,%ebp
+  801481:	57                   	push   %edi
+  801482:	56                   	push   %esi
+  801483:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801484:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80148b:	78 32                	js     8014bf <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  80148d:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801494:	74 75                	je     80150b <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801496:	8b 55 08             	mov    0x8(%ebp),%edx
+  801499:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80149c:	b8 16 00 00 00       	mov    $0x16,%eax
+  8014a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014a9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014ac:	55                   	push   %ebp
+  8014ad:	68 b6 14 80 00       	push   $0x8014b6
+  8014b2:	89 e5                	mov    %esp,%ebp
+  8014b4:	0f 34                	sysenter
+  8014b6:	83 c4 04             	add    $0x4,%esp
+  8014b9:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  8014ba:	5b                   	pop    %ebx
+  8014bb:	5e                   	pop    %esi
+  8014bc:	5f                   	pop    %edi
+  8014bd:	5d                   	pop    %ebp
+  8014be:	c3                   	ret
+  8014bf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014c4:	0f a2                	cpuid
+		return 0;
+  8014c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8014cb:	f6 c6 08             	test   $0x8,%dh
+  8014ce:	74 15                	je     8014e5 <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014d0:	89 c2                	mov    %eax,%edx
+  8014d2:	c1 ea 08             	shr    $0x8,%edx
+  8014d5:	83 e2 0f             	and    $0xf,%edx
+  8014d8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8014dd:	83 fa 06             	cmp    $0x6,%edx
+  8014e0:	74 0e                	je     8014f0 <sys_shm_attach+0x72>
+  8014e2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8014e5:	0f b6 c9             	movzbl %cl,%ecx
+  8014e8:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  8014ee:	eb 9d                	jmp    80148d <sys_shm_attach+0xf>
+  8014f0:	89 c2                	mov    %eax,%edx
+  8014f2:	c1 ea 04             	shr    $0x4,%edx
+  8014f5:	83 e2 0f             	and    $0xf,%edx
+  8014f8:	83 fa 02             	cmp    $0x2,%edx
+  8014fb:	77 e5                	ja     8014e2 <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  8014fd:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801500:	83 f8 02             	cmp    $0x2,%eax
+  801503:	0f 97 c1             	seta   %cl
+  801506:	0f b6 c9             	movzbl %cl,%ecx
+  801509:	eb d7                	jmp    8014e2 <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  80150b:	b8 16 00 00 00       	mov    $0x16,%eax
+  801510:	be 00 00 00 00       	mov    $0x0,%esi
+  801515:	8b 55 08             	mov    0x8(%ebp),%edx
+  801518:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80151b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80151e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801521:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  801523:	eb 95                	jmp    8014ba <sys_shm_attach+0x3c>
+
+00801525 <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  801525:	55                   	push   %ebp
+  801526:	89 e5                	mov    %esp,%ebp
+  801528:	57                   	push   %edi
+  801529:	56                   	push   %esi
+  80152a:	53                   	push   %ebx
+  80152b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80152e:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801535:	78 38                	js     80156f <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  801537:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80153e:	74 7b                	je     8015bb <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  801540:	be 00 00 00 00       	mov    $0x0,%esi
+  801545:	8b 55 08             	mov    0x8(%ebp),%edx
+  801548:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80154b:	b8 17 00 00 00       	mov    $0x17,%eax
+  801550:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801553:	89 f7                	mov    %esi,%edi
+  801555:	55                   	push   %ebp
+  801556:	68 5f 15 80 00       	push   $0x80155f
+  80155b:	89 e5                	mov    %esp,%ebp
+  80155d:	0f 34                	sysenter
+  80155f:	83 c4 04             	add    $0x4,%esp
+  801562:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801563:	85 c0                	test   %eax,%eax
+  801565:	7f 6d                	jg     8015d4 <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  801567:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80156a:	5b                   	pop    %ebx
+  80156b:	5e                   	pop    %esi
+  80156c:	5f                   	pop    %edi
+  80156d:	5d                   	pop    %ebp
+  80156e:	c3                   	ret
+  80156f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801574:	0f a2                	cpuid
+		return 0;
+  801576:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80157b:	f6 c6 08             	test   $0x8,%dh
+  80157e:	74 15                	je     801595 <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801580:	89 c2                	mov    %eax,%edx
+  801582:	c1 ea 08             	shr    $0x8,%edx
+  801585:	83 e2 0f             	and    $0xf,%edx
+  801588:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80158d:	83 fa 06             	cmp    $0x6,%edx
+  801590:	74 0e                	je     8015a0 <sys_shm_detach+0x7b>
+  801592:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801595:	0f b6 c9             	movzbl %cl,%ecx
+  801598:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  80159e:	eb 97                	jmp    801537 <sys_shm_detach+0x12>
+  8015a0:	89 c2                	mov    %eax,%edx
+  8015a2:	c1 ea 04             	shr    $0x4,%edx
+  8015a5:	83 e2 0f             	and    $0xf,%edx
+  8015a8:	83 fa 02             	cmp    $0x2,%edx
+  8015ab:	77 e5                	ja     801592 <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  8015ad:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015b0:	83 f8 02             	cmp    $0x2,%eax
+  8015b3:	0f 97 c1             	seta   %cl
+  8015b6:	0f b6 c9             	movzbl %cl,%ecx
+  8015b9:	eb d7                	jmp    801592 <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  8015bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8015c0:	b8 17 00 00 00       	mov    $0x17,%eax
+  8015c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015cb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015ce:	89 f7                	mov    %esi,%edi
+  8015d0:	cd 30                	int    $0x30
+  8015d2:	eb 8f                	jmp    801563 <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015d4:	83 ec 0c             	sub    $0xc,%esp
+  8015d7:	50                   	push   %eax
+  8015d8:	6a 17                	push   $0x17
+  8015da:	68 d8 27 80 00       	push   $0x8027d8
+  8015df:	6a 4a                	push   $0x4a
+  8015e1:	68 f5 27 80 00       	push   $0x8027f5
+  8015e6:	e8 2e 06 00 00       	call   801c19 <_panic>
+
+008015eb <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  8015eb:	55                   	push   %ebp
+  8015ec:	89 e5                	mov    %esp,%ebp
+  8015ee:	57                   	push   %edi
+  8015ef:	56                   	push   %esi
+  8015f0:	53                   	push   %ebx
+  8015f1:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8015f4:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8015fb:	78 36                	js     801633 <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  8015fd:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801604:	74 79                	je     80167f <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  801606:	8b 55 08             	mov    0x8(%ebp),%edx
+  801609:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80160e:	b8 18 00 00 00       	mov    $0x18,%eax
+  801613:	89 cb                	mov    %ecx,%ebx
+  801615:	89 cf                	mov    %ecx,%edi
+  801617:	89 ce                	mov    %ecx,%esi
+  801619:	55                   	push   %ebp
+  80161a:	68 23 16 80 00       	push   $0x801623
+  80161f:	89 e5                	mov    %esp,%ebp
+  801621:	0f 34                	sysenter
+  801623:	83 c4 04             	add    $0x4,%esp
+  801626:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801627:	85 c0                	test   %eax,%eax
+  801629:	7f 6b                	jg     801696 <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  80162b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80162e:	5b                   	pop    %ebx
+  80162f:	5e                   	pop    %esi
+  801630:	5f                   	pop    %edi
+  801631:	5d                   	pop    %ebp
+  801632:	c3                   	ret
+  801633:	b8 01 00 00 00       	mov    $0x1,%eax
+  801638:	0f a2                	cpuid
+		return 0;
+  80163a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80163f:	f6 c6 08             	test   $0x8,%dh
+  801642:	74 15                	je     801659 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801644:	89 c2                	mov    %eax,%edx
+  801646:	c1 ea 08             	shr    $0x8,%edx
+  801649:	83 e2 0f             	and    $0xf,%edx
+  80164c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801651:	83 fa 06             	cmp    $0x6,%edx
+  801654:	74 0e                	je     801664 <sys_shm_remove+0x79>
+  801656:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801659:	0f b6 c9             	movzbl %cl,%ecx
+  80165c:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  801662:	eb 99                	jmp    8015fd <sys_shm_remove+0x12>
+  801664:	89 c2                	mov    %eax,%edx
+  801666:	c1 ea 04             	shr    $0x4,%edx
+  801669:	83 e2 0f             	and    $0xf,%edx
+  80166c:	83 fa 02             	cmp    $0x2,%edx
+  80166f:	77 e5                	ja     801656 <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  801671:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801674:	83 f8 02             	cmp    $0x2,%eax
+  801677:	0f 97 c1             	seta   %cl
+  80167a:	0f b6 c9             	movzbl %cl,%ecx
+  80167d:	eb d7                	jmp    801656 <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  80167f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801684:	b8 18 00 00 00       	mov    $0x18,%eax
+  801689:	8b 55 08             	mov    0x8(%ebp),%edx
+  80168c:	89 cb                	mov    %ecx,%ebx
+  80168e:	89 cf                	mov    %ecx,%edi
+  801690:	89 ce                	mov    %ecx,%esi
+  801692:	cd 30                	int    $0x30
+  801694:	eb 91                	jmp    801627 <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801696:	83 ec 0c             	sub    $0xc,%esp
+  801699:	50                   	push   %eax
+  80169a:	6a 18                	push   $0x18
+  80169c:	68 d8 27 80 00       	push   $0x8027d8
+  8016a1:	6a 4a                	push   $0x4a
+  8016a3:	68 f5 27 80 00       	push   $0x8027f5
+  8016a8:	e8 6c 05 00 00       	call   801c19 <_panic>
+
+008016ad <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  8016ad:	55                   	push   %ebp
+  8016ae:	89 e5                	mov    %esp,%ebp
+  8016b0:	57                   	push   %edi
+  8016b1:	56                   	push   %esi
+  8016b2:	53                   	push   %ebx
+  8016b3:	83 ec 0c             	sub    $0xc,%esp
+  8016b6:	8b 45 10             	mov    0x10(%ebp),%eax
+  8016b9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8016bc:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  8016bf:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8016c6:	78 32                	js     8016fa <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  8016c8:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8016cf:	74 75                	je     801746 <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  8016d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016d7:	b8 20 00 00 00       	mov    $0x20,%eax
+  8016dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8016e1:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8016e4:	55                   	push   %ebp
+  8016e5:	68 ee 16 80 00       	push   $0x8016ee
+  8016ea:	89 e5                	mov    %esp,%ebp
+  8016ec:	0f 34                	sysenter
+  8016ee:	83 c4 04             	add    $0x4,%esp
+  8016f1:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  8016f2:	83 c4 0c             	add    $0xc,%esp
+  8016f5:	5b                   	pop    %ebx
+  8016f6:	5e                   	pop    %esi
+  8016f7:	5f                   	pop    %edi
+  8016f8:	5d                   	pop    %ebp
+  8016f9:	c3                   	ret
+  8016fa:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016ff:	0f a2                	cpuid
+		return 0;
+  801701:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801706:	f6 c6 08             	test   $0x8,%dh
+  801709:	74 15                	je     801720 <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80170b:	89 c2                	mov    %eax,%edx
+  80170d:	c1 ea 08             	shr    $0x8,%edx
+  801710:	83 e2 0f             	and    $0xf,%edx
+  801713:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801718:	83 fa 06             	cmp    $0x6,%edx
+  80171b:	74 0e                	je     80172b <sys_futex_wait+0x7e>
+  80171d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801720:	0f b6 c9             	movzbl %cl,%ecx
+  801723:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  801729:	eb 9d                	jmp    8016c8 <sys_futex_wait+0x1b>
+  80172b:	89 c2                	mov    %eax,%edx
+  80172d:	c1 ea 04             	shr    $0x4,%edx
+  801730:	83 e2 0f             	and    $0xf,%edx
+  801733:	83 fa 02             	cmp    $0x2,%edx
+  801736:	77 e5                	ja     80171d <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  801738:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80173b:	83 f8 02             	cmp    $0x2,%eax
+  80173e:	0f 97 c1             	seta   %cl
+  801741:	0f b6 c9             	movzbl %cl,%ecx
+  801744:	eb d7                	jmp    80171d <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  801746:	b8 20 00 00 00       	mov    $0x20,%eax
+  80174b:	be 00 00 00 00       	mov    $0x0,%esi
+  801750:	8b 55 08             	mov    0x8(%ebp),%edx
+  801753:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801756:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  801759:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  80175b:	eb 95                	jmp    8016f2 <sys_futex_wait+0x45>
+
+0080175d <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80175d:	55                   	push   %ebp
+  80175e:	89 e5                	mov    %esp,%ebp
+  801760:	57                   	push   %edi
+  801761:	56                   	push   %esi
+  801762:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801763:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80176a:	78 30                	js     80179c <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  80176c:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801773:	74 73                	je     8017e8 <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801775:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80177a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80177d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801780:	b8 21 00 00 00       	mov    $0x21,%eax
+  801785:	89 df                	mov    %ebx,%edi
+  801787:	89 de                	mov    %ebx,%esi
+  801789:	55                   	push   %ebp
+  80178a:	68 93 17 80 00       	push   $0x801793
+  80178f:	89 e5                	mov    %esp,%ebp
+  801791:	0f 34                	sysenter
+  801793:	83 c4 04             	add    $0x4,%esp
+  801796:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801797:	5b                   	pop    %ebx
+  801798:	5e                   	pop    %esi
+  801799:	5f                   	pop    %edi
+  80179a:	5d                   	pop    %ebp
+  80179b:	c3                   	ret
+  80179c:	b8 01 00 00 00       	mov    $0x1,%eax
+  8017a1:	0f a2                	cpuid
+		return 0;
+  8017a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8017a8:	f6 c6 08             	test   $0x8,%dh
+  8017ab:	74 15                	je     8017c2 <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017ad:	89 c2                	mov    %eax,%edx
+  8017af:	c1 ea 08             	shr    $0x8,%edx
+  8017b2:	83 e2 0f             	and    $0xf,%edx
+  8017b5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017ba:	83 fa 06             	cmp    $0x6,%edx
+  8017bd:	74 0e                	je     8017cd <sys_futex_wake+0x70>
+  8017bf:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8017c2:	0f b6 c9             	movzbl %cl,%ecx
+  8017c5:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  8017cb:	eb 9f                	jmp    80176c <sys_futex_wake+0xf>
+  8017cd:	89 c2                	mov    %eax,%edx
+  8017cf:	c1 ea 04             	shr    $0x4,%edx
+  8017d2:	83 e2 0f             	and    $0xf,%edx
+  8017d5:	83 fa 02             	cmp    $0x2,%edx
+  8017d8:	77 e5                	ja     8017bf <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  8017da:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017dd:	83 f8 02             	cmp    $0x2,%eax
+  8017e0:	0f 97 c1             	seta   %cl
+  8017e3:	0f b6 c9             	movzbl %cl,%ecx
+  8017e6:	eb d7                	jmp    8017bf <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  8017e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ed:	b8 21 00 00 00       	mov    $0x21,%eax
+  8017f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017f8:	89 df                	mov    %ebx,%edi
+  8017fa:	89 de                	mov    %ebx,%esi
+  8017fc:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  8017fe:	eb 97                	jmp    801797 <sys_futex_wake+0x3a>
+
+00801800 <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  801800:	55                   	push   %ebp
+  801801:	89 e5                	mov    %esp,%ebp
+  801803:	57                   	push   %edi
+  801804:	56                   	push   %esi
+  801805:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801806:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80180d:	78 2e                	js     80183d <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  80180f:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801816:	74 71                	je     801889 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  801818:	ba 00 00 00 00       	mov    $0x0,%edx
+  80181d:	b8 22 00 00 00       	mov    $0x22,%eax
+  801822:	89 d1                	mov    %edx,%ecx
+  801824:	89 d3                	mov    %edx,%ebx
+  801826:	89 d7                	mov    %edx,%edi
+  801828:	89 d6                	mov    %edx,%esi
+  80182a:	55                   	push   %ebp
+  80182b:	68 34 18 80 00       	push   $0x801834
+  801830:	89 e5                	mov    %esp,%ebp
+  801832:	0f 34                	sysenter
+  801834:	83 c4 04             	add    $0x4,%esp
+  801837:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  801838:	5b                   	pop    %ebx
+  801839:	5e                   	pop    %esi
+  80183a:	5f                   	pop    %edi
+  80183b:	5d                   	pop    %ebp
+  80183c:	c3                   	ret
+  80183d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801842:	0f a2                	cpuid
+		return 0;
+  801844:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801849:	f6 c6 08             	test   $0x8,%dh
+  80184c:	74 15                	je     801863 <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80184e:	89 c2                	mov    %eax,%edx
+  801850:	c1 ea 08             	shr    $0x8,%edx
+  801853:	83 e2 0f             	and    $0xf,%edx
+  801856:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80185b:	83 fa 06             	cmp    $0x6,%edx
+  80185e:	74 0e                	je     80186e <sys_ep_create+0x6e>
+  801860:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801863:	0f b6 c9             	movzbl %cl,%ecx
+  801866:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  80186c:	eb a1                	jmp    80180f <sys_ep_create+0xf>
+  80186e:	89 c2                	mov    %eax,%edx
+  801870:	c1 ea 04             	shr    $0x4,%edx
+  801873:	83 e2 0f             	and    $0xf,%edx
+  801876:	83 fa 02             	cmp    $0x2,%edx
+  801879:	77 e5                	ja     801860 <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  80187b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80187e:	83 f8 02             	cmp    $0x2,%eax
+  801881:	0f 97 c1             	seta   %cl
+  801884:	0f b6 c9             	movzbl %cl,%ecx
+  801887:	eb d7                	jmp    801860 <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  801889:	ba 00 00 00 00       	mov    $0x0,%edx
+  80188e:	b8 22 00 00 00       	mov    $0x22,%eax
+  801893:	89 d1                	mov    %edx,%ecx
+  801895:	89 d3                	mov    %edx,%ebx
+  801897:	89 d7                	mov    %edx,%edi
+  801899:	89 d6                	mov    %edx,%esi
+  80189b:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  80189d:	eb 99                	jmp    801838 <sys_ep_create+0x38>
+
+0080189f <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  80189f:	55                   	push   %ebp
+  8018a0:	89 e5                	mov    %esp,%ebp
+  8018a2:	57                   	push   %edi
+  8018a3:	56                   	push   %esi
+  8018a4:	53                   	push   %ebx
+  8018a5:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8018a8:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8018af:	78 36                	js     8018e7 <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  8018b1:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  8018b8:	74 79                	je     801933 <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  8018ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018c2:	b8 23 00 00 00       	mov    $0x23,%eax
+  8018c7:	89 cb                	mov    %ecx,%ebx
+  8018c9:	89 cf                	mov    %ecx,%edi
+  8018cb:	89 ce                	mov    %ecx,%esi
+  8018cd:	55                   	push   %ebp
+  8018ce:	68 d7 18 80 00       	push   $0x8018d7
+  8018d3:	89 e5                	mov    %esp,%ebp
+  8018d5:	0f 34                	sysenter
+  8018d7:	83 c4 04             	add    $0x4,%esp
+  8018da:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8018db:	85 c0                	test   %eax,%eax
+  8018dd:	7f 6b                	jg     80194a <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  8018df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018e2:	5b                   	pop    %ebx
+  8018e3:	5e                   	pop    %esi
+  8018e4:	5f                   	pop    %edi
+  8018e5:	5d                   	pop    %ebp
+  8018e6:	c3                   	ret
+  8018e7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018ec:	0f a2                	cpuid
+		return 0;
+  8018ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018f3:	f6 c6 08             	test   $0x8,%dh
+  8018f6:	74 15                	je     80190d <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018f8:	89 c2                	mov    %eax,%edx
+  8018fa:	c1 ea 08             	shr    $0x8,%edx
+  8018fd:	83 e2 0f             	and    $0xf,%edx
+  801900:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801905:	83 fa 06             	cmp    $0x6,%edx
+  801908:	74 0e                	je     801918 <sys_ep_destroy+0x79>
+  80190a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80190d:	0f b6 c9             	movzbl %cl,%ecx
+  801910:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  801916:	eb 99                	jmp    8018b1 <sys_ep_destroy+0x12>
+  801918:	89 c2                	mov    %eax,%edx
+  80191a:	c1 ea 04             	shr    $0x4,%edx
+  80191d:	83 e2 0f             	and    $0xf,%edx
+  801920:	83 fa 02             	cmp    $0x2,%edx
+  801923:	77 e5                	ja     80190a <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  801925:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801928:	83 f8 02             	cmp    $0x2,%eax
+  80192b:	0f 97 c1             	seta   %cl
+  80192e:	0f b6 c9             	movzbl %cl,%ecx
+  801931:	eb d7                	jmp    80190a <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  801933:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801938:	b8 23 00 00 00       	mov    $0x23,%eax
+  80193d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801940:	89 cb                	mov    %ecx,%ebx
+  801942:	89 cf                	mov    %ecx,%edi
+  801944:	89 ce                	mov    %ecx,%esi
+  801946:	cd 30                	int    $0x30
+  801948:	eb 91                	jmp    8018db <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80194a:	83 ec 0c             	sub    $0xc,%esp
+  80194d:	50                   	push   %eax
+  80194e:	6a 23                	push   $0x23
+  801950:	68 d8 27 80 00       	push   $0x8027d8
+  801955:	6a 4a                	push   $0x4a
+  801957:	68 f5 27 80 00       	push   $0x8027f5
+  80195c:	e8 b8 02 00 00       	call   801c19 <_panic>
+
+00801961 <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  801961:	55                   	push   %ebp
+  801962:	89 e5                	mov    %esp,%ebp
+  801964:	57                   	push   %edi
+  801965:	56                   	push   %esi
+  801966:	53                   	push   %ebx
+  801967:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80196a:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801971:	78 37                	js     8019aa <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  801973:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  80197a:	74 7a                	je     8019f6 <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  80197c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801981:	8b 55 08             	mov    0x8(%ebp),%edx
+  801984:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801987:	b8 24 00 00 00       	mov    $0x24,%eax
+  80198c:	89 df                	mov    %ebx,%edi
+  80198e:	89 de                	mov    %ebx,%esi
+  801990:	55                   	push   %ebp
+  801991:	68 9a 19 80 00       	push   $0x80199a
+  801996:	89 e5                	mov    %esp,%ebp
+  801998:	0f 34                	sysenter
+  80199a:	83 c4 04             	add    $0x4,%esp
+  80199d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80199e:	85 c0                	test   %eax,%eax
+  8019a0:	7f 6c                	jg     801a0e <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  8019a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019a5:	5b                   	pop    %ebx
+  8019a6:	5e                   	pop    %esi
+  8019a7:	5f                   	pop    %edi
+  8019a8:	5d                   	pop    %ebp
+  8019a9:	c3                   	ret
+  8019aa:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019af:	0f a2                	cpuid
+		return 0;
+  8019b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8019b6:	f6 c6 08             	test   $0x8,%dh
+  8019b9:	74 15                	je     8019d0 <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019bb:	89 c2                	mov    %eax,%edx
+  8019bd:	c1 ea 08             	shr    $0x8,%edx
+  8019c0:	83 e2 0f             	and    $0xf,%edx
+  8019c3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019c8:	83 fa 06             	cmp    $0x6,%edx
+  8019cb:	74 0e                	je     8019db <sys_ep_grant+0x7a>
+  8019cd:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8019d0:	0f b6 c9             	movzbl %cl,%ecx
+  8019d3:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  8019d9:	eb 98                	jmp    801973 <sys_ep_grant+0x12>
+  8019db:	89 c2                	mov    %eax,%edx
+  8019dd:	c1 ea 04             	shr    $0x4,%edx
+  8019e0:	83 e2 0f             	and    $0xf,%edx
+  8019e3:	83 fa 02             	cmp    $0x2,%edx
+  8019e6:	77 e5                	ja     8019cd <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  8019e8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019eb:	83 f8 02             	cmp    $0x2,%eax
+  8019ee:	0f 97 c1             	seta   %cl
+  8019f1:	0f b6 c9             	movzbl %cl,%ecx
+  8019f4:	eb d7                	jmp    8019cd <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  8019f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019fb:	b8 24 00 00 00       	mov    $0x24,%eax
+  801a00:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a03:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a06:	89 df                	mov    %ebx,%edi
+  801a08:	89 de                	mov    %ebx,%esi
+  801a0a:	cd 30                	int    $0x30
+  801a0c:	eb 90                	jmp    80199e <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a0e:	83 ec 0c             	sub    $0xc,%esp
+  801a11:	50                   	push   %eax
+  801a12:	6a 24                	push   $0x24
+  801a14:	68 d8 27 80 00       	push   $0x8027d8
+  801a19:	6a 4a                	push   $0x4a
+  801a1b:	68 f5 27 80 00       	push   $0x8027f5
+  801a20:	e8 f4 01 00 00       	call   801c19 <_panic>
+
+00801a25 <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  801a25:	55                   	push   %ebp
+  801a26:	89 e5                	mov    %esp,%ebp
+  801a28:	57                   	push   %edi
+  801a29:	56                   	push   %esi
+  801a2a:	53                   	push   %ebx
+  801a2b:	83 ec 20             	sub    $0x20,%esp
+  801a2e:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801a31:	8b 10                	mov    (%eax),%edx
+  801a33:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801a36:	8b 50 04             	mov    0x4(%eax),%edx
+  801a39:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801a3c:	8b 50 08             	mov    0x8(%eax),%edx
+  801a3f:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801a42:	8b 50 0c             	mov    0xc(%eax),%edx
+  801a45:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801a48:	8b 40 10             	mov    0x10(%eax),%eax
+  801a4b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801a4e:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801a51:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a54:	b8 25 00 00 00       	mov    $0x25,%eax
+  801a59:	55                   	push   %ebp
+  801a5a:	56                   	push   %esi
+  801a5b:	8b 0e                	mov    (%esi),%ecx
+  801a5d:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801a60:	8b 7e 08             	mov    0x8(%esi),%edi
+  801a63:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801a66:	8b 76 0c             	mov    0xc(%esi),%esi
+  801a69:	cd 30                	int    $0x30
+  801a6b:	87 34 24             	xchg   %esi,(%esp)
+  801a6e:	89 0e                	mov    %ecx,(%esi)
+  801a70:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801a73:	89 7e 08             	mov    %edi,0x8(%esi)
+  801a76:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801a79:	8f 46 0c             	pop    0xc(%esi)
+  801a7c:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  801a7d:	83 c4 20             	add    $0x20,%esp
+  801a80:	5b                   	pop    %ebx
+  801a81:	5e                   	pop    %esi
+  801a82:	5f                   	pop    %edi
+  801a83:	5d                   	pop    %ebp
+  801a84:	c3                   	ret
+
+00801a85 <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  801a85:	55                   	push   %ebp
+  801a86:	89 e5                	mov    %esp,%ebp
+  801a88:	57                   	push   %edi
+  801a89:	56                   	push   %esi
+  801a8a:	53                   	push   %ebx
+  801a8b:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  801a8e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a91:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  801a93:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a96:	b8 26 00 00 00       	mov    $0x26,%eax
+  801a9b:	55                   	push   %ebp
+  801a9c:	56                   	push   %esi
+  801a9d:	8b 0e                	mov    (%esi),%ecx
+  801a9f:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801aa2:	8b 7e 08             	mov    0x8(%esi),%edi
+  801aa5:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801aa8:	8b 76 0c             	mov    0xc(%esi),%esi
+  801aab:	cd 30                	int    $0x30
+  801aad:	87 34 24             	xchg   %esi,(%esp)
+  801ab0:	89 0e                	mov    %ecx,(%esi)
+  801ab2:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801ab5:	89 7e 08             	mov    %edi,0x8(%esi)
+  801ab8:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801abb:	8f 46 0c             	pop    0xc(%esi)
+  801abe:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  801abf:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  801ac3:	74 0f                	je     801ad4 <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  801ac5:	85 c0                	test   %eax,%eax
+  801ac7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801acc:	0f 48 d1             	cmovs  %ecx,%edx
+  801acf:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  801ad2:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  801ad4:	5b                   	pop    %ebx
+  801ad5:	5e                   	pop    %esi
+  801ad6:	5f                   	pop    %edi
+  801ad7:	5d                   	pop    %ebp
+  801ad8:	c3                   	ret
+
+00801ad9 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  801ad9:	55                   	push   %ebp
+  801ada:	89 e5                	mov    %esp,%ebp
+  801adc:	57                   	push   %edi
+  801add:	56                   	push   %esi
+  801ade:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801adf:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801ae6:	78 2f                	js     801b17 <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  801ae8:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801aef:	74 72                	je     801b63 <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  801af1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801af4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801af9:	b8 27 00 00 00       	mov    $0x27,%eax
+  801afe:	89 cb                	mov    %ecx,%ebx
+  801b00:	89 cf                	mov    %ecx,%edi
+  801b02:	89 ce                	mov    %ecx,%esi
+  801b04:	55                   	push   %ebp
+  801b05:	68 0e 1b 80 00       	push   $0x801b0e
+  801b0a:	89 e5                	mov    %esp,%ebp
+  801b0c:	0f 34                	sysenter
+  801b0e:	83 c4 04             	add    $0x4,%esp
+  801b11:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  801b12:	5b                   	pop    %ebx
+  801b13:	5e                   	pop    %esi
+  801b14:	5f                   	pop    %edi
+  801b15:	5d                   	pop    %ebp
+  801b16:	c3                   	ret
+  801b17:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b1c:	0f a2                	cpuid
+		return 0;
+  801b1e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b23:	f6 c6 08             	test   $0x8,%dh
+  801b26:	74 15                	je     801b3d <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b28:	89 c2                	mov    %eax,%edx
+  801b2a:	c1 ea 08             	shr    $0x8,%edx
+  801b2d:	83 e2 0f             	and    $0xf,%edx
+  801b30:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b35:	83 fa 06             	cmp    $0x6,%edx
+  801b38:	74 0e                	je     801b48 <sys_sysring_setup+0x6f>
+  801b3a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b3d:	0f b6 c9             	movzbl %cl,%ecx
+  801b40:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  801b46:	eb a0                	jmp    801ae8 <sys_sysring_setup+0xf>
+  801b48:	89 c2                	mov    %eax,%edx
+  801b4a:	c1 ea 04             	shr    $0x4,%edx
+  801b4d:	83 e2 0f             	and    $0xf,%edx
+  801b50:	83 fa 02             	cmp    $0x2,%edx
+  801b53:	77 e5                	ja     801b3a <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  801b55:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b58:	83 f8 02             	cmp    $0x2,%eax
+  801b5b:	0f 97 c1             	seta   %cl
+  801b5e:	0f b6 c9             	movzbl %cl,%ecx
+  801b61:	eb d7                	jmp    801b3a <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  801b63:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b68:	b8 27 00 00 00       	mov    $0x27,%eax
+  801b6d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b70:	89 cb                	mov    %ecx,%ebx
+  801b72:	89 cf                	mov    %ecx,%edi
+  801b74:	89 ce                	mov    %ecx,%esi
+  801b76:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  801b78:	eb 98                	jmp    801b12 <sys_sysring_setup+0x39>
+
+00801b7a <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  801b7a:	55                   	push   %ebp
+  801b7b:	89 e5                	mov    %esp,%ebp
+  801b7d:	57                   	push   %edi
+  801b7e:	56                   	push   %esi
+  801b7f:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801b80:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801b87:	78 2e                	js     801bb7 <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  801b89:	83 3d 08 30 80 00 00 	cmpl   $0x0,0x803008
+  801b90:	74 71                	je     801c03 <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  801b92:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b97:	b8 28 00 00 00       	mov    $0x28,%eax
+  801b9c:	89 d1                	mov    %edx,%ecx
+  801b9e:	89 d3                	mov    %edx,%ebx
+  801ba0:	89 d7                	mov    %edx,%edi
+  801ba2:	89 d6                	mov    %edx,%esi
+  801ba4:	55                   	push   %ebp
+  801ba5:	68 ae 1b 80 00       	push   $0x801bae
+  801baa:	89 e5                	mov    %esp,%ebp
+  801bac:	0f 34                	sysenter
+  801bae:	83 c4 04             	add    $0x4,%esp
+  801bb1:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801bb2:	5b                   	pop    %ebx
+  801bb3:	5e                   	pop    %esi
+  801bb4:	5f                   	pop    %edi
+  801bb5:	5d                   	pop    %ebp
+  801bb6:	c3                   	ret
+  801bb7:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bbc:	0f a2                	cpuid
+		return 0;
+  801bbe:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801bc3:	f6 c6 08             	test   $0x8,%dh
+  801bc6:	74 15                	je     801bdd <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bc8:	89 c2                	mov    %eax,%edx
+  801bca:	c1 ea 08             	shr    $0x8,%edx
+  801bcd:	83 e2 0f             	and    $0xf,%edx
+  801bd0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801bd5:	83 fa 06             	cmp    $0x6,%edx
+  801bd8:	74 0e                	je     801be8 <sys_sysring_enter+0x6e>
+  801bda:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801bdd:	0f b6 c9             	movzbl %cl,%ecx
+  801be0:	89 0d 08 30 80 00    	mov    %ecx,0x803008
+  801be6:	eb a1                	jmp    801b89 <sys_sysring_enter+0xf>
+  801be8:	89 c2                	mov    %eax,%edx
+  801bea:	c1 ea 04             	shr    $0x4,%edx
+  801bed:	83 e2 0f             	and    $0xf,%edx
+  801bf0:	83 fa 02             	cmp    $0x2,%edx
+  801bf3:	77 e5                	ja     801bda <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  801bf5:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bf8:	83 f8 02             	cmp    $0x2,%eax
+  801bfb:	0f 97 c1             	seta   %cl
+  801bfe:	0f b6 c9             	movzbl %cl,%ecx
+  801c01:	eb d7                	jmp    801bda <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  801c03:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c08:	b8 28 00 00 00       	mov    $0x28,%eax
+  801c0d:	89 d1                	mov    %edx,%ecx
+  801c0f:	89 d3                	mov    %edx,%ebx
+  801c11:	89 d7                	mov    %edx,%edi
+  801c13:	89 d6                	mov    %edx,%esi
+  801c15:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  801c17:	eb 99                	jmp    801bb2 <sys_sysring_enter+0x38>
+
+00801c19 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801c19:	55                   	push   %ebp
+  801c1a:	89 e5                	mov    %esp,%ebp
+  801c1c:	57                   	push   %edi
+  801c1d:	56                   	push   %esi
+  801c1e:	53                   	push   %ebx
+  801c1f:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  801c25:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  801c28:	8b 1d 04 30 80 00    	mov    0x803004,%ebx
+  801c2e:	e8 c8 e8 ff ff       	call   8004fb <sys_getenvid>
+  801c33:	83 ec 04             	sub    $0x4,%esp
+  801c36:	ff 75 0c             	push   0xc(%ebp)
+  801c39:	ff 75 08             	push   0x8(%ebp)
+  801c3c:	53                   	push   %ebx
+  801c3d:	50                   	push   %eax
+  801c3e:	68 04 28 80 00       	push   $0x802804
+  801c43:	68 00 01 00 00       	push   $0x100
+  801c48:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  801c4e:	56                   	push   %esi
+  801c4f:	e8 c9 05 00 00       	call   80221d <snprintf>
+  801c54:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  801c56:	83 c4 20             	add    $0x20,%esp
+  801c59:	57                   	push   %edi
+  801c5a:	ff 75 10             	push   0x10(%ebp)
+  801c5d:	bf 00 01 00 00       	mov    $0x100,%edi
+  801c62:	89 f8                	mov    %edi,%eax
+  801c64:	29 d8                	sub    %ebx,%eax
+  801c66:	50                   	push   %eax
+  801c67:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801c6a:	50                   	push   %eax
+  801c6b:	e8 5f 05 00 00       	call   8021cf <vsnprintf>
+  801c70:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  801c72:	83 c4 0c             	add    $0xc,%esp
+  801c75:	68 cc 27 80 00       	push   $0x8027cc
+  801c7a:	29 df                	sub    %ebx,%edi
+  801c7c:	57                   	push   %edi
+  801c7d:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801c80:	50                   	push   %eax
+  801c81:	e8 97 05 00 00       	call   80221d <snprintf>
+	sys_cputs(buf, r);
+  801c86:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  801c89:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  801c8b:	53                   	push   %ebx
+  801c8c:	56                   	push   %esi
+  801c8d:	e8 6b e6 ff ff       	call   8002fd <sys_cputs>
+  801c92:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801c95:	cc                   	int3
+	while (1)
+  801c96:	eb fd                	jmp    801c95 <_panic+0x7c>
+
+00801c98 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801c98:	55                   	push   %ebp
+  801c99:	89 e5                	mov    %esp,%ebp
+  801c9b:	57                   	push   %edi
+  801c9c:	56                   	push   %esi
+  801c9d:	53                   	push   %ebx
+  801c9e:	83 ec 1c             	sub    $0x1c,%esp
+  801ca1:	89 c7                	mov    %eax,%edi
+  801ca3:	89 d6                	mov    %edx,%esi
+  801ca5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ca8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801cab:	89 d1                	mov    %edx,%ecx
+  801cad:	89 c2                	mov    %eax,%edx
+  801caf:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801cb2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801cb5:	8b 45 10             	mov    0x10(%ebp),%eax
+  801cb8:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  801cbb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801cbe:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801cc5:	39 c2                	cmp    %eax,%edx
+  801cc7:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  801cca:	72 3e                	jb     801d0a <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801ccc:	83 ec 0c             	sub    $0xc,%esp
+  801ccf:	ff 75 18             	push   0x18(%ebp)
+  801cd2:	83 eb 01             	sub    $0x1,%ebx
+  801cd5:	53                   	push   %ebx
+  801cd6:	50                   	push   %eax
+  801cd7:	83 ec 08             	sub    $0x8,%esp
+  801cda:	ff 75 e4             	push   -0x1c(%ebp)
+  801cdd:	ff 75 e0             	push   -0x20(%ebp)
+  801ce0:	ff 75 dc             	push   -0x24(%ebp)
+  801ce3:	ff 75 d8             	push   -0x28(%ebp)
+  801ce6:	e8 9a 09 00 00       	call   802685 <__udivdi3>
+  801ceb:	83 c4 18             	add    $0x18,%esp
+  801cee:	52                   	push   %edx
+  801cef:	50                   	push   %eax
+  801cf0:	89 f2                	mov    %esi,%edx
+  801cf2:	89 f8                	mov    %edi,%eax
+  801cf4:	e8 9f ff ff ff       	call   801c98 <printnum>
+  801cf9:	83 c4 20             	add    $0x20,%esp
+  801cfc:	eb 13                	jmp    801d11 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  801cfe:	83 ec 08             	sub    $0x8,%esp
+  801d01:	56                   	push   %esi
+  801d02:	ff 75 18             	push   0x18(%ebp)
+  801d05:	ff d7                	call   *%edi
+  801d07:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  801d0a:	83 eb 01             	sub    $0x1,%ebx
+  801d0d:	85 db                	test   %ebx,%ebx
+  801d0f:	7f ed                	jg     801cfe <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  801d11:	83 ec 08             	sub    $0x8,%esp
+  801d14:	56                   	push   %esi
+  801d15:	83 ec 04             	sub    $0x4,%esp
+  801d18:	ff 75 e4             	push   -0x1c(%ebp)
+  801d1b:	ff 75 e0             	push   -0x20(%ebp)
+  801d1e:	ff 75 dc             	push   -0x24(%ebp)
+  801d21:	ff 75 d8             	push   -0x28(%ebp)
+  801d24:	e8 7a 09 00 00       	call   8026a3 <__umoddi3>
+  801d29:	83 c4 14             	add    $0x14,%esp
+  801d2c:	0f be 80 27 28 80 00 	movsbl 0x802827(%eax),%eax
+  801d33:	50                   	push   %eax
+  801d34:	ff d7                	call   *%edi
+}
+  801d36:	83 c4 10             	add    $0x10,%esp
+  801d39:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d3c:	5b                   	pop    %ebx
+  801d3d:	5e                   	pop    %esi
+  801d3e:	5f                   	pop    %edi
+  801d3f:	5d                   	pop    %ebp
+  801d40:	c3                   	ret
+
+00801d41 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801d41:	55                   	push   %ebp
+  801d42:	89 e5                	mov    %esp,%ebp
+  801d44:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  801d47:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  801d4b:	8b 10                	mov    (%eax),%edx
+  801d4d:	3b 50 04             	cmp    0x4(%eax),%edx
+  801d50:	73 0a                	jae    801d5c <sprintputch+0x1b>
+		*b->buf++ = ch;
+  801d52:	8d 4a 01             	lea    0x1(%edx),%ecx
+  801d55:	89 08                	mov    %ecx,(%eax)
+  801d57:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d5a:	88 02                	mov    %al,(%edx)
+}
+  801d5c:	5d                   	pop    %ebp
+  801d5d:	c3                   	ret
+
+00801d5e <printfmt>:
+{
+  801d5e:	55                   	push   %ebp
+  801d5f:	89 e5                	mov    %esp,%ebp
+  801d61:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  801d64:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  801d67:	50                   	push   %eax
+  801d68:	ff 75 10             	push   0x10(%ebp)
+  801d6b:	ff 75 0c             	push   0xc(%ebp)
+  801d6e:	ff 75 08             	push   0x8(%ebp)
+  801d71:	e8 05 00 00 00       	call   801d7b <vprintfmt>
+}
+  801d76:	83 c4 10             	add    $0x10,%esp
+  801d79:	c9                   	leave
+  801d7a:	c3                   	ret
+
+00801d7b <vprintfmt>:
+{
+  801d7b:	55                   	push   %ebp
+  801d7c:	89 e5                	mov    %esp,%ebp
+  801d7e:	57                   	push   %edi
+  801d7f:	56                   	push   %esi
+  801d80:	53                   	push   %ebx
+  801d81:	83 ec 2c             	sub    $0x2c,%esp
+  801d84:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d87:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801d8a:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801d8d:	eb 0a                	jmp    801d99 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  801d8f:	83 ec 08             	sub    $0x8,%esp
+  801d92:	53                   	push   %ebx
+  801d93:	50                   	push   %eax
+  801d94:	ff d6                	call   *%esi
+  801d96:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801d99:	83 c7 01             	add    $0x1,%edi
+  801d9c:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801da0:	83 f8 25             	cmp    $0x25,%eax
+  801da3:	74 0c                	je     801db1 <vprintfmt+0x36>
+			if (ch == '\0')
+  801da5:	85 c0                	test   %eax,%eax
+  801da7:	75 e6                	jne    801d8f <vprintfmt+0x14>
+}
+  801da9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dac:	5b                   	pop    %ebx
+  801dad:	5e                   	pop    %esi
+  801dae:	5f                   	pop    %edi
+  801daf:	5d                   	pop    %ebp
+  801db0:	c3                   	ret
+		padc = ' ';
+  801db1:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801db5:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  801dbc:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801dc3:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  801dca:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801dcf:	8d 47 01             	lea    0x1(%edi),%eax
+  801dd2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801dd5:	0f b6 17             	movzbl (%edi),%edx
+  801dd8:	8d 42 dd             	lea    -0x23(%edx),%eax
+  801ddb:	3c 55                	cmp    $0x55,%al
+  801ddd:	0f 87 cf 03 00 00    	ja     8021b2 <vprintfmt+0x437>
+  801de3:	0f b6 c0             	movzbl %al,%eax
+  801de6:	ff 24 85 20 29 80 00 	jmp    *0x802920(,%eax,4)
+  801ded:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801df0:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801df4:	eb d9                	jmp    801dcf <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801df6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801df9:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  801dfd:	eb d0                	jmp    801dcf <vprintfmt+0x54>
+  801dff:	0f b6 d2             	movzbl %dl,%edx
+  801e02:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  801e05:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e0a:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  801e0d:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801e10:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  801e14:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  801e17:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  801e1a:	83 f9 09             	cmp    $0x9,%ecx
+  801e1d:	77 55                	ja     801e74 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  801e1f:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  801e22:	eb e9                	jmp    801e0d <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  801e24:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e27:	8b 00                	mov    (%eax),%eax
+  801e29:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801e2c:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e2f:	8d 40 04             	lea    0x4(%eax),%eax
+  801e32:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801e35:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  801e38:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801e3c:	79 91                	jns    801dcf <vprintfmt+0x54>
+				width = precision, precision = -1;
+  801e3e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801e41:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801e44:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  801e4b:	eb 82                	jmp    801dcf <vprintfmt+0x54>
+			if (width < 0)
+  801e4d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801e50:	85 d2                	test   %edx,%edx
+  801e52:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e57:	0f 49 c2             	cmovns %edx,%eax
+  801e5a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801e5d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801e60:	e9 6a ff ff ff       	jmp    801dcf <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801e65:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  801e68:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  801e6f:	e9 5b ff ff ff       	jmp    801dcf <vprintfmt+0x54>
+  801e74:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801e77:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801e7a:	eb bc                	jmp    801e38 <vprintfmt+0xbd>
+			lflag++;
+  801e7c:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801e7f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801e82:	e9 48 ff ff ff       	jmp    801dcf <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  801e87:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e8a:	8d 78 04             	lea    0x4(%eax),%edi
+  801e8d:	83 ec 08             	sub    $0x8,%esp
+  801e90:	53                   	push   %ebx
+  801e91:	ff 30                	push   (%eax)
+  801e93:	ff d6                	call   *%esi
+			break;
+  801e95:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801e98:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  801e9b:	e9 b1 02 00 00       	jmp    802151 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  801ea0:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ea3:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801ea6:	8b 10                	mov    (%eax),%edx
+  801ea8:	89 d0                	mov    %edx,%eax
+  801eaa:	f7 d8                	neg    %eax
+  801eac:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801eaf:	83 f8 0d             	cmp    $0xd,%eax
+  801eb2:	7f 23                	jg     801ed7 <vprintfmt+0x15c>
+  801eb4:	8b 14 85 80 2a 80 00 	mov    0x802a80(,%eax,4),%edx
+  801ebb:	85 d2                	test   %edx,%edx
+  801ebd:	74 18                	je     801ed7 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801ebf:	52                   	push   %edx
+  801ec0:	68 48 28 80 00       	push   $0x802848
+  801ec5:	53                   	push   %ebx
+  801ec6:	56                   	push   %esi
+  801ec7:	e8 92 fe ff ff       	call   801d5e <printfmt>
+  801ecc:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801ecf:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801ed2:	e9 7a 02 00 00       	jmp    802151 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  801ed7:	50                   	push   %eax
+  801ed8:	68 3f 28 80 00       	push   $0x80283f
+  801edd:	53                   	push   %ebx
+  801ede:	56                   	push   %esi
+  801edf:	e8 7a fe ff ff       	call   801d5e <printfmt>
+  801ee4:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801ee7:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801eea:	e9 62 02 00 00       	jmp    802151 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801eef:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ef2:	83 c0 04             	add    $0x4,%eax
+  801ef5:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801ef8:	8b 45 14             	mov    0x14(%ebp),%eax
+  801efb:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801efd:	85 c9                	test   %ecx,%ecx
+  801eff:	b8 38 28 80 00       	mov    $0x802838,%eax
+  801f04:	0f 45 c1             	cmovne %ecx,%eax
+  801f07:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801f0a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801f0e:	7e 06                	jle    801f16 <vprintfmt+0x19b>
+  801f10:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801f14:	75 0b                	jne    801f21 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f16:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801f19:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801f1c:	89 75 08             	mov    %esi,0x8(%ebp)
+  801f1f:	eb 5c                	jmp    801f7d <vprintfmt+0x202>
+  801f21:	83 ec 08             	sub    $0x8,%esp
+  801f24:	ff 75 d0             	push   -0x30(%ebp)
+  801f27:	ff 75 cc             	push   -0x34(%ebp)
+  801f2a:	e8 20 03 00 00       	call   80224f <strnlen>
+  801f2f:	89 c2                	mov    %eax,%edx
+  801f31:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f34:	29 d0                	sub    %edx,%eax
+  801f36:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801f39:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  801f3d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801f40:	89 75 08             	mov    %esi,0x8(%ebp)
+  801f43:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f45:	eb 0e                	jmp    801f55 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801f47:	83 ec 08             	sub    $0x8,%esp
+  801f4a:	53                   	push   %ebx
+  801f4b:	57                   	push   %edi
+  801f4c:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f4f:	83 ee 01             	sub    $0x1,%esi
+  801f52:	83 c4 10             	add    $0x10,%esp
+  801f55:	85 f6                	test   %esi,%esi
+  801f57:	7f ee                	jg     801f47 <vprintfmt+0x1cc>
+  801f59:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f5c:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f5f:	85 c0                	test   %eax,%eax
+  801f61:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f66:	0f 49 d0             	cmovns %eax,%edx
+  801f69:	29 d0                	sub    %edx,%eax
+  801f6b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801f6e:	eb a6                	jmp    801f16 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801f70:	83 ec 08             	sub    $0x8,%esp
+  801f73:	53                   	push   %ebx
+  801f74:	52                   	push   %edx
+  801f75:	ff 55 08             	call   *0x8(%ebp)
+  801f78:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801f7b:	89 f1                	mov    %esi,%ecx
+  801f7d:	8d 71 01             	lea    0x1(%ecx),%esi
+  801f80:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801f84:	0f be d0             	movsbl %al,%edx
+  801f87:	85 d2                	test   %edx,%edx
+  801f89:	74 28                	je     801fb3 <vprintfmt+0x238>
+  801f8b:	85 ff                	test   %edi,%edi
+  801f8d:	78 05                	js     801f94 <vprintfmt+0x219>
+  801f8f:	83 ef 01             	sub    $0x1,%edi
+  801f92:	78 30                	js     801fc4 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801f94:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801f98:	74 d6                	je     801f70 <vprintfmt+0x1f5>
+  801f9a:	0f be c0             	movsbl %al,%eax
+  801f9d:	83 e8 20             	sub    $0x20,%eax
+  801fa0:	83 f8 5e             	cmp    $0x5e,%eax
+  801fa3:	76 cb                	jbe    801f70 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801fa5:	83 ec 08             	sub    $0x8,%esp
+  801fa8:	53                   	push   %ebx
+  801fa9:	6a 3f                	push   $0x3f
+  801fab:	ff 55 08             	call   *0x8(%ebp)
+  801fae:	83 c4 10             	add    $0x10,%esp
+  801fb1:	eb c8                	jmp    801f7b <vprintfmt+0x200>
+  801fb3:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fb6:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801fb9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801fbc:	01 d0                	add    %edx,%eax
+  801fbe:	29 c8                	sub    %ecx,%eax
+  801fc0:	89 c7                	mov    %eax,%edi
+  801fc2:	eb 13                	jmp    801fd7 <vprintfmt+0x25c>
+  801fc4:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fc7:	eb ed                	jmp    801fb6 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801fc9:	83 ec 08             	sub    $0x8,%esp
+  801fcc:	53                   	push   %ebx
+  801fcd:	6a 20                	push   $0x20
+  801fcf:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801fd1:	83 ef 01             	sub    $0x1,%edi
+  801fd4:	83 c4 10             	add    $0x10,%esp
+  801fd7:	85 ff                	test   %edi,%edi
+  801fd9:	7f ee                	jg     801fc9 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801fdb:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801fde:	89 45 14             	mov    %eax,0x14(%ebp)
+  801fe1:	e9 6b 01 00 00       	jmp    802151 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  801fe6:	83 f9 01             	cmp    $0x1,%ecx
+  801fe9:	7f 1f                	jg     80200a <vprintfmt+0x28f>
+	else if (lflag)
+  801feb:	85 c9                	test   %ecx,%ecx
+  801fed:	74 67                	je     802056 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  801fef:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ff2:	8b 00                	mov    (%eax),%eax
+  801ff4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801ff7:	89 c1                	mov    %eax,%ecx
+  801ff9:	c1 f9 1f             	sar    $0x1f,%ecx
+  801ffc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801fff:	8b 45 14             	mov    0x14(%ebp),%eax
+  802002:	8d 40 04             	lea    0x4(%eax),%eax
+  802005:	89 45 14             	mov    %eax,0x14(%ebp)
+  802008:	eb 17                	jmp    802021 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80200a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80200d:	8b 50 04             	mov    0x4(%eax),%edx
+  802010:	8b 00                	mov    (%eax),%eax
+  802012:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802015:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802018:	8b 45 14             	mov    0x14(%ebp),%eax
+  80201b:	8d 40 08             	lea    0x8(%eax),%eax
+  80201e:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  802021:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802024:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  802027:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80202c:	85 c9                	test   %ecx,%ecx
+  80202e:	0f 89 03 01 00 00    	jns    802137 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  802034:	83 ec 08             	sub    $0x8,%esp
+  802037:	53                   	push   %ebx
+  802038:	6a 2d                	push   $0x2d
+  80203a:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80203c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80203f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802042:	f7 da                	neg    %edx
+  802044:	83 d1 00             	adc    $0x0,%ecx
+  802047:	f7 d9                	neg    %ecx
+  802049:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80204c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802051:	e9 e1 00 00 00       	jmp    802137 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  802056:	8b 45 14             	mov    0x14(%ebp),%eax
+  802059:	8b 00                	mov    (%eax),%eax
+  80205b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80205e:	89 c1                	mov    %eax,%ecx
+  802060:	c1 f9 1f             	sar    $0x1f,%ecx
+  802063:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802066:	8b 45 14             	mov    0x14(%ebp),%eax
+  802069:	8d 40 04             	lea    0x4(%eax),%eax
+  80206c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80206f:	eb b0                	jmp    802021 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  802071:	83 f9 01             	cmp    $0x1,%ecx
+  802074:	7f 1e                	jg     802094 <vprintfmt+0x319>
+	else if (lflag)
+  802076:	85 c9                	test   %ecx,%ecx
+  802078:	74 32                	je     8020ac <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  80207a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80207d:	8b 10                	mov    (%eax),%edx
+  80207f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802084:	8d 40 04             	lea    0x4(%eax),%eax
+  802087:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80208a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80208f:	e9 a3 00 00 00       	jmp    802137 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802094:	8b 45 14             	mov    0x14(%ebp),%eax
+  802097:	8b 10                	mov    (%eax),%edx
+  802099:	8b 48 04             	mov    0x4(%eax),%ecx
+  80209c:	8d 40 08             	lea    0x8(%eax),%eax
+  80209f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8020a2:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8020a7:	e9 8b 00 00 00       	jmp    802137 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8020ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020af:	8b 10                	mov    (%eax),%edx
+  8020b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020b6:	8d 40 04             	lea    0x4(%eax),%eax
+  8020b9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8020bc:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8020c1:	eb 74                	jmp    802137 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8020c3:	83 f9 01             	cmp    $0x1,%ecx
+  8020c6:	7f 1b                	jg     8020e3 <vprintfmt+0x368>
+	else if (lflag)
+  8020c8:	85 c9                	test   %ecx,%ecx
+  8020ca:	74 2c                	je     8020f8 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8020cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020cf:	8b 10                	mov    (%eax),%edx
+  8020d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020d6:	8d 40 04             	lea    0x4(%eax),%eax
+  8020d9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8020dc:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8020e1:	eb 54                	jmp    802137 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8020e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020e6:	8b 10                	mov    (%eax),%edx
+  8020e8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8020eb:	8d 40 08             	lea    0x8(%eax),%eax
+  8020ee:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8020f1:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8020f6:	eb 3f                	jmp    802137 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8020f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020fb:	8b 10                	mov    (%eax),%edx
+  8020fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802102:	8d 40 04             	lea    0x4(%eax),%eax
+  802105:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802108:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80210d:	eb 28                	jmp    802137 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  80210f:	83 ec 08             	sub    $0x8,%esp
+  802112:	53                   	push   %ebx
+  802113:	6a 30                	push   $0x30
+  802115:	ff d6                	call   *%esi
+			putch('x', putdat);
+  802117:	83 c4 08             	add    $0x8,%esp
+  80211a:	53                   	push   %ebx
+  80211b:	6a 78                	push   $0x78
+  80211d:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80211f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802122:	8b 10                	mov    (%eax),%edx
+  802124:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  802129:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80212c:	8d 40 04             	lea    0x4(%eax),%eax
+  80212f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802132:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  802137:	83 ec 0c             	sub    $0xc,%esp
+  80213a:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80213e:	50                   	push   %eax
+  80213f:	ff 75 e0             	push   -0x20(%ebp)
+  802142:	57                   	push   %edi
+  802143:	51                   	push   %ecx
+  802144:	52                   	push   %edx
+  802145:	89 da                	mov    %ebx,%edx
+  802147:	89 f0                	mov    %esi,%eax
+  802149:	e8 4a fb ff ff       	call   801c98 <printnum>
+			break;
+  80214e:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  802151:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802154:	e9 40 fc ff ff       	jmp    801d99 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  802159:	83 f9 01             	cmp    $0x1,%ecx
+  80215c:	7f 1b                	jg     802179 <vprintfmt+0x3fe>
+	else if (lflag)
+  80215e:	85 c9                	test   %ecx,%ecx
+  802160:	74 2c                	je     80218e <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  802162:	8b 45 14             	mov    0x14(%ebp),%eax
+  802165:	8b 10                	mov    (%eax),%edx
+  802167:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80216c:	8d 40 04             	lea    0x4(%eax),%eax
+  80216f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802172:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  802177:	eb be                	jmp    802137 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802179:	8b 45 14             	mov    0x14(%ebp),%eax
+  80217c:	8b 10                	mov    (%eax),%edx
+  80217e:	8b 48 04             	mov    0x4(%eax),%ecx
+  802181:	8d 40 08             	lea    0x8(%eax),%eax
+  802184:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802187:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80218c:	eb a9                	jmp    802137 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80218e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802191:	8b 10                	mov    (%eax),%edx
+  802193:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802198:	8d 40 04             	lea    0x4(%eax),%eax
+  80219b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80219e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8021a3:	eb 92                	jmp    802137 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8021a5:	83 ec 08             	sub    $0x8,%esp
+  8021a8:	53                   	push   %ebx
+  8021a9:	6a 25                	push   $0x25
+  8021ab:	ff d6                	call   *%esi
+			break;
+  8021ad:	83 c4 10             	add    $0x10,%esp
+  8021b0:	eb 9f                	jmp    802151 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8021b2:	83 ec 08             	sub    $0x8,%esp
+  8021b5:	53                   	push   %ebx
+  8021b6:	6a 25                	push   $0x25
+  8021b8:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8021ba:	83 c4 10             	add    $0x10,%esp
+  8021bd:	89 f8                	mov    %edi,%eax
+  8021bf:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8021c3:	74 05                	je     8021ca <vprintfmt+0x44f>
+  8021c5:	83 e8 01             	sub    $0x1,%eax
+  8021c8:	eb f5                	jmp    8021bf <vprintfmt+0x444>
+  8021ca:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8021cd:	eb 82                	jmp    802151 <vprintfmt+0x3d6>
+
+008021cf <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8021cf:	55                   	push   %ebp
+  8021d0:	89 e5                	mov    %esp,%ebp
+  8021d2:	83 ec 18             	sub    $0x18,%esp
+  8021d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021d8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8021db:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8021de:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8021e2:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8021e5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8021ec:	85 c0                	test   %eax,%eax
+  8021ee:	74 26                	je     802216 <vsnprintf+0x47>
+  8021f0:	85 d2                	test   %edx,%edx
+  8021f2:	7e 22                	jle    802216 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8021f4:	ff 75 14             	push   0x14(%ebp)
+  8021f7:	ff 75 10             	push   0x10(%ebp)
+  8021fa:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8021fd:	50                   	push   %eax
+  8021fe:	68 41 1d 80 00       	push   $0x801d41
+  802203:	e8 73 fb ff ff       	call   801d7b <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  802208:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80220b:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80220e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802211:	83 c4 10             	add    $0x10,%esp
+}
+  802214:	c9                   	leave
+  802215:	c3                   	ret
+		return -E_INVAL;
+  802216:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80221b:	eb f7                	jmp    802214 <vsnprintf+0x45>
+
+0080221d <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80221d:	55                   	push   %ebp
+  80221e:	89 e5                	mov    %esp,%ebp
+  802220:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  802223:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  802226:	50                   	push   %eax
+  802227:	ff 75 10             	push   0x10(%ebp)
+  80222a:	ff 75 0c             	push   0xc(%ebp)
+  80222d:	ff 75 08             	push   0x8(%ebp)
+  802230:	e8 9a ff ff ff       	call   8021cf <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  802235:	c9                   	leave
+  802236:	c3                   	ret
+
+00802237 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  802237:	55                   	push   %ebp
+  802238:	89 e5                	mov    %esp,%ebp
+  80223a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80223d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802242:	eb 03                	jmp    802247 <strlen+0x10>
+		n++;
+  802244:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  802247:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80224b:	75 f7                	jne    802244 <strlen+0xd>
+	return n;
+}
+  80224d:	5d                   	pop    %ebp
+  80224e:	c3                   	ret
+
+0080224f <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80224f:	55                   	push   %ebp
+  802250:	89 e5                	mov    %esp,%ebp
+  802252:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802255:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802258:	b8 00 00 00 00       	mov    $0x0,%eax
+  80225d:	eb 03                	jmp    802262 <strnlen+0x13>
+		n++;
+  80225f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802262:	39 d0                	cmp    %edx,%eax
+  802264:	74 08                	je     80226e <strnlen+0x1f>
+  802266:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80226a:	75 f3                	jne    80225f <strnlen+0x10>
+  80226c:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80226e:	89 d0                	mov    %edx,%eax
+  802270:	5d                   	pop    %ebp
+  802271:	c3                   	ret
+
+00802272 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  802272:	55                   	push   %ebp
+  802273:	89 e5                	mov    %esp,%ebp
+  802275:	53                   	push   %ebx
+  802276:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802279:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80227c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802281:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  802285:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  802288:	83 c0 01             	add    $0x1,%eax
+  80228b:	84 d2                	test   %dl,%dl
+  80228d:	75 f2                	jne    802281 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80228f:	89 c8                	mov    %ecx,%eax
+  802291:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802294:	c9                   	leave
+  802295:	c3                   	ret
+
+00802296 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  802296:	55                   	push   %ebp
+  802297:	89 e5                	mov    %esp,%ebp
+  802299:	53                   	push   %ebx
+  80229a:	83 ec 10             	sub    $0x10,%esp
+  80229d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8022a0:	53                   	push   %ebx
+  8022a1:	e8 91 ff ff ff       	call   802237 <strlen>
+  8022a6:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8022a9:	ff 75 0c             	push   0xc(%ebp)
+  8022ac:	01 d8                	add    %ebx,%eax
+  8022ae:	50                   	push   %eax
+  8022af:	e8 be ff ff ff       	call   802272 <strcpy>
+	return dst;
+}
+  8022b4:	89 d8                	mov    %ebx,%eax
+  8022b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022b9:	c9                   	leave
+  8022ba:	c3                   	ret
+
+008022bb <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8022bb:	55                   	push   %ebp
+  8022bc:	89 e5                	mov    %esp,%ebp
+  8022be:	56                   	push   %esi
+  8022bf:	53                   	push   %ebx
+  8022c0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8022c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8022c6:	89 f3                	mov    %esi,%ebx
+  8022c8:	03 5d 10             	add    0x10(%ebp),%ebx
+  8022cb:	89 f0                	mov    %esi,%eax
+  8022cd:	eb 0f                	jmp    8022de <strncpy+0x23>
+		*dst++ = *src;
+  8022cf:	83 c0 01             	add    $0x1,%eax
+  8022d2:	0f b6 0a             	movzbl (%edx),%ecx
+  8022d5:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8022d8:	80 f9 01             	cmp    $0x1,%cl
+  8022db:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8022de:	39 d8                	cmp    %ebx,%eax
+  8022e0:	75 ed                	jne    8022cf <strncpy+0x14>
+	}
+	return ret;
+}
+  8022e2:	89 f0                	mov    %esi,%eax
+  8022e4:	5b                   	pop    %ebx
+  8022e5:	5e                   	pop    %esi
+  8022e6:	5d                   	pop    %ebp
+  8022e7:	c3                   	ret
+
+008022e8 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8022e8:	55                   	push   %ebp
+  8022e9:	89 e5                	mov    %esp,%ebp
+  8022eb:	56                   	push   %esi
+  8022ec:	53                   	push   %ebx
+  8022ed:	8b 75 08             	mov    0x8(%ebp),%esi
+  8022f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022f3:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8022f6:	89 f0                	mov    %esi,%eax
+  8022f8:	85 d2                	test   %edx,%edx
+  8022fa:	74 21                	je     80231d <strlcpy+0x35>
+  8022fc:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  802300:	89 f2                	mov    %esi,%edx
+  802302:	eb 09                	jmp    80230d <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  802304:	83 c1 01             	add    $0x1,%ecx
+  802307:	83 c2 01             	add    $0x1,%edx
+  80230a:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80230d:	39 c2                	cmp    %eax,%edx
+  80230f:	74 09                	je     80231a <strlcpy+0x32>
+  802311:	0f b6 19             	movzbl (%ecx),%ebx
+  802314:	84 db                	test   %bl,%bl
+  802316:	75 ec                	jne    802304 <strlcpy+0x1c>
+  802318:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80231a:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80231d:	29 f0                	sub    %esi,%eax
+}
+  80231f:	5b                   	pop    %ebx
+  802320:	5e                   	pop    %esi
+  802321:	5d                   	pop    %ebp
+  802322:	c3                   	ret
+
+00802323 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  802323:	55                   	push   %ebp
+  802324:	89 e5                	mov    %esp,%ebp
+  802326:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802329:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80232c:	eb 06                	jmp    802334 <strcmp+0x11>
+		p++, q++;
+  80232e:	83 c1 01             	add    $0x1,%ecx
+  802331:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  802334:	0f b6 01             	movzbl (%ecx),%eax
+  802337:	84 c0                	test   %al,%al
+  802339:	74 04                	je     80233f <strcmp+0x1c>
+  80233b:	3a 02                	cmp    (%edx),%al
+  80233d:	74 ef                	je     80232e <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80233f:	0f b6 c0             	movzbl %al,%eax
+  802342:	0f b6 12             	movzbl (%edx),%edx
+  802345:	29 d0                	sub    %edx,%eax
+}
+  802347:	5d                   	pop    %ebp
+  802348:	c3                   	ret
+
+00802349 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  802349:	55                   	push   %ebp
+  80234a:	89 e5                	mov    %esp,%ebp
+  80234c:	53                   	push   %ebx
+  80234d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802350:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802353:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  802356:	eb 09                	jmp    802361 <strncmp+0x18>
+		n--, p++, q++;
+  802358:	83 ea 01             	sub    $0x1,%edx
+  80235b:	83 c0 01             	add    $0x1,%eax
+  80235e:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  802361:	85 d2                	test   %edx,%edx
+  802363:	74 18                	je     80237d <strncmp+0x34>
+  802365:	0f b6 18             	movzbl (%eax),%ebx
+  802368:	84 db                	test   %bl,%bl
+  80236a:	74 04                	je     802370 <strncmp+0x27>
+  80236c:	3a 19                	cmp    (%ecx),%bl
+  80236e:	74 e8                	je     802358 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  802370:	0f b6 00             	movzbl (%eax),%eax
+  802373:	0f b6 11             	movzbl (%ecx),%edx
+  802376:	29 d0                	sub    %edx,%eax
+}
+  802378:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80237b:	c9                   	leave
+  80237c:	c3                   	ret
+		return 0;
+  80237d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802382:	eb f4                	jmp    802378 <strncmp+0x2f>
+
+00802384 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  802384:	55                   	push   %ebp
+  802385:	89 e5                	mov    %esp,%ebp
+  802387:	8b 45 08             	mov    0x8(%ebp),%eax
+  80238a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80238e:	eb 03                	jmp    802393 <strchr+0xf>
+  802390:	83 c0 01             	add    $0x1,%eax
+  802393:	0f b6 10             	movzbl (%eax),%edx
+  802396:	84 d2                	test   %dl,%dl
+  802398:	74 06                	je     8023a0 <strchr+0x1c>
+		if (*s == c)
+  80239a:	38 ca                	cmp    %cl,%dl
+  80239c:	75 f2                	jne    802390 <strchr+0xc>
+  80239e:	eb 05                	jmp    8023a5 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8023a0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023a5:	5d                   	pop    %ebp
+  8023a6:	c3                   	ret
+
+008023a7 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8023a7:	55                   	push   %ebp
+  8023a8:	89 e5                	mov    %esp,%ebp
+  8023aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023ad:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8023b1:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8023b4:	38 ca                	cmp    %cl,%dl
+  8023b6:	74 09                	je     8023c1 <strfind+0x1a>
+  8023b8:	84 d2                	test   %dl,%dl
+  8023ba:	74 05                	je     8023c1 <strfind+0x1a>
+	for (; *s; s++)
+  8023bc:	83 c0 01             	add    $0x1,%eax
+  8023bf:	eb f0                	jmp    8023b1 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8023c1:	5d                   	pop    %ebp
+  8023c2:	c3                   	ret
+
+008023c3 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8023c3:	55                   	push   %ebp
+  8023c4:	89 e5                	mov    %esp,%ebp
+  8023c6:	57                   	push   %edi
+  8023c7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8023ca:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8023cd:	85 c9                	test   %ecx,%ecx
+  8023cf:	74 20                	je     8023f1 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8023d1:	89 f8                	mov    %edi,%eax
+  8023d3:	09 c8                	or     %ecx,%eax
+  8023d5:	a8 03                	test   $0x3,%al
+  8023d7:	75 12                	jne    8023eb <memset+0x28>
+		c &= 0xFF;
+  8023d9:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8023dd:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8023e3:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8023e6:	fc                   	cld
+  8023e7:	f3 ab                	rep stos %eax,%es:(%edi)
+  8023e9:	eb 06                	jmp    8023f1 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8023eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023ee:	fc                   	cld
+  8023ef:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8023f1:	89 f8                	mov    %edi,%eax
+  8023f3:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8023f6:	c9                   	leave
+  8023f7:	c3                   	ret
+
+008023f8 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8023f8:	55                   	push   %ebp
+  8023f9:	89 e5                	mov    %esp,%ebp
+  8023fb:	57                   	push   %edi
+  8023fc:	56                   	push   %esi
+  8023fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802400:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802403:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  802406:	39 c6                	cmp    %eax,%esi
+  802408:	73 32                	jae    80243c <memmove+0x44>
+  80240a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80240d:	39 d0                	cmp    %edx,%eax
+  80240f:	73 2b                	jae    80243c <memmove+0x44>
+		s += n;
+		d += n;
+  802411:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802414:	89 d6                	mov    %edx,%esi
+  802416:	09 fe                	or     %edi,%esi
+  802418:	09 ce                	or     %ecx,%esi
+  80241a:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  802420:	75 0e                	jne    802430 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  802422:	83 ef 04             	sub    $0x4,%edi
+  802425:	8d 72 fc             	lea    -0x4(%edx),%esi
+  802428:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80242b:	fd                   	std
+  80242c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80242e:	eb 09                	jmp    802439 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  802430:	83 ef 01             	sub    $0x1,%edi
+  802433:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  802436:	fd                   	std
+  802437:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  802439:	fc                   	cld
+  80243a:	eb 1a                	jmp    802456 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80243c:	89 f2                	mov    %esi,%edx
+  80243e:	09 c2                	or     %eax,%edx
+  802440:	09 ca                	or     %ecx,%edx
+  802442:	f6 c2 03             	test   $0x3,%dl
+  802445:	75 0a                	jne    802451 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  802447:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80244a:	89 c7                	mov    %eax,%edi
+  80244c:	fc                   	cld
+  80244d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80244f:	eb 05                	jmp    802456 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  802451:	89 c7                	mov    %eax,%edi
+  802453:	fc                   	cld
+  802454:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  802456:	5e                   	pop    %esi
+  802457:	5f                   	pop    %edi
+  802458:	5d                   	pop    %ebp
+  802459:	c3                   	ret
+
+0080245a <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80245a:	55                   	push   %ebp
+  80245b:	89 e5                	mov    %esp,%ebp
+  80245d:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  802460:	ff 75 10             	push   0x10(%ebp)
+  802463:	ff 75 0c             	push   0xc(%ebp)
+  802466:	ff 75 08             	push   0x8(%ebp)
+  802469:	e8 8a ff ff ff       	call   8023f8 <memmove>
+}
+  80246e:	c9                   	leave
+  80246f:	c3                   	ret
+
+00802470 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  802470:	55                   	push   %ebp
+  802471:	89 e5                	mov    %esp,%ebp
+  802473:	56                   	push   %esi
+  802474:	53                   	push   %ebx
+  802475:	8b 45 08             	mov    0x8(%ebp),%eax
+  802478:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80247b:	89 c6                	mov    %eax,%esi
+  80247d:	03 75 10             	add    0x10(%ebp),%esi
+  802480:	eb 06                	jmp    802488 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  802482:	83 c0 01             	add    $0x1,%eax
+  802485:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  802488:	39 f0                	cmp    %esi,%eax
+  80248a:	74 14                	je     8024a0 <memcmp+0x30>
+		if (*s1 != *s2)
+  80248c:	0f b6 08             	movzbl (%eax),%ecx
+  80248f:	0f b6 1a             	movzbl (%edx),%ebx
+  802492:	38 d9                	cmp    %bl,%cl
+  802494:	74 ec                	je     802482 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  802496:	0f b6 c1             	movzbl %cl,%eax
+  802499:	0f b6 db             	movzbl %bl,%ebx
+  80249c:	29 d8                	sub    %ebx,%eax
+  80249e:	eb 05                	jmp    8024a5 <memcmp+0x35>
+	}
+
+	return 0;
+  8024a0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024a5:	5b                   	pop    %ebx
+  8024a6:	5e                   	pop    %esi
+  8024a7:	5d                   	pop    %ebp
+  8024a8:	c3                   	ret
+
+008024a9 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8024a9:	55                   	push   %ebp
+  8024aa:	89 e5                	mov    %esp,%ebp
+  8024ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8024b2:	89 c2                	mov    %eax,%edx
+  8024b4:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8024b7:	eb 03                	jmp    8024bc <memfind+0x13>
+  8024b9:	83 c0 01             	add    $0x1,%eax
+  8024bc:	39 d0                	cmp    %edx,%eax
+  8024be:	73 04                	jae    8024c4 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8024c0:	38 08                	cmp    %cl,(%eax)
+  8024c2:	75 f5                	jne    8024b9 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8024c4:	5d                   	pop    %ebp
+  8024c5:	c3                   	ret
+
+008024c6 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8024c6:	55                   	push   %ebp
+  8024c7:	89 e5                	mov    %esp,%ebp
+  8024c9:	57                   	push   %edi
+  8024ca:	56                   	push   %esi
+  8024cb:	53                   	push   %ebx
+  8024cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024cf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8024d2:	eb 03                	jmp    8024d7 <strtol+0x11>
+		s++;
+  8024d4:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8024d7:	0f b6 02             	movzbl (%edx),%eax
+  8024da:	3c 20                	cmp    $0x20,%al
+  8024dc:	74 f6                	je     8024d4 <strtol+0xe>
+  8024de:	3c 09                	cmp    $0x9,%al
+  8024e0:	74 f2                	je     8024d4 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8024e2:	3c 2b                	cmp    $0x2b,%al
+  8024e4:	74 2a                	je     802510 <strtol+0x4a>
+	int neg = 0;
+  8024e6:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8024eb:	3c 2d                	cmp    $0x2d,%al
+  8024ed:	74 2b                	je     80251a <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8024ef:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8024f5:	75 0f                	jne    802506 <strtol+0x40>
+  8024f7:	80 3a 30             	cmpb   $0x30,(%edx)
+  8024fa:	74 28                	je     802524 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8024fc:	85 db                	test   %ebx,%ebx
+  8024fe:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802503:	0f 44 d8             	cmove  %eax,%ebx
+  802506:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80250b:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80250e:	eb 46                	jmp    802556 <strtol+0x90>
+		s++;
+  802510:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  802513:	bf 00 00 00 00       	mov    $0x0,%edi
+  802518:	eb d5                	jmp    8024ef <strtol+0x29>
+		s++, neg = 1;
+  80251a:	83 c2 01             	add    $0x1,%edx
+  80251d:	bf 01 00 00 00       	mov    $0x1,%edi
+  802522:	eb cb                	jmp    8024ef <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802524:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802528:	74 0e                	je     802538 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  80252a:	85 db                	test   %ebx,%ebx
+  80252c:	75 d8                	jne    802506 <strtol+0x40>
+		s++, base = 8;
+  80252e:	83 c2 01             	add    $0x1,%edx
+  802531:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802536:	eb ce                	jmp    802506 <strtol+0x40>
+		s += 2, base = 16;
+  802538:	83 c2 02             	add    $0x2,%edx
+  80253b:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802540:	eb c4                	jmp    802506 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  802542:	0f be c0             	movsbl %al,%eax
+  802545:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  802548:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80254b:	7d 3a                	jge    802587 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  80254d:	83 c2 01             	add    $0x1,%edx
+  802550:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802554:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  802556:	0f b6 02             	movzbl (%edx),%eax
+  802559:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80255c:	89 f3                	mov    %esi,%ebx
+  80255e:	80 fb 09             	cmp    $0x9,%bl
+  802561:	76 df                	jbe    802542 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  802563:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802566:	89 f3                	mov    %esi,%ebx
+  802568:	80 fb 19             	cmp    $0x19,%bl
+  80256b:	77 08                	ja     802575 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  80256d:	0f be c0             	movsbl %al,%eax
+  802570:	83 e8 57             	sub    $0x57,%eax
+  802573:	eb d3                	jmp    802548 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  802575:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802578:	89 f3                	mov    %esi,%ebx
+  80257a:	80 fb 19             	cmp    $0x19,%bl
+  80257d:	77 08                	ja     802587 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  80257f:	0f be c0             	movsbl %al,%eax
+  802582:	83 e8 37             	sub    $0x37,%eax
+  802585:	eb c1                	jmp    802548 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  802587:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80258b:	74 05                	je     802592 <strtol+0xcc>
+		*endptr = (char *) s;
+  80258d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802590:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  802592:	89 c8                	mov    %ecx,%eax
+  802594:	f7 d8                	neg    %eax
+  802596:	85 ff                	test   %edi,%edi
+  802598:	0f 45 c8             	cmovne %eax,%ecx
+}
+  80259b:	89 c8                	mov    %ecx,%eax
+  80259d:	5b                   	pop    %ebx
+  80259e:	5e                   	pop    %esi
+  80259f:	5f                   	pop    %edi
+  8025a0:	5d                   	pop    %ebp
+  8025a1:	c3                   	ret
+
+008025a2 <atoi>:
+
+int
+atoi(const char *s)
+{
+  8025a2:	55                   	push   %ebp
+  8025a3:	89 e5                	mov    %esp,%ebp
+  8025a5:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  8025a8:	6a 0a                	push   $0xa
+  8025aa:	6a 00                	push   $0x0
+  8025ac:	ff 75 08             	push   0x8(%ebp)
+  8025af:	e8 12 ff ff ff       	call   8024c6 <strtol>
+}
+  8025b4:	c9                   	leave
+  8025b5:	c3                   	ret
+
+008025b6 <dm>:
+  8025b6:	55                   	push   %ebp
+  8025b7:	57                   	push   %edi
+  8025b8:	56                   	push   %esi
+  8025b9:	53                   	push   %ebx
+  8025ba:	83 ec 24             	sub    $0x24,%esp
+  8025bd:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8025c1:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8025c5:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8025c9:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8025cd:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8025d1:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8025d5:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8025d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025e3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025e8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8025ef:	00 
+  8025f0:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8025f7:	00 
+  8025f8:	89 fb                	mov    %edi,%ebx
+  8025fa:	eb 08                	jmp    802604 <dm+0x4e>
+  8025fc:	83 e9 01             	sub    $0x1,%ecx
+  8025ff:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802602:	74 68                	je     80266c <dm+0xb6>
+  802604:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802608:	01 c0                	add    %eax,%eax
+  80260a:	89 c6                	mov    %eax,%esi
+  80260c:	89 d7                	mov    %edx,%edi
+  80260e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802612:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802616:	0f ad d0             	shrd   %cl,%edx,%eax
+  802619:	d3 ea                	shr    %cl,%edx
+  80261b:	f6 c1 20             	test   $0x20,%cl
+  80261e:	74 04                	je     802624 <dm+0x6e>
+  802620:	89 d0                	mov    %edx,%eax
+  802622:	31 d2                	xor    %edx,%edx
+  802624:	83 e0 01             	and    $0x1,%eax
+  802627:	89 04 24             	mov    %eax,(%esp)
+  80262a:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802631:	00 
+  802632:	8b 04 24             	mov    (%esp),%eax
+  802635:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802639:	09 f0                	or     %esi,%eax
+  80263b:	09 fa                	or     %edi,%edx
+  80263d:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802641:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802645:	39 f0                	cmp    %esi,%eax
+  802647:	89 d5                	mov    %edx,%ebp
+  802649:	19 fd                	sbb    %edi,%ebp
+  80264b:	72 af                	jb     8025fc <dm+0x46>
+  80264d:	29 f0                	sub    %esi,%eax
+  80264f:	19 fa                	sbb    %edi,%edx
+  802651:	89 cf                	mov    %ecx,%edi
+  802653:	c1 ef 05             	shr    $0x5,%edi
+  802656:	83 e7 01             	and    $0x1,%edi
+  802659:	89 fe                	mov    %edi,%esi
+  80265b:	83 f6 01             	xor    $0x1,%esi
+  80265e:	d3 e6                	shl    %cl,%esi
+  802660:	d3 e7                	shl    %cl,%edi
+  802662:	09 74 24 18          	or     %esi,0x18(%esp)
+  802666:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80266a:	eb 90                	jmp    8025fc <dm+0x46>
+  80266c:	85 db                	test   %ebx,%ebx
+  80266e:	74 05                	je     802675 <dm+0xbf>
+  802670:	89 03                	mov    %eax,(%ebx)
+  802672:	89 53 04             	mov    %edx,0x4(%ebx)
+  802675:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802679:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80267d:	83 c4 24             	add    $0x24,%esp
+  802680:	5b                   	pop    %ebx
+  802681:	5e                   	pop    %esi
+  802682:	5f                   	pop    %edi
+  802683:	5d                   	pop    %ebp
+  802684:	c3                   	ret
+
+00802685 <__udivdi3>:
+  802685:	83 ec 08             	sub    $0x8,%esp
+  802688:	6a 00                	push   $0x0
+  80268a:	ff 74 24 1c          	push   0x1c(%esp)
+  80268e:	ff 74 24 1c          	push   0x1c(%esp)
+  802692:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802696:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80269a:	e8 17 ff ff ff       	call   8025b6 <dm>
+  80269f:	83 c4 14             	add    $0x14,%esp
+  8026a2:	c3                   	ret
+
+008026a3 <__umoddi3>:
+  8026a3:	83 ec 18             	sub    $0x18,%esp
+  8026a6:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8026aa:	50                   	push   %eax
+  8026ab:	ff 74 24 2c          	push   0x2c(%esp)
+  8026af:	ff 74 24 2c          	push   0x2c(%esp)
+  8026b3:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8026b7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8026bb:	e8 f6 fe ff ff       	call   8025b6 <dm>
+  8026c0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8026c4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8026c8:	83 c4 24             	add    $0x24,%esp
+  8026cb:	c3                   	ret
+
+008026cc <__divdi3>:
+  8026cc:	53                   	push   %ebx
+  8026cd:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8026d1:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026d5:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8026d9:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8026dd:	85 d2                	test   %edx,%edx
+  8026df:	78 15                	js     8026f6 <__divdi3+0x2a>
+  8026e1:	85 db                	test   %ebx,%ebx
+  8026e3:	78 34                	js     802719 <__divdi3+0x4d>
+  8026e5:	83 ec 04             	sub    $0x4,%esp
+  8026e8:	6a 00                	push   $0x0
+  8026ea:	53                   	push   %ebx
+  8026eb:	51                   	push   %ecx
+  8026ec:	e8 c5 fe ff ff       	call   8025b6 <dm>
+  8026f1:	83 c4 10             	add    $0x10,%esp
+  8026f4:	eb 21                	jmp    802717 <__divdi3+0x4b>
+  8026f6:	f7 d8                	neg    %eax
+  8026f8:	83 d2 00             	adc    $0x0,%edx
+  8026fb:	f7 da                	neg    %edx
+  8026fd:	85 db                	test   %ebx,%ebx
+  8026ff:	78 30                	js     802731 <__divdi3+0x65>
+  802701:	83 ec 04             	sub    $0x4,%esp
+  802704:	6a 00                	push   $0x0
+  802706:	53                   	push   %ebx
+  802707:	51                   	push   %ecx
+  802708:	e8 a9 fe ff ff       	call   8025b6 <dm>
+  80270d:	83 c4 10             	add    $0x10,%esp
+  802710:	f7 d8                	neg    %eax
+  802712:	83 d2 00             	adc    $0x0,%edx
+  802715:	f7 da                	neg    %edx
+  802717:	5b                   	pop    %ebx
+  802718:	c3                   	ret
+  802719:	83 ec 04             	sub    $0x4,%esp
+  80271c:	6a 00                	push   $0x0
+  80271e:	f7 d9                	neg    %ecx
+  802720:	83 d3 00             	adc    $0x0,%ebx
+  802723:	f7 db                	neg    %ebx
+  802725:	53                   	push   %ebx
+  802726:	51                   	push   %ecx
+  802727:	e8 8a fe ff ff       	call   8025b6 <dm>
+  80272c:	83 c4 10             	add    $0x10,%esp
+  80272f:	eb df                	jmp    802710 <__divdi3+0x44>
+  802731:	83 ec 04             	sub    $0x4,%esp
+  802734:	6a 00                	push   $0x0
+  802736:	f7 d9                	neg    %ecx
+  802738:	83 d3 00             	adc    $0x0,%ebx
+  80273b:	f7 db                	neg    %ebx
+  80273d:	53                   	push   %ebx
+  80273e:	51                   	push   %ecx
+  80273f:	e8 72 fe ff ff       	call   8025b6 <dm>
+  802744:	83 c4 10             	add    $0x10,%esp
+  802747:	eb ce                	jmp    802717 <__divdi3+0x4b>
+
+00802749 <__moddi3>:
+  802749:	55                   	push   %ebp
+  80274a:	57                   	push   %edi
+  80274b:	56                   	push   %esi
+  80274c:	53                   	push   %ebx
+  80274d:	83 ec 18             	sub    $0x18,%esp
+  802750:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802754:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802758:	89 f1                	mov    %esi,%ecx
+  80275a:	f7 d9                	neg    %ecx
+  80275c:	89 da                	mov    %ebx,%edx
+  80275e:	83 d2 00             	adc    $0x0,%edx
+  802761:	f7 da                	neg    %edx
+  802763:	0f 48 ce             	cmovs  %esi,%ecx
+  802766:	0f 48 d3             	cmovs  %ebx,%edx
+  802769:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80276d:	50                   	push   %eax
+  80276e:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802772:	f7 de                	neg    %esi
+  802774:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802778:	83 d0 00             	adc    $0x0,%eax
+  80277b:	f7 d8                	neg    %eax
+  80277d:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802782:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802787:	50                   	push   %eax
+  802788:	56                   	push   %esi
+  802789:	89 c8                	mov    %ecx,%eax
+  80278b:	e8 26 fe ff ff       	call   8025b6 <dm>
+  802790:	83 c4 10             	add    $0x10,%esp
+  802793:	85 db                	test   %ebx,%ebx
+  802795:	78 10                	js     8027a7 <__moddi3+0x5e>
+  802797:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80279b:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80279f:	83 c4 14             	add    $0x14,%esp
+  8027a2:	5b                   	pop    %ebx
+  8027a3:	5e                   	pop    %esi
+  8027a4:	5f                   	pop    %edi
+  8027a5:	5d                   	pop    %ebp
+  8027a6:	c3                   	ret
+  8027a7:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8027ab:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8027af:	f7 d8                	neg    %eax
+  8027b1:	83 d2 00             	adc    $0x0,%edx
+  8027b4:	f7 da                	neg    %edx
+  8027b6:	eb e7                	jmp    80279f <__moddi3+0x56>
@@ -0,0 +1,5565 @@
+
+obj/user/cowbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 13 03 00 00       	call   800344 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <touch>:
+}
+
+// Write to every page at DST; return the average cycles per write.
+static uint64_t
+touch(void)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t start, total = 0;
+	int i;
+
+	for (i = 0; i < NPAGES; i++) {
+  80003c:	bb 00 00 00 30       	mov    $0x30000000,%ebx
+  800041:	b9 01 01 00 00       	mov    $0x101,%ecx
+	uint64_t start, total = 0;
+  800046:	be 00 00 00 00       	mov    $0x0,%esi
+  80004b:	bf 00 00 00 00       	mov    $0x0,%edi
+	for (i = 0; i < NPAGES; i++) {
+  800050:	83 e9 01             	sub    $0x1,%ecx
+  800053:	74 3e                	je     800093 <touch+0x60>
+
+static inline uint64_t
+read_tsc(void)
+{
+	uint64_t tsc;
+	asm volatile("rdtsc" : "=A" (tsc));
+  800055:	0f 31                	rdtsc
+  800057:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80005a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+		start = read_tsc();
+		DST[i * PGSIZE] = -i;
+  80005d:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+  800060:	88 0b                	mov    %cl,(%ebx)
+  800062:	0f 31                	rdtsc
+		total += read_tsc() - start;
+  800064:	2b 45 e0             	sub    -0x20(%ebp),%eax
+  800067:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+  80006a:	01 c6                	add    %eax,%esi
+  80006c:	11 d7                	adc    %edx,%edi
+		if (SRC[i * PGSIZE] != (char) i)
+  80006e:	0f b6 83 00 00 00 f0 	movzbl -0x10000000(%ebx),%eax
+  800075:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80007b:	00 c8                	add    %cl,%al
+  80007d:	74 d1                	je     800050 <touch+0x1d>
+			panic("cowbench: write to %08x leaked to the original",
+  80007f:	ff 75 dc             	push   -0x24(%ebp)
+  800082:	68 00 2c 80 00       	push   $0x802c00
+  800087:	6a 4c                	push   $0x4c
+  800089:	68 cc 2c 80 00       	push   $0x802ccc
+  80008e:	e8 0c 03 00 00       	call   80039f <_panic>
+			      DST + i * PGSIZE);
+	}
+	return total / NPAGES;
+  800093:	89 f0                	mov    %esi,%eax
+  800095:	89 fa                	mov    %edi,%edx
+  800097:	0f ac d0 08          	shrd   $0x8,%edx,%eax
+  80009b:	c1 ea 08             	shr    $0x8,%edx
+}
+  80009e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000a1:	5b                   	pop    %ebx
+  8000a2:	5e                   	pop    %esi
+  8000a3:	5f                   	pop    %edi
+  8000a4:	5d                   	pop    %ebp
+  8000a5:	c3                   	ret
+
+008000a6 <handler>:
+{
+  8000a6:	55                   	push   %ebp
+  8000a7:	89 e5                	mov    %esp,%ebp
+  8000a9:	53                   	push   %ebx
+  8000aa:	83 ec 04             	sub    $0x4,%esp
+  8000ad:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = ROUNDDOWN((void *) utf->utf_fault_va, PGSIZE);
+  8000b0:	8b 0a                	mov    (%edx),%ecx
+  8000b2:	89 c8                	mov    %ecx,%eax
+  8000b4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if (!(utf->utf_err & FEC_WR) || (char *) addr < DST
+  8000b9:	8b 52 04             	mov    0x4(%edx),%edx
+  8000bc:	f6 c2 02             	test   $0x2,%dl
+  8000bf:	74 2a                	je     8000eb <handler+0x45>
+	    || (char *) addr >= DST + NPAGES * PGSIZE)
+  8000c1:	8d 98 00 00 00 d0    	lea    -0x30000000(%eax),%ebx
+  8000c7:	81 fb ff ff 0f 00    	cmp    $0xfffff,%ebx
+  8000cd:	77 1c                	ja     8000eb <handler+0x45>
+	if ((r = sys_page_copy(0, addr, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  8000cf:	83 ec 0c             	sub    $0xc,%esp
+  8000d2:	6a 07                	push   $0x7
+  8000d4:	50                   	push   %eax
+  8000d5:	6a 00                	push   $0x0
+  8000d7:	50                   	push   %eax
+  8000d8:	6a 00                	push   $0x0
+  8000da:	e8 45 14 00 00       	call   801524 <sys_page_copy>
+  8000df:	83 c4 20             	add    $0x20,%esp
+  8000e2:	85 c0                	test   %eax,%eax
+  8000e4:	78 1b                	js     800101 <handler+0x5b>
+}
+  8000e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000e9:	c9                   	leave
+  8000ea:	c3                   	ret
+		panic("cowbench: unexpected fault va %08x err %x",
+  8000eb:	83 ec 0c             	sub    $0xc,%esp
+  8000ee:	52                   	push   %edx
+  8000ef:	51                   	push   %ecx
+  8000f0:	68 30 2c 80 00       	push   $0x802c30
+  8000f5:	6a 18                	push   $0x18
+  8000f7:	68 cc 2c 80 00       	push   $0x802ccc
+  8000fc:	e8 9e 02 00 00       	call   80039f <_panic>
+		panic("sys_page_copy: %e", r);
+  800101:	50                   	push   %eax
+  800102:	68 dc 2c 80 00       	push   $0x802cdc
+  800107:	6a 1c                	push   $0x1c
+  800109:	68 cc 2c 80 00       	push   $0x802ccc
+  80010e:	e8 8c 02 00 00       	call   80039f <_panic>
+
+00800113 <setup>:
+{
+  800113:	55                   	push   %ebp
+  800114:	89 e5                	mov    %esp,%ebp
+  800116:	53                   	push   %ebx
+  800117:	83 ec 14             	sub    $0x14,%esp
+  80011a:	89 c3                	mov    %eax,%ebx
+	range.pr_va = SRC;
+  80011c:	c7 45 e8 00 00 00 20 	movl   $0x20000000,-0x18(%ebp)
+	range.pr_npages = NPAGES;
+  800123:	c7 45 ec 00 01 00 00 	movl   $0x100,-0x14(%ebp)
+	range.pr_perm = PTE_P | PTE_U | PTE_W;
+  80012a:	c7 45 f0 07 00 00 00 	movl   $0x7,-0x10(%ebp)
+	if ((r = sys_page_alloc_vec(0, &range, 1, 0)) < 0)
+  800131:	6a 00                	push   $0x0
+  800133:	6a 01                	push   $0x1
+  800135:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  800138:	50                   	push   %eax
+  800139:	6a 00                	push   $0x0
+  80013b:	e8 03 1e 00 00       	call   801f43 <sys_page_alloc_vec>
+  800140:	83 c4 10             	add    $0x10,%esp
+  800143:	85 c0                	test   %eax,%eax
+  800145:	78 46                	js     80018d <setup+0x7a>
+  800147:	ba 00 00 00 20       	mov    $0x20000000,%edx
+	for (i = 0; i < NPAGES; i++)
+  80014c:	b8 00 00 00 00       	mov    $0x0,%eax
+		SRC[i * PGSIZE] = i;
+  800151:	88 02                	mov    %al,(%edx)
+	for (i = 0; i < NPAGES; i++)
+  800153:	83 c0 01             	add    $0x1,%eax
+  800156:	81 c2 00 10 00 00    	add    $0x1000,%edx
+  80015c:	3d 00 01 00 00       	cmp    $0x100,%eax
+  800161:	75 ee                	jne    800151 <setup+0x3e>
+	range.pr_perm = perm;
+  800163:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+	range.pr_dstva = DST;
+  800166:	c7 45 f4 00 00 00 30 	movl   $0x30000000,-0xc(%ebp)
+	if ((r = sys_page_map_vec(0, 0, &range, 1, 0)) < 0)
+  80016d:	83 ec 0c             	sub    $0xc,%esp
+  800170:	6a 00                	push   $0x0
+  800172:	6a 01                	push   $0x1
+  800174:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  800177:	50                   	push   %eax
+  800178:	6a 00                	push   $0x0
+  80017a:	6a 00                	push   $0x0
+  80017c:	e8 e5 1d 00 00       	call   801f66 <sys_page_map_vec>
+  800181:	83 c4 20             	add    $0x20,%esp
+  800184:	85 c0                	test   %eax,%eax
+  800186:	78 17                	js     80019f <setup+0x8c>
+}
+  800188:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80018b:	c9                   	leave
+  80018c:	c3                   	ret
+		panic("sys_page_alloc_vec: %e", r);
+  80018d:	50                   	push   %eax
+  80018e:	68 ee 2c 80 00       	push   $0x802cee
+  800193:	6a 2a                	push   $0x2a
+  800195:	68 cc 2c 80 00       	push   $0x802ccc
+  80019a:	e8 00 02 00 00       	call   80039f <_panic>
+		panic("sys_page_map_vec: %e", r);
+  80019f:	50                   	push   %eax
+  8001a0:	68 05 2d 80 00       	push   $0x802d05
+  8001a5:	6a 31                	push   $0x31
+  8001a7:	68 cc 2c 80 00       	push   $0x802ccc
+  8001ac:	e8 ee 01 00 00       	call   80039f <_panic>
+
+008001b1 <teardown>:
+{
+  8001b1:	55                   	push   %ebp
+  8001b2:	89 e5                	mov    %esp,%ebp
+  8001b4:	83 ec 28             	sub    $0x28,%esp
+	range[0].pr_va = SRC;
+  8001b7:	c7 45 d8 00 00 00 20 	movl   $0x20000000,-0x28(%ebp)
+	range[0].pr_npages = NPAGES;
+  8001be:	c7 45 dc 00 01 00 00 	movl   $0x100,-0x24(%ebp)
+	range[1].pr_va = DST;
+  8001c5:	c7 45 e8 00 00 00 30 	movl   $0x30000000,-0x18(%ebp)
+	range[1].pr_npages = NPAGES;
+  8001cc:	c7 45 ec 00 01 00 00 	movl   $0x100,-0x14(%ebp)
+	sys_page_unmap_vec(0, range, 2, 0);
+  8001d3:	6a 00                	push   $0x0
+  8001d5:	6a 02                	push   $0x2
+  8001d7:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  8001da:	50                   	push   %eax
+  8001db:	6a 00                	push   $0x0
+  8001dd:	e8 a5 1d 00 00       	call   801f87 <sys_page_unmap_vec>
+}
+  8001e2:	83 c4 10             	add    $0x10,%esp
+  8001e5:	c9                   	leave
+  8001e6:	c3                   	ret
+
+008001e7 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8001e7:	55                   	push   %ebp
+  8001e8:	89 e5                	mov    %esp,%ebp
+  8001ea:	57                   	push   %edi
+  8001eb:	56                   	push   %esi
+  8001ec:	53                   	push   %ebx
+  8001ed:	81 ec fc 00 00 00    	sub    $0xfc,%esp
+	struct sysinfo before, after;
+	uint64_t cycles;
+
+	setup(PTE_P | PTE_U | PTE_COW);
+  8001f3:	b8 05 08 00 00       	mov    $0x805,%eax
+  8001f8:	e8 16 ff ff ff       	call   800113 <setup>
+	sys_sysinfo(&before);
+  8001fd:	83 ec 0c             	sub    $0xc,%esp
+  800200:	8d 45 84             	lea    -0x7c(%ebp),%eax
+  800203:	50                   	push   %eax
+  800204:	e8 42 15 00 00       	call   80174b <sys_sysinfo>
+	cycles = touch();
+  800209:	e8 25 fe ff ff       	call   800033 <touch>
+  80020e:	89 85 00 ff ff ff    	mov    %eax,-0x100(%ebp)
+  800214:	89 95 04 ff ff ff    	mov    %edx,-0xfc(%ebp)
+	sys_sysinfo(&after);
+  80021a:	8d 85 20 ff ff ff    	lea    -0xe0(%ebp),%eax
+  800220:	89 04 24             	mov    %eax,(%esp)
+  800223:	e8 23 15 00 00       	call   80174b <sys_sysinfo>
+	teardown();
+  800228:	e8 84 ff ff ff       	call   8001b1 <teardown>
+	cprintf("kernel: %llu faults, %llu cycles/fault (%llu in the kernel handler)\n",
+		after.kfaults - before.kfaults, cycles,
+		(after.kfault_cycles - before.kfault_cycles)
+  80022d:	8b 8d 58 ff ff ff    	mov    -0xa8(%ebp),%ecx
+  800233:	8b 9d 5c ff ff ff    	mov    -0xa4(%ebp),%ebx
+  800239:	2b 4d bc             	sub    -0x44(%ebp),%ecx
+  80023c:	1b 5d c0             	sbb    -0x40(%ebp),%ebx
+  80023f:	89 8d 08 ff ff ff    	mov    %ecx,-0xf8(%ebp)
+  800245:	89 9d 0c ff ff ff    	mov    %ebx,-0xf4(%ebp)
+		/ (after.kfaults - before.kfaults ? after.kfaults - before.kfaults : 1));
+  80024b:	8b b5 50 ff ff ff    	mov    -0xb0(%ebp),%esi
+  800251:	8b bd 54 ff ff ff    	mov    -0xac(%ebp),%edi
+  800257:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  80025a:	8b 55 b8             	mov    -0x48(%ebp),%edx
+  80025d:	83 c4 10             	add    $0x10,%esp
+  800260:	89 f1                	mov    %esi,%ecx
+  800262:	89 fb                	mov    %edi,%ebx
+  800264:	89 85 10 ff ff ff    	mov    %eax,-0xf0(%ebp)
+  80026a:	89 95 14 ff ff ff    	mov    %edx,-0xec(%ebp)
+  800270:	31 c1                	xor    %eax,%ecx
+  800272:	31 d3                	xor    %edx,%ebx
+  800274:	89 c8                	mov    %ecx,%eax
+  800276:	89 da                	mov    %ebx,%edx
+  800278:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80027d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800282:	09 d0                	or     %edx,%eax
+  800284:	74 14                	je     80029a <umain+0xb3>
+  800286:	89 f2                	mov    %esi,%edx
+  800288:	89 f9                	mov    %edi,%ecx
+  80028a:	2b 95 10 ff ff ff    	sub    -0xf0(%ebp),%edx
+  800290:	1b 8d 14 ff ff ff    	sbb    -0xec(%ebp),%ecx
+  800296:	89 cb                	mov    %ecx,%ebx
+  800298:	89 d1                	mov    %edx,%ecx
+	cprintf("kernel: %llu faults, %llu cycles/fault (%llu in the kernel handler)\n",
+  80029a:	83 ec 10             	sub    $0x10,%esp
+  80029d:	53                   	push   %ebx
+  80029e:	51                   	push   %ecx
+  80029f:	ff b5 0c ff ff ff    	push   -0xf4(%ebp)
+  8002a5:	ff b5 08 ff ff ff    	push   -0xf8(%ebp)
+  8002ab:	e8 05 28 00 00       	call   802ab5 <__udivdi3>
+  8002b0:	83 c4 1c             	add    $0x1c,%esp
+  8002b3:	52                   	push   %edx
+  8002b4:	50                   	push   %eax
+  8002b5:	ff b5 04 ff ff ff    	push   -0xfc(%ebp)
+  8002bb:	ff b5 00 ff ff ff    	push   -0x100(%ebp)
+  8002c1:	2b b5 10 ff ff ff    	sub    -0xf0(%ebp),%esi
+  8002c7:	1b bd 14 ff ff ff    	sbb    -0xec(%ebp),%edi
+  8002cd:	57                   	push   %edi
+  8002ce:	56                   	push   %esi
+  8002cf:	68 5c 2c 80 00       	push   $0x802c5c
+  8002d4:	e8 da 01 00 00       	call   8004b3 <cprintf>
+
+	set_pgfault_handler(handler);
+  8002d9:	83 c4 14             	add    $0x14,%esp
+  8002dc:	68 a6 00 80 00       	push   $0x8000a6
+  8002e1:	e8 6f 26 00 00       	call   802955 <set_pgfault_handler>
+	setup(PTE_P | PTE_U);
+  8002e6:	b8 05 00 00 00       	mov    $0x5,%eax
+  8002eb:	e8 23 fe ff ff       	call   800113 <setup>
+	sys_sysinfo(&before);
+  8002f0:	8d 45 84             	lea    -0x7c(%ebp),%eax
+  8002f3:	89 04 24             	mov    %eax,(%esp)
+  8002f6:	e8 50 14 00 00       	call   80174b <sys_sysinfo>
+	cycles = touch();
+  8002fb:	e8 33 fd ff ff       	call   800033 <touch>
+  800300:	89 c6                	mov    %eax,%esi
+  800302:	89 d7                	mov    %edx,%edi
+	sys_sysinfo(&after);
+  800304:	8d 85 20 ff ff ff    	lea    -0xe0(%ebp),%eax
+  80030a:	89 04 24             	mov    %eax,(%esp)
+  80030d:	e8 39 14 00 00       	call   80174b <sys_sysinfo>
+	teardown();
+  800312:	e8 9a fe ff ff       	call   8001b1 <teardown>
+	cprintf("upcall: %llu faults, %llu cycles/fault\n",
+  800317:	89 3c 24             	mov    %edi,(%esp)
+  80031a:	56                   	push   %esi
+  80031b:	8b 85 60 ff ff ff    	mov    -0xa0(%ebp),%eax
+  800321:	8b 95 64 ff ff ff    	mov    -0x9c(%ebp),%edx
+  800327:	2b 45 c4             	sub    -0x3c(%ebp),%eax
+  80032a:	1b 55 c8             	sbb    -0x38(%ebp),%edx
+  80032d:	52                   	push   %edx
+  80032e:	50                   	push   %eax
+  80032f:	68 a4 2c 80 00       	push   $0x802ca4
+  800334:	e8 7a 01 00 00       	call   8004b3 <cprintf>
+		after.upcalls - before.upcalls, cycles);
+}
+  800339:	83 c4 20             	add    $0x20,%esp
+  80033c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80033f:	5b                   	pop    %ebx
+  800340:	5e                   	pop    %esi
+  800341:	5f                   	pop    %edi
+  800342:	5d                   	pop    %ebp
+  800343:	c3                   	ret
+
+00800344 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800344:	55                   	push   %ebp
+  800345:	89 e5                	mov    %esp,%ebp
+  800347:	56                   	push   %esi
+  800348:	53                   	push   %ebx
+  800349:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80034c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  80034f:	e8 e3 0e 00 00       	call   801237 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  800354:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800359:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  80035f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800364:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800369:	85 db                	test   %ebx,%ebx
+  80036b:	7e 07                	jle    800374 <libmain+0x30>
+		binaryname = argv[0];
+  80036d:	8b 06                	mov    (%esi),%eax
+  80036f:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800374:	83 ec 08             	sub    $0x8,%esp
+  800377:	56                   	push   %esi
+  800378:	53                   	push   %ebx
+  800379:	e8 69 fe ff ff       	call   8001e7 <umain>
+
+	// exit gracefully
+	exit();
+  80037e:	e8 0a 00 00 00       	call   80038d <exit>
+}
+  800383:	83 c4 10             	add    $0x10,%esp
+  800386:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800389:	5b                   	pop    %ebx
+  80038a:	5e                   	pop    %esi
+  80038b:	5d                   	pop    %ebp
+  80038c:	c3                   	ret
+
+0080038d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80038d:	55                   	push   %ebp
+  80038e:	89 e5                	mov    %esp,%ebp
+  800390:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  800393:	6a 00                	push   $0x0
+  800395:	e8 db 0d 00 00       	call   801175 <sys_env_destroy>
+}
+  80039a:	83 c4 10             	add    $0x10,%esp
+  80039d:	c9                   	leave
+  80039e:	c3                   	ret
+
+0080039f <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80039f:	55                   	push   %ebp
+  8003a0:	89 e5                	mov    %esp,%ebp
+  8003a2:	57                   	push   %edi
+  8003a3:	56                   	push   %esi
+  8003a4:	53                   	push   %ebx
+  8003a5:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  8003ab:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  8003ae:	8b 1d 00 40 80 00    	mov    0x804000,%ebx
+  8003b4:	e8 7e 0e 00 00       	call   801237 <sys_getenvid>
+  8003b9:	83 ec 04             	sub    $0x4,%esp
+  8003bc:	ff 75 0c             	push   0xc(%ebp)
+  8003bf:	ff 75 08             	push   0x8(%ebp)
+  8003c2:	53                   	push   %ebx
+  8003c3:	50                   	push   %eax
+  8003c4:	68 24 2d 80 00       	push   $0x802d24
+  8003c9:	68 00 01 00 00       	push   $0x100
+  8003ce:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  8003d4:	56                   	push   %esi
+  8003d5:	e8 72 06 00 00       	call   800a4c <snprintf>
+  8003da:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  8003dc:	83 c4 20             	add    $0x20,%esp
+  8003df:	57                   	push   %edi
+  8003e0:	ff 75 10             	push   0x10(%ebp)
+  8003e3:	bf 00 01 00 00       	mov    $0x100,%edi
+  8003e8:	89 f8                	mov    %edi,%eax
+  8003ea:	29 d8                	sub    %ebx,%eax
+  8003ec:	50                   	push   %eax
+  8003ed:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8003f0:	50                   	push   %eax
+  8003f1:	e8 08 06 00 00       	call   8009fe <vsnprintf>
+  8003f6:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  8003f8:	83 c4 0c             	add    $0xc,%esp
+  8003fb:	68 47 2d 80 00       	push   $0x802d47
+  800400:	29 df                	sub    %ebx,%edi
+  800402:	57                   	push   %edi
+  800403:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  800406:	50                   	push   %eax
+  800407:	e8 40 06 00 00       	call   800a4c <snprintf>
+	sys_cputs(buf, r);
+  80040c:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  80040f:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  800411:	53                   	push   %ebx
+  800412:	56                   	push   %esi
+  800413:	e8 21 0c 00 00       	call   801039 <sys_cputs>
+  800418:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80041b:	cc                   	int3
+	while (1)
+  80041c:	eb fd                	jmp    80041b <_panic+0x7c>
+
+0080041e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80041e:	55                   	push   %ebp
+  80041f:	89 e5                	mov    %esp,%ebp
+  800421:	53                   	push   %ebx
+  800422:	83 ec 04             	sub    $0x4,%esp
+  800425:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800428:	8b 13                	mov    (%ebx),%edx
+  80042a:	8d 42 01             	lea    0x1(%edx),%eax
+  80042d:	89 03                	mov    %eax,(%ebx)
+  80042f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800432:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800436:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80043b:	74 09                	je     800446 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80043d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800441:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800444:	c9                   	leave
+  800445:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800446:	83 ec 08             	sub    $0x8,%esp
+  800449:	68 ff 00 00 00       	push   $0xff
+  80044e:	8d 43 08             	lea    0x8(%ebx),%eax
+  800451:	50                   	push   %eax
+  800452:	e8 e2 0b 00 00       	call   801039 <sys_cputs>
+		b->idx = 0;
+  800457:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80045d:	83 c4 10             	add    $0x10,%esp
+  800460:	eb db                	jmp    80043d <putch+0x1f>
+
+00800462 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800462:	55                   	push   %ebp
+  800463:	89 e5                	mov    %esp,%ebp
+  800465:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80046b:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800472:	00 00 00 
+	b.cnt = 0;
+  800475:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80047c:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80047f:	ff 75 0c             	push   0xc(%ebp)
+  800482:	ff 75 08             	push   0x8(%ebp)
+  800485:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80048b:	50                   	push   %eax
+  80048c:	68 1e 04 80 00       	push   $0x80041e
+  800491:	e8 14 01 00 00       	call   8005aa <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800496:	83 c4 08             	add    $0x8,%esp
+  800499:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80049f:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8004a5:	50                   	push   %eax
+  8004a6:	e8 8e 0b 00 00       	call   801039 <sys_cputs>
+
+	return b.cnt;
+}
+  8004ab:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8004b1:	c9                   	leave
+  8004b2:	c3                   	ret
+
+008004b3 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8004b3:	55                   	push   %ebp
+  8004b4:	89 e5                	mov    %esp,%ebp
+  8004b6:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8004b9:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8004bc:	50                   	push   %eax
+  8004bd:	ff 75 08             	push   0x8(%ebp)
+  8004c0:	e8 9d ff ff ff       	call   800462 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8004c5:	c9                   	leave
+  8004c6:	c3                   	ret
+
+008004c7 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8004c7:	55                   	push   %ebp
+  8004c8:	89 e5                	mov    %esp,%ebp
+  8004ca:	57                   	push   %edi
+  8004cb:	56                   	push   %esi
+  8004cc:	53                   	push   %ebx
+  8004cd:	83 ec 1c             	sub    $0x1c,%esp
+  8004d0:	89 c7                	mov    %eax,%edi
+  8004d2:	89 d6                	mov    %edx,%esi
+  8004d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004d7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8004da:	89 d1                	mov    %edx,%ecx
+  8004dc:	89 c2                	mov    %eax,%edx
+  8004de:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004e1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004e4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8004e7:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8004ea:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004ed:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8004f4:	39 c2                	cmp    %eax,%edx
+  8004f6:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8004f9:	72 3e                	jb     800539 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8004fb:	83 ec 0c             	sub    $0xc,%esp
+  8004fe:	ff 75 18             	push   0x18(%ebp)
+  800501:	83 eb 01             	sub    $0x1,%ebx
+  800504:	53                   	push   %ebx
+  800505:	50                   	push   %eax
+  800506:	83 ec 08             	sub    $0x8,%esp
+  800509:	ff 75 e4             	push   -0x1c(%ebp)
+  80050c:	ff 75 e0             	push   -0x20(%ebp)
+  80050f:	ff 75 dc             	push   -0x24(%ebp)
+  800512:	ff 75 d8             	push   -0x28(%ebp)
+  800515:	e8 9b 25 00 00       	call   802ab5 <__udivdi3>
+  80051a:	83 c4 18             	add    $0x18,%esp
+  80051d:	52                   	push   %edx
+  80051e:	50                   	push   %eax
+  80051f:	89 f2                	mov    %esi,%edx
+  800521:	89 f8                	mov    %edi,%eax
+  800523:	e8 9f ff ff ff       	call   8004c7 <printnum>
+  800528:	83 c4 20             	add    $0x20,%esp
+  80052b:	eb 13                	jmp    800540 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80052d:	83 ec 08             	sub    $0x8,%esp
+  800530:	56                   	push   %esi
+  800531:	ff 75 18             	push   0x18(%ebp)
+  800534:	ff d7                	call   *%edi
+  800536:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800539:	83 eb 01             	sub    $0x1,%ebx
+  80053c:	85 db                	test   %ebx,%ebx
+  80053e:	7f ed                	jg     80052d <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800540:	83 ec 08             	sub    $0x8,%esp
+  800543:	56                   	push   %esi
+  800544:	83 ec 04             	sub    $0x4,%esp
+  800547:	ff 75 e4             	push   -0x1c(%ebp)
+  80054a:	ff 75 e0             	push   -0x20(%ebp)
+  80054d:	ff 75 dc             	push   -0x24(%ebp)
+  800550:	ff 75 d8             	push   -0x28(%ebp)
+  800553:	e8 7b 25 00 00       	call   802ad3 <__umoddi3>
+  800558:	83 c4 14             	add    $0x14,%esp
+  80055b:	0f be 80 49 2d 80 00 	movsbl 0x802d49(%eax),%eax
+  800562:	50                   	push   %eax
+  800563:	ff d7                	call   *%edi
+}
+  800565:	83 c4 10             	add    $0x10,%esp
+  800568:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80056b:	5b                   	pop    %ebx
+  80056c:	5e                   	pop    %esi
+  80056d:	5f                   	pop    %edi
+  80056e:	5d                   	pop    %ebp
+  80056f:	c3                   	ret
+
+00800570 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800570:	55                   	push   %ebp
+  800571:	89 e5                	mov    %esp,%ebp
+  800573:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800576:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80057a:	8b 10                	mov    (%eax),%edx
+  80057c:	3b 50 04             	cmp    0x4(%eax),%edx
+  80057f:	73 0a                	jae    80058b <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800581:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800584:	89 08                	mov    %ecx,(%eax)
+  800586:	8b 45 08             	mov    0x8(%ebp),%eax
+  800589:	88 02                	mov    %al,(%edx)
+}
+  80058b:	5d                   	pop    %ebp
+  80058c:	c3                   	ret
+
+0080058d <printfmt>:
+{
+  80058d:	55                   	push   %ebp
+  80058e:	89 e5                	mov    %esp,%ebp
+  800590:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800593:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800596:	50                   	push   %eax
+  800597:	ff 75 10             	push   0x10(%ebp)
+  80059a:	ff 75 0c             	push   0xc(%ebp)
+  80059d:	ff 75 08             	push   0x8(%ebp)
+  8005a0:	e8 05 00 00 00       	call   8005aa <vprintfmt>
+}
+  8005a5:	83 c4 10             	add    $0x10,%esp
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+008005aa <vprintfmt>:
+{
+  8005aa:	55                   	push   %ebp
+  8005ab:	89 e5                	mov    %esp,%ebp
+  8005ad:	57                   	push   %edi
+  8005ae:	56                   	push   %esi
+  8005af:	53                   	push   %ebx
+  8005b0:	83 ec 2c             	sub    $0x2c,%esp
+  8005b3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005b6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005b9:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8005bc:	eb 0a                	jmp    8005c8 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8005be:	83 ec 08             	sub    $0x8,%esp
+  8005c1:	53                   	push   %ebx
+  8005c2:	50                   	push   %eax
+  8005c3:	ff d6                	call   *%esi
+  8005c5:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8005c8:	83 c7 01             	add    $0x1,%edi
+  8005cb:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8005cf:	83 f8 25             	cmp    $0x25,%eax
+  8005d2:	74 0c                	je     8005e0 <vprintfmt+0x36>
+			if (ch == '\0')
+  8005d4:	85 c0                	test   %eax,%eax
+  8005d6:	75 e6                	jne    8005be <vprintfmt+0x14>
+}
+  8005d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005db:	5b                   	pop    %ebx
+  8005dc:	5e                   	pop    %esi
+  8005dd:	5f                   	pop    %edi
+  8005de:	5d                   	pop    %ebp
+  8005df:	c3                   	ret
+		padc = ' ';
+  8005e0:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8005e4:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8005eb:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8005f2:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8005f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8005fe:	8d 47 01             	lea    0x1(%edi),%eax
+  800601:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800604:	0f b6 17             	movzbl (%edi),%edx
+  800607:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80060a:	3c 55                	cmp    $0x55,%al
+  80060c:	0f 87 cf 03 00 00    	ja     8009e1 <vprintfmt+0x437>
+  800612:	0f b6 c0             	movzbl %al,%eax
+  800615:	ff 24 85 40 2e 80 00 	jmp    *0x802e40(,%eax,4)
+  80061c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80061f:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800623:	eb d9                	jmp    8005fe <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800625:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800628:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80062c:	eb d0                	jmp    8005fe <vprintfmt+0x54>
+  80062e:	0f b6 d2             	movzbl %dl,%edx
+  800631:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800634:	b8 00 00 00 00       	mov    $0x0,%eax
+  800639:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80063c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80063f:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800643:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800646:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800649:	83 f9 09             	cmp    $0x9,%ecx
+  80064c:	77 55                	ja     8006a3 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80064e:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800651:	eb e9                	jmp    80063c <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800653:	8b 45 14             	mov    0x14(%ebp),%eax
+  800656:	8b 00                	mov    (%eax),%eax
+  800658:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80065b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065e:	8d 40 04             	lea    0x4(%eax),%eax
+  800661:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800664:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800667:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80066b:	79 91                	jns    8005fe <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80066d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800670:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800673:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80067a:	eb 82                	jmp    8005fe <vprintfmt+0x54>
+			if (width < 0)
+  80067c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80067f:	85 d2                	test   %edx,%edx
+  800681:	b8 00 00 00 00       	mov    $0x0,%eax
+  800686:	0f 49 c2             	cmovns %edx,%eax
+  800689:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80068c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80068f:	e9 6a ff ff ff       	jmp    8005fe <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800694:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800697:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80069e:	e9 5b ff ff ff       	jmp    8005fe <vprintfmt+0x54>
+  8006a3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8006a6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006a9:	eb bc                	jmp    800667 <vprintfmt+0xbd>
+			lflag++;
+  8006ab:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8006ae:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8006b1:	e9 48 ff ff ff       	jmp    8005fe <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8006b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b9:	8d 78 04             	lea    0x4(%eax),%edi
+  8006bc:	83 ec 08             	sub    $0x8,%esp
+  8006bf:	53                   	push   %ebx
+  8006c0:	ff 30                	push   (%eax)
+  8006c2:	ff d6                	call   *%esi
+			break;
+  8006c4:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8006c7:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8006ca:	e9 b1 02 00 00       	jmp    800980 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8006cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d2:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8006d5:	8b 10                	mov    (%eax),%edx
+  8006d7:	89 d0                	mov    %edx,%eax
+  8006d9:	f7 d8                	neg    %eax
+  8006db:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8006de:	83 f8 0d             	cmp    $0xd,%eax
+  8006e1:	7f 23                	jg     800706 <vprintfmt+0x15c>
+  8006e3:	8b 14 85 a0 2f 80 00 	mov    0x802fa0(,%eax,4),%edx
+  8006ea:	85 d2                	test   %edx,%edx
+  8006ec:	74 18                	je     800706 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8006ee:	52                   	push   %edx
+  8006ef:	68 6a 2d 80 00       	push   $0x802d6a
+  8006f4:	53                   	push   %ebx
+  8006f5:	56                   	push   %esi
+  8006f6:	e8 92 fe ff ff       	call   80058d <printfmt>
+  8006fb:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006fe:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800701:	e9 7a 02 00 00       	jmp    800980 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800706:	50                   	push   %eax
+  800707:	68 61 2d 80 00       	push   $0x802d61
+  80070c:	53                   	push   %ebx
+  80070d:	56                   	push   %esi
+  80070e:	e8 7a fe ff ff       	call   80058d <printfmt>
+  800713:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800716:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800719:	e9 62 02 00 00       	jmp    800980 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80071e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800721:	83 c0 04             	add    $0x4,%eax
+  800724:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800727:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072a:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80072c:	85 c9                	test   %ecx,%ecx
+  80072e:	b8 5a 2d 80 00       	mov    $0x802d5a,%eax
+  800733:	0f 45 c1             	cmovne %ecx,%eax
+  800736:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800739:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80073d:	7e 06                	jle    800745 <vprintfmt+0x19b>
+  80073f:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800743:	75 0b                	jne    800750 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800745:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800748:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80074b:	89 75 08             	mov    %esi,0x8(%ebp)
+  80074e:	eb 5c                	jmp    8007ac <vprintfmt+0x202>
+  800750:	83 ec 08             	sub    $0x8,%esp
+  800753:	ff 75 d0             	push   -0x30(%ebp)
+  800756:	ff 75 cc             	push   -0x34(%ebp)
+  800759:	e8 20 03 00 00       	call   800a7e <strnlen>
+  80075e:	89 c2                	mov    %eax,%edx
+  800760:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800763:	29 d0                	sub    %edx,%eax
+  800765:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800768:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80076c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80076f:	89 75 08             	mov    %esi,0x8(%ebp)
+  800772:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800774:	eb 0e                	jmp    800784 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800776:	83 ec 08             	sub    $0x8,%esp
+  800779:	53                   	push   %ebx
+  80077a:	57                   	push   %edi
+  80077b:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80077e:	83 ee 01             	sub    $0x1,%esi
+  800781:	83 c4 10             	add    $0x10,%esp
+  800784:	85 f6                	test   %esi,%esi
+  800786:	7f ee                	jg     800776 <vprintfmt+0x1cc>
+  800788:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80078b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80078e:	85 c0                	test   %eax,%eax
+  800790:	ba 00 00 00 00       	mov    $0x0,%edx
+  800795:	0f 49 d0             	cmovns %eax,%edx
+  800798:	29 d0                	sub    %edx,%eax
+  80079a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80079d:	eb a6                	jmp    800745 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80079f:	83 ec 08             	sub    $0x8,%esp
+  8007a2:	53                   	push   %ebx
+  8007a3:	52                   	push   %edx
+  8007a4:	ff 55 08             	call   *0x8(%ebp)
+  8007a7:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007aa:	89 f1                	mov    %esi,%ecx
+  8007ac:	8d 71 01             	lea    0x1(%ecx),%esi
+  8007af:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8007b3:	0f be d0             	movsbl %al,%edx
+  8007b6:	85 d2                	test   %edx,%edx
+  8007b8:	74 28                	je     8007e2 <vprintfmt+0x238>
+  8007ba:	85 ff                	test   %edi,%edi
+  8007bc:	78 05                	js     8007c3 <vprintfmt+0x219>
+  8007be:	83 ef 01             	sub    $0x1,%edi
+  8007c1:	78 30                	js     8007f3 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8007c3:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8007c7:	74 d6                	je     80079f <vprintfmt+0x1f5>
+  8007c9:	0f be c0             	movsbl %al,%eax
+  8007cc:	83 e8 20             	sub    $0x20,%eax
+  8007cf:	83 f8 5e             	cmp    $0x5e,%eax
+  8007d2:	76 cb                	jbe    80079f <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8007d4:	83 ec 08             	sub    $0x8,%esp
+  8007d7:	53                   	push   %ebx
+  8007d8:	6a 3f                	push   $0x3f
+  8007da:	ff 55 08             	call   *0x8(%ebp)
+  8007dd:	83 c4 10             	add    $0x10,%esp
+  8007e0:	eb c8                	jmp    8007aa <vprintfmt+0x200>
+  8007e2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007e5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007e8:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8007eb:	01 d0                	add    %edx,%eax
+  8007ed:	29 c8                	sub    %ecx,%eax
+  8007ef:	89 c7                	mov    %eax,%edi
+  8007f1:	eb 13                	jmp    800806 <vprintfmt+0x25c>
+  8007f3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007f6:	eb ed                	jmp    8007e5 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8007f8:	83 ec 08             	sub    $0x8,%esp
+  8007fb:	53                   	push   %ebx
+  8007fc:	6a 20                	push   $0x20
+  8007fe:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800800:	83 ef 01             	sub    $0x1,%edi
+  800803:	83 c4 10             	add    $0x10,%esp
+  800806:	85 ff                	test   %edi,%edi
+  800808:	7f ee                	jg     8007f8 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80080a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80080d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800810:	e9 6b 01 00 00       	jmp    800980 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800815:	83 f9 01             	cmp    $0x1,%ecx
+  800818:	7f 1f                	jg     800839 <vprintfmt+0x28f>
+	else if (lflag)
+  80081a:	85 c9                	test   %ecx,%ecx
+  80081c:	74 67                	je     800885 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80081e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800821:	8b 00                	mov    (%eax),%eax
+  800823:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800826:	89 c1                	mov    %eax,%ecx
+  800828:	c1 f9 1f             	sar    $0x1f,%ecx
+  80082b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80082e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800831:	8d 40 04             	lea    0x4(%eax),%eax
+  800834:	89 45 14             	mov    %eax,0x14(%ebp)
+  800837:	eb 17                	jmp    800850 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800839:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083c:	8b 50 04             	mov    0x4(%eax),%edx
+  80083f:	8b 00                	mov    (%eax),%eax
+  800841:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800844:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800847:	8b 45 14             	mov    0x14(%ebp),%eax
+  80084a:	8d 40 08             	lea    0x8(%eax),%eax
+  80084d:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800850:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800853:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800856:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80085b:	85 c9                	test   %ecx,%ecx
+  80085d:	0f 89 03 01 00 00    	jns    800966 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800863:	83 ec 08             	sub    $0x8,%esp
+  800866:	53                   	push   %ebx
+  800867:	6a 2d                	push   $0x2d
+  800869:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80086b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80086e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800871:	f7 da                	neg    %edx
+  800873:	83 d1 00             	adc    $0x0,%ecx
+  800876:	f7 d9                	neg    %ecx
+  800878:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80087b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800880:	e9 e1 00 00 00       	jmp    800966 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800885:	8b 45 14             	mov    0x14(%ebp),%eax
+  800888:	8b 00                	mov    (%eax),%eax
+  80088a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80088d:	89 c1                	mov    %eax,%ecx
+  80088f:	c1 f9 1f             	sar    $0x1f,%ecx
+  800892:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800895:	8b 45 14             	mov    0x14(%ebp),%eax
+  800898:	8d 40 04             	lea    0x4(%eax),%eax
+  80089b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80089e:	eb b0                	jmp    800850 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8008a0:	83 f9 01             	cmp    $0x1,%ecx
+  8008a3:	7f 1e                	jg     8008c3 <vprintfmt+0x319>
+	else if (lflag)
+  8008a5:	85 c9                	test   %ecx,%ecx
+  8008a7:	74 32                	je     8008db <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8008a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ac:	8b 10                	mov    (%eax),%edx
+  8008ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008b3:	8d 40 04             	lea    0x4(%eax),%eax
+  8008b6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008b9:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8008be:	e9 a3 00 00 00       	jmp    800966 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8008c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c6:	8b 10                	mov    (%eax),%edx
+  8008c8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008cb:	8d 40 08             	lea    0x8(%eax),%eax
+  8008ce:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008d1:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8008d6:	e9 8b 00 00 00       	jmp    800966 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8008db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008de:	8b 10                	mov    (%eax),%edx
+  8008e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008e5:	8d 40 04             	lea    0x4(%eax),%eax
+  8008e8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008eb:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8008f0:	eb 74                	jmp    800966 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8008f2:	83 f9 01             	cmp    $0x1,%ecx
+  8008f5:	7f 1b                	jg     800912 <vprintfmt+0x368>
+	else if (lflag)
+  8008f7:	85 c9                	test   %ecx,%ecx
+  8008f9:	74 2c                	je     800927 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8008fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008fe:	8b 10                	mov    (%eax),%edx
+  800900:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800905:	8d 40 04             	lea    0x4(%eax),%eax
+  800908:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80090b:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800910:	eb 54                	jmp    800966 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800912:	8b 45 14             	mov    0x14(%ebp),%eax
+  800915:	8b 10                	mov    (%eax),%edx
+  800917:	8b 48 04             	mov    0x4(%eax),%ecx
+  80091a:	8d 40 08             	lea    0x8(%eax),%eax
+  80091d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800920:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800925:	eb 3f                	jmp    800966 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800927:	8b 45 14             	mov    0x14(%ebp),%eax
+  80092a:	8b 10                	mov    (%eax),%edx
+  80092c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800931:	8d 40 04             	lea    0x4(%eax),%eax
+  800934:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800937:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80093c:	eb 28                	jmp    800966 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  80093e:	83 ec 08             	sub    $0x8,%esp
+  800941:	53                   	push   %ebx
+  800942:	6a 30                	push   $0x30
+  800944:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800946:	83 c4 08             	add    $0x8,%esp
+  800949:	53                   	push   %ebx
+  80094a:	6a 78                	push   $0x78
+  80094c:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80094e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800951:	8b 10                	mov    (%eax),%edx
+  800953:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800958:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80095b:	8d 40 04             	lea    0x4(%eax),%eax
+  80095e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800961:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800966:	83 ec 0c             	sub    $0xc,%esp
+  800969:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80096d:	50                   	push   %eax
+  80096e:	ff 75 e0             	push   -0x20(%ebp)
+  800971:	57                   	push   %edi
+  800972:	51                   	push   %ecx
+  800973:	52                   	push   %edx
+  800974:	89 da                	mov    %ebx,%edx
+  800976:	89 f0                	mov    %esi,%eax
+  800978:	e8 4a fb ff ff       	call   8004c7 <printnum>
+			break;
+  80097d:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800980:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800983:	e9 40 fc ff ff       	jmp    8005c8 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800988:	83 f9 01             	cmp    $0x1,%ecx
+  80098b:	7f 1b                	jg     8009a8 <vprintfmt+0x3fe>
+	else if (lflag)
+  80098d:	85 c9                	test   %ecx,%ecx
+  80098f:	74 2c                	je     8009bd <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800991:	8b 45 14             	mov    0x14(%ebp),%eax
+  800994:	8b 10                	mov    (%eax),%edx
+  800996:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80099b:	8d 40 04             	lea    0x4(%eax),%eax
+  80099e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009a1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8009a6:	eb be                	jmp    800966 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8009a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009ab:	8b 10                	mov    (%eax),%edx
+  8009ad:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009b0:	8d 40 08             	lea    0x8(%eax),%eax
+  8009b3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009b6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8009bb:	eb a9                	jmp    800966 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8009bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c0:	8b 10                	mov    (%eax),%edx
+  8009c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009c7:	8d 40 04             	lea    0x4(%eax),%eax
+  8009ca:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009cd:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8009d2:	eb 92                	jmp    800966 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8009d4:	83 ec 08             	sub    $0x8,%esp
+  8009d7:	53                   	push   %ebx
+  8009d8:	6a 25                	push   $0x25
+  8009da:	ff d6                	call   *%esi
+			break;
+  8009dc:	83 c4 10             	add    $0x10,%esp
+  8009df:	eb 9f                	jmp    800980 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8009e1:	83 ec 08             	sub    $0x8,%esp
+  8009e4:	53                   	push   %ebx
+  8009e5:	6a 25                	push   $0x25
+  8009e7:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8009e9:	83 c4 10             	add    $0x10,%esp
+  8009ec:	89 f8                	mov    %edi,%eax
+  8009ee:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8009f2:	74 05                	je     8009f9 <vprintfmt+0x44f>
+  8009f4:	83 e8 01             	sub    $0x1,%eax
+  8009f7:	eb f5                	jmp    8009ee <vprintfmt+0x444>
+  8009f9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8009fc:	eb 82                	jmp    800980 <vprintfmt+0x3d6>
+
+008009fe <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8009fe:	55                   	push   %ebp
+  8009ff:	89 e5                	mov    %esp,%ebp
+  800a01:	83 ec 18             	sub    $0x18,%esp
+  800a04:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a07:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800a0a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800a0d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a11:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800a14:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800a1b:	85 c0                	test   %eax,%eax
+  800a1d:	74 26                	je     800a45 <vsnprintf+0x47>
+  800a1f:	85 d2                	test   %edx,%edx
+  800a21:	7e 22                	jle    800a45 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800a23:	ff 75 14             	push   0x14(%ebp)
+  800a26:	ff 75 10             	push   0x10(%ebp)
+  800a29:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800a2c:	50                   	push   %eax
+  800a2d:	68 70 05 80 00       	push   $0x800570
+  800a32:	e8 73 fb ff ff       	call   8005aa <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800a37:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800a3a:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800a3d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a40:	83 c4 10             	add    $0x10,%esp
+}
+  800a43:	c9                   	leave
+  800a44:	c3                   	ret
+		return -E_INVAL;
+  800a45:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a4a:	eb f7                	jmp    800a43 <vsnprintf+0x45>
+
+00800a4c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a4c:	55                   	push   %ebp
+  800a4d:	89 e5                	mov    %esp,%ebp
+  800a4f:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800a52:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800a55:	50                   	push   %eax
+  800a56:	ff 75 10             	push   0x10(%ebp)
+  800a59:	ff 75 0c             	push   0xc(%ebp)
+  800a5c:	ff 75 08             	push   0x8(%ebp)
+  800a5f:	e8 9a ff ff ff       	call   8009fe <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800a64:	c9                   	leave
+  800a65:	c3                   	ret
+
+00800a66 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a66:	55                   	push   %ebp
+  800a67:	89 e5                	mov    %esp,%ebp
+  800a69:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800a6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a71:	eb 03                	jmp    800a76 <strlen+0x10>
+		n++;
+  800a73:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800a76:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a7a:	75 f7                	jne    800a73 <strlen+0xd>
+	return n;
+}
+  800a7c:	5d                   	pop    %ebp
+  800a7d:	c3                   	ret
+
+00800a7e <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a7e:	55                   	push   %ebp
+  800a7f:	89 e5                	mov    %esp,%ebp
+  800a81:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a84:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a87:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a8c:	eb 03                	jmp    800a91 <strnlen+0x13>
+		n++;
+  800a8e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a91:	39 d0                	cmp    %edx,%eax
+  800a93:	74 08                	je     800a9d <strnlen+0x1f>
+  800a95:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a99:	75 f3                	jne    800a8e <strnlen+0x10>
+  800a9b:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800a9d:	89 d0                	mov    %edx,%eax
+  800a9f:	5d                   	pop    %ebp
+  800aa0:	c3                   	ret
+
+00800aa1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800aa1:	55                   	push   %ebp
+  800aa2:	89 e5                	mov    %esp,%ebp
+  800aa4:	53                   	push   %ebx
+  800aa5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800aa8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800aab:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ab0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800ab4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800ab7:	83 c0 01             	add    $0x1,%eax
+  800aba:	84 d2                	test   %dl,%dl
+  800abc:	75 f2                	jne    800ab0 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800abe:	89 c8                	mov    %ecx,%eax
+  800ac0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ac3:	c9                   	leave
+  800ac4:	c3                   	ret
+
+00800ac5 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800ac5:	55                   	push   %ebp
+  800ac6:	89 e5                	mov    %esp,%ebp
+  800ac8:	53                   	push   %ebx
+  800ac9:	83 ec 10             	sub    $0x10,%esp
+  800acc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800acf:	53                   	push   %ebx
+  800ad0:	e8 91 ff ff ff       	call   800a66 <strlen>
+  800ad5:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800ad8:	ff 75 0c             	push   0xc(%ebp)
+  800adb:	01 d8                	add    %ebx,%eax
+  800add:	50                   	push   %eax
+  800ade:	e8 be ff ff ff       	call   800aa1 <strcpy>
+	return dst;
+}
+  800ae3:	89 d8                	mov    %ebx,%eax
+  800ae5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ae8:	c9                   	leave
+  800ae9:	c3                   	ret
+
+00800aea <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800aea:	55                   	push   %ebp
+  800aeb:	89 e5                	mov    %esp,%ebp
+  800aed:	56                   	push   %esi
+  800aee:	53                   	push   %ebx
+  800aef:	8b 75 08             	mov    0x8(%ebp),%esi
+  800af2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800af5:	89 f3                	mov    %esi,%ebx
+  800af7:	03 5d 10             	add    0x10(%ebp),%ebx
+  800afa:	89 f0                	mov    %esi,%eax
+  800afc:	eb 0f                	jmp    800b0d <strncpy+0x23>
+		*dst++ = *src;
+  800afe:	83 c0 01             	add    $0x1,%eax
+  800b01:	0f b6 0a             	movzbl (%edx),%ecx
+  800b04:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800b07:	80 f9 01             	cmp    $0x1,%cl
+  800b0a:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800b0d:	39 d8                	cmp    %ebx,%eax
+  800b0f:	75 ed                	jne    800afe <strncpy+0x14>
+	}
+	return ret;
+}
+  800b11:	89 f0                	mov    %esi,%eax
+  800b13:	5b                   	pop    %ebx
+  800b14:	5e                   	pop    %esi
+  800b15:	5d                   	pop    %ebp
+  800b16:	c3                   	ret
+
+00800b17 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800b17:	55                   	push   %ebp
+  800b18:	89 e5                	mov    %esp,%ebp
+  800b1a:	56                   	push   %esi
+  800b1b:	53                   	push   %ebx
+  800b1c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b1f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b22:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800b25:	89 f0                	mov    %esi,%eax
+  800b27:	85 d2                	test   %edx,%edx
+  800b29:	74 21                	je     800b4c <strlcpy+0x35>
+  800b2b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800b2f:	89 f2                	mov    %esi,%edx
+  800b31:	eb 09                	jmp    800b3c <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800b33:	83 c1 01             	add    $0x1,%ecx
+  800b36:	83 c2 01             	add    $0x1,%edx
+  800b39:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800b3c:	39 c2                	cmp    %eax,%edx
+  800b3e:	74 09                	je     800b49 <strlcpy+0x32>
+  800b40:	0f b6 19             	movzbl (%ecx),%ebx
+  800b43:	84 db                	test   %bl,%bl
+  800b45:	75 ec                	jne    800b33 <strlcpy+0x1c>
+  800b47:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800b49:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800b4c:	29 f0                	sub    %esi,%eax
+}
+  800b4e:	5b                   	pop    %ebx
+  800b4f:	5e                   	pop    %esi
+  800b50:	5d                   	pop    %ebp
+  800b51:	c3                   	ret
+
+00800b52 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b52:	55                   	push   %ebp
+  800b53:	89 e5                	mov    %esp,%ebp
+  800b55:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b58:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800b5b:	eb 06                	jmp    800b63 <strcmp+0x11>
+		p++, q++;
+  800b5d:	83 c1 01             	add    $0x1,%ecx
+  800b60:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800b63:	0f b6 01             	movzbl (%ecx),%eax
+  800b66:	84 c0                	test   %al,%al
+  800b68:	74 04                	je     800b6e <strcmp+0x1c>
+  800b6a:	3a 02                	cmp    (%edx),%al
+  800b6c:	74 ef                	je     800b5d <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b6e:	0f b6 c0             	movzbl %al,%eax
+  800b71:	0f b6 12             	movzbl (%edx),%edx
+  800b74:	29 d0                	sub    %edx,%eax
+}
+  800b76:	5d                   	pop    %ebp
+  800b77:	c3                   	ret
+
+00800b78 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b78:	55                   	push   %ebp
+  800b79:	89 e5                	mov    %esp,%ebp
+  800b7b:	53                   	push   %ebx
+  800b7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b82:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800b85:	eb 09                	jmp    800b90 <strncmp+0x18>
+		n--, p++, q++;
+  800b87:	83 ea 01             	sub    $0x1,%edx
+  800b8a:	83 c0 01             	add    $0x1,%eax
+  800b8d:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800b90:	85 d2                	test   %edx,%edx
+  800b92:	74 18                	je     800bac <strncmp+0x34>
+  800b94:	0f b6 18             	movzbl (%eax),%ebx
+  800b97:	84 db                	test   %bl,%bl
+  800b99:	74 04                	je     800b9f <strncmp+0x27>
+  800b9b:	3a 19                	cmp    (%ecx),%bl
+  800b9d:	74 e8                	je     800b87 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b9f:	0f b6 00             	movzbl (%eax),%eax
+  800ba2:	0f b6 11             	movzbl (%ecx),%edx
+  800ba5:	29 d0                	sub    %edx,%eax
+}
+  800ba7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800baa:	c9                   	leave
+  800bab:	c3                   	ret
+		return 0;
+  800bac:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bb1:	eb f4                	jmp    800ba7 <strncmp+0x2f>
+
+00800bb3 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800bb3:	55                   	push   %ebp
+  800bb4:	89 e5                	mov    %esp,%ebp
+  800bb6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bb9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800bbd:	eb 03                	jmp    800bc2 <strchr+0xf>
+  800bbf:	83 c0 01             	add    $0x1,%eax
+  800bc2:	0f b6 10             	movzbl (%eax),%edx
+  800bc5:	84 d2                	test   %dl,%dl
+  800bc7:	74 06                	je     800bcf <strchr+0x1c>
+		if (*s == c)
+  800bc9:	38 ca                	cmp    %cl,%dl
+  800bcb:	75 f2                	jne    800bbf <strchr+0xc>
+  800bcd:	eb 05                	jmp    800bd4 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800bcf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bd4:	5d                   	pop    %ebp
+  800bd5:	c3                   	ret
+
+00800bd6 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800bd6:	55                   	push   %ebp
+  800bd7:	89 e5                	mov    %esp,%ebp
+  800bd9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bdc:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800be0:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800be3:	38 ca                	cmp    %cl,%dl
+  800be5:	74 09                	je     800bf0 <strfind+0x1a>
+  800be7:	84 d2                	test   %dl,%dl
+  800be9:	74 05                	je     800bf0 <strfind+0x1a>
+	for (; *s; s++)
+  800beb:	83 c0 01             	add    $0x1,%eax
+  800bee:	eb f0                	jmp    800be0 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800bf0:	5d                   	pop    %ebp
+  800bf1:	c3                   	ret
+
+00800bf2 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800bf2:	55                   	push   %ebp
+  800bf3:	89 e5                	mov    %esp,%ebp
+  800bf5:	57                   	push   %edi
+  800bf6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800bf9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800bfc:	85 c9                	test   %ecx,%ecx
+  800bfe:	74 20                	je     800c20 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800c00:	89 f8                	mov    %edi,%eax
+  800c02:	09 c8                	or     %ecx,%eax
+  800c04:	a8 03                	test   $0x3,%al
+  800c06:	75 12                	jne    800c1a <memset+0x28>
+		c &= 0xFF;
+  800c08:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800c0c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800c12:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800c15:	fc                   	cld
+  800c16:	f3 ab                	rep stos %eax,%es:(%edi)
+  800c18:	eb 06                	jmp    800c20 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800c1a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c1d:	fc                   	cld
+  800c1e:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800c20:	89 f8                	mov    %edi,%eax
+  800c22:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c25:	c9                   	leave
+  800c26:	c3                   	ret
+
+00800c27 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800c27:	55                   	push   %ebp
+  800c28:	89 e5                	mov    %esp,%ebp
+  800c2a:	57                   	push   %edi
+  800c2b:	56                   	push   %esi
+  800c2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c2f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c32:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800c35:	39 c6                	cmp    %eax,%esi
+  800c37:	73 32                	jae    800c6b <memmove+0x44>
+  800c39:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c3c:	39 d0                	cmp    %edx,%eax
+  800c3e:	73 2b                	jae    800c6b <memmove+0x44>
+		s += n;
+		d += n;
+  800c40:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c43:	89 d6                	mov    %edx,%esi
+  800c45:	09 fe                	or     %edi,%esi
+  800c47:	09 ce                	or     %ecx,%esi
+  800c49:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c4f:	75 0e                	jne    800c5f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c51:	83 ef 04             	sub    $0x4,%edi
+  800c54:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c57:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800c5a:	fd                   	std
+  800c5b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c5d:	eb 09                	jmp    800c68 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c5f:	83 ef 01             	sub    $0x1,%edi
+  800c62:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800c65:	fd                   	std
+  800c66:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c68:	fc                   	cld
+  800c69:	eb 1a                	jmp    800c85 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c6b:	89 f2                	mov    %esi,%edx
+  800c6d:	09 c2                	or     %eax,%edx
+  800c6f:	09 ca                	or     %ecx,%edx
+  800c71:	f6 c2 03             	test   $0x3,%dl
+  800c74:	75 0a                	jne    800c80 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c76:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c79:	89 c7                	mov    %eax,%edi
+  800c7b:	fc                   	cld
+  800c7c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c7e:	eb 05                	jmp    800c85 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c80:	89 c7                	mov    %eax,%edi
+  800c82:	fc                   	cld
+  800c83:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c85:	5e                   	pop    %esi
+  800c86:	5f                   	pop    %edi
+  800c87:	5d                   	pop    %ebp
+  800c88:	c3                   	ret
+
+00800c89 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c89:	55                   	push   %ebp
+  800c8a:	89 e5                	mov    %esp,%ebp
+  800c8c:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c8f:	ff 75 10             	push   0x10(%ebp)
+  800c92:	ff 75 0c             	push   0xc(%ebp)
+  800c95:	ff 75 08             	push   0x8(%ebp)
+  800c98:	e8 8a ff ff ff       	call   800c27 <memmove>
+}
+  800c9d:	c9                   	leave
+  800c9e:	c3                   	ret
+
+00800c9f <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c9f:	55                   	push   %ebp
+  800ca0:	89 e5                	mov    %esp,%ebp
+  800ca2:	56                   	push   %esi
+  800ca3:	53                   	push   %ebx
+  800ca4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ca7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800caa:	89 c6                	mov    %eax,%esi
+  800cac:	03 75 10             	add    0x10(%ebp),%esi
+  800caf:	eb 06                	jmp    800cb7 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800cb1:	83 c0 01             	add    $0x1,%eax
+  800cb4:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800cb7:	39 f0                	cmp    %esi,%eax
+  800cb9:	74 14                	je     800ccf <memcmp+0x30>
+		if (*s1 != *s2)
+  800cbb:	0f b6 08             	movzbl (%eax),%ecx
+  800cbe:	0f b6 1a             	movzbl (%edx),%ebx
+  800cc1:	38 d9                	cmp    %bl,%cl
+  800cc3:	74 ec                	je     800cb1 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800cc5:	0f b6 c1             	movzbl %cl,%eax
+  800cc8:	0f b6 db             	movzbl %bl,%ebx
+  800ccb:	29 d8                	sub    %ebx,%eax
+  800ccd:	eb 05                	jmp    800cd4 <memcmp+0x35>
+	}
+
+	return 0;
+  800ccf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cd4:	5b                   	pop    %ebx
+  800cd5:	5e                   	pop    %esi
+  800cd6:	5d                   	pop    %ebp
+  800cd7:	c3                   	ret
+
+00800cd8 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800cd8:	55                   	push   %ebp
+  800cd9:	89 e5                	mov    %esp,%ebp
+  800cdb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cde:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800ce1:	89 c2                	mov    %eax,%edx
+  800ce3:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800ce6:	eb 03                	jmp    800ceb <memfind+0x13>
+  800ce8:	83 c0 01             	add    $0x1,%eax
+  800ceb:	39 d0                	cmp    %edx,%eax
+  800ced:	73 04                	jae    800cf3 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800cef:	38 08                	cmp    %cl,(%eax)
+  800cf1:	75 f5                	jne    800ce8 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800cf3:	5d                   	pop    %ebp
+  800cf4:	c3                   	ret
+
+00800cf5 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800cf5:	55                   	push   %ebp
+  800cf6:	89 e5                	mov    %esp,%ebp
+  800cf8:	57                   	push   %edi
+  800cf9:	56                   	push   %esi
+  800cfa:	53                   	push   %ebx
+  800cfb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cfe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800d01:	eb 03                	jmp    800d06 <strtol+0x11>
+		s++;
+  800d03:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800d06:	0f b6 02             	movzbl (%edx),%eax
+  800d09:	3c 20                	cmp    $0x20,%al
+  800d0b:	74 f6                	je     800d03 <strtol+0xe>
+  800d0d:	3c 09                	cmp    $0x9,%al
+  800d0f:	74 f2                	je     800d03 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800d11:	3c 2b                	cmp    $0x2b,%al
+  800d13:	74 2a                	je     800d3f <strtol+0x4a>
+	int neg = 0;
+  800d15:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800d1a:	3c 2d                	cmp    $0x2d,%al
+  800d1c:	74 2b                	je     800d49 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d1e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800d24:	75 0f                	jne    800d35 <strtol+0x40>
+  800d26:	80 3a 30             	cmpb   $0x30,(%edx)
+  800d29:	74 28                	je     800d53 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800d2b:	85 db                	test   %ebx,%ebx
+  800d2d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d32:	0f 44 d8             	cmove  %eax,%ebx
+  800d35:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d3a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d3d:	eb 46                	jmp    800d85 <strtol+0x90>
+		s++;
+  800d3f:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800d42:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d47:	eb d5                	jmp    800d1e <strtol+0x29>
+		s++, neg = 1;
+  800d49:	83 c2 01             	add    $0x1,%edx
+  800d4c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d51:	eb cb                	jmp    800d1e <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d53:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d57:	74 0e                	je     800d67 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800d59:	85 db                	test   %ebx,%ebx
+  800d5b:	75 d8                	jne    800d35 <strtol+0x40>
+		s++, base = 8;
+  800d5d:	83 c2 01             	add    $0x1,%edx
+  800d60:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d65:	eb ce                	jmp    800d35 <strtol+0x40>
+		s += 2, base = 16;
+  800d67:	83 c2 02             	add    $0x2,%edx
+  800d6a:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d6f:	eb c4                	jmp    800d35 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800d71:	0f be c0             	movsbl %al,%eax
+  800d74:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800d77:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d7a:	7d 3a                	jge    800db6 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800d7c:	83 c2 01             	add    $0x1,%edx
+  800d7f:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d83:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800d85:	0f b6 02             	movzbl (%edx),%eax
+  800d88:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d8b:	89 f3                	mov    %esi,%ebx
+  800d8d:	80 fb 09             	cmp    $0x9,%bl
+  800d90:	76 df                	jbe    800d71 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800d92:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d95:	89 f3                	mov    %esi,%ebx
+  800d97:	80 fb 19             	cmp    $0x19,%bl
+  800d9a:	77 08                	ja     800da4 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800d9c:	0f be c0             	movsbl %al,%eax
+  800d9f:	83 e8 57             	sub    $0x57,%eax
+  800da2:	eb d3                	jmp    800d77 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800da4:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800da7:	89 f3                	mov    %esi,%ebx
+  800da9:	80 fb 19             	cmp    $0x19,%bl
+  800dac:	77 08                	ja     800db6 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800dae:	0f be c0             	movsbl %al,%eax
+  800db1:	83 e8 37             	sub    $0x37,%eax
+  800db4:	eb c1                	jmp    800d77 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800db6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800dba:	74 05                	je     800dc1 <strtol+0xcc>
+		*endptr = (char *) s;
+  800dbc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800dbf:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800dc1:	89 c8                	mov    %ecx,%eax
+  800dc3:	f7 d8                	neg    %eax
+  800dc5:	85 ff                	test   %edi,%edi
+  800dc7:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800dca:	89 c8                	mov    %ecx,%eax
+  800dcc:	5b                   	pop    %ebx
+  800dcd:	5e                   	pop    %esi
+  800dce:	5f                   	pop    %edi
+  800dcf:	5d                   	pop    %ebp
+  800dd0:	c3                   	ret
+
+00800dd1 <atoi>:
+
+int
+atoi(const char *s)
+{
+  800dd1:	55                   	push   %ebp
+  800dd2:	89 e5                	mov    %esp,%ebp
+  800dd4:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800dd7:	6a 0a                	push   $0xa
+  800dd9:	6a 00                	push   $0x0
+  800ddb:	ff 75 08             	push   0x8(%ebp)
+  800dde:	e8 12 ff ff ff       	call   800cf5 <strtol>
+}
+  800de3:	c9                   	leave
+  800de4:	c3                   	ret
+
+00800de5 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800de5:	55                   	push   %ebp
+  800de6:	89 e5                	mov    %esp,%ebp
+  800de8:	57                   	push   %edi
+  800de9:	56                   	push   %esi
+  800dea:	53                   	push   %ebx
+  800deb:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800df1:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800df7:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800dfd:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800e03:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800e0a:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800e0d:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800e14:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800e17:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800e1e:	74 76                	je     800e96 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800e20:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800e26:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e29:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800e2f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e36:	0f 88 06 01 00 00    	js     800f42 <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800e3c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e43:	0f 84 48 01 00 00    	je     800f91 <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800e49:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800e4f:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800e55:	be 00 00 00 00       	mov    $0x0,%esi
+  800e5a:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800e60:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800e63:	55                   	push   %ebp
+  800e64:	68 6d 0e 80 00       	push   $0x800e6d
+  800e69:	89 e5                	mov    %esp,%ebp
+  800e6b:	0f 34                	sysenter
+  800e6d:	83 c4 04             	add    $0x4,%esp
+  800e70:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800e71:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800e77:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800e7d:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800e80:	0f 85 9a 01 00 00    	jne    801020 <page_vec_call+0x23b>
+  800e86:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e8b:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e8e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e91:	e9 29 01 00 00       	jmp    800fbf <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800e96:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800e9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e9f:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800ea1:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800ea8:	78 2f                	js     800ed9 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800eaa:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800eb1:	74 72                	je     800f25 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800eb3:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800eb9:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800ebf:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ec4:	89 fb                	mov    %edi,%ebx
+  800ec6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800ec9:	55                   	push   %ebp
+  800eca:	68 d3 0e 80 00       	push   $0x800ed3
+  800ecf:	89 e5                	mov    %esp,%ebp
+  800ed1:	0f 34                	sysenter
+  800ed3:	83 c4 04             	add    $0x4,%esp
+  800ed6:	5d                   	pop    %ebp
+	return ret;
+  800ed7:	eb 98                	jmp    800e71 <page_vec_call+0x8c>
+	asm volatile("cpuid"
+  800ed9:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ede:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800ee0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800ee5:	f6 c6 08             	test   $0x8,%dh
+  800ee8:	74 15                	je     800eff <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800eea:	89 c2                	mov    %eax,%edx
+  800eec:	c1 ea 08             	shr    $0x8,%edx
+  800eef:	83 e2 0f             	and    $0xf,%edx
+  800ef2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ef7:	83 fa 06             	cmp    $0x6,%edx
+  800efa:	74 0e                	je     800f0a <page_vec_call+0x125>
+  800efc:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800eff:	0f b6 c9             	movzbl %cl,%ecx
+  800f02:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800f08:	eb a0                	jmp    800eaa <page_vec_call+0xc5>
+  800f0a:	89 c2                	mov    %eax,%edx
+  800f0c:	c1 ea 04             	shr    $0x4,%edx
+  800f0f:	83 e2 0f             	and    $0xf,%edx
+  800f12:	83 fa 02             	cmp    $0x2,%edx
+  800f15:	77 e5                	ja     800efc <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800f17:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f1a:	83 f8 02             	cmp    $0x2,%eax
+  800f1d:	0f 97 c1             	seta   %cl
+  800f20:	0f b6 c9             	movzbl %cl,%ecx
+  800f23:	eb d7                	jmp    800efc <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800f25:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f2a:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800f30:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800f36:	89 fb                	mov    %edi,%ebx
+  800f38:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800f3b:	cd 30                	int    $0x30
+  800f3d:	e9 2f ff ff ff       	jmp    800e71 <page_vec_call+0x8c>
+  800f42:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f47:	0f a2                	cpuid
+		return 0;
+  800f49:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f4e:	f6 c6 08             	test   $0x8,%dh
+  800f51:	74 15                	je     800f68 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f53:	89 c2                	mov    %eax,%edx
+  800f55:	c1 ea 08             	shr    $0x8,%edx
+  800f58:	83 e2 0f             	and    $0xf,%edx
+  800f5b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f60:	83 fa 06             	cmp    $0x6,%edx
+  800f63:	74 11                	je     800f76 <page_vec_call+0x191>
+  800f65:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f68:	0f b6 c9             	movzbl %cl,%ecx
+  800f6b:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800f71:	e9 c6 fe ff ff       	jmp    800e3c <page_vec_call+0x57>
+  800f76:	89 c2                	mov    %eax,%edx
+  800f78:	c1 ea 04             	shr    $0x4,%edx
+  800f7b:	83 e2 0f             	and    $0xf,%edx
+  800f7e:	83 fa 02             	cmp    $0x2,%edx
+  800f81:	77 e2                	ja     800f65 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800f83:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f86:	83 f8 02             	cmp    $0x2,%eax
+  800f89:	0f 97 c1             	seta   %cl
+  800f8c:	0f b6 c9             	movzbl %cl,%ecx
+  800f8f:	eb d4                	jmp    800f65 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800f91:	be 00 00 00 00       	mov    $0x0,%esi
+  800f96:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800f9c:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800fa2:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800fa8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800fab:	cd 30                	int    $0x30
+  800fad:	e9 bf fe ff ff       	jmp    800e71 <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800fb2:	29 da                	sub    %ebx,%edx
+			vec++;
+  800fb4:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800fb7:	83 e8 01             	sub    $0x1,%eax
+  800fba:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800fbf:	85 c0                	test   %eax,%eax
+  800fc1:	74 58                	je     80101b <page_vec_call+0x236>
+  800fc3:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800fc6:	39 da                	cmp    %ebx,%edx
+  800fc8:	73 e8                	jae    800fb2 <page_vec_call+0x1cd>
+  800fca:	89 75 08             	mov    %esi,0x8(%ebp)
+  800fcd:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800fd0:	84 c9                	test   %cl,%cl
+  800fd2:	74 06                	je     800fda <page_vec_call+0x1f5>
+  800fd4:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800fda:	83 ec 04             	sub    $0x4,%esp
+  800fdd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800fe0:	c1 e0 04             	shl    $0x4,%eax
+  800fe3:	50                   	push   %eax
+  800fe4:	ff 75 08             	push   0x8(%ebp)
+  800fe7:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800fed:	53                   	push   %ebx
+  800fee:	e8 34 fc ff ff       	call   800c27 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800ff3:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800ff9:	89 c2                	mov    %eax,%edx
+  800ffb:	c1 e2 0c             	shl    $0xc,%edx
+  800ffe:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  801004:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  80100a:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  801010:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  801013:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  801016:	e9 f2 fd ff ff       	jmp    800e0d <page_vec_call+0x28>
+			r = 0;
+  80101b:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  801020:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801024:	74 0b                	je     801031 <page_vec_call+0x24c>
+		*done = total;
+  801026:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801029:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  80102f:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  801031:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801034:	5b                   	pop    %ebx
+  801035:	5e                   	pop    %esi
+  801036:	5f                   	pop    %edi
+  801037:	5d                   	pop    %ebp
+  801038:	c3                   	ret
+
+00801039 <sys_cputs>:
+{
+  801039:	55                   	push   %ebp
+  80103a:	89 e5                	mov    %esp,%ebp
+  80103c:	57                   	push   %edi
+  80103d:	56                   	push   %esi
+  80103e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80103f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801046:	78 2d                	js     801075 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  801048:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80104f:	74 70                	je     8010c1 <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  801051:	b8 00 00 00 00       	mov    $0x0,%eax
+  801056:	8b 55 08             	mov    0x8(%ebp),%edx
+  801059:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80105c:	89 c3                	mov    %eax,%ebx
+  80105e:	89 c7                	mov    %eax,%edi
+  801060:	89 c6                	mov    %eax,%esi
+  801062:	55                   	push   %ebp
+  801063:	68 6c 10 80 00       	push   $0x80106c
+  801068:	89 e5                	mov    %esp,%ebp
+  80106a:	0f 34                	sysenter
+  80106c:	83 c4 04             	add    $0x4,%esp
+  80106f:	5d                   	pop    %ebp
+}
+  801070:	5b                   	pop    %ebx
+  801071:	5e                   	pop    %esi
+  801072:	5f                   	pop    %edi
+  801073:	5d                   	pop    %ebp
+  801074:	c3                   	ret
+  801075:	b8 01 00 00 00       	mov    $0x1,%eax
+  80107a:	0f a2                	cpuid
+		return 0;
+  80107c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801081:	f6 c6 08             	test   $0x8,%dh
+  801084:	74 15                	je     80109b <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801086:	89 c2                	mov    %eax,%edx
+  801088:	c1 ea 08             	shr    $0x8,%edx
+  80108b:	83 e2 0f             	and    $0xf,%edx
+  80108e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801093:	83 fa 06             	cmp    $0x6,%edx
+  801096:	74 0e                	je     8010a6 <sys_cputs+0x6d>
+  801098:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80109b:	0f b6 c9             	movzbl %cl,%ecx
+  80109e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8010a4:	eb a2                	jmp    801048 <sys_cputs+0xf>
+  8010a6:	89 c2                	mov    %eax,%edx
+  8010a8:	c1 ea 04             	shr    $0x4,%edx
+  8010ab:	83 e2 0f             	and    $0xf,%edx
+  8010ae:	83 fa 02             	cmp    $0x2,%edx
+  8010b1:	77 e5                	ja     801098 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  8010b3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010b6:	83 f8 02             	cmp    $0x2,%eax
+  8010b9:	0f 97 c1             	seta   %cl
+  8010bc:	0f b6 c9             	movzbl %cl,%ecx
+  8010bf:	eb d7                	jmp    801098 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  8010c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010cc:	89 c3                	mov    %eax,%ebx
+  8010ce:	89 c7                	mov    %eax,%edi
+  8010d0:	89 c6                	mov    %eax,%esi
+  8010d2:	cd 30                	int    $0x30
+}
+  8010d4:	eb 9a                	jmp    801070 <sys_cputs+0x37>
+
+008010d6 <sys_cgetc>:
+{
+  8010d6:	55                   	push   %ebp
+  8010d7:	89 e5                	mov    %esp,%ebp
+  8010d9:	57                   	push   %edi
+  8010da:	56                   	push   %esi
+  8010db:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8010dc:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8010e3:	78 2e                	js     801113 <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  8010e5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8010ec:	74 71                	je     80115f <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  8010ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010f3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010f8:	89 d1                	mov    %edx,%ecx
+  8010fa:	89 d3                	mov    %edx,%ebx
+  8010fc:	89 d7                	mov    %edx,%edi
+  8010fe:	89 d6                	mov    %edx,%esi
+  801100:	55                   	push   %ebp
+  801101:	68 0a 11 80 00       	push   $0x80110a
+  801106:	89 e5                	mov    %esp,%ebp
+  801108:	0f 34                	sysenter
+  80110a:	83 c4 04             	add    $0x4,%esp
+  80110d:	5d                   	pop    %ebp
+}
+  80110e:	5b                   	pop    %ebx
+  80110f:	5e                   	pop    %esi
+  801110:	5f                   	pop    %edi
+  801111:	5d                   	pop    %ebp
+  801112:	c3                   	ret
+  801113:	b8 01 00 00 00       	mov    $0x1,%eax
+  801118:	0f a2                	cpuid
+		return 0;
+  80111a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80111f:	f6 c6 08             	test   $0x8,%dh
+  801122:	74 15                	je     801139 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801124:	89 c2                	mov    %eax,%edx
+  801126:	c1 ea 08             	shr    $0x8,%edx
+  801129:	83 e2 0f             	and    $0xf,%edx
+  80112c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801131:	83 fa 06             	cmp    $0x6,%edx
+  801134:	74 0e                	je     801144 <sys_cgetc+0x6e>
+  801136:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801139:	0f b6 c9             	movzbl %cl,%ecx
+  80113c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801142:	eb a1                	jmp    8010e5 <sys_cgetc+0xf>
+  801144:	89 c2                	mov    %eax,%edx
+  801146:	c1 ea 04             	shr    $0x4,%edx
+  801149:	83 e2 0f             	and    $0xf,%edx
+  80114c:	83 fa 02             	cmp    $0x2,%edx
+  80114f:	77 e5                	ja     801136 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  801151:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801154:	83 f8 02             	cmp    $0x2,%eax
+  801157:	0f 97 c1             	seta   %cl
+  80115a:	0f b6 c9             	movzbl %cl,%ecx
+  80115d:	eb d7                	jmp    801136 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  80115f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801164:	b8 01 00 00 00       	mov    $0x1,%eax
+  801169:	89 d1                	mov    %edx,%ecx
+  80116b:	89 d3                	mov    %edx,%ebx
+  80116d:	89 d7                	mov    %edx,%edi
+  80116f:	89 d6                	mov    %edx,%esi
+  801171:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801173:	eb 99                	jmp    80110e <sys_cgetc+0x38>
+
+00801175 <sys_env_destroy>:
+{
+  801175:	55                   	push   %ebp
+  801176:	89 e5                	mov    %esp,%ebp
+  801178:	57                   	push   %edi
+  801179:	56                   	push   %esi
+  80117a:	53                   	push   %ebx
+  80117b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80117e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801185:	78 36                	js     8011bd <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  801187:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80118e:	74 79                	je     801209 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  801190:	8b 55 08             	mov    0x8(%ebp),%edx
+  801193:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801198:	b8 03 00 00 00       	mov    $0x3,%eax
+  80119d:	89 cb                	mov    %ecx,%ebx
+  80119f:	89 cf                	mov    %ecx,%edi
+  8011a1:	89 ce                	mov    %ecx,%esi
+  8011a3:	55                   	push   %ebp
+  8011a4:	68 ad 11 80 00       	push   $0x8011ad
+  8011a9:	89 e5                	mov    %esp,%ebp
+  8011ab:	0f 34                	sysenter
+  8011ad:	83 c4 04             	add    $0x4,%esp
+  8011b0:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8011b1:	85 c0                	test   %eax,%eax
+  8011b3:	7f 6b                	jg     801220 <sys_env_destroy+0xab>
+}
+  8011b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011b8:	5b                   	pop    %ebx
+  8011b9:	5e                   	pop    %esi
+  8011ba:	5f                   	pop    %edi
+  8011bb:	5d                   	pop    %ebp
+  8011bc:	c3                   	ret
+  8011bd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011c2:	0f a2                	cpuid
+		return 0;
+  8011c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8011c9:	f6 c6 08             	test   $0x8,%dh
+  8011cc:	74 15                	je     8011e3 <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011ce:	89 c2                	mov    %eax,%edx
+  8011d0:	c1 ea 08             	shr    $0x8,%edx
+  8011d3:	83 e2 0f             	and    $0xf,%edx
+  8011d6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011db:	83 fa 06             	cmp    $0x6,%edx
+  8011de:	74 0e                	je     8011ee <sys_env_destroy+0x79>
+  8011e0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8011e3:	0f b6 c9             	movzbl %cl,%ecx
+  8011e6:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8011ec:	eb 99                	jmp    801187 <sys_env_destroy+0x12>
+  8011ee:	89 c2                	mov    %eax,%edx
+  8011f0:	c1 ea 04             	shr    $0x4,%edx
+  8011f3:	83 e2 0f             	and    $0xf,%edx
+  8011f6:	83 fa 02             	cmp    $0x2,%edx
+  8011f9:	77 e5                	ja     8011e0 <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  8011fb:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011fe:	83 f8 02             	cmp    $0x2,%eax
+  801201:	0f 97 c1             	seta   %cl
+  801204:	0f b6 c9             	movzbl %cl,%ecx
+  801207:	eb d7                	jmp    8011e0 <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  801209:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80120e:	b8 03 00 00 00       	mov    $0x3,%eax
+  801213:	8b 55 08             	mov    0x8(%ebp),%edx
+  801216:	89 cb                	mov    %ecx,%ebx
+  801218:	89 cf                	mov    %ecx,%edi
+  80121a:	89 ce                	mov    %ecx,%esi
+  80121c:	cd 30                	int    $0x30
+  80121e:	eb 91                	jmp    8011b1 <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801220:	83 ec 0c             	sub    $0xc,%esp
+  801223:	50                   	push   %eax
+  801224:	6a 03                	push   $0x3
+  801226:	68 19 30 80 00       	push   $0x803019
+  80122b:	6a 4a                	push   $0x4a
+  80122d:	68 36 30 80 00       	push   $0x803036
+  801232:	e8 68 f1 ff ff       	call   80039f <_panic>
+
+00801237 <sys_getenvid>:
+{
+  801237:	55                   	push   %ebp
+  801238:	89 e5                	mov    %esp,%ebp
+  80123a:	57                   	push   %edi
+  80123b:	56                   	push   %esi
+  80123c:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80123d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801244:	78 2e                	js     801274 <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  801246:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80124d:	74 71                	je     8012c0 <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  80124f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801254:	b8 02 00 00 00       	mov    $0x2,%eax
+  801259:	89 d1                	mov    %edx,%ecx
+  80125b:	89 d3                	mov    %edx,%ebx
+  80125d:	89 d7                	mov    %edx,%edi
+  80125f:	89 d6                	mov    %edx,%esi
+  801261:	55                   	push   %ebp
+  801262:	68 6b 12 80 00       	push   $0x80126b
+  801267:	89 e5                	mov    %esp,%ebp
+  801269:	0f 34                	sysenter
+  80126b:	83 c4 04             	add    $0x4,%esp
+  80126e:	5d                   	pop    %ebp
+}
+  80126f:	5b                   	pop    %ebx
+  801270:	5e                   	pop    %esi
+  801271:	5f                   	pop    %edi
+  801272:	5d                   	pop    %ebp
+  801273:	c3                   	ret
+  801274:	b8 01 00 00 00       	mov    $0x1,%eax
+  801279:	0f a2                	cpuid
+		return 0;
+  80127b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801280:	f6 c6 08             	test   $0x8,%dh
+  801283:	74 15                	je     80129a <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801285:	89 c2                	mov    %eax,%edx
+  801287:	c1 ea 08             	shr    $0x8,%edx
+  80128a:	83 e2 0f             	and    $0xf,%edx
+  80128d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801292:	83 fa 06             	cmp    $0x6,%edx
+  801295:	74 0e                	je     8012a5 <sys_getenvid+0x6e>
+  801297:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80129a:	0f b6 c9             	movzbl %cl,%ecx
+  80129d:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8012a3:	eb a1                	jmp    801246 <sys_getenvid+0xf>
+  8012a5:	89 c2                	mov    %eax,%edx
+  8012a7:	c1 ea 04             	shr    $0x4,%edx
+  8012aa:	83 e2 0f             	and    $0xf,%edx
+  8012ad:	83 fa 02             	cmp    $0x2,%edx
+  8012b0:	77 e5                	ja     801297 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  8012b2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012b5:	83 f8 02             	cmp    $0x2,%eax
+  8012b8:	0f 97 c1             	seta   %cl
+  8012bb:	0f b6 c9             	movzbl %cl,%ecx
+  8012be:	eb d7                	jmp    801297 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  8012c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012c5:	b8 02 00 00 00       	mov    $0x2,%eax
+  8012ca:	89 d1                	mov    %edx,%ecx
+  8012cc:	89 d3                	mov    %edx,%ebx
+  8012ce:	89 d7                	mov    %edx,%edi
+  8012d0:	89 d6                	mov    %edx,%esi
+  8012d2:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  8012d4:	eb 99                	jmp    80126f <sys_getenvid+0x38>
+
+008012d6 <sys_page_alloc>:
+{
+  8012d6:	55                   	push   %ebp
+  8012d7:	89 e5                	mov    %esp,%ebp
+  8012d9:	57                   	push   %edi
+  8012da:	56                   	push   %esi
+  8012db:	53                   	push   %ebx
+  8012dc:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8012df:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8012e6:	78 38                	js     801320 <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  8012e8:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8012ef:	74 7b                	je     80136c <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  8012f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012fc:	b8 04 00 00 00       	mov    $0x4,%eax
+  801301:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801304:	89 f7                	mov    %esi,%edi
+  801306:	55                   	push   %ebp
+  801307:	68 10 13 80 00       	push   $0x801310
+  80130c:	89 e5                	mov    %esp,%ebp
+  80130e:	0f 34                	sysenter
+  801310:	83 c4 04             	add    $0x4,%esp
+  801313:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801314:	85 c0                	test   %eax,%eax
+  801316:	7f 6d                	jg     801385 <sys_page_alloc+0xaf>
+}
+  801318:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80131b:	5b                   	pop    %ebx
+  80131c:	5e                   	pop    %esi
+  80131d:	5f                   	pop    %edi
+  80131e:	5d                   	pop    %ebp
+  80131f:	c3                   	ret
+  801320:	b8 01 00 00 00       	mov    $0x1,%eax
+  801325:	0f a2                	cpuid
+		return 0;
+  801327:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80132c:	f6 c6 08             	test   $0x8,%dh
+  80132f:	74 15                	je     801346 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801331:	89 c2                	mov    %eax,%edx
+  801333:	c1 ea 08             	shr    $0x8,%edx
+  801336:	83 e2 0f             	and    $0xf,%edx
+  801339:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80133e:	83 fa 06             	cmp    $0x6,%edx
+  801341:	74 0e                	je     801351 <sys_page_alloc+0x7b>
+  801343:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801346:	0f b6 c9             	movzbl %cl,%ecx
+  801349:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80134f:	eb 97                	jmp    8012e8 <sys_page_alloc+0x12>
+  801351:	89 c2                	mov    %eax,%edx
+  801353:	c1 ea 04             	shr    $0x4,%edx
+  801356:	83 e2 0f             	and    $0xf,%edx
+  801359:	83 fa 02             	cmp    $0x2,%edx
+  80135c:	77 e5                	ja     801343 <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  80135e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801361:	83 f8 02             	cmp    $0x2,%eax
+  801364:	0f 97 c1             	seta   %cl
+  801367:	0f b6 c9             	movzbl %cl,%ecx
+  80136a:	eb d7                	jmp    801343 <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  80136c:	be 00 00 00 00       	mov    $0x0,%esi
+  801371:	b8 04 00 00 00       	mov    $0x4,%eax
+  801376:	8b 55 08             	mov    0x8(%ebp),%edx
+  801379:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80137c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80137f:	89 f7                	mov    %esi,%edi
+  801381:	cd 30                	int    $0x30
+  801383:	eb 8f                	jmp    801314 <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801385:	83 ec 0c             	sub    $0xc,%esp
+  801388:	50                   	push   %eax
+  801389:	6a 04                	push   $0x4
+  80138b:	68 19 30 80 00       	push   $0x803019
+  801390:	6a 4a                	push   $0x4a
+  801392:	68 36 30 80 00       	push   $0x803036
+  801397:	e8 03 f0 ff ff       	call   80039f <_panic>
+
+0080139c <sys_page_map>:
+{
+  80139c:	55                   	push   %ebp
+  80139d:	89 e5                	mov    %esp,%ebp
+  80139f:	57                   	push   %edi
+  8013a0:	56                   	push   %esi
+  8013a1:	53                   	push   %ebx
+  8013a2:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8013a5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8013ac:	78 37                	js     8013e5 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  8013ae:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8013b5:	74 7a                	je     801431 <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  8013b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013bd:	b8 05 00 00 00       	mov    $0x5,%eax
+  8013c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013c5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013c8:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013cb:	55                   	push   %ebp
+  8013cc:	68 d5 13 80 00       	push   $0x8013d5
+  8013d1:	89 e5                	mov    %esp,%ebp
+  8013d3:	0f 34                	sysenter
+  8013d5:	83 c4 04             	add    $0x4,%esp
+  8013d8:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8013d9:	85 c0                	test   %eax,%eax
+  8013db:	7f 6c                	jg     801449 <sys_page_map+0xad>
+}
+  8013dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e0:	5b                   	pop    %ebx
+  8013e1:	5e                   	pop    %esi
+  8013e2:	5f                   	pop    %edi
+  8013e3:	5d                   	pop    %ebp
+  8013e4:	c3                   	ret
+  8013e5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013ea:	0f a2                	cpuid
+		return 0;
+  8013ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8013f1:	f6 c6 08             	test   $0x8,%dh
+  8013f4:	74 15                	je     80140b <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013f6:	89 c2                	mov    %eax,%edx
+  8013f8:	c1 ea 08             	shr    $0x8,%edx
+  8013fb:	83 e2 0f             	and    $0xf,%edx
+  8013fe:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801403:	83 fa 06             	cmp    $0x6,%edx
+  801406:	74 0e                	je     801416 <sys_page_map+0x7a>
+  801408:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80140b:	0f b6 c9             	movzbl %cl,%ecx
+  80140e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801414:	eb 98                	jmp    8013ae <sys_page_map+0x12>
+  801416:	89 c2                	mov    %eax,%edx
+  801418:	c1 ea 04             	shr    $0x4,%edx
+  80141b:	83 e2 0f             	and    $0xf,%edx
+  80141e:	83 fa 02             	cmp    $0x2,%edx
+  801421:	77 e5                	ja     801408 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  801423:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801426:	83 f8 02             	cmp    $0x2,%eax
+  801429:	0f 97 c1             	seta   %cl
+  80142c:	0f b6 c9             	movzbl %cl,%ecx
+  80142f:	eb d7                	jmp    801408 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  801431:	b8 05 00 00 00       	mov    $0x5,%eax
+  801436:	8b 55 08             	mov    0x8(%ebp),%edx
+  801439:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80143c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80143f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801442:	8b 75 18             	mov    0x18(%ebp),%esi
+  801445:	cd 30                	int    $0x30
+  801447:	eb 90                	jmp    8013d9 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801449:	83 ec 0c             	sub    $0xc,%esp
+  80144c:	50                   	push   %eax
+  80144d:	6a 05                	push   $0x5
+  80144f:	68 19 30 80 00       	push   $0x803019
+  801454:	6a 4a                	push   $0x4a
+  801456:	68 36 30 80 00       	push   $0x803036
+  80145b:	e8 3f ef ff ff       	call   80039f <_panic>
+
+00801460 <sys_page_unmap>:
+{
+  801460:	55                   	push   %ebp
+  801461:	89 e5                	mov    %esp,%ebp
+  801463:	57                   	push   %edi
+  801464:	56                   	push   %esi
+  801465:	53                   	push   %ebx
+  801466:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801469:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801470:	78 37                	js     8014a9 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  801472:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801479:	74 7a                	je     8014f5 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  80147b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801480:	8b 55 08             	mov    0x8(%ebp),%edx
+  801483:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801486:	b8 06 00 00 00       	mov    $0x6,%eax
+  80148b:	89 df                	mov    %ebx,%edi
+  80148d:	89 de                	mov    %ebx,%esi
+  80148f:	55                   	push   %ebp
+  801490:	68 99 14 80 00       	push   $0x801499
+  801495:	89 e5                	mov    %esp,%ebp
+  801497:	0f 34                	sysenter
+  801499:	83 c4 04             	add    $0x4,%esp
+  80149c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80149d:	85 c0                	test   %eax,%eax
+  80149f:	7f 6c                	jg     80150d <sys_page_unmap+0xad>
+}
+  8014a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014a4:	5b                   	pop    %ebx
+  8014a5:	5e                   	pop    %esi
+  8014a6:	5f                   	pop    %edi
+  8014a7:	5d                   	pop    %ebp
+  8014a8:	c3                   	ret
+  8014a9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014ae:	0f a2                	cpuid
+		return 0;
+  8014b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8014b5:	f6 c6 08             	test   $0x8,%dh
+  8014b8:	74 15                	je     8014cf <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014ba:	89 c2                	mov    %eax,%edx
+  8014bc:	c1 ea 08             	shr    $0x8,%edx
+  8014bf:	83 e2 0f             	and    $0xf,%edx
+  8014c2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8014c7:	83 fa 06             	cmp    $0x6,%edx
+  8014ca:	74 0e                	je     8014da <sys_page_unmap+0x7a>
+  8014cc:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8014cf:	0f b6 c9             	movzbl %cl,%ecx
+  8014d2:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8014d8:	eb 98                	jmp    801472 <sys_page_unmap+0x12>
+  8014da:	89 c2                	mov    %eax,%edx
+  8014dc:	c1 ea 04             	shr    $0x4,%edx
+  8014df:	83 e2 0f             	and    $0xf,%edx
+  8014e2:	83 fa 02             	cmp    $0x2,%edx
+  8014e5:	77 e5                	ja     8014cc <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  8014e7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014ea:	83 f8 02             	cmp    $0x2,%eax
+  8014ed:	0f 97 c1             	seta   %cl
+  8014f0:	0f b6 c9             	movzbl %cl,%ecx
+  8014f3:	eb d7                	jmp    8014cc <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  8014f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014fa:	b8 06 00 00 00       	mov    $0x6,%eax
+  8014ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801502:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801505:	89 df                	mov    %ebx,%edi
+  801507:	89 de                	mov    %ebx,%esi
+  801509:	cd 30                	int    $0x30
+  80150b:	eb 90                	jmp    80149d <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80150d:	83 ec 0c             	sub    $0xc,%esp
+  801510:	50                   	push   %eax
+  801511:	6a 06                	push   $0x6
+  801513:	68 19 30 80 00       	push   $0x803019
+  801518:	6a 4a                	push   $0x4a
+  80151a:	68 36 30 80 00       	push   $0x803036
+  80151f:	e8 7b ee ff ff       	call   80039f <_panic>
+
+00801524 <sys_page_copy>:
+{
+  801524:	55                   	push   %ebp
+  801525:	89 e5                	mov    %esp,%ebp
+  801527:	57                   	push   %edi
+  801528:	56                   	push   %esi
+  801529:	53                   	push   %ebx
+  80152a:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80152d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801534:	78 37                	js     80156d <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  801536:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80153d:	74 7a                	je     8015b9 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  80153f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801542:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801545:	b8 29 00 00 00       	mov    $0x29,%eax
+  80154a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80154d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801550:	8b 75 18             	mov    0x18(%ebp),%esi
+  801553:	55                   	push   %ebp
+  801554:	68 5d 15 80 00       	push   $0x80155d
+  801559:	89 e5                	mov    %esp,%ebp
+  80155b:	0f 34                	sysenter
+  80155d:	83 c4 04             	add    $0x4,%esp
+  801560:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801561:	85 c0                	test   %eax,%eax
+  801563:	7f 6c                	jg     8015d1 <sys_page_copy+0xad>
+}
+  801565:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801568:	5b                   	pop    %ebx
+  801569:	5e                   	pop    %esi
+  80156a:	5f                   	pop    %edi
+  80156b:	5d                   	pop    %ebp
+  80156c:	c3                   	ret
+  80156d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801572:	0f a2                	cpuid
+		return 0;
+  801574:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801579:	f6 c6 08             	test   $0x8,%dh
+  80157c:	74 15                	je     801593 <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80157e:	89 c2                	mov    %eax,%edx
+  801580:	c1 ea 08             	shr    $0x8,%edx
+  801583:	83 e2 0f             	and    $0xf,%edx
+  801586:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80158b:	83 fa 06             	cmp    $0x6,%edx
+  80158e:	74 0e                	je     80159e <sys_page_copy+0x7a>
+  801590:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801593:	0f b6 c9             	movzbl %cl,%ecx
+  801596:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80159c:	eb 98                	jmp    801536 <sys_page_copy+0x12>
+  80159e:	89 c2                	mov    %eax,%edx
+  8015a0:	c1 ea 04             	shr    $0x4,%edx
+  8015a3:	83 e2 0f             	and    $0xf,%edx
+  8015a6:	83 fa 02             	cmp    $0x2,%edx
+  8015a9:	77 e5                	ja     801590 <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  8015ab:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015ae:	83 f8 02             	cmp    $0x2,%eax
+  8015b1:	0f 97 c1             	seta   %cl
+  8015b4:	0f b6 c9             	movzbl %cl,%ecx
+  8015b7:	eb d7                	jmp    801590 <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  8015b9:	b8 29 00 00 00       	mov    $0x29,%eax
+  8015be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015c4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015c7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8015ca:	8b 75 18             	mov    0x18(%ebp),%esi
+  8015cd:	cd 30                	int    $0x30
+  8015cf:	eb 90                	jmp    801561 <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015d1:	83 ec 0c             	sub    $0xc,%esp
+  8015d4:	50                   	push   %eax
+  8015d5:	6a 29                	push   $0x29
+  8015d7:	68 19 30 80 00       	push   $0x803019
+  8015dc:	6a 4a                	push   $0x4a
+  8015de:	68 36 30 80 00       	push   $0x803036
+  8015e3:	e8 b7 ed ff ff       	call   80039f <_panic>
+
+008015e8 <sys_yield>:
+{
+  8015e8:	55                   	push   %ebp
+  8015e9:	89 e5                	mov    %esp,%ebp
+  8015eb:	57                   	push   %edi
+  8015ec:	56                   	push   %esi
+  8015ed:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8015ee:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8015f5:	78 2e                	js     801625 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  8015f7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8015fe:	74 71                	je     801671 <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  801600:	ba 00 00 00 00       	mov    $0x0,%edx
+  801605:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80160a:	89 d1                	mov    %edx,%ecx
+  80160c:	89 d3                	mov    %edx,%ebx
+  80160e:	89 d7                	mov    %edx,%edi
+  801610:	89 d6                	mov    %edx,%esi
+  801612:	55                   	push   %ebp
+  801613:	68 1c 16 80 00       	push   $0x80161c
+  801618:	89 e5                	mov    %esp,%ebp
+  80161a:	0f 34                	sysenter
+  80161c:	83 c4 04             	add    $0x4,%esp
+  80161f:	5d                   	pop    %ebp
+}
+  801620:	5b                   	pop    %ebx
+  801621:	5e                   	pop    %esi
+  801622:	5f                   	pop    %edi
+  801623:	5d                   	pop    %ebp
+  801624:	c3                   	ret
+  801625:	b8 01 00 00 00       	mov    $0x1,%eax
+  80162a:	0f a2                	cpuid
+		return 0;
+  80162c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801631:	f6 c6 08             	test   $0x8,%dh
+  801634:	74 15                	je     80164b <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801636:	89 c2                	mov    %eax,%edx
+  801638:	c1 ea 08             	shr    $0x8,%edx
+  80163b:	83 e2 0f             	and    $0xf,%edx
+  80163e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801643:	83 fa 06             	cmp    $0x6,%edx
+  801646:	74 0e                	je     801656 <sys_yield+0x6e>
+  801648:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80164b:	0f b6 c9             	movzbl %cl,%ecx
+  80164e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801654:	eb a1                	jmp    8015f7 <sys_yield+0xf>
+  801656:	89 c2                	mov    %eax,%edx
+  801658:	c1 ea 04             	shr    $0x4,%edx
+  80165b:	83 e2 0f             	and    $0xf,%edx
+  80165e:	83 fa 02             	cmp    $0x2,%edx
+  801661:	77 e5                	ja     801648 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  801663:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801666:	83 f8 02             	cmp    $0x2,%eax
+  801669:	0f 97 c1             	seta   %cl
+  80166c:	0f b6 c9             	movzbl %cl,%ecx
+  80166f:	eb d7                	jmp    801648 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  801671:	ba 00 00 00 00       	mov    $0x0,%edx
+  801676:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80167b:	89 d1                	mov    %edx,%ecx
+  80167d:	89 d3                	mov    %edx,%ebx
+  80167f:	89 d7                	mov    %edx,%edi
+  801681:	89 d6                	mov    %edx,%esi
+  801683:	cd 30                	int    $0x30
+}
+  801685:	eb 99                	jmp    801620 <sys_yield+0x38>
+
+00801687 <sys_env_set_status>:
+{
+  801687:	55                   	push   %ebp
+  801688:	89 e5                	mov    %esp,%ebp
+  80168a:	57                   	push   %edi
+  80168b:	56                   	push   %esi
+  80168c:	53                   	push   %ebx
+  80168d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801690:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801697:	78 37                	js     8016d0 <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  801699:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8016a0:	74 7a                	je     80171c <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  8016a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016ad:	b8 08 00 00 00       	mov    $0x8,%eax
+  8016b2:	89 df                	mov    %ebx,%edi
+  8016b4:	89 de                	mov    %ebx,%esi
+  8016b6:	55                   	push   %ebp
+  8016b7:	68 c0 16 80 00       	push   $0x8016c0
+  8016bc:	89 e5                	mov    %esp,%ebp
+  8016be:	0f 34                	sysenter
+  8016c0:	83 c4 04             	add    $0x4,%esp
+  8016c3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8016c4:	85 c0                	test   %eax,%eax
+  8016c6:	7f 6c                	jg     801734 <sys_env_set_status+0xad>
+}
+  8016c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016cb:	5b                   	pop    %ebx
+  8016cc:	5e                   	pop    %esi
+  8016cd:	5f                   	pop    %edi
+  8016ce:	5d                   	pop    %ebp
+  8016cf:	c3                   	ret
+  8016d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016d5:	0f a2                	cpuid
+		return 0;
+  8016d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8016dc:	f6 c6 08             	test   $0x8,%dh
+  8016df:	74 15                	je     8016f6 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016e1:	89 c2                	mov    %eax,%edx
+  8016e3:	c1 ea 08             	shr    $0x8,%edx
+  8016e6:	83 e2 0f             	and    $0xf,%edx
+  8016e9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8016ee:	83 fa 06             	cmp    $0x6,%edx
+  8016f1:	74 0e                	je     801701 <sys_env_set_status+0x7a>
+  8016f3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8016f6:	0f b6 c9             	movzbl %cl,%ecx
+  8016f9:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8016ff:	eb 98                	jmp    801699 <sys_env_set_status+0x12>
+  801701:	89 c2                	mov    %eax,%edx
+  801703:	c1 ea 04             	shr    $0x4,%edx
+  801706:	83 e2 0f             	and    $0xf,%edx
+  801709:	83 fa 02             	cmp    $0x2,%edx
+  80170c:	77 e5                	ja     8016f3 <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  80170e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801711:	83 f8 02             	cmp    $0x2,%eax
+  801714:	0f 97 c1             	seta   %cl
+  801717:	0f b6 c9             	movzbl %cl,%ecx
+  80171a:	eb d7                	jmp    8016f3 <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  80171c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801721:	b8 08 00 00 00       	mov    $0x8,%eax
+  801726:	8b 55 08             	mov    0x8(%ebp),%edx
+  801729:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80172c:	89 df                	mov    %ebx,%edi
+  80172e:	89 de                	mov    %ebx,%esi
+  801730:	cd 30                	int    $0x30
+  801732:	eb 90                	jmp    8016c4 <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801734:	83 ec 0c             	sub    $0xc,%esp
+  801737:	50                   	push   %eax
+  801738:	6a 08                	push   $0x8
+  80173a:	68 19 30 80 00       	push   $0x803019
+  80173f:	6a 4a                	push   $0x4a
+  801741:	68 36 30 80 00       	push   $0x803036
+  801746:	e8 54 ec ff ff       	call   80039f <_panic>
+
+0080174b <sys_sysinfo>:
+{
+  80174b:	55                   	push   %ebp
+  80174c:	89 e5                	mov    %esp,%ebp
+  80174e:	57                   	push   %edi
+  80174f:	56                   	push   %esi
+  801750:	53                   	push   %ebx
+  801751:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801754:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80175b:	78 36                	js     801793 <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  80175d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801764:	74 79                	je     8017df <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  801766:	8b 55 08             	mov    0x8(%ebp),%edx
+  801769:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80176e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801773:	89 cb                	mov    %ecx,%ebx
+  801775:	89 cf                	mov    %ecx,%edi
+  801777:	89 ce                	mov    %ecx,%esi
+  801779:	55                   	push   %ebp
+  80177a:	68 83 17 80 00       	push   $0x801783
+  80177f:	89 e5                	mov    %esp,%ebp
+  801781:	0f 34                	sysenter
+  801783:	83 c4 04             	add    $0x4,%esp
+  801786:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801787:	85 c0                	test   %eax,%eax
+  801789:	7f 6b                	jg     8017f6 <sys_sysinfo+0xab>
+}
+  80178b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80178e:	5b                   	pop    %ebx
+  80178f:	5e                   	pop    %esi
+  801790:	5f                   	pop    %edi
+  801791:	5d                   	pop    %ebp
+  801792:	c3                   	ret
+  801793:	b8 01 00 00 00       	mov    $0x1,%eax
+  801798:	0f a2                	cpuid
+		return 0;
+  80179a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80179f:	f6 c6 08             	test   $0x8,%dh
+  8017a2:	74 15                	je     8017b9 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017a4:	89 c2                	mov    %eax,%edx
+  8017a6:	c1 ea 08             	shr    $0x8,%edx
+  8017a9:	83 e2 0f             	and    $0xf,%edx
+  8017ac:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017b1:	83 fa 06             	cmp    $0x6,%edx
+  8017b4:	74 0e                	je     8017c4 <sys_sysinfo+0x79>
+  8017b6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8017b9:	0f b6 c9             	movzbl %cl,%ecx
+  8017bc:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8017c2:	eb 99                	jmp    80175d <sys_sysinfo+0x12>
+  8017c4:	89 c2                	mov    %eax,%edx
+  8017c6:	c1 ea 04             	shr    $0x4,%edx
+  8017c9:	83 e2 0f             	and    $0xf,%edx
+  8017cc:	83 fa 02             	cmp    $0x2,%edx
+  8017cf:	77 e5                	ja     8017b6 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  8017d1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017d4:	83 f8 02             	cmp    $0x2,%eax
+  8017d7:	0f 97 c1             	seta   %cl
+  8017da:	0f b6 c9             	movzbl %cl,%ecx
+  8017dd:	eb d7                	jmp    8017b6 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  8017df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017e4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8017e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017ec:	89 cb                	mov    %ecx,%ebx
+  8017ee:	89 cf                	mov    %ecx,%edi
+  8017f0:	89 ce                	mov    %ecx,%esi
+  8017f2:	cd 30                	int    $0x30
+  8017f4:	eb 91                	jmp    801787 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017f6:	83 ec 0c             	sub    $0xc,%esp
+  8017f9:	50                   	push   %eax
+  8017fa:	6a 0b                	push   $0xb
+  8017fc:	68 19 30 80 00       	push   $0x803019
+  801801:	6a 4a                	push   $0x4a
+  801803:	68 36 30 80 00       	push   $0x803036
+  801808:	e8 92 eb ff ff       	call   80039f <_panic>
+
+0080180d <sys_env_set_trapframe>:
+{
+  80180d:	55                   	push   %ebp
+  80180e:	89 e5                	mov    %esp,%ebp
+  801810:	57                   	push   %edi
+  801811:	56                   	push   %esi
+  801812:	53                   	push   %ebx
+  801813:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801816:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80181d:	78 37                	js     801856 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  80181f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801826:	74 7a                	je     8018a2 <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  801828:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80182d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801830:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801833:	b8 13 00 00 00       	mov    $0x13,%eax
+  801838:	89 df                	mov    %ebx,%edi
+  80183a:	89 de                	mov    %ebx,%esi
+  80183c:	55                   	push   %ebp
+  80183d:	68 46 18 80 00       	push   $0x801846
+  801842:	89 e5                	mov    %esp,%ebp
+  801844:	0f 34                	sysenter
+  801846:	83 c4 04             	add    $0x4,%esp
+  801849:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80184a:	85 c0                	test   %eax,%eax
+  80184c:	7f 6c                	jg     8018ba <sys_env_set_trapframe+0xad>
+}
+  80184e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801851:	5b                   	pop    %ebx
+  801852:	5e                   	pop    %esi
+  801853:	5f                   	pop    %edi
+  801854:	5d                   	pop    %ebp
+  801855:	c3                   	ret
+  801856:	b8 01 00 00 00       	mov    $0x1,%eax
+  80185b:	0f a2                	cpuid
+		return 0;
+  80185d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801862:	f6 c6 08             	test   $0x8,%dh
+  801865:	74 15                	je     80187c <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801867:	89 c2                	mov    %eax,%edx
+  801869:	c1 ea 08             	shr    $0x8,%edx
+  80186c:	83 e2 0f             	and    $0xf,%edx
+  80186f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801874:	83 fa 06             	cmp    $0x6,%edx
+  801877:	74 0e                	je     801887 <sys_env_set_trapframe+0x7a>
+  801879:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80187c:	0f b6 c9             	movzbl %cl,%ecx
+  80187f:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801885:	eb 98                	jmp    80181f <sys_env_set_trapframe+0x12>
+  801887:	89 c2                	mov    %eax,%edx
+  801889:	c1 ea 04             	shr    $0x4,%edx
+  80188c:	83 e2 0f             	and    $0xf,%edx
+  80188f:	83 fa 02             	cmp    $0x2,%edx
+  801892:	77 e5                	ja     801879 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  801894:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801897:	83 f8 02             	cmp    $0x2,%eax
+  80189a:	0f 97 c1             	seta   %cl
+  80189d:	0f b6 c9             	movzbl %cl,%ecx
+  8018a0:	eb d7                	jmp    801879 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  8018a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018a7:	b8 13 00 00 00       	mov    $0x13,%eax
+  8018ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018b2:	89 df                	mov    %ebx,%edi
+  8018b4:	89 de                	mov    %ebx,%esi
+  8018b6:	cd 30                	int    $0x30
+  8018b8:	eb 90                	jmp    80184a <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8018ba:	83 ec 0c             	sub    $0xc,%esp
+  8018bd:	50                   	push   %eax
+  8018be:	6a 13                	push   $0x13
+  8018c0:	68 19 30 80 00       	push   $0x803019
+  8018c5:	6a 4a                	push   $0x4a
+  8018c7:	68 36 30 80 00       	push   $0x803036
+  8018cc:	e8 ce ea ff ff       	call   80039f <_panic>
+
+008018d1 <sys_env_set_stack_limit>:
+{
+  8018d1:	55                   	push   %ebp
+  8018d2:	89 e5                	mov    %esp,%ebp
+  8018d4:	57                   	push   %edi
+  8018d5:	56                   	push   %esi
+  8018d6:	53                   	push   %ebx
+  8018d7:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8018da:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8018e1:	78 37                	js     80191a <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  8018e3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8018ea:	74 7a                	je     801966 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  8018ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018f7:	b8 19 00 00 00       	mov    $0x19,%eax
+  8018fc:	89 df                	mov    %ebx,%edi
+  8018fe:	89 de                	mov    %ebx,%esi
+  801900:	55                   	push   %ebp
+  801901:	68 0a 19 80 00       	push   $0x80190a
+  801906:	89 e5                	mov    %esp,%ebp
+  801908:	0f 34                	sysenter
+  80190a:	83 c4 04             	add    $0x4,%esp
+  80190d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80190e:	85 c0                	test   %eax,%eax
+  801910:	7f 6c                	jg     80197e <sys_env_set_stack_limit+0xad>
+}
+  801912:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801915:	5b                   	pop    %ebx
+  801916:	5e                   	pop    %esi
+  801917:	5f                   	pop    %edi
+  801918:	5d                   	pop    %ebp
+  801919:	c3                   	ret
+  80191a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80191f:	0f a2                	cpuid
+		return 0;
+  801921:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801926:	f6 c6 08             	test   $0x8,%dh
+  801929:	74 15                	je     801940 <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80192b:	89 c2                	mov    %eax,%edx
+  80192d:	c1 ea 08             	shr    $0x8,%edx
+  801930:	83 e2 0f             	and    $0xf,%edx
+  801933:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801938:	83 fa 06             	cmp    $0x6,%edx
+  80193b:	74 0e                	je     80194b <sys_env_set_stack_limit+0x7a>
+  80193d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801940:	0f b6 c9             	movzbl %cl,%ecx
+  801943:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801949:	eb 98                	jmp    8018e3 <sys_env_set_stack_limit+0x12>
+  80194b:	89 c2                	mov    %eax,%edx
+  80194d:	c1 ea 04             	shr    $0x4,%edx
+  801950:	83 e2 0f             	and    $0xf,%edx
+  801953:	83 fa 02             	cmp    $0x2,%edx
+  801956:	77 e5                	ja     80193d <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  801958:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80195b:	83 f8 02             	cmp    $0x2,%eax
+  80195e:	0f 97 c1             	seta   %cl
+  801961:	0f b6 c9             	movzbl %cl,%ecx
+  801964:	eb d7                	jmp    80193d <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  801966:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80196b:	b8 19 00 00 00       	mov    $0x19,%eax
+  801970:	8b 55 08             	mov    0x8(%ebp),%edx
+  801973:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801976:	89 df                	mov    %ebx,%edi
+  801978:	89 de                	mov    %ebx,%esi
+  80197a:	cd 30                	int    $0x30
+  80197c:	eb 90                	jmp    80190e <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80197e:	83 ec 0c             	sub    $0xc,%esp
+  801981:	50                   	push   %eax
+  801982:	6a 19                	push   $0x19
+  801984:	68 19 30 80 00       	push   $0x803019
+  801989:	6a 4a                	push   $0x4a
+  80198b:	68 36 30 80 00       	push   $0x803036
+  801990:	e8 0a ea ff ff       	call   80039f <_panic>
+
+00801995 <sys_env_set_pgfault_upcall>:
+{
+  801995:	55                   	push   %ebp
+  801996:	89 e5                	mov    %esp,%ebp
+  801998:	57                   	push   %edi
+  801999:	56                   	push   %esi
+  80199a:	53                   	push   %ebx
+  80199b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80199e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8019a5:	78 37                	js     8019de <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  8019a7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8019ae:	74 7a                	je     801a2a <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  8019b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019bb:	b8 09 00 00 00       	mov    $0x9,%eax
+  8019c0:	89 df                	mov    %ebx,%edi
+  8019c2:	89 de                	mov    %ebx,%esi
+  8019c4:	55                   	push   %ebp
+  8019c5:	68 ce 19 80 00       	push   $0x8019ce
+  8019ca:	89 e5                	mov    %esp,%ebp
+  8019cc:	0f 34                	sysenter
+  8019ce:	83 c4 04             	add    $0x4,%esp
+  8019d1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8019d2:	85 c0                	test   %eax,%eax
+  8019d4:	7f 6c                	jg     801a42 <sys_env_set_pgfault_upcall+0xad>
+}
+  8019d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019d9:	5b                   	pop    %ebx
+  8019da:	5e                   	pop    %esi
+  8019db:	5f                   	pop    %edi
+  8019dc:	5d                   	pop    %ebp
+  8019dd:	c3                   	ret
+  8019de:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019e3:	0f a2                	cpuid
+		return 0;
+  8019e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8019ea:	f6 c6 08             	test   $0x8,%dh
+  8019ed:	74 15                	je     801a04 <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019ef:	89 c2                	mov    %eax,%edx
+  8019f1:	c1 ea 08             	shr    $0x8,%edx
+  8019f4:	83 e2 0f             	and    $0xf,%edx
+  8019f7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019fc:	83 fa 06             	cmp    $0x6,%edx
+  8019ff:	74 0e                	je     801a0f <sys_env_set_pgfault_upcall+0x7a>
+  801a01:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a04:	0f b6 c9             	movzbl %cl,%ecx
+  801a07:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801a0d:	eb 98                	jmp    8019a7 <sys_env_set_pgfault_upcall+0x12>
+  801a0f:	89 c2                	mov    %eax,%edx
+  801a11:	c1 ea 04             	shr    $0x4,%edx
+  801a14:	83 e2 0f             	and    $0xf,%edx
+  801a17:	83 fa 02             	cmp    $0x2,%edx
+  801a1a:	77 e5                	ja     801a01 <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  801a1c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a1f:	83 f8 02             	cmp    $0x2,%eax
+  801a22:	0f 97 c1             	seta   %cl
+  801a25:	0f b6 c9             	movzbl %cl,%ecx
+  801a28:	eb d7                	jmp    801a01 <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  801a2a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a2f:	b8 09 00 00 00       	mov    $0x9,%eax
+  801a34:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a3a:	89 df                	mov    %ebx,%edi
+  801a3c:	89 de                	mov    %ebx,%esi
+  801a3e:	cd 30                	int    $0x30
+  801a40:	eb 90                	jmp    8019d2 <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a42:	83 ec 0c             	sub    $0xc,%esp
+  801a45:	50                   	push   %eax
+  801a46:	6a 09                	push   $0x9
+  801a48:	68 19 30 80 00       	push   $0x803019
+  801a4d:	6a 4a                	push   $0x4a
+  801a4f:	68 36 30 80 00       	push   $0x803036
+  801a54:	e8 46 e9 ff ff       	call   80039f <_panic>
+
+00801a59 <sys_ipc_try_send>:
+{
+  801a59:	55                   	push   %ebp
+  801a5a:	89 e5                	mov    %esp,%ebp
+  801a5c:	57                   	push   %edi
+  801a5d:	56                   	push   %esi
+  801a5e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801a5f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a66:	78 32                	js     801a9a <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  801a68:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a6f:	74 75                	je     801ae6 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801a71:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a74:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a77:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801a7c:	be 00 00 00 00       	mov    $0x0,%esi
+  801a81:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a84:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a87:	55                   	push   %ebp
+  801a88:	68 91 1a 80 00       	push   $0x801a91
+  801a8d:	89 e5                	mov    %esp,%ebp
+  801a8f:	0f 34                	sysenter
+  801a91:	83 c4 04             	add    $0x4,%esp
+  801a94:	5d                   	pop    %ebp
+}
+  801a95:	5b                   	pop    %ebx
+  801a96:	5e                   	pop    %esi
+  801a97:	5f                   	pop    %edi
+  801a98:	5d                   	pop    %ebp
+  801a99:	c3                   	ret
+  801a9a:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a9f:	0f a2                	cpuid
+		return 0;
+  801aa1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801aa6:	f6 c6 08             	test   $0x8,%dh
+  801aa9:	74 15                	je     801ac0 <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801aab:	89 c2                	mov    %eax,%edx
+  801aad:	c1 ea 08             	shr    $0x8,%edx
+  801ab0:	83 e2 0f             	and    $0xf,%edx
+  801ab3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ab8:	83 fa 06             	cmp    $0x6,%edx
+  801abb:	74 0e                	je     801acb <sys_ipc_try_send+0x72>
+  801abd:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801ac0:	0f b6 c9             	movzbl %cl,%ecx
+  801ac3:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801ac9:	eb 9d                	jmp    801a68 <sys_ipc_try_send+0xf>
+  801acb:	89 c2                	mov    %eax,%edx
+  801acd:	c1 ea 04             	shr    $0x4,%edx
+  801ad0:	83 e2 0f             	and    $0xf,%edx
+  801ad3:	83 fa 02             	cmp    $0x2,%edx
+  801ad6:	77 e5                	ja     801abd <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  801ad8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801adb:	83 f8 02             	cmp    $0x2,%eax
+  801ade:	0f 97 c1             	seta   %cl
+  801ae1:	0f b6 c9             	movzbl %cl,%ecx
+  801ae4:	eb d7                	jmp    801abd <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  801ae6:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801aeb:	be 00 00 00 00       	mov    $0x0,%esi
+  801af0:	8b 55 08             	mov    0x8(%ebp),%edx
+  801af3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801af6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801af9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801afc:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801afe:	eb 95                	jmp    801a95 <sys_ipc_try_send+0x3c>
+
+00801b00 <sys_ipc_send>:
+{
+  801b00:	55                   	push   %ebp
+  801b01:	89 e5                	mov    %esp,%ebp
+  801b03:	57                   	push   %edi
+  801b04:	56                   	push   %esi
+  801b05:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801b06:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b0d:	78 32                	js     801b41 <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  801b0f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b16:	74 75                	je     801b8d <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801b18:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b1b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b1e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801b23:	be 00 00 00 00       	mov    $0x0,%esi
+  801b28:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b2b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801b2e:	55                   	push   %ebp
+  801b2f:	68 38 1b 80 00       	push   $0x801b38
+  801b34:	89 e5                	mov    %esp,%ebp
+  801b36:	0f 34                	sysenter
+  801b38:	83 c4 04             	add    $0x4,%esp
+  801b3b:	5d                   	pop    %ebp
+}
+  801b3c:	5b                   	pop    %ebx
+  801b3d:	5e                   	pop    %esi
+  801b3e:	5f                   	pop    %edi
+  801b3f:	5d                   	pop    %ebp
+  801b40:	c3                   	ret
+  801b41:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b46:	0f a2                	cpuid
+		return 0;
+  801b48:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b4d:	f6 c6 08             	test   $0x8,%dh
+  801b50:	74 15                	je     801b67 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b52:	89 c2                	mov    %eax,%edx
+  801b54:	c1 ea 08             	shr    $0x8,%edx
+  801b57:	83 e2 0f             	and    $0xf,%edx
+  801b5a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b5f:	83 fa 06             	cmp    $0x6,%edx
+  801b62:	74 0e                	je     801b72 <sys_ipc_send+0x72>
+  801b64:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b67:	0f b6 c9             	movzbl %cl,%ecx
+  801b6a:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801b70:	eb 9d                	jmp    801b0f <sys_ipc_send+0xf>
+  801b72:	89 c2                	mov    %eax,%edx
+  801b74:	c1 ea 04             	shr    $0x4,%edx
+  801b77:	83 e2 0f             	and    $0xf,%edx
+  801b7a:	83 fa 02             	cmp    $0x2,%edx
+  801b7d:	77 e5                	ja     801b64 <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  801b7f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b82:	83 f8 02             	cmp    $0x2,%eax
+  801b85:	0f 97 c1             	seta   %cl
+  801b88:	0f b6 c9             	movzbl %cl,%ecx
+  801b8b:	eb d7                	jmp    801b64 <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  801b8d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801b92:	be 00 00 00 00       	mov    $0x0,%esi
+  801b97:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b9a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b9d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ba0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ba3:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801ba5:	eb 95                	jmp    801b3c <sys_ipc_send+0x3c>
+
+00801ba7 <sys_ipc_recv>:
+{
+  801ba7:	55                   	push   %ebp
+  801ba8:	89 e5                	mov    %esp,%ebp
+  801baa:	57                   	push   %edi
+  801bab:	56                   	push   %esi
+  801bac:	53                   	push   %ebx
+  801bad:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801bb0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801bb7:	78 36                	js     801bef <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  801bb9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801bc0:	74 79                	je     801c3b <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  801bc2:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bc5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bca:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801bcf:	89 cb                	mov    %ecx,%ebx
+  801bd1:	89 cf                	mov    %ecx,%edi
+  801bd3:	89 ce                	mov    %ecx,%esi
+  801bd5:	55                   	push   %ebp
+  801bd6:	68 df 1b 80 00       	push   $0x801bdf
+  801bdb:	89 e5                	mov    %esp,%ebp
+  801bdd:	0f 34                	sysenter
+  801bdf:	83 c4 04             	add    $0x4,%esp
+  801be2:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801be3:	85 c0                	test   %eax,%eax
+  801be5:	7f 6b                	jg     801c52 <sys_ipc_recv+0xab>
+}
+  801be7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bea:	5b                   	pop    %ebx
+  801beb:	5e                   	pop    %esi
+  801bec:	5f                   	pop    %edi
+  801bed:	5d                   	pop    %ebp
+  801bee:	c3                   	ret
+  801bef:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bf4:	0f a2                	cpuid
+		return 0;
+  801bf6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801bfb:	f6 c6 08             	test   $0x8,%dh
+  801bfe:	74 15                	je     801c15 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c00:	89 c2                	mov    %eax,%edx
+  801c02:	c1 ea 08             	shr    $0x8,%edx
+  801c05:	83 e2 0f             	and    $0xf,%edx
+  801c08:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801c0d:	83 fa 06             	cmp    $0x6,%edx
+  801c10:	74 0e                	je     801c20 <sys_ipc_recv+0x79>
+  801c12:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801c15:	0f b6 c9             	movzbl %cl,%ecx
+  801c18:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801c1e:	eb 99                	jmp    801bb9 <sys_ipc_recv+0x12>
+  801c20:	89 c2                	mov    %eax,%edx
+  801c22:	c1 ea 04             	shr    $0x4,%edx
+  801c25:	83 e2 0f             	and    $0xf,%edx
+  801c28:	83 fa 02             	cmp    $0x2,%edx
+  801c2b:	77 e5                	ja     801c12 <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  801c2d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c30:	83 f8 02             	cmp    $0x2,%eax
+  801c33:	0f 97 c1             	seta   %cl
+  801c36:	0f b6 c9             	movzbl %cl,%ecx
+  801c39:	eb d7                	jmp    801c12 <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  801c3b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c40:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801c45:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c48:	89 cb                	mov    %ecx,%ebx
+  801c4a:	89 cf                	mov    %ecx,%edi
+  801c4c:	89 ce                	mov    %ecx,%esi
+  801c4e:	cd 30                	int    $0x30
+  801c50:	eb 91                	jmp    801be3 <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801c52:	83 ec 0c             	sub    $0xc,%esp
+  801c55:	50                   	push   %eax
+  801c56:	6a 0d                	push   $0xd
+  801c58:	68 19 30 80 00       	push   $0x803019
+  801c5d:	6a 4a                	push   $0x4a
+  801c5f:	68 36 30 80 00       	push   $0x803036
+  801c64:	e8 36 e7 ff ff       	call   80039f <_panic>
+
+00801c69 <sys_ipc_send_range>:
+{
+  801c69:	55                   	push   %ebp
+  801c6a:	89 e5                	mov    %esp,%ebp
+  801c6c:	57                   	push   %edi
+  801c6d:	56                   	push   %esi
+  801c6e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801c6f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801c76:	78 30                	js     801ca8 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  801c78:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801c7f:	74 73                	je     801cf4 <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801c81:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c84:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c87:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801c8c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801c8f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801c92:	8b 75 18             	mov    0x18(%ebp),%esi
+  801c95:	55                   	push   %ebp
+  801c96:	68 9f 1c 80 00       	push   $0x801c9f
+  801c9b:	89 e5                	mov    %esp,%ebp
+  801c9d:	0f 34                	sysenter
+  801c9f:	83 c4 04             	add    $0x4,%esp
+  801ca2:	5d                   	pop    %ebp
+}
+  801ca3:	5b                   	pop    %ebx
+  801ca4:	5e                   	pop    %esi
+  801ca5:	5f                   	pop    %edi
+  801ca6:	5d                   	pop    %ebp
+  801ca7:	c3                   	ret
+  801ca8:	b8 01 00 00 00       	mov    $0x1,%eax
+  801cad:	0f a2                	cpuid
+		return 0;
+  801caf:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801cb4:	f6 c6 08             	test   $0x8,%dh
+  801cb7:	74 15                	je     801cce <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801cb9:	89 c2                	mov    %eax,%edx
+  801cbb:	c1 ea 08             	shr    $0x8,%edx
+  801cbe:	83 e2 0f             	and    $0xf,%edx
+  801cc1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801cc6:	83 fa 06             	cmp    $0x6,%edx
+  801cc9:	74 0e                	je     801cd9 <sys_ipc_send_range+0x70>
+  801ccb:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801cce:	0f b6 c9             	movzbl %cl,%ecx
+  801cd1:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801cd7:	eb 9f                	jmp    801c78 <sys_ipc_send_range+0xf>
+  801cd9:	89 c2                	mov    %eax,%edx
+  801cdb:	c1 ea 04             	shr    $0x4,%edx
+  801cde:	83 e2 0f             	and    $0xf,%edx
+  801ce1:	83 fa 02             	cmp    $0x2,%edx
+  801ce4:	77 e5                	ja     801ccb <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  801ce6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ce9:	83 f8 02             	cmp    $0x2,%eax
+  801cec:	0f 97 c1             	seta   %cl
+  801cef:	0f b6 c9             	movzbl %cl,%ecx
+  801cf2:	eb d7                	jmp    801ccb <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  801cf4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801cf9:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cfc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d02:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801d05:	8b 75 18             	mov    0x18(%ebp),%esi
+  801d08:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  801d0a:	eb 97                	jmp    801ca3 <sys_ipc_send_range+0x3a>
+
+00801d0c <sys_ipc_recv_range>:
+{
+  801d0c:	55                   	push   %ebp
+  801d0d:	89 e5                	mov    %esp,%ebp
+  801d0f:	57                   	push   %edi
+  801d10:	56                   	push   %esi
+  801d11:	53                   	push   %ebx
+  801d12:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801d15:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801d1c:	78 37                	js     801d55 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  801d1e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801d25:	74 7a                	je     801da1 <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  801d27:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d32:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801d37:	89 df                	mov    %ebx,%edi
+  801d39:	89 de                	mov    %ebx,%esi
+  801d3b:	55                   	push   %ebp
+  801d3c:	68 45 1d 80 00       	push   $0x801d45
+  801d41:	89 e5                	mov    %esp,%ebp
+  801d43:	0f 34                	sysenter
+  801d45:	83 c4 04             	add    $0x4,%esp
+  801d48:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801d49:	85 c0                	test   %eax,%eax
+  801d4b:	7f 6c                	jg     801db9 <sys_ipc_recv_range+0xad>
+}
+  801d4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d50:	5b                   	pop    %ebx
+  801d51:	5e                   	pop    %esi
+  801d52:	5f                   	pop    %edi
+  801d53:	5d                   	pop    %ebp
+  801d54:	c3                   	ret
+  801d55:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d5a:	0f a2                	cpuid
+		return 0;
+  801d5c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801d61:	f6 c6 08             	test   $0x8,%dh
+  801d64:	74 15                	je     801d7b <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d66:	89 c2                	mov    %eax,%edx
+  801d68:	c1 ea 08             	shr    $0x8,%edx
+  801d6b:	83 e2 0f             	and    $0xf,%edx
+  801d6e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d73:	83 fa 06             	cmp    $0x6,%edx
+  801d76:	74 0e                	je     801d86 <sys_ipc_recv_range+0x7a>
+  801d78:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801d7b:	0f b6 c9             	movzbl %cl,%ecx
+  801d7e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801d84:	eb 98                	jmp    801d1e <sys_ipc_recv_range+0x12>
+  801d86:	89 c2                	mov    %eax,%edx
+  801d88:	c1 ea 04             	shr    $0x4,%edx
+  801d8b:	83 e2 0f             	and    $0xf,%edx
+  801d8e:	83 fa 02             	cmp    $0x2,%edx
+  801d91:	77 e5                	ja     801d78 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801d93:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d96:	83 f8 02             	cmp    $0x2,%eax
+  801d99:	0f 97 c1             	seta   %cl
+  801d9c:	0f b6 c9             	movzbl %cl,%ecx
+  801d9f:	eb d7                	jmp    801d78 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801da1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801da6:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801dab:	8b 55 08             	mov    0x8(%ebp),%edx
+  801dae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801db1:	89 df                	mov    %ebx,%edi
+  801db3:	89 de                	mov    %ebx,%esi
+  801db5:	cd 30                	int    $0x30
+  801db7:	eb 90                	jmp    801d49 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801db9:	83 ec 0c             	sub    $0xc,%esp
+  801dbc:	50                   	push   %eax
+  801dbd:	6a 1f                	push   $0x1f
+  801dbf:	68 19 30 80 00       	push   $0x803019
+  801dc4:	6a 4a                	push   $0x4a
+  801dc6:	68 36 30 80 00       	push   $0x803036
+  801dcb:	e8 cf e5 ff ff       	call   80039f <_panic>
+
+00801dd0 <sys_ipc_call>:
+{
+  801dd0:	55                   	push   %ebp
+  801dd1:	89 e5                	mov    %esp,%ebp
+  801dd3:	57                   	push   %edi
+  801dd4:	56                   	push   %esi
+  801dd5:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801dd6:	8b 55 08             	mov    0x8(%ebp),%edx
+  801dd9:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801dde:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801de1:	55                   	push   %ebp
+  801de2:	56                   	push   %esi
+  801de3:	8b 0e                	mov    (%esi),%ecx
+  801de5:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801de8:	8b 7e 08             	mov    0x8(%esi),%edi
+  801deb:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801dee:	8b 76 0c             	mov    0xc(%esi),%esi
+  801df1:	cd 30                	int    $0x30
+  801df3:	87 34 24             	xchg   %esi,(%esp)
+  801df6:	89 0e                	mov    %ecx,(%esi)
+  801df8:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801dfb:	89 7e 08             	mov    %edi,0x8(%esi)
+  801dfe:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801e01:	8f 46 0c             	pop    0xc(%esi)
+  801e04:	5d                   	pop    %ebp
+}
+  801e05:	5b                   	pop    %ebx
+  801e06:	5e                   	pop    %esi
+  801e07:	5f                   	pop    %edi
+  801e08:	5d                   	pop    %ebp
+  801e09:	c3                   	ret
+
+00801e0a <sys_ipc_reply_wait>:
+{
+  801e0a:	55                   	push   %ebp
+  801e0b:	89 e5                	mov    %esp,%ebp
+  801e0d:	57                   	push   %edi
+  801e0e:	56                   	push   %esi
+  801e0f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801e10:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e13:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801e18:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801e1b:	55                   	push   %ebp
+  801e1c:	56                   	push   %esi
+  801e1d:	8b 0e                	mov    (%esi),%ecx
+  801e1f:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801e22:	8b 7e 08             	mov    0x8(%esi),%edi
+  801e25:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801e28:	8b 76 0c             	mov    0xc(%esi),%esi
+  801e2b:	cd 30                	int    $0x30
+  801e2d:	87 34 24             	xchg   %esi,(%esp)
+  801e30:	89 0e                	mov    %ecx,(%esi)
+  801e32:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801e35:	89 7e 08             	mov    %edi,0x8(%esi)
+  801e38:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801e3b:	8f 46 0c             	pop    0xc(%esi)
+  801e3e:	5d                   	pop    %ebp
+}
+  801e3f:	5b                   	pop    %ebx
+  801e40:	5e                   	pop    %esi
+  801e41:	5f                   	pop    %edi
+  801e42:	5d                   	pop    %ebp
+  801e43:	c3                   	ret
+
+00801e44 <sys_ipc_send_msg>:
+{
+  801e44:	55                   	push   %ebp
+  801e45:	89 e5                	mov    %esp,%ebp
+  801e47:	57                   	push   %edi
+  801e48:	56                   	push   %esi
+  801e49:	53                   	push   %ebx
+  801e4a:	83 ec 20             	sub    $0x20,%esp
+  801e4d:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801e50:	8b 10                	mov    (%eax),%edx
+  801e52:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801e55:	8b 50 04             	mov    0x4(%eax),%edx
+  801e58:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801e5b:	8b 50 08             	mov    0x8(%eax),%edx
+  801e5e:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801e61:	8b 50 0c             	mov    0xc(%eax),%edx
+  801e64:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801e67:	8b 40 10             	mov    0x10(%eax),%eax
+  801e6a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801e6d:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801e70:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e73:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801e78:	55                   	push   %ebp
+  801e79:	56                   	push   %esi
+  801e7a:	8b 0e                	mov    (%esi),%ecx
+  801e7c:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801e7f:	8b 7e 08             	mov    0x8(%esi),%edi
+  801e82:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801e85:	8b 76 0c             	mov    0xc(%esi),%esi
+  801e88:	cd 30                	int    $0x30
+  801e8a:	87 34 24             	xchg   %esi,(%esp)
+  801e8d:	89 0e                	mov    %ecx,(%esi)
+  801e8f:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801e92:	89 7e 08             	mov    %edi,0x8(%esi)
+  801e95:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801e98:	8f 46 0c             	pop    0xc(%esi)
+  801e9b:	5d                   	pop    %ebp
+}
+  801e9c:	83 c4 20             	add    $0x20,%esp
+  801e9f:	5b                   	pop    %ebx
+  801ea0:	5e                   	pop    %esi
+  801ea1:	5f                   	pop    %edi
+  801ea2:	5d                   	pop    %ebp
+  801ea3:	c3                   	ret
+
+00801ea4 <sys_fork>:
+{
+  801ea4:	55                   	push   %ebp
+  801ea5:	89 e5                	mov    %esp,%ebp
+  801ea7:	57                   	push   %edi
+  801ea8:	56                   	push   %esi
+  801ea9:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801eaa:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801eb1:	78 2e                	js     801ee1 <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801eb3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801eba:	74 71                	je     801f2d <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801ebc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ec1:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801ec6:	89 d1                	mov    %edx,%ecx
+  801ec8:	89 d3                	mov    %edx,%ebx
+  801eca:	89 d7                	mov    %edx,%edi
+  801ecc:	89 d6                	mov    %edx,%esi
+  801ece:	55                   	push   %ebp
+  801ecf:	68 d8 1e 80 00       	push   $0x801ed8
+  801ed4:	89 e5                	mov    %esp,%ebp
+  801ed6:	0f 34                	sysenter
+  801ed8:	83 c4 04             	add    $0x4,%esp
+  801edb:	5d                   	pop    %ebp
+}
+  801edc:	5b                   	pop    %ebx
+  801edd:	5e                   	pop    %esi
+  801ede:	5f                   	pop    %edi
+  801edf:	5d                   	pop    %ebp
+  801ee0:	c3                   	ret
+  801ee1:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ee6:	0f a2                	cpuid
+		return 0;
+  801ee8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801eed:	f6 c6 08             	test   $0x8,%dh
+  801ef0:	74 15                	je     801f07 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ef2:	89 c2                	mov    %eax,%edx
+  801ef4:	c1 ea 08             	shr    $0x8,%edx
+  801ef7:	83 e2 0f             	and    $0xf,%edx
+  801efa:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801eff:	83 fa 06             	cmp    $0x6,%edx
+  801f02:	74 0e                	je     801f12 <sys_fork+0x6e>
+  801f04:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801f07:	0f b6 c9             	movzbl %cl,%ecx
+  801f0a:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801f10:	eb a1                	jmp    801eb3 <sys_fork+0xf>
+  801f12:	89 c2                	mov    %eax,%edx
+  801f14:	c1 ea 04             	shr    $0x4,%edx
+  801f17:	83 e2 0f             	and    $0xf,%edx
+  801f1a:	83 fa 02             	cmp    $0x2,%edx
+  801f1d:	77 e5                	ja     801f04 <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801f1f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f22:	83 f8 02             	cmp    $0x2,%eax
+  801f25:	0f 97 c1             	seta   %cl
+  801f28:	0f b6 c9             	movzbl %cl,%ecx
+  801f2b:	eb d7                	jmp    801f04 <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801f2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f32:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801f37:	89 d1                	mov    %edx,%ecx
+  801f39:	89 d3                	mov    %edx,%ebx
+  801f3b:	89 d7                	mov    %edx,%edi
+  801f3d:	89 d6                	mov    %edx,%esi
+  801f3f:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801f41:	eb 99                	jmp    801edc <sys_fork+0x38>
+
+00801f43 <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801f43:	55                   	push   %ebp
+  801f44:	89 e5                	mov    %esp,%ebp
+  801f46:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801f49:	ff 75 14             	push   0x14(%ebp)
+  801f4c:	ff 75 10             	push   0x10(%ebp)
+  801f4f:	ff 75 0c             	push   0xc(%ebp)
+  801f52:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f57:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f5a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801f5f:	e8 81 ee ff ff       	call   800de5 <page_vec_call>
+}
+  801f64:	c9                   	leave
+  801f65:	c3                   	ret
+
+00801f66 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801f66:	55                   	push   %ebp
+  801f67:	89 e5                	mov    %esp,%ebp
+  801f69:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801f6c:	ff 75 18             	push   0x18(%ebp)
+  801f6f:	ff 75 14             	push   0x14(%ebp)
+  801f72:	ff 75 10             	push   0x10(%ebp)
+  801f75:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f78:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f7b:	b8 10 00 00 00       	mov    $0x10,%eax
+  801f80:	e8 60 ee ff ff       	call   800de5 <page_vec_call>
+}
+  801f85:	c9                   	leave
+  801f86:	c3                   	ret
+
+00801f87 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801f87:	55                   	push   %ebp
+  801f88:	89 e5                	mov    %esp,%ebp
+  801f8a:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801f8d:	ff 75 14             	push   0x14(%ebp)
+  801f90:	ff 75 10             	push   0x10(%ebp)
+  801f93:	ff 75 0c             	push   0xc(%ebp)
+  801f96:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f9e:	b8 11 00 00 00       	mov    $0x11,%eax
+  801fa3:	e8 3d ee ff ff       	call   800de5 <page_vec_call>
+}
+  801fa8:	c9                   	leave
+  801fa9:	c3                   	ret
+
+00801faa <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801faa:	55                   	push   %ebp
+  801fab:	89 e5                	mov    %esp,%ebp
+  801fad:	57                   	push   %edi
+  801fae:	56                   	push   %esi
+  801faf:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801fb0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801fb7:	78 32                	js     801feb <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801fb9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801fc0:	74 75                	je     802037 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801fc2:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fc5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fc8:	b8 12 00 00 00       	mov    $0x12,%eax
+  801fcd:	be 00 00 00 00       	mov    $0x0,%esi
+  801fd2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801fd5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801fd8:	55                   	push   %ebp
+  801fd9:	68 e2 1f 80 00       	push   $0x801fe2
+  801fde:	89 e5                	mov    %esp,%ebp
+  801fe0:	0f 34                	sysenter
+  801fe2:	83 c4 04             	add    $0x4,%esp
+  801fe5:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801fe6:	5b                   	pop    %ebx
+  801fe7:	5e                   	pop    %esi
+  801fe8:	5f                   	pop    %edi
+  801fe9:	5d                   	pop    %ebp
+  801fea:	c3                   	ret
+  801feb:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ff0:	0f a2                	cpuid
+		return 0;
+  801ff2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801ff7:	f6 c6 08             	test   $0x8,%dh
+  801ffa:	74 15                	je     802011 <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ffc:	89 c2                	mov    %eax,%edx
+  801ffe:	c1 ea 08             	shr    $0x8,%edx
+  802001:	83 e2 0f             	and    $0xf,%edx
+  802004:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802009:	83 fa 06             	cmp    $0x6,%edx
+  80200c:	74 0e                	je     80201c <sys_vm_ranges+0x72>
+  80200e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802011:	0f b6 c9             	movzbl %cl,%ecx
+  802014:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80201a:	eb 9d                	jmp    801fb9 <sys_vm_ranges+0xf>
+  80201c:	89 c2                	mov    %eax,%edx
+  80201e:	c1 ea 04             	shr    $0x4,%edx
+  802021:	83 e2 0f             	and    $0xf,%edx
+  802024:	83 fa 02             	cmp    $0x2,%edx
+  802027:	77 e5                	ja     80200e <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  802029:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80202c:	83 f8 02             	cmp    $0x2,%eax
+  80202f:	0f 97 c1             	seta   %cl
+  802032:	0f b6 c9             	movzbl %cl,%ecx
+  802035:	eb d7                	jmp    80200e <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  802037:	b8 12 00 00 00       	mov    $0x12,%eax
+  80203c:	be 00 00 00 00       	mov    $0x0,%esi
+  802041:	8b 55 08             	mov    0x8(%ebp),%edx
+  802044:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802047:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80204a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80204d:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  80204f:	eb 95                	jmp    801fe6 <sys_vm_ranges+0x3c>
+
+00802051 <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  802051:	55                   	push   %ebp
+  802052:	89 e5                	mov    %esp,%ebp
+  802054:	57                   	push   %edi
+  802055:	56                   	push   %esi
+  802056:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802057:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80205e:	78 31                	js     802091 <sys_spawn+0x40>
+	if (syscall_sysenter)
+  802060:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802067:	74 74                	je     8020dd <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  802069:	be 00 00 00 00       	mov    $0x0,%esi
+  80206e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802071:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802074:	b8 14 00 00 00       	mov    $0x14,%eax
+  802079:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80207c:	89 f7                	mov    %esi,%edi
+  80207e:	55                   	push   %ebp
+  80207f:	68 88 20 80 00       	push   $0x802088
+  802084:	89 e5                	mov    %esp,%ebp
+  802086:	0f 34                	sysenter
+  802088:	83 c4 04             	add    $0x4,%esp
+  80208b:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  80208c:	5b                   	pop    %ebx
+  80208d:	5e                   	pop    %esi
+  80208e:	5f                   	pop    %edi
+  80208f:	5d                   	pop    %ebp
+  802090:	c3                   	ret
+  802091:	b8 01 00 00 00       	mov    $0x1,%eax
+  802096:	0f a2                	cpuid
+		return 0;
+  802098:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80209d:	f6 c6 08             	test   $0x8,%dh
+  8020a0:	74 15                	je     8020b7 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020a2:	89 c2                	mov    %eax,%edx
+  8020a4:	c1 ea 08             	shr    $0x8,%edx
+  8020a7:	83 e2 0f             	and    $0xf,%edx
+  8020aa:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8020af:	83 fa 06             	cmp    $0x6,%edx
+  8020b2:	74 0e                	je     8020c2 <sys_spawn+0x71>
+  8020b4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8020b7:	0f b6 c9             	movzbl %cl,%ecx
+  8020ba:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8020c0:	eb 9e                	jmp    802060 <sys_spawn+0xf>
+  8020c2:	89 c2                	mov    %eax,%edx
+  8020c4:	c1 ea 04             	shr    $0x4,%edx
+  8020c7:	83 e2 0f             	and    $0xf,%edx
+  8020ca:	83 fa 02             	cmp    $0x2,%edx
+  8020cd:	77 e5                	ja     8020b4 <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  8020cf:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020d2:	83 f8 02             	cmp    $0x2,%eax
+  8020d5:	0f 97 c1             	seta   %cl
+  8020d8:	0f b6 c9             	movzbl %cl,%ecx
+  8020db:	eb d7                	jmp    8020b4 <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  8020dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8020e2:	b8 14 00 00 00       	mov    $0x14,%eax
+  8020e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020ea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020ed:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8020f0:	89 f7                	mov    %esi,%edi
+  8020f2:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  8020f4:	eb 96                	jmp    80208c <sys_spawn+0x3b>
+
+008020f6 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  8020f6:	55                   	push   %ebp
+  8020f7:	89 e5                	mov    %esp,%ebp
+  8020f9:	57                   	push   %edi
+  8020fa:	56                   	push   %esi
+  8020fb:	53                   	push   %ebx
+  8020fc:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8020ff:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802106:	78 37                	js     80213f <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  802108:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80210f:	74 7a                	je     80218b <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  802111:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802116:	8b 55 08             	mov    0x8(%ebp),%edx
+  802119:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80211c:	b8 15 00 00 00       	mov    $0x15,%eax
+  802121:	89 df                	mov    %ebx,%edi
+  802123:	89 de                	mov    %ebx,%esi
+  802125:	55                   	push   %ebp
+  802126:	68 2f 21 80 00       	push   $0x80212f
+  80212b:	89 e5                	mov    %esp,%ebp
+  80212d:	0f 34                	sysenter
+  80212f:	83 c4 04             	add    $0x4,%esp
+  802132:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802133:	85 c0                	test   %eax,%eax
+  802135:	7f 6c                	jg     8021a3 <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  802137:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80213a:	5b                   	pop    %ebx
+  80213b:	5e                   	pop    %esi
+  80213c:	5f                   	pop    %edi
+  80213d:	5d                   	pop    %ebp
+  80213e:	c3                   	ret
+  80213f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802144:	0f a2                	cpuid
+		return 0;
+  802146:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80214b:	f6 c6 08             	test   $0x8,%dh
+  80214e:	74 15                	je     802165 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802150:	89 c2                	mov    %eax,%edx
+  802152:	c1 ea 08             	shr    $0x8,%edx
+  802155:	83 e2 0f             	and    $0xf,%edx
+  802158:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80215d:	83 fa 06             	cmp    $0x6,%edx
+  802160:	74 0e                	je     802170 <sys_shm_create+0x7a>
+  802162:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802165:	0f b6 c9             	movzbl %cl,%ecx
+  802168:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80216e:	eb 98                	jmp    802108 <sys_shm_create+0x12>
+  802170:	89 c2                	mov    %eax,%edx
+  802172:	c1 ea 04             	shr    $0x4,%edx
+  802175:	83 e2 0f             	and    $0xf,%edx
+  802178:	83 fa 02             	cmp    $0x2,%edx
+  80217b:	77 e5                	ja     802162 <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  80217d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802180:	83 f8 02             	cmp    $0x2,%eax
+  802183:	0f 97 c1             	seta   %cl
+  802186:	0f b6 c9             	movzbl %cl,%ecx
+  802189:	eb d7                	jmp    802162 <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  80218b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802190:	b8 15 00 00 00       	mov    $0x15,%eax
+  802195:	8b 55 08             	mov    0x8(%ebp),%edx
+  802198:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80219b:	89 df                	mov    %ebx,%edi
+  80219d:	89 de                	mov    %ebx,%esi
+  80219f:	cd 30                	int    $0x30
+  8021a1:	eb 90                	jmp    802133 <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8021a3:	83 ec 0c             	sub    $0xc,%esp
+  8021a6:	50                   	push   %eax
+  8021a7:	6a 15                	push   $0x15
+  8021a9:	68 19 30 80 00       	push   $0x803019
+  8021ae:	6a 4a                	push   $0x4a
+  8021b0:	68 36 30 80 00       	push   $0x803036
+  8021b5:	e8 e5 e1 ff ff       	call   80039f <_panic>
+
+008021ba <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  8021ba:	55                   	push   %ebp
+  8021bb:	89 e5                	mov    %esp,%ebp
+  8021bd:	57                   	push   %edi
+  8021be:	56                   	push   %esi
+  8021bf:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8021c0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8021c7:	78 32                	js     8021fb <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  8021c9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8021d0:	74 75                	je     802247 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  8021d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021d8:	b8 16 00 00 00       	mov    $0x16,%eax
+  8021dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8021e2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8021e5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8021e8:	55                   	push   %ebp
+  8021e9:	68 f2 21 80 00       	push   $0x8021f2
+  8021ee:	89 e5                	mov    %esp,%ebp
+  8021f0:	0f 34                	sysenter
+  8021f2:	83 c4 04             	add    $0x4,%esp
+  8021f5:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  8021f6:	5b                   	pop    %ebx
+  8021f7:	5e                   	pop    %esi
+  8021f8:	5f                   	pop    %edi
+  8021f9:	5d                   	pop    %ebp
+  8021fa:	c3                   	ret
+  8021fb:	b8 01 00 00 00       	mov    $0x1,%eax
+  802200:	0f a2                	cpuid
+		return 0;
+  802202:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802207:	f6 c6 08             	test   $0x8,%dh
+  80220a:	74 15                	je     802221 <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80220c:	89 c2                	mov    %eax,%edx
+  80220e:	c1 ea 08             	shr    $0x8,%edx
+  802211:	83 e2 0f             	and    $0xf,%edx
+  802214:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802219:	83 fa 06             	cmp    $0x6,%edx
+  80221c:	74 0e                	je     80222c <sys_shm_attach+0x72>
+  80221e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802221:	0f b6 c9             	movzbl %cl,%ecx
+  802224:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80222a:	eb 9d                	jmp    8021c9 <sys_shm_attach+0xf>
+  80222c:	89 c2                	mov    %eax,%edx
+  80222e:	c1 ea 04             	shr    $0x4,%edx
+  802231:	83 e2 0f             	and    $0xf,%edx
+  802234:	83 fa 02             	cmp    $0x2,%edx
+  802237:	77 e5                	ja     80221e <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  802239:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80223c:	83 f8 02             	cmp    $0x2,%eax
+  80223f:	0f 97 c1             	seta   %cl
+  802242:	0f b6 c9             	movzbl %cl,%ecx
+  802245:	eb d7                	jmp    80221e <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  802247:	b8 16 00 00 00       	mov    $0x16,%eax
+  80224c:	be 00 00 00 00       	mov    $0x0,%esi
+  802251:	8b 55 08             	mov    0x8(%ebp),%edx
+  802254:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802257:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80225a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80225d:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  80225f:	eb 95                	jmp    8021f6 <sys_shm_attach+0x3c>
+
+00802261 <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  802261:	55                   	push   %ebp
+  802262:	89 e5                	mov    %esp,%ebp
+  802264:	57                   	push   %edi
+  802265:	56                   	push   %esi
+  802266:	53                   	push   %ebx
+  802267:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80226a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802271:	78 38                	js     8022ab <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  802273:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80227a:	74 7b                	je     8022f7 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  80227c:	be 00 00 00 00       	mov    $0x0,%esi
+  802281:	8b 55 08             	mov    0x8(%ebp),%edx
+  802284:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802287:	b8 17 00 00 00       	mov    $0x17,%eax
+  80228c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80228f:	89 f7                	mov    %esi,%edi
+  802291:	55                   	push   %ebp
+  802292:	68 9b 22 80 00       	push   $0x80229b
+  802297:	89 e5                	mov    %esp,%ebp
+  802299:	0f 34                	sysenter
+  80229b:	83 c4 04             	add    $0x4,%esp
+  80229e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80229f:	85 c0                	test   %eax,%eax
+  8022a1:	7f 6d                	jg     802310 <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  8022a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022a6:	5b                   	pop    %ebx
+  8022a7:	5e                   	pop    %esi
+  8022a8:	5f                   	pop    %edi
+  8022a9:	5d                   	pop    %ebp
+  8022aa:	c3                   	ret
+  8022ab:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022b0:	0f a2                	cpuid
+		return 0;
+  8022b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8022b7:	f6 c6 08             	test   $0x8,%dh
+  8022ba:	74 15                	je     8022d1 <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022bc:	89 c2                	mov    %eax,%edx
+  8022be:	c1 ea 08             	shr    $0x8,%edx
+  8022c1:	83 e2 0f             	and    $0xf,%edx
+  8022c4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8022c9:	83 fa 06             	cmp    $0x6,%edx
+  8022cc:	74 0e                	je     8022dc <sys_shm_detach+0x7b>
+  8022ce:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8022d1:	0f b6 c9             	movzbl %cl,%ecx
+  8022d4:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8022da:	eb 97                	jmp    802273 <sys_shm_detach+0x12>
+  8022dc:	89 c2                	mov    %eax,%edx
+  8022de:	c1 ea 04             	shr    $0x4,%edx
+  8022e1:	83 e2 0f             	and    $0xf,%edx
+  8022e4:	83 fa 02             	cmp    $0x2,%edx
+  8022e7:	77 e5                	ja     8022ce <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  8022e9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022ec:	83 f8 02             	cmp    $0x2,%eax
+  8022ef:	0f 97 c1             	seta   %cl
+  8022f2:	0f b6 c9             	movzbl %cl,%ecx
+  8022f5:	eb d7                	jmp    8022ce <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  8022f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8022fc:	b8 17 00 00 00       	mov    $0x17,%eax
+  802301:	8b 55 08             	mov    0x8(%ebp),%edx
+  802304:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802307:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80230a:	89 f7                	mov    %esi,%edi
+  80230c:	cd 30                	int    $0x30
+  80230e:	eb 8f                	jmp    80229f <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802310:	83 ec 0c             	sub    $0xc,%esp
+  802313:	50                   	push   %eax
+  802314:	6a 17                	push   $0x17
+  802316:	68 19 30 80 00       	push   $0x803019
+  80231b:	6a 4a                	push   $0x4a
+  80231d:	68 36 30 80 00       	push   $0x803036
+  802322:	e8 78 e0 ff ff       	call   80039f <_panic>
+
+00802327 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  802327:	55                   	push   %ebp
+  802328:	89 e5                	mov    %esp,%ebp
+  80232a:	57                   	push   %edi
+  80232b:	56                   	push   %esi
+  80232c:	53                   	push   %ebx
+  80232d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802330:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802337:	78 36                	js     80236f <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  802339:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802340:	74 79                	je     8023bb <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  802342:	8b 55 08             	mov    0x8(%ebp),%edx
+  802345:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80234a:	b8 18 00 00 00       	mov    $0x18,%eax
+  80234f:	89 cb                	mov    %ecx,%ebx
+  802351:	89 cf                	mov    %ecx,%edi
+  802353:	89 ce                	mov    %ecx,%esi
+  802355:	55                   	push   %ebp
+  802356:	68 5f 23 80 00       	push   $0x80235f
+  80235b:	89 e5                	mov    %esp,%ebp
+  80235d:	0f 34                	sysenter
+  80235f:	83 c4 04             	add    $0x4,%esp
+  802362:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802363:	85 c0                	test   %eax,%eax
+  802365:	7f 6b                	jg     8023d2 <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  802367:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80236a:	5b                   	pop    %ebx
+  80236b:	5e                   	pop    %esi
+  80236c:	5f                   	pop    %edi
+  80236d:	5d                   	pop    %ebp
+  80236e:	c3                   	ret
+  80236f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802374:	0f a2                	cpuid
+		return 0;
+  802376:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80237b:	f6 c6 08             	test   $0x8,%dh
+  80237e:	74 15                	je     802395 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802380:	89 c2                	mov    %eax,%edx
+  802382:	c1 ea 08             	shr    $0x8,%edx
+  802385:	83 e2 0f             	and    $0xf,%edx
+  802388:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80238d:	83 fa 06             	cmp    $0x6,%edx
+  802390:	74 0e                	je     8023a0 <sys_shm_remove+0x79>
+  802392:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802395:	0f b6 c9             	movzbl %cl,%ecx
+  802398:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80239e:	eb 99                	jmp    802339 <sys_shm_remove+0x12>
+  8023a0:	89 c2                	mov    %eax,%edx
+  8023a2:	c1 ea 04             	shr    $0x4,%edx
+  8023a5:	83 e2 0f             	and    $0xf,%edx
+  8023a8:	83 fa 02             	cmp    $0x2,%edx
+  8023ab:	77 e5                	ja     802392 <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  8023ad:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023b0:	83 f8 02             	cmp    $0x2,%eax
+  8023b3:	0f 97 c1             	seta   %cl
+  8023b6:	0f b6 c9             	movzbl %cl,%ecx
+  8023b9:	eb d7                	jmp    802392 <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  8023bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023c0:	b8 18 00 00 00       	mov    $0x18,%eax
+  8023c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023c8:	89 cb                	mov    %ecx,%ebx
+  8023ca:	89 cf                	mov    %ecx,%edi
+  8023cc:	89 ce                	mov    %ecx,%esi
+  8023ce:	cd 30                	int    $0x30
+  8023d0:	eb 91                	jmp    802363 <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8023d2:	83 ec 0c             	sub    $0xc,%esp
+  8023d5:	50                   	push   %eax
+  8023d6:	6a 18                	push   $0x18
+  8023d8:	68 19 30 80 00       	push   $0x803019
+  8023dd:	6a 4a                	push   $0x4a
+  8023df:	68 36 30 80 00       	push   $0x803036
+  8023e4:	e8 b6 df ff ff       	call   80039f <_panic>
+
+008023e9 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  8023e9:	55                   	push   %ebp
+  8023ea:	89 e5                	mov    %esp,%ebp
+  8023ec:	57                   	push   %edi
+  8023ed:	56                   	push   %esi
+  8023ee:	53                   	push   %ebx
+  8023ef:	83 ec 0c             	sub    $0xc,%esp
+  8023f2:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023f5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8023f8:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  8023fb:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802402:	78 32                	js     802436 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  802404:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80240b:	74 75                	je     802482 <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  80240d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802410:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802413:	b8 20 00 00 00       	mov    $0x20,%eax
+  802418:	be 00 00 00 00       	mov    $0x0,%esi
+  80241d:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802420:	55                   	push   %ebp
+  802421:	68 2a 24 80 00       	push   $0x80242a
+  802426:	89 e5                	mov    %esp,%ebp
+  802428:	0f 34                	sysenter
+  80242a:	83 c4 04             	add    $0x4,%esp
+  80242d:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  80242e:	83 c4 0c             	add    $0xc,%esp
+  802431:	5b                   	pop    %ebx
+  802432:	5e                   	pop    %esi
+  802433:	5f                   	pop    %edi
+  802434:	5d                   	pop    %ebp
+  802435:	c3                   	ret
+  802436:	b8 01 00 00 00       	mov    $0x1,%eax
+  80243b:	0f a2                	cpuid
+		return 0;
+  80243d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802442:	f6 c6 08             	test   $0x8,%dh
+  802445:	74 15                	je     80245c <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802447:	89 c2                	mov    %eax,%edx
+  802449:	c1 ea 08             	shr    $0x8,%edx
+  80244c:	83 e2 0f             	and    $0xf,%edx
+  80244f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802454:	83 fa 06             	cmp    $0x6,%edx
+  802457:	74 0e                	je     802467 <sys_futex_wait+0x7e>
+  802459:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80245c:	0f b6 c9             	movzbl %cl,%ecx
+  80245f:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802465:	eb 9d                	jmp    802404 <sys_futex_wait+0x1b>
+  802467:	89 c2                	mov    %eax,%edx
+  802469:	c1 ea 04             	shr    $0x4,%edx
+  80246c:	83 e2 0f             	and    $0xf,%edx
+  80246f:	83 fa 02             	cmp    $0x2,%edx
+  802472:	77 e5                	ja     802459 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  802474:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802477:	83 f8 02             	cmp    $0x2,%eax
+  80247a:	0f 97 c1             	seta   %cl
+  80247d:	0f b6 c9             	movzbl %cl,%ecx
+  802480:	eb d7                	jmp    802459 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  802482:	b8 20 00 00 00       	mov    $0x20,%eax
+  802487:	be 00 00 00 00       	mov    $0x0,%esi
+  80248c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80248f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802492:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802495:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  802497:	eb 95                	jmp    80242e <sys_futex_wait+0x45>
+
+00802499 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  802499:	55                   	push   %ebp
+  80249a:	89 e5                	mov    %esp,%ebp
+  80249c:	57                   	push   %edi
+  80249d:	56                   	push   %esi
+  80249e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80249f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8024a6:	78 30                	js     8024d8 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  8024a8:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8024af:	74 73                	je     802524 <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  8024b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024bc:	b8 21 00 00 00       	mov    $0x21,%eax
+  8024c1:	89 df                	mov    %ebx,%edi
+  8024c3:	89 de                	mov    %ebx,%esi
+  8024c5:	55                   	push   %ebp
+  8024c6:	68 cf 24 80 00       	push   $0x8024cf
+  8024cb:	89 e5                	mov    %esp,%ebp
+  8024cd:	0f 34                	sysenter
+  8024cf:	83 c4 04             	add    $0x4,%esp
+  8024d2:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8024d3:	5b                   	pop    %ebx
+  8024d4:	5e                   	pop    %esi
+  8024d5:	5f                   	pop    %edi
+  8024d6:	5d                   	pop    %ebp
+  8024d7:	c3                   	ret
+  8024d8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024dd:	0f a2                	cpuid
+		return 0;
+  8024df:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8024e4:	f6 c6 08             	test   $0x8,%dh
+  8024e7:	74 15                	je     8024fe <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8024e9:	89 c2                	mov    %eax,%edx
+  8024eb:	c1 ea 08             	shr    $0x8,%edx
+  8024ee:	83 e2 0f             	and    $0xf,%edx
+  8024f1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8024f6:	83 fa 06             	cmp    $0x6,%edx
+  8024f9:	74 0e                	je     802509 <sys_futex_wake+0x70>
+  8024fb:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8024fe:	0f b6 c9             	movzbl %cl,%ecx
+  802501:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802507:	eb 9f                	jmp    8024a8 <sys_futex_wake+0xf>
+  802509:	89 c2                	mov    %eax,%edx
+  80250b:	c1 ea 04             	shr    $0x4,%edx
+  80250e:	83 e2 0f             	and    $0xf,%edx
+  802511:	83 fa 02             	cmp    $0x2,%edx
+  802514:	77 e5                	ja     8024fb <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  802516:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802519:	83 f8 02             	cmp    $0x2,%eax
+  80251c:	0f 97 c1             	seta   %cl
+  80251f:	0f b6 c9             	movzbl %cl,%ecx
+  802522:	eb d7                	jmp    8024fb <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  802524:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802529:	b8 21 00 00 00       	mov    $0x21,%eax
+  80252e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802531:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802534:	89 df                	mov    %ebx,%edi
+  802536:	89 de                	mov    %ebx,%esi
+  802538:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  80253a:	eb 97                	jmp    8024d3 <sys_futex_wake+0x3a>
+
+0080253c <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  80253c:	55                   	push   %ebp
+  80253d:	89 e5                	mov    %esp,%ebp
+  80253f:	57                   	push   %edi
+  802540:	56                   	push   %esi
+  802541:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802542:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802549:	78 2e                	js     802579 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  80254b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802552:	74 71                	je     8025c5 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  802554:	ba 00 00 00 00       	mov    $0x0,%edx
+  802559:	b8 22 00 00 00       	mov    $0x22,%eax
+  80255e:	89 d1                	mov    %edx,%ecx
+  802560:	89 d3                	mov    %edx,%ebx
+  802562:	89 d7                	mov    %edx,%edi
+  802564:	89 d6                	mov    %edx,%esi
+  802566:	55                   	push   %ebp
+  802567:	68 70 25 80 00       	push   $0x802570
+  80256c:	89 e5                	mov    %esp,%ebp
+  80256e:	0f 34                	sysenter
+  802570:	83 c4 04             	add    $0x4,%esp
+  802573:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  802574:	5b                   	pop    %ebx
+  802575:	5e                   	pop    %esi
+  802576:	5f                   	pop    %edi
+  802577:	5d                   	pop    %ebp
+  802578:	c3                   	ret
+  802579:	b8 01 00 00 00       	mov    $0x1,%eax
+  80257e:	0f a2                	cpuid
+		return 0;
+  802580:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802585:	f6 c6 08             	test   $0x8,%dh
+  802588:	74 15                	je     80259f <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80258a:	89 c2                	mov    %eax,%edx
+  80258c:	c1 ea 08             	shr    $0x8,%edx
+  80258f:	83 e2 0f             	and    $0xf,%edx
+  802592:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802597:	83 fa 06             	cmp    $0x6,%edx
+  80259a:	74 0e                	je     8025aa <sys_ep_create+0x6e>
+  80259c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80259f:	0f b6 c9             	movzbl %cl,%ecx
+  8025a2:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8025a8:	eb a1                	jmp    80254b <sys_ep_create+0xf>
+  8025aa:	89 c2                	mov    %eax,%edx
+  8025ac:	c1 ea 04             	shr    $0x4,%edx
+  8025af:	83 e2 0f             	and    $0xf,%edx
+  8025b2:	83 fa 02             	cmp    $0x2,%edx
+  8025b5:	77 e5                	ja     80259c <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  8025b7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025ba:	83 f8 02             	cmp    $0x2,%eax
+  8025bd:	0f 97 c1             	seta   %cl
+  8025c0:	0f b6 c9             	movzbl %cl,%ecx
+  8025c3:	eb d7                	jmp    80259c <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  8025c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025ca:	b8 22 00 00 00       	mov    $0x22,%eax
+  8025cf:	89 d1                	mov    %edx,%ecx
+  8025d1:	89 d3                	mov    %edx,%ebx
+  8025d3:	89 d7                	mov    %edx,%edi
+  8025d5:	89 d6                	mov    %edx,%esi
+  8025d7:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  8025d9:	eb 99                	jmp    802574 <sys_ep_create+0x38>
+
+008025db <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  8025db:	55                   	push   %ebp
+  8025dc:	89 e5                	mov    %esp,%ebp
+  8025de:	57                   	push   %edi
+  8025df:	56                   	push   %esi
+  8025e0:	53                   	push   %ebx
+  8025e1:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8025e4:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8025eb:	78 36                	js     802623 <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  8025ed:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8025f4:	74 79                	je     80266f <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  8025f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025fe:	b8 23 00 00 00       	mov    $0x23,%eax
+  802603:	89 cb                	mov    %ecx,%ebx
+  802605:	89 cf                	mov    %ecx,%edi
+  802607:	89 ce                	mov    %ecx,%esi
+  802609:	55                   	push   %ebp
+  80260a:	68 13 26 80 00       	push   $0x802613
+  80260f:	89 e5                	mov    %esp,%ebp
+  802611:	0f 34                	sysenter
+  802613:	83 c4 04             	add    $0x4,%esp
+  802616:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802617:	85 c0                	test   %eax,%eax
+  802619:	7f 6b                	jg     802686 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  80261b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80261e:	5b                   	pop    %ebx
+  80261f:	5e                   	pop    %esi
+  802620:	5f                   	pop    %edi
+  802621:	5d                   	pop    %ebp
+  802622:	c3                   	ret
+  802623:	b8 01 00 00 00       	mov    $0x1,%eax
+  802628:	0f a2                	cpuid
+		return 0;
+  80262a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80262f:	f6 c6 08             	test   $0x8,%dh
+  802632:	74 15                	je     802649 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802634:	89 c2                	mov    %eax,%edx
+  802636:	c1 ea 08             	shr    $0x8,%edx
+  802639:	83 e2 0f             	and    $0xf,%edx
+  80263c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802641:	83 fa 06             	cmp    $0x6,%edx
+  802644:	74 0e                	je     802654 <sys_ep_destroy+0x79>
+  802646:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802649:	0f b6 c9             	movzbl %cl,%ecx
+  80264c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802652:	eb 99                	jmp    8025ed <sys_ep_destroy+0x12>
+  802654:	89 c2                	mov    %eax,%edx
+  802656:	c1 ea 04             	shr    $0x4,%edx
+  802659:	83 e2 0f             	and    $0xf,%edx
+  80265c:	83 fa 02             	cmp    $0x2,%edx
+  80265f:	77 e5                	ja     802646 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  802661:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802664:	83 f8 02             	cmp    $0x2,%eax
+  802667:	0f 97 c1             	seta   %cl
+  80266a:	0f b6 c9             	movzbl %cl,%ecx
+  80266d:	eb d7                	jmp    802646 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  80266f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802674:	b8 23 00 00 00       	mov    $0x23,%eax
+  802679:	8b 55 08             	mov    0x8(%ebp),%edx
+  80267c:	89 cb                	mov    %ecx,%ebx
+  80267e:	89 cf                	mov    %ecx,%edi
+  802680:	89 ce                	mov    %ecx,%esi
+  802682:	cd 30                	int    $0x30
+  802684:	eb 91                	jmp    802617 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802686:	83 ec 0c             	sub    $0xc,%esp
+  802689:	50                   	push   %eax
+  80268a:	6a 23                	push   $0x23
+  80268c:	68 19 30 80 00       	push   $0x803019
+  802691:	6a 4a                	push   $0x4a
+  802693:	68 36 30 80 00       	push   $0x803036
+  802698:	e8 02 dd ff ff       	call   80039f <_panic>
+
+0080269d <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  80269d:	55                   	push   %ebp
+  80269e:	89 e5                	mov    %esp,%ebp
+  8026a0:	57                   	push   %edi
+  8026a1:	56                   	push   %esi
+  8026a2:	53                   	push   %ebx
+  8026a3:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8026a6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8026ad:	78 37                	js     8026e6 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  8026af:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8026b6:	74 7a                	je     802732 <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  8026b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8026c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026c3:	b8 24 00 00 00       	mov    $0x24,%eax
+  8026c8:	89 df                	mov    %ebx,%edi
+  8026ca:	89 de                	mov    %ebx,%esi
+  8026cc:	55                   	push   %ebp
+  8026cd:	68 d6 26 80 00       	push   $0x8026d6
+  8026d2:	89 e5                	mov    %esp,%ebp
+  8026d4:	0f 34                	sysenter
+  8026d6:	83 c4 04             	add    $0x4,%esp
+  8026d9:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8026da:	85 c0                	test   %eax,%eax
+  8026dc:	7f 6c                	jg     80274a <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  8026de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026e1:	5b                   	pop    %ebx
+  8026e2:	5e                   	pop    %esi
+  8026e3:	5f                   	pop    %edi
+  8026e4:	5d                   	pop    %ebp
+  8026e5:	c3                   	ret
+  8026e6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026eb:	0f a2                	cpuid
+		return 0;
+  8026ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8026f2:	f6 c6 08             	test   $0x8,%dh
+  8026f5:	74 15                	je     80270c <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8026f7:	89 c2                	mov    %eax,%edx
+  8026f9:	c1 ea 08             	shr    $0x8,%edx
+  8026fc:	83 e2 0f             	and    $0xf,%edx
+  8026ff:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802704:	83 fa 06             	cmp    $0x6,%edx
+  802707:	74 0e                	je     802717 <sys_ep_grant+0x7a>
+  802709:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80270c:	0f b6 c9             	movzbl %cl,%ecx
+  80270f:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802715:	eb 98                	jmp    8026af <sys_ep_grant+0x12>
+  802717:	89 c2                	mov    %eax,%edx
+  802719:	c1 ea 04             	shr    $0x4,%edx
+  80271c:	83 e2 0f             	and    $0xf,%edx
+  80271f:	83 fa 02             	cmp    $0x2,%edx
+  802722:	77 e5                	ja     802709 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  802724:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802727:	83 f8 02             	cmp    $0x2,%eax
+  80272a:	0f 97 c1             	seta   %cl
+  80272d:	0f b6 c9             	movzbl %cl,%ecx
+  802730:	eb d7                	jmp    802709 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  802732:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802737:	b8 24 00 00 00       	mov    $0x24,%eax
+  80273c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80273f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802742:	89 df                	mov    %ebx,%edi
+  802744:	89 de                	mov    %ebx,%esi
+  802746:	cd 30                	int    $0x30
+  802748:	eb 90                	jmp    8026da <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80274a:	83 ec 0c             	sub    $0xc,%esp
+  80274d:	50                   	push   %eax
+  80274e:	6a 24                	push   $0x24
+  802750:	68 19 30 80 00       	push   $0x803019
+  802755:	6a 4a                	push   $0x4a
+  802757:	68 36 30 80 00       	push   $0x803036
+  80275c:	e8 3e dc ff ff       	call   80039f <_panic>
+
+00802761 <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  802761:	55                   	push   %ebp
+  802762:	89 e5                	mov    %esp,%ebp
+  802764:	57                   	push   %edi
+  802765:	56                   	push   %esi
+  802766:	53                   	push   %ebx
+  802767:	83 ec 20             	sub    $0x20,%esp
+  80276a:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  80276d:	8b 10                	mov    (%eax),%edx
+  80276f:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802772:	8b 50 04             	mov    0x4(%eax),%edx
+  802775:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802778:	8b 50 08             	mov    0x8(%eax),%edx
+  80277b:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  80277e:	8b 50 0c             	mov    0xc(%eax),%edx
+  802781:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  802784:	8b 40 10             	mov    0x10(%eax),%eax
+  802787:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  80278a:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  80278d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802790:	b8 25 00 00 00       	mov    $0x25,%eax
+  802795:	55                   	push   %ebp
+  802796:	56                   	push   %esi
+  802797:	8b 0e                	mov    (%esi),%ecx
+  802799:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80279c:	8b 7e 08             	mov    0x8(%esi),%edi
+  80279f:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8027a2:	8b 76 0c             	mov    0xc(%esi),%esi
+  8027a5:	cd 30                	int    $0x30
+  8027a7:	87 34 24             	xchg   %esi,(%esp)
+  8027aa:	89 0e                	mov    %ecx,(%esi)
+  8027ac:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8027af:	89 7e 08             	mov    %edi,0x8(%esi)
+  8027b2:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8027b5:	8f 46 0c             	pop    0xc(%esi)
+  8027b8:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  8027b9:	83 c4 20             	add    $0x20,%esp
+  8027bc:	5b                   	pop    %ebx
+  8027bd:	5e                   	pop    %esi
+  8027be:	5f                   	pop    %edi
+  8027bf:	5d                   	pop    %ebp
+  8027c0:	c3                   	ret
+
+008027c1 <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  8027c1:	55                   	push   %ebp
+  8027c2:	89 e5                	mov    %esp,%ebp
+  8027c4:	57                   	push   %edi
+  8027c5:	56                   	push   %esi
+  8027c6:	53                   	push   %ebx
+  8027c7:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  8027ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8027cd:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  8027cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8027d2:	b8 26 00 00 00       	mov    $0x26,%eax
+  8027d7:	55                   	push   %ebp
+  8027d8:	56                   	push   %esi
+  8027d9:	8b 0e                	mov    (%esi),%ecx
+  8027db:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8027de:	8b 7e 08             	mov    0x8(%esi),%edi
+  8027e1:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8027e4:	8b 76 0c             	mov    0xc(%esi),%esi
+  8027e7:	cd 30                	int    $0x30
+  8027e9:	87 34 24             	xchg   %esi,(%esp)
+  8027ec:	89 0e                	mov    %ecx,(%esi)
+  8027ee:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8027f1:	89 7e 08             	mov    %edi,0x8(%esi)
+  8027f4:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8027f7:	8f 46 0c             	pop    0xc(%esi)
+  8027fa:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  8027fb:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  8027ff:	74 0f                	je     802810 <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  802801:	85 c0                	test   %eax,%eax
+  802803:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802808:	0f 48 d1             	cmovs  %ecx,%edx
+  80280b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  80280e:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  802810:	5b                   	pop    %ebx
+  802811:	5e                   	pop    %esi
+  802812:	5f                   	pop    %edi
+  802813:	5d                   	pop    %ebp
+  802814:	c3                   	ret
+
+00802815 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  802815:	55                   	push   %ebp
+  802816:	89 e5                	mov    %esp,%ebp
+  802818:	57                   	push   %edi
+  802819:	56                   	push   %esi
+  80281a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80281b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802822:	78 2f                	js     802853 <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  802824:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80282b:	74 72                	je     80289f <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  80282d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802830:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802835:	b8 27 00 00 00       	mov    $0x27,%eax
+  80283a:	89 cb                	mov    %ecx,%ebx
+  80283c:	89 cf                	mov    %ecx,%edi
+  80283e:	89 ce                	mov    %ecx,%esi
+  802840:	55                   	push   %ebp
+  802841:	68 4a 28 80 00       	push   $0x80284a
+  802846:	89 e5                	mov    %esp,%ebp
+  802848:	0f 34                	sysenter
+  80284a:	83 c4 04             	add    $0x4,%esp
+  80284d:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  80284e:	5b                   	pop    %ebx
+  80284f:	5e                   	pop    %esi
+  802850:	5f                   	pop    %edi
+  802851:	5d                   	pop    %ebp
+  802852:	c3                   	ret
+  802853:	b8 01 00 00 00       	mov    $0x1,%eax
+  802858:	0f a2                	cpuid
+		return 0;
+  80285a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80285f:	f6 c6 08             	test   $0x8,%dh
+  802862:	74 15                	je     802879 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802864:	89 c2                	mov    %eax,%edx
+  802866:	c1 ea 08             	shr    $0x8,%edx
+  802869:	83 e2 0f             	and    $0xf,%edx
+  80286c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802871:	83 fa 06             	cmp    $0x6,%edx
+  802874:	74 0e                	je     802884 <sys_sysring_setup+0x6f>
+  802876:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802879:	0f b6 c9             	movzbl %cl,%ecx
+  80287c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802882:	eb a0                	jmp    802824 <sys_sysring_setup+0xf>
+  802884:	89 c2                	mov    %eax,%edx
+  802886:	c1 ea 04             	shr    $0x4,%edx
+  802889:	83 e2 0f             	and    $0xf,%edx
+  80288c:	83 fa 02             	cmp    $0x2,%edx
+  80288f:	77 e5                	ja     802876 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  802891:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802894:	83 f8 02             	cmp    $0x2,%eax
+  802897:	0f 97 c1             	seta   %cl
+  80289a:	0f b6 c9             	movzbl %cl,%ecx
+  80289d:	eb d7                	jmp    802876 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  80289f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028a4:	b8 27 00 00 00       	mov    $0x27,%eax
+  8028a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8028ac:	89 cb                	mov    %ecx,%ebx
+  8028ae:	89 cf                	mov    %ecx,%edi
+  8028b0:	89 ce                	mov    %ecx,%esi
+  8028b2:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  8028b4:	eb 98                	jmp    80284e <sys_sysring_setup+0x39>
+
+008028b6 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  8028b6:	55                   	push   %ebp
+  8028b7:	89 e5                	mov    %esp,%ebp
+  8028b9:	57                   	push   %edi
+  8028ba:	56                   	push   %esi
+  8028bb:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8028bc:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8028c3:	78 2e                	js     8028f3 <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  8028c5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8028cc:	74 71                	je     80293f <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  8028ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028d3:	b8 28 00 00 00       	mov    $0x28,%eax
+  8028d8:	89 d1                	mov    %edx,%ecx
+  8028da:	89 d3                	mov    %edx,%ebx
+  8028dc:	89 d7                	mov    %edx,%edi
+  8028de:	89 d6                	mov    %edx,%esi
+  8028e0:	55                   	push   %ebp
+  8028e1:	68 ea 28 80 00       	push   $0x8028ea
+  8028e6:	89 e5                	mov    %esp,%ebp
+  8028e8:	0f 34                	sysenter
+  8028ea:	83 c4 04             	add    $0x4,%esp
+  8028ed:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8028ee:	5b                   	pop    %ebx
+  8028ef:	5e                   	pop    %esi
+  8028f0:	5f                   	pop    %edi
+  8028f1:	5d                   	pop    %ebp
+  8028f2:	c3                   	ret
+  8028f3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028f8:	0f a2                	cpuid
+		return 0;
+  8028fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8028ff:	f6 c6 08             	test   $0x8,%dh
+  802902:	74 15                	je     802919 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802904:	89 c2                	mov    %eax,%edx
+  802906:	c1 ea 08             	shr    $0x8,%edx
+  802909:	83 e2 0f             	and    $0xf,%edx
+  80290c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802911:	83 fa 06             	cmp    $0x6,%edx
+  802914:	74 0e                	je     802924 <sys_sysring_enter+0x6e>
+  802916:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802919:	0f b6 c9             	movzbl %cl,%ecx
+  80291c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802922:	eb a1                	jmp    8028c5 <sys_sysring_enter+0xf>
+  802924:	89 c2                	mov    %eax,%edx
+  802926:	c1 ea 04             	shr    $0x4,%edx
+  802929:	83 e2 0f             	and    $0xf,%edx
+  80292c:	83 fa 02             	cmp    $0x2,%edx
+  80292f:	77 e5                	ja     802916 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  802931:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802934:	83 f8 02             	cmp    $0x2,%eax
+  802937:	0f 97 c1             	seta   %cl
+  80293a:	0f b6 c9             	movzbl %cl,%ecx
+  80293d:	eb d7                	jmp    802916 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  80293f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802944:	b8 28 00 00 00       	mov    $0x28,%eax
+  802949:	89 d1                	mov    %edx,%ecx
+  80294b:	89 d3                	mov    %edx,%ebx
+  80294d:	89 d7                	mov    %edx,%edi
+  80294f:	89 d6                	mov    %edx,%esi
+  802951:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  802953:	eb 99                	jmp    8028ee <sys_sysring_enter+0x38>
+
+00802955 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802955:	55                   	push   %ebp
+  802956:	89 e5                	mov    %esp,%ebp
+  802958:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  80295b:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  802962:	74 0a                	je     80296e <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  802964:	8b 45 08             	mov    0x8(%ebp),%eax
+  802967:	a3 0c 40 80 00       	mov    %eax,0x80400c
+}
+  80296c:	c9                   	leave
+  80296d:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE),
+  80296e:	83 ec 04             	sub    $0x4,%esp
+  802971:	6a 07                	push   $0x7
+  802973:	68 00 f0 bf ee       	push   $0xeebff000
+  802978:	6a 00                	push   $0x0
+  80297a:	e8 57 e9 ff ff       	call   8012d6 <sys_page_alloc>
+  80297f:	83 c4 10             	add    $0x10,%esp
+  802982:	85 c0                	test   %eax,%eax
+  802984:	78 28                	js     8029ae <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  802986:	83 ec 08             	sub    $0x8,%esp
+  802989:	68 c0 29 80 00       	push   $0x8029c0
+  80298e:	6a 00                	push   $0x0
+  802990:	e8 00 f0 ff ff       	call   801995 <sys_env_set_pgfault_upcall>
+  802995:	83 c4 10             	add    $0x10,%esp
+  802998:	85 c0                	test   %eax,%eax
+  80299a:	79 c8                	jns    802964 <set_pgfault_handler+0xf>
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+  80299c:	50                   	push   %eax
+  80299d:	68 6c 30 80 00       	push   $0x80306c
+  8029a2:	6a 24                	push   $0x24
+  8029a4:	68 a0 30 80 00       	push   $0x8030a0
+  8029a9:	e8 f1 d9 ff ff       	call   80039f <_panic>
+			panic("set_pgfault_handler: sys_page_alloc: %e", r);
+  8029ae:	50                   	push   %eax
+  8029af:	68 44 30 80 00       	push   $0x803044
+  8029b4:	6a 22                	push   $0x22
+  8029b6:	68 a0 30 80 00       	push   $0x8030a0
+  8029bb:	e8 df d9 ff ff       	call   80039f <_panic>
+
+008029c0 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8029c0:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8029c1:	a1 0c 40 80 00       	mov    0x80400c,%eax
+	call *%eax
+  8029c6:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8029c8:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 0x28(%esp), %ebx		// trap-time eip
+  8029cb:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl 0x30(%esp), %eax		// trap-time esp
+  8029cf:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  8029d3:	83 e8 04             	sub    $0x4,%eax
+	movl %ebx, (%eax)
+  8029d6:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 0x30(%esp)
+  8029d8:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp			// skip fault_va and err
+  8029dc:	83 c4 08             	add    $0x8,%esp
+	popal
+  8029df:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp			// skip eip
+  8029e0:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8029e3:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  8029e4:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8029e5:	c3                   	ret
+
+008029e6 <dm>:
+  8029e6:	55                   	push   %ebp
+  8029e7:	57                   	push   %edi
+  8029e8:	56                   	push   %esi
+  8029e9:	53                   	push   %ebx
+  8029ea:	83 ec 24             	sub    $0x24,%esp
+  8029ed:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8029f1:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8029f5:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8029f9:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8029fd:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802a01:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802a05:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802a09:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a0e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a13:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802a18:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802a1f:	00 
+  802a20:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802a27:	00 
+  802a28:	89 fb                	mov    %edi,%ebx
+  802a2a:	eb 08                	jmp    802a34 <dm+0x4e>
+  802a2c:	83 e9 01             	sub    $0x1,%ecx
+  802a2f:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802a32:	74 68                	je     802a9c <dm+0xb6>
+  802a34:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802a38:	01 c0                	add    %eax,%eax
+  802a3a:	89 c6                	mov    %eax,%esi
+  802a3c:	89 d7                	mov    %edx,%edi
+  802a3e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802a42:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802a46:	0f ad d0             	shrd   %cl,%edx,%eax
+  802a49:	d3 ea                	shr    %cl,%edx
+  802a4b:	f6 c1 20             	test   $0x20,%cl
+  802a4e:	74 04                	je     802a54 <dm+0x6e>
+  802a50:	89 d0                	mov    %edx,%eax
+  802a52:	31 d2                	xor    %edx,%edx
+  802a54:	83 e0 01             	and    $0x1,%eax
+  802a57:	89 04 24             	mov    %eax,(%esp)
+  802a5a:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802a61:	00 
+  802a62:	8b 04 24             	mov    (%esp),%eax
+  802a65:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802a69:	09 f0                	or     %esi,%eax
+  802a6b:	09 fa                	or     %edi,%edx
+  802a6d:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802a71:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802a75:	39 f0                	cmp    %esi,%eax
+  802a77:	89 d5                	mov    %edx,%ebp
+  802a79:	19 fd                	sbb    %edi,%ebp
+  802a7b:	72 af                	jb     802a2c <dm+0x46>
+  802a7d:	29 f0                	sub    %esi,%eax
+  802a7f:	19 fa                	sbb    %edi,%edx
+  802a81:	89 cf                	mov    %ecx,%edi
+  802a83:	c1 ef 05             	shr    $0x5,%edi
+  802a86:	83 e7 01             	and    $0x1,%edi
+  802a89:	89 fe                	mov    %edi,%esi
+  802a8b:	83 f6 01             	xor    $0x1,%esi
+  802a8e:	d3 e6                	shl    %cl,%esi
+  802a90:	d3 e7                	shl    %cl,%edi
+  802a92:	09 74 24 18          	or     %esi,0x18(%esp)
+  802a96:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802a9a:	eb 90                	jmp    802a2c <dm+0x46>
+  802a9c:	85 db                	test   %ebx,%ebx
+  802a9e:	74 05                	je     802aa5 <dm+0xbf>
+  802aa0:	89 03                	mov    %eax,(%ebx)
+  802aa2:	89 53 04             	mov    %edx,0x4(%ebx)
+  802aa5:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802aa9:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802aad:	83 c4 24             	add    $0x24,%esp
+  802ab0:	5b                   	pop    %ebx
+  802ab1:	5e                   	pop    %esi
+  802ab2:	5f                   	pop    %edi
+  802ab3:	5d                   	pop    %ebp
+  802ab4:	c3                   	ret
+
+00802ab5 <__udivdi3>:
+  802ab5:	83 ec 08             	sub    $0x8,%esp
+  802ab8:	6a 00                	push   $0x0
+  802aba:	ff 74 24 1c          	push   0x1c(%esp)
+  802abe:	ff 74 24 1c          	push   0x1c(%esp)
+  802ac2:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802ac6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802aca:	e8 17 ff ff ff       	call   8029e6 <dm>
+  802acf:	83 c4 14             	add    $0x14,%esp
+  802ad2:	c3                   	ret
+
+00802ad3 <__umoddi3>:
+  802ad3:	83 ec 18             	sub    $0x18,%esp
+  802ad6:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802ada:	50                   	push   %eax
+  802adb:	ff 74 24 2c          	push   0x2c(%esp)
+  802adf:	ff 74 24 2c          	push   0x2c(%esp)
+  802ae3:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802ae7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802aeb:	e8 f6 fe ff ff       	call   8029e6 <dm>
+  802af0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802af4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802af8:	83 c4 24             	add    $0x24,%esp
+  802afb:	c3                   	ret
+
+00802afc <__divdi3>:
+  802afc:	53                   	push   %ebx
+  802afd:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802b01:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802b05:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  802b09:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  802b0d:	85 d2                	test   %edx,%edx
+  802b0f:	78 15                	js     802b26 <__divdi3+0x2a>
+  802b11:	85 db                	test   %ebx,%ebx
+  802b13:	78 34                	js     802b49 <__divdi3+0x4d>
+  802b15:	83 ec 04             	sub    $0x4,%esp
+  802b18:	6a 00                	push   $0x0
+  802b1a:	53                   	push   %ebx
+  802b1b:	51                   	push   %ecx
+  802b1c:	e8 c5 fe ff ff       	call   8029e6 <dm>
+  802b21:	83 c4 10             	add    $0x10,%esp
+  802b24:	eb 21                	jmp    802b47 <__divdi3+0x4b>
+  802b26:	f7 d8                	neg    %eax
+  802b28:	83 d2 00             	adc    $0x0,%edx
+  802b2b:	f7 da                	neg    %edx
+  802b2d:	85 db                	test   %ebx,%ebx
+  802b2f:	78 30                	js     802b61 <__divdi3+0x65>
+  802b31:	83 ec 04             	sub    $0x4,%esp
+  802b34:	6a 00                	push   $0x0
+  802b36:	53                   	push   %ebx
+  802b37:	51                   	push   %ecx
+  802b38:	e8 a9 fe ff ff       	call   8029e6 <dm>
+  802b3d:	83 c4 10             	add    $0x10,%esp
+  802b40:	f7 d8                	neg    %eax
+  802b42:	83 d2 00             	adc    $0x0,%edx
+  802b45:	f7 da                	neg    %edx
+  802b47:	5b                   	pop    %ebx
+  802b48:	c3                   	ret
+  802b49:	83 ec 04             	sub    $0x4,%esp
+  802b4c:	6a 00                	push   $0x0
+  802b4e:	f7 d9                	neg    %ecx
+  802b50:	83 d3 00             	adc    $0x0,%ebx
+  802b53:	f7 db                	neg    %ebx
+  802b55:	53                   	push   %ebx
+  802b56:	51                   	push   %ecx
+  802b57:	e8 8a fe ff ff       	call   8029e6 <dm>
+  802b5c:	83 c4 10             	add    $0x10,%esp
+  802b5f:	eb df                	jmp    802b40 <__divdi3+0x44>
+  802b61:	83 ec 04             	sub    $0x4,%esp
+  802b64:	6a 00                	push   $0x0
+  802b66:	f7 d9                	neg    %ecx
+  802b68:	83 d3 00             	adc    $0x0,%ebx
+  802b6b:	f7 db                	neg    %ebx
+  802b6d:	53                   	push   %ebx
+  802b6e:	51                   	push   %ecx
+  802b6f:	e8 72 fe ff ff       	call   8029e6 <dm>
+  802b74:	83 c4 10             	add    $0x10,%esp
+  802b77:	eb ce                	jmp    802b47 <__divdi3+0x4b>
+
+00802b79 <__moddi3>:
+  802b79:	55                   	push   %ebp
+  802b7a:	57                   	push   %edi
+  802b7b:	56                   	push   %esi
+  802b7c:	53                   	push   %ebx
+  802b7d:	83 ec 18             	sub    $0x18,%esp
+  802b80:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802b84:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802b88:	89 f1                	mov    %esi,%ecx
+  802b8a:	f7 d9                	neg    %ecx
+  802b8c:	89 da                	mov    %ebx,%edx
+  802b8e:	83 d2 00             	adc    $0x0,%edx
+  802b91:	f7 da                	neg    %edx
+  802b93:	0f 48 ce             	cmovs  %esi,%ecx
+  802b96:	0f 48 d3             	cmovs  %ebx,%edx
+  802b99:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802b9d:	50                   	push   %eax
+  802b9e:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802ba2:	f7 de                	neg    %esi
+  802ba4:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802ba8:	83 d0 00             	adc    $0x0,%eax
+  802bab:	f7 d8                	neg    %eax
+  802bad:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802bb2:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802bb7:	50                   	push   %eax
+  802bb8:	56                   	push   %esi
+  802bb9:	89 c8                	mov    %ecx,%eax
+  802bbb:	e8 26 fe ff ff       	call   8029e6 <dm>
+  802bc0:	83 c4 10             	add    $0x10,%esp
+  802bc3:	85 db                	test   %ebx,%ebx
+  802bc5:	78 10                	js     802bd7 <__moddi3+0x5e>
+  802bc7:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802bcb:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802bcf:	83 c4 14             	add    $0x14,%esp
+  802bd2:	5b                   	pop    %ebx
+  802bd3:	5e                   	pop    %esi
+  802bd4:	5f                   	pop    %edi
+  802bd5:	5d                   	pop    %ebp
+  802bd6:	c3                   	ret
+  802bd7:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802bdb:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802bdf:	f7 d8                	neg    %eax
+  802be1:	83 d2 00             	adc    $0x0,%edx
+  802be4:	f7 da                	neg    %edx
+  802be6:	eb e7                	jmp    802bcf <__moddi3+0x56>
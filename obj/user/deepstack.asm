@@ -0,0 +1,5784 @@
+
+obj/user/deepstack:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 7d 01 00 00       	call   8001ae <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <recurse>:
+#define FRAME		512
+#define DEPTH		400		// 200KB of stack
+
+static int
+recurse(int depth)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	81 ec 08 02 00 00    	sub    $0x208,%esp
+	volatile char frame[FRAME];
+
+	frame[0] = depth;
+  80003c:	88 85 f8 fd ff ff    	mov    %al,-0x208(%ebp)
+	if (depth == 0)
+  800042:	85 c0                	test   %eax,%eax
+  800044:	75 0c                	jne    800052 <recurse+0x1f>
+		return frame[0];
+  800046:	0f b6 85 f8 fd ff ff 	movzbl -0x208(%ebp),%eax
+  80004d:	0f be c0             	movsbl %al,%eax
+	return recurse(depth - 1) + frame[0];
+}
+  800050:	c9                   	leave
+  800051:	c3                   	ret
+	return recurse(depth - 1) + frame[0];
+  800052:	83 e8 01             	sub    $0x1,%eax
+  800055:	e8 d9 ff ff ff       	call   800033 <recurse>
+  80005a:	89 c2                	mov    %eax,%edx
+  80005c:	0f b6 85 f8 fd ff ff 	movzbl -0x208(%ebp),%eax
+  800063:	0f be c0             	movsbl %al,%eax
+  800066:	01 d0                	add    %edx,%eax
+  800068:	eb e6                	jmp    800050 <recurse+0x1d>
+
+0080006a <stack_pages>:
+
+// Count the pages mapped in the stack region.
+static size_t
+stack_pages(void)
+{
+  80006a:	55                   	push   %ebp
+  80006b:	89 e5                	mov    %esp,%ebp
+  80006d:	56                   	push   %esi
+  80006e:	53                   	push   %ebx
+  80006f:	83 ec 10             	sub    $0x10,%esp
+	struct page_range r;
+	uintptr_t va = USTACKTOP - USTACKSIZE;
+	size_t n = 0;
+  800072:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uintptr_t va = USTACKTOP - USTACKSIZE;
+  800077:	ba 00 e0 af ee       	mov    $0xeeafe000,%edx
+
+	while (sys_vm_ranges(0, (void *) va, &r, 1) > 0
+  80007c:	8d 75 e8             	lea    -0x18(%ebp),%esi
+  80007f:	eb 19                	jmp    80009a <stack_pages+0x30>
+	       && (uintptr_t) r.pr_va < USTACKTOP) {
+		va = (uintptr_t) r.pr_va + r.pr_npages * PGSIZE;
+  800081:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800084:	c1 e2 0c             	shl    $0xc,%edx
+  800087:	01 ca                	add    %ecx,%edx
+		n += (MIN(va, USTACKTOP) - (uintptr_t) r.pr_va) / PGSIZE;
+  800089:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  80008e:	39 c2                	cmp    %eax,%edx
+  800090:	0f 46 c2             	cmovbe %edx,%eax
+  800093:	29 c8                	sub    %ecx,%eax
+  800095:	c1 e8 0c             	shr    $0xc,%eax
+  800098:	01 c3                	add    %eax,%ebx
+	while (sys_vm_ranges(0, (void *) va, &r, 1) > 0
+  80009a:	6a 01                	push   $0x1
+  80009c:	56                   	push   %esi
+  80009d:	52                   	push   %edx
+  80009e:	6a 00                	push   $0x0
+  8000a0:	e8 6f 1d 00 00       	call   801e14 <sys_vm_ranges>
+	       && (uintptr_t) r.pr_va < USTACKTOP) {
+  8000a5:	83 c4 10             	add    $0x10,%esp
+  8000a8:	85 c0                	test   %eax,%eax
+  8000aa:	7e 0b                	jle    8000b7 <stack_pages+0x4d>
+  8000ac:	8b 4d e8             	mov    -0x18(%ebp),%ecx
+  8000af:	81 f9 ff df bf ee    	cmp    $0xeebfdfff,%ecx
+  8000b5:	76 ca                	jbe    800081 <stack_pages+0x17>
+	}
+	return n;
+}
+  8000b7:	89 d8                	mov    %ebx,%eax
+  8000b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000bc:	5b                   	pop    %ebx
+  8000bd:	5e                   	pop    %esi
+  8000be:	5d                   	pop    %ebp
+  8000bf:	c3                   	ret
+
+008000c0 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000c0:	55                   	push   %ebp
+  8000c1:	89 e5                	mov    %esp,%ebp
+  8000c3:	56                   	push   %esi
+  8000c4:	53                   	push   %ebx
+	envid_t envid;
+	int r;
+
+	if ((envid = fork()) < 0)
+  8000c5:	e8 a8 29 00 00       	call   802a72 <fork>
+  8000ca:	89 c6                	mov    %eax,%esi
+  8000cc:	85 c0                	test   %eax,%eax
+  8000ce:	78 18                	js     8000e8 <umain+0x28>
+		panic("fork: %e", envid);
+	if (envid == 0) {
+  8000d0:	74 28                	je     8000fa <umain+0x3a>
+			panic("sys_env_set_stack_limit: %e", r);
+		cprintf("child: recursing past a 16 page limit\n");
+		recurse(DEPTH);
+		panic("child survived its stack overflow");
+	}
+	while (envs[ENVX(envid)].env_id == envid
+  8000d2:	89 c3                	mov    %eax,%ebx
+  8000d4:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8000da:	69 db 68 01 00 00    	imul   $0x168,%ebx,%ebx
+  8000e0:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8000e6:	eb 6a                	jmp    800152 <umain+0x92>
+		panic("fork: %e", envid);
+  8000e8:	50                   	push   %eax
+  8000e9:	68 60 2d 80 00       	push   $0x802d60
+  8000ee:	6a 2c                	push   $0x2c
+  8000f0:	68 69 2d 80 00       	push   $0x802d69
+  8000f5:	e8 0f 01 00 00       	call   800209 <_panic>
+		if ((r = sys_env_set_stack_limit(0, 16 * PGSIZE)) < 0)
+  8000fa:	83 ec 08             	sub    $0x8,%esp
+  8000fd:	68 00 00 01 00       	push   $0x10000
+  800102:	6a 00                	push   $0x0
+  800104:	e8 32 16 00 00       	call   80173b <sys_env_set_stack_limit>
+  800109:	83 c4 10             	add    $0x10,%esp
+  80010c:	85 c0                	test   %eax,%eax
+  80010e:	78 2b                	js     80013b <umain+0x7b>
+		cprintf("child: recursing past a 16 page limit\n");
+  800110:	83 ec 0c             	sub    $0xc,%esp
+  800113:	68 c0 2d 80 00       	push   $0x802dc0
+  800118:	e8 00 02 00 00       	call   80031d <cprintf>
+		recurse(DEPTH);
+  80011d:	b8 90 01 00 00       	mov    $0x190,%eax
+  800122:	e8 0c ff ff ff       	call   800033 <recurse>
+		panic("child survived its stack overflow");
+  800127:	83 c4 0c             	add    $0xc,%esp
+  80012a:	68 e8 2d 80 00       	push   $0x802de8
+  80012f:	6a 32                	push   $0x32
+  800131:	68 69 2d 80 00       	push   $0x802d69
+  800136:	e8 ce 00 00 00       	call   800209 <_panic>
+			panic("sys_env_set_stack_limit: %e", r);
+  80013b:	50                   	push   %eax
+  80013c:	68 7a 2d 80 00       	push   $0x802d7a
+  800141:	6a 2f                	push   $0x2f
+  800143:	68 69 2d 80 00       	push   $0x802d69
+  800148:	e8 bc 00 00 00       	call   800209 <_panic>
+	       && envs[ENVX(envid)].env_status != ENV_FREE)
+		sys_yield();
+  80014d:	e8 00 13 00 00       	call   801452 <sys_yield>
+	while (envs[ENVX(envid)].env_id == envid
+  800152:	8b 43 48             	mov    0x48(%ebx),%eax
+	       && envs[ENVX(envid)].env_status != ENV_FREE)
+  800155:	39 f0                	cmp    %esi,%eax
+  800157:	75 07                	jne    800160 <umain+0xa0>
+  800159:	8b 43 54             	mov    0x54(%ebx),%eax
+  80015c:	85 c0                	test   %eax,%eax
+  80015e:	75 ed                	jne    80014d <umain+0x8d>
+	cprintf("stack pages at start: %d\n", stack_pages());
+  800160:	e8 05 ff ff ff       	call   80006a <stack_pages>
+  800165:	83 ec 08             	sub    $0x8,%esp
+  800168:	50                   	push   %eax
+  800169:	68 96 2d 80 00       	push   $0x802d96
+  80016e:	e8 aa 01 00 00       	call   80031d <cprintf>
+	recurse(DEPTH);
+  800173:	b8 90 01 00 00       	mov    $0x190,%eax
+  800178:	e8 b6 fe ff ff       	call   800033 <recurse>
+	cprintf("stack pages after %d frames of %d bytes: %d\n",
+  80017d:	e8 e8 fe ff ff       	call   80006a <stack_pages>
+  800182:	50                   	push   %eax
+  800183:	68 00 02 00 00       	push   $0x200
+  800188:	68 90 01 00 00       	push   $0x190
+  80018d:	68 0c 2e 80 00       	push   $0x802e0c
+  800192:	e8 86 01 00 00       	call   80031d <cprintf>
+		DEPTH, FRAME, stack_pages());
+	cprintf("deepstack done\n");
+  800197:	83 c4 14             	add    $0x14,%esp
+  80019a:	68 b0 2d 80 00       	push   $0x802db0
+  80019f:	e8 79 01 00 00       	call   80031d <cprintf>
+}
+  8001a4:	83 c4 10             	add    $0x10,%esp
+  8001a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001aa:	5b                   	pop    %ebx
+  8001ab:	5e                   	pop    %esi
+  8001ac:	5d                   	pop    %ebp
+  8001ad:	c3                   	ret
+
+008001ae <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001ae:	55                   	push   %ebp
+  8001af:	89 e5                	mov    %esp,%ebp
+  8001b1:	56                   	push   %esi
+  8001b2:	53                   	push   %ebx
+  8001b3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001b6:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  8001b9:	e8 e3 0e 00 00       	call   8010a1 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  8001be:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001c3:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  8001c9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001ce:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001d3:	85 db                	test   %ebx,%ebx
+  8001d5:	7e 07                	jle    8001de <libmain+0x30>
+		binaryname = argv[0];
+  8001d7:	8b 06                	mov    (%esi),%eax
+  8001d9:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8001de:	83 ec 08             	sub    $0x8,%esp
+  8001e1:	56                   	push   %esi
+  8001e2:	53                   	push   %ebx
+  8001e3:	e8 d8 fe ff ff       	call   8000c0 <umain>
+
+	// exit gracefully
+	exit();
+  8001e8:	e8 0a 00 00 00       	call   8001f7 <exit>
+}
+  8001ed:	83 c4 10             	add    $0x10,%esp
+  8001f0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001f3:	5b                   	pop    %ebx
+  8001f4:	5e                   	pop    %esi
+  8001f5:	5d                   	pop    %ebp
+  8001f6:	c3                   	ret
+
+008001f7 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001f7:	55                   	push   %ebp
+  8001f8:	89 e5                	mov    %esp,%ebp
+  8001fa:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  8001fd:	6a 00                	push   $0x0
+  8001ff:	e8 db 0d 00 00       	call   800fdf <sys_env_destroy>
+}
+  800204:	83 c4 10             	add    $0x10,%esp
+  800207:	c9                   	leave
+  800208:	c3                   	ret
+
+00800209 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800209:	55                   	push   %ebp
+  80020a:	89 e5                	mov    %esp,%ebp
+  80020c:	57                   	push   %edi
+  80020d:	56                   	push   %esi
+  80020e:	53                   	push   %ebx
+  80020f:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  800215:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  800218:	8b 1d 00 40 80 00    	mov    0x804000,%ebx
+  80021e:	e8 7e 0e 00 00       	call   8010a1 <sys_getenvid>
+  800223:	83 ec 04             	sub    $0x4,%esp
+  800226:	ff 75 0c             	push   0xc(%ebp)
+  800229:	ff 75 08             	push   0x8(%ebp)
+  80022c:	53                   	push   %ebx
+  80022d:	50                   	push   %eax
+  80022e:	68 44 2e 80 00       	push   $0x802e44
+  800233:	68 00 01 00 00       	push   $0x100
+  800238:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  80023e:	56                   	push   %esi
+  80023f:	e8 72 06 00 00       	call   8008b6 <snprintf>
+  800244:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  800246:	83 c4 20             	add    $0x20,%esp
+  800249:	57                   	push   %edi
+  80024a:	ff 75 10             	push   0x10(%ebp)
+  80024d:	bf 00 01 00 00       	mov    $0x100,%edi
+  800252:	89 f8                	mov    %edi,%eax
+  800254:	29 d8                	sub    %ebx,%eax
+  800256:	50                   	push   %eax
+  800257:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  80025a:	50                   	push   %eax
+  80025b:	e8 08 06 00 00       	call   800868 <vsnprintf>
+  800260:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  800262:	83 c4 0c             	add    $0xc,%esp
+  800265:	68 ae 2d 80 00       	push   $0x802dae
+  80026a:	29 df                	sub    %ebx,%edi
+  80026c:	57                   	push   %edi
+  80026d:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  800270:	50                   	push   %eax
+  800271:	e8 40 06 00 00       	call   8008b6 <snprintf>
+	sys_cputs(buf, r);
+  800276:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  800279:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  80027b:	53                   	push   %ebx
+  80027c:	56                   	push   %esi
+  80027d:	e8 21 0c 00 00       	call   800ea3 <sys_cputs>
+  800282:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800285:	cc                   	int3
+	while (1)
+  800286:	eb fd                	jmp    800285 <_panic+0x7c>
+
+00800288 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800288:	55                   	push   %ebp
+  800289:	89 e5                	mov    %esp,%ebp
+  80028b:	53                   	push   %ebx
+  80028c:	83 ec 04             	sub    $0x4,%esp
+  80028f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800292:	8b 13                	mov    (%ebx),%edx
+  800294:	8d 42 01             	lea    0x1(%edx),%eax
+  800297:	89 03                	mov    %eax,(%ebx)
+  800299:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80029c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8002a0:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002a5:	74 09                	je     8002b0 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002a7:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002ae:	c9                   	leave
+  8002af:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002b0:	83 ec 08             	sub    $0x8,%esp
+  8002b3:	68 ff 00 00 00       	push   $0xff
+  8002b8:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002bb:	50                   	push   %eax
+  8002bc:	e8 e2 0b 00 00       	call   800ea3 <sys_cputs>
+		b->idx = 0;
+  8002c1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002c7:	83 c4 10             	add    $0x10,%esp
+  8002ca:	eb db                	jmp    8002a7 <putch+0x1f>
+
+008002cc <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002cc:	55                   	push   %ebp
+  8002cd:	89 e5                	mov    %esp,%ebp
+  8002cf:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002d5:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002dc:	00 00 00 
+	b.cnt = 0;
+  8002df:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002e6:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002e9:	ff 75 0c             	push   0xc(%ebp)
+  8002ec:	ff 75 08             	push   0x8(%ebp)
+  8002ef:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002f5:	50                   	push   %eax
+  8002f6:	68 88 02 80 00       	push   $0x800288
+  8002fb:	e8 14 01 00 00       	call   800414 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800300:	83 c4 08             	add    $0x8,%esp
+  800303:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800309:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80030f:	50                   	push   %eax
+  800310:	e8 8e 0b 00 00       	call   800ea3 <sys_cputs>
+
+	return b.cnt;
+}
+  800315:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80031b:	c9                   	leave
+  80031c:	c3                   	ret
+
+0080031d <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80031d:	55                   	push   %ebp
+  80031e:	89 e5                	mov    %esp,%ebp
+  800320:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800323:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800326:	50                   	push   %eax
+  800327:	ff 75 08             	push   0x8(%ebp)
+  80032a:	e8 9d ff ff ff       	call   8002cc <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80032f:	c9                   	leave
+  800330:	c3                   	ret
+
+00800331 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800331:	55                   	push   %ebp
+  800332:	89 e5                	mov    %esp,%ebp
+  800334:	57                   	push   %edi
+  800335:	56                   	push   %esi
+  800336:	53                   	push   %ebx
+  800337:	83 ec 1c             	sub    $0x1c,%esp
+  80033a:	89 c7                	mov    %eax,%edi
+  80033c:	89 d6                	mov    %edx,%esi
+  80033e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800341:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800344:	89 d1                	mov    %edx,%ecx
+  800346:	89 c2                	mov    %eax,%edx
+  800348:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80034b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80034e:	8b 45 10             	mov    0x10(%ebp),%eax
+  800351:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800354:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800357:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80035e:	39 c2                	cmp    %eax,%edx
+  800360:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800363:	72 3e                	jb     8003a3 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800365:	83 ec 0c             	sub    $0xc,%esp
+  800368:	ff 75 18             	push   0x18(%ebp)
+  80036b:	83 eb 01             	sub    $0x1,%ebx
+  80036e:	53                   	push   %ebx
+  80036f:	50                   	push   %eax
+  800370:	83 ec 08             	sub    $0x8,%esp
+  800373:	ff 75 e4             	push   -0x1c(%ebp)
+  800376:	ff 75 e0             	push   -0x20(%ebp)
+  800379:	ff 75 dc             	push   -0x24(%ebp)
+  80037c:	ff 75 d8             	push   -0x28(%ebp)
+  80037f:	e8 9d 28 00 00       	call   802c21 <__udivdi3>
+  800384:	83 c4 18             	add    $0x18,%esp
+  800387:	52                   	push   %edx
+  800388:	50                   	push   %eax
+  800389:	89 f2                	mov    %esi,%edx
+  80038b:	89 f8                	mov    %edi,%eax
+  80038d:	e8 9f ff ff ff       	call   800331 <printnum>
+  800392:	83 c4 20             	add    $0x20,%esp
+  800395:	eb 13                	jmp    8003aa <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800397:	83 ec 08             	sub    $0x8,%esp
+  80039a:	56                   	push   %esi
+  80039b:	ff 75 18             	push   0x18(%ebp)
+  80039e:	ff d7                	call   *%edi
+  8003a0:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8003a3:	83 eb 01             	sub    $0x1,%ebx
+  8003a6:	85 db                	test   %ebx,%ebx
+  8003a8:	7f ed                	jg     800397 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8003aa:	83 ec 08             	sub    $0x8,%esp
+  8003ad:	56                   	push   %esi
+  8003ae:	83 ec 04             	sub    $0x4,%esp
+  8003b1:	ff 75 e4             	push   -0x1c(%ebp)
+  8003b4:	ff 75 e0             	push   -0x20(%ebp)
+  8003b7:	ff 75 dc             	push   -0x24(%ebp)
+  8003ba:	ff 75 d8             	push   -0x28(%ebp)
+  8003bd:	e8 7d 28 00 00       	call   802c3f <__umoddi3>
+  8003c2:	83 c4 14             	add    $0x14,%esp
+  8003c5:	0f be 80 67 2e 80 00 	movsbl 0x802e67(%eax),%eax
+  8003cc:	50                   	push   %eax
+  8003cd:	ff d7                	call   *%edi
+}
+  8003cf:	83 c4 10             	add    $0x10,%esp
+  8003d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003d5:	5b                   	pop    %ebx
+  8003d6:	5e                   	pop    %esi
+  8003d7:	5f                   	pop    %edi
+  8003d8:	5d                   	pop    %ebp
+  8003d9:	c3                   	ret
+
+008003da <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003da:	55                   	push   %ebp
+  8003db:	89 e5                	mov    %esp,%ebp
+  8003dd:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003e0:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003e4:	8b 10                	mov    (%eax),%edx
+  8003e6:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003e9:	73 0a                	jae    8003f5 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003eb:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003ee:	89 08                	mov    %ecx,(%eax)
+  8003f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003f3:	88 02                	mov    %al,(%edx)
+}
+  8003f5:	5d                   	pop    %ebp
+  8003f6:	c3                   	ret
+
+008003f7 <printfmt>:
+{
+  8003f7:	55                   	push   %ebp
+  8003f8:	89 e5                	mov    %esp,%ebp
+  8003fa:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003fd:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800400:	50                   	push   %eax
+  800401:	ff 75 10             	push   0x10(%ebp)
+  800404:	ff 75 0c             	push   0xc(%ebp)
+  800407:	ff 75 08             	push   0x8(%ebp)
+  80040a:	e8 05 00 00 00       	call   800414 <vprintfmt>
+}
+  80040f:	83 c4 10             	add    $0x10,%esp
+  800412:	c9                   	leave
+  800413:	c3                   	ret
+
+00800414 <vprintfmt>:
+{
+  800414:	55                   	push   %ebp
+  800415:	89 e5                	mov    %esp,%ebp
+  800417:	57                   	push   %edi
+  800418:	56                   	push   %esi
+  800419:	53                   	push   %ebx
+  80041a:	83 ec 2c             	sub    $0x2c,%esp
+  80041d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800420:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800423:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800426:	eb 0a                	jmp    800432 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800428:	83 ec 08             	sub    $0x8,%esp
+  80042b:	53                   	push   %ebx
+  80042c:	50                   	push   %eax
+  80042d:	ff d6                	call   *%esi
+  80042f:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800432:	83 c7 01             	add    $0x1,%edi
+  800435:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800439:	83 f8 25             	cmp    $0x25,%eax
+  80043c:	74 0c                	je     80044a <vprintfmt+0x36>
+			if (ch == '\0')
+  80043e:	85 c0                	test   %eax,%eax
+  800440:	75 e6                	jne    800428 <vprintfmt+0x14>
+}
+  800442:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800445:	5b                   	pop    %ebx
+  800446:	5e                   	pop    %esi
+  800447:	5f                   	pop    %edi
+  800448:	5d                   	pop    %ebp
+  800449:	c3                   	ret
+		padc = ' ';
+  80044a:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80044e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800455:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80045c:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800463:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800468:	8d 47 01             	lea    0x1(%edi),%eax
+  80046b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80046e:	0f b6 17             	movzbl (%edi),%edx
+  800471:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800474:	3c 55                	cmp    $0x55,%al
+  800476:	0f 87 cf 03 00 00    	ja     80084b <vprintfmt+0x437>
+  80047c:	0f b6 c0             	movzbl %al,%eax
+  80047f:	ff 24 85 60 2f 80 00 	jmp    *0x802f60(,%eax,4)
+  800486:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800489:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80048d:	eb d9                	jmp    800468 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80048f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800492:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800496:	eb d0                	jmp    800468 <vprintfmt+0x54>
+  800498:	0f b6 d2             	movzbl %dl,%edx
+  80049b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80049e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004a3:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8004a6:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8004a9:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8004ad:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8004b0:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8004b3:	83 f9 09             	cmp    $0x9,%ecx
+  8004b6:	77 55                	ja     80050d <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8004b8:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8004bb:	eb e9                	jmp    8004a6 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8004bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c0:	8b 00                	mov    (%eax),%eax
+  8004c2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c8:	8d 40 04             	lea    0x4(%eax),%eax
+  8004cb:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ce:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8004d1:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004d5:	79 91                	jns    800468 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8004d7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004da:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004dd:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004e4:	eb 82                	jmp    800468 <vprintfmt+0x54>
+			if (width < 0)
+  8004e6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004e9:	85 d2                	test   %edx,%edx
+  8004eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f0:	0f 49 c2             	cmovns %edx,%eax
+  8004f3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004f6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004f9:	e9 6a ff ff ff       	jmp    800468 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004fe:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800501:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800508:	e9 5b ff ff ff       	jmp    800468 <vprintfmt+0x54>
+  80050d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800510:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800513:	eb bc                	jmp    8004d1 <vprintfmt+0xbd>
+			lflag++;
+  800515:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800518:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80051b:	e9 48 ff ff ff       	jmp    800468 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800520:	8b 45 14             	mov    0x14(%ebp),%eax
+  800523:	8d 78 04             	lea    0x4(%eax),%edi
+  800526:	83 ec 08             	sub    $0x8,%esp
+  800529:	53                   	push   %ebx
+  80052a:	ff 30                	push   (%eax)
+  80052c:	ff d6                	call   *%esi
+			break;
+  80052e:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800531:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800534:	e9 b1 02 00 00       	jmp    8007ea <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800539:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053c:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80053f:	8b 10                	mov    (%eax),%edx
+  800541:	89 d0                	mov    %edx,%eax
+  800543:	f7 d8                	neg    %eax
+  800545:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800548:	83 f8 0d             	cmp    $0xd,%eax
+  80054b:	7f 23                	jg     800570 <vprintfmt+0x15c>
+  80054d:	8b 14 85 c0 30 80 00 	mov    0x8030c0(,%eax,4),%edx
+  800554:	85 d2                	test   %edx,%edx
+  800556:	74 18                	je     800570 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800558:	52                   	push   %edx
+  800559:	68 88 2e 80 00       	push   $0x802e88
+  80055e:	53                   	push   %ebx
+  80055f:	56                   	push   %esi
+  800560:	e8 92 fe ff ff       	call   8003f7 <printfmt>
+  800565:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800568:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80056b:	e9 7a 02 00 00       	jmp    8007ea <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800570:	50                   	push   %eax
+  800571:	68 7f 2e 80 00       	push   $0x802e7f
+  800576:	53                   	push   %ebx
+  800577:	56                   	push   %esi
+  800578:	e8 7a fe ff ff       	call   8003f7 <printfmt>
+  80057d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800580:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800583:	e9 62 02 00 00       	jmp    8007ea <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800588:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058b:	83 c0 04             	add    $0x4,%eax
+  80058e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800591:	8b 45 14             	mov    0x14(%ebp),%eax
+  800594:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800596:	85 c9                	test   %ecx,%ecx
+  800598:	b8 78 2e 80 00       	mov    $0x802e78,%eax
+  80059d:	0f 45 c1             	cmovne %ecx,%eax
+  8005a0:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8005a3:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005a7:	7e 06                	jle    8005af <vprintfmt+0x19b>
+  8005a9:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8005ad:	75 0b                	jne    8005ba <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005af:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8005b2:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005b5:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005b8:	eb 5c                	jmp    800616 <vprintfmt+0x202>
+  8005ba:	83 ec 08             	sub    $0x8,%esp
+  8005bd:	ff 75 d0             	push   -0x30(%ebp)
+  8005c0:	ff 75 cc             	push   -0x34(%ebp)
+  8005c3:	e8 20 03 00 00       	call   8008e8 <strnlen>
+  8005c8:	89 c2                	mov    %eax,%edx
+  8005ca:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005cd:	29 d0                	sub    %edx,%eax
+  8005cf:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005d2:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005d6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005d9:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005dc:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005de:	eb 0e                	jmp    8005ee <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8005e0:	83 ec 08             	sub    $0x8,%esp
+  8005e3:	53                   	push   %ebx
+  8005e4:	57                   	push   %edi
+  8005e5:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005e8:	83 ee 01             	sub    $0x1,%esi
+  8005eb:	83 c4 10             	add    $0x10,%esp
+  8005ee:	85 f6                	test   %esi,%esi
+  8005f0:	7f ee                	jg     8005e0 <vprintfmt+0x1cc>
+  8005f2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005f5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005f8:	85 c0                	test   %eax,%eax
+  8005fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ff:	0f 49 d0             	cmovns %eax,%edx
+  800602:	29 d0                	sub    %edx,%eax
+  800604:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800607:	eb a6                	jmp    8005af <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800609:	83 ec 08             	sub    $0x8,%esp
+  80060c:	53                   	push   %ebx
+  80060d:	52                   	push   %edx
+  80060e:	ff 55 08             	call   *0x8(%ebp)
+  800611:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800614:	89 f1                	mov    %esi,%ecx
+  800616:	8d 71 01             	lea    0x1(%ecx),%esi
+  800619:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80061d:	0f be d0             	movsbl %al,%edx
+  800620:	85 d2                	test   %edx,%edx
+  800622:	74 28                	je     80064c <vprintfmt+0x238>
+  800624:	85 ff                	test   %edi,%edi
+  800626:	78 05                	js     80062d <vprintfmt+0x219>
+  800628:	83 ef 01             	sub    $0x1,%edi
+  80062b:	78 30                	js     80065d <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80062d:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800631:	74 d6                	je     800609 <vprintfmt+0x1f5>
+  800633:	0f be c0             	movsbl %al,%eax
+  800636:	83 e8 20             	sub    $0x20,%eax
+  800639:	83 f8 5e             	cmp    $0x5e,%eax
+  80063c:	76 cb                	jbe    800609 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80063e:	83 ec 08             	sub    $0x8,%esp
+  800641:	53                   	push   %ebx
+  800642:	6a 3f                	push   $0x3f
+  800644:	ff 55 08             	call   *0x8(%ebp)
+  800647:	83 c4 10             	add    $0x10,%esp
+  80064a:	eb c8                	jmp    800614 <vprintfmt+0x200>
+  80064c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80064f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800652:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800655:	01 d0                	add    %edx,%eax
+  800657:	29 c8                	sub    %ecx,%eax
+  800659:	89 c7                	mov    %eax,%edi
+  80065b:	eb 13                	jmp    800670 <vprintfmt+0x25c>
+  80065d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800660:	eb ed                	jmp    80064f <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800662:	83 ec 08             	sub    $0x8,%esp
+  800665:	53                   	push   %ebx
+  800666:	6a 20                	push   $0x20
+  800668:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80066a:	83 ef 01             	sub    $0x1,%edi
+  80066d:	83 c4 10             	add    $0x10,%esp
+  800670:	85 ff                	test   %edi,%edi
+  800672:	7f ee                	jg     800662 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800674:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800677:	89 45 14             	mov    %eax,0x14(%ebp)
+  80067a:	e9 6b 01 00 00       	jmp    8007ea <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80067f:	83 f9 01             	cmp    $0x1,%ecx
+  800682:	7f 1f                	jg     8006a3 <vprintfmt+0x28f>
+	else if (lflag)
+  800684:	85 c9                	test   %ecx,%ecx
+  800686:	74 67                	je     8006ef <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800688:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068b:	8b 00                	mov    (%eax),%eax
+  80068d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800690:	89 c1                	mov    %eax,%ecx
+  800692:	c1 f9 1f             	sar    $0x1f,%ecx
+  800695:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800698:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069b:	8d 40 04             	lea    0x4(%eax),%eax
+  80069e:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006a1:	eb 17                	jmp    8006ba <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8006a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a6:	8b 50 04             	mov    0x4(%eax),%edx
+  8006a9:	8b 00                	mov    (%eax),%eax
+  8006ab:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006ae:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b4:	8d 40 08             	lea    0x8(%eax),%eax
+  8006b7:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006ba:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006bd:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8006c0:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8006c5:	85 c9                	test   %ecx,%ecx
+  8006c7:	0f 89 03 01 00 00    	jns    8007d0 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8006cd:	83 ec 08             	sub    $0x8,%esp
+  8006d0:	53                   	push   %ebx
+  8006d1:	6a 2d                	push   $0x2d
+  8006d3:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8006d5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006d8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006db:	f7 da                	neg    %edx
+  8006dd:	83 d1 00             	adc    $0x0,%ecx
+  8006e0:	f7 d9                	neg    %ecx
+  8006e2:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006e5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006ea:	e9 e1 00 00 00       	jmp    8007d0 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8006ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f2:	8b 00                	mov    (%eax),%eax
+  8006f4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006f7:	89 c1                	mov    %eax,%ecx
+  8006f9:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006fc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800702:	8d 40 04             	lea    0x4(%eax),%eax
+  800705:	89 45 14             	mov    %eax,0x14(%ebp)
+  800708:	eb b0                	jmp    8006ba <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80070a:	83 f9 01             	cmp    $0x1,%ecx
+  80070d:	7f 1e                	jg     80072d <vprintfmt+0x319>
+	else if (lflag)
+  80070f:	85 c9                	test   %ecx,%ecx
+  800711:	74 32                	je     800745 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800713:	8b 45 14             	mov    0x14(%ebp),%eax
+  800716:	8b 10                	mov    (%eax),%edx
+  800718:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80071d:	8d 40 04             	lea    0x4(%eax),%eax
+  800720:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800723:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800728:	e9 a3 00 00 00       	jmp    8007d0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80072d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800730:	8b 10                	mov    (%eax),%edx
+  800732:	8b 48 04             	mov    0x4(%eax),%ecx
+  800735:	8d 40 08             	lea    0x8(%eax),%eax
+  800738:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80073b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800740:	e9 8b 00 00 00       	jmp    8007d0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800745:	8b 45 14             	mov    0x14(%ebp),%eax
+  800748:	8b 10                	mov    (%eax),%edx
+  80074a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80074f:	8d 40 04             	lea    0x4(%eax),%eax
+  800752:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800755:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80075a:	eb 74                	jmp    8007d0 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  80075c:	83 f9 01             	cmp    $0x1,%ecx
+  80075f:	7f 1b                	jg     80077c <vprintfmt+0x368>
+	else if (lflag)
+  800761:	85 c9                	test   %ecx,%ecx
+  800763:	74 2c                	je     800791 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800765:	8b 45 14             	mov    0x14(%ebp),%eax
+  800768:	8b 10                	mov    (%eax),%edx
+  80076a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80076f:	8d 40 04             	lea    0x4(%eax),%eax
+  800772:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800775:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80077a:	eb 54                	jmp    8007d0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80077c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077f:	8b 10                	mov    (%eax),%edx
+  800781:	8b 48 04             	mov    0x4(%eax),%ecx
+  800784:	8d 40 08             	lea    0x8(%eax),%eax
+  800787:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80078a:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80078f:	eb 3f                	jmp    8007d0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800791:	8b 45 14             	mov    0x14(%ebp),%eax
+  800794:	8b 10                	mov    (%eax),%edx
+  800796:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80079b:	8d 40 04             	lea    0x4(%eax),%eax
+  80079e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007a1:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8007a6:	eb 28                	jmp    8007d0 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8007a8:	83 ec 08             	sub    $0x8,%esp
+  8007ab:	53                   	push   %ebx
+  8007ac:	6a 30                	push   $0x30
+  8007ae:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8007b0:	83 c4 08             	add    $0x8,%esp
+  8007b3:	53                   	push   %ebx
+  8007b4:	6a 78                	push   $0x78
+  8007b6:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8007b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007bb:	8b 10                	mov    (%eax),%edx
+  8007bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007c2:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007c5:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007cb:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8007d0:	83 ec 0c             	sub    $0xc,%esp
+  8007d3:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8007d7:	50                   	push   %eax
+  8007d8:	ff 75 e0             	push   -0x20(%ebp)
+  8007db:	57                   	push   %edi
+  8007dc:	51                   	push   %ecx
+  8007dd:	52                   	push   %edx
+  8007de:	89 da                	mov    %ebx,%edx
+  8007e0:	89 f0                	mov    %esi,%eax
+  8007e2:	e8 4a fb ff ff       	call   800331 <printnum>
+			break;
+  8007e7:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8007ea:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8007ed:	e9 40 fc ff ff       	jmp    800432 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8007f2:	83 f9 01             	cmp    $0x1,%ecx
+  8007f5:	7f 1b                	jg     800812 <vprintfmt+0x3fe>
+	else if (lflag)
+  8007f7:	85 c9                	test   %ecx,%ecx
+  8007f9:	74 2c                	je     800827 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8007fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007fe:	8b 10                	mov    (%eax),%edx
+  800800:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800805:	8d 40 04             	lea    0x4(%eax),%eax
+  800808:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80080b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800810:	eb be                	jmp    8007d0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800812:	8b 45 14             	mov    0x14(%ebp),%eax
+  800815:	8b 10                	mov    (%eax),%edx
+  800817:	8b 48 04             	mov    0x4(%eax),%ecx
+  80081a:	8d 40 08             	lea    0x8(%eax),%eax
+  80081d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800820:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800825:	eb a9                	jmp    8007d0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800827:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082a:	8b 10                	mov    (%eax),%edx
+  80082c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800831:	8d 40 04             	lea    0x4(%eax),%eax
+  800834:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800837:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80083c:	eb 92                	jmp    8007d0 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  80083e:	83 ec 08             	sub    $0x8,%esp
+  800841:	53                   	push   %ebx
+  800842:	6a 25                	push   $0x25
+  800844:	ff d6                	call   *%esi
+			break;
+  800846:	83 c4 10             	add    $0x10,%esp
+  800849:	eb 9f                	jmp    8007ea <vprintfmt+0x3d6>
+			putch('%', putdat);
+  80084b:	83 ec 08             	sub    $0x8,%esp
+  80084e:	53                   	push   %ebx
+  80084f:	6a 25                	push   $0x25
+  800851:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800853:	83 c4 10             	add    $0x10,%esp
+  800856:	89 f8                	mov    %edi,%eax
+  800858:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80085c:	74 05                	je     800863 <vprintfmt+0x44f>
+  80085e:	83 e8 01             	sub    $0x1,%eax
+  800861:	eb f5                	jmp    800858 <vprintfmt+0x444>
+  800863:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800866:	eb 82                	jmp    8007ea <vprintfmt+0x3d6>
+
+00800868 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800868:	55                   	push   %ebp
+  800869:	89 e5                	mov    %esp,%ebp
+  80086b:	83 ec 18             	sub    $0x18,%esp
+  80086e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800871:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800874:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800877:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80087b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80087e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800885:	85 c0                	test   %eax,%eax
+  800887:	74 26                	je     8008af <vsnprintf+0x47>
+  800889:	85 d2                	test   %edx,%edx
+  80088b:	7e 22                	jle    8008af <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80088d:	ff 75 14             	push   0x14(%ebp)
+  800890:	ff 75 10             	push   0x10(%ebp)
+  800893:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800896:	50                   	push   %eax
+  800897:	68 da 03 80 00       	push   $0x8003da
+  80089c:	e8 73 fb ff ff       	call   800414 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008a1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008a4:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008aa:	83 c4 10             	add    $0x10,%esp
+}
+  8008ad:	c9                   	leave
+  8008ae:	c3                   	ret
+		return -E_INVAL;
+  8008af:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008b4:	eb f7                	jmp    8008ad <vsnprintf+0x45>
+
+008008b6 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008b6:	55                   	push   %ebp
+  8008b7:	89 e5                	mov    %esp,%ebp
+  8008b9:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8008bc:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008bf:	50                   	push   %eax
+  8008c0:	ff 75 10             	push   0x10(%ebp)
+  8008c3:	ff 75 0c             	push   0xc(%ebp)
+  8008c6:	ff 75 08             	push   0x8(%ebp)
+  8008c9:	e8 9a ff ff ff       	call   800868 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008ce:	c9                   	leave
+  8008cf:	c3                   	ret
+
+008008d0 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008d0:	55                   	push   %ebp
+  8008d1:	89 e5                	mov    %esp,%ebp
+  8008d3:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008db:	eb 03                	jmp    8008e0 <strlen+0x10>
+		n++;
+  8008dd:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008e0:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008e4:	75 f7                	jne    8008dd <strlen+0xd>
+	return n;
+}
+  8008e6:	5d                   	pop    %ebp
+  8008e7:	c3                   	ret
+
+008008e8 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008e8:	55                   	push   %ebp
+  8008e9:	89 e5                	mov    %esp,%ebp
+  8008eb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008ee:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f6:	eb 03                	jmp    8008fb <strnlen+0x13>
+		n++;
+  8008f8:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008fb:	39 d0                	cmp    %edx,%eax
+  8008fd:	74 08                	je     800907 <strnlen+0x1f>
+  8008ff:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800903:	75 f3                	jne    8008f8 <strnlen+0x10>
+  800905:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800907:	89 d0                	mov    %edx,%eax
+  800909:	5d                   	pop    %ebp
+  80090a:	c3                   	ret
+
+0080090b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80090b:	55                   	push   %ebp
+  80090c:	89 e5                	mov    %esp,%ebp
+  80090e:	53                   	push   %ebx
+  80090f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800912:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800915:	b8 00 00 00 00       	mov    $0x0,%eax
+  80091a:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80091e:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800921:	83 c0 01             	add    $0x1,%eax
+  800924:	84 d2                	test   %dl,%dl
+  800926:	75 f2                	jne    80091a <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800928:	89 c8                	mov    %ecx,%eax
+  80092a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80092d:	c9                   	leave
+  80092e:	c3                   	ret
+
+0080092f <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80092f:	55                   	push   %ebp
+  800930:	89 e5                	mov    %esp,%ebp
+  800932:	53                   	push   %ebx
+  800933:	83 ec 10             	sub    $0x10,%esp
+  800936:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800939:	53                   	push   %ebx
+  80093a:	e8 91 ff ff ff       	call   8008d0 <strlen>
+  80093f:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800942:	ff 75 0c             	push   0xc(%ebp)
+  800945:	01 d8                	add    %ebx,%eax
+  800947:	50                   	push   %eax
+  800948:	e8 be ff ff ff       	call   80090b <strcpy>
+	return dst;
+}
+  80094d:	89 d8                	mov    %ebx,%eax
+  80094f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800952:	c9                   	leave
+  800953:	c3                   	ret
+
+00800954 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800954:	55                   	push   %ebp
+  800955:	89 e5                	mov    %esp,%ebp
+  800957:	56                   	push   %esi
+  800958:	53                   	push   %ebx
+  800959:	8b 75 08             	mov    0x8(%ebp),%esi
+  80095c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80095f:	89 f3                	mov    %esi,%ebx
+  800961:	03 5d 10             	add    0x10(%ebp),%ebx
+  800964:	89 f0                	mov    %esi,%eax
+  800966:	eb 0f                	jmp    800977 <strncpy+0x23>
+		*dst++ = *src;
+  800968:	83 c0 01             	add    $0x1,%eax
+  80096b:	0f b6 0a             	movzbl (%edx),%ecx
+  80096e:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800971:	80 f9 01             	cmp    $0x1,%cl
+  800974:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800977:	39 d8                	cmp    %ebx,%eax
+  800979:	75 ed                	jne    800968 <strncpy+0x14>
+	}
+	return ret;
+}
+  80097b:	89 f0                	mov    %esi,%eax
+  80097d:	5b                   	pop    %ebx
+  80097e:	5e                   	pop    %esi
+  80097f:	5d                   	pop    %ebp
+  800980:	c3                   	ret
+
+00800981 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800981:	55                   	push   %ebp
+  800982:	89 e5                	mov    %esp,%ebp
+  800984:	56                   	push   %esi
+  800985:	53                   	push   %ebx
+  800986:	8b 75 08             	mov    0x8(%ebp),%esi
+  800989:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80098c:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80098f:	89 f0                	mov    %esi,%eax
+  800991:	85 d2                	test   %edx,%edx
+  800993:	74 21                	je     8009b6 <strlcpy+0x35>
+  800995:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800999:	89 f2                	mov    %esi,%edx
+  80099b:	eb 09                	jmp    8009a6 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80099d:	83 c1 01             	add    $0x1,%ecx
+  8009a0:	83 c2 01             	add    $0x1,%edx
+  8009a3:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8009a6:	39 c2                	cmp    %eax,%edx
+  8009a8:	74 09                	je     8009b3 <strlcpy+0x32>
+  8009aa:	0f b6 19             	movzbl (%ecx),%ebx
+  8009ad:	84 db                	test   %bl,%bl
+  8009af:	75 ec                	jne    80099d <strlcpy+0x1c>
+  8009b1:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8009b3:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009b6:	29 f0                	sub    %esi,%eax
+}
+  8009b8:	5b                   	pop    %ebx
+  8009b9:	5e                   	pop    %esi
+  8009ba:	5d                   	pop    %ebp
+  8009bb:	c3                   	ret
+
+008009bc <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009bc:	55                   	push   %ebp
+  8009bd:	89 e5                	mov    %esp,%ebp
+  8009bf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009c2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009c5:	eb 06                	jmp    8009cd <strcmp+0x11>
+		p++, q++;
+  8009c7:	83 c1 01             	add    $0x1,%ecx
+  8009ca:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009cd:	0f b6 01             	movzbl (%ecx),%eax
+  8009d0:	84 c0                	test   %al,%al
+  8009d2:	74 04                	je     8009d8 <strcmp+0x1c>
+  8009d4:	3a 02                	cmp    (%edx),%al
+  8009d6:	74 ef                	je     8009c7 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009d8:	0f b6 c0             	movzbl %al,%eax
+  8009db:	0f b6 12             	movzbl (%edx),%edx
+  8009de:	29 d0                	sub    %edx,%eax
+}
+  8009e0:	5d                   	pop    %ebp
+  8009e1:	c3                   	ret
+
+008009e2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009e2:	55                   	push   %ebp
+  8009e3:	89 e5                	mov    %esp,%ebp
+  8009e5:	53                   	push   %ebx
+  8009e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009ec:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009ef:	eb 09                	jmp    8009fa <strncmp+0x18>
+		n--, p++, q++;
+  8009f1:	83 ea 01             	sub    $0x1,%edx
+  8009f4:	83 c0 01             	add    $0x1,%eax
+  8009f7:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009fa:	85 d2                	test   %edx,%edx
+  8009fc:	74 18                	je     800a16 <strncmp+0x34>
+  8009fe:	0f b6 18             	movzbl (%eax),%ebx
+  800a01:	84 db                	test   %bl,%bl
+  800a03:	74 04                	je     800a09 <strncmp+0x27>
+  800a05:	3a 19                	cmp    (%ecx),%bl
+  800a07:	74 e8                	je     8009f1 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a09:	0f b6 00             	movzbl (%eax),%eax
+  800a0c:	0f b6 11             	movzbl (%ecx),%edx
+  800a0f:	29 d0                	sub    %edx,%eax
+}
+  800a11:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a14:	c9                   	leave
+  800a15:	c3                   	ret
+		return 0;
+  800a16:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a1b:	eb f4                	jmp    800a11 <strncmp+0x2f>
+
+00800a1d <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a1d:	55                   	push   %ebp
+  800a1e:	89 e5                	mov    %esp,%ebp
+  800a20:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a23:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a27:	eb 03                	jmp    800a2c <strchr+0xf>
+  800a29:	83 c0 01             	add    $0x1,%eax
+  800a2c:	0f b6 10             	movzbl (%eax),%edx
+  800a2f:	84 d2                	test   %dl,%dl
+  800a31:	74 06                	je     800a39 <strchr+0x1c>
+		if (*s == c)
+  800a33:	38 ca                	cmp    %cl,%dl
+  800a35:	75 f2                	jne    800a29 <strchr+0xc>
+  800a37:	eb 05                	jmp    800a3e <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a39:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a3e:	5d                   	pop    %ebp
+  800a3f:	c3                   	ret
+
+00800a40 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a40:	55                   	push   %ebp
+  800a41:	89 e5                	mov    %esp,%ebp
+  800a43:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a46:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a4a:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a4d:	38 ca                	cmp    %cl,%dl
+  800a4f:	74 09                	je     800a5a <strfind+0x1a>
+  800a51:	84 d2                	test   %dl,%dl
+  800a53:	74 05                	je     800a5a <strfind+0x1a>
+	for (; *s; s++)
+  800a55:	83 c0 01             	add    $0x1,%eax
+  800a58:	eb f0                	jmp    800a4a <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a5a:	5d                   	pop    %ebp
+  800a5b:	c3                   	ret
+
+00800a5c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a5c:	55                   	push   %ebp
+  800a5d:	89 e5                	mov    %esp,%ebp
+  800a5f:	57                   	push   %edi
+  800a60:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a63:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a66:	85 c9                	test   %ecx,%ecx
+  800a68:	74 20                	je     800a8a <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a6a:	89 f8                	mov    %edi,%eax
+  800a6c:	09 c8                	or     %ecx,%eax
+  800a6e:	a8 03                	test   $0x3,%al
+  800a70:	75 12                	jne    800a84 <memset+0x28>
+		c &= 0xFF;
+  800a72:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a76:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a7c:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a7f:	fc                   	cld
+  800a80:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a82:	eb 06                	jmp    800a8a <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a84:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a87:	fc                   	cld
+  800a88:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a8a:	89 f8                	mov    %edi,%eax
+  800a8c:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a8f:	c9                   	leave
+  800a90:	c3                   	ret
+
+00800a91 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a91:	55                   	push   %ebp
+  800a92:	89 e5                	mov    %esp,%ebp
+  800a94:	57                   	push   %edi
+  800a95:	56                   	push   %esi
+  800a96:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a99:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a9c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a9f:	39 c6                	cmp    %eax,%esi
+  800aa1:	73 32                	jae    800ad5 <memmove+0x44>
+  800aa3:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800aa6:	39 d0                	cmp    %edx,%eax
+  800aa8:	73 2b                	jae    800ad5 <memmove+0x44>
+		s += n;
+		d += n;
+  800aaa:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800aad:	89 d6                	mov    %edx,%esi
+  800aaf:	09 fe                	or     %edi,%esi
+  800ab1:	09 ce                	or     %ecx,%esi
+  800ab3:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ab9:	75 0e                	jne    800ac9 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800abb:	83 ef 04             	sub    $0x4,%edi
+  800abe:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ac1:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ac4:	fd                   	std
+  800ac5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ac7:	eb 09                	jmp    800ad2 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ac9:	83 ef 01             	sub    $0x1,%edi
+  800acc:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800acf:	fd                   	std
+  800ad0:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ad2:	fc                   	cld
+  800ad3:	eb 1a                	jmp    800aef <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ad5:	89 f2                	mov    %esi,%edx
+  800ad7:	09 c2                	or     %eax,%edx
+  800ad9:	09 ca                	or     %ecx,%edx
+  800adb:	f6 c2 03             	test   $0x3,%dl
+  800ade:	75 0a                	jne    800aea <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800ae0:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800ae3:	89 c7                	mov    %eax,%edi
+  800ae5:	fc                   	cld
+  800ae6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ae8:	eb 05                	jmp    800aef <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800aea:	89 c7                	mov    %eax,%edi
+  800aec:	fc                   	cld
+  800aed:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800aef:	5e                   	pop    %esi
+  800af0:	5f                   	pop    %edi
+  800af1:	5d                   	pop    %ebp
+  800af2:	c3                   	ret
+
+00800af3 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800af3:	55                   	push   %ebp
+  800af4:	89 e5                	mov    %esp,%ebp
+  800af6:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800af9:	ff 75 10             	push   0x10(%ebp)
+  800afc:	ff 75 0c             	push   0xc(%ebp)
+  800aff:	ff 75 08             	push   0x8(%ebp)
+  800b02:	e8 8a ff ff ff       	call   800a91 <memmove>
+}
+  800b07:	c9                   	leave
+  800b08:	c3                   	ret
+
+00800b09 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b09:	55                   	push   %ebp
+  800b0a:	89 e5                	mov    %esp,%ebp
+  800b0c:	56                   	push   %esi
+  800b0d:	53                   	push   %ebx
+  800b0e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b11:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b14:	89 c6                	mov    %eax,%esi
+  800b16:	03 75 10             	add    0x10(%ebp),%esi
+  800b19:	eb 06                	jmp    800b21 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b1b:	83 c0 01             	add    $0x1,%eax
+  800b1e:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b21:	39 f0                	cmp    %esi,%eax
+  800b23:	74 14                	je     800b39 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b25:	0f b6 08             	movzbl (%eax),%ecx
+  800b28:	0f b6 1a             	movzbl (%edx),%ebx
+  800b2b:	38 d9                	cmp    %bl,%cl
+  800b2d:	74 ec                	je     800b1b <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b2f:	0f b6 c1             	movzbl %cl,%eax
+  800b32:	0f b6 db             	movzbl %bl,%ebx
+  800b35:	29 d8                	sub    %ebx,%eax
+  800b37:	eb 05                	jmp    800b3e <memcmp+0x35>
+	}
+
+	return 0;
+  800b39:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b3e:	5b                   	pop    %ebx
+  800b3f:	5e                   	pop    %esi
+  800b40:	5d                   	pop    %ebp
+  800b41:	c3                   	ret
+
+00800b42 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b42:	55                   	push   %ebp
+  800b43:	89 e5                	mov    %esp,%ebp
+  800b45:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b48:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b4b:	89 c2                	mov    %eax,%edx
+  800b4d:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b50:	eb 03                	jmp    800b55 <memfind+0x13>
+  800b52:	83 c0 01             	add    $0x1,%eax
+  800b55:	39 d0                	cmp    %edx,%eax
+  800b57:	73 04                	jae    800b5d <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b59:	38 08                	cmp    %cl,(%eax)
+  800b5b:	75 f5                	jne    800b52 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b5d:	5d                   	pop    %ebp
+  800b5e:	c3                   	ret
+
+00800b5f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b5f:	55                   	push   %ebp
+  800b60:	89 e5                	mov    %esp,%ebp
+  800b62:	57                   	push   %edi
+  800b63:	56                   	push   %esi
+  800b64:	53                   	push   %ebx
+  800b65:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b68:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b6b:	eb 03                	jmp    800b70 <strtol+0x11>
+		s++;
+  800b6d:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b70:	0f b6 02             	movzbl (%edx),%eax
+  800b73:	3c 20                	cmp    $0x20,%al
+  800b75:	74 f6                	je     800b6d <strtol+0xe>
+  800b77:	3c 09                	cmp    $0x9,%al
+  800b79:	74 f2                	je     800b6d <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b7b:	3c 2b                	cmp    $0x2b,%al
+  800b7d:	74 2a                	je     800ba9 <strtol+0x4a>
+	int neg = 0;
+  800b7f:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b84:	3c 2d                	cmp    $0x2d,%al
+  800b86:	74 2b                	je     800bb3 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b88:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b8e:	75 0f                	jne    800b9f <strtol+0x40>
+  800b90:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b93:	74 28                	je     800bbd <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b95:	85 db                	test   %ebx,%ebx
+  800b97:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b9c:	0f 44 d8             	cmove  %eax,%ebx
+  800b9f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ba4:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ba7:	eb 46                	jmp    800bef <strtol+0x90>
+		s++;
+  800ba9:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800bac:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bb1:	eb d5                	jmp    800b88 <strtol+0x29>
+		s++, neg = 1;
+  800bb3:	83 c2 01             	add    $0x1,%edx
+  800bb6:	bf 01 00 00 00       	mov    $0x1,%edi
+  800bbb:	eb cb                	jmp    800b88 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bbd:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800bc1:	74 0e                	je     800bd1 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800bc3:	85 db                	test   %ebx,%ebx
+  800bc5:	75 d8                	jne    800b9f <strtol+0x40>
+		s++, base = 8;
+  800bc7:	83 c2 01             	add    $0x1,%edx
+  800bca:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bcf:	eb ce                	jmp    800b9f <strtol+0x40>
+		s += 2, base = 16;
+  800bd1:	83 c2 02             	add    $0x2,%edx
+  800bd4:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bd9:	eb c4                	jmp    800b9f <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800bdb:	0f be c0             	movsbl %al,%eax
+  800bde:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800be1:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800be4:	7d 3a                	jge    800c20 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800be6:	83 c2 01             	add    $0x1,%edx
+  800be9:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bed:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800bef:	0f b6 02             	movzbl (%edx),%eax
+  800bf2:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bf5:	89 f3                	mov    %esi,%ebx
+  800bf7:	80 fb 09             	cmp    $0x9,%bl
+  800bfa:	76 df                	jbe    800bdb <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800bfc:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bff:	89 f3                	mov    %esi,%ebx
+  800c01:	80 fb 19             	cmp    $0x19,%bl
+  800c04:	77 08                	ja     800c0e <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800c06:	0f be c0             	movsbl %al,%eax
+  800c09:	83 e8 57             	sub    $0x57,%eax
+  800c0c:	eb d3                	jmp    800be1 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c0e:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c11:	89 f3                	mov    %esi,%ebx
+  800c13:	80 fb 19             	cmp    $0x19,%bl
+  800c16:	77 08                	ja     800c20 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800c18:	0f be c0             	movsbl %al,%eax
+  800c1b:	83 e8 37             	sub    $0x37,%eax
+  800c1e:	eb c1                	jmp    800be1 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c20:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c24:	74 05                	je     800c2b <strtol+0xcc>
+		*endptr = (char *) s;
+  800c26:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c29:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c2b:	89 c8                	mov    %ecx,%eax
+  800c2d:	f7 d8                	neg    %eax
+  800c2f:	85 ff                	test   %edi,%edi
+  800c31:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c34:	89 c8                	mov    %ecx,%eax
+  800c36:	5b                   	pop    %ebx
+  800c37:	5e                   	pop    %esi
+  800c38:	5f                   	pop    %edi
+  800c39:	5d                   	pop    %ebp
+  800c3a:	c3                   	ret
+
+00800c3b <atoi>:
+
+int
+atoi(const char *s)
+{
+  800c3b:	55                   	push   %ebp
+  800c3c:	89 e5                	mov    %esp,%ebp
+  800c3e:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800c41:	6a 0a                	push   $0xa
+  800c43:	6a 00                	push   $0x0
+  800c45:	ff 75 08             	push   0x8(%ebp)
+  800c48:	e8 12 ff ff ff       	call   800b5f <strtol>
+}
+  800c4d:	c9                   	leave
+  800c4e:	c3                   	ret
+
+00800c4f <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800c4f:	55                   	push   %ebp
+  800c50:	89 e5                	mov    %esp,%ebp
+  800c52:	57                   	push   %edi
+  800c53:	56                   	push   %esi
+  800c54:	53                   	push   %ebx
+  800c55:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800c5b:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800c61:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800c67:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800c6d:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800c74:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800c77:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800c7e:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800c81:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800c88:	74 76                	je     800d00 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800c8a:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800c90:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c93:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800c99:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800ca0:	0f 88 06 01 00 00    	js     800dac <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800ca6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800cad:	0f 84 48 01 00 00    	je     800dfb <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800cb3:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800cb9:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800cbf:	be 00 00 00 00       	mov    $0x0,%esi
+  800cc4:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800cca:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ccd:	55                   	push   %ebp
+  800cce:	68 d7 0c 80 00       	push   $0x800cd7
+  800cd3:	89 e5                	mov    %esp,%ebp
+  800cd5:	0f 34                	sysenter
+  800cd7:	83 c4 04             	add    $0x4,%esp
+  800cda:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800cdb:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800ce1:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800ce7:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800cea:	0f 85 9a 01 00 00    	jne    800e8a <page_vec_call+0x23b>
+  800cf0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cf5:	8b 75 08             	mov    0x8(%ebp),%esi
+  800cf8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cfb:	e9 29 01 00 00       	jmp    800e29 <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800d00:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800d06:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d09:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800d0b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800d12:	78 2f                	js     800d43 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800d14:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800d1b:	74 72                	je     800d8f <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800d1d:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800d23:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800d29:	b8 10 00 00 00       	mov    $0x10,%eax
+  800d2e:	89 fb                	mov    %edi,%ebx
+  800d30:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800d33:	55                   	push   %ebp
+  800d34:	68 3d 0d 80 00       	push   $0x800d3d
+  800d39:	89 e5                	mov    %esp,%ebp
+  800d3b:	0f 34                	sysenter
+  800d3d:	83 c4 04             	add    $0x4,%esp
+  800d40:	5d                   	pop    %ebp
+	return ret;
+  800d41:	eb 98                	jmp    800cdb <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800d43:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d48:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800d4a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800d4f:	f6 c6 08             	test   $0x8,%dh
+  800d52:	74 15                	je     800d69 <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d54:	89 c2                	mov    %eax,%edx
+  800d56:	c1 ea 08             	shr    $0x8,%edx
+  800d59:	83 e2 0f             	and    $0xf,%edx
+  800d5c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d61:	83 fa 06             	cmp    $0x6,%edx
+  800d64:	74 0e                	je     800d74 <page_vec_call+0x125>
+  800d66:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800d69:	0f b6 c9             	movzbl %cl,%ecx
+  800d6c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800d72:	eb a0                	jmp    800d14 <page_vec_call+0xc5>
+  800d74:	89 c2                	mov    %eax,%edx
+  800d76:	c1 ea 04             	shr    $0x4,%edx
+  800d79:	83 e2 0f             	and    $0xf,%edx
+  800d7c:	83 fa 02             	cmp    $0x2,%edx
+  800d7f:	77 e5                	ja     800d66 <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800d81:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d84:	83 f8 02             	cmp    $0x2,%eax
+  800d87:	0f 97 c1             	seta   %cl
+  800d8a:	0f b6 c9             	movzbl %cl,%ecx
+  800d8d:	eb d7                	jmp    800d66 <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800d8f:	b8 10 00 00 00       	mov    $0x10,%eax
+  800d94:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800d9a:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800da0:	89 fb                	mov    %edi,%ebx
+  800da2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800da5:	cd 30                	int    $0x30
+  800da7:	e9 2f ff ff ff       	jmp    800cdb <page_vec_call+0x8c>
+  800dac:	b8 01 00 00 00       	mov    $0x1,%eax
+  800db1:	0f a2                	cpuid
+		return 0;
+  800db3:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800db8:	f6 c6 08             	test   $0x8,%dh
+  800dbb:	74 15                	je     800dd2 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800dbd:	89 c2                	mov    %eax,%edx
+  800dbf:	c1 ea 08             	shr    $0x8,%edx
+  800dc2:	83 e2 0f             	and    $0xf,%edx
+  800dc5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800dca:	83 fa 06             	cmp    $0x6,%edx
+  800dcd:	74 11                	je     800de0 <page_vec_call+0x191>
+  800dcf:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800dd2:	0f b6 c9             	movzbl %cl,%ecx
+  800dd5:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800ddb:	e9 c6 fe ff ff       	jmp    800ca6 <page_vec_call+0x57>
+  800de0:	89 c2                	mov    %eax,%edx
+  800de2:	c1 ea 04             	shr    $0x4,%edx
+  800de5:	83 e2 0f             	and    $0xf,%edx
+  800de8:	83 fa 02             	cmp    $0x2,%edx
+  800deb:	77 e2                	ja     800dcf <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800ded:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800df0:	83 f8 02             	cmp    $0x2,%eax
+  800df3:	0f 97 c1             	seta   %cl
+  800df6:	0f b6 c9             	movzbl %cl,%ecx
+  800df9:	eb d4                	jmp    800dcf <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800dfb:	be 00 00 00 00       	mov    $0x0,%esi
+  800e00:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800e06:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800e0c:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800e12:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800e15:	cd 30                	int    $0x30
+  800e17:	e9 bf fe ff ff       	jmp    800cdb <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800e1c:	29 da                	sub    %ebx,%edx
+			vec++;
+  800e1e:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800e21:	83 e8 01             	sub    $0x1,%eax
+  800e24:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800e29:	85 c0                	test   %eax,%eax
+  800e2b:	74 58                	je     800e85 <page_vec_call+0x236>
+  800e2d:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800e30:	39 da                	cmp    %ebx,%edx
+  800e32:	73 e8                	jae    800e1c <page_vec_call+0x1cd>
+  800e34:	89 75 08             	mov    %esi,0x8(%ebp)
+  800e37:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800e3a:	84 c9                	test   %cl,%cl
+  800e3c:	74 06                	je     800e44 <page_vec_call+0x1f5>
+  800e3e:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800e44:	83 ec 04             	sub    $0x4,%esp
+  800e47:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e4a:	c1 e0 04             	shl    $0x4,%eax
+  800e4d:	50                   	push   %eax
+  800e4e:	ff 75 08             	push   0x8(%ebp)
+  800e51:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800e57:	53                   	push   %ebx
+  800e58:	e8 34 fc ff ff       	call   800a91 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800e5d:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800e63:	89 c2                	mov    %eax,%edx
+  800e65:	c1 e2 0c             	shl    $0xc,%edx
+  800e68:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  800e6e:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  800e74:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  800e7a:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  800e7d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  800e80:	e9 f2 fd ff ff       	jmp    800c77 <page_vec_call+0x28>
+			r = 0;
+  800e85:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  800e8a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800e8e:	74 0b                	je     800e9b <page_vec_call+0x24c>
+		*done = total;
+  800e90:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800e93:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  800e99:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  800e9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e9e:	5b                   	pop    %ebx
+  800e9f:	5e                   	pop    %esi
+  800ea0:	5f                   	pop    %edi
+  800ea1:	5d                   	pop    %ebp
+  800ea2:	c3                   	ret
+
+00800ea3 <sys_cputs>:
+{
+  800ea3:	55                   	push   %ebp
+  800ea4:	89 e5                	mov    %esp,%ebp
+  800ea6:	57                   	push   %edi
+  800ea7:	56                   	push   %esi
+  800ea8:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800ea9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800eb0:	78 2d                	js     800edf <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800eb2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800eb9:	74 70                	je     800f2b <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800ebb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ec0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec6:	89 c3                	mov    %eax,%ebx
+  800ec8:	89 c7                	mov    %eax,%edi
+  800eca:	89 c6                	mov    %eax,%esi
+  800ecc:	55                   	push   %ebp
+  800ecd:	68 d6 0e 80 00       	push   $0x800ed6
+  800ed2:	89 e5                	mov    %esp,%ebp
+  800ed4:	0f 34                	sysenter
+  800ed6:	83 c4 04             	add    $0x4,%esp
+  800ed9:	5d                   	pop    %ebp
+}
+  800eda:	5b                   	pop    %ebx
+  800edb:	5e                   	pop    %esi
+  800edc:	5f                   	pop    %edi
+  800edd:	5d                   	pop    %ebp
+  800ede:	c3                   	ret
+  800edf:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ee4:	0f a2                	cpuid
+		return 0;
+  800ee6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800eeb:	f6 c6 08             	test   $0x8,%dh
+  800eee:	74 15                	je     800f05 <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ef0:	89 c2                	mov    %eax,%edx
+  800ef2:	c1 ea 08             	shr    $0x8,%edx
+  800ef5:	83 e2 0f             	and    $0xf,%edx
+  800ef8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800efd:	83 fa 06             	cmp    $0x6,%edx
+  800f00:	74 0e                	je     800f10 <sys_cputs+0x6d>
+  800f02:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f05:	0f b6 c9             	movzbl %cl,%ecx
+  800f08:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800f0e:	eb a2                	jmp    800eb2 <sys_cputs+0xf>
+  800f10:	89 c2                	mov    %eax,%edx
+  800f12:	c1 ea 04             	shr    $0x4,%edx
+  800f15:	83 e2 0f             	and    $0xf,%edx
+  800f18:	83 fa 02             	cmp    $0x2,%edx
+  800f1b:	77 e5                	ja     800f02 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800f1d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f20:	83 f8 02             	cmp    $0x2,%eax
+  800f23:	0f 97 c1             	seta   %cl
+  800f26:	0f b6 c9             	movzbl %cl,%ecx
+  800f29:	eb d7                	jmp    800f02 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800f2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f30:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f33:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f36:	89 c3                	mov    %eax,%ebx
+  800f38:	89 c7                	mov    %eax,%edi
+  800f3a:	89 c6                	mov    %eax,%esi
+  800f3c:	cd 30                	int    $0x30
+}
+  800f3e:	eb 9a                	jmp    800eda <sys_cputs+0x37>
+
+00800f40 <sys_cgetc>:
+{
+  800f40:	55                   	push   %ebp
+  800f41:	89 e5                	mov    %esp,%ebp
+  800f43:	57                   	push   %edi
+  800f44:	56                   	push   %esi
+  800f45:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800f46:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800f4d:	78 2e                	js     800f7d <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  800f4f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800f56:	74 71                	je     800fc9 <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  800f58:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f5d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f62:	89 d1                	mov    %edx,%ecx
+  800f64:	89 d3                	mov    %edx,%ebx
+  800f66:	89 d7                	mov    %edx,%edi
+  800f68:	89 d6                	mov    %edx,%esi
+  800f6a:	55                   	push   %ebp
+  800f6b:	68 74 0f 80 00       	push   $0x800f74
+  800f70:	89 e5                	mov    %esp,%ebp
+  800f72:	0f 34                	sysenter
+  800f74:	83 c4 04             	add    $0x4,%esp
+  800f77:	5d                   	pop    %ebp
+}
+  800f78:	5b                   	pop    %ebx
+  800f79:	5e                   	pop    %esi
+  800f7a:	5f                   	pop    %edi
+  800f7b:	5d                   	pop    %ebp
+  800f7c:	c3                   	ret
+  800f7d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f82:	0f a2                	cpuid
+		return 0;
+  800f84:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f89:	f6 c6 08             	test   $0x8,%dh
+  800f8c:	74 15                	je     800fa3 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f8e:	89 c2                	mov    %eax,%edx
+  800f90:	c1 ea 08             	shr    $0x8,%edx
+  800f93:	83 e2 0f             	and    $0xf,%edx
+  800f96:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f9b:	83 fa 06             	cmp    $0x6,%edx
+  800f9e:	74 0e                	je     800fae <sys_cgetc+0x6e>
+  800fa0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800fa3:	0f b6 c9             	movzbl %cl,%ecx
+  800fa6:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800fac:	eb a1                	jmp    800f4f <sys_cgetc+0xf>
+  800fae:	89 c2                	mov    %eax,%edx
+  800fb0:	c1 ea 04             	shr    $0x4,%edx
+  800fb3:	83 e2 0f             	and    $0xf,%edx
+  800fb6:	83 fa 02             	cmp    $0x2,%edx
+  800fb9:	77 e5                	ja     800fa0 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  800fbb:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800fbe:	83 f8 02             	cmp    $0x2,%eax
+  800fc1:	0f 97 c1             	seta   %cl
+  800fc4:	0f b6 c9             	movzbl %cl,%ecx
+  800fc7:	eb d7                	jmp    800fa0 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  800fc9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fce:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fd3:	89 d1                	mov    %edx,%ecx
+  800fd5:	89 d3                	mov    %edx,%ebx
+  800fd7:	89 d7                	mov    %edx,%edi
+  800fd9:	89 d6                	mov    %edx,%esi
+  800fdb:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800fdd:	eb 99                	jmp    800f78 <sys_cgetc+0x38>
+
+00800fdf <sys_env_destroy>:
+{
+  800fdf:	55                   	push   %ebp
+  800fe0:	89 e5                	mov    %esp,%ebp
+  800fe2:	57                   	push   %edi
+  800fe3:	56                   	push   %esi
+  800fe4:	53                   	push   %ebx
+  800fe5:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800fe8:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800fef:	78 36                	js     801027 <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  800ff1:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800ff8:	74 79                	je     801073 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  800ffa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801002:	b8 03 00 00 00       	mov    $0x3,%eax
+  801007:	89 cb                	mov    %ecx,%ebx
+  801009:	89 cf                	mov    %ecx,%edi
+  80100b:	89 ce                	mov    %ecx,%esi
+  80100d:	55                   	push   %ebp
+  80100e:	68 17 10 80 00       	push   $0x801017
+  801013:	89 e5                	mov    %esp,%ebp
+  801015:	0f 34                	sysenter
+  801017:	83 c4 04             	add    $0x4,%esp
+  80101a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80101b:	85 c0                	test   %eax,%eax
+  80101d:	7f 6b                	jg     80108a <sys_env_destroy+0xab>
+}
+  80101f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801022:	5b                   	pop    %ebx
+  801023:	5e                   	pop    %esi
+  801024:	5f                   	pop    %edi
+  801025:	5d                   	pop    %ebp
+  801026:	c3                   	ret
+  801027:	b8 01 00 00 00       	mov    $0x1,%eax
+  80102c:	0f a2                	cpuid
+		return 0;
+  80102e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801033:	f6 c6 08             	test   $0x8,%dh
+  801036:	74 15                	je     80104d <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801038:	89 c2                	mov    %eax,%edx
+  80103a:	c1 ea 08             	shr    $0x8,%edx
+  80103d:	83 e2 0f             	and    $0xf,%edx
+  801040:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801045:	83 fa 06             	cmp    $0x6,%edx
+  801048:	74 0e                	je     801058 <sys_env_destroy+0x79>
+  80104a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80104d:	0f b6 c9             	movzbl %cl,%ecx
+  801050:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801056:	eb 99                	jmp    800ff1 <sys_env_destroy+0x12>
+  801058:	89 c2                	mov    %eax,%edx
+  80105a:	c1 ea 04             	shr    $0x4,%edx
+  80105d:	83 e2 0f             	and    $0xf,%edx
+  801060:	83 fa 02             	cmp    $0x2,%edx
+  801063:	77 e5                	ja     80104a <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  801065:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801068:	83 f8 02             	cmp    $0x2,%eax
+  80106b:	0f 97 c1             	seta   %cl
+  80106e:	0f b6 c9             	movzbl %cl,%ecx
+  801071:	eb d7                	jmp    80104a <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  801073:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801078:	b8 03 00 00 00       	mov    $0x3,%eax
+  80107d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801080:	89 cb                	mov    %ecx,%ebx
+  801082:	89 cf                	mov    %ecx,%edi
+  801084:	89 ce                	mov    %ecx,%esi
+  801086:	cd 30                	int    $0x30
+  801088:	eb 91                	jmp    80101b <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80108a:	83 ec 0c             	sub    $0xc,%esp
+  80108d:	50                   	push   %eax
+  80108e:	6a 03                	push   $0x3
+  801090:	68 39 31 80 00       	push   $0x803139
+  801095:	6a 4a                	push   $0x4a
+  801097:	68 56 31 80 00       	push   $0x803156
+  80109c:	e8 68 f1 ff ff       	call   800209 <_panic>
+
+008010a1 <sys_getenvid>:
+{
+  8010a1:	55                   	push   %ebp
+  8010a2:	89 e5                	mov    %esp,%ebp
+  8010a4:	57                   	push   %edi
+  8010a5:	56                   	push   %esi
+  8010a6:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8010a7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8010ae:	78 2e                	js     8010de <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  8010b0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8010b7:	74 71                	je     80112a <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  8010b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010be:	b8 02 00 00 00       	mov    $0x2,%eax
+  8010c3:	89 d1                	mov    %edx,%ecx
+  8010c5:	89 d3                	mov    %edx,%ebx
+  8010c7:	89 d7                	mov    %edx,%edi
+  8010c9:	89 d6                	mov    %edx,%esi
+  8010cb:	55                   	push   %ebp
+  8010cc:	68 d5 10 80 00       	push   $0x8010d5
+  8010d1:	89 e5                	mov    %esp,%ebp
+  8010d3:	0f 34                	sysenter
+  8010d5:	83 c4 04             	add    $0x4,%esp
+  8010d8:	5d                   	pop    %ebp
+}
+  8010d9:	5b                   	pop    %ebx
+  8010da:	5e                   	pop    %esi
+  8010db:	5f                   	pop    %edi
+  8010dc:	5d                   	pop    %ebp
+  8010dd:	c3                   	ret
+  8010de:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010e3:	0f a2                	cpuid
+		return 0;
+  8010e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8010ea:	f6 c6 08             	test   $0x8,%dh
+  8010ed:	74 15                	je     801104 <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010ef:	89 c2                	mov    %eax,%edx
+  8010f1:	c1 ea 08             	shr    $0x8,%edx
+  8010f4:	83 e2 0f             	and    $0xf,%edx
+  8010f7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8010fc:	83 fa 06             	cmp    $0x6,%edx
+  8010ff:	74 0e                	je     80110f <sys_getenvid+0x6e>
+  801101:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801104:	0f b6 c9             	movzbl %cl,%ecx
+  801107:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80110d:	eb a1                	jmp    8010b0 <sys_getenvid+0xf>
+  80110f:	89 c2                	mov    %eax,%edx
+  801111:	c1 ea 04             	shr    $0x4,%edx
+  801114:	83 e2 0f             	and    $0xf,%edx
+  801117:	83 fa 02             	cmp    $0x2,%edx
+  80111a:	77 e5                	ja     801101 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  80111c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80111f:	83 f8 02             	cmp    $0x2,%eax
+  801122:	0f 97 c1             	seta   %cl
+  801125:	0f b6 c9             	movzbl %cl,%ecx
+  801128:	eb d7                	jmp    801101 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  80112a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80112f:	b8 02 00 00 00       	mov    $0x2,%eax
+  801134:	89 d1                	mov    %edx,%ecx
+  801136:	89 d3                	mov    %edx,%ebx
+  801138:	89 d7                	mov    %edx,%edi
+  80113a:	89 d6                	mov    %edx,%esi
+  80113c:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80113e:	eb 99                	jmp    8010d9 <sys_getenvid+0x38>
+
+00801140 <sys_page_alloc>:
+{
+  801140:	55                   	push   %ebp
+  801141:	89 e5                	mov    %esp,%ebp
+  801143:	57                   	push   %edi
+  801144:	56                   	push   %esi
+  801145:	53                   	push   %ebx
+  801146:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801149:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801150:	78 38                	js     80118a <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  801152:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801159:	74 7b                	je     8011d6 <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  80115b:	be 00 00 00 00       	mov    $0x0,%esi
+  801160:	8b 55 08             	mov    0x8(%ebp),%edx
+  801163:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801166:	b8 04 00 00 00       	mov    $0x4,%eax
+  80116b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80116e:	89 f7                	mov    %esi,%edi
+  801170:	55                   	push   %ebp
+  801171:	68 7a 11 80 00       	push   $0x80117a
+  801176:	89 e5                	mov    %esp,%ebp
+  801178:	0f 34                	sysenter
+  80117a:	83 c4 04             	add    $0x4,%esp
+  80117d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80117e:	85 c0                	test   %eax,%eax
+  801180:	7f 6d                	jg     8011ef <sys_page_alloc+0xaf>
+}
+  801182:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801185:	5b                   	pop    %ebx
+  801186:	5e                   	pop    %esi
+  801187:	5f                   	pop    %edi
+  801188:	5d                   	pop    %ebp
+  801189:	c3                   	ret
+  80118a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80118f:	0f a2                	cpuid
+		return 0;
+  801191:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801196:	f6 c6 08             	test   $0x8,%dh
+  801199:	74 15                	je     8011b0 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80119b:	89 c2                	mov    %eax,%edx
+  80119d:	c1 ea 08             	shr    $0x8,%edx
+  8011a0:	83 e2 0f             	and    $0xf,%edx
+  8011a3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011a8:	83 fa 06             	cmp    $0x6,%edx
+  8011ab:	74 0e                	je     8011bb <sys_page_alloc+0x7b>
+  8011ad:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8011b0:	0f b6 c9             	movzbl %cl,%ecx
+  8011b3:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8011b9:	eb 97                	jmp    801152 <sys_page_alloc+0x12>
+  8011bb:	89 c2                	mov    %eax,%edx
+  8011bd:	c1 ea 04             	shr    $0x4,%edx
+  8011c0:	83 e2 0f             	and    $0xf,%edx
+  8011c3:	83 fa 02             	cmp    $0x2,%edx
+  8011c6:	77 e5                	ja     8011ad <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  8011c8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011cb:	83 f8 02             	cmp    $0x2,%eax
+  8011ce:	0f 97 c1             	seta   %cl
+  8011d1:	0f b6 c9             	movzbl %cl,%ecx
+  8011d4:	eb d7                	jmp    8011ad <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  8011d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8011db:	b8 04 00 00 00       	mov    $0x4,%eax
+  8011e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011e9:	89 f7                	mov    %esi,%edi
+  8011eb:	cd 30                	int    $0x30
+  8011ed:	eb 8f                	jmp    80117e <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011ef:	83 ec 0c             	sub    $0xc,%esp
+  8011f2:	50                   	push   %eax
+  8011f3:	6a 04                	push   $0x4
+  8011f5:	68 39 31 80 00       	push   $0x803139
+  8011fa:	6a 4a                	push   $0x4a
+  8011fc:	68 56 31 80 00       	push   $0x803156
+  801201:	e8 03 f0 ff ff       	call   800209 <_panic>
+
+00801206 <sys_page_map>:
+{
+  801206:	55                   	push   %ebp
+  801207:	89 e5                	mov    %esp,%ebp
+  801209:	57                   	push   %edi
+  80120a:	56                   	push   %esi
+  80120b:	53                   	push   %ebx
+  80120c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80120f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801216:	78 37                	js     80124f <sys_page_map+0x49>
+	if (syscall_sysenter)
+  801218:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80121f:	74 7a                	je     80129b <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  801221:	8b 55 08             	mov    0x8(%ebp),%edx
+  801224:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801227:	b8 05 00 00 00       	mov    $0x5,%eax
+  80122c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80122f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801232:	8b 75 18             	mov    0x18(%ebp),%esi
+  801235:	55                   	push   %ebp
+  801236:	68 3f 12 80 00       	push   $0x80123f
+  80123b:	89 e5                	mov    %esp,%ebp
+  80123d:	0f 34                	sysenter
+  80123f:	83 c4 04             	add    $0x4,%esp
+  801242:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801243:	85 c0                	test   %eax,%eax
+  801245:	7f 6c                	jg     8012b3 <sys_page_map+0xad>
+}
+  801247:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80124a:	5b                   	pop    %ebx
+  80124b:	5e                   	pop    %esi
+  80124c:	5f                   	pop    %edi
+  80124d:	5d                   	pop    %ebp
+  80124e:	c3                   	ret
+  80124f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801254:	0f a2                	cpuid
+		return 0;
+  801256:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80125b:	f6 c6 08             	test   $0x8,%dh
+  80125e:	74 15                	je     801275 <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801260:	89 c2                	mov    %eax,%edx
+  801262:	c1 ea 08             	shr    $0x8,%edx
+  801265:	83 e2 0f             	and    $0xf,%edx
+  801268:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80126d:	83 fa 06             	cmp    $0x6,%edx
+  801270:	74 0e                	je     801280 <sys_page_map+0x7a>
+  801272:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801275:	0f b6 c9             	movzbl %cl,%ecx
+  801278:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80127e:	eb 98                	jmp    801218 <sys_page_map+0x12>
+  801280:	89 c2                	mov    %eax,%edx
+  801282:	c1 ea 04             	shr    $0x4,%edx
+  801285:	83 e2 0f             	and    $0xf,%edx
+  801288:	83 fa 02             	cmp    $0x2,%edx
+  80128b:	77 e5                	ja     801272 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  80128d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801290:	83 f8 02             	cmp    $0x2,%eax
+  801293:	0f 97 c1             	seta   %cl
+  801296:	0f b6 c9             	movzbl %cl,%ecx
+  801299:	eb d7                	jmp    801272 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  80129b:	b8 05 00 00 00       	mov    $0x5,%eax
+  8012a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012a9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012ac:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012af:	cd 30                	int    $0x30
+  8012b1:	eb 90                	jmp    801243 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012b3:	83 ec 0c             	sub    $0xc,%esp
+  8012b6:	50                   	push   %eax
+  8012b7:	6a 05                	push   $0x5
+  8012b9:	68 39 31 80 00       	push   $0x803139
+  8012be:	6a 4a                	push   $0x4a
+  8012c0:	68 56 31 80 00       	push   $0x803156
+  8012c5:	e8 3f ef ff ff       	call   800209 <_panic>
+
+008012ca <sys_page_unmap>:
+{
+  8012ca:	55                   	push   %ebp
+  8012cb:	89 e5                	mov    %esp,%ebp
+  8012cd:	57                   	push   %edi
+  8012ce:	56                   	push   %esi
+  8012cf:	53                   	push   %ebx
+  8012d0:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8012d3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8012da:	78 37                	js     801313 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  8012dc:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8012e3:	74 7a                	je     80135f <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  8012e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f0:	b8 06 00 00 00       	mov    $0x6,%eax
+  8012f5:	89 df                	mov    %ebx,%edi
+  8012f7:	89 de                	mov    %ebx,%esi
+  8012f9:	55                   	push   %ebp
+  8012fa:	68 03 13 80 00       	push   $0x801303
+  8012ff:	89 e5                	mov    %esp,%ebp
+  801301:	0f 34                	sysenter
+  801303:	83 c4 04             	add    $0x4,%esp
+  801306:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801307:	85 c0                	test   %eax,%eax
+  801309:	7f 6c                	jg     801377 <sys_page_unmap+0xad>
+}
+  80130b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80130e:	5b                   	pop    %ebx
+  80130f:	5e                   	pop    %esi
+  801310:	5f                   	pop    %edi
+  801311:	5d                   	pop    %ebp
+  801312:	c3                   	ret
+  801313:	b8 01 00 00 00       	mov    $0x1,%eax
+  801318:	0f a2                	cpuid
+		return 0;
+  80131a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80131f:	f6 c6 08             	test   $0x8,%dh
+  801322:	74 15                	je     801339 <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801324:	89 c2                	mov    %eax,%edx
+  801326:	c1 ea 08             	shr    $0x8,%edx
+  801329:	83 e2 0f             	and    $0xf,%edx
+  80132c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801331:	83 fa 06             	cmp    $0x6,%edx
+  801334:	74 0e                	je     801344 <sys_page_unmap+0x7a>
+  801336:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801339:	0f b6 c9             	movzbl %cl,%ecx
+  80133c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801342:	eb 98                	jmp    8012dc <sys_page_unmap+0x12>
+  801344:	89 c2                	mov    %eax,%edx
+  801346:	c1 ea 04             	shr    $0x4,%edx
+  801349:	83 e2 0f             	and    $0xf,%edx
+  80134c:	83 fa 02             	cmp    $0x2,%edx
+  80134f:	77 e5                	ja     801336 <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  801351:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801354:	83 f8 02             	cmp    $0x2,%eax
+  801357:	0f 97 c1             	seta   %cl
+  80135a:	0f b6 c9             	movzbl %cl,%ecx
+  80135d:	eb d7                	jmp    801336 <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  80135f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801364:	b8 06 00 00 00       	mov    $0x6,%eax
+  801369:	8b 55 08             	mov    0x8(%ebp),%edx
+  80136c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80136f:	89 df                	mov    %ebx,%edi
+  801371:	89 de                	mov    %ebx,%esi
+  801373:	cd 30                	int    $0x30
+  801375:	eb 90                	jmp    801307 <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801377:	83 ec 0c             	sub    $0xc,%esp
+  80137a:	50                   	push   %eax
+  80137b:	6a 06                	push   $0x6
+  80137d:	68 39 31 80 00       	push   $0x803139
+  801382:	6a 4a                	push   $0x4a
+  801384:	68 56 31 80 00       	push   $0x803156
+  801389:	e8 7b ee ff ff       	call   800209 <_panic>
+
+0080138e <sys_page_copy>:
+{
+  80138e:	55                   	push   %ebp
+  80138f:	89 e5                	mov    %esp,%ebp
+  801391:	57                   	push   %edi
+  801392:	56                   	push   %esi
+  801393:	53                   	push   %ebx
+  801394:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801397:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80139e:	78 37                	js     8013d7 <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  8013a0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8013a7:	74 7a                	je     801423 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  8013a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013af:	b8 29 00 00 00       	mov    $0x29,%eax
+  8013b4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013b7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013ba:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013bd:	55                   	push   %ebp
+  8013be:	68 c7 13 80 00       	push   $0x8013c7
+  8013c3:	89 e5                	mov    %esp,%ebp
+  8013c5:	0f 34                	sysenter
+  8013c7:	83 c4 04             	add    $0x4,%esp
+  8013ca:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8013cb:	85 c0                	test   %eax,%eax
+  8013cd:	7f 6c                	jg     80143b <sys_page_copy+0xad>
+}
+  8013cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013d2:	5b                   	pop    %ebx
+  8013d3:	5e                   	pop    %esi
+  8013d4:	5f                   	pop    %edi
+  8013d5:	5d                   	pop    %ebp
+  8013d6:	c3                   	ret
+  8013d7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013dc:	0f a2                	cpuid
+		return 0;
+  8013de:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8013e3:	f6 c6 08             	test   $0x8,%dh
+  8013e6:	74 15                	je     8013fd <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013e8:	89 c2                	mov    %eax,%edx
+  8013ea:	c1 ea 08             	shr    $0x8,%edx
+  8013ed:	83 e2 0f             	and    $0xf,%edx
+  8013f0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8013f5:	83 fa 06             	cmp    $0x6,%edx
+  8013f8:	74 0e                	je     801408 <sys_page_copy+0x7a>
+  8013fa:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8013fd:	0f b6 c9             	movzbl %cl,%ecx
+  801400:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801406:	eb 98                	jmp    8013a0 <sys_page_copy+0x12>
+  801408:	89 c2                	mov    %eax,%edx
+  80140a:	c1 ea 04             	shr    $0x4,%edx
+  80140d:	83 e2 0f             	and    $0xf,%edx
+  801410:	83 fa 02             	cmp    $0x2,%edx
+  801413:	77 e5                	ja     8013fa <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  801415:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801418:	83 f8 02             	cmp    $0x2,%eax
+  80141b:	0f 97 c1             	seta   %cl
+  80141e:	0f b6 c9             	movzbl %cl,%ecx
+  801421:	eb d7                	jmp    8013fa <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  801423:	b8 29 00 00 00       	mov    $0x29,%eax
+  801428:	8b 55 08             	mov    0x8(%ebp),%edx
+  80142b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80142e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801431:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801434:	8b 75 18             	mov    0x18(%ebp),%esi
+  801437:	cd 30                	int    $0x30
+  801439:	eb 90                	jmp    8013cb <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80143b:	83 ec 0c             	sub    $0xc,%esp
+  80143e:	50                   	push   %eax
+  80143f:	6a 29                	push   $0x29
+  801441:	68 39 31 80 00       	push   $0x803139
+  801446:	6a 4a                	push   $0x4a
+  801448:	68 56 31 80 00       	push   $0x803156
+  80144d:	e8 b7 ed ff ff       	call   800209 <_panic>
+
+00801452 <sys_yield>:
+{
+  801452:	55                   	push   %ebp
+  801453:	89 e5                	mov    %esp,%ebp
+  801455:	57                   	push   %edi
+  801456:	56                   	push   %esi
+  801457:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801458:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80145f:	78 2e                	js     80148f <sys_yield+0x3d>
+	if (syscall_sysenter)
+  801461:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801468:	74 71                	je     8014db <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  80146a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80146f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801474:	89 d1                	mov    %edx,%ecx
+  801476:	89 d3                	mov    %edx,%ebx
+  801478:	89 d7                	mov    %edx,%edi
+  80147a:	89 d6                	mov    %edx,%esi
+  80147c:	55                   	push   %ebp
+  80147d:	68 86 14 80 00       	push   $0x801486
+  801482:	89 e5                	mov    %esp,%ebp
+  801484:	0f 34                	sysenter
+  801486:	83 c4 04             	add    $0x4,%esp
+  801489:	5d                   	pop    %ebp
+}
+  80148a:	5b                   	pop    %ebx
+  80148b:	5e                   	pop    %esi
+  80148c:	5f                   	pop    %edi
+  80148d:	5d                   	pop    %ebp
+  80148e:	c3                   	ret
+  80148f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801494:	0f a2                	cpuid
+		return 0;
+  801496:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80149b:	f6 c6 08             	test   $0x8,%dh
+  80149e:	74 15                	je     8014b5 <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014a0:	89 c2                	mov    %eax,%edx
+  8014a2:	c1 ea 08             	shr    $0x8,%edx
+  8014a5:	83 e2 0f             	and    $0xf,%edx
+  8014a8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8014ad:	83 fa 06             	cmp    $0x6,%edx
+  8014b0:	74 0e                	je     8014c0 <sys_yield+0x6e>
+  8014b2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8014b5:	0f b6 c9             	movzbl %cl,%ecx
+  8014b8:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8014be:	eb a1                	jmp    801461 <sys_yield+0xf>
+  8014c0:	89 c2                	mov    %eax,%edx
+  8014c2:	c1 ea 04             	shr    $0x4,%edx
+  8014c5:	83 e2 0f             	and    $0xf,%edx
+  8014c8:	83 fa 02             	cmp    $0x2,%edx
+  8014cb:	77 e5                	ja     8014b2 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  8014cd:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014d0:	83 f8 02             	cmp    $0x2,%eax
+  8014d3:	0f 97 c1             	seta   %cl
+  8014d6:	0f b6 c9             	movzbl %cl,%ecx
+  8014d9:	eb d7                	jmp    8014b2 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  8014db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014e0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8014e5:	89 d1                	mov    %edx,%ecx
+  8014e7:	89 d3                	mov    %edx,%ebx
+  8014e9:	89 d7                	mov    %edx,%edi
+  8014eb:	89 d6                	mov    %edx,%esi
+  8014ed:	cd 30                	int    $0x30
+}
+  8014ef:	eb 99                	jmp    80148a <sys_yield+0x38>
+
+008014f1 <sys_env_set_status>:
+{
+  8014f1:	55                   	push   %ebp
+  8014f2:	89 e5                	mov    %esp,%ebp
+  8014f4:	57                   	push   %edi
+  8014f5:	56                   	push   %esi
+  8014f6:	53                   	push   %ebx
+  8014f7:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8014fa:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801501:	78 37                	js     80153a <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  801503:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80150a:	74 7a                	je     801586 <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  80150c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801511:	8b 55 08             	mov    0x8(%ebp),%edx
+  801514:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801517:	b8 08 00 00 00       	mov    $0x8,%eax
+  80151c:	89 df                	mov    %ebx,%edi
+  80151e:	89 de                	mov    %ebx,%esi
+  801520:	55                   	push   %ebp
+  801521:	68 2a 15 80 00       	push   $0x80152a
+  801526:	89 e5                	mov    %esp,%ebp
+  801528:	0f 34                	sysenter
+  80152a:	83 c4 04             	add    $0x4,%esp
+  80152d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80152e:	85 c0                	test   %eax,%eax
+  801530:	7f 6c                	jg     80159e <sys_env_set_status+0xad>
+}
+  801532:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801535:	5b                   	pop    %ebx
+  801536:	5e                   	pop    %esi
+  801537:	5f                   	pop    %edi
+  801538:	5d                   	pop    %ebp
+  801539:	c3                   	ret
+  80153a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80153f:	0f a2                	cpuid
+		return 0;
+  801541:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801546:	f6 c6 08             	test   $0x8,%dh
+  801549:	74 15                	je     801560 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80154b:	89 c2                	mov    %eax,%edx
+  80154d:	c1 ea 08             	shr    $0x8,%edx
+  801550:	83 e2 0f             	and    $0xf,%edx
+  801553:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801558:	83 fa 06             	cmp    $0x6,%edx
+  80155b:	74 0e                	je     80156b <sys_env_set_status+0x7a>
+  80155d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801560:	0f b6 c9             	movzbl %cl,%ecx
+  801563:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801569:	eb 98                	jmp    801503 <sys_env_set_status+0x12>
+  80156b:	89 c2                	mov    %eax,%edx
+  80156d:	c1 ea 04             	shr    $0x4,%edx
+  801570:	83 e2 0f             	and    $0xf,%edx
+  801573:	83 fa 02             	cmp    $0x2,%edx
+  801576:	77 e5                	ja     80155d <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  801578:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80157b:	83 f8 02             	cmp    $0x2,%eax
+  80157e:	0f 97 c1             	seta   %cl
+  801581:	0f b6 c9             	movzbl %cl,%ecx
+  801584:	eb d7                	jmp    80155d <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  801586:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80158b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801590:	8b 55 08             	mov    0x8(%ebp),%edx
+  801593:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801596:	89 df                	mov    %ebx,%edi
+  801598:	89 de                	mov    %ebx,%esi
+  80159a:	cd 30                	int    $0x30
+  80159c:	eb 90                	jmp    80152e <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80159e:	83 ec 0c             	sub    $0xc,%esp
+  8015a1:	50                   	push   %eax
+  8015a2:	6a 08                	push   $0x8
+  8015a4:	68 39 31 80 00       	push   $0x803139
+  8015a9:	6a 4a                	push   $0x4a
+  8015ab:	68 56 31 80 00       	push   $0x803156
+  8015b0:	e8 54 ec ff ff       	call   800209 <_panic>
+
+008015b5 <sys_sysinfo>:
+{
+  8015b5:	55                   	push   %ebp
+  8015b6:	89 e5                	mov    %esp,%ebp
+  8015b8:	57                   	push   %edi
+  8015b9:	56                   	push   %esi
+  8015ba:	53                   	push   %ebx
+  8015bb:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8015be:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8015c5:	78 36                	js     8015fd <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  8015c7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8015ce:	74 79                	je     801649 <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  8015d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015d8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8015dd:	89 cb                	mov    %ecx,%ebx
+  8015df:	89 cf                	mov    %ecx,%edi
+  8015e1:	89 ce                	mov    %ecx,%esi
+  8015e3:	55                   	push   %ebp
+  8015e4:	68 ed 15 80 00       	push   $0x8015ed
+  8015e9:	89 e5                	mov    %esp,%ebp
+  8015eb:	0f 34                	sysenter
+  8015ed:	83 c4 04             	add    $0x4,%esp
+  8015f0:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8015f1:	85 c0                	test   %eax,%eax
+  8015f3:	7f 6b                	jg     801660 <sys_sysinfo+0xab>
+}
+  8015f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015f8:	5b                   	pop    %ebx
+  8015f9:	5e                   	pop    %esi
+  8015fa:	5f                   	pop    %edi
+  8015fb:	5d                   	pop    %ebp
+  8015fc:	c3                   	ret
+  8015fd:	b8 01 00 00 00       	mov    $0x1,%eax
+  801602:	0f a2                	cpuid
+		return 0;
+  801604:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801609:	f6 c6 08             	test   $0x8,%dh
+  80160c:	74 15                	je     801623 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80160e:	89 c2                	mov    %eax,%edx
+  801610:	c1 ea 08             	shr    $0x8,%edx
+  801613:	83 e2 0f             	and    $0xf,%edx
+  801616:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80161b:	83 fa 06             	cmp    $0x6,%edx
+  80161e:	74 0e                	je     80162e <sys_sysinfo+0x79>
+  801620:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801623:	0f b6 c9             	movzbl %cl,%ecx
+  801626:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80162c:	eb 99                	jmp    8015c7 <sys_sysinfo+0x12>
+  80162e:	89 c2                	mov    %eax,%edx
+  801630:	c1 ea 04             	shr    $0x4,%edx
+  801633:	83 e2 0f             	and    $0xf,%edx
+  801636:	83 fa 02             	cmp    $0x2,%edx
+  801639:	77 e5                	ja     801620 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  80163b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80163e:	83 f8 02             	cmp    $0x2,%eax
+  801641:	0f 97 c1             	seta   %cl
+  801644:	0f b6 c9             	movzbl %cl,%ecx
+  801647:	eb d7                	jmp    801620 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  801649:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80164e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801653:	8b 55 08             	mov    0x8(%ebp),%edx
+  801656:	89 cb                	mov    %ecx,%ebx
+  801658:	89 cf                	mov    %ecx,%edi
+  80165a:	89 ce                	mov    %ecx,%esi
+  80165c:	cd 30                	int    $0x30
+  80165e:	eb 91                	jmp    8015f1 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801660:	83 ec 0c             	sub    $0xc,%esp
+  801663:	50                   	push   %eax
+  801664:	6a 0b                	push   $0xb
+  801666:	68 39 31 80 00       	push   $0x803139
+  80166b:	6a 4a                	push   $0x4a
+  80166d:	68 56 31 80 00       	push   $0x803156
+  801672:	e8 92 eb ff ff       	call   800209 <_panic>
+
+00801677 <sys_env_set_trapframe>:
+{
+  801677:	55                   	push   %ebp
+  801678:	89 e5                	mov    %esp,%ebp
+  80167a:	57                   	push   %edi
+  80167b:	56                   	push   %esi
+  80167c:	53                   	push   %ebx
+  80167d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801680:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801687:	78 37                	js     8016c0 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  801689:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801690:	74 7a                	je     80170c <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  801692:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801697:	8b 55 08             	mov    0x8(%ebp),%edx
+  80169a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80169d:	b8 13 00 00 00       	mov    $0x13,%eax
+  8016a2:	89 df                	mov    %ebx,%edi
+  8016a4:	89 de                	mov    %ebx,%esi
+  8016a6:	55                   	push   %ebp
+  8016a7:	68 b0 16 80 00       	push   $0x8016b0
+  8016ac:	89 e5                	mov    %esp,%ebp
+  8016ae:	0f 34                	sysenter
+  8016b0:	83 c4 04             	add    $0x4,%esp
+  8016b3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8016b4:	85 c0                	test   %eax,%eax
+  8016b6:	7f 6c                	jg     801724 <sys_env_set_trapframe+0xad>
+}
+  8016b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016bb:	5b                   	pop    %ebx
+  8016bc:	5e                   	pop    %esi
+  8016bd:	5f                   	pop    %edi
+  8016be:	5d                   	pop    %ebp
+  8016bf:	c3                   	ret
+  8016c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016c5:	0f a2                	cpuid
+		return 0;
+  8016c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8016cc:	f6 c6 08             	test   $0x8,%dh
+  8016cf:	74 15                	je     8016e6 <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016d1:	89 c2                	mov    %eax,%edx
+  8016d3:	c1 ea 08             	shr    $0x8,%edx
+  8016d6:	83 e2 0f             	and    $0xf,%edx
+  8016d9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8016de:	83 fa 06             	cmp    $0x6,%edx
+  8016e1:	74 0e                	je     8016f1 <sys_env_set_trapframe+0x7a>
+  8016e3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8016e6:	0f b6 c9             	movzbl %cl,%ecx
+  8016e9:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8016ef:	eb 98                	jmp    801689 <sys_env_set_trapframe+0x12>
+  8016f1:	89 c2                	mov    %eax,%edx
+  8016f3:	c1 ea 04             	shr    $0x4,%edx
+  8016f6:	83 e2 0f             	and    $0xf,%edx
+  8016f9:	83 fa 02             	cmp    $0x2,%edx
+  8016fc:	77 e5                	ja     8016e3 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  8016fe:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801701:	83 f8 02             	cmp    $0x2,%eax
+  801704:	0f 97 c1             	seta   %cl
+  801707:	0f b6 c9             	movzbl %cl,%ecx
+  80170a:	eb d7                	jmp    8016e3 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  80170c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801711:	b8 13 00 00 00       	mov    $0x13,%eax
+  801716:	8b 55 08             	mov    0x8(%ebp),%edx
+  801719:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80171c:	89 df                	mov    %ebx,%edi
+  80171e:	89 de                	mov    %ebx,%esi
+  801720:	cd 30                	int    $0x30
+  801722:	eb 90                	jmp    8016b4 <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801724:	83 ec 0c             	sub    $0xc,%esp
+  801727:	50                   	push   %eax
+  801728:	6a 13                	push   $0x13
+  80172a:	68 39 31 80 00       	push   $0x803139
+  80172f:	6a 4a                	push   $0x4a
+  801731:	68 56 31 80 00       	push   $0x803156
+  801736:	e8 ce ea ff ff       	call   800209 <_panic>
+
+0080173b <sys_env_set_stack_limit>:
+{
+  80173b:	55                   	push   %ebp
+  80173c:	89 e5                	mov    %esp,%ebp
+  80173e:	57                   	push   %edi
+  80173f:	56                   	push   %esi
+  801740:	53                   	push   %ebx
+  801741:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801744:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80174b:	78 37                	js     801784 <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  80174d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801754:	74 7a                	je     8017d0 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  801756:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80175b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80175e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801761:	b8 19 00 00 00       	mov    $0x19,%eax
+  801766:	89 df                	mov    %ebx,%edi
+  801768:	89 de                	mov    %ebx,%esi
+  80176a:	55                   	push   %ebp
+  80176b:	68 74 17 80 00       	push   $0x801774
+  801770:	89 e5                	mov    %esp,%ebp
+  801772:	0f 34                	sysenter
+  801774:	83 c4 04             	add    $0x4,%esp
+  801777:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801778:	85 c0                	test   %eax,%eax
+  80177a:	7f 6c                	jg     8017e8 <sys_env_set_stack_limit+0xad>
+}
+  80177c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80177f:	5b                   	pop    %ebx
+  801780:	5e                   	pop    %esi
+  801781:	5f                   	pop    %edi
+  801782:	5d                   	pop    %ebp
+  801783:	c3                   	ret
+  801784:	b8 01 00 00 00       	mov    $0x1,%eax
+  801789:	0f a2                	cpuid
+		return 0;
+  80178b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801790:	f6 c6 08             	test   $0x8,%dh
+  801793:	74 15                	je     8017aa <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801795:	89 c2                	mov    %eax,%edx
+  801797:	c1 ea 08             	shr    $0x8,%edx
+  80179a:	83 e2 0f             	and    $0xf,%edx
+  80179d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017a2:	83 fa 06             	cmp    $0x6,%edx
+  8017a5:	74 0e                	je     8017b5 <sys_env_set_stack_limit+0x7a>
+  8017a7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8017aa:	0f b6 c9             	movzbl %cl,%ecx
+  8017ad:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8017b3:	eb 98                	jmp    80174d <sys_env_set_stack_limit+0x12>
+  8017b5:	89 c2                	mov    %eax,%edx
+  8017b7:	c1 ea 04             	shr    $0x4,%edx
+  8017ba:	83 e2 0f             	and    $0xf,%edx
+  8017bd:	83 fa 02             	cmp    $0x2,%edx
+  8017c0:	77 e5                	ja     8017a7 <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  8017c2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017c5:	83 f8 02             	cmp    $0x2,%eax
+  8017c8:	0f 97 c1             	seta   %cl
+  8017cb:	0f b6 c9             	movzbl %cl,%ecx
+  8017ce:	eb d7                	jmp    8017a7 <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  8017d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d5:	b8 19 00 00 00       	mov    $0x19,%eax
+  8017da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017e0:	89 df                	mov    %ebx,%edi
+  8017e2:	89 de                	mov    %ebx,%esi
+  8017e4:	cd 30                	int    $0x30
+  8017e6:	eb 90                	jmp    801778 <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017e8:	83 ec 0c             	sub    $0xc,%esp
+  8017eb:	50                   	push   %eax
+  8017ec:	6a 19                	push   $0x19
+  8017ee:	68 39 31 80 00       	push   $0x803139
+  8017f3:	6a 4a                	push   $0x4a
+  8017f5:	68 56 31 80 00       	push   $0x803156
+  8017fa:	e8 0a ea ff ff       	call   800209 <_panic>
+
+008017ff <sys_env_set_pgfault_upcall>:
+{
+  8017ff:	55                   	push   %ebp
+  801800:	89 e5                	mov    %esp,%ebp
+  801802:	57                   	push   %edi
+  801803:	56                   	push   %esi
+  801804:	53                   	push   %ebx
+  801805:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801808:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80180f:	78 37                	js     801848 <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  801811:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801818:	74 7a                	je     801894 <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  80181a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80181f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801822:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801825:	b8 09 00 00 00       	mov    $0x9,%eax
+  80182a:	89 df                	mov    %ebx,%edi
+  80182c:	89 de                	mov    %ebx,%esi
+  80182e:	55                   	push   %ebp
+  80182f:	68 38 18 80 00       	push   $0x801838
+  801834:	89 e5                	mov    %esp,%ebp
+  801836:	0f 34                	sysenter
+  801838:	83 c4 04             	add    $0x4,%esp
+  80183b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80183c:	85 c0                	test   %eax,%eax
+  80183e:	7f 6c                	jg     8018ac <sys_env_set_pgfault_upcall+0xad>
+}
+  801840:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801843:	5b                   	pop    %ebx
+  801844:	5e                   	pop    %esi
+  801845:	5f                   	pop    %edi
+  801846:	5d                   	pop    %ebp
+  801847:	c3                   	ret
+  801848:	b8 01 00 00 00       	mov    $0x1,%eax
+  80184d:	0f a2                	cpuid
+		return 0;
+  80184f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801854:	f6 c6 08             	test   $0x8,%dh
+  801857:	74 15                	je     80186e <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801859:	89 c2                	mov    %eax,%edx
+  80185b:	c1 ea 08             	shr    $0x8,%edx
+  80185e:	83 e2 0f             	and    $0xf,%edx
+  801861:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801866:	83 fa 06             	cmp    $0x6,%edx
+  801869:	74 0e                	je     801879 <sys_env_set_pgfault_upcall+0x7a>
+  80186b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80186e:	0f b6 c9             	movzbl %cl,%ecx
+  801871:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801877:	eb 98                	jmp    801811 <sys_env_set_pgfault_upcall+0x12>
+  801879:	89 c2                	mov    %eax,%edx
+  80187b:	c1 ea 04             	shr    $0x4,%edx
+  80187e:	83 e2 0f             	and    $0xf,%edx
+  801881:	83 fa 02             	cmp    $0x2,%edx
+  801884:	77 e5                	ja     80186b <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  801886:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801889:	83 f8 02             	cmp    $0x2,%eax
+  80188c:	0f 97 c1             	seta   %cl
+  80188f:	0f b6 c9             	movzbl %cl,%ecx
+  801892:	eb d7                	jmp    80186b <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  801894:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801899:	b8 09 00 00 00       	mov    $0x9,%eax
+  80189e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018a4:	89 df                	mov    %ebx,%edi
+  8018a6:	89 de                	mov    %ebx,%esi
+  8018a8:	cd 30                	int    $0x30
+  8018aa:	eb 90                	jmp    80183c <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8018ac:	83 ec 0c             	sub    $0xc,%esp
+  8018af:	50                   	push   %eax
+  8018b0:	6a 09                	push   $0x9
+  8018b2:	68 39 31 80 00       	push   $0x803139
+  8018b7:	6a 4a                	push   $0x4a
+  8018b9:	68 56 31 80 00       	push   $0x803156
+  8018be:	e8 46 e9 ff ff       	call   800209 <_panic>
+
+008018c3 <sys_ipc_try_send>:
+{
+  8018c3:	55                   	push   %ebp
+  8018c4:	89 e5                	mov    %esp,%ebp
+  8018c6:	57                   	push   %edi
+  8018c7:	56                   	push   %esi
+  8018c8:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8018c9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8018d0:	78 32                	js     801904 <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  8018d2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8018d9:	74 75                	je     801950 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  8018db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018e1:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8018e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8018eb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018ee:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8018f1:	55                   	push   %ebp
+  8018f2:	68 fb 18 80 00       	push   $0x8018fb
+  8018f7:	89 e5                	mov    %esp,%ebp
+  8018f9:	0f 34                	sysenter
+  8018fb:	83 c4 04             	add    $0x4,%esp
+  8018fe:	5d                   	pop    %ebp
+}
+  8018ff:	5b                   	pop    %ebx
+  801900:	5e                   	pop    %esi
+  801901:	5f                   	pop    %edi
+  801902:	5d                   	pop    %ebp
+  801903:	c3                   	ret
+  801904:	b8 01 00 00 00       	mov    $0x1,%eax
+  801909:	0f a2                	cpuid
+		return 0;
+  80190b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801910:	f6 c6 08             	test   $0x8,%dh
+  801913:	74 15                	je     80192a <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801915:	89 c2                	mov    %eax,%edx
+  801917:	c1 ea 08             	shr    $0x8,%edx
+  80191a:	83 e2 0f             	and    $0xf,%edx
+  80191d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801922:	83 fa 06             	cmp    $0x6,%edx
+  801925:	74 0e                	je     801935 <sys_ipc_try_send+0x72>
+  801927:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80192a:	0f b6 c9             	movzbl %cl,%ecx
+  80192d:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801933:	eb 9d                	jmp    8018d2 <sys_ipc_try_send+0xf>
+  801935:	89 c2                	mov    %eax,%edx
+  801937:	c1 ea 04             	shr    $0x4,%edx
+  80193a:	83 e2 0f             	and    $0xf,%edx
+  80193d:	83 fa 02             	cmp    $0x2,%edx
+  801940:	77 e5                	ja     801927 <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  801942:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801945:	83 f8 02             	cmp    $0x2,%eax
+  801948:	0f 97 c1             	seta   %cl
+  80194b:	0f b6 c9             	movzbl %cl,%ecx
+  80194e:	eb d7                	jmp    801927 <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  801950:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801955:	be 00 00 00 00       	mov    $0x0,%esi
+  80195a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80195d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801960:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801963:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801966:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801968:	eb 95                	jmp    8018ff <sys_ipc_try_send+0x3c>
+
+0080196a <sys_ipc_send>:
+{
+  80196a:	55                   	push   %ebp
+  80196b:	89 e5                	mov    %esp,%ebp
+  80196d:	57                   	push   %edi
+  80196e:	56                   	push   %esi
+  80196f:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801970:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801977:	78 32                	js     8019ab <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  801979:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801980:	74 75                	je     8019f7 <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801982:	8b 55 08             	mov    0x8(%ebp),%edx
+  801985:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801988:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80198d:	be 00 00 00 00       	mov    $0x0,%esi
+  801992:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801995:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801998:	55                   	push   %ebp
+  801999:	68 a2 19 80 00       	push   $0x8019a2
+  80199e:	89 e5                	mov    %esp,%ebp
+  8019a0:	0f 34                	sysenter
+  8019a2:	83 c4 04             	add    $0x4,%esp
+  8019a5:	5d                   	pop    %ebp
+}
+  8019a6:	5b                   	pop    %ebx
+  8019a7:	5e                   	pop    %esi
+  8019a8:	5f                   	pop    %edi
+  8019a9:	5d                   	pop    %ebp
+  8019aa:	c3                   	ret
+  8019ab:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019b0:	0f a2                	cpuid
+		return 0;
+  8019b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8019b7:	f6 c6 08             	test   $0x8,%dh
+  8019ba:	74 15                	je     8019d1 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019bc:	89 c2                	mov    %eax,%edx
+  8019be:	c1 ea 08             	shr    $0x8,%edx
+  8019c1:	83 e2 0f             	and    $0xf,%edx
+  8019c4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019c9:	83 fa 06             	cmp    $0x6,%edx
+  8019cc:	74 0e                	je     8019dc <sys_ipc_send+0x72>
+  8019ce:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8019d1:	0f b6 c9             	movzbl %cl,%ecx
+  8019d4:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8019da:	eb 9d                	jmp    801979 <sys_ipc_send+0xf>
+  8019dc:	89 c2                	mov    %eax,%edx
+  8019de:	c1 ea 04             	shr    $0x4,%edx
+  8019e1:	83 e2 0f             	and    $0xf,%edx
+  8019e4:	83 fa 02             	cmp    $0x2,%edx
+  8019e7:	77 e5                	ja     8019ce <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  8019e9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019ec:	83 f8 02             	cmp    $0x2,%eax
+  8019ef:	0f 97 c1             	seta   %cl
+  8019f2:	0f b6 c9             	movzbl %cl,%ecx
+  8019f5:	eb d7                	jmp    8019ce <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  8019f7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8019fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801a01:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a04:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a07:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a0a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a0d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801a0f:	eb 95                	jmp    8019a6 <sys_ipc_send+0x3c>
+
+00801a11 <sys_ipc_recv>:
+{
+  801a11:	55                   	push   %ebp
+  801a12:	89 e5                	mov    %esp,%ebp
+  801a14:	57                   	push   %edi
+  801a15:	56                   	push   %esi
+  801a16:	53                   	push   %ebx
+  801a17:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801a1a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a21:	78 36                	js     801a59 <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  801a23:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a2a:	74 79                	je     801aa5 <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  801a2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a2f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a34:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801a39:	89 cb                	mov    %ecx,%ebx
+  801a3b:	89 cf                	mov    %ecx,%edi
+  801a3d:	89 ce                	mov    %ecx,%esi
+  801a3f:	55                   	push   %ebp
+  801a40:	68 49 1a 80 00       	push   $0x801a49
+  801a45:	89 e5                	mov    %esp,%ebp
+  801a47:	0f 34                	sysenter
+  801a49:	83 c4 04             	add    $0x4,%esp
+  801a4c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801a4d:	85 c0                	test   %eax,%eax
+  801a4f:	7f 6b                	jg     801abc <sys_ipc_recv+0xab>
+}
+  801a51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a54:	5b                   	pop    %ebx
+  801a55:	5e                   	pop    %esi
+  801a56:	5f                   	pop    %edi
+  801a57:	5d                   	pop    %ebp
+  801a58:	c3                   	ret
+  801a59:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a5e:	0f a2                	cpuid
+		return 0;
+  801a60:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801a65:	f6 c6 08             	test   $0x8,%dh
+  801a68:	74 15                	je     801a7f <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a6a:	89 c2                	mov    %eax,%edx
+  801a6c:	c1 ea 08             	shr    $0x8,%edx
+  801a6f:	83 e2 0f             	and    $0xf,%edx
+  801a72:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a77:	83 fa 06             	cmp    $0x6,%edx
+  801a7a:	74 0e                	je     801a8a <sys_ipc_recv+0x79>
+  801a7c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a7f:	0f b6 c9             	movzbl %cl,%ecx
+  801a82:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801a88:	eb 99                	jmp    801a23 <sys_ipc_recv+0x12>
+  801a8a:	89 c2                	mov    %eax,%edx
+  801a8c:	c1 ea 04             	shr    $0x4,%edx
+  801a8f:	83 e2 0f             	and    $0xf,%edx
+  801a92:	83 fa 02             	cmp    $0x2,%edx
+  801a95:	77 e5                	ja     801a7c <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  801a97:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a9a:	83 f8 02             	cmp    $0x2,%eax
+  801a9d:	0f 97 c1             	seta   %cl
+  801aa0:	0f b6 c9             	movzbl %cl,%ecx
+  801aa3:	eb d7                	jmp    801a7c <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  801aa5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801aaa:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801aaf:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ab2:	89 cb                	mov    %ecx,%ebx
+  801ab4:	89 cf                	mov    %ecx,%edi
+  801ab6:	89 ce                	mov    %ecx,%esi
+  801ab8:	cd 30                	int    $0x30
+  801aba:	eb 91                	jmp    801a4d <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801abc:	83 ec 0c             	sub    $0xc,%esp
+  801abf:	50                   	push   %eax
+  801ac0:	6a 0d                	push   $0xd
+  801ac2:	68 39 31 80 00       	push   $0x803139
+  801ac7:	6a 4a                	push   $0x4a
+  801ac9:	68 56 31 80 00       	push   $0x803156
+  801ace:	e8 36 e7 ff ff       	call   800209 <_panic>
+
+00801ad3 <sys_ipc_send_range>:
+{
+  801ad3:	55                   	push   %ebp
+  801ad4:	89 e5                	mov    %esp,%ebp
+  801ad6:	57                   	push   %edi
+  801ad7:	56                   	push   %esi
+  801ad8:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801ad9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ae0:	78 30                	js     801b12 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  801ae2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ae9:	74 73                	je     801b5e <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801aeb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801af1:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801af6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801af9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801afc:	8b 75 18             	mov    0x18(%ebp),%esi
+  801aff:	55                   	push   %ebp
+  801b00:	68 09 1b 80 00       	push   $0x801b09
+  801b05:	89 e5                	mov    %esp,%ebp
+  801b07:	0f 34                	sysenter
+  801b09:	83 c4 04             	add    $0x4,%esp
+  801b0c:	5d                   	pop    %ebp
+}
+  801b0d:	5b                   	pop    %ebx
+  801b0e:	5e                   	pop    %esi
+  801b0f:	5f                   	pop    %edi
+  801b10:	5d                   	pop    %ebp
+  801b11:	c3                   	ret
+  801b12:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b17:	0f a2                	cpuid
+		return 0;
+  801b19:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b1e:	f6 c6 08             	test   $0x8,%dh
+  801b21:	74 15                	je     801b38 <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b23:	89 c2                	mov    %eax,%edx
+  801b25:	c1 ea 08             	shr    $0x8,%edx
+  801b28:	83 e2 0f             	and    $0xf,%edx
+  801b2b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b30:	83 fa 06             	cmp    $0x6,%edx
+  801b33:	74 0e                	je     801b43 <sys_ipc_send_range+0x70>
+  801b35:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b38:	0f b6 c9             	movzbl %cl,%ecx
+  801b3b:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801b41:	eb 9f                	jmp    801ae2 <sys_ipc_send_range+0xf>
+  801b43:	89 c2                	mov    %eax,%edx
+  801b45:	c1 ea 04             	shr    $0x4,%edx
+  801b48:	83 e2 0f             	and    $0xf,%edx
+  801b4b:	83 fa 02             	cmp    $0x2,%edx
+  801b4e:	77 e5                	ja     801b35 <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  801b50:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b53:	83 f8 02             	cmp    $0x2,%eax
+  801b56:	0f 97 c1             	seta   %cl
+  801b59:	0f b6 c9             	movzbl %cl,%ecx
+  801b5c:	eb d7                	jmp    801b35 <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  801b5e:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801b63:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b66:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b69:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b6c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801b6f:	8b 75 18             	mov    0x18(%ebp),%esi
+  801b72:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  801b74:	eb 97                	jmp    801b0d <sys_ipc_send_range+0x3a>
+
+00801b76 <sys_ipc_recv_range>:
+{
+  801b76:	55                   	push   %ebp
+  801b77:	89 e5                	mov    %esp,%ebp
+  801b79:	57                   	push   %edi
+  801b7a:	56                   	push   %esi
+  801b7b:	53                   	push   %ebx
+  801b7c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801b7f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b86:	78 37                	js     801bbf <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  801b88:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b8f:	74 7a                	je     801c0b <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  801b91:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b96:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b99:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b9c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801ba1:	89 df                	mov    %ebx,%edi
+  801ba3:	89 de                	mov    %ebx,%esi
+  801ba5:	55                   	push   %ebp
+  801ba6:	68 af 1b 80 00       	push   $0x801baf
+  801bab:	89 e5                	mov    %esp,%ebp
+  801bad:	0f 34                	sysenter
+  801baf:	83 c4 04             	add    $0x4,%esp
+  801bb2:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801bb3:	85 c0                	test   %eax,%eax
+  801bb5:	7f 6c                	jg     801c23 <sys_ipc_recv_range+0xad>
+}
+  801bb7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bba:	5b                   	pop    %ebx
+  801bbb:	5e                   	pop    %esi
+  801bbc:	5f                   	pop    %edi
+  801bbd:	5d                   	pop    %ebp
+  801bbe:	c3                   	ret
+  801bbf:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bc4:	0f a2                	cpuid
+		return 0;
+  801bc6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801bcb:	f6 c6 08             	test   $0x8,%dh
+  801bce:	74 15                	je     801be5 <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bd0:	89 c2                	mov    %eax,%edx
+  801bd2:	c1 ea 08             	shr    $0x8,%edx
+  801bd5:	83 e2 0f             	and    $0xf,%edx
+  801bd8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801bdd:	83 fa 06             	cmp    $0x6,%edx
+  801be0:	74 0e                	je     801bf0 <sys_ipc_recv_range+0x7a>
+  801be2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801be5:	0f b6 c9             	movzbl %cl,%ecx
+  801be8:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801bee:	eb 98                	jmp    801b88 <sys_ipc_recv_range+0x12>
+  801bf0:	89 c2                	mov    %eax,%edx
+  801bf2:	c1 ea 04             	shr    $0x4,%edx
+  801bf5:	83 e2 0f             	and    $0xf,%edx
+  801bf8:	83 fa 02             	cmp    $0x2,%edx
+  801bfb:	77 e5                	ja     801be2 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801bfd:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c00:	83 f8 02             	cmp    $0x2,%eax
+  801c03:	0f 97 c1             	seta   %cl
+  801c06:	0f b6 c9             	movzbl %cl,%ecx
+  801c09:	eb d7                	jmp    801be2 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801c0b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c10:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801c15:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c18:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c1b:	89 df                	mov    %ebx,%edi
+  801c1d:	89 de                	mov    %ebx,%esi
+  801c1f:	cd 30                	int    $0x30
+  801c21:	eb 90                	jmp    801bb3 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801c23:	83 ec 0c             	sub    $0xc,%esp
+  801c26:	50                   	push   %eax
+  801c27:	6a 1f                	push   $0x1f
+  801c29:	68 39 31 80 00       	push   $0x803139
+  801c2e:	6a 4a                	push   $0x4a
+  801c30:	68 56 31 80 00       	push   $0x803156
+  801c35:	e8 cf e5 ff ff       	call   800209 <_panic>
+
+00801c3a <sys_ipc_call>:
+{
+  801c3a:	55                   	push   %ebp
+  801c3b:	89 e5                	mov    %esp,%ebp
+  801c3d:	57                   	push   %edi
+  801c3e:	56                   	push   %esi
+  801c3f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801c40:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c43:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801c48:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801c4b:	55                   	push   %ebp
+  801c4c:	56                   	push   %esi
+  801c4d:	8b 0e                	mov    (%esi),%ecx
+  801c4f:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801c52:	8b 7e 08             	mov    0x8(%esi),%edi
+  801c55:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801c58:	8b 76 0c             	mov    0xc(%esi),%esi
+  801c5b:	cd 30                	int    $0x30
+  801c5d:	87 34 24             	xchg   %esi,(%esp)
+  801c60:	89 0e                	mov    %ecx,(%esi)
+  801c62:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801c65:	89 7e 08             	mov    %edi,0x8(%esi)
+  801c68:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801c6b:	8f 46 0c             	pop    0xc(%esi)
+  801c6e:	5d                   	pop    %ebp
+}
+  801c6f:	5b                   	pop    %ebx
+  801c70:	5e                   	pop    %esi
+  801c71:	5f                   	pop    %edi
+  801c72:	5d                   	pop    %ebp
+  801c73:	c3                   	ret
+
+00801c74 <sys_ipc_reply_wait>:
+{
+  801c74:	55                   	push   %ebp
+  801c75:	89 e5                	mov    %esp,%ebp
+  801c77:	57                   	push   %edi
+  801c78:	56                   	push   %esi
+  801c79:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801c7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c7d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801c82:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801c85:	55                   	push   %ebp
+  801c86:	56                   	push   %esi
+  801c87:	8b 0e                	mov    (%esi),%ecx
+  801c89:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801c8c:	8b 7e 08             	mov    0x8(%esi),%edi
+  801c8f:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801c92:	8b 76 0c             	mov    0xc(%esi),%esi
+  801c95:	cd 30                	int    $0x30
+  801c97:	87 34 24             	xchg   %esi,(%esp)
+  801c9a:	89 0e                	mov    %ecx,(%esi)
+  801c9c:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801c9f:	89 7e 08             	mov    %edi,0x8(%esi)
+  801ca2:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801ca5:	8f 46 0c             	pop    0xc(%esi)
+  801ca8:	5d                   	pop    %ebp
+}
+  801ca9:	5b                   	pop    %ebx
+  801caa:	5e                   	pop    %esi
+  801cab:	5f                   	pop    %edi
+  801cac:	5d                   	pop    %ebp
+  801cad:	c3                   	ret
+
+00801cae <sys_ipc_send_msg>:
+{
+  801cae:	55                   	push   %ebp
+  801caf:	89 e5                	mov    %esp,%ebp
+  801cb1:	57                   	push   %edi
+  801cb2:	56                   	push   %esi
+  801cb3:	53                   	push   %ebx
+  801cb4:	83 ec 20             	sub    $0x20,%esp
+  801cb7:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801cba:	8b 10                	mov    (%eax),%edx
+  801cbc:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801cbf:	8b 50 04             	mov    0x4(%eax),%edx
+  801cc2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801cc5:	8b 50 08             	mov    0x8(%eax),%edx
+  801cc8:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801ccb:	8b 50 0c             	mov    0xc(%eax),%edx
+  801cce:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801cd1:	8b 40 10             	mov    0x10(%eax),%eax
+  801cd4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801cd7:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801cda:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cdd:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801ce2:	55                   	push   %ebp
+  801ce3:	56                   	push   %esi
+  801ce4:	8b 0e                	mov    (%esi),%ecx
+  801ce6:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801ce9:	8b 7e 08             	mov    0x8(%esi),%edi
+  801cec:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801cef:	8b 76 0c             	mov    0xc(%esi),%esi
+  801cf2:	cd 30                	int    $0x30
+  801cf4:	87 34 24             	xchg   %esi,(%esp)
+  801cf7:	89 0e                	mov    %ecx,(%esi)
+  801cf9:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801cfc:	89 7e 08             	mov    %edi,0x8(%esi)
+  801cff:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801d02:	8f 46 0c             	pop    0xc(%esi)
+  801d05:	5d                   	pop    %ebp
+}
+  801d06:	83 c4 20             	add    $0x20,%esp
+  801d09:	5b                   	pop    %ebx
+  801d0a:	5e                   	pop    %esi
+  801d0b:	5f                   	pop    %edi
+  801d0c:	5d                   	pop    %ebp
+  801d0d:	c3                   	ret
+
+00801d0e <sys_fork>:
+{
+  801d0e:	55                   	push   %ebp
+  801d0f:	89 e5                	mov    %esp,%ebp
+  801d11:	57                   	push   %edi
+  801d12:	56                   	push   %esi
+  801d13:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801d14:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801d1b:	78 2e                	js     801d4b <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801d1d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801d24:	74 71                	je     801d97 <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801d26:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d2b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801d30:	89 d1                	mov    %edx,%ecx
+  801d32:	89 d3                	mov    %edx,%ebx
+  801d34:	89 d7                	mov    %edx,%edi
+  801d36:	89 d6                	mov    %edx,%esi
+  801d38:	55                   	push   %ebp
+  801d39:	68 42 1d 80 00       	push   $0x801d42
+  801d3e:	89 e5                	mov    %esp,%ebp
+  801d40:	0f 34                	sysenter
+  801d42:	83 c4 04             	add    $0x4,%esp
+  801d45:	5d                   	pop    %ebp
+}
+  801d46:	5b                   	pop    %ebx
+  801d47:	5e                   	pop    %esi
+  801d48:	5f                   	pop    %edi
+  801d49:	5d                   	pop    %ebp
+  801d4a:	c3                   	ret
+  801d4b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d50:	0f a2                	cpuid
+		return 0;
+  801d52:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801d57:	f6 c6 08             	test   $0x8,%dh
+  801d5a:	74 15                	je     801d71 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d5c:	89 c2                	mov    %eax,%edx
+  801d5e:	c1 ea 08             	shr    $0x8,%edx
+  801d61:	83 e2 0f             	and    $0xf,%edx
+  801d64:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d69:	83 fa 06             	cmp    $0x6,%edx
+  801d6c:	74 0e                	je     801d7c <sys_fork+0x6e>
+  801d6e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801d71:	0f b6 c9             	movzbl %cl,%ecx
+  801d74:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801d7a:	eb a1                	jmp    801d1d <sys_fork+0xf>
+  801d7c:	89 c2                	mov    %eax,%edx
+  801d7e:	c1 ea 04             	shr    $0x4,%edx
+  801d81:	83 e2 0f             	and    $0xf,%edx
+  801d84:	83 fa 02             	cmp    $0x2,%edx
+  801d87:	77 e5                	ja     801d6e <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801d89:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d8c:	83 f8 02             	cmp    $0x2,%eax
+  801d8f:	0f 97 c1             	seta   %cl
+  801d92:	0f b6 c9             	movzbl %cl,%ecx
+  801d95:	eb d7                	jmp    801d6e <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801d97:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d9c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801da1:	89 d1                	mov    %edx,%ecx
+  801da3:	89 d3                	mov    %edx,%ebx
+  801da5:	89 d7                	mov    %edx,%edi
+  801da7:	89 d6                	mov    %edx,%esi
+  801da9:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801dab:	eb 99                	jmp    801d46 <sys_fork+0x38>
+
+00801dad <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801dad:	55                   	push   %ebp
+  801dae:	89 e5                	mov    %esp,%ebp
+  801db0:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801db3:	ff 75 14             	push   0x14(%ebp)
+  801db6:	ff 75 10             	push   0x10(%ebp)
+  801db9:	ff 75 0c             	push   0xc(%ebp)
+  801dbc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801dc1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801dc4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801dc9:	e8 81 ee ff ff       	call   800c4f <page_vec_call>
+}
+  801dce:	c9                   	leave
+  801dcf:	c3                   	ret
+
+00801dd0 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801dd0:	55                   	push   %ebp
+  801dd1:	89 e5                	mov    %esp,%ebp
+  801dd3:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801dd6:	ff 75 18             	push   0x18(%ebp)
+  801dd9:	ff 75 14             	push   0x14(%ebp)
+  801ddc:	ff 75 10             	push   0x10(%ebp)
+  801ddf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801de2:	8b 55 08             	mov    0x8(%ebp),%edx
+  801de5:	b8 10 00 00 00       	mov    $0x10,%eax
+  801dea:	e8 60 ee ff ff       	call   800c4f <page_vec_call>
+}
+  801def:	c9                   	leave
+  801df0:	c3                   	ret
+
+00801df1 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801df1:	55                   	push   %ebp
+  801df2:	89 e5                	mov    %esp,%ebp
+  801df4:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801df7:	ff 75 14             	push   0x14(%ebp)
+  801dfa:	ff 75 10             	push   0x10(%ebp)
+  801dfd:	ff 75 0c             	push   0xc(%ebp)
+  801e00:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e05:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e08:	b8 11 00 00 00       	mov    $0x11,%eax
+  801e0d:	e8 3d ee ff ff       	call   800c4f <page_vec_call>
+}
+  801e12:	c9                   	leave
+  801e13:	c3                   	ret
+
+00801e14 <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801e14:	55                   	push   %ebp
+  801e15:	89 e5                	mov    %esp,%ebp
+  801e17:	57                   	push   %edi
+  801e18:	56                   	push   %esi
+  801e19:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801e1a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e21:	78 32                	js     801e55 <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801e23:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e2a:	74 75                	je     801ea1 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801e2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e32:	b8 12 00 00 00       	mov    $0x12,%eax
+  801e37:	be 00 00 00 00       	mov    $0x0,%esi
+  801e3c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e3f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801e42:	55                   	push   %ebp
+  801e43:	68 4c 1e 80 00       	push   $0x801e4c
+  801e48:	89 e5                	mov    %esp,%ebp
+  801e4a:	0f 34                	sysenter
+  801e4c:	83 c4 04             	add    $0x4,%esp
+  801e4f:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801e50:	5b                   	pop    %ebx
+  801e51:	5e                   	pop    %esi
+  801e52:	5f                   	pop    %edi
+  801e53:	5d                   	pop    %ebp
+  801e54:	c3                   	ret
+  801e55:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e5a:	0f a2                	cpuid
+		return 0;
+  801e5c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801e61:	f6 c6 08             	test   $0x8,%dh
+  801e64:	74 15                	je     801e7b <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e66:	89 c2                	mov    %eax,%edx
+  801e68:	c1 ea 08             	shr    $0x8,%edx
+  801e6b:	83 e2 0f             	and    $0xf,%edx
+  801e6e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e73:	83 fa 06             	cmp    $0x6,%edx
+  801e76:	74 0e                	je     801e86 <sys_vm_ranges+0x72>
+  801e78:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801e7b:	0f b6 c9             	movzbl %cl,%ecx
+  801e7e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801e84:	eb 9d                	jmp    801e23 <sys_vm_ranges+0xf>
+  801e86:	89 c2                	mov    %eax,%edx
+  801e88:	c1 ea 04             	shr    $0x4,%edx
+  801e8b:	83 e2 0f             	and    $0xf,%edx
+  801e8e:	83 fa 02             	cmp    $0x2,%edx
+  801e91:	77 e5                	ja     801e78 <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  801e93:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e96:	83 f8 02             	cmp    $0x2,%eax
+  801e99:	0f 97 c1             	seta   %cl
+  801e9c:	0f b6 c9             	movzbl %cl,%ecx
+  801e9f:	eb d7                	jmp    801e78 <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801ea1:	b8 12 00 00 00       	mov    $0x12,%eax
+  801ea6:	be 00 00 00 00       	mov    $0x0,%esi
+  801eab:	8b 55 08             	mov    0x8(%ebp),%edx
+  801eae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801eb1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801eb4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801eb7:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801eb9:	eb 95                	jmp    801e50 <sys_vm_ranges+0x3c>
+
+00801ebb <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801ebb:	55                   	push   %ebp
+  801ebc:	89 e5                	mov    %esp,%ebp
+  801ebe:	57                   	push   %edi
+  801ebf:	56                   	push   %esi
+  801ec0:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801ec1:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ec8:	78 31                	js     801efb <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801eca:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ed1:	74 74                	je     801f47 <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801ed3:	be 00 00 00 00       	mov    $0x0,%esi
+  801ed8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801edb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ede:	b8 14 00 00 00       	mov    $0x14,%eax
+  801ee3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ee6:	89 f7                	mov    %esi,%edi
+  801ee8:	55                   	push   %ebp
+  801ee9:	68 f2 1e 80 00       	push   $0x801ef2
+  801eee:	89 e5                	mov    %esp,%ebp
+  801ef0:	0f 34                	sysenter
+  801ef2:	83 c4 04             	add    $0x4,%esp
+  801ef5:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801ef6:	5b                   	pop    %ebx
+  801ef7:	5e                   	pop    %esi
+  801ef8:	5f                   	pop    %edi
+  801ef9:	5d                   	pop    %ebp
+  801efa:	c3                   	ret
+  801efb:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f00:	0f a2                	cpuid
+		return 0;
+  801f02:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801f07:	f6 c6 08             	test   $0x8,%dh
+  801f0a:	74 15                	je     801f21 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f0c:	89 c2                	mov    %eax,%edx
+  801f0e:	c1 ea 08             	shr    $0x8,%edx
+  801f11:	83 e2 0f             	and    $0xf,%edx
+  801f14:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f19:	83 fa 06             	cmp    $0x6,%edx
+  801f1c:	74 0e                	je     801f2c <sys_spawn+0x71>
+  801f1e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801f21:	0f b6 c9             	movzbl %cl,%ecx
+  801f24:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801f2a:	eb 9e                	jmp    801eca <sys_spawn+0xf>
+  801f2c:	89 c2                	mov    %eax,%edx
+  801f2e:	c1 ea 04             	shr    $0x4,%edx
+  801f31:	83 e2 0f             	and    $0xf,%edx
+  801f34:	83 fa 02             	cmp    $0x2,%edx
+  801f37:	77 e5                	ja     801f1e <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  801f39:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f3c:	83 f8 02             	cmp    $0x2,%eax
+  801f3f:	0f 97 c1             	seta   %cl
+  801f42:	0f b6 c9             	movzbl %cl,%ecx
+  801f45:	eb d7                	jmp    801f1e <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  801f47:	be 00 00 00 00       	mov    $0x0,%esi
+  801f4c:	b8 14 00 00 00       	mov    $0x14,%eax
+  801f51:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f54:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f57:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f5a:	89 f7                	mov    %esi,%edi
+  801f5c:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  801f5e:	eb 96                	jmp    801ef6 <sys_spawn+0x3b>
+
+00801f60 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  801f60:	55                   	push   %ebp
+  801f61:	89 e5                	mov    %esp,%ebp
+  801f63:	57                   	push   %edi
+  801f64:	56                   	push   %esi
+  801f65:	53                   	push   %ebx
+  801f66:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801f69:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f70:	78 37                	js     801fa9 <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  801f72:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f79:	74 7a                	je     801ff5 <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  801f7b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f80:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f83:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f86:	b8 15 00 00 00       	mov    $0x15,%eax
+  801f8b:	89 df                	mov    %ebx,%edi
+  801f8d:	89 de                	mov    %ebx,%esi
+  801f8f:	55                   	push   %ebp
+  801f90:	68 99 1f 80 00       	push   $0x801f99
+  801f95:	89 e5                	mov    %esp,%ebp
+  801f97:	0f 34                	sysenter
+  801f99:	83 c4 04             	add    $0x4,%esp
+  801f9c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801f9d:	85 c0                	test   %eax,%eax
+  801f9f:	7f 6c                	jg     80200d <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  801fa1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fa4:	5b                   	pop    %ebx
+  801fa5:	5e                   	pop    %esi
+  801fa6:	5f                   	pop    %edi
+  801fa7:	5d                   	pop    %ebp
+  801fa8:	c3                   	ret
+  801fa9:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fae:	0f a2                	cpuid
+		return 0;
+  801fb0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801fb5:	f6 c6 08             	test   $0x8,%dh
+  801fb8:	74 15                	je     801fcf <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fba:	89 c2                	mov    %eax,%edx
+  801fbc:	c1 ea 08             	shr    $0x8,%edx
+  801fbf:	83 e2 0f             	and    $0xf,%edx
+  801fc2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801fc7:	83 fa 06             	cmp    $0x6,%edx
+  801fca:	74 0e                	je     801fda <sys_shm_create+0x7a>
+  801fcc:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801fcf:	0f b6 c9             	movzbl %cl,%ecx
+  801fd2:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801fd8:	eb 98                	jmp    801f72 <sys_shm_create+0x12>
+  801fda:	89 c2                	mov    %eax,%edx
+  801fdc:	c1 ea 04             	shr    $0x4,%edx
+  801fdf:	83 e2 0f             	and    $0xf,%edx
+  801fe2:	83 fa 02             	cmp    $0x2,%edx
+  801fe5:	77 e5                	ja     801fcc <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  801fe7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fea:	83 f8 02             	cmp    $0x2,%eax
+  801fed:	0f 97 c1             	seta   %cl
+  801ff0:	0f b6 c9             	movzbl %cl,%ecx
+  801ff3:	eb d7                	jmp    801fcc <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  801ff5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ffa:	b8 15 00 00 00       	mov    $0x15,%eax
+  801fff:	8b 55 08             	mov    0x8(%ebp),%edx
+  802002:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802005:	89 df                	mov    %ebx,%edi
+  802007:	89 de                	mov    %ebx,%esi
+  802009:	cd 30                	int    $0x30
+  80200b:	eb 90                	jmp    801f9d <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80200d:	83 ec 0c             	sub    $0xc,%esp
+  802010:	50                   	push   %eax
+  802011:	6a 15                	push   $0x15
+  802013:	68 39 31 80 00       	push   $0x803139
+  802018:	6a 4a                	push   $0x4a
+  80201a:	68 56 31 80 00       	push   $0x803156
+  80201f:	e8 e5 e1 ff ff       	call   800209 <_panic>
+
+00802024 <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  802024:	55                   	push   %ebp
+  802025:	89 e5                	mov    %esp,%ebp
+  802027:	57                   	push   %edi
+  802028:	56                   	push   %esi
+  802029:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80202a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802031:	78 32                	js     802065 <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  802033:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80203a:	74 75                	je     8020b1 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  80203c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80203f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802042:	b8 16 00 00 00       	mov    $0x16,%eax
+  802047:	be 00 00 00 00       	mov    $0x0,%esi
+  80204c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80204f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802052:	55                   	push   %ebp
+  802053:	68 5c 20 80 00       	push   $0x80205c
+  802058:	89 e5                	mov    %esp,%ebp
+  80205a:	0f 34                	sysenter
+  80205c:	83 c4 04             	add    $0x4,%esp
+  80205f:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  802060:	5b                   	pop    %ebx
+  802061:	5e                   	pop    %esi
+  802062:	5f                   	pop    %edi
+  802063:	5d                   	pop    %ebp
+  802064:	c3                   	ret
+  802065:	b8 01 00 00 00       	mov    $0x1,%eax
+  80206a:	0f a2                	cpuid
+		return 0;
+  80206c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802071:	f6 c6 08             	test   $0x8,%dh
+  802074:	74 15                	je     80208b <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802076:	89 c2                	mov    %eax,%edx
+  802078:	c1 ea 08             	shr    $0x8,%edx
+  80207b:	83 e2 0f             	and    $0xf,%edx
+  80207e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802083:	83 fa 06             	cmp    $0x6,%edx
+  802086:	74 0e                	je     802096 <sys_shm_attach+0x72>
+  802088:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80208b:	0f b6 c9             	movzbl %cl,%ecx
+  80208e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802094:	eb 9d                	jmp    802033 <sys_shm_attach+0xf>
+  802096:	89 c2                	mov    %eax,%edx
+  802098:	c1 ea 04             	shr    $0x4,%edx
+  80209b:	83 e2 0f             	and    $0xf,%edx
+  80209e:	83 fa 02             	cmp    $0x2,%edx
+  8020a1:	77 e5                	ja     802088 <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  8020a3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020a6:	83 f8 02             	cmp    $0x2,%eax
+  8020a9:	0f 97 c1             	seta   %cl
+  8020ac:	0f b6 c9             	movzbl %cl,%ecx
+  8020af:	eb d7                	jmp    802088 <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  8020b1:	b8 16 00 00 00       	mov    $0x16,%eax
+  8020b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8020bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020c1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8020c4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8020c7:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  8020c9:	eb 95                	jmp    802060 <sys_shm_attach+0x3c>
+
+008020cb <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  8020cb:	55                   	push   %ebp
+  8020cc:	89 e5                	mov    %esp,%ebp
+  8020ce:	57                   	push   %edi
+  8020cf:	56                   	push   %esi
+  8020d0:	53                   	push   %ebx
+  8020d1:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8020d4:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8020db:	78 38                	js     802115 <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  8020dd:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8020e4:	74 7b                	je     802161 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  8020e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8020eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020f1:	b8 17 00 00 00       	mov    $0x17,%eax
+  8020f6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8020f9:	89 f7                	mov    %esi,%edi
+  8020fb:	55                   	push   %ebp
+  8020fc:	68 05 21 80 00       	push   $0x802105
+  802101:	89 e5                	mov    %esp,%ebp
+  802103:	0f 34                	sysenter
+  802105:	83 c4 04             	add    $0x4,%esp
+  802108:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802109:	85 c0                	test   %eax,%eax
+  80210b:	7f 6d                	jg     80217a <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  80210d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802110:	5b                   	pop    %ebx
+  802111:	5e                   	pop    %esi
+  802112:	5f                   	pop    %edi
+  802113:	5d                   	pop    %ebp
+  802114:	c3                   	ret
+  802115:	b8 01 00 00 00       	mov    $0x1,%eax
+  80211a:	0f a2                	cpuid
+		return 0;
+  80211c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802121:	f6 c6 08             	test   $0x8,%dh
+  802124:	74 15                	je     80213b <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802126:	89 c2                	mov    %eax,%edx
+  802128:	c1 ea 08             	shr    $0x8,%edx
+  80212b:	83 e2 0f             	and    $0xf,%edx
+  80212e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802133:	83 fa 06             	cmp    $0x6,%edx
+  802136:	74 0e                	je     802146 <sys_shm_detach+0x7b>
+  802138:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80213b:	0f b6 c9             	movzbl %cl,%ecx
+  80213e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802144:	eb 97                	jmp    8020dd <sys_shm_detach+0x12>
+  802146:	89 c2                	mov    %eax,%edx
+  802148:	c1 ea 04             	shr    $0x4,%edx
+  80214b:	83 e2 0f             	and    $0xf,%edx
+  80214e:	83 fa 02             	cmp    $0x2,%edx
+  802151:	77 e5                	ja     802138 <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  802153:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802156:	83 f8 02             	cmp    $0x2,%eax
+  802159:	0f 97 c1             	seta   %cl
+  80215c:	0f b6 c9             	movzbl %cl,%ecx
+  80215f:	eb d7                	jmp    802138 <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  802161:	be 00 00 00 00       	mov    $0x0,%esi
+  802166:	b8 17 00 00 00       	mov    $0x17,%eax
+  80216b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80216e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802171:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802174:	89 f7                	mov    %esi,%edi
+  802176:	cd 30                	int    $0x30
+  802178:	eb 8f                	jmp    802109 <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80217a:	83 ec 0c             	sub    $0xc,%esp
+  80217d:	50                   	push   %eax
+  80217e:	6a 17                	push   $0x17
+  802180:	68 39 31 80 00       	push   $0x803139
+  802185:	6a 4a                	push   $0x4a
+  802187:	68 56 31 80 00       	push   $0x803156
+  80218c:	e8 78 e0 ff ff       	call   800209 <_panic>
+
+00802191 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  802191:	55                   	push   %ebp
+  802192:	89 e5                	mov    %esp,%ebp
+  802194:	57                   	push   %edi
+  802195:	56                   	push   %esi
+  802196:	53                   	push   %ebx
+  802197:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80219a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8021a1:	78 36                	js     8021d9 <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  8021a3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8021aa:	74 79                	je     802225 <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  8021ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021af:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021b4:	b8 18 00 00 00       	mov    $0x18,%eax
+  8021b9:	89 cb                	mov    %ecx,%ebx
+  8021bb:	89 cf                	mov    %ecx,%edi
+  8021bd:	89 ce                	mov    %ecx,%esi
+  8021bf:	55                   	push   %ebp
+  8021c0:	68 c9 21 80 00       	push   $0x8021c9
+  8021c5:	89 e5                	mov    %esp,%ebp
+  8021c7:	0f 34                	sysenter
+  8021c9:	83 c4 04             	add    $0x4,%esp
+  8021cc:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8021cd:	85 c0                	test   %eax,%eax
+  8021cf:	7f 6b                	jg     80223c <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  8021d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021d4:	5b                   	pop    %ebx
+  8021d5:	5e                   	pop    %esi
+  8021d6:	5f                   	pop    %edi
+  8021d7:	5d                   	pop    %ebp
+  8021d8:	c3                   	ret
+  8021d9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021de:	0f a2                	cpuid
+		return 0;
+  8021e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8021e5:	f6 c6 08             	test   $0x8,%dh
+  8021e8:	74 15                	je     8021ff <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021ea:	89 c2                	mov    %eax,%edx
+  8021ec:	c1 ea 08             	shr    $0x8,%edx
+  8021ef:	83 e2 0f             	and    $0xf,%edx
+  8021f2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8021f7:	83 fa 06             	cmp    $0x6,%edx
+  8021fa:	74 0e                	je     80220a <sys_shm_remove+0x79>
+  8021fc:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8021ff:	0f b6 c9             	movzbl %cl,%ecx
+  802202:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802208:	eb 99                	jmp    8021a3 <sys_shm_remove+0x12>
+  80220a:	89 c2                	mov    %eax,%edx
+  80220c:	c1 ea 04             	shr    $0x4,%edx
+  80220f:	83 e2 0f             	and    $0xf,%edx
+  802212:	83 fa 02             	cmp    $0x2,%edx
+  802215:	77 e5                	ja     8021fc <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  802217:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80221a:	83 f8 02             	cmp    $0x2,%eax
+  80221d:	0f 97 c1             	seta   %cl
+  802220:	0f b6 c9             	movzbl %cl,%ecx
+  802223:	eb d7                	jmp    8021fc <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  802225:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80222a:	b8 18 00 00 00       	mov    $0x18,%eax
+  80222f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802232:	89 cb                	mov    %ecx,%ebx
+  802234:	89 cf                	mov    %ecx,%edi
+  802236:	89 ce                	mov    %ecx,%esi
+  802238:	cd 30                	int    $0x30
+  80223a:	eb 91                	jmp    8021cd <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80223c:	83 ec 0c             	sub    $0xc,%esp
+  80223f:	50                   	push   %eax
+  802240:	6a 18                	push   $0x18
+  802242:	68 39 31 80 00       	push   $0x803139
+  802247:	6a 4a                	push   $0x4a
+  802249:	68 56 31 80 00       	push   $0x803156
+  80224e:	e8 b6 df ff ff       	call   800209 <_panic>
+
+00802253 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  802253:	55                   	push   %ebp
+  802254:	89 e5                	mov    %esp,%ebp
+  802256:	57                   	push   %edi
+  802257:	56                   	push   %esi
+  802258:	53                   	push   %ebx
+  802259:	83 ec 0c             	sub    $0xc,%esp
+  80225c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80225f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802262:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  802265:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80226c:	78 32                	js     8022a0 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  80226e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802275:	74 75                	je     8022ec <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  802277:	8b 55 08             	mov    0x8(%ebp),%edx
+  80227a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80227d:	b8 20 00 00 00       	mov    $0x20,%eax
+  802282:	be 00 00 00 00       	mov    $0x0,%esi
+  802287:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  80228a:	55                   	push   %ebp
+  80228b:	68 94 22 80 00       	push   $0x802294
+  802290:	89 e5                	mov    %esp,%ebp
+  802292:	0f 34                	sysenter
+  802294:	83 c4 04             	add    $0x4,%esp
+  802297:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  802298:	83 c4 0c             	add    $0xc,%esp
+  80229b:	5b                   	pop    %ebx
+  80229c:	5e                   	pop    %esi
+  80229d:	5f                   	pop    %edi
+  80229e:	5d                   	pop    %ebp
+  80229f:	c3                   	ret
+  8022a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022a5:	0f a2                	cpuid
+		return 0;
+  8022a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8022ac:	f6 c6 08             	test   $0x8,%dh
+  8022af:	74 15                	je     8022c6 <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022b1:	89 c2                	mov    %eax,%edx
+  8022b3:	c1 ea 08             	shr    $0x8,%edx
+  8022b6:	83 e2 0f             	and    $0xf,%edx
+  8022b9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8022be:	83 fa 06             	cmp    $0x6,%edx
+  8022c1:	74 0e                	je     8022d1 <sys_futex_wait+0x7e>
+  8022c3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8022c6:	0f b6 c9             	movzbl %cl,%ecx
+  8022c9:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8022cf:	eb 9d                	jmp    80226e <sys_futex_wait+0x1b>
+  8022d1:	89 c2                	mov    %eax,%edx
+  8022d3:	c1 ea 04             	shr    $0x4,%edx
+  8022d6:	83 e2 0f             	and    $0xf,%edx
+  8022d9:	83 fa 02             	cmp    $0x2,%edx
+  8022dc:	77 e5                	ja     8022c3 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  8022de:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022e1:	83 f8 02             	cmp    $0x2,%eax
+  8022e4:	0f 97 c1             	seta   %cl
+  8022e7:	0f b6 c9             	movzbl %cl,%ecx
+  8022ea:	eb d7                	jmp    8022c3 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  8022ec:	b8 20 00 00 00       	mov    $0x20,%eax
+  8022f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8022f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022fc:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8022ff:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  802301:	eb 95                	jmp    802298 <sys_futex_wait+0x45>
+
+00802303 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  802303:	55                   	push   %ebp
+  802304:	89 e5                	mov    %esp,%ebp
+  802306:	57                   	push   %edi
+  802307:	56                   	push   %esi
+  802308:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802309:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802310:	78 30                	js     802342 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  802312:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802319:	74 73                	je     80238e <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  80231b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802320:	8b 55 08             	mov    0x8(%ebp),%edx
+  802323:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802326:	b8 21 00 00 00       	mov    $0x21,%eax
+  80232b:	89 df                	mov    %ebx,%edi
+  80232d:	89 de                	mov    %ebx,%esi
+  80232f:	55                   	push   %ebp
+  802330:	68 39 23 80 00       	push   $0x802339
+  802335:	89 e5                	mov    %esp,%ebp
+  802337:	0f 34                	sysenter
+  802339:	83 c4 04             	add    $0x4,%esp
+  80233c:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80233d:	5b                   	pop    %ebx
+  80233e:	5e                   	pop    %esi
+  80233f:	5f                   	pop    %edi
+  802340:	5d                   	pop    %ebp
+  802341:	c3                   	ret
+  802342:	b8 01 00 00 00       	mov    $0x1,%eax
+  802347:	0f a2                	cpuid
+		return 0;
+  802349:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80234e:	f6 c6 08             	test   $0x8,%dh
+  802351:	74 15                	je     802368 <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802353:	89 c2                	mov    %eax,%edx
+  802355:	c1 ea 08             	shr    $0x8,%edx
+  802358:	83 e2 0f             	and    $0xf,%edx
+  80235b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802360:	83 fa 06             	cmp    $0x6,%edx
+  802363:	74 0e                	je     802373 <sys_futex_wake+0x70>
+  802365:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802368:	0f b6 c9             	movzbl %cl,%ecx
+  80236b:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802371:	eb 9f                	jmp    802312 <sys_futex_wake+0xf>
+  802373:	89 c2                	mov    %eax,%edx
+  802375:	c1 ea 04             	shr    $0x4,%edx
+  802378:	83 e2 0f             	and    $0xf,%edx
+  80237b:	83 fa 02             	cmp    $0x2,%edx
+  80237e:	77 e5                	ja     802365 <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  802380:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802383:	83 f8 02             	cmp    $0x2,%eax
+  802386:	0f 97 c1             	seta   %cl
+  802389:	0f b6 c9             	movzbl %cl,%ecx
+  80238c:	eb d7                	jmp    802365 <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  80238e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802393:	b8 21 00 00 00       	mov    $0x21,%eax
+  802398:	8b 55 08             	mov    0x8(%ebp),%edx
+  80239b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80239e:	89 df                	mov    %ebx,%edi
+  8023a0:	89 de                	mov    %ebx,%esi
+  8023a2:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  8023a4:	eb 97                	jmp    80233d <sys_futex_wake+0x3a>
+
+008023a6 <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  8023a6:	55                   	push   %ebp
+  8023a7:	89 e5                	mov    %esp,%ebp
+  8023a9:	57                   	push   %edi
+  8023aa:	56                   	push   %esi
+  8023ab:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8023ac:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8023b3:	78 2e                	js     8023e3 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  8023b5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8023bc:	74 71                	je     80242f <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  8023be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023c3:	b8 22 00 00 00       	mov    $0x22,%eax
+  8023c8:	89 d1                	mov    %edx,%ecx
+  8023ca:	89 d3                	mov    %edx,%ebx
+  8023cc:	89 d7                	mov    %edx,%edi
+  8023ce:	89 d6                	mov    %edx,%esi
+  8023d0:	55                   	push   %ebp
+  8023d1:	68 da 23 80 00       	push   $0x8023da
+  8023d6:	89 e5                	mov    %esp,%ebp
+  8023d8:	0f 34                	sysenter
+  8023da:	83 c4 04             	add    $0x4,%esp
+  8023dd:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  8023de:	5b                   	pop    %ebx
+  8023df:	5e                   	pop    %esi
+  8023e0:	5f                   	pop    %edi
+  8023e1:	5d                   	pop    %ebp
+  8023e2:	c3                   	ret
+  8023e3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023e8:	0f a2                	cpuid
+		return 0;
+  8023ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8023ef:	f6 c6 08             	test   $0x8,%dh
+  8023f2:	74 15                	je     802409 <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023f4:	89 c2                	mov    %eax,%edx
+  8023f6:	c1 ea 08             	shr    $0x8,%edx
+  8023f9:	83 e2 0f             	and    $0xf,%edx
+  8023fc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802401:	83 fa 06             	cmp    $0x6,%edx
+  802404:	74 0e                	je     802414 <sys_ep_create+0x6e>
+  802406:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802409:	0f b6 c9             	movzbl %cl,%ecx
+  80240c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802412:	eb a1                	jmp    8023b5 <sys_ep_create+0xf>
+  802414:	89 c2                	mov    %eax,%edx
+  802416:	c1 ea 04             	shr    $0x4,%edx
+  802419:	83 e2 0f             	and    $0xf,%edx
+  80241c:	83 fa 02             	cmp    $0x2,%edx
+  80241f:	77 e5                	ja     802406 <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  802421:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802424:	83 f8 02             	cmp    $0x2,%eax
+  802427:	0f 97 c1             	seta   %cl
+  80242a:	0f b6 c9             	movzbl %cl,%ecx
+  80242d:	eb d7                	jmp    802406 <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  80242f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802434:	b8 22 00 00 00       	mov    $0x22,%eax
+  802439:	89 d1                	mov    %edx,%ecx
+  80243b:	89 d3                	mov    %edx,%ebx
+  80243d:	89 d7                	mov    %edx,%edi
+  80243f:	89 d6                	mov    %edx,%esi
+  802441:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  802443:	eb 99                	jmp    8023de <sys_ep_create+0x38>
+
+00802445 <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  802445:	55                   	push   %ebp
+  802446:	89 e5                	mov    %esp,%ebp
+  802448:	57                   	push   %edi
+  802449:	56                   	push   %esi
+  80244a:	53                   	push   %ebx
+  80244b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80244e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802455:	78 36                	js     80248d <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  802457:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80245e:	74 79                	je     8024d9 <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  802460:	8b 55 08             	mov    0x8(%ebp),%edx
+  802463:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802468:	b8 23 00 00 00       	mov    $0x23,%eax
+  80246d:	89 cb                	mov    %ecx,%ebx
+  80246f:	89 cf                	mov    %ecx,%edi
+  802471:	89 ce                	mov    %ecx,%esi
+  802473:	55                   	push   %ebp
+  802474:	68 7d 24 80 00       	push   $0x80247d
+  802479:	89 e5                	mov    %esp,%ebp
+  80247b:	0f 34                	sysenter
+  80247d:	83 c4 04             	add    $0x4,%esp
+  802480:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802481:	85 c0                	test   %eax,%eax
+  802483:	7f 6b                	jg     8024f0 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  802485:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802488:	5b                   	pop    %ebx
+  802489:	5e                   	pop    %esi
+  80248a:	5f                   	pop    %edi
+  80248b:	5d                   	pop    %ebp
+  80248c:	c3                   	ret
+  80248d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802492:	0f a2                	cpuid
+		return 0;
+  802494:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802499:	f6 c6 08             	test   $0x8,%dh
+  80249c:	74 15                	je     8024b3 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80249e:	89 c2                	mov    %eax,%edx
+  8024a0:	c1 ea 08             	shr    $0x8,%edx
+  8024a3:	83 e2 0f             	and    $0xf,%edx
+  8024a6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8024ab:	83 fa 06             	cmp    $0x6,%edx
+  8024ae:	74 0e                	je     8024be <sys_ep_destroy+0x79>
+  8024b0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8024b3:	0f b6 c9             	movzbl %cl,%ecx
+  8024b6:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8024bc:	eb 99                	jmp    802457 <sys_ep_destroy+0x12>
+  8024be:	89 c2                	mov    %eax,%edx
+  8024c0:	c1 ea 04             	shr    $0x4,%edx
+  8024c3:	83 e2 0f             	and    $0xf,%edx
+  8024c6:	83 fa 02             	cmp    $0x2,%edx
+  8024c9:	77 e5                	ja     8024b0 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  8024cb:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8024ce:	83 f8 02             	cmp    $0x2,%eax
+  8024d1:	0f 97 c1             	seta   %cl
+  8024d4:	0f b6 c9             	movzbl %cl,%ecx
+  8024d7:	eb d7                	jmp    8024b0 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  8024d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024de:	b8 23 00 00 00       	mov    $0x23,%eax
+  8024e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024e6:	89 cb                	mov    %ecx,%ebx
+  8024e8:	89 cf                	mov    %ecx,%edi
+  8024ea:	89 ce                	mov    %ecx,%esi
+  8024ec:	cd 30                	int    $0x30
+  8024ee:	eb 91                	jmp    802481 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8024f0:	83 ec 0c             	sub    $0xc,%esp
+  8024f3:	50                   	push   %eax
+  8024f4:	6a 23                	push   $0x23
+  8024f6:	68 39 31 80 00       	push   $0x803139
+  8024fb:	6a 4a                	push   $0x4a
+  8024fd:	68 56 31 80 00       	push   $0x803156
+  802502:	e8 02 dd ff ff       	call   800209 <_panic>
+
+00802507 <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  802507:	55                   	push   %ebp
+  802508:	89 e5                	mov    %esp,%ebp
+  80250a:	57                   	push   %edi
+  80250b:	56                   	push   %esi
+  80250c:	53                   	push   %ebx
+  80250d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802510:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802517:	78 37                	js     802550 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  802519:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802520:	74 7a                	je     80259c <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  802522:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802527:	8b 55 08             	mov    0x8(%ebp),%edx
+  80252a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80252d:	b8 24 00 00 00       	mov    $0x24,%eax
+  802532:	89 df                	mov    %ebx,%edi
+  802534:	89 de                	mov    %ebx,%esi
+  802536:	55                   	push   %ebp
+  802537:	68 40 25 80 00       	push   $0x802540
+  80253c:	89 e5                	mov    %esp,%ebp
+  80253e:	0f 34                	sysenter
+  802540:	83 c4 04             	add    $0x4,%esp
+  802543:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802544:	85 c0                	test   %eax,%eax
+  802546:	7f 6c                	jg     8025b4 <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  802548:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80254b:	5b                   	pop    %ebx
+  80254c:	5e                   	pop    %esi
+  80254d:	5f                   	pop    %edi
+  80254e:	5d                   	pop    %ebp
+  80254f:	c3                   	ret
+  802550:	b8 01 00 00 00       	mov    $0x1,%eax
+  802555:	0f a2                	cpuid
+		return 0;
+  802557:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80255c:	f6 c6 08             	test   $0x8,%dh
+  80255f:	74 15                	je     802576 <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802561:	89 c2                	mov    %eax,%edx
+  802563:	c1 ea 08             	shr    $0x8,%edx
+  802566:	83 e2 0f             	and    $0xf,%edx
+  802569:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80256e:	83 fa 06             	cmp    $0x6,%edx
+  802571:	74 0e                	je     802581 <sys_ep_grant+0x7a>
+  802573:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802576:	0f b6 c9             	movzbl %cl,%ecx
+  802579:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80257f:	eb 98                	jmp    802519 <sys_ep_grant+0x12>
+  802581:	89 c2                	mov    %eax,%edx
+  802583:	c1 ea 04             	shr    $0x4,%edx
+  802586:	83 e2 0f             	and    $0xf,%edx
+  802589:	83 fa 02             	cmp    $0x2,%edx
+  80258c:	77 e5                	ja     802573 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  80258e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802591:	83 f8 02             	cmp    $0x2,%eax
+  802594:	0f 97 c1             	seta   %cl
+  802597:	0f b6 c9             	movzbl %cl,%ecx
+  80259a:	eb d7                	jmp    802573 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  80259c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025a1:	b8 24 00 00 00       	mov    $0x24,%eax
+  8025a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025ac:	89 df                	mov    %ebx,%edi
+  8025ae:	89 de                	mov    %ebx,%esi
+  8025b0:	cd 30                	int    $0x30
+  8025b2:	eb 90                	jmp    802544 <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8025b4:	83 ec 0c             	sub    $0xc,%esp
+  8025b7:	50                   	push   %eax
+  8025b8:	6a 24                	push   $0x24
+  8025ba:	68 39 31 80 00       	push   $0x803139
+  8025bf:	6a 4a                	push   $0x4a
+  8025c1:	68 56 31 80 00       	push   $0x803156
+  8025c6:	e8 3e dc ff ff       	call   800209 <_panic>
+
+008025cb <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  8025cb:	55                   	push   %ebp
+  8025cc:	89 e5                	mov    %esp,%ebp
+  8025ce:	57                   	push   %edi
+  8025cf:	56                   	push   %esi
+  8025d0:	53                   	push   %ebx
+  8025d1:	83 ec 20             	sub    $0x20,%esp
+  8025d4:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  8025d7:	8b 10                	mov    (%eax),%edx
+  8025d9:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8025dc:	8b 50 04             	mov    0x4(%eax),%edx
+  8025df:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8025e2:	8b 50 08             	mov    0x8(%eax),%edx
+  8025e5:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  8025e8:	8b 50 0c             	mov    0xc(%eax),%edx
+  8025eb:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  8025ee:	8b 40 10             	mov    0x10(%eax),%eax
+  8025f1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  8025f4:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  8025f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025fa:	b8 25 00 00 00       	mov    $0x25,%eax
+  8025ff:	55                   	push   %ebp
+  802600:	56                   	push   %esi
+  802601:	8b 0e                	mov    (%esi),%ecx
+  802603:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802606:	8b 7e 08             	mov    0x8(%esi),%edi
+  802609:	8b 6e 10             	mov    0x10(%esi),%ebp
+  80260c:	8b 76 0c             	mov    0xc(%esi),%esi
+  80260f:	cd 30                	int    $0x30
+  802611:	87 34 24             	xchg   %esi,(%esp)
+  802614:	89 0e                	mov    %ecx,(%esi)
+  802616:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802619:	89 7e 08             	mov    %edi,0x8(%esi)
+  80261c:	89 6e 10             	mov    %ebp,0x10(%esi)
+  80261f:	8f 46 0c             	pop    0xc(%esi)
+  802622:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  802623:	83 c4 20             	add    $0x20,%esp
+  802626:	5b                   	pop    %ebx
+  802627:	5e                   	pop    %esi
+  802628:	5f                   	pop    %edi
+  802629:	5d                   	pop    %ebp
+  80262a:	c3                   	ret
+
+0080262b <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  80262b:	55                   	push   %ebp
+  80262c:	89 e5                	mov    %esp,%ebp
+  80262e:	57                   	push   %edi
+  80262f:	56                   	push   %esi
+  802630:	53                   	push   %ebx
+  802631:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  802634:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802637:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  802639:	8b 55 08             	mov    0x8(%ebp),%edx
+  80263c:	b8 26 00 00 00       	mov    $0x26,%eax
+  802641:	55                   	push   %ebp
+  802642:	56                   	push   %esi
+  802643:	8b 0e                	mov    (%esi),%ecx
+  802645:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802648:	8b 7e 08             	mov    0x8(%esi),%edi
+  80264b:	8b 6e 10             	mov    0x10(%esi),%ebp
+  80264e:	8b 76 0c             	mov    0xc(%esi),%esi
+  802651:	cd 30                	int    $0x30
+  802653:	87 34 24             	xchg   %esi,(%esp)
+  802656:	89 0e                	mov    %ecx,(%esi)
+  802658:	89 5e 04             	mov    %ebx,0x4(%esi)
+  80265b:	89 7e 08             	mov    %edi,0x8(%esi)
+  80265e:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802661:	8f 46 0c             	pop    0xc(%esi)
+  802664:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  802665:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  802669:	74 0f                	je     80267a <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  80266b:	85 c0                	test   %eax,%eax
+  80266d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802672:	0f 48 d1             	cmovs  %ecx,%edx
+  802675:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  802678:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  80267a:	5b                   	pop    %ebx
+  80267b:	5e                   	pop    %esi
+  80267c:	5f                   	pop    %edi
+  80267d:	5d                   	pop    %ebp
+  80267e:	c3                   	ret
+
+0080267f <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  80267f:	55                   	push   %ebp
+  802680:	89 e5                	mov    %esp,%ebp
+  802682:	57                   	push   %edi
+  802683:	56                   	push   %esi
+  802684:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802685:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80268c:	78 2f                	js     8026bd <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  80268e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802695:	74 72                	je     802709 <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  802697:	8b 55 08             	mov    0x8(%ebp),%edx
+  80269a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80269f:	b8 27 00 00 00       	mov    $0x27,%eax
+  8026a4:	89 cb                	mov    %ecx,%ebx
+  8026a6:	89 cf                	mov    %ecx,%edi
+  8026a8:	89 ce                	mov    %ecx,%esi
+  8026aa:	55                   	push   %ebp
+  8026ab:	68 b4 26 80 00       	push   $0x8026b4
+  8026b0:	89 e5                	mov    %esp,%ebp
+  8026b2:	0f 34                	sysenter
+  8026b4:	83 c4 04             	add    $0x4,%esp
+  8026b7:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  8026b8:	5b                   	pop    %ebx
+  8026b9:	5e                   	pop    %esi
+  8026ba:	5f                   	pop    %edi
+  8026bb:	5d                   	pop    %ebp
+  8026bc:	c3                   	ret
+  8026bd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026c2:	0f a2                	cpuid
+		return 0;
+  8026c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8026c9:	f6 c6 08             	test   $0x8,%dh
+  8026cc:	74 15                	je     8026e3 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8026ce:	89 c2                	mov    %eax,%edx
+  8026d0:	c1 ea 08             	shr    $0x8,%edx
+  8026d3:	83 e2 0f             	and    $0xf,%edx
+  8026d6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8026db:	83 fa 06             	cmp    $0x6,%edx
+  8026de:	74 0e                	je     8026ee <sys_sysring_setup+0x6f>
+  8026e0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8026e3:	0f b6 c9             	movzbl %cl,%ecx
+  8026e6:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8026ec:	eb a0                	jmp    80268e <sys_sysring_setup+0xf>
+  8026ee:	89 c2                	mov    %eax,%edx
+  8026f0:	c1 ea 04             	shr    $0x4,%edx
+  8026f3:	83 e2 0f             	and    $0xf,%edx
+  8026f6:	83 fa 02             	cmp    $0x2,%edx
+  8026f9:	77 e5                	ja     8026e0 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  8026fb:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8026fe:	83 f8 02             	cmp    $0x2,%eax
+  802701:	0f 97 c1             	seta   %cl
+  802704:	0f b6 c9             	movzbl %cl,%ecx
+  802707:	eb d7                	jmp    8026e0 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  802709:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80270e:	b8 27 00 00 00       	mov    $0x27,%eax
+  802713:	8b 55 08             	mov    0x8(%ebp),%edx
+  802716:	89 cb                	mov    %ecx,%ebx
+  802718:	89 cf                	mov    %ecx,%edi
+  80271a:	89 ce                	mov    %ecx,%esi
+  80271c:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  80271e:	eb 98                	jmp    8026b8 <sys_sysring_setup+0x39>
+
+00802720 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  802720:	55                   	push   %ebp
+  802721:	89 e5                	mov    %esp,%ebp
+  802723:	57                   	push   %edi
+  802724:	56                   	push   %esi
+  802725:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802726:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80272d:	78 2e                	js     80275d <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  80272f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802736:	74 71                	je     8027a9 <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  802738:	ba 00 00 00 00       	mov    $0x0,%edx
+  80273d:	b8 28 00 00 00       	mov    $0x28,%eax
+  802742:	89 d1                	mov    %edx,%ecx
+  802744:	89 d3                	mov    %edx,%ebx
+  802746:	89 d7                	mov    %edx,%edi
+  802748:	89 d6                	mov    %edx,%esi
+  80274a:	55                   	push   %ebp
+  80274b:	68 54 27 80 00       	push   $0x802754
+  802750:	89 e5                	mov    %esp,%ebp
+  802752:	0f 34                	sysenter
+  802754:	83 c4 04             	add    $0x4,%esp
+  802757:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  802758:	5b                   	pop    %ebx
+  802759:	5e                   	pop    %esi
+  80275a:	5f                   	pop    %edi
+  80275b:	5d                   	pop    %ebp
+  80275c:	c3                   	ret
+  80275d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802762:	0f a2                	cpuid
+		return 0;
+  802764:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802769:	f6 c6 08             	test   $0x8,%dh
+  80276c:	74 15                	je     802783 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80276e:	89 c2                	mov    %eax,%edx
+  802770:	c1 ea 08             	shr    $0x8,%edx
+  802773:	83 e2 0f             	and    $0xf,%edx
+  802776:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80277b:	83 fa 06             	cmp    $0x6,%edx
+  80277e:	74 0e                	je     80278e <sys_sysring_enter+0x6e>
+  802780:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802783:	0f b6 c9             	movzbl %cl,%ecx
+  802786:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80278c:	eb a1                	jmp    80272f <sys_sysring_enter+0xf>
+  80278e:	89 c2                	mov    %eax,%edx
+  802790:	c1 ea 04             	shr    $0x4,%edx
+  802793:	83 e2 0f             	and    $0xf,%edx
+  802796:	83 fa 02             	cmp    $0x2,%edx
+  802799:	77 e5                	ja     802780 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  80279b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80279e:	83 f8 02             	cmp    $0x2,%eax
+  8027a1:	0f 97 c1             	seta   %cl
+  8027a4:	0f b6 c9             	movzbl %cl,%ecx
+  8027a7:	eb d7                	jmp    802780 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  8027a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027ae:	b8 28 00 00 00       	mov    $0x28,%eax
+  8027b3:	89 d1                	mov    %edx,%ecx
+  8027b5:	89 d3                	mov    %edx,%ebx
+  8027b7:	89 d7                	mov    %edx,%edi
+  8027b9:	89 d6                	mov    %edx,%esi
+  8027bb:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  8027bd:	eb 99                	jmp    802758 <sys_sysring_enter+0x38>
+
+008027bf <pgfault>:
+// The kernel normally resolves these faults itself (page_fault_cow in
+// kern/trap.c); we only get here if it ran out of memory doing so.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8027bf:	55                   	push   %ebp
+  8027c0:	89 e5                	mov    %esp,%ebp
+  8027c2:	83 ec 08             	sub    $0x8,%esp
+  8027c5:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  8027c8:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  8027ca:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  8027cd:	f6 c2 02             	test   $0x2,%dl
+  8027d0:	74 40                	je     802812 <pgfault+0x53>
+  8027d2:	89 c1                	mov    %eax,%ecx
+  8027d4:	c1 e9 16             	shr    $0x16,%ecx
+  8027d7:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  8027de:	f6 c1 01             	test   $0x1,%cl
+  8027e1:	74 2f                	je     802812 <pgfault+0x53>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW))
+  8027e3:	89 c1                	mov    %eax,%ecx
+  8027e5:	c1 e9 0c             	shr    $0xc,%ecx
+  8027e8:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  8027ef:	f6 c5 08             	test   $0x8,%ch
+  8027f2:	74 1e                	je     802812 <pgfault+0x53>
+	// Replace the page with a private writable copy of itself.  The
+	// kernel allocates, copies and maps it in one system call, so no
+	// temporary mapping at PFTEMP is needed.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8027f4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r = sys_page_copy(0, addr, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  8027f9:	83 ec 0c             	sub    $0xc,%esp
+  8027fc:	6a 07                	push   $0x7
+  8027fe:	50                   	push   %eax
+  8027ff:	6a 00                	push   $0x0
+  802801:	50                   	push   %eax
+  802802:	6a 00                	push   $0x0
+  802804:	e8 85 eb ff ff       	call   80138e <sys_page_copy>
+  802809:	83 c4 20             	add    $0x20,%esp
+  80280c:	85 c0                	test   %eax,%eax
+  80280e:	78 18                	js     802828 <pgfault+0x69>
+		panic("pgfault: sys_page_copy: %e", r);
+}
+  802810:	c9                   	leave
+  802811:	c3                   	ret
+		panic("pgfault: va %08x err %x is not a copy-on-write write",
+  802812:	83 ec 0c             	sub    $0xc,%esp
+  802815:	52                   	push   %edx
+  802816:	50                   	push   %eax
+  802817:	68 64 31 80 00       	push   $0x803164
+  80281c:	6a 1c                	push   $0x1c
+  80281e:	68 99 31 80 00       	push   $0x803199
+  802823:	e8 e1 d9 ff ff       	call   800209 <_panic>
+		panic("pgfault: sys_page_copy: %e", r);
+  802828:	50                   	push   %eax
+  802829:	68 a4 31 80 00       	push   $0x8031a4
+  80282e:	6a 26                	push   $0x26
+  802830:	68 99 31 80 00       	push   $0x803199
+  802835:	e8 cf d9 ff ff       	call   800209 <_panic>
+
+0080283a <ufork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+ufork(void)
+{
+  80283a:	55                   	push   %ebp
+  80283b:	89 e5                	mov    %esp,%ebp
+  80283d:	57                   	push   %edi
+  80283e:	56                   	push   %esi
+  80283f:	53                   	push   %ebx
+  802840:	81 ec 38 04 00 00    	sub    $0x438,%esp
+	struct page_range vec[PAGE_VEC_MAX], *last;
+	uintptr_t va;
+	size_t n;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  802846:	68 bf 27 80 00       	push   $0x8027bf
+  80284b:	e8 71 02 00 00       	call   802ac1 <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  802850:	b8 07 00 00 00       	mov    $0x7,%eax
+  802855:	cd 30                	int    $0x30
+  802857:	89 85 d4 fb ff ff    	mov    %eax,-0x42c(%ebp)
+
+	envid = sys_exofork();
+	if (envid < 0)
+  80285d:	83 c4 10             	add    $0x10,%esp
+  802860:	85 c0                	test   %eax,%eax
+  802862:	0f 88 f2 01 00 00    	js     802a5a <ufork+0x220>
+		return 0;
+	}
+
+	// Copy every run of mapped pages below the exception stack, which
+	// must not be shared.
+	va = 0;
+  802868:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  80286d:	74 0b                	je     80287a <ufork+0x40>
+  80286f:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  802875:	e9 07 01 00 00       	jmp    802981 <ufork+0x147>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80287a:	e8 22 e8 ff ff       	call   8010a1 <sys_getenvid>
+  80287f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802884:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  80288a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80288f:	a3 08 40 80 00       	mov    %eax,0x804008
+		return 0;
+  802894:	e9 c1 01 00 00       	jmp    802a5a <ufork+0x220>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+		n = r;
+		last = &vec[n - 1];
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  802899:	83 ea 01             	sub    $0x1,%edx
+  80289c:	89 c1                	mov    %eax,%ecx
+  80289e:	c1 e1 04             	shl    $0x4,%ecx
+  8028a1:	89 94 0d ec fd ff ff 	mov    %edx,-0x214(%ebp,%ecx,1)
+			n--;
+  8028a8:	85 d2                	test   %edx,%edx
+  8028aa:	0f 44 f0             	cmove  %eax,%esi
+  8028ad:	e9 12 01 00 00       	jmp    8029c4 <ufork+0x18a>
+	for (i = 0; i < n; i++) {
+  8028b2:	83 c1 01             	add    $0x1,%ecx
+  8028b5:	83 c0 10             	add    $0x10,%eax
+  8028b8:	39 8d e4 fb ff ff    	cmp    %ecx,-0x41c(%ebp)
+  8028be:	74 6a                	je     80292a <ufork+0xf0>
+		vec[i].pr_dstva = vec[i].pr_va;
+  8028c0:	89 c3                	mov    %eax,%ebx
+  8028c2:	8b 10                	mov    (%eax),%edx
+  8028c4:	89 50 0c             	mov    %edx,0xc(%eax)
+		if (vec[i].pr_perm & PTE_SHARE)
+  8028c7:	8b 50 08             	mov    0x8(%eax),%edx
+  8028ca:	f6 c6 04             	test   $0x4,%dh
+  8028cd:	75 e3                	jne    8028b2 <ufork+0x78>
+		if (vec[i].pr_perm & (PTE_W | PTE_COW)) {
+  8028cf:	f7 c2 02 08 00 00    	test   $0x802,%edx
+  8028d5:	74 db                	je     8028b2 <ufork+0x78>
+			vec[i].pr_perm = (vec[i].pr_perm & ~PTE_W) | PTE_COW;
+  8028d7:	81 e2 fd f7 ff ff    	and    $0xfffff7fd,%edx
+  8028dd:	80 ce 08             	or     $0x8,%dh
+  8028e0:	89 95 dc fb ff ff    	mov    %edx,-0x424(%ebp)
+  8028e6:	89 53 08             	mov    %edx,0x8(%ebx)
+			cow[ncow++] = vec[i];
+  8028e9:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  8028ef:	c1 e6 04             	shl    $0x4,%esi
+  8028f2:	89 f2                	mov    %esi,%edx
+  8028f4:	8d b4 35 e8 fb ff ff 	lea    -0x418(%ebp,%esi,1),%esi
+  8028fb:	8b 38                	mov    (%eax),%edi
+  8028fd:	89 bc 15 e8 fb ff ff 	mov    %edi,-0x418(%ebp,%edx,1)
+  802904:	8b 78 04             	mov    0x4(%eax),%edi
+  802907:	89 7e 04             	mov    %edi,0x4(%esi)
+  80290a:	8b bd dc fb ff ff    	mov    -0x424(%ebp),%edi
+  802910:	89 7e 08             	mov    %edi,0x8(%esi)
+  802913:	8b 50 0c             	mov    0xc(%eax),%edx
+  802916:	89 56 0c             	mov    %edx,0xc(%esi)
+  802919:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  80291f:	8d 7e 01             	lea    0x1(%esi),%edi
+  802922:	89 bd e0 fb ff ff    	mov    %edi,-0x420(%ebp)
+  802928:	eb 88                	jmp    8028b2 <ufork+0x78>
+	if ((r = sys_page_map_vec(0, envid, vec, n, 0)) < 0)
+  80292a:	8b b5 e4 fb ff ff    	mov    -0x41c(%ebp),%esi
+  802930:	8b bd d8 fb ff ff    	mov    -0x428(%ebp),%edi
+  802936:	83 ec 0c             	sub    $0xc,%esp
+  802939:	6a 00                	push   $0x0
+  80293b:	56                   	push   %esi
+  80293c:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802942:	50                   	push   %eax
+  802943:	ff b5 d4 fb ff ff    	push   -0x42c(%ebp)
+  802949:	6a 00                	push   $0x0
+  80294b:	e8 80 f4 ff ff       	call   801dd0 <sys_page_map_vec>
+  802950:	83 c4 20             	add    $0x20,%esp
+  802953:	85 c0                	test   %eax,%eax
+  802955:	0f 88 e5 00 00 00    	js     802a40 <ufork+0x206>
+	return sys_page_map_vec(0, 0, cow, ncow, 0);
+  80295b:	83 ec 0c             	sub    $0xc,%esp
+  80295e:	6a 00                	push   $0x0
+  802960:	ff b5 e0 fb ff ff    	push   -0x420(%ebp)
+  802966:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  80296c:	50                   	push   %eax
+  80296d:	6a 00                	push   $0x0
+  80296f:	6a 00                	push   $0x0
+  802971:	e8 5a f4 ff ff       	call   801dd0 <sys_page_map_vec>
+		if ((r = duppages(envid, vec, n)) < 0)
+  802976:	83 c4 20             	add    $0x20,%esp
+  802979:	85 c0                	test   %eax,%eax
+  80297b:	0f 88 e7 00 00 00    	js     802a68 <ufork+0x22e>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+  802981:	6a 20                	push   $0x20
+  802983:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802989:	50                   	push   %eax
+  80298a:	57                   	push   %edi
+  80298b:	6a 00                	push   $0x0
+  80298d:	e8 82 f4 ff ff       	call   801e14 <sys_vm_ranges>
+  802992:	83 c4 10             	add    $0x10,%esp
+  802995:	85 c0                	test   %eax,%eax
+  802997:	7e 51                	jle    8029ea <ufork+0x1b0>
+		n = r;
+  802999:	89 c6                	mov    %eax,%esi
+		last = &vec[n - 1];
+  80299b:	83 e8 01             	sub    $0x1,%eax
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+  80299e:	89 c1                	mov    %eax,%ecx
+  8029a0:	c1 e1 04             	shl    $0x4,%ecx
+  8029a3:	8b 94 0d ec fd ff ff 	mov    -0x214(%ebp,%ecx,1),%edx
+  8029aa:	89 d3                	mov    %edx,%ebx
+  8029ac:	c1 e3 0c             	shl    $0xc,%ebx
+  8029af:	89 df                	mov    %ebx,%edi
+  8029b1:	03 bc 0d e8 fd ff ff 	add    -0x218(%ebp,%ecx,1),%edi
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  8029b8:	81 ff 00 00 c0 ee    	cmp    $0xeec00000,%edi
+  8029be:	0f 84 d5 fe ff ff    	je     802899 <ufork+0x5f>
+	for (i = 0; i < n; i++) {
+  8029c4:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+	size_t i, ncow = 0;
+  8029ca:	c7 85 e0 fb ff ff 00 	movl   $0x0,-0x420(%ebp)
+  8029d1:	00 00 00 
+	for (i = 0; i < n; i++) {
+  8029d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029d9:	89 bd d8 fb ff ff    	mov    %edi,-0x428(%ebp)
+  8029df:	89 b5 e4 fb ff ff    	mov    %esi,-0x41c(%ebp)
+  8029e5:	e9 ce fe ff ff       	jmp    8028b8 <ufork+0x7e>
+			goto fail;
+	}
+	if (r < 0)
+  8029ea:	89 c6                	mov    %eax,%esi
+  8029ec:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  8029f2:	85 c0                	test   %eax,%eax
+  8029f4:	78 52                	js     802a48 <ufork+0x20e>
+		goto fail;
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE),
+  8029f6:	83 ec 04             	sub    $0x4,%esp
+  8029f9:	6a 07                	push   $0x7
+  8029fb:	68 00 f0 bf ee       	push   $0xeebff000
+  802a00:	53                   	push   %ebx
+  802a01:	e8 3a e7 ff ff       	call   801140 <sys_page_alloc>
+  802a06:	89 c6                	mov    %eax,%esi
+  802a08:	83 c4 10             	add    $0x10,%esp
+  802a0b:	85 c0                	test   %eax,%eax
+  802a0d:	78 39                	js     802a48 <ufork+0x20e>
+				PTE_P | PTE_U | PTE_W)) < 0
+	    || (r = sys_env_set_pgfault_upcall(envid,
+			thisenv->env_pgfault_upcall)) < 0
+  802a0f:	a1 08 40 80 00       	mov    0x804008,%eax
+  802a14:	8b 40 74             	mov    0x74(%eax),%eax
+	    || (r = sys_env_set_pgfault_upcall(envid,
+  802a17:	83 ec 08             	sub    $0x8,%esp
+  802a1a:	50                   	push   %eax
+  802a1b:	53                   	push   %ebx
+  802a1c:	e8 de ed ff ff       	call   8017ff <sys_env_set_pgfault_upcall>
+  802a21:	89 c6                	mov    %eax,%esi
+  802a23:	83 c4 10             	add    $0x10,%esp
+  802a26:	85 c0                	test   %eax,%eax
+  802a28:	78 1e                	js     802a48 <ufork+0x20e>
+	    || (r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  802a2a:	83 ec 08             	sub    $0x8,%esp
+  802a2d:	6a 02                	push   $0x2
+  802a2f:	53                   	push   %ebx
+  802a30:	e8 bc ea ff ff       	call   8014f1 <sys_env_set_status>
+  802a35:	89 c6                	mov    %eax,%esi
+  802a37:	83 c4 10             	add    $0x10,%esp
+  802a3a:	85 c0                	test   %eax,%eax
+  802a3c:	79 1c                	jns    802a5a <ufork+0x220>
+  802a3e:	eb 08                	jmp    802a48 <ufork+0x20e>
+  802a40:	89 c6                	mov    %eax,%esi
+  802a42:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+		goto fail;
+	return envid;
+
+fail:
+	sys_env_destroy(envid);
+  802a48:	83 ec 0c             	sub    $0xc,%esp
+  802a4b:	53                   	push   %ebx
+  802a4c:	e8 8e e5 ff ff       	call   800fdf <sys_env_destroy>
+	return r;
+  802a51:	83 c4 10             	add    $0x10,%esp
+  802a54:	89 b5 d4 fb ff ff    	mov    %esi,-0x42c(%ebp)
+}
+  802a5a:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+  802a60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a63:	5b                   	pop    %ebx
+  802a64:	5e                   	pop    %esi
+  802a65:	5f                   	pop    %edi
+  802a66:	5d                   	pop    %ebp
+  802a67:	c3                   	ret
+  802a68:	89 c6                	mov    %eax,%esi
+  802a6a:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  802a70:	eb d6                	jmp    802a48 <ufork+0x20e>
+
+00802a72 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  802a72:	55                   	push   %ebp
+  802a73:	89 e5                	mov    %esp,%ebp
+  802a75:	53                   	push   %ebx
+  802a76:	83 ec 04             	sub    $0x4,%esp
+	envid_t envid;
+
+	envid = sys_fork();
+  802a79:	e8 90 f2 ff ff       	call   801d0e <sys_fork>
+  802a7e:	89 c3                	mov    %eax,%ebx
+	if (envid == 0)
+  802a80:	85 c0                	test   %eax,%eax
+  802a82:	74 07                	je     802a8b <fork+0x19>
+		thisenv = &envs[ENVX(sys_getenvid())];
+	return envid;
+}
+  802a84:	89 d8                	mov    %ebx,%eax
+  802a86:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a89:	c9                   	leave
+  802a8a:	c3                   	ret
+		thisenv = &envs[ENVX(sys_getenvid())];
+  802a8b:	e8 11 e6 ff ff       	call   8010a1 <sys_getenvid>
+  802a90:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802a95:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802a9b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802aa0:	a3 08 40 80 00       	mov    %eax,0x804008
+	return envid;
+  802aa5:	eb dd                	jmp    802a84 <fork+0x12>
+
+00802aa7 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  802aa7:	55                   	push   %ebp
+  802aa8:	89 e5                	mov    %esp,%ebp
+  802aaa:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  802aad:	68 bf 31 80 00       	push   $0x8031bf
+  802ab2:	68 a1 00 00 00       	push   $0xa1
+  802ab7:	68 99 31 80 00       	push   $0x803199
+  802abc:	e8 48 d7 ff ff       	call   800209 <_panic>
+
+00802ac1 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802ac1:	55                   	push   %ebp
+  802ac2:	89 e5                	mov    %esp,%ebp
+  802ac4:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  802ac7:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  802ace:	74 0a                	je     802ada <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  802ad0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ad3:	a3 0c 40 80 00       	mov    %eax,0x80400c
+}
+  802ad8:	c9                   	leave
+  802ad9:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE),
+  802ada:	83 ec 04             	sub    $0x4,%esp
+  802add:	6a 07                	push   $0x7
+  802adf:	68 00 f0 bf ee       	push   $0xeebff000
+  802ae4:	6a 00                	push   $0x0
+  802ae6:	e8 55 e6 ff ff       	call   801140 <sys_page_alloc>
+  802aeb:	83 c4 10             	add    $0x10,%esp
+  802aee:	85 c0                	test   %eax,%eax
+  802af0:	78 28                	js     802b1a <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  802af2:	83 ec 08             	sub    $0x8,%esp
+  802af5:	68 2c 2b 80 00       	push   $0x802b2c
+  802afa:	6a 00                	push   $0x0
+  802afc:	e8 fe ec ff ff       	call   8017ff <sys_env_set_pgfault_upcall>
+  802b01:	83 c4 10             	add    $0x10,%esp
+  802b04:	85 c0                	test   %eax,%eax
+  802b06:	79 c8                	jns    802ad0 <set_pgfault_handler+0xf>
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+  802b08:	50                   	push   %eax
+  802b09:	68 00 32 80 00       	push   $0x803200
+  802b0e:	6a 24                	push   $0x24
+  802b10:	68 34 32 80 00       	push   $0x803234
+  802b15:	e8 ef d6 ff ff       	call   800209 <_panic>
+			panic("set_pgfault_handler: sys_page_alloc: %e", r);
+  802b1a:	50                   	push   %eax
+  802b1b:	68 d8 31 80 00       	push   $0x8031d8
+  802b20:	6a 22                	push   $0x22
+  802b22:	68 34 32 80 00       	push   $0x803234
+  802b27:	e8 dd d6 ff ff       	call   800209 <_panic>
+
+00802b2c <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802b2c:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802b2d:	a1 0c 40 80 00       	mov    0x80400c,%eax
+	call *%eax
+  802b32:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802b34:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 0x28(%esp), %ebx		// trap-time eip
+  802b37:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl 0x30(%esp), %eax		// trap-time esp
+  802b3b:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  802b3f:	83 e8 04             	sub    $0x4,%eax
+	movl %ebx, (%eax)
+  802b42:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 0x30(%esp)
+  802b44:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp			// skip fault_va and err
+  802b48:	83 c4 08             	add    $0x8,%esp
+	popal
+  802b4b:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp			// skip eip
+  802b4c:	83 c4 04             	add    $0x4,%esp
+	popfl
+  802b4f:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802b50:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802b51:	c3                   	ret
+
+00802b52 <dm>:
+  802b52:	55                   	push   %ebp
+  802b53:	57                   	push   %edi
+  802b54:	56                   	push   %esi
+  802b55:	53                   	push   %ebx
+  802b56:	83 ec 24             	sub    $0x24,%esp
+  802b59:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802b5d:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802b61:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802b65:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802b69:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802b6d:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802b71:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802b75:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b7f:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802b84:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802b8b:	00 
+  802b8c:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802b93:	00 
+  802b94:	89 fb                	mov    %edi,%ebx
+  802b96:	eb 08                	jmp    802ba0 <dm+0x4e>
+  802b98:	83 e9 01             	sub    $0x1,%ecx
+  802b9b:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802b9e:	74 68                	je     802c08 <dm+0xb6>
+  802ba0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802ba4:	01 c0                	add    %eax,%eax
+  802ba6:	89 c6                	mov    %eax,%esi
+  802ba8:	89 d7                	mov    %edx,%edi
+  802baa:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802bae:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802bb2:	0f ad d0             	shrd   %cl,%edx,%eax
+  802bb5:	d3 ea                	shr    %cl,%edx
+  802bb7:	f6 c1 20             	test   $0x20,%cl
+  802bba:	74 04                	je     802bc0 <dm+0x6e>
+  802bbc:	89 d0                	mov    %edx,%eax
+  802bbe:	31 d2                	xor    %edx,%edx
+  802bc0:	83 e0 01             	and    $0x1,%eax
+  802bc3:	89 04 24             	mov    %eax,(%esp)
+  802bc6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802bcd:	00 
+  802bce:	8b 04 24             	mov    (%esp),%eax
+  802bd1:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802bd5:	09 f0                	or     %esi,%eax
+  802bd7:	09 fa                	or     %edi,%edx
+  802bd9:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802bdd:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802be1:	39 f0                	cmp    %esi,%eax
+  802be3:	89 d5                	mov    %edx,%ebp
+  802be5:	19 fd                	sbb    %edi,%ebp
+  802be7:	72 af                	jb     802b98 <dm+0x46>
+  802be9:	29 f0                	sub    %esi,%eax
+  802beb:	19 fa                	sbb    %edi,%edx
+  802bed:	89 cf                	mov    %ecx,%edi
+  802bef:	c1 ef 05             	shr    $0x5,%edi
+  802bf2:	83 e7 01             	and    $0x1,%edi
+  802bf5:	89 fe                	mov    %edi,%esi
+  802bf7:	83 f6 01             	xor    $0x1,%esi
+  802bfa:	d3 e6                	shl    %cl,%esi
+  802bfc:	d3 e7                	shl    %cl,%edi
+  802bfe:	09 74 24 18          	or     %esi,0x18(%esp)
+  802c02:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802c06:	eb 90                	jmp    802b98 <dm+0x46>
+  802c08:	85 db                	test   %ebx,%ebx
+  802c0a:	74 05                	je     802c11 <dm+0xbf>
+  802c0c:	89 03                	mov    %eax,(%ebx)
+  802c0e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802c11:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802c15:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802c19:	83 c4 24             	add    $0x24,%esp
+  802c1c:	5b                   	pop    %ebx
+  802c1d:	5e                   	pop    %esi
+  802c1e:	5f                   	pop    %edi
+  802c1f:	5d                   	pop    %ebp
+  802c20:	c3                   	ret
+
+00802c21 <__udivdi3>:
+  802c21:	83 ec 08             	sub    $0x8,%esp
+  802c24:	6a 00                	push   $0x0
+  802c26:	ff 74 24 1c          	push   0x1c(%esp)
+  802c2a:	ff 74 24 1c          	push   0x1c(%esp)
+  802c2e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802c32:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802c36:	e8 17 ff ff ff       	call   802b52 <dm>
+  802c3b:	83 c4 14             	add    $0x14,%esp
+  802c3e:	c3                   	ret
+
+00802c3f <__umoddi3>:
+  802c3f:	83 ec 18             	sub    $0x18,%esp
+  802c42:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802c46:	50                   	push   %eax
+  802c47:	ff 74 24 2c          	push   0x2c(%esp)
+  802c4b:	ff 74 24 2c          	push   0x2c(%esp)
+  802c4f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802c53:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802c57:	e8 f6 fe ff ff       	call   802b52 <dm>
+  802c5c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802c60:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802c64:	83 c4 24             	add    $0x24,%esp
+  802c67:	c3                   	ret
+
+00802c68 <__divdi3>:
+  802c68:	53                   	push   %ebx
+  802c69:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802c6d:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802c71:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  802c75:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  802c79:	85 d2                	test   %edx,%edx
+  802c7b:	78 15                	js     802c92 <__divdi3+0x2a>
+  802c7d:	85 db                	test   %ebx,%ebx
+  802c7f:	78 34                	js     802cb5 <__divdi3+0x4d>
+  802c81:	83 ec 04             	sub    $0x4,%esp
+  802c84:	6a 00                	push   $0x0
+  802c86:	53                   	push   %ebx
+  802c87:	51                   	push   %ecx
+  802c88:	e8 c5 fe ff ff       	call   802b52 <dm>
+  802c8d:	83 c4 10             	add    $0x10,%esp
+  802c90:	eb 21                	jmp    802cb3 <__divdi3+0x4b>
+  802c92:	f7 d8                	neg    %eax
+  802c94:	83 d2 00             	adc    $0x0,%edx
+  802c97:	f7 da                	neg    %edx
+  802c99:	85 db                	test   %ebx,%ebx
+  802c9b:	78 30                	js     802ccd <__divdi3+0x65>
+  802c9d:	83 ec 04             	sub    $0x4,%esp
+  802ca0:	6a 00                	push   $0x0
+  802ca2:	53                   	push   %ebx
+  802ca3:	51                   	push   %ecx
+  802ca4:	e8 a9 fe ff ff       	call   802b52 <dm>
+  802ca9:	83 c4 10             	add    $0x10,%esp
+  802cac:	f7 d8                	neg    %eax
+  802cae:	83 d2 00             	adc    $0x0,%edx
+  802cb1:	f7 da                	neg    %edx
+  802cb3:	5b                   	pop    %ebx
+  802cb4:	c3                   	ret
+  802cb5:	83 ec 04             	sub    $0x4,%esp
+  802cb8:	6a 00                	push   $0x0
+  802cba:	f7 d9                	neg    %ecx
+  802cbc:	83 d3 00             	adc    $0x0,%ebx
+  802cbf:	f7 db                	neg    %ebx
+  802cc1:	53                   	push   %ebx
+  802cc2:	51                   	push   %ecx
+  802cc3:	e8 8a fe ff ff       	call   802b52 <dm>
+  802cc8:	83 c4 10             	add    $0x10,%esp
+  802ccb:	eb df                	jmp    802cac <__divdi3+0x44>
+  802ccd:	83 ec 04             	sub    $0x4,%esp
+  802cd0:	6a 00                	push   $0x0
+  802cd2:	f7 d9                	neg    %ecx
+  802cd4:	83 d3 00             	adc    $0x0,%ebx
+  802cd7:	f7 db                	neg    %ebx
+  802cd9:	53                   	push   %ebx
+  802cda:	51                   	push   %ecx
+  802cdb:	e8 72 fe ff ff       	call   802b52 <dm>
+  802ce0:	83 c4 10             	add    $0x10,%esp
+  802ce3:	eb ce                	jmp    802cb3 <__divdi3+0x4b>
+
+00802ce5 <__moddi3>:
+  802ce5:	55                   	push   %ebp
+  802ce6:	57                   	push   %edi
+  802ce7:	56                   	push   %esi
+  802ce8:	53                   	push   %ebx
+  802ce9:	83 ec 18             	sub    $0x18,%esp
+  802cec:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802cf0:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802cf4:	89 f1                	mov    %esi,%ecx
+  802cf6:	f7 d9                	neg    %ecx
+  802cf8:	89 da                	mov    %ebx,%edx
+  802cfa:	83 d2 00             	adc    $0x0,%edx
+  802cfd:	f7 da                	neg    %edx
+  802cff:	0f 48 ce             	cmovs  %esi,%ecx
+  802d02:	0f 48 d3             	cmovs  %ebx,%edx
+  802d05:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802d09:	50                   	push   %eax
+  802d0a:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802d0e:	f7 de                	neg    %esi
+  802d10:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802d14:	83 d0 00             	adc    $0x0,%eax
+  802d17:	f7 d8                	neg    %eax
+  802d19:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802d1e:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802d23:	50                   	push   %eax
+  802d24:	56                   	push   %esi
+  802d25:	89 c8                	mov    %ecx,%eax
+  802d27:	e8 26 fe ff ff       	call   802b52 <dm>
+  802d2c:	83 c4 10             	add    $0x10,%esp
+  802d2f:	85 db                	test   %ebx,%ebx
+  802d31:	78 10                	js     802d43 <__moddi3+0x5e>
+  802d33:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802d37:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802d3b:	83 c4 14             	add    $0x14,%esp
+  802d3e:	5b                   	pop    %ebx
+  802d3f:	5e                   	pop    %esi
+  802d40:	5f                   	pop    %edi
+  802d41:	5d                   	pop    %ebp
+  802d42:	c3                   	ret
+  802d43:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802d47:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802d4b:	f7 d8                	neg    %eax
+  802d4d:	83 d2 00             	adc    $0x0,%edx
+  802d50:	f7 da                	neg    %edx
+  802d52:	eb e7                	jmp    802d3b <__moddi3+0x56>
@@ -0,0 +1,5143 @@
+
+obj/user/divzero:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 23 00 00 00       	call   800054 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+int zero;
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	zero = 0;
+  800039:	c7 05 08 30 80 00 00 	movl   $0x0,0x803008
+  800040:	00 00 00 
+	cprintf("1/0 is %08x!\n", 1/zero);
+  800043:	6a 00                	push   $0x0
+  800045:	68 80 28 80 00       	push   $0x802880
+  80004a:	e8 f5 00 00 00       	call   800144 <cprintf>
+}
+  80004f:	83 c4 10             	add    $0x10,%esp
+  800052:	c9                   	leave
+  800053:	c3                   	ret
+
+00800054 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800054:	55                   	push   %ebp
+  800055:	89 e5                	mov    %esp,%ebp
+  800057:	56                   	push   %esi
+  800058:	53                   	push   %ebx
+  800059:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80005c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  80005f:	e8 64 0e 00 00       	call   800ec8 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  800064:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800069:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  80006f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800074:	a3 0c 30 80 00       	mov    %eax,0x80300c
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800079:	85 db                	test   %ebx,%ebx
+  80007b:	7e 07                	jle    800084 <libmain+0x30>
+		binaryname = argv[0];
+  80007d:	8b 06                	mov    (%esi),%eax
+  80007f:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  800084:	83 ec 08             	sub    $0x8,%esp
+  800087:	56                   	push   %esi
+  800088:	53                   	push   %ebx
+  800089:	e8 a5 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80008e:	e8 0a 00 00 00       	call   80009d <exit>
+}
+  800093:	83 c4 10             	add    $0x10,%esp
+  800096:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800099:	5b                   	pop    %ebx
+  80009a:	5e                   	pop    %esi
+  80009b:	5d                   	pop    %ebp
+  80009c:	c3                   	ret
+
+0080009d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80009d:	55                   	push   %ebp
+  80009e:	89 e5                	mov    %esp,%ebp
+  8000a0:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  8000a3:	6a 00                	push   $0x0
+  8000a5:	e8 5c 0d 00 00       	call   800e06 <sys_env_destroy>
+}
+  8000aa:	83 c4 10             	add    $0x10,%esp
+  8000ad:	c9                   	leave
+  8000ae:	c3                   	ret
+
+008000af <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000af:	55                   	push   %ebp
+  8000b0:	89 e5                	mov    %esp,%ebp
+  8000b2:	53                   	push   %ebx
+  8000b3:	83 ec 04             	sub    $0x4,%esp
+  8000b6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8000b9:	8b 13                	mov    (%ebx),%edx
+  8000bb:	8d 42 01             	lea    0x1(%edx),%eax
+  8000be:	89 03                	mov    %eax,(%ebx)
+  8000c0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000c3:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8000c7:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8000cc:	74 09                	je     8000d7 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8000ce:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8000d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000d5:	c9                   	leave
+  8000d6:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8000d7:	83 ec 08             	sub    $0x8,%esp
+  8000da:	68 ff 00 00 00       	push   $0xff
+  8000df:	8d 43 08             	lea    0x8(%ebx),%eax
+  8000e2:	50                   	push   %eax
+  8000e3:	e8 e2 0b 00 00       	call   800cca <sys_cputs>
+		b->idx = 0;
+  8000e8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8000ee:	83 c4 10             	add    $0x10,%esp
+  8000f1:	eb db                	jmp    8000ce <putch+0x1f>
+
+008000f3 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8000f3:	55                   	push   %ebp
+  8000f4:	89 e5                	mov    %esp,%ebp
+  8000f6:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8000fc:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800103:	00 00 00 
+	b.cnt = 0;
+  800106:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80010d:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800110:	ff 75 0c             	push   0xc(%ebp)
+  800113:	ff 75 08             	push   0x8(%ebp)
+  800116:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80011c:	50                   	push   %eax
+  80011d:	68 af 00 80 00       	push   $0x8000af
+  800122:	e8 14 01 00 00       	call   80023b <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800127:	83 c4 08             	add    $0x8,%esp
+  80012a:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800130:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800136:	50                   	push   %eax
+  800137:	e8 8e 0b 00 00       	call   800cca <sys_cputs>
+
+	return b.cnt;
+}
+  80013c:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800142:	c9                   	leave
+  800143:	c3                   	ret
+
+00800144 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800144:	55                   	push   %ebp
+  800145:	89 e5                	mov    %esp,%ebp
+  800147:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80014a:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80014d:	50                   	push   %eax
+  80014e:	ff 75 08             	push   0x8(%ebp)
+  800151:	e8 9d ff ff ff       	call   8000f3 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800156:	c9                   	leave
+  800157:	c3                   	ret
+
+00800158 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800158:	55                   	push   %ebp
+  800159:	89 e5                	mov    %esp,%ebp
+  80015b:	57                   	push   %edi
+  80015c:	56                   	push   %esi
+  80015d:	53                   	push   %ebx
+  80015e:	83 ec 1c             	sub    $0x1c,%esp
+  800161:	89 c7                	mov    %eax,%edi
+  800163:	89 d6                	mov    %edx,%esi
+  800165:	8b 45 08             	mov    0x8(%ebp),%eax
+  800168:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80016b:	89 d1                	mov    %edx,%ecx
+  80016d:	89 c2                	mov    %eax,%edx
+  80016f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800172:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800175:	8b 45 10             	mov    0x10(%ebp),%eax
+  800178:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80017b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80017e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800185:	39 c2                	cmp    %eax,%edx
+  800187:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80018a:	72 3e                	jb     8001ca <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80018c:	83 ec 0c             	sub    $0xc,%esp
+  80018f:	ff 75 18             	push   0x18(%ebp)
+  800192:	83 eb 01             	sub    $0x1,%ebx
+  800195:	53                   	push   %ebx
+  800196:	50                   	push   %eax
+  800197:	83 ec 08             	sub    $0x8,%esp
+  80019a:	ff 75 e4             	push   -0x1c(%ebp)
+  80019d:	ff 75 e0             	push   -0x20(%ebp)
+  8001a0:	ff 75 dc             	push   -0x24(%ebp)
+  8001a3:	ff 75 d8             	push   -0x28(%ebp)
+  8001a6:	e8 89 25 00 00       	call   802734 <__udivdi3>
+  8001ab:	83 c4 18             	add    $0x18,%esp
+  8001ae:	52                   	push   %edx
+  8001af:	50                   	push   %eax
+  8001b0:	89 f2                	mov    %esi,%edx
+  8001b2:	89 f8                	mov    %edi,%eax
+  8001b4:	e8 9f ff ff ff       	call   800158 <printnum>
+  8001b9:	83 c4 20             	add    $0x20,%esp
+  8001bc:	eb 13                	jmp    8001d1 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8001be:	83 ec 08             	sub    $0x8,%esp
+  8001c1:	56                   	push   %esi
+  8001c2:	ff 75 18             	push   0x18(%ebp)
+  8001c5:	ff d7                	call   *%edi
+  8001c7:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8001ca:	83 eb 01             	sub    $0x1,%ebx
+  8001cd:	85 db                	test   %ebx,%ebx
+  8001cf:	7f ed                	jg     8001be <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8001d1:	83 ec 08             	sub    $0x8,%esp
+  8001d4:	56                   	push   %esi
+  8001d5:	83 ec 04             	sub    $0x4,%esp
+  8001d8:	ff 75 e4             	push   -0x1c(%ebp)
+  8001db:	ff 75 e0             	push   -0x20(%ebp)
+  8001de:	ff 75 dc             	push   -0x24(%ebp)
+  8001e1:	ff 75 d8             	push   -0x28(%ebp)
+  8001e4:	e8 69 25 00 00       	call   802752 <__umoddi3>
+  8001e9:	83 c4 14             	add    $0x14,%esp
+  8001ec:	0f be 80 98 28 80 00 	movsbl 0x802898(%eax),%eax
+  8001f3:	50                   	push   %eax
+  8001f4:	ff d7                	call   *%edi
+}
+  8001f6:	83 c4 10             	add    $0x10,%esp
+  8001f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001fc:	5b                   	pop    %ebx
+  8001fd:	5e                   	pop    %esi
+  8001fe:	5f                   	pop    %edi
+  8001ff:	5d                   	pop    %ebp
+  800200:	c3                   	ret
+
+00800201 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800201:	55                   	push   %ebp
+  800202:	89 e5                	mov    %esp,%ebp
+  800204:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800207:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80020b:	8b 10                	mov    (%eax),%edx
+  80020d:	3b 50 04             	cmp    0x4(%eax),%edx
+  800210:	73 0a                	jae    80021c <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800212:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800215:	89 08                	mov    %ecx,(%eax)
+  800217:	8b 45 08             	mov    0x8(%ebp),%eax
+  80021a:	88 02                	mov    %al,(%edx)
+}
+  80021c:	5d                   	pop    %ebp
+  80021d:	c3                   	ret
+
+0080021e <printfmt>:
+{
+  80021e:	55                   	push   %ebp
+  80021f:	89 e5                	mov    %esp,%ebp
+  800221:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800224:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800227:	50                   	push   %eax
+  800228:	ff 75 10             	push   0x10(%ebp)
+  80022b:	ff 75 0c             	push   0xc(%ebp)
+  80022e:	ff 75 08             	push   0x8(%ebp)
+  800231:	e8 05 00 00 00       	call   80023b <vprintfmt>
+}
+  800236:	83 c4 10             	add    $0x10,%esp
+  800239:	c9                   	leave
+  80023a:	c3                   	ret
+
+0080023b <vprintfmt>:
+{
+  80023b:	55                   	push   %ebp
+  80023c:	89 e5                	mov    %esp,%ebp
+  80023e:	57                   	push   %edi
+  80023f:	56                   	push   %esi
+  800240:	53                   	push   %ebx
+  800241:	83 ec 2c             	sub    $0x2c,%esp
+  800244:	8b 75 08             	mov    0x8(%ebp),%esi
+  800247:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80024a:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80024d:	eb 0a                	jmp    800259 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80024f:	83 ec 08             	sub    $0x8,%esp
+  800252:	53                   	push   %ebx
+  800253:	50                   	push   %eax
+  800254:	ff d6                	call   *%esi
+  800256:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800259:	83 c7 01             	add    $0x1,%edi
+  80025c:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800260:	83 f8 25             	cmp    $0x25,%eax
+  800263:	74 0c                	je     800271 <vprintfmt+0x36>
+			if (ch == '\0')
+  800265:	85 c0                	test   %eax,%eax
+  800267:	75 e6                	jne    80024f <vprintfmt+0x14>
+}
+  800269:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80026c:	5b                   	pop    %ebx
+  80026d:	5e                   	pop    %esi
+  80026e:	5f                   	pop    %edi
+  80026f:	5d                   	pop    %ebp
+  800270:	c3                   	ret
+		padc = ' ';
+  800271:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800275:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80027c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800283:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80028a:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80028f:	8d 47 01             	lea    0x1(%edi),%eax
+  800292:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800295:	0f b6 17             	movzbl (%edi),%edx
+  800298:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80029b:	3c 55                	cmp    $0x55,%al
+  80029d:	0f 87 cf 03 00 00    	ja     800672 <vprintfmt+0x437>
+  8002a3:	0f b6 c0             	movzbl %al,%eax
+  8002a6:	ff 24 85 80 29 80 00 	jmp    *0x802980(,%eax,4)
+  8002ad:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8002b0:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002b4:	eb d9                	jmp    80028f <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8002b6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002b9:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8002bd:	eb d0                	jmp    80028f <vprintfmt+0x54>
+  8002bf:	0f b6 d2             	movzbl %dl,%edx
+  8002c2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8002c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ca:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8002cd:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8002d0:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8002d4:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8002d7:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8002da:	83 f9 09             	cmp    $0x9,%ecx
+  8002dd:	77 55                	ja     800334 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8002df:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8002e2:	eb e9                	jmp    8002cd <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8002e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002e7:	8b 00                	mov    (%eax),%eax
+  8002e9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8002ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002ef:	8d 40 04             	lea    0x4(%eax),%eax
+  8002f2:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8002f5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8002f8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8002fc:	79 91                	jns    80028f <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8002fe:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800301:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800304:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80030b:	eb 82                	jmp    80028f <vprintfmt+0x54>
+			if (width < 0)
+  80030d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800310:	85 d2                	test   %edx,%edx
+  800312:	b8 00 00 00 00       	mov    $0x0,%eax
+  800317:	0f 49 c2             	cmovns %edx,%eax
+  80031a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80031d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800320:	e9 6a ff ff ff       	jmp    80028f <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800325:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800328:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80032f:	e9 5b ff ff ff       	jmp    80028f <vprintfmt+0x54>
+  800334:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800337:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80033a:	eb bc                	jmp    8002f8 <vprintfmt+0xbd>
+			lflag++;
+  80033c:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80033f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800342:	e9 48 ff ff ff       	jmp    80028f <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800347:	8b 45 14             	mov    0x14(%ebp),%eax
+  80034a:	8d 78 04             	lea    0x4(%eax),%edi
+  80034d:	83 ec 08             	sub    $0x8,%esp
+  800350:	53                   	push   %ebx
+  800351:	ff 30                	push   (%eax)
+  800353:	ff d6                	call   *%esi
+			break;
+  800355:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800358:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80035b:	e9 b1 02 00 00       	jmp    800611 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800360:	8b 45 14             	mov    0x14(%ebp),%eax
+  800363:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800366:	8b 10                	mov    (%eax),%edx
+  800368:	89 d0                	mov    %edx,%eax
+  80036a:	f7 d8                	neg    %eax
+  80036c:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80036f:	83 f8 0d             	cmp    $0xd,%eax
+  800372:	7f 23                	jg     800397 <vprintfmt+0x15c>
+  800374:	8b 14 85 e0 2a 80 00 	mov    0x802ae0(,%eax,4),%edx
+  80037b:	85 d2                	test   %edx,%edx
+  80037d:	74 18                	je     800397 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80037f:	52                   	push   %edx
+  800380:	68 b9 28 80 00       	push   $0x8028b9
+  800385:	53                   	push   %ebx
+  800386:	56                   	push   %esi
+  800387:	e8 92 fe ff ff       	call   80021e <printfmt>
+  80038c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80038f:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800392:	e9 7a 02 00 00       	jmp    800611 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800397:	50                   	push   %eax
+  800398:	68 b0 28 80 00       	push   $0x8028b0
+  80039d:	53                   	push   %ebx
+  80039e:	56                   	push   %esi
+  80039f:	e8 7a fe ff ff       	call   80021e <printfmt>
+  8003a4:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003a7:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003aa:	e9 62 02 00 00       	jmp    800611 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b2:	83 c0 04             	add    $0x4,%eax
+  8003b5:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003bb:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8003bd:	85 c9                	test   %ecx,%ecx
+  8003bf:	b8 a9 28 80 00       	mov    $0x8028a9,%eax
+  8003c4:	0f 45 c1             	cmovne %ecx,%eax
+  8003c7:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8003ca:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003ce:	7e 06                	jle    8003d6 <vprintfmt+0x19b>
+  8003d0:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8003d4:	75 0b                	jne    8003e1 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8003d6:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8003d9:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8003dc:	89 75 08             	mov    %esi,0x8(%ebp)
+  8003df:	eb 5c                	jmp    80043d <vprintfmt+0x202>
+  8003e1:	83 ec 08             	sub    $0x8,%esp
+  8003e4:	ff 75 d0             	push   -0x30(%ebp)
+  8003e7:	ff 75 cc             	push   -0x34(%ebp)
+  8003ea:	e8 20 03 00 00       	call   80070f <strnlen>
+  8003ef:	89 c2                	mov    %eax,%edx
+  8003f1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8003f4:	29 d0                	sub    %edx,%eax
+  8003f6:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8003f9:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8003fd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800400:	89 75 08             	mov    %esi,0x8(%ebp)
+  800403:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800405:	eb 0e                	jmp    800415 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800407:	83 ec 08             	sub    $0x8,%esp
+  80040a:	53                   	push   %ebx
+  80040b:	57                   	push   %edi
+  80040c:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80040f:	83 ee 01             	sub    $0x1,%esi
+  800412:	83 c4 10             	add    $0x10,%esp
+  800415:	85 f6                	test   %esi,%esi
+  800417:	7f ee                	jg     800407 <vprintfmt+0x1cc>
+  800419:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80041c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80041f:	85 c0                	test   %eax,%eax
+  800421:	ba 00 00 00 00       	mov    $0x0,%edx
+  800426:	0f 49 d0             	cmovns %eax,%edx
+  800429:	29 d0                	sub    %edx,%eax
+  80042b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80042e:	eb a6                	jmp    8003d6 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800430:	83 ec 08             	sub    $0x8,%esp
+  800433:	53                   	push   %ebx
+  800434:	52                   	push   %edx
+  800435:	ff 55 08             	call   *0x8(%ebp)
+  800438:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80043b:	89 f1                	mov    %esi,%ecx
+  80043d:	8d 71 01             	lea    0x1(%ecx),%esi
+  800440:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800444:	0f be d0             	movsbl %al,%edx
+  800447:	85 d2                	test   %edx,%edx
+  800449:	74 28                	je     800473 <vprintfmt+0x238>
+  80044b:	85 ff                	test   %edi,%edi
+  80044d:	78 05                	js     800454 <vprintfmt+0x219>
+  80044f:	83 ef 01             	sub    $0x1,%edi
+  800452:	78 30                	js     800484 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800454:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800458:	74 d6                	je     800430 <vprintfmt+0x1f5>
+  80045a:	0f be c0             	movsbl %al,%eax
+  80045d:	83 e8 20             	sub    $0x20,%eax
+  800460:	83 f8 5e             	cmp    $0x5e,%eax
+  800463:	76 cb                	jbe    800430 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800465:	83 ec 08             	sub    $0x8,%esp
+  800468:	53                   	push   %ebx
+  800469:	6a 3f                	push   $0x3f
+  80046b:	ff 55 08             	call   *0x8(%ebp)
+  80046e:	83 c4 10             	add    $0x10,%esp
+  800471:	eb c8                	jmp    80043b <vprintfmt+0x200>
+  800473:	8b 75 08             	mov    0x8(%ebp),%esi
+  800476:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800479:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80047c:	01 d0                	add    %edx,%eax
+  80047e:	29 c8                	sub    %ecx,%eax
+  800480:	89 c7                	mov    %eax,%edi
+  800482:	eb 13                	jmp    800497 <vprintfmt+0x25c>
+  800484:	8b 75 08             	mov    0x8(%ebp),%esi
+  800487:	eb ed                	jmp    800476 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800489:	83 ec 08             	sub    $0x8,%esp
+  80048c:	53                   	push   %ebx
+  80048d:	6a 20                	push   $0x20
+  80048f:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800491:	83 ef 01             	sub    $0x1,%edi
+  800494:	83 c4 10             	add    $0x10,%esp
+  800497:	85 ff                	test   %edi,%edi
+  800499:	7f ee                	jg     800489 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80049b:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80049e:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004a1:	e9 6b 01 00 00       	jmp    800611 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8004a6:	83 f9 01             	cmp    $0x1,%ecx
+  8004a9:	7f 1f                	jg     8004ca <vprintfmt+0x28f>
+	else if (lflag)
+  8004ab:	85 c9                	test   %ecx,%ecx
+  8004ad:	74 67                	je     800516 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8004af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b2:	8b 00                	mov    (%eax),%eax
+  8004b4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004b7:	89 c1                	mov    %eax,%ecx
+  8004b9:	c1 f9 1f             	sar    $0x1f,%ecx
+  8004bc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c2:	8d 40 04             	lea    0x4(%eax),%eax
+  8004c5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004c8:	eb 17                	jmp    8004e1 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8004ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004cd:	8b 50 04             	mov    0x4(%eax),%edx
+  8004d0:	8b 00                	mov    (%eax),%eax
+  8004d2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004d5:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8004d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004db:	8d 40 08             	lea    0x8(%eax),%eax
+  8004de:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8004e1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8004e4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8004e7:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8004ec:	85 c9                	test   %ecx,%ecx
+  8004ee:	0f 89 03 01 00 00    	jns    8005f7 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8004f4:	83 ec 08             	sub    $0x8,%esp
+  8004f7:	53                   	push   %ebx
+  8004f8:	6a 2d                	push   $0x2d
+  8004fa:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8004fc:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8004ff:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800502:	f7 da                	neg    %edx
+  800504:	83 d1 00             	adc    $0x0,%ecx
+  800507:	f7 d9                	neg    %ecx
+  800509:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80050c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800511:	e9 e1 00 00 00       	jmp    8005f7 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800516:	8b 45 14             	mov    0x14(%ebp),%eax
+  800519:	8b 00                	mov    (%eax),%eax
+  80051b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80051e:	89 c1                	mov    %eax,%ecx
+  800520:	c1 f9 1f             	sar    $0x1f,%ecx
+  800523:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800526:	8b 45 14             	mov    0x14(%ebp),%eax
+  800529:	8d 40 04             	lea    0x4(%eax),%eax
+  80052c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80052f:	eb b0                	jmp    8004e1 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800531:	83 f9 01             	cmp    $0x1,%ecx
+  800534:	7f 1e                	jg     800554 <vprintfmt+0x319>
+	else if (lflag)
+  800536:	85 c9                	test   %ecx,%ecx
+  800538:	74 32                	je     80056c <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  80053a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053d:	8b 10                	mov    (%eax),%edx
+  80053f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800544:	8d 40 04             	lea    0x4(%eax),%eax
+  800547:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80054a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80054f:	e9 a3 00 00 00       	jmp    8005f7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800554:	8b 45 14             	mov    0x14(%ebp),%eax
+  800557:	8b 10                	mov    (%eax),%edx
+  800559:	8b 48 04             	mov    0x4(%eax),%ecx
+  80055c:	8d 40 08             	lea    0x8(%eax),%eax
+  80055f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800562:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800567:	e9 8b 00 00 00       	jmp    8005f7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80056c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056f:	8b 10                	mov    (%eax),%edx
+  800571:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800576:	8d 40 04             	lea    0x4(%eax),%eax
+  800579:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80057c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800581:	eb 74                	jmp    8005f7 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800583:	83 f9 01             	cmp    $0x1,%ecx
+  800586:	7f 1b                	jg     8005a3 <vprintfmt+0x368>
+	else if (lflag)
+  800588:	85 c9                	test   %ecx,%ecx
+  80058a:	74 2c                	je     8005b8 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  80058c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058f:	8b 10                	mov    (%eax),%edx
+  800591:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800596:	8d 40 04             	lea    0x4(%eax),%eax
+  800599:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80059c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8005a1:	eb 54                	jmp    8005f7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a6:	8b 10                	mov    (%eax),%edx
+  8005a8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005ab:	8d 40 08             	lea    0x8(%eax),%eax
+  8005ae:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005b1:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8005b6:	eb 3f                	jmp    8005f7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bb:	8b 10                	mov    (%eax),%edx
+  8005bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005c2:	8d 40 04             	lea    0x4(%eax),%eax
+  8005c5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005c8:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8005cd:	eb 28                	jmp    8005f7 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8005cf:	83 ec 08             	sub    $0x8,%esp
+  8005d2:	53                   	push   %ebx
+  8005d3:	6a 30                	push   $0x30
+  8005d5:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8005d7:	83 c4 08             	add    $0x8,%esp
+  8005da:	53                   	push   %ebx
+  8005db:	6a 78                	push   $0x78
+  8005dd:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8005df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e2:	8b 10                	mov    (%eax),%edx
+  8005e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8005e9:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8005ec:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ef:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8005f2:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8005f7:	83 ec 0c             	sub    $0xc,%esp
+  8005fa:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8005fe:	50                   	push   %eax
+  8005ff:	ff 75 e0             	push   -0x20(%ebp)
+  800602:	57                   	push   %edi
+  800603:	51                   	push   %ecx
+  800604:	52                   	push   %edx
+  800605:	89 da                	mov    %ebx,%edx
+  800607:	89 f0                	mov    %esi,%eax
+  800609:	e8 4a fb ff ff       	call   800158 <printnum>
+			break;
+  80060e:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800611:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800614:	e9 40 fc ff ff       	jmp    800259 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800619:	83 f9 01             	cmp    $0x1,%ecx
+  80061c:	7f 1b                	jg     800639 <vprintfmt+0x3fe>
+	else if (lflag)
+  80061e:	85 c9                	test   %ecx,%ecx
+  800620:	74 2c                	je     80064e <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800622:	8b 45 14             	mov    0x14(%ebp),%eax
+  800625:	8b 10                	mov    (%eax),%edx
+  800627:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80062c:	8d 40 04             	lea    0x4(%eax),%eax
+  80062f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800632:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800637:	eb be                	jmp    8005f7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800639:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063c:	8b 10                	mov    (%eax),%edx
+  80063e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800641:	8d 40 08             	lea    0x8(%eax),%eax
+  800644:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800647:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80064c:	eb a9                	jmp    8005f7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80064e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800651:	8b 10                	mov    (%eax),%edx
+  800653:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800658:	8d 40 04             	lea    0x4(%eax),%eax
+  80065b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80065e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800663:	eb 92                	jmp    8005f7 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800665:	83 ec 08             	sub    $0x8,%esp
+  800668:	53                   	push   %ebx
+  800669:	6a 25                	push   $0x25
+  80066b:	ff d6                	call   *%esi
+			break;
+  80066d:	83 c4 10             	add    $0x10,%esp
+  800670:	eb 9f                	jmp    800611 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800672:	83 ec 08             	sub    $0x8,%esp
+  800675:	53                   	push   %ebx
+  800676:	6a 25                	push   $0x25
+  800678:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80067a:	83 c4 10             	add    $0x10,%esp
+  80067d:	89 f8                	mov    %edi,%eax
+  80067f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800683:	74 05                	je     80068a <vprintfmt+0x44f>
+  800685:	83 e8 01             	sub    $0x1,%eax
+  800688:	eb f5                	jmp    80067f <vprintfmt+0x444>
+  80068a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80068d:	eb 82                	jmp    800611 <vprintfmt+0x3d6>
+
+0080068f <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80068f:	55                   	push   %ebp
+  800690:	89 e5                	mov    %esp,%ebp
+  800692:	83 ec 18             	sub    $0x18,%esp
+  800695:	8b 45 08             	mov    0x8(%ebp),%eax
+  800698:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80069b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80069e:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006a2:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006a5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006ac:	85 c0                	test   %eax,%eax
+  8006ae:	74 26                	je     8006d6 <vsnprintf+0x47>
+  8006b0:	85 d2                	test   %edx,%edx
+  8006b2:	7e 22                	jle    8006d6 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006b4:	ff 75 14             	push   0x14(%ebp)
+  8006b7:	ff 75 10             	push   0x10(%ebp)
+  8006ba:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006bd:	50                   	push   %eax
+  8006be:	68 01 02 80 00       	push   $0x800201
+  8006c3:	e8 73 fb ff ff       	call   80023b <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8006c8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8006cb:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8006ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8006d1:	83 c4 10             	add    $0x10,%esp
+}
+  8006d4:	c9                   	leave
+  8006d5:	c3                   	ret
+		return -E_INVAL;
+  8006d6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006db:	eb f7                	jmp    8006d4 <vsnprintf+0x45>
+
+008006dd <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8006dd:	55                   	push   %ebp
+  8006de:	89 e5                	mov    %esp,%ebp
+  8006e0:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8006e3:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8006e6:	50                   	push   %eax
+  8006e7:	ff 75 10             	push   0x10(%ebp)
+  8006ea:	ff 75 0c             	push   0xc(%ebp)
+  8006ed:	ff 75 08             	push   0x8(%ebp)
+  8006f0:	e8 9a ff ff ff       	call   80068f <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8006f5:	c9                   	leave
+  8006f6:	c3                   	ret
+
+008006f7 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8006f7:	55                   	push   %ebp
+  8006f8:	89 e5                	mov    %esp,%ebp
+  8006fa:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8006fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800702:	eb 03                	jmp    800707 <strlen+0x10>
+		n++;
+  800704:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800707:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80070b:	75 f7                	jne    800704 <strlen+0xd>
+	return n;
+}
+  80070d:	5d                   	pop    %ebp
+  80070e:	c3                   	ret
+
+0080070f <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80070f:	55                   	push   %ebp
+  800710:	89 e5                	mov    %esp,%ebp
+  800712:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800715:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800718:	b8 00 00 00 00       	mov    $0x0,%eax
+  80071d:	eb 03                	jmp    800722 <strnlen+0x13>
+		n++;
+  80071f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800722:	39 d0                	cmp    %edx,%eax
+  800724:	74 08                	je     80072e <strnlen+0x1f>
+  800726:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80072a:	75 f3                	jne    80071f <strnlen+0x10>
+  80072c:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80072e:	89 d0                	mov    %edx,%eax
+  800730:	5d                   	pop    %ebp
+  800731:	c3                   	ret
+
+00800732 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800732:	55                   	push   %ebp
+  800733:	89 e5                	mov    %esp,%ebp
+  800735:	53                   	push   %ebx
+  800736:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800739:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80073c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800741:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800745:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800748:	83 c0 01             	add    $0x1,%eax
+  80074b:	84 d2                	test   %dl,%dl
+  80074d:	75 f2                	jne    800741 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80074f:	89 c8                	mov    %ecx,%eax
+  800751:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800754:	c9                   	leave
+  800755:	c3                   	ret
+
+00800756 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800756:	55                   	push   %ebp
+  800757:	89 e5                	mov    %esp,%ebp
+  800759:	53                   	push   %ebx
+  80075a:	83 ec 10             	sub    $0x10,%esp
+  80075d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800760:	53                   	push   %ebx
+  800761:	e8 91 ff ff ff       	call   8006f7 <strlen>
+  800766:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800769:	ff 75 0c             	push   0xc(%ebp)
+  80076c:	01 d8                	add    %ebx,%eax
+  80076e:	50                   	push   %eax
+  80076f:	e8 be ff ff ff       	call   800732 <strcpy>
+	return dst;
+}
+  800774:	89 d8                	mov    %ebx,%eax
+  800776:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800779:	c9                   	leave
+  80077a:	c3                   	ret
+
+0080077b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80077b:	55                   	push   %ebp
+  80077c:	89 e5                	mov    %esp,%ebp
+  80077e:	56                   	push   %esi
+  80077f:	53                   	push   %ebx
+  800780:	8b 75 08             	mov    0x8(%ebp),%esi
+  800783:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800786:	89 f3                	mov    %esi,%ebx
+  800788:	03 5d 10             	add    0x10(%ebp),%ebx
+  80078b:	89 f0                	mov    %esi,%eax
+  80078d:	eb 0f                	jmp    80079e <strncpy+0x23>
+		*dst++ = *src;
+  80078f:	83 c0 01             	add    $0x1,%eax
+  800792:	0f b6 0a             	movzbl (%edx),%ecx
+  800795:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800798:	80 f9 01             	cmp    $0x1,%cl
+  80079b:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80079e:	39 d8                	cmp    %ebx,%eax
+  8007a0:	75 ed                	jne    80078f <strncpy+0x14>
+	}
+	return ret;
+}
+  8007a2:	89 f0                	mov    %esi,%eax
+  8007a4:	5b                   	pop    %ebx
+  8007a5:	5e                   	pop    %esi
+  8007a6:	5d                   	pop    %ebp
+  8007a7:	c3                   	ret
+
+008007a8 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007a8:	55                   	push   %ebp
+  8007a9:	89 e5                	mov    %esp,%ebp
+  8007ab:	56                   	push   %esi
+  8007ac:	53                   	push   %ebx
+  8007ad:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007b3:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8007b6:	89 f0                	mov    %esi,%eax
+  8007b8:	85 d2                	test   %edx,%edx
+  8007ba:	74 21                	je     8007dd <strlcpy+0x35>
+  8007bc:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8007c0:	89 f2                	mov    %esi,%edx
+  8007c2:	eb 09                	jmp    8007cd <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8007c4:	83 c1 01             	add    $0x1,%ecx
+  8007c7:	83 c2 01             	add    $0x1,%edx
+  8007ca:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8007cd:	39 c2                	cmp    %eax,%edx
+  8007cf:	74 09                	je     8007da <strlcpy+0x32>
+  8007d1:	0f b6 19             	movzbl (%ecx),%ebx
+  8007d4:	84 db                	test   %bl,%bl
+  8007d6:	75 ec                	jne    8007c4 <strlcpy+0x1c>
+  8007d8:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8007da:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8007dd:	29 f0                	sub    %esi,%eax
+}
+  8007df:	5b                   	pop    %ebx
+  8007e0:	5e                   	pop    %esi
+  8007e1:	5d                   	pop    %ebp
+  8007e2:	c3                   	ret
+
+008007e3 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8007e3:	55                   	push   %ebp
+  8007e4:	89 e5                	mov    %esp,%ebp
+  8007e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007e9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8007ec:	eb 06                	jmp    8007f4 <strcmp+0x11>
+		p++, q++;
+  8007ee:	83 c1 01             	add    $0x1,%ecx
+  8007f1:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8007f4:	0f b6 01             	movzbl (%ecx),%eax
+  8007f7:	84 c0                	test   %al,%al
+  8007f9:	74 04                	je     8007ff <strcmp+0x1c>
+  8007fb:	3a 02                	cmp    (%edx),%al
+  8007fd:	74 ef                	je     8007ee <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8007ff:	0f b6 c0             	movzbl %al,%eax
+  800802:	0f b6 12             	movzbl (%edx),%edx
+  800805:	29 d0                	sub    %edx,%eax
+}
+  800807:	5d                   	pop    %ebp
+  800808:	c3                   	ret
+
+00800809 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800809:	55                   	push   %ebp
+  80080a:	89 e5                	mov    %esp,%ebp
+  80080c:	53                   	push   %ebx
+  80080d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800810:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800813:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800816:	eb 09                	jmp    800821 <strncmp+0x18>
+		n--, p++, q++;
+  800818:	83 ea 01             	sub    $0x1,%edx
+  80081b:	83 c0 01             	add    $0x1,%eax
+  80081e:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800821:	85 d2                	test   %edx,%edx
+  800823:	74 18                	je     80083d <strncmp+0x34>
+  800825:	0f b6 18             	movzbl (%eax),%ebx
+  800828:	84 db                	test   %bl,%bl
+  80082a:	74 04                	je     800830 <strncmp+0x27>
+  80082c:	3a 19                	cmp    (%ecx),%bl
+  80082e:	74 e8                	je     800818 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800830:	0f b6 00             	movzbl (%eax),%eax
+  800833:	0f b6 11             	movzbl (%ecx),%edx
+  800836:	29 d0                	sub    %edx,%eax
+}
+  800838:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80083b:	c9                   	leave
+  80083c:	c3                   	ret
+		return 0;
+  80083d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800842:	eb f4                	jmp    800838 <strncmp+0x2f>
+
+00800844 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800844:	55                   	push   %ebp
+  800845:	89 e5                	mov    %esp,%ebp
+  800847:	8b 45 08             	mov    0x8(%ebp),%eax
+  80084a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80084e:	eb 03                	jmp    800853 <strchr+0xf>
+  800850:	83 c0 01             	add    $0x1,%eax
+  800853:	0f b6 10             	movzbl (%eax),%edx
+  800856:	84 d2                	test   %dl,%dl
+  800858:	74 06                	je     800860 <strchr+0x1c>
+		if (*s == c)
+  80085a:	38 ca                	cmp    %cl,%dl
+  80085c:	75 f2                	jne    800850 <strchr+0xc>
+  80085e:	eb 05                	jmp    800865 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800860:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800865:	5d                   	pop    %ebp
+  800866:	c3                   	ret
+
+00800867 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800867:	55                   	push   %ebp
+  800868:	89 e5                	mov    %esp,%ebp
+  80086a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80086d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800871:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800874:	38 ca                	cmp    %cl,%dl
+  800876:	74 09                	je     800881 <strfind+0x1a>
+  800878:	84 d2                	test   %dl,%dl
+  80087a:	74 05                	je     800881 <strfind+0x1a>
+	for (; *s; s++)
+  80087c:	83 c0 01             	add    $0x1,%eax
+  80087f:	eb f0                	jmp    800871 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800881:	5d                   	pop    %ebp
+  800882:	c3                   	ret
+
+00800883 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800883:	55                   	push   %ebp
+  800884:	89 e5                	mov    %esp,%ebp
+  800886:	57                   	push   %edi
+  800887:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80088a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80088d:	85 c9                	test   %ecx,%ecx
+  80088f:	74 20                	je     8008b1 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800891:	89 f8                	mov    %edi,%eax
+  800893:	09 c8                	or     %ecx,%eax
+  800895:	a8 03                	test   $0x3,%al
+  800897:	75 12                	jne    8008ab <memset+0x28>
+		c &= 0xFF;
+  800899:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80089d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008a3:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008a6:	fc                   	cld
+  8008a7:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008a9:	eb 06                	jmp    8008b1 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008ae:	fc                   	cld
+  8008af:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008b1:	89 f8                	mov    %edi,%eax
+  8008b3:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008b6:	c9                   	leave
+  8008b7:	c3                   	ret
+
+008008b8 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008b8:	55                   	push   %ebp
+  8008b9:	89 e5                	mov    %esp,%ebp
+  8008bb:	57                   	push   %edi
+  8008bc:	56                   	push   %esi
+  8008bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008c0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008c3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8008c6:	39 c6                	cmp    %eax,%esi
+  8008c8:	73 32                	jae    8008fc <memmove+0x44>
+  8008ca:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8008cd:	39 d0                	cmp    %edx,%eax
+  8008cf:	73 2b                	jae    8008fc <memmove+0x44>
+		s += n;
+		d += n;
+  8008d1:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008d4:	89 d6                	mov    %edx,%esi
+  8008d6:	09 fe                	or     %edi,%esi
+  8008d8:	09 ce                	or     %ecx,%esi
+  8008da:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8008e0:	75 0e                	jne    8008f0 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8008e2:	83 ef 04             	sub    $0x4,%edi
+  8008e5:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8008e8:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8008eb:	fd                   	std
+  8008ec:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8008ee:	eb 09                	jmp    8008f9 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8008f0:	83 ef 01             	sub    $0x1,%edi
+  8008f3:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8008f6:	fd                   	std
+  8008f7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8008f9:	fc                   	cld
+  8008fa:	eb 1a                	jmp    800916 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008fc:	89 f2                	mov    %esi,%edx
+  8008fe:	09 c2                	or     %eax,%edx
+  800900:	09 ca                	or     %ecx,%edx
+  800902:	f6 c2 03             	test   $0x3,%dl
+  800905:	75 0a                	jne    800911 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800907:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80090a:	89 c7                	mov    %eax,%edi
+  80090c:	fc                   	cld
+  80090d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80090f:	eb 05                	jmp    800916 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800911:	89 c7                	mov    %eax,%edi
+  800913:	fc                   	cld
+  800914:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800916:	5e                   	pop    %esi
+  800917:	5f                   	pop    %edi
+  800918:	5d                   	pop    %ebp
+  800919:	c3                   	ret
+
+0080091a <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80091a:	55                   	push   %ebp
+  80091b:	89 e5                	mov    %esp,%ebp
+  80091d:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800920:	ff 75 10             	push   0x10(%ebp)
+  800923:	ff 75 0c             	push   0xc(%ebp)
+  800926:	ff 75 08             	push   0x8(%ebp)
+  800929:	e8 8a ff ff ff       	call   8008b8 <memmove>
+}
+  80092e:	c9                   	leave
+  80092f:	c3                   	ret
+
+00800930 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800930:	55                   	push   %ebp
+  800931:	89 e5                	mov    %esp,%ebp
+  800933:	56                   	push   %esi
+  800934:	53                   	push   %ebx
+  800935:	8b 45 08             	mov    0x8(%ebp),%eax
+  800938:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80093b:	89 c6                	mov    %eax,%esi
+  80093d:	03 75 10             	add    0x10(%ebp),%esi
+  800940:	eb 06                	jmp    800948 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800942:	83 c0 01             	add    $0x1,%eax
+  800945:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800948:	39 f0                	cmp    %esi,%eax
+  80094a:	74 14                	je     800960 <memcmp+0x30>
+		if (*s1 != *s2)
+  80094c:	0f b6 08             	movzbl (%eax),%ecx
+  80094f:	0f b6 1a             	movzbl (%edx),%ebx
+  800952:	38 d9                	cmp    %bl,%cl
+  800954:	74 ec                	je     800942 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800956:	0f b6 c1             	movzbl %cl,%eax
+  800959:	0f b6 db             	movzbl %bl,%ebx
+  80095c:	29 d8                	sub    %ebx,%eax
+  80095e:	eb 05                	jmp    800965 <memcmp+0x35>
+	}
+
+	return 0;
+  800960:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800965:	5b                   	pop    %ebx
+  800966:	5e                   	pop    %esi
+  800967:	5d                   	pop    %ebp
+  800968:	c3                   	ret
+
+00800969 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800969:	55                   	push   %ebp
+  80096a:	89 e5                	mov    %esp,%ebp
+  80096c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80096f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800972:	89 c2                	mov    %eax,%edx
+  800974:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800977:	eb 03                	jmp    80097c <memfind+0x13>
+  800979:	83 c0 01             	add    $0x1,%eax
+  80097c:	39 d0                	cmp    %edx,%eax
+  80097e:	73 04                	jae    800984 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800980:	38 08                	cmp    %cl,(%eax)
+  800982:	75 f5                	jne    800979 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800984:	5d                   	pop    %ebp
+  800985:	c3                   	ret
+
+00800986 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800986:	55                   	push   %ebp
+  800987:	89 e5                	mov    %esp,%ebp
+  800989:	57                   	push   %edi
+  80098a:	56                   	push   %esi
+  80098b:	53                   	push   %ebx
+  80098c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80098f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800992:	eb 03                	jmp    800997 <strtol+0x11>
+		s++;
+  800994:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800997:	0f b6 02             	movzbl (%edx),%eax
+  80099a:	3c 20                	cmp    $0x20,%al
+  80099c:	74 f6                	je     800994 <strtol+0xe>
+  80099e:	3c 09                	cmp    $0x9,%al
+  8009a0:	74 f2                	je     800994 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009a2:	3c 2b                	cmp    $0x2b,%al
+  8009a4:	74 2a                	je     8009d0 <strtol+0x4a>
+	int neg = 0;
+  8009a6:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009ab:	3c 2d                	cmp    $0x2d,%al
+  8009ad:	74 2b                	je     8009da <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009af:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009b5:	75 0f                	jne    8009c6 <strtol+0x40>
+  8009b7:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009ba:	74 28                	je     8009e4 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8009bc:	85 db                	test   %ebx,%ebx
+  8009be:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009c3:	0f 44 d8             	cmove  %eax,%ebx
+  8009c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009cb:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8009ce:	eb 46                	jmp    800a16 <strtol+0x90>
+		s++;
+  8009d0:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8009d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009d8:	eb d5                	jmp    8009af <strtol+0x29>
+		s++, neg = 1;
+  8009da:	83 c2 01             	add    $0x1,%edx
+  8009dd:	bf 01 00 00 00       	mov    $0x1,%edi
+  8009e2:	eb cb                	jmp    8009af <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009e4:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8009e8:	74 0e                	je     8009f8 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8009ea:	85 db                	test   %ebx,%ebx
+  8009ec:	75 d8                	jne    8009c6 <strtol+0x40>
+		s++, base = 8;
+  8009ee:	83 c2 01             	add    $0x1,%edx
+  8009f1:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8009f6:	eb ce                	jmp    8009c6 <strtol+0x40>
+		s += 2, base = 16;
+  8009f8:	83 c2 02             	add    $0x2,%edx
+  8009fb:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a00:	eb c4                	jmp    8009c6 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a02:	0f be c0             	movsbl %al,%eax
+  800a05:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a08:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a0b:	7d 3a                	jge    800a47 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a0d:	83 c2 01             	add    $0x1,%edx
+  800a10:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a14:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a16:	0f b6 02             	movzbl (%edx),%eax
+  800a19:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a1c:	89 f3                	mov    %esi,%ebx
+  800a1e:	80 fb 09             	cmp    $0x9,%bl
+  800a21:	76 df                	jbe    800a02 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a23:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a26:	89 f3                	mov    %esi,%ebx
+  800a28:	80 fb 19             	cmp    $0x19,%bl
+  800a2b:	77 08                	ja     800a35 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a2d:	0f be c0             	movsbl %al,%eax
+  800a30:	83 e8 57             	sub    $0x57,%eax
+  800a33:	eb d3                	jmp    800a08 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a35:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a38:	89 f3                	mov    %esi,%ebx
+  800a3a:	80 fb 19             	cmp    $0x19,%bl
+  800a3d:	77 08                	ja     800a47 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a3f:	0f be c0             	movsbl %al,%eax
+  800a42:	83 e8 37             	sub    $0x37,%eax
+  800a45:	eb c1                	jmp    800a08 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a47:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a4b:	74 05                	je     800a52 <strtol+0xcc>
+		*endptr = (char *) s;
+  800a4d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a50:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a52:	89 c8                	mov    %ecx,%eax
+  800a54:	f7 d8                	neg    %eax
+  800a56:	85 ff                	test   %edi,%edi
+  800a58:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a5b:	89 c8                	mov    %ecx,%eax
+  800a5d:	5b                   	pop    %ebx
+  800a5e:	5e                   	pop    %esi
+  800a5f:	5f                   	pop    %edi
+  800a60:	5d                   	pop    %ebp
+  800a61:	c3                   	ret
+
+00800a62 <atoi>:
+
+int
+atoi(const char *s)
+{
+  800a62:	55                   	push   %ebp
+  800a63:	89 e5                	mov    %esp,%ebp
+  800a65:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800a68:	6a 0a                	push   $0xa
+  800a6a:	6a 00                	push   $0x0
+  800a6c:	ff 75 08             	push   0x8(%ebp)
+  800a6f:	e8 12 ff ff ff       	call   800986 <strtol>
+}
+  800a74:	c9                   	leave
+  800a75:	c3                   	ret
+
+00800a76 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800a76:	55                   	push   %ebp
+  800a77:	89 e5                	mov    %esp,%ebp
+  800a79:	57                   	push   %edi
+  800a7a:	56                   	push   %esi
+  800a7b:	53                   	push   %ebx
+  800a7c:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800a82:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800a88:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800a8e:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800a94:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800a9b:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800a9e:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800aa5:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800aa8:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800aaf:	74 76                	je     800b27 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800ab1:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800ab7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aba:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800ac0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ac7:	0f 88 06 01 00 00    	js     800bd3 <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800acd:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ad4:	0f 84 48 01 00 00    	je     800c22 <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800ada:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800ae0:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800ae6:	be 00 00 00 00       	mov    $0x0,%esi
+  800aeb:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800af1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800af4:	55                   	push   %ebp
+  800af5:	68 fe 0a 80 00       	push   $0x800afe
+  800afa:	89 e5                	mov    %esp,%ebp
+  800afc:	0f 34                	sysenter
+  800afe:	83 c4 04             	add    $0x4,%esp
+  800b01:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800b02:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800b08:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800b0e:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800b11:	0f 85 9a 01 00 00    	jne    800cb1 <page_vec_call+0x23b>
+  800b17:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b1c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b1f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b22:	e9 29 01 00 00       	jmp    800c50 <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800b27:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800b2d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b30:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800b32:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b39:	78 2f                	js     800b6a <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800b3b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b42:	74 72                	je     800bb6 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800b44:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800b4a:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800b50:	b8 10 00 00 00       	mov    $0x10,%eax
+  800b55:	89 fb                	mov    %edi,%ebx
+  800b57:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800b5a:	55                   	push   %ebp
+  800b5b:	68 64 0b 80 00       	push   $0x800b64
+  800b60:	89 e5                	mov    %esp,%ebp
+  800b62:	0f 34                	sysenter
+  800b64:	83 c4 04             	add    $0x4,%esp
+  800b67:	5d                   	pop    %ebp
+	return ret;
+  800b68:	eb 98                	jmp    800b02 <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800b6a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b6f:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800b71:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800b76:	f6 c6 08             	test   $0x8,%dh
+  800b79:	74 15                	je     800b90 <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800b7b:	89 c2                	mov    %eax,%edx
+  800b7d:	c1 ea 08             	shr    $0x8,%edx
+  800b80:	83 e2 0f             	and    $0xf,%edx
+  800b83:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800b88:	83 fa 06             	cmp    $0x6,%edx
+  800b8b:	74 0e                	je     800b9b <page_vec_call+0x125>
+  800b8d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800b90:	0f b6 c9             	movzbl %cl,%ecx
+  800b93:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800b99:	eb a0                	jmp    800b3b <page_vec_call+0xc5>
+  800b9b:	89 c2                	mov    %eax,%edx
+  800b9d:	c1 ea 04             	shr    $0x4,%edx
+  800ba0:	83 e2 0f             	and    $0xf,%edx
+  800ba3:	83 fa 02             	cmp    $0x2,%edx
+  800ba6:	77 e5                	ja     800b8d <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800ba8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800bab:	83 f8 02             	cmp    $0x2,%eax
+  800bae:	0f 97 c1             	seta   %cl
+  800bb1:	0f b6 c9             	movzbl %cl,%ecx
+  800bb4:	eb d7                	jmp    800b8d <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800bb6:	b8 10 00 00 00       	mov    $0x10,%eax
+  800bbb:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800bc1:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800bc7:	89 fb                	mov    %edi,%ebx
+  800bc9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800bcc:	cd 30                	int    $0x30
+  800bce:	e9 2f ff ff ff       	jmp    800b02 <page_vec_call+0x8c>
+  800bd3:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bd8:	0f a2                	cpuid
+		return 0;
+  800bda:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800bdf:	f6 c6 08             	test   $0x8,%dh
+  800be2:	74 15                	je     800bf9 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800be4:	89 c2                	mov    %eax,%edx
+  800be6:	c1 ea 08             	shr    $0x8,%edx
+  800be9:	83 e2 0f             	and    $0xf,%edx
+  800bec:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800bf1:	83 fa 06             	cmp    $0x6,%edx
+  800bf4:	74 11                	je     800c07 <page_vec_call+0x191>
+  800bf6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800bf9:	0f b6 c9             	movzbl %cl,%ecx
+  800bfc:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800c02:	e9 c6 fe ff ff       	jmp    800acd <page_vec_call+0x57>
+  800c07:	89 c2                	mov    %eax,%edx
+  800c09:	c1 ea 04             	shr    $0x4,%edx
+  800c0c:	83 e2 0f             	and    $0xf,%edx
+  800c0f:	83 fa 02             	cmp    $0x2,%edx
+  800c12:	77 e2                	ja     800bf6 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800c14:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c17:	83 f8 02             	cmp    $0x2,%eax
+  800c1a:	0f 97 c1             	seta   %cl
+  800c1d:	0f b6 c9             	movzbl %cl,%ecx
+  800c20:	eb d4                	jmp    800bf6 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800c22:	be 00 00 00 00       	mov    $0x0,%esi
+  800c27:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800c2d:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800c33:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800c39:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c3c:	cd 30                	int    $0x30
+  800c3e:	e9 bf fe ff ff       	jmp    800b02 <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800c43:	29 da                	sub    %ebx,%edx
+			vec++;
+  800c45:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800c48:	83 e8 01             	sub    $0x1,%eax
+  800c4b:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800c50:	85 c0                	test   %eax,%eax
+  800c52:	74 58                	je     800cac <page_vec_call+0x236>
+  800c54:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800c57:	39 da                	cmp    %ebx,%edx
+  800c59:	73 e8                	jae    800c43 <page_vec_call+0x1cd>
+  800c5b:	89 75 08             	mov    %esi,0x8(%ebp)
+  800c5e:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800c61:	84 c9                	test   %cl,%cl
+  800c63:	74 06                	je     800c6b <page_vec_call+0x1f5>
+  800c65:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800c6b:	83 ec 04             	sub    $0x4,%esp
+  800c6e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c71:	c1 e0 04             	shl    $0x4,%eax
+  800c74:	50                   	push   %eax
+  800c75:	ff 75 08             	push   0x8(%ebp)
+  800c78:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800c7e:	53                   	push   %ebx
+  800c7f:	e8 34 fc ff ff       	call   8008b8 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800c84:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800c8a:	89 c2                	mov    %eax,%edx
+  800c8c:	c1 e2 0c             	shl    $0xc,%edx
+  800c8f:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  800c95:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  800c9b:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  800ca1:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  800ca4:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  800ca7:	e9 f2 fd ff ff       	jmp    800a9e <page_vec_call+0x28>
+			r = 0;
+  800cac:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  800cb1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800cb5:	74 0b                	je     800cc2 <page_vec_call+0x24c>
+		*done = total;
+  800cb7:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800cba:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  800cc0:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  800cc2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cc5:	5b                   	pop    %ebx
+  800cc6:	5e                   	pop    %esi
+  800cc7:	5f                   	pop    %edi
+  800cc8:	5d                   	pop    %ebp
+  800cc9:	c3                   	ret
+
+00800cca <sys_cputs>:
+{
+  800cca:	55                   	push   %ebp
+  800ccb:	89 e5                	mov    %esp,%ebp
+  800ccd:	57                   	push   %edi
+  800cce:	56                   	push   %esi
+  800ccf:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800cd0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800cd7:	78 2d                	js     800d06 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800cd9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ce0:	74 70                	je     800d52 <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800ce2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ced:	89 c3                	mov    %eax,%ebx
+  800cef:	89 c7                	mov    %eax,%edi
+  800cf1:	89 c6                	mov    %eax,%esi
+  800cf3:	55                   	push   %ebp
+  800cf4:	68 fd 0c 80 00       	push   $0x800cfd
+  800cf9:	89 e5                	mov    %esp,%ebp
+  800cfb:	0f 34                	sysenter
+  800cfd:	83 c4 04             	add    $0x4,%esp
+  800d00:	5d                   	pop    %ebp
+}
+  800d01:	5b                   	pop    %ebx
+  800d02:	5e                   	pop    %esi
+  800d03:	5f                   	pop    %edi
+  800d04:	5d                   	pop    %ebp
+  800d05:	c3                   	ret
+  800d06:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d0b:	0f a2                	cpuid
+		return 0;
+  800d0d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800d12:	f6 c6 08             	test   $0x8,%dh
+  800d15:	74 15                	je     800d2c <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d17:	89 c2                	mov    %eax,%edx
+  800d19:	c1 ea 08             	shr    $0x8,%edx
+  800d1c:	83 e2 0f             	and    $0xf,%edx
+  800d1f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d24:	83 fa 06             	cmp    $0x6,%edx
+  800d27:	74 0e                	je     800d37 <sys_cputs+0x6d>
+  800d29:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800d2c:	0f b6 c9             	movzbl %cl,%ecx
+  800d2f:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800d35:	eb a2                	jmp    800cd9 <sys_cputs+0xf>
+  800d37:	89 c2                	mov    %eax,%edx
+  800d39:	c1 ea 04             	shr    $0x4,%edx
+  800d3c:	83 e2 0f             	and    $0xf,%edx
+  800d3f:	83 fa 02             	cmp    $0x2,%edx
+  800d42:	77 e5                	ja     800d29 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800d44:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d47:	83 f8 02             	cmp    $0x2,%eax
+  800d4a:	0f 97 c1             	seta   %cl
+  800d4d:	0f b6 c9             	movzbl %cl,%ecx
+  800d50:	eb d7                	jmp    800d29 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800d52:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d57:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d5d:	89 c3                	mov    %eax,%ebx
+  800d5f:	89 c7                	mov    %eax,%edi
+  800d61:	89 c6                	mov    %eax,%esi
+  800d63:	cd 30                	int    $0x30
+}
+  800d65:	eb 9a                	jmp    800d01 <sys_cputs+0x37>
+
+00800d67 <sys_cgetc>:
+{
+  800d67:	55                   	push   %ebp
+  800d68:	89 e5                	mov    %esp,%ebp
+  800d6a:	57                   	push   %edi
+  800d6b:	56                   	push   %esi
+  800d6c:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800d6d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d74:	78 2e                	js     800da4 <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  800d76:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d7d:	74 71                	je     800df0 <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  800d7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d84:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d89:	89 d1                	mov    %edx,%ecx
+  800d8b:	89 d3                	mov    %edx,%ebx
+  800d8d:	89 d7                	mov    %edx,%edi
+  800d8f:	89 d6                	mov    %edx,%esi
+  800d91:	55                   	push   %ebp
+  800d92:	68 9b 0d 80 00       	push   $0x800d9b
+  800d97:	89 e5                	mov    %esp,%ebp
+  800d99:	0f 34                	sysenter
+  800d9b:	83 c4 04             	add    $0x4,%esp
+  800d9e:	5d                   	pop    %ebp
+}
+  800d9f:	5b                   	pop    %ebx
+  800da0:	5e                   	pop    %esi
+  800da1:	5f                   	pop    %edi
+  800da2:	5d                   	pop    %ebp
+  800da3:	c3                   	ret
+  800da4:	b8 01 00 00 00       	mov    $0x1,%eax
+  800da9:	0f a2                	cpuid
+		return 0;
+  800dab:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800db0:	f6 c6 08             	test   $0x8,%dh
+  800db3:	74 15                	je     800dca <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800db5:	89 c2                	mov    %eax,%edx
+  800db7:	c1 ea 08             	shr    $0x8,%edx
+  800dba:	83 e2 0f             	and    $0xf,%edx
+  800dbd:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800dc2:	83 fa 06             	cmp    $0x6,%edx
+  800dc5:	74 0e                	je     800dd5 <sys_cgetc+0x6e>
+  800dc7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800dca:	0f b6 c9             	movzbl %cl,%ecx
+  800dcd:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800dd3:	eb a1                	jmp    800d76 <sys_cgetc+0xf>
+  800dd5:	89 c2                	mov    %eax,%edx
+  800dd7:	c1 ea 04             	shr    $0x4,%edx
+  800dda:	83 e2 0f             	and    $0xf,%edx
+  800ddd:	83 fa 02             	cmp    $0x2,%edx
+  800de0:	77 e5                	ja     800dc7 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  800de2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800de5:	83 f8 02             	cmp    $0x2,%eax
+  800de8:	0f 97 c1             	seta   %cl
+  800deb:	0f b6 c9             	movzbl %cl,%ecx
+  800dee:	eb d7                	jmp    800dc7 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  800df0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800df5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dfa:	89 d1                	mov    %edx,%ecx
+  800dfc:	89 d3                	mov    %edx,%ebx
+  800dfe:	89 d7                	mov    %edx,%edi
+  800e00:	89 d6                	mov    %edx,%esi
+  800e02:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800e04:	eb 99                	jmp    800d9f <sys_cgetc+0x38>
+
+00800e06 <sys_env_destroy>:
+{
+  800e06:	55                   	push   %ebp
+  800e07:	89 e5                	mov    %esp,%ebp
+  800e09:	57                   	push   %edi
+  800e0a:	56                   	push   %esi
+  800e0b:	53                   	push   %ebx
+  800e0c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800e0f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e16:	78 36                	js     800e4e <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  800e18:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e1f:	74 79                	je     800e9a <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  800e21:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e24:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e29:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e2e:	89 cb                	mov    %ecx,%ebx
+  800e30:	89 cf                	mov    %ecx,%edi
+  800e32:	89 ce                	mov    %ecx,%esi
+  800e34:	55                   	push   %ebp
+  800e35:	68 3e 0e 80 00       	push   $0x800e3e
+  800e3a:	89 e5                	mov    %esp,%ebp
+  800e3c:	0f 34                	sysenter
+  800e3e:	83 c4 04             	add    $0x4,%esp
+  800e41:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e42:	85 c0                	test   %eax,%eax
+  800e44:	7f 6b                	jg     800eb1 <sys_env_destroy+0xab>
+}
+  800e46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e49:	5b                   	pop    %ebx
+  800e4a:	5e                   	pop    %esi
+  800e4b:	5f                   	pop    %edi
+  800e4c:	5d                   	pop    %ebp
+  800e4d:	c3                   	ret
+  800e4e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e53:	0f a2                	cpuid
+		return 0;
+  800e55:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800e5a:	f6 c6 08             	test   $0x8,%dh
+  800e5d:	74 15                	je     800e74 <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e5f:	89 c2                	mov    %eax,%edx
+  800e61:	c1 ea 08             	shr    $0x8,%edx
+  800e64:	83 e2 0f             	and    $0xf,%edx
+  800e67:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e6c:	83 fa 06             	cmp    $0x6,%edx
+  800e6f:	74 0e                	je     800e7f <sys_env_destroy+0x79>
+  800e71:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e74:	0f b6 c9             	movzbl %cl,%ecx
+  800e77:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800e7d:	eb 99                	jmp    800e18 <sys_env_destroy+0x12>
+  800e7f:	89 c2                	mov    %eax,%edx
+  800e81:	c1 ea 04             	shr    $0x4,%edx
+  800e84:	83 e2 0f             	and    $0xf,%edx
+  800e87:	83 fa 02             	cmp    $0x2,%edx
+  800e8a:	77 e5                	ja     800e71 <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  800e8c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e8f:	83 f8 02             	cmp    $0x2,%eax
+  800e92:	0f 97 c1             	seta   %cl
+  800e95:	0f b6 c9             	movzbl %cl,%ecx
+  800e98:	eb d7                	jmp    800e71 <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  800e9a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e9f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ea4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea7:	89 cb                	mov    %ecx,%ebx
+  800ea9:	89 cf                	mov    %ecx,%edi
+  800eab:	89 ce                	mov    %ecx,%esi
+  800ead:	cd 30                	int    $0x30
+  800eaf:	eb 91                	jmp    800e42 <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eb1:	83 ec 0c             	sub    $0xc,%esp
+  800eb4:	50                   	push   %eax
+  800eb5:	6a 03                	push   $0x3
+  800eb7:	68 59 2b 80 00       	push   $0x802b59
+  800ebc:	6a 4a                	push   $0x4a
+  800ebe:	68 76 2b 80 00       	push   $0x802b76
+  800ec3:	e8 1e 17 00 00       	call   8025e6 <_panic>
+
+00800ec8 <sys_getenvid>:
+{
+  800ec8:	55                   	push   %ebp
+  800ec9:	89 e5                	mov    %esp,%ebp
+  800ecb:	57                   	push   %edi
+  800ecc:	56                   	push   %esi
+  800ecd:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800ece:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ed5:	78 2e                	js     800f05 <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  800ed7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ede:	74 71                	je     800f51 <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  800ee0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ee5:	b8 02 00 00 00       	mov    $0x2,%eax
+  800eea:	89 d1                	mov    %edx,%ecx
+  800eec:	89 d3                	mov    %edx,%ebx
+  800eee:	89 d7                	mov    %edx,%edi
+  800ef0:	89 d6                	mov    %edx,%esi
+  800ef2:	55                   	push   %ebp
+  800ef3:	68 fc 0e 80 00       	push   $0x800efc
+  800ef8:	89 e5                	mov    %esp,%ebp
+  800efa:	0f 34                	sysenter
+  800efc:	83 c4 04             	add    $0x4,%esp
+  800eff:	5d                   	pop    %ebp
+}
+  800f00:	5b                   	pop    %ebx
+  800f01:	5e                   	pop    %esi
+  800f02:	5f                   	pop    %edi
+  800f03:	5d                   	pop    %ebp
+  800f04:	c3                   	ret
+  800f05:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f0a:	0f a2                	cpuid
+		return 0;
+  800f0c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f11:	f6 c6 08             	test   $0x8,%dh
+  800f14:	74 15                	je     800f2b <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f16:	89 c2                	mov    %eax,%edx
+  800f18:	c1 ea 08             	shr    $0x8,%edx
+  800f1b:	83 e2 0f             	and    $0xf,%edx
+  800f1e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f23:	83 fa 06             	cmp    $0x6,%edx
+  800f26:	74 0e                	je     800f36 <sys_getenvid+0x6e>
+  800f28:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f2b:	0f b6 c9             	movzbl %cl,%ecx
+  800f2e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800f34:	eb a1                	jmp    800ed7 <sys_getenvid+0xf>
+  800f36:	89 c2                	mov    %eax,%edx
+  800f38:	c1 ea 04             	shr    $0x4,%edx
+  800f3b:	83 e2 0f             	and    $0xf,%edx
+  800f3e:	83 fa 02             	cmp    $0x2,%edx
+  800f41:	77 e5                	ja     800f28 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  800f43:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f46:	83 f8 02             	cmp    $0x2,%eax
+  800f49:	0f 97 c1             	seta   %cl
+  800f4c:	0f b6 c9             	movzbl %cl,%ecx
+  800f4f:	eb d7                	jmp    800f28 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  800f51:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f56:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f5b:	89 d1                	mov    %edx,%ecx
+  800f5d:	89 d3                	mov    %edx,%ebx
+  800f5f:	89 d7                	mov    %edx,%edi
+  800f61:	89 d6                	mov    %edx,%esi
+  800f63:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  800f65:	eb 99                	jmp    800f00 <sys_getenvid+0x38>
+
+00800f67 <sys_page_alloc>:
+{
+  800f67:	55                   	push   %ebp
+  800f68:	89 e5                	mov    %esp,%ebp
+  800f6a:	57                   	push   %edi
+  800f6b:	56                   	push   %esi
+  800f6c:	53                   	push   %ebx
+  800f6d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800f70:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f77:	78 38                	js     800fb1 <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  800f79:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f80:	74 7b                	je     800ffd <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  800f82:	be 00 00 00 00       	mov    $0x0,%esi
+  800f87:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f8d:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f92:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f95:	89 f7                	mov    %esi,%edi
+  800f97:	55                   	push   %ebp
+  800f98:	68 a1 0f 80 00       	push   $0x800fa1
+  800f9d:	89 e5                	mov    %esp,%ebp
+  800f9f:	0f 34                	sysenter
+  800fa1:	83 c4 04             	add    $0x4,%esp
+  800fa4:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800fa5:	85 c0                	test   %eax,%eax
+  800fa7:	7f 6d                	jg     801016 <sys_page_alloc+0xaf>
+}
+  800fa9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fac:	5b                   	pop    %ebx
+  800fad:	5e                   	pop    %esi
+  800fae:	5f                   	pop    %edi
+  800faf:	5d                   	pop    %ebp
+  800fb0:	c3                   	ret
+  800fb1:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fb6:	0f a2                	cpuid
+		return 0;
+  800fb8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800fbd:	f6 c6 08             	test   $0x8,%dh
+  800fc0:	74 15                	je     800fd7 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800fc2:	89 c2                	mov    %eax,%edx
+  800fc4:	c1 ea 08             	shr    $0x8,%edx
+  800fc7:	83 e2 0f             	and    $0xf,%edx
+  800fca:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800fcf:	83 fa 06             	cmp    $0x6,%edx
+  800fd2:	74 0e                	je     800fe2 <sys_page_alloc+0x7b>
+  800fd4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800fd7:	0f b6 c9             	movzbl %cl,%ecx
+  800fda:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800fe0:	eb 97                	jmp    800f79 <sys_page_alloc+0x12>
+  800fe2:	89 c2                	mov    %eax,%edx
+  800fe4:	c1 ea 04             	shr    $0x4,%edx
+  800fe7:	83 e2 0f             	and    $0xf,%edx
+  800fea:	83 fa 02             	cmp    $0x2,%edx
+  800fed:	77 e5                	ja     800fd4 <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  800fef:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ff2:	83 f8 02             	cmp    $0x2,%eax
+  800ff5:	0f 97 c1             	seta   %cl
+  800ff8:	0f b6 c9             	movzbl %cl,%ecx
+  800ffb:	eb d7                	jmp    800fd4 <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  800ffd:	be 00 00 00 00       	mov    $0x0,%esi
+  801002:	b8 04 00 00 00       	mov    $0x4,%eax
+  801007:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801010:	89 f7                	mov    %esi,%edi
+  801012:	cd 30                	int    $0x30
+  801014:	eb 8f                	jmp    800fa5 <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801016:	83 ec 0c             	sub    $0xc,%esp
+  801019:	50                   	push   %eax
+  80101a:	6a 04                	push   $0x4
+  80101c:	68 59 2b 80 00       	push   $0x802b59
+  801021:	6a 4a                	push   $0x4a
+  801023:	68 76 2b 80 00       	push   $0x802b76
+  801028:	e8 b9 15 00 00       	call   8025e6 <_panic>
+
+0080102d <sys_page_map>:
+{
+  80102d:	55                   	push   %ebp
+  80102e:	89 e5                	mov    %esp,%ebp
+  801030:	57                   	push   %edi
+  801031:	56                   	push   %esi
+  801032:	53                   	push   %ebx
+  801033:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801036:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80103d:	78 37                	js     801076 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  80103f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801046:	74 7a                	je     8010c2 <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  801048:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80104e:	b8 05 00 00 00       	mov    $0x5,%eax
+  801053:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801056:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801059:	8b 75 18             	mov    0x18(%ebp),%esi
+  80105c:	55                   	push   %ebp
+  80105d:	68 66 10 80 00       	push   $0x801066
+  801062:	89 e5                	mov    %esp,%ebp
+  801064:	0f 34                	sysenter
+  801066:	83 c4 04             	add    $0x4,%esp
+  801069:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80106a:	85 c0                	test   %eax,%eax
+  80106c:	7f 6c                	jg     8010da <sys_page_map+0xad>
+}
+  80106e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801071:	5b                   	pop    %ebx
+  801072:	5e                   	pop    %esi
+  801073:	5f                   	pop    %edi
+  801074:	5d                   	pop    %ebp
+  801075:	c3                   	ret
+  801076:	b8 01 00 00 00       	mov    $0x1,%eax
+  80107b:	0f a2                	cpuid
+		return 0;
+  80107d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801082:	f6 c6 08             	test   $0x8,%dh
+  801085:	74 15                	je     80109c <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801087:	89 c2                	mov    %eax,%edx
+  801089:	c1 ea 08             	shr    $0x8,%edx
+  80108c:	83 e2 0f             	and    $0xf,%edx
+  80108f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801094:	83 fa 06             	cmp    $0x6,%edx
+  801097:	74 0e                	je     8010a7 <sys_page_map+0x7a>
+  801099:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80109c:	0f b6 c9             	movzbl %cl,%ecx
+  80109f:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8010a5:	eb 98                	jmp    80103f <sys_page_map+0x12>
+  8010a7:	89 c2                	mov    %eax,%edx
+  8010a9:	c1 ea 04             	shr    $0x4,%edx
+  8010ac:	83 e2 0f             	and    $0xf,%edx
+  8010af:	83 fa 02             	cmp    $0x2,%edx
+  8010b2:	77 e5                	ja     801099 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  8010b4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010b7:	83 f8 02             	cmp    $0x2,%eax
+  8010ba:	0f 97 c1             	seta   %cl
+  8010bd:	0f b6 c9             	movzbl %cl,%ecx
+  8010c0:	eb d7                	jmp    801099 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  8010c2:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010cd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010d0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010d3:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010d6:	cd 30                	int    $0x30
+  8010d8:	eb 90                	jmp    80106a <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010da:	83 ec 0c             	sub    $0xc,%esp
+  8010dd:	50                   	push   %eax
+  8010de:	6a 05                	push   $0x5
+  8010e0:	68 59 2b 80 00       	push   $0x802b59
+  8010e5:	6a 4a                	push   $0x4a
+  8010e7:	68 76 2b 80 00       	push   $0x802b76
+  8010ec:	e8 f5 14 00 00       	call   8025e6 <_panic>
+
+008010f1 <sys_page_unmap>:
+{
+  8010f1:	55                   	push   %ebp
+  8010f2:	89 e5                	mov    %esp,%ebp
+  8010f4:	57                   	push   %edi
+  8010f5:	56                   	push   %esi
+  8010f6:	53                   	push   %ebx
+  8010f7:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8010fa:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801101:	78 37                	js     80113a <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  801103:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80110a:	74 7a                	je     801186 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  80110c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801111:	8b 55 08             	mov    0x8(%ebp),%edx
+  801114:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801117:	b8 06 00 00 00       	mov    $0x6,%eax
+  80111c:	89 df                	mov    %ebx,%edi
+  80111e:	89 de                	mov    %ebx,%esi
+  801120:	55                   	push   %ebp
+  801121:	68 2a 11 80 00       	push   $0x80112a
+  801126:	89 e5                	mov    %esp,%ebp
+  801128:	0f 34                	sysenter
+  80112a:	83 c4 04             	add    $0x4,%esp
+  80112d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80112e:	85 c0                	test   %eax,%eax
+  801130:	7f 6c                	jg     80119e <sys_page_unmap+0xad>
+}
+  801132:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801135:	5b                   	pop    %ebx
+  801136:	5e                   	pop    %esi
+  801137:	5f                   	pop    %edi
+  801138:	5d                   	pop    %ebp
+  801139:	c3                   	ret
+  80113a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80113f:	0f a2                	cpuid
+		return 0;
+  801141:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801146:	f6 c6 08             	test   $0x8,%dh
+  801149:	74 15                	je     801160 <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80114b:	89 c2                	mov    %eax,%edx
+  80114d:	c1 ea 08             	shr    $0x8,%edx
+  801150:	83 e2 0f             	and    $0xf,%edx
+  801153:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801158:	83 fa 06             	cmp    $0x6,%edx
+  80115b:	74 0e                	je     80116b <sys_page_unmap+0x7a>
+  80115d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801160:	0f b6 c9             	movzbl %cl,%ecx
+  801163:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801169:	eb 98                	jmp    801103 <sys_page_unmap+0x12>
+  80116b:	89 c2                	mov    %eax,%edx
+  80116d:	c1 ea 04             	shr    $0x4,%edx
+  801170:	83 e2 0f             	and    $0xf,%edx
+  801173:	83 fa 02             	cmp    $0x2,%edx
+  801176:	77 e5                	ja     80115d <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  801178:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80117b:	83 f8 02             	cmp    $0x2,%eax
+  80117e:	0f 97 c1             	seta   %cl
+  801181:	0f b6 c9             	movzbl %cl,%ecx
+  801184:	eb d7                	jmp    80115d <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  801186:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80118b:	b8 06 00 00 00       	mov    $0x6,%eax
+  801190:	8b 55 08             	mov    0x8(%ebp),%edx
+  801193:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801196:	89 df                	mov    %ebx,%edi
+  801198:	89 de                	mov    %ebx,%esi
+  80119a:	cd 30                	int    $0x30
+  80119c:	eb 90                	jmp    80112e <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80119e:	83 ec 0c             	sub    $0xc,%esp
+  8011a1:	50                   	push   %eax
+  8011a2:	6a 06                	push   $0x6
+  8011a4:	68 59 2b 80 00       	push   $0x802b59
+  8011a9:	6a 4a                	push   $0x4a
+  8011ab:	68 76 2b 80 00       	push   $0x802b76
+  8011b0:	e8 31 14 00 00       	call   8025e6 <_panic>
+
+008011b5 <sys_page_copy>:
+{
+  8011b5:	55                   	push   %ebp
+  8011b6:	89 e5                	mov    %esp,%ebp
+  8011b8:	57                   	push   %edi
+  8011b9:	56                   	push   %esi
+  8011ba:	53                   	push   %ebx
+  8011bb:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8011be:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8011c5:	78 37                	js     8011fe <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  8011c7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8011ce:	74 7a                	je     80124a <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  8011d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d6:	b8 29 00 00 00       	mov    $0x29,%eax
+  8011db:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011de:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011e1:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011e4:	55                   	push   %ebp
+  8011e5:	68 ee 11 80 00       	push   $0x8011ee
+  8011ea:	89 e5                	mov    %esp,%ebp
+  8011ec:	0f 34                	sysenter
+  8011ee:	83 c4 04             	add    $0x4,%esp
+  8011f1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8011f2:	85 c0                	test   %eax,%eax
+  8011f4:	7f 6c                	jg     801262 <sys_page_copy+0xad>
+}
+  8011f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011f9:	5b                   	pop    %ebx
+  8011fa:	5e                   	pop    %esi
+  8011fb:	5f                   	pop    %edi
+  8011fc:	5d                   	pop    %ebp
+  8011fd:	c3                   	ret
+  8011fe:	b8 01 00 00 00       	mov    $0x1,%eax
+  801203:	0f a2                	cpuid
+		return 0;
+  801205:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80120a:	f6 c6 08             	test   $0x8,%dh
+  80120d:	74 15                	je     801224 <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80120f:	89 c2                	mov    %eax,%edx
+  801211:	c1 ea 08             	shr    $0x8,%edx
+  801214:	83 e2 0f             	and    $0xf,%edx
+  801217:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80121c:	83 fa 06             	cmp    $0x6,%edx
+  80121f:	74 0e                	je     80122f <sys_page_copy+0x7a>
+  801221:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801224:	0f b6 c9             	movzbl %cl,%ecx
+  801227:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80122d:	eb 98                	jmp    8011c7 <sys_page_copy+0x12>
+  80122f:	89 c2                	mov    %eax,%edx
+  801231:	c1 ea 04             	shr    $0x4,%edx
+  801234:	83 e2 0f             	and    $0xf,%edx
+  801237:	83 fa 02             	cmp    $0x2,%edx
+  80123a:	77 e5                	ja     801221 <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  80123c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80123f:	83 f8 02             	cmp    $0x2,%eax
+  801242:	0f 97 c1             	seta   %cl
+  801245:	0f b6 c9             	movzbl %cl,%ecx
+  801248:	eb d7                	jmp    801221 <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  80124a:	b8 29 00 00 00       	mov    $0x29,%eax
+  80124f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801252:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801255:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801258:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80125b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80125e:	cd 30                	int    $0x30
+  801260:	eb 90                	jmp    8011f2 <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801262:	83 ec 0c             	sub    $0xc,%esp
+  801265:	50                   	push   %eax
+  801266:	6a 29                	push   $0x29
+  801268:	68 59 2b 80 00       	push   $0x802b59
+  80126d:	6a 4a                	push   $0x4a
+  80126f:	68 76 2b 80 00       	push   $0x802b76
+  801274:	e8 6d 13 00 00       	call   8025e6 <_panic>
+
+00801279 <sys_yield>:
+{
+  801279:	55                   	push   %ebp
+  80127a:	89 e5                	mov    %esp,%ebp
+  80127c:	57                   	push   %edi
+  80127d:	56                   	push   %esi
+  80127e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80127f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801286:	78 2e                	js     8012b6 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  801288:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80128f:	74 71                	je     801302 <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  801291:	ba 00 00 00 00       	mov    $0x0,%edx
+  801296:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80129b:	89 d1                	mov    %edx,%ecx
+  80129d:	89 d3                	mov    %edx,%ebx
+  80129f:	89 d7                	mov    %edx,%edi
+  8012a1:	89 d6                	mov    %edx,%esi
+  8012a3:	55                   	push   %ebp
+  8012a4:	68 ad 12 80 00       	push   $0x8012ad
+  8012a9:	89 e5                	mov    %esp,%ebp
+  8012ab:	0f 34                	sysenter
+  8012ad:	83 c4 04             	add    $0x4,%esp
+  8012b0:	5d                   	pop    %ebp
+}
+  8012b1:	5b                   	pop    %ebx
+  8012b2:	5e                   	pop    %esi
+  8012b3:	5f                   	pop    %edi
+  8012b4:	5d                   	pop    %ebp
+  8012b5:	c3                   	ret
+  8012b6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012bb:	0f a2                	cpuid
+		return 0;
+  8012bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8012c2:	f6 c6 08             	test   $0x8,%dh
+  8012c5:	74 15                	je     8012dc <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012c7:	89 c2                	mov    %eax,%edx
+  8012c9:	c1 ea 08             	shr    $0x8,%edx
+  8012cc:	83 e2 0f             	and    $0xf,%edx
+  8012cf:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012d4:	83 fa 06             	cmp    $0x6,%edx
+  8012d7:	74 0e                	je     8012e7 <sys_yield+0x6e>
+  8012d9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8012dc:	0f b6 c9             	movzbl %cl,%ecx
+  8012df:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8012e5:	eb a1                	jmp    801288 <sys_yield+0xf>
+  8012e7:	89 c2                	mov    %eax,%edx
+  8012e9:	c1 ea 04             	shr    $0x4,%edx
+  8012ec:	83 e2 0f             	and    $0xf,%edx
+  8012ef:	83 fa 02             	cmp    $0x2,%edx
+  8012f2:	77 e5                	ja     8012d9 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  8012f4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012f7:	83 f8 02             	cmp    $0x2,%eax
+  8012fa:	0f 97 c1             	seta   %cl
+  8012fd:	0f b6 c9             	movzbl %cl,%ecx
+  801300:	eb d7                	jmp    8012d9 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  801302:	ba 00 00 00 00       	mov    $0x0,%edx
+  801307:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80130c:	89 d1                	mov    %edx,%ecx
+  80130e:	89 d3                	mov    %edx,%ebx
+  801310:	89 d7                	mov    %edx,%edi
+  801312:	89 d6                	mov    %edx,%esi
+  801314:	cd 30                	int    $0x30
+}
+  801316:	eb 99                	jmp    8012b1 <sys_yield+0x38>
+
+00801318 <sys_env_set_status>:
+{
+  801318:	55                   	push   %ebp
+  801319:	89 e5                	mov    %esp,%ebp
+  80131b:	57                   	push   %edi
+  80131c:	56                   	push   %esi
+  80131d:	53                   	push   %ebx
+  80131e:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801321:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801328:	78 37                	js     801361 <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  80132a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801331:	74 7a                	je     8013ad <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  801333:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801338:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80133e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801343:	89 df                	mov    %ebx,%edi
+  801345:	89 de                	mov    %ebx,%esi
+  801347:	55                   	push   %ebp
+  801348:	68 51 13 80 00       	push   $0x801351
+  80134d:	89 e5                	mov    %esp,%ebp
+  80134f:	0f 34                	sysenter
+  801351:	83 c4 04             	add    $0x4,%esp
+  801354:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801355:	85 c0                	test   %eax,%eax
+  801357:	7f 6c                	jg     8013c5 <sys_env_set_status+0xad>
+}
+  801359:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80135c:	5b                   	pop    %ebx
+  80135d:	5e                   	pop    %esi
+  80135e:	5f                   	pop    %edi
+  80135f:	5d                   	pop    %ebp
+  801360:	c3                   	ret
+  801361:	b8 01 00 00 00       	mov    $0x1,%eax
+  801366:	0f a2                	cpuid
+		return 0;
+  801368:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80136d:	f6 c6 08             	test   $0x8,%dh
+  801370:	74 15                	je     801387 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801372:	89 c2                	mov    %eax,%edx
+  801374:	c1 ea 08             	shr    $0x8,%edx
+  801377:	83 e2 0f             	and    $0xf,%edx
+  80137a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80137f:	83 fa 06             	cmp    $0x6,%edx
+  801382:	74 0e                	je     801392 <sys_env_set_status+0x7a>
+  801384:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801387:	0f b6 c9             	movzbl %cl,%ecx
+  80138a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801390:	eb 98                	jmp    80132a <sys_env_set_status+0x12>
+  801392:	89 c2                	mov    %eax,%edx
+  801394:	c1 ea 04             	shr    $0x4,%edx
+  801397:	83 e2 0f             	and    $0xf,%edx
+  80139a:	83 fa 02             	cmp    $0x2,%edx
+  80139d:	77 e5                	ja     801384 <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  80139f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013a2:	83 f8 02             	cmp    $0x2,%eax
+  8013a5:	0f 97 c1             	seta   %cl
+  8013a8:	0f b6 c9             	movzbl %cl,%ecx
+  8013ab:	eb d7                	jmp    801384 <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  8013ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b2:	b8 08 00 00 00       	mov    $0x8,%eax
+  8013b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013bd:	89 df                	mov    %ebx,%edi
+  8013bf:	89 de                	mov    %ebx,%esi
+  8013c1:	cd 30                	int    $0x30
+  8013c3:	eb 90                	jmp    801355 <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013c5:	83 ec 0c             	sub    $0xc,%esp
+  8013c8:	50                   	push   %eax
+  8013c9:	6a 08                	push   $0x8
+  8013cb:	68 59 2b 80 00       	push   $0x802b59
+  8013d0:	6a 4a                	push   $0x4a
+  8013d2:	68 76 2b 80 00       	push   $0x802b76
+  8013d7:	e8 0a 12 00 00       	call   8025e6 <_panic>
+
+008013dc <sys_sysinfo>:
+{
+  8013dc:	55                   	push   %ebp
+  8013dd:	89 e5                	mov    %esp,%ebp
+  8013df:	57                   	push   %edi
+  8013e0:	56                   	push   %esi
+  8013e1:	53                   	push   %ebx
+  8013e2:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8013e5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8013ec:	78 36                	js     801424 <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  8013ee:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8013f5:	74 79                	je     801470 <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  8013f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013ff:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801404:	89 cb                	mov    %ecx,%ebx
+  801406:	89 cf                	mov    %ecx,%edi
+  801408:	89 ce                	mov    %ecx,%esi
+  80140a:	55                   	push   %ebp
+  80140b:	68 14 14 80 00       	push   $0x801414
+  801410:	89 e5                	mov    %esp,%ebp
+  801412:	0f 34                	sysenter
+  801414:	83 c4 04             	add    $0x4,%esp
+  801417:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801418:	85 c0                	test   %eax,%eax
+  80141a:	7f 6b                	jg     801487 <sys_sysinfo+0xab>
+}
+  80141c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80141f:	5b                   	pop    %ebx
+  801420:	5e                   	pop    %esi
+  801421:	5f                   	pop    %edi
+  801422:	5d                   	pop    %ebp
+  801423:	c3                   	ret
+  801424:	b8 01 00 00 00       	mov    $0x1,%eax
+  801429:	0f a2                	cpuid
+		return 0;
+  80142b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801430:	f6 c6 08             	test   $0x8,%dh
+  801433:	74 15                	je     80144a <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801435:	89 c2                	mov    %eax,%edx
+  801437:	c1 ea 08             	shr    $0x8,%edx
+  80143a:	83 e2 0f             	and    $0xf,%edx
+  80143d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801442:	83 fa 06             	cmp    $0x6,%edx
+  801445:	74 0e                	je     801455 <sys_sysinfo+0x79>
+  801447:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80144a:	0f b6 c9             	movzbl %cl,%ecx
+  80144d:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801453:	eb 99                	jmp    8013ee <sys_sysinfo+0x12>
+  801455:	89 c2                	mov    %eax,%edx
+  801457:	c1 ea 04             	shr    $0x4,%edx
+  80145a:	83 e2 0f             	and    $0xf,%edx
+  80145d:	83 fa 02             	cmp    $0x2,%edx
+  801460:	77 e5                	ja     801447 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  801462:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801465:	83 f8 02             	cmp    $0x2,%eax
+  801468:	0f 97 c1             	seta   %cl
+  80146b:	0f b6 c9             	movzbl %cl,%ecx
+  80146e:	eb d7                	jmp    801447 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  801470:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801475:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80147a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80147d:	89 cb                	mov    %ecx,%ebx
+  80147f:	89 cf                	mov    %ecx,%edi
+  801481:	89 ce                	mov    %ecx,%esi
+  801483:	cd 30                	int    $0x30
+  801485:	eb 91                	jmp    801418 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801487:	83 ec 0c             	sub    $0xc,%esp
+  80148a:	50                   	push   %eax
+  80148b:	6a 0b                	push   $0xb
+  80148d:	68 59 2b 80 00       	push   $0x802b59
+  801492:	6a 4a                	push   $0x4a
+  801494:	68 76 2b 80 00       	push   $0x802b76
+  801499:	e8 48 11 00 00       	call   8025e6 <_panic>
+
+0080149e <sys_env_set_trapframe>:
+{
+  80149e:	55                   	push   %ebp
+  80149f:	89 e5                	mov    %esp,%ebp
+  8014a1:	57                   	push   %edi
+  8014a2:	56                   	push   %esi
+  8014a3:	53                   	push   %ebx
+  8014a4:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8014a7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8014ae:	78 37                	js     8014e7 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  8014b0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8014b7:	74 7a                	je     801533 <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  8014b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c4:	b8 13 00 00 00       	mov    $0x13,%eax
+  8014c9:	89 df                	mov    %ebx,%edi
+  8014cb:	89 de                	mov    %ebx,%esi
+  8014cd:	55                   	push   %ebp
+  8014ce:	68 d7 14 80 00       	push   $0x8014d7
+  8014d3:	89 e5                	mov    %esp,%ebp
+  8014d5:	0f 34                	sysenter
+  8014d7:	83 c4 04             	add    $0x4,%esp
+  8014da:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8014db:	85 c0                	test   %eax,%eax
+  8014dd:	7f 6c                	jg     80154b <sys_env_set_trapframe+0xad>
+}
+  8014df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014e2:	5b                   	pop    %ebx
+  8014e3:	5e                   	pop    %esi
+  8014e4:	5f                   	pop    %edi
+  8014e5:	5d                   	pop    %ebp
+  8014e6:	c3                   	ret
+  8014e7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014ec:	0f a2                	cpuid
+		return 0;
+  8014ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8014f3:	f6 c6 08             	test   $0x8,%dh
+  8014f6:	74 15                	je     80150d <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014f8:	89 c2                	mov    %eax,%edx
+  8014fa:	c1 ea 08             	shr    $0x8,%edx
+  8014fd:	83 e2 0f             	and    $0xf,%edx
+  801500:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801505:	83 fa 06             	cmp    $0x6,%edx
+  801508:	74 0e                	je     801518 <sys_env_set_trapframe+0x7a>
+  80150a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80150d:	0f b6 c9             	movzbl %cl,%ecx
+  801510:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801516:	eb 98                	jmp    8014b0 <sys_env_set_trapframe+0x12>
+  801518:	89 c2                	mov    %eax,%edx
+  80151a:	c1 ea 04             	shr    $0x4,%edx
+  80151d:	83 e2 0f             	and    $0xf,%edx
+  801520:	83 fa 02             	cmp    $0x2,%edx
+  801523:	77 e5                	ja     80150a <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  801525:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801528:	83 f8 02             	cmp    $0x2,%eax
+  80152b:	0f 97 c1             	seta   %cl
+  80152e:	0f b6 c9             	movzbl %cl,%ecx
+  801531:	eb d7                	jmp    80150a <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  801533:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801538:	b8 13 00 00 00       	mov    $0x13,%eax
+  80153d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801540:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801543:	89 df                	mov    %ebx,%edi
+  801545:	89 de                	mov    %ebx,%esi
+  801547:	cd 30                	int    $0x30
+  801549:	eb 90                	jmp    8014db <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80154b:	83 ec 0c             	sub    $0xc,%esp
+  80154e:	50                   	push   %eax
+  80154f:	6a 13                	push   $0x13
+  801551:	68 59 2b 80 00       	push   $0x802b59
+  801556:	6a 4a                	push   $0x4a
+  801558:	68 76 2b 80 00       	push   $0x802b76
+  80155d:	e8 84 10 00 00       	call   8025e6 <_panic>
+
+00801562 <sys_env_set_stack_limit>:
+{
+  801562:	55                   	push   %ebp
+  801563:	89 e5                	mov    %esp,%ebp
+  801565:	57                   	push   %edi
+  801566:	56                   	push   %esi
+  801567:	53                   	push   %ebx
+  801568:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80156b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801572:	78 37                	js     8015ab <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  801574:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80157b:	74 7a                	je     8015f7 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  80157d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801582:	8b 55 08             	mov    0x8(%ebp),%edx
+  801585:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801588:	b8 19 00 00 00       	mov    $0x19,%eax
+  80158d:	89 df                	mov    %ebx,%edi
+  80158f:	89 de                	mov    %ebx,%esi
+  801591:	55                   	push   %ebp
+  801592:	68 9b 15 80 00       	push   $0x80159b
+  801597:	89 e5                	mov    %esp,%ebp
+  801599:	0f 34                	sysenter
+  80159b:	83 c4 04             	add    $0x4,%esp
+  80159e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80159f:	85 c0                	test   %eax,%eax
+  8015a1:	7f 6c                	jg     80160f <sys_env_set_stack_limit+0xad>
+}
+  8015a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015a6:	5b                   	pop    %ebx
+  8015a7:	5e                   	pop    %esi
+  8015a8:	5f                   	pop    %edi
+  8015a9:	5d                   	pop    %ebp
+  8015aa:	c3                   	ret
+  8015ab:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015b0:	0f a2                	cpuid
+		return 0;
+  8015b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8015b7:	f6 c6 08             	test   $0x8,%dh
+  8015ba:	74 15                	je     8015d1 <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015bc:	89 c2                	mov    %eax,%edx
+  8015be:	c1 ea 08             	shr    $0x8,%edx
+  8015c1:	83 e2 0f             	and    $0xf,%edx
+  8015c4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8015c9:	83 fa 06             	cmp    $0x6,%edx
+  8015cc:	74 0e                	je     8015dc <sys_env_set_stack_limit+0x7a>
+  8015ce:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8015d1:	0f b6 c9             	movzbl %cl,%ecx
+  8015d4:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8015da:	eb 98                	jmp    801574 <sys_env_set_stack_limit+0x12>
+  8015dc:	89 c2                	mov    %eax,%edx
+  8015de:	c1 ea 04             	shr    $0x4,%edx
+  8015e1:	83 e2 0f             	and    $0xf,%edx
+  8015e4:	83 fa 02             	cmp    $0x2,%edx
+  8015e7:	77 e5                	ja     8015ce <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  8015e9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015ec:	83 f8 02             	cmp    $0x2,%eax
+  8015ef:	0f 97 c1             	seta   %cl
+  8015f2:	0f b6 c9             	movzbl %cl,%ecx
+  8015f5:	eb d7                	jmp    8015ce <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  8015f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015fc:	b8 19 00 00 00       	mov    $0x19,%eax
+  801601:	8b 55 08             	mov    0x8(%ebp),%edx
+  801604:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801607:	89 df                	mov    %ebx,%edi
+  801609:	89 de                	mov    %ebx,%esi
+  80160b:	cd 30                	int    $0x30
+  80160d:	eb 90                	jmp    80159f <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80160f:	83 ec 0c             	sub    $0xc,%esp
+  801612:	50                   	push   %eax
+  801613:	6a 19                	push   $0x19
+  801615:	68 59 2b 80 00       	push   $0x802b59
+  80161a:	6a 4a                	push   $0x4a
+  80161c:	68 76 2b 80 00       	push   $0x802b76
+  801621:	e8 c0 0f 00 00       	call   8025e6 <_panic>
+
+00801626 <sys_env_set_pgfault_upcall>:
+{
+  801626:	55                   	push   %ebp
+  801627:	89 e5                	mov    %esp,%ebp
+  801629:	57                   	push   %edi
+  80162a:	56                   	push   %esi
+  80162b:	53                   	push   %ebx
+  80162c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80162f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801636:	78 37                	js     80166f <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  801638:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80163f:	74 7a                	je     8016bb <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  801641:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801646:	8b 55 08             	mov    0x8(%ebp),%edx
+  801649:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80164c:	b8 09 00 00 00       	mov    $0x9,%eax
+  801651:	89 df                	mov    %ebx,%edi
+  801653:	89 de                	mov    %ebx,%esi
+  801655:	55                   	push   %ebp
+  801656:	68 5f 16 80 00       	push   $0x80165f
+  80165b:	89 e5                	mov    %esp,%ebp
+  80165d:	0f 34                	sysenter
+  80165f:	83 c4 04             	add    $0x4,%esp
+  801662:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801663:	85 c0                	test   %eax,%eax
+  801665:	7f 6c                	jg     8016d3 <sys_env_set_pgfault_upcall+0xad>
+}
+  801667:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80166a:	5b                   	pop    %ebx
+  80166b:	5e                   	pop    %esi
+  80166c:	5f                   	pop    %edi
+  80166d:	5d                   	pop    %ebp
+  80166e:	c3                   	ret
+  80166f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801674:	0f a2                	cpuid
+		return 0;
+  801676:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80167b:	f6 c6 08             	test   $0x8,%dh
+  80167e:	74 15                	je     801695 <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801680:	89 c2                	mov    %eax,%edx
+  801682:	c1 ea 08             	shr    $0x8,%edx
+  801685:	83 e2 0f             	and    $0xf,%edx
+  801688:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80168d:	83 fa 06             	cmp    $0x6,%edx
+  801690:	74 0e                	je     8016a0 <sys_env_set_pgfault_upcall+0x7a>
+  801692:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801695:	0f b6 c9             	movzbl %cl,%ecx
+  801698:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80169e:	eb 98                	jmp    801638 <sys_env_set_pgfault_upcall+0x12>
+  8016a0:	89 c2                	mov    %eax,%edx
+  8016a2:	c1 ea 04             	shr    $0x4,%edx
+  8016a5:	83 e2 0f             	and    $0xf,%edx
+  8016a8:	83 fa 02             	cmp    $0x2,%edx
+  8016ab:	77 e5                	ja     801692 <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  8016ad:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016b0:	83 f8 02             	cmp    $0x2,%eax
+  8016b3:	0f 97 c1             	seta   %cl
+  8016b6:	0f b6 c9             	movzbl %cl,%ecx
+  8016b9:	eb d7                	jmp    801692 <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  8016bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016c0:	b8 09 00 00 00       	mov    $0x9,%eax
+  8016c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016cb:	89 df                	mov    %ebx,%edi
+  8016cd:	89 de                	mov    %ebx,%esi
+  8016cf:	cd 30                	int    $0x30
+  8016d1:	eb 90                	jmp    801663 <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016d3:	83 ec 0c             	sub    $0xc,%esp
+  8016d6:	50                   	push   %eax
+  8016d7:	6a 09                	push   $0x9
+  8016d9:	68 59 2b 80 00       	push   $0x802b59
+  8016de:	6a 4a                	push   $0x4a
+  8016e0:	68 76 2b 80 00       	push   $0x802b76
+  8016e5:	e8 fc 0e 00 00       	call   8025e6 <_panic>
+
+008016ea <sys_ipc_try_send>:
+{
+  8016ea:	55                   	push   %ebp
+  8016eb:	89 e5                	mov    %esp,%ebp
+  8016ed:	57                   	push   %edi
+  8016ee:	56                   	push   %esi
+  8016ef:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8016f0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8016f7:	78 32                	js     80172b <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  8016f9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801700:	74 75                	je     801777 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801702:	8b 55 08             	mov    0x8(%ebp),%edx
+  801705:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801708:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80170d:	be 00 00 00 00       	mov    $0x0,%esi
+  801712:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801715:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801718:	55                   	push   %ebp
+  801719:	68 22 17 80 00       	push   $0x801722
+  80171e:	89 e5                	mov    %esp,%ebp
+  801720:	0f 34                	sysenter
+  801722:	83 c4 04             	add    $0x4,%esp
+  801725:	5d                   	pop    %ebp
+}
+  801726:	5b                   	pop    %ebx
+  801727:	5e                   	pop    %esi
+  801728:	5f                   	pop    %edi
+  801729:	5d                   	pop    %ebp
+  80172a:	c3                   	ret
+  80172b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801730:	0f a2                	cpuid
+		return 0;
+  801732:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801737:	f6 c6 08             	test   $0x8,%dh
+  80173a:	74 15                	je     801751 <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80173c:	89 c2                	mov    %eax,%edx
+  80173e:	c1 ea 08             	shr    $0x8,%edx
+  801741:	83 e2 0f             	and    $0xf,%edx
+  801744:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801749:	83 fa 06             	cmp    $0x6,%edx
+  80174c:	74 0e                	je     80175c <sys_ipc_try_send+0x72>
+  80174e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801751:	0f b6 c9             	movzbl %cl,%ecx
+  801754:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80175a:	eb 9d                	jmp    8016f9 <sys_ipc_try_send+0xf>
+  80175c:	89 c2                	mov    %eax,%edx
+  80175e:	c1 ea 04             	shr    $0x4,%edx
+  801761:	83 e2 0f             	and    $0xf,%edx
+  801764:	83 fa 02             	cmp    $0x2,%edx
+  801767:	77 e5                	ja     80174e <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  801769:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80176c:	83 f8 02             	cmp    $0x2,%eax
+  80176f:	0f 97 c1             	seta   %cl
+  801772:	0f b6 c9             	movzbl %cl,%ecx
+  801775:	eb d7                	jmp    80174e <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  801777:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80177c:	be 00 00 00 00       	mov    $0x0,%esi
+  801781:	8b 55 08             	mov    0x8(%ebp),%edx
+  801784:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801787:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80178a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80178d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  80178f:	eb 95                	jmp    801726 <sys_ipc_try_send+0x3c>
+
+00801791 <sys_ipc_send>:
+{
+  801791:	55                   	push   %ebp
+  801792:	89 e5                	mov    %esp,%ebp
+  801794:	57                   	push   %edi
+  801795:	56                   	push   %esi
+  801796:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801797:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80179e:	78 32                	js     8017d2 <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  8017a0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8017a7:	74 75                	je     80181e <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  8017a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017af:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8017b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8017b9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017bc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8017bf:	55                   	push   %ebp
+  8017c0:	68 c9 17 80 00       	push   $0x8017c9
+  8017c5:	89 e5                	mov    %esp,%ebp
+  8017c7:	0f 34                	sysenter
+  8017c9:	83 c4 04             	add    $0x4,%esp
+  8017cc:	5d                   	pop    %ebp
+}
+  8017cd:	5b                   	pop    %ebx
+  8017ce:	5e                   	pop    %esi
+  8017cf:	5f                   	pop    %edi
+  8017d0:	5d                   	pop    %ebp
+  8017d1:	c3                   	ret
+  8017d2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8017d7:	0f a2                	cpuid
+		return 0;
+  8017d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8017de:	f6 c6 08             	test   $0x8,%dh
+  8017e1:	74 15                	je     8017f8 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017e3:	89 c2                	mov    %eax,%edx
+  8017e5:	c1 ea 08             	shr    $0x8,%edx
+  8017e8:	83 e2 0f             	and    $0xf,%edx
+  8017eb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017f0:	83 fa 06             	cmp    $0x6,%edx
+  8017f3:	74 0e                	je     801803 <sys_ipc_send+0x72>
+  8017f5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8017f8:	0f b6 c9             	movzbl %cl,%ecx
+  8017fb:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801801:	eb 9d                	jmp    8017a0 <sys_ipc_send+0xf>
+  801803:	89 c2                	mov    %eax,%edx
+  801805:	c1 ea 04             	shr    $0x4,%edx
+  801808:	83 e2 0f             	and    $0xf,%edx
+  80180b:	83 fa 02             	cmp    $0x2,%edx
+  80180e:	77 e5                	ja     8017f5 <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  801810:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801813:	83 f8 02             	cmp    $0x2,%eax
+  801816:	0f 97 c1             	seta   %cl
+  801819:	0f b6 c9             	movzbl %cl,%ecx
+  80181c:	eb d7                	jmp    8017f5 <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  80181e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801823:	be 00 00 00 00       	mov    $0x0,%esi
+  801828:	8b 55 08             	mov    0x8(%ebp),%edx
+  80182b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80182e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801831:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801834:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801836:	eb 95                	jmp    8017cd <sys_ipc_send+0x3c>
+
+00801838 <sys_ipc_recv>:
+{
+  801838:	55                   	push   %ebp
+  801839:	89 e5                	mov    %esp,%ebp
+  80183b:	57                   	push   %edi
+  80183c:	56                   	push   %esi
+  80183d:	53                   	push   %ebx
+  80183e:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801841:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801848:	78 36                	js     801880 <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  80184a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801851:	74 79                	je     8018cc <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  801853:	8b 55 08             	mov    0x8(%ebp),%edx
+  801856:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80185b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801860:	89 cb                	mov    %ecx,%ebx
+  801862:	89 cf                	mov    %ecx,%edi
+  801864:	89 ce                	mov    %ecx,%esi
+  801866:	55                   	push   %ebp
+  801867:	68 70 18 80 00       	push   $0x801870
+  80186c:	89 e5                	mov    %esp,%ebp
+  80186e:	0f 34                	sysenter
+  801870:	83 c4 04             	add    $0x4,%esp
+  801873:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801874:	85 c0                	test   %eax,%eax
+  801876:	7f 6b                	jg     8018e3 <sys_ipc_recv+0xab>
+}
+  801878:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80187b:	5b                   	pop    %ebx
+  80187c:	5e                   	pop    %esi
+  80187d:	5f                   	pop    %edi
+  80187e:	5d                   	pop    %ebp
+  80187f:	c3                   	ret
+  801880:	b8 01 00 00 00       	mov    $0x1,%eax
+  801885:	0f a2                	cpuid
+		return 0;
+  801887:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80188c:	f6 c6 08             	test   $0x8,%dh
+  80188f:	74 15                	je     8018a6 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801891:	89 c2                	mov    %eax,%edx
+  801893:	c1 ea 08             	shr    $0x8,%edx
+  801896:	83 e2 0f             	and    $0xf,%edx
+  801899:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80189e:	83 fa 06             	cmp    $0x6,%edx
+  8018a1:	74 0e                	je     8018b1 <sys_ipc_recv+0x79>
+  8018a3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8018a6:	0f b6 c9             	movzbl %cl,%ecx
+  8018a9:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8018af:	eb 99                	jmp    80184a <sys_ipc_recv+0x12>
+  8018b1:	89 c2                	mov    %eax,%edx
+  8018b3:	c1 ea 04             	shr    $0x4,%edx
+  8018b6:	83 e2 0f             	and    $0xf,%edx
+  8018b9:	83 fa 02             	cmp    $0x2,%edx
+  8018bc:	77 e5                	ja     8018a3 <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  8018be:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018c1:	83 f8 02             	cmp    $0x2,%eax
+  8018c4:	0f 97 c1             	seta   %cl
+  8018c7:	0f b6 c9             	movzbl %cl,%ecx
+  8018ca:	eb d7                	jmp    8018a3 <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  8018cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018d1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8018d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018d9:	89 cb                	mov    %ecx,%ebx
+  8018db:	89 cf                	mov    %ecx,%edi
+  8018dd:	89 ce                	mov    %ecx,%esi
+  8018df:	cd 30                	int    $0x30
+  8018e1:	eb 91                	jmp    801874 <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8018e3:	83 ec 0c             	sub    $0xc,%esp
+  8018e6:	50                   	push   %eax
+  8018e7:	6a 0d                	push   $0xd
+  8018e9:	68 59 2b 80 00       	push   $0x802b59
+  8018ee:	6a 4a                	push   $0x4a
+  8018f0:	68 76 2b 80 00       	push   $0x802b76
+  8018f5:	e8 ec 0c 00 00       	call   8025e6 <_panic>
+
+008018fa <sys_ipc_send_range>:
+{
+  8018fa:	55                   	push   %ebp
+  8018fb:	89 e5                	mov    %esp,%ebp
+  8018fd:	57                   	push   %edi
+  8018fe:	56                   	push   %esi
+  8018ff:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801900:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801907:	78 30                	js     801939 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  801909:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801910:	74 73                	je     801985 <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801912:	8b 55 08             	mov    0x8(%ebp),%edx
+  801915:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801918:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80191d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801920:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801923:	8b 75 18             	mov    0x18(%ebp),%esi
+  801926:	55                   	push   %ebp
+  801927:	68 30 19 80 00       	push   $0x801930
+  80192c:	89 e5                	mov    %esp,%ebp
+  80192e:	0f 34                	sysenter
+  801930:	83 c4 04             	add    $0x4,%esp
+  801933:	5d                   	pop    %ebp
+}
+  801934:	5b                   	pop    %ebx
+  801935:	5e                   	pop    %esi
+  801936:	5f                   	pop    %edi
+  801937:	5d                   	pop    %ebp
+  801938:	c3                   	ret
+  801939:	b8 01 00 00 00       	mov    $0x1,%eax
+  80193e:	0f a2                	cpuid
+		return 0;
+  801940:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801945:	f6 c6 08             	test   $0x8,%dh
+  801948:	74 15                	je     80195f <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80194a:	89 c2                	mov    %eax,%edx
+  80194c:	c1 ea 08             	shr    $0x8,%edx
+  80194f:	83 e2 0f             	and    $0xf,%edx
+  801952:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801957:	83 fa 06             	cmp    $0x6,%edx
+  80195a:	74 0e                	je     80196a <sys_ipc_send_range+0x70>
+  80195c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80195f:	0f b6 c9             	movzbl %cl,%ecx
+  801962:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801968:	eb 9f                	jmp    801909 <sys_ipc_send_range+0xf>
+  80196a:	89 c2                	mov    %eax,%edx
+  80196c:	c1 ea 04             	shr    $0x4,%edx
+  80196f:	83 e2 0f             	and    $0xf,%edx
+  801972:	83 fa 02             	cmp    $0x2,%edx
+  801975:	77 e5                	ja     80195c <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  801977:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80197a:	83 f8 02             	cmp    $0x2,%eax
+  80197d:	0f 97 c1             	seta   %cl
+  801980:	0f b6 c9             	movzbl %cl,%ecx
+  801983:	eb d7                	jmp    80195c <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  801985:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80198a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80198d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801990:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801993:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801996:	8b 75 18             	mov    0x18(%ebp),%esi
+  801999:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  80199b:	eb 97                	jmp    801934 <sys_ipc_send_range+0x3a>
+
+0080199d <sys_ipc_recv_range>:
+{
+  80199d:	55                   	push   %ebp
+  80199e:	89 e5                	mov    %esp,%ebp
+  8019a0:	57                   	push   %edi
+  8019a1:	56                   	push   %esi
+  8019a2:	53                   	push   %ebx
+  8019a3:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8019a6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8019ad:	78 37                	js     8019e6 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  8019af:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8019b6:	74 7a                	je     801a32 <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  8019b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019c3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8019c8:	89 df                	mov    %ebx,%edi
+  8019ca:	89 de                	mov    %ebx,%esi
+  8019cc:	55                   	push   %ebp
+  8019cd:	68 d6 19 80 00       	push   $0x8019d6
+  8019d2:	89 e5                	mov    %esp,%ebp
+  8019d4:	0f 34                	sysenter
+  8019d6:	83 c4 04             	add    $0x4,%esp
+  8019d9:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8019da:	85 c0                	test   %eax,%eax
+  8019dc:	7f 6c                	jg     801a4a <sys_ipc_recv_range+0xad>
+}
+  8019de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019e1:	5b                   	pop    %ebx
+  8019e2:	5e                   	pop    %esi
+  8019e3:	5f                   	pop    %edi
+  8019e4:	5d                   	pop    %ebp
+  8019e5:	c3                   	ret
+  8019e6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019eb:	0f a2                	cpuid
+		return 0;
+  8019ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8019f2:	f6 c6 08             	test   $0x8,%dh
+  8019f5:	74 15                	je     801a0c <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019f7:	89 c2                	mov    %eax,%edx
+  8019f9:	c1 ea 08             	shr    $0x8,%edx
+  8019fc:	83 e2 0f             	and    $0xf,%edx
+  8019ff:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a04:	83 fa 06             	cmp    $0x6,%edx
+  801a07:	74 0e                	je     801a17 <sys_ipc_recv_range+0x7a>
+  801a09:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a0c:	0f b6 c9             	movzbl %cl,%ecx
+  801a0f:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801a15:	eb 98                	jmp    8019af <sys_ipc_recv_range+0x12>
+  801a17:	89 c2                	mov    %eax,%edx
+  801a19:	c1 ea 04             	shr    $0x4,%edx
+  801a1c:	83 e2 0f             	and    $0xf,%edx
+  801a1f:	83 fa 02             	cmp    $0x2,%edx
+  801a22:	77 e5                	ja     801a09 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801a24:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a27:	83 f8 02             	cmp    $0x2,%eax
+  801a2a:	0f 97 c1             	seta   %cl
+  801a2d:	0f b6 c9             	movzbl %cl,%ecx
+  801a30:	eb d7                	jmp    801a09 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801a32:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a37:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801a3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a3f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a42:	89 df                	mov    %ebx,%edi
+  801a44:	89 de                	mov    %ebx,%esi
+  801a46:	cd 30                	int    $0x30
+  801a48:	eb 90                	jmp    8019da <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a4a:	83 ec 0c             	sub    $0xc,%esp
+  801a4d:	50                   	push   %eax
+  801a4e:	6a 1f                	push   $0x1f
+  801a50:	68 59 2b 80 00       	push   $0x802b59
+  801a55:	6a 4a                	push   $0x4a
+  801a57:	68 76 2b 80 00       	push   $0x802b76
+  801a5c:	e8 85 0b 00 00       	call   8025e6 <_panic>
+
+00801a61 <sys_ipc_call>:
+{
+  801a61:	55                   	push   %ebp
+  801a62:	89 e5                	mov    %esp,%ebp
+  801a64:	57                   	push   %edi
+  801a65:	56                   	push   %esi
+  801a66:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801a67:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a6a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801a6f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801a72:	55                   	push   %ebp
+  801a73:	56                   	push   %esi
+  801a74:	8b 0e                	mov    (%esi),%ecx
+  801a76:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801a79:	8b 7e 08             	mov    0x8(%esi),%edi
+  801a7c:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801a7f:	8b 76 0c             	mov    0xc(%esi),%esi
+  801a82:	cd 30                	int    $0x30
+  801a84:	87 34 24             	xchg   %esi,(%esp)
+  801a87:	89 0e                	mov    %ecx,(%esi)
+  801a89:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801a8c:	89 7e 08             	mov    %edi,0x8(%esi)
+  801a8f:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801a92:	8f 46 0c             	pop    0xc(%esi)
+  801a95:	5d                   	pop    %ebp
+}
+  801a96:	5b                   	pop    %ebx
+  801a97:	5e                   	pop    %esi
+  801a98:	5f                   	pop    %edi
+  801a99:	5d                   	pop    %ebp
+  801a9a:	c3                   	ret
+
+00801a9b <sys_ipc_reply_wait>:
+{
+  801a9b:	55                   	push   %ebp
+  801a9c:	89 e5                	mov    %esp,%ebp
+  801a9e:	57                   	push   %edi
+  801a9f:	56                   	push   %esi
+  801aa0:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801aa1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aa4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801aa9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801aac:	55                   	push   %ebp
+  801aad:	56                   	push   %esi
+  801aae:	8b 0e                	mov    (%esi),%ecx
+  801ab0:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801ab3:	8b 7e 08             	mov    0x8(%esi),%edi
+  801ab6:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801ab9:	8b 76 0c             	mov    0xc(%esi),%esi
+  801abc:	cd 30                	int    $0x30
+  801abe:	87 34 24             	xchg   %esi,(%esp)
+  801ac1:	89 0e                	mov    %ecx,(%esi)
+  801ac3:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801ac6:	89 7e 08             	mov    %edi,0x8(%esi)
+  801ac9:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801acc:	8f 46 0c             	pop    0xc(%esi)
+  801acf:	5d                   	pop    %ebp
+}
+  801ad0:	5b                   	pop    %ebx
+  801ad1:	5e                   	pop    %esi
+  801ad2:	5f                   	pop    %edi
+  801ad3:	5d                   	pop    %ebp
+  801ad4:	c3                   	ret
+
+00801ad5 <sys_ipc_send_msg>:
+{
+  801ad5:	55                   	push   %ebp
+  801ad6:	89 e5                	mov    %esp,%ebp
+  801ad8:	57                   	push   %edi
+  801ad9:	56                   	push   %esi
+  801ada:	53                   	push   %ebx
+  801adb:	83 ec 20             	sub    $0x20,%esp
+  801ade:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801ae1:	8b 10                	mov    (%eax),%edx
+  801ae3:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801ae6:	8b 50 04             	mov    0x4(%eax),%edx
+  801ae9:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801aec:	8b 50 08             	mov    0x8(%eax),%edx
+  801aef:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801af2:	8b 50 0c             	mov    0xc(%eax),%edx
+  801af5:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801af8:	8b 40 10             	mov    0x10(%eax),%eax
+  801afb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801afe:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801b01:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b04:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801b09:	55                   	push   %ebp
+  801b0a:	56                   	push   %esi
+  801b0b:	8b 0e                	mov    (%esi),%ecx
+  801b0d:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801b10:	8b 7e 08             	mov    0x8(%esi),%edi
+  801b13:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801b16:	8b 76 0c             	mov    0xc(%esi),%esi
+  801b19:	cd 30                	int    $0x30
+  801b1b:	87 34 24             	xchg   %esi,(%esp)
+  801b1e:	89 0e                	mov    %ecx,(%esi)
+  801b20:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801b23:	89 7e 08             	mov    %edi,0x8(%esi)
+  801b26:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801b29:	8f 46 0c             	pop    0xc(%esi)
+  801b2c:	5d                   	pop    %ebp
+}
+  801b2d:	83 c4 20             	add    $0x20,%esp
+  801b30:	5b                   	pop    %ebx
+  801b31:	5e                   	pop    %esi
+  801b32:	5f                   	pop    %edi
+  801b33:	5d                   	pop    %ebp
+  801b34:	c3                   	ret
+
+00801b35 <sys_fork>:
+{
+  801b35:	55                   	push   %ebp
+  801b36:	89 e5                	mov    %esp,%ebp
+  801b38:	57                   	push   %edi
+  801b39:	56                   	push   %esi
+  801b3a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801b3b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b42:	78 2e                	js     801b72 <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801b44:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b4b:	74 71                	je     801bbe <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801b4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b52:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801b57:	89 d1                	mov    %edx,%ecx
+  801b59:	89 d3                	mov    %edx,%ebx
+  801b5b:	89 d7                	mov    %edx,%edi
+  801b5d:	89 d6                	mov    %edx,%esi
+  801b5f:	55                   	push   %ebp
+  801b60:	68 69 1b 80 00       	push   $0x801b69
+  801b65:	89 e5                	mov    %esp,%ebp
+  801b67:	0f 34                	sysenter
+  801b69:	83 c4 04             	add    $0x4,%esp
+  801b6c:	5d                   	pop    %ebp
+}
+  801b6d:	5b                   	pop    %ebx
+  801b6e:	5e                   	pop    %esi
+  801b6f:	5f                   	pop    %edi
+  801b70:	5d                   	pop    %ebp
+  801b71:	c3                   	ret
+  801b72:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b77:	0f a2                	cpuid
+		return 0;
+  801b79:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b7e:	f6 c6 08             	test   $0x8,%dh
+  801b81:	74 15                	je     801b98 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b83:	89 c2                	mov    %eax,%edx
+  801b85:	c1 ea 08             	shr    $0x8,%edx
+  801b88:	83 e2 0f             	and    $0xf,%edx
+  801b8b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b90:	83 fa 06             	cmp    $0x6,%edx
+  801b93:	74 0e                	je     801ba3 <sys_fork+0x6e>
+  801b95:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b98:	0f b6 c9             	movzbl %cl,%ecx
+  801b9b:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801ba1:	eb a1                	jmp    801b44 <sys_fork+0xf>
+  801ba3:	89 c2                	mov    %eax,%edx
+  801ba5:	c1 ea 04             	shr    $0x4,%edx
+  801ba8:	83 e2 0f             	and    $0xf,%edx
+  801bab:	83 fa 02             	cmp    $0x2,%edx
+  801bae:	77 e5                	ja     801b95 <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801bb0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bb3:	83 f8 02             	cmp    $0x2,%eax
+  801bb6:	0f 97 c1             	seta   %cl
+  801bb9:	0f b6 c9             	movzbl %cl,%ecx
+  801bbc:	eb d7                	jmp    801b95 <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801bbe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bc3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801bc8:	89 d1                	mov    %edx,%ecx
+  801bca:	89 d3                	mov    %edx,%ebx
+  801bcc:	89 d7                	mov    %edx,%edi
+  801bce:	89 d6                	mov    %edx,%esi
+  801bd0:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801bd2:	eb 99                	jmp    801b6d <sys_fork+0x38>
+
+00801bd4 <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801bd4:	55                   	push   %ebp
+  801bd5:	89 e5                	mov    %esp,%ebp
+  801bd7:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801bda:	ff 75 14             	push   0x14(%ebp)
+  801bdd:	ff 75 10             	push   0x10(%ebp)
+  801be0:	ff 75 0c             	push   0xc(%ebp)
+  801be3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801be8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801beb:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801bf0:	e8 81 ee ff ff       	call   800a76 <page_vec_call>
+}
+  801bf5:	c9                   	leave
+  801bf6:	c3                   	ret
+
+00801bf7 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801bf7:	55                   	push   %ebp
+  801bf8:	89 e5                	mov    %esp,%ebp
+  801bfa:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801bfd:	ff 75 18             	push   0x18(%ebp)
+  801c00:	ff 75 14             	push   0x14(%ebp)
+  801c03:	ff 75 10             	push   0x10(%ebp)
+  801c06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c09:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c0c:	b8 10 00 00 00       	mov    $0x10,%eax
+  801c11:	e8 60 ee ff ff       	call   800a76 <page_vec_call>
+}
+  801c16:	c9                   	leave
+  801c17:	c3                   	ret
+
+00801c18 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801c18:	55                   	push   %ebp
+  801c19:	89 e5                	mov    %esp,%ebp
+  801c1b:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801c1e:	ff 75 14             	push   0x14(%ebp)
+  801c21:	ff 75 10             	push   0x10(%ebp)
+  801c24:	ff 75 0c             	push   0xc(%ebp)
+  801c27:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c2f:	b8 11 00 00 00       	mov    $0x11,%eax
+  801c34:	e8 3d ee ff ff       	call   800a76 <page_vec_call>
+}
+  801c39:	c9                   	leave
+  801c3a:	c3                   	ret
+
+00801c3b <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801c3b:	55                   	push   %ebp
+  801c3c:	89 e5                	mov    %esp,%ebp
+  801c3e:	57                   	push   %edi
+  801c3f:	56                   	push   %esi
+  801c40:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801c41:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801c48:	78 32                	js     801c7c <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801c4a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801c51:	74 75                	je     801cc8 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801c53:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c56:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c59:	b8 12 00 00 00       	mov    $0x12,%eax
+  801c5e:	be 00 00 00 00       	mov    $0x0,%esi
+  801c63:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801c66:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801c69:	55                   	push   %ebp
+  801c6a:	68 73 1c 80 00       	push   $0x801c73
+  801c6f:	89 e5                	mov    %esp,%ebp
+  801c71:	0f 34                	sysenter
+  801c73:	83 c4 04             	add    $0x4,%esp
+  801c76:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801c77:	5b                   	pop    %ebx
+  801c78:	5e                   	pop    %esi
+  801c79:	5f                   	pop    %edi
+  801c7a:	5d                   	pop    %ebp
+  801c7b:	c3                   	ret
+  801c7c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c81:	0f a2                	cpuid
+		return 0;
+  801c83:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801c88:	f6 c6 08             	test   $0x8,%dh
+  801c8b:	74 15                	je     801ca2 <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c8d:	89 c2                	mov    %eax,%edx
+  801c8f:	c1 ea 08             	shr    $0x8,%edx
+  801c92:	83 e2 0f             	and    $0xf,%edx
+  801c95:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801c9a:	83 fa 06             	cmp    $0x6,%edx
+  801c9d:	74 0e                	je     801cad <sys_vm_ranges+0x72>
+  801c9f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801ca2:	0f b6 c9             	movzbl %cl,%ecx
+  801ca5:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801cab:	eb 9d                	jmp    801c4a <sys_vm_ranges+0xf>
+  801cad:	89 c2                	mov    %eax,%edx
+  801caf:	c1 ea 04             	shr    $0x4,%edx
+  801cb2:	83 e2 0f             	and    $0xf,%edx
+  801cb5:	83 fa 02             	cmp    $0x2,%edx
+  801cb8:	77 e5                	ja     801c9f <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  801cba:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801cbd:	83 f8 02             	cmp    $0x2,%eax
+  801cc0:	0f 97 c1             	seta   %cl
+  801cc3:	0f b6 c9             	movzbl %cl,%ecx
+  801cc6:	eb d7                	jmp    801c9f <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801cc8:	b8 12 00 00 00       	mov    $0x12,%eax
+  801ccd:	be 00 00 00 00       	mov    $0x0,%esi
+  801cd2:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cd5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cd8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801cdb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801cde:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801ce0:	eb 95                	jmp    801c77 <sys_vm_ranges+0x3c>
+
+00801ce2 <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801ce2:	55                   	push   %ebp
+  801ce3:	89 e5                	mov    %esp,%ebp
+  801ce5:	57                   	push   %edi
+  801ce6:	56                   	push   %esi
+  801ce7:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801ce8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801cef:	78 31                	js     801d22 <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801cf1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801cf8:	74 74                	je     801d6e <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801cfa:	be 00 00 00 00       	mov    $0x0,%esi
+  801cff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d02:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d05:	b8 14 00 00 00       	mov    $0x14,%eax
+  801d0a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d0d:	89 f7                	mov    %esi,%edi
+  801d0f:	55                   	push   %ebp
+  801d10:	68 19 1d 80 00       	push   $0x801d19
+  801d15:	89 e5                	mov    %esp,%ebp
+  801d17:	0f 34                	sysenter
+  801d19:	83 c4 04             	add    $0x4,%esp
+  801d1c:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801d1d:	5b                   	pop    %ebx
+  801d1e:	5e                   	pop    %esi
+  801d1f:	5f                   	pop    %edi
+  801d20:	5d                   	pop    %ebp
+  801d21:	c3                   	ret
+  801d22:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d27:	0f a2                	cpuid
+		return 0;
+  801d29:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801d2e:	f6 c6 08             	test   $0x8,%dh
+  801d31:	74 15                	je     801d48 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d33:	89 c2                	mov    %eax,%edx
+  801d35:	c1 ea 08             	shr    $0x8,%edx
+  801d38:	83 e2 0f             	and    $0xf,%edx
+  801d3b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d40:	83 fa 06             	cmp    $0x6,%edx
+  801d43:	74 0e                	je     801d53 <sys_spawn+0x71>
+  801d45:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801d48:	0f b6 c9             	movzbl %cl,%ecx
+  801d4b:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801d51:	eb 9e                	jmp    801cf1 <sys_spawn+0xf>
+  801d53:	89 c2                	mov    %eax,%edx
+  801d55:	c1 ea 04             	shr    $0x4,%edx
+  801d58:	83 e2 0f             	and    $0xf,%edx
+  801d5b:	83 fa 02             	cmp    $0x2,%edx
+  801d5e:	77 e5                	ja     801d45 <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  801d60:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d63:	83 f8 02             	cmp    $0x2,%eax
+  801d66:	0f 97 c1             	seta   %cl
+  801d69:	0f b6 c9             	movzbl %cl,%ecx
+  801d6c:	eb d7                	jmp    801d45 <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  801d6e:	be 00 00 00 00       	mov    $0x0,%esi
+  801d73:	b8 14 00 00 00       	mov    $0x14,%eax
+  801d78:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d7b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d7e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d81:	89 f7                	mov    %esi,%edi
+  801d83:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  801d85:	eb 96                	jmp    801d1d <sys_spawn+0x3b>
+
+00801d87 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  801d87:	55                   	push   %ebp
+  801d88:	89 e5                	mov    %esp,%ebp
+  801d8a:	57                   	push   %edi
+  801d8b:	56                   	push   %esi
+  801d8c:	53                   	push   %ebx
+  801d8d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801d90:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801d97:	78 37                	js     801dd0 <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  801d99:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801da0:	74 7a                	je     801e1c <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  801da2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801da7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801daa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801dad:	b8 15 00 00 00       	mov    $0x15,%eax
+  801db2:	89 df                	mov    %ebx,%edi
+  801db4:	89 de                	mov    %ebx,%esi
+  801db6:	55                   	push   %ebp
+  801db7:	68 c0 1d 80 00       	push   $0x801dc0
+  801dbc:	89 e5                	mov    %esp,%ebp
+  801dbe:	0f 34                	sysenter
+  801dc0:	83 c4 04             	add    $0x4,%esp
+  801dc3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801dc4:	85 c0                	test   %eax,%eax
+  801dc6:	7f 6c                	jg     801e34 <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  801dc8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dcb:	5b                   	pop    %ebx
+  801dcc:	5e                   	pop    %esi
+  801dcd:	5f                   	pop    %edi
+  801dce:	5d                   	pop    %ebp
+  801dcf:	c3                   	ret
+  801dd0:	b8 01 00 00 00       	mov    $0x1,%eax
+  801dd5:	0f a2                	cpuid
+		return 0;
+  801dd7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801ddc:	f6 c6 08             	test   $0x8,%dh
+  801ddf:	74 15                	je     801df6 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801de1:	89 c2                	mov    %eax,%edx
+  801de3:	c1 ea 08             	shr    $0x8,%edx
+  801de6:	83 e2 0f             	and    $0xf,%edx
+  801de9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801dee:	83 fa 06             	cmp    $0x6,%edx
+  801df1:	74 0e                	je     801e01 <sys_shm_create+0x7a>
+  801df3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801df6:	0f b6 c9             	movzbl %cl,%ecx
+  801df9:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801dff:	eb 98                	jmp    801d99 <sys_shm_create+0x12>
+  801e01:	89 c2                	mov    %eax,%edx
+  801e03:	c1 ea 04             	shr    $0x4,%edx
+  801e06:	83 e2 0f             	and    $0xf,%edx
+  801e09:	83 fa 02             	cmp    $0x2,%edx
+  801e0c:	77 e5                	ja     801df3 <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  801e0e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e11:	83 f8 02             	cmp    $0x2,%eax
+  801e14:	0f 97 c1             	seta   %cl
+  801e17:	0f b6 c9             	movzbl %cl,%ecx
+  801e1a:	eb d7                	jmp    801df3 <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  801e1c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e21:	b8 15 00 00 00       	mov    $0x15,%eax
+  801e26:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e29:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e2c:	89 df                	mov    %ebx,%edi
+  801e2e:	89 de                	mov    %ebx,%esi
+  801e30:	cd 30                	int    $0x30
+  801e32:	eb 90                	jmp    801dc4 <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801e34:	83 ec 0c             	sub    $0xc,%esp
+  801e37:	50                   	push   %eax
+  801e38:	6a 15                	push   $0x15
+  801e3a:	68 59 2b 80 00       	push   $0x802b59
+  801e3f:	6a 4a                	push   $0x4a
+  801e41:	68 76 2b 80 00       	push   $0x802b76
+  801e46:	e8 9b 07 00 00       	call   8025e6 <_panic>
+
+00801e4b <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  801e4b:	55                   	push   %ebp
+  801e4c:	89 e5                	mov    %esp,%ebp
+  801e4e:	57                   	push   %edi
+  801e4f:	56                   	push   %esi
+  801e50:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801e51:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801e58:	78 32                	js     801e8c <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  801e5a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801e61:	74 75                	je     801ed8 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801e63:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e66:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e69:	b8 16 00 00 00       	mov    $0x16,%eax
+  801e6e:	be 00 00 00 00       	mov    $0x0,%esi
+  801e73:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e76:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801e79:	55                   	push   %ebp
+  801e7a:	68 83 1e 80 00       	push   $0x801e83
+  801e7f:	89 e5                	mov    %esp,%ebp
+  801e81:	0f 34                	sysenter
+  801e83:	83 c4 04             	add    $0x4,%esp
+  801e86:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  801e87:	5b                   	pop    %ebx
+  801e88:	5e                   	pop    %esi
+  801e89:	5f                   	pop    %edi
+  801e8a:	5d                   	pop    %ebp
+  801e8b:	c3                   	ret
+  801e8c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e91:	0f a2                	cpuid
+		return 0;
+  801e93:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801e98:	f6 c6 08             	test   $0x8,%dh
+  801e9b:	74 15                	je     801eb2 <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e9d:	89 c2                	mov    %eax,%edx
+  801e9f:	c1 ea 08             	shr    $0x8,%edx
+  801ea2:	83 e2 0f             	and    $0xf,%edx
+  801ea5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801eaa:	83 fa 06             	cmp    $0x6,%edx
+  801ead:	74 0e                	je     801ebd <sys_shm_attach+0x72>
+  801eaf:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801eb2:	0f b6 c9             	movzbl %cl,%ecx
+  801eb5:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801ebb:	eb 9d                	jmp    801e5a <sys_shm_attach+0xf>
+  801ebd:	89 c2                	mov    %eax,%edx
+  801ebf:	c1 ea 04             	shr    $0x4,%edx
+  801ec2:	83 e2 0f             	and    $0xf,%edx
+  801ec5:	83 fa 02             	cmp    $0x2,%edx
+  801ec8:	77 e5                	ja     801eaf <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  801eca:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ecd:	83 f8 02             	cmp    $0x2,%eax
+  801ed0:	0f 97 c1             	seta   %cl
+  801ed3:	0f b6 c9             	movzbl %cl,%ecx
+  801ed6:	eb d7                	jmp    801eaf <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  801ed8:	b8 16 00 00 00       	mov    $0x16,%eax
+  801edd:	be 00 00 00 00       	mov    $0x0,%esi
+  801ee2:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ee5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ee8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801eeb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801eee:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  801ef0:	eb 95                	jmp    801e87 <sys_shm_attach+0x3c>
+
+00801ef2 <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  801ef2:	55                   	push   %ebp
+  801ef3:	89 e5                	mov    %esp,%ebp
+  801ef5:	57                   	push   %edi
+  801ef6:	56                   	push   %esi
+  801ef7:	53                   	push   %ebx
+  801ef8:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801efb:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801f02:	78 38                	js     801f3c <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  801f04:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801f0b:	74 7b                	je     801f88 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  801f0d:	be 00 00 00 00       	mov    $0x0,%esi
+  801f12:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f15:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f18:	b8 17 00 00 00       	mov    $0x17,%eax
+  801f1d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f20:	89 f7                	mov    %esi,%edi
+  801f22:	55                   	push   %ebp
+  801f23:	68 2c 1f 80 00       	push   $0x801f2c
+  801f28:	89 e5                	mov    %esp,%ebp
+  801f2a:	0f 34                	sysenter
+  801f2c:	83 c4 04             	add    $0x4,%esp
+  801f2f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801f30:	85 c0                	test   %eax,%eax
+  801f32:	7f 6d                	jg     801fa1 <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  801f34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f37:	5b                   	pop    %ebx
+  801f38:	5e                   	pop    %esi
+  801f39:	5f                   	pop    %edi
+  801f3a:	5d                   	pop    %ebp
+  801f3b:	c3                   	ret
+  801f3c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f41:	0f a2                	cpuid
+		return 0;
+  801f43:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801f48:	f6 c6 08             	test   $0x8,%dh
+  801f4b:	74 15                	je     801f62 <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f4d:	89 c2                	mov    %eax,%edx
+  801f4f:	c1 ea 08             	shr    $0x8,%edx
+  801f52:	83 e2 0f             	and    $0xf,%edx
+  801f55:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f5a:	83 fa 06             	cmp    $0x6,%edx
+  801f5d:	74 0e                	je     801f6d <sys_shm_detach+0x7b>
+  801f5f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801f62:	0f b6 c9             	movzbl %cl,%ecx
+  801f65:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801f6b:	eb 97                	jmp    801f04 <sys_shm_detach+0x12>
+  801f6d:	89 c2                	mov    %eax,%edx
+  801f6f:	c1 ea 04             	shr    $0x4,%edx
+  801f72:	83 e2 0f             	and    $0xf,%edx
+  801f75:	83 fa 02             	cmp    $0x2,%edx
+  801f78:	77 e5                	ja     801f5f <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  801f7a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f7d:	83 f8 02             	cmp    $0x2,%eax
+  801f80:	0f 97 c1             	seta   %cl
+  801f83:	0f b6 c9             	movzbl %cl,%ecx
+  801f86:	eb d7                	jmp    801f5f <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  801f88:	be 00 00 00 00       	mov    $0x0,%esi
+  801f8d:	b8 17 00 00 00       	mov    $0x17,%eax
+  801f92:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f95:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f98:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f9b:	89 f7                	mov    %esi,%edi
+  801f9d:	cd 30                	int    $0x30
+  801f9f:	eb 8f                	jmp    801f30 <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801fa1:	83 ec 0c             	sub    $0xc,%esp
+  801fa4:	50                   	push   %eax
+  801fa5:	6a 17                	push   $0x17
+  801fa7:	68 59 2b 80 00       	push   $0x802b59
+  801fac:	6a 4a                	push   $0x4a
+  801fae:	68 76 2b 80 00       	push   $0x802b76
+  801fb3:	e8 2e 06 00 00       	call   8025e6 <_panic>
+
+00801fb8 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  801fb8:	55                   	push   %ebp
+  801fb9:	89 e5                	mov    %esp,%ebp
+  801fbb:	57                   	push   %edi
+  801fbc:	56                   	push   %esi
+  801fbd:	53                   	push   %ebx
+  801fbe:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801fc1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801fc8:	78 36                	js     802000 <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  801fca:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801fd1:	74 79                	je     80204c <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  801fd3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fd6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fdb:	b8 18 00 00 00       	mov    $0x18,%eax
+  801fe0:	89 cb                	mov    %ecx,%ebx
+  801fe2:	89 cf                	mov    %ecx,%edi
+  801fe4:	89 ce                	mov    %ecx,%esi
+  801fe6:	55                   	push   %ebp
+  801fe7:	68 f0 1f 80 00       	push   $0x801ff0
+  801fec:	89 e5                	mov    %esp,%ebp
+  801fee:	0f 34                	sysenter
+  801ff0:	83 c4 04             	add    $0x4,%esp
+  801ff3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801ff4:	85 c0                	test   %eax,%eax
+  801ff6:	7f 6b                	jg     802063 <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  801ff8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ffb:	5b                   	pop    %ebx
+  801ffc:	5e                   	pop    %esi
+  801ffd:	5f                   	pop    %edi
+  801ffe:	5d                   	pop    %ebp
+  801fff:	c3                   	ret
+  802000:	b8 01 00 00 00       	mov    $0x1,%eax
+  802005:	0f a2                	cpuid
+		return 0;
+  802007:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80200c:	f6 c6 08             	test   $0x8,%dh
+  80200f:	74 15                	je     802026 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802011:	89 c2                	mov    %eax,%edx
+  802013:	c1 ea 08             	shr    $0x8,%edx
+  802016:	83 e2 0f             	and    $0xf,%edx
+  802019:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80201e:	83 fa 06             	cmp    $0x6,%edx
+  802021:	74 0e                	je     802031 <sys_shm_remove+0x79>
+  802023:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802026:	0f b6 c9             	movzbl %cl,%ecx
+  802029:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80202f:	eb 99                	jmp    801fca <sys_shm_remove+0x12>
+  802031:	89 c2                	mov    %eax,%edx
+  802033:	c1 ea 04             	shr    $0x4,%edx
+  802036:	83 e2 0f             	and    $0xf,%edx
+  802039:	83 fa 02             	cmp    $0x2,%edx
+  80203c:	77 e5                	ja     802023 <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  80203e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802041:	83 f8 02             	cmp    $0x2,%eax
+  802044:	0f 97 c1             	seta   %cl
+  802047:	0f b6 c9             	movzbl %cl,%ecx
+  80204a:	eb d7                	jmp    802023 <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  80204c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802051:	b8 18 00 00 00       	mov    $0x18,%eax
+  802056:	8b 55 08             	mov    0x8(%ebp),%edx
+  802059:	89 cb                	mov    %ecx,%ebx
+  80205b:	89 cf                	mov    %ecx,%edi
+  80205d:	89 ce                	mov    %ecx,%esi
+  80205f:	cd 30                	int    $0x30
+  802061:	eb 91                	jmp    801ff4 <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802063:	83 ec 0c             	sub    $0xc,%esp
+  802066:	50                   	push   %eax
+  802067:	6a 18                	push   $0x18
+  802069:	68 59 2b 80 00       	push   $0x802b59
+  80206e:	6a 4a                	push   $0x4a
+  802070:	68 76 2b 80 00       	push   $0x802b76
+  802075:	e8 6c 05 00 00       	call   8025e6 <_panic>
+
+0080207a <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  80207a:	55                   	push   %ebp
+  80207b:	89 e5                	mov    %esp,%ebp
+  80207d:	57                   	push   %edi
+  80207e:	56                   	push   %esi
+  80207f:	53                   	push   %ebx
+  802080:	83 ec 0c             	sub    $0xc,%esp
+  802083:	8b 45 10             	mov    0x10(%ebp),%eax
+  802086:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802089:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  80208c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802093:	78 32                	js     8020c7 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  802095:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80209c:	74 75                	je     802113 <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  80209e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020a4:	b8 20 00 00 00       	mov    $0x20,%eax
+  8020a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8020ae:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8020b1:	55                   	push   %ebp
+  8020b2:	68 bb 20 80 00       	push   $0x8020bb
+  8020b7:	89 e5                	mov    %esp,%ebp
+  8020b9:	0f 34                	sysenter
+  8020bb:	83 c4 04             	add    $0x4,%esp
+  8020be:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  8020bf:	83 c4 0c             	add    $0xc,%esp
+  8020c2:	5b                   	pop    %ebx
+  8020c3:	5e                   	pop    %esi
+  8020c4:	5f                   	pop    %edi
+  8020c5:	5d                   	pop    %ebp
+  8020c6:	c3                   	ret
+  8020c7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020cc:	0f a2                	cpuid
+		return 0;
+  8020ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8020d3:	f6 c6 08             	test   $0x8,%dh
+  8020d6:	74 15                	je     8020ed <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020d8:	89 c2                	mov    %eax,%edx
+  8020da:	c1 ea 08             	shr    $0x8,%edx
+  8020dd:	83 e2 0f             	and    $0xf,%edx
+  8020e0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8020e5:	83 fa 06             	cmp    $0x6,%edx
+  8020e8:	74 0e                	je     8020f8 <sys_futex_wait+0x7e>
+  8020ea:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8020ed:	0f b6 c9             	movzbl %cl,%ecx
+  8020f0:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8020f6:	eb 9d                	jmp    802095 <sys_futex_wait+0x1b>
+  8020f8:	89 c2                	mov    %eax,%edx
+  8020fa:	c1 ea 04             	shr    $0x4,%edx
+  8020fd:	83 e2 0f             	and    $0xf,%edx
+  802100:	83 fa 02             	cmp    $0x2,%edx
+  802103:	77 e5                	ja     8020ea <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  802105:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802108:	83 f8 02             	cmp    $0x2,%eax
+  80210b:	0f 97 c1             	seta   %cl
+  80210e:	0f b6 c9             	movzbl %cl,%ecx
+  802111:	eb d7                	jmp    8020ea <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  802113:	b8 20 00 00 00       	mov    $0x20,%eax
+  802118:	be 00 00 00 00       	mov    $0x0,%esi
+  80211d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802120:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802123:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802126:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  802128:	eb 95                	jmp    8020bf <sys_futex_wait+0x45>
+
+0080212a <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80212a:	55                   	push   %ebp
+  80212b:	89 e5                	mov    %esp,%ebp
+  80212d:	57                   	push   %edi
+  80212e:	56                   	push   %esi
+  80212f:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802130:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802137:	78 30                	js     802169 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  802139:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802140:	74 73                	je     8021b5 <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  802142:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802147:	8b 55 08             	mov    0x8(%ebp),%edx
+  80214a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80214d:	b8 21 00 00 00       	mov    $0x21,%eax
+  802152:	89 df                	mov    %ebx,%edi
+  802154:	89 de                	mov    %ebx,%esi
+  802156:	55                   	push   %ebp
+  802157:	68 60 21 80 00       	push   $0x802160
+  80215c:	89 e5                	mov    %esp,%ebp
+  80215e:	0f 34                	sysenter
+  802160:	83 c4 04             	add    $0x4,%esp
+  802163:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  802164:	5b                   	pop    %ebx
+  802165:	5e                   	pop    %esi
+  802166:	5f                   	pop    %edi
+  802167:	5d                   	pop    %ebp
+  802168:	c3                   	ret
+  802169:	b8 01 00 00 00       	mov    $0x1,%eax
+  80216e:	0f a2                	cpuid
+		return 0;
+  802170:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802175:	f6 c6 08             	test   $0x8,%dh
+  802178:	74 15                	je     80218f <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80217a:	89 c2                	mov    %eax,%edx
+  80217c:	c1 ea 08             	shr    $0x8,%edx
+  80217f:	83 e2 0f             	and    $0xf,%edx
+  802182:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802187:	83 fa 06             	cmp    $0x6,%edx
+  80218a:	74 0e                	je     80219a <sys_futex_wake+0x70>
+  80218c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80218f:	0f b6 c9             	movzbl %cl,%ecx
+  802192:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802198:	eb 9f                	jmp    802139 <sys_futex_wake+0xf>
+  80219a:	89 c2                	mov    %eax,%edx
+  80219c:	c1 ea 04             	shr    $0x4,%edx
+  80219f:	83 e2 0f             	and    $0xf,%edx
+  8021a2:	83 fa 02             	cmp    $0x2,%edx
+  8021a5:	77 e5                	ja     80218c <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  8021a7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021aa:	83 f8 02             	cmp    $0x2,%eax
+  8021ad:	0f 97 c1             	seta   %cl
+  8021b0:	0f b6 c9             	movzbl %cl,%ecx
+  8021b3:	eb d7                	jmp    80218c <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  8021b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021ba:	b8 21 00 00 00       	mov    $0x21,%eax
+  8021bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021c5:	89 df                	mov    %ebx,%edi
+  8021c7:	89 de                	mov    %ebx,%esi
+  8021c9:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  8021cb:	eb 97                	jmp    802164 <sys_futex_wake+0x3a>
+
+008021cd <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  8021cd:	55                   	push   %ebp
+  8021ce:	89 e5                	mov    %esp,%ebp
+  8021d0:	57                   	push   %edi
+  8021d1:	56                   	push   %esi
+  8021d2:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8021d3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8021da:	78 2e                	js     80220a <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  8021dc:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8021e3:	74 71                	je     802256 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  8021e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021ea:	b8 22 00 00 00       	mov    $0x22,%eax
+  8021ef:	89 d1                	mov    %edx,%ecx
+  8021f1:	89 d3                	mov    %edx,%ebx
+  8021f3:	89 d7                	mov    %edx,%edi
+  8021f5:	89 d6                	mov    %edx,%esi
+  8021f7:	55                   	push   %ebp
+  8021f8:	68 01 22 80 00       	push   $0x802201
+  8021fd:	89 e5                	mov    %esp,%ebp
+  8021ff:	0f 34                	sysenter
+  802201:	83 c4 04             	add    $0x4,%esp
+  802204:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  802205:	5b                   	pop    %ebx
+  802206:	5e                   	pop    %esi
+  802207:	5f                   	pop    %edi
+  802208:	5d                   	pop    %ebp
+  802209:	c3                   	ret
+  80220a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80220f:	0f a2                	cpuid
+		return 0;
+  802211:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802216:	f6 c6 08             	test   $0x8,%dh
+  802219:	74 15                	je     802230 <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80221b:	89 c2                	mov    %eax,%edx
+  80221d:	c1 ea 08             	shr    $0x8,%edx
+  802220:	83 e2 0f             	and    $0xf,%edx
+  802223:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802228:	83 fa 06             	cmp    $0x6,%edx
+  80222b:	74 0e                	je     80223b <sys_ep_create+0x6e>
+  80222d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802230:	0f b6 c9             	movzbl %cl,%ecx
+  802233:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802239:	eb a1                	jmp    8021dc <sys_ep_create+0xf>
+  80223b:	89 c2                	mov    %eax,%edx
+  80223d:	c1 ea 04             	shr    $0x4,%edx
+  802240:	83 e2 0f             	and    $0xf,%edx
+  802243:	83 fa 02             	cmp    $0x2,%edx
+  802246:	77 e5                	ja     80222d <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  802248:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80224b:	83 f8 02             	cmp    $0x2,%eax
+  80224e:	0f 97 c1             	seta   %cl
+  802251:	0f b6 c9             	movzbl %cl,%ecx
+  802254:	eb d7                	jmp    80222d <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  802256:	ba 00 00 00 00       	mov    $0x0,%edx
+  80225b:	b8 22 00 00 00       	mov    $0x22,%eax
+  802260:	89 d1                	mov    %edx,%ecx
+  802262:	89 d3                	mov    %edx,%ebx
+  802264:	89 d7                	mov    %edx,%edi
+  802266:	89 d6                	mov    %edx,%esi
+  802268:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  80226a:	eb 99                	jmp    802205 <sys_ep_create+0x38>
+
+0080226c <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  80226c:	55                   	push   %ebp
+  80226d:	89 e5                	mov    %esp,%ebp
+  80226f:	57                   	push   %edi
+  802270:	56                   	push   %esi
+  802271:	53                   	push   %ebx
+  802272:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802275:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80227c:	78 36                	js     8022b4 <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  80227e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802285:	74 79                	je     802300 <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  802287:	8b 55 08             	mov    0x8(%ebp),%edx
+  80228a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80228f:	b8 23 00 00 00       	mov    $0x23,%eax
+  802294:	89 cb                	mov    %ecx,%ebx
+  802296:	89 cf                	mov    %ecx,%edi
+  802298:	89 ce                	mov    %ecx,%esi
+  80229a:	55                   	push   %ebp
+  80229b:	68 a4 22 80 00       	push   $0x8022a4
+  8022a0:	89 e5                	mov    %esp,%ebp
+  8022a2:	0f 34                	sysenter
+  8022a4:	83 c4 04             	add    $0x4,%esp
+  8022a7:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8022a8:	85 c0                	test   %eax,%eax
+  8022aa:	7f 6b                	jg     802317 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  8022ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022af:	5b                   	pop    %ebx
+  8022b0:	5e                   	pop    %esi
+  8022b1:	5f                   	pop    %edi
+  8022b2:	5d                   	pop    %ebp
+  8022b3:	c3                   	ret
+  8022b4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022b9:	0f a2                	cpuid
+		return 0;
+  8022bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8022c0:	f6 c6 08             	test   $0x8,%dh
+  8022c3:	74 15                	je     8022da <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022c5:	89 c2                	mov    %eax,%edx
+  8022c7:	c1 ea 08             	shr    $0x8,%edx
+  8022ca:	83 e2 0f             	and    $0xf,%edx
+  8022cd:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8022d2:	83 fa 06             	cmp    $0x6,%edx
+  8022d5:	74 0e                	je     8022e5 <sys_ep_destroy+0x79>
+  8022d7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8022da:	0f b6 c9             	movzbl %cl,%ecx
+  8022dd:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8022e3:	eb 99                	jmp    80227e <sys_ep_destroy+0x12>
+  8022e5:	89 c2                	mov    %eax,%edx
+  8022e7:	c1 ea 04             	shr    $0x4,%edx
+  8022ea:	83 e2 0f             	and    $0xf,%edx
+  8022ed:	83 fa 02             	cmp    $0x2,%edx
+  8022f0:	77 e5                	ja     8022d7 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  8022f2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022f5:	83 f8 02             	cmp    $0x2,%eax
+  8022f8:	0f 97 c1             	seta   %cl
+  8022fb:	0f b6 c9             	movzbl %cl,%ecx
+  8022fe:	eb d7                	jmp    8022d7 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  802300:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802305:	b8 23 00 00 00       	mov    $0x23,%eax
+  80230a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80230d:	89 cb                	mov    %ecx,%ebx
+  80230f:	89 cf                	mov    %ecx,%edi
+  802311:	89 ce                	mov    %ecx,%esi
+  802313:	cd 30                	int    $0x30
+  802315:	eb 91                	jmp    8022a8 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802317:	83 ec 0c             	sub    $0xc,%esp
+  80231a:	50                   	push   %eax
+  80231b:	6a 23                	push   $0x23
+  80231d:	68 59 2b 80 00       	push   $0x802b59
+  802322:	6a 4a                	push   $0x4a
+  802324:	68 76 2b 80 00       	push   $0x802b76
+  802329:	e8 b8 02 00 00       	call   8025e6 <_panic>
+
+0080232e <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  80232e:	55                   	push   %ebp
+  80232f:	89 e5                	mov    %esp,%ebp
+  802331:	57                   	push   %edi
+  802332:	56                   	push   %esi
+  802333:	53                   	push   %ebx
+  802334:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802337:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80233e:	78 37                	js     802377 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  802340:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802347:	74 7a                	je     8023c3 <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  802349:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80234e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802351:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802354:	b8 24 00 00 00       	mov    $0x24,%eax
+  802359:	89 df                	mov    %ebx,%edi
+  80235b:	89 de                	mov    %ebx,%esi
+  80235d:	55                   	push   %ebp
+  80235e:	68 67 23 80 00       	push   $0x802367
+  802363:	89 e5                	mov    %esp,%ebp
+  802365:	0f 34                	sysenter
+  802367:	83 c4 04             	add    $0x4,%esp
+  80236a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80236b:	85 c0                	test   %eax,%eax
+  80236d:	7f 6c                	jg     8023db <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  80236f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802372:	5b                   	pop    %ebx
+  802373:	5e                   	pop    %esi
+  802374:	5f                   	pop    %edi
+  802375:	5d                   	pop    %ebp
+  802376:	c3                   	ret
+  802377:	b8 01 00 00 00       	mov    $0x1,%eax
+  80237c:	0f a2                	cpuid
+		return 0;
+  80237e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802383:	f6 c6 08             	test   $0x8,%dh
+  802386:	74 15                	je     80239d <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802388:	89 c2                	mov    %eax,%edx
+  80238a:	c1 ea 08             	shr    $0x8,%edx
+  80238d:	83 e2 0f             	and    $0xf,%edx
+  802390:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802395:	83 fa 06             	cmp    $0x6,%edx
+  802398:	74 0e                	je     8023a8 <sys_ep_grant+0x7a>
+  80239a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80239d:	0f b6 c9             	movzbl %cl,%ecx
+  8023a0:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8023a6:	eb 98                	jmp    802340 <sys_ep_grant+0x12>
+  8023a8:	89 c2                	mov    %eax,%edx
+  8023aa:	c1 ea 04             	shr    $0x4,%edx
+  8023ad:	83 e2 0f             	and    $0xf,%edx
+  8023b0:	83 fa 02             	cmp    $0x2,%edx
+  8023b3:	77 e5                	ja     80239a <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  8023b5:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023b8:	83 f8 02             	cmp    $0x2,%eax
+  8023bb:	0f 97 c1             	seta   %cl
+  8023be:	0f b6 c9             	movzbl %cl,%ecx
+  8023c1:	eb d7                	jmp    80239a <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  8023c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023c8:	b8 24 00 00 00       	mov    $0x24,%eax
+  8023cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023d3:	89 df                	mov    %ebx,%edi
+  8023d5:	89 de                	mov    %ebx,%esi
+  8023d7:	cd 30                	int    $0x30
+  8023d9:	eb 90                	jmp    80236b <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8023db:	83 ec 0c             	sub    $0xc,%esp
+  8023de:	50                   	push   %eax
+  8023df:	6a 24                	push   $0x24
+  8023e1:	68 59 2b 80 00       	push   $0x802b59
+  8023e6:	6a 4a                	push   $0x4a
+  8023e8:	68 76 2b 80 00       	push   $0x802b76
+  8023ed:	e8 f4 01 00 00       	call   8025e6 <_panic>
+
+008023f2 <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  8023f2:	55                   	push   %ebp
+  8023f3:	89 e5                	mov    %esp,%ebp
+  8023f5:	57                   	push   %edi
+  8023f6:	56                   	push   %esi
+  8023f7:	53                   	push   %ebx
+  8023f8:	83 ec 20             	sub    $0x20,%esp
+  8023fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  8023fe:	8b 10                	mov    (%eax),%edx
+  802400:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802403:	8b 50 04             	mov    0x4(%eax),%edx
+  802406:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802409:	8b 50 08             	mov    0x8(%eax),%edx
+  80240c:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  80240f:	8b 50 0c             	mov    0xc(%eax),%edx
+  802412:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  802415:	8b 40 10             	mov    0x10(%eax),%eax
+  802418:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  80241b:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  80241e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802421:	b8 25 00 00 00       	mov    $0x25,%eax
+  802426:	55                   	push   %ebp
+  802427:	56                   	push   %esi
+  802428:	8b 0e                	mov    (%esi),%ecx
+  80242a:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80242d:	8b 7e 08             	mov    0x8(%esi),%edi
+  802430:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802433:	8b 76 0c             	mov    0xc(%esi),%esi
+  802436:	cd 30                	int    $0x30
+  802438:	87 34 24             	xchg   %esi,(%esp)
+  80243b:	89 0e                	mov    %ecx,(%esi)
+  80243d:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802440:	89 7e 08             	mov    %edi,0x8(%esi)
+  802443:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802446:	8f 46 0c             	pop    0xc(%esi)
+  802449:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  80244a:	83 c4 20             	add    $0x20,%esp
+  80244d:	5b                   	pop    %ebx
+  80244e:	5e                   	pop    %esi
+  80244f:	5f                   	pop    %edi
+  802450:	5d                   	pop    %ebp
+  802451:	c3                   	ret
+
+00802452 <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  802452:	55                   	push   %ebp
+  802453:	89 e5                	mov    %esp,%ebp
+  802455:	57                   	push   %edi
+  802456:	56                   	push   %esi
+  802457:	53                   	push   %ebx
+  802458:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  80245b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80245e:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  802460:	8b 55 08             	mov    0x8(%ebp),%edx
+  802463:	b8 26 00 00 00       	mov    $0x26,%eax
+  802468:	55                   	push   %ebp
+  802469:	56                   	push   %esi
+  80246a:	8b 0e                	mov    (%esi),%ecx
+  80246c:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80246f:	8b 7e 08             	mov    0x8(%esi),%edi
+  802472:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802475:	8b 76 0c             	mov    0xc(%esi),%esi
+  802478:	cd 30                	int    $0x30
+  80247a:	87 34 24             	xchg   %esi,(%esp)
+  80247d:	89 0e                	mov    %ecx,(%esi)
+  80247f:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802482:	89 7e 08             	mov    %edi,0x8(%esi)
+  802485:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802488:	8f 46 0c             	pop    0xc(%esi)
+  80248b:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  80248c:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  802490:	74 0f                	je     8024a1 <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  802492:	85 c0                	test   %eax,%eax
+  802494:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802499:	0f 48 d1             	cmovs  %ecx,%edx
+  80249c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  80249f:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  8024a1:	5b                   	pop    %ebx
+  8024a2:	5e                   	pop    %esi
+  8024a3:	5f                   	pop    %edi
+  8024a4:	5d                   	pop    %ebp
+  8024a5:	c3                   	ret
+
+008024a6 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  8024a6:	55                   	push   %ebp
+  8024a7:	89 e5                	mov    %esp,%ebp
+  8024a9:	57                   	push   %edi
+  8024aa:	56                   	push   %esi
+  8024ab:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8024ac:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8024b3:	78 2f                	js     8024e4 <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  8024b5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8024bc:	74 72                	je     802530 <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  8024be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024c6:	b8 27 00 00 00       	mov    $0x27,%eax
+  8024cb:	89 cb                	mov    %ecx,%ebx
+  8024cd:	89 cf                	mov    %ecx,%edi
+  8024cf:	89 ce                	mov    %ecx,%esi
+  8024d1:	55                   	push   %ebp
+  8024d2:	68 db 24 80 00       	push   $0x8024db
+  8024d7:	89 e5                	mov    %esp,%ebp
+  8024d9:	0f 34                	sysenter
+  8024db:	83 c4 04             	add    $0x4,%esp
+  8024de:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  8024df:	5b                   	pop    %ebx
+  8024e0:	5e                   	pop    %esi
+  8024e1:	5f                   	pop    %edi
+  8024e2:	5d                   	pop    %ebp
+  8024e3:	c3                   	ret
+  8024e4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024e9:	0f a2                	cpuid
+		return 0;
+  8024eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8024f0:	f6 c6 08             	test   $0x8,%dh
+  8024f3:	74 15                	je     80250a <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8024f5:	89 c2                	mov    %eax,%edx
+  8024f7:	c1 ea 08             	shr    $0x8,%edx
+  8024fa:	83 e2 0f             	and    $0xf,%edx
+  8024fd:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802502:	83 fa 06             	cmp    $0x6,%edx
+  802505:	74 0e                	je     802515 <sys_sysring_setup+0x6f>
+  802507:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80250a:	0f b6 c9             	movzbl %cl,%ecx
+  80250d:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802513:	eb a0                	jmp    8024b5 <sys_sysring_setup+0xf>
+  802515:	89 c2                	mov    %eax,%edx
+  802517:	c1 ea 04             	shr    $0x4,%edx
+  80251a:	83 e2 0f             	and    $0xf,%edx
+  80251d:	83 fa 02             	cmp    $0x2,%edx
+  802520:	77 e5                	ja     802507 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  802522:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802525:	83 f8 02             	cmp    $0x2,%eax
+  802528:	0f 97 c1             	seta   %cl
+  80252b:	0f b6 c9             	movzbl %cl,%ecx
+  80252e:	eb d7                	jmp    802507 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  802530:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802535:	b8 27 00 00 00       	mov    $0x27,%eax
+  80253a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80253d:	89 cb                	mov    %ecx,%ebx
+  80253f:	89 cf                	mov    %ecx,%edi
+  802541:	89 ce                	mov    %ecx,%esi
+  802543:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  802545:	eb 98                	jmp    8024df <sys_sysring_setup+0x39>
+
+00802547 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  802547:	55                   	push   %ebp
+  802548:	89 e5                	mov    %esp,%ebp
+  80254a:	57                   	push   %edi
+  80254b:	56                   	push   %esi
+  80254c:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80254d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802554:	78 2e                	js     802584 <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  802556:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80255d:	74 71                	je     8025d0 <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  80255f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802564:	b8 28 00 00 00       	mov    $0x28,%eax
+  802569:	89 d1                	mov    %edx,%ecx
+  80256b:	89 d3                	mov    %edx,%ebx
+  80256d:	89 d7                	mov    %edx,%edi
+  80256f:	89 d6                	mov    %edx,%esi
+  802571:	55                   	push   %ebp
+  802572:	68 7b 25 80 00       	push   $0x80257b
+  802577:	89 e5                	mov    %esp,%ebp
+  802579:	0f 34                	sysenter
+  80257b:	83 c4 04             	add    $0x4,%esp
+  80257e:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  80257f:	5b                   	pop    %ebx
+  802580:	5e                   	pop    %esi
+  802581:	5f                   	pop    %edi
+  802582:	5d                   	pop    %ebp
+  802583:	c3                   	ret
+  802584:	b8 01 00 00 00       	mov    $0x1,%eax
+  802589:	0f a2                	cpuid
+		return 0;
+  80258b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802590:	f6 c6 08             	test   $0x8,%dh
+  802593:	74 15                	je     8025aa <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802595:	89 c2                	mov    %eax,%edx
+  802597:	c1 ea 08             	shr    $0x8,%edx
+  80259a:	83 e2 0f             	and    $0xf,%edx
+  80259d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8025a2:	83 fa 06             	cmp    $0x6,%edx
+  8025a5:	74 0e                	je     8025b5 <sys_sysring_enter+0x6e>
+  8025a7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8025aa:	0f b6 c9             	movzbl %cl,%ecx
+  8025ad:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8025b3:	eb a1                	jmp    802556 <sys_sysring_enter+0xf>
+  8025b5:	89 c2                	mov    %eax,%edx
+  8025b7:	c1 ea 04             	shr    $0x4,%edx
+  8025ba:	83 e2 0f             	and    $0xf,%edx
+  8025bd:	83 fa 02             	cmp    $0x2,%edx
+  8025c0:	77 e5                	ja     8025a7 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  8025c2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025c5:	83 f8 02             	cmp    $0x2,%eax
+  8025c8:	0f 97 c1             	seta   %cl
+  8025cb:	0f b6 c9             	movzbl %cl,%ecx
+  8025ce:	eb d7                	jmp    8025a7 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  8025d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025d5:	b8 28 00 00 00       	mov    $0x28,%eax
+  8025da:	89 d1                	mov    %edx,%ecx
+  8025dc:	89 d3                	mov    %edx,%ebx
+  8025de:	89 d7                	mov    %edx,%edi
+  8025e0:	89 d6                	mov    %edx,%esi
+  8025e2:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  8025e4:	eb 99                	jmp    80257f <sys_sysring_enter+0x38>
+
+008025e6 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8025e6:	55                   	push   %ebp
+  8025e7:	89 e5                	mov    %esp,%ebp
+  8025e9:	57                   	push   %edi
+  8025ea:	56                   	push   %esi
+  8025eb:	53                   	push   %ebx
+  8025ec:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  8025f2:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  8025f5:	8b 1d 00 30 80 00    	mov    0x803000,%ebx
+  8025fb:	e8 c8 e8 ff ff       	call   800ec8 <sys_getenvid>
+  802600:	83 ec 04             	sub    $0x4,%esp
+  802603:	ff 75 0c             	push   0xc(%ebp)
+  802606:	ff 75 08             	push   0x8(%ebp)
+  802609:	53                   	push   %ebx
+  80260a:	50                   	push   %eax
+  80260b:	68 84 2b 80 00       	push   $0x802b84
+  802610:	68 00 01 00 00       	push   $0x100
+  802615:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  80261b:	56                   	push   %esi
+  80261c:	e8 bc e0 ff ff       	call   8006dd <snprintf>
+  802621:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  802623:	83 c4 20             	add    $0x20,%esp
+  802626:	57                   	push   %edi
+  802627:	ff 75 10             	push   0x10(%ebp)
+  80262a:	bf 00 01 00 00       	mov    $0x100,%edi
+  80262f:	89 f8                	mov    %edi,%eax
+  802631:	29 d8                	sub    %ebx,%eax
+  802633:	50                   	push   %eax
+  802634:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  802637:	50                   	push   %eax
+  802638:	e8 52 e0 ff ff       	call   80068f <vsnprintf>
+  80263d:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  80263f:	83 c4 0c             	add    $0xc,%esp
+  802642:	68 8c 28 80 00       	push   $0x80288c
+  802647:	29 df                	sub    %ebx,%edi
+  802649:	57                   	push   %edi
+  80264a:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  80264d:	50                   	push   %eax
+  80264e:	e8 8a e0 ff ff       	call   8006dd <snprintf>
+	sys_cputs(buf, r);
+  802653:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  802656:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  802658:	53                   	push   %ebx
+  802659:	56                   	push   %esi
+  80265a:	e8 6b e6 ff ff       	call   800cca <sys_cputs>
+  80265f:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802662:	cc                   	int3
+	while (1)
+  802663:	eb fd                	jmp    802662 <_panic+0x7c>
+
+00802665 <dm>:
+  802665:	55                   	push   %ebp
+  802666:	57                   	push   %edi
+  802667:	56                   	push   %esi
+  802668:	53                   	push   %ebx
+  802669:	83 ec 24             	sub    $0x24,%esp
+  80266c:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802670:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802674:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802678:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80267c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802680:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802684:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802688:	b8 00 00 00 00       	mov    $0x0,%eax
+  80268d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802692:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802697:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80269e:	00 
+  80269f:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8026a6:	00 
+  8026a7:	89 fb                	mov    %edi,%ebx
+  8026a9:	eb 08                	jmp    8026b3 <dm+0x4e>
+  8026ab:	83 e9 01             	sub    $0x1,%ecx
+  8026ae:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8026b1:	74 68                	je     80271b <dm+0xb6>
+  8026b3:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8026b7:	01 c0                	add    %eax,%eax
+  8026b9:	89 c6                	mov    %eax,%esi
+  8026bb:	89 d7                	mov    %edx,%edi
+  8026bd:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8026c1:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026c5:	0f ad d0             	shrd   %cl,%edx,%eax
+  8026c8:	d3 ea                	shr    %cl,%edx
+  8026ca:	f6 c1 20             	test   $0x20,%cl
+  8026cd:	74 04                	je     8026d3 <dm+0x6e>
+  8026cf:	89 d0                	mov    %edx,%eax
+  8026d1:	31 d2                	xor    %edx,%edx
+  8026d3:	83 e0 01             	and    $0x1,%eax
+  8026d6:	89 04 24             	mov    %eax,(%esp)
+  8026d9:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8026e0:	00 
+  8026e1:	8b 04 24             	mov    (%esp),%eax
+  8026e4:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8026e8:	09 f0                	or     %esi,%eax
+  8026ea:	09 fa                	or     %edi,%edx
+  8026ec:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8026f0:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8026f4:	39 f0                	cmp    %esi,%eax
+  8026f6:	89 d5                	mov    %edx,%ebp
+  8026f8:	19 fd                	sbb    %edi,%ebp
+  8026fa:	72 af                	jb     8026ab <dm+0x46>
+  8026fc:	29 f0                	sub    %esi,%eax
+  8026fe:	19 fa                	sbb    %edi,%edx
+  802700:	89 cf                	mov    %ecx,%edi
+  802702:	c1 ef 05             	shr    $0x5,%edi
+  802705:	83 e7 01             	and    $0x1,%edi
+  802708:	89 fe                	mov    %edi,%esi
+  80270a:	83 f6 01             	xor    $0x1,%esi
+  80270d:	d3 e6                	shl    %cl,%esi
+  80270f:	d3 e7                	shl    %cl,%edi
+  802711:	09 74 24 18          	or     %esi,0x18(%esp)
+  802715:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802719:	eb 90                	jmp    8026ab <dm+0x46>
+  80271b:	85 db                	test   %ebx,%ebx
+  80271d:	74 05                	je     802724 <dm+0xbf>
+  80271f:	89 03                	mov    %eax,(%ebx)
+  802721:	89 53 04             	mov    %edx,0x4(%ebx)
+  802724:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802728:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80272c:	83 c4 24             	add    $0x24,%esp
+  80272f:	5b                   	pop    %ebx
+  802730:	5e                   	pop    %esi
+  802731:	5f                   	pop    %edi
+  802732:	5d                   	pop    %ebp
+  802733:	c3                   	ret
+
+00802734 <__udivdi3>:
+  802734:	83 ec 08             	sub    $0x8,%esp
+  802737:	6a 00                	push   $0x0
+  802739:	ff 74 24 1c          	push   0x1c(%esp)
+  80273d:	ff 74 24 1c          	push   0x1c(%esp)
+  802741:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802745:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802749:	e8 17 ff ff ff       	call   802665 <dm>
+  80274e:	83 c4 14             	add    $0x14,%esp
+  802751:	c3                   	ret
+
+00802752 <__umoddi3>:
+  802752:	83 ec 18             	sub    $0x18,%esp
+  802755:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802759:	50                   	push   %eax
+  80275a:	ff 74 24 2c          	push   0x2c(%esp)
+  80275e:	ff 74 24 2c          	push   0x2c(%esp)
+  802762:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802766:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80276a:	e8 f6 fe ff ff       	call   802665 <dm>
+  80276f:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802773:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802777:	83 c4 24             	add    $0x24,%esp
+  80277a:	c3                   	ret
+
+0080277b <__divdi3>:
+  80277b:	53                   	push   %ebx
+  80277c:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802780:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802784:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  802788:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80278c:	85 d2                	test   %edx,%edx
+  80278e:	78 15                	js     8027a5 <__divdi3+0x2a>
+  802790:	85 db                	test   %ebx,%ebx
+  802792:	78 34                	js     8027c8 <__divdi3+0x4d>
+  802794:	83 ec 04             	sub    $0x4,%esp
+  802797:	6a 00                	push   $0x0
+  802799:	53                   	push   %ebx
+  80279a:	51                   	push   %ecx
+  80279b:	e8 c5 fe ff ff       	call   802665 <dm>
+  8027a0:	83 c4 10             	add    $0x10,%esp
+  8027a3:	eb 21                	jmp    8027c6 <__divdi3+0x4b>
+  8027a5:	f7 d8                	neg    %eax
+  8027a7:	83 d2 00             	adc    $0x0,%edx
+  8027aa:	f7 da                	neg    %edx
+  8027ac:	85 db                	test   %ebx,%ebx
+  8027ae:	78 30                	js     8027e0 <__divdi3+0x65>
+  8027b0:	83 ec 04             	sub    $0x4,%esp
+  8027b3:	6a 00                	push   $0x0
+  8027b5:	53                   	push   %ebx
+  8027b6:	51                   	push   %ecx
+  8027b7:	e8 a9 fe ff ff       	call   802665 <dm>
+  8027bc:	83 c4 10             	add    $0x10,%esp
+  8027bf:	f7 d8                	neg    %eax
+  8027c1:	83 d2 00             	adc    $0x0,%edx
+  8027c4:	f7 da                	neg    %edx
+  8027c6:	5b                   	pop    %ebx
+  8027c7:	c3                   	ret
+  8027c8:	83 ec 04             	sub    $0x4,%esp
+  8027cb:	6a 00                	push   $0x0
+  8027cd:	f7 d9                	neg    %ecx
+  8027cf:	83 d3 00             	adc    $0x0,%ebx
+  8027d2:	f7 db                	neg    %ebx
+  8027d4:	53                   	push   %ebx
+  8027d5:	51                   	push   %ecx
+  8027d6:	e8 8a fe ff ff       	call   802665 <dm>
+  8027db:	83 c4 10             	add    $0x10,%esp
+  8027de:	eb df                	jmp    8027bf <__divdi3+0x44>
+  8027e0:	83 ec 04             	sub    $0x4,%esp
+  8027e3:	6a 00                	push   $0x0
+  8027e5:	f7 d9                	neg    %ecx
+  8027e7:	83 d3 00             	adc    $0x0,%ebx
+  8027ea:	f7 db                	neg    %ebx
+  8027ec:	53                   	push   %ebx
+  8027ed:	51                   	push   %ecx
+  8027ee:	e8 72 fe ff ff       	call   802665 <dm>
+  8027f3:	83 c4 10             	add    $0x10,%esp
+  8027f6:	eb ce                	jmp    8027c6 <__divdi3+0x4b>
+
+008027f8 <__moddi3>:
+  8027f8:	55                   	push   %ebp
+  8027f9:	57                   	push   %edi
+  8027fa:	56                   	push   %esi
+  8027fb:	53                   	push   %ebx
+  8027fc:	83 ec 18             	sub    $0x18,%esp
+  8027ff:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802803:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802807:	89 f1                	mov    %esi,%ecx
+  802809:	f7 d9                	neg    %ecx
+  80280b:	89 da                	mov    %ebx,%edx
+  80280d:	83 d2 00             	adc    $0x0,%edx
+  802810:	f7 da                	neg    %edx
+  802812:	0f 48 ce             	cmovs  %esi,%ecx
+  802815:	0f 48 d3             	cmovs  %ebx,%edx
+  802818:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80281c:	50                   	push   %eax
+  80281d:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802821:	f7 de                	neg    %esi
+  802823:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802827:	83 d0 00             	adc    $0x0,%eax
+  80282a:	f7 d8                	neg    %eax
+  80282c:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802831:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802836:	50                   	push   %eax
+  802837:	56                   	push   %esi
+  802838:	89 c8                	mov    %ecx,%eax
+  80283a:	e8 26 fe ff ff       	call   802665 <dm>
+  80283f:	83 c4 10             	add    $0x10,%esp
+  802842:	85 db                	test   %ebx,%ebx
+  802844:	78 10                	js     802856 <__moddi3+0x5e>
+  802846:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80284a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80284e:	83 c4 14             	add    $0x14,%esp
+  802851:	5b                   	pop    %ebx
+  802852:	5e                   	pop    %esi
+  802853:	5f                   	pop    %edi
+  802854:	5d                   	pop    %ebp
+  802855:	c3                   	ret
+  802856:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80285a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80285e:	f7 d8                	neg    %eax
+  802860:	83 d2 00             	adc    $0x0,%edx
+  802863:	f7 da                	neg    %edx
+  802865:	eb e7                	jmp    80284e <__moddi3+0x56>
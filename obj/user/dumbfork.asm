@@ -0,0 +1,5341 @@
+
+obj/user/dumbfork:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 9d 01 00 00       	call   8001ce <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <duppage>:
+	}
+}
+
+void
+duppage(envid_t dstenv, void *addr)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 75 08             	mov    0x8(%ebp),%esi
+  80003b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	// This is NOT what you should do in your fork.
+	if ((r = sys_page_alloc(dstenv, addr, PTE_P|PTE_U|PTE_W)) < 0)
+  80003e:	83 ec 04             	sub    $0x4,%esp
+  800041:	6a 07                	push   $0x7
+  800043:	53                   	push   %ebx
+  800044:	56                   	push   %esi
+  800045:	e8 16 11 00 00       	call   801160 <sys_page_alloc>
+  80004a:	83 c4 10             	add    $0x10,%esp
+  80004d:	85 c0                	test   %eax,%eax
+  80004f:	78 4a                	js     80009b <duppage+0x68>
+		panic("sys_page_alloc: %e", r);
+	if ((r = sys_page_map(dstenv, addr, 0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  800051:	83 ec 0c             	sub    $0xc,%esp
+  800054:	6a 07                	push   $0x7
+  800056:	68 00 00 40 00       	push   $0x400000
+  80005b:	6a 00                	push   $0x0
+  80005d:	53                   	push   %ebx
+  80005e:	56                   	push   %esi
+  80005f:	e8 c2 11 00 00       	call   801226 <sys_page_map>
+  800064:	83 c4 20             	add    $0x20,%esp
+  800067:	85 c0                	test   %eax,%eax
+  800069:	78 42                	js     8000ad <duppage+0x7a>
+		panic("sys_page_map: %e", r);
+	memmove(UTEMP, addr, PGSIZE);
+  80006b:	83 ec 04             	sub    $0x4,%esp
+  80006e:	68 00 10 00 00       	push   $0x1000
+  800073:	53                   	push   %ebx
+  800074:	68 00 00 40 00       	push   $0x400000
+  800079:	e8 33 0a 00 00       	call   800ab1 <memmove>
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  80007e:	83 c4 08             	add    $0x8,%esp
+  800081:	68 00 00 40 00       	push   $0x400000
+  800086:	6a 00                	push   $0x0
+  800088:	e8 5d 12 00 00       	call   8012ea <sys_page_unmap>
+  80008d:	83 c4 10             	add    $0x10,%esp
+  800090:	85 c0                	test   %eax,%eax
+  800092:	78 2b                	js     8000bf <duppage+0x8c>
+		panic("sys_page_unmap: %e", r);
+}
+  800094:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800097:	5b                   	pop    %ebx
+  800098:	5e                   	pop    %esi
+  800099:	5d                   	pop    %ebp
+  80009a:	c3                   	ret
+		panic("sys_page_alloc: %e", r);
+  80009b:	50                   	push   %eax
+  80009c:	68 00 2a 80 00       	push   $0x802a00
+  8000a1:	6a 20                	push   $0x20
+  8000a3:	68 13 2a 80 00       	push   $0x802a13
+  8000a8:	e8 7c 01 00 00       	call   800229 <_panic>
+		panic("sys_page_map: %e", r);
+  8000ad:	50                   	push   %eax
+  8000ae:	68 23 2a 80 00       	push   $0x802a23
+  8000b3:	6a 22                	push   $0x22
+  8000b5:	68 13 2a 80 00       	push   $0x802a13
+  8000ba:	e8 6a 01 00 00       	call   800229 <_panic>
+		panic("sys_page_unmap: %e", r);
+  8000bf:	50                   	push   %eax
+  8000c0:	68 34 2a 80 00       	push   $0x802a34
+  8000c5:	6a 25                	push   $0x25
+  8000c7:	68 13 2a 80 00       	push   $0x802a13
+  8000cc:	e8 58 01 00 00       	call   800229 <_panic>
+
+008000d1 <dumbfork>:
+
+envid_t
+dumbfork(void)
+{
+  8000d1:	55                   	push   %ebp
+  8000d2:	89 e5                	mov    %esp,%ebp
+  8000d4:	53                   	push   %ebx
+  8000d5:	83 ec 14             	sub    $0x14,%esp
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8000d8:	b8 07 00 00 00       	mov    $0x7,%eax
+  8000dd:	cd 30                	int    $0x30
+  8000df:	89 c3                	mov    %eax,%ebx
+	// The kernel will initialize it with a copy of our register state,
+	// so that the child will appear to have called sys_exofork() too -
+	// except that in the child, this "fake" call to sys_exofork()
+	// will return 0 instead of the envid of the child.
+	envid = sys_exofork();
+	if (envid < 0)
+  8000e1:	85 c0                	test   %eax,%eax
+  8000e3:	78 23                	js     800108 <dumbfork+0x37>
+		panic("sys_exofork: %e", envid);
+	if (envid == 0) {
+  8000e5:	ba 00 00 80 00       	mov    $0x800000,%edx
+  8000ea:	75 44                	jne    800130 <dumbfork+0x5f>
+		// We're the child.
+		// The copied value of the global variable 'thisenv'
+		// is no longer valid (it refers to the parent!).
+		// Fix it and return 0.
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8000ec:	e8 d0 0f 00 00       	call   8010c1 <sys_getenvid>
+  8000f1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000f6:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  8000fc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800101:	a3 08 30 80 00       	mov    %eax,0x803008
+		return 0;
+  800106:	eb 57                	jmp    80015f <dumbfork+0x8e>
+		panic("sys_exofork: %e", envid);
+  800108:	50                   	push   %eax
+  800109:	68 47 2a 80 00       	push   $0x802a47
+  80010e:	6a 37                	push   $0x37
+  800110:	68 13 2a 80 00       	push   $0x802a13
+  800115:	e8 0f 01 00 00       	call   800229 <_panic>
+
+	// We're the parent.
+	// Eagerly copy our entire address space into the child.
+	// This is NOT what you should do in your fork implementation.
+	for (addr = (uint8_t*) UTEXT; addr < end; addr += PGSIZE)
+		duppage(envid, addr);
+  80011a:	83 ec 08             	sub    $0x8,%esp
+  80011d:	52                   	push   %edx
+  80011e:	53                   	push   %ebx
+  80011f:	e8 0f ff ff ff       	call   800033 <duppage>
+	for (addr = (uint8_t*) UTEXT; addr < end; addr += PGSIZE)
+  800124:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800127:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80012d:	83 c4 10             	add    $0x10,%esp
+  800130:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  800133:	81 fa 0c 30 80 00    	cmp    $0x80300c,%edx
+  800139:	72 df                	jb     80011a <dumbfork+0x49>
+
+	// Also copy the stack we are currently running on.
+	duppage(envid, ROUNDDOWN(&addr, PGSIZE));
+  80013b:	83 ec 08             	sub    $0x8,%esp
+  80013e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800141:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800146:	50                   	push   %eax
+  800147:	53                   	push   %ebx
+  800148:	e8 e6 fe ff ff       	call   800033 <duppage>
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  80014d:	83 c4 08             	add    $0x8,%esp
+  800150:	6a 02                	push   $0x2
+  800152:	53                   	push   %ebx
+  800153:	e8 b9 13 00 00       	call   801511 <sys_env_set_status>
+  800158:	83 c4 10             	add    $0x10,%esp
+  80015b:	85 c0                	test   %eax,%eax
+  80015d:	78 07                	js     800166 <dumbfork+0x95>
+		panic("sys_env_set_status: %e", r);
+
+	return envid;
+}
+  80015f:	89 d8                	mov    %ebx,%eax
+  800161:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800164:	c9                   	leave
+  800165:	c3                   	ret
+		panic("sys_env_set_status: %e", r);
+  800166:	50                   	push   %eax
+  800167:	68 57 2a 80 00       	push   $0x802a57
+  80016c:	6a 4c                	push   $0x4c
+  80016e:	68 13 2a 80 00       	push   $0x802a13
+  800173:	e8 b1 00 00 00       	call   800229 <_panic>
+
+00800178 <umain>:
+{
+  800178:	55                   	push   %ebp
+  800179:	89 e5                	mov    %esp,%ebp
+  80017b:	57                   	push   %edi
+  80017c:	56                   	push   %esi
+  80017d:	53                   	push   %ebx
+  80017e:	83 ec 0c             	sub    $0xc,%esp
+	who = dumbfork();
+  800181:	e8 4b ff ff ff       	call   8000d1 <dumbfork>
+  800186:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < (who ? 10 : 20); i++) {
+  800188:	85 c0                	test   %eax,%eax
+  80018a:	bf 6e 2a 80 00       	mov    $0x802a6e,%edi
+  80018f:	b8 75 2a 80 00       	mov    $0x802a75,%eax
+  800194:	0f 44 f8             	cmove  %eax,%edi
+  800197:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80019c:	eb 1f                	jmp    8001bd <umain+0x45>
+  80019e:	83 fb 13             	cmp    $0x13,%ebx
+  8001a1:	7f 23                	jg     8001c6 <umain+0x4e>
+		cprintf("%d: I am the %s!\n", i, who ? "parent" : "child");
+  8001a3:	83 ec 04             	sub    $0x4,%esp
+  8001a6:	57                   	push   %edi
+  8001a7:	53                   	push   %ebx
+  8001a8:	68 7b 2a 80 00       	push   $0x802a7b
+  8001ad:	e8 8b 01 00 00       	call   80033d <cprintf>
+		sys_yield();
+  8001b2:	e8 bb 12 00 00       	call   801472 <sys_yield>
+	for (i = 0; i < (who ? 10 : 20); i++) {
+  8001b7:	83 c3 01             	add    $0x1,%ebx
+  8001ba:	83 c4 10             	add    $0x10,%esp
+  8001bd:	85 f6                	test   %esi,%esi
+  8001bf:	74 dd                	je     80019e <umain+0x26>
+  8001c1:	83 fb 09             	cmp    $0x9,%ebx
+  8001c4:	7e dd                	jle    8001a3 <umain+0x2b>
+}
+  8001c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001c9:	5b                   	pop    %ebx
+  8001ca:	5e                   	pop    %esi
+  8001cb:	5f                   	pop    %edi
+  8001cc:	5d                   	pop    %ebp
+  8001cd:	c3                   	ret
+
+008001ce <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001ce:	55                   	push   %ebp
+  8001cf:	89 e5                	mov    %esp,%ebp
+  8001d1:	56                   	push   %esi
+  8001d2:	53                   	push   %ebx
+  8001d3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001d6:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  8001d9:	e8 e3 0e 00 00       	call   8010c1 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  8001de:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001e3:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  8001e9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001ee:	a3 08 30 80 00       	mov    %eax,0x803008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001f3:	85 db                	test   %ebx,%ebx
+  8001f5:	7e 07                	jle    8001fe <libmain+0x30>
+		binaryname = argv[0];
+  8001f7:	8b 06                	mov    (%esi),%eax
+  8001f9:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  8001fe:	83 ec 08             	sub    $0x8,%esp
+  800201:	56                   	push   %esi
+  800202:	53                   	push   %ebx
+  800203:	e8 70 ff ff ff       	call   800178 <umain>
+
+	// exit gracefully
+	exit();
+  800208:	e8 0a 00 00 00       	call   800217 <exit>
+}
+  80020d:	83 c4 10             	add    $0x10,%esp
+  800210:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800213:	5b                   	pop    %ebx
+  800214:	5e                   	pop    %esi
+  800215:	5d                   	pop    %ebp
+  800216:	c3                   	ret
+
+00800217 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800217:	55                   	push   %ebp
+  800218:	89 e5                	mov    %esp,%ebp
+  80021a:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  80021d:	6a 00                	push   $0x0
+  80021f:	e8 db 0d 00 00       	call   800fff <sys_env_destroy>
+}
+  800224:	83 c4 10             	add    $0x10,%esp
+  800227:	c9                   	leave
+  800228:	c3                   	ret
+
+00800229 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800229:	55                   	push   %ebp
+  80022a:	89 e5                	mov    %esp,%ebp
+  80022c:	57                   	push   %edi
+  80022d:	56                   	push   %esi
+  80022e:	53                   	push   %ebx
+  80022f:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  800235:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  800238:	8b 1d 00 30 80 00    	mov    0x803000,%ebx
+  80023e:	e8 7e 0e 00 00       	call   8010c1 <sys_getenvid>
+  800243:	83 ec 04             	sub    $0x4,%esp
+  800246:	ff 75 0c             	push   0xc(%ebp)
+  800249:	ff 75 08             	push   0x8(%ebp)
+  80024c:	53                   	push   %ebx
+  80024d:	50                   	push   %eax
+  80024e:	68 98 2a 80 00       	push   $0x802a98
+  800253:	68 00 01 00 00       	push   $0x100
+  800258:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  80025e:	56                   	push   %esi
+  80025f:	e8 72 06 00 00       	call   8008d6 <snprintf>
+  800264:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  800266:	83 c4 20             	add    $0x20,%esp
+  800269:	57                   	push   %edi
+  80026a:	ff 75 10             	push   0x10(%ebp)
+  80026d:	bf 00 01 00 00       	mov    $0x100,%edi
+  800272:	89 f8                	mov    %edi,%eax
+  800274:	29 d8                	sub    %ebx,%eax
+  800276:	50                   	push   %eax
+  800277:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  80027a:	50                   	push   %eax
+  80027b:	e8 08 06 00 00       	call   800888 <vsnprintf>
+  800280:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  800282:	83 c4 0c             	add    $0xc,%esp
+  800285:	68 8b 2a 80 00       	push   $0x802a8b
+  80028a:	29 df                	sub    %ebx,%edi
+  80028c:	57                   	push   %edi
+  80028d:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  800290:	50                   	push   %eax
+  800291:	e8 40 06 00 00       	call   8008d6 <snprintf>
+	sys_cputs(buf, r);
+  800296:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  800299:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  80029b:	53                   	push   %ebx
+  80029c:	56                   	push   %esi
+  80029d:	e8 21 0c 00 00       	call   800ec3 <sys_cputs>
+  8002a2:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002a5:	cc                   	int3
+	while (1)
+  8002a6:	eb fd                	jmp    8002a5 <_panic+0x7c>
+
+008002a8 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002a8:	55                   	push   %ebp
+  8002a9:	89 e5                	mov    %esp,%ebp
+  8002ab:	53                   	push   %ebx
+  8002ac:	83 ec 04             	sub    $0x4,%esp
+  8002af:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8002b2:	8b 13                	mov    (%ebx),%edx
+  8002b4:	8d 42 01             	lea    0x1(%edx),%eax
+  8002b7:	89 03                	mov    %eax,(%ebx)
+  8002b9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002bc:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8002c0:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002c5:	74 09                	je     8002d0 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002c7:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002ce:	c9                   	leave
+  8002cf:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002d0:	83 ec 08             	sub    $0x8,%esp
+  8002d3:	68 ff 00 00 00       	push   $0xff
+  8002d8:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002db:	50                   	push   %eax
+  8002dc:	e8 e2 0b 00 00       	call   800ec3 <sys_cputs>
+		b->idx = 0;
+  8002e1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002e7:	83 c4 10             	add    $0x10,%esp
+  8002ea:	eb db                	jmp    8002c7 <putch+0x1f>
+
+008002ec <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002ec:	55                   	push   %ebp
+  8002ed:	89 e5                	mov    %esp,%ebp
+  8002ef:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002f5:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002fc:	00 00 00 
+	b.cnt = 0;
+  8002ff:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800306:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800309:	ff 75 0c             	push   0xc(%ebp)
+  80030c:	ff 75 08             	push   0x8(%ebp)
+  80030f:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800315:	50                   	push   %eax
+  800316:	68 a8 02 80 00       	push   $0x8002a8
+  80031b:	e8 14 01 00 00       	call   800434 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800320:	83 c4 08             	add    $0x8,%esp
+  800323:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800329:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80032f:	50                   	push   %eax
+  800330:	e8 8e 0b 00 00       	call   800ec3 <sys_cputs>
+
+	return b.cnt;
+}
+  800335:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80033b:	c9                   	leave
+  80033c:	c3                   	ret
+
+0080033d <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80033d:	55                   	push   %ebp
+  80033e:	89 e5                	mov    %esp,%ebp
+  800340:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800343:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800346:	50                   	push   %eax
+  800347:	ff 75 08             	push   0x8(%ebp)
+  80034a:	e8 9d ff ff ff       	call   8002ec <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80034f:	c9                   	leave
+  800350:	c3                   	ret
+
+00800351 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800351:	55                   	push   %ebp
+  800352:	89 e5                	mov    %esp,%ebp
+  800354:	57                   	push   %edi
+  800355:	56                   	push   %esi
+  800356:	53                   	push   %ebx
+  800357:	83 ec 1c             	sub    $0x1c,%esp
+  80035a:	89 c7                	mov    %eax,%edi
+  80035c:	89 d6                	mov    %edx,%esi
+  80035e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800361:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800364:	89 d1                	mov    %edx,%ecx
+  800366:	89 c2                	mov    %eax,%edx
+  800368:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80036b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80036e:	8b 45 10             	mov    0x10(%ebp),%eax
+  800371:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800374:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800377:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80037e:	39 c2                	cmp    %eax,%edx
+  800380:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800383:	72 3e                	jb     8003c3 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800385:	83 ec 0c             	sub    $0xc,%esp
+  800388:	ff 75 18             	push   0x18(%ebp)
+  80038b:	83 eb 01             	sub    $0x1,%ebx
+  80038e:	53                   	push   %ebx
+  80038f:	50                   	push   %eax
+  800390:	83 ec 08             	sub    $0x8,%esp
+  800393:	ff 75 e4             	push   -0x1c(%ebp)
+  800396:	ff 75 e0             	push   -0x20(%ebp)
+  800399:	ff 75 dc             	push   -0x24(%ebp)
+  80039c:	ff 75 d8             	push   -0x28(%ebp)
+  80039f:	e8 0a 25 00 00       	call   8028ae <__udivdi3>
+  8003a4:	83 c4 18             	add    $0x18,%esp
+  8003a7:	52                   	push   %edx
+  8003a8:	50                   	push   %eax
+  8003a9:	89 f2                	mov    %esi,%edx
+  8003ab:	89 f8                	mov    %edi,%eax
+  8003ad:	e8 9f ff ff ff       	call   800351 <printnum>
+  8003b2:	83 c4 20             	add    $0x20,%esp
+  8003b5:	eb 13                	jmp    8003ca <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8003b7:	83 ec 08             	sub    $0x8,%esp
+  8003ba:	56                   	push   %esi
+  8003bb:	ff 75 18             	push   0x18(%ebp)
+  8003be:	ff d7                	call   *%edi
+  8003c0:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8003c3:	83 eb 01             	sub    $0x1,%ebx
+  8003c6:	85 db                	test   %ebx,%ebx
+  8003c8:	7f ed                	jg     8003b7 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8003ca:	83 ec 08             	sub    $0x8,%esp
+  8003cd:	56                   	push   %esi
+  8003ce:	83 ec 04             	sub    $0x4,%esp
+  8003d1:	ff 75 e4             	push   -0x1c(%ebp)
+  8003d4:	ff 75 e0             	push   -0x20(%ebp)
+  8003d7:	ff 75 dc             	push   -0x24(%ebp)
+  8003da:	ff 75 d8             	push   -0x28(%ebp)
+  8003dd:	e8 ea 24 00 00       	call   8028cc <__umoddi3>
+  8003e2:	83 c4 14             	add    $0x14,%esp
+  8003e5:	0f be 80 bb 2a 80 00 	movsbl 0x802abb(%eax),%eax
+  8003ec:	50                   	push   %eax
+  8003ed:	ff d7                	call   *%edi
+}
+  8003ef:	83 c4 10             	add    $0x10,%esp
+  8003f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003f5:	5b                   	pop    %ebx
+  8003f6:	5e                   	pop    %esi
+  8003f7:	5f                   	pop    %edi
+  8003f8:	5d                   	pop    %ebp
+  8003f9:	c3                   	ret
+
+008003fa <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003fa:	55                   	push   %ebp
+  8003fb:	89 e5                	mov    %esp,%ebp
+  8003fd:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800400:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800404:	8b 10                	mov    (%eax),%edx
+  800406:	3b 50 04             	cmp    0x4(%eax),%edx
+  800409:	73 0a                	jae    800415 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80040b:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80040e:	89 08                	mov    %ecx,(%eax)
+  800410:	8b 45 08             	mov    0x8(%ebp),%eax
+  800413:	88 02                	mov    %al,(%edx)
+}
+  800415:	5d                   	pop    %ebp
+  800416:	c3                   	ret
+
+00800417 <printfmt>:
+{
+  800417:	55                   	push   %ebp
+  800418:	89 e5                	mov    %esp,%ebp
+  80041a:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80041d:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800420:	50                   	push   %eax
+  800421:	ff 75 10             	push   0x10(%ebp)
+  800424:	ff 75 0c             	push   0xc(%ebp)
+  800427:	ff 75 08             	push   0x8(%ebp)
+  80042a:	e8 05 00 00 00       	call   800434 <vprintfmt>
+}
+  80042f:	83 c4 10             	add    $0x10,%esp
+  800432:	c9                   	leave
+  800433:	c3                   	ret
+
+00800434 <vprintfmt>:
+{
+  800434:	55                   	push   %ebp
+  800435:	89 e5                	mov    %esp,%ebp
+  800437:	57                   	push   %edi
+  800438:	56                   	push   %esi
+  800439:	53                   	push   %ebx
+  80043a:	83 ec 2c             	sub    $0x2c,%esp
+  80043d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800440:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800443:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800446:	eb 0a                	jmp    800452 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800448:	83 ec 08             	sub    $0x8,%esp
+  80044b:	53                   	push   %ebx
+  80044c:	50                   	push   %eax
+  80044d:	ff d6                	call   *%esi
+  80044f:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800452:	83 c7 01             	add    $0x1,%edi
+  800455:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800459:	83 f8 25             	cmp    $0x25,%eax
+  80045c:	74 0c                	je     80046a <vprintfmt+0x36>
+			if (ch == '\0')
+  80045e:	85 c0                	test   %eax,%eax
+  800460:	75 e6                	jne    800448 <vprintfmt+0x14>
+}
+  800462:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800465:	5b                   	pop    %ebx
+  800466:	5e                   	pop    %esi
+  800467:	5f                   	pop    %edi
+  800468:	5d                   	pop    %ebp
+  800469:	c3                   	ret
+		padc = ' ';
+  80046a:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80046e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800475:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80047c:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800483:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800488:	8d 47 01             	lea    0x1(%edi),%eax
+  80048b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80048e:	0f b6 17             	movzbl (%edi),%edx
+  800491:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800494:	3c 55                	cmp    $0x55,%al
+  800496:	0f 87 cf 03 00 00    	ja     80086b <vprintfmt+0x437>
+  80049c:	0f b6 c0             	movzbl %al,%eax
+  80049f:	ff 24 85 a0 2b 80 00 	jmp    *0x802ba0(,%eax,4)
+  8004a6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8004a9:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8004ad:	eb d9                	jmp    800488 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004af:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8004b2:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8004b6:	eb d0                	jmp    800488 <vprintfmt+0x54>
+  8004b8:	0f b6 d2             	movzbl %dl,%edx
+  8004bb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8004be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c3:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8004c6:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8004c9:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8004cd:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8004d0:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8004d3:	83 f9 09             	cmp    $0x9,%ecx
+  8004d6:	77 55                	ja     80052d <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8004d8:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8004db:	eb e9                	jmp    8004c6 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8004dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e0:	8b 00                	mov    (%eax),%eax
+  8004e2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e8:	8d 40 04             	lea    0x4(%eax),%eax
+  8004eb:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ee:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8004f1:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004f5:	79 91                	jns    800488 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8004f7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004fa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004fd:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800504:	eb 82                	jmp    800488 <vprintfmt+0x54>
+			if (width < 0)
+  800506:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800509:	85 d2                	test   %edx,%edx
+  80050b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800510:	0f 49 c2             	cmovns %edx,%eax
+  800513:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800516:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800519:	e9 6a ff ff ff       	jmp    800488 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80051e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800521:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800528:	e9 5b ff ff ff       	jmp    800488 <vprintfmt+0x54>
+  80052d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800530:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800533:	eb bc                	jmp    8004f1 <vprintfmt+0xbd>
+			lflag++;
+  800535:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800538:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80053b:	e9 48 ff ff ff       	jmp    800488 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800540:	8b 45 14             	mov    0x14(%ebp),%eax
+  800543:	8d 78 04             	lea    0x4(%eax),%edi
+  800546:	83 ec 08             	sub    $0x8,%esp
+  800549:	53                   	push   %ebx
+  80054a:	ff 30                	push   (%eax)
+  80054c:	ff d6                	call   *%esi
+			break;
+  80054e:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800551:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800554:	e9 b1 02 00 00       	jmp    80080a <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800559:	8b 45 14             	mov    0x14(%ebp),%eax
+  80055c:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80055f:	8b 10                	mov    (%eax),%edx
+  800561:	89 d0                	mov    %edx,%eax
+  800563:	f7 d8                	neg    %eax
+  800565:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800568:	83 f8 0d             	cmp    $0xd,%eax
+  80056b:	7f 23                	jg     800590 <vprintfmt+0x15c>
+  80056d:	8b 14 85 00 2d 80 00 	mov    0x802d00(,%eax,4),%edx
+  800574:	85 d2                	test   %edx,%edx
+  800576:	74 18                	je     800590 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800578:	52                   	push   %edx
+  800579:	68 dc 2a 80 00       	push   $0x802adc
+  80057e:	53                   	push   %ebx
+  80057f:	56                   	push   %esi
+  800580:	e8 92 fe ff ff       	call   800417 <printfmt>
+  800585:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800588:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80058b:	e9 7a 02 00 00       	jmp    80080a <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800590:	50                   	push   %eax
+  800591:	68 d3 2a 80 00       	push   $0x802ad3
+  800596:	53                   	push   %ebx
+  800597:	56                   	push   %esi
+  800598:	e8 7a fe ff ff       	call   800417 <printfmt>
+  80059d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005a0:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8005a3:	e9 62 02 00 00       	jmp    80080a <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ab:	83 c0 04             	add    $0x4,%eax
+  8005ae:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8005b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b4:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8005b6:	85 c9                	test   %ecx,%ecx
+  8005b8:	b8 cc 2a 80 00       	mov    $0x802acc,%eax
+  8005bd:	0f 45 c1             	cmovne %ecx,%eax
+  8005c0:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8005c3:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005c7:	7e 06                	jle    8005cf <vprintfmt+0x19b>
+  8005c9:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8005cd:	75 0b                	jne    8005da <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005cf:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8005d2:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005d5:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005d8:	eb 5c                	jmp    800636 <vprintfmt+0x202>
+  8005da:	83 ec 08             	sub    $0x8,%esp
+  8005dd:	ff 75 d0             	push   -0x30(%ebp)
+  8005e0:	ff 75 cc             	push   -0x34(%ebp)
+  8005e3:	e8 20 03 00 00       	call   800908 <strnlen>
+  8005e8:	89 c2                	mov    %eax,%edx
+  8005ea:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005ed:	29 d0                	sub    %edx,%eax
+  8005ef:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005f2:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005f6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005f9:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005fc:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005fe:	eb 0e                	jmp    80060e <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800600:	83 ec 08             	sub    $0x8,%esp
+  800603:	53                   	push   %ebx
+  800604:	57                   	push   %edi
+  800605:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800608:	83 ee 01             	sub    $0x1,%esi
+  80060b:	83 c4 10             	add    $0x10,%esp
+  80060e:	85 f6                	test   %esi,%esi
+  800610:	7f ee                	jg     800600 <vprintfmt+0x1cc>
+  800612:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800615:	8b 75 08             	mov    0x8(%ebp),%esi
+  800618:	85 c0                	test   %eax,%eax
+  80061a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80061f:	0f 49 d0             	cmovns %eax,%edx
+  800622:	29 d0                	sub    %edx,%eax
+  800624:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800627:	eb a6                	jmp    8005cf <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800629:	83 ec 08             	sub    $0x8,%esp
+  80062c:	53                   	push   %ebx
+  80062d:	52                   	push   %edx
+  80062e:	ff 55 08             	call   *0x8(%ebp)
+  800631:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800634:	89 f1                	mov    %esi,%ecx
+  800636:	8d 71 01             	lea    0x1(%ecx),%esi
+  800639:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80063d:	0f be d0             	movsbl %al,%edx
+  800640:	85 d2                	test   %edx,%edx
+  800642:	74 28                	je     80066c <vprintfmt+0x238>
+  800644:	85 ff                	test   %edi,%edi
+  800646:	78 05                	js     80064d <vprintfmt+0x219>
+  800648:	83 ef 01             	sub    $0x1,%edi
+  80064b:	78 30                	js     80067d <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80064d:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800651:	74 d6                	je     800629 <vprintfmt+0x1f5>
+  800653:	0f be c0             	movsbl %al,%eax
+  800656:	83 e8 20             	sub    $0x20,%eax
+  800659:	83 f8 5e             	cmp    $0x5e,%eax
+  80065c:	76 cb                	jbe    800629 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80065e:	83 ec 08             	sub    $0x8,%esp
+  800661:	53                   	push   %ebx
+  800662:	6a 3f                	push   $0x3f
+  800664:	ff 55 08             	call   *0x8(%ebp)
+  800667:	83 c4 10             	add    $0x10,%esp
+  80066a:	eb c8                	jmp    800634 <vprintfmt+0x200>
+  80066c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80066f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800672:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800675:	01 d0                	add    %edx,%eax
+  800677:	29 c8                	sub    %ecx,%eax
+  800679:	89 c7                	mov    %eax,%edi
+  80067b:	eb 13                	jmp    800690 <vprintfmt+0x25c>
+  80067d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800680:	eb ed                	jmp    80066f <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800682:	83 ec 08             	sub    $0x8,%esp
+  800685:	53                   	push   %ebx
+  800686:	6a 20                	push   $0x20
+  800688:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80068a:	83 ef 01             	sub    $0x1,%edi
+  80068d:	83 c4 10             	add    $0x10,%esp
+  800690:	85 ff                	test   %edi,%edi
+  800692:	7f ee                	jg     800682 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800694:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800697:	89 45 14             	mov    %eax,0x14(%ebp)
+  80069a:	e9 6b 01 00 00       	jmp    80080a <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80069f:	83 f9 01             	cmp    $0x1,%ecx
+  8006a2:	7f 1f                	jg     8006c3 <vprintfmt+0x28f>
+	else if (lflag)
+  8006a4:	85 c9                	test   %ecx,%ecx
+  8006a6:	74 67                	je     80070f <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8006a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ab:	8b 00                	mov    (%eax),%eax
+  8006ad:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006b0:	89 c1                	mov    %eax,%ecx
+  8006b2:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006b5:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bb:	8d 40 04             	lea    0x4(%eax),%eax
+  8006be:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006c1:	eb 17                	jmp    8006da <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8006c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c6:	8b 50 04             	mov    0x4(%eax),%edx
+  8006c9:	8b 00                	mov    (%eax),%eax
+  8006cb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006ce:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d4:	8d 40 08             	lea    0x8(%eax),%eax
+  8006d7:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006da:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006dd:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8006e0:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8006e5:	85 c9                	test   %ecx,%ecx
+  8006e7:	0f 89 03 01 00 00    	jns    8007f0 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8006ed:	83 ec 08             	sub    $0x8,%esp
+  8006f0:	53                   	push   %ebx
+  8006f1:	6a 2d                	push   $0x2d
+  8006f3:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8006f5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006f8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006fb:	f7 da                	neg    %edx
+  8006fd:	83 d1 00             	adc    $0x0,%ecx
+  800700:	f7 d9                	neg    %ecx
+  800702:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800705:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80070a:	e9 e1 00 00 00       	jmp    8007f0 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80070f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800712:	8b 00                	mov    (%eax),%eax
+  800714:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800717:	89 c1                	mov    %eax,%ecx
+  800719:	c1 f9 1f             	sar    $0x1f,%ecx
+  80071c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80071f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800722:	8d 40 04             	lea    0x4(%eax),%eax
+  800725:	89 45 14             	mov    %eax,0x14(%ebp)
+  800728:	eb b0                	jmp    8006da <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80072a:	83 f9 01             	cmp    $0x1,%ecx
+  80072d:	7f 1e                	jg     80074d <vprintfmt+0x319>
+	else if (lflag)
+  80072f:	85 c9                	test   %ecx,%ecx
+  800731:	74 32                	je     800765 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800733:	8b 45 14             	mov    0x14(%ebp),%eax
+  800736:	8b 10                	mov    (%eax),%edx
+  800738:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80073d:	8d 40 04             	lea    0x4(%eax),%eax
+  800740:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800743:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800748:	e9 a3 00 00 00       	jmp    8007f0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80074d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800750:	8b 10                	mov    (%eax),%edx
+  800752:	8b 48 04             	mov    0x4(%eax),%ecx
+  800755:	8d 40 08             	lea    0x8(%eax),%eax
+  800758:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80075b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800760:	e9 8b 00 00 00       	jmp    8007f0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800765:	8b 45 14             	mov    0x14(%ebp),%eax
+  800768:	8b 10                	mov    (%eax),%edx
+  80076a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80076f:	8d 40 04             	lea    0x4(%eax),%eax
+  800772:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800775:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80077a:	eb 74                	jmp    8007f0 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  80077c:	83 f9 01             	cmp    $0x1,%ecx
+  80077f:	7f 1b                	jg     80079c <vprintfmt+0x368>
+	else if (lflag)
+  800781:	85 c9                	test   %ecx,%ecx
+  800783:	74 2c                	je     8007b1 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800785:	8b 45 14             	mov    0x14(%ebp),%eax
+  800788:	8b 10                	mov    (%eax),%edx
+  80078a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80078f:	8d 40 04             	lea    0x4(%eax),%eax
+  800792:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800795:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80079a:	eb 54                	jmp    8007f0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80079c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079f:	8b 10                	mov    (%eax),%edx
+  8007a1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007a4:	8d 40 08             	lea    0x8(%eax),%eax
+  8007a7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007aa:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8007af:	eb 3f                	jmp    8007f0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8007b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b4:	8b 10                	mov    (%eax),%edx
+  8007b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007bb:	8d 40 04             	lea    0x4(%eax),%eax
+  8007be:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007c1:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8007c6:	eb 28                	jmp    8007f0 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8007c8:	83 ec 08             	sub    $0x8,%esp
+  8007cb:	53                   	push   %ebx
+  8007cc:	6a 30                	push   $0x30
+  8007ce:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8007d0:	83 c4 08             	add    $0x8,%esp
+  8007d3:	53                   	push   %ebx
+  8007d4:	6a 78                	push   $0x78
+  8007d6:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8007d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007db:	8b 10                	mov    (%eax),%edx
+  8007dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007e2:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007e5:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007eb:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8007f0:	83 ec 0c             	sub    $0xc,%esp
+  8007f3:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8007f7:	50                   	push   %eax
+  8007f8:	ff 75 e0             	push   -0x20(%ebp)
+  8007fb:	57                   	push   %edi
+  8007fc:	51                   	push   %ecx
+  8007fd:	52                   	push   %edx
+  8007fe:	89 da                	mov    %ebx,%edx
+  800800:	89 f0                	mov    %esi,%eax
+  800802:	e8 4a fb ff ff       	call   800351 <printnum>
+			break;
+  800807:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80080a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80080d:	e9 40 fc ff ff       	jmp    800452 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800812:	83 f9 01             	cmp    $0x1,%ecx
+  800815:	7f 1b                	jg     800832 <vprintfmt+0x3fe>
+	else if (lflag)
+  800817:	85 c9                	test   %ecx,%ecx
+  800819:	74 2c                	je     800847 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  80081b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081e:	8b 10                	mov    (%eax),%edx
+  800820:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800825:	8d 40 04             	lea    0x4(%eax),%eax
+  800828:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80082b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800830:	eb be                	jmp    8007f0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800832:	8b 45 14             	mov    0x14(%ebp),%eax
+  800835:	8b 10                	mov    (%eax),%edx
+  800837:	8b 48 04             	mov    0x4(%eax),%ecx
+  80083a:	8d 40 08             	lea    0x8(%eax),%eax
+  80083d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800840:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800845:	eb a9                	jmp    8007f0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800847:	8b 45 14             	mov    0x14(%ebp),%eax
+  80084a:	8b 10                	mov    (%eax),%edx
+  80084c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800851:	8d 40 04             	lea    0x4(%eax),%eax
+  800854:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800857:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80085c:	eb 92                	jmp    8007f0 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  80085e:	83 ec 08             	sub    $0x8,%esp
+  800861:	53                   	push   %ebx
+  800862:	6a 25                	push   $0x25
+  800864:	ff d6                	call   *%esi
+			break;
+  800866:	83 c4 10             	add    $0x10,%esp
+  800869:	eb 9f                	jmp    80080a <vprintfmt+0x3d6>
+			putch('%', putdat);
+  80086b:	83 ec 08             	sub    $0x8,%esp
+  80086e:	53                   	push   %ebx
+  80086f:	6a 25                	push   $0x25
+  800871:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800873:	83 c4 10             	add    $0x10,%esp
+  800876:	89 f8                	mov    %edi,%eax
+  800878:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80087c:	74 05                	je     800883 <vprintfmt+0x44f>
+  80087e:	83 e8 01             	sub    $0x1,%eax
+  800881:	eb f5                	jmp    800878 <vprintfmt+0x444>
+  800883:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800886:	eb 82                	jmp    80080a <vprintfmt+0x3d6>
+
+00800888 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800888:	55                   	push   %ebp
+  800889:	89 e5                	mov    %esp,%ebp
+  80088b:	83 ec 18             	sub    $0x18,%esp
+  80088e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800891:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800894:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800897:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80089b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80089e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8008a5:	85 c0                	test   %eax,%eax
+  8008a7:	74 26                	je     8008cf <vsnprintf+0x47>
+  8008a9:	85 d2                	test   %edx,%edx
+  8008ab:	7e 22                	jle    8008cf <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008ad:	ff 75 14             	push   0x14(%ebp)
+  8008b0:	ff 75 10             	push   0x10(%ebp)
+  8008b3:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008b6:	50                   	push   %eax
+  8008b7:	68 fa 03 80 00       	push   $0x8003fa
+  8008bc:	e8 73 fb ff ff       	call   800434 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008c1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008c4:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008ca:	83 c4 10             	add    $0x10,%esp
+}
+  8008cd:	c9                   	leave
+  8008ce:	c3                   	ret
+		return -E_INVAL;
+  8008cf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008d4:	eb f7                	jmp    8008cd <vsnprintf+0x45>
+
+008008d6 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008d6:	55                   	push   %ebp
+  8008d7:	89 e5                	mov    %esp,%ebp
+  8008d9:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8008dc:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008df:	50                   	push   %eax
+  8008e0:	ff 75 10             	push   0x10(%ebp)
+  8008e3:	ff 75 0c             	push   0xc(%ebp)
+  8008e6:	ff 75 08             	push   0x8(%ebp)
+  8008e9:	e8 9a ff ff ff       	call   800888 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008ee:	c9                   	leave
+  8008ef:	c3                   	ret
+
+008008f0 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008f0:	55                   	push   %ebp
+  8008f1:	89 e5                	mov    %esp,%ebp
+  8008f3:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008fb:	eb 03                	jmp    800900 <strlen+0x10>
+		n++;
+  8008fd:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800900:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800904:	75 f7                	jne    8008fd <strlen+0xd>
+	return n;
+}
+  800906:	5d                   	pop    %ebp
+  800907:	c3                   	ret
+
+00800908 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800908:	55                   	push   %ebp
+  800909:	89 e5                	mov    %esp,%ebp
+  80090b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80090e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800911:	b8 00 00 00 00       	mov    $0x0,%eax
+  800916:	eb 03                	jmp    80091b <strnlen+0x13>
+		n++;
+  800918:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80091b:	39 d0                	cmp    %edx,%eax
+  80091d:	74 08                	je     800927 <strnlen+0x1f>
+  80091f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800923:	75 f3                	jne    800918 <strnlen+0x10>
+  800925:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800927:	89 d0                	mov    %edx,%eax
+  800929:	5d                   	pop    %ebp
+  80092a:	c3                   	ret
+
+0080092b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80092b:	55                   	push   %ebp
+  80092c:	89 e5                	mov    %esp,%ebp
+  80092e:	53                   	push   %ebx
+  80092f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800932:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800935:	b8 00 00 00 00       	mov    $0x0,%eax
+  80093a:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80093e:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800941:	83 c0 01             	add    $0x1,%eax
+  800944:	84 d2                	test   %dl,%dl
+  800946:	75 f2                	jne    80093a <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800948:	89 c8                	mov    %ecx,%eax
+  80094a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80094d:	c9                   	leave
+  80094e:	c3                   	ret
+
+0080094f <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80094f:	55                   	push   %ebp
+  800950:	89 e5                	mov    %esp,%ebp
+  800952:	53                   	push   %ebx
+  800953:	83 ec 10             	sub    $0x10,%esp
+  800956:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800959:	53                   	push   %ebx
+  80095a:	e8 91 ff ff ff       	call   8008f0 <strlen>
+  80095f:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800962:	ff 75 0c             	push   0xc(%ebp)
+  800965:	01 d8                	add    %ebx,%eax
+  800967:	50                   	push   %eax
+  800968:	e8 be ff ff ff       	call   80092b <strcpy>
+	return dst;
+}
+  80096d:	89 d8                	mov    %ebx,%eax
+  80096f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800972:	c9                   	leave
+  800973:	c3                   	ret
+
+00800974 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800974:	55                   	push   %ebp
+  800975:	89 e5                	mov    %esp,%ebp
+  800977:	56                   	push   %esi
+  800978:	53                   	push   %ebx
+  800979:	8b 75 08             	mov    0x8(%ebp),%esi
+  80097c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80097f:	89 f3                	mov    %esi,%ebx
+  800981:	03 5d 10             	add    0x10(%ebp),%ebx
+  800984:	89 f0                	mov    %esi,%eax
+  800986:	eb 0f                	jmp    800997 <strncpy+0x23>
+		*dst++ = *src;
+  800988:	83 c0 01             	add    $0x1,%eax
+  80098b:	0f b6 0a             	movzbl (%edx),%ecx
+  80098e:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800991:	80 f9 01             	cmp    $0x1,%cl
+  800994:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800997:	39 d8                	cmp    %ebx,%eax
+  800999:	75 ed                	jne    800988 <strncpy+0x14>
+	}
+	return ret;
+}
+  80099b:	89 f0                	mov    %esi,%eax
+  80099d:	5b                   	pop    %ebx
+  80099e:	5e                   	pop    %esi
+  80099f:	5d                   	pop    %ebp
+  8009a0:	c3                   	ret
+
+008009a1 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8009a1:	55                   	push   %ebp
+  8009a2:	89 e5                	mov    %esp,%ebp
+  8009a4:	56                   	push   %esi
+  8009a5:	53                   	push   %ebx
+  8009a6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009ac:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8009af:	89 f0                	mov    %esi,%eax
+  8009b1:	85 d2                	test   %edx,%edx
+  8009b3:	74 21                	je     8009d6 <strlcpy+0x35>
+  8009b5:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8009b9:	89 f2                	mov    %esi,%edx
+  8009bb:	eb 09                	jmp    8009c6 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8009bd:	83 c1 01             	add    $0x1,%ecx
+  8009c0:	83 c2 01             	add    $0x1,%edx
+  8009c3:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8009c6:	39 c2                	cmp    %eax,%edx
+  8009c8:	74 09                	je     8009d3 <strlcpy+0x32>
+  8009ca:	0f b6 19             	movzbl (%ecx),%ebx
+  8009cd:	84 db                	test   %bl,%bl
+  8009cf:	75 ec                	jne    8009bd <strlcpy+0x1c>
+  8009d1:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8009d3:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009d6:	29 f0                	sub    %esi,%eax
+}
+  8009d8:	5b                   	pop    %ebx
+  8009d9:	5e                   	pop    %esi
+  8009da:	5d                   	pop    %ebp
+  8009db:	c3                   	ret
+
+008009dc <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009dc:	55                   	push   %ebp
+  8009dd:	89 e5                	mov    %esp,%ebp
+  8009df:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009e5:	eb 06                	jmp    8009ed <strcmp+0x11>
+		p++, q++;
+  8009e7:	83 c1 01             	add    $0x1,%ecx
+  8009ea:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009ed:	0f b6 01             	movzbl (%ecx),%eax
+  8009f0:	84 c0                	test   %al,%al
+  8009f2:	74 04                	je     8009f8 <strcmp+0x1c>
+  8009f4:	3a 02                	cmp    (%edx),%al
+  8009f6:	74 ef                	je     8009e7 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009f8:	0f b6 c0             	movzbl %al,%eax
+  8009fb:	0f b6 12             	movzbl (%edx),%edx
+  8009fe:	29 d0                	sub    %edx,%eax
+}
+  800a00:	5d                   	pop    %ebp
+  800a01:	c3                   	ret
+
+00800a02 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a02:	55                   	push   %ebp
+  800a03:	89 e5                	mov    %esp,%ebp
+  800a05:	53                   	push   %ebx
+  800a06:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a09:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a0c:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800a0f:	eb 09                	jmp    800a1a <strncmp+0x18>
+		n--, p++, q++;
+  800a11:	83 ea 01             	sub    $0x1,%edx
+  800a14:	83 c0 01             	add    $0x1,%eax
+  800a17:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800a1a:	85 d2                	test   %edx,%edx
+  800a1c:	74 18                	je     800a36 <strncmp+0x34>
+  800a1e:	0f b6 18             	movzbl (%eax),%ebx
+  800a21:	84 db                	test   %bl,%bl
+  800a23:	74 04                	je     800a29 <strncmp+0x27>
+  800a25:	3a 19                	cmp    (%ecx),%bl
+  800a27:	74 e8                	je     800a11 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a29:	0f b6 00             	movzbl (%eax),%eax
+  800a2c:	0f b6 11             	movzbl (%ecx),%edx
+  800a2f:	29 d0                	sub    %edx,%eax
+}
+  800a31:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a34:	c9                   	leave
+  800a35:	c3                   	ret
+		return 0;
+  800a36:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a3b:	eb f4                	jmp    800a31 <strncmp+0x2f>
+
+00800a3d <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a3d:	55                   	push   %ebp
+  800a3e:	89 e5                	mov    %esp,%ebp
+  800a40:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a43:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a47:	eb 03                	jmp    800a4c <strchr+0xf>
+  800a49:	83 c0 01             	add    $0x1,%eax
+  800a4c:	0f b6 10             	movzbl (%eax),%edx
+  800a4f:	84 d2                	test   %dl,%dl
+  800a51:	74 06                	je     800a59 <strchr+0x1c>
+		if (*s == c)
+  800a53:	38 ca                	cmp    %cl,%dl
+  800a55:	75 f2                	jne    800a49 <strchr+0xc>
+  800a57:	eb 05                	jmp    800a5e <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a59:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a5e:	5d                   	pop    %ebp
+  800a5f:	c3                   	ret
+
+00800a60 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a60:	55                   	push   %ebp
+  800a61:	89 e5                	mov    %esp,%ebp
+  800a63:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a66:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a6a:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a6d:	38 ca                	cmp    %cl,%dl
+  800a6f:	74 09                	je     800a7a <strfind+0x1a>
+  800a71:	84 d2                	test   %dl,%dl
+  800a73:	74 05                	je     800a7a <strfind+0x1a>
+	for (; *s; s++)
+  800a75:	83 c0 01             	add    $0x1,%eax
+  800a78:	eb f0                	jmp    800a6a <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a7a:	5d                   	pop    %ebp
+  800a7b:	c3                   	ret
+
+00800a7c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a7c:	55                   	push   %ebp
+  800a7d:	89 e5                	mov    %esp,%ebp
+  800a7f:	57                   	push   %edi
+  800a80:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a83:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a86:	85 c9                	test   %ecx,%ecx
+  800a88:	74 20                	je     800aaa <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a8a:	89 f8                	mov    %edi,%eax
+  800a8c:	09 c8                	or     %ecx,%eax
+  800a8e:	a8 03                	test   $0x3,%al
+  800a90:	75 12                	jne    800aa4 <memset+0x28>
+		c &= 0xFF;
+  800a92:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a96:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a9c:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a9f:	fc                   	cld
+  800aa0:	f3 ab                	rep stos %eax,%es:(%edi)
+  800aa2:	eb 06                	jmp    800aaa <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800aa4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800aa7:	fc                   	cld
+  800aa8:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800aaa:	89 f8                	mov    %edi,%eax
+  800aac:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800aaf:	c9                   	leave
+  800ab0:	c3                   	ret
+
+00800ab1 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800ab1:	55                   	push   %ebp
+  800ab2:	89 e5                	mov    %esp,%ebp
+  800ab4:	57                   	push   %edi
+  800ab5:	56                   	push   %esi
+  800ab6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ab9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800abc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800abf:	39 c6                	cmp    %eax,%esi
+  800ac1:	73 32                	jae    800af5 <memmove+0x44>
+  800ac3:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800ac6:	39 d0                	cmp    %edx,%eax
+  800ac8:	73 2b                	jae    800af5 <memmove+0x44>
+		s += n;
+		d += n;
+  800aca:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800acd:	89 d6                	mov    %edx,%esi
+  800acf:	09 fe                	or     %edi,%esi
+  800ad1:	09 ce                	or     %ecx,%esi
+  800ad3:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ad9:	75 0e                	jne    800ae9 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800adb:	83 ef 04             	sub    $0x4,%edi
+  800ade:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ae1:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ae4:	fd                   	std
+  800ae5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ae7:	eb 09                	jmp    800af2 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ae9:	83 ef 01             	sub    $0x1,%edi
+  800aec:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800aef:	fd                   	std
+  800af0:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800af2:	fc                   	cld
+  800af3:	eb 1a                	jmp    800b0f <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800af5:	89 f2                	mov    %esi,%edx
+  800af7:	09 c2                	or     %eax,%edx
+  800af9:	09 ca                	or     %ecx,%edx
+  800afb:	f6 c2 03             	test   $0x3,%dl
+  800afe:	75 0a                	jne    800b0a <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b00:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b03:	89 c7                	mov    %eax,%edi
+  800b05:	fc                   	cld
+  800b06:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b08:	eb 05                	jmp    800b0f <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b0a:	89 c7                	mov    %eax,%edi
+  800b0c:	fc                   	cld
+  800b0d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b0f:	5e                   	pop    %esi
+  800b10:	5f                   	pop    %edi
+  800b11:	5d                   	pop    %ebp
+  800b12:	c3                   	ret
+
+00800b13 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b13:	55                   	push   %ebp
+  800b14:	89 e5                	mov    %esp,%ebp
+  800b16:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b19:	ff 75 10             	push   0x10(%ebp)
+  800b1c:	ff 75 0c             	push   0xc(%ebp)
+  800b1f:	ff 75 08             	push   0x8(%ebp)
+  800b22:	e8 8a ff ff ff       	call   800ab1 <memmove>
+}
+  800b27:	c9                   	leave
+  800b28:	c3                   	ret
+
+00800b29 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b29:	55                   	push   %ebp
+  800b2a:	89 e5                	mov    %esp,%ebp
+  800b2c:	56                   	push   %esi
+  800b2d:	53                   	push   %ebx
+  800b2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b31:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b34:	89 c6                	mov    %eax,%esi
+  800b36:	03 75 10             	add    0x10(%ebp),%esi
+  800b39:	eb 06                	jmp    800b41 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b3b:	83 c0 01             	add    $0x1,%eax
+  800b3e:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b41:	39 f0                	cmp    %esi,%eax
+  800b43:	74 14                	je     800b59 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b45:	0f b6 08             	movzbl (%eax),%ecx
+  800b48:	0f b6 1a             	movzbl (%edx),%ebx
+  800b4b:	38 d9                	cmp    %bl,%cl
+  800b4d:	74 ec                	je     800b3b <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b4f:	0f b6 c1             	movzbl %cl,%eax
+  800b52:	0f b6 db             	movzbl %bl,%ebx
+  800b55:	29 d8                	sub    %ebx,%eax
+  800b57:	eb 05                	jmp    800b5e <memcmp+0x35>
+	}
+
+	return 0;
+  800b59:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b5e:	5b                   	pop    %ebx
+  800b5f:	5e                   	pop    %esi
+  800b60:	5d                   	pop    %ebp
+  800b61:	c3                   	ret
+
+00800b62 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b62:	55                   	push   %ebp
+  800b63:	89 e5                	mov    %esp,%ebp
+  800b65:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b68:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b6b:	89 c2                	mov    %eax,%edx
+  800b6d:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b70:	eb 03                	jmp    800b75 <memfind+0x13>
+  800b72:	83 c0 01             	add    $0x1,%eax
+  800b75:	39 d0                	cmp    %edx,%eax
+  800b77:	73 04                	jae    800b7d <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b79:	38 08                	cmp    %cl,(%eax)
+  800b7b:	75 f5                	jne    800b72 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b7d:	5d                   	pop    %ebp
+  800b7e:	c3                   	ret
+
+00800b7f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b7f:	55                   	push   %ebp
+  800b80:	89 e5                	mov    %esp,%ebp
+  800b82:	57                   	push   %edi
+  800b83:	56                   	push   %esi
+  800b84:	53                   	push   %ebx
+  800b85:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b88:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b8b:	eb 03                	jmp    800b90 <strtol+0x11>
+		s++;
+  800b8d:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b90:	0f b6 02             	movzbl (%edx),%eax
+  800b93:	3c 20                	cmp    $0x20,%al
+  800b95:	74 f6                	je     800b8d <strtol+0xe>
+  800b97:	3c 09                	cmp    $0x9,%al
+  800b99:	74 f2                	je     800b8d <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b9b:	3c 2b                	cmp    $0x2b,%al
+  800b9d:	74 2a                	je     800bc9 <strtol+0x4a>
+	int neg = 0;
+  800b9f:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800ba4:	3c 2d                	cmp    $0x2d,%al
+  800ba6:	74 2b                	je     800bd3 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ba8:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800bae:	75 0f                	jne    800bbf <strtol+0x40>
+  800bb0:	80 3a 30             	cmpb   $0x30,(%edx)
+  800bb3:	74 28                	je     800bdd <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800bb5:	85 db                	test   %ebx,%ebx
+  800bb7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bbc:	0f 44 d8             	cmove  %eax,%ebx
+  800bbf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bc4:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bc7:	eb 46                	jmp    800c0f <strtol+0x90>
+		s++;
+  800bc9:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800bcc:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bd1:	eb d5                	jmp    800ba8 <strtol+0x29>
+		s++, neg = 1;
+  800bd3:	83 c2 01             	add    $0x1,%edx
+  800bd6:	bf 01 00 00 00       	mov    $0x1,%edi
+  800bdb:	eb cb                	jmp    800ba8 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bdd:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800be1:	74 0e                	je     800bf1 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800be3:	85 db                	test   %ebx,%ebx
+  800be5:	75 d8                	jne    800bbf <strtol+0x40>
+		s++, base = 8;
+  800be7:	83 c2 01             	add    $0x1,%edx
+  800bea:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bef:	eb ce                	jmp    800bbf <strtol+0x40>
+		s += 2, base = 16;
+  800bf1:	83 c2 02             	add    $0x2,%edx
+  800bf4:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bf9:	eb c4                	jmp    800bbf <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800bfb:	0f be c0             	movsbl %al,%eax
+  800bfe:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800c01:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c04:	7d 3a                	jge    800c40 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800c06:	83 c2 01             	add    $0x1,%edx
+  800c09:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c0d:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800c0f:	0f b6 02             	movzbl (%edx),%eax
+  800c12:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c15:	89 f3                	mov    %esi,%ebx
+  800c17:	80 fb 09             	cmp    $0x9,%bl
+  800c1a:	76 df                	jbe    800bfb <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800c1c:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c1f:	89 f3                	mov    %esi,%ebx
+  800c21:	80 fb 19             	cmp    $0x19,%bl
+  800c24:	77 08                	ja     800c2e <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800c26:	0f be c0             	movsbl %al,%eax
+  800c29:	83 e8 57             	sub    $0x57,%eax
+  800c2c:	eb d3                	jmp    800c01 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c2e:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c31:	89 f3                	mov    %esi,%ebx
+  800c33:	80 fb 19             	cmp    $0x19,%bl
+  800c36:	77 08                	ja     800c40 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800c38:	0f be c0             	movsbl %al,%eax
+  800c3b:	83 e8 37             	sub    $0x37,%eax
+  800c3e:	eb c1                	jmp    800c01 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c40:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c44:	74 05                	je     800c4b <strtol+0xcc>
+		*endptr = (char *) s;
+  800c46:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c49:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c4b:	89 c8                	mov    %ecx,%eax
+  800c4d:	f7 d8                	neg    %eax
+  800c4f:	85 ff                	test   %edi,%edi
+  800c51:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c54:	89 c8                	mov    %ecx,%eax
+  800c56:	5b                   	pop    %ebx
+  800c57:	5e                   	pop    %esi
+  800c58:	5f                   	pop    %edi
+  800c59:	5d                   	pop    %ebp
+  800c5a:	c3                   	ret
+
+00800c5b <atoi>:
+
+int
+atoi(const char *s)
+{
+  800c5b:	55                   	push   %ebp
+  800c5c:	89 e5                	mov    %esp,%ebp
+  800c5e:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800c61:	6a 0a                	push   $0xa
+  800c63:	6a 00                	push   $0x0
+  800c65:	ff 75 08             	push   0x8(%ebp)
+  800c68:	e8 12 ff ff ff       	call   800b7f <strtol>
+}
+  800c6d:	c9                   	leave
+  800c6e:	c3                   	ret
+
+00800c6f <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800c6f:	55                   	push   %ebp
+  800c70:	89 e5                	mov    %esp,%ebp
+  800c72:	57                   	push   %edi
+  800c73:	56                   	push   %esi
+  800c74:	53                   	push   %ebx
+  800c75:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800c7b:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800c81:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800c87:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800c8d:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800c94:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800c97:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800c9e:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800ca1:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800ca8:	74 76                	je     800d20 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800caa:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800cb0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cb3:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800cb9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800cc0:	0f 88 06 01 00 00    	js     800dcc <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800cc6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ccd:	0f 84 48 01 00 00    	je     800e1b <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800cd3:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800cd9:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800cdf:	be 00 00 00 00       	mov    $0x0,%esi
+  800ce4:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800cea:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ced:	55                   	push   %ebp
+  800cee:	68 f7 0c 80 00       	push   $0x800cf7
+  800cf3:	89 e5                	mov    %esp,%ebp
+  800cf5:	0f 34                	sysenter
+  800cf7:	83 c4 04             	add    $0x4,%esp
+  800cfa:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800cfb:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800d01:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800d07:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800d0a:	0f 85 9a 01 00 00    	jne    800eaa <page_vec_call+0x23b>
+  800d10:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d15:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d18:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d1b:	e9 29 01 00 00       	jmp    800e49 <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800d20:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800d26:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d29:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800d2b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d32:	78 2f                	js     800d63 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800d34:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d3b:	74 72                	je     800daf <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800d3d:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800d43:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800d49:	b8 10 00 00 00       	mov    $0x10,%eax
+  800d4e:	89 fb                	mov    %edi,%ebx
+  800d50:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800d53:	55                   	push   %ebp
+  800d54:	68 5d 0d 80 00       	push   $0x800d5d
+  800d59:	89 e5                	mov    %esp,%ebp
+  800d5b:	0f 34                	sysenter
+  800d5d:	83 c4 04             	add    $0x4,%esp
+  800d60:	5d                   	pop    %ebp
+	return ret;
+  800d61:	eb 98                	jmp    800cfb <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800d63:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d68:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800d6a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800d6f:	f6 c6 08             	test   $0x8,%dh
+  800d72:	74 15                	je     800d89 <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d74:	89 c2                	mov    %eax,%edx
+  800d76:	c1 ea 08             	shr    $0x8,%edx
+  800d79:	83 e2 0f             	and    $0xf,%edx
+  800d7c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d81:	83 fa 06             	cmp    $0x6,%edx
+  800d84:	74 0e                	je     800d94 <page_vec_call+0x125>
+  800d86:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800d89:	0f b6 c9             	movzbl %cl,%ecx
+  800d8c:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800d92:	eb a0                	jmp    800d34 <page_vec_call+0xc5>
+  800d94:	89 c2                	mov    %eax,%edx
+  800d96:	c1 ea 04             	shr    $0x4,%edx
+  800d99:	83 e2 0f             	and    $0xf,%edx
+  800d9c:	83 fa 02             	cmp    $0x2,%edx
+  800d9f:	77 e5                	ja     800d86 <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800da1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800da4:	83 f8 02             	cmp    $0x2,%eax
+  800da7:	0f 97 c1             	seta   %cl
+  800daa:	0f b6 c9             	movzbl %cl,%ecx
+  800dad:	eb d7                	jmp    800d86 <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800daf:	b8 10 00 00 00       	mov    $0x10,%eax
+  800db4:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800dba:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800dc0:	89 fb                	mov    %edi,%ebx
+  800dc2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800dc5:	cd 30                	int    $0x30
+  800dc7:	e9 2f ff ff ff       	jmp    800cfb <page_vec_call+0x8c>
+  800dcc:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dd1:	0f a2                	cpuid
+		return 0;
+  800dd3:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800dd8:	f6 c6 08             	test   $0x8,%dh
+  800ddb:	74 15                	je     800df2 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ddd:	89 c2                	mov    %eax,%edx
+  800ddf:	c1 ea 08             	shr    $0x8,%edx
+  800de2:	83 e2 0f             	and    $0xf,%edx
+  800de5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800dea:	83 fa 06             	cmp    $0x6,%edx
+  800ded:	74 11                	je     800e00 <page_vec_call+0x191>
+  800def:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800df2:	0f b6 c9             	movzbl %cl,%ecx
+  800df5:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800dfb:	e9 c6 fe ff ff       	jmp    800cc6 <page_vec_call+0x57>
+  800e00:	89 c2                	mov    %eax,%edx
+  800e02:	c1 ea 04             	shr    $0x4,%edx
+  800e05:	83 e2 0f             	and    $0xf,%edx
+  800e08:	83 fa 02             	cmp    $0x2,%edx
+  800e0b:	77 e2                	ja     800def <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800e0d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e10:	83 f8 02             	cmp    $0x2,%eax
+  800e13:	0f 97 c1             	seta   %cl
+  800e16:	0f b6 c9             	movzbl %cl,%ecx
+  800e19:	eb d4                	jmp    800def <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800e1b:	be 00 00 00 00       	mov    $0x0,%esi
+  800e20:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800e26:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800e2c:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800e32:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800e35:	cd 30                	int    $0x30
+  800e37:	e9 bf fe ff ff       	jmp    800cfb <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800e3c:	29 da                	sub    %ebx,%edx
+			vec++;
+  800e3e:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800e41:	83 e8 01             	sub    $0x1,%eax
+  800e44:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800e49:	85 c0                	test   %eax,%eax
+  800e4b:	74 58                	je     800ea5 <page_vec_call+0x236>
+  800e4d:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800e50:	39 da                	cmp    %ebx,%edx
+  800e52:	73 e8                	jae    800e3c <page_vec_call+0x1cd>
+  800e54:	89 75 08             	mov    %esi,0x8(%ebp)
+  800e57:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800e5a:	84 c9                	test   %cl,%cl
+  800e5c:	74 06                	je     800e64 <page_vec_call+0x1f5>
+  800e5e:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800e64:	83 ec 04             	sub    $0x4,%esp
+  800e67:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e6a:	c1 e0 04             	shl    $0x4,%eax
+  800e6d:	50                   	push   %eax
+  800e6e:	ff 75 08             	push   0x8(%ebp)
+  800e71:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800e77:	53                   	push   %ebx
+  800e78:	e8 34 fc ff ff       	call   800ab1 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800e7d:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800e83:	89 c2                	mov    %eax,%edx
+  800e85:	c1 e2 0c             	shl    $0xc,%edx
+  800e88:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  800e8e:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  800e94:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  800e9a:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  800e9d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  800ea0:	e9 f2 fd ff ff       	jmp    800c97 <page_vec_call+0x28>
+			r = 0;
+  800ea5:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  800eaa:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800eae:	74 0b                	je     800ebb <page_vec_call+0x24c>
+		*done = total;
+  800eb0:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800eb3:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  800eb9:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  800ebb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ebe:	5b                   	pop    %ebx
+  800ebf:	5e                   	pop    %esi
+  800ec0:	5f                   	pop    %edi
+  800ec1:	5d                   	pop    %ebp
+  800ec2:	c3                   	ret
+
+00800ec3 <sys_cputs>:
+{
+  800ec3:	55                   	push   %ebp
+  800ec4:	89 e5                	mov    %esp,%ebp
+  800ec6:	57                   	push   %edi
+  800ec7:	56                   	push   %esi
+  800ec8:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800ec9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ed0:	78 2d                	js     800eff <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800ed2:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ed9:	74 70                	je     800f4b <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800edb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ee0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee6:	89 c3                	mov    %eax,%ebx
+  800ee8:	89 c7                	mov    %eax,%edi
+  800eea:	89 c6                	mov    %eax,%esi
+  800eec:	55                   	push   %ebp
+  800eed:	68 f6 0e 80 00       	push   $0x800ef6
+  800ef2:	89 e5                	mov    %esp,%ebp
+  800ef4:	0f 34                	sysenter
+  800ef6:	83 c4 04             	add    $0x4,%esp
+  800ef9:	5d                   	pop    %ebp
+}
+  800efa:	5b                   	pop    %ebx
+  800efb:	5e                   	pop    %esi
+  800efc:	5f                   	pop    %edi
+  800efd:	5d                   	pop    %ebp
+  800efe:	c3                   	ret
+  800eff:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f04:	0f a2                	cpuid
+		return 0;
+  800f06:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f0b:	f6 c6 08             	test   $0x8,%dh
+  800f0e:	74 15                	je     800f25 <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f10:	89 c2                	mov    %eax,%edx
+  800f12:	c1 ea 08             	shr    $0x8,%edx
+  800f15:	83 e2 0f             	and    $0xf,%edx
+  800f18:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f1d:	83 fa 06             	cmp    $0x6,%edx
+  800f20:	74 0e                	je     800f30 <sys_cputs+0x6d>
+  800f22:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f25:	0f b6 c9             	movzbl %cl,%ecx
+  800f28:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800f2e:	eb a2                	jmp    800ed2 <sys_cputs+0xf>
+  800f30:	89 c2                	mov    %eax,%edx
+  800f32:	c1 ea 04             	shr    $0x4,%edx
+  800f35:	83 e2 0f             	and    $0xf,%edx
+  800f38:	83 fa 02             	cmp    $0x2,%edx
+  800f3b:	77 e5                	ja     800f22 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800f3d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f40:	83 f8 02             	cmp    $0x2,%eax
+  800f43:	0f 97 c1             	seta   %cl
+  800f46:	0f b6 c9             	movzbl %cl,%ecx
+  800f49:	eb d7                	jmp    800f22 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800f4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f50:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f53:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f56:	89 c3                	mov    %eax,%ebx
+  800f58:	89 c7                	mov    %eax,%edi
+  800f5a:	89 c6                	mov    %eax,%esi
+  800f5c:	cd 30                	int    $0x30
+}
+  800f5e:	eb 9a                	jmp    800efa <sys_cputs+0x37>
+
+00800f60 <sys_cgetc>:
+{
+  800f60:	55                   	push   %ebp
+  800f61:	89 e5                	mov    %esp,%ebp
+  800f63:	57                   	push   %edi
+  800f64:	56                   	push   %esi
+  800f65:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800f66:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f6d:	78 2e                	js     800f9d <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  800f6f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f76:	74 71                	je     800fe9 <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  800f78:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f7d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f82:	89 d1                	mov    %edx,%ecx
+  800f84:	89 d3                	mov    %edx,%ebx
+  800f86:	89 d7                	mov    %edx,%edi
+  800f88:	89 d6                	mov    %edx,%esi
+  800f8a:	55                   	push   %ebp
+  800f8b:	68 94 0f 80 00       	push   $0x800f94
+  800f90:	89 e5                	mov    %esp,%ebp
+  800f92:	0f 34                	sysenter
+  800f94:	83 c4 04             	add    $0x4,%esp
+  800f97:	5d                   	pop    %ebp
+}
+  800f98:	5b                   	pop    %ebx
+  800f99:	5e                   	pop    %esi
+  800f9a:	5f                   	pop    %edi
+  800f9b:	5d                   	pop    %ebp
+  800f9c:	c3                   	ret
+  800f9d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fa2:	0f a2                	cpuid
+		return 0;
+  800fa4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800fa9:	f6 c6 08             	test   $0x8,%dh
+  800fac:	74 15                	je     800fc3 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800fae:	89 c2                	mov    %eax,%edx
+  800fb0:	c1 ea 08             	shr    $0x8,%edx
+  800fb3:	83 e2 0f             	and    $0xf,%edx
+  800fb6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800fbb:	83 fa 06             	cmp    $0x6,%edx
+  800fbe:	74 0e                	je     800fce <sys_cgetc+0x6e>
+  800fc0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800fc3:	0f b6 c9             	movzbl %cl,%ecx
+  800fc6:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800fcc:	eb a1                	jmp    800f6f <sys_cgetc+0xf>
+  800fce:	89 c2                	mov    %eax,%edx
+  800fd0:	c1 ea 04             	shr    $0x4,%edx
+  800fd3:	83 e2 0f             	and    $0xf,%edx
+  800fd6:	83 fa 02             	cmp    $0x2,%edx
+  800fd9:	77 e5                	ja     800fc0 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  800fdb:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800fde:	83 f8 02             	cmp    $0x2,%eax
+  800fe1:	0f 97 c1             	seta   %cl
+  800fe4:	0f b6 c9             	movzbl %cl,%ecx
+  800fe7:	eb d7                	jmp    800fc0 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  800fe9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fee:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ff3:	89 d1                	mov    %edx,%ecx
+  800ff5:	89 d3                	mov    %edx,%ebx
+  800ff7:	89 d7                	mov    %edx,%edi
+  800ff9:	89 d6                	mov    %edx,%esi
+  800ffb:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800ffd:	eb 99                	jmp    800f98 <sys_cgetc+0x38>
+
+00800fff <sys_env_destroy>:
+{
+  800fff:	55                   	push   %ebp
+  801000:	89 e5                	mov    %esp,%ebp
+  801002:	57                   	push   %edi
+  801003:	56                   	push   %esi
+  801004:	53                   	push   %ebx
+  801005:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801008:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80100f:	78 36                	js     801047 <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  801011:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801018:	74 79                	je     801093 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  80101a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80101d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801022:	b8 03 00 00 00       	mov    $0x3,%eax
+  801027:	89 cb                	mov    %ecx,%ebx
+  801029:	89 cf                	mov    %ecx,%edi
+  80102b:	89 ce                	mov    %ecx,%esi
+  80102d:	55                   	push   %ebp
+  80102e:	68 37 10 80 00       	push   $0x801037
+  801033:	89 e5                	mov    %esp,%ebp
+  801035:	0f 34                	sysenter
+  801037:	83 c4 04             	add    $0x4,%esp
+  80103a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80103b:	85 c0                	test   %eax,%eax
+  80103d:	7f 6b                	jg     8010aa <sys_env_destroy+0xab>
+}
+  80103f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801042:	5b                   	pop    %ebx
+  801043:	5e                   	pop    %esi
+  801044:	5f                   	pop    %edi
+  801045:	5d                   	pop    %ebp
+  801046:	c3                   	ret
+  801047:	b8 01 00 00 00       	mov    $0x1,%eax
+  80104c:	0f a2                	cpuid
+		return 0;
+  80104e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801053:	f6 c6 08             	test   $0x8,%dh
+  801056:	74 15                	je     80106d <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801058:	89 c2                	mov    %eax,%edx
+  80105a:	c1 ea 08             	shr    $0x8,%edx
+  80105d:	83 e2 0f             	and    $0xf,%edx
+  801060:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801065:	83 fa 06             	cmp    $0x6,%edx
+  801068:	74 0e                	je     801078 <sys_env_destroy+0x79>
+  80106a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80106d:	0f b6 c9             	movzbl %cl,%ecx
+  801070:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801076:	eb 99                	jmp    801011 <sys_env_destroy+0x12>
+  801078:	89 c2                	mov    %eax,%edx
+  80107a:	c1 ea 04             	shr    $0x4,%edx
+  80107d:	83 e2 0f             	and    $0xf,%edx
+  801080:	83 fa 02             	cmp    $0x2,%edx
+  801083:	77 e5                	ja     80106a <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  801085:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801088:	83 f8 02             	cmp    $0x2,%eax
+  80108b:	0f 97 c1             	seta   %cl
+  80108e:	0f b6 c9             	movzbl %cl,%ecx
+  801091:	eb d7                	jmp    80106a <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  801093:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801098:	b8 03 00 00 00       	mov    $0x3,%eax
+  80109d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a0:	89 cb                	mov    %ecx,%ebx
+  8010a2:	89 cf                	mov    %ecx,%edi
+  8010a4:	89 ce                	mov    %ecx,%esi
+  8010a6:	cd 30                	int    $0x30
+  8010a8:	eb 91                	jmp    80103b <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010aa:	83 ec 0c             	sub    $0xc,%esp
+  8010ad:	50                   	push   %eax
+  8010ae:	6a 03                	push   $0x3
+  8010b0:	68 79 2d 80 00       	push   $0x802d79
+  8010b5:	6a 4a                	push   $0x4a
+  8010b7:	68 96 2d 80 00       	push   $0x802d96
+  8010bc:	e8 68 f1 ff ff       	call   800229 <_panic>
+
+008010c1 <sys_getenvid>:
+{
+  8010c1:	55                   	push   %ebp
+  8010c2:	89 e5                	mov    %esp,%ebp
+  8010c4:	57                   	push   %edi
+  8010c5:	56                   	push   %esi
+  8010c6:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8010c7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8010ce:	78 2e                	js     8010fe <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  8010d0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8010d7:	74 71                	je     80114a <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  8010d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010de:	b8 02 00 00 00       	mov    $0x2,%eax
+  8010e3:	89 d1                	mov    %edx,%ecx
+  8010e5:	89 d3                	mov    %edx,%ebx
+  8010e7:	89 d7                	mov    %edx,%edi
+  8010e9:	89 d6                	mov    %edx,%esi
+  8010eb:	55                   	push   %ebp
+  8010ec:	68 f5 10 80 00       	push   $0x8010f5
+  8010f1:	89 e5                	mov    %esp,%ebp
+  8010f3:	0f 34                	sysenter
+  8010f5:	83 c4 04             	add    $0x4,%esp
+  8010f8:	5d                   	pop    %ebp
+}
+  8010f9:	5b                   	pop    %ebx
+  8010fa:	5e                   	pop    %esi
+  8010fb:	5f                   	pop    %edi
+  8010fc:	5d                   	pop    %ebp
+  8010fd:	c3                   	ret
+  8010fe:	b8 01 00 00 00       	mov    $0x1,%eax
+  801103:	0f a2                	cpuid
+		return 0;
+  801105:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80110a:	f6 c6 08             	test   $0x8,%dh
+  80110d:	74 15                	je     801124 <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80110f:	89 c2                	mov    %eax,%edx
+  801111:	c1 ea 08             	shr    $0x8,%edx
+  801114:	83 e2 0f             	and    $0xf,%edx
+  801117:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80111c:	83 fa 06             	cmp    $0x6,%edx
+  80111f:	74 0e                	je     80112f <sys_getenvid+0x6e>
+  801121:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801124:	0f b6 c9             	movzbl %cl,%ecx
+  801127:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80112d:	eb a1                	jmp    8010d0 <sys_getenvid+0xf>
+  80112f:	89 c2                	mov    %eax,%edx
+  801131:	c1 ea 04             	shr    $0x4,%edx
+  801134:	83 e2 0f             	and    $0xf,%edx
+  801137:	83 fa 02             	cmp    $0x2,%edx
+  80113a:	77 e5                	ja     801121 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  80113c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80113f:	83 f8 02             	cmp    $0x2,%eax
+  801142:	0f 97 c1             	seta   %cl
+  801145:	0f b6 c9             	movzbl %cl,%ecx
+  801148:	eb d7                	jmp    801121 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  80114a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80114f:	b8 02 00 00 00       	mov    $0x2,%eax
+  801154:	89 d1                	mov    %edx,%ecx
+  801156:	89 d3                	mov    %edx,%ebx
+  801158:	89 d7                	mov    %edx,%edi
+  80115a:	89 d6                	mov    %edx,%esi
+  80115c:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80115e:	eb 99                	jmp    8010f9 <sys_getenvid+0x38>
+
+00801160 <sys_page_alloc>:
+{
+  801160:	55                   	push   %ebp
+  801161:	89 e5                	mov    %esp,%ebp
+  801163:	57                   	push   %edi
+  801164:	56                   	push   %esi
+  801165:	53                   	push   %ebx
+  801166:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801169:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801170:	78 38                	js     8011aa <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  801172:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801179:	74 7b                	je     8011f6 <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  80117b:	be 00 00 00 00       	mov    $0x0,%esi
+  801180:	8b 55 08             	mov    0x8(%ebp),%edx
+  801183:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801186:	b8 04 00 00 00       	mov    $0x4,%eax
+  80118b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80118e:	89 f7                	mov    %esi,%edi
+  801190:	55                   	push   %ebp
+  801191:	68 9a 11 80 00       	push   $0x80119a
+  801196:	89 e5                	mov    %esp,%ebp
+  801198:	0f 34                	sysenter
+  80119a:	83 c4 04             	add    $0x4,%esp
+  80119d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80119e:	85 c0                	test   %eax,%eax
+  8011a0:	7f 6d                	jg     80120f <sys_page_alloc+0xaf>
+}
+  8011a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a5:	5b                   	pop    %ebx
+  8011a6:	5e                   	pop    %esi
+  8011a7:	5f                   	pop    %edi
+  8011a8:	5d                   	pop    %ebp
+  8011a9:	c3                   	ret
+  8011aa:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011af:	0f a2                	cpuid
+		return 0;
+  8011b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8011b6:	f6 c6 08             	test   $0x8,%dh
+  8011b9:	74 15                	je     8011d0 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011bb:	89 c2                	mov    %eax,%edx
+  8011bd:	c1 ea 08             	shr    $0x8,%edx
+  8011c0:	83 e2 0f             	and    $0xf,%edx
+  8011c3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011c8:	83 fa 06             	cmp    $0x6,%edx
+  8011cb:	74 0e                	je     8011db <sys_page_alloc+0x7b>
+  8011cd:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8011d0:	0f b6 c9             	movzbl %cl,%ecx
+  8011d3:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8011d9:	eb 97                	jmp    801172 <sys_page_alloc+0x12>
+  8011db:	89 c2                	mov    %eax,%edx
+  8011dd:	c1 ea 04             	shr    $0x4,%edx
+  8011e0:	83 e2 0f             	and    $0xf,%edx
+  8011e3:	83 fa 02             	cmp    $0x2,%edx
+  8011e6:	77 e5                	ja     8011cd <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  8011e8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011eb:	83 f8 02             	cmp    $0x2,%eax
+  8011ee:	0f 97 c1             	seta   %cl
+  8011f1:	0f b6 c9             	movzbl %cl,%ecx
+  8011f4:	eb d7                	jmp    8011cd <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  8011f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8011fb:	b8 04 00 00 00       	mov    $0x4,%eax
+  801200:	8b 55 08             	mov    0x8(%ebp),%edx
+  801203:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801206:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801209:	89 f7                	mov    %esi,%edi
+  80120b:	cd 30                	int    $0x30
+  80120d:	eb 8f                	jmp    80119e <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80120f:	83 ec 0c             	sub    $0xc,%esp
+  801212:	50                   	push   %eax
+  801213:	6a 04                	push   $0x4
+  801215:	68 79 2d 80 00       	push   $0x802d79
+  80121a:	6a 4a                	push   $0x4a
+  80121c:	68 96 2d 80 00       	push   $0x802d96
+  801221:	e8 03 f0 ff ff       	call   800229 <_panic>
+
+00801226 <sys_page_map>:
+{
+  801226:	55                   	push   %ebp
+  801227:	89 e5                	mov    %esp,%ebp
+  801229:	57                   	push   %edi
+  80122a:	56                   	push   %esi
+  80122b:	53                   	push   %ebx
+  80122c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80122f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801236:	78 37                	js     80126f <sys_page_map+0x49>
+	if (syscall_sysenter)
+  801238:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80123f:	74 7a                	je     8012bb <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  801241:	8b 55 08             	mov    0x8(%ebp),%edx
+  801244:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801247:	b8 05 00 00 00       	mov    $0x5,%eax
+  80124c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80124f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801252:	8b 75 18             	mov    0x18(%ebp),%esi
+  801255:	55                   	push   %ebp
+  801256:	68 5f 12 80 00       	push   $0x80125f
+  80125b:	89 e5                	mov    %esp,%ebp
+  80125d:	0f 34                	sysenter
+  80125f:	83 c4 04             	add    $0x4,%esp
+  801262:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801263:	85 c0                	test   %eax,%eax
+  801265:	7f 6c                	jg     8012d3 <sys_page_map+0xad>
+}
+  801267:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80126a:	5b                   	pop    %ebx
+  80126b:	5e                   	pop    %esi
+  80126c:	5f                   	pop    %edi
+  80126d:	5d                   	pop    %ebp
+  80126e:	c3                   	ret
+  80126f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801274:	0f a2                	cpuid
+		return 0;
+  801276:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80127b:	f6 c6 08             	test   $0x8,%dh
+  80127e:	74 15                	je     801295 <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801280:	89 c2                	mov    %eax,%edx
+  801282:	c1 ea 08             	shr    $0x8,%edx
+  801285:	83 e2 0f             	and    $0xf,%edx
+  801288:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80128d:	83 fa 06             	cmp    $0x6,%edx
+  801290:	74 0e                	je     8012a0 <sys_page_map+0x7a>
+  801292:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801295:	0f b6 c9             	movzbl %cl,%ecx
+  801298:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80129e:	eb 98                	jmp    801238 <sys_page_map+0x12>
+  8012a0:	89 c2                	mov    %eax,%edx
+  8012a2:	c1 ea 04             	shr    $0x4,%edx
+  8012a5:	83 e2 0f             	and    $0xf,%edx
+  8012a8:	83 fa 02             	cmp    $0x2,%edx
+  8012ab:	77 e5                	ja     801292 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  8012ad:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012b0:	83 f8 02             	cmp    $0x2,%eax
+  8012b3:	0f 97 c1             	seta   %cl
+  8012b6:	0f b6 c9             	movzbl %cl,%ecx
+  8012b9:	eb d7                	jmp    801292 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  8012bb:	b8 05 00 00 00       	mov    $0x5,%eax
+  8012c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012c6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012c9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012cc:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012cf:	cd 30                	int    $0x30
+  8012d1:	eb 90                	jmp    801263 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012d3:	83 ec 0c             	sub    $0xc,%esp
+  8012d6:	50                   	push   %eax
+  8012d7:	6a 05                	push   $0x5
+  8012d9:	68 79 2d 80 00       	push   $0x802d79
+  8012de:	6a 4a                	push   $0x4a
+  8012e0:	68 96 2d 80 00       	push   $0x802d96
+  8012e5:	e8 3f ef ff ff       	call   800229 <_panic>
+
+008012ea <sys_page_unmap>:
+{
+  8012ea:	55                   	push   %ebp
+  8012eb:	89 e5                	mov    %esp,%ebp
+  8012ed:	57                   	push   %edi
+  8012ee:	56                   	push   %esi
+  8012ef:	53                   	push   %ebx
+  8012f0:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8012f3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8012fa:	78 37                	js     801333 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  8012fc:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801303:	74 7a                	je     80137f <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  801305:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80130a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801310:	b8 06 00 00 00       	mov    $0x6,%eax
+  801315:	89 df                	mov    %ebx,%edi
+  801317:	89 de                	mov    %ebx,%esi
+  801319:	55                   	push   %ebp
+  80131a:	68 23 13 80 00       	push   $0x801323
+  80131f:	89 e5                	mov    %esp,%ebp
+  801321:	0f 34                	sysenter
+  801323:	83 c4 04             	add    $0x4,%esp
+  801326:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801327:	85 c0                	test   %eax,%eax
+  801329:	7f 6c                	jg     801397 <sys_page_unmap+0xad>
+}
+  80132b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80132e:	5b                   	pop    %ebx
+  80132f:	5e                   	pop    %esi
+  801330:	5f                   	pop    %edi
+  801331:	5d                   	pop    %ebp
+  801332:	c3                   	ret
+  801333:	b8 01 00 00 00       	mov    $0x1,%eax
+  801338:	0f a2                	cpuid
+		return 0;
+  80133a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80133f:	f6 c6 08             	test   $0x8,%dh
+  801342:	74 15                	je     801359 <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801344:	89 c2                	mov    %eax,%edx
+  801346:	c1 ea 08             	shr    $0x8,%edx
+  801349:	83 e2 0f             	and    $0xf,%edx
+  80134c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801351:	83 fa 06             	cmp    $0x6,%edx
+  801354:	74 0e                	je     801364 <sys_page_unmap+0x7a>
+  801356:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801359:	0f b6 c9             	movzbl %cl,%ecx
+  80135c:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801362:	eb 98                	jmp    8012fc <sys_page_unmap+0x12>
+  801364:	89 c2                	mov    %eax,%edx
+  801366:	c1 ea 04             	shr    $0x4,%edx
+  801369:	83 e2 0f             	and    $0xf,%edx
+  80136c:	83 fa 02             	cmp    $0x2,%edx
+  80136f:	77 e5                	ja     801356 <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  801371:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801374:	83 f8 02             	cmp    $0x2,%eax
+  801377:	0f 97 c1             	seta   %cl
+  80137a:	0f b6 c9             	movzbl %cl,%ecx
+  80137d:	eb d7                	jmp    801356 <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  80137f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801384:	b8 06 00 00 00       	mov    $0x6,%eax
+  801389:	8b 55 08             	mov    0x8(%ebp),%edx
+  80138c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80138f:	89 df                	mov    %ebx,%edi
+  801391:	89 de                	mov    %ebx,%esi
+  801393:	cd 30                	int    $0x30
+  801395:	eb 90                	jmp    801327 <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801397:	83 ec 0c             	sub    $0xc,%esp
+  80139a:	50                   	push   %eax
+  80139b:	6a 06                	push   $0x6
+  80139d:	68 79 2d 80 00       	push   $0x802d79
+  8013a2:	6a 4a                	push   $0x4a
+  8013a4:	68 96 2d 80 00       	push   $0x802d96
+  8013a9:	e8 7b ee ff ff       	call   800229 <_panic>
+
+008013ae <sys_page_copy>:
+{
+  8013ae:	55                   	push   %ebp
+  8013af:	89 e5                	mov    %esp,%ebp
+  8013b1:	57                   	push   %edi
+  8013b2:	56                   	push   %esi
+  8013b3:	53                   	push   %ebx
+  8013b4:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8013b7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8013be:	78 37                	js     8013f7 <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  8013c0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8013c7:	74 7a                	je     801443 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  8013c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013cf:	b8 29 00 00 00       	mov    $0x29,%eax
+  8013d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013d7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013da:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013dd:	55                   	push   %ebp
+  8013de:	68 e7 13 80 00       	push   $0x8013e7
+  8013e3:	89 e5                	mov    %esp,%ebp
+  8013e5:	0f 34                	sysenter
+  8013e7:	83 c4 04             	add    $0x4,%esp
+  8013ea:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8013eb:	85 c0                	test   %eax,%eax
+  8013ed:	7f 6c                	jg     80145b <sys_page_copy+0xad>
+}
+  8013ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013f2:	5b                   	pop    %ebx
+  8013f3:	5e                   	pop    %esi
+  8013f4:	5f                   	pop    %edi
+  8013f5:	5d                   	pop    %ebp
+  8013f6:	c3                   	ret
+  8013f7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013fc:	0f a2                	cpuid
+		return 0;
+  8013fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801403:	f6 c6 08             	test   $0x8,%dh
+  801406:	74 15                	je     80141d <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801408:	89 c2                	mov    %eax,%edx
+  80140a:	c1 ea 08             	shr    $0x8,%edx
+  80140d:	83 e2 0f             	and    $0xf,%edx
+  801410:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801415:	83 fa 06             	cmp    $0x6,%edx
+  801418:	74 0e                	je     801428 <sys_page_copy+0x7a>
+  80141a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80141d:	0f b6 c9             	movzbl %cl,%ecx
+  801420:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801426:	eb 98                	jmp    8013c0 <sys_page_copy+0x12>
+  801428:	89 c2                	mov    %eax,%edx
+  80142a:	c1 ea 04             	shr    $0x4,%edx
+  80142d:	83 e2 0f             	and    $0xf,%edx
+  801430:	83 fa 02             	cmp    $0x2,%edx
+  801433:	77 e5                	ja     80141a <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  801435:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801438:	83 f8 02             	cmp    $0x2,%eax
+  80143b:	0f 97 c1             	seta   %cl
+  80143e:	0f b6 c9             	movzbl %cl,%ecx
+  801441:	eb d7                	jmp    80141a <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  801443:	b8 29 00 00 00       	mov    $0x29,%eax
+  801448:	8b 55 08             	mov    0x8(%ebp),%edx
+  80144b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80144e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801451:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801454:	8b 75 18             	mov    0x18(%ebp),%esi
+  801457:	cd 30                	int    $0x30
+  801459:	eb 90                	jmp    8013eb <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80145b:	83 ec 0c             	sub    $0xc,%esp
+  80145e:	50                   	push   %eax
+  80145f:	6a 29                	push   $0x29
+  801461:	68 79 2d 80 00       	push   $0x802d79
+  801466:	6a 4a                	push   $0x4a
+  801468:	68 96 2d 80 00       	push   $0x802d96
+  80146d:	e8 b7 ed ff ff       	call   800229 <_panic>
+
+00801472 <sys_yield>:
+{
+  801472:	55                   	push   %ebp
+  801473:	89 e5                	mov    %esp,%ebp
+  801475:	57                   	push   %edi
+  801476:	56                   	push   %esi
+  801477:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801478:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80147f:	78 2e                	js     8014af <sys_yield+0x3d>
+	if (syscall_sysenter)
+  801481:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801488:	74 71                	je     8014fb <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  80148a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80148f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801494:	89 d1                	mov    %edx,%ecx
+  801496:	89 d3                	mov    %edx,%ebx
+  801498:	89 d7                	mov    %edx,%edi
+  80149a:	89 d6                	mov    %edx,%esi
+  80149c:	55                   	push   %ebp
+  80149d:	68 a6 14 80 00       	push   $0x8014a6
+  8014a2:	89 e5                	mov    %esp,%ebp
+  8014a4:	0f 34                	sysenter
+  8014a6:	83 c4 04             	add    $0x4,%esp
+  8014a9:	5d                   	pop    %ebp
+}
+  8014aa:	5b                   	pop    %ebx
+  8014ab:	5e                   	pop    %esi
+  8014ac:	5f                   	pop    %edi
+  8014ad:	5d                   	pop    %ebp
+  8014ae:	c3                   	ret
+  8014af:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014b4:	0f a2                	cpuid
+		return 0;
+  8014b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8014bb:	f6 c6 08             	test   $0x8,%dh
+  8014be:	74 15                	je     8014d5 <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014c0:	89 c2                	mov    %eax,%edx
+  8014c2:	c1 ea 08             	shr    $0x8,%edx
+  8014c5:	83 e2 0f             	and    $0xf,%edx
+  8014c8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8014cd:	83 fa 06             	cmp    $0x6,%edx
+  8014d0:	74 0e                	je     8014e0 <sys_yield+0x6e>
+  8014d2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8014d5:	0f b6 c9             	movzbl %cl,%ecx
+  8014d8:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8014de:	eb a1                	jmp    801481 <sys_yield+0xf>
+  8014e0:	89 c2                	mov    %eax,%edx
+  8014e2:	c1 ea 04             	shr    $0x4,%edx
+  8014e5:	83 e2 0f             	and    $0xf,%edx
+  8014e8:	83 fa 02             	cmp    $0x2,%edx
+  8014eb:	77 e5                	ja     8014d2 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  8014ed:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014f0:	83 f8 02             	cmp    $0x2,%eax
+  8014f3:	0f 97 c1             	seta   %cl
+  8014f6:	0f b6 c9             	movzbl %cl,%ecx
+  8014f9:	eb d7                	jmp    8014d2 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  8014fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801500:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801505:	89 d1                	mov    %edx,%ecx
+  801507:	89 d3                	mov    %edx,%ebx
+  801509:	89 d7                	mov    %edx,%edi
+  80150b:	89 d6                	mov    %edx,%esi
+  80150d:	cd 30                	int    $0x30
+}
+  80150f:	eb 99                	jmp    8014aa <sys_yield+0x38>
+
+00801511 <sys_env_set_status>:
+{
+  801511:	55                   	push   %ebp
+  801512:	89 e5                	mov    %esp,%ebp
+  801514:	57                   	push   %edi
+  801515:	56                   	push   %esi
+  801516:	53                   	push   %ebx
+  801517:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80151a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801521:	78 37                	js     80155a <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  801523:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80152a:	74 7a                	je     8015a6 <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  80152c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801531:	8b 55 08             	mov    0x8(%ebp),%edx
+  801534:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801537:	b8 08 00 00 00       	mov    $0x8,%eax
+  80153c:	89 df                	mov    %ebx,%edi
+  80153e:	89 de                	mov    %ebx,%esi
+  801540:	55                   	push   %ebp
+  801541:	68 4a 15 80 00       	push   $0x80154a
+  801546:	89 e5                	mov    %esp,%ebp
+  801548:	0f 34                	sysenter
+  80154a:	83 c4 04             	add    $0x4,%esp
+  80154d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80154e:	85 c0                	test   %eax,%eax
+  801550:	7f 6c                	jg     8015be <sys_env_set_status+0xad>
+}
+  801552:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801555:	5b                   	pop    %ebx
+  801556:	5e                   	pop    %esi
+  801557:	5f                   	pop    %edi
+  801558:	5d                   	pop    %ebp
+  801559:	c3                   	ret
+  80155a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80155f:	0f a2                	cpuid
+		return 0;
+  801561:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801566:	f6 c6 08             	test   $0x8,%dh
+  801569:	74 15                	je     801580 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80156b:	89 c2                	mov    %eax,%edx
+  80156d:	c1 ea 08             	shr    $0x8,%edx
+  801570:	83 e2 0f             	and    $0xf,%edx
+  801573:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801578:	83 fa 06             	cmp    $0x6,%edx
+  80157b:	74 0e                	je     80158b <sys_env_set_status+0x7a>
+  80157d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801580:	0f b6 c9             	movzbl %cl,%ecx
+  801583:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801589:	eb 98                	jmp    801523 <sys_env_set_status+0x12>
+  80158b:	89 c2                	mov    %eax,%edx
+  80158d:	c1 ea 04             	shr    $0x4,%edx
+  801590:	83 e2 0f             	and    $0xf,%edx
+  801593:	83 fa 02             	cmp    $0x2,%edx
+  801596:	77 e5                	ja     80157d <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  801598:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80159b:	83 f8 02             	cmp    $0x2,%eax
+  80159e:	0f 97 c1             	seta   %cl
+  8015a1:	0f b6 c9             	movzbl %cl,%ecx
+  8015a4:	eb d7                	jmp    80157d <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  8015a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ab:	b8 08 00 00 00       	mov    $0x8,%eax
+  8015b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b6:	89 df                	mov    %ebx,%edi
+  8015b8:	89 de                	mov    %ebx,%esi
+  8015ba:	cd 30                	int    $0x30
+  8015bc:	eb 90                	jmp    80154e <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015be:	83 ec 0c             	sub    $0xc,%esp
+  8015c1:	50                   	push   %eax
+  8015c2:	6a 08                	push   $0x8
+  8015c4:	68 79 2d 80 00       	push   $0x802d79
+  8015c9:	6a 4a                	push   $0x4a
+  8015cb:	68 96 2d 80 00       	push   $0x802d96
+  8015d0:	e8 54 ec ff ff       	call   800229 <_panic>
+
+008015d5 <sys_sysinfo>:
+{
+  8015d5:	55                   	push   %ebp
+  8015d6:	89 e5                	mov    %esp,%ebp
+  8015d8:	57                   	push   %edi
+  8015d9:	56                   	push   %esi
+  8015da:	53                   	push   %ebx
+  8015db:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8015de:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8015e5:	78 36                	js     80161d <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  8015e7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8015ee:	74 79                	je     801669 <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  8015f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015f8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8015fd:	89 cb                	mov    %ecx,%ebx
+  8015ff:	89 cf                	mov    %ecx,%edi
+  801601:	89 ce                	mov    %ecx,%esi
+  801603:	55                   	push   %ebp
+  801604:	68 0d 16 80 00       	push   $0x80160d
+  801609:	89 e5                	mov    %esp,%ebp
+  80160b:	0f 34                	sysenter
+  80160d:	83 c4 04             	add    $0x4,%esp
+  801610:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801611:	85 c0                	test   %eax,%eax
+  801613:	7f 6b                	jg     801680 <sys_sysinfo+0xab>
+}
+  801615:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801618:	5b                   	pop    %ebx
+  801619:	5e                   	pop    %esi
+  80161a:	5f                   	pop    %edi
+  80161b:	5d                   	pop    %ebp
+  80161c:	c3                   	ret
+  80161d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801622:	0f a2                	cpuid
+		return 0;
+  801624:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801629:	f6 c6 08             	test   $0x8,%dh
+  80162c:	74 15                	je     801643 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80162e:	89 c2                	mov    %eax,%edx
+  801630:	c1 ea 08             	shr    $0x8,%edx
+  801633:	83 e2 0f             	and    $0xf,%edx
+  801636:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80163b:	83 fa 06             	cmp    $0x6,%edx
+  80163e:	74 0e                	je     80164e <sys_sysinfo+0x79>
+  801640:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801643:	0f b6 c9             	movzbl %cl,%ecx
+  801646:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80164c:	eb 99                	jmp    8015e7 <sys_sysinfo+0x12>
+  80164e:	89 c2                	mov    %eax,%edx
+  801650:	c1 ea 04             	shr    $0x4,%edx
+  801653:	83 e2 0f             	and    $0xf,%edx
+  801656:	83 fa 02             	cmp    $0x2,%edx
+  801659:	77 e5                	ja     801640 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  80165b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80165e:	83 f8 02             	cmp    $0x2,%eax
+  801661:	0f 97 c1             	seta   %cl
+  801664:	0f b6 c9             	movzbl %cl,%ecx
+  801667:	eb d7                	jmp    801640 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  801669:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80166e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801673:	8b 55 08             	mov    0x8(%ebp),%edx
+  801676:	89 cb                	mov    %ecx,%ebx
+  801678:	89 cf                	mov    %ecx,%edi
+  80167a:	89 ce                	mov    %ecx,%esi
+  80167c:	cd 30                	int    $0x30
+  80167e:	eb 91                	jmp    801611 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801680:	83 ec 0c             	sub    $0xc,%esp
+  801683:	50                   	push   %eax
+  801684:	6a 0b                	push   $0xb
+  801686:	68 79 2d 80 00       	push   $0x802d79
+  80168b:	6a 4a                	push   $0x4a
+  80168d:	68 96 2d 80 00       	push   $0x802d96
+  801692:	e8 92 eb ff ff       	call   800229 <_panic>
+
+00801697 <sys_env_set_trapframe>:
+{
+  801697:	55                   	push   %ebp
+  801698:	89 e5                	mov    %esp,%ebp
+  80169a:	57                   	push   %edi
+  80169b:	56                   	push   %esi
+  80169c:	53                   	push   %ebx
+  80169d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8016a0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8016a7:	78 37                	js     8016e0 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  8016a9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8016b0:	74 7a                	je     80172c <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  8016b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016bd:	b8 13 00 00 00       	mov    $0x13,%eax
+  8016c2:	89 df                	mov    %ebx,%edi
+  8016c4:	89 de                	mov    %ebx,%esi
+  8016c6:	55                   	push   %ebp
+  8016c7:	68 d0 16 80 00       	push   $0x8016d0
+  8016cc:	89 e5                	mov    %esp,%ebp
+  8016ce:	0f 34                	sysenter
+  8016d0:	83 c4 04             	add    $0x4,%esp
+  8016d3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8016d4:	85 c0                	test   %eax,%eax
+  8016d6:	7f 6c                	jg     801744 <sys_env_set_trapframe+0xad>
+}
+  8016d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016db:	5b                   	pop    %ebx
+  8016dc:	5e                   	pop    %esi
+  8016dd:	5f                   	pop    %edi
+  8016de:	5d                   	pop    %ebp
+  8016df:	c3                   	ret
+  8016e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016e5:	0f a2                	cpuid
+		return 0;
+  8016e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8016ec:	f6 c6 08             	test   $0x8,%dh
+  8016ef:	74 15                	je     801706 <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016f1:	89 c2                	mov    %eax,%edx
+  8016f3:	c1 ea 08             	shr    $0x8,%edx
+  8016f6:	83 e2 0f             	and    $0xf,%edx
+  8016f9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8016fe:	83 fa 06             	cmp    $0x6,%edx
+  801701:	74 0e                	je     801711 <sys_env_set_trapframe+0x7a>
+  801703:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801706:	0f b6 c9             	movzbl %cl,%ecx
+  801709:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80170f:	eb 98                	jmp    8016a9 <sys_env_set_trapframe+0x12>
+  801711:	89 c2                	mov    %eax,%edx
+  801713:	c1 ea 04             	shr    $0x4,%edx
+  801716:	83 e2 0f             	and    $0xf,%edx
+  801719:	83 fa 02             	cmp    $0x2,%edx
+  80171c:	77 e5                	ja     801703 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  80171e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801721:	83 f8 02             	cmp    $0x2,%eax
+  801724:	0f 97 c1             	seta   %cl
+  801727:	0f b6 c9             	movzbl %cl,%ecx
+  80172a:	eb d7                	jmp    801703 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  80172c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801731:	b8 13 00 00 00       	mov    $0x13,%eax
+  801736:	8b 55 08             	mov    0x8(%ebp),%edx
+  801739:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80173c:	89 df                	mov    %ebx,%edi
+  80173e:	89 de                	mov    %ebx,%esi
+  801740:	cd 30                	int    $0x30
+  801742:	eb 90                	jmp    8016d4 <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801744:	83 ec 0c             	sub    $0xc,%esp
+  801747:	50                   	push   %eax
+  801748:	6a 13                	push   $0x13
+  80174a:	68 79 2d 80 00       	push   $0x802d79
+  80174f:	6a 4a                	push   $0x4a
+  801751:	68 96 2d 80 00       	push   $0x802d96
+  801756:	e8 ce ea ff ff       	call   800229 <_panic>
+
+0080175b <sys_env_set_stack_limit>:
+{
+  80175b:	55                   	push   %ebp
+  80175c:	89 e5                	mov    %esp,%ebp
+  80175e:	57                   	push   %edi
+  80175f:	56                   	push   %esi
+  801760:	53                   	push   %ebx
+  801761:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801764:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80176b:	78 37                	js     8017a4 <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  80176d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801774:	74 7a                	je     8017f0 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  801776:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80177b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80177e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801781:	b8 19 00 00 00       	mov    $0x19,%eax
+  801786:	89 df                	mov    %ebx,%edi
+  801788:	89 de                	mov    %ebx,%esi
+  80178a:	55                   	push   %ebp
+  80178b:	68 94 17 80 00       	push   $0x801794
+  801790:	89 e5                	mov    %esp,%ebp
+  801792:	0f 34                	sysenter
+  801794:	83 c4 04             	add    $0x4,%esp
+  801797:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801798:	85 c0                	test   %eax,%eax
+  80179a:	7f 6c                	jg     801808 <sys_env_set_stack_limit+0xad>
+}
+  80179c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80179f:	5b                   	pop    %ebx
+  8017a0:	5e                   	pop    %esi
+  8017a1:	5f                   	pop    %edi
+  8017a2:	5d                   	pop    %ebp
+  8017a3:	c3                   	ret
+  8017a4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8017a9:	0f a2                	cpuid
+		return 0;
+  8017ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8017b0:	f6 c6 08             	test   $0x8,%dh
+  8017b3:	74 15                	je     8017ca <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017b5:	89 c2                	mov    %eax,%edx
+  8017b7:	c1 ea 08             	shr    $0x8,%edx
+  8017ba:	83 e2 0f             	and    $0xf,%edx
+  8017bd:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017c2:	83 fa 06             	cmp    $0x6,%edx
+  8017c5:	74 0e                	je     8017d5 <sys_env_set_stack_limit+0x7a>
+  8017c7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8017ca:	0f b6 c9             	movzbl %cl,%ecx
+  8017cd:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8017d3:	eb 98                	jmp    80176d <sys_env_set_stack_limit+0x12>
+  8017d5:	89 c2                	mov    %eax,%edx
+  8017d7:	c1 ea 04             	shr    $0x4,%edx
+  8017da:	83 e2 0f             	and    $0xf,%edx
+  8017dd:	83 fa 02             	cmp    $0x2,%edx
+  8017e0:	77 e5                	ja     8017c7 <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  8017e2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017e5:	83 f8 02             	cmp    $0x2,%eax
+  8017e8:	0f 97 c1             	seta   %cl
+  8017eb:	0f b6 c9             	movzbl %cl,%ecx
+  8017ee:	eb d7                	jmp    8017c7 <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  8017f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017f5:	b8 19 00 00 00       	mov    $0x19,%eax
+  8017fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801800:	89 df                	mov    %ebx,%edi
+  801802:	89 de                	mov    %ebx,%esi
+  801804:	cd 30                	int    $0x30
+  801806:	eb 90                	jmp    801798 <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801808:	83 ec 0c             	sub    $0xc,%esp
+  80180b:	50                   	push   %eax
+  80180c:	6a 19                	push   $0x19
+  80180e:	68 79 2d 80 00       	push   $0x802d79
+  801813:	6a 4a                	push   $0x4a
+  801815:	68 96 2d 80 00       	push   $0x802d96
+  80181a:	e8 0a ea ff ff       	call   800229 <_panic>
+
+0080181f <sys_env_set_pgfault_upcall>:
+{
+  80181f:	55                   	push   %ebp
+  801820:	89 e5                	mov    %esp,%ebp
+  801822:	57                   	push   %edi
+  801823:	56                   	push   %esi
+  801824:	53                   	push   %ebx
+  801825:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801828:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80182f:	78 37                	js     801868 <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  801831:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801838:	74 7a                	je     8018b4 <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  80183a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80183f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801842:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801845:	b8 09 00 00 00       	mov    $0x9,%eax
+  80184a:	89 df                	mov    %ebx,%edi
+  80184c:	89 de                	mov    %ebx,%esi
+  80184e:	55                   	push   %ebp
+  80184f:	68 58 18 80 00       	push   $0x801858
+  801854:	89 e5                	mov    %esp,%ebp
+  801856:	0f 34                	sysenter
+  801858:	83 c4 04             	add    $0x4,%esp
+  80185b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80185c:	85 c0                	test   %eax,%eax
+  80185e:	7f 6c                	jg     8018cc <sys_env_set_pgfault_upcall+0xad>
+}
+  801860:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801863:	5b                   	pop    %ebx
+  801864:	5e                   	pop    %esi
+  801865:	5f                   	pop    %edi
+  801866:	5d                   	pop    %ebp
+  801867:	c3                   	ret
+  801868:	b8 01 00 00 00       	mov    $0x1,%eax
+  80186d:	0f a2                	cpuid
+		return 0;
+  80186f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801874:	f6 c6 08             	test   $0x8,%dh
+  801877:	74 15                	je     80188e <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801879:	89 c2                	mov    %eax,%edx
+  80187b:	c1 ea 08             	shr    $0x8,%edx
+  80187e:	83 e2 0f             	and    $0xf,%edx
+  801881:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801886:	83 fa 06             	cmp    $0x6,%edx
+  801889:	74 0e                	je     801899 <sys_env_set_pgfault_upcall+0x7a>
+  80188b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80188e:	0f b6 c9             	movzbl %cl,%ecx
+  801891:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801897:	eb 98                	jmp    801831 <sys_env_set_pgfault_upcall+0x12>
+  801899:	89 c2                	mov    %eax,%edx
+  80189b:	c1 ea 04             	shr    $0x4,%edx
+  80189e:	83 e2 0f             	and    $0xf,%edx
+  8018a1:	83 fa 02             	cmp    $0x2,%edx
+  8018a4:	77 e5                	ja     80188b <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  8018a6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018a9:	83 f8 02             	cmp    $0x2,%eax
+  8018ac:	0f 97 c1             	seta   %cl
+  8018af:	0f b6 c9             	movzbl %cl,%ecx
+  8018b2:	eb d7                	jmp    80188b <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  8018b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018b9:	b8 09 00 00 00       	mov    $0x9,%eax
+  8018be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018c4:	89 df                	mov    %ebx,%edi
+  8018c6:	89 de                	mov    %ebx,%esi
+  8018c8:	cd 30                	int    $0x30
+  8018ca:	eb 90                	jmp    80185c <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8018cc:	83 ec 0c             	sub    $0xc,%esp
+  8018cf:	50                   	push   %eax
+  8018d0:	6a 09                	push   $0x9
+  8018d2:	68 79 2d 80 00       	push   $0x802d79
+  8018d7:	6a 4a                	push   $0x4a
+  8018d9:	68 96 2d 80 00       	push   $0x802d96
+  8018de:	e8 46 e9 ff ff       	call   800229 <_panic>
+
+008018e3 <sys_ipc_try_send>:
+{
+  8018e3:	55                   	push   %ebp
+  8018e4:	89 e5                	mov    %esp,%ebp
+  8018e6:	57                   	push   %edi
+  8018e7:	56                   	push   %esi
+  8018e8:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8018e9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8018f0:	78 32                	js     801924 <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  8018f2:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8018f9:	74 75                	je     801970 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  8018fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801901:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801906:	be 00 00 00 00       	mov    $0x0,%esi
+  80190b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80190e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801911:	55                   	push   %ebp
+  801912:	68 1b 19 80 00       	push   $0x80191b
+  801917:	89 e5                	mov    %esp,%ebp
+  801919:	0f 34                	sysenter
+  80191b:	83 c4 04             	add    $0x4,%esp
+  80191e:	5d                   	pop    %ebp
+}
+  80191f:	5b                   	pop    %ebx
+  801920:	5e                   	pop    %esi
+  801921:	5f                   	pop    %edi
+  801922:	5d                   	pop    %ebp
+  801923:	c3                   	ret
+  801924:	b8 01 00 00 00       	mov    $0x1,%eax
+  801929:	0f a2                	cpuid
+		return 0;
+  80192b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801930:	f6 c6 08             	test   $0x8,%dh
+  801933:	74 15                	je     80194a <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801935:	89 c2                	mov    %eax,%edx
+  801937:	c1 ea 08             	shr    $0x8,%edx
+  80193a:	83 e2 0f             	and    $0xf,%edx
+  80193d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801942:	83 fa 06             	cmp    $0x6,%edx
+  801945:	74 0e                	je     801955 <sys_ipc_try_send+0x72>
+  801947:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80194a:	0f b6 c9             	movzbl %cl,%ecx
+  80194d:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801953:	eb 9d                	jmp    8018f2 <sys_ipc_try_send+0xf>
+  801955:	89 c2                	mov    %eax,%edx
+  801957:	c1 ea 04             	shr    $0x4,%edx
+  80195a:	83 e2 0f             	and    $0xf,%edx
+  80195d:	83 fa 02             	cmp    $0x2,%edx
+  801960:	77 e5                	ja     801947 <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  801962:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801965:	83 f8 02             	cmp    $0x2,%eax
+  801968:	0f 97 c1             	seta   %cl
+  80196b:	0f b6 c9             	movzbl %cl,%ecx
+  80196e:	eb d7                	jmp    801947 <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  801970:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801975:	be 00 00 00 00       	mov    $0x0,%esi
+  80197a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80197d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801980:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801983:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801986:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801988:	eb 95                	jmp    80191f <sys_ipc_try_send+0x3c>
+
+0080198a <sys_ipc_send>:
+{
+  80198a:	55                   	push   %ebp
+  80198b:	89 e5                	mov    %esp,%ebp
+  80198d:	57                   	push   %edi
+  80198e:	56                   	push   %esi
+  80198f:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801990:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801997:	78 32                	js     8019cb <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  801999:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8019a0:	74 75                	je     801a17 <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  8019a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019a8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8019ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8019b2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019b5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8019b8:	55                   	push   %ebp
+  8019b9:	68 c2 19 80 00       	push   $0x8019c2
+  8019be:	89 e5                	mov    %esp,%ebp
+  8019c0:	0f 34                	sysenter
+  8019c2:	83 c4 04             	add    $0x4,%esp
+  8019c5:	5d                   	pop    %ebp
+}
+  8019c6:	5b                   	pop    %ebx
+  8019c7:	5e                   	pop    %esi
+  8019c8:	5f                   	pop    %edi
+  8019c9:	5d                   	pop    %ebp
+  8019ca:	c3                   	ret
+  8019cb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019d0:	0f a2                	cpuid
+		return 0;
+  8019d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8019d7:	f6 c6 08             	test   $0x8,%dh
+  8019da:	74 15                	je     8019f1 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019dc:	89 c2                	mov    %eax,%edx
+  8019de:	c1 ea 08             	shr    $0x8,%edx
+  8019e1:	83 e2 0f             	and    $0xf,%edx
+  8019e4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019e9:	83 fa 06             	cmp    $0x6,%edx
+  8019ec:	74 0e                	je     8019fc <sys_ipc_send+0x72>
+  8019ee:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8019f1:	0f b6 c9             	movzbl %cl,%ecx
+  8019f4:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8019fa:	eb 9d                	jmp    801999 <sys_ipc_send+0xf>
+  8019fc:	89 c2                	mov    %eax,%edx
+  8019fe:	c1 ea 04             	shr    $0x4,%edx
+  801a01:	83 e2 0f             	and    $0xf,%edx
+  801a04:	83 fa 02             	cmp    $0x2,%edx
+  801a07:	77 e5                	ja     8019ee <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  801a09:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a0c:	83 f8 02             	cmp    $0x2,%eax
+  801a0f:	0f 97 c1             	seta   %cl
+  801a12:	0f b6 c9             	movzbl %cl,%ecx
+  801a15:	eb d7                	jmp    8019ee <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  801a17:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801a1c:	be 00 00 00 00       	mov    $0x0,%esi
+  801a21:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a27:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a2a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a2d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801a2f:	eb 95                	jmp    8019c6 <sys_ipc_send+0x3c>
+
+00801a31 <sys_ipc_recv>:
+{
+  801a31:	55                   	push   %ebp
+  801a32:	89 e5                	mov    %esp,%ebp
+  801a34:	57                   	push   %edi
+  801a35:	56                   	push   %esi
+  801a36:	53                   	push   %ebx
+  801a37:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801a3a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801a41:	78 36                	js     801a79 <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  801a43:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801a4a:	74 79                	je     801ac5 <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  801a4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a4f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a54:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801a59:	89 cb                	mov    %ecx,%ebx
+  801a5b:	89 cf                	mov    %ecx,%edi
+  801a5d:	89 ce                	mov    %ecx,%esi
+  801a5f:	55                   	push   %ebp
+  801a60:	68 69 1a 80 00       	push   $0x801a69
+  801a65:	89 e5                	mov    %esp,%ebp
+  801a67:	0f 34                	sysenter
+  801a69:	83 c4 04             	add    $0x4,%esp
+  801a6c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801a6d:	85 c0                	test   %eax,%eax
+  801a6f:	7f 6b                	jg     801adc <sys_ipc_recv+0xab>
+}
+  801a71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a74:	5b                   	pop    %ebx
+  801a75:	5e                   	pop    %esi
+  801a76:	5f                   	pop    %edi
+  801a77:	5d                   	pop    %ebp
+  801a78:	c3                   	ret
+  801a79:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a7e:	0f a2                	cpuid
+		return 0;
+  801a80:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801a85:	f6 c6 08             	test   $0x8,%dh
+  801a88:	74 15                	je     801a9f <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a8a:	89 c2                	mov    %eax,%edx
+  801a8c:	c1 ea 08             	shr    $0x8,%edx
+  801a8f:	83 e2 0f             	and    $0xf,%edx
+  801a92:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a97:	83 fa 06             	cmp    $0x6,%edx
+  801a9a:	74 0e                	je     801aaa <sys_ipc_recv+0x79>
+  801a9c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a9f:	0f b6 c9             	movzbl %cl,%ecx
+  801aa2:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801aa8:	eb 99                	jmp    801a43 <sys_ipc_recv+0x12>
+  801aaa:	89 c2                	mov    %eax,%edx
+  801aac:	c1 ea 04             	shr    $0x4,%edx
+  801aaf:	83 e2 0f             	and    $0xf,%edx
+  801ab2:	83 fa 02             	cmp    $0x2,%edx
+  801ab5:	77 e5                	ja     801a9c <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  801ab7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801aba:	83 f8 02             	cmp    $0x2,%eax
+  801abd:	0f 97 c1             	seta   %cl
+  801ac0:	0f b6 c9             	movzbl %cl,%ecx
+  801ac3:	eb d7                	jmp    801a9c <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  801ac5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801aca:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801acf:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ad2:	89 cb                	mov    %ecx,%ebx
+  801ad4:	89 cf                	mov    %ecx,%edi
+  801ad6:	89 ce                	mov    %ecx,%esi
+  801ad8:	cd 30                	int    $0x30
+  801ada:	eb 91                	jmp    801a6d <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801adc:	83 ec 0c             	sub    $0xc,%esp
+  801adf:	50                   	push   %eax
+  801ae0:	6a 0d                	push   $0xd
+  801ae2:	68 79 2d 80 00       	push   $0x802d79
+  801ae7:	6a 4a                	push   $0x4a
+  801ae9:	68 96 2d 80 00       	push   $0x802d96
+  801aee:	e8 36 e7 ff ff       	call   800229 <_panic>
+
+00801af3 <sys_ipc_send_range>:
+{
+  801af3:	55                   	push   %ebp
+  801af4:	89 e5                	mov    %esp,%ebp
+  801af6:	57                   	push   %edi
+  801af7:	56                   	push   %esi
+  801af8:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801af9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b00:	78 30                	js     801b32 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  801b02:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b09:	74 73                	je     801b7e <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801b0b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b0e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b11:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801b16:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b19:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801b1c:	8b 75 18             	mov    0x18(%ebp),%esi
+  801b1f:	55                   	push   %ebp
+  801b20:	68 29 1b 80 00       	push   $0x801b29
+  801b25:	89 e5                	mov    %esp,%ebp
+  801b27:	0f 34                	sysenter
+  801b29:	83 c4 04             	add    $0x4,%esp
+  801b2c:	5d                   	pop    %ebp
+}
+  801b2d:	5b                   	pop    %ebx
+  801b2e:	5e                   	pop    %esi
+  801b2f:	5f                   	pop    %edi
+  801b30:	5d                   	pop    %ebp
+  801b31:	c3                   	ret
+  801b32:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b37:	0f a2                	cpuid
+		return 0;
+  801b39:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b3e:	f6 c6 08             	test   $0x8,%dh
+  801b41:	74 15                	je     801b58 <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b43:	89 c2                	mov    %eax,%edx
+  801b45:	c1 ea 08             	shr    $0x8,%edx
+  801b48:	83 e2 0f             	and    $0xf,%edx
+  801b4b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b50:	83 fa 06             	cmp    $0x6,%edx
+  801b53:	74 0e                	je     801b63 <sys_ipc_send_range+0x70>
+  801b55:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b58:	0f b6 c9             	movzbl %cl,%ecx
+  801b5b:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801b61:	eb 9f                	jmp    801b02 <sys_ipc_send_range+0xf>
+  801b63:	89 c2                	mov    %eax,%edx
+  801b65:	c1 ea 04             	shr    $0x4,%edx
+  801b68:	83 e2 0f             	and    $0xf,%edx
+  801b6b:	83 fa 02             	cmp    $0x2,%edx
+  801b6e:	77 e5                	ja     801b55 <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  801b70:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b73:	83 f8 02             	cmp    $0x2,%eax
+  801b76:	0f 97 c1             	seta   %cl
+  801b79:	0f b6 c9             	movzbl %cl,%ecx
+  801b7c:	eb d7                	jmp    801b55 <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  801b7e:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801b83:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b89:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b8c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801b8f:	8b 75 18             	mov    0x18(%ebp),%esi
+  801b92:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  801b94:	eb 97                	jmp    801b2d <sys_ipc_send_range+0x3a>
+
+00801b96 <sys_ipc_recv_range>:
+{
+  801b96:	55                   	push   %ebp
+  801b97:	89 e5                	mov    %esp,%ebp
+  801b99:	57                   	push   %edi
+  801b9a:	56                   	push   %esi
+  801b9b:	53                   	push   %ebx
+  801b9c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801b9f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801ba6:	78 37                	js     801bdf <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  801ba8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801baf:	74 7a                	je     801c2b <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  801bb1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bb6:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bb9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bbc:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801bc1:	89 df                	mov    %ebx,%edi
+  801bc3:	89 de                	mov    %ebx,%esi
+  801bc5:	55                   	push   %ebp
+  801bc6:	68 cf 1b 80 00       	push   $0x801bcf
+  801bcb:	89 e5                	mov    %esp,%ebp
+  801bcd:	0f 34                	sysenter
+  801bcf:	83 c4 04             	add    $0x4,%esp
+  801bd2:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801bd3:	85 c0                	test   %eax,%eax
+  801bd5:	7f 6c                	jg     801c43 <sys_ipc_recv_range+0xad>
+}
+  801bd7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bda:	5b                   	pop    %ebx
+  801bdb:	5e                   	pop    %esi
+  801bdc:	5f                   	pop    %edi
+  801bdd:	5d                   	pop    %ebp
+  801bde:	c3                   	ret
+  801bdf:	b8 01 00 00 00       	mov    $0x1,%eax
+  801be4:	0f a2                	cpuid
+		return 0;
+  801be6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801beb:	f6 c6 08             	test   $0x8,%dh
+  801bee:	74 15                	je     801c05 <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bf0:	89 c2                	mov    %eax,%edx
+  801bf2:	c1 ea 08             	shr    $0x8,%edx
+  801bf5:	83 e2 0f             	and    $0xf,%edx
+  801bf8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801bfd:	83 fa 06             	cmp    $0x6,%edx
+  801c00:	74 0e                	je     801c10 <sys_ipc_recv_range+0x7a>
+  801c02:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801c05:	0f b6 c9             	movzbl %cl,%ecx
+  801c08:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801c0e:	eb 98                	jmp    801ba8 <sys_ipc_recv_range+0x12>
+  801c10:	89 c2                	mov    %eax,%edx
+  801c12:	c1 ea 04             	shr    $0x4,%edx
+  801c15:	83 e2 0f             	and    $0xf,%edx
+  801c18:	83 fa 02             	cmp    $0x2,%edx
+  801c1b:	77 e5                	ja     801c02 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801c1d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c20:	83 f8 02             	cmp    $0x2,%eax
+  801c23:	0f 97 c1             	seta   %cl
+  801c26:	0f b6 c9             	movzbl %cl,%ecx
+  801c29:	eb d7                	jmp    801c02 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801c2b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c30:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801c35:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c3b:	89 df                	mov    %ebx,%edi
+  801c3d:	89 de                	mov    %ebx,%esi
+  801c3f:	cd 30                	int    $0x30
+  801c41:	eb 90                	jmp    801bd3 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801c43:	83 ec 0c             	sub    $0xc,%esp
+  801c46:	50                   	push   %eax
+  801c47:	6a 1f                	push   $0x1f
+  801c49:	68 79 2d 80 00       	push   $0x802d79
+  801c4e:	6a 4a                	push   $0x4a
+  801c50:	68 96 2d 80 00       	push   $0x802d96
+  801c55:	e8 cf e5 ff ff       	call   800229 <_panic>
+
+00801c5a <sys_ipc_call>:
+{
+  801c5a:	55                   	push   %ebp
+  801c5b:	89 e5                	mov    %esp,%ebp
+  801c5d:	57                   	push   %edi
+  801c5e:	56                   	push   %esi
+  801c5f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801c60:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c63:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801c68:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801c6b:	55                   	push   %ebp
+  801c6c:	56                   	push   %esi
+  801c6d:	8b 0e                	mov    (%esi),%ecx
+  801c6f:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801c72:	8b 7e 08             	mov    0x8(%esi),%edi
+  801c75:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801c78:	8b 76 0c             	mov    0xc(%esi),%esi
+  801c7b:	cd 30                	int    $0x30
+  801c7d:	87 34 24             	xchg   %esi,(%esp)
+  801c80:	89 0e                	mov    %ecx,(%esi)
+  801c82:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801c85:	89 7e 08             	mov    %edi,0x8(%esi)
+  801c88:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801c8b:	8f 46 0c             	pop    0xc(%esi)
+  801c8e:	5d                   	pop    %ebp
+}
+  801c8f:	5b                   	pop    %ebx
+  801c90:	5e                   	pop    %esi
+  801c91:	5f                   	pop    %edi
+  801c92:	5d                   	pop    %ebp
+  801c93:	c3                   	ret
+
+00801c94 <sys_ipc_reply_wait>:
+{
+  801c94:	55                   	push   %ebp
+  801c95:	89 e5                	mov    %esp,%ebp
+  801c97:	57                   	push   %edi
+  801c98:	56                   	push   %esi
+  801c99:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801c9a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c9d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801ca2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801ca5:	55                   	push   %ebp
+  801ca6:	56                   	push   %esi
+  801ca7:	8b 0e                	mov    (%esi),%ecx
+  801ca9:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801cac:	8b 7e 08             	mov    0x8(%esi),%edi
+  801caf:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801cb2:	8b 76 0c             	mov    0xc(%esi),%esi
+  801cb5:	cd 30                	int    $0x30
+  801cb7:	87 34 24             	xchg   %esi,(%esp)
+  801cba:	89 0e                	mov    %ecx,(%esi)
+  801cbc:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801cbf:	89 7e 08             	mov    %edi,0x8(%esi)
+  801cc2:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801cc5:	8f 46 0c             	pop    0xc(%esi)
+  801cc8:	5d                   	pop    %ebp
+}
+  801cc9:	5b                   	pop    %ebx
+  801cca:	5e                   	pop    %esi
+  801ccb:	5f                   	pop    %edi
+  801ccc:	5d                   	pop    %ebp
+  801ccd:	c3                   	ret
+
+00801cce <sys_ipc_send_msg>:
+{
+  801cce:	55                   	push   %ebp
+  801ccf:	89 e5                	mov    %esp,%ebp
+  801cd1:	57                   	push   %edi
+  801cd2:	56                   	push   %esi
+  801cd3:	53                   	push   %ebx
+  801cd4:	83 ec 20             	sub    $0x20,%esp
+  801cd7:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801cda:	8b 10                	mov    (%eax),%edx
+  801cdc:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801cdf:	8b 50 04             	mov    0x4(%eax),%edx
+  801ce2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801ce5:	8b 50 08             	mov    0x8(%eax),%edx
+  801ce8:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801ceb:	8b 50 0c             	mov    0xc(%eax),%edx
+  801cee:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801cf1:	8b 40 10             	mov    0x10(%eax),%eax
+  801cf4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801cf7:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801cfa:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cfd:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801d02:	55                   	push   %ebp
+  801d03:	56                   	push   %esi
+  801d04:	8b 0e                	mov    (%esi),%ecx
+  801d06:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801d09:	8b 7e 08             	mov    0x8(%esi),%edi
+  801d0c:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801d0f:	8b 76 0c             	mov    0xc(%esi),%esi
+  801d12:	cd 30                	int    $0x30
+  801d14:	87 34 24             	xchg   %esi,(%esp)
+  801d17:	89 0e                	mov    %ecx,(%esi)
+  801d19:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801d1c:	89 7e 08             	mov    %edi,0x8(%esi)
+  801d1f:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801d22:	8f 46 0c             	pop    0xc(%esi)
+  801d25:	5d                   	pop    %ebp
+}
+  801d26:	83 c4 20             	add    $0x20,%esp
+  801d29:	5b                   	pop    %ebx
+  801d2a:	5e                   	pop    %esi
+  801d2b:	5f                   	pop    %edi
+  801d2c:	5d                   	pop    %ebp
+  801d2d:	c3                   	ret
+
+00801d2e <sys_fork>:
+{
+  801d2e:	55                   	push   %ebp
+  801d2f:	89 e5                	mov    %esp,%ebp
+  801d31:	57                   	push   %edi
+  801d32:	56                   	push   %esi
+  801d33:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801d34:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801d3b:	78 2e                	js     801d6b <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801d3d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801d44:	74 71                	je     801db7 <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801d46:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d4b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801d50:	89 d1                	mov    %edx,%ecx
+  801d52:	89 d3                	mov    %edx,%ebx
+  801d54:	89 d7                	mov    %edx,%edi
+  801d56:	89 d6                	mov    %edx,%esi
+  801d58:	55                   	push   %ebp
+  801d59:	68 62 1d 80 00       	push   $0x801d62
+  801d5e:	89 e5                	mov    %esp,%ebp
+  801d60:	0f 34                	sysenter
+  801d62:	83 c4 04             	add    $0x4,%esp
+  801d65:	5d                   	pop    %ebp
+}
+  801d66:	5b                   	pop    %ebx
+  801d67:	5e                   	pop    %esi
+  801d68:	5f                   	pop    %edi
+  801d69:	5d                   	pop    %ebp
+  801d6a:	c3                   	ret
+  801d6b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d70:	0f a2                	cpuid
+		return 0;
+  801d72:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801d77:	f6 c6 08             	test   $0x8,%dh
+  801d7a:	74 15                	je     801d91 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d7c:	89 c2                	mov    %eax,%edx
+  801d7e:	c1 ea 08             	shr    $0x8,%edx
+  801d81:	83 e2 0f             	and    $0xf,%edx
+  801d84:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d89:	83 fa 06             	cmp    $0x6,%edx
+  801d8c:	74 0e                	je     801d9c <sys_fork+0x6e>
+  801d8e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801d91:	0f b6 c9             	movzbl %cl,%ecx
+  801d94:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801d9a:	eb a1                	jmp    801d3d <sys_fork+0xf>
+  801d9c:	89 c2                	mov    %eax,%edx
+  801d9e:	c1 ea 04             	shr    $0x4,%edx
+  801da1:	83 e2 0f             	and    $0xf,%edx
+  801da4:	83 fa 02             	cmp    $0x2,%edx
+  801da7:	77 e5                	ja     801d8e <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801da9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801dac:	83 f8 02             	cmp    $0x2,%eax
+  801daf:	0f 97 c1             	seta   %cl
+  801db2:	0f b6 c9             	movzbl %cl,%ecx
+  801db5:	eb d7                	jmp    801d8e <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801db7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dbc:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801dc1:	89 d1                	mov    %edx,%ecx
+  801dc3:	89 d3                	mov    %edx,%ebx
+  801dc5:	89 d7                	mov    %edx,%edi
+  801dc7:	89 d6                	mov    %edx,%esi
+  801dc9:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801dcb:	eb 99                	jmp    801d66 <sys_fork+0x38>
+
+00801dcd <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801dcd:	55                   	push   %ebp
+  801dce:	89 e5                	mov    %esp,%ebp
+  801dd0:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801dd3:	ff 75 14             	push   0x14(%ebp)
+  801dd6:	ff 75 10             	push   0x10(%ebp)
+  801dd9:	ff 75 0c             	push   0xc(%ebp)
+  801ddc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801de1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801de4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801de9:	e8 81 ee ff ff       	call   800c6f <page_vec_call>
+}
+  801dee:	c9                   	leave
+  801def:	c3                   	ret
+
+00801df0 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801df0:	55                   	push   %ebp
+  801df1:	89 e5                	mov    %esp,%ebp
+  801df3:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801df6:	ff 75 18             	push   0x18(%ebp)
+  801df9:	ff 75 14             	push   0x14(%ebp)
+  801dfc:	ff 75 10             	push   0x10(%ebp)
+  801dff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e02:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e05:	b8 10 00 00 00       	mov    $0x10,%eax
+  801e0a:	e8 60 ee ff ff       	call   800c6f <page_vec_call>
+}
+  801e0f:	c9                   	leave
+  801e10:	c3                   	ret
+
+00801e11 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801e11:	55                   	push   %ebp
+  801e12:	89 e5                	mov    %esp,%ebp
+  801e14:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801e17:	ff 75 14             	push   0x14(%ebp)
+  801e1a:	ff 75 10             	push   0x10(%ebp)
+  801e1d:	ff 75 0c             	push   0xc(%ebp)
+  801e20:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e25:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e28:	b8 11 00 00 00       	mov    $0x11,%eax
+  801e2d:	e8 3d ee ff ff       	call   800c6f <page_vec_call>
+}
+  801e32:	c9                   	leave
+  801e33:	c3                   	ret
+
+00801e34 <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801e34:	55                   	push   %ebp
+  801e35:	89 e5                	mov    %esp,%ebp
+  801e37:	57                   	push   %edi
+  801e38:	56                   	push   %esi
+  801e39:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801e3a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801e41:	78 32                	js     801e75 <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801e43:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801e4a:	74 75                	je     801ec1 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801e4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e4f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e52:	b8 12 00 00 00       	mov    $0x12,%eax
+  801e57:	be 00 00 00 00       	mov    $0x0,%esi
+  801e5c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e5f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801e62:	55                   	push   %ebp
+  801e63:	68 6c 1e 80 00       	push   $0x801e6c
+  801e68:	89 e5                	mov    %esp,%ebp
+  801e6a:	0f 34                	sysenter
+  801e6c:	83 c4 04             	add    $0x4,%esp
+  801e6f:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801e70:	5b                   	pop    %ebx
+  801e71:	5e                   	pop    %esi
+  801e72:	5f                   	pop    %edi
+  801e73:	5d                   	pop    %ebp
+  801e74:	c3                   	ret
+  801e75:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e7a:	0f a2                	cpuid
+		return 0;
+  801e7c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801e81:	f6 c6 08             	test   $0x8,%dh
+  801e84:	74 15                	je     801e9b <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e86:	89 c2                	mov    %eax,%edx
+  801e88:	c1 ea 08             	shr    $0x8,%edx
+  801e8b:	83 e2 0f             	and    $0xf,%edx
+  801e8e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e93:	83 fa 06             	cmp    $0x6,%edx
+  801e96:	74 0e                	je     801ea6 <sys_vm_ranges+0x72>
+  801e98:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801e9b:	0f b6 c9             	movzbl %cl,%ecx
+  801e9e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801ea4:	eb 9d                	jmp    801e43 <sys_vm_ranges+0xf>
+  801ea6:	89 c2                	mov    %eax,%edx
+  801ea8:	c1 ea 04             	shr    $0x4,%edx
+  801eab:	83 e2 0f             	and    $0xf,%edx
+  801eae:	83 fa 02             	cmp    $0x2,%edx
+  801eb1:	77 e5                	ja     801e98 <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  801eb3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801eb6:	83 f8 02             	cmp    $0x2,%eax
+  801eb9:	0f 97 c1             	seta   %cl
+  801ebc:	0f b6 c9             	movzbl %cl,%ecx
+  801ebf:	eb d7                	jmp    801e98 <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801ec1:	b8 12 00 00 00       	mov    $0x12,%eax
+  801ec6:	be 00 00 00 00       	mov    $0x0,%esi
+  801ecb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ece:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ed1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ed4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ed7:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801ed9:	eb 95                	jmp    801e70 <sys_vm_ranges+0x3c>
+
+00801edb <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801edb:	55                   	push   %ebp
+  801edc:	89 e5                	mov    %esp,%ebp
+  801ede:	57                   	push   %edi
+  801edf:	56                   	push   %esi
+  801ee0:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801ee1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801ee8:	78 31                	js     801f1b <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801eea:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801ef1:	74 74                	je     801f67 <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801ef3:	be 00 00 00 00       	mov    $0x0,%esi
+  801ef8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801efb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801efe:	b8 14 00 00 00       	mov    $0x14,%eax
+  801f03:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f06:	89 f7                	mov    %esi,%edi
+  801f08:	55                   	push   %ebp
+  801f09:	68 12 1f 80 00       	push   $0x801f12
+  801f0e:	89 e5                	mov    %esp,%ebp
+  801f10:	0f 34                	sysenter
+  801f12:	83 c4 04             	add    $0x4,%esp
+  801f15:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801f16:	5b                   	pop    %ebx
+  801f17:	5e                   	pop    %esi
+  801f18:	5f                   	pop    %edi
+  801f19:	5d                   	pop    %ebp
+  801f1a:	c3                   	ret
+  801f1b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f20:	0f a2                	cpuid
+		return 0;
+  801f22:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801f27:	f6 c6 08             	test   $0x8,%dh
+  801f2a:	74 15                	je     801f41 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f2c:	89 c2                	mov    %eax,%edx
+  801f2e:	c1 ea 08             	shr    $0x8,%edx
+  801f31:	83 e2 0f             	and    $0xf,%edx
+  801f34:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f39:	83 fa 06             	cmp    $0x6,%edx
+  801f3c:	74 0e                	je     801f4c <sys_spawn+0x71>
+  801f3e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801f41:	0f b6 c9             	movzbl %cl,%ecx
+  801f44:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801f4a:	eb 9e                	jmp    801eea <sys_spawn+0xf>
+  801f4c:	89 c2                	mov    %eax,%edx
+  801f4e:	c1 ea 04             	shr    $0x4,%edx
+  801f51:	83 e2 0f             	and    $0xf,%edx
+  801f54:	83 fa 02             	cmp    $0x2,%edx
+  801f57:	77 e5                	ja     801f3e <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  801f59:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f5c:	83 f8 02             	cmp    $0x2,%eax
+  801f5f:	0f 97 c1             	seta   %cl
+  801f62:	0f b6 c9             	movzbl %cl,%ecx
+  801f65:	eb d7                	jmp    801f3e <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  801f67:	be 00 00 00 00       	mov    $0x0,%esi
+  801f6c:	b8 14 00 00 00       	mov    $0x14,%eax
+  801f71:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f74:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f77:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f7a:	89 f7                	mov    %esi,%edi
+  801f7c:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  801f7e:	eb 96                	jmp    801f16 <sys_spawn+0x3b>
+
+00801f80 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  801f80:	55                   	push   %ebp
+  801f81:	89 e5                	mov    %esp,%ebp
+  801f83:	57                   	push   %edi
+  801f84:	56                   	push   %esi
+  801f85:	53                   	push   %ebx
+  801f86:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801f89:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801f90:	78 37                	js     801fc9 <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  801f92:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801f99:	74 7a                	je     802015 <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  801f9b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fa0:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fa3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fa6:	b8 15 00 00 00       	mov    $0x15,%eax
+  801fab:	89 df                	mov    %ebx,%edi
+  801fad:	89 de                	mov    %ebx,%esi
+  801faf:	55                   	push   %ebp
+  801fb0:	68 b9 1f 80 00       	push   $0x801fb9
+  801fb5:	89 e5                	mov    %esp,%ebp
+  801fb7:	0f 34                	sysenter
+  801fb9:	83 c4 04             	add    $0x4,%esp
+  801fbc:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801fbd:	85 c0                	test   %eax,%eax
+  801fbf:	7f 6c                	jg     80202d <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  801fc1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fc4:	5b                   	pop    %ebx
+  801fc5:	5e                   	pop    %esi
+  801fc6:	5f                   	pop    %edi
+  801fc7:	5d                   	pop    %ebp
+  801fc8:	c3                   	ret
+  801fc9:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fce:	0f a2                	cpuid
+		return 0;
+  801fd0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801fd5:	f6 c6 08             	test   $0x8,%dh
+  801fd8:	74 15                	je     801fef <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fda:	89 c2                	mov    %eax,%edx
+  801fdc:	c1 ea 08             	shr    $0x8,%edx
+  801fdf:	83 e2 0f             	and    $0xf,%edx
+  801fe2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801fe7:	83 fa 06             	cmp    $0x6,%edx
+  801fea:	74 0e                	je     801ffa <sys_shm_create+0x7a>
+  801fec:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801fef:	0f b6 c9             	movzbl %cl,%ecx
+  801ff2:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801ff8:	eb 98                	jmp    801f92 <sys_shm_create+0x12>
+  801ffa:	89 c2                	mov    %eax,%edx
+  801ffc:	c1 ea 04             	shr    $0x4,%edx
+  801fff:	83 e2 0f             	and    $0xf,%edx
+  802002:	83 fa 02             	cmp    $0x2,%edx
+  802005:	77 e5                	ja     801fec <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  802007:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80200a:	83 f8 02             	cmp    $0x2,%eax
+  80200d:	0f 97 c1             	seta   %cl
+  802010:	0f b6 c9             	movzbl %cl,%ecx
+  802013:	eb d7                	jmp    801fec <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  802015:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80201a:	b8 15 00 00 00       	mov    $0x15,%eax
+  80201f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802022:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802025:	89 df                	mov    %ebx,%edi
+  802027:	89 de                	mov    %ebx,%esi
+  802029:	cd 30                	int    $0x30
+  80202b:	eb 90                	jmp    801fbd <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80202d:	83 ec 0c             	sub    $0xc,%esp
+  802030:	50                   	push   %eax
+  802031:	6a 15                	push   $0x15
+  802033:	68 79 2d 80 00       	push   $0x802d79
+  802038:	6a 4a                	push   $0x4a
+  80203a:	68 96 2d 80 00       	push   $0x802d96
+  80203f:	e8 e5 e1 ff ff       	call   800229 <_panic>
+
+00802044 <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  802044:	55                   	push   %ebp
+  802045:	89 e5                	mov    %esp,%ebp
+  802047:	57                   	push   %edi
+  802048:	56                   	push   %esi
+  802049:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80204a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802051:	78 32                	js     802085 <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  802053:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80205a:	74 75                	je     8020d1 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  80205c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80205f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802062:	b8 16 00 00 00       	mov    $0x16,%eax
+  802067:	be 00 00 00 00       	mov    $0x0,%esi
+  80206c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80206f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802072:	55                   	push   %ebp
+  802073:	68 7c 20 80 00       	push   $0x80207c
+  802078:	89 e5                	mov    %esp,%ebp
+  80207a:	0f 34                	sysenter
+  80207c:	83 c4 04             	add    $0x4,%esp
+  80207f:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  802080:	5b                   	pop    %ebx
+  802081:	5e                   	pop    %esi
+  802082:	5f                   	pop    %edi
+  802083:	5d                   	pop    %ebp
+  802084:	c3                   	ret
+  802085:	b8 01 00 00 00       	mov    $0x1,%eax
+  80208a:	0f a2                	cpuid
+		return 0;
+  80208c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802091:	f6 c6 08             	test   $0x8,%dh
+  802094:	74 15                	je     8020ab <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802096:	89 c2                	mov    %eax,%edx
+  802098:	c1 ea 08             	shr    $0x8,%edx
+  80209b:	83 e2 0f             	and    $0xf,%edx
+  80209e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8020a3:	83 fa 06             	cmp    $0x6,%edx
+  8020a6:	74 0e                	je     8020b6 <sys_shm_attach+0x72>
+  8020a8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8020ab:	0f b6 c9             	movzbl %cl,%ecx
+  8020ae:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8020b4:	eb 9d                	jmp    802053 <sys_shm_attach+0xf>
+  8020b6:	89 c2                	mov    %eax,%edx
+  8020b8:	c1 ea 04             	shr    $0x4,%edx
+  8020bb:	83 e2 0f             	and    $0xf,%edx
+  8020be:	83 fa 02             	cmp    $0x2,%edx
+  8020c1:	77 e5                	ja     8020a8 <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  8020c3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020c6:	83 f8 02             	cmp    $0x2,%eax
+  8020c9:	0f 97 c1             	seta   %cl
+  8020cc:	0f b6 c9             	movzbl %cl,%ecx
+  8020cf:	eb d7                	jmp    8020a8 <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  8020d1:	b8 16 00 00 00       	mov    $0x16,%eax
+  8020d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8020db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020e1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8020e4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8020e7:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  8020e9:	eb 95                	jmp    802080 <sys_shm_attach+0x3c>
+
+008020eb <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  8020eb:	55                   	push   %ebp
+  8020ec:	89 e5                	mov    %esp,%ebp
+  8020ee:	57                   	push   %edi
+  8020ef:	56                   	push   %esi
+  8020f0:	53                   	push   %ebx
+  8020f1:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8020f4:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8020fb:	78 38                	js     802135 <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  8020fd:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802104:	74 7b                	je     802181 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  802106:	be 00 00 00 00       	mov    $0x0,%esi
+  80210b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80210e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802111:	b8 17 00 00 00       	mov    $0x17,%eax
+  802116:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802119:	89 f7                	mov    %esi,%edi
+  80211b:	55                   	push   %ebp
+  80211c:	68 25 21 80 00       	push   $0x802125
+  802121:	89 e5                	mov    %esp,%ebp
+  802123:	0f 34                	sysenter
+  802125:	83 c4 04             	add    $0x4,%esp
+  802128:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802129:	85 c0                	test   %eax,%eax
+  80212b:	7f 6d                	jg     80219a <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  80212d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802130:	5b                   	pop    %ebx
+  802131:	5e                   	pop    %esi
+  802132:	5f                   	pop    %edi
+  802133:	5d                   	pop    %ebp
+  802134:	c3                   	ret
+  802135:	b8 01 00 00 00       	mov    $0x1,%eax
+  80213a:	0f a2                	cpuid
+		return 0;
+  80213c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802141:	f6 c6 08             	test   $0x8,%dh
+  802144:	74 15                	je     80215b <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802146:	89 c2                	mov    %eax,%edx
+  802148:	c1 ea 08             	shr    $0x8,%edx
+  80214b:	83 e2 0f             	and    $0xf,%edx
+  80214e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802153:	83 fa 06             	cmp    $0x6,%edx
+  802156:	74 0e                	je     802166 <sys_shm_detach+0x7b>
+  802158:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80215b:	0f b6 c9             	movzbl %cl,%ecx
+  80215e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802164:	eb 97                	jmp    8020fd <sys_shm_detach+0x12>
+  802166:	89 c2                	mov    %eax,%edx
+  802168:	c1 ea 04             	shr    $0x4,%edx
+  80216b:	83 e2 0f             	and    $0xf,%edx
+  80216e:	83 fa 02             	cmp    $0x2,%edx
+  802171:	77 e5                	ja     802158 <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  802173:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802176:	83 f8 02             	cmp    $0x2,%eax
+  802179:	0f 97 c1             	seta   %cl
+  80217c:	0f b6 c9             	movzbl %cl,%ecx
+  80217f:	eb d7                	jmp    802158 <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  802181:	be 00 00 00 00       	mov    $0x0,%esi
+  802186:	b8 17 00 00 00       	mov    $0x17,%eax
+  80218b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80218e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802191:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802194:	89 f7                	mov    %esi,%edi
+  802196:	cd 30                	int    $0x30
+  802198:	eb 8f                	jmp    802129 <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80219a:	83 ec 0c             	sub    $0xc,%esp
+  80219d:	50                   	push   %eax
+  80219e:	6a 17                	push   $0x17
+  8021a0:	68 79 2d 80 00       	push   $0x802d79
+  8021a5:	6a 4a                	push   $0x4a
+  8021a7:	68 96 2d 80 00       	push   $0x802d96
+  8021ac:	e8 78 e0 ff ff       	call   800229 <_panic>
+
+008021b1 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  8021b1:	55                   	push   %ebp
+  8021b2:	89 e5                	mov    %esp,%ebp
+  8021b4:	57                   	push   %edi
+  8021b5:	56                   	push   %esi
+  8021b6:	53                   	push   %ebx
+  8021b7:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8021ba:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8021c1:	78 36                	js     8021f9 <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  8021c3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8021ca:	74 79                	je     802245 <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  8021cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021d4:	b8 18 00 00 00       	mov    $0x18,%eax
+  8021d9:	89 cb                	mov    %ecx,%ebx
+  8021db:	89 cf                	mov    %ecx,%edi
+  8021dd:	89 ce                	mov    %ecx,%esi
+  8021df:	55                   	push   %ebp
+  8021e0:	68 e9 21 80 00       	push   $0x8021e9
+  8021e5:	89 e5                	mov    %esp,%ebp
+  8021e7:	0f 34                	sysenter
+  8021e9:	83 c4 04             	add    $0x4,%esp
+  8021ec:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8021ed:	85 c0                	test   %eax,%eax
+  8021ef:	7f 6b                	jg     80225c <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  8021f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021f4:	5b                   	pop    %ebx
+  8021f5:	5e                   	pop    %esi
+  8021f6:	5f                   	pop    %edi
+  8021f7:	5d                   	pop    %ebp
+  8021f8:	c3                   	ret
+  8021f9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021fe:	0f a2                	cpuid
+		return 0;
+  802200:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802205:	f6 c6 08             	test   $0x8,%dh
+  802208:	74 15                	je     80221f <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80220a:	89 c2                	mov    %eax,%edx
+  80220c:	c1 ea 08             	shr    $0x8,%edx
+  80220f:	83 e2 0f             	and    $0xf,%edx
+  802212:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802217:	83 fa 06             	cmp    $0x6,%edx
+  80221a:	74 0e                	je     80222a <sys_shm_remove+0x79>
+  80221c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80221f:	0f b6 c9             	movzbl %cl,%ecx
+  802222:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802228:	eb 99                	jmp    8021c3 <sys_shm_remove+0x12>
+  80222a:	89 c2                	mov    %eax,%edx
+  80222c:	c1 ea 04             	shr    $0x4,%edx
+  80222f:	83 e2 0f             	and    $0xf,%edx
+  802232:	83 fa 02             	cmp    $0x2,%edx
+  802235:	77 e5                	ja     80221c <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  802237:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80223a:	83 f8 02             	cmp    $0x2,%eax
+  80223d:	0f 97 c1             	seta   %cl
+  802240:	0f b6 c9             	movzbl %cl,%ecx
+  802243:	eb d7                	jmp    80221c <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  802245:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80224a:	b8 18 00 00 00       	mov    $0x18,%eax
+  80224f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802252:	89 cb                	mov    %ecx,%ebx
+  802254:	89 cf                	mov    %ecx,%edi
+  802256:	89 ce                	mov    %ecx,%esi
+  802258:	cd 30                	int    $0x30
+  80225a:	eb 91                	jmp    8021ed <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80225c:	83 ec 0c             	sub    $0xc,%esp
+  80225f:	50                   	push   %eax
+  802260:	6a 18                	push   $0x18
+  802262:	68 79 2d 80 00       	push   $0x802d79
+  802267:	6a 4a                	push   $0x4a
+  802269:	68 96 2d 80 00       	push   $0x802d96
+  80226e:	e8 b6 df ff ff       	call   800229 <_panic>
+
+00802273 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  802273:	55                   	push   %ebp
+  802274:	89 e5                	mov    %esp,%ebp
+  802276:	57                   	push   %edi
+  802277:	56                   	push   %esi
+  802278:	53                   	push   %ebx
+  802279:	83 ec 0c             	sub    $0xc,%esp
+  80227c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80227f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802282:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  802285:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80228c:	78 32                	js     8022c0 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  80228e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802295:	74 75                	je     80230c <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  802297:	8b 55 08             	mov    0x8(%ebp),%edx
+  80229a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80229d:	b8 20 00 00 00       	mov    $0x20,%eax
+  8022a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8022a7:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8022aa:	55                   	push   %ebp
+  8022ab:	68 b4 22 80 00       	push   $0x8022b4
+  8022b0:	89 e5                	mov    %esp,%ebp
+  8022b2:	0f 34                	sysenter
+  8022b4:	83 c4 04             	add    $0x4,%esp
+  8022b7:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  8022b8:	83 c4 0c             	add    $0xc,%esp
+  8022bb:	5b                   	pop    %ebx
+  8022bc:	5e                   	pop    %esi
+  8022bd:	5f                   	pop    %edi
+  8022be:	5d                   	pop    %ebp
+  8022bf:	c3                   	ret
+  8022c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022c5:	0f a2                	cpuid
+		return 0;
+  8022c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8022cc:	f6 c6 08             	test   $0x8,%dh
+  8022cf:	74 15                	je     8022e6 <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022d1:	89 c2                	mov    %eax,%edx
+  8022d3:	c1 ea 08             	shr    $0x8,%edx
+  8022d6:	83 e2 0f             	and    $0xf,%edx
+  8022d9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8022de:	83 fa 06             	cmp    $0x6,%edx
+  8022e1:	74 0e                	je     8022f1 <sys_futex_wait+0x7e>
+  8022e3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8022e6:	0f b6 c9             	movzbl %cl,%ecx
+  8022e9:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8022ef:	eb 9d                	jmp    80228e <sys_futex_wait+0x1b>
+  8022f1:	89 c2                	mov    %eax,%edx
+  8022f3:	c1 ea 04             	shr    $0x4,%edx
+  8022f6:	83 e2 0f             	and    $0xf,%edx
+  8022f9:	83 fa 02             	cmp    $0x2,%edx
+  8022fc:	77 e5                	ja     8022e3 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  8022fe:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802301:	83 f8 02             	cmp    $0x2,%eax
+  802304:	0f 97 c1             	seta   %cl
+  802307:	0f b6 c9             	movzbl %cl,%ecx
+  80230a:	eb d7                	jmp    8022e3 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  80230c:	b8 20 00 00 00       	mov    $0x20,%eax
+  802311:	be 00 00 00 00       	mov    $0x0,%esi
+  802316:	8b 55 08             	mov    0x8(%ebp),%edx
+  802319:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80231c:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  80231f:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  802321:	eb 95                	jmp    8022b8 <sys_futex_wait+0x45>
+
+00802323 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  802323:	55                   	push   %ebp
+  802324:	89 e5                	mov    %esp,%ebp
+  802326:	57                   	push   %edi
+  802327:	56                   	push   %esi
+  802328:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802329:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802330:	78 30                	js     802362 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  802332:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802339:	74 73                	je     8023ae <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  80233b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802340:	8b 55 08             	mov    0x8(%ebp),%edx
+  802343:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802346:	b8 21 00 00 00       	mov    $0x21,%eax
+  80234b:	89 df                	mov    %ebx,%edi
+  80234d:	89 de                	mov    %ebx,%esi
+  80234f:	55                   	push   %ebp
+  802350:	68 59 23 80 00       	push   $0x802359
+  802355:	89 e5                	mov    %esp,%ebp
+  802357:	0f 34                	sysenter
+  802359:	83 c4 04             	add    $0x4,%esp
+  80235c:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80235d:	5b                   	pop    %ebx
+  80235e:	5e                   	pop    %esi
+  80235f:	5f                   	pop    %edi
+  802360:	5d                   	pop    %ebp
+  802361:	c3                   	ret
+  802362:	b8 01 00 00 00       	mov    $0x1,%eax
+  802367:	0f a2                	cpuid
+		return 0;
+  802369:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80236e:	f6 c6 08             	test   $0x8,%dh
+  802371:	74 15                	je     802388 <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802373:	89 c2                	mov    %eax,%edx
+  802375:	c1 ea 08             	shr    $0x8,%edx
+  802378:	83 e2 0f             	and    $0xf,%edx
+  80237b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802380:	83 fa 06             	cmp    $0x6,%edx
+  802383:	74 0e                	je     802393 <sys_futex_wake+0x70>
+  802385:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802388:	0f b6 c9             	movzbl %cl,%ecx
+  80238b:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802391:	eb 9f                	jmp    802332 <sys_futex_wake+0xf>
+  802393:	89 c2                	mov    %eax,%edx
+  802395:	c1 ea 04             	shr    $0x4,%edx
+  802398:	83 e2 0f             	and    $0xf,%edx
+  80239b:	83 fa 02             	cmp    $0x2,%edx
+  80239e:	77 e5                	ja     802385 <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  8023a0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023a3:	83 f8 02             	cmp    $0x2,%eax
+  8023a6:	0f 97 c1             	seta   %cl
+  8023a9:	0f b6 c9             	movzbl %cl,%ecx
+  8023ac:	eb d7                	jmp    802385 <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  8023ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023b3:	b8 21 00 00 00       	mov    $0x21,%eax
+  8023b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023be:	89 df                	mov    %ebx,%edi
+  8023c0:	89 de                	mov    %ebx,%esi
+  8023c2:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  8023c4:	eb 97                	jmp    80235d <sys_futex_wake+0x3a>
+
+008023c6 <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  8023c6:	55                   	push   %ebp
+  8023c7:	89 e5                	mov    %esp,%ebp
+  8023c9:	57                   	push   %edi
+  8023ca:	56                   	push   %esi
+  8023cb:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8023cc:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8023d3:	78 2e                	js     802403 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  8023d5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8023dc:	74 71                	je     80244f <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  8023de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023e3:	b8 22 00 00 00       	mov    $0x22,%eax
+  8023e8:	89 d1                	mov    %edx,%ecx
+  8023ea:	89 d3                	mov    %edx,%ebx
+  8023ec:	89 d7                	mov    %edx,%edi
+  8023ee:	89 d6                	mov    %edx,%esi
+  8023f0:	55                   	push   %ebp
+  8023f1:	68 fa 23 80 00       	push   $0x8023fa
+  8023f6:	89 e5                	mov    %esp,%ebp
+  8023f8:	0f 34                	sysenter
+  8023fa:	83 c4 04             	add    $0x4,%esp
+  8023fd:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  8023fe:	5b                   	pop    %ebx
+  8023ff:	5e                   	pop    %esi
+  802400:	5f                   	pop    %edi
+  802401:	5d                   	pop    %ebp
+  802402:	c3                   	ret
+  802403:	b8 01 00 00 00       	mov    $0x1,%eax
+  802408:	0f a2                	cpuid
+		return 0;
+  80240a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80240f:	f6 c6 08             	test   $0x8,%dh
+  802412:	74 15                	je     802429 <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802414:	89 c2                	mov    %eax,%edx
+  802416:	c1 ea 08             	shr    $0x8,%edx
+  802419:	83 e2 0f             	and    $0xf,%edx
+  80241c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802421:	83 fa 06             	cmp    $0x6,%edx
+  802424:	74 0e                	je     802434 <sys_ep_create+0x6e>
+  802426:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802429:	0f b6 c9             	movzbl %cl,%ecx
+  80242c:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802432:	eb a1                	jmp    8023d5 <sys_ep_create+0xf>
+  802434:	89 c2                	mov    %eax,%edx
+  802436:	c1 ea 04             	shr    $0x4,%edx
+  802439:	83 e2 0f             	and    $0xf,%edx
+  80243c:	83 fa 02             	cmp    $0x2,%edx
+  80243f:	77 e5                	ja     802426 <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  802441:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802444:	83 f8 02             	cmp    $0x2,%eax
+  802447:	0f 97 c1             	seta   %cl
+  80244a:	0f b6 c9             	movzbl %cl,%ecx
+  80244d:	eb d7                	jmp    802426 <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  80244f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802454:	b8 22 00 00 00       	mov    $0x22,%eax
+  802459:	89 d1                	mov    %edx,%ecx
+  80245b:	89 d3                	mov    %edx,%ebx
+  80245d:	89 d7                	mov    %edx,%edi
+  80245f:	89 d6                	mov    %edx,%esi
+  802461:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  802463:	eb 99                	jmp    8023fe <sys_ep_create+0x38>
+
+00802465 <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  802465:	55                   	push   %ebp
+  802466:	89 e5                	mov    %esp,%ebp
+  802468:	57                   	push   %edi
+  802469:	56                   	push   %esi
+  80246a:	53                   	push   %ebx
+  80246b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80246e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802475:	78 36                	js     8024ad <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  802477:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80247e:	74 79                	je     8024f9 <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  802480:	8b 55 08             	mov    0x8(%ebp),%edx
+  802483:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802488:	b8 23 00 00 00       	mov    $0x23,%eax
+  80248d:	89 cb                	mov    %ecx,%ebx
+  80248f:	89 cf                	mov    %ecx,%edi
+  802491:	89 ce                	mov    %ecx,%esi
+  802493:	55                   	push   %ebp
+  802494:	68 9d 24 80 00       	push   $0x80249d
+  802499:	89 e5                	mov    %esp,%ebp
+  80249b:	0f 34                	sysenter
+  80249d:	83 c4 04             	add    $0x4,%esp
+  8024a0:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8024a1:	85 c0                	test   %eax,%eax
+  8024a3:	7f 6b                	jg     802510 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  8024a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024a8:	5b                   	pop    %ebx
+  8024a9:	5e                   	pop    %esi
+  8024aa:	5f                   	pop    %edi
+  8024ab:	5d                   	pop    %ebp
+  8024ac:	c3                   	ret
+  8024ad:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024b2:	0f a2                	cpuid
+		return 0;
+  8024b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8024b9:	f6 c6 08             	test   $0x8,%dh
+  8024bc:	74 15                	je     8024d3 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8024be:	89 c2                	mov    %eax,%edx
+  8024c0:	c1 ea 08             	shr    $0x8,%edx
+  8024c3:	83 e2 0f             	and    $0xf,%edx
+  8024c6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8024cb:	83 fa 06             	cmp    $0x6,%edx
+  8024ce:	74 0e                	je     8024de <sys_ep_destroy+0x79>
+  8024d0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8024d3:	0f b6 c9             	movzbl %cl,%ecx
+  8024d6:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8024dc:	eb 99                	jmp    802477 <sys_ep_destroy+0x12>
+  8024de:	89 c2                	mov    %eax,%edx
+  8024e0:	c1 ea 04             	shr    $0x4,%edx
+  8024e3:	83 e2 0f             	and    $0xf,%edx
+  8024e6:	83 fa 02             	cmp    $0x2,%edx
+  8024e9:	77 e5                	ja     8024d0 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  8024eb:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8024ee:	83 f8 02             	cmp    $0x2,%eax
+  8024f1:	0f 97 c1             	seta   %cl
+  8024f4:	0f b6 c9             	movzbl %cl,%ecx
+  8024f7:	eb d7                	jmp    8024d0 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  8024f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024fe:	b8 23 00 00 00       	mov    $0x23,%eax
+  802503:	8b 55 08             	mov    0x8(%ebp),%edx
+  802506:	89 cb                	mov    %ecx,%ebx
+  802508:	89 cf                	mov    %ecx,%edi
+  80250a:	89 ce                	mov    %ecx,%esi
+  80250c:	cd 30                	int    $0x30
+  80250e:	eb 91                	jmp    8024a1 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802510:	83 ec 0c             	sub    $0xc,%esp
+  802513:	50                   	push   %eax
+  802514:	6a 23                	push   $0x23
+  802516:	68 79 2d 80 00       	push   $0x802d79
+  80251b:	6a 4a                	push   $0x4a
+  80251d:	68 96 2d 80 00       	push   $0x802d96
+  802522:	e8 02 dd ff ff       	call   800229 <_panic>
+
+00802527 <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  802527:	55                   	push   %ebp
+  802528:	89 e5                	mov    %esp,%ebp
+  80252a:	57                   	push   %edi
+  80252b:	56                   	push   %esi
+  80252c:	53                   	push   %ebx
+  80252d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802530:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802537:	78 37                	js     802570 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  802539:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802540:	74 7a                	je     8025bc <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  802542:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802547:	8b 55 08             	mov    0x8(%ebp),%edx
+  80254a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80254d:	b8 24 00 00 00       	mov    $0x24,%eax
+  802552:	89 df                	mov    %ebx,%edi
+  802554:	89 de                	mov    %ebx,%esi
+  802556:	55                   	push   %ebp
+  802557:	68 60 25 80 00       	push   $0x802560
+  80255c:	89 e5                	mov    %esp,%ebp
+  80255e:	0f 34                	sysenter
+  802560:	83 c4 04             	add    $0x4,%esp
+  802563:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802564:	85 c0                	test   %eax,%eax
+  802566:	7f 6c                	jg     8025d4 <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  802568:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80256b:	5b                   	pop    %ebx
+  80256c:	5e                   	pop    %esi
+  80256d:	5f                   	pop    %edi
+  80256e:	5d                   	pop    %ebp
+  80256f:	c3                   	ret
+  802570:	b8 01 00 00 00       	mov    $0x1,%eax
+  802575:	0f a2                	cpuid
+		return 0;
+  802577:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80257c:	f6 c6 08             	test   $0x8,%dh
+  80257f:	74 15                	je     802596 <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802581:	89 c2                	mov    %eax,%edx
+  802583:	c1 ea 08             	shr    $0x8,%edx
+  802586:	83 e2 0f             	and    $0xf,%edx
+  802589:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80258e:	83 fa 06             	cmp    $0x6,%edx
+  802591:	74 0e                	je     8025a1 <sys_ep_grant+0x7a>
+  802593:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802596:	0f b6 c9             	movzbl %cl,%ecx
+  802599:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80259f:	eb 98                	jmp    802539 <sys_ep_grant+0x12>
+  8025a1:	89 c2                	mov    %eax,%edx
+  8025a3:	c1 ea 04             	shr    $0x4,%edx
+  8025a6:	83 e2 0f             	and    $0xf,%edx
+  8025a9:	83 fa 02             	cmp    $0x2,%edx
+  8025ac:	77 e5                	ja     802593 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  8025ae:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025b1:	83 f8 02             	cmp    $0x2,%eax
+  8025b4:	0f 97 c1             	seta   %cl
+  8025b7:	0f b6 c9             	movzbl %cl,%ecx
+  8025ba:	eb d7                	jmp    802593 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  8025bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025c1:	b8 24 00 00 00       	mov    $0x24,%eax
+  8025c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025cc:	89 df                	mov    %ebx,%edi
+  8025ce:	89 de                	mov    %ebx,%esi
+  8025d0:	cd 30                	int    $0x30
+  8025d2:	eb 90                	jmp    802564 <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8025d4:	83 ec 0c             	sub    $0xc,%esp
+  8025d7:	50                   	push   %eax
+  8025d8:	6a 24                	push   $0x24
+  8025da:	68 79 2d 80 00       	push   $0x802d79
+  8025df:	6a 4a                	push   $0x4a
+  8025e1:	68 96 2d 80 00       	push   $0x802d96
+  8025e6:	e8 3e dc ff ff       	call   800229 <_panic>
+
+008025eb <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  8025eb:	55                   	push   %ebp
+  8025ec:	89 e5                	mov    %esp,%ebp
+  8025ee:	57                   	push   %edi
+  8025ef:	56                   	push   %esi
+  8025f0:	53                   	push   %ebx
+  8025f1:	83 ec 20             	sub    $0x20,%esp
+  8025f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  8025f7:	8b 10                	mov    (%eax),%edx
+  8025f9:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8025fc:	8b 50 04             	mov    0x4(%eax),%edx
+  8025ff:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802602:	8b 50 08             	mov    0x8(%eax),%edx
+  802605:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  802608:	8b 50 0c             	mov    0xc(%eax),%edx
+  80260b:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  80260e:	8b 40 10             	mov    0x10(%eax),%eax
+  802611:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  802614:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  802617:	8b 55 08             	mov    0x8(%ebp),%edx
+  80261a:	b8 25 00 00 00       	mov    $0x25,%eax
+  80261f:	55                   	push   %ebp
+  802620:	56                   	push   %esi
+  802621:	8b 0e                	mov    (%esi),%ecx
+  802623:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802626:	8b 7e 08             	mov    0x8(%esi),%edi
+  802629:	8b 6e 10             	mov    0x10(%esi),%ebp
+  80262c:	8b 76 0c             	mov    0xc(%esi),%esi
+  80262f:	cd 30                	int    $0x30
+  802631:	87 34 24             	xchg   %esi,(%esp)
+  802634:	89 0e                	mov    %ecx,(%esi)
+  802636:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802639:	89 7e 08             	mov    %edi,0x8(%esi)
+  80263c:	89 6e 10             	mov    %ebp,0x10(%esi)
+  80263f:	8f 46 0c             	pop    0xc(%esi)
+  802642:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  802643:	83 c4 20             	add    $0x20,%esp
+  802646:	5b                   	pop    %ebx
+  802647:	5e                   	pop    %esi
+  802648:	5f                   	pop    %edi
+  802649:	5d                   	pop    %ebp
+  80264a:	c3                   	ret
+
+0080264b <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  80264b:	55                   	push   %ebp
+  80264c:	89 e5                	mov    %esp,%ebp
+  80264e:	57                   	push   %edi
+  80264f:	56                   	push   %esi
+  802650:	53                   	push   %ebx
+  802651:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  802654:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802657:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  802659:	8b 55 08             	mov    0x8(%ebp),%edx
+  80265c:	b8 26 00 00 00       	mov    $0x26,%eax
+  802661:	55                   	push   %ebp
+  802662:	56                   	push   %esi
+  802663:	8b 0e                	mov    (%esi),%ecx
+  802665:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802668:	8b 7e 08             	mov    0x8(%esi),%edi
+  80266b:	8b 6e 10             	mov    0x10(%esi),%ebp
+  80266e:	8b 76 0c             	mov    0xc(%esi),%esi
+  802671:	cd 30                	int    $0x30
+  802673:	87 34 24             	xchg   %esi,(%esp)
+  802676:	89 0e                	mov    %ecx,(%esi)
+  802678:	89 5e 04             	mov    %ebx,0x4(%esi)
+  80267b:	89 7e 08             	mov    %edi,0x8(%esi)
+  80267e:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802681:	8f 46 0c             	pop    0xc(%esi)
+  802684:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  802685:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  802689:	74 0f                	je     80269a <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  80268b:	85 c0                	test   %eax,%eax
+  80268d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802692:	0f 48 d1             	cmovs  %ecx,%edx
+  802695:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  802698:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  80269a:	5b                   	pop    %ebx
+  80269b:	5e                   	pop    %esi
+  80269c:	5f                   	pop    %edi
+  80269d:	5d                   	pop    %ebp
+  80269e:	c3                   	ret
+
+0080269f <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  80269f:	55                   	push   %ebp
+  8026a0:	89 e5                	mov    %esp,%ebp
+  8026a2:	57                   	push   %edi
+  8026a3:	56                   	push   %esi
+  8026a4:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8026a5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8026ac:	78 2f                	js     8026dd <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  8026ae:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8026b5:	74 72                	je     802729 <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  8026b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8026ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026bf:	b8 27 00 00 00       	mov    $0x27,%eax
+  8026c4:	89 cb                	mov    %ecx,%ebx
+  8026c6:	89 cf                	mov    %ecx,%edi
+  8026c8:	89 ce                	mov    %ecx,%esi
+  8026ca:	55                   	push   %ebp
+  8026cb:	68 d4 26 80 00       	push   $0x8026d4
+  8026d0:	89 e5                	mov    %esp,%ebp
+  8026d2:	0f 34                	sysenter
+  8026d4:	83 c4 04             	add    $0x4,%esp
+  8026d7:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  8026d8:	5b                   	pop    %ebx
+  8026d9:	5e                   	pop    %esi
+  8026da:	5f                   	pop    %edi
+  8026db:	5d                   	pop    %ebp
+  8026dc:	c3                   	ret
+  8026dd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026e2:	0f a2                	cpuid
+		return 0;
+  8026e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8026e9:	f6 c6 08             	test   $0x8,%dh
+  8026ec:	74 15                	je     802703 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8026ee:	89 c2                	mov    %eax,%edx
+  8026f0:	c1 ea 08             	shr    $0x8,%edx
+  8026f3:	83 e2 0f             	and    $0xf,%edx
+  8026f6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8026fb:	83 fa 06             	cmp    $0x6,%edx
+  8026fe:	74 0e                	je     80270e <sys_sysring_setup+0x6f>
+  802700:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802703:	0f b6 c9             	movzbl %cl,%ecx
+  802706:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80270c:	eb a0                	jmp    8026ae <sys_sysring_setup+0xf>
+  80270e:	89 c2                	mov    %eax,%edx
+  802710:	c1 ea 04             	shr    $0x4,%edx
+  802713:	83 e2 0f             	and    $0xf,%edx
+  802716:	83 fa 02             	cmp    $0x2,%edx
+  802719:	77 e5                	ja     802700 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  80271b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80271e:	83 f8 02             	cmp    $0x2,%eax
+  802721:	0f 97 c1             	seta   %cl
+  802724:	0f b6 c9             	movzbl %cl,%ecx
+  802727:	eb d7                	jmp    802700 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  802729:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80272e:	b8 27 00 00 00       	mov    $0x27,%eax
+  802733:	8b 55 08             	mov    0x8(%ebp),%edx
+  802736:	89 cb                	mov    %ecx,%ebx
+  802738:	89 cf                	mov    %ecx,%edi
+  80273a:	89 ce                	mov    %ecx,%esi
+  80273c:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  80273e:	eb 98                	jmp    8026d8 <sys_sysring_setup+0x39>
+
+00802740 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  802740:	55                   	push   %ebp
+  802741:	89 e5                	mov    %esp,%ebp
+  802743:	57                   	push   %edi
+  802744:	56                   	push   %esi
+  802745:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802746:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80274d:	78 2e                	js     80277d <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  80274f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802756:	74 71                	je     8027c9 <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  802758:	ba 00 00 00 00       	mov    $0x0,%edx
+  80275d:	b8 28 00 00 00       	mov    $0x28,%eax
+  802762:	89 d1                	mov    %edx,%ecx
+  802764:	89 d3                	mov    %edx,%ebx
+  802766:	89 d7                	mov    %edx,%edi
+  802768:	89 d6                	mov    %edx,%esi
+  80276a:	55                   	push   %ebp
+  80276b:	68 74 27 80 00       	push   $0x802774
+  802770:	89 e5                	mov    %esp,%ebp
+  802772:	0f 34                	sysenter
+  802774:	83 c4 04             	add    $0x4,%esp
+  802777:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  802778:	5b                   	pop    %ebx
+  802779:	5e                   	pop    %esi
+  80277a:	5f                   	pop    %edi
+  80277b:	5d                   	pop    %ebp
+  80277c:	c3                   	ret
+  80277d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802782:	0f a2                	cpuid
+		return 0;
+  802784:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802789:	f6 c6 08             	test   $0x8,%dh
+  80278c:	74 15                	je     8027a3 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80278e:	89 c2                	mov    %eax,%edx
+  802790:	c1 ea 08             	shr    $0x8,%edx
+  802793:	83 e2 0f             	and    $0xf,%edx
+  802796:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80279b:	83 fa 06             	cmp    $0x6,%edx
+  80279e:	74 0e                	je     8027ae <sys_sysring_enter+0x6e>
+  8027a0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8027a3:	0f b6 c9             	movzbl %cl,%ecx
+  8027a6:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8027ac:	eb a1                	jmp    80274f <sys_sysring_enter+0xf>
+  8027ae:	89 c2                	mov    %eax,%edx
+  8027b0:	c1 ea 04             	shr    $0x4,%edx
+  8027b3:	83 e2 0f             	and    $0xf,%edx
+  8027b6:	83 fa 02             	cmp    $0x2,%edx
+  8027b9:	77 e5                	ja     8027a0 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  8027bb:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8027be:	83 f8 02             	cmp    $0x2,%eax
+  8027c1:	0f 97 c1             	seta   %cl
+  8027c4:	0f b6 c9             	movzbl %cl,%ecx
+  8027c7:	eb d7                	jmp    8027a0 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  8027c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027ce:	b8 28 00 00 00       	mov    $0x28,%eax
+  8027d3:	89 d1                	mov    %edx,%ecx
+  8027d5:	89 d3                	mov    %edx,%ebx
+  8027d7:	89 d7                	mov    %edx,%edi
+  8027d9:	89 d6                	mov    %edx,%esi
+  8027db:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  8027dd:	eb 99                	jmp    802778 <sys_sysring_enter+0x38>
+
+008027df <dm>:
+  8027df:	55                   	push   %ebp
+  8027e0:	57                   	push   %edi
+  8027e1:	56                   	push   %esi
+  8027e2:	53                   	push   %ebx
+  8027e3:	83 ec 24             	sub    $0x24,%esp
+  8027e6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8027ea:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8027ee:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8027f2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8027f6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8027fa:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8027fe:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802802:	b8 00 00 00 00       	mov    $0x0,%eax
+  802807:	ba 00 00 00 00       	mov    $0x0,%edx
+  80280c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802811:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802818:	00 
+  802819:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802820:	00 
+  802821:	89 fb                	mov    %edi,%ebx
+  802823:	eb 08                	jmp    80282d <dm+0x4e>
+  802825:	83 e9 01             	sub    $0x1,%ecx
+  802828:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80282b:	74 68                	je     802895 <dm+0xb6>
+  80282d:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802831:	01 c0                	add    %eax,%eax
+  802833:	89 c6                	mov    %eax,%esi
+  802835:	89 d7                	mov    %edx,%edi
+  802837:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80283b:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80283f:	0f ad d0             	shrd   %cl,%edx,%eax
+  802842:	d3 ea                	shr    %cl,%edx
+  802844:	f6 c1 20             	test   $0x20,%cl
+  802847:	74 04                	je     80284d <dm+0x6e>
+  802849:	89 d0                	mov    %edx,%eax
+  80284b:	31 d2                	xor    %edx,%edx
+  80284d:	83 e0 01             	and    $0x1,%eax
+  802850:	89 04 24             	mov    %eax,(%esp)
+  802853:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80285a:	00 
+  80285b:	8b 04 24             	mov    (%esp),%eax
+  80285e:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802862:	09 f0                	or     %esi,%eax
+  802864:	09 fa                	or     %edi,%edx
+  802866:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80286a:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80286e:	39 f0                	cmp    %esi,%eax
+  802870:	89 d5                	mov    %edx,%ebp
+  802872:	19 fd                	sbb    %edi,%ebp
+  802874:	72 af                	jb     802825 <dm+0x46>
+  802876:	29 f0                	sub    %esi,%eax
+  802878:	19 fa                	sbb    %edi,%edx
+  80287a:	89 cf                	mov    %ecx,%edi
+  80287c:	c1 ef 05             	shr    $0x5,%edi
+  80287f:	83 e7 01             	and    $0x1,%edi
+  802882:	89 fe                	mov    %edi,%esi
+  802884:	83 f6 01             	xor    $0x1,%esi
+  802887:	d3 e6                	shl    %cl,%esi
+  802889:	d3 e7                	shl    %cl,%edi
+  80288b:	09 74 24 18          	or     %esi,0x18(%esp)
+  80288f:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802893:	eb 90                	jmp    802825 <dm+0x46>
+  802895:	85 db                	test   %ebx,%ebx
+  802897:	74 05                	je     80289e <dm+0xbf>
+  802899:	89 03                	mov    %eax,(%ebx)
+  80289b:	89 53 04             	mov    %edx,0x4(%ebx)
+  80289e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8028a2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8028a6:	83 c4 24             	add    $0x24,%esp
+  8028a9:	5b                   	pop    %ebx
+  8028aa:	5e                   	pop    %esi
+  8028ab:	5f                   	pop    %edi
+  8028ac:	5d                   	pop    %ebp
+  8028ad:	c3                   	ret
+
+008028ae <__udivdi3>:
+  8028ae:	83 ec 08             	sub    $0x8,%esp
+  8028b1:	6a 00                	push   $0x0
+  8028b3:	ff 74 24 1c          	push   0x1c(%esp)
+  8028b7:	ff 74 24 1c          	push   0x1c(%esp)
+  8028bb:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8028bf:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8028c3:	e8 17 ff ff ff       	call   8027df <dm>
+  8028c8:	83 c4 14             	add    $0x14,%esp
+  8028cb:	c3                   	ret
+
+008028cc <__umoddi3>:
+  8028cc:	83 ec 18             	sub    $0x18,%esp
+  8028cf:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8028d3:	50                   	push   %eax
+  8028d4:	ff 74 24 2c          	push   0x2c(%esp)
+  8028d8:	ff 74 24 2c          	push   0x2c(%esp)
+  8028dc:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8028e0:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8028e4:	e8 f6 fe ff ff       	call   8027df <dm>
+  8028e9:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8028ed:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8028f1:	83 c4 24             	add    $0x24,%esp
+  8028f4:	c3                   	ret
+
+008028f5 <__divdi3>:
+  8028f5:	53                   	push   %ebx
+  8028f6:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8028fa:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8028fe:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  802902:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  802906:	85 d2                	test   %edx,%edx
+  802908:	78 15                	js     80291f <__divdi3+0x2a>
+  80290a:	85 db                	test   %ebx,%ebx
+  80290c:	78 34                	js     802942 <__divdi3+0x4d>
+  80290e:	83 ec 04             	sub    $0x4,%esp
+  802911:	6a 00                	push   $0x0
+  802913:	53                   	push   %ebx
+  802914:	51                   	push   %ecx
+  802915:	e8 c5 fe ff ff       	call   8027df <dm>
+  80291a:	83 c4 10             	add    $0x10,%esp
+  80291d:	eb 21                	jmp    802940 <__divdi3+0x4b>
+  80291f:	f7 d8                	neg    %eax
+  802921:	83 d2 00             	adc    $0x0,%edx
+  802924:	f7 da                	neg    %edx
+  802926:	85 db                	test   %ebx,%ebx
+  802928:	78 30                	js     80295a <__divdi3+0x65>
+  80292a:	83 ec 04             	sub    $0x4,%esp
+  80292d:	6a 00                	push   $0x0
+  80292f:	53                   	push   %ebx
+  802930:	51                   	push   %ecx
+  802931:	e8 a9 fe ff ff       	call   8027df <dm>
+  802936:	83 c4 10             	add    $0x10,%esp
+  802939:	f7 d8                	neg    %eax
+  80293b:	83 d2 00             	adc    $0x0,%edx
+  80293e:	f7 da                	neg    %edx
+  802940:	5b                   	pop    %ebx
+  802941:	c3                   	ret
+  802942:	83 ec 04             	sub    $0x4,%esp
+  802945:	6a 00                	push   $0x0
+  802947:	f7 d9                	neg    %ecx
+  802949:	83 d3 00             	adc    $0x0,%ebx
+  80294c:	f7 db                	neg    %ebx
+  80294e:	53                   	push   %ebx
+  80294f:	51                   	push   %ecx
+  802950:	e8 8a fe ff ff       	call   8027df <dm>
+  802955:	83 c4 10             	add    $0x10,%esp
+  802958:	eb df                	jmp    802939 <__divdi3+0x44>
+  80295a:	83 ec 04             	sub    $0x4,%esp
+  80295d:	6a 00                	push   $0x0
+  80295f:	f7 d9                	neg    %ecx
+  802961:	83 d3 00             	adc    $0x0,%ebx
+  802964:	f7 db                	neg    %ebx
+  802966:	53                   	push   %ebx
+  802967:	51                   	push   %ecx
+  802968:	e8 72 fe ff ff       	call   8027df <dm>
+  80296d:	83 c4 10             	add    $0x10,%esp
+  802970:	eb ce                	jmp    802940 <__divdi3+0x4b>
+
+00802972 <__moddi3>:
+  802972:	55                   	push   %ebp
+  802973:	57                   	push   %edi
+  802974:	56                   	push   %esi
+  802975:	53                   	push   %ebx
+  802976:	83 ec 18             	sub    $0x18,%esp
+  802979:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  80297d:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802981:	89 f1                	mov    %esi,%ecx
+  802983:	f7 d9                	neg    %ecx
+  802985:	89 da                	mov    %ebx,%edx
+  802987:	83 d2 00             	adc    $0x0,%edx
+  80298a:	f7 da                	neg    %edx
+  80298c:	0f 48 ce             	cmovs  %esi,%ecx
+  80298f:	0f 48 d3             	cmovs  %ebx,%edx
+  802992:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802996:	50                   	push   %eax
+  802997:	8b 74 24 38          	mov    0x38(%esp),%esi
+  80299b:	f7 de                	neg    %esi
+  80299d:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  8029a1:	83 d0 00             	adc    $0x0,%eax
+  8029a4:	f7 d8                	neg    %eax
+  8029a6:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  8029ab:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  8029b0:	50                   	push   %eax
+  8029b1:	56                   	push   %esi
+  8029b2:	89 c8                	mov    %ecx,%eax
+  8029b4:	e8 26 fe ff ff       	call   8027df <dm>
+  8029b9:	83 c4 10             	add    $0x10,%esp
+  8029bc:	85 db                	test   %ebx,%ebx
+  8029be:	78 10                	js     8029d0 <__moddi3+0x5e>
+  8029c0:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8029c4:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8029c8:	83 c4 14             	add    $0x14,%esp
+  8029cb:	5b                   	pop    %ebx
+  8029cc:	5e                   	pop    %esi
+  8029cd:	5f                   	pop    %edi
+  8029ce:	5d                   	pop    %ebp
+  8029cf:	c3                   	ret
+  8029d0:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8029d4:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8029d8:	f7 d8                	neg    %eax
+  8029da:	83 d2 00             	adc    $0x0,%edx
+  8029dd:	f7 da                	neg    %edx
+  8029df:	eb e7                	jmp    8029c8 <__moddi3+0x56>
@@ -0,0 +1,6333 @@
+
+obj/user/epserver:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 c2 02 00 00       	call   8002f3 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 6c             	sub    $0x6c,%esp
+	uint32_t count[NSERVICES];
+	struct ipc_msg msg;
+	envid_t kid, from;
+	int i, x, r;
+
+	for (i = 0; i < NSERVICES; i++) {
+  80003c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if ((eps[i] = sys_ep_create()) < 0)
+  800041:	e8 a5 24 00 00       	call   8024eb <sys_ep_create>
+  800046:	89 44 9d dc          	mov    %eax,-0x24(%ebp,%ebx,4)
+  80004a:	85 c0                	test   %eax,%eax
+  80004c:	78 78                	js     8000c6 <umain+0x93>
+			panic("sys_ep_create: %e", eps[i]);
+		count[i] = 0;
+  80004e:	c7 44 9d d0 00 00 00 	movl   $0x0,-0x30(%ebp,%ebx,4)
+  800055:	00 
+	for (i = 0; i < NSERVICES; i++) {
+  800056:	83 c3 01             	add    $0x1,%ebx
+  800059:	83 fb 03             	cmp    $0x3,%ebx
+  80005c:	75 e3                	jne    800041 <umain+0xe>
+	}
+
+	for (i = 0; i < NCLIENTS; i++) {
+  80005e:	bf 00 00 00 00       	mov    $0x0,%edi
+		if ((kid = fork()) < 0)
+  800063:	e8 4f 2b 00 00       	call   802bb7 <fork>
+  800068:	89 c3                	mov    %eax,%ebx
+  80006a:	85 c0                	test   %eax,%eax
+  80006c:	78 6a                	js     8000d8 <umain+0xa5>
+			panic("fork: %e", kid);
+		if (kid == 0) {
+  80006e:	74 7a                	je     8000ea <umain+0xb7>
+			client(i % NSERVICES, eps[(i + 1) % NSERVICES]);
+			return;
+		}
+		if ((r = sys_ep_grant(eps[i % NSERVICES], kid)) < 0)
+  800070:	b8 56 55 55 55       	mov    $0x55555556,%eax
+  800075:	f7 ef                	imul   %edi
+  800077:	89 f8                	mov    %edi,%eax
+  800079:	c1 f8 1f             	sar    $0x1f,%eax
+  80007c:	29 c2                	sub    %eax,%edx
+  80007e:	8d 04 52             	lea    (%edx,%edx,2),%eax
+  800081:	89 fe                	mov    %edi,%esi
+  800083:	29 c6                	sub    %eax,%esi
+  800085:	83 ec 08             	sub    $0x8,%esp
+  800088:	53                   	push   %ebx
+  800089:	ff 74 b5 dc          	push   -0x24(%ebp,%esi,4)
+  80008d:	e8 ba 25 00 00       	call   80264c <sys_ep_grant>
+  800092:	83 c4 10             	add    $0x10,%esp
+  800095:	85 c0                	test   %eax,%eax
+  800097:	0f 88 58 01 00 00    	js     8001f5 <umain+0x1c2>
+			panic("sys_ep_grant: %e", r);
+		ipc_send(kid, eps[i % NSERVICES], 0, 0);
+  80009d:	6a 00                	push   $0x0
+  80009f:	6a 00                	push   $0x0
+  8000a1:	ff 74 b5 dc          	push   -0x24(%ebp,%esi,4)
+  8000a5:	53                   	push   %ebx
+  8000a6:	e8 cd 2b 00 00       	call   802c78 <ipc_send>
+	for (i = 0; i < NCLIENTS; i++) {
+  8000ab:	83 c7 01             	add    $0x1,%edi
+  8000ae:	83 c4 10             	add    $0x10,%esp
+  8000b1:	83 ff 06             	cmp    $0x6,%edi
+  8000b4:	75 ad                	jne    800063 <umain+0x30>
+  8000b6:	bb 59 02 00 00       	mov    $0x259,%ebx
+	}
+
+	for (i = 0; i < NCLIENTS * NREQUESTS; i++) {
+		if ((epid = sys_ep_recv(eps, NSERVICES, &msg, &from)) < 0)
+  8000bb:	8d 7d b8             	lea    -0x48(%ebp),%edi
+  8000be:	8d 75 bc             	lea    -0x44(%ebp),%esi
+  8000c1:	e9 73 01 00 00       	jmp    800239 <umain+0x206>
+			panic("sys_ep_create: %e", eps[i]);
+  8000c6:	50                   	push   %eax
+  8000c7:	68 40 31 80 00       	push   $0x803140
+  8000cc:	6a 43                	push   $0x43
+  8000ce:	68 52 31 80 00       	push   $0x803152
+  8000d3:	e8 76 02 00 00       	call   80034e <_panic>
+			panic("fork: %e", kid);
+  8000d8:	50                   	push   %eax
+  8000d9:	68 62 31 80 00       	push   $0x803162
+  8000de:	6a 49                	push   $0x49
+  8000e0:	68 52 31 80 00       	push   $0x803152
+  8000e5:	e8 64 02 00 00       	call   80034e <_panic>
+			client(i % NSERVICES, eps[(i + 1) % NSERVICES]);
+  8000ea:	8d 77 01             	lea    0x1(%edi),%esi
+  8000ed:	b9 56 55 55 55       	mov    $0x55555556,%ecx
+  8000f2:	89 f0                	mov    %esi,%eax
+  8000f4:	f7 e9                	imul   %ecx
+  8000f6:	89 f0                	mov    %esi,%eax
+  8000f8:	c1 f8 1f             	sar    $0x1f,%eax
+  8000fb:	29 c2                	sub    %eax,%edx
+  8000fd:	8d 04 52             	lea    (%edx,%edx,2),%eax
+  800100:	29 c6                	sub    %eax,%esi
+  800102:	8b 44 b5 dc          	mov    -0x24(%ebp,%esi,4),%eax
+  800106:	89 45 90             	mov    %eax,-0x70(%ebp)
+  800109:	89 f8                	mov    %edi,%eax
+  80010b:	f7 e9                	imul   %ecx
+  80010d:	89 f8                	mov    %edi,%eax
+  80010f:	c1 f8 1f             	sar    $0x1f,%eax
+  800112:	29 c2                	sub    %eax,%edx
+  800114:	8d 04 52             	lea    (%edx,%edx,2),%eax
+  800117:	29 c7                	sub    %eax,%edi
+  800119:	89 fe                	mov    %edi,%esi
+	epid = ipc_recv(&server, 0, 0);
+  80011b:	83 ec 04             	sub    $0x4,%esp
+  80011e:	6a 00                	push   $0x0
+  800120:	6a 00                	push   $0x0
+  800122:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  800125:	50                   	push   %eax
+  800126:	e8 db 2a 00 00       	call   802c06 <ipc_recv>
+  80012b:	89 45 94             	mov    %eax,-0x6c(%ebp)
+	memset(&msg, 0, sizeof(msg));
+  80012e:	83 c4 0c             	add    $0xc,%esp
+  800131:	6a 14                	push   $0x14
+  800133:	6a 00                	push   $0x0
+  800135:	8d 7d a4             	lea    -0x5c(%ebp),%edi
+  800138:	57                   	push   %edi
+  800139:	e8 63 0a 00 00       	call   800ba1 <memset>
+	if ((r = sys_ep_send(other, &msg)) != -E_NOT_FOUND)
+  80013e:	83 c4 08             	add    $0x8,%esp
+  800141:	57                   	push   %edi
+  800142:	ff 75 90             	push   -0x70(%ebp)
+  800145:	e8 c6 25 00 00       	call   802710 <sys_ep_send>
+  80014a:	83 c4 10             	add    $0x10,%esp
+  80014d:	83 f8 f6             	cmp    $0xfffffff6,%eax
+  800150:	74 3a                	je     80018c <umain+0x159>
+		panic("sent on an endpoint we were not granted: %e", r);
+  800152:	50                   	push   %eax
+  800153:	68 c8 31 80 00       	push   $0x8031c8
+  800158:	6a 2a                	push   $0x2a
+  80015a:	68 52 31 80 00       	push   $0x803152
+  80015f:	e8 ea 01 00 00       	call   80034e <_panic>
+			panic("ep_send: %e", r);
+  800164:	50                   	push   %eax
+  800165:	68 6b 31 80 00       	push   $0x80316b
+  80016a:	6a 30                	push   $0x30
+  80016c:	68 52 31 80 00       	push   $0x803152
+  800171:	e8 d8 01 00 00       	call   80034e <_panic>
+		return msg->m_w[0] + msg->m_w[1];
+  800176:	8b 55 a8             	mov    -0x58(%ebp),%edx
+  800179:	03 55 a4             	add    -0x5c(%ebp),%edx
+		if (reply != serve(service, &msg))
+  80017c:	39 d0                	cmp    %edx,%eax
+  80017e:	75 53                	jne    8001d3 <umain+0x1a0>
+	for (i = 0; i < NREQUESTS; i++) {
+  800180:	83 c3 01             	add    $0x1,%ebx
+  800183:	83 fb 64             	cmp    $0x64,%ebx
+  800186:	0f 84 36 01 00 00    	je     8002c2 <umain+0x28f>
+		msg.m_w[0] = i;
+  80018c:	89 5d a4             	mov    %ebx,-0x5c(%ebp)
+		msg.m_w[1] = i + 3;
+  80018f:	8d 43 03             	lea    0x3(%ebx),%eax
+  800192:	89 45 a8             	mov    %eax,-0x58(%ebp)
+		if ((r = ep_send(epid, &msg)) < 0)
+  800195:	83 ec 08             	sub    $0x8,%esp
+  800198:	57                   	push   %edi
+  800199:	ff 75 94             	push   -0x6c(%ebp)
+  80019c:	e8 8d 2c 00 00       	call   802e2e <ep_send>
+  8001a1:	83 c4 10             	add    $0x10,%esp
+  8001a4:	85 c0                	test   %eax,%eax
+  8001a6:	78 bc                	js     800164 <umain+0x131>
+		reply = ipc_recv(0, 0, 0);
+  8001a8:	83 ec 04             	sub    $0x4,%esp
+  8001ab:	6a 00                	push   $0x0
+  8001ad:	6a 00                	push   $0x0
+  8001af:	6a 00                	push   $0x0
+  8001b1:	e8 50 2a 00 00       	call   802c06 <ipc_recv>
+	switch (service) {
+  8001b6:	83 c4 10             	add    $0x10,%esp
+  8001b9:	85 f6                	test   %esi,%esi
+  8001bb:	74 b9                	je     800176 <umain+0x143>
+  8001bd:	83 fe 01             	cmp    $0x1,%esi
+  8001c0:	74 08                	je     8001ca <umain+0x197>
+		return msg->m_w[0] ^ msg->m_w[1];
+  8001c2:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  8001c5:	33 55 a8             	xor    -0x58(%ebp),%edx
+  8001c8:	eb b2                	jmp    80017c <umain+0x149>
+		return msg->m_w[0] * msg->m_w[1];
+  8001ca:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  8001cd:	0f af 55 a8          	imul   -0x58(%ebp),%edx
+  8001d1:	eb a9                	jmp    80017c <umain+0x149>
+			panic("%s(%d, %d) = %d", service_names[service],
+  8001d3:	83 ec 04             	sub    $0x4,%esp
+  8001d6:	50                   	push   %eax
+  8001d7:	ff 75 a8             	push   -0x58(%ebp)
+  8001da:	ff 75 a4             	push   -0x5c(%ebp)
+  8001dd:	ff 34 b5 18 32 80 00 	push   0x803218(,%esi,4)
+  8001e4:	68 77 31 80 00       	push   $0x803177
+  8001e9:	6a 33                	push   $0x33
+  8001eb:	68 52 31 80 00       	push   $0x803152
+  8001f0:	e8 59 01 00 00       	call   80034e <_panic>
+			panic("sys_ep_grant: %e", r);
+  8001f5:	50                   	push   %eax
+  8001f6:	68 87 31 80 00       	push   $0x803187
+  8001fb:	6a 4f                	push   $0x4f
+  8001fd:	68 52 31 80 00       	push   $0x803152
+  800202:	e8 47 01 00 00       	call   80034e <_panic>
+			panic("sys_ep_recv: %e", epid);
+		for (x = 0; x < NSERVICES && eps[x] != epid; x++)
+  800207:	b8 02 00 00 00       	mov    $0x2,%eax
+  80020c:	e9 be 00 00 00       	jmp    8002cf <umain+0x29c>
+			panic("sys_ep_recv: %e", epid);
+  800211:	50                   	push   %eax
+  800212:	68 98 31 80 00       	push   $0x803198
+  800217:	6a 55                	push   $0x55
+  800219:	68 52 31 80 00       	push   $0x803152
+  80021e:	e8 2b 01 00 00       	call   80034e <_panic>
+		return msg->m_w[0] + msg->m_w[1];
+  800223:	8b 45 c0             	mov    -0x40(%ebp),%eax
+  800226:	03 45 bc             	add    -0x44(%ebp),%eax
+			;
+		if (x == NSERVICES)
+			panic("sys_ep_recv: unknown endpoint %x", epid);
+		count[x]++;
+		ipc_send(from, serve(x, &msg), 0, 0);
+  800229:	6a 00                	push   $0x0
+  80022b:	6a 00                	push   $0x0
+  80022d:	50                   	push   %eax
+  80022e:	ff 75 b8             	push   -0x48(%ebp)
+  800231:	e8 42 2a 00 00       	call   802c78 <ipc_send>
+  800236:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NCLIENTS * NREQUESTS; i++) {
+  800239:	83 eb 01             	sub    $0x1,%ebx
+  80023c:	74 42                	je     800280 <umain+0x24d>
+		if ((epid = sys_ep_recv(eps, NSERVICES, &msg, &from)) < 0)
+  80023e:	57                   	push   %edi
+  80023f:	56                   	push   %esi
+  800240:	6a 03                	push   $0x3
+  800242:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  800245:	50                   	push   %eax
+  800246:	e8 25 25 00 00       	call   802770 <sys_ep_recv>
+  80024b:	83 c4 10             	add    $0x10,%esp
+  80024e:	85 c0                	test   %eax,%eax
+  800250:	78 bf                	js     800211 <umain+0x1de>
+		for (x = 0; x < NSERVICES && eps[x] != epid; x++)
+  800252:	3b 45 dc             	cmp    -0x24(%ebp),%eax
+  800255:	74 73                	je     8002ca <umain+0x297>
+  800257:	3b 45 e0             	cmp    -0x20(%ebp),%eax
+  80025a:	0f 84 8c 00 00 00    	je     8002ec <umain+0x2b9>
+  800260:	3b 45 e4             	cmp    -0x1c(%ebp),%eax
+  800263:	74 a2                	je     800207 <umain+0x1d4>
+			panic("sys_ep_recv: unknown endpoint %x", epid);
+  800265:	50                   	push   %eax
+  800266:	68 f4 31 80 00       	push   $0x8031f4
+  80026b:	6a 59                	push   $0x59
+  80026d:	68 52 31 80 00       	push   $0x803152
+  800272:	e8 d7 00 00 00       	call   80034e <_panic>
+		return msg->m_w[0] * msg->m_w[1];
+  800277:	8b 45 bc             	mov    -0x44(%ebp),%eax
+  80027a:	0f af 45 c0          	imul   -0x40(%ebp),%eax
+  80027e:	eb a9                	jmp    800229 <umain+0x1f6>
+	}
+
+	for (i = 0; i < NSERVICES; i++)
+		cprintf("%s: %d requests\n", service_names[i], count[i]);
+  800280:	83 ec 04             	sub    $0x4,%esp
+  800283:	ff 75 d0             	push   -0x30(%ebp)
+  800286:	68 a8 31 80 00       	push   $0x8031a8
+  80028b:	68 ac 31 80 00       	push   $0x8031ac
+  800290:	e8 cd 01 00 00       	call   800462 <cprintf>
+  800295:	83 c4 0c             	add    $0xc,%esp
+  800298:	ff 75 d4             	push   -0x2c(%ebp)
+  80029b:	68 bd 31 80 00       	push   $0x8031bd
+  8002a0:	68 ac 31 80 00       	push   $0x8031ac
+  8002a5:	e8 b8 01 00 00       	call   800462 <cprintf>
+  8002aa:	83 c4 0c             	add    $0xc,%esp
+  8002ad:	ff 75 d8             	push   -0x28(%ebp)
+  8002b0:	68 c1 31 80 00       	push   $0x8031c1
+  8002b5:	68 ac 31 80 00       	push   $0x8031ac
+  8002ba:	e8 a3 01 00 00       	call   800462 <cprintf>
+	for (i = 0; i < NSERVICES; i++)
+  8002bf:	83 c4 10             	add    $0x10,%esp
+}
+  8002c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002c5:	5b                   	pop    %ebx
+  8002c6:	5e                   	pop    %esi
+  8002c7:	5f                   	pop    %edi
+  8002c8:	5d                   	pop    %ebp
+  8002c9:	c3                   	ret
+		for (x = 0; x < NSERVICES && eps[x] != epid; x++)
+  8002ca:	b8 00 00 00 00       	mov    $0x0,%eax
+		count[x]++;
+  8002cf:	83 44 85 d0 01       	addl   $0x1,-0x30(%ebp,%eax,4)
+	switch (service) {
+  8002d4:	85 c0                	test   %eax,%eax
+  8002d6:	0f 84 47 ff ff ff    	je     800223 <umain+0x1f0>
+  8002dc:	83 f8 01             	cmp    $0x1,%eax
+  8002df:	74 96                	je     800277 <umain+0x244>
+		return msg->m_w[0] ^ msg->m_w[1];
+  8002e1:	8b 45 bc             	mov    -0x44(%ebp),%eax
+  8002e4:	33 45 c0             	xor    -0x40(%ebp),%eax
+  8002e7:	e9 3d ff ff ff       	jmp    800229 <umain+0x1f6>
+		for (x = 0; x < NSERVICES && eps[x] != epid; x++)
+  8002ec:	b8 01 00 00 00       	mov    $0x1,%eax
+  8002f1:	eb dc                	jmp    8002cf <umain+0x29c>
+
+008002f3 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8002f3:	55                   	push   %ebp
+  8002f4:	89 e5                	mov    %esp,%ebp
+  8002f6:	56                   	push   %esi
+  8002f7:	53                   	push   %ebx
+  8002f8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  8002fe:	e8 e3 0e 00 00       	call   8011e6 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  800303:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800308:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  80030e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800313:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800318:	85 db                	test   %ebx,%ebx
+  80031a:	7e 07                	jle    800323 <libmain+0x30>
+		binaryname = argv[0];
+  80031c:	8b 06                	mov    (%esi),%eax
+  80031e:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800323:	83 ec 08             	sub    $0x8,%esp
+  800326:	56                   	push   %esi
+  800327:	53                   	push   %ebx
+  800328:	e8 06 fd ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80032d:	e8 0a 00 00 00       	call   80033c <exit>
+}
+  800332:	83 c4 10             	add    $0x10,%esp
+  800335:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800338:	5b                   	pop    %ebx
+  800339:	5e                   	pop    %esi
+  80033a:	5d                   	pop    %ebp
+  80033b:	c3                   	ret
+
+0080033c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80033c:	55                   	push   %ebp
+  80033d:	89 e5                	mov    %esp,%ebp
+  80033f:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  800342:	6a 00                	push   $0x0
+  800344:	e8 db 0d 00 00       	call   801124 <sys_env_destroy>
+}
+  800349:	83 c4 10             	add    $0x10,%esp
+  80034c:	c9                   	leave
+  80034d:	c3                   	ret
+
+0080034e <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80034e:	55                   	push   %ebp
+  80034f:	89 e5                	mov    %esp,%ebp
+  800351:	57                   	push   %edi
+  800352:	56                   	push   %esi
+  800353:	53                   	push   %ebx
+  800354:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  80035a:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  80035d:	8b 1d 00 40 80 00    	mov    0x804000,%ebx
+  800363:	e8 7e 0e 00 00       	call   8011e6 <sys_getenvid>
+  800368:	83 ec 04             	sub    $0x4,%esp
+  80036b:	ff 75 0c             	push   0xc(%ebp)
+  80036e:	ff 75 08             	push   0x8(%ebp)
+  800371:	53                   	push   %ebx
+  800372:	50                   	push   %eax
+  800373:	68 30 32 80 00       	push   $0x803230
+  800378:	68 00 01 00 00       	push   $0x100
+  80037d:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  800383:	56                   	push   %esi
+  800384:	e8 72 06 00 00       	call   8009fb <snprintf>
+  800389:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  80038b:	83 c4 20             	add    $0x20,%esp
+  80038e:	57                   	push   %edi
+  80038f:	ff 75 10             	push   0x10(%ebp)
+  800392:	bf 00 01 00 00       	mov    $0x100,%edi
+  800397:	89 f8                	mov    %edi,%eax
+  800399:	29 d8                	sub    %ebx,%eax
+  80039b:	50                   	push   %eax
+  80039c:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  80039f:	50                   	push   %eax
+  8003a0:	e8 08 06 00 00       	call   8009ad <vsnprintf>
+  8003a5:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  8003a7:	83 c4 0c             	add    $0xc,%esp
+  8003aa:	68 bb 31 80 00       	push   $0x8031bb
+  8003af:	29 df                	sub    %ebx,%edi
+  8003b1:	57                   	push   %edi
+  8003b2:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8003b5:	50                   	push   %eax
+  8003b6:	e8 40 06 00 00       	call   8009fb <snprintf>
+	sys_cputs(buf, r);
+  8003bb:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  8003be:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  8003c0:	53                   	push   %ebx
+  8003c1:	56                   	push   %esi
+  8003c2:	e8 21 0c 00 00       	call   800fe8 <sys_cputs>
+  8003c7:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8003ca:	cc                   	int3
+	while (1)
+  8003cb:	eb fd                	jmp    8003ca <_panic+0x7c>
+
+008003cd <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8003cd:	55                   	push   %ebp
+  8003ce:	89 e5                	mov    %esp,%ebp
+  8003d0:	53                   	push   %ebx
+  8003d1:	83 ec 04             	sub    $0x4,%esp
+  8003d4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8003d7:	8b 13                	mov    (%ebx),%edx
+  8003d9:	8d 42 01             	lea    0x1(%edx),%eax
+  8003dc:	89 03                	mov    %eax,(%ebx)
+  8003de:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8003e1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8003e5:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8003ea:	74 09                	je     8003f5 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8003ec:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8003f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003f3:	c9                   	leave
+  8003f4:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8003f5:	83 ec 08             	sub    $0x8,%esp
+  8003f8:	68 ff 00 00 00       	push   $0xff
+  8003fd:	8d 43 08             	lea    0x8(%ebx),%eax
+  800400:	50                   	push   %eax
+  800401:	e8 e2 0b 00 00       	call   800fe8 <sys_cputs>
+		b->idx = 0;
+  800406:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80040c:	83 c4 10             	add    $0x10,%esp
+  80040f:	eb db                	jmp    8003ec <putch+0x1f>
+
+00800411 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800411:	55                   	push   %ebp
+  800412:	89 e5                	mov    %esp,%ebp
+  800414:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80041a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800421:	00 00 00 
+	b.cnt = 0;
+  800424:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80042b:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80042e:	ff 75 0c             	push   0xc(%ebp)
+  800431:	ff 75 08             	push   0x8(%ebp)
+  800434:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80043a:	50                   	push   %eax
+  80043b:	68 cd 03 80 00       	push   $0x8003cd
+  800440:	e8 14 01 00 00       	call   800559 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800445:	83 c4 08             	add    $0x8,%esp
+  800448:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80044e:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800454:	50                   	push   %eax
+  800455:	e8 8e 0b 00 00       	call   800fe8 <sys_cputs>
+
+	return b.cnt;
+}
+  80045a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800460:	c9                   	leave
+  800461:	c3                   	ret
+
+00800462 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800462:	55                   	push   %ebp
+  800463:	89 e5                	mov    %esp,%ebp
+  800465:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800468:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80046b:	50                   	push   %eax
+  80046c:	ff 75 08             	push   0x8(%ebp)
+  80046f:	e8 9d ff ff ff       	call   800411 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800474:	c9                   	leave
+  800475:	c3                   	ret
+
+00800476 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800476:	55                   	push   %ebp
+  800477:	89 e5                	mov    %esp,%ebp
+  800479:	57                   	push   %edi
+  80047a:	56                   	push   %esi
+  80047b:	53                   	push   %ebx
+  80047c:	83 ec 1c             	sub    $0x1c,%esp
+  80047f:	89 c7                	mov    %eax,%edi
+  800481:	89 d6                	mov    %edx,%esi
+  800483:	8b 45 08             	mov    0x8(%ebp),%eax
+  800486:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800489:	89 d1                	mov    %edx,%ecx
+  80048b:	89 c2                	mov    %eax,%edx
+  80048d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800490:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800493:	8b 45 10             	mov    0x10(%ebp),%eax
+  800496:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800499:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80049c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8004a3:	39 c2                	cmp    %eax,%edx
+  8004a5:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8004a8:	72 3e                	jb     8004e8 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8004aa:	83 ec 0c             	sub    $0xc,%esp
+  8004ad:	ff 75 18             	push   0x18(%ebp)
+  8004b0:	83 eb 01             	sub    $0x1,%ebx
+  8004b3:	53                   	push   %ebx
+  8004b4:	50                   	push   %eax
+  8004b5:	83 ec 08             	sub    $0x8,%esp
+  8004b8:	ff 75 e4             	push   -0x1c(%ebp)
+  8004bb:	ff 75 e0             	push   -0x20(%ebp)
+  8004be:	ff 75 dc             	push   -0x24(%ebp)
+  8004c1:	ff 75 d8             	push   -0x28(%ebp)
+  8004c4:	e8 2f 2b 00 00       	call   802ff8 <__udivdi3>
+  8004c9:	83 c4 18             	add    $0x18,%esp
+  8004cc:	52                   	push   %edx
+  8004cd:	50                   	push   %eax
+  8004ce:	89 f2                	mov    %esi,%edx
+  8004d0:	89 f8                	mov    %edi,%eax
+  8004d2:	e8 9f ff ff ff       	call   800476 <printnum>
+  8004d7:	83 c4 20             	add    $0x20,%esp
+  8004da:	eb 13                	jmp    8004ef <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8004dc:	83 ec 08             	sub    $0x8,%esp
+  8004df:	56                   	push   %esi
+  8004e0:	ff 75 18             	push   0x18(%ebp)
+  8004e3:	ff d7                	call   *%edi
+  8004e5:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8004e8:	83 eb 01             	sub    $0x1,%ebx
+  8004eb:	85 db                	test   %ebx,%ebx
+  8004ed:	7f ed                	jg     8004dc <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8004ef:	83 ec 08             	sub    $0x8,%esp
+  8004f2:	56                   	push   %esi
+  8004f3:	83 ec 04             	sub    $0x4,%esp
+  8004f6:	ff 75 e4             	push   -0x1c(%ebp)
+  8004f9:	ff 75 e0             	push   -0x20(%ebp)
+  8004fc:	ff 75 dc             	push   -0x24(%ebp)
+  8004ff:	ff 75 d8             	push   -0x28(%ebp)
+  800502:	e8 0f 2b 00 00       	call   803016 <__umoddi3>
+  800507:	83 c4 14             	add    $0x14,%esp
+  80050a:	0f be 80 53 32 80 00 	movsbl 0x803253(%eax),%eax
+  800511:	50                   	push   %eax
+  800512:	ff d7                	call   *%edi
+}
+  800514:	83 c4 10             	add    $0x10,%esp
+  800517:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80051a:	5b                   	pop    %ebx
+  80051b:	5e                   	pop    %esi
+  80051c:	5f                   	pop    %edi
+  80051d:	5d                   	pop    %ebp
+  80051e:	c3                   	ret
+
+0080051f <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80051f:	55                   	push   %ebp
+  800520:	89 e5                	mov    %esp,%ebp
+  800522:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800525:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800529:	8b 10                	mov    (%eax),%edx
+  80052b:	3b 50 04             	cmp    0x4(%eax),%edx
+  80052e:	73 0a                	jae    80053a <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800530:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800533:	89 08                	mov    %ecx,(%eax)
+  800535:	8b 45 08             	mov    0x8(%ebp),%eax
+  800538:	88 02                	mov    %al,(%edx)
+}
+  80053a:	5d                   	pop    %ebp
+  80053b:	c3                   	ret
+
+0080053c <printfmt>:
+{
+  80053c:	55                   	push   %ebp
+  80053d:	89 e5                	mov    %esp,%ebp
+  80053f:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800542:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800545:	50                   	push   %eax
+  800546:	ff 75 10             	push   0x10(%ebp)
+  800549:	ff 75 0c             	push   0xc(%ebp)
+  80054c:	ff 75 08             	push   0x8(%ebp)
+  80054f:	e8 05 00 00 00       	call   800559 <vprintfmt>
+}
+  800554:	83 c4 10             	add    $0x10,%esp
+  800557:	c9                   	leave
+  800558:	c3                   	ret
+
+00800559 <vprintfmt>:
+{
+  800559:	55                   	push   %ebp
+  80055a:	89 e5                	mov    %esp,%ebp
+  80055c:	57                   	push   %edi
+  80055d:	56                   	push   %esi
+  80055e:	53                   	push   %ebx
+  80055f:	83 ec 2c             	sub    $0x2c,%esp
+  800562:	8b 75 08             	mov    0x8(%ebp),%esi
+  800565:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800568:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80056b:	eb 0a                	jmp    800577 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80056d:	83 ec 08             	sub    $0x8,%esp
+  800570:	53                   	push   %ebx
+  800571:	50                   	push   %eax
+  800572:	ff d6                	call   *%esi
+  800574:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800577:	83 c7 01             	add    $0x1,%edi
+  80057a:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80057e:	83 f8 25             	cmp    $0x25,%eax
+  800581:	74 0c                	je     80058f <vprintfmt+0x36>
+			if (ch == '\0')
+  800583:	85 c0                	test   %eax,%eax
+  800585:	75 e6                	jne    80056d <vprintfmt+0x14>
+}
+  800587:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80058a:	5b                   	pop    %ebx
+  80058b:	5e                   	pop    %esi
+  80058c:	5f                   	pop    %edi
+  80058d:	5d                   	pop    %ebp
+  80058e:	c3                   	ret
+		padc = ' ';
+  80058f:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800593:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80059a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8005a1:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8005a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8005ad:	8d 47 01             	lea    0x1(%edi),%eax
+  8005b0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8005b3:	0f b6 17             	movzbl (%edi),%edx
+  8005b6:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8005b9:	3c 55                	cmp    $0x55,%al
+  8005bb:	0f 87 cf 03 00 00    	ja     800990 <vprintfmt+0x437>
+  8005c1:	0f b6 c0             	movzbl %al,%eax
+  8005c4:	ff 24 85 40 33 80 00 	jmp    *0x803340(,%eax,4)
+  8005cb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8005ce:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8005d2:	eb d9                	jmp    8005ad <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005d4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8005d7:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8005db:	eb d0                	jmp    8005ad <vprintfmt+0x54>
+  8005dd:	0f b6 d2             	movzbl %dl,%edx
+  8005e0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8005e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e8:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8005eb:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8005ee:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8005f2:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8005f5:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8005f8:	83 f9 09             	cmp    $0x9,%ecx
+  8005fb:	77 55                	ja     800652 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8005fd:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800600:	eb e9                	jmp    8005eb <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800602:	8b 45 14             	mov    0x14(%ebp),%eax
+  800605:	8b 00                	mov    (%eax),%eax
+  800607:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80060a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060d:	8d 40 04             	lea    0x4(%eax),%eax
+  800610:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800613:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800616:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80061a:	79 91                	jns    8005ad <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80061c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80061f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800622:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800629:	eb 82                	jmp    8005ad <vprintfmt+0x54>
+			if (width < 0)
+  80062b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80062e:	85 d2                	test   %edx,%edx
+  800630:	b8 00 00 00 00       	mov    $0x0,%eax
+  800635:	0f 49 c2             	cmovns %edx,%eax
+  800638:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80063b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80063e:	e9 6a ff ff ff       	jmp    8005ad <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800643:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800646:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80064d:	e9 5b ff ff ff       	jmp    8005ad <vprintfmt+0x54>
+  800652:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800655:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800658:	eb bc                	jmp    800616 <vprintfmt+0xbd>
+			lflag++;
+  80065a:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80065d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800660:	e9 48 ff ff ff       	jmp    8005ad <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800665:	8b 45 14             	mov    0x14(%ebp),%eax
+  800668:	8d 78 04             	lea    0x4(%eax),%edi
+  80066b:	83 ec 08             	sub    $0x8,%esp
+  80066e:	53                   	push   %ebx
+  80066f:	ff 30                	push   (%eax)
+  800671:	ff d6                	call   *%esi
+			break;
+  800673:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800676:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800679:	e9 b1 02 00 00       	jmp    80092f <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  80067e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800681:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800684:	8b 10                	mov    (%eax),%edx
+  800686:	89 d0                	mov    %edx,%eax
+  800688:	f7 d8                	neg    %eax
+  80068a:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80068d:	83 f8 0d             	cmp    $0xd,%eax
+  800690:	7f 23                	jg     8006b5 <vprintfmt+0x15c>
+  800692:	8b 14 85 a0 34 80 00 	mov    0x8034a0(,%eax,4),%edx
+  800699:	85 d2                	test   %edx,%edx
+  80069b:	74 18                	je     8006b5 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80069d:	52                   	push   %edx
+  80069e:	68 74 32 80 00       	push   $0x803274
+  8006a3:	53                   	push   %ebx
+  8006a4:	56                   	push   %esi
+  8006a5:	e8 92 fe ff ff       	call   80053c <printfmt>
+  8006aa:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006ad:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8006b0:	e9 7a 02 00 00       	jmp    80092f <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8006b5:	50                   	push   %eax
+  8006b6:	68 6b 32 80 00       	push   $0x80326b
+  8006bb:	53                   	push   %ebx
+  8006bc:	56                   	push   %esi
+  8006bd:	e8 7a fe ff ff       	call   80053c <printfmt>
+  8006c2:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006c5:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8006c8:	e9 62 02 00 00       	jmp    80092f <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d0:	83 c0 04             	add    $0x4,%eax
+  8006d3:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8006d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d9:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8006db:	85 c9                	test   %ecx,%ecx
+  8006dd:	b8 64 32 80 00       	mov    $0x803264,%eax
+  8006e2:	0f 45 c1             	cmovne %ecx,%eax
+  8006e5:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8006e8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8006ec:	7e 06                	jle    8006f4 <vprintfmt+0x19b>
+  8006ee:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8006f2:	75 0b                	jne    8006ff <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006f4:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8006f7:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8006fa:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006fd:	eb 5c                	jmp    80075b <vprintfmt+0x202>
+  8006ff:	83 ec 08             	sub    $0x8,%esp
+  800702:	ff 75 d0             	push   -0x30(%ebp)
+  800705:	ff 75 cc             	push   -0x34(%ebp)
+  800708:	e8 20 03 00 00       	call   800a2d <strnlen>
+  80070d:	89 c2                	mov    %eax,%edx
+  80070f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800712:	29 d0                	sub    %edx,%eax
+  800714:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800717:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80071b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80071e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800721:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800723:	eb 0e                	jmp    800733 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800725:	83 ec 08             	sub    $0x8,%esp
+  800728:	53                   	push   %ebx
+  800729:	57                   	push   %edi
+  80072a:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80072d:	83 ee 01             	sub    $0x1,%esi
+  800730:	83 c4 10             	add    $0x10,%esp
+  800733:	85 f6                	test   %esi,%esi
+  800735:	7f ee                	jg     800725 <vprintfmt+0x1cc>
+  800737:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80073a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80073d:	85 c0                	test   %eax,%eax
+  80073f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800744:	0f 49 d0             	cmovns %eax,%edx
+  800747:	29 d0                	sub    %edx,%eax
+  800749:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80074c:	eb a6                	jmp    8006f4 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80074e:	83 ec 08             	sub    $0x8,%esp
+  800751:	53                   	push   %ebx
+  800752:	52                   	push   %edx
+  800753:	ff 55 08             	call   *0x8(%ebp)
+  800756:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800759:	89 f1                	mov    %esi,%ecx
+  80075b:	8d 71 01             	lea    0x1(%ecx),%esi
+  80075e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800762:	0f be d0             	movsbl %al,%edx
+  800765:	85 d2                	test   %edx,%edx
+  800767:	74 28                	je     800791 <vprintfmt+0x238>
+  800769:	85 ff                	test   %edi,%edi
+  80076b:	78 05                	js     800772 <vprintfmt+0x219>
+  80076d:	83 ef 01             	sub    $0x1,%edi
+  800770:	78 30                	js     8007a2 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800772:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800776:	74 d6                	je     80074e <vprintfmt+0x1f5>
+  800778:	0f be c0             	movsbl %al,%eax
+  80077b:	83 e8 20             	sub    $0x20,%eax
+  80077e:	83 f8 5e             	cmp    $0x5e,%eax
+  800781:	76 cb                	jbe    80074e <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800783:	83 ec 08             	sub    $0x8,%esp
+  800786:	53                   	push   %ebx
+  800787:	6a 3f                	push   $0x3f
+  800789:	ff 55 08             	call   *0x8(%ebp)
+  80078c:	83 c4 10             	add    $0x10,%esp
+  80078f:	eb c8                	jmp    800759 <vprintfmt+0x200>
+  800791:	8b 75 08             	mov    0x8(%ebp),%esi
+  800794:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800797:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80079a:	01 d0                	add    %edx,%eax
+  80079c:	29 c8                	sub    %ecx,%eax
+  80079e:	89 c7                	mov    %eax,%edi
+  8007a0:	eb 13                	jmp    8007b5 <vprintfmt+0x25c>
+  8007a2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007a5:	eb ed                	jmp    800794 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8007a7:	83 ec 08             	sub    $0x8,%esp
+  8007aa:	53                   	push   %ebx
+  8007ab:	6a 20                	push   $0x20
+  8007ad:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8007af:	83 ef 01             	sub    $0x1,%edi
+  8007b2:	83 c4 10             	add    $0x10,%esp
+  8007b5:	85 ff                	test   %edi,%edi
+  8007b7:	7f ee                	jg     8007a7 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8007b9:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8007bc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007bf:	e9 6b 01 00 00       	jmp    80092f <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8007c4:	83 f9 01             	cmp    $0x1,%ecx
+  8007c7:	7f 1f                	jg     8007e8 <vprintfmt+0x28f>
+	else if (lflag)
+  8007c9:	85 c9                	test   %ecx,%ecx
+  8007cb:	74 67                	je     800834 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8007cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d0:	8b 00                	mov    (%eax),%eax
+  8007d2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007d5:	89 c1                	mov    %eax,%ecx
+  8007d7:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007da:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007e6:	eb 17                	jmp    8007ff <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8007e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007eb:	8b 50 04             	mov    0x4(%eax),%edx
+  8007ee:	8b 00                	mov    (%eax),%eax
+  8007f0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007f3:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8007f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f9:	8d 40 08             	lea    0x8(%eax),%eax
+  8007fc:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8007ff:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800802:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800805:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80080a:	85 c9                	test   %ecx,%ecx
+  80080c:	0f 89 03 01 00 00    	jns    800915 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800812:	83 ec 08             	sub    $0x8,%esp
+  800815:	53                   	push   %ebx
+  800816:	6a 2d                	push   $0x2d
+  800818:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80081a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80081d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800820:	f7 da                	neg    %edx
+  800822:	83 d1 00             	adc    $0x0,%ecx
+  800825:	f7 d9                	neg    %ecx
+  800827:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80082a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80082f:	e9 e1 00 00 00       	jmp    800915 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800834:	8b 45 14             	mov    0x14(%ebp),%eax
+  800837:	8b 00                	mov    (%eax),%eax
+  800839:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80083c:	89 c1                	mov    %eax,%ecx
+  80083e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800841:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800844:	8b 45 14             	mov    0x14(%ebp),%eax
+  800847:	8d 40 04             	lea    0x4(%eax),%eax
+  80084a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80084d:	eb b0                	jmp    8007ff <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80084f:	83 f9 01             	cmp    $0x1,%ecx
+  800852:	7f 1e                	jg     800872 <vprintfmt+0x319>
+	else if (lflag)
+  800854:	85 c9                	test   %ecx,%ecx
+  800856:	74 32                	je     80088a <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800858:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085b:	8b 10                	mov    (%eax),%edx
+  80085d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800862:	8d 40 04             	lea    0x4(%eax),%eax
+  800865:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800868:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80086d:	e9 a3 00 00 00       	jmp    800915 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800872:	8b 45 14             	mov    0x14(%ebp),%eax
+  800875:	8b 10                	mov    (%eax),%edx
+  800877:	8b 48 04             	mov    0x4(%eax),%ecx
+  80087a:	8d 40 08             	lea    0x8(%eax),%eax
+  80087d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800880:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800885:	e9 8b 00 00 00       	jmp    800915 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80088a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80088d:	8b 10                	mov    (%eax),%edx
+  80088f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800894:	8d 40 04             	lea    0x4(%eax),%eax
+  800897:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80089a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80089f:	eb 74                	jmp    800915 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8008a1:	83 f9 01             	cmp    $0x1,%ecx
+  8008a4:	7f 1b                	jg     8008c1 <vprintfmt+0x368>
+	else if (lflag)
+  8008a6:	85 c9                	test   %ecx,%ecx
+  8008a8:	74 2c                	je     8008d6 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8008aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ad:	8b 10                	mov    (%eax),%edx
+  8008af:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008b4:	8d 40 04             	lea    0x4(%eax),%eax
+  8008b7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8008ba:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8008bf:	eb 54                	jmp    800915 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8008c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c4:	8b 10                	mov    (%eax),%edx
+  8008c6:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008c9:	8d 40 08             	lea    0x8(%eax),%eax
+  8008cc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8008cf:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8008d4:	eb 3f                	jmp    800915 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8008d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d9:	8b 10                	mov    (%eax),%edx
+  8008db:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008e0:	8d 40 04             	lea    0x4(%eax),%eax
+  8008e3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8008e6:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8008eb:	eb 28                	jmp    800915 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8008ed:	83 ec 08             	sub    $0x8,%esp
+  8008f0:	53                   	push   %ebx
+  8008f1:	6a 30                	push   $0x30
+  8008f3:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8008f5:	83 c4 08             	add    $0x8,%esp
+  8008f8:	53                   	push   %ebx
+  8008f9:	6a 78                	push   $0x78
+  8008fb:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8008fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800900:	8b 10                	mov    (%eax),%edx
+  800902:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800907:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80090a:	8d 40 04             	lea    0x4(%eax),%eax
+  80090d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800910:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800915:	83 ec 0c             	sub    $0xc,%esp
+  800918:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80091c:	50                   	push   %eax
+  80091d:	ff 75 e0             	push   -0x20(%ebp)
+  800920:	57                   	push   %edi
+  800921:	51                   	push   %ecx
+  800922:	52                   	push   %edx
+  800923:	89 da                	mov    %ebx,%edx
+  800925:	89 f0                	mov    %esi,%eax
+  800927:	e8 4a fb ff ff       	call   800476 <printnum>
+			break;
+  80092c:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80092f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800932:	e9 40 fc ff ff       	jmp    800577 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800937:	83 f9 01             	cmp    $0x1,%ecx
+  80093a:	7f 1b                	jg     800957 <vprintfmt+0x3fe>
+	else if (lflag)
+  80093c:	85 c9                	test   %ecx,%ecx
+  80093e:	74 2c                	je     80096c <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800940:	8b 45 14             	mov    0x14(%ebp),%eax
+  800943:	8b 10                	mov    (%eax),%edx
+  800945:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80094a:	8d 40 04             	lea    0x4(%eax),%eax
+  80094d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800950:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800955:	eb be                	jmp    800915 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800957:	8b 45 14             	mov    0x14(%ebp),%eax
+  80095a:	8b 10                	mov    (%eax),%edx
+  80095c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80095f:	8d 40 08             	lea    0x8(%eax),%eax
+  800962:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800965:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80096a:	eb a9                	jmp    800915 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80096c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80096f:	8b 10                	mov    (%eax),%edx
+  800971:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800976:	8d 40 04             	lea    0x4(%eax),%eax
+  800979:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80097c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800981:	eb 92                	jmp    800915 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800983:	83 ec 08             	sub    $0x8,%esp
+  800986:	53                   	push   %ebx
+  800987:	6a 25                	push   $0x25
+  800989:	ff d6                	call   *%esi
+			break;
+  80098b:	83 c4 10             	add    $0x10,%esp
+  80098e:	eb 9f                	jmp    80092f <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800990:	83 ec 08             	sub    $0x8,%esp
+  800993:	53                   	push   %ebx
+  800994:	6a 25                	push   $0x25
+  800996:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800998:	83 c4 10             	add    $0x10,%esp
+  80099b:	89 f8                	mov    %edi,%eax
+  80099d:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8009a1:	74 05                	je     8009a8 <vprintfmt+0x44f>
+  8009a3:	83 e8 01             	sub    $0x1,%eax
+  8009a6:	eb f5                	jmp    80099d <vprintfmt+0x444>
+  8009a8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8009ab:	eb 82                	jmp    80092f <vprintfmt+0x3d6>
+
+008009ad <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8009ad:	55                   	push   %ebp
+  8009ae:	89 e5                	mov    %esp,%ebp
+  8009b0:	83 ec 18             	sub    $0x18,%esp
+  8009b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8009b9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8009bc:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8009c0:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8009c3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8009ca:	85 c0                	test   %eax,%eax
+  8009cc:	74 26                	je     8009f4 <vsnprintf+0x47>
+  8009ce:	85 d2                	test   %edx,%edx
+  8009d0:	7e 22                	jle    8009f4 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8009d2:	ff 75 14             	push   0x14(%ebp)
+  8009d5:	ff 75 10             	push   0x10(%ebp)
+  8009d8:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8009db:	50                   	push   %eax
+  8009dc:	68 1f 05 80 00       	push   $0x80051f
+  8009e1:	e8 73 fb ff ff       	call   800559 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8009e6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8009e9:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8009ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009ef:	83 c4 10             	add    $0x10,%esp
+}
+  8009f2:	c9                   	leave
+  8009f3:	c3                   	ret
+		return -E_INVAL;
+  8009f4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009f9:	eb f7                	jmp    8009f2 <vsnprintf+0x45>
+
+008009fb <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8009fb:	55                   	push   %ebp
+  8009fc:	89 e5                	mov    %esp,%ebp
+  8009fe:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800a01:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800a04:	50                   	push   %eax
+  800a05:	ff 75 10             	push   0x10(%ebp)
+  800a08:	ff 75 0c             	push   0xc(%ebp)
+  800a0b:	ff 75 08             	push   0x8(%ebp)
+  800a0e:	e8 9a ff ff ff       	call   8009ad <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800a13:	c9                   	leave
+  800a14:	c3                   	ret
+
+00800a15 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a15:	55                   	push   %ebp
+  800a16:	89 e5                	mov    %esp,%ebp
+  800a18:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800a1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a20:	eb 03                	jmp    800a25 <strlen+0x10>
+		n++;
+  800a22:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800a25:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a29:	75 f7                	jne    800a22 <strlen+0xd>
+	return n;
+}
+  800a2b:	5d                   	pop    %ebp
+  800a2c:	c3                   	ret
+
+00800a2d <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a2d:	55                   	push   %ebp
+  800a2e:	89 e5                	mov    %esp,%ebp
+  800a30:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a33:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a36:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a3b:	eb 03                	jmp    800a40 <strnlen+0x13>
+		n++;
+  800a3d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a40:	39 d0                	cmp    %edx,%eax
+  800a42:	74 08                	je     800a4c <strnlen+0x1f>
+  800a44:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a48:	75 f3                	jne    800a3d <strnlen+0x10>
+  800a4a:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800a4c:	89 d0                	mov    %edx,%eax
+  800a4e:	5d                   	pop    %ebp
+  800a4f:	c3                   	ret
+
+00800a50 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a50:	55                   	push   %ebp
+  800a51:	89 e5                	mov    %esp,%ebp
+  800a53:	53                   	push   %ebx
+  800a54:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a57:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a5f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a63:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a66:	83 c0 01             	add    $0x1,%eax
+  800a69:	84 d2                	test   %dl,%dl
+  800a6b:	75 f2                	jne    800a5f <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a6d:	89 c8                	mov    %ecx,%eax
+  800a6f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a72:	c9                   	leave
+  800a73:	c3                   	ret
+
+00800a74 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a74:	55                   	push   %ebp
+  800a75:	89 e5                	mov    %esp,%ebp
+  800a77:	53                   	push   %ebx
+  800a78:	83 ec 10             	sub    $0x10,%esp
+  800a7b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a7e:	53                   	push   %ebx
+  800a7f:	e8 91 ff ff ff       	call   800a15 <strlen>
+  800a84:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800a87:	ff 75 0c             	push   0xc(%ebp)
+  800a8a:	01 d8                	add    %ebx,%eax
+  800a8c:	50                   	push   %eax
+  800a8d:	e8 be ff ff ff       	call   800a50 <strcpy>
+	return dst;
+}
+  800a92:	89 d8                	mov    %ebx,%eax
+  800a94:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a97:	c9                   	leave
+  800a98:	c3                   	ret
+
+00800a99 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a99:	55                   	push   %ebp
+  800a9a:	89 e5                	mov    %esp,%ebp
+  800a9c:	56                   	push   %esi
+  800a9d:	53                   	push   %ebx
+  800a9e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800aa1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800aa4:	89 f3                	mov    %esi,%ebx
+  800aa6:	03 5d 10             	add    0x10(%ebp),%ebx
+  800aa9:	89 f0                	mov    %esi,%eax
+  800aab:	eb 0f                	jmp    800abc <strncpy+0x23>
+		*dst++ = *src;
+  800aad:	83 c0 01             	add    $0x1,%eax
+  800ab0:	0f b6 0a             	movzbl (%edx),%ecx
+  800ab3:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800ab6:	80 f9 01             	cmp    $0x1,%cl
+  800ab9:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800abc:	39 d8                	cmp    %ebx,%eax
+  800abe:	75 ed                	jne    800aad <strncpy+0x14>
+	}
+	return ret;
+}
+  800ac0:	89 f0                	mov    %esi,%eax
+  800ac2:	5b                   	pop    %ebx
+  800ac3:	5e                   	pop    %esi
+  800ac4:	5d                   	pop    %ebp
+  800ac5:	c3                   	ret
+
+00800ac6 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800ac6:	55                   	push   %ebp
+  800ac7:	89 e5                	mov    %esp,%ebp
+  800ac9:	56                   	push   %esi
+  800aca:	53                   	push   %ebx
+  800acb:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ace:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ad1:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800ad4:	89 f0                	mov    %esi,%eax
+  800ad6:	85 d2                	test   %edx,%edx
+  800ad8:	74 21                	je     800afb <strlcpy+0x35>
+  800ada:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800ade:	89 f2                	mov    %esi,%edx
+  800ae0:	eb 09                	jmp    800aeb <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800ae2:	83 c1 01             	add    $0x1,%ecx
+  800ae5:	83 c2 01             	add    $0x1,%edx
+  800ae8:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800aeb:	39 c2                	cmp    %eax,%edx
+  800aed:	74 09                	je     800af8 <strlcpy+0x32>
+  800aef:	0f b6 19             	movzbl (%ecx),%ebx
+  800af2:	84 db                	test   %bl,%bl
+  800af4:	75 ec                	jne    800ae2 <strlcpy+0x1c>
+  800af6:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800af8:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800afb:	29 f0                	sub    %esi,%eax
+}
+  800afd:	5b                   	pop    %ebx
+  800afe:	5e                   	pop    %esi
+  800aff:	5d                   	pop    %ebp
+  800b00:	c3                   	ret
+
+00800b01 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b01:	55                   	push   %ebp
+  800b02:	89 e5                	mov    %esp,%ebp
+  800b04:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b07:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800b0a:	eb 06                	jmp    800b12 <strcmp+0x11>
+		p++, q++;
+  800b0c:	83 c1 01             	add    $0x1,%ecx
+  800b0f:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800b12:	0f b6 01             	movzbl (%ecx),%eax
+  800b15:	84 c0                	test   %al,%al
+  800b17:	74 04                	je     800b1d <strcmp+0x1c>
+  800b19:	3a 02                	cmp    (%edx),%al
+  800b1b:	74 ef                	je     800b0c <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b1d:	0f b6 c0             	movzbl %al,%eax
+  800b20:	0f b6 12             	movzbl (%edx),%edx
+  800b23:	29 d0                	sub    %edx,%eax
+}
+  800b25:	5d                   	pop    %ebp
+  800b26:	c3                   	ret
+
+00800b27 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b27:	55                   	push   %ebp
+  800b28:	89 e5                	mov    %esp,%ebp
+  800b2a:	53                   	push   %ebx
+  800b2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b2e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b31:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800b34:	eb 09                	jmp    800b3f <strncmp+0x18>
+		n--, p++, q++;
+  800b36:	83 ea 01             	sub    $0x1,%edx
+  800b39:	83 c0 01             	add    $0x1,%eax
+  800b3c:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800b3f:	85 d2                	test   %edx,%edx
+  800b41:	74 18                	je     800b5b <strncmp+0x34>
+  800b43:	0f b6 18             	movzbl (%eax),%ebx
+  800b46:	84 db                	test   %bl,%bl
+  800b48:	74 04                	je     800b4e <strncmp+0x27>
+  800b4a:	3a 19                	cmp    (%ecx),%bl
+  800b4c:	74 e8                	je     800b36 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b4e:	0f b6 00             	movzbl (%eax),%eax
+  800b51:	0f b6 11             	movzbl (%ecx),%edx
+  800b54:	29 d0                	sub    %edx,%eax
+}
+  800b56:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b59:	c9                   	leave
+  800b5a:	c3                   	ret
+		return 0;
+  800b5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b60:	eb f4                	jmp    800b56 <strncmp+0x2f>
+
+00800b62 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b62:	55                   	push   %ebp
+  800b63:	89 e5                	mov    %esp,%ebp
+  800b65:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b68:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b6c:	eb 03                	jmp    800b71 <strchr+0xf>
+  800b6e:	83 c0 01             	add    $0x1,%eax
+  800b71:	0f b6 10             	movzbl (%eax),%edx
+  800b74:	84 d2                	test   %dl,%dl
+  800b76:	74 06                	je     800b7e <strchr+0x1c>
+		if (*s == c)
+  800b78:	38 ca                	cmp    %cl,%dl
+  800b7a:	75 f2                	jne    800b6e <strchr+0xc>
+  800b7c:	eb 05                	jmp    800b83 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800b7e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b83:	5d                   	pop    %ebp
+  800b84:	c3                   	ret
+
+00800b85 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b85:	55                   	push   %ebp
+  800b86:	89 e5                	mov    %esp,%ebp
+  800b88:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b8b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b8f:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800b92:	38 ca                	cmp    %cl,%dl
+  800b94:	74 09                	je     800b9f <strfind+0x1a>
+  800b96:	84 d2                	test   %dl,%dl
+  800b98:	74 05                	je     800b9f <strfind+0x1a>
+	for (; *s; s++)
+  800b9a:	83 c0 01             	add    $0x1,%eax
+  800b9d:	eb f0                	jmp    800b8f <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800b9f:	5d                   	pop    %ebp
+  800ba0:	c3                   	ret
+
+00800ba1 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800ba1:	55                   	push   %ebp
+  800ba2:	89 e5                	mov    %esp,%ebp
+  800ba4:	57                   	push   %edi
+  800ba5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ba8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800bab:	85 c9                	test   %ecx,%ecx
+  800bad:	74 20                	je     800bcf <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800baf:	89 f8                	mov    %edi,%eax
+  800bb1:	09 c8                	or     %ecx,%eax
+  800bb3:	a8 03                	test   $0x3,%al
+  800bb5:	75 12                	jne    800bc9 <memset+0x28>
+		c &= 0xFF;
+  800bb7:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800bbb:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800bc1:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800bc4:	fc                   	cld
+  800bc5:	f3 ab                	rep stos %eax,%es:(%edi)
+  800bc7:	eb 06                	jmp    800bcf <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800bc9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bcc:	fc                   	cld
+  800bcd:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800bcf:	89 f8                	mov    %edi,%eax
+  800bd1:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800bd4:	c9                   	leave
+  800bd5:	c3                   	ret
+
+00800bd6 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800bd6:	55                   	push   %ebp
+  800bd7:	89 e5                	mov    %esp,%ebp
+  800bd9:	57                   	push   %edi
+  800bda:	56                   	push   %esi
+  800bdb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bde:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800be1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800be4:	39 c6                	cmp    %eax,%esi
+  800be6:	73 32                	jae    800c1a <memmove+0x44>
+  800be8:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800beb:	39 d0                	cmp    %edx,%eax
+  800bed:	73 2b                	jae    800c1a <memmove+0x44>
+		s += n;
+		d += n;
+  800bef:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bf2:	89 d6                	mov    %edx,%esi
+  800bf4:	09 fe                	or     %edi,%esi
+  800bf6:	09 ce                	or     %ecx,%esi
+  800bf8:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800bfe:	75 0e                	jne    800c0e <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c00:	83 ef 04             	sub    $0x4,%edi
+  800c03:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c06:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800c09:	fd                   	std
+  800c0a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c0c:	eb 09                	jmp    800c17 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c0e:	83 ef 01             	sub    $0x1,%edi
+  800c11:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800c14:	fd                   	std
+  800c15:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c17:	fc                   	cld
+  800c18:	eb 1a                	jmp    800c34 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c1a:	89 f2                	mov    %esi,%edx
+  800c1c:	09 c2                	or     %eax,%edx
+  800c1e:	09 ca                	or     %ecx,%edx
+  800c20:	f6 c2 03             	test   $0x3,%dl
+  800c23:	75 0a                	jne    800c2f <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c25:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c28:	89 c7                	mov    %eax,%edi
+  800c2a:	fc                   	cld
+  800c2b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c2d:	eb 05                	jmp    800c34 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c2f:	89 c7                	mov    %eax,%edi
+  800c31:	fc                   	cld
+  800c32:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c34:	5e                   	pop    %esi
+  800c35:	5f                   	pop    %edi
+  800c36:	5d                   	pop    %ebp
+  800c37:	c3                   	ret
+
+00800c38 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c38:	55                   	push   %ebp
+  800c39:	89 e5                	mov    %esp,%ebp
+  800c3b:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c3e:	ff 75 10             	push   0x10(%ebp)
+  800c41:	ff 75 0c             	push   0xc(%ebp)
+  800c44:	ff 75 08             	push   0x8(%ebp)
+  800c47:	e8 8a ff ff ff       	call   800bd6 <memmove>
+}
+  800c4c:	c9                   	leave
+  800c4d:	c3                   	ret
+
+00800c4e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c4e:	55                   	push   %ebp
+  800c4f:	89 e5                	mov    %esp,%ebp
+  800c51:	56                   	push   %esi
+  800c52:	53                   	push   %ebx
+  800c53:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c56:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c59:	89 c6                	mov    %eax,%esi
+  800c5b:	03 75 10             	add    0x10(%ebp),%esi
+  800c5e:	eb 06                	jmp    800c66 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800c60:	83 c0 01             	add    $0x1,%eax
+  800c63:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800c66:	39 f0                	cmp    %esi,%eax
+  800c68:	74 14                	je     800c7e <memcmp+0x30>
+		if (*s1 != *s2)
+  800c6a:	0f b6 08             	movzbl (%eax),%ecx
+  800c6d:	0f b6 1a             	movzbl (%edx),%ebx
+  800c70:	38 d9                	cmp    %bl,%cl
+  800c72:	74 ec                	je     800c60 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800c74:	0f b6 c1             	movzbl %cl,%eax
+  800c77:	0f b6 db             	movzbl %bl,%ebx
+  800c7a:	29 d8                	sub    %ebx,%eax
+  800c7c:	eb 05                	jmp    800c83 <memcmp+0x35>
+	}
+
+	return 0;
+  800c7e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c83:	5b                   	pop    %ebx
+  800c84:	5e                   	pop    %esi
+  800c85:	5d                   	pop    %ebp
+  800c86:	c3                   	ret
+
+00800c87 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c87:	55                   	push   %ebp
+  800c88:	89 e5                	mov    %esp,%ebp
+  800c8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c8d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c90:	89 c2                	mov    %eax,%edx
+  800c92:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c95:	eb 03                	jmp    800c9a <memfind+0x13>
+  800c97:	83 c0 01             	add    $0x1,%eax
+  800c9a:	39 d0                	cmp    %edx,%eax
+  800c9c:	73 04                	jae    800ca2 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c9e:	38 08                	cmp    %cl,(%eax)
+  800ca0:	75 f5                	jne    800c97 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800ca2:	5d                   	pop    %ebp
+  800ca3:	c3                   	ret
+
+00800ca4 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800ca4:	55                   	push   %ebp
+  800ca5:	89 e5                	mov    %esp,%ebp
+  800ca7:	57                   	push   %edi
+  800ca8:	56                   	push   %esi
+  800ca9:	53                   	push   %ebx
+  800caa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800cb0:	eb 03                	jmp    800cb5 <strtol+0x11>
+		s++;
+  800cb2:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800cb5:	0f b6 02             	movzbl (%edx),%eax
+  800cb8:	3c 20                	cmp    $0x20,%al
+  800cba:	74 f6                	je     800cb2 <strtol+0xe>
+  800cbc:	3c 09                	cmp    $0x9,%al
+  800cbe:	74 f2                	je     800cb2 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800cc0:	3c 2b                	cmp    $0x2b,%al
+  800cc2:	74 2a                	je     800cee <strtol+0x4a>
+	int neg = 0;
+  800cc4:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800cc9:	3c 2d                	cmp    $0x2d,%al
+  800ccb:	74 2b                	je     800cf8 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ccd:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800cd3:	75 0f                	jne    800ce4 <strtol+0x40>
+  800cd5:	80 3a 30             	cmpb   $0x30,(%edx)
+  800cd8:	74 28                	je     800d02 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800cda:	85 db                	test   %ebx,%ebx
+  800cdc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ce1:	0f 44 d8             	cmove  %eax,%ebx
+  800ce4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ce9:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800cec:	eb 46                	jmp    800d34 <strtol+0x90>
+		s++;
+  800cee:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800cf1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800cf6:	eb d5                	jmp    800ccd <strtol+0x29>
+		s++, neg = 1;
+  800cf8:	83 c2 01             	add    $0x1,%edx
+  800cfb:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d00:	eb cb                	jmp    800ccd <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d02:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d06:	74 0e                	je     800d16 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800d08:	85 db                	test   %ebx,%ebx
+  800d0a:	75 d8                	jne    800ce4 <strtol+0x40>
+		s++, base = 8;
+  800d0c:	83 c2 01             	add    $0x1,%edx
+  800d0f:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d14:	eb ce                	jmp    800ce4 <strtol+0x40>
+		s += 2, base = 16;
+  800d16:	83 c2 02             	add    $0x2,%edx
+  800d19:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d1e:	eb c4                	jmp    800ce4 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800d20:	0f be c0             	movsbl %al,%eax
+  800d23:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800d26:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d29:	7d 3a                	jge    800d65 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800d2b:	83 c2 01             	add    $0x1,%edx
+  800d2e:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d32:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800d34:	0f b6 02             	movzbl (%edx),%eax
+  800d37:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d3a:	89 f3                	mov    %esi,%ebx
+  800d3c:	80 fb 09             	cmp    $0x9,%bl
+  800d3f:	76 df                	jbe    800d20 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800d41:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d44:	89 f3                	mov    %esi,%ebx
+  800d46:	80 fb 19             	cmp    $0x19,%bl
+  800d49:	77 08                	ja     800d53 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800d4b:	0f be c0             	movsbl %al,%eax
+  800d4e:	83 e8 57             	sub    $0x57,%eax
+  800d51:	eb d3                	jmp    800d26 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d53:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d56:	89 f3                	mov    %esi,%ebx
+  800d58:	80 fb 19             	cmp    $0x19,%bl
+  800d5b:	77 08                	ja     800d65 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800d5d:	0f be c0             	movsbl %al,%eax
+  800d60:	83 e8 37             	sub    $0x37,%eax
+  800d63:	eb c1                	jmp    800d26 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d65:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d69:	74 05                	je     800d70 <strtol+0xcc>
+		*endptr = (char *) s;
+  800d6b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d6e:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800d70:	89 c8                	mov    %ecx,%eax
+  800d72:	f7 d8                	neg    %eax
+  800d74:	85 ff                	test   %edi,%edi
+  800d76:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d79:	89 c8                	mov    %ecx,%eax
+  800d7b:	5b                   	pop    %ebx
+  800d7c:	5e                   	pop    %esi
+  800d7d:	5f                   	pop    %edi
+  800d7e:	5d                   	pop    %ebp
+  800d7f:	c3                   	ret
+
+00800d80 <atoi>:
+
+int
+atoi(const char *s)
+{
+  800d80:	55                   	push   %ebp
+  800d81:	89 e5                	mov    %esp,%ebp
+  800d83:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800d86:	6a 0a                	push   $0xa
+  800d88:	6a 00                	push   $0x0
+  800d8a:	ff 75 08             	push   0x8(%ebp)
+  800d8d:	e8 12 ff ff ff       	call   800ca4 <strtol>
+}
+  800d92:	c9                   	leave
+  800d93:	c3                   	ret
+
+00800d94 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800d94:	55                   	push   %ebp
+  800d95:	89 e5                	mov    %esp,%ebp
+  800d97:	57                   	push   %edi
+  800d98:	56                   	push   %esi
+  800d99:	53                   	push   %ebx
+  800d9a:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800da0:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800da6:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800dac:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800db2:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800db9:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800dbc:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800dc3:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800dc6:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800dcd:	74 76                	je     800e45 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800dcf:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800dd5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dd8:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800dde:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800de5:	0f 88 06 01 00 00    	js     800ef1 <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800deb:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800df2:	0f 84 48 01 00 00    	je     800f40 <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800df8:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800dfe:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800e04:	be 00 00 00 00       	mov    $0x0,%esi
+  800e09:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800e0f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800e12:	55                   	push   %ebp
+  800e13:	68 1c 0e 80 00       	push   $0x800e1c
+  800e18:	89 e5                	mov    %esp,%ebp
+  800e1a:	0f 34                	sysenter
+  800e1c:	83 c4 04             	add    $0x4,%esp
+  800e1f:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800e20:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800e26:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800e2c:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800e2f:	0f 85 9a 01 00 00    	jne    800fcf <page_vec_call+0x23b>
+  800e35:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e3a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e3d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e40:	e9 29 01 00 00       	jmp    800f6e <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800e45:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800e4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e4e:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800e50:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e57:	78 2f                	js     800e88 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800e59:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e60:	74 72                	je     800ed4 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800e62:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800e68:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800e6e:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e73:	89 fb                	mov    %edi,%ebx
+  800e75:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800e78:	55                   	push   %ebp
+  800e79:	68 82 0e 80 00       	push   $0x800e82
+  800e7e:	89 e5                	mov    %esp,%ebp
+  800e80:	0f 34                	sysenter
+  800e82:	83 c4 04             	add    $0x4,%esp
+  800e85:	5d                   	pop    %ebp
+	return ret;
+  800e86:	eb 98                	jmp    800e20 <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800e88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e8d:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800e8f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800e94:	f6 c6 08             	test   $0x8,%dh
+  800e97:	74 15                	je     800eae <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e99:	89 c2                	mov    %eax,%edx
+  800e9b:	c1 ea 08             	shr    $0x8,%edx
+  800e9e:	83 e2 0f             	and    $0xf,%edx
+  800ea1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ea6:	83 fa 06             	cmp    $0x6,%edx
+  800ea9:	74 0e                	je     800eb9 <page_vec_call+0x125>
+  800eab:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800eae:	0f b6 c9             	movzbl %cl,%ecx
+  800eb1:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800eb7:	eb a0                	jmp    800e59 <page_vec_call+0xc5>
+  800eb9:	89 c2                	mov    %eax,%edx
+  800ebb:	c1 ea 04             	shr    $0x4,%edx
+  800ebe:	83 e2 0f             	and    $0xf,%edx
+  800ec1:	83 fa 02             	cmp    $0x2,%edx
+  800ec4:	77 e5                	ja     800eab <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800ec6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ec9:	83 f8 02             	cmp    $0x2,%eax
+  800ecc:	0f 97 c1             	seta   %cl
+  800ecf:	0f b6 c9             	movzbl %cl,%ecx
+  800ed2:	eb d7                	jmp    800eab <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800ed4:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ed9:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800edf:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800ee5:	89 fb                	mov    %edi,%ebx
+  800ee7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800eea:	cd 30                	int    $0x30
+  800eec:	e9 2f ff ff ff       	jmp    800e20 <page_vec_call+0x8c>
+  800ef1:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ef6:	0f a2                	cpuid
+		return 0;
+  800ef8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800efd:	f6 c6 08             	test   $0x8,%dh
+  800f00:	74 15                	je     800f17 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f02:	89 c2                	mov    %eax,%edx
+  800f04:	c1 ea 08             	shr    $0x8,%edx
+  800f07:	83 e2 0f             	and    $0xf,%edx
+  800f0a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f0f:	83 fa 06             	cmp    $0x6,%edx
+  800f12:	74 11                	je     800f25 <page_vec_call+0x191>
+  800f14:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f17:	0f b6 c9             	movzbl %cl,%ecx
+  800f1a:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800f20:	e9 c6 fe ff ff       	jmp    800deb <page_vec_call+0x57>
+  800f25:	89 c2                	mov    %eax,%edx
+  800f27:	c1 ea 04             	shr    $0x4,%edx
+  800f2a:	83 e2 0f             	and    $0xf,%edx
+  800f2d:	83 fa 02             	cmp    $0x2,%edx
+  800f30:	77 e2                	ja     800f14 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800f32:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f35:	83 f8 02             	cmp    $0x2,%eax
+  800f38:	0f 97 c1             	seta   %cl
+  800f3b:	0f b6 c9             	movzbl %cl,%ecx
+  800f3e:	eb d4                	jmp    800f14 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800f40:	be 00 00 00 00       	mov    $0x0,%esi
+  800f45:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800f4b:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800f51:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800f57:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800f5a:	cd 30                	int    $0x30
+  800f5c:	e9 bf fe ff ff       	jmp    800e20 <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800f61:	29 da                	sub    %ebx,%edx
+			vec++;
+  800f63:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800f66:	83 e8 01             	sub    $0x1,%eax
+  800f69:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800f6e:	85 c0                	test   %eax,%eax
+  800f70:	74 58                	je     800fca <page_vec_call+0x236>
+  800f72:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800f75:	39 da                	cmp    %ebx,%edx
+  800f77:	73 e8                	jae    800f61 <page_vec_call+0x1cd>
+  800f79:	89 75 08             	mov    %esi,0x8(%ebp)
+  800f7c:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800f7f:	84 c9                	test   %cl,%cl
+  800f81:	74 06                	je     800f89 <page_vec_call+0x1f5>
+  800f83:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800f89:	83 ec 04             	sub    $0x4,%esp
+  800f8c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f8f:	c1 e0 04             	shl    $0x4,%eax
+  800f92:	50                   	push   %eax
+  800f93:	ff 75 08             	push   0x8(%ebp)
+  800f96:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800f9c:	53                   	push   %ebx
+  800f9d:	e8 34 fc ff ff       	call   800bd6 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800fa2:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800fa8:	89 c2                	mov    %eax,%edx
+  800faa:	c1 e2 0c             	shl    $0xc,%edx
+  800fad:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  800fb3:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  800fb9:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  800fbf:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  800fc2:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  800fc5:	e9 f2 fd ff ff       	jmp    800dbc <page_vec_call+0x28>
+			r = 0;
+  800fca:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  800fcf:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800fd3:	74 0b                	je     800fe0 <page_vec_call+0x24c>
+		*done = total;
+  800fd5:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800fd8:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  800fde:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  800fe0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fe3:	5b                   	pop    %ebx
+  800fe4:	5e                   	pop    %esi
+  800fe5:	5f                   	pop    %edi
+  800fe6:	5d                   	pop    %ebp
+  800fe7:	c3                   	ret
+
+00800fe8 <sys_cputs>:
+{
+  800fe8:	55                   	push   %ebp
+  800fe9:	89 e5                	mov    %esp,%ebp
+  800feb:	57                   	push   %edi
+  800fec:	56                   	push   %esi
+  800fed:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800fee:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800ff5:	78 2d                	js     801024 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800ff7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800ffe:	74 70                	je     801070 <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  801000:	b8 00 00 00 00       	mov    $0x0,%eax
+  801005:	8b 55 08             	mov    0x8(%ebp),%edx
+  801008:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100b:	89 c3                	mov    %eax,%ebx
+  80100d:	89 c7                	mov    %eax,%edi
+  80100f:	89 c6                	mov    %eax,%esi
+  801011:	55                   	push   %ebp
+  801012:	68 1b 10 80 00       	push   $0x80101b
+  801017:	89 e5                	mov    %esp,%ebp
+  801019:	0f 34                	sysenter
+  80101b:	83 c4 04             	add    $0x4,%esp
+  80101e:	5d                   	pop    %ebp
+}
+  80101f:	5b                   	pop    %ebx
+  801020:	5e                   	pop    %esi
+  801021:	5f                   	pop    %edi
+  801022:	5d                   	pop    %ebp
+  801023:	c3                   	ret
+  801024:	b8 01 00 00 00       	mov    $0x1,%eax
+  801029:	0f a2                	cpuid
+		return 0;
+  80102b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801030:	f6 c6 08             	test   $0x8,%dh
+  801033:	74 15                	je     80104a <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801035:	89 c2                	mov    %eax,%edx
+  801037:	c1 ea 08             	shr    $0x8,%edx
+  80103a:	83 e2 0f             	and    $0xf,%edx
+  80103d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801042:	83 fa 06             	cmp    $0x6,%edx
+  801045:	74 0e                	je     801055 <sys_cputs+0x6d>
+  801047:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80104a:	0f b6 c9             	movzbl %cl,%ecx
+  80104d:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801053:	eb a2                	jmp    800ff7 <sys_cputs+0xf>
+  801055:	89 c2                	mov    %eax,%edx
+  801057:	c1 ea 04             	shr    $0x4,%edx
+  80105a:	83 e2 0f             	and    $0xf,%edx
+  80105d:	83 fa 02             	cmp    $0x2,%edx
+  801060:	77 e5                	ja     801047 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  801062:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801065:	83 f8 02             	cmp    $0x2,%eax
+  801068:	0f 97 c1             	seta   %cl
+  80106b:	0f b6 c9             	movzbl %cl,%ecx
+  80106e:	eb d7                	jmp    801047 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  801070:	b8 00 00 00 00       	mov    $0x0,%eax
+  801075:	8b 55 08             	mov    0x8(%ebp),%edx
+  801078:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107b:	89 c3                	mov    %eax,%ebx
+  80107d:	89 c7                	mov    %eax,%edi
+  80107f:	89 c6                	mov    %eax,%esi
+  801081:	cd 30                	int    $0x30
+}
+  801083:	eb 9a                	jmp    80101f <sys_cputs+0x37>
+
+00801085 <sys_cgetc>:
+{
+  801085:	55                   	push   %ebp
+  801086:	89 e5                	mov    %esp,%ebp
+  801088:	57                   	push   %edi
+  801089:	56                   	push   %esi
+  80108a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80108b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801092:	78 2e                	js     8010c2 <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  801094:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80109b:	74 71                	je     80110e <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  80109d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010a2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010a7:	89 d1                	mov    %edx,%ecx
+  8010a9:	89 d3                	mov    %edx,%ebx
+  8010ab:	89 d7                	mov    %edx,%edi
+  8010ad:	89 d6                	mov    %edx,%esi
+  8010af:	55                   	push   %ebp
+  8010b0:	68 b9 10 80 00       	push   $0x8010b9
+  8010b5:	89 e5                	mov    %esp,%ebp
+  8010b7:	0f 34                	sysenter
+  8010b9:	83 c4 04             	add    $0x4,%esp
+  8010bc:	5d                   	pop    %ebp
+}
+  8010bd:	5b                   	pop    %ebx
+  8010be:	5e                   	pop    %esi
+  8010bf:	5f                   	pop    %edi
+  8010c0:	5d                   	pop    %ebp
+  8010c1:	c3                   	ret
+  8010c2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010c7:	0f a2                	cpuid
+		return 0;
+  8010c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8010ce:	f6 c6 08             	test   $0x8,%dh
+  8010d1:	74 15                	je     8010e8 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010d3:	89 c2                	mov    %eax,%edx
+  8010d5:	c1 ea 08             	shr    $0x8,%edx
+  8010d8:	83 e2 0f             	and    $0xf,%edx
+  8010db:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8010e0:	83 fa 06             	cmp    $0x6,%edx
+  8010e3:	74 0e                	je     8010f3 <sys_cgetc+0x6e>
+  8010e5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8010e8:	0f b6 c9             	movzbl %cl,%ecx
+  8010eb:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8010f1:	eb a1                	jmp    801094 <sys_cgetc+0xf>
+  8010f3:	89 c2                	mov    %eax,%edx
+  8010f5:	c1 ea 04             	shr    $0x4,%edx
+  8010f8:	83 e2 0f             	and    $0xf,%edx
+  8010fb:	83 fa 02             	cmp    $0x2,%edx
+  8010fe:	77 e5                	ja     8010e5 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  801100:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801103:	83 f8 02             	cmp    $0x2,%eax
+  801106:	0f 97 c1             	seta   %cl
+  801109:	0f b6 c9             	movzbl %cl,%ecx
+  80110c:	eb d7                	jmp    8010e5 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  80110e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801113:	b8 01 00 00 00       	mov    $0x1,%eax
+  801118:	89 d1                	mov    %edx,%ecx
+  80111a:	89 d3                	mov    %edx,%ebx
+  80111c:	89 d7                	mov    %edx,%edi
+  80111e:	89 d6                	mov    %edx,%esi
+  801120:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801122:	eb 99                	jmp    8010bd <sys_cgetc+0x38>
+
+00801124 <sys_env_destroy>:
+{
+  801124:	55                   	push   %ebp
+  801125:	89 e5                	mov    %esp,%ebp
+  801127:	57                   	push   %edi
+  801128:	56                   	push   %esi
+  801129:	53                   	push   %ebx
+  80112a:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80112d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801134:	78 36                	js     80116c <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  801136:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80113d:	74 79                	je     8011b8 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  80113f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801142:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801147:	b8 03 00 00 00       	mov    $0x3,%eax
+  80114c:	89 cb                	mov    %ecx,%ebx
+  80114e:	89 cf                	mov    %ecx,%edi
+  801150:	89 ce                	mov    %ecx,%esi
+  801152:	55                   	push   %ebp
+  801153:	68 5c 11 80 00       	push   $0x80115c
+  801158:	89 e5                	mov    %esp,%ebp
+  80115a:	0f 34                	sysenter
+  80115c:	83 c4 04             	add    $0x4,%esp
+  80115f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801160:	85 c0                	test   %eax,%eax
+  801162:	7f 6b                	jg     8011cf <sys_env_destroy+0xab>
+}
+  801164:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801167:	5b                   	pop    %ebx
+  801168:	5e                   	pop    %esi
+  801169:	5f                   	pop    %edi
+  80116a:	5d                   	pop    %ebp
+  80116b:	c3                   	ret
+  80116c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801171:	0f a2                	cpuid
+		return 0;
+  801173:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801178:	f6 c6 08             	test   $0x8,%dh
+  80117b:	74 15                	je     801192 <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80117d:	89 c2                	mov    %eax,%edx
+  80117f:	c1 ea 08             	shr    $0x8,%edx
+  801182:	83 e2 0f             	and    $0xf,%edx
+  801185:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80118a:	83 fa 06             	cmp    $0x6,%edx
+  80118d:	74 0e                	je     80119d <sys_env_destroy+0x79>
+  80118f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801192:	0f b6 c9             	movzbl %cl,%ecx
+  801195:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80119b:	eb 99                	jmp    801136 <sys_env_destroy+0x12>
+  80119d:	89 c2                	mov    %eax,%edx
+  80119f:	c1 ea 04             	shr    $0x4,%edx
+  8011a2:	83 e2 0f             	and    $0xf,%edx
+  8011a5:	83 fa 02             	cmp    $0x2,%edx
+  8011a8:	77 e5                	ja     80118f <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  8011aa:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011ad:	83 f8 02             	cmp    $0x2,%eax
+  8011b0:	0f 97 c1             	seta   %cl
+  8011b3:	0f b6 c9             	movzbl %cl,%ecx
+  8011b6:	eb d7                	jmp    80118f <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  8011b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011bd:	b8 03 00 00 00       	mov    $0x3,%eax
+  8011c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c5:	89 cb                	mov    %ecx,%ebx
+  8011c7:	89 cf                	mov    %ecx,%edi
+  8011c9:	89 ce                	mov    %ecx,%esi
+  8011cb:	cd 30                	int    $0x30
+  8011cd:	eb 91                	jmp    801160 <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011cf:	83 ec 0c             	sub    $0xc,%esp
+  8011d2:	50                   	push   %eax
+  8011d3:	6a 03                	push   $0x3
+  8011d5:	68 19 35 80 00       	push   $0x803519
+  8011da:	6a 4a                	push   $0x4a
+  8011dc:	68 36 35 80 00       	push   $0x803536
+  8011e1:	e8 68 f1 ff ff       	call   80034e <_panic>
+
+008011e6 <sys_getenvid>:
+{
+  8011e6:	55                   	push   %ebp
+  8011e7:	89 e5                	mov    %esp,%ebp
+  8011e9:	57                   	push   %edi
+  8011ea:	56                   	push   %esi
+  8011eb:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8011ec:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8011f3:	78 2e                	js     801223 <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  8011f5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8011fc:	74 71                	je     80126f <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  8011fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801203:	b8 02 00 00 00       	mov    $0x2,%eax
+  801208:	89 d1                	mov    %edx,%ecx
+  80120a:	89 d3                	mov    %edx,%ebx
+  80120c:	89 d7                	mov    %edx,%edi
+  80120e:	89 d6                	mov    %edx,%esi
+  801210:	55                   	push   %ebp
+  801211:	68 1a 12 80 00       	push   $0x80121a
+  801216:	89 e5                	mov    %esp,%ebp
+  801218:	0f 34                	sysenter
+  80121a:	83 c4 04             	add    $0x4,%esp
+  80121d:	5d                   	pop    %ebp
+}
+  80121e:	5b                   	pop    %ebx
+  80121f:	5e                   	pop    %esi
+  801220:	5f                   	pop    %edi
+  801221:	5d                   	pop    %ebp
+  801222:	c3                   	ret
+  801223:	b8 01 00 00 00       	mov    $0x1,%eax
+  801228:	0f a2                	cpuid
+		return 0;
+  80122a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80122f:	f6 c6 08             	test   $0x8,%dh
+  801232:	74 15                	je     801249 <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801234:	89 c2                	mov    %eax,%edx
+  801236:	c1 ea 08             	shr    $0x8,%edx
+  801239:	83 e2 0f             	and    $0xf,%edx
+  80123c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801241:	83 fa 06             	cmp    $0x6,%edx
+  801244:	74 0e                	je     801254 <sys_getenvid+0x6e>
+  801246:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801249:	0f b6 c9             	movzbl %cl,%ecx
+  80124c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801252:	eb a1                	jmp    8011f5 <sys_getenvid+0xf>
+  801254:	89 c2                	mov    %eax,%edx
+  801256:	c1 ea 04             	shr    $0x4,%edx
+  801259:	83 e2 0f             	and    $0xf,%edx
+  80125c:	83 fa 02             	cmp    $0x2,%edx
+  80125f:	77 e5                	ja     801246 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  801261:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801264:	83 f8 02             	cmp    $0x2,%eax
+  801267:	0f 97 c1             	seta   %cl
+  80126a:	0f b6 c9             	movzbl %cl,%ecx
+  80126d:	eb d7                	jmp    801246 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  80126f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801274:	b8 02 00 00 00       	mov    $0x2,%eax
+  801279:	89 d1                	mov    %edx,%ecx
+  80127b:	89 d3                	mov    %edx,%ebx
+  80127d:	89 d7                	mov    %edx,%edi
+  80127f:	89 d6                	mov    %edx,%esi
+  801281:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801283:	eb 99                	jmp    80121e <sys_getenvid+0x38>
+
+00801285 <sys_page_alloc>:
+{
+  801285:	55                   	push   %ebp
+  801286:	89 e5                	mov    %esp,%ebp
+  801288:	57                   	push   %edi
+  801289:	56                   	push   %esi
+  80128a:	53                   	push   %ebx
+  80128b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80128e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801295:	78 38                	js     8012cf <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  801297:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80129e:	74 7b                	je     80131b <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  8012a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ab:	b8 04 00 00 00       	mov    $0x4,%eax
+  8012b0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012b3:	89 f7                	mov    %esi,%edi
+  8012b5:	55                   	push   %ebp
+  8012b6:	68 bf 12 80 00       	push   $0x8012bf
+  8012bb:	89 e5                	mov    %esp,%ebp
+  8012bd:	0f 34                	sysenter
+  8012bf:	83 c4 04             	add    $0x4,%esp
+  8012c2:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8012c3:	85 c0                	test   %eax,%eax
+  8012c5:	7f 6d                	jg     801334 <sys_page_alloc+0xaf>
+}
+  8012c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ca:	5b                   	pop    %ebx
+  8012cb:	5e                   	pop    %esi
+  8012cc:	5f                   	pop    %edi
+  8012cd:	5d                   	pop    %ebp
+  8012ce:	c3                   	ret
+  8012cf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012d4:	0f a2                	cpuid
+		return 0;
+  8012d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8012db:	f6 c6 08             	test   $0x8,%dh
+  8012de:	74 15                	je     8012f5 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012e0:	89 c2                	mov    %eax,%edx
+  8012e2:	c1 ea 08             	shr    $0x8,%edx
+  8012e5:	83 e2 0f             	and    $0xf,%edx
+  8012e8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012ed:	83 fa 06             	cmp    $0x6,%edx
+  8012f0:	74 0e                	je     801300 <sys_page_alloc+0x7b>
+  8012f2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8012f5:	0f b6 c9             	movzbl %cl,%ecx
+  8012f8:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8012fe:	eb 97                	jmp    801297 <sys_page_alloc+0x12>
+  801300:	89 c2                	mov    %eax,%edx
+  801302:	c1 ea 04             	shr    $0x4,%edx
+  801305:	83 e2 0f             	and    $0xf,%edx
+  801308:	83 fa 02             	cmp    $0x2,%edx
+  80130b:	77 e5                	ja     8012f2 <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  80130d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801310:	83 f8 02             	cmp    $0x2,%eax
+  801313:	0f 97 c1             	seta   %cl
+  801316:	0f b6 c9             	movzbl %cl,%ecx
+  801319:	eb d7                	jmp    8012f2 <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  80131b:	be 00 00 00 00       	mov    $0x0,%esi
+  801320:	b8 04 00 00 00       	mov    $0x4,%eax
+  801325:	8b 55 08             	mov    0x8(%ebp),%edx
+  801328:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80132b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80132e:	89 f7                	mov    %esi,%edi
+  801330:	cd 30                	int    $0x30
+  801332:	eb 8f                	jmp    8012c3 <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801334:	83 ec 0c             	sub    $0xc,%esp
+  801337:	50                   	push   %eax
+  801338:	6a 04                	push   $0x4
+  80133a:	68 19 35 80 00       	push   $0x803519
+  80133f:	6a 4a                	push   $0x4a
+  801341:	68 36 35 80 00       	push   $0x803536
+  801346:	e8 03 f0 ff ff       	call   80034e <_panic>
+
+0080134b <sys_page_map>:
+{
+  80134b:	55                   	push   %ebp
+  80134c:	89 e5                	mov    %esp,%ebp
+  80134e:	57                   	push   %edi
+  80134f:	56                   	push   %esi
+  801350:	53                   	push   %ebx
+  801351:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801354:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80135b:	78 37                	js     801394 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  80135d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801364:	74 7a                	je     8013e0 <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  801366:	8b 55 08             	mov    0x8(%ebp),%edx
+  801369:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80136c:	b8 05 00 00 00       	mov    $0x5,%eax
+  801371:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801374:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801377:	8b 75 18             	mov    0x18(%ebp),%esi
+  80137a:	55                   	push   %ebp
+  80137b:	68 84 13 80 00       	push   $0x801384
+  801380:	89 e5                	mov    %esp,%ebp
+  801382:	0f 34                	sysenter
+  801384:	83 c4 04             	add    $0x4,%esp
+  801387:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801388:	85 c0                	test   %eax,%eax
+  80138a:	7f 6c                	jg     8013f8 <sys_page_map+0xad>
+}
+  80138c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80138f:	5b                   	pop    %ebx
+  801390:	5e                   	pop    %esi
+  801391:	5f                   	pop    %edi
+  801392:	5d                   	pop    %ebp
+  801393:	c3                   	ret
+  801394:	b8 01 00 00 00       	mov    $0x1,%eax
+  801399:	0f a2                	cpuid
+		return 0;
+  80139b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8013a0:	f6 c6 08             	test   $0x8,%dh
+  8013a3:	74 15                	je     8013ba <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013a5:	89 c2                	mov    %eax,%edx
+  8013a7:	c1 ea 08             	shr    $0x8,%edx
+  8013aa:	83 e2 0f             	and    $0xf,%edx
+  8013ad:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8013b2:	83 fa 06             	cmp    $0x6,%edx
+  8013b5:	74 0e                	je     8013c5 <sys_page_map+0x7a>
+  8013b7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8013ba:	0f b6 c9             	movzbl %cl,%ecx
+  8013bd:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8013c3:	eb 98                	jmp    80135d <sys_page_map+0x12>
+  8013c5:	89 c2                	mov    %eax,%edx
+  8013c7:	c1 ea 04             	shr    $0x4,%edx
+  8013ca:	83 e2 0f             	and    $0xf,%edx
+  8013cd:	83 fa 02             	cmp    $0x2,%edx
+  8013d0:	77 e5                	ja     8013b7 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  8013d2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013d5:	83 f8 02             	cmp    $0x2,%eax
+  8013d8:	0f 97 c1             	seta   %cl
+  8013db:	0f b6 c9             	movzbl %cl,%ecx
+  8013de:	eb d7                	jmp    8013b7 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  8013e0:	b8 05 00 00 00       	mov    $0x5,%eax
+  8013e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013eb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013ee:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013f1:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013f4:	cd 30                	int    $0x30
+  8013f6:	eb 90                	jmp    801388 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013f8:	83 ec 0c             	sub    $0xc,%esp
+  8013fb:	50                   	push   %eax
+  8013fc:	6a 05                	push   $0x5
+  8013fe:	68 19 35 80 00       	push   $0x803519
+  801403:	6a 4a                	push   $0x4a
+  801405:	68 36 35 80 00       	push   $0x803536
+  80140a:	e8 3f ef ff ff       	call   80034e <_panic>
+
+0080140f <sys_page_unmap>:
+{
+  80140f:	55                   	push   %ebp
+  801410:	89 e5                	mov    %esp,%ebp
+  801412:	57                   	push   %edi
+  801413:	56                   	push   %esi
+  801414:	53                   	push   %ebx
+  801415:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801418:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80141f:	78 37                	js     801458 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  801421:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801428:	74 7a                	je     8014a4 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  80142a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80142f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801432:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801435:	b8 06 00 00 00       	mov    $0x6,%eax
+  80143a:	89 df                	mov    %ebx,%edi
+  80143c:	89 de                	mov    %ebx,%esi
+  80143e:	55                   	push   %ebp
+  80143f:	68 48 14 80 00       	push   $0x801448
+  801444:	89 e5                	mov    %esp,%ebp
+  801446:	0f 34                	sysenter
+  801448:	83 c4 04             	add    $0x4,%esp
+  80144b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80144c:	85 c0                	test   %eax,%eax
+  80144e:	7f 6c                	jg     8014bc <sys_page_unmap+0xad>
+}
+  801450:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801453:	5b                   	pop    %ebx
+  801454:	5e                   	pop    %esi
+  801455:	5f                   	pop    %edi
+  801456:	5d                   	pop    %ebp
+  801457:	c3                   	ret
+  801458:	b8 01 00 00 00       	mov    $0x1,%eax
+  80145d:	0f a2                	cpuid
+		return 0;
+  80145f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801464:	f6 c6 08             	test   $0x8,%dh
+  801467:	74 15                	je     80147e <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801469:	89 c2                	mov    %eax,%edx
+  80146b:	c1 ea 08             	shr    $0x8,%edx
+  80146e:	83 e2 0f             	and    $0xf,%edx
+  801471:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801476:	83 fa 06             	cmp    $0x6,%edx
+  801479:	74 0e                	je     801489 <sys_page_unmap+0x7a>
+  80147b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80147e:	0f b6 c9             	movzbl %cl,%ecx
+  801481:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801487:	eb 98                	jmp    801421 <sys_page_unmap+0x12>
+  801489:	89 c2                	mov    %eax,%edx
+  80148b:	c1 ea 04             	shr    $0x4,%edx
+  80148e:	83 e2 0f             	and    $0xf,%edx
+  801491:	83 fa 02             	cmp    $0x2,%edx
+  801494:	77 e5                	ja     80147b <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  801496:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801499:	83 f8 02             	cmp    $0x2,%eax
+  80149c:	0f 97 c1             	seta   %cl
+  80149f:	0f b6 c9             	movzbl %cl,%ecx
+  8014a2:	eb d7                	jmp    80147b <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  8014a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014a9:	b8 06 00 00 00       	mov    $0x6,%eax
+  8014ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b4:	89 df                	mov    %ebx,%edi
+  8014b6:	89 de                	mov    %ebx,%esi
+  8014b8:	cd 30                	int    $0x30
+  8014ba:	eb 90                	jmp    80144c <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014bc:	83 ec 0c             	sub    $0xc,%esp
+  8014bf:	50                   	push   %eax
+  8014c0:	6a 06                	push   $0x6
+  8014c2:	68 19 35 80 00       	push   $0x803519
+  8014c7:	6a 4a                	push   $0x4a
+  8014c9:	68 36 35 80 00       	push   $0x803536
+  8014ce:	e8 7b ee ff ff       	call   80034e <_panic>
+
+008014d3 <sys_page_copy>:
+{
+  8014d3:	55                   	push   %ebp
+  8014d4:	89 e5                	mov    %esp,%ebp
+  8014d6:	57                   	push   %edi
+  8014d7:	56                   	push   %esi
+  8014d8:	53                   	push   %ebx
+  8014d9:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8014dc:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8014e3:	78 37                	js     80151c <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  8014e5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8014ec:	74 7a                	je     801568 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  8014ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f4:	b8 29 00 00 00       	mov    $0x29,%eax
+  8014f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014fc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014ff:	8b 75 18             	mov    0x18(%ebp),%esi
+  801502:	55                   	push   %ebp
+  801503:	68 0c 15 80 00       	push   $0x80150c
+  801508:	89 e5                	mov    %esp,%ebp
+  80150a:	0f 34                	sysenter
+  80150c:	83 c4 04             	add    $0x4,%esp
+  80150f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801510:	85 c0                	test   %eax,%eax
+  801512:	7f 6c                	jg     801580 <sys_page_copy+0xad>
+}
+  801514:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801517:	5b                   	pop    %ebx
+  801518:	5e                   	pop    %esi
+  801519:	5f                   	pop    %edi
+  80151a:	5d                   	pop    %ebp
+  80151b:	c3                   	ret
+  80151c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801521:	0f a2                	cpuid
+		return 0;
+  801523:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801528:	f6 c6 08             	test   $0x8,%dh
+  80152b:	74 15                	je     801542 <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80152d:	89 c2                	mov    %eax,%edx
+  80152f:	c1 ea 08             	shr    $0x8,%edx
+  801532:	83 e2 0f             	and    $0xf,%edx
+  801535:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80153a:	83 fa 06             	cmp    $0x6,%edx
+  80153d:	74 0e                	je     80154d <sys_page_copy+0x7a>
+  80153f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801542:	0f b6 c9             	movzbl %cl,%ecx
+  801545:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80154b:	eb 98                	jmp    8014e5 <sys_page_copy+0x12>
+  80154d:	89 c2                	mov    %eax,%edx
+  80154f:	c1 ea 04             	shr    $0x4,%edx
+  801552:	83 e2 0f             	and    $0xf,%edx
+  801555:	83 fa 02             	cmp    $0x2,%edx
+  801558:	77 e5                	ja     80153f <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  80155a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80155d:	83 f8 02             	cmp    $0x2,%eax
+  801560:	0f 97 c1             	seta   %cl
+  801563:	0f b6 c9             	movzbl %cl,%ecx
+  801566:	eb d7                	jmp    80153f <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  801568:	b8 29 00 00 00       	mov    $0x29,%eax
+  80156d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801570:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801573:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801576:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801579:	8b 75 18             	mov    0x18(%ebp),%esi
+  80157c:	cd 30                	int    $0x30
+  80157e:	eb 90                	jmp    801510 <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801580:	83 ec 0c             	sub    $0xc,%esp
+  801583:	50                   	push   %eax
+  801584:	6a 29                	push   $0x29
+  801586:	68 19 35 80 00       	push   $0x803519
+  80158b:	6a 4a                	push   $0x4a
+  80158d:	68 36 35 80 00       	push   $0x803536
+  801592:	e8 b7 ed ff ff       	call   80034e <_panic>
+
+00801597 <sys_yield>:
+{
+  801597:	55                   	push   %ebp
+  801598:	89 e5                	mov    %esp,%ebp
+  80159a:	57                   	push   %edi
+  80159b:	56                   	push   %esi
+  80159c:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80159d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8015a4:	78 2e                	js     8015d4 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  8015a6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8015ad:	74 71                	je     801620 <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  8015af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015b4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8015b9:	89 d1                	mov    %edx,%ecx
+  8015bb:	89 d3                	mov    %edx,%ebx
+  8015bd:	89 d7                	mov    %edx,%edi
+  8015bf:	89 d6                	mov    %edx,%esi
+  8015c1:	55                   	push   %ebp
+  8015c2:	68 cb 15 80 00       	push   $0x8015cb
+  8015c7:	89 e5                	mov    %esp,%ebp
+  8015c9:	0f 34                	sysenter
+  8015cb:	83 c4 04             	add    $0x4,%esp
+  8015ce:	5d                   	pop    %ebp
+}
+  8015cf:	5b                   	pop    %ebx
+  8015d0:	5e                   	pop    %esi
+  8015d1:	5f                   	pop    %edi
+  8015d2:	5d                   	pop    %ebp
+  8015d3:	c3                   	ret
+  8015d4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015d9:	0f a2                	cpuid
+		return 0;
+  8015db:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8015e0:	f6 c6 08             	test   $0x8,%dh
+  8015e3:	74 15                	je     8015fa <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015e5:	89 c2                	mov    %eax,%edx
+  8015e7:	c1 ea 08             	shr    $0x8,%edx
+  8015ea:	83 e2 0f             	and    $0xf,%edx
+  8015ed:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8015f2:	83 fa 06             	cmp    $0x6,%edx
+  8015f5:	74 0e                	je     801605 <sys_yield+0x6e>
+  8015f7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8015fa:	0f b6 c9             	movzbl %cl,%ecx
+  8015fd:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801603:	eb a1                	jmp    8015a6 <sys_yield+0xf>
+  801605:	89 c2                	mov    %eax,%edx
+  801607:	c1 ea 04             	shr    $0x4,%edx
+  80160a:	83 e2 0f             	and    $0xf,%edx
+  80160d:	83 fa 02             	cmp    $0x2,%edx
+  801610:	77 e5                	ja     8015f7 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  801612:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801615:	83 f8 02             	cmp    $0x2,%eax
+  801618:	0f 97 c1             	seta   %cl
+  80161b:	0f b6 c9             	movzbl %cl,%ecx
+  80161e:	eb d7                	jmp    8015f7 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  801620:	ba 00 00 00 00       	mov    $0x0,%edx
+  801625:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80162a:	89 d1                	mov    %edx,%ecx
+  80162c:	89 d3                	mov    %edx,%ebx
+  80162e:	89 d7                	mov    %edx,%edi
+  801630:	89 d6                	mov    %edx,%esi
+  801632:	cd 30                	int    $0x30
+}
+  801634:	eb 99                	jmp    8015cf <sys_yield+0x38>
+
+00801636 <sys_env_set_status>:
+{
+  801636:	55                   	push   %ebp
+  801637:	89 e5                	mov    %esp,%ebp
+  801639:	57                   	push   %edi
+  80163a:	56                   	push   %esi
+  80163b:	53                   	push   %ebx
+  80163c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80163f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801646:	78 37                	js     80167f <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  801648:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80164f:	74 7a                	je     8016cb <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  801651:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801656:	8b 55 08             	mov    0x8(%ebp),%edx
+  801659:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80165c:	b8 08 00 00 00       	mov    $0x8,%eax
+  801661:	89 df                	mov    %ebx,%edi
+  801663:	89 de                	mov    %ebx,%esi
+  801665:	55                   	push   %ebp
+  801666:	68 6f 16 80 00       	push   $0x80166f
+  80166b:	89 e5                	mov    %esp,%ebp
+  80166d:	0f 34                	sysenter
+  80166f:	83 c4 04             	add    $0x4,%esp
+  801672:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801673:	85 c0                	test   %eax,%eax
+  801675:	7f 6c                	jg     8016e3 <sys_env_set_status+0xad>
+}
+  801677:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80167a:	5b                   	pop    %ebx
+  80167b:	5e                   	pop    %esi
+  80167c:	5f                   	pop    %edi
+  80167d:	5d                   	pop    %ebp
+  80167e:	c3                   	ret
+  80167f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801684:	0f a2                	cpuid
+		return 0;
+  801686:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80168b:	f6 c6 08             	test   $0x8,%dh
+  80168e:	74 15                	je     8016a5 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801690:	89 c2                	mov    %eax,%edx
+  801692:	c1 ea 08             	shr    $0x8,%edx
+  801695:	83 e2 0f             	and    $0xf,%edx
+  801698:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80169d:	83 fa 06             	cmp    $0x6,%edx
+  8016a0:	74 0e                	je     8016b0 <sys_env_set_status+0x7a>
+  8016a2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8016a5:	0f b6 c9             	movzbl %cl,%ecx
+  8016a8:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8016ae:	eb 98                	jmp    801648 <sys_env_set_status+0x12>
+  8016b0:	89 c2                	mov    %eax,%edx
+  8016b2:	c1 ea 04             	shr    $0x4,%edx
+  8016b5:	83 e2 0f             	and    $0xf,%edx
+  8016b8:	83 fa 02             	cmp    $0x2,%edx
+  8016bb:	77 e5                	ja     8016a2 <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  8016bd:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016c0:	83 f8 02             	cmp    $0x2,%eax
+  8016c3:	0f 97 c1             	seta   %cl
+  8016c6:	0f b6 c9             	movzbl %cl,%ecx
+  8016c9:	eb d7                	jmp    8016a2 <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  8016cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016d0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8016d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016db:	89 df                	mov    %ebx,%edi
+  8016dd:	89 de                	mov    %ebx,%esi
+  8016df:	cd 30                	int    $0x30
+  8016e1:	eb 90                	jmp    801673 <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016e3:	83 ec 0c             	sub    $0xc,%esp
+  8016e6:	50                   	push   %eax
+  8016e7:	6a 08                	push   $0x8
+  8016e9:	68 19 35 80 00       	push   $0x803519
+  8016ee:	6a 4a                	push   $0x4a
+  8016f0:	68 36 35 80 00       	push   $0x803536
+  8016f5:	e8 54 ec ff ff       	call   80034e <_panic>
+
+008016fa <sys_sysinfo>:
+{
+  8016fa:	55                   	push   %ebp
+  8016fb:	89 e5                	mov    %esp,%ebp
+  8016fd:	57                   	push   %edi
+  8016fe:	56                   	push   %esi
+  8016ff:	53                   	push   %ebx
+  801700:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801703:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80170a:	78 36                	js     801742 <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  80170c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801713:	74 79                	je     80178e <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  801715:	8b 55 08             	mov    0x8(%ebp),%edx
+  801718:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80171d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801722:	89 cb                	mov    %ecx,%ebx
+  801724:	89 cf                	mov    %ecx,%edi
+  801726:	89 ce                	mov    %ecx,%esi
+  801728:	55                   	push   %ebp
+  801729:	68 32 17 80 00       	push   $0x801732
+  80172e:	89 e5                	mov    %esp,%ebp
+  801730:	0f 34                	sysenter
+  801732:	83 c4 04             	add    $0x4,%esp
+  801735:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801736:	85 c0                	test   %eax,%eax
+  801738:	7f 6b                	jg     8017a5 <sys_sysinfo+0xab>
+}
+  80173a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80173d:	5b                   	pop    %ebx
+  80173e:	5e                   	pop    %esi
+  80173f:	5f                   	pop    %edi
+  801740:	5d                   	pop    %ebp
+  801741:	c3                   	ret
+  801742:	b8 01 00 00 00       	mov    $0x1,%eax
+  801747:	0f a2                	cpuid
+		return 0;
+  801749:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80174e:	f6 c6 08             	test   $0x8,%dh
+  801751:	74 15                	je     801768 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801753:	89 c2                	mov    %eax,%edx
+  801755:	c1 ea 08             	shr    $0x8,%edx
+  801758:	83 e2 0f             	and    $0xf,%edx
+  80175b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801760:	83 fa 06             	cmp    $0x6,%edx
+  801763:	74 0e                	je     801773 <sys_sysinfo+0x79>
+  801765:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801768:	0f b6 c9             	movzbl %cl,%ecx
+  80176b:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801771:	eb 99                	jmp    80170c <sys_sysinfo+0x12>
+  801773:	89 c2                	mov    %eax,%edx
+  801775:	c1 ea 04             	shr    $0x4,%edx
+  801778:	83 e2 0f             	and    $0xf,%edx
+  80177b:	83 fa 02             	cmp    $0x2,%edx
+  80177e:	77 e5                	ja     801765 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  801780:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801783:	83 f8 02             	cmp    $0x2,%eax
+  801786:	0f 97 c1             	seta   %cl
+  801789:	0f b6 c9             	movzbl %cl,%ecx
+  80178c:	eb d7                	jmp    801765 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  80178e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801793:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801798:	8b 55 08             	mov    0x8(%ebp),%edx
+  80179b:	89 cb                	mov    %ecx,%ebx
+  80179d:	89 cf                	mov    %ecx,%edi
+  80179f:	89 ce                	mov    %ecx,%esi
+  8017a1:	cd 30                	int    $0x30
+  8017a3:	eb 91                	jmp    801736 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017a5:	83 ec 0c             	sub    $0xc,%esp
+  8017a8:	50                   	push   %eax
+  8017a9:	6a 0b                	push   $0xb
+  8017ab:	68 19 35 80 00       	push   $0x803519
+  8017b0:	6a 4a                	push   $0x4a
+  8017b2:	68 36 35 80 00       	push   $0x803536
+  8017b7:	e8 92 eb ff ff       	call   80034e <_panic>
+
+008017bc <sys_env_set_trapframe>:
+{
+  8017bc:	55                   	push   %ebp
+  8017bd:	89 e5                	mov    %esp,%ebp
+  8017bf:	57                   	push   %edi
+  8017c0:	56                   	push   %esi
+  8017c1:	53                   	push   %ebx
+  8017c2:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8017c5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8017cc:	78 37                	js     801805 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  8017ce:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8017d5:	74 7a                	je     801851 <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  8017d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017e2:	b8 13 00 00 00       	mov    $0x13,%eax
+  8017e7:	89 df                	mov    %ebx,%edi
+  8017e9:	89 de                	mov    %ebx,%esi
+  8017eb:	55                   	push   %ebp
+  8017ec:	68 f5 17 80 00       	push   $0x8017f5
+  8017f1:	89 e5                	mov    %esp,%ebp
+  8017f3:	0f 34                	sysenter
+  8017f5:	83 c4 04             	add    $0x4,%esp
+  8017f8:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8017f9:	85 c0                	test   %eax,%eax
+  8017fb:	7f 6c                	jg     801869 <sys_env_set_trapframe+0xad>
+}
+  8017fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801800:	5b                   	pop    %ebx
+  801801:	5e                   	pop    %esi
+  801802:	5f                   	pop    %edi
+  801803:	5d                   	pop    %ebp
+  801804:	c3                   	ret
+  801805:	b8 01 00 00 00       	mov    $0x1,%eax
+  80180a:	0f a2                	cpuid
+		return 0;
+  80180c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801811:	f6 c6 08             	test   $0x8,%dh
+  801814:	74 15                	je     80182b <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801816:	89 c2                	mov    %eax,%edx
+  801818:	c1 ea 08             	shr    $0x8,%edx
+  80181b:	83 e2 0f             	and    $0xf,%edx
+  80181e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801823:	83 fa 06             	cmp    $0x6,%edx
+  801826:	74 0e                	je     801836 <sys_env_set_trapframe+0x7a>
+  801828:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80182b:	0f b6 c9             	movzbl %cl,%ecx
+  80182e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801834:	eb 98                	jmp    8017ce <sys_env_set_trapframe+0x12>
+  801836:	89 c2                	mov    %eax,%edx
+  801838:	c1 ea 04             	shr    $0x4,%edx
+  80183b:	83 e2 0f             	and    $0xf,%edx
+  80183e:	83 fa 02             	cmp    $0x2,%edx
+  801841:	77 e5                	ja     801828 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  801843:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801846:	83 f8 02             	cmp    $0x2,%eax
+  801849:	0f 97 c1             	seta   %cl
+  80184c:	0f b6 c9             	movzbl %cl,%ecx
+  80184f:	eb d7                	jmp    801828 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  801851:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801856:	b8 13 00 00 00       	mov    $0x13,%eax
+  80185b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80185e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801861:	89 df                	mov    %ebx,%edi
+  801863:	89 de                	mov    %ebx,%esi
+  801865:	cd 30                	int    $0x30
+  801867:	eb 90                	jmp    8017f9 <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801869:	83 ec 0c             	sub    $0xc,%esp
+  80186c:	50                   	push   %eax
+  80186d:	6a 13                	push   $0x13
+  80186f:	68 19 35 80 00       	push   $0x803519
+  801874:	6a 4a                	push   $0x4a
+  801876:	68 36 35 80 00       	push   $0x803536
+  80187b:	e8 ce ea ff ff       	call   80034e <_panic>
+
+00801880 <sys_env_set_stack_limit>:
+{
+  801880:	55                   	push   %ebp
+  801881:	89 e5                	mov    %esp,%ebp
+  801883:	57                   	push   %edi
+  801884:	56                   	push   %esi
+  801885:	53                   	push   %ebx
+  801886:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801889:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801890:	78 37                	js     8018c9 <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  801892:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801899:	74 7a                	je     801915 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  80189b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018a6:	b8 19 00 00 00       	mov    $0x19,%eax
+  8018ab:	89 df                	mov    %ebx,%edi
+  8018ad:	89 de                	mov    %ebx,%esi
+  8018af:	55                   	push   %ebp
+  8018b0:	68 b9 18 80 00       	push   $0x8018b9
+  8018b5:	89 e5                	mov    %esp,%ebp
+  8018b7:	0f 34                	sysenter
+  8018b9:	83 c4 04             	add    $0x4,%esp
+  8018bc:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8018bd:	85 c0                	test   %eax,%eax
+  8018bf:	7f 6c                	jg     80192d <sys_env_set_stack_limit+0xad>
+}
+  8018c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018c4:	5b                   	pop    %ebx
+  8018c5:	5e                   	pop    %esi
+  8018c6:	5f                   	pop    %edi
+  8018c7:	5d                   	pop    %ebp
+  8018c8:	c3                   	ret
+  8018c9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018ce:	0f a2                	cpuid
+		return 0;
+  8018d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018d5:	f6 c6 08             	test   $0x8,%dh
+  8018d8:	74 15                	je     8018ef <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018da:	89 c2                	mov    %eax,%edx
+  8018dc:	c1 ea 08             	shr    $0x8,%edx
+  8018df:	83 e2 0f             	and    $0xf,%edx
+  8018e2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018e7:	83 fa 06             	cmp    $0x6,%edx
+  8018ea:	74 0e                	je     8018fa <sys_env_set_stack_limit+0x7a>
+  8018ec:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8018ef:	0f b6 c9             	movzbl %cl,%ecx
+  8018f2:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8018f8:	eb 98                	jmp    801892 <sys_env_set_stack_limit+0x12>
+  8018fa:	89 c2                	mov    %eax,%edx
+  8018fc:	c1 ea 04             	shr    $0x4,%edx
+  8018ff:	83 e2 0f             	and    $0xf,%edx
+  801902:	83 fa 02             	cmp    $0x2,%edx
+  801905:	77 e5                	ja     8018ec <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  801907:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80190a:	83 f8 02             	cmp    $0x2,%eax
+  80190d:	0f 97 c1             	seta   %cl
+  801910:	0f b6 c9             	movzbl %cl,%ecx
+  801913:	eb d7                	jmp    8018ec <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  801915:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80191a:	b8 19 00 00 00       	mov    $0x19,%eax
+  80191f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801922:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801925:	89 df                	mov    %ebx,%edi
+  801927:	89 de                	mov    %ebx,%esi
+  801929:	cd 30                	int    $0x30
+  80192b:	eb 90                	jmp    8018bd <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80192d:	83 ec 0c             	sub    $0xc,%esp
+  801930:	50                   	push   %eax
+  801931:	6a 19                	push   $0x19
+  801933:	68 19 35 80 00       	push   $0x803519
+  801938:	6a 4a                	push   $0x4a
+  80193a:	68 36 35 80 00       	push   $0x803536
+  80193f:	e8 0a ea ff ff       	call   80034e <_panic>
+
+00801944 <sys_env_set_pgfault_upcall>:
+{
+  801944:	55                   	push   %ebp
+  801945:	89 e5                	mov    %esp,%ebp
+  801947:	57                   	push   %edi
+  801948:	56                   	push   %esi
+  801949:	53                   	push   %ebx
+  80194a:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80194d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801954:	78 37                	js     80198d <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  801956:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80195d:	74 7a                	je     8019d9 <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  80195f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801964:	8b 55 08             	mov    0x8(%ebp),%edx
+  801967:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80196a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80196f:	89 df                	mov    %ebx,%edi
+  801971:	89 de                	mov    %ebx,%esi
+  801973:	55                   	push   %ebp
+  801974:	68 7d 19 80 00       	push   $0x80197d
+  801979:	89 e5                	mov    %esp,%ebp
+  80197b:	0f 34                	sysenter
+  80197d:	83 c4 04             	add    $0x4,%esp
+  801980:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801981:	85 c0                	test   %eax,%eax
+  801983:	7f 6c                	jg     8019f1 <sys_env_set_pgfault_upcall+0xad>
+}
+  801985:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801988:	5b                   	pop    %ebx
+  801989:	5e                   	pop    %esi
+  80198a:	5f                   	pop    %edi
+  80198b:	5d                   	pop    %ebp
+  80198c:	c3                   	ret
+  80198d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801992:	0f a2                	cpuid
+		return 0;
+  801994:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801999:	f6 c6 08             	test   $0x8,%dh
+  80199c:	74 15                	je     8019b3 <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80199e:	89 c2                	mov    %eax,%edx
+  8019a0:	c1 ea 08             	shr    $0x8,%edx
+  8019a3:	83 e2 0f             	and    $0xf,%edx
+  8019a6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019ab:	83 fa 06             	cmp    $0x6,%edx
+  8019ae:	74 0e                	je     8019be <sys_env_set_pgfault_upcall+0x7a>
+  8019b0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8019b3:	0f b6 c9             	movzbl %cl,%ecx
+  8019b6:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8019bc:	eb 98                	jmp    801956 <sys_env_set_pgfault_upcall+0x12>
+  8019be:	89 c2                	mov    %eax,%edx
+  8019c0:	c1 ea 04             	shr    $0x4,%edx
+  8019c3:	83 e2 0f             	and    $0xf,%edx
+  8019c6:	83 fa 02             	cmp    $0x2,%edx
+  8019c9:	77 e5                	ja     8019b0 <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  8019cb:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019ce:	83 f8 02             	cmp    $0x2,%eax
+  8019d1:	0f 97 c1             	seta   %cl
+  8019d4:	0f b6 c9             	movzbl %cl,%ecx
+  8019d7:	eb d7                	jmp    8019b0 <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  8019d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019de:	b8 09 00 00 00       	mov    $0x9,%eax
+  8019e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019e9:	89 df                	mov    %ebx,%edi
+  8019eb:	89 de                	mov    %ebx,%esi
+  8019ed:	cd 30                	int    $0x30
+  8019ef:	eb 90                	jmp    801981 <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8019f1:	83 ec 0c             	sub    $0xc,%esp
+  8019f4:	50                   	push   %eax
+  8019f5:	6a 09                	push   $0x9
+  8019f7:	68 19 35 80 00       	push   $0x803519
+  8019fc:	6a 4a                	push   $0x4a
+  8019fe:	68 36 35 80 00       	push   $0x803536
+  801a03:	e8 46 e9 ff ff       	call   80034e <_panic>
+
+00801a08 <sys_ipc_try_send>:
+{
+  801a08:	55                   	push   %ebp
+  801a09:	89 e5                	mov    %esp,%ebp
+  801a0b:	57                   	push   %edi
+  801a0c:	56                   	push   %esi
+  801a0d:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801a0e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a15:	78 32                	js     801a49 <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  801a17:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a1e:	74 75                	je     801a95 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801a20:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a26:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801a2b:	be 00 00 00 00       	mov    $0x0,%esi
+  801a30:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a33:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a36:	55                   	push   %ebp
+  801a37:	68 40 1a 80 00       	push   $0x801a40
+  801a3c:	89 e5                	mov    %esp,%ebp
+  801a3e:	0f 34                	sysenter
+  801a40:	83 c4 04             	add    $0x4,%esp
+  801a43:	5d                   	pop    %ebp
+}
+  801a44:	5b                   	pop    %ebx
+  801a45:	5e                   	pop    %esi
+  801a46:	5f                   	pop    %edi
+  801a47:	5d                   	pop    %ebp
+  801a48:	c3                   	ret
+  801a49:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a4e:	0f a2                	cpuid
+		return 0;
+  801a50:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801a55:	f6 c6 08             	test   $0x8,%dh
+  801a58:	74 15                	je     801a6f <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a5a:	89 c2                	mov    %eax,%edx
+  801a5c:	c1 ea 08             	shr    $0x8,%edx
+  801a5f:	83 e2 0f             	and    $0xf,%edx
+  801a62:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a67:	83 fa 06             	cmp    $0x6,%edx
+  801a6a:	74 0e                	je     801a7a <sys_ipc_try_send+0x72>
+  801a6c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a6f:	0f b6 c9             	movzbl %cl,%ecx
+  801a72:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801a78:	eb 9d                	jmp    801a17 <sys_ipc_try_send+0xf>
+  801a7a:	89 c2                	mov    %eax,%edx
+  801a7c:	c1 ea 04             	shr    $0x4,%edx
+  801a7f:	83 e2 0f             	and    $0xf,%edx
+  801a82:	83 fa 02             	cmp    $0x2,%edx
+  801a85:	77 e5                	ja     801a6c <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  801a87:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a8a:	83 f8 02             	cmp    $0x2,%eax
+  801a8d:	0f 97 c1             	seta   %cl
+  801a90:	0f b6 c9             	movzbl %cl,%ecx
+  801a93:	eb d7                	jmp    801a6c <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  801a95:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801a9a:	be 00 00 00 00       	mov    $0x0,%esi
+  801a9f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aa2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801aa5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801aa8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801aab:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801aad:	eb 95                	jmp    801a44 <sys_ipc_try_send+0x3c>
+
+00801aaf <sys_ipc_send>:
+{
+  801aaf:	55                   	push   %ebp
+  801ab0:	89 e5                	mov    %esp,%ebp
+  801ab2:	57                   	push   %edi
+  801ab3:	56                   	push   %esi
+  801ab4:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801ab5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801abc:	78 32                	js     801af0 <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  801abe:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ac5:	74 75                	je     801b3c <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801ac7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801acd:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801ad2:	be 00 00 00 00       	mov    $0x0,%esi
+  801ad7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ada:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801add:	55                   	push   %ebp
+  801ade:	68 e7 1a 80 00       	push   $0x801ae7
+  801ae3:	89 e5                	mov    %esp,%ebp
+  801ae5:	0f 34                	sysenter
+  801ae7:	83 c4 04             	add    $0x4,%esp
+  801aea:	5d                   	pop    %ebp
+}
+  801aeb:	5b                   	pop    %ebx
+  801aec:	5e                   	pop    %esi
+  801aed:	5f                   	pop    %edi
+  801aee:	5d                   	pop    %ebp
+  801aef:	c3                   	ret
+  801af0:	b8 01 00 00 00       	mov    $0x1,%eax
+  801af5:	0f a2                	cpuid
+		return 0;
+  801af7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801afc:	f6 c6 08             	test   $0x8,%dh
+  801aff:	74 15                	je     801b16 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b01:	89 c2                	mov    %eax,%edx
+  801b03:	c1 ea 08             	shr    $0x8,%edx
+  801b06:	83 e2 0f             	and    $0xf,%edx
+  801b09:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b0e:	83 fa 06             	cmp    $0x6,%edx
+  801b11:	74 0e                	je     801b21 <sys_ipc_send+0x72>
+  801b13:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b16:	0f b6 c9             	movzbl %cl,%ecx
+  801b19:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801b1f:	eb 9d                	jmp    801abe <sys_ipc_send+0xf>
+  801b21:	89 c2                	mov    %eax,%edx
+  801b23:	c1 ea 04             	shr    $0x4,%edx
+  801b26:	83 e2 0f             	and    $0xf,%edx
+  801b29:	83 fa 02             	cmp    $0x2,%edx
+  801b2c:	77 e5                	ja     801b13 <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  801b2e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b31:	83 f8 02             	cmp    $0x2,%eax
+  801b34:	0f 97 c1             	seta   %cl
+  801b37:	0f b6 c9             	movzbl %cl,%ecx
+  801b3a:	eb d7                	jmp    801b13 <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  801b3c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801b41:	be 00 00 00 00       	mov    $0x0,%esi
+  801b46:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b49:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b4c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b4f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801b52:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801b54:	eb 95                	jmp    801aeb <sys_ipc_send+0x3c>
+
+00801b56 <sys_ipc_recv>:
+{
+  801b56:	55                   	push   %ebp
+  801b57:	89 e5                	mov    %esp,%ebp
+  801b59:	57                   	push   %edi
+  801b5a:	56                   	push   %esi
+  801b5b:	53                   	push   %ebx
+  801b5c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801b5f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b66:	78 36                	js     801b9e <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  801b68:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b6f:	74 79                	je     801bea <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  801b71:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b74:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b79:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801b7e:	89 cb                	mov    %ecx,%ebx
+  801b80:	89 cf                	mov    %ecx,%edi
+  801b82:	89 ce                	mov    %ecx,%esi
+  801b84:	55                   	push   %ebp
+  801b85:	68 8e 1b 80 00       	push   $0x801b8e
+  801b8a:	89 e5                	mov    %esp,%ebp
+  801b8c:	0f 34                	sysenter
+  801b8e:	83 c4 04             	add    $0x4,%esp
+  801b91:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801b92:	85 c0                	test   %eax,%eax
+  801b94:	7f 6b                	jg     801c01 <sys_ipc_recv+0xab>
+}
+  801b96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b99:	5b                   	pop    %ebx
+  801b9a:	5e                   	pop    %esi
+  801b9b:	5f                   	pop    %edi
+  801b9c:	5d                   	pop    %ebp
+  801b9d:	c3                   	ret
+  801b9e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ba3:	0f a2                	cpuid
+		return 0;
+  801ba5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801baa:	f6 c6 08             	test   $0x8,%dh
+  801bad:	74 15                	je     801bc4 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801baf:	89 c2                	mov    %eax,%edx
+  801bb1:	c1 ea 08             	shr    $0x8,%edx
+  801bb4:	83 e2 0f             	and    $0xf,%edx
+  801bb7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801bbc:	83 fa 06             	cmp    $0x6,%edx
+  801bbf:	74 0e                	je     801bcf <sys_ipc_recv+0x79>
+  801bc1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801bc4:	0f b6 c9             	movzbl %cl,%ecx
+  801bc7:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801bcd:	eb 99                	jmp    801b68 <sys_ipc_recv+0x12>
+  801bcf:	89 c2                	mov    %eax,%edx
+  801bd1:	c1 ea 04             	shr    $0x4,%edx
+  801bd4:	83 e2 0f             	and    $0xf,%edx
+  801bd7:	83 fa 02             	cmp    $0x2,%edx
+  801bda:	77 e5                	ja     801bc1 <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  801bdc:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bdf:	83 f8 02             	cmp    $0x2,%eax
+  801be2:	0f 97 c1             	seta   %cl
+  801be5:	0f b6 c9             	movzbl %cl,%ecx
+  801be8:	eb d7                	jmp    801bc1 <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  801bea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bef:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801bf4:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bf7:	89 cb                	mov    %ecx,%ebx
+  801bf9:	89 cf                	mov    %ecx,%edi
+  801bfb:	89 ce                	mov    %ecx,%esi
+  801bfd:	cd 30                	int    $0x30
+  801bff:	eb 91                	jmp    801b92 <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801c01:	83 ec 0c             	sub    $0xc,%esp
+  801c04:	50                   	push   %eax
+  801c05:	6a 0d                	push   $0xd
+  801c07:	68 19 35 80 00       	push   $0x803519
+  801c0c:	6a 4a                	push   $0x4a
+  801c0e:	68 36 35 80 00       	push   $0x803536
+  801c13:	e8 36 e7 ff ff       	call   80034e <_panic>
+
+00801c18 <sys_ipc_send_range>:
+{
+  801c18:	55                   	push   %ebp
+  801c19:	89 e5                	mov    %esp,%ebp
+  801c1b:	57                   	push   %edi
+  801c1c:	56                   	push   %esi
+  801c1d:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801c1e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801c25:	78 30                	js     801c57 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  801c27:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801c2e:	74 73                	je     801ca3 <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801c30:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c33:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c36:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801c3b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801c3e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801c41:	8b 75 18             	mov    0x18(%ebp),%esi
+  801c44:	55                   	push   %ebp
+  801c45:	68 4e 1c 80 00       	push   $0x801c4e
+  801c4a:	89 e5                	mov    %esp,%ebp
+  801c4c:	0f 34                	sysenter
+  801c4e:	83 c4 04             	add    $0x4,%esp
+  801c51:	5d                   	pop    %ebp
+}
+  801c52:	5b                   	pop    %ebx
+  801c53:	5e                   	pop    %esi
+  801c54:	5f                   	pop    %edi
+  801c55:	5d                   	pop    %ebp
+  801c56:	c3                   	ret
+  801c57:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c5c:	0f a2                	cpuid
+		return 0;
+  801c5e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801c63:	f6 c6 08             	test   $0x8,%dh
+  801c66:	74 15                	je     801c7d <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c68:	89 c2                	mov    %eax,%edx
+  801c6a:	c1 ea 08             	shr    $0x8,%edx
+  801c6d:	83 e2 0f             	and    $0xf,%edx
+  801c70:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801c75:	83 fa 06             	cmp    $0x6,%edx
+  801c78:	74 0e                	je     801c88 <sys_ipc_send_range+0x70>
+  801c7a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801c7d:	0f b6 c9             	movzbl %cl,%ecx
+  801c80:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801c86:	eb 9f                	jmp    801c27 <sys_ipc_send_range+0xf>
+  801c88:	89 c2                	mov    %eax,%edx
+  801c8a:	c1 ea 04             	shr    $0x4,%edx
+  801c8d:	83 e2 0f             	and    $0xf,%edx
+  801c90:	83 fa 02             	cmp    $0x2,%edx
+  801c93:	77 e5                	ja     801c7a <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  801c95:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c98:	83 f8 02             	cmp    $0x2,%eax
+  801c9b:	0f 97 c1             	seta   %cl
+  801c9e:	0f b6 c9             	movzbl %cl,%ecx
+  801ca1:	eb d7                	jmp    801c7a <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  801ca3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801ca8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801cb1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801cb4:	8b 75 18             	mov    0x18(%ebp),%esi
+  801cb7:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  801cb9:	eb 97                	jmp    801c52 <sys_ipc_send_range+0x3a>
+
+00801cbb <sys_ipc_recv_range>:
+{
+  801cbb:	55                   	push   %ebp
+  801cbc:	89 e5                	mov    %esp,%ebp
+  801cbe:	57                   	push   %edi
+  801cbf:	56                   	push   %esi
+  801cc0:	53                   	push   %ebx
+  801cc1:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801cc4:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ccb:	78 37                	js     801d04 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  801ccd:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801cd4:	74 7a                	je     801d50 <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  801cd6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cdb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cde:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ce1:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801ce6:	89 df                	mov    %ebx,%edi
+  801ce8:	89 de                	mov    %ebx,%esi
+  801cea:	55                   	push   %ebp
+  801ceb:	68 f4 1c 80 00       	push   $0x801cf4
+  801cf0:	89 e5                	mov    %esp,%ebp
+  801cf2:	0f 34                	sysenter
+  801cf4:	83 c4 04             	add    $0x4,%esp
+  801cf7:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801cf8:	85 c0                	test   %eax,%eax
+  801cfa:	7f 6c                	jg     801d68 <sys_ipc_recv_range+0xad>
+}
+  801cfc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cff:	5b                   	pop    %ebx
+  801d00:	5e                   	pop    %esi
+  801d01:	5f                   	pop    %edi
+  801d02:	5d                   	pop    %ebp
+  801d03:	c3                   	ret
+  801d04:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d09:	0f a2                	cpuid
+		return 0;
+  801d0b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801d10:	f6 c6 08             	test   $0x8,%dh
+  801d13:	74 15                	je     801d2a <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d15:	89 c2                	mov    %eax,%edx
+  801d17:	c1 ea 08             	shr    $0x8,%edx
+  801d1a:	83 e2 0f             	and    $0xf,%edx
+  801d1d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d22:	83 fa 06             	cmp    $0x6,%edx
+  801d25:	74 0e                	je     801d35 <sys_ipc_recv_range+0x7a>
+  801d27:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801d2a:	0f b6 c9             	movzbl %cl,%ecx
+  801d2d:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801d33:	eb 98                	jmp    801ccd <sys_ipc_recv_range+0x12>
+  801d35:	89 c2                	mov    %eax,%edx
+  801d37:	c1 ea 04             	shr    $0x4,%edx
+  801d3a:	83 e2 0f             	and    $0xf,%edx
+  801d3d:	83 fa 02             	cmp    $0x2,%edx
+  801d40:	77 e5                	ja     801d27 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801d42:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d45:	83 f8 02             	cmp    $0x2,%eax
+  801d48:	0f 97 c1             	seta   %cl
+  801d4b:	0f b6 c9             	movzbl %cl,%ecx
+  801d4e:	eb d7                	jmp    801d27 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801d50:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d55:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801d5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d5d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d60:	89 df                	mov    %ebx,%edi
+  801d62:	89 de                	mov    %ebx,%esi
+  801d64:	cd 30                	int    $0x30
+  801d66:	eb 90                	jmp    801cf8 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801d68:	83 ec 0c             	sub    $0xc,%esp
+  801d6b:	50                   	push   %eax
+  801d6c:	6a 1f                	push   $0x1f
+  801d6e:	68 19 35 80 00       	push   $0x803519
+  801d73:	6a 4a                	push   $0x4a
+  801d75:	68 36 35 80 00       	push   $0x803536
+  801d7a:	e8 cf e5 ff ff       	call   80034e <_panic>
+
+00801d7f <sys_ipc_call>:
+{
+  801d7f:	55                   	push   %ebp
+  801d80:	89 e5                	mov    %esp,%ebp
+  801d82:	57                   	push   %edi
+  801d83:	56                   	push   %esi
+  801d84:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801d85:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d88:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801d8d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801d90:	55                   	push   %ebp
+  801d91:	56                   	push   %esi
+  801d92:	8b 0e                	mov    (%esi),%ecx
+  801d94:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801d97:	8b 7e 08             	mov    0x8(%esi),%edi
+  801d9a:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801d9d:	8b 76 0c             	mov    0xc(%esi),%esi
+  801da0:	cd 30                	int    $0x30
+  801da2:	87 34 24             	xchg   %esi,(%esp)
+  801da5:	89 0e                	mov    %ecx,(%esi)
+  801da7:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801daa:	89 7e 08             	mov    %edi,0x8(%esi)
+  801dad:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801db0:	8f 46 0c             	pop    0xc(%esi)
+  801db3:	5d                   	pop    %ebp
+}
+  801db4:	5b                   	pop    %ebx
+  801db5:	5e                   	pop    %esi
+  801db6:	5f                   	pop    %edi
+  801db7:	5d                   	pop    %ebp
+  801db8:	c3                   	ret
+
+00801db9 <sys_ipc_reply_wait>:
+{
+  801db9:	55                   	push   %ebp
+  801dba:	89 e5                	mov    %esp,%ebp
+  801dbc:	57                   	push   %edi
+  801dbd:	56                   	push   %esi
+  801dbe:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801dbf:	8b 55 08             	mov    0x8(%ebp),%edx
+  801dc2:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801dc7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801dca:	55                   	push   %ebp
+  801dcb:	56                   	push   %esi
+  801dcc:	8b 0e                	mov    (%esi),%ecx
+  801dce:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801dd1:	8b 7e 08             	mov    0x8(%esi),%edi
+  801dd4:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801dd7:	8b 76 0c             	mov    0xc(%esi),%esi
+  801dda:	cd 30                	int    $0x30
+  801ddc:	87 34 24             	xchg   %esi,(%esp)
+  801ddf:	89 0e                	mov    %ecx,(%esi)
+  801de1:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801de4:	89 7e 08             	mov    %edi,0x8(%esi)
+  801de7:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801dea:	8f 46 0c             	pop    0xc(%esi)
+  801ded:	5d                   	pop    %ebp
+}
+  801dee:	5b                   	pop    %ebx
+  801def:	5e                   	pop    %esi
+  801df0:	5f                   	pop    %edi
+  801df1:	5d                   	pop    %ebp
+  801df2:	c3                   	ret
+
+00801df3 <sys_ipc_send_msg>:
+{
+  801df3:	55                   	push   %ebp
+  801df4:	89 e5                	mov    %esp,%ebp
+  801df6:	57                   	push   %edi
+  801df7:	56                   	push   %esi
+  801df8:	53                   	push   %ebx
+  801df9:	83 ec 20             	sub    $0x20,%esp
+  801dfc:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801dff:	8b 10                	mov    (%eax),%edx
+  801e01:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801e04:	8b 50 04             	mov    0x4(%eax),%edx
+  801e07:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801e0a:	8b 50 08             	mov    0x8(%eax),%edx
+  801e0d:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801e10:	8b 50 0c             	mov    0xc(%eax),%edx
+  801e13:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801e16:	8b 40 10             	mov    0x10(%eax),%eax
+  801e19:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801e1c:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801e1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e22:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801e27:	55                   	push   %ebp
+  801e28:	56                   	push   %esi
+  801e29:	8b 0e                	mov    (%esi),%ecx
+  801e2b:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801e2e:	8b 7e 08             	mov    0x8(%esi),%edi
+  801e31:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801e34:	8b 76 0c             	mov    0xc(%esi),%esi
+  801e37:	cd 30                	int    $0x30
+  801e39:	87 34 24             	xchg   %esi,(%esp)
+  801e3c:	89 0e                	mov    %ecx,(%esi)
+  801e3e:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801e41:	89 7e 08             	mov    %edi,0x8(%esi)
+  801e44:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801e47:	8f 46 0c             	pop    0xc(%esi)
+  801e4a:	5d                   	pop    %ebp
+}
+  801e4b:	83 c4 20             	add    $0x20,%esp
+  801e4e:	5b                   	pop    %ebx
+  801e4f:	5e                   	pop    %esi
+  801e50:	5f                   	pop    %edi
+  801e51:	5d                   	pop    %ebp
+  801e52:	c3                   	ret
+
+00801e53 <sys_fork>:
+{
+  801e53:	55                   	push   %ebp
+  801e54:	89 e5                	mov    %esp,%ebp
+  801e56:	57                   	push   %edi
+  801e57:	56                   	push   %esi
+  801e58:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801e59:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e60:	78 2e                	js     801e90 <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801e62:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e69:	74 71                	je     801edc <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801e6b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e70:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801e75:	89 d1                	mov    %edx,%ecx
+  801e77:	89 d3                	mov    %edx,%ebx
+  801e79:	89 d7                	mov    %edx,%edi
+  801e7b:	89 d6                	mov    %edx,%esi
+  801e7d:	55                   	push   %ebp
+  801e7e:	68 87 1e 80 00       	push   $0x801e87
+  801e83:	89 e5                	mov    %esp,%ebp
+  801e85:	0f 34                	sysenter
+  801e87:	83 c4 04             	add    $0x4,%esp
+  801e8a:	5d                   	pop    %ebp
+}
+  801e8b:	5b                   	pop    %ebx
+  801e8c:	5e                   	pop    %esi
+  801e8d:	5f                   	pop    %edi
+  801e8e:	5d                   	pop    %ebp
+  801e8f:	c3                   	ret
+  801e90:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e95:	0f a2                	cpuid
+		return 0;
+  801e97:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801e9c:	f6 c6 08             	test   $0x8,%dh
+  801e9f:	74 15                	je     801eb6 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ea1:	89 c2                	mov    %eax,%edx
+  801ea3:	c1 ea 08             	shr    $0x8,%edx
+  801ea6:	83 e2 0f             	and    $0xf,%edx
+  801ea9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801eae:	83 fa 06             	cmp    $0x6,%edx
+  801eb1:	74 0e                	je     801ec1 <sys_fork+0x6e>
+  801eb3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801eb6:	0f b6 c9             	movzbl %cl,%ecx
+  801eb9:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801ebf:	eb a1                	jmp    801e62 <sys_fork+0xf>
+  801ec1:	89 c2                	mov    %eax,%edx
+  801ec3:	c1 ea 04             	shr    $0x4,%edx
+  801ec6:	83 e2 0f             	and    $0xf,%edx
+  801ec9:	83 fa 02             	cmp    $0x2,%edx
+  801ecc:	77 e5                	ja     801eb3 <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801ece:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ed1:	83 f8 02             	cmp    $0x2,%eax
+  801ed4:	0f 97 c1             	seta   %cl
+  801ed7:	0f b6 c9             	movzbl %cl,%ecx
+  801eda:	eb d7                	jmp    801eb3 <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801edc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ee1:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801ee6:	89 d1                	mov    %edx,%ecx
+  801ee8:	89 d3                	mov    %edx,%ebx
+  801eea:	89 d7                	mov    %edx,%edi
+  801eec:	89 d6                	mov    %edx,%esi
+  801eee:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801ef0:	eb 99                	jmp    801e8b <sys_fork+0x38>
+
+00801ef2 <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801ef2:	55                   	push   %ebp
+  801ef3:	89 e5                	mov    %esp,%ebp
+  801ef5:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801ef8:	ff 75 14             	push   0x14(%ebp)
+  801efb:	ff 75 10             	push   0x10(%ebp)
+  801efe:	ff 75 0c             	push   0xc(%ebp)
+  801f01:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f06:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f09:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801f0e:	e8 81 ee ff ff       	call   800d94 <page_vec_call>
+}
+  801f13:	c9                   	leave
+  801f14:	c3                   	ret
+
+00801f15 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801f15:	55                   	push   %ebp
+  801f16:	89 e5                	mov    %esp,%ebp
+  801f18:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801f1b:	ff 75 18             	push   0x18(%ebp)
+  801f1e:	ff 75 14             	push   0x14(%ebp)
+  801f21:	ff 75 10             	push   0x10(%ebp)
+  801f24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f27:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f2a:	b8 10 00 00 00       	mov    $0x10,%eax
+  801f2f:	e8 60 ee ff ff       	call   800d94 <page_vec_call>
+}
+  801f34:	c9                   	leave
+  801f35:	c3                   	ret
+
+00801f36 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801f36:	55                   	push   %ebp
+  801f37:	89 e5                	mov    %esp,%ebp
+  801f39:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801f3c:	ff 75 14             	push   0x14(%ebp)
+  801f3f:	ff 75 10             	push   0x10(%ebp)
+  801f42:	ff 75 0c             	push   0xc(%ebp)
+  801f45:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f4d:	b8 11 00 00 00       	mov    $0x11,%eax
+  801f52:	e8 3d ee ff ff       	call   800d94 <page_vec_call>
+}
+  801f57:	c9                   	leave
+  801f58:	c3                   	ret
+
+00801f59 <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801f59:	55                   	push   %ebp
+  801f5a:	89 e5                	mov    %esp,%ebp
+  801f5c:	57                   	push   %edi
+  801f5d:	56                   	push   %esi
+  801f5e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801f5f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f66:	78 32                	js     801f9a <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801f68:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f6f:	74 75                	je     801fe6 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801f71:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f74:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f77:	b8 12 00 00 00       	mov    $0x12,%eax
+  801f7c:	be 00 00 00 00       	mov    $0x0,%esi
+  801f81:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f84:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801f87:	55                   	push   %ebp
+  801f88:	68 91 1f 80 00       	push   $0x801f91
+  801f8d:	89 e5                	mov    %esp,%ebp
+  801f8f:	0f 34                	sysenter
+  801f91:	83 c4 04             	add    $0x4,%esp
+  801f94:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801f95:	5b                   	pop    %ebx
+  801f96:	5e                   	pop    %esi
+  801f97:	5f                   	pop    %edi
+  801f98:	5d                   	pop    %ebp
+  801f99:	c3                   	ret
+  801f9a:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f9f:	0f a2                	cpuid
+		return 0;
+  801fa1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801fa6:	f6 c6 08             	test   $0x8,%dh
+  801fa9:	74 15                	je     801fc0 <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fab:	89 c2                	mov    %eax,%edx
+  801fad:	c1 ea 08             	shr    $0x8,%edx
+  801fb0:	83 e2 0f             	and    $0xf,%edx
+  801fb3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801fb8:	83 fa 06             	cmp    $0x6,%edx
+  801fbb:	74 0e                	je     801fcb <sys_vm_ranges+0x72>
+  801fbd:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801fc0:	0f b6 c9             	movzbl %cl,%ecx
+  801fc3:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801fc9:	eb 9d                	jmp    801f68 <sys_vm_ranges+0xf>
+  801fcb:	89 c2                	mov    %eax,%edx
+  801fcd:	c1 ea 04             	shr    $0x4,%edx
+  801fd0:	83 e2 0f             	and    $0xf,%edx
+  801fd3:	83 fa 02             	cmp    $0x2,%edx
+  801fd6:	77 e5                	ja     801fbd <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  801fd8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fdb:	83 f8 02             	cmp    $0x2,%eax
+  801fde:	0f 97 c1             	seta   %cl
+  801fe1:	0f b6 c9             	movzbl %cl,%ecx
+  801fe4:	eb d7                	jmp    801fbd <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801fe6:	b8 12 00 00 00       	mov    $0x12,%eax
+  801feb:	be 00 00 00 00       	mov    $0x0,%esi
+  801ff0:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ff3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ff6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ff9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ffc:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801ffe:	eb 95                	jmp    801f95 <sys_vm_ranges+0x3c>
+
+00802000 <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  802000:	55                   	push   %ebp
+  802001:	89 e5                	mov    %esp,%ebp
+  802003:	57                   	push   %edi
+  802004:	56                   	push   %esi
+  802005:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802006:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80200d:	78 31                	js     802040 <sys_spawn+0x40>
+	if (syscall_sysenter)
+  80200f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802016:	74 74                	je     80208c <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  802018:	be 00 00 00 00       	mov    $0x0,%esi
+  80201d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802020:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802023:	b8 14 00 00 00       	mov    $0x14,%eax
+  802028:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80202b:	89 f7                	mov    %esi,%edi
+  80202d:	55                   	push   %ebp
+  80202e:	68 37 20 80 00       	push   $0x802037
+  802033:	89 e5                	mov    %esp,%ebp
+  802035:	0f 34                	sysenter
+  802037:	83 c4 04             	add    $0x4,%esp
+  80203a:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  80203b:	5b                   	pop    %ebx
+  80203c:	5e                   	pop    %esi
+  80203d:	5f                   	pop    %edi
+  80203e:	5d                   	pop    %ebp
+  80203f:	c3                   	ret
+  802040:	b8 01 00 00 00       	mov    $0x1,%eax
+  802045:	0f a2                	cpuid
+		return 0;
+  802047:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80204c:	f6 c6 08             	test   $0x8,%dh
+  80204f:	74 15                	je     802066 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802051:	89 c2                	mov    %eax,%edx
+  802053:	c1 ea 08             	shr    $0x8,%edx
+  802056:	83 e2 0f             	and    $0xf,%edx
+  802059:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80205e:	83 fa 06             	cmp    $0x6,%edx
+  802061:	74 0e                	je     802071 <sys_spawn+0x71>
+  802063:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802066:	0f b6 c9             	movzbl %cl,%ecx
+  802069:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80206f:	eb 9e                	jmp    80200f <sys_spawn+0xf>
+  802071:	89 c2                	mov    %eax,%edx
+  802073:	c1 ea 04             	shr    $0x4,%edx
+  802076:	83 e2 0f             	and    $0xf,%edx
+  802079:	83 fa 02             	cmp    $0x2,%edx
+  80207c:	77 e5                	ja     802063 <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  80207e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802081:	83 f8 02             	cmp    $0x2,%eax
+  802084:	0f 97 c1             	seta   %cl
+  802087:	0f b6 c9             	movzbl %cl,%ecx
+  80208a:	eb d7                	jmp    802063 <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  80208c:	be 00 00 00 00       	mov    $0x0,%esi
+  802091:	b8 14 00 00 00       	mov    $0x14,%eax
+  802096:	8b 55 08             	mov    0x8(%ebp),%edx
+  802099:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80209c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80209f:	89 f7                	mov    %esi,%edi
+  8020a1:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  8020a3:	eb 96                	jmp    80203b <sys_spawn+0x3b>
+
+008020a5 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  8020a5:	55                   	push   %ebp
+  8020a6:	89 e5                	mov    %esp,%ebp
+  8020a8:	57                   	push   %edi
+  8020a9:	56                   	push   %esi
+  8020aa:	53                   	push   %ebx
+  8020ab:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8020ae:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8020b5:	78 37                	js     8020ee <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  8020b7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8020be:	74 7a                	je     80213a <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  8020c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020cb:	b8 15 00 00 00       	mov    $0x15,%eax
+  8020d0:	89 df                	mov    %ebx,%edi
+  8020d2:	89 de                	mov    %ebx,%esi
+  8020d4:	55                   	push   %ebp
+  8020d5:	68 de 20 80 00       	push   $0x8020de
+  8020da:	89 e5                	mov    %esp,%ebp
+  8020dc:	0f 34                	sysenter
+  8020de:	83 c4 04             	add    $0x4,%esp
+  8020e1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8020e2:	85 c0                	test   %eax,%eax
+  8020e4:	7f 6c                	jg     802152 <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  8020e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020e9:	5b                   	pop    %ebx
+  8020ea:	5e                   	pop    %esi
+  8020eb:	5f                   	pop    %edi
+  8020ec:	5d                   	pop    %ebp
+  8020ed:	c3                   	ret
+  8020ee:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020f3:	0f a2                	cpuid
+		return 0;
+  8020f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8020fa:	f6 c6 08             	test   $0x8,%dh
+  8020fd:	74 15                	je     802114 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020ff:	89 c2                	mov    %eax,%edx
+  802101:	c1 ea 08             	shr    $0x8,%edx
+  802104:	83 e2 0f             	and    $0xf,%edx
+  802107:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80210c:	83 fa 06             	cmp    $0x6,%edx
+  80210f:	74 0e                	je     80211f <sys_shm_create+0x7a>
+  802111:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802114:	0f b6 c9             	movzbl %cl,%ecx
+  802117:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80211d:	eb 98                	jmp    8020b7 <sys_shm_create+0x12>
+  80211f:	89 c2                	mov    %eax,%edx
+  802121:	c1 ea 04             	shr    $0x4,%edx
+  802124:	83 e2 0f             	and    $0xf,%edx
+  802127:	83 fa 02             	cmp    $0x2,%edx
+  80212a:	77 e5                	ja     802111 <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  80212c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80212f:	83 f8 02             	cmp    $0x2,%eax
+  802132:	0f 97 c1             	seta   %cl
+  802135:	0f b6 c9             	movzbl %cl,%ecx
+  802138:	eb d7                	jmp    802111 <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  80213a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80213f:	b8 15 00 00 00       	mov    $0x15,%eax
+  802144:	8b 55 08             	mov    0x8(%ebp),%edx
+  802147:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80214a:	89 df                	mov    %ebx,%edi
+  80214c:	89 de                	mov    %ebx,%esi
+  80214e:	cd 30                	int    $0x30
+  802150:	eb 90                	jmp    8020e2 <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802152:	83 ec 0c             	sub    $0xc,%esp
+  802155:	50                   	push   %eax
+  802156:	6a 15                	push   $0x15
+  802158:	68 19 35 80 00       	push   $0x803519
+  80215d:	6a 4a                	push   $0x4a
+  80215f:	68 36 35 80 00       	push   $0x803536
+  802164:	e8 e5 e1 ff ff       	call   80034e <_panic>
+
+00802169 <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  802169:	55                   	push   %ebp
+  80216a:	89 e5                	mov    %esp,%ebp
+  80216c:	57                   	push   %edi
+  80216d:	56                   	push   %esi
+  80216e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80216f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802176:	78 32                	js     8021aa <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  802178:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80217f:	74 75                	je     8021f6 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  802181:	8b 55 08             	mov    0x8(%ebp),%edx
+  802184:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802187:	b8 16 00 00 00       	mov    $0x16,%eax
+  80218c:	be 00 00 00 00       	mov    $0x0,%esi
+  802191:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802194:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802197:	55                   	push   %ebp
+  802198:	68 a1 21 80 00       	push   $0x8021a1
+  80219d:	89 e5                	mov    %esp,%ebp
+  80219f:	0f 34                	sysenter
+  8021a1:	83 c4 04             	add    $0x4,%esp
+  8021a4:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  8021a5:	5b                   	pop    %ebx
+  8021a6:	5e                   	pop    %esi
+  8021a7:	5f                   	pop    %edi
+  8021a8:	5d                   	pop    %ebp
+  8021a9:	c3                   	ret
+  8021aa:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021af:	0f a2                	cpuid
+		return 0;
+  8021b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8021b6:	f6 c6 08             	test   $0x8,%dh
+  8021b9:	74 15                	je     8021d0 <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021bb:	89 c2                	mov    %eax,%edx
+  8021bd:	c1 ea 08             	shr    $0x8,%edx
+  8021c0:	83 e2 0f             	and    $0xf,%edx
+  8021c3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8021c8:	83 fa 06             	cmp    $0x6,%edx
+  8021cb:	74 0e                	je     8021db <sys_shm_attach+0x72>
+  8021cd:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8021d0:	0f b6 c9             	movzbl %cl,%ecx
+  8021d3:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8021d9:	eb 9d                	jmp    802178 <sys_shm_attach+0xf>
+  8021db:	89 c2                	mov    %eax,%edx
+  8021dd:	c1 ea 04             	shr    $0x4,%edx
+  8021e0:	83 e2 0f             	and    $0xf,%edx
+  8021e3:	83 fa 02             	cmp    $0x2,%edx
+  8021e6:	77 e5                	ja     8021cd <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  8021e8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021eb:	83 f8 02             	cmp    $0x2,%eax
+  8021ee:	0f 97 c1             	seta   %cl
+  8021f1:	0f b6 c9             	movzbl %cl,%ecx
+  8021f4:	eb d7                	jmp    8021cd <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  8021f6:	b8 16 00 00 00       	mov    $0x16,%eax
+  8021fb:	be 00 00 00 00       	mov    $0x0,%esi
+  802200:	8b 55 08             	mov    0x8(%ebp),%edx
+  802203:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802206:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802209:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80220c:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  80220e:	eb 95                	jmp    8021a5 <sys_shm_attach+0x3c>
+
+00802210 <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  802210:	55                   	push   %ebp
+  802211:	89 e5                	mov    %esp,%ebp
+  802213:	57                   	push   %edi
+  802214:	56                   	push   %esi
+  802215:	53                   	push   %ebx
+  802216:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802219:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802220:	78 38                	js     80225a <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  802222:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802229:	74 7b                	je     8022a6 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  80222b:	be 00 00 00 00       	mov    $0x0,%esi
+  802230:	8b 55 08             	mov    0x8(%ebp),%edx
+  802233:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802236:	b8 17 00 00 00       	mov    $0x17,%eax
+  80223b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80223e:	89 f7                	mov    %esi,%edi
+  802240:	55                   	push   %ebp
+  802241:	68 4a 22 80 00       	push   $0x80224a
+  802246:	89 e5                	mov    %esp,%ebp
+  802248:	0f 34                	sysenter
+  80224a:	83 c4 04             	add    $0x4,%esp
+  80224d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80224e:	85 c0                	test   %eax,%eax
+  802250:	7f 6d                	jg     8022bf <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  802252:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802255:	5b                   	pop    %ebx
+  802256:	5e                   	pop    %esi
+  802257:	5f                   	pop    %edi
+  802258:	5d                   	pop    %ebp
+  802259:	c3                   	ret
+  80225a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80225f:	0f a2                	cpuid
+		return 0;
+  802261:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802266:	f6 c6 08             	test   $0x8,%dh
+  802269:	74 15                	je     802280 <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80226b:	89 c2                	mov    %eax,%edx
+  80226d:	c1 ea 08             	shr    $0x8,%edx
+  802270:	83 e2 0f             	and    $0xf,%edx
+  802273:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802278:	83 fa 06             	cmp    $0x6,%edx
+  80227b:	74 0e                	je     80228b <sys_shm_detach+0x7b>
+  80227d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802280:	0f b6 c9             	movzbl %cl,%ecx
+  802283:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802289:	eb 97                	jmp    802222 <sys_shm_detach+0x12>
+  80228b:	89 c2                	mov    %eax,%edx
+  80228d:	c1 ea 04             	shr    $0x4,%edx
+  802290:	83 e2 0f             	and    $0xf,%edx
+  802293:	83 fa 02             	cmp    $0x2,%edx
+  802296:	77 e5                	ja     80227d <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  802298:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80229b:	83 f8 02             	cmp    $0x2,%eax
+  80229e:	0f 97 c1             	seta   %cl
+  8022a1:	0f b6 c9             	movzbl %cl,%ecx
+  8022a4:	eb d7                	jmp    80227d <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  8022a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8022ab:	b8 17 00 00 00       	mov    $0x17,%eax
+  8022b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022b6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8022b9:	89 f7                	mov    %esi,%edi
+  8022bb:	cd 30                	int    $0x30
+  8022bd:	eb 8f                	jmp    80224e <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8022bf:	83 ec 0c             	sub    $0xc,%esp
+  8022c2:	50                   	push   %eax
+  8022c3:	6a 17                	push   $0x17
+  8022c5:	68 19 35 80 00       	push   $0x803519
+  8022ca:	6a 4a                	push   $0x4a
+  8022cc:	68 36 35 80 00       	push   $0x803536
+  8022d1:	e8 78 e0 ff ff       	call   80034e <_panic>
+
+008022d6 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  8022d6:	55                   	push   %ebp
+  8022d7:	89 e5                	mov    %esp,%ebp
+  8022d9:	57                   	push   %edi
+  8022da:	56                   	push   %esi
+  8022db:	53                   	push   %ebx
+  8022dc:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8022df:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8022e6:	78 36                	js     80231e <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  8022e8:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8022ef:	74 79                	je     80236a <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  8022f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022f9:	b8 18 00 00 00       	mov    $0x18,%eax
+  8022fe:	89 cb                	mov    %ecx,%ebx
+  802300:	89 cf                	mov    %ecx,%edi
+  802302:	89 ce                	mov    %ecx,%esi
+  802304:	55                   	push   %ebp
+  802305:	68 0e 23 80 00       	push   $0x80230e
+  80230a:	89 e5                	mov    %esp,%ebp
+  80230c:	0f 34                	sysenter
+  80230e:	83 c4 04             	add    $0x4,%esp
+  802311:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802312:	85 c0                	test   %eax,%eax
+  802314:	7f 6b                	jg     802381 <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  802316:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802319:	5b                   	pop    %ebx
+  80231a:	5e                   	pop    %esi
+  80231b:	5f                   	pop    %edi
+  80231c:	5d                   	pop    %ebp
+  80231d:	c3                   	ret
+  80231e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802323:	0f a2                	cpuid
+		return 0;
+  802325:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80232a:	f6 c6 08             	test   $0x8,%dh
+  80232d:	74 15                	je     802344 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80232f:	89 c2                	mov    %eax,%edx
+  802331:	c1 ea 08             	shr    $0x8,%edx
+  802334:	83 e2 0f             	and    $0xf,%edx
+  802337:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80233c:	83 fa 06             	cmp    $0x6,%edx
+  80233f:	74 0e                	je     80234f <sys_shm_remove+0x79>
+  802341:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802344:	0f b6 c9             	movzbl %cl,%ecx
+  802347:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80234d:	eb 99                	jmp    8022e8 <sys_shm_remove+0x12>
+  80234f:	89 c2                	mov    %eax,%edx
+  802351:	c1 ea 04             	shr    $0x4,%edx
+  802354:	83 e2 0f             	and    $0xf,%edx
+  802357:	83 fa 02             	cmp    $0x2,%edx
+  80235a:	77 e5                	ja     802341 <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  80235c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80235f:	83 f8 02             	cmp    $0x2,%eax
+  802362:	0f 97 c1             	seta   %cl
+  802365:	0f b6 c9             	movzbl %cl,%ecx
+  802368:	eb d7                	jmp    802341 <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  80236a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80236f:	b8 18 00 00 00       	mov    $0x18,%eax
+  802374:	8b 55 08             	mov    0x8(%ebp),%edx
+  802377:	89 cb                	mov    %ecx,%ebx
+  802379:	89 cf                	mov    %ecx,%edi
+  80237b:	89 ce                	mov    %ecx,%esi
+  80237d:	cd 30                	int    $0x30
+  80237f:	eb 91                	jmp    802312 <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802381:	83 ec 0c             	sub    $0xc,%esp
+  802384:	50                   	push   %eax
+  802385:	6a 18                	push   $0x18
+  802387:	68 19 35 80 00       	push   $0x803519
+  80238c:	6a 4a                	push   $0x4a
+  80238e:	68 36 35 80 00       	push   $0x803536
+  802393:	e8 b6 df ff ff       	call   80034e <_panic>
+
+00802398 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  802398:	55                   	push   %ebp
+  802399:	89 e5                	mov    %esp,%ebp
+  80239b:	57                   	push   %edi
+  80239c:	56                   	push   %esi
+  80239d:	53                   	push   %ebx
+  80239e:	83 ec 0c             	sub    $0xc,%esp
+  8023a1:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023a4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8023a7:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  8023aa:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8023b1:	78 32                	js     8023e5 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  8023b3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8023ba:	74 75                	je     802431 <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  8023bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023c2:	b8 20 00 00 00       	mov    $0x20,%eax
+  8023c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8023cc:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8023cf:	55                   	push   %ebp
+  8023d0:	68 d9 23 80 00       	push   $0x8023d9
+  8023d5:	89 e5                	mov    %esp,%ebp
+  8023d7:	0f 34                	sysenter
+  8023d9:	83 c4 04             	add    $0x4,%esp
+  8023dc:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  8023dd:	83 c4 0c             	add    $0xc,%esp
+  8023e0:	5b                   	pop    %ebx
+  8023e1:	5e                   	pop    %esi
+  8023e2:	5f                   	pop    %edi
+  8023e3:	5d                   	pop    %ebp
+  8023e4:	c3                   	ret
+  8023e5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023ea:	0f a2                	cpuid
+		return 0;
+  8023ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8023f1:	f6 c6 08             	test   $0x8,%dh
+  8023f4:	74 15                	je     80240b <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023f6:	89 c2                	mov    %eax,%edx
+  8023f8:	c1 ea 08             	shr    $0x8,%edx
+  8023fb:	83 e2 0f             	and    $0xf,%edx
+  8023fe:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802403:	83 fa 06             	cmp    $0x6,%edx
+  802406:	74 0e                	je     802416 <sys_futex_wait+0x7e>
+  802408:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80240b:	0f b6 c9             	movzbl %cl,%ecx
+  80240e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802414:	eb 9d                	jmp    8023b3 <sys_futex_wait+0x1b>
+  802416:	89 c2                	mov    %eax,%edx
+  802418:	c1 ea 04             	shr    $0x4,%edx
+  80241b:	83 e2 0f             	and    $0xf,%edx
+  80241e:	83 fa 02             	cmp    $0x2,%edx
+  802421:	77 e5                	ja     802408 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  802423:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802426:	83 f8 02             	cmp    $0x2,%eax
+  802429:	0f 97 c1             	seta   %cl
+  80242c:	0f b6 c9             	movzbl %cl,%ecx
+  80242f:	eb d7                	jmp    802408 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  802431:	b8 20 00 00 00       	mov    $0x20,%eax
+  802436:	be 00 00 00 00       	mov    $0x0,%esi
+  80243b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80243e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802441:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802444:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  802446:	eb 95                	jmp    8023dd <sys_futex_wait+0x45>
+
+00802448 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  802448:	55                   	push   %ebp
+  802449:	89 e5                	mov    %esp,%ebp
+  80244b:	57                   	push   %edi
+  80244c:	56                   	push   %esi
+  80244d:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80244e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802455:	78 30                	js     802487 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  802457:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80245e:	74 73                	je     8024d3 <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  802460:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802465:	8b 55 08             	mov    0x8(%ebp),%edx
+  802468:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80246b:	b8 21 00 00 00       	mov    $0x21,%eax
+  802470:	89 df                	mov    %ebx,%edi
+  802472:	89 de                	mov    %ebx,%esi
+  802474:	55                   	push   %ebp
+  802475:	68 7e 24 80 00       	push   $0x80247e
+  80247a:	89 e5                	mov    %esp,%ebp
+  80247c:	0f 34                	sysenter
+  80247e:	83 c4 04             	add    $0x4,%esp
+  802481:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  802482:	5b                   	pop    %ebx
+  802483:	5e                   	pop    %esi
+  802484:	5f                   	pop    %edi
+  802485:	5d                   	pop    %ebp
+  802486:	c3                   	ret
+  802487:	b8 01 00 00 00       	mov    $0x1,%eax
+  80248c:	0f a2                	cpuid
+		return 0;
+  80248e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802493:	f6 c6 08             	test   $0x8,%dh
+  802496:	74 15                	je     8024ad <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802498:	89 c2                	mov    %eax,%edx
+  80249a:	c1 ea 08             	shr    $0x8,%edx
+  80249d:	83 e2 0f             	and    $0xf,%edx
+  8024a0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8024a5:	83 fa 06             	cmp    $0x6,%edx
+  8024a8:	74 0e                	je     8024b8 <sys_futex_wake+0x70>
+  8024aa:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8024ad:	0f b6 c9             	movzbl %cl,%ecx
+  8024b0:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8024b6:	eb 9f                	jmp    802457 <sys_futex_wake+0xf>
+  8024b8:	89 c2                	mov    %eax,%edx
+  8024ba:	c1 ea 04             	shr    $0x4,%edx
+  8024bd:	83 e2 0f             	and    $0xf,%edx
+  8024c0:	83 fa 02             	cmp    $0x2,%edx
+  8024c3:	77 e5                	ja     8024aa <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  8024c5:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8024c8:	83 f8 02             	cmp    $0x2,%eax
+  8024cb:	0f 97 c1             	seta   %cl
+  8024ce:	0f b6 c9             	movzbl %cl,%ecx
+  8024d1:	eb d7                	jmp    8024aa <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  8024d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024d8:	b8 21 00 00 00       	mov    $0x21,%eax
+  8024dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024e3:	89 df                	mov    %ebx,%edi
+  8024e5:	89 de                	mov    %ebx,%esi
+  8024e7:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  8024e9:	eb 97                	jmp    802482 <sys_futex_wake+0x3a>
+
+008024eb <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  8024eb:	55                   	push   %ebp
+  8024ec:	89 e5                	mov    %esp,%ebp
+  8024ee:	57                   	push   %edi
+  8024ef:	56                   	push   %esi
+  8024f0:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8024f1:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8024f8:	78 2e                	js     802528 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  8024fa:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802501:	74 71                	je     802574 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  802503:	ba 00 00 00 00       	mov    $0x0,%edx
+  802508:	b8 22 00 00 00       	mov    $0x22,%eax
+  80250d:	89 d1                	mov    %edx,%ecx
+  80250f:	89 d3                	mov    %edx,%ebx
+  802511:	89 d7                	mov    %edx,%edi
+  802513:	89 d6                	mov    %edx,%esi
+  802515:	55                   	push   %ebp
+  802516:	68 1f 25 80 00       	push   $0x80251f
+  80251b:	89 e5                	mov    %esp,%ebp
+  80251d:	0f 34                	sysenter
+  80251f:	83 c4 04             	add    $0x4,%esp
+  802522:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  802523:	5b                   	pop    %ebx
+  802524:	5e                   	pop    %esi
+  802525:	5f                   	pop    %edi
+  802526:	5d                   	pop    %ebp
+  802527:	c3                   	ret
+  802528:	b8 01 00 00 00       	mov    $0x1,%eax
+  80252d:	0f a2                	cpuid
+		return 0;
+  80252f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802534:	f6 c6 08             	test   $0x8,%dh
+  802537:	74 15                	je     80254e <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802539:	89 c2                	mov    %eax,%edx
+  80253b:	c1 ea 08             	shr    $0x8,%edx
+  80253e:	83 e2 0f             	and    $0xf,%edx
+  802541:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802546:	83 fa 06             	cmp    $0x6,%edx
+  802549:	74 0e                	je     802559 <sys_ep_create+0x6e>
+  80254b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80254e:	0f b6 c9             	movzbl %cl,%ecx
+  802551:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802557:	eb a1                	jmp    8024fa <sys_ep_create+0xf>
+  802559:	89 c2                	mov    %eax,%edx
+  80255b:	c1 ea 04             	shr    $0x4,%edx
+  80255e:	83 e2 0f             	and    $0xf,%edx
+  802561:	83 fa 02             	cmp    $0x2,%edx
+  802564:	77 e5                	ja     80254b <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  802566:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802569:	83 f8 02             	cmp    $0x2,%eax
+  80256c:	0f 97 c1             	seta   %cl
+  80256f:	0f b6 c9             	movzbl %cl,%ecx
+  802572:	eb d7                	jmp    80254b <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  802574:	ba 00 00 00 00       	mov    $0x0,%edx
+  802579:	b8 22 00 00 00       	mov    $0x22,%eax
+  80257e:	89 d1                	mov    %edx,%ecx
+  802580:	89 d3                	mov    %edx,%ebx
+  802582:	89 d7                	mov    %edx,%edi
+  802584:	89 d6                	mov    %edx,%esi
+  802586:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  802588:	eb 99                	jmp    802523 <sys_ep_create+0x38>
+
+0080258a <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  80258a:	55                   	push   %ebp
+  80258b:	89 e5                	mov    %esp,%ebp
+  80258d:	57                   	push   %edi
+  80258e:	56                   	push   %esi
+  80258f:	53                   	push   %ebx
+  802590:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802593:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80259a:	78 36                	js     8025d2 <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  80259c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8025a3:	74 79                	je     80261e <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  8025a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025ad:	b8 23 00 00 00       	mov    $0x23,%eax
+  8025b2:	89 cb                	mov    %ecx,%ebx
+  8025b4:	89 cf                	mov    %ecx,%edi
+  8025b6:	89 ce                	mov    %ecx,%esi
+  8025b8:	55                   	push   %ebp
+  8025b9:	68 c2 25 80 00       	push   $0x8025c2
+  8025be:	89 e5                	mov    %esp,%ebp
+  8025c0:	0f 34                	sysenter
+  8025c2:	83 c4 04             	add    $0x4,%esp
+  8025c5:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8025c6:	85 c0                	test   %eax,%eax
+  8025c8:	7f 6b                	jg     802635 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  8025ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025cd:	5b                   	pop    %ebx
+  8025ce:	5e                   	pop    %esi
+  8025cf:	5f                   	pop    %edi
+  8025d0:	5d                   	pop    %ebp
+  8025d1:	c3                   	ret
+  8025d2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025d7:	0f a2                	cpuid
+		return 0;
+  8025d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8025de:	f6 c6 08             	test   $0x8,%dh
+  8025e1:	74 15                	je     8025f8 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025e3:	89 c2                	mov    %eax,%edx
+  8025e5:	c1 ea 08             	shr    $0x8,%edx
+  8025e8:	83 e2 0f             	and    $0xf,%edx
+  8025eb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8025f0:	83 fa 06             	cmp    $0x6,%edx
+  8025f3:	74 0e                	je     802603 <sys_ep_destroy+0x79>
+  8025f5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8025f8:	0f b6 c9             	movzbl %cl,%ecx
+  8025fb:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802601:	eb 99                	jmp    80259c <sys_ep_destroy+0x12>
+  802603:	89 c2                	mov    %eax,%edx
+  802605:	c1 ea 04             	shr    $0x4,%edx
+  802608:	83 e2 0f             	and    $0xf,%edx
+  80260b:	83 fa 02             	cmp    $0x2,%edx
+  80260e:	77 e5                	ja     8025f5 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  802610:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802613:	83 f8 02             	cmp    $0x2,%eax
+  802616:	0f 97 c1             	seta   %cl
+  802619:	0f b6 c9             	movzbl %cl,%ecx
+  80261c:	eb d7                	jmp    8025f5 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  80261e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802623:	b8 23 00 00 00       	mov    $0x23,%eax
+  802628:	8b 55 08             	mov    0x8(%ebp),%edx
+  80262b:	89 cb                	mov    %ecx,%ebx
+  80262d:	89 cf                	mov    %ecx,%edi
+  80262f:	89 ce                	mov    %ecx,%esi
+  802631:	cd 30                	int    $0x30
+  802633:	eb 91                	jmp    8025c6 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802635:	83 ec 0c             	sub    $0xc,%esp
+  802638:	50                   	push   %eax
+  802639:	6a 23                	push   $0x23
+  80263b:	68 19 35 80 00       	push   $0x803519
+  802640:	6a 4a                	push   $0x4a
+  802642:	68 36 35 80 00       	push   $0x803536
+  802647:	e8 02 dd ff ff       	call   80034e <_panic>
+
+0080264c <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  80264c:	55                   	push   %ebp
+  80264d:	89 e5                	mov    %esp,%ebp
+  80264f:	57                   	push   %edi
+  802650:	56                   	push   %esi
+  802651:	53                   	push   %ebx
+  802652:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802655:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80265c:	78 37                	js     802695 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  80265e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802665:	74 7a                	je     8026e1 <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  802667:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80266c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80266f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802672:	b8 24 00 00 00       	mov    $0x24,%eax
+  802677:	89 df                	mov    %ebx,%edi
+  802679:	89 de                	mov    %ebx,%esi
+  80267b:	55                   	push   %ebp
+  80267c:	68 85 26 80 00       	push   $0x802685
+  802681:	89 e5                	mov    %esp,%ebp
+  802683:	0f 34                	sysenter
+  802685:	83 c4 04             	add    $0x4,%esp
+  802688:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802689:	85 c0                	test   %eax,%eax
+  80268b:	7f 6c                	jg     8026f9 <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  80268d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802690:	5b                   	pop    %ebx
+  802691:	5e                   	pop    %esi
+  802692:	5f                   	pop    %edi
+  802693:	5d                   	pop    %ebp
+  802694:	c3                   	ret
+  802695:	b8 01 00 00 00       	mov    $0x1,%eax
+  80269a:	0f a2                	cpuid
+		return 0;
+  80269c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8026a1:	f6 c6 08             	test   $0x8,%dh
+  8026a4:	74 15                	je     8026bb <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8026a6:	89 c2                	mov    %eax,%edx
+  8026a8:	c1 ea 08             	shr    $0x8,%edx
+  8026ab:	83 e2 0f             	and    $0xf,%edx
+  8026ae:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8026b3:	83 fa 06             	cmp    $0x6,%edx
+  8026b6:	74 0e                	je     8026c6 <sys_ep_grant+0x7a>
+  8026b8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8026bb:	0f b6 c9             	movzbl %cl,%ecx
+  8026be:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8026c4:	eb 98                	jmp    80265e <sys_ep_grant+0x12>
+  8026c6:	89 c2                	mov    %eax,%edx
+  8026c8:	c1 ea 04             	shr    $0x4,%edx
+  8026cb:	83 e2 0f             	and    $0xf,%edx
+  8026ce:	83 fa 02             	cmp    $0x2,%edx
+  8026d1:	77 e5                	ja     8026b8 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  8026d3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8026d6:	83 f8 02             	cmp    $0x2,%eax
+  8026d9:	0f 97 c1             	seta   %cl
+  8026dc:	0f b6 c9             	movzbl %cl,%ecx
+  8026df:	eb d7                	jmp    8026b8 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  8026e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026e6:	b8 24 00 00 00       	mov    $0x24,%eax
+  8026eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8026ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026f1:	89 df                	mov    %ebx,%edi
+  8026f3:	89 de                	mov    %ebx,%esi
+  8026f5:	cd 30                	int    $0x30
+  8026f7:	eb 90                	jmp    802689 <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8026f9:	83 ec 0c             	sub    $0xc,%esp
+  8026fc:	50                   	push   %eax
+  8026fd:	6a 24                	push   $0x24
+  8026ff:	68 19 35 80 00       	push   $0x803519
+  802704:	6a 4a                	push   $0x4a
+  802706:	68 36 35 80 00       	push   $0x803536
+  80270b:	e8 3e dc ff ff       	call   80034e <_panic>
+
+00802710 <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  802710:	55                   	push   %ebp
+  802711:	89 e5                	mov    %esp,%ebp
+  802713:	57                   	push   %edi
+  802714:	56                   	push   %esi
+  802715:	53                   	push   %ebx
+  802716:	83 ec 20             	sub    $0x20,%esp
+  802719:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  80271c:	8b 10                	mov    (%eax),%edx
+  80271e:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802721:	8b 50 04             	mov    0x4(%eax),%edx
+  802724:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802727:	8b 50 08             	mov    0x8(%eax),%edx
+  80272a:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  80272d:	8b 50 0c             	mov    0xc(%eax),%edx
+  802730:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  802733:	8b 40 10             	mov    0x10(%eax),%eax
+  802736:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  802739:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  80273c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80273f:	b8 25 00 00 00       	mov    $0x25,%eax
+  802744:	55                   	push   %ebp
+  802745:	56                   	push   %esi
+  802746:	8b 0e                	mov    (%esi),%ecx
+  802748:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80274b:	8b 7e 08             	mov    0x8(%esi),%edi
+  80274e:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802751:	8b 76 0c             	mov    0xc(%esi),%esi
+  802754:	cd 30                	int    $0x30
+  802756:	87 34 24             	xchg   %esi,(%esp)
+  802759:	89 0e                	mov    %ecx,(%esi)
+  80275b:	89 5e 04             	mov    %ebx,0x4(%esi)
+  80275e:	89 7e 08             	mov    %edi,0x8(%esi)
+  802761:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802764:	8f 46 0c             	pop    0xc(%esi)
+  802767:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  802768:	83 c4 20             	add    $0x20,%esp
+  80276b:	5b                   	pop    %ebx
+  80276c:	5e                   	pop    %esi
+  80276d:	5f                   	pop    %edi
+  80276e:	5d                   	pop    %ebp
+  80276f:	c3                   	ret
+
+00802770 <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  802770:	55                   	push   %ebp
+  802771:	89 e5                	mov    %esp,%ebp
+  802773:	57                   	push   %edi
+  802774:	56                   	push   %esi
+  802775:	53                   	push   %ebx
+  802776:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  802779:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80277c:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  80277e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802781:	b8 26 00 00 00       	mov    $0x26,%eax
+  802786:	55                   	push   %ebp
+  802787:	56                   	push   %esi
+  802788:	8b 0e                	mov    (%esi),%ecx
+  80278a:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80278d:	8b 7e 08             	mov    0x8(%esi),%edi
+  802790:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802793:	8b 76 0c             	mov    0xc(%esi),%esi
+  802796:	cd 30                	int    $0x30
+  802798:	87 34 24             	xchg   %esi,(%esp)
+  80279b:	89 0e                	mov    %ecx,(%esi)
+  80279d:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8027a0:	89 7e 08             	mov    %edi,0x8(%esi)
+  8027a3:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8027a6:	8f 46 0c             	pop    0xc(%esi)
+  8027a9:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  8027aa:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  8027ae:	74 0f                	je     8027bf <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  8027b0:	85 c0                	test   %eax,%eax
+  8027b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027b7:	0f 48 d1             	cmovs  %ecx,%edx
+  8027ba:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8027bd:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  8027bf:	5b                   	pop    %ebx
+  8027c0:	5e                   	pop    %esi
+  8027c1:	5f                   	pop    %edi
+  8027c2:	5d                   	pop    %ebp
+  8027c3:	c3                   	ret
+
+008027c4 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  8027c4:	55                   	push   %ebp
+  8027c5:	89 e5                	mov    %esp,%ebp
+  8027c7:	57                   	push   %edi
+  8027c8:	56                   	push   %esi
+  8027c9:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8027ca:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8027d1:	78 2f                	js     802802 <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  8027d3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8027da:	74 72                	je     80284e <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  8027dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8027df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027e4:	b8 27 00 00 00       	mov    $0x27,%eax
+  8027e9:	89 cb                	mov    %ecx,%ebx
+  8027eb:	89 cf                	mov    %ecx,%edi
+  8027ed:	89 ce                	mov    %ecx,%esi
+  8027ef:	55                   	push   %ebp
+  8027f0:	68 f9 27 80 00       	push   $0x8027f9
+  8027f5:	89 e5                	mov    %esp,%ebp
+  8027f7:	0f 34                	sysenter
+  8027f9:	83 c4 04             	add    $0x4,%esp
+  8027fc:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  8027fd:	5b                   	pop    %ebx
+  8027fe:	5e                   	pop    %esi
+  8027ff:	5f                   	pop    %edi
+  802800:	5d                   	pop    %ebp
+  802801:	c3                   	ret
+  802802:	b8 01 00 00 00       	mov    $0x1,%eax
+  802807:	0f a2                	cpuid
+		return 0;
+  802809:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80280e:	f6 c6 08             	test   $0x8,%dh
+  802811:	74 15                	je     802828 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802813:	89 c2                	mov    %eax,%edx
+  802815:	c1 ea 08             	shr    $0x8,%edx
+  802818:	83 e2 0f             	and    $0xf,%edx
+  80281b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802820:	83 fa 06             	cmp    $0x6,%edx
+  802823:	74 0e                	je     802833 <sys_sysring_setup+0x6f>
+  802825:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802828:	0f b6 c9             	movzbl %cl,%ecx
+  80282b:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802831:	eb a0                	jmp    8027d3 <sys_sysring_setup+0xf>
+  802833:	89 c2                	mov    %eax,%edx
+  802835:	c1 ea 04             	shr    $0x4,%edx
+  802838:	83 e2 0f             	and    $0xf,%edx
+  80283b:	83 fa 02             	cmp    $0x2,%edx
+  80283e:	77 e5                	ja     802825 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  802840:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802843:	83 f8 02             	cmp    $0x2,%eax
+  802846:	0f 97 c1             	seta   %cl
+  802849:	0f b6 c9             	movzbl %cl,%ecx
+  80284c:	eb d7                	jmp    802825 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  80284e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802853:	b8 27 00 00 00       	mov    $0x27,%eax
+  802858:	8b 55 08             	mov    0x8(%ebp),%edx
+  80285b:	89 cb                	mov    %ecx,%ebx
+  80285d:	89 cf                	mov    %ecx,%edi
+  80285f:	89 ce                	mov    %ecx,%esi
+  802861:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  802863:	eb 98                	jmp    8027fd <sys_sysring_setup+0x39>
+
+00802865 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  802865:	55                   	push   %ebp
+  802866:	89 e5                	mov    %esp,%ebp
+  802868:	57                   	push   %edi
+  802869:	56                   	push   %esi
+  80286a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80286b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802872:	78 2e                	js     8028a2 <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  802874:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80287b:	74 71                	je     8028ee <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  80287d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802882:	b8 28 00 00 00       	mov    $0x28,%eax
+  802887:	89 d1                	mov    %edx,%ecx
+  802889:	89 d3                	mov    %edx,%ebx
+  80288b:	89 d7                	mov    %edx,%edi
+  80288d:	89 d6                	mov    %edx,%esi
+  80288f:	55                   	push   %ebp
+  802890:	68 99 28 80 00       	push   $0x802899
+  802895:	89 e5                	mov    %esp,%ebp
+  802897:	0f 34                	sysenter
+  802899:	83 c4 04             	add    $0x4,%esp
+  80289c:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  80289d:	5b                   	pop    %ebx
+  80289e:	5e                   	pop    %esi
+  80289f:	5f                   	pop    %edi
+  8028a0:	5d                   	pop    %ebp
+  8028a1:	c3                   	ret
+  8028a2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028a7:	0f a2                	cpuid
+		return 0;
+  8028a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8028ae:	f6 c6 08             	test   $0x8,%dh
+  8028b1:	74 15                	je     8028c8 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8028b3:	89 c2                	mov    %eax,%edx
+  8028b5:	c1 ea 08             	shr    $0x8,%edx
+  8028b8:	83 e2 0f             	and    $0xf,%edx
+  8028bb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8028c0:	83 fa 06             	cmp    $0x6,%edx
+  8028c3:	74 0e                	je     8028d3 <sys_sysring_enter+0x6e>
+  8028c5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8028c8:	0f b6 c9             	movzbl %cl,%ecx
+  8028cb:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8028d1:	eb a1                	jmp    802874 <sys_sysring_enter+0xf>
+  8028d3:	89 c2                	mov    %eax,%edx
+  8028d5:	c1 ea 04             	shr    $0x4,%edx
+  8028d8:	83 e2 0f             	and    $0xf,%edx
+  8028db:	83 fa 02             	cmp    $0x2,%edx
+  8028de:	77 e5                	ja     8028c5 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  8028e0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8028e3:	83 f8 02             	cmp    $0x2,%eax
+  8028e6:	0f 97 c1             	seta   %cl
+  8028e9:	0f b6 c9             	movzbl %cl,%ecx
+  8028ec:	eb d7                	jmp    8028c5 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  8028ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028f3:	b8 28 00 00 00       	mov    $0x28,%eax
+  8028f8:	89 d1                	mov    %edx,%ecx
+  8028fa:	89 d3                	mov    %edx,%ebx
+  8028fc:	89 d7                	mov    %edx,%edi
+  8028fe:	89 d6                	mov    %edx,%esi
+  802900:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  802902:	eb 99                	jmp    80289d <sys_sysring_enter+0x38>
+
+00802904 <pgfault>:
+// The kernel normally resolves these faults itself (page_fault_cow in
+// kern/trap.c); we only get here if it ran out of memory doing so.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802904:	55                   	push   %ebp
+  802905:	89 e5                	mov    %esp,%ebp
+  802907:	83 ec 08             	sub    $0x8,%esp
+  80290a:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  80290d:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  80290f:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  802912:	f6 c2 02             	test   $0x2,%dl
+  802915:	74 40                	je     802957 <pgfault+0x53>
+  802917:	89 c1                	mov    %eax,%ecx
+  802919:	c1 e9 16             	shr    $0x16,%ecx
+  80291c:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802923:	f6 c1 01             	test   $0x1,%cl
+  802926:	74 2f                	je     802957 <pgfault+0x53>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW))
+  802928:	89 c1                	mov    %eax,%ecx
+  80292a:	c1 e9 0c             	shr    $0xc,%ecx
+  80292d:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  802934:	f6 c5 08             	test   $0x8,%ch
+  802937:	74 1e                	je     802957 <pgfault+0x53>
+	// Replace the page with a private writable copy of itself.  The
+	// kernel allocates, copies and maps it in one system call, so no
+	// temporary mapping at PFTEMP is needed.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  802939:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r = sys_page_copy(0, addr, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  80293e:	83 ec 0c             	sub    $0xc,%esp
+  802941:	6a 07                	push   $0x7
+  802943:	50                   	push   %eax
+  802944:	6a 00                	push   $0x0
+  802946:	50                   	push   %eax
+  802947:	6a 00                	push   $0x0
+  802949:	e8 85 eb ff ff       	call   8014d3 <sys_page_copy>
+  80294e:	83 c4 20             	add    $0x20,%esp
+  802951:	85 c0                	test   %eax,%eax
+  802953:	78 18                	js     80296d <pgfault+0x69>
+		panic("pgfault: sys_page_copy: %e", r);
+}
+  802955:	c9                   	leave
+  802956:	c3                   	ret
+		panic("pgfault: va %08x err %x is not a copy-on-write write",
+  802957:	83 ec 0c             	sub    $0xc,%esp
+  80295a:	52                   	push   %edx
+  80295b:	50                   	push   %eax
+  80295c:	68 44 35 80 00       	push   $0x803544
+  802961:	6a 1c                	push   $0x1c
+  802963:	68 79 35 80 00       	push   $0x803579
+  802968:	e8 e1 d9 ff ff       	call   80034e <_panic>
+		panic("pgfault: sys_page_copy: %e", r);
+  80296d:	50                   	push   %eax
+  80296e:	68 84 35 80 00       	push   $0x803584
+  802973:	6a 26                	push   $0x26
+  802975:	68 79 35 80 00       	push   $0x803579
+  80297a:	e8 cf d9 ff ff       	call   80034e <_panic>
+
+0080297f <ufork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+ufork(void)
+{
+  80297f:	55                   	push   %ebp
+  802980:	89 e5                	mov    %esp,%ebp
+  802982:	57                   	push   %edi
+  802983:	56                   	push   %esi
+  802984:	53                   	push   %ebx
+  802985:	81 ec 38 04 00 00    	sub    $0x438,%esp
+	struct page_range vec[PAGE_VEC_MAX], *last;
+	uintptr_t va;
+	size_t n;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  80298b:	68 04 29 80 00       	push   $0x802904
+  802990:	e8 03 05 00 00       	call   802e98 <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  802995:	b8 07 00 00 00       	mov    $0x7,%eax
+  80299a:	cd 30                	int    $0x30
+  80299c:	89 85 d4 fb ff ff    	mov    %eax,-0x42c(%ebp)
+
+	envid = sys_exofork();
+	if (envid < 0)
+  8029a2:	83 c4 10             	add    $0x10,%esp
+  8029a5:	85 c0                	test   %eax,%eax
+  8029a7:	0f 88 f2 01 00 00    	js     802b9f <ufork+0x220>
+		return 0;
+	}
+
+	// Copy every run of mapped pages below the exception stack, which
+	// must not be shared.
+	va = 0;
+  8029ad:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  8029b2:	74 0b                	je     8029bf <ufork+0x40>
+  8029b4:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  8029ba:	e9 07 01 00 00       	jmp    802ac6 <ufork+0x147>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8029bf:	e8 22 e8 ff ff       	call   8011e6 <sys_getenvid>
+  8029c4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8029c9:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  8029cf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8029d4:	a3 08 40 80 00       	mov    %eax,0x804008
+		return 0;
+  8029d9:	e9 c1 01 00 00       	jmp    802b9f <ufork+0x220>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+		n = r;
+		last = &vec[n - 1];
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  8029de:	83 ea 01             	sub    $0x1,%edx
+  8029e1:	89 c1                	mov    %eax,%ecx
+  8029e3:	c1 e1 04             	shl    $0x4,%ecx
+  8029e6:	89 94 0d ec fd ff ff 	mov    %edx,-0x214(%ebp,%ecx,1)
+			n--;
+  8029ed:	85 d2                	test   %edx,%edx
+  8029ef:	0f 44 f0             	cmove  %eax,%esi
+  8029f2:	e9 12 01 00 00       	jmp    802b09 <ufork+0x18a>
+	for (i = 0; i < n; i++) {
+  8029f7:	83 c1 01             	add    $0x1,%ecx
+  8029fa:	83 c0 10             	add    $0x10,%eax
+  8029fd:	39 8d e4 fb ff ff    	cmp    %ecx,-0x41c(%ebp)
+  802a03:	74 6a                	je     802a6f <ufork+0xf0>
+		vec[i].pr_dstva = vec[i].pr_va;
+  802a05:	89 c3                	mov    %eax,%ebx
+  802a07:	8b 10                	mov    (%eax),%edx
+  802a09:	89 50 0c             	mov    %edx,0xc(%eax)
+		if (vec[i].pr_perm & PTE_SHARE)
+  802a0c:	8b 50 08             	mov    0x8(%eax),%edx
+  802a0f:	f6 c6 04             	test   $0x4,%dh
+  802a12:	75 e3                	jne    8029f7 <ufork+0x78>
+		if (vec[i].pr_perm & (PTE_W | PTE_COW)) {
+  802a14:	f7 c2 02 08 00 00    	test   $0x802,%edx
+  802a1a:	74 db                	je     8029f7 <ufork+0x78>
+			vec[i].pr_perm = (vec[i].pr_perm & ~PTE_W) | PTE_COW;
+  802a1c:	81 e2 fd f7 ff ff    	and    $0xfffff7fd,%edx
+  802a22:	80 ce 08             	or     $0x8,%dh
+  802a25:	89 95 dc fb ff ff    	mov    %edx,-0x424(%ebp)
+  802a2b:	89 53 08             	mov    %edx,0x8(%ebx)
+			cow[ncow++] = vec[i];
+  802a2e:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  802a34:	c1 e6 04             	shl    $0x4,%esi
+  802a37:	89 f2                	mov    %esi,%edx
+  802a39:	8d b4 35 e8 fb ff ff 	lea    -0x418(%ebp,%esi,1),%esi
+  802a40:	8b 38                	mov    (%eax),%edi
+  802a42:	89 bc 15 e8 fb ff ff 	mov    %edi,-0x418(%ebp,%edx,1)
+  802a49:	8b 78 04             	mov    0x4(%eax),%edi
+  802a4c:	89 7e 04             	mov    %edi,0x4(%esi)
+  802a4f:	8b bd dc fb ff ff    	mov    -0x424(%ebp),%edi
+  802a55:	89 7e 08             	mov    %edi,0x8(%esi)
+  802a58:	8b 50 0c             	mov    0xc(%eax),%edx
+  802a5b:	89 56 0c             	mov    %edx,0xc(%esi)
+  802a5e:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  802a64:	8d 7e 01             	lea    0x1(%esi),%edi
+  802a67:	89 bd e0 fb ff ff    	mov    %edi,-0x420(%ebp)
+  802a6d:	eb 88                	jmp    8029f7 <ufork+0x78>
+	if ((r = sys_page_map_vec(0, envid, vec, n, 0)) < 0)
+  802a6f:	8b b5 e4 fb ff ff    	mov    -0x41c(%ebp),%esi
+  802a75:	8b bd d8 fb ff ff    	mov    -0x428(%ebp),%edi
+  802a7b:	83 ec 0c             	sub    $0xc,%esp
+  802a7e:	6a 00                	push   $0x0
+  802a80:	56                   	push   %esi
+  802a81:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802a87:	50                   	push   %eax
+  802a88:	ff b5 d4 fb ff ff    	push   -0x42c(%ebp)
+  802a8e:	6a 00                	push   $0x0
+  802a90:	e8 80 f4 ff ff       	call   801f15 <sys_page_map_vec>
+  802a95:	83 c4 20             	add    $0x20,%esp
+  802a98:	85 c0                	test   %eax,%eax
+  802a9a:	0f 88 e5 00 00 00    	js     802b85 <ufork+0x206>
+	return sys_page_map_vec(0, 0, cow, ncow, 0);
+  802aa0:	83 ec 0c             	sub    $0xc,%esp
+  802aa3:	6a 00                	push   $0x0
+  802aa5:	ff b5 e0 fb ff ff    	push   -0x420(%ebp)
+  802aab:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  802ab1:	50                   	push   %eax
+  802ab2:	6a 00                	push   $0x0
+  802ab4:	6a 00                	push   $0x0
+  802ab6:	e8 5a f4 ff ff       	call   801f15 <sys_page_map_vec>
+		if ((r = duppages(envid, vec, n)) < 0)
+  802abb:	83 c4 20             	add    $0x20,%esp
+  802abe:	85 c0                	test   %eax,%eax
+  802ac0:	0f 88 e7 00 00 00    	js     802bad <ufork+0x22e>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+  802ac6:	6a 20                	push   $0x20
+  802ac8:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802ace:	50                   	push   %eax
+  802acf:	57                   	push   %edi
+  802ad0:	6a 00                	push   $0x0
+  802ad2:	e8 82 f4 ff ff       	call   801f59 <sys_vm_ranges>
+  802ad7:	83 c4 10             	add    $0x10,%esp
+  802ada:	85 c0                	test   %eax,%eax
+  802adc:	7e 51                	jle    802b2f <ufork+0x1b0>
+		n = r;
+  802ade:	89 c6                	mov    %eax,%esi
+		last = &vec[n - 1];
+  802ae0:	83 e8 01             	sub    $0x1,%eax
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+  802ae3:	89 c1                	mov    %eax,%ecx
+  802ae5:	c1 e1 04             	shl    $0x4,%ecx
+  802ae8:	8b 94 0d ec fd ff ff 	mov    -0x214(%ebp,%ecx,1),%edx
+  802aef:	89 d3                	mov    %edx,%ebx
+  802af1:	c1 e3 0c             	shl    $0xc,%ebx
+  802af4:	89 df                	mov    %ebx,%edi
+  802af6:	03 bc 0d e8 fd ff ff 	add    -0x218(%ebp,%ecx,1),%edi
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  802afd:	81 ff 00 00 c0 ee    	cmp    $0xeec00000,%edi
+  802b03:	0f 84 d5 fe ff ff    	je     8029de <ufork+0x5f>
+	for (i = 0; i < n; i++) {
+  802b09:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+	size_t i, ncow = 0;
+  802b0f:	c7 85 e0 fb ff ff 00 	movl   $0x0,-0x420(%ebp)
+  802b16:	00 00 00 
+	for (i = 0; i < n; i++) {
+  802b19:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b1e:	89 bd d8 fb ff ff    	mov    %edi,-0x428(%ebp)
+  802b24:	89 b5 e4 fb ff ff    	mov    %esi,-0x41c(%ebp)
+  802b2a:	e9 ce fe ff ff       	jmp    8029fd <ufork+0x7e>
+			goto fail;
+	}
+	if (r < 0)
+  802b2f:	89 c6                	mov    %eax,%esi
+  802b31:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  802b37:	85 c0                	test   %eax,%eax
+  802b39:	78 52                	js     802b8d <ufork+0x20e>
+		goto fail;
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE),
+  802b3b:	83 ec 04             	sub    $0x4,%esp
+  802b3e:	6a 07                	push   $0x7
+  802b40:	68 00 f0 bf ee       	push   $0xeebff000
+  802b45:	53                   	push   %ebx
+  802b46:	e8 3a e7 ff ff       	call   801285 <sys_page_alloc>
+  802b4b:	89 c6                	mov    %eax,%esi
+  802b4d:	83 c4 10             	add    $0x10,%esp
+  802b50:	85 c0                	test   %eax,%eax
+  802b52:	78 39                	js     802b8d <ufork+0x20e>
+				PTE_P | PTE_U | PTE_W)) < 0
+	    || (r = sys_env_set_pgfault_upcall(envid,
+			thisenv->env_pgfault_upcall)) < 0
+  802b54:	a1 08 40 80 00       	mov    0x804008,%eax
+  802b59:	8b 40 74             	mov    0x74(%eax),%eax
+	    || (r = sys_env_set_pgfault_upcall(envid,
+  802b5c:	83 ec 08             	sub    $0x8,%esp
+  802b5f:	50                   	push   %eax
+  802b60:	53                   	push   %ebx
+  802b61:	e8 de ed ff ff       	call   801944 <sys_env_set_pgfault_upcall>
+  802b66:	89 c6                	mov    %eax,%esi
+  802b68:	83 c4 10             	add    $0x10,%esp
+  802b6b:	85 c0                	test   %eax,%eax
+  802b6d:	78 1e                	js     802b8d <ufork+0x20e>
+	    || (r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  802b6f:	83 ec 08             	sub    $0x8,%esp
+  802b72:	6a 02                	push   $0x2
+  802b74:	53                   	push   %ebx
+  802b75:	e8 bc ea ff ff       	call   801636 <sys_env_set_status>
+  802b7a:	89 c6                	mov    %eax,%esi
+  802b7c:	83 c4 10             	add    $0x10,%esp
+  802b7f:	85 c0                	test   %eax,%eax
+  802b81:	79 1c                	jns    802b9f <ufork+0x220>
+  802b83:	eb 08                	jmp    802b8d <ufork+0x20e>
+  802b85:	89 c6                	mov    %eax,%esi
+  802b87:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+		goto fail;
+	return envid;
+
+fail:
+	sys_env_destroy(envid);
+  802b8d:	83 ec 0c             	sub    $0xc,%esp
+  802b90:	53                   	push   %ebx
+  802b91:	e8 8e e5 ff ff       	call   801124 <sys_env_destroy>
+	return r;
+  802b96:	83 c4 10             	add    $0x10,%esp
+  802b99:	89 b5 d4 fb ff ff    	mov    %esi,-0x42c(%ebp)
+}
+  802b9f:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+  802ba5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ba8:	5b                   	pop    %ebx
+  802ba9:	5e                   	pop    %esi
+  802baa:	5f                   	pop    %edi
+  802bab:	5d                   	pop    %ebp
+  802bac:	c3                   	ret
+  802bad:	89 c6                	mov    %eax,%esi
+  802baf:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  802bb5:	eb d6                	jmp    802b8d <ufork+0x20e>
+
+00802bb7 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  802bb7:	55                   	push   %ebp
+  802bb8:	89 e5                	mov    %esp,%ebp
+  802bba:	53                   	push   %ebx
+  802bbb:	83 ec 04             	sub    $0x4,%esp
+	envid_t envid;
+
+	envid = sys_fork();
+  802bbe:	e8 90 f2 ff ff       	call   801e53 <sys_fork>
+  802bc3:	89 c3                	mov    %eax,%ebx
+	if (envid == 0)
+  802bc5:	85 c0                	test   %eax,%eax
+  802bc7:	74 07                	je     802bd0 <fork+0x19>
+		thisenv = &envs[ENVX(sys_getenvid())];
+	return envid;
+}
+  802bc9:	89 d8                	mov    %ebx,%eax
+  802bcb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bce:	c9                   	leave
+  802bcf:	c3                   	ret
+		thisenv = &envs[ENVX(sys_getenvid())];
+  802bd0:	e8 11 e6 ff ff       	call   8011e6 <sys_getenvid>
+  802bd5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802bda:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802be0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802be5:	a3 08 40 80 00       	mov    %eax,0x804008
+	return envid;
+  802bea:	eb dd                	jmp    802bc9 <fork+0x12>
+
+00802bec <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  802bec:	55                   	push   %ebp
+  802bed:	89 e5                	mov    %esp,%ebp
+  802bef:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  802bf2:	68 9f 35 80 00       	push   $0x80359f
+  802bf7:	68 a1 00 00 00       	push   $0xa1
+  802bfc:	68 79 35 80 00       	push   $0x803579
+  802c01:	e8 48 d7 ff ff       	call   80034e <_panic>
+
+00802c06 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802c06:	55                   	push   %ebp
+  802c07:	89 e5                	mov    %esp,%ebp
+  802c09:	56                   	push   %esi
+  802c0a:	53                   	push   %ebx
+  802c0b:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c0e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c11:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if ((r = sys_ipc_recv(pg ? pg : (void *) UTOP)) < 0) {
+  802c14:	85 c0                	test   %eax,%eax
+  802c16:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802c1b:	0f 44 c2             	cmove  %edx,%eax
+  802c1e:	83 ec 0c             	sub    $0xc,%esp
+  802c21:	50                   	push   %eax
+  802c22:	e8 2f ef ff ff       	call   801b56 <sys_ipc_recv>
+  802c27:	83 c4 10             	add    $0x10,%esp
+  802c2a:	85 c0                	test   %eax,%eax
+  802c2c:	78 34                	js     802c62 <ipc_recv+0x5c>
+			*from_env_store = 0;
+		if (perm_store)
+			*perm_store = 0;
+		return r;
+	}
+	if (from_env_store)
+  802c2e:	85 f6                	test   %esi,%esi
+  802c30:	74 0d                	je     802c3f <ipc_recv+0x39>
+		*from_env_store = thisenv->env_ipc_from;
+  802c32:	a1 08 40 80 00       	mov    0x804008,%eax
+  802c37:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  802c3d:	89 06                	mov    %eax,(%esi)
+	if (perm_store)
+  802c3f:	85 db                	test   %ebx,%ebx
+  802c41:	74 0d                	je     802c50 <ipc_recv+0x4a>
+		*perm_store = thisenv->env_ipc_perm;
+  802c43:	a1 08 40 80 00       	mov    0x804008,%eax
+  802c48:	8b 80 9c 00 00 00    	mov    0x9c(%eax),%eax
+  802c4e:	89 03                	mov    %eax,(%ebx)
+	return thisenv->env_ipc_msg.m_w[0];
+  802c50:	a1 08 40 80 00       	mov    0x804008,%eax
+  802c55:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802c5b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c5e:	5b                   	pop    %ebx
+  802c5f:	5e                   	pop    %esi
+  802c60:	5d                   	pop    %ebp
+  802c61:	c3                   	ret
+		if (from_env_store)
+  802c62:	85 f6                	test   %esi,%esi
+  802c64:	74 06                	je     802c6c <ipc_recv+0x66>
+			*from_env_store = 0;
+  802c66:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802c6c:	85 db                	test   %ebx,%ebx
+  802c6e:	74 eb                	je     802c5b <ipc_recv+0x55>
+			*perm_store = 0;
+  802c70:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802c76:	eb e3                	jmp    802c5b <ipc_recv+0x55>
+
+00802c78 <ipc_send>:
+//
+// The kernel queues us behind any other senders until 'toenv'
+// receives, so we only come back to retry if its queue was full.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802c78:	55                   	push   %ebp
+  802c79:	89 e5                	mov    %esp,%ebp
+  802c7b:	57                   	push   %edi
+  802c7c:	56                   	push   %esi
+  802c7d:	53                   	push   %ebx
+  802c7e:	83 ec 0c             	sub    $0xc,%esp
+  802c81:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802c84:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802c87:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_send(to_env, val, pg ? pg : (void *) UTOP, perm))
+  802c8a:	85 db                	test   %ebx,%ebx
+  802c8c:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802c91:	0f 44 d8             	cmove  %eax,%ebx
+  802c94:	eb 05                	jmp    802c9b <ipc_send+0x23>
+	       == -E_AGAIN)
+		sys_yield();
+  802c96:	e8 fc e8 ff ff       	call   801597 <sys_yield>
+	while ((r = sys_ipc_send(to_env, val, pg ? pg : (void *) UTOP, perm))
+  802c9b:	ff 75 14             	push   0x14(%ebp)
+  802c9e:	53                   	push   %ebx
+  802c9f:	56                   	push   %esi
+  802ca0:	57                   	push   %edi
+  802ca1:	e8 09 ee ff ff       	call   801aaf <sys_ipc_send>
+	       == -E_AGAIN)
+  802ca6:	83 c4 10             	add    $0x10,%esp
+  802ca9:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802cac:	74 e8                	je     802c96 <ipc_send+0x1e>
+	if (r < 0)
+  802cae:	85 c0                	test   %eax,%eax
+  802cb0:	78 08                	js     802cba <ipc_send+0x42>
+		panic("ipc_send: %e", r);
+}
+  802cb2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cb5:	5b                   	pop    %ebx
+  802cb6:	5e                   	pop    %esi
+  802cb7:	5f                   	pop    %edi
+  802cb8:	5d                   	pop    %ebp
+  802cb9:	c3                   	ret
+		panic("ipc_send: %e", r);
+  802cba:	50                   	push   %eax
+  802cbb:	68 b5 35 80 00       	push   $0x8035b5
+  802cc0:	6a 3a                	push   $0x3a
+  802cc2:	68 c2 35 80 00       	push   $0x8035c2
+  802cc7:	e8 82 d6 ff ff       	call   80034e <_panic>
+
+00802ccc <ipc_send_range>:
+
+// Like ipc_send, but send the 'npages' contiguous pages at 'pg' in one
+// message.  The receiver maps as many as fit in its window.
+void
+ipc_send_range(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  802ccc:	55                   	push   %ebp
+  802ccd:	89 e5                	mov    %esp,%ebp
+  802ccf:	57                   	push   %edi
+  802cd0:	56                   	push   %esi
+  802cd1:	53                   	push   %ebx
+  802cd2:	83 ec 0c             	sub    $0xc,%esp
+  802cd5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802cd8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802cdb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_send_range(to_env, val, pg, npages, perm))
+  802cde:	eb 05                	jmp    802ce5 <ipc_send_range+0x19>
+	       == -E_AGAIN)
+		sys_yield();
+  802ce0:	e8 b2 e8 ff ff       	call   801597 <sys_yield>
+	while ((r = sys_ipc_send_range(to_env, val, pg, npages, perm))
+  802ce5:	83 ec 0c             	sub    $0xc,%esp
+  802ce8:	ff 75 18             	push   0x18(%ebp)
+  802ceb:	ff 75 14             	push   0x14(%ebp)
+  802cee:	53                   	push   %ebx
+  802cef:	56                   	push   %esi
+  802cf0:	57                   	push   %edi
+  802cf1:	e8 22 ef ff ff       	call   801c18 <sys_ipc_send_range>
+	       == -E_AGAIN)
+  802cf6:	83 c4 20             	add    $0x20,%esp
+  802cf9:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802cfc:	74 e2                	je     802ce0 <ipc_send_range+0x14>
+	if (r < 0)
+  802cfe:	85 c0                	test   %eax,%eax
+  802d00:	78 08                	js     802d0a <ipc_send_range+0x3e>
+		panic("ipc_send_range: %e", r);
+}
+  802d02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d05:	5b                   	pop    %ebx
+  802d06:	5e                   	pop    %esi
+  802d07:	5f                   	pop    %edi
+  802d08:	5d                   	pop    %ebp
+  802d09:	c3                   	ret
+		panic("ipc_send_range: %e", r);
+  802d0a:	50                   	push   %eax
+  802d0b:	68 cc 35 80 00       	push   $0x8035cc
+  802d10:	6a 48                	push   $0x48
+  802d12:	68 c2 35 80 00       	push   $0x8035c2
+  802d17:	e8 32 d6 ff ff       	call   80034e <_panic>
+
+00802d1c <ipc_recv_range>:
+// (which must not be null).  On return *npages holds the number of
+// pages received, which is 0 on error or if the sender sent none.
+int32_t
+ipc_recv_range(envid_t *from_env_store, void *pg, size_t *npages,
+	       int *perm_store)
+{
+  802d1c:	55                   	push   %ebp
+  802d1d:	89 e5                	mov    %esp,%ebp
+  802d1f:	57                   	push   %edi
+  802d20:	56                   	push   %esi
+  802d21:	53                   	push   %ebx
+  802d22:	83 ec 14             	sub    $0x14,%esp
+  802d25:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d28:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d2b:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if ((r = sys_ipc_recv_range(pg, *npages)) < 0) {
+  802d2e:	ff 33                	push   (%ebx)
+  802d30:	ff 75 0c             	push   0xc(%ebp)
+  802d33:	e8 83 ef ff ff       	call   801cbb <sys_ipc_recv_range>
+  802d38:	83 c4 10             	add    $0x10,%esp
+  802d3b:	85 c0                	test   %eax,%eax
+  802d3d:	78 42                	js     802d81 <ipc_recv_range+0x65>
+		if (perm_store)
+			*perm_store = 0;
+		*npages = 0;
+		return r;
+	}
+	if (from_env_store)
+  802d3f:	85 ff                	test   %edi,%edi
+  802d41:	74 0d                	je     802d50 <ipc_recv_range+0x34>
+		*from_env_store = thisenv->env_ipc_from;
+  802d43:	a1 08 40 80 00       	mov    0x804008,%eax
+  802d48:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  802d4e:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  802d50:	85 f6                	test   %esi,%esi
+  802d52:	74 0d                	je     802d61 <ipc_recv_range+0x45>
+		*perm_store = thisenv->env_ipc_perm;
+  802d54:	a1 08 40 80 00       	mov    0x804008,%eax
+  802d59:	8b 80 9c 00 00 00    	mov    0x9c(%eax),%eax
+  802d5f:	89 06                	mov    %eax,(%esi)
+	*npages = thisenv->env_ipc_npages;
+  802d61:	a1 08 40 80 00       	mov    0x804008,%eax
+  802d66:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802d6c:	89 03                	mov    %eax,(%ebx)
+	return thisenv->env_ipc_msg.m_w[0];
+  802d6e:	a1 08 40 80 00       	mov    0x804008,%eax
+  802d73:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802d79:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d7c:	5b                   	pop    %ebx
+  802d7d:	5e                   	pop    %esi
+  802d7e:	5f                   	pop    %edi
+  802d7f:	5d                   	pop    %ebp
+  802d80:	c3                   	ret
+		if (from_env_store)
+  802d81:	85 ff                	test   %edi,%edi
+  802d83:	74 06                	je     802d8b <ipc_recv_range+0x6f>
+			*from_env_store = 0;
+  802d85:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  802d8b:	85 f6                	test   %esi,%esi
+  802d8d:	74 06                	je     802d95 <ipc_recv_range+0x79>
+			*perm_store = 0;
+  802d8f:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		*npages = 0;
+  802d95:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		return r;
+  802d9b:	eb dc                	jmp    802d79 <ipc_recv_range+0x5d>
+
+00802d9d <ipc_send_msg>:
+// Send the IPC_MSG_WORDS words of 'msg' to 'to_env', in registers and
+// without a page.  Waits like ipc_send until 'to_env' takes them, and
+// panics on any error other than -E_AGAIN.
+void
+ipc_send_msg(envid_t to_env, const struct ipc_msg *msg)
+{
+  802d9d:	55                   	push   %ebp
+  802d9e:	89 e5                	mov    %esp,%ebp
+  802da0:	56                   	push   %esi
+  802da1:	53                   	push   %ebx
+  802da2:	8b 75 08             	mov    0x8(%ebp),%esi
+  802da5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_send_msg(to_env, msg)) == -E_AGAIN)
+  802da8:	eb 05                	jmp    802daf <ipc_send_msg+0x12>
+		sys_yield();
+  802daa:	e8 e8 e7 ff ff       	call   801597 <sys_yield>
+	while ((r = sys_ipc_send_msg(to_env, msg)) == -E_AGAIN)
+  802daf:	83 ec 08             	sub    $0x8,%esp
+  802db2:	53                   	push   %ebx
+  802db3:	56                   	push   %esi
+  802db4:	e8 3a f0 ff ff       	call   801df3 <sys_ipc_send_msg>
+  802db9:	83 c4 10             	add    $0x10,%esp
+  802dbc:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802dbf:	74 e9                	je     802daa <ipc_send_msg+0xd>
+	if (r < 0)
+  802dc1:	85 c0                	test   %eax,%eax
+  802dc3:	78 07                	js     802dcc <ipc_send_msg+0x2f>
+		panic("ipc_send_msg: %e", r);
+}
+  802dc5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802dc8:	5b                   	pop    %ebx
+  802dc9:	5e                   	pop    %esi
+  802dca:	5d                   	pop    %ebp
+  802dcb:	c3                   	ret
+		panic("ipc_send_msg: %e", r);
+  802dcc:	50                   	push   %eax
+  802dcd:	68 df 35 80 00       	push   $0x8035df
+  802dd2:	6a 6f                	push   $0x6f
+  802dd4:	68 c2 35 80 00       	push   $0x8035c2
+  802dd9:	e8 70 d5 ff ff       	call   80034e <_panic>
+
+00802dde <ipc_recv_msg>:
+// ipc_call or plain ipc_send (whose value is word 0, and whose page is
+// not taken), it arrives in registers and needs no page.
+// Returns the sender's envid, < 0 on error.
+envid_t
+ipc_recv_msg(struct ipc_msg *msg)
+{
+  802dde:	55                   	push   %ebp
+  802ddf:	89 e5                	mov    %esp,%ebp
+  802de1:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_reply_wait(0, msg);
+  802de4:	ff 75 08             	push   0x8(%ebp)
+  802de7:	6a 00                	push   $0x0
+  802de9:	e8 cb ef ff ff       	call   801db9 <sys_ipc_reply_wait>
+}
+  802dee:	c9                   	leave
+  802def:	c3                   	ret
+
+00802df0 <ipc_call>:
+// ipc_reply_wait (or ipc_recv), and straight back when it replies.
+// Retries while to_env's queue is full.
+// Returns 0 on success, < 0 on error.
+int
+ipc_call(envid_t to_env, struct ipc_msg *msg)
+{
+  802df0:	55                   	push   %ebp
+  802df1:	89 e5                	mov    %esp,%ebp
+  802df3:	56                   	push   %esi
+  802df4:	53                   	push   %ebx
+  802df5:	8b 75 08             	mov    0x8(%ebp),%esi
+  802df8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_call(to_env, msg)) == -E_AGAIN)
+  802dfb:	eb 05                	jmp    802e02 <ipc_call+0x12>
+		sys_yield();
+  802dfd:	e8 95 e7 ff ff       	call   801597 <sys_yield>
+	while ((r = sys_ipc_call(to_env, msg)) == -E_AGAIN)
+  802e02:	83 ec 08             	sub    $0x8,%esp
+  802e05:	53                   	push   %ebx
+  802e06:	56                   	push   %esi
+  802e07:	e8 73 ef ff ff       	call   801d7f <sys_ipc_call>
+  802e0c:	83 c4 10             	add    $0x10,%esp
+  802e0f:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802e12:	74 e9                	je     802dfd <ipc_call+0xd>
+	return r;
+}
+  802e14:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e17:	5b                   	pop    %ebx
+  802e18:	5e                   	pop    %esi
+  802e19:	5d                   	pop    %ebp
+  802e1a:	c3                   	ret
+
+00802e1b <ipc_reply_wait>:
+//	}
+//
+// Returns the envid of the sender, < 0 on error.
+envid_t
+ipc_reply_wait(envid_t to_env, struct ipc_msg *msg)
+{
+  802e1b:	55                   	push   %ebp
+  802e1c:	89 e5                	mov    %esp,%ebp
+  802e1e:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_reply_wait(to_env, msg);
+  802e21:	ff 75 0c             	push   0xc(%ebp)
+  802e24:	ff 75 08             	push   0x8(%ebp)
+  802e27:	e8 8d ef ff ff       	call   801db9 <sys_ipc_reply_wait>
+}
+  802e2c:	c9                   	leave
+  802e2d:	c3                   	ret
+
+00802e2e <ep_send>:
+
+// Send 'msg' to endpoint 'epid', waiting while its queue is full.
+// Returns 0 on success, < 0 if the endpoint is gone or not ours to use.
+int
+ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  802e2e:	55                   	push   %ebp
+  802e2f:	89 e5                	mov    %esp,%ebp
+  802e31:	56                   	push   %esi
+  802e32:	53                   	push   %ebx
+  802e33:	8b 75 08             	mov    0x8(%ebp),%esi
+  802e36:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ep_send(epid, msg)) == -E_AGAIN)
+  802e39:	eb 05                	jmp    802e40 <ep_send+0x12>
+		sys_yield();
+  802e3b:	e8 57 e7 ff ff       	call   801597 <sys_yield>
+	while ((r = sys_ep_send(epid, msg)) == -E_AGAIN)
+  802e40:	83 ec 08             	sub    $0x8,%esp
+  802e43:	53                   	push   %ebx
+  802e44:	56                   	push   %esi
+  802e45:	e8 c6 f8 ff ff       	call   802710 <sys_ep_send>
+  802e4a:	83 c4 10             	add    $0x10,%esp
+  802e4d:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802e50:	74 e9                	je     802e3b <ep_send+0xd>
+	return r;
+}
+  802e52:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e55:	5b                   	pop    %ebx
+  802e56:	5e                   	pop    %esi
+  802e57:	5d                   	pop    %ebp
+  802e58:	c3                   	ret
+
+00802e59 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802e59:	55                   	push   %ebp
+  802e5a:	89 e5                	mov    %esp,%ebp
+  802e5c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802e5f:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802e64:	69 d0 68 01 00 00    	imul   $0x168,%eax,%edx
+  802e6a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802e70:	8b 52 50             	mov    0x50(%edx),%edx
+  802e73:	39 ca                	cmp    %ecx,%edx
+  802e75:	74 11                	je     802e88 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802e77:	83 c0 01             	add    $0x1,%eax
+  802e7a:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802e7f:	75 e3                	jne    802e64 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802e81:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e86:	eb 0e                	jmp    802e96 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802e88:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802e8e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802e93:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802e96:	5d                   	pop    %ebp
+  802e97:	c3                   	ret
+
+00802e98 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802e98:	55                   	push   %ebp
+  802e99:	89 e5                	mov    %esp,%ebp
+  802e9b:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  802e9e:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  802ea5:	74 0a                	je     802eb1 <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  802ea7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802eaa:	a3 0c 40 80 00       	mov    %eax,0x80400c
+}
+  802eaf:	c9                   	leave
+  802eb0:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE),
+  802eb1:	83 ec 04             	sub    $0x4,%esp
+  802eb4:	6a 07                	push   $0x7
+  802eb6:	68 00 f0 bf ee       	push   $0xeebff000
+  802ebb:	6a 00                	push   $0x0
+  802ebd:	e8 c3 e3 ff ff       	call   801285 <sys_page_alloc>
+  802ec2:	83 c4 10             	add    $0x10,%esp
+  802ec5:	85 c0                	test   %eax,%eax
+  802ec7:	78 28                	js     802ef1 <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  802ec9:	83 ec 08             	sub    $0x8,%esp
+  802ecc:	68 03 2f 80 00       	push   $0x802f03
+  802ed1:	6a 00                	push   $0x0
+  802ed3:	e8 6c ea ff ff       	call   801944 <sys_env_set_pgfault_upcall>
+  802ed8:	83 c4 10             	add    $0x10,%esp
+  802edb:	85 c0                	test   %eax,%eax
+  802edd:	79 c8                	jns    802ea7 <set_pgfault_handler+0xf>
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+  802edf:	50                   	push   %eax
+  802ee0:	68 18 36 80 00       	push   $0x803618
+  802ee5:	6a 24                	push   $0x24
+  802ee7:	68 4c 36 80 00       	push   $0x80364c
+  802eec:	e8 5d d4 ff ff       	call   80034e <_panic>
+			panic("set_pgfault_handler: sys_page_alloc: %e", r);
+  802ef1:	50                   	push   %eax
+  802ef2:	68 f0 35 80 00       	push   $0x8035f0
+  802ef7:	6a 22                	push   $0x22
+  802ef9:	68 4c 36 80 00       	push   $0x80364c
+  802efe:	e8 4b d4 ff ff       	call   80034e <_panic>
+
+00802f03 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802f03:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802f04:	a1 0c 40 80 00       	mov    0x80400c,%eax
+	call *%eax
+  802f09:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802f0b:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 0x28(%esp), %ebx		// trap-time eip
+  802f0e:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl 0x30(%esp), %eax		// trap-time esp
+  802f12:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  802f16:	83 e8 04             	sub    $0x4,%eax
+	movl %ebx, (%eax)
+  802f19:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 0x30(%esp)
+  802f1b:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp			// skip fault_va and err
+  802f1f:	83 c4 08             	add    $0x8,%esp
+	popal
+  802f22:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp			// skip eip
+  802f23:	83 c4 04             	add    $0x4,%esp
+	popfl
+  802f26:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802f27:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802f28:	c3                   	ret
+
+00802f29 <dm>:
+  802f29:	55                   	push   %ebp
+  802f2a:	57                   	push   %edi
+  802f2b:	56                   	push   %esi
+  802f2c:	53                   	push   %ebx
+  802f2d:	83 ec 24             	sub    $0x24,%esp
+  802f30:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802f34:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802f38:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802f3c:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802f40:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802f44:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802f48:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802f4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f51:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f56:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802f5b:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802f62:	00 
+  802f63:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802f6a:	00 
+  802f6b:	89 fb                	mov    %edi,%ebx
+  802f6d:	eb 08                	jmp    802f77 <dm+0x4e>
+  802f6f:	83 e9 01             	sub    $0x1,%ecx
+  802f72:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802f75:	74 68                	je     802fdf <dm+0xb6>
+  802f77:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802f7b:	01 c0                	add    %eax,%eax
+  802f7d:	89 c6                	mov    %eax,%esi
+  802f7f:	89 d7                	mov    %edx,%edi
+  802f81:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802f85:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802f89:	0f ad d0             	shrd   %cl,%edx,%eax
+  802f8c:	d3 ea                	shr    %cl,%edx
+  802f8e:	f6 c1 20             	test   $0x20,%cl
+  802f91:	74 04                	je     802f97 <dm+0x6e>
+  802f93:	89 d0                	mov    %edx,%eax
+  802f95:	31 d2                	xor    %edx,%edx
+  802f97:	83 e0 01             	and    $0x1,%eax
+  802f9a:	89 04 24             	mov    %eax,(%esp)
+  802f9d:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802fa4:	00 
+  802fa5:	8b 04 24             	mov    (%esp),%eax
+  802fa8:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802fac:	09 f0                	or     %esi,%eax
+  802fae:	09 fa                	or     %edi,%edx
+  802fb0:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802fb4:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802fb8:	39 f0                	cmp    %esi,%eax
+  802fba:	89 d5                	mov    %edx,%ebp
+  802fbc:	19 fd                	sbb    %edi,%ebp
+  802fbe:	72 af                	jb     802f6f <dm+0x46>
+  802fc0:	29 f0                	sub    %esi,%eax
+  802fc2:	19 fa                	sbb    %edi,%edx
+  802fc4:	89 cf                	mov    %ecx,%edi
+  802fc6:	c1 ef 05             	shr    $0x5,%edi
+  802fc9:	83 e7 01             	and    $0x1,%edi
+  802fcc:	89 fe                	mov    %edi,%esi
+  802fce:	83 f6 01             	xor    $0x1,%esi
+  802fd1:	d3 e6                	shl    %cl,%esi
+  802fd3:	d3 e7                	shl    %cl,%edi
+  802fd5:	09 74 24 18          	or     %esi,0x18(%esp)
+  802fd9:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802fdd:	eb 90                	jmp    802f6f <dm+0x46>
+  802fdf:	85 db                	test   %ebx,%ebx
+  802fe1:	74 05                	je     802fe8 <dm+0xbf>
+  802fe3:	89 03                	mov    %eax,(%ebx)
+  802fe5:	89 53 04             	mov    %edx,0x4(%ebx)
+  802fe8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802fec:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802ff0:	83 c4 24             	add    $0x24,%esp
+  802ff3:	5b                   	pop    %ebx
+  802ff4:	5e                   	pop    %esi
+  802ff5:	5f                   	pop    %edi
+  802ff6:	5d                   	pop    %ebp
+  802ff7:	c3                   	ret
+
+00802ff8 <__udivdi3>:
+  802ff8:	83 ec 08             	sub    $0x8,%esp
+  802ffb:	6a 00                	push   $0x0
+  802ffd:	ff 74 24 1c          	push   0x1c(%esp)
+  803001:	ff 74 24 1c          	push   0x1c(%esp)
+  803005:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803009:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80300d:	e8 17 ff ff ff       	call   802f29 <dm>
+  803012:	83 c4 14             	add    $0x14,%esp
+  803015:	c3                   	ret
+
+00803016 <__umoddi3>:
+  803016:	83 ec 18             	sub    $0x18,%esp
+  803019:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80301d:	50                   	push   %eax
+  80301e:	ff 74 24 2c          	push   0x2c(%esp)
+  803022:	ff 74 24 2c          	push   0x2c(%esp)
+  803026:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80302a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80302e:	e8 f6 fe ff ff       	call   802f29 <dm>
+  803033:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803037:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80303b:	83 c4 24             	add    $0x24,%esp
+  80303e:	c3                   	ret
+
+0080303f <__divdi3>:
+  80303f:	53                   	push   %ebx
+  803040:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803044:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803048:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80304c:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803050:	85 d2                	test   %edx,%edx
+  803052:	78 15                	js     803069 <__divdi3+0x2a>
+  803054:	85 db                	test   %ebx,%ebx
+  803056:	78 34                	js     80308c <__divdi3+0x4d>
+  803058:	83 ec 04             	sub    $0x4,%esp
+  80305b:	6a 00                	push   $0x0
+  80305d:	53                   	push   %ebx
+  80305e:	51                   	push   %ecx
+  80305f:	e8 c5 fe ff ff       	call   802f29 <dm>
+  803064:	83 c4 10             	add    $0x10,%esp
+  803067:	eb 21                	jmp    80308a <__divdi3+0x4b>
+  803069:	f7 d8                	neg    %eax
+  80306b:	83 d2 00             	adc    $0x0,%edx
+  80306e:	f7 da                	neg    %edx
+  803070:	85 db                	test   %ebx,%ebx
+  803072:	78 30                	js     8030a4 <__divdi3+0x65>
+  803074:	83 ec 04             	sub    $0x4,%esp
+  803077:	6a 00                	push   $0x0
+  803079:	53                   	push   %ebx
+  80307a:	51                   	push   %ecx
+  80307b:	e8 a9 fe ff ff       	call   802f29 <dm>
+  803080:	83 c4 10             	add    $0x10,%esp
+  803083:	f7 d8                	neg    %eax
+  803085:	83 d2 00             	adc    $0x0,%edx
+  803088:	f7 da                	neg    %edx
+  80308a:	5b                   	pop    %ebx
+  80308b:	c3                   	ret
+  80308c:	83 ec 04             	sub    $0x4,%esp
+  80308f:	6a 00                	push   $0x0
+  803091:	f7 d9                	neg    %ecx
+  803093:	83 d3 00             	adc    $0x0,%ebx
+  803096:	f7 db                	neg    %ebx
+  803098:	53                   	push   %ebx
+  803099:	51                   	push   %ecx
+  80309a:	e8 8a fe ff ff       	call   802f29 <dm>
+  80309f:	83 c4 10             	add    $0x10,%esp
+  8030a2:	eb df                	jmp    803083 <__divdi3+0x44>
+  8030a4:	83 ec 04             	sub    $0x4,%esp
+  8030a7:	6a 00                	push   $0x0
+  8030a9:	f7 d9                	neg    %ecx
+  8030ab:	83 d3 00             	adc    $0x0,%ebx
+  8030ae:	f7 db                	neg    %ebx
+  8030b0:	53                   	push   %ebx
+  8030b1:	51                   	push   %ecx
+  8030b2:	e8 72 fe ff ff       	call   802f29 <dm>
+  8030b7:	83 c4 10             	add    $0x10,%esp
+  8030ba:	eb ce                	jmp    80308a <__divdi3+0x4b>
+
+008030bc <__moddi3>:
+  8030bc:	55                   	push   %ebp
+  8030bd:	57                   	push   %edi
+  8030be:	56                   	push   %esi
+  8030bf:	53                   	push   %ebx
+  8030c0:	83 ec 18             	sub    $0x18,%esp
+  8030c3:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  8030c7:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8030cb:	89 f1                	mov    %esi,%ecx
+  8030cd:	f7 d9                	neg    %ecx
+  8030cf:	89 da                	mov    %ebx,%edx
+  8030d1:	83 d2 00             	adc    $0x0,%edx
+  8030d4:	f7 da                	neg    %edx
+  8030d6:	0f 48 ce             	cmovs  %esi,%ecx
+  8030d9:	0f 48 d3             	cmovs  %ebx,%edx
+  8030dc:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8030e0:	50                   	push   %eax
+  8030e1:	8b 74 24 38          	mov    0x38(%esp),%esi
+  8030e5:	f7 de                	neg    %esi
+  8030e7:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  8030eb:	83 d0 00             	adc    $0x0,%eax
+  8030ee:	f7 d8                	neg    %eax
+  8030f0:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  8030f5:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  8030fa:	50                   	push   %eax
+  8030fb:	56                   	push   %esi
+  8030fc:	89 c8                	mov    %ecx,%eax
+  8030fe:	e8 26 fe ff ff       	call   802f29 <dm>
+  803103:	83 c4 10             	add    $0x10,%esp
+  803106:	85 db                	test   %ebx,%ebx
+  803108:	78 10                	js     80311a <__moddi3+0x5e>
+  80310a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80310e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803112:	83 c4 14             	add    $0x14,%esp
+  803115:	5b                   	pop    %ebx
+  803116:	5e                   	pop    %esi
+  803117:	5f                   	pop    %edi
+  803118:	5d                   	pop    %ebp
+  803119:	c3                   	ret
+  80311a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80311e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803122:	f7 d8                	neg    %eax
+  803124:	83 d2 00             	adc    $0x0,%edx
+  803127:	f7 da                	neg    %edx
+  803129:	eb e7                	jmp    803112 <__moddi3+0x56>
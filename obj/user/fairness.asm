@@ -0,0 +1,5615 @@
+
+obj/user/fairness:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 70 00 00 00       	call   8000a1 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 10             	sub    $0x10,%esp
+	envid_t who, id;
+
+	id = sys_getenvid();
+  80003b:	e8 d5 0e 00 00       	call   800f15 <sys_getenvid>
+  800040:	89 c3                	mov    %eax,%ebx
+
+	if (thisenv == &envs[1]) {
+  800042:	81 3d 08 30 80 00 68 	cmpl   $0xeec00168,0x803008
+  800049:	01 c0 ee 
+  80004c:	74 2d                	je     80007b <umain+0x48>
+		while (1) {
+			ipc_recv(&who, 0, 0);
+			cprintf("%x recv from %x\n", id, who);
+		}
+	} else {
+		cprintf("%x loop sending to %x\n", id, envs[1].env_id);
+  80004e:	a1 b0 01 c0 ee       	mov    0xeec001b0,%eax
+  800053:	83 ec 04             	sub    $0x4,%esp
+  800056:	50                   	push   %eax
+  800057:	53                   	push   %ebx
+  800058:	68 71 2b 80 00       	push   $0x802b71
+  80005d:	e8 2f 01 00 00       	call   800191 <cprintf>
+  800062:	83 c4 10             	add    $0x10,%esp
+		while (1)
+			ipc_send(envs[1].env_id, 0, 0, 0);
+  800065:	a1 b0 01 c0 ee       	mov    0xeec001b0,%eax
+  80006a:	6a 00                	push   $0x0
+  80006c:	6a 00                	push   $0x0
+  80006e:	6a 00                	push   $0x0
+  800070:	50                   	push   %eax
+  800071:	e8 2f 26 00 00       	call   8026a5 <ipc_send>
+  800076:	83 c4 10             	add    $0x10,%esp
+  800079:	eb ea                	jmp    800065 <umain+0x32>
+			ipc_recv(&who, 0, 0);
+  80007b:	8d 75 f4             	lea    -0xc(%ebp),%esi
+  80007e:	83 ec 04             	sub    $0x4,%esp
+  800081:	6a 00                	push   $0x0
+  800083:	6a 00                	push   $0x0
+  800085:	56                   	push   %esi
+  800086:	e8 a8 25 00 00       	call   802633 <ipc_recv>
+			cprintf("%x recv from %x\n", id, who);
+  80008b:	83 c4 0c             	add    $0xc,%esp
+  80008e:	ff 75 f4             	push   -0xc(%ebp)
+  800091:	53                   	push   %ebx
+  800092:	68 60 2b 80 00       	push   $0x802b60
+  800097:	e8 f5 00 00 00       	call   800191 <cprintf>
+  80009c:	83 c4 10             	add    $0x10,%esp
+  80009f:	eb dd                	jmp    80007e <umain+0x4b>
+
+008000a1 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000a1:	55                   	push   %ebp
+  8000a2:	89 e5                	mov    %esp,%ebp
+  8000a4:	56                   	push   %esi
+  8000a5:	53                   	push   %ebx
+  8000a6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  8000ac:	e8 64 0e 00 00       	call   800f15 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  8000b1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000b6:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  8000bc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000c1:	a3 08 30 80 00       	mov    %eax,0x803008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000c6:	85 db                	test   %ebx,%ebx
+  8000c8:	7e 07                	jle    8000d1 <libmain+0x30>
+		binaryname = argv[0];
+  8000ca:	8b 06                	mov    (%esi),%eax
+  8000cc:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  8000d1:	83 ec 08             	sub    $0x8,%esp
+  8000d4:	56                   	push   %esi
+  8000d5:	53                   	push   %ebx
+  8000d6:	e8 58 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000db:	e8 0a 00 00 00       	call   8000ea <exit>
+}
+  8000e0:	83 c4 10             	add    $0x10,%esp
+  8000e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000e6:	5b                   	pop    %ebx
+  8000e7:	5e                   	pop    %esi
+  8000e8:	5d                   	pop    %ebp
+  8000e9:	c3                   	ret
+
+008000ea <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000ea:	55                   	push   %ebp
+  8000eb:	89 e5                	mov    %esp,%ebp
+  8000ed:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  8000f0:	6a 00                	push   $0x0
+  8000f2:	e8 5c 0d 00 00       	call   800e53 <sys_env_destroy>
+}
+  8000f7:	83 c4 10             	add    $0x10,%esp
+  8000fa:	c9                   	leave
+  8000fb:	c3                   	ret
+
+008000fc <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000fc:	55                   	push   %ebp
+  8000fd:	89 e5                	mov    %esp,%ebp
+  8000ff:	53                   	push   %ebx
+  800100:	83 ec 04             	sub    $0x4,%esp
+  800103:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800106:	8b 13                	mov    (%ebx),%edx
+  800108:	8d 42 01             	lea    0x1(%edx),%eax
+  80010b:	89 03                	mov    %eax,(%ebx)
+  80010d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800110:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800114:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800119:	74 09                	je     800124 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80011b:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80011f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800122:	c9                   	leave
+  800123:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800124:	83 ec 08             	sub    $0x8,%esp
+  800127:	68 ff 00 00 00       	push   $0xff
+  80012c:	8d 43 08             	lea    0x8(%ebx),%eax
+  80012f:	50                   	push   %eax
+  800130:	e8 e2 0b 00 00       	call   800d17 <sys_cputs>
+		b->idx = 0;
+  800135:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80013b:	83 c4 10             	add    $0x10,%esp
+  80013e:	eb db                	jmp    80011b <putch+0x1f>
+
+00800140 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800140:	55                   	push   %ebp
+  800141:	89 e5                	mov    %esp,%ebp
+  800143:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800149:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800150:	00 00 00 
+	b.cnt = 0;
+  800153:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80015a:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80015d:	ff 75 0c             	push   0xc(%ebp)
+  800160:	ff 75 08             	push   0x8(%ebp)
+  800163:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800169:	50                   	push   %eax
+  80016a:	68 fc 00 80 00       	push   $0x8000fc
+  80016f:	e8 14 01 00 00       	call   800288 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800174:	83 c4 08             	add    $0x8,%esp
+  800177:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80017d:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800183:	50                   	push   %eax
+  800184:	e8 8e 0b 00 00       	call   800d17 <sys_cputs>
+
+	return b.cnt;
+}
+  800189:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80018f:	c9                   	leave
+  800190:	c3                   	ret
+
+00800191 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800191:	55                   	push   %ebp
+  800192:	89 e5                	mov    %esp,%ebp
+  800194:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800197:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80019a:	50                   	push   %eax
+  80019b:	ff 75 08             	push   0x8(%ebp)
+  80019e:	e8 9d ff ff ff       	call   800140 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001a3:	c9                   	leave
+  8001a4:	c3                   	ret
+
+008001a5 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001a5:	55                   	push   %ebp
+  8001a6:	89 e5                	mov    %esp,%ebp
+  8001a8:	57                   	push   %edi
+  8001a9:	56                   	push   %esi
+  8001aa:	53                   	push   %ebx
+  8001ab:	83 ec 1c             	sub    $0x1c,%esp
+  8001ae:	89 c7                	mov    %eax,%edi
+  8001b0:	89 d6                	mov    %edx,%esi
+  8001b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001b5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001b8:	89 d1                	mov    %edx,%ecx
+  8001ba:	89 c2                	mov    %eax,%edx
+  8001bc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001bf:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001c2:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001c5:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001c8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001cb:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001d2:	39 c2                	cmp    %eax,%edx
+  8001d4:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001d7:	72 3e                	jb     800217 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001d9:	83 ec 0c             	sub    $0xc,%esp
+  8001dc:	ff 75 18             	push   0x18(%ebp)
+  8001df:	83 eb 01             	sub    $0x1,%ebx
+  8001e2:	53                   	push   %ebx
+  8001e3:	50                   	push   %eax
+  8001e4:	83 ec 08             	sub    $0x8,%esp
+  8001e7:	ff 75 e4             	push   -0x1c(%ebp)
+  8001ea:	ff 75 e0             	push   -0x20(%ebp)
+  8001ed:	ff 75 dc             	push   -0x24(%ebp)
+  8001f0:	ff 75 d8             	push   -0x28(%ebp)
+  8001f3:	e8 1b 28 00 00       	call   802a13 <__udivdi3>
+  8001f8:	83 c4 18             	add    $0x18,%esp
+  8001fb:	52                   	push   %edx
+  8001fc:	50                   	push   %eax
+  8001fd:	89 f2                	mov    %esi,%edx
+  8001ff:	89 f8                	mov    %edi,%eax
+  800201:	e8 9f ff ff ff       	call   8001a5 <printnum>
+  800206:	83 c4 20             	add    $0x20,%esp
+  800209:	eb 13                	jmp    80021e <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80020b:	83 ec 08             	sub    $0x8,%esp
+  80020e:	56                   	push   %esi
+  80020f:	ff 75 18             	push   0x18(%ebp)
+  800212:	ff d7                	call   *%edi
+  800214:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800217:	83 eb 01             	sub    $0x1,%ebx
+  80021a:	85 db                	test   %ebx,%ebx
+  80021c:	7f ed                	jg     80020b <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80021e:	83 ec 08             	sub    $0x8,%esp
+  800221:	56                   	push   %esi
+  800222:	83 ec 04             	sub    $0x4,%esp
+  800225:	ff 75 e4             	push   -0x1c(%ebp)
+  800228:	ff 75 e0             	push   -0x20(%ebp)
+  80022b:	ff 75 dc             	push   -0x24(%ebp)
+  80022e:	ff 75 d8             	push   -0x28(%ebp)
+  800231:	e8 fb 27 00 00       	call   802a31 <__umoddi3>
+  800236:	83 c4 14             	add    $0x14,%esp
+  800239:	0f be 80 92 2b 80 00 	movsbl 0x802b92(%eax),%eax
+  800240:	50                   	push   %eax
+  800241:	ff d7                	call   *%edi
+}
+  800243:	83 c4 10             	add    $0x10,%esp
+  800246:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800249:	5b                   	pop    %ebx
+  80024a:	5e                   	pop    %esi
+  80024b:	5f                   	pop    %edi
+  80024c:	5d                   	pop    %ebp
+  80024d:	c3                   	ret
+
+0080024e <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80024e:	55                   	push   %ebp
+  80024f:	89 e5                	mov    %esp,%ebp
+  800251:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800254:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800258:	8b 10                	mov    (%eax),%edx
+  80025a:	3b 50 04             	cmp    0x4(%eax),%edx
+  80025d:	73 0a                	jae    800269 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80025f:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800262:	89 08                	mov    %ecx,(%eax)
+  800264:	8b 45 08             	mov    0x8(%ebp),%eax
+  800267:	88 02                	mov    %al,(%edx)
+}
+  800269:	5d                   	pop    %ebp
+  80026a:	c3                   	ret
+
+0080026b <printfmt>:
+{
+  80026b:	55                   	push   %ebp
+  80026c:	89 e5                	mov    %esp,%ebp
+  80026e:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800271:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800274:	50                   	push   %eax
+  800275:	ff 75 10             	push   0x10(%ebp)
+  800278:	ff 75 0c             	push   0xc(%ebp)
+  80027b:	ff 75 08             	push   0x8(%ebp)
+  80027e:	e8 05 00 00 00       	call   800288 <vprintfmt>
+}
+  800283:	83 c4 10             	add    $0x10,%esp
+  800286:	c9                   	leave
+  800287:	c3                   	ret
+
+00800288 <vprintfmt>:
+{
+  800288:	55                   	push   %ebp
+  800289:	89 e5                	mov    %esp,%ebp
+  80028b:	57                   	push   %edi
+  80028c:	56                   	push   %esi
+  80028d:	53                   	push   %ebx
+  80028e:	83 ec 2c             	sub    $0x2c,%esp
+  800291:	8b 75 08             	mov    0x8(%ebp),%esi
+  800294:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800297:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80029a:	eb 0a                	jmp    8002a6 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80029c:	83 ec 08             	sub    $0x8,%esp
+  80029f:	53                   	push   %ebx
+  8002a0:	50                   	push   %eax
+  8002a1:	ff d6                	call   *%esi
+  8002a3:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002a6:	83 c7 01             	add    $0x1,%edi
+  8002a9:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002ad:	83 f8 25             	cmp    $0x25,%eax
+  8002b0:	74 0c                	je     8002be <vprintfmt+0x36>
+			if (ch == '\0')
+  8002b2:	85 c0                	test   %eax,%eax
+  8002b4:	75 e6                	jne    80029c <vprintfmt+0x14>
+}
+  8002b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002b9:	5b                   	pop    %ebx
+  8002ba:	5e                   	pop    %esi
+  8002bb:	5f                   	pop    %edi
+  8002bc:	5d                   	pop    %ebp
+  8002bd:	c3                   	ret
+		padc = ' ';
+  8002be:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002c2:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002c9:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002d0:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8002dc:	8d 47 01             	lea    0x1(%edi),%eax
+  8002df:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002e2:	0f b6 17             	movzbl (%edi),%edx
+  8002e5:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002e8:	3c 55                	cmp    $0x55,%al
+  8002ea:	0f 87 cf 03 00 00    	ja     8006bf <vprintfmt+0x437>
+  8002f0:	0f b6 c0             	movzbl %al,%eax
+  8002f3:	ff 24 85 80 2c 80 00 	jmp    *0x802c80(,%eax,4)
+  8002fa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8002fd:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800301:	eb d9                	jmp    8002dc <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800303:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800306:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80030a:	eb d0                	jmp    8002dc <vprintfmt+0x54>
+  80030c:	0f b6 d2             	movzbl %dl,%edx
+  80030f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800312:	b8 00 00 00 00       	mov    $0x0,%eax
+  800317:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80031a:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80031d:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800321:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800324:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800327:	83 f9 09             	cmp    $0x9,%ecx
+  80032a:	77 55                	ja     800381 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80032c:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80032f:	eb e9                	jmp    80031a <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800331:	8b 45 14             	mov    0x14(%ebp),%eax
+  800334:	8b 00                	mov    (%eax),%eax
+  800336:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800339:	8b 45 14             	mov    0x14(%ebp),%eax
+  80033c:	8d 40 04             	lea    0x4(%eax),%eax
+  80033f:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800342:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800345:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800349:	79 91                	jns    8002dc <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80034b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80034e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800351:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800358:	eb 82                	jmp    8002dc <vprintfmt+0x54>
+			if (width < 0)
+  80035a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80035d:	85 d2                	test   %edx,%edx
+  80035f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800364:	0f 49 c2             	cmovns %edx,%eax
+  800367:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80036a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80036d:	e9 6a ff ff ff       	jmp    8002dc <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800372:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800375:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80037c:	e9 5b ff ff ff       	jmp    8002dc <vprintfmt+0x54>
+  800381:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800384:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800387:	eb bc                	jmp    800345 <vprintfmt+0xbd>
+			lflag++;
+  800389:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80038c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80038f:	e9 48 ff ff ff       	jmp    8002dc <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800394:	8b 45 14             	mov    0x14(%ebp),%eax
+  800397:	8d 78 04             	lea    0x4(%eax),%edi
+  80039a:	83 ec 08             	sub    $0x8,%esp
+  80039d:	53                   	push   %ebx
+  80039e:	ff 30                	push   (%eax)
+  8003a0:	ff d6                	call   *%esi
+			break;
+  8003a2:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003a5:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003a8:	e9 b1 02 00 00       	jmp    80065e <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8003ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b0:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003b3:	8b 10                	mov    (%eax),%edx
+  8003b5:	89 d0                	mov    %edx,%eax
+  8003b7:	f7 d8                	neg    %eax
+  8003b9:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003bc:	83 f8 0d             	cmp    $0xd,%eax
+  8003bf:	7f 23                	jg     8003e4 <vprintfmt+0x15c>
+  8003c1:	8b 14 85 e0 2d 80 00 	mov    0x802de0(,%eax,4),%edx
+  8003c8:	85 d2                	test   %edx,%edx
+  8003ca:	74 18                	je     8003e4 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003cc:	52                   	push   %edx
+  8003cd:	68 b3 2b 80 00       	push   $0x802bb3
+  8003d2:	53                   	push   %ebx
+  8003d3:	56                   	push   %esi
+  8003d4:	e8 92 fe ff ff       	call   80026b <printfmt>
+  8003d9:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003dc:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003df:	e9 7a 02 00 00       	jmp    80065e <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8003e4:	50                   	push   %eax
+  8003e5:	68 aa 2b 80 00       	push   $0x802baa
+  8003ea:	53                   	push   %ebx
+  8003eb:	56                   	push   %esi
+  8003ec:	e8 7a fe ff ff       	call   80026b <printfmt>
+  8003f1:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003f4:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003f7:	e9 62 02 00 00       	jmp    80065e <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ff:	83 c0 04             	add    $0x4,%eax
+  800402:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800405:	8b 45 14             	mov    0x14(%ebp),%eax
+  800408:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80040a:	85 c9                	test   %ecx,%ecx
+  80040c:	b8 a3 2b 80 00       	mov    $0x802ba3,%eax
+  800411:	0f 45 c1             	cmovne %ecx,%eax
+  800414:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800417:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80041b:	7e 06                	jle    800423 <vprintfmt+0x19b>
+  80041d:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800421:	75 0b                	jne    80042e <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800423:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800426:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800429:	89 75 08             	mov    %esi,0x8(%ebp)
+  80042c:	eb 5c                	jmp    80048a <vprintfmt+0x202>
+  80042e:	83 ec 08             	sub    $0x8,%esp
+  800431:	ff 75 d0             	push   -0x30(%ebp)
+  800434:	ff 75 cc             	push   -0x34(%ebp)
+  800437:	e8 20 03 00 00       	call   80075c <strnlen>
+  80043c:	89 c2                	mov    %eax,%edx
+  80043e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800441:	29 d0                	sub    %edx,%eax
+  800443:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800446:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80044a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80044d:	89 75 08             	mov    %esi,0x8(%ebp)
+  800450:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800452:	eb 0e                	jmp    800462 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800454:	83 ec 08             	sub    $0x8,%esp
+  800457:	53                   	push   %ebx
+  800458:	57                   	push   %edi
+  800459:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80045c:	83 ee 01             	sub    $0x1,%esi
+  80045f:	83 c4 10             	add    $0x10,%esp
+  800462:	85 f6                	test   %esi,%esi
+  800464:	7f ee                	jg     800454 <vprintfmt+0x1cc>
+  800466:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800469:	8b 75 08             	mov    0x8(%ebp),%esi
+  80046c:	85 c0                	test   %eax,%eax
+  80046e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800473:	0f 49 d0             	cmovns %eax,%edx
+  800476:	29 d0                	sub    %edx,%eax
+  800478:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80047b:	eb a6                	jmp    800423 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80047d:	83 ec 08             	sub    $0x8,%esp
+  800480:	53                   	push   %ebx
+  800481:	52                   	push   %edx
+  800482:	ff 55 08             	call   *0x8(%ebp)
+  800485:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800488:	89 f1                	mov    %esi,%ecx
+  80048a:	8d 71 01             	lea    0x1(%ecx),%esi
+  80048d:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800491:	0f be d0             	movsbl %al,%edx
+  800494:	85 d2                	test   %edx,%edx
+  800496:	74 28                	je     8004c0 <vprintfmt+0x238>
+  800498:	85 ff                	test   %edi,%edi
+  80049a:	78 05                	js     8004a1 <vprintfmt+0x219>
+  80049c:	83 ef 01             	sub    $0x1,%edi
+  80049f:	78 30                	js     8004d1 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004a1:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004a5:	74 d6                	je     80047d <vprintfmt+0x1f5>
+  8004a7:	0f be c0             	movsbl %al,%eax
+  8004aa:	83 e8 20             	sub    $0x20,%eax
+  8004ad:	83 f8 5e             	cmp    $0x5e,%eax
+  8004b0:	76 cb                	jbe    80047d <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004b2:	83 ec 08             	sub    $0x8,%esp
+  8004b5:	53                   	push   %ebx
+  8004b6:	6a 3f                	push   $0x3f
+  8004b8:	ff 55 08             	call   *0x8(%ebp)
+  8004bb:	83 c4 10             	add    $0x10,%esp
+  8004be:	eb c8                	jmp    800488 <vprintfmt+0x200>
+  8004c0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004c3:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004c6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004c9:	01 d0                	add    %edx,%eax
+  8004cb:	29 c8                	sub    %ecx,%eax
+  8004cd:	89 c7                	mov    %eax,%edi
+  8004cf:	eb 13                	jmp    8004e4 <vprintfmt+0x25c>
+  8004d1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004d4:	eb ed                	jmp    8004c3 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004d6:	83 ec 08             	sub    $0x8,%esp
+  8004d9:	53                   	push   %ebx
+  8004da:	6a 20                	push   $0x20
+  8004dc:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004de:	83 ef 01             	sub    $0x1,%edi
+  8004e1:	83 c4 10             	add    $0x10,%esp
+  8004e4:	85 ff                	test   %edi,%edi
+  8004e6:	7f ee                	jg     8004d6 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004e8:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004eb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004ee:	e9 6b 01 00 00       	jmp    80065e <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8004f3:	83 f9 01             	cmp    $0x1,%ecx
+  8004f6:	7f 1f                	jg     800517 <vprintfmt+0x28f>
+	else if (lflag)
+  8004f8:	85 c9                	test   %ecx,%ecx
+  8004fa:	74 67                	je     800563 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8004fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ff:	8b 00                	mov    (%eax),%eax
+  800501:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800504:	89 c1                	mov    %eax,%ecx
+  800506:	c1 f9 1f             	sar    $0x1f,%ecx
+  800509:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80050c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050f:	8d 40 04             	lea    0x4(%eax),%eax
+  800512:	89 45 14             	mov    %eax,0x14(%ebp)
+  800515:	eb 17                	jmp    80052e <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800517:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051a:	8b 50 04             	mov    0x4(%eax),%edx
+  80051d:	8b 00                	mov    (%eax),%eax
+  80051f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800522:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800525:	8b 45 14             	mov    0x14(%ebp),%eax
+  800528:	8d 40 08             	lea    0x8(%eax),%eax
+  80052b:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80052e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800531:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800534:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800539:	85 c9                	test   %ecx,%ecx
+  80053b:	0f 89 03 01 00 00    	jns    800644 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800541:	83 ec 08             	sub    $0x8,%esp
+  800544:	53                   	push   %ebx
+  800545:	6a 2d                	push   $0x2d
+  800547:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800549:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80054c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80054f:	f7 da                	neg    %edx
+  800551:	83 d1 00             	adc    $0x0,%ecx
+  800554:	f7 d9                	neg    %ecx
+  800556:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800559:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80055e:	e9 e1 00 00 00       	jmp    800644 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800563:	8b 45 14             	mov    0x14(%ebp),%eax
+  800566:	8b 00                	mov    (%eax),%eax
+  800568:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80056b:	89 c1                	mov    %eax,%ecx
+  80056d:	c1 f9 1f             	sar    $0x1f,%ecx
+  800570:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800573:	8b 45 14             	mov    0x14(%ebp),%eax
+  800576:	8d 40 04             	lea    0x4(%eax),%eax
+  800579:	89 45 14             	mov    %eax,0x14(%ebp)
+  80057c:	eb b0                	jmp    80052e <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80057e:	83 f9 01             	cmp    $0x1,%ecx
+  800581:	7f 1e                	jg     8005a1 <vprintfmt+0x319>
+	else if (lflag)
+  800583:	85 c9                	test   %ecx,%ecx
+  800585:	74 32                	je     8005b9 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800587:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058a:	8b 10                	mov    (%eax),%edx
+  80058c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800591:	8d 40 04             	lea    0x4(%eax),%eax
+  800594:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800597:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80059c:	e9 a3 00 00 00       	jmp    800644 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a4:	8b 10                	mov    (%eax),%edx
+  8005a6:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005a9:	8d 40 08             	lea    0x8(%eax),%eax
+  8005ac:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005af:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005b4:	e9 8b 00 00 00       	jmp    800644 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bc:	8b 10                	mov    (%eax),%edx
+  8005be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005c3:	8d 40 04             	lea    0x4(%eax),%eax
+  8005c6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005c9:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005ce:	eb 74                	jmp    800644 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8005d0:	83 f9 01             	cmp    $0x1,%ecx
+  8005d3:	7f 1b                	jg     8005f0 <vprintfmt+0x368>
+	else if (lflag)
+  8005d5:	85 c9                	test   %ecx,%ecx
+  8005d7:	74 2c                	je     800605 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8005d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005dc:	8b 10                	mov    (%eax),%edx
+  8005de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005e3:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005e9:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8005ee:	eb 54                	jmp    800644 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f3:	8b 10                	mov    (%eax),%edx
+  8005f5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005f8:	8d 40 08             	lea    0x8(%eax),%eax
+  8005fb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005fe:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800603:	eb 3f                	jmp    800644 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800605:	8b 45 14             	mov    0x14(%ebp),%eax
+  800608:	8b 10                	mov    (%eax),%edx
+  80060a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80060f:	8d 40 04             	lea    0x4(%eax),%eax
+  800612:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800615:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80061a:	eb 28                	jmp    800644 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  80061c:	83 ec 08             	sub    $0x8,%esp
+  80061f:	53                   	push   %ebx
+  800620:	6a 30                	push   $0x30
+  800622:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800624:	83 c4 08             	add    $0x8,%esp
+  800627:	53                   	push   %ebx
+  800628:	6a 78                	push   $0x78
+  80062a:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80062c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062f:	8b 10                	mov    (%eax),%edx
+  800631:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800636:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800639:	8d 40 04             	lea    0x4(%eax),%eax
+  80063c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80063f:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800644:	83 ec 0c             	sub    $0xc,%esp
+  800647:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80064b:	50                   	push   %eax
+  80064c:	ff 75 e0             	push   -0x20(%ebp)
+  80064f:	57                   	push   %edi
+  800650:	51                   	push   %ecx
+  800651:	52                   	push   %edx
+  800652:	89 da                	mov    %ebx,%edx
+  800654:	89 f0                	mov    %esi,%eax
+  800656:	e8 4a fb ff ff       	call   8001a5 <printnum>
+			break;
+  80065b:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80065e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800661:	e9 40 fc ff ff       	jmp    8002a6 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800666:	83 f9 01             	cmp    $0x1,%ecx
+  800669:	7f 1b                	jg     800686 <vprintfmt+0x3fe>
+	else if (lflag)
+  80066b:	85 c9                	test   %ecx,%ecx
+  80066d:	74 2c                	je     80069b <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  80066f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800672:	8b 10                	mov    (%eax),%edx
+  800674:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800679:	8d 40 04             	lea    0x4(%eax),%eax
+  80067c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80067f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800684:	eb be                	jmp    800644 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800686:	8b 45 14             	mov    0x14(%ebp),%eax
+  800689:	8b 10                	mov    (%eax),%edx
+  80068b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80068e:	8d 40 08             	lea    0x8(%eax),%eax
+  800691:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800694:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800699:	eb a9                	jmp    800644 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80069b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069e:	8b 10                	mov    (%eax),%edx
+  8006a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a5:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006ab:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006b0:	eb 92                	jmp    800644 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8006b2:	83 ec 08             	sub    $0x8,%esp
+  8006b5:	53                   	push   %ebx
+  8006b6:	6a 25                	push   $0x25
+  8006b8:	ff d6                	call   *%esi
+			break;
+  8006ba:	83 c4 10             	add    $0x10,%esp
+  8006bd:	eb 9f                	jmp    80065e <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8006bf:	83 ec 08             	sub    $0x8,%esp
+  8006c2:	53                   	push   %ebx
+  8006c3:	6a 25                	push   $0x25
+  8006c5:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006c7:	83 c4 10             	add    $0x10,%esp
+  8006ca:	89 f8                	mov    %edi,%eax
+  8006cc:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006d0:	74 05                	je     8006d7 <vprintfmt+0x44f>
+  8006d2:	83 e8 01             	sub    $0x1,%eax
+  8006d5:	eb f5                	jmp    8006cc <vprintfmt+0x444>
+  8006d7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006da:	eb 82                	jmp    80065e <vprintfmt+0x3d6>
+
+008006dc <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006dc:	55                   	push   %ebp
+  8006dd:	89 e5                	mov    %esp,%ebp
+  8006df:	83 ec 18             	sub    $0x18,%esp
+  8006e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006e5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006e8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006eb:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006ef:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006f2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006f9:	85 c0                	test   %eax,%eax
+  8006fb:	74 26                	je     800723 <vsnprintf+0x47>
+  8006fd:	85 d2                	test   %edx,%edx
+  8006ff:	7e 22                	jle    800723 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800701:	ff 75 14             	push   0x14(%ebp)
+  800704:	ff 75 10             	push   0x10(%ebp)
+  800707:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80070a:	50                   	push   %eax
+  80070b:	68 4e 02 80 00       	push   $0x80024e
+  800710:	e8 73 fb ff ff       	call   800288 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800715:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800718:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80071b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80071e:	83 c4 10             	add    $0x10,%esp
+}
+  800721:	c9                   	leave
+  800722:	c3                   	ret
+		return -E_INVAL;
+  800723:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800728:	eb f7                	jmp    800721 <vsnprintf+0x45>
+
+0080072a <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80072a:	55                   	push   %ebp
+  80072b:	89 e5                	mov    %esp,%ebp
+  80072d:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800730:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800733:	50                   	push   %eax
+  800734:	ff 75 10             	push   0x10(%ebp)
+  800737:	ff 75 0c             	push   0xc(%ebp)
+  80073a:	ff 75 08             	push   0x8(%ebp)
+  80073d:	e8 9a ff ff ff       	call   8006dc <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800742:	c9                   	leave
+  800743:	c3                   	ret
+
+00800744 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800744:	55                   	push   %ebp
+  800745:	89 e5                	mov    %esp,%ebp
+  800747:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80074a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80074f:	eb 03                	jmp    800754 <strlen+0x10>
+		n++;
+  800751:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800754:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800758:	75 f7                	jne    800751 <strlen+0xd>
+	return n;
+}
+  80075a:	5d                   	pop    %ebp
+  80075b:	c3                   	ret
+
+0080075c <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80075c:	55                   	push   %ebp
+  80075d:	89 e5                	mov    %esp,%ebp
+  80075f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800762:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800765:	b8 00 00 00 00       	mov    $0x0,%eax
+  80076a:	eb 03                	jmp    80076f <strnlen+0x13>
+		n++;
+  80076c:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80076f:	39 d0                	cmp    %edx,%eax
+  800771:	74 08                	je     80077b <strnlen+0x1f>
+  800773:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800777:	75 f3                	jne    80076c <strnlen+0x10>
+  800779:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80077b:	89 d0                	mov    %edx,%eax
+  80077d:	5d                   	pop    %ebp
+  80077e:	c3                   	ret
+
+0080077f <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80077f:	55                   	push   %ebp
+  800780:	89 e5                	mov    %esp,%ebp
+  800782:	53                   	push   %ebx
+  800783:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800786:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800789:	b8 00 00 00 00       	mov    $0x0,%eax
+  80078e:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800792:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800795:	83 c0 01             	add    $0x1,%eax
+  800798:	84 d2                	test   %dl,%dl
+  80079a:	75 f2                	jne    80078e <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80079c:	89 c8                	mov    %ecx,%eax
+  80079e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007a1:	c9                   	leave
+  8007a2:	c3                   	ret
+
+008007a3 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007a3:	55                   	push   %ebp
+  8007a4:	89 e5                	mov    %esp,%ebp
+  8007a6:	53                   	push   %ebx
+  8007a7:	83 ec 10             	sub    $0x10,%esp
+  8007aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007ad:	53                   	push   %ebx
+  8007ae:	e8 91 ff ff ff       	call   800744 <strlen>
+  8007b3:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007b6:	ff 75 0c             	push   0xc(%ebp)
+  8007b9:	01 d8                	add    %ebx,%eax
+  8007bb:	50                   	push   %eax
+  8007bc:	e8 be ff ff ff       	call   80077f <strcpy>
+	return dst;
+}
+  8007c1:	89 d8                	mov    %ebx,%eax
+  8007c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007c6:	c9                   	leave
+  8007c7:	c3                   	ret
+
+008007c8 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007c8:	55                   	push   %ebp
+  8007c9:	89 e5                	mov    %esp,%ebp
+  8007cb:	56                   	push   %esi
+  8007cc:	53                   	push   %ebx
+  8007cd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007d0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007d3:	89 f3                	mov    %esi,%ebx
+  8007d5:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007d8:	89 f0                	mov    %esi,%eax
+  8007da:	eb 0f                	jmp    8007eb <strncpy+0x23>
+		*dst++ = *src;
+  8007dc:	83 c0 01             	add    $0x1,%eax
+  8007df:	0f b6 0a             	movzbl (%edx),%ecx
+  8007e2:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007e5:	80 f9 01             	cmp    $0x1,%cl
+  8007e8:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007eb:	39 d8                	cmp    %ebx,%eax
+  8007ed:	75 ed                	jne    8007dc <strncpy+0x14>
+	}
+	return ret;
+}
+  8007ef:	89 f0                	mov    %esi,%eax
+  8007f1:	5b                   	pop    %ebx
+  8007f2:	5e                   	pop    %esi
+  8007f3:	5d                   	pop    %ebp
+  8007f4:	c3                   	ret
+
+008007f5 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007f5:	55                   	push   %ebp
+  8007f6:	89 e5                	mov    %esp,%ebp
+  8007f8:	56                   	push   %esi
+  8007f9:	53                   	push   %ebx
+  8007fa:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800800:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800803:	89 f0                	mov    %esi,%eax
+  800805:	85 d2                	test   %edx,%edx
+  800807:	74 21                	je     80082a <strlcpy+0x35>
+  800809:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80080d:	89 f2                	mov    %esi,%edx
+  80080f:	eb 09                	jmp    80081a <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800811:	83 c1 01             	add    $0x1,%ecx
+  800814:	83 c2 01             	add    $0x1,%edx
+  800817:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80081a:	39 c2                	cmp    %eax,%edx
+  80081c:	74 09                	je     800827 <strlcpy+0x32>
+  80081e:	0f b6 19             	movzbl (%ecx),%ebx
+  800821:	84 db                	test   %bl,%bl
+  800823:	75 ec                	jne    800811 <strlcpy+0x1c>
+  800825:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800827:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80082a:	29 f0                	sub    %esi,%eax
+}
+  80082c:	5b                   	pop    %ebx
+  80082d:	5e                   	pop    %esi
+  80082e:	5d                   	pop    %ebp
+  80082f:	c3                   	ret
+
+00800830 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800830:	55                   	push   %ebp
+  800831:	89 e5                	mov    %esp,%ebp
+  800833:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800836:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800839:	eb 06                	jmp    800841 <strcmp+0x11>
+		p++, q++;
+  80083b:	83 c1 01             	add    $0x1,%ecx
+  80083e:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800841:	0f b6 01             	movzbl (%ecx),%eax
+  800844:	84 c0                	test   %al,%al
+  800846:	74 04                	je     80084c <strcmp+0x1c>
+  800848:	3a 02                	cmp    (%edx),%al
+  80084a:	74 ef                	je     80083b <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80084c:	0f b6 c0             	movzbl %al,%eax
+  80084f:	0f b6 12             	movzbl (%edx),%edx
+  800852:	29 d0                	sub    %edx,%eax
+}
+  800854:	5d                   	pop    %ebp
+  800855:	c3                   	ret
+
+00800856 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800856:	55                   	push   %ebp
+  800857:	89 e5                	mov    %esp,%ebp
+  800859:	53                   	push   %ebx
+  80085a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80085d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800860:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800863:	eb 09                	jmp    80086e <strncmp+0x18>
+		n--, p++, q++;
+  800865:	83 ea 01             	sub    $0x1,%edx
+  800868:	83 c0 01             	add    $0x1,%eax
+  80086b:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80086e:	85 d2                	test   %edx,%edx
+  800870:	74 18                	je     80088a <strncmp+0x34>
+  800872:	0f b6 18             	movzbl (%eax),%ebx
+  800875:	84 db                	test   %bl,%bl
+  800877:	74 04                	je     80087d <strncmp+0x27>
+  800879:	3a 19                	cmp    (%ecx),%bl
+  80087b:	74 e8                	je     800865 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80087d:	0f b6 00             	movzbl (%eax),%eax
+  800880:	0f b6 11             	movzbl (%ecx),%edx
+  800883:	29 d0                	sub    %edx,%eax
+}
+  800885:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800888:	c9                   	leave
+  800889:	c3                   	ret
+		return 0;
+  80088a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80088f:	eb f4                	jmp    800885 <strncmp+0x2f>
+
+00800891 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800891:	55                   	push   %ebp
+  800892:	89 e5                	mov    %esp,%ebp
+  800894:	8b 45 08             	mov    0x8(%ebp),%eax
+  800897:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80089b:	eb 03                	jmp    8008a0 <strchr+0xf>
+  80089d:	83 c0 01             	add    $0x1,%eax
+  8008a0:	0f b6 10             	movzbl (%eax),%edx
+  8008a3:	84 d2                	test   %dl,%dl
+  8008a5:	74 06                	je     8008ad <strchr+0x1c>
+		if (*s == c)
+  8008a7:	38 ca                	cmp    %cl,%dl
+  8008a9:	75 f2                	jne    80089d <strchr+0xc>
+  8008ab:	eb 05                	jmp    8008b2 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008b2:	5d                   	pop    %ebp
+  8008b3:	c3                   	ret
+
+008008b4 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008b4:	55                   	push   %ebp
+  8008b5:	89 e5                	mov    %esp,%ebp
+  8008b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008ba:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008be:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008c1:	38 ca                	cmp    %cl,%dl
+  8008c3:	74 09                	je     8008ce <strfind+0x1a>
+  8008c5:	84 d2                	test   %dl,%dl
+  8008c7:	74 05                	je     8008ce <strfind+0x1a>
+	for (; *s; s++)
+  8008c9:	83 c0 01             	add    $0x1,%eax
+  8008cc:	eb f0                	jmp    8008be <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008ce:	5d                   	pop    %ebp
+  8008cf:	c3                   	ret
+
+008008d0 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008d0:	55                   	push   %ebp
+  8008d1:	89 e5                	mov    %esp,%ebp
+  8008d3:	57                   	push   %edi
+  8008d4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008da:	85 c9                	test   %ecx,%ecx
+  8008dc:	74 20                	je     8008fe <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008de:	89 f8                	mov    %edi,%eax
+  8008e0:	09 c8                	or     %ecx,%eax
+  8008e2:	a8 03                	test   $0x3,%al
+  8008e4:	75 12                	jne    8008f8 <memset+0x28>
+		c &= 0xFF;
+  8008e6:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008ea:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008f0:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008f3:	fc                   	cld
+  8008f4:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008f6:	eb 06                	jmp    8008fe <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008fb:	fc                   	cld
+  8008fc:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008fe:	89 f8                	mov    %edi,%eax
+  800900:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800903:	c9                   	leave
+  800904:	c3                   	ret
+
+00800905 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800905:	55                   	push   %ebp
+  800906:	89 e5                	mov    %esp,%ebp
+  800908:	57                   	push   %edi
+  800909:	56                   	push   %esi
+  80090a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80090d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800910:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800913:	39 c6                	cmp    %eax,%esi
+  800915:	73 32                	jae    800949 <memmove+0x44>
+  800917:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80091a:	39 d0                	cmp    %edx,%eax
+  80091c:	73 2b                	jae    800949 <memmove+0x44>
+		s += n;
+		d += n;
+  80091e:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800921:	89 d6                	mov    %edx,%esi
+  800923:	09 fe                	or     %edi,%esi
+  800925:	09 ce                	or     %ecx,%esi
+  800927:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80092d:	75 0e                	jne    80093d <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80092f:	83 ef 04             	sub    $0x4,%edi
+  800932:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800935:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800938:	fd                   	std
+  800939:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80093b:	eb 09                	jmp    800946 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80093d:	83 ef 01             	sub    $0x1,%edi
+  800940:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800943:	fd                   	std
+  800944:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800946:	fc                   	cld
+  800947:	eb 1a                	jmp    800963 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800949:	89 f2                	mov    %esi,%edx
+  80094b:	09 c2                	or     %eax,%edx
+  80094d:	09 ca                	or     %ecx,%edx
+  80094f:	f6 c2 03             	test   $0x3,%dl
+  800952:	75 0a                	jne    80095e <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800954:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800957:	89 c7                	mov    %eax,%edi
+  800959:	fc                   	cld
+  80095a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80095c:	eb 05                	jmp    800963 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80095e:	89 c7                	mov    %eax,%edi
+  800960:	fc                   	cld
+  800961:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800963:	5e                   	pop    %esi
+  800964:	5f                   	pop    %edi
+  800965:	5d                   	pop    %ebp
+  800966:	c3                   	ret
+
+00800967 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800967:	55                   	push   %ebp
+  800968:	89 e5                	mov    %esp,%ebp
+  80096a:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80096d:	ff 75 10             	push   0x10(%ebp)
+  800970:	ff 75 0c             	push   0xc(%ebp)
+  800973:	ff 75 08             	push   0x8(%ebp)
+  800976:	e8 8a ff ff ff       	call   800905 <memmove>
+}
+  80097b:	c9                   	leave
+  80097c:	c3                   	ret
+
+0080097d <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80097d:	55                   	push   %ebp
+  80097e:	89 e5                	mov    %esp,%ebp
+  800980:	56                   	push   %esi
+  800981:	53                   	push   %ebx
+  800982:	8b 45 08             	mov    0x8(%ebp),%eax
+  800985:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800988:	89 c6                	mov    %eax,%esi
+  80098a:	03 75 10             	add    0x10(%ebp),%esi
+  80098d:	eb 06                	jmp    800995 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  80098f:	83 c0 01             	add    $0x1,%eax
+  800992:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800995:	39 f0                	cmp    %esi,%eax
+  800997:	74 14                	je     8009ad <memcmp+0x30>
+		if (*s1 != *s2)
+  800999:	0f b6 08             	movzbl (%eax),%ecx
+  80099c:	0f b6 1a             	movzbl (%edx),%ebx
+  80099f:	38 d9                	cmp    %bl,%cl
+  8009a1:	74 ec                	je     80098f <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009a3:	0f b6 c1             	movzbl %cl,%eax
+  8009a6:	0f b6 db             	movzbl %bl,%ebx
+  8009a9:	29 d8                	sub    %ebx,%eax
+  8009ab:	eb 05                	jmp    8009b2 <memcmp+0x35>
+	}
+
+	return 0;
+  8009ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009b2:	5b                   	pop    %ebx
+  8009b3:	5e                   	pop    %esi
+  8009b4:	5d                   	pop    %ebp
+  8009b5:	c3                   	ret
+
+008009b6 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009b6:	55                   	push   %ebp
+  8009b7:	89 e5                	mov    %esp,%ebp
+  8009b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009bf:	89 c2                	mov    %eax,%edx
+  8009c1:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009c4:	eb 03                	jmp    8009c9 <memfind+0x13>
+  8009c6:	83 c0 01             	add    $0x1,%eax
+  8009c9:	39 d0                	cmp    %edx,%eax
+  8009cb:	73 04                	jae    8009d1 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009cd:	38 08                	cmp    %cl,(%eax)
+  8009cf:	75 f5                	jne    8009c6 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009d1:	5d                   	pop    %ebp
+  8009d2:	c3                   	ret
+
+008009d3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009d3:	55                   	push   %ebp
+  8009d4:	89 e5                	mov    %esp,%ebp
+  8009d6:	57                   	push   %edi
+  8009d7:	56                   	push   %esi
+  8009d8:	53                   	push   %ebx
+  8009d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009dc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009df:	eb 03                	jmp    8009e4 <strtol+0x11>
+		s++;
+  8009e1:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8009e4:	0f b6 02             	movzbl (%edx),%eax
+  8009e7:	3c 20                	cmp    $0x20,%al
+  8009e9:	74 f6                	je     8009e1 <strtol+0xe>
+  8009eb:	3c 09                	cmp    $0x9,%al
+  8009ed:	74 f2                	je     8009e1 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009ef:	3c 2b                	cmp    $0x2b,%al
+  8009f1:	74 2a                	je     800a1d <strtol+0x4a>
+	int neg = 0;
+  8009f3:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009f8:	3c 2d                	cmp    $0x2d,%al
+  8009fa:	74 2b                	je     800a27 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009fc:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a02:	75 0f                	jne    800a13 <strtol+0x40>
+  800a04:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a07:	74 28                	je     800a31 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a09:	85 db                	test   %ebx,%ebx
+  800a0b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a10:	0f 44 d8             	cmove  %eax,%ebx
+  800a13:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a18:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a1b:	eb 46                	jmp    800a63 <strtol+0x90>
+		s++;
+  800a1d:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a20:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a25:	eb d5                	jmp    8009fc <strtol+0x29>
+		s++, neg = 1;
+  800a27:	83 c2 01             	add    $0x1,%edx
+  800a2a:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a2f:	eb cb                	jmp    8009fc <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a31:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a35:	74 0e                	je     800a45 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a37:	85 db                	test   %ebx,%ebx
+  800a39:	75 d8                	jne    800a13 <strtol+0x40>
+		s++, base = 8;
+  800a3b:	83 c2 01             	add    $0x1,%edx
+  800a3e:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a43:	eb ce                	jmp    800a13 <strtol+0x40>
+		s += 2, base = 16;
+  800a45:	83 c2 02             	add    $0x2,%edx
+  800a48:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a4d:	eb c4                	jmp    800a13 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a4f:	0f be c0             	movsbl %al,%eax
+  800a52:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a55:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a58:	7d 3a                	jge    800a94 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a5a:	83 c2 01             	add    $0x1,%edx
+  800a5d:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a61:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a63:	0f b6 02             	movzbl (%edx),%eax
+  800a66:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a69:	89 f3                	mov    %esi,%ebx
+  800a6b:	80 fb 09             	cmp    $0x9,%bl
+  800a6e:	76 df                	jbe    800a4f <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a70:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a73:	89 f3                	mov    %esi,%ebx
+  800a75:	80 fb 19             	cmp    $0x19,%bl
+  800a78:	77 08                	ja     800a82 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a7a:	0f be c0             	movsbl %al,%eax
+  800a7d:	83 e8 57             	sub    $0x57,%eax
+  800a80:	eb d3                	jmp    800a55 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a82:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a85:	89 f3                	mov    %esi,%ebx
+  800a87:	80 fb 19             	cmp    $0x19,%bl
+  800a8a:	77 08                	ja     800a94 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a8c:	0f be c0             	movsbl %al,%eax
+  800a8f:	83 e8 37             	sub    $0x37,%eax
+  800a92:	eb c1                	jmp    800a55 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a94:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a98:	74 05                	je     800a9f <strtol+0xcc>
+		*endptr = (char *) s;
+  800a9a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a9d:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a9f:	89 c8                	mov    %ecx,%eax
+  800aa1:	f7 d8                	neg    %eax
+  800aa3:	85 ff                	test   %edi,%edi
+  800aa5:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800aa8:	89 c8                	mov    %ecx,%eax
+  800aaa:	5b                   	pop    %ebx
+  800aab:	5e                   	pop    %esi
+  800aac:	5f                   	pop    %edi
+  800aad:	5d                   	pop    %ebp
+  800aae:	c3                   	ret
+
+00800aaf <atoi>:
+
+int
+atoi(const char *s)
+{
+  800aaf:	55                   	push   %ebp
+  800ab0:	89 e5                	mov    %esp,%ebp
+  800ab2:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800ab5:	6a 0a                	push   $0xa
+  800ab7:	6a 00                	push   $0x0
+  800ab9:	ff 75 08             	push   0x8(%ebp)
+  800abc:	e8 12 ff ff ff       	call   8009d3 <strtol>
+}
+  800ac1:	c9                   	leave
+  800ac2:	c3                   	ret
+
+00800ac3 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800ac3:	55                   	push   %ebp
+  800ac4:	89 e5                	mov    %esp,%ebp
+  800ac6:	57                   	push   %edi
+  800ac7:	56                   	push   %esi
+  800ac8:	53                   	push   %ebx
+  800ac9:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800acf:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800ad5:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800adb:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800ae1:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800ae8:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800aeb:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800af2:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800af5:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800afc:	74 76                	je     800b74 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800afe:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800b04:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b07:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800b0d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b14:	0f 88 06 01 00 00    	js     800c20 <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800b1a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b21:	0f 84 48 01 00 00    	je     800c6f <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800b27:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800b2d:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800b33:	be 00 00 00 00       	mov    $0x0,%esi
+  800b38:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800b3e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b41:	55                   	push   %ebp
+  800b42:	68 4b 0b 80 00       	push   $0x800b4b
+  800b47:	89 e5                	mov    %esp,%ebp
+  800b49:	0f 34                	sysenter
+  800b4b:	83 c4 04             	add    $0x4,%esp
+  800b4e:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800b4f:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800b55:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800b5b:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800b5e:	0f 85 9a 01 00 00    	jne    800cfe <page_vec_call+0x23b>
+  800b64:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b69:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b6c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b6f:	e9 29 01 00 00       	jmp    800c9d <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800b74:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800b7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b7d:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800b7f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b86:	78 2f                	js     800bb7 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800b88:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b8f:	74 72                	je     800c03 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800b91:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800b97:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800b9d:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ba2:	89 fb                	mov    %edi,%ebx
+  800ba4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800ba7:	55                   	push   %ebp
+  800ba8:	68 b1 0b 80 00       	push   $0x800bb1
+  800bad:	89 e5                	mov    %esp,%ebp
+  800baf:	0f 34                	sysenter
+  800bb1:	83 c4 04             	add    $0x4,%esp
+  800bb4:	5d                   	pop    %ebp
+	return ret;
+  800bb5:	eb 98                	jmp    800b4f <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800bb7:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bbc:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800bbe:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800bc3:	f6 c6 08             	test   $0x8,%dh
+  800bc6:	74 15                	je     800bdd <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800bc8:	89 c2                	mov    %eax,%edx
+  800bca:	c1 ea 08             	shr    $0x8,%edx
+  800bcd:	83 e2 0f             	and    $0xf,%edx
+  800bd0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800bd5:	83 fa 06             	cmp    $0x6,%edx
+  800bd8:	74 0e                	je     800be8 <page_vec_call+0x125>
+  800bda:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800bdd:	0f b6 c9             	movzbl %cl,%ecx
+  800be0:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800be6:	eb a0                	jmp    800b88 <page_vec_call+0xc5>
+  800be8:	89 c2                	mov    %eax,%edx
+  800bea:	c1 ea 04             	shr    $0x4,%edx
+  800bed:	83 e2 0f             	and    $0xf,%edx
+  800bf0:	83 fa 02             	cmp    $0x2,%edx
+  800bf3:	77 e5                	ja     800bda <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800bf5:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800bf8:	83 f8 02             	cmp    $0x2,%eax
+  800bfb:	0f 97 c1             	seta   %cl
+  800bfe:	0f b6 c9             	movzbl %cl,%ecx
+  800c01:	eb d7                	jmp    800bda <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800c03:	b8 10 00 00 00       	mov    $0x10,%eax
+  800c08:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800c0e:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800c14:	89 fb                	mov    %edi,%ebx
+  800c16:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c19:	cd 30                	int    $0x30
+  800c1b:	e9 2f ff ff ff       	jmp    800b4f <page_vec_call+0x8c>
+  800c20:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c25:	0f a2                	cpuid
+		return 0;
+  800c27:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800c2c:	f6 c6 08             	test   $0x8,%dh
+  800c2f:	74 15                	je     800c46 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c31:	89 c2                	mov    %eax,%edx
+  800c33:	c1 ea 08             	shr    $0x8,%edx
+  800c36:	83 e2 0f             	and    $0xf,%edx
+  800c39:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800c3e:	83 fa 06             	cmp    $0x6,%edx
+  800c41:	74 11                	je     800c54 <page_vec_call+0x191>
+  800c43:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800c46:	0f b6 c9             	movzbl %cl,%ecx
+  800c49:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800c4f:	e9 c6 fe ff ff       	jmp    800b1a <page_vec_call+0x57>
+  800c54:	89 c2                	mov    %eax,%edx
+  800c56:	c1 ea 04             	shr    $0x4,%edx
+  800c59:	83 e2 0f             	and    $0xf,%edx
+  800c5c:	83 fa 02             	cmp    $0x2,%edx
+  800c5f:	77 e2                	ja     800c43 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800c61:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c64:	83 f8 02             	cmp    $0x2,%eax
+  800c67:	0f 97 c1             	seta   %cl
+  800c6a:	0f b6 c9             	movzbl %cl,%ecx
+  800c6d:	eb d4                	jmp    800c43 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800c6f:	be 00 00 00 00       	mov    $0x0,%esi
+  800c74:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800c7a:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800c80:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800c86:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c89:	cd 30                	int    $0x30
+  800c8b:	e9 bf fe ff ff       	jmp    800b4f <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800c90:	29 da                	sub    %ebx,%edx
+			vec++;
+  800c92:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800c95:	83 e8 01             	sub    $0x1,%eax
+  800c98:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800c9d:	85 c0                	test   %eax,%eax
+  800c9f:	74 58                	je     800cf9 <page_vec_call+0x236>
+  800ca1:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800ca4:	39 da                	cmp    %ebx,%edx
+  800ca6:	73 e8                	jae    800c90 <page_vec_call+0x1cd>
+  800ca8:	89 75 08             	mov    %esi,0x8(%ebp)
+  800cab:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800cae:	84 c9                	test   %cl,%cl
+  800cb0:	74 06                	je     800cb8 <page_vec_call+0x1f5>
+  800cb2:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800cb8:	83 ec 04             	sub    $0x4,%esp
+  800cbb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cbe:	c1 e0 04             	shl    $0x4,%eax
+  800cc1:	50                   	push   %eax
+  800cc2:	ff 75 08             	push   0x8(%ebp)
+  800cc5:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800ccb:	53                   	push   %ebx
+  800ccc:	e8 34 fc ff ff       	call   800905 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800cd1:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800cd7:	89 c2                	mov    %eax,%edx
+  800cd9:	c1 e2 0c             	shl    $0xc,%edx
+  800cdc:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  800ce2:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  800ce8:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  800cee:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  800cf1:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  800cf4:	e9 f2 fd ff ff       	jmp    800aeb <page_vec_call+0x28>
+			r = 0;
+  800cf9:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  800cfe:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800d02:	74 0b                	je     800d0f <page_vec_call+0x24c>
+		*done = total;
+  800d04:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800d07:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  800d0d:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  800d0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d12:	5b                   	pop    %ebx
+  800d13:	5e                   	pop    %esi
+  800d14:	5f                   	pop    %edi
+  800d15:	5d                   	pop    %ebp
+  800d16:	c3                   	ret
+
+00800d17 <sys_cputs>:
+{
+  800d17:	55                   	push   %ebp
+  800d18:	89 e5                	mov    %esp,%ebp
+  800d1a:	57                   	push   %edi
+  800d1b:	56                   	push   %esi
+  800d1c:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800d1d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d24:	78 2d                	js     800d53 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800d26:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d2d:	74 70                	je     800d9f <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800d2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d34:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d3a:	89 c3                	mov    %eax,%ebx
+  800d3c:	89 c7                	mov    %eax,%edi
+  800d3e:	89 c6                	mov    %eax,%esi
+  800d40:	55                   	push   %ebp
+  800d41:	68 4a 0d 80 00       	push   $0x800d4a
+  800d46:	89 e5                	mov    %esp,%ebp
+  800d48:	0f 34                	sysenter
+  800d4a:	83 c4 04             	add    $0x4,%esp
+  800d4d:	5d                   	pop    %ebp
+}
+  800d4e:	5b                   	pop    %ebx
+  800d4f:	5e                   	pop    %esi
+  800d50:	5f                   	pop    %edi
+  800d51:	5d                   	pop    %ebp
+  800d52:	c3                   	ret
+  800d53:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d58:	0f a2                	cpuid
+		return 0;
+  800d5a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800d5f:	f6 c6 08             	test   $0x8,%dh
+  800d62:	74 15                	je     800d79 <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d64:	89 c2                	mov    %eax,%edx
+  800d66:	c1 ea 08             	shr    $0x8,%edx
+  800d69:	83 e2 0f             	and    $0xf,%edx
+  800d6c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d71:	83 fa 06             	cmp    $0x6,%edx
+  800d74:	74 0e                	je     800d84 <sys_cputs+0x6d>
+  800d76:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800d79:	0f b6 c9             	movzbl %cl,%ecx
+  800d7c:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800d82:	eb a2                	jmp    800d26 <sys_cputs+0xf>
+  800d84:	89 c2                	mov    %eax,%edx
+  800d86:	c1 ea 04             	shr    $0x4,%edx
+  800d89:	83 e2 0f             	and    $0xf,%edx
+  800d8c:	83 fa 02             	cmp    $0x2,%edx
+  800d8f:	77 e5                	ja     800d76 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800d91:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d94:	83 f8 02             	cmp    $0x2,%eax
+  800d97:	0f 97 c1             	seta   %cl
+  800d9a:	0f b6 c9             	movzbl %cl,%ecx
+  800d9d:	eb d7                	jmp    800d76 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800d9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800da4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800daa:	89 c3                	mov    %eax,%ebx
+  800dac:	89 c7                	mov    %eax,%edi
+  800dae:	89 c6                	mov    %eax,%esi
+  800db0:	cd 30                	int    $0x30
+}
+  800db2:	eb 9a                	jmp    800d4e <sys_cputs+0x37>
+
+00800db4 <sys_cgetc>:
+{
+  800db4:	55                   	push   %ebp
+  800db5:	89 e5                	mov    %esp,%ebp
+  800db7:	57                   	push   %edi
+  800db8:	56                   	push   %esi
+  800db9:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800dba:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800dc1:	78 2e                	js     800df1 <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  800dc3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800dca:	74 71                	je     800e3d <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  800dcc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dd1:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dd6:	89 d1                	mov    %edx,%ecx
+  800dd8:	89 d3                	mov    %edx,%ebx
+  800dda:	89 d7                	mov    %edx,%edi
+  800ddc:	89 d6                	mov    %edx,%esi
+  800dde:	55                   	push   %ebp
+  800ddf:	68 e8 0d 80 00       	push   $0x800de8
+  800de4:	89 e5                	mov    %esp,%ebp
+  800de6:	0f 34                	sysenter
+  800de8:	83 c4 04             	add    $0x4,%esp
+  800deb:	5d                   	pop    %ebp
+}
+  800dec:	5b                   	pop    %ebx
+  800ded:	5e                   	pop    %esi
+  800dee:	5f                   	pop    %edi
+  800def:	5d                   	pop    %ebp
+  800df0:	c3                   	ret
+  800df1:	b8 01 00 00 00       	mov    $0x1,%eax
+  800df6:	0f a2                	cpuid
+		return 0;
+  800df8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800dfd:	f6 c6 08             	test   $0x8,%dh
+  800e00:	74 15                	je     800e17 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e02:	89 c2                	mov    %eax,%edx
+  800e04:	c1 ea 08             	shr    $0x8,%edx
+  800e07:	83 e2 0f             	and    $0xf,%edx
+  800e0a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e0f:	83 fa 06             	cmp    $0x6,%edx
+  800e12:	74 0e                	je     800e22 <sys_cgetc+0x6e>
+  800e14:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e17:	0f b6 c9             	movzbl %cl,%ecx
+  800e1a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800e20:	eb a1                	jmp    800dc3 <sys_cgetc+0xf>
+  800e22:	89 c2                	mov    %eax,%edx
+  800e24:	c1 ea 04             	shr    $0x4,%edx
+  800e27:	83 e2 0f             	and    $0xf,%edx
+  800e2a:	83 fa 02             	cmp    $0x2,%edx
+  800e2d:	77 e5                	ja     800e14 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  800e2f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e32:	83 f8 02             	cmp    $0x2,%eax
+  800e35:	0f 97 c1             	seta   %cl
+  800e38:	0f b6 c9             	movzbl %cl,%ecx
+  800e3b:	eb d7                	jmp    800e14 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  800e3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e42:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e47:	89 d1                	mov    %edx,%ecx
+  800e49:	89 d3                	mov    %edx,%ebx
+  800e4b:	89 d7                	mov    %edx,%edi
+  800e4d:	89 d6                	mov    %edx,%esi
+  800e4f:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800e51:	eb 99                	jmp    800dec <sys_cgetc+0x38>
+
+00800e53 <sys_env_destroy>:
+{
+  800e53:	55                   	push   %ebp
+  800e54:	89 e5                	mov    %esp,%ebp
+  800e56:	57                   	push   %edi
+  800e57:	56                   	push   %esi
+  800e58:	53                   	push   %ebx
+  800e59:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800e5c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e63:	78 36                	js     800e9b <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  800e65:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e6c:	74 79                	je     800ee7 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  800e6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e71:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e76:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e7b:	89 cb                	mov    %ecx,%ebx
+  800e7d:	89 cf                	mov    %ecx,%edi
+  800e7f:	89 ce                	mov    %ecx,%esi
+  800e81:	55                   	push   %ebp
+  800e82:	68 8b 0e 80 00       	push   $0x800e8b
+  800e87:	89 e5                	mov    %esp,%ebp
+  800e89:	0f 34                	sysenter
+  800e8b:	83 c4 04             	add    $0x4,%esp
+  800e8e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e8f:	85 c0                	test   %eax,%eax
+  800e91:	7f 6b                	jg     800efe <sys_env_destroy+0xab>
+}
+  800e93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e96:	5b                   	pop    %ebx
+  800e97:	5e                   	pop    %esi
+  800e98:	5f                   	pop    %edi
+  800e99:	5d                   	pop    %ebp
+  800e9a:	c3                   	ret
+  800e9b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ea0:	0f a2                	cpuid
+		return 0;
+  800ea2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800ea7:	f6 c6 08             	test   $0x8,%dh
+  800eaa:	74 15                	je     800ec1 <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800eac:	89 c2                	mov    %eax,%edx
+  800eae:	c1 ea 08             	shr    $0x8,%edx
+  800eb1:	83 e2 0f             	and    $0xf,%edx
+  800eb4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800eb9:	83 fa 06             	cmp    $0x6,%edx
+  800ebc:	74 0e                	je     800ecc <sys_env_destroy+0x79>
+  800ebe:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800ec1:	0f b6 c9             	movzbl %cl,%ecx
+  800ec4:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800eca:	eb 99                	jmp    800e65 <sys_env_destroy+0x12>
+  800ecc:	89 c2                	mov    %eax,%edx
+  800ece:	c1 ea 04             	shr    $0x4,%edx
+  800ed1:	83 e2 0f             	and    $0xf,%edx
+  800ed4:	83 fa 02             	cmp    $0x2,%edx
+  800ed7:	77 e5                	ja     800ebe <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  800ed9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800edc:	83 f8 02             	cmp    $0x2,%eax
+  800edf:	0f 97 c1             	seta   %cl
+  800ee2:	0f b6 c9             	movzbl %cl,%ecx
+  800ee5:	eb d7                	jmp    800ebe <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  800ee7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800eec:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ef1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef4:	89 cb                	mov    %ecx,%ebx
+  800ef6:	89 cf                	mov    %ecx,%edi
+  800ef8:	89 ce                	mov    %ecx,%esi
+  800efa:	cd 30                	int    $0x30
+  800efc:	eb 91                	jmp    800e8f <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800efe:	83 ec 0c             	sub    $0xc,%esp
+  800f01:	50                   	push   %eax
+  800f02:	6a 03                	push   $0x3
+  800f04:	68 59 2e 80 00       	push   $0x802e59
+  800f09:	6a 4a                	push   $0x4a
+  800f0b:	68 76 2e 80 00       	push   $0x802e76
+  800f10:	e8 b0 19 00 00       	call   8028c5 <_panic>
+
+00800f15 <sys_getenvid>:
+{
+  800f15:	55                   	push   %ebp
+  800f16:	89 e5                	mov    %esp,%ebp
+  800f18:	57                   	push   %edi
+  800f19:	56                   	push   %esi
+  800f1a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800f1b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f22:	78 2e                	js     800f52 <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  800f24:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f2b:	74 71                	je     800f9e <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  800f2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f32:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f37:	89 d1                	mov    %edx,%ecx
+  800f39:	89 d3                	mov    %edx,%ebx
+  800f3b:	89 d7                	mov    %edx,%edi
+  800f3d:	89 d6                	mov    %edx,%esi
+  800f3f:	55                   	push   %ebp
+  800f40:	68 49 0f 80 00       	push   $0x800f49
+  800f45:	89 e5                	mov    %esp,%ebp
+  800f47:	0f 34                	sysenter
+  800f49:	83 c4 04             	add    $0x4,%esp
+  800f4c:	5d                   	pop    %ebp
+}
+  800f4d:	5b                   	pop    %ebx
+  800f4e:	5e                   	pop    %esi
+  800f4f:	5f                   	pop    %edi
+  800f50:	5d                   	pop    %ebp
+  800f51:	c3                   	ret
+  800f52:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f57:	0f a2                	cpuid
+		return 0;
+  800f59:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f5e:	f6 c6 08             	test   $0x8,%dh
+  800f61:	74 15                	je     800f78 <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f63:	89 c2                	mov    %eax,%edx
+  800f65:	c1 ea 08             	shr    $0x8,%edx
+  800f68:	83 e2 0f             	and    $0xf,%edx
+  800f6b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f70:	83 fa 06             	cmp    $0x6,%edx
+  800f73:	74 0e                	je     800f83 <sys_getenvid+0x6e>
+  800f75:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f78:	0f b6 c9             	movzbl %cl,%ecx
+  800f7b:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800f81:	eb a1                	jmp    800f24 <sys_getenvid+0xf>
+  800f83:	89 c2                	mov    %eax,%edx
+  800f85:	c1 ea 04             	shr    $0x4,%edx
+  800f88:	83 e2 0f             	and    $0xf,%edx
+  800f8b:	83 fa 02             	cmp    $0x2,%edx
+  800f8e:	77 e5                	ja     800f75 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  800f90:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f93:	83 f8 02             	cmp    $0x2,%eax
+  800f96:	0f 97 c1             	seta   %cl
+  800f99:	0f b6 c9             	movzbl %cl,%ecx
+  800f9c:	eb d7                	jmp    800f75 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  800f9e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fa3:	b8 02 00 00 00       	mov    $0x2,%eax
+  800fa8:	89 d1                	mov    %edx,%ecx
+  800faa:	89 d3                	mov    %edx,%ebx
+  800fac:	89 d7                	mov    %edx,%edi
+  800fae:	89 d6                	mov    %edx,%esi
+  800fb0:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  800fb2:	eb 99                	jmp    800f4d <sys_getenvid+0x38>
+
+00800fb4 <sys_page_alloc>:
+{
+  800fb4:	55                   	push   %ebp
+  800fb5:	89 e5                	mov    %esp,%ebp
+  800fb7:	57                   	push   %edi
+  800fb8:	56                   	push   %esi
+  800fb9:	53                   	push   %ebx
+  800fba:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800fbd:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fc4:	78 38                	js     800ffe <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  800fc6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fcd:	74 7b                	je     80104a <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  800fcf:	be 00 00 00 00       	mov    $0x0,%esi
+  800fd4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fda:	b8 04 00 00 00       	mov    $0x4,%eax
+  800fdf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fe2:	89 f7                	mov    %esi,%edi
+  800fe4:	55                   	push   %ebp
+  800fe5:	68 ee 0f 80 00       	push   $0x800fee
+  800fea:	89 e5                	mov    %esp,%ebp
+  800fec:	0f 34                	sysenter
+  800fee:	83 c4 04             	add    $0x4,%esp
+  800ff1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ff2:	85 c0                	test   %eax,%eax
+  800ff4:	7f 6d                	jg     801063 <sys_page_alloc+0xaf>
+}
+  800ff6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff9:	5b                   	pop    %ebx
+  800ffa:	5e                   	pop    %esi
+  800ffb:	5f                   	pop    %edi
+  800ffc:	5d                   	pop    %ebp
+  800ffd:	c3                   	ret
+  800ffe:	b8 01 00 00 00       	mov    $0x1,%eax
+  801003:	0f a2                	cpuid
+		return 0;
+  801005:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80100a:	f6 c6 08             	test   $0x8,%dh
+  80100d:	74 15                	je     801024 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80100f:	89 c2                	mov    %eax,%edx
+  801011:	c1 ea 08             	shr    $0x8,%edx
+  801014:	83 e2 0f             	and    $0xf,%edx
+  801017:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80101c:	83 fa 06             	cmp    $0x6,%edx
+  80101f:	74 0e                	je     80102f <sys_page_alloc+0x7b>
+  801021:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801024:	0f b6 c9             	movzbl %cl,%ecx
+  801027:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80102d:	eb 97                	jmp    800fc6 <sys_page_alloc+0x12>
+  80102f:	89 c2                	mov    %eax,%edx
+  801031:	c1 ea 04             	shr    $0x4,%edx
+  801034:	83 e2 0f             	and    $0xf,%edx
+  801037:	83 fa 02             	cmp    $0x2,%edx
+  80103a:	77 e5                	ja     801021 <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  80103c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80103f:	83 f8 02             	cmp    $0x2,%eax
+  801042:	0f 97 c1             	seta   %cl
+  801045:	0f b6 c9             	movzbl %cl,%ecx
+  801048:	eb d7                	jmp    801021 <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  80104a:	be 00 00 00 00       	mov    $0x0,%esi
+  80104f:	b8 04 00 00 00       	mov    $0x4,%eax
+  801054:	8b 55 08             	mov    0x8(%ebp),%edx
+  801057:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80105a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80105d:	89 f7                	mov    %esi,%edi
+  80105f:	cd 30                	int    $0x30
+  801061:	eb 8f                	jmp    800ff2 <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801063:	83 ec 0c             	sub    $0xc,%esp
+  801066:	50                   	push   %eax
+  801067:	6a 04                	push   $0x4
+  801069:	68 59 2e 80 00       	push   $0x802e59
+  80106e:	6a 4a                	push   $0x4a
+  801070:	68 76 2e 80 00       	push   $0x802e76
+  801075:	e8 4b 18 00 00       	call   8028c5 <_panic>
+
+0080107a <sys_page_map>:
+{
+  80107a:	55                   	push   %ebp
+  80107b:	89 e5                	mov    %esp,%ebp
+  80107d:	57                   	push   %edi
+  80107e:	56                   	push   %esi
+  80107f:	53                   	push   %ebx
+  801080:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801083:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80108a:	78 37                	js     8010c3 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  80108c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801093:	74 7a                	je     80110f <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  801095:	8b 55 08             	mov    0x8(%ebp),%edx
+  801098:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80109b:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010a0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010a3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010a6:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010a9:	55                   	push   %ebp
+  8010aa:	68 b3 10 80 00       	push   $0x8010b3
+  8010af:	89 e5                	mov    %esp,%ebp
+  8010b1:	0f 34                	sysenter
+  8010b3:	83 c4 04             	add    $0x4,%esp
+  8010b6:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8010b7:	85 c0                	test   %eax,%eax
+  8010b9:	7f 6c                	jg     801127 <sys_page_map+0xad>
+}
+  8010bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010be:	5b                   	pop    %ebx
+  8010bf:	5e                   	pop    %esi
+  8010c0:	5f                   	pop    %edi
+  8010c1:	5d                   	pop    %ebp
+  8010c2:	c3                   	ret
+  8010c3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010c8:	0f a2                	cpuid
+		return 0;
+  8010ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8010cf:	f6 c6 08             	test   $0x8,%dh
+  8010d2:	74 15                	je     8010e9 <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010d4:	89 c2                	mov    %eax,%edx
+  8010d6:	c1 ea 08             	shr    $0x8,%edx
+  8010d9:	83 e2 0f             	and    $0xf,%edx
+  8010dc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8010e1:	83 fa 06             	cmp    $0x6,%edx
+  8010e4:	74 0e                	je     8010f4 <sys_page_map+0x7a>
+  8010e6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8010e9:	0f b6 c9             	movzbl %cl,%ecx
+  8010ec:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8010f2:	eb 98                	jmp    80108c <sys_page_map+0x12>
+  8010f4:	89 c2                	mov    %eax,%edx
+  8010f6:	c1 ea 04             	shr    $0x4,%edx
+  8010f9:	83 e2 0f             	and    $0xf,%edx
+  8010fc:	83 fa 02             	cmp    $0x2,%edx
+  8010ff:	77 e5                	ja     8010e6 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  801101:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801104:	83 f8 02             	cmp    $0x2,%eax
+  801107:	0f 97 c1             	seta   %cl
+  80110a:	0f b6 c9             	movzbl %cl,%ecx
+  80110d:	eb d7                	jmp    8010e6 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  80110f:	b8 05 00 00 00       	mov    $0x5,%eax
+  801114:	8b 55 08             	mov    0x8(%ebp),%edx
+  801117:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80111d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801120:	8b 75 18             	mov    0x18(%ebp),%esi
+  801123:	cd 30                	int    $0x30
+  801125:	eb 90                	jmp    8010b7 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801127:	83 ec 0c             	sub    $0xc,%esp
+  80112a:	50                   	push   %eax
+  80112b:	6a 05                	push   $0x5
+  80112d:	68 59 2e 80 00       	push   $0x802e59
+  801132:	6a 4a                	push   $0x4a
+  801134:	68 76 2e 80 00       	push   $0x802e76
+  801139:	e8 87 17 00 00       	call   8028c5 <_panic>
+
+0080113e <sys_page_unmap>:
+{
+  80113e:	55                   	push   %ebp
+  80113f:	89 e5                	mov    %esp,%ebp
+  801141:	57                   	push   %edi
+  801142:	56                   	push   %esi
+  801143:	53                   	push   %ebx
+  801144:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801147:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80114e:	78 37                	js     801187 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  801150:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801157:	74 7a                	je     8011d3 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  801159:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80115e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801161:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801164:	b8 06 00 00 00       	mov    $0x6,%eax
+  801169:	89 df                	mov    %ebx,%edi
+  80116b:	89 de                	mov    %ebx,%esi
+  80116d:	55                   	push   %ebp
+  80116e:	68 77 11 80 00       	push   $0x801177
+  801173:	89 e5                	mov    %esp,%ebp
+  801175:	0f 34                	sysenter
+  801177:	83 c4 04             	add    $0x4,%esp
+  80117a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80117b:	85 c0                	test   %eax,%eax
+  80117d:	7f 6c                	jg     8011eb <sys_page_unmap+0xad>
+}
+  80117f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801182:	5b                   	pop    %ebx
+  801183:	5e                   	pop    %esi
+  801184:	5f                   	pop    %edi
+  801185:	5d                   	pop    %ebp
+  801186:	c3                   	ret
+  801187:	b8 01 00 00 00       	mov    $0x1,%eax
+  80118c:	0f a2                	cpuid
+		return 0;
+  80118e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801193:	f6 c6 08             	test   $0x8,%dh
+  801196:	74 15                	je     8011ad <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801198:	89 c2                	mov    %eax,%edx
+  80119a:	c1 ea 08             	shr    $0x8,%edx
+  80119d:	83 e2 0f             	and    $0xf,%edx
+  8011a0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011a5:	83 fa 06             	cmp    $0x6,%edx
+  8011a8:	74 0e                	je     8011b8 <sys_page_unmap+0x7a>
+  8011aa:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8011ad:	0f b6 c9             	movzbl %cl,%ecx
+  8011b0:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8011b6:	eb 98                	jmp    801150 <sys_page_unmap+0x12>
+  8011b8:	89 c2                	mov    %eax,%edx
+  8011ba:	c1 ea 04             	shr    $0x4,%edx
+  8011bd:	83 e2 0f             	and    $0xf,%edx
+  8011c0:	83 fa 02             	cmp    $0x2,%edx
+  8011c3:	77 e5                	ja     8011aa <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  8011c5:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011c8:	83 f8 02             	cmp    $0x2,%eax
+  8011cb:	0f 97 c1             	seta   %cl
+  8011ce:	0f b6 c9             	movzbl %cl,%ecx
+  8011d1:	eb d7                	jmp    8011aa <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  8011d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d8:	b8 06 00 00 00       	mov    $0x6,%eax
+  8011dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e3:	89 df                	mov    %ebx,%edi
+  8011e5:	89 de                	mov    %ebx,%esi
+  8011e7:	cd 30                	int    $0x30
+  8011e9:	eb 90                	jmp    80117b <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011eb:	83 ec 0c             	sub    $0xc,%esp
+  8011ee:	50                   	push   %eax
+  8011ef:	6a 06                	push   $0x6
+  8011f1:	68 59 2e 80 00       	push   $0x802e59
+  8011f6:	6a 4a                	push   $0x4a
+  8011f8:	68 76 2e 80 00       	push   $0x802e76
+  8011fd:	e8 c3 16 00 00       	call   8028c5 <_panic>
+
+00801202 <sys_page_copy>:
+{
+  801202:	55                   	push   %ebp
+  801203:	89 e5                	mov    %esp,%ebp
+  801205:	57                   	push   %edi
+  801206:	56                   	push   %esi
+  801207:	53                   	push   %ebx
+  801208:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80120b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801212:	78 37                	js     80124b <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  801214:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80121b:	74 7a                	je     801297 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  80121d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801220:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801223:	b8 29 00 00 00       	mov    $0x29,%eax
+  801228:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80122b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80122e:	8b 75 18             	mov    0x18(%ebp),%esi
+  801231:	55                   	push   %ebp
+  801232:	68 3b 12 80 00       	push   $0x80123b
+  801237:	89 e5                	mov    %esp,%ebp
+  801239:	0f 34                	sysenter
+  80123b:	83 c4 04             	add    $0x4,%esp
+  80123e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80123f:	85 c0                	test   %eax,%eax
+  801241:	7f 6c                	jg     8012af <sys_page_copy+0xad>
+}
+  801243:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801246:	5b                   	pop    %ebx
+  801247:	5e                   	pop    %esi
+  801248:	5f                   	pop    %edi
+  801249:	5d                   	pop    %ebp
+  80124a:	c3                   	ret
+  80124b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801250:	0f a2                	cpuid
+		return 0;
+  801252:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801257:	f6 c6 08             	test   $0x8,%dh
+  80125a:	74 15                	je     801271 <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80125c:	89 c2                	mov    %eax,%edx
+  80125e:	c1 ea 08             	shr    $0x8,%edx
+  801261:	83 e2 0f             	and    $0xf,%edx
+  801264:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801269:	83 fa 06             	cmp    $0x6,%edx
+  80126c:	74 0e                	je     80127c <sys_page_copy+0x7a>
+  80126e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801271:	0f b6 c9             	movzbl %cl,%ecx
+  801274:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80127a:	eb 98                	jmp    801214 <sys_page_copy+0x12>
+  80127c:	89 c2                	mov    %eax,%edx
+  80127e:	c1 ea 04             	shr    $0x4,%edx
+  801281:	83 e2 0f             	and    $0xf,%edx
+  801284:	83 fa 02             	cmp    $0x2,%edx
+  801287:	77 e5                	ja     80126e <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  801289:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80128c:	83 f8 02             	cmp    $0x2,%eax
+  80128f:	0f 97 c1             	seta   %cl
+  801292:	0f b6 c9             	movzbl %cl,%ecx
+  801295:	eb d7                	jmp    80126e <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  801297:	b8 29 00 00 00       	mov    $0x29,%eax
+  80129c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80129f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012a5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012a8:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012ab:	cd 30                	int    $0x30
+  8012ad:	eb 90                	jmp    80123f <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012af:	83 ec 0c             	sub    $0xc,%esp
+  8012b2:	50                   	push   %eax
+  8012b3:	6a 29                	push   $0x29
+  8012b5:	68 59 2e 80 00       	push   $0x802e59
+  8012ba:	6a 4a                	push   $0x4a
+  8012bc:	68 76 2e 80 00       	push   $0x802e76
+  8012c1:	e8 ff 15 00 00       	call   8028c5 <_panic>
+
+008012c6 <sys_yield>:
+{
+  8012c6:	55                   	push   %ebp
+  8012c7:	89 e5                	mov    %esp,%ebp
+  8012c9:	57                   	push   %edi
+  8012ca:	56                   	push   %esi
+  8012cb:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8012cc:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8012d3:	78 2e                	js     801303 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  8012d5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8012dc:	74 71                	je     80134f <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  8012de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012e3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8012e8:	89 d1                	mov    %edx,%ecx
+  8012ea:	89 d3                	mov    %edx,%ebx
+  8012ec:	89 d7                	mov    %edx,%edi
+  8012ee:	89 d6                	mov    %edx,%esi
+  8012f0:	55                   	push   %ebp
+  8012f1:	68 fa 12 80 00       	push   $0x8012fa
+  8012f6:	89 e5                	mov    %esp,%ebp
+  8012f8:	0f 34                	sysenter
+  8012fa:	83 c4 04             	add    $0x4,%esp
+  8012fd:	5d                   	pop    %ebp
+}
+  8012fe:	5b                   	pop    %ebx
+  8012ff:	5e                   	pop    %esi
+  801300:	5f                   	pop    %edi
+  801301:	5d                   	pop    %ebp
+  801302:	c3                   	ret
+  801303:	b8 01 00 00 00       	mov    $0x1,%eax
+  801308:	0f a2                	cpuid
+		return 0;
+  80130a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80130f:	f6 c6 08             	test   $0x8,%dh
+  801312:	74 15                	je     801329 <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801314:	89 c2                	mov    %eax,%edx
+  801316:	c1 ea 08             	shr    $0x8,%edx
+  801319:	83 e2 0f             	and    $0xf,%edx
+  80131c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801321:	83 fa 06             	cmp    $0x6,%edx
+  801324:	74 0e                	je     801334 <sys_yield+0x6e>
+  801326:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801329:	0f b6 c9             	movzbl %cl,%ecx
+  80132c:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801332:	eb a1                	jmp    8012d5 <sys_yield+0xf>
+  801334:	89 c2                	mov    %eax,%edx
+  801336:	c1 ea 04             	shr    $0x4,%edx
+  801339:	83 e2 0f             	and    $0xf,%edx
+  80133c:	83 fa 02             	cmp    $0x2,%edx
+  80133f:	77 e5                	ja     801326 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  801341:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801344:	83 f8 02             	cmp    $0x2,%eax
+  801347:	0f 97 c1             	seta   %cl
+  80134a:	0f b6 c9             	movzbl %cl,%ecx
+  80134d:	eb d7                	jmp    801326 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  80134f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801354:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801359:	89 d1                	mov    %edx,%ecx
+  80135b:	89 d3                	mov    %edx,%ebx
+  80135d:	89 d7                	mov    %edx,%edi
+  80135f:	89 d6                	mov    %edx,%esi
+  801361:	cd 30                	int    $0x30
+}
+  801363:	eb 99                	jmp    8012fe <sys_yield+0x38>
+
+00801365 <sys_env_set_status>:
+{
+  801365:	55                   	push   %ebp
+  801366:	89 e5                	mov    %esp,%ebp
+  801368:	57                   	push   %edi
+  801369:	56                   	push   %esi
+  80136a:	53                   	push   %ebx
+  80136b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80136e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801375:	78 37                	js     8013ae <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  801377:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80137e:	74 7a                	je     8013fa <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  801380:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801385:	8b 55 08             	mov    0x8(%ebp),%edx
+  801388:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80138b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801390:	89 df                	mov    %ebx,%edi
+  801392:	89 de                	mov    %ebx,%esi
+  801394:	55                   	push   %ebp
+  801395:	68 9e 13 80 00       	push   $0x80139e
+  80139a:	89 e5                	mov    %esp,%ebp
+  80139c:	0f 34                	sysenter
+  80139e:	83 c4 04             	add    $0x4,%esp
+  8013a1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8013a2:	85 c0                	test   %eax,%eax
+  8013a4:	7f 6c                	jg     801412 <sys_env_set_status+0xad>
+}
+  8013a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013a9:	5b                   	pop    %ebx
+  8013aa:	5e                   	pop    %esi
+  8013ab:	5f                   	pop    %edi
+  8013ac:	5d                   	pop    %ebp
+  8013ad:	c3                   	ret
+  8013ae:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013b3:	0f a2                	cpuid
+		return 0;
+  8013b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8013ba:	f6 c6 08             	test   $0x8,%dh
+  8013bd:	74 15                	je     8013d4 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013bf:	89 c2                	mov    %eax,%edx
+  8013c1:	c1 ea 08             	shr    $0x8,%edx
+  8013c4:	83 e2 0f             	and    $0xf,%edx
+  8013c7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8013cc:	83 fa 06             	cmp    $0x6,%edx
+  8013cf:	74 0e                	je     8013df <sys_env_set_status+0x7a>
+  8013d1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8013d4:	0f b6 c9             	movzbl %cl,%ecx
+  8013d7:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8013dd:	eb 98                	jmp    801377 <sys_env_set_status+0x12>
+  8013df:	89 c2                	mov    %eax,%edx
+  8013e1:	c1 ea 04             	shr    $0x4,%edx
+  8013e4:	83 e2 0f             	and    $0xf,%edx
+  8013e7:	83 fa 02             	cmp    $0x2,%edx
+  8013ea:	77 e5                	ja     8013d1 <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  8013ec:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013ef:	83 f8 02             	cmp    $0x2,%eax
+  8013f2:	0f 97 c1             	seta   %cl
+  8013f5:	0f b6 c9             	movzbl %cl,%ecx
+  8013f8:	eb d7                	jmp    8013d1 <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  8013fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ff:	b8 08 00 00 00       	mov    $0x8,%eax
+  801404:	8b 55 08             	mov    0x8(%ebp),%edx
+  801407:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80140a:	89 df                	mov    %ebx,%edi
+  80140c:	89 de                	mov    %ebx,%esi
+  80140e:	cd 30                	int    $0x30
+  801410:	eb 90                	jmp    8013a2 <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801412:	83 ec 0c             	sub    $0xc,%esp
+  801415:	50                   	push   %eax
+  801416:	6a 08                	push   $0x8
+  801418:	68 59 2e 80 00       	push   $0x802e59
+  80141d:	6a 4a                	push   $0x4a
+  80141f:	68 76 2e 80 00       	push   $0x802e76
+  801424:	e8 9c 14 00 00       	call   8028c5 <_panic>
+
+00801429 <sys_sysinfo>:
+{
+  801429:	55                   	push   %ebp
+  80142a:	89 e5                	mov    %esp,%ebp
+  80142c:	57                   	push   %edi
+  80142d:	56                   	push   %esi
+  80142e:	53                   	push   %ebx
+  80142f:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801432:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801439:	78 36                	js     801471 <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  80143b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801442:	74 79                	je     8014bd <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  801444:	8b 55 08             	mov    0x8(%ebp),%edx
+  801447:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80144c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801451:	89 cb                	mov    %ecx,%ebx
+  801453:	89 cf                	mov    %ecx,%edi
+  801455:	89 ce                	mov    %ecx,%esi
+  801457:	55                   	push   %ebp
+  801458:	68 61 14 80 00       	push   $0x801461
+  80145d:	89 e5                	mov    %esp,%ebp
+  80145f:	0f 34                	sysenter
+  801461:	83 c4 04             	add    $0x4,%esp
+  801464:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801465:	85 c0                	test   %eax,%eax
+  801467:	7f 6b                	jg     8014d4 <sys_sysinfo+0xab>
+}
+  801469:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80146c:	5b                   	pop    %ebx
+  80146d:	5e                   	pop    %esi
+  80146e:	5f                   	pop    %edi
+  80146f:	5d                   	pop    %ebp
+  801470:	c3                   	ret
+  801471:	b8 01 00 00 00       	mov    $0x1,%eax
+  801476:	0f a2                	cpuid
+		return 0;
+  801478:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80147d:	f6 c6 08             	test   $0x8,%dh
+  801480:	74 15                	je     801497 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801482:	89 c2                	mov    %eax,%edx
+  801484:	c1 ea 08             	shr    $0x8,%edx
+  801487:	83 e2 0f             	and    $0xf,%edx
+  80148a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80148f:	83 fa 06             	cmp    $0x6,%edx
+  801492:	74 0e                	je     8014a2 <sys_sysinfo+0x79>
+  801494:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801497:	0f b6 c9             	movzbl %cl,%ecx
+  80149a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8014a0:	eb 99                	jmp    80143b <sys_sysinfo+0x12>
+  8014a2:	89 c2                	mov    %eax,%edx
+  8014a4:	c1 ea 04             	shr    $0x4,%edx
+  8014a7:	83 e2 0f             	and    $0xf,%edx
+  8014aa:	83 fa 02             	cmp    $0x2,%edx
+  8014ad:	77 e5                	ja     801494 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  8014af:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014b2:	83 f8 02             	cmp    $0x2,%eax
+  8014b5:	0f 97 c1             	seta   %cl
+  8014b8:	0f b6 c9             	movzbl %cl,%ecx
+  8014bb:	eb d7                	jmp    801494 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  8014bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014c2:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8014c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ca:	89 cb                	mov    %ecx,%ebx
+  8014cc:	89 cf                	mov    %ecx,%edi
+  8014ce:	89 ce                	mov    %ecx,%esi
+  8014d0:	cd 30                	int    $0x30
+  8014d2:	eb 91                	jmp    801465 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014d4:	83 ec 0c             	sub    $0xc,%esp
+  8014d7:	50                   	push   %eax
+  8014d8:	6a 0b                	push   $0xb
+  8014da:	68 59 2e 80 00       	push   $0x802e59
+  8014df:	6a 4a                	push   $0x4a
+  8014e1:	68 76 2e 80 00       	push   $0x802e76
+  8014e6:	e8 da 13 00 00       	call   8028c5 <_panic>
+
+008014eb <sys_env_set_trapframe>:
+{
+  8014eb:	55                   	push   %ebp
+  8014ec:	89 e5                	mov    %esp,%ebp
+  8014ee:	57                   	push   %edi
+  8014ef:	56                   	push   %esi
+  8014f0:	53                   	push   %ebx
+  8014f1:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8014f4:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8014fb:	78 37                	js     801534 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  8014fd:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801504:	74 7a                	je     801580 <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  801506:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80150b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80150e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801511:	b8 13 00 00 00       	mov    $0x13,%eax
+  801516:	89 df                	mov    %ebx,%edi
+  801518:	89 de                	mov    %ebx,%esi
+  80151a:	55                   	push   %ebp
+  80151b:	68 24 15 80 00       	push   $0x801524
+  801520:	89 e5                	mov    %esp,%ebp
+  801522:	0f 34                	sysenter
+  801524:	83 c4 04             	add    $0x4,%esp
+  801527:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801528:	85 c0                	test   %eax,%eax
+  80152a:	7f 6c                	jg     801598 <sys_env_set_trapframe+0xad>
+}
+  80152c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80152f:	5b                   	pop    %ebx
+  801530:	5e                   	pop    %esi
+  801531:	5f                   	pop    %edi
+  801532:	5d                   	pop    %ebp
+  801533:	c3                   	ret
+  801534:	b8 01 00 00 00       	mov    $0x1,%eax
+  801539:	0f a2                	cpuid
+		return 0;
+  80153b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801540:	f6 c6 08             	test   $0x8,%dh
+  801543:	74 15                	je     80155a <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801545:	89 c2                	mov    %eax,%edx
+  801547:	c1 ea 08             	shr    $0x8,%edx
+  80154a:	83 e2 0f             	and    $0xf,%edx
+  80154d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801552:	83 fa 06             	cmp    $0x6,%edx
+  801555:	74 0e                	je     801565 <sys_env_set_trapframe+0x7a>
+  801557:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80155a:	0f b6 c9             	movzbl %cl,%ecx
+  80155d:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801563:	eb 98                	jmp    8014fd <sys_env_set_trapframe+0x12>
+  801565:	89 c2                	mov    %eax,%edx
+  801567:	c1 ea 04             	shr    $0x4,%edx
+  80156a:	83 e2 0f             	and    $0xf,%edx
+  80156d:	83 fa 02             	cmp    $0x2,%edx
+  801570:	77 e5                	ja     801557 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  801572:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801575:	83 f8 02             	cmp    $0x2,%eax
+  801578:	0f 97 c1             	seta   %cl
+  80157b:	0f b6 c9             	movzbl %cl,%ecx
+  80157e:	eb d7                	jmp    801557 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  801580:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801585:	b8 13 00 00 00       	mov    $0x13,%eax
+  80158a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80158d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801590:	89 df                	mov    %ebx,%edi
+  801592:	89 de                	mov    %ebx,%esi
+  801594:	cd 30                	int    $0x30
+  801596:	eb 90                	jmp    801528 <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801598:	83 ec 0c             	sub    $0xc,%esp
+  80159b:	50                   	push   %eax
+  80159c:	6a 13                	push   $0x13
+  80159e:	68 59 2e 80 00       	push   $0x802e59
+  8015a3:	6a 4a                	push   $0x4a
+  8015a5:	68 76 2e 80 00       	push   $0x802e76
+  8015aa:	e8 16 13 00 00       	call   8028c5 <_panic>
+
+008015af <sys_env_set_stack_limit>:
+{
+  8015af:	55                   	push   %ebp
+  8015b0:	89 e5                	mov    %esp,%ebp
+  8015b2:	57                   	push   %edi
+  8015b3:	56                   	push   %esi
+  8015b4:	53                   	push   %ebx
+  8015b5:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8015b8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8015bf:	78 37                	js     8015f8 <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  8015c1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8015c8:	74 7a                	je     801644 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  8015ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015d5:	b8 19 00 00 00       	mov    $0x19,%eax
+  8015da:	89 df                	mov    %ebx,%edi
+  8015dc:	89 de                	mov    %ebx,%esi
+  8015de:	55                   	push   %ebp
+  8015df:	68 e8 15 80 00       	push   $0x8015e8
+  8015e4:	89 e5                	mov    %esp,%ebp
+  8015e6:	0f 34                	sysenter
+  8015e8:	83 c4 04             	add    $0x4,%esp
+  8015eb:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8015ec:	85 c0                	test   %eax,%eax
+  8015ee:	7f 6c                	jg     80165c <sys_env_set_stack_limit+0xad>
+}
+  8015f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015f3:	5b                   	pop    %ebx
+  8015f4:	5e                   	pop    %esi
+  8015f5:	5f                   	pop    %edi
+  8015f6:	5d                   	pop    %ebp
+  8015f7:	c3                   	ret
+  8015f8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015fd:	0f a2                	cpuid
+		return 0;
+  8015ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801604:	f6 c6 08             	test   $0x8,%dh
+  801607:	74 15                	je     80161e <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801609:	89 c2                	mov    %eax,%edx
+  80160b:	c1 ea 08             	shr    $0x8,%edx
+  80160e:	83 e2 0f             	and    $0xf,%edx
+  801611:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801616:	83 fa 06             	cmp    $0x6,%edx
+  801619:	74 0e                	je     801629 <sys_env_set_stack_limit+0x7a>
+  80161b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80161e:	0f b6 c9             	movzbl %cl,%ecx
+  801621:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801627:	eb 98                	jmp    8015c1 <sys_env_set_stack_limit+0x12>
+  801629:	89 c2                	mov    %eax,%edx
+  80162b:	c1 ea 04             	shr    $0x4,%edx
+  80162e:	83 e2 0f             	and    $0xf,%edx
+  801631:	83 fa 02             	cmp    $0x2,%edx
+  801634:	77 e5                	ja     80161b <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  801636:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801639:	83 f8 02             	cmp    $0x2,%eax
+  80163c:	0f 97 c1             	seta   %cl
+  80163f:	0f b6 c9             	movzbl %cl,%ecx
+  801642:	eb d7                	jmp    80161b <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  801644:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801649:	b8 19 00 00 00       	mov    $0x19,%eax
+  80164e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801651:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801654:	89 df                	mov    %ebx,%edi
+  801656:	89 de                	mov    %ebx,%esi
+  801658:	cd 30                	int    $0x30
+  80165a:	eb 90                	jmp    8015ec <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80165c:	83 ec 0c             	sub    $0xc,%esp
+  80165f:	50                   	push   %eax
+  801660:	6a 19                	push   $0x19
+  801662:	68 59 2e 80 00       	push   $0x802e59
+  801667:	6a 4a                	push   $0x4a
+  801669:	68 76 2e 80 00       	push   $0x802e76
+  80166e:	e8 52 12 00 00       	call   8028c5 <_panic>
+
+00801673 <sys_env_set_pgfault_upcall>:
+{
+  801673:	55                   	push   %ebp
+  801674:	89 e5                	mov    %esp,%ebp
+  801676:	57                   	push   %edi
+  801677:	56                   	push   %esi
+  801678:	53                   	push   %ebx
+  801679:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80167c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801683:	78 37                	js     8016bc <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  801685:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80168c:	74 7a                	je     801708 <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  80168e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801693:	8b 55 08             	mov    0x8(%ebp),%edx
+  801696:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801699:	b8 09 00 00 00       	mov    $0x9,%eax
+  80169e:	89 df                	mov    %ebx,%edi
+  8016a0:	89 de                	mov    %ebx,%esi
+  8016a2:	55                   	push   %ebp
+  8016a3:	68 ac 16 80 00       	push   $0x8016ac
+  8016a8:	89 e5                	mov    %esp,%ebp
+  8016aa:	0f 34                	sysenter
+  8016ac:	83 c4 04             	add    $0x4,%esp
+  8016af:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8016b0:	85 c0                	test   %eax,%eax
+  8016b2:	7f 6c                	jg     801720 <sys_env_set_pgfault_upcall+0xad>
+}
+  8016b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016b7:	5b                   	pop    %ebx
+  8016b8:	5e                   	pop    %esi
+  8016b9:	5f                   	pop    %edi
+  8016ba:	5d                   	pop    %ebp
+  8016bb:	c3                   	ret
+  8016bc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016c1:	0f a2                	cpuid
+		return 0;
+  8016c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8016c8:	f6 c6 08             	test   $0x8,%dh
+  8016cb:	74 15                	je     8016e2 <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016cd:	89 c2                	mov    %eax,%edx
+  8016cf:	c1 ea 08             	shr    $0x8,%edx
+  8016d2:	83 e2 0f             	and    $0xf,%edx
+  8016d5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8016da:	83 fa 06             	cmp    $0x6,%edx
+  8016dd:	74 0e                	je     8016ed <sys_env_set_pgfault_upcall+0x7a>
+  8016df:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8016e2:	0f b6 c9             	movzbl %cl,%ecx
+  8016e5:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8016eb:	eb 98                	jmp    801685 <sys_env_set_pgfault_upcall+0x12>
+  8016ed:	89 c2                	mov    %eax,%edx
+  8016ef:	c1 ea 04             	shr    $0x4,%edx
+  8016f2:	83 e2 0f             	and    $0xf,%edx
+  8016f5:	83 fa 02             	cmp    $0x2,%edx
+  8016f8:	77 e5                	ja     8016df <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  8016fa:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016fd:	83 f8 02             	cmp    $0x2,%eax
+  801700:	0f 97 c1             	seta   %cl
+  801703:	0f b6 c9             	movzbl %cl,%ecx
+  801706:	eb d7                	jmp    8016df <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  801708:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80170d:	b8 09 00 00 00       	mov    $0x9,%eax
+  801712:	8b 55 08             	mov    0x8(%ebp),%edx
+  801715:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801718:	89 df                	mov    %ebx,%edi
+  80171a:	89 de                	mov    %ebx,%esi
+  80171c:	cd 30                	int    $0x30
+  80171e:	eb 90                	jmp    8016b0 <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801720:	83 ec 0c             	sub    $0xc,%esp
+  801723:	50                   	push   %eax
+  801724:	6a 09                	push   $0x9
+  801726:	68 59 2e 80 00       	push   $0x802e59
+  80172b:	6a 4a                	push   $0x4a
+  80172d:	68 76 2e 80 00       	push   $0x802e76
+  801732:	e8 8e 11 00 00       	call   8028c5 <_panic>
+
+00801737 <sys_ipc_try_send>:
+{
+  801737:	55                   	push   %ebp
+  801738:	89 e5                	mov    %esp,%ebp
+  80173a:	57                   	push   %edi
+  80173b:	56                   	push   %esi
+  80173c:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80173d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801744:	78 32                	js     801778 <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  801746:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80174d:	74 75                	je     8017c4 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  80174f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801752:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801755:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80175a:	be 00 00 00 00       	mov    $0x0,%esi
+  80175f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801762:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801765:	55                   	push   %ebp
+  801766:	68 6f 17 80 00       	push   $0x80176f
+  80176b:	89 e5                	mov    %esp,%ebp
+  80176d:	0f 34                	sysenter
+  80176f:	83 c4 04             	add    $0x4,%esp
+  801772:	5d                   	pop    %ebp
+}
+  801773:	5b                   	pop    %ebx
+  801774:	5e                   	pop    %esi
+  801775:	5f                   	pop    %edi
+  801776:	5d                   	pop    %ebp
+  801777:	c3                   	ret
+  801778:	b8 01 00 00 00       	mov    $0x1,%eax
+  80177d:	0f a2                	cpuid
+		return 0;
+  80177f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801784:	f6 c6 08             	test   $0x8,%dh
+  801787:	74 15                	je     80179e <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801789:	89 c2                	mov    %eax,%edx
+  80178b:	c1 ea 08             	shr    $0x8,%edx
+  80178e:	83 e2 0f             	and    $0xf,%edx
+  801791:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801796:	83 fa 06             	cmp    $0x6,%edx
+  801799:	74 0e                	je     8017a9 <sys_ipc_try_send+0x72>
+  80179b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80179e:	0f b6 c9             	movzbl %cl,%ecx
+  8017a1:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8017a7:	eb 9d                	jmp    801746 <sys_ipc_try_send+0xf>
+  8017a9:	89 c2                	mov    %eax,%edx
+  8017ab:	c1 ea 04             	shr    $0x4,%edx
+  8017ae:	83 e2 0f             	and    $0xf,%edx
+  8017b1:	83 fa 02             	cmp    $0x2,%edx
+  8017b4:	77 e5                	ja     80179b <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  8017b6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017b9:	83 f8 02             	cmp    $0x2,%eax
+  8017bc:	0f 97 c1             	seta   %cl
+  8017bf:	0f b6 c9             	movzbl %cl,%ecx
+  8017c2:	eb d7                	jmp    80179b <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  8017c4:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8017c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8017ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017d7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8017da:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  8017dc:	eb 95                	jmp    801773 <sys_ipc_try_send+0x3c>
+
+008017de <sys_ipc_send>:
+{
+  8017de:	55                   	push   %ebp
+  8017df:	89 e5                	mov    %esp,%ebp
+  8017e1:	57                   	push   %edi
+  8017e2:	56                   	push   %esi
+  8017e3:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8017e4:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8017eb:	78 32                	js     80181f <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  8017ed:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8017f4:	74 75                	je     80186b <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  8017f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017fc:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801801:	be 00 00 00 00       	mov    $0x0,%esi
+  801806:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801809:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80180c:	55                   	push   %ebp
+  80180d:	68 16 18 80 00       	push   $0x801816
+  801812:	89 e5                	mov    %esp,%ebp
+  801814:	0f 34                	sysenter
+  801816:	83 c4 04             	add    $0x4,%esp
+  801819:	5d                   	pop    %ebp
+}
+  80181a:	5b                   	pop    %ebx
+  80181b:	5e                   	pop    %esi
+  80181c:	5f                   	pop    %edi
+  80181d:	5d                   	pop    %ebp
+  80181e:	c3                   	ret
+  80181f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801824:	0f a2                	cpuid
+		return 0;
+  801826:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80182b:	f6 c6 08             	test   $0x8,%dh
+  80182e:	74 15                	je     801845 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801830:	89 c2                	mov    %eax,%edx
+  801832:	c1 ea 08             	shr    $0x8,%edx
+  801835:	83 e2 0f             	and    $0xf,%edx
+  801838:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80183d:	83 fa 06             	cmp    $0x6,%edx
+  801840:	74 0e                	je     801850 <sys_ipc_send+0x72>
+  801842:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801845:	0f b6 c9             	movzbl %cl,%ecx
+  801848:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80184e:	eb 9d                	jmp    8017ed <sys_ipc_send+0xf>
+  801850:	89 c2                	mov    %eax,%edx
+  801852:	c1 ea 04             	shr    $0x4,%edx
+  801855:	83 e2 0f             	and    $0xf,%edx
+  801858:	83 fa 02             	cmp    $0x2,%edx
+  80185b:	77 e5                	ja     801842 <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  80185d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801860:	83 f8 02             	cmp    $0x2,%eax
+  801863:	0f 97 c1             	seta   %cl
+  801866:	0f b6 c9             	movzbl %cl,%ecx
+  801869:	eb d7                	jmp    801842 <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  80186b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801870:	be 00 00 00 00       	mov    $0x0,%esi
+  801875:	8b 55 08             	mov    0x8(%ebp),%edx
+  801878:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80187b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80187e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801881:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801883:	eb 95                	jmp    80181a <sys_ipc_send+0x3c>
+
+00801885 <sys_ipc_recv>:
+{
+  801885:	55                   	push   %ebp
+  801886:	89 e5                	mov    %esp,%ebp
+  801888:	57                   	push   %edi
+  801889:	56                   	push   %esi
+  80188a:	53                   	push   %ebx
+  80188b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80188e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801895:	78 36                	js     8018cd <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  801897:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80189e:	74 79                	je     801919 <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  8018a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018a8:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8018ad:	89 cb                	mov    %ecx,%ebx
+  8018af:	89 cf                	mov    %ecx,%edi
+  8018b1:	89 ce                	mov    %ecx,%esi
+  8018b3:	55                   	push   %ebp
+  8018b4:	68 bd 18 80 00       	push   $0x8018bd
+  8018b9:	89 e5                	mov    %esp,%ebp
+  8018bb:	0f 34                	sysenter
+  8018bd:	83 c4 04             	add    $0x4,%esp
+  8018c0:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8018c1:	85 c0                	test   %eax,%eax
+  8018c3:	7f 6b                	jg     801930 <sys_ipc_recv+0xab>
+}
+  8018c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018c8:	5b                   	pop    %ebx
+  8018c9:	5e                   	pop    %esi
+  8018ca:	5f                   	pop    %edi
+  8018cb:	5d                   	pop    %ebp
+  8018cc:	c3                   	ret
+  8018cd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018d2:	0f a2                	cpuid
+		return 0;
+  8018d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018d9:	f6 c6 08             	test   $0x8,%dh
+  8018dc:	74 15                	je     8018f3 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018de:	89 c2                	mov    %eax,%edx
+  8018e0:	c1 ea 08             	shr    $0x8,%edx
+  8018e3:	83 e2 0f             	and    $0xf,%edx
+  8018e6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018eb:	83 fa 06             	cmp    $0x6,%edx
+  8018ee:	74 0e                	je     8018fe <sys_ipc_recv+0x79>
+  8018f0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8018f3:	0f b6 c9             	movzbl %cl,%ecx
+  8018f6:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8018fc:	eb 99                	jmp    801897 <sys_ipc_recv+0x12>
+  8018fe:	89 c2                	mov    %eax,%edx
+  801900:	c1 ea 04             	shr    $0x4,%edx
+  801903:	83 e2 0f             	and    $0xf,%edx
+  801906:	83 fa 02             	cmp    $0x2,%edx
+  801909:	77 e5                	ja     8018f0 <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  80190b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80190e:	83 f8 02             	cmp    $0x2,%eax
+  801911:	0f 97 c1             	seta   %cl
+  801914:	0f b6 c9             	movzbl %cl,%ecx
+  801917:	eb d7                	jmp    8018f0 <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  801919:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80191e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801923:	8b 55 08             	mov    0x8(%ebp),%edx
+  801926:	89 cb                	mov    %ecx,%ebx
+  801928:	89 cf                	mov    %ecx,%edi
+  80192a:	89 ce                	mov    %ecx,%esi
+  80192c:	cd 30                	int    $0x30
+  80192e:	eb 91                	jmp    8018c1 <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801930:	83 ec 0c             	sub    $0xc,%esp
+  801933:	50                   	push   %eax
+  801934:	6a 0d                	push   $0xd
+  801936:	68 59 2e 80 00       	push   $0x802e59
+  80193b:	6a 4a                	push   $0x4a
+  80193d:	68 76 2e 80 00       	push   $0x802e76
+  801942:	e8 7e 0f 00 00       	call   8028c5 <_panic>
+
+00801947 <sys_ipc_send_range>:
+{
+  801947:	55                   	push   %ebp
+  801948:	89 e5                	mov    %esp,%ebp
+  80194a:	57                   	push   %edi
+  80194b:	56                   	push   %esi
+  80194c:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80194d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801954:	78 30                	js     801986 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  801956:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80195d:	74 73                	je     8019d2 <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  80195f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801962:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801965:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80196a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80196d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801970:	8b 75 18             	mov    0x18(%ebp),%esi
+  801973:	55                   	push   %ebp
+  801974:	68 7d 19 80 00       	push   $0x80197d
+  801979:	89 e5                	mov    %esp,%ebp
+  80197b:	0f 34                	sysenter
+  80197d:	83 c4 04             	add    $0x4,%esp
+  801980:	5d                   	pop    %ebp
+}
+  801981:	5b                   	pop    %ebx
+  801982:	5e                   	pop    %esi
+  801983:	5f                   	pop    %edi
+  801984:	5d                   	pop    %ebp
+  801985:	c3                   	ret
+  801986:	b8 01 00 00 00       	mov    $0x1,%eax
+  80198b:	0f a2                	cpuid
+		return 0;
+  80198d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801992:	f6 c6 08             	test   $0x8,%dh
+  801995:	74 15                	je     8019ac <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801997:	89 c2                	mov    %eax,%edx
+  801999:	c1 ea 08             	shr    $0x8,%edx
+  80199c:	83 e2 0f             	and    $0xf,%edx
+  80199f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019a4:	83 fa 06             	cmp    $0x6,%edx
+  8019a7:	74 0e                	je     8019b7 <sys_ipc_send_range+0x70>
+  8019a9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8019ac:	0f b6 c9             	movzbl %cl,%ecx
+  8019af:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8019b5:	eb 9f                	jmp    801956 <sys_ipc_send_range+0xf>
+  8019b7:	89 c2                	mov    %eax,%edx
+  8019b9:	c1 ea 04             	shr    $0x4,%edx
+  8019bc:	83 e2 0f             	and    $0xf,%edx
+  8019bf:	83 fa 02             	cmp    $0x2,%edx
+  8019c2:	77 e5                	ja     8019a9 <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  8019c4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019c7:	83 f8 02             	cmp    $0x2,%eax
+  8019ca:	0f 97 c1             	seta   %cl
+  8019cd:	0f b6 c9             	movzbl %cl,%ecx
+  8019d0:	eb d7                	jmp    8019a9 <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  8019d2:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8019d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019dd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019e0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8019e3:	8b 75 18             	mov    0x18(%ebp),%esi
+  8019e6:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  8019e8:	eb 97                	jmp    801981 <sys_ipc_send_range+0x3a>
+
+008019ea <sys_ipc_recv_range>:
+{
+  8019ea:	55                   	push   %ebp
+  8019eb:	89 e5                	mov    %esp,%ebp
+  8019ed:	57                   	push   %edi
+  8019ee:	56                   	push   %esi
+  8019ef:	53                   	push   %ebx
+  8019f0:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8019f3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8019fa:	78 37                	js     801a33 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  8019fc:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801a03:	74 7a                	je     801a7f <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  801a05:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a0a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a0d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a10:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801a15:	89 df                	mov    %ebx,%edi
+  801a17:	89 de                	mov    %ebx,%esi
+  801a19:	55                   	push   %ebp
+  801a1a:	68 23 1a 80 00       	push   $0x801a23
+  801a1f:	89 e5                	mov    %esp,%ebp
+  801a21:	0f 34                	sysenter
+  801a23:	83 c4 04             	add    $0x4,%esp
+  801a26:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801a27:	85 c0                	test   %eax,%eax
+  801a29:	7f 6c                	jg     801a97 <sys_ipc_recv_range+0xad>
+}
+  801a2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a2e:	5b                   	pop    %ebx
+  801a2f:	5e                   	pop    %esi
+  801a30:	5f                   	pop    %edi
+  801a31:	5d                   	pop    %ebp
+  801a32:	c3                   	ret
+  801a33:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a38:	0f a2                	cpuid
+		return 0;
+  801a3a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801a3f:	f6 c6 08             	test   $0x8,%dh
+  801a42:	74 15                	je     801a59 <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a44:	89 c2                	mov    %eax,%edx
+  801a46:	c1 ea 08             	shr    $0x8,%edx
+  801a49:	83 e2 0f             	and    $0xf,%edx
+  801a4c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a51:	83 fa 06             	cmp    $0x6,%edx
+  801a54:	74 0e                	je     801a64 <sys_ipc_recv_range+0x7a>
+  801a56:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a59:	0f b6 c9             	movzbl %cl,%ecx
+  801a5c:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801a62:	eb 98                	jmp    8019fc <sys_ipc_recv_range+0x12>
+  801a64:	89 c2                	mov    %eax,%edx
+  801a66:	c1 ea 04             	shr    $0x4,%edx
+  801a69:	83 e2 0f             	and    $0xf,%edx
+  801a6c:	83 fa 02             	cmp    $0x2,%edx
+  801a6f:	77 e5                	ja     801a56 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801a71:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a74:	83 f8 02             	cmp    $0x2,%eax
+  801a77:	0f 97 c1             	seta   %cl
+  801a7a:	0f b6 c9             	movzbl %cl,%ecx
+  801a7d:	eb d7                	jmp    801a56 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801a7f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a84:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801a89:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a8c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a8f:	89 df                	mov    %ebx,%edi
+  801a91:	89 de                	mov    %ebx,%esi
+  801a93:	cd 30                	int    $0x30
+  801a95:	eb 90                	jmp    801a27 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a97:	83 ec 0c             	sub    $0xc,%esp
+  801a9a:	50                   	push   %eax
+  801a9b:	6a 1f                	push   $0x1f
+  801a9d:	68 59 2e 80 00       	push   $0x802e59
+  801aa2:	6a 4a                	push   $0x4a
+  801aa4:	68 76 2e 80 00       	push   $0x802e76
+  801aa9:	e8 17 0e 00 00       	call   8028c5 <_panic>
+
+00801aae <sys_ipc_call>:
+{
+  801aae:	55                   	push   %ebp
+  801aaf:	89 e5                	mov    %esp,%ebp
+  801ab1:	57                   	push   %edi
+  801ab2:	56                   	push   %esi
+  801ab3:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801ab4:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ab7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801abc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801abf:	55                   	push   %ebp
+  801ac0:	56                   	push   %esi
+  801ac1:	8b 0e                	mov    (%esi),%ecx
+  801ac3:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801ac6:	8b 7e 08             	mov    0x8(%esi),%edi
+  801ac9:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801acc:	8b 76 0c             	mov    0xc(%esi),%esi
+  801acf:	cd 30                	int    $0x30
+  801ad1:	87 34 24             	xchg   %esi,(%esp)
+  801ad4:	89 0e                	mov    %ecx,(%esi)
+  801ad6:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801ad9:	89 7e 08             	mov    %edi,0x8(%esi)
+  801adc:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801adf:	8f 46 0c             	pop    0xc(%esi)
+  801ae2:	5d                   	pop    %ebp
+}
+  801ae3:	5b                   	pop    %ebx
+  801ae4:	5e                   	pop    %esi
+  801ae5:	5f                   	pop    %edi
+  801ae6:	5d                   	pop    %ebp
+  801ae7:	c3                   	ret
+
+00801ae8 <sys_ipc_reply_wait>:
+{
+  801ae8:	55                   	push   %ebp
+  801ae9:	89 e5                	mov    %esp,%ebp
+  801aeb:	57                   	push   %edi
+  801aec:	56                   	push   %esi
+  801aed:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801aee:	8b 55 08             	mov    0x8(%ebp),%edx
+  801af1:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801af6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801af9:	55                   	push   %ebp
+  801afa:	56                   	push   %esi
+  801afb:	8b 0e                	mov    (%esi),%ecx
+  801afd:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801b00:	8b 7e 08             	mov    0x8(%esi),%edi
+  801b03:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801b06:	8b 76 0c             	mov    0xc(%esi),%esi
+  801b09:	cd 30                	int    $0x30
+  801b0b:	87 34 24             	xchg   %esi,(%esp)
+  801b0e:	89 0e                	mov    %ecx,(%esi)
+  801b10:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801b13:	89 7e 08             	mov    %edi,0x8(%esi)
+  801b16:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801b19:	8f 46 0c             	pop    0xc(%esi)
+  801b1c:	5d                   	pop    %ebp
+}
+  801b1d:	5b                   	pop    %ebx
+  801b1e:	5e                   	pop    %esi
+  801b1f:	5f                   	pop    %edi
+  801b20:	5d                   	pop    %ebp
+  801b21:	c3                   	ret
+
+00801b22 <sys_ipc_send_msg>:
+{
+  801b22:	55                   	push   %ebp
+  801b23:	89 e5                	mov    %esp,%ebp
+  801b25:	57                   	push   %edi
+  801b26:	56                   	push   %esi
+  801b27:	53                   	push   %ebx
+  801b28:	83 ec 20             	sub    $0x20,%esp
+  801b2b:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801b2e:	8b 10                	mov    (%eax),%edx
+  801b30:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801b33:	8b 50 04             	mov    0x4(%eax),%edx
+  801b36:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801b39:	8b 50 08             	mov    0x8(%eax),%edx
+  801b3c:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801b3f:	8b 50 0c             	mov    0xc(%eax),%edx
+  801b42:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801b45:	8b 40 10             	mov    0x10(%eax),%eax
+  801b48:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801b4b:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801b4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b51:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801b56:	55                   	push   %ebp
+  801b57:	56                   	push   %esi
+  801b58:	8b 0e                	mov    (%esi),%ecx
+  801b5a:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801b5d:	8b 7e 08             	mov    0x8(%esi),%edi
+  801b60:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801b63:	8b 76 0c             	mov    0xc(%esi),%esi
+  801b66:	cd 30                	int    $0x30
+  801b68:	87 34 24             	xchg   %esi,(%esp)
+  801b6b:	89 0e                	mov    %ecx,(%esi)
+  801b6d:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801b70:	89 7e 08             	mov    %edi,0x8(%esi)
+  801b73:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801b76:	8f 46 0c             	pop    0xc(%esi)
+  801b79:	5d                   	pop    %ebp
+}
+  801b7a:	83 c4 20             	add    $0x20,%esp
+  801b7d:	5b                   	pop    %ebx
+  801b7e:	5e                   	pop    %esi
+  801b7f:	5f                   	pop    %edi
+  801b80:	5d                   	pop    %ebp
+  801b81:	c3                   	ret
+
+00801b82 <sys_fork>:
+{
+  801b82:	55                   	push   %ebp
+  801b83:	89 e5                	mov    %esp,%ebp
+  801b85:	57                   	push   %edi
+  801b86:	56                   	push   %esi
+  801b87:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801b88:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b8f:	78 2e                	js     801bbf <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801b91:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b98:	74 71                	je     801c0b <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801b9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b9f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801ba4:	89 d1                	mov    %edx,%ecx
+  801ba6:	89 d3                	mov    %edx,%ebx
+  801ba8:	89 d7                	mov    %edx,%edi
+  801baa:	89 d6                	mov    %edx,%esi
+  801bac:	55                   	push   %ebp
+  801bad:	68 b6 1b 80 00       	push   $0x801bb6
+  801bb2:	89 e5                	mov    %esp,%ebp
+  801bb4:	0f 34                	sysenter
+  801bb6:	83 c4 04             	add    $0x4,%esp
+  801bb9:	5d                   	pop    %ebp
+}
+  801bba:	5b                   	pop    %ebx
+  801bbb:	5e                   	pop    %esi
+  801bbc:	5f                   	pop    %edi
+  801bbd:	5d                   	pop    %ebp
+  801bbe:	c3                   	ret
+  801bbf:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bc4:	0f a2                	cpuid
+		return 0;
+  801bc6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801bcb:	f6 c6 08             	test   $0x8,%dh
+  801bce:	74 15                	je     801be5 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bd0:	89 c2                	mov    %eax,%edx
+  801bd2:	c1 ea 08             	shr    $0x8,%edx
+  801bd5:	83 e2 0f             	and    $0xf,%edx
+  801bd8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801bdd:	83 fa 06             	cmp    $0x6,%edx
+  801be0:	74 0e                	je     801bf0 <sys_fork+0x6e>
+  801be2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801be5:	0f b6 c9             	movzbl %cl,%ecx
+  801be8:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801bee:	eb a1                	jmp    801b91 <sys_fork+0xf>
+  801bf0:	89 c2                	mov    %eax,%edx
+  801bf2:	c1 ea 04             	shr    $0x4,%edx
+  801bf5:	83 e2 0f             	and    $0xf,%edx
+  801bf8:	83 fa 02             	cmp    $0x2,%edx
+  801bfb:	77 e5                	ja     801be2 <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801bfd:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c00:	83 f8 02             	cmp    $0x2,%eax
+  801c03:	0f 97 c1             	seta   %cl
+  801c06:	0f b6 c9             	movzbl %cl,%ecx
+  801c09:	eb d7                	jmp    801be2 <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801c0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c10:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801c15:	89 d1                	mov    %edx,%ecx
+  801c17:	89 d3                	mov    %edx,%ebx
+  801c19:	89 d7                	mov    %edx,%edi
+  801c1b:	89 d6                	mov    %edx,%esi
+  801c1d:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801c1f:	eb 99                	jmp    801bba <sys_fork+0x38>
+
+00801c21 <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801c21:	55                   	push   %ebp
+  801c22:	89 e5                	mov    %esp,%ebp
+  801c24:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801c27:	ff 75 14             	push   0x14(%ebp)
+  801c2a:	ff 75 10             	push   0x10(%ebp)
+  801c2d:	ff 75 0c             	push   0xc(%ebp)
+  801c30:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c35:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c38:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801c3d:	e8 81 ee ff ff       	call   800ac3 <page_vec_call>
+}
+  801c42:	c9                   	leave
+  801c43:	c3                   	ret
+
+00801c44 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801c44:	55                   	push   %ebp
+  801c45:	89 e5                	mov    %esp,%ebp
+  801c47:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801c4a:	ff 75 18             	push   0x18(%ebp)
+  801c4d:	ff 75 14             	push   0x14(%ebp)
+  801c50:	ff 75 10             	push   0x10(%ebp)
+  801c53:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c56:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c59:	b8 10 00 00 00       	mov    $0x10,%eax
+  801c5e:	e8 60 ee ff ff       	call   800ac3 <page_vec_call>
+}
+  801c63:	c9                   	leave
+  801c64:	c3                   	ret
+
+00801c65 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801c65:	55                   	push   %ebp
+  801c66:	89 e5                	mov    %esp,%ebp
+  801c68:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801c6b:	ff 75 14             	push   0x14(%ebp)
+  801c6e:	ff 75 10             	push   0x10(%ebp)
+  801c71:	ff 75 0c             	push   0xc(%ebp)
+  801c74:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c79:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c7c:	b8 11 00 00 00       	mov    $0x11,%eax
+  801c81:	e8 3d ee ff ff       	call   800ac3 <page_vec_call>
+}
+  801c86:	c9                   	leave
+  801c87:	c3                   	ret
+
+00801c88 <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801c88:	55                   	push   %ebp
+  801c89:	89 e5                	mov    %esp,%ebp
+  801c8b:	57                   	push   %edi
+  801c8c:	56                   	push   %esi
+  801c8d:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801c8e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801c95:	78 32                	js     801cc9 <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801c97:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801c9e:	74 75                	je     801d15 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801ca0:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ca3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ca6:	b8 12 00 00 00       	mov    $0x12,%eax
+  801cab:	be 00 00 00 00       	mov    $0x0,%esi
+  801cb0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801cb3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801cb6:	55                   	push   %ebp
+  801cb7:	68 c0 1c 80 00       	push   $0x801cc0
+  801cbc:	89 e5                	mov    %esp,%ebp
+  801cbe:	0f 34                	sysenter
+  801cc0:	83 c4 04             	add    $0x4,%esp
+  801cc3:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801cc4:	5b                   	pop    %ebx
+  801cc5:	5e                   	pop    %esi
+  801cc6:	5f                   	pop    %edi
+  801cc7:	5d                   	pop    %ebp
+  801cc8:	c3                   	ret
+  801cc9:	b8 01 00 00 00       	mov    $0x1,%eax
+  801cce:	0f a2                	cpuid
+		return 0;
+  801cd0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801cd5:	f6 c6 08             	test   $0x8,%dh
+  801cd8:	74 15                	je     801cef <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801cda:	89 c2                	mov    %eax,%edx
+  801cdc:	c1 ea 08             	shr    $0x8,%edx
+  801cdf:	83 e2 0f             	and    $0xf,%edx
+  801ce2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ce7:	83 fa 06             	cmp    $0x6,%edx
+  801cea:	74 0e                	je     801cfa <sys_vm_ranges+0x72>
+  801cec:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801cef:	0f b6 c9             	movzbl %cl,%ecx
+  801cf2:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801cf8:	eb 9d                	jmp    801c97 <sys_vm_ranges+0xf>
+  801cfa:	89 c2                	mov    %eax,%edx
+  801cfc:	c1 ea 04             	shr    $0x4,%edx
+  801cff:	83 e2 0f             	and    $0xf,%edx
+  801d02:	83 fa 02             	cmp    $0x2,%edx
+  801d05:	77 e5                	ja     801cec <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  801d07:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d0a:	83 f8 02             	cmp    $0x2,%eax
+  801d0d:	0f 97 c1             	seta   %cl
+  801d10:	0f b6 c9             	movzbl %cl,%ecx
+  801d13:	eb d7                	jmp    801cec <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801d15:	b8 12 00 00 00       	mov    $0x12,%eax
+  801d1a:	be 00 00 00 00       	mov    $0x0,%esi
+  801d1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d22:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d25:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d28:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801d2b:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801d2d:	eb 95                	jmp    801cc4 <sys_vm_ranges+0x3c>
+
+00801d2f <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801d2f:	55                   	push   %ebp
+  801d30:	89 e5                	mov    %esp,%ebp
+  801d32:	57                   	push   %edi
+  801d33:	56                   	push   %esi
+  801d34:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801d35:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801d3c:	78 31                	js     801d6f <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801d3e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801d45:	74 74                	je     801dbb <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801d47:	be 00 00 00 00       	mov    $0x0,%esi
+  801d4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d4f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d52:	b8 14 00 00 00       	mov    $0x14,%eax
+  801d57:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d5a:	89 f7                	mov    %esi,%edi
+  801d5c:	55                   	push   %ebp
+  801d5d:	68 66 1d 80 00       	push   $0x801d66
+  801d62:	89 e5                	mov    %esp,%ebp
+  801d64:	0f 34                	sysenter
+  801d66:	83 c4 04             	add    $0x4,%esp
+  801d69:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801d6a:	5b                   	pop    %ebx
+  801d6b:	5e                   	pop    %esi
+  801d6c:	5f                   	pop    %edi
+  801d6d:	5d                   	pop    %ebp
+  801d6e:	c3                   	ret
+  801d6f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d74:	0f a2                	cpuid
+		return 0;
+  801d76:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801d7b:	f6 c6 08             	test   $0x8,%dh
+  801d7e:	74 15                	je     801d95 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d80:	89 c2                	mov    %eax,%edx
+  801d82:	c1 ea 08             	shr    $0x8,%edx
+  801d85:	83 e2 0f             	and    $0xf,%edx
+  801d88:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d8d:	83 fa 06             	cmp    $0x6,%edx
+  801d90:	74 0e                	je     801da0 <sys_spawn+0x71>
+  801d92:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801d95:	0f b6 c9             	movzbl %cl,%ecx
+  801d98:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801d9e:	eb 9e                	jmp    801d3e <sys_spawn+0xf>
+  801da0:	89 c2                	mov    %eax,%edx
+  801da2:	c1 ea 04             	shr    $0x4,%edx
+  801da5:	83 e2 0f             	and    $0xf,%edx
+  801da8:	83 fa 02             	cmp    $0x2,%edx
+  801dab:	77 e5                	ja     801d92 <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  801dad:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801db0:	83 f8 02             	cmp    $0x2,%eax
+  801db3:	0f 97 c1             	seta   %cl
+  801db6:	0f b6 c9             	movzbl %cl,%ecx
+  801db9:	eb d7                	jmp    801d92 <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  801dbb:	be 00 00 00 00       	mov    $0x0,%esi
+  801dc0:	b8 14 00 00 00       	mov    $0x14,%eax
+  801dc5:	8b 55 08             	mov    0x8(%ebp),%edx
+  801dc8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801dcb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801dce:	89 f7                	mov    %esi,%edi
+  801dd0:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  801dd2:	eb 96                	jmp    801d6a <sys_spawn+0x3b>
+
+00801dd4 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  801dd4:	55                   	push   %ebp
+  801dd5:	89 e5                	mov    %esp,%ebp
+  801dd7:	57                   	push   %edi
+  801dd8:	56                   	push   %esi
+  801dd9:	53                   	push   %ebx
+  801dda:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801ddd:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801de4:	78 37                	js     801e1d <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  801de6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801ded:	74 7a                	je     801e69 <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  801def:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801df4:	8b 55 08             	mov    0x8(%ebp),%edx
+  801df7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801dfa:	b8 15 00 00 00       	mov    $0x15,%eax
+  801dff:	89 df                	mov    %ebx,%edi
+  801e01:	89 de                	mov    %ebx,%esi
+  801e03:	55                   	push   %ebp
+  801e04:	68 0d 1e 80 00       	push   $0x801e0d
+  801e09:	89 e5                	mov    %esp,%ebp
+  801e0b:	0f 34                	sysenter
+  801e0d:	83 c4 04             	add    $0x4,%esp
+  801e10:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801e11:	85 c0                	test   %eax,%eax
+  801e13:	7f 6c                	jg     801e81 <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  801e15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e18:	5b                   	pop    %ebx
+  801e19:	5e                   	pop    %esi
+  801e1a:	5f                   	pop    %edi
+  801e1b:	5d                   	pop    %ebp
+  801e1c:	c3                   	ret
+  801e1d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e22:	0f a2                	cpuid
+		return 0;
+  801e24:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801e29:	f6 c6 08             	test   $0x8,%dh
+  801e2c:	74 15                	je     801e43 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e2e:	89 c2                	mov    %eax,%edx
+  801e30:	c1 ea 08             	shr    $0x8,%edx
+  801e33:	83 e2 0f             	and    $0xf,%edx
+  801e36:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e3b:	83 fa 06             	cmp    $0x6,%edx
+  801e3e:	74 0e                	je     801e4e <sys_shm_create+0x7a>
+  801e40:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801e43:	0f b6 c9             	movzbl %cl,%ecx
+  801e46:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801e4c:	eb 98                	jmp    801de6 <sys_shm_create+0x12>
+  801e4e:	89 c2                	mov    %eax,%edx
+  801e50:	c1 ea 04             	shr    $0x4,%edx
+  801e53:	83 e2 0f             	and    $0xf,%edx
+  801e56:	83 fa 02             	cmp    $0x2,%edx
+  801e59:	77 e5                	ja     801e40 <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  801e5b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e5e:	83 f8 02             	cmp    $0x2,%eax
+  801e61:	0f 97 c1             	seta   %cl
+  801e64:	0f b6 c9             	movzbl %cl,%ecx
+  801e67:	eb d7                	jmp    801e40 <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  801e69:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e6e:	b8 15 00 00 00       	mov    $0x15,%eax
+  801e73:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e76:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e79:	89 df                	mov    %ebx,%edi
+  801e7b:	89 de                	mov    %ebx,%esi
+  801e7d:	cd 30                	int    $0x30
+  801e7f:	eb 90                	jmp    801e11 <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801e81:	83 ec 0c             	sub    $0xc,%esp
+  801e84:	50                   	push   %eax
+  801e85:	6a 15                	push   $0x15
+  801e87:	68 59 2e 80 00       	push   $0x802e59
+  801e8c:	6a 4a                	push   $0x4a
+  801e8e:	68 76 2e 80 00       	push   $0x802e76
+  801e93:	e8 2d 0a 00 00       	call   8028c5 <_panic>
+
+00801e98 <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  801e98:	55                   	push   %ebp
+  801e99:	89 e5                	mov    %esp,%ebp
+  801e9b:	57                   	push   %edi
+  801e9c:	56                   	push   %esi
+  801e9d:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801e9e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801ea5:	78 32                	js     801ed9 <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  801ea7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801eae:	74 75                	je     801f25 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801eb0:	8b 55 08             	mov    0x8(%ebp),%edx
+  801eb3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801eb6:	b8 16 00 00 00       	mov    $0x16,%eax
+  801ebb:	be 00 00 00 00       	mov    $0x0,%esi
+  801ec0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ec3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ec6:	55                   	push   %ebp
+  801ec7:	68 d0 1e 80 00       	push   $0x801ed0
+  801ecc:	89 e5                	mov    %esp,%ebp
+  801ece:	0f 34                	sysenter
+  801ed0:	83 c4 04             	add    $0x4,%esp
+  801ed3:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  801ed4:	5b                   	pop    %ebx
+  801ed5:	5e                   	pop    %esi
+  801ed6:	5f                   	pop    %edi
+  801ed7:	5d                   	pop    %ebp
+  801ed8:	c3                   	ret
+  801ed9:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ede:	0f a2                	cpuid
+		return 0;
+  801ee0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801ee5:	f6 c6 08             	test   $0x8,%dh
+  801ee8:	74 15                	je     801eff <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801eea:	89 c2                	mov    %eax,%edx
+  801eec:	c1 ea 08             	shr    $0x8,%edx
+  801eef:	83 e2 0f             	and    $0xf,%edx
+  801ef2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ef7:	83 fa 06             	cmp    $0x6,%edx
+  801efa:	74 0e                	je     801f0a <sys_shm_attach+0x72>
+  801efc:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801eff:	0f b6 c9             	movzbl %cl,%ecx
+  801f02:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801f08:	eb 9d                	jmp    801ea7 <sys_shm_attach+0xf>
+  801f0a:	89 c2                	mov    %eax,%edx
+  801f0c:	c1 ea 04             	shr    $0x4,%edx
+  801f0f:	83 e2 0f             	and    $0xf,%edx
+  801f12:	83 fa 02             	cmp    $0x2,%edx
+  801f15:	77 e5                	ja     801efc <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  801f17:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f1a:	83 f8 02             	cmp    $0x2,%eax
+  801f1d:	0f 97 c1             	seta   %cl
+  801f20:	0f b6 c9             	movzbl %cl,%ecx
+  801f23:	eb d7                	jmp    801efc <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  801f25:	b8 16 00 00 00       	mov    $0x16,%eax
+  801f2a:	be 00 00 00 00       	mov    $0x0,%esi
+  801f2f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f32:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f35:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f38:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801f3b:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  801f3d:	eb 95                	jmp    801ed4 <sys_shm_attach+0x3c>
+
+00801f3f <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  801f3f:	55                   	push   %ebp
+  801f40:	89 e5                	mov    %esp,%ebp
+  801f42:	57                   	push   %edi
+  801f43:	56                   	push   %esi
+  801f44:	53                   	push   %ebx
+  801f45:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801f48:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801f4f:	78 38                	js     801f89 <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  801f51:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801f58:	74 7b                	je     801fd5 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  801f5a:	be 00 00 00 00       	mov    $0x0,%esi
+  801f5f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f62:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f65:	b8 17 00 00 00       	mov    $0x17,%eax
+  801f6a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f6d:	89 f7                	mov    %esi,%edi
+  801f6f:	55                   	push   %ebp
+  801f70:	68 79 1f 80 00       	push   $0x801f79
+  801f75:	89 e5                	mov    %esp,%ebp
+  801f77:	0f 34                	sysenter
+  801f79:	83 c4 04             	add    $0x4,%esp
+  801f7c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801f7d:	85 c0                	test   %eax,%eax
+  801f7f:	7f 6d                	jg     801fee <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  801f81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f84:	5b                   	pop    %ebx
+  801f85:	5e                   	pop    %esi
+  801f86:	5f                   	pop    %edi
+  801f87:	5d                   	pop    %ebp
+  801f88:	c3                   	ret
+  801f89:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f8e:	0f a2                	cpuid
+		return 0;
+  801f90:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801f95:	f6 c6 08             	test   $0x8,%dh
+  801f98:	74 15                	je     801faf <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f9a:	89 c2                	mov    %eax,%edx
+  801f9c:	c1 ea 08             	shr    $0x8,%edx
+  801f9f:	83 e2 0f             	and    $0xf,%edx
+  801fa2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801fa7:	83 fa 06             	cmp    $0x6,%edx
+  801faa:	74 0e                	je     801fba <sys_shm_detach+0x7b>
+  801fac:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801faf:	0f b6 c9             	movzbl %cl,%ecx
+  801fb2:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801fb8:	eb 97                	jmp    801f51 <sys_shm_detach+0x12>
+  801fba:	89 c2                	mov    %eax,%edx
+  801fbc:	c1 ea 04             	shr    $0x4,%edx
+  801fbf:	83 e2 0f             	and    $0xf,%edx
+  801fc2:	83 fa 02             	cmp    $0x2,%edx
+  801fc5:	77 e5                	ja     801fac <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  801fc7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fca:	83 f8 02             	cmp    $0x2,%eax
+  801fcd:	0f 97 c1             	seta   %cl
+  801fd0:	0f b6 c9             	movzbl %cl,%ecx
+  801fd3:	eb d7                	jmp    801fac <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  801fd5:	be 00 00 00 00       	mov    $0x0,%esi
+  801fda:	b8 17 00 00 00       	mov    $0x17,%eax
+  801fdf:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fe2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fe5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801fe8:	89 f7                	mov    %esi,%edi
+  801fea:	cd 30                	int    $0x30
+  801fec:	eb 8f                	jmp    801f7d <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801fee:	83 ec 0c             	sub    $0xc,%esp
+  801ff1:	50                   	push   %eax
+  801ff2:	6a 17                	push   $0x17
+  801ff4:	68 59 2e 80 00       	push   $0x802e59
+  801ff9:	6a 4a                	push   $0x4a
+  801ffb:	68 76 2e 80 00       	push   $0x802e76
+  802000:	e8 c0 08 00 00       	call   8028c5 <_panic>
+
+00802005 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  802005:	55                   	push   %ebp
+  802006:	89 e5                	mov    %esp,%ebp
+  802008:	57                   	push   %edi
+  802009:	56                   	push   %esi
+  80200a:	53                   	push   %ebx
+  80200b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80200e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802015:	78 36                	js     80204d <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  802017:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80201e:	74 79                	je     802099 <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  802020:	8b 55 08             	mov    0x8(%ebp),%edx
+  802023:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802028:	b8 18 00 00 00       	mov    $0x18,%eax
+  80202d:	89 cb                	mov    %ecx,%ebx
+  80202f:	89 cf                	mov    %ecx,%edi
+  802031:	89 ce                	mov    %ecx,%esi
+  802033:	55                   	push   %ebp
+  802034:	68 3d 20 80 00       	push   $0x80203d
+  802039:	89 e5                	mov    %esp,%ebp
+  80203b:	0f 34                	sysenter
+  80203d:	83 c4 04             	add    $0x4,%esp
+  802040:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802041:	85 c0                	test   %eax,%eax
+  802043:	7f 6b                	jg     8020b0 <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  802045:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802048:	5b                   	pop    %ebx
+  802049:	5e                   	pop    %esi
+  80204a:	5f                   	pop    %edi
+  80204b:	5d                   	pop    %ebp
+  80204c:	c3                   	ret
+  80204d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802052:	0f a2                	cpuid
+		return 0;
+  802054:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802059:	f6 c6 08             	test   $0x8,%dh
+  80205c:	74 15                	je     802073 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80205e:	89 c2                	mov    %eax,%edx
+  802060:	c1 ea 08             	shr    $0x8,%edx
+  802063:	83 e2 0f             	and    $0xf,%edx
+  802066:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80206b:	83 fa 06             	cmp    $0x6,%edx
+  80206e:	74 0e                	je     80207e <sys_shm_remove+0x79>
+  802070:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802073:	0f b6 c9             	movzbl %cl,%ecx
+  802076:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80207c:	eb 99                	jmp    802017 <sys_shm_remove+0x12>
+  80207e:	89 c2                	mov    %eax,%edx
+  802080:	c1 ea 04             	shr    $0x4,%edx
+  802083:	83 e2 0f             	and    $0xf,%edx
+  802086:	83 fa 02             	cmp    $0x2,%edx
+  802089:	77 e5                	ja     802070 <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  80208b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80208e:	83 f8 02             	cmp    $0x2,%eax
+  802091:	0f 97 c1             	seta   %cl
+  802094:	0f b6 c9             	movzbl %cl,%ecx
+  802097:	eb d7                	jmp    802070 <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  802099:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80209e:	b8 18 00 00 00       	mov    $0x18,%eax
+  8020a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020a6:	89 cb                	mov    %ecx,%ebx
+  8020a8:	89 cf                	mov    %ecx,%edi
+  8020aa:	89 ce                	mov    %ecx,%esi
+  8020ac:	cd 30                	int    $0x30
+  8020ae:	eb 91                	jmp    802041 <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8020b0:	83 ec 0c             	sub    $0xc,%esp
+  8020b3:	50                   	push   %eax
+  8020b4:	6a 18                	push   $0x18
+  8020b6:	68 59 2e 80 00       	push   $0x802e59
+  8020bb:	6a 4a                	push   $0x4a
+  8020bd:	68 76 2e 80 00       	push   $0x802e76
+  8020c2:	e8 fe 07 00 00       	call   8028c5 <_panic>
+
+008020c7 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  8020c7:	55                   	push   %ebp
+  8020c8:	89 e5                	mov    %esp,%ebp
+  8020ca:	57                   	push   %edi
+  8020cb:	56                   	push   %esi
+  8020cc:	53                   	push   %ebx
+  8020cd:	83 ec 0c             	sub    $0xc,%esp
+  8020d0:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020d3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8020d6:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  8020d9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8020e0:	78 32                	js     802114 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  8020e2:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8020e9:	74 75                	je     802160 <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  8020eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020f1:	b8 20 00 00 00       	mov    $0x20,%eax
+  8020f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8020fb:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8020fe:	55                   	push   %ebp
+  8020ff:	68 08 21 80 00       	push   $0x802108
+  802104:	89 e5                	mov    %esp,%ebp
+  802106:	0f 34                	sysenter
+  802108:	83 c4 04             	add    $0x4,%esp
+  80210b:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  80210c:	83 c4 0c             	add    $0xc,%esp
+  80210f:	5b                   	pop    %ebx
+  802110:	5e                   	pop    %esi
+  802111:	5f                   	pop    %edi
+  802112:	5d                   	pop    %ebp
+  802113:	c3                   	ret
+  802114:	b8 01 00 00 00       	mov    $0x1,%eax
+  802119:	0f a2                	cpuid
+		return 0;
+  80211b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802120:	f6 c6 08             	test   $0x8,%dh
+  802123:	74 15                	je     80213a <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802125:	89 c2                	mov    %eax,%edx
+  802127:	c1 ea 08             	shr    $0x8,%edx
+  80212a:	83 e2 0f             	and    $0xf,%edx
+  80212d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802132:	83 fa 06             	cmp    $0x6,%edx
+  802135:	74 0e                	je     802145 <sys_futex_wait+0x7e>
+  802137:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80213a:	0f b6 c9             	movzbl %cl,%ecx
+  80213d:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802143:	eb 9d                	jmp    8020e2 <sys_futex_wait+0x1b>
+  802145:	89 c2                	mov    %eax,%edx
+  802147:	c1 ea 04             	shr    $0x4,%edx
+  80214a:	83 e2 0f             	and    $0xf,%edx
+  80214d:	83 fa 02             	cmp    $0x2,%edx
+  802150:	77 e5                	ja     802137 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  802152:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802155:	83 f8 02             	cmp    $0x2,%eax
+  802158:	0f 97 c1             	seta   %cl
+  80215b:	0f b6 c9             	movzbl %cl,%ecx
+  80215e:	eb d7                	jmp    802137 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  802160:	b8 20 00 00 00       	mov    $0x20,%eax
+  802165:	be 00 00 00 00       	mov    $0x0,%esi
+  80216a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80216d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802170:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802173:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  802175:	eb 95                	jmp    80210c <sys_futex_wait+0x45>
+
+00802177 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  802177:	55                   	push   %ebp
+  802178:	89 e5                	mov    %esp,%ebp
+  80217a:	57                   	push   %edi
+  80217b:	56                   	push   %esi
+  80217c:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80217d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802184:	78 30                	js     8021b6 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  802186:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80218d:	74 73                	je     802202 <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  80218f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802194:	8b 55 08             	mov    0x8(%ebp),%edx
+  802197:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80219a:	b8 21 00 00 00       	mov    $0x21,%eax
+  80219f:	89 df                	mov    %ebx,%edi
+  8021a1:	89 de                	mov    %ebx,%esi
+  8021a3:	55                   	push   %ebp
+  8021a4:	68 ad 21 80 00       	push   $0x8021ad
+  8021a9:	89 e5                	mov    %esp,%ebp
+  8021ab:	0f 34                	sysenter
+  8021ad:	83 c4 04             	add    $0x4,%esp
+  8021b0:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8021b1:	5b                   	pop    %ebx
+  8021b2:	5e                   	pop    %esi
+  8021b3:	5f                   	pop    %edi
+  8021b4:	5d                   	pop    %ebp
+  8021b5:	c3                   	ret
+  8021b6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021bb:	0f a2                	cpuid
+		return 0;
+  8021bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8021c2:	f6 c6 08             	test   $0x8,%dh
+  8021c5:	74 15                	je     8021dc <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021c7:	89 c2                	mov    %eax,%edx
+  8021c9:	c1 ea 08             	shr    $0x8,%edx
+  8021cc:	83 e2 0f             	and    $0xf,%edx
+  8021cf:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8021d4:	83 fa 06             	cmp    $0x6,%edx
+  8021d7:	74 0e                	je     8021e7 <sys_futex_wake+0x70>
+  8021d9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8021dc:	0f b6 c9             	movzbl %cl,%ecx
+  8021df:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8021e5:	eb 9f                	jmp    802186 <sys_futex_wake+0xf>
+  8021e7:	89 c2                	mov    %eax,%edx
+  8021e9:	c1 ea 04             	shr    $0x4,%edx
+  8021ec:	83 e2 0f             	and    $0xf,%edx
+  8021ef:	83 fa 02             	cmp    $0x2,%edx
+  8021f2:	77 e5                	ja     8021d9 <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  8021f4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021f7:	83 f8 02             	cmp    $0x2,%eax
+  8021fa:	0f 97 c1             	seta   %cl
+  8021fd:	0f b6 c9             	movzbl %cl,%ecx
+  802200:	eb d7                	jmp    8021d9 <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  802202:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802207:	b8 21 00 00 00       	mov    $0x21,%eax
+  80220c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80220f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802212:	89 df                	mov    %ebx,%edi
+  802214:	89 de                	mov    %ebx,%esi
+  802216:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  802218:	eb 97                	jmp    8021b1 <sys_futex_wake+0x3a>
+
+0080221a <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  80221a:	55                   	push   %ebp
+  80221b:	89 e5                	mov    %esp,%ebp
+  80221d:	57                   	push   %edi
+  80221e:	56                   	push   %esi
+  80221f:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802220:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802227:	78 2e                	js     802257 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  802229:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802230:	74 71                	je     8022a3 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  802232:	ba 00 00 00 00       	mov    $0x0,%edx
+  802237:	b8 22 00 00 00       	mov    $0x22,%eax
+  80223c:	89 d1                	mov    %edx,%ecx
+  80223e:	89 d3                	mov    %edx,%ebx
+  802240:	89 d7                	mov    %edx,%edi
+  802242:	89 d6                	mov    %edx,%esi
+  802244:	55                   	push   %ebp
+  802245:	68 4e 22 80 00       	push   $0x80224e
+  80224a:	89 e5                	mov    %esp,%ebp
+  80224c:	0f 34                	sysenter
+  80224e:	83 c4 04             	add    $0x4,%esp
+  802251:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  802252:	5b                   	pop    %ebx
+  802253:	5e                   	pop    %esi
+  802254:	5f                   	pop    %edi
+  802255:	5d                   	pop    %ebp
+  802256:	c3                   	ret
+  802257:	b8 01 00 00 00       	mov    $0x1,%eax
+  80225c:	0f a2                	cpuid
+		return 0;
+  80225e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802263:	f6 c6 08             	test   $0x8,%dh
+  802266:	74 15                	je     80227d <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802268:	89 c2                	mov    %eax,%edx
+  80226a:	c1 ea 08             	shr    $0x8,%edx
+  80226d:	83 e2 0f             	and    $0xf,%edx
+  802270:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802275:	83 fa 06             	cmp    $0x6,%edx
+  802278:	74 0e                	je     802288 <sys_ep_create+0x6e>
+  80227a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80227d:	0f b6 c9             	movzbl %cl,%ecx
+  802280:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802286:	eb a1                	jmp    802229 <sys_ep_create+0xf>
+  802288:	89 c2                	mov    %eax,%edx
+  80228a:	c1 ea 04             	shr    $0x4,%edx
+  80228d:	83 e2 0f             	and    $0xf,%edx
+  802290:	83 fa 02             	cmp    $0x2,%edx
+  802293:	77 e5                	ja     80227a <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  802295:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802298:	83 f8 02             	cmp    $0x2,%eax
+  80229b:	0f 97 c1             	seta   %cl
+  80229e:	0f b6 c9             	movzbl %cl,%ecx
+  8022a1:	eb d7                	jmp    80227a <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  8022a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022a8:	b8 22 00 00 00       	mov    $0x22,%eax
+  8022ad:	89 d1                	mov    %edx,%ecx
+  8022af:	89 d3                	mov    %edx,%ebx
+  8022b1:	89 d7                	mov    %edx,%edi
+  8022b3:	89 d6                	mov    %edx,%esi
+  8022b5:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  8022b7:	eb 99                	jmp    802252 <sys_ep_create+0x38>
+
+008022b9 <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  8022b9:	55                   	push   %ebp
+  8022ba:	89 e5                	mov    %esp,%ebp
+  8022bc:	57                   	push   %edi
+  8022bd:	56                   	push   %esi
+  8022be:	53                   	push   %ebx
+  8022bf:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8022c2:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8022c9:	78 36                	js     802301 <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  8022cb:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8022d2:	74 79                	je     80234d <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  8022d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022dc:	b8 23 00 00 00       	mov    $0x23,%eax
+  8022e1:	89 cb                	mov    %ecx,%ebx
+  8022e3:	89 cf                	mov    %ecx,%edi
+  8022e5:	89 ce                	mov    %ecx,%esi
+  8022e7:	55                   	push   %ebp
+  8022e8:	68 f1 22 80 00       	push   $0x8022f1
+  8022ed:	89 e5                	mov    %esp,%ebp
+  8022ef:	0f 34                	sysenter
+  8022f1:	83 c4 04             	add    $0x4,%esp
+  8022f4:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8022f5:	85 c0                	test   %eax,%eax
+  8022f7:	7f 6b                	jg     802364 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  8022f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022fc:	5b                   	pop    %ebx
+  8022fd:	5e                   	pop    %esi
+  8022fe:	5f                   	pop    %edi
+  8022ff:	5d                   	pop    %ebp
+  802300:	c3                   	ret
+  802301:	b8 01 00 00 00       	mov    $0x1,%eax
+  802306:	0f a2                	cpuid
+		return 0;
+  802308:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80230d:	f6 c6 08             	test   $0x8,%dh
+  802310:	74 15                	je     802327 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802312:	89 c2                	mov    %eax,%edx
+  802314:	c1 ea 08             	shr    $0x8,%edx
+  802317:	83 e2 0f             	and    $0xf,%edx
+  80231a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80231f:	83 fa 06             	cmp    $0x6,%edx
+  802322:	74 0e                	je     802332 <sys_ep_destroy+0x79>
+  802324:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802327:	0f b6 c9             	movzbl %cl,%ecx
+  80232a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802330:	eb 99                	jmp    8022cb <sys_ep_destroy+0x12>
+  802332:	89 c2                	mov    %eax,%edx
+  802334:	c1 ea 04             	shr    $0x4,%edx
+  802337:	83 e2 0f             	and    $0xf,%edx
+  80233a:	83 fa 02             	cmp    $0x2,%edx
+  80233d:	77 e5                	ja     802324 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  80233f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802342:	83 f8 02             	cmp    $0x2,%eax
+  802345:	0f 97 c1             	seta   %cl
+  802348:	0f b6 c9             	movzbl %cl,%ecx
+  80234b:	eb d7                	jmp    802324 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  80234d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802352:	b8 23 00 00 00       	mov    $0x23,%eax
+  802357:	8b 55 08             	mov    0x8(%ebp),%edx
+  80235a:	89 cb                	mov    %ecx,%ebx
+  80235c:	89 cf                	mov    %ecx,%edi
+  80235e:	89 ce                	mov    %ecx,%esi
+  802360:	cd 30                	int    $0x30
+  802362:	eb 91                	jmp    8022f5 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802364:	83 ec 0c             	sub    $0xc,%esp
+  802367:	50                   	push   %eax
+  802368:	6a 23                	push   $0x23
+  80236a:	68 59 2e 80 00       	push   $0x802e59
+  80236f:	6a 4a                	push   $0x4a
+  802371:	68 76 2e 80 00       	push   $0x802e76
+  802376:	e8 4a 05 00 00       	call   8028c5 <_panic>
+
+0080237b <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  80237b:	55                   	push   %ebp
+  80237c:	89 e5                	mov    %esp,%ebp
+  80237e:	57                   	push   %edi
+  80237f:	56                   	push   %esi
+  802380:	53                   	push   %ebx
+  802381:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802384:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80238b:	78 37                	js     8023c4 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  80238d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802394:	74 7a                	je     802410 <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  802396:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80239b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80239e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023a1:	b8 24 00 00 00       	mov    $0x24,%eax
+  8023a6:	89 df                	mov    %ebx,%edi
+  8023a8:	89 de                	mov    %ebx,%esi
+  8023aa:	55                   	push   %ebp
+  8023ab:	68 b4 23 80 00       	push   $0x8023b4
+  8023b0:	89 e5                	mov    %esp,%ebp
+  8023b2:	0f 34                	sysenter
+  8023b4:	83 c4 04             	add    $0x4,%esp
+  8023b7:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8023b8:	85 c0                	test   %eax,%eax
+  8023ba:	7f 6c                	jg     802428 <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  8023bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023bf:	5b                   	pop    %ebx
+  8023c0:	5e                   	pop    %esi
+  8023c1:	5f                   	pop    %edi
+  8023c2:	5d                   	pop    %ebp
+  8023c3:	c3                   	ret
+  8023c4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023c9:	0f a2                	cpuid
+		return 0;
+  8023cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8023d0:	f6 c6 08             	test   $0x8,%dh
+  8023d3:	74 15                	je     8023ea <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023d5:	89 c2                	mov    %eax,%edx
+  8023d7:	c1 ea 08             	shr    $0x8,%edx
+  8023da:	83 e2 0f             	and    $0xf,%edx
+  8023dd:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8023e2:	83 fa 06             	cmp    $0x6,%edx
+  8023e5:	74 0e                	je     8023f5 <sys_ep_grant+0x7a>
+  8023e7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8023ea:	0f b6 c9             	movzbl %cl,%ecx
+  8023ed:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8023f3:	eb 98                	jmp    80238d <sys_ep_grant+0x12>
+  8023f5:	89 c2                	mov    %eax,%edx
+  8023f7:	c1 ea 04             	shr    $0x4,%edx
+  8023fa:	83 e2 0f             	and    $0xf,%edx
+  8023fd:	83 fa 02             	cmp    $0x2,%edx
+  802400:	77 e5                	ja     8023e7 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  802402:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802405:	83 f8 02             	cmp    $0x2,%eax
+  802408:	0f 97 c1             	seta   %cl
+  80240b:	0f b6 c9             	movzbl %cl,%ecx
+  80240e:	eb d7                	jmp    8023e7 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  802410:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802415:	b8 24 00 00 00       	mov    $0x24,%eax
+  80241a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80241d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802420:	89 df                	mov    %ebx,%edi
+  802422:	89 de                	mov    %ebx,%esi
+  802424:	cd 30                	int    $0x30
+  802426:	eb 90                	jmp    8023b8 <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802428:	83 ec 0c             	sub    $0xc,%esp
+  80242b:	50                   	push   %eax
+  80242c:	6a 24                	push   $0x24
+  80242e:	68 59 2e 80 00       	push   $0x802e59
+  802433:	6a 4a                	push   $0x4a
+  802435:	68 76 2e 80 00       	push   $0x802e76
+  80243a:	e8 86 04 00 00       	call   8028c5 <_panic>
+
+0080243f <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  80243f:	55                   	push   %ebp
+  802440:	89 e5                	mov    %esp,%ebp
+  802442:	57                   	push   %edi
+  802443:	56                   	push   %esi
+  802444:	53                   	push   %ebx
+  802445:	83 ec 20             	sub    $0x20,%esp
+  802448:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  80244b:	8b 10                	mov    (%eax),%edx
+  80244d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802450:	8b 50 04             	mov    0x4(%eax),%edx
+  802453:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802456:	8b 50 08             	mov    0x8(%eax),%edx
+  802459:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  80245c:	8b 50 0c             	mov    0xc(%eax),%edx
+  80245f:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  802462:	8b 40 10             	mov    0x10(%eax),%eax
+  802465:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  802468:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  80246b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80246e:	b8 25 00 00 00       	mov    $0x25,%eax
+  802473:	55                   	push   %ebp
+  802474:	56                   	push   %esi
+  802475:	8b 0e                	mov    (%esi),%ecx
+  802477:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80247a:	8b 7e 08             	mov    0x8(%esi),%edi
+  80247d:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802480:	8b 76 0c             	mov    0xc(%esi),%esi
+  802483:	cd 30                	int    $0x30
+  802485:	87 34 24             	xchg   %esi,(%esp)
+  802488:	89 0e                	mov    %ecx,(%esi)
+  80248a:	89 5e 04             	mov    %ebx,0x4(%esi)
+  80248d:	89 7e 08             	mov    %edi,0x8(%esi)
+  802490:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802493:	8f 46 0c             	pop    0xc(%esi)
+  802496:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  802497:	83 c4 20             	add    $0x20,%esp
+  80249a:	5b                   	pop    %ebx
+  80249b:	5e                   	pop    %esi
+  80249c:	5f                   	pop    %edi
+  80249d:	5d                   	pop    %ebp
+  80249e:	c3                   	ret
+
+0080249f <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  80249f:	55                   	push   %ebp
+  8024a0:	89 e5                	mov    %esp,%ebp
+  8024a2:	57                   	push   %edi
+  8024a3:	56                   	push   %esi
+  8024a4:	53                   	push   %ebx
+  8024a5:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  8024a8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024ab:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  8024ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024b0:	b8 26 00 00 00       	mov    $0x26,%eax
+  8024b5:	55                   	push   %ebp
+  8024b6:	56                   	push   %esi
+  8024b7:	8b 0e                	mov    (%esi),%ecx
+  8024b9:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8024bc:	8b 7e 08             	mov    0x8(%esi),%edi
+  8024bf:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8024c2:	8b 76 0c             	mov    0xc(%esi),%esi
+  8024c5:	cd 30                	int    $0x30
+  8024c7:	87 34 24             	xchg   %esi,(%esp)
+  8024ca:	89 0e                	mov    %ecx,(%esi)
+  8024cc:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8024cf:	89 7e 08             	mov    %edi,0x8(%esi)
+  8024d2:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8024d5:	8f 46 0c             	pop    0xc(%esi)
+  8024d8:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  8024d9:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  8024dd:	74 0f                	je     8024ee <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  8024df:	85 c0                	test   %eax,%eax
+  8024e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024e6:	0f 48 d1             	cmovs  %ecx,%edx
+  8024e9:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8024ec:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  8024ee:	5b                   	pop    %ebx
+  8024ef:	5e                   	pop    %esi
+  8024f0:	5f                   	pop    %edi
+  8024f1:	5d                   	pop    %ebp
+  8024f2:	c3                   	ret
+
+008024f3 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  8024f3:	55                   	push   %ebp
+  8024f4:	89 e5                	mov    %esp,%ebp
+  8024f6:	57                   	push   %edi
+  8024f7:	56                   	push   %esi
+  8024f8:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8024f9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802500:	78 2f                	js     802531 <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  802502:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802509:	74 72                	je     80257d <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  80250b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80250e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802513:	b8 27 00 00 00       	mov    $0x27,%eax
+  802518:	89 cb                	mov    %ecx,%ebx
+  80251a:	89 cf                	mov    %ecx,%edi
+  80251c:	89 ce                	mov    %ecx,%esi
+  80251e:	55                   	push   %ebp
+  80251f:	68 28 25 80 00       	push   $0x802528
+  802524:	89 e5                	mov    %esp,%ebp
+  802526:	0f 34                	sysenter
+  802528:	83 c4 04             	add    $0x4,%esp
+  80252b:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  80252c:	5b                   	pop    %ebx
+  80252d:	5e                   	pop    %esi
+  80252e:	5f                   	pop    %edi
+  80252f:	5d                   	pop    %ebp
+  802530:	c3                   	ret
+  802531:	b8 01 00 00 00       	mov    $0x1,%eax
+  802536:	0f a2                	cpuid
+		return 0;
+  802538:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80253d:	f6 c6 08             	test   $0x8,%dh
+  802540:	74 15                	je     802557 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802542:	89 c2                	mov    %eax,%edx
+  802544:	c1 ea 08             	shr    $0x8,%edx
+  802547:	83 e2 0f             	and    $0xf,%edx
+  80254a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80254f:	83 fa 06             	cmp    $0x6,%edx
+  802552:	74 0e                	je     802562 <sys_sysring_setup+0x6f>
+  802554:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802557:	0f b6 c9             	movzbl %cl,%ecx
+  80255a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802560:	eb a0                	jmp    802502 <sys_sysring_setup+0xf>
+  802562:	89 c2                	mov    %eax,%edx
+  802564:	c1 ea 04             	shr    $0x4,%edx
+  802567:	83 e2 0f             	and    $0xf,%edx
+  80256a:	83 fa 02             	cmp    $0x2,%edx
+  80256d:	77 e5                	ja     802554 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  80256f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802572:	83 f8 02             	cmp    $0x2,%eax
+  802575:	0f 97 c1             	seta   %cl
+  802578:	0f b6 c9             	movzbl %cl,%ecx
+  80257b:	eb d7                	jmp    802554 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  80257d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802582:	b8 27 00 00 00       	mov    $0x27,%eax
+  802587:	8b 55 08             	mov    0x8(%ebp),%edx
+  80258a:	89 cb                	mov    %ecx,%ebx
+  80258c:	89 cf                	mov    %ecx,%edi
+  80258e:	89 ce                	mov    %ecx,%esi
+  802590:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  802592:	eb 98                	jmp    80252c <sys_sysring_setup+0x39>
+
+00802594 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  802594:	55                   	push   %ebp
+  802595:	89 e5                	mov    %esp,%ebp
+  802597:	57                   	push   %edi
+  802598:	56                   	push   %esi
+  802599:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80259a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8025a1:	78 2e                	js     8025d1 <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  8025a3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8025aa:	74 71                	je     80261d <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  8025ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025b1:	b8 28 00 00 00       	mov    $0x28,%eax
+  8025b6:	89 d1                	mov    %edx,%ecx
+  8025b8:	89 d3                	mov    %edx,%ebx
+  8025ba:	89 d7                	mov    %edx,%edi
+  8025bc:	89 d6                	mov    %edx,%esi
+  8025be:	55                   	push   %ebp
+  8025bf:	68 c8 25 80 00       	push   $0x8025c8
+  8025c4:	89 e5                	mov    %esp,%ebp
+  8025c6:	0f 34                	sysenter
+  8025c8:	83 c4 04             	add    $0x4,%esp
+  8025cb:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8025cc:	5b                   	pop    %ebx
+  8025cd:	5e                   	pop    %esi
+  8025ce:	5f                   	pop    %edi
+  8025cf:	5d                   	pop    %ebp
+  8025d0:	c3                   	ret
+  8025d1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025d6:	0f a2                	cpuid
+		return 0;
+  8025d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8025dd:	f6 c6 08             	test   $0x8,%dh
+  8025e0:	74 15                	je     8025f7 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025e2:	89 c2                	mov    %eax,%edx
+  8025e4:	c1 ea 08             	shr    $0x8,%edx
+  8025e7:	83 e2 0f             	and    $0xf,%edx
+  8025ea:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8025ef:	83 fa 06             	cmp    $0x6,%edx
+  8025f2:	74 0e                	je     802602 <sys_sysring_enter+0x6e>
+  8025f4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8025f7:	0f b6 c9             	movzbl %cl,%ecx
+  8025fa:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802600:	eb a1                	jmp    8025a3 <sys_sysring_enter+0xf>
+  802602:	89 c2                	mov    %eax,%edx
+  802604:	c1 ea 04             	shr    $0x4,%edx
+  802607:	83 e2 0f             	and    $0xf,%edx
+  80260a:	83 fa 02             	cmp    $0x2,%edx
+  80260d:	77 e5                	ja     8025f4 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  80260f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802612:	83 f8 02             	cmp    $0x2,%eax
+  802615:	0f 97 c1             	seta   %cl
+  802618:	0f b6 c9             	movzbl %cl,%ecx
+  80261b:	eb d7                	jmp    8025f4 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  80261d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802622:	b8 28 00 00 00       	mov    $0x28,%eax
+  802627:	89 d1                	mov    %edx,%ecx
+  802629:	89 d3                	mov    %edx,%ebx
+  80262b:	89 d7                	mov    %edx,%edi
+  80262d:	89 d6                	mov    %edx,%esi
+  80262f:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  802631:	eb 99                	jmp    8025cc <sys_sysring_enter+0x38>
+
+00802633 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802633:	55                   	push   %ebp
+  802634:	89 e5                	mov    %esp,%ebp
+  802636:	56                   	push   %esi
+  802637:	53                   	push   %ebx
+  802638:	8b 75 08             	mov    0x8(%ebp),%esi
+  80263b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80263e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if ((r = sys_ipc_recv(pg ? pg : (void *) UTOP)) < 0) {
+  802641:	85 c0                	test   %eax,%eax
+  802643:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802648:	0f 44 c2             	cmove  %edx,%eax
+  80264b:	83 ec 0c             	sub    $0xc,%esp
+  80264e:	50                   	push   %eax
+  80264f:	e8 31 f2 ff ff       	call   801885 <sys_ipc_recv>
+  802654:	83 c4 10             	add    $0x10,%esp
+  802657:	85 c0                	test   %eax,%eax
+  802659:	78 34                	js     80268f <ipc_recv+0x5c>
+			*from_env_store = 0;
+		if (perm_store)
+			*perm_store = 0;
+		return r;
+	}
+	if (from_env_store)
+  80265b:	85 f6                	test   %esi,%esi
+  80265d:	74 0d                	je     80266c <ipc_recv+0x39>
+		*from_env_store = thisenv->env_ipc_from;
+  80265f:	a1 08 30 80 00       	mov    0x803008,%eax
+  802664:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  80266a:	89 06                	mov    %eax,(%esi)
+	if (perm_store)
+  80266c:	85 db                	test   %ebx,%ebx
+  80266e:	74 0d                	je     80267d <ipc_recv+0x4a>
+		*perm_store = thisenv->env_ipc_perm;
+  802670:	a1 08 30 80 00       	mov    0x803008,%eax
+  802675:	8b 80 9c 00 00 00    	mov    0x9c(%eax),%eax
+  80267b:	89 03                	mov    %eax,(%ebx)
+	return thisenv->env_ipc_msg.m_w[0];
+  80267d:	a1 08 30 80 00       	mov    0x803008,%eax
+  802682:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802688:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80268b:	5b                   	pop    %ebx
+  80268c:	5e                   	pop    %esi
+  80268d:	5d                   	pop    %ebp
+  80268e:	c3                   	ret
+		if (from_env_store)
+  80268f:	85 f6                	test   %esi,%esi
+  802691:	74 06                	je     802699 <ipc_recv+0x66>
+			*from_env_store = 0;
+  802693:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802699:	85 db                	test   %ebx,%ebx
+  80269b:	74 eb                	je     802688 <ipc_recv+0x55>
+			*perm_store = 0;
+  80269d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8026a3:	eb e3                	jmp    802688 <ipc_recv+0x55>
+
+008026a5 <ipc_send>:
+//
+// The kernel queues us behind any other senders until 'toenv'
+// receives, so we only come back to retry if its queue was full.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8026a5:	55                   	push   %ebp
+  8026a6:	89 e5                	mov    %esp,%ebp
+  8026a8:	57                   	push   %edi
+  8026a9:	56                   	push   %esi
+  8026aa:	53                   	push   %ebx
+  8026ab:	83 ec 0c             	sub    $0xc,%esp
+  8026ae:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8026b1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8026b4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_send(to_env, val, pg ? pg : (void *) UTOP, perm))
+  8026b7:	85 db                	test   %ebx,%ebx
+  8026b9:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8026be:	0f 44 d8             	cmove  %eax,%ebx
+  8026c1:	eb 05                	jmp    8026c8 <ipc_send+0x23>
+	       == -E_AGAIN)
+		sys_yield();
+  8026c3:	e8 fe eb ff ff       	call   8012c6 <sys_yield>
+	while ((r = sys_ipc_send(to_env, val, pg ? pg : (void *) UTOP, perm))
+  8026c8:	ff 75 14             	push   0x14(%ebp)
+  8026cb:	53                   	push   %ebx
+  8026cc:	56                   	push   %esi
+  8026cd:	57                   	push   %edi
+  8026ce:	e8 0b f1 ff ff       	call   8017de <sys_ipc_send>
+	       == -E_AGAIN)
+  8026d3:	83 c4 10             	add    $0x10,%esp
+  8026d6:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  8026d9:	74 e8                	je     8026c3 <ipc_send+0x1e>
+	if (r < 0)
+  8026db:	85 c0                	test   %eax,%eax
+  8026dd:	78 08                	js     8026e7 <ipc_send+0x42>
+		panic("ipc_send: %e", r);
+}
+  8026df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026e2:	5b                   	pop    %ebx
+  8026e3:	5e                   	pop    %esi
+  8026e4:	5f                   	pop    %edi
+  8026e5:	5d                   	pop    %ebp
+  8026e6:	c3                   	ret
+		panic("ipc_send: %e", r);
+  8026e7:	50                   	push   %eax
+  8026e8:	68 84 2e 80 00       	push   $0x802e84
+  8026ed:	6a 3a                	push   $0x3a
+  8026ef:	68 91 2e 80 00       	push   $0x802e91
+  8026f4:	e8 cc 01 00 00       	call   8028c5 <_panic>
+
+008026f9 <ipc_send_range>:
+
+// Like ipc_send, but send the 'npages' contiguous pages at 'pg' in one
+// message.  The receiver maps as many as fit in its window.
+void
+ipc_send_range(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8026f9:	55                   	push   %ebp
+  8026fa:	89 e5                	mov    %esp,%ebp
+  8026fc:	57                   	push   %edi
+  8026fd:	56                   	push   %esi
+  8026fe:	53                   	push   %ebx
+  8026ff:	83 ec 0c             	sub    $0xc,%esp
+  802702:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802705:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802708:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_send_range(to_env, val, pg, npages, perm))
+  80270b:	eb 05                	jmp    802712 <ipc_send_range+0x19>
+	       == -E_AGAIN)
+		sys_yield();
+  80270d:	e8 b4 eb ff ff       	call   8012c6 <sys_yield>
+	while ((r = sys_ipc_send_range(to_env, val, pg, npages, perm))
+  802712:	83 ec 0c             	sub    $0xc,%esp
+  802715:	ff 75 18             	push   0x18(%ebp)
+  802718:	ff 75 14             	push   0x14(%ebp)
+  80271b:	53                   	push   %ebx
+  80271c:	56                   	push   %esi
+  80271d:	57                   	push   %edi
+  80271e:	e8 24 f2 ff ff       	call   801947 <sys_ipc_send_range>
+	       == -E_AGAIN)
+  802723:	83 c4 20             	add    $0x20,%esp
+  802726:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802729:	74 e2                	je     80270d <ipc_send_range+0x14>
+	if (r < 0)
+  80272b:	85 c0                	test   %eax,%eax
+  80272d:	78 08                	js     802737 <ipc_send_range+0x3e>
+		panic("ipc_send_range: %e", r);
+}
+  80272f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802732:	5b                   	pop    %ebx
+  802733:	5e                   	pop    %esi
+  802734:	5f                   	pop    %edi
+  802735:	5d                   	pop    %ebp
+  802736:	c3                   	ret
+		panic("ipc_send_range: %e", r);
+  802737:	50                   	push   %eax
+  802738:	68 9b 2e 80 00       	push   $0x802e9b
+  80273d:	6a 48                	push   $0x48
+  80273f:	68 91 2e 80 00       	push   $0x802e91
+  802744:	e8 7c 01 00 00       	call   8028c5 <_panic>
+
+00802749 <ipc_recv_range>:
+// (which must not be null).  On return *npages holds the number of
+// pages received, which is 0 on error or if the sender sent none.
+int32_t
+ipc_recv_range(envid_t *from_env_store, void *pg, size_t *npages,
+	       int *perm_store)
+{
+  802749:	55                   	push   %ebp
+  80274a:	89 e5                	mov    %esp,%ebp
+  80274c:	57                   	push   %edi
+  80274d:	56                   	push   %esi
+  80274e:	53                   	push   %ebx
+  80274f:	83 ec 14             	sub    $0x14,%esp
+  802752:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802755:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802758:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if ((r = sys_ipc_recv_range(pg, *npages)) < 0) {
+  80275b:	ff 33                	push   (%ebx)
+  80275d:	ff 75 0c             	push   0xc(%ebp)
+  802760:	e8 85 f2 ff ff       	call   8019ea <sys_ipc_recv_range>
+  802765:	83 c4 10             	add    $0x10,%esp
+  802768:	85 c0                	test   %eax,%eax
+  80276a:	78 42                	js     8027ae <ipc_recv_range+0x65>
+		if (perm_store)
+			*perm_store = 0;
+		*npages = 0;
+		return r;
+	}
+	if (from_env_store)
+  80276c:	85 ff                	test   %edi,%edi
+  80276e:	74 0d                	je     80277d <ipc_recv_range+0x34>
+		*from_env_store = thisenv->env_ipc_from;
+  802770:	a1 08 30 80 00       	mov    0x803008,%eax
+  802775:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  80277b:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  80277d:	85 f6                	test   %esi,%esi
+  80277f:	74 0d                	je     80278e <ipc_recv_range+0x45>
+		*perm_store = thisenv->env_ipc_perm;
+  802781:	a1 08 30 80 00       	mov    0x803008,%eax
+  802786:	8b 80 9c 00 00 00    	mov    0x9c(%eax),%eax
+  80278c:	89 06                	mov    %eax,(%esi)
+	*npages = thisenv->env_ipc_npages;
+  80278e:	a1 08 30 80 00       	mov    0x803008,%eax
+  802793:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802799:	89 03                	mov    %eax,(%ebx)
+	return thisenv->env_ipc_msg.m_w[0];
+  80279b:	a1 08 30 80 00       	mov    0x803008,%eax
+  8027a0:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8027a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027a9:	5b                   	pop    %ebx
+  8027aa:	5e                   	pop    %esi
+  8027ab:	5f                   	pop    %edi
+  8027ac:	5d                   	pop    %ebp
+  8027ad:	c3                   	ret
+		if (from_env_store)
+  8027ae:	85 ff                	test   %edi,%edi
+  8027b0:	74 06                	je     8027b8 <ipc_recv_range+0x6f>
+			*from_env_store = 0;
+  8027b2:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  8027b8:	85 f6                	test   %esi,%esi
+  8027ba:	74 06                	je     8027c2 <ipc_recv_range+0x79>
+			*perm_store = 0;
+  8027bc:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		*npages = 0;
+  8027c2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		return r;
+  8027c8:	eb dc                	jmp    8027a6 <ipc_recv_range+0x5d>
+
+008027ca <ipc_send_msg>:
+// Send the IPC_MSG_WORDS words of 'msg' to 'to_env', in registers and
+// without a page.  Waits like ipc_send until 'to_env' takes them, and
+// panics on any error other than -E_AGAIN.
+void
+ipc_send_msg(envid_t to_env, const struct ipc_msg *msg)
+{
+  8027ca:	55                   	push   %ebp
+  8027cb:	89 e5                	mov    %esp,%ebp
+  8027cd:	56                   	push   %esi
+  8027ce:	53                   	push   %ebx
+  8027cf:	8b 75 08             	mov    0x8(%ebp),%esi
+  8027d2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_send_msg(to_env, msg)) == -E_AGAIN)
+  8027d5:	eb 05                	jmp    8027dc <ipc_send_msg+0x12>
+		sys_yield();
+  8027d7:	e8 ea ea ff ff       	call   8012c6 <sys_yield>
+	while ((r = sys_ipc_send_msg(to_env, msg)) == -E_AGAIN)
+  8027dc:	83 ec 08             	sub    $0x8,%esp
+  8027df:	53                   	push   %ebx
+  8027e0:	56                   	push   %esi
+  8027e1:	e8 3c f3 ff ff       	call   801b22 <sys_ipc_send_msg>
+  8027e6:	83 c4 10             	add    $0x10,%esp
+  8027e9:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  8027ec:	74 e9                	je     8027d7 <ipc_send_msg+0xd>
+	if (r < 0)
+  8027ee:	85 c0                	test   %eax,%eax
+  8027f0:	78 07                	js     8027f9 <ipc_send_msg+0x2f>
+		panic("ipc_send_msg: %e", r);
+}
+  8027f2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027f5:	5b                   	pop    %ebx
+  8027f6:	5e                   	pop    %esi
+  8027f7:	5d                   	pop    %ebp
+  8027f8:	c3                   	ret
+		panic("ipc_send_msg: %e", r);
+  8027f9:	50                   	push   %eax
+  8027fa:	68 ae 2e 80 00       	push   $0x802eae
+  8027ff:	6a 6f                	push   $0x6f
+  802801:	68 91 2e 80 00       	push   $0x802e91
+  802806:	e8 ba 00 00 00       	call   8028c5 <_panic>
+
+0080280b <ipc_recv_msg>:
+// ipc_call or plain ipc_send (whose value is word 0, and whose page is
+// not taken), it arrives in registers and needs no page.
+// Returns the sender's envid, < 0 on error.
+envid_t
+ipc_recv_msg(struct ipc_msg *msg)
+{
+  80280b:	55                   	push   %ebp
+  80280c:	89 e5                	mov    %esp,%ebp
+  80280e:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_reply_wait(0, msg);
+  802811:	ff 75 08             	push   0x8(%ebp)
+  802814:	6a 00                	push   $0x0
+  802816:	e8 cd f2 ff ff       	call   801ae8 <sys_ipc_reply_wait>
+}
+  80281b:	c9                   	leave
+  80281c:	c3                   	ret
+
+0080281d <ipc_call>:
+// ipc_reply_wait (or ipc_recv), and straight back when it replies.
+// Retries while to_env's queue is full.
+// Returns 0 on success, < 0 on error.
+int
+ipc_call(envid_t to_env, struct ipc_msg *msg)
+{
+  80281d:	55                   	push   %ebp
+  80281e:	89 e5                	mov    %esp,%ebp
+  802820:	56                   	push   %esi
+  802821:	53                   	push   %ebx
+  802822:	8b 75 08             	mov    0x8(%ebp),%esi
+  802825:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_call(to_env, msg)) == -E_AGAIN)
+  802828:	eb 05                	jmp    80282f <ipc_call+0x12>
+		sys_yield();
+  80282a:	e8 97 ea ff ff       	call   8012c6 <sys_yield>
+	while ((r = sys_ipc_call(to_env, msg)) == -E_AGAIN)
+  80282f:	83 ec 08             	sub    $0x8,%esp
+  802832:	53                   	push   %ebx
+  802833:	56                   	push   %esi
+  802834:	e8 75 f2 ff ff       	call   801aae <sys_ipc_call>
+  802839:	83 c4 10             	add    $0x10,%esp
+  80283c:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  80283f:	74 e9                	je     80282a <ipc_call+0xd>
+	return r;
+}
+  802841:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802844:	5b                   	pop    %ebx
+  802845:	5e                   	pop    %esi
+  802846:	5d                   	pop    %ebp
+  802847:	c3                   	ret
+
+00802848 <ipc_reply_wait>:
+//	}
+//
+// Returns the envid of the sender, < 0 on error.
+envid_t
+ipc_reply_wait(envid_t to_env, struct ipc_msg *msg)
+{
+  802848:	55                   	push   %ebp
+  802849:	89 e5                	mov    %esp,%ebp
+  80284b:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_reply_wait(to_env, msg);
+  80284e:	ff 75 0c             	push   0xc(%ebp)
+  802851:	ff 75 08             	push   0x8(%ebp)
+  802854:	e8 8f f2 ff ff       	call   801ae8 <sys_ipc_reply_wait>
+}
+  802859:	c9                   	leave
+  80285a:	c3                   	ret
+
+0080285b <ep_send>:
+
+// Send 'msg' to endpoint 'epid', waiting while its queue is full.
+// Returns 0 on success, < 0 if the endpoint is gone or not ours to use.
+int
+ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  80285b:	55                   	push   %ebp
+  80285c:	89 e5                	mov    %esp,%ebp
+  80285e:	56                   	push   %esi
+  80285f:	53                   	push   %ebx
+  802860:	8b 75 08             	mov    0x8(%ebp),%esi
+  802863:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ep_send(epid, msg)) == -E_AGAIN)
+  802866:	eb 05                	jmp    80286d <ep_send+0x12>
+		sys_yield();
+  802868:	e8 59 ea ff ff       	call   8012c6 <sys_yield>
+	while ((r = sys_ep_send(epid, msg)) == -E_AGAIN)
+  80286d:	83 ec 08             	sub    $0x8,%esp
+  802870:	53                   	push   %ebx
+  802871:	56                   	push   %esi
+  802872:	e8 c8 fb ff ff       	call   80243f <sys_ep_send>
+  802877:	83 c4 10             	add    $0x10,%esp
+  80287a:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  80287d:	74 e9                	je     802868 <ep_send+0xd>
+	return r;
+}
+  80287f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802882:	5b                   	pop    %ebx
+  802883:	5e                   	pop    %esi
+  802884:	5d                   	pop    %ebp
+  802885:	c3                   	ret
+
+00802886 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802886:	55                   	push   %ebp
+  802887:	89 e5                	mov    %esp,%ebp
+  802889:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80288c:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802891:	69 d0 68 01 00 00    	imul   $0x168,%eax,%edx
+  802897:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80289d:	8b 52 50             	mov    0x50(%edx),%edx
+  8028a0:	39 ca                	cmp    %ecx,%edx
+  8028a2:	74 11                	je     8028b5 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8028a4:	83 c0 01             	add    $0x1,%eax
+  8028a7:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8028ac:	75 e3                	jne    802891 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8028ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028b3:	eb 0e                	jmp    8028c3 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8028b5:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  8028bb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8028c0:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8028c3:	5d                   	pop    %ebp
+  8028c4:	c3                   	ret
+
+008028c5 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8028c5:	55                   	push   %ebp
+  8028c6:	89 e5                	mov    %esp,%ebp
+  8028c8:	57                   	push   %edi
+  8028c9:	56                   	push   %esi
+  8028ca:	53                   	push   %ebx
+  8028cb:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  8028d1:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  8028d4:	8b 1d 00 30 80 00    	mov    0x803000,%ebx
+  8028da:	e8 36 e6 ff ff       	call   800f15 <sys_getenvid>
+  8028df:	83 ec 04             	sub    $0x4,%esp
+  8028e2:	ff 75 0c             	push   0xc(%ebp)
+  8028e5:	ff 75 08             	push   0x8(%ebp)
+  8028e8:	53                   	push   %ebx
+  8028e9:	50                   	push   %eax
+  8028ea:	68 c0 2e 80 00       	push   $0x802ec0
+  8028ef:	68 00 01 00 00       	push   $0x100
+  8028f4:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  8028fa:	56                   	push   %esi
+  8028fb:	e8 2a de ff ff       	call   80072a <snprintf>
+  802900:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  802902:	83 c4 20             	add    $0x20,%esp
+  802905:	57                   	push   %edi
+  802906:	ff 75 10             	push   0x10(%ebp)
+  802909:	bf 00 01 00 00       	mov    $0x100,%edi
+  80290e:	89 f8                	mov    %edi,%eax
+  802910:	29 d8                	sub    %ebx,%eax
+  802912:	50                   	push   %eax
+  802913:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  802916:	50                   	push   %eax
+  802917:	e8 c0 dd ff ff       	call   8006dc <vsnprintf>
+  80291c:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  80291e:	83 c4 0c             	add    $0xc,%esp
+  802921:	68 6f 2b 80 00       	push   $0x802b6f
+  802926:	29 df                	sub    %ebx,%edi
+  802928:	57                   	push   %edi
+  802929:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  80292c:	50                   	push   %eax
+  80292d:	e8 f8 dd ff ff       	call   80072a <snprintf>
+	sys_cputs(buf, r);
+  802932:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  802935:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  802937:	53                   	push   %ebx
+  802938:	56                   	push   %esi
+  802939:	e8 d9 e3 ff ff       	call   800d17 <sys_cputs>
+  80293e:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802941:	cc                   	int3
+	while (1)
+  802942:	eb fd                	jmp    802941 <_panic+0x7c>
+
+00802944 <dm>:
+  802944:	55                   	push   %ebp
+  802945:	57                   	push   %edi
+  802946:	56                   	push   %esi
+  802947:	53                   	push   %ebx
+  802948:	83 ec 24             	sub    $0x24,%esp
+  80294b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80294f:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802953:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802957:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80295b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80295f:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802963:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802967:	b8 00 00 00 00       	mov    $0x0,%eax
+  80296c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802971:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802976:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80297d:	00 
+  80297e:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802985:	00 
+  802986:	89 fb                	mov    %edi,%ebx
+  802988:	eb 08                	jmp    802992 <dm+0x4e>
+  80298a:	83 e9 01             	sub    $0x1,%ecx
+  80298d:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802990:	74 68                	je     8029fa <dm+0xb6>
+  802992:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802996:	01 c0                	add    %eax,%eax
+  802998:	89 c6                	mov    %eax,%esi
+  80299a:	89 d7                	mov    %edx,%edi
+  80299c:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8029a0:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8029a4:	0f ad d0             	shrd   %cl,%edx,%eax
+  8029a7:	d3 ea                	shr    %cl,%edx
+  8029a9:	f6 c1 20             	test   $0x20,%cl
+  8029ac:	74 04                	je     8029b2 <dm+0x6e>
+  8029ae:	89 d0                	mov    %edx,%eax
+  8029b0:	31 d2                	xor    %edx,%edx
+  8029b2:	83 e0 01             	and    $0x1,%eax
+  8029b5:	89 04 24             	mov    %eax,(%esp)
+  8029b8:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8029bf:	00 
+  8029c0:	8b 04 24             	mov    (%esp),%eax
+  8029c3:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8029c7:	09 f0                	or     %esi,%eax
+  8029c9:	09 fa                	or     %edi,%edx
+  8029cb:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8029cf:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8029d3:	39 f0                	cmp    %esi,%eax
+  8029d5:	89 d5                	mov    %edx,%ebp
+  8029d7:	19 fd                	sbb    %edi,%ebp
+  8029d9:	72 af                	jb     80298a <dm+0x46>
+  8029db:	29 f0                	sub    %esi,%eax
+  8029dd:	19 fa                	sbb    %edi,%edx
+  8029df:	89 cf                	mov    %ecx,%edi
+  8029e1:	c1 ef 05             	shr    $0x5,%edi
+  8029e4:	83 e7 01             	and    $0x1,%edi
+  8029e7:	89 fe                	mov    %edi,%esi
+  8029e9:	83 f6 01             	xor    $0x1,%esi
+  8029ec:	d3 e6                	shl    %cl,%esi
+  8029ee:	d3 e7                	shl    %cl,%edi
+  8029f0:	09 74 24 18          	or     %esi,0x18(%esp)
+  8029f4:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8029f8:	eb 90                	jmp    80298a <dm+0x46>
+  8029fa:	85 db                	test   %ebx,%ebx
+  8029fc:	74 05                	je     802a03 <dm+0xbf>
+  8029fe:	89 03                	mov    %eax,(%ebx)
+  802a00:	89 53 04             	mov    %edx,0x4(%ebx)
+  802a03:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802a07:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802a0b:	83 c4 24             	add    $0x24,%esp
+  802a0e:	5b                   	pop    %ebx
+  802a0f:	5e                   	pop    %esi
+  802a10:	5f                   	pop    %edi
+  802a11:	5d                   	pop    %ebp
+  802a12:	c3                   	ret
+
+00802a13 <__udivdi3>:
+  802a13:	83 ec 08             	sub    $0x8,%esp
+  802a16:	6a 00                	push   $0x0
+  802a18:	ff 74 24 1c          	push   0x1c(%esp)
+  802a1c:	ff 74 24 1c          	push   0x1c(%esp)
+  802a20:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802a24:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802a28:	e8 17 ff ff ff       	call   802944 <dm>
+  802a2d:	83 c4 14             	add    $0x14,%esp
+  802a30:	c3                   	ret
+
+00802a31 <__umoddi3>:
+  802a31:	83 ec 18             	sub    $0x18,%esp
+  802a34:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802a38:	50                   	push   %eax
+  802a39:	ff 74 24 2c          	push   0x2c(%esp)
+  802a3d:	ff 74 24 2c          	push   0x2c(%esp)
+  802a41:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802a45:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802a49:	e8 f6 fe ff ff       	call   802944 <dm>
+  802a4e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802a52:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802a56:	83 c4 24             	add    $0x24,%esp
+  802a59:	c3                   	ret
+
+00802a5a <__divdi3>:
+  802a5a:	53                   	push   %ebx
+  802a5b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802a5f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802a63:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  802a67:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  802a6b:	85 d2                	test   %edx,%edx
+  802a6d:	78 15                	js     802a84 <__divdi3+0x2a>
+  802a6f:	85 db                	test   %ebx,%ebx
+  802a71:	78 34                	js     802aa7 <__divdi3+0x4d>
+  802a73:	83 ec 04             	sub    $0x4,%esp
+  802a76:	6a 00                	push   $0x0
+  802a78:	53                   	push   %ebx
+  802a79:	51                   	push   %ecx
+  802a7a:	e8 c5 fe ff ff       	call   802944 <dm>
+  802a7f:	83 c4 10             	add    $0x10,%esp
+  802a82:	eb 21                	jmp    802aa5 <__divdi3+0x4b>
+  802a84:	f7 d8                	neg    %eax
+  802a86:	83 d2 00             	adc    $0x0,%edx
+  802a89:	f7 da                	neg    %edx
+  802a8b:	85 db                	test   %ebx,%ebx
+  802a8d:	78 30                	js     802abf <__divdi3+0x65>
+  802a8f:	83 ec 04             	sub    $0x4,%esp
+  802a92:	6a 00                	push   $0x0
+  802a94:	53                   	push   %ebx
+  802a95:	51                   	push   %ecx
+  802a96:	e8 a9 fe ff ff       	call   802944 <dm>
+  802a9b:	83 c4 10             	add    $0x10,%esp
+  802a9e:	f7 d8                	neg    %eax
+  802aa0:	83 d2 00             	adc    $0x0,%edx
+  802aa3:	f7 da                	neg    %edx
+  802aa5:	5b                   	pop    %ebx
+  802aa6:	c3                   	ret
+  802aa7:	83 ec 04             	sub    $0x4,%esp
+  802aaa:	6a 00                	push   $0x0
+  802aac:	f7 d9                	neg    %ecx
+  802aae:	83 d3 00             	adc    $0x0,%ebx
+  802ab1:	f7 db                	neg    %ebx
+  802ab3:	53                   	push   %ebx
+  802ab4:	51                   	push   %ecx
+  802ab5:	e8 8a fe ff ff       	call   802944 <dm>
+  802aba:	83 c4 10             	add    $0x10,%esp
+  802abd:	eb df                	jmp    802a9e <__divdi3+0x44>
+  802abf:	83 ec 04             	sub    $0x4,%esp
+  802ac2:	6a 00                	push   $0x0
+  802ac4:	f7 d9                	neg    %ecx
+  802ac6:	83 d3 00             	adc    $0x0,%ebx
+  802ac9:	f7 db                	neg    %ebx
+  802acb:	53                   	push   %ebx
+  802acc:	51                   	push   %ecx
+  802acd:	e8 72 fe ff ff       	call   802944 <dm>
+  802ad2:	83 c4 10             	add    $0x10,%esp
+  802ad5:	eb ce                	jmp    802aa5 <__divdi3+0x4b>
+
+00802ad7 <__moddi3>:
+  802ad7:	55                   	push   %ebp
+  802ad8:	57                   	push   %edi
+  802ad9:	56                   	push   %esi
+  802ada:	53                   	push   %ebx
+  802adb:	83 ec 18             	sub    $0x18,%esp
+  802ade:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802ae2:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802ae6:	89 f1                	mov    %esi,%ecx
+  802ae8:	f7 d9                	neg    %ecx
+  802aea:	89 da                	mov    %ebx,%edx
+  802aec:	83 d2 00             	adc    $0x0,%edx
+  802aef:	f7 da                	neg    %edx
+  802af1:	0f 48 ce             	cmovs  %esi,%ecx
+  802af4:	0f 48 d3             	cmovs  %ebx,%edx
+  802af7:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802afb:	50                   	push   %eax
+  802afc:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802b00:	f7 de                	neg    %esi
+  802b02:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802b06:	83 d0 00             	adc    $0x0,%eax
+  802b09:	f7 d8                	neg    %eax
+  802b0b:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802b10:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802b15:	50                   	push   %eax
+  802b16:	56                   	push   %esi
+  802b17:	89 c8                	mov    %ecx,%eax
+  802b19:	e8 26 fe ff ff       	call   802944 <dm>
+  802b1e:	83 c4 10             	add    $0x10,%esp
+  802b21:	85 db                	test   %ebx,%ebx
+  802b23:	78 10                	js     802b35 <__moddi3+0x5e>
+  802b25:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802b29:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802b2d:	83 c4 14             	add    $0x14,%esp
+  802b30:	5b                   	pop    %ebx
+  802b31:	5e                   	pop    %esi
+  802b32:	5f                   	pop    %edi
+  802b33:	5d                   	pop    %ebp
+  802b34:	c3                   	ret
+  802b35:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802b39:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802b3d:	f7 d8                	neg    %eax
+  802b3f:	83 d2 00             	adc    $0x0,%edx
+  802b42:	f7 da                	neg    %edx
+  802b44:	eb e7                	jmp    802b2d <__moddi3+0x56>
@@ -0,0 +1,5313 @@
+
+obj/user/faultalloc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 99 00 00 00       	call   8000ca <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <handler>:
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	void *addr = (void*)utf->utf_fault_va;
+  80003a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80003d:	8b 18                	mov    (%eax),%ebx
+
+	cprintf("fault %x\n", addr);
+  80003f:	53                   	push   %ebx
+  800040:	68 80 29 80 00       	push   $0x802980
+  800045:	e8 ef 01 00 00       	call   800239 <cprintf>
+	if ((r = sys_page_alloc(0, ROUNDDOWN(addr, PGSIZE),
+  80004a:	83 c4 0c             	add    $0xc,%esp
+  80004d:	6a 07                	push   $0x7
+  80004f:	89 d8                	mov    %ebx,%eax
+  800051:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800056:	50                   	push   %eax
+  800057:	6a 00                	push   $0x0
+  800059:	e8 fe 0f 00 00       	call   80105c <sys_page_alloc>
+  80005e:	83 c4 10             	add    $0x10,%esp
+  800061:	85 c0                	test   %eax,%eax
+  800063:	78 16                	js     80007b <handler+0x48>
+				PTE_P|PTE_U|PTE_W)) < 0)
+		panic("allocating at %x in page fault handler: %e", addr, r);
+	snprintf((char*) addr, 100, "this string was faulted in at %x", addr);
+  800065:	53                   	push   %ebx
+  800066:	68 cc 29 80 00       	push   $0x8029cc
+  80006b:	6a 64                	push   $0x64
+  80006d:	53                   	push   %ebx
+  80006e:	e8 5f 07 00 00       	call   8007d2 <snprintf>
+}
+  800073:	83 c4 10             	add    $0x10,%esp
+  800076:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800079:	c9                   	leave
+  80007a:	c3                   	ret
+		panic("allocating at %x in page fault handler: %e", addr, r);
+  80007b:	83 ec 0c             	sub    $0xc,%esp
+  80007e:	50                   	push   %eax
+  80007f:	53                   	push   %ebx
+  800080:	68 a0 29 80 00       	push   $0x8029a0
+  800085:	6a 0e                	push   $0xe
+  800087:	68 8a 29 80 00       	push   $0x80298a
+  80008c:	e8 94 00 00 00       	call   800125 <_panic>
+
+00800091 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800091:	55                   	push   %ebp
+  800092:	89 e5                	mov    %esp,%ebp
+  800094:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(handler);
+  800097:	68 33 00 80 00       	push   $0x800033
+  80009c:	e8 3a 26 00 00       	call   8026db <set_pgfault_handler>
+	cprintf("%s\n", (char*)0xDeadBeef);
+  8000a1:	83 c4 08             	add    $0x8,%esp
+  8000a4:	68 ef be ad de       	push   $0xdeadbeef
+  8000a9:	68 9c 29 80 00       	push   $0x80299c
+  8000ae:	e8 86 01 00 00       	call   800239 <cprintf>
+	cprintf("%s\n", (char*)0xCafeBffe);
+  8000b3:	83 c4 08             	add    $0x8,%esp
+  8000b6:	68 fe bf fe ca       	push   $0xcafebffe
+  8000bb:	68 9c 29 80 00       	push   $0x80299c
+  8000c0:	e8 74 01 00 00       	call   800239 <cprintf>
+}
+  8000c5:	83 c4 10             	add    $0x10,%esp
+  8000c8:	c9                   	leave
+  8000c9:	c3                   	ret
+
+008000ca <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000ca:	55                   	push   %ebp
+  8000cb:	89 e5                	mov    %esp,%ebp
+  8000cd:	56                   	push   %esi
+  8000ce:	53                   	push   %ebx
+  8000cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000d2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  8000d5:	e8 e3 0e 00 00       	call   800fbd <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  8000da:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000df:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  8000e5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000ea:	a3 08 30 80 00       	mov    %eax,0x803008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000ef:	85 db                	test   %ebx,%ebx
+  8000f1:	7e 07                	jle    8000fa <libmain+0x30>
+		binaryname = argv[0];
+  8000f3:	8b 06                	mov    (%esi),%eax
+  8000f5:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  8000fa:	83 ec 08             	sub    $0x8,%esp
+  8000fd:	56                   	push   %esi
+  8000fe:	53                   	push   %ebx
+  8000ff:	e8 8d ff ff ff       	call   800091 <umain>
+
+	// exit gracefully
+	exit();
+  800104:	e8 0a 00 00 00       	call   800113 <exit>
+}
+  800109:	83 c4 10             	add    $0x10,%esp
+  80010c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80010f:	5b                   	pop    %ebx
+  800110:	5e                   	pop    %esi
+  800111:	5d                   	pop    %ebp
+  800112:	c3                   	ret
+
+00800113 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800113:	55                   	push   %ebp
+  800114:	89 e5                	mov    %esp,%ebp
+  800116:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  800119:	6a 00                	push   $0x0
+  80011b:	e8 db 0d 00 00       	call   800efb <sys_env_destroy>
+}
+  800120:	83 c4 10             	add    $0x10,%esp
+  800123:	c9                   	leave
+  800124:	c3                   	ret
+
+00800125 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800125:	55                   	push   %ebp
+  800126:	89 e5                	mov    %esp,%ebp
+  800128:	57                   	push   %edi
+  800129:	56                   	push   %esi
+  80012a:	53                   	push   %ebx
+  80012b:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  800131:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  800134:	8b 1d 00 30 80 00    	mov    0x803000,%ebx
+  80013a:	e8 7e 0e 00 00       	call   800fbd <sys_getenvid>
+  80013f:	83 ec 04             	sub    $0x4,%esp
+  800142:	ff 75 0c             	push   0xc(%ebp)
+  800145:	ff 75 08             	push   0x8(%ebp)
+  800148:	53                   	push   %ebx
+  800149:	50                   	push   %eax
+  80014a:	68 f8 29 80 00       	push   $0x8029f8
+  80014f:	68 00 01 00 00       	push   $0x100
+  800154:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  80015a:	56                   	push   %esi
+  80015b:	e8 72 06 00 00       	call   8007d2 <snprintf>
+  800160:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  800162:	83 c4 20             	add    $0x20,%esp
+  800165:	57                   	push   %edi
+  800166:	ff 75 10             	push   0x10(%ebp)
+  800169:	bf 00 01 00 00       	mov    $0x100,%edi
+  80016e:	89 f8                	mov    %edi,%eax
+  800170:	29 d8                	sub    %ebx,%eax
+  800172:	50                   	push   %eax
+  800173:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  800176:	50                   	push   %eax
+  800177:	e8 08 06 00 00       	call   800784 <vsnprintf>
+  80017c:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  80017e:	83 c4 0c             	add    $0xc,%esp
+  800181:	68 9e 29 80 00       	push   $0x80299e
+  800186:	29 df                	sub    %ebx,%edi
+  800188:	57                   	push   %edi
+  800189:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  80018c:	50                   	push   %eax
+  80018d:	e8 40 06 00 00       	call   8007d2 <snprintf>
+	sys_cputs(buf, r);
+  800192:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  800195:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  800197:	53                   	push   %ebx
+  800198:	56                   	push   %esi
+  800199:	e8 21 0c 00 00       	call   800dbf <sys_cputs>
+  80019e:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001a1:	cc                   	int3
+	while (1)
+  8001a2:	eb fd                	jmp    8001a1 <_panic+0x7c>
+
+008001a4 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001a4:	55                   	push   %ebp
+  8001a5:	89 e5                	mov    %esp,%ebp
+  8001a7:	53                   	push   %ebx
+  8001a8:	83 ec 04             	sub    $0x4,%esp
+  8001ab:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001ae:	8b 13                	mov    (%ebx),%edx
+  8001b0:	8d 42 01             	lea    0x1(%edx),%eax
+  8001b3:	89 03                	mov    %eax,(%ebx)
+  8001b5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001b8:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001bc:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001c1:	74 09                	je     8001cc <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001c3:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001ca:	c9                   	leave
+  8001cb:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001cc:	83 ec 08             	sub    $0x8,%esp
+  8001cf:	68 ff 00 00 00       	push   $0xff
+  8001d4:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001d7:	50                   	push   %eax
+  8001d8:	e8 e2 0b 00 00       	call   800dbf <sys_cputs>
+		b->idx = 0;
+  8001dd:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001e3:	83 c4 10             	add    $0x10,%esp
+  8001e6:	eb db                	jmp    8001c3 <putch+0x1f>
+
+008001e8 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001e8:	55                   	push   %ebp
+  8001e9:	89 e5                	mov    %esp,%ebp
+  8001eb:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001f1:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001f8:	00 00 00 
+	b.cnt = 0;
+  8001fb:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800202:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800205:	ff 75 0c             	push   0xc(%ebp)
+  800208:	ff 75 08             	push   0x8(%ebp)
+  80020b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800211:	50                   	push   %eax
+  800212:	68 a4 01 80 00       	push   $0x8001a4
+  800217:	e8 14 01 00 00       	call   800330 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80021c:	83 c4 08             	add    $0x8,%esp
+  80021f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800225:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80022b:	50                   	push   %eax
+  80022c:	e8 8e 0b 00 00       	call   800dbf <sys_cputs>
+
+	return b.cnt;
+}
+  800231:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800237:	c9                   	leave
+  800238:	c3                   	ret
+
+00800239 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800239:	55                   	push   %ebp
+  80023a:	89 e5                	mov    %esp,%ebp
+  80023c:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80023f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800242:	50                   	push   %eax
+  800243:	ff 75 08             	push   0x8(%ebp)
+  800246:	e8 9d ff ff ff       	call   8001e8 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80024b:	c9                   	leave
+  80024c:	c3                   	ret
+
+0080024d <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80024d:	55                   	push   %ebp
+  80024e:	89 e5                	mov    %esp,%ebp
+  800250:	57                   	push   %edi
+  800251:	56                   	push   %esi
+  800252:	53                   	push   %ebx
+  800253:	83 ec 1c             	sub    $0x1c,%esp
+  800256:	89 c7                	mov    %eax,%edi
+  800258:	89 d6                	mov    %edx,%esi
+  80025a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80025d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800260:	89 d1                	mov    %edx,%ecx
+  800262:	89 c2                	mov    %eax,%edx
+  800264:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800267:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80026a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80026d:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800270:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800273:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80027a:	39 c2                	cmp    %eax,%edx
+  80027c:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80027f:	72 3e                	jb     8002bf <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800281:	83 ec 0c             	sub    $0xc,%esp
+  800284:	ff 75 18             	push   0x18(%ebp)
+  800287:	83 eb 01             	sub    $0x1,%ebx
+  80028a:	53                   	push   %ebx
+  80028b:	50                   	push   %eax
+  80028c:	83 ec 08             	sub    $0x8,%esp
+  80028f:	ff 75 e4             	push   -0x1c(%ebp)
+  800292:	ff 75 e0             	push   -0x20(%ebp)
+  800295:	ff 75 dc             	push   -0x24(%ebp)
+  800298:	ff 75 d8             	push   -0x28(%ebp)
+  80029b:	e8 9b 25 00 00       	call   80283b <__udivdi3>
+  8002a0:	83 c4 18             	add    $0x18,%esp
+  8002a3:	52                   	push   %edx
+  8002a4:	50                   	push   %eax
+  8002a5:	89 f2                	mov    %esi,%edx
+  8002a7:	89 f8                	mov    %edi,%eax
+  8002a9:	e8 9f ff ff ff       	call   80024d <printnum>
+  8002ae:	83 c4 20             	add    $0x20,%esp
+  8002b1:	eb 13                	jmp    8002c6 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002b3:	83 ec 08             	sub    $0x8,%esp
+  8002b6:	56                   	push   %esi
+  8002b7:	ff 75 18             	push   0x18(%ebp)
+  8002ba:	ff d7                	call   *%edi
+  8002bc:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002bf:	83 eb 01             	sub    $0x1,%ebx
+  8002c2:	85 db                	test   %ebx,%ebx
+  8002c4:	7f ed                	jg     8002b3 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002c6:	83 ec 08             	sub    $0x8,%esp
+  8002c9:	56                   	push   %esi
+  8002ca:	83 ec 04             	sub    $0x4,%esp
+  8002cd:	ff 75 e4             	push   -0x1c(%ebp)
+  8002d0:	ff 75 e0             	push   -0x20(%ebp)
+  8002d3:	ff 75 dc             	push   -0x24(%ebp)
+  8002d6:	ff 75 d8             	push   -0x28(%ebp)
+  8002d9:	e8 7b 25 00 00       	call   802859 <__umoddi3>
+  8002de:	83 c4 14             	add    $0x14,%esp
+  8002e1:	0f be 80 1b 2a 80 00 	movsbl 0x802a1b(%eax),%eax
+  8002e8:	50                   	push   %eax
+  8002e9:	ff d7                	call   *%edi
+}
+  8002eb:	83 c4 10             	add    $0x10,%esp
+  8002ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002f1:	5b                   	pop    %ebx
+  8002f2:	5e                   	pop    %esi
+  8002f3:	5f                   	pop    %edi
+  8002f4:	5d                   	pop    %ebp
+  8002f5:	c3                   	ret
+
+008002f6 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002f6:	55                   	push   %ebp
+  8002f7:	89 e5                	mov    %esp,%ebp
+  8002f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002fc:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800300:	8b 10                	mov    (%eax),%edx
+  800302:	3b 50 04             	cmp    0x4(%eax),%edx
+  800305:	73 0a                	jae    800311 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800307:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80030a:	89 08                	mov    %ecx,(%eax)
+  80030c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80030f:	88 02                	mov    %al,(%edx)
+}
+  800311:	5d                   	pop    %ebp
+  800312:	c3                   	ret
+
+00800313 <printfmt>:
+{
+  800313:	55                   	push   %ebp
+  800314:	89 e5                	mov    %esp,%ebp
+  800316:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800319:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80031c:	50                   	push   %eax
+  80031d:	ff 75 10             	push   0x10(%ebp)
+  800320:	ff 75 0c             	push   0xc(%ebp)
+  800323:	ff 75 08             	push   0x8(%ebp)
+  800326:	e8 05 00 00 00       	call   800330 <vprintfmt>
+}
+  80032b:	83 c4 10             	add    $0x10,%esp
+  80032e:	c9                   	leave
+  80032f:	c3                   	ret
+
+00800330 <vprintfmt>:
+{
+  800330:	55                   	push   %ebp
+  800331:	89 e5                	mov    %esp,%ebp
+  800333:	57                   	push   %edi
+  800334:	56                   	push   %esi
+  800335:	53                   	push   %ebx
+  800336:	83 ec 2c             	sub    $0x2c,%esp
+  800339:	8b 75 08             	mov    0x8(%ebp),%esi
+  80033c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80033f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800342:	eb 0a                	jmp    80034e <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800344:	83 ec 08             	sub    $0x8,%esp
+  800347:	53                   	push   %ebx
+  800348:	50                   	push   %eax
+  800349:	ff d6                	call   *%esi
+  80034b:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80034e:	83 c7 01             	add    $0x1,%edi
+  800351:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800355:	83 f8 25             	cmp    $0x25,%eax
+  800358:	74 0c                	je     800366 <vprintfmt+0x36>
+			if (ch == '\0')
+  80035a:	85 c0                	test   %eax,%eax
+  80035c:	75 e6                	jne    800344 <vprintfmt+0x14>
+}
+  80035e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800361:	5b                   	pop    %ebx
+  800362:	5e                   	pop    %esi
+  800363:	5f                   	pop    %edi
+  800364:	5d                   	pop    %ebp
+  800365:	c3                   	ret
+		padc = ' ';
+  800366:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80036a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800371:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800378:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80037f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800384:	8d 47 01             	lea    0x1(%edi),%eax
+  800387:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80038a:	0f b6 17             	movzbl (%edi),%edx
+  80038d:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800390:	3c 55                	cmp    $0x55,%al
+  800392:	0f 87 cf 03 00 00    	ja     800767 <vprintfmt+0x437>
+  800398:	0f b6 c0             	movzbl %al,%eax
+  80039b:	ff 24 85 00 2b 80 00 	jmp    *0x802b00(,%eax,4)
+  8003a2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8003a5:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8003a9:	eb d9                	jmp    800384 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ab:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003ae:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003b2:	eb d0                	jmp    800384 <vprintfmt+0x54>
+  8003b4:	0f b6 d2             	movzbl %dl,%edx
+  8003b7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003bf:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003c2:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003c5:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003c9:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003cc:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003cf:	83 f9 09             	cmp    $0x9,%ecx
+  8003d2:	77 55                	ja     800429 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8003d4:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003d7:	eb e9                	jmp    8003c2 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8003d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003dc:	8b 00                	mov    (%eax),%eax
+  8003de:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003e4:	8d 40 04             	lea    0x4(%eax),%eax
+  8003e7:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ea:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003ed:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003f1:	79 91                	jns    800384 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003f3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003f6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003f9:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800400:	eb 82                	jmp    800384 <vprintfmt+0x54>
+			if (width < 0)
+  800402:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800405:	85 d2                	test   %edx,%edx
+  800407:	b8 00 00 00 00       	mov    $0x0,%eax
+  80040c:	0f 49 c2             	cmovns %edx,%eax
+  80040f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800412:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800415:	e9 6a ff ff ff       	jmp    800384 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80041a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80041d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800424:	e9 5b ff ff ff       	jmp    800384 <vprintfmt+0x54>
+  800429:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80042c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80042f:	eb bc                	jmp    8003ed <vprintfmt+0xbd>
+			lflag++;
+  800431:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800434:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800437:	e9 48 ff ff ff       	jmp    800384 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80043c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80043f:	8d 78 04             	lea    0x4(%eax),%edi
+  800442:	83 ec 08             	sub    $0x8,%esp
+  800445:	53                   	push   %ebx
+  800446:	ff 30                	push   (%eax)
+  800448:	ff d6                	call   *%esi
+			break;
+  80044a:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80044d:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800450:	e9 b1 02 00 00       	jmp    800706 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800455:	8b 45 14             	mov    0x14(%ebp),%eax
+  800458:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80045b:	8b 10                	mov    (%eax),%edx
+  80045d:	89 d0                	mov    %edx,%eax
+  80045f:	f7 d8                	neg    %eax
+  800461:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800464:	83 f8 0d             	cmp    $0xd,%eax
+  800467:	7f 23                	jg     80048c <vprintfmt+0x15c>
+  800469:	8b 14 85 60 2c 80 00 	mov    0x802c60(,%eax,4),%edx
+  800470:	85 d2                	test   %edx,%edx
+  800472:	74 18                	je     80048c <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800474:	52                   	push   %edx
+  800475:	68 3c 2a 80 00       	push   $0x802a3c
+  80047a:	53                   	push   %ebx
+  80047b:	56                   	push   %esi
+  80047c:	e8 92 fe ff ff       	call   800313 <printfmt>
+  800481:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800484:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800487:	e9 7a 02 00 00       	jmp    800706 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80048c:	50                   	push   %eax
+  80048d:	68 33 2a 80 00       	push   $0x802a33
+  800492:	53                   	push   %ebx
+  800493:	56                   	push   %esi
+  800494:	e8 7a fe ff ff       	call   800313 <printfmt>
+  800499:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80049c:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80049f:	e9 62 02 00 00       	jmp    800706 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a7:	83 c0 04             	add    $0x4,%eax
+  8004aa:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b0:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004b2:	85 c9                	test   %ecx,%ecx
+  8004b4:	b8 2c 2a 80 00       	mov    $0x802a2c,%eax
+  8004b9:	0f 45 c1             	cmovne %ecx,%eax
+  8004bc:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004bf:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004c3:	7e 06                	jle    8004cb <vprintfmt+0x19b>
+  8004c5:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004c9:	75 0b                	jne    8004d6 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004cb:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004ce:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004d1:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004d4:	eb 5c                	jmp    800532 <vprintfmt+0x202>
+  8004d6:	83 ec 08             	sub    $0x8,%esp
+  8004d9:	ff 75 d0             	push   -0x30(%ebp)
+  8004dc:	ff 75 cc             	push   -0x34(%ebp)
+  8004df:	e8 20 03 00 00       	call   800804 <strnlen>
+  8004e4:	89 c2                	mov    %eax,%edx
+  8004e6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004e9:	29 d0                	sub    %edx,%eax
+  8004eb:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004ee:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004f2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004f5:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004f8:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004fa:	eb 0e                	jmp    80050a <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004fc:	83 ec 08             	sub    $0x8,%esp
+  8004ff:	53                   	push   %ebx
+  800500:	57                   	push   %edi
+  800501:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800504:	83 ee 01             	sub    $0x1,%esi
+  800507:	83 c4 10             	add    $0x10,%esp
+  80050a:	85 f6                	test   %esi,%esi
+  80050c:	7f ee                	jg     8004fc <vprintfmt+0x1cc>
+  80050e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800511:	8b 75 08             	mov    0x8(%ebp),%esi
+  800514:	85 c0                	test   %eax,%eax
+  800516:	ba 00 00 00 00       	mov    $0x0,%edx
+  80051b:	0f 49 d0             	cmovns %eax,%edx
+  80051e:	29 d0                	sub    %edx,%eax
+  800520:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800523:	eb a6                	jmp    8004cb <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800525:	83 ec 08             	sub    $0x8,%esp
+  800528:	53                   	push   %ebx
+  800529:	52                   	push   %edx
+  80052a:	ff 55 08             	call   *0x8(%ebp)
+  80052d:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800530:	89 f1                	mov    %esi,%ecx
+  800532:	8d 71 01             	lea    0x1(%ecx),%esi
+  800535:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800539:	0f be d0             	movsbl %al,%edx
+  80053c:	85 d2                	test   %edx,%edx
+  80053e:	74 28                	je     800568 <vprintfmt+0x238>
+  800540:	85 ff                	test   %edi,%edi
+  800542:	78 05                	js     800549 <vprintfmt+0x219>
+  800544:	83 ef 01             	sub    $0x1,%edi
+  800547:	78 30                	js     800579 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800549:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80054d:	74 d6                	je     800525 <vprintfmt+0x1f5>
+  80054f:	0f be c0             	movsbl %al,%eax
+  800552:	83 e8 20             	sub    $0x20,%eax
+  800555:	83 f8 5e             	cmp    $0x5e,%eax
+  800558:	76 cb                	jbe    800525 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80055a:	83 ec 08             	sub    $0x8,%esp
+  80055d:	53                   	push   %ebx
+  80055e:	6a 3f                	push   $0x3f
+  800560:	ff 55 08             	call   *0x8(%ebp)
+  800563:	83 c4 10             	add    $0x10,%esp
+  800566:	eb c8                	jmp    800530 <vprintfmt+0x200>
+  800568:	8b 75 08             	mov    0x8(%ebp),%esi
+  80056b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80056e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800571:	01 d0                	add    %edx,%eax
+  800573:	29 c8                	sub    %ecx,%eax
+  800575:	89 c7                	mov    %eax,%edi
+  800577:	eb 13                	jmp    80058c <vprintfmt+0x25c>
+  800579:	8b 75 08             	mov    0x8(%ebp),%esi
+  80057c:	eb ed                	jmp    80056b <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80057e:	83 ec 08             	sub    $0x8,%esp
+  800581:	53                   	push   %ebx
+  800582:	6a 20                	push   $0x20
+  800584:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800586:	83 ef 01             	sub    $0x1,%edi
+  800589:	83 c4 10             	add    $0x10,%esp
+  80058c:	85 ff                	test   %edi,%edi
+  80058e:	7f ee                	jg     80057e <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800590:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800593:	89 45 14             	mov    %eax,0x14(%ebp)
+  800596:	e9 6b 01 00 00       	jmp    800706 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80059b:	83 f9 01             	cmp    $0x1,%ecx
+  80059e:	7f 1f                	jg     8005bf <vprintfmt+0x28f>
+	else if (lflag)
+  8005a0:	85 c9                	test   %ecx,%ecx
+  8005a2:	74 67                	je     80060b <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8005a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a7:	8b 00                	mov    (%eax),%eax
+  8005a9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005ac:	89 c1                	mov    %eax,%ecx
+  8005ae:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005b1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b7:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ba:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005bd:	eb 17                	jmp    8005d6 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8005bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c2:	8b 50 04             	mov    0x4(%eax),%edx
+  8005c5:	8b 00                	mov    (%eax),%eax
+  8005c7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005ca:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d0:	8d 40 08             	lea    0x8(%eax),%eax
+  8005d3:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005d6:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005d9:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005dc:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005e1:	85 c9                	test   %ecx,%ecx
+  8005e3:	0f 89 03 01 00 00    	jns    8006ec <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8005e9:	83 ec 08             	sub    $0x8,%esp
+  8005ec:	53                   	push   %ebx
+  8005ed:	6a 2d                	push   $0x2d
+  8005ef:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005f1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005f4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005f7:	f7 da                	neg    %edx
+  8005f9:	83 d1 00             	adc    $0x0,%ecx
+  8005fc:	f7 d9                	neg    %ecx
+  8005fe:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800601:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800606:	e9 e1 00 00 00       	jmp    8006ec <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80060b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060e:	8b 00                	mov    (%eax),%eax
+  800610:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800613:	89 c1                	mov    %eax,%ecx
+  800615:	c1 f9 1f             	sar    $0x1f,%ecx
+  800618:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80061b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061e:	8d 40 04             	lea    0x4(%eax),%eax
+  800621:	89 45 14             	mov    %eax,0x14(%ebp)
+  800624:	eb b0                	jmp    8005d6 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800626:	83 f9 01             	cmp    $0x1,%ecx
+  800629:	7f 1e                	jg     800649 <vprintfmt+0x319>
+	else if (lflag)
+  80062b:	85 c9                	test   %ecx,%ecx
+  80062d:	74 32                	je     800661 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  80062f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800632:	8b 10                	mov    (%eax),%edx
+  800634:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800639:	8d 40 04             	lea    0x4(%eax),%eax
+  80063c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80063f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800644:	e9 a3 00 00 00       	jmp    8006ec <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800649:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064c:	8b 10                	mov    (%eax),%edx
+  80064e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800651:	8d 40 08             	lea    0x8(%eax),%eax
+  800654:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800657:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80065c:	e9 8b 00 00 00       	jmp    8006ec <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800661:	8b 45 14             	mov    0x14(%ebp),%eax
+  800664:	8b 10                	mov    (%eax),%edx
+  800666:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80066b:	8d 40 04             	lea    0x4(%eax),%eax
+  80066e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800671:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800676:	eb 74                	jmp    8006ec <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800678:	83 f9 01             	cmp    $0x1,%ecx
+  80067b:	7f 1b                	jg     800698 <vprintfmt+0x368>
+	else if (lflag)
+  80067d:	85 c9                	test   %ecx,%ecx
+  80067f:	74 2c                	je     8006ad <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800681:	8b 45 14             	mov    0x14(%ebp),%eax
+  800684:	8b 10                	mov    (%eax),%edx
+  800686:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80068b:	8d 40 04             	lea    0x4(%eax),%eax
+  80068e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800691:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800696:	eb 54                	jmp    8006ec <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800698:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069b:	8b 10                	mov    (%eax),%edx
+  80069d:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006a0:	8d 40 08             	lea    0x8(%eax),%eax
+  8006a3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006a6:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8006ab:	eb 3f                	jmp    8006ec <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b0:	8b 10                	mov    (%eax),%edx
+  8006b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006b7:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ba:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006bd:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8006c2:	eb 28                	jmp    8006ec <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8006c4:	83 ec 08             	sub    $0x8,%esp
+  8006c7:	53                   	push   %ebx
+  8006c8:	6a 30                	push   $0x30
+  8006ca:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006cc:	83 c4 08             	add    $0x8,%esp
+  8006cf:	53                   	push   %ebx
+  8006d0:	6a 78                	push   $0x78
+  8006d2:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d7:	8b 10                	mov    (%eax),%edx
+  8006d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006de:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006e1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006e7:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006ec:	83 ec 0c             	sub    $0xc,%esp
+  8006ef:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006f3:	50                   	push   %eax
+  8006f4:	ff 75 e0             	push   -0x20(%ebp)
+  8006f7:	57                   	push   %edi
+  8006f8:	51                   	push   %ecx
+  8006f9:	52                   	push   %edx
+  8006fa:	89 da                	mov    %ebx,%edx
+  8006fc:	89 f0                	mov    %esi,%eax
+  8006fe:	e8 4a fb ff ff       	call   80024d <printnum>
+			break;
+  800703:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800706:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800709:	e9 40 fc ff ff       	jmp    80034e <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80070e:	83 f9 01             	cmp    $0x1,%ecx
+  800711:	7f 1b                	jg     80072e <vprintfmt+0x3fe>
+	else if (lflag)
+  800713:	85 c9                	test   %ecx,%ecx
+  800715:	74 2c                	je     800743 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800717:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071a:	8b 10                	mov    (%eax),%edx
+  80071c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800721:	8d 40 04             	lea    0x4(%eax),%eax
+  800724:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800727:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80072c:	eb be                	jmp    8006ec <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80072e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800731:	8b 10                	mov    (%eax),%edx
+  800733:	8b 48 04             	mov    0x4(%eax),%ecx
+  800736:	8d 40 08             	lea    0x8(%eax),%eax
+  800739:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80073c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800741:	eb a9                	jmp    8006ec <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800743:	8b 45 14             	mov    0x14(%ebp),%eax
+  800746:	8b 10                	mov    (%eax),%edx
+  800748:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80074d:	8d 40 04             	lea    0x4(%eax),%eax
+  800750:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800753:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800758:	eb 92                	jmp    8006ec <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  80075a:	83 ec 08             	sub    $0x8,%esp
+  80075d:	53                   	push   %ebx
+  80075e:	6a 25                	push   $0x25
+  800760:	ff d6                	call   *%esi
+			break;
+  800762:	83 c4 10             	add    $0x10,%esp
+  800765:	eb 9f                	jmp    800706 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800767:	83 ec 08             	sub    $0x8,%esp
+  80076a:	53                   	push   %ebx
+  80076b:	6a 25                	push   $0x25
+  80076d:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80076f:	83 c4 10             	add    $0x10,%esp
+  800772:	89 f8                	mov    %edi,%eax
+  800774:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800778:	74 05                	je     80077f <vprintfmt+0x44f>
+  80077a:	83 e8 01             	sub    $0x1,%eax
+  80077d:	eb f5                	jmp    800774 <vprintfmt+0x444>
+  80077f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800782:	eb 82                	jmp    800706 <vprintfmt+0x3d6>
+
+00800784 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800784:	55                   	push   %ebp
+  800785:	89 e5                	mov    %esp,%ebp
+  800787:	83 ec 18             	sub    $0x18,%esp
+  80078a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80078d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800790:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800793:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800797:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80079a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007a1:	85 c0                	test   %eax,%eax
+  8007a3:	74 26                	je     8007cb <vsnprintf+0x47>
+  8007a5:	85 d2                	test   %edx,%edx
+  8007a7:	7e 22                	jle    8007cb <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007a9:	ff 75 14             	push   0x14(%ebp)
+  8007ac:	ff 75 10             	push   0x10(%ebp)
+  8007af:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007b2:	50                   	push   %eax
+  8007b3:	68 f6 02 80 00       	push   $0x8002f6
+  8007b8:	e8 73 fb ff ff       	call   800330 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007bd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007c0:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007c6:	83 c4 10             	add    $0x10,%esp
+}
+  8007c9:	c9                   	leave
+  8007ca:	c3                   	ret
+		return -E_INVAL;
+  8007cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007d0:	eb f7                	jmp    8007c9 <vsnprintf+0x45>
+
+008007d2 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007d2:	55                   	push   %ebp
+  8007d3:	89 e5                	mov    %esp,%ebp
+  8007d5:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007d8:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007db:	50                   	push   %eax
+  8007dc:	ff 75 10             	push   0x10(%ebp)
+  8007df:	ff 75 0c             	push   0xc(%ebp)
+  8007e2:	ff 75 08             	push   0x8(%ebp)
+  8007e5:	e8 9a ff ff ff       	call   800784 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007ea:	c9                   	leave
+  8007eb:	c3                   	ret
+
+008007ec <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007ec:	55                   	push   %ebp
+  8007ed:	89 e5                	mov    %esp,%ebp
+  8007ef:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f7:	eb 03                	jmp    8007fc <strlen+0x10>
+		n++;
+  8007f9:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007fc:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800800:	75 f7                	jne    8007f9 <strlen+0xd>
+	return n;
+}
+  800802:	5d                   	pop    %ebp
+  800803:	c3                   	ret
+
+00800804 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800804:	55                   	push   %ebp
+  800805:	89 e5                	mov    %esp,%ebp
+  800807:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80080a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80080d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800812:	eb 03                	jmp    800817 <strnlen+0x13>
+		n++;
+  800814:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800817:	39 d0                	cmp    %edx,%eax
+  800819:	74 08                	je     800823 <strnlen+0x1f>
+  80081b:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80081f:	75 f3                	jne    800814 <strnlen+0x10>
+  800821:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800823:	89 d0                	mov    %edx,%eax
+  800825:	5d                   	pop    %ebp
+  800826:	c3                   	ret
+
+00800827 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800827:	55                   	push   %ebp
+  800828:	89 e5                	mov    %esp,%ebp
+  80082a:	53                   	push   %ebx
+  80082b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80082e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800831:	b8 00 00 00 00       	mov    $0x0,%eax
+  800836:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80083a:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80083d:	83 c0 01             	add    $0x1,%eax
+  800840:	84 d2                	test   %dl,%dl
+  800842:	75 f2                	jne    800836 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800844:	89 c8                	mov    %ecx,%eax
+  800846:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800849:	c9                   	leave
+  80084a:	c3                   	ret
+
+0080084b <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80084b:	55                   	push   %ebp
+  80084c:	89 e5                	mov    %esp,%ebp
+  80084e:	53                   	push   %ebx
+  80084f:	83 ec 10             	sub    $0x10,%esp
+  800852:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800855:	53                   	push   %ebx
+  800856:	e8 91 ff ff ff       	call   8007ec <strlen>
+  80085b:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80085e:	ff 75 0c             	push   0xc(%ebp)
+  800861:	01 d8                	add    %ebx,%eax
+  800863:	50                   	push   %eax
+  800864:	e8 be ff ff ff       	call   800827 <strcpy>
+	return dst;
+}
+  800869:	89 d8                	mov    %ebx,%eax
+  80086b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80086e:	c9                   	leave
+  80086f:	c3                   	ret
+
+00800870 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800870:	55                   	push   %ebp
+  800871:	89 e5                	mov    %esp,%ebp
+  800873:	56                   	push   %esi
+  800874:	53                   	push   %ebx
+  800875:	8b 75 08             	mov    0x8(%ebp),%esi
+  800878:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80087b:	89 f3                	mov    %esi,%ebx
+  80087d:	03 5d 10             	add    0x10(%ebp),%ebx
+  800880:	89 f0                	mov    %esi,%eax
+  800882:	eb 0f                	jmp    800893 <strncpy+0x23>
+		*dst++ = *src;
+  800884:	83 c0 01             	add    $0x1,%eax
+  800887:	0f b6 0a             	movzbl (%edx),%ecx
+  80088a:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80088d:	80 f9 01             	cmp    $0x1,%cl
+  800890:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800893:	39 d8                	cmp    %ebx,%eax
+  800895:	75 ed                	jne    800884 <strncpy+0x14>
+	}
+	return ret;
+}
+  800897:	89 f0                	mov    %esi,%eax
+  800899:	5b                   	pop    %ebx
+  80089a:	5e                   	pop    %esi
+  80089b:	5d                   	pop    %ebp
+  80089c:	c3                   	ret
+
+0080089d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80089d:	55                   	push   %ebp
+  80089e:	89 e5                	mov    %esp,%ebp
+  8008a0:	56                   	push   %esi
+  8008a1:	53                   	push   %ebx
+  8008a2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008a8:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008ab:	89 f0                	mov    %esi,%eax
+  8008ad:	85 d2                	test   %edx,%edx
+  8008af:	74 21                	je     8008d2 <strlcpy+0x35>
+  8008b1:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008b5:	89 f2                	mov    %esi,%edx
+  8008b7:	eb 09                	jmp    8008c2 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008b9:	83 c1 01             	add    $0x1,%ecx
+  8008bc:	83 c2 01             	add    $0x1,%edx
+  8008bf:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008c2:	39 c2                	cmp    %eax,%edx
+  8008c4:	74 09                	je     8008cf <strlcpy+0x32>
+  8008c6:	0f b6 19             	movzbl (%ecx),%ebx
+  8008c9:	84 db                	test   %bl,%bl
+  8008cb:	75 ec                	jne    8008b9 <strlcpy+0x1c>
+  8008cd:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008cf:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008d2:	29 f0                	sub    %esi,%eax
+}
+  8008d4:	5b                   	pop    %ebx
+  8008d5:	5e                   	pop    %esi
+  8008d6:	5d                   	pop    %ebp
+  8008d7:	c3                   	ret
+
+008008d8 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008d8:	55                   	push   %ebp
+  8008d9:	89 e5                	mov    %esp,%ebp
+  8008db:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008de:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008e1:	eb 06                	jmp    8008e9 <strcmp+0x11>
+		p++, q++;
+  8008e3:	83 c1 01             	add    $0x1,%ecx
+  8008e6:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008e9:	0f b6 01             	movzbl (%ecx),%eax
+  8008ec:	84 c0                	test   %al,%al
+  8008ee:	74 04                	je     8008f4 <strcmp+0x1c>
+  8008f0:	3a 02                	cmp    (%edx),%al
+  8008f2:	74 ef                	je     8008e3 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008f4:	0f b6 c0             	movzbl %al,%eax
+  8008f7:	0f b6 12             	movzbl (%edx),%edx
+  8008fa:	29 d0                	sub    %edx,%eax
+}
+  8008fc:	5d                   	pop    %ebp
+  8008fd:	c3                   	ret
+
+008008fe <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008fe:	55                   	push   %ebp
+  8008ff:	89 e5                	mov    %esp,%ebp
+  800901:	53                   	push   %ebx
+  800902:	8b 45 08             	mov    0x8(%ebp),%eax
+  800905:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800908:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80090b:	eb 09                	jmp    800916 <strncmp+0x18>
+		n--, p++, q++;
+  80090d:	83 ea 01             	sub    $0x1,%edx
+  800910:	83 c0 01             	add    $0x1,%eax
+  800913:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800916:	85 d2                	test   %edx,%edx
+  800918:	74 18                	je     800932 <strncmp+0x34>
+  80091a:	0f b6 18             	movzbl (%eax),%ebx
+  80091d:	84 db                	test   %bl,%bl
+  80091f:	74 04                	je     800925 <strncmp+0x27>
+  800921:	3a 19                	cmp    (%ecx),%bl
+  800923:	74 e8                	je     80090d <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800925:	0f b6 00             	movzbl (%eax),%eax
+  800928:	0f b6 11             	movzbl (%ecx),%edx
+  80092b:	29 d0                	sub    %edx,%eax
+}
+  80092d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800930:	c9                   	leave
+  800931:	c3                   	ret
+		return 0;
+  800932:	b8 00 00 00 00       	mov    $0x0,%eax
+  800937:	eb f4                	jmp    80092d <strncmp+0x2f>
+
+00800939 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800939:	55                   	push   %ebp
+  80093a:	89 e5                	mov    %esp,%ebp
+  80093c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80093f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800943:	eb 03                	jmp    800948 <strchr+0xf>
+  800945:	83 c0 01             	add    $0x1,%eax
+  800948:	0f b6 10             	movzbl (%eax),%edx
+  80094b:	84 d2                	test   %dl,%dl
+  80094d:	74 06                	je     800955 <strchr+0x1c>
+		if (*s == c)
+  80094f:	38 ca                	cmp    %cl,%dl
+  800951:	75 f2                	jne    800945 <strchr+0xc>
+  800953:	eb 05                	jmp    80095a <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800955:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80095a:	5d                   	pop    %ebp
+  80095b:	c3                   	ret
+
+0080095c <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80095c:	55                   	push   %ebp
+  80095d:	89 e5                	mov    %esp,%ebp
+  80095f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800962:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800966:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800969:	38 ca                	cmp    %cl,%dl
+  80096b:	74 09                	je     800976 <strfind+0x1a>
+  80096d:	84 d2                	test   %dl,%dl
+  80096f:	74 05                	je     800976 <strfind+0x1a>
+	for (; *s; s++)
+  800971:	83 c0 01             	add    $0x1,%eax
+  800974:	eb f0                	jmp    800966 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800976:	5d                   	pop    %ebp
+  800977:	c3                   	ret
+
+00800978 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800978:	55                   	push   %ebp
+  800979:	89 e5                	mov    %esp,%ebp
+  80097b:	57                   	push   %edi
+  80097c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80097f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800982:	85 c9                	test   %ecx,%ecx
+  800984:	74 20                	je     8009a6 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800986:	89 f8                	mov    %edi,%eax
+  800988:	09 c8                	or     %ecx,%eax
+  80098a:	a8 03                	test   $0x3,%al
+  80098c:	75 12                	jne    8009a0 <memset+0x28>
+		c &= 0xFF;
+  80098e:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800992:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800998:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80099b:	fc                   	cld
+  80099c:	f3 ab                	rep stos %eax,%es:(%edi)
+  80099e:	eb 06                	jmp    8009a6 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009a0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009a3:	fc                   	cld
+  8009a4:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009a6:	89 f8                	mov    %edi,%eax
+  8009a8:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009ab:	c9                   	leave
+  8009ac:	c3                   	ret
+
+008009ad <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009ad:	55                   	push   %ebp
+  8009ae:	89 e5                	mov    %esp,%ebp
+  8009b0:	57                   	push   %edi
+  8009b1:	56                   	push   %esi
+  8009b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009b5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009b8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009bb:	39 c6                	cmp    %eax,%esi
+  8009bd:	73 32                	jae    8009f1 <memmove+0x44>
+  8009bf:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009c2:	39 d0                	cmp    %edx,%eax
+  8009c4:	73 2b                	jae    8009f1 <memmove+0x44>
+		s += n;
+		d += n;
+  8009c6:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009c9:	89 d6                	mov    %edx,%esi
+  8009cb:	09 fe                	or     %edi,%esi
+  8009cd:	09 ce                	or     %ecx,%esi
+  8009cf:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009d5:	75 0e                	jne    8009e5 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009d7:	83 ef 04             	sub    $0x4,%edi
+  8009da:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009dd:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009e0:	fd                   	std
+  8009e1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009e3:	eb 09                	jmp    8009ee <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009e5:	83 ef 01             	sub    $0x1,%edi
+  8009e8:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009eb:	fd                   	std
+  8009ec:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009ee:	fc                   	cld
+  8009ef:	eb 1a                	jmp    800a0b <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009f1:	89 f2                	mov    %esi,%edx
+  8009f3:	09 c2                	or     %eax,%edx
+  8009f5:	09 ca                	or     %ecx,%edx
+  8009f7:	f6 c2 03             	test   $0x3,%dl
+  8009fa:	75 0a                	jne    800a06 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009fc:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009ff:	89 c7                	mov    %eax,%edi
+  800a01:	fc                   	cld
+  800a02:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a04:	eb 05                	jmp    800a0b <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a06:	89 c7                	mov    %eax,%edi
+  800a08:	fc                   	cld
+  800a09:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a0b:	5e                   	pop    %esi
+  800a0c:	5f                   	pop    %edi
+  800a0d:	5d                   	pop    %ebp
+  800a0e:	c3                   	ret
+
+00800a0f <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a0f:	55                   	push   %ebp
+  800a10:	89 e5                	mov    %esp,%ebp
+  800a12:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a15:	ff 75 10             	push   0x10(%ebp)
+  800a18:	ff 75 0c             	push   0xc(%ebp)
+  800a1b:	ff 75 08             	push   0x8(%ebp)
+  800a1e:	e8 8a ff ff ff       	call   8009ad <memmove>
+}
+  800a23:	c9                   	leave
+  800a24:	c3                   	ret
+
+00800a25 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a25:	55                   	push   %ebp
+  800a26:	89 e5                	mov    %esp,%ebp
+  800a28:	56                   	push   %esi
+  800a29:	53                   	push   %ebx
+  800a2a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a2d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a30:	89 c6                	mov    %eax,%esi
+  800a32:	03 75 10             	add    0x10(%ebp),%esi
+  800a35:	eb 06                	jmp    800a3d <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a37:	83 c0 01             	add    $0x1,%eax
+  800a3a:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a3d:	39 f0                	cmp    %esi,%eax
+  800a3f:	74 14                	je     800a55 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a41:	0f b6 08             	movzbl (%eax),%ecx
+  800a44:	0f b6 1a             	movzbl (%edx),%ebx
+  800a47:	38 d9                	cmp    %bl,%cl
+  800a49:	74 ec                	je     800a37 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a4b:	0f b6 c1             	movzbl %cl,%eax
+  800a4e:	0f b6 db             	movzbl %bl,%ebx
+  800a51:	29 d8                	sub    %ebx,%eax
+  800a53:	eb 05                	jmp    800a5a <memcmp+0x35>
+	}
+
+	return 0;
+  800a55:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a5a:	5b                   	pop    %ebx
+  800a5b:	5e                   	pop    %esi
+  800a5c:	5d                   	pop    %ebp
+  800a5d:	c3                   	ret
+
+00800a5e <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a5e:	55                   	push   %ebp
+  800a5f:	89 e5                	mov    %esp,%ebp
+  800a61:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a67:	89 c2                	mov    %eax,%edx
+  800a69:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a6c:	eb 03                	jmp    800a71 <memfind+0x13>
+  800a6e:	83 c0 01             	add    $0x1,%eax
+  800a71:	39 d0                	cmp    %edx,%eax
+  800a73:	73 04                	jae    800a79 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a75:	38 08                	cmp    %cl,(%eax)
+  800a77:	75 f5                	jne    800a6e <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a79:	5d                   	pop    %ebp
+  800a7a:	c3                   	ret
+
+00800a7b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a7b:	55                   	push   %ebp
+  800a7c:	89 e5                	mov    %esp,%ebp
+  800a7e:	57                   	push   %edi
+  800a7f:	56                   	push   %esi
+  800a80:	53                   	push   %ebx
+  800a81:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a84:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a87:	eb 03                	jmp    800a8c <strtol+0x11>
+		s++;
+  800a89:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a8c:	0f b6 02             	movzbl (%edx),%eax
+  800a8f:	3c 20                	cmp    $0x20,%al
+  800a91:	74 f6                	je     800a89 <strtol+0xe>
+  800a93:	3c 09                	cmp    $0x9,%al
+  800a95:	74 f2                	je     800a89 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a97:	3c 2b                	cmp    $0x2b,%al
+  800a99:	74 2a                	je     800ac5 <strtol+0x4a>
+	int neg = 0;
+  800a9b:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800aa0:	3c 2d                	cmp    $0x2d,%al
+  800aa2:	74 2b                	je     800acf <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800aa4:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800aaa:	75 0f                	jne    800abb <strtol+0x40>
+  800aac:	80 3a 30             	cmpb   $0x30,(%edx)
+  800aaf:	74 28                	je     800ad9 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ab1:	85 db                	test   %ebx,%ebx
+  800ab3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ab8:	0f 44 d8             	cmove  %eax,%ebx
+  800abb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ac0:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ac3:	eb 46                	jmp    800b0b <strtol+0x90>
+		s++;
+  800ac5:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800ac8:	bf 00 00 00 00       	mov    $0x0,%edi
+  800acd:	eb d5                	jmp    800aa4 <strtol+0x29>
+		s++, neg = 1;
+  800acf:	83 c2 01             	add    $0x1,%edx
+  800ad2:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ad7:	eb cb                	jmp    800aa4 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ad9:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800add:	74 0e                	je     800aed <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800adf:	85 db                	test   %ebx,%ebx
+  800ae1:	75 d8                	jne    800abb <strtol+0x40>
+		s++, base = 8;
+  800ae3:	83 c2 01             	add    $0x1,%edx
+  800ae6:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800aeb:	eb ce                	jmp    800abb <strtol+0x40>
+		s += 2, base = 16;
+  800aed:	83 c2 02             	add    $0x2,%edx
+  800af0:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800af5:	eb c4                	jmp    800abb <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800af7:	0f be c0             	movsbl %al,%eax
+  800afa:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800afd:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b00:	7d 3a                	jge    800b3c <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b02:	83 c2 01             	add    $0x1,%edx
+  800b05:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b09:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b0b:	0f b6 02             	movzbl (%edx),%eax
+  800b0e:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b11:	89 f3                	mov    %esi,%ebx
+  800b13:	80 fb 09             	cmp    $0x9,%bl
+  800b16:	76 df                	jbe    800af7 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b18:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b1b:	89 f3                	mov    %esi,%ebx
+  800b1d:	80 fb 19             	cmp    $0x19,%bl
+  800b20:	77 08                	ja     800b2a <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b22:	0f be c0             	movsbl %al,%eax
+  800b25:	83 e8 57             	sub    $0x57,%eax
+  800b28:	eb d3                	jmp    800afd <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b2a:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b2d:	89 f3                	mov    %esi,%ebx
+  800b2f:	80 fb 19             	cmp    $0x19,%bl
+  800b32:	77 08                	ja     800b3c <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b34:	0f be c0             	movsbl %al,%eax
+  800b37:	83 e8 37             	sub    $0x37,%eax
+  800b3a:	eb c1                	jmp    800afd <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b3c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b40:	74 05                	je     800b47 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b42:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b45:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b47:	89 c8                	mov    %ecx,%eax
+  800b49:	f7 d8                	neg    %eax
+  800b4b:	85 ff                	test   %edi,%edi
+  800b4d:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b50:	89 c8                	mov    %ecx,%eax
+  800b52:	5b                   	pop    %ebx
+  800b53:	5e                   	pop    %esi
+  800b54:	5f                   	pop    %edi
+  800b55:	5d                   	pop    %ebp
+  800b56:	c3                   	ret
+
+00800b57 <atoi>:
+
+int
+atoi(const char *s)
+{
+  800b57:	55                   	push   %ebp
+  800b58:	89 e5                	mov    %esp,%ebp
+  800b5a:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800b5d:	6a 0a                	push   $0xa
+  800b5f:	6a 00                	push   $0x0
+  800b61:	ff 75 08             	push   0x8(%ebp)
+  800b64:	e8 12 ff ff ff       	call   800a7b <strtol>
+}
+  800b69:	c9                   	leave
+  800b6a:	c3                   	ret
+
+00800b6b <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800b6b:	55                   	push   %ebp
+  800b6c:	89 e5                	mov    %esp,%ebp
+  800b6e:	57                   	push   %edi
+  800b6f:	56                   	push   %esi
+  800b70:	53                   	push   %ebx
+  800b71:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800b77:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800b7d:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800b83:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800b89:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800b90:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800b93:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800b9a:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800b9d:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800ba4:	74 76                	je     800c1c <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800ba6:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800bac:	8b 45 08             	mov    0x8(%ebp),%eax
+  800baf:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800bb5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800bbc:	0f 88 06 01 00 00    	js     800cc8 <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800bc2:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800bc9:	0f 84 48 01 00 00    	je     800d17 <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800bcf:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800bd5:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800bdb:	be 00 00 00 00       	mov    $0x0,%esi
+  800be0:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800be6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800be9:	55                   	push   %ebp
+  800bea:	68 f3 0b 80 00       	push   $0x800bf3
+  800bef:	89 e5                	mov    %esp,%ebp
+  800bf1:	0f 34                	sysenter
+  800bf3:	83 c4 04             	add    $0x4,%esp
+  800bf6:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800bf7:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800bfd:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800c03:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800c06:	0f 85 9a 01 00 00    	jne    800da6 <page_vec_call+0x23b>
+  800c0c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c11:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c14:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c17:	e9 29 01 00 00       	jmp    800d45 <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800c1c:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800c22:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c25:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800c27:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800c2e:	78 2f                	js     800c5f <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800c30:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800c37:	74 72                	je     800cab <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800c39:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800c3f:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800c45:	b8 10 00 00 00       	mov    $0x10,%eax
+  800c4a:	89 fb                	mov    %edi,%ebx
+  800c4c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c4f:	55                   	push   %ebp
+  800c50:	68 59 0c 80 00       	push   $0x800c59
+  800c55:	89 e5                	mov    %esp,%ebp
+  800c57:	0f 34                	sysenter
+  800c59:	83 c4 04             	add    $0x4,%esp
+  800c5c:	5d                   	pop    %ebp
+	return ret;
+  800c5d:	eb 98                	jmp    800bf7 <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800c5f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c64:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800c66:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800c6b:	f6 c6 08             	test   $0x8,%dh
+  800c6e:	74 15                	je     800c85 <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c70:	89 c2                	mov    %eax,%edx
+  800c72:	c1 ea 08             	shr    $0x8,%edx
+  800c75:	83 e2 0f             	and    $0xf,%edx
+  800c78:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800c7d:	83 fa 06             	cmp    $0x6,%edx
+  800c80:	74 0e                	je     800c90 <page_vec_call+0x125>
+  800c82:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800c85:	0f b6 c9             	movzbl %cl,%ecx
+  800c88:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800c8e:	eb a0                	jmp    800c30 <page_vec_call+0xc5>
+  800c90:	89 c2                	mov    %eax,%edx
+  800c92:	c1 ea 04             	shr    $0x4,%edx
+  800c95:	83 e2 0f             	and    $0xf,%edx
+  800c98:	83 fa 02             	cmp    $0x2,%edx
+  800c9b:	77 e5                	ja     800c82 <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800c9d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ca0:	83 f8 02             	cmp    $0x2,%eax
+  800ca3:	0f 97 c1             	seta   %cl
+  800ca6:	0f b6 c9             	movzbl %cl,%ecx
+  800ca9:	eb d7                	jmp    800c82 <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800cab:	b8 10 00 00 00       	mov    $0x10,%eax
+  800cb0:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800cb6:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800cbc:	89 fb                	mov    %edi,%ebx
+  800cbe:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800cc1:	cd 30                	int    $0x30
+  800cc3:	e9 2f ff ff ff       	jmp    800bf7 <page_vec_call+0x8c>
+  800cc8:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ccd:	0f a2                	cpuid
+		return 0;
+  800ccf:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800cd4:	f6 c6 08             	test   $0x8,%dh
+  800cd7:	74 15                	je     800cee <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800cd9:	89 c2                	mov    %eax,%edx
+  800cdb:	c1 ea 08             	shr    $0x8,%edx
+  800cde:	83 e2 0f             	and    $0xf,%edx
+  800ce1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ce6:	83 fa 06             	cmp    $0x6,%edx
+  800ce9:	74 11                	je     800cfc <page_vec_call+0x191>
+  800ceb:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800cee:	0f b6 c9             	movzbl %cl,%ecx
+  800cf1:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800cf7:	e9 c6 fe ff ff       	jmp    800bc2 <page_vec_call+0x57>
+  800cfc:	89 c2                	mov    %eax,%edx
+  800cfe:	c1 ea 04             	shr    $0x4,%edx
+  800d01:	83 e2 0f             	and    $0xf,%edx
+  800d04:	83 fa 02             	cmp    $0x2,%edx
+  800d07:	77 e2                	ja     800ceb <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800d09:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d0c:	83 f8 02             	cmp    $0x2,%eax
+  800d0f:	0f 97 c1             	seta   %cl
+  800d12:	0f b6 c9             	movzbl %cl,%ecx
+  800d15:	eb d4                	jmp    800ceb <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800d17:	be 00 00 00 00       	mov    $0x0,%esi
+  800d1c:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800d22:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800d28:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800d2e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800d31:	cd 30                	int    $0x30
+  800d33:	e9 bf fe ff ff       	jmp    800bf7 <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800d38:	29 da                	sub    %ebx,%edx
+			vec++;
+  800d3a:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800d3d:	83 e8 01             	sub    $0x1,%eax
+  800d40:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800d45:	85 c0                	test   %eax,%eax
+  800d47:	74 58                	je     800da1 <page_vec_call+0x236>
+  800d49:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800d4c:	39 da                	cmp    %ebx,%edx
+  800d4e:	73 e8                	jae    800d38 <page_vec_call+0x1cd>
+  800d50:	89 75 08             	mov    %esi,0x8(%ebp)
+  800d53:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800d56:	84 c9                	test   %cl,%cl
+  800d58:	74 06                	je     800d60 <page_vec_call+0x1f5>
+  800d5a:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800d60:	83 ec 04             	sub    $0x4,%esp
+  800d63:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d66:	c1 e0 04             	shl    $0x4,%eax
+  800d69:	50                   	push   %eax
+  800d6a:	ff 75 08             	push   0x8(%ebp)
+  800d6d:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800d73:	53                   	push   %ebx
+  800d74:	e8 34 fc ff ff       	call   8009ad <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800d79:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800d7f:	89 c2                	mov    %eax,%edx
+  800d81:	c1 e2 0c             	shl    $0xc,%edx
+  800d84:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  800d8a:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  800d90:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  800d96:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  800d99:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  800d9c:	e9 f2 fd ff ff       	jmp    800b93 <page_vec_call+0x28>
+			r = 0;
+  800da1:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  800da6:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800daa:	74 0b                	je     800db7 <page_vec_call+0x24c>
+		*done = total;
+  800dac:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800daf:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  800db5:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  800db7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dba:	5b                   	pop    %ebx
+  800dbb:	5e                   	pop    %esi
+  800dbc:	5f                   	pop    %edi
+  800dbd:	5d                   	pop    %ebp
+  800dbe:	c3                   	ret
+
+00800dbf <sys_cputs>:
+{
+  800dbf:	55                   	push   %ebp
+  800dc0:	89 e5                	mov    %esp,%ebp
+  800dc2:	57                   	push   %edi
+  800dc3:	56                   	push   %esi
+  800dc4:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800dc5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800dcc:	78 2d                	js     800dfb <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800dce:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800dd5:	74 70                	je     800e47 <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800dd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ddc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ddf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de2:	89 c3                	mov    %eax,%ebx
+  800de4:	89 c7                	mov    %eax,%edi
+  800de6:	89 c6                	mov    %eax,%esi
+  800de8:	55                   	push   %ebp
+  800de9:	68 f2 0d 80 00       	push   $0x800df2
+  800dee:	89 e5                	mov    %esp,%ebp
+  800df0:	0f 34                	sysenter
+  800df2:	83 c4 04             	add    $0x4,%esp
+  800df5:	5d                   	pop    %ebp
+}
+  800df6:	5b                   	pop    %ebx
+  800df7:	5e                   	pop    %esi
+  800df8:	5f                   	pop    %edi
+  800df9:	5d                   	pop    %ebp
+  800dfa:	c3                   	ret
+  800dfb:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e00:	0f a2                	cpuid
+		return 0;
+  800e02:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800e07:	f6 c6 08             	test   $0x8,%dh
+  800e0a:	74 15                	je     800e21 <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e0c:	89 c2                	mov    %eax,%edx
+  800e0e:	c1 ea 08             	shr    $0x8,%edx
+  800e11:	83 e2 0f             	and    $0xf,%edx
+  800e14:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e19:	83 fa 06             	cmp    $0x6,%edx
+  800e1c:	74 0e                	je     800e2c <sys_cputs+0x6d>
+  800e1e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e21:	0f b6 c9             	movzbl %cl,%ecx
+  800e24:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800e2a:	eb a2                	jmp    800dce <sys_cputs+0xf>
+  800e2c:	89 c2                	mov    %eax,%edx
+  800e2e:	c1 ea 04             	shr    $0x4,%edx
+  800e31:	83 e2 0f             	and    $0xf,%edx
+  800e34:	83 fa 02             	cmp    $0x2,%edx
+  800e37:	77 e5                	ja     800e1e <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800e39:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e3c:	83 f8 02             	cmp    $0x2,%eax
+  800e3f:	0f 97 c1             	seta   %cl
+  800e42:	0f b6 c9             	movzbl %cl,%ecx
+  800e45:	eb d7                	jmp    800e1e <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800e47:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e52:	89 c3                	mov    %eax,%ebx
+  800e54:	89 c7                	mov    %eax,%edi
+  800e56:	89 c6                	mov    %eax,%esi
+  800e58:	cd 30                	int    $0x30
+}
+  800e5a:	eb 9a                	jmp    800df6 <sys_cputs+0x37>
+
+00800e5c <sys_cgetc>:
+{
+  800e5c:	55                   	push   %ebp
+  800e5d:	89 e5                	mov    %esp,%ebp
+  800e5f:	57                   	push   %edi
+  800e60:	56                   	push   %esi
+  800e61:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800e62:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e69:	78 2e                	js     800e99 <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  800e6b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e72:	74 71                	je     800ee5 <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  800e74:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e79:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e7e:	89 d1                	mov    %edx,%ecx
+  800e80:	89 d3                	mov    %edx,%ebx
+  800e82:	89 d7                	mov    %edx,%edi
+  800e84:	89 d6                	mov    %edx,%esi
+  800e86:	55                   	push   %ebp
+  800e87:	68 90 0e 80 00       	push   $0x800e90
+  800e8c:	89 e5                	mov    %esp,%ebp
+  800e8e:	0f 34                	sysenter
+  800e90:	83 c4 04             	add    $0x4,%esp
+  800e93:	5d                   	pop    %ebp
+}
+  800e94:	5b                   	pop    %ebx
+  800e95:	5e                   	pop    %esi
+  800e96:	5f                   	pop    %edi
+  800e97:	5d                   	pop    %ebp
+  800e98:	c3                   	ret
+  800e99:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e9e:	0f a2                	cpuid
+		return 0;
+  800ea0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800ea5:	f6 c6 08             	test   $0x8,%dh
+  800ea8:	74 15                	je     800ebf <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800eaa:	89 c2                	mov    %eax,%edx
+  800eac:	c1 ea 08             	shr    $0x8,%edx
+  800eaf:	83 e2 0f             	and    $0xf,%edx
+  800eb2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800eb7:	83 fa 06             	cmp    $0x6,%edx
+  800eba:	74 0e                	je     800eca <sys_cgetc+0x6e>
+  800ebc:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800ebf:	0f b6 c9             	movzbl %cl,%ecx
+  800ec2:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800ec8:	eb a1                	jmp    800e6b <sys_cgetc+0xf>
+  800eca:	89 c2                	mov    %eax,%edx
+  800ecc:	c1 ea 04             	shr    $0x4,%edx
+  800ecf:	83 e2 0f             	and    $0xf,%edx
+  800ed2:	83 fa 02             	cmp    $0x2,%edx
+  800ed5:	77 e5                	ja     800ebc <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  800ed7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800eda:	83 f8 02             	cmp    $0x2,%eax
+  800edd:	0f 97 c1             	seta   %cl
+  800ee0:	0f b6 c9             	movzbl %cl,%ecx
+  800ee3:	eb d7                	jmp    800ebc <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  800ee5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eea:	b8 01 00 00 00       	mov    $0x1,%eax
+  800eef:	89 d1                	mov    %edx,%ecx
+  800ef1:	89 d3                	mov    %edx,%ebx
+  800ef3:	89 d7                	mov    %edx,%edi
+  800ef5:	89 d6                	mov    %edx,%esi
+  800ef7:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800ef9:	eb 99                	jmp    800e94 <sys_cgetc+0x38>
+
+00800efb <sys_env_destroy>:
+{
+  800efb:	55                   	push   %ebp
+  800efc:	89 e5                	mov    %esp,%ebp
+  800efe:	57                   	push   %edi
+  800eff:	56                   	push   %esi
+  800f00:	53                   	push   %ebx
+  800f01:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800f04:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f0b:	78 36                	js     800f43 <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  800f0d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f14:	74 79                	je     800f8f <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  800f16:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f19:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f1e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f23:	89 cb                	mov    %ecx,%ebx
+  800f25:	89 cf                	mov    %ecx,%edi
+  800f27:	89 ce                	mov    %ecx,%esi
+  800f29:	55                   	push   %ebp
+  800f2a:	68 33 0f 80 00       	push   $0x800f33
+  800f2f:	89 e5                	mov    %esp,%ebp
+  800f31:	0f 34                	sysenter
+  800f33:	83 c4 04             	add    $0x4,%esp
+  800f36:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800f37:	85 c0                	test   %eax,%eax
+  800f39:	7f 6b                	jg     800fa6 <sys_env_destroy+0xab>
+}
+  800f3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f3e:	5b                   	pop    %ebx
+  800f3f:	5e                   	pop    %esi
+  800f40:	5f                   	pop    %edi
+  800f41:	5d                   	pop    %ebp
+  800f42:	c3                   	ret
+  800f43:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f48:	0f a2                	cpuid
+		return 0;
+  800f4a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f4f:	f6 c6 08             	test   $0x8,%dh
+  800f52:	74 15                	je     800f69 <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f54:	89 c2                	mov    %eax,%edx
+  800f56:	c1 ea 08             	shr    $0x8,%edx
+  800f59:	83 e2 0f             	and    $0xf,%edx
+  800f5c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f61:	83 fa 06             	cmp    $0x6,%edx
+  800f64:	74 0e                	je     800f74 <sys_env_destroy+0x79>
+  800f66:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f69:	0f b6 c9             	movzbl %cl,%ecx
+  800f6c:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800f72:	eb 99                	jmp    800f0d <sys_env_destroy+0x12>
+  800f74:	89 c2                	mov    %eax,%edx
+  800f76:	c1 ea 04             	shr    $0x4,%edx
+  800f79:	83 e2 0f             	and    $0xf,%edx
+  800f7c:	83 fa 02             	cmp    $0x2,%edx
+  800f7f:	77 e5                	ja     800f66 <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  800f81:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f84:	83 f8 02             	cmp    $0x2,%eax
+  800f87:	0f 97 c1             	seta   %cl
+  800f8a:	0f b6 c9             	movzbl %cl,%ecx
+  800f8d:	eb d7                	jmp    800f66 <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  800f8f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f94:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f99:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9c:	89 cb                	mov    %ecx,%ebx
+  800f9e:	89 cf                	mov    %ecx,%edi
+  800fa0:	89 ce                	mov    %ecx,%esi
+  800fa2:	cd 30                	int    $0x30
+  800fa4:	eb 91                	jmp    800f37 <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fa6:	83 ec 0c             	sub    $0xc,%esp
+  800fa9:	50                   	push   %eax
+  800faa:	6a 03                	push   $0x3
+  800fac:	68 d9 2c 80 00       	push   $0x802cd9
+  800fb1:	6a 4a                	push   $0x4a
+  800fb3:	68 f6 2c 80 00       	push   $0x802cf6
+  800fb8:	e8 68 f1 ff ff       	call   800125 <_panic>
+
+00800fbd <sys_getenvid>:
+{
+  800fbd:	55                   	push   %ebp
+  800fbe:	89 e5                	mov    %esp,%ebp
+  800fc0:	57                   	push   %edi
+  800fc1:	56                   	push   %esi
+  800fc2:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800fc3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fca:	78 2e                	js     800ffa <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  800fcc:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fd3:	74 71                	je     801046 <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  800fd5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fda:	b8 02 00 00 00       	mov    $0x2,%eax
+  800fdf:	89 d1                	mov    %edx,%ecx
+  800fe1:	89 d3                	mov    %edx,%ebx
+  800fe3:	89 d7                	mov    %edx,%edi
+  800fe5:	89 d6                	mov    %edx,%esi
+  800fe7:	55                   	push   %ebp
+  800fe8:	68 f1 0f 80 00       	push   $0x800ff1
+  800fed:	89 e5                	mov    %esp,%ebp
+  800fef:	0f 34                	sysenter
+  800ff1:	83 c4 04             	add    $0x4,%esp
+  800ff4:	5d                   	pop    %ebp
+}
+  800ff5:	5b                   	pop    %ebx
+  800ff6:	5e                   	pop    %esi
+  800ff7:	5f                   	pop    %edi
+  800ff8:	5d                   	pop    %ebp
+  800ff9:	c3                   	ret
+  800ffa:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fff:	0f a2                	cpuid
+		return 0;
+  801001:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801006:	f6 c6 08             	test   $0x8,%dh
+  801009:	74 15                	je     801020 <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80100b:	89 c2                	mov    %eax,%edx
+  80100d:	c1 ea 08             	shr    $0x8,%edx
+  801010:	83 e2 0f             	and    $0xf,%edx
+  801013:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801018:	83 fa 06             	cmp    $0x6,%edx
+  80101b:	74 0e                	je     80102b <sys_getenvid+0x6e>
+  80101d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801020:	0f b6 c9             	movzbl %cl,%ecx
+  801023:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801029:	eb a1                	jmp    800fcc <sys_getenvid+0xf>
+  80102b:	89 c2                	mov    %eax,%edx
+  80102d:	c1 ea 04             	shr    $0x4,%edx
+  801030:	83 e2 0f             	and    $0xf,%edx
+  801033:	83 fa 02             	cmp    $0x2,%edx
+  801036:	77 e5                	ja     80101d <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  801038:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80103b:	83 f8 02             	cmp    $0x2,%eax
+  80103e:	0f 97 c1             	seta   %cl
+  801041:	0f b6 c9             	movzbl %cl,%ecx
+  801044:	eb d7                	jmp    80101d <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  801046:	ba 00 00 00 00       	mov    $0x0,%edx
+  80104b:	b8 02 00 00 00       	mov    $0x2,%eax
+  801050:	89 d1                	mov    %edx,%ecx
+  801052:	89 d3                	mov    %edx,%ebx
+  801054:	89 d7                	mov    %edx,%edi
+  801056:	89 d6                	mov    %edx,%esi
+  801058:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80105a:	eb 99                	jmp    800ff5 <sys_getenvid+0x38>
+
+0080105c <sys_page_alloc>:
+{
+  80105c:	55                   	push   %ebp
+  80105d:	89 e5                	mov    %esp,%ebp
+  80105f:	57                   	push   %edi
+  801060:	56                   	push   %esi
+  801061:	53                   	push   %ebx
+  801062:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801065:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80106c:	78 38                	js     8010a6 <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  80106e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801075:	74 7b                	je     8010f2 <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  801077:	be 00 00 00 00       	mov    $0x0,%esi
+  80107c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801082:	b8 04 00 00 00       	mov    $0x4,%eax
+  801087:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80108a:	89 f7                	mov    %esi,%edi
+  80108c:	55                   	push   %ebp
+  80108d:	68 96 10 80 00       	push   $0x801096
+  801092:	89 e5                	mov    %esp,%ebp
+  801094:	0f 34                	sysenter
+  801096:	83 c4 04             	add    $0x4,%esp
+  801099:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80109a:	85 c0                	test   %eax,%eax
+  80109c:	7f 6d                	jg     80110b <sys_page_alloc+0xaf>
+}
+  80109e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010a1:	5b                   	pop    %ebx
+  8010a2:	5e                   	pop    %esi
+  8010a3:	5f                   	pop    %edi
+  8010a4:	5d                   	pop    %ebp
+  8010a5:	c3                   	ret
+  8010a6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010ab:	0f a2                	cpuid
+		return 0;
+  8010ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8010b2:	f6 c6 08             	test   $0x8,%dh
+  8010b5:	74 15                	je     8010cc <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010b7:	89 c2                	mov    %eax,%edx
+  8010b9:	c1 ea 08             	shr    $0x8,%edx
+  8010bc:	83 e2 0f             	and    $0xf,%edx
+  8010bf:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8010c4:	83 fa 06             	cmp    $0x6,%edx
+  8010c7:	74 0e                	je     8010d7 <sys_page_alloc+0x7b>
+  8010c9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8010cc:	0f b6 c9             	movzbl %cl,%ecx
+  8010cf:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8010d5:	eb 97                	jmp    80106e <sys_page_alloc+0x12>
+  8010d7:	89 c2                	mov    %eax,%edx
+  8010d9:	c1 ea 04             	shr    $0x4,%edx
+  8010dc:	83 e2 0f             	and    $0xf,%edx
+  8010df:	83 fa 02             	cmp    $0x2,%edx
+  8010e2:	77 e5                	ja     8010c9 <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  8010e4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010e7:	83 f8 02             	cmp    $0x2,%eax
+  8010ea:	0f 97 c1             	seta   %cl
+  8010ed:	0f b6 c9             	movzbl %cl,%ecx
+  8010f0:	eb d7                	jmp    8010c9 <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  8010f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8010f7:	b8 04 00 00 00       	mov    $0x4,%eax
+  8010fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801102:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801105:	89 f7                	mov    %esi,%edi
+  801107:	cd 30                	int    $0x30
+  801109:	eb 8f                	jmp    80109a <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80110b:	83 ec 0c             	sub    $0xc,%esp
+  80110e:	50                   	push   %eax
+  80110f:	6a 04                	push   $0x4
+  801111:	68 d9 2c 80 00       	push   $0x802cd9
+  801116:	6a 4a                	push   $0x4a
+  801118:	68 f6 2c 80 00       	push   $0x802cf6
+  80111d:	e8 03 f0 ff ff       	call   800125 <_panic>
+
+00801122 <sys_page_map>:
+{
+  801122:	55                   	push   %ebp
+  801123:	89 e5                	mov    %esp,%ebp
+  801125:	57                   	push   %edi
+  801126:	56                   	push   %esi
+  801127:	53                   	push   %ebx
+  801128:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80112b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801132:	78 37                	js     80116b <sys_page_map+0x49>
+	if (syscall_sysenter)
+  801134:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80113b:	74 7a                	je     8011b7 <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  80113d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801140:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801143:	b8 05 00 00 00       	mov    $0x5,%eax
+  801148:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80114b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80114e:	8b 75 18             	mov    0x18(%ebp),%esi
+  801151:	55                   	push   %ebp
+  801152:	68 5b 11 80 00       	push   $0x80115b
+  801157:	89 e5                	mov    %esp,%ebp
+  801159:	0f 34                	sysenter
+  80115b:	83 c4 04             	add    $0x4,%esp
+  80115e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80115f:	85 c0                	test   %eax,%eax
+  801161:	7f 6c                	jg     8011cf <sys_page_map+0xad>
+}
+  801163:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801166:	5b                   	pop    %ebx
+  801167:	5e                   	pop    %esi
+  801168:	5f                   	pop    %edi
+  801169:	5d                   	pop    %ebp
+  80116a:	c3                   	ret
+  80116b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801170:	0f a2                	cpuid
+		return 0;
+  801172:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801177:	f6 c6 08             	test   $0x8,%dh
+  80117a:	74 15                	je     801191 <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80117c:	89 c2                	mov    %eax,%edx
+  80117e:	c1 ea 08             	shr    $0x8,%edx
+  801181:	83 e2 0f             	and    $0xf,%edx
+  801184:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801189:	83 fa 06             	cmp    $0x6,%edx
+  80118c:	74 0e                	je     80119c <sys_page_map+0x7a>
+  80118e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801191:	0f b6 c9             	movzbl %cl,%ecx
+  801194:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80119a:	eb 98                	jmp    801134 <sys_page_map+0x12>
+  80119c:	89 c2                	mov    %eax,%edx
+  80119e:	c1 ea 04             	shr    $0x4,%edx
+  8011a1:	83 e2 0f             	and    $0xf,%edx
+  8011a4:	83 fa 02             	cmp    $0x2,%edx
+  8011a7:	77 e5                	ja     80118e <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  8011a9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011ac:	83 f8 02             	cmp    $0x2,%eax
+  8011af:	0f 97 c1             	seta   %cl
+  8011b2:	0f b6 c9             	movzbl %cl,%ecx
+  8011b5:	eb d7                	jmp    80118e <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  8011b7:	b8 05 00 00 00       	mov    $0x5,%eax
+  8011bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011c5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011c8:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011cb:	cd 30                	int    $0x30
+  8011cd:	eb 90                	jmp    80115f <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011cf:	83 ec 0c             	sub    $0xc,%esp
+  8011d2:	50                   	push   %eax
+  8011d3:	6a 05                	push   $0x5
+  8011d5:	68 d9 2c 80 00       	push   $0x802cd9
+  8011da:	6a 4a                	push   $0x4a
+  8011dc:	68 f6 2c 80 00       	push   $0x802cf6
+  8011e1:	e8 3f ef ff ff       	call   800125 <_panic>
+
+008011e6 <sys_page_unmap>:
+{
+  8011e6:	55                   	push   %ebp
+  8011e7:	89 e5                	mov    %esp,%ebp
+  8011e9:	57                   	push   %edi
+  8011ea:	56                   	push   %esi
+  8011eb:	53                   	push   %ebx
+  8011ec:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8011ef:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8011f6:	78 37                	js     80122f <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  8011f8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8011ff:	74 7a                	je     80127b <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  801201:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801206:	8b 55 08             	mov    0x8(%ebp),%edx
+  801209:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120c:	b8 06 00 00 00       	mov    $0x6,%eax
+  801211:	89 df                	mov    %ebx,%edi
+  801213:	89 de                	mov    %ebx,%esi
+  801215:	55                   	push   %ebp
+  801216:	68 1f 12 80 00       	push   $0x80121f
+  80121b:	89 e5                	mov    %esp,%ebp
+  80121d:	0f 34                	sysenter
+  80121f:	83 c4 04             	add    $0x4,%esp
+  801222:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801223:	85 c0                	test   %eax,%eax
+  801225:	7f 6c                	jg     801293 <sys_page_unmap+0xad>
+}
+  801227:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80122a:	5b                   	pop    %ebx
+  80122b:	5e                   	pop    %esi
+  80122c:	5f                   	pop    %edi
+  80122d:	5d                   	pop    %ebp
+  80122e:	c3                   	ret
+  80122f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801234:	0f a2                	cpuid
+		return 0;
+  801236:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80123b:	f6 c6 08             	test   $0x8,%dh
+  80123e:	74 15                	je     801255 <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801240:	89 c2                	mov    %eax,%edx
+  801242:	c1 ea 08             	shr    $0x8,%edx
+  801245:	83 e2 0f             	and    $0xf,%edx
+  801248:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80124d:	83 fa 06             	cmp    $0x6,%edx
+  801250:	74 0e                	je     801260 <sys_page_unmap+0x7a>
+  801252:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801255:	0f b6 c9             	movzbl %cl,%ecx
+  801258:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80125e:	eb 98                	jmp    8011f8 <sys_page_unmap+0x12>
+  801260:	89 c2                	mov    %eax,%edx
+  801262:	c1 ea 04             	shr    $0x4,%edx
+  801265:	83 e2 0f             	and    $0xf,%edx
+  801268:	83 fa 02             	cmp    $0x2,%edx
+  80126b:	77 e5                	ja     801252 <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  80126d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801270:	83 f8 02             	cmp    $0x2,%eax
+  801273:	0f 97 c1             	seta   %cl
+  801276:	0f b6 c9             	movzbl %cl,%ecx
+  801279:	eb d7                	jmp    801252 <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  80127b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801280:	b8 06 00 00 00       	mov    $0x6,%eax
+  801285:	8b 55 08             	mov    0x8(%ebp),%edx
+  801288:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80128b:	89 df                	mov    %ebx,%edi
+  80128d:	89 de                	mov    %ebx,%esi
+  80128f:	cd 30                	int    $0x30
+  801291:	eb 90                	jmp    801223 <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801293:	83 ec 0c             	sub    $0xc,%esp
+  801296:	50                   	push   %eax
+  801297:	6a 06                	push   $0x6
+  801299:	68 d9 2c 80 00       	push   $0x802cd9
+  80129e:	6a 4a                	push   $0x4a
+  8012a0:	68 f6 2c 80 00       	push   $0x802cf6
+  8012a5:	e8 7b ee ff ff       	call   800125 <_panic>
+
+008012aa <sys_page_copy>:
+{
+  8012aa:	55                   	push   %ebp
+  8012ab:	89 e5                	mov    %esp,%ebp
+  8012ad:	57                   	push   %edi
+  8012ae:	56                   	push   %esi
+  8012af:	53                   	push   %ebx
+  8012b0:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8012b3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8012ba:	78 37                	js     8012f3 <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  8012bc:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8012c3:	74 7a                	je     80133f <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  8012c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012cb:	b8 29 00 00 00       	mov    $0x29,%eax
+  8012d0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012d3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012d6:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012d9:	55                   	push   %ebp
+  8012da:	68 e3 12 80 00       	push   $0x8012e3
+  8012df:	89 e5                	mov    %esp,%ebp
+  8012e1:	0f 34                	sysenter
+  8012e3:	83 c4 04             	add    $0x4,%esp
+  8012e6:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8012e7:	85 c0                	test   %eax,%eax
+  8012e9:	7f 6c                	jg     801357 <sys_page_copy+0xad>
+}
+  8012eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ee:	5b                   	pop    %ebx
+  8012ef:	5e                   	pop    %esi
+  8012f0:	5f                   	pop    %edi
+  8012f1:	5d                   	pop    %ebp
+  8012f2:	c3                   	ret
+  8012f3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012f8:	0f a2                	cpuid
+		return 0;
+  8012fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8012ff:	f6 c6 08             	test   $0x8,%dh
+  801302:	74 15                	je     801319 <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801304:	89 c2                	mov    %eax,%edx
+  801306:	c1 ea 08             	shr    $0x8,%edx
+  801309:	83 e2 0f             	and    $0xf,%edx
+  80130c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801311:	83 fa 06             	cmp    $0x6,%edx
+  801314:	74 0e                	je     801324 <sys_page_copy+0x7a>
+  801316:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801319:	0f b6 c9             	movzbl %cl,%ecx
+  80131c:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801322:	eb 98                	jmp    8012bc <sys_page_copy+0x12>
+  801324:	89 c2                	mov    %eax,%edx
+  801326:	c1 ea 04             	shr    $0x4,%edx
+  801329:	83 e2 0f             	and    $0xf,%edx
+  80132c:	83 fa 02             	cmp    $0x2,%edx
+  80132f:	77 e5                	ja     801316 <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  801331:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801334:	83 f8 02             	cmp    $0x2,%eax
+  801337:	0f 97 c1             	seta   %cl
+  80133a:	0f b6 c9             	movzbl %cl,%ecx
+  80133d:	eb d7                	jmp    801316 <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  80133f:	b8 29 00 00 00       	mov    $0x29,%eax
+  801344:	8b 55 08             	mov    0x8(%ebp),%edx
+  801347:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80134a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80134d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801350:	8b 75 18             	mov    0x18(%ebp),%esi
+  801353:	cd 30                	int    $0x30
+  801355:	eb 90                	jmp    8012e7 <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801357:	83 ec 0c             	sub    $0xc,%esp
+  80135a:	50                   	push   %eax
+  80135b:	6a 29                	push   $0x29
+  80135d:	68 d9 2c 80 00       	push   $0x802cd9
+  801362:	6a 4a                	push   $0x4a
+  801364:	68 f6 2c 80 00       	push   $0x802cf6
+  801369:	e8 b7 ed ff ff       	call   800125 <_panic>
+
+0080136e <sys_yield>:
+{
+  80136e:	55                   	push   %ebp
+  80136f:	89 e5                	mov    %esp,%ebp
+  801371:	57                   	push   %edi
+  801372:	56                   	push   %esi
+  801373:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801374:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80137b:	78 2e                	js     8013ab <sys_yield+0x3d>
+	if (syscall_sysenter)
+  80137d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801384:	74 71                	je     8013f7 <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  801386:	ba 00 00 00 00       	mov    $0x0,%edx
+  80138b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801390:	89 d1                	mov    %edx,%ecx
+  801392:	89 d3                	mov    %edx,%ebx
+  801394:	89 d7                	mov    %edx,%edi
+  801396:	89 d6                	mov    %edx,%esi
+  801398:	55                   	push   %ebp
+  801399:	68 a2 13 80 00       	push   $0x8013a2
+  80139e:	89 e5                	mov    %esp,%ebp
+  8013a0:	0f 34                	sysenter
+  8013a2:	83 c4 04             	add    $0x4,%esp
+  8013a5:	5d                   	pop    %ebp
+}
+  8013a6:	5b                   	pop    %ebx
+  8013a7:	5e                   	pop    %esi
+  8013a8:	5f                   	pop    %edi
+  8013a9:	5d                   	pop    %ebp
+  8013aa:	c3                   	ret
+  8013ab:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013b0:	0f a2                	cpuid
+		return 0;
+  8013b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8013b7:	f6 c6 08             	test   $0x8,%dh
+  8013ba:	74 15                	je     8013d1 <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013bc:	89 c2                	mov    %eax,%edx
+  8013be:	c1 ea 08             	shr    $0x8,%edx
+  8013c1:	83 e2 0f             	and    $0xf,%edx
+  8013c4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8013c9:	83 fa 06             	cmp    $0x6,%edx
+  8013cc:	74 0e                	je     8013dc <sys_yield+0x6e>
+  8013ce:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8013d1:	0f b6 c9             	movzbl %cl,%ecx
+  8013d4:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8013da:	eb a1                	jmp    80137d <sys_yield+0xf>
+  8013dc:	89 c2                	mov    %eax,%edx
+  8013de:	c1 ea 04             	shr    $0x4,%edx
+  8013e1:	83 e2 0f             	and    $0xf,%edx
+  8013e4:	83 fa 02             	cmp    $0x2,%edx
+  8013e7:	77 e5                	ja     8013ce <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  8013e9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013ec:	83 f8 02             	cmp    $0x2,%eax
+  8013ef:	0f 97 c1             	seta   %cl
+  8013f2:	0f b6 c9             	movzbl %cl,%ecx
+  8013f5:	eb d7                	jmp    8013ce <sys_yield+0x60>
+		asm volatile("int %1\n"
+  8013f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013fc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801401:	89 d1                	mov    %edx,%ecx
+  801403:	89 d3                	mov    %edx,%ebx
+  801405:	89 d7                	mov    %edx,%edi
+  801407:	89 d6                	mov    %edx,%esi
+  801409:	cd 30                	int    $0x30
+}
+  80140b:	eb 99                	jmp    8013a6 <sys_yield+0x38>
+
+0080140d <sys_env_set_status>:
+{
+  80140d:	55                   	push   %ebp
+  80140e:	89 e5                	mov    %esp,%ebp
+  801410:	57                   	push   %edi
+  801411:	56                   	push   %esi
+  801412:	53                   	push   %ebx
+  801413:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801416:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80141d:	78 37                	js     801456 <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  80141f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801426:	74 7a                	je     8014a2 <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  801428:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80142d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801430:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801433:	b8 08 00 00 00       	mov    $0x8,%eax
+  801438:	89 df                	mov    %ebx,%edi
+  80143a:	89 de                	mov    %ebx,%esi
+  80143c:	55                   	push   %ebp
+  80143d:	68 46 14 80 00       	push   $0x801446
+  801442:	89 e5                	mov    %esp,%ebp
+  801444:	0f 34                	sysenter
+  801446:	83 c4 04             	add    $0x4,%esp
+  801449:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80144a:	85 c0                	test   %eax,%eax
+  80144c:	7f 6c                	jg     8014ba <sys_env_set_status+0xad>
+}
+  80144e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801451:	5b                   	pop    %ebx
+  801452:	5e                   	pop    %esi
+  801453:	5f                   	pop    %edi
+  801454:	5d                   	pop    %ebp
+  801455:	c3                   	ret
+  801456:	b8 01 00 00 00       	mov    $0x1,%eax
+  80145b:	0f a2                	cpuid
+		return 0;
+  80145d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801462:	f6 c6 08             	test   $0x8,%dh
+  801465:	74 15                	je     80147c <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801467:	89 c2                	mov    %eax,%edx
+  801469:	c1 ea 08             	shr    $0x8,%edx
+  80146c:	83 e2 0f             	and    $0xf,%edx
+  80146f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801474:	83 fa 06             	cmp    $0x6,%edx
+  801477:	74 0e                	je     801487 <sys_env_set_status+0x7a>
+  801479:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80147c:	0f b6 c9             	movzbl %cl,%ecx
+  80147f:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801485:	eb 98                	jmp    80141f <sys_env_set_status+0x12>
+  801487:	89 c2                	mov    %eax,%edx
+  801489:	c1 ea 04             	shr    $0x4,%edx
+  80148c:	83 e2 0f             	and    $0xf,%edx
+  80148f:	83 fa 02             	cmp    $0x2,%edx
+  801492:	77 e5                	ja     801479 <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  801494:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801497:	83 f8 02             	cmp    $0x2,%eax
+  80149a:	0f 97 c1             	seta   %cl
+  80149d:	0f b6 c9             	movzbl %cl,%ecx
+  8014a0:	eb d7                	jmp    801479 <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  8014a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014a7:	b8 08 00 00 00       	mov    $0x8,%eax
+  8014ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b2:	89 df                	mov    %ebx,%edi
+  8014b4:	89 de                	mov    %ebx,%esi
+  8014b6:	cd 30                	int    $0x30
+  8014b8:	eb 90                	jmp    80144a <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014ba:	83 ec 0c             	sub    $0xc,%esp
+  8014bd:	50                   	push   %eax
+  8014be:	6a 08                	push   $0x8
+  8014c0:	68 d9 2c 80 00       	push   $0x802cd9
+  8014c5:	6a 4a                	push   $0x4a
+  8014c7:	68 f6 2c 80 00       	push   $0x802cf6
+  8014cc:	e8 54 ec ff ff       	call   800125 <_panic>
+
+008014d1 <sys_sysinfo>:
+{
+  8014d1:	55                   	push   %ebp
+  8014d2:	89 e5                	mov    %esp,%ebp
+  8014d4:	57                   	push   %edi
+  8014d5:	56                   	push   %esi
+  8014d6:	53                   	push   %ebx
+  8014d7:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8014da:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8014e1:	78 36                	js     801519 <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  8014e3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8014ea:	74 79                	je     801565 <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  8014ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014f4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8014f9:	89 cb                	mov    %ecx,%ebx
+  8014fb:	89 cf                	mov    %ecx,%edi
+  8014fd:	89 ce                	mov    %ecx,%esi
+  8014ff:	55                   	push   %ebp
+  801500:	68 09 15 80 00       	push   $0x801509
+  801505:	89 e5                	mov    %esp,%ebp
+  801507:	0f 34                	sysenter
+  801509:	83 c4 04             	add    $0x4,%esp
+  80150c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80150d:	85 c0                	test   %eax,%eax
+  80150f:	7f 6b                	jg     80157c <sys_sysinfo+0xab>
+}
+  801511:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801514:	5b                   	pop    %ebx
+  801515:	5e                   	pop    %esi
+  801516:	5f                   	pop    %edi
+  801517:	5d                   	pop    %ebp
+  801518:	c3                   	ret
+  801519:	b8 01 00 00 00       	mov    $0x1,%eax
+  80151e:	0f a2                	cpuid
+		return 0;
+  801520:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801525:	f6 c6 08             	test   $0x8,%dh
+  801528:	74 15                	je     80153f <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80152a:	89 c2                	mov    %eax,%edx
+  80152c:	c1 ea 08             	shr    $0x8,%edx
+  80152f:	83 e2 0f             	and    $0xf,%edx
+  801532:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801537:	83 fa 06             	cmp    $0x6,%edx
+  80153a:	74 0e                	je     80154a <sys_sysinfo+0x79>
+  80153c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80153f:	0f b6 c9             	movzbl %cl,%ecx
+  801542:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801548:	eb 99                	jmp    8014e3 <sys_sysinfo+0x12>
+  80154a:	89 c2                	mov    %eax,%edx
+  80154c:	c1 ea 04             	shr    $0x4,%edx
+  80154f:	83 e2 0f             	and    $0xf,%edx
+  801552:	83 fa 02             	cmp    $0x2,%edx
+  801555:	77 e5                	ja     80153c <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  801557:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80155a:	83 f8 02             	cmp    $0x2,%eax
+  80155d:	0f 97 c1             	seta   %cl
+  801560:	0f b6 c9             	movzbl %cl,%ecx
+  801563:	eb d7                	jmp    80153c <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  801565:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80156a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80156f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801572:	89 cb                	mov    %ecx,%ebx
+  801574:	89 cf                	mov    %ecx,%edi
+  801576:	89 ce                	mov    %ecx,%esi
+  801578:	cd 30                	int    $0x30
+  80157a:	eb 91                	jmp    80150d <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80157c:	83 ec 0c             	sub    $0xc,%esp
+  80157f:	50                   	push   %eax
+  801580:	6a 0b                	push   $0xb
+  801582:	68 d9 2c 80 00       	push   $0x802cd9
+  801587:	6a 4a                	push   $0x4a
+  801589:	68 f6 2c 80 00       	push   $0x802cf6
+  80158e:	e8 92 eb ff ff       	call   800125 <_panic>
+
+00801593 <sys_env_set_trapframe>:
+{
+  801593:	55                   	push   %ebp
+  801594:	89 e5                	mov    %esp,%ebp
+  801596:	57                   	push   %edi
+  801597:	56                   	push   %esi
+  801598:	53                   	push   %ebx
+  801599:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80159c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8015a3:	78 37                	js     8015dc <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  8015a5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8015ac:	74 7a                	je     801628 <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  8015ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b9:	b8 13 00 00 00       	mov    $0x13,%eax
+  8015be:	89 df                	mov    %ebx,%edi
+  8015c0:	89 de                	mov    %ebx,%esi
+  8015c2:	55                   	push   %ebp
+  8015c3:	68 cc 15 80 00       	push   $0x8015cc
+  8015c8:	89 e5                	mov    %esp,%ebp
+  8015ca:	0f 34                	sysenter
+  8015cc:	83 c4 04             	add    $0x4,%esp
+  8015cf:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8015d0:	85 c0                	test   %eax,%eax
+  8015d2:	7f 6c                	jg     801640 <sys_env_set_trapframe+0xad>
+}
+  8015d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015d7:	5b                   	pop    %ebx
+  8015d8:	5e                   	pop    %esi
+  8015d9:	5f                   	pop    %edi
+  8015da:	5d                   	pop    %ebp
+  8015db:	c3                   	ret
+  8015dc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015e1:	0f a2                	cpuid
+		return 0;
+  8015e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8015e8:	f6 c6 08             	test   $0x8,%dh
+  8015eb:	74 15                	je     801602 <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015ed:	89 c2                	mov    %eax,%edx
+  8015ef:	c1 ea 08             	shr    $0x8,%edx
+  8015f2:	83 e2 0f             	and    $0xf,%edx
+  8015f5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8015fa:	83 fa 06             	cmp    $0x6,%edx
+  8015fd:	74 0e                	je     80160d <sys_env_set_trapframe+0x7a>
+  8015ff:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801602:	0f b6 c9             	movzbl %cl,%ecx
+  801605:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80160b:	eb 98                	jmp    8015a5 <sys_env_set_trapframe+0x12>
+  80160d:	89 c2                	mov    %eax,%edx
+  80160f:	c1 ea 04             	shr    $0x4,%edx
+  801612:	83 e2 0f             	and    $0xf,%edx
+  801615:	83 fa 02             	cmp    $0x2,%edx
+  801618:	77 e5                	ja     8015ff <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  80161a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80161d:	83 f8 02             	cmp    $0x2,%eax
+  801620:	0f 97 c1             	seta   %cl
+  801623:	0f b6 c9             	movzbl %cl,%ecx
+  801626:	eb d7                	jmp    8015ff <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  801628:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80162d:	b8 13 00 00 00       	mov    $0x13,%eax
+  801632:	8b 55 08             	mov    0x8(%ebp),%edx
+  801635:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801638:	89 df                	mov    %ebx,%edi
+  80163a:	89 de                	mov    %ebx,%esi
+  80163c:	cd 30                	int    $0x30
+  80163e:	eb 90                	jmp    8015d0 <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801640:	83 ec 0c             	sub    $0xc,%esp
+  801643:	50                   	push   %eax
+  801644:	6a 13                	push   $0x13
+  801646:	68 d9 2c 80 00       	push   $0x802cd9
+  80164b:	6a 4a                	push   $0x4a
+  80164d:	68 f6 2c 80 00       	push   $0x802cf6
+  801652:	e8 ce ea ff ff       	call   800125 <_panic>
+
+00801657 <sys_env_set_stack_limit>:
+{
+  801657:	55                   	push   %ebp
+  801658:	89 e5                	mov    %esp,%ebp
+  80165a:	57                   	push   %edi
+  80165b:	56                   	push   %esi
+  80165c:	53                   	push   %ebx
+  80165d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801660:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801667:	78 37                	js     8016a0 <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  801669:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801670:	74 7a                	je     8016ec <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  801672:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801677:	8b 55 08             	mov    0x8(%ebp),%edx
+  80167a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80167d:	b8 19 00 00 00       	mov    $0x19,%eax
+  801682:	89 df                	mov    %ebx,%edi
+  801684:	89 de                	mov    %ebx,%esi
+  801686:	55                   	push   %ebp
+  801687:	68 90 16 80 00       	push   $0x801690
+  80168c:	89 e5                	mov    %esp,%ebp
+  80168e:	0f 34                	sysenter
+  801690:	83 c4 04             	add    $0x4,%esp
+  801693:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801694:	85 c0                	test   %eax,%eax
+  801696:	7f 6c                	jg     801704 <sys_env_set_stack_limit+0xad>
+}
+  801698:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80169b:	5b                   	pop    %ebx
+  80169c:	5e                   	pop    %esi
+  80169d:	5f                   	pop    %edi
+  80169e:	5d                   	pop    %ebp
+  80169f:	c3                   	ret
+  8016a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016a5:	0f a2                	cpuid
+		return 0;
+  8016a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8016ac:	f6 c6 08             	test   $0x8,%dh
+  8016af:	74 15                	je     8016c6 <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016b1:	89 c2                	mov    %eax,%edx
+  8016b3:	c1 ea 08             	shr    $0x8,%edx
+  8016b6:	83 e2 0f             	and    $0xf,%edx
+  8016b9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8016be:	83 fa 06             	cmp    $0x6,%edx
+  8016c1:	74 0e                	je     8016d1 <sys_env_set_stack_limit+0x7a>
+  8016c3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8016c6:	0f b6 c9             	movzbl %cl,%ecx
+  8016c9:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8016cf:	eb 98                	jmp    801669 <sys_env_set_stack_limit+0x12>
+  8016d1:	89 c2                	mov    %eax,%edx
+  8016d3:	c1 ea 04             	shr    $0x4,%edx
+  8016d6:	83 e2 0f             	and    $0xf,%edx
+  8016d9:	83 fa 02             	cmp    $0x2,%edx
+  8016dc:	77 e5                	ja     8016c3 <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  8016de:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016e1:	83 f8 02             	cmp    $0x2,%eax
+  8016e4:	0f 97 c1             	seta   %cl
+  8016e7:	0f b6 c9             	movzbl %cl,%ecx
+  8016ea:	eb d7                	jmp    8016c3 <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  8016ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f1:	b8 19 00 00 00       	mov    $0x19,%eax
+  8016f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016fc:	89 df                	mov    %ebx,%edi
+  8016fe:	89 de                	mov    %ebx,%esi
+  801700:	cd 30                	int    $0x30
+  801702:	eb 90                	jmp    801694 <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801704:	83 ec 0c             	sub    $0xc,%esp
+  801707:	50                   	push   %eax
+  801708:	6a 19                	push   $0x19
+  80170a:	68 d9 2c 80 00       	push   $0x802cd9
+  80170f:	6a 4a                	push   $0x4a
+  801711:	68 f6 2c 80 00       	push   $0x802cf6
+  801716:	e8 0a ea ff ff       	call   800125 <_panic>
+
+0080171b <sys_env_set_pgfault_upcall>:
+{
+  80171b:	55                   	push   %ebp
+  80171c:	89 e5                	mov    %esp,%ebp
+  80171e:	57                   	push   %edi
+  80171f:	56                   	push   %esi
+  801720:	53                   	push   %ebx
+  801721:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801724:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80172b:	78 37                	js     801764 <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  80172d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801734:	74 7a                	je     8017b0 <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  801736:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80173b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80173e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801741:	b8 09 00 00 00       	mov    $0x9,%eax
+  801746:	89 df                	mov    %ebx,%edi
+  801748:	89 de                	mov    %ebx,%esi
+  80174a:	55                   	push   %ebp
+  80174b:	68 54 17 80 00       	push   $0x801754
+  801750:	89 e5                	mov    %esp,%ebp
+  801752:	0f 34                	sysenter
+  801754:	83 c4 04             	add    $0x4,%esp
+  801757:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801758:	85 c0                	test   %eax,%eax
+  80175a:	7f 6c                	jg     8017c8 <sys_env_set_pgfault_upcall+0xad>
+}
+  80175c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80175f:	5b                   	pop    %ebx
+  801760:	5e                   	pop    %esi
+  801761:	5f                   	pop    %edi
+  801762:	5d                   	pop    %ebp
+  801763:	c3                   	ret
+  801764:	b8 01 00 00 00       	mov    $0x1,%eax
+  801769:	0f a2                	cpuid
+		return 0;
+  80176b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801770:	f6 c6 08             	test   $0x8,%dh
+  801773:	74 15                	je     80178a <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801775:	89 c2                	mov    %eax,%edx
+  801777:	c1 ea 08             	shr    $0x8,%edx
+  80177a:	83 e2 0f             	and    $0xf,%edx
+  80177d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801782:	83 fa 06             	cmp    $0x6,%edx
+  801785:	74 0e                	je     801795 <sys_env_set_pgfault_upcall+0x7a>
+  801787:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80178a:	0f b6 c9             	movzbl %cl,%ecx
+  80178d:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801793:	eb 98                	jmp    80172d <sys_env_set_pgfault_upcall+0x12>
+  801795:	89 c2                	mov    %eax,%edx
+  801797:	c1 ea 04             	shr    $0x4,%edx
+  80179a:	83 e2 0f             	and    $0xf,%edx
+  80179d:	83 fa 02             	cmp    $0x2,%edx
+  8017a0:	77 e5                	ja     801787 <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  8017a2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017a5:	83 f8 02             	cmp    $0x2,%eax
+  8017a8:	0f 97 c1             	seta   %cl
+  8017ab:	0f b6 c9             	movzbl %cl,%ecx
+  8017ae:	eb d7                	jmp    801787 <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  8017b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017b5:	b8 09 00 00 00       	mov    $0x9,%eax
+  8017ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017c0:	89 df                	mov    %ebx,%edi
+  8017c2:	89 de                	mov    %ebx,%esi
+  8017c4:	cd 30                	int    $0x30
+  8017c6:	eb 90                	jmp    801758 <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017c8:	83 ec 0c             	sub    $0xc,%esp
+  8017cb:	50                   	push   %eax
+  8017cc:	6a 09                	push   $0x9
+  8017ce:	68 d9 2c 80 00       	push   $0x802cd9
+  8017d3:	6a 4a                	push   $0x4a
+  8017d5:	68 f6 2c 80 00       	push   $0x802cf6
+  8017da:	e8 46 e9 ff ff       	call   800125 <_panic>
+
+008017df <sys_ipc_try_send>:
+{
+  8017df:	55                   	push   %ebp
+  8017e0:	89 e5                	mov    %esp,%ebp
+  8017e2:	57                   	push   %edi
+  8017e3:	56                   	push   %esi
+  8017e4:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8017e5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8017ec:	78 32                	js     801820 <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  8017ee:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8017f5:	74 75                	je     80186c <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  8017f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017fd:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801802:	be 00 00 00 00       	mov    $0x0,%esi
+  801807:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80180a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80180d:	55                   	push   %ebp
+  80180e:	68 17 18 80 00       	push   $0x801817
+  801813:	89 e5                	mov    %esp,%ebp
+  801815:	0f 34                	sysenter
+  801817:	83 c4 04             	add    $0x4,%esp
+  80181a:	5d                   	pop    %ebp
+}
+  80181b:	5b                   	pop    %ebx
+  80181c:	5e                   	pop    %esi
+  80181d:	5f                   	pop    %edi
+  80181e:	5d                   	pop    %ebp
+  80181f:	c3                   	ret
+  801820:	b8 01 00 00 00       	mov    $0x1,%eax
+  801825:	0f a2                	cpuid
+		return 0;
+  801827:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80182c:	f6 c6 08             	test   $0x8,%dh
+  80182f:	74 15                	je     801846 <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801831:	89 c2                	mov    %eax,%edx
+  801833:	c1 ea 08             	shr    $0x8,%edx
+  801836:	83 e2 0f             	and    $0xf,%edx
+  801839:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80183e:	83 fa 06             	cmp    $0x6,%edx
+  801841:	74 0e                	je     801851 <sys_ipc_try_send+0x72>
+  801843:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801846:	0f b6 c9             	movzbl %cl,%ecx
+  801849:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80184f:	eb 9d                	jmp    8017ee <sys_ipc_try_send+0xf>
+  801851:	89 c2                	mov    %eax,%edx
+  801853:	c1 ea 04             	shr    $0x4,%edx
+  801856:	83 e2 0f             	and    $0xf,%edx
+  801859:	83 fa 02             	cmp    $0x2,%edx
+  80185c:	77 e5                	ja     801843 <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  80185e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801861:	83 f8 02             	cmp    $0x2,%eax
+  801864:	0f 97 c1             	seta   %cl
+  801867:	0f b6 c9             	movzbl %cl,%ecx
+  80186a:	eb d7                	jmp    801843 <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  80186c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801871:	be 00 00 00 00       	mov    $0x0,%esi
+  801876:	8b 55 08             	mov    0x8(%ebp),%edx
+  801879:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80187c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80187f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801882:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801884:	eb 95                	jmp    80181b <sys_ipc_try_send+0x3c>
+
+00801886 <sys_ipc_send>:
+{
+  801886:	55                   	push   %ebp
+  801887:	89 e5                	mov    %esp,%ebp
+  801889:	57                   	push   %edi
+  80188a:	56                   	push   %esi
+  80188b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80188c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801893:	78 32                	js     8018c7 <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  801895:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80189c:	74 75                	je     801913 <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  80189e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018a4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8018a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8018ae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018b1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8018b4:	55                   	push   %ebp
+  8018b5:	68 be 18 80 00       	push   $0x8018be
+  8018ba:	89 e5                	mov    %esp,%ebp
+  8018bc:	0f 34                	sysenter
+  8018be:	83 c4 04             	add    $0x4,%esp
+  8018c1:	5d                   	pop    %ebp
+}
+  8018c2:	5b                   	pop    %ebx
+  8018c3:	5e                   	pop    %esi
+  8018c4:	5f                   	pop    %edi
+  8018c5:	5d                   	pop    %ebp
+  8018c6:	c3                   	ret
+  8018c7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018cc:	0f a2                	cpuid
+		return 0;
+  8018ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018d3:	f6 c6 08             	test   $0x8,%dh
+  8018d6:	74 15                	je     8018ed <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018d8:	89 c2                	mov    %eax,%edx
+  8018da:	c1 ea 08             	shr    $0x8,%edx
+  8018dd:	83 e2 0f             	and    $0xf,%edx
+  8018e0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018e5:	83 fa 06             	cmp    $0x6,%edx
+  8018e8:	74 0e                	je     8018f8 <sys_ipc_send+0x72>
+  8018ea:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8018ed:	0f b6 c9             	movzbl %cl,%ecx
+  8018f0:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8018f6:	eb 9d                	jmp    801895 <sys_ipc_send+0xf>
+  8018f8:	89 c2                	mov    %eax,%edx
+  8018fa:	c1 ea 04             	shr    $0x4,%edx
+  8018fd:	83 e2 0f             	and    $0xf,%edx
+  801900:	83 fa 02             	cmp    $0x2,%edx
+  801903:	77 e5                	ja     8018ea <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  801905:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801908:	83 f8 02             	cmp    $0x2,%eax
+  80190b:	0f 97 c1             	seta   %cl
+  80190e:	0f b6 c9             	movzbl %cl,%ecx
+  801911:	eb d7                	jmp    8018ea <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  801913:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801918:	be 00 00 00 00       	mov    $0x0,%esi
+  80191d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801920:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801923:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801926:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801929:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  80192b:	eb 95                	jmp    8018c2 <sys_ipc_send+0x3c>
+
+0080192d <sys_ipc_recv>:
+{
+  80192d:	55                   	push   %ebp
+  80192e:	89 e5                	mov    %esp,%ebp
+  801930:	57                   	push   %edi
+  801931:	56                   	push   %esi
+  801932:	53                   	push   %ebx
+  801933:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801936:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80193d:	78 36                	js     801975 <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  80193f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801946:	74 79                	je     8019c1 <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  801948:	8b 55 08             	mov    0x8(%ebp),%edx
+  80194b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801950:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801955:	89 cb                	mov    %ecx,%ebx
+  801957:	89 cf                	mov    %ecx,%edi
+  801959:	89 ce                	mov    %ecx,%esi
+  80195b:	55                   	push   %ebp
+  80195c:	68 65 19 80 00       	push   $0x801965
+  801961:	89 e5                	mov    %esp,%ebp
+  801963:	0f 34                	sysenter
+  801965:	83 c4 04             	add    $0x4,%esp
+  801968:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801969:	85 c0                	test   %eax,%eax
+  80196b:	7f 6b                	jg     8019d8 <sys_ipc_recv+0xab>
+}
+  80196d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801970:	5b                   	pop    %ebx
+  801971:	5e                   	pop    %esi
+  801972:	5f                   	pop    %edi
+  801973:	5d                   	pop    %ebp
+  801974:	c3                   	ret
+  801975:	b8 01 00 00 00       	mov    $0x1,%eax
+  80197a:	0f a2                	cpuid
+		return 0;
+  80197c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801981:	f6 c6 08             	test   $0x8,%dh
+  801984:	74 15                	je     80199b <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801986:	89 c2                	mov    %eax,%edx
+  801988:	c1 ea 08             	shr    $0x8,%edx
+  80198b:	83 e2 0f             	and    $0xf,%edx
+  80198e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801993:	83 fa 06             	cmp    $0x6,%edx
+  801996:	74 0e                	je     8019a6 <sys_ipc_recv+0x79>
+  801998:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80199b:	0f b6 c9             	movzbl %cl,%ecx
+  80199e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8019a4:	eb 99                	jmp    80193f <sys_ipc_recv+0x12>
+  8019a6:	89 c2                	mov    %eax,%edx
+  8019a8:	c1 ea 04             	shr    $0x4,%edx
+  8019ab:	83 e2 0f             	and    $0xf,%edx
+  8019ae:	83 fa 02             	cmp    $0x2,%edx
+  8019b1:	77 e5                	ja     801998 <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  8019b3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019b6:	83 f8 02             	cmp    $0x2,%eax
+  8019b9:	0f 97 c1             	seta   %cl
+  8019bc:	0f b6 c9             	movzbl %cl,%ecx
+  8019bf:	eb d7                	jmp    801998 <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  8019c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019c6:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8019cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019ce:	89 cb                	mov    %ecx,%ebx
+  8019d0:	89 cf                	mov    %ecx,%edi
+  8019d2:	89 ce                	mov    %ecx,%esi
+  8019d4:	cd 30                	int    $0x30
+  8019d6:	eb 91                	jmp    801969 <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8019d8:	83 ec 0c             	sub    $0xc,%esp
+  8019db:	50                   	push   %eax
+  8019dc:	6a 0d                	push   $0xd
+  8019de:	68 d9 2c 80 00       	push   $0x802cd9
+  8019e3:	6a 4a                	push   $0x4a
+  8019e5:	68 f6 2c 80 00       	push   $0x802cf6
+  8019ea:	e8 36 e7 ff ff       	call   800125 <_panic>
+
+008019ef <sys_ipc_send_range>:
+{
+  8019ef:	55                   	push   %ebp
+  8019f0:	89 e5                	mov    %esp,%ebp
+  8019f2:	57                   	push   %edi
+  8019f3:	56                   	push   %esi
+  8019f4:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8019f5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8019fc:	78 30                	js     801a2e <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  8019fe:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801a05:	74 73                	je     801a7a <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801a07:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a0a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a0d:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801a12:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a15:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a18:	8b 75 18             	mov    0x18(%ebp),%esi
+  801a1b:	55                   	push   %ebp
+  801a1c:	68 25 1a 80 00       	push   $0x801a25
+  801a21:	89 e5                	mov    %esp,%ebp
+  801a23:	0f 34                	sysenter
+  801a25:	83 c4 04             	add    $0x4,%esp
+  801a28:	5d                   	pop    %ebp
+}
+  801a29:	5b                   	pop    %ebx
+  801a2a:	5e                   	pop    %esi
+  801a2b:	5f                   	pop    %edi
+  801a2c:	5d                   	pop    %ebp
+  801a2d:	c3                   	ret
+  801a2e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a33:	0f a2                	cpuid
+		return 0;
+  801a35:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801a3a:	f6 c6 08             	test   $0x8,%dh
+  801a3d:	74 15                	je     801a54 <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a3f:	89 c2                	mov    %eax,%edx
+  801a41:	c1 ea 08             	shr    $0x8,%edx
+  801a44:	83 e2 0f             	and    $0xf,%edx
+  801a47:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a4c:	83 fa 06             	cmp    $0x6,%edx
+  801a4f:	74 0e                	je     801a5f <sys_ipc_send_range+0x70>
+  801a51:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a54:	0f b6 c9             	movzbl %cl,%ecx
+  801a57:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801a5d:	eb 9f                	jmp    8019fe <sys_ipc_send_range+0xf>
+  801a5f:	89 c2                	mov    %eax,%edx
+  801a61:	c1 ea 04             	shr    $0x4,%edx
+  801a64:	83 e2 0f             	and    $0xf,%edx
+  801a67:	83 fa 02             	cmp    $0x2,%edx
+  801a6a:	77 e5                	ja     801a51 <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  801a6c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a6f:	83 f8 02             	cmp    $0x2,%eax
+  801a72:	0f 97 c1             	seta   %cl
+  801a75:	0f b6 c9             	movzbl %cl,%ecx
+  801a78:	eb d7                	jmp    801a51 <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  801a7a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801a7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a85:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a88:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a8b:	8b 75 18             	mov    0x18(%ebp),%esi
+  801a8e:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  801a90:	eb 97                	jmp    801a29 <sys_ipc_send_range+0x3a>
+
+00801a92 <sys_ipc_recv_range>:
+{
+  801a92:	55                   	push   %ebp
+  801a93:	89 e5                	mov    %esp,%ebp
+  801a95:	57                   	push   %edi
+  801a96:	56                   	push   %esi
+  801a97:	53                   	push   %ebx
+  801a98:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801a9b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801aa2:	78 37                	js     801adb <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  801aa4:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801aab:	74 7a                	je     801b27 <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  801aad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ab2:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ab5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ab8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801abd:	89 df                	mov    %ebx,%edi
+  801abf:	89 de                	mov    %ebx,%esi
+  801ac1:	55                   	push   %ebp
+  801ac2:	68 cb 1a 80 00       	push   $0x801acb
+  801ac7:	89 e5                	mov    %esp,%ebp
+  801ac9:	0f 34                	sysenter
+  801acb:	83 c4 04             	add    $0x4,%esp
+  801ace:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801acf:	85 c0                	test   %eax,%eax
+  801ad1:	7f 6c                	jg     801b3f <sys_ipc_recv_range+0xad>
+}
+  801ad3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ad6:	5b                   	pop    %ebx
+  801ad7:	5e                   	pop    %esi
+  801ad8:	5f                   	pop    %edi
+  801ad9:	5d                   	pop    %ebp
+  801ada:	c3                   	ret
+  801adb:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ae0:	0f a2                	cpuid
+		return 0;
+  801ae2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801ae7:	f6 c6 08             	test   $0x8,%dh
+  801aea:	74 15                	je     801b01 <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801aec:	89 c2                	mov    %eax,%edx
+  801aee:	c1 ea 08             	shr    $0x8,%edx
+  801af1:	83 e2 0f             	and    $0xf,%edx
+  801af4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801af9:	83 fa 06             	cmp    $0x6,%edx
+  801afc:	74 0e                	je     801b0c <sys_ipc_recv_range+0x7a>
+  801afe:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b01:	0f b6 c9             	movzbl %cl,%ecx
+  801b04:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801b0a:	eb 98                	jmp    801aa4 <sys_ipc_recv_range+0x12>
+  801b0c:	89 c2                	mov    %eax,%edx
+  801b0e:	c1 ea 04             	shr    $0x4,%edx
+  801b11:	83 e2 0f             	and    $0xf,%edx
+  801b14:	83 fa 02             	cmp    $0x2,%edx
+  801b17:	77 e5                	ja     801afe <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801b19:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b1c:	83 f8 02             	cmp    $0x2,%eax
+  801b1f:	0f 97 c1             	seta   %cl
+  801b22:	0f b6 c9             	movzbl %cl,%ecx
+  801b25:	eb d7                	jmp    801afe <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801b27:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b2c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801b31:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b34:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b37:	89 df                	mov    %ebx,%edi
+  801b39:	89 de                	mov    %ebx,%esi
+  801b3b:	cd 30                	int    $0x30
+  801b3d:	eb 90                	jmp    801acf <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801b3f:	83 ec 0c             	sub    $0xc,%esp
+  801b42:	50                   	push   %eax
+  801b43:	6a 1f                	push   $0x1f
+  801b45:	68 d9 2c 80 00       	push   $0x802cd9
+  801b4a:	6a 4a                	push   $0x4a
+  801b4c:	68 f6 2c 80 00       	push   $0x802cf6
+  801b51:	e8 cf e5 ff ff       	call   800125 <_panic>
+
+00801b56 <sys_ipc_call>:
+{
+  801b56:	55                   	push   %ebp
+  801b57:	89 e5                	mov    %esp,%ebp
+  801b59:	57                   	push   %edi
+  801b5a:	56                   	push   %esi
+  801b5b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801b5c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b5f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801b64:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b67:	55                   	push   %ebp
+  801b68:	56                   	push   %esi
+  801b69:	8b 0e                	mov    (%esi),%ecx
+  801b6b:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801b6e:	8b 7e 08             	mov    0x8(%esi),%edi
+  801b71:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801b74:	8b 76 0c             	mov    0xc(%esi),%esi
+  801b77:	cd 30                	int    $0x30
+  801b79:	87 34 24             	xchg   %esi,(%esp)
+  801b7c:	89 0e                	mov    %ecx,(%esi)
+  801b7e:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801b81:	89 7e 08             	mov    %edi,0x8(%esi)
+  801b84:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801b87:	8f 46 0c             	pop    0xc(%esi)
+  801b8a:	5d                   	pop    %ebp
+}
+  801b8b:	5b                   	pop    %ebx
+  801b8c:	5e                   	pop    %esi
+  801b8d:	5f                   	pop    %edi
+  801b8e:	5d                   	pop    %ebp
+  801b8f:	c3                   	ret
+
+00801b90 <sys_ipc_reply_wait>:
+{
+  801b90:	55                   	push   %ebp
+  801b91:	89 e5                	mov    %esp,%ebp
+  801b93:	57                   	push   %edi
+  801b94:	56                   	push   %esi
+  801b95:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801b96:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b99:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801b9e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801ba1:	55                   	push   %ebp
+  801ba2:	56                   	push   %esi
+  801ba3:	8b 0e                	mov    (%esi),%ecx
+  801ba5:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801ba8:	8b 7e 08             	mov    0x8(%esi),%edi
+  801bab:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801bae:	8b 76 0c             	mov    0xc(%esi),%esi
+  801bb1:	cd 30                	int    $0x30
+  801bb3:	87 34 24             	xchg   %esi,(%esp)
+  801bb6:	89 0e                	mov    %ecx,(%esi)
+  801bb8:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801bbb:	89 7e 08             	mov    %edi,0x8(%esi)
+  801bbe:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801bc1:	8f 46 0c             	pop    0xc(%esi)
+  801bc4:	5d                   	pop    %ebp
+}
+  801bc5:	5b                   	pop    %ebx
+  801bc6:	5e                   	pop    %esi
+  801bc7:	5f                   	pop    %edi
+  801bc8:	5d                   	pop    %ebp
+  801bc9:	c3                   	ret
+
+00801bca <sys_ipc_send_msg>:
+{
+  801bca:	55                   	push   %ebp
+  801bcb:	89 e5                	mov    %esp,%ebp
+  801bcd:	57                   	push   %edi
+  801bce:	56                   	push   %esi
+  801bcf:	53                   	push   %ebx
+  801bd0:	83 ec 20             	sub    $0x20,%esp
+  801bd3:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801bd6:	8b 10                	mov    (%eax),%edx
+  801bd8:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801bdb:	8b 50 04             	mov    0x4(%eax),%edx
+  801bde:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801be1:	8b 50 08             	mov    0x8(%eax),%edx
+  801be4:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801be7:	8b 50 0c             	mov    0xc(%eax),%edx
+  801bea:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801bed:	8b 40 10             	mov    0x10(%eax),%eax
+  801bf0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801bf3:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801bf6:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bf9:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801bfe:	55                   	push   %ebp
+  801bff:	56                   	push   %esi
+  801c00:	8b 0e                	mov    (%esi),%ecx
+  801c02:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801c05:	8b 7e 08             	mov    0x8(%esi),%edi
+  801c08:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801c0b:	8b 76 0c             	mov    0xc(%esi),%esi
+  801c0e:	cd 30                	int    $0x30
+  801c10:	87 34 24             	xchg   %esi,(%esp)
+  801c13:	89 0e                	mov    %ecx,(%esi)
+  801c15:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801c18:	89 7e 08             	mov    %edi,0x8(%esi)
+  801c1b:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801c1e:	8f 46 0c             	pop    0xc(%esi)
+  801c21:	5d                   	pop    %ebp
+}
+  801c22:	83 c4 20             	add    $0x20,%esp
+  801c25:	5b                   	pop    %ebx
+  801c26:	5e                   	pop    %esi
+  801c27:	5f                   	pop    %edi
+  801c28:	5d                   	pop    %ebp
+  801c29:	c3                   	ret
+
+00801c2a <sys_fork>:
+{
+  801c2a:	55                   	push   %ebp
+  801c2b:	89 e5                	mov    %esp,%ebp
+  801c2d:	57                   	push   %edi
+  801c2e:	56                   	push   %esi
+  801c2f:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801c30:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801c37:	78 2e                	js     801c67 <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801c39:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801c40:	74 71                	je     801cb3 <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801c42:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c47:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801c4c:	89 d1                	mov    %edx,%ecx
+  801c4e:	89 d3                	mov    %edx,%ebx
+  801c50:	89 d7                	mov    %edx,%edi
+  801c52:	89 d6                	mov    %edx,%esi
+  801c54:	55                   	push   %ebp
+  801c55:	68 5e 1c 80 00       	push   $0x801c5e
+  801c5a:	89 e5                	mov    %esp,%ebp
+  801c5c:	0f 34                	sysenter
+  801c5e:	83 c4 04             	add    $0x4,%esp
+  801c61:	5d                   	pop    %ebp
+}
+  801c62:	5b                   	pop    %ebx
+  801c63:	5e                   	pop    %esi
+  801c64:	5f                   	pop    %edi
+  801c65:	5d                   	pop    %ebp
+  801c66:	c3                   	ret
+  801c67:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c6c:	0f a2                	cpuid
+		return 0;
+  801c6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801c73:	f6 c6 08             	test   $0x8,%dh
+  801c76:	74 15                	je     801c8d <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c78:	89 c2                	mov    %eax,%edx
+  801c7a:	c1 ea 08             	shr    $0x8,%edx
+  801c7d:	83 e2 0f             	and    $0xf,%edx
+  801c80:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801c85:	83 fa 06             	cmp    $0x6,%edx
+  801c88:	74 0e                	je     801c98 <sys_fork+0x6e>
+  801c8a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801c8d:	0f b6 c9             	movzbl %cl,%ecx
+  801c90:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801c96:	eb a1                	jmp    801c39 <sys_fork+0xf>
+  801c98:	89 c2                	mov    %eax,%edx
+  801c9a:	c1 ea 04             	shr    $0x4,%edx
+  801c9d:	83 e2 0f             	and    $0xf,%edx
+  801ca0:	83 fa 02             	cmp    $0x2,%edx
+  801ca3:	77 e5                	ja     801c8a <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801ca5:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ca8:	83 f8 02             	cmp    $0x2,%eax
+  801cab:	0f 97 c1             	seta   %cl
+  801cae:	0f b6 c9             	movzbl %cl,%ecx
+  801cb1:	eb d7                	jmp    801c8a <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801cb3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cb8:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801cbd:	89 d1                	mov    %edx,%ecx
+  801cbf:	89 d3                	mov    %edx,%ebx
+  801cc1:	89 d7                	mov    %edx,%edi
+  801cc3:	89 d6                	mov    %edx,%esi
+  801cc5:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801cc7:	eb 99                	jmp    801c62 <sys_fork+0x38>
+
+00801cc9 <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801cc9:	55                   	push   %ebp
+  801cca:	89 e5                	mov    %esp,%ebp
+  801ccc:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801ccf:	ff 75 14             	push   0x14(%ebp)
+  801cd2:	ff 75 10             	push   0x10(%ebp)
+  801cd5:	ff 75 0c             	push   0xc(%ebp)
+  801cd8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cdd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ce0:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801ce5:	e8 81 ee ff ff       	call   800b6b <page_vec_call>
+}
+  801cea:	c9                   	leave
+  801ceb:	c3                   	ret
+
+00801cec <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801cec:	55                   	push   %ebp
+  801ced:	89 e5                	mov    %esp,%ebp
+  801cef:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801cf2:	ff 75 18             	push   0x18(%ebp)
+  801cf5:	ff 75 14             	push   0x14(%ebp)
+  801cf8:	ff 75 10             	push   0x10(%ebp)
+  801cfb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cfe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d01:	b8 10 00 00 00       	mov    $0x10,%eax
+  801d06:	e8 60 ee ff ff       	call   800b6b <page_vec_call>
+}
+  801d0b:	c9                   	leave
+  801d0c:	c3                   	ret
+
+00801d0d <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801d0d:	55                   	push   %ebp
+  801d0e:	89 e5                	mov    %esp,%ebp
+  801d10:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801d13:	ff 75 14             	push   0x14(%ebp)
+  801d16:	ff 75 10             	push   0x10(%ebp)
+  801d19:	ff 75 0c             	push   0xc(%ebp)
+  801d1c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d21:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d24:	b8 11 00 00 00       	mov    $0x11,%eax
+  801d29:	e8 3d ee ff ff       	call   800b6b <page_vec_call>
+}
+  801d2e:	c9                   	leave
+  801d2f:	c3                   	ret
+
+00801d30 <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801d30:	55                   	push   %ebp
+  801d31:	89 e5                	mov    %esp,%ebp
+  801d33:	57                   	push   %edi
+  801d34:	56                   	push   %esi
+  801d35:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801d36:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801d3d:	78 32                	js     801d71 <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801d3f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801d46:	74 75                	je     801dbd <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801d48:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d4e:	b8 12 00 00 00       	mov    $0x12,%eax
+  801d53:	be 00 00 00 00       	mov    $0x0,%esi
+  801d58:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d5b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801d5e:	55                   	push   %ebp
+  801d5f:	68 68 1d 80 00       	push   $0x801d68
+  801d64:	89 e5                	mov    %esp,%ebp
+  801d66:	0f 34                	sysenter
+  801d68:	83 c4 04             	add    $0x4,%esp
+  801d6b:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801d6c:	5b                   	pop    %ebx
+  801d6d:	5e                   	pop    %esi
+  801d6e:	5f                   	pop    %edi
+  801d6f:	5d                   	pop    %ebp
+  801d70:	c3                   	ret
+  801d71:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d76:	0f a2                	cpuid
+		return 0;
+  801d78:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801d7d:	f6 c6 08             	test   $0x8,%dh
+  801d80:	74 15                	je     801d97 <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d82:	89 c2                	mov    %eax,%edx
+  801d84:	c1 ea 08             	shr    $0x8,%edx
+  801d87:	83 e2 0f             	and    $0xf,%edx
+  801d8a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d8f:	83 fa 06             	cmp    $0x6,%edx
+  801d92:	74 0e                	je     801da2 <sys_vm_ranges+0x72>
+  801d94:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801d97:	0f b6 c9             	movzbl %cl,%ecx
+  801d9a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801da0:	eb 9d                	jmp    801d3f <sys_vm_ranges+0xf>
+  801da2:	89 c2                	mov    %eax,%edx
+  801da4:	c1 ea 04             	shr    $0x4,%edx
+  801da7:	83 e2 0f             	and    $0xf,%edx
+  801daa:	83 fa 02             	cmp    $0x2,%edx
+  801dad:	77 e5                	ja     801d94 <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  801daf:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801db2:	83 f8 02             	cmp    $0x2,%eax
+  801db5:	0f 97 c1             	seta   %cl
+  801db8:	0f b6 c9             	movzbl %cl,%ecx
+  801dbb:	eb d7                	jmp    801d94 <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801dbd:	b8 12 00 00 00       	mov    $0x12,%eax
+  801dc2:	be 00 00 00 00       	mov    $0x0,%esi
+  801dc7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801dca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801dcd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801dd0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801dd3:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801dd5:	eb 95                	jmp    801d6c <sys_vm_ranges+0x3c>
+
+00801dd7 <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801dd7:	55                   	push   %ebp
+  801dd8:	89 e5                	mov    %esp,%ebp
+  801dda:	57                   	push   %edi
+  801ddb:	56                   	push   %esi
+  801ddc:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801ddd:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801de4:	78 31                	js     801e17 <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801de6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801ded:	74 74                	je     801e63 <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801def:	be 00 00 00 00       	mov    $0x0,%esi
+  801df4:	8b 55 08             	mov    0x8(%ebp),%edx
+  801df7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801dfa:	b8 14 00 00 00       	mov    $0x14,%eax
+  801dff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e02:	89 f7                	mov    %esi,%edi
+  801e04:	55                   	push   %ebp
+  801e05:	68 0e 1e 80 00       	push   $0x801e0e
+  801e0a:	89 e5                	mov    %esp,%ebp
+  801e0c:	0f 34                	sysenter
+  801e0e:	83 c4 04             	add    $0x4,%esp
+  801e11:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801e12:	5b                   	pop    %ebx
+  801e13:	5e                   	pop    %esi
+  801e14:	5f                   	pop    %edi
+  801e15:	5d                   	pop    %ebp
+  801e16:	c3                   	ret
+  801e17:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e1c:	0f a2                	cpuid
+		return 0;
+  801e1e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801e23:	f6 c6 08             	test   $0x8,%dh
+  801e26:	74 15                	je     801e3d <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e28:	89 c2                	mov    %eax,%edx
+  801e2a:	c1 ea 08             	shr    $0x8,%edx
+  801e2d:	83 e2 0f             	and    $0xf,%edx
+  801e30:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e35:	83 fa 06             	cmp    $0x6,%edx
+  801e38:	74 0e                	je     801e48 <sys_spawn+0x71>
+  801e3a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801e3d:	0f b6 c9             	movzbl %cl,%ecx
+  801e40:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801e46:	eb 9e                	jmp    801de6 <sys_spawn+0xf>
+  801e48:	89 c2                	mov    %eax,%edx
+  801e4a:	c1 ea 04             	shr    $0x4,%edx
+  801e4d:	83 e2 0f             	and    $0xf,%edx
+  801e50:	83 fa 02             	cmp    $0x2,%edx
+  801e53:	77 e5                	ja     801e3a <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  801e55:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e58:	83 f8 02             	cmp    $0x2,%eax
+  801e5b:	0f 97 c1             	seta   %cl
+  801e5e:	0f b6 c9             	movzbl %cl,%ecx
+  801e61:	eb d7                	jmp    801e3a <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  801e63:	be 00 00 00 00       	mov    $0x0,%esi
+  801e68:	b8 14 00 00 00       	mov    $0x14,%eax
+  801e6d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e70:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e73:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e76:	89 f7                	mov    %esi,%edi
+  801e78:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  801e7a:	eb 96                	jmp    801e12 <sys_spawn+0x3b>
+
+00801e7c <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  801e7c:	55                   	push   %ebp
+  801e7d:	89 e5                	mov    %esp,%ebp
+  801e7f:	57                   	push   %edi
+  801e80:	56                   	push   %esi
+  801e81:	53                   	push   %ebx
+  801e82:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801e85:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801e8c:	78 37                	js     801ec5 <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  801e8e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801e95:	74 7a                	je     801f11 <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  801e97:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e9c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e9f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ea2:	b8 15 00 00 00       	mov    $0x15,%eax
+  801ea7:	89 df                	mov    %ebx,%edi
+  801ea9:	89 de                	mov    %ebx,%esi
+  801eab:	55                   	push   %ebp
+  801eac:	68 b5 1e 80 00       	push   $0x801eb5
+  801eb1:	89 e5                	mov    %esp,%ebp
+  801eb3:	0f 34                	sysenter
+  801eb5:	83 c4 04             	add    $0x4,%esp
+  801eb8:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801eb9:	85 c0                	test   %eax,%eax
+  801ebb:	7f 6c                	jg     801f29 <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  801ebd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ec0:	5b                   	pop    %ebx
+  801ec1:	5e                   	pop    %esi
+  801ec2:	5f                   	pop    %edi
+  801ec3:	5d                   	pop    %ebp
+  801ec4:	c3                   	ret
+  801ec5:	b8 01 00 00 00       	mov    $0x1,%eax
+  801eca:	0f a2                	cpuid
+		return 0;
+  801ecc:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801ed1:	f6 c6 08             	test   $0x8,%dh
+  801ed4:	74 15                	je     801eeb <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ed6:	89 c2                	mov    %eax,%edx
+  801ed8:	c1 ea 08             	shr    $0x8,%edx
+  801edb:	83 e2 0f             	and    $0xf,%edx
+  801ede:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ee3:	83 fa 06             	cmp    $0x6,%edx
+  801ee6:	74 0e                	je     801ef6 <sys_shm_create+0x7a>
+  801ee8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801eeb:	0f b6 c9             	movzbl %cl,%ecx
+  801eee:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801ef4:	eb 98                	jmp    801e8e <sys_shm_create+0x12>
+  801ef6:	89 c2                	mov    %eax,%edx
+  801ef8:	c1 ea 04             	shr    $0x4,%edx
+  801efb:	83 e2 0f             	and    $0xf,%edx
+  801efe:	83 fa 02             	cmp    $0x2,%edx
+  801f01:	77 e5                	ja     801ee8 <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  801f03:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f06:	83 f8 02             	cmp    $0x2,%eax
+  801f09:	0f 97 c1             	seta   %cl
+  801f0c:	0f b6 c9             	movzbl %cl,%ecx
+  801f0f:	eb d7                	jmp    801ee8 <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  801f11:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f16:	b8 15 00 00 00       	mov    $0x15,%eax
+  801f1b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f1e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f21:	89 df                	mov    %ebx,%edi
+  801f23:	89 de                	mov    %ebx,%esi
+  801f25:	cd 30                	int    $0x30
+  801f27:	eb 90                	jmp    801eb9 <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801f29:	83 ec 0c             	sub    $0xc,%esp
+  801f2c:	50                   	push   %eax
+  801f2d:	6a 15                	push   $0x15
+  801f2f:	68 d9 2c 80 00       	push   $0x802cd9
+  801f34:	6a 4a                	push   $0x4a
+  801f36:	68 f6 2c 80 00       	push   $0x802cf6
+  801f3b:	e8 e5 e1 ff ff       	call   800125 <_panic>
+
+00801f40 <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  801f40:	55                   	push   %ebp
+  801f41:	89 e5                	mov    %esp,%ebp
+  801f43:	57                   	push   %edi
+  801f44:	56                   	push   %esi
+  801f45:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801f46:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801f4d:	78 32                	js     801f81 <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  801f4f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801f56:	74 75                	je     801fcd <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801f58:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f5b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f5e:	b8 16 00 00 00       	mov    $0x16,%eax
+  801f63:	be 00 00 00 00       	mov    $0x0,%esi
+  801f68:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f6b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801f6e:	55                   	push   %ebp
+  801f6f:	68 78 1f 80 00       	push   $0x801f78
+  801f74:	89 e5                	mov    %esp,%ebp
+  801f76:	0f 34                	sysenter
+  801f78:	83 c4 04             	add    $0x4,%esp
+  801f7b:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  801f7c:	5b                   	pop    %ebx
+  801f7d:	5e                   	pop    %esi
+  801f7e:	5f                   	pop    %edi
+  801f7f:	5d                   	pop    %ebp
+  801f80:	c3                   	ret
+  801f81:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f86:	0f a2                	cpuid
+		return 0;
+  801f88:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801f8d:	f6 c6 08             	test   $0x8,%dh
+  801f90:	74 15                	je     801fa7 <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f92:	89 c2                	mov    %eax,%edx
+  801f94:	c1 ea 08             	shr    $0x8,%edx
+  801f97:	83 e2 0f             	and    $0xf,%edx
+  801f9a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f9f:	83 fa 06             	cmp    $0x6,%edx
+  801fa2:	74 0e                	je     801fb2 <sys_shm_attach+0x72>
+  801fa4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801fa7:	0f b6 c9             	movzbl %cl,%ecx
+  801faa:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801fb0:	eb 9d                	jmp    801f4f <sys_shm_attach+0xf>
+  801fb2:	89 c2                	mov    %eax,%edx
+  801fb4:	c1 ea 04             	shr    $0x4,%edx
+  801fb7:	83 e2 0f             	and    $0xf,%edx
+  801fba:	83 fa 02             	cmp    $0x2,%edx
+  801fbd:	77 e5                	ja     801fa4 <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  801fbf:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fc2:	83 f8 02             	cmp    $0x2,%eax
+  801fc5:	0f 97 c1             	seta   %cl
+  801fc8:	0f b6 c9             	movzbl %cl,%ecx
+  801fcb:	eb d7                	jmp    801fa4 <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  801fcd:	b8 16 00 00 00       	mov    $0x16,%eax
+  801fd2:	be 00 00 00 00       	mov    $0x0,%esi
+  801fd7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fda:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fdd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801fe0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801fe3:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  801fe5:	eb 95                	jmp    801f7c <sys_shm_attach+0x3c>
+
+00801fe7 <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  801fe7:	55                   	push   %ebp
+  801fe8:	89 e5                	mov    %esp,%ebp
+  801fea:	57                   	push   %edi
+  801feb:	56                   	push   %esi
+  801fec:	53                   	push   %ebx
+  801fed:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801ff0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801ff7:	78 38                	js     802031 <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  801ff9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802000:	74 7b                	je     80207d <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  802002:	be 00 00 00 00       	mov    $0x0,%esi
+  802007:	8b 55 08             	mov    0x8(%ebp),%edx
+  80200a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80200d:	b8 17 00 00 00       	mov    $0x17,%eax
+  802012:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802015:	89 f7                	mov    %esi,%edi
+  802017:	55                   	push   %ebp
+  802018:	68 21 20 80 00       	push   $0x802021
+  80201d:	89 e5                	mov    %esp,%ebp
+  80201f:	0f 34                	sysenter
+  802021:	83 c4 04             	add    $0x4,%esp
+  802024:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802025:	85 c0                	test   %eax,%eax
+  802027:	7f 6d                	jg     802096 <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  802029:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80202c:	5b                   	pop    %ebx
+  80202d:	5e                   	pop    %esi
+  80202e:	5f                   	pop    %edi
+  80202f:	5d                   	pop    %ebp
+  802030:	c3                   	ret
+  802031:	b8 01 00 00 00       	mov    $0x1,%eax
+  802036:	0f a2                	cpuid
+		return 0;
+  802038:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80203d:	f6 c6 08             	test   $0x8,%dh
+  802040:	74 15                	je     802057 <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802042:	89 c2                	mov    %eax,%edx
+  802044:	c1 ea 08             	shr    $0x8,%edx
+  802047:	83 e2 0f             	and    $0xf,%edx
+  80204a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80204f:	83 fa 06             	cmp    $0x6,%edx
+  802052:	74 0e                	je     802062 <sys_shm_detach+0x7b>
+  802054:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802057:	0f b6 c9             	movzbl %cl,%ecx
+  80205a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802060:	eb 97                	jmp    801ff9 <sys_shm_detach+0x12>
+  802062:	89 c2                	mov    %eax,%edx
+  802064:	c1 ea 04             	shr    $0x4,%edx
+  802067:	83 e2 0f             	and    $0xf,%edx
+  80206a:	83 fa 02             	cmp    $0x2,%edx
+  80206d:	77 e5                	ja     802054 <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  80206f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802072:	83 f8 02             	cmp    $0x2,%eax
+  802075:	0f 97 c1             	seta   %cl
+  802078:	0f b6 c9             	movzbl %cl,%ecx
+  80207b:	eb d7                	jmp    802054 <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  80207d:	be 00 00 00 00       	mov    $0x0,%esi
+  802082:	b8 17 00 00 00       	mov    $0x17,%eax
+  802087:	8b 55 08             	mov    0x8(%ebp),%edx
+  80208a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80208d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802090:	89 f7                	mov    %esi,%edi
+  802092:	cd 30                	int    $0x30
+  802094:	eb 8f                	jmp    802025 <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802096:	83 ec 0c             	sub    $0xc,%esp
+  802099:	50                   	push   %eax
+  80209a:	6a 17                	push   $0x17
+  80209c:	68 d9 2c 80 00       	push   $0x802cd9
+  8020a1:	6a 4a                	push   $0x4a
+  8020a3:	68 f6 2c 80 00       	push   $0x802cf6
+  8020a8:	e8 78 e0 ff ff       	call   800125 <_panic>
+
+008020ad <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  8020ad:	55                   	push   %ebp
+  8020ae:	89 e5                	mov    %esp,%ebp
+  8020b0:	57                   	push   %edi
+  8020b1:	56                   	push   %esi
+  8020b2:	53                   	push   %ebx
+  8020b3:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8020b6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8020bd:	78 36                	js     8020f5 <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  8020bf:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8020c6:	74 79                	je     802141 <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  8020c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020d0:	b8 18 00 00 00       	mov    $0x18,%eax
+  8020d5:	89 cb                	mov    %ecx,%ebx
+  8020d7:	89 cf                	mov    %ecx,%edi
+  8020d9:	89 ce                	mov    %ecx,%esi
+  8020db:	55                   	push   %ebp
+  8020dc:	68 e5 20 80 00       	push   $0x8020e5
+  8020e1:	89 e5                	mov    %esp,%ebp
+  8020e3:	0f 34                	sysenter
+  8020e5:	83 c4 04             	add    $0x4,%esp
+  8020e8:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8020e9:	85 c0                	test   %eax,%eax
+  8020eb:	7f 6b                	jg     802158 <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  8020ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020f0:	5b                   	pop    %ebx
+  8020f1:	5e                   	pop    %esi
+  8020f2:	5f                   	pop    %edi
+  8020f3:	5d                   	pop    %ebp
+  8020f4:	c3                   	ret
+  8020f5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020fa:	0f a2                	cpuid
+		return 0;
+  8020fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802101:	f6 c6 08             	test   $0x8,%dh
+  802104:	74 15                	je     80211b <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802106:	89 c2                	mov    %eax,%edx
+  802108:	c1 ea 08             	shr    $0x8,%edx
+  80210b:	83 e2 0f             	and    $0xf,%edx
+  80210e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802113:	83 fa 06             	cmp    $0x6,%edx
+  802116:	74 0e                	je     802126 <sys_shm_remove+0x79>
+  802118:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80211b:	0f b6 c9             	movzbl %cl,%ecx
+  80211e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802124:	eb 99                	jmp    8020bf <sys_shm_remove+0x12>
+  802126:	89 c2                	mov    %eax,%edx
+  802128:	c1 ea 04             	shr    $0x4,%edx
+  80212b:	83 e2 0f             	and    $0xf,%edx
+  80212e:	83 fa 02             	cmp    $0x2,%edx
+  802131:	77 e5                	ja     802118 <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  802133:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802136:	83 f8 02             	cmp    $0x2,%eax
+  802139:	0f 97 c1             	seta   %cl
+  80213c:	0f b6 c9             	movzbl %cl,%ecx
+  80213f:	eb d7                	jmp    802118 <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  802141:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802146:	b8 18 00 00 00       	mov    $0x18,%eax
+  80214b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80214e:	89 cb                	mov    %ecx,%ebx
+  802150:	89 cf                	mov    %ecx,%edi
+  802152:	89 ce                	mov    %ecx,%esi
+  802154:	cd 30                	int    $0x30
+  802156:	eb 91                	jmp    8020e9 <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802158:	83 ec 0c             	sub    $0xc,%esp
+  80215b:	50                   	push   %eax
+  80215c:	6a 18                	push   $0x18
+  80215e:	68 d9 2c 80 00       	push   $0x802cd9
+  802163:	6a 4a                	push   $0x4a
+  802165:	68 f6 2c 80 00       	push   $0x802cf6
+  80216a:	e8 b6 df ff ff       	call   800125 <_panic>
+
+0080216f <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  80216f:	55                   	push   %ebp
+  802170:	89 e5                	mov    %esp,%ebp
+  802172:	57                   	push   %edi
+  802173:	56                   	push   %esi
+  802174:	53                   	push   %ebx
+  802175:	83 ec 0c             	sub    $0xc,%esp
+  802178:	8b 45 10             	mov    0x10(%ebp),%eax
+  80217b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80217e:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  802181:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802188:	78 32                	js     8021bc <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  80218a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802191:	74 75                	je     802208 <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  802193:	8b 55 08             	mov    0x8(%ebp),%edx
+  802196:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802199:	b8 20 00 00 00       	mov    $0x20,%eax
+  80219e:	be 00 00 00 00       	mov    $0x0,%esi
+  8021a3:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8021a6:	55                   	push   %ebp
+  8021a7:	68 b0 21 80 00       	push   $0x8021b0
+  8021ac:	89 e5                	mov    %esp,%ebp
+  8021ae:	0f 34                	sysenter
+  8021b0:	83 c4 04             	add    $0x4,%esp
+  8021b3:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  8021b4:	83 c4 0c             	add    $0xc,%esp
+  8021b7:	5b                   	pop    %ebx
+  8021b8:	5e                   	pop    %esi
+  8021b9:	5f                   	pop    %edi
+  8021ba:	5d                   	pop    %ebp
+  8021bb:	c3                   	ret
+  8021bc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021c1:	0f a2                	cpuid
+		return 0;
+  8021c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8021c8:	f6 c6 08             	test   $0x8,%dh
+  8021cb:	74 15                	je     8021e2 <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021cd:	89 c2                	mov    %eax,%edx
+  8021cf:	c1 ea 08             	shr    $0x8,%edx
+  8021d2:	83 e2 0f             	and    $0xf,%edx
+  8021d5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8021da:	83 fa 06             	cmp    $0x6,%edx
+  8021dd:	74 0e                	je     8021ed <sys_futex_wait+0x7e>
+  8021df:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8021e2:	0f b6 c9             	movzbl %cl,%ecx
+  8021e5:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8021eb:	eb 9d                	jmp    80218a <sys_futex_wait+0x1b>
+  8021ed:	89 c2                	mov    %eax,%edx
+  8021ef:	c1 ea 04             	shr    $0x4,%edx
+  8021f2:	83 e2 0f             	and    $0xf,%edx
+  8021f5:	83 fa 02             	cmp    $0x2,%edx
+  8021f8:	77 e5                	ja     8021df <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  8021fa:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021fd:	83 f8 02             	cmp    $0x2,%eax
+  802200:	0f 97 c1             	seta   %cl
+  802203:	0f b6 c9             	movzbl %cl,%ecx
+  802206:	eb d7                	jmp    8021df <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  802208:	b8 20 00 00 00       	mov    $0x20,%eax
+  80220d:	be 00 00 00 00       	mov    $0x0,%esi
+  802212:	8b 55 08             	mov    0x8(%ebp),%edx
+  802215:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802218:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  80221b:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  80221d:	eb 95                	jmp    8021b4 <sys_futex_wait+0x45>
+
+0080221f <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80221f:	55                   	push   %ebp
+  802220:	89 e5                	mov    %esp,%ebp
+  802222:	57                   	push   %edi
+  802223:	56                   	push   %esi
+  802224:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802225:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80222c:	78 30                	js     80225e <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  80222e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802235:	74 73                	je     8022aa <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  802237:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80223c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80223f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802242:	b8 21 00 00 00       	mov    $0x21,%eax
+  802247:	89 df                	mov    %ebx,%edi
+  802249:	89 de                	mov    %ebx,%esi
+  80224b:	55                   	push   %ebp
+  80224c:	68 55 22 80 00       	push   $0x802255
+  802251:	89 e5                	mov    %esp,%ebp
+  802253:	0f 34                	sysenter
+  802255:	83 c4 04             	add    $0x4,%esp
+  802258:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  802259:	5b                   	pop    %ebx
+  80225a:	5e                   	pop    %esi
+  80225b:	5f                   	pop    %edi
+  80225c:	5d                   	pop    %ebp
+  80225d:	c3                   	ret
+  80225e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802263:	0f a2                	cpuid
+		return 0;
+  802265:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80226a:	f6 c6 08             	test   $0x8,%dh
+  80226d:	74 15                	je     802284 <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80226f:	89 c2                	mov    %eax,%edx
+  802271:	c1 ea 08             	shr    $0x8,%edx
+  802274:	83 e2 0f             	and    $0xf,%edx
+  802277:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80227c:	83 fa 06             	cmp    $0x6,%edx
+  80227f:	74 0e                	je     80228f <sys_futex_wake+0x70>
+  802281:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802284:	0f b6 c9             	movzbl %cl,%ecx
+  802287:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80228d:	eb 9f                	jmp    80222e <sys_futex_wake+0xf>
+  80228f:	89 c2                	mov    %eax,%edx
+  802291:	c1 ea 04             	shr    $0x4,%edx
+  802294:	83 e2 0f             	and    $0xf,%edx
+  802297:	83 fa 02             	cmp    $0x2,%edx
+  80229a:	77 e5                	ja     802281 <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  80229c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80229f:	83 f8 02             	cmp    $0x2,%eax
+  8022a2:	0f 97 c1             	seta   %cl
+  8022a5:	0f b6 c9             	movzbl %cl,%ecx
+  8022a8:	eb d7                	jmp    802281 <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  8022aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022af:	b8 21 00 00 00       	mov    $0x21,%eax
+  8022b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022ba:	89 df                	mov    %ebx,%edi
+  8022bc:	89 de                	mov    %ebx,%esi
+  8022be:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  8022c0:	eb 97                	jmp    802259 <sys_futex_wake+0x3a>
+
+008022c2 <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  8022c2:	55                   	push   %ebp
+  8022c3:	89 e5                	mov    %esp,%ebp
+  8022c5:	57                   	push   %edi
+  8022c6:	56                   	push   %esi
+  8022c7:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8022c8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8022cf:	78 2e                	js     8022ff <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  8022d1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8022d8:	74 71                	je     80234b <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  8022da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022df:	b8 22 00 00 00       	mov    $0x22,%eax
+  8022e4:	89 d1                	mov    %edx,%ecx
+  8022e6:	89 d3                	mov    %edx,%ebx
+  8022e8:	89 d7                	mov    %edx,%edi
+  8022ea:	89 d6                	mov    %edx,%esi
+  8022ec:	55                   	push   %ebp
+  8022ed:	68 f6 22 80 00       	push   $0x8022f6
+  8022f2:	89 e5                	mov    %esp,%ebp
+  8022f4:	0f 34                	sysenter
+  8022f6:	83 c4 04             	add    $0x4,%esp
+  8022f9:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  8022fa:	5b                   	pop    %ebx
+  8022fb:	5e                   	pop    %esi
+  8022fc:	5f                   	pop    %edi
+  8022fd:	5d                   	pop    %ebp
+  8022fe:	c3                   	ret
+  8022ff:	b8 01 00 00 00       	mov    $0x1,%eax
+  802304:	0f a2                	cpuid
+		return 0;
+  802306:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80230b:	f6 c6 08             	test   $0x8,%dh
+  80230e:	74 15                	je     802325 <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802310:	89 c2                	mov    %eax,%edx
+  802312:	c1 ea 08             	shr    $0x8,%edx
+  802315:	83 e2 0f             	and    $0xf,%edx
+  802318:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80231d:	83 fa 06             	cmp    $0x6,%edx
+  802320:	74 0e                	je     802330 <sys_ep_create+0x6e>
+  802322:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802325:	0f b6 c9             	movzbl %cl,%ecx
+  802328:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80232e:	eb a1                	jmp    8022d1 <sys_ep_create+0xf>
+  802330:	89 c2                	mov    %eax,%edx
+  802332:	c1 ea 04             	shr    $0x4,%edx
+  802335:	83 e2 0f             	and    $0xf,%edx
+  802338:	83 fa 02             	cmp    $0x2,%edx
+  80233b:	77 e5                	ja     802322 <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  80233d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802340:	83 f8 02             	cmp    $0x2,%eax
+  802343:	0f 97 c1             	seta   %cl
+  802346:	0f b6 c9             	movzbl %cl,%ecx
+  802349:	eb d7                	jmp    802322 <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  80234b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802350:	b8 22 00 00 00       	mov    $0x22,%eax
+  802355:	89 d1                	mov    %edx,%ecx
+  802357:	89 d3                	mov    %edx,%ebx
+  802359:	89 d7                	mov    %edx,%edi
+  80235b:	89 d6                	mov    %edx,%esi
+  80235d:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  80235f:	eb 99                	jmp    8022fa <sys_ep_create+0x38>
+
+00802361 <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  802361:	55                   	push   %ebp
+  802362:	89 e5                	mov    %esp,%ebp
+  802364:	57                   	push   %edi
+  802365:	56                   	push   %esi
+  802366:	53                   	push   %ebx
+  802367:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80236a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802371:	78 36                	js     8023a9 <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  802373:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80237a:	74 79                	je     8023f5 <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  80237c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80237f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802384:	b8 23 00 00 00       	mov    $0x23,%eax
+  802389:	89 cb                	mov    %ecx,%ebx
+  80238b:	89 cf                	mov    %ecx,%edi
+  80238d:	89 ce                	mov    %ecx,%esi
+  80238f:	55                   	push   %ebp
+  802390:	68 99 23 80 00       	push   $0x802399
+  802395:	89 e5                	mov    %esp,%ebp
+  802397:	0f 34                	sysenter
+  802399:	83 c4 04             	add    $0x4,%esp
+  80239c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80239d:	85 c0                	test   %eax,%eax
+  80239f:	7f 6b                	jg     80240c <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  8023a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023a4:	5b                   	pop    %ebx
+  8023a5:	5e                   	pop    %esi
+  8023a6:	5f                   	pop    %edi
+  8023a7:	5d                   	pop    %ebp
+  8023a8:	c3                   	ret
+  8023a9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023ae:	0f a2                	cpuid
+		return 0;
+  8023b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8023b5:	f6 c6 08             	test   $0x8,%dh
+  8023b8:	74 15                	je     8023cf <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023ba:	89 c2                	mov    %eax,%edx
+  8023bc:	c1 ea 08             	shr    $0x8,%edx
+  8023bf:	83 e2 0f             	and    $0xf,%edx
+  8023c2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8023c7:	83 fa 06             	cmp    $0x6,%edx
+  8023ca:	74 0e                	je     8023da <sys_ep_destroy+0x79>
+  8023cc:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8023cf:	0f b6 c9             	movzbl %cl,%ecx
+  8023d2:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8023d8:	eb 99                	jmp    802373 <sys_ep_destroy+0x12>
+  8023da:	89 c2                	mov    %eax,%edx
+  8023dc:	c1 ea 04             	shr    $0x4,%edx
+  8023df:	83 e2 0f             	and    $0xf,%edx
+  8023e2:	83 fa 02             	cmp    $0x2,%edx
+  8023e5:	77 e5                	ja     8023cc <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  8023e7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023ea:	83 f8 02             	cmp    $0x2,%eax
+  8023ed:	0f 97 c1             	seta   %cl
+  8023f0:	0f b6 c9             	movzbl %cl,%ecx
+  8023f3:	eb d7                	jmp    8023cc <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  8023f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023fa:	b8 23 00 00 00       	mov    $0x23,%eax
+  8023ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  802402:	89 cb                	mov    %ecx,%ebx
+  802404:	89 cf                	mov    %ecx,%edi
+  802406:	89 ce                	mov    %ecx,%esi
+  802408:	cd 30                	int    $0x30
+  80240a:	eb 91                	jmp    80239d <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80240c:	83 ec 0c             	sub    $0xc,%esp
+  80240f:	50                   	push   %eax
+  802410:	6a 23                	push   $0x23
+  802412:	68 d9 2c 80 00       	push   $0x802cd9
+  802417:	6a 4a                	push   $0x4a
+  802419:	68 f6 2c 80 00       	push   $0x802cf6
+  80241e:	e8 02 dd ff ff       	call   800125 <_panic>
+
+00802423 <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  802423:	55                   	push   %ebp
+  802424:	89 e5                	mov    %esp,%ebp
+  802426:	57                   	push   %edi
+  802427:	56                   	push   %esi
+  802428:	53                   	push   %ebx
+  802429:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80242c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802433:	78 37                	js     80246c <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  802435:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80243c:	74 7a                	je     8024b8 <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  80243e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802443:	8b 55 08             	mov    0x8(%ebp),%edx
+  802446:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802449:	b8 24 00 00 00       	mov    $0x24,%eax
+  80244e:	89 df                	mov    %ebx,%edi
+  802450:	89 de                	mov    %ebx,%esi
+  802452:	55                   	push   %ebp
+  802453:	68 5c 24 80 00       	push   $0x80245c
+  802458:	89 e5                	mov    %esp,%ebp
+  80245a:	0f 34                	sysenter
+  80245c:	83 c4 04             	add    $0x4,%esp
+  80245f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802460:	85 c0                	test   %eax,%eax
+  802462:	7f 6c                	jg     8024d0 <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  802464:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802467:	5b                   	pop    %ebx
+  802468:	5e                   	pop    %esi
+  802469:	5f                   	pop    %edi
+  80246a:	5d                   	pop    %ebp
+  80246b:	c3                   	ret
+  80246c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802471:	0f a2                	cpuid
+		return 0;
+  802473:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802478:	f6 c6 08             	test   $0x8,%dh
+  80247b:	74 15                	je     802492 <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80247d:	89 c2                	mov    %eax,%edx
+  80247f:	c1 ea 08             	shr    $0x8,%edx
+  802482:	83 e2 0f             	and    $0xf,%edx
+  802485:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80248a:	83 fa 06             	cmp    $0x6,%edx
+  80248d:	74 0e                	je     80249d <sys_ep_grant+0x7a>
+  80248f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802492:	0f b6 c9             	movzbl %cl,%ecx
+  802495:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80249b:	eb 98                	jmp    802435 <sys_ep_grant+0x12>
+  80249d:	89 c2                	mov    %eax,%edx
+  80249f:	c1 ea 04             	shr    $0x4,%edx
+  8024a2:	83 e2 0f             	and    $0xf,%edx
+  8024a5:	83 fa 02             	cmp    $0x2,%edx
+  8024a8:	77 e5                	ja     80248f <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  8024aa:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8024ad:	83 f8 02             	cmp    $0x2,%eax
+  8024b0:	0f 97 c1             	seta   %cl
+  8024b3:	0f b6 c9             	movzbl %cl,%ecx
+  8024b6:	eb d7                	jmp    80248f <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  8024b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024bd:	b8 24 00 00 00       	mov    $0x24,%eax
+  8024c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024c8:	89 df                	mov    %ebx,%edi
+  8024ca:	89 de                	mov    %ebx,%esi
+  8024cc:	cd 30                	int    $0x30
+  8024ce:	eb 90                	jmp    802460 <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8024d0:	83 ec 0c             	sub    $0xc,%esp
+  8024d3:	50                   	push   %eax
+  8024d4:	6a 24                	push   $0x24
+  8024d6:	68 d9 2c 80 00       	push   $0x802cd9
+  8024db:	6a 4a                	push   $0x4a
+  8024dd:	68 f6 2c 80 00       	push   $0x802cf6
+  8024e2:	e8 3e dc ff ff       	call   800125 <_panic>
+
+008024e7 <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  8024e7:	55                   	push   %ebp
+  8024e8:	89 e5                	mov    %esp,%ebp
+  8024ea:	57                   	push   %edi
+  8024eb:	56                   	push   %esi
+  8024ec:	53                   	push   %ebx
+  8024ed:	83 ec 20             	sub    $0x20,%esp
+  8024f0:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  8024f3:	8b 10                	mov    (%eax),%edx
+  8024f5:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8024f8:	8b 50 04             	mov    0x4(%eax),%edx
+  8024fb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8024fe:	8b 50 08             	mov    0x8(%eax),%edx
+  802501:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  802504:	8b 50 0c             	mov    0xc(%eax),%edx
+  802507:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  80250a:	8b 40 10             	mov    0x10(%eax),%eax
+  80250d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  802510:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  802513:	8b 55 08             	mov    0x8(%ebp),%edx
+  802516:	b8 25 00 00 00       	mov    $0x25,%eax
+  80251b:	55                   	push   %ebp
+  80251c:	56                   	push   %esi
+  80251d:	8b 0e                	mov    (%esi),%ecx
+  80251f:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802522:	8b 7e 08             	mov    0x8(%esi),%edi
+  802525:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802528:	8b 76 0c             	mov    0xc(%esi),%esi
+  80252b:	cd 30                	int    $0x30
+  80252d:	87 34 24             	xchg   %esi,(%esp)
+  802530:	89 0e                	mov    %ecx,(%esi)
+  802532:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802535:	89 7e 08             	mov    %edi,0x8(%esi)
+  802538:	89 6e 10             	mov    %ebp,0x10(%esi)
+  80253b:	8f 46 0c             	pop    0xc(%esi)
+  80253e:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  80253f:	83 c4 20             	add    $0x20,%esp
+  802542:	5b                   	pop    %ebx
+  802543:	5e                   	pop    %esi
+  802544:	5f                   	pop    %edi
+  802545:	5d                   	pop    %ebp
+  802546:	c3                   	ret
+
+00802547 <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  802547:	55                   	push   %ebp
+  802548:	89 e5                	mov    %esp,%ebp
+  80254a:	57                   	push   %edi
+  80254b:	56                   	push   %esi
+  80254c:	53                   	push   %ebx
+  80254d:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  802550:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802553:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  802555:	8b 55 08             	mov    0x8(%ebp),%edx
+  802558:	b8 26 00 00 00       	mov    $0x26,%eax
+  80255d:	55                   	push   %ebp
+  80255e:	56                   	push   %esi
+  80255f:	8b 0e                	mov    (%esi),%ecx
+  802561:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802564:	8b 7e 08             	mov    0x8(%esi),%edi
+  802567:	8b 6e 10             	mov    0x10(%esi),%ebp
+  80256a:	8b 76 0c             	mov    0xc(%esi),%esi
+  80256d:	cd 30                	int    $0x30
+  80256f:	87 34 24             	xchg   %esi,(%esp)
+  802572:	89 0e                	mov    %ecx,(%esi)
+  802574:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802577:	89 7e 08             	mov    %edi,0x8(%esi)
+  80257a:	89 6e 10             	mov    %ebp,0x10(%esi)
+  80257d:	8f 46 0c             	pop    0xc(%esi)
+  802580:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  802581:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  802585:	74 0f                	je     802596 <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  802587:	85 c0                	test   %eax,%eax
+  802589:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80258e:	0f 48 d1             	cmovs  %ecx,%edx
+  802591:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  802594:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  802596:	5b                   	pop    %ebx
+  802597:	5e                   	pop    %esi
+  802598:	5f                   	pop    %edi
+  802599:	5d                   	pop    %ebp
+  80259a:	c3                   	ret
+
+0080259b <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  80259b:	55                   	push   %ebp
+  80259c:	89 e5                	mov    %esp,%ebp
+  80259e:	57                   	push   %edi
+  80259f:	56                   	push   %esi
+  8025a0:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8025a1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8025a8:	78 2f                	js     8025d9 <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  8025aa:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8025b1:	74 72                	je     802625 <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  8025b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025bb:	b8 27 00 00 00       	mov    $0x27,%eax
+  8025c0:	89 cb                	mov    %ecx,%ebx
+  8025c2:	89 cf                	mov    %ecx,%edi
+  8025c4:	89 ce                	mov    %ecx,%esi
+  8025c6:	55                   	push   %ebp
+  8025c7:	68 d0 25 80 00       	push   $0x8025d0
+  8025cc:	89 e5                	mov    %esp,%ebp
+  8025ce:	0f 34                	sysenter
+  8025d0:	83 c4 04             	add    $0x4,%esp
+  8025d3:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  8025d4:	5b                   	pop    %ebx
+  8025d5:	5e                   	pop    %esi
+  8025d6:	5f                   	pop    %edi
+  8025d7:	5d                   	pop    %ebp
+  8025d8:	c3                   	ret
+  8025d9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025de:	0f a2                	cpuid
+		return 0;
+  8025e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8025e5:	f6 c6 08             	test   $0x8,%dh
+  8025e8:	74 15                	je     8025ff <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025ea:	89 c2                	mov    %eax,%edx
+  8025ec:	c1 ea 08             	shr    $0x8,%edx
+  8025ef:	83 e2 0f             	and    $0xf,%edx
+  8025f2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8025f7:	83 fa 06             	cmp    $0x6,%edx
+  8025fa:	74 0e                	je     80260a <sys_sysring_setup+0x6f>
+  8025fc:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8025ff:	0f b6 c9             	movzbl %cl,%ecx
+  802602:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802608:	eb a0                	jmp    8025aa <sys_sysring_setup+0xf>
+  80260a:	89 c2                	mov    %eax,%edx
+  80260c:	c1 ea 04             	shr    $0x4,%edx
+  80260f:	83 e2 0f             	and    $0xf,%edx
+  802612:	83 fa 02             	cmp    $0x2,%edx
+  802615:	77 e5                	ja     8025fc <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  802617:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80261a:	83 f8 02             	cmp    $0x2,%eax
+  80261d:	0f 97 c1             	seta   %cl
+  802620:	0f b6 c9             	movzbl %cl,%ecx
+  802623:	eb d7                	jmp    8025fc <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  802625:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80262a:	b8 27 00 00 00       	mov    $0x27,%eax
+  80262f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802632:	89 cb                	mov    %ecx,%ebx
+  802634:	89 cf                	mov    %ecx,%edi
+  802636:	89 ce                	mov    %ecx,%esi
+  802638:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  80263a:	eb 98                	jmp    8025d4 <sys_sysring_setup+0x39>
+
+0080263c <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  80263c:	55                   	push   %ebp
+  80263d:	89 e5                	mov    %esp,%ebp
+  80263f:	57                   	push   %edi
+  802640:	56                   	push   %esi
+  802641:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802642:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802649:	78 2e                	js     802679 <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  80264b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802652:	74 71                	je     8026c5 <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  802654:	ba 00 00 00 00       	mov    $0x0,%edx
+  802659:	b8 28 00 00 00       	mov    $0x28,%eax
+  80265e:	89 d1                	mov    %edx,%ecx
+  802660:	89 d3                	mov    %edx,%ebx
+  802662:	89 d7                	mov    %edx,%edi
+  802664:	89 d6                	mov    %edx,%esi
+  802666:	55                   	push   %ebp
+  802667:	68 70 26 80 00       	push   $0x802670
+  80266c:	89 e5                	mov    %esp,%ebp
+  80266e:	0f 34                	sysenter
+  802670:	83 c4 04             	add    $0x4,%esp
+  802673:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  802674:	5b                   	pop    %ebx
+  802675:	5e                   	pop    %esi
+  802676:	5f                   	pop    %edi
+  802677:	5d                   	pop    %ebp
+  802678:	c3                   	ret
+  802679:	b8 01 00 00 00       	mov    $0x1,%eax
+  80267e:	0f a2                	cpuid
+		return 0;
+  802680:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802685:	f6 c6 08             	test   $0x8,%dh
+  802688:	74 15                	je     80269f <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80268a:	89 c2                	mov    %eax,%edx
+  80268c:	c1 ea 08             	shr    $0x8,%edx
+  80268f:	83 e2 0f             	and    $0xf,%edx
+  802692:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802697:	83 fa 06             	cmp    $0x6,%edx
+  80269a:	74 0e                	je     8026aa <sys_sysring_enter+0x6e>
+  80269c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80269f:	0f b6 c9             	movzbl %cl,%ecx
+  8026a2:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8026a8:	eb a1                	jmp    80264b <sys_sysring_enter+0xf>
+  8026aa:	89 c2                	mov    %eax,%edx
+  8026ac:	c1 ea 04             	shr    $0x4,%edx
+  8026af:	83 e2 0f             	and    $0xf,%edx
+  8026b2:	83 fa 02             	cmp    $0x2,%edx
+  8026b5:	77 e5                	ja     80269c <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  8026b7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8026ba:	83 f8 02             	cmp    $0x2,%eax
+  8026bd:	0f 97 c1             	seta   %cl
+  8026c0:	0f b6 c9             	movzbl %cl,%ecx
+  8026c3:	eb d7                	jmp    80269c <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  8026c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026ca:	b8 28 00 00 00       	mov    $0x28,%eax
+  8026cf:	89 d1                	mov    %edx,%ecx
+  8026d1:	89 d3                	mov    %edx,%ebx
+  8026d3:	89 d7                	mov    %edx,%edi
+  8026d5:	89 d6                	mov    %edx,%esi
+  8026d7:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  8026d9:	eb 99                	jmp    802674 <sys_sysring_enter+0x38>
+
+008026db <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8026db:	55                   	push   %ebp
+  8026dc:	89 e5                	mov    %esp,%ebp
+  8026de:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8026e1:	83 3d 0c 30 80 00 00 	cmpl   $0x0,0x80300c
+  8026e8:	74 0a                	je     8026f4 <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8026ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026ed:	a3 0c 30 80 00       	mov    %eax,0x80300c
+}
+  8026f2:	c9                   	leave
+  8026f3:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE),
+  8026f4:	83 ec 04             	sub    $0x4,%esp
+  8026f7:	6a 07                	push   $0x7
+  8026f9:	68 00 f0 bf ee       	push   $0xeebff000
+  8026fe:	6a 00                	push   $0x0
+  802700:	e8 57 e9 ff ff       	call   80105c <sys_page_alloc>
+  802705:	83 c4 10             	add    $0x10,%esp
+  802708:	85 c0                	test   %eax,%eax
+  80270a:	78 28                	js     802734 <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  80270c:	83 ec 08             	sub    $0x8,%esp
+  80270f:	68 46 27 80 00       	push   $0x802746
+  802714:	6a 00                	push   $0x0
+  802716:	e8 00 f0 ff ff       	call   80171b <sys_env_set_pgfault_upcall>
+  80271b:	83 c4 10             	add    $0x10,%esp
+  80271e:	85 c0                	test   %eax,%eax
+  802720:	79 c8                	jns    8026ea <set_pgfault_handler+0xf>
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+  802722:	50                   	push   %eax
+  802723:	68 2c 2d 80 00       	push   $0x802d2c
+  802728:	6a 24                	push   $0x24
+  80272a:	68 60 2d 80 00       	push   $0x802d60
+  80272f:	e8 f1 d9 ff ff       	call   800125 <_panic>
+			panic("set_pgfault_handler: sys_page_alloc: %e", r);
+  802734:	50                   	push   %eax
+  802735:	68 04 2d 80 00       	push   $0x802d04
+  80273a:	6a 22                	push   $0x22
+  80273c:	68 60 2d 80 00       	push   $0x802d60
+  802741:	e8 df d9 ff ff       	call   800125 <_panic>
+
+00802746 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802746:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802747:	a1 0c 30 80 00       	mov    0x80300c,%eax
+	call *%eax
+  80274c:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80274e:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 0x28(%esp), %ebx		// trap-time eip
+  802751:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl 0x30(%esp), %eax		// trap-time esp
+  802755:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  802759:	83 e8 04             	sub    $0x4,%eax
+	movl %ebx, (%eax)
+  80275c:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 0x30(%esp)
+  80275e:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp			// skip fault_va and err
+  802762:	83 c4 08             	add    $0x8,%esp
+	popal
+  802765:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp			// skip eip
+  802766:	83 c4 04             	add    $0x4,%esp
+	popfl
+  802769:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  80276a:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80276b:	c3                   	ret
+
+0080276c <dm>:
+  80276c:	55                   	push   %ebp
+  80276d:	57                   	push   %edi
+  80276e:	56                   	push   %esi
+  80276f:	53                   	push   %ebx
+  802770:	83 ec 24             	sub    $0x24,%esp
+  802773:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802777:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80277b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80277f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802783:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802787:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80278b:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  80278f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802794:	ba 00 00 00 00       	mov    $0x0,%edx
+  802799:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80279e:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8027a5:	00 
+  8027a6:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8027ad:	00 
+  8027ae:	89 fb                	mov    %edi,%ebx
+  8027b0:	eb 08                	jmp    8027ba <dm+0x4e>
+  8027b2:	83 e9 01             	sub    $0x1,%ecx
+  8027b5:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8027b8:	74 68                	je     802822 <dm+0xb6>
+  8027ba:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8027be:	01 c0                	add    %eax,%eax
+  8027c0:	89 c6                	mov    %eax,%esi
+  8027c2:	89 d7                	mov    %edx,%edi
+  8027c4:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8027c8:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8027cc:	0f ad d0             	shrd   %cl,%edx,%eax
+  8027cf:	d3 ea                	shr    %cl,%edx
+  8027d1:	f6 c1 20             	test   $0x20,%cl
+  8027d4:	74 04                	je     8027da <dm+0x6e>
+  8027d6:	89 d0                	mov    %edx,%eax
+  8027d8:	31 d2                	xor    %edx,%edx
+  8027da:	83 e0 01             	and    $0x1,%eax
+  8027dd:	89 04 24             	mov    %eax,(%esp)
+  8027e0:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8027e7:	00 
+  8027e8:	8b 04 24             	mov    (%esp),%eax
+  8027eb:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8027ef:	09 f0                	or     %esi,%eax
+  8027f1:	09 fa                	or     %edi,%edx
+  8027f3:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8027f7:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8027fb:	39 f0                	cmp    %esi,%eax
+  8027fd:	89 d5                	mov    %edx,%ebp
+  8027ff:	19 fd                	sbb    %edi,%ebp
+  802801:	72 af                	jb     8027b2 <dm+0x46>
+  802803:	29 f0                	sub    %esi,%eax
+  802805:	19 fa                	sbb    %edi,%edx
+  802807:	89 cf                	mov    %ecx,%edi
+  802809:	c1 ef 05             	shr    $0x5,%edi
+  80280c:	83 e7 01             	and    $0x1,%edi
+  80280f:	89 fe                	mov    %edi,%esi
+  802811:	83 f6 01             	xor    $0x1,%esi
+  802814:	d3 e6                	shl    %cl,%esi
+  802816:	d3 e7                	shl    %cl,%edi
+  802818:	09 74 24 18          	or     %esi,0x18(%esp)
+  80281c:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802820:	eb 90                	jmp    8027b2 <dm+0x46>
+  802822:	85 db                	test   %ebx,%ebx
+  802824:	74 05                	je     80282b <dm+0xbf>
+  802826:	89 03                	mov    %eax,(%ebx)
+  802828:	89 53 04             	mov    %edx,0x4(%ebx)
+  80282b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80282f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802833:	83 c4 24             	add    $0x24,%esp
+  802836:	5b                   	pop    %ebx
+  802837:	5e                   	pop    %esi
+  802838:	5f                   	pop    %edi
+  802839:	5d                   	pop    %ebp
+  80283a:	c3                   	ret
+
+0080283b <__udivdi3>:
+  80283b:	83 ec 08             	sub    $0x8,%esp
+  80283e:	6a 00                	push   $0x0
+  802840:	ff 74 24 1c          	push   0x1c(%esp)
+  802844:	ff 74 24 1c          	push   0x1c(%esp)
+  802848:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80284c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802850:	e8 17 ff ff ff       	call   80276c <dm>
+  802855:	83 c4 14             	add    $0x14,%esp
+  802858:	c3                   	ret
+
+00802859 <__umoddi3>:
+  802859:	83 ec 18             	sub    $0x18,%esp
+  80285c:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802860:	50                   	push   %eax
+  802861:	ff 74 24 2c          	push   0x2c(%esp)
+  802865:	ff 74 24 2c          	push   0x2c(%esp)
+  802869:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80286d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802871:	e8 f6 fe ff ff       	call   80276c <dm>
+  802876:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80287a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80287e:	83 c4 24             	add    $0x24,%esp
+  802881:	c3                   	ret
+
+00802882 <__divdi3>:
+  802882:	53                   	push   %ebx
+  802883:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802887:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80288b:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80288f:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  802893:	85 d2                	test   %edx,%edx
+  802895:	78 15                	js     8028ac <__divdi3+0x2a>
+  802897:	85 db                	test   %ebx,%ebx
+  802899:	78 34                	js     8028cf <__divdi3+0x4d>
+  80289b:	83 ec 04             	sub    $0x4,%esp
+  80289e:	6a 00                	push   $0x0
+  8028a0:	53                   	push   %ebx
+  8028a1:	51                   	push   %ecx
+  8028a2:	e8 c5 fe ff ff       	call   80276c <dm>
+  8028a7:	83 c4 10             	add    $0x10,%esp
+  8028aa:	eb 21                	jmp    8028cd <__divdi3+0x4b>
+  8028ac:	f7 d8                	neg    %eax
+  8028ae:	83 d2 00             	adc    $0x0,%edx
+  8028b1:	f7 da                	neg    %edx
+  8028b3:	85 db                	test   %ebx,%ebx
+  8028b5:	78 30                	js     8028e7 <__divdi3+0x65>
+  8028b7:	83 ec 04             	sub    $0x4,%esp
+  8028ba:	6a 00                	push   $0x0
+  8028bc:	53                   	push   %ebx
+  8028bd:	51                   	push   %ecx
+  8028be:	e8 a9 fe ff ff       	call   80276c <dm>
+  8028c3:	83 c4 10             	add    $0x10,%esp
+  8028c6:	f7 d8                	neg    %eax
+  8028c8:	83 d2 00             	adc    $0x0,%edx
+  8028cb:	f7 da                	neg    %edx
+  8028cd:	5b                   	pop    %ebx
+  8028ce:	c3                   	ret
+  8028cf:	83 ec 04             	sub    $0x4,%esp
+  8028d2:	6a 00                	push   $0x0
+  8028d4:	f7 d9                	neg    %ecx
+  8028d6:	83 d3 00             	adc    $0x0,%ebx
+  8028d9:	f7 db                	neg    %ebx
+  8028db:	53                   	push   %ebx
+  8028dc:	51                   	push   %ecx
+  8028dd:	e8 8a fe ff ff       	call   80276c <dm>
+  8028e2:	83 c4 10             	add    $0x10,%esp
+  8028e5:	eb df                	jmp    8028c6 <__divdi3+0x44>
+  8028e7:	83 ec 04             	sub    $0x4,%esp
+  8028ea:	6a 00                	push   $0x0
+  8028ec:	f7 d9                	neg    %ecx
+  8028ee:	83 d3 00             	adc    $0x0,%ebx
+  8028f1:	f7 db                	neg    %ebx
+  8028f3:	53                   	push   %ebx
+  8028f4:	51                   	push   %ecx
+  8028f5:	e8 72 fe ff ff       	call   80276c <dm>
+  8028fa:	83 c4 10             	add    $0x10,%esp
+  8028fd:	eb ce                	jmp    8028cd <__divdi3+0x4b>
+
+008028ff <__moddi3>:
+  8028ff:	55                   	push   %ebp
+  802900:	57                   	push   %edi
+  802901:	56                   	push   %esi
+  802902:	53                   	push   %ebx
+  802903:	83 ec 18             	sub    $0x18,%esp
+  802906:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  80290a:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80290e:	89 f1                	mov    %esi,%ecx
+  802910:	f7 d9                	neg    %ecx
+  802912:	89 da                	mov    %ebx,%edx
+  802914:	83 d2 00             	adc    $0x0,%edx
+  802917:	f7 da                	neg    %edx
+  802919:	0f 48 ce             	cmovs  %esi,%ecx
+  80291c:	0f 48 d3             	cmovs  %ebx,%edx
+  80291f:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802923:	50                   	push   %eax
+  802924:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802928:	f7 de                	neg    %esi
+  80292a:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  80292e:	83 d0 00             	adc    $0x0,%eax
+  802931:	f7 d8                	neg    %eax
+  802933:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802938:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  80293d:	50                   	push   %eax
+  80293e:	56                   	push   %esi
+  80293f:	89 c8                	mov    %ecx,%eax
+  802941:	e8 26 fe ff ff       	call   80276c <dm>
+  802946:	83 c4 10             	add    $0x10,%esp
+  802949:	85 db                	test   %ebx,%ebx
+  80294b:	78 10                	js     80295d <__moddi3+0x5e>
+  80294d:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802951:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802955:	83 c4 14             	add    $0x14,%esp
+  802958:	5b                   	pop    %ebx
+  802959:	5e                   	pop    %esi
+  80295a:	5f                   	pop    %edi
+  80295b:	5d                   	pop    %ebp
+  80295c:	c3                   	ret
+  80295d:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802961:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802965:	f7 d8                	neg    %eax
+  802967:	83 d2 00             	adc    $0x0,%edx
+  80296a:	f7 da                	neg    %edx
+  80296c:	eb e7                	jmp    802955 <__moddi3+0x56>
@@ -0,0 +1,5308 @@
+
+obj/user/faultallocbad:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 84 00 00 00       	call   8000b5 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <handler>:
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	void *addr = (void*)utf->utf_fault_va;
+  80003a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80003d:	8b 18                	mov    (%eax),%ebx
+
+	cprintf("fault %x\n", addr);
+  80003f:	53                   	push   %ebx
+  800040:	68 60 29 80 00       	push   $0x802960
+  800045:	e8 da 01 00 00       	call   800224 <cprintf>
+	if ((r = sys_page_alloc(0, ROUNDDOWN(addr, PGSIZE),
+  80004a:	83 c4 0c             	add    $0xc,%esp
+  80004d:	6a 07                	push   $0x7
+  80004f:	89 d8                	mov    %ebx,%eax
+  800051:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800056:	50                   	push   %eax
+  800057:	6a 00                	push   $0x0
+  800059:	e8 e9 0f 00 00       	call   801047 <sys_page_alloc>
+  80005e:	83 c4 10             	add    $0x10,%esp
+  800061:	85 c0                	test   %eax,%eax
+  800063:	78 16                	js     80007b <handler+0x48>
+				PTE_P|PTE_U|PTE_W)) < 0)
+		panic("allocating at %x in page fault handler: %e", addr, r);
+	snprintf((char*) addr, 100, "this string was faulted in at %x", addr);
+  800065:	53                   	push   %ebx
+  800066:	68 ac 29 80 00       	push   $0x8029ac
+  80006b:	6a 64                	push   $0x64
+  80006d:	53                   	push   %ebx
+  80006e:	e8 4a 07 00 00       	call   8007bd <snprintf>
+}
+  800073:	83 c4 10             	add    $0x10,%esp
+  800076:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800079:	c9                   	leave
+  80007a:	c3                   	ret
+		panic("allocating at %x in page fault handler: %e", addr, r);
+  80007b:	83 ec 0c             	sub    $0xc,%esp
+  80007e:	50                   	push   %eax
+  80007f:	53                   	push   %ebx
+  800080:	68 80 29 80 00       	push   $0x802980
+  800085:	6a 0f                	push   $0xf
+  800087:	68 6a 29 80 00       	push   $0x80296a
+  80008c:	e8 7f 00 00 00       	call   800110 <_panic>
+
+00800091 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800091:	55                   	push   %ebp
+  800092:	89 e5                	mov    %esp,%ebp
+  800094:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(handler);
+  800097:	68 33 00 80 00       	push   $0x800033
+  80009c:	e8 25 26 00 00       	call   8026c6 <set_pgfault_handler>
+	sys_cputs((char*)0xDEADBEEF, 4);
+  8000a1:	83 c4 08             	add    $0x8,%esp
+  8000a4:	6a 04                	push   $0x4
+  8000a6:	68 ef be ad de       	push   $0xdeadbeef
+  8000ab:	e8 fa 0c 00 00       	call   800daa <sys_cputs>
+}
+  8000b0:	83 c4 10             	add    $0x10,%esp
+  8000b3:	c9                   	leave
+  8000b4:	c3                   	ret
+
+008000b5 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000b5:	55                   	push   %ebp
+  8000b6:	89 e5                	mov    %esp,%ebp
+  8000b8:	56                   	push   %esi
+  8000b9:	53                   	push   %ebx
+  8000ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000bd:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  8000c0:	e8 e3 0e 00 00       	call   800fa8 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  8000c5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000ca:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  8000d0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000d5:	a3 08 30 80 00       	mov    %eax,0x803008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000da:	85 db                	test   %ebx,%ebx
+  8000dc:	7e 07                	jle    8000e5 <libmain+0x30>
+		binaryname = argv[0];
+  8000de:	8b 06                	mov    (%esi),%eax
+  8000e0:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  8000e5:	83 ec 08             	sub    $0x8,%esp
+  8000e8:	56                   	push   %esi
+  8000e9:	53                   	push   %ebx
+  8000ea:	e8 a2 ff ff ff       	call   800091 <umain>
+
+	// exit gracefully
+	exit();
+  8000ef:	e8 0a 00 00 00       	call   8000fe <exit>
+}
+  8000f4:	83 c4 10             	add    $0x10,%esp
+  8000f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000fa:	5b                   	pop    %ebx
+  8000fb:	5e                   	pop    %esi
+  8000fc:	5d                   	pop    %ebp
+  8000fd:	c3                   	ret
+
+008000fe <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000fe:	55                   	push   %ebp
+  8000ff:	89 e5                	mov    %esp,%ebp
+  800101:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  800104:	6a 00                	push   $0x0
+  800106:	e8 db 0d 00 00       	call   800ee6 <sys_env_destroy>
+}
+  80010b:	83 c4 10             	add    $0x10,%esp
+  80010e:	c9                   	leave
+  80010f:	c3                   	ret
+
+00800110 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800110:	55                   	push   %ebp
+  800111:	89 e5                	mov    %esp,%ebp
+  800113:	57                   	push   %edi
+  800114:	56                   	push   %esi
+  800115:	53                   	push   %ebx
+  800116:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  80011c:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  80011f:	8b 1d 00 30 80 00    	mov    0x803000,%ebx
+  800125:	e8 7e 0e 00 00       	call   800fa8 <sys_getenvid>
+  80012a:	83 ec 04             	sub    $0x4,%esp
+  80012d:	ff 75 0c             	push   0xc(%ebp)
+  800130:	ff 75 08             	push   0x8(%ebp)
+  800133:	53                   	push   %ebx
+  800134:	50                   	push   %eax
+  800135:	68 d8 29 80 00       	push   $0x8029d8
+  80013a:	68 00 01 00 00       	push   $0x100
+  80013f:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  800145:	56                   	push   %esi
+  800146:	e8 72 06 00 00       	call   8007bd <snprintf>
+  80014b:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  80014d:	83 c4 20             	add    $0x20,%esp
+  800150:	57                   	push   %edi
+  800151:	ff 75 10             	push   0x10(%ebp)
+  800154:	bf 00 01 00 00       	mov    $0x100,%edi
+  800159:	89 f8                	mov    %edi,%eax
+  80015b:	29 d8                	sub    %ebx,%eax
+  80015d:	50                   	push   %eax
+  80015e:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  800161:	50                   	push   %eax
+  800162:	e8 08 06 00 00       	call   80076f <vsnprintf>
+  800167:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  800169:	83 c4 0c             	add    $0xc,%esp
+  80016c:	68 68 29 80 00       	push   $0x802968
+  800171:	29 df                	sub    %ebx,%edi
+  800173:	57                   	push   %edi
+  800174:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  800177:	50                   	push   %eax
+  800178:	e8 40 06 00 00       	call   8007bd <snprintf>
+	sys_cputs(buf, r);
+  80017d:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  800180:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  800182:	53                   	push   %ebx
+  800183:	56                   	push   %esi
+  800184:	e8 21 0c 00 00       	call   800daa <sys_cputs>
+  800189:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80018c:	cc                   	int3
+	while (1)
+  80018d:	eb fd                	jmp    80018c <_panic+0x7c>
+
+0080018f <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80018f:	55                   	push   %ebp
+  800190:	89 e5                	mov    %esp,%ebp
+  800192:	53                   	push   %ebx
+  800193:	83 ec 04             	sub    $0x4,%esp
+  800196:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800199:	8b 13                	mov    (%ebx),%edx
+  80019b:	8d 42 01             	lea    0x1(%edx),%eax
+  80019e:	89 03                	mov    %eax,(%ebx)
+  8001a0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001a3:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001a7:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001ac:	74 09                	je     8001b7 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001ae:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001b5:	c9                   	leave
+  8001b6:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001b7:	83 ec 08             	sub    $0x8,%esp
+  8001ba:	68 ff 00 00 00       	push   $0xff
+  8001bf:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001c2:	50                   	push   %eax
+  8001c3:	e8 e2 0b 00 00       	call   800daa <sys_cputs>
+		b->idx = 0;
+  8001c8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001ce:	83 c4 10             	add    $0x10,%esp
+  8001d1:	eb db                	jmp    8001ae <putch+0x1f>
+
+008001d3 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001d3:	55                   	push   %ebp
+  8001d4:	89 e5                	mov    %esp,%ebp
+  8001d6:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001dc:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001e3:	00 00 00 
+	b.cnt = 0;
+  8001e6:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001ed:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001f0:	ff 75 0c             	push   0xc(%ebp)
+  8001f3:	ff 75 08             	push   0x8(%ebp)
+  8001f6:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001fc:	50                   	push   %eax
+  8001fd:	68 8f 01 80 00       	push   $0x80018f
+  800202:	e8 14 01 00 00       	call   80031b <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800207:	83 c4 08             	add    $0x8,%esp
+  80020a:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800210:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800216:	50                   	push   %eax
+  800217:	e8 8e 0b 00 00       	call   800daa <sys_cputs>
+
+	return b.cnt;
+}
+  80021c:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800222:	c9                   	leave
+  800223:	c3                   	ret
+
+00800224 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800224:	55                   	push   %ebp
+  800225:	89 e5                	mov    %esp,%ebp
+  800227:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80022a:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80022d:	50                   	push   %eax
+  80022e:	ff 75 08             	push   0x8(%ebp)
+  800231:	e8 9d ff ff ff       	call   8001d3 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800236:	c9                   	leave
+  800237:	c3                   	ret
+
+00800238 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800238:	55                   	push   %ebp
+  800239:	89 e5                	mov    %esp,%ebp
+  80023b:	57                   	push   %edi
+  80023c:	56                   	push   %esi
+  80023d:	53                   	push   %ebx
+  80023e:	83 ec 1c             	sub    $0x1c,%esp
+  800241:	89 c7                	mov    %eax,%edi
+  800243:	89 d6                	mov    %edx,%esi
+  800245:	8b 45 08             	mov    0x8(%ebp),%eax
+  800248:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80024b:	89 d1                	mov    %edx,%ecx
+  80024d:	89 c2                	mov    %eax,%edx
+  80024f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800252:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800255:	8b 45 10             	mov    0x10(%ebp),%eax
+  800258:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80025b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80025e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800265:	39 c2                	cmp    %eax,%edx
+  800267:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80026a:	72 3e                	jb     8002aa <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80026c:	83 ec 0c             	sub    $0xc,%esp
+  80026f:	ff 75 18             	push   0x18(%ebp)
+  800272:	83 eb 01             	sub    $0x1,%ebx
+  800275:	53                   	push   %ebx
+  800276:	50                   	push   %eax
+  800277:	83 ec 08             	sub    $0x8,%esp
+  80027a:	ff 75 e4             	push   -0x1c(%ebp)
+  80027d:	ff 75 e0             	push   -0x20(%ebp)
+  800280:	ff 75 dc             	push   -0x24(%ebp)
+  800283:	ff 75 d8             	push   -0x28(%ebp)
+  800286:	e8 9b 25 00 00       	call   802826 <__udivdi3>
+  80028b:	83 c4 18             	add    $0x18,%esp
+  80028e:	52                   	push   %edx
+  80028f:	50                   	push   %eax
+  800290:	89 f2                	mov    %esi,%edx
+  800292:	89 f8                	mov    %edi,%eax
+  800294:	e8 9f ff ff ff       	call   800238 <printnum>
+  800299:	83 c4 20             	add    $0x20,%esp
+  80029c:	eb 13                	jmp    8002b1 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80029e:	83 ec 08             	sub    $0x8,%esp
+  8002a1:	56                   	push   %esi
+  8002a2:	ff 75 18             	push   0x18(%ebp)
+  8002a5:	ff d7                	call   *%edi
+  8002a7:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002aa:	83 eb 01             	sub    $0x1,%ebx
+  8002ad:	85 db                	test   %ebx,%ebx
+  8002af:	7f ed                	jg     80029e <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002b1:	83 ec 08             	sub    $0x8,%esp
+  8002b4:	56                   	push   %esi
+  8002b5:	83 ec 04             	sub    $0x4,%esp
+  8002b8:	ff 75 e4             	push   -0x1c(%ebp)
+  8002bb:	ff 75 e0             	push   -0x20(%ebp)
+  8002be:	ff 75 dc             	push   -0x24(%ebp)
+  8002c1:	ff 75 d8             	push   -0x28(%ebp)
+  8002c4:	e8 7b 25 00 00       	call   802844 <__umoddi3>
+  8002c9:	83 c4 14             	add    $0x14,%esp
+  8002cc:	0f be 80 fb 29 80 00 	movsbl 0x8029fb(%eax),%eax
+  8002d3:	50                   	push   %eax
+  8002d4:	ff d7                	call   *%edi
+}
+  8002d6:	83 c4 10             	add    $0x10,%esp
+  8002d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002dc:	5b                   	pop    %ebx
+  8002dd:	5e                   	pop    %esi
+  8002de:	5f                   	pop    %edi
+  8002df:	5d                   	pop    %ebp
+  8002e0:	c3                   	ret
+
+008002e1 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002e1:	55                   	push   %ebp
+  8002e2:	89 e5                	mov    %esp,%ebp
+  8002e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002e7:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002eb:	8b 10                	mov    (%eax),%edx
+  8002ed:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002f0:	73 0a                	jae    8002fc <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002f2:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002f5:	89 08                	mov    %ecx,(%eax)
+  8002f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002fa:	88 02                	mov    %al,(%edx)
+}
+  8002fc:	5d                   	pop    %ebp
+  8002fd:	c3                   	ret
+
+008002fe <printfmt>:
+{
+  8002fe:	55                   	push   %ebp
+  8002ff:	89 e5                	mov    %esp,%ebp
+  800301:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800304:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800307:	50                   	push   %eax
+  800308:	ff 75 10             	push   0x10(%ebp)
+  80030b:	ff 75 0c             	push   0xc(%ebp)
+  80030e:	ff 75 08             	push   0x8(%ebp)
+  800311:	e8 05 00 00 00       	call   80031b <vprintfmt>
+}
+  800316:	83 c4 10             	add    $0x10,%esp
+  800319:	c9                   	leave
+  80031a:	c3                   	ret
+
+0080031b <vprintfmt>:
+{
+  80031b:	55                   	push   %ebp
+  80031c:	89 e5                	mov    %esp,%ebp
+  80031e:	57                   	push   %edi
+  80031f:	56                   	push   %esi
+  800320:	53                   	push   %ebx
+  800321:	83 ec 2c             	sub    $0x2c,%esp
+  800324:	8b 75 08             	mov    0x8(%ebp),%esi
+  800327:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80032a:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80032d:	eb 0a                	jmp    800339 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80032f:	83 ec 08             	sub    $0x8,%esp
+  800332:	53                   	push   %ebx
+  800333:	50                   	push   %eax
+  800334:	ff d6                	call   *%esi
+  800336:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800339:	83 c7 01             	add    $0x1,%edi
+  80033c:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800340:	83 f8 25             	cmp    $0x25,%eax
+  800343:	74 0c                	je     800351 <vprintfmt+0x36>
+			if (ch == '\0')
+  800345:	85 c0                	test   %eax,%eax
+  800347:	75 e6                	jne    80032f <vprintfmt+0x14>
+}
+  800349:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80034c:	5b                   	pop    %ebx
+  80034d:	5e                   	pop    %esi
+  80034e:	5f                   	pop    %edi
+  80034f:	5d                   	pop    %ebp
+  800350:	c3                   	ret
+		padc = ' ';
+  800351:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800355:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80035c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800363:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80036a:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80036f:	8d 47 01             	lea    0x1(%edi),%eax
+  800372:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800375:	0f b6 17             	movzbl (%edi),%edx
+  800378:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80037b:	3c 55                	cmp    $0x55,%al
+  80037d:	0f 87 cf 03 00 00    	ja     800752 <vprintfmt+0x437>
+  800383:	0f b6 c0             	movzbl %al,%eax
+  800386:	ff 24 85 e0 2a 80 00 	jmp    *0x802ae0(,%eax,4)
+  80038d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800390:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800394:	eb d9                	jmp    80036f <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800396:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800399:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80039d:	eb d0                	jmp    80036f <vprintfmt+0x54>
+  80039f:	0f b6 d2             	movzbl %dl,%edx
+  8003a2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003aa:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003ad:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003b0:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003b4:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003b7:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003ba:	83 f9 09             	cmp    $0x9,%ecx
+  8003bd:	77 55                	ja     800414 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8003bf:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003c2:	eb e9                	jmp    8003ad <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8003c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c7:	8b 00                	mov    (%eax),%eax
+  8003c9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003cf:	8d 40 04             	lea    0x4(%eax),%eax
+  8003d2:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003d5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003d8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003dc:	79 91                	jns    80036f <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003de:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003e1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003e4:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003eb:	eb 82                	jmp    80036f <vprintfmt+0x54>
+			if (width < 0)
+  8003ed:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003f0:	85 d2                	test   %edx,%edx
+  8003f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f7:	0f 49 c2             	cmovns %edx,%eax
+  8003fa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003fd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800400:	e9 6a ff ff ff       	jmp    80036f <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800405:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800408:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80040f:	e9 5b ff ff ff       	jmp    80036f <vprintfmt+0x54>
+  800414:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800417:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80041a:	eb bc                	jmp    8003d8 <vprintfmt+0xbd>
+			lflag++;
+  80041c:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80041f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800422:	e9 48 ff ff ff       	jmp    80036f <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800427:	8b 45 14             	mov    0x14(%ebp),%eax
+  80042a:	8d 78 04             	lea    0x4(%eax),%edi
+  80042d:	83 ec 08             	sub    $0x8,%esp
+  800430:	53                   	push   %ebx
+  800431:	ff 30                	push   (%eax)
+  800433:	ff d6                	call   *%esi
+			break;
+  800435:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800438:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80043b:	e9 b1 02 00 00       	jmp    8006f1 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800440:	8b 45 14             	mov    0x14(%ebp),%eax
+  800443:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800446:	8b 10                	mov    (%eax),%edx
+  800448:	89 d0                	mov    %edx,%eax
+  80044a:	f7 d8                	neg    %eax
+  80044c:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80044f:	83 f8 0d             	cmp    $0xd,%eax
+  800452:	7f 23                	jg     800477 <vprintfmt+0x15c>
+  800454:	8b 14 85 40 2c 80 00 	mov    0x802c40(,%eax,4),%edx
+  80045b:	85 d2                	test   %edx,%edx
+  80045d:	74 18                	je     800477 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80045f:	52                   	push   %edx
+  800460:	68 1c 2a 80 00       	push   $0x802a1c
+  800465:	53                   	push   %ebx
+  800466:	56                   	push   %esi
+  800467:	e8 92 fe ff ff       	call   8002fe <printfmt>
+  80046c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80046f:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800472:	e9 7a 02 00 00       	jmp    8006f1 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800477:	50                   	push   %eax
+  800478:	68 13 2a 80 00       	push   $0x802a13
+  80047d:	53                   	push   %ebx
+  80047e:	56                   	push   %esi
+  80047f:	e8 7a fe ff ff       	call   8002fe <printfmt>
+  800484:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800487:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80048a:	e9 62 02 00 00       	jmp    8006f1 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80048f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800492:	83 c0 04             	add    $0x4,%eax
+  800495:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800498:	8b 45 14             	mov    0x14(%ebp),%eax
+  80049b:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80049d:	85 c9                	test   %ecx,%ecx
+  80049f:	b8 0c 2a 80 00       	mov    $0x802a0c,%eax
+  8004a4:	0f 45 c1             	cmovne %ecx,%eax
+  8004a7:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004aa:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004ae:	7e 06                	jle    8004b6 <vprintfmt+0x19b>
+  8004b0:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004b4:	75 0b                	jne    8004c1 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004b6:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004b9:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004bc:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004bf:	eb 5c                	jmp    80051d <vprintfmt+0x202>
+  8004c1:	83 ec 08             	sub    $0x8,%esp
+  8004c4:	ff 75 d0             	push   -0x30(%ebp)
+  8004c7:	ff 75 cc             	push   -0x34(%ebp)
+  8004ca:	e8 20 03 00 00       	call   8007ef <strnlen>
+  8004cf:	89 c2                	mov    %eax,%edx
+  8004d1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004d4:	29 d0                	sub    %edx,%eax
+  8004d6:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004d9:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004dd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004e0:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004e3:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004e5:	eb 0e                	jmp    8004f5 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004e7:	83 ec 08             	sub    $0x8,%esp
+  8004ea:	53                   	push   %ebx
+  8004eb:	57                   	push   %edi
+  8004ec:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004ef:	83 ee 01             	sub    $0x1,%esi
+  8004f2:	83 c4 10             	add    $0x10,%esp
+  8004f5:	85 f6                	test   %esi,%esi
+  8004f7:	7f ee                	jg     8004e7 <vprintfmt+0x1cc>
+  8004f9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004fc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004ff:	85 c0                	test   %eax,%eax
+  800501:	ba 00 00 00 00       	mov    $0x0,%edx
+  800506:	0f 49 d0             	cmovns %eax,%edx
+  800509:	29 d0                	sub    %edx,%eax
+  80050b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80050e:	eb a6                	jmp    8004b6 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800510:	83 ec 08             	sub    $0x8,%esp
+  800513:	53                   	push   %ebx
+  800514:	52                   	push   %edx
+  800515:	ff 55 08             	call   *0x8(%ebp)
+  800518:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80051b:	89 f1                	mov    %esi,%ecx
+  80051d:	8d 71 01             	lea    0x1(%ecx),%esi
+  800520:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800524:	0f be d0             	movsbl %al,%edx
+  800527:	85 d2                	test   %edx,%edx
+  800529:	74 28                	je     800553 <vprintfmt+0x238>
+  80052b:	85 ff                	test   %edi,%edi
+  80052d:	78 05                	js     800534 <vprintfmt+0x219>
+  80052f:	83 ef 01             	sub    $0x1,%edi
+  800532:	78 30                	js     800564 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800534:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800538:	74 d6                	je     800510 <vprintfmt+0x1f5>
+  80053a:	0f be c0             	movsbl %al,%eax
+  80053d:	83 e8 20             	sub    $0x20,%eax
+  800540:	83 f8 5e             	cmp    $0x5e,%eax
+  800543:	76 cb                	jbe    800510 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800545:	83 ec 08             	sub    $0x8,%esp
+  800548:	53                   	push   %ebx
+  800549:	6a 3f                	push   $0x3f
+  80054b:	ff 55 08             	call   *0x8(%ebp)
+  80054e:	83 c4 10             	add    $0x10,%esp
+  800551:	eb c8                	jmp    80051b <vprintfmt+0x200>
+  800553:	8b 75 08             	mov    0x8(%ebp),%esi
+  800556:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800559:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80055c:	01 d0                	add    %edx,%eax
+  80055e:	29 c8                	sub    %ecx,%eax
+  800560:	89 c7                	mov    %eax,%edi
+  800562:	eb 13                	jmp    800577 <vprintfmt+0x25c>
+  800564:	8b 75 08             	mov    0x8(%ebp),%esi
+  800567:	eb ed                	jmp    800556 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800569:	83 ec 08             	sub    $0x8,%esp
+  80056c:	53                   	push   %ebx
+  80056d:	6a 20                	push   $0x20
+  80056f:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800571:	83 ef 01             	sub    $0x1,%edi
+  800574:	83 c4 10             	add    $0x10,%esp
+  800577:	85 ff                	test   %edi,%edi
+  800579:	7f ee                	jg     800569 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80057b:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80057e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800581:	e9 6b 01 00 00       	jmp    8006f1 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800586:	83 f9 01             	cmp    $0x1,%ecx
+  800589:	7f 1f                	jg     8005aa <vprintfmt+0x28f>
+	else if (lflag)
+  80058b:	85 c9                	test   %ecx,%ecx
+  80058d:	74 67                	je     8005f6 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80058f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800592:	8b 00                	mov    (%eax),%eax
+  800594:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800597:	89 c1                	mov    %eax,%ecx
+  800599:	c1 f9 1f             	sar    $0x1f,%ecx
+  80059c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80059f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a2:	8d 40 04             	lea    0x4(%eax),%eax
+  8005a5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005a8:	eb 17                	jmp    8005c1 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8005aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ad:	8b 50 04             	mov    0x4(%eax),%edx
+  8005b0:	8b 00                	mov    (%eax),%eax
+  8005b2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005b5:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bb:	8d 40 08             	lea    0x8(%eax),%eax
+  8005be:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005c1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005c4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005c7:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005cc:	85 c9                	test   %ecx,%ecx
+  8005ce:	0f 89 03 01 00 00    	jns    8006d7 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8005d4:	83 ec 08             	sub    $0x8,%esp
+  8005d7:	53                   	push   %ebx
+  8005d8:	6a 2d                	push   $0x2d
+  8005da:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005dc:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005df:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005e2:	f7 da                	neg    %edx
+  8005e4:	83 d1 00             	adc    $0x0,%ecx
+  8005e7:	f7 d9                	neg    %ecx
+  8005e9:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005ec:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005f1:	e9 e1 00 00 00       	jmp    8006d7 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8005f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f9:	8b 00                	mov    (%eax),%eax
+  8005fb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005fe:	89 c1                	mov    %eax,%ecx
+  800600:	c1 f9 1f             	sar    $0x1f,%ecx
+  800603:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800606:	8b 45 14             	mov    0x14(%ebp),%eax
+  800609:	8d 40 04             	lea    0x4(%eax),%eax
+  80060c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80060f:	eb b0                	jmp    8005c1 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800611:	83 f9 01             	cmp    $0x1,%ecx
+  800614:	7f 1e                	jg     800634 <vprintfmt+0x319>
+	else if (lflag)
+  800616:	85 c9                	test   %ecx,%ecx
+  800618:	74 32                	je     80064c <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  80061a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061d:	8b 10                	mov    (%eax),%edx
+  80061f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800624:	8d 40 04             	lea    0x4(%eax),%eax
+  800627:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80062a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80062f:	e9 a3 00 00 00       	jmp    8006d7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800634:	8b 45 14             	mov    0x14(%ebp),%eax
+  800637:	8b 10                	mov    (%eax),%edx
+  800639:	8b 48 04             	mov    0x4(%eax),%ecx
+  80063c:	8d 40 08             	lea    0x8(%eax),%eax
+  80063f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800642:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800647:	e9 8b 00 00 00       	jmp    8006d7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80064c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064f:	8b 10                	mov    (%eax),%edx
+  800651:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800656:	8d 40 04             	lea    0x4(%eax),%eax
+  800659:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80065c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800661:	eb 74                	jmp    8006d7 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800663:	83 f9 01             	cmp    $0x1,%ecx
+  800666:	7f 1b                	jg     800683 <vprintfmt+0x368>
+	else if (lflag)
+  800668:	85 c9                	test   %ecx,%ecx
+  80066a:	74 2c                	je     800698 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  80066c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066f:	8b 10                	mov    (%eax),%edx
+  800671:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800676:	8d 40 04             	lea    0x4(%eax),%eax
+  800679:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80067c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800681:	eb 54                	jmp    8006d7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800683:	8b 45 14             	mov    0x14(%ebp),%eax
+  800686:	8b 10                	mov    (%eax),%edx
+  800688:	8b 48 04             	mov    0x4(%eax),%ecx
+  80068b:	8d 40 08             	lea    0x8(%eax),%eax
+  80068e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800691:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800696:	eb 3f                	jmp    8006d7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800698:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069b:	8b 10                	mov    (%eax),%edx
+  80069d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a2:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006a8:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8006ad:	eb 28                	jmp    8006d7 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8006af:	83 ec 08             	sub    $0x8,%esp
+  8006b2:	53                   	push   %ebx
+  8006b3:	6a 30                	push   $0x30
+  8006b5:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006b7:	83 c4 08             	add    $0x8,%esp
+  8006ba:	53                   	push   %ebx
+  8006bb:	6a 78                	push   $0x78
+  8006bd:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c2:	8b 10                	mov    (%eax),%edx
+  8006c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006c9:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006cc:	8d 40 04             	lea    0x4(%eax),%eax
+  8006cf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006d2:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006d7:	83 ec 0c             	sub    $0xc,%esp
+  8006da:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006de:	50                   	push   %eax
+  8006df:	ff 75 e0             	push   -0x20(%ebp)
+  8006e2:	57                   	push   %edi
+  8006e3:	51                   	push   %ecx
+  8006e4:	52                   	push   %edx
+  8006e5:	89 da                	mov    %ebx,%edx
+  8006e7:	89 f0                	mov    %esi,%eax
+  8006e9:	e8 4a fb ff ff       	call   800238 <printnum>
+			break;
+  8006ee:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006f1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006f4:	e9 40 fc ff ff       	jmp    800339 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006f9:	83 f9 01             	cmp    $0x1,%ecx
+  8006fc:	7f 1b                	jg     800719 <vprintfmt+0x3fe>
+	else if (lflag)
+  8006fe:	85 c9                	test   %ecx,%ecx
+  800700:	74 2c                	je     80072e <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800702:	8b 45 14             	mov    0x14(%ebp),%eax
+  800705:	8b 10                	mov    (%eax),%edx
+  800707:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80070c:	8d 40 04             	lea    0x4(%eax),%eax
+  80070f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800712:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800717:	eb be                	jmp    8006d7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800719:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071c:	8b 10                	mov    (%eax),%edx
+  80071e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800721:	8d 40 08             	lea    0x8(%eax),%eax
+  800724:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800727:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80072c:	eb a9                	jmp    8006d7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80072e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800731:	8b 10                	mov    (%eax),%edx
+  800733:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800738:	8d 40 04             	lea    0x4(%eax),%eax
+  80073b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80073e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800743:	eb 92                	jmp    8006d7 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800745:	83 ec 08             	sub    $0x8,%esp
+  800748:	53                   	push   %ebx
+  800749:	6a 25                	push   $0x25
+  80074b:	ff d6                	call   *%esi
+			break;
+  80074d:	83 c4 10             	add    $0x10,%esp
+  800750:	eb 9f                	jmp    8006f1 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800752:	83 ec 08             	sub    $0x8,%esp
+  800755:	53                   	push   %ebx
+  800756:	6a 25                	push   $0x25
+  800758:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80075a:	83 c4 10             	add    $0x10,%esp
+  80075d:	89 f8                	mov    %edi,%eax
+  80075f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800763:	74 05                	je     80076a <vprintfmt+0x44f>
+  800765:	83 e8 01             	sub    $0x1,%eax
+  800768:	eb f5                	jmp    80075f <vprintfmt+0x444>
+  80076a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80076d:	eb 82                	jmp    8006f1 <vprintfmt+0x3d6>
+
+0080076f <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80076f:	55                   	push   %ebp
+  800770:	89 e5                	mov    %esp,%ebp
+  800772:	83 ec 18             	sub    $0x18,%esp
+  800775:	8b 45 08             	mov    0x8(%ebp),%eax
+  800778:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80077b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80077e:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800782:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800785:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80078c:	85 c0                	test   %eax,%eax
+  80078e:	74 26                	je     8007b6 <vsnprintf+0x47>
+  800790:	85 d2                	test   %edx,%edx
+  800792:	7e 22                	jle    8007b6 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800794:	ff 75 14             	push   0x14(%ebp)
+  800797:	ff 75 10             	push   0x10(%ebp)
+  80079a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80079d:	50                   	push   %eax
+  80079e:	68 e1 02 80 00       	push   $0x8002e1
+  8007a3:	e8 73 fb ff ff       	call   80031b <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007a8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007ab:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007b1:	83 c4 10             	add    $0x10,%esp
+}
+  8007b4:	c9                   	leave
+  8007b5:	c3                   	ret
+		return -E_INVAL;
+  8007b6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007bb:	eb f7                	jmp    8007b4 <vsnprintf+0x45>
+
+008007bd <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007bd:	55                   	push   %ebp
+  8007be:	89 e5                	mov    %esp,%ebp
+  8007c0:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007c3:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007c6:	50                   	push   %eax
+  8007c7:	ff 75 10             	push   0x10(%ebp)
+  8007ca:	ff 75 0c             	push   0xc(%ebp)
+  8007cd:	ff 75 08             	push   0x8(%ebp)
+  8007d0:	e8 9a ff ff ff       	call   80076f <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007d5:	c9                   	leave
+  8007d6:	c3                   	ret
+
+008007d7 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007d7:	55                   	push   %ebp
+  8007d8:	89 e5                	mov    %esp,%ebp
+  8007da:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e2:	eb 03                	jmp    8007e7 <strlen+0x10>
+		n++;
+  8007e4:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007e7:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007eb:	75 f7                	jne    8007e4 <strlen+0xd>
+	return n;
+}
+  8007ed:	5d                   	pop    %ebp
+  8007ee:	c3                   	ret
+
+008007ef <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007ef:	55                   	push   %ebp
+  8007f0:	89 e5                	mov    %esp,%ebp
+  8007f2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007f5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fd:	eb 03                	jmp    800802 <strnlen+0x13>
+		n++;
+  8007ff:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800802:	39 d0                	cmp    %edx,%eax
+  800804:	74 08                	je     80080e <strnlen+0x1f>
+  800806:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80080a:	75 f3                	jne    8007ff <strnlen+0x10>
+  80080c:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80080e:	89 d0                	mov    %edx,%eax
+  800810:	5d                   	pop    %ebp
+  800811:	c3                   	ret
+
+00800812 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800812:	55                   	push   %ebp
+  800813:	89 e5                	mov    %esp,%ebp
+  800815:	53                   	push   %ebx
+  800816:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800819:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80081c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800821:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800825:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800828:	83 c0 01             	add    $0x1,%eax
+  80082b:	84 d2                	test   %dl,%dl
+  80082d:	75 f2                	jne    800821 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80082f:	89 c8                	mov    %ecx,%eax
+  800831:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800834:	c9                   	leave
+  800835:	c3                   	ret
+
+00800836 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800836:	55                   	push   %ebp
+  800837:	89 e5                	mov    %esp,%ebp
+  800839:	53                   	push   %ebx
+  80083a:	83 ec 10             	sub    $0x10,%esp
+  80083d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800840:	53                   	push   %ebx
+  800841:	e8 91 ff ff ff       	call   8007d7 <strlen>
+  800846:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800849:	ff 75 0c             	push   0xc(%ebp)
+  80084c:	01 d8                	add    %ebx,%eax
+  80084e:	50                   	push   %eax
+  80084f:	e8 be ff ff ff       	call   800812 <strcpy>
+	return dst;
+}
+  800854:	89 d8                	mov    %ebx,%eax
+  800856:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800859:	c9                   	leave
+  80085a:	c3                   	ret
+
+0080085b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80085b:	55                   	push   %ebp
+  80085c:	89 e5                	mov    %esp,%ebp
+  80085e:	56                   	push   %esi
+  80085f:	53                   	push   %ebx
+  800860:	8b 75 08             	mov    0x8(%ebp),%esi
+  800863:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800866:	89 f3                	mov    %esi,%ebx
+  800868:	03 5d 10             	add    0x10(%ebp),%ebx
+  80086b:	89 f0                	mov    %esi,%eax
+  80086d:	eb 0f                	jmp    80087e <strncpy+0x23>
+		*dst++ = *src;
+  80086f:	83 c0 01             	add    $0x1,%eax
+  800872:	0f b6 0a             	movzbl (%edx),%ecx
+  800875:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800878:	80 f9 01             	cmp    $0x1,%cl
+  80087b:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80087e:	39 d8                	cmp    %ebx,%eax
+  800880:	75 ed                	jne    80086f <strncpy+0x14>
+	}
+	return ret;
+}
+  800882:	89 f0                	mov    %esi,%eax
+  800884:	5b                   	pop    %ebx
+  800885:	5e                   	pop    %esi
+  800886:	5d                   	pop    %ebp
+  800887:	c3                   	ret
+
+00800888 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800888:	55                   	push   %ebp
+  800889:	89 e5                	mov    %esp,%ebp
+  80088b:	56                   	push   %esi
+  80088c:	53                   	push   %ebx
+  80088d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800890:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800893:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800896:	89 f0                	mov    %esi,%eax
+  800898:	85 d2                	test   %edx,%edx
+  80089a:	74 21                	je     8008bd <strlcpy+0x35>
+  80089c:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008a0:	89 f2                	mov    %esi,%edx
+  8008a2:	eb 09                	jmp    8008ad <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008a4:	83 c1 01             	add    $0x1,%ecx
+  8008a7:	83 c2 01             	add    $0x1,%edx
+  8008aa:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008ad:	39 c2                	cmp    %eax,%edx
+  8008af:	74 09                	je     8008ba <strlcpy+0x32>
+  8008b1:	0f b6 19             	movzbl (%ecx),%ebx
+  8008b4:	84 db                	test   %bl,%bl
+  8008b6:	75 ec                	jne    8008a4 <strlcpy+0x1c>
+  8008b8:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008ba:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008bd:	29 f0                	sub    %esi,%eax
+}
+  8008bf:	5b                   	pop    %ebx
+  8008c0:	5e                   	pop    %esi
+  8008c1:	5d                   	pop    %ebp
+  8008c2:	c3                   	ret
+
+008008c3 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008c3:	55                   	push   %ebp
+  8008c4:	89 e5                	mov    %esp,%ebp
+  8008c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008c9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008cc:	eb 06                	jmp    8008d4 <strcmp+0x11>
+		p++, q++;
+  8008ce:	83 c1 01             	add    $0x1,%ecx
+  8008d1:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008d4:	0f b6 01             	movzbl (%ecx),%eax
+  8008d7:	84 c0                	test   %al,%al
+  8008d9:	74 04                	je     8008df <strcmp+0x1c>
+  8008db:	3a 02                	cmp    (%edx),%al
+  8008dd:	74 ef                	je     8008ce <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008df:	0f b6 c0             	movzbl %al,%eax
+  8008e2:	0f b6 12             	movzbl (%edx),%edx
+  8008e5:	29 d0                	sub    %edx,%eax
+}
+  8008e7:	5d                   	pop    %ebp
+  8008e8:	c3                   	ret
+
+008008e9 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008e9:	55                   	push   %ebp
+  8008ea:	89 e5                	mov    %esp,%ebp
+  8008ec:	53                   	push   %ebx
+  8008ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008f3:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008f6:	eb 09                	jmp    800901 <strncmp+0x18>
+		n--, p++, q++;
+  8008f8:	83 ea 01             	sub    $0x1,%edx
+  8008fb:	83 c0 01             	add    $0x1,%eax
+  8008fe:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800901:	85 d2                	test   %edx,%edx
+  800903:	74 18                	je     80091d <strncmp+0x34>
+  800905:	0f b6 18             	movzbl (%eax),%ebx
+  800908:	84 db                	test   %bl,%bl
+  80090a:	74 04                	je     800910 <strncmp+0x27>
+  80090c:	3a 19                	cmp    (%ecx),%bl
+  80090e:	74 e8                	je     8008f8 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800910:	0f b6 00             	movzbl (%eax),%eax
+  800913:	0f b6 11             	movzbl (%ecx),%edx
+  800916:	29 d0                	sub    %edx,%eax
+}
+  800918:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80091b:	c9                   	leave
+  80091c:	c3                   	ret
+		return 0;
+  80091d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800922:	eb f4                	jmp    800918 <strncmp+0x2f>
+
+00800924 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800924:	55                   	push   %ebp
+  800925:	89 e5                	mov    %esp,%ebp
+  800927:	8b 45 08             	mov    0x8(%ebp),%eax
+  80092a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80092e:	eb 03                	jmp    800933 <strchr+0xf>
+  800930:	83 c0 01             	add    $0x1,%eax
+  800933:	0f b6 10             	movzbl (%eax),%edx
+  800936:	84 d2                	test   %dl,%dl
+  800938:	74 06                	je     800940 <strchr+0x1c>
+		if (*s == c)
+  80093a:	38 ca                	cmp    %cl,%dl
+  80093c:	75 f2                	jne    800930 <strchr+0xc>
+  80093e:	eb 05                	jmp    800945 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800940:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800945:	5d                   	pop    %ebp
+  800946:	c3                   	ret
+
+00800947 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800947:	55                   	push   %ebp
+  800948:	89 e5                	mov    %esp,%ebp
+  80094a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80094d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800951:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800954:	38 ca                	cmp    %cl,%dl
+  800956:	74 09                	je     800961 <strfind+0x1a>
+  800958:	84 d2                	test   %dl,%dl
+  80095a:	74 05                	je     800961 <strfind+0x1a>
+	for (; *s; s++)
+  80095c:	83 c0 01             	add    $0x1,%eax
+  80095f:	eb f0                	jmp    800951 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800961:	5d                   	pop    %ebp
+  800962:	c3                   	ret
+
+00800963 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800963:	55                   	push   %ebp
+  800964:	89 e5                	mov    %esp,%ebp
+  800966:	57                   	push   %edi
+  800967:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80096a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80096d:	85 c9                	test   %ecx,%ecx
+  80096f:	74 20                	je     800991 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800971:	89 f8                	mov    %edi,%eax
+  800973:	09 c8                	or     %ecx,%eax
+  800975:	a8 03                	test   $0x3,%al
+  800977:	75 12                	jne    80098b <memset+0x28>
+		c &= 0xFF;
+  800979:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80097d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800983:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800986:	fc                   	cld
+  800987:	f3 ab                	rep stos %eax,%es:(%edi)
+  800989:	eb 06                	jmp    800991 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80098b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80098e:	fc                   	cld
+  80098f:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800991:	89 f8                	mov    %edi,%eax
+  800993:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800996:	c9                   	leave
+  800997:	c3                   	ret
+
+00800998 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800998:	55                   	push   %ebp
+  800999:	89 e5                	mov    %esp,%ebp
+  80099b:	57                   	push   %edi
+  80099c:	56                   	push   %esi
+  80099d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009a3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009a6:	39 c6                	cmp    %eax,%esi
+  8009a8:	73 32                	jae    8009dc <memmove+0x44>
+  8009aa:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009ad:	39 d0                	cmp    %edx,%eax
+  8009af:	73 2b                	jae    8009dc <memmove+0x44>
+		s += n;
+		d += n;
+  8009b1:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009b4:	89 d6                	mov    %edx,%esi
+  8009b6:	09 fe                	or     %edi,%esi
+  8009b8:	09 ce                	or     %ecx,%esi
+  8009ba:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009c0:	75 0e                	jne    8009d0 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009c2:	83 ef 04             	sub    $0x4,%edi
+  8009c5:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009c8:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009cb:	fd                   	std
+  8009cc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009ce:	eb 09                	jmp    8009d9 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009d0:	83 ef 01             	sub    $0x1,%edi
+  8009d3:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009d6:	fd                   	std
+  8009d7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009d9:	fc                   	cld
+  8009da:	eb 1a                	jmp    8009f6 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009dc:	89 f2                	mov    %esi,%edx
+  8009de:	09 c2                	or     %eax,%edx
+  8009e0:	09 ca                	or     %ecx,%edx
+  8009e2:	f6 c2 03             	test   $0x3,%dl
+  8009e5:	75 0a                	jne    8009f1 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009e7:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009ea:	89 c7                	mov    %eax,%edi
+  8009ec:	fc                   	cld
+  8009ed:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009ef:	eb 05                	jmp    8009f6 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009f1:	89 c7                	mov    %eax,%edi
+  8009f3:	fc                   	cld
+  8009f4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009f6:	5e                   	pop    %esi
+  8009f7:	5f                   	pop    %edi
+  8009f8:	5d                   	pop    %ebp
+  8009f9:	c3                   	ret
+
+008009fa <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009fa:	55                   	push   %ebp
+  8009fb:	89 e5                	mov    %esp,%ebp
+  8009fd:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a00:	ff 75 10             	push   0x10(%ebp)
+  800a03:	ff 75 0c             	push   0xc(%ebp)
+  800a06:	ff 75 08             	push   0x8(%ebp)
+  800a09:	e8 8a ff ff ff       	call   800998 <memmove>
+}
+  800a0e:	c9                   	leave
+  800a0f:	c3                   	ret
+
+00800a10 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a10:	55                   	push   %ebp
+  800a11:	89 e5                	mov    %esp,%ebp
+  800a13:	56                   	push   %esi
+  800a14:	53                   	push   %ebx
+  800a15:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a18:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a1b:	89 c6                	mov    %eax,%esi
+  800a1d:	03 75 10             	add    0x10(%ebp),%esi
+  800a20:	eb 06                	jmp    800a28 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a22:	83 c0 01             	add    $0x1,%eax
+  800a25:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a28:	39 f0                	cmp    %esi,%eax
+  800a2a:	74 14                	je     800a40 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a2c:	0f b6 08             	movzbl (%eax),%ecx
+  800a2f:	0f b6 1a             	movzbl (%edx),%ebx
+  800a32:	38 d9                	cmp    %bl,%cl
+  800a34:	74 ec                	je     800a22 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a36:	0f b6 c1             	movzbl %cl,%eax
+  800a39:	0f b6 db             	movzbl %bl,%ebx
+  800a3c:	29 d8                	sub    %ebx,%eax
+  800a3e:	eb 05                	jmp    800a45 <memcmp+0x35>
+	}
+
+	return 0;
+  800a40:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a45:	5b                   	pop    %ebx
+  800a46:	5e                   	pop    %esi
+  800a47:	5d                   	pop    %ebp
+  800a48:	c3                   	ret
+
+00800a49 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a49:	55                   	push   %ebp
+  800a4a:	89 e5                	mov    %esp,%ebp
+  800a4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a4f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a52:	89 c2                	mov    %eax,%edx
+  800a54:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a57:	eb 03                	jmp    800a5c <memfind+0x13>
+  800a59:	83 c0 01             	add    $0x1,%eax
+  800a5c:	39 d0                	cmp    %edx,%eax
+  800a5e:	73 04                	jae    800a64 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a60:	38 08                	cmp    %cl,(%eax)
+  800a62:	75 f5                	jne    800a59 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a64:	5d                   	pop    %ebp
+  800a65:	c3                   	ret
+
+00800a66 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a66:	55                   	push   %ebp
+  800a67:	89 e5                	mov    %esp,%ebp
+  800a69:	57                   	push   %edi
+  800a6a:	56                   	push   %esi
+  800a6b:	53                   	push   %ebx
+  800a6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a6f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a72:	eb 03                	jmp    800a77 <strtol+0x11>
+		s++;
+  800a74:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a77:	0f b6 02             	movzbl (%edx),%eax
+  800a7a:	3c 20                	cmp    $0x20,%al
+  800a7c:	74 f6                	je     800a74 <strtol+0xe>
+  800a7e:	3c 09                	cmp    $0x9,%al
+  800a80:	74 f2                	je     800a74 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a82:	3c 2b                	cmp    $0x2b,%al
+  800a84:	74 2a                	je     800ab0 <strtol+0x4a>
+	int neg = 0;
+  800a86:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a8b:	3c 2d                	cmp    $0x2d,%al
+  800a8d:	74 2b                	je     800aba <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a8f:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a95:	75 0f                	jne    800aa6 <strtol+0x40>
+  800a97:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a9a:	74 28                	je     800ac4 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a9c:	85 db                	test   %ebx,%ebx
+  800a9e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800aa3:	0f 44 d8             	cmove  %eax,%ebx
+  800aa6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aab:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800aae:	eb 46                	jmp    800af6 <strtol+0x90>
+		s++;
+  800ab0:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800ab3:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ab8:	eb d5                	jmp    800a8f <strtol+0x29>
+		s++, neg = 1;
+  800aba:	83 c2 01             	add    $0x1,%edx
+  800abd:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ac2:	eb cb                	jmp    800a8f <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ac4:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ac8:	74 0e                	je     800ad8 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800aca:	85 db                	test   %ebx,%ebx
+  800acc:	75 d8                	jne    800aa6 <strtol+0x40>
+		s++, base = 8;
+  800ace:	83 c2 01             	add    $0x1,%edx
+  800ad1:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ad6:	eb ce                	jmp    800aa6 <strtol+0x40>
+		s += 2, base = 16;
+  800ad8:	83 c2 02             	add    $0x2,%edx
+  800adb:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ae0:	eb c4                	jmp    800aa6 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ae2:	0f be c0             	movsbl %al,%eax
+  800ae5:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ae8:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800aeb:	7d 3a                	jge    800b27 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800aed:	83 c2 01             	add    $0x1,%edx
+  800af0:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800af4:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800af6:	0f b6 02             	movzbl (%edx),%eax
+  800af9:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800afc:	89 f3                	mov    %esi,%ebx
+  800afe:	80 fb 09             	cmp    $0x9,%bl
+  800b01:	76 df                	jbe    800ae2 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b03:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b06:	89 f3                	mov    %esi,%ebx
+  800b08:	80 fb 19             	cmp    $0x19,%bl
+  800b0b:	77 08                	ja     800b15 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b0d:	0f be c0             	movsbl %al,%eax
+  800b10:	83 e8 57             	sub    $0x57,%eax
+  800b13:	eb d3                	jmp    800ae8 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b15:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b18:	89 f3                	mov    %esi,%ebx
+  800b1a:	80 fb 19             	cmp    $0x19,%bl
+  800b1d:	77 08                	ja     800b27 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b1f:	0f be c0             	movsbl %al,%eax
+  800b22:	83 e8 37             	sub    $0x37,%eax
+  800b25:	eb c1                	jmp    800ae8 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b27:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b2b:	74 05                	je     800b32 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b2d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b30:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b32:	89 c8                	mov    %ecx,%eax
+  800b34:	f7 d8                	neg    %eax
+  800b36:	85 ff                	test   %edi,%edi
+  800b38:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b3b:	89 c8                	mov    %ecx,%eax
+  800b3d:	5b                   	pop    %ebx
+  800b3e:	5e                   	pop    %esi
+  800b3f:	5f                   	pop    %edi
+  800b40:	5d                   	pop    %ebp
+  800b41:	c3                   	ret
+
+00800b42 <atoi>:
+
+int
+atoi(const char *s)
+{
+  800b42:	55                   	push   %ebp
+  800b43:	89 e5                	mov    %esp,%ebp
+  800b45:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800b48:	6a 0a                	push   $0xa
+  800b4a:	6a 00                	push   $0x0
+  800b4c:	ff 75 08             	push   0x8(%ebp)
+  800b4f:	e8 12 ff ff ff       	call   800a66 <strtol>
+}
+  800b54:	c9                   	leave
+  800b55:	c3                   	ret
+
+00800b56 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800b56:	55                   	push   %ebp
+  800b57:	89 e5                	mov    %esp,%ebp
+  800b59:	57                   	push   %edi
+  800b5a:	56                   	push   %esi
+  800b5b:	53                   	push   %ebx
+  800b5c:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800b62:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800b68:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800b6e:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800b74:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800b7b:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800b7e:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800b85:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800b88:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800b8f:	74 76                	je     800c07 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800b91:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800b97:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b9a:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800ba0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ba7:	0f 88 06 01 00 00    	js     800cb3 <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800bad:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800bb4:	0f 84 48 01 00 00    	je     800d02 <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800bba:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800bc0:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800bc6:	be 00 00 00 00       	mov    $0x0,%esi
+  800bcb:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800bd1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800bd4:	55                   	push   %ebp
+  800bd5:	68 de 0b 80 00       	push   $0x800bde
+  800bda:	89 e5                	mov    %esp,%ebp
+  800bdc:	0f 34                	sysenter
+  800bde:	83 c4 04             	add    $0x4,%esp
+  800be1:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800be2:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800be8:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800bee:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800bf1:	0f 85 9a 01 00 00    	jne    800d91 <page_vec_call+0x23b>
+  800bf7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bfc:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bff:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c02:	e9 29 01 00 00       	jmp    800d30 <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800c07:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800c0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c10:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800c12:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800c19:	78 2f                	js     800c4a <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800c1b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800c22:	74 72                	je     800c96 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800c24:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800c2a:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800c30:	b8 10 00 00 00       	mov    $0x10,%eax
+  800c35:	89 fb                	mov    %edi,%ebx
+  800c37:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c3a:	55                   	push   %ebp
+  800c3b:	68 44 0c 80 00       	push   $0x800c44
+  800c40:	89 e5                	mov    %esp,%ebp
+  800c42:	0f 34                	sysenter
+  800c44:	83 c4 04             	add    $0x4,%esp
+  800c47:	5d                   	pop    %ebp
+	return ret;
+  800c48:	eb 98                	jmp    800be2 <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800c4a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c4f:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800c51:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800c56:	f6 c6 08             	test   $0x8,%dh
+  800c59:	74 15                	je     800c70 <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c5b:	89 c2                	mov    %eax,%edx
+  800c5d:	c1 ea 08             	shr    $0x8,%edx
+  800c60:	83 e2 0f             	and    $0xf,%edx
+  800c63:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800c68:	83 fa 06             	cmp    $0x6,%edx
+  800c6b:	74 0e                	je     800c7b <page_vec_call+0x125>
+  800c6d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800c70:	0f b6 c9             	movzbl %cl,%ecx
+  800c73:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800c79:	eb a0                	jmp    800c1b <page_vec_call+0xc5>
+  800c7b:	89 c2                	mov    %eax,%edx
+  800c7d:	c1 ea 04             	shr    $0x4,%edx
+  800c80:	83 e2 0f             	and    $0xf,%edx
+  800c83:	83 fa 02             	cmp    $0x2,%edx
+  800c86:	77 e5                	ja     800c6d <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800c88:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c8b:	83 f8 02             	cmp    $0x2,%eax
+  800c8e:	0f 97 c1             	seta   %cl
+  800c91:	0f b6 c9             	movzbl %cl,%ecx
+  800c94:	eb d7                	jmp    800c6d <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800c96:	b8 10 00 00 00       	mov    $0x10,%eax
+  800c9b:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800ca1:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800ca7:	89 fb                	mov    %edi,%ebx
+  800ca9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800cac:	cd 30                	int    $0x30
+  800cae:	e9 2f ff ff ff       	jmp    800be2 <page_vec_call+0x8c>
+  800cb3:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cb8:	0f a2                	cpuid
+		return 0;
+  800cba:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800cbf:	f6 c6 08             	test   $0x8,%dh
+  800cc2:	74 15                	je     800cd9 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800cc4:	89 c2                	mov    %eax,%edx
+  800cc6:	c1 ea 08             	shr    $0x8,%edx
+  800cc9:	83 e2 0f             	and    $0xf,%edx
+  800ccc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800cd1:	83 fa 06             	cmp    $0x6,%edx
+  800cd4:	74 11                	je     800ce7 <page_vec_call+0x191>
+  800cd6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800cd9:	0f b6 c9             	movzbl %cl,%ecx
+  800cdc:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800ce2:	e9 c6 fe ff ff       	jmp    800bad <page_vec_call+0x57>
+  800ce7:	89 c2                	mov    %eax,%edx
+  800ce9:	c1 ea 04             	shr    $0x4,%edx
+  800cec:	83 e2 0f             	and    $0xf,%edx
+  800cef:	83 fa 02             	cmp    $0x2,%edx
+  800cf2:	77 e2                	ja     800cd6 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800cf4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800cf7:	83 f8 02             	cmp    $0x2,%eax
+  800cfa:	0f 97 c1             	seta   %cl
+  800cfd:	0f b6 c9             	movzbl %cl,%ecx
+  800d00:	eb d4                	jmp    800cd6 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800d02:	be 00 00 00 00       	mov    $0x0,%esi
+  800d07:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800d0d:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800d13:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800d19:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800d1c:	cd 30                	int    $0x30
+  800d1e:	e9 bf fe ff ff       	jmp    800be2 <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800d23:	29 da                	sub    %ebx,%edx
+			vec++;
+  800d25:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800d28:	83 e8 01             	sub    $0x1,%eax
+  800d2b:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800d30:	85 c0                	test   %eax,%eax
+  800d32:	74 58                	je     800d8c <page_vec_call+0x236>
+  800d34:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800d37:	39 da                	cmp    %ebx,%edx
+  800d39:	73 e8                	jae    800d23 <page_vec_call+0x1cd>
+  800d3b:	89 75 08             	mov    %esi,0x8(%ebp)
+  800d3e:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800d41:	84 c9                	test   %cl,%cl
+  800d43:	74 06                	je     800d4b <page_vec_call+0x1f5>
+  800d45:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800d4b:	83 ec 04             	sub    $0x4,%esp
+  800d4e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d51:	c1 e0 04             	shl    $0x4,%eax
+  800d54:	50                   	push   %eax
+  800d55:	ff 75 08             	push   0x8(%ebp)
+  800d58:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800d5e:	53                   	push   %ebx
+  800d5f:	e8 34 fc ff ff       	call   800998 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800d64:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800d6a:	89 c2                	mov    %eax,%edx
+  800d6c:	c1 e2 0c             	shl    $0xc,%edx
+  800d6f:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  800d75:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  800d7b:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  800d81:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  800d84:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  800d87:	e9 f2 fd ff ff       	jmp    800b7e <page_vec_call+0x28>
+			r = 0;
+  800d8c:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  800d91:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800d95:	74 0b                	je     800da2 <page_vec_call+0x24c>
+		*done = total;
+  800d97:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800d9a:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  800da0:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  800da2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800da5:	5b                   	pop    %ebx
+  800da6:	5e                   	pop    %esi
+  800da7:	5f                   	pop    %edi
+  800da8:	5d                   	pop    %ebp
+  800da9:	c3                   	ret
+
+00800daa <sys_cputs>:
+{
+  800daa:	55                   	push   %ebp
+  800dab:	89 e5                	mov    %esp,%ebp
+  800dad:	57                   	push   %edi
+  800dae:	56                   	push   %esi
+  800daf:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800db0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800db7:	78 2d                	js     800de6 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800db9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800dc0:	74 70                	je     800e32 <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800dc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dcd:	89 c3                	mov    %eax,%ebx
+  800dcf:	89 c7                	mov    %eax,%edi
+  800dd1:	89 c6                	mov    %eax,%esi
+  800dd3:	55                   	push   %ebp
+  800dd4:	68 dd 0d 80 00       	push   $0x800ddd
+  800dd9:	89 e5                	mov    %esp,%ebp
+  800ddb:	0f 34                	sysenter
+  800ddd:	83 c4 04             	add    $0x4,%esp
+  800de0:	5d                   	pop    %ebp
+}
+  800de1:	5b                   	pop    %ebx
+  800de2:	5e                   	pop    %esi
+  800de3:	5f                   	pop    %edi
+  800de4:	5d                   	pop    %ebp
+  800de5:	c3                   	ret
+  800de6:	b8 01 00 00 00       	mov    $0x1,%eax
+  800deb:	0f a2                	cpuid
+		return 0;
+  800ded:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800df2:	f6 c6 08             	test   $0x8,%dh
+  800df5:	74 15                	je     800e0c <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800df7:	89 c2                	mov    %eax,%edx
+  800df9:	c1 ea 08             	shr    $0x8,%edx
+  800dfc:	83 e2 0f             	and    $0xf,%edx
+  800dff:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e04:	83 fa 06             	cmp    $0x6,%edx
+  800e07:	74 0e                	je     800e17 <sys_cputs+0x6d>
+  800e09:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e0c:	0f b6 c9             	movzbl %cl,%ecx
+  800e0f:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800e15:	eb a2                	jmp    800db9 <sys_cputs+0xf>
+  800e17:	89 c2                	mov    %eax,%edx
+  800e19:	c1 ea 04             	shr    $0x4,%edx
+  800e1c:	83 e2 0f             	and    $0xf,%edx
+  800e1f:	83 fa 02             	cmp    $0x2,%edx
+  800e22:	77 e5                	ja     800e09 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800e24:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e27:	83 f8 02             	cmp    $0x2,%eax
+  800e2a:	0f 97 c1             	seta   %cl
+  800e2d:	0f b6 c9             	movzbl %cl,%ecx
+  800e30:	eb d7                	jmp    800e09 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800e32:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e37:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3d:	89 c3                	mov    %eax,%ebx
+  800e3f:	89 c7                	mov    %eax,%edi
+  800e41:	89 c6                	mov    %eax,%esi
+  800e43:	cd 30                	int    $0x30
+}
+  800e45:	eb 9a                	jmp    800de1 <sys_cputs+0x37>
+
+00800e47 <sys_cgetc>:
+{
+  800e47:	55                   	push   %ebp
+  800e48:	89 e5                	mov    %esp,%ebp
+  800e4a:	57                   	push   %edi
+  800e4b:	56                   	push   %esi
+  800e4c:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800e4d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e54:	78 2e                	js     800e84 <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  800e56:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e5d:	74 71                	je     800ed0 <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  800e5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e64:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e69:	89 d1                	mov    %edx,%ecx
+  800e6b:	89 d3                	mov    %edx,%ebx
+  800e6d:	89 d7                	mov    %edx,%edi
+  800e6f:	89 d6                	mov    %edx,%esi
+  800e71:	55                   	push   %ebp
+  800e72:	68 7b 0e 80 00       	push   $0x800e7b
+  800e77:	89 e5                	mov    %esp,%ebp
+  800e79:	0f 34                	sysenter
+  800e7b:	83 c4 04             	add    $0x4,%esp
+  800e7e:	5d                   	pop    %ebp
+}
+  800e7f:	5b                   	pop    %ebx
+  800e80:	5e                   	pop    %esi
+  800e81:	5f                   	pop    %edi
+  800e82:	5d                   	pop    %ebp
+  800e83:	c3                   	ret
+  800e84:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e89:	0f a2                	cpuid
+		return 0;
+  800e8b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800e90:	f6 c6 08             	test   $0x8,%dh
+  800e93:	74 15                	je     800eaa <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e95:	89 c2                	mov    %eax,%edx
+  800e97:	c1 ea 08             	shr    $0x8,%edx
+  800e9a:	83 e2 0f             	and    $0xf,%edx
+  800e9d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ea2:	83 fa 06             	cmp    $0x6,%edx
+  800ea5:	74 0e                	je     800eb5 <sys_cgetc+0x6e>
+  800ea7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800eaa:	0f b6 c9             	movzbl %cl,%ecx
+  800ead:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800eb3:	eb a1                	jmp    800e56 <sys_cgetc+0xf>
+  800eb5:	89 c2                	mov    %eax,%edx
+  800eb7:	c1 ea 04             	shr    $0x4,%edx
+  800eba:	83 e2 0f             	and    $0xf,%edx
+  800ebd:	83 fa 02             	cmp    $0x2,%edx
+  800ec0:	77 e5                	ja     800ea7 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  800ec2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ec5:	83 f8 02             	cmp    $0x2,%eax
+  800ec8:	0f 97 c1             	seta   %cl
+  800ecb:	0f b6 c9             	movzbl %cl,%ecx
+  800ece:	eb d7                	jmp    800ea7 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  800ed0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ed5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800eda:	89 d1                	mov    %edx,%ecx
+  800edc:	89 d3                	mov    %edx,%ebx
+  800ede:	89 d7                	mov    %edx,%edi
+  800ee0:	89 d6                	mov    %edx,%esi
+  800ee2:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800ee4:	eb 99                	jmp    800e7f <sys_cgetc+0x38>
+
+00800ee6 <sys_env_destroy>:
+{
+  800ee6:	55                   	push   %ebp
+  800ee7:	89 e5                	mov    %esp,%ebp
+  800ee9:	57                   	push   %edi
+  800eea:	56                   	push   %esi
+  800eeb:	53                   	push   %ebx
+  800eec:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800eef:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ef6:	78 36                	js     800f2e <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  800ef8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800eff:	74 79                	je     800f7a <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  800f01:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f04:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f09:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f0e:	89 cb                	mov    %ecx,%ebx
+  800f10:	89 cf                	mov    %ecx,%edi
+  800f12:	89 ce                	mov    %ecx,%esi
+  800f14:	55                   	push   %ebp
+  800f15:	68 1e 0f 80 00       	push   $0x800f1e
+  800f1a:	89 e5                	mov    %esp,%ebp
+  800f1c:	0f 34                	sysenter
+  800f1e:	83 c4 04             	add    $0x4,%esp
+  800f21:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800f22:	85 c0                	test   %eax,%eax
+  800f24:	7f 6b                	jg     800f91 <sys_env_destroy+0xab>
+}
+  800f26:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f29:	5b                   	pop    %ebx
+  800f2a:	5e                   	pop    %esi
+  800f2b:	5f                   	pop    %edi
+  800f2c:	5d                   	pop    %ebp
+  800f2d:	c3                   	ret
+  800f2e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f33:	0f a2                	cpuid
+		return 0;
+  800f35:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f3a:	f6 c6 08             	test   $0x8,%dh
+  800f3d:	74 15                	je     800f54 <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f3f:	89 c2                	mov    %eax,%edx
+  800f41:	c1 ea 08             	shr    $0x8,%edx
+  800f44:	83 e2 0f             	and    $0xf,%edx
+  800f47:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f4c:	83 fa 06             	cmp    $0x6,%edx
+  800f4f:	74 0e                	je     800f5f <sys_env_destroy+0x79>
+  800f51:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f54:	0f b6 c9             	movzbl %cl,%ecx
+  800f57:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800f5d:	eb 99                	jmp    800ef8 <sys_env_destroy+0x12>
+  800f5f:	89 c2                	mov    %eax,%edx
+  800f61:	c1 ea 04             	shr    $0x4,%edx
+  800f64:	83 e2 0f             	and    $0xf,%edx
+  800f67:	83 fa 02             	cmp    $0x2,%edx
+  800f6a:	77 e5                	ja     800f51 <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  800f6c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f6f:	83 f8 02             	cmp    $0x2,%eax
+  800f72:	0f 97 c1             	seta   %cl
+  800f75:	0f b6 c9             	movzbl %cl,%ecx
+  800f78:	eb d7                	jmp    800f51 <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  800f7a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f7f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f84:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f87:	89 cb                	mov    %ecx,%ebx
+  800f89:	89 cf                	mov    %ecx,%edi
+  800f8b:	89 ce                	mov    %ecx,%esi
+  800f8d:	cd 30                	int    $0x30
+  800f8f:	eb 91                	jmp    800f22 <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f91:	83 ec 0c             	sub    $0xc,%esp
+  800f94:	50                   	push   %eax
+  800f95:	6a 03                	push   $0x3
+  800f97:	68 b9 2c 80 00       	push   $0x802cb9
+  800f9c:	6a 4a                	push   $0x4a
+  800f9e:	68 d6 2c 80 00       	push   $0x802cd6
+  800fa3:	e8 68 f1 ff ff       	call   800110 <_panic>
+
+00800fa8 <sys_getenvid>:
+{
+  800fa8:	55                   	push   %ebp
+  800fa9:	89 e5                	mov    %esp,%ebp
+  800fab:	57                   	push   %edi
+  800fac:	56                   	push   %esi
+  800fad:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800fae:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fb5:	78 2e                	js     800fe5 <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  800fb7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fbe:	74 71                	je     801031 <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  800fc0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fc5:	b8 02 00 00 00       	mov    $0x2,%eax
+  800fca:	89 d1                	mov    %edx,%ecx
+  800fcc:	89 d3                	mov    %edx,%ebx
+  800fce:	89 d7                	mov    %edx,%edi
+  800fd0:	89 d6                	mov    %edx,%esi
+  800fd2:	55                   	push   %ebp
+  800fd3:	68 dc 0f 80 00       	push   $0x800fdc
+  800fd8:	89 e5                	mov    %esp,%ebp
+  800fda:	0f 34                	sysenter
+  800fdc:	83 c4 04             	add    $0x4,%esp
+  800fdf:	5d                   	pop    %ebp
+}
+  800fe0:	5b                   	pop    %ebx
+  800fe1:	5e                   	pop    %esi
+  800fe2:	5f                   	pop    %edi
+  800fe3:	5d                   	pop    %ebp
+  800fe4:	c3                   	ret
+  800fe5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fea:	0f a2                	cpuid
+		return 0;
+  800fec:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800ff1:	f6 c6 08             	test   $0x8,%dh
+  800ff4:	74 15                	je     80100b <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ff6:	89 c2                	mov    %eax,%edx
+  800ff8:	c1 ea 08             	shr    $0x8,%edx
+  800ffb:	83 e2 0f             	and    $0xf,%edx
+  800ffe:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801003:	83 fa 06             	cmp    $0x6,%edx
+  801006:	74 0e                	je     801016 <sys_getenvid+0x6e>
+  801008:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80100b:	0f b6 c9             	movzbl %cl,%ecx
+  80100e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801014:	eb a1                	jmp    800fb7 <sys_getenvid+0xf>
+  801016:	89 c2                	mov    %eax,%edx
+  801018:	c1 ea 04             	shr    $0x4,%edx
+  80101b:	83 e2 0f             	and    $0xf,%edx
+  80101e:	83 fa 02             	cmp    $0x2,%edx
+  801021:	77 e5                	ja     801008 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  801023:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801026:	83 f8 02             	cmp    $0x2,%eax
+  801029:	0f 97 c1             	seta   %cl
+  80102c:	0f b6 c9             	movzbl %cl,%ecx
+  80102f:	eb d7                	jmp    801008 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  801031:	ba 00 00 00 00       	mov    $0x0,%edx
+  801036:	b8 02 00 00 00       	mov    $0x2,%eax
+  80103b:	89 d1                	mov    %edx,%ecx
+  80103d:	89 d3                	mov    %edx,%ebx
+  80103f:	89 d7                	mov    %edx,%edi
+  801041:	89 d6                	mov    %edx,%esi
+  801043:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801045:	eb 99                	jmp    800fe0 <sys_getenvid+0x38>
+
+00801047 <sys_page_alloc>:
+{
+  801047:	55                   	push   %ebp
+  801048:	89 e5                	mov    %esp,%ebp
+  80104a:	57                   	push   %edi
+  80104b:	56                   	push   %esi
+  80104c:	53                   	push   %ebx
+  80104d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801050:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801057:	78 38                	js     801091 <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  801059:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801060:	74 7b                	je     8010dd <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  801062:	be 00 00 00 00       	mov    $0x0,%esi
+  801067:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80106d:	b8 04 00 00 00       	mov    $0x4,%eax
+  801072:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801075:	89 f7                	mov    %esi,%edi
+  801077:	55                   	push   %ebp
+  801078:	68 81 10 80 00       	push   $0x801081
+  80107d:	89 e5                	mov    %esp,%ebp
+  80107f:	0f 34                	sysenter
+  801081:	83 c4 04             	add    $0x4,%esp
+  801084:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801085:	85 c0                	test   %eax,%eax
+  801087:	7f 6d                	jg     8010f6 <sys_page_alloc+0xaf>
+}
+  801089:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80108c:	5b                   	pop    %ebx
+  80108d:	5e                   	pop    %esi
+  80108e:	5f                   	pop    %edi
+  80108f:	5d                   	pop    %ebp
+  801090:	c3                   	ret
+  801091:	b8 01 00 00 00       	mov    $0x1,%eax
+  801096:	0f a2                	cpuid
+		return 0;
+  801098:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80109d:	f6 c6 08             	test   $0x8,%dh
+  8010a0:	74 15                	je     8010b7 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010a2:	89 c2                	mov    %eax,%edx
+  8010a4:	c1 ea 08             	shr    $0x8,%edx
+  8010a7:	83 e2 0f             	and    $0xf,%edx
+  8010aa:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8010af:	83 fa 06             	cmp    $0x6,%edx
+  8010b2:	74 0e                	je     8010c2 <sys_page_alloc+0x7b>
+  8010b4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8010b7:	0f b6 c9             	movzbl %cl,%ecx
+  8010ba:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8010c0:	eb 97                	jmp    801059 <sys_page_alloc+0x12>
+  8010c2:	89 c2                	mov    %eax,%edx
+  8010c4:	c1 ea 04             	shr    $0x4,%edx
+  8010c7:	83 e2 0f             	and    $0xf,%edx
+  8010ca:	83 fa 02             	cmp    $0x2,%edx
+  8010cd:	77 e5                	ja     8010b4 <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  8010cf:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010d2:	83 f8 02             	cmp    $0x2,%eax
+  8010d5:	0f 97 c1             	seta   %cl
+  8010d8:	0f b6 c9             	movzbl %cl,%ecx
+  8010db:	eb d7                	jmp    8010b4 <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  8010dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8010e2:	b8 04 00 00 00       	mov    $0x4,%eax
+  8010e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ed:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010f0:	89 f7                	mov    %esi,%edi
+  8010f2:	cd 30                	int    $0x30
+  8010f4:	eb 8f                	jmp    801085 <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010f6:	83 ec 0c             	sub    $0xc,%esp
+  8010f9:	50                   	push   %eax
+  8010fa:	6a 04                	push   $0x4
+  8010fc:	68 b9 2c 80 00       	push   $0x802cb9
+  801101:	6a 4a                	push   $0x4a
+  801103:	68 d6 2c 80 00       	push   $0x802cd6
+  801108:	e8 03 f0 ff ff       	call   800110 <_panic>
+
+0080110d <sys_page_map>:
+{
+  80110d:	55                   	push   %ebp
+  80110e:	89 e5                	mov    %esp,%ebp
+  801110:	57                   	push   %edi
+  801111:	56                   	push   %esi
+  801112:	53                   	push   %ebx
+  801113:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801116:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80111d:	78 37                	js     801156 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  80111f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801126:	74 7a                	je     8011a2 <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  801128:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112e:	b8 05 00 00 00       	mov    $0x5,%eax
+  801133:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801136:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801139:	8b 75 18             	mov    0x18(%ebp),%esi
+  80113c:	55                   	push   %ebp
+  80113d:	68 46 11 80 00       	push   $0x801146
+  801142:	89 e5                	mov    %esp,%ebp
+  801144:	0f 34                	sysenter
+  801146:	83 c4 04             	add    $0x4,%esp
+  801149:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80114a:	85 c0                	test   %eax,%eax
+  80114c:	7f 6c                	jg     8011ba <sys_page_map+0xad>
+}
+  80114e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801151:	5b                   	pop    %ebx
+  801152:	5e                   	pop    %esi
+  801153:	5f                   	pop    %edi
+  801154:	5d                   	pop    %ebp
+  801155:	c3                   	ret
+  801156:	b8 01 00 00 00       	mov    $0x1,%eax
+  80115b:	0f a2                	cpuid
+		return 0;
+  80115d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801162:	f6 c6 08             	test   $0x8,%dh
+  801165:	74 15                	je     80117c <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801167:	89 c2                	mov    %eax,%edx
+  801169:	c1 ea 08             	shr    $0x8,%edx
+  80116c:	83 e2 0f             	and    $0xf,%edx
+  80116f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801174:	83 fa 06             	cmp    $0x6,%edx
+  801177:	74 0e                	je     801187 <sys_page_map+0x7a>
+  801179:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80117c:	0f b6 c9             	movzbl %cl,%ecx
+  80117f:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801185:	eb 98                	jmp    80111f <sys_page_map+0x12>
+  801187:	89 c2                	mov    %eax,%edx
+  801189:	c1 ea 04             	shr    $0x4,%edx
+  80118c:	83 e2 0f             	and    $0xf,%edx
+  80118f:	83 fa 02             	cmp    $0x2,%edx
+  801192:	77 e5                	ja     801179 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  801194:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801197:	83 f8 02             	cmp    $0x2,%eax
+  80119a:	0f 97 c1             	seta   %cl
+  80119d:	0f b6 c9             	movzbl %cl,%ecx
+  8011a0:	eb d7                	jmp    801179 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  8011a2:	b8 05 00 00 00       	mov    $0x5,%eax
+  8011a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011b0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011b3:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011b6:	cd 30                	int    $0x30
+  8011b8:	eb 90                	jmp    80114a <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011ba:	83 ec 0c             	sub    $0xc,%esp
+  8011bd:	50                   	push   %eax
+  8011be:	6a 05                	push   $0x5
+  8011c0:	68 b9 2c 80 00       	push   $0x802cb9
+  8011c5:	6a 4a                	push   $0x4a
+  8011c7:	68 d6 2c 80 00       	push   $0x802cd6
+  8011cc:	e8 3f ef ff ff       	call   800110 <_panic>
+
+008011d1 <sys_page_unmap>:
+{
+  8011d1:	55                   	push   %ebp
+  8011d2:	89 e5                	mov    %esp,%ebp
+  8011d4:	57                   	push   %edi
+  8011d5:	56                   	push   %esi
+  8011d6:	53                   	push   %ebx
+  8011d7:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8011da:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8011e1:	78 37                	js     80121a <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  8011e3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8011ea:	74 7a                	je     801266 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  8011ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f7:	b8 06 00 00 00       	mov    $0x6,%eax
+  8011fc:	89 df                	mov    %ebx,%edi
+  8011fe:	89 de                	mov    %ebx,%esi
+  801200:	55                   	push   %ebp
+  801201:	68 0a 12 80 00       	push   $0x80120a
+  801206:	89 e5                	mov    %esp,%ebp
+  801208:	0f 34                	sysenter
+  80120a:	83 c4 04             	add    $0x4,%esp
+  80120d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80120e:	85 c0                	test   %eax,%eax
+  801210:	7f 6c                	jg     80127e <sys_page_unmap+0xad>
+}
+  801212:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801215:	5b                   	pop    %ebx
+  801216:	5e                   	pop    %esi
+  801217:	5f                   	pop    %edi
+  801218:	5d                   	pop    %ebp
+  801219:	c3                   	ret
+  80121a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80121f:	0f a2                	cpuid
+		return 0;
+  801221:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801226:	f6 c6 08             	test   $0x8,%dh
+  801229:	74 15                	je     801240 <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80122b:	89 c2                	mov    %eax,%edx
+  80122d:	c1 ea 08             	shr    $0x8,%edx
+  801230:	83 e2 0f             	and    $0xf,%edx
+  801233:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801238:	83 fa 06             	cmp    $0x6,%edx
+  80123b:	74 0e                	je     80124b <sys_page_unmap+0x7a>
+  80123d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801240:	0f b6 c9             	movzbl %cl,%ecx
+  801243:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801249:	eb 98                	jmp    8011e3 <sys_page_unmap+0x12>
+  80124b:	89 c2                	mov    %eax,%edx
+  80124d:	c1 ea 04             	shr    $0x4,%edx
+  801250:	83 e2 0f             	and    $0xf,%edx
+  801253:	83 fa 02             	cmp    $0x2,%edx
+  801256:	77 e5                	ja     80123d <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  801258:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80125b:	83 f8 02             	cmp    $0x2,%eax
+  80125e:	0f 97 c1             	seta   %cl
+  801261:	0f b6 c9             	movzbl %cl,%ecx
+  801264:	eb d7                	jmp    80123d <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  801266:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80126b:	b8 06 00 00 00       	mov    $0x6,%eax
+  801270:	8b 55 08             	mov    0x8(%ebp),%edx
+  801273:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801276:	89 df                	mov    %ebx,%edi
+  801278:	89 de                	mov    %ebx,%esi
+  80127a:	cd 30                	int    $0x30
+  80127c:	eb 90                	jmp    80120e <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80127e:	83 ec 0c             	sub    $0xc,%esp
+  801281:	50                   	push   %eax
+  801282:	6a 06                	push   $0x6
+  801284:	68 b9 2c 80 00       	push   $0x802cb9
+  801289:	6a 4a                	push   $0x4a
+  80128b:	68 d6 2c 80 00       	push   $0x802cd6
+  801290:	e8 7b ee ff ff       	call   800110 <_panic>
+
+00801295 <sys_page_copy>:
+{
+  801295:	55                   	push   %ebp
+  801296:	89 e5                	mov    %esp,%ebp
+  801298:	57                   	push   %edi
+  801299:	56                   	push   %esi
+  80129a:	53                   	push   %ebx
+  80129b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80129e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8012a5:	78 37                	js     8012de <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  8012a7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8012ae:	74 7a                	je     80132a <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  8012b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b6:	b8 29 00 00 00       	mov    $0x29,%eax
+  8012bb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012be:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012c1:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012c4:	55                   	push   %ebp
+  8012c5:	68 ce 12 80 00       	push   $0x8012ce
+  8012ca:	89 e5                	mov    %esp,%ebp
+  8012cc:	0f 34                	sysenter
+  8012ce:	83 c4 04             	add    $0x4,%esp
+  8012d1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8012d2:	85 c0                	test   %eax,%eax
+  8012d4:	7f 6c                	jg     801342 <sys_page_copy+0xad>
+}
+  8012d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012d9:	5b                   	pop    %ebx
+  8012da:	5e                   	pop    %esi
+  8012db:	5f                   	pop    %edi
+  8012dc:	5d                   	pop    %ebp
+  8012dd:	c3                   	ret
+  8012de:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012e3:	0f a2                	cpuid
+		return 0;
+  8012e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8012ea:	f6 c6 08             	test   $0x8,%dh
+  8012ed:	74 15                	je     801304 <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012ef:	89 c2                	mov    %eax,%edx
+  8012f1:	c1 ea 08             	shr    $0x8,%edx
+  8012f4:	83 e2 0f             	and    $0xf,%edx
+  8012f7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012fc:	83 fa 06             	cmp    $0x6,%edx
+  8012ff:	74 0e                	je     80130f <sys_page_copy+0x7a>
+  801301:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801304:	0f b6 c9             	movzbl %cl,%ecx
+  801307:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80130d:	eb 98                	jmp    8012a7 <sys_page_copy+0x12>
+  80130f:	89 c2                	mov    %eax,%edx
+  801311:	c1 ea 04             	shr    $0x4,%edx
+  801314:	83 e2 0f             	and    $0xf,%edx
+  801317:	83 fa 02             	cmp    $0x2,%edx
+  80131a:	77 e5                	ja     801301 <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  80131c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80131f:	83 f8 02             	cmp    $0x2,%eax
+  801322:	0f 97 c1             	seta   %cl
+  801325:	0f b6 c9             	movzbl %cl,%ecx
+  801328:	eb d7                	jmp    801301 <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  80132a:	b8 29 00 00 00       	mov    $0x29,%eax
+  80132f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801332:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801335:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801338:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80133b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80133e:	cd 30                	int    $0x30
+  801340:	eb 90                	jmp    8012d2 <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801342:	83 ec 0c             	sub    $0xc,%esp
+  801345:	50                   	push   %eax
+  801346:	6a 29                	push   $0x29
+  801348:	68 b9 2c 80 00       	push   $0x802cb9
+  80134d:	6a 4a                	push   $0x4a
+  80134f:	68 d6 2c 80 00       	push   $0x802cd6
+  801354:	e8 b7 ed ff ff       	call   800110 <_panic>
+
+00801359 <sys_yield>:
+{
+  801359:	55                   	push   %ebp
+  80135a:	89 e5                	mov    %esp,%ebp
+  80135c:	57                   	push   %edi
+  80135d:	56                   	push   %esi
+  80135e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80135f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801366:	78 2e                	js     801396 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  801368:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80136f:	74 71                	je     8013e2 <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  801371:	ba 00 00 00 00       	mov    $0x0,%edx
+  801376:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80137b:	89 d1                	mov    %edx,%ecx
+  80137d:	89 d3                	mov    %edx,%ebx
+  80137f:	89 d7                	mov    %edx,%edi
+  801381:	89 d6                	mov    %edx,%esi
+  801383:	55                   	push   %ebp
+  801384:	68 8d 13 80 00       	push   $0x80138d
+  801389:	89 e5                	mov    %esp,%ebp
+  80138b:	0f 34                	sysenter
+  80138d:	83 c4 04             	add    $0x4,%esp
+  801390:	5d                   	pop    %ebp
+}
+  801391:	5b                   	pop    %ebx
+  801392:	5e                   	pop    %esi
+  801393:	5f                   	pop    %edi
+  801394:	5d                   	pop    %ebp
+  801395:	c3                   	ret
+  801396:	b8 01 00 00 00       	mov    $0x1,%eax
+  80139b:	0f a2                	cpuid
+		return 0;
+  80139d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8013a2:	f6 c6 08             	test   $0x8,%dh
+  8013a5:	74 15                	je     8013bc <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013a7:	89 c2                	mov    %eax,%edx
+  8013a9:	c1 ea 08             	shr    $0x8,%edx
+  8013ac:	83 e2 0f             	and    $0xf,%edx
+  8013af:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8013b4:	83 fa 06             	cmp    $0x6,%edx
+  8013b7:	74 0e                	je     8013c7 <sys_yield+0x6e>
+  8013b9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8013bc:	0f b6 c9             	movzbl %cl,%ecx
+  8013bf:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8013c5:	eb a1                	jmp    801368 <sys_yield+0xf>
+  8013c7:	89 c2                	mov    %eax,%edx
+  8013c9:	c1 ea 04             	shr    $0x4,%edx
+  8013cc:	83 e2 0f             	and    $0xf,%edx
+  8013cf:	83 fa 02             	cmp    $0x2,%edx
+  8013d2:	77 e5                	ja     8013b9 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  8013d4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013d7:	83 f8 02             	cmp    $0x2,%eax
+  8013da:	0f 97 c1             	seta   %cl
+  8013dd:	0f b6 c9             	movzbl %cl,%ecx
+  8013e0:	eb d7                	jmp    8013b9 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  8013e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013e7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8013ec:	89 d1                	mov    %edx,%ecx
+  8013ee:	89 d3                	mov    %edx,%ebx
+  8013f0:	89 d7                	mov    %edx,%edi
+  8013f2:	89 d6                	mov    %edx,%esi
+  8013f4:	cd 30                	int    $0x30
+}
+  8013f6:	eb 99                	jmp    801391 <sys_yield+0x38>
+
+008013f8 <sys_env_set_status>:
+{
+  8013f8:	55                   	push   %ebp
+  8013f9:	89 e5                	mov    %esp,%ebp
+  8013fb:	57                   	push   %edi
+  8013fc:	56                   	push   %esi
+  8013fd:	53                   	push   %ebx
+  8013fe:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801401:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801408:	78 37                	js     801441 <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  80140a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801411:	74 7a                	je     80148d <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  801413:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801418:	8b 55 08             	mov    0x8(%ebp),%edx
+  80141b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80141e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801423:	89 df                	mov    %ebx,%edi
+  801425:	89 de                	mov    %ebx,%esi
+  801427:	55                   	push   %ebp
+  801428:	68 31 14 80 00       	push   $0x801431
+  80142d:	89 e5                	mov    %esp,%ebp
+  80142f:	0f 34                	sysenter
+  801431:	83 c4 04             	add    $0x4,%esp
+  801434:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801435:	85 c0                	test   %eax,%eax
+  801437:	7f 6c                	jg     8014a5 <sys_env_set_status+0xad>
+}
+  801439:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80143c:	5b                   	pop    %ebx
+  80143d:	5e                   	pop    %esi
+  80143e:	5f                   	pop    %edi
+  80143f:	5d                   	pop    %ebp
+  801440:	c3                   	ret
+  801441:	b8 01 00 00 00       	mov    $0x1,%eax
+  801446:	0f a2                	cpuid
+		return 0;
+  801448:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80144d:	f6 c6 08             	test   $0x8,%dh
+  801450:	74 15                	je     801467 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801452:	89 c2                	mov    %eax,%edx
+  801454:	c1 ea 08             	shr    $0x8,%edx
+  801457:	83 e2 0f             	and    $0xf,%edx
+  80145a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80145f:	83 fa 06             	cmp    $0x6,%edx
+  801462:	74 0e                	je     801472 <sys_env_set_status+0x7a>
+  801464:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801467:	0f b6 c9             	movzbl %cl,%ecx
+  80146a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801470:	eb 98                	jmp    80140a <sys_env_set_status+0x12>
+  801472:	89 c2                	mov    %eax,%edx
+  801474:	c1 ea 04             	shr    $0x4,%edx
+  801477:	83 e2 0f             	and    $0xf,%edx
+  80147a:	83 fa 02             	cmp    $0x2,%edx
+  80147d:	77 e5                	ja     801464 <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  80147f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801482:	83 f8 02             	cmp    $0x2,%eax
+  801485:	0f 97 c1             	seta   %cl
+  801488:	0f b6 c9             	movzbl %cl,%ecx
+  80148b:	eb d7                	jmp    801464 <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  80148d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801492:	b8 08 00 00 00       	mov    $0x8,%eax
+  801497:	8b 55 08             	mov    0x8(%ebp),%edx
+  80149a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80149d:	89 df                	mov    %ebx,%edi
+  80149f:	89 de                	mov    %ebx,%esi
+  8014a1:	cd 30                	int    $0x30
+  8014a3:	eb 90                	jmp    801435 <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014a5:	83 ec 0c             	sub    $0xc,%esp
+  8014a8:	50                   	push   %eax
+  8014a9:	6a 08                	push   $0x8
+  8014ab:	68 b9 2c 80 00       	push   $0x802cb9
+  8014b0:	6a 4a                	push   $0x4a
+  8014b2:	68 d6 2c 80 00       	push   $0x802cd6
+  8014b7:	e8 54 ec ff ff       	call   800110 <_panic>
+
+008014bc <sys_sysinfo>:
+{
+  8014bc:	55                   	push   %ebp
+  8014bd:	89 e5                	mov    %esp,%ebp
+  8014bf:	57                   	push   %edi
+  8014c0:	56                   	push   %esi
+  8014c1:	53                   	push   %ebx
+  8014c2:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8014c5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8014cc:	78 36                	js     801504 <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  8014ce:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8014d5:	74 79                	je     801550 <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  8014d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014df:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8014e4:	89 cb                	mov    %ecx,%ebx
+  8014e6:	89 cf                	mov    %ecx,%edi
+  8014e8:	89 ce                	mov    %ecx,%esi
+  8014ea:	55                   	push   %ebp
+  8014eb:	68 f4 14 80 00       	push   $0x8014f4
+  8014f0:	89 e5                	mov    %esp,%ebp
+  8014f2:	0f 34                	sysenter
+  8014f4:	83 c4 04             	add    $0x4,%esp
+  8014f7:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8014f8:	85 c0                	test   %eax,%eax
+  8014fa:	7f 6b                	jg     801567 <sys_sysinfo+0xab>
+}
+  8014fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ff:	5b                   	pop    %ebx
+  801500:	5e                   	pop    %esi
+  801501:	5f                   	pop    %edi
+  801502:	5d                   	pop    %ebp
+  801503:	c3                   	ret
+  801504:	b8 01 00 00 00       	mov    $0x1,%eax
+  801509:	0f a2                	cpuid
+		return 0;
+  80150b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801510:	f6 c6 08             	test   $0x8,%dh
+  801513:	74 15                	je     80152a <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801515:	89 c2                	mov    %eax,%edx
+  801517:	c1 ea 08             	shr    $0x8,%edx
+  80151a:	83 e2 0f             	and    $0xf,%edx
+  80151d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801522:	83 fa 06             	cmp    $0x6,%edx
+  801525:	74 0e                	je     801535 <sys_sysinfo+0x79>
+  801527:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80152a:	0f b6 c9             	movzbl %cl,%ecx
+  80152d:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801533:	eb 99                	jmp    8014ce <sys_sysinfo+0x12>
+  801535:	89 c2                	mov    %eax,%edx
+  801537:	c1 ea 04             	shr    $0x4,%edx
+  80153a:	83 e2 0f             	and    $0xf,%edx
+  80153d:	83 fa 02             	cmp    $0x2,%edx
+  801540:	77 e5                	ja     801527 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  801542:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801545:	83 f8 02             	cmp    $0x2,%eax
+  801548:	0f 97 c1             	seta   %cl
+  80154b:	0f b6 c9             	movzbl %cl,%ecx
+  80154e:	eb d7                	jmp    801527 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  801550:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801555:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80155a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80155d:	89 cb                	mov    %ecx,%ebx
+  80155f:	89 cf                	mov    %ecx,%edi
+  801561:	89 ce                	mov    %ecx,%esi
+  801563:	cd 30                	int    $0x30
+  801565:	eb 91                	jmp    8014f8 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801567:	83 ec 0c             	sub    $0xc,%esp
+  80156a:	50                   	push   %eax
+  80156b:	6a 0b                	push   $0xb
+  80156d:	68 b9 2c 80 00       	push   $0x802cb9
+  801572:	6a 4a                	push   $0x4a
+  801574:	68 d6 2c 80 00       	push   $0x802cd6
+  801579:	e8 92 eb ff ff       	call   800110 <_panic>
+
+0080157e <sys_env_set_trapframe>:
+{
+  80157e:	55                   	push   %ebp
+  80157f:	89 e5                	mov    %esp,%ebp
+  801581:	57                   	push   %edi
+  801582:	56                   	push   %esi
+  801583:	53                   	push   %ebx
+  801584:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801587:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80158e:	78 37                	js     8015c7 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  801590:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801597:	74 7a                	je     801613 <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  801599:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80159e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015a4:	b8 13 00 00 00       	mov    $0x13,%eax
+  8015a9:	89 df                	mov    %ebx,%edi
+  8015ab:	89 de                	mov    %ebx,%esi
+  8015ad:	55                   	push   %ebp
+  8015ae:	68 b7 15 80 00       	push   $0x8015b7
+  8015b3:	89 e5                	mov    %esp,%ebp
+  8015b5:	0f 34                	sysenter
+  8015b7:	83 c4 04             	add    $0x4,%esp
+  8015ba:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8015bb:	85 c0                	test   %eax,%eax
+  8015bd:	7f 6c                	jg     80162b <sys_env_set_trapframe+0xad>
+}
+  8015bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015c2:	5b                   	pop    %ebx
+  8015c3:	5e                   	pop    %esi
+  8015c4:	5f                   	pop    %edi
+  8015c5:	5d                   	pop    %ebp
+  8015c6:	c3                   	ret
+  8015c7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015cc:	0f a2                	cpuid
+		return 0;
+  8015ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8015d3:	f6 c6 08             	test   $0x8,%dh
+  8015d6:	74 15                	je     8015ed <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015d8:	89 c2                	mov    %eax,%edx
+  8015da:	c1 ea 08             	shr    $0x8,%edx
+  8015dd:	83 e2 0f             	and    $0xf,%edx
+  8015e0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8015e5:	83 fa 06             	cmp    $0x6,%edx
+  8015e8:	74 0e                	je     8015f8 <sys_env_set_trapframe+0x7a>
+  8015ea:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8015ed:	0f b6 c9             	movzbl %cl,%ecx
+  8015f0:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8015f6:	eb 98                	jmp    801590 <sys_env_set_trapframe+0x12>
+  8015f8:	89 c2                	mov    %eax,%edx
+  8015fa:	c1 ea 04             	shr    $0x4,%edx
+  8015fd:	83 e2 0f             	and    $0xf,%edx
+  801600:	83 fa 02             	cmp    $0x2,%edx
+  801603:	77 e5                	ja     8015ea <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  801605:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801608:	83 f8 02             	cmp    $0x2,%eax
+  80160b:	0f 97 c1             	seta   %cl
+  80160e:	0f b6 c9             	movzbl %cl,%ecx
+  801611:	eb d7                	jmp    8015ea <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  801613:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801618:	b8 13 00 00 00       	mov    $0x13,%eax
+  80161d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801620:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801623:	89 df                	mov    %ebx,%edi
+  801625:	89 de                	mov    %ebx,%esi
+  801627:	cd 30                	int    $0x30
+  801629:	eb 90                	jmp    8015bb <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80162b:	83 ec 0c             	sub    $0xc,%esp
+  80162e:	50                   	push   %eax
+  80162f:	6a 13                	push   $0x13
+  801631:	68 b9 2c 80 00       	push   $0x802cb9
+  801636:	6a 4a                	push   $0x4a
+  801638:	68 d6 2c 80 00       	push   $0x802cd6
+  80163d:	e8 ce ea ff ff       	call   800110 <_panic>
+
+00801642 <sys_env_set_stack_limit>:
+{
+  801642:	55                   	push   %ebp
+  801643:	89 e5                	mov    %esp,%ebp
+  801645:	57                   	push   %edi
+  801646:	56                   	push   %esi
+  801647:	53                   	push   %ebx
+  801648:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80164b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801652:	78 37                	js     80168b <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  801654:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80165b:	74 7a                	je     8016d7 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  80165d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801662:	8b 55 08             	mov    0x8(%ebp),%edx
+  801665:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801668:	b8 19 00 00 00       	mov    $0x19,%eax
+  80166d:	89 df                	mov    %ebx,%edi
+  80166f:	89 de                	mov    %ebx,%esi
+  801671:	55                   	push   %ebp
+  801672:	68 7b 16 80 00       	push   $0x80167b
+  801677:	89 e5                	mov    %esp,%ebp
+  801679:	0f 34                	sysenter
+  80167b:	83 c4 04             	add    $0x4,%esp
+  80167e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80167f:	85 c0                	test   %eax,%eax
+  801681:	7f 6c                	jg     8016ef <sys_env_set_stack_limit+0xad>
+}
+  801683:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801686:	5b                   	pop    %ebx
+  801687:	5e                   	pop    %esi
+  801688:	5f                   	pop    %edi
+  801689:	5d                   	pop    %ebp
+  80168a:	c3                   	ret
+  80168b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801690:	0f a2                	cpuid
+		return 0;
+  801692:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801697:	f6 c6 08             	test   $0x8,%dh
+  80169a:	74 15                	je     8016b1 <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80169c:	89 c2                	mov    %eax,%edx
+  80169e:	c1 ea 08             	shr    $0x8,%edx
+  8016a1:	83 e2 0f             	and    $0xf,%edx
+  8016a4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8016a9:	83 fa 06             	cmp    $0x6,%edx
+  8016ac:	74 0e                	je     8016bc <sys_env_set_stack_limit+0x7a>
+  8016ae:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8016b1:	0f b6 c9             	movzbl %cl,%ecx
+  8016b4:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8016ba:	eb 98                	jmp    801654 <sys_env_set_stack_limit+0x12>
+  8016bc:	89 c2                	mov    %eax,%edx
+  8016be:	c1 ea 04             	shr    $0x4,%edx
+  8016c1:	83 e2 0f             	and    $0xf,%edx
+  8016c4:	83 fa 02             	cmp    $0x2,%edx
+  8016c7:	77 e5                	ja     8016ae <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  8016c9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016cc:	83 f8 02             	cmp    $0x2,%eax
+  8016cf:	0f 97 c1             	seta   %cl
+  8016d2:	0f b6 c9             	movzbl %cl,%ecx
+  8016d5:	eb d7                	jmp    8016ae <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  8016d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016dc:	b8 19 00 00 00       	mov    $0x19,%eax
+  8016e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016e7:	89 df                	mov    %ebx,%edi
+  8016e9:	89 de                	mov    %ebx,%esi
+  8016eb:	cd 30                	int    $0x30
+  8016ed:	eb 90                	jmp    80167f <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016ef:	83 ec 0c             	sub    $0xc,%esp
+  8016f2:	50                   	push   %eax
+  8016f3:	6a 19                	push   $0x19
+  8016f5:	68 b9 2c 80 00       	push   $0x802cb9
+  8016fa:	6a 4a                	push   $0x4a
+  8016fc:	68 d6 2c 80 00       	push   $0x802cd6
+  801701:	e8 0a ea ff ff       	call   800110 <_panic>
+
+00801706 <sys_env_set_pgfault_upcall>:
+{
+  801706:	55                   	push   %ebp
+  801707:	89 e5                	mov    %esp,%ebp
+  801709:	57                   	push   %edi
+  80170a:	56                   	push   %esi
+  80170b:	53                   	push   %ebx
+  80170c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80170f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801716:	78 37                	js     80174f <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  801718:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80171f:	74 7a                	je     80179b <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  801721:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801726:	8b 55 08             	mov    0x8(%ebp),%edx
+  801729:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80172c:	b8 09 00 00 00       	mov    $0x9,%eax
+  801731:	89 df                	mov    %ebx,%edi
+  801733:	89 de                	mov    %ebx,%esi
+  801735:	55                   	push   %ebp
+  801736:	68 3f 17 80 00       	push   $0x80173f
+  80173b:	89 e5                	mov    %esp,%ebp
+  80173d:	0f 34                	sysenter
+  80173f:	83 c4 04             	add    $0x4,%esp
+  801742:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801743:	85 c0                	test   %eax,%eax
+  801745:	7f 6c                	jg     8017b3 <sys_env_set_pgfault_upcall+0xad>
+}
+  801747:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80174a:	5b                   	pop    %ebx
+  80174b:	5e                   	pop    %esi
+  80174c:	5f                   	pop    %edi
+  80174d:	5d                   	pop    %ebp
+  80174e:	c3                   	ret
+  80174f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801754:	0f a2                	cpuid
+		return 0;
+  801756:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80175b:	f6 c6 08             	test   $0x8,%dh
+  80175e:	74 15                	je     801775 <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801760:	89 c2                	mov    %eax,%edx
+  801762:	c1 ea 08             	shr    $0x8,%edx
+  801765:	83 e2 0f             	and    $0xf,%edx
+  801768:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80176d:	83 fa 06             	cmp    $0x6,%edx
+  801770:	74 0e                	je     801780 <sys_env_set_pgfault_upcall+0x7a>
+  801772:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801775:	0f b6 c9             	movzbl %cl,%ecx
+  801778:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80177e:	eb 98                	jmp    801718 <sys_env_set_pgfault_upcall+0x12>
+  801780:	89 c2                	mov    %eax,%edx
+  801782:	c1 ea 04             	shr    $0x4,%edx
+  801785:	83 e2 0f             	and    $0xf,%edx
+  801788:	83 fa 02             	cmp    $0x2,%edx
+  80178b:	77 e5                	ja     801772 <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  80178d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801790:	83 f8 02             	cmp    $0x2,%eax
+  801793:	0f 97 c1             	seta   %cl
+  801796:	0f b6 c9             	movzbl %cl,%ecx
+  801799:	eb d7                	jmp    801772 <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  80179b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017a0:	b8 09 00 00 00       	mov    $0x9,%eax
+  8017a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017ab:	89 df                	mov    %ebx,%edi
+  8017ad:	89 de                	mov    %ebx,%esi
+  8017af:	cd 30                	int    $0x30
+  8017b1:	eb 90                	jmp    801743 <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017b3:	83 ec 0c             	sub    $0xc,%esp
+  8017b6:	50                   	push   %eax
+  8017b7:	6a 09                	push   $0x9
+  8017b9:	68 b9 2c 80 00       	push   $0x802cb9
+  8017be:	6a 4a                	push   $0x4a
+  8017c0:	68 d6 2c 80 00       	push   $0x802cd6
+  8017c5:	e8 46 e9 ff ff       	call   800110 <_panic>
+
+008017ca <sys_ipc_try_send>:
+{
+  8017ca:	55                   	push   %ebp
+  8017cb:	89 e5                	mov    %esp,%ebp
+  8017cd:	57                   	push   %edi
+  8017ce:	56                   	push   %esi
+  8017cf:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8017d0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8017d7:	78 32                	js     80180b <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  8017d9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8017e0:	74 75                	je     801857 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  8017e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017e8:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8017ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8017f2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017f5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8017f8:	55                   	push   %ebp
+  8017f9:	68 02 18 80 00       	push   $0x801802
+  8017fe:	89 e5                	mov    %esp,%ebp
+  801800:	0f 34                	sysenter
+  801802:	83 c4 04             	add    $0x4,%esp
+  801805:	5d                   	pop    %ebp
+}
+  801806:	5b                   	pop    %ebx
+  801807:	5e                   	pop    %esi
+  801808:	5f                   	pop    %edi
+  801809:	5d                   	pop    %ebp
+  80180a:	c3                   	ret
+  80180b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801810:	0f a2                	cpuid
+		return 0;
+  801812:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801817:	f6 c6 08             	test   $0x8,%dh
+  80181a:	74 15                	je     801831 <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80181c:	89 c2                	mov    %eax,%edx
+  80181e:	c1 ea 08             	shr    $0x8,%edx
+  801821:	83 e2 0f             	and    $0xf,%edx
+  801824:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801829:	83 fa 06             	cmp    $0x6,%edx
+  80182c:	74 0e                	je     80183c <sys_ipc_try_send+0x72>
+  80182e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801831:	0f b6 c9             	movzbl %cl,%ecx
+  801834:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80183a:	eb 9d                	jmp    8017d9 <sys_ipc_try_send+0xf>
+  80183c:	89 c2                	mov    %eax,%edx
+  80183e:	c1 ea 04             	shr    $0x4,%edx
+  801841:	83 e2 0f             	and    $0xf,%edx
+  801844:	83 fa 02             	cmp    $0x2,%edx
+  801847:	77 e5                	ja     80182e <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  801849:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80184c:	83 f8 02             	cmp    $0x2,%eax
+  80184f:	0f 97 c1             	seta   %cl
+  801852:	0f b6 c9             	movzbl %cl,%ecx
+  801855:	eb d7                	jmp    80182e <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  801857:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80185c:	be 00 00 00 00       	mov    $0x0,%esi
+  801861:	8b 55 08             	mov    0x8(%ebp),%edx
+  801864:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801867:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80186a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80186d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  80186f:	eb 95                	jmp    801806 <sys_ipc_try_send+0x3c>
+
+00801871 <sys_ipc_send>:
+{
+  801871:	55                   	push   %ebp
+  801872:	89 e5                	mov    %esp,%ebp
+  801874:	57                   	push   %edi
+  801875:	56                   	push   %esi
+  801876:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801877:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80187e:	78 32                	js     8018b2 <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  801880:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801887:	74 75                	je     8018fe <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801889:	8b 55 08             	mov    0x8(%ebp),%edx
+  80188c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80188f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801894:	be 00 00 00 00       	mov    $0x0,%esi
+  801899:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80189c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80189f:	55                   	push   %ebp
+  8018a0:	68 a9 18 80 00       	push   $0x8018a9
+  8018a5:	89 e5                	mov    %esp,%ebp
+  8018a7:	0f 34                	sysenter
+  8018a9:	83 c4 04             	add    $0x4,%esp
+  8018ac:	5d                   	pop    %ebp
+}
+  8018ad:	5b                   	pop    %ebx
+  8018ae:	5e                   	pop    %esi
+  8018af:	5f                   	pop    %edi
+  8018b0:	5d                   	pop    %ebp
+  8018b1:	c3                   	ret
+  8018b2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018b7:	0f a2                	cpuid
+		return 0;
+  8018b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018be:	f6 c6 08             	test   $0x8,%dh
+  8018c1:	74 15                	je     8018d8 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018c3:	89 c2                	mov    %eax,%edx
+  8018c5:	c1 ea 08             	shr    $0x8,%edx
+  8018c8:	83 e2 0f             	and    $0xf,%edx
+  8018cb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018d0:	83 fa 06             	cmp    $0x6,%edx
+  8018d3:	74 0e                	je     8018e3 <sys_ipc_send+0x72>
+  8018d5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8018d8:	0f b6 c9             	movzbl %cl,%ecx
+  8018db:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8018e1:	eb 9d                	jmp    801880 <sys_ipc_send+0xf>
+  8018e3:	89 c2                	mov    %eax,%edx
+  8018e5:	c1 ea 04             	shr    $0x4,%edx
+  8018e8:	83 e2 0f             	and    $0xf,%edx
+  8018eb:	83 fa 02             	cmp    $0x2,%edx
+  8018ee:	77 e5                	ja     8018d5 <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  8018f0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018f3:	83 f8 02             	cmp    $0x2,%eax
+  8018f6:	0f 97 c1             	seta   %cl
+  8018f9:	0f b6 c9             	movzbl %cl,%ecx
+  8018fc:	eb d7                	jmp    8018d5 <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  8018fe:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801903:	be 00 00 00 00       	mov    $0x0,%esi
+  801908:	8b 55 08             	mov    0x8(%ebp),%edx
+  80190b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80190e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801911:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801914:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801916:	eb 95                	jmp    8018ad <sys_ipc_send+0x3c>
+
+00801918 <sys_ipc_recv>:
+{
+  801918:	55                   	push   %ebp
+  801919:	89 e5                	mov    %esp,%ebp
+  80191b:	57                   	push   %edi
+  80191c:	56                   	push   %esi
+  80191d:	53                   	push   %ebx
+  80191e:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801921:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801928:	78 36                	js     801960 <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  80192a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801931:	74 79                	je     8019ac <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  801933:	8b 55 08             	mov    0x8(%ebp),%edx
+  801936:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80193b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801940:	89 cb                	mov    %ecx,%ebx
+  801942:	89 cf                	mov    %ecx,%edi
+  801944:	89 ce                	mov    %ecx,%esi
+  801946:	55                   	push   %ebp
+  801947:	68 50 19 80 00       	push   $0x801950
+  80194c:	89 e5                	mov    %esp,%ebp
+  80194e:	0f 34                	sysenter
+  801950:	83 c4 04             	add    $0x4,%esp
+  801953:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801954:	85 c0                	test   %eax,%eax
+  801956:	7f 6b                	jg     8019c3 <sys_ipc_recv+0xab>
+}
+  801958:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80195b:	5b                   	pop    %ebx
+  80195c:	5e                   	pop    %esi
+  80195d:	5f                   	pop    %edi
+  80195e:	5d                   	pop    %ebp
+  80195f:	c3                   	ret
+  801960:	b8 01 00 00 00       	mov    $0x1,%eax
+  801965:	0f a2                	cpuid
+		return 0;
+  801967:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80196c:	f6 c6 08             	test   $0x8,%dh
+  80196f:	74 15                	je     801986 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801971:	89 c2                	mov    %eax,%edx
+  801973:	c1 ea 08             	shr    $0x8,%edx
+  801976:	83 e2 0f             	and    $0xf,%edx
+  801979:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80197e:	83 fa 06             	cmp    $0x6,%edx
+  801981:	74 0e                	je     801991 <sys_ipc_recv+0x79>
+  801983:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801986:	0f b6 c9             	movzbl %cl,%ecx
+  801989:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80198f:	eb 99                	jmp    80192a <sys_ipc_recv+0x12>
+  801991:	89 c2                	mov    %eax,%edx
+  801993:	c1 ea 04             	shr    $0x4,%edx
+  801996:	83 e2 0f             	and    $0xf,%edx
+  801999:	83 fa 02             	cmp    $0x2,%edx
+  80199c:	77 e5                	ja     801983 <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  80199e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019a1:	83 f8 02             	cmp    $0x2,%eax
+  8019a4:	0f 97 c1             	seta   %cl
+  8019a7:	0f b6 c9             	movzbl %cl,%ecx
+  8019aa:	eb d7                	jmp    801983 <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  8019ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019b1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8019b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019b9:	89 cb                	mov    %ecx,%ebx
+  8019bb:	89 cf                	mov    %ecx,%edi
+  8019bd:	89 ce                	mov    %ecx,%esi
+  8019bf:	cd 30                	int    $0x30
+  8019c1:	eb 91                	jmp    801954 <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8019c3:	83 ec 0c             	sub    $0xc,%esp
+  8019c6:	50                   	push   %eax
+  8019c7:	6a 0d                	push   $0xd
+  8019c9:	68 b9 2c 80 00       	push   $0x802cb9
+  8019ce:	6a 4a                	push   $0x4a
+  8019d0:	68 d6 2c 80 00       	push   $0x802cd6
+  8019d5:	e8 36 e7 ff ff       	call   800110 <_panic>
+
+008019da <sys_ipc_send_range>:
+{
+  8019da:	55                   	push   %ebp
+  8019db:	89 e5                	mov    %esp,%ebp
+  8019dd:	57                   	push   %edi
+  8019de:	56                   	push   %esi
+  8019df:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8019e0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8019e7:	78 30                	js     801a19 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  8019e9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8019f0:	74 73                	je     801a65 <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  8019f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019f8:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8019fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a00:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a03:	8b 75 18             	mov    0x18(%ebp),%esi
+  801a06:	55                   	push   %ebp
+  801a07:	68 10 1a 80 00       	push   $0x801a10
+  801a0c:	89 e5                	mov    %esp,%ebp
+  801a0e:	0f 34                	sysenter
+  801a10:	83 c4 04             	add    $0x4,%esp
+  801a13:	5d                   	pop    %ebp
+}
+  801a14:	5b                   	pop    %ebx
+  801a15:	5e                   	pop    %esi
+  801a16:	5f                   	pop    %edi
+  801a17:	5d                   	pop    %ebp
+  801a18:	c3                   	ret
+  801a19:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a1e:	0f a2                	cpuid
+		return 0;
+  801a20:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801a25:	f6 c6 08             	test   $0x8,%dh
+  801a28:	74 15                	je     801a3f <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a2a:	89 c2                	mov    %eax,%edx
+  801a2c:	c1 ea 08             	shr    $0x8,%edx
+  801a2f:	83 e2 0f             	and    $0xf,%edx
+  801a32:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a37:	83 fa 06             	cmp    $0x6,%edx
+  801a3a:	74 0e                	je     801a4a <sys_ipc_send_range+0x70>
+  801a3c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a3f:	0f b6 c9             	movzbl %cl,%ecx
+  801a42:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801a48:	eb 9f                	jmp    8019e9 <sys_ipc_send_range+0xf>
+  801a4a:	89 c2                	mov    %eax,%edx
+  801a4c:	c1 ea 04             	shr    $0x4,%edx
+  801a4f:	83 e2 0f             	and    $0xf,%edx
+  801a52:	83 fa 02             	cmp    $0x2,%edx
+  801a55:	77 e5                	ja     801a3c <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  801a57:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a5a:	83 f8 02             	cmp    $0x2,%eax
+  801a5d:	0f 97 c1             	seta   %cl
+  801a60:	0f b6 c9             	movzbl %cl,%ecx
+  801a63:	eb d7                	jmp    801a3c <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  801a65:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801a6a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a6d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a70:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a73:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a76:	8b 75 18             	mov    0x18(%ebp),%esi
+  801a79:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  801a7b:	eb 97                	jmp    801a14 <sys_ipc_send_range+0x3a>
+
+00801a7d <sys_ipc_recv_range>:
+{
+  801a7d:	55                   	push   %ebp
+  801a7e:	89 e5                	mov    %esp,%ebp
+  801a80:	57                   	push   %edi
+  801a81:	56                   	push   %esi
+  801a82:	53                   	push   %ebx
+  801a83:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801a86:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801a8d:	78 37                	js     801ac6 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  801a8f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801a96:	74 7a                	je     801b12 <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  801a98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aa0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801aa3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801aa8:	89 df                	mov    %ebx,%edi
+  801aaa:	89 de                	mov    %ebx,%esi
+  801aac:	55                   	push   %ebp
+  801aad:	68 b6 1a 80 00       	push   $0x801ab6
+  801ab2:	89 e5                	mov    %esp,%ebp
+  801ab4:	0f 34                	sysenter
+  801ab6:	83 c4 04             	add    $0x4,%esp
+  801ab9:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801aba:	85 c0                	test   %eax,%eax
+  801abc:	7f 6c                	jg     801b2a <sys_ipc_recv_range+0xad>
+}
+  801abe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ac1:	5b                   	pop    %ebx
+  801ac2:	5e                   	pop    %esi
+  801ac3:	5f                   	pop    %edi
+  801ac4:	5d                   	pop    %ebp
+  801ac5:	c3                   	ret
+  801ac6:	b8 01 00 00 00       	mov    $0x1,%eax
+  801acb:	0f a2                	cpuid
+		return 0;
+  801acd:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801ad2:	f6 c6 08             	test   $0x8,%dh
+  801ad5:	74 15                	je     801aec <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ad7:	89 c2                	mov    %eax,%edx
+  801ad9:	c1 ea 08             	shr    $0x8,%edx
+  801adc:	83 e2 0f             	and    $0xf,%edx
+  801adf:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ae4:	83 fa 06             	cmp    $0x6,%edx
+  801ae7:	74 0e                	je     801af7 <sys_ipc_recv_range+0x7a>
+  801ae9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801aec:	0f b6 c9             	movzbl %cl,%ecx
+  801aef:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801af5:	eb 98                	jmp    801a8f <sys_ipc_recv_range+0x12>
+  801af7:	89 c2                	mov    %eax,%edx
+  801af9:	c1 ea 04             	shr    $0x4,%edx
+  801afc:	83 e2 0f             	and    $0xf,%edx
+  801aff:	83 fa 02             	cmp    $0x2,%edx
+  801b02:	77 e5                	ja     801ae9 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801b04:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b07:	83 f8 02             	cmp    $0x2,%eax
+  801b0a:	0f 97 c1             	seta   %cl
+  801b0d:	0f b6 c9             	movzbl %cl,%ecx
+  801b10:	eb d7                	jmp    801ae9 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801b12:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b17:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801b1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b1f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b22:	89 df                	mov    %ebx,%edi
+  801b24:	89 de                	mov    %ebx,%esi
+  801b26:	cd 30                	int    $0x30
+  801b28:	eb 90                	jmp    801aba <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801b2a:	83 ec 0c             	sub    $0xc,%esp
+  801b2d:	50                   	push   %eax
+  801b2e:	6a 1f                	push   $0x1f
+  801b30:	68 b9 2c 80 00       	push   $0x802cb9
+  801b35:	6a 4a                	push   $0x4a
+  801b37:	68 d6 2c 80 00       	push   $0x802cd6
+  801b3c:	e8 cf e5 ff ff       	call   800110 <_panic>
+
+00801b41 <sys_ipc_call>:
+{
+  801b41:	55                   	push   %ebp
+  801b42:	89 e5                	mov    %esp,%ebp
+  801b44:	57                   	push   %edi
+  801b45:	56                   	push   %esi
+  801b46:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801b47:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b4a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801b4f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b52:	55                   	push   %ebp
+  801b53:	56                   	push   %esi
+  801b54:	8b 0e                	mov    (%esi),%ecx
+  801b56:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801b59:	8b 7e 08             	mov    0x8(%esi),%edi
+  801b5c:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801b5f:	8b 76 0c             	mov    0xc(%esi),%esi
+  801b62:	cd 30                	int    $0x30
+  801b64:	87 34 24             	xchg   %esi,(%esp)
+  801b67:	89 0e                	mov    %ecx,(%esi)
+  801b69:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801b6c:	89 7e 08             	mov    %edi,0x8(%esi)
+  801b6f:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801b72:	8f 46 0c             	pop    0xc(%esi)
+  801b75:	5d                   	pop    %ebp
+}
+  801b76:	5b                   	pop    %ebx
+  801b77:	5e                   	pop    %esi
+  801b78:	5f                   	pop    %edi
+  801b79:	5d                   	pop    %ebp
+  801b7a:	c3                   	ret
+
+00801b7b <sys_ipc_reply_wait>:
+{
+  801b7b:	55                   	push   %ebp
+  801b7c:	89 e5                	mov    %esp,%ebp
+  801b7e:	57                   	push   %edi
+  801b7f:	56                   	push   %esi
+  801b80:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801b81:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b84:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801b89:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b8c:	55                   	push   %ebp
+  801b8d:	56                   	push   %esi
+  801b8e:	8b 0e                	mov    (%esi),%ecx
+  801b90:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801b93:	8b 7e 08             	mov    0x8(%esi),%edi
+  801b96:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801b99:	8b 76 0c             	mov    0xc(%esi),%esi
+  801b9c:	cd 30                	int    $0x30
+  801b9e:	87 34 24             	xchg   %esi,(%esp)
+  801ba1:	89 0e                	mov    %ecx,(%esi)
+  801ba3:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801ba6:	89 7e 08             	mov    %edi,0x8(%esi)
+  801ba9:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801bac:	8f 46 0c             	pop    0xc(%esi)
+  801baf:	5d                   	pop    %ebp
+}
+  801bb0:	5b                   	pop    %ebx
+  801bb1:	5e                   	pop    %esi
+  801bb2:	5f                   	pop    %edi
+  801bb3:	5d                   	pop    %ebp
+  801bb4:	c3                   	ret
+
+00801bb5 <sys_ipc_send_msg>:
+{
+  801bb5:	55                   	push   %ebp
+  801bb6:	89 e5                	mov    %esp,%ebp
+  801bb8:	57                   	push   %edi
+  801bb9:	56                   	push   %esi
+  801bba:	53                   	push   %ebx
+  801bbb:	83 ec 20             	sub    $0x20,%esp
+  801bbe:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801bc1:	8b 10                	mov    (%eax),%edx
+  801bc3:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801bc6:	8b 50 04             	mov    0x4(%eax),%edx
+  801bc9:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801bcc:	8b 50 08             	mov    0x8(%eax),%edx
+  801bcf:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801bd2:	8b 50 0c             	mov    0xc(%eax),%edx
+  801bd5:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801bd8:	8b 40 10             	mov    0x10(%eax),%eax
+  801bdb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801bde:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801be1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801be4:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801be9:	55                   	push   %ebp
+  801bea:	56                   	push   %esi
+  801beb:	8b 0e                	mov    (%esi),%ecx
+  801bed:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801bf0:	8b 7e 08             	mov    0x8(%esi),%edi
+  801bf3:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801bf6:	8b 76 0c             	mov    0xc(%esi),%esi
+  801bf9:	cd 30                	int    $0x30
+  801bfb:	87 34 24             	xchg   %esi,(%esp)
+  801bfe:	89 0e                	mov    %ecx,(%esi)
+  801c00:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801c03:	89 7e 08             	mov    %edi,0x8(%esi)
+  801c06:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801c09:	8f 46 0c             	pop    0xc(%esi)
+  801c0c:	5d                   	pop    %ebp
+}
+  801c0d:	83 c4 20             	add    $0x20,%esp
+  801c10:	5b                   	pop    %ebx
+  801c11:	5e                   	pop    %esi
+  801c12:	5f                   	pop    %edi
+  801c13:	5d                   	pop    %ebp
+  801c14:	c3                   	ret
+
+00801c15 <sys_fork>:
+{
+  801c15:	55                   	push   %ebp
+  801c16:	89 e5                	mov    %esp,%ebp
+  801c18:	57                   	push   %edi
+  801c19:	56                   	push   %esi
+  801c1a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801c1b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801c22:	78 2e                	js     801c52 <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801c24:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801c2b:	74 71                	je     801c9e <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801c2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c32:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801c37:	89 d1                	mov    %edx,%ecx
+  801c39:	89 d3                	mov    %edx,%ebx
+  801c3b:	89 d7                	mov    %edx,%edi
+  801c3d:	89 d6                	mov    %edx,%esi
+  801c3f:	55                   	push   %ebp
+  801c40:	68 49 1c 80 00       	push   $0x801c49
+  801c45:	89 e5                	mov    %esp,%ebp
+  801c47:	0f 34                	sysenter
+  801c49:	83 c4 04             	add    $0x4,%esp
+  801c4c:	5d                   	pop    %ebp
+}
+  801c4d:	5b                   	pop    %ebx
+  801c4e:	5e                   	pop    %esi
+  801c4f:	5f                   	pop    %edi
+  801c50:	5d                   	pop    %ebp
+  801c51:	c3                   	ret
+  801c52:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c57:	0f a2                	cpuid
+		return 0;
+  801c59:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801c5e:	f6 c6 08             	test   $0x8,%dh
+  801c61:	74 15                	je     801c78 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c63:	89 c2                	mov    %eax,%edx
+  801c65:	c1 ea 08             	shr    $0x8,%edx
+  801c68:	83 e2 0f             	and    $0xf,%edx
+  801c6b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801c70:	83 fa 06             	cmp    $0x6,%edx
+  801c73:	74 0e                	je     801c83 <sys_fork+0x6e>
+  801c75:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801c78:	0f b6 c9             	movzbl %cl,%ecx
+  801c7b:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801c81:	eb a1                	jmp    801c24 <sys_fork+0xf>
+  801c83:	89 c2                	mov    %eax,%edx
+  801c85:	c1 ea 04             	shr    $0x4,%edx
+  801c88:	83 e2 0f             	and    $0xf,%edx
+  801c8b:	83 fa 02             	cmp    $0x2,%edx
+  801c8e:	77 e5                	ja     801c75 <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801c90:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c93:	83 f8 02             	cmp    $0x2,%eax
+  801c96:	0f 97 c1             	seta   %cl
+  801c99:	0f b6 c9             	movzbl %cl,%ecx
+  801c9c:	eb d7                	jmp    801c75 <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801c9e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ca3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801ca8:	89 d1                	mov    %edx,%ecx
+  801caa:	89 d3                	mov    %edx,%ebx
+  801cac:	89 d7                	mov    %edx,%edi
+  801cae:	89 d6                	mov    %edx,%esi
+  801cb0:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801cb2:	eb 99                	jmp    801c4d <sys_fork+0x38>
+
+00801cb4 <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801cb4:	55                   	push   %ebp
+  801cb5:	89 e5                	mov    %esp,%ebp
+  801cb7:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801cba:	ff 75 14             	push   0x14(%ebp)
+  801cbd:	ff 75 10             	push   0x10(%ebp)
+  801cc0:	ff 75 0c             	push   0xc(%ebp)
+  801cc3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cc8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ccb:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801cd0:	e8 81 ee ff ff       	call   800b56 <page_vec_call>
+}
+  801cd5:	c9                   	leave
+  801cd6:	c3                   	ret
+
+00801cd7 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801cd7:	55                   	push   %ebp
+  801cd8:	89 e5                	mov    %esp,%ebp
+  801cda:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801cdd:	ff 75 18             	push   0x18(%ebp)
+  801ce0:	ff 75 14             	push   0x14(%ebp)
+  801ce3:	ff 75 10             	push   0x10(%ebp)
+  801ce6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ce9:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cec:	b8 10 00 00 00       	mov    $0x10,%eax
+  801cf1:	e8 60 ee ff ff       	call   800b56 <page_vec_call>
+}
+  801cf6:	c9                   	leave
+  801cf7:	c3                   	ret
+
+00801cf8 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801cf8:	55                   	push   %ebp
+  801cf9:	89 e5                	mov    %esp,%ebp
+  801cfb:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801cfe:	ff 75 14             	push   0x14(%ebp)
+  801d01:	ff 75 10             	push   0x10(%ebp)
+  801d04:	ff 75 0c             	push   0xc(%ebp)
+  801d07:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d0c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d0f:	b8 11 00 00 00       	mov    $0x11,%eax
+  801d14:	e8 3d ee ff ff       	call   800b56 <page_vec_call>
+}
+  801d19:	c9                   	leave
+  801d1a:	c3                   	ret
+
+00801d1b <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801d1b:	55                   	push   %ebp
+  801d1c:	89 e5                	mov    %esp,%ebp
+  801d1e:	57                   	push   %edi
+  801d1f:	56                   	push   %esi
+  801d20:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801d21:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801d28:	78 32                	js     801d5c <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801d2a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801d31:	74 75                	je     801da8 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801d33:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d36:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d39:	b8 12 00 00 00       	mov    $0x12,%eax
+  801d3e:	be 00 00 00 00       	mov    $0x0,%esi
+  801d43:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d46:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801d49:	55                   	push   %ebp
+  801d4a:	68 53 1d 80 00       	push   $0x801d53
+  801d4f:	89 e5                	mov    %esp,%ebp
+  801d51:	0f 34                	sysenter
+  801d53:	83 c4 04             	add    $0x4,%esp
+  801d56:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801d57:	5b                   	pop    %ebx
+  801d58:	5e                   	pop    %esi
+  801d59:	5f                   	pop    %edi
+  801d5a:	5d                   	pop    %ebp
+  801d5b:	c3                   	ret
+  801d5c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d61:	0f a2                	cpuid
+		return 0;
+  801d63:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801d68:	f6 c6 08             	test   $0x8,%dh
+  801d6b:	74 15                	je     801d82 <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d6d:	89 c2                	mov    %eax,%edx
+  801d6f:	c1 ea 08             	shr    $0x8,%edx
+  801d72:	83 e2 0f             	and    $0xf,%edx
+  801d75:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d7a:	83 fa 06             	cmp    $0x6,%edx
+  801d7d:	74 0e                	je     801d8d <sys_vm_ranges+0x72>
+  801d7f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801d82:	0f b6 c9             	movzbl %cl,%ecx
+  801d85:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801d8b:	eb 9d                	jmp    801d2a <sys_vm_ranges+0xf>
+  801d8d:	89 c2                	mov    %eax,%edx
+  801d8f:	c1 ea 04             	shr    $0x4,%edx
+  801d92:	83 e2 0f             	and    $0xf,%edx
+  801d95:	83 fa 02             	cmp    $0x2,%edx
+  801d98:	77 e5                	ja     801d7f <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  801d9a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d9d:	83 f8 02             	cmp    $0x2,%eax
+  801da0:	0f 97 c1             	seta   %cl
+  801da3:	0f b6 c9             	movzbl %cl,%ecx
+  801da6:	eb d7                	jmp    801d7f <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801da8:	b8 12 00 00 00       	mov    $0x12,%eax
+  801dad:	be 00 00 00 00       	mov    $0x0,%esi
+  801db2:	8b 55 08             	mov    0x8(%ebp),%edx
+  801db5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801db8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801dbb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801dbe:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801dc0:	eb 95                	jmp    801d57 <sys_vm_ranges+0x3c>
+
+00801dc2 <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801dc2:	55                   	push   %ebp
+  801dc3:	89 e5                	mov    %esp,%ebp
+  801dc5:	57                   	push   %edi
+  801dc6:	56                   	push   %esi
+  801dc7:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801dc8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801dcf:	78 31                	js     801e02 <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801dd1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801dd8:	74 74                	je     801e4e <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801dda:	be 00 00 00 00       	mov    $0x0,%esi
+  801ddf:	8b 55 08             	mov    0x8(%ebp),%edx
+  801de2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801de5:	b8 14 00 00 00       	mov    $0x14,%eax
+  801dea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ded:	89 f7                	mov    %esi,%edi
+  801def:	55                   	push   %ebp
+  801df0:	68 f9 1d 80 00       	push   $0x801df9
+  801df5:	89 e5                	mov    %esp,%ebp
+  801df7:	0f 34                	sysenter
+  801df9:	83 c4 04             	add    $0x4,%esp
+  801dfc:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801dfd:	5b                   	pop    %ebx
+  801dfe:	5e                   	pop    %esi
+  801dff:	5f                   	pop    %edi
+  801e00:	5d                   	pop    %ebp
+  801e01:	c3                   	ret
+  801e02:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e07:	0f a2                	cpuid
+		return 0;
+  801e09:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801e0e:	f6 c6 08             	test   $0x8,%dh
+  801e11:	74 15                	je     801e28 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e13:	89 c2                	mov    %eax,%edx
+  801e15:	c1 ea 08             	shr    $0x8,%edx
+  801e18:	83 e2 0f             	and    $0xf,%edx
+  801e1b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e20:	83 fa 06             	cmp    $0x6,%edx
+  801e23:	74 0e                	je     801e33 <sys_spawn+0x71>
+  801e25:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801e28:	0f b6 c9             	movzbl %cl,%ecx
+  801e2b:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801e31:	eb 9e                	jmp    801dd1 <sys_spawn+0xf>
+  801e33:	89 c2                	mov    %eax,%edx
+  801e35:	c1 ea 04             	shr    $0x4,%edx
+  801e38:	83 e2 0f             	and    $0xf,%edx
+  801e3b:	83 fa 02             	cmp    $0x2,%edx
+  801e3e:	77 e5                	ja     801e25 <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  801e40:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e43:	83 f8 02             	cmp    $0x2,%eax
+  801e46:	0f 97 c1             	seta   %cl
+  801e49:	0f b6 c9             	movzbl %cl,%ecx
+  801e4c:	eb d7                	jmp    801e25 <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  801e4e:	be 00 00 00 00       	mov    $0x0,%esi
+  801e53:	b8 14 00 00 00       	mov    $0x14,%eax
+  801e58:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e5b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e5e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e61:	89 f7                	mov    %esi,%edi
+  801e63:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  801e65:	eb 96                	jmp    801dfd <sys_spawn+0x3b>
+
+00801e67 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  801e67:	55                   	push   %ebp
+  801e68:	89 e5                	mov    %esp,%ebp
+  801e6a:	57                   	push   %edi
+  801e6b:	56                   	push   %esi
+  801e6c:	53                   	push   %ebx
+  801e6d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801e70:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801e77:	78 37                	js     801eb0 <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  801e79:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801e80:	74 7a                	je     801efc <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  801e82:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e87:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e8a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e8d:	b8 15 00 00 00       	mov    $0x15,%eax
+  801e92:	89 df                	mov    %ebx,%edi
+  801e94:	89 de                	mov    %ebx,%esi
+  801e96:	55                   	push   %ebp
+  801e97:	68 a0 1e 80 00       	push   $0x801ea0
+  801e9c:	89 e5                	mov    %esp,%ebp
+  801e9e:	0f 34                	sysenter
+  801ea0:	83 c4 04             	add    $0x4,%esp
+  801ea3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801ea4:	85 c0                	test   %eax,%eax
+  801ea6:	7f 6c                	jg     801f14 <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  801ea8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801eab:	5b                   	pop    %ebx
+  801eac:	5e                   	pop    %esi
+  801ead:	5f                   	pop    %edi
+  801eae:	5d                   	pop    %ebp
+  801eaf:	c3                   	ret
+  801eb0:	b8 01 00 00 00       	mov    $0x1,%eax
+  801eb5:	0f a2                	cpuid
+		return 0;
+  801eb7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801ebc:	f6 c6 08             	test   $0x8,%dh
+  801ebf:	74 15                	je     801ed6 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ec1:	89 c2                	mov    %eax,%edx
+  801ec3:	c1 ea 08             	shr    $0x8,%edx
+  801ec6:	83 e2 0f             	and    $0xf,%edx
+  801ec9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ece:	83 fa 06             	cmp    $0x6,%edx
+  801ed1:	74 0e                	je     801ee1 <sys_shm_create+0x7a>
+  801ed3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801ed6:	0f b6 c9             	movzbl %cl,%ecx
+  801ed9:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801edf:	eb 98                	jmp    801e79 <sys_shm_create+0x12>
+  801ee1:	89 c2                	mov    %eax,%edx
+  801ee3:	c1 ea 04             	shr    $0x4,%edx
+  801ee6:	83 e2 0f             	and    $0xf,%edx
+  801ee9:	83 fa 02             	cmp    $0x2,%edx
+  801eec:	77 e5                	ja     801ed3 <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  801eee:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ef1:	83 f8 02             	cmp    $0x2,%eax
+  801ef4:	0f 97 c1             	seta   %cl
+  801ef7:	0f b6 c9             	movzbl %cl,%ecx
+  801efa:	eb d7                	jmp    801ed3 <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  801efc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f01:	b8 15 00 00 00       	mov    $0x15,%eax
+  801f06:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f09:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f0c:	89 df                	mov    %ebx,%edi
+  801f0e:	89 de                	mov    %ebx,%esi
+  801f10:	cd 30                	int    $0x30
+  801f12:	eb 90                	jmp    801ea4 <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801f14:	83 ec 0c             	sub    $0xc,%esp
+  801f17:	50                   	push   %eax
+  801f18:	6a 15                	push   $0x15
+  801f1a:	68 b9 2c 80 00       	push   $0x802cb9
+  801f1f:	6a 4a                	push   $0x4a
+  801f21:	68 d6 2c 80 00       	push   $0x802cd6
+  801f26:	e8 e5 e1 ff ff       	call   800110 <_panic>
+
+00801f2b <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  801f2b:	55                   	push   %ebp
+  801f2c:	89 e5                	mov    %esp,%ebp
+  801f2e:	57                   	push   %edi
+  801f2f:	56                   	push   %esi
+  801f30:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801f31:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801f38:	78 32                	js     801f6c <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  801f3a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801f41:	74 75                	je     801fb8 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801f43:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f46:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f49:	b8 16 00 00 00       	mov    $0x16,%eax
+  801f4e:	be 00 00 00 00       	mov    $0x0,%esi
+  801f53:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f56:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801f59:	55                   	push   %ebp
+  801f5a:	68 63 1f 80 00       	push   $0x801f63
+  801f5f:	89 e5                	mov    %esp,%ebp
+  801f61:	0f 34                	sysenter
+  801f63:	83 c4 04             	add    $0x4,%esp
+  801f66:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  801f67:	5b                   	pop    %ebx
+  801f68:	5e                   	pop    %esi
+  801f69:	5f                   	pop    %edi
+  801f6a:	5d                   	pop    %ebp
+  801f6b:	c3                   	ret
+  801f6c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f71:	0f a2                	cpuid
+		return 0;
+  801f73:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801f78:	f6 c6 08             	test   $0x8,%dh
+  801f7b:	74 15                	je     801f92 <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f7d:	89 c2                	mov    %eax,%edx
+  801f7f:	c1 ea 08             	shr    $0x8,%edx
+  801f82:	83 e2 0f             	and    $0xf,%edx
+  801f85:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f8a:	83 fa 06             	cmp    $0x6,%edx
+  801f8d:	74 0e                	je     801f9d <sys_shm_attach+0x72>
+  801f8f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801f92:	0f b6 c9             	movzbl %cl,%ecx
+  801f95:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801f9b:	eb 9d                	jmp    801f3a <sys_shm_attach+0xf>
+  801f9d:	89 c2                	mov    %eax,%edx
+  801f9f:	c1 ea 04             	shr    $0x4,%edx
+  801fa2:	83 e2 0f             	and    $0xf,%edx
+  801fa5:	83 fa 02             	cmp    $0x2,%edx
+  801fa8:	77 e5                	ja     801f8f <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  801faa:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fad:	83 f8 02             	cmp    $0x2,%eax
+  801fb0:	0f 97 c1             	seta   %cl
+  801fb3:	0f b6 c9             	movzbl %cl,%ecx
+  801fb6:	eb d7                	jmp    801f8f <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  801fb8:	b8 16 00 00 00       	mov    $0x16,%eax
+  801fbd:	be 00 00 00 00       	mov    $0x0,%esi
+  801fc2:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fc5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fc8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801fcb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801fce:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  801fd0:	eb 95                	jmp    801f67 <sys_shm_attach+0x3c>
+
+00801fd2 <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  801fd2:	55                   	push   %ebp
+  801fd3:	89 e5                	mov    %esp,%ebp
+  801fd5:	57                   	push   %edi
+  801fd6:	56                   	push   %esi
+  801fd7:	53                   	push   %ebx
+  801fd8:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801fdb:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801fe2:	78 38                	js     80201c <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  801fe4:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801feb:	74 7b                	je     802068 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  801fed:	be 00 00 00 00       	mov    $0x0,%esi
+  801ff2:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ff5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ff8:	b8 17 00 00 00       	mov    $0x17,%eax
+  801ffd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802000:	89 f7                	mov    %esi,%edi
+  802002:	55                   	push   %ebp
+  802003:	68 0c 20 80 00       	push   $0x80200c
+  802008:	89 e5                	mov    %esp,%ebp
+  80200a:	0f 34                	sysenter
+  80200c:	83 c4 04             	add    $0x4,%esp
+  80200f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802010:	85 c0                	test   %eax,%eax
+  802012:	7f 6d                	jg     802081 <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  802014:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802017:	5b                   	pop    %ebx
+  802018:	5e                   	pop    %esi
+  802019:	5f                   	pop    %edi
+  80201a:	5d                   	pop    %ebp
+  80201b:	c3                   	ret
+  80201c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802021:	0f a2                	cpuid
+		return 0;
+  802023:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802028:	f6 c6 08             	test   $0x8,%dh
+  80202b:	74 15                	je     802042 <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80202d:	89 c2                	mov    %eax,%edx
+  80202f:	c1 ea 08             	shr    $0x8,%edx
+  802032:	83 e2 0f             	and    $0xf,%edx
+  802035:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80203a:	83 fa 06             	cmp    $0x6,%edx
+  80203d:	74 0e                	je     80204d <sys_shm_detach+0x7b>
+  80203f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802042:	0f b6 c9             	movzbl %cl,%ecx
+  802045:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80204b:	eb 97                	jmp    801fe4 <sys_shm_detach+0x12>
+  80204d:	89 c2                	mov    %eax,%edx
+  80204f:	c1 ea 04             	shr    $0x4,%edx
+  802052:	83 e2 0f             	and    $0xf,%edx
+  802055:	83 fa 02             	cmp    $0x2,%edx
+  802058:	77 e5                	ja     80203f <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  80205a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80205d:	83 f8 02             	cmp    $0x2,%eax
+  802060:	0f 97 c1             	seta   %cl
+  802063:	0f b6 c9             	movzbl %cl,%ecx
+  802066:	eb d7                	jmp    80203f <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  802068:	be 00 00 00 00       	mov    $0x0,%esi
+  80206d:	b8 17 00 00 00       	mov    $0x17,%eax
+  802072:	8b 55 08             	mov    0x8(%ebp),%edx
+  802075:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802078:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80207b:	89 f7                	mov    %esi,%edi
+  80207d:	cd 30                	int    $0x30
+  80207f:	eb 8f                	jmp    802010 <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802081:	83 ec 0c             	sub    $0xc,%esp
+  802084:	50                   	push   %eax
+  802085:	6a 17                	push   $0x17
+  802087:	68 b9 2c 80 00       	push   $0x802cb9
+  80208c:	6a 4a                	push   $0x4a
+  80208e:	68 d6 2c 80 00       	push   $0x802cd6
+  802093:	e8 78 e0 ff ff       	call   800110 <_panic>
+
+00802098 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  802098:	55                   	push   %ebp
+  802099:	89 e5                	mov    %esp,%ebp
+  80209b:	57                   	push   %edi
+  80209c:	56                   	push   %esi
+  80209d:	53                   	push   %ebx
+  80209e:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8020a1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8020a8:	78 36                	js     8020e0 <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  8020aa:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8020b1:	74 79                	je     80212c <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  8020b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020bb:	b8 18 00 00 00       	mov    $0x18,%eax
+  8020c0:	89 cb                	mov    %ecx,%ebx
+  8020c2:	89 cf                	mov    %ecx,%edi
+  8020c4:	89 ce                	mov    %ecx,%esi
+  8020c6:	55                   	push   %ebp
+  8020c7:	68 d0 20 80 00       	push   $0x8020d0
+  8020cc:	89 e5                	mov    %esp,%ebp
+  8020ce:	0f 34                	sysenter
+  8020d0:	83 c4 04             	add    $0x4,%esp
+  8020d3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8020d4:	85 c0                	test   %eax,%eax
+  8020d6:	7f 6b                	jg     802143 <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  8020d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020db:	5b                   	pop    %ebx
+  8020dc:	5e                   	pop    %esi
+  8020dd:	5f                   	pop    %edi
+  8020de:	5d                   	pop    %ebp
+  8020df:	c3                   	ret
+  8020e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020e5:	0f a2                	cpuid
+		return 0;
+  8020e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8020ec:	f6 c6 08             	test   $0x8,%dh
+  8020ef:	74 15                	je     802106 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020f1:	89 c2                	mov    %eax,%edx
+  8020f3:	c1 ea 08             	shr    $0x8,%edx
+  8020f6:	83 e2 0f             	and    $0xf,%edx
+  8020f9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8020fe:	83 fa 06             	cmp    $0x6,%edx
+  802101:	74 0e                	je     802111 <sys_shm_remove+0x79>
+  802103:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802106:	0f b6 c9             	movzbl %cl,%ecx
+  802109:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80210f:	eb 99                	jmp    8020aa <sys_shm_remove+0x12>
+  802111:	89 c2                	mov    %eax,%edx
+  802113:	c1 ea 04             	shr    $0x4,%edx
+  802116:	83 e2 0f             	and    $0xf,%edx
+  802119:	83 fa 02             	cmp    $0x2,%edx
+  80211c:	77 e5                	ja     802103 <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  80211e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802121:	83 f8 02             	cmp    $0x2,%eax
+  802124:	0f 97 c1             	seta   %cl
+  802127:	0f b6 c9             	movzbl %cl,%ecx
+  80212a:	eb d7                	jmp    802103 <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  80212c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802131:	b8 18 00 00 00       	mov    $0x18,%eax
+  802136:	8b 55 08             	mov    0x8(%ebp),%edx
+  802139:	89 cb                	mov    %ecx,%ebx
+  80213b:	89 cf                	mov    %ecx,%edi
+  80213d:	89 ce                	mov    %ecx,%esi
+  80213f:	cd 30                	int    $0x30
+  802141:	eb 91                	jmp    8020d4 <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802143:	83 ec 0c             	sub    $0xc,%esp
+  802146:	50                   	push   %eax
+  802147:	6a 18                	push   $0x18
+  802149:	68 b9 2c 80 00       	push   $0x802cb9
+  80214e:	6a 4a                	push   $0x4a
+  802150:	68 d6 2c 80 00       	push   $0x802cd6
+  802155:	e8 b6 df ff ff       	call   800110 <_panic>
+
+0080215a <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  80215a:	55                   	push   %ebp
+  80215b:	89 e5                	mov    %esp,%ebp
+  80215d:	57                   	push   %edi
+  80215e:	56                   	push   %esi
+  80215f:	53                   	push   %ebx
+  802160:	83 ec 0c             	sub    $0xc,%esp
+  802163:	8b 45 10             	mov    0x10(%ebp),%eax
+  802166:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802169:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  80216c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802173:	78 32                	js     8021a7 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  802175:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80217c:	74 75                	je     8021f3 <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  80217e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802181:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802184:	b8 20 00 00 00       	mov    $0x20,%eax
+  802189:	be 00 00 00 00       	mov    $0x0,%esi
+  80218e:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802191:	55                   	push   %ebp
+  802192:	68 9b 21 80 00       	push   $0x80219b
+  802197:	89 e5                	mov    %esp,%ebp
+  802199:	0f 34                	sysenter
+  80219b:	83 c4 04             	add    $0x4,%esp
+  80219e:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  80219f:	83 c4 0c             	add    $0xc,%esp
+  8021a2:	5b                   	pop    %ebx
+  8021a3:	5e                   	pop    %esi
+  8021a4:	5f                   	pop    %edi
+  8021a5:	5d                   	pop    %ebp
+  8021a6:	c3                   	ret
+  8021a7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021ac:	0f a2                	cpuid
+		return 0;
+  8021ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8021b3:	f6 c6 08             	test   $0x8,%dh
+  8021b6:	74 15                	je     8021cd <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021b8:	89 c2                	mov    %eax,%edx
+  8021ba:	c1 ea 08             	shr    $0x8,%edx
+  8021bd:	83 e2 0f             	and    $0xf,%edx
+  8021c0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8021c5:	83 fa 06             	cmp    $0x6,%edx
+  8021c8:	74 0e                	je     8021d8 <sys_futex_wait+0x7e>
+  8021ca:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8021cd:	0f b6 c9             	movzbl %cl,%ecx
+  8021d0:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8021d6:	eb 9d                	jmp    802175 <sys_futex_wait+0x1b>
+  8021d8:	89 c2                	mov    %eax,%edx
+  8021da:	c1 ea 04             	shr    $0x4,%edx
+  8021dd:	83 e2 0f             	and    $0xf,%edx
+  8021e0:	83 fa 02             	cmp    $0x2,%edx
+  8021e3:	77 e5                	ja     8021ca <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  8021e5:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021e8:	83 f8 02             	cmp    $0x2,%eax
+  8021eb:	0f 97 c1             	seta   %cl
+  8021ee:	0f b6 c9             	movzbl %cl,%ecx
+  8021f1:	eb d7                	jmp    8021ca <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  8021f3:	b8 20 00 00 00       	mov    $0x20,%eax
+  8021f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8021fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  802200:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802203:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802206:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  802208:	eb 95                	jmp    80219f <sys_futex_wait+0x45>
+
+0080220a <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80220a:	55                   	push   %ebp
+  80220b:	89 e5                	mov    %esp,%ebp
+  80220d:	57                   	push   %edi
+  80220e:	56                   	push   %esi
+  80220f:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802210:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802217:	78 30                	js     802249 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  802219:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802220:	74 73                	je     802295 <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  802222:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802227:	8b 55 08             	mov    0x8(%ebp),%edx
+  80222a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80222d:	b8 21 00 00 00       	mov    $0x21,%eax
+  802232:	89 df                	mov    %ebx,%edi
+  802234:	89 de                	mov    %ebx,%esi
+  802236:	55                   	push   %ebp
+  802237:	68 40 22 80 00       	push   $0x802240
+  80223c:	89 e5                	mov    %esp,%ebp
+  80223e:	0f 34                	sysenter
+  802240:	83 c4 04             	add    $0x4,%esp
+  802243:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  802244:	5b                   	pop    %ebx
+  802245:	5e                   	pop    %esi
+  802246:	5f                   	pop    %edi
+  802247:	5d                   	pop    %ebp
+  802248:	c3                   	ret
+  802249:	b8 01 00 00 00       	mov    $0x1,%eax
+  80224e:	0f a2                	cpuid
+		return 0;
+  802250:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802255:	f6 c6 08             	test   $0x8,%dh
+  802258:	74 15                	je     80226f <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80225a:	89 c2                	mov    %eax,%edx
+  80225c:	c1 ea 08             	shr    $0x8,%edx
+  80225f:	83 e2 0f             	and    $0xf,%edx
+  802262:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802267:	83 fa 06             	cmp    $0x6,%edx
+  80226a:	74 0e                	je     80227a <sys_futex_wake+0x70>
+  80226c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80226f:	0f b6 c9             	movzbl %cl,%ecx
+  802272:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802278:	eb 9f                	jmp    802219 <sys_futex_wake+0xf>
+  80227a:	89 c2                	mov    %eax,%edx
+  80227c:	c1 ea 04             	shr    $0x4,%edx
+  80227f:	83 e2 0f             	and    $0xf,%edx
+  802282:	83 fa 02             	cmp    $0x2,%edx
+  802285:	77 e5                	ja     80226c <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  802287:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80228a:	83 f8 02             	cmp    $0x2,%eax
+  80228d:	0f 97 c1             	seta   %cl
+  802290:	0f b6 c9             	movzbl %cl,%ecx
+  802293:	eb d7                	jmp    80226c <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  802295:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80229a:	b8 21 00 00 00       	mov    $0x21,%eax
+  80229f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022a5:	89 df                	mov    %ebx,%edi
+  8022a7:	89 de                	mov    %ebx,%esi
+  8022a9:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  8022ab:	eb 97                	jmp    802244 <sys_futex_wake+0x3a>
+
+008022ad <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  8022ad:	55                   	push   %ebp
+  8022ae:	89 e5                	mov    %esp,%ebp
+  8022b0:	57                   	push   %edi
+  8022b1:	56                   	push   %esi
+  8022b2:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8022b3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8022ba:	78 2e                	js     8022ea <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  8022bc:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8022c3:	74 71                	je     802336 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  8022c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022ca:	b8 22 00 00 00       	mov    $0x22,%eax
+  8022cf:	89 d1                	mov    %edx,%ecx
+  8022d1:	89 d3                	mov    %edx,%ebx
+  8022d3:	89 d7                	mov    %edx,%edi
+  8022d5:	89 d6                	mov    %edx,%esi
+  8022d7:	55                   	push   %ebp
+  8022d8:	68 e1 22 80 00       	push   $0x8022e1
+  8022dd:	89 e5                	mov    %esp,%ebp
+  8022df:	0f 34                	sysenter
+  8022e1:	83 c4 04             	add    $0x4,%esp
+  8022e4:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  8022e5:	5b                   	pop    %ebx
+  8022e6:	5e                   	pop    %esi
+  8022e7:	5f                   	pop    %edi
+  8022e8:	5d                   	pop    %ebp
+  8022e9:	c3                   	ret
+  8022ea:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022ef:	0f a2                	cpuid
+		return 0;
+  8022f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8022f6:	f6 c6 08             	test   $0x8,%dh
+  8022f9:	74 15                	je     802310 <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022fb:	89 c2                	mov    %eax,%edx
+  8022fd:	c1 ea 08             	shr    $0x8,%edx
+  802300:	83 e2 0f             	and    $0xf,%edx
+  802303:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802308:	83 fa 06             	cmp    $0x6,%edx
+  80230b:	74 0e                	je     80231b <sys_ep_create+0x6e>
+  80230d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802310:	0f b6 c9             	movzbl %cl,%ecx
+  802313:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802319:	eb a1                	jmp    8022bc <sys_ep_create+0xf>
+  80231b:	89 c2                	mov    %eax,%edx
+  80231d:	c1 ea 04             	shr    $0x4,%edx
+  802320:	83 e2 0f             	and    $0xf,%edx
+  802323:	83 fa 02             	cmp    $0x2,%edx
+  802326:	77 e5                	ja     80230d <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  802328:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80232b:	83 f8 02             	cmp    $0x2,%eax
+  80232e:	0f 97 c1             	seta   %cl
+  802331:	0f b6 c9             	movzbl %cl,%ecx
+  802334:	eb d7                	jmp    80230d <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  802336:	ba 00 00 00 00       	mov    $0x0,%edx
+  80233b:	b8 22 00 00 00       	mov    $0x22,%eax
+  802340:	89 d1                	mov    %edx,%ecx
+  802342:	89 d3                	mov    %edx,%ebx
+  802344:	89 d7                	mov    %edx,%edi
+  802346:	89 d6                	mov    %edx,%esi
+  802348:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  80234a:	eb 99                	jmp    8022e5 <sys_ep_create+0x38>
+
+0080234c <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  80234c:	55                   	push   %ebp
+  80234d:	89 e5                	mov    %esp,%ebp
+  80234f:	57                   	push   %edi
+  802350:	56                   	push   %esi
+  802351:	53                   	push   %ebx
+  802352:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802355:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80235c:	78 36                	js     802394 <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  80235e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802365:	74 79                	je     8023e0 <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  802367:	8b 55 08             	mov    0x8(%ebp),%edx
+  80236a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80236f:	b8 23 00 00 00       	mov    $0x23,%eax
+  802374:	89 cb                	mov    %ecx,%ebx
+  802376:	89 cf                	mov    %ecx,%edi
+  802378:	89 ce                	mov    %ecx,%esi
+  80237a:	55                   	push   %ebp
+  80237b:	68 84 23 80 00       	push   $0x802384
+  802380:	89 e5                	mov    %esp,%ebp
+  802382:	0f 34                	sysenter
+  802384:	83 c4 04             	add    $0x4,%esp
+  802387:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802388:	85 c0                	test   %eax,%eax
+  80238a:	7f 6b                	jg     8023f7 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  80238c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80238f:	5b                   	pop    %ebx
+  802390:	5e                   	pop    %esi
+  802391:	5f                   	pop    %edi
+  802392:	5d                   	pop    %ebp
+  802393:	c3                   	ret
+  802394:	b8 01 00 00 00       	mov    $0x1,%eax
+  802399:	0f a2                	cpuid
+		return 0;
+  80239b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8023a0:	f6 c6 08             	test   $0x8,%dh
+  8023a3:	74 15                	je     8023ba <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023a5:	89 c2                	mov    %eax,%edx
+  8023a7:	c1 ea 08             	shr    $0x8,%edx
+  8023aa:	83 e2 0f             	and    $0xf,%edx
+  8023ad:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8023b2:	83 fa 06             	cmp    $0x6,%edx
+  8023b5:	74 0e                	je     8023c5 <sys_ep_destroy+0x79>
+  8023b7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8023ba:	0f b6 c9             	movzbl %cl,%ecx
+  8023bd:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8023c3:	eb 99                	jmp    80235e <sys_ep_destroy+0x12>
+  8023c5:	89 c2                	mov    %eax,%edx
+  8023c7:	c1 ea 04             	shr    $0x4,%edx
+  8023ca:	83 e2 0f             	and    $0xf,%edx
+  8023cd:	83 fa 02             	cmp    $0x2,%edx
+  8023d0:	77 e5                	ja     8023b7 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  8023d2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023d5:	83 f8 02             	cmp    $0x2,%eax
+  8023d8:	0f 97 c1             	seta   %cl
+  8023db:	0f b6 c9             	movzbl %cl,%ecx
+  8023de:	eb d7                	jmp    8023b7 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  8023e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023e5:	b8 23 00 00 00       	mov    $0x23,%eax
+  8023ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023ed:	89 cb                	mov    %ecx,%ebx
+  8023ef:	89 cf                	mov    %ecx,%edi
+  8023f1:	89 ce                	mov    %ecx,%esi
+  8023f3:	cd 30                	int    $0x30
+  8023f5:	eb 91                	jmp    802388 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8023f7:	83 ec 0c             	sub    $0xc,%esp
+  8023fa:	50                   	push   %eax
+  8023fb:	6a 23                	push   $0x23
+  8023fd:	68 b9 2c 80 00       	push   $0x802cb9
+  802402:	6a 4a                	push   $0x4a
+  802404:	68 d6 2c 80 00       	push   $0x802cd6
+  802409:	e8 02 dd ff ff       	call   800110 <_panic>
+
+0080240e <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  80240e:	55                   	push   %ebp
+  80240f:	89 e5                	mov    %esp,%ebp
+  802411:	57                   	push   %edi
+  802412:	56                   	push   %esi
+  802413:	53                   	push   %ebx
+  802414:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802417:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80241e:	78 37                	js     802457 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  802420:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802427:	74 7a                	je     8024a3 <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  802429:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80242e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802431:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802434:	b8 24 00 00 00       	mov    $0x24,%eax
+  802439:	89 df                	mov    %ebx,%edi
+  80243b:	89 de                	mov    %ebx,%esi
+  80243d:	55                   	push   %ebp
+  80243e:	68 47 24 80 00       	push   $0x802447
+  802443:	89 e5                	mov    %esp,%ebp
+  802445:	0f 34                	sysenter
+  802447:	83 c4 04             	add    $0x4,%esp
+  80244a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80244b:	85 c0                	test   %eax,%eax
+  80244d:	7f 6c                	jg     8024bb <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  80244f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802452:	5b                   	pop    %ebx
+  802453:	5e                   	pop    %esi
+  802454:	5f                   	pop    %edi
+  802455:	5d                   	pop    %ebp
+  802456:	c3                   	ret
+  802457:	b8 01 00 00 00       	mov    $0x1,%eax
+  80245c:	0f a2                	cpuid
+		return 0;
+  80245e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802463:	f6 c6 08             	test   $0x8,%dh
+  802466:	74 15                	je     80247d <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802468:	89 c2                	mov    %eax,%edx
+  80246a:	c1 ea 08             	shr    $0x8,%edx
+  80246d:	83 e2 0f             	and    $0xf,%edx
+  802470:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802475:	83 fa 06             	cmp    $0x6,%edx
+  802478:	74 0e                	je     802488 <sys_ep_grant+0x7a>
+  80247a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80247d:	0f b6 c9             	movzbl %cl,%ecx
+  802480:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802486:	eb 98                	jmp    802420 <sys_ep_grant+0x12>
+  802488:	89 c2                	mov    %eax,%edx
+  80248a:	c1 ea 04             	shr    $0x4,%edx
+  80248d:	83 e2 0f             	and    $0xf,%edx
+  802490:	83 fa 02             	cmp    $0x2,%edx
+  802493:	77 e5                	ja     80247a <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  802495:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802498:	83 f8 02             	cmp    $0x2,%eax
+  80249b:	0f 97 c1             	seta   %cl
+  80249e:	0f b6 c9             	movzbl %cl,%ecx
+  8024a1:	eb d7                	jmp    80247a <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  8024a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024a8:	b8 24 00 00 00       	mov    $0x24,%eax
+  8024ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024b3:	89 df                	mov    %ebx,%edi
+  8024b5:	89 de                	mov    %ebx,%esi
+  8024b7:	cd 30                	int    $0x30
+  8024b9:	eb 90                	jmp    80244b <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8024bb:	83 ec 0c             	sub    $0xc,%esp
+  8024be:	50                   	push   %eax
+  8024bf:	6a 24                	push   $0x24
+  8024c1:	68 b9 2c 80 00       	push   $0x802cb9
+  8024c6:	6a 4a                	push   $0x4a
+  8024c8:	68 d6 2c 80 00       	push   $0x802cd6
+  8024cd:	e8 3e dc ff ff       	call   800110 <_panic>
+
+008024d2 <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  8024d2:	55                   	push   %ebp
+  8024d3:	89 e5                	mov    %esp,%ebp
+  8024d5:	57                   	push   %edi
+  8024d6:	56                   	push   %esi
+  8024d7:	53                   	push   %ebx
+  8024d8:	83 ec 20             	sub    $0x20,%esp
+  8024db:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  8024de:	8b 10                	mov    (%eax),%edx
+  8024e0:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8024e3:	8b 50 04             	mov    0x4(%eax),%edx
+  8024e6:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8024e9:	8b 50 08             	mov    0x8(%eax),%edx
+  8024ec:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  8024ef:	8b 50 0c             	mov    0xc(%eax),%edx
+  8024f2:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  8024f5:	8b 40 10             	mov    0x10(%eax),%eax
+  8024f8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  8024fb:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  8024fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  802501:	b8 25 00 00 00       	mov    $0x25,%eax
+  802506:	55                   	push   %ebp
+  802507:	56                   	push   %esi
+  802508:	8b 0e                	mov    (%esi),%ecx
+  80250a:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80250d:	8b 7e 08             	mov    0x8(%esi),%edi
+  802510:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802513:	8b 76 0c             	mov    0xc(%esi),%esi
+  802516:	cd 30                	int    $0x30
+  802518:	87 34 24             	xchg   %esi,(%esp)
+  80251b:	89 0e                	mov    %ecx,(%esi)
+  80251d:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802520:	89 7e 08             	mov    %edi,0x8(%esi)
+  802523:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802526:	8f 46 0c             	pop    0xc(%esi)
+  802529:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  80252a:	83 c4 20             	add    $0x20,%esp
+  80252d:	5b                   	pop    %ebx
+  80252e:	5e                   	pop    %esi
+  80252f:	5f                   	pop    %edi
+  802530:	5d                   	pop    %ebp
+  802531:	c3                   	ret
+
+00802532 <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  802532:	55                   	push   %ebp
+  802533:	89 e5                	mov    %esp,%ebp
+  802535:	57                   	push   %edi
+  802536:	56                   	push   %esi
+  802537:	53                   	push   %ebx
+  802538:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  80253b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80253e:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  802540:	8b 55 08             	mov    0x8(%ebp),%edx
+  802543:	b8 26 00 00 00       	mov    $0x26,%eax
+  802548:	55                   	push   %ebp
+  802549:	56                   	push   %esi
+  80254a:	8b 0e                	mov    (%esi),%ecx
+  80254c:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80254f:	8b 7e 08             	mov    0x8(%esi),%edi
+  802552:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802555:	8b 76 0c             	mov    0xc(%esi),%esi
+  802558:	cd 30                	int    $0x30
+  80255a:	87 34 24             	xchg   %esi,(%esp)
+  80255d:	89 0e                	mov    %ecx,(%esi)
+  80255f:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802562:	89 7e 08             	mov    %edi,0x8(%esi)
+  802565:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802568:	8f 46 0c             	pop    0xc(%esi)
+  80256b:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  80256c:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  802570:	74 0f                	je     802581 <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  802572:	85 c0                	test   %eax,%eax
+  802574:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802579:	0f 48 d1             	cmovs  %ecx,%edx
+  80257c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  80257f:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  802581:	5b                   	pop    %ebx
+  802582:	5e                   	pop    %esi
+  802583:	5f                   	pop    %edi
+  802584:	5d                   	pop    %ebp
+  802585:	c3                   	ret
+
+00802586 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  802586:	55                   	push   %ebp
+  802587:	89 e5                	mov    %esp,%ebp
+  802589:	57                   	push   %edi
+  80258a:	56                   	push   %esi
+  80258b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80258c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802593:	78 2f                	js     8025c4 <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  802595:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80259c:	74 72                	je     802610 <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  80259e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025a6:	b8 27 00 00 00       	mov    $0x27,%eax
+  8025ab:	89 cb                	mov    %ecx,%ebx
+  8025ad:	89 cf                	mov    %ecx,%edi
+  8025af:	89 ce                	mov    %ecx,%esi
+  8025b1:	55                   	push   %ebp
+  8025b2:	68 bb 25 80 00       	push   $0x8025bb
+  8025b7:	89 e5                	mov    %esp,%ebp
+  8025b9:	0f 34                	sysenter
+  8025bb:	83 c4 04             	add    $0x4,%esp
+  8025be:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  8025bf:	5b                   	pop    %ebx
+  8025c0:	5e                   	pop    %esi
+  8025c1:	5f                   	pop    %edi
+  8025c2:	5d                   	pop    %ebp
+  8025c3:	c3                   	ret
+  8025c4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025c9:	0f a2                	cpuid
+		return 0;
+  8025cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8025d0:	f6 c6 08             	test   $0x8,%dh
+  8025d3:	74 15                	je     8025ea <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025d5:	89 c2                	mov    %eax,%edx
+  8025d7:	c1 ea 08             	shr    $0x8,%edx
+  8025da:	83 e2 0f             	and    $0xf,%edx
+  8025dd:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8025e2:	83 fa 06             	cmp    $0x6,%edx
+  8025e5:	74 0e                	je     8025f5 <sys_sysring_setup+0x6f>
+  8025e7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8025ea:	0f b6 c9             	movzbl %cl,%ecx
+  8025ed:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8025f3:	eb a0                	jmp    802595 <sys_sysring_setup+0xf>
+  8025f5:	89 c2                	mov    %eax,%edx
+  8025f7:	c1 ea 04             	shr    $0x4,%edx
+  8025fa:	83 e2 0f             	and    $0xf,%edx
+  8025fd:	83 fa 02             	cmp    $0x2,%edx
+  802600:	77 e5                	ja     8025e7 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  802602:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802605:	83 f8 02             	cmp    $0x2,%eax
+  802608:	0f 97 c1             	seta   %cl
+  80260b:	0f b6 c9             	movzbl %cl,%ecx
+  80260e:	eb d7                	jmp    8025e7 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  802610:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802615:	b8 27 00 00 00       	mov    $0x27,%eax
+  80261a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80261d:	89 cb                	mov    %ecx,%ebx
+  80261f:	89 cf                	mov    %ecx,%edi
+  802621:	89 ce                	mov    %ecx,%esi
+  802623:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  802625:	eb 98                	jmp    8025bf <sys_sysring_setup+0x39>
+
+00802627 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  802627:	55                   	push   %ebp
+  802628:	89 e5                	mov    %esp,%ebp
+  80262a:	57                   	push   %edi
+  80262b:	56                   	push   %esi
+  80262c:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80262d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802634:	78 2e                	js     802664 <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  802636:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80263d:	74 71                	je     8026b0 <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  80263f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802644:	b8 28 00 00 00       	mov    $0x28,%eax
+  802649:	89 d1                	mov    %edx,%ecx
+  80264b:	89 d3                	mov    %edx,%ebx
+  80264d:	89 d7                	mov    %edx,%edi
+  80264f:	89 d6                	mov    %edx,%esi
+  802651:	55                   	push   %ebp
+  802652:	68 5b 26 80 00       	push   $0x80265b
+  802657:	89 e5                	mov    %esp,%ebp
+  802659:	0f 34                	sysenter
+  80265b:	83 c4 04             	add    $0x4,%esp
+  80265e:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  80265f:	5b                   	pop    %ebx
+  802660:	5e                   	pop    %esi
+  802661:	5f                   	pop    %edi
+  802662:	5d                   	pop    %ebp
+  802663:	c3                   	ret
+  802664:	b8 01 00 00 00       	mov    $0x1,%eax
+  802669:	0f a2                	cpuid
+		return 0;
+  80266b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802670:	f6 c6 08             	test   $0x8,%dh
+  802673:	74 15                	je     80268a <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802675:	89 c2                	mov    %eax,%edx
+  802677:	c1 ea 08             	shr    $0x8,%edx
+  80267a:	83 e2 0f             	and    $0xf,%edx
+  80267d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802682:	83 fa 06             	cmp    $0x6,%edx
+  802685:	74 0e                	je     802695 <sys_sysring_enter+0x6e>
+  802687:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80268a:	0f b6 c9             	movzbl %cl,%ecx
+  80268d:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802693:	eb a1                	jmp    802636 <sys_sysring_enter+0xf>
+  802695:	89 c2                	mov    %eax,%edx
+  802697:	c1 ea 04             	shr    $0x4,%edx
+  80269a:	83 e2 0f             	and    $0xf,%edx
+  80269d:	83 fa 02             	cmp    $0x2,%edx
+  8026a0:	77 e5                	ja     802687 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  8026a2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8026a5:	83 f8 02             	cmp    $0x2,%eax
+  8026a8:	0f 97 c1             	seta   %cl
+  8026ab:	0f b6 c9             	movzbl %cl,%ecx
+  8026ae:	eb d7                	jmp    802687 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  8026b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026b5:	b8 28 00 00 00       	mov    $0x28,%eax
+  8026ba:	89 d1                	mov    %edx,%ecx
+  8026bc:	89 d3                	mov    %edx,%ebx
+  8026be:	89 d7                	mov    %edx,%edi
+  8026c0:	89 d6                	mov    %edx,%esi
+  8026c2:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  8026c4:	eb 99                	jmp    80265f <sys_sysring_enter+0x38>
+
+008026c6 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8026c6:	55                   	push   %ebp
+  8026c7:	89 e5                	mov    %esp,%ebp
+  8026c9:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8026cc:	83 3d 0c 30 80 00 00 	cmpl   $0x0,0x80300c
+  8026d3:	74 0a                	je     8026df <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8026d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026d8:	a3 0c 30 80 00       	mov    %eax,0x80300c
+}
+  8026dd:	c9                   	leave
+  8026de:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE),
+  8026df:	83 ec 04             	sub    $0x4,%esp
+  8026e2:	6a 07                	push   $0x7
+  8026e4:	68 00 f0 bf ee       	push   $0xeebff000
+  8026e9:	6a 00                	push   $0x0
+  8026eb:	e8 57 e9 ff ff       	call   801047 <sys_page_alloc>
+  8026f0:	83 c4 10             	add    $0x10,%esp
+  8026f3:	85 c0                	test   %eax,%eax
+  8026f5:	78 28                	js     80271f <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  8026f7:	83 ec 08             	sub    $0x8,%esp
+  8026fa:	68 31 27 80 00       	push   $0x802731
+  8026ff:	6a 00                	push   $0x0
+  802701:	e8 00 f0 ff ff       	call   801706 <sys_env_set_pgfault_upcall>
+  802706:	83 c4 10             	add    $0x10,%esp
+  802709:	85 c0                	test   %eax,%eax
+  80270b:	79 c8                	jns    8026d5 <set_pgfault_handler+0xf>
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+  80270d:	50                   	push   %eax
+  80270e:	68 0c 2d 80 00       	push   $0x802d0c
+  802713:	6a 24                	push   $0x24
+  802715:	68 40 2d 80 00       	push   $0x802d40
+  80271a:	e8 f1 d9 ff ff       	call   800110 <_panic>
+			panic("set_pgfault_handler: sys_page_alloc: %e", r);
+  80271f:	50                   	push   %eax
+  802720:	68 e4 2c 80 00       	push   $0x802ce4
+  802725:	6a 22                	push   $0x22
+  802727:	68 40 2d 80 00       	push   $0x802d40
+  80272c:	e8 df d9 ff ff       	call   800110 <_panic>
+
+00802731 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802731:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802732:	a1 0c 30 80 00       	mov    0x80300c,%eax
+	call *%eax
+  802737:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802739:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 0x28(%esp), %ebx		// trap-time eip
+  80273c:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl 0x30(%esp), %eax		// trap-time esp
+  802740:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  802744:	83 e8 04             	sub    $0x4,%eax
+	movl %ebx, (%eax)
+  802747:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 0x30(%esp)
+  802749:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp			// skip fault_va and err
+  80274d:	83 c4 08             	add    $0x8,%esp
+	popal
+  802750:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp			// skip eip
+  802751:	83 c4 04             	add    $0x4,%esp
+	popfl
+  802754:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802755:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802756:	c3                   	ret
+
+00802757 <dm>:
+  802757:	55                   	push   %ebp
+  802758:	57                   	push   %edi
+  802759:	56                   	push   %esi
+  80275a:	53                   	push   %ebx
+  80275b:	83 ec 24             	sub    $0x24,%esp
+  80275e:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802762:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802766:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80276a:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80276e:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802772:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802776:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  80277a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80277f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802784:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802789:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802790:	00 
+  802791:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802798:	00 
+  802799:	89 fb                	mov    %edi,%ebx
+  80279b:	eb 08                	jmp    8027a5 <dm+0x4e>
+  80279d:	83 e9 01             	sub    $0x1,%ecx
+  8027a0:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8027a3:	74 68                	je     80280d <dm+0xb6>
+  8027a5:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8027a9:	01 c0                	add    %eax,%eax
+  8027ab:	89 c6                	mov    %eax,%esi
+  8027ad:	89 d7                	mov    %edx,%edi
+  8027af:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8027b3:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8027b7:	0f ad d0             	shrd   %cl,%edx,%eax
+  8027ba:	d3 ea                	shr    %cl,%edx
+  8027bc:	f6 c1 20             	test   $0x20,%cl
+  8027bf:	74 04                	je     8027c5 <dm+0x6e>
+  8027c1:	89 d0                	mov    %edx,%eax
+  8027c3:	31 d2                	xor    %edx,%edx
+  8027c5:	83 e0 01             	and    $0x1,%eax
+  8027c8:	89 04 24             	mov    %eax,(%esp)
+  8027cb:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8027d2:	00 
+  8027d3:	8b 04 24             	mov    (%esp),%eax
+  8027d6:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8027da:	09 f0                	or     %esi,%eax
+  8027dc:	09 fa                	or     %edi,%edx
+  8027de:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8027e2:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8027e6:	39 f0                	cmp    %esi,%eax
+  8027e8:	89 d5                	mov    %edx,%ebp
+  8027ea:	19 fd                	sbb    %edi,%ebp
+  8027ec:	72 af                	jb     80279d <dm+0x46>
+  8027ee:	29 f0                	sub    %esi,%eax
+  8027f0:	19 fa                	sbb    %edi,%edx
+  8027f2:	89 cf                	mov    %ecx,%edi
+  8027f4:	c1 ef 05             	shr    $0x5,%edi
+  8027f7:	83 e7 01             	and    $0x1,%edi
+  8027fa:	89 fe                	mov    %edi,%esi
+  8027fc:	83 f6 01             	xor    $0x1,%esi
+  8027ff:	d3 e6                	shl    %cl,%esi
+  802801:	d3 e7                	shl    %cl,%edi
+  802803:	09 74 24 18          	or     %esi,0x18(%esp)
+  802807:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80280b:	eb 90                	jmp    80279d <dm+0x46>
+  80280d:	85 db                	test   %ebx,%ebx
+  80280f:	74 05                	je     802816 <dm+0xbf>
+  802811:	89 03                	mov    %eax,(%ebx)
+  802813:	89 53 04             	mov    %edx,0x4(%ebx)
+  802816:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80281a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80281e:	83 c4 24             	add    $0x24,%esp
+  802821:	5b                   	pop    %ebx
+  802822:	5e                   	pop    %esi
+  802823:	5f                   	pop    %edi
+  802824:	5d                   	pop    %ebp
+  802825:	c3                   	ret
+
+00802826 <__udivdi3>:
+  802826:	83 ec 08             	sub    $0x8,%esp
+  802829:	6a 00                	push   $0x0
+  80282b:	ff 74 24 1c          	push   0x1c(%esp)
+  80282f:	ff 74 24 1c          	push   0x1c(%esp)
+  802833:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802837:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80283b:	e8 17 ff ff ff       	call   802757 <dm>
+  802840:	83 c4 14             	add    $0x14,%esp
+  802843:	c3                   	ret
+
+00802844 <__umoddi3>:
+  802844:	83 ec 18             	sub    $0x18,%esp
+  802847:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80284b:	50                   	push   %eax
+  80284c:	ff 74 24 2c          	push   0x2c(%esp)
+  802850:	ff 74 24 2c          	push   0x2c(%esp)
+  802854:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802858:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80285c:	e8 f6 fe ff ff       	call   802757 <dm>
+  802861:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802865:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802869:	83 c4 24             	add    $0x24,%esp
+  80286c:	c3                   	ret
+
+0080286d <__divdi3>:
+  80286d:	53                   	push   %ebx
+  80286e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802872:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802876:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80287a:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80287e:	85 d2                	test   %edx,%edx
+  802880:	78 15                	js     802897 <__divdi3+0x2a>
+  802882:	85 db                	test   %ebx,%ebx
+  802884:	78 34                	js     8028ba <__divdi3+0x4d>
+  802886:	83 ec 04             	sub    $0x4,%esp
+  802889:	6a 00                	push   $0x0
+  80288b:	53                   	push   %ebx
+  80288c:	51                   	push   %ecx
+  80288d:	e8 c5 fe ff ff       	call   802757 <dm>
+  802892:	83 c4 10             	add    $0x10,%esp
+  802895:	eb 21                	jmp    8028b8 <__divdi3+0x4b>
+  802897:	f7 d8                	neg    %eax
+  802899:	83 d2 00             	adc    $0x0,%edx
+  80289c:	f7 da                	neg    %edx
+  80289e:	85 db                	test   %ebx,%ebx
+  8028a0:	78 30                	js     8028d2 <__divdi3+0x65>
+  8028a2:	83 ec 04             	sub    $0x4,%esp
+  8028a5:	6a 00                	push   $0x0
+  8028a7:	53                   	push   %ebx
+  8028a8:	51                   	push   %ecx
+  8028a9:	e8 a9 fe ff ff       	call   802757 <dm>
+  8028ae:	83 c4 10             	add    $0x10,%esp
+  8028b1:	f7 d8                	neg    %eax
+  8028b3:	83 d2 00             	adc    $0x0,%edx
+  8028b6:	f7 da                	neg    %edx
+  8028b8:	5b                   	pop    %ebx
+  8028b9:	c3                   	ret
+  8028ba:	83 ec 04             	sub    $0x4,%esp
+  8028bd:	6a 00                	push   $0x0
+  8028bf:	f7 d9                	neg    %ecx
+  8028c1:	83 d3 00             	adc    $0x0,%ebx
+  8028c4:	f7 db                	neg    %ebx
+  8028c6:	53                   	push   %ebx
+  8028c7:	51                   	push   %ecx
+  8028c8:	e8 8a fe ff ff       	call   802757 <dm>
+  8028cd:	83 c4 10             	add    $0x10,%esp
+  8028d0:	eb df                	jmp    8028b1 <__divdi3+0x44>
+  8028d2:	83 ec 04             	sub    $0x4,%esp
+  8028d5:	6a 00                	push   $0x0
+  8028d7:	f7 d9                	neg    %ecx
+  8028d9:	83 d3 00             	adc    $0x0,%ebx
+  8028dc:	f7 db                	neg    %ebx
+  8028de:	53                   	push   %ebx
+  8028df:	51                   	push   %ecx
+  8028e0:	e8 72 fe ff ff       	call   802757 <dm>
+  8028e5:	83 c4 10             	add    $0x10,%esp
+  8028e8:	eb ce                	jmp    8028b8 <__divdi3+0x4b>
+
+008028ea <__moddi3>:
+  8028ea:	55                   	push   %ebp
+  8028eb:	57                   	push   %edi
+  8028ec:	56                   	push   %esi
+  8028ed:	53                   	push   %ebx
+  8028ee:	83 ec 18             	sub    $0x18,%esp
+  8028f1:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  8028f5:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8028f9:	89 f1                	mov    %esi,%ecx
+  8028fb:	f7 d9                	neg    %ecx
+  8028fd:	89 da                	mov    %ebx,%edx
+  8028ff:	83 d2 00             	adc    $0x0,%edx
+  802902:	f7 da                	neg    %edx
+  802904:	0f 48 ce             	cmovs  %esi,%ecx
+  802907:	0f 48 d3             	cmovs  %ebx,%edx
+  80290a:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80290e:	50                   	push   %eax
+  80290f:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802913:	f7 de                	neg    %esi
+  802915:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802919:	83 d0 00             	adc    $0x0,%eax
+  80291c:	f7 d8                	neg    %eax
+  80291e:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802923:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802928:	50                   	push   %eax
+  802929:	56                   	push   %esi
+  80292a:	89 c8                	mov    %ecx,%eax
+  80292c:	e8 26 fe ff ff       	call   802757 <dm>
+  802931:	83 c4 10             	add    $0x10,%esp
+  802934:	85 db                	test   %ebx,%ebx
+  802936:	78 10                	js     802948 <__moddi3+0x5e>
+  802938:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80293c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802940:	83 c4 14             	add    $0x14,%esp
+  802943:	5b                   	pop    %ebx
+  802944:	5e                   	pop    %esi
+  802945:	5f                   	pop    %edi
+  802946:	5d                   	pop    %ebp
+  802947:	c3                   	ret
+  802948:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80294c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802950:	f7 d8                	neg    %eax
+  802952:	83 d2 00             	adc    $0x0,%edx
+  802955:	f7 da                	neg    %edx
+  802957:	eb e7                	jmp    802940 <__moddi3+0x56>
@@ -0,0 +1,5589 @@
+
+obj/user/faultaround:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 2b 01 00 00       	call   80015c <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <run>:
+		thisenv->env_fault_around);
+}
+
+static void
+run(const char *name, char *mem, int stride)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+  80003c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80003f:	89 d3                	mov    %edx,%ebx
+	uint32_t faults, prefaults, hits;
+	int i;
+
+	faults = thisenv->env_faults;
+  800041:	a1 08 40 80 00       	mov    0x804008,%eax
+  800046:	8b b0 50 01 00 00    	mov    0x150(%eax),%esi
+	prefaults = thisenv->env_prefaults;
+  80004c:	8b b8 54 01 00 00    	mov    0x154(%eax),%edi
+	hits = thisenv->env_prefault_hits;
+  800052:	8b 80 58 01 00 00    	mov    0x158(%eax),%eax
+  800058:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (i = 0; i < NPAGES; i += stride)
+  80005b:	b8 00 00 00 00       	mov    $0x0,%eax
+		mem[i * PGSIZE] = i;
+  800060:	89 c2                	mov    %eax,%edx
+  800062:	c1 e2 0c             	shl    $0xc,%edx
+  800065:	88 04 13             	mov    %al,(%ebx,%edx,1)
+	for (i = 0; i < NPAGES; i += stride)
+  800068:	01 c8                	add    %ecx,%eax
+  80006a:	3d bf 00 00 00       	cmp    $0xbf,%eax
+  80006f:	7e ef                	jle    800060 <run+0x2d>
+	// The kernel scores a window at the next fault, so the last one
+	// of this run counts toward the next.
+	report(name, thisenv->env_faults - faults,
+	       thisenv->env_prefaults - prefaults,
+	       thisenv->env_prefault_hits - hits);
+  800071:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  800077:	8b 82 58 01 00 00    	mov    0x158(%edx),%eax
+	       thisenv->env_prefaults - prefaults,
+  80007d:	8b 8a 54 01 00 00    	mov    0x154(%edx),%ecx
+	report(name, thisenv->env_faults - faults,
+  800083:	29 f9                	sub    %edi,%ecx
+  800085:	8b 9a 50 01 00 00    	mov    0x150(%edx),%ebx
+  80008b:	29 f3                	sub    %esi,%ebx
+		thisenv->env_fault_around);
+  80008d:	8b b2 5c 01 00 00    	mov    0x15c(%edx),%esi
+	cprintf("%-10s %4d faults, %4d pages prefaulted, %3d%% hit, window %d\n",
+  800093:	89 cf                	mov    %ecx,%edi
+  800095:	85 c9                	test   %ecx,%ecx
+  800097:	74 11                	je     8000aa <run+0x77>
+	report(name, thisenv->env_faults - faults,
+  800099:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80009c:	29 f8                	sub    %edi,%eax
+		name, faults, prefaults, prefaults ? 100 * hits / prefaults : 0,
+  80009e:	6b c0 64             	imul   $0x64,%eax,%eax
+	cprintf("%-10s %4d faults, %4d pages prefaulted, %3d%% hit, window %d\n",
+  8000a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000a6:	f7 f1                	div    %ecx
+  8000a8:	89 c7                	mov    %eax,%edi
+  8000aa:	83 ec 08             	sub    $0x8,%esp
+  8000ad:	56                   	push   %esi
+  8000ae:	57                   	push   %edi
+  8000af:	51                   	push   %ecx
+  8000b0:	53                   	push   %ebx
+  8000b1:	ff 75 e4             	push   -0x1c(%ebp)
+  8000b4:	68 a0 2c 80 00       	push   $0x802ca0
+  8000b9:	e8 29 05 00 00       	call   8005e7 <cprintf>
+}
+  8000be:	83 c4 20             	add    $0x20,%esp
+  8000c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000c4:	5b                   	pop    %ebx
+  8000c5:	5e                   	pop    %esi
+  8000c6:	5f                   	pop    %edi
+  8000c7:	5d                   	pop    %ebp
+  8000c8:	c3                   	ret
+
+008000c9 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000c9:	55                   	push   %ebp
+  8000ca:	89 e5                	mov    %esp,%ebp
+  8000cc:	53                   	push   %ebx
+  8000cd:	83 ec 10             	sub    $0x10,%esp
+	char *mem;
+
+	if (!(mem = malloc(NPAGES * PGSIZE)))
+  8000d0:	68 00 00 0c 00       	push   $0xc0000
+  8000d5:	e8 e7 01 00 00       	call   8002c1 <malloc>
+  8000da:	83 c4 10             	add    $0x10,%esp
+  8000dd:	85 c0                	test   %eax,%eax
+  8000df:	74 53                	je     800134 <umain+0x6b>
+  8000e1:	89 c3                	mov    %eax,%ebx
+		panic("malloc failed");
+	run("sequential", mem, 1);
+  8000e3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8000e8:	89 c2                	mov    %eax,%edx
+  8000ea:	b8 ff 2c 80 00       	mov    $0x802cff,%eax
+  8000ef:	e8 3f ff ff ff       	call   800033 <run>
+	free(mem);
+  8000f4:	83 ec 0c             	sub    $0xc,%esp
+  8000f7:	53                   	push   %ebx
+  8000f8:	e8 df 00 00 00       	call   8001dc <free>
+
+	if (!(mem = malloc(NPAGES * PGSIZE)))
+  8000fd:	c7 04 24 00 00 0c 00 	movl   $0xc0000,(%esp)
+  800104:	e8 b8 01 00 00       	call   8002c1 <malloc>
+  800109:	89 c3                	mov    %eax,%ebx
+  80010b:	83 c4 10             	add    $0x10,%esp
+  80010e:	85 c0                	test   %eax,%eax
+  800110:	74 36                	je     800148 <umain+0x7f>
+		panic("malloc failed");
+	run("stride 8", mem, 8);
+  800112:	b9 08 00 00 00       	mov    $0x8,%ecx
+  800117:	89 c2                	mov    %eax,%edx
+  800119:	b8 0a 2d 80 00       	mov    $0x802d0a,%eax
+  80011e:	e8 10 ff ff ff       	call   800033 <run>
+	free(mem);
+  800123:	83 ec 0c             	sub    $0xc,%esp
+  800126:	53                   	push   %ebx
+  800127:	e8 b0 00 00 00       	call   8001dc <free>
+}
+  80012c:	83 c4 10             	add    $0x10,%esp
+  80012f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800132:	c9                   	leave
+  800133:	c3                   	ret
+		panic("malloc failed");
+  800134:	83 ec 04             	sub    $0x4,%esp
+  800137:	68 de 2c 80 00       	push   $0x802cde
+  80013c:	6a 28                	push   $0x28
+  80013e:	68 ec 2c 80 00       	push   $0x802cec
+  800143:	e8 8b 03 00 00       	call   8004d3 <_panic>
+		panic("malloc failed");
+  800148:	83 ec 04             	sub    $0x4,%esp
+  80014b:	68 de 2c 80 00       	push   $0x802cde
+  800150:	6a 2d                	push   $0x2d
+  800152:	68 ec 2c 80 00       	push   $0x802cec
+  800157:	e8 77 03 00 00       	call   8004d3 <_panic>
+
+0080015c <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80015c:	55                   	push   %ebp
+  80015d:	89 e5                	mov    %esp,%ebp
+  80015f:	56                   	push   %esi
+  800160:	53                   	push   %ebx
+  800161:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800164:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  800167:	e8 ff 11 00 00       	call   80136b <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  80016c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800171:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  800177:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80017c:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800181:	85 db                	test   %ebx,%ebx
+  800183:	7e 07                	jle    80018c <libmain+0x30>
+		binaryname = argv[0];
+  800185:	8b 06                	mov    (%esi),%eax
+  800187:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  80018c:	83 ec 08             	sub    $0x8,%esp
+  80018f:	56                   	push   %esi
+  800190:	53                   	push   %ebx
+  800191:	e8 33 ff ff ff       	call   8000c9 <umain>
+
+	// exit gracefully
+	exit();
+  800196:	e8 0a 00 00 00       	call   8001a5 <exit>
+}
+  80019b:	83 c4 10             	add    $0x10,%esp
+  80019e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001a1:	5b                   	pop    %ebx
+  8001a2:	5e                   	pop    %esi
+  8001a3:	5d                   	pop    %ebp
+  8001a4:	c3                   	ret
+
+008001a5 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001a5:	55                   	push   %ebp
+  8001a6:	89 e5                	mov    %esp,%ebp
+  8001a8:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  8001ab:	6a 00                	push   $0x0
+  8001ad:	e8 f7 10 00 00       	call   8012a9 <sys_env_destroy>
+}
+  8001b2:	83 c4 10             	add    $0x10,%esp
+  8001b5:	c9                   	leave
+  8001b6:	c3                   	ret
+
+008001b7 <ismapped>:
+static uint8_t *mptr;
+
+static int
+ismapped(uintptr_t va)
+{
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  8001b7:	89 c2                	mov    %eax,%edx
+  8001b9:	c1 ea 16             	shr    $0x16,%edx
+  8001bc:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8001c3:	f6 c2 01             	test   $0x1,%dl
+  8001c6:	74 0e                	je     8001d6 <ismapped+0x1f>
+  8001c8:	c1 e8 0c             	shr    $0xc,%eax
+  8001cb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8001d2:	83 e0 01             	and    $0x1,%eax
+  8001d5:	c3                   	ret
+  8001d6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8001db:	c3                   	ret
+
+008001dc <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  8001dc:	55                   	push   %ebp
+  8001dd:	89 e5                	mov    %esp,%ebp
+  8001df:	56                   	push   %esi
+  8001e0:	53                   	push   %ebx
+  8001e1:	83 ec 10             	sub    $0x10,%esp
+  8001e4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint8_t *c;
+	uint32_t *ref;
+	struct page_range range;
+
+	if (v == 0)
+  8001e7:	85 db                	test   %ebx,%ebx
+  8001e9:	0f 84 a7 00 00 00    	je     800296 <free+0xba>
+		return;
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  8001ef:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8001f5:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  8001fa:	77 65                	ja     800261 <free+0x85>
+
+	c = ROUNDDOWN(v, PGSIZE);
+  8001fc:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+
+	range.pr_va = c;
+  800202:	89 5d e8             	mov    %ebx,-0x18(%ebp)
+	range.pr_npages = 0;
+  800205:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  80020c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800211:	b8 00 00 00 00       	mov    $0x0,%eax
+  800216:	be 01 00 00 00       	mov    $0x1,%esi
+  80021b:	89 da                	mov    %ebx,%edx
+  80021d:	c1 ea 0c             	shr    $0xc,%edx
+  800220:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800227:	f6 c6 02             	test   $0x2,%dh
+  80022a:	74 4e                	je     80027a <free+0x9e>
+		range.pr_npages++;
+  80022c:	83 c0 01             	add    $0x1,%eax
+		c += PGSIZE;
+  80022f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  800235:	89 f1                	mov    %esi,%ecx
+  800237:	8d 93 00 00 00 f8    	lea    -0x8000000(%ebx),%edx
+  80023d:	81 fa ff ff ff 07    	cmp    $0x7ffffff,%edx
+  800243:	76 d6                	jbe    80021b <free+0x3f>
+  800245:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800248:	68 70 2d 80 00       	push   $0x802d70
+  80024d:	68 4e 2d 80 00       	push   $0x802d4e
+  800252:	68 a5 00 00 00       	push   $0xa5
+  800257:	68 63 2d 80 00       	push   $0x802d63
+  80025c:	e8 72 02 00 00       	call   8004d3 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  800261:	68 20 2d 80 00       	push   $0x802d20
+  800266:	68 4e 2d 80 00       	push   $0x802d4e
+  80026b:	68 9c 00 00 00       	push   $0x9c
+  800270:	68 63 2d 80 00       	push   $0x802d63
+  800275:	e8 59 02 00 00       	call   8004d3 <_panic>
+  80027a:	84 c9                	test   %cl,%cl
+  80027c:	74 07                	je     800285 <free+0xa9>
+  80027e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+	}
+	if (range.pr_npages)
+  800281:	85 c0                	test   %eax,%eax
+  800283:	75 18                	jne    80029d <free+0xc1>
+	/*
+	 * c is just a piece of this page, so dec the ref count
+	 * and maybe free the page.
+	 */
+	ref = (uint32_t*) (c + PGSIZE - 4);
+	if (--(*ref) == 0)
+  800285:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  80028b:	83 e8 01             	sub    $0x1,%eax
+  80028e:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  800294:	74 1b                	je     8002b1 <free+0xd5>
+		sys_page_unmap(0, c);
+}
+  800296:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800299:	5b                   	pop    %ebx
+  80029a:	5e                   	pop    %esi
+  80029b:	5d                   	pop    %ebp
+  80029c:	c3                   	ret
+		sys_page_unmap_vec(0, &range, 1, 0);
+  80029d:	6a 00                	push   $0x0
+  80029f:	6a 01                	push   $0x1
+  8002a1:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  8002a4:	50                   	push   %eax
+  8002a5:	6a 00                	push   $0x0
+  8002a7:	e8 0f 1e 00 00       	call   8020bb <sys_page_unmap_vec>
+  8002ac:	83 c4 10             	add    $0x10,%esp
+  8002af:	eb d4                	jmp    800285 <free+0xa9>
+		sys_page_unmap(0, c);
+  8002b1:	83 ec 08             	sub    $0x8,%esp
+  8002b4:	53                   	push   %ebx
+  8002b5:	6a 00                	push   $0x0
+  8002b7:	e8 d8 12 00 00       	call   801594 <sys_page_unmap>
+  8002bc:	83 c4 10             	add    $0x10,%esp
+  8002bf:	eb d5                	jmp    800296 <free+0xba>
+
+008002c1 <malloc>:
+{
+  8002c1:	55                   	push   %ebp
+  8002c2:	89 e5                	mov    %esp,%ebp
+  8002c4:	57                   	push   %edi
+  8002c5:	56                   	push   %esi
+  8002c6:	53                   	push   %ebx
+  8002c7:	83 ec 5c             	sub    $0x5c,%esp
+	if (mptr == 0)
+  8002ca:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8002cf:	85 c0                	test   %eax,%eax
+  8002d1:	74 5d                	je     800330 <malloc+0x6f>
+	n = ROUNDUP(n, 4);
+  8002d3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002d6:	8d 71 03             	lea    0x3(%ecx),%esi
+  8002d9:	89 f7                	mov    %esi,%edi
+  8002db:	83 e7 fc             	and    $0xfffffffc,%edi
+	if (n >= MAXMALLOC)
+  8002de:	81 ff ff ff 0f 00    	cmp    $0xfffff,%edi
+  8002e4:	0f 87 d5 01 00 00    	ja     8004bf <malloc+0x1fe>
+	if ((uintptr_t) mptr % PGSIZE){
+  8002ea:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  8002ef:	74 30                	je     800321 <malloc+0x60>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  8002f1:	89 c3                	mov    %eax,%ebx
+  8002f3:	c1 eb 0c             	shr    $0xc,%ebx
+  8002f6:	8d 54 38 03          	lea    0x3(%eax,%edi,1),%edx
+  8002fa:	c1 ea 0c             	shr    $0xc,%edx
+  8002fd:	39 d3                	cmp    %edx,%ebx
+  8002ff:	74 51                	je     800352 <malloc+0x91>
+		free(mptr);	/* drop reference to this page */
+  800301:	83 ec 0c             	sub    $0xc,%esp
+  800304:	50                   	push   %eax
+  800305:	e8 d2 fe ff ff       	call   8001dc <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  80030a:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  80030f:	05 00 10 00 00       	add    $0x1000,%eax
+  800314:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800319:	a3 0c 40 80 00       	mov    %eax,0x80400c
+  80031e:	83 c4 10             	add    $0x10,%esp
+{
+  800321:	c7 45 a0 02 00 00 00 	movl   $0x2,-0x60(%ebp)
+	    || sys_vm_ranges(0, (void*) va, &r, 1) <= 0)
+  800328:	89 75 a4             	mov    %esi,-0x5c(%ebp)
+  80032b:	e9 8c 00 00 00       	jmp    8003bc <malloc+0xfb>
+		mptr = mbegin;
+  800330:	c7 05 0c 40 80 00 00 	movl   $0x8000000,0x80400c
+  800337:	00 00 08 
+	n = ROUNDUP(n, 4);
+  80033a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80033d:	8d 71 03             	lea    0x3(%ecx),%esi
+  800340:	89 f7                	mov    %esi,%edi
+  800342:	83 e7 fc             	and    $0xfffffffc,%edi
+	if (n >= MAXMALLOC)
+  800345:	81 ff ff ff 0f 00    	cmp    $0xfffff,%edi
+  80034b:	76 d4                	jbe    800321 <malloc+0x60>
+  80034d:	e9 ed 00 00 00       	jmp    80043f <malloc+0x17e>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  800352:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  800358:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+			(*ref)++;
+  80035e:	83 42 fc 01          	addl   $0x1,-0x4(%edx)
+			mptr += n;
+  800362:	01 c7                	add    %eax,%edi
+  800364:	89 3d 0c 40 80 00    	mov    %edi,0x80400c
+			return v;
+  80036a:	e9 d0 00 00 00       	jmp    80043f <malloc+0x17e>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE) {
+  80036f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800375:	39 f3                	cmp    %esi,%ebx
+  800377:	73 4f                	jae    8003c8 <malloc+0x107>
+		if (va >= (uintptr_t) mend)
+  800379:	81 fb ff ff ff 0f    	cmp    $0xfffffff,%ebx
+  80037f:	0f 87 44 01 00 00    	ja     8004c9 <malloc+0x208>
+		if (ismapped(va))
+  800385:	89 d8                	mov    %ebx,%eax
+  800387:	e8 2b fe ff ff       	call   8001b7 <ismapped>
+  80038c:	85 c0                	test   %eax,%eax
+  80038e:	74 df                	je     80036f <malloc+0xae>
+	va += PGSIZE;
+  800390:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+	if (va >= (uintptr_t) mend || !ismapped(va)
+  800396:	81 fb ff ff ff 0f    	cmp    $0xfffffff,%ebx
+  80039c:	0f 86 a5 00 00 00    	jbe    800447 <malloc+0x186>
+		if (!(next = next_free(mptr, n + 4)))
+  8003a2:	85 db                	test   %ebx,%ebx
+  8003a4:	0f 84 ee 00 00 00    	je     800498 <malloc+0x1d7>
+		mptr = next;
+  8003aa:	89 1d 0c 40 80 00    	mov    %ebx,0x80400c
+		if (mptr >= mend) {
+  8003b0:	81 fb ff ff ff 0f    	cmp    $0xfffffff,%ebx
+  8003b6:	0f 87 c1 00 00 00    	ja     80047d <malloc+0x1bc>
+	uintptr_t va, end_va = (uintptr_t) v + n;
+  8003bc:	8b 1d 0c 40 80 00    	mov    0x80400c,%ebx
+  8003c2:	8d 74 1f 04          	lea    0x4(%edi,%ebx,1),%esi
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE) {
+  8003c6:	eb ad                	jmp    800375 <malloc+0xb4>
+  8003c8:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+	npages = ROUNDUP(n + 4, PGSIZE) / PGSIZE;
+  8003cb:	8d 9f 03 10 00 00    	lea    0x1003(%edi),%ebx
+  8003d1:	c1 eb 0c             	shr    $0xc,%ebx
+	vec[0].pr_va = mptr;
+  8003d4:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8003d9:	89 45 c8             	mov    %eax,-0x38(%ebp)
+	vec[0].pr_npages = npages - 1;
+  8003dc:	8d 53 ff             	lea    -0x1(%ebx),%edx
+  8003df:	89 55 cc             	mov    %edx,-0x34(%ebp)
+	vec[0].pr_perm = PTE_P|PTE_U|PTE_W|PTE_CONTINUED|PAGE_ZERO_FILL;
+  8003e2:	c7 45 d0 07 12 00 00 	movl   $0x1207,-0x30(%ebp)
+	vec[1].pr_va = mptr + (npages - 1) * PGSIZE;
+  8003e9:	c1 e2 0c             	shl    $0xc,%edx
+  8003ec:	01 d0                	add    %edx,%eax
+  8003ee:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	vec[1].pr_npages = 1;
+  8003f1:	c7 45 dc 01 00 00 00 	movl   $0x1,-0x24(%ebp)
+	vec[1].pr_perm = PTE_P|PTE_U|PTE_W|PAGE_ZERO_FILL;
+  8003f8:	c7 45 e0 07 10 00 00 	movl   $0x1007,-0x20(%ebp)
+	if (sys_page_alloc_vec(0, vec, 2, &done) < 0) {
+  8003ff:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+  800402:	50                   	push   %eax
+  800403:	6a 02                	push   $0x2
+  800405:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  800408:	50                   	push   %eax
+  800409:	6a 00                	push   $0x0
+  80040b:	e8 67 1c 00 00       	call   802077 <sys_page_alloc_vec>
+  800410:	83 c4 10             	add    $0x10,%esp
+  800413:	85 c0                	test   %eax,%eax
+  800415:	0f 88 85 00 00 00    	js     8004a0 <malloc+0x1df>
+	ref = (uint32_t*) (mptr + i - 4);
+  80041b:	a1 0c 40 80 00       	mov    0x80400c,%eax
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  800420:	c1 e3 0c             	shl    $0xc,%ebx
+  800423:	c7 44 18 fc 02 00 00 	movl   $0x2,-0x4(%eax,%ebx,1)
+  80042a:	00 
+	mptr += n;
+  80042b:	01 c7                	add    %eax,%edi
+  80042d:	8d 57 04             	lea    0x4(%edi),%edx
+  800430:	f7 c6 fc 0f 00 00    	test   $0xffc,%esi
+  800436:	0f 45 d7             	cmovne %edi,%edx
+  800439:	89 15 0c 40 80 00    	mov    %edx,0x80400c
+}
+  80043f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800442:	5b                   	pop    %ebx
+  800443:	5e                   	pop    %esi
+  800444:	5f                   	pop    %edi
+  800445:	5d                   	pop    %ebp
+  800446:	c3                   	ret
+	if (va >= (uintptr_t) mend || !ismapped(va)
+  800447:	89 d8                	mov    %ebx,%eax
+  800449:	e8 69 fd ff ff       	call   8001b7 <ismapped>
+  80044e:	85 c0                	test   %eax,%eax
+  800450:	0f 84 4c ff ff ff    	je     8003a2 <malloc+0xe1>
+	    || sys_vm_ranges(0, (void*) va, &r, 1) <= 0)
+  800456:	6a 01                	push   $0x1
+  800458:	8d 45 b4             	lea    -0x4c(%ebp),%eax
+  80045b:	50                   	push   %eax
+  80045c:	53                   	push   %ebx
+  80045d:	6a 00                	push   $0x0
+  80045f:	e8 7a 1c 00 00       	call   8020de <sys_vm_ranges>
+  800464:	83 c4 10             	add    $0x10,%esp
+  800467:	85 c0                	test   %eax,%eax
+  800469:	0f 8e 33 ff ff ff    	jle    8003a2 <malloc+0xe1>
+	return (uint8_t*) r.pr_va + r.pr_npages * PGSIZE;
+  80046f:	8b 5d b8             	mov    -0x48(%ebp),%ebx
+  800472:	c1 e3 0c             	shl    $0xc,%ebx
+  800475:	03 5d b4             	add    -0x4c(%ebp),%ebx
+  800478:	e9 25 ff ff ff       	jmp    8003a2 <malloc+0xe1>
+			mptr = mbegin;
+  80047d:	c7 05 0c 40 80 00 00 	movl   $0x8000000,0x80400c
+  800484:	00 00 08 
+			if (++nwrap == 2)
+  800487:	83 6d a0 01          	subl   $0x1,-0x60(%ebp)
+  80048b:	0f 85 2b ff ff ff    	jne    8003bc <malloc+0xfb>
+				return 0;	/* out of address space */
+  800491:	b8 00 00 00 00       	mov    $0x0,%eax
+  800496:	eb a7                	jmp    80043f <malloc+0x17e>
+  800498:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  80049b:	e9 2b ff ff ff       	jmp    8003cb <malloc+0x10a>
+		vec[0].pr_npages = done;
+  8004a0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8004a3:	89 45 cc             	mov    %eax,-0x34(%ebp)
+		sys_page_unmap_vec(0, vec, 1, 0);
+  8004a6:	6a 00                	push   $0x0
+  8004a8:	6a 01                	push   $0x1
+  8004aa:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  8004ad:	50                   	push   %eax
+  8004ae:	6a 00                	push   $0x0
+  8004b0:	e8 06 1c 00 00       	call   8020bb <sys_page_unmap_vec>
+		return 0;	/* out of physical memory */
+  8004b5:	83 c4 10             	add    $0x10,%esp
+  8004b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004bd:	eb 80                	jmp    80043f <malloc+0x17e>
+		return 0;
+  8004bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c4:	e9 76 ff ff ff       	jmp    80043f <malloc+0x17e>
+			return mend;
+  8004c9:	bb 00 00 00 10       	mov    $0x10000000,%ebx
+  8004ce:	e9 d7 fe ff ff       	jmp    8003aa <malloc+0xe9>
+
+008004d3 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8004d3:	55                   	push   %ebp
+  8004d4:	89 e5                	mov    %esp,%ebp
+  8004d6:	57                   	push   %edi
+  8004d7:	56                   	push   %esi
+  8004d8:	53                   	push   %ebx
+  8004d9:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  8004df:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  8004e2:	8b 1d 00 40 80 00    	mov    0x804000,%ebx
+  8004e8:	e8 7e 0e 00 00       	call   80136b <sys_getenvid>
+  8004ed:	83 ec 04             	sub    $0x4,%esp
+  8004f0:	ff 75 0c             	push   0xc(%ebp)
+  8004f3:	ff 75 08             	push   0x8(%ebp)
+  8004f6:	53                   	push   %ebx
+  8004f7:	50                   	push   %eax
+  8004f8:	68 88 2d 80 00       	push   $0x802d88
+  8004fd:	68 00 01 00 00       	push   $0x100
+  800502:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  800508:	56                   	push   %esi
+  800509:	e8 72 06 00 00       	call   800b80 <snprintf>
+  80050e:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  800510:	83 c4 20             	add    $0x20,%esp
+  800513:	57                   	push   %edi
+  800514:	ff 75 10             	push   0x10(%ebp)
+  800517:	bf 00 01 00 00       	mov    $0x100,%edi
+  80051c:	89 f8                	mov    %edi,%eax
+  80051e:	29 d8                	sub    %ebx,%eax
+  800520:	50                   	push   %eax
+  800521:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  800524:	50                   	push   %eax
+  800525:	e8 08 06 00 00       	call   800b32 <vsnprintf>
+  80052a:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  80052c:	83 c4 0c             	add    $0xc,%esp
+  80052f:	68 ab 2d 80 00       	push   $0x802dab
+  800534:	29 df                	sub    %ebx,%edi
+  800536:	57                   	push   %edi
+  800537:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  80053a:	50                   	push   %eax
+  80053b:	e8 40 06 00 00       	call   800b80 <snprintf>
+	sys_cputs(buf, r);
+  800540:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  800543:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  800545:	53                   	push   %ebx
+  800546:	56                   	push   %esi
+  800547:	e8 21 0c 00 00       	call   80116d <sys_cputs>
+  80054c:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80054f:	cc                   	int3
+	while (1)
+  800550:	eb fd                	jmp    80054f <_panic+0x7c>
+
+00800552 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800552:	55                   	push   %ebp
+  800553:	89 e5                	mov    %esp,%ebp
+  800555:	53                   	push   %ebx
+  800556:	83 ec 04             	sub    $0x4,%esp
+  800559:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80055c:	8b 13                	mov    (%ebx),%edx
+  80055e:	8d 42 01             	lea    0x1(%edx),%eax
+  800561:	89 03                	mov    %eax,(%ebx)
+  800563:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800566:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80056a:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80056f:	74 09                	je     80057a <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800571:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800575:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800578:	c9                   	leave
+  800579:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80057a:	83 ec 08             	sub    $0x8,%esp
+  80057d:	68 ff 00 00 00       	push   $0xff
+  800582:	8d 43 08             	lea    0x8(%ebx),%eax
+  800585:	50                   	push   %eax
+  800586:	e8 e2 0b 00 00       	call   80116d <sys_cputs>
+		b->idx = 0;
+  80058b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800591:	83 c4 10             	add    $0x10,%esp
+  800594:	eb db                	jmp    800571 <putch+0x1f>
+
+00800596 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800596:	55                   	push   %ebp
+  800597:	89 e5                	mov    %esp,%ebp
+  800599:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80059f:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8005a6:	00 00 00 
+	b.cnt = 0;
+  8005a9:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8005b0:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8005b3:	ff 75 0c             	push   0xc(%ebp)
+  8005b6:	ff 75 08             	push   0x8(%ebp)
+  8005b9:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8005bf:	50                   	push   %eax
+  8005c0:	68 52 05 80 00       	push   $0x800552
+  8005c5:	e8 14 01 00 00       	call   8006de <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8005ca:	83 c4 08             	add    $0x8,%esp
+  8005cd:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8005d3:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8005d9:	50                   	push   %eax
+  8005da:	e8 8e 0b 00 00       	call   80116d <sys_cputs>
+
+	return b.cnt;
+}
+  8005df:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8005e5:	c9                   	leave
+  8005e6:	c3                   	ret
+
+008005e7 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8005e7:	55                   	push   %ebp
+  8005e8:	89 e5                	mov    %esp,%ebp
+  8005ea:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8005ed:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8005f0:	50                   	push   %eax
+  8005f1:	ff 75 08             	push   0x8(%ebp)
+  8005f4:	e8 9d ff ff ff       	call   800596 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8005f9:	c9                   	leave
+  8005fa:	c3                   	ret
+
+008005fb <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8005fb:	55                   	push   %ebp
+  8005fc:	89 e5                	mov    %esp,%ebp
+  8005fe:	57                   	push   %edi
+  8005ff:	56                   	push   %esi
+  800600:	53                   	push   %ebx
+  800601:	83 ec 1c             	sub    $0x1c,%esp
+  800604:	89 c7                	mov    %eax,%edi
+  800606:	89 d6                	mov    %edx,%esi
+  800608:	8b 45 08             	mov    0x8(%ebp),%eax
+  80060b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80060e:	89 d1                	mov    %edx,%ecx
+  800610:	89 c2                	mov    %eax,%edx
+  800612:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800615:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800618:	8b 45 10             	mov    0x10(%ebp),%eax
+  80061b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80061e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800621:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800628:	39 c2                	cmp    %eax,%edx
+  80062a:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80062d:	72 3e                	jb     80066d <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80062f:	83 ec 0c             	sub    $0xc,%esp
+  800632:	ff 75 18             	push   0x18(%ebp)
+  800635:	83 eb 01             	sub    $0x1,%ebx
+  800638:	53                   	push   %ebx
+  800639:	50                   	push   %eax
+  80063a:	83 ec 08             	sub    $0x8,%esp
+  80063d:	ff 75 e4             	push   -0x1c(%ebp)
+  800640:	ff 75 e0             	push   -0x20(%ebp)
+  800643:	ff 75 dc             	push   -0x24(%ebp)
+  800646:	ff 75 d8             	push   -0x28(%ebp)
+  800649:	e8 0a 25 00 00       	call   802b58 <__udivdi3>
+  80064e:	83 c4 18             	add    $0x18,%esp
+  800651:	52                   	push   %edx
+  800652:	50                   	push   %eax
+  800653:	89 f2                	mov    %esi,%edx
+  800655:	89 f8                	mov    %edi,%eax
+  800657:	e8 9f ff ff ff       	call   8005fb <printnum>
+  80065c:	83 c4 20             	add    $0x20,%esp
+  80065f:	eb 13                	jmp    800674 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800661:	83 ec 08             	sub    $0x8,%esp
+  800664:	56                   	push   %esi
+  800665:	ff 75 18             	push   0x18(%ebp)
+  800668:	ff d7                	call   *%edi
+  80066a:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80066d:	83 eb 01             	sub    $0x1,%ebx
+  800670:	85 db                	test   %ebx,%ebx
+  800672:	7f ed                	jg     800661 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800674:	83 ec 08             	sub    $0x8,%esp
+  800677:	56                   	push   %esi
+  800678:	83 ec 04             	sub    $0x4,%esp
+  80067b:	ff 75 e4             	push   -0x1c(%ebp)
+  80067e:	ff 75 e0             	push   -0x20(%ebp)
+  800681:	ff 75 dc             	push   -0x24(%ebp)
+  800684:	ff 75 d8             	push   -0x28(%ebp)
+  800687:	e8 ea 24 00 00       	call   802b76 <__umoddi3>
+  80068c:	83 c4 14             	add    $0x14,%esp
+  80068f:	0f be 80 ad 2d 80 00 	movsbl 0x802dad(%eax),%eax
+  800696:	50                   	push   %eax
+  800697:	ff d7                	call   *%edi
+}
+  800699:	83 c4 10             	add    $0x10,%esp
+  80069c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80069f:	5b                   	pop    %ebx
+  8006a0:	5e                   	pop    %esi
+  8006a1:	5f                   	pop    %edi
+  8006a2:	5d                   	pop    %ebp
+  8006a3:	c3                   	ret
+
+008006a4 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8006a4:	55                   	push   %ebp
+  8006a5:	89 e5                	mov    %esp,%ebp
+  8006a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8006aa:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8006ae:	8b 10                	mov    (%eax),%edx
+  8006b0:	3b 50 04             	cmp    0x4(%eax),%edx
+  8006b3:	73 0a                	jae    8006bf <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8006b5:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8006b8:	89 08                	mov    %ecx,(%eax)
+  8006ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006bd:	88 02                	mov    %al,(%edx)
+}
+  8006bf:	5d                   	pop    %ebp
+  8006c0:	c3                   	ret
+
+008006c1 <printfmt>:
+{
+  8006c1:	55                   	push   %ebp
+  8006c2:	89 e5                	mov    %esp,%ebp
+  8006c4:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8006c7:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8006ca:	50                   	push   %eax
+  8006cb:	ff 75 10             	push   0x10(%ebp)
+  8006ce:	ff 75 0c             	push   0xc(%ebp)
+  8006d1:	ff 75 08             	push   0x8(%ebp)
+  8006d4:	e8 05 00 00 00       	call   8006de <vprintfmt>
+}
+  8006d9:	83 c4 10             	add    $0x10,%esp
+  8006dc:	c9                   	leave
+  8006dd:	c3                   	ret
+
+008006de <vprintfmt>:
+{
+  8006de:	55                   	push   %ebp
+  8006df:	89 e5                	mov    %esp,%ebp
+  8006e1:	57                   	push   %edi
+  8006e2:	56                   	push   %esi
+  8006e3:	53                   	push   %ebx
+  8006e4:	83 ec 2c             	sub    $0x2c,%esp
+  8006e7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006ea:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8006ed:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8006f0:	eb 0a                	jmp    8006fc <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8006f2:	83 ec 08             	sub    $0x8,%esp
+  8006f5:	53                   	push   %ebx
+  8006f6:	50                   	push   %eax
+  8006f7:	ff d6                	call   *%esi
+  8006f9:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006fc:	83 c7 01             	add    $0x1,%edi
+  8006ff:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800703:	83 f8 25             	cmp    $0x25,%eax
+  800706:	74 0c                	je     800714 <vprintfmt+0x36>
+			if (ch == '\0')
+  800708:	85 c0                	test   %eax,%eax
+  80070a:	75 e6                	jne    8006f2 <vprintfmt+0x14>
+}
+  80070c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80070f:	5b                   	pop    %ebx
+  800710:	5e                   	pop    %esi
+  800711:	5f                   	pop    %edi
+  800712:	5d                   	pop    %ebp
+  800713:	c3                   	ret
+		padc = ' ';
+  800714:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800718:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80071f:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800726:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80072d:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800732:	8d 47 01             	lea    0x1(%edi),%eax
+  800735:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800738:	0f b6 17             	movzbl (%edi),%edx
+  80073b:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80073e:	3c 55                	cmp    $0x55,%al
+  800740:	0f 87 cf 03 00 00    	ja     800b15 <vprintfmt+0x437>
+  800746:	0f b6 c0             	movzbl %al,%eax
+  800749:	ff 24 85 a0 2e 80 00 	jmp    *0x802ea0(,%eax,4)
+  800750:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800753:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800757:	eb d9                	jmp    800732 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800759:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80075c:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800760:	eb d0                	jmp    800732 <vprintfmt+0x54>
+  800762:	0f b6 d2             	movzbl %dl,%edx
+  800765:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800768:	b8 00 00 00 00       	mov    $0x0,%eax
+  80076d:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800770:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800773:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800777:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80077a:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80077d:	83 f9 09             	cmp    $0x9,%ecx
+  800780:	77 55                	ja     8007d7 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800782:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800785:	eb e9                	jmp    800770 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800787:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078a:	8b 00                	mov    (%eax),%eax
+  80078c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80078f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800792:	8d 40 04             	lea    0x4(%eax),%eax
+  800795:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800798:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80079b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80079f:	79 91                	jns    800732 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8007a1:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007a4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007a7:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8007ae:	eb 82                	jmp    800732 <vprintfmt+0x54>
+			if (width < 0)
+  8007b0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8007b3:	85 d2                	test   %edx,%edx
+  8007b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ba:	0f 49 c2             	cmovns %edx,%eax
+  8007bd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8007c0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8007c3:	e9 6a ff ff ff       	jmp    800732 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8007c8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8007cb:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8007d2:	e9 5b ff ff ff       	jmp    800732 <vprintfmt+0x54>
+  8007d7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8007da:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8007dd:	eb bc                	jmp    80079b <vprintfmt+0xbd>
+			lflag++;
+  8007df:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8007e2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8007e5:	e9 48 ff ff ff       	jmp    800732 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8007ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ed:	8d 78 04             	lea    0x4(%eax),%edi
+  8007f0:	83 ec 08             	sub    $0x8,%esp
+  8007f3:	53                   	push   %ebx
+  8007f4:	ff 30                	push   (%eax)
+  8007f6:	ff d6                	call   *%esi
+			break;
+  8007f8:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8007fb:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8007fe:	e9 b1 02 00 00       	jmp    800ab4 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800803:	8b 45 14             	mov    0x14(%ebp),%eax
+  800806:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800809:	8b 10                	mov    (%eax),%edx
+  80080b:	89 d0                	mov    %edx,%eax
+  80080d:	f7 d8                	neg    %eax
+  80080f:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800812:	83 f8 0d             	cmp    $0xd,%eax
+  800815:	7f 23                	jg     80083a <vprintfmt+0x15c>
+  800817:	8b 14 85 00 30 80 00 	mov    0x803000(,%eax,4),%edx
+  80081e:	85 d2                	test   %edx,%edx
+  800820:	74 18                	je     80083a <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800822:	52                   	push   %edx
+  800823:	68 60 2d 80 00       	push   $0x802d60
+  800828:	53                   	push   %ebx
+  800829:	56                   	push   %esi
+  80082a:	e8 92 fe ff ff       	call   8006c1 <printfmt>
+  80082f:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800832:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800835:	e9 7a 02 00 00       	jmp    800ab4 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80083a:	50                   	push   %eax
+  80083b:	68 c5 2d 80 00       	push   $0x802dc5
+  800840:	53                   	push   %ebx
+  800841:	56                   	push   %esi
+  800842:	e8 7a fe ff ff       	call   8006c1 <printfmt>
+  800847:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80084a:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80084d:	e9 62 02 00 00       	jmp    800ab4 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800852:	8b 45 14             	mov    0x14(%ebp),%eax
+  800855:	83 c0 04             	add    $0x4,%eax
+  800858:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80085b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085e:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800860:	85 c9                	test   %ecx,%ecx
+  800862:	b8 be 2d 80 00       	mov    $0x802dbe,%eax
+  800867:	0f 45 c1             	cmovne %ecx,%eax
+  80086a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80086d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800871:	7e 06                	jle    800879 <vprintfmt+0x19b>
+  800873:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800877:	75 0b                	jne    800884 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800879:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80087c:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80087f:	89 75 08             	mov    %esi,0x8(%ebp)
+  800882:	eb 5c                	jmp    8008e0 <vprintfmt+0x202>
+  800884:	83 ec 08             	sub    $0x8,%esp
+  800887:	ff 75 d0             	push   -0x30(%ebp)
+  80088a:	ff 75 cc             	push   -0x34(%ebp)
+  80088d:	e8 20 03 00 00       	call   800bb2 <strnlen>
+  800892:	89 c2                	mov    %eax,%edx
+  800894:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800897:	29 d0                	sub    %edx,%eax
+  800899:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80089c:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8008a0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008a3:	89 75 08             	mov    %esi,0x8(%ebp)
+  8008a6:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8008a8:	eb 0e                	jmp    8008b8 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8008aa:	83 ec 08             	sub    $0x8,%esp
+  8008ad:	53                   	push   %ebx
+  8008ae:	57                   	push   %edi
+  8008af:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8008b2:	83 ee 01             	sub    $0x1,%esi
+  8008b5:	83 c4 10             	add    $0x10,%esp
+  8008b8:	85 f6                	test   %esi,%esi
+  8008ba:	7f ee                	jg     8008aa <vprintfmt+0x1cc>
+  8008bc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008bf:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008c2:	85 c0                	test   %eax,%eax
+  8008c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008c9:	0f 49 d0             	cmovns %eax,%edx
+  8008cc:	29 d0                	sub    %edx,%eax
+  8008ce:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008d1:	eb a6                	jmp    800879 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8008d3:	83 ec 08             	sub    $0x8,%esp
+  8008d6:	53                   	push   %ebx
+  8008d7:	52                   	push   %edx
+  8008d8:	ff 55 08             	call   *0x8(%ebp)
+  8008db:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008de:	89 f1                	mov    %esi,%ecx
+  8008e0:	8d 71 01             	lea    0x1(%ecx),%esi
+  8008e3:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8008e7:	0f be d0             	movsbl %al,%edx
+  8008ea:	85 d2                	test   %edx,%edx
+  8008ec:	74 28                	je     800916 <vprintfmt+0x238>
+  8008ee:	85 ff                	test   %edi,%edi
+  8008f0:	78 05                	js     8008f7 <vprintfmt+0x219>
+  8008f2:	83 ef 01             	sub    $0x1,%edi
+  8008f5:	78 30                	js     800927 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8008f7:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8008fb:	74 d6                	je     8008d3 <vprintfmt+0x1f5>
+  8008fd:	0f be c0             	movsbl %al,%eax
+  800900:	83 e8 20             	sub    $0x20,%eax
+  800903:	83 f8 5e             	cmp    $0x5e,%eax
+  800906:	76 cb                	jbe    8008d3 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800908:	83 ec 08             	sub    $0x8,%esp
+  80090b:	53                   	push   %ebx
+  80090c:	6a 3f                	push   $0x3f
+  80090e:	ff 55 08             	call   *0x8(%ebp)
+  800911:	83 c4 10             	add    $0x10,%esp
+  800914:	eb c8                	jmp    8008de <vprintfmt+0x200>
+  800916:	8b 75 08             	mov    0x8(%ebp),%esi
+  800919:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80091c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80091f:	01 d0                	add    %edx,%eax
+  800921:	29 c8                	sub    %ecx,%eax
+  800923:	89 c7                	mov    %eax,%edi
+  800925:	eb 13                	jmp    80093a <vprintfmt+0x25c>
+  800927:	8b 75 08             	mov    0x8(%ebp),%esi
+  80092a:	eb ed                	jmp    800919 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80092c:	83 ec 08             	sub    $0x8,%esp
+  80092f:	53                   	push   %ebx
+  800930:	6a 20                	push   $0x20
+  800932:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800934:	83 ef 01             	sub    $0x1,%edi
+  800937:	83 c4 10             	add    $0x10,%esp
+  80093a:	85 ff                	test   %edi,%edi
+  80093c:	7f ee                	jg     80092c <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80093e:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800941:	89 45 14             	mov    %eax,0x14(%ebp)
+  800944:	e9 6b 01 00 00       	jmp    800ab4 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800949:	83 f9 01             	cmp    $0x1,%ecx
+  80094c:	7f 1f                	jg     80096d <vprintfmt+0x28f>
+	else if (lflag)
+  80094e:	85 c9                	test   %ecx,%ecx
+  800950:	74 67                	je     8009b9 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800952:	8b 45 14             	mov    0x14(%ebp),%eax
+  800955:	8b 00                	mov    (%eax),%eax
+  800957:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80095a:	89 c1                	mov    %eax,%ecx
+  80095c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80095f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800962:	8b 45 14             	mov    0x14(%ebp),%eax
+  800965:	8d 40 04             	lea    0x4(%eax),%eax
+  800968:	89 45 14             	mov    %eax,0x14(%ebp)
+  80096b:	eb 17                	jmp    800984 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80096d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800970:	8b 50 04             	mov    0x4(%eax),%edx
+  800973:	8b 00                	mov    (%eax),%eax
+  800975:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800978:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80097b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80097e:	8d 40 08             	lea    0x8(%eax),%eax
+  800981:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800984:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800987:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80098a:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80098f:	85 c9                	test   %ecx,%ecx
+  800991:	0f 89 03 01 00 00    	jns    800a9a <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800997:	83 ec 08             	sub    $0x8,%esp
+  80099a:	53                   	push   %ebx
+  80099b:	6a 2d                	push   $0x2d
+  80099d:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80099f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8009a2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8009a5:	f7 da                	neg    %edx
+  8009a7:	83 d1 00             	adc    $0x0,%ecx
+  8009aa:	f7 d9                	neg    %ecx
+  8009ac:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8009af:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8009b4:	e9 e1 00 00 00       	jmp    800a9a <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8009b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009bc:	8b 00                	mov    (%eax),%eax
+  8009be:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8009c1:	89 c1                	mov    %eax,%ecx
+  8009c3:	c1 f9 1f             	sar    $0x1f,%ecx
+  8009c6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8009c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009cc:	8d 40 04             	lea    0x4(%eax),%eax
+  8009cf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009d2:	eb b0                	jmp    800984 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8009d4:	83 f9 01             	cmp    $0x1,%ecx
+  8009d7:	7f 1e                	jg     8009f7 <vprintfmt+0x319>
+	else if (lflag)
+  8009d9:	85 c9                	test   %ecx,%ecx
+  8009db:	74 32                	je     800a0f <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8009dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009e0:	8b 10                	mov    (%eax),%edx
+  8009e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009e7:	8d 40 04             	lea    0x4(%eax),%eax
+  8009ea:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009ed:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8009f2:	e9 a3 00 00 00       	jmp    800a9a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8009f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009fa:	8b 10                	mov    (%eax),%edx
+  8009fc:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009ff:	8d 40 08             	lea    0x8(%eax),%eax
+  800a02:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a05:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800a0a:	e9 8b 00 00 00       	jmp    800a9a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800a0f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a12:	8b 10                	mov    (%eax),%edx
+  800a14:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a19:	8d 40 04             	lea    0x4(%eax),%eax
+  800a1c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a1f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800a24:	eb 74                	jmp    800a9a <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800a26:	83 f9 01             	cmp    $0x1,%ecx
+  800a29:	7f 1b                	jg     800a46 <vprintfmt+0x368>
+	else if (lflag)
+  800a2b:	85 c9                	test   %ecx,%ecx
+  800a2d:	74 2c                	je     800a5b <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800a2f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a32:	8b 10                	mov    (%eax),%edx
+  800a34:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a39:	8d 40 04             	lea    0x4(%eax),%eax
+  800a3c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a3f:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800a44:	eb 54                	jmp    800a9a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800a46:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a49:	8b 10                	mov    (%eax),%edx
+  800a4b:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a4e:	8d 40 08             	lea    0x8(%eax),%eax
+  800a51:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a54:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800a59:	eb 3f                	jmp    800a9a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800a5b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a5e:	8b 10                	mov    (%eax),%edx
+  800a60:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a65:	8d 40 04             	lea    0x4(%eax),%eax
+  800a68:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a6b:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800a70:	eb 28                	jmp    800a9a <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800a72:	83 ec 08             	sub    $0x8,%esp
+  800a75:	53                   	push   %ebx
+  800a76:	6a 30                	push   $0x30
+  800a78:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800a7a:	83 c4 08             	add    $0x8,%esp
+  800a7d:	53                   	push   %ebx
+  800a7e:	6a 78                	push   $0x78
+  800a80:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800a82:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a85:	8b 10                	mov    (%eax),%edx
+  800a87:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800a8c:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800a8f:	8d 40 04             	lea    0x4(%eax),%eax
+  800a92:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a95:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800a9a:	83 ec 0c             	sub    $0xc,%esp
+  800a9d:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800aa1:	50                   	push   %eax
+  800aa2:	ff 75 e0             	push   -0x20(%ebp)
+  800aa5:	57                   	push   %edi
+  800aa6:	51                   	push   %ecx
+  800aa7:	52                   	push   %edx
+  800aa8:	89 da                	mov    %ebx,%edx
+  800aaa:	89 f0                	mov    %esi,%eax
+  800aac:	e8 4a fb ff ff       	call   8005fb <printnum>
+			break;
+  800ab1:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800ab4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800ab7:	e9 40 fc ff ff       	jmp    8006fc <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800abc:	83 f9 01             	cmp    $0x1,%ecx
+  800abf:	7f 1b                	jg     800adc <vprintfmt+0x3fe>
+	else if (lflag)
+  800ac1:	85 c9                	test   %ecx,%ecx
+  800ac3:	74 2c                	je     800af1 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800ac5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ac8:	8b 10                	mov    (%eax),%edx
+  800aca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800acf:	8d 40 04             	lea    0x4(%eax),%eax
+  800ad2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ad5:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800ada:	eb be                	jmp    800a9a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800adc:	8b 45 14             	mov    0x14(%ebp),%eax
+  800adf:	8b 10                	mov    (%eax),%edx
+  800ae1:	8b 48 04             	mov    0x4(%eax),%ecx
+  800ae4:	8d 40 08             	lea    0x8(%eax),%eax
+  800ae7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800aea:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800aef:	eb a9                	jmp    800a9a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800af1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800af4:	8b 10                	mov    (%eax),%edx
+  800af6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800afb:	8d 40 04             	lea    0x4(%eax),%eax
+  800afe:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b01:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800b06:	eb 92                	jmp    800a9a <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800b08:	83 ec 08             	sub    $0x8,%esp
+  800b0b:	53                   	push   %ebx
+  800b0c:	6a 25                	push   $0x25
+  800b0e:	ff d6                	call   *%esi
+			break;
+  800b10:	83 c4 10             	add    $0x10,%esp
+  800b13:	eb 9f                	jmp    800ab4 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800b15:	83 ec 08             	sub    $0x8,%esp
+  800b18:	53                   	push   %ebx
+  800b19:	6a 25                	push   $0x25
+  800b1b:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800b1d:	83 c4 10             	add    $0x10,%esp
+  800b20:	89 f8                	mov    %edi,%eax
+  800b22:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800b26:	74 05                	je     800b2d <vprintfmt+0x44f>
+  800b28:	83 e8 01             	sub    $0x1,%eax
+  800b2b:	eb f5                	jmp    800b22 <vprintfmt+0x444>
+  800b2d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800b30:	eb 82                	jmp    800ab4 <vprintfmt+0x3d6>
+
+00800b32 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800b32:	55                   	push   %ebp
+  800b33:	89 e5                	mov    %esp,%ebp
+  800b35:	83 ec 18             	sub    $0x18,%esp
+  800b38:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b3b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800b3e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800b41:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800b45:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800b48:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800b4f:	85 c0                	test   %eax,%eax
+  800b51:	74 26                	je     800b79 <vsnprintf+0x47>
+  800b53:	85 d2                	test   %edx,%edx
+  800b55:	7e 22                	jle    800b79 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800b57:	ff 75 14             	push   0x14(%ebp)
+  800b5a:	ff 75 10             	push   0x10(%ebp)
+  800b5d:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800b60:	50                   	push   %eax
+  800b61:	68 a4 06 80 00       	push   $0x8006a4
+  800b66:	e8 73 fb ff ff       	call   8006de <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800b6b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800b6e:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800b71:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b74:	83 c4 10             	add    $0x10,%esp
+}
+  800b77:	c9                   	leave
+  800b78:	c3                   	ret
+		return -E_INVAL;
+  800b79:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b7e:	eb f7                	jmp    800b77 <vsnprintf+0x45>
+
+00800b80 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b80:	55                   	push   %ebp
+  800b81:	89 e5                	mov    %esp,%ebp
+  800b83:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800b86:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800b89:	50                   	push   %eax
+  800b8a:	ff 75 10             	push   0x10(%ebp)
+  800b8d:	ff 75 0c             	push   0xc(%ebp)
+  800b90:	ff 75 08             	push   0x8(%ebp)
+  800b93:	e8 9a ff ff ff       	call   800b32 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800b98:	c9                   	leave
+  800b99:	c3                   	ret
+
+00800b9a <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800b9a:	55                   	push   %ebp
+  800b9b:	89 e5                	mov    %esp,%ebp
+  800b9d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800ba0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba5:	eb 03                	jmp    800baa <strlen+0x10>
+		n++;
+  800ba7:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800baa:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800bae:	75 f7                	jne    800ba7 <strlen+0xd>
+	return n;
+}
+  800bb0:	5d                   	pop    %ebp
+  800bb1:	c3                   	ret
+
+00800bb2 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800bb2:	55                   	push   %ebp
+  800bb3:	89 e5                	mov    %esp,%ebp
+  800bb5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bb8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc0:	eb 03                	jmp    800bc5 <strnlen+0x13>
+		n++;
+  800bc2:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bc5:	39 d0                	cmp    %edx,%eax
+  800bc7:	74 08                	je     800bd1 <strnlen+0x1f>
+  800bc9:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800bcd:	75 f3                	jne    800bc2 <strnlen+0x10>
+  800bcf:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800bd1:	89 d0                	mov    %edx,%eax
+  800bd3:	5d                   	pop    %ebp
+  800bd4:	c3                   	ret
+
+00800bd5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800bd5:	55                   	push   %ebp
+  800bd6:	89 e5                	mov    %esp,%ebp
+  800bd8:	53                   	push   %ebx
+  800bd9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bdc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800bdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be4:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800be8:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800beb:	83 c0 01             	add    $0x1,%eax
+  800bee:	84 d2                	test   %dl,%dl
+  800bf0:	75 f2                	jne    800be4 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800bf2:	89 c8                	mov    %ecx,%eax
+  800bf4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bf7:	c9                   	leave
+  800bf8:	c3                   	ret
+
+00800bf9 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800bf9:	55                   	push   %ebp
+  800bfa:	89 e5                	mov    %esp,%ebp
+  800bfc:	53                   	push   %ebx
+  800bfd:	83 ec 10             	sub    $0x10,%esp
+  800c00:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800c03:	53                   	push   %ebx
+  800c04:	e8 91 ff ff ff       	call   800b9a <strlen>
+  800c09:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800c0c:	ff 75 0c             	push   0xc(%ebp)
+  800c0f:	01 d8                	add    %ebx,%eax
+  800c11:	50                   	push   %eax
+  800c12:	e8 be ff ff ff       	call   800bd5 <strcpy>
+	return dst;
+}
+  800c17:	89 d8                	mov    %ebx,%eax
+  800c19:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c1c:	c9                   	leave
+  800c1d:	c3                   	ret
+
+00800c1e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c1e:	55                   	push   %ebp
+  800c1f:	89 e5                	mov    %esp,%ebp
+  800c21:	56                   	push   %esi
+  800c22:	53                   	push   %ebx
+  800c23:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c26:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800c29:	89 f3                	mov    %esi,%ebx
+  800c2b:	03 5d 10             	add    0x10(%ebp),%ebx
+  800c2e:	89 f0                	mov    %esi,%eax
+  800c30:	eb 0f                	jmp    800c41 <strncpy+0x23>
+		*dst++ = *src;
+  800c32:	83 c0 01             	add    $0x1,%eax
+  800c35:	0f b6 0a             	movzbl (%edx),%ecx
+  800c38:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800c3b:	80 f9 01             	cmp    $0x1,%cl
+  800c3e:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800c41:	39 d8                	cmp    %ebx,%eax
+  800c43:	75 ed                	jne    800c32 <strncpy+0x14>
+	}
+	return ret;
+}
+  800c45:	89 f0                	mov    %esi,%eax
+  800c47:	5b                   	pop    %ebx
+  800c48:	5e                   	pop    %esi
+  800c49:	5d                   	pop    %ebp
+  800c4a:	c3                   	ret
+
+00800c4b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800c4b:	55                   	push   %ebp
+  800c4c:	89 e5                	mov    %esp,%ebp
+  800c4e:	56                   	push   %esi
+  800c4f:	53                   	push   %ebx
+  800c50:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c53:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c56:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800c59:	89 f0                	mov    %esi,%eax
+  800c5b:	85 d2                	test   %edx,%edx
+  800c5d:	74 21                	je     800c80 <strlcpy+0x35>
+  800c5f:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800c63:	89 f2                	mov    %esi,%edx
+  800c65:	eb 09                	jmp    800c70 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800c67:	83 c1 01             	add    $0x1,%ecx
+  800c6a:	83 c2 01             	add    $0x1,%edx
+  800c6d:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800c70:	39 c2                	cmp    %eax,%edx
+  800c72:	74 09                	je     800c7d <strlcpy+0x32>
+  800c74:	0f b6 19             	movzbl (%ecx),%ebx
+  800c77:	84 db                	test   %bl,%bl
+  800c79:	75 ec                	jne    800c67 <strlcpy+0x1c>
+  800c7b:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800c7d:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800c80:	29 f0                	sub    %esi,%eax
+}
+  800c82:	5b                   	pop    %ebx
+  800c83:	5e                   	pop    %esi
+  800c84:	5d                   	pop    %ebp
+  800c85:	c3                   	ret
+
+00800c86 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800c86:	55                   	push   %ebp
+  800c87:	89 e5                	mov    %esp,%ebp
+  800c89:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c8c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800c8f:	eb 06                	jmp    800c97 <strcmp+0x11>
+		p++, q++;
+  800c91:	83 c1 01             	add    $0x1,%ecx
+  800c94:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800c97:	0f b6 01             	movzbl (%ecx),%eax
+  800c9a:	84 c0                	test   %al,%al
+  800c9c:	74 04                	je     800ca2 <strcmp+0x1c>
+  800c9e:	3a 02                	cmp    (%edx),%al
+  800ca0:	74 ef                	je     800c91 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ca2:	0f b6 c0             	movzbl %al,%eax
+  800ca5:	0f b6 12             	movzbl (%edx),%edx
+  800ca8:	29 d0                	sub    %edx,%eax
+}
+  800caa:	5d                   	pop    %ebp
+  800cab:	c3                   	ret
+
+00800cac <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800cac:	55                   	push   %ebp
+  800cad:	89 e5                	mov    %esp,%ebp
+  800caf:	53                   	push   %ebx
+  800cb0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cb3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cb6:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800cb9:	eb 09                	jmp    800cc4 <strncmp+0x18>
+		n--, p++, q++;
+  800cbb:	83 ea 01             	sub    $0x1,%edx
+  800cbe:	83 c0 01             	add    $0x1,%eax
+  800cc1:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800cc4:	85 d2                	test   %edx,%edx
+  800cc6:	74 18                	je     800ce0 <strncmp+0x34>
+  800cc8:	0f b6 18             	movzbl (%eax),%ebx
+  800ccb:	84 db                	test   %bl,%bl
+  800ccd:	74 04                	je     800cd3 <strncmp+0x27>
+  800ccf:	3a 19                	cmp    (%ecx),%bl
+  800cd1:	74 e8                	je     800cbb <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800cd3:	0f b6 00             	movzbl (%eax),%eax
+  800cd6:	0f b6 11             	movzbl (%ecx),%edx
+  800cd9:	29 d0                	sub    %edx,%eax
+}
+  800cdb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cde:	c9                   	leave
+  800cdf:	c3                   	ret
+		return 0;
+  800ce0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce5:	eb f4                	jmp    800cdb <strncmp+0x2f>
+
+00800ce7 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800ce7:	55                   	push   %ebp
+  800ce8:	89 e5                	mov    %esp,%ebp
+  800cea:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ced:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800cf1:	eb 03                	jmp    800cf6 <strchr+0xf>
+  800cf3:	83 c0 01             	add    $0x1,%eax
+  800cf6:	0f b6 10             	movzbl (%eax),%edx
+  800cf9:	84 d2                	test   %dl,%dl
+  800cfb:	74 06                	je     800d03 <strchr+0x1c>
+		if (*s == c)
+  800cfd:	38 ca                	cmp    %cl,%dl
+  800cff:	75 f2                	jne    800cf3 <strchr+0xc>
+  800d01:	eb 05                	jmp    800d08 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800d03:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d08:	5d                   	pop    %ebp
+  800d09:	c3                   	ret
+
+00800d0a <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800d0a:	55                   	push   %ebp
+  800d0b:	89 e5                	mov    %esp,%ebp
+  800d0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d10:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800d14:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800d17:	38 ca                	cmp    %cl,%dl
+  800d19:	74 09                	je     800d24 <strfind+0x1a>
+  800d1b:	84 d2                	test   %dl,%dl
+  800d1d:	74 05                	je     800d24 <strfind+0x1a>
+	for (; *s; s++)
+  800d1f:	83 c0 01             	add    $0x1,%eax
+  800d22:	eb f0                	jmp    800d14 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800d24:	5d                   	pop    %ebp
+  800d25:	c3                   	ret
+
+00800d26 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800d26:	55                   	push   %ebp
+  800d27:	89 e5                	mov    %esp,%ebp
+  800d29:	57                   	push   %edi
+  800d2a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800d2d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800d30:	85 c9                	test   %ecx,%ecx
+  800d32:	74 20                	je     800d54 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800d34:	89 f8                	mov    %edi,%eax
+  800d36:	09 c8                	or     %ecx,%eax
+  800d38:	a8 03                	test   $0x3,%al
+  800d3a:	75 12                	jne    800d4e <memset+0x28>
+		c &= 0xFF;
+  800d3c:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800d40:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800d46:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800d49:	fc                   	cld
+  800d4a:	f3 ab                	rep stos %eax,%es:(%edi)
+  800d4c:	eb 06                	jmp    800d54 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800d4e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d51:	fc                   	cld
+  800d52:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800d54:	89 f8                	mov    %edi,%eax
+  800d56:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d59:	c9                   	leave
+  800d5a:	c3                   	ret
+
+00800d5b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d5b:	55                   	push   %ebp
+  800d5c:	89 e5                	mov    %esp,%ebp
+  800d5e:	57                   	push   %edi
+  800d5f:	56                   	push   %esi
+  800d60:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d63:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d66:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d69:	39 c6                	cmp    %eax,%esi
+  800d6b:	73 32                	jae    800d9f <memmove+0x44>
+  800d6d:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d70:	39 d0                	cmp    %edx,%eax
+  800d72:	73 2b                	jae    800d9f <memmove+0x44>
+		s += n;
+		d += n;
+  800d74:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d77:	89 d6                	mov    %edx,%esi
+  800d79:	09 fe                	or     %edi,%esi
+  800d7b:	09 ce                	or     %ecx,%esi
+  800d7d:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800d83:	75 0e                	jne    800d93 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d85:	83 ef 04             	sub    $0x4,%edi
+  800d88:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800d8b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800d8e:	fd                   	std
+  800d8f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d91:	eb 09                	jmp    800d9c <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800d93:	83 ef 01             	sub    $0x1,%edi
+  800d96:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800d99:	fd                   	std
+  800d9a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800d9c:	fc                   	cld
+  800d9d:	eb 1a                	jmp    800db9 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d9f:	89 f2                	mov    %esi,%edx
+  800da1:	09 c2                	or     %eax,%edx
+  800da3:	09 ca                	or     %ecx,%edx
+  800da5:	f6 c2 03             	test   $0x3,%dl
+  800da8:	75 0a                	jne    800db4 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800daa:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800dad:	89 c7                	mov    %eax,%edi
+  800daf:	fc                   	cld
+  800db0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800db2:	eb 05                	jmp    800db9 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800db4:	89 c7                	mov    %eax,%edi
+  800db6:	fc                   	cld
+  800db7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800db9:	5e                   	pop    %esi
+  800dba:	5f                   	pop    %edi
+  800dbb:	5d                   	pop    %ebp
+  800dbc:	c3                   	ret
+
+00800dbd <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800dbd:	55                   	push   %ebp
+  800dbe:	89 e5                	mov    %esp,%ebp
+  800dc0:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800dc3:	ff 75 10             	push   0x10(%ebp)
+  800dc6:	ff 75 0c             	push   0xc(%ebp)
+  800dc9:	ff 75 08             	push   0x8(%ebp)
+  800dcc:	e8 8a ff ff ff       	call   800d5b <memmove>
+}
+  800dd1:	c9                   	leave
+  800dd2:	c3                   	ret
+
+00800dd3 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800dd3:	55                   	push   %ebp
+  800dd4:	89 e5                	mov    %esp,%ebp
+  800dd6:	56                   	push   %esi
+  800dd7:	53                   	push   %ebx
+  800dd8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ddb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800dde:	89 c6                	mov    %eax,%esi
+  800de0:	03 75 10             	add    0x10(%ebp),%esi
+  800de3:	eb 06                	jmp    800deb <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800de5:	83 c0 01             	add    $0x1,%eax
+  800de8:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800deb:	39 f0                	cmp    %esi,%eax
+  800ded:	74 14                	je     800e03 <memcmp+0x30>
+		if (*s1 != *s2)
+  800def:	0f b6 08             	movzbl (%eax),%ecx
+  800df2:	0f b6 1a             	movzbl (%edx),%ebx
+  800df5:	38 d9                	cmp    %bl,%cl
+  800df7:	74 ec                	je     800de5 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800df9:	0f b6 c1             	movzbl %cl,%eax
+  800dfc:	0f b6 db             	movzbl %bl,%ebx
+  800dff:	29 d8                	sub    %ebx,%eax
+  800e01:	eb 05                	jmp    800e08 <memcmp+0x35>
+	}
+
+	return 0;
+  800e03:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e08:	5b                   	pop    %ebx
+  800e09:	5e                   	pop    %esi
+  800e0a:	5d                   	pop    %ebp
+  800e0b:	c3                   	ret
+
+00800e0c <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800e0c:	55                   	push   %ebp
+  800e0d:	89 e5                	mov    %esp,%ebp
+  800e0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e12:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800e15:	89 c2                	mov    %eax,%edx
+  800e17:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800e1a:	eb 03                	jmp    800e1f <memfind+0x13>
+  800e1c:	83 c0 01             	add    $0x1,%eax
+  800e1f:	39 d0                	cmp    %edx,%eax
+  800e21:	73 04                	jae    800e27 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800e23:	38 08                	cmp    %cl,(%eax)
+  800e25:	75 f5                	jne    800e1c <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800e27:	5d                   	pop    %ebp
+  800e28:	c3                   	ret
+
+00800e29 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800e29:	55                   	push   %ebp
+  800e2a:	89 e5                	mov    %esp,%ebp
+  800e2c:	57                   	push   %edi
+  800e2d:	56                   	push   %esi
+  800e2e:	53                   	push   %ebx
+  800e2f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e32:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800e35:	eb 03                	jmp    800e3a <strtol+0x11>
+		s++;
+  800e37:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800e3a:	0f b6 02             	movzbl (%edx),%eax
+  800e3d:	3c 20                	cmp    $0x20,%al
+  800e3f:	74 f6                	je     800e37 <strtol+0xe>
+  800e41:	3c 09                	cmp    $0x9,%al
+  800e43:	74 f2                	je     800e37 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e45:	3c 2b                	cmp    $0x2b,%al
+  800e47:	74 2a                	je     800e73 <strtol+0x4a>
+	int neg = 0;
+  800e49:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800e4e:	3c 2d                	cmp    $0x2d,%al
+  800e50:	74 2b                	je     800e7d <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e52:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800e58:	75 0f                	jne    800e69 <strtol+0x40>
+  800e5a:	80 3a 30             	cmpb   $0x30,(%edx)
+  800e5d:	74 28                	je     800e87 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e5f:	85 db                	test   %ebx,%ebx
+  800e61:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e66:	0f 44 d8             	cmove  %eax,%ebx
+  800e69:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e6e:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800e71:	eb 46                	jmp    800eb9 <strtol+0x90>
+		s++;
+  800e73:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800e76:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e7b:	eb d5                	jmp    800e52 <strtol+0x29>
+		s++, neg = 1;
+  800e7d:	83 c2 01             	add    $0x1,%edx
+  800e80:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e85:	eb cb                	jmp    800e52 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e87:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800e8b:	74 0e                	je     800e9b <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800e8d:	85 db                	test   %ebx,%ebx
+  800e8f:	75 d8                	jne    800e69 <strtol+0x40>
+		s++, base = 8;
+  800e91:	83 c2 01             	add    $0x1,%edx
+  800e94:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800e99:	eb ce                	jmp    800e69 <strtol+0x40>
+		s += 2, base = 16;
+  800e9b:	83 c2 02             	add    $0x2,%edx
+  800e9e:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ea3:	eb c4                	jmp    800e69 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ea5:	0f be c0             	movsbl %al,%eax
+  800ea8:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800eab:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800eae:	7d 3a                	jge    800eea <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800eb0:	83 c2 01             	add    $0x1,%edx
+  800eb3:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800eb7:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800eb9:	0f b6 02             	movzbl (%edx),%eax
+  800ebc:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ebf:	89 f3                	mov    %esi,%ebx
+  800ec1:	80 fb 09             	cmp    $0x9,%bl
+  800ec4:	76 df                	jbe    800ea5 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ec6:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ec9:	89 f3                	mov    %esi,%ebx
+  800ecb:	80 fb 19             	cmp    $0x19,%bl
+  800ece:	77 08                	ja     800ed8 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800ed0:	0f be c0             	movsbl %al,%eax
+  800ed3:	83 e8 57             	sub    $0x57,%eax
+  800ed6:	eb d3                	jmp    800eab <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ed8:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800edb:	89 f3                	mov    %esi,%ebx
+  800edd:	80 fb 19             	cmp    $0x19,%bl
+  800ee0:	77 08                	ja     800eea <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800ee2:	0f be c0             	movsbl %al,%eax
+  800ee5:	83 e8 37             	sub    $0x37,%eax
+  800ee8:	eb c1                	jmp    800eab <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800eea:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800eee:	74 05                	je     800ef5 <strtol+0xcc>
+		*endptr = (char *) s;
+  800ef0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ef3:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ef5:	89 c8                	mov    %ecx,%eax
+  800ef7:	f7 d8                	neg    %eax
+  800ef9:	85 ff                	test   %edi,%edi
+  800efb:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800efe:	89 c8                	mov    %ecx,%eax
+  800f00:	5b                   	pop    %ebx
+  800f01:	5e                   	pop    %esi
+  800f02:	5f                   	pop    %edi
+  800f03:	5d                   	pop    %ebp
+  800f04:	c3                   	ret
+
+00800f05 <atoi>:
+
+int
+atoi(const char *s)
+{
+  800f05:	55                   	push   %ebp
+  800f06:	89 e5                	mov    %esp,%ebp
+  800f08:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800f0b:	6a 0a                	push   $0xa
+  800f0d:	6a 00                	push   $0x0
+  800f0f:	ff 75 08             	push   0x8(%ebp)
+  800f12:	e8 12 ff ff ff       	call   800e29 <strtol>
+}
+  800f17:	c9                   	leave
+  800f18:	c3                   	ret
+
+00800f19 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800f19:	55                   	push   %ebp
+  800f1a:	89 e5                	mov    %esp,%ebp
+  800f1c:	57                   	push   %edi
+  800f1d:	56                   	push   %esi
+  800f1e:	53                   	push   %ebx
+  800f1f:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800f25:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800f2b:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800f31:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800f37:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800f3e:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800f41:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800f48:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800f4b:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800f52:	74 76                	je     800fca <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800f54:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800f5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f5d:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800f63:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800f6a:	0f 88 06 01 00 00    	js     801076 <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800f70:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800f77:	0f 84 48 01 00 00    	je     8010c5 <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800f7d:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800f83:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800f89:	be 00 00 00 00       	mov    $0x0,%esi
+  800f8e:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800f94:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800f97:	55                   	push   %ebp
+  800f98:	68 a1 0f 80 00       	push   $0x800fa1
+  800f9d:	89 e5                	mov    %esp,%ebp
+  800f9f:	0f 34                	sysenter
+  800fa1:	83 c4 04             	add    $0x4,%esp
+  800fa4:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800fa5:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800fab:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800fb1:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800fb4:	0f 85 9a 01 00 00    	jne    801154 <page_vec_call+0x23b>
+  800fba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fbf:	8b 75 08             	mov    0x8(%ebp),%esi
+  800fc2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800fc5:	e9 29 01 00 00       	jmp    8010f3 <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800fca:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800fd0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fd3:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800fd5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800fdc:	78 2f                	js     80100d <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800fde:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800fe5:	74 72                	je     801059 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800fe7:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800fed:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800ff3:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ff8:	89 fb                	mov    %edi,%ebx
+  800ffa:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800ffd:	55                   	push   %ebp
+  800ffe:	68 07 10 80 00       	push   $0x801007
+  801003:	89 e5                	mov    %esp,%ebp
+  801005:	0f 34                	sysenter
+  801007:	83 c4 04             	add    $0x4,%esp
+  80100a:	5d                   	pop    %ebp
+	return ret;
+  80100b:	eb 98                	jmp    800fa5 <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  80100d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801012:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  801014:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801019:	f6 c6 08             	test   $0x8,%dh
+  80101c:	74 15                	je     801033 <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80101e:	89 c2                	mov    %eax,%edx
+  801020:	c1 ea 08             	shr    $0x8,%edx
+  801023:	83 e2 0f             	and    $0xf,%edx
+  801026:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80102b:	83 fa 06             	cmp    $0x6,%edx
+  80102e:	74 0e                	je     80103e <page_vec_call+0x125>
+  801030:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801033:	0f b6 c9             	movzbl %cl,%ecx
+  801036:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80103c:	eb a0                	jmp    800fde <page_vec_call+0xc5>
+  80103e:	89 c2                	mov    %eax,%edx
+  801040:	c1 ea 04             	shr    $0x4,%edx
+  801043:	83 e2 0f             	and    $0xf,%edx
+  801046:	83 fa 02             	cmp    $0x2,%edx
+  801049:	77 e5                	ja     801030 <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  80104b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80104e:	83 f8 02             	cmp    $0x2,%eax
+  801051:	0f 97 c1             	seta   %cl
+  801054:	0f b6 c9             	movzbl %cl,%ecx
+  801057:	eb d7                	jmp    801030 <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  801059:	b8 10 00 00 00       	mov    $0x10,%eax
+  80105e:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  801064:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  80106a:	89 fb                	mov    %edi,%ebx
+  80106c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80106f:	cd 30                	int    $0x30
+  801071:	e9 2f ff ff ff       	jmp    800fa5 <page_vec_call+0x8c>
+  801076:	b8 01 00 00 00       	mov    $0x1,%eax
+  80107b:	0f a2                	cpuid
+		return 0;
+  80107d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801082:	f6 c6 08             	test   $0x8,%dh
+  801085:	74 15                	je     80109c <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801087:	89 c2                	mov    %eax,%edx
+  801089:	c1 ea 08             	shr    $0x8,%edx
+  80108c:	83 e2 0f             	and    $0xf,%edx
+  80108f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801094:	83 fa 06             	cmp    $0x6,%edx
+  801097:	74 11                	je     8010aa <page_vec_call+0x191>
+  801099:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80109c:	0f b6 c9             	movzbl %cl,%ecx
+  80109f:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8010a5:	e9 c6 fe ff ff       	jmp    800f70 <page_vec_call+0x57>
+  8010aa:	89 c2                	mov    %eax,%edx
+  8010ac:	c1 ea 04             	shr    $0x4,%edx
+  8010af:	83 e2 0f             	and    $0xf,%edx
+  8010b2:	83 fa 02             	cmp    $0x2,%edx
+  8010b5:	77 e2                	ja     801099 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  8010b7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010ba:	83 f8 02             	cmp    $0x2,%eax
+  8010bd:	0f 97 c1             	seta   %cl
+  8010c0:	0f b6 c9             	movzbl %cl,%ecx
+  8010c3:	eb d4                	jmp    801099 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  8010c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ca:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  8010d0:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  8010d6:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  8010dc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8010df:	cd 30                	int    $0x30
+  8010e1:	e9 bf fe ff ff       	jmp    800fa5 <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  8010e6:	29 da                	sub    %ebx,%edx
+			vec++;
+  8010e8:	83 c6 10             	add    $0x10,%esi
+			n--;
+  8010eb:	83 e8 01             	sub    $0x1,%eax
+  8010ee:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  8010f3:	85 c0                	test   %eax,%eax
+  8010f5:	74 58                	je     80114f <page_vec_call+0x236>
+  8010f7:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8010fa:	39 da                	cmp    %ebx,%edx
+  8010fc:	73 e8                	jae    8010e6 <page_vec_call+0x1cd>
+  8010fe:	89 75 08             	mov    %esi,0x8(%ebp)
+  801101:	89 45 0c             	mov    %eax,0xc(%ebp)
+  801104:	84 c9                	test   %cl,%cl
+  801106:	74 06                	je     80110e <page_vec_call+0x1f5>
+  801108:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  80110e:	83 ec 04             	sub    $0x4,%esp
+  801111:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801114:	c1 e0 04             	shl    $0x4,%eax
+  801117:	50                   	push   %eax
+  801118:	ff 75 08             	push   0x8(%ebp)
+  80111b:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  801121:	53                   	push   %ebx
+  801122:	e8 34 fc ff ff       	call   800d5b <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  801127:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  80112d:	89 c2                	mov    %eax,%edx
+  80112f:	c1 e2 0c             	shl    $0xc,%edx
+  801132:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  801138:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  80113e:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  801144:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  801147:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  80114a:	e9 f2 fd ff ff       	jmp    800f41 <page_vec_call+0x28>
+			r = 0;
+  80114f:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  801154:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801158:	74 0b                	je     801165 <page_vec_call+0x24c>
+		*done = total;
+  80115a:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80115d:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  801163:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  801165:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801168:	5b                   	pop    %ebx
+  801169:	5e                   	pop    %esi
+  80116a:	5f                   	pop    %edi
+  80116b:	5d                   	pop    %ebp
+  80116c:	c3                   	ret
+
+0080116d <sys_cputs>:
+{
+  80116d:	55                   	push   %ebp
+  80116e:	89 e5                	mov    %esp,%ebp
+  801170:	57                   	push   %edi
+  801171:	56                   	push   %esi
+  801172:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801173:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80117a:	78 2d                	js     8011a9 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  80117c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801183:	74 70                	je     8011f5 <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  801185:	b8 00 00 00 00       	mov    $0x0,%eax
+  80118a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801190:	89 c3                	mov    %eax,%ebx
+  801192:	89 c7                	mov    %eax,%edi
+  801194:	89 c6                	mov    %eax,%esi
+  801196:	55                   	push   %ebp
+  801197:	68 a0 11 80 00       	push   $0x8011a0
+  80119c:	89 e5                	mov    %esp,%ebp
+  80119e:	0f 34                	sysenter
+  8011a0:	83 c4 04             	add    $0x4,%esp
+  8011a3:	5d                   	pop    %ebp
+}
+  8011a4:	5b                   	pop    %ebx
+  8011a5:	5e                   	pop    %esi
+  8011a6:	5f                   	pop    %edi
+  8011a7:	5d                   	pop    %ebp
+  8011a8:	c3                   	ret
+  8011a9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011ae:	0f a2                	cpuid
+		return 0;
+  8011b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8011b5:	f6 c6 08             	test   $0x8,%dh
+  8011b8:	74 15                	je     8011cf <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011ba:	89 c2                	mov    %eax,%edx
+  8011bc:	c1 ea 08             	shr    $0x8,%edx
+  8011bf:	83 e2 0f             	and    $0xf,%edx
+  8011c2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011c7:	83 fa 06             	cmp    $0x6,%edx
+  8011ca:	74 0e                	je     8011da <sys_cputs+0x6d>
+  8011cc:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8011cf:	0f b6 c9             	movzbl %cl,%ecx
+  8011d2:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8011d8:	eb a2                	jmp    80117c <sys_cputs+0xf>
+  8011da:	89 c2                	mov    %eax,%edx
+  8011dc:	c1 ea 04             	shr    $0x4,%edx
+  8011df:	83 e2 0f             	and    $0xf,%edx
+  8011e2:	83 fa 02             	cmp    $0x2,%edx
+  8011e5:	77 e5                	ja     8011cc <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  8011e7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011ea:	83 f8 02             	cmp    $0x2,%eax
+  8011ed:	0f 97 c1             	seta   %cl
+  8011f0:	0f b6 c9             	movzbl %cl,%ecx
+  8011f3:	eb d7                	jmp    8011cc <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  8011f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801200:	89 c3                	mov    %eax,%ebx
+  801202:	89 c7                	mov    %eax,%edi
+  801204:	89 c6                	mov    %eax,%esi
+  801206:	cd 30                	int    $0x30
+}
+  801208:	eb 9a                	jmp    8011a4 <sys_cputs+0x37>
+
+0080120a <sys_cgetc>:
+{
+  80120a:	55                   	push   %ebp
+  80120b:	89 e5                	mov    %esp,%ebp
+  80120d:	57                   	push   %edi
+  80120e:	56                   	push   %esi
+  80120f:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801210:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801217:	78 2e                	js     801247 <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  801219:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801220:	74 71                	je     801293 <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  801222:	ba 00 00 00 00       	mov    $0x0,%edx
+  801227:	b8 01 00 00 00       	mov    $0x1,%eax
+  80122c:	89 d1                	mov    %edx,%ecx
+  80122e:	89 d3                	mov    %edx,%ebx
+  801230:	89 d7                	mov    %edx,%edi
+  801232:	89 d6                	mov    %edx,%esi
+  801234:	55                   	push   %ebp
+  801235:	68 3e 12 80 00       	push   $0x80123e
+  80123a:	89 e5                	mov    %esp,%ebp
+  80123c:	0f 34                	sysenter
+  80123e:	83 c4 04             	add    $0x4,%esp
+  801241:	5d                   	pop    %ebp
+}
+  801242:	5b                   	pop    %ebx
+  801243:	5e                   	pop    %esi
+  801244:	5f                   	pop    %edi
+  801245:	5d                   	pop    %ebp
+  801246:	c3                   	ret
+  801247:	b8 01 00 00 00       	mov    $0x1,%eax
+  80124c:	0f a2                	cpuid
+		return 0;
+  80124e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801253:	f6 c6 08             	test   $0x8,%dh
+  801256:	74 15                	je     80126d <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801258:	89 c2                	mov    %eax,%edx
+  80125a:	c1 ea 08             	shr    $0x8,%edx
+  80125d:	83 e2 0f             	and    $0xf,%edx
+  801260:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801265:	83 fa 06             	cmp    $0x6,%edx
+  801268:	74 0e                	je     801278 <sys_cgetc+0x6e>
+  80126a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80126d:	0f b6 c9             	movzbl %cl,%ecx
+  801270:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801276:	eb a1                	jmp    801219 <sys_cgetc+0xf>
+  801278:	89 c2                	mov    %eax,%edx
+  80127a:	c1 ea 04             	shr    $0x4,%edx
+  80127d:	83 e2 0f             	and    $0xf,%edx
+  801280:	83 fa 02             	cmp    $0x2,%edx
+  801283:	77 e5                	ja     80126a <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  801285:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801288:	83 f8 02             	cmp    $0x2,%eax
+  80128b:	0f 97 c1             	seta   %cl
+  80128e:	0f b6 c9             	movzbl %cl,%ecx
+  801291:	eb d7                	jmp    80126a <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  801293:	ba 00 00 00 00       	mov    $0x0,%edx
+  801298:	b8 01 00 00 00       	mov    $0x1,%eax
+  80129d:	89 d1                	mov    %edx,%ecx
+  80129f:	89 d3                	mov    %edx,%ebx
+  8012a1:	89 d7                	mov    %edx,%edi
+  8012a3:	89 d6                	mov    %edx,%esi
+  8012a5:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8012a7:	eb 99                	jmp    801242 <sys_cgetc+0x38>
+
+008012a9 <sys_env_destroy>:
+{
+  8012a9:	55                   	push   %ebp
+  8012aa:	89 e5                	mov    %esp,%ebp
+  8012ac:	57                   	push   %edi
+  8012ad:	56                   	push   %esi
+  8012ae:	53                   	push   %ebx
+  8012af:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8012b2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8012b9:	78 36                	js     8012f1 <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  8012bb:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8012c2:	74 79                	je     80133d <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  8012c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012cc:	b8 03 00 00 00       	mov    $0x3,%eax
+  8012d1:	89 cb                	mov    %ecx,%ebx
+  8012d3:	89 cf                	mov    %ecx,%edi
+  8012d5:	89 ce                	mov    %ecx,%esi
+  8012d7:	55                   	push   %ebp
+  8012d8:	68 e1 12 80 00       	push   $0x8012e1
+  8012dd:	89 e5                	mov    %esp,%ebp
+  8012df:	0f 34                	sysenter
+  8012e1:	83 c4 04             	add    $0x4,%esp
+  8012e4:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8012e5:	85 c0                	test   %eax,%eax
+  8012e7:	7f 6b                	jg     801354 <sys_env_destroy+0xab>
+}
+  8012e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ec:	5b                   	pop    %ebx
+  8012ed:	5e                   	pop    %esi
+  8012ee:	5f                   	pop    %edi
+  8012ef:	5d                   	pop    %ebp
+  8012f0:	c3                   	ret
+  8012f1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012f6:	0f a2                	cpuid
+		return 0;
+  8012f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8012fd:	f6 c6 08             	test   $0x8,%dh
+  801300:	74 15                	je     801317 <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801302:	89 c2                	mov    %eax,%edx
+  801304:	c1 ea 08             	shr    $0x8,%edx
+  801307:	83 e2 0f             	and    $0xf,%edx
+  80130a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80130f:	83 fa 06             	cmp    $0x6,%edx
+  801312:	74 0e                	je     801322 <sys_env_destroy+0x79>
+  801314:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801317:	0f b6 c9             	movzbl %cl,%ecx
+  80131a:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801320:	eb 99                	jmp    8012bb <sys_env_destroy+0x12>
+  801322:	89 c2                	mov    %eax,%edx
+  801324:	c1 ea 04             	shr    $0x4,%edx
+  801327:	83 e2 0f             	and    $0xf,%edx
+  80132a:	83 fa 02             	cmp    $0x2,%edx
+  80132d:	77 e5                	ja     801314 <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  80132f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801332:	83 f8 02             	cmp    $0x2,%eax
+  801335:	0f 97 c1             	seta   %cl
+  801338:	0f b6 c9             	movzbl %cl,%ecx
+  80133b:	eb d7                	jmp    801314 <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  80133d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801342:	b8 03 00 00 00       	mov    $0x3,%eax
+  801347:	8b 55 08             	mov    0x8(%ebp),%edx
+  80134a:	89 cb                	mov    %ecx,%ebx
+  80134c:	89 cf                	mov    %ecx,%edi
+  80134e:	89 ce                	mov    %ecx,%esi
+  801350:	cd 30                	int    $0x30
+  801352:	eb 91                	jmp    8012e5 <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801354:	83 ec 0c             	sub    $0xc,%esp
+  801357:	50                   	push   %eax
+  801358:	6a 03                	push   $0x3
+  80135a:	68 79 30 80 00       	push   $0x803079
+  80135f:	6a 4a                	push   $0x4a
+  801361:	68 96 30 80 00       	push   $0x803096
+  801366:	e8 68 f1 ff ff       	call   8004d3 <_panic>
+
+0080136b <sys_getenvid>:
+{
+  80136b:	55                   	push   %ebp
+  80136c:	89 e5                	mov    %esp,%ebp
+  80136e:	57                   	push   %edi
+  80136f:	56                   	push   %esi
+  801370:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801371:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801378:	78 2e                	js     8013a8 <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  80137a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801381:	74 71                	je     8013f4 <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  801383:	ba 00 00 00 00       	mov    $0x0,%edx
+  801388:	b8 02 00 00 00       	mov    $0x2,%eax
+  80138d:	89 d1                	mov    %edx,%ecx
+  80138f:	89 d3                	mov    %edx,%ebx
+  801391:	89 d7                	mov    %edx,%edi
+  801393:	89 d6                	mov    %edx,%esi
+  801395:	55                   	push   %ebp
+  801396:	68 9f 13 80 00       	push   $0x80139f
+  80139b:	89 e5                	mov    %esp,%ebp
+  80139d:	0f 34                	sysenter
+  80139f:	83 c4 04             	add    $0x4,%esp
+  8013a2:	5d                   	pop    %ebp
+}
+  8013a3:	5b                   	pop    %ebx
+  8013a4:	5e                   	pop    %esi
+  8013a5:	5f                   	pop    %edi
+  8013a6:	5d                   	pop    %ebp
+  8013a7:	c3                   	ret
+  8013a8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013ad:	0f a2                	cpuid
+		return 0;
+  8013af:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8013b4:	f6 c6 08             	test   $0x8,%dh
+  8013b7:	74 15                	je     8013ce <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013b9:	89 c2                	mov    %eax,%edx
+  8013bb:	c1 ea 08             	shr    $0x8,%edx
+  8013be:	83 e2 0f             	and    $0xf,%edx
+  8013c1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8013c6:	83 fa 06             	cmp    $0x6,%edx
+  8013c9:	74 0e                	je     8013d9 <sys_getenvid+0x6e>
+  8013cb:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8013ce:	0f b6 c9             	movzbl %cl,%ecx
+  8013d1:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8013d7:	eb a1                	jmp    80137a <sys_getenvid+0xf>
+  8013d9:	89 c2                	mov    %eax,%edx
+  8013db:	c1 ea 04             	shr    $0x4,%edx
+  8013de:	83 e2 0f             	and    $0xf,%edx
+  8013e1:	83 fa 02             	cmp    $0x2,%edx
+  8013e4:	77 e5                	ja     8013cb <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  8013e6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013e9:	83 f8 02             	cmp    $0x2,%eax
+  8013ec:	0f 97 c1             	seta   %cl
+  8013ef:	0f b6 c9             	movzbl %cl,%ecx
+  8013f2:	eb d7                	jmp    8013cb <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  8013f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013f9:	b8 02 00 00 00       	mov    $0x2,%eax
+  8013fe:	89 d1                	mov    %edx,%ecx
+  801400:	89 d3                	mov    %edx,%ebx
+  801402:	89 d7                	mov    %edx,%edi
+  801404:	89 d6                	mov    %edx,%esi
+  801406:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801408:	eb 99                	jmp    8013a3 <sys_getenvid+0x38>
+
+0080140a <sys_page_alloc>:
+{
+  80140a:	55                   	push   %ebp
+  80140b:	89 e5                	mov    %esp,%ebp
+  80140d:	57                   	push   %edi
+  80140e:	56                   	push   %esi
+  80140f:	53                   	push   %ebx
+  801410:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801413:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80141a:	78 38                	js     801454 <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  80141c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801423:	74 7b                	je     8014a0 <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  801425:	be 00 00 00 00       	mov    $0x0,%esi
+  80142a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80142d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801430:	b8 04 00 00 00       	mov    $0x4,%eax
+  801435:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801438:	89 f7                	mov    %esi,%edi
+  80143a:	55                   	push   %ebp
+  80143b:	68 44 14 80 00       	push   $0x801444
+  801440:	89 e5                	mov    %esp,%ebp
+  801442:	0f 34                	sysenter
+  801444:	83 c4 04             	add    $0x4,%esp
+  801447:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801448:	85 c0                	test   %eax,%eax
+  80144a:	7f 6d                	jg     8014b9 <sys_page_alloc+0xaf>
+}
+  80144c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80144f:	5b                   	pop    %ebx
+  801450:	5e                   	pop    %esi
+  801451:	5f                   	pop    %edi
+  801452:	5d                   	pop    %ebp
+  801453:	c3                   	ret
+  801454:	b8 01 00 00 00       	mov    $0x1,%eax
+  801459:	0f a2                	cpuid
+		return 0;
+  80145b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801460:	f6 c6 08             	test   $0x8,%dh
+  801463:	74 15                	je     80147a <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801465:	89 c2                	mov    %eax,%edx
+  801467:	c1 ea 08             	shr    $0x8,%edx
+  80146a:	83 e2 0f             	and    $0xf,%edx
+  80146d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801472:	83 fa 06             	cmp    $0x6,%edx
+  801475:	74 0e                	je     801485 <sys_page_alloc+0x7b>
+  801477:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80147a:	0f b6 c9             	movzbl %cl,%ecx
+  80147d:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801483:	eb 97                	jmp    80141c <sys_page_alloc+0x12>
+  801485:	89 c2                	mov    %eax,%edx
+  801487:	c1 ea 04             	shr    $0x4,%edx
+  80148a:	83 e2 0f             	and    $0xf,%edx
+  80148d:	83 fa 02             	cmp    $0x2,%edx
+  801490:	77 e5                	ja     801477 <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  801492:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801495:	83 f8 02             	cmp    $0x2,%eax
+  801498:	0f 97 c1             	seta   %cl
+  80149b:	0f b6 c9             	movzbl %cl,%ecx
+  80149e:	eb d7                	jmp    801477 <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  8014a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a5:	b8 04 00 00 00       	mov    $0x4,%eax
+  8014aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014b3:	89 f7                	mov    %esi,%edi
+  8014b5:	cd 30                	int    $0x30
+  8014b7:	eb 8f                	jmp    801448 <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014b9:	83 ec 0c             	sub    $0xc,%esp
+  8014bc:	50                   	push   %eax
+  8014bd:	6a 04                	push   $0x4
+  8014bf:	68 79 30 80 00       	push   $0x803079
+  8014c4:	6a 4a                	push   $0x4a
+  8014c6:	68 96 30 80 00       	push   $0x803096
+  8014cb:	e8 03 f0 ff ff       	call   8004d3 <_panic>
+
+008014d0 <sys_page_map>:
+{
+  8014d0:	55                   	push   %ebp
+  8014d1:	89 e5                	mov    %esp,%ebp
+  8014d3:	57                   	push   %edi
+  8014d4:	56                   	push   %esi
+  8014d5:	53                   	push   %ebx
+  8014d6:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8014d9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8014e0:	78 37                	js     801519 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  8014e2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8014e9:	74 7a                	je     801565 <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  8014eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f1:	b8 05 00 00 00       	mov    $0x5,%eax
+  8014f6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014f9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014fc:	8b 75 18             	mov    0x18(%ebp),%esi
+  8014ff:	55                   	push   %ebp
+  801500:	68 09 15 80 00       	push   $0x801509
+  801505:	89 e5                	mov    %esp,%ebp
+  801507:	0f 34                	sysenter
+  801509:	83 c4 04             	add    $0x4,%esp
+  80150c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80150d:	85 c0                	test   %eax,%eax
+  80150f:	7f 6c                	jg     80157d <sys_page_map+0xad>
+}
+  801511:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801514:	5b                   	pop    %ebx
+  801515:	5e                   	pop    %esi
+  801516:	5f                   	pop    %edi
+  801517:	5d                   	pop    %ebp
+  801518:	c3                   	ret
+  801519:	b8 01 00 00 00       	mov    $0x1,%eax
+  80151e:	0f a2                	cpuid
+		return 0;
+  801520:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801525:	f6 c6 08             	test   $0x8,%dh
+  801528:	74 15                	je     80153f <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80152a:	89 c2                	mov    %eax,%edx
+  80152c:	c1 ea 08             	shr    $0x8,%edx
+  80152f:	83 e2 0f             	and    $0xf,%edx
+  801532:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801537:	83 fa 06             	cmp    $0x6,%edx
+  80153a:	74 0e                	je     80154a <sys_page_map+0x7a>
+  80153c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80153f:	0f b6 c9             	movzbl %cl,%ecx
+  801542:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801548:	eb 98                	jmp    8014e2 <sys_page_map+0x12>
+  80154a:	89 c2                	mov    %eax,%edx
+  80154c:	c1 ea 04             	shr    $0x4,%edx
+  80154f:	83 e2 0f             	and    $0xf,%edx
+  801552:	83 fa 02             	cmp    $0x2,%edx
+  801555:	77 e5                	ja     80153c <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  801557:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80155a:	83 f8 02             	cmp    $0x2,%eax
+  80155d:	0f 97 c1             	seta   %cl
+  801560:	0f b6 c9             	movzbl %cl,%ecx
+  801563:	eb d7                	jmp    80153c <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  801565:	b8 05 00 00 00       	mov    $0x5,%eax
+  80156a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80156d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801570:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801573:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801576:	8b 75 18             	mov    0x18(%ebp),%esi
+  801579:	cd 30                	int    $0x30
+  80157b:	eb 90                	jmp    80150d <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80157d:	83 ec 0c             	sub    $0xc,%esp
+  801580:	50                   	push   %eax
+  801581:	6a 05                	push   $0x5
+  801583:	68 79 30 80 00       	push   $0x803079
+  801588:	6a 4a                	push   $0x4a
+  80158a:	68 96 30 80 00       	push   $0x803096
+  80158f:	e8 3f ef ff ff       	call   8004d3 <_panic>
+
+00801594 <sys_page_unmap>:
+{
+  801594:	55                   	push   %ebp
+  801595:	89 e5                	mov    %esp,%ebp
+  801597:	57                   	push   %edi
+  801598:	56                   	push   %esi
+  801599:	53                   	push   %ebx
+  80159a:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80159d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8015a4:	78 37                	js     8015dd <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  8015a6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8015ad:	74 7a                	je     801629 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  8015af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015ba:	b8 06 00 00 00       	mov    $0x6,%eax
+  8015bf:	89 df                	mov    %ebx,%edi
+  8015c1:	89 de                	mov    %ebx,%esi
+  8015c3:	55                   	push   %ebp
+  8015c4:	68 cd 15 80 00       	push   $0x8015cd
+  8015c9:	89 e5                	mov    %esp,%ebp
+  8015cb:	0f 34                	sysenter
+  8015cd:	83 c4 04             	add    $0x4,%esp
+  8015d0:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8015d1:	85 c0                	test   %eax,%eax
+  8015d3:	7f 6c                	jg     801641 <sys_page_unmap+0xad>
+}
+  8015d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015d8:	5b                   	pop    %ebx
+  8015d9:	5e                   	pop    %esi
+  8015da:	5f                   	pop    %edi
+  8015db:	5d                   	pop    %ebp
+  8015dc:	c3                   	ret
+  8015dd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015e2:	0f a2                	cpuid
+		return 0;
+  8015e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8015e9:	f6 c6 08             	test   $0x8,%dh
+  8015ec:	74 15                	je     801603 <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015ee:	89 c2                	mov    %eax,%edx
+  8015f0:	c1 ea 08             	shr    $0x8,%edx
+  8015f3:	83 e2 0f             	and    $0xf,%edx
+  8015f6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8015fb:	83 fa 06             	cmp    $0x6,%edx
+  8015fe:	74 0e                	je     80160e <sys_page_unmap+0x7a>
+  801600:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801603:	0f b6 c9             	movzbl %cl,%ecx
+  801606:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80160c:	eb 98                	jmp    8015a6 <sys_page_unmap+0x12>
+  80160e:	89 c2                	mov    %eax,%edx
+  801610:	c1 ea 04             	shr    $0x4,%edx
+  801613:	83 e2 0f             	and    $0xf,%edx
+  801616:	83 fa 02             	cmp    $0x2,%edx
+  801619:	77 e5                	ja     801600 <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  80161b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80161e:	83 f8 02             	cmp    $0x2,%eax
+  801621:	0f 97 c1             	seta   %cl
+  801624:	0f b6 c9             	movzbl %cl,%ecx
+  801627:	eb d7                	jmp    801600 <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  801629:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80162e:	b8 06 00 00 00       	mov    $0x6,%eax
+  801633:	8b 55 08             	mov    0x8(%ebp),%edx
+  801636:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801639:	89 df                	mov    %ebx,%edi
+  80163b:	89 de                	mov    %ebx,%esi
+  80163d:	cd 30                	int    $0x30
+  80163f:	eb 90                	jmp    8015d1 <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801641:	83 ec 0c             	sub    $0xc,%esp
+  801644:	50                   	push   %eax
+  801645:	6a 06                	push   $0x6
+  801647:	68 79 30 80 00       	push   $0x803079
+  80164c:	6a 4a                	push   $0x4a
+  80164e:	68 96 30 80 00       	push   $0x803096
+  801653:	e8 7b ee ff ff       	call   8004d3 <_panic>
+
+00801658 <sys_page_copy>:
+{
+  801658:	55                   	push   %ebp
+  801659:	89 e5                	mov    %esp,%ebp
+  80165b:	57                   	push   %edi
+  80165c:	56                   	push   %esi
+  80165d:	53                   	push   %ebx
+  80165e:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801661:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801668:	78 37                	js     8016a1 <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  80166a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801671:	74 7a                	je     8016ed <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  801673:	8b 55 08             	mov    0x8(%ebp),%edx
+  801676:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801679:	b8 29 00 00 00       	mov    $0x29,%eax
+  80167e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801681:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801684:	8b 75 18             	mov    0x18(%ebp),%esi
+  801687:	55                   	push   %ebp
+  801688:	68 91 16 80 00       	push   $0x801691
+  80168d:	89 e5                	mov    %esp,%ebp
+  80168f:	0f 34                	sysenter
+  801691:	83 c4 04             	add    $0x4,%esp
+  801694:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801695:	85 c0                	test   %eax,%eax
+  801697:	7f 6c                	jg     801705 <sys_page_copy+0xad>
+}
+  801699:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80169c:	5b                   	pop    %ebx
+  80169d:	5e                   	pop    %esi
+  80169e:	5f                   	pop    %edi
+  80169f:	5d                   	pop    %ebp
+  8016a0:	c3                   	ret
+  8016a1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016a6:	0f a2                	cpuid
+		return 0;
+  8016a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8016ad:	f6 c6 08             	test   $0x8,%dh
+  8016b0:	74 15                	je     8016c7 <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016b2:	89 c2                	mov    %eax,%edx
+  8016b4:	c1 ea 08             	shr    $0x8,%edx
+  8016b7:	83 e2 0f             	and    $0xf,%edx
+  8016ba:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8016bf:	83 fa 06             	cmp    $0x6,%edx
+  8016c2:	74 0e                	je     8016d2 <sys_page_copy+0x7a>
+  8016c4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8016c7:	0f b6 c9             	movzbl %cl,%ecx
+  8016ca:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8016d0:	eb 98                	jmp    80166a <sys_page_copy+0x12>
+  8016d2:	89 c2                	mov    %eax,%edx
+  8016d4:	c1 ea 04             	shr    $0x4,%edx
+  8016d7:	83 e2 0f             	and    $0xf,%edx
+  8016da:	83 fa 02             	cmp    $0x2,%edx
+  8016dd:	77 e5                	ja     8016c4 <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  8016df:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016e2:	83 f8 02             	cmp    $0x2,%eax
+  8016e5:	0f 97 c1             	seta   %cl
+  8016e8:	0f b6 c9             	movzbl %cl,%ecx
+  8016eb:	eb d7                	jmp    8016c4 <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  8016ed:	b8 29 00 00 00       	mov    $0x29,%eax
+  8016f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016f8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016fb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8016fe:	8b 75 18             	mov    0x18(%ebp),%esi
+  801701:	cd 30                	int    $0x30
+  801703:	eb 90                	jmp    801695 <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801705:	83 ec 0c             	sub    $0xc,%esp
+  801708:	50                   	push   %eax
+  801709:	6a 29                	push   $0x29
+  80170b:	68 79 30 80 00       	push   $0x803079
+  801710:	6a 4a                	push   $0x4a
+  801712:	68 96 30 80 00       	push   $0x803096
+  801717:	e8 b7 ed ff ff       	call   8004d3 <_panic>
+
+0080171c <sys_yield>:
+{
+  80171c:	55                   	push   %ebp
+  80171d:	89 e5                	mov    %esp,%ebp
+  80171f:	57                   	push   %edi
+  801720:	56                   	push   %esi
+  801721:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801722:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801729:	78 2e                	js     801759 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  80172b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801732:	74 71                	je     8017a5 <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  801734:	ba 00 00 00 00       	mov    $0x0,%edx
+  801739:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80173e:	89 d1                	mov    %edx,%ecx
+  801740:	89 d3                	mov    %edx,%ebx
+  801742:	89 d7                	mov    %edx,%edi
+  801744:	89 d6                	mov    %edx,%esi
+  801746:	55                   	push   %ebp
+  801747:	68 50 17 80 00       	push   $0x801750
+  80174c:	89 e5                	mov    %esp,%ebp
+  80174e:	0f 34                	sysenter
+  801750:	83 c4 04             	add    $0x4,%esp
+  801753:	5d                   	pop    %ebp
+}
+  801754:	5b                   	pop    %ebx
+  801755:	5e                   	pop    %esi
+  801756:	5f                   	pop    %edi
+  801757:	5d                   	pop    %ebp
+  801758:	c3                   	ret
+  801759:	b8 01 00 00 00       	mov    $0x1,%eax
+  80175e:	0f a2                	cpuid
+		return 0;
+  801760:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801765:	f6 c6 08             	test   $0x8,%dh
+  801768:	74 15                	je     80177f <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80176a:	89 c2                	mov    %eax,%edx
+  80176c:	c1 ea 08             	shr    $0x8,%edx
+  80176f:	83 e2 0f             	and    $0xf,%edx
+  801772:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801777:	83 fa 06             	cmp    $0x6,%edx
+  80177a:	74 0e                	je     80178a <sys_yield+0x6e>
+  80177c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80177f:	0f b6 c9             	movzbl %cl,%ecx
+  801782:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801788:	eb a1                	jmp    80172b <sys_yield+0xf>
+  80178a:	89 c2                	mov    %eax,%edx
+  80178c:	c1 ea 04             	shr    $0x4,%edx
+  80178f:	83 e2 0f             	and    $0xf,%edx
+  801792:	83 fa 02             	cmp    $0x2,%edx
+  801795:	77 e5                	ja     80177c <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  801797:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80179a:	83 f8 02             	cmp    $0x2,%eax
+  80179d:	0f 97 c1             	seta   %cl
+  8017a0:	0f b6 c9             	movzbl %cl,%ecx
+  8017a3:	eb d7                	jmp    80177c <sys_yield+0x60>
+		asm volatile("int %1\n"
+  8017a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017aa:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8017af:	89 d1                	mov    %edx,%ecx
+  8017b1:	89 d3                	mov    %edx,%ebx
+  8017b3:	89 d7                	mov    %edx,%edi
+  8017b5:	89 d6                	mov    %edx,%esi
+  8017b7:	cd 30                	int    $0x30
+}
+  8017b9:	eb 99                	jmp    801754 <sys_yield+0x38>
+
+008017bb <sys_env_set_status>:
+{
+  8017bb:	55                   	push   %ebp
+  8017bc:	89 e5                	mov    %esp,%ebp
+  8017be:	57                   	push   %edi
+  8017bf:	56                   	push   %esi
+  8017c0:	53                   	push   %ebx
+  8017c1:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8017c4:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8017cb:	78 37                	js     801804 <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  8017cd:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8017d4:	74 7a                	je     801850 <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  8017d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017e1:	b8 08 00 00 00       	mov    $0x8,%eax
+  8017e6:	89 df                	mov    %ebx,%edi
+  8017e8:	89 de                	mov    %ebx,%esi
+  8017ea:	55                   	push   %ebp
+  8017eb:	68 f4 17 80 00       	push   $0x8017f4
+  8017f0:	89 e5                	mov    %esp,%ebp
+  8017f2:	0f 34                	sysenter
+  8017f4:	83 c4 04             	add    $0x4,%esp
+  8017f7:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8017f8:	85 c0                	test   %eax,%eax
+  8017fa:	7f 6c                	jg     801868 <sys_env_set_status+0xad>
+}
+  8017fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017ff:	5b                   	pop    %ebx
+  801800:	5e                   	pop    %esi
+  801801:	5f                   	pop    %edi
+  801802:	5d                   	pop    %ebp
+  801803:	c3                   	ret
+  801804:	b8 01 00 00 00       	mov    $0x1,%eax
+  801809:	0f a2                	cpuid
+		return 0;
+  80180b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801810:	f6 c6 08             	test   $0x8,%dh
+  801813:	74 15                	je     80182a <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801815:	89 c2                	mov    %eax,%edx
+  801817:	c1 ea 08             	shr    $0x8,%edx
+  80181a:	83 e2 0f             	and    $0xf,%edx
+  80181d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801822:	83 fa 06             	cmp    $0x6,%edx
+  801825:	74 0e                	je     801835 <sys_env_set_status+0x7a>
+  801827:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80182a:	0f b6 c9             	movzbl %cl,%ecx
+  80182d:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801833:	eb 98                	jmp    8017cd <sys_env_set_status+0x12>
+  801835:	89 c2                	mov    %eax,%edx
+  801837:	c1 ea 04             	shr    $0x4,%edx
+  80183a:	83 e2 0f             	and    $0xf,%edx
+  80183d:	83 fa 02             	cmp    $0x2,%edx
+  801840:	77 e5                	ja     801827 <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  801842:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801845:	83 f8 02             	cmp    $0x2,%eax
+  801848:	0f 97 c1             	seta   %cl
+  80184b:	0f b6 c9             	movzbl %cl,%ecx
+  80184e:	eb d7                	jmp    801827 <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  801850:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801855:	b8 08 00 00 00       	mov    $0x8,%eax
+  80185a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80185d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801860:	89 df                	mov    %ebx,%edi
+  801862:	89 de                	mov    %ebx,%esi
+  801864:	cd 30                	int    $0x30
+  801866:	eb 90                	jmp    8017f8 <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801868:	83 ec 0c             	sub    $0xc,%esp
+  80186b:	50                   	push   %eax
+  80186c:	6a 08                	push   $0x8
+  80186e:	68 79 30 80 00       	push   $0x803079
+  801873:	6a 4a                	push   $0x4a
+  801875:	68 96 30 80 00       	push   $0x803096
+  80187a:	e8 54 ec ff ff       	call   8004d3 <_panic>
+
+0080187f <sys_sysinfo>:
+{
+  80187f:	55                   	push   %ebp
+  801880:	89 e5                	mov    %esp,%ebp
+  801882:	57                   	push   %edi
+  801883:	56                   	push   %esi
+  801884:	53                   	push   %ebx
+  801885:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801888:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80188f:	78 36                	js     8018c7 <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  801891:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801898:	74 79                	je     801913 <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  80189a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80189d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018a2:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8018a7:	89 cb                	mov    %ecx,%ebx
+  8018a9:	89 cf                	mov    %ecx,%edi
+  8018ab:	89 ce                	mov    %ecx,%esi
+  8018ad:	55                   	push   %ebp
+  8018ae:	68 b7 18 80 00       	push   $0x8018b7
+  8018b3:	89 e5                	mov    %esp,%ebp
+  8018b5:	0f 34                	sysenter
+  8018b7:	83 c4 04             	add    $0x4,%esp
+  8018ba:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8018bb:	85 c0                	test   %eax,%eax
+  8018bd:	7f 6b                	jg     80192a <sys_sysinfo+0xab>
+}
+  8018bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018c2:	5b                   	pop    %ebx
+  8018c3:	5e                   	pop    %esi
+  8018c4:	5f                   	pop    %edi
+  8018c5:	5d                   	pop    %ebp
+  8018c6:	c3                   	ret
+  8018c7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018cc:	0f a2                	cpuid
+		return 0;
+  8018ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018d3:	f6 c6 08             	test   $0x8,%dh
+  8018d6:	74 15                	je     8018ed <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018d8:	89 c2                	mov    %eax,%edx
+  8018da:	c1 ea 08             	shr    $0x8,%edx
+  8018dd:	83 e2 0f             	and    $0xf,%edx
+  8018e0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018e5:	83 fa 06             	cmp    $0x6,%edx
+  8018e8:	74 0e                	je     8018f8 <sys_sysinfo+0x79>
+  8018ea:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8018ed:	0f b6 c9             	movzbl %cl,%ecx
+  8018f0:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8018f6:	eb 99                	jmp    801891 <sys_sysinfo+0x12>
+  8018f8:	89 c2                	mov    %eax,%edx
+  8018fa:	c1 ea 04             	shr    $0x4,%edx
+  8018fd:	83 e2 0f             	and    $0xf,%edx
+  801900:	83 fa 02             	cmp    $0x2,%edx
+  801903:	77 e5                	ja     8018ea <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  801905:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801908:	83 f8 02             	cmp    $0x2,%eax
+  80190b:	0f 97 c1             	seta   %cl
+  80190e:	0f b6 c9             	movzbl %cl,%ecx
+  801911:	eb d7                	jmp    8018ea <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  801913:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801918:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80191d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801920:	89 cb                	mov    %ecx,%ebx
+  801922:	89 cf                	mov    %ecx,%edi
+  801924:	89 ce                	mov    %ecx,%esi
+  801926:	cd 30                	int    $0x30
+  801928:	eb 91                	jmp    8018bb <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80192a:	83 ec 0c             	sub    $0xc,%esp
+  80192d:	50                   	push   %eax
+  80192e:	6a 0b                	push   $0xb
+  801930:	68 79 30 80 00       	push   $0x803079
+  801935:	6a 4a                	push   $0x4a
+  801937:	68 96 30 80 00       	push   $0x803096
+  80193c:	e8 92 eb ff ff       	call   8004d3 <_panic>
+
+00801941 <sys_env_set_trapframe>:
+{
+  801941:	55                   	push   %ebp
+  801942:	89 e5                	mov    %esp,%ebp
+  801944:	57                   	push   %edi
+  801945:	56                   	push   %esi
+  801946:	53                   	push   %ebx
+  801947:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80194a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801951:	78 37                	js     80198a <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  801953:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80195a:	74 7a                	je     8019d6 <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  80195c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801961:	8b 55 08             	mov    0x8(%ebp),%edx
+  801964:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801967:	b8 13 00 00 00       	mov    $0x13,%eax
+  80196c:	89 df                	mov    %ebx,%edi
+  80196e:	89 de                	mov    %ebx,%esi
+  801970:	55                   	push   %ebp
+  801971:	68 7a 19 80 00       	push   $0x80197a
+  801976:	89 e5                	mov    %esp,%ebp
+  801978:	0f 34                	sysenter
+  80197a:	83 c4 04             	add    $0x4,%esp
+  80197d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80197e:	85 c0                	test   %eax,%eax
+  801980:	7f 6c                	jg     8019ee <sys_env_set_trapframe+0xad>
+}
+  801982:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801985:	5b                   	pop    %ebx
+  801986:	5e                   	pop    %esi
+  801987:	5f                   	pop    %edi
+  801988:	5d                   	pop    %ebp
+  801989:	c3                   	ret
+  80198a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80198f:	0f a2                	cpuid
+		return 0;
+  801991:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801996:	f6 c6 08             	test   $0x8,%dh
+  801999:	74 15                	je     8019b0 <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80199b:	89 c2                	mov    %eax,%edx
+  80199d:	c1 ea 08             	shr    $0x8,%edx
+  8019a0:	83 e2 0f             	and    $0xf,%edx
+  8019a3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019a8:	83 fa 06             	cmp    $0x6,%edx
+  8019ab:	74 0e                	je     8019bb <sys_env_set_trapframe+0x7a>
+  8019ad:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8019b0:	0f b6 c9             	movzbl %cl,%ecx
+  8019b3:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8019b9:	eb 98                	jmp    801953 <sys_env_set_trapframe+0x12>
+  8019bb:	89 c2                	mov    %eax,%edx
+  8019bd:	c1 ea 04             	shr    $0x4,%edx
+  8019c0:	83 e2 0f             	and    $0xf,%edx
+  8019c3:	83 fa 02             	cmp    $0x2,%edx
+  8019c6:	77 e5                	ja     8019ad <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  8019c8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019cb:	83 f8 02             	cmp    $0x2,%eax
+  8019ce:	0f 97 c1             	seta   %cl
+  8019d1:	0f b6 c9             	movzbl %cl,%ecx
+  8019d4:	eb d7                	jmp    8019ad <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  8019d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019db:	b8 13 00 00 00       	mov    $0x13,%eax
+  8019e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019e6:	89 df                	mov    %ebx,%edi
+  8019e8:	89 de                	mov    %ebx,%esi
+  8019ea:	cd 30                	int    $0x30
+  8019ec:	eb 90                	jmp    80197e <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8019ee:	83 ec 0c             	sub    $0xc,%esp
+  8019f1:	50                   	push   %eax
+  8019f2:	6a 13                	push   $0x13
+  8019f4:	68 79 30 80 00       	push   $0x803079
+  8019f9:	6a 4a                	push   $0x4a
+  8019fb:	68 96 30 80 00       	push   $0x803096
+  801a00:	e8 ce ea ff ff       	call   8004d3 <_panic>
+
+00801a05 <sys_env_set_stack_limit>:
+{
+  801a05:	55                   	push   %ebp
+  801a06:	89 e5                	mov    %esp,%ebp
+  801a08:	57                   	push   %edi
+  801a09:	56                   	push   %esi
+  801a0a:	53                   	push   %ebx
+  801a0b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801a0e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a15:	78 37                	js     801a4e <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  801a17:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a1e:	74 7a                	je     801a9a <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  801a20:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a25:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a2b:	b8 19 00 00 00       	mov    $0x19,%eax
+  801a30:	89 df                	mov    %ebx,%edi
+  801a32:	89 de                	mov    %ebx,%esi
+  801a34:	55                   	push   %ebp
+  801a35:	68 3e 1a 80 00       	push   $0x801a3e
+  801a3a:	89 e5                	mov    %esp,%ebp
+  801a3c:	0f 34                	sysenter
+  801a3e:	83 c4 04             	add    $0x4,%esp
+  801a41:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801a42:	85 c0                	test   %eax,%eax
+  801a44:	7f 6c                	jg     801ab2 <sys_env_set_stack_limit+0xad>
+}
+  801a46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a49:	5b                   	pop    %ebx
+  801a4a:	5e                   	pop    %esi
+  801a4b:	5f                   	pop    %edi
+  801a4c:	5d                   	pop    %ebp
+  801a4d:	c3                   	ret
+  801a4e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a53:	0f a2                	cpuid
+		return 0;
+  801a55:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801a5a:	f6 c6 08             	test   $0x8,%dh
+  801a5d:	74 15                	je     801a74 <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a5f:	89 c2                	mov    %eax,%edx
+  801a61:	c1 ea 08             	shr    $0x8,%edx
+  801a64:	83 e2 0f             	and    $0xf,%edx
+  801a67:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a6c:	83 fa 06             	cmp    $0x6,%edx
+  801a6f:	74 0e                	je     801a7f <sys_env_set_stack_limit+0x7a>
+  801a71:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a74:	0f b6 c9             	movzbl %cl,%ecx
+  801a77:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801a7d:	eb 98                	jmp    801a17 <sys_env_set_stack_limit+0x12>
+  801a7f:	89 c2                	mov    %eax,%edx
+  801a81:	c1 ea 04             	shr    $0x4,%edx
+  801a84:	83 e2 0f             	and    $0xf,%edx
+  801a87:	83 fa 02             	cmp    $0x2,%edx
+  801a8a:	77 e5                	ja     801a71 <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  801a8c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a8f:	83 f8 02             	cmp    $0x2,%eax
+  801a92:	0f 97 c1             	seta   %cl
+  801a95:	0f b6 c9             	movzbl %cl,%ecx
+  801a98:	eb d7                	jmp    801a71 <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  801a9a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a9f:	b8 19 00 00 00       	mov    $0x19,%eax
+  801aa4:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aa7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801aaa:	89 df                	mov    %ebx,%edi
+  801aac:	89 de                	mov    %ebx,%esi
+  801aae:	cd 30                	int    $0x30
+  801ab0:	eb 90                	jmp    801a42 <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801ab2:	83 ec 0c             	sub    $0xc,%esp
+  801ab5:	50                   	push   %eax
+  801ab6:	6a 19                	push   $0x19
+  801ab8:	68 79 30 80 00       	push   $0x803079
+  801abd:	6a 4a                	push   $0x4a
+  801abf:	68 96 30 80 00       	push   $0x803096
+  801ac4:	e8 0a ea ff ff       	call   8004d3 <_panic>
+
+00801ac9 <sys_env_set_pgfault_upcall>:
+{
+  801ac9:	55                   	push   %ebp
+  801aca:	89 e5                	mov    %esp,%ebp
+  801acc:	57                   	push   %edi
+  801acd:	56                   	push   %esi
+  801ace:	53                   	push   %ebx
+  801acf:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801ad2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ad9:	78 37                	js     801b12 <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  801adb:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ae2:	74 7a                	je     801b5e <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  801ae4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ae9:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801aef:	b8 09 00 00 00       	mov    $0x9,%eax
+  801af4:	89 df                	mov    %ebx,%edi
+  801af6:	89 de                	mov    %ebx,%esi
+  801af8:	55                   	push   %ebp
+  801af9:	68 02 1b 80 00       	push   $0x801b02
+  801afe:	89 e5                	mov    %esp,%ebp
+  801b00:	0f 34                	sysenter
+  801b02:	83 c4 04             	add    $0x4,%esp
+  801b05:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801b06:	85 c0                	test   %eax,%eax
+  801b08:	7f 6c                	jg     801b76 <sys_env_set_pgfault_upcall+0xad>
+}
+  801b0a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b0d:	5b                   	pop    %ebx
+  801b0e:	5e                   	pop    %esi
+  801b0f:	5f                   	pop    %edi
+  801b10:	5d                   	pop    %ebp
+  801b11:	c3                   	ret
+  801b12:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b17:	0f a2                	cpuid
+		return 0;
+  801b19:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b1e:	f6 c6 08             	test   $0x8,%dh
+  801b21:	74 15                	je     801b38 <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b23:	89 c2                	mov    %eax,%edx
+  801b25:	c1 ea 08             	shr    $0x8,%edx
+  801b28:	83 e2 0f             	and    $0xf,%edx
+  801b2b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b30:	83 fa 06             	cmp    $0x6,%edx
+  801b33:	74 0e                	je     801b43 <sys_env_set_pgfault_upcall+0x7a>
+  801b35:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b38:	0f b6 c9             	movzbl %cl,%ecx
+  801b3b:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801b41:	eb 98                	jmp    801adb <sys_env_set_pgfault_upcall+0x12>
+  801b43:	89 c2                	mov    %eax,%edx
+  801b45:	c1 ea 04             	shr    $0x4,%edx
+  801b48:	83 e2 0f             	and    $0xf,%edx
+  801b4b:	83 fa 02             	cmp    $0x2,%edx
+  801b4e:	77 e5                	ja     801b35 <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  801b50:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b53:	83 f8 02             	cmp    $0x2,%eax
+  801b56:	0f 97 c1             	seta   %cl
+  801b59:	0f b6 c9             	movzbl %cl,%ecx
+  801b5c:	eb d7                	jmp    801b35 <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  801b5e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b63:	b8 09 00 00 00       	mov    $0x9,%eax
+  801b68:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b6b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b6e:	89 df                	mov    %ebx,%edi
+  801b70:	89 de                	mov    %ebx,%esi
+  801b72:	cd 30                	int    $0x30
+  801b74:	eb 90                	jmp    801b06 <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801b76:	83 ec 0c             	sub    $0xc,%esp
+  801b79:	50                   	push   %eax
+  801b7a:	6a 09                	push   $0x9
+  801b7c:	68 79 30 80 00       	push   $0x803079
+  801b81:	6a 4a                	push   $0x4a
+  801b83:	68 96 30 80 00       	push   $0x803096
+  801b88:	e8 46 e9 ff ff       	call   8004d3 <_panic>
+
+00801b8d <sys_ipc_try_send>:
+{
+  801b8d:	55                   	push   %ebp
+  801b8e:	89 e5                	mov    %esp,%ebp
+  801b90:	57                   	push   %edi
+  801b91:	56                   	push   %esi
+  801b92:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801b93:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b9a:	78 32                	js     801bce <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  801b9c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ba3:	74 75                	je     801c1a <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801ba5:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ba8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bab:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801bb0:	be 00 00 00 00       	mov    $0x0,%esi
+  801bb5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801bb8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801bbb:	55                   	push   %ebp
+  801bbc:	68 c5 1b 80 00       	push   $0x801bc5
+  801bc1:	89 e5                	mov    %esp,%ebp
+  801bc3:	0f 34                	sysenter
+  801bc5:	83 c4 04             	add    $0x4,%esp
+  801bc8:	5d                   	pop    %ebp
+}
+  801bc9:	5b                   	pop    %ebx
+  801bca:	5e                   	pop    %esi
+  801bcb:	5f                   	pop    %edi
+  801bcc:	5d                   	pop    %ebp
+  801bcd:	c3                   	ret
+  801bce:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bd3:	0f a2                	cpuid
+		return 0;
+  801bd5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801bda:	f6 c6 08             	test   $0x8,%dh
+  801bdd:	74 15                	je     801bf4 <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bdf:	89 c2                	mov    %eax,%edx
+  801be1:	c1 ea 08             	shr    $0x8,%edx
+  801be4:	83 e2 0f             	and    $0xf,%edx
+  801be7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801bec:	83 fa 06             	cmp    $0x6,%edx
+  801bef:	74 0e                	je     801bff <sys_ipc_try_send+0x72>
+  801bf1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801bf4:	0f b6 c9             	movzbl %cl,%ecx
+  801bf7:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801bfd:	eb 9d                	jmp    801b9c <sys_ipc_try_send+0xf>
+  801bff:	89 c2                	mov    %eax,%edx
+  801c01:	c1 ea 04             	shr    $0x4,%edx
+  801c04:	83 e2 0f             	and    $0xf,%edx
+  801c07:	83 fa 02             	cmp    $0x2,%edx
+  801c0a:	77 e5                	ja     801bf1 <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  801c0c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c0f:	83 f8 02             	cmp    $0x2,%eax
+  801c12:	0f 97 c1             	seta   %cl
+  801c15:	0f b6 c9             	movzbl %cl,%ecx
+  801c18:	eb d7                	jmp    801bf1 <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  801c1a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801c1f:	be 00 00 00 00       	mov    $0x0,%esi
+  801c24:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c27:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c2a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801c2d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801c30:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801c32:	eb 95                	jmp    801bc9 <sys_ipc_try_send+0x3c>
+
+00801c34 <sys_ipc_send>:
+{
+  801c34:	55                   	push   %ebp
+  801c35:	89 e5                	mov    %esp,%ebp
+  801c37:	57                   	push   %edi
+  801c38:	56                   	push   %esi
+  801c39:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801c3a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801c41:	78 32                	js     801c75 <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  801c43:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801c4a:	74 75                	je     801cc1 <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801c4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c4f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c52:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801c57:	be 00 00 00 00       	mov    $0x0,%esi
+  801c5c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801c5f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801c62:	55                   	push   %ebp
+  801c63:	68 6c 1c 80 00       	push   $0x801c6c
+  801c68:	89 e5                	mov    %esp,%ebp
+  801c6a:	0f 34                	sysenter
+  801c6c:	83 c4 04             	add    $0x4,%esp
+  801c6f:	5d                   	pop    %ebp
+}
+  801c70:	5b                   	pop    %ebx
+  801c71:	5e                   	pop    %esi
+  801c72:	5f                   	pop    %edi
+  801c73:	5d                   	pop    %ebp
+  801c74:	c3                   	ret
+  801c75:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c7a:	0f a2                	cpuid
+		return 0;
+  801c7c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801c81:	f6 c6 08             	test   $0x8,%dh
+  801c84:	74 15                	je     801c9b <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c86:	89 c2                	mov    %eax,%edx
+  801c88:	c1 ea 08             	shr    $0x8,%edx
+  801c8b:	83 e2 0f             	and    $0xf,%edx
+  801c8e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801c93:	83 fa 06             	cmp    $0x6,%edx
+  801c96:	74 0e                	je     801ca6 <sys_ipc_send+0x72>
+  801c98:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801c9b:	0f b6 c9             	movzbl %cl,%ecx
+  801c9e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801ca4:	eb 9d                	jmp    801c43 <sys_ipc_send+0xf>
+  801ca6:	89 c2                	mov    %eax,%edx
+  801ca8:	c1 ea 04             	shr    $0x4,%edx
+  801cab:	83 e2 0f             	and    $0xf,%edx
+  801cae:	83 fa 02             	cmp    $0x2,%edx
+  801cb1:	77 e5                	ja     801c98 <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  801cb3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801cb6:	83 f8 02             	cmp    $0x2,%eax
+  801cb9:	0f 97 c1             	seta   %cl
+  801cbc:	0f b6 c9             	movzbl %cl,%ecx
+  801cbf:	eb d7                	jmp    801c98 <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  801cc1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801cc6:	be 00 00 00 00       	mov    $0x0,%esi
+  801ccb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cd1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801cd4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801cd7:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801cd9:	eb 95                	jmp    801c70 <sys_ipc_send+0x3c>
+
+00801cdb <sys_ipc_recv>:
+{
+  801cdb:	55                   	push   %ebp
+  801cdc:	89 e5                	mov    %esp,%ebp
+  801cde:	57                   	push   %edi
+  801cdf:	56                   	push   %esi
+  801ce0:	53                   	push   %ebx
+  801ce1:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801ce4:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ceb:	78 36                	js     801d23 <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  801ced:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801cf4:	74 79                	je     801d6f <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  801cf6:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cf9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cfe:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801d03:	89 cb                	mov    %ecx,%ebx
+  801d05:	89 cf                	mov    %ecx,%edi
+  801d07:	89 ce                	mov    %ecx,%esi
+  801d09:	55                   	push   %ebp
+  801d0a:	68 13 1d 80 00       	push   $0x801d13
+  801d0f:	89 e5                	mov    %esp,%ebp
+  801d11:	0f 34                	sysenter
+  801d13:	83 c4 04             	add    $0x4,%esp
+  801d16:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801d17:	85 c0                	test   %eax,%eax
+  801d19:	7f 6b                	jg     801d86 <sys_ipc_recv+0xab>
+}
+  801d1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d1e:	5b                   	pop    %ebx
+  801d1f:	5e                   	pop    %esi
+  801d20:	5f                   	pop    %edi
+  801d21:	5d                   	pop    %ebp
+  801d22:	c3                   	ret
+  801d23:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d28:	0f a2                	cpuid
+		return 0;
+  801d2a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801d2f:	f6 c6 08             	test   $0x8,%dh
+  801d32:	74 15                	je     801d49 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d34:	89 c2                	mov    %eax,%edx
+  801d36:	c1 ea 08             	shr    $0x8,%edx
+  801d39:	83 e2 0f             	and    $0xf,%edx
+  801d3c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d41:	83 fa 06             	cmp    $0x6,%edx
+  801d44:	74 0e                	je     801d54 <sys_ipc_recv+0x79>
+  801d46:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801d49:	0f b6 c9             	movzbl %cl,%ecx
+  801d4c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801d52:	eb 99                	jmp    801ced <sys_ipc_recv+0x12>
+  801d54:	89 c2                	mov    %eax,%edx
+  801d56:	c1 ea 04             	shr    $0x4,%edx
+  801d59:	83 e2 0f             	and    $0xf,%edx
+  801d5c:	83 fa 02             	cmp    $0x2,%edx
+  801d5f:	77 e5                	ja     801d46 <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  801d61:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d64:	83 f8 02             	cmp    $0x2,%eax
+  801d67:	0f 97 c1             	seta   %cl
+  801d6a:	0f b6 c9             	movzbl %cl,%ecx
+  801d6d:	eb d7                	jmp    801d46 <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  801d6f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d74:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801d79:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d7c:	89 cb                	mov    %ecx,%ebx
+  801d7e:	89 cf                	mov    %ecx,%edi
+  801d80:	89 ce                	mov    %ecx,%esi
+  801d82:	cd 30                	int    $0x30
+  801d84:	eb 91                	jmp    801d17 <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801d86:	83 ec 0c             	sub    $0xc,%esp
+  801d89:	50                   	push   %eax
+  801d8a:	6a 0d                	push   $0xd
+  801d8c:	68 79 30 80 00       	push   $0x803079
+  801d91:	6a 4a                	push   $0x4a
+  801d93:	68 96 30 80 00       	push   $0x803096
+  801d98:	e8 36 e7 ff ff       	call   8004d3 <_panic>
+
+00801d9d <sys_ipc_send_range>:
+{
+  801d9d:	55                   	push   %ebp
+  801d9e:	89 e5                	mov    %esp,%ebp
+  801da0:	57                   	push   %edi
+  801da1:	56                   	push   %esi
+  801da2:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801da3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801daa:	78 30                	js     801ddc <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  801dac:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801db3:	74 73                	je     801e28 <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801db5:	8b 55 08             	mov    0x8(%ebp),%edx
+  801db8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801dbb:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801dc0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801dc3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801dc6:	8b 75 18             	mov    0x18(%ebp),%esi
+  801dc9:	55                   	push   %ebp
+  801dca:	68 d3 1d 80 00       	push   $0x801dd3
+  801dcf:	89 e5                	mov    %esp,%ebp
+  801dd1:	0f 34                	sysenter
+  801dd3:	83 c4 04             	add    $0x4,%esp
+  801dd6:	5d                   	pop    %ebp
+}
+  801dd7:	5b                   	pop    %ebx
+  801dd8:	5e                   	pop    %esi
+  801dd9:	5f                   	pop    %edi
+  801dda:	5d                   	pop    %ebp
+  801ddb:	c3                   	ret
+  801ddc:	b8 01 00 00 00       	mov    $0x1,%eax
+  801de1:	0f a2                	cpuid
+		return 0;
+  801de3:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801de8:	f6 c6 08             	test   $0x8,%dh
+  801deb:	74 15                	je     801e02 <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ded:	89 c2                	mov    %eax,%edx
+  801def:	c1 ea 08             	shr    $0x8,%edx
+  801df2:	83 e2 0f             	and    $0xf,%edx
+  801df5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801dfa:	83 fa 06             	cmp    $0x6,%edx
+  801dfd:	74 0e                	je     801e0d <sys_ipc_send_range+0x70>
+  801dff:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801e02:	0f b6 c9             	movzbl %cl,%ecx
+  801e05:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801e0b:	eb 9f                	jmp    801dac <sys_ipc_send_range+0xf>
+  801e0d:	89 c2                	mov    %eax,%edx
+  801e0f:	c1 ea 04             	shr    $0x4,%edx
+  801e12:	83 e2 0f             	and    $0xf,%edx
+  801e15:	83 fa 02             	cmp    $0x2,%edx
+  801e18:	77 e5                	ja     801dff <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  801e1a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e1d:	83 f8 02             	cmp    $0x2,%eax
+  801e20:	0f 97 c1             	seta   %cl
+  801e23:	0f b6 c9             	movzbl %cl,%ecx
+  801e26:	eb d7                	jmp    801dff <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  801e28:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801e2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e33:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e36:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801e39:	8b 75 18             	mov    0x18(%ebp),%esi
+  801e3c:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  801e3e:	eb 97                	jmp    801dd7 <sys_ipc_send_range+0x3a>
+
+00801e40 <sys_ipc_recv_range>:
+{
+  801e40:	55                   	push   %ebp
+  801e41:	89 e5                	mov    %esp,%ebp
+  801e43:	57                   	push   %edi
+  801e44:	56                   	push   %esi
+  801e45:	53                   	push   %ebx
+  801e46:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801e49:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e50:	78 37                	js     801e89 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  801e52:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e59:	74 7a                	je     801ed5 <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  801e5b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e60:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e63:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e66:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801e6b:	89 df                	mov    %ebx,%edi
+  801e6d:	89 de                	mov    %ebx,%esi
+  801e6f:	55                   	push   %ebp
+  801e70:	68 79 1e 80 00       	push   $0x801e79
+  801e75:	89 e5                	mov    %esp,%ebp
+  801e77:	0f 34                	sysenter
+  801e79:	83 c4 04             	add    $0x4,%esp
+  801e7c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801e7d:	85 c0                	test   %eax,%eax
+  801e7f:	7f 6c                	jg     801eed <sys_ipc_recv_range+0xad>
+}
+  801e81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e84:	5b                   	pop    %ebx
+  801e85:	5e                   	pop    %esi
+  801e86:	5f                   	pop    %edi
+  801e87:	5d                   	pop    %ebp
+  801e88:	c3                   	ret
+  801e89:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e8e:	0f a2                	cpuid
+		return 0;
+  801e90:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801e95:	f6 c6 08             	test   $0x8,%dh
+  801e98:	74 15                	je     801eaf <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e9a:	89 c2                	mov    %eax,%edx
+  801e9c:	c1 ea 08             	shr    $0x8,%edx
+  801e9f:	83 e2 0f             	and    $0xf,%edx
+  801ea2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ea7:	83 fa 06             	cmp    $0x6,%edx
+  801eaa:	74 0e                	je     801eba <sys_ipc_recv_range+0x7a>
+  801eac:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801eaf:	0f b6 c9             	movzbl %cl,%ecx
+  801eb2:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801eb8:	eb 98                	jmp    801e52 <sys_ipc_recv_range+0x12>
+  801eba:	89 c2                	mov    %eax,%edx
+  801ebc:	c1 ea 04             	shr    $0x4,%edx
+  801ebf:	83 e2 0f             	and    $0xf,%edx
+  801ec2:	83 fa 02             	cmp    $0x2,%edx
+  801ec5:	77 e5                	ja     801eac <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801ec7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801eca:	83 f8 02             	cmp    $0x2,%eax
+  801ecd:	0f 97 c1             	seta   %cl
+  801ed0:	0f b6 c9             	movzbl %cl,%ecx
+  801ed3:	eb d7                	jmp    801eac <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801ed5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801eda:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801edf:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ee2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ee5:	89 df                	mov    %ebx,%edi
+  801ee7:	89 de                	mov    %ebx,%esi
+  801ee9:	cd 30                	int    $0x30
+  801eeb:	eb 90                	jmp    801e7d <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801eed:	83 ec 0c             	sub    $0xc,%esp
+  801ef0:	50                   	push   %eax
+  801ef1:	6a 1f                	push   $0x1f
+  801ef3:	68 79 30 80 00       	push   $0x803079
+  801ef8:	6a 4a                	push   $0x4a
+  801efa:	68 96 30 80 00       	push   $0x803096
+  801eff:	e8 cf e5 ff ff       	call   8004d3 <_panic>
+
+00801f04 <sys_ipc_call>:
+{
+  801f04:	55                   	push   %ebp
+  801f05:	89 e5                	mov    %esp,%ebp
+  801f07:	57                   	push   %edi
+  801f08:	56                   	push   %esi
+  801f09:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801f0a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f0d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801f12:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f15:	55                   	push   %ebp
+  801f16:	56                   	push   %esi
+  801f17:	8b 0e                	mov    (%esi),%ecx
+  801f19:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801f1c:	8b 7e 08             	mov    0x8(%esi),%edi
+  801f1f:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801f22:	8b 76 0c             	mov    0xc(%esi),%esi
+  801f25:	cd 30                	int    $0x30
+  801f27:	87 34 24             	xchg   %esi,(%esp)
+  801f2a:	89 0e                	mov    %ecx,(%esi)
+  801f2c:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801f2f:	89 7e 08             	mov    %edi,0x8(%esi)
+  801f32:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801f35:	8f 46 0c             	pop    0xc(%esi)
+  801f38:	5d                   	pop    %ebp
+}
+  801f39:	5b                   	pop    %ebx
+  801f3a:	5e                   	pop    %esi
+  801f3b:	5f                   	pop    %edi
+  801f3c:	5d                   	pop    %ebp
+  801f3d:	c3                   	ret
+
+00801f3e <sys_ipc_reply_wait>:
+{
+  801f3e:	55                   	push   %ebp
+  801f3f:	89 e5                	mov    %esp,%ebp
+  801f41:	57                   	push   %edi
+  801f42:	56                   	push   %esi
+  801f43:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801f44:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f47:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801f4c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f4f:	55                   	push   %ebp
+  801f50:	56                   	push   %esi
+  801f51:	8b 0e                	mov    (%esi),%ecx
+  801f53:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801f56:	8b 7e 08             	mov    0x8(%esi),%edi
+  801f59:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801f5c:	8b 76 0c             	mov    0xc(%esi),%esi
+  801f5f:	cd 30                	int    $0x30
+  801f61:	87 34 24             	xchg   %esi,(%esp)
+  801f64:	89 0e                	mov    %ecx,(%esi)
+  801f66:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801f69:	89 7e 08             	mov    %edi,0x8(%esi)
+  801f6c:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801f6f:	8f 46 0c             	pop    0xc(%esi)
+  801f72:	5d                   	pop    %ebp
+}
+  801f73:	5b                   	pop    %ebx
+  801f74:	5e                   	pop    %esi
+  801f75:	5f                   	pop    %edi
+  801f76:	5d                   	pop    %ebp
+  801f77:	c3                   	ret
+
+00801f78 <sys_ipc_send_msg>:
+{
+  801f78:	55                   	push   %ebp
+  801f79:	89 e5                	mov    %esp,%ebp
+  801f7b:	57                   	push   %edi
+  801f7c:	56                   	push   %esi
+  801f7d:	53                   	push   %ebx
+  801f7e:	83 ec 20             	sub    $0x20,%esp
+  801f81:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801f84:	8b 10                	mov    (%eax),%edx
+  801f86:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801f89:	8b 50 04             	mov    0x4(%eax),%edx
+  801f8c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801f8f:	8b 50 08             	mov    0x8(%eax),%edx
+  801f92:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801f95:	8b 50 0c             	mov    0xc(%eax),%edx
+  801f98:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801f9b:	8b 40 10             	mov    0x10(%eax),%eax
+  801f9e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801fa1:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801fa4:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fa7:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801fac:	55                   	push   %ebp
+  801fad:	56                   	push   %esi
+  801fae:	8b 0e                	mov    (%esi),%ecx
+  801fb0:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801fb3:	8b 7e 08             	mov    0x8(%esi),%edi
+  801fb6:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801fb9:	8b 76 0c             	mov    0xc(%esi),%esi
+  801fbc:	cd 30                	int    $0x30
+  801fbe:	87 34 24             	xchg   %esi,(%esp)
+  801fc1:	89 0e                	mov    %ecx,(%esi)
+  801fc3:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801fc6:	89 7e 08             	mov    %edi,0x8(%esi)
+  801fc9:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801fcc:	8f 46 0c             	pop    0xc(%esi)
+  801fcf:	5d                   	pop    %ebp
+}
+  801fd0:	83 c4 20             	add    $0x20,%esp
+  801fd3:	5b                   	pop    %ebx
+  801fd4:	5e                   	pop    %esi
+  801fd5:	5f                   	pop    %edi
+  801fd6:	5d                   	pop    %ebp
+  801fd7:	c3                   	ret
+
+00801fd8 <sys_fork>:
+{
+  801fd8:	55                   	push   %ebp
+  801fd9:	89 e5                	mov    %esp,%ebp
+  801fdb:	57                   	push   %edi
+  801fdc:	56                   	push   %esi
+  801fdd:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801fde:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801fe5:	78 2e                	js     802015 <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801fe7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801fee:	74 71                	je     802061 <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801ff0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ff5:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801ffa:	89 d1                	mov    %edx,%ecx
+  801ffc:	89 d3                	mov    %edx,%ebx
+  801ffe:	89 d7                	mov    %edx,%edi
+  802000:	89 d6                	mov    %edx,%esi
+  802002:	55                   	push   %ebp
+  802003:	68 0c 20 80 00       	push   $0x80200c
+  802008:	89 e5                	mov    %esp,%ebp
+  80200a:	0f 34                	sysenter
+  80200c:	83 c4 04             	add    $0x4,%esp
+  80200f:	5d                   	pop    %ebp
+}
+  802010:	5b                   	pop    %ebx
+  802011:	5e                   	pop    %esi
+  802012:	5f                   	pop    %edi
+  802013:	5d                   	pop    %ebp
+  802014:	c3                   	ret
+  802015:	b8 01 00 00 00       	mov    $0x1,%eax
+  80201a:	0f a2                	cpuid
+		return 0;
+  80201c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802021:	f6 c6 08             	test   $0x8,%dh
+  802024:	74 15                	je     80203b <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802026:	89 c2                	mov    %eax,%edx
+  802028:	c1 ea 08             	shr    $0x8,%edx
+  80202b:	83 e2 0f             	and    $0xf,%edx
+  80202e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802033:	83 fa 06             	cmp    $0x6,%edx
+  802036:	74 0e                	je     802046 <sys_fork+0x6e>
+  802038:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80203b:	0f b6 c9             	movzbl %cl,%ecx
+  80203e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802044:	eb a1                	jmp    801fe7 <sys_fork+0xf>
+  802046:	89 c2                	mov    %eax,%edx
+  802048:	c1 ea 04             	shr    $0x4,%edx
+  80204b:	83 e2 0f             	and    $0xf,%edx
+  80204e:	83 fa 02             	cmp    $0x2,%edx
+  802051:	77 e5                	ja     802038 <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  802053:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802056:	83 f8 02             	cmp    $0x2,%eax
+  802059:	0f 97 c1             	seta   %cl
+  80205c:	0f b6 c9             	movzbl %cl,%ecx
+  80205f:	eb d7                	jmp    802038 <sys_fork+0x60>
+		asm volatile("int %1\n"
+  802061:	ba 00 00 00 00       	mov    $0x0,%edx
+  802066:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80206b:	89 d1                	mov    %edx,%ecx
+  80206d:	89 d3                	mov    %edx,%ebx
+  80206f:	89 d7                	mov    %edx,%edi
+  802071:	89 d6                	mov    %edx,%esi
+  802073:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  802075:	eb 99                	jmp    802010 <sys_fork+0x38>
+
+00802077 <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  802077:	55                   	push   %ebp
+  802078:	89 e5                	mov    %esp,%ebp
+  80207a:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  80207d:	ff 75 14             	push   0x14(%ebp)
+  802080:	ff 75 10             	push   0x10(%ebp)
+  802083:	ff 75 0c             	push   0xc(%ebp)
+  802086:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80208b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80208e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802093:	e8 81 ee ff ff       	call   800f19 <page_vec_call>
+}
+  802098:	c9                   	leave
+  802099:	c3                   	ret
+
+0080209a <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  80209a:	55                   	push   %ebp
+  80209b:	89 e5                	mov    %esp,%ebp
+  80209d:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  8020a0:	ff 75 18             	push   0x18(%ebp)
+  8020a3:	ff 75 14             	push   0x14(%ebp)
+  8020a6:	ff 75 10             	push   0x10(%ebp)
+  8020a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020af:	b8 10 00 00 00       	mov    $0x10,%eax
+  8020b4:	e8 60 ee ff ff       	call   800f19 <page_vec_call>
+}
+  8020b9:	c9                   	leave
+  8020ba:	c3                   	ret
+
+008020bb <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  8020bb:	55                   	push   %ebp
+  8020bc:	89 e5                	mov    %esp,%ebp
+  8020be:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  8020c1:	ff 75 14             	push   0x14(%ebp)
+  8020c4:	ff 75 10             	push   0x10(%ebp)
+  8020c7:	ff 75 0c             	push   0xc(%ebp)
+  8020ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020d2:	b8 11 00 00 00       	mov    $0x11,%eax
+  8020d7:	e8 3d ee ff ff       	call   800f19 <page_vec_call>
+}
+  8020dc:	c9                   	leave
+  8020dd:	c3                   	ret
+
+008020de <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  8020de:	55                   	push   %ebp
+  8020df:	89 e5                	mov    %esp,%ebp
+  8020e1:	57                   	push   %edi
+  8020e2:	56                   	push   %esi
+  8020e3:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8020e4:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8020eb:	78 32                	js     80211f <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  8020ed:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8020f4:	74 75                	je     80216b <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  8020f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020fc:	b8 12 00 00 00       	mov    $0x12,%eax
+  802101:	be 00 00 00 00       	mov    $0x0,%esi
+  802106:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802109:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80210c:	55                   	push   %ebp
+  80210d:	68 16 21 80 00       	push   $0x802116
+  802112:	89 e5                	mov    %esp,%ebp
+  802114:	0f 34                	sysenter
+  802116:	83 c4 04             	add    $0x4,%esp
+  802119:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  80211a:	5b                   	pop    %ebx
+  80211b:	5e                   	pop    %esi
+  80211c:	5f                   	pop    %edi
+  80211d:	5d                   	pop    %ebp
+  80211e:	c3                   	ret
+  80211f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802124:	0f a2                	cpuid
+		return 0;
+  802126:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80212b:	f6 c6 08             	test   $0x8,%dh
+  80212e:	74 15                	je     802145 <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802130:	89 c2                	mov    %eax,%edx
+  802132:	c1 ea 08             	shr    $0x8,%edx
+  802135:	83 e2 0f             	and    $0xf,%edx
+  802138:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80213d:	83 fa 06             	cmp    $0x6,%edx
+  802140:	74 0e                	je     802150 <sys_vm_ranges+0x72>
+  802142:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802145:	0f b6 c9             	movzbl %cl,%ecx
+  802148:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80214e:	eb 9d                	jmp    8020ed <sys_vm_ranges+0xf>
+  802150:	89 c2                	mov    %eax,%edx
+  802152:	c1 ea 04             	shr    $0x4,%edx
+  802155:	83 e2 0f             	and    $0xf,%edx
+  802158:	83 fa 02             	cmp    $0x2,%edx
+  80215b:	77 e5                	ja     802142 <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  80215d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802160:	83 f8 02             	cmp    $0x2,%eax
+  802163:	0f 97 c1             	seta   %cl
+  802166:	0f b6 c9             	movzbl %cl,%ecx
+  802169:	eb d7                	jmp    802142 <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  80216b:	b8 12 00 00 00       	mov    $0x12,%eax
+  802170:	be 00 00 00 00       	mov    $0x0,%esi
+  802175:	8b 55 08             	mov    0x8(%ebp),%edx
+  802178:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80217b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80217e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802181:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  802183:	eb 95                	jmp    80211a <sys_vm_ranges+0x3c>
+
+00802185 <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  802185:	55                   	push   %ebp
+  802186:	89 e5                	mov    %esp,%ebp
+  802188:	57                   	push   %edi
+  802189:	56                   	push   %esi
+  80218a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80218b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802192:	78 31                	js     8021c5 <sys_spawn+0x40>
+	if (syscall_sysenter)
+  802194:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80219b:	74 74                	je     802211 <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  80219d:	be 00 00 00 00       	mov    $0x0,%esi
+  8021a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021a8:	b8 14 00 00 00       	mov    $0x14,%eax
+  8021ad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8021b0:	89 f7                	mov    %esi,%edi
+  8021b2:	55                   	push   %ebp
+  8021b3:	68 bc 21 80 00       	push   $0x8021bc
+  8021b8:	89 e5                	mov    %esp,%ebp
+  8021ba:	0f 34                	sysenter
+  8021bc:	83 c4 04             	add    $0x4,%esp
+  8021bf:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  8021c0:	5b                   	pop    %ebx
+  8021c1:	5e                   	pop    %esi
+  8021c2:	5f                   	pop    %edi
+  8021c3:	5d                   	pop    %ebp
+  8021c4:	c3                   	ret
+  8021c5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021ca:	0f a2                	cpuid
+		return 0;
+  8021cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8021d1:	f6 c6 08             	test   $0x8,%dh
+  8021d4:	74 15                	je     8021eb <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021d6:	89 c2                	mov    %eax,%edx
+  8021d8:	c1 ea 08             	shr    $0x8,%edx
+  8021db:	83 e2 0f             	and    $0xf,%edx
+  8021de:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8021e3:	83 fa 06             	cmp    $0x6,%edx
+  8021e6:	74 0e                	je     8021f6 <sys_spawn+0x71>
+  8021e8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8021eb:	0f b6 c9             	movzbl %cl,%ecx
+  8021ee:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8021f4:	eb 9e                	jmp    802194 <sys_spawn+0xf>
+  8021f6:	89 c2                	mov    %eax,%edx
+  8021f8:	c1 ea 04             	shr    $0x4,%edx
+  8021fb:	83 e2 0f             	and    $0xf,%edx
+  8021fe:	83 fa 02             	cmp    $0x2,%edx
+  802201:	77 e5                	ja     8021e8 <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  802203:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802206:	83 f8 02             	cmp    $0x2,%eax
+  802209:	0f 97 c1             	seta   %cl
+  80220c:	0f b6 c9             	movzbl %cl,%ecx
+  80220f:	eb d7                	jmp    8021e8 <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  802211:	be 00 00 00 00       	mov    $0x0,%esi
+  802216:	b8 14 00 00 00       	mov    $0x14,%eax
+  80221b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80221e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802221:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802224:	89 f7                	mov    %esi,%edi
+  802226:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  802228:	eb 96                	jmp    8021c0 <sys_spawn+0x3b>
+
+0080222a <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  80222a:	55                   	push   %ebp
+  80222b:	89 e5                	mov    %esp,%ebp
+  80222d:	57                   	push   %edi
+  80222e:	56                   	push   %esi
+  80222f:	53                   	push   %ebx
+  802230:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802233:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80223a:	78 37                	js     802273 <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  80223c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802243:	74 7a                	je     8022bf <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  802245:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80224a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80224d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802250:	b8 15 00 00 00       	mov    $0x15,%eax
+  802255:	89 df                	mov    %ebx,%edi
+  802257:	89 de                	mov    %ebx,%esi
+  802259:	55                   	push   %ebp
+  80225a:	68 63 22 80 00       	push   $0x802263
+  80225f:	89 e5                	mov    %esp,%ebp
+  802261:	0f 34                	sysenter
+  802263:	83 c4 04             	add    $0x4,%esp
+  802266:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802267:	85 c0                	test   %eax,%eax
+  802269:	7f 6c                	jg     8022d7 <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  80226b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80226e:	5b                   	pop    %ebx
+  80226f:	5e                   	pop    %esi
+  802270:	5f                   	pop    %edi
+  802271:	5d                   	pop    %ebp
+  802272:	c3                   	ret
+  802273:	b8 01 00 00 00       	mov    $0x1,%eax
+  802278:	0f a2                	cpuid
+		return 0;
+  80227a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80227f:	f6 c6 08             	test   $0x8,%dh
+  802282:	74 15                	je     802299 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802284:	89 c2                	mov    %eax,%edx
+  802286:	c1 ea 08             	shr    $0x8,%edx
+  802289:	83 e2 0f             	and    $0xf,%edx
+  80228c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802291:	83 fa 06             	cmp    $0x6,%edx
+  802294:	74 0e                	je     8022a4 <sys_shm_create+0x7a>
+  802296:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802299:	0f b6 c9             	movzbl %cl,%ecx
+  80229c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8022a2:	eb 98                	jmp    80223c <sys_shm_create+0x12>
+  8022a4:	89 c2                	mov    %eax,%edx
+  8022a6:	c1 ea 04             	shr    $0x4,%edx
+  8022a9:	83 e2 0f             	and    $0xf,%edx
+  8022ac:	83 fa 02             	cmp    $0x2,%edx
+  8022af:	77 e5                	ja     802296 <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  8022b1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022b4:	83 f8 02             	cmp    $0x2,%eax
+  8022b7:	0f 97 c1             	seta   %cl
+  8022ba:	0f b6 c9             	movzbl %cl,%ecx
+  8022bd:	eb d7                	jmp    802296 <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  8022bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022c4:	b8 15 00 00 00       	mov    $0x15,%eax
+  8022c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022cf:	89 df                	mov    %ebx,%edi
+  8022d1:	89 de                	mov    %ebx,%esi
+  8022d3:	cd 30                	int    $0x30
+  8022d5:	eb 90                	jmp    802267 <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8022d7:	83 ec 0c             	sub    $0xc,%esp
+  8022da:	50                   	push   %eax
+  8022db:	6a 15                	push   $0x15
+  8022dd:	68 79 30 80 00       	push   $0x803079
+  8022e2:	6a 4a                	push   $0x4a
+  8022e4:	68 96 30 80 00       	push   $0x803096
+  8022e9:	e8 e5 e1 ff ff       	call   8004d3 <_panic>
+
+008022ee <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  8022ee:	55                   	push   %ebp
+  8022ef:	89 e5                	mov    %esp,%ebp
+  8022f1:	57                   	push   %edi
+  8022f2:	56                   	push   %esi
+  8022f3:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8022f4:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8022fb:	78 32                	js     80232f <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  8022fd:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802304:	74 75                	je     80237b <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  802306:	8b 55 08             	mov    0x8(%ebp),%edx
+  802309:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80230c:	b8 16 00 00 00       	mov    $0x16,%eax
+  802311:	be 00 00 00 00       	mov    $0x0,%esi
+  802316:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802319:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80231c:	55                   	push   %ebp
+  80231d:	68 26 23 80 00       	push   $0x802326
+  802322:	89 e5                	mov    %esp,%ebp
+  802324:	0f 34                	sysenter
+  802326:	83 c4 04             	add    $0x4,%esp
+  802329:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  80232a:	5b                   	pop    %ebx
+  80232b:	5e                   	pop    %esi
+  80232c:	5f                   	pop    %edi
+  80232d:	5d                   	pop    %ebp
+  80232e:	c3                   	ret
+  80232f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802334:	0f a2                	cpuid
+		return 0;
+  802336:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80233b:	f6 c6 08             	test   $0x8,%dh
+  80233e:	74 15                	je     802355 <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802340:	89 c2                	mov    %eax,%edx
+  802342:	c1 ea 08             	shr    $0x8,%edx
+  802345:	83 e2 0f             	and    $0xf,%edx
+  802348:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80234d:	83 fa 06             	cmp    $0x6,%edx
+  802350:	74 0e                	je     802360 <sys_shm_attach+0x72>
+  802352:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802355:	0f b6 c9             	movzbl %cl,%ecx
+  802358:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80235e:	eb 9d                	jmp    8022fd <sys_shm_attach+0xf>
+  802360:	89 c2                	mov    %eax,%edx
+  802362:	c1 ea 04             	shr    $0x4,%edx
+  802365:	83 e2 0f             	and    $0xf,%edx
+  802368:	83 fa 02             	cmp    $0x2,%edx
+  80236b:	77 e5                	ja     802352 <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  80236d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802370:	83 f8 02             	cmp    $0x2,%eax
+  802373:	0f 97 c1             	seta   %cl
+  802376:	0f b6 c9             	movzbl %cl,%ecx
+  802379:	eb d7                	jmp    802352 <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  80237b:	b8 16 00 00 00       	mov    $0x16,%eax
+  802380:	be 00 00 00 00       	mov    $0x0,%esi
+  802385:	8b 55 08             	mov    0x8(%ebp),%edx
+  802388:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80238b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80238e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802391:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  802393:	eb 95                	jmp    80232a <sys_shm_attach+0x3c>
+
+00802395 <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  802395:	55                   	push   %ebp
+  802396:	89 e5                	mov    %esp,%ebp
+  802398:	57                   	push   %edi
+  802399:	56                   	push   %esi
+  80239a:	53                   	push   %ebx
+  80239b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80239e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8023a5:	78 38                	js     8023df <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  8023a7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8023ae:	74 7b                	je     80242b <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  8023b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8023b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023bb:	b8 17 00 00 00       	mov    $0x17,%eax
+  8023c0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8023c3:	89 f7                	mov    %esi,%edi
+  8023c5:	55                   	push   %ebp
+  8023c6:	68 cf 23 80 00       	push   $0x8023cf
+  8023cb:	89 e5                	mov    %esp,%ebp
+  8023cd:	0f 34                	sysenter
+  8023cf:	83 c4 04             	add    $0x4,%esp
+  8023d2:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8023d3:	85 c0                	test   %eax,%eax
+  8023d5:	7f 6d                	jg     802444 <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  8023d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023da:	5b                   	pop    %ebx
+  8023db:	5e                   	pop    %esi
+  8023dc:	5f                   	pop    %edi
+  8023dd:	5d                   	pop    %ebp
+  8023de:	c3                   	ret
+  8023df:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023e4:	0f a2                	cpuid
+		return 0;
+  8023e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8023eb:	f6 c6 08             	test   $0x8,%dh
+  8023ee:	74 15                	je     802405 <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023f0:	89 c2                	mov    %eax,%edx
+  8023f2:	c1 ea 08             	shr    $0x8,%edx
+  8023f5:	83 e2 0f             	and    $0xf,%edx
+  8023f8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8023fd:	83 fa 06             	cmp    $0x6,%edx
+  802400:	74 0e                	je     802410 <sys_shm_detach+0x7b>
+  802402:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802405:	0f b6 c9             	movzbl %cl,%ecx
+  802408:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80240e:	eb 97                	jmp    8023a7 <sys_shm_detach+0x12>
+  802410:	89 c2                	mov    %eax,%edx
+  802412:	c1 ea 04             	shr    $0x4,%edx
+  802415:	83 e2 0f             	and    $0xf,%edx
+  802418:	83 fa 02             	cmp    $0x2,%edx
+  80241b:	77 e5                	ja     802402 <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  80241d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802420:	83 f8 02             	cmp    $0x2,%eax
+  802423:	0f 97 c1             	seta   %cl
+  802426:	0f b6 c9             	movzbl %cl,%ecx
+  802429:	eb d7                	jmp    802402 <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  80242b:	be 00 00 00 00       	mov    $0x0,%esi
+  802430:	b8 17 00 00 00       	mov    $0x17,%eax
+  802435:	8b 55 08             	mov    0x8(%ebp),%edx
+  802438:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80243b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80243e:	89 f7                	mov    %esi,%edi
+  802440:	cd 30                	int    $0x30
+  802442:	eb 8f                	jmp    8023d3 <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802444:	83 ec 0c             	sub    $0xc,%esp
+  802447:	50                   	push   %eax
+  802448:	6a 17                	push   $0x17
+  80244a:	68 79 30 80 00       	push   $0x803079
+  80244f:	6a 4a                	push   $0x4a
+  802451:	68 96 30 80 00       	push   $0x803096
+  802456:	e8 78 e0 ff ff       	call   8004d3 <_panic>
+
+0080245b <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  80245b:	55                   	push   %ebp
+  80245c:	89 e5                	mov    %esp,%ebp
+  80245e:	57                   	push   %edi
+  80245f:	56                   	push   %esi
+  802460:	53                   	push   %ebx
+  802461:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802464:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80246b:	78 36                	js     8024a3 <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  80246d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802474:	74 79                	je     8024ef <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  802476:	8b 55 08             	mov    0x8(%ebp),%edx
+  802479:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80247e:	b8 18 00 00 00       	mov    $0x18,%eax
+  802483:	89 cb                	mov    %ecx,%ebx
+  802485:	89 cf                	mov    %ecx,%edi
+  802487:	89 ce                	mov    %ecx,%esi
+  802489:	55                   	push   %ebp
+  80248a:	68 93 24 80 00       	push   $0x802493
+  80248f:	89 e5                	mov    %esp,%ebp
+  802491:	0f 34                	sysenter
+  802493:	83 c4 04             	add    $0x4,%esp
+  802496:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802497:	85 c0                	test   %eax,%eax
+  802499:	7f 6b                	jg     802506 <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  80249b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80249e:	5b                   	pop    %ebx
+  80249f:	5e                   	pop    %esi
+  8024a0:	5f                   	pop    %edi
+  8024a1:	5d                   	pop    %ebp
+  8024a2:	c3                   	ret
+  8024a3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024a8:	0f a2                	cpuid
+		return 0;
+  8024aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8024af:	f6 c6 08             	test   $0x8,%dh
+  8024b2:	74 15                	je     8024c9 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8024b4:	89 c2                	mov    %eax,%edx
+  8024b6:	c1 ea 08             	shr    $0x8,%edx
+  8024b9:	83 e2 0f             	and    $0xf,%edx
+  8024bc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8024c1:	83 fa 06             	cmp    $0x6,%edx
+  8024c4:	74 0e                	je     8024d4 <sys_shm_remove+0x79>
+  8024c6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8024c9:	0f b6 c9             	movzbl %cl,%ecx
+  8024cc:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8024d2:	eb 99                	jmp    80246d <sys_shm_remove+0x12>
+  8024d4:	89 c2                	mov    %eax,%edx
+  8024d6:	c1 ea 04             	shr    $0x4,%edx
+  8024d9:	83 e2 0f             	and    $0xf,%edx
+  8024dc:	83 fa 02             	cmp    $0x2,%edx
+  8024df:	77 e5                	ja     8024c6 <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  8024e1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8024e4:	83 f8 02             	cmp    $0x2,%eax
+  8024e7:	0f 97 c1             	seta   %cl
+  8024ea:	0f b6 c9             	movzbl %cl,%ecx
+  8024ed:	eb d7                	jmp    8024c6 <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  8024ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024f4:	b8 18 00 00 00       	mov    $0x18,%eax
+  8024f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024fc:	89 cb                	mov    %ecx,%ebx
+  8024fe:	89 cf                	mov    %ecx,%edi
+  802500:	89 ce                	mov    %ecx,%esi
+  802502:	cd 30                	int    $0x30
+  802504:	eb 91                	jmp    802497 <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802506:	83 ec 0c             	sub    $0xc,%esp
+  802509:	50                   	push   %eax
+  80250a:	6a 18                	push   $0x18
+  80250c:	68 79 30 80 00       	push   $0x803079
+  802511:	6a 4a                	push   $0x4a
+  802513:	68 96 30 80 00       	push   $0x803096
+  802518:	e8 b6 df ff ff       	call   8004d3 <_panic>
+
+0080251d <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  80251d:	55                   	push   %ebp
+  80251e:	89 e5                	mov    %esp,%ebp
+  802520:	57                   	push   %edi
+  802521:	56                   	push   %esi
+  802522:	53                   	push   %ebx
+  802523:	83 ec 0c             	sub    $0xc,%esp
+  802526:	8b 45 10             	mov    0x10(%ebp),%eax
+  802529:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80252c:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  80252f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802536:	78 32                	js     80256a <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  802538:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80253f:	74 75                	je     8025b6 <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  802541:	8b 55 08             	mov    0x8(%ebp),%edx
+  802544:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802547:	b8 20 00 00 00       	mov    $0x20,%eax
+  80254c:	be 00 00 00 00       	mov    $0x0,%esi
+  802551:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802554:	55                   	push   %ebp
+  802555:	68 5e 25 80 00       	push   $0x80255e
+  80255a:	89 e5                	mov    %esp,%ebp
+  80255c:	0f 34                	sysenter
+  80255e:	83 c4 04             	add    $0x4,%esp
+  802561:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  802562:	83 c4 0c             	add    $0xc,%esp
+  802565:	5b                   	pop    %ebx
+  802566:	5e                   	pop    %esi
+  802567:	5f                   	pop    %edi
+  802568:	5d                   	pop    %ebp
+  802569:	c3                   	ret
+  80256a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80256f:	0f a2                	cpuid
+		return 0;
+  802571:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802576:	f6 c6 08             	test   $0x8,%dh
+  802579:	74 15                	je     802590 <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80257b:	89 c2                	mov    %eax,%edx
+  80257d:	c1 ea 08             	shr    $0x8,%edx
+  802580:	83 e2 0f             	and    $0xf,%edx
+  802583:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802588:	83 fa 06             	cmp    $0x6,%edx
+  80258b:	74 0e                	je     80259b <sys_futex_wait+0x7e>
+  80258d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802590:	0f b6 c9             	movzbl %cl,%ecx
+  802593:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802599:	eb 9d                	jmp    802538 <sys_futex_wait+0x1b>
+  80259b:	89 c2                	mov    %eax,%edx
+  80259d:	c1 ea 04             	shr    $0x4,%edx
+  8025a0:	83 e2 0f             	and    $0xf,%edx
+  8025a3:	83 fa 02             	cmp    $0x2,%edx
+  8025a6:	77 e5                	ja     80258d <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  8025a8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025ab:	83 f8 02             	cmp    $0x2,%eax
+  8025ae:	0f 97 c1             	seta   %cl
+  8025b1:	0f b6 c9             	movzbl %cl,%ecx
+  8025b4:	eb d7                	jmp    80258d <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  8025b6:	b8 20 00 00 00       	mov    $0x20,%eax
+  8025bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8025c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025c6:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8025c9:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  8025cb:	eb 95                	jmp    802562 <sys_futex_wait+0x45>
+
+008025cd <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8025cd:	55                   	push   %ebp
+  8025ce:	89 e5                	mov    %esp,%ebp
+  8025d0:	57                   	push   %edi
+  8025d1:	56                   	push   %esi
+  8025d2:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8025d3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8025da:	78 30                	js     80260c <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  8025dc:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8025e3:	74 73                	je     802658 <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  8025e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025f0:	b8 21 00 00 00       	mov    $0x21,%eax
+  8025f5:	89 df                	mov    %ebx,%edi
+  8025f7:	89 de                	mov    %ebx,%esi
+  8025f9:	55                   	push   %ebp
+  8025fa:	68 03 26 80 00       	push   $0x802603
+  8025ff:	89 e5                	mov    %esp,%ebp
+  802601:	0f 34                	sysenter
+  802603:	83 c4 04             	add    $0x4,%esp
+  802606:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  802607:	5b                   	pop    %ebx
+  802608:	5e                   	pop    %esi
+  802609:	5f                   	pop    %edi
+  80260a:	5d                   	pop    %ebp
+  80260b:	c3                   	ret
+  80260c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802611:	0f a2                	cpuid
+		return 0;
+  802613:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802618:	f6 c6 08             	test   $0x8,%dh
+  80261b:	74 15                	je     802632 <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80261d:	89 c2                	mov    %eax,%edx
+  80261f:	c1 ea 08             	shr    $0x8,%edx
+  802622:	83 e2 0f             	and    $0xf,%edx
+  802625:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80262a:	83 fa 06             	cmp    $0x6,%edx
+  80262d:	74 0e                	je     80263d <sys_futex_wake+0x70>
+  80262f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802632:	0f b6 c9             	movzbl %cl,%ecx
+  802635:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80263b:	eb 9f                	jmp    8025dc <sys_futex_wake+0xf>
+  80263d:	89 c2                	mov    %eax,%edx
+  80263f:	c1 ea 04             	shr    $0x4,%edx
+  802642:	83 e2 0f             	and    $0xf,%edx
+  802645:	83 fa 02             	cmp    $0x2,%edx
+  802648:	77 e5                	ja     80262f <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  80264a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80264d:	83 f8 02             	cmp    $0x2,%eax
+  802650:	0f 97 c1             	seta   %cl
+  802653:	0f b6 c9             	movzbl %cl,%ecx
+  802656:	eb d7                	jmp    80262f <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  802658:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80265d:	b8 21 00 00 00       	mov    $0x21,%eax
+  802662:	8b 55 08             	mov    0x8(%ebp),%edx
+  802665:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802668:	89 df                	mov    %ebx,%edi
+  80266a:	89 de                	mov    %ebx,%esi
+  80266c:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  80266e:	eb 97                	jmp    802607 <sys_futex_wake+0x3a>
+
+00802670 <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  802670:	55                   	push   %ebp
+  802671:	89 e5                	mov    %esp,%ebp
+  802673:	57                   	push   %edi
+  802674:	56                   	push   %esi
+  802675:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802676:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80267d:	78 2e                	js     8026ad <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  80267f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802686:	74 71                	je     8026f9 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  802688:	ba 00 00 00 00       	mov    $0x0,%edx
+  80268d:	b8 22 00 00 00       	mov    $0x22,%eax
+  802692:	89 d1                	mov    %edx,%ecx
+  802694:	89 d3                	mov    %edx,%ebx
+  802696:	89 d7                	mov    %edx,%edi
+  802698:	89 d6                	mov    %edx,%esi
+  80269a:	55                   	push   %ebp
+  80269b:	68 a4 26 80 00       	push   $0x8026a4
+  8026a0:	89 e5                	mov    %esp,%ebp
+  8026a2:	0f 34                	sysenter
+  8026a4:	83 c4 04             	add    $0x4,%esp
+  8026a7:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  8026a8:	5b                   	pop    %ebx
+  8026a9:	5e                   	pop    %esi
+  8026aa:	5f                   	pop    %edi
+  8026ab:	5d                   	pop    %ebp
+  8026ac:	c3                   	ret
+  8026ad:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026b2:	0f a2                	cpuid
+		return 0;
+  8026b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8026b9:	f6 c6 08             	test   $0x8,%dh
+  8026bc:	74 15                	je     8026d3 <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8026be:	89 c2                	mov    %eax,%edx
+  8026c0:	c1 ea 08             	shr    $0x8,%edx
+  8026c3:	83 e2 0f             	and    $0xf,%edx
+  8026c6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8026cb:	83 fa 06             	cmp    $0x6,%edx
+  8026ce:	74 0e                	je     8026de <sys_ep_create+0x6e>
+  8026d0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8026d3:	0f b6 c9             	movzbl %cl,%ecx
+  8026d6:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8026dc:	eb a1                	jmp    80267f <sys_ep_create+0xf>
+  8026de:	89 c2                	mov    %eax,%edx
+  8026e0:	c1 ea 04             	shr    $0x4,%edx
+  8026e3:	83 e2 0f             	and    $0xf,%edx
+  8026e6:	83 fa 02             	cmp    $0x2,%edx
+  8026e9:	77 e5                	ja     8026d0 <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  8026eb:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8026ee:	83 f8 02             	cmp    $0x2,%eax
+  8026f1:	0f 97 c1             	seta   %cl
+  8026f4:	0f b6 c9             	movzbl %cl,%ecx
+  8026f7:	eb d7                	jmp    8026d0 <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  8026f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026fe:	b8 22 00 00 00       	mov    $0x22,%eax
+  802703:	89 d1                	mov    %edx,%ecx
+  802705:	89 d3                	mov    %edx,%ebx
+  802707:	89 d7                	mov    %edx,%edi
+  802709:	89 d6                	mov    %edx,%esi
+  80270b:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  80270d:	eb 99                	jmp    8026a8 <sys_ep_create+0x38>
+
+0080270f <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  80270f:	55                   	push   %ebp
+  802710:	89 e5                	mov    %esp,%ebp
+  802712:	57                   	push   %edi
+  802713:	56                   	push   %esi
+  802714:	53                   	push   %ebx
+  802715:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802718:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80271f:	78 36                	js     802757 <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  802721:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802728:	74 79                	je     8027a3 <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  80272a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80272d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802732:	b8 23 00 00 00       	mov    $0x23,%eax
+  802737:	89 cb                	mov    %ecx,%ebx
+  802739:	89 cf                	mov    %ecx,%edi
+  80273b:	89 ce                	mov    %ecx,%esi
+  80273d:	55                   	push   %ebp
+  80273e:	68 47 27 80 00       	push   $0x802747
+  802743:	89 e5                	mov    %esp,%ebp
+  802745:	0f 34                	sysenter
+  802747:	83 c4 04             	add    $0x4,%esp
+  80274a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80274b:	85 c0                	test   %eax,%eax
+  80274d:	7f 6b                	jg     8027ba <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  80274f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802752:	5b                   	pop    %ebx
+  802753:	5e                   	pop    %esi
+  802754:	5f                   	pop    %edi
+  802755:	5d                   	pop    %ebp
+  802756:	c3                   	ret
+  802757:	b8 01 00 00 00       	mov    $0x1,%eax
+  80275c:	0f a2                	cpuid
+		return 0;
+  80275e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802763:	f6 c6 08             	test   $0x8,%dh
+  802766:	74 15                	je     80277d <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802768:	89 c2                	mov    %eax,%edx
+  80276a:	c1 ea 08             	shr    $0x8,%edx
+  80276d:	83 e2 0f             	and    $0xf,%edx
+  802770:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802775:	83 fa 06             	cmp    $0x6,%edx
+  802778:	74 0e                	je     802788 <sys_ep_destroy+0x79>
+  80277a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80277d:	0f b6 c9             	movzbl %cl,%ecx
+  802780:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802786:	eb 99                	jmp    802721 <sys_ep_destroy+0x12>
+  802788:	89 c2                	mov    %eax,%edx
+  80278a:	c1 ea 04             	shr    $0x4,%edx
+  80278d:	83 e2 0f             	and    $0xf,%edx
+  802790:	83 fa 02             	cmp    $0x2,%edx
+  802793:	77 e5                	ja     80277a <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  802795:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802798:	83 f8 02             	cmp    $0x2,%eax
+  80279b:	0f 97 c1             	seta   %cl
+  80279e:	0f b6 c9             	movzbl %cl,%ecx
+  8027a1:	eb d7                	jmp    80277a <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  8027a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027a8:	b8 23 00 00 00       	mov    $0x23,%eax
+  8027ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8027b0:	89 cb                	mov    %ecx,%ebx
+  8027b2:	89 cf                	mov    %ecx,%edi
+  8027b4:	89 ce                	mov    %ecx,%esi
+  8027b6:	cd 30                	int    $0x30
+  8027b8:	eb 91                	jmp    80274b <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8027ba:	83 ec 0c             	sub    $0xc,%esp
+  8027bd:	50                   	push   %eax
+  8027be:	6a 23                	push   $0x23
+  8027c0:	68 79 30 80 00       	push   $0x803079
+  8027c5:	6a 4a                	push   $0x4a
+  8027c7:	68 96 30 80 00       	push   $0x803096
+  8027cc:	e8 02 dd ff ff       	call   8004d3 <_panic>
+
+008027d1 <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  8027d1:	55                   	push   %ebp
+  8027d2:	89 e5                	mov    %esp,%ebp
+  8027d4:	57                   	push   %edi
+  8027d5:	56                   	push   %esi
+  8027d6:	53                   	push   %ebx
+  8027d7:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8027da:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8027e1:	78 37                	js     80281a <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  8027e3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8027ea:	74 7a                	je     802866 <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  8027ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8027f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027f7:	b8 24 00 00 00       	mov    $0x24,%eax
+  8027fc:	89 df                	mov    %ebx,%edi
+  8027fe:	89 de                	mov    %ebx,%esi
+  802800:	55                   	push   %ebp
+  802801:	68 0a 28 80 00       	push   $0x80280a
+  802806:	89 e5                	mov    %esp,%ebp
+  802808:	0f 34                	sysenter
+  80280a:	83 c4 04             	add    $0x4,%esp
+  80280d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80280e:	85 c0                	test   %eax,%eax
+  802810:	7f 6c                	jg     80287e <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  802812:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802815:	5b                   	pop    %ebx
+  802816:	5e                   	pop    %esi
+  802817:	5f                   	pop    %edi
+  802818:	5d                   	pop    %ebp
+  802819:	c3                   	ret
+  80281a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80281f:	0f a2                	cpuid
+		return 0;
+  802821:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802826:	f6 c6 08             	test   $0x8,%dh
+  802829:	74 15                	je     802840 <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80282b:	89 c2                	mov    %eax,%edx
+  80282d:	c1 ea 08             	shr    $0x8,%edx
+  802830:	83 e2 0f             	and    $0xf,%edx
+  802833:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802838:	83 fa 06             	cmp    $0x6,%edx
+  80283b:	74 0e                	je     80284b <sys_ep_grant+0x7a>
+  80283d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802840:	0f b6 c9             	movzbl %cl,%ecx
+  802843:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802849:	eb 98                	jmp    8027e3 <sys_ep_grant+0x12>
+  80284b:	89 c2                	mov    %eax,%edx
+  80284d:	c1 ea 04             	shr    $0x4,%edx
+  802850:	83 e2 0f             	and    $0xf,%edx
+  802853:	83 fa 02             	cmp    $0x2,%edx
+  802856:	77 e5                	ja     80283d <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  802858:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80285b:	83 f8 02             	cmp    $0x2,%eax
+  80285e:	0f 97 c1             	seta   %cl
+  802861:	0f b6 c9             	movzbl %cl,%ecx
+  802864:	eb d7                	jmp    80283d <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  802866:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80286b:	b8 24 00 00 00       	mov    $0x24,%eax
+  802870:	8b 55 08             	mov    0x8(%ebp),%edx
+  802873:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802876:	89 df                	mov    %ebx,%edi
+  802878:	89 de                	mov    %ebx,%esi
+  80287a:	cd 30                	int    $0x30
+  80287c:	eb 90                	jmp    80280e <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80287e:	83 ec 0c             	sub    $0xc,%esp
+  802881:	50                   	push   %eax
+  802882:	6a 24                	push   $0x24
+  802884:	68 79 30 80 00       	push   $0x803079
+  802889:	6a 4a                	push   $0x4a
+  80288b:	68 96 30 80 00       	push   $0x803096
+  802890:	e8 3e dc ff ff       	call   8004d3 <_panic>
+
+00802895 <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  802895:	55                   	push   %ebp
+  802896:	89 e5                	mov    %esp,%ebp
+  802898:	57                   	push   %edi
+  802899:	56                   	push   %esi
+  80289a:	53                   	push   %ebx
+  80289b:	83 ec 20             	sub    $0x20,%esp
+  80289e:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  8028a1:	8b 10                	mov    (%eax),%edx
+  8028a3:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8028a6:	8b 50 04             	mov    0x4(%eax),%edx
+  8028a9:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8028ac:	8b 50 08             	mov    0x8(%eax),%edx
+  8028af:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  8028b2:	8b 50 0c             	mov    0xc(%eax),%edx
+  8028b5:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  8028b8:	8b 40 10             	mov    0x10(%eax),%eax
+  8028bb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  8028be:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  8028c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8028c4:	b8 25 00 00 00       	mov    $0x25,%eax
+  8028c9:	55                   	push   %ebp
+  8028ca:	56                   	push   %esi
+  8028cb:	8b 0e                	mov    (%esi),%ecx
+  8028cd:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8028d0:	8b 7e 08             	mov    0x8(%esi),%edi
+  8028d3:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8028d6:	8b 76 0c             	mov    0xc(%esi),%esi
+  8028d9:	cd 30                	int    $0x30
+  8028db:	87 34 24             	xchg   %esi,(%esp)
+  8028de:	89 0e                	mov    %ecx,(%esi)
+  8028e0:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8028e3:	89 7e 08             	mov    %edi,0x8(%esi)
+  8028e6:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8028e9:	8f 46 0c             	pop    0xc(%esi)
+  8028ec:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  8028ed:	83 c4 20             	add    $0x20,%esp
+  8028f0:	5b                   	pop    %ebx
+  8028f1:	5e                   	pop    %esi
+  8028f2:	5f                   	pop    %edi
+  8028f3:	5d                   	pop    %ebp
+  8028f4:	c3                   	ret
+
+008028f5 <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  8028f5:	55                   	push   %ebp
+  8028f6:	89 e5                	mov    %esp,%ebp
+  8028f8:	57                   	push   %edi
+  8028f9:	56                   	push   %esi
+  8028fa:	53                   	push   %ebx
+  8028fb:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  8028fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802901:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  802903:	8b 55 08             	mov    0x8(%ebp),%edx
+  802906:	b8 26 00 00 00       	mov    $0x26,%eax
+  80290b:	55                   	push   %ebp
+  80290c:	56                   	push   %esi
+  80290d:	8b 0e                	mov    (%esi),%ecx
+  80290f:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802912:	8b 7e 08             	mov    0x8(%esi),%edi
+  802915:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802918:	8b 76 0c             	mov    0xc(%esi),%esi
+  80291b:	cd 30                	int    $0x30
+  80291d:	87 34 24             	xchg   %esi,(%esp)
+  802920:	89 0e                	mov    %ecx,(%esi)
+  802922:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802925:	89 7e 08             	mov    %edi,0x8(%esi)
+  802928:	89 6e 10             	mov    %ebp,0x10(%esi)
+  80292b:	8f 46 0c             	pop    0xc(%esi)
+  80292e:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  80292f:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  802933:	74 0f                	je     802944 <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  802935:	85 c0                	test   %eax,%eax
+  802937:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80293c:	0f 48 d1             	cmovs  %ecx,%edx
+  80293f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  802942:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  802944:	5b                   	pop    %ebx
+  802945:	5e                   	pop    %esi
+  802946:	5f                   	pop    %edi
+  802947:	5d                   	pop    %ebp
+  802948:	c3                   	ret
+
+00802949 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  802949:	55                   	push   %ebp
+  80294a:	89 e5                	mov    %esp,%ebp
+  80294c:	57                   	push   %edi
+  80294d:	56                   	push   %esi
+  80294e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80294f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802956:	78 2f                	js     802987 <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  802958:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80295f:	74 72                	je     8029d3 <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  802961:	8b 55 08             	mov    0x8(%ebp),%edx
+  802964:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802969:	b8 27 00 00 00       	mov    $0x27,%eax
+  80296e:	89 cb                	mov    %ecx,%ebx
+  802970:	89 cf                	mov    %ecx,%edi
+  802972:	89 ce                	mov    %ecx,%esi
+  802974:	55                   	push   %ebp
+  802975:	68 7e 29 80 00       	push   $0x80297e
+  80297a:	89 e5                	mov    %esp,%ebp
+  80297c:	0f 34                	sysenter
+  80297e:	83 c4 04             	add    $0x4,%esp
+  802981:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  802982:	5b                   	pop    %ebx
+  802983:	5e                   	pop    %esi
+  802984:	5f                   	pop    %edi
+  802985:	5d                   	pop    %ebp
+  802986:	c3                   	ret
+  802987:	b8 01 00 00 00       	mov    $0x1,%eax
+  80298c:	0f a2                	cpuid
+		return 0;
+  80298e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802993:	f6 c6 08             	test   $0x8,%dh
+  802996:	74 15                	je     8029ad <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802998:	89 c2                	mov    %eax,%edx
+  80299a:	c1 ea 08             	shr    $0x8,%edx
+  80299d:	83 e2 0f             	and    $0xf,%edx
+  8029a0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8029a5:	83 fa 06             	cmp    $0x6,%edx
+  8029a8:	74 0e                	je     8029b8 <sys_sysring_setup+0x6f>
+  8029aa:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8029ad:	0f b6 c9             	movzbl %cl,%ecx
+  8029b0:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8029b6:	eb a0                	jmp    802958 <sys_sysring_setup+0xf>
+  8029b8:	89 c2                	mov    %eax,%edx
+  8029ba:	c1 ea 04             	shr    $0x4,%edx
+  8029bd:	83 e2 0f             	and    $0xf,%edx
+  8029c0:	83 fa 02             	cmp    $0x2,%edx
+  8029c3:	77 e5                	ja     8029aa <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  8029c5:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8029c8:	83 f8 02             	cmp    $0x2,%eax
+  8029cb:	0f 97 c1             	seta   %cl
+  8029ce:	0f b6 c9             	movzbl %cl,%ecx
+  8029d1:	eb d7                	jmp    8029aa <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  8029d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029d8:	b8 27 00 00 00       	mov    $0x27,%eax
+  8029dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8029e0:	89 cb                	mov    %ecx,%ebx
+  8029e2:	89 cf                	mov    %ecx,%edi
+  8029e4:	89 ce                	mov    %ecx,%esi
+  8029e6:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  8029e8:	eb 98                	jmp    802982 <sys_sysring_setup+0x39>
+
+008029ea <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  8029ea:	55                   	push   %ebp
+  8029eb:	89 e5                	mov    %esp,%ebp
+  8029ed:	57                   	push   %edi
+  8029ee:	56                   	push   %esi
+  8029ef:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8029f0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8029f7:	78 2e                	js     802a27 <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  8029f9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802a00:	74 71                	je     802a73 <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  802a02:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a07:	b8 28 00 00 00       	mov    $0x28,%eax
+  802a0c:	89 d1                	mov    %edx,%ecx
+  802a0e:	89 d3                	mov    %edx,%ebx
+  802a10:	89 d7                	mov    %edx,%edi
+  802a12:	89 d6                	mov    %edx,%esi
+  802a14:	55                   	push   %ebp
+  802a15:	68 1e 2a 80 00       	push   $0x802a1e
+  802a1a:	89 e5                	mov    %esp,%ebp
+  802a1c:	0f 34                	sysenter
+  802a1e:	83 c4 04             	add    $0x4,%esp
+  802a21:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  802a22:	5b                   	pop    %ebx
+  802a23:	5e                   	pop    %esi
+  802a24:	5f                   	pop    %edi
+  802a25:	5d                   	pop    %ebp
+  802a26:	c3                   	ret
+  802a27:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a2c:	0f a2                	cpuid
+		return 0;
+  802a2e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802a33:	f6 c6 08             	test   $0x8,%dh
+  802a36:	74 15                	je     802a4d <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802a38:	89 c2                	mov    %eax,%edx
+  802a3a:	c1 ea 08             	shr    $0x8,%edx
+  802a3d:	83 e2 0f             	and    $0xf,%edx
+  802a40:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802a45:	83 fa 06             	cmp    $0x6,%edx
+  802a48:	74 0e                	je     802a58 <sys_sysring_enter+0x6e>
+  802a4a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802a4d:	0f b6 c9             	movzbl %cl,%ecx
+  802a50:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802a56:	eb a1                	jmp    8029f9 <sys_sysring_enter+0xf>
+  802a58:	89 c2                	mov    %eax,%edx
+  802a5a:	c1 ea 04             	shr    $0x4,%edx
+  802a5d:	83 e2 0f             	and    $0xf,%edx
+  802a60:	83 fa 02             	cmp    $0x2,%edx
+  802a63:	77 e5                	ja     802a4a <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  802a65:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802a68:	83 f8 02             	cmp    $0x2,%eax
+  802a6b:	0f 97 c1             	seta   %cl
+  802a6e:	0f b6 c9             	movzbl %cl,%ecx
+  802a71:	eb d7                	jmp    802a4a <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  802a73:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a78:	b8 28 00 00 00       	mov    $0x28,%eax
+  802a7d:	89 d1                	mov    %edx,%ecx
+  802a7f:	89 d3                	mov    %edx,%ebx
+  802a81:	89 d7                	mov    %edx,%edi
+  802a83:	89 d6                	mov    %edx,%esi
+  802a85:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  802a87:	eb 99                	jmp    802a22 <sys_sysring_enter+0x38>
+
+00802a89 <dm>:
+  802a89:	55                   	push   %ebp
+  802a8a:	57                   	push   %edi
+  802a8b:	56                   	push   %esi
+  802a8c:	53                   	push   %ebx
+  802a8d:	83 ec 24             	sub    $0x24,%esp
+  802a90:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802a94:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802a98:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802a9c:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802aa0:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802aa4:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802aa8:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802aac:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ab1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ab6:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802abb:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802ac2:	00 
+  802ac3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802aca:	00 
+  802acb:	89 fb                	mov    %edi,%ebx
+  802acd:	eb 08                	jmp    802ad7 <dm+0x4e>
+  802acf:	83 e9 01             	sub    $0x1,%ecx
+  802ad2:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802ad5:	74 68                	je     802b3f <dm+0xb6>
+  802ad7:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802adb:	01 c0                	add    %eax,%eax
+  802add:	89 c6                	mov    %eax,%esi
+  802adf:	89 d7                	mov    %edx,%edi
+  802ae1:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802ae5:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802ae9:	0f ad d0             	shrd   %cl,%edx,%eax
+  802aec:	d3 ea                	shr    %cl,%edx
+  802aee:	f6 c1 20             	test   $0x20,%cl
+  802af1:	74 04                	je     802af7 <dm+0x6e>
+  802af3:	89 d0                	mov    %edx,%eax
+  802af5:	31 d2                	xor    %edx,%edx
+  802af7:	83 e0 01             	and    $0x1,%eax
+  802afa:	89 04 24             	mov    %eax,(%esp)
+  802afd:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802b04:	00 
+  802b05:	8b 04 24             	mov    (%esp),%eax
+  802b08:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802b0c:	09 f0                	or     %esi,%eax
+  802b0e:	09 fa                	or     %edi,%edx
+  802b10:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802b14:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802b18:	39 f0                	cmp    %esi,%eax
+  802b1a:	89 d5                	mov    %edx,%ebp
+  802b1c:	19 fd                	sbb    %edi,%ebp
+  802b1e:	72 af                	jb     802acf <dm+0x46>
+  802b20:	29 f0                	sub    %esi,%eax
+  802b22:	19 fa                	sbb    %edi,%edx
+  802b24:	89 cf                	mov    %ecx,%edi
+  802b26:	c1 ef 05             	shr    $0x5,%edi
+  802b29:	83 e7 01             	and    $0x1,%edi
+  802b2c:	89 fe                	mov    %edi,%esi
+  802b2e:	83 f6 01             	xor    $0x1,%esi
+  802b31:	d3 e6                	shl    %cl,%esi
+  802b33:	d3 e7                	shl    %cl,%edi
+  802b35:	09 74 24 18          	or     %esi,0x18(%esp)
+  802b39:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802b3d:	eb 90                	jmp    802acf <dm+0x46>
+  802b3f:	85 db                	test   %ebx,%ebx
+  802b41:	74 05                	je     802b48 <dm+0xbf>
+  802b43:	89 03                	mov    %eax,(%ebx)
+  802b45:	89 53 04             	mov    %edx,0x4(%ebx)
+  802b48:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802b4c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802b50:	83 c4 24             	add    $0x24,%esp
+  802b53:	5b                   	pop    %ebx
+  802b54:	5e                   	pop    %esi
+  802b55:	5f                   	pop    %edi
+  802b56:	5d                   	pop    %ebp
+  802b57:	c3                   	ret
+
+00802b58 <__udivdi3>:
+  802b58:	83 ec 08             	sub    $0x8,%esp
+  802b5b:	6a 00                	push   $0x0
+  802b5d:	ff 74 24 1c          	push   0x1c(%esp)
+  802b61:	ff 74 24 1c          	push   0x1c(%esp)
+  802b65:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802b69:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802b6d:	e8 17 ff ff ff       	call   802a89 <dm>
+  802b72:	83 c4 14             	add    $0x14,%esp
+  802b75:	c3                   	ret
+
+00802b76 <__umoddi3>:
+  802b76:	83 ec 18             	sub    $0x18,%esp
+  802b79:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802b7d:	50                   	push   %eax
+  802b7e:	ff 74 24 2c          	push   0x2c(%esp)
+  802b82:	ff 74 24 2c          	push   0x2c(%esp)
+  802b86:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802b8a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802b8e:	e8 f6 fe ff ff       	call   802a89 <dm>
+  802b93:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802b97:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802b9b:	83 c4 24             	add    $0x24,%esp
+  802b9e:	c3                   	ret
+
+00802b9f <__divdi3>:
+  802b9f:	53                   	push   %ebx
+  802ba0:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802ba4:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802ba8:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  802bac:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  802bb0:	85 d2                	test   %edx,%edx
+  802bb2:	78 15                	js     802bc9 <__divdi3+0x2a>
+  802bb4:	85 db                	test   %ebx,%ebx
+  802bb6:	78 34                	js     802bec <__divdi3+0x4d>
+  802bb8:	83 ec 04             	sub    $0x4,%esp
+  802bbb:	6a 00                	push   $0x0
+  802bbd:	53                   	push   %ebx
+  802bbe:	51                   	push   %ecx
+  802bbf:	e8 c5 fe ff ff       	call   802a89 <dm>
+  802bc4:	83 c4 10             	add    $0x10,%esp
+  802bc7:	eb 21                	jmp    802bea <__divdi3+0x4b>
+  802bc9:	f7 d8                	neg    %eax
+  802bcb:	83 d2 00             	adc    $0x0,%edx
+  802bce:	f7 da                	neg    %edx
+  802bd0:	85 db                	test   %ebx,%ebx
+  802bd2:	78 30                	js     802c04 <__divdi3+0x65>
+  802bd4:	83 ec 04             	sub    $0x4,%esp
+  802bd7:	6a 00                	push   $0x0
+  802bd9:	53                   	push   %ebx
+  802bda:	51                   	push   %ecx
+  802bdb:	e8 a9 fe ff ff       	call   802a89 <dm>
+  802be0:	83 c4 10             	add    $0x10,%esp
+  802be3:	f7 d8                	neg    %eax
+  802be5:	83 d2 00             	adc    $0x0,%edx
+  802be8:	f7 da                	neg    %edx
+  802bea:	5b                   	pop    %ebx
+  802beb:	c3                   	ret
+  802bec:	83 ec 04             	sub    $0x4,%esp
+  802bef:	6a 00                	push   $0x0
+  802bf1:	f7 d9                	neg    %ecx
+  802bf3:	83 d3 00             	adc    $0x0,%ebx
+  802bf6:	f7 db                	neg    %ebx
+  802bf8:	53                   	push   %ebx
+  802bf9:	51                   	push   %ecx
+  802bfa:	e8 8a fe ff ff       	call   802a89 <dm>
+  802bff:	83 c4 10             	add    $0x10,%esp
+  802c02:	eb df                	jmp    802be3 <__divdi3+0x44>
+  802c04:	83 ec 04             	sub    $0x4,%esp
+  802c07:	6a 00                	push   $0x0
+  802c09:	f7 d9                	neg    %ecx
+  802c0b:	83 d3 00             	adc    $0x0,%ebx
+  802c0e:	f7 db                	neg    %ebx
+  802c10:	53                   	push   %ebx
+  802c11:	51                   	push   %ecx
+  802c12:	e8 72 fe ff ff       	call   802a89 <dm>
+  802c17:	83 c4 10             	add    $0x10,%esp
+  802c1a:	eb ce                	jmp    802bea <__divdi3+0x4b>
+
+00802c1c <__moddi3>:
+  802c1c:	55                   	push   %ebp
+  802c1d:	57                   	push   %edi
+  802c1e:	56                   	push   %esi
+  802c1f:	53                   	push   %ebx
+  802c20:	83 ec 18             	sub    $0x18,%esp
+  802c23:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802c27:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802c2b:	89 f1                	mov    %esi,%ecx
+  802c2d:	f7 d9                	neg    %ecx
+  802c2f:	89 da                	mov    %ebx,%edx
+  802c31:	83 d2 00             	adc    $0x0,%edx
+  802c34:	f7 da                	neg    %edx
+  802c36:	0f 48 ce             	cmovs  %esi,%ecx
+  802c39:	0f 48 d3             	cmovs  %ebx,%edx
+  802c3c:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802c40:	50                   	push   %eax
+  802c41:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802c45:	f7 de                	neg    %esi
+  802c47:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802c4b:	83 d0 00             	adc    $0x0,%eax
+  802c4e:	f7 d8                	neg    %eax
+  802c50:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802c55:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802c5a:	50                   	push   %eax
+  802c5b:	56                   	push   %esi
+  802c5c:	89 c8                	mov    %ecx,%eax
+  802c5e:	e8 26 fe ff ff       	call   802a89 <dm>
+  802c63:	83 c4 10             	add    $0x10,%esp
+  802c66:	85 db                	test   %ebx,%ebx
+  802c68:	78 10                	js     802c7a <__moddi3+0x5e>
+  802c6a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802c6e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802c72:	83 c4 14             	add    $0x14,%esp
+  802c75:	5b                   	pop    %ebx
+  802c76:	5e                   	pop    %esi
+  802c77:	5f                   	pop    %edi
+  802c78:	5d                   	pop    %ebp
+  802c79:	c3                   	ret
+  802c7a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802c7e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802c82:	f7 d8                	neg    %eax
+  802c84:	83 d2 00             	adc    $0x0,%edx
+  802c87:	f7 da                	neg    %edx
+  802c89:	eb e7                	jmp    802c72 <__moddi3+0x56>
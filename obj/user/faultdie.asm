@@ -0,0 +1,5282 @@
+
+obj/user/faultdie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 4f 00 00 00       	call   800080 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <handler>:
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 0c             	sub    $0xc,%esp
+  800039:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void*)utf->utf_fault_va;
+	uint32_t err = utf->utf_err;
+	cprintf("i faulted at va %x, err %x\n", addr, err & 7);
+  80003c:	8b 42 04             	mov    0x4(%edx),%eax
+  80003f:	83 e0 07             	and    $0x7,%eax
+  800042:	50                   	push   %eax
+  800043:	ff 32                	push   (%edx)
+  800045:	68 40 29 80 00       	push   $0x802940
+  80004a:	e8 21 01 00 00       	call   800170 <cprintf>
+	sys_env_destroy(sys_getenvid());
+  80004f:	e8 a0 0e 00 00       	call   800ef4 <sys_getenvid>
+  800054:	89 04 24             	mov    %eax,(%esp)
+  800057:	e8 d6 0d 00 00       	call   800e32 <sys_env_destroy>
+}
+  80005c:	83 c4 10             	add    $0x10,%esp
+  80005f:	c9                   	leave
+  800060:	c3                   	ret
+
+00800061 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800061:	55                   	push   %ebp
+  800062:	89 e5                	mov    %esp,%ebp
+  800064:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(handler);
+  800067:	68 33 00 80 00       	push   $0x800033
+  80006c:	e8 a1 25 00 00       	call   802612 <set_pgfault_handler>
+	*(int*)0xDeadBeef = 0;
+  800071:	c7 05 ef be ad de 00 	movl   $0x0,0xdeadbeef
+  800078:	00 00 00 
+}
+  80007b:	83 c4 10             	add    $0x10,%esp
+  80007e:	c9                   	leave
+  80007f:	c3                   	ret
+
+00800080 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800080:	55                   	push   %ebp
+  800081:	89 e5                	mov    %esp,%ebp
+  800083:	56                   	push   %esi
+  800084:	53                   	push   %ebx
+  800085:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800088:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  80008b:	e8 64 0e 00 00       	call   800ef4 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  800090:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800095:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  80009b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000a0:	a3 08 30 80 00       	mov    %eax,0x803008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000a5:	85 db                	test   %ebx,%ebx
+  8000a7:	7e 07                	jle    8000b0 <libmain+0x30>
+		binaryname = argv[0];
+  8000a9:	8b 06                	mov    (%esi),%eax
+  8000ab:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  8000b0:	83 ec 08             	sub    $0x8,%esp
+  8000b3:	56                   	push   %esi
+  8000b4:	53                   	push   %ebx
+  8000b5:	e8 a7 ff ff ff       	call   800061 <umain>
+
+	// exit gracefully
+	exit();
+  8000ba:	e8 0a 00 00 00       	call   8000c9 <exit>
+}
+  8000bf:	83 c4 10             	add    $0x10,%esp
+  8000c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000c5:	5b                   	pop    %ebx
+  8000c6:	5e                   	pop    %esi
+  8000c7:	5d                   	pop    %ebp
+  8000c8:	c3                   	ret
+
+008000c9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000c9:	55                   	push   %ebp
+  8000ca:	89 e5                	mov    %esp,%ebp
+  8000cc:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  8000cf:	6a 00                	push   $0x0
+  8000d1:	e8 5c 0d 00 00       	call   800e32 <sys_env_destroy>
+}
+  8000d6:	83 c4 10             	add    $0x10,%esp
+  8000d9:	c9                   	leave
+  8000da:	c3                   	ret
+
+008000db <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000db:	55                   	push   %ebp
+  8000dc:	89 e5                	mov    %esp,%ebp
+  8000de:	53                   	push   %ebx
+  8000df:	83 ec 04             	sub    $0x4,%esp
+  8000e2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8000e5:	8b 13                	mov    (%ebx),%edx
+  8000e7:	8d 42 01             	lea    0x1(%edx),%eax
+  8000ea:	89 03                	mov    %eax,(%ebx)
+  8000ec:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000ef:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8000f3:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8000f8:	74 09                	je     800103 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8000fa:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8000fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800101:	c9                   	leave
+  800102:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800103:	83 ec 08             	sub    $0x8,%esp
+  800106:	68 ff 00 00 00       	push   $0xff
+  80010b:	8d 43 08             	lea    0x8(%ebx),%eax
+  80010e:	50                   	push   %eax
+  80010f:	e8 e2 0b 00 00       	call   800cf6 <sys_cputs>
+		b->idx = 0;
+  800114:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80011a:	83 c4 10             	add    $0x10,%esp
+  80011d:	eb db                	jmp    8000fa <putch+0x1f>
+
+0080011f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80011f:	55                   	push   %ebp
+  800120:	89 e5                	mov    %esp,%ebp
+  800122:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800128:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80012f:	00 00 00 
+	b.cnt = 0;
+  800132:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800139:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80013c:	ff 75 0c             	push   0xc(%ebp)
+  80013f:	ff 75 08             	push   0x8(%ebp)
+  800142:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800148:	50                   	push   %eax
+  800149:	68 db 00 80 00       	push   $0x8000db
+  80014e:	e8 14 01 00 00       	call   800267 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800153:	83 c4 08             	add    $0x8,%esp
+  800156:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80015c:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800162:	50                   	push   %eax
+  800163:	e8 8e 0b 00 00       	call   800cf6 <sys_cputs>
+
+	return b.cnt;
+}
+  800168:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80016e:	c9                   	leave
+  80016f:	c3                   	ret
+
+00800170 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800170:	55                   	push   %ebp
+  800171:	89 e5                	mov    %esp,%ebp
+  800173:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800176:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800179:	50                   	push   %eax
+  80017a:	ff 75 08             	push   0x8(%ebp)
+  80017d:	e8 9d ff ff ff       	call   80011f <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800182:	c9                   	leave
+  800183:	c3                   	ret
+
+00800184 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800184:	55                   	push   %ebp
+  800185:	89 e5                	mov    %esp,%ebp
+  800187:	57                   	push   %edi
+  800188:	56                   	push   %esi
+  800189:	53                   	push   %ebx
+  80018a:	83 ec 1c             	sub    $0x1c,%esp
+  80018d:	89 c7                	mov    %eax,%edi
+  80018f:	89 d6                	mov    %edx,%esi
+  800191:	8b 45 08             	mov    0x8(%ebp),%eax
+  800194:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800197:	89 d1                	mov    %edx,%ecx
+  800199:	89 c2                	mov    %eax,%edx
+  80019b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80019e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001a1:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001a4:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001a7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001aa:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001b1:	39 c2                	cmp    %eax,%edx
+  8001b3:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001b6:	72 3e                	jb     8001f6 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001b8:	83 ec 0c             	sub    $0xc,%esp
+  8001bb:	ff 75 18             	push   0x18(%ebp)
+  8001be:	83 eb 01             	sub    $0x1,%ebx
+  8001c1:	53                   	push   %ebx
+  8001c2:	50                   	push   %eax
+  8001c3:	83 ec 08             	sub    $0x8,%esp
+  8001c6:	ff 75 e4             	push   -0x1c(%ebp)
+  8001c9:	ff 75 e0             	push   -0x20(%ebp)
+  8001cc:	ff 75 dc             	push   -0x24(%ebp)
+  8001cf:	ff 75 d8             	push   -0x28(%ebp)
+  8001d2:	e8 1a 26 00 00       	call   8027f1 <__udivdi3>
+  8001d7:	83 c4 18             	add    $0x18,%esp
+  8001da:	52                   	push   %edx
+  8001db:	50                   	push   %eax
+  8001dc:	89 f2                	mov    %esi,%edx
+  8001de:	89 f8                	mov    %edi,%eax
+  8001e0:	e8 9f ff ff ff       	call   800184 <printnum>
+  8001e5:	83 c4 20             	add    $0x20,%esp
+  8001e8:	eb 13                	jmp    8001fd <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8001ea:	83 ec 08             	sub    $0x8,%esp
+  8001ed:	56                   	push   %esi
+  8001ee:	ff 75 18             	push   0x18(%ebp)
+  8001f1:	ff d7                	call   *%edi
+  8001f3:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8001f6:	83 eb 01             	sub    $0x1,%ebx
+  8001f9:	85 db                	test   %ebx,%ebx
+  8001fb:	7f ed                	jg     8001ea <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8001fd:	83 ec 08             	sub    $0x8,%esp
+  800200:	56                   	push   %esi
+  800201:	83 ec 04             	sub    $0x4,%esp
+  800204:	ff 75 e4             	push   -0x1c(%ebp)
+  800207:	ff 75 e0             	push   -0x20(%ebp)
+  80020a:	ff 75 dc             	push   -0x24(%ebp)
+  80020d:	ff 75 d8             	push   -0x28(%ebp)
+  800210:	e8 fa 25 00 00       	call   80280f <__umoddi3>
+  800215:	83 c4 14             	add    $0x14,%esp
+  800218:	0f be 80 66 29 80 00 	movsbl 0x802966(%eax),%eax
+  80021f:	50                   	push   %eax
+  800220:	ff d7                	call   *%edi
+}
+  800222:	83 c4 10             	add    $0x10,%esp
+  800225:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800228:	5b                   	pop    %ebx
+  800229:	5e                   	pop    %esi
+  80022a:	5f                   	pop    %edi
+  80022b:	5d                   	pop    %ebp
+  80022c:	c3                   	ret
+
+0080022d <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80022d:	55                   	push   %ebp
+  80022e:	89 e5                	mov    %esp,%ebp
+  800230:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800233:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800237:	8b 10                	mov    (%eax),%edx
+  800239:	3b 50 04             	cmp    0x4(%eax),%edx
+  80023c:	73 0a                	jae    800248 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80023e:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800241:	89 08                	mov    %ecx,(%eax)
+  800243:	8b 45 08             	mov    0x8(%ebp),%eax
+  800246:	88 02                	mov    %al,(%edx)
+}
+  800248:	5d                   	pop    %ebp
+  800249:	c3                   	ret
+
+0080024a <printfmt>:
+{
+  80024a:	55                   	push   %ebp
+  80024b:	89 e5                	mov    %esp,%ebp
+  80024d:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800250:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800253:	50                   	push   %eax
+  800254:	ff 75 10             	push   0x10(%ebp)
+  800257:	ff 75 0c             	push   0xc(%ebp)
+  80025a:	ff 75 08             	push   0x8(%ebp)
+  80025d:	e8 05 00 00 00       	call   800267 <vprintfmt>
+}
+  800262:	83 c4 10             	add    $0x10,%esp
+  800265:	c9                   	leave
+  800266:	c3                   	ret
+
+00800267 <vprintfmt>:
+{
+  800267:	55                   	push   %ebp
+  800268:	89 e5                	mov    %esp,%ebp
+  80026a:	57                   	push   %edi
+  80026b:	56                   	push   %esi
+  80026c:	53                   	push   %ebx
+  80026d:	83 ec 2c             	sub    $0x2c,%esp
+  800270:	8b 75 08             	mov    0x8(%ebp),%esi
+  800273:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800276:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800279:	eb 0a                	jmp    800285 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80027b:	83 ec 08             	sub    $0x8,%esp
+  80027e:	53                   	push   %ebx
+  80027f:	50                   	push   %eax
+  800280:	ff d6                	call   *%esi
+  800282:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800285:	83 c7 01             	add    $0x1,%edi
+  800288:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80028c:	83 f8 25             	cmp    $0x25,%eax
+  80028f:	74 0c                	je     80029d <vprintfmt+0x36>
+			if (ch == '\0')
+  800291:	85 c0                	test   %eax,%eax
+  800293:	75 e6                	jne    80027b <vprintfmt+0x14>
+}
+  800295:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800298:	5b                   	pop    %ebx
+  800299:	5e                   	pop    %esi
+  80029a:	5f                   	pop    %edi
+  80029b:	5d                   	pop    %ebp
+  80029c:	c3                   	ret
+		padc = ' ';
+  80029d:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002a1:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002a8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002af:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8002bb:	8d 47 01             	lea    0x1(%edi),%eax
+  8002be:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002c1:	0f b6 17             	movzbl (%edi),%edx
+  8002c4:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002c7:	3c 55                	cmp    $0x55,%al
+  8002c9:	0f 87 cf 03 00 00    	ja     80069e <vprintfmt+0x437>
+  8002cf:	0f b6 c0             	movzbl %al,%eax
+  8002d2:	ff 24 85 40 2a 80 00 	jmp    *0x802a40(,%eax,4)
+  8002d9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8002dc:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002e0:	eb d9                	jmp    8002bb <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8002e2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002e5:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8002e9:	eb d0                	jmp    8002bb <vprintfmt+0x54>
+  8002eb:	0f b6 d2             	movzbl %dl,%edx
+  8002ee:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8002f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f6:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8002f9:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8002fc:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800300:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800303:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800306:	83 f9 09             	cmp    $0x9,%ecx
+  800309:	77 55                	ja     800360 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80030b:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80030e:	eb e9                	jmp    8002f9 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800310:	8b 45 14             	mov    0x14(%ebp),%eax
+  800313:	8b 00                	mov    (%eax),%eax
+  800315:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800318:	8b 45 14             	mov    0x14(%ebp),%eax
+  80031b:	8d 40 04             	lea    0x4(%eax),%eax
+  80031e:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800321:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800324:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800328:	79 91                	jns    8002bb <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80032a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80032d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800330:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800337:	eb 82                	jmp    8002bb <vprintfmt+0x54>
+			if (width < 0)
+  800339:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80033c:	85 d2                	test   %edx,%edx
+  80033e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800343:	0f 49 c2             	cmovns %edx,%eax
+  800346:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800349:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80034c:	e9 6a ff ff ff       	jmp    8002bb <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800351:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800354:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80035b:	e9 5b ff ff ff       	jmp    8002bb <vprintfmt+0x54>
+  800360:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800363:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800366:	eb bc                	jmp    800324 <vprintfmt+0xbd>
+			lflag++;
+  800368:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80036b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80036e:	e9 48 ff ff ff       	jmp    8002bb <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800373:	8b 45 14             	mov    0x14(%ebp),%eax
+  800376:	8d 78 04             	lea    0x4(%eax),%edi
+  800379:	83 ec 08             	sub    $0x8,%esp
+  80037c:	53                   	push   %ebx
+  80037d:	ff 30                	push   (%eax)
+  80037f:	ff d6                	call   *%esi
+			break;
+  800381:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800384:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800387:	e9 b1 02 00 00       	jmp    80063d <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  80038c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80038f:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800392:	8b 10                	mov    (%eax),%edx
+  800394:	89 d0                	mov    %edx,%eax
+  800396:	f7 d8                	neg    %eax
+  800398:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80039b:	83 f8 0d             	cmp    $0xd,%eax
+  80039e:	7f 23                	jg     8003c3 <vprintfmt+0x15c>
+  8003a0:	8b 14 85 a0 2b 80 00 	mov    0x802ba0(,%eax,4),%edx
+  8003a7:	85 d2                	test   %edx,%edx
+  8003a9:	74 18                	je     8003c3 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003ab:	52                   	push   %edx
+  8003ac:	68 87 29 80 00       	push   $0x802987
+  8003b1:	53                   	push   %ebx
+  8003b2:	56                   	push   %esi
+  8003b3:	e8 92 fe ff ff       	call   80024a <printfmt>
+  8003b8:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003bb:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003be:	e9 7a 02 00 00       	jmp    80063d <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8003c3:	50                   	push   %eax
+  8003c4:	68 7e 29 80 00       	push   $0x80297e
+  8003c9:	53                   	push   %ebx
+  8003ca:	56                   	push   %esi
+  8003cb:	e8 7a fe ff ff       	call   80024a <printfmt>
+  8003d0:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003d3:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003d6:	e9 62 02 00 00       	jmp    80063d <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003de:	83 c0 04             	add    $0x4,%eax
+  8003e1:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003e7:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8003e9:	85 c9                	test   %ecx,%ecx
+  8003eb:	b8 77 29 80 00       	mov    $0x802977,%eax
+  8003f0:	0f 45 c1             	cmovne %ecx,%eax
+  8003f3:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8003f6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003fa:	7e 06                	jle    800402 <vprintfmt+0x19b>
+  8003fc:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800400:	75 0b                	jne    80040d <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800402:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800405:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800408:	89 75 08             	mov    %esi,0x8(%ebp)
+  80040b:	eb 5c                	jmp    800469 <vprintfmt+0x202>
+  80040d:	83 ec 08             	sub    $0x8,%esp
+  800410:	ff 75 d0             	push   -0x30(%ebp)
+  800413:	ff 75 cc             	push   -0x34(%ebp)
+  800416:	e8 20 03 00 00       	call   80073b <strnlen>
+  80041b:	89 c2                	mov    %eax,%edx
+  80041d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800420:	29 d0                	sub    %edx,%eax
+  800422:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800425:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800429:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80042c:	89 75 08             	mov    %esi,0x8(%ebp)
+  80042f:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800431:	eb 0e                	jmp    800441 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800433:	83 ec 08             	sub    $0x8,%esp
+  800436:	53                   	push   %ebx
+  800437:	57                   	push   %edi
+  800438:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80043b:	83 ee 01             	sub    $0x1,%esi
+  80043e:	83 c4 10             	add    $0x10,%esp
+  800441:	85 f6                	test   %esi,%esi
+  800443:	7f ee                	jg     800433 <vprintfmt+0x1cc>
+  800445:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800448:	8b 75 08             	mov    0x8(%ebp),%esi
+  80044b:	85 c0                	test   %eax,%eax
+  80044d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800452:	0f 49 d0             	cmovns %eax,%edx
+  800455:	29 d0                	sub    %edx,%eax
+  800457:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80045a:	eb a6                	jmp    800402 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80045c:	83 ec 08             	sub    $0x8,%esp
+  80045f:	53                   	push   %ebx
+  800460:	52                   	push   %edx
+  800461:	ff 55 08             	call   *0x8(%ebp)
+  800464:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800467:	89 f1                	mov    %esi,%ecx
+  800469:	8d 71 01             	lea    0x1(%ecx),%esi
+  80046c:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800470:	0f be d0             	movsbl %al,%edx
+  800473:	85 d2                	test   %edx,%edx
+  800475:	74 28                	je     80049f <vprintfmt+0x238>
+  800477:	85 ff                	test   %edi,%edi
+  800479:	78 05                	js     800480 <vprintfmt+0x219>
+  80047b:	83 ef 01             	sub    $0x1,%edi
+  80047e:	78 30                	js     8004b0 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800480:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800484:	74 d6                	je     80045c <vprintfmt+0x1f5>
+  800486:	0f be c0             	movsbl %al,%eax
+  800489:	83 e8 20             	sub    $0x20,%eax
+  80048c:	83 f8 5e             	cmp    $0x5e,%eax
+  80048f:	76 cb                	jbe    80045c <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800491:	83 ec 08             	sub    $0x8,%esp
+  800494:	53                   	push   %ebx
+  800495:	6a 3f                	push   $0x3f
+  800497:	ff 55 08             	call   *0x8(%ebp)
+  80049a:	83 c4 10             	add    $0x10,%esp
+  80049d:	eb c8                	jmp    800467 <vprintfmt+0x200>
+  80049f:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004a2:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004a5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004a8:	01 d0                	add    %edx,%eax
+  8004aa:	29 c8                	sub    %ecx,%eax
+  8004ac:	89 c7                	mov    %eax,%edi
+  8004ae:	eb 13                	jmp    8004c3 <vprintfmt+0x25c>
+  8004b0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004b3:	eb ed                	jmp    8004a2 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004b5:	83 ec 08             	sub    $0x8,%esp
+  8004b8:	53                   	push   %ebx
+  8004b9:	6a 20                	push   $0x20
+  8004bb:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004bd:	83 ef 01             	sub    $0x1,%edi
+  8004c0:	83 c4 10             	add    $0x10,%esp
+  8004c3:	85 ff                	test   %edi,%edi
+  8004c5:	7f ee                	jg     8004b5 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004c7:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004ca:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004cd:	e9 6b 01 00 00       	jmp    80063d <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8004d2:	83 f9 01             	cmp    $0x1,%ecx
+  8004d5:	7f 1f                	jg     8004f6 <vprintfmt+0x28f>
+	else if (lflag)
+  8004d7:	85 c9                	test   %ecx,%ecx
+  8004d9:	74 67                	je     800542 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8004db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004de:	8b 00                	mov    (%eax),%eax
+  8004e0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004e3:	89 c1                	mov    %eax,%ecx
+  8004e5:	c1 f9 1f             	sar    $0x1f,%ecx
+  8004e8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ee:	8d 40 04             	lea    0x4(%eax),%eax
+  8004f1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004f4:	eb 17                	jmp    80050d <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8004f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f9:	8b 50 04             	mov    0x4(%eax),%edx
+  8004fc:	8b 00                	mov    (%eax),%eax
+  8004fe:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800501:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800504:	8b 45 14             	mov    0x14(%ebp),%eax
+  800507:	8d 40 08             	lea    0x8(%eax),%eax
+  80050a:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80050d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800510:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800513:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800518:	85 c9                	test   %ecx,%ecx
+  80051a:	0f 89 03 01 00 00    	jns    800623 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800520:	83 ec 08             	sub    $0x8,%esp
+  800523:	53                   	push   %ebx
+  800524:	6a 2d                	push   $0x2d
+  800526:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800528:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80052b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80052e:	f7 da                	neg    %edx
+  800530:	83 d1 00             	adc    $0x0,%ecx
+  800533:	f7 d9                	neg    %ecx
+  800535:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800538:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80053d:	e9 e1 00 00 00       	jmp    800623 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800542:	8b 45 14             	mov    0x14(%ebp),%eax
+  800545:	8b 00                	mov    (%eax),%eax
+  800547:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80054a:	89 c1                	mov    %eax,%ecx
+  80054c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80054f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800552:	8b 45 14             	mov    0x14(%ebp),%eax
+  800555:	8d 40 04             	lea    0x4(%eax),%eax
+  800558:	89 45 14             	mov    %eax,0x14(%ebp)
+  80055b:	eb b0                	jmp    80050d <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80055d:	83 f9 01             	cmp    $0x1,%ecx
+  800560:	7f 1e                	jg     800580 <vprintfmt+0x319>
+	else if (lflag)
+  800562:	85 c9                	test   %ecx,%ecx
+  800564:	74 32                	je     800598 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800566:	8b 45 14             	mov    0x14(%ebp),%eax
+  800569:	8b 10                	mov    (%eax),%edx
+  80056b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800570:	8d 40 04             	lea    0x4(%eax),%eax
+  800573:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800576:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80057b:	e9 a3 00 00 00       	jmp    800623 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800580:	8b 45 14             	mov    0x14(%ebp),%eax
+  800583:	8b 10                	mov    (%eax),%edx
+  800585:	8b 48 04             	mov    0x4(%eax),%ecx
+  800588:	8d 40 08             	lea    0x8(%eax),%eax
+  80058b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80058e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800593:	e9 8b 00 00 00       	jmp    800623 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800598:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059b:	8b 10                	mov    (%eax),%edx
+  80059d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005a2:	8d 40 04             	lea    0x4(%eax),%eax
+  8005a5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005a8:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005ad:	eb 74                	jmp    800623 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8005af:	83 f9 01             	cmp    $0x1,%ecx
+  8005b2:	7f 1b                	jg     8005cf <vprintfmt+0x368>
+	else if (lflag)
+  8005b4:	85 c9                	test   %ecx,%ecx
+  8005b6:	74 2c                	je     8005e4 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8005b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bb:	8b 10                	mov    (%eax),%edx
+  8005bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005c2:	8d 40 04             	lea    0x4(%eax),%eax
+  8005c5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005c8:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8005cd:	eb 54                	jmp    800623 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d2:	8b 10                	mov    (%eax),%edx
+  8005d4:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005d7:	8d 40 08             	lea    0x8(%eax),%eax
+  8005da:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005dd:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8005e2:	eb 3f                	jmp    800623 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e7:	8b 10                	mov    (%eax),%edx
+  8005e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005ee:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005f4:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8005f9:	eb 28                	jmp    800623 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8005fb:	83 ec 08             	sub    $0x8,%esp
+  8005fe:	53                   	push   %ebx
+  8005ff:	6a 30                	push   $0x30
+  800601:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800603:	83 c4 08             	add    $0x8,%esp
+  800606:	53                   	push   %ebx
+  800607:	6a 78                	push   $0x78
+  800609:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80060b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060e:	8b 10                	mov    (%eax),%edx
+  800610:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800615:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800618:	8d 40 04             	lea    0x4(%eax),%eax
+  80061b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80061e:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800623:	83 ec 0c             	sub    $0xc,%esp
+  800626:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80062a:	50                   	push   %eax
+  80062b:	ff 75 e0             	push   -0x20(%ebp)
+  80062e:	57                   	push   %edi
+  80062f:	51                   	push   %ecx
+  800630:	52                   	push   %edx
+  800631:	89 da                	mov    %ebx,%edx
+  800633:	89 f0                	mov    %esi,%eax
+  800635:	e8 4a fb ff ff       	call   800184 <printnum>
+			break;
+  80063a:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80063d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800640:	e9 40 fc ff ff       	jmp    800285 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800645:	83 f9 01             	cmp    $0x1,%ecx
+  800648:	7f 1b                	jg     800665 <vprintfmt+0x3fe>
+	else if (lflag)
+  80064a:	85 c9                	test   %ecx,%ecx
+  80064c:	74 2c                	je     80067a <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  80064e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800651:	8b 10                	mov    (%eax),%edx
+  800653:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800658:	8d 40 04             	lea    0x4(%eax),%eax
+  80065b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80065e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800663:	eb be                	jmp    800623 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800665:	8b 45 14             	mov    0x14(%ebp),%eax
+  800668:	8b 10                	mov    (%eax),%edx
+  80066a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80066d:	8d 40 08             	lea    0x8(%eax),%eax
+  800670:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800673:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800678:	eb a9                	jmp    800623 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80067a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067d:	8b 10                	mov    (%eax),%edx
+  80067f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800684:	8d 40 04             	lea    0x4(%eax),%eax
+  800687:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80068a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80068f:	eb 92                	jmp    800623 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800691:	83 ec 08             	sub    $0x8,%esp
+  800694:	53                   	push   %ebx
+  800695:	6a 25                	push   $0x25
+  800697:	ff d6                	call   *%esi
+			break;
+  800699:	83 c4 10             	add    $0x10,%esp
+  80069c:	eb 9f                	jmp    80063d <vprintfmt+0x3d6>
+			putch('%', putdat);
+  80069e:	83 ec 08             	sub    $0x8,%esp
+  8006a1:	53                   	push   %ebx
+  8006a2:	6a 25                	push   $0x25
+  8006a4:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006a6:	83 c4 10             	add    $0x10,%esp
+  8006a9:	89 f8                	mov    %edi,%eax
+  8006ab:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006af:	74 05                	je     8006b6 <vprintfmt+0x44f>
+  8006b1:	83 e8 01             	sub    $0x1,%eax
+  8006b4:	eb f5                	jmp    8006ab <vprintfmt+0x444>
+  8006b6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006b9:	eb 82                	jmp    80063d <vprintfmt+0x3d6>
+
+008006bb <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006bb:	55                   	push   %ebp
+  8006bc:	89 e5                	mov    %esp,%ebp
+  8006be:	83 ec 18             	sub    $0x18,%esp
+  8006c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006c4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006c7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006ca:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006ce:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006d1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006d8:	85 c0                	test   %eax,%eax
+  8006da:	74 26                	je     800702 <vsnprintf+0x47>
+  8006dc:	85 d2                	test   %edx,%edx
+  8006de:	7e 22                	jle    800702 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006e0:	ff 75 14             	push   0x14(%ebp)
+  8006e3:	ff 75 10             	push   0x10(%ebp)
+  8006e6:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006e9:	50                   	push   %eax
+  8006ea:	68 2d 02 80 00       	push   $0x80022d
+  8006ef:	e8 73 fb ff ff       	call   800267 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8006f4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8006f7:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8006fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8006fd:	83 c4 10             	add    $0x10,%esp
+}
+  800700:	c9                   	leave
+  800701:	c3                   	ret
+		return -E_INVAL;
+  800702:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800707:	eb f7                	jmp    800700 <vsnprintf+0x45>
+
+00800709 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800709:	55                   	push   %ebp
+  80070a:	89 e5                	mov    %esp,%ebp
+  80070c:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80070f:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800712:	50                   	push   %eax
+  800713:	ff 75 10             	push   0x10(%ebp)
+  800716:	ff 75 0c             	push   0xc(%ebp)
+  800719:	ff 75 08             	push   0x8(%ebp)
+  80071c:	e8 9a ff ff ff       	call   8006bb <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800721:	c9                   	leave
+  800722:	c3                   	ret
+
+00800723 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800723:	55                   	push   %ebp
+  800724:	89 e5                	mov    %esp,%ebp
+  800726:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800729:	b8 00 00 00 00       	mov    $0x0,%eax
+  80072e:	eb 03                	jmp    800733 <strlen+0x10>
+		n++;
+  800730:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800733:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800737:	75 f7                	jne    800730 <strlen+0xd>
+	return n;
+}
+  800739:	5d                   	pop    %ebp
+  80073a:	c3                   	ret
+
+0080073b <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80073b:	55                   	push   %ebp
+  80073c:	89 e5                	mov    %esp,%ebp
+  80073e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800741:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800744:	b8 00 00 00 00       	mov    $0x0,%eax
+  800749:	eb 03                	jmp    80074e <strnlen+0x13>
+		n++;
+  80074b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80074e:	39 d0                	cmp    %edx,%eax
+  800750:	74 08                	je     80075a <strnlen+0x1f>
+  800752:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800756:	75 f3                	jne    80074b <strnlen+0x10>
+  800758:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80075a:	89 d0                	mov    %edx,%eax
+  80075c:	5d                   	pop    %ebp
+  80075d:	c3                   	ret
+
+0080075e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80075e:	55                   	push   %ebp
+  80075f:	89 e5                	mov    %esp,%ebp
+  800761:	53                   	push   %ebx
+  800762:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800765:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800768:	b8 00 00 00 00       	mov    $0x0,%eax
+  80076d:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800771:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800774:	83 c0 01             	add    $0x1,%eax
+  800777:	84 d2                	test   %dl,%dl
+  800779:	75 f2                	jne    80076d <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80077b:	89 c8                	mov    %ecx,%eax
+  80077d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800780:	c9                   	leave
+  800781:	c3                   	ret
+
+00800782 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800782:	55                   	push   %ebp
+  800783:	89 e5                	mov    %esp,%ebp
+  800785:	53                   	push   %ebx
+  800786:	83 ec 10             	sub    $0x10,%esp
+  800789:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80078c:	53                   	push   %ebx
+  80078d:	e8 91 ff ff ff       	call   800723 <strlen>
+  800792:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800795:	ff 75 0c             	push   0xc(%ebp)
+  800798:	01 d8                	add    %ebx,%eax
+  80079a:	50                   	push   %eax
+  80079b:	e8 be ff ff ff       	call   80075e <strcpy>
+	return dst;
+}
+  8007a0:	89 d8                	mov    %ebx,%eax
+  8007a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007a5:	c9                   	leave
+  8007a6:	c3                   	ret
+
+008007a7 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007a7:	55                   	push   %ebp
+  8007a8:	89 e5                	mov    %esp,%ebp
+  8007aa:	56                   	push   %esi
+  8007ab:	53                   	push   %ebx
+  8007ac:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007af:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007b2:	89 f3                	mov    %esi,%ebx
+  8007b4:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007b7:	89 f0                	mov    %esi,%eax
+  8007b9:	eb 0f                	jmp    8007ca <strncpy+0x23>
+		*dst++ = *src;
+  8007bb:	83 c0 01             	add    $0x1,%eax
+  8007be:	0f b6 0a             	movzbl (%edx),%ecx
+  8007c1:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007c4:	80 f9 01             	cmp    $0x1,%cl
+  8007c7:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007ca:	39 d8                	cmp    %ebx,%eax
+  8007cc:	75 ed                	jne    8007bb <strncpy+0x14>
+	}
+	return ret;
+}
+  8007ce:	89 f0                	mov    %esi,%eax
+  8007d0:	5b                   	pop    %ebx
+  8007d1:	5e                   	pop    %esi
+  8007d2:	5d                   	pop    %ebp
+  8007d3:	c3                   	ret
+
+008007d4 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007d4:	55                   	push   %ebp
+  8007d5:	89 e5                	mov    %esp,%ebp
+  8007d7:	56                   	push   %esi
+  8007d8:	53                   	push   %ebx
+  8007d9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007df:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8007e2:	89 f0                	mov    %esi,%eax
+  8007e4:	85 d2                	test   %edx,%edx
+  8007e6:	74 21                	je     800809 <strlcpy+0x35>
+  8007e8:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8007ec:	89 f2                	mov    %esi,%edx
+  8007ee:	eb 09                	jmp    8007f9 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8007f0:	83 c1 01             	add    $0x1,%ecx
+  8007f3:	83 c2 01             	add    $0x1,%edx
+  8007f6:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8007f9:	39 c2                	cmp    %eax,%edx
+  8007fb:	74 09                	je     800806 <strlcpy+0x32>
+  8007fd:	0f b6 19             	movzbl (%ecx),%ebx
+  800800:	84 db                	test   %bl,%bl
+  800802:	75 ec                	jne    8007f0 <strlcpy+0x1c>
+  800804:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800806:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800809:	29 f0                	sub    %esi,%eax
+}
+  80080b:	5b                   	pop    %ebx
+  80080c:	5e                   	pop    %esi
+  80080d:	5d                   	pop    %ebp
+  80080e:	c3                   	ret
+
+0080080f <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80080f:	55                   	push   %ebp
+  800810:	89 e5                	mov    %esp,%ebp
+  800812:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800815:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800818:	eb 06                	jmp    800820 <strcmp+0x11>
+		p++, q++;
+  80081a:	83 c1 01             	add    $0x1,%ecx
+  80081d:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800820:	0f b6 01             	movzbl (%ecx),%eax
+  800823:	84 c0                	test   %al,%al
+  800825:	74 04                	je     80082b <strcmp+0x1c>
+  800827:	3a 02                	cmp    (%edx),%al
+  800829:	74 ef                	je     80081a <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80082b:	0f b6 c0             	movzbl %al,%eax
+  80082e:	0f b6 12             	movzbl (%edx),%edx
+  800831:	29 d0                	sub    %edx,%eax
+}
+  800833:	5d                   	pop    %ebp
+  800834:	c3                   	ret
+
+00800835 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800835:	55                   	push   %ebp
+  800836:	89 e5                	mov    %esp,%ebp
+  800838:	53                   	push   %ebx
+  800839:	8b 45 08             	mov    0x8(%ebp),%eax
+  80083c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80083f:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800842:	eb 09                	jmp    80084d <strncmp+0x18>
+		n--, p++, q++;
+  800844:	83 ea 01             	sub    $0x1,%edx
+  800847:	83 c0 01             	add    $0x1,%eax
+  80084a:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80084d:	85 d2                	test   %edx,%edx
+  80084f:	74 18                	je     800869 <strncmp+0x34>
+  800851:	0f b6 18             	movzbl (%eax),%ebx
+  800854:	84 db                	test   %bl,%bl
+  800856:	74 04                	je     80085c <strncmp+0x27>
+  800858:	3a 19                	cmp    (%ecx),%bl
+  80085a:	74 e8                	je     800844 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80085c:	0f b6 00             	movzbl (%eax),%eax
+  80085f:	0f b6 11             	movzbl (%ecx),%edx
+  800862:	29 d0                	sub    %edx,%eax
+}
+  800864:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800867:	c9                   	leave
+  800868:	c3                   	ret
+		return 0;
+  800869:	b8 00 00 00 00       	mov    $0x0,%eax
+  80086e:	eb f4                	jmp    800864 <strncmp+0x2f>
+
+00800870 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800870:	55                   	push   %ebp
+  800871:	89 e5                	mov    %esp,%ebp
+  800873:	8b 45 08             	mov    0x8(%ebp),%eax
+  800876:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80087a:	eb 03                	jmp    80087f <strchr+0xf>
+  80087c:	83 c0 01             	add    $0x1,%eax
+  80087f:	0f b6 10             	movzbl (%eax),%edx
+  800882:	84 d2                	test   %dl,%dl
+  800884:	74 06                	je     80088c <strchr+0x1c>
+		if (*s == c)
+  800886:	38 ca                	cmp    %cl,%dl
+  800888:	75 f2                	jne    80087c <strchr+0xc>
+  80088a:	eb 05                	jmp    800891 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80088c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800891:	5d                   	pop    %ebp
+  800892:	c3                   	ret
+
+00800893 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800893:	55                   	push   %ebp
+  800894:	89 e5                	mov    %esp,%ebp
+  800896:	8b 45 08             	mov    0x8(%ebp),%eax
+  800899:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80089d:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008a0:	38 ca                	cmp    %cl,%dl
+  8008a2:	74 09                	je     8008ad <strfind+0x1a>
+  8008a4:	84 d2                	test   %dl,%dl
+  8008a6:	74 05                	je     8008ad <strfind+0x1a>
+	for (; *s; s++)
+  8008a8:	83 c0 01             	add    $0x1,%eax
+  8008ab:	eb f0                	jmp    80089d <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008ad:	5d                   	pop    %ebp
+  8008ae:	c3                   	ret
+
+008008af <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008af:	55                   	push   %ebp
+  8008b0:	89 e5                	mov    %esp,%ebp
+  8008b2:	57                   	push   %edi
+  8008b3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008b6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008b9:	85 c9                	test   %ecx,%ecx
+  8008bb:	74 20                	je     8008dd <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008bd:	89 f8                	mov    %edi,%eax
+  8008bf:	09 c8                	or     %ecx,%eax
+  8008c1:	a8 03                	test   $0x3,%al
+  8008c3:	75 12                	jne    8008d7 <memset+0x28>
+		c &= 0xFF;
+  8008c5:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008c9:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008cf:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008d2:	fc                   	cld
+  8008d3:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008d5:	eb 06                	jmp    8008dd <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008d7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008da:	fc                   	cld
+  8008db:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008dd:	89 f8                	mov    %edi,%eax
+  8008df:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008e2:	c9                   	leave
+  8008e3:	c3                   	ret
+
+008008e4 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008e4:	55                   	push   %ebp
+  8008e5:	89 e5                	mov    %esp,%ebp
+  8008e7:	57                   	push   %edi
+  8008e8:	56                   	push   %esi
+  8008e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008ec:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008ef:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8008f2:	39 c6                	cmp    %eax,%esi
+  8008f4:	73 32                	jae    800928 <memmove+0x44>
+  8008f6:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8008f9:	39 d0                	cmp    %edx,%eax
+  8008fb:	73 2b                	jae    800928 <memmove+0x44>
+		s += n;
+		d += n;
+  8008fd:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800900:	89 d6                	mov    %edx,%esi
+  800902:	09 fe                	or     %edi,%esi
+  800904:	09 ce                	or     %ecx,%esi
+  800906:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80090c:	75 0e                	jne    80091c <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80090e:	83 ef 04             	sub    $0x4,%edi
+  800911:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800914:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800917:	fd                   	std
+  800918:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80091a:	eb 09                	jmp    800925 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80091c:	83 ef 01             	sub    $0x1,%edi
+  80091f:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800922:	fd                   	std
+  800923:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800925:	fc                   	cld
+  800926:	eb 1a                	jmp    800942 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800928:	89 f2                	mov    %esi,%edx
+  80092a:	09 c2                	or     %eax,%edx
+  80092c:	09 ca                	or     %ecx,%edx
+  80092e:	f6 c2 03             	test   $0x3,%dl
+  800931:	75 0a                	jne    80093d <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800933:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800936:	89 c7                	mov    %eax,%edi
+  800938:	fc                   	cld
+  800939:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80093b:	eb 05                	jmp    800942 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80093d:	89 c7                	mov    %eax,%edi
+  80093f:	fc                   	cld
+  800940:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800942:	5e                   	pop    %esi
+  800943:	5f                   	pop    %edi
+  800944:	5d                   	pop    %ebp
+  800945:	c3                   	ret
+
+00800946 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800946:	55                   	push   %ebp
+  800947:	89 e5                	mov    %esp,%ebp
+  800949:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80094c:	ff 75 10             	push   0x10(%ebp)
+  80094f:	ff 75 0c             	push   0xc(%ebp)
+  800952:	ff 75 08             	push   0x8(%ebp)
+  800955:	e8 8a ff ff ff       	call   8008e4 <memmove>
+}
+  80095a:	c9                   	leave
+  80095b:	c3                   	ret
+
+0080095c <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80095c:	55                   	push   %ebp
+  80095d:	89 e5                	mov    %esp,%ebp
+  80095f:	56                   	push   %esi
+  800960:	53                   	push   %ebx
+  800961:	8b 45 08             	mov    0x8(%ebp),%eax
+  800964:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800967:	89 c6                	mov    %eax,%esi
+  800969:	03 75 10             	add    0x10(%ebp),%esi
+  80096c:	eb 06                	jmp    800974 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  80096e:	83 c0 01             	add    $0x1,%eax
+  800971:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800974:	39 f0                	cmp    %esi,%eax
+  800976:	74 14                	je     80098c <memcmp+0x30>
+		if (*s1 != *s2)
+  800978:	0f b6 08             	movzbl (%eax),%ecx
+  80097b:	0f b6 1a             	movzbl (%edx),%ebx
+  80097e:	38 d9                	cmp    %bl,%cl
+  800980:	74 ec                	je     80096e <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800982:	0f b6 c1             	movzbl %cl,%eax
+  800985:	0f b6 db             	movzbl %bl,%ebx
+  800988:	29 d8                	sub    %ebx,%eax
+  80098a:	eb 05                	jmp    800991 <memcmp+0x35>
+	}
+
+	return 0;
+  80098c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800991:	5b                   	pop    %ebx
+  800992:	5e                   	pop    %esi
+  800993:	5d                   	pop    %ebp
+  800994:	c3                   	ret
+
+00800995 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800995:	55                   	push   %ebp
+  800996:	89 e5                	mov    %esp,%ebp
+  800998:	8b 45 08             	mov    0x8(%ebp),%eax
+  80099b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80099e:	89 c2                	mov    %eax,%edx
+  8009a0:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009a3:	eb 03                	jmp    8009a8 <memfind+0x13>
+  8009a5:	83 c0 01             	add    $0x1,%eax
+  8009a8:	39 d0                	cmp    %edx,%eax
+  8009aa:	73 04                	jae    8009b0 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009ac:	38 08                	cmp    %cl,(%eax)
+  8009ae:	75 f5                	jne    8009a5 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009b0:	5d                   	pop    %ebp
+  8009b1:	c3                   	ret
+
+008009b2 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009b2:	55                   	push   %ebp
+  8009b3:	89 e5                	mov    %esp,%ebp
+  8009b5:	57                   	push   %edi
+  8009b6:	56                   	push   %esi
+  8009b7:	53                   	push   %ebx
+  8009b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009bb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009be:	eb 03                	jmp    8009c3 <strtol+0x11>
+		s++;
+  8009c0:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8009c3:	0f b6 02             	movzbl (%edx),%eax
+  8009c6:	3c 20                	cmp    $0x20,%al
+  8009c8:	74 f6                	je     8009c0 <strtol+0xe>
+  8009ca:	3c 09                	cmp    $0x9,%al
+  8009cc:	74 f2                	je     8009c0 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009ce:	3c 2b                	cmp    $0x2b,%al
+  8009d0:	74 2a                	je     8009fc <strtol+0x4a>
+	int neg = 0;
+  8009d2:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009d7:	3c 2d                	cmp    $0x2d,%al
+  8009d9:	74 2b                	je     800a06 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009db:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009e1:	75 0f                	jne    8009f2 <strtol+0x40>
+  8009e3:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009e6:	74 28                	je     800a10 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8009e8:	85 db                	test   %ebx,%ebx
+  8009ea:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009ef:	0f 44 d8             	cmove  %eax,%ebx
+  8009f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009f7:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8009fa:	eb 46                	jmp    800a42 <strtol+0x90>
+		s++;
+  8009fc:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8009ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a04:	eb d5                	jmp    8009db <strtol+0x29>
+		s++, neg = 1;
+  800a06:	83 c2 01             	add    $0x1,%edx
+  800a09:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a0e:	eb cb                	jmp    8009db <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a10:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a14:	74 0e                	je     800a24 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a16:	85 db                	test   %ebx,%ebx
+  800a18:	75 d8                	jne    8009f2 <strtol+0x40>
+		s++, base = 8;
+  800a1a:	83 c2 01             	add    $0x1,%edx
+  800a1d:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a22:	eb ce                	jmp    8009f2 <strtol+0x40>
+		s += 2, base = 16;
+  800a24:	83 c2 02             	add    $0x2,%edx
+  800a27:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a2c:	eb c4                	jmp    8009f2 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a2e:	0f be c0             	movsbl %al,%eax
+  800a31:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a34:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a37:	7d 3a                	jge    800a73 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a39:	83 c2 01             	add    $0x1,%edx
+  800a3c:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a40:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a42:	0f b6 02             	movzbl (%edx),%eax
+  800a45:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a48:	89 f3                	mov    %esi,%ebx
+  800a4a:	80 fb 09             	cmp    $0x9,%bl
+  800a4d:	76 df                	jbe    800a2e <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a4f:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a52:	89 f3                	mov    %esi,%ebx
+  800a54:	80 fb 19             	cmp    $0x19,%bl
+  800a57:	77 08                	ja     800a61 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a59:	0f be c0             	movsbl %al,%eax
+  800a5c:	83 e8 57             	sub    $0x57,%eax
+  800a5f:	eb d3                	jmp    800a34 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a61:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a64:	89 f3                	mov    %esi,%ebx
+  800a66:	80 fb 19             	cmp    $0x19,%bl
+  800a69:	77 08                	ja     800a73 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a6b:	0f be c0             	movsbl %al,%eax
+  800a6e:	83 e8 37             	sub    $0x37,%eax
+  800a71:	eb c1                	jmp    800a34 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a73:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a77:	74 05                	je     800a7e <strtol+0xcc>
+		*endptr = (char *) s;
+  800a79:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a7c:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a7e:	89 c8                	mov    %ecx,%eax
+  800a80:	f7 d8                	neg    %eax
+  800a82:	85 ff                	test   %edi,%edi
+  800a84:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a87:	89 c8                	mov    %ecx,%eax
+  800a89:	5b                   	pop    %ebx
+  800a8a:	5e                   	pop    %esi
+  800a8b:	5f                   	pop    %edi
+  800a8c:	5d                   	pop    %ebp
+  800a8d:	c3                   	ret
+
+00800a8e <atoi>:
+
+int
+atoi(const char *s)
+{
+  800a8e:	55                   	push   %ebp
+  800a8f:	89 e5                	mov    %esp,%ebp
+  800a91:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800a94:	6a 0a                	push   $0xa
+  800a96:	6a 00                	push   $0x0
+  800a98:	ff 75 08             	push   0x8(%ebp)
+  800a9b:	e8 12 ff ff ff       	call   8009b2 <strtol>
+}
+  800aa0:	c9                   	leave
+  800aa1:	c3                   	ret
+
+00800aa2 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800aa2:	55                   	push   %ebp
+  800aa3:	89 e5                	mov    %esp,%ebp
+  800aa5:	57                   	push   %edi
+  800aa6:	56                   	push   %esi
+  800aa7:	53                   	push   %ebx
+  800aa8:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800aae:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800ab4:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800aba:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800ac0:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800ac7:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800aca:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800ad1:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800ad4:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800adb:	74 76                	je     800b53 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800add:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800ae3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ae6:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800aec:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800af3:	0f 88 06 01 00 00    	js     800bff <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800af9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b00:	0f 84 48 01 00 00    	je     800c4e <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800b06:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800b0c:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800b12:	be 00 00 00 00       	mov    $0x0,%esi
+  800b17:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800b1d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b20:	55                   	push   %ebp
+  800b21:	68 2a 0b 80 00       	push   $0x800b2a
+  800b26:	89 e5                	mov    %esp,%ebp
+  800b28:	0f 34                	sysenter
+  800b2a:	83 c4 04             	add    $0x4,%esp
+  800b2d:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800b2e:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800b34:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800b3a:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800b3d:	0f 85 9a 01 00 00    	jne    800cdd <page_vec_call+0x23b>
+  800b43:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b48:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b4b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b4e:	e9 29 01 00 00       	jmp    800c7c <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800b53:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800b59:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b5c:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800b5e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b65:	78 2f                	js     800b96 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800b67:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b6e:	74 72                	je     800be2 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800b70:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800b76:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800b7c:	b8 10 00 00 00       	mov    $0x10,%eax
+  800b81:	89 fb                	mov    %edi,%ebx
+  800b83:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800b86:	55                   	push   %ebp
+  800b87:	68 90 0b 80 00       	push   $0x800b90
+  800b8c:	89 e5                	mov    %esp,%ebp
+  800b8e:	0f 34                	sysenter
+  800b90:	83 c4 04             	add    $0x4,%esp
+  800b93:	5d                   	pop    %ebp
+	return ret;
+  800b94:	eb 98                	jmp    800b2e <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800b96:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b9b:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800b9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800ba2:	f6 c6 08             	test   $0x8,%dh
+  800ba5:	74 15                	je     800bbc <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ba7:	89 c2                	mov    %eax,%edx
+  800ba9:	c1 ea 08             	shr    $0x8,%edx
+  800bac:	83 e2 0f             	and    $0xf,%edx
+  800baf:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800bb4:	83 fa 06             	cmp    $0x6,%edx
+  800bb7:	74 0e                	je     800bc7 <page_vec_call+0x125>
+  800bb9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800bbc:	0f b6 c9             	movzbl %cl,%ecx
+  800bbf:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800bc5:	eb a0                	jmp    800b67 <page_vec_call+0xc5>
+  800bc7:	89 c2                	mov    %eax,%edx
+  800bc9:	c1 ea 04             	shr    $0x4,%edx
+  800bcc:	83 e2 0f             	and    $0xf,%edx
+  800bcf:	83 fa 02             	cmp    $0x2,%edx
+  800bd2:	77 e5                	ja     800bb9 <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800bd4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800bd7:	83 f8 02             	cmp    $0x2,%eax
+  800bda:	0f 97 c1             	seta   %cl
+  800bdd:	0f b6 c9             	movzbl %cl,%ecx
+  800be0:	eb d7                	jmp    800bb9 <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800be2:	b8 10 00 00 00       	mov    $0x10,%eax
+  800be7:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800bed:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800bf3:	89 fb                	mov    %edi,%ebx
+  800bf5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800bf8:	cd 30                	int    $0x30
+  800bfa:	e9 2f ff ff ff       	jmp    800b2e <page_vec_call+0x8c>
+  800bff:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c04:	0f a2                	cpuid
+		return 0;
+  800c06:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800c0b:	f6 c6 08             	test   $0x8,%dh
+  800c0e:	74 15                	je     800c25 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c10:	89 c2                	mov    %eax,%edx
+  800c12:	c1 ea 08             	shr    $0x8,%edx
+  800c15:	83 e2 0f             	and    $0xf,%edx
+  800c18:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800c1d:	83 fa 06             	cmp    $0x6,%edx
+  800c20:	74 11                	je     800c33 <page_vec_call+0x191>
+  800c22:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800c25:	0f b6 c9             	movzbl %cl,%ecx
+  800c28:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800c2e:	e9 c6 fe ff ff       	jmp    800af9 <page_vec_call+0x57>
+  800c33:	89 c2                	mov    %eax,%edx
+  800c35:	c1 ea 04             	shr    $0x4,%edx
+  800c38:	83 e2 0f             	and    $0xf,%edx
+  800c3b:	83 fa 02             	cmp    $0x2,%edx
+  800c3e:	77 e2                	ja     800c22 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800c40:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c43:	83 f8 02             	cmp    $0x2,%eax
+  800c46:	0f 97 c1             	seta   %cl
+  800c49:	0f b6 c9             	movzbl %cl,%ecx
+  800c4c:	eb d4                	jmp    800c22 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800c4e:	be 00 00 00 00       	mov    $0x0,%esi
+  800c53:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800c59:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800c5f:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800c65:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c68:	cd 30                	int    $0x30
+  800c6a:	e9 bf fe ff ff       	jmp    800b2e <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800c6f:	29 da                	sub    %ebx,%edx
+			vec++;
+  800c71:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800c74:	83 e8 01             	sub    $0x1,%eax
+  800c77:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800c7c:	85 c0                	test   %eax,%eax
+  800c7e:	74 58                	je     800cd8 <page_vec_call+0x236>
+  800c80:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800c83:	39 da                	cmp    %ebx,%edx
+  800c85:	73 e8                	jae    800c6f <page_vec_call+0x1cd>
+  800c87:	89 75 08             	mov    %esi,0x8(%ebp)
+  800c8a:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800c8d:	84 c9                	test   %cl,%cl
+  800c8f:	74 06                	je     800c97 <page_vec_call+0x1f5>
+  800c91:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800c97:	83 ec 04             	sub    $0x4,%esp
+  800c9a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c9d:	c1 e0 04             	shl    $0x4,%eax
+  800ca0:	50                   	push   %eax
+  800ca1:	ff 75 08             	push   0x8(%ebp)
+  800ca4:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800caa:	53                   	push   %ebx
+  800cab:	e8 34 fc ff ff       	call   8008e4 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800cb0:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800cb6:	89 c2                	mov    %eax,%edx
+  800cb8:	c1 e2 0c             	shl    $0xc,%edx
+  800cbb:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  800cc1:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  800cc7:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  800ccd:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  800cd0:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  800cd3:	e9 f2 fd ff ff       	jmp    800aca <page_vec_call+0x28>
+			r = 0;
+  800cd8:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  800cdd:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800ce1:	74 0b                	je     800cee <page_vec_call+0x24c>
+		*done = total;
+  800ce3:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800ce6:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  800cec:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  800cee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cf1:	5b                   	pop    %ebx
+  800cf2:	5e                   	pop    %esi
+  800cf3:	5f                   	pop    %edi
+  800cf4:	5d                   	pop    %ebp
+  800cf5:	c3                   	ret
+
+00800cf6 <sys_cputs>:
+{
+  800cf6:	55                   	push   %ebp
+  800cf7:	89 e5                	mov    %esp,%ebp
+  800cf9:	57                   	push   %edi
+  800cfa:	56                   	push   %esi
+  800cfb:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800cfc:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d03:	78 2d                	js     800d32 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800d05:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d0c:	74 70                	je     800d7e <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800d0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d13:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d16:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d19:	89 c3                	mov    %eax,%ebx
+  800d1b:	89 c7                	mov    %eax,%edi
+  800d1d:	89 c6                	mov    %eax,%esi
+  800d1f:	55                   	push   %ebp
+  800d20:	68 29 0d 80 00       	push   $0x800d29
+  800d25:	89 e5                	mov    %esp,%ebp
+  800d27:	0f 34                	sysenter
+  800d29:	83 c4 04             	add    $0x4,%esp
+  800d2c:	5d                   	pop    %ebp
+}
+  800d2d:	5b                   	pop    %ebx
+  800d2e:	5e                   	pop    %esi
+  800d2f:	5f                   	pop    %edi
+  800d30:	5d                   	pop    %ebp
+  800d31:	c3                   	ret
+  800d32:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d37:	0f a2                	cpuid
+		return 0;
+  800d39:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800d3e:	f6 c6 08             	test   $0x8,%dh
+  800d41:	74 15                	je     800d58 <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d43:	89 c2                	mov    %eax,%edx
+  800d45:	c1 ea 08             	shr    $0x8,%edx
+  800d48:	83 e2 0f             	and    $0xf,%edx
+  800d4b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d50:	83 fa 06             	cmp    $0x6,%edx
+  800d53:	74 0e                	je     800d63 <sys_cputs+0x6d>
+  800d55:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800d58:	0f b6 c9             	movzbl %cl,%ecx
+  800d5b:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800d61:	eb a2                	jmp    800d05 <sys_cputs+0xf>
+  800d63:	89 c2                	mov    %eax,%edx
+  800d65:	c1 ea 04             	shr    $0x4,%edx
+  800d68:	83 e2 0f             	and    $0xf,%edx
+  800d6b:	83 fa 02             	cmp    $0x2,%edx
+  800d6e:	77 e5                	ja     800d55 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800d70:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d73:	83 f8 02             	cmp    $0x2,%eax
+  800d76:	0f 97 c1             	seta   %cl
+  800d79:	0f b6 c9             	movzbl %cl,%ecx
+  800d7c:	eb d7                	jmp    800d55 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800d7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d83:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d89:	89 c3                	mov    %eax,%ebx
+  800d8b:	89 c7                	mov    %eax,%edi
+  800d8d:	89 c6                	mov    %eax,%esi
+  800d8f:	cd 30                	int    $0x30
+}
+  800d91:	eb 9a                	jmp    800d2d <sys_cputs+0x37>
+
+00800d93 <sys_cgetc>:
+{
+  800d93:	55                   	push   %ebp
+  800d94:	89 e5                	mov    %esp,%ebp
+  800d96:	57                   	push   %edi
+  800d97:	56                   	push   %esi
+  800d98:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800d99:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800da0:	78 2e                	js     800dd0 <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  800da2:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800da9:	74 71                	je     800e1c <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  800dab:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db0:	b8 01 00 00 00       	mov    $0x1,%eax
+  800db5:	89 d1                	mov    %edx,%ecx
+  800db7:	89 d3                	mov    %edx,%ebx
+  800db9:	89 d7                	mov    %edx,%edi
+  800dbb:	89 d6                	mov    %edx,%esi
+  800dbd:	55                   	push   %ebp
+  800dbe:	68 c7 0d 80 00       	push   $0x800dc7
+  800dc3:	89 e5                	mov    %esp,%ebp
+  800dc5:	0f 34                	sysenter
+  800dc7:	83 c4 04             	add    $0x4,%esp
+  800dca:	5d                   	pop    %ebp
+}
+  800dcb:	5b                   	pop    %ebx
+  800dcc:	5e                   	pop    %esi
+  800dcd:	5f                   	pop    %edi
+  800dce:	5d                   	pop    %ebp
+  800dcf:	c3                   	ret
+  800dd0:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dd5:	0f a2                	cpuid
+		return 0;
+  800dd7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800ddc:	f6 c6 08             	test   $0x8,%dh
+  800ddf:	74 15                	je     800df6 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800de1:	89 c2                	mov    %eax,%edx
+  800de3:	c1 ea 08             	shr    $0x8,%edx
+  800de6:	83 e2 0f             	and    $0xf,%edx
+  800de9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800dee:	83 fa 06             	cmp    $0x6,%edx
+  800df1:	74 0e                	je     800e01 <sys_cgetc+0x6e>
+  800df3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800df6:	0f b6 c9             	movzbl %cl,%ecx
+  800df9:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800dff:	eb a1                	jmp    800da2 <sys_cgetc+0xf>
+  800e01:	89 c2                	mov    %eax,%edx
+  800e03:	c1 ea 04             	shr    $0x4,%edx
+  800e06:	83 e2 0f             	and    $0xf,%edx
+  800e09:	83 fa 02             	cmp    $0x2,%edx
+  800e0c:	77 e5                	ja     800df3 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  800e0e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e11:	83 f8 02             	cmp    $0x2,%eax
+  800e14:	0f 97 c1             	seta   %cl
+  800e17:	0f b6 c9             	movzbl %cl,%ecx
+  800e1a:	eb d7                	jmp    800df3 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  800e1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e21:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e26:	89 d1                	mov    %edx,%ecx
+  800e28:	89 d3                	mov    %edx,%ebx
+  800e2a:	89 d7                	mov    %edx,%edi
+  800e2c:	89 d6                	mov    %edx,%esi
+  800e2e:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800e30:	eb 99                	jmp    800dcb <sys_cgetc+0x38>
+
+00800e32 <sys_env_destroy>:
+{
+  800e32:	55                   	push   %ebp
+  800e33:	89 e5                	mov    %esp,%ebp
+  800e35:	57                   	push   %edi
+  800e36:	56                   	push   %esi
+  800e37:	53                   	push   %ebx
+  800e38:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800e3b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e42:	78 36                	js     800e7a <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  800e44:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e4b:	74 79                	je     800ec6 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  800e4d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e50:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e55:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e5a:	89 cb                	mov    %ecx,%ebx
+  800e5c:	89 cf                	mov    %ecx,%edi
+  800e5e:	89 ce                	mov    %ecx,%esi
+  800e60:	55                   	push   %ebp
+  800e61:	68 6a 0e 80 00       	push   $0x800e6a
+  800e66:	89 e5                	mov    %esp,%ebp
+  800e68:	0f 34                	sysenter
+  800e6a:	83 c4 04             	add    $0x4,%esp
+  800e6d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e6e:	85 c0                	test   %eax,%eax
+  800e70:	7f 6b                	jg     800edd <sys_env_destroy+0xab>
+}
+  800e72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e75:	5b                   	pop    %ebx
+  800e76:	5e                   	pop    %esi
+  800e77:	5f                   	pop    %edi
+  800e78:	5d                   	pop    %ebp
+  800e79:	c3                   	ret
+  800e7a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e7f:	0f a2                	cpuid
+		return 0;
+  800e81:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800e86:	f6 c6 08             	test   $0x8,%dh
+  800e89:	74 15                	je     800ea0 <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e8b:	89 c2                	mov    %eax,%edx
+  800e8d:	c1 ea 08             	shr    $0x8,%edx
+  800e90:	83 e2 0f             	and    $0xf,%edx
+  800e93:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e98:	83 fa 06             	cmp    $0x6,%edx
+  800e9b:	74 0e                	je     800eab <sys_env_destroy+0x79>
+  800e9d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800ea0:	0f b6 c9             	movzbl %cl,%ecx
+  800ea3:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800ea9:	eb 99                	jmp    800e44 <sys_env_destroy+0x12>
+  800eab:	89 c2                	mov    %eax,%edx
+  800ead:	c1 ea 04             	shr    $0x4,%edx
+  800eb0:	83 e2 0f             	and    $0xf,%edx
+  800eb3:	83 fa 02             	cmp    $0x2,%edx
+  800eb6:	77 e5                	ja     800e9d <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  800eb8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ebb:	83 f8 02             	cmp    $0x2,%eax
+  800ebe:	0f 97 c1             	seta   %cl
+  800ec1:	0f b6 c9             	movzbl %cl,%ecx
+  800ec4:	eb d7                	jmp    800e9d <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  800ec6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ecb:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ed0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed3:	89 cb                	mov    %ecx,%ebx
+  800ed5:	89 cf                	mov    %ecx,%edi
+  800ed7:	89 ce                	mov    %ecx,%esi
+  800ed9:	cd 30                	int    $0x30
+  800edb:	eb 91                	jmp    800e6e <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800edd:	83 ec 0c             	sub    $0xc,%esp
+  800ee0:	50                   	push   %eax
+  800ee1:	6a 03                	push   $0x3
+  800ee3:	68 19 2c 80 00       	push   $0x802c19
+  800ee8:	6a 4a                	push   $0x4a
+  800eea:	68 36 2c 80 00       	push   $0x802c36
+  800eef:	e8 af 17 00 00       	call   8026a3 <_panic>
+
+00800ef4 <sys_getenvid>:
+{
+  800ef4:	55                   	push   %ebp
+  800ef5:	89 e5                	mov    %esp,%ebp
+  800ef7:	57                   	push   %edi
+  800ef8:	56                   	push   %esi
+  800ef9:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800efa:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f01:	78 2e                	js     800f31 <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  800f03:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f0a:	74 71                	je     800f7d <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  800f0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f11:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f16:	89 d1                	mov    %edx,%ecx
+  800f18:	89 d3                	mov    %edx,%ebx
+  800f1a:	89 d7                	mov    %edx,%edi
+  800f1c:	89 d6                	mov    %edx,%esi
+  800f1e:	55                   	push   %ebp
+  800f1f:	68 28 0f 80 00       	push   $0x800f28
+  800f24:	89 e5                	mov    %esp,%ebp
+  800f26:	0f 34                	sysenter
+  800f28:	83 c4 04             	add    $0x4,%esp
+  800f2b:	5d                   	pop    %ebp
+}
+  800f2c:	5b                   	pop    %ebx
+  800f2d:	5e                   	pop    %esi
+  800f2e:	5f                   	pop    %edi
+  800f2f:	5d                   	pop    %ebp
+  800f30:	c3                   	ret
+  800f31:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f36:	0f a2                	cpuid
+		return 0;
+  800f38:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f3d:	f6 c6 08             	test   $0x8,%dh
+  800f40:	74 15                	je     800f57 <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f42:	89 c2                	mov    %eax,%edx
+  800f44:	c1 ea 08             	shr    $0x8,%edx
+  800f47:	83 e2 0f             	and    $0xf,%edx
+  800f4a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f4f:	83 fa 06             	cmp    $0x6,%edx
+  800f52:	74 0e                	je     800f62 <sys_getenvid+0x6e>
+  800f54:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f57:	0f b6 c9             	movzbl %cl,%ecx
+  800f5a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800f60:	eb a1                	jmp    800f03 <sys_getenvid+0xf>
+  800f62:	89 c2                	mov    %eax,%edx
+  800f64:	c1 ea 04             	shr    $0x4,%edx
+  800f67:	83 e2 0f             	and    $0xf,%edx
+  800f6a:	83 fa 02             	cmp    $0x2,%edx
+  800f6d:	77 e5                	ja     800f54 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  800f6f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f72:	83 f8 02             	cmp    $0x2,%eax
+  800f75:	0f 97 c1             	seta   %cl
+  800f78:	0f b6 c9             	movzbl %cl,%ecx
+  800f7b:	eb d7                	jmp    800f54 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  800f7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f82:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f87:	89 d1                	mov    %edx,%ecx
+  800f89:	89 d3                	mov    %edx,%ebx
+  800f8b:	89 d7                	mov    %edx,%edi
+  800f8d:	89 d6                	mov    %edx,%esi
+  800f8f:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  800f91:	eb 99                	jmp    800f2c <sys_getenvid+0x38>
+
+00800f93 <sys_page_alloc>:
+{
+  800f93:	55                   	push   %ebp
+  800f94:	89 e5                	mov    %esp,%ebp
+  800f96:	57                   	push   %edi
+  800f97:	56                   	push   %esi
+  800f98:	53                   	push   %ebx
+  800f99:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800f9c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fa3:	78 38                	js     800fdd <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  800fa5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fac:	74 7b                	je     801029 <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  800fae:	be 00 00 00 00       	mov    $0x0,%esi
+  800fb3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb9:	b8 04 00 00 00       	mov    $0x4,%eax
+  800fbe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fc1:	89 f7                	mov    %esi,%edi
+  800fc3:	55                   	push   %ebp
+  800fc4:	68 cd 0f 80 00       	push   $0x800fcd
+  800fc9:	89 e5                	mov    %esp,%ebp
+  800fcb:	0f 34                	sysenter
+  800fcd:	83 c4 04             	add    $0x4,%esp
+  800fd0:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800fd1:	85 c0                	test   %eax,%eax
+  800fd3:	7f 6d                	jg     801042 <sys_page_alloc+0xaf>
+}
+  800fd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fd8:	5b                   	pop    %ebx
+  800fd9:	5e                   	pop    %esi
+  800fda:	5f                   	pop    %edi
+  800fdb:	5d                   	pop    %ebp
+  800fdc:	c3                   	ret
+  800fdd:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fe2:	0f a2                	cpuid
+		return 0;
+  800fe4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800fe9:	f6 c6 08             	test   $0x8,%dh
+  800fec:	74 15                	je     801003 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800fee:	89 c2                	mov    %eax,%edx
+  800ff0:	c1 ea 08             	shr    $0x8,%edx
+  800ff3:	83 e2 0f             	and    $0xf,%edx
+  800ff6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ffb:	83 fa 06             	cmp    $0x6,%edx
+  800ffe:	74 0e                	je     80100e <sys_page_alloc+0x7b>
+  801000:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801003:	0f b6 c9             	movzbl %cl,%ecx
+  801006:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80100c:	eb 97                	jmp    800fa5 <sys_page_alloc+0x12>
+  80100e:	89 c2                	mov    %eax,%edx
+  801010:	c1 ea 04             	shr    $0x4,%edx
+  801013:	83 e2 0f             	and    $0xf,%edx
+  801016:	83 fa 02             	cmp    $0x2,%edx
+  801019:	77 e5                	ja     801000 <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  80101b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80101e:	83 f8 02             	cmp    $0x2,%eax
+  801021:	0f 97 c1             	seta   %cl
+  801024:	0f b6 c9             	movzbl %cl,%ecx
+  801027:	eb d7                	jmp    801000 <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  801029:	be 00 00 00 00       	mov    $0x0,%esi
+  80102e:	b8 04 00 00 00       	mov    $0x4,%eax
+  801033:	8b 55 08             	mov    0x8(%ebp),%edx
+  801036:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801039:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80103c:	89 f7                	mov    %esi,%edi
+  80103e:	cd 30                	int    $0x30
+  801040:	eb 8f                	jmp    800fd1 <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801042:	83 ec 0c             	sub    $0xc,%esp
+  801045:	50                   	push   %eax
+  801046:	6a 04                	push   $0x4
+  801048:	68 19 2c 80 00       	push   $0x802c19
+  80104d:	6a 4a                	push   $0x4a
+  80104f:	68 36 2c 80 00       	push   $0x802c36
+  801054:	e8 4a 16 00 00       	call   8026a3 <_panic>
+
+00801059 <sys_page_map>:
+{
+  801059:	55                   	push   %ebp
+  80105a:	89 e5                	mov    %esp,%ebp
+  80105c:	57                   	push   %edi
+  80105d:	56                   	push   %esi
+  80105e:	53                   	push   %ebx
+  80105f:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801062:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801069:	78 37                	js     8010a2 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  80106b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801072:	74 7a                	je     8010ee <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  801074:	8b 55 08             	mov    0x8(%ebp),%edx
+  801077:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80107f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801082:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801085:	8b 75 18             	mov    0x18(%ebp),%esi
+  801088:	55                   	push   %ebp
+  801089:	68 92 10 80 00       	push   $0x801092
+  80108e:	89 e5                	mov    %esp,%ebp
+  801090:	0f 34                	sysenter
+  801092:	83 c4 04             	add    $0x4,%esp
+  801095:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801096:	85 c0                	test   %eax,%eax
+  801098:	7f 6c                	jg     801106 <sys_page_map+0xad>
+}
+  80109a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80109d:	5b                   	pop    %ebx
+  80109e:	5e                   	pop    %esi
+  80109f:	5f                   	pop    %edi
+  8010a0:	5d                   	pop    %ebp
+  8010a1:	c3                   	ret
+  8010a2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010a7:	0f a2                	cpuid
+		return 0;
+  8010a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8010ae:	f6 c6 08             	test   $0x8,%dh
+  8010b1:	74 15                	je     8010c8 <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010b3:	89 c2                	mov    %eax,%edx
+  8010b5:	c1 ea 08             	shr    $0x8,%edx
+  8010b8:	83 e2 0f             	and    $0xf,%edx
+  8010bb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8010c0:	83 fa 06             	cmp    $0x6,%edx
+  8010c3:	74 0e                	je     8010d3 <sys_page_map+0x7a>
+  8010c5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8010c8:	0f b6 c9             	movzbl %cl,%ecx
+  8010cb:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8010d1:	eb 98                	jmp    80106b <sys_page_map+0x12>
+  8010d3:	89 c2                	mov    %eax,%edx
+  8010d5:	c1 ea 04             	shr    $0x4,%edx
+  8010d8:	83 e2 0f             	and    $0xf,%edx
+  8010db:	83 fa 02             	cmp    $0x2,%edx
+  8010de:	77 e5                	ja     8010c5 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  8010e0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010e3:	83 f8 02             	cmp    $0x2,%eax
+  8010e6:	0f 97 c1             	seta   %cl
+  8010e9:	0f b6 c9             	movzbl %cl,%ecx
+  8010ec:	eb d7                	jmp    8010c5 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  8010ee:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010fc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010ff:	8b 75 18             	mov    0x18(%ebp),%esi
+  801102:	cd 30                	int    $0x30
+  801104:	eb 90                	jmp    801096 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801106:	83 ec 0c             	sub    $0xc,%esp
+  801109:	50                   	push   %eax
+  80110a:	6a 05                	push   $0x5
+  80110c:	68 19 2c 80 00       	push   $0x802c19
+  801111:	6a 4a                	push   $0x4a
+  801113:	68 36 2c 80 00       	push   $0x802c36
+  801118:	e8 86 15 00 00       	call   8026a3 <_panic>
+
+0080111d <sys_page_unmap>:
+{
+  80111d:	55                   	push   %ebp
+  80111e:	89 e5                	mov    %esp,%ebp
+  801120:	57                   	push   %edi
+  801121:	56                   	push   %esi
+  801122:	53                   	push   %ebx
+  801123:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801126:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80112d:	78 37                	js     801166 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  80112f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801136:	74 7a                	je     8011b2 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  801138:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80113d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801140:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801143:	b8 06 00 00 00       	mov    $0x6,%eax
+  801148:	89 df                	mov    %ebx,%edi
+  80114a:	89 de                	mov    %ebx,%esi
+  80114c:	55                   	push   %ebp
+  80114d:	68 56 11 80 00       	push   $0x801156
+  801152:	89 e5                	mov    %esp,%ebp
+  801154:	0f 34                	sysenter
+  801156:	83 c4 04             	add    $0x4,%esp
+  801159:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80115a:	85 c0                	test   %eax,%eax
+  80115c:	7f 6c                	jg     8011ca <sys_page_unmap+0xad>
+}
+  80115e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801161:	5b                   	pop    %ebx
+  801162:	5e                   	pop    %esi
+  801163:	5f                   	pop    %edi
+  801164:	5d                   	pop    %ebp
+  801165:	c3                   	ret
+  801166:	b8 01 00 00 00       	mov    $0x1,%eax
+  80116b:	0f a2                	cpuid
+		return 0;
+  80116d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801172:	f6 c6 08             	test   $0x8,%dh
+  801175:	74 15                	je     80118c <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801177:	89 c2                	mov    %eax,%edx
+  801179:	c1 ea 08             	shr    $0x8,%edx
+  80117c:	83 e2 0f             	and    $0xf,%edx
+  80117f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801184:	83 fa 06             	cmp    $0x6,%edx
+  801187:	74 0e                	je     801197 <sys_page_unmap+0x7a>
+  801189:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80118c:	0f b6 c9             	movzbl %cl,%ecx
+  80118f:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801195:	eb 98                	jmp    80112f <sys_page_unmap+0x12>
+  801197:	89 c2                	mov    %eax,%edx
+  801199:	c1 ea 04             	shr    $0x4,%edx
+  80119c:	83 e2 0f             	and    $0xf,%edx
+  80119f:	83 fa 02             	cmp    $0x2,%edx
+  8011a2:	77 e5                	ja     801189 <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  8011a4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011a7:	83 f8 02             	cmp    $0x2,%eax
+  8011aa:	0f 97 c1             	seta   %cl
+  8011ad:	0f b6 c9             	movzbl %cl,%ecx
+  8011b0:	eb d7                	jmp    801189 <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  8011b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b7:	b8 06 00 00 00       	mov    $0x6,%eax
+  8011bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c2:	89 df                	mov    %ebx,%edi
+  8011c4:	89 de                	mov    %ebx,%esi
+  8011c6:	cd 30                	int    $0x30
+  8011c8:	eb 90                	jmp    80115a <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011ca:	83 ec 0c             	sub    $0xc,%esp
+  8011cd:	50                   	push   %eax
+  8011ce:	6a 06                	push   $0x6
+  8011d0:	68 19 2c 80 00       	push   $0x802c19
+  8011d5:	6a 4a                	push   $0x4a
+  8011d7:	68 36 2c 80 00       	push   $0x802c36
+  8011dc:	e8 c2 14 00 00       	call   8026a3 <_panic>
+
+008011e1 <sys_page_copy>:
+{
+  8011e1:	55                   	push   %ebp
+  8011e2:	89 e5                	mov    %esp,%ebp
+  8011e4:	57                   	push   %edi
+  8011e5:	56                   	push   %esi
+  8011e6:	53                   	push   %ebx
+  8011e7:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8011ea:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8011f1:	78 37                	js     80122a <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  8011f3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8011fa:	74 7a                	je     801276 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  8011fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801202:	b8 29 00 00 00       	mov    $0x29,%eax
+  801207:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80120a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80120d:	8b 75 18             	mov    0x18(%ebp),%esi
+  801210:	55                   	push   %ebp
+  801211:	68 1a 12 80 00       	push   $0x80121a
+  801216:	89 e5                	mov    %esp,%ebp
+  801218:	0f 34                	sysenter
+  80121a:	83 c4 04             	add    $0x4,%esp
+  80121d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80121e:	85 c0                	test   %eax,%eax
+  801220:	7f 6c                	jg     80128e <sys_page_copy+0xad>
+}
+  801222:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801225:	5b                   	pop    %ebx
+  801226:	5e                   	pop    %esi
+  801227:	5f                   	pop    %edi
+  801228:	5d                   	pop    %ebp
+  801229:	c3                   	ret
+  80122a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80122f:	0f a2                	cpuid
+		return 0;
+  801231:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801236:	f6 c6 08             	test   $0x8,%dh
+  801239:	74 15                	je     801250 <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80123b:	89 c2                	mov    %eax,%edx
+  80123d:	c1 ea 08             	shr    $0x8,%edx
+  801240:	83 e2 0f             	and    $0xf,%edx
+  801243:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801248:	83 fa 06             	cmp    $0x6,%edx
+  80124b:	74 0e                	je     80125b <sys_page_copy+0x7a>
+  80124d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801250:	0f b6 c9             	movzbl %cl,%ecx
+  801253:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801259:	eb 98                	jmp    8011f3 <sys_page_copy+0x12>
+  80125b:	89 c2                	mov    %eax,%edx
+  80125d:	c1 ea 04             	shr    $0x4,%edx
+  801260:	83 e2 0f             	and    $0xf,%edx
+  801263:	83 fa 02             	cmp    $0x2,%edx
+  801266:	77 e5                	ja     80124d <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  801268:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80126b:	83 f8 02             	cmp    $0x2,%eax
+  80126e:	0f 97 c1             	seta   %cl
+  801271:	0f b6 c9             	movzbl %cl,%ecx
+  801274:	eb d7                	jmp    80124d <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  801276:	b8 29 00 00 00       	mov    $0x29,%eax
+  80127b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801281:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801284:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801287:	8b 75 18             	mov    0x18(%ebp),%esi
+  80128a:	cd 30                	int    $0x30
+  80128c:	eb 90                	jmp    80121e <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80128e:	83 ec 0c             	sub    $0xc,%esp
+  801291:	50                   	push   %eax
+  801292:	6a 29                	push   $0x29
+  801294:	68 19 2c 80 00       	push   $0x802c19
+  801299:	6a 4a                	push   $0x4a
+  80129b:	68 36 2c 80 00       	push   $0x802c36
+  8012a0:	e8 fe 13 00 00       	call   8026a3 <_panic>
+
+008012a5 <sys_yield>:
+{
+  8012a5:	55                   	push   %ebp
+  8012a6:	89 e5                	mov    %esp,%ebp
+  8012a8:	57                   	push   %edi
+  8012a9:	56                   	push   %esi
+  8012aa:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8012ab:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8012b2:	78 2e                	js     8012e2 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  8012b4:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8012bb:	74 71                	je     80132e <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  8012bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012c2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8012c7:	89 d1                	mov    %edx,%ecx
+  8012c9:	89 d3                	mov    %edx,%ebx
+  8012cb:	89 d7                	mov    %edx,%edi
+  8012cd:	89 d6                	mov    %edx,%esi
+  8012cf:	55                   	push   %ebp
+  8012d0:	68 d9 12 80 00       	push   $0x8012d9
+  8012d5:	89 e5                	mov    %esp,%ebp
+  8012d7:	0f 34                	sysenter
+  8012d9:	83 c4 04             	add    $0x4,%esp
+  8012dc:	5d                   	pop    %ebp
+}
+  8012dd:	5b                   	pop    %ebx
+  8012de:	5e                   	pop    %esi
+  8012df:	5f                   	pop    %edi
+  8012e0:	5d                   	pop    %ebp
+  8012e1:	c3                   	ret
+  8012e2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012e7:	0f a2                	cpuid
+		return 0;
+  8012e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8012ee:	f6 c6 08             	test   $0x8,%dh
+  8012f1:	74 15                	je     801308 <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012f3:	89 c2                	mov    %eax,%edx
+  8012f5:	c1 ea 08             	shr    $0x8,%edx
+  8012f8:	83 e2 0f             	and    $0xf,%edx
+  8012fb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801300:	83 fa 06             	cmp    $0x6,%edx
+  801303:	74 0e                	je     801313 <sys_yield+0x6e>
+  801305:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801308:	0f b6 c9             	movzbl %cl,%ecx
+  80130b:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801311:	eb a1                	jmp    8012b4 <sys_yield+0xf>
+  801313:	89 c2                	mov    %eax,%edx
+  801315:	c1 ea 04             	shr    $0x4,%edx
+  801318:	83 e2 0f             	and    $0xf,%edx
+  80131b:	83 fa 02             	cmp    $0x2,%edx
+  80131e:	77 e5                	ja     801305 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  801320:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801323:	83 f8 02             	cmp    $0x2,%eax
+  801326:	0f 97 c1             	seta   %cl
+  801329:	0f b6 c9             	movzbl %cl,%ecx
+  80132c:	eb d7                	jmp    801305 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  80132e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801333:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801338:	89 d1                	mov    %edx,%ecx
+  80133a:	89 d3                	mov    %edx,%ebx
+  80133c:	89 d7                	mov    %edx,%edi
+  80133e:	89 d6                	mov    %edx,%esi
+  801340:	cd 30                	int    $0x30
+}
+  801342:	eb 99                	jmp    8012dd <sys_yield+0x38>
+
+00801344 <sys_env_set_status>:
+{
+  801344:	55                   	push   %ebp
+  801345:	89 e5                	mov    %esp,%ebp
+  801347:	57                   	push   %edi
+  801348:	56                   	push   %esi
+  801349:	53                   	push   %ebx
+  80134a:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80134d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801354:	78 37                	js     80138d <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  801356:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80135d:	74 7a                	je     8013d9 <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  80135f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801364:	8b 55 08             	mov    0x8(%ebp),%edx
+  801367:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80136a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80136f:	89 df                	mov    %ebx,%edi
+  801371:	89 de                	mov    %ebx,%esi
+  801373:	55                   	push   %ebp
+  801374:	68 7d 13 80 00       	push   $0x80137d
+  801379:	89 e5                	mov    %esp,%ebp
+  80137b:	0f 34                	sysenter
+  80137d:	83 c4 04             	add    $0x4,%esp
+  801380:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801381:	85 c0                	test   %eax,%eax
+  801383:	7f 6c                	jg     8013f1 <sys_env_set_status+0xad>
+}
+  801385:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801388:	5b                   	pop    %ebx
+  801389:	5e                   	pop    %esi
+  80138a:	5f                   	pop    %edi
+  80138b:	5d                   	pop    %ebp
+  80138c:	c3                   	ret
+  80138d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801392:	0f a2                	cpuid
+		return 0;
+  801394:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801399:	f6 c6 08             	test   $0x8,%dh
+  80139c:	74 15                	je     8013b3 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80139e:	89 c2                	mov    %eax,%edx
+  8013a0:	c1 ea 08             	shr    $0x8,%edx
+  8013a3:	83 e2 0f             	and    $0xf,%edx
+  8013a6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8013ab:	83 fa 06             	cmp    $0x6,%edx
+  8013ae:	74 0e                	je     8013be <sys_env_set_status+0x7a>
+  8013b0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8013b3:	0f b6 c9             	movzbl %cl,%ecx
+  8013b6:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8013bc:	eb 98                	jmp    801356 <sys_env_set_status+0x12>
+  8013be:	89 c2                	mov    %eax,%edx
+  8013c0:	c1 ea 04             	shr    $0x4,%edx
+  8013c3:	83 e2 0f             	and    $0xf,%edx
+  8013c6:	83 fa 02             	cmp    $0x2,%edx
+  8013c9:	77 e5                	ja     8013b0 <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  8013cb:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013ce:	83 f8 02             	cmp    $0x2,%eax
+  8013d1:	0f 97 c1             	seta   %cl
+  8013d4:	0f b6 c9             	movzbl %cl,%ecx
+  8013d7:	eb d7                	jmp    8013b0 <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  8013d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013de:	b8 08 00 00 00       	mov    $0x8,%eax
+  8013e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e9:	89 df                	mov    %ebx,%edi
+  8013eb:	89 de                	mov    %ebx,%esi
+  8013ed:	cd 30                	int    $0x30
+  8013ef:	eb 90                	jmp    801381 <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013f1:	83 ec 0c             	sub    $0xc,%esp
+  8013f4:	50                   	push   %eax
+  8013f5:	6a 08                	push   $0x8
+  8013f7:	68 19 2c 80 00       	push   $0x802c19
+  8013fc:	6a 4a                	push   $0x4a
+  8013fe:	68 36 2c 80 00       	push   $0x802c36
+  801403:	e8 9b 12 00 00       	call   8026a3 <_panic>
+
+00801408 <sys_sysinfo>:
+{
+  801408:	55                   	push   %ebp
+  801409:	89 e5                	mov    %esp,%ebp
+  80140b:	57                   	push   %edi
+  80140c:	56                   	push   %esi
+  80140d:	53                   	push   %ebx
+  80140e:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801411:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801418:	78 36                	js     801450 <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  80141a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801421:	74 79                	je     80149c <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  801423:	8b 55 08             	mov    0x8(%ebp),%edx
+  801426:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80142b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801430:	89 cb                	mov    %ecx,%ebx
+  801432:	89 cf                	mov    %ecx,%edi
+  801434:	89 ce                	mov    %ecx,%esi
+  801436:	55                   	push   %ebp
+  801437:	68 40 14 80 00       	push   $0x801440
+  80143c:	89 e5                	mov    %esp,%ebp
+  80143e:	0f 34                	sysenter
+  801440:	83 c4 04             	add    $0x4,%esp
+  801443:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801444:	85 c0                	test   %eax,%eax
+  801446:	7f 6b                	jg     8014b3 <sys_sysinfo+0xab>
+}
+  801448:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80144b:	5b                   	pop    %ebx
+  80144c:	5e                   	pop    %esi
+  80144d:	5f                   	pop    %edi
+  80144e:	5d                   	pop    %ebp
+  80144f:	c3                   	ret
+  801450:	b8 01 00 00 00       	mov    $0x1,%eax
+  801455:	0f a2                	cpuid
+		return 0;
+  801457:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80145c:	f6 c6 08             	test   $0x8,%dh
+  80145f:	74 15                	je     801476 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801461:	89 c2                	mov    %eax,%edx
+  801463:	c1 ea 08             	shr    $0x8,%edx
+  801466:	83 e2 0f             	and    $0xf,%edx
+  801469:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80146e:	83 fa 06             	cmp    $0x6,%edx
+  801471:	74 0e                	je     801481 <sys_sysinfo+0x79>
+  801473:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801476:	0f b6 c9             	movzbl %cl,%ecx
+  801479:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80147f:	eb 99                	jmp    80141a <sys_sysinfo+0x12>
+  801481:	89 c2                	mov    %eax,%edx
+  801483:	c1 ea 04             	shr    $0x4,%edx
+  801486:	83 e2 0f             	and    $0xf,%edx
+  801489:	83 fa 02             	cmp    $0x2,%edx
+  80148c:	77 e5                	ja     801473 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  80148e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801491:	83 f8 02             	cmp    $0x2,%eax
+  801494:	0f 97 c1             	seta   %cl
+  801497:	0f b6 c9             	movzbl %cl,%ecx
+  80149a:	eb d7                	jmp    801473 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  80149c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014a1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8014a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014a9:	89 cb                	mov    %ecx,%ebx
+  8014ab:	89 cf                	mov    %ecx,%edi
+  8014ad:	89 ce                	mov    %ecx,%esi
+  8014af:	cd 30                	int    $0x30
+  8014b1:	eb 91                	jmp    801444 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014b3:	83 ec 0c             	sub    $0xc,%esp
+  8014b6:	50                   	push   %eax
+  8014b7:	6a 0b                	push   $0xb
+  8014b9:	68 19 2c 80 00       	push   $0x802c19
+  8014be:	6a 4a                	push   $0x4a
+  8014c0:	68 36 2c 80 00       	push   $0x802c36
+  8014c5:	e8 d9 11 00 00       	call   8026a3 <_panic>
+
+008014ca <sys_env_set_trapframe>:
+{
+  8014ca:	55                   	push   %ebp
+  8014cb:	89 e5                	mov    %esp,%ebp
+  8014cd:	57                   	push   %edi
+  8014ce:	56                   	push   %esi
+  8014cf:	53                   	push   %ebx
+  8014d0:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8014d3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8014da:	78 37                	js     801513 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  8014dc:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8014e3:	74 7a                	je     80155f <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  8014e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f0:	b8 13 00 00 00       	mov    $0x13,%eax
+  8014f5:	89 df                	mov    %ebx,%edi
+  8014f7:	89 de                	mov    %ebx,%esi
+  8014f9:	55                   	push   %ebp
+  8014fa:	68 03 15 80 00       	push   $0x801503
+  8014ff:	89 e5                	mov    %esp,%ebp
+  801501:	0f 34                	sysenter
+  801503:	83 c4 04             	add    $0x4,%esp
+  801506:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801507:	85 c0                	test   %eax,%eax
+  801509:	7f 6c                	jg     801577 <sys_env_set_trapframe+0xad>
+}
+  80150b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80150e:	5b                   	pop    %ebx
+  80150f:	5e                   	pop    %esi
+  801510:	5f                   	pop    %edi
+  801511:	5d                   	pop    %ebp
+  801512:	c3                   	ret
+  801513:	b8 01 00 00 00       	mov    $0x1,%eax
+  801518:	0f a2                	cpuid
+		return 0;
+  80151a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80151f:	f6 c6 08             	test   $0x8,%dh
+  801522:	74 15                	je     801539 <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801524:	89 c2                	mov    %eax,%edx
+  801526:	c1 ea 08             	shr    $0x8,%edx
+  801529:	83 e2 0f             	and    $0xf,%edx
+  80152c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801531:	83 fa 06             	cmp    $0x6,%edx
+  801534:	74 0e                	je     801544 <sys_env_set_trapframe+0x7a>
+  801536:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801539:	0f b6 c9             	movzbl %cl,%ecx
+  80153c:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801542:	eb 98                	jmp    8014dc <sys_env_set_trapframe+0x12>
+  801544:	89 c2                	mov    %eax,%edx
+  801546:	c1 ea 04             	shr    $0x4,%edx
+  801549:	83 e2 0f             	and    $0xf,%edx
+  80154c:	83 fa 02             	cmp    $0x2,%edx
+  80154f:	77 e5                	ja     801536 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  801551:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801554:	83 f8 02             	cmp    $0x2,%eax
+  801557:	0f 97 c1             	seta   %cl
+  80155a:	0f b6 c9             	movzbl %cl,%ecx
+  80155d:	eb d7                	jmp    801536 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  80155f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801564:	b8 13 00 00 00       	mov    $0x13,%eax
+  801569:	8b 55 08             	mov    0x8(%ebp),%edx
+  80156c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80156f:	89 df                	mov    %ebx,%edi
+  801571:	89 de                	mov    %ebx,%esi
+  801573:	cd 30                	int    $0x30
+  801575:	eb 90                	jmp    801507 <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801577:	83 ec 0c             	sub    $0xc,%esp
+  80157a:	50                   	push   %eax
+  80157b:	6a 13                	push   $0x13
+  80157d:	68 19 2c 80 00       	push   $0x802c19
+  801582:	6a 4a                	push   $0x4a
+  801584:	68 36 2c 80 00       	push   $0x802c36
+  801589:	e8 15 11 00 00       	call   8026a3 <_panic>
+
+0080158e <sys_env_set_stack_limit>:
+{
+  80158e:	55                   	push   %ebp
+  80158f:	89 e5                	mov    %esp,%ebp
+  801591:	57                   	push   %edi
+  801592:	56                   	push   %esi
+  801593:	53                   	push   %ebx
+  801594:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801597:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80159e:	78 37                	js     8015d7 <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  8015a0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8015a7:	74 7a                	je     801623 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  8015a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b4:	b8 19 00 00 00       	mov    $0x19,%eax
+  8015b9:	89 df                	mov    %ebx,%edi
+  8015bb:	89 de                	mov    %ebx,%esi
+  8015bd:	55                   	push   %ebp
+  8015be:	68 c7 15 80 00       	push   $0x8015c7
+  8015c3:	89 e5                	mov    %esp,%ebp
+  8015c5:	0f 34                	sysenter
+  8015c7:	83 c4 04             	add    $0x4,%esp
+  8015ca:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8015cb:	85 c0                	test   %eax,%eax
+  8015cd:	7f 6c                	jg     80163b <sys_env_set_stack_limit+0xad>
+}
+  8015cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015d2:	5b                   	pop    %ebx
+  8015d3:	5e                   	pop    %esi
+  8015d4:	5f                   	pop    %edi
+  8015d5:	5d                   	pop    %ebp
+  8015d6:	c3                   	ret
+  8015d7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015dc:	0f a2                	cpuid
+		return 0;
+  8015de:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8015e3:	f6 c6 08             	test   $0x8,%dh
+  8015e6:	74 15                	je     8015fd <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015e8:	89 c2                	mov    %eax,%edx
+  8015ea:	c1 ea 08             	shr    $0x8,%edx
+  8015ed:	83 e2 0f             	and    $0xf,%edx
+  8015f0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8015f5:	83 fa 06             	cmp    $0x6,%edx
+  8015f8:	74 0e                	je     801608 <sys_env_set_stack_limit+0x7a>
+  8015fa:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8015fd:	0f b6 c9             	movzbl %cl,%ecx
+  801600:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801606:	eb 98                	jmp    8015a0 <sys_env_set_stack_limit+0x12>
+  801608:	89 c2                	mov    %eax,%edx
+  80160a:	c1 ea 04             	shr    $0x4,%edx
+  80160d:	83 e2 0f             	and    $0xf,%edx
+  801610:	83 fa 02             	cmp    $0x2,%edx
+  801613:	77 e5                	ja     8015fa <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  801615:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801618:	83 f8 02             	cmp    $0x2,%eax
+  80161b:	0f 97 c1             	seta   %cl
+  80161e:	0f b6 c9             	movzbl %cl,%ecx
+  801621:	eb d7                	jmp    8015fa <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  801623:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801628:	b8 19 00 00 00       	mov    $0x19,%eax
+  80162d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801630:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801633:	89 df                	mov    %ebx,%edi
+  801635:	89 de                	mov    %ebx,%esi
+  801637:	cd 30                	int    $0x30
+  801639:	eb 90                	jmp    8015cb <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80163b:	83 ec 0c             	sub    $0xc,%esp
+  80163e:	50                   	push   %eax
+  80163f:	6a 19                	push   $0x19
+  801641:	68 19 2c 80 00       	push   $0x802c19
+  801646:	6a 4a                	push   $0x4a
+  801648:	68 36 2c 80 00       	push   $0x802c36
+  80164d:	e8 51 10 00 00       	call   8026a3 <_panic>
+
+00801652 <sys_env_set_pgfault_upcall>:
+{
+  801652:	55                   	push   %ebp
+  801653:	89 e5                	mov    %esp,%ebp
+  801655:	57                   	push   %edi
+  801656:	56                   	push   %esi
+  801657:	53                   	push   %ebx
+  801658:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80165b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801662:	78 37                	js     80169b <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  801664:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80166b:	74 7a                	je     8016e7 <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  80166d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801672:	8b 55 08             	mov    0x8(%ebp),%edx
+  801675:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801678:	b8 09 00 00 00       	mov    $0x9,%eax
+  80167d:	89 df                	mov    %ebx,%edi
+  80167f:	89 de                	mov    %ebx,%esi
+  801681:	55                   	push   %ebp
+  801682:	68 8b 16 80 00       	push   $0x80168b
+  801687:	89 e5                	mov    %esp,%ebp
+  801689:	0f 34                	sysenter
+  80168b:	83 c4 04             	add    $0x4,%esp
+  80168e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80168f:	85 c0                	test   %eax,%eax
+  801691:	7f 6c                	jg     8016ff <sys_env_set_pgfault_upcall+0xad>
+}
+  801693:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801696:	5b                   	pop    %ebx
+  801697:	5e                   	pop    %esi
+  801698:	5f                   	pop    %edi
+  801699:	5d                   	pop    %ebp
+  80169a:	c3                   	ret
+  80169b:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016a0:	0f a2                	cpuid
+		return 0;
+  8016a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8016a7:	f6 c6 08             	test   $0x8,%dh
+  8016aa:	74 15                	je     8016c1 <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016ac:	89 c2                	mov    %eax,%edx
+  8016ae:	c1 ea 08             	shr    $0x8,%edx
+  8016b1:	83 e2 0f             	and    $0xf,%edx
+  8016b4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8016b9:	83 fa 06             	cmp    $0x6,%edx
+  8016bc:	74 0e                	je     8016cc <sys_env_set_pgfault_upcall+0x7a>
+  8016be:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8016c1:	0f b6 c9             	movzbl %cl,%ecx
+  8016c4:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8016ca:	eb 98                	jmp    801664 <sys_env_set_pgfault_upcall+0x12>
+  8016cc:	89 c2                	mov    %eax,%edx
+  8016ce:	c1 ea 04             	shr    $0x4,%edx
+  8016d1:	83 e2 0f             	and    $0xf,%edx
+  8016d4:	83 fa 02             	cmp    $0x2,%edx
+  8016d7:	77 e5                	ja     8016be <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  8016d9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016dc:	83 f8 02             	cmp    $0x2,%eax
+  8016df:	0f 97 c1             	seta   %cl
+  8016e2:	0f b6 c9             	movzbl %cl,%ecx
+  8016e5:	eb d7                	jmp    8016be <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  8016e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016ec:	b8 09 00 00 00       	mov    $0x9,%eax
+  8016f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016f7:	89 df                	mov    %ebx,%edi
+  8016f9:	89 de                	mov    %ebx,%esi
+  8016fb:	cd 30                	int    $0x30
+  8016fd:	eb 90                	jmp    80168f <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016ff:	83 ec 0c             	sub    $0xc,%esp
+  801702:	50                   	push   %eax
+  801703:	6a 09                	push   $0x9
+  801705:	68 19 2c 80 00       	push   $0x802c19
+  80170a:	6a 4a                	push   $0x4a
+  80170c:	68 36 2c 80 00       	push   $0x802c36
+  801711:	e8 8d 0f 00 00       	call   8026a3 <_panic>
+
+00801716 <sys_ipc_try_send>:
+{
+  801716:	55                   	push   %ebp
+  801717:	89 e5                	mov    %esp,%ebp
+  801719:	57                   	push   %edi
+  80171a:	56                   	push   %esi
+  80171b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80171c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801723:	78 32                	js     801757 <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  801725:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80172c:	74 75                	je     8017a3 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  80172e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801731:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801734:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801739:	be 00 00 00 00       	mov    $0x0,%esi
+  80173e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801741:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801744:	55                   	push   %ebp
+  801745:	68 4e 17 80 00       	push   $0x80174e
+  80174a:	89 e5                	mov    %esp,%ebp
+  80174c:	0f 34                	sysenter
+  80174e:	83 c4 04             	add    $0x4,%esp
+  801751:	5d                   	pop    %ebp
+}
+  801752:	5b                   	pop    %ebx
+  801753:	5e                   	pop    %esi
+  801754:	5f                   	pop    %edi
+  801755:	5d                   	pop    %ebp
+  801756:	c3                   	ret
+  801757:	b8 01 00 00 00       	mov    $0x1,%eax
+  80175c:	0f a2                	cpuid
+		return 0;
+  80175e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801763:	f6 c6 08             	test   $0x8,%dh
+  801766:	74 15                	je     80177d <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801768:	89 c2                	mov    %eax,%edx
+  80176a:	c1 ea 08             	shr    $0x8,%edx
+  80176d:	83 e2 0f             	and    $0xf,%edx
+  801770:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801775:	83 fa 06             	cmp    $0x6,%edx
+  801778:	74 0e                	je     801788 <sys_ipc_try_send+0x72>
+  80177a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80177d:	0f b6 c9             	movzbl %cl,%ecx
+  801780:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801786:	eb 9d                	jmp    801725 <sys_ipc_try_send+0xf>
+  801788:	89 c2                	mov    %eax,%edx
+  80178a:	c1 ea 04             	shr    $0x4,%edx
+  80178d:	83 e2 0f             	and    $0xf,%edx
+  801790:	83 fa 02             	cmp    $0x2,%edx
+  801793:	77 e5                	ja     80177a <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  801795:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801798:	83 f8 02             	cmp    $0x2,%eax
+  80179b:	0f 97 c1             	seta   %cl
+  80179e:	0f b6 c9             	movzbl %cl,%ecx
+  8017a1:	eb d7                	jmp    80177a <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  8017a3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8017a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8017ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017b3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017b6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8017b9:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  8017bb:	eb 95                	jmp    801752 <sys_ipc_try_send+0x3c>
+
+008017bd <sys_ipc_send>:
+{
+  8017bd:	55                   	push   %ebp
+  8017be:	89 e5                	mov    %esp,%ebp
+  8017c0:	57                   	push   %edi
+  8017c1:	56                   	push   %esi
+  8017c2:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8017c3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8017ca:	78 32                	js     8017fe <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  8017cc:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8017d3:	74 75                	je     80184a <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  8017d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017db:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8017e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8017e5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017e8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8017eb:	55                   	push   %ebp
+  8017ec:	68 f5 17 80 00       	push   $0x8017f5
+  8017f1:	89 e5                	mov    %esp,%ebp
+  8017f3:	0f 34                	sysenter
+  8017f5:	83 c4 04             	add    $0x4,%esp
+  8017f8:	5d                   	pop    %ebp
+}
+  8017f9:	5b                   	pop    %ebx
+  8017fa:	5e                   	pop    %esi
+  8017fb:	5f                   	pop    %edi
+  8017fc:	5d                   	pop    %ebp
+  8017fd:	c3                   	ret
+  8017fe:	b8 01 00 00 00       	mov    $0x1,%eax
+  801803:	0f a2                	cpuid
+		return 0;
+  801805:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80180a:	f6 c6 08             	test   $0x8,%dh
+  80180d:	74 15                	je     801824 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80180f:	89 c2                	mov    %eax,%edx
+  801811:	c1 ea 08             	shr    $0x8,%edx
+  801814:	83 e2 0f             	and    $0xf,%edx
+  801817:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80181c:	83 fa 06             	cmp    $0x6,%edx
+  80181f:	74 0e                	je     80182f <sys_ipc_send+0x72>
+  801821:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801824:	0f b6 c9             	movzbl %cl,%ecx
+  801827:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80182d:	eb 9d                	jmp    8017cc <sys_ipc_send+0xf>
+  80182f:	89 c2                	mov    %eax,%edx
+  801831:	c1 ea 04             	shr    $0x4,%edx
+  801834:	83 e2 0f             	and    $0xf,%edx
+  801837:	83 fa 02             	cmp    $0x2,%edx
+  80183a:	77 e5                	ja     801821 <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  80183c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80183f:	83 f8 02             	cmp    $0x2,%eax
+  801842:	0f 97 c1             	seta   %cl
+  801845:	0f b6 c9             	movzbl %cl,%ecx
+  801848:	eb d7                	jmp    801821 <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  80184a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80184f:	be 00 00 00 00       	mov    $0x0,%esi
+  801854:	8b 55 08             	mov    0x8(%ebp),%edx
+  801857:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80185a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80185d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801860:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801862:	eb 95                	jmp    8017f9 <sys_ipc_send+0x3c>
+
+00801864 <sys_ipc_recv>:
+{
+  801864:	55                   	push   %ebp
+  801865:	89 e5                	mov    %esp,%ebp
+  801867:	57                   	push   %edi
+  801868:	56                   	push   %esi
+  801869:	53                   	push   %ebx
+  80186a:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80186d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801874:	78 36                	js     8018ac <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  801876:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80187d:	74 79                	je     8018f8 <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  80187f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801882:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801887:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80188c:	89 cb                	mov    %ecx,%ebx
+  80188e:	89 cf                	mov    %ecx,%edi
+  801890:	89 ce                	mov    %ecx,%esi
+  801892:	55                   	push   %ebp
+  801893:	68 9c 18 80 00       	push   $0x80189c
+  801898:	89 e5                	mov    %esp,%ebp
+  80189a:	0f 34                	sysenter
+  80189c:	83 c4 04             	add    $0x4,%esp
+  80189f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8018a0:	85 c0                	test   %eax,%eax
+  8018a2:	7f 6b                	jg     80190f <sys_ipc_recv+0xab>
+}
+  8018a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018a7:	5b                   	pop    %ebx
+  8018a8:	5e                   	pop    %esi
+  8018a9:	5f                   	pop    %edi
+  8018aa:	5d                   	pop    %ebp
+  8018ab:	c3                   	ret
+  8018ac:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018b1:	0f a2                	cpuid
+		return 0;
+  8018b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018b8:	f6 c6 08             	test   $0x8,%dh
+  8018bb:	74 15                	je     8018d2 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018bd:	89 c2                	mov    %eax,%edx
+  8018bf:	c1 ea 08             	shr    $0x8,%edx
+  8018c2:	83 e2 0f             	and    $0xf,%edx
+  8018c5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018ca:	83 fa 06             	cmp    $0x6,%edx
+  8018cd:	74 0e                	je     8018dd <sys_ipc_recv+0x79>
+  8018cf:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8018d2:	0f b6 c9             	movzbl %cl,%ecx
+  8018d5:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8018db:	eb 99                	jmp    801876 <sys_ipc_recv+0x12>
+  8018dd:	89 c2                	mov    %eax,%edx
+  8018df:	c1 ea 04             	shr    $0x4,%edx
+  8018e2:	83 e2 0f             	and    $0xf,%edx
+  8018e5:	83 fa 02             	cmp    $0x2,%edx
+  8018e8:	77 e5                	ja     8018cf <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  8018ea:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018ed:	83 f8 02             	cmp    $0x2,%eax
+  8018f0:	0f 97 c1             	seta   %cl
+  8018f3:	0f b6 c9             	movzbl %cl,%ecx
+  8018f6:	eb d7                	jmp    8018cf <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  8018f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018fd:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801902:	8b 55 08             	mov    0x8(%ebp),%edx
+  801905:	89 cb                	mov    %ecx,%ebx
+  801907:	89 cf                	mov    %ecx,%edi
+  801909:	89 ce                	mov    %ecx,%esi
+  80190b:	cd 30                	int    $0x30
+  80190d:	eb 91                	jmp    8018a0 <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80190f:	83 ec 0c             	sub    $0xc,%esp
+  801912:	50                   	push   %eax
+  801913:	6a 0d                	push   $0xd
+  801915:	68 19 2c 80 00       	push   $0x802c19
+  80191a:	6a 4a                	push   $0x4a
+  80191c:	68 36 2c 80 00       	push   $0x802c36
+  801921:	e8 7d 0d 00 00       	call   8026a3 <_panic>
+
+00801926 <sys_ipc_send_range>:
+{
+  801926:	55                   	push   %ebp
+  801927:	89 e5                	mov    %esp,%ebp
+  801929:	57                   	push   %edi
+  80192a:	56                   	push   %esi
+  80192b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80192c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801933:	78 30                	js     801965 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  801935:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80193c:	74 73                	je     8019b1 <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  80193e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801941:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801944:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801949:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80194c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80194f:	8b 75 18             	mov    0x18(%ebp),%esi
+  801952:	55                   	push   %ebp
+  801953:	68 5c 19 80 00       	push   $0x80195c
+  801958:	89 e5                	mov    %esp,%ebp
+  80195a:	0f 34                	sysenter
+  80195c:	83 c4 04             	add    $0x4,%esp
+  80195f:	5d                   	pop    %ebp
+}
+  801960:	5b                   	pop    %ebx
+  801961:	5e                   	pop    %esi
+  801962:	5f                   	pop    %edi
+  801963:	5d                   	pop    %ebp
+  801964:	c3                   	ret
+  801965:	b8 01 00 00 00       	mov    $0x1,%eax
+  80196a:	0f a2                	cpuid
+		return 0;
+  80196c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801971:	f6 c6 08             	test   $0x8,%dh
+  801974:	74 15                	je     80198b <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801976:	89 c2                	mov    %eax,%edx
+  801978:	c1 ea 08             	shr    $0x8,%edx
+  80197b:	83 e2 0f             	and    $0xf,%edx
+  80197e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801983:	83 fa 06             	cmp    $0x6,%edx
+  801986:	74 0e                	je     801996 <sys_ipc_send_range+0x70>
+  801988:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80198b:	0f b6 c9             	movzbl %cl,%ecx
+  80198e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801994:	eb 9f                	jmp    801935 <sys_ipc_send_range+0xf>
+  801996:	89 c2                	mov    %eax,%edx
+  801998:	c1 ea 04             	shr    $0x4,%edx
+  80199b:	83 e2 0f             	and    $0xf,%edx
+  80199e:	83 fa 02             	cmp    $0x2,%edx
+  8019a1:	77 e5                	ja     801988 <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  8019a3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019a6:	83 f8 02             	cmp    $0x2,%eax
+  8019a9:	0f 97 c1             	seta   %cl
+  8019ac:	0f b6 c9             	movzbl %cl,%ecx
+  8019af:	eb d7                	jmp    801988 <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  8019b1:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8019b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019bc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019bf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8019c2:	8b 75 18             	mov    0x18(%ebp),%esi
+  8019c5:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  8019c7:	eb 97                	jmp    801960 <sys_ipc_send_range+0x3a>
+
+008019c9 <sys_ipc_recv_range>:
+{
+  8019c9:	55                   	push   %ebp
+  8019ca:	89 e5                	mov    %esp,%ebp
+  8019cc:	57                   	push   %edi
+  8019cd:	56                   	push   %esi
+  8019ce:	53                   	push   %ebx
+  8019cf:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8019d2:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8019d9:	78 37                	js     801a12 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  8019db:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8019e2:	74 7a                	je     801a5e <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  8019e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019ef:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8019f4:	89 df                	mov    %ebx,%edi
+  8019f6:	89 de                	mov    %ebx,%esi
+  8019f8:	55                   	push   %ebp
+  8019f9:	68 02 1a 80 00       	push   $0x801a02
+  8019fe:	89 e5                	mov    %esp,%ebp
+  801a00:	0f 34                	sysenter
+  801a02:	83 c4 04             	add    $0x4,%esp
+  801a05:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801a06:	85 c0                	test   %eax,%eax
+  801a08:	7f 6c                	jg     801a76 <sys_ipc_recv_range+0xad>
+}
+  801a0a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a0d:	5b                   	pop    %ebx
+  801a0e:	5e                   	pop    %esi
+  801a0f:	5f                   	pop    %edi
+  801a10:	5d                   	pop    %ebp
+  801a11:	c3                   	ret
+  801a12:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a17:	0f a2                	cpuid
+		return 0;
+  801a19:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801a1e:	f6 c6 08             	test   $0x8,%dh
+  801a21:	74 15                	je     801a38 <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a23:	89 c2                	mov    %eax,%edx
+  801a25:	c1 ea 08             	shr    $0x8,%edx
+  801a28:	83 e2 0f             	and    $0xf,%edx
+  801a2b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a30:	83 fa 06             	cmp    $0x6,%edx
+  801a33:	74 0e                	je     801a43 <sys_ipc_recv_range+0x7a>
+  801a35:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a38:	0f b6 c9             	movzbl %cl,%ecx
+  801a3b:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801a41:	eb 98                	jmp    8019db <sys_ipc_recv_range+0x12>
+  801a43:	89 c2                	mov    %eax,%edx
+  801a45:	c1 ea 04             	shr    $0x4,%edx
+  801a48:	83 e2 0f             	and    $0xf,%edx
+  801a4b:	83 fa 02             	cmp    $0x2,%edx
+  801a4e:	77 e5                	ja     801a35 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801a50:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a53:	83 f8 02             	cmp    $0x2,%eax
+  801a56:	0f 97 c1             	seta   %cl
+  801a59:	0f b6 c9             	movzbl %cl,%ecx
+  801a5c:	eb d7                	jmp    801a35 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801a5e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a63:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801a68:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a6b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a6e:	89 df                	mov    %ebx,%edi
+  801a70:	89 de                	mov    %ebx,%esi
+  801a72:	cd 30                	int    $0x30
+  801a74:	eb 90                	jmp    801a06 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a76:	83 ec 0c             	sub    $0xc,%esp
+  801a79:	50                   	push   %eax
+  801a7a:	6a 1f                	push   $0x1f
+  801a7c:	68 19 2c 80 00       	push   $0x802c19
+  801a81:	6a 4a                	push   $0x4a
+  801a83:	68 36 2c 80 00       	push   $0x802c36
+  801a88:	e8 16 0c 00 00       	call   8026a3 <_panic>
+
+00801a8d <sys_ipc_call>:
+{
+  801a8d:	55                   	push   %ebp
+  801a8e:	89 e5                	mov    %esp,%ebp
+  801a90:	57                   	push   %edi
+  801a91:	56                   	push   %esi
+  801a92:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801a93:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a96:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801a9b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801a9e:	55                   	push   %ebp
+  801a9f:	56                   	push   %esi
+  801aa0:	8b 0e                	mov    (%esi),%ecx
+  801aa2:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801aa5:	8b 7e 08             	mov    0x8(%esi),%edi
+  801aa8:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801aab:	8b 76 0c             	mov    0xc(%esi),%esi
+  801aae:	cd 30                	int    $0x30
+  801ab0:	87 34 24             	xchg   %esi,(%esp)
+  801ab3:	89 0e                	mov    %ecx,(%esi)
+  801ab5:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801ab8:	89 7e 08             	mov    %edi,0x8(%esi)
+  801abb:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801abe:	8f 46 0c             	pop    0xc(%esi)
+  801ac1:	5d                   	pop    %ebp
+}
+  801ac2:	5b                   	pop    %ebx
+  801ac3:	5e                   	pop    %esi
+  801ac4:	5f                   	pop    %edi
+  801ac5:	5d                   	pop    %ebp
+  801ac6:	c3                   	ret
+
+00801ac7 <sys_ipc_reply_wait>:
+{
+  801ac7:	55                   	push   %ebp
+  801ac8:	89 e5                	mov    %esp,%ebp
+  801aca:	57                   	push   %edi
+  801acb:	56                   	push   %esi
+  801acc:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801acd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ad0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801ad5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801ad8:	55                   	push   %ebp
+  801ad9:	56                   	push   %esi
+  801ada:	8b 0e                	mov    (%esi),%ecx
+  801adc:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801adf:	8b 7e 08             	mov    0x8(%esi),%edi
+  801ae2:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801ae5:	8b 76 0c             	mov    0xc(%esi),%esi
+  801ae8:	cd 30                	int    $0x30
+  801aea:	87 34 24             	xchg   %esi,(%esp)
+  801aed:	89 0e                	mov    %ecx,(%esi)
+  801aef:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801af2:	89 7e 08             	mov    %edi,0x8(%esi)
+  801af5:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801af8:	8f 46 0c             	pop    0xc(%esi)
+  801afb:	5d                   	pop    %ebp
+}
+  801afc:	5b                   	pop    %ebx
+  801afd:	5e                   	pop    %esi
+  801afe:	5f                   	pop    %edi
+  801aff:	5d                   	pop    %ebp
+  801b00:	c3                   	ret
+
+00801b01 <sys_ipc_send_msg>:
+{
+  801b01:	55                   	push   %ebp
+  801b02:	89 e5                	mov    %esp,%ebp
+  801b04:	57                   	push   %edi
+  801b05:	56                   	push   %esi
+  801b06:	53                   	push   %ebx
+  801b07:	83 ec 20             	sub    $0x20,%esp
+  801b0a:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801b0d:	8b 10                	mov    (%eax),%edx
+  801b0f:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801b12:	8b 50 04             	mov    0x4(%eax),%edx
+  801b15:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801b18:	8b 50 08             	mov    0x8(%eax),%edx
+  801b1b:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801b1e:	8b 50 0c             	mov    0xc(%eax),%edx
+  801b21:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801b24:	8b 40 10             	mov    0x10(%eax),%eax
+  801b27:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801b2a:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801b2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b30:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801b35:	55                   	push   %ebp
+  801b36:	56                   	push   %esi
+  801b37:	8b 0e                	mov    (%esi),%ecx
+  801b39:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801b3c:	8b 7e 08             	mov    0x8(%esi),%edi
+  801b3f:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801b42:	8b 76 0c             	mov    0xc(%esi),%esi
+  801b45:	cd 30                	int    $0x30
+  801b47:	87 34 24             	xchg   %esi,(%esp)
+  801b4a:	89 0e                	mov    %ecx,(%esi)
+  801b4c:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801b4f:	89 7e 08             	mov    %edi,0x8(%esi)
+  801b52:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801b55:	8f 46 0c             	pop    0xc(%esi)
+  801b58:	5d                   	pop    %ebp
+}
+  801b59:	83 c4 20             	add    $0x20,%esp
+  801b5c:	5b                   	pop    %ebx
+  801b5d:	5e                   	pop    %esi
+  801b5e:	5f                   	pop    %edi
+  801b5f:	5d                   	pop    %ebp
+  801b60:	c3                   	ret
+
+00801b61 <sys_fork>:
+{
+  801b61:	55                   	push   %ebp
+  801b62:	89 e5                	mov    %esp,%ebp
+  801b64:	57                   	push   %edi
+  801b65:	56                   	push   %esi
+  801b66:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801b67:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b6e:	78 2e                	js     801b9e <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801b70:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b77:	74 71                	je     801bea <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801b79:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b7e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801b83:	89 d1                	mov    %edx,%ecx
+  801b85:	89 d3                	mov    %edx,%ebx
+  801b87:	89 d7                	mov    %edx,%edi
+  801b89:	89 d6                	mov    %edx,%esi
+  801b8b:	55                   	push   %ebp
+  801b8c:	68 95 1b 80 00       	push   $0x801b95
+  801b91:	89 e5                	mov    %esp,%ebp
+  801b93:	0f 34                	sysenter
+  801b95:	83 c4 04             	add    $0x4,%esp
+  801b98:	5d                   	pop    %ebp
+}
+  801b99:	5b                   	pop    %ebx
+  801b9a:	5e                   	pop    %esi
+  801b9b:	5f                   	pop    %edi
+  801b9c:	5d                   	pop    %ebp
+  801b9d:	c3                   	ret
+  801b9e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ba3:	0f a2                	cpuid
+		return 0;
+  801ba5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801baa:	f6 c6 08             	test   $0x8,%dh
+  801bad:	74 15                	je     801bc4 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801baf:	89 c2                	mov    %eax,%edx
+  801bb1:	c1 ea 08             	shr    $0x8,%edx
+  801bb4:	83 e2 0f             	and    $0xf,%edx
+  801bb7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801bbc:	83 fa 06             	cmp    $0x6,%edx
+  801bbf:	74 0e                	je     801bcf <sys_fork+0x6e>
+  801bc1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801bc4:	0f b6 c9             	movzbl %cl,%ecx
+  801bc7:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801bcd:	eb a1                	jmp    801b70 <sys_fork+0xf>
+  801bcf:	89 c2                	mov    %eax,%edx
+  801bd1:	c1 ea 04             	shr    $0x4,%edx
+  801bd4:	83 e2 0f             	and    $0xf,%edx
+  801bd7:	83 fa 02             	cmp    $0x2,%edx
+  801bda:	77 e5                	ja     801bc1 <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801bdc:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bdf:	83 f8 02             	cmp    $0x2,%eax
+  801be2:	0f 97 c1             	seta   %cl
+  801be5:	0f b6 c9             	movzbl %cl,%ecx
+  801be8:	eb d7                	jmp    801bc1 <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801bea:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bef:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801bf4:	89 d1                	mov    %edx,%ecx
+  801bf6:	89 d3                	mov    %edx,%ebx
+  801bf8:	89 d7                	mov    %edx,%edi
+  801bfa:	89 d6                	mov    %edx,%esi
+  801bfc:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801bfe:	eb 99                	jmp    801b99 <sys_fork+0x38>
+
+00801c00 <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801c00:	55                   	push   %ebp
+  801c01:	89 e5                	mov    %esp,%ebp
+  801c03:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801c06:	ff 75 14             	push   0x14(%ebp)
+  801c09:	ff 75 10             	push   0x10(%ebp)
+  801c0c:	ff 75 0c             	push   0xc(%ebp)
+  801c0f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c14:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c17:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801c1c:	e8 81 ee ff ff       	call   800aa2 <page_vec_call>
+}
+  801c21:	c9                   	leave
+  801c22:	c3                   	ret
+
+00801c23 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801c23:	55                   	push   %ebp
+  801c24:	89 e5                	mov    %esp,%ebp
+  801c26:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801c29:	ff 75 18             	push   0x18(%ebp)
+  801c2c:	ff 75 14             	push   0x14(%ebp)
+  801c2f:	ff 75 10             	push   0x10(%ebp)
+  801c32:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c35:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c38:	b8 10 00 00 00       	mov    $0x10,%eax
+  801c3d:	e8 60 ee ff ff       	call   800aa2 <page_vec_call>
+}
+  801c42:	c9                   	leave
+  801c43:	c3                   	ret
+
+00801c44 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801c44:	55                   	push   %ebp
+  801c45:	89 e5                	mov    %esp,%ebp
+  801c47:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801c4a:	ff 75 14             	push   0x14(%ebp)
+  801c4d:	ff 75 10             	push   0x10(%ebp)
+  801c50:	ff 75 0c             	push   0xc(%ebp)
+  801c53:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c58:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c5b:	b8 11 00 00 00       	mov    $0x11,%eax
+  801c60:	e8 3d ee ff ff       	call   800aa2 <page_vec_call>
+}
+  801c65:	c9                   	leave
+  801c66:	c3                   	ret
+
+00801c67 <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801c67:	55                   	push   %ebp
+  801c68:	89 e5                	mov    %esp,%ebp
+  801c6a:	57                   	push   %edi
+  801c6b:	56                   	push   %esi
+  801c6c:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801c6d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801c74:	78 32                	js     801ca8 <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801c76:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801c7d:	74 75                	je     801cf4 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801c7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c85:	b8 12 00 00 00       	mov    $0x12,%eax
+  801c8a:	be 00 00 00 00       	mov    $0x0,%esi
+  801c8f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801c92:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801c95:	55                   	push   %ebp
+  801c96:	68 9f 1c 80 00       	push   $0x801c9f
+  801c9b:	89 e5                	mov    %esp,%ebp
+  801c9d:	0f 34                	sysenter
+  801c9f:	83 c4 04             	add    $0x4,%esp
+  801ca2:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801ca3:	5b                   	pop    %ebx
+  801ca4:	5e                   	pop    %esi
+  801ca5:	5f                   	pop    %edi
+  801ca6:	5d                   	pop    %ebp
+  801ca7:	c3                   	ret
+  801ca8:	b8 01 00 00 00       	mov    $0x1,%eax
+  801cad:	0f a2                	cpuid
+		return 0;
+  801caf:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801cb4:	f6 c6 08             	test   $0x8,%dh
+  801cb7:	74 15                	je     801cce <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801cb9:	89 c2                	mov    %eax,%edx
+  801cbb:	c1 ea 08             	shr    $0x8,%edx
+  801cbe:	83 e2 0f             	and    $0xf,%edx
+  801cc1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801cc6:	83 fa 06             	cmp    $0x6,%edx
+  801cc9:	74 0e                	je     801cd9 <sys_vm_ranges+0x72>
+  801ccb:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801cce:	0f b6 c9             	movzbl %cl,%ecx
+  801cd1:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801cd7:	eb 9d                	jmp    801c76 <sys_vm_ranges+0xf>
+  801cd9:	89 c2                	mov    %eax,%edx
+  801cdb:	c1 ea 04             	shr    $0x4,%edx
+  801cde:	83 e2 0f             	and    $0xf,%edx
+  801ce1:	83 fa 02             	cmp    $0x2,%edx
+  801ce4:	77 e5                	ja     801ccb <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  801ce6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ce9:	83 f8 02             	cmp    $0x2,%eax
+  801cec:	0f 97 c1             	seta   %cl
+  801cef:	0f b6 c9             	movzbl %cl,%ecx
+  801cf2:	eb d7                	jmp    801ccb <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801cf4:	b8 12 00 00 00       	mov    $0x12,%eax
+  801cf9:	be 00 00 00 00       	mov    $0x0,%esi
+  801cfe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d01:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d04:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d07:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801d0a:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801d0c:	eb 95                	jmp    801ca3 <sys_vm_ranges+0x3c>
+
+00801d0e <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801d0e:	55                   	push   %ebp
+  801d0f:	89 e5                	mov    %esp,%ebp
+  801d11:	57                   	push   %edi
+  801d12:	56                   	push   %esi
+  801d13:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801d14:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801d1b:	78 31                	js     801d4e <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801d1d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801d24:	74 74                	je     801d9a <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801d26:	be 00 00 00 00       	mov    $0x0,%esi
+  801d2b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d2e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d31:	b8 14 00 00 00       	mov    $0x14,%eax
+  801d36:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d39:	89 f7                	mov    %esi,%edi
+  801d3b:	55                   	push   %ebp
+  801d3c:	68 45 1d 80 00       	push   $0x801d45
+  801d41:	89 e5                	mov    %esp,%ebp
+  801d43:	0f 34                	sysenter
+  801d45:	83 c4 04             	add    $0x4,%esp
+  801d48:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801d49:	5b                   	pop    %ebx
+  801d4a:	5e                   	pop    %esi
+  801d4b:	5f                   	pop    %edi
+  801d4c:	5d                   	pop    %ebp
+  801d4d:	c3                   	ret
+  801d4e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d53:	0f a2                	cpuid
+		return 0;
+  801d55:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801d5a:	f6 c6 08             	test   $0x8,%dh
+  801d5d:	74 15                	je     801d74 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d5f:	89 c2                	mov    %eax,%edx
+  801d61:	c1 ea 08             	shr    $0x8,%edx
+  801d64:	83 e2 0f             	and    $0xf,%edx
+  801d67:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d6c:	83 fa 06             	cmp    $0x6,%edx
+  801d6f:	74 0e                	je     801d7f <sys_spawn+0x71>
+  801d71:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801d74:	0f b6 c9             	movzbl %cl,%ecx
+  801d77:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801d7d:	eb 9e                	jmp    801d1d <sys_spawn+0xf>
+  801d7f:	89 c2                	mov    %eax,%edx
+  801d81:	c1 ea 04             	shr    $0x4,%edx
+  801d84:	83 e2 0f             	and    $0xf,%edx
+  801d87:	83 fa 02             	cmp    $0x2,%edx
+  801d8a:	77 e5                	ja     801d71 <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  801d8c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d8f:	83 f8 02             	cmp    $0x2,%eax
+  801d92:	0f 97 c1             	seta   %cl
+  801d95:	0f b6 c9             	movzbl %cl,%ecx
+  801d98:	eb d7                	jmp    801d71 <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  801d9a:	be 00 00 00 00       	mov    $0x0,%esi
+  801d9f:	b8 14 00 00 00       	mov    $0x14,%eax
+  801da4:	8b 55 08             	mov    0x8(%ebp),%edx
+  801da7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801daa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801dad:	89 f7                	mov    %esi,%edi
+  801daf:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  801db1:	eb 96                	jmp    801d49 <sys_spawn+0x3b>
+
+00801db3 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  801db3:	55                   	push   %ebp
+  801db4:	89 e5                	mov    %esp,%ebp
+  801db6:	57                   	push   %edi
+  801db7:	56                   	push   %esi
+  801db8:	53                   	push   %ebx
+  801db9:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801dbc:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801dc3:	78 37                	js     801dfc <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  801dc5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801dcc:	74 7a                	je     801e48 <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  801dce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dd3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801dd6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801dd9:	b8 15 00 00 00       	mov    $0x15,%eax
+  801dde:	89 df                	mov    %ebx,%edi
+  801de0:	89 de                	mov    %ebx,%esi
+  801de2:	55                   	push   %ebp
+  801de3:	68 ec 1d 80 00       	push   $0x801dec
+  801de8:	89 e5                	mov    %esp,%ebp
+  801dea:	0f 34                	sysenter
+  801dec:	83 c4 04             	add    $0x4,%esp
+  801def:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801df0:	85 c0                	test   %eax,%eax
+  801df2:	7f 6c                	jg     801e60 <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  801df4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801df7:	5b                   	pop    %ebx
+  801df8:	5e                   	pop    %esi
+  801df9:	5f                   	pop    %edi
+  801dfa:	5d                   	pop    %ebp
+  801dfb:	c3                   	ret
+  801dfc:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e01:	0f a2                	cpuid
+		return 0;
+  801e03:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801e08:	f6 c6 08             	test   $0x8,%dh
+  801e0b:	74 15                	je     801e22 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e0d:	89 c2                	mov    %eax,%edx
+  801e0f:	c1 ea 08             	shr    $0x8,%edx
+  801e12:	83 e2 0f             	and    $0xf,%edx
+  801e15:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e1a:	83 fa 06             	cmp    $0x6,%edx
+  801e1d:	74 0e                	je     801e2d <sys_shm_create+0x7a>
+  801e1f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801e22:	0f b6 c9             	movzbl %cl,%ecx
+  801e25:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801e2b:	eb 98                	jmp    801dc5 <sys_shm_create+0x12>
+  801e2d:	89 c2                	mov    %eax,%edx
+  801e2f:	c1 ea 04             	shr    $0x4,%edx
+  801e32:	83 e2 0f             	and    $0xf,%edx
+  801e35:	83 fa 02             	cmp    $0x2,%edx
+  801e38:	77 e5                	ja     801e1f <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  801e3a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e3d:	83 f8 02             	cmp    $0x2,%eax
+  801e40:	0f 97 c1             	seta   %cl
+  801e43:	0f b6 c9             	movzbl %cl,%ecx
+  801e46:	eb d7                	jmp    801e1f <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  801e48:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e4d:	b8 15 00 00 00       	mov    $0x15,%eax
+  801e52:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e55:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e58:	89 df                	mov    %ebx,%edi
+  801e5a:	89 de                	mov    %ebx,%esi
+  801e5c:	cd 30                	int    $0x30
+  801e5e:	eb 90                	jmp    801df0 <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801e60:	83 ec 0c             	sub    $0xc,%esp
+  801e63:	50                   	push   %eax
+  801e64:	6a 15                	push   $0x15
+  801e66:	68 19 2c 80 00       	push   $0x802c19
+  801e6b:	6a 4a                	push   $0x4a
+  801e6d:	68 36 2c 80 00       	push   $0x802c36
+  801e72:	e8 2c 08 00 00       	call   8026a3 <_panic>
+
+00801e77 <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  801e77:	55                   	push   %ebp
+  801e78:	89 e5                	mov    %esp,%ebp
+  801e7a:	57                   	push   %edi
+  801e7b:	56                   	push   %esi
+  801e7c:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801e7d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801e84:	78 32                	js     801eb8 <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  801e86:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801e8d:	74 75                	je     801f04 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801e8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e92:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e95:	b8 16 00 00 00       	mov    $0x16,%eax
+  801e9a:	be 00 00 00 00       	mov    $0x0,%esi
+  801e9f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ea2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ea5:	55                   	push   %ebp
+  801ea6:	68 af 1e 80 00       	push   $0x801eaf
+  801eab:	89 e5                	mov    %esp,%ebp
+  801ead:	0f 34                	sysenter
+  801eaf:	83 c4 04             	add    $0x4,%esp
+  801eb2:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  801eb3:	5b                   	pop    %ebx
+  801eb4:	5e                   	pop    %esi
+  801eb5:	5f                   	pop    %edi
+  801eb6:	5d                   	pop    %ebp
+  801eb7:	c3                   	ret
+  801eb8:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ebd:	0f a2                	cpuid
+		return 0;
+  801ebf:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801ec4:	f6 c6 08             	test   $0x8,%dh
+  801ec7:	74 15                	je     801ede <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ec9:	89 c2                	mov    %eax,%edx
+  801ecb:	c1 ea 08             	shr    $0x8,%edx
+  801ece:	83 e2 0f             	and    $0xf,%edx
+  801ed1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ed6:	83 fa 06             	cmp    $0x6,%edx
+  801ed9:	74 0e                	je     801ee9 <sys_shm_attach+0x72>
+  801edb:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801ede:	0f b6 c9             	movzbl %cl,%ecx
+  801ee1:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801ee7:	eb 9d                	jmp    801e86 <sys_shm_attach+0xf>
+  801ee9:	89 c2                	mov    %eax,%edx
+  801eeb:	c1 ea 04             	shr    $0x4,%edx
+  801eee:	83 e2 0f             	and    $0xf,%edx
+  801ef1:	83 fa 02             	cmp    $0x2,%edx
+  801ef4:	77 e5                	ja     801edb <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  801ef6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ef9:	83 f8 02             	cmp    $0x2,%eax
+  801efc:	0f 97 c1             	seta   %cl
+  801eff:	0f b6 c9             	movzbl %cl,%ecx
+  801f02:	eb d7                	jmp    801edb <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  801f04:	b8 16 00 00 00       	mov    $0x16,%eax
+  801f09:	be 00 00 00 00       	mov    $0x0,%esi
+  801f0e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f11:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f14:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f17:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801f1a:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  801f1c:	eb 95                	jmp    801eb3 <sys_shm_attach+0x3c>
+
+00801f1e <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  801f1e:	55                   	push   %ebp
+  801f1f:	89 e5                	mov    %esp,%ebp
+  801f21:	57                   	push   %edi
+  801f22:	56                   	push   %esi
+  801f23:	53                   	push   %ebx
+  801f24:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801f27:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801f2e:	78 38                	js     801f68 <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  801f30:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801f37:	74 7b                	je     801fb4 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  801f39:	be 00 00 00 00       	mov    $0x0,%esi
+  801f3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f41:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f44:	b8 17 00 00 00       	mov    $0x17,%eax
+  801f49:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f4c:	89 f7                	mov    %esi,%edi
+  801f4e:	55                   	push   %ebp
+  801f4f:	68 58 1f 80 00       	push   $0x801f58
+  801f54:	89 e5                	mov    %esp,%ebp
+  801f56:	0f 34                	sysenter
+  801f58:	83 c4 04             	add    $0x4,%esp
+  801f5b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801f5c:	85 c0                	test   %eax,%eax
+  801f5e:	7f 6d                	jg     801fcd <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  801f60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f63:	5b                   	pop    %ebx
+  801f64:	5e                   	pop    %esi
+  801f65:	5f                   	pop    %edi
+  801f66:	5d                   	pop    %ebp
+  801f67:	c3                   	ret
+  801f68:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f6d:	0f a2                	cpuid
+		return 0;
+  801f6f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801f74:	f6 c6 08             	test   $0x8,%dh
+  801f77:	74 15                	je     801f8e <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f79:	89 c2                	mov    %eax,%edx
+  801f7b:	c1 ea 08             	shr    $0x8,%edx
+  801f7e:	83 e2 0f             	and    $0xf,%edx
+  801f81:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f86:	83 fa 06             	cmp    $0x6,%edx
+  801f89:	74 0e                	je     801f99 <sys_shm_detach+0x7b>
+  801f8b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801f8e:	0f b6 c9             	movzbl %cl,%ecx
+  801f91:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801f97:	eb 97                	jmp    801f30 <sys_shm_detach+0x12>
+  801f99:	89 c2                	mov    %eax,%edx
+  801f9b:	c1 ea 04             	shr    $0x4,%edx
+  801f9e:	83 e2 0f             	and    $0xf,%edx
+  801fa1:	83 fa 02             	cmp    $0x2,%edx
+  801fa4:	77 e5                	ja     801f8b <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  801fa6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fa9:	83 f8 02             	cmp    $0x2,%eax
+  801fac:	0f 97 c1             	seta   %cl
+  801faf:	0f b6 c9             	movzbl %cl,%ecx
+  801fb2:	eb d7                	jmp    801f8b <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  801fb4:	be 00 00 00 00       	mov    $0x0,%esi
+  801fb9:	b8 17 00 00 00       	mov    $0x17,%eax
+  801fbe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fc1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fc4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801fc7:	89 f7                	mov    %esi,%edi
+  801fc9:	cd 30                	int    $0x30
+  801fcb:	eb 8f                	jmp    801f5c <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801fcd:	83 ec 0c             	sub    $0xc,%esp
+  801fd0:	50                   	push   %eax
+  801fd1:	6a 17                	push   $0x17
+  801fd3:	68 19 2c 80 00       	push   $0x802c19
+  801fd8:	6a 4a                	push   $0x4a
+  801fda:	68 36 2c 80 00       	push   $0x802c36
+  801fdf:	e8 bf 06 00 00       	call   8026a3 <_panic>
+
+00801fe4 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  801fe4:	55                   	push   %ebp
+  801fe5:	89 e5                	mov    %esp,%ebp
+  801fe7:	57                   	push   %edi
+  801fe8:	56                   	push   %esi
+  801fe9:	53                   	push   %ebx
+  801fea:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801fed:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801ff4:	78 36                	js     80202c <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  801ff6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801ffd:	74 79                	je     802078 <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  801fff:	8b 55 08             	mov    0x8(%ebp),%edx
+  802002:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802007:	b8 18 00 00 00       	mov    $0x18,%eax
+  80200c:	89 cb                	mov    %ecx,%ebx
+  80200e:	89 cf                	mov    %ecx,%edi
+  802010:	89 ce                	mov    %ecx,%esi
+  802012:	55                   	push   %ebp
+  802013:	68 1c 20 80 00       	push   $0x80201c
+  802018:	89 e5                	mov    %esp,%ebp
+  80201a:	0f 34                	sysenter
+  80201c:	83 c4 04             	add    $0x4,%esp
+  80201f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802020:	85 c0                	test   %eax,%eax
+  802022:	7f 6b                	jg     80208f <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  802024:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802027:	5b                   	pop    %ebx
+  802028:	5e                   	pop    %esi
+  802029:	5f                   	pop    %edi
+  80202a:	5d                   	pop    %ebp
+  80202b:	c3                   	ret
+  80202c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802031:	0f a2                	cpuid
+		return 0;
+  802033:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802038:	f6 c6 08             	test   $0x8,%dh
+  80203b:	74 15                	je     802052 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80203d:	89 c2                	mov    %eax,%edx
+  80203f:	c1 ea 08             	shr    $0x8,%edx
+  802042:	83 e2 0f             	and    $0xf,%edx
+  802045:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80204a:	83 fa 06             	cmp    $0x6,%edx
+  80204d:	74 0e                	je     80205d <sys_shm_remove+0x79>
+  80204f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802052:	0f b6 c9             	movzbl %cl,%ecx
+  802055:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80205b:	eb 99                	jmp    801ff6 <sys_shm_remove+0x12>
+  80205d:	89 c2                	mov    %eax,%edx
+  80205f:	c1 ea 04             	shr    $0x4,%edx
+  802062:	83 e2 0f             	and    $0xf,%edx
+  802065:	83 fa 02             	cmp    $0x2,%edx
+  802068:	77 e5                	ja     80204f <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  80206a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80206d:	83 f8 02             	cmp    $0x2,%eax
+  802070:	0f 97 c1             	seta   %cl
+  802073:	0f b6 c9             	movzbl %cl,%ecx
+  802076:	eb d7                	jmp    80204f <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  802078:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80207d:	b8 18 00 00 00       	mov    $0x18,%eax
+  802082:	8b 55 08             	mov    0x8(%ebp),%edx
+  802085:	89 cb                	mov    %ecx,%ebx
+  802087:	89 cf                	mov    %ecx,%edi
+  802089:	89 ce                	mov    %ecx,%esi
+  80208b:	cd 30                	int    $0x30
+  80208d:	eb 91                	jmp    802020 <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80208f:	83 ec 0c             	sub    $0xc,%esp
+  802092:	50                   	push   %eax
+  802093:	6a 18                	push   $0x18
+  802095:	68 19 2c 80 00       	push   $0x802c19
+  80209a:	6a 4a                	push   $0x4a
+  80209c:	68 36 2c 80 00       	push   $0x802c36
+  8020a1:	e8 fd 05 00 00       	call   8026a3 <_panic>
+
+008020a6 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  8020a6:	55                   	push   %ebp
+  8020a7:	89 e5                	mov    %esp,%ebp
+  8020a9:	57                   	push   %edi
+  8020aa:	56                   	push   %esi
+  8020ab:	53                   	push   %ebx
+  8020ac:	83 ec 0c             	sub    $0xc,%esp
+  8020af:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020b2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8020b5:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  8020b8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8020bf:	78 32                	js     8020f3 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  8020c1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8020c8:	74 75                	je     80213f <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  8020ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020d0:	b8 20 00 00 00       	mov    $0x20,%eax
+  8020d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8020da:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8020dd:	55                   	push   %ebp
+  8020de:	68 e7 20 80 00       	push   $0x8020e7
+  8020e3:	89 e5                	mov    %esp,%ebp
+  8020e5:	0f 34                	sysenter
+  8020e7:	83 c4 04             	add    $0x4,%esp
+  8020ea:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  8020eb:	83 c4 0c             	add    $0xc,%esp
+  8020ee:	5b                   	pop    %ebx
+  8020ef:	5e                   	pop    %esi
+  8020f0:	5f                   	pop    %edi
+  8020f1:	5d                   	pop    %ebp
+  8020f2:	c3                   	ret
+  8020f3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020f8:	0f a2                	cpuid
+		return 0;
+  8020fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8020ff:	f6 c6 08             	test   $0x8,%dh
+  802102:	74 15                	je     802119 <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802104:	89 c2                	mov    %eax,%edx
+  802106:	c1 ea 08             	shr    $0x8,%edx
+  802109:	83 e2 0f             	and    $0xf,%edx
+  80210c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802111:	83 fa 06             	cmp    $0x6,%edx
+  802114:	74 0e                	je     802124 <sys_futex_wait+0x7e>
+  802116:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802119:	0f b6 c9             	movzbl %cl,%ecx
+  80211c:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802122:	eb 9d                	jmp    8020c1 <sys_futex_wait+0x1b>
+  802124:	89 c2                	mov    %eax,%edx
+  802126:	c1 ea 04             	shr    $0x4,%edx
+  802129:	83 e2 0f             	and    $0xf,%edx
+  80212c:	83 fa 02             	cmp    $0x2,%edx
+  80212f:	77 e5                	ja     802116 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  802131:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802134:	83 f8 02             	cmp    $0x2,%eax
+  802137:	0f 97 c1             	seta   %cl
+  80213a:	0f b6 c9             	movzbl %cl,%ecx
+  80213d:	eb d7                	jmp    802116 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  80213f:	b8 20 00 00 00       	mov    $0x20,%eax
+  802144:	be 00 00 00 00       	mov    $0x0,%esi
+  802149:	8b 55 08             	mov    0x8(%ebp),%edx
+  80214c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80214f:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802152:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  802154:	eb 95                	jmp    8020eb <sys_futex_wait+0x45>
+
+00802156 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  802156:	55                   	push   %ebp
+  802157:	89 e5                	mov    %esp,%ebp
+  802159:	57                   	push   %edi
+  80215a:	56                   	push   %esi
+  80215b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80215c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802163:	78 30                	js     802195 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  802165:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80216c:	74 73                	je     8021e1 <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  80216e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802173:	8b 55 08             	mov    0x8(%ebp),%edx
+  802176:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802179:	b8 21 00 00 00       	mov    $0x21,%eax
+  80217e:	89 df                	mov    %ebx,%edi
+  802180:	89 de                	mov    %ebx,%esi
+  802182:	55                   	push   %ebp
+  802183:	68 8c 21 80 00       	push   $0x80218c
+  802188:	89 e5                	mov    %esp,%ebp
+  80218a:	0f 34                	sysenter
+  80218c:	83 c4 04             	add    $0x4,%esp
+  80218f:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  802190:	5b                   	pop    %ebx
+  802191:	5e                   	pop    %esi
+  802192:	5f                   	pop    %edi
+  802193:	5d                   	pop    %ebp
+  802194:	c3                   	ret
+  802195:	b8 01 00 00 00       	mov    $0x1,%eax
+  80219a:	0f a2                	cpuid
+		return 0;
+  80219c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8021a1:	f6 c6 08             	test   $0x8,%dh
+  8021a4:	74 15                	je     8021bb <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021a6:	89 c2                	mov    %eax,%edx
+  8021a8:	c1 ea 08             	shr    $0x8,%edx
+  8021ab:	83 e2 0f             	and    $0xf,%edx
+  8021ae:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8021b3:	83 fa 06             	cmp    $0x6,%edx
+  8021b6:	74 0e                	je     8021c6 <sys_futex_wake+0x70>
+  8021b8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8021bb:	0f b6 c9             	movzbl %cl,%ecx
+  8021be:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8021c4:	eb 9f                	jmp    802165 <sys_futex_wake+0xf>
+  8021c6:	89 c2                	mov    %eax,%edx
+  8021c8:	c1 ea 04             	shr    $0x4,%edx
+  8021cb:	83 e2 0f             	and    $0xf,%edx
+  8021ce:	83 fa 02             	cmp    $0x2,%edx
+  8021d1:	77 e5                	ja     8021b8 <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  8021d3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021d6:	83 f8 02             	cmp    $0x2,%eax
+  8021d9:	0f 97 c1             	seta   %cl
+  8021dc:	0f b6 c9             	movzbl %cl,%ecx
+  8021df:	eb d7                	jmp    8021b8 <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  8021e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021e6:	b8 21 00 00 00       	mov    $0x21,%eax
+  8021eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021f1:	89 df                	mov    %ebx,%edi
+  8021f3:	89 de                	mov    %ebx,%esi
+  8021f5:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  8021f7:	eb 97                	jmp    802190 <sys_futex_wake+0x3a>
+
+008021f9 <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  8021f9:	55                   	push   %ebp
+  8021fa:	89 e5                	mov    %esp,%ebp
+  8021fc:	57                   	push   %edi
+  8021fd:	56                   	push   %esi
+  8021fe:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8021ff:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802206:	78 2e                	js     802236 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  802208:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80220f:	74 71                	je     802282 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  802211:	ba 00 00 00 00       	mov    $0x0,%edx
+  802216:	b8 22 00 00 00       	mov    $0x22,%eax
+  80221b:	89 d1                	mov    %edx,%ecx
+  80221d:	89 d3                	mov    %edx,%ebx
+  80221f:	89 d7                	mov    %edx,%edi
+  802221:	89 d6                	mov    %edx,%esi
+  802223:	55                   	push   %ebp
+  802224:	68 2d 22 80 00       	push   $0x80222d
+  802229:	89 e5                	mov    %esp,%ebp
+  80222b:	0f 34                	sysenter
+  80222d:	83 c4 04             	add    $0x4,%esp
+  802230:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  802231:	5b                   	pop    %ebx
+  802232:	5e                   	pop    %esi
+  802233:	5f                   	pop    %edi
+  802234:	5d                   	pop    %ebp
+  802235:	c3                   	ret
+  802236:	b8 01 00 00 00       	mov    $0x1,%eax
+  80223b:	0f a2                	cpuid
+		return 0;
+  80223d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802242:	f6 c6 08             	test   $0x8,%dh
+  802245:	74 15                	je     80225c <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802247:	89 c2                	mov    %eax,%edx
+  802249:	c1 ea 08             	shr    $0x8,%edx
+  80224c:	83 e2 0f             	and    $0xf,%edx
+  80224f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802254:	83 fa 06             	cmp    $0x6,%edx
+  802257:	74 0e                	je     802267 <sys_ep_create+0x6e>
+  802259:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80225c:	0f b6 c9             	movzbl %cl,%ecx
+  80225f:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802265:	eb a1                	jmp    802208 <sys_ep_create+0xf>
+  802267:	89 c2                	mov    %eax,%edx
+  802269:	c1 ea 04             	shr    $0x4,%edx
+  80226c:	83 e2 0f             	and    $0xf,%edx
+  80226f:	83 fa 02             	cmp    $0x2,%edx
+  802272:	77 e5                	ja     802259 <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  802274:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802277:	83 f8 02             	cmp    $0x2,%eax
+  80227a:	0f 97 c1             	seta   %cl
+  80227d:	0f b6 c9             	movzbl %cl,%ecx
+  802280:	eb d7                	jmp    802259 <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  802282:	ba 00 00 00 00       	mov    $0x0,%edx
+  802287:	b8 22 00 00 00       	mov    $0x22,%eax
+  80228c:	89 d1                	mov    %edx,%ecx
+  80228e:	89 d3                	mov    %edx,%ebx
+  802290:	89 d7                	mov    %edx,%edi
+  802292:	89 d6                	mov    %edx,%esi
+  802294:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  802296:	eb 99                	jmp    802231 <sys_ep_create+0x38>
+
+00802298 <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  802298:	55                   	push   %ebp
+  802299:	89 e5                	mov    %esp,%ebp
+  80229b:	57                   	push   %edi
+  80229c:	56                   	push   %esi
+  80229d:	53                   	push   %ebx
+  80229e:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8022a1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8022a8:	78 36                	js     8022e0 <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  8022aa:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8022b1:	74 79                	je     80232c <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  8022b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022bb:	b8 23 00 00 00       	mov    $0x23,%eax
+  8022c0:	89 cb                	mov    %ecx,%ebx
+  8022c2:	89 cf                	mov    %ecx,%edi
+  8022c4:	89 ce                	mov    %ecx,%esi
+  8022c6:	55                   	push   %ebp
+  8022c7:	68 d0 22 80 00       	push   $0x8022d0
+  8022cc:	89 e5                	mov    %esp,%ebp
+  8022ce:	0f 34                	sysenter
+  8022d0:	83 c4 04             	add    $0x4,%esp
+  8022d3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8022d4:	85 c0                	test   %eax,%eax
+  8022d6:	7f 6b                	jg     802343 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  8022d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022db:	5b                   	pop    %ebx
+  8022dc:	5e                   	pop    %esi
+  8022dd:	5f                   	pop    %edi
+  8022de:	5d                   	pop    %ebp
+  8022df:	c3                   	ret
+  8022e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022e5:	0f a2                	cpuid
+		return 0;
+  8022e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8022ec:	f6 c6 08             	test   $0x8,%dh
+  8022ef:	74 15                	je     802306 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022f1:	89 c2                	mov    %eax,%edx
+  8022f3:	c1 ea 08             	shr    $0x8,%edx
+  8022f6:	83 e2 0f             	and    $0xf,%edx
+  8022f9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8022fe:	83 fa 06             	cmp    $0x6,%edx
+  802301:	74 0e                	je     802311 <sys_ep_destroy+0x79>
+  802303:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802306:	0f b6 c9             	movzbl %cl,%ecx
+  802309:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80230f:	eb 99                	jmp    8022aa <sys_ep_destroy+0x12>
+  802311:	89 c2                	mov    %eax,%edx
+  802313:	c1 ea 04             	shr    $0x4,%edx
+  802316:	83 e2 0f             	and    $0xf,%edx
+  802319:	83 fa 02             	cmp    $0x2,%edx
+  80231c:	77 e5                	ja     802303 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  80231e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802321:	83 f8 02             	cmp    $0x2,%eax
+  802324:	0f 97 c1             	seta   %cl
+  802327:	0f b6 c9             	movzbl %cl,%ecx
+  80232a:	eb d7                	jmp    802303 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  80232c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802331:	b8 23 00 00 00       	mov    $0x23,%eax
+  802336:	8b 55 08             	mov    0x8(%ebp),%edx
+  802339:	89 cb                	mov    %ecx,%ebx
+  80233b:	89 cf                	mov    %ecx,%edi
+  80233d:	89 ce                	mov    %ecx,%esi
+  80233f:	cd 30                	int    $0x30
+  802341:	eb 91                	jmp    8022d4 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802343:	83 ec 0c             	sub    $0xc,%esp
+  802346:	50                   	push   %eax
+  802347:	6a 23                	push   $0x23
+  802349:	68 19 2c 80 00       	push   $0x802c19
+  80234e:	6a 4a                	push   $0x4a
+  802350:	68 36 2c 80 00       	push   $0x802c36
+  802355:	e8 49 03 00 00       	call   8026a3 <_panic>
+
+0080235a <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  80235a:	55                   	push   %ebp
+  80235b:	89 e5                	mov    %esp,%ebp
+  80235d:	57                   	push   %edi
+  80235e:	56                   	push   %esi
+  80235f:	53                   	push   %ebx
+  802360:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802363:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80236a:	78 37                	js     8023a3 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  80236c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802373:	74 7a                	je     8023ef <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  802375:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80237a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80237d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802380:	b8 24 00 00 00       	mov    $0x24,%eax
+  802385:	89 df                	mov    %ebx,%edi
+  802387:	89 de                	mov    %ebx,%esi
+  802389:	55                   	push   %ebp
+  80238a:	68 93 23 80 00       	push   $0x802393
+  80238f:	89 e5                	mov    %esp,%ebp
+  802391:	0f 34                	sysenter
+  802393:	83 c4 04             	add    $0x4,%esp
+  802396:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802397:	85 c0                	test   %eax,%eax
+  802399:	7f 6c                	jg     802407 <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  80239b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80239e:	5b                   	pop    %ebx
+  80239f:	5e                   	pop    %esi
+  8023a0:	5f                   	pop    %edi
+  8023a1:	5d                   	pop    %ebp
+  8023a2:	c3                   	ret
+  8023a3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023a8:	0f a2                	cpuid
+		return 0;
+  8023aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8023af:	f6 c6 08             	test   $0x8,%dh
+  8023b2:	74 15                	je     8023c9 <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023b4:	89 c2                	mov    %eax,%edx
+  8023b6:	c1 ea 08             	shr    $0x8,%edx
+  8023b9:	83 e2 0f             	and    $0xf,%edx
+  8023bc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8023c1:	83 fa 06             	cmp    $0x6,%edx
+  8023c4:	74 0e                	je     8023d4 <sys_ep_grant+0x7a>
+  8023c6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8023c9:	0f b6 c9             	movzbl %cl,%ecx
+  8023cc:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8023d2:	eb 98                	jmp    80236c <sys_ep_grant+0x12>
+  8023d4:	89 c2                	mov    %eax,%edx
+  8023d6:	c1 ea 04             	shr    $0x4,%edx
+  8023d9:	83 e2 0f             	and    $0xf,%edx
+  8023dc:	83 fa 02             	cmp    $0x2,%edx
+  8023df:	77 e5                	ja     8023c6 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  8023e1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023e4:	83 f8 02             	cmp    $0x2,%eax
+  8023e7:	0f 97 c1             	seta   %cl
+  8023ea:	0f b6 c9             	movzbl %cl,%ecx
+  8023ed:	eb d7                	jmp    8023c6 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  8023ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023f4:	b8 24 00 00 00       	mov    $0x24,%eax
+  8023f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023ff:	89 df                	mov    %ebx,%edi
+  802401:	89 de                	mov    %ebx,%esi
+  802403:	cd 30                	int    $0x30
+  802405:	eb 90                	jmp    802397 <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802407:	83 ec 0c             	sub    $0xc,%esp
+  80240a:	50                   	push   %eax
+  80240b:	6a 24                	push   $0x24
+  80240d:	68 19 2c 80 00       	push   $0x802c19
+  802412:	6a 4a                	push   $0x4a
+  802414:	68 36 2c 80 00       	push   $0x802c36
+  802419:	e8 85 02 00 00       	call   8026a3 <_panic>
+
+0080241e <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  80241e:	55                   	push   %ebp
+  80241f:	89 e5                	mov    %esp,%ebp
+  802421:	57                   	push   %edi
+  802422:	56                   	push   %esi
+  802423:	53                   	push   %ebx
+  802424:	83 ec 20             	sub    $0x20,%esp
+  802427:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  80242a:	8b 10                	mov    (%eax),%edx
+  80242c:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  80242f:	8b 50 04             	mov    0x4(%eax),%edx
+  802432:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802435:	8b 50 08             	mov    0x8(%eax),%edx
+  802438:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  80243b:	8b 50 0c             	mov    0xc(%eax),%edx
+  80243e:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  802441:	8b 40 10             	mov    0x10(%eax),%eax
+  802444:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  802447:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  80244a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80244d:	b8 25 00 00 00       	mov    $0x25,%eax
+  802452:	55                   	push   %ebp
+  802453:	56                   	push   %esi
+  802454:	8b 0e                	mov    (%esi),%ecx
+  802456:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802459:	8b 7e 08             	mov    0x8(%esi),%edi
+  80245c:	8b 6e 10             	mov    0x10(%esi),%ebp
+  80245f:	8b 76 0c             	mov    0xc(%esi),%esi
+  802462:	cd 30                	int    $0x30
+  802464:	87 34 24             	xchg   %esi,(%esp)
+  802467:	89 0e                	mov    %ecx,(%esi)
+  802469:	89 5e 04             	mov    %ebx,0x4(%esi)
+  80246c:	89 7e 08             	mov    %edi,0x8(%esi)
+  80246f:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802472:	8f 46 0c             	pop    0xc(%esi)
+  802475:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  802476:	83 c4 20             	add    $0x20,%esp
+  802479:	5b                   	pop    %ebx
+  80247a:	5e                   	pop    %esi
+  80247b:	5f                   	pop    %edi
+  80247c:	5d                   	pop    %ebp
+  80247d:	c3                   	ret
+
+0080247e <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  80247e:	55                   	push   %ebp
+  80247f:	89 e5                	mov    %esp,%ebp
+  802481:	57                   	push   %edi
+  802482:	56                   	push   %esi
+  802483:	53                   	push   %ebx
+  802484:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  802487:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80248a:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  80248c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80248f:	b8 26 00 00 00       	mov    $0x26,%eax
+  802494:	55                   	push   %ebp
+  802495:	56                   	push   %esi
+  802496:	8b 0e                	mov    (%esi),%ecx
+  802498:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80249b:	8b 7e 08             	mov    0x8(%esi),%edi
+  80249e:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8024a1:	8b 76 0c             	mov    0xc(%esi),%esi
+  8024a4:	cd 30                	int    $0x30
+  8024a6:	87 34 24             	xchg   %esi,(%esp)
+  8024a9:	89 0e                	mov    %ecx,(%esi)
+  8024ab:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8024ae:	89 7e 08             	mov    %edi,0x8(%esi)
+  8024b1:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8024b4:	8f 46 0c             	pop    0xc(%esi)
+  8024b7:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  8024b8:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  8024bc:	74 0f                	je     8024cd <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  8024be:	85 c0                	test   %eax,%eax
+  8024c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024c5:	0f 48 d1             	cmovs  %ecx,%edx
+  8024c8:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8024cb:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  8024cd:	5b                   	pop    %ebx
+  8024ce:	5e                   	pop    %esi
+  8024cf:	5f                   	pop    %edi
+  8024d0:	5d                   	pop    %ebp
+  8024d1:	c3                   	ret
+
+008024d2 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  8024d2:	55                   	push   %ebp
+  8024d3:	89 e5                	mov    %esp,%ebp
+  8024d5:	57                   	push   %edi
+  8024d6:	56                   	push   %esi
+  8024d7:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8024d8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8024df:	78 2f                	js     802510 <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  8024e1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8024e8:	74 72                	je     80255c <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  8024ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024f2:	b8 27 00 00 00       	mov    $0x27,%eax
+  8024f7:	89 cb                	mov    %ecx,%ebx
+  8024f9:	89 cf                	mov    %ecx,%edi
+  8024fb:	89 ce                	mov    %ecx,%esi
+  8024fd:	55                   	push   %ebp
+  8024fe:	68 07 25 80 00       	push   $0x802507
+  802503:	89 e5                	mov    %esp,%ebp
+  802505:	0f 34                	sysenter
+  802507:	83 c4 04             	add    $0x4,%esp
+  80250a:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  80250b:	5b                   	pop    %ebx
+  80250c:	5e                   	pop    %esi
+  80250d:	5f                   	pop    %edi
+  80250e:	5d                   	pop    %ebp
+  80250f:	c3                   	ret
+  802510:	b8 01 00 00 00       	mov    $0x1,%eax
+  802515:	0f a2                	cpuid
+		return 0;
+  802517:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80251c:	f6 c6 08             	test   $0x8,%dh
+  80251f:	74 15                	je     802536 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802521:	89 c2                	mov    %eax,%edx
+  802523:	c1 ea 08             	shr    $0x8,%edx
+  802526:	83 e2 0f             	and    $0xf,%edx
+  802529:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80252e:	83 fa 06             	cmp    $0x6,%edx
+  802531:	74 0e                	je     802541 <sys_sysring_setup+0x6f>
+  802533:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802536:	0f b6 c9             	movzbl %cl,%ecx
+  802539:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80253f:	eb a0                	jmp    8024e1 <sys_sysring_setup+0xf>
+  802541:	89 c2                	mov    %eax,%edx
+  802543:	c1 ea 04             	shr    $0x4,%edx
+  802546:	83 e2 0f             	and    $0xf,%edx
+  802549:	83 fa 02             	cmp    $0x2,%edx
+  80254c:	77 e5                	ja     802533 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  80254e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802551:	83 f8 02             	cmp    $0x2,%eax
+  802554:	0f 97 c1             	seta   %cl
+  802557:	0f b6 c9             	movzbl %cl,%ecx
+  80255a:	eb d7                	jmp    802533 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  80255c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802561:	b8 27 00 00 00       	mov    $0x27,%eax
+  802566:	8b 55 08             	mov    0x8(%ebp),%edx
+  802569:	89 cb                	mov    %ecx,%ebx
+  80256b:	89 cf                	mov    %ecx,%edi
+  80256d:	89 ce                	mov    %ecx,%esi
+  80256f:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  802571:	eb 98                	jmp    80250b <sys_sysring_setup+0x39>
+
+00802573 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  802573:	55                   	push   %ebp
+  802574:	89 e5                	mov    %esp,%ebp
+  802576:	57                   	push   %edi
+  802577:	56                   	push   %esi
+  802578:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802579:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802580:	78 2e                	js     8025b0 <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  802582:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802589:	74 71                	je     8025fc <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  80258b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802590:	b8 28 00 00 00       	mov    $0x28,%eax
+  802595:	89 d1                	mov    %edx,%ecx
+  802597:	89 d3                	mov    %edx,%ebx
+  802599:	89 d7                	mov    %edx,%edi
+  80259b:	89 d6                	mov    %edx,%esi
+  80259d:	55                   	push   %ebp
+  80259e:	68 a7 25 80 00       	push   $0x8025a7
+  8025a3:	89 e5                	mov    %esp,%ebp
+  8025a5:	0f 34                	sysenter
+  8025a7:	83 c4 04             	add    $0x4,%esp
+  8025aa:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8025ab:	5b                   	pop    %ebx
+  8025ac:	5e                   	pop    %esi
+  8025ad:	5f                   	pop    %edi
+  8025ae:	5d                   	pop    %ebp
+  8025af:	c3                   	ret
+  8025b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025b5:	0f a2                	cpuid
+		return 0;
+  8025b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8025bc:	f6 c6 08             	test   $0x8,%dh
+  8025bf:	74 15                	je     8025d6 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025c1:	89 c2                	mov    %eax,%edx
+  8025c3:	c1 ea 08             	shr    $0x8,%edx
+  8025c6:	83 e2 0f             	and    $0xf,%edx
+  8025c9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8025ce:	83 fa 06             	cmp    $0x6,%edx
+  8025d1:	74 0e                	je     8025e1 <sys_sysring_enter+0x6e>
+  8025d3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8025d6:	0f b6 c9             	movzbl %cl,%ecx
+  8025d9:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8025df:	eb a1                	jmp    802582 <sys_sysring_enter+0xf>
+  8025e1:	89 c2                	mov    %eax,%edx
+  8025e3:	c1 ea 04             	shr    $0x4,%edx
+  8025e6:	83 e2 0f             	and    $0xf,%edx
+  8025e9:	83 fa 02             	cmp    $0x2,%edx
+  8025ec:	77 e5                	ja     8025d3 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  8025ee:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025f1:	83 f8 02             	cmp    $0x2,%eax
+  8025f4:	0f 97 c1             	seta   %cl
+  8025f7:	0f b6 c9             	movzbl %cl,%ecx
+  8025fa:	eb d7                	jmp    8025d3 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  8025fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802601:	b8 28 00 00 00       	mov    $0x28,%eax
+  802606:	89 d1                	mov    %edx,%ecx
+  802608:	89 d3                	mov    %edx,%ebx
+  80260a:	89 d7                	mov    %edx,%edi
+  80260c:	89 d6                	mov    %edx,%esi
+  80260e:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  802610:	eb 99                	jmp    8025ab <sys_sysring_enter+0x38>
+
+00802612 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802612:	55                   	push   %ebp
+  802613:	89 e5                	mov    %esp,%ebp
+  802615:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  802618:	83 3d 0c 30 80 00 00 	cmpl   $0x0,0x80300c
+  80261f:	74 0a                	je     80262b <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  802621:	8b 45 08             	mov    0x8(%ebp),%eax
+  802624:	a3 0c 30 80 00       	mov    %eax,0x80300c
+}
+  802629:	c9                   	leave
+  80262a:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE),
+  80262b:	83 ec 04             	sub    $0x4,%esp
+  80262e:	6a 07                	push   $0x7
+  802630:	68 00 f0 bf ee       	push   $0xeebff000
+  802635:	6a 00                	push   $0x0
+  802637:	e8 57 e9 ff ff       	call   800f93 <sys_page_alloc>
+  80263c:	83 c4 10             	add    $0x10,%esp
+  80263f:	85 c0                	test   %eax,%eax
+  802641:	78 28                	js     80266b <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  802643:	83 ec 08             	sub    $0x8,%esp
+  802646:	68 7d 26 80 00       	push   $0x80267d
+  80264b:	6a 00                	push   $0x0
+  80264d:	e8 00 f0 ff ff       	call   801652 <sys_env_set_pgfault_upcall>
+  802652:	83 c4 10             	add    $0x10,%esp
+  802655:	85 c0                	test   %eax,%eax
+  802657:	79 c8                	jns    802621 <set_pgfault_handler+0xf>
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+  802659:	50                   	push   %eax
+  80265a:	68 6c 2c 80 00       	push   $0x802c6c
+  80265f:	6a 24                	push   $0x24
+  802661:	68 a0 2c 80 00       	push   $0x802ca0
+  802666:	e8 38 00 00 00       	call   8026a3 <_panic>
+			panic("set_pgfault_handler: sys_page_alloc: %e", r);
+  80266b:	50                   	push   %eax
+  80266c:	68 44 2c 80 00       	push   $0x802c44
+  802671:	6a 22                	push   $0x22
+  802673:	68 a0 2c 80 00       	push   $0x802ca0
+  802678:	e8 26 00 00 00       	call   8026a3 <_panic>
+
+0080267d <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80267d:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80267e:	a1 0c 30 80 00       	mov    0x80300c,%eax
+	call *%eax
+  802683:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802685:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 0x28(%esp), %ebx		// trap-time eip
+  802688:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl 0x30(%esp), %eax		// trap-time esp
+  80268c:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  802690:	83 e8 04             	sub    $0x4,%eax
+	movl %ebx, (%eax)
+  802693:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 0x30(%esp)
+  802695:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp			// skip fault_va and err
+  802699:	83 c4 08             	add    $0x8,%esp
+	popal
+  80269c:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp			// skip eip
+  80269d:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8026a0:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  8026a1:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8026a2:	c3                   	ret
+
+008026a3 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8026a3:	55                   	push   %ebp
+  8026a4:	89 e5                	mov    %esp,%ebp
+  8026a6:	57                   	push   %edi
+  8026a7:	56                   	push   %esi
+  8026a8:	53                   	push   %ebx
+  8026a9:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  8026af:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  8026b2:	8b 1d 00 30 80 00    	mov    0x803000,%ebx
+  8026b8:	e8 37 e8 ff ff       	call   800ef4 <sys_getenvid>
+  8026bd:	83 ec 04             	sub    $0x4,%esp
+  8026c0:	ff 75 0c             	push   0xc(%ebp)
+  8026c3:	ff 75 08             	push   0x8(%ebp)
+  8026c6:	53                   	push   %ebx
+  8026c7:	50                   	push   %eax
+  8026c8:	68 b0 2c 80 00       	push   $0x802cb0
+  8026cd:	68 00 01 00 00       	push   $0x100
+  8026d2:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  8026d8:	56                   	push   %esi
+  8026d9:	e8 2b e0 ff ff       	call   800709 <snprintf>
+  8026de:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  8026e0:	83 c4 20             	add    $0x20,%esp
+  8026e3:	57                   	push   %edi
+  8026e4:	ff 75 10             	push   0x10(%ebp)
+  8026e7:	bf 00 01 00 00       	mov    $0x100,%edi
+  8026ec:	89 f8                	mov    %edi,%eax
+  8026ee:	29 d8                	sub    %ebx,%eax
+  8026f0:	50                   	push   %eax
+  8026f1:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8026f4:	50                   	push   %eax
+  8026f5:	e8 c1 df ff ff       	call   8006bb <vsnprintf>
+  8026fa:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  8026fc:	83 c4 0c             	add    $0xc,%esp
+  8026ff:	68 5a 29 80 00       	push   $0x80295a
+  802704:	29 df                	sub    %ebx,%edi
+  802706:	57                   	push   %edi
+  802707:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  80270a:	50                   	push   %eax
+  80270b:	e8 f9 df ff ff       	call   800709 <snprintf>
+	sys_cputs(buf, r);
+  802710:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  802713:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  802715:	53                   	push   %ebx
+  802716:	56                   	push   %esi
+  802717:	e8 da e5 ff ff       	call   800cf6 <sys_cputs>
+  80271c:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80271f:	cc                   	int3
+	while (1)
+  802720:	eb fd                	jmp    80271f <_panic+0x7c>
+
+00802722 <dm>:
+  802722:	55                   	push   %ebp
+  802723:	57                   	push   %edi
+  802724:	56                   	push   %esi
+  802725:	53                   	push   %ebx
+  802726:	83 ec 24             	sub    $0x24,%esp
+  802729:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80272d:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802731:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802735:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802739:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80273d:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802741:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802745:	b8 00 00 00 00       	mov    $0x0,%eax
+  80274a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80274f:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802754:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80275b:	00 
+  80275c:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802763:	00 
+  802764:	89 fb                	mov    %edi,%ebx
+  802766:	eb 08                	jmp    802770 <dm+0x4e>
+  802768:	83 e9 01             	sub    $0x1,%ecx
+  80276b:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80276e:	74 68                	je     8027d8 <dm+0xb6>
+  802770:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802774:	01 c0                	add    %eax,%eax
+  802776:	89 c6                	mov    %eax,%esi
+  802778:	89 d7                	mov    %edx,%edi
+  80277a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80277e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802782:	0f ad d0             	shrd   %cl,%edx,%eax
+  802785:	d3 ea                	shr    %cl,%edx
+  802787:	f6 c1 20             	test   $0x20,%cl
+  80278a:	74 04                	je     802790 <dm+0x6e>
+  80278c:	89 d0                	mov    %edx,%eax
+  80278e:	31 d2                	xor    %edx,%edx
+  802790:	83 e0 01             	and    $0x1,%eax
+  802793:	89 04 24             	mov    %eax,(%esp)
+  802796:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80279d:	00 
+  80279e:	8b 04 24             	mov    (%esp),%eax
+  8027a1:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8027a5:	09 f0                	or     %esi,%eax
+  8027a7:	09 fa                	or     %edi,%edx
+  8027a9:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8027ad:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8027b1:	39 f0                	cmp    %esi,%eax
+  8027b3:	89 d5                	mov    %edx,%ebp
+  8027b5:	19 fd                	sbb    %edi,%ebp
+  8027b7:	72 af                	jb     802768 <dm+0x46>
+  8027b9:	29 f0                	sub    %esi,%eax
+  8027bb:	19 fa                	sbb    %edi,%edx
+  8027bd:	89 cf                	mov    %ecx,%edi
+  8027bf:	c1 ef 05             	shr    $0x5,%edi
+  8027c2:	83 e7 01             	and    $0x1,%edi
+  8027c5:	89 fe                	mov    %edi,%esi
+  8027c7:	83 f6 01             	xor    $0x1,%esi
+  8027ca:	d3 e6                	shl    %cl,%esi
+  8027cc:	d3 e7                	shl    %cl,%edi
+  8027ce:	09 74 24 18          	or     %esi,0x18(%esp)
+  8027d2:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8027d6:	eb 90                	jmp    802768 <dm+0x46>
+  8027d8:	85 db                	test   %ebx,%ebx
+  8027da:	74 05                	je     8027e1 <dm+0xbf>
+  8027dc:	89 03                	mov    %eax,(%ebx)
+  8027de:	89 53 04             	mov    %edx,0x4(%ebx)
+  8027e1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8027e5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8027e9:	83 c4 24             	add    $0x24,%esp
+  8027ec:	5b                   	pop    %ebx
+  8027ed:	5e                   	pop    %esi
+  8027ee:	5f                   	pop    %edi
+  8027ef:	5d                   	pop    %ebp
+  8027f0:	c3                   	ret
+
+008027f1 <__udivdi3>:
+  8027f1:	83 ec 08             	sub    $0x8,%esp
+  8027f4:	6a 00                	push   $0x0
+  8027f6:	ff 74 24 1c          	push   0x1c(%esp)
+  8027fa:	ff 74 24 1c          	push   0x1c(%esp)
+  8027fe:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802802:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802806:	e8 17 ff ff ff       	call   802722 <dm>
+  80280b:	83 c4 14             	add    $0x14,%esp
+  80280e:	c3                   	ret
+
+0080280f <__umoddi3>:
+  80280f:	83 ec 18             	sub    $0x18,%esp
+  802812:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802816:	50                   	push   %eax
+  802817:	ff 74 24 2c          	push   0x2c(%esp)
+  80281b:	ff 74 24 2c          	push   0x2c(%esp)
+  80281f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802823:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802827:	e8 f6 fe ff ff       	call   802722 <dm>
+  80282c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802830:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802834:	83 c4 24             	add    $0x24,%esp
+  802837:	c3                   	ret
+
+00802838 <__divdi3>:
+  802838:	53                   	push   %ebx
+  802839:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80283d:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802841:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  802845:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  802849:	85 d2                	test   %edx,%edx
+  80284b:	78 15                	js     802862 <__divdi3+0x2a>
+  80284d:	85 db                	test   %ebx,%ebx
+  80284f:	78 34                	js     802885 <__divdi3+0x4d>
+  802851:	83 ec 04             	sub    $0x4,%esp
+  802854:	6a 00                	push   $0x0
+  802856:	53                   	push   %ebx
+  802857:	51                   	push   %ecx
+  802858:	e8 c5 fe ff ff       	call   802722 <dm>
+  80285d:	83 c4 10             	add    $0x10,%esp
+  802860:	eb 21                	jmp    802883 <__divdi3+0x4b>
+  802862:	f7 d8                	neg    %eax
+  802864:	83 d2 00             	adc    $0x0,%edx
+  802867:	f7 da                	neg    %edx
+  802869:	85 db                	test   %ebx,%ebx
+  80286b:	78 30                	js     80289d <__divdi3+0x65>
+  80286d:	83 ec 04             	sub    $0x4,%esp
+  802870:	6a 00                	push   $0x0
+  802872:	53                   	push   %ebx
+  802873:	51                   	push   %ecx
+  802874:	e8 a9 fe ff ff       	call   802722 <dm>
+  802879:	83 c4 10             	add    $0x10,%esp
+  80287c:	f7 d8                	neg    %eax
+  80287e:	83 d2 00             	adc    $0x0,%edx
+  802881:	f7 da                	neg    %edx
+  802883:	5b                   	pop    %ebx
+  802884:	c3                   	ret
+  802885:	83 ec 04             	sub    $0x4,%esp
+  802888:	6a 00                	push   $0x0
+  80288a:	f7 d9                	neg    %ecx
+  80288c:	83 d3 00             	adc    $0x0,%ebx
+  80288f:	f7 db                	neg    %ebx
+  802891:	53                   	push   %ebx
+  802892:	51                   	push   %ecx
+  802893:	e8 8a fe ff ff       	call   802722 <dm>
+  802898:	83 c4 10             	add    $0x10,%esp
+  80289b:	eb df                	jmp    80287c <__divdi3+0x44>
+  80289d:	83 ec 04             	sub    $0x4,%esp
+  8028a0:	6a 00                	push   $0x0
+  8028a2:	f7 d9                	neg    %ecx
+  8028a4:	83 d3 00             	adc    $0x0,%ebx
+  8028a7:	f7 db                	neg    %ebx
+  8028a9:	53                   	push   %ebx
+  8028aa:	51                   	push   %ecx
+  8028ab:	e8 72 fe ff ff       	call   802722 <dm>
+  8028b0:	83 c4 10             	add    $0x10,%esp
+  8028b3:	eb ce                	jmp    802883 <__divdi3+0x4b>
+
+008028b5 <__moddi3>:
+  8028b5:	55                   	push   %ebp
+  8028b6:	57                   	push   %edi
+  8028b7:	56                   	push   %esi
+  8028b8:	53                   	push   %ebx
+  8028b9:	83 ec 18             	sub    $0x18,%esp
+  8028bc:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  8028c0:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8028c4:	89 f1                	mov    %esi,%ecx
+  8028c6:	f7 d9                	neg    %ecx
+  8028c8:	89 da                	mov    %ebx,%edx
+  8028ca:	83 d2 00             	adc    $0x0,%edx
+  8028cd:	f7 da                	neg    %edx
+  8028cf:	0f 48 ce             	cmovs  %esi,%ecx
+  8028d2:	0f 48 d3             	cmovs  %ebx,%edx
+  8028d5:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8028d9:	50                   	push   %eax
+  8028da:	8b 74 24 38          	mov    0x38(%esp),%esi
+  8028de:	f7 de                	neg    %esi
+  8028e0:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  8028e4:	83 d0 00             	adc    $0x0,%eax
+  8028e7:	f7 d8                	neg    %eax
+  8028e9:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  8028ee:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  8028f3:	50                   	push   %eax
+  8028f4:	56                   	push   %esi
+  8028f5:	89 c8                	mov    %ecx,%eax
+  8028f7:	e8 26 fe ff ff       	call   802722 <dm>
+  8028fc:	83 c4 10             	add    $0x10,%esp
+  8028ff:	85 db                	test   %ebx,%ebx
+  802901:	78 10                	js     802913 <__moddi3+0x5e>
+  802903:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802907:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80290b:	83 c4 14             	add    $0x14,%esp
+  80290e:	5b                   	pop    %ebx
+  80290f:	5e                   	pop    %esi
+  802910:	5f                   	pop    %edi
+  802911:	5d                   	pop    %ebp
+  802912:	c3                   	ret
+  802913:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802917:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80291b:	f7 d8                	neg    %eax
+  80291d:	83 d2 00             	adc    $0x0,%edx
+  802920:	f7 da                	neg    %edx
+  802922:	eb e7                	jmp    80290b <__moddi3+0x56>
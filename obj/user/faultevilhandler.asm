@@ -0,0 +1,5048 @@
+
+obj/user/faultevilhandler:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 34 00 00 00       	call   800065 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 0c             	sub    $0xc,%esp
+	sys_page_alloc(0, (void*) (UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W);
+  800039:	6a 07                	push   $0x7
+  80003b:	68 00 f0 bf ee       	push   $0xeebff000
+  800040:	6a 00                	push   $0x0
+  800042:	e8 6a 05 00 00       	call   8005b1 <sys_page_alloc>
+	sys_env_set_pgfault_upcall(0, (void*) 0xF0100020);
+  800047:	83 c4 08             	add    $0x8,%esp
+  80004a:	68 20 00 10 f0       	push   $0xf0100020
+  80004f:	6a 00                	push   $0x0
+  800051:	e8 1a 0c 00 00       	call   800c70 <sys_env_set_pgfault_upcall>
+	*(int*)0 = 0;
+  800056:	c7 05 00 00 00 00 00 	movl   $0x0,0x0
+  80005d:	00 00 00 
+}
+  800060:	83 c4 10             	add    $0x10,%esp
+  800063:	c9                   	leave
+  800064:	c3                   	ret
+
+00800065 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800065:	55                   	push   %ebp
+  800066:	89 e5                	mov    %esp,%ebp
+  800068:	56                   	push   %esi
+  800069:	53                   	push   %ebx
+  80006a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80006d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  800070:	e8 9d 04 00 00       	call   800512 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  800075:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80007a:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  800080:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800085:	a3 08 30 80 00       	mov    %eax,0x803008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80008a:	85 db                	test   %ebx,%ebx
+  80008c:	7e 07                	jle    800095 <libmain+0x30>
+		binaryname = argv[0];
+  80008e:	8b 06                	mov    (%esi),%eax
+  800090:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  800095:	83 ec 08             	sub    $0x8,%esp
+  800098:	56                   	push   %esi
+  800099:	53                   	push   %ebx
+  80009a:	e8 94 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80009f:	e8 0a 00 00 00       	call   8000ae <exit>
+}
+  8000a4:	83 c4 10             	add    $0x10,%esp
+  8000a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000aa:	5b                   	pop    %ebx
+  8000ab:	5e                   	pop    %esi
+  8000ac:	5d                   	pop    %ebp
+  8000ad:	c3                   	ret
+
+008000ae <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000ae:	55                   	push   %ebp
+  8000af:	89 e5                	mov    %esp,%ebp
+  8000b1:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  8000b4:	6a 00                	push   $0x0
+  8000b6:	e8 95 03 00 00       	call   800450 <sys_env_destroy>
+}
+  8000bb:	83 c4 10             	add    $0x10,%esp
+  8000be:	c9                   	leave
+  8000bf:	c3                   	ret
+
+008000c0 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  8000c0:	55                   	push   %ebp
+  8000c1:	89 e5                	mov    %esp,%ebp
+  8000c3:	57                   	push   %edi
+  8000c4:	56                   	push   %esi
+  8000c5:	53                   	push   %ebx
+  8000c6:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  8000cc:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  8000d2:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  8000d8:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  8000de:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  8000e5:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  8000e8:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  8000ef:	00 00 00 
+		if (num == SYS_page_map_vec)
+  8000f2:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  8000f9:	74 76                	je     800171 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  8000fb:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800101:	8b 45 08             	mov    0x8(%ebp),%eax
+  800104:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  80010a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800111:	0f 88 06 01 00 00    	js     80021d <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800117:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80011e:	0f 84 48 01 00 00    	je     80026c <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800124:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  80012a:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800130:	be 00 00 00 00       	mov    $0x0,%esi
+  800135:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  80013b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80013e:	55                   	push   %ebp
+  80013f:	68 48 01 80 00       	push   $0x800148
+  800144:	89 e5                	mov    %esp,%ebp
+  800146:	0f 34                	sysenter
+  800148:	83 c4 04             	add    $0x4,%esp
+  80014b:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  80014c:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800152:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800158:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  80015b:	0f 85 9a 01 00 00    	jne    8002fb <page_vec_call+0x23b>
+  800161:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800166:	8b 75 08             	mov    0x8(%ebp),%esi
+  800169:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80016c:	e9 29 01 00 00       	jmp    80029a <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800171:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800177:	8b 45 08             	mov    0x8(%ebp),%eax
+  80017a:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  80017c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800183:	78 2f                	js     8001b4 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800185:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80018c:	74 72                	je     800200 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  80018e:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800194:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  80019a:	b8 10 00 00 00       	mov    $0x10,%eax
+  80019f:	89 fb                	mov    %edi,%ebx
+  8001a1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8001a4:	55                   	push   %ebp
+  8001a5:	68 ae 01 80 00       	push   $0x8001ae
+  8001aa:	89 e5                	mov    %esp,%ebp
+  8001ac:	0f 34                	sysenter
+  8001ae:	83 c4 04             	add    $0x4,%esp
+  8001b1:	5d                   	pop    %ebp
+	return ret;
+  8001b2:	eb 98                	jmp    80014c <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  8001b4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8001b9:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  8001bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8001c0:	f6 c6 08             	test   $0x8,%dh
+  8001c3:	74 15                	je     8001da <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8001c5:	89 c2                	mov    %eax,%edx
+  8001c7:	c1 ea 08             	shr    $0x8,%edx
+  8001ca:	83 e2 0f             	and    $0xf,%edx
+  8001cd:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8001d2:	83 fa 06             	cmp    $0x6,%edx
+  8001d5:	74 0e                	je     8001e5 <page_vec_call+0x125>
+  8001d7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8001da:	0f b6 c9             	movzbl %cl,%ecx
+  8001dd:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8001e3:	eb a0                	jmp    800185 <page_vec_call+0xc5>
+  8001e5:	89 c2                	mov    %eax,%edx
+  8001e7:	c1 ea 04             	shr    $0x4,%edx
+  8001ea:	83 e2 0f             	and    $0xf,%edx
+  8001ed:	83 fa 02             	cmp    $0x2,%edx
+  8001f0:	77 e5                	ja     8001d7 <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  8001f2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8001f5:	83 f8 02             	cmp    $0x2,%eax
+  8001f8:	0f 97 c1             	seta   %cl
+  8001fb:	0f b6 c9             	movzbl %cl,%ecx
+  8001fe:	eb d7                	jmp    8001d7 <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800200:	b8 10 00 00 00       	mov    $0x10,%eax
+  800205:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  80020b:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800211:	89 fb                	mov    %edi,%ebx
+  800213:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800216:	cd 30                	int    $0x30
+  800218:	e9 2f ff ff ff       	jmp    80014c <page_vec_call+0x8c>
+  80021d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800222:	0f a2                	cpuid
+		return 0;
+  800224:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800229:	f6 c6 08             	test   $0x8,%dh
+  80022c:	74 15                	je     800243 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80022e:	89 c2                	mov    %eax,%edx
+  800230:	c1 ea 08             	shr    $0x8,%edx
+  800233:	83 e2 0f             	and    $0xf,%edx
+  800236:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80023b:	83 fa 06             	cmp    $0x6,%edx
+  80023e:	74 11                	je     800251 <page_vec_call+0x191>
+  800240:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800243:	0f b6 c9             	movzbl %cl,%ecx
+  800246:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80024c:	e9 c6 fe ff ff       	jmp    800117 <page_vec_call+0x57>
+  800251:	89 c2                	mov    %eax,%edx
+  800253:	c1 ea 04             	shr    $0x4,%edx
+  800256:	83 e2 0f             	and    $0xf,%edx
+  800259:	83 fa 02             	cmp    $0x2,%edx
+  80025c:	77 e2                	ja     800240 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  80025e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800261:	83 f8 02             	cmp    $0x2,%eax
+  800264:	0f 97 c1             	seta   %cl
+  800267:	0f b6 c9             	movzbl %cl,%ecx
+  80026a:	eb d4                	jmp    800240 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  80026c:	be 00 00 00 00       	mov    $0x0,%esi
+  800271:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800277:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  80027d:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800283:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800286:	cd 30                	int    $0x30
+  800288:	e9 bf fe ff ff       	jmp    80014c <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  80028d:	29 da                	sub    %ebx,%edx
+			vec++;
+  80028f:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800292:	83 e8 01             	sub    $0x1,%eax
+  800295:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  80029a:	85 c0                	test   %eax,%eax
+  80029c:	74 58                	je     8002f6 <page_vec_call+0x236>
+  80029e:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8002a1:	39 da                	cmp    %ebx,%edx
+  8002a3:	73 e8                	jae    80028d <page_vec_call+0x1cd>
+  8002a5:	89 75 08             	mov    %esi,0x8(%ebp)
+  8002a8:	89 45 0c             	mov    %eax,0xc(%ebp)
+  8002ab:	84 c9                	test   %cl,%cl
+  8002ad:	74 06                	je     8002b5 <page_vec_call+0x1f5>
+  8002af:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  8002b5:	83 ec 04             	sub    $0x4,%esp
+  8002b8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8002bb:	c1 e0 04             	shl    $0x4,%eax
+  8002be:	50                   	push   %eax
+  8002bf:	ff 75 08             	push   0x8(%ebp)
+  8002c2:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  8002c8:	53                   	push   %ebx
+  8002c9:	e8 41 21 00 00       	call   80240f <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  8002ce:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  8002d4:	89 c2                	mov    %eax,%edx
+  8002d6:	c1 e2 0c             	shl    $0xc,%edx
+  8002d9:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  8002df:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  8002e5:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  8002eb:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  8002ee:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  8002f1:	e9 f2 fd ff ff       	jmp    8000e8 <page_vec_call+0x28>
+			r = 0;
+  8002f6:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  8002fb:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8002ff:	74 0b                	je     80030c <page_vec_call+0x24c>
+		*done = total;
+  800301:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800304:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  80030a:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  80030c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80030f:	5b                   	pop    %ebx
+  800310:	5e                   	pop    %esi
+  800311:	5f                   	pop    %edi
+  800312:	5d                   	pop    %ebp
+  800313:	c3                   	ret
+
+00800314 <sys_cputs>:
+{
+  800314:	55                   	push   %ebp
+  800315:	89 e5                	mov    %esp,%ebp
+  800317:	57                   	push   %edi
+  800318:	56                   	push   %esi
+  800319:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80031a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800321:	78 2d                	js     800350 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800323:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80032a:	74 70                	je     80039c <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  80032c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800331:	8b 55 08             	mov    0x8(%ebp),%edx
+  800334:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800337:	89 c3                	mov    %eax,%ebx
+  800339:	89 c7                	mov    %eax,%edi
+  80033b:	89 c6                	mov    %eax,%esi
+  80033d:	55                   	push   %ebp
+  80033e:	68 47 03 80 00       	push   $0x800347
+  800343:	89 e5                	mov    %esp,%ebp
+  800345:	0f 34                	sysenter
+  800347:	83 c4 04             	add    $0x4,%esp
+  80034a:	5d                   	pop    %ebp
+}
+  80034b:	5b                   	pop    %ebx
+  80034c:	5e                   	pop    %esi
+  80034d:	5f                   	pop    %edi
+  80034e:	5d                   	pop    %ebp
+  80034f:	c3                   	ret
+  800350:	b8 01 00 00 00       	mov    $0x1,%eax
+  800355:	0f a2                	cpuid
+		return 0;
+  800357:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80035c:	f6 c6 08             	test   $0x8,%dh
+  80035f:	74 15                	je     800376 <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800361:	89 c2                	mov    %eax,%edx
+  800363:	c1 ea 08             	shr    $0x8,%edx
+  800366:	83 e2 0f             	and    $0xf,%edx
+  800369:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80036e:	83 fa 06             	cmp    $0x6,%edx
+  800371:	74 0e                	je     800381 <sys_cputs+0x6d>
+  800373:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800376:	0f b6 c9             	movzbl %cl,%ecx
+  800379:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80037f:	eb a2                	jmp    800323 <sys_cputs+0xf>
+  800381:	89 c2                	mov    %eax,%edx
+  800383:	c1 ea 04             	shr    $0x4,%edx
+  800386:	83 e2 0f             	and    $0xf,%edx
+  800389:	83 fa 02             	cmp    $0x2,%edx
+  80038c:	77 e5                	ja     800373 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  80038e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800391:	83 f8 02             	cmp    $0x2,%eax
+  800394:	0f 97 c1             	seta   %cl
+  800397:	0f b6 c9             	movzbl %cl,%ecx
+  80039a:	eb d7                	jmp    800373 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  80039c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003a7:	89 c3                	mov    %eax,%ebx
+  8003a9:	89 c7                	mov    %eax,%edi
+  8003ab:	89 c6                	mov    %eax,%esi
+  8003ad:	cd 30                	int    $0x30
+}
+  8003af:	eb 9a                	jmp    80034b <sys_cputs+0x37>
+
+008003b1 <sys_cgetc>:
+{
+  8003b1:	55                   	push   %ebp
+  8003b2:	89 e5                	mov    %esp,%ebp
+  8003b4:	57                   	push   %edi
+  8003b5:	56                   	push   %esi
+  8003b6:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8003b7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8003be:	78 2e                	js     8003ee <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  8003c0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8003c7:	74 71                	je     80043a <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  8003c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003ce:	b8 01 00 00 00       	mov    $0x1,%eax
+  8003d3:	89 d1                	mov    %edx,%ecx
+  8003d5:	89 d3                	mov    %edx,%ebx
+  8003d7:	89 d7                	mov    %edx,%edi
+  8003d9:	89 d6                	mov    %edx,%esi
+  8003db:	55                   	push   %ebp
+  8003dc:	68 e5 03 80 00       	push   $0x8003e5
+  8003e1:	89 e5                	mov    %esp,%ebp
+  8003e3:	0f 34                	sysenter
+  8003e5:	83 c4 04             	add    $0x4,%esp
+  8003e8:	5d                   	pop    %ebp
+}
+  8003e9:	5b                   	pop    %ebx
+  8003ea:	5e                   	pop    %esi
+  8003eb:	5f                   	pop    %edi
+  8003ec:	5d                   	pop    %ebp
+  8003ed:	c3                   	ret
+  8003ee:	b8 01 00 00 00       	mov    $0x1,%eax
+  8003f3:	0f a2                	cpuid
+		return 0;
+  8003f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8003fa:	f6 c6 08             	test   $0x8,%dh
+  8003fd:	74 15                	je     800414 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8003ff:	89 c2                	mov    %eax,%edx
+  800401:	c1 ea 08             	shr    $0x8,%edx
+  800404:	83 e2 0f             	and    $0xf,%edx
+  800407:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80040c:	83 fa 06             	cmp    $0x6,%edx
+  80040f:	74 0e                	je     80041f <sys_cgetc+0x6e>
+  800411:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800414:	0f b6 c9             	movzbl %cl,%ecx
+  800417:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80041d:	eb a1                	jmp    8003c0 <sys_cgetc+0xf>
+  80041f:	89 c2                	mov    %eax,%edx
+  800421:	c1 ea 04             	shr    $0x4,%edx
+  800424:	83 e2 0f             	and    $0xf,%edx
+  800427:	83 fa 02             	cmp    $0x2,%edx
+  80042a:	77 e5                	ja     800411 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  80042c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80042f:	83 f8 02             	cmp    $0x2,%eax
+  800432:	0f 97 c1             	seta   %cl
+  800435:	0f b6 c9             	movzbl %cl,%ecx
+  800438:	eb d7                	jmp    800411 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  80043a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80043f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800444:	89 d1                	mov    %edx,%ecx
+  800446:	89 d3                	mov    %edx,%ebx
+  800448:	89 d7                	mov    %edx,%edi
+  80044a:	89 d6                	mov    %edx,%esi
+  80044c:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  80044e:	eb 99                	jmp    8003e9 <sys_cgetc+0x38>
+
+00800450 <sys_env_destroy>:
+{
+  800450:	55                   	push   %ebp
+  800451:	89 e5                	mov    %esp,%ebp
+  800453:	57                   	push   %edi
+  800454:	56                   	push   %esi
+  800455:	53                   	push   %ebx
+  800456:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800459:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800460:	78 36                	js     800498 <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  800462:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800469:	74 79                	je     8004e4 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  80046b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80046e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800473:	b8 03 00 00 00       	mov    $0x3,%eax
+  800478:	89 cb                	mov    %ecx,%ebx
+  80047a:	89 cf                	mov    %ecx,%edi
+  80047c:	89 ce                	mov    %ecx,%esi
+  80047e:	55                   	push   %ebp
+  80047f:	68 88 04 80 00       	push   $0x800488
+  800484:	89 e5                	mov    %esp,%ebp
+  800486:	0f 34                	sysenter
+  800488:	83 c4 04             	add    $0x4,%esp
+  80048b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80048c:	85 c0                	test   %eax,%eax
+  80048e:	7f 6b                	jg     8004fb <sys_env_destroy+0xab>
+}
+  800490:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800493:	5b                   	pop    %ebx
+  800494:	5e                   	pop    %esi
+  800495:	5f                   	pop    %edi
+  800496:	5d                   	pop    %ebp
+  800497:	c3                   	ret
+  800498:	b8 01 00 00 00       	mov    $0x1,%eax
+  80049d:	0f a2                	cpuid
+		return 0;
+  80049f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8004a4:	f6 c6 08             	test   $0x8,%dh
+  8004a7:	74 15                	je     8004be <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8004a9:	89 c2                	mov    %eax,%edx
+  8004ab:	c1 ea 08             	shr    $0x8,%edx
+  8004ae:	83 e2 0f             	and    $0xf,%edx
+  8004b1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8004b6:	83 fa 06             	cmp    $0x6,%edx
+  8004b9:	74 0e                	je     8004c9 <sys_env_destroy+0x79>
+  8004bb:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8004be:	0f b6 c9             	movzbl %cl,%ecx
+  8004c1:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8004c7:	eb 99                	jmp    800462 <sys_env_destroy+0x12>
+  8004c9:	89 c2                	mov    %eax,%edx
+  8004cb:	c1 ea 04             	shr    $0x4,%edx
+  8004ce:	83 e2 0f             	and    $0xf,%edx
+  8004d1:	83 fa 02             	cmp    $0x2,%edx
+  8004d4:	77 e5                	ja     8004bb <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  8004d6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8004d9:	83 f8 02             	cmp    $0x2,%eax
+  8004dc:	0f 97 c1             	seta   %cl
+  8004df:	0f b6 c9             	movzbl %cl,%ecx
+  8004e2:	eb d7                	jmp    8004bb <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  8004e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004e9:	b8 03 00 00 00       	mov    $0x3,%eax
+  8004ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004f1:	89 cb                	mov    %ecx,%ebx
+  8004f3:	89 cf                	mov    %ecx,%edi
+  8004f5:	89 ce                	mov    %ecx,%esi
+  8004f7:	cd 30                	int    $0x30
+  8004f9:	eb 91                	jmp    80048c <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004fb:	83 ec 0c             	sub    $0xc,%esp
+  8004fe:	50                   	push   %eax
+  8004ff:	6a 03                	push   $0x3
+  800501:	68 ea 27 80 00       	push   $0x8027ea
+  800506:	6a 4a                	push   $0x4a
+  800508:	68 07 28 80 00       	push   $0x802807
+  80050d:	e8 1e 17 00 00       	call   801c30 <_panic>
+
+00800512 <sys_getenvid>:
+{
+  800512:	55                   	push   %ebp
+  800513:	89 e5                	mov    %esp,%ebp
+  800515:	57                   	push   %edi
+  800516:	56                   	push   %esi
+  800517:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800518:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80051f:	78 2e                	js     80054f <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  800521:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800528:	74 71                	je     80059b <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  80052a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80052f:	b8 02 00 00 00       	mov    $0x2,%eax
+  800534:	89 d1                	mov    %edx,%ecx
+  800536:	89 d3                	mov    %edx,%ebx
+  800538:	89 d7                	mov    %edx,%edi
+  80053a:	89 d6                	mov    %edx,%esi
+  80053c:	55                   	push   %ebp
+  80053d:	68 46 05 80 00       	push   $0x800546
+  800542:	89 e5                	mov    %esp,%ebp
+  800544:	0f 34                	sysenter
+  800546:	83 c4 04             	add    $0x4,%esp
+  800549:	5d                   	pop    %ebp
+}
+  80054a:	5b                   	pop    %ebx
+  80054b:	5e                   	pop    %esi
+  80054c:	5f                   	pop    %edi
+  80054d:	5d                   	pop    %ebp
+  80054e:	c3                   	ret
+  80054f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800554:	0f a2                	cpuid
+		return 0;
+  800556:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80055b:	f6 c6 08             	test   $0x8,%dh
+  80055e:	74 15                	je     800575 <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800560:	89 c2                	mov    %eax,%edx
+  800562:	c1 ea 08             	shr    $0x8,%edx
+  800565:	83 e2 0f             	and    $0xf,%edx
+  800568:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80056d:	83 fa 06             	cmp    $0x6,%edx
+  800570:	74 0e                	je     800580 <sys_getenvid+0x6e>
+  800572:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800575:	0f b6 c9             	movzbl %cl,%ecx
+  800578:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80057e:	eb a1                	jmp    800521 <sys_getenvid+0xf>
+  800580:	89 c2                	mov    %eax,%edx
+  800582:	c1 ea 04             	shr    $0x4,%edx
+  800585:	83 e2 0f             	and    $0xf,%edx
+  800588:	83 fa 02             	cmp    $0x2,%edx
+  80058b:	77 e5                	ja     800572 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  80058d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800590:	83 f8 02             	cmp    $0x2,%eax
+  800593:	0f 97 c1             	seta   %cl
+  800596:	0f b6 c9             	movzbl %cl,%ecx
+  800599:	eb d7                	jmp    800572 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  80059b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005a0:	b8 02 00 00 00       	mov    $0x2,%eax
+  8005a5:	89 d1                	mov    %edx,%ecx
+  8005a7:	89 d3                	mov    %edx,%ebx
+  8005a9:	89 d7                	mov    %edx,%edi
+  8005ab:	89 d6                	mov    %edx,%esi
+  8005ad:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  8005af:	eb 99                	jmp    80054a <sys_getenvid+0x38>
+
+008005b1 <sys_page_alloc>:
+{
+  8005b1:	55                   	push   %ebp
+  8005b2:	89 e5                	mov    %esp,%ebp
+  8005b4:	57                   	push   %edi
+  8005b5:	56                   	push   %esi
+  8005b6:	53                   	push   %ebx
+  8005b7:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8005ba:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8005c1:	78 38                	js     8005fb <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  8005c3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8005ca:	74 7b                	je     800647 <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  8005cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8005d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005d7:	b8 04 00 00 00       	mov    $0x4,%eax
+  8005dc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005df:	89 f7                	mov    %esi,%edi
+  8005e1:	55                   	push   %ebp
+  8005e2:	68 eb 05 80 00       	push   $0x8005eb
+  8005e7:	89 e5                	mov    %esp,%ebp
+  8005e9:	0f 34                	sysenter
+  8005eb:	83 c4 04             	add    $0x4,%esp
+  8005ee:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8005ef:	85 c0                	test   %eax,%eax
+  8005f1:	7f 6d                	jg     800660 <sys_page_alloc+0xaf>
+}
+  8005f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005f6:	5b                   	pop    %ebx
+  8005f7:	5e                   	pop    %esi
+  8005f8:	5f                   	pop    %edi
+  8005f9:	5d                   	pop    %ebp
+  8005fa:	c3                   	ret
+  8005fb:	b8 01 00 00 00       	mov    $0x1,%eax
+  800600:	0f a2                	cpuid
+		return 0;
+  800602:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800607:	f6 c6 08             	test   $0x8,%dh
+  80060a:	74 15                	je     800621 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80060c:	89 c2                	mov    %eax,%edx
+  80060e:	c1 ea 08             	shr    $0x8,%edx
+  800611:	83 e2 0f             	and    $0xf,%edx
+  800614:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800619:	83 fa 06             	cmp    $0x6,%edx
+  80061c:	74 0e                	je     80062c <sys_page_alloc+0x7b>
+  80061e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800621:	0f b6 c9             	movzbl %cl,%ecx
+  800624:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80062a:	eb 97                	jmp    8005c3 <sys_page_alloc+0x12>
+  80062c:	89 c2                	mov    %eax,%edx
+  80062e:	c1 ea 04             	shr    $0x4,%edx
+  800631:	83 e2 0f             	and    $0xf,%edx
+  800634:	83 fa 02             	cmp    $0x2,%edx
+  800637:	77 e5                	ja     80061e <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  800639:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80063c:	83 f8 02             	cmp    $0x2,%eax
+  80063f:	0f 97 c1             	seta   %cl
+  800642:	0f b6 c9             	movzbl %cl,%ecx
+  800645:	eb d7                	jmp    80061e <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  800647:	be 00 00 00 00       	mov    $0x0,%esi
+  80064c:	b8 04 00 00 00       	mov    $0x4,%eax
+  800651:	8b 55 08             	mov    0x8(%ebp),%edx
+  800654:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800657:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80065a:	89 f7                	mov    %esi,%edi
+  80065c:	cd 30                	int    $0x30
+  80065e:	eb 8f                	jmp    8005ef <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800660:	83 ec 0c             	sub    $0xc,%esp
+  800663:	50                   	push   %eax
+  800664:	6a 04                	push   $0x4
+  800666:	68 ea 27 80 00       	push   $0x8027ea
+  80066b:	6a 4a                	push   $0x4a
+  80066d:	68 07 28 80 00       	push   $0x802807
+  800672:	e8 b9 15 00 00       	call   801c30 <_panic>
+
+00800677 <sys_page_map>:
+{
+  800677:	55                   	push   %ebp
+  800678:	89 e5                	mov    %esp,%ebp
+  80067a:	57                   	push   %edi
+  80067b:	56                   	push   %esi
+  80067c:	53                   	push   %ebx
+  80067d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800680:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800687:	78 37                	js     8006c0 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  800689:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800690:	74 7a                	je     80070c <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  800692:	8b 55 08             	mov    0x8(%ebp),%edx
+  800695:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800698:	b8 05 00 00 00       	mov    $0x5,%eax
+  80069d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8006a0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8006a3:	8b 75 18             	mov    0x18(%ebp),%esi
+  8006a6:	55                   	push   %ebp
+  8006a7:	68 b0 06 80 00       	push   $0x8006b0
+  8006ac:	89 e5                	mov    %esp,%ebp
+  8006ae:	0f 34                	sysenter
+  8006b0:	83 c4 04             	add    $0x4,%esp
+  8006b3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8006b4:	85 c0                	test   %eax,%eax
+  8006b6:	7f 6c                	jg     800724 <sys_page_map+0xad>
+}
+  8006b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006bb:	5b                   	pop    %ebx
+  8006bc:	5e                   	pop    %esi
+  8006bd:	5f                   	pop    %edi
+  8006be:	5d                   	pop    %ebp
+  8006bf:	c3                   	ret
+  8006c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8006c5:	0f a2                	cpuid
+		return 0;
+  8006c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8006cc:	f6 c6 08             	test   $0x8,%dh
+  8006cf:	74 15                	je     8006e6 <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8006d1:	89 c2                	mov    %eax,%edx
+  8006d3:	c1 ea 08             	shr    $0x8,%edx
+  8006d6:	83 e2 0f             	and    $0xf,%edx
+  8006d9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8006de:	83 fa 06             	cmp    $0x6,%edx
+  8006e1:	74 0e                	je     8006f1 <sys_page_map+0x7a>
+  8006e3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8006e6:	0f b6 c9             	movzbl %cl,%ecx
+  8006e9:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8006ef:	eb 98                	jmp    800689 <sys_page_map+0x12>
+  8006f1:	89 c2                	mov    %eax,%edx
+  8006f3:	c1 ea 04             	shr    $0x4,%edx
+  8006f6:	83 e2 0f             	and    $0xf,%edx
+  8006f9:	83 fa 02             	cmp    $0x2,%edx
+  8006fc:	77 e5                	ja     8006e3 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  8006fe:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800701:	83 f8 02             	cmp    $0x2,%eax
+  800704:	0f 97 c1             	seta   %cl
+  800707:	0f b6 c9             	movzbl %cl,%ecx
+  80070a:	eb d7                	jmp    8006e3 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  80070c:	b8 05 00 00 00       	mov    $0x5,%eax
+  800711:	8b 55 08             	mov    0x8(%ebp),%edx
+  800714:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800717:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80071a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80071d:	8b 75 18             	mov    0x18(%ebp),%esi
+  800720:	cd 30                	int    $0x30
+  800722:	eb 90                	jmp    8006b4 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800724:	83 ec 0c             	sub    $0xc,%esp
+  800727:	50                   	push   %eax
+  800728:	6a 05                	push   $0x5
+  80072a:	68 ea 27 80 00       	push   $0x8027ea
+  80072f:	6a 4a                	push   $0x4a
+  800731:	68 07 28 80 00       	push   $0x802807
+  800736:	e8 f5 14 00 00       	call   801c30 <_panic>
+
+0080073b <sys_page_unmap>:
+{
+  80073b:	55                   	push   %ebp
+  80073c:	89 e5                	mov    %esp,%ebp
+  80073e:	57                   	push   %edi
+  80073f:	56                   	push   %esi
+  800740:	53                   	push   %ebx
+  800741:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800744:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80074b:	78 37                	js     800784 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  80074d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800754:	74 7a                	je     8007d0 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  800756:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80075b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80075e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800761:	b8 06 00 00 00       	mov    $0x6,%eax
+  800766:	89 df                	mov    %ebx,%edi
+  800768:	89 de                	mov    %ebx,%esi
+  80076a:	55                   	push   %ebp
+  80076b:	68 74 07 80 00       	push   $0x800774
+  800770:	89 e5                	mov    %esp,%ebp
+  800772:	0f 34                	sysenter
+  800774:	83 c4 04             	add    $0x4,%esp
+  800777:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800778:	85 c0                	test   %eax,%eax
+  80077a:	7f 6c                	jg     8007e8 <sys_page_unmap+0xad>
+}
+  80077c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80077f:	5b                   	pop    %ebx
+  800780:	5e                   	pop    %esi
+  800781:	5f                   	pop    %edi
+  800782:	5d                   	pop    %ebp
+  800783:	c3                   	ret
+  800784:	b8 01 00 00 00       	mov    $0x1,%eax
+  800789:	0f a2                	cpuid
+		return 0;
+  80078b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800790:	f6 c6 08             	test   $0x8,%dh
+  800793:	74 15                	je     8007aa <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800795:	89 c2                	mov    %eax,%edx
+  800797:	c1 ea 08             	shr    $0x8,%edx
+  80079a:	83 e2 0f             	and    $0xf,%edx
+  80079d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8007a2:	83 fa 06             	cmp    $0x6,%edx
+  8007a5:	74 0e                	je     8007b5 <sys_page_unmap+0x7a>
+  8007a7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8007aa:	0f b6 c9             	movzbl %cl,%ecx
+  8007ad:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8007b3:	eb 98                	jmp    80074d <sys_page_unmap+0x12>
+  8007b5:	89 c2                	mov    %eax,%edx
+  8007b7:	c1 ea 04             	shr    $0x4,%edx
+  8007ba:	83 e2 0f             	and    $0xf,%edx
+  8007bd:	83 fa 02             	cmp    $0x2,%edx
+  8007c0:	77 e5                	ja     8007a7 <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  8007c2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8007c5:	83 f8 02             	cmp    $0x2,%eax
+  8007c8:	0f 97 c1             	seta   %cl
+  8007cb:	0f b6 c9             	movzbl %cl,%ecx
+  8007ce:	eb d7                	jmp    8007a7 <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  8007d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007d5:	b8 06 00 00 00       	mov    $0x6,%eax
+  8007da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007e0:	89 df                	mov    %ebx,%edi
+  8007e2:	89 de                	mov    %ebx,%esi
+  8007e4:	cd 30                	int    $0x30
+  8007e6:	eb 90                	jmp    800778 <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8007e8:	83 ec 0c             	sub    $0xc,%esp
+  8007eb:	50                   	push   %eax
+  8007ec:	6a 06                	push   $0x6
+  8007ee:	68 ea 27 80 00       	push   $0x8027ea
+  8007f3:	6a 4a                	push   $0x4a
+  8007f5:	68 07 28 80 00       	push   $0x802807
+  8007fa:	e8 31 14 00 00       	call   801c30 <_panic>
+
+008007ff <sys_page_copy>:
+{
+  8007ff:	55                   	push   %ebp
+  800800:	89 e5                	mov    %esp,%ebp
+  800802:	57                   	push   %edi
+  800803:	56                   	push   %esi
+  800804:	53                   	push   %ebx
+  800805:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800808:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80080f:	78 37                	js     800848 <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  800811:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800818:	74 7a                	je     800894 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  80081a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80081d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800820:	b8 29 00 00 00       	mov    $0x29,%eax
+  800825:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800828:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80082b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80082e:	55                   	push   %ebp
+  80082f:	68 38 08 80 00       	push   $0x800838
+  800834:	89 e5                	mov    %esp,%ebp
+  800836:	0f 34                	sysenter
+  800838:	83 c4 04             	add    $0x4,%esp
+  80083b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80083c:	85 c0                	test   %eax,%eax
+  80083e:	7f 6c                	jg     8008ac <sys_page_copy+0xad>
+}
+  800840:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800843:	5b                   	pop    %ebx
+  800844:	5e                   	pop    %esi
+  800845:	5f                   	pop    %edi
+  800846:	5d                   	pop    %ebp
+  800847:	c3                   	ret
+  800848:	b8 01 00 00 00       	mov    $0x1,%eax
+  80084d:	0f a2                	cpuid
+		return 0;
+  80084f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800854:	f6 c6 08             	test   $0x8,%dh
+  800857:	74 15                	je     80086e <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800859:	89 c2                	mov    %eax,%edx
+  80085b:	c1 ea 08             	shr    $0x8,%edx
+  80085e:	83 e2 0f             	and    $0xf,%edx
+  800861:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800866:	83 fa 06             	cmp    $0x6,%edx
+  800869:	74 0e                	je     800879 <sys_page_copy+0x7a>
+  80086b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80086e:	0f b6 c9             	movzbl %cl,%ecx
+  800871:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800877:	eb 98                	jmp    800811 <sys_page_copy+0x12>
+  800879:	89 c2                	mov    %eax,%edx
+  80087b:	c1 ea 04             	shr    $0x4,%edx
+  80087e:	83 e2 0f             	and    $0xf,%edx
+  800881:	83 fa 02             	cmp    $0x2,%edx
+  800884:	77 e5                	ja     80086b <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  800886:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800889:	83 f8 02             	cmp    $0x2,%eax
+  80088c:	0f 97 c1             	seta   %cl
+  80088f:	0f b6 c9             	movzbl %cl,%ecx
+  800892:	eb d7                	jmp    80086b <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  800894:	b8 29 00 00 00       	mov    $0x29,%eax
+  800899:	8b 55 08             	mov    0x8(%ebp),%edx
+  80089c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80089f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8008a2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8008a5:	8b 75 18             	mov    0x18(%ebp),%esi
+  8008a8:	cd 30                	int    $0x30
+  8008aa:	eb 90                	jmp    80083c <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8008ac:	83 ec 0c             	sub    $0xc,%esp
+  8008af:	50                   	push   %eax
+  8008b0:	6a 29                	push   $0x29
+  8008b2:	68 ea 27 80 00       	push   $0x8027ea
+  8008b7:	6a 4a                	push   $0x4a
+  8008b9:	68 07 28 80 00       	push   $0x802807
+  8008be:	e8 6d 13 00 00       	call   801c30 <_panic>
+
+008008c3 <sys_yield>:
+{
+  8008c3:	55                   	push   %ebp
+  8008c4:	89 e5                	mov    %esp,%ebp
+  8008c6:	57                   	push   %edi
+  8008c7:	56                   	push   %esi
+  8008c8:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8008c9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8008d0:	78 2e                	js     800900 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  8008d2:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8008d9:	74 71                	je     80094c <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  8008db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008e0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8008e5:	89 d1                	mov    %edx,%ecx
+  8008e7:	89 d3                	mov    %edx,%ebx
+  8008e9:	89 d7                	mov    %edx,%edi
+  8008eb:	89 d6                	mov    %edx,%esi
+  8008ed:	55                   	push   %ebp
+  8008ee:	68 f7 08 80 00       	push   $0x8008f7
+  8008f3:	89 e5                	mov    %esp,%ebp
+  8008f5:	0f 34                	sysenter
+  8008f7:	83 c4 04             	add    $0x4,%esp
+  8008fa:	5d                   	pop    %ebp
+}
+  8008fb:	5b                   	pop    %ebx
+  8008fc:	5e                   	pop    %esi
+  8008fd:	5f                   	pop    %edi
+  8008fe:	5d                   	pop    %ebp
+  8008ff:	c3                   	ret
+  800900:	b8 01 00 00 00       	mov    $0x1,%eax
+  800905:	0f a2                	cpuid
+		return 0;
+  800907:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80090c:	f6 c6 08             	test   $0x8,%dh
+  80090f:	74 15                	je     800926 <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800911:	89 c2                	mov    %eax,%edx
+  800913:	c1 ea 08             	shr    $0x8,%edx
+  800916:	83 e2 0f             	and    $0xf,%edx
+  800919:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80091e:	83 fa 06             	cmp    $0x6,%edx
+  800921:	74 0e                	je     800931 <sys_yield+0x6e>
+  800923:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800926:	0f b6 c9             	movzbl %cl,%ecx
+  800929:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80092f:	eb a1                	jmp    8008d2 <sys_yield+0xf>
+  800931:	89 c2                	mov    %eax,%edx
+  800933:	c1 ea 04             	shr    $0x4,%edx
+  800936:	83 e2 0f             	and    $0xf,%edx
+  800939:	83 fa 02             	cmp    $0x2,%edx
+  80093c:	77 e5                	ja     800923 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  80093e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800941:	83 f8 02             	cmp    $0x2,%eax
+  800944:	0f 97 c1             	seta   %cl
+  800947:	0f b6 c9             	movzbl %cl,%ecx
+  80094a:	eb d7                	jmp    800923 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  80094c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800951:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800956:	89 d1                	mov    %edx,%ecx
+  800958:	89 d3                	mov    %edx,%ebx
+  80095a:	89 d7                	mov    %edx,%edi
+  80095c:	89 d6                	mov    %edx,%esi
+  80095e:	cd 30                	int    $0x30
+}
+  800960:	eb 99                	jmp    8008fb <sys_yield+0x38>
+
+00800962 <sys_env_set_status>:
+{
+  800962:	55                   	push   %ebp
+  800963:	89 e5                	mov    %esp,%ebp
+  800965:	57                   	push   %edi
+  800966:	56                   	push   %esi
+  800967:	53                   	push   %ebx
+  800968:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80096b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800972:	78 37                	js     8009ab <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  800974:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80097b:	74 7a                	je     8009f7 <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  80097d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800982:	8b 55 08             	mov    0x8(%ebp),%edx
+  800985:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800988:	b8 08 00 00 00       	mov    $0x8,%eax
+  80098d:	89 df                	mov    %ebx,%edi
+  80098f:	89 de                	mov    %ebx,%esi
+  800991:	55                   	push   %ebp
+  800992:	68 9b 09 80 00       	push   $0x80099b
+  800997:	89 e5                	mov    %esp,%ebp
+  800999:	0f 34                	sysenter
+  80099b:	83 c4 04             	add    $0x4,%esp
+  80099e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80099f:	85 c0                	test   %eax,%eax
+  8009a1:	7f 6c                	jg     800a0f <sys_env_set_status+0xad>
+}
+  8009a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009a6:	5b                   	pop    %ebx
+  8009a7:	5e                   	pop    %esi
+  8009a8:	5f                   	pop    %edi
+  8009a9:	5d                   	pop    %ebp
+  8009aa:	c3                   	ret
+  8009ab:	b8 01 00 00 00       	mov    $0x1,%eax
+  8009b0:	0f a2                	cpuid
+		return 0;
+  8009b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8009b7:	f6 c6 08             	test   $0x8,%dh
+  8009ba:	74 15                	je     8009d1 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8009bc:	89 c2                	mov    %eax,%edx
+  8009be:	c1 ea 08             	shr    $0x8,%edx
+  8009c1:	83 e2 0f             	and    $0xf,%edx
+  8009c4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8009c9:	83 fa 06             	cmp    $0x6,%edx
+  8009cc:	74 0e                	je     8009dc <sys_env_set_status+0x7a>
+  8009ce:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8009d1:	0f b6 c9             	movzbl %cl,%ecx
+  8009d4:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8009da:	eb 98                	jmp    800974 <sys_env_set_status+0x12>
+  8009dc:	89 c2                	mov    %eax,%edx
+  8009de:	c1 ea 04             	shr    $0x4,%edx
+  8009e1:	83 e2 0f             	and    $0xf,%edx
+  8009e4:	83 fa 02             	cmp    $0x2,%edx
+  8009e7:	77 e5                	ja     8009ce <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  8009e9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8009ec:	83 f8 02             	cmp    $0x2,%eax
+  8009ef:	0f 97 c1             	seta   %cl
+  8009f2:	0f b6 c9             	movzbl %cl,%ecx
+  8009f5:	eb d7                	jmp    8009ce <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  8009f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009fc:	b8 08 00 00 00       	mov    $0x8,%eax
+  800a01:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a04:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a07:	89 df                	mov    %ebx,%edi
+  800a09:	89 de                	mov    %ebx,%esi
+  800a0b:	cd 30                	int    $0x30
+  800a0d:	eb 90                	jmp    80099f <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800a0f:	83 ec 0c             	sub    $0xc,%esp
+  800a12:	50                   	push   %eax
+  800a13:	6a 08                	push   $0x8
+  800a15:	68 ea 27 80 00       	push   $0x8027ea
+  800a1a:	6a 4a                	push   $0x4a
+  800a1c:	68 07 28 80 00       	push   $0x802807
+  800a21:	e8 0a 12 00 00       	call   801c30 <_panic>
+
+00800a26 <sys_sysinfo>:
+{
+  800a26:	55                   	push   %ebp
+  800a27:	89 e5                	mov    %esp,%ebp
+  800a29:	57                   	push   %edi
+  800a2a:	56                   	push   %esi
+  800a2b:	53                   	push   %ebx
+  800a2c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800a2f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800a36:	78 36                	js     800a6e <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  800a38:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800a3f:	74 79                	je     800aba <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  800a41:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a44:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a49:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800a4e:	89 cb                	mov    %ecx,%ebx
+  800a50:	89 cf                	mov    %ecx,%edi
+  800a52:	89 ce                	mov    %ecx,%esi
+  800a54:	55                   	push   %ebp
+  800a55:	68 5e 0a 80 00       	push   $0x800a5e
+  800a5a:	89 e5                	mov    %esp,%ebp
+  800a5c:	0f 34                	sysenter
+  800a5e:	83 c4 04             	add    $0x4,%esp
+  800a61:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800a62:	85 c0                	test   %eax,%eax
+  800a64:	7f 6b                	jg     800ad1 <sys_sysinfo+0xab>
+}
+  800a66:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a69:	5b                   	pop    %ebx
+  800a6a:	5e                   	pop    %esi
+  800a6b:	5f                   	pop    %edi
+  800a6c:	5d                   	pop    %ebp
+  800a6d:	c3                   	ret
+  800a6e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800a73:	0f a2                	cpuid
+		return 0;
+  800a75:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800a7a:	f6 c6 08             	test   $0x8,%dh
+  800a7d:	74 15                	je     800a94 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800a7f:	89 c2                	mov    %eax,%edx
+  800a81:	c1 ea 08             	shr    $0x8,%edx
+  800a84:	83 e2 0f             	and    $0xf,%edx
+  800a87:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800a8c:	83 fa 06             	cmp    $0x6,%edx
+  800a8f:	74 0e                	je     800a9f <sys_sysinfo+0x79>
+  800a91:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800a94:	0f b6 c9             	movzbl %cl,%ecx
+  800a97:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800a9d:	eb 99                	jmp    800a38 <sys_sysinfo+0x12>
+  800a9f:	89 c2                	mov    %eax,%edx
+  800aa1:	c1 ea 04             	shr    $0x4,%edx
+  800aa4:	83 e2 0f             	and    $0xf,%edx
+  800aa7:	83 fa 02             	cmp    $0x2,%edx
+  800aaa:	77 e5                	ja     800a91 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  800aac:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800aaf:	83 f8 02             	cmp    $0x2,%eax
+  800ab2:	0f 97 c1             	seta   %cl
+  800ab5:	0f b6 c9             	movzbl %cl,%ecx
+  800ab8:	eb d7                	jmp    800a91 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  800aba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800abf:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ac4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ac7:	89 cb                	mov    %ecx,%ebx
+  800ac9:	89 cf                	mov    %ecx,%edi
+  800acb:	89 ce                	mov    %ecx,%esi
+  800acd:	cd 30                	int    $0x30
+  800acf:	eb 91                	jmp    800a62 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ad1:	83 ec 0c             	sub    $0xc,%esp
+  800ad4:	50                   	push   %eax
+  800ad5:	6a 0b                	push   $0xb
+  800ad7:	68 ea 27 80 00       	push   $0x8027ea
+  800adc:	6a 4a                	push   $0x4a
+  800ade:	68 07 28 80 00       	push   $0x802807
+  800ae3:	e8 48 11 00 00       	call   801c30 <_panic>
+
+00800ae8 <sys_env_set_trapframe>:
+{
+  800ae8:	55                   	push   %ebp
+  800ae9:	89 e5                	mov    %esp,%ebp
+  800aeb:	57                   	push   %edi
+  800aec:	56                   	push   %esi
+  800aed:	53                   	push   %ebx
+  800aee:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800af1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800af8:	78 37                	js     800b31 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  800afa:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b01:	74 7a                	je     800b7d <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  800b03:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b08:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b0b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b0e:	b8 13 00 00 00       	mov    $0x13,%eax
+  800b13:	89 df                	mov    %ebx,%edi
+  800b15:	89 de                	mov    %ebx,%esi
+  800b17:	55                   	push   %ebp
+  800b18:	68 21 0b 80 00       	push   $0x800b21
+  800b1d:	89 e5                	mov    %esp,%ebp
+  800b1f:	0f 34                	sysenter
+  800b21:	83 c4 04             	add    $0x4,%esp
+  800b24:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800b25:	85 c0                	test   %eax,%eax
+  800b27:	7f 6c                	jg     800b95 <sys_env_set_trapframe+0xad>
+}
+  800b29:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b2c:	5b                   	pop    %ebx
+  800b2d:	5e                   	pop    %esi
+  800b2e:	5f                   	pop    %edi
+  800b2f:	5d                   	pop    %ebp
+  800b30:	c3                   	ret
+  800b31:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b36:	0f a2                	cpuid
+		return 0;
+  800b38:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800b3d:	f6 c6 08             	test   $0x8,%dh
+  800b40:	74 15                	je     800b57 <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800b42:	89 c2                	mov    %eax,%edx
+  800b44:	c1 ea 08             	shr    $0x8,%edx
+  800b47:	83 e2 0f             	and    $0xf,%edx
+  800b4a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800b4f:	83 fa 06             	cmp    $0x6,%edx
+  800b52:	74 0e                	je     800b62 <sys_env_set_trapframe+0x7a>
+  800b54:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800b57:	0f b6 c9             	movzbl %cl,%ecx
+  800b5a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800b60:	eb 98                	jmp    800afa <sys_env_set_trapframe+0x12>
+  800b62:	89 c2                	mov    %eax,%edx
+  800b64:	c1 ea 04             	shr    $0x4,%edx
+  800b67:	83 e2 0f             	and    $0xf,%edx
+  800b6a:	83 fa 02             	cmp    $0x2,%edx
+  800b6d:	77 e5                	ja     800b54 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  800b6f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800b72:	83 f8 02             	cmp    $0x2,%eax
+  800b75:	0f 97 c1             	seta   %cl
+  800b78:	0f b6 c9             	movzbl %cl,%ecx
+  800b7b:	eb d7                	jmp    800b54 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  800b7d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b82:	b8 13 00 00 00       	mov    $0x13,%eax
+  800b87:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b8a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b8d:	89 df                	mov    %ebx,%edi
+  800b8f:	89 de                	mov    %ebx,%esi
+  800b91:	cd 30                	int    $0x30
+  800b93:	eb 90                	jmp    800b25 <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b95:	83 ec 0c             	sub    $0xc,%esp
+  800b98:	50                   	push   %eax
+  800b99:	6a 13                	push   $0x13
+  800b9b:	68 ea 27 80 00       	push   $0x8027ea
+  800ba0:	6a 4a                	push   $0x4a
+  800ba2:	68 07 28 80 00       	push   $0x802807
+  800ba7:	e8 84 10 00 00       	call   801c30 <_panic>
+
+00800bac <sys_env_set_stack_limit>:
+{
+  800bac:	55                   	push   %ebp
+  800bad:	89 e5                	mov    %esp,%ebp
+  800baf:	57                   	push   %edi
+  800bb0:	56                   	push   %esi
+  800bb1:	53                   	push   %ebx
+  800bb2:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800bb5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800bbc:	78 37                	js     800bf5 <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  800bbe:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800bc5:	74 7a                	je     800c41 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  800bc7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bcc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bcf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bd2:	b8 19 00 00 00       	mov    $0x19,%eax
+  800bd7:	89 df                	mov    %ebx,%edi
+  800bd9:	89 de                	mov    %ebx,%esi
+  800bdb:	55                   	push   %ebp
+  800bdc:	68 e5 0b 80 00       	push   $0x800be5
+  800be1:	89 e5                	mov    %esp,%ebp
+  800be3:	0f 34                	sysenter
+  800be5:	83 c4 04             	add    $0x4,%esp
+  800be8:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800be9:	85 c0                	test   %eax,%eax
+  800beb:	7f 6c                	jg     800c59 <sys_env_set_stack_limit+0xad>
+}
+  800bed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bf0:	5b                   	pop    %ebx
+  800bf1:	5e                   	pop    %esi
+  800bf2:	5f                   	pop    %edi
+  800bf3:	5d                   	pop    %ebp
+  800bf4:	c3                   	ret
+  800bf5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bfa:	0f a2                	cpuid
+		return 0;
+  800bfc:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800c01:	f6 c6 08             	test   $0x8,%dh
+  800c04:	74 15                	je     800c1b <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c06:	89 c2                	mov    %eax,%edx
+  800c08:	c1 ea 08             	shr    $0x8,%edx
+  800c0b:	83 e2 0f             	and    $0xf,%edx
+  800c0e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800c13:	83 fa 06             	cmp    $0x6,%edx
+  800c16:	74 0e                	je     800c26 <sys_env_set_stack_limit+0x7a>
+  800c18:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800c1b:	0f b6 c9             	movzbl %cl,%ecx
+  800c1e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800c24:	eb 98                	jmp    800bbe <sys_env_set_stack_limit+0x12>
+  800c26:	89 c2                	mov    %eax,%edx
+  800c28:	c1 ea 04             	shr    $0x4,%edx
+  800c2b:	83 e2 0f             	and    $0xf,%edx
+  800c2e:	83 fa 02             	cmp    $0x2,%edx
+  800c31:	77 e5                	ja     800c18 <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  800c33:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c36:	83 f8 02             	cmp    $0x2,%eax
+  800c39:	0f 97 c1             	seta   %cl
+  800c3c:	0f b6 c9             	movzbl %cl,%ecx
+  800c3f:	eb d7                	jmp    800c18 <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  800c41:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c46:	b8 19 00 00 00       	mov    $0x19,%eax
+  800c4b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c4e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c51:	89 df                	mov    %ebx,%edi
+  800c53:	89 de                	mov    %ebx,%esi
+  800c55:	cd 30                	int    $0x30
+  800c57:	eb 90                	jmp    800be9 <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c59:	83 ec 0c             	sub    $0xc,%esp
+  800c5c:	50                   	push   %eax
+  800c5d:	6a 19                	push   $0x19
+  800c5f:	68 ea 27 80 00       	push   $0x8027ea
+  800c64:	6a 4a                	push   $0x4a
+  800c66:	68 07 28 80 00       	push   $0x802807
+  800c6b:	e8 c0 0f 00 00       	call   801c30 <_panic>
+
+00800c70 <sys_env_set_pgfault_upcall>:
+{
+  800c70:	55                   	push   %ebp
+  800c71:	89 e5                	mov    %esp,%ebp
+  800c73:	57                   	push   %edi
+  800c74:	56                   	push   %esi
+  800c75:	53                   	push   %ebx
+  800c76:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800c79:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800c80:	78 37                	js     800cb9 <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  800c82:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800c89:	74 7a                	je     800d05 <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  800c8b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c90:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c93:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c96:	b8 09 00 00 00       	mov    $0x9,%eax
+  800c9b:	89 df                	mov    %ebx,%edi
+  800c9d:	89 de                	mov    %ebx,%esi
+  800c9f:	55                   	push   %ebp
+  800ca0:	68 a9 0c 80 00       	push   $0x800ca9
+  800ca5:	89 e5                	mov    %esp,%ebp
+  800ca7:	0f 34                	sysenter
+  800ca9:	83 c4 04             	add    $0x4,%esp
+  800cac:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800cad:	85 c0                	test   %eax,%eax
+  800caf:	7f 6c                	jg     800d1d <sys_env_set_pgfault_upcall+0xad>
+}
+  800cb1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cb4:	5b                   	pop    %ebx
+  800cb5:	5e                   	pop    %esi
+  800cb6:	5f                   	pop    %edi
+  800cb7:	5d                   	pop    %ebp
+  800cb8:	c3                   	ret
+  800cb9:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cbe:	0f a2                	cpuid
+		return 0;
+  800cc0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800cc5:	f6 c6 08             	test   $0x8,%dh
+  800cc8:	74 15                	je     800cdf <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800cca:	89 c2                	mov    %eax,%edx
+  800ccc:	c1 ea 08             	shr    $0x8,%edx
+  800ccf:	83 e2 0f             	and    $0xf,%edx
+  800cd2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800cd7:	83 fa 06             	cmp    $0x6,%edx
+  800cda:	74 0e                	je     800cea <sys_env_set_pgfault_upcall+0x7a>
+  800cdc:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800cdf:	0f b6 c9             	movzbl %cl,%ecx
+  800ce2:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800ce8:	eb 98                	jmp    800c82 <sys_env_set_pgfault_upcall+0x12>
+  800cea:	89 c2                	mov    %eax,%edx
+  800cec:	c1 ea 04             	shr    $0x4,%edx
+  800cef:	83 e2 0f             	and    $0xf,%edx
+  800cf2:	83 fa 02             	cmp    $0x2,%edx
+  800cf5:	77 e5                	ja     800cdc <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  800cf7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800cfa:	83 f8 02             	cmp    $0x2,%eax
+  800cfd:	0f 97 c1             	seta   %cl
+  800d00:	0f b6 c9             	movzbl %cl,%ecx
+  800d03:	eb d7                	jmp    800cdc <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  800d05:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d0a:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d0f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d12:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d15:	89 df                	mov    %ebx,%edi
+  800d17:	89 de                	mov    %ebx,%esi
+  800d19:	cd 30                	int    $0x30
+  800d1b:	eb 90                	jmp    800cad <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d1d:	83 ec 0c             	sub    $0xc,%esp
+  800d20:	50                   	push   %eax
+  800d21:	6a 09                	push   $0x9
+  800d23:	68 ea 27 80 00       	push   $0x8027ea
+  800d28:	6a 4a                	push   $0x4a
+  800d2a:	68 07 28 80 00       	push   $0x802807
+  800d2f:	e8 fc 0e 00 00       	call   801c30 <_panic>
+
+00800d34 <sys_ipc_try_send>:
+{
+  800d34:	55                   	push   %ebp
+  800d35:	89 e5                	mov    %esp,%ebp
+  800d37:	57                   	push   %edi
+  800d38:	56                   	push   %esi
+  800d39:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800d3a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d41:	78 32                	js     800d75 <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  800d43:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d4a:	74 75                	je     800dc1 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  800d4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d4f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d52:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d57:	be 00 00 00 00       	mov    $0x0,%esi
+  800d5c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d5f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d62:	55                   	push   %ebp
+  800d63:	68 6c 0d 80 00       	push   $0x800d6c
+  800d68:	89 e5                	mov    %esp,%ebp
+  800d6a:	0f 34                	sysenter
+  800d6c:	83 c4 04             	add    $0x4,%esp
+  800d6f:	5d                   	pop    %ebp
+}
+  800d70:	5b                   	pop    %ebx
+  800d71:	5e                   	pop    %esi
+  800d72:	5f                   	pop    %edi
+  800d73:	5d                   	pop    %ebp
+  800d74:	c3                   	ret
+  800d75:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d7a:	0f a2                	cpuid
+		return 0;
+  800d7c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800d81:	f6 c6 08             	test   $0x8,%dh
+  800d84:	74 15                	je     800d9b <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d86:	89 c2                	mov    %eax,%edx
+  800d88:	c1 ea 08             	shr    $0x8,%edx
+  800d8b:	83 e2 0f             	and    $0xf,%edx
+  800d8e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d93:	83 fa 06             	cmp    $0x6,%edx
+  800d96:	74 0e                	je     800da6 <sys_ipc_try_send+0x72>
+  800d98:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800d9b:	0f b6 c9             	movzbl %cl,%ecx
+  800d9e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800da4:	eb 9d                	jmp    800d43 <sys_ipc_try_send+0xf>
+  800da6:	89 c2                	mov    %eax,%edx
+  800da8:	c1 ea 04             	shr    $0x4,%edx
+  800dab:	83 e2 0f             	and    $0xf,%edx
+  800dae:	83 fa 02             	cmp    $0x2,%edx
+  800db1:	77 e5                	ja     800d98 <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  800db3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800db6:	83 f8 02             	cmp    $0x2,%eax
+  800db9:	0f 97 c1             	seta   %cl
+  800dbc:	0f b6 c9             	movzbl %cl,%ecx
+  800dbf:	eb d7                	jmp    800d98 <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  800dc1:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800dc6:	be 00 00 00 00       	mov    $0x0,%esi
+  800dcb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dd4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dd7:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  800dd9:	eb 95                	jmp    800d70 <sys_ipc_try_send+0x3c>
+
+00800ddb <sys_ipc_send>:
+{
+  800ddb:	55                   	push   %ebp
+  800ddc:	89 e5                	mov    %esp,%ebp
+  800dde:	57                   	push   %edi
+  800ddf:	56                   	push   %esi
+  800de0:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800de1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800de8:	78 32                	js     800e1c <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  800dea:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800df1:	74 75                	je     800e68 <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  800df3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800dfe:	be 00 00 00 00       	mov    $0x0,%esi
+  800e03:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e06:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e09:	55                   	push   %ebp
+  800e0a:	68 13 0e 80 00       	push   $0x800e13
+  800e0f:	89 e5                	mov    %esp,%ebp
+  800e11:	0f 34                	sysenter
+  800e13:	83 c4 04             	add    $0x4,%esp
+  800e16:	5d                   	pop    %ebp
+}
+  800e17:	5b                   	pop    %ebx
+  800e18:	5e                   	pop    %esi
+  800e19:	5f                   	pop    %edi
+  800e1a:	5d                   	pop    %ebp
+  800e1b:	c3                   	ret
+  800e1c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e21:	0f a2                	cpuid
+		return 0;
+  800e23:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800e28:	f6 c6 08             	test   $0x8,%dh
+  800e2b:	74 15                	je     800e42 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e2d:	89 c2                	mov    %eax,%edx
+  800e2f:	c1 ea 08             	shr    $0x8,%edx
+  800e32:	83 e2 0f             	and    $0xf,%edx
+  800e35:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e3a:	83 fa 06             	cmp    $0x6,%edx
+  800e3d:	74 0e                	je     800e4d <sys_ipc_send+0x72>
+  800e3f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e42:	0f b6 c9             	movzbl %cl,%ecx
+  800e45:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800e4b:	eb 9d                	jmp    800dea <sys_ipc_send+0xf>
+  800e4d:	89 c2                	mov    %eax,%edx
+  800e4f:	c1 ea 04             	shr    $0x4,%edx
+  800e52:	83 e2 0f             	and    $0xf,%edx
+  800e55:	83 fa 02             	cmp    $0x2,%edx
+  800e58:	77 e5                	ja     800e3f <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  800e5a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e5d:	83 f8 02             	cmp    $0x2,%eax
+  800e60:	0f 97 c1             	seta   %cl
+  800e63:	0f b6 c9             	movzbl %cl,%ecx
+  800e66:	eb d7                	jmp    800e3f <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  800e68:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800e6d:	be 00 00 00 00       	mov    $0x0,%esi
+  800e72:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e75:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e78:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e7b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e7e:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  800e80:	eb 95                	jmp    800e17 <sys_ipc_send+0x3c>
+
+00800e82 <sys_ipc_recv>:
+{
+  800e82:	55                   	push   %ebp
+  800e83:	89 e5                	mov    %esp,%ebp
+  800e85:	57                   	push   %edi
+  800e86:	56                   	push   %esi
+  800e87:	53                   	push   %ebx
+  800e88:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800e8b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e92:	78 36                	js     800eca <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  800e94:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e9b:	74 79                	je     800f16 <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  800e9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ea5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800eaa:	89 cb                	mov    %ecx,%ebx
+  800eac:	89 cf                	mov    %ecx,%edi
+  800eae:	89 ce                	mov    %ecx,%esi
+  800eb0:	55                   	push   %ebp
+  800eb1:	68 ba 0e 80 00       	push   $0x800eba
+  800eb6:	89 e5                	mov    %esp,%ebp
+  800eb8:	0f 34                	sysenter
+  800eba:	83 c4 04             	add    $0x4,%esp
+  800ebd:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ebe:	85 c0                	test   %eax,%eax
+  800ec0:	7f 6b                	jg     800f2d <sys_ipc_recv+0xab>
+}
+  800ec2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec5:	5b                   	pop    %ebx
+  800ec6:	5e                   	pop    %esi
+  800ec7:	5f                   	pop    %edi
+  800ec8:	5d                   	pop    %ebp
+  800ec9:	c3                   	ret
+  800eca:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ecf:	0f a2                	cpuid
+		return 0;
+  800ed1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800ed6:	f6 c6 08             	test   $0x8,%dh
+  800ed9:	74 15                	je     800ef0 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800edb:	89 c2                	mov    %eax,%edx
+  800edd:	c1 ea 08             	shr    $0x8,%edx
+  800ee0:	83 e2 0f             	and    $0xf,%edx
+  800ee3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ee8:	83 fa 06             	cmp    $0x6,%edx
+  800eeb:	74 0e                	je     800efb <sys_ipc_recv+0x79>
+  800eed:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800ef0:	0f b6 c9             	movzbl %cl,%ecx
+  800ef3:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800ef9:	eb 99                	jmp    800e94 <sys_ipc_recv+0x12>
+  800efb:	89 c2                	mov    %eax,%edx
+  800efd:	c1 ea 04             	shr    $0x4,%edx
+  800f00:	83 e2 0f             	and    $0xf,%edx
+  800f03:	83 fa 02             	cmp    $0x2,%edx
+  800f06:	77 e5                	ja     800eed <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  800f08:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f0b:	83 f8 02             	cmp    $0x2,%eax
+  800f0e:	0f 97 c1             	seta   %cl
+  800f11:	0f b6 c9             	movzbl %cl,%ecx
+  800f14:	eb d7                	jmp    800eed <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  800f16:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f1b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f23:	89 cb                	mov    %ecx,%ebx
+  800f25:	89 cf                	mov    %ecx,%edi
+  800f27:	89 ce                	mov    %ecx,%esi
+  800f29:	cd 30                	int    $0x30
+  800f2b:	eb 91                	jmp    800ebe <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f2d:	83 ec 0c             	sub    $0xc,%esp
+  800f30:	50                   	push   %eax
+  800f31:	6a 0d                	push   $0xd
+  800f33:	68 ea 27 80 00       	push   $0x8027ea
+  800f38:	6a 4a                	push   $0x4a
+  800f3a:	68 07 28 80 00       	push   $0x802807
+  800f3f:	e8 ec 0c 00 00       	call   801c30 <_panic>
+
+00800f44 <sys_ipc_send_range>:
+{
+  800f44:	55                   	push   %ebp
+  800f45:	89 e5                	mov    %esp,%ebp
+  800f47:	57                   	push   %edi
+  800f48:	56                   	push   %esi
+  800f49:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800f4a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f51:	78 30                	js     800f83 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  800f53:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f5a:	74 73                	je     800fcf <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  800f5c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f62:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  800f67:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f6a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f6d:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f70:	55                   	push   %ebp
+  800f71:	68 7a 0f 80 00       	push   $0x800f7a
+  800f76:	89 e5                	mov    %esp,%ebp
+  800f78:	0f 34                	sysenter
+  800f7a:	83 c4 04             	add    $0x4,%esp
+  800f7d:	5d                   	pop    %ebp
+}
+  800f7e:	5b                   	pop    %ebx
+  800f7f:	5e                   	pop    %esi
+  800f80:	5f                   	pop    %edi
+  800f81:	5d                   	pop    %ebp
+  800f82:	c3                   	ret
+  800f83:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f88:	0f a2                	cpuid
+		return 0;
+  800f8a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f8f:	f6 c6 08             	test   $0x8,%dh
+  800f92:	74 15                	je     800fa9 <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f94:	89 c2                	mov    %eax,%edx
+  800f96:	c1 ea 08             	shr    $0x8,%edx
+  800f99:	83 e2 0f             	and    $0xf,%edx
+  800f9c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800fa1:	83 fa 06             	cmp    $0x6,%edx
+  800fa4:	74 0e                	je     800fb4 <sys_ipc_send_range+0x70>
+  800fa6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800fa9:	0f b6 c9             	movzbl %cl,%ecx
+  800fac:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800fb2:	eb 9f                	jmp    800f53 <sys_ipc_send_range+0xf>
+  800fb4:	89 c2                	mov    %eax,%edx
+  800fb6:	c1 ea 04             	shr    $0x4,%edx
+  800fb9:	83 e2 0f             	and    $0xf,%edx
+  800fbc:	83 fa 02             	cmp    $0x2,%edx
+  800fbf:	77 e5                	ja     800fa6 <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  800fc1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800fc4:	83 f8 02             	cmp    $0x2,%eax
+  800fc7:	0f 97 c1             	seta   %cl
+  800fca:	0f b6 c9             	movzbl %cl,%ecx
+  800fcd:	eb d7                	jmp    800fa6 <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  800fcf:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  800fd4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fda:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fdd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fe0:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fe3:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  800fe5:	eb 97                	jmp    800f7e <sys_ipc_send_range+0x3a>
+
+00800fe7 <sys_ipc_recv_range>:
+{
+  800fe7:	55                   	push   %ebp
+  800fe8:	89 e5                	mov    %esp,%ebp
+  800fea:	57                   	push   %edi
+  800feb:	56                   	push   %esi
+  800fec:	53                   	push   %ebx
+  800fed:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800ff0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ff7:	78 37                	js     801030 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  800ff9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801000:	74 7a                	je     80107c <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  801002:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801007:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100d:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801012:	89 df                	mov    %ebx,%edi
+  801014:	89 de                	mov    %ebx,%esi
+  801016:	55                   	push   %ebp
+  801017:	68 20 10 80 00       	push   $0x801020
+  80101c:	89 e5                	mov    %esp,%ebp
+  80101e:	0f 34                	sysenter
+  801020:	83 c4 04             	add    $0x4,%esp
+  801023:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801024:	85 c0                	test   %eax,%eax
+  801026:	7f 6c                	jg     801094 <sys_ipc_recv_range+0xad>
+}
+  801028:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80102b:	5b                   	pop    %ebx
+  80102c:	5e                   	pop    %esi
+  80102d:	5f                   	pop    %edi
+  80102e:	5d                   	pop    %ebp
+  80102f:	c3                   	ret
+  801030:	b8 01 00 00 00       	mov    $0x1,%eax
+  801035:	0f a2                	cpuid
+		return 0;
+  801037:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80103c:	f6 c6 08             	test   $0x8,%dh
+  80103f:	74 15                	je     801056 <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801041:	89 c2                	mov    %eax,%edx
+  801043:	c1 ea 08             	shr    $0x8,%edx
+  801046:	83 e2 0f             	and    $0xf,%edx
+  801049:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80104e:	83 fa 06             	cmp    $0x6,%edx
+  801051:	74 0e                	je     801061 <sys_ipc_recv_range+0x7a>
+  801053:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801056:	0f b6 c9             	movzbl %cl,%ecx
+  801059:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80105f:	eb 98                	jmp    800ff9 <sys_ipc_recv_range+0x12>
+  801061:	89 c2                	mov    %eax,%edx
+  801063:	c1 ea 04             	shr    $0x4,%edx
+  801066:	83 e2 0f             	and    $0xf,%edx
+  801069:	83 fa 02             	cmp    $0x2,%edx
+  80106c:	77 e5                	ja     801053 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  80106e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801071:	83 f8 02             	cmp    $0x2,%eax
+  801074:	0f 97 c1             	seta   %cl
+  801077:	0f b6 c9             	movzbl %cl,%ecx
+  80107a:	eb d7                	jmp    801053 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  80107c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801081:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801086:	8b 55 08             	mov    0x8(%ebp),%edx
+  801089:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80108c:	89 df                	mov    %ebx,%edi
+  80108e:	89 de                	mov    %ebx,%esi
+  801090:	cd 30                	int    $0x30
+  801092:	eb 90                	jmp    801024 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801094:	83 ec 0c             	sub    $0xc,%esp
+  801097:	50                   	push   %eax
+  801098:	6a 1f                	push   $0x1f
+  80109a:	68 ea 27 80 00       	push   $0x8027ea
+  80109f:	6a 4a                	push   $0x4a
+  8010a1:	68 07 28 80 00       	push   $0x802807
+  8010a6:	e8 85 0b 00 00       	call   801c30 <_panic>
+
+008010ab <sys_ipc_call>:
+{
+  8010ab:	55                   	push   %ebp
+  8010ac:	89 e5                	mov    %esp,%ebp
+  8010ae:	57                   	push   %edi
+  8010af:	56                   	push   %esi
+  8010b0:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b4:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8010b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8010bc:	55                   	push   %ebp
+  8010bd:	56                   	push   %esi
+  8010be:	8b 0e                	mov    (%esi),%ecx
+  8010c0:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8010c3:	8b 7e 08             	mov    0x8(%esi),%edi
+  8010c6:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8010c9:	8b 76 0c             	mov    0xc(%esi),%esi
+  8010cc:	cd 30                	int    $0x30
+  8010ce:	87 34 24             	xchg   %esi,(%esp)
+  8010d1:	89 0e                	mov    %ecx,(%esi)
+  8010d3:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8010d6:	89 7e 08             	mov    %edi,0x8(%esi)
+  8010d9:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8010dc:	8f 46 0c             	pop    0xc(%esi)
+  8010df:	5d                   	pop    %ebp
+}
+  8010e0:	5b                   	pop    %ebx
+  8010e1:	5e                   	pop    %esi
+  8010e2:	5f                   	pop    %edi
+  8010e3:	5d                   	pop    %ebp
+  8010e4:	c3                   	ret
+
+008010e5 <sys_ipc_reply_wait>:
+{
+  8010e5:	55                   	push   %ebp
+  8010e6:	89 e5                	mov    %esp,%ebp
+  8010e8:	57                   	push   %edi
+  8010e9:	56                   	push   %esi
+  8010ea:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ee:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8010f3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8010f6:	55                   	push   %ebp
+  8010f7:	56                   	push   %esi
+  8010f8:	8b 0e                	mov    (%esi),%ecx
+  8010fa:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8010fd:	8b 7e 08             	mov    0x8(%esi),%edi
+  801100:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801103:	8b 76 0c             	mov    0xc(%esi),%esi
+  801106:	cd 30                	int    $0x30
+  801108:	87 34 24             	xchg   %esi,(%esp)
+  80110b:	89 0e                	mov    %ecx,(%esi)
+  80110d:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801110:	89 7e 08             	mov    %edi,0x8(%esi)
+  801113:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801116:	8f 46 0c             	pop    0xc(%esi)
+  801119:	5d                   	pop    %ebp
+}
+  80111a:	5b                   	pop    %ebx
+  80111b:	5e                   	pop    %esi
+  80111c:	5f                   	pop    %edi
+  80111d:	5d                   	pop    %ebp
+  80111e:	c3                   	ret
+
+0080111f <sys_ipc_send_msg>:
+{
+  80111f:	55                   	push   %ebp
+  801120:	89 e5                	mov    %esp,%ebp
+  801122:	57                   	push   %edi
+  801123:	56                   	push   %esi
+  801124:	53                   	push   %ebx
+  801125:	83 ec 20             	sub    $0x20,%esp
+  801128:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  80112b:	8b 10                	mov    (%eax),%edx
+  80112d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801130:	8b 50 04             	mov    0x4(%eax),%edx
+  801133:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801136:	8b 50 08             	mov    0x8(%eax),%edx
+  801139:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  80113c:	8b 50 0c             	mov    0xc(%eax),%edx
+  80113f:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801142:	8b 40 10             	mov    0x10(%eax),%eax
+  801145:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801148:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  80114b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801153:	55                   	push   %ebp
+  801154:	56                   	push   %esi
+  801155:	8b 0e                	mov    (%esi),%ecx
+  801157:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80115a:	8b 7e 08             	mov    0x8(%esi),%edi
+  80115d:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801160:	8b 76 0c             	mov    0xc(%esi),%esi
+  801163:	cd 30                	int    $0x30
+  801165:	87 34 24             	xchg   %esi,(%esp)
+  801168:	89 0e                	mov    %ecx,(%esi)
+  80116a:	89 5e 04             	mov    %ebx,0x4(%esi)
+  80116d:	89 7e 08             	mov    %edi,0x8(%esi)
+  801170:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801173:	8f 46 0c             	pop    0xc(%esi)
+  801176:	5d                   	pop    %ebp
+}
+  801177:	83 c4 20             	add    $0x20,%esp
+  80117a:	5b                   	pop    %ebx
+  80117b:	5e                   	pop    %esi
+  80117c:	5f                   	pop    %edi
+  80117d:	5d                   	pop    %ebp
+  80117e:	c3                   	ret
+
+0080117f <sys_fork>:
+{
+  80117f:	55                   	push   %ebp
+  801180:	89 e5                	mov    %esp,%ebp
+  801182:	57                   	push   %edi
+  801183:	56                   	push   %esi
+  801184:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801185:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80118c:	78 2e                	js     8011bc <sys_fork+0x3d>
+	if (syscall_sysenter)
+  80118e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801195:	74 71                	je     801208 <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801197:	ba 00 00 00 00       	mov    $0x0,%edx
+  80119c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011a1:	89 d1                	mov    %edx,%ecx
+  8011a3:	89 d3                	mov    %edx,%ebx
+  8011a5:	89 d7                	mov    %edx,%edi
+  8011a7:	89 d6                	mov    %edx,%esi
+  8011a9:	55                   	push   %ebp
+  8011aa:	68 b3 11 80 00       	push   $0x8011b3
+  8011af:	89 e5                	mov    %esp,%ebp
+  8011b1:	0f 34                	sysenter
+  8011b3:	83 c4 04             	add    $0x4,%esp
+  8011b6:	5d                   	pop    %ebp
+}
+  8011b7:	5b                   	pop    %ebx
+  8011b8:	5e                   	pop    %esi
+  8011b9:	5f                   	pop    %edi
+  8011ba:	5d                   	pop    %ebp
+  8011bb:	c3                   	ret
+  8011bc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011c1:	0f a2                	cpuid
+		return 0;
+  8011c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8011c8:	f6 c6 08             	test   $0x8,%dh
+  8011cb:	74 15                	je     8011e2 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011cd:	89 c2                	mov    %eax,%edx
+  8011cf:	c1 ea 08             	shr    $0x8,%edx
+  8011d2:	83 e2 0f             	and    $0xf,%edx
+  8011d5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011da:	83 fa 06             	cmp    $0x6,%edx
+  8011dd:	74 0e                	je     8011ed <sys_fork+0x6e>
+  8011df:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8011e2:	0f b6 c9             	movzbl %cl,%ecx
+  8011e5:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8011eb:	eb a1                	jmp    80118e <sys_fork+0xf>
+  8011ed:	89 c2                	mov    %eax,%edx
+  8011ef:	c1 ea 04             	shr    $0x4,%edx
+  8011f2:	83 e2 0f             	and    $0xf,%edx
+  8011f5:	83 fa 02             	cmp    $0x2,%edx
+  8011f8:	77 e5                	ja     8011df <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  8011fa:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011fd:	83 f8 02             	cmp    $0x2,%eax
+  801200:	0f 97 c1             	seta   %cl
+  801203:	0f b6 c9             	movzbl %cl,%ecx
+  801206:	eb d7                	jmp    8011df <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801208:	ba 00 00 00 00       	mov    $0x0,%edx
+  80120d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801212:	89 d1                	mov    %edx,%ecx
+  801214:	89 d3                	mov    %edx,%ebx
+  801216:	89 d7                	mov    %edx,%edi
+  801218:	89 d6                	mov    %edx,%esi
+  80121a:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  80121c:	eb 99                	jmp    8011b7 <sys_fork+0x38>
+
+0080121e <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  80121e:	55                   	push   %ebp
+  80121f:	89 e5                	mov    %esp,%ebp
+  801221:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801224:	ff 75 14             	push   0x14(%ebp)
+  801227:	ff 75 10             	push   0x10(%ebp)
+  80122a:	ff 75 0c             	push   0xc(%ebp)
+  80122d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801232:	8b 55 08             	mov    0x8(%ebp),%edx
+  801235:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80123a:	e8 81 ee ff ff       	call   8000c0 <page_vec_call>
+}
+  80123f:	c9                   	leave
+  801240:	c3                   	ret
+
+00801241 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801241:	55                   	push   %ebp
+  801242:	89 e5                	mov    %esp,%ebp
+  801244:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801247:	ff 75 18             	push   0x18(%ebp)
+  80124a:	ff 75 14             	push   0x14(%ebp)
+  80124d:	ff 75 10             	push   0x10(%ebp)
+  801250:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801253:	8b 55 08             	mov    0x8(%ebp),%edx
+  801256:	b8 10 00 00 00       	mov    $0x10,%eax
+  80125b:	e8 60 ee ff ff       	call   8000c0 <page_vec_call>
+}
+  801260:	c9                   	leave
+  801261:	c3                   	ret
+
+00801262 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801262:	55                   	push   %ebp
+  801263:	89 e5                	mov    %esp,%ebp
+  801265:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801268:	ff 75 14             	push   0x14(%ebp)
+  80126b:	ff 75 10             	push   0x10(%ebp)
+  80126e:	ff 75 0c             	push   0xc(%ebp)
+  801271:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801276:	8b 55 08             	mov    0x8(%ebp),%edx
+  801279:	b8 11 00 00 00       	mov    $0x11,%eax
+  80127e:	e8 3d ee ff ff       	call   8000c0 <page_vec_call>
+}
+  801283:	c9                   	leave
+  801284:	c3                   	ret
+
+00801285 <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801285:	55                   	push   %ebp
+  801286:	89 e5                	mov    %esp,%ebp
+  801288:	57                   	push   %edi
+  801289:	56                   	push   %esi
+  80128a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80128b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801292:	78 32                	js     8012c6 <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801294:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80129b:	74 75                	je     801312 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  80129d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a3:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012b0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012b3:	55                   	push   %ebp
+  8012b4:	68 bd 12 80 00       	push   $0x8012bd
+  8012b9:	89 e5                	mov    %esp,%ebp
+  8012bb:	0f 34                	sysenter
+  8012bd:	83 c4 04             	add    $0x4,%esp
+  8012c0:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  8012c1:	5b                   	pop    %ebx
+  8012c2:	5e                   	pop    %esi
+  8012c3:	5f                   	pop    %edi
+  8012c4:	5d                   	pop    %ebp
+  8012c5:	c3                   	ret
+  8012c6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012cb:	0f a2                	cpuid
+		return 0;
+  8012cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8012d2:	f6 c6 08             	test   $0x8,%dh
+  8012d5:	74 15                	je     8012ec <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012d7:	89 c2                	mov    %eax,%edx
+  8012d9:	c1 ea 08             	shr    $0x8,%edx
+  8012dc:	83 e2 0f             	and    $0xf,%edx
+  8012df:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012e4:	83 fa 06             	cmp    $0x6,%edx
+  8012e7:	74 0e                	je     8012f7 <sys_vm_ranges+0x72>
+  8012e9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8012ec:	0f b6 c9             	movzbl %cl,%ecx
+  8012ef:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8012f5:	eb 9d                	jmp    801294 <sys_vm_ranges+0xf>
+  8012f7:	89 c2                	mov    %eax,%edx
+  8012f9:	c1 ea 04             	shr    $0x4,%edx
+  8012fc:	83 e2 0f             	and    $0xf,%edx
+  8012ff:	83 fa 02             	cmp    $0x2,%edx
+  801302:	77 e5                	ja     8012e9 <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  801304:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801307:	83 f8 02             	cmp    $0x2,%eax
+  80130a:	0f 97 c1             	seta   %cl
+  80130d:	0f b6 c9             	movzbl %cl,%ecx
+  801310:	eb d7                	jmp    8012e9 <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801312:	b8 12 00 00 00       	mov    $0x12,%eax
+  801317:	be 00 00 00 00       	mov    $0x0,%esi
+  80131c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80131f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801322:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801325:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801328:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  80132a:	eb 95                	jmp    8012c1 <sys_vm_ranges+0x3c>
+
+0080132c <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  80132c:	55                   	push   %ebp
+  80132d:	89 e5                	mov    %esp,%ebp
+  80132f:	57                   	push   %edi
+  801330:	56                   	push   %esi
+  801331:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801332:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801339:	78 31                	js     80136c <sys_spawn+0x40>
+	if (syscall_sysenter)
+  80133b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801342:	74 74                	je     8013b8 <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801344:	be 00 00 00 00       	mov    $0x0,%esi
+  801349:	8b 55 08             	mov    0x8(%ebp),%edx
+  80134c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80134f:	b8 14 00 00 00       	mov    $0x14,%eax
+  801354:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801357:	89 f7                	mov    %esi,%edi
+  801359:	55                   	push   %ebp
+  80135a:	68 63 13 80 00       	push   $0x801363
+  80135f:	89 e5                	mov    %esp,%ebp
+  801361:	0f 34                	sysenter
+  801363:	83 c4 04             	add    $0x4,%esp
+  801366:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801367:	5b                   	pop    %ebx
+  801368:	5e                   	pop    %esi
+  801369:	5f                   	pop    %edi
+  80136a:	5d                   	pop    %ebp
+  80136b:	c3                   	ret
+  80136c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801371:	0f a2                	cpuid
+		return 0;
+  801373:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801378:	f6 c6 08             	test   $0x8,%dh
+  80137b:	74 15                	je     801392 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80137d:	89 c2                	mov    %eax,%edx
+  80137f:	c1 ea 08             	shr    $0x8,%edx
+  801382:	83 e2 0f             	and    $0xf,%edx
+  801385:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80138a:	83 fa 06             	cmp    $0x6,%edx
+  80138d:	74 0e                	je     80139d <sys_spawn+0x71>
+  80138f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801392:	0f b6 c9             	movzbl %cl,%ecx
+  801395:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80139b:	eb 9e                	jmp    80133b <sys_spawn+0xf>
+  80139d:	89 c2                	mov    %eax,%edx
+  80139f:	c1 ea 04             	shr    $0x4,%edx
+  8013a2:	83 e2 0f             	and    $0xf,%edx
+  8013a5:	83 fa 02             	cmp    $0x2,%edx
+  8013a8:	77 e5                	ja     80138f <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  8013aa:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013ad:	83 f8 02             	cmp    $0x2,%eax
+  8013b0:	0f 97 c1             	seta   %cl
+  8013b3:	0f b6 c9             	movzbl %cl,%ecx
+  8013b6:	eb d7                	jmp    80138f <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  8013b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8013bd:	b8 14 00 00 00       	mov    $0x14,%eax
+  8013c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013cb:	89 f7                	mov    %esi,%edi
+  8013cd:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  8013cf:	eb 96                	jmp    801367 <sys_spawn+0x3b>
+
+008013d1 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  8013d1:	55                   	push   %ebp
+  8013d2:	89 e5                	mov    %esp,%ebp
+  8013d4:	57                   	push   %edi
+  8013d5:	56                   	push   %esi
+  8013d6:	53                   	push   %ebx
+  8013d7:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8013da:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8013e1:	78 37                	js     80141a <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  8013e3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8013ea:	74 7a                	je     801466 <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  8013ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013f7:	b8 15 00 00 00       	mov    $0x15,%eax
+  8013fc:	89 df                	mov    %ebx,%edi
+  8013fe:	89 de                	mov    %ebx,%esi
+  801400:	55                   	push   %ebp
+  801401:	68 0a 14 80 00       	push   $0x80140a
+  801406:	89 e5                	mov    %esp,%ebp
+  801408:	0f 34                	sysenter
+  80140a:	83 c4 04             	add    $0x4,%esp
+  80140d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80140e:	85 c0                	test   %eax,%eax
+  801410:	7f 6c                	jg     80147e <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  801412:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801415:	5b                   	pop    %ebx
+  801416:	5e                   	pop    %esi
+  801417:	5f                   	pop    %edi
+  801418:	5d                   	pop    %ebp
+  801419:	c3                   	ret
+  80141a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80141f:	0f a2                	cpuid
+		return 0;
+  801421:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801426:	f6 c6 08             	test   $0x8,%dh
+  801429:	74 15                	je     801440 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80142b:	89 c2                	mov    %eax,%edx
+  80142d:	c1 ea 08             	shr    $0x8,%edx
+  801430:	83 e2 0f             	and    $0xf,%edx
+  801433:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801438:	83 fa 06             	cmp    $0x6,%edx
+  80143b:	74 0e                	je     80144b <sys_shm_create+0x7a>
+  80143d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801440:	0f b6 c9             	movzbl %cl,%ecx
+  801443:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801449:	eb 98                	jmp    8013e3 <sys_shm_create+0x12>
+  80144b:	89 c2                	mov    %eax,%edx
+  80144d:	c1 ea 04             	shr    $0x4,%edx
+  801450:	83 e2 0f             	and    $0xf,%edx
+  801453:	83 fa 02             	cmp    $0x2,%edx
+  801456:	77 e5                	ja     80143d <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  801458:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80145b:	83 f8 02             	cmp    $0x2,%eax
+  80145e:	0f 97 c1             	seta   %cl
+  801461:	0f b6 c9             	movzbl %cl,%ecx
+  801464:	eb d7                	jmp    80143d <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  801466:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80146b:	b8 15 00 00 00       	mov    $0x15,%eax
+  801470:	8b 55 08             	mov    0x8(%ebp),%edx
+  801473:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801476:	89 df                	mov    %ebx,%edi
+  801478:	89 de                	mov    %ebx,%esi
+  80147a:	cd 30                	int    $0x30
+  80147c:	eb 90                	jmp    80140e <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80147e:	83 ec 0c             	sub    $0xc,%esp
+  801481:	50                   	push   %eax
+  801482:	6a 15                	push   $0x15
+  801484:	68 ea 27 80 00       	push   $0x8027ea
+  801489:	6a 4a                	push   $0x4a
+  80148b:	68 07 28 80 00       	push   $0x802807
+  801490:	e8 9b 07 00 00       	call   801c30 <_panic>
+
+00801495 <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  801495:	55                   	push   %ebp
+  801496:	89 e5                	mov    %esp,%ebp
+  801498:	57                   	push   %edi
+  801499:	56                   	push   %esi
+  80149a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80149b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8014a2:	78 32                	js     8014d6 <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  8014a4:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8014ab:	74 75                	je     801522 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  8014ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b3:	b8 16 00 00 00       	mov    $0x16,%eax
+  8014b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8014bd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014c0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014c3:	55                   	push   %ebp
+  8014c4:	68 cd 14 80 00       	push   $0x8014cd
+  8014c9:	89 e5                	mov    %esp,%ebp
+  8014cb:	0f 34                	sysenter
+  8014cd:	83 c4 04             	add    $0x4,%esp
+  8014d0:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  8014d1:	5b                   	pop    %ebx
+  8014d2:	5e                   	pop    %esi
+  8014d3:	5f                   	pop    %edi
+  8014d4:	5d                   	pop    %ebp
+  8014d5:	c3                   	ret
+  8014d6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014db:	0f a2                	cpuid
+		return 0;
+  8014dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8014e2:	f6 c6 08             	test   $0x8,%dh
+  8014e5:	74 15                	je     8014fc <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014e7:	89 c2                	mov    %eax,%edx
+  8014e9:	c1 ea 08             	shr    $0x8,%edx
+  8014ec:	83 e2 0f             	and    $0xf,%edx
+  8014ef:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8014f4:	83 fa 06             	cmp    $0x6,%edx
+  8014f7:	74 0e                	je     801507 <sys_shm_attach+0x72>
+  8014f9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8014fc:	0f b6 c9             	movzbl %cl,%ecx
+  8014ff:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801505:	eb 9d                	jmp    8014a4 <sys_shm_attach+0xf>
+  801507:	89 c2                	mov    %eax,%edx
+  801509:	c1 ea 04             	shr    $0x4,%edx
+  80150c:	83 e2 0f             	and    $0xf,%edx
+  80150f:	83 fa 02             	cmp    $0x2,%edx
+  801512:	77 e5                	ja     8014f9 <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  801514:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801517:	83 f8 02             	cmp    $0x2,%eax
+  80151a:	0f 97 c1             	seta   %cl
+  80151d:	0f b6 c9             	movzbl %cl,%ecx
+  801520:	eb d7                	jmp    8014f9 <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  801522:	b8 16 00 00 00       	mov    $0x16,%eax
+  801527:	be 00 00 00 00       	mov    $0x0,%esi
+  80152c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80152f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801532:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801535:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801538:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  80153a:	eb 95                	jmp    8014d1 <sys_shm_attach+0x3c>
+
+0080153c <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  80153c:	55                   	push   %ebp
+  80153d:	89 e5                	mov    %esp,%ebp
+  80153f:	57                   	push   %edi
+  801540:	56                   	push   %esi
+  801541:	53                   	push   %ebx
+  801542:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801545:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80154c:	78 38                	js     801586 <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  80154e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801555:	74 7b                	je     8015d2 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  801557:	be 00 00 00 00       	mov    $0x0,%esi
+  80155c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80155f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801562:	b8 17 00 00 00       	mov    $0x17,%eax
+  801567:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80156a:	89 f7                	mov    %esi,%edi
+  80156c:	55                   	push   %ebp
+  80156d:	68 76 15 80 00       	push   $0x801576
+  801572:	89 e5                	mov    %esp,%ebp
+  801574:	0f 34                	sysenter
+  801576:	83 c4 04             	add    $0x4,%esp
+  801579:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80157a:	85 c0                	test   %eax,%eax
+  80157c:	7f 6d                	jg     8015eb <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  80157e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801581:	5b                   	pop    %ebx
+  801582:	5e                   	pop    %esi
+  801583:	5f                   	pop    %edi
+  801584:	5d                   	pop    %ebp
+  801585:	c3                   	ret
+  801586:	b8 01 00 00 00       	mov    $0x1,%eax
+  80158b:	0f a2                	cpuid
+		return 0;
+  80158d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801592:	f6 c6 08             	test   $0x8,%dh
+  801595:	74 15                	je     8015ac <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801597:	89 c2                	mov    %eax,%edx
+  801599:	c1 ea 08             	shr    $0x8,%edx
+  80159c:	83 e2 0f             	and    $0xf,%edx
+  80159f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8015a4:	83 fa 06             	cmp    $0x6,%edx
+  8015a7:	74 0e                	je     8015b7 <sys_shm_detach+0x7b>
+  8015a9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8015ac:	0f b6 c9             	movzbl %cl,%ecx
+  8015af:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8015b5:	eb 97                	jmp    80154e <sys_shm_detach+0x12>
+  8015b7:	89 c2                	mov    %eax,%edx
+  8015b9:	c1 ea 04             	shr    $0x4,%edx
+  8015bc:	83 e2 0f             	and    $0xf,%edx
+  8015bf:	83 fa 02             	cmp    $0x2,%edx
+  8015c2:	77 e5                	ja     8015a9 <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  8015c4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015c7:	83 f8 02             	cmp    $0x2,%eax
+  8015ca:	0f 97 c1             	seta   %cl
+  8015cd:	0f b6 c9             	movzbl %cl,%ecx
+  8015d0:	eb d7                	jmp    8015a9 <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  8015d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d7:	b8 17 00 00 00       	mov    $0x17,%eax
+  8015dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015e2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015e5:	89 f7                	mov    %esi,%edi
+  8015e7:	cd 30                	int    $0x30
+  8015e9:	eb 8f                	jmp    80157a <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015eb:	83 ec 0c             	sub    $0xc,%esp
+  8015ee:	50                   	push   %eax
+  8015ef:	6a 17                	push   $0x17
+  8015f1:	68 ea 27 80 00       	push   $0x8027ea
+  8015f6:	6a 4a                	push   $0x4a
+  8015f8:	68 07 28 80 00       	push   $0x802807
+  8015fd:	e8 2e 06 00 00       	call   801c30 <_panic>
+
+00801602 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  801602:	55                   	push   %ebp
+  801603:	89 e5                	mov    %esp,%ebp
+  801605:	57                   	push   %edi
+  801606:	56                   	push   %esi
+  801607:	53                   	push   %ebx
+  801608:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80160b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801612:	78 36                	js     80164a <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  801614:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80161b:	74 79                	je     801696 <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  80161d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801620:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801625:	b8 18 00 00 00       	mov    $0x18,%eax
+  80162a:	89 cb                	mov    %ecx,%ebx
+  80162c:	89 cf                	mov    %ecx,%edi
+  80162e:	89 ce                	mov    %ecx,%esi
+  801630:	55                   	push   %ebp
+  801631:	68 3a 16 80 00       	push   $0x80163a
+  801636:	89 e5                	mov    %esp,%ebp
+  801638:	0f 34                	sysenter
+  80163a:	83 c4 04             	add    $0x4,%esp
+  80163d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80163e:	85 c0                	test   %eax,%eax
+  801640:	7f 6b                	jg     8016ad <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  801642:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801645:	5b                   	pop    %ebx
+  801646:	5e                   	pop    %esi
+  801647:	5f                   	pop    %edi
+  801648:	5d                   	pop    %ebp
+  801649:	c3                   	ret
+  80164a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80164f:	0f a2                	cpuid
+		return 0;
+  801651:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801656:	f6 c6 08             	test   $0x8,%dh
+  801659:	74 15                	je     801670 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80165b:	89 c2                	mov    %eax,%edx
+  80165d:	c1 ea 08             	shr    $0x8,%edx
+  801660:	83 e2 0f             	and    $0xf,%edx
+  801663:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801668:	83 fa 06             	cmp    $0x6,%edx
+  80166b:	74 0e                	je     80167b <sys_shm_remove+0x79>
+  80166d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801670:	0f b6 c9             	movzbl %cl,%ecx
+  801673:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801679:	eb 99                	jmp    801614 <sys_shm_remove+0x12>
+  80167b:	89 c2                	mov    %eax,%edx
+  80167d:	c1 ea 04             	shr    $0x4,%edx
+  801680:	83 e2 0f             	and    $0xf,%edx
+  801683:	83 fa 02             	cmp    $0x2,%edx
+  801686:	77 e5                	ja     80166d <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  801688:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80168b:	83 f8 02             	cmp    $0x2,%eax
+  80168e:	0f 97 c1             	seta   %cl
+  801691:	0f b6 c9             	movzbl %cl,%ecx
+  801694:	eb d7                	jmp    80166d <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  801696:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80169b:	b8 18 00 00 00       	mov    $0x18,%eax
+  8016a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016a3:	89 cb                	mov    %ecx,%ebx
+  8016a5:	89 cf                	mov    %ecx,%edi
+  8016a7:	89 ce                	mov    %ecx,%esi
+  8016a9:	cd 30                	int    $0x30
+  8016ab:	eb 91                	jmp    80163e <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016ad:	83 ec 0c             	sub    $0xc,%esp
+  8016b0:	50                   	push   %eax
+  8016b1:	6a 18                	push   $0x18
+  8016b3:	68 ea 27 80 00       	push   $0x8027ea
+  8016b8:	6a 4a                	push   $0x4a
+  8016ba:	68 07 28 80 00       	push   $0x802807
+  8016bf:	e8 6c 05 00 00       	call   801c30 <_panic>
+
+008016c4 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  8016c4:	55                   	push   %ebp
+  8016c5:	89 e5                	mov    %esp,%ebp
+  8016c7:	57                   	push   %edi
+  8016c8:	56                   	push   %esi
+  8016c9:	53                   	push   %ebx
+  8016ca:	83 ec 0c             	sub    $0xc,%esp
+  8016cd:	8b 45 10             	mov    0x10(%ebp),%eax
+  8016d0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8016d3:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  8016d6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8016dd:	78 32                	js     801711 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  8016df:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8016e6:	74 75                	je     80175d <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  8016e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016ee:	b8 20 00 00 00       	mov    $0x20,%eax
+  8016f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8016f8:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8016fb:	55                   	push   %ebp
+  8016fc:	68 05 17 80 00       	push   $0x801705
+  801701:	89 e5                	mov    %esp,%ebp
+  801703:	0f 34                	sysenter
+  801705:	83 c4 04             	add    $0x4,%esp
+  801708:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  801709:	83 c4 0c             	add    $0xc,%esp
+  80170c:	5b                   	pop    %ebx
+  80170d:	5e                   	pop    %esi
+  80170e:	5f                   	pop    %edi
+  80170f:	5d                   	pop    %ebp
+  801710:	c3                   	ret
+  801711:	b8 01 00 00 00       	mov    $0x1,%eax
+  801716:	0f a2                	cpuid
+		return 0;
+  801718:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80171d:	f6 c6 08             	test   $0x8,%dh
+  801720:	74 15                	je     801737 <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801722:	89 c2                	mov    %eax,%edx
+  801724:	c1 ea 08             	shr    $0x8,%edx
+  801727:	83 e2 0f             	and    $0xf,%edx
+  80172a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80172f:	83 fa 06             	cmp    $0x6,%edx
+  801732:	74 0e                	je     801742 <sys_futex_wait+0x7e>
+  801734:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801737:	0f b6 c9             	movzbl %cl,%ecx
+  80173a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801740:	eb 9d                	jmp    8016df <sys_futex_wait+0x1b>
+  801742:	89 c2                	mov    %eax,%edx
+  801744:	c1 ea 04             	shr    $0x4,%edx
+  801747:	83 e2 0f             	and    $0xf,%edx
+  80174a:	83 fa 02             	cmp    $0x2,%edx
+  80174d:	77 e5                	ja     801734 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  80174f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801752:	83 f8 02             	cmp    $0x2,%eax
+  801755:	0f 97 c1             	seta   %cl
+  801758:	0f b6 c9             	movzbl %cl,%ecx
+  80175b:	eb d7                	jmp    801734 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  80175d:	b8 20 00 00 00       	mov    $0x20,%eax
+  801762:	be 00 00 00 00       	mov    $0x0,%esi
+  801767:	8b 55 08             	mov    0x8(%ebp),%edx
+  80176a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80176d:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  801770:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  801772:	eb 95                	jmp    801709 <sys_futex_wait+0x45>
+
+00801774 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801774:	55                   	push   %ebp
+  801775:	89 e5                	mov    %esp,%ebp
+  801777:	57                   	push   %edi
+  801778:	56                   	push   %esi
+  801779:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80177a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801781:	78 30                	js     8017b3 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  801783:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80178a:	74 73                	je     8017ff <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  80178c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801791:	8b 55 08             	mov    0x8(%ebp),%edx
+  801794:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801797:	b8 21 00 00 00       	mov    $0x21,%eax
+  80179c:	89 df                	mov    %ebx,%edi
+  80179e:	89 de                	mov    %ebx,%esi
+  8017a0:	55                   	push   %ebp
+  8017a1:	68 aa 17 80 00       	push   $0x8017aa
+  8017a6:	89 e5                	mov    %esp,%ebp
+  8017a8:	0f 34                	sysenter
+  8017aa:	83 c4 04             	add    $0x4,%esp
+  8017ad:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8017ae:	5b                   	pop    %ebx
+  8017af:	5e                   	pop    %esi
+  8017b0:	5f                   	pop    %edi
+  8017b1:	5d                   	pop    %ebp
+  8017b2:	c3                   	ret
+  8017b3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8017b8:	0f a2                	cpuid
+		return 0;
+  8017ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8017bf:	f6 c6 08             	test   $0x8,%dh
+  8017c2:	74 15                	je     8017d9 <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017c4:	89 c2                	mov    %eax,%edx
+  8017c6:	c1 ea 08             	shr    $0x8,%edx
+  8017c9:	83 e2 0f             	and    $0xf,%edx
+  8017cc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017d1:	83 fa 06             	cmp    $0x6,%edx
+  8017d4:	74 0e                	je     8017e4 <sys_futex_wake+0x70>
+  8017d6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8017d9:	0f b6 c9             	movzbl %cl,%ecx
+  8017dc:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8017e2:	eb 9f                	jmp    801783 <sys_futex_wake+0xf>
+  8017e4:	89 c2                	mov    %eax,%edx
+  8017e6:	c1 ea 04             	shr    $0x4,%edx
+  8017e9:	83 e2 0f             	and    $0xf,%edx
+  8017ec:	83 fa 02             	cmp    $0x2,%edx
+  8017ef:	77 e5                	ja     8017d6 <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  8017f1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017f4:	83 f8 02             	cmp    $0x2,%eax
+  8017f7:	0f 97 c1             	seta   %cl
+  8017fa:	0f b6 c9             	movzbl %cl,%ecx
+  8017fd:	eb d7                	jmp    8017d6 <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  8017ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801804:	b8 21 00 00 00       	mov    $0x21,%eax
+  801809:	8b 55 08             	mov    0x8(%ebp),%edx
+  80180c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80180f:	89 df                	mov    %ebx,%edi
+  801811:	89 de                	mov    %ebx,%esi
+  801813:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  801815:	eb 97                	jmp    8017ae <sys_futex_wake+0x3a>
+
+00801817 <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  801817:	55                   	push   %ebp
+  801818:	89 e5                	mov    %esp,%ebp
+  80181a:	57                   	push   %edi
+  80181b:	56                   	push   %esi
+  80181c:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80181d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801824:	78 2e                	js     801854 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  801826:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80182d:	74 71                	je     8018a0 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  80182f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801834:	b8 22 00 00 00       	mov    $0x22,%eax
+  801839:	89 d1                	mov    %edx,%ecx
+  80183b:	89 d3                	mov    %edx,%ebx
+  80183d:	89 d7                	mov    %edx,%edi
+  80183f:	89 d6                	mov    %edx,%esi
+  801841:	55                   	push   %ebp
+  801842:	68 4b 18 80 00       	push   $0x80184b
+  801847:	89 e5                	mov    %esp,%ebp
+  801849:	0f 34                	sysenter
+  80184b:	83 c4 04             	add    $0x4,%esp
+  80184e:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  80184f:	5b                   	pop    %ebx
+  801850:	5e                   	pop    %esi
+  801851:	5f                   	pop    %edi
+  801852:	5d                   	pop    %ebp
+  801853:	c3                   	ret
+  801854:	b8 01 00 00 00       	mov    $0x1,%eax
+  801859:	0f a2                	cpuid
+		return 0;
+  80185b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801860:	f6 c6 08             	test   $0x8,%dh
+  801863:	74 15                	je     80187a <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801865:	89 c2                	mov    %eax,%edx
+  801867:	c1 ea 08             	shr    $0x8,%edx
+  80186a:	83 e2 0f             	and    $0xf,%edx
+  80186d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801872:	83 fa 06             	cmp    $0x6,%edx
+  801875:	74 0e                	je     801885 <sys_ep_create+0x6e>
+  801877:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80187a:	0f b6 c9             	movzbl %cl,%ecx
+  80187d:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801883:	eb a1                	jmp    801826 <sys_ep_create+0xf>
+  801885:	89 c2                	mov    %eax,%edx
+  801887:	c1 ea 04             	shr    $0x4,%edx
+  80188a:	83 e2 0f             	and    $0xf,%edx
+  80188d:	83 fa 02             	cmp    $0x2,%edx
+  801890:	77 e5                	ja     801877 <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  801892:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801895:	83 f8 02             	cmp    $0x2,%eax
+  801898:	0f 97 c1             	seta   %cl
+  80189b:	0f b6 c9             	movzbl %cl,%ecx
+  80189e:	eb d7                	jmp    801877 <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  8018a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018a5:	b8 22 00 00 00       	mov    $0x22,%eax
+  8018aa:	89 d1                	mov    %edx,%ecx
+  8018ac:	89 d3                	mov    %edx,%ebx
+  8018ae:	89 d7                	mov    %edx,%edi
+  8018b0:	89 d6                	mov    %edx,%esi
+  8018b2:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  8018b4:	eb 99                	jmp    80184f <sys_ep_create+0x38>
+
+008018b6 <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  8018b6:	55                   	push   %ebp
+  8018b7:	89 e5                	mov    %esp,%ebp
+  8018b9:	57                   	push   %edi
+  8018ba:	56                   	push   %esi
+  8018bb:	53                   	push   %ebx
+  8018bc:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8018bf:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8018c6:	78 36                	js     8018fe <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  8018c8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8018cf:	74 79                	je     80194a <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  8018d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018d9:	b8 23 00 00 00       	mov    $0x23,%eax
+  8018de:	89 cb                	mov    %ecx,%ebx
+  8018e0:	89 cf                	mov    %ecx,%edi
+  8018e2:	89 ce                	mov    %ecx,%esi
+  8018e4:	55                   	push   %ebp
+  8018e5:	68 ee 18 80 00       	push   $0x8018ee
+  8018ea:	89 e5                	mov    %esp,%ebp
+  8018ec:	0f 34                	sysenter
+  8018ee:	83 c4 04             	add    $0x4,%esp
+  8018f1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8018f2:	85 c0                	test   %eax,%eax
+  8018f4:	7f 6b                	jg     801961 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  8018f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018f9:	5b                   	pop    %ebx
+  8018fa:	5e                   	pop    %esi
+  8018fb:	5f                   	pop    %edi
+  8018fc:	5d                   	pop    %ebp
+  8018fd:	c3                   	ret
+  8018fe:	b8 01 00 00 00       	mov    $0x1,%eax
+  801903:	0f a2                	cpuid
+		return 0;
+  801905:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80190a:	f6 c6 08             	test   $0x8,%dh
+  80190d:	74 15                	je     801924 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80190f:	89 c2                	mov    %eax,%edx
+  801911:	c1 ea 08             	shr    $0x8,%edx
+  801914:	83 e2 0f             	and    $0xf,%edx
+  801917:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80191c:	83 fa 06             	cmp    $0x6,%edx
+  80191f:	74 0e                	je     80192f <sys_ep_destroy+0x79>
+  801921:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801924:	0f b6 c9             	movzbl %cl,%ecx
+  801927:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80192d:	eb 99                	jmp    8018c8 <sys_ep_destroy+0x12>
+  80192f:	89 c2                	mov    %eax,%edx
+  801931:	c1 ea 04             	shr    $0x4,%edx
+  801934:	83 e2 0f             	and    $0xf,%edx
+  801937:	83 fa 02             	cmp    $0x2,%edx
+  80193a:	77 e5                	ja     801921 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  80193c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80193f:	83 f8 02             	cmp    $0x2,%eax
+  801942:	0f 97 c1             	seta   %cl
+  801945:	0f b6 c9             	movzbl %cl,%ecx
+  801948:	eb d7                	jmp    801921 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  80194a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80194f:	b8 23 00 00 00       	mov    $0x23,%eax
+  801954:	8b 55 08             	mov    0x8(%ebp),%edx
+  801957:	89 cb                	mov    %ecx,%ebx
+  801959:	89 cf                	mov    %ecx,%edi
+  80195b:	89 ce                	mov    %ecx,%esi
+  80195d:	cd 30                	int    $0x30
+  80195f:	eb 91                	jmp    8018f2 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801961:	83 ec 0c             	sub    $0xc,%esp
+  801964:	50                   	push   %eax
+  801965:	6a 23                	push   $0x23
+  801967:	68 ea 27 80 00       	push   $0x8027ea
+  80196c:	6a 4a                	push   $0x4a
+  80196e:	68 07 28 80 00       	push   $0x802807
+  801973:	e8 b8 02 00 00       	call   801c30 <_panic>
+
+00801978 <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  801978:	55                   	push   %ebp
+  801979:	89 e5                	mov    %esp,%ebp
+  80197b:	57                   	push   %edi
+  80197c:	56                   	push   %esi
+  80197d:	53                   	push   %ebx
+  80197e:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801981:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801988:	78 37                	js     8019c1 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  80198a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801991:	74 7a                	je     801a0d <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  801993:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801998:	8b 55 08             	mov    0x8(%ebp),%edx
+  80199b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80199e:	b8 24 00 00 00       	mov    $0x24,%eax
+  8019a3:	89 df                	mov    %ebx,%edi
+  8019a5:	89 de                	mov    %ebx,%esi
+  8019a7:	55                   	push   %ebp
+  8019a8:	68 b1 19 80 00       	push   $0x8019b1
+  8019ad:	89 e5                	mov    %esp,%ebp
+  8019af:	0f 34                	sysenter
+  8019b1:	83 c4 04             	add    $0x4,%esp
+  8019b4:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8019b5:	85 c0                	test   %eax,%eax
+  8019b7:	7f 6c                	jg     801a25 <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  8019b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019bc:	5b                   	pop    %ebx
+  8019bd:	5e                   	pop    %esi
+  8019be:	5f                   	pop    %edi
+  8019bf:	5d                   	pop    %ebp
+  8019c0:	c3                   	ret
+  8019c1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019c6:	0f a2                	cpuid
+		return 0;
+  8019c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8019cd:	f6 c6 08             	test   $0x8,%dh
+  8019d0:	74 15                	je     8019e7 <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019d2:	89 c2                	mov    %eax,%edx
+  8019d4:	c1 ea 08             	shr    $0x8,%edx
+  8019d7:	83 e2 0f             	and    $0xf,%edx
+  8019da:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019df:	83 fa 06             	cmp    $0x6,%edx
+  8019e2:	74 0e                	je     8019f2 <sys_ep_grant+0x7a>
+  8019e4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8019e7:	0f b6 c9             	movzbl %cl,%ecx
+  8019ea:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8019f0:	eb 98                	jmp    80198a <sys_ep_grant+0x12>
+  8019f2:	89 c2                	mov    %eax,%edx
+  8019f4:	c1 ea 04             	shr    $0x4,%edx
+  8019f7:	83 e2 0f             	and    $0xf,%edx
+  8019fa:	83 fa 02             	cmp    $0x2,%edx
+  8019fd:	77 e5                	ja     8019e4 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  8019ff:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a02:	83 f8 02             	cmp    $0x2,%eax
+  801a05:	0f 97 c1             	seta   %cl
+  801a08:	0f b6 c9             	movzbl %cl,%ecx
+  801a0b:	eb d7                	jmp    8019e4 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  801a0d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a12:	b8 24 00 00 00       	mov    $0x24,%eax
+  801a17:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a1a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a1d:	89 df                	mov    %ebx,%edi
+  801a1f:	89 de                	mov    %ebx,%esi
+  801a21:	cd 30                	int    $0x30
+  801a23:	eb 90                	jmp    8019b5 <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a25:	83 ec 0c             	sub    $0xc,%esp
+  801a28:	50                   	push   %eax
+  801a29:	6a 24                	push   $0x24
+  801a2b:	68 ea 27 80 00       	push   $0x8027ea
+  801a30:	6a 4a                	push   $0x4a
+  801a32:	68 07 28 80 00       	push   $0x802807
+  801a37:	e8 f4 01 00 00       	call   801c30 <_panic>
+
+00801a3c <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  801a3c:	55                   	push   %ebp
+  801a3d:	89 e5                	mov    %esp,%ebp
+  801a3f:	57                   	push   %edi
+  801a40:	56                   	push   %esi
+  801a41:	53                   	push   %ebx
+  801a42:	83 ec 20             	sub    $0x20,%esp
+  801a45:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801a48:	8b 10                	mov    (%eax),%edx
+  801a4a:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801a4d:	8b 50 04             	mov    0x4(%eax),%edx
+  801a50:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801a53:	8b 50 08             	mov    0x8(%eax),%edx
+  801a56:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801a59:	8b 50 0c             	mov    0xc(%eax),%edx
+  801a5c:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801a5f:	8b 40 10             	mov    0x10(%eax),%eax
+  801a62:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801a65:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801a68:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a6b:	b8 25 00 00 00       	mov    $0x25,%eax
+  801a70:	55                   	push   %ebp
+  801a71:	56                   	push   %esi
+  801a72:	8b 0e                	mov    (%esi),%ecx
+  801a74:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801a77:	8b 7e 08             	mov    0x8(%esi),%edi
+  801a7a:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801a7d:	8b 76 0c             	mov    0xc(%esi),%esi
+  801a80:	cd 30                	int    $0x30
+  801a82:	87 34 24             	xchg   %esi,(%esp)
+  801a85:	89 0e                	mov    %ecx,(%esi)
+  801a87:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801a8a:	89 7e 08             	mov    %edi,0x8(%esi)
+  801a8d:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801a90:	8f 46 0c             	pop    0xc(%esi)
+  801a93:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  801a94:	83 c4 20             	add    $0x20,%esp
+  801a97:	5b                   	pop    %ebx
+  801a98:	5e                   	pop    %esi
+  801a99:	5f                   	pop    %edi
+  801a9a:	5d                   	pop    %ebp
+  801a9b:	c3                   	ret
+
+00801a9c <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  801a9c:	55                   	push   %ebp
+  801a9d:	89 e5                	mov    %esp,%ebp
+  801a9f:	57                   	push   %edi
+  801aa0:	56                   	push   %esi
+  801aa1:	53                   	push   %ebx
+  801aa2:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  801aa5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801aa8:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  801aaa:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aad:	b8 26 00 00 00       	mov    $0x26,%eax
+  801ab2:	55                   	push   %ebp
+  801ab3:	56                   	push   %esi
+  801ab4:	8b 0e                	mov    (%esi),%ecx
+  801ab6:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801ab9:	8b 7e 08             	mov    0x8(%esi),%edi
+  801abc:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801abf:	8b 76 0c             	mov    0xc(%esi),%esi
+  801ac2:	cd 30                	int    $0x30
+  801ac4:	87 34 24             	xchg   %esi,(%esp)
+  801ac7:	89 0e                	mov    %ecx,(%esi)
+  801ac9:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801acc:	89 7e 08             	mov    %edi,0x8(%esi)
+  801acf:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801ad2:	8f 46 0c             	pop    0xc(%esi)
+  801ad5:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  801ad6:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  801ada:	74 0f                	je     801aeb <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  801adc:	85 c0                	test   %eax,%eax
+  801ade:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ae3:	0f 48 d1             	cmovs  %ecx,%edx
+  801ae6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  801ae9:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  801aeb:	5b                   	pop    %ebx
+  801aec:	5e                   	pop    %esi
+  801aed:	5f                   	pop    %edi
+  801aee:	5d                   	pop    %ebp
+  801aef:	c3                   	ret
+
+00801af0 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  801af0:	55                   	push   %ebp
+  801af1:	89 e5                	mov    %esp,%ebp
+  801af3:	57                   	push   %edi
+  801af4:	56                   	push   %esi
+  801af5:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801af6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801afd:	78 2f                	js     801b2e <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  801aff:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b06:	74 72                	je     801b7a <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  801b08:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b0b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b10:	b8 27 00 00 00       	mov    $0x27,%eax
+  801b15:	89 cb                	mov    %ecx,%ebx
+  801b17:	89 cf                	mov    %ecx,%edi
+  801b19:	89 ce                	mov    %ecx,%esi
+  801b1b:	55                   	push   %ebp
+  801b1c:	68 25 1b 80 00       	push   $0x801b25
+  801b21:	89 e5                	mov    %esp,%ebp
+  801b23:	0f 34                	sysenter
+  801b25:	83 c4 04             	add    $0x4,%esp
+  801b28:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  801b29:	5b                   	pop    %ebx
+  801b2a:	5e                   	pop    %esi
+  801b2b:	5f                   	pop    %edi
+  801b2c:	5d                   	pop    %ebp
+  801b2d:	c3                   	ret
+  801b2e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b33:	0f a2                	cpuid
+		return 0;
+  801b35:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b3a:	f6 c6 08             	test   $0x8,%dh
+  801b3d:	74 15                	je     801b54 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b3f:	89 c2                	mov    %eax,%edx
+  801b41:	c1 ea 08             	shr    $0x8,%edx
+  801b44:	83 e2 0f             	and    $0xf,%edx
+  801b47:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b4c:	83 fa 06             	cmp    $0x6,%edx
+  801b4f:	74 0e                	je     801b5f <sys_sysring_setup+0x6f>
+  801b51:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b54:	0f b6 c9             	movzbl %cl,%ecx
+  801b57:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801b5d:	eb a0                	jmp    801aff <sys_sysring_setup+0xf>
+  801b5f:	89 c2                	mov    %eax,%edx
+  801b61:	c1 ea 04             	shr    $0x4,%edx
+  801b64:	83 e2 0f             	and    $0xf,%edx
+  801b67:	83 fa 02             	cmp    $0x2,%edx
+  801b6a:	77 e5                	ja     801b51 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  801b6c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b6f:	83 f8 02             	cmp    $0x2,%eax
+  801b72:	0f 97 c1             	seta   %cl
+  801b75:	0f b6 c9             	movzbl %cl,%ecx
+  801b78:	eb d7                	jmp    801b51 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  801b7a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b7f:	b8 27 00 00 00       	mov    $0x27,%eax
+  801b84:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b87:	89 cb                	mov    %ecx,%ebx
+  801b89:	89 cf                	mov    %ecx,%edi
+  801b8b:	89 ce                	mov    %ecx,%esi
+  801b8d:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  801b8f:	eb 98                	jmp    801b29 <sys_sysring_setup+0x39>
+
+00801b91 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  801b91:	55                   	push   %ebp
+  801b92:	89 e5                	mov    %esp,%ebp
+  801b94:	57                   	push   %edi
+  801b95:	56                   	push   %esi
+  801b96:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801b97:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b9e:	78 2e                	js     801bce <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  801ba0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801ba7:	74 71                	je     801c1a <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  801ba9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bae:	b8 28 00 00 00       	mov    $0x28,%eax
+  801bb3:	89 d1                	mov    %edx,%ecx
+  801bb5:	89 d3                	mov    %edx,%ebx
+  801bb7:	89 d7                	mov    %edx,%edi
+  801bb9:	89 d6                	mov    %edx,%esi
+  801bbb:	55                   	push   %ebp
+  801bbc:	68 c5 1b 80 00       	push   $0x801bc5
+  801bc1:	89 e5                	mov    %esp,%ebp
+  801bc3:	0f 34                	sysenter
+  801bc5:	83 c4 04             	add    $0x4,%esp
+  801bc8:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801bc9:	5b                   	pop    %ebx
+  801bca:	5e                   	pop    %esi
+  801bcb:	5f                   	pop    %edi
+  801bcc:	5d                   	pop    %ebp
+  801bcd:	c3                   	ret
+  801bce:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bd3:	0f a2                	cpuid
+		return 0;
+  801bd5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801bda:	f6 c6 08             	test   $0x8,%dh
+  801bdd:	74 15                	je     801bf4 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bdf:	89 c2                	mov    %eax,%edx
+  801be1:	c1 ea 08             	shr    $0x8,%edx
+  801be4:	83 e2 0f             	and    $0xf,%edx
+  801be7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801bec:	83 fa 06             	cmp    $0x6,%edx
+  801bef:	74 0e                	je     801bff <sys_sysring_enter+0x6e>
+  801bf1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801bf4:	0f b6 c9             	movzbl %cl,%ecx
+  801bf7:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801bfd:	eb a1                	jmp    801ba0 <sys_sysring_enter+0xf>
+  801bff:	89 c2                	mov    %eax,%edx
+  801c01:	c1 ea 04             	shr    $0x4,%edx
+  801c04:	83 e2 0f             	and    $0xf,%edx
+  801c07:	83 fa 02             	cmp    $0x2,%edx
+  801c0a:	77 e5                	ja     801bf1 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  801c0c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c0f:	83 f8 02             	cmp    $0x2,%eax
+  801c12:	0f 97 c1             	seta   %cl
+  801c15:	0f b6 c9             	movzbl %cl,%ecx
+  801c18:	eb d7                	jmp    801bf1 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  801c1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c1f:	b8 28 00 00 00       	mov    $0x28,%eax
+  801c24:	89 d1                	mov    %edx,%ecx
+  801c26:	89 d3                	mov    %edx,%ebx
+  801c28:	89 d7                	mov    %edx,%edi
+  801c2a:	89 d6                	mov    %edx,%esi
+  801c2c:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  801c2e:	eb 99                	jmp    801bc9 <sys_sysring_enter+0x38>
+
+00801c30 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801c30:	55                   	push   %ebp
+  801c31:	89 e5                	mov    %esp,%ebp
+  801c33:	57                   	push   %edi
+  801c34:	56                   	push   %esi
+  801c35:	53                   	push   %ebx
+  801c36:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  801c3c:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  801c3f:	8b 1d 00 30 80 00    	mov    0x803000,%ebx
+  801c45:	e8 c8 e8 ff ff       	call   800512 <sys_getenvid>
+  801c4a:	83 ec 04             	sub    $0x4,%esp
+  801c4d:	ff 75 0c             	push   0xc(%ebp)
+  801c50:	ff 75 08             	push   0x8(%ebp)
+  801c53:	53                   	push   %ebx
+  801c54:	50                   	push   %eax
+  801c55:	68 18 28 80 00       	push   $0x802818
+  801c5a:	68 00 01 00 00       	push   $0x100
+  801c5f:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  801c65:	56                   	push   %esi
+  801c66:	e8 c9 05 00 00       	call   802234 <snprintf>
+  801c6b:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  801c6d:	83 c4 20             	add    $0x20,%esp
+  801c70:	57                   	push   %edi
+  801c71:	ff 75 10             	push   0x10(%ebp)
+  801c74:	bf 00 01 00 00       	mov    $0x100,%edi
+  801c79:	89 f8                	mov    %edi,%eax
+  801c7b:	29 d8                	sub    %ebx,%eax
+  801c7d:	50                   	push   %eax
+  801c7e:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801c81:	50                   	push   %eax
+  801c82:	e8 5f 05 00 00       	call   8021e6 <vsnprintf>
+  801c87:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  801c89:	83 c4 0c             	add    $0xc,%esp
+  801c8c:	68 3b 28 80 00       	push   $0x80283b
+  801c91:	29 df                	sub    %ebx,%edi
+  801c93:	57                   	push   %edi
+  801c94:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801c97:	50                   	push   %eax
+  801c98:	e8 97 05 00 00       	call   802234 <snprintf>
+	sys_cputs(buf, r);
+  801c9d:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  801ca0:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  801ca2:	53                   	push   %ebx
+  801ca3:	56                   	push   %esi
+  801ca4:	e8 6b e6 ff ff       	call   800314 <sys_cputs>
+  801ca9:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801cac:	cc                   	int3
+	while (1)
+  801cad:	eb fd                	jmp    801cac <_panic+0x7c>
+
+00801caf <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801caf:	55                   	push   %ebp
+  801cb0:	89 e5                	mov    %esp,%ebp
+  801cb2:	57                   	push   %edi
+  801cb3:	56                   	push   %esi
+  801cb4:	53                   	push   %ebx
+  801cb5:	83 ec 1c             	sub    $0x1c,%esp
+  801cb8:	89 c7                	mov    %eax,%edi
+  801cba:	89 d6                	mov    %edx,%esi
+  801cbc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cbf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801cc2:	89 d1                	mov    %edx,%ecx
+  801cc4:	89 c2                	mov    %eax,%edx
+  801cc6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801cc9:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801ccc:	8b 45 10             	mov    0x10(%ebp),%eax
+  801ccf:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  801cd2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801cd5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801cdc:	39 c2                	cmp    %eax,%edx
+  801cde:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  801ce1:	72 3e                	jb     801d21 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801ce3:	83 ec 0c             	sub    $0xc,%esp
+  801ce6:	ff 75 18             	push   0x18(%ebp)
+  801ce9:	83 eb 01             	sub    $0x1,%ebx
+  801cec:	53                   	push   %ebx
+  801ced:	50                   	push   %eax
+  801cee:	83 ec 08             	sub    $0x8,%esp
+  801cf1:	ff 75 e4             	push   -0x1c(%ebp)
+  801cf4:	ff 75 e0             	push   -0x20(%ebp)
+  801cf7:	ff 75 dc             	push   -0x24(%ebp)
+  801cfa:	ff 75 d8             	push   -0x28(%ebp)
+  801cfd:	e8 9a 09 00 00       	call   80269c <__udivdi3>
+  801d02:	83 c4 18             	add    $0x18,%esp
+  801d05:	52                   	push   %edx
+  801d06:	50                   	push   %eax
+  801d07:	89 f2                	mov    %esi,%edx
+  801d09:	89 f8                	mov    %edi,%eax
+  801d0b:	e8 9f ff ff ff       	call   801caf <printnum>
+  801d10:	83 c4 20             	add    $0x20,%esp
+  801d13:	eb 13                	jmp    801d28 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  801d15:	83 ec 08             	sub    $0x8,%esp
+  801d18:	56                   	push   %esi
+  801d19:	ff 75 18             	push   0x18(%ebp)
+  801d1c:	ff d7                	call   *%edi
+  801d1e:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  801d21:	83 eb 01             	sub    $0x1,%ebx
+  801d24:	85 db                	test   %ebx,%ebx
+  801d26:	7f ed                	jg     801d15 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  801d28:	83 ec 08             	sub    $0x8,%esp
+  801d2b:	56                   	push   %esi
+  801d2c:	83 ec 04             	sub    $0x4,%esp
+  801d2f:	ff 75 e4             	push   -0x1c(%ebp)
+  801d32:	ff 75 e0             	push   -0x20(%ebp)
+  801d35:	ff 75 dc             	push   -0x24(%ebp)
+  801d38:	ff 75 d8             	push   -0x28(%ebp)
+  801d3b:	e8 7a 09 00 00       	call   8026ba <__umoddi3>
+  801d40:	83 c4 14             	add    $0x14,%esp
+  801d43:	0f be 80 3d 28 80 00 	movsbl 0x80283d(%eax),%eax
+  801d4a:	50                   	push   %eax
+  801d4b:	ff d7                	call   *%edi
+}
+  801d4d:	83 c4 10             	add    $0x10,%esp
+  801d50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d53:	5b                   	pop    %ebx
+  801d54:	5e                   	pop    %esi
+  801d55:	5f                   	pop    %edi
+  801d56:	5d                   	pop    %ebp
+  801d57:	c3                   	ret
+
+00801d58 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801d58:	55                   	push   %ebp
+  801d59:	89 e5                	mov    %esp,%ebp
+  801d5b:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  801d5e:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  801d62:	8b 10                	mov    (%eax),%edx
+  801d64:	3b 50 04             	cmp    0x4(%eax),%edx
+  801d67:	73 0a                	jae    801d73 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  801d69:	8d 4a 01             	lea    0x1(%edx),%ecx
+  801d6c:	89 08                	mov    %ecx,(%eax)
+  801d6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d71:	88 02                	mov    %al,(%edx)
+}
+  801d73:	5d                   	pop    %ebp
+  801d74:	c3                   	ret
+
+00801d75 <printfmt>:
+{
+  801d75:	55                   	push   %ebp
+  801d76:	89 e5                	mov    %esp,%ebp
+  801d78:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  801d7b:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  801d7e:	50                   	push   %eax
+  801d7f:	ff 75 10             	push   0x10(%ebp)
+  801d82:	ff 75 0c             	push   0xc(%ebp)
+  801d85:	ff 75 08             	push   0x8(%ebp)
+  801d88:	e8 05 00 00 00       	call   801d92 <vprintfmt>
+}
+  801d8d:	83 c4 10             	add    $0x10,%esp
+  801d90:	c9                   	leave
+  801d91:	c3                   	ret
+
+00801d92 <vprintfmt>:
+{
+  801d92:	55                   	push   %ebp
+  801d93:	89 e5                	mov    %esp,%ebp
+  801d95:	57                   	push   %edi
+  801d96:	56                   	push   %esi
+  801d97:	53                   	push   %ebx
+  801d98:	83 ec 2c             	sub    $0x2c,%esp
+  801d9b:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d9e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801da1:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801da4:	eb 0a                	jmp    801db0 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  801da6:	83 ec 08             	sub    $0x8,%esp
+  801da9:	53                   	push   %ebx
+  801daa:	50                   	push   %eax
+  801dab:	ff d6                	call   *%esi
+  801dad:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801db0:	83 c7 01             	add    $0x1,%edi
+  801db3:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801db7:	83 f8 25             	cmp    $0x25,%eax
+  801dba:	74 0c                	je     801dc8 <vprintfmt+0x36>
+			if (ch == '\0')
+  801dbc:	85 c0                	test   %eax,%eax
+  801dbe:	75 e6                	jne    801da6 <vprintfmt+0x14>
+}
+  801dc0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dc3:	5b                   	pop    %ebx
+  801dc4:	5e                   	pop    %esi
+  801dc5:	5f                   	pop    %edi
+  801dc6:	5d                   	pop    %ebp
+  801dc7:	c3                   	ret
+		padc = ' ';
+  801dc8:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801dcc:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  801dd3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801dda:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  801de1:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801de6:	8d 47 01             	lea    0x1(%edi),%eax
+  801de9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801dec:	0f b6 17             	movzbl (%edi),%edx
+  801def:	8d 42 dd             	lea    -0x23(%edx),%eax
+  801df2:	3c 55                	cmp    $0x55,%al
+  801df4:	0f 87 cf 03 00 00    	ja     8021c9 <vprintfmt+0x437>
+  801dfa:	0f b6 c0             	movzbl %al,%eax
+  801dfd:	ff 24 85 20 29 80 00 	jmp    *0x802920(,%eax,4)
+  801e04:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801e07:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801e0b:	eb d9                	jmp    801de6 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801e0d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801e10:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  801e14:	eb d0                	jmp    801de6 <vprintfmt+0x54>
+  801e16:	0f b6 d2             	movzbl %dl,%edx
+  801e19:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  801e1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e21:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  801e24:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801e27:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  801e2b:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  801e2e:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  801e31:	83 f9 09             	cmp    $0x9,%ecx
+  801e34:	77 55                	ja     801e8b <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  801e36:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  801e39:	eb e9                	jmp    801e24 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  801e3b:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e3e:	8b 00                	mov    (%eax),%eax
+  801e40:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801e43:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e46:	8d 40 04             	lea    0x4(%eax),%eax
+  801e49:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801e4c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  801e4f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801e53:	79 91                	jns    801de6 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  801e55:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801e58:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801e5b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  801e62:	eb 82                	jmp    801de6 <vprintfmt+0x54>
+			if (width < 0)
+  801e64:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801e67:	85 d2                	test   %edx,%edx
+  801e69:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e6e:	0f 49 c2             	cmovns %edx,%eax
+  801e71:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801e74:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801e77:	e9 6a ff ff ff       	jmp    801de6 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801e7c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  801e7f:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  801e86:	e9 5b ff ff ff       	jmp    801de6 <vprintfmt+0x54>
+  801e8b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801e8e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801e91:	eb bc                	jmp    801e4f <vprintfmt+0xbd>
+			lflag++;
+  801e93:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801e96:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801e99:	e9 48 ff ff ff       	jmp    801de6 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  801e9e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ea1:	8d 78 04             	lea    0x4(%eax),%edi
+  801ea4:	83 ec 08             	sub    $0x8,%esp
+  801ea7:	53                   	push   %ebx
+  801ea8:	ff 30                	push   (%eax)
+  801eaa:	ff d6                	call   *%esi
+			break;
+  801eac:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801eaf:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  801eb2:	e9 b1 02 00 00       	jmp    802168 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  801eb7:	8b 45 14             	mov    0x14(%ebp),%eax
+  801eba:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801ebd:	8b 10                	mov    (%eax),%edx
+  801ebf:	89 d0                	mov    %edx,%eax
+  801ec1:	f7 d8                	neg    %eax
+  801ec3:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801ec6:	83 f8 0d             	cmp    $0xd,%eax
+  801ec9:	7f 23                	jg     801eee <vprintfmt+0x15c>
+  801ecb:	8b 14 85 80 2a 80 00 	mov    0x802a80(,%eax,4),%edx
+  801ed2:	85 d2                	test   %edx,%edx
+  801ed4:	74 18                	je     801eee <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801ed6:	52                   	push   %edx
+  801ed7:	68 5e 28 80 00       	push   $0x80285e
+  801edc:	53                   	push   %ebx
+  801edd:	56                   	push   %esi
+  801ede:	e8 92 fe ff ff       	call   801d75 <printfmt>
+  801ee3:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801ee6:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801ee9:	e9 7a 02 00 00       	jmp    802168 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  801eee:	50                   	push   %eax
+  801eef:	68 55 28 80 00       	push   $0x802855
+  801ef4:	53                   	push   %ebx
+  801ef5:	56                   	push   %esi
+  801ef6:	e8 7a fe ff ff       	call   801d75 <printfmt>
+  801efb:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801efe:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801f01:	e9 62 02 00 00       	jmp    802168 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801f06:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f09:	83 c0 04             	add    $0x4,%eax
+  801f0c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801f0f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f12:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801f14:	85 c9                	test   %ecx,%ecx
+  801f16:	b8 4e 28 80 00       	mov    $0x80284e,%eax
+  801f1b:	0f 45 c1             	cmovne %ecx,%eax
+  801f1e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801f21:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801f25:	7e 06                	jle    801f2d <vprintfmt+0x19b>
+  801f27:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801f2b:	75 0b                	jne    801f38 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f2d:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801f30:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801f33:	89 75 08             	mov    %esi,0x8(%ebp)
+  801f36:	eb 5c                	jmp    801f94 <vprintfmt+0x202>
+  801f38:	83 ec 08             	sub    $0x8,%esp
+  801f3b:	ff 75 d0             	push   -0x30(%ebp)
+  801f3e:	ff 75 cc             	push   -0x34(%ebp)
+  801f41:	e8 20 03 00 00       	call   802266 <strnlen>
+  801f46:	89 c2                	mov    %eax,%edx
+  801f48:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f4b:	29 d0                	sub    %edx,%eax
+  801f4d:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801f50:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  801f54:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801f57:	89 75 08             	mov    %esi,0x8(%ebp)
+  801f5a:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f5c:	eb 0e                	jmp    801f6c <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801f5e:	83 ec 08             	sub    $0x8,%esp
+  801f61:	53                   	push   %ebx
+  801f62:	57                   	push   %edi
+  801f63:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f66:	83 ee 01             	sub    $0x1,%esi
+  801f69:	83 c4 10             	add    $0x10,%esp
+  801f6c:	85 f6                	test   %esi,%esi
+  801f6e:	7f ee                	jg     801f5e <vprintfmt+0x1cc>
+  801f70:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f73:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f76:	85 c0                	test   %eax,%eax
+  801f78:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f7d:	0f 49 d0             	cmovns %eax,%edx
+  801f80:	29 d0                	sub    %edx,%eax
+  801f82:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801f85:	eb a6                	jmp    801f2d <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801f87:	83 ec 08             	sub    $0x8,%esp
+  801f8a:	53                   	push   %ebx
+  801f8b:	52                   	push   %edx
+  801f8c:	ff 55 08             	call   *0x8(%ebp)
+  801f8f:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801f92:	89 f1                	mov    %esi,%ecx
+  801f94:	8d 71 01             	lea    0x1(%ecx),%esi
+  801f97:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801f9b:	0f be d0             	movsbl %al,%edx
+  801f9e:	85 d2                	test   %edx,%edx
+  801fa0:	74 28                	je     801fca <vprintfmt+0x238>
+  801fa2:	85 ff                	test   %edi,%edi
+  801fa4:	78 05                	js     801fab <vprintfmt+0x219>
+  801fa6:	83 ef 01             	sub    $0x1,%edi
+  801fa9:	78 30                	js     801fdb <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801fab:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801faf:	74 d6                	je     801f87 <vprintfmt+0x1f5>
+  801fb1:	0f be c0             	movsbl %al,%eax
+  801fb4:	83 e8 20             	sub    $0x20,%eax
+  801fb7:	83 f8 5e             	cmp    $0x5e,%eax
+  801fba:	76 cb                	jbe    801f87 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801fbc:	83 ec 08             	sub    $0x8,%esp
+  801fbf:	53                   	push   %ebx
+  801fc0:	6a 3f                	push   $0x3f
+  801fc2:	ff 55 08             	call   *0x8(%ebp)
+  801fc5:	83 c4 10             	add    $0x10,%esp
+  801fc8:	eb c8                	jmp    801f92 <vprintfmt+0x200>
+  801fca:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fcd:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801fd0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801fd3:	01 d0                	add    %edx,%eax
+  801fd5:	29 c8                	sub    %ecx,%eax
+  801fd7:	89 c7                	mov    %eax,%edi
+  801fd9:	eb 13                	jmp    801fee <vprintfmt+0x25c>
+  801fdb:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fde:	eb ed                	jmp    801fcd <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801fe0:	83 ec 08             	sub    $0x8,%esp
+  801fe3:	53                   	push   %ebx
+  801fe4:	6a 20                	push   $0x20
+  801fe6:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801fe8:	83 ef 01             	sub    $0x1,%edi
+  801feb:	83 c4 10             	add    $0x10,%esp
+  801fee:	85 ff                	test   %edi,%edi
+  801ff0:	7f ee                	jg     801fe0 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801ff2:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801ff5:	89 45 14             	mov    %eax,0x14(%ebp)
+  801ff8:	e9 6b 01 00 00       	jmp    802168 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  801ffd:	83 f9 01             	cmp    $0x1,%ecx
+  802000:	7f 1f                	jg     802021 <vprintfmt+0x28f>
+	else if (lflag)
+  802002:	85 c9                	test   %ecx,%ecx
+  802004:	74 67                	je     80206d <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  802006:	8b 45 14             	mov    0x14(%ebp),%eax
+  802009:	8b 00                	mov    (%eax),%eax
+  80200b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80200e:	89 c1                	mov    %eax,%ecx
+  802010:	c1 f9 1f             	sar    $0x1f,%ecx
+  802013:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802016:	8b 45 14             	mov    0x14(%ebp),%eax
+  802019:	8d 40 04             	lea    0x4(%eax),%eax
+  80201c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80201f:	eb 17                	jmp    802038 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  802021:	8b 45 14             	mov    0x14(%ebp),%eax
+  802024:	8b 50 04             	mov    0x4(%eax),%edx
+  802027:	8b 00                	mov    (%eax),%eax
+  802029:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80202c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80202f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802032:	8d 40 08             	lea    0x8(%eax),%eax
+  802035:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  802038:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80203b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80203e:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  802043:	85 c9                	test   %ecx,%ecx
+  802045:	0f 89 03 01 00 00    	jns    80214e <vprintfmt+0x3bc>
+				putch('-', putdat);
+  80204b:	83 ec 08             	sub    $0x8,%esp
+  80204e:	53                   	push   %ebx
+  80204f:	6a 2d                	push   $0x2d
+  802051:	ff d6                	call   *%esi
+				num = -(long long) num;
+  802053:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802056:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802059:	f7 da                	neg    %edx
+  80205b:	83 d1 00             	adc    $0x0,%ecx
+  80205e:	f7 d9                	neg    %ecx
+  802060:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  802063:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802068:	e9 e1 00 00 00       	jmp    80214e <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80206d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802070:	8b 00                	mov    (%eax),%eax
+  802072:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802075:	89 c1                	mov    %eax,%ecx
+  802077:	c1 f9 1f             	sar    $0x1f,%ecx
+  80207a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80207d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802080:	8d 40 04             	lea    0x4(%eax),%eax
+  802083:	89 45 14             	mov    %eax,0x14(%ebp)
+  802086:	eb b0                	jmp    802038 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  802088:	83 f9 01             	cmp    $0x1,%ecx
+  80208b:	7f 1e                	jg     8020ab <vprintfmt+0x319>
+	else if (lflag)
+  80208d:	85 c9                	test   %ecx,%ecx
+  80208f:	74 32                	je     8020c3 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  802091:	8b 45 14             	mov    0x14(%ebp),%eax
+  802094:	8b 10                	mov    (%eax),%edx
+  802096:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80209b:	8d 40 04             	lea    0x4(%eax),%eax
+  80209e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8020a1:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8020a6:	e9 a3 00 00 00       	jmp    80214e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8020ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020ae:	8b 10                	mov    (%eax),%edx
+  8020b0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8020b3:	8d 40 08             	lea    0x8(%eax),%eax
+  8020b6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8020b9:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8020be:	e9 8b 00 00 00       	jmp    80214e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8020c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020c6:	8b 10                	mov    (%eax),%edx
+  8020c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020cd:	8d 40 04             	lea    0x4(%eax),%eax
+  8020d0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8020d3:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8020d8:	eb 74                	jmp    80214e <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8020da:	83 f9 01             	cmp    $0x1,%ecx
+  8020dd:	7f 1b                	jg     8020fa <vprintfmt+0x368>
+	else if (lflag)
+  8020df:	85 c9                	test   %ecx,%ecx
+  8020e1:	74 2c                	je     80210f <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8020e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020e6:	8b 10                	mov    (%eax),%edx
+  8020e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020ed:	8d 40 04             	lea    0x4(%eax),%eax
+  8020f0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8020f3:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8020f8:	eb 54                	jmp    80214e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8020fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020fd:	8b 10                	mov    (%eax),%edx
+  8020ff:	8b 48 04             	mov    0x4(%eax),%ecx
+  802102:	8d 40 08             	lea    0x8(%eax),%eax
+  802105:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802108:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80210d:	eb 3f                	jmp    80214e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80210f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802112:	8b 10                	mov    (%eax),%edx
+  802114:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802119:	8d 40 04             	lea    0x4(%eax),%eax
+  80211c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80211f:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  802124:	eb 28                	jmp    80214e <vprintfmt+0x3bc>
+			putch('0', putdat);
+  802126:	83 ec 08             	sub    $0x8,%esp
+  802129:	53                   	push   %ebx
+  80212a:	6a 30                	push   $0x30
+  80212c:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80212e:	83 c4 08             	add    $0x8,%esp
+  802131:	53                   	push   %ebx
+  802132:	6a 78                	push   $0x78
+  802134:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  802136:	8b 45 14             	mov    0x14(%ebp),%eax
+  802139:	8b 10                	mov    (%eax),%edx
+  80213b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  802140:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  802143:	8d 40 04             	lea    0x4(%eax),%eax
+  802146:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802149:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80214e:	83 ec 0c             	sub    $0xc,%esp
+  802151:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  802155:	50                   	push   %eax
+  802156:	ff 75 e0             	push   -0x20(%ebp)
+  802159:	57                   	push   %edi
+  80215a:	51                   	push   %ecx
+  80215b:	52                   	push   %edx
+  80215c:	89 da                	mov    %ebx,%edx
+  80215e:	89 f0                	mov    %esi,%eax
+  802160:	e8 4a fb ff ff       	call   801caf <printnum>
+			break;
+  802165:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  802168:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80216b:	e9 40 fc ff ff       	jmp    801db0 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  802170:	83 f9 01             	cmp    $0x1,%ecx
+  802173:	7f 1b                	jg     802190 <vprintfmt+0x3fe>
+	else if (lflag)
+  802175:	85 c9                	test   %ecx,%ecx
+  802177:	74 2c                	je     8021a5 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  802179:	8b 45 14             	mov    0x14(%ebp),%eax
+  80217c:	8b 10                	mov    (%eax),%edx
+  80217e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802183:	8d 40 04             	lea    0x4(%eax),%eax
+  802186:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802189:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80218e:	eb be                	jmp    80214e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802190:	8b 45 14             	mov    0x14(%ebp),%eax
+  802193:	8b 10                	mov    (%eax),%edx
+  802195:	8b 48 04             	mov    0x4(%eax),%ecx
+  802198:	8d 40 08             	lea    0x8(%eax),%eax
+  80219b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80219e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8021a3:	eb a9                	jmp    80214e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8021a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8021a8:	8b 10                	mov    (%eax),%edx
+  8021aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021af:	8d 40 04             	lea    0x4(%eax),%eax
+  8021b2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8021b5:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8021ba:	eb 92                	jmp    80214e <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8021bc:	83 ec 08             	sub    $0x8,%esp
+  8021bf:	53                   	push   %ebx
+  8021c0:	6a 25                	push   $0x25
+  8021c2:	ff d6                	call   *%esi
+			break;
+  8021c4:	83 c4 10             	add    $0x10,%esp
+  8021c7:	eb 9f                	jmp    802168 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8021c9:	83 ec 08             	sub    $0x8,%esp
+  8021cc:	53                   	push   %ebx
+  8021cd:	6a 25                	push   $0x25
+  8021cf:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8021d1:	83 c4 10             	add    $0x10,%esp
+  8021d4:	89 f8                	mov    %edi,%eax
+  8021d6:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8021da:	74 05                	je     8021e1 <vprintfmt+0x44f>
+  8021dc:	83 e8 01             	sub    $0x1,%eax
+  8021df:	eb f5                	jmp    8021d6 <vprintfmt+0x444>
+  8021e1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8021e4:	eb 82                	jmp    802168 <vprintfmt+0x3d6>
+
+008021e6 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8021e6:	55                   	push   %ebp
+  8021e7:	89 e5                	mov    %esp,%ebp
+  8021e9:	83 ec 18             	sub    $0x18,%esp
+  8021ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021ef:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8021f2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8021f5:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8021f9:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8021fc:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  802203:	85 c0                	test   %eax,%eax
+  802205:	74 26                	je     80222d <vsnprintf+0x47>
+  802207:	85 d2                	test   %edx,%edx
+  802209:	7e 22                	jle    80222d <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80220b:	ff 75 14             	push   0x14(%ebp)
+  80220e:	ff 75 10             	push   0x10(%ebp)
+  802211:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  802214:	50                   	push   %eax
+  802215:	68 58 1d 80 00       	push   $0x801d58
+  80221a:	e8 73 fb ff ff       	call   801d92 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80221f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802222:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  802225:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802228:	83 c4 10             	add    $0x10,%esp
+}
+  80222b:	c9                   	leave
+  80222c:	c3                   	ret
+		return -E_INVAL;
+  80222d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802232:	eb f7                	jmp    80222b <vsnprintf+0x45>
+
+00802234 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  802234:	55                   	push   %ebp
+  802235:	89 e5                	mov    %esp,%ebp
+  802237:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80223a:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80223d:	50                   	push   %eax
+  80223e:	ff 75 10             	push   0x10(%ebp)
+  802241:	ff 75 0c             	push   0xc(%ebp)
+  802244:	ff 75 08             	push   0x8(%ebp)
+  802247:	e8 9a ff ff ff       	call   8021e6 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80224c:	c9                   	leave
+  80224d:	c3                   	ret
+
+0080224e <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80224e:	55                   	push   %ebp
+  80224f:	89 e5                	mov    %esp,%ebp
+  802251:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  802254:	b8 00 00 00 00       	mov    $0x0,%eax
+  802259:	eb 03                	jmp    80225e <strlen+0x10>
+		n++;
+  80225b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80225e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802262:	75 f7                	jne    80225b <strlen+0xd>
+	return n;
+}
+  802264:	5d                   	pop    %ebp
+  802265:	c3                   	ret
+
+00802266 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  802266:	55                   	push   %ebp
+  802267:	89 e5                	mov    %esp,%ebp
+  802269:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80226c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80226f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802274:	eb 03                	jmp    802279 <strnlen+0x13>
+		n++;
+  802276:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802279:	39 d0                	cmp    %edx,%eax
+  80227b:	74 08                	je     802285 <strnlen+0x1f>
+  80227d:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802281:	75 f3                	jne    802276 <strnlen+0x10>
+  802283:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  802285:	89 d0                	mov    %edx,%eax
+  802287:	5d                   	pop    %ebp
+  802288:	c3                   	ret
+
+00802289 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  802289:	55                   	push   %ebp
+  80228a:	89 e5                	mov    %esp,%ebp
+  80228c:	53                   	push   %ebx
+  80228d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802290:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  802293:	b8 00 00 00 00       	mov    $0x0,%eax
+  802298:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80229c:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80229f:	83 c0 01             	add    $0x1,%eax
+  8022a2:	84 d2                	test   %dl,%dl
+  8022a4:	75 f2                	jne    802298 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8022a6:	89 c8                	mov    %ecx,%eax
+  8022a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022ab:	c9                   	leave
+  8022ac:	c3                   	ret
+
+008022ad <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8022ad:	55                   	push   %ebp
+  8022ae:	89 e5                	mov    %esp,%ebp
+  8022b0:	53                   	push   %ebx
+  8022b1:	83 ec 10             	sub    $0x10,%esp
+  8022b4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8022b7:	53                   	push   %ebx
+  8022b8:	e8 91 ff ff ff       	call   80224e <strlen>
+  8022bd:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8022c0:	ff 75 0c             	push   0xc(%ebp)
+  8022c3:	01 d8                	add    %ebx,%eax
+  8022c5:	50                   	push   %eax
+  8022c6:	e8 be ff ff ff       	call   802289 <strcpy>
+	return dst;
+}
+  8022cb:	89 d8                	mov    %ebx,%eax
+  8022cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022d0:	c9                   	leave
+  8022d1:	c3                   	ret
+
+008022d2 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8022d2:	55                   	push   %ebp
+  8022d3:	89 e5                	mov    %esp,%ebp
+  8022d5:	56                   	push   %esi
+  8022d6:	53                   	push   %ebx
+  8022d7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8022da:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8022dd:	89 f3                	mov    %esi,%ebx
+  8022df:	03 5d 10             	add    0x10(%ebp),%ebx
+  8022e2:	89 f0                	mov    %esi,%eax
+  8022e4:	eb 0f                	jmp    8022f5 <strncpy+0x23>
+		*dst++ = *src;
+  8022e6:	83 c0 01             	add    $0x1,%eax
+  8022e9:	0f b6 0a             	movzbl (%edx),%ecx
+  8022ec:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8022ef:	80 f9 01             	cmp    $0x1,%cl
+  8022f2:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8022f5:	39 d8                	cmp    %ebx,%eax
+  8022f7:	75 ed                	jne    8022e6 <strncpy+0x14>
+	}
+	return ret;
+}
+  8022f9:	89 f0                	mov    %esi,%eax
+  8022fb:	5b                   	pop    %ebx
+  8022fc:	5e                   	pop    %esi
+  8022fd:	5d                   	pop    %ebp
+  8022fe:	c3                   	ret
+
+008022ff <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8022ff:	55                   	push   %ebp
+  802300:	89 e5                	mov    %esp,%ebp
+  802302:	56                   	push   %esi
+  802303:	53                   	push   %ebx
+  802304:	8b 75 08             	mov    0x8(%ebp),%esi
+  802307:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80230a:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80230d:	89 f0                	mov    %esi,%eax
+  80230f:	85 d2                	test   %edx,%edx
+  802311:	74 21                	je     802334 <strlcpy+0x35>
+  802313:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  802317:	89 f2                	mov    %esi,%edx
+  802319:	eb 09                	jmp    802324 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80231b:	83 c1 01             	add    $0x1,%ecx
+  80231e:	83 c2 01             	add    $0x1,%edx
+  802321:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  802324:	39 c2                	cmp    %eax,%edx
+  802326:	74 09                	je     802331 <strlcpy+0x32>
+  802328:	0f b6 19             	movzbl (%ecx),%ebx
+  80232b:	84 db                	test   %bl,%bl
+  80232d:	75 ec                	jne    80231b <strlcpy+0x1c>
+  80232f:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  802331:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  802334:	29 f0                	sub    %esi,%eax
+}
+  802336:	5b                   	pop    %ebx
+  802337:	5e                   	pop    %esi
+  802338:	5d                   	pop    %ebp
+  802339:	c3                   	ret
+
+0080233a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80233a:	55                   	push   %ebp
+  80233b:	89 e5                	mov    %esp,%ebp
+  80233d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802340:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  802343:	eb 06                	jmp    80234b <strcmp+0x11>
+		p++, q++;
+  802345:	83 c1 01             	add    $0x1,%ecx
+  802348:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80234b:	0f b6 01             	movzbl (%ecx),%eax
+  80234e:	84 c0                	test   %al,%al
+  802350:	74 04                	je     802356 <strcmp+0x1c>
+  802352:	3a 02                	cmp    (%edx),%al
+  802354:	74 ef                	je     802345 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  802356:	0f b6 c0             	movzbl %al,%eax
+  802359:	0f b6 12             	movzbl (%edx),%edx
+  80235c:	29 d0                	sub    %edx,%eax
+}
+  80235e:	5d                   	pop    %ebp
+  80235f:	c3                   	ret
+
+00802360 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  802360:	55                   	push   %ebp
+  802361:	89 e5                	mov    %esp,%ebp
+  802363:	53                   	push   %ebx
+  802364:	8b 45 08             	mov    0x8(%ebp),%eax
+  802367:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80236a:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80236d:	eb 09                	jmp    802378 <strncmp+0x18>
+		n--, p++, q++;
+  80236f:	83 ea 01             	sub    $0x1,%edx
+  802372:	83 c0 01             	add    $0x1,%eax
+  802375:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  802378:	85 d2                	test   %edx,%edx
+  80237a:	74 18                	je     802394 <strncmp+0x34>
+  80237c:	0f b6 18             	movzbl (%eax),%ebx
+  80237f:	84 db                	test   %bl,%bl
+  802381:	74 04                	je     802387 <strncmp+0x27>
+  802383:	3a 19                	cmp    (%ecx),%bl
+  802385:	74 e8                	je     80236f <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  802387:	0f b6 00             	movzbl (%eax),%eax
+  80238a:	0f b6 11             	movzbl (%ecx),%edx
+  80238d:	29 d0                	sub    %edx,%eax
+}
+  80238f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802392:	c9                   	leave
+  802393:	c3                   	ret
+		return 0;
+  802394:	b8 00 00 00 00       	mov    $0x0,%eax
+  802399:	eb f4                	jmp    80238f <strncmp+0x2f>
+
+0080239b <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80239b:	55                   	push   %ebp
+  80239c:	89 e5                	mov    %esp,%ebp
+  80239e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023a1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8023a5:	eb 03                	jmp    8023aa <strchr+0xf>
+  8023a7:	83 c0 01             	add    $0x1,%eax
+  8023aa:	0f b6 10             	movzbl (%eax),%edx
+  8023ad:	84 d2                	test   %dl,%dl
+  8023af:	74 06                	je     8023b7 <strchr+0x1c>
+		if (*s == c)
+  8023b1:	38 ca                	cmp    %cl,%dl
+  8023b3:	75 f2                	jne    8023a7 <strchr+0xc>
+  8023b5:	eb 05                	jmp    8023bc <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8023b7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023bc:	5d                   	pop    %ebp
+  8023bd:	c3                   	ret
+
+008023be <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8023be:	55                   	push   %ebp
+  8023bf:	89 e5                	mov    %esp,%ebp
+  8023c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023c4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8023c8:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8023cb:	38 ca                	cmp    %cl,%dl
+  8023cd:	74 09                	je     8023d8 <strfind+0x1a>
+  8023cf:	84 d2                	test   %dl,%dl
+  8023d1:	74 05                	je     8023d8 <strfind+0x1a>
+	for (; *s; s++)
+  8023d3:	83 c0 01             	add    $0x1,%eax
+  8023d6:	eb f0                	jmp    8023c8 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8023d8:	5d                   	pop    %ebp
+  8023d9:	c3                   	ret
+
+008023da <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8023da:	55                   	push   %ebp
+  8023db:	89 e5                	mov    %esp,%ebp
+  8023dd:	57                   	push   %edi
+  8023de:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8023e1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8023e4:	85 c9                	test   %ecx,%ecx
+  8023e6:	74 20                	je     802408 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8023e8:	89 f8                	mov    %edi,%eax
+  8023ea:	09 c8                	or     %ecx,%eax
+  8023ec:	a8 03                	test   $0x3,%al
+  8023ee:	75 12                	jne    802402 <memset+0x28>
+		c &= 0xFF;
+  8023f0:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8023f4:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8023fa:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8023fd:	fc                   	cld
+  8023fe:	f3 ab                	rep stos %eax,%es:(%edi)
+  802400:	eb 06                	jmp    802408 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  802402:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802405:	fc                   	cld
+  802406:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  802408:	89 f8                	mov    %edi,%eax
+  80240a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80240d:	c9                   	leave
+  80240e:	c3                   	ret
+
+0080240f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80240f:	55                   	push   %ebp
+  802410:	89 e5                	mov    %esp,%ebp
+  802412:	57                   	push   %edi
+  802413:	56                   	push   %esi
+  802414:	8b 45 08             	mov    0x8(%ebp),%eax
+  802417:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80241a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80241d:	39 c6                	cmp    %eax,%esi
+  80241f:	73 32                	jae    802453 <memmove+0x44>
+  802421:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  802424:	39 d0                	cmp    %edx,%eax
+  802426:	73 2b                	jae    802453 <memmove+0x44>
+		s += n;
+		d += n;
+  802428:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80242b:	89 d6                	mov    %edx,%esi
+  80242d:	09 fe                	or     %edi,%esi
+  80242f:	09 ce                	or     %ecx,%esi
+  802431:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  802437:	75 0e                	jne    802447 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  802439:	83 ef 04             	sub    $0x4,%edi
+  80243c:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80243f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  802442:	fd                   	std
+  802443:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802445:	eb 09                	jmp    802450 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  802447:	83 ef 01             	sub    $0x1,%edi
+  80244a:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80244d:	fd                   	std
+  80244e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  802450:	fc                   	cld
+  802451:	eb 1a                	jmp    80246d <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802453:	89 f2                	mov    %esi,%edx
+  802455:	09 c2                	or     %eax,%edx
+  802457:	09 ca                	or     %ecx,%edx
+  802459:	f6 c2 03             	test   $0x3,%dl
+  80245c:	75 0a                	jne    802468 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80245e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  802461:	89 c7                	mov    %eax,%edi
+  802463:	fc                   	cld
+  802464:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802466:	eb 05                	jmp    80246d <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  802468:	89 c7                	mov    %eax,%edi
+  80246a:	fc                   	cld
+  80246b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80246d:	5e                   	pop    %esi
+  80246e:	5f                   	pop    %edi
+  80246f:	5d                   	pop    %ebp
+  802470:	c3                   	ret
+
+00802471 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  802471:	55                   	push   %ebp
+  802472:	89 e5                	mov    %esp,%ebp
+  802474:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  802477:	ff 75 10             	push   0x10(%ebp)
+  80247a:	ff 75 0c             	push   0xc(%ebp)
+  80247d:	ff 75 08             	push   0x8(%ebp)
+  802480:	e8 8a ff ff ff       	call   80240f <memmove>
+}
+  802485:	c9                   	leave
+  802486:	c3                   	ret
+
+00802487 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  802487:	55                   	push   %ebp
+  802488:	89 e5                	mov    %esp,%ebp
+  80248a:	56                   	push   %esi
+  80248b:	53                   	push   %ebx
+  80248c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80248f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  802492:	89 c6                	mov    %eax,%esi
+  802494:	03 75 10             	add    0x10(%ebp),%esi
+  802497:	eb 06                	jmp    80249f <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  802499:	83 c0 01             	add    $0x1,%eax
+  80249c:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  80249f:	39 f0                	cmp    %esi,%eax
+  8024a1:	74 14                	je     8024b7 <memcmp+0x30>
+		if (*s1 != *s2)
+  8024a3:	0f b6 08             	movzbl (%eax),%ecx
+  8024a6:	0f b6 1a             	movzbl (%edx),%ebx
+  8024a9:	38 d9                	cmp    %bl,%cl
+  8024ab:	74 ec                	je     802499 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8024ad:	0f b6 c1             	movzbl %cl,%eax
+  8024b0:	0f b6 db             	movzbl %bl,%ebx
+  8024b3:	29 d8                	sub    %ebx,%eax
+  8024b5:	eb 05                	jmp    8024bc <memcmp+0x35>
+	}
+
+	return 0;
+  8024b7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024bc:	5b                   	pop    %ebx
+  8024bd:	5e                   	pop    %esi
+  8024be:	5d                   	pop    %ebp
+  8024bf:	c3                   	ret
+
+008024c0 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8024c0:	55                   	push   %ebp
+  8024c1:	89 e5                	mov    %esp,%ebp
+  8024c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8024c9:	89 c2                	mov    %eax,%edx
+  8024cb:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8024ce:	eb 03                	jmp    8024d3 <memfind+0x13>
+  8024d0:	83 c0 01             	add    $0x1,%eax
+  8024d3:	39 d0                	cmp    %edx,%eax
+  8024d5:	73 04                	jae    8024db <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8024d7:	38 08                	cmp    %cl,(%eax)
+  8024d9:	75 f5                	jne    8024d0 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8024db:	5d                   	pop    %ebp
+  8024dc:	c3                   	ret
+
+008024dd <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8024dd:	55                   	push   %ebp
+  8024de:	89 e5                	mov    %esp,%ebp
+  8024e0:	57                   	push   %edi
+  8024e1:	56                   	push   %esi
+  8024e2:	53                   	push   %ebx
+  8024e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024e6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8024e9:	eb 03                	jmp    8024ee <strtol+0x11>
+		s++;
+  8024eb:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8024ee:	0f b6 02             	movzbl (%edx),%eax
+  8024f1:	3c 20                	cmp    $0x20,%al
+  8024f3:	74 f6                	je     8024eb <strtol+0xe>
+  8024f5:	3c 09                	cmp    $0x9,%al
+  8024f7:	74 f2                	je     8024eb <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8024f9:	3c 2b                	cmp    $0x2b,%al
+  8024fb:	74 2a                	je     802527 <strtol+0x4a>
+	int neg = 0;
+  8024fd:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  802502:	3c 2d                	cmp    $0x2d,%al
+  802504:	74 2b                	je     802531 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802506:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  80250c:	75 0f                	jne    80251d <strtol+0x40>
+  80250e:	80 3a 30             	cmpb   $0x30,(%edx)
+  802511:	74 28                	je     80253b <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  802513:	85 db                	test   %ebx,%ebx
+  802515:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80251a:	0f 44 d8             	cmove  %eax,%ebx
+  80251d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802522:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802525:	eb 46                	jmp    80256d <strtol+0x90>
+		s++;
+  802527:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  80252a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80252f:	eb d5                	jmp    802506 <strtol+0x29>
+		s++, neg = 1;
+  802531:	83 c2 01             	add    $0x1,%edx
+  802534:	bf 01 00 00 00       	mov    $0x1,%edi
+  802539:	eb cb                	jmp    802506 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80253b:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  80253f:	74 0e                	je     80254f <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  802541:	85 db                	test   %ebx,%ebx
+  802543:	75 d8                	jne    80251d <strtol+0x40>
+		s++, base = 8;
+  802545:	83 c2 01             	add    $0x1,%edx
+  802548:	bb 08 00 00 00       	mov    $0x8,%ebx
+  80254d:	eb ce                	jmp    80251d <strtol+0x40>
+		s += 2, base = 16;
+  80254f:	83 c2 02             	add    $0x2,%edx
+  802552:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802557:	eb c4                	jmp    80251d <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  802559:	0f be c0             	movsbl %al,%eax
+  80255c:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  80255f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802562:	7d 3a                	jge    80259e <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  802564:	83 c2 01             	add    $0x1,%edx
+  802567:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  80256b:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  80256d:	0f b6 02             	movzbl (%edx),%eax
+  802570:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802573:	89 f3                	mov    %esi,%ebx
+  802575:	80 fb 09             	cmp    $0x9,%bl
+  802578:	76 df                	jbe    802559 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  80257a:	8d 70 9f             	lea    -0x61(%eax),%esi
+  80257d:	89 f3                	mov    %esi,%ebx
+  80257f:	80 fb 19             	cmp    $0x19,%bl
+  802582:	77 08                	ja     80258c <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  802584:	0f be c0             	movsbl %al,%eax
+  802587:	83 e8 57             	sub    $0x57,%eax
+  80258a:	eb d3                	jmp    80255f <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  80258c:	8d 70 bf             	lea    -0x41(%eax),%esi
+  80258f:	89 f3                	mov    %esi,%ebx
+  802591:	80 fb 19             	cmp    $0x19,%bl
+  802594:	77 08                	ja     80259e <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  802596:	0f be c0             	movsbl %al,%eax
+  802599:	83 e8 37             	sub    $0x37,%eax
+  80259c:	eb c1                	jmp    80255f <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  80259e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8025a2:	74 05                	je     8025a9 <strtol+0xcc>
+		*endptr = (char *) s;
+  8025a4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025a7:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  8025a9:	89 c8                	mov    %ecx,%eax
+  8025ab:	f7 d8                	neg    %eax
+  8025ad:	85 ff                	test   %edi,%edi
+  8025af:	0f 45 c8             	cmovne %eax,%ecx
+}
+  8025b2:	89 c8                	mov    %ecx,%eax
+  8025b4:	5b                   	pop    %ebx
+  8025b5:	5e                   	pop    %esi
+  8025b6:	5f                   	pop    %edi
+  8025b7:	5d                   	pop    %ebp
+  8025b8:	c3                   	ret
+
+008025b9 <atoi>:
+
+int
+atoi(const char *s)
+{
+  8025b9:	55                   	push   %ebp
+  8025ba:	89 e5                	mov    %esp,%ebp
+  8025bc:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  8025bf:	6a 0a                	push   $0xa
+  8025c1:	6a 00                	push   $0x0
+  8025c3:	ff 75 08             	push   0x8(%ebp)
+  8025c6:	e8 12 ff ff ff       	call   8024dd <strtol>
+}
+  8025cb:	c9                   	leave
+  8025cc:	c3                   	ret
+
+008025cd <dm>:
+  8025cd:	55                   	push   %ebp
+  8025ce:	57                   	push   %edi
+  8025cf:	56                   	push   %esi
+  8025d0:	53                   	push   %ebx
+  8025d1:	83 ec 24             	sub    $0x24,%esp
+  8025d4:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8025d8:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8025dc:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8025e0:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8025e4:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8025e8:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8025ec:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8025f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025fa:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025ff:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802606:	00 
+  802607:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80260e:	00 
+  80260f:	89 fb                	mov    %edi,%ebx
+  802611:	eb 08                	jmp    80261b <dm+0x4e>
+  802613:	83 e9 01             	sub    $0x1,%ecx
+  802616:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802619:	74 68                	je     802683 <dm+0xb6>
+  80261b:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80261f:	01 c0                	add    %eax,%eax
+  802621:	89 c6                	mov    %eax,%esi
+  802623:	89 d7                	mov    %edx,%edi
+  802625:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802629:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80262d:	0f ad d0             	shrd   %cl,%edx,%eax
+  802630:	d3 ea                	shr    %cl,%edx
+  802632:	f6 c1 20             	test   $0x20,%cl
+  802635:	74 04                	je     80263b <dm+0x6e>
+  802637:	89 d0                	mov    %edx,%eax
+  802639:	31 d2                	xor    %edx,%edx
+  80263b:	83 e0 01             	and    $0x1,%eax
+  80263e:	89 04 24             	mov    %eax,(%esp)
+  802641:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802648:	00 
+  802649:	8b 04 24             	mov    (%esp),%eax
+  80264c:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802650:	09 f0                	or     %esi,%eax
+  802652:	09 fa                	or     %edi,%edx
+  802654:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802658:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80265c:	39 f0                	cmp    %esi,%eax
+  80265e:	89 d5                	mov    %edx,%ebp
+  802660:	19 fd                	sbb    %edi,%ebp
+  802662:	72 af                	jb     802613 <dm+0x46>
+  802664:	29 f0                	sub    %esi,%eax
+  802666:	19 fa                	sbb    %edi,%edx
+  802668:	89 cf                	mov    %ecx,%edi
+  80266a:	c1 ef 05             	shr    $0x5,%edi
+  80266d:	83 e7 01             	and    $0x1,%edi
+  802670:	89 fe                	mov    %edi,%esi
+  802672:	83 f6 01             	xor    $0x1,%esi
+  802675:	d3 e6                	shl    %cl,%esi
+  802677:	d3 e7                	shl    %cl,%edi
+  802679:	09 74 24 18          	or     %esi,0x18(%esp)
+  80267d:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802681:	eb 90                	jmp    802613 <dm+0x46>
+  802683:	85 db                	test   %ebx,%ebx
+  802685:	74 05                	je     80268c <dm+0xbf>
+  802687:	89 03                	mov    %eax,(%ebx)
+  802689:	89 53 04             	mov    %edx,0x4(%ebx)
+  80268c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802690:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802694:	83 c4 24             	add    $0x24,%esp
+  802697:	5b                   	pop    %ebx
+  802698:	5e                   	pop    %esi
+  802699:	5f                   	pop    %edi
+  80269a:	5d                   	pop    %ebp
+  80269b:	c3                   	ret
+
+0080269c <__udivdi3>:
+  80269c:	83 ec 08             	sub    $0x8,%esp
+  80269f:	6a 00                	push   $0x0
+  8026a1:	ff 74 24 1c          	push   0x1c(%esp)
+  8026a5:	ff 74 24 1c          	push   0x1c(%esp)
+  8026a9:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8026ad:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8026b1:	e8 17 ff ff ff       	call   8025cd <dm>
+  8026b6:	83 c4 14             	add    $0x14,%esp
+  8026b9:	c3                   	ret
+
+008026ba <__umoddi3>:
+  8026ba:	83 ec 18             	sub    $0x18,%esp
+  8026bd:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8026c1:	50                   	push   %eax
+  8026c2:	ff 74 24 2c          	push   0x2c(%esp)
+  8026c6:	ff 74 24 2c          	push   0x2c(%esp)
+  8026ca:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8026ce:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8026d2:	e8 f6 fe ff ff       	call   8025cd <dm>
+  8026d7:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8026db:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8026df:	83 c4 24             	add    $0x24,%esp
+  8026e2:	c3                   	ret
+
+008026e3 <__divdi3>:
+  8026e3:	53                   	push   %ebx
+  8026e4:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8026e8:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026ec:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8026f0:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8026f4:	85 d2                	test   %edx,%edx
+  8026f6:	78 15                	js     80270d <__divdi3+0x2a>
+  8026f8:	85 db                	test   %ebx,%ebx
+  8026fa:	78 34                	js     802730 <__divdi3+0x4d>
+  8026fc:	83 ec 04             	sub    $0x4,%esp
+  8026ff:	6a 00                	push   $0x0
+  802701:	53                   	push   %ebx
+  802702:	51                   	push   %ecx
+  802703:	e8 c5 fe ff ff       	call   8025cd <dm>
+  802708:	83 c4 10             	add    $0x10,%esp
+  80270b:	eb 21                	jmp    80272e <__divdi3+0x4b>
+  80270d:	f7 d8                	neg    %eax
+  80270f:	83 d2 00             	adc    $0x0,%edx
+  802712:	f7 da                	neg    %edx
+  802714:	85 db                	test   %ebx,%ebx
+  802716:	78 30                	js     802748 <__divdi3+0x65>
+  802718:	83 ec 04             	sub    $0x4,%esp
+  80271b:	6a 00                	push   $0x0
+  80271d:	53                   	push   %ebx
+  80271e:	51                   	push   %ecx
+  80271f:	e8 a9 fe ff ff       	call   8025cd <dm>
+  802724:	83 c4 10             	add    $0x10,%esp
+  802727:	f7 d8                	neg    %eax
+  802729:	83 d2 00             	adc    $0x0,%edx
+  80272c:	f7 da                	neg    %edx
+  80272e:	5b                   	pop    %ebx
+  80272f:	c3                   	ret
+  802730:	83 ec 04             	sub    $0x4,%esp
+  802733:	6a 00                	push   $0x0
+  802735:	f7 d9                	neg    %ecx
+  802737:	83 d3 00             	adc    $0x0,%ebx
+  80273a:	f7 db                	neg    %ebx
+  80273c:	53                   	push   %ebx
+  80273d:	51                   	push   %ecx
+  80273e:	e8 8a fe ff ff       	call   8025cd <dm>
+  802743:	83 c4 10             	add    $0x10,%esp
+  802746:	eb df                	jmp    802727 <__divdi3+0x44>
+  802748:	83 ec 04             	sub    $0x4,%esp
+  80274b:	6a 00                	push   $0x0
+  80274d:	f7 d9                	neg    %ecx
+  80274f:	83 d3 00             	adc    $0x0,%ebx
+  802752:	f7 db                	neg    %ebx
+  802754:	53                   	push   %ebx
+  802755:	51                   	push   %ecx
+  802756:	e8 72 fe ff ff       	call   8025cd <dm>
+  80275b:	83 c4 10             	add    $0x10,%esp
+  80275e:	eb ce                	jmp    80272e <__divdi3+0x4b>
+
+00802760 <__moddi3>:
+  802760:	55                   	push   %ebp
+  802761:	57                   	push   %edi
+  802762:	56                   	push   %esi
+  802763:	53                   	push   %ebx
+  802764:	83 ec 18             	sub    $0x18,%esp
+  802767:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  80276b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80276f:	89 f1                	mov    %esi,%ecx
+  802771:	f7 d9                	neg    %ecx
+  802773:	89 da                	mov    %ebx,%edx
+  802775:	83 d2 00             	adc    $0x0,%edx
+  802778:	f7 da                	neg    %edx
+  80277a:	0f 48 ce             	cmovs  %esi,%ecx
+  80277d:	0f 48 d3             	cmovs  %ebx,%edx
+  802780:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802784:	50                   	push   %eax
+  802785:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802789:	f7 de                	neg    %esi
+  80278b:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  80278f:	83 d0 00             	adc    $0x0,%eax
+  802792:	f7 d8                	neg    %eax
+  802794:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802799:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  80279e:	50                   	push   %eax
+  80279f:	56                   	push   %esi
+  8027a0:	89 c8                	mov    %ecx,%eax
+  8027a2:	e8 26 fe ff ff       	call   8025cd <dm>
+  8027a7:	83 c4 10             	add    $0x10,%esp
+  8027aa:	85 db                	test   %ebx,%ebx
+  8027ac:	78 10                	js     8027be <__moddi3+0x5e>
+  8027ae:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8027b2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8027b6:	83 c4 14             	add    $0x14,%esp
+  8027b9:	5b                   	pop    %ebx
+  8027ba:	5e                   	pop    %esi
+  8027bb:	5f                   	pop    %edi
+  8027bc:	5d                   	pop    %ebp
+  8027bd:	c3                   	ret
+  8027be:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8027c2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8027c6:	f7 d8                	neg    %eax
+  8027c8:	83 d2 00             	adc    $0x0,%edx
+  8027cb:	f7 da                	neg    %edx
+  8027cd:	eb e7                	jmp    8027b6 <__moddi3+0x56>
@@ -0,0 +1,5155 @@
+
+obj/user/faultnostack:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 23 00 00 00       	call   800054 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+void _pgfault_upcall();
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	sys_env_set_pgfault_upcall(0, (void*) _pgfault_upcall);
+  800039:	68 1f 1c 80 00       	push   $0x801c1f
+  80003e:	6a 00                	push   $0x0
+  800040:	e8 1a 0c 00 00       	call   800c5f <sys_env_set_pgfault_upcall>
+	*(int*)0 = 0;
+  800045:	c7 05 00 00 00 00 00 	movl   $0x0,0x0
+  80004c:	00 00 00 
+}
+  80004f:	83 c4 10             	add    $0x10,%esp
+  800052:	c9                   	leave
+  800053:	c3                   	ret
+
+00800054 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800054:	55                   	push   %ebp
+  800055:	89 e5                	mov    %esp,%ebp
+  800057:	56                   	push   %esi
+  800058:	53                   	push   %ebx
+  800059:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80005c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  80005f:	e8 9d 04 00 00       	call   800501 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  800064:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800069:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  80006f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800074:	a3 08 30 80 00       	mov    %eax,0x803008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800079:	85 db                	test   %ebx,%ebx
+  80007b:	7e 07                	jle    800084 <libmain+0x30>
+		binaryname = argv[0];
+  80007d:	8b 06                	mov    (%esi),%eax
+  80007f:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  800084:	83 ec 08             	sub    $0x8,%esp
+  800087:	56                   	push   %esi
+  800088:	53                   	push   %ebx
+  800089:	e8 a5 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80008e:	e8 0a 00 00 00       	call   80009d <exit>
+}
+  800093:	83 c4 10             	add    $0x10,%esp
+  800096:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800099:	5b                   	pop    %ebx
+  80009a:	5e                   	pop    %esi
+  80009b:	5d                   	pop    %ebp
+  80009c:	c3                   	ret
+
+0080009d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80009d:	55                   	push   %ebp
+  80009e:	89 e5                	mov    %esp,%ebp
+  8000a0:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  8000a3:	6a 00                	push   $0x0
+  8000a5:	e8 95 03 00 00       	call   80043f <sys_env_destroy>
+}
+  8000aa:	83 c4 10             	add    $0x10,%esp
+  8000ad:	c9                   	leave
+  8000ae:	c3                   	ret
+
+008000af <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  8000af:	55                   	push   %ebp
+  8000b0:	89 e5                	mov    %esp,%ebp
+  8000b2:	57                   	push   %edi
+  8000b3:	56                   	push   %esi
+  8000b4:	53                   	push   %ebx
+  8000b5:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  8000bb:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  8000c1:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  8000c7:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  8000cd:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  8000d4:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  8000d7:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  8000de:	00 00 00 
+		if (num == SYS_page_map_vec)
+  8000e1:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  8000e8:	74 76                	je     800160 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  8000ea:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  8000f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8000f3:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  8000f9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800100:	0f 88 06 01 00 00    	js     80020c <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800106:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80010d:	0f 84 48 01 00 00    	je     80025b <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800113:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800119:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  80011f:	be 00 00 00 00       	mov    $0x0,%esi
+  800124:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  80012a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80012d:	55                   	push   %ebp
+  80012e:	68 37 01 80 00       	push   $0x800137
+  800133:	89 e5                	mov    %esp,%ebp
+  800135:	0f 34                	sysenter
+  800137:	83 c4 04             	add    $0x4,%esp
+  80013a:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  80013b:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800141:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800147:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  80014a:	0f 85 9a 01 00 00    	jne    8002ea <page_vec_call+0x23b>
+  800150:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800155:	8b 75 08             	mov    0x8(%ebp),%esi
+  800158:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80015b:	e9 29 01 00 00       	jmp    800289 <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800160:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800166:	8b 45 08             	mov    0x8(%ebp),%eax
+  800169:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  80016b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800172:	78 2f                	js     8001a3 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800174:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80017b:	74 72                	je     8001ef <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  80017d:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800183:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800189:	b8 10 00 00 00       	mov    $0x10,%eax
+  80018e:	89 fb                	mov    %edi,%ebx
+  800190:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800193:	55                   	push   %ebp
+  800194:	68 9d 01 80 00       	push   $0x80019d
+  800199:	89 e5                	mov    %esp,%ebp
+  80019b:	0f 34                	sysenter
+  80019d:	83 c4 04             	add    $0x4,%esp
+  8001a0:	5d                   	pop    %ebp
+	return ret;
+  8001a1:	eb 98                	jmp    80013b <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  8001a3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8001a8:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  8001aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8001af:	f6 c6 08             	test   $0x8,%dh
+  8001b2:	74 15                	je     8001c9 <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8001b4:	89 c2                	mov    %eax,%edx
+  8001b6:	c1 ea 08             	shr    $0x8,%edx
+  8001b9:	83 e2 0f             	and    $0xf,%edx
+  8001bc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8001c1:	83 fa 06             	cmp    $0x6,%edx
+  8001c4:	74 0e                	je     8001d4 <page_vec_call+0x125>
+  8001c6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8001c9:	0f b6 c9             	movzbl %cl,%ecx
+  8001cc:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8001d2:	eb a0                	jmp    800174 <page_vec_call+0xc5>
+  8001d4:	89 c2                	mov    %eax,%edx
+  8001d6:	c1 ea 04             	shr    $0x4,%edx
+  8001d9:	83 e2 0f             	and    $0xf,%edx
+  8001dc:	83 fa 02             	cmp    $0x2,%edx
+  8001df:	77 e5                	ja     8001c6 <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  8001e1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8001e4:	83 f8 02             	cmp    $0x2,%eax
+  8001e7:	0f 97 c1             	seta   %cl
+  8001ea:	0f b6 c9             	movzbl %cl,%ecx
+  8001ed:	eb d7                	jmp    8001c6 <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  8001ef:	b8 10 00 00 00       	mov    $0x10,%eax
+  8001f4:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  8001fa:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800200:	89 fb                	mov    %edi,%ebx
+  800202:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800205:	cd 30                	int    $0x30
+  800207:	e9 2f ff ff ff       	jmp    80013b <page_vec_call+0x8c>
+  80020c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800211:	0f a2                	cpuid
+		return 0;
+  800213:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800218:	f6 c6 08             	test   $0x8,%dh
+  80021b:	74 15                	je     800232 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80021d:	89 c2                	mov    %eax,%edx
+  80021f:	c1 ea 08             	shr    $0x8,%edx
+  800222:	83 e2 0f             	and    $0xf,%edx
+  800225:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80022a:	83 fa 06             	cmp    $0x6,%edx
+  80022d:	74 11                	je     800240 <page_vec_call+0x191>
+  80022f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800232:	0f b6 c9             	movzbl %cl,%ecx
+  800235:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80023b:	e9 c6 fe ff ff       	jmp    800106 <page_vec_call+0x57>
+  800240:	89 c2                	mov    %eax,%edx
+  800242:	c1 ea 04             	shr    $0x4,%edx
+  800245:	83 e2 0f             	and    $0xf,%edx
+  800248:	83 fa 02             	cmp    $0x2,%edx
+  80024b:	77 e2                	ja     80022f <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  80024d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800250:	83 f8 02             	cmp    $0x2,%eax
+  800253:	0f 97 c1             	seta   %cl
+  800256:	0f b6 c9             	movzbl %cl,%ecx
+  800259:	eb d4                	jmp    80022f <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  80025b:	be 00 00 00 00       	mov    $0x0,%esi
+  800260:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800266:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  80026c:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800272:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800275:	cd 30                	int    $0x30
+  800277:	e9 bf fe ff ff       	jmp    80013b <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  80027c:	29 da                	sub    %ebx,%edx
+			vec++;
+  80027e:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800281:	83 e8 01             	sub    $0x1,%eax
+  800284:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800289:	85 c0                	test   %eax,%eax
+  80028b:	74 58                	je     8002e5 <page_vec_call+0x236>
+  80028d:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800290:	39 da                	cmp    %ebx,%edx
+  800292:	73 e8                	jae    80027c <page_vec_call+0x1cd>
+  800294:	89 75 08             	mov    %esi,0x8(%ebp)
+  800297:	89 45 0c             	mov    %eax,0xc(%ebp)
+  80029a:	84 c9                	test   %cl,%cl
+  80029c:	74 06                	je     8002a4 <page_vec_call+0x1f5>
+  80029e:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  8002a4:	83 ec 04             	sub    $0x4,%esp
+  8002a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8002aa:	c1 e0 04             	shl    $0x4,%eax
+  8002ad:	50                   	push   %eax
+  8002ae:	ff 75 08             	push   0x8(%ebp)
+  8002b1:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  8002b7:	53                   	push   %ebx
+  8002b8:	e8 67 21 00 00       	call   802424 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  8002bd:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  8002c3:	89 c2                	mov    %eax,%edx
+  8002c5:	c1 e2 0c             	shl    $0xc,%edx
+  8002c8:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  8002ce:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  8002d4:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  8002da:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  8002dd:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  8002e0:	e9 f2 fd ff ff       	jmp    8000d7 <page_vec_call+0x28>
+			r = 0;
+  8002e5:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  8002ea:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8002ee:	74 0b                	je     8002fb <page_vec_call+0x24c>
+		*done = total;
+  8002f0:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002f3:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  8002f9:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  8002fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002fe:	5b                   	pop    %ebx
+  8002ff:	5e                   	pop    %esi
+  800300:	5f                   	pop    %edi
+  800301:	5d                   	pop    %ebp
+  800302:	c3                   	ret
+
+00800303 <sys_cputs>:
+{
+  800303:	55                   	push   %ebp
+  800304:	89 e5                	mov    %esp,%ebp
+  800306:	57                   	push   %edi
+  800307:	56                   	push   %esi
+  800308:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800309:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800310:	78 2d                	js     80033f <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800312:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800319:	74 70                	je     80038b <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  80031b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800320:	8b 55 08             	mov    0x8(%ebp),%edx
+  800323:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800326:	89 c3                	mov    %eax,%ebx
+  800328:	89 c7                	mov    %eax,%edi
+  80032a:	89 c6                	mov    %eax,%esi
+  80032c:	55                   	push   %ebp
+  80032d:	68 36 03 80 00       	push   $0x800336
+  800332:	89 e5                	mov    %esp,%ebp
+  800334:	0f 34                	sysenter
+  800336:	83 c4 04             	add    $0x4,%esp
+  800339:	5d                   	pop    %ebp
+}
+  80033a:	5b                   	pop    %ebx
+  80033b:	5e                   	pop    %esi
+  80033c:	5f                   	pop    %edi
+  80033d:	5d                   	pop    %ebp
+  80033e:	c3                   	ret
+  80033f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800344:	0f a2                	cpuid
+		return 0;
+  800346:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80034b:	f6 c6 08             	test   $0x8,%dh
+  80034e:	74 15                	je     800365 <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800350:	89 c2                	mov    %eax,%edx
+  800352:	c1 ea 08             	shr    $0x8,%edx
+  800355:	83 e2 0f             	and    $0xf,%edx
+  800358:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80035d:	83 fa 06             	cmp    $0x6,%edx
+  800360:	74 0e                	je     800370 <sys_cputs+0x6d>
+  800362:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800365:	0f b6 c9             	movzbl %cl,%ecx
+  800368:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80036e:	eb a2                	jmp    800312 <sys_cputs+0xf>
+  800370:	89 c2                	mov    %eax,%edx
+  800372:	c1 ea 04             	shr    $0x4,%edx
+  800375:	83 e2 0f             	and    $0xf,%edx
+  800378:	83 fa 02             	cmp    $0x2,%edx
+  80037b:	77 e5                	ja     800362 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  80037d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800380:	83 f8 02             	cmp    $0x2,%eax
+  800383:	0f 97 c1             	seta   %cl
+  800386:	0f b6 c9             	movzbl %cl,%ecx
+  800389:	eb d7                	jmp    800362 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  80038b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800390:	8b 55 08             	mov    0x8(%ebp),%edx
+  800393:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800396:	89 c3                	mov    %eax,%ebx
+  800398:	89 c7                	mov    %eax,%edi
+  80039a:	89 c6                	mov    %eax,%esi
+  80039c:	cd 30                	int    $0x30
+}
+  80039e:	eb 9a                	jmp    80033a <sys_cputs+0x37>
+
+008003a0 <sys_cgetc>:
+{
+  8003a0:	55                   	push   %ebp
+  8003a1:	89 e5                	mov    %esp,%ebp
+  8003a3:	57                   	push   %edi
+  8003a4:	56                   	push   %esi
+  8003a5:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8003a6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8003ad:	78 2e                	js     8003dd <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  8003af:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8003b6:	74 71                	je     800429 <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  8003b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003bd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8003c2:	89 d1                	mov    %edx,%ecx
+  8003c4:	89 d3                	mov    %edx,%ebx
+  8003c6:	89 d7                	mov    %edx,%edi
+  8003c8:	89 d6                	mov    %edx,%esi
+  8003ca:	55                   	push   %ebp
+  8003cb:	68 d4 03 80 00       	push   $0x8003d4
+  8003d0:	89 e5                	mov    %esp,%ebp
+  8003d2:	0f 34                	sysenter
+  8003d4:	83 c4 04             	add    $0x4,%esp
+  8003d7:	5d                   	pop    %ebp
+}
+  8003d8:	5b                   	pop    %ebx
+  8003d9:	5e                   	pop    %esi
+  8003da:	5f                   	pop    %edi
+  8003db:	5d                   	pop    %ebp
+  8003dc:	c3                   	ret
+  8003dd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8003e2:	0f a2                	cpuid
+		return 0;
+  8003e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8003e9:	f6 c6 08             	test   $0x8,%dh
+  8003ec:	74 15                	je     800403 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8003ee:	89 c2                	mov    %eax,%edx
+  8003f0:	c1 ea 08             	shr    $0x8,%edx
+  8003f3:	83 e2 0f             	and    $0xf,%edx
+  8003f6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8003fb:	83 fa 06             	cmp    $0x6,%edx
+  8003fe:	74 0e                	je     80040e <sys_cgetc+0x6e>
+  800400:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800403:	0f b6 c9             	movzbl %cl,%ecx
+  800406:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80040c:	eb a1                	jmp    8003af <sys_cgetc+0xf>
+  80040e:	89 c2                	mov    %eax,%edx
+  800410:	c1 ea 04             	shr    $0x4,%edx
+  800413:	83 e2 0f             	and    $0xf,%edx
+  800416:	83 fa 02             	cmp    $0x2,%edx
+  800419:	77 e5                	ja     800400 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  80041b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80041e:	83 f8 02             	cmp    $0x2,%eax
+  800421:	0f 97 c1             	seta   %cl
+  800424:	0f b6 c9             	movzbl %cl,%ecx
+  800427:	eb d7                	jmp    800400 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  800429:	ba 00 00 00 00       	mov    $0x0,%edx
+  80042e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800433:	89 d1                	mov    %edx,%ecx
+  800435:	89 d3                	mov    %edx,%ebx
+  800437:	89 d7                	mov    %edx,%edi
+  800439:	89 d6                	mov    %edx,%esi
+  80043b:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  80043d:	eb 99                	jmp    8003d8 <sys_cgetc+0x38>
+
+0080043f <sys_env_destroy>:
+{
+  80043f:	55                   	push   %ebp
+  800440:	89 e5                	mov    %esp,%ebp
+  800442:	57                   	push   %edi
+  800443:	56                   	push   %esi
+  800444:	53                   	push   %ebx
+  800445:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800448:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80044f:	78 36                	js     800487 <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  800451:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800458:	74 79                	je     8004d3 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  80045a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80045d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800462:	b8 03 00 00 00       	mov    $0x3,%eax
+  800467:	89 cb                	mov    %ecx,%ebx
+  800469:	89 cf                	mov    %ecx,%edi
+  80046b:	89 ce                	mov    %ecx,%esi
+  80046d:	55                   	push   %ebp
+  80046e:	68 77 04 80 00       	push   $0x800477
+  800473:	89 e5                	mov    %esp,%ebp
+  800475:	0f 34                	sysenter
+  800477:	83 c4 04             	add    $0x4,%esp
+  80047a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80047b:	85 c0                	test   %eax,%eax
+  80047d:	7f 6b                	jg     8004ea <sys_env_destroy+0xab>
+}
+  80047f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800482:	5b                   	pop    %ebx
+  800483:	5e                   	pop    %esi
+  800484:	5f                   	pop    %edi
+  800485:	5d                   	pop    %ebp
+  800486:	c3                   	ret
+  800487:	b8 01 00 00 00       	mov    $0x1,%eax
+  80048c:	0f a2                	cpuid
+		return 0;
+  80048e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800493:	f6 c6 08             	test   $0x8,%dh
+  800496:	74 15                	je     8004ad <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800498:	89 c2                	mov    %eax,%edx
+  80049a:	c1 ea 08             	shr    $0x8,%edx
+  80049d:	83 e2 0f             	and    $0xf,%edx
+  8004a0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8004a5:	83 fa 06             	cmp    $0x6,%edx
+  8004a8:	74 0e                	je     8004b8 <sys_env_destroy+0x79>
+  8004aa:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8004ad:	0f b6 c9             	movzbl %cl,%ecx
+  8004b0:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8004b6:	eb 99                	jmp    800451 <sys_env_destroy+0x12>
+  8004b8:	89 c2                	mov    %eax,%edx
+  8004ba:	c1 ea 04             	shr    $0x4,%edx
+  8004bd:	83 e2 0f             	and    $0xf,%edx
+  8004c0:	83 fa 02             	cmp    $0x2,%edx
+  8004c3:	77 e5                	ja     8004aa <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  8004c5:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8004c8:	83 f8 02             	cmp    $0x2,%eax
+  8004cb:	0f 97 c1             	seta   %cl
+  8004ce:	0f b6 c9             	movzbl %cl,%ecx
+  8004d1:	eb d7                	jmp    8004aa <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  8004d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004d8:	b8 03 00 00 00       	mov    $0x3,%eax
+  8004dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004e0:	89 cb                	mov    %ecx,%ebx
+  8004e2:	89 cf                	mov    %ecx,%edi
+  8004e4:	89 ce                	mov    %ecx,%esi
+  8004e6:	cd 30                	int    $0x30
+  8004e8:	eb 91                	jmp    80047b <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004ea:	83 ec 0c             	sub    $0xc,%esp
+  8004ed:	50                   	push   %eax
+  8004ee:	6a 03                	push   $0x3
+  8004f0:	68 6a 28 80 00       	push   $0x80286a
+  8004f5:	6a 4a                	push   $0x4a
+  8004f7:	68 87 28 80 00       	push   $0x802887
+  8004fc:	e8 44 17 00 00       	call   801c45 <_panic>
+
+00800501 <sys_getenvid>:
+{
+  800501:	55                   	push   %ebp
+  800502:	89 e5                	mov    %esp,%ebp
+  800504:	57                   	push   %edi
+  800505:	56                   	push   %esi
+  800506:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800507:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80050e:	78 2e                	js     80053e <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  800510:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800517:	74 71                	je     80058a <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  800519:	ba 00 00 00 00       	mov    $0x0,%edx
+  80051e:	b8 02 00 00 00       	mov    $0x2,%eax
+  800523:	89 d1                	mov    %edx,%ecx
+  800525:	89 d3                	mov    %edx,%ebx
+  800527:	89 d7                	mov    %edx,%edi
+  800529:	89 d6                	mov    %edx,%esi
+  80052b:	55                   	push   %ebp
+  80052c:	68 35 05 80 00       	push   $0x800535
+  800531:	89 e5                	mov    %esp,%ebp
+  800533:	0f 34                	sysenter
+  800535:	83 c4 04             	add    $0x4,%esp
+  800538:	5d                   	pop    %ebp
+}
+  800539:	5b                   	pop    %ebx
+  80053a:	5e                   	pop    %esi
+  80053b:	5f                   	pop    %edi
+  80053c:	5d                   	pop    %ebp
+  80053d:	c3                   	ret
+  80053e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800543:	0f a2                	cpuid
+		return 0;
+  800545:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80054a:	f6 c6 08             	test   $0x8,%dh
+  80054d:	74 15                	je     800564 <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80054f:	89 c2                	mov    %eax,%edx
+  800551:	c1 ea 08             	shr    $0x8,%edx
+  800554:	83 e2 0f             	and    $0xf,%edx
+  800557:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80055c:	83 fa 06             	cmp    $0x6,%edx
+  80055f:	74 0e                	je     80056f <sys_getenvid+0x6e>
+  800561:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800564:	0f b6 c9             	movzbl %cl,%ecx
+  800567:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80056d:	eb a1                	jmp    800510 <sys_getenvid+0xf>
+  80056f:	89 c2                	mov    %eax,%edx
+  800571:	c1 ea 04             	shr    $0x4,%edx
+  800574:	83 e2 0f             	and    $0xf,%edx
+  800577:	83 fa 02             	cmp    $0x2,%edx
+  80057a:	77 e5                	ja     800561 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  80057c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80057f:	83 f8 02             	cmp    $0x2,%eax
+  800582:	0f 97 c1             	seta   %cl
+  800585:	0f b6 c9             	movzbl %cl,%ecx
+  800588:	eb d7                	jmp    800561 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  80058a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80058f:	b8 02 00 00 00       	mov    $0x2,%eax
+  800594:	89 d1                	mov    %edx,%ecx
+  800596:	89 d3                	mov    %edx,%ebx
+  800598:	89 d7                	mov    %edx,%edi
+  80059a:	89 d6                	mov    %edx,%esi
+  80059c:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80059e:	eb 99                	jmp    800539 <sys_getenvid+0x38>
+
+008005a0 <sys_page_alloc>:
+{
+  8005a0:	55                   	push   %ebp
+  8005a1:	89 e5                	mov    %esp,%ebp
+  8005a3:	57                   	push   %edi
+  8005a4:	56                   	push   %esi
+  8005a5:	53                   	push   %ebx
+  8005a6:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8005a9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8005b0:	78 38                	js     8005ea <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  8005b2:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8005b9:	74 7b                	je     800636 <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  8005bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8005c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005c6:	b8 04 00 00 00       	mov    $0x4,%eax
+  8005cb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005ce:	89 f7                	mov    %esi,%edi
+  8005d0:	55                   	push   %ebp
+  8005d1:	68 da 05 80 00       	push   $0x8005da
+  8005d6:	89 e5                	mov    %esp,%ebp
+  8005d8:	0f 34                	sysenter
+  8005da:	83 c4 04             	add    $0x4,%esp
+  8005dd:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8005de:	85 c0                	test   %eax,%eax
+  8005e0:	7f 6d                	jg     80064f <sys_page_alloc+0xaf>
+}
+  8005e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005e5:	5b                   	pop    %ebx
+  8005e6:	5e                   	pop    %esi
+  8005e7:	5f                   	pop    %edi
+  8005e8:	5d                   	pop    %ebp
+  8005e9:	c3                   	ret
+  8005ea:	b8 01 00 00 00       	mov    $0x1,%eax
+  8005ef:	0f a2                	cpuid
+		return 0;
+  8005f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8005f6:	f6 c6 08             	test   $0x8,%dh
+  8005f9:	74 15                	je     800610 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8005fb:	89 c2                	mov    %eax,%edx
+  8005fd:	c1 ea 08             	shr    $0x8,%edx
+  800600:	83 e2 0f             	and    $0xf,%edx
+  800603:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800608:	83 fa 06             	cmp    $0x6,%edx
+  80060b:	74 0e                	je     80061b <sys_page_alloc+0x7b>
+  80060d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800610:	0f b6 c9             	movzbl %cl,%ecx
+  800613:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800619:	eb 97                	jmp    8005b2 <sys_page_alloc+0x12>
+  80061b:	89 c2                	mov    %eax,%edx
+  80061d:	c1 ea 04             	shr    $0x4,%edx
+  800620:	83 e2 0f             	and    $0xf,%edx
+  800623:	83 fa 02             	cmp    $0x2,%edx
+  800626:	77 e5                	ja     80060d <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  800628:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80062b:	83 f8 02             	cmp    $0x2,%eax
+  80062e:	0f 97 c1             	seta   %cl
+  800631:	0f b6 c9             	movzbl %cl,%ecx
+  800634:	eb d7                	jmp    80060d <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  800636:	be 00 00 00 00       	mov    $0x0,%esi
+  80063b:	b8 04 00 00 00       	mov    $0x4,%eax
+  800640:	8b 55 08             	mov    0x8(%ebp),%edx
+  800643:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800646:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800649:	89 f7                	mov    %esi,%edi
+  80064b:	cd 30                	int    $0x30
+  80064d:	eb 8f                	jmp    8005de <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80064f:	83 ec 0c             	sub    $0xc,%esp
+  800652:	50                   	push   %eax
+  800653:	6a 04                	push   $0x4
+  800655:	68 6a 28 80 00       	push   $0x80286a
+  80065a:	6a 4a                	push   $0x4a
+  80065c:	68 87 28 80 00       	push   $0x802887
+  800661:	e8 df 15 00 00       	call   801c45 <_panic>
+
+00800666 <sys_page_map>:
+{
+  800666:	55                   	push   %ebp
+  800667:	89 e5                	mov    %esp,%ebp
+  800669:	57                   	push   %edi
+  80066a:	56                   	push   %esi
+  80066b:	53                   	push   %ebx
+  80066c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80066f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800676:	78 37                	js     8006af <sys_page_map+0x49>
+	if (syscall_sysenter)
+  800678:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80067f:	74 7a                	je     8006fb <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  800681:	8b 55 08             	mov    0x8(%ebp),%edx
+  800684:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800687:	b8 05 00 00 00       	mov    $0x5,%eax
+  80068c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80068f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800692:	8b 75 18             	mov    0x18(%ebp),%esi
+  800695:	55                   	push   %ebp
+  800696:	68 9f 06 80 00       	push   $0x80069f
+  80069b:	89 e5                	mov    %esp,%ebp
+  80069d:	0f 34                	sysenter
+  80069f:	83 c4 04             	add    $0x4,%esp
+  8006a2:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8006a3:	85 c0                	test   %eax,%eax
+  8006a5:	7f 6c                	jg     800713 <sys_page_map+0xad>
+}
+  8006a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006aa:	5b                   	pop    %ebx
+  8006ab:	5e                   	pop    %esi
+  8006ac:	5f                   	pop    %edi
+  8006ad:	5d                   	pop    %ebp
+  8006ae:	c3                   	ret
+  8006af:	b8 01 00 00 00       	mov    $0x1,%eax
+  8006b4:	0f a2                	cpuid
+		return 0;
+  8006b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8006bb:	f6 c6 08             	test   $0x8,%dh
+  8006be:	74 15                	je     8006d5 <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8006c0:	89 c2                	mov    %eax,%edx
+  8006c2:	c1 ea 08             	shr    $0x8,%edx
+  8006c5:	83 e2 0f             	and    $0xf,%edx
+  8006c8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8006cd:	83 fa 06             	cmp    $0x6,%edx
+  8006d0:	74 0e                	je     8006e0 <sys_page_map+0x7a>
+  8006d2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8006d5:	0f b6 c9             	movzbl %cl,%ecx
+  8006d8:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8006de:	eb 98                	jmp    800678 <sys_page_map+0x12>
+  8006e0:	89 c2                	mov    %eax,%edx
+  8006e2:	c1 ea 04             	shr    $0x4,%edx
+  8006e5:	83 e2 0f             	and    $0xf,%edx
+  8006e8:	83 fa 02             	cmp    $0x2,%edx
+  8006eb:	77 e5                	ja     8006d2 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  8006ed:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8006f0:	83 f8 02             	cmp    $0x2,%eax
+  8006f3:	0f 97 c1             	seta   %cl
+  8006f6:	0f b6 c9             	movzbl %cl,%ecx
+  8006f9:	eb d7                	jmp    8006d2 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  8006fb:	b8 05 00 00 00       	mov    $0x5,%eax
+  800700:	8b 55 08             	mov    0x8(%ebp),%edx
+  800703:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800706:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800709:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80070c:	8b 75 18             	mov    0x18(%ebp),%esi
+  80070f:	cd 30                	int    $0x30
+  800711:	eb 90                	jmp    8006a3 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800713:	83 ec 0c             	sub    $0xc,%esp
+  800716:	50                   	push   %eax
+  800717:	6a 05                	push   $0x5
+  800719:	68 6a 28 80 00       	push   $0x80286a
+  80071e:	6a 4a                	push   $0x4a
+  800720:	68 87 28 80 00       	push   $0x802887
+  800725:	e8 1b 15 00 00       	call   801c45 <_panic>
+
+0080072a <sys_page_unmap>:
+{
+  80072a:	55                   	push   %ebp
+  80072b:	89 e5                	mov    %esp,%ebp
+  80072d:	57                   	push   %edi
+  80072e:	56                   	push   %esi
+  80072f:	53                   	push   %ebx
+  800730:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800733:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80073a:	78 37                	js     800773 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  80073c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800743:	74 7a                	je     8007bf <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  800745:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80074a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80074d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800750:	b8 06 00 00 00       	mov    $0x6,%eax
+  800755:	89 df                	mov    %ebx,%edi
+  800757:	89 de                	mov    %ebx,%esi
+  800759:	55                   	push   %ebp
+  80075a:	68 63 07 80 00       	push   $0x800763
+  80075f:	89 e5                	mov    %esp,%ebp
+  800761:	0f 34                	sysenter
+  800763:	83 c4 04             	add    $0x4,%esp
+  800766:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800767:	85 c0                	test   %eax,%eax
+  800769:	7f 6c                	jg     8007d7 <sys_page_unmap+0xad>
+}
+  80076b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80076e:	5b                   	pop    %ebx
+  80076f:	5e                   	pop    %esi
+  800770:	5f                   	pop    %edi
+  800771:	5d                   	pop    %ebp
+  800772:	c3                   	ret
+  800773:	b8 01 00 00 00       	mov    $0x1,%eax
+  800778:	0f a2                	cpuid
+		return 0;
+  80077a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80077f:	f6 c6 08             	test   $0x8,%dh
+  800782:	74 15                	je     800799 <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800784:	89 c2                	mov    %eax,%edx
+  800786:	c1 ea 08             	shr    $0x8,%edx
+  800789:	83 e2 0f             	and    $0xf,%edx
+  80078c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800791:	83 fa 06             	cmp    $0x6,%edx
+  800794:	74 0e                	je     8007a4 <sys_page_unmap+0x7a>
+  800796:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800799:	0f b6 c9             	movzbl %cl,%ecx
+  80079c:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8007a2:	eb 98                	jmp    80073c <sys_page_unmap+0x12>
+  8007a4:	89 c2                	mov    %eax,%edx
+  8007a6:	c1 ea 04             	shr    $0x4,%edx
+  8007a9:	83 e2 0f             	and    $0xf,%edx
+  8007ac:	83 fa 02             	cmp    $0x2,%edx
+  8007af:	77 e5                	ja     800796 <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  8007b1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8007b4:	83 f8 02             	cmp    $0x2,%eax
+  8007b7:	0f 97 c1             	seta   %cl
+  8007ba:	0f b6 c9             	movzbl %cl,%ecx
+  8007bd:	eb d7                	jmp    800796 <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  8007bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007c4:	b8 06 00 00 00       	mov    $0x6,%eax
+  8007c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007cf:	89 df                	mov    %ebx,%edi
+  8007d1:	89 de                	mov    %ebx,%esi
+  8007d3:	cd 30                	int    $0x30
+  8007d5:	eb 90                	jmp    800767 <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8007d7:	83 ec 0c             	sub    $0xc,%esp
+  8007da:	50                   	push   %eax
+  8007db:	6a 06                	push   $0x6
+  8007dd:	68 6a 28 80 00       	push   $0x80286a
+  8007e2:	6a 4a                	push   $0x4a
+  8007e4:	68 87 28 80 00       	push   $0x802887
+  8007e9:	e8 57 14 00 00       	call   801c45 <_panic>
+
+008007ee <sys_page_copy>:
+{
+  8007ee:	55                   	push   %ebp
+  8007ef:	89 e5                	mov    %esp,%ebp
+  8007f1:	57                   	push   %edi
+  8007f2:	56                   	push   %esi
+  8007f3:	53                   	push   %ebx
+  8007f4:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8007f7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8007fe:	78 37                	js     800837 <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  800800:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800807:	74 7a                	je     800883 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  800809:	8b 55 08             	mov    0x8(%ebp),%edx
+  80080c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80080f:	b8 29 00 00 00       	mov    $0x29,%eax
+  800814:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800817:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80081a:	8b 75 18             	mov    0x18(%ebp),%esi
+  80081d:	55                   	push   %ebp
+  80081e:	68 27 08 80 00       	push   $0x800827
+  800823:	89 e5                	mov    %esp,%ebp
+  800825:	0f 34                	sysenter
+  800827:	83 c4 04             	add    $0x4,%esp
+  80082a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80082b:	85 c0                	test   %eax,%eax
+  80082d:	7f 6c                	jg     80089b <sys_page_copy+0xad>
+}
+  80082f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800832:	5b                   	pop    %ebx
+  800833:	5e                   	pop    %esi
+  800834:	5f                   	pop    %edi
+  800835:	5d                   	pop    %ebp
+  800836:	c3                   	ret
+  800837:	b8 01 00 00 00       	mov    $0x1,%eax
+  80083c:	0f a2                	cpuid
+		return 0;
+  80083e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800843:	f6 c6 08             	test   $0x8,%dh
+  800846:	74 15                	je     80085d <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800848:	89 c2                	mov    %eax,%edx
+  80084a:	c1 ea 08             	shr    $0x8,%edx
+  80084d:	83 e2 0f             	and    $0xf,%edx
+  800850:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800855:	83 fa 06             	cmp    $0x6,%edx
+  800858:	74 0e                	je     800868 <sys_page_copy+0x7a>
+  80085a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80085d:	0f b6 c9             	movzbl %cl,%ecx
+  800860:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800866:	eb 98                	jmp    800800 <sys_page_copy+0x12>
+  800868:	89 c2                	mov    %eax,%edx
+  80086a:	c1 ea 04             	shr    $0x4,%edx
+  80086d:	83 e2 0f             	and    $0xf,%edx
+  800870:	83 fa 02             	cmp    $0x2,%edx
+  800873:	77 e5                	ja     80085a <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  800875:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800878:	83 f8 02             	cmp    $0x2,%eax
+  80087b:	0f 97 c1             	seta   %cl
+  80087e:	0f b6 c9             	movzbl %cl,%ecx
+  800881:	eb d7                	jmp    80085a <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  800883:	b8 29 00 00 00       	mov    $0x29,%eax
+  800888:	8b 55 08             	mov    0x8(%ebp),%edx
+  80088b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80088e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800891:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800894:	8b 75 18             	mov    0x18(%ebp),%esi
+  800897:	cd 30                	int    $0x30
+  800899:	eb 90                	jmp    80082b <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80089b:	83 ec 0c             	sub    $0xc,%esp
+  80089e:	50                   	push   %eax
+  80089f:	6a 29                	push   $0x29
+  8008a1:	68 6a 28 80 00       	push   $0x80286a
+  8008a6:	6a 4a                	push   $0x4a
+  8008a8:	68 87 28 80 00       	push   $0x802887
+  8008ad:	e8 93 13 00 00       	call   801c45 <_panic>
+
+008008b2 <sys_yield>:
+{
+  8008b2:	55                   	push   %ebp
+  8008b3:	89 e5                	mov    %esp,%ebp
+  8008b5:	57                   	push   %edi
+  8008b6:	56                   	push   %esi
+  8008b7:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8008b8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8008bf:	78 2e                	js     8008ef <sys_yield+0x3d>
+	if (syscall_sysenter)
+  8008c1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8008c8:	74 71                	je     80093b <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  8008ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008cf:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8008d4:	89 d1                	mov    %edx,%ecx
+  8008d6:	89 d3                	mov    %edx,%ebx
+  8008d8:	89 d7                	mov    %edx,%edi
+  8008da:	89 d6                	mov    %edx,%esi
+  8008dc:	55                   	push   %ebp
+  8008dd:	68 e6 08 80 00       	push   $0x8008e6
+  8008e2:	89 e5                	mov    %esp,%ebp
+  8008e4:	0f 34                	sysenter
+  8008e6:	83 c4 04             	add    $0x4,%esp
+  8008e9:	5d                   	pop    %ebp
+}
+  8008ea:	5b                   	pop    %ebx
+  8008eb:	5e                   	pop    %esi
+  8008ec:	5f                   	pop    %edi
+  8008ed:	5d                   	pop    %ebp
+  8008ee:	c3                   	ret
+  8008ef:	b8 01 00 00 00       	mov    $0x1,%eax
+  8008f4:	0f a2                	cpuid
+		return 0;
+  8008f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8008fb:	f6 c6 08             	test   $0x8,%dh
+  8008fe:	74 15                	je     800915 <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800900:	89 c2                	mov    %eax,%edx
+  800902:	c1 ea 08             	shr    $0x8,%edx
+  800905:	83 e2 0f             	and    $0xf,%edx
+  800908:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80090d:	83 fa 06             	cmp    $0x6,%edx
+  800910:	74 0e                	je     800920 <sys_yield+0x6e>
+  800912:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800915:	0f b6 c9             	movzbl %cl,%ecx
+  800918:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80091e:	eb a1                	jmp    8008c1 <sys_yield+0xf>
+  800920:	89 c2                	mov    %eax,%edx
+  800922:	c1 ea 04             	shr    $0x4,%edx
+  800925:	83 e2 0f             	and    $0xf,%edx
+  800928:	83 fa 02             	cmp    $0x2,%edx
+  80092b:	77 e5                	ja     800912 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  80092d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800930:	83 f8 02             	cmp    $0x2,%eax
+  800933:	0f 97 c1             	seta   %cl
+  800936:	0f b6 c9             	movzbl %cl,%ecx
+  800939:	eb d7                	jmp    800912 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  80093b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800940:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800945:	89 d1                	mov    %edx,%ecx
+  800947:	89 d3                	mov    %edx,%ebx
+  800949:	89 d7                	mov    %edx,%edi
+  80094b:	89 d6                	mov    %edx,%esi
+  80094d:	cd 30                	int    $0x30
+}
+  80094f:	eb 99                	jmp    8008ea <sys_yield+0x38>
+
+00800951 <sys_env_set_status>:
+{
+  800951:	55                   	push   %ebp
+  800952:	89 e5                	mov    %esp,%ebp
+  800954:	57                   	push   %edi
+  800955:	56                   	push   %esi
+  800956:	53                   	push   %ebx
+  800957:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80095a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800961:	78 37                	js     80099a <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  800963:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80096a:	74 7a                	je     8009e6 <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  80096c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800971:	8b 55 08             	mov    0x8(%ebp),%edx
+  800974:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800977:	b8 08 00 00 00       	mov    $0x8,%eax
+  80097c:	89 df                	mov    %ebx,%edi
+  80097e:	89 de                	mov    %ebx,%esi
+  800980:	55                   	push   %ebp
+  800981:	68 8a 09 80 00       	push   $0x80098a
+  800986:	89 e5                	mov    %esp,%ebp
+  800988:	0f 34                	sysenter
+  80098a:	83 c4 04             	add    $0x4,%esp
+  80098d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80098e:	85 c0                	test   %eax,%eax
+  800990:	7f 6c                	jg     8009fe <sys_env_set_status+0xad>
+}
+  800992:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800995:	5b                   	pop    %ebx
+  800996:	5e                   	pop    %esi
+  800997:	5f                   	pop    %edi
+  800998:	5d                   	pop    %ebp
+  800999:	c3                   	ret
+  80099a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80099f:	0f a2                	cpuid
+		return 0;
+  8009a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8009a6:	f6 c6 08             	test   $0x8,%dh
+  8009a9:	74 15                	je     8009c0 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8009ab:	89 c2                	mov    %eax,%edx
+  8009ad:	c1 ea 08             	shr    $0x8,%edx
+  8009b0:	83 e2 0f             	and    $0xf,%edx
+  8009b3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8009b8:	83 fa 06             	cmp    $0x6,%edx
+  8009bb:	74 0e                	je     8009cb <sys_env_set_status+0x7a>
+  8009bd:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8009c0:	0f b6 c9             	movzbl %cl,%ecx
+  8009c3:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8009c9:	eb 98                	jmp    800963 <sys_env_set_status+0x12>
+  8009cb:	89 c2                	mov    %eax,%edx
+  8009cd:	c1 ea 04             	shr    $0x4,%edx
+  8009d0:	83 e2 0f             	and    $0xf,%edx
+  8009d3:	83 fa 02             	cmp    $0x2,%edx
+  8009d6:	77 e5                	ja     8009bd <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  8009d8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8009db:	83 f8 02             	cmp    $0x2,%eax
+  8009de:	0f 97 c1             	seta   %cl
+  8009e1:	0f b6 c9             	movzbl %cl,%ecx
+  8009e4:	eb d7                	jmp    8009bd <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  8009e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009eb:	b8 08 00 00 00       	mov    $0x8,%eax
+  8009f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009f6:	89 df                	mov    %ebx,%edi
+  8009f8:	89 de                	mov    %ebx,%esi
+  8009fa:	cd 30                	int    $0x30
+  8009fc:	eb 90                	jmp    80098e <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8009fe:	83 ec 0c             	sub    $0xc,%esp
+  800a01:	50                   	push   %eax
+  800a02:	6a 08                	push   $0x8
+  800a04:	68 6a 28 80 00       	push   $0x80286a
+  800a09:	6a 4a                	push   $0x4a
+  800a0b:	68 87 28 80 00       	push   $0x802887
+  800a10:	e8 30 12 00 00       	call   801c45 <_panic>
+
+00800a15 <sys_sysinfo>:
+{
+  800a15:	55                   	push   %ebp
+  800a16:	89 e5                	mov    %esp,%ebp
+  800a18:	57                   	push   %edi
+  800a19:	56                   	push   %esi
+  800a1a:	53                   	push   %ebx
+  800a1b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800a1e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800a25:	78 36                	js     800a5d <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  800a27:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800a2e:	74 79                	je     800aa9 <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  800a30:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a33:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a38:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800a3d:	89 cb                	mov    %ecx,%ebx
+  800a3f:	89 cf                	mov    %ecx,%edi
+  800a41:	89 ce                	mov    %ecx,%esi
+  800a43:	55                   	push   %ebp
+  800a44:	68 4d 0a 80 00       	push   $0x800a4d
+  800a49:	89 e5                	mov    %esp,%ebp
+  800a4b:	0f 34                	sysenter
+  800a4d:	83 c4 04             	add    $0x4,%esp
+  800a50:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800a51:	85 c0                	test   %eax,%eax
+  800a53:	7f 6b                	jg     800ac0 <sys_sysinfo+0xab>
+}
+  800a55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a58:	5b                   	pop    %ebx
+  800a59:	5e                   	pop    %esi
+  800a5a:	5f                   	pop    %edi
+  800a5b:	5d                   	pop    %ebp
+  800a5c:	c3                   	ret
+  800a5d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800a62:	0f a2                	cpuid
+		return 0;
+  800a64:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800a69:	f6 c6 08             	test   $0x8,%dh
+  800a6c:	74 15                	je     800a83 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800a6e:	89 c2                	mov    %eax,%edx
+  800a70:	c1 ea 08             	shr    $0x8,%edx
+  800a73:	83 e2 0f             	and    $0xf,%edx
+  800a76:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800a7b:	83 fa 06             	cmp    $0x6,%edx
+  800a7e:	74 0e                	je     800a8e <sys_sysinfo+0x79>
+  800a80:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800a83:	0f b6 c9             	movzbl %cl,%ecx
+  800a86:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800a8c:	eb 99                	jmp    800a27 <sys_sysinfo+0x12>
+  800a8e:	89 c2                	mov    %eax,%edx
+  800a90:	c1 ea 04             	shr    $0x4,%edx
+  800a93:	83 e2 0f             	and    $0xf,%edx
+  800a96:	83 fa 02             	cmp    $0x2,%edx
+  800a99:	77 e5                	ja     800a80 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  800a9b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800a9e:	83 f8 02             	cmp    $0x2,%eax
+  800aa1:	0f 97 c1             	seta   %cl
+  800aa4:	0f b6 c9             	movzbl %cl,%ecx
+  800aa7:	eb d7                	jmp    800a80 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  800aa9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aae:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ab3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ab6:	89 cb                	mov    %ecx,%ebx
+  800ab8:	89 cf                	mov    %ecx,%edi
+  800aba:	89 ce                	mov    %ecx,%esi
+  800abc:	cd 30                	int    $0x30
+  800abe:	eb 91                	jmp    800a51 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ac0:	83 ec 0c             	sub    $0xc,%esp
+  800ac3:	50                   	push   %eax
+  800ac4:	6a 0b                	push   $0xb
+  800ac6:	68 6a 28 80 00       	push   $0x80286a
+  800acb:	6a 4a                	push   $0x4a
+  800acd:	68 87 28 80 00       	push   $0x802887
+  800ad2:	e8 6e 11 00 00       	call   801c45 <_panic>
+
+00800ad7 <sys_env_set_trapframe>:
+{
+  800ad7:	55                   	push   %ebp
+  800ad8:	89 e5                	mov    %esp,%ebp
+  800ada:	57                   	push   %edi
+  800adb:	56                   	push   %esi
+  800adc:	53                   	push   %ebx
+  800add:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800ae0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ae7:	78 37                	js     800b20 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  800ae9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800af0:	74 7a                	je     800b6c <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  800af2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800af7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800afa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800afd:	b8 13 00 00 00       	mov    $0x13,%eax
+  800b02:	89 df                	mov    %ebx,%edi
+  800b04:	89 de                	mov    %ebx,%esi
+  800b06:	55                   	push   %ebp
+  800b07:	68 10 0b 80 00       	push   $0x800b10
+  800b0c:	89 e5                	mov    %esp,%ebp
+  800b0e:	0f 34                	sysenter
+  800b10:	83 c4 04             	add    $0x4,%esp
+  800b13:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800b14:	85 c0                	test   %eax,%eax
+  800b16:	7f 6c                	jg     800b84 <sys_env_set_trapframe+0xad>
+}
+  800b18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b1b:	5b                   	pop    %ebx
+  800b1c:	5e                   	pop    %esi
+  800b1d:	5f                   	pop    %edi
+  800b1e:	5d                   	pop    %ebp
+  800b1f:	c3                   	ret
+  800b20:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b25:	0f a2                	cpuid
+		return 0;
+  800b27:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800b2c:	f6 c6 08             	test   $0x8,%dh
+  800b2f:	74 15                	je     800b46 <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800b31:	89 c2                	mov    %eax,%edx
+  800b33:	c1 ea 08             	shr    $0x8,%edx
+  800b36:	83 e2 0f             	and    $0xf,%edx
+  800b39:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800b3e:	83 fa 06             	cmp    $0x6,%edx
+  800b41:	74 0e                	je     800b51 <sys_env_set_trapframe+0x7a>
+  800b43:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800b46:	0f b6 c9             	movzbl %cl,%ecx
+  800b49:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800b4f:	eb 98                	jmp    800ae9 <sys_env_set_trapframe+0x12>
+  800b51:	89 c2                	mov    %eax,%edx
+  800b53:	c1 ea 04             	shr    $0x4,%edx
+  800b56:	83 e2 0f             	and    $0xf,%edx
+  800b59:	83 fa 02             	cmp    $0x2,%edx
+  800b5c:	77 e5                	ja     800b43 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  800b5e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800b61:	83 f8 02             	cmp    $0x2,%eax
+  800b64:	0f 97 c1             	seta   %cl
+  800b67:	0f b6 c9             	movzbl %cl,%ecx
+  800b6a:	eb d7                	jmp    800b43 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  800b6c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b71:	b8 13 00 00 00       	mov    $0x13,%eax
+  800b76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b7c:	89 df                	mov    %ebx,%edi
+  800b7e:	89 de                	mov    %ebx,%esi
+  800b80:	cd 30                	int    $0x30
+  800b82:	eb 90                	jmp    800b14 <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b84:	83 ec 0c             	sub    $0xc,%esp
+  800b87:	50                   	push   %eax
+  800b88:	6a 13                	push   $0x13
+  800b8a:	68 6a 28 80 00       	push   $0x80286a
+  800b8f:	6a 4a                	push   $0x4a
+  800b91:	68 87 28 80 00       	push   $0x802887
+  800b96:	e8 aa 10 00 00       	call   801c45 <_panic>
+
+00800b9b <sys_env_set_stack_limit>:
+{
+  800b9b:	55                   	push   %ebp
+  800b9c:	89 e5                	mov    %esp,%ebp
+  800b9e:	57                   	push   %edi
+  800b9f:	56                   	push   %esi
+  800ba0:	53                   	push   %ebx
+  800ba1:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800ba4:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800bab:	78 37                	js     800be4 <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  800bad:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800bb4:	74 7a                	je     800c30 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  800bb6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bbb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bbe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bc1:	b8 19 00 00 00       	mov    $0x19,%eax
+  800bc6:	89 df                	mov    %ebx,%edi
+  800bc8:	89 de                	mov    %ebx,%esi
+  800bca:	55                   	push   %ebp
+  800bcb:	68 d4 0b 80 00       	push   $0x800bd4
+  800bd0:	89 e5                	mov    %esp,%ebp
+  800bd2:	0f 34                	sysenter
+  800bd4:	83 c4 04             	add    $0x4,%esp
+  800bd7:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800bd8:	85 c0                	test   %eax,%eax
+  800bda:	7f 6c                	jg     800c48 <sys_env_set_stack_limit+0xad>
+}
+  800bdc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bdf:	5b                   	pop    %ebx
+  800be0:	5e                   	pop    %esi
+  800be1:	5f                   	pop    %edi
+  800be2:	5d                   	pop    %ebp
+  800be3:	c3                   	ret
+  800be4:	b8 01 00 00 00       	mov    $0x1,%eax
+  800be9:	0f a2                	cpuid
+		return 0;
+  800beb:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800bf0:	f6 c6 08             	test   $0x8,%dh
+  800bf3:	74 15                	je     800c0a <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800bf5:	89 c2                	mov    %eax,%edx
+  800bf7:	c1 ea 08             	shr    $0x8,%edx
+  800bfa:	83 e2 0f             	and    $0xf,%edx
+  800bfd:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800c02:	83 fa 06             	cmp    $0x6,%edx
+  800c05:	74 0e                	je     800c15 <sys_env_set_stack_limit+0x7a>
+  800c07:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800c0a:	0f b6 c9             	movzbl %cl,%ecx
+  800c0d:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800c13:	eb 98                	jmp    800bad <sys_env_set_stack_limit+0x12>
+  800c15:	89 c2                	mov    %eax,%edx
+  800c17:	c1 ea 04             	shr    $0x4,%edx
+  800c1a:	83 e2 0f             	and    $0xf,%edx
+  800c1d:	83 fa 02             	cmp    $0x2,%edx
+  800c20:	77 e5                	ja     800c07 <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  800c22:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c25:	83 f8 02             	cmp    $0x2,%eax
+  800c28:	0f 97 c1             	seta   %cl
+  800c2b:	0f b6 c9             	movzbl %cl,%ecx
+  800c2e:	eb d7                	jmp    800c07 <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  800c30:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c35:	b8 19 00 00 00       	mov    $0x19,%eax
+  800c3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c40:	89 df                	mov    %ebx,%edi
+  800c42:	89 de                	mov    %ebx,%esi
+  800c44:	cd 30                	int    $0x30
+  800c46:	eb 90                	jmp    800bd8 <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c48:	83 ec 0c             	sub    $0xc,%esp
+  800c4b:	50                   	push   %eax
+  800c4c:	6a 19                	push   $0x19
+  800c4e:	68 6a 28 80 00       	push   $0x80286a
+  800c53:	6a 4a                	push   $0x4a
+  800c55:	68 87 28 80 00       	push   $0x802887
+  800c5a:	e8 e6 0f 00 00       	call   801c45 <_panic>
+
+00800c5f <sys_env_set_pgfault_upcall>:
+{
+  800c5f:	55                   	push   %ebp
+  800c60:	89 e5                	mov    %esp,%ebp
+  800c62:	57                   	push   %edi
+  800c63:	56                   	push   %esi
+  800c64:	53                   	push   %ebx
+  800c65:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800c68:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800c6f:	78 37                	js     800ca8 <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  800c71:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800c78:	74 7a                	je     800cf4 <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  800c7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c85:	b8 09 00 00 00       	mov    $0x9,%eax
+  800c8a:	89 df                	mov    %ebx,%edi
+  800c8c:	89 de                	mov    %ebx,%esi
+  800c8e:	55                   	push   %ebp
+  800c8f:	68 98 0c 80 00       	push   $0x800c98
+  800c94:	89 e5                	mov    %esp,%ebp
+  800c96:	0f 34                	sysenter
+  800c98:	83 c4 04             	add    $0x4,%esp
+  800c9b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c9c:	85 c0                	test   %eax,%eax
+  800c9e:	7f 6c                	jg     800d0c <sys_env_set_pgfault_upcall+0xad>
+}
+  800ca0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ca3:	5b                   	pop    %ebx
+  800ca4:	5e                   	pop    %esi
+  800ca5:	5f                   	pop    %edi
+  800ca6:	5d                   	pop    %ebp
+  800ca7:	c3                   	ret
+  800ca8:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cad:	0f a2                	cpuid
+		return 0;
+  800caf:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800cb4:	f6 c6 08             	test   $0x8,%dh
+  800cb7:	74 15                	je     800cce <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800cb9:	89 c2                	mov    %eax,%edx
+  800cbb:	c1 ea 08             	shr    $0x8,%edx
+  800cbe:	83 e2 0f             	and    $0xf,%edx
+  800cc1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800cc6:	83 fa 06             	cmp    $0x6,%edx
+  800cc9:	74 0e                	je     800cd9 <sys_env_set_pgfault_upcall+0x7a>
+  800ccb:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800cce:	0f b6 c9             	movzbl %cl,%ecx
+  800cd1:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800cd7:	eb 98                	jmp    800c71 <sys_env_set_pgfault_upcall+0x12>
+  800cd9:	89 c2                	mov    %eax,%edx
+  800cdb:	c1 ea 04             	shr    $0x4,%edx
+  800cde:	83 e2 0f             	and    $0xf,%edx
+  800ce1:	83 fa 02             	cmp    $0x2,%edx
+  800ce4:	77 e5                	ja     800ccb <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  800ce6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ce9:	83 f8 02             	cmp    $0x2,%eax
+  800cec:	0f 97 c1             	seta   %cl
+  800cef:	0f b6 c9             	movzbl %cl,%ecx
+  800cf2:	eb d7                	jmp    800ccb <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  800cf4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cf9:	b8 09 00 00 00       	mov    $0x9,%eax
+  800cfe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d01:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d04:	89 df                	mov    %ebx,%edi
+  800d06:	89 de                	mov    %ebx,%esi
+  800d08:	cd 30                	int    $0x30
+  800d0a:	eb 90                	jmp    800c9c <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d0c:	83 ec 0c             	sub    $0xc,%esp
+  800d0f:	50                   	push   %eax
+  800d10:	6a 09                	push   $0x9
+  800d12:	68 6a 28 80 00       	push   $0x80286a
+  800d17:	6a 4a                	push   $0x4a
+  800d19:	68 87 28 80 00       	push   $0x802887
+  800d1e:	e8 22 0f 00 00       	call   801c45 <_panic>
+
+00800d23 <sys_ipc_try_send>:
+{
+  800d23:	55                   	push   %ebp
+  800d24:	89 e5                	mov    %esp,%ebp
+  800d26:	57                   	push   %edi
+  800d27:	56                   	push   %esi
+  800d28:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800d29:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d30:	78 32                	js     800d64 <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  800d32:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d39:	74 75                	je     800db0 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  800d3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d41:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d46:	be 00 00 00 00       	mov    $0x0,%esi
+  800d4b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d4e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d51:	55                   	push   %ebp
+  800d52:	68 5b 0d 80 00       	push   $0x800d5b
+  800d57:	89 e5                	mov    %esp,%ebp
+  800d59:	0f 34                	sysenter
+  800d5b:	83 c4 04             	add    $0x4,%esp
+  800d5e:	5d                   	pop    %ebp
+}
+  800d5f:	5b                   	pop    %ebx
+  800d60:	5e                   	pop    %esi
+  800d61:	5f                   	pop    %edi
+  800d62:	5d                   	pop    %ebp
+  800d63:	c3                   	ret
+  800d64:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d69:	0f a2                	cpuid
+		return 0;
+  800d6b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800d70:	f6 c6 08             	test   $0x8,%dh
+  800d73:	74 15                	je     800d8a <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d75:	89 c2                	mov    %eax,%edx
+  800d77:	c1 ea 08             	shr    $0x8,%edx
+  800d7a:	83 e2 0f             	and    $0xf,%edx
+  800d7d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d82:	83 fa 06             	cmp    $0x6,%edx
+  800d85:	74 0e                	je     800d95 <sys_ipc_try_send+0x72>
+  800d87:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800d8a:	0f b6 c9             	movzbl %cl,%ecx
+  800d8d:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800d93:	eb 9d                	jmp    800d32 <sys_ipc_try_send+0xf>
+  800d95:	89 c2                	mov    %eax,%edx
+  800d97:	c1 ea 04             	shr    $0x4,%edx
+  800d9a:	83 e2 0f             	and    $0xf,%edx
+  800d9d:	83 fa 02             	cmp    $0x2,%edx
+  800da0:	77 e5                	ja     800d87 <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  800da2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800da5:	83 f8 02             	cmp    $0x2,%eax
+  800da8:	0f 97 c1             	seta   %cl
+  800dab:	0f b6 c9             	movzbl %cl,%ecx
+  800dae:	eb d7                	jmp    800d87 <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  800db0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800db5:	be 00 00 00 00       	mov    $0x0,%esi
+  800dba:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dc3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dc6:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  800dc8:	eb 95                	jmp    800d5f <sys_ipc_try_send+0x3c>
+
+00800dca <sys_ipc_send>:
+{
+  800dca:	55                   	push   %ebp
+  800dcb:	89 e5                	mov    %esp,%ebp
+  800dcd:	57                   	push   %edi
+  800dce:	56                   	push   %esi
+  800dcf:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800dd0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800dd7:	78 32                	js     800e0b <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  800dd9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800de0:	74 75                	je     800e57 <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  800de2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800ded:	be 00 00 00 00       	mov    $0x0,%esi
+  800df2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800df5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800df8:	55                   	push   %ebp
+  800df9:	68 02 0e 80 00       	push   $0x800e02
+  800dfe:	89 e5                	mov    %esp,%ebp
+  800e00:	0f 34                	sysenter
+  800e02:	83 c4 04             	add    $0x4,%esp
+  800e05:	5d                   	pop    %ebp
+}
+  800e06:	5b                   	pop    %ebx
+  800e07:	5e                   	pop    %esi
+  800e08:	5f                   	pop    %edi
+  800e09:	5d                   	pop    %ebp
+  800e0a:	c3                   	ret
+  800e0b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e10:	0f a2                	cpuid
+		return 0;
+  800e12:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800e17:	f6 c6 08             	test   $0x8,%dh
+  800e1a:	74 15                	je     800e31 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e1c:	89 c2                	mov    %eax,%edx
+  800e1e:	c1 ea 08             	shr    $0x8,%edx
+  800e21:	83 e2 0f             	and    $0xf,%edx
+  800e24:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e29:	83 fa 06             	cmp    $0x6,%edx
+  800e2c:	74 0e                	je     800e3c <sys_ipc_send+0x72>
+  800e2e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e31:	0f b6 c9             	movzbl %cl,%ecx
+  800e34:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800e3a:	eb 9d                	jmp    800dd9 <sys_ipc_send+0xf>
+  800e3c:	89 c2                	mov    %eax,%edx
+  800e3e:	c1 ea 04             	shr    $0x4,%edx
+  800e41:	83 e2 0f             	and    $0xf,%edx
+  800e44:	83 fa 02             	cmp    $0x2,%edx
+  800e47:	77 e5                	ja     800e2e <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  800e49:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e4c:	83 f8 02             	cmp    $0x2,%eax
+  800e4f:	0f 97 c1             	seta   %cl
+  800e52:	0f b6 c9             	movzbl %cl,%ecx
+  800e55:	eb d7                	jmp    800e2e <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  800e57:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800e5c:	be 00 00 00 00       	mov    $0x0,%esi
+  800e61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e67:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e6a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e6d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  800e6f:	eb 95                	jmp    800e06 <sys_ipc_send+0x3c>
+
+00800e71 <sys_ipc_recv>:
+{
+  800e71:	55                   	push   %ebp
+  800e72:	89 e5                	mov    %esp,%ebp
+  800e74:	57                   	push   %edi
+  800e75:	56                   	push   %esi
+  800e76:	53                   	push   %ebx
+  800e77:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800e7a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e81:	78 36                	js     800eb9 <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  800e83:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e8a:	74 79                	je     800f05 <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  800e8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e94:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e99:	89 cb                	mov    %ecx,%ebx
+  800e9b:	89 cf                	mov    %ecx,%edi
+  800e9d:	89 ce                	mov    %ecx,%esi
+  800e9f:	55                   	push   %ebp
+  800ea0:	68 a9 0e 80 00       	push   $0x800ea9
+  800ea5:	89 e5                	mov    %esp,%ebp
+  800ea7:	0f 34                	sysenter
+  800ea9:	83 c4 04             	add    $0x4,%esp
+  800eac:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ead:	85 c0                	test   %eax,%eax
+  800eaf:	7f 6b                	jg     800f1c <sys_ipc_recv+0xab>
+}
+  800eb1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eb4:	5b                   	pop    %ebx
+  800eb5:	5e                   	pop    %esi
+  800eb6:	5f                   	pop    %edi
+  800eb7:	5d                   	pop    %ebp
+  800eb8:	c3                   	ret
+  800eb9:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ebe:	0f a2                	cpuid
+		return 0;
+  800ec0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800ec5:	f6 c6 08             	test   $0x8,%dh
+  800ec8:	74 15                	je     800edf <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800eca:	89 c2                	mov    %eax,%edx
+  800ecc:	c1 ea 08             	shr    $0x8,%edx
+  800ecf:	83 e2 0f             	and    $0xf,%edx
+  800ed2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ed7:	83 fa 06             	cmp    $0x6,%edx
+  800eda:	74 0e                	je     800eea <sys_ipc_recv+0x79>
+  800edc:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800edf:	0f b6 c9             	movzbl %cl,%ecx
+  800ee2:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800ee8:	eb 99                	jmp    800e83 <sys_ipc_recv+0x12>
+  800eea:	89 c2                	mov    %eax,%edx
+  800eec:	c1 ea 04             	shr    $0x4,%edx
+  800eef:	83 e2 0f             	and    $0xf,%edx
+  800ef2:	83 fa 02             	cmp    $0x2,%edx
+  800ef5:	77 e5                	ja     800edc <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  800ef7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800efa:	83 f8 02             	cmp    $0x2,%eax
+  800efd:	0f 97 c1             	seta   %cl
+  800f00:	0f b6 c9             	movzbl %cl,%ecx
+  800f03:	eb d7                	jmp    800edc <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  800f05:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f0a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f0f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f12:	89 cb                	mov    %ecx,%ebx
+  800f14:	89 cf                	mov    %ecx,%edi
+  800f16:	89 ce                	mov    %ecx,%esi
+  800f18:	cd 30                	int    $0x30
+  800f1a:	eb 91                	jmp    800ead <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f1c:	83 ec 0c             	sub    $0xc,%esp
+  800f1f:	50                   	push   %eax
+  800f20:	6a 0d                	push   $0xd
+  800f22:	68 6a 28 80 00       	push   $0x80286a
+  800f27:	6a 4a                	push   $0x4a
+  800f29:	68 87 28 80 00       	push   $0x802887
+  800f2e:	e8 12 0d 00 00       	call   801c45 <_panic>
+
+00800f33 <sys_ipc_send_range>:
+{
+  800f33:	55                   	push   %ebp
+  800f34:	89 e5                	mov    %esp,%ebp
+  800f36:	57                   	push   %edi
+  800f37:	56                   	push   %esi
+  800f38:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800f39:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f40:	78 30                	js     800f72 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  800f42:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f49:	74 73                	je     800fbe <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  800f4b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f51:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  800f56:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f59:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f5c:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f5f:	55                   	push   %ebp
+  800f60:	68 69 0f 80 00       	push   $0x800f69
+  800f65:	89 e5                	mov    %esp,%ebp
+  800f67:	0f 34                	sysenter
+  800f69:	83 c4 04             	add    $0x4,%esp
+  800f6c:	5d                   	pop    %ebp
+}
+  800f6d:	5b                   	pop    %ebx
+  800f6e:	5e                   	pop    %esi
+  800f6f:	5f                   	pop    %edi
+  800f70:	5d                   	pop    %ebp
+  800f71:	c3                   	ret
+  800f72:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f77:	0f a2                	cpuid
+		return 0;
+  800f79:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f7e:	f6 c6 08             	test   $0x8,%dh
+  800f81:	74 15                	je     800f98 <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f83:	89 c2                	mov    %eax,%edx
+  800f85:	c1 ea 08             	shr    $0x8,%edx
+  800f88:	83 e2 0f             	and    $0xf,%edx
+  800f8b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f90:	83 fa 06             	cmp    $0x6,%edx
+  800f93:	74 0e                	je     800fa3 <sys_ipc_send_range+0x70>
+  800f95:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f98:	0f b6 c9             	movzbl %cl,%ecx
+  800f9b:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800fa1:	eb 9f                	jmp    800f42 <sys_ipc_send_range+0xf>
+  800fa3:	89 c2                	mov    %eax,%edx
+  800fa5:	c1 ea 04             	shr    $0x4,%edx
+  800fa8:	83 e2 0f             	and    $0xf,%edx
+  800fab:	83 fa 02             	cmp    $0x2,%edx
+  800fae:	77 e5                	ja     800f95 <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  800fb0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800fb3:	83 f8 02             	cmp    $0x2,%eax
+  800fb6:	0f 97 c1             	seta   %cl
+  800fb9:	0f b6 c9             	movzbl %cl,%ecx
+  800fbc:	eb d7                	jmp    800f95 <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  800fbe:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  800fc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fcc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fcf:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fd2:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  800fd4:	eb 97                	jmp    800f6d <sys_ipc_send_range+0x3a>
+
+00800fd6 <sys_ipc_recv_range>:
+{
+  800fd6:	55                   	push   %ebp
+  800fd7:	89 e5                	mov    %esp,%ebp
+  800fd9:	57                   	push   %edi
+  800fda:	56                   	push   %esi
+  800fdb:	53                   	push   %ebx
+  800fdc:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800fdf:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fe6:	78 37                	js     80101f <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  800fe8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fef:	74 7a                	je     80106b <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  800ff1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ffc:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801001:	89 df                	mov    %ebx,%edi
+  801003:	89 de                	mov    %ebx,%esi
+  801005:	55                   	push   %ebp
+  801006:	68 0f 10 80 00       	push   $0x80100f
+  80100b:	89 e5                	mov    %esp,%ebp
+  80100d:	0f 34                	sysenter
+  80100f:	83 c4 04             	add    $0x4,%esp
+  801012:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801013:	85 c0                	test   %eax,%eax
+  801015:	7f 6c                	jg     801083 <sys_ipc_recv_range+0xad>
+}
+  801017:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80101a:	5b                   	pop    %ebx
+  80101b:	5e                   	pop    %esi
+  80101c:	5f                   	pop    %edi
+  80101d:	5d                   	pop    %ebp
+  80101e:	c3                   	ret
+  80101f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801024:	0f a2                	cpuid
+		return 0;
+  801026:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80102b:	f6 c6 08             	test   $0x8,%dh
+  80102e:	74 15                	je     801045 <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801030:	89 c2                	mov    %eax,%edx
+  801032:	c1 ea 08             	shr    $0x8,%edx
+  801035:	83 e2 0f             	and    $0xf,%edx
+  801038:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80103d:	83 fa 06             	cmp    $0x6,%edx
+  801040:	74 0e                	je     801050 <sys_ipc_recv_range+0x7a>
+  801042:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801045:	0f b6 c9             	movzbl %cl,%ecx
+  801048:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80104e:	eb 98                	jmp    800fe8 <sys_ipc_recv_range+0x12>
+  801050:	89 c2                	mov    %eax,%edx
+  801052:	c1 ea 04             	shr    $0x4,%edx
+  801055:	83 e2 0f             	and    $0xf,%edx
+  801058:	83 fa 02             	cmp    $0x2,%edx
+  80105b:	77 e5                	ja     801042 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  80105d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801060:	83 f8 02             	cmp    $0x2,%eax
+  801063:	0f 97 c1             	seta   %cl
+  801066:	0f b6 c9             	movzbl %cl,%ecx
+  801069:	eb d7                	jmp    801042 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  80106b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801070:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801075:	8b 55 08             	mov    0x8(%ebp),%edx
+  801078:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107b:	89 df                	mov    %ebx,%edi
+  80107d:	89 de                	mov    %ebx,%esi
+  80107f:	cd 30                	int    $0x30
+  801081:	eb 90                	jmp    801013 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801083:	83 ec 0c             	sub    $0xc,%esp
+  801086:	50                   	push   %eax
+  801087:	6a 1f                	push   $0x1f
+  801089:	68 6a 28 80 00       	push   $0x80286a
+  80108e:	6a 4a                	push   $0x4a
+  801090:	68 87 28 80 00       	push   $0x802887
+  801095:	e8 ab 0b 00 00       	call   801c45 <_panic>
+
+0080109a <sys_ipc_call>:
+{
+  80109a:	55                   	push   %ebp
+  80109b:	89 e5                	mov    %esp,%ebp
+  80109d:	57                   	push   %edi
+  80109e:	56                   	push   %esi
+  80109f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8010a8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8010ab:	55                   	push   %ebp
+  8010ac:	56                   	push   %esi
+  8010ad:	8b 0e                	mov    (%esi),%ecx
+  8010af:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8010b2:	8b 7e 08             	mov    0x8(%esi),%edi
+  8010b5:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8010b8:	8b 76 0c             	mov    0xc(%esi),%esi
+  8010bb:	cd 30                	int    $0x30
+  8010bd:	87 34 24             	xchg   %esi,(%esp)
+  8010c0:	89 0e                	mov    %ecx,(%esi)
+  8010c2:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8010c5:	89 7e 08             	mov    %edi,0x8(%esi)
+  8010c8:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8010cb:	8f 46 0c             	pop    0xc(%esi)
+  8010ce:	5d                   	pop    %ebp
+}
+  8010cf:	5b                   	pop    %ebx
+  8010d0:	5e                   	pop    %esi
+  8010d1:	5f                   	pop    %edi
+  8010d2:	5d                   	pop    %ebp
+  8010d3:	c3                   	ret
+
+008010d4 <sys_ipc_reply_wait>:
+{
+  8010d4:	55                   	push   %ebp
+  8010d5:	89 e5                	mov    %esp,%ebp
+  8010d7:	57                   	push   %edi
+  8010d8:	56                   	push   %esi
+  8010d9:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010dd:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8010e2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8010e5:	55                   	push   %ebp
+  8010e6:	56                   	push   %esi
+  8010e7:	8b 0e                	mov    (%esi),%ecx
+  8010e9:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8010ec:	8b 7e 08             	mov    0x8(%esi),%edi
+  8010ef:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8010f2:	8b 76 0c             	mov    0xc(%esi),%esi
+  8010f5:	cd 30                	int    $0x30
+  8010f7:	87 34 24             	xchg   %esi,(%esp)
+  8010fa:	89 0e                	mov    %ecx,(%esi)
+  8010fc:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8010ff:	89 7e 08             	mov    %edi,0x8(%esi)
+  801102:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801105:	8f 46 0c             	pop    0xc(%esi)
+  801108:	5d                   	pop    %ebp
+}
+  801109:	5b                   	pop    %ebx
+  80110a:	5e                   	pop    %esi
+  80110b:	5f                   	pop    %edi
+  80110c:	5d                   	pop    %ebp
+  80110d:	c3                   	ret
+
+0080110e <sys_ipc_send_msg>:
+{
+  80110e:	55                   	push   %ebp
+  80110f:	89 e5                	mov    %esp,%ebp
+  801111:	57                   	push   %edi
+  801112:	56                   	push   %esi
+  801113:	53                   	push   %ebx
+  801114:	83 ec 20             	sub    $0x20,%esp
+  801117:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  80111a:	8b 10                	mov    (%eax),%edx
+  80111c:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  80111f:	8b 50 04             	mov    0x4(%eax),%edx
+  801122:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801125:	8b 50 08             	mov    0x8(%eax),%edx
+  801128:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  80112b:	8b 50 0c             	mov    0xc(%eax),%edx
+  80112e:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801131:	8b 40 10             	mov    0x10(%eax),%eax
+  801134:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801137:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  80113a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801142:	55                   	push   %ebp
+  801143:	56                   	push   %esi
+  801144:	8b 0e                	mov    (%esi),%ecx
+  801146:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801149:	8b 7e 08             	mov    0x8(%esi),%edi
+  80114c:	8b 6e 10             	mov    0x10(%esi),%ebp
+  80114f:	8b 76 0c             	mov    0xc(%esi),%esi
+  801152:	cd 30                	int    $0x30
+  801154:	87 34 24             	xchg   %esi,(%esp)
+  801157:	89 0e                	mov    %ecx,(%esi)
+  801159:	89 5e 04             	mov    %ebx,0x4(%esi)
+  80115c:	89 7e 08             	mov    %edi,0x8(%esi)
+  80115f:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801162:	8f 46 0c             	pop    0xc(%esi)
+  801165:	5d                   	pop    %ebp
+}
+  801166:	83 c4 20             	add    $0x20,%esp
+  801169:	5b                   	pop    %ebx
+  80116a:	5e                   	pop    %esi
+  80116b:	5f                   	pop    %edi
+  80116c:	5d                   	pop    %ebp
+  80116d:	c3                   	ret
+
+0080116e <sys_fork>:
+{
+  80116e:	55                   	push   %ebp
+  80116f:	89 e5                	mov    %esp,%ebp
+  801171:	57                   	push   %edi
+  801172:	56                   	push   %esi
+  801173:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801174:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80117b:	78 2e                	js     8011ab <sys_fork+0x3d>
+	if (syscall_sysenter)
+  80117d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801184:	74 71                	je     8011f7 <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801186:	ba 00 00 00 00       	mov    $0x0,%edx
+  80118b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801190:	89 d1                	mov    %edx,%ecx
+  801192:	89 d3                	mov    %edx,%ebx
+  801194:	89 d7                	mov    %edx,%edi
+  801196:	89 d6                	mov    %edx,%esi
+  801198:	55                   	push   %ebp
+  801199:	68 a2 11 80 00       	push   $0x8011a2
+  80119e:	89 e5                	mov    %esp,%ebp
+  8011a0:	0f 34                	sysenter
+  8011a2:	83 c4 04             	add    $0x4,%esp
+  8011a5:	5d                   	pop    %ebp
+}
+  8011a6:	5b                   	pop    %ebx
+  8011a7:	5e                   	pop    %esi
+  8011a8:	5f                   	pop    %edi
+  8011a9:	5d                   	pop    %ebp
+  8011aa:	c3                   	ret
+  8011ab:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011b0:	0f a2                	cpuid
+		return 0;
+  8011b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8011b7:	f6 c6 08             	test   $0x8,%dh
+  8011ba:	74 15                	je     8011d1 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011bc:	89 c2                	mov    %eax,%edx
+  8011be:	c1 ea 08             	shr    $0x8,%edx
+  8011c1:	83 e2 0f             	and    $0xf,%edx
+  8011c4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011c9:	83 fa 06             	cmp    $0x6,%edx
+  8011cc:	74 0e                	je     8011dc <sys_fork+0x6e>
+  8011ce:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8011d1:	0f b6 c9             	movzbl %cl,%ecx
+  8011d4:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8011da:	eb a1                	jmp    80117d <sys_fork+0xf>
+  8011dc:	89 c2                	mov    %eax,%edx
+  8011de:	c1 ea 04             	shr    $0x4,%edx
+  8011e1:	83 e2 0f             	and    $0xf,%edx
+  8011e4:	83 fa 02             	cmp    $0x2,%edx
+  8011e7:	77 e5                	ja     8011ce <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  8011e9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011ec:	83 f8 02             	cmp    $0x2,%eax
+  8011ef:	0f 97 c1             	seta   %cl
+  8011f2:	0f b6 c9             	movzbl %cl,%ecx
+  8011f5:	eb d7                	jmp    8011ce <sys_fork+0x60>
+		asm volatile("int %1\n"
+  8011f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011fc:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801201:	89 d1                	mov    %edx,%ecx
+  801203:	89 d3                	mov    %edx,%ebx
+  801205:	89 d7                	mov    %edx,%edi
+  801207:	89 d6                	mov    %edx,%esi
+  801209:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  80120b:	eb 99                	jmp    8011a6 <sys_fork+0x38>
+
+0080120d <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  80120d:	55                   	push   %ebp
+  80120e:	89 e5                	mov    %esp,%ebp
+  801210:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801213:	ff 75 14             	push   0x14(%ebp)
+  801216:	ff 75 10             	push   0x10(%ebp)
+  801219:	ff 75 0c             	push   0xc(%ebp)
+  80121c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801221:	8b 55 08             	mov    0x8(%ebp),%edx
+  801224:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801229:	e8 81 ee ff ff       	call   8000af <page_vec_call>
+}
+  80122e:	c9                   	leave
+  80122f:	c3                   	ret
+
+00801230 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801230:	55                   	push   %ebp
+  801231:	89 e5                	mov    %esp,%ebp
+  801233:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801236:	ff 75 18             	push   0x18(%ebp)
+  801239:	ff 75 14             	push   0x14(%ebp)
+  80123c:	ff 75 10             	push   0x10(%ebp)
+  80123f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801242:	8b 55 08             	mov    0x8(%ebp),%edx
+  801245:	b8 10 00 00 00       	mov    $0x10,%eax
+  80124a:	e8 60 ee ff ff       	call   8000af <page_vec_call>
+}
+  80124f:	c9                   	leave
+  801250:	c3                   	ret
+
+00801251 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801251:	55                   	push   %ebp
+  801252:	89 e5                	mov    %esp,%ebp
+  801254:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801257:	ff 75 14             	push   0x14(%ebp)
+  80125a:	ff 75 10             	push   0x10(%ebp)
+  80125d:	ff 75 0c             	push   0xc(%ebp)
+  801260:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801265:	8b 55 08             	mov    0x8(%ebp),%edx
+  801268:	b8 11 00 00 00       	mov    $0x11,%eax
+  80126d:	e8 3d ee ff ff       	call   8000af <page_vec_call>
+}
+  801272:	c9                   	leave
+  801273:	c3                   	ret
+
+00801274 <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801274:	55                   	push   %ebp
+  801275:	89 e5                	mov    %esp,%ebp
+  801277:	57                   	push   %edi
+  801278:	56                   	push   %esi
+  801279:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80127a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801281:	78 32                	js     8012b5 <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801283:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80128a:	74 75                	je     801301 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  80128c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80128f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801292:	b8 12 00 00 00       	mov    $0x12,%eax
+  801297:	be 00 00 00 00       	mov    $0x0,%esi
+  80129c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80129f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012a2:	55                   	push   %ebp
+  8012a3:	68 ac 12 80 00       	push   $0x8012ac
+  8012a8:	89 e5                	mov    %esp,%ebp
+  8012aa:	0f 34                	sysenter
+  8012ac:	83 c4 04             	add    $0x4,%esp
+  8012af:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  8012b0:	5b                   	pop    %ebx
+  8012b1:	5e                   	pop    %esi
+  8012b2:	5f                   	pop    %edi
+  8012b3:	5d                   	pop    %ebp
+  8012b4:	c3                   	ret
+  8012b5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012ba:	0f a2                	cpuid
+		return 0;
+  8012bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8012c1:	f6 c6 08             	test   $0x8,%dh
+  8012c4:	74 15                	je     8012db <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012c6:	89 c2                	mov    %eax,%edx
+  8012c8:	c1 ea 08             	shr    $0x8,%edx
+  8012cb:	83 e2 0f             	and    $0xf,%edx
+  8012ce:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012d3:	83 fa 06             	cmp    $0x6,%edx
+  8012d6:	74 0e                	je     8012e6 <sys_vm_ranges+0x72>
+  8012d8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8012db:	0f b6 c9             	movzbl %cl,%ecx
+  8012de:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8012e4:	eb 9d                	jmp    801283 <sys_vm_ranges+0xf>
+  8012e6:	89 c2                	mov    %eax,%edx
+  8012e8:	c1 ea 04             	shr    $0x4,%edx
+  8012eb:	83 e2 0f             	and    $0xf,%edx
+  8012ee:	83 fa 02             	cmp    $0x2,%edx
+  8012f1:	77 e5                	ja     8012d8 <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  8012f3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012f6:	83 f8 02             	cmp    $0x2,%eax
+  8012f9:	0f 97 c1             	seta   %cl
+  8012fc:	0f b6 c9             	movzbl %cl,%ecx
+  8012ff:	eb d7                	jmp    8012d8 <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801301:	b8 12 00 00 00       	mov    $0x12,%eax
+  801306:	be 00 00 00 00       	mov    $0x0,%esi
+  80130b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801311:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801314:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801317:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801319:	eb 95                	jmp    8012b0 <sys_vm_ranges+0x3c>
+
+0080131b <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  80131b:	55                   	push   %ebp
+  80131c:	89 e5                	mov    %esp,%ebp
+  80131e:	57                   	push   %edi
+  80131f:	56                   	push   %esi
+  801320:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801321:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801328:	78 31                	js     80135b <sys_spawn+0x40>
+	if (syscall_sysenter)
+  80132a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801331:	74 74                	je     8013a7 <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801333:	be 00 00 00 00       	mov    $0x0,%esi
+  801338:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80133e:	b8 14 00 00 00       	mov    $0x14,%eax
+  801343:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801346:	89 f7                	mov    %esi,%edi
+  801348:	55                   	push   %ebp
+  801349:	68 52 13 80 00       	push   $0x801352
+  80134e:	89 e5                	mov    %esp,%ebp
+  801350:	0f 34                	sysenter
+  801352:	83 c4 04             	add    $0x4,%esp
+  801355:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801356:	5b                   	pop    %ebx
+  801357:	5e                   	pop    %esi
+  801358:	5f                   	pop    %edi
+  801359:	5d                   	pop    %ebp
+  80135a:	c3                   	ret
+  80135b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801360:	0f a2                	cpuid
+		return 0;
+  801362:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801367:	f6 c6 08             	test   $0x8,%dh
+  80136a:	74 15                	je     801381 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80136c:	89 c2                	mov    %eax,%edx
+  80136e:	c1 ea 08             	shr    $0x8,%edx
+  801371:	83 e2 0f             	and    $0xf,%edx
+  801374:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801379:	83 fa 06             	cmp    $0x6,%edx
+  80137c:	74 0e                	je     80138c <sys_spawn+0x71>
+  80137e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801381:	0f b6 c9             	movzbl %cl,%ecx
+  801384:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80138a:	eb 9e                	jmp    80132a <sys_spawn+0xf>
+  80138c:	89 c2                	mov    %eax,%edx
+  80138e:	c1 ea 04             	shr    $0x4,%edx
+  801391:	83 e2 0f             	and    $0xf,%edx
+  801394:	83 fa 02             	cmp    $0x2,%edx
+  801397:	77 e5                	ja     80137e <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  801399:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80139c:	83 f8 02             	cmp    $0x2,%eax
+  80139f:	0f 97 c1             	seta   %cl
+  8013a2:	0f b6 c9             	movzbl %cl,%ecx
+  8013a5:	eb d7                	jmp    80137e <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  8013a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ac:	b8 14 00 00 00       	mov    $0x14,%eax
+  8013b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013ba:	89 f7                	mov    %esi,%edi
+  8013bc:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  8013be:	eb 96                	jmp    801356 <sys_spawn+0x3b>
+
+008013c0 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  8013c0:	55                   	push   %ebp
+  8013c1:	89 e5                	mov    %esp,%ebp
+  8013c3:	57                   	push   %edi
+  8013c4:	56                   	push   %esi
+  8013c5:	53                   	push   %ebx
+  8013c6:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8013c9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8013d0:	78 37                	js     801409 <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  8013d2:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8013d9:	74 7a                	je     801455 <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  8013db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e6:	b8 15 00 00 00       	mov    $0x15,%eax
+  8013eb:	89 df                	mov    %ebx,%edi
+  8013ed:	89 de                	mov    %ebx,%esi
+  8013ef:	55                   	push   %ebp
+  8013f0:	68 f9 13 80 00       	push   $0x8013f9
+  8013f5:	89 e5                	mov    %esp,%ebp
+  8013f7:	0f 34                	sysenter
+  8013f9:	83 c4 04             	add    $0x4,%esp
+  8013fc:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8013fd:	85 c0                	test   %eax,%eax
+  8013ff:	7f 6c                	jg     80146d <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  801401:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801404:	5b                   	pop    %ebx
+  801405:	5e                   	pop    %esi
+  801406:	5f                   	pop    %edi
+  801407:	5d                   	pop    %ebp
+  801408:	c3                   	ret
+  801409:	b8 01 00 00 00       	mov    $0x1,%eax
+  80140e:	0f a2                	cpuid
+		return 0;
+  801410:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801415:	f6 c6 08             	test   $0x8,%dh
+  801418:	74 15                	je     80142f <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80141a:	89 c2                	mov    %eax,%edx
+  80141c:	c1 ea 08             	shr    $0x8,%edx
+  80141f:	83 e2 0f             	and    $0xf,%edx
+  801422:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801427:	83 fa 06             	cmp    $0x6,%edx
+  80142a:	74 0e                	je     80143a <sys_shm_create+0x7a>
+  80142c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80142f:	0f b6 c9             	movzbl %cl,%ecx
+  801432:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801438:	eb 98                	jmp    8013d2 <sys_shm_create+0x12>
+  80143a:	89 c2                	mov    %eax,%edx
+  80143c:	c1 ea 04             	shr    $0x4,%edx
+  80143f:	83 e2 0f             	and    $0xf,%edx
+  801442:	83 fa 02             	cmp    $0x2,%edx
+  801445:	77 e5                	ja     80142c <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  801447:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80144a:	83 f8 02             	cmp    $0x2,%eax
+  80144d:	0f 97 c1             	seta   %cl
+  801450:	0f b6 c9             	movzbl %cl,%ecx
+  801453:	eb d7                	jmp    80142c <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  801455:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80145a:	b8 15 00 00 00       	mov    $0x15,%eax
+  80145f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801462:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801465:	89 df                	mov    %ebx,%edi
+  801467:	89 de                	mov    %ebx,%esi
+  801469:	cd 30                	int    $0x30
+  80146b:	eb 90                	jmp    8013fd <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80146d:	83 ec 0c             	sub    $0xc,%esp
+  801470:	50                   	push   %eax
+  801471:	6a 15                	push   $0x15
+  801473:	68 6a 28 80 00       	push   $0x80286a
+  801478:	6a 4a                	push   $0x4a
+  80147a:	68 87 28 80 00       	push   $0x802887
+  80147f:	e8 c1 07 00 00       	call   801c45 <_panic>
+
+00801484 <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  801484:	55                   	push   %ebp
+  801485:	89 e5                	mov    %esp,%ebp
+  801487:	57                   	push   %edi
+  801488:	56                   	push   %esi
+  801489:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80148a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801491:	78 32                	js     8014c5 <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  801493:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80149a:	74 75                	je     801511 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  80149c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80149f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014a2:	b8 16 00 00 00       	mov    $0x16,%eax
+  8014a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014af:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014b2:	55                   	push   %ebp
+  8014b3:	68 bc 14 80 00       	push   $0x8014bc
+  8014b8:	89 e5                	mov    %esp,%ebp
+  8014ba:	0f 34                	sysenter
+  8014bc:	83 c4 04             	add    $0x4,%esp
+  8014bf:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  8014c0:	5b                   	pop    %ebx
+  8014c1:	5e                   	pop    %esi
+  8014c2:	5f                   	pop    %edi
+  8014c3:	5d                   	pop    %ebp
+  8014c4:	c3                   	ret
+  8014c5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014ca:	0f a2                	cpuid
+		return 0;
+  8014cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8014d1:	f6 c6 08             	test   $0x8,%dh
+  8014d4:	74 15                	je     8014eb <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014d6:	89 c2                	mov    %eax,%edx
+  8014d8:	c1 ea 08             	shr    $0x8,%edx
+  8014db:	83 e2 0f             	and    $0xf,%edx
+  8014de:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8014e3:	83 fa 06             	cmp    $0x6,%edx
+  8014e6:	74 0e                	je     8014f6 <sys_shm_attach+0x72>
+  8014e8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8014eb:	0f b6 c9             	movzbl %cl,%ecx
+  8014ee:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8014f4:	eb 9d                	jmp    801493 <sys_shm_attach+0xf>
+  8014f6:	89 c2                	mov    %eax,%edx
+  8014f8:	c1 ea 04             	shr    $0x4,%edx
+  8014fb:	83 e2 0f             	and    $0xf,%edx
+  8014fe:	83 fa 02             	cmp    $0x2,%edx
+  801501:	77 e5                	ja     8014e8 <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  801503:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801506:	83 f8 02             	cmp    $0x2,%eax
+  801509:	0f 97 c1             	seta   %cl
+  80150c:	0f b6 c9             	movzbl %cl,%ecx
+  80150f:	eb d7                	jmp    8014e8 <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  801511:	b8 16 00 00 00       	mov    $0x16,%eax
+  801516:	be 00 00 00 00       	mov    $0x0,%esi
+  80151b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80151e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801521:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801524:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801527:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  801529:	eb 95                	jmp    8014c0 <sys_shm_attach+0x3c>
+
+0080152b <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  80152b:	55                   	push   %ebp
+  80152c:	89 e5                	mov    %esp,%ebp
+  80152e:	57                   	push   %edi
+  80152f:	56                   	push   %esi
+  801530:	53                   	push   %ebx
+  801531:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801534:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80153b:	78 38                	js     801575 <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  80153d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801544:	74 7b                	je     8015c1 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  801546:	be 00 00 00 00       	mov    $0x0,%esi
+  80154b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80154e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801551:	b8 17 00 00 00       	mov    $0x17,%eax
+  801556:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801559:	89 f7                	mov    %esi,%edi
+  80155b:	55                   	push   %ebp
+  80155c:	68 65 15 80 00       	push   $0x801565
+  801561:	89 e5                	mov    %esp,%ebp
+  801563:	0f 34                	sysenter
+  801565:	83 c4 04             	add    $0x4,%esp
+  801568:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801569:	85 c0                	test   %eax,%eax
+  80156b:	7f 6d                	jg     8015da <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  80156d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801570:	5b                   	pop    %ebx
+  801571:	5e                   	pop    %esi
+  801572:	5f                   	pop    %edi
+  801573:	5d                   	pop    %ebp
+  801574:	c3                   	ret
+  801575:	b8 01 00 00 00       	mov    $0x1,%eax
+  80157a:	0f a2                	cpuid
+		return 0;
+  80157c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801581:	f6 c6 08             	test   $0x8,%dh
+  801584:	74 15                	je     80159b <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801586:	89 c2                	mov    %eax,%edx
+  801588:	c1 ea 08             	shr    $0x8,%edx
+  80158b:	83 e2 0f             	and    $0xf,%edx
+  80158e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801593:	83 fa 06             	cmp    $0x6,%edx
+  801596:	74 0e                	je     8015a6 <sys_shm_detach+0x7b>
+  801598:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80159b:	0f b6 c9             	movzbl %cl,%ecx
+  80159e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8015a4:	eb 97                	jmp    80153d <sys_shm_detach+0x12>
+  8015a6:	89 c2                	mov    %eax,%edx
+  8015a8:	c1 ea 04             	shr    $0x4,%edx
+  8015ab:	83 e2 0f             	and    $0xf,%edx
+  8015ae:	83 fa 02             	cmp    $0x2,%edx
+  8015b1:	77 e5                	ja     801598 <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  8015b3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015b6:	83 f8 02             	cmp    $0x2,%eax
+  8015b9:	0f 97 c1             	seta   %cl
+  8015bc:	0f b6 c9             	movzbl %cl,%ecx
+  8015bf:	eb d7                	jmp    801598 <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  8015c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8015c6:	b8 17 00 00 00       	mov    $0x17,%eax
+  8015cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015d4:	89 f7                	mov    %esi,%edi
+  8015d6:	cd 30                	int    $0x30
+  8015d8:	eb 8f                	jmp    801569 <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015da:	83 ec 0c             	sub    $0xc,%esp
+  8015dd:	50                   	push   %eax
+  8015de:	6a 17                	push   $0x17
+  8015e0:	68 6a 28 80 00       	push   $0x80286a
+  8015e5:	6a 4a                	push   $0x4a
+  8015e7:	68 87 28 80 00       	push   $0x802887
+  8015ec:	e8 54 06 00 00       	call   801c45 <_panic>
+
+008015f1 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  8015f1:	55                   	push   %ebp
+  8015f2:	89 e5                	mov    %esp,%ebp
+  8015f4:	57                   	push   %edi
+  8015f5:	56                   	push   %esi
+  8015f6:	53                   	push   %ebx
+  8015f7:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8015fa:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801601:	78 36                	js     801639 <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  801603:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80160a:	74 79                	je     801685 <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  80160c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80160f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801614:	b8 18 00 00 00       	mov    $0x18,%eax
+  801619:	89 cb                	mov    %ecx,%ebx
+  80161b:	89 cf                	mov    %ecx,%edi
+  80161d:	89 ce                	mov    %ecx,%esi
+  80161f:	55                   	push   %ebp
+  801620:	68 29 16 80 00       	push   $0x801629
+  801625:	89 e5                	mov    %esp,%ebp
+  801627:	0f 34                	sysenter
+  801629:	83 c4 04             	add    $0x4,%esp
+  80162c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80162d:	85 c0                	test   %eax,%eax
+  80162f:	7f 6b                	jg     80169c <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  801631:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801634:	5b                   	pop    %ebx
+  801635:	5e                   	pop    %esi
+  801636:	5f                   	pop    %edi
+  801637:	5d                   	pop    %ebp
+  801638:	c3                   	ret
+  801639:	b8 01 00 00 00       	mov    $0x1,%eax
+  80163e:	0f a2                	cpuid
+		return 0;
+  801640:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801645:	f6 c6 08             	test   $0x8,%dh
+  801648:	74 15                	je     80165f <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80164a:	89 c2                	mov    %eax,%edx
+  80164c:	c1 ea 08             	shr    $0x8,%edx
+  80164f:	83 e2 0f             	and    $0xf,%edx
+  801652:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801657:	83 fa 06             	cmp    $0x6,%edx
+  80165a:	74 0e                	je     80166a <sys_shm_remove+0x79>
+  80165c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80165f:	0f b6 c9             	movzbl %cl,%ecx
+  801662:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801668:	eb 99                	jmp    801603 <sys_shm_remove+0x12>
+  80166a:	89 c2                	mov    %eax,%edx
+  80166c:	c1 ea 04             	shr    $0x4,%edx
+  80166f:	83 e2 0f             	and    $0xf,%edx
+  801672:	83 fa 02             	cmp    $0x2,%edx
+  801675:	77 e5                	ja     80165c <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  801677:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80167a:	83 f8 02             	cmp    $0x2,%eax
+  80167d:	0f 97 c1             	seta   %cl
+  801680:	0f b6 c9             	movzbl %cl,%ecx
+  801683:	eb d7                	jmp    80165c <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  801685:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80168a:	b8 18 00 00 00       	mov    $0x18,%eax
+  80168f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801692:	89 cb                	mov    %ecx,%ebx
+  801694:	89 cf                	mov    %ecx,%edi
+  801696:	89 ce                	mov    %ecx,%esi
+  801698:	cd 30                	int    $0x30
+  80169a:	eb 91                	jmp    80162d <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80169c:	83 ec 0c             	sub    $0xc,%esp
+  80169f:	50                   	push   %eax
+  8016a0:	6a 18                	push   $0x18
+  8016a2:	68 6a 28 80 00       	push   $0x80286a
+  8016a7:	6a 4a                	push   $0x4a
+  8016a9:	68 87 28 80 00       	push   $0x802887
+  8016ae:	e8 92 05 00 00       	call   801c45 <_panic>
+
+008016b3 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  8016b3:	55                   	push   %ebp
+  8016b4:	89 e5                	mov    %esp,%ebp
+  8016b6:	57                   	push   %edi
+  8016b7:	56                   	push   %esi
+  8016b8:	53                   	push   %ebx
+  8016b9:	83 ec 0c             	sub    $0xc,%esp
+  8016bc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8016bf:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8016c2:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  8016c5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8016cc:	78 32                	js     801700 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  8016ce:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8016d5:	74 75                	je     80174c <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  8016d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016dd:	b8 20 00 00 00       	mov    $0x20,%eax
+  8016e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8016e7:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8016ea:	55                   	push   %ebp
+  8016eb:	68 f4 16 80 00       	push   $0x8016f4
+  8016f0:	89 e5                	mov    %esp,%ebp
+  8016f2:	0f 34                	sysenter
+  8016f4:	83 c4 04             	add    $0x4,%esp
+  8016f7:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  8016f8:	83 c4 0c             	add    $0xc,%esp
+  8016fb:	5b                   	pop    %ebx
+  8016fc:	5e                   	pop    %esi
+  8016fd:	5f                   	pop    %edi
+  8016fe:	5d                   	pop    %ebp
+  8016ff:	c3                   	ret
+  801700:	b8 01 00 00 00       	mov    $0x1,%eax
+  801705:	0f a2                	cpuid
+		return 0;
+  801707:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80170c:	f6 c6 08             	test   $0x8,%dh
+  80170f:	74 15                	je     801726 <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801711:	89 c2                	mov    %eax,%edx
+  801713:	c1 ea 08             	shr    $0x8,%edx
+  801716:	83 e2 0f             	and    $0xf,%edx
+  801719:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80171e:	83 fa 06             	cmp    $0x6,%edx
+  801721:	74 0e                	je     801731 <sys_futex_wait+0x7e>
+  801723:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801726:	0f b6 c9             	movzbl %cl,%ecx
+  801729:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80172f:	eb 9d                	jmp    8016ce <sys_futex_wait+0x1b>
+  801731:	89 c2                	mov    %eax,%edx
+  801733:	c1 ea 04             	shr    $0x4,%edx
+  801736:	83 e2 0f             	and    $0xf,%edx
+  801739:	83 fa 02             	cmp    $0x2,%edx
+  80173c:	77 e5                	ja     801723 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  80173e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801741:	83 f8 02             	cmp    $0x2,%eax
+  801744:	0f 97 c1             	seta   %cl
+  801747:	0f b6 c9             	movzbl %cl,%ecx
+  80174a:	eb d7                	jmp    801723 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  80174c:	b8 20 00 00 00       	mov    $0x20,%eax
+  801751:	be 00 00 00 00       	mov    $0x0,%esi
+  801756:	8b 55 08             	mov    0x8(%ebp),%edx
+  801759:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80175c:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  80175f:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  801761:	eb 95                	jmp    8016f8 <sys_futex_wait+0x45>
+
+00801763 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801763:	55                   	push   %ebp
+  801764:	89 e5                	mov    %esp,%ebp
+  801766:	57                   	push   %edi
+  801767:	56                   	push   %esi
+  801768:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801769:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801770:	78 30                	js     8017a2 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  801772:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801779:	74 73                	je     8017ee <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  80177b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801780:	8b 55 08             	mov    0x8(%ebp),%edx
+  801783:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801786:	b8 21 00 00 00       	mov    $0x21,%eax
+  80178b:	89 df                	mov    %ebx,%edi
+  80178d:	89 de                	mov    %ebx,%esi
+  80178f:	55                   	push   %ebp
+  801790:	68 99 17 80 00       	push   $0x801799
+  801795:	89 e5                	mov    %esp,%ebp
+  801797:	0f 34                	sysenter
+  801799:	83 c4 04             	add    $0x4,%esp
+  80179c:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80179d:	5b                   	pop    %ebx
+  80179e:	5e                   	pop    %esi
+  80179f:	5f                   	pop    %edi
+  8017a0:	5d                   	pop    %ebp
+  8017a1:	c3                   	ret
+  8017a2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8017a7:	0f a2                	cpuid
+		return 0;
+  8017a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8017ae:	f6 c6 08             	test   $0x8,%dh
+  8017b1:	74 15                	je     8017c8 <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017b3:	89 c2                	mov    %eax,%edx
+  8017b5:	c1 ea 08             	shr    $0x8,%edx
+  8017b8:	83 e2 0f             	and    $0xf,%edx
+  8017bb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017c0:	83 fa 06             	cmp    $0x6,%edx
+  8017c3:	74 0e                	je     8017d3 <sys_futex_wake+0x70>
+  8017c5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8017c8:	0f b6 c9             	movzbl %cl,%ecx
+  8017cb:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8017d1:	eb 9f                	jmp    801772 <sys_futex_wake+0xf>
+  8017d3:	89 c2                	mov    %eax,%edx
+  8017d5:	c1 ea 04             	shr    $0x4,%edx
+  8017d8:	83 e2 0f             	and    $0xf,%edx
+  8017db:	83 fa 02             	cmp    $0x2,%edx
+  8017de:	77 e5                	ja     8017c5 <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  8017e0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017e3:	83 f8 02             	cmp    $0x2,%eax
+  8017e6:	0f 97 c1             	seta   %cl
+  8017e9:	0f b6 c9             	movzbl %cl,%ecx
+  8017ec:	eb d7                	jmp    8017c5 <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  8017ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017f3:	b8 21 00 00 00       	mov    $0x21,%eax
+  8017f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017fe:	89 df                	mov    %ebx,%edi
+  801800:	89 de                	mov    %ebx,%esi
+  801802:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  801804:	eb 97                	jmp    80179d <sys_futex_wake+0x3a>
+
+00801806 <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  801806:	55                   	push   %ebp
+  801807:	89 e5                	mov    %esp,%ebp
+  801809:	57                   	push   %edi
+  80180a:	56                   	push   %esi
+  80180b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80180c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801813:	78 2e                	js     801843 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  801815:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80181c:	74 71                	je     80188f <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  80181e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801823:	b8 22 00 00 00       	mov    $0x22,%eax
+  801828:	89 d1                	mov    %edx,%ecx
+  80182a:	89 d3                	mov    %edx,%ebx
+  80182c:	89 d7                	mov    %edx,%edi
+  80182e:	89 d6                	mov    %edx,%esi
+  801830:	55                   	push   %ebp
+  801831:	68 3a 18 80 00       	push   $0x80183a
+  801836:	89 e5                	mov    %esp,%ebp
+  801838:	0f 34                	sysenter
+  80183a:	83 c4 04             	add    $0x4,%esp
+  80183d:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  80183e:	5b                   	pop    %ebx
+  80183f:	5e                   	pop    %esi
+  801840:	5f                   	pop    %edi
+  801841:	5d                   	pop    %ebp
+  801842:	c3                   	ret
+  801843:	b8 01 00 00 00       	mov    $0x1,%eax
+  801848:	0f a2                	cpuid
+		return 0;
+  80184a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80184f:	f6 c6 08             	test   $0x8,%dh
+  801852:	74 15                	je     801869 <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801854:	89 c2                	mov    %eax,%edx
+  801856:	c1 ea 08             	shr    $0x8,%edx
+  801859:	83 e2 0f             	and    $0xf,%edx
+  80185c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801861:	83 fa 06             	cmp    $0x6,%edx
+  801864:	74 0e                	je     801874 <sys_ep_create+0x6e>
+  801866:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801869:	0f b6 c9             	movzbl %cl,%ecx
+  80186c:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801872:	eb a1                	jmp    801815 <sys_ep_create+0xf>
+  801874:	89 c2                	mov    %eax,%edx
+  801876:	c1 ea 04             	shr    $0x4,%edx
+  801879:	83 e2 0f             	and    $0xf,%edx
+  80187c:	83 fa 02             	cmp    $0x2,%edx
+  80187f:	77 e5                	ja     801866 <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  801881:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801884:	83 f8 02             	cmp    $0x2,%eax
+  801887:	0f 97 c1             	seta   %cl
+  80188a:	0f b6 c9             	movzbl %cl,%ecx
+  80188d:	eb d7                	jmp    801866 <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  80188f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801894:	b8 22 00 00 00       	mov    $0x22,%eax
+  801899:	89 d1                	mov    %edx,%ecx
+  80189b:	89 d3                	mov    %edx,%ebx
+  80189d:	89 d7                	mov    %edx,%edi
+  80189f:	89 d6                	mov    %edx,%esi
+  8018a1:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  8018a3:	eb 99                	jmp    80183e <sys_ep_create+0x38>
+
+008018a5 <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  8018a5:	55                   	push   %ebp
+  8018a6:	89 e5                	mov    %esp,%ebp
+  8018a8:	57                   	push   %edi
+  8018a9:	56                   	push   %esi
+  8018aa:	53                   	push   %ebx
+  8018ab:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8018ae:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8018b5:	78 36                	js     8018ed <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  8018b7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8018be:	74 79                	je     801939 <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  8018c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018c8:	b8 23 00 00 00       	mov    $0x23,%eax
+  8018cd:	89 cb                	mov    %ecx,%ebx
+  8018cf:	89 cf                	mov    %ecx,%edi
+  8018d1:	89 ce                	mov    %ecx,%esi
+  8018d3:	55                   	push   %ebp
+  8018d4:	68 dd 18 80 00       	push   $0x8018dd
+  8018d9:	89 e5                	mov    %esp,%ebp
+  8018db:	0f 34                	sysenter
+  8018dd:	83 c4 04             	add    $0x4,%esp
+  8018e0:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8018e1:	85 c0                	test   %eax,%eax
+  8018e3:	7f 6b                	jg     801950 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  8018e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018e8:	5b                   	pop    %ebx
+  8018e9:	5e                   	pop    %esi
+  8018ea:	5f                   	pop    %edi
+  8018eb:	5d                   	pop    %ebp
+  8018ec:	c3                   	ret
+  8018ed:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018f2:	0f a2                	cpuid
+		return 0;
+  8018f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018f9:	f6 c6 08             	test   $0x8,%dh
+  8018fc:	74 15                	je     801913 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018fe:	89 c2                	mov    %eax,%edx
+  801900:	c1 ea 08             	shr    $0x8,%edx
+  801903:	83 e2 0f             	and    $0xf,%edx
+  801906:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80190b:	83 fa 06             	cmp    $0x6,%edx
+  80190e:	74 0e                	je     80191e <sys_ep_destroy+0x79>
+  801910:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801913:	0f b6 c9             	movzbl %cl,%ecx
+  801916:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80191c:	eb 99                	jmp    8018b7 <sys_ep_destroy+0x12>
+  80191e:	89 c2                	mov    %eax,%edx
+  801920:	c1 ea 04             	shr    $0x4,%edx
+  801923:	83 e2 0f             	and    $0xf,%edx
+  801926:	83 fa 02             	cmp    $0x2,%edx
+  801929:	77 e5                	ja     801910 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  80192b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80192e:	83 f8 02             	cmp    $0x2,%eax
+  801931:	0f 97 c1             	seta   %cl
+  801934:	0f b6 c9             	movzbl %cl,%ecx
+  801937:	eb d7                	jmp    801910 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  801939:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80193e:	b8 23 00 00 00       	mov    $0x23,%eax
+  801943:	8b 55 08             	mov    0x8(%ebp),%edx
+  801946:	89 cb                	mov    %ecx,%ebx
+  801948:	89 cf                	mov    %ecx,%edi
+  80194a:	89 ce                	mov    %ecx,%esi
+  80194c:	cd 30                	int    $0x30
+  80194e:	eb 91                	jmp    8018e1 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801950:	83 ec 0c             	sub    $0xc,%esp
+  801953:	50                   	push   %eax
+  801954:	6a 23                	push   $0x23
+  801956:	68 6a 28 80 00       	push   $0x80286a
+  80195b:	6a 4a                	push   $0x4a
+  80195d:	68 87 28 80 00       	push   $0x802887
+  801962:	e8 de 02 00 00       	call   801c45 <_panic>
+
+00801967 <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  801967:	55                   	push   %ebp
+  801968:	89 e5                	mov    %esp,%ebp
+  80196a:	57                   	push   %edi
+  80196b:	56                   	push   %esi
+  80196c:	53                   	push   %ebx
+  80196d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801970:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801977:	78 37                	js     8019b0 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  801979:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801980:	74 7a                	je     8019fc <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  801982:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801987:	8b 55 08             	mov    0x8(%ebp),%edx
+  80198a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80198d:	b8 24 00 00 00       	mov    $0x24,%eax
+  801992:	89 df                	mov    %ebx,%edi
+  801994:	89 de                	mov    %ebx,%esi
+  801996:	55                   	push   %ebp
+  801997:	68 a0 19 80 00       	push   $0x8019a0
+  80199c:	89 e5                	mov    %esp,%ebp
+  80199e:	0f 34                	sysenter
+  8019a0:	83 c4 04             	add    $0x4,%esp
+  8019a3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8019a4:	85 c0                	test   %eax,%eax
+  8019a6:	7f 6c                	jg     801a14 <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  8019a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019ab:	5b                   	pop    %ebx
+  8019ac:	5e                   	pop    %esi
+  8019ad:	5f                   	pop    %edi
+  8019ae:	5d                   	pop    %ebp
+  8019af:	c3                   	ret
+  8019b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019b5:	0f a2                	cpuid
+		return 0;
+  8019b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8019bc:	f6 c6 08             	test   $0x8,%dh
+  8019bf:	74 15                	je     8019d6 <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019c1:	89 c2                	mov    %eax,%edx
+  8019c3:	c1 ea 08             	shr    $0x8,%edx
+  8019c6:	83 e2 0f             	and    $0xf,%edx
+  8019c9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019ce:	83 fa 06             	cmp    $0x6,%edx
+  8019d1:	74 0e                	je     8019e1 <sys_ep_grant+0x7a>
+  8019d3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8019d6:	0f b6 c9             	movzbl %cl,%ecx
+  8019d9:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8019df:	eb 98                	jmp    801979 <sys_ep_grant+0x12>
+  8019e1:	89 c2                	mov    %eax,%edx
+  8019e3:	c1 ea 04             	shr    $0x4,%edx
+  8019e6:	83 e2 0f             	and    $0xf,%edx
+  8019e9:	83 fa 02             	cmp    $0x2,%edx
+  8019ec:	77 e5                	ja     8019d3 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  8019ee:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019f1:	83 f8 02             	cmp    $0x2,%eax
+  8019f4:	0f 97 c1             	seta   %cl
+  8019f7:	0f b6 c9             	movzbl %cl,%ecx
+  8019fa:	eb d7                	jmp    8019d3 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  8019fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a01:	b8 24 00 00 00       	mov    $0x24,%eax
+  801a06:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a09:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a0c:	89 df                	mov    %ebx,%edi
+  801a0e:	89 de                	mov    %ebx,%esi
+  801a10:	cd 30                	int    $0x30
+  801a12:	eb 90                	jmp    8019a4 <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a14:	83 ec 0c             	sub    $0xc,%esp
+  801a17:	50                   	push   %eax
+  801a18:	6a 24                	push   $0x24
+  801a1a:	68 6a 28 80 00       	push   $0x80286a
+  801a1f:	6a 4a                	push   $0x4a
+  801a21:	68 87 28 80 00       	push   $0x802887
+  801a26:	e8 1a 02 00 00       	call   801c45 <_panic>
+
+00801a2b <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  801a2b:	55                   	push   %ebp
+  801a2c:	89 e5                	mov    %esp,%ebp
+  801a2e:	57                   	push   %edi
+  801a2f:	56                   	push   %esi
+  801a30:	53                   	push   %ebx
+  801a31:	83 ec 20             	sub    $0x20,%esp
+  801a34:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801a37:	8b 10                	mov    (%eax),%edx
+  801a39:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801a3c:	8b 50 04             	mov    0x4(%eax),%edx
+  801a3f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801a42:	8b 50 08             	mov    0x8(%eax),%edx
+  801a45:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801a48:	8b 50 0c             	mov    0xc(%eax),%edx
+  801a4b:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801a4e:	8b 40 10             	mov    0x10(%eax),%eax
+  801a51:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801a54:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801a57:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a5a:	b8 25 00 00 00       	mov    $0x25,%eax
+  801a5f:	55                   	push   %ebp
+  801a60:	56                   	push   %esi
+  801a61:	8b 0e                	mov    (%esi),%ecx
+  801a63:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801a66:	8b 7e 08             	mov    0x8(%esi),%edi
+  801a69:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801a6c:	8b 76 0c             	mov    0xc(%esi),%esi
+  801a6f:	cd 30                	int    $0x30
+  801a71:	87 34 24             	xchg   %esi,(%esp)
+  801a74:	89 0e                	mov    %ecx,(%esi)
+  801a76:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801a79:	89 7e 08             	mov    %edi,0x8(%esi)
+  801a7c:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801a7f:	8f 46 0c             	pop    0xc(%esi)
+  801a82:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  801a83:	83 c4 20             	add    $0x20,%esp
+  801a86:	5b                   	pop    %ebx
+  801a87:	5e                   	pop    %esi
+  801a88:	5f                   	pop    %edi
+  801a89:	5d                   	pop    %ebp
+  801a8a:	c3                   	ret
+
+00801a8b <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  801a8b:	55                   	push   %ebp
+  801a8c:	89 e5                	mov    %esp,%ebp
+  801a8e:	57                   	push   %edi
+  801a8f:	56                   	push   %esi
+  801a90:	53                   	push   %ebx
+  801a91:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  801a94:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a97:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  801a99:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a9c:	b8 26 00 00 00       	mov    $0x26,%eax
+  801aa1:	55                   	push   %ebp
+  801aa2:	56                   	push   %esi
+  801aa3:	8b 0e                	mov    (%esi),%ecx
+  801aa5:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801aa8:	8b 7e 08             	mov    0x8(%esi),%edi
+  801aab:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801aae:	8b 76 0c             	mov    0xc(%esi),%esi
+  801ab1:	cd 30                	int    $0x30
+  801ab3:	87 34 24             	xchg   %esi,(%esp)
+  801ab6:	89 0e                	mov    %ecx,(%esi)
+  801ab8:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801abb:	89 7e 08             	mov    %edi,0x8(%esi)
+  801abe:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801ac1:	8f 46 0c             	pop    0xc(%esi)
+  801ac4:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  801ac5:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  801ac9:	74 0f                	je     801ada <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  801acb:	85 c0                	test   %eax,%eax
+  801acd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ad2:	0f 48 d1             	cmovs  %ecx,%edx
+  801ad5:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  801ad8:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  801ada:	5b                   	pop    %ebx
+  801adb:	5e                   	pop    %esi
+  801adc:	5f                   	pop    %edi
+  801add:	5d                   	pop    %ebp
+  801ade:	c3                   	ret
+
+00801adf <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  801adf:	55                   	push   %ebp
+  801ae0:	89 e5                	mov    %esp,%ebp
+  801ae2:	57                   	push   %edi
+  801ae3:	56                   	push   %esi
+  801ae4:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801ae5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801aec:	78 2f                	js     801b1d <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  801aee:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801af5:	74 72                	je     801b69 <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  801af7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801afa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801aff:	b8 27 00 00 00       	mov    $0x27,%eax
+  801b04:	89 cb                	mov    %ecx,%ebx
+  801b06:	89 cf                	mov    %ecx,%edi
+  801b08:	89 ce                	mov    %ecx,%esi
+  801b0a:	55                   	push   %ebp
+  801b0b:	68 14 1b 80 00       	push   $0x801b14
+  801b10:	89 e5                	mov    %esp,%ebp
+  801b12:	0f 34                	sysenter
+  801b14:	83 c4 04             	add    $0x4,%esp
+  801b17:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  801b18:	5b                   	pop    %ebx
+  801b19:	5e                   	pop    %esi
+  801b1a:	5f                   	pop    %edi
+  801b1b:	5d                   	pop    %ebp
+  801b1c:	c3                   	ret
+  801b1d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b22:	0f a2                	cpuid
+		return 0;
+  801b24:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b29:	f6 c6 08             	test   $0x8,%dh
+  801b2c:	74 15                	je     801b43 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b2e:	89 c2                	mov    %eax,%edx
+  801b30:	c1 ea 08             	shr    $0x8,%edx
+  801b33:	83 e2 0f             	and    $0xf,%edx
+  801b36:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b3b:	83 fa 06             	cmp    $0x6,%edx
+  801b3e:	74 0e                	je     801b4e <sys_sysring_setup+0x6f>
+  801b40:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b43:	0f b6 c9             	movzbl %cl,%ecx
+  801b46:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801b4c:	eb a0                	jmp    801aee <sys_sysring_setup+0xf>
+  801b4e:	89 c2                	mov    %eax,%edx
+  801b50:	c1 ea 04             	shr    $0x4,%edx
+  801b53:	83 e2 0f             	and    $0xf,%edx
+  801b56:	83 fa 02             	cmp    $0x2,%edx
+  801b59:	77 e5                	ja     801b40 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  801b5b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b5e:	83 f8 02             	cmp    $0x2,%eax
+  801b61:	0f 97 c1             	seta   %cl
+  801b64:	0f b6 c9             	movzbl %cl,%ecx
+  801b67:	eb d7                	jmp    801b40 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  801b69:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b6e:	b8 27 00 00 00       	mov    $0x27,%eax
+  801b73:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b76:	89 cb                	mov    %ecx,%ebx
+  801b78:	89 cf                	mov    %ecx,%edi
+  801b7a:	89 ce                	mov    %ecx,%esi
+  801b7c:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  801b7e:	eb 98                	jmp    801b18 <sys_sysring_setup+0x39>
+
+00801b80 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  801b80:	55                   	push   %ebp
+  801b81:	89 e5                	mov    %esp,%ebp
+  801b83:	57                   	push   %edi
+  801b84:	56                   	push   %esi
+  801b85:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801b86:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b8d:	78 2e                	js     801bbd <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  801b8f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b96:	74 71                	je     801c09 <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  801b98:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b9d:	b8 28 00 00 00       	mov    $0x28,%eax
+  801ba2:	89 d1                	mov    %edx,%ecx
+  801ba4:	89 d3                	mov    %edx,%ebx
+  801ba6:	89 d7                	mov    %edx,%edi
+  801ba8:	89 d6                	mov    %edx,%esi
+  801baa:	55                   	push   %ebp
+  801bab:	68 b4 1b 80 00       	push   $0x801bb4
+  801bb0:	89 e5                	mov    %esp,%ebp
+  801bb2:	0f 34                	sysenter
+  801bb4:	83 c4 04             	add    $0x4,%esp
+  801bb7:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801bb8:	5b                   	pop    %ebx
+  801bb9:	5e                   	pop    %esi
+  801bba:	5f                   	pop    %edi
+  801bbb:	5d                   	pop    %ebp
+  801bbc:	c3                   	ret
+  801bbd:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bc2:	0f a2                	cpuid
+		return 0;
+  801bc4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801bc9:	f6 c6 08             	test   $0x8,%dh
+  801bcc:	74 15                	je     801be3 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bce:	89 c2                	mov    %eax,%edx
+  801bd0:	c1 ea 08             	shr    $0x8,%edx
+  801bd3:	83 e2 0f             	and    $0xf,%edx
+  801bd6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801bdb:	83 fa 06             	cmp    $0x6,%edx
+  801bde:	74 0e                	je     801bee <sys_sysring_enter+0x6e>
+  801be0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801be3:	0f b6 c9             	movzbl %cl,%ecx
+  801be6:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801bec:	eb a1                	jmp    801b8f <sys_sysring_enter+0xf>
+  801bee:	89 c2                	mov    %eax,%edx
+  801bf0:	c1 ea 04             	shr    $0x4,%edx
+  801bf3:	83 e2 0f             	and    $0xf,%edx
+  801bf6:	83 fa 02             	cmp    $0x2,%edx
+  801bf9:	77 e5                	ja     801be0 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  801bfb:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bfe:	83 f8 02             	cmp    $0x2,%eax
+  801c01:	0f 97 c1             	seta   %cl
+  801c04:	0f b6 c9             	movzbl %cl,%ecx
+  801c07:	eb d7                	jmp    801be0 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  801c09:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c0e:	b8 28 00 00 00       	mov    $0x28,%eax
+  801c13:	89 d1                	mov    %edx,%ecx
+  801c15:	89 d3                	mov    %edx,%ebx
+  801c17:	89 d7                	mov    %edx,%edi
+  801c19:	89 d6                	mov    %edx,%esi
+  801c1b:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  801c1d:	eb 99                	jmp    801bb8 <sys_sysring_enter+0x38>
+
+00801c1f <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  801c1f:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  801c20:	a1 0c 30 80 00       	mov    0x80300c,%eax
+	call *%eax
+  801c25:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  801c27:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 0x28(%esp), %ebx		// trap-time eip
+  801c2a:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl 0x30(%esp), %eax		// trap-time esp
+  801c2e:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  801c32:	83 e8 04             	sub    $0x4,%eax
+	movl %ebx, (%eax)
+  801c35:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 0x30(%esp)
+  801c37:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp			// skip fault_va and err
+  801c3b:	83 c4 08             	add    $0x8,%esp
+	popal
+  801c3e:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp			// skip eip
+  801c3f:	83 c4 04             	add    $0x4,%esp
+	popfl
+  801c42:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  801c43:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  801c44:	c3                   	ret
+
+00801c45 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801c45:	55                   	push   %ebp
+  801c46:	89 e5                	mov    %esp,%ebp
+  801c48:	57                   	push   %edi
+  801c49:	56                   	push   %esi
+  801c4a:	53                   	push   %ebx
+  801c4b:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  801c51:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  801c54:	8b 1d 00 30 80 00    	mov    0x803000,%ebx
+  801c5a:	e8 a2 e8 ff ff       	call   800501 <sys_getenvid>
+  801c5f:	83 ec 04             	sub    $0x4,%esp
+  801c62:	ff 75 0c             	push   0xc(%ebp)
+  801c65:	ff 75 08             	push   0x8(%ebp)
+  801c68:	53                   	push   %ebx
+  801c69:	50                   	push   %eax
+  801c6a:	68 98 28 80 00       	push   $0x802898
+  801c6f:	68 00 01 00 00       	push   $0x100
+  801c74:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  801c7a:	56                   	push   %esi
+  801c7b:	e8 c9 05 00 00       	call   802249 <snprintf>
+  801c80:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  801c82:	83 c4 20             	add    $0x20,%esp
+  801c85:	57                   	push   %edi
+  801c86:	ff 75 10             	push   0x10(%ebp)
+  801c89:	bf 00 01 00 00       	mov    $0x100,%edi
+  801c8e:	89 f8                	mov    %edi,%eax
+  801c90:	29 d8                	sub    %ebx,%eax
+  801c92:	50                   	push   %eax
+  801c93:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801c96:	50                   	push   %eax
+  801c97:	e8 5f 05 00 00       	call   8021fb <vsnprintf>
+  801c9c:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  801c9e:	83 c4 0c             	add    $0xc,%esp
+  801ca1:	68 bb 28 80 00       	push   $0x8028bb
+  801ca6:	29 df                	sub    %ebx,%edi
+  801ca8:	57                   	push   %edi
+  801ca9:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801cac:	50                   	push   %eax
+  801cad:	e8 97 05 00 00       	call   802249 <snprintf>
+	sys_cputs(buf, r);
+  801cb2:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  801cb5:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  801cb7:	53                   	push   %ebx
+  801cb8:	56                   	push   %esi
+  801cb9:	e8 45 e6 ff ff       	call   800303 <sys_cputs>
+  801cbe:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801cc1:	cc                   	int3
+	while (1)
+  801cc2:	eb fd                	jmp    801cc1 <_panic+0x7c>
+
+00801cc4 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801cc4:	55                   	push   %ebp
+  801cc5:	89 e5                	mov    %esp,%ebp
+  801cc7:	57                   	push   %edi
+  801cc8:	56                   	push   %esi
+  801cc9:	53                   	push   %ebx
+  801cca:	83 ec 1c             	sub    $0x1c,%esp
+  801ccd:	89 c7                	mov    %eax,%edi
+  801ccf:	89 d6                	mov    %edx,%esi
+  801cd1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cd4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801cd7:	89 d1                	mov    %edx,%ecx
+  801cd9:	89 c2                	mov    %eax,%edx
+  801cdb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801cde:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801ce1:	8b 45 10             	mov    0x10(%ebp),%eax
+  801ce4:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  801ce7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801cea:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801cf1:	39 c2                	cmp    %eax,%edx
+  801cf3:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  801cf6:	72 3e                	jb     801d36 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801cf8:	83 ec 0c             	sub    $0xc,%esp
+  801cfb:	ff 75 18             	push   0x18(%ebp)
+  801cfe:	83 eb 01             	sub    $0x1,%ebx
+  801d01:	53                   	push   %ebx
+  801d02:	50                   	push   %eax
+  801d03:	83 ec 08             	sub    $0x8,%esp
+  801d06:	ff 75 e4             	push   -0x1c(%ebp)
+  801d09:	ff 75 e0             	push   -0x20(%ebp)
+  801d0c:	ff 75 dc             	push   -0x24(%ebp)
+  801d0f:	ff 75 d8             	push   -0x28(%ebp)
+  801d12:	e8 05 0a 00 00       	call   80271c <__udivdi3>
+  801d17:	83 c4 18             	add    $0x18,%esp
+  801d1a:	52                   	push   %edx
+  801d1b:	50                   	push   %eax
+  801d1c:	89 f2                	mov    %esi,%edx
+  801d1e:	89 f8                	mov    %edi,%eax
+  801d20:	e8 9f ff ff ff       	call   801cc4 <printnum>
+  801d25:	83 c4 20             	add    $0x20,%esp
+  801d28:	eb 13                	jmp    801d3d <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  801d2a:	83 ec 08             	sub    $0x8,%esp
+  801d2d:	56                   	push   %esi
+  801d2e:	ff 75 18             	push   0x18(%ebp)
+  801d31:	ff d7                	call   *%edi
+  801d33:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  801d36:	83 eb 01             	sub    $0x1,%ebx
+  801d39:	85 db                	test   %ebx,%ebx
+  801d3b:	7f ed                	jg     801d2a <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  801d3d:	83 ec 08             	sub    $0x8,%esp
+  801d40:	56                   	push   %esi
+  801d41:	83 ec 04             	sub    $0x4,%esp
+  801d44:	ff 75 e4             	push   -0x1c(%ebp)
+  801d47:	ff 75 e0             	push   -0x20(%ebp)
+  801d4a:	ff 75 dc             	push   -0x24(%ebp)
+  801d4d:	ff 75 d8             	push   -0x28(%ebp)
+  801d50:	e8 e5 09 00 00       	call   80273a <__umoddi3>
+  801d55:	83 c4 14             	add    $0x14,%esp
+  801d58:	0f be 80 bd 28 80 00 	movsbl 0x8028bd(%eax),%eax
+  801d5f:	50                   	push   %eax
+  801d60:	ff d7                	call   *%edi
+}
+  801d62:	83 c4 10             	add    $0x10,%esp
+  801d65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d68:	5b                   	pop    %ebx
+  801d69:	5e                   	pop    %esi
+  801d6a:	5f                   	pop    %edi
+  801d6b:	5d                   	pop    %ebp
+  801d6c:	c3                   	ret
+
+00801d6d <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801d6d:	55                   	push   %ebp
+  801d6e:	89 e5                	mov    %esp,%ebp
+  801d70:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  801d73:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  801d77:	8b 10                	mov    (%eax),%edx
+  801d79:	3b 50 04             	cmp    0x4(%eax),%edx
+  801d7c:	73 0a                	jae    801d88 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  801d7e:	8d 4a 01             	lea    0x1(%edx),%ecx
+  801d81:	89 08                	mov    %ecx,(%eax)
+  801d83:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d86:	88 02                	mov    %al,(%edx)
+}
+  801d88:	5d                   	pop    %ebp
+  801d89:	c3                   	ret
+
+00801d8a <printfmt>:
+{
+  801d8a:	55                   	push   %ebp
+  801d8b:	89 e5                	mov    %esp,%ebp
+  801d8d:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  801d90:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  801d93:	50                   	push   %eax
+  801d94:	ff 75 10             	push   0x10(%ebp)
+  801d97:	ff 75 0c             	push   0xc(%ebp)
+  801d9a:	ff 75 08             	push   0x8(%ebp)
+  801d9d:	e8 05 00 00 00       	call   801da7 <vprintfmt>
+}
+  801da2:	83 c4 10             	add    $0x10,%esp
+  801da5:	c9                   	leave
+  801da6:	c3                   	ret
+
+00801da7 <vprintfmt>:
+{
+  801da7:	55                   	push   %ebp
+  801da8:	89 e5                	mov    %esp,%ebp
+  801daa:	57                   	push   %edi
+  801dab:	56                   	push   %esi
+  801dac:	53                   	push   %ebx
+  801dad:	83 ec 2c             	sub    $0x2c,%esp
+  801db0:	8b 75 08             	mov    0x8(%ebp),%esi
+  801db3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801db6:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801db9:	eb 0a                	jmp    801dc5 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  801dbb:	83 ec 08             	sub    $0x8,%esp
+  801dbe:	53                   	push   %ebx
+  801dbf:	50                   	push   %eax
+  801dc0:	ff d6                	call   *%esi
+  801dc2:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801dc5:	83 c7 01             	add    $0x1,%edi
+  801dc8:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801dcc:	83 f8 25             	cmp    $0x25,%eax
+  801dcf:	74 0c                	je     801ddd <vprintfmt+0x36>
+			if (ch == '\0')
+  801dd1:	85 c0                	test   %eax,%eax
+  801dd3:	75 e6                	jne    801dbb <vprintfmt+0x14>
+}
+  801dd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dd8:	5b                   	pop    %ebx
+  801dd9:	5e                   	pop    %esi
+  801dda:	5f                   	pop    %edi
+  801ddb:	5d                   	pop    %ebp
+  801ddc:	c3                   	ret
+		padc = ' ';
+  801ddd:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801de1:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  801de8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801def:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  801df6:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801dfb:	8d 47 01             	lea    0x1(%edi),%eax
+  801dfe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801e01:	0f b6 17             	movzbl (%edi),%edx
+  801e04:	8d 42 dd             	lea    -0x23(%edx),%eax
+  801e07:	3c 55                	cmp    $0x55,%al
+  801e09:	0f 87 cf 03 00 00    	ja     8021de <vprintfmt+0x437>
+  801e0f:	0f b6 c0             	movzbl %al,%eax
+  801e12:	ff 24 85 a0 29 80 00 	jmp    *0x8029a0(,%eax,4)
+  801e19:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801e1c:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801e20:	eb d9                	jmp    801dfb <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801e22:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801e25:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  801e29:	eb d0                	jmp    801dfb <vprintfmt+0x54>
+  801e2b:	0f b6 d2             	movzbl %dl,%edx
+  801e2e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  801e31:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e36:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  801e39:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801e3c:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  801e40:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  801e43:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  801e46:	83 f9 09             	cmp    $0x9,%ecx
+  801e49:	77 55                	ja     801ea0 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  801e4b:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  801e4e:	eb e9                	jmp    801e39 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  801e50:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e53:	8b 00                	mov    (%eax),%eax
+  801e55:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801e58:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e5b:	8d 40 04             	lea    0x4(%eax),%eax
+  801e5e:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801e61:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  801e64:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801e68:	79 91                	jns    801dfb <vprintfmt+0x54>
+				width = precision, precision = -1;
+  801e6a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801e6d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801e70:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  801e77:	eb 82                	jmp    801dfb <vprintfmt+0x54>
+			if (width < 0)
+  801e79:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801e7c:	85 d2                	test   %edx,%edx
+  801e7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e83:	0f 49 c2             	cmovns %edx,%eax
+  801e86:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801e89:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801e8c:	e9 6a ff ff ff       	jmp    801dfb <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801e91:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  801e94:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  801e9b:	e9 5b ff ff ff       	jmp    801dfb <vprintfmt+0x54>
+  801ea0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801ea3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801ea6:	eb bc                	jmp    801e64 <vprintfmt+0xbd>
+			lflag++;
+  801ea8:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801eab:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801eae:	e9 48 ff ff ff       	jmp    801dfb <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  801eb3:	8b 45 14             	mov    0x14(%ebp),%eax
+  801eb6:	8d 78 04             	lea    0x4(%eax),%edi
+  801eb9:	83 ec 08             	sub    $0x8,%esp
+  801ebc:	53                   	push   %ebx
+  801ebd:	ff 30                	push   (%eax)
+  801ebf:	ff d6                	call   *%esi
+			break;
+  801ec1:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801ec4:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  801ec7:	e9 b1 02 00 00       	jmp    80217d <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  801ecc:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ecf:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801ed2:	8b 10                	mov    (%eax),%edx
+  801ed4:	89 d0                	mov    %edx,%eax
+  801ed6:	f7 d8                	neg    %eax
+  801ed8:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801edb:	83 f8 0d             	cmp    $0xd,%eax
+  801ede:	7f 23                	jg     801f03 <vprintfmt+0x15c>
+  801ee0:	8b 14 85 00 2b 80 00 	mov    0x802b00(,%eax,4),%edx
+  801ee7:	85 d2                	test   %edx,%edx
+  801ee9:	74 18                	je     801f03 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801eeb:	52                   	push   %edx
+  801eec:	68 de 28 80 00       	push   $0x8028de
+  801ef1:	53                   	push   %ebx
+  801ef2:	56                   	push   %esi
+  801ef3:	e8 92 fe ff ff       	call   801d8a <printfmt>
+  801ef8:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801efb:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801efe:	e9 7a 02 00 00       	jmp    80217d <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  801f03:	50                   	push   %eax
+  801f04:	68 d5 28 80 00       	push   $0x8028d5
+  801f09:	53                   	push   %ebx
+  801f0a:	56                   	push   %esi
+  801f0b:	e8 7a fe ff ff       	call   801d8a <printfmt>
+  801f10:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801f13:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801f16:	e9 62 02 00 00       	jmp    80217d <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801f1b:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f1e:	83 c0 04             	add    $0x4,%eax
+  801f21:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801f24:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f27:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801f29:	85 c9                	test   %ecx,%ecx
+  801f2b:	b8 ce 28 80 00       	mov    $0x8028ce,%eax
+  801f30:	0f 45 c1             	cmovne %ecx,%eax
+  801f33:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801f36:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801f3a:	7e 06                	jle    801f42 <vprintfmt+0x19b>
+  801f3c:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801f40:	75 0b                	jne    801f4d <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f42:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801f45:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801f48:	89 75 08             	mov    %esi,0x8(%ebp)
+  801f4b:	eb 5c                	jmp    801fa9 <vprintfmt+0x202>
+  801f4d:	83 ec 08             	sub    $0x8,%esp
+  801f50:	ff 75 d0             	push   -0x30(%ebp)
+  801f53:	ff 75 cc             	push   -0x34(%ebp)
+  801f56:	e8 20 03 00 00       	call   80227b <strnlen>
+  801f5b:	89 c2                	mov    %eax,%edx
+  801f5d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f60:	29 d0                	sub    %edx,%eax
+  801f62:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801f65:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  801f69:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801f6c:	89 75 08             	mov    %esi,0x8(%ebp)
+  801f6f:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f71:	eb 0e                	jmp    801f81 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801f73:	83 ec 08             	sub    $0x8,%esp
+  801f76:	53                   	push   %ebx
+  801f77:	57                   	push   %edi
+  801f78:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f7b:	83 ee 01             	sub    $0x1,%esi
+  801f7e:	83 c4 10             	add    $0x10,%esp
+  801f81:	85 f6                	test   %esi,%esi
+  801f83:	7f ee                	jg     801f73 <vprintfmt+0x1cc>
+  801f85:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f88:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f8b:	85 c0                	test   %eax,%eax
+  801f8d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f92:	0f 49 d0             	cmovns %eax,%edx
+  801f95:	29 d0                	sub    %edx,%eax
+  801f97:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801f9a:	eb a6                	jmp    801f42 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801f9c:	83 ec 08             	sub    $0x8,%esp
+  801f9f:	53                   	push   %ebx
+  801fa0:	52                   	push   %edx
+  801fa1:	ff 55 08             	call   *0x8(%ebp)
+  801fa4:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801fa7:	89 f1                	mov    %esi,%ecx
+  801fa9:	8d 71 01             	lea    0x1(%ecx),%esi
+  801fac:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801fb0:	0f be d0             	movsbl %al,%edx
+  801fb3:	85 d2                	test   %edx,%edx
+  801fb5:	74 28                	je     801fdf <vprintfmt+0x238>
+  801fb7:	85 ff                	test   %edi,%edi
+  801fb9:	78 05                	js     801fc0 <vprintfmt+0x219>
+  801fbb:	83 ef 01             	sub    $0x1,%edi
+  801fbe:	78 30                	js     801ff0 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801fc0:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801fc4:	74 d6                	je     801f9c <vprintfmt+0x1f5>
+  801fc6:	0f be c0             	movsbl %al,%eax
+  801fc9:	83 e8 20             	sub    $0x20,%eax
+  801fcc:	83 f8 5e             	cmp    $0x5e,%eax
+  801fcf:	76 cb                	jbe    801f9c <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801fd1:	83 ec 08             	sub    $0x8,%esp
+  801fd4:	53                   	push   %ebx
+  801fd5:	6a 3f                	push   $0x3f
+  801fd7:	ff 55 08             	call   *0x8(%ebp)
+  801fda:	83 c4 10             	add    $0x10,%esp
+  801fdd:	eb c8                	jmp    801fa7 <vprintfmt+0x200>
+  801fdf:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fe2:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801fe5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801fe8:	01 d0                	add    %edx,%eax
+  801fea:	29 c8                	sub    %ecx,%eax
+  801fec:	89 c7                	mov    %eax,%edi
+  801fee:	eb 13                	jmp    802003 <vprintfmt+0x25c>
+  801ff0:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ff3:	eb ed                	jmp    801fe2 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801ff5:	83 ec 08             	sub    $0x8,%esp
+  801ff8:	53                   	push   %ebx
+  801ff9:	6a 20                	push   $0x20
+  801ffb:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801ffd:	83 ef 01             	sub    $0x1,%edi
+  802000:	83 c4 10             	add    $0x10,%esp
+  802003:	85 ff                	test   %edi,%edi
+  802005:	7f ee                	jg     801ff5 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802007:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80200a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80200d:	e9 6b 01 00 00       	jmp    80217d <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  802012:	83 f9 01             	cmp    $0x1,%ecx
+  802015:	7f 1f                	jg     802036 <vprintfmt+0x28f>
+	else if (lflag)
+  802017:	85 c9                	test   %ecx,%ecx
+  802019:	74 67                	je     802082 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80201b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80201e:	8b 00                	mov    (%eax),%eax
+  802020:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802023:	89 c1                	mov    %eax,%ecx
+  802025:	c1 f9 1f             	sar    $0x1f,%ecx
+  802028:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80202b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80202e:	8d 40 04             	lea    0x4(%eax),%eax
+  802031:	89 45 14             	mov    %eax,0x14(%ebp)
+  802034:	eb 17                	jmp    80204d <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  802036:	8b 45 14             	mov    0x14(%ebp),%eax
+  802039:	8b 50 04             	mov    0x4(%eax),%edx
+  80203c:	8b 00                	mov    (%eax),%eax
+  80203e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802041:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802044:	8b 45 14             	mov    0x14(%ebp),%eax
+  802047:	8d 40 08             	lea    0x8(%eax),%eax
+  80204a:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80204d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802050:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  802053:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  802058:	85 c9                	test   %ecx,%ecx
+  80205a:	0f 89 03 01 00 00    	jns    802163 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  802060:	83 ec 08             	sub    $0x8,%esp
+  802063:	53                   	push   %ebx
+  802064:	6a 2d                	push   $0x2d
+  802066:	ff d6                	call   *%esi
+				num = -(long long) num;
+  802068:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80206b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80206e:	f7 da                	neg    %edx
+  802070:	83 d1 00             	adc    $0x0,%ecx
+  802073:	f7 d9                	neg    %ecx
+  802075:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  802078:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80207d:	e9 e1 00 00 00       	jmp    802163 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  802082:	8b 45 14             	mov    0x14(%ebp),%eax
+  802085:	8b 00                	mov    (%eax),%eax
+  802087:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80208a:	89 c1                	mov    %eax,%ecx
+  80208c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80208f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802092:	8b 45 14             	mov    0x14(%ebp),%eax
+  802095:	8d 40 04             	lea    0x4(%eax),%eax
+  802098:	89 45 14             	mov    %eax,0x14(%ebp)
+  80209b:	eb b0                	jmp    80204d <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80209d:	83 f9 01             	cmp    $0x1,%ecx
+  8020a0:	7f 1e                	jg     8020c0 <vprintfmt+0x319>
+	else if (lflag)
+  8020a2:	85 c9                	test   %ecx,%ecx
+  8020a4:	74 32                	je     8020d8 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8020a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020a9:	8b 10                	mov    (%eax),%edx
+  8020ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8020b3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8020b6:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8020bb:	e9 a3 00 00 00       	jmp    802163 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8020c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020c3:	8b 10                	mov    (%eax),%edx
+  8020c5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8020c8:	8d 40 08             	lea    0x8(%eax),%eax
+  8020cb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8020ce:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8020d3:	e9 8b 00 00 00       	jmp    802163 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8020d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020db:	8b 10                	mov    (%eax),%edx
+  8020dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020e2:	8d 40 04             	lea    0x4(%eax),%eax
+  8020e5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8020e8:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8020ed:	eb 74                	jmp    802163 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8020ef:	83 f9 01             	cmp    $0x1,%ecx
+  8020f2:	7f 1b                	jg     80210f <vprintfmt+0x368>
+	else if (lflag)
+  8020f4:	85 c9                	test   %ecx,%ecx
+  8020f6:	74 2c                	je     802124 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8020f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020fb:	8b 10                	mov    (%eax),%edx
+  8020fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802102:	8d 40 04             	lea    0x4(%eax),%eax
+  802105:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802108:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80210d:	eb 54                	jmp    802163 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80210f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802112:	8b 10                	mov    (%eax),%edx
+  802114:	8b 48 04             	mov    0x4(%eax),%ecx
+  802117:	8d 40 08             	lea    0x8(%eax),%eax
+  80211a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80211d:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  802122:	eb 3f                	jmp    802163 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802124:	8b 45 14             	mov    0x14(%ebp),%eax
+  802127:	8b 10                	mov    (%eax),%edx
+  802129:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80212e:	8d 40 04             	lea    0x4(%eax),%eax
+  802131:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802134:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  802139:	eb 28                	jmp    802163 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  80213b:	83 ec 08             	sub    $0x8,%esp
+  80213e:	53                   	push   %ebx
+  80213f:	6a 30                	push   $0x30
+  802141:	ff d6                	call   *%esi
+			putch('x', putdat);
+  802143:	83 c4 08             	add    $0x8,%esp
+  802146:	53                   	push   %ebx
+  802147:	6a 78                	push   $0x78
+  802149:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80214b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80214e:	8b 10                	mov    (%eax),%edx
+  802150:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  802155:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  802158:	8d 40 04             	lea    0x4(%eax),%eax
+  80215b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80215e:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  802163:	83 ec 0c             	sub    $0xc,%esp
+  802166:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80216a:	50                   	push   %eax
+  80216b:	ff 75 e0             	push   -0x20(%ebp)
+  80216e:	57                   	push   %edi
+  80216f:	51                   	push   %ecx
+  802170:	52                   	push   %edx
+  802171:	89 da                	mov    %ebx,%edx
+  802173:	89 f0                	mov    %esi,%eax
+  802175:	e8 4a fb ff ff       	call   801cc4 <printnum>
+			break;
+  80217a:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80217d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802180:	e9 40 fc ff ff       	jmp    801dc5 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  802185:	83 f9 01             	cmp    $0x1,%ecx
+  802188:	7f 1b                	jg     8021a5 <vprintfmt+0x3fe>
+	else if (lflag)
+  80218a:	85 c9                	test   %ecx,%ecx
+  80218c:	74 2c                	je     8021ba <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  80218e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802191:	8b 10                	mov    (%eax),%edx
+  802193:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802198:	8d 40 04             	lea    0x4(%eax),%eax
+  80219b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80219e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8021a3:	eb be                	jmp    802163 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8021a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8021a8:	8b 10                	mov    (%eax),%edx
+  8021aa:	8b 48 04             	mov    0x4(%eax),%ecx
+  8021ad:	8d 40 08             	lea    0x8(%eax),%eax
+  8021b0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8021b3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8021b8:	eb a9                	jmp    802163 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8021ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8021bd:	8b 10                	mov    (%eax),%edx
+  8021bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021c4:	8d 40 04             	lea    0x4(%eax),%eax
+  8021c7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8021ca:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8021cf:	eb 92                	jmp    802163 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8021d1:	83 ec 08             	sub    $0x8,%esp
+  8021d4:	53                   	push   %ebx
+  8021d5:	6a 25                	push   $0x25
+  8021d7:	ff d6                	call   *%esi
+			break;
+  8021d9:	83 c4 10             	add    $0x10,%esp
+  8021dc:	eb 9f                	jmp    80217d <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8021de:	83 ec 08             	sub    $0x8,%esp
+  8021e1:	53                   	push   %ebx
+  8021e2:	6a 25                	push   $0x25
+  8021e4:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8021e6:	83 c4 10             	add    $0x10,%esp
+  8021e9:	89 f8                	mov    %edi,%eax
+  8021eb:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8021ef:	74 05                	je     8021f6 <vprintfmt+0x44f>
+  8021f1:	83 e8 01             	sub    $0x1,%eax
+  8021f4:	eb f5                	jmp    8021eb <vprintfmt+0x444>
+  8021f6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8021f9:	eb 82                	jmp    80217d <vprintfmt+0x3d6>
+
+008021fb <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8021fb:	55                   	push   %ebp
+  8021fc:	89 e5                	mov    %esp,%ebp
+  8021fe:	83 ec 18             	sub    $0x18,%esp
+  802201:	8b 45 08             	mov    0x8(%ebp),%eax
+  802204:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  802207:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80220a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80220e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  802211:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  802218:	85 c0                	test   %eax,%eax
+  80221a:	74 26                	je     802242 <vsnprintf+0x47>
+  80221c:	85 d2                	test   %edx,%edx
+  80221e:	7e 22                	jle    802242 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  802220:	ff 75 14             	push   0x14(%ebp)
+  802223:	ff 75 10             	push   0x10(%ebp)
+  802226:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  802229:	50                   	push   %eax
+  80222a:	68 6d 1d 80 00       	push   $0x801d6d
+  80222f:	e8 73 fb ff ff       	call   801da7 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  802234:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802237:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80223a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80223d:	83 c4 10             	add    $0x10,%esp
+}
+  802240:	c9                   	leave
+  802241:	c3                   	ret
+		return -E_INVAL;
+  802242:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802247:	eb f7                	jmp    802240 <vsnprintf+0x45>
+
+00802249 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  802249:	55                   	push   %ebp
+  80224a:	89 e5                	mov    %esp,%ebp
+  80224c:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80224f:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  802252:	50                   	push   %eax
+  802253:	ff 75 10             	push   0x10(%ebp)
+  802256:	ff 75 0c             	push   0xc(%ebp)
+  802259:	ff 75 08             	push   0x8(%ebp)
+  80225c:	e8 9a ff ff ff       	call   8021fb <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  802261:	c9                   	leave
+  802262:	c3                   	ret
+
+00802263 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  802263:	55                   	push   %ebp
+  802264:	89 e5                	mov    %esp,%ebp
+  802266:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  802269:	b8 00 00 00 00       	mov    $0x0,%eax
+  80226e:	eb 03                	jmp    802273 <strlen+0x10>
+		n++;
+  802270:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  802273:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802277:	75 f7                	jne    802270 <strlen+0xd>
+	return n;
+}
+  802279:	5d                   	pop    %ebp
+  80227a:	c3                   	ret
+
+0080227b <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80227b:	55                   	push   %ebp
+  80227c:	89 e5                	mov    %esp,%ebp
+  80227e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802281:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802284:	b8 00 00 00 00       	mov    $0x0,%eax
+  802289:	eb 03                	jmp    80228e <strnlen+0x13>
+		n++;
+  80228b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80228e:	39 d0                	cmp    %edx,%eax
+  802290:	74 08                	je     80229a <strnlen+0x1f>
+  802292:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802296:	75 f3                	jne    80228b <strnlen+0x10>
+  802298:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80229a:	89 d0                	mov    %edx,%eax
+  80229c:	5d                   	pop    %ebp
+  80229d:	c3                   	ret
+
+0080229e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80229e:	55                   	push   %ebp
+  80229f:	89 e5                	mov    %esp,%ebp
+  8022a1:	53                   	push   %ebx
+  8022a2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8022a5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8022a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022ad:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8022b1:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8022b4:	83 c0 01             	add    $0x1,%eax
+  8022b7:	84 d2                	test   %dl,%dl
+  8022b9:	75 f2                	jne    8022ad <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8022bb:	89 c8                	mov    %ecx,%eax
+  8022bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022c0:	c9                   	leave
+  8022c1:	c3                   	ret
+
+008022c2 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8022c2:	55                   	push   %ebp
+  8022c3:	89 e5                	mov    %esp,%ebp
+  8022c5:	53                   	push   %ebx
+  8022c6:	83 ec 10             	sub    $0x10,%esp
+  8022c9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8022cc:	53                   	push   %ebx
+  8022cd:	e8 91 ff ff ff       	call   802263 <strlen>
+  8022d2:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8022d5:	ff 75 0c             	push   0xc(%ebp)
+  8022d8:	01 d8                	add    %ebx,%eax
+  8022da:	50                   	push   %eax
+  8022db:	e8 be ff ff ff       	call   80229e <strcpy>
+	return dst;
+}
+  8022e0:	89 d8                	mov    %ebx,%eax
+  8022e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022e5:	c9                   	leave
+  8022e6:	c3                   	ret
+
+008022e7 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8022e7:	55                   	push   %ebp
+  8022e8:	89 e5                	mov    %esp,%ebp
+  8022ea:	56                   	push   %esi
+  8022eb:	53                   	push   %ebx
+  8022ec:	8b 75 08             	mov    0x8(%ebp),%esi
+  8022ef:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8022f2:	89 f3                	mov    %esi,%ebx
+  8022f4:	03 5d 10             	add    0x10(%ebp),%ebx
+  8022f7:	89 f0                	mov    %esi,%eax
+  8022f9:	eb 0f                	jmp    80230a <strncpy+0x23>
+		*dst++ = *src;
+  8022fb:	83 c0 01             	add    $0x1,%eax
+  8022fe:	0f b6 0a             	movzbl (%edx),%ecx
+  802301:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  802304:	80 f9 01             	cmp    $0x1,%cl
+  802307:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80230a:	39 d8                	cmp    %ebx,%eax
+  80230c:	75 ed                	jne    8022fb <strncpy+0x14>
+	}
+	return ret;
+}
+  80230e:	89 f0                	mov    %esi,%eax
+  802310:	5b                   	pop    %ebx
+  802311:	5e                   	pop    %esi
+  802312:	5d                   	pop    %ebp
+  802313:	c3                   	ret
+
+00802314 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  802314:	55                   	push   %ebp
+  802315:	89 e5                	mov    %esp,%ebp
+  802317:	56                   	push   %esi
+  802318:	53                   	push   %ebx
+  802319:	8b 75 08             	mov    0x8(%ebp),%esi
+  80231c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80231f:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  802322:	89 f0                	mov    %esi,%eax
+  802324:	85 d2                	test   %edx,%edx
+  802326:	74 21                	je     802349 <strlcpy+0x35>
+  802328:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80232c:	89 f2                	mov    %esi,%edx
+  80232e:	eb 09                	jmp    802339 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  802330:	83 c1 01             	add    $0x1,%ecx
+  802333:	83 c2 01             	add    $0x1,%edx
+  802336:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  802339:	39 c2                	cmp    %eax,%edx
+  80233b:	74 09                	je     802346 <strlcpy+0x32>
+  80233d:	0f b6 19             	movzbl (%ecx),%ebx
+  802340:	84 db                	test   %bl,%bl
+  802342:	75 ec                	jne    802330 <strlcpy+0x1c>
+  802344:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  802346:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  802349:	29 f0                	sub    %esi,%eax
+}
+  80234b:	5b                   	pop    %ebx
+  80234c:	5e                   	pop    %esi
+  80234d:	5d                   	pop    %ebp
+  80234e:	c3                   	ret
+
+0080234f <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80234f:	55                   	push   %ebp
+  802350:	89 e5                	mov    %esp,%ebp
+  802352:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802355:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  802358:	eb 06                	jmp    802360 <strcmp+0x11>
+		p++, q++;
+  80235a:	83 c1 01             	add    $0x1,%ecx
+  80235d:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  802360:	0f b6 01             	movzbl (%ecx),%eax
+  802363:	84 c0                	test   %al,%al
+  802365:	74 04                	je     80236b <strcmp+0x1c>
+  802367:	3a 02                	cmp    (%edx),%al
+  802369:	74 ef                	je     80235a <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80236b:	0f b6 c0             	movzbl %al,%eax
+  80236e:	0f b6 12             	movzbl (%edx),%edx
+  802371:	29 d0                	sub    %edx,%eax
+}
+  802373:	5d                   	pop    %ebp
+  802374:	c3                   	ret
+
+00802375 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  802375:	55                   	push   %ebp
+  802376:	89 e5                	mov    %esp,%ebp
+  802378:	53                   	push   %ebx
+  802379:	8b 45 08             	mov    0x8(%ebp),%eax
+  80237c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80237f:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  802382:	eb 09                	jmp    80238d <strncmp+0x18>
+		n--, p++, q++;
+  802384:	83 ea 01             	sub    $0x1,%edx
+  802387:	83 c0 01             	add    $0x1,%eax
+  80238a:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80238d:	85 d2                	test   %edx,%edx
+  80238f:	74 18                	je     8023a9 <strncmp+0x34>
+  802391:	0f b6 18             	movzbl (%eax),%ebx
+  802394:	84 db                	test   %bl,%bl
+  802396:	74 04                	je     80239c <strncmp+0x27>
+  802398:	3a 19                	cmp    (%ecx),%bl
+  80239a:	74 e8                	je     802384 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80239c:	0f b6 00             	movzbl (%eax),%eax
+  80239f:	0f b6 11             	movzbl (%ecx),%edx
+  8023a2:	29 d0                	sub    %edx,%eax
+}
+  8023a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023a7:	c9                   	leave
+  8023a8:	c3                   	ret
+		return 0;
+  8023a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ae:	eb f4                	jmp    8023a4 <strncmp+0x2f>
+
+008023b0 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8023b0:	55                   	push   %ebp
+  8023b1:	89 e5                	mov    %esp,%ebp
+  8023b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8023ba:	eb 03                	jmp    8023bf <strchr+0xf>
+  8023bc:	83 c0 01             	add    $0x1,%eax
+  8023bf:	0f b6 10             	movzbl (%eax),%edx
+  8023c2:	84 d2                	test   %dl,%dl
+  8023c4:	74 06                	je     8023cc <strchr+0x1c>
+		if (*s == c)
+  8023c6:	38 ca                	cmp    %cl,%dl
+  8023c8:	75 f2                	jne    8023bc <strchr+0xc>
+  8023ca:	eb 05                	jmp    8023d1 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8023cc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023d1:	5d                   	pop    %ebp
+  8023d2:	c3                   	ret
+
+008023d3 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8023d3:	55                   	push   %ebp
+  8023d4:	89 e5                	mov    %esp,%ebp
+  8023d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023d9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8023dd:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8023e0:	38 ca                	cmp    %cl,%dl
+  8023e2:	74 09                	je     8023ed <strfind+0x1a>
+  8023e4:	84 d2                	test   %dl,%dl
+  8023e6:	74 05                	je     8023ed <strfind+0x1a>
+	for (; *s; s++)
+  8023e8:	83 c0 01             	add    $0x1,%eax
+  8023eb:	eb f0                	jmp    8023dd <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8023ed:	5d                   	pop    %ebp
+  8023ee:	c3                   	ret
+
+008023ef <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8023ef:	55                   	push   %ebp
+  8023f0:	89 e5                	mov    %esp,%ebp
+  8023f2:	57                   	push   %edi
+  8023f3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8023f6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8023f9:	85 c9                	test   %ecx,%ecx
+  8023fb:	74 20                	je     80241d <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8023fd:	89 f8                	mov    %edi,%eax
+  8023ff:	09 c8                	or     %ecx,%eax
+  802401:	a8 03                	test   $0x3,%al
+  802403:	75 12                	jne    802417 <memset+0x28>
+		c &= 0xFF;
+  802405:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  802409:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80240f:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  802412:	fc                   	cld
+  802413:	f3 ab                	rep stos %eax,%es:(%edi)
+  802415:	eb 06                	jmp    80241d <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  802417:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80241a:	fc                   	cld
+  80241b:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80241d:	89 f8                	mov    %edi,%eax
+  80241f:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  802422:	c9                   	leave
+  802423:	c3                   	ret
+
+00802424 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  802424:	55                   	push   %ebp
+  802425:	89 e5                	mov    %esp,%ebp
+  802427:	57                   	push   %edi
+  802428:	56                   	push   %esi
+  802429:	8b 45 08             	mov    0x8(%ebp),%eax
+  80242c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80242f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  802432:	39 c6                	cmp    %eax,%esi
+  802434:	73 32                	jae    802468 <memmove+0x44>
+  802436:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  802439:	39 d0                	cmp    %edx,%eax
+  80243b:	73 2b                	jae    802468 <memmove+0x44>
+		s += n;
+		d += n;
+  80243d:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802440:	89 d6                	mov    %edx,%esi
+  802442:	09 fe                	or     %edi,%esi
+  802444:	09 ce                	or     %ecx,%esi
+  802446:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80244c:	75 0e                	jne    80245c <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80244e:	83 ef 04             	sub    $0x4,%edi
+  802451:	8d 72 fc             	lea    -0x4(%edx),%esi
+  802454:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  802457:	fd                   	std
+  802458:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80245a:	eb 09                	jmp    802465 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80245c:	83 ef 01             	sub    $0x1,%edi
+  80245f:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  802462:	fd                   	std
+  802463:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  802465:	fc                   	cld
+  802466:	eb 1a                	jmp    802482 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802468:	89 f2                	mov    %esi,%edx
+  80246a:	09 c2                	or     %eax,%edx
+  80246c:	09 ca                	or     %ecx,%edx
+  80246e:	f6 c2 03             	test   $0x3,%dl
+  802471:	75 0a                	jne    80247d <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  802473:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  802476:	89 c7                	mov    %eax,%edi
+  802478:	fc                   	cld
+  802479:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80247b:	eb 05                	jmp    802482 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80247d:	89 c7                	mov    %eax,%edi
+  80247f:	fc                   	cld
+  802480:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  802482:	5e                   	pop    %esi
+  802483:	5f                   	pop    %edi
+  802484:	5d                   	pop    %ebp
+  802485:	c3                   	ret
+
+00802486 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  802486:	55                   	push   %ebp
+  802487:	89 e5                	mov    %esp,%ebp
+  802489:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80248c:	ff 75 10             	push   0x10(%ebp)
+  80248f:	ff 75 0c             	push   0xc(%ebp)
+  802492:	ff 75 08             	push   0x8(%ebp)
+  802495:	e8 8a ff ff ff       	call   802424 <memmove>
+}
+  80249a:	c9                   	leave
+  80249b:	c3                   	ret
+
+0080249c <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80249c:	55                   	push   %ebp
+  80249d:	89 e5                	mov    %esp,%ebp
+  80249f:	56                   	push   %esi
+  8024a0:	53                   	push   %ebx
+  8024a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024a4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8024a7:	89 c6                	mov    %eax,%esi
+  8024a9:	03 75 10             	add    0x10(%ebp),%esi
+  8024ac:	eb 06                	jmp    8024b4 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8024ae:	83 c0 01             	add    $0x1,%eax
+  8024b1:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8024b4:	39 f0                	cmp    %esi,%eax
+  8024b6:	74 14                	je     8024cc <memcmp+0x30>
+		if (*s1 != *s2)
+  8024b8:	0f b6 08             	movzbl (%eax),%ecx
+  8024bb:	0f b6 1a             	movzbl (%edx),%ebx
+  8024be:	38 d9                	cmp    %bl,%cl
+  8024c0:	74 ec                	je     8024ae <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8024c2:	0f b6 c1             	movzbl %cl,%eax
+  8024c5:	0f b6 db             	movzbl %bl,%ebx
+  8024c8:	29 d8                	sub    %ebx,%eax
+  8024ca:	eb 05                	jmp    8024d1 <memcmp+0x35>
+	}
+
+	return 0;
+  8024cc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024d1:	5b                   	pop    %ebx
+  8024d2:	5e                   	pop    %esi
+  8024d3:	5d                   	pop    %ebp
+  8024d4:	c3                   	ret
+
+008024d5 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8024d5:	55                   	push   %ebp
+  8024d6:	89 e5                	mov    %esp,%ebp
+  8024d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8024de:	89 c2                	mov    %eax,%edx
+  8024e0:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8024e3:	eb 03                	jmp    8024e8 <memfind+0x13>
+  8024e5:	83 c0 01             	add    $0x1,%eax
+  8024e8:	39 d0                	cmp    %edx,%eax
+  8024ea:	73 04                	jae    8024f0 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8024ec:	38 08                	cmp    %cl,(%eax)
+  8024ee:	75 f5                	jne    8024e5 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8024f0:	5d                   	pop    %ebp
+  8024f1:	c3                   	ret
+
+008024f2 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8024f2:	55                   	push   %ebp
+  8024f3:	89 e5                	mov    %esp,%ebp
+  8024f5:	57                   	push   %edi
+  8024f6:	56                   	push   %esi
+  8024f7:	53                   	push   %ebx
+  8024f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024fb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8024fe:	eb 03                	jmp    802503 <strtol+0x11>
+		s++;
+  802500:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  802503:	0f b6 02             	movzbl (%edx),%eax
+  802506:	3c 20                	cmp    $0x20,%al
+  802508:	74 f6                	je     802500 <strtol+0xe>
+  80250a:	3c 09                	cmp    $0x9,%al
+  80250c:	74 f2                	je     802500 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  80250e:	3c 2b                	cmp    $0x2b,%al
+  802510:	74 2a                	je     80253c <strtol+0x4a>
+	int neg = 0;
+  802512:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  802517:	3c 2d                	cmp    $0x2d,%al
+  802519:	74 2b                	je     802546 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80251b:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802521:	75 0f                	jne    802532 <strtol+0x40>
+  802523:	80 3a 30             	cmpb   $0x30,(%edx)
+  802526:	74 28                	je     802550 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  802528:	85 db                	test   %ebx,%ebx
+  80252a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80252f:	0f 44 d8             	cmove  %eax,%ebx
+  802532:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802537:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80253a:	eb 46                	jmp    802582 <strtol+0x90>
+		s++;
+  80253c:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  80253f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802544:	eb d5                	jmp    80251b <strtol+0x29>
+		s++, neg = 1;
+  802546:	83 c2 01             	add    $0x1,%edx
+  802549:	bf 01 00 00 00       	mov    $0x1,%edi
+  80254e:	eb cb                	jmp    80251b <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802550:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802554:	74 0e                	je     802564 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  802556:	85 db                	test   %ebx,%ebx
+  802558:	75 d8                	jne    802532 <strtol+0x40>
+		s++, base = 8;
+  80255a:	83 c2 01             	add    $0x1,%edx
+  80255d:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802562:	eb ce                	jmp    802532 <strtol+0x40>
+		s += 2, base = 16;
+  802564:	83 c2 02             	add    $0x2,%edx
+  802567:	bb 10 00 00 00       	mov    $0x10,%ebx
+  80256c:	eb c4                	jmp    802532 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  80256e:	0f be c0             	movsbl %al,%eax
+  802571:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  802574:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802577:	7d 3a                	jge    8025b3 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  802579:	83 c2 01             	add    $0x1,%edx
+  80257c:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802580:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  802582:	0f b6 02             	movzbl (%edx),%eax
+  802585:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802588:	89 f3                	mov    %esi,%ebx
+  80258a:	80 fb 09             	cmp    $0x9,%bl
+  80258d:	76 df                	jbe    80256e <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  80258f:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802592:	89 f3                	mov    %esi,%ebx
+  802594:	80 fb 19             	cmp    $0x19,%bl
+  802597:	77 08                	ja     8025a1 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  802599:	0f be c0             	movsbl %al,%eax
+  80259c:	83 e8 57             	sub    $0x57,%eax
+  80259f:	eb d3                	jmp    802574 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  8025a1:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8025a4:	89 f3                	mov    %esi,%ebx
+  8025a6:	80 fb 19             	cmp    $0x19,%bl
+  8025a9:	77 08                	ja     8025b3 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  8025ab:	0f be c0             	movsbl %al,%eax
+  8025ae:	83 e8 37             	sub    $0x37,%eax
+  8025b1:	eb c1                	jmp    802574 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8025b3:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8025b7:	74 05                	je     8025be <strtol+0xcc>
+		*endptr = (char *) s;
+  8025b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025bc:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  8025be:	89 c8                	mov    %ecx,%eax
+  8025c0:	f7 d8                	neg    %eax
+  8025c2:	85 ff                	test   %edi,%edi
+  8025c4:	0f 45 c8             	cmovne %eax,%ecx
+}
+  8025c7:	89 c8                	mov    %ecx,%eax
+  8025c9:	5b                   	pop    %ebx
+  8025ca:	5e                   	pop    %esi
+  8025cb:	5f                   	pop    %edi
+  8025cc:	5d                   	pop    %ebp
+  8025cd:	c3                   	ret
+
+008025ce <atoi>:
+
+int
+atoi(const char *s)
+{
+  8025ce:	55                   	push   %ebp
+  8025cf:	89 e5                	mov    %esp,%ebp
+  8025d1:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  8025d4:	6a 0a                	push   $0xa
+  8025d6:	6a 00                	push   $0x0
+  8025d8:	ff 75 08             	push   0x8(%ebp)
+  8025db:	e8 12 ff ff ff       	call   8024f2 <strtol>
+}
+  8025e0:	c9                   	leave
+  8025e1:	c3                   	ret
+
+008025e2 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8025e2:	55                   	push   %ebp
+  8025e3:	89 e5                	mov    %esp,%ebp
+  8025e5:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8025e8:	83 3d 0c 30 80 00 00 	cmpl   $0x0,0x80300c
+  8025ef:	74 0a                	je     8025fb <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8025f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025f4:	a3 0c 30 80 00       	mov    %eax,0x80300c
+}
+  8025f9:	c9                   	leave
+  8025fa:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE),
+  8025fb:	83 ec 04             	sub    $0x4,%esp
+  8025fe:	6a 07                	push   $0x7
+  802600:	68 00 f0 bf ee       	push   $0xeebff000
+  802605:	6a 00                	push   $0x0
+  802607:	e8 94 df ff ff       	call   8005a0 <sys_page_alloc>
+  80260c:	83 c4 10             	add    $0x10,%esp
+  80260f:	85 c0                	test   %eax,%eax
+  802611:	78 28                	js     80263b <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  802613:	83 ec 08             	sub    $0x8,%esp
+  802616:	68 1f 1c 80 00       	push   $0x801c1f
+  80261b:	6a 00                	push   $0x0
+  80261d:	e8 3d e6 ff ff       	call   800c5f <sys_env_set_pgfault_upcall>
+  802622:	83 c4 10             	add    $0x10,%esp
+  802625:	85 c0                	test   %eax,%eax
+  802627:	79 c8                	jns    8025f1 <set_pgfault_handler+0xf>
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+  802629:	50                   	push   %eax
+  80262a:	68 a4 2b 80 00       	push   $0x802ba4
+  80262f:	6a 24                	push   $0x24
+  802631:	68 d8 2b 80 00       	push   $0x802bd8
+  802636:	e8 0a f6 ff ff       	call   801c45 <_panic>
+			panic("set_pgfault_handler: sys_page_alloc: %e", r);
+  80263b:	50                   	push   %eax
+  80263c:	68 7c 2b 80 00       	push   $0x802b7c
+  802641:	6a 22                	push   $0x22
+  802643:	68 d8 2b 80 00       	push   $0x802bd8
+  802648:	e8 f8 f5 ff ff       	call   801c45 <_panic>
+
+0080264d <dm>:
+  80264d:	55                   	push   %ebp
+  80264e:	57                   	push   %edi
+  80264f:	56                   	push   %esi
+  802650:	53                   	push   %ebx
+  802651:	83 ec 24             	sub    $0x24,%esp
+  802654:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802658:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80265c:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802660:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802664:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802668:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80266c:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802670:	b8 00 00 00 00       	mov    $0x0,%eax
+  802675:	ba 00 00 00 00       	mov    $0x0,%edx
+  80267a:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80267f:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802686:	00 
+  802687:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80268e:	00 
+  80268f:	89 fb                	mov    %edi,%ebx
+  802691:	eb 08                	jmp    80269b <dm+0x4e>
+  802693:	83 e9 01             	sub    $0x1,%ecx
+  802696:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802699:	74 68                	je     802703 <dm+0xb6>
+  80269b:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80269f:	01 c0                	add    %eax,%eax
+  8026a1:	89 c6                	mov    %eax,%esi
+  8026a3:	89 d7                	mov    %edx,%edi
+  8026a5:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8026a9:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026ad:	0f ad d0             	shrd   %cl,%edx,%eax
+  8026b0:	d3 ea                	shr    %cl,%edx
+  8026b2:	f6 c1 20             	test   $0x20,%cl
+  8026b5:	74 04                	je     8026bb <dm+0x6e>
+  8026b7:	89 d0                	mov    %edx,%eax
+  8026b9:	31 d2                	xor    %edx,%edx
+  8026bb:	83 e0 01             	and    $0x1,%eax
+  8026be:	89 04 24             	mov    %eax,(%esp)
+  8026c1:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8026c8:	00 
+  8026c9:	8b 04 24             	mov    (%esp),%eax
+  8026cc:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8026d0:	09 f0                	or     %esi,%eax
+  8026d2:	09 fa                	or     %edi,%edx
+  8026d4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8026d8:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8026dc:	39 f0                	cmp    %esi,%eax
+  8026de:	89 d5                	mov    %edx,%ebp
+  8026e0:	19 fd                	sbb    %edi,%ebp
+  8026e2:	72 af                	jb     802693 <dm+0x46>
+  8026e4:	29 f0                	sub    %esi,%eax
+  8026e6:	19 fa                	sbb    %edi,%edx
+  8026e8:	89 cf                	mov    %ecx,%edi
+  8026ea:	c1 ef 05             	shr    $0x5,%edi
+  8026ed:	83 e7 01             	and    $0x1,%edi
+  8026f0:	89 fe                	mov    %edi,%esi
+  8026f2:	83 f6 01             	xor    $0x1,%esi
+  8026f5:	d3 e6                	shl    %cl,%esi
+  8026f7:	d3 e7                	shl    %cl,%edi
+  8026f9:	09 74 24 18          	or     %esi,0x18(%esp)
+  8026fd:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802701:	eb 90                	jmp    802693 <dm+0x46>
+  802703:	85 db                	test   %ebx,%ebx
+  802705:	74 05                	je     80270c <dm+0xbf>
+  802707:	89 03                	mov    %eax,(%ebx)
+  802709:	89 53 04             	mov    %edx,0x4(%ebx)
+  80270c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802710:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802714:	83 c4 24             	add    $0x24,%esp
+  802717:	5b                   	pop    %ebx
+  802718:	5e                   	pop    %esi
+  802719:	5f                   	pop    %edi
+  80271a:	5d                   	pop    %ebp
+  80271b:	c3                   	ret
+
+0080271c <__udivdi3>:
+  80271c:	83 ec 08             	sub    $0x8,%esp
+  80271f:	6a 00                	push   $0x0
+  802721:	ff 74 24 1c          	push   0x1c(%esp)
+  802725:	ff 74 24 1c          	push   0x1c(%esp)
+  802729:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80272d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802731:	e8 17 ff ff ff       	call   80264d <dm>
+  802736:	83 c4 14             	add    $0x14,%esp
+  802739:	c3                   	ret
+
+0080273a <__umoddi3>:
+  80273a:	83 ec 18             	sub    $0x18,%esp
+  80273d:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802741:	50                   	push   %eax
+  802742:	ff 74 24 2c          	push   0x2c(%esp)
+  802746:	ff 74 24 2c          	push   0x2c(%esp)
+  80274a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80274e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802752:	e8 f6 fe ff ff       	call   80264d <dm>
+  802757:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80275b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80275f:	83 c4 24             	add    $0x24,%esp
+  802762:	c3                   	ret
+
+00802763 <__divdi3>:
+  802763:	53                   	push   %ebx
+  802764:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802768:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80276c:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  802770:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  802774:	85 d2                	test   %edx,%edx
+  802776:	78 15                	js     80278d <__divdi3+0x2a>
+  802778:	85 db                	test   %ebx,%ebx
+  80277a:	78 34                	js     8027b0 <__divdi3+0x4d>
+  80277c:	83 ec 04             	sub    $0x4,%esp
+  80277f:	6a 00                	push   $0x0
+  802781:	53                   	push   %ebx
+  802782:	51                   	push   %ecx
+  802783:	e8 c5 fe ff ff       	call   80264d <dm>
+  802788:	83 c4 10             	add    $0x10,%esp
+  80278b:	eb 21                	jmp    8027ae <__divdi3+0x4b>
+  80278d:	f7 d8                	neg    %eax
+  80278f:	83 d2 00             	adc    $0x0,%edx
+  802792:	f7 da                	neg    %edx
+  802794:	85 db                	test   %ebx,%ebx
+  802796:	78 30                	js     8027c8 <__divdi3+0x65>
+  802798:	83 ec 04             	sub    $0x4,%esp
+  80279b:	6a 00                	push   $0x0
+  80279d:	53                   	push   %ebx
+  80279e:	51                   	push   %ecx
+  80279f:	e8 a9 fe ff ff       	call   80264d <dm>
+  8027a4:	83 c4 10             	add    $0x10,%esp
+  8027a7:	f7 d8                	neg    %eax
+  8027a9:	83 d2 00             	adc    $0x0,%edx
+  8027ac:	f7 da                	neg    %edx
+  8027ae:	5b                   	pop    %ebx
+  8027af:	c3                   	ret
+  8027b0:	83 ec 04             	sub    $0x4,%esp
+  8027b3:	6a 00                	push   $0x0
+  8027b5:	f7 d9                	neg    %ecx
+  8027b7:	83 d3 00             	adc    $0x0,%ebx
+  8027ba:	f7 db                	neg    %ebx
+  8027bc:	53                   	push   %ebx
+  8027bd:	51                   	push   %ecx
+  8027be:	e8 8a fe ff ff       	call   80264d <dm>
+  8027c3:	83 c4 10             	add    $0x10,%esp
+  8027c6:	eb df                	jmp    8027a7 <__divdi3+0x44>
+  8027c8:	83 ec 04             	sub    $0x4,%esp
+  8027cb:	6a 00                	push   $0x0
+  8027cd:	f7 d9                	neg    %ecx
+  8027cf:	83 d3 00             	adc    $0x0,%ebx
+  8027d2:	f7 db                	neg    %ebx
+  8027d4:	53                   	push   %ebx
+  8027d5:	51                   	push   %ecx
+  8027d6:	e8 72 fe ff ff       	call   80264d <dm>
+  8027db:	83 c4 10             	add    $0x10,%esp
+  8027de:	eb ce                	jmp    8027ae <__divdi3+0x4b>
+
+008027e0 <__moddi3>:
+  8027e0:	55                   	push   %ebp
+  8027e1:	57                   	push   %edi
+  8027e2:	56                   	push   %esi
+  8027e3:	53                   	push   %ebx
+  8027e4:	83 ec 18             	sub    $0x18,%esp
+  8027e7:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  8027eb:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8027ef:	89 f1                	mov    %esi,%ecx
+  8027f1:	f7 d9                	neg    %ecx
+  8027f3:	89 da                	mov    %ebx,%edx
+  8027f5:	83 d2 00             	adc    $0x0,%edx
+  8027f8:	f7 da                	neg    %edx
+  8027fa:	0f 48 ce             	cmovs  %esi,%ecx
+  8027fd:	0f 48 d3             	cmovs  %ebx,%edx
+  802800:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802804:	50                   	push   %eax
+  802805:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802809:	f7 de                	neg    %esi
+  80280b:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  80280f:	83 d0 00             	adc    $0x0,%eax
+  802812:	f7 d8                	neg    %eax
+  802814:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802819:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  80281e:	50                   	push   %eax
+  80281f:	56                   	push   %esi
+  802820:	89 c8                	mov    %ecx,%eax
+  802822:	e8 26 fe ff ff       	call   80264d <dm>
+  802827:	83 c4 10             	add    $0x10,%esp
+  80282a:	85 db                	test   %ebx,%ebx
+  80282c:	78 10                	js     80283e <__moddi3+0x5e>
+  80282e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802832:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802836:	83 c4 14             	add    $0x14,%esp
+  802839:	5b                   	pop    %ebx
+  80283a:	5e                   	pop    %esi
+  80283b:	5f                   	pop    %edi
+  80283c:	5d                   	pop    %ebp
+  80283d:	c3                   	ret
+  80283e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802842:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802846:	f7 d8                	neg    %eax
+  802848:	83 d2 00             	adc    $0x0,%edx
+  80284b:	f7 da                	neg    %edx
+  80284d:	eb e7                	jmp    802836 <__moddi3+0x56>
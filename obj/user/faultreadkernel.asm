@@ -0,0 +1,5140 @@
+
+obj/user/faultreadkernel:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 1d 00 00 00       	call   80004e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	cprintf("I read %08x from location 0xf0100000!\n", *(unsigned*)0xf0100000);
+  800039:	ff 35 00 00 10 f0    	push   0xf0100000
+  80003f:	68 80 28 80 00       	push   $0x802880
+  800044:	e8 f5 00 00 00       	call   80013e <cprintf>
+}
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	56                   	push   %esi
+  800052:	53                   	push   %ebx
+  800053:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800056:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  800059:	e8 64 0e 00 00       	call   800ec2 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  80005e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800063:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  800069:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80006e:	a3 08 30 80 00       	mov    %eax,0x803008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800073:	85 db                	test   %ebx,%ebx
+  800075:	7e 07                	jle    80007e <libmain+0x30>
+		binaryname = argv[0];
+  800077:	8b 06                	mov    (%esi),%eax
+  800079:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  80007e:	83 ec 08             	sub    $0x8,%esp
+  800081:	56                   	push   %esi
+  800082:	53                   	push   %ebx
+  800083:	e8 ab ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800088:	e8 0a 00 00 00       	call   800097 <exit>
+}
+  80008d:	83 c4 10             	add    $0x10,%esp
+  800090:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800093:	5b                   	pop    %ebx
+  800094:	5e                   	pop    %esi
+  800095:	5d                   	pop    %ebp
+  800096:	c3                   	ret
+
+00800097 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800097:	55                   	push   %ebp
+  800098:	89 e5                	mov    %esp,%ebp
+  80009a:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  80009d:	6a 00                	push   $0x0
+  80009f:	e8 5c 0d 00 00       	call   800e00 <sys_env_destroy>
+}
+  8000a4:	83 c4 10             	add    $0x10,%esp
+  8000a7:	c9                   	leave
+  8000a8:	c3                   	ret
+
+008000a9 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000a9:	55                   	push   %ebp
+  8000aa:	89 e5                	mov    %esp,%ebp
+  8000ac:	53                   	push   %ebx
+  8000ad:	83 ec 04             	sub    $0x4,%esp
+  8000b0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8000b3:	8b 13                	mov    (%ebx),%edx
+  8000b5:	8d 42 01             	lea    0x1(%edx),%eax
+  8000b8:	89 03                	mov    %eax,(%ebx)
+  8000ba:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000bd:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8000c1:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8000c6:	74 09                	je     8000d1 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8000c8:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8000cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000cf:	c9                   	leave
+  8000d0:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8000d1:	83 ec 08             	sub    $0x8,%esp
+  8000d4:	68 ff 00 00 00       	push   $0xff
+  8000d9:	8d 43 08             	lea    0x8(%ebx),%eax
+  8000dc:	50                   	push   %eax
+  8000dd:	e8 e2 0b 00 00       	call   800cc4 <sys_cputs>
+		b->idx = 0;
+  8000e2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8000e8:	83 c4 10             	add    $0x10,%esp
+  8000eb:	eb db                	jmp    8000c8 <putch+0x1f>
+
+008000ed <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8000ed:	55                   	push   %ebp
+  8000ee:	89 e5                	mov    %esp,%ebp
+  8000f0:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8000f6:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8000fd:	00 00 00 
+	b.cnt = 0;
+  800100:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800107:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80010a:	ff 75 0c             	push   0xc(%ebp)
+  80010d:	ff 75 08             	push   0x8(%ebp)
+  800110:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800116:	50                   	push   %eax
+  800117:	68 a9 00 80 00       	push   $0x8000a9
+  80011c:	e8 14 01 00 00       	call   800235 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800121:	83 c4 08             	add    $0x8,%esp
+  800124:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80012a:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800130:	50                   	push   %eax
+  800131:	e8 8e 0b 00 00       	call   800cc4 <sys_cputs>
+
+	return b.cnt;
+}
+  800136:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80013c:	c9                   	leave
+  80013d:	c3                   	ret
+
+0080013e <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80013e:	55                   	push   %ebp
+  80013f:	89 e5                	mov    %esp,%ebp
+  800141:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800144:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800147:	50                   	push   %eax
+  800148:	ff 75 08             	push   0x8(%ebp)
+  80014b:	e8 9d ff ff ff       	call   8000ed <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800150:	c9                   	leave
+  800151:	c3                   	ret
+
+00800152 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800152:	55                   	push   %ebp
+  800153:	89 e5                	mov    %esp,%ebp
+  800155:	57                   	push   %edi
+  800156:	56                   	push   %esi
+  800157:	53                   	push   %ebx
+  800158:	83 ec 1c             	sub    $0x1c,%esp
+  80015b:	89 c7                	mov    %eax,%edi
+  80015d:	89 d6                	mov    %edx,%esi
+  80015f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800162:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800165:	89 d1                	mov    %edx,%ecx
+  800167:	89 c2                	mov    %eax,%edx
+  800169:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80016c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80016f:	8b 45 10             	mov    0x10(%ebp),%eax
+  800172:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800175:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800178:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80017f:	39 c2                	cmp    %eax,%edx
+  800181:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800184:	72 3e                	jb     8001c4 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800186:	83 ec 0c             	sub    $0xc,%esp
+  800189:	ff 75 18             	push   0x18(%ebp)
+  80018c:	83 eb 01             	sub    $0x1,%ebx
+  80018f:	53                   	push   %ebx
+  800190:	50                   	push   %eax
+  800191:	83 ec 08             	sub    $0x8,%esp
+  800194:	ff 75 e4             	push   -0x1c(%ebp)
+  800197:	ff 75 e0             	push   -0x20(%ebp)
+  80019a:	ff 75 dc             	push   -0x24(%ebp)
+  80019d:	ff 75 d8             	push   -0x28(%ebp)
+  8001a0:	e8 89 25 00 00       	call   80272e <__udivdi3>
+  8001a5:	83 c4 18             	add    $0x18,%esp
+  8001a8:	52                   	push   %edx
+  8001a9:	50                   	push   %eax
+  8001aa:	89 f2                	mov    %esi,%edx
+  8001ac:	89 f8                	mov    %edi,%eax
+  8001ae:	e8 9f ff ff ff       	call   800152 <printnum>
+  8001b3:	83 c4 20             	add    $0x20,%esp
+  8001b6:	eb 13                	jmp    8001cb <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8001b8:	83 ec 08             	sub    $0x8,%esp
+  8001bb:	56                   	push   %esi
+  8001bc:	ff 75 18             	push   0x18(%ebp)
+  8001bf:	ff d7                	call   *%edi
+  8001c1:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8001c4:	83 eb 01             	sub    $0x1,%ebx
+  8001c7:	85 db                	test   %ebx,%ebx
+  8001c9:	7f ed                	jg     8001b8 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8001cb:	83 ec 08             	sub    $0x8,%esp
+  8001ce:	56                   	push   %esi
+  8001cf:	83 ec 04             	sub    $0x4,%esp
+  8001d2:	ff 75 e4             	push   -0x1c(%ebp)
+  8001d5:	ff 75 e0             	push   -0x20(%ebp)
+  8001d8:	ff 75 dc             	push   -0x24(%ebp)
+  8001db:	ff 75 d8             	push   -0x28(%ebp)
+  8001de:	e8 69 25 00 00       	call   80274c <__umoddi3>
+  8001e3:	83 c4 14             	add    $0x14,%esp
+  8001e6:	0f be 80 b1 28 80 00 	movsbl 0x8028b1(%eax),%eax
+  8001ed:	50                   	push   %eax
+  8001ee:	ff d7                	call   *%edi
+}
+  8001f0:	83 c4 10             	add    $0x10,%esp
+  8001f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001f6:	5b                   	pop    %ebx
+  8001f7:	5e                   	pop    %esi
+  8001f8:	5f                   	pop    %edi
+  8001f9:	5d                   	pop    %ebp
+  8001fa:	c3                   	ret
+
+008001fb <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8001fb:	55                   	push   %ebp
+  8001fc:	89 e5                	mov    %esp,%ebp
+  8001fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800201:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800205:	8b 10                	mov    (%eax),%edx
+  800207:	3b 50 04             	cmp    0x4(%eax),%edx
+  80020a:	73 0a                	jae    800216 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80020c:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80020f:	89 08                	mov    %ecx,(%eax)
+  800211:	8b 45 08             	mov    0x8(%ebp),%eax
+  800214:	88 02                	mov    %al,(%edx)
+}
+  800216:	5d                   	pop    %ebp
+  800217:	c3                   	ret
+
+00800218 <printfmt>:
+{
+  800218:	55                   	push   %ebp
+  800219:	89 e5                	mov    %esp,%ebp
+  80021b:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80021e:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800221:	50                   	push   %eax
+  800222:	ff 75 10             	push   0x10(%ebp)
+  800225:	ff 75 0c             	push   0xc(%ebp)
+  800228:	ff 75 08             	push   0x8(%ebp)
+  80022b:	e8 05 00 00 00       	call   800235 <vprintfmt>
+}
+  800230:	83 c4 10             	add    $0x10,%esp
+  800233:	c9                   	leave
+  800234:	c3                   	ret
+
+00800235 <vprintfmt>:
+{
+  800235:	55                   	push   %ebp
+  800236:	89 e5                	mov    %esp,%ebp
+  800238:	57                   	push   %edi
+  800239:	56                   	push   %esi
+  80023a:	53                   	push   %ebx
+  80023b:	83 ec 2c             	sub    $0x2c,%esp
+  80023e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800241:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800244:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800247:	eb 0a                	jmp    800253 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800249:	83 ec 08             	sub    $0x8,%esp
+  80024c:	53                   	push   %ebx
+  80024d:	50                   	push   %eax
+  80024e:	ff d6                	call   *%esi
+  800250:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800253:	83 c7 01             	add    $0x1,%edi
+  800256:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80025a:	83 f8 25             	cmp    $0x25,%eax
+  80025d:	74 0c                	je     80026b <vprintfmt+0x36>
+			if (ch == '\0')
+  80025f:	85 c0                	test   %eax,%eax
+  800261:	75 e6                	jne    800249 <vprintfmt+0x14>
+}
+  800263:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800266:	5b                   	pop    %ebx
+  800267:	5e                   	pop    %esi
+  800268:	5f                   	pop    %edi
+  800269:	5d                   	pop    %ebp
+  80026a:	c3                   	ret
+		padc = ' ';
+  80026b:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80026f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800276:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80027d:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800284:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800289:	8d 47 01             	lea    0x1(%edi),%eax
+  80028c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80028f:	0f b6 17             	movzbl (%edi),%edx
+  800292:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800295:	3c 55                	cmp    $0x55,%al
+  800297:	0f 87 cf 03 00 00    	ja     80066c <vprintfmt+0x437>
+  80029d:	0f b6 c0             	movzbl %al,%eax
+  8002a0:	ff 24 85 a0 29 80 00 	jmp    *0x8029a0(,%eax,4)
+  8002a7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8002aa:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002ae:	eb d9                	jmp    800289 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8002b0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002b3:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8002b7:	eb d0                	jmp    800289 <vprintfmt+0x54>
+  8002b9:	0f b6 d2             	movzbl %dl,%edx
+  8002bc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8002bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c4:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8002c7:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8002ca:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8002ce:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8002d1:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8002d4:	83 f9 09             	cmp    $0x9,%ecx
+  8002d7:	77 55                	ja     80032e <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8002d9:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8002dc:	eb e9                	jmp    8002c7 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8002de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002e1:	8b 00                	mov    (%eax),%eax
+  8002e3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8002e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002e9:	8d 40 04             	lea    0x4(%eax),%eax
+  8002ec:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8002ef:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8002f2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8002f6:	79 91                	jns    800289 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8002f8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8002fb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002fe:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800305:	eb 82                	jmp    800289 <vprintfmt+0x54>
+			if (width < 0)
+  800307:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80030a:	85 d2                	test   %edx,%edx
+  80030c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800311:	0f 49 c2             	cmovns %edx,%eax
+  800314:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800317:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80031a:	e9 6a ff ff ff       	jmp    800289 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80031f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800322:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800329:	e9 5b ff ff ff       	jmp    800289 <vprintfmt+0x54>
+  80032e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800331:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800334:	eb bc                	jmp    8002f2 <vprintfmt+0xbd>
+			lflag++;
+  800336:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800339:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80033c:	e9 48 ff ff ff       	jmp    800289 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800341:	8b 45 14             	mov    0x14(%ebp),%eax
+  800344:	8d 78 04             	lea    0x4(%eax),%edi
+  800347:	83 ec 08             	sub    $0x8,%esp
+  80034a:	53                   	push   %ebx
+  80034b:	ff 30                	push   (%eax)
+  80034d:	ff d6                	call   *%esi
+			break;
+  80034f:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800352:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800355:	e9 b1 02 00 00       	jmp    80060b <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  80035a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80035d:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800360:	8b 10                	mov    (%eax),%edx
+  800362:	89 d0                	mov    %edx,%eax
+  800364:	f7 d8                	neg    %eax
+  800366:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800369:	83 f8 0d             	cmp    $0xd,%eax
+  80036c:	7f 23                	jg     800391 <vprintfmt+0x15c>
+  80036e:	8b 14 85 00 2b 80 00 	mov    0x802b00(,%eax,4),%edx
+  800375:	85 d2                	test   %edx,%edx
+  800377:	74 18                	je     800391 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800379:	52                   	push   %edx
+  80037a:	68 d2 28 80 00       	push   $0x8028d2
+  80037f:	53                   	push   %ebx
+  800380:	56                   	push   %esi
+  800381:	e8 92 fe ff ff       	call   800218 <printfmt>
+  800386:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800389:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80038c:	e9 7a 02 00 00       	jmp    80060b <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800391:	50                   	push   %eax
+  800392:	68 c9 28 80 00       	push   $0x8028c9
+  800397:	53                   	push   %ebx
+  800398:	56                   	push   %esi
+  800399:	e8 7a fe ff ff       	call   800218 <printfmt>
+  80039e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003a1:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003a4:	e9 62 02 00 00       	jmp    80060b <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ac:	83 c0 04             	add    $0x4,%eax
+  8003af:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b5:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8003b7:	85 c9                	test   %ecx,%ecx
+  8003b9:	b8 c2 28 80 00       	mov    $0x8028c2,%eax
+  8003be:	0f 45 c1             	cmovne %ecx,%eax
+  8003c1:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8003c4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003c8:	7e 06                	jle    8003d0 <vprintfmt+0x19b>
+  8003ca:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8003ce:	75 0b                	jne    8003db <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8003d0:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8003d3:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8003d6:	89 75 08             	mov    %esi,0x8(%ebp)
+  8003d9:	eb 5c                	jmp    800437 <vprintfmt+0x202>
+  8003db:	83 ec 08             	sub    $0x8,%esp
+  8003de:	ff 75 d0             	push   -0x30(%ebp)
+  8003e1:	ff 75 cc             	push   -0x34(%ebp)
+  8003e4:	e8 20 03 00 00       	call   800709 <strnlen>
+  8003e9:	89 c2                	mov    %eax,%edx
+  8003eb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8003ee:	29 d0                	sub    %edx,%eax
+  8003f0:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8003f3:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8003f7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003fa:	89 75 08             	mov    %esi,0x8(%ebp)
+  8003fd:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8003ff:	eb 0e                	jmp    80040f <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800401:	83 ec 08             	sub    $0x8,%esp
+  800404:	53                   	push   %ebx
+  800405:	57                   	push   %edi
+  800406:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800409:	83 ee 01             	sub    $0x1,%esi
+  80040c:	83 c4 10             	add    $0x10,%esp
+  80040f:	85 f6                	test   %esi,%esi
+  800411:	7f ee                	jg     800401 <vprintfmt+0x1cc>
+  800413:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800416:	8b 75 08             	mov    0x8(%ebp),%esi
+  800419:	85 c0                	test   %eax,%eax
+  80041b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800420:	0f 49 d0             	cmovns %eax,%edx
+  800423:	29 d0                	sub    %edx,%eax
+  800425:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800428:	eb a6                	jmp    8003d0 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80042a:	83 ec 08             	sub    $0x8,%esp
+  80042d:	53                   	push   %ebx
+  80042e:	52                   	push   %edx
+  80042f:	ff 55 08             	call   *0x8(%ebp)
+  800432:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800435:	89 f1                	mov    %esi,%ecx
+  800437:	8d 71 01             	lea    0x1(%ecx),%esi
+  80043a:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80043e:	0f be d0             	movsbl %al,%edx
+  800441:	85 d2                	test   %edx,%edx
+  800443:	74 28                	je     80046d <vprintfmt+0x238>
+  800445:	85 ff                	test   %edi,%edi
+  800447:	78 05                	js     80044e <vprintfmt+0x219>
+  800449:	83 ef 01             	sub    $0x1,%edi
+  80044c:	78 30                	js     80047e <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80044e:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800452:	74 d6                	je     80042a <vprintfmt+0x1f5>
+  800454:	0f be c0             	movsbl %al,%eax
+  800457:	83 e8 20             	sub    $0x20,%eax
+  80045a:	83 f8 5e             	cmp    $0x5e,%eax
+  80045d:	76 cb                	jbe    80042a <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80045f:	83 ec 08             	sub    $0x8,%esp
+  800462:	53                   	push   %ebx
+  800463:	6a 3f                	push   $0x3f
+  800465:	ff 55 08             	call   *0x8(%ebp)
+  800468:	83 c4 10             	add    $0x10,%esp
+  80046b:	eb c8                	jmp    800435 <vprintfmt+0x200>
+  80046d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800470:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800473:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800476:	01 d0                	add    %edx,%eax
+  800478:	29 c8                	sub    %ecx,%eax
+  80047a:	89 c7                	mov    %eax,%edi
+  80047c:	eb 13                	jmp    800491 <vprintfmt+0x25c>
+  80047e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800481:	eb ed                	jmp    800470 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800483:	83 ec 08             	sub    $0x8,%esp
+  800486:	53                   	push   %ebx
+  800487:	6a 20                	push   $0x20
+  800489:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80048b:	83 ef 01             	sub    $0x1,%edi
+  80048e:	83 c4 10             	add    $0x10,%esp
+  800491:	85 ff                	test   %edi,%edi
+  800493:	7f ee                	jg     800483 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800495:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800498:	89 45 14             	mov    %eax,0x14(%ebp)
+  80049b:	e9 6b 01 00 00       	jmp    80060b <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8004a0:	83 f9 01             	cmp    $0x1,%ecx
+  8004a3:	7f 1f                	jg     8004c4 <vprintfmt+0x28f>
+	else if (lflag)
+  8004a5:	85 c9                	test   %ecx,%ecx
+  8004a7:	74 67                	je     800510 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8004a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ac:	8b 00                	mov    (%eax),%eax
+  8004ae:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004b1:	89 c1                	mov    %eax,%ecx
+  8004b3:	c1 f9 1f             	sar    $0x1f,%ecx
+  8004b6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004bc:	8d 40 04             	lea    0x4(%eax),%eax
+  8004bf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004c2:	eb 17                	jmp    8004db <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8004c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c7:	8b 50 04             	mov    0x4(%eax),%edx
+  8004ca:	8b 00                	mov    (%eax),%eax
+  8004cc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004cf:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8004d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d5:	8d 40 08             	lea    0x8(%eax),%eax
+  8004d8:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8004db:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8004de:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8004e1:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8004e6:	85 c9                	test   %ecx,%ecx
+  8004e8:	0f 89 03 01 00 00    	jns    8005f1 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8004ee:	83 ec 08             	sub    $0x8,%esp
+  8004f1:	53                   	push   %ebx
+  8004f2:	6a 2d                	push   $0x2d
+  8004f4:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8004f6:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8004f9:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8004fc:	f7 da                	neg    %edx
+  8004fe:	83 d1 00             	adc    $0x0,%ecx
+  800501:	f7 d9                	neg    %ecx
+  800503:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800506:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80050b:	e9 e1 00 00 00       	jmp    8005f1 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800510:	8b 45 14             	mov    0x14(%ebp),%eax
+  800513:	8b 00                	mov    (%eax),%eax
+  800515:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800518:	89 c1                	mov    %eax,%ecx
+  80051a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80051d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800520:	8b 45 14             	mov    0x14(%ebp),%eax
+  800523:	8d 40 04             	lea    0x4(%eax),%eax
+  800526:	89 45 14             	mov    %eax,0x14(%ebp)
+  800529:	eb b0                	jmp    8004db <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80052b:	83 f9 01             	cmp    $0x1,%ecx
+  80052e:	7f 1e                	jg     80054e <vprintfmt+0x319>
+	else if (lflag)
+  800530:	85 c9                	test   %ecx,%ecx
+  800532:	74 32                	je     800566 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800534:	8b 45 14             	mov    0x14(%ebp),%eax
+  800537:	8b 10                	mov    (%eax),%edx
+  800539:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80053e:	8d 40 04             	lea    0x4(%eax),%eax
+  800541:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800544:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800549:	e9 a3 00 00 00       	jmp    8005f1 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80054e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800551:	8b 10                	mov    (%eax),%edx
+  800553:	8b 48 04             	mov    0x4(%eax),%ecx
+  800556:	8d 40 08             	lea    0x8(%eax),%eax
+  800559:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80055c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800561:	e9 8b 00 00 00       	jmp    8005f1 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800566:	8b 45 14             	mov    0x14(%ebp),%eax
+  800569:	8b 10                	mov    (%eax),%edx
+  80056b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800570:	8d 40 04             	lea    0x4(%eax),%eax
+  800573:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800576:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80057b:	eb 74                	jmp    8005f1 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  80057d:	83 f9 01             	cmp    $0x1,%ecx
+  800580:	7f 1b                	jg     80059d <vprintfmt+0x368>
+	else if (lflag)
+  800582:	85 c9                	test   %ecx,%ecx
+  800584:	74 2c                	je     8005b2 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800586:	8b 45 14             	mov    0x14(%ebp),%eax
+  800589:	8b 10                	mov    (%eax),%edx
+  80058b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800590:	8d 40 04             	lea    0x4(%eax),%eax
+  800593:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800596:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80059b:	eb 54                	jmp    8005f1 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80059d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a0:	8b 10                	mov    (%eax),%edx
+  8005a2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005a5:	8d 40 08             	lea    0x8(%eax),%eax
+  8005a8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005ab:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8005b0:	eb 3f                	jmp    8005f1 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b5:	8b 10                	mov    (%eax),%edx
+  8005b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005bc:	8d 40 04             	lea    0x4(%eax),%eax
+  8005bf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005c2:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8005c7:	eb 28                	jmp    8005f1 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8005c9:	83 ec 08             	sub    $0x8,%esp
+  8005cc:	53                   	push   %ebx
+  8005cd:	6a 30                	push   $0x30
+  8005cf:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8005d1:	83 c4 08             	add    $0x8,%esp
+  8005d4:	53                   	push   %ebx
+  8005d5:	6a 78                	push   $0x78
+  8005d7:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8005d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005dc:	8b 10                	mov    (%eax),%edx
+  8005de:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8005e3:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8005e6:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8005ec:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8005f1:	83 ec 0c             	sub    $0xc,%esp
+  8005f4:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8005f8:	50                   	push   %eax
+  8005f9:	ff 75 e0             	push   -0x20(%ebp)
+  8005fc:	57                   	push   %edi
+  8005fd:	51                   	push   %ecx
+  8005fe:	52                   	push   %edx
+  8005ff:	89 da                	mov    %ebx,%edx
+  800601:	89 f0                	mov    %esi,%eax
+  800603:	e8 4a fb ff ff       	call   800152 <printnum>
+			break;
+  800608:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80060b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80060e:	e9 40 fc ff ff       	jmp    800253 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800613:	83 f9 01             	cmp    $0x1,%ecx
+  800616:	7f 1b                	jg     800633 <vprintfmt+0x3fe>
+	else if (lflag)
+  800618:	85 c9                	test   %ecx,%ecx
+  80061a:	74 2c                	je     800648 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  80061c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061f:	8b 10                	mov    (%eax),%edx
+  800621:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800626:	8d 40 04             	lea    0x4(%eax),%eax
+  800629:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80062c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800631:	eb be                	jmp    8005f1 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800633:	8b 45 14             	mov    0x14(%ebp),%eax
+  800636:	8b 10                	mov    (%eax),%edx
+  800638:	8b 48 04             	mov    0x4(%eax),%ecx
+  80063b:	8d 40 08             	lea    0x8(%eax),%eax
+  80063e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800641:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800646:	eb a9                	jmp    8005f1 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800648:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064b:	8b 10                	mov    (%eax),%edx
+  80064d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800652:	8d 40 04             	lea    0x4(%eax),%eax
+  800655:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800658:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80065d:	eb 92                	jmp    8005f1 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  80065f:	83 ec 08             	sub    $0x8,%esp
+  800662:	53                   	push   %ebx
+  800663:	6a 25                	push   $0x25
+  800665:	ff d6                	call   *%esi
+			break;
+  800667:	83 c4 10             	add    $0x10,%esp
+  80066a:	eb 9f                	jmp    80060b <vprintfmt+0x3d6>
+			putch('%', putdat);
+  80066c:	83 ec 08             	sub    $0x8,%esp
+  80066f:	53                   	push   %ebx
+  800670:	6a 25                	push   $0x25
+  800672:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800674:	83 c4 10             	add    $0x10,%esp
+  800677:	89 f8                	mov    %edi,%eax
+  800679:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80067d:	74 05                	je     800684 <vprintfmt+0x44f>
+  80067f:	83 e8 01             	sub    $0x1,%eax
+  800682:	eb f5                	jmp    800679 <vprintfmt+0x444>
+  800684:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800687:	eb 82                	jmp    80060b <vprintfmt+0x3d6>
+
+00800689 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800689:	55                   	push   %ebp
+  80068a:	89 e5                	mov    %esp,%ebp
+  80068c:	83 ec 18             	sub    $0x18,%esp
+  80068f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800692:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800695:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800698:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80069c:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80069f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006a6:	85 c0                	test   %eax,%eax
+  8006a8:	74 26                	je     8006d0 <vsnprintf+0x47>
+  8006aa:	85 d2                	test   %edx,%edx
+  8006ac:	7e 22                	jle    8006d0 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006ae:	ff 75 14             	push   0x14(%ebp)
+  8006b1:	ff 75 10             	push   0x10(%ebp)
+  8006b4:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006b7:	50                   	push   %eax
+  8006b8:	68 fb 01 80 00       	push   $0x8001fb
+  8006bd:	e8 73 fb ff ff       	call   800235 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8006c2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8006c5:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8006c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8006cb:	83 c4 10             	add    $0x10,%esp
+}
+  8006ce:	c9                   	leave
+  8006cf:	c3                   	ret
+		return -E_INVAL;
+  8006d0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006d5:	eb f7                	jmp    8006ce <vsnprintf+0x45>
+
+008006d7 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8006d7:	55                   	push   %ebp
+  8006d8:	89 e5                	mov    %esp,%ebp
+  8006da:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8006dd:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8006e0:	50                   	push   %eax
+  8006e1:	ff 75 10             	push   0x10(%ebp)
+  8006e4:	ff 75 0c             	push   0xc(%ebp)
+  8006e7:	ff 75 08             	push   0x8(%ebp)
+  8006ea:	e8 9a ff ff ff       	call   800689 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8006ef:	c9                   	leave
+  8006f0:	c3                   	ret
+
+008006f1 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8006f1:	55                   	push   %ebp
+  8006f2:	89 e5                	mov    %esp,%ebp
+  8006f4:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8006f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006fc:	eb 03                	jmp    800701 <strlen+0x10>
+		n++;
+  8006fe:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800701:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800705:	75 f7                	jne    8006fe <strlen+0xd>
+	return n;
+}
+  800707:	5d                   	pop    %ebp
+  800708:	c3                   	ret
+
+00800709 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800709:	55                   	push   %ebp
+  80070a:	89 e5                	mov    %esp,%ebp
+  80070c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80070f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800712:	b8 00 00 00 00       	mov    $0x0,%eax
+  800717:	eb 03                	jmp    80071c <strnlen+0x13>
+		n++;
+  800719:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80071c:	39 d0                	cmp    %edx,%eax
+  80071e:	74 08                	je     800728 <strnlen+0x1f>
+  800720:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800724:	75 f3                	jne    800719 <strnlen+0x10>
+  800726:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800728:	89 d0                	mov    %edx,%eax
+  80072a:	5d                   	pop    %ebp
+  80072b:	c3                   	ret
+
+0080072c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80072c:	55                   	push   %ebp
+  80072d:	89 e5                	mov    %esp,%ebp
+  80072f:	53                   	push   %ebx
+  800730:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800733:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800736:	b8 00 00 00 00       	mov    $0x0,%eax
+  80073b:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80073f:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800742:	83 c0 01             	add    $0x1,%eax
+  800745:	84 d2                	test   %dl,%dl
+  800747:	75 f2                	jne    80073b <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800749:	89 c8                	mov    %ecx,%eax
+  80074b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80074e:	c9                   	leave
+  80074f:	c3                   	ret
+
+00800750 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800750:	55                   	push   %ebp
+  800751:	89 e5                	mov    %esp,%ebp
+  800753:	53                   	push   %ebx
+  800754:	83 ec 10             	sub    $0x10,%esp
+  800757:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80075a:	53                   	push   %ebx
+  80075b:	e8 91 ff ff ff       	call   8006f1 <strlen>
+  800760:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800763:	ff 75 0c             	push   0xc(%ebp)
+  800766:	01 d8                	add    %ebx,%eax
+  800768:	50                   	push   %eax
+  800769:	e8 be ff ff ff       	call   80072c <strcpy>
+	return dst;
+}
+  80076e:	89 d8                	mov    %ebx,%eax
+  800770:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800773:	c9                   	leave
+  800774:	c3                   	ret
+
+00800775 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800775:	55                   	push   %ebp
+  800776:	89 e5                	mov    %esp,%ebp
+  800778:	56                   	push   %esi
+  800779:	53                   	push   %ebx
+  80077a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80077d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800780:	89 f3                	mov    %esi,%ebx
+  800782:	03 5d 10             	add    0x10(%ebp),%ebx
+  800785:	89 f0                	mov    %esi,%eax
+  800787:	eb 0f                	jmp    800798 <strncpy+0x23>
+		*dst++ = *src;
+  800789:	83 c0 01             	add    $0x1,%eax
+  80078c:	0f b6 0a             	movzbl (%edx),%ecx
+  80078f:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800792:	80 f9 01             	cmp    $0x1,%cl
+  800795:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800798:	39 d8                	cmp    %ebx,%eax
+  80079a:	75 ed                	jne    800789 <strncpy+0x14>
+	}
+	return ret;
+}
+  80079c:	89 f0                	mov    %esi,%eax
+  80079e:	5b                   	pop    %ebx
+  80079f:	5e                   	pop    %esi
+  8007a0:	5d                   	pop    %ebp
+  8007a1:	c3                   	ret
+
+008007a2 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007a2:	55                   	push   %ebp
+  8007a3:	89 e5                	mov    %esp,%ebp
+  8007a5:	56                   	push   %esi
+  8007a6:	53                   	push   %ebx
+  8007a7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007ad:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8007b0:	89 f0                	mov    %esi,%eax
+  8007b2:	85 d2                	test   %edx,%edx
+  8007b4:	74 21                	je     8007d7 <strlcpy+0x35>
+  8007b6:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8007ba:	89 f2                	mov    %esi,%edx
+  8007bc:	eb 09                	jmp    8007c7 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8007be:	83 c1 01             	add    $0x1,%ecx
+  8007c1:	83 c2 01             	add    $0x1,%edx
+  8007c4:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8007c7:	39 c2                	cmp    %eax,%edx
+  8007c9:	74 09                	je     8007d4 <strlcpy+0x32>
+  8007cb:	0f b6 19             	movzbl (%ecx),%ebx
+  8007ce:	84 db                	test   %bl,%bl
+  8007d0:	75 ec                	jne    8007be <strlcpy+0x1c>
+  8007d2:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8007d4:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8007d7:	29 f0                	sub    %esi,%eax
+}
+  8007d9:	5b                   	pop    %ebx
+  8007da:	5e                   	pop    %esi
+  8007db:	5d                   	pop    %ebp
+  8007dc:	c3                   	ret
+
+008007dd <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8007dd:	55                   	push   %ebp
+  8007de:	89 e5                	mov    %esp,%ebp
+  8007e0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007e3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8007e6:	eb 06                	jmp    8007ee <strcmp+0x11>
+		p++, q++;
+  8007e8:	83 c1 01             	add    $0x1,%ecx
+  8007eb:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8007ee:	0f b6 01             	movzbl (%ecx),%eax
+  8007f1:	84 c0                	test   %al,%al
+  8007f3:	74 04                	je     8007f9 <strcmp+0x1c>
+  8007f5:	3a 02                	cmp    (%edx),%al
+  8007f7:	74 ef                	je     8007e8 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8007f9:	0f b6 c0             	movzbl %al,%eax
+  8007fc:	0f b6 12             	movzbl (%edx),%edx
+  8007ff:	29 d0                	sub    %edx,%eax
+}
+  800801:	5d                   	pop    %ebp
+  800802:	c3                   	ret
+
+00800803 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800803:	55                   	push   %ebp
+  800804:	89 e5                	mov    %esp,%ebp
+  800806:	53                   	push   %ebx
+  800807:	8b 45 08             	mov    0x8(%ebp),%eax
+  80080a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80080d:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800810:	eb 09                	jmp    80081b <strncmp+0x18>
+		n--, p++, q++;
+  800812:	83 ea 01             	sub    $0x1,%edx
+  800815:	83 c0 01             	add    $0x1,%eax
+  800818:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80081b:	85 d2                	test   %edx,%edx
+  80081d:	74 18                	je     800837 <strncmp+0x34>
+  80081f:	0f b6 18             	movzbl (%eax),%ebx
+  800822:	84 db                	test   %bl,%bl
+  800824:	74 04                	je     80082a <strncmp+0x27>
+  800826:	3a 19                	cmp    (%ecx),%bl
+  800828:	74 e8                	je     800812 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80082a:	0f b6 00             	movzbl (%eax),%eax
+  80082d:	0f b6 11             	movzbl (%ecx),%edx
+  800830:	29 d0                	sub    %edx,%eax
+}
+  800832:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800835:	c9                   	leave
+  800836:	c3                   	ret
+		return 0;
+  800837:	b8 00 00 00 00       	mov    $0x0,%eax
+  80083c:	eb f4                	jmp    800832 <strncmp+0x2f>
+
+0080083e <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80083e:	55                   	push   %ebp
+  80083f:	89 e5                	mov    %esp,%ebp
+  800841:	8b 45 08             	mov    0x8(%ebp),%eax
+  800844:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800848:	eb 03                	jmp    80084d <strchr+0xf>
+  80084a:	83 c0 01             	add    $0x1,%eax
+  80084d:	0f b6 10             	movzbl (%eax),%edx
+  800850:	84 d2                	test   %dl,%dl
+  800852:	74 06                	je     80085a <strchr+0x1c>
+		if (*s == c)
+  800854:	38 ca                	cmp    %cl,%dl
+  800856:	75 f2                	jne    80084a <strchr+0xc>
+  800858:	eb 05                	jmp    80085f <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80085a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80085f:	5d                   	pop    %ebp
+  800860:	c3                   	ret
+
+00800861 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800861:	55                   	push   %ebp
+  800862:	89 e5                	mov    %esp,%ebp
+  800864:	8b 45 08             	mov    0x8(%ebp),%eax
+  800867:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80086b:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80086e:	38 ca                	cmp    %cl,%dl
+  800870:	74 09                	je     80087b <strfind+0x1a>
+  800872:	84 d2                	test   %dl,%dl
+  800874:	74 05                	je     80087b <strfind+0x1a>
+	for (; *s; s++)
+  800876:	83 c0 01             	add    $0x1,%eax
+  800879:	eb f0                	jmp    80086b <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80087b:	5d                   	pop    %ebp
+  80087c:	c3                   	ret
+
+0080087d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80087d:	55                   	push   %ebp
+  80087e:	89 e5                	mov    %esp,%ebp
+  800880:	57                   	push   %edi
+  800881:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800884:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800887:	85 c9                	test   %ecx,%ecx
+  800889:	74 20                	je     8008ab <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80088b:	89 f8                	mov    %edi,%eax
+  80088d:	09 c8                	or     %ecx,%eax
+  80088f:	a8 03                	test   $0x3,%al
+  800891:	75 12                	jne    8008a5 <memset+0x28>
+		c &= 0xFF;
+  800893:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800897:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80089d:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008a0:	fc                   	cld
+  8008a1:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008a3:	eb 06                	jmp    8008ab <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008a8:	fc                   	cld
+  8008a9:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008ab:	89 f8                	mov    %edi,%eax
+  8008ad:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008b0:	c9                   	leave
+  8008b1:	c3                   	ret
+
+008008b2 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008b2:	55                   	push   %ebp
+  8008b3:	89 e5                	mov    %esp,%ebp
+  8008b5:	57                   	push   %edi
+  8008b6:	56                   	push   %esi
+  8008b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008ba:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008bd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8008c0:	39 c6                	cmp    %eax,%esi
+  8008c2:	73 32                	jae    8008f6 <memmove+0x44>
+  8008c4:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8008c7:	39 d0                	cmp    %edx,%eax
+  8008c9:	73 2b                	jae    8008f6 <memmove+0x44>
+		s += n;
+		d += n;
+  8008cb:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008ce:	89 d6                	mov    %edx,%esi
+  8008d0:	09 fe                	or     %edi,%esi
+  8008d2:	09 ce                	or     %ecx,%esi
+  8008d4:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8008da:	75 0e                	jne    8008ea <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8008dc:	83 ef 04             	sub    $0x4,%edi
+  8008df:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8008e2:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8008e5:	fd                   	std
+  8008e6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8008e8:	eb 09                	jmp    8008f3 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8008ea:	83 ef 01             	sub    $0x1,%edi
+  8008ed:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8008f0:	fd                   	std
+  8008f1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8008f3:	fc                   	cld
+  8008f4:	eb 1a                	jmp    800910 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008f6:	89 f2                	mov    %esi,%edx
+  8008f8:	09 c2                	or     %eax,%edx
+  8008fa:	09 ca                	or     %ecx,%edx
+  8008fc:	f6 c2 03             	test   $0x3,%dl
+  8008ff:	75 0a                	jne    80090b <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800901:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800904:	89 c7                	mov    %eax,%edi
+  800906:	fc                   	cld
+  800907:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800909:	eb 05                	jmp    800910 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80090b:	89 c7                	mov    %eax,%edi
+  80090d:	fc                   	cld
+  80090e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800910:	5e                   	pop    %esi
+  800911:	5f                   	pop    %edi
+  800912:	5d                   	pop    %ebp
+  800913:	c3                   	ret
+
+00800914 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800914:	55                   	push   %ebp
+  800915:	89 e5                	mov    %esp,%ebp
+  800917:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80091a:	ff 75 10             	push   0x10(%ebp)
+  80091d:	ff 75 0c             	push   0xc(%ebp)
+  800920:	ff 75 08             	push   0x8(%ebp)
+  800923:	e8 8a ff ff ff       	call   8008b2 <memmove>
+}
+  800928:	c9                   	leave
+  800929:	c3                   	ret
+
+0080092a <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80092a:	55                   	push   %ebp
+  80092b:	89 e5                	mov    %esp,%ebp
+  80092d:	56                   	push   %esi
+  80092e:	53                   	push   %ebx
+  80092f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800932:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800935:	89 c6                	mov    %eax,%esi
+  800937:	03 75 10             	add    0x10(%ebp),%esi
+  80093a:	eb 06                	jmp    800942 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  80093c:	83 c0 01             	add    $0x1,%eax
+  80093f:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800942:	39 f0                	cmp    %esi,%eax
+  800944:	74 14                	je     80095a <memcmp+0x30>
+		if (*s1 != *s2)
+  800946:	0f b6 08             	movzbl (%eax),%ecx
+  800949:	0f b6 1a             	movzbl (%edx),%ebx
+  80094c:	38 d9                	cmp    %bl,%cl
+  80094e:	74 ec                	je     80093c <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800950:	0f b6 c1             	movzbl %cl,%eax
+  800953:	0f b6 db             	movzbl %bl,%ebx
+  800956:	29 d8                	sub    %ebx,%eax
+  800958:	eb 05                	jmp    80095f <memcmp+0x35>
+	}
+
+	return 0;
+  80095a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80095f:	5b                   	pop    %ebx
+  800960:	5e                   	pop    %esi
+  800961:	5d                   	pop    %ebp
+  800962:	c3                   	ret
+
+00800963 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800963:	55                   	push   %ebp
+  800964:	89 e5                	mov    %esp,%ebp
+  800966:	8b 45 08             	mov    0x8(%ebp),%eax
+  800969:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80096c:	89 c2                	mov    %eax,%edx
+  80096e:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800971:	eb 03                	jmp    800976 <memfind+0x13>
+  800973:	83 c0 01             	add    $0x1,%eax
+  800976:	39 d0                	cmp    %edx,%eax
+  800978:	73 04                	jae    80097e <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80097a:	38 08                	cmp    %cl,(%eax)
+  80097c:	75 f5                	jne    800973 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  80097e:	5d                   	pop    %ebp
+  80097f:	c3                   	ret
+
+00800980 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800980:	55                   	push   %ebp
+  800981:	89 e5                	mov    %esp,%ebp
+  800983:	57                   	push   %edi
+  800984:	56                   	push   %esi
+  800985:	53                   	push   %ebx
+  800986:	8b 55 08             	mov    0x8(%ebp),%edx
+  800989:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80098c:	eb 03                	jmp    800991 <strtol+0x11>
+		s++;
+  80098e:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800991:	0f b6 02             	movzbl (%edx),%eax
+  800994:	3c 20                	cmp    $0x20,%al
+  800996:	74 f6                	je     80098e <strtol+0xe>
+  800998:	3c 09                	cmp    $0x9,%al
+  80099a:	74 f2                	je     80098e <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  80099c:	3c 2b                	cmp    $0x2b,%al
+  80099e:	74 2a                	je     8009ca <strtol+0x4a>
+	int neg = 0;
+  8009a0:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009a5:	3c 2d                	cmp    $0x2d,%al
+  8009a7:	74 2b                	je     8009d4 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009a9:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009af:	75 0f                	jne    8009c0 <strtol+0x40>
+  8009b1:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009b4:	74 28                	je     8009de <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8009b6:	85 db                	test   %ebx,%ebx
+  8009b8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009bd:	0f 44 d8             	cmove  %eax,%ebx
+  8009c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009c5:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8009c8:	eb 46                	jmp    800a10 <strtol+0x90>
+		s++;
+  8009ca:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8009cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009d2:	eb d5                	jmp    8009a9 <strtol+0x29>
+		s++, neg = 1;
+  8009d4:	83 c2 01             	add    $0x1,%edx
+  8009d7:	bf 01 00 00 00       	mov    $0x1,%edi
+  8009dc:	eb cb                	jmp    8009a9 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009de:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8009e2:	74 0e                	je     8009f2 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8009e4:	85 db                	test   %ebx,%ebx
+  8009e6:	75 d8                	jne    8009c0 <strtol+0x40>
+		s++, base = 8;
+  8009e8:	83 c2 01             	add    $0x1,%edx
+  8009eb:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8009f0:	eb ce                	jmp    8009c0 <strtol+0x40>
+		s += 2, base = 16;
+  8009f2:	83 c2 02             	add    $0x2,%edx
+  8009f5:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8009fa:	eb c4                	jmp    8009c0 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8009fc:	0f be c0             	movsbl %al,%eax
+  8009ff:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a02:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a05:	7d 3a                	jge    800a41 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a07:	83 c2 01             	add    $0x1,%edx
+  800a0a:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a0e:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a10:	0f b6 02             	movzbl (%edx),%eax
+  800a13:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a16:	89 f3                	mov    %esi,%ebx
+  800a18:	80 fb 09             	cmp    $0x9,%bl
+  800a1b:	76 df                	jbe    8009fc <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a1d:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a20:	89 f3                	mov    %esi,%ebx
+  800a22:	80 fb 19             	cmp    $0x19,%bl
+  800a25:	77 08                	ja     800a2f <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a27:	0f be c0             	movsbl %al,%eax
+  800a2a:	83 e8 57             	sub    $0x57,%eax
+  800a2d:	eb d3                	jmp    800a02 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a2f:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a32:	89 f3                	mov    %esi,%ebx
+  800a34:	80 fb 19             	cmp    $0x19,%bl
+  800a37:	77 08                	ja     800a41 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a39:	0f be c0             	movsbl %al,%eax
+  800a3c:	83 e8 37             	sub    $0x37,%eax
+  800a3f:	eb c1                	jmp    800a02 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a41:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a45:	74 05                	je     800a4c <strtol+0xcc>
+		*endptr = (char *) s;
+  800a47:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a4a:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a4c:	89 c8                	mov    %ecx,%eax
+  800a4e:	f7 d8                	neg    %eax
+  800a50:	85 ff                	test   %edi,%edi
+  800a52:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a55:	89 c8                	mov    %ecx,%eax
+  800a57:	5b                   	pop    %ebx
+  800a58:	5e                   	pop    %esi
+  800a59:	5f                   	pop    %edi
+  800a5a:	5d                   	pop    %ebp
+  800a5b:	c3                   	ret
+
+00800a5c <atoi>:
+
+int
+atoi(const char *s)
+{
+  800a5c:	55                   	push   %ebp
+  800a5d:	89 e5                	mov    %esp,%ebp
+  800a5f:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800a62:	6a 0a                	push   $0xa
+  800a64:	6a 00                	push   $0x0
+  800a66:	ff 75 08             	push   0x8(%ebp)
+  800a69:	e8 12 ff ff ff       	call   800980 <strtol>
+}
+  800a6e:	c9                   	leave
+  800a6f:	c3                   	ret
+
+00800a70 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800a70:	55                   	push   %ebp
+  800a71:	89 e5                	mov    %esp,%ebp
+  800a73:	57                   	push   %edi
+  800a74:	56                   	push   %esi
+  800a75:	53                   	push   %ebx
+  800a76:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800a7c:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800a82:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800a88:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800a8e:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800a95:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800a98:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800a9f:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800aa2:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800aa9:	74 76                	je     800b21 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800aab:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800ab1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ab4:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800aba:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ac1:	0f 88 06 01 00 00    	js     800bcd <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800ac7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ace:	0f 84 48 01 00 00    	je     800c1c <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800ad4:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800ada:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800ae0:	be 00 00 00 00       	mov    $0x0,%esi
+  800ae5:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800aeb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800aee:	55                   	push   %ebp
+  800aef:	68 f8 0a 80 00       	push   $0x800af8
+  800af4:	89 e5                	mov    %esp,%ebp
+  800af6:	0f 34                	sysenter
+  800af8:	83 c4 04             	add    $0x4,%esp
+  800afb:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800afc:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800b02:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800b08:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800b0b:	0f 85 9a 01 00 00    	jne    800cab <page_vec_call+0x23b>
+  800b11:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b16:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b19:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b1c:	e9 29 01 00 00       	jmp    800c4a <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800b21:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800b27:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b2a:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800b2c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b33:	78 2f                	js     800b64 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800b35:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b3c:	74 72                	je     800bb0 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800b3e:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800b44:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800b4a:	b8 10 00 00 00       	mov    $0x10,%eax
+  800b4f:	89 fb                	mov    %edi,%ebx
+  800b51:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800b54:	55                   	push   %ebp
+  800b55:	68 5e 0b 80 00       	push   $0x800b5e
+  800b5a:	89 e5                	mov    %esp,%ebp
+  800b5c:	0f 34                	sysenter
+  800b5e:	83 c4 04             	add    $0x4,%esp
+  800b61:	5d                   	pop    %ebp
+	return ret;
+  800b62:	eb 98                	jmp    800afc <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800b64:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b69:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800b6b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800b70:	f6 c6 08             	test   $0x8,%dh
+  800b73:	74 15                	je     800b8a <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800b75:	89 c2                	mov    %eax,%edx
+  800b77:	c1 ea 08             	shr    $0x8,%edx
+  800b7a:	83 e2 0f             	and    $0xf,%edx
+  800b7d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800b82:	83 fa 06             	cmp    $0x6,%edx
+  800b85:	74 0e                	je     800b95 <page_vec_call+0x125>
+  800b87:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800b8a:	0f b6 c9             	movzbl %cl,%ecx
+  800b8d:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800b93:	eb a0                	jmp    800b35 <page_vec_call+0xc5>
+  800b95:	89 c2                	mov    %eax,%edx
+  800b97:	c1 ea 04             	shr    $0x4,%edx
+  800b9a:	83 e2 0f             	and    $0xf,%edx
+  800b9d:	83 fa 02             	cmp    $0x2,%edx
+  800ba0:	77 e5                	ja     800b87 <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800ba2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ba5:	83 f8 02             	cmp    $0x2,%eax
+  800ba8:	0f 97 c1             	seta   %cl
+  800bab:	0f b6 c9             	movzbl %cl,%ecx
+  800bae:	eb d7                	jmp    800b87 <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800bb0:	b8 10 00 00 00       	mov    $0x10,%eax
+  800bb5:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800bbb:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800bc1:	89 fb                	mov    %edi,%ebx
+  800bc3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800bc6:	cd 30                	int    $0x30
+  800bc8:	e9 2f ff ff ff       	jmp    800afc <page_vec_call+0x8c>
+  800bcd:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bd2:	0f a2                	cpuid
+		return 0;
+  800bd4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800bd9:	f6 c6 08             	test   $0x8,%dh
+  800bdc:	74 15                	je     800bf3 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800bde:	89 c2                	mov    %eax,%edx
+  800be0:	c1 ea 08             	shr    $0x8,%edx
+  800be3:	83 e2 0f             	and    $0xf,%edx
+  800be6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800beb:	83 fa 06             	cmp    $0x6,%edx
+  800bee:	74 11                	je     800c01 <page_vec_call+0x191>
+  800bf0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800bf3:	0f b6 c9             	movzbl %cl,%ecx
+  800bf6:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800bfc:	e9 c6 fe ff ff       	jmp    800ac7 <page_vec_call+0x57>
+  800c01:	89 c2                	mov    %eax,%edx
+  800c03:	c1 ea 04             	shr    $0x4,%edx
+  800c06:	83 e2 0f             	and    $0xf,%edx
+  800c09:	83 fa 02             	cmp    $0x2,%edx
+  800c0c:	77 e2                	ja     800bf0 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800c0e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c11:	83 f8 02             	cmp    $0x2,%eax
+  800c14:	0f 97 c1             	seta   %cl
+  800c17:	0f b6 c9             	movzbl %cl,%ecx
+  800c1a:	eb d4                	jmp    800bf0 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800c1c:	be 00 00 00 00       	mov    $0x0,%esi
+  800c21:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800c27:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800c2d:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800c33:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c36:	cd 30                	int    $0x30
+  800c38:	e9 bf fe ff ff       	jmp    800afc <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800c3d:	29 da                	sub    %ebx,%edx
+			vec++;
+  800c3f:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800c42:	83 e8 01             	sub    $0x1,%eax
+  800c45:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800c4a:	85 c0                	test   %eax,%eax
+  800c4c:	74 58                	je     800ca6 <page_vec_call+0x236>
+  800c4e:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800c51:	39 da                	cmp    %ebx,%edx
+  800c53:	73 e8                	jae    800c3d <page_vec_call+0x1cd>
+  800c55:	89 75 08             	mov    %esi,0x8(%ebp)
+  800c58:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800c5b:	84 c9                	test   %cl,%cl
+  800c5d:	74 06                	je     800c65 <page_vec_call+0x1f5>
+  800c5f:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800c65:	83 ec 04             	sub    $0x4,%esp
+  800c68:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c6b:	c1 e0 04             	shl    $0x4,%eax
+  800c6e:	50                   	push   %eax
+  800c6f:	ff 75 08             	push   0x8(%ebp)
+  800c72:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800c78:	53                   	push   %ebx
+  800c79:	e8 34 fc ff ff       	call   8008b2 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800c7e:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800c84:	89 c2                	mov    %eax,%edx
+  800c86:	c1 e2 0c             	shl    $0xc,%edx
+  800c89:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  800c8f:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  800c95:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  800c9b:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  800c9e:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  800ca1:	e9 f2 fd ff ff       	jmp    800a98 <page_vec_call+0x28>
+			r = 0;
+  800ca6:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  800cab:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800caf:	74 0b                	je     800cbc <page_vec_call+0x24c>
+		*done = total;
+  800cb1:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800cb4:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  800cba:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  800cbc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cbf:	5b                   	pop    %ebx
+  800cc0:	5e                   	pop    %esi
+  800cc1:	5f                   	pop    %edi
+  800cc2:	5d                   	pop    %ebp
+  800cc3:	c3                   	ret
+
+00800cc4 <sys_cputs>:
+{
+  800cc4:	55                   	push   %ebp
+  800cc5:	89 e5                	mov    %esp,%ebp
+  800cc7:	57                   	push   %edi
+  800cc8:	56                   	push   %esi
+  800cc9:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800cca:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800cd1:	78 2d                	js     800d00 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800cd3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800cda:	74 70                	je     800d4c <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800cdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce7:	89 c3                	mov    %eax,%ebx
+  800ce9:	89 c7                	mov    %eax,%edi
+  800ceb:	89 c6                	mov    %eax,%esi
+  800ced:	55                   	push   %ebp
+  800cee:	68 f7 0c 80 00       	push   $0x800cf7
+  800cf3:	89 e5                	mov    %esp,%ebp
+  800cf5:	0f 34                	sysenter
+  800cf7:	83 c4 04             	add    $0x4,%esp
+  800cfa:	5d                   	pop    %ebp
+}
+  800cfb:	5b                   	pop    %ebx
+  800cfc:	5e                   	pop    %esi
+  800cfd:	5f                   	pop    %edi
+  800cfe:	5d                   	pop    %ebp
+  800cff:	c3                   	ret
+  800d00:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d05:	0f a2                	cpuid
+		return 0;
+  800d07:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800d0c:	f6 c6 08             	test   $0x8,%dh
+  800d0f:	74 15                	je     800d26 <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d11:	89 c2                	mov    %eax,%edx
+  800d13:	c1 ea 08             	shr    $0x8,%edx
+  800d16:	83 e2 0f             	and    $0xf,%edx
+  800d19:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d1e:	83 fa 06             	cmp    $0x6,%edx
+  800d21:	74 0e                	je     800d31 <sys_cputs+0x6d>
+  800d23:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800d26:	0f b6 c9             	movzbl %cl,%ecx
+  800d29:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800d2f:	eb a2                	jmp    800cd3 <sys_cputs+0xf>
+  800d31:	89 c2                	mov    %eax,%edx
+  800d33:	c1 ea 04             	shr    $0x4,%edx
+  800d36:	83 e2 0f             	and    $0xf,%edx
+  800d39:	83 fa 02             	cmp    $0x2,%edx
+  800d3c:	77 e5                	ja     800d23 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800d3e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d41:	83 f8 02             	cmp    $0x2,%eax
+  800d44:	0f 97 c1             	seta   %cl
+  800d47:	0f b6 c9             	movzbl %cl,%ecx
+  800d4a:	eb d7                	jmp    800d23 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800d4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d51:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d54:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d57:	89 c3                	mov    %eax,%ebx
+  800d59:	89 c7                	mov    %eax,%edi
+  800d5b:	89 c6                	mov    %eax,%esi
+  800d5d:	cd 30                	int    $0x30
+}
+  800d5f:	eb 9a                	jmp    800cfb <sys_cputs+0x37>
+
+00800d61 <sys_cgetc>:
+{
+  800d61:	55                   	push   %ebp
+  800d62:	89 e5                	mov    %esp,%ebp
+  800d64:	57                   	push   %edi
+  800d65:	56                   	push   %esi
+  800d66:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800d67:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d6e:	78 2e                	js     800d9e <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  800d70:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d77:	74 71                	je     800dea <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  800d79:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d7e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d83:	89 d1                	mov    %edx,%ecx
+  800d85:	89 d3                	mov    %edx,%ebx
+  800d87:	89 d7                	mov    %edx,%edi
+  800d89:	89 d6                	mov    %edx,%esi
+  800d8b:	55                   	push   %ebp
+  800d8c:	68 95 0d 80 00       	push   $0x800d95
+  800d91:	89 e5                	mov    %esp,%ebp
+  800d93:	0f 34                	sysenter
+  800d95:	83 c4 04             	add    $0x4,%esp
+  800d98:	5d                   	pop    %ebp
+}
+  800d99:	5b                   	pop    %ebx
+  800d9a:	5e                   	pop    %esi
+  800d9b:	5f                   	pop    %edi
+  800d9c:	5d                   	pop    %ebp
+  800d9d:	c3                   	ret
+  800d9e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800da3:	0f a2                	cpuid
+		return 0;
+  800da5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800daa:	f6 c6 08             	test   $0x8,%dh
+  800dad:	74 15                	je     800dc4 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800daf:	89 c2                	mov    %eax,%edx
+  800db1:	c1 ea 08             	shr    $0x8,%edx
+  800db4:	83 e2 0f             	and    $0xf,%edx
+  800db7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800dbc:	83 fa 06             	cmp    $0x6,%edx
+  800dbf:	74 0e                	je     800dcf <sys_cgetc+0x6e>
+  800dc1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800dc4:	0f b6 c9             	movzbl %cl,%ecx
+  800dc7:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800dcd:	eb a1                	jmp    800d70 <sys_cgetc+0xf>
+  800dcf:	89 c2                	mov    %eax,%edx
+  800dd1:	c1 ea 04             	shr    $0x4,%edx
+  800dd4:	83 e2 0f             	and    $0xf,%edx
+  800dd7:	83 fa 02             	cmp    $0x2,%edx
+  800dda:	77 e5                	ja     800dc1 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  800ddc:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ddf:	83 f8 02             	cmp    $0x2,%eax
+  800de2:	0f 97 c1             	seta   %cl
+  800de5:	0f b6 c9             	movzbl %cl,%ecx
+  800de8:	eb d7                	jmp    800dc1 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  800dea:	ba 00 00 00 00       	mov    $0x0,%edx
+  800def:	b8 01 00 00 00       	mov    $0x1,%eax
+  800df4:	89 d1                	mov    %edx,%ecx
+  800df6:	89 d3                	mov    %edx,%ebx
+  800df8:	89 d7                	mov    %edx,%edi
+  800dfa:	89 d6                	mov    %edx,%esi
+  800dfc:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800dfe:	eb 99                	jmp    800d99 <sys_cgetc+0x38>
+
+00800e00 <sys_env_destroy>:
+{
+  800e00:	55                   	push   %ebp
+  800e01:	89 e5                	mov    %esp,%ebp
+  800e03:	57                   	push   %edi
+  800e04:	56                   	push   %esi
+  800e05:	53                   	push   %ebx
+  800e06:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800e09:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e10:	78 36                	js     800e48 <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  800e12:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e19:	74 79                	je     800e94 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  800e1b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e1e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e23:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e28:	89 cb                	mov    %ecx,%ebx
+  800e2a:	89 cf                	mov    %ecx,%edi
+  800e2c:	89 ce                	mov    %ecx,%esi
+  800e2e:	55                   	push   %ebp
+  800e2f:	68 38 0e 80 00       	push   $0x800e38
+  800e34:	89 e5                	mov    %esp,%ebp
+  800e36:	0f 34                	sysenter
+  800e38:	83 c4 04             	add    $0x4,%esp
+  800e3b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e3c:	85 c0                	test   %eax,%eax
+  800e3e:	7f 6b                	jg     800eab <sys_env_destroy+0xab>
+}
+  800e40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e43:	5b                   	pop    %ebx
+  800e44:	5e                   	pop    %esi
+  800e45:	5f                   	pop    %edi
+  800e46:	5d                   	pop    %ebp
+  800e47:	c3                   	ret
+  800e48:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e4d:	0f a2                	cpuid
+		return 0;
+  800e4f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800e54:	f6 c6 08             	test   $0x8,%dh
+  800e57:	74 15                	je     800e6e <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e59:	89 c2                	mov    %eax,%edx
+  800e5b:	c1 ea 08             	shr    $0x8,%edx
+  800e5e:	83 e2 0f             	and    $0xf,%edx
+  800e61:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e66:	83 fa 06             	cmp    $0x6,%edx
+  800e69:	74 0e                	je     800e79 <sys_env_destroy+0x79>
+  800e6b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e6e:	0f b6 c9             	movzbl %cl,%ecx
+  800e71:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800e77:	eb 99                	jmp    800e12 <sys_env_destroy+0x12>
+  800e79:	89 c2                	mov    %eax,%edx
+  800e7b:	c1 ea 04             	shr    $0x4,%edx
+  800e7e:	83 e2 0f             	and    $0xf,%edx
+  800e81:	83 fa 02             	cmp    $0x2,%edx
+  800e84:	77 e5                	ja     800e6b <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  800e86:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e89:	83 f8 02             	cmp    $0x2,%eax
+  800e8c:	0f 97 c1             	seta   %cl
+  800e8f:	0f b6 c9             	movzbl %cl,%ecx
+  800e92:	eb d7                	jmp    800e6b <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  800e94:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e99:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e9e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea1:	89 cb                	mov    %ecx,%ebx
+  800ea3:	89 cf                	mov    %ecx,%edi
+  800ea5:	89 ce                	mov    %ecx,%esi
+  800ea7:	cd 30                	int    $0x30
+  800ea9:	eb 91                	jmp    800e3c <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eab:	83 ec 0c             	sub    $0xc,%esp
+  800eae:	50                   	push   %eax
+  800eaf:	6a 03                	push   $0x3
+  800eb1:	68 79 2b 80 00       	push   $0x802b79
+  800eb6:	6a 4a                	push   $0x4a
+  800eb8:	68 96 2b 80 00       	push   $0x802b96
+  800ebd:	e8 1e 17 00 00       	call   8025e0 <_panic>
+
+00800ec2 <sys_getenvid>:
+{
+  800ec2:	55                   	push   %ebp
+  800ec3:	89 e5                	mov    %esp,%ebp
+  800ec5:	57                   	push   %edi
+  800ec6:	56                   	push   %esi
+  800ec7:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800ec8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ecf:	78 2e                	js     800eff <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  800ed1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ed8:	74 71                	je     800f4b <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  800eda:	ba 00 00 00 00       	mov    $0x0,%edx
+  800edf:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ee4:	89 d1                	mov    %edx,%ecx
+  800ee6:	89 d3                	mov    %edx,%ebx
+  800ee8:	89 d7                	mov    %edx,%edi
+  800eea:	89 d6                	mov    %edx,%esi
+  800eec:	55                   	push   %ebp
+  800eed:	68 f6 0e 80 00       	push   $0x800ef6
+  800ef2:	89 e5                	mov    %esp,%ebp
+  800ef4:	0f 34                	sysenter
+  800ef6:	83 c4 04             	add    $0x4,%esp
+  800ef9:	5d                   	pop    %ebp
+}
+  800efa:	5b                   	pop    %ebx
+  800efb:	5e                   	pop    %esi
+  800efc:	5f                   	pop    %edi
+  800efd:	5d                   	pop    %ebp
+  800efe:	c3                   	ret
+  800eff:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f04:	0f a2                	cpuid
+		return 0;
+  800f06:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f0b:	f6 c6 08             	test   $0x8,%dh
+  800f0e:	74 15                	je     800f25 <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f10:	89 c2                	mov    %eax,%edx
+  800f12:	c1 ea 08             	shr    $0x8,%edx
+  800f15:	83 e2 0f             	and    $0xf,%edx
+  800f18:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f1d:	83 fa 06             	cmp    $0x6,%edx
+  800f20:	74 0e                	je     800f30 <sys_getenvid+0x6e>
+  800f22:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f25:	0f b6 c9             	movzbl %cl,%ecx
+  800f28:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800f2e:	eb a1                	jmp    800ed1 <sys_getenvid+0xf>
+  800f30:	89 c2                	mov    %eax,%edx
+  800f32:	c1 ea 04             	shr    $0x4,%edx
+  800f35:	83 e2 0f             	and    $0xf,%edx
+  800f38:	83 fa 02             	cmp    $0x2,%edx
+  800f3b:	77 e5                	ja     800f22 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  800f3d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f40:	83 f8 02             	cmp    $0x2,%eax
+  800f43:	0f 97 c1             	seta   %cl
+  800f46:	0f b6 c9             	movzbl %cl,%ecx
+  800f49:	eb d7                	jmp    800f22 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  800f4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f50:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f55:	89 d1                	mov    %edx,%ecx
+  800f57:	89 d3                	mov    %edx,%ebx
+  800f59:	89 d7                	mov    %edx,%edi
+  800f5b:	89 d6                	mov    %edx,%esi
+  800f5d:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  800f5f:	eb 99                	jmp    800efa <sys_getenvid+0x38>
+
+00800f61 <sys_page_alloc>:
+{
+  800f61:	55                   	push   %ebp
+  800f62:	89 e5                	mov    %esp,%ebp
+  800f64:	57                   	push   %edi
+  800f65:	56                   	push   %esi
+  800f66:	53                   	push   %ebx
+  800f67:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800f6a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f71:	78 38                	js     800fab <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  800f73:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f7a:	74 7b                	je     800ff7 <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  800f7c:	be 00 00 00 00       	mov    $0x0,%esi
+  800f81:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f84:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f87:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f8c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f8f:	89 f7                	mov    %esi,%edi
+  800f91:	55                   	push   %ebp
+  800f92:	68 9b 0f 80 00       	push   $0x800f9b
+  800f97:	89 e5                	mov    %esp,%ebp
+  800f99:	0f 34                	sysenter
+  800f9b:	83 c4 04             	add    $0x4,%esp
+  800f9e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800f9f:	85 c0                	test   %eax,%eax
+  800fa1:	7f 6d                	jg     801010 <sys_page_alloc+0xaf>
+}
+  800fa3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa6:	5b                   	pop    %ebx
+  800fa7:	5e                   	pop    %esi
+  800fa8:	5f                   	pop    %edi
+  800fa9:	5d                   	pop    %ebp
+  800faa:	c3                   	ret
+  800fab:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fb0:	0f a2                	cpuid
+		return 0;
+  800fb2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800fb7:	f6 c6 08             	test   $0x8,%dh
+  800fba:	74 15                	je     800fd1 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800fbc:	89 c2                	mov    %eax,%edx
+  800fbe:	c1 ea 08             	shr    $0x8,%edx
+  800fc1:	83 e2 0f             	and    $0xf,%edx
+  800fc4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800fc9:	83 fa 06             	cmp    $0x6,%edx
+  800fcc:	74 0e                	je     800fdc <sys_page_alloc+0x7b>
+  800fce:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800fd1:	0f b6 c9             	movzbl %cl,%ecx
+  800fd4:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800fda:	eb 97                	jmp    800f73 <sys_page_alloc+0x12>
+  800fdc:	89 c2                	mov    %eax,%edx
+  800fde:	c1 ea 04             	shr    $0x4,%edx
+  800fe1:	83 e2 0f             	and    $0xf,%edx
+  800fe4:	83 fa 02             	cmp    $0x2,%edx
+  800fe7:	77 e5                	ja     800fce <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  800fe9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800fec:	83 f8 02             	cmp    $0x2,%eax
+  800fef:	0f 97 c1             	seta   %cl
+  800ff2:	0f b6 c9             	movzbl %cl,%ecx
+  800ff5:	eb d7                	jmp    800fce <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  800ff7:	be 00 00 00 00       	mov    $0x0,%esi
+  800ffc:	b8 04 00 00 00       	mov    $0x4,%eax
+  801001:	8b 55 08             	mov    0x8(%ebp),%edx
+  801004:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801007:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80100a:	89 f7                	mov    %esi,%edi
+  80100c:	cd 30                	int    $0x30
+  80100e:	eb 8f                	jmp    800f9f <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801010:	83 ec 0c             	sub    $0xc,%esp
+  801013:	50                   	push   %eax
+  801014:	6a 04                	push   $0x4
+  801016:	68 79 2b 80 00       	push   $0x802b79
+  80101b:	6a 4a                	push   $0x4a
+  80101d:	68 96 2b 80 00       	push   $0x802b96
+  801022:	e8 b9 15 00 00       	call   8025e0 <_panic>
+
+00801027 <sys_page_map>:
+{
+  801027:	55                   	push   %ebp
+  801028:	89 e5                	mov    %esp,%ebp
+  80102a:	57                   	push   %edi
+  80102b:	56                   	push   %esi
+  80102c:	53                   	push   %ebx
+  80102d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801030:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801037:	78 37                	js     801070 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  801039:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801040:	74 7a                	je     8010bc <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  801042:	8b 55 08             	mov    0x8(%ebp),%edx
+  801045:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801048:	b8 05 00 00 00       	mov    $0x5,%eax
+  80104d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801050:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801053:	8b 75 18             	mov    0x18(%ebp),%esi
+  801056:	55                   	push   %ebp
+  801057:	68 60 10 80 00       	push   $0x801060
+  80105c:	89 e5                	mov    %esp,%ebp
+  80105e:	0f 34                	sysenter
+  801060:	83 c4 04             	add    $0x4,%esp
+  801063:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801064:	85 c0                	test   %eax,%eax
+  801066:	7f 6c                	jg     8010d4 <sys_page_map+0xad>
+}
+  801068:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80106b:	5b                   	pop    %ebx
+  80106c:	5e                   	pop    %esi
+  80106d:	5f                   	pop    %edi
+  80106e:	5d                   	pop    %ebp
+  80106f:	c3                   	ret
+  801070:	b8 01 00 00 00       	mov    $0x1,%eax
+  801075:	0f a2                	cpuid
+		return 0;
+  801077:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80107c:	f6 c6 08             	test   $0x8,%dh
+  80107f:	74 15                	je     801096 <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801081:	89 c2                	mov    %eax,%edx
+  801083:	c1 ea 08             	shr    $0x8,%edx
+  801086:	83 e2 0f             	and    $0xf,%edx
+  801089:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80108e:	83 fa 06             	cmp    $0x6,%edx
+  801091:	74 0e                	je     8010a1 <sys_page_map+0x7a>
+  801093:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801096:	0f b6 c9             	movzbl %cl,%ecx
+  801099:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80109f:	eb 98                	jmp    801039 <sys_page_map+0x12>
+  8010a1:	89 c2                	mov    %eax,%edx
+  8010a3:	c1 ea 04             	shr    $0x4,%edx
+  8010a6:	83 e2 0f             	and    $0xf,%edx
+  8010a9:	83 fa 02             	cmp    $0x2,%edx
+  8010ac:	77 e5                	ja     801093 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  8010ae:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010b1:	83 f8 02             	cmp    $0x2,%eax
+  8010b4:	0f 97 c1             	seta   %cl
+  8010b7:	0f b6 c9             	movzbl %cl,%ecx
+  8010ba:	eb d7                	jmp    801093 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  8010bc:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010ca:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010cd:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010d0:	cd 30                	int    $0x30
+  8010d2:	eb 90                	jmp    801064 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010d4:	83 ec 0c             	sub    $0xc,%esp
+  8010d7:	50                   	push   %eax
+  8010d8:	6a 05                	push   $0x5
+  8010da:	68 79 2b 80 00       	push   $0x802b79
+  8010df:	6a 4a                	push   $0x4a
+  8010e1:	68 96 2b 80 00       	push   $0x802b96
+  8010e6:	e8 f5 14 00 00       	call   8025e0 <_panic>
+
+008010eb <sys_page_unmap>:
+{
+  8010eb:	55                   	push   %ebp
+  8010ec:	89 e5                	mov    %esp,%ebp
+  8010ee:	57                   	push   %edi
+  8010ef:	56                   	push   %esi
+  8010f0:	53                   	push   %ebx
+  8010f1:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8010f4:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8010fb:	78 37                	js     801134 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  8010fd:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801104:	74 7a                	je     801180 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  801106:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80110b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801111:	b8 06 00 00 00       	mov    $0x6,%eax
+  801116:	89 df                	mov    %ebx,%edi
+  801118:	89 de                	mov    %ebx,%esi
+  80111a:	55                   	push   %ebp
+  80111b:	68 24 11 80 00       	push   $0x801124
+  801120:	89 e5                	mov    %esp,%ebp
+  801122:	0f 34                	sysenter
+  801124:	83 c4 04             	add    $0x4,%esp
+  801127:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801128:	85 c0                	test   %eax,%eax
+  80112a:	7f 6c                	jg     801198 <sys_page_unmap+0xad>
+}
+  80112c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80112f:	5b                   	pop    %ebx
+  801130:	5e                   	pop    %esi
+  801131:	5f                   	pop    %edi
+  801132:	5d                   	pop    %ebp
+  801133:	c3                   	ret
+  801134:	b8 01 00 00 00       	mov    $0x1,%eax
+  801139:	0f a2                	cpuid
+		return 0;
+  80113b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801140:	f6 c6 08             	test   $0x8,%dh
+  801143:	74 15                	je     80115a <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801145:	89 c2                	mov    %eax,%edx
+  801147:	c1 ea 08             	shr    $0x8,%edx
+  80114a:	83 e2 0f             	and    $0xf,%edx
+  80114d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801152:	83 fa 06             	cmp    $0x6,%edx
+  801155:	74 0e                	je     801165 <sys_page_unmap+0x7a>
+  801157:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80115a:	0f b6 c9             	movzbl %cl,%ecx
+  80115d:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801163:	eb 98                	jmp    8010fd <sys_page_unmap+0x12>
+  801165:	89 c2                	mov    %eax,%edx
+  801167:	c1 ea 04             	shr    $0x4,%edx
+  80116a:	83 e2 0f             	and    $0xf,%edx
+  80116d:	83 fa 02             	cmp    $0x2,%edx
+  801170:	77 e5                	ja     801157 <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  801172:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801175:	83 f8 02             	cmp    $0x2,%eax
+  801178:	0f 97 c1             	seta   %cl
+  80117b:	0f b6 c9             	movzbl %cl,%ecx
+  80117e:	eb d7                	jmp    801157 <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  801180:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801185:	b8 06 00 00 00       	mov    $0x6,%eax
+  80118a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801190:	89 df                	mov    %ebx,%edi
+  801192:	89 de                	mov    %ebx,%esi
+  801194:	cd 30                	int    $0x30
+  801196:	eb 90                	jmp    801128 <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801198:	83 ec 0c             	sub    $0xc,%esp
+  80119b:	50                   	push   %eax
+  80119c:	6a 06                	push   $0x6
+  80119e:	68 79 2b 80 00       	push   $0x802b79
+  8011a3:	6a 4a                	push   $0x4a
+  8011a5:	68 96 2b 80 00       	push   $0x802b96
+  8011aa:	e8 31 14 00 00       	call   8025e0 <_panic>
+
+008011af <sys_page_copy>:
+{
+  8011af:	55                   	push   %ebp
+  8011b0:	89 e5                	mov    %esp,%ebp
+  8011b2:	57                   	push   %edi
+  8011b3:	56                   	push   %esi
+  8011b4:	53                   	push   %ebx
+  8011b5:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8011b8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8011bf:	78 37                	js     8011f8 <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  8011c1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8011c8:	74 7a                	je     801244 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  8011ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d0:	b8 29 00 00 00       	mov    $0x29,%eax
+  8011d5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011d8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011db:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011de:	55                   	push   %ebp
+  8011df:	68 e8 11 80 00       	push   $0x8011e8
+  8011e4:	89 e5                	mov    %esp,%ebp
+  8011e6:	0f 34                	sysenter
+  8011e8:	83 c4 04             	add    $0x4,%esp
+  8011eb:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8011ec:	85 c0                	test   %eax,%eax
+  8011ee:	7f 6c                	jg     80125c <sys_page_copy+0xad>
+}
+  8011f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011f3:	5b                   	pop    %ebx
+  8011f4:	5e                   	pop    %esi
+  8011f5:	5f                   	pop    %edi
+  8011f6:	5d                   	pop    %ebp
+  8011f7:	c3                   	ret
+  8011f8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011fd:	0f a2                	cpuid
+		return 0;
+  8011ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801204:	f6 c6 08             	test   $0x8,%dh
+  801207:	74 15                	je     80121e <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801209:	89 c2                	mov    %eax,%edx
+  80120b:	c1 ea 08             	shr    $0x8,%edx
+  80120e:	83 e2 0f             	and    $0xf,%edx
+  801211:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801216:	83 fa 06             	cmp    $0x6,%edx
+  801219:	74 0e                	je     801229 <sys_page_copy+0x7a>
+  80121b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80121e:	0f b6 c9             	movzbl %cl,%ecx
+  801221:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801227:	eb 98                	jmp    8011c1 <sys_page_copy+0x12>
+  801229:	89 c2                	mov    %eax,%edx
+  80122b:	c1 ea 04             	shr    $0x4,%edx
+  80122e:	83 e2 0f             	and    $0xf,%edx
+  801231:	83 fa 02             	cmp    $0x2,%edx
+  801234:	77 e5                	ja     80121b <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  801236:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801239:	83 f8 02             	cmp    $0x2,%eax
+  80123c:	0f 97 c1             	seta   %cl
+  80123f:	0f b6 c9             	movzbl %cl,%ecx
+  801242:	eb d7                	jmp    80121b <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  801244:	b8 29 00 00 00       	mov    $0x29,%eax
+  801249:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80124f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801252:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801255:	8b 75 18             	mov    0x18(%ebp),%esi
+  801258:	cd 30                	int    $0x30
+  80125a:	eb 90                	jmp    8011ec <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80125c:	83 ec 0c             	sub    $0xc,%esp
+  80125f:	50                   	push   %eax
+  801260:	6a 29                	push   $0x29
+  801262:	68 79 2b 80 00       	push   $0x802b79
+  801267:	6a 4a                	push   $0x4a
+  801269:	68 96 2b 80 00       	push   $0x802b96
+  80126e:	e8 6d 13 00 00       	call   8025e0 <_panic>
+
+00801273 <sys_yield>:
+{
+  801273:	55                   	push   %ebp
+  801274:	89 e5                	mov    %esp,%ebp
+  801276:	57                   	push   %edi
+  801277:	56                   	push   %esi
+  801278:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801279:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801280:	78 2e                	js     8012b0 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  801282:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801289:	74 71                	je     8012fc <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  80128b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801290:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801295:	89 d1                	mov    %edx,%ecx
+  801297:	89 d3                	mov    %edx,%ebx
+  801299:	89 d7                	mov    %edx,%edi
+  80129b:	89 d6                	mov    %edx,%esi
+  80129d:	55                   	push   %ebp
+  80129e:	68 a7 12 80 00       	push   $0x8012a7
+  8012a3:	89 e5                	mov    %esp,%ebp
+  8012a5:	0f 34                	sysenter
+  8012a7:	83 c4 04             	add    $0x4,%esp
+  8012aa:	5d                   	pop    %ebp
+}
+  8012ab:	5b                   	pop    %ebx
+  8012ac:	5e                   	pop    %esi
+  8012ad:	5f                   	pop    %edi
+  8012ae:	5d                   	pop    %ebp
+  8012af:	c3                   	ret
+  8012b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012b5:	0f a2                	cpuid
+		return 0;
+  8012b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8012bc:	f6 c6 08             	test   $0x8,%dh
+  8012bf:	74 15                	je     8012d6 <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012c1:	89 c2                	mov    %eax,%edx
+  8012c3:	c1 ea 08             	shr    $0x8,%edx
+  8012c6:	83 e2 0f             	and    $0xf,%edx
+  8012c9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012ce:	83 fa 06             	cmp    $0x6,%edx
+  8012d1:	74 0e                	je     8012e1 <sys_yield+0x6e>
+  8012d3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8012d6:	0f b6 c9             	movzbl %cl,%ecx
+  8012d9:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8012df:	eb a1                	jmp    801282 <sys_yield+0xf>
+  8012e1:	89 c2                	mov    %eax,%edx
+  8012e3:	c1 ea 04             	shr    $0x4,%edx
+  8012e6:	83 e2 0f             	and    $0xf,%edx
+  8012e9:	83 fa 02             	cmp    $0x2,%edx
+  8012ec:	77 e5                	ja     8012d3 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  8012ee:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012f1:	83 f8 02             	cmp    $0x2,%eax
+  8012f4:	0f 97 c1             	seta   %cl
+  8012f7:	0f b6 c9             	movzbl %cl,%ecx
+  8012fa:	eb d7                	jmp    8012d3 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  8012fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801301:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801306:	89 d1                	mov    %edx,%ecx
+  801308:	89 d3                	mov    %edx,%ebx
+  80130a:	89 d7                	mov    %edx,%edi
+  80130c:	89 d6                	mov    %edx,%esi
+  80130e:	cd 30                	int    $0x30
+}
+  801310:	eb 99                	jmp    8012ab <sys_yield+0x38>
+
+00801312 <sys_env_set_status>:
+{
+  801312:	55                   	push   %ebp
+  801313:	89 e5                	mov    %esp,%ebp
+  801315:	57                   	push   %edi
+  801316:	56                   	push   %esi
+  801317:	53                   	push   %ebx
+  801318:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80131b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801322:	78 37                	js     80135b <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  801324:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80132b:	74 7a                	je     8013a7 <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  80132d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801332:	8b 55 08             	mov    0x8(%ebp),%edx
+  801335:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801338:	b8 08 00 00 00       	mov    $0x8,%eax
+  80133d:	89 df                	mov    %ebx,%edi
+  80133f:	89 de                	mov    %ebx,%esi
+  801341:	55                   	push   %ebp
+  801342:	68 4b 13 80 00       	push   $0x80134b
+  801347:	89 e5                	mov    %esp,%ebp
+  801349:	0f 34                	sysenter
+  80134b:	83 c4 04             	add    $0x4,%esp
+  80134e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80134f:	85 c0                	test   %eax,%eax
+  801351:	7f 6c                	jg     8013bf <sys_env_set_status+0xad>
+}
+  801353:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801356:	5b                   	pop    %ebx
+  801357:	5e                   	pop    %esi
+  801358:	5f                   	pop    %edi
+  801359:	5d                   	pop    %ebp
+  80135a:	c3                   	ret
+  80135b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801360:	0f a2                	cpuid
+		return 0;
+  801362:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801367:	f6 c6 08             	test   $0x8,%dh
+  80136a:	74 15                	je     801381 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80136c:	89 c2                	mov    %eax,%edx
+  80136e:	c1 ea 08             	shr    $0x8,%edx
+  801371:	83 e2 0f             	and    $0xf,%edx
+  801374:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801379:	83 fa 06             	cmp    $0x6,%edx
+  80137c:	74 0e                	je     80138c <sys_env_set_status+0x7a>
+  80137e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801381:	0f b6 c9             	movzbl %cl,%ecx
+  801384:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80138a:	eb 98                	jmp    801324 <sys_env_set_status+0x12>
+  80138c:	89 c2                	mov    %eax,%edx
+  80138e:	c1 ea 04             	shr    $0x4,%edx
+  801391:	83 e2 0f             	and    $0xf,%edx
+  801394:	83 fa 02             	cmp    $0x2,%edx
+  801397:	77 e5                	ja     80137e <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  801399:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80139c:	83 f8 02             	cmp    $0x2,%eax
+  80139f:	0f 97 c1             	seta   %cl
+  8013a2:	0f b6 c9             	movzbl %cl,%ecx
+  8013a5:	eb d7                	jmp    80137e <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  8013a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ac:	b8 08 00 00 00       	mov    $0x8,%eax
+  8013b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b7:	89 df                	mov    %ebx,%edi
+  8013b9:	89 de                	mov    %ebx,%esi
+  8013bb:	cd 30                	int    $0x30
+  8013bd:	eb 90                	jmp    80134f <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013bf:	83 ec 0c             	sub    $0xc,%esp
+  8013c2:	50                   	push   %eax
+  8013c3:	6a 08                	push   $0x8
+  8013c5:	68 79 2b 80 00       	push   $0x802b79
+  8013ca:	6a 4a                	push   $0x4a
+  8013cc:	68 96 2b 80 00       	push   $0x802b96
+  8013d1:	e8 0a 12 00 00       	call   8025e0 <_panic>
+
+008013d6 <sys_sysinfo>:
+{
+  8013d6:	55                   	push   %ebp
+  8013d7:	89 e5                	mov    %esp,%ebp
+  8013d9:	57                   	push   %edi
+  8013da:	56                   	push   %esi
+  8013db:	53                   	push   %ebx
+  8013dc:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8013df:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8013e6:	78 36                	js     80141e <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  8013e8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8013ef:	74 79                	je     80146a <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  8013f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013f9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8013fe:	89 cb                	mov    %ecx,%ebx
+  801400:	89 cf                	mov    %ecx,%edi
+  801402:	89 ce                	mov    %ecx,%esi
+  801404:	55                   	push   %ebp
+  801405:	68 0e 14 80 00       	push   $0x80140e
+  80140a:	89 e5                	mov    %esp,%ebp
+  80140c:	0f 34                	sysenter
+  80140e:	83 c4 04             	add    $0x4,%esp
+  801411:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801412:	85 c0                	test   %eax,%eax
+  801414:	7f 6b                	jg     801481 <sys_sysinfo+0xab>
+}
+  801416:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801419:	5b                   	pop    %ebx
+  80141a:	5e                   	pop    %esi
+  80141b:	5f                   	pop    %edi
+  80141c:	5d                   	pop    %ebp
+  80141d:	c3                   	ret
+  80141e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801423:	0f a2                	cpuid
+		return 0;
+  801425:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80142a:	f6 c6 08             	test   $0x8,%dh
+  80142d:	74 15                	je     801444 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80142f:	89 c2                	mov    %eax,%edx
+  801431:	c1 ea 08             	shr    $0x8,%edx
+  801434:	83 e2 0f             	and    $0xf,%edx
+  801437:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80143c:	83 fa 06             	cmp    $0x6,%edx
+  80143f:	74 0e                	je     80144f <sys_sysinfo+0x79>
+  801441:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801444:	0f b6 c9             	movzbl %cl,%ecx
+  801447:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80144d:	eb 99                	jmp    8013e8 <sys_sysinfo+0x12>
+  80144f:	89 c2                	mov    %eax,%edx
+  801451:	c1 ea 04             	shr    $0x4,%edx
+  801454:	83 e2 0f             	and    $0xf,%edx
+  801457:	83 fa 02             	cmp    $0x2,%edx
+  80145a:	77 e5                	ja     801441 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  80145c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80145f:	83 f8 02             	cmp    $0x2,%eax
+  801462:	0f 97 c1             	seta   %cl
+  801465:	0f b6 c9             	movzbl %cl,%ecx
+  801468:	eb d7                	jmp    801441 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  80146a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80146f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801474:	8b 55 08             	mov    0x8(%ebp),%edx
+  801477:	89 cb                	mov    %ecx,%ebx
+  801479:	89 cf                	mov    %ecx,%edi
+  80147b:	89 ce                	mov    %ecx,%esi
+  80147d:	cd 30                	int    $0x30
+  80147f:	eb 91                	jmp    801412 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801481:	83 ec 0c             	sub    $0xc,%esp
+  801484:	50                   	push   %eax
+  801485:	6a 0b                	push   $0xb
+  801487:	68 79 2b 80 00       	push   $0x802b79
+  80148c:	6a 4a                	push   $0x4a
+  80148e:	68 96 2b 80 00       	push   $0x802b96
+  801493:	e8 48 11 00 00       	call   8025e0 <_panic>
+
+00801498 <sys_env_set_trapframe>:
+{
+  801498:	55                   	push   %ebp
+  801499:	89 e5                	mov    %esp,%ebp
+  80149b:	57                   	push   %edi
+  80149c:	56                   	push   %esi
+  80149d:	53                   	push   %ebx
+  80149e:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8014a1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8014a8:	78 37                	js     8014e1 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  8014aa:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8014b1:	74 7a                	je     80152d <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  8014b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014be:	b8 13 00 00 00       	mov    $0x13,%eax
+  8014c3:	89 df                	mov    %ebx,%edi
+  8014c5:	89 de                	mov    %ebx,%esi
+  8014c7:	55                   	push   %ebp
+  8014c8:	68 d1 14 80 00       	push   $0x8014d1
+  8014cd:	89 e5                	mov    %esp,%ebp
+  8014cf:	0f 34                	sysenter
+  8014d1:	83 c4 04             	add    $0x4,%esp
+  8014d4:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8014d5:	85 c0                	test   %eax,%eax
+  8014d7:	7f 6c                	jg     801545 <sys_env_set_trapframe+0xad>
+}
+  8014d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014dc:	5b                   	pop    %ebx
+  8014dd:	5e                   	pop    %esi
+  8014de:	5f                   	pop    %edi
+  8014df:	5d                   	pop    %ebp
+  8014e0:	c3                   	ret
+  8014e1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014e6:	0f a2                	cpuid
+		return 0;
+  8014e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8014ed:	f6 c6 08             	test   $0x8,%dh
+  8014f0:	74 15                	je     801507 <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014f2:	89 c2                	mov    %eax,%edx
+  8014f4:	c1 ea 08             	shr    $0x8,%edx
+  8014f7:	83 e2 0f             	and    $0xf,%edx
+  8014fa:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8014ff:	83 fa 06             	cmp    $0x6,%edx
+  801502:	74 0e                	je     801512 <sys_env_set_trapframe+0x7a>
+  801504:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801507:	0f b6 c9             	movzbl %cl,%ecx
+  80150a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801510:	eb 98                	jmp    8014aa <sys_env_set_trapframe+0x12>
+  801512:	89 c2                	mov    %eax,%edx
+  801514:	c1 ea 04             	shr    $0x4,%edx
+  801517:	83 e2 0f             	and    $0xf,%edx
+  80151a:	83 fa 02             	cmp    $0x2,%edx
+  80151d:	77 e5                	ja     801504 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  80151f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801522:	83 f8 02             	cmp    $0x2,%eax
+  801525:	0f 97 c1             	seta   %cl
+  801528:	0f b6 c9             	movzbl %cl,%ecx
+  80152b:	eb d7                	jmp    801504 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  80152d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801532:	b8 13 00 00 00       	mov    $0x13,%eax
+  801537:	8b 55 08             	mov    0x8(%ebp),%edx
+  80153a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80153d:	89 df                	mov    %ebx,%edi
+  80153f:	89 de                	mov    %ebx,%esi
+  801541:	cd 30                	int    $0x30
+  801543:	eb 90                	jmp    8014d5 <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801545:	83 ec 0c             	sub    $0xc,%esp
+  801548:	50                   	push   %eax
+  801549:	6a 13                	push   $0x13
+  80154b:	68 79 2b 80 00       	push   $0x802b79
+  801550:	6a 4a                	push   $0x4a
+  801552:	68 96 2b 80 00       	push   $0x802b96
+  801557:	e8 84 10 00 00       	call   8025e0 <_panic>
+
+0080155c <sys_env_set_stack_limit>:
+{
+  80155c:	55                   	push   %ebp
+  80155d:	89 e5                	mov    %esp,%ebp
+  80155f:	57                   	push   %edi
+  801560:	56                   	push   %esi
+  801561:	53                   	push   %ebx
+  801562:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801565:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80156c:	78 37                	js     8015a5 <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  80156e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801575:	74 7a                	je     8015f1 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  801577:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80157c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80157f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801582:	b8 19 00 00 00       	mov    $0x19,%eax
+  801587:	89 df                	mov    %ebx,%edi
+  801589:	89 de                	mov    %ebx,%esi
+  80158b:	55                   	push   %ebp
+  80158c:	68 95 15 80 00       	push   $0x801595
+  801591:	89 e5                	mov    %esp,%ebp
+  801593:	0f 34                	sysenter
+  801595:	83 c4 04             	add    $0x4,%esp
+  801598:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801599:	85 c0                	test   %eax,%eax
+  80159b:	7f 6c                	jg     801609 <sys_env_set_stack_limit+0xad>
+}
+  80159d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015a0:	5b                   	pop    %ebx
+  8015a1:	5e                   	pop    %esi
+  8015a2:	5f                   	pop    %edi
+  8015a3:	5d                   	pop    %ebp
+  8015a4:	c3                   	ret
+  8015a5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015aa:	0f a2                	cpuid
+		return 0;
+  8015ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8015b1:	f6 c6 08             	test   $0x8,%dh
+  8015b4:	74 15                	je     8015cb <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015b6:	89 c2                	mov    %eax,%edx
+  8015b8:	c1 ea 08             	shr    $0x8,%edx
+  8015bb:	83 e2 0f             	and    $0xf,%edx
+  8015be:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8015c3:	83 fa 06             	cmp    $0x6,%edx
+  8015c6:	74 0e                	je     8015d6 <sys_env_set_stack_limit+0x7a>
+  8015c8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8015cb:	0f b6 c9             	movzbl %cl,%ecx
+  8015ce:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8015d4:	eb 98                	jmp    80156e <sys_env_set_stack_limit+0x12>
+  8015d6:	89 c2                	mov    %eax,%edx
+  8015d8:	c1 ea 04             	shr    $0x4,%edx
+  8015db:	83 e2 0f             	and    $0xf,%edx
+  8015de:	83 fa 02             	cmp    $0x2,%edx
+  8015e1:	77 e5                	ja     8015c8 <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  8015e3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015e6:	83 f8 02             	cmp    $0x2,%eax
+  8015e9:	0f 97 c1             	seta   %cl
+  8015ec:	0f b6 c9             	movzbl %cl,%ecx
+  8015ef:	eb d7                	jmp    8015c8 <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  8015f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015f6:	b8 19 00 00 00       	mov    $0x19,%eax
+  8015fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801601:	89 df                	mov    %ebx,%edi
+  801603:	89 de                	mov    %ebx,%esi
+  801605:	cd 30                	int    $0x30
+  801607:	eb 90                	jmp    801599 <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801609:	83 ec 0c             	sub    $0xc,%esp
+  80160c:	50                   	push   %eax
+  80160d:	6a 19                	push   $0x19
+  80160f:	68 79 2b 80 00       	push   $0x802b79
+  801614:	6a 4a                	push   $0x4a
+  801616:	68 96 2b 80 00       	push   $0x802b96
+  80161b:	e8 c0 0f 00 00       	call   8025e0 <_panic>
+
+00801620 <sys_env_set_pgfault_upcall>:
+{
+  801620:	55                   	push   %ebp
+  801621:	89 e5                	mov    %esp,%ebp
+  801623:	57                   	push   %edi
+  801624:	56                   	push   %esi
+  801625:	53                   	push   %ebx
+  801626:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801629:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801630:	78 37                	js     801669 <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  801632:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801639:	74 7a                	je     8016b5 <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  80163b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801640:	8b 55 08             	mov    0x8(%ebp),%edx
+  801643:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801646:	b8 09 00 00 00       	mov    $0x9,%eax
+  80164b:	89 df                	mov    %ebx,%edi
+  80164d:	89 de                	mov    %ebx,%esi
+  80164f:	55                   	push   %ebp
+  801650:	68 59 16 80 00       	push   $0x801659
+  801655:	89 e5                	mov    %esp,%ebp
+  801657:	0f 34                	sysenter
+  801659:	83 c4 04             	add    $0x4,%esp
+  80165c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80165d:	85 c0                	test   %eax,%eax
+  80165f:	7f 6c                	jg     8016cd <sys_env_set_pgfault_upcall+0xad>
+}
+  801661:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801664:	5b                   	pop    %ebx
+  801665:	5e                   	pop    %esi
+  801666:	5f                   	pop    %edi
+  801667:	5d                   	pop    %ebp
+  801668:	c3                   	ret
+  801669:	b8 01 00 00 00       	mov    $0x1,%eax
+  80166e:	0f a2                	cpuid
+		return 0;
+  801670:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801675:	f6 c6 08             	test   $0x8,%dh
+  801678:	74 15                	je     80168f <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80167a:	89 c2                	mov    %eax,%edx
+  80167c:	c1 ea 08             	shr    $0x8,%edx
+  80167f:	83 e2 0f             	and    $0xf,%edx
+  801682:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801687:	83 fa 06             	cmp    $0x6,%edx
+  80168a:	74 0e                	je     80169a <sys_env_set_pgfault_upcall+0x7a>
+  80168c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80168f:	0f b6 c9             	movzbl %cl,%ecx
+  801692:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801698:	eb 98                	jmp    801632 <sys_env_set_pgfault_upcall+0x12>
+  80169a:	89 c2                	mov    %eax,%edx
+  80169c:	c1 ea 04             	shr    $0x4,%edx
+  80169f:	83 e2 0f             	and    $0xf,%edx
+  8016a2:	83 fa 02             	cmp    $0x2,%edx
+  8016a5:	77 e5                	ja     80168c <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  8016a7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016aa:	83 f8 02             	cmp    $0x2,%eax
+  8016ad:	0f 97 c1             	seta   %cl
+  8016b0:	0f b6 c9             	movzbl %cl,%ecx
+  8016b3:	eb d7                	jmp    80168c <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  8016b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016ba:	b8 09 00 00 00       	mov    $0x9,%eax
+  8016bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016c5:	89 df                	mov    %ebx,%edi
+  8016c7:	89 de                	mov    %ebx,%esi
+  8016c9:	cd 30                	int    $0x30
+  8016cb:	eb 90                	jmp    80165d <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016cd:	83 ec 0c             	sub    $0xc,%esp
+  8016d0:	50                   	push   %eax
+  8016d1:	6a 09                	push   $0x9
+  8016d3:	68 79 2b 80 00       	push   $0x802b79
+  8016d8:	6a 4a                	push   $0x4a
+  8016da:	68 96 2b 80 00       	push   $0x802b96
+  8016df:	e8 fc 0e 00 00       	call   8025e0 <_panic>
+
+008016e4 <sys_ipc_try_send>:
+{
+  8016e4:	55                   	push   %ebp
+  8016e5:	89 e5                	mov    %esp,%ebp
+  8016e7:	57                   	push   %edi
+  8016e8:	56                   	push   %esi
+  8016e9:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8016ea:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8016f1:	78 32                	js     801725 <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  8016f3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8016fa:	74 75                	je     801771 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  8016fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801702:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801707:	be 00 00 00 00       	mov    $0x0,%esi
+  80170c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80170f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801712:	55                   	push   %ebp
+  801713:	68 1c 17 80 00       	push   $0x80171c
+  801718:	89 e5                	mov    %esp,%ebp
+  80171a:	0f 34                	sysenter
+  80171c:	83 c4 04             	add    $0x4,%esp
+  80171f:	5d                   	pop    %ebp
+}
+  801720:	5b                   	pop    %ebx
+  801721:	5e                   	pop    %esi
+  801722:	5f                   	pop    %edi
+  801723:	5d                   	pop    %ebp
+  801724:	c3                   	ret
+  801725:	b8 01 00 00 00       	mov    $0x1,%eax
+  80172a:	0f a2                	cpuid
+		return 0;
+  80172c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801731:	f6 c6 08             	test   $0x8,%dh
+  801734:	74 15                	je     80174b <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801736:	89 c2                	mov    %eax,%edx
+  801738:	c1 ea 08             	shr    $0x8,%edx
+  80173b:	83 e2 0f             	and    $0xf,%edx
+  80173e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801743:	83 fa 06             	cmp    $0x6,%edx
+  801746:	74 0e                	je     801756 <sys_ipc_try_send+0x72>
+  801748:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80174b:	0f b6 c9             	movzbl %cl,%ecx
+  80174e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801754:	eb 9d                	jmp    8016f3 <sys_ipc_try_send+0xf>
+  801756:	89 c2                	mov    %eax,%edx
+  801758:	c1 ea 04             	shr    $0x4,%edx
+  80175b:	83 e2 0f             	and    $0xf,%edx
+  80175e:	83 fa 02             	cmp    $0x2,%edx
+  801761:	77 e5                	ja     801748 <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  801763:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801766:	83 f8 02             	cmp    $0x2,%eax
+  801769:	0f 97 c1             	seta   %cl
+  80176c:	0f b6 c9             	movzbl %cl,%ecx
+  80176f:	eb d7                	jmp    801748 <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  801771:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801776:	be 00 00 00 00       	mov    $0x0,%esi
+  80177b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80177e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801781:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801784:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801787:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801789:	eb 95                	jmp    801720 <sys_ipc_try_send+0x3c>
+
+0080178b <sys_ipc_send>:
+{
+  80178b:	55                   	push   %ebp
+  80178c:	89 e5                	mov    %esp,%ebp
+  80178e:	57                   	push   %edi
+  80178f:	56                   	push   %esi
+  801790:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801791:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801798:	78 32                	js     8017cc <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  80179a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8017a1:	74 75                	je     801818 <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  8017a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017a9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8017ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8017b3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017b6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8017b9:	55                   	push   %ebp
+  8017ba:	68 c3 17 80 00       	push   $0x8017c3
+  8017bf:	89 e5                	mov    %esp,%ebp
+  8017c1:	0f 34                	sysenter
+  8017c3:	83 c4 04             	add    $0x4,%esp
+  8017c6:	5d                   	pop    %ebp
+}
+  8017c7:	5b                   	pop    %ebx
+  8017c8:	5e                   	pop    %esi
+  8017c9:	5f                   	pop    %edi
+  8017ca:	5d                   	pop    %ebp
+  8017cb:	c3                   	ret
+  8017cc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8017d1:	0f a2                	cpuid
+		return 0;
+  8017d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8017d8:	f6 c6 08             	test   $0x8,%dh
+  8017db:	74 15                	je     8017f2 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017dd:	89 c2                	mov    %eax,%edx
+  8017df:	c1 ea 08             	shr    $0x8,%edx
+  8017e2:	83 e2 0f             	and    $0xf,%edx
+  8017e5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017ea:	83 fa 06             	cmp    $0x6,%edx
+  8017ed:	74 0e                	je     8017fd <sys_ipc_send+0x72>
+  8017ef:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8017f2:	0f b6 c9             	movzbl %cl,%ecx
+  8017f5:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8017fb:	eb 9d                	jmp    80179a <sys_ipc_send+0xf>
+  8017fd:	89 c2                	mov    %eax,%edx
+  8017ff:	c1 ea 04             	shr    $0x4,%edx
+  801802:	83 e2 0f             	and    $0xf,%edx
+  801805:	83 fa 02             	cmp    $0x2,%edx
+  801808:	77 e5                	ja     8017ef <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  80180a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80180d:	83 f8 02             	cmp    $0x2,%eax
+  801810:	0f 97 c1             	seta   %cl
+  801813:	0f b6 c9             	movzbl %cl,%ecx
+  801816:	eb d7                	jmp    8017ef <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  801818:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80181d:	be 00 00 00 00       	mov    $0x0,%esi
+  801822:	8b 55 08             	mov    0x8(%ebp),%edx
+  801825:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801828:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80182b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80182e:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801830:	eb 95                	jmp    8017c7 <sys_ipc_send+0x3c>
+
+00801832 <sys_ipc_recv>:
+{
+  801832:	55                   	push   %ebp
+  801833:	89 e5                	mov    %esp,%ebp
+  801835:	57                   	push   %edi
+  801836:	56                   	push   %esi
+  801837:	53                   	push   %ebx
+  801838:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80183b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801842:	78 36                	js     80187a <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  801844:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80184b:	74 79                	je     8018c6 <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  80184d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801850:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801855:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80185a:	89 cb                	mov    %ecx,%ebx
+  80185c:	89 cf                	mov    %ecx,%edi
+  80185e:	89 ce                	mov    %ecx,%esi
+  801860:	55                   	push   %ebp
+  801861:	68 6a 18 80 00       	push   $0x80186a
+  801866:	89 e5                	mov    %esp,%ebp
+  801868:	0f 34                	sysenter
+  80186a:	83 c4 04             	add    $0x4,%esp
+  80186d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80186e:	85 c0                	test   %eax,%eax
+  801870:	7f 6b                	jg     8018dd <sys_ipc_recv+0xab>
+}
+  801872:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801875:	5b                   	pop    %ebx
+  801876:	5e                   	pop    %esi
+  801877:	5f                   	pop    %edi
+  801878:	5d                   	pop    %ebp
+  801879:	c3                   	ret
+  80187a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80187f:	0f a2                	cpuid
+		return 0;
+  801881:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801886:	f6 c6 08             	test   $0x8,%dh
+  801889:	74 15                	je     8018a0 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80188b:	89 c2                	mov    %eax,%edx
+  80188d:	c1 ea 08             	shr    $0x8,%edx
+  801890:	83 e2 0f             	and    $0xf,%edx
+  801893:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801898:	83 fa 06             	cmp    $0x6,%edx
+  80189b:	74 0e                	je     8018ab <sys_ipc_recv+0x79>
+  80189d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8018a0:	0f b6 c9             	movzbl %cl,%ecx
+  8018a3:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8018a9:	eb 99                	jmp    801844 <sys_ipc_recv+0x12>
+  8018ab:	89 c2                	mov    %eax,%edx
+  8018ad:	c1 ea 04             	shr    $0x4,%edx
+  8018b0:	83 e2 0f             	and    $0xf,%edx
+  8018b3:	83 fa 02             	cmp    $0x2,%edx
+  8018b6:	77 e5                	ja     80189d <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  8018b8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018bb:	83 f8 02             	cmp    $0x2,%eax
+  8018be:	0f 97 c1             	seta   %cl
+  8018c1:	0f b6 c9             	movzbl %cl,%ecx
+  8018c4:	eb d7                	jmp    80189d <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  8018c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018cb:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8018d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018d3:	89 cb                	mov    %ecx,%ebx
+  8018d5:	89 cf                	mov    %ecx,%edi
+  8018d7:	89 ce                	mov    %ecx,%esi
+  8018d9:	cd 30                	int    $0x30
+  8018db:	eb 91                	jmp    80186e <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8018dd:	83 ec 0c             	sub    $0xc,%esp
+  8018e0:	50                   	push   %eax
+  8018e1:	6a 0d                	push   $0xd
+  8018e3:	68 79 2b 80 00       	push   $0x802b79
+  8018e8:	6a 4a                	push   $0x4a
+  8018ea:	68 96 2b 80 00       	push   $0x802b96
+  8018ef:	e8 ec 0c 00 00       	call   8025e0 <_panic>
+
+008018f4 <sys_ipc_send_range>:
+{
+  8018f4:	55                   	push   %ebp
+  8018f5:	89 e5                	mov    %esp,%ebp
+  8018f7:	57                   	push   %edi
+  8018f8:	56                   	push   %esi
+  8018f9:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8018fa:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801901:	78 30                	js     801933 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  801903:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80190a:	74 73                	je     80197f <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  80190c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80190f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801912:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801917:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80191a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80191d:	8b 75 18             	mov    0x18(%ebp),%esi
+  801920:	55                   	push   %ebp
+  801921:	68 2a 19 80 00       	push   $0x80192a
+  801926:	89 e5                	mov    %esp,%ebp
+  801928:	0f 34                	sysenter
+  80192a:	83 c4 04             	add    $0x4,%esp
+  80192d:	5d                   	pop    %ebp
+}
+  80192e:	5b                   	pop    %ebx
+  80192f:	5e                   	pop    %esi
+  801930:	5f                   	pop    %edi
+  801931:	5d                   	pop    %ebp
+  801932:	c3                   	ret
+  801933:	b8 01 00 00 00       	mov    $0x1,%eax
+  801938:	0f a2                	cpuid
+		return 0;
+  80193a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80193f:	f6 c6 08             	test   $0x8,%dh
+  801942:	74 15                	je     801959 <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801944:	89 c2                	mov    %eax,%edx
+  801946:	c1 ea 08             	shr    $0x8,%edx
+  801949:	83 e2 0f             	and    $0xf,%edx
+  80194c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801951:	83 fa 06             	cmp    $0x6,%edx
+  801954:	74 0e                	je     801964 <sys_ipc_send_range+0x70>
+  801956:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801959:	0f b6 c9             	movzbl %cl,%ecx
+  80195c:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801962:	eb 9f                	jmp    801903 <sys_ipc_send_range+0xf>
+  801964:	89 c2                	mov    %eax,%edx
+  801966:	c1 ea 04             	shr    $0x4,%edx
+  801969:	83 e2 0f             	and    $0xf,%edx
+  80196c:	83 fa 02             	cmp    $0x2,%edx
+  80196f:	77 e5                	ja     801956 <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  801971:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801974:	83 f8 02             	cmp    $0x2,%eax
+  801977:	0f 97 c1             	seta   %cl
+  80197a:	0f b6 c9             	movzbl %cl,%ecx
+  80197d:	eb d7                	jmp    801956 <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  80197f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801984:	8b 55 08             	mov    0x8(%ebp),%edx
+  801987:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80198a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80198d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801990:	8b 75 18             	mov    0x18(%ebp),%esi
+  801993:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  801995:	eb 97                	jmp    80192e <sys_ipc_send_range+0x3a>
+
+00801997 <sys_ipc_recv_range>:
+{
+  801997:	55                   	push   %ebp
+  801998:	89 e5                	mov    %esp,%ebp
+  80199a:	57                   	push   %edi
+  80199b:	56                   	push   %esi
+  80199c:	53                   	push   %ebx
+  80199d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8019a0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8019a7:	78 37                	js     8019e0 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  8019a9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8019b0:	74 7a                	je     801a2c <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  8019b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019bd:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8019c2:	89 df                	mov    %ebx,%edi
+  8019c4:	89 de                	mov    %ebx,%esi
+  8019c6:	55                   	push   %ebp
+  8019c7:	68 d0 19 80 00       	push   $0x8019d0
+  8019cc:	89 e5                	mov    %esp,%ebp
+  8019ce:	0f 34                	sysenter
+  8019d0:	83 c4 04             	add    $0x4,%esp
+  8019d3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8019d4:	85 c0                	test   %eax,%eax
+  8019d6:	7f 6c                	jg     801a44 <sys_ipc_recv_range+0xad>
+}
+  8019d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019db:	5b                   	pop    %ebx
+  8019dc:	5e                   	pop    %esi
+  8019dd:	5f                   	pop    %edi
+  8019de:	5d                   	pop    %ebp
+  8019df:	c3                   	ret
+  8019e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019e5:	0f a2                	cpuid
+		return 0;
+  8019e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8019ec:	f6 c6 08             	test   $0x8,%dh
+  8019ef:	74 15                	je     801a06 <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019f1:	89 c2                	mov    %eax,%edx
+  8019f3:	c1 ea 08             	shr    $0x8,%edx
+  8019f6:	83 e2 0f             	and    $0xf,%edx
+  8019f9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019fe:	83 fa 06             	cmp    $0x6,%edx
+  801a01:	74 0e                	je     801a11 <sys_ipc_recv_range+0x7a>
+  801a03:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a06:	0f b6 c9             	movzbl %cl,%ecx
+  801a09:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801a0f:	eb 98                	jmp    8019a9 <sys_ipc_recv_range+0x12>
+  801a11:	89 c2                	mov    %eax,%edx
+  801a13:	c1 ea 04             	shr    $0x4,%edx
+  801a16:	83 e2 0f             	and    $0xf,%edx
+  801a19:	83 fa 02             	cmp    $0x2,%edx
+  801a1c:	77 e5                	ja     801a03 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801a1e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a21:	83 f8 02             	cmp    $0x2,%eax
+  801a24:	0f 97 c1             	seta   %cl
+  801a27:	0f b6 c9             	movzbl %cl,%ecx
+  801a2a:	eb d7                	jmp    801a03 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801a2c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a31:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801a36:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a39:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a3c:	89 df                	mov    %ebx,%edi
+  801a3e:	89 de                	mov    %ebx,%esi
+  801a40:	cd 30                	int    $0x30
+  801a42:	eb 90                	jmp    8019d4 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a44:	83 ec 0c             	sub    $0xc,%esp
+  801a47:	50                   	push   %eax
+  801a48:	6a 1f                	push   $0x1f
+  801a4a:	68 79 2b 80 00       	push   $0x802b79
+  801a4f:	6a 4a                	push   $0x4a
+  801a51:	68 96 2b 80 00       	push   $0x802b96
+  801a56:	e8 85 0b 00 00       	call   8025e0 <_panic>
+
+00801a5b <sys_ipc_call>:
+{
+  801a5b:	55                   	push   %ebp
+  801a5c:	89 e5                	mov    %esp,%ebp
+  801a5e:	57                   	push   %edi
+  801a5f:	56                   	push   %esi
+  801a60:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801a61:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a64:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801a69:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801a6c:	55                   	push   %ebp
+  801a6d:	56                   	push   %esi
+  801a6e:	8b 0e                	mov    (%esi),%ecx
+  801a70:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801a73:	8b 7e 08             	mov    0x8(%esi),%edi
+  801a76:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801a79:	8b 76 0c             	mov    0xc(%esi),%esi
+  801a7c:	cd 30                	int    $0x30
+  801a7e:	87 34 24             	xchg   %esi,(%esp)
+  801a81:	89 0e                	mov    %ecx,(%esi)
+  801a83:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801a86:	89 7e 08             	mov    %edi,0x8(%esi)
+  801a89:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801a8c:	8f 46 0c             	pop    0xc(%esi)
+  801a8f:	5d                   	pop    %ebp
+}
+  801a90:	5b                   	pop    %ebx
+  801a91:	5e                   	pop    %esi
+  801a92:	5f                   	pop    %edi
+  801a93:	5d                   	pop    %ebp
+  801a94:	c3                   	ret
+
+00801a95 <sys_ipc_reply_wait>:
+{
+  801a95:	55                   	push   %ebp
+  801a96:	89 e5                	mov    %esp,%ebp
+  801a98:	57                   	push   %edi
+  801a99:	56                   	push   %esi
+  801a9a:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801a9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a9e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801aa3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801aa6:	55                   	push   %ebp
+  801aa7:	56                   	push   %esi
+  801aa8:	8b 0e                	mov    (%esi),%ecx
+  801aaa:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801aad:	8b 7e 08             	mov    0x8(%esi),%edi
+  801ab0:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801ab3:	8b 76 0c             	mov    0xc(%esi),%esi
+  801ab6:	cd 30                	int    $0x30
+  801ab8:	87 34 24             	xchg   %esi,(%esp)
+  801abb:	89 0e                	mov    %ecx,(%esi)
+  801abd:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801ac0:	89 7e 08             	mov    %edi,0x8(%esi)
+  801ac3:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801ac6:	8f 46 0c             	pop    0xc(%esi)
+  801ac9:	5d                   	pop    %ebp
+}
+  801aca:	5b                   	pop    %ebx
+  801acb:	5e                   	pop    %esi
+  801acc:	5f                   	pop    %edi
+  801acd:	5d                   	pop    %ebp
+  801ace:	c3                   	ret
+
+00801acf <sys_ipc_send_msg>:
+{
+  801acf:	55                   	push   %ebp
+  801ad0:	89 e5                	mov    %esp,%ebp
+  801ad2:	57                   	push   %edi
+  801ad3:	56                   	push   %esi
+  801ad4:	53                   	push   %ebx
+  801ad5:	83 ec 20             	sub    $0x20,%esp
+  801ad8:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801adb:	8b 10                	mov    (%eax),%edx
+  801add:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801ae0:	8b 50 04             	mov    0x4(%eax),%edx
+  801ae3:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801ae6:	8b 50 08             	mov    0x8(%eax),%edx
+  801ae9:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801aec:	8b 50 0c             	mov    0xc(%eax),%edx
+  801aef:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801af2:	8b 40 10             	mov    0x10(%eax),%eax
+  801af5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801af8:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801afb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801afe:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801b03:	55                   	push   %ebp
+  801b04:	56                   	push   %esi
+  801b05:	8b 0e                	mov    (%esi),%ecx
+  801b07:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801b0a:	8b 7e 08             	mov    0x8(%esi),%edi
+  801b0d:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801b10:	8b 76 0c             	mov    0xc(%esi),%esi
+  801b13:	cd 30                	int    $0x30
+  801b15:	87 34 24             	xchg   %esi,(%esp)
+  801b18:	89 0e                	mov    %ecx,(%esi)
+  801b1a:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801b1d:	89 7e 08             	mov    %edi,0x8(%esi)
+  801b20:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801b23:	8f 46 0c             	pop    0xc(%esi)
+  801b26:	5d                   	pop    %ebp
+}
+  801b27:	83 c4 20             	add    $0x20,%esp
+  801b2a:	5b                   	pop    %ebx
+  801b2b:	5e                   	pop    %esi
+  801b2c:	5f                   	pop    %edi
+  801b2d:	5d                   	pop    %ebp
+  801b2e:	c3                   	ret
+
+00801b2f <sys_fork>:
+{
+  801b2f:	55                   	push   %ebp
+  801b30:	89 e5                	mov    %esp,%ebp
+  801b32:	57                   	push   %edi
+  801b33:	56                   	push   %esi
+  801b34:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801b35:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b3c:	78 2e                	js     801b6c <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801b3e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b45:	74 71                	je     801bb8 <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801b47:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b4c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801b51:	89 d1                	mov    %edx,%ecx
+  801b53:	89 d3                	mov    %edx,%ebx
+  801b55:	89 d7                	mov    %edx,%edi
+  801b57:	89 d6                	mov    %edx,%esi
+  801b59:	55                   	push   %ebp
+  801b5a:	68 63 1b 80 00       	push   $0x801b63
+  801b5f:	89 e5                	mov    %esp,%ebp
+  801b61:	0f 34                	sysenter
+  801b63:	83 c4 04             	add    $0x4,%esp
+  801b66:	5d                   	pop    %ebp
+}
+  801b67:	5b                   	pop    %ebx
+  801b68:	5e                   	pop    %esi
+  801b69:	5f                   	pop    %edi
+  801b6a:	5d                   	pop    %ebp
+  801b6b:	c3                   	ret
+  801b6c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b71:	0f a2                	cpuid
+		return 0;
+  801b73:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b78:	f6 c6 08             	test   $0x8,%dh
+  801b7b:	74 15                	je     801b92 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b7d:	89 c2                	mov    %eax,%edx
+  801b7f:	c1 ea 08             	shr    $0x8,%edx
+  801b82:	83 e2 0f             	and    $0xf,%edx
+  801b85:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b8a:	83 fa 06             	cmp    $0x6,%edx
+  801b8d:	74 0e                	je     801b9d <sys_fork+0x6e>
+  801b8f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b92:	0f b6 c9             	movzbl %cl,%ecx
+  801b95:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801b9b:	eb a1                	jmp    801b3e <sys_fork+0xf>
+  801b9d:	89 c2                	mov    %eax,%edx
+  801b9f:	c1 ea 04             	shr    $0x4,%edx
+  801ba2:	83 e2 0f             	and    $0xf,%edx
+  801ba5:	83 fa 02             	cmp    $0x2,%edx
+  801ba8:	77 e5                	ja     801b8f <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801baa:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bad:	83 f8 02             	cmp    $0x2,%eax
+  801bb0:	0f 97 c1             	seta   %cl
+  801bb3:	0f b6 c9             	movzbl %cl,%ecx
+  801bb6:	eb d7                	jmp    801b8f <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801bb8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bbd:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801bc2:	89 d1                	mov    %edx,%ecx
+  801bc4:	89 d3                	mov    %edx,%ebx
+  801bc6:	89 d7                	mov    %edx,%edi
+  801bc8:	89 d6                	mov    %edx,%esi
+  801bca:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801bcc:	eb 99                	jmp    801b67 <sys_fork+0x38>
+
+00801bce <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801bce:	55                   	push   %ebp
+  801bcf:	89 e5                	mov    %esp,%ebp
+  801bd1:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801bd4:	ff 75 14             	push   0x14(%ebp)
+  801bd7:	ff 75 10             	push   0x10(%ebp)
+  801bda:	ff 75 0c             	push   0xc(%ebp)
+  801bdd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801be2:	8b 55 08             	mov    0x8(%ebp),%edx
+  801be5:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801bea:	e8 81 ee ff ff       	call   800a70 <page_vec_call>
+}
+  801bef:	c9                   	leave
+  801bf0:	c3                   	ret
+
+00801bf1 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801bf1:	55                   	push   %ebp
+  801bf2:	89 e5                	mov    %esp,%ebp
+  801bf4:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801bf7:	ff 75 18             	push   0x18(%ebp)
+  801bfa:	ff 75 14             	push   0x14(%ebp)
+  801bfd:	ff 75 10             	push   0x10(%ebp)
+  801c00:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c03:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c06:	b8 10 00 00 00       	mov    $0x10,%eax
+  801c0b:	e8 60 ee ff ff       	call   800a70 <page_vec_call>
+}
+  801c10:	c9                   	leave
+  801c11:	c3                   	ret
+
+00801c12 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801c12:	55                   	push   %ebp
+  801c13:	89 e5                	mov    %esp,%ebp
+  801c15:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801c18:	ff 75 14             	push   0x14(%ebp)
+  801c1b:	ff 75 10             	push   0x10(%ebp)
+  801c1e:	ff 75 0c             	push   0xc(%ebp)
+  801c21:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c26:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c29:	b8 11 00 00 00       	mov    $0x11,%eax
+  801c2e:	e8 3d ee ff ff       	call   800a70 <page_vec_call>
+}
+  801c33:	c9                   	leave
+  801c34:	c3                   	ret
+
+00801c35 <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801c35:	55                   	push   %ebp
+  801c36:	89 e5                	mov    %esp,%ebp
+  801c38:	57                   	push   %edi
+  801c39:	56                   	push   %esi
+  801c3a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801c3b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801c42:	78 32                	js     801c76 <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801c44:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801c4b:	74 75                	je     801cc2 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801c4d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c50:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c53:	b8 12 00 00 00       	mov    $0x12,%eax
+  801c58:	be 00 00 00 00       	mov    $0x0,%esi
+  801c5d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801c60:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801c63:	55                   	push   %ebp
+  801c64:	68 6d 1c 80 00       	push   $0x801c6d
+  801c69:	89 e5                	mov    %esp,%ebp
+  801c6b:	0f 34                	sysenter
+  801c6d:	83 c4 04             	add    $0x4,%esp
+  801c70:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801c71:	5b                   	pop    %ebx
+  801c72:	5e                   	pop    %esi
+  801c73:	5f                   	pop    %edi
+  801c74:	5d                   	pop    %ebp
+  801c75:	c3                   	ret
+  801c76:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c7b:	0f a2                	cpuid
+		return 0;
+  801c7d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801c82:	f6 c6 08             	test   $0x8,%dh
+  801c85:	74 15                	je     801c9c <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c87:	89 c2                	mov    %eax,%edx
+  801c89:	c1 ea 08             	shr    $0x8,%edx
+  801c8c:	83 e2 0f             	and    $0xf,%edx
+  801c8f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801c94:	83 fa 06             	cmp    $0x6,%edx
+  801c97:	74 0e                	je     801ca7 <sys_vm_ranges+0x72>
+  801c99:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801c9c:	0f b6 c9             	movzbl %cl,%ecx
+  801c9f:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801ca5:	eb 9d                	jmp    801c44 <sys_vm_ranges+0xf>
+  801ca7:	89 c2                	mov    %eax,%edx
+  801ca9:	c1 ea 04             	shr    $0x4,%edx
+  801cac:	83 e2 0f             	and    $0xf,%edx
+  801caf:	83 fa 02             	cmp    $0x2,%edx
+  801cb2:	77 e5                	ja     801c99 <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  801cb4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801cb7:	83 f8 02             	cmp    $0x2,%eax
+  801cba:	0f 97 c1             	seta   %cl
+  801cbd:	0f b6 c9             	movzbl %cl,%ecx
+  801cc0:	eb d7                	jmp    801c99 <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801cc2:	b8 12 00 00 00       	mov    $0x12,%eax
+  801cc7:	be 00 00 00 00       	mov    $0x0,%esi
+  801ccc:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ccf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cd2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801cd5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801cd8:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801cda:	eb 95                	jmp    801c71 <sys_vm_ranges+0x3c>
+
+00801cdc <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801cdc:	55                   	push   %ebp
+  801cdd:	89 e5                	mov    %esp,%ebp
+  801cdf:	57                   	push   %edi
+  801ce0:	56                   	push   %esi
+  801ce1:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801ce2:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801ce9:	78 31                	js     801d1c <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801ceb:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801cf2:	74 74                	je     801d68 <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801cf4:	be 00 00 00 00       	mov    $0x0,%esi
+  801cf9:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cfc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cff:	b8 14 00 00 00       	mov    $0x14,%eax
+  801d04:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d07:	89 f7                	mov    %esi,%edi
+  801d09:	55                   	push   %ebp
+  801d0a:	68 13 1d 80 00       	push   $0x801d13
+  801d0f:	89 e5                	mov    %esp,%ebp
+  801d11:	0f 34                	sysenter
+  801d13:	83 c4 04             	add    $0x4,%esp
+  801d16:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801d17:	5b                   	pop    %ebx
+  801d18:	5e                   	pop    %esi
+  801d19:	5f                   	pop    %edi
+  801d1a:	5d                   	pop    %ebp
+  801d1b:	c3                   	ret
+  801d1c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d21:	0f a2                	cpuid
+		return 0;
+  801d23:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801d28:	f6 c6 08             	test   $0x8,%dh
+  801d2b:	74 15                	je     801d42 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d2d:	89 c2                	mov    %eax,%edx
+  801d2f:	c1 ea 08             	shr    $0x8,%edx
+  801d32:	83 e2 0f             	and    $0xf,%edx
+  801d35:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d3a:	83 fa 06             	cmp    $0x6,%edx
+  801d3d:	74 0e                	je     801d4d <sys_spawn+0x71>
+  801d3f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801d42:	0f b6 c9             	movzbl %cl,%ecx
+  801d45:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801d4b:	eb 9e                	jmp    801ceb <sys_spawn+0xf>
+  801d4d:	89 c2                	mov    %eax,%edx
+  801d4f:	c1 ea 04             	shr    $0x4,%edx
+  801d52:	83 e2 0f             	and    $0xf,%edx
+  801d55:	83 fa 02             	cmp    $0x2,%edx
+  801d58:	77 e5                	ja     801d3f <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  801d5a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d5d:	83 f8 02             	cmp    $0x2,%eax
+  801d60:	0f 97 c1             	seta   %cl
+  801d63:	0f b6 c9             	movzbl %cl,%ecx
+  801d66:	eb d7                	jmp    801d3f <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  801d68:	be 00 00 00 00       	mov    $0x0,%esi
+  801d6d:	b8 14 00 00 00       	mov    $0x14,%eax
+  801d72:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d75:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d78:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d7b:	89 f7                	mov    %esi,%edi
+  801d7d:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  801d7f:	eb 96                	jmp    801d17 <sys_spawn+0x3b>
+
+00801d81 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  801d81:	55                   	push   %ebp
+  801d82:	89 e5                	mov    %esp,%ebp
+  801d84:	57                   	push   %edi
+  801d85:	56                   	push   %esi
+  801d86:	53                   	push   %ebx
+  801d87:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801d8a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801d91:	78 37                	js     801dca <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  801d93:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801d9a:	74 7a                	je     801e16 <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  801d9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801da1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801da4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801da7:	b8 15 00 00 00       	mov    $0x15,%eax
+  801dac:	89 df                	mov    %ebx,%edi
+  801dae:	89 de                	mov    %ebx,%esi
+  801db0:	55                   	push   %ebp
+  801db1:	68 ba 1d 80 00       	push   $0x801dba
+  801db6:	89 e5                	mov    %esp,%ebp
+  801db8:	0f 34                	sysenter
+  801dba:	83 c4 04             	add    $0x4,%esp
+  801dbd:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801dbe:	85 c0                	test   %eax,%eax
+  801dc0:	7f 6c                	jg     801e2e <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  801dc2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dc5:	5b                   	pop    %ebx
+  801dc6:	5e                   	pop    %esi
+  801dc7:	5f                   	pop    %edi
+  801dc8:	5d                   	pop    %ebp
+  801dc9:	c3                   	ret
+  801dca:	b8 01 00 00 00       	mov    $0x1,%eax
+  801dcf:	0f a2                	cpuid
+		return 0;
+  801dd1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801dd6:	f6 c6 08             	test   $0x8,%dh
+  801dd9:	74 15                	je     801df0 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ddb:	89 c2                	mov    %eax,%edx
+  801ddd:	c1 ea 08             	shr    $0x8,%edx
+  801de0:	83 e2 0f             	and    $0xf,%edx
+  801de3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801de8:	83 fa 06             	cmp    $0x6,%edx
+  801deb:	74 0e                	je     801dfb <sys_shm_create+0x7a>
+  801ded:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801df0:	0f b6 c9             	movzbl %cl,%ecx
+  801df3:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801df9:	eb 98                	jmp    801d93 <sys_shm_create+0x12>
+  801dfb:	89 c2                	mov    %eax,%edx
+  801dfd:	c1 ea 04             	shr    $0x4,%edx
+  801e00:	83 e2 0f             	and    $0xf,%edx
+  801e03:	83 fa 02             	cmp    $0x2,%edx
+  801e06:	77 e5                	ja     801ded <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  801e08:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e0b:	83 f8 02             	cmp    $0x2,%eax
+  801e0e:	0f 97 c1             	seta   %cl
+  801e11:	0f b6 c9             	movzbl %cl,%ecx
+  801e14:	eb d7                	jmp    801ded <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  801e16:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e1b:	b8 15 00 00 00       	mov    $0x15,%eax
+  801e20:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e26:	89 df                	mov    %ebx,%edi
+  801e28:	89 de                	mov    %ebx,%esi
+  801e2a:	cd 30                	int    $0x30
+  801e2c:	eb 90                	jmp    801dbe <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801e2e:	83 ec 0c             	sub    $0xc,%esp
+  801e31:	50                   	push   %eax
+  801e32:	6a 15                	push   $0x15
+  801e34:	68 79 2b 80 00       	push   $0x802b79
+  801e39:	6a 4a                	push   $0x4a
+  801e3b:	68 96 2b 80 00       	push   $0x802b96
+  801e40:	e8 9b 07 00 00       	call   8025e0 <_panic>
+
+00801e45 <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  801e45:	55                   	push   %ebp
+  801e46:	89 e5                	mov    %esp,%ebp
+  801e48:	57                   	push   %edi
+  801e49:	56                   	push   %esi
+  801e4a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801e4b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801e52:	78 32                	js     801e86 <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  801e54:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801e5b:	74 75                	je     801ed2 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801e5d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e60:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e63:	b8 16 00 00 00       	mov    $0x16,%eax
+  801e68:	be 00 00 00 00       	mov    $0x0,%esi
+  801e6d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e70:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801e73:	55                   	push   %ebp
+  801e74:	68 7d 1e 80 00       	push   $0x801e7d
+  801e79:	89 e5                	mov    %esp,%ebp
+  801e7b:	0f 34                	sysenter
+  801e7d:	83 c4 04             	add    $0x4,%esp
+  801e80:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  801e81:	5b                   	pop    %ebx
+  801e82:	5e                   	pop    %esi
+  801e83:	5f                   	pop    %edi
+  801e84:	5d                   	pop    %ebp
+  801e85:	c3                   	ret
+  801e86:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e8b:	0f a2                	cpuid
+		return 0;
+  801e8d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801e92:	f6 c6 08             	test   $0x8,%dh
+  801e95:	74 15                	je     801eac <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e97:	89 c2                	mov    %eax,%edx
+  801e99:	c1 ea 08             	shr    $0x8,%edx
+  801e9c:	83 e2 0f             	and    $0xf,%edx
+  801e9f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ea4:	83 fa 06             	cmp    $0x6,%edx
+  801ea7:	74 0e                	je     801eb7 <sys_shm_attach+0x72>
+  801ea9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801eac:	0f b6 c9             	movzbl %cl,%ecx
+  801eaf:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801eb5:	eb 9d                	jmp    801e54 <sys_shm_attach+0xf>
+  801eb7:	89 c2                	mov    %eax,%edx
+  801eb9:	c1 ea 04             	shr    $0x4,%edx
+  801ebc:	83 e2 0f             	and    $0xf,%edx
+  801ebf:	83 fa 02             	cmp    $0x2,%edx
+  801ec2:	77 e5                	ja     801ea9 <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  801ec4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ec7:	83 f8 02             	cmp    $0x2,%eax
+  801eca:	0f 97 c1             	seta   %cl
+  801ecd:	0f b6 c9             	movzbl %cl,%ecx
+  801ed0:	eb d7                	jmp    801ea9 <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  801ed2:	b8 16 00 00 00       	mov    $0x16,%eax
+  801ed7:	be 00 00 00 00       	mov    $0x0,%esi
+  801edc:	8b 55 08             	mov    0x8(%ebp),%edx
+  801edf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ee2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ee5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ee8:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  801eea:	eb 95                	jmp    801e81 <sys_shm_attach+0x3c>
+
+00801eec <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  801eec:	55                   	push   %ebp
+  801eed:	89 e5                	mov    %esp,%ebp
+  801eef:	57                   	push   %edi
+  801ef0:	56                   	push   %esi
+  801ef1:	53                   	push   %ebx
+  801ef2:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801ef5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801efc:	78 38                	js     801f36 <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  801efe:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801f05:	74 7b                	je     801f82 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  801f07:	be 00 00 00 00       	mov    $0x0,%esi
+  801f0c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f0f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f12:	b8 17 00 00 00       	mov    $0x17,%eax
+  801f17:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f1a:	89 f7                	mov    %esi,%edi
+  801f1c:	55                   	push   %ebp
+  801f1d:	68 26 1f 80 00       	push   $0x801f26
+  801f22:	89 e5                	mov    %esp,%ebp
+  801f24:	0f 34                	sysenter
+  801f26:	83 c4 04             	add    $0x4,%esp
+  801f29:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801f2a:	85 c0                	test   %eax,%eax
+  801f2c:	7f 6d                	jg     801f9b <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  801f2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f31:	5b                   	pop    %ebx
+  801f32:	5e                   	pop    %esi
+  801f33:	5f                   	pop    %edi
+  801f34:	5d                   	pop    %ebp
+  801f35:	c3                   	ret
+  801f36:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f3b:	0f a2                	cpuid
+		return 0;
+  801f3d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801f42:	f6 c6 08             	test   $0x8,%dh
+  801f45:	74 15                	je     801f5c <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f47:	89 c2                	mov    %eax,%edx
+  801f49:	c1 ea 08             	shr    $0x8,%edx
+  801f4c:	83 e2 0f             	and    $0xf,%edx
+  801f4f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f54:	83 fa 06             	cmp    $0x6,%edx
+  801f57:	74 0e                	je     801f67 <sys_shm_detach+0x7b>
+  801f59:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801f5c:	0f b6 c9             	movzbl %cl,%ecx
+  801f5f:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801f65:	eb 97                	jmp    801efe <sys_shm_detach+0x12>
+  801f67:	89 c2                	mov    %eax,%edx
+  801f69:	c1 ea 04             	shr    $0x4,%edx
+  801f6c:	83 e2 0f             	and    $0xf,%edx
+  801f6f:	83 fa 02             	cmp    $0x2,%edx
+  801f72:	77 e5                	ja     801f59 <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  801f74:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f77:	83 f8 02             	cmp    $0x2,%eax
+  801f7a:	0f 97 c1             	seta   %cl
+  801f7d:	0f b6 c9             	movzbl %cl,%ecx
+  801f80:	eb d7                	jmp    801f59 <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  801f82:	be 00 00 00 00       	mov    $0x0,%esi
+  801f87:	b8 17 00 00 00       	mov    $0x17,%eax
+  801f8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f92:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f95:	89 f7                	mov    %esi,%edi
+  801f97:	cd 30                	int    $0x30
+  801f99:	eb 8f                	jmp    801f2a <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801f9b:	83 ec 0c             	sub    $0xc,%esp
+  801f9e:	50                   	push   %eax
+  801f9f:	6a 17                	push   $0x17
+  801fa1:	68 79 2b 80 00       	push   $0x802b79
+  801fa6:	6a 4a                	push   $0x4a
+  801fa8:	68 96 2b 80 00       	push   $0x802b96
+  801fad:	e8 2e 06 00 00       	call   8025e0 <_panic>
+
+00801fb2 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  801fb2:	55                   	push   %ebp
+  801fb3:	89 e5                	mov    %esp,%ebp
+  801fb5:	57                   	push   %edi
+  801fb6:	56                   	push   %esi
+  801fb7:	53                   	push   %ebx
+  801fb8:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801fbb:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801fc2:	78 36                	js     801ffa <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  801fc4:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801fcb:	74 79                	je     802046 <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  801fcd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fd0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fd5:	b8 18 00 00 00       	mov    $0x18,%eax
+  801fda:	89 cb                	mov    %ecx,%ebx
+  801fdc:	89 cf                	mov    %ecx,%edi
+  801fde:	89 ce                	mov    %ecx,%esi
+  801fe0:	55                   	push   %ebp
+  801fe1:	68 ea 1f 80 00       	push   $0x801fea
+  801fe6:	89 e5                	mov    %esp,%ebp
+  801fe8:	0f 34                	sysenter
+  801fea:	83 c4 04             	add    $0x4,%esp
+  801fed:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801fee:	85 c0                	test   %eax,%eax
+  801ff0:	7f 6b                	jg     80205d <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  801ff2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ff5:	5b                   	pop    %ebx
+  801ff6:	5e                   	pop    %esi
+  801ff7:	5f                   	pop    %edi
+  801ff8:	5d                   	pop    %ebp
+  801ff9:	c3                   	ret
+  801ffa:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fff:	0f a2                	cpuid
+		return 0;
+  802001:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802006:	f6 c6 08             	test   $0x8,%dh
+  802009:	74 15                	je     802020 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80200b:	89 c2                	mov    %eax,%edx
+  80200d:	c1 ea 08             	shr    $0x8,%edx
+  802010:	83 e2 0f             	and    $0xf,%edx
+  802013:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802018:	83 fa 06             	cmp    $0x6,%edx
+  80201b:	74 0e                	je     80202b <sys_shm_remove+0x79>
+  80201d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802020:	0f b6 c9             	movzbl %cl,%ecx
+  802023:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802029:	eb 99                	jmp    801fc4 <sys_shm_remove+0x12>
+  80202b:	89 c2                	mov    %eax,%edx
+  80202d:	c1 ea 04             	shr    $0x4,%edx
+  802030:	83 e2 0f             	and    $0xf,%edx
+  802033:	83 fa 02             	cmp    $0x2,%edx
+  802036:	77 e5                	ja     80201d <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  802038:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80203b:	83 f8 02             	cmp    $0x2,%eax
+  80203e:	0f 97 c1             	seta   %cl
+  802041:	0f b6 c9             	movzbl %cl,%ecx
+  802044:	eb d7                	jmp    80201d <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  802046:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80204b:	b8 18 00 00 00       	mov    $0x18,%eax
+  802050:	8b 55 08             	mov    0x8(%ebp),%edx
+  802053:	89 cb                	mov    %ecx,%ebx
+  802055:	89 cf                	mov    %ecx,%edi
+  802057:	89 ce                	mov    %ecx,%esi
+  802059:	cd 30                	int    $0x30
+  80205b:	eb 91                	jmp    801fee <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80205d:	83 ec 0c             	sub    $0xc,%esp
+  802060:	50                   	push   %eax
+  802061:	6a 18                	push   $0x18
+  802063:	68 79 2b 80 00       	push   $0x802b79
+  802068:	6a 4a                	push   $0x4a
+  80206a:	68 96 2b 80 00       	push   $0x802b96
+  80206f:	e8 6c 05 00 00       	call   8025e0 <_panic>
+
+00802074 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  802074:	55                   	push   %ebp
+  802075:	89 e5                	mov    %esp,%ebp
+  802077:	57                   	push   %edi
+  802078:	56                   	push   %esi
+  802079:	53                   	push   %ebx
+  80207a:	83 ec 0c             	sub    $0xc,%esp
+  80207d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802080:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802083:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  802086:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80208d:	78 32                	js     8020c1 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  80208f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802096:	74 75                	je     80210d <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  802098:	8b 55 08             	mov    0x8(%ebp),%edx
+  80209b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80209e:	b8 20 00 00 00       	mov    $0x20,%eax
+  8020a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8020a8:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8020ab:	55                   	push   %ebp
+  8020ac:	68 b5 20 80 00       	push   $0x8020b5
+  8020b1:	89 e5                	mov    %esp,%ebp
+  8020b3:	0f 34                	sysenter
+  8020b5:	83 c4 04             	add    $0x4,%esp
+  8020b8:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  8020b9:	83 c4 0c             	add    $0xc,%esp
+  8020bc:	5b                   	pop    %ebx
+  8020bd:	5e                   	pop    %esi
+  8020be:	5f                   	pop    %edi
+  8020bf:	5d                   	pop    %ebp
+  8020c0:	c3                   	ret
+  8020c1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020c6:	0f a2                	cpuid
+		return 0;
+  8020c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8020cd:	f6 c6 08             	test   $0x8,%dh
+  8020d0:	74 15                	je     8020e7 <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020d2:	89 c2                	mov    %eax,%edx
+  8020d4:	c1 ea 08             	shr    $0x8,%edx
+  8020d7:	83 e2 0f             	and    $0xf,%edx
+  8020da:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8020df:	83 fa 06             	cmp    $0x6,%edx
+  8020e2:	74 0e                	je     8020f2 <sys_futex_wait+0x7e>
+  8020e4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8020e7:	0f b6 c9             	movzbl %cl,%ecx
+  8020ea:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8020f0:	eb 9d                	jmp    80208f <sys_futex_wait+0x1b>
+  8020f2:	89 c2                	mov    %eax,%edx
+  8020f4:	c1 ea 04             	shr    $0x4,%edx
+  8020f7:	83 e2 0f             	and    $0xf,%edx
+  8020fa:	83 fa 02             	cmp    $0x2,%edx
+  8020fd:	77 e5                	ja     8020e4 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  8020ff:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802102:	83 f8 02             	cmp    $0x2,%eax
+  802105:	0f 97 c1             	seta   %cl
+  802108:	0f b6 c9             	movzbl %cl,%ecx
+  80210b:	eb d7                	jmp    8020e4 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  80210d:	b8 20 00 00 00       	mov    $0x20,%eax
+  802112:	be 00 00 00 00       	mov    $0x0,%esi
+  802117:	8b 55 08             	mov    0x8(%ebp),%edx
+  80211a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80211d:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802120:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  802122:	eb 95                	jmp    8020b9 <sys_futex_wait+0x45>
+
+00802124 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  802124:	55                   	push   %ebp
+  802125:	89 e5                	mov    %esp,%ebp
+  802127:	57                   	push   %edi
+  802128:	56                   	push   %esi
+  802129:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80212a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802131:	78 30                	js     802163 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  802133:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80213a:	74 73                	je     8021af <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  80213c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802141:	8b 55 08             	mov    0x8(%ebp),%edx
+  802144:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802147:	b8 21 00 00 00       	mov    $0x21,%eax
+  80214c:	89 df                	mov    %ebx,%edi
+  80214e:	89 de                	mov    %ebx,%esi
+  802150:	55                   	push   %ebp
+  802151:	68 5a 21 80 00       	push   $0x80215a
+  802156:	89 e5                	mov    %esp,%ebp
+  802158:	0f 34                	sysenter
+  80215a:	83 c4 04             	add    $0x4,%esp
+  80215d:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80215e:	5b                   	pop    %ebx
+  80215f:	5e                   	pop    %esi
+  802160:	5f                   	pop    %edi
+  802161:	5d                   	pop    %ebp
+  802162:	c3                   	ret
+  802163:	b8 01 00 00 00       	mov    $0x1,%eax
+  802168:	0f a2                	cpuid
+		return 0;
+  80216a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80216f:	f6 c6 08             	test   $0x8,%dh
+  802172:	74 15                	je     802189 <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802174:	89 c2                	mov    %eax,%edx
+  802176:	c1 ea 08             	shr    $0x8,%edx
+  802179:	83 e2 0f             	and    $0xf,%edx
+  80217c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802181:	83 fa 06             	cmp    $0x6,%edx
+  802184:	74 0e                	je     802194 <sys_futex_wake+0x70>
+  802186:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802189:	0f b6 c9             	movzbl %cl,%ecx
+  80218c:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802192:	eb 9f                	jmp    802133 <sys_futex_wake+0xf>
+  802194:	89 c2                	mov    %eax,%edx
+  802196:	c1 ea 04             	shr    $0x4,%edx
+  802199:	83 e2 0f             	and    $0xf,%edx
+  80219c:	83 fa 02             	cmp    $0x2,%edx
+  80219f:	77 e5                	ja     802186 <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  8021a1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021a4:	83 f8 02             	cmp    $0x2,%eax
+  8021a7:	0f 97 c1             	seta   %cl
+  8021aa:	0f b6 c9             	movzbl %cl,%ecx
+  8021ad:	eb d7                	jmp    802186 <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  8021af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021b4:	b8 21 00 00 00       	mov    $0x21,%eax
+  8021b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021bf:	89 df                	mov    %ebx,%edi
+  8021c1:	89 de                	mov    %ebx,%esi
+  8021c3:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  8021c5:	eb 97                	jmp    80215e <sys_futex_wake+0x3a>
+
+008021c7 <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  8021c7:	55                   	push   %ebp
+  8021c8:	89 e5                	mov    %esp,%ebp
+  8021ca:	57                   	push   %edi
+  8021cb:	56                   	push   %esi
+  8021cc:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8021cd:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8021d4:	78 2e                	js     802204 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  8021d6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8021dd:	74 71                	je     802250 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  8021df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021e4:	b8 22 00 00 00       	mov    $0x22,%eax
+  8021e9:	89 d1                	mov    %edx,%ecx
+  8021eb:	89 d3                	mov    %edx,%ebx
+  8021ed:	89 d7                	mov    %edx,%edi
+  8021ef:	89 d6                	mov    %edx,%esi
+  8021f1:	55                   	push   %ebp
+  8021f2:	68 fb 21 80 00       	push   $0x8021fb
+  8021f7:	89 e5                	mov    %esp,%ebp
+  8021f9:	0f 34                	sysenter
+  8021fb:	83 c4 04             	add    $0x4,%esp
+  8021fe:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  8021ff:	5b                   	pop    %ebx
+  802200:	5e                   	pop    %esi
+  802201:	5f                   	pop    %edi
+  802202:	5d                   	pop    %ebp
+  802203:	c3                   	ret
+  802204:	b8 01 00 00 00       	mov    $0x1,%eax
+  802209:	0f a2                	cpuid
+		return 0;
+  80220b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802210:	f6 c6 08             	test   $0x8,%dh
+  802213:	74 15                	je     80222a <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802215:	89 c2                	mov    %eax,%edx
+  802217:	c1 ea 08             	shr    $0x8,%edx
+  80221a:	83 e2 0f             	and    $0xf,%edx
+  80221d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802222:	83 fa 06             	cmp    $0x6,%edx
+  802225:	74 0e                	je     802235 <sys_ep_create+0x6e>
+  802227:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80222a:	0f b6 c9             	movzbl %cl,%ecx
+  80222d:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802233:	eb a1                	jmp    8021d6 <sys_ep_create+0xf>
+  802235:	89 c2                	mov    %eax,%edx
+  802237:	c1 ea 04             	shr    $0x4,%edx
+  80223a:	83 e2 0f             	and    $0xf,%edx
+  80223d:	83 fa 02             	cmp    $0x2,%edx
+  802240:	77 e5                	ja     802227 <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  802242:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802245:	83 f8 02             	cmp    $0x2,%eax
+  802248:	0f 97 c1             	seta   %cl
+  80224b:	0f b6 c9             	movzbl %cl,%ecx
+  80224e:	eb d7                	jmp    802227 <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  802250:	ba 00 00 00 00       	mov    $0x0,%edx
+  802255:	b8 22 00 00 00       	mov    $0x22,%eax
+  80225a:	89 d1                	mov    %edx,%ecx
+  80225c:	89 d3                	mov    %edx,%ebx
+  80225e:	89 d7                	mov    %edx,%edi
+  802260:	89 d6                	mov    %edx,%esi
+  802262:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  802264:	eb 99                	jmp    8021ff <sys_ep_create+0x38>
+
+00802266 <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  802266:	55                   	push   %ebp
+  802267:	89 e5                	mov    %esp,%ebp
+  802269:	57                   	push   %edi
+  80226a:	56                   	push   %esi
+  80226b:	53                   	push   %ebx
+  80226c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80226f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802276:	78 36                	js     8022ae <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  802278:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80227f:	74 79                	je     8022fa <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  802281:	8b 55 08             	mov    0x8(%ebp),%edx
+  802284:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802289:	b8 23 00 00 00       	mov    $0x23,%eax
+  80228e:	89 cb                	mov    %ecx,%ebx
+  802290:	89 cf                	mov    %ecx,%edi
+  802292:	89 ce                	mov    %ecx,%esi
+  802294:	55                   	push   %ebp
+  802295:	68 9e 22 80 00       	push   $0x80229e
+  80229a:	89 e5                	mov    %esp,%ebp
+  80229c:	0f 34                	sysenter
+  80229e:	83 c4 04             	add    $0x4,%esp
+  8022a1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8022a2:	85 c0                	test   %eax,%eax
+  8022a4:	7f 6b                	jg     802311 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  8022a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022a9:	5b                   	pop    %ebx
+  8022aa:	5e                   	pop    %esi
+  8022ab:	5f                   	pop    %edi
+  8022ac:	5d                   	pop    %ebp
+  8022ad:	c3                   	ret
+  8022ae:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022b3:	0f a2                	cpuid
+		return 0;
+  8022b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8022ba:	f6 c6 08             	test   $0x8,%dh
+  8022bd:	74 15                	je     8022d4 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022bf:	89 c2                	mov    %eax,%edx
+  8022c1:	c1 ea 08             	shr    $0x8,%edx
+  8022c4:	83 e2 0f             	and    $0xf,%edx
+  8022c7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8022cc:	83 fa 06             	cmp    $0x6,%edx
+  8022cf:	74 0e                	je     8022df <sys_ep_destroy+0x79>
+  8022d1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8022d4:	0f b6 c9             	movzbl %cl,%ecx
+  8022d7:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8022dd:	eb 99                	jmp    802278 <sys_ep_destroy+0x12>
+  8022df:	89 c2                	mov    %eax,%edx
+  8022e1:	c1 ea 04             	shr    $0x4,%edx
+  8022e4:	83 e2 0f             	and    $0xf,%edx
+  8022e7:	83 fa 02             	cmp    $0x2,%edx
+  8022ea:	77 e5                	ja     8022d1 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  8022ec:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022ef:	83 f8 02             	cmp    $0x2,%eax
+  8022f2:	0f 97 c1             	seta   %cl
+  8022f5:	0f b6 c9             	movzbl %cl,%ecx
+  8022f8:	eb d7                	jmp    8022d1 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  8022fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022ff:	b8 23 00 00 00       	mov    $0x23,%eax
+  802304:	8b 55 08             	mov    0x8(%ebp),%edx
+  802307:	89 cb                	mov    %ecx,%ebx
+  802309:	89 cf                	mov    %ecx,%edi
+  80230b:	89 ce                	mov    %ecx,%esi
+  80230d:	cd 30                	int    $0x30
+  80230f:	eb 91                	jmp    8022a2 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802311:	83 ec 0c             	sub    $0xc,%esp
+  802314:	50                   	push   %eax
+  802315:	6a 23                	push   $0x23
+  802317:	68 79 2b 80 00       	push   $0x802b79
+  80231c:	6a 4a                	push   $0x4a
+  80231e:	68 96 2b 80 00       	push   $0x802b96
+  802323:	e8 b8 02 00 00       	call   8025e0 <_panic>
+
+00802328 <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  802328:	55                   	push   %ebp
+  802329:	89 e5                	mov    %esp,%ebp
+  80232b:	57                   	push   %edi
+  80232c:	56                   	push   %esi
+  80232d:	53                   	push   %ebx
+  80232e:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802331:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802338:	78 37                	js     802371 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  80233a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802341:	74 7a                	je     8023bd <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  802343:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802348:	8b 55 08             	mov    0x8(%ebp),%edx
+  80234b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80234e:	b8 24 00 00 00       	mov    $0x24,%eax
+  802353:	89 df                	mov    %ebx,%edi
+  802355:	89 de                	mov    %ebx,%esi
+  802357:	55                   	push   %ebp
+  802358:	68 61 23 80 00       	push   $0x802361
+  80235d:	89 e5                	mov    %esp,%ebp
+  80235f:	0f 34                	sysenter
+  802361:	83 c4 04             	add    $0x4,%esp
+  802364:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802365:	85 c0                	test   %eax,%eax
+  802367:	7f 6c                	jg     8023d5 <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  802369:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80236c:	5b                   	pop    %ebx
+  80236d:	5e                   	pop    %esi
+  80236e:	5f                   	pop    %edi
+  80236f:	5d                   	pop    %ebp
+  802370:	c3                   	ret
+  802371:	b8 01 00 00 00       	mov    $0x1,%eax
+  802376:	0f a2                	cpuid
+		return 0;
+  802378:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80237d:	f6 c6 08             	test   $0x8,%dh
+  802380:	74 15                	je     802397 <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802382:	89 c2                	mov    %eax,%edx
+  802384:	c1 ea 08             	shr    $0x8,%edx
+  802387:	83 e2 0f             	and    $0xf,%edx
+  80238a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80238f:	83 fa 06             	cmp    $0x6,%edx
+  802392:	74 0e                	je     8023a2 <sys_ep_grant+0x7a>
+  802394:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802397:	0f b6 c9             	movzbl %cl,%ecx
+  80239a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8023a0:	eb 98                	jmp    80233a <sys_ep_grant+0x12>
+  8023a2:	89 c2                	mov    %eax,%edx
+  8023a4:	c1 ea 04             	shr    $0x4,%edx
+  8023a7:	83 e2 0f             	and    $0xf,%edx
+  8023aa:	83 fa 02             	cmp    $0x2,%edx
+  8023ad:	77 e5                	ja     802394 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  8023af:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023b2:	83 f8 02             	cmp    $0x2,%eax
+  8023b5:	0f 97 c1             	seta   %cl
+  8023b8:	0f b6 c9             	movzbl %cl,%ecx
+  8023bb:	eb d7                	jmp    802394 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  8023bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023c2:	b8 24 00 00 00       	mov    $0x24,%eax
+  8023c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023cd:	89 df                	mov    %ebx,%edi
+  8023cf:	89 de                	mov    %ebx,%esi
+  8023d1:	cd 30                	int    $0x30
+  8023d3:	eb 90                	jmp    802365 <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8023d5:	83 ec 0c             	sub    $0xc,%esp
+  8023d8:	50                   	push   %eax
+  8023d9:	6a 24                	push   $0x24
+  8023db:	68 79 2b 80 00       	push   $0x802b79
+  8023e0:	6a 4a                	push   $0x4a
+  8023e2:	68 96 2b 80 00       	push   $0x802b96
+  8023e7:	e8 f4 01 00 00       	call   8025e0 <_panic>
+
+008023ec <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  8023ec:	55                   	push   %ebp
+  8023ed:	89 e5                	mov    %esp,%ebp
+  8023ef:	57                   	push   %edi
+  8023f0:	56                   	push   %esi
+  8023f1:	53                   	push   %ebx
+  8023f2:	83 ec 20             	sub    $0x20,%esp
+  8023f5:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  8023f8:	8b 10                	mov    (%eax),%edx
+  8023fa:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8023fd:	8b 50 04             	mov    0x4(%eax),%edx
+  802400:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802403:	8b 50 08             	mov    0x8(%eax),%edx
+  802406:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  802409:	8b 50 0c             	mov    0xc(%eax),%edx
+  80240c:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  80240f:	8b 40 10             	mov    0x10(%eax),%eax
+  802412:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  802415:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  802418:	8b 55 08             	mov    0x8(%ebp),%edx
+  80241b:	b8 25 00 00 00       	mov    $0x25,%eax
+  802420:	55                   	push   %ebp
+  802421:	56                   	push   %esi
+  802422:	8b 0e                	mov    (%esi),%ecx
+  802424:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802427:	8b 7e 08             	mov    0x8(%esi),%edi
+  80242a:	8b 6e 10             	mov    0x10(%esi),%ebp
+  80242d:	8b 76 0c             	mov    0xc(%esi),%esi
+  802430:	cd 30                	int    $0x30
+  802432:	87 34 24             	xchg   %esi,(%esp)
+  802435:	89 0e                	mov    %ecx,(%esi)
+  802437:	89 5e 04             	mov    %ebx,0x4(%esi)
+  80243a:	89 7e 08             	mov    %edi,0x8(%esi)
+  80243d:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802440:	8f 46 0c             	pop    0xc(%esi)
+  802443:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  802444:	83 c4 20             	add    $0x20,%esp
+  802447:	5b                   	pop    %ebx
+  802448:	5e                   	pop    %esi
+  802449:	5f                   	pop    %edi
+  80244a:	5d                   	pop    %ebp
+  80244b:	c3                   	ret
+
+0080244c <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  80244c:	55                   	push   %ebp
+  80244d:	89 e5                	mov    %esp,%ebp
+  80244f:	57                   	push   %edi
+  802450:	56                   	push   %esi
+  802451:	53                   	push   %ebx
+  802452:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  802455:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802458:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  80245a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80245d:	b8 26 00 00 00       	mov    $0x26,%eax
+  802462:	55                   	push   %ebp
+  802463:	56                   	push   %esi
+  802464:	8b 0e                	mov    (%esi),%ecx
+  802466:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802469:	8b 7e 08             	mov    0x8(%esi),%edi
+  80246c:	8b 6e 10             	mov    0x10(%esi),%ebp
+  80246f:	8b 76 0c             	mov    0xc(%esi),%esi
+  802472:	cd 30                	int    $0x30
+  802474:	87 34 24             	xchg   %esi,(%esp)
+  802477:	89 0e                	mov    %ecx,(%esi)
+  802479:	89 5e 04             	mov    %ebx,0x4(%esi)
+  80247c:	89 7e 08             	mov    %edi,0x8(%esi)
+  80247f:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802482:	8f 46 0c             	pop    0xc(%esi)
+  802485:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  802486:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  80248a:	74 0f                	je     80249b <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  80248c:	85 c0                	test   %eax,%eax
+  80248e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802493:	0f 48 d1             	cmovs  %ecx,%edx
+  802496:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  802499:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  80249b:	5b                   	pop    %ebx
+  80249c:	5e                   	pop    %esi
+  80249d:	5f                   	pop    %edi
+  80249e:	5d                   	pop    %ebp
+  80249f:	c3                   	ret
+
+008024a0 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  8024a0:	55                   	push   %ebp
+  8024a1:	89 e5                	mov    %esp,%ebp
+  8024a3:	57                   	push   %edi
+  8024a4:	56                   	push   %esi
+  8024a5:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8024a6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8024ad:	78 2f                	js     8024de <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  8024af:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8024b6:	74 72                	je     80252a <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  8024b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024c0:	b8 27 00 00 00       	mov    $0x27,%eax
+  8024c5:	89 cb                	mov    %ecx,%ebx
+  8024c7:	89 cf                	mov    %ecx,%edi
+  8024c9:	89 ce                	mov    %ecx,%esi
+  8024cb:	55                   	push   %ebp
+  8024cc:	68 d5 24 80 00       	push   $0x8024d5
+  8024d1:	89 e5                	mov    %esp,%ebp
+  8024d3:	0f 34                	sysenter
+  8024d5:	83 c4 04             	add    $0x4,%esp
+  8024d8:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  8024d9:	5b                   	pop    %ebx
+  8024da:	5e                   	pop    %esi
+  8024db:	5f                   	pop    %edi
+  8024dc:	5d                   	pop    %ebp
+  8024dd:	c3                   	ret
+  8024de:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024e3:	0f a2                	cpuid
+		return 0;
+  8024e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8024ea:	f6 c6 08             	test   $0x8,%dh
+  8024ed:	74 15                	je     802504 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8024ef:	89 c2                	mov    %eax,%edx
+  8024f1:	c1 ea 08             	shr    $0x8,%edx
+  8024f4:	83 e2 0f             	and    $0xf,%edx
+  8024f7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8024fc:	83 fa 06             	cmp    $0x6,%edx
+  8024ff:	74 0e                	je     80250f <sys_sysring_setup+0x6f>
+  802501:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802504:	0f b6 c9             	movzbl %cl,%ecx
+  802507:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80250d:	eb a0                	jmp    8024af <sys_sysring_setup+0xf>
+  80250f:	89 c2                	mov    %eax,%edx
+  802511:	c1 ea 04             	shr    $0x4,%edx
+  802514:	83 e2 0f             	and    $0xf,%edx
+  802517:	83 fa 02             	cmp    $0x2,%edx
+  80251a:	77 e5                	ja     802501 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  80251c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80251f:	83 f8 02             	cmp    $0x2,%eax
+  802522:	0f 97 c1             	seta   %cl
+  802525:	0f b6 c9             	movzbl %cl,%ecx
+  802528:	eb d7                	jmp    802501 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  80252a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80252f:	b8 27 00 00 00       	mov    $0x27,%eax
+  802534:	8b 55 08             	mov    0x8(%ebp),%edx
+  802537:	89 cb                	mov    %ecx,%ebx
+  802539:	89 cf                	mov    %ecx,%edi
+  80253b:	89 ce                	mov    %ecx,%esi
+  80253d:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  80253f:	eb 98                	jmp    8024d9 <sys_sysring_setup+0x39>
+
+00802541 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  802541:	55                   	push   %ebp
+  802542:	89 e5                	mov    %esp,%ebp
+  802544:	57                   	push   %edi
+  802545:	56                   	push   %esi
+  802546:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802547:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80254e:	78 2e                	js     80257e <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  802550:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802557:	74 71                	je     8025ca <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  802559:	ba 00 00 00 00       	mov    $0x0,%edx
+  80255e:	b8 28 00 00 00       	mov    $0x28,%eax
+  802563:	89 d1                	mov    %edx,%ecx
+  802565:	89 d3                	mov    %edx,%ebx
+  802567:	89 d7                	mov    %edx,%edi
+  802569:	89 d6                	mov    %edx,%esi
+  80256b:	55                   	push   %ebp
+  80256c:	68 75 25 80 00       	push   $0x802575
+  802571:	89 e5                	mov    %esp,%ebp
+  802573:	0f 34                	sysenter
+  802575:	83 c4 04             	add    $0x4,%esp
+  802578:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  802579:	5b                   	pop    %ebx
+  80257a:	5e                   	pop    %esi
+  80257b:	5f                   	pop    %edi
+  80257c:	5d                   	pop    %ebp
+  80257d:	c3                   	ret
+  80257e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802583:	0f a2                	cpuid
+		return 0;
+  802585:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80258a:	f6 c6 08             	test   $0x8,%dh
+  80258d:	74 15                	je     8025a4 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80258f:	89 c2                	mov    %eax,%edx
+  802591:	c1 ea 08             	shr    $0x8,%edx
+  802594:	83 e2 0f             	and    $0xf,%edx
+  802597:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80259c:	83 fa 06             	cmp    $0x6,%edx
+  80259f:	74 0e                	je     8025af <sys_sysring_enter+0x6e>
+  8025a1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8025a4:	0f b6 c9             	movzbl %cl,%ecx
+  8025a7:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8025ad:	eb a1                	jmp    802550 <sys_sysring_enter+0xf>
+  8025af:	89 c2                	mov    %eax,%edx
+  8025b1:	c1 ea 04             	shr    $0x4,%edx
+  8025b4:	83 e2 0f             	and    $0xf,%edx
+  8025b7:	83 fa 02             	cmp    $0x2,%edx
+  8025ba:	77 e5                	ja     8025a1 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  8025bc:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025bf:	83 f8 02             	cmp    $0x2,%eax
+  8025c2:	0f 97 c1             	seta   %cl
+  8025c5:	0f b6 c9             	movzbl %cl,%ecx
+  8025c8:	eb d7                	jmp    8025a1 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  8025ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025cf:	b8 28 00 00 00       	mov    $0x28,%eax
+  8025d4:	89 d1                	mov    %edx,%ecx
+  8025d6:	89 d3                	mov    %edx,%ebx
+  8025d8:	89 d7                	mov    %edx,%edi
+  8025da:	89 d6                	mov    %edx,%esi
+  8025dc:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  8025de:	eb 99                	jmp    802579 <sys_sysring_enter+0x38>
+
+008025e0 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8025e0:	55                   	push   %ebp
+  8025e1:	89 e5                	mov    %esp,%ebp
+  8025e3:	57                   	push   %edi
+  8025e4:	56                   	push   %esi
+  8025e5:	53                   	push   %ebx
+  8025e6:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  8025ec:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  8025ef:	8b 1d 00 30 80 00    	mov    0x803000,%ebx
+  8025f5:	e8 c8 e8 ff ff       	call   800ec2 <sys_getenvid>
+  8025fa:	83 ec 04             	sub    $0x4,%esp
+  8025fd:	ff 75 0c             	push   0xc(%ebp)
+  802600:	ff 75 08             	push   0x8(%ebp)
+  802603:	53                   	push   %ebx
+  802604:	50                   	push   %eax
+  802605:	68 a4 2b 80 00       	push   $0x802ba4
+  80260a:	68 00 01 00 00       	push   $0x100
+  80260f:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  802615:	56                   	push   %esi
+  802616:	e8 bc e0 ff ff       	call   8006d7 <snprintf>
+  80261b:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  80261d:	83 c4 20             	add    $0x20,%esp
+  802620:	57                   	push   %edi
+  802621:	ff 75 10             	push   0x10(%ebp)
+  802624:	bf 00 01 00 00       	mov    $0x100,%edi
+  802629:	89 f8                	mov    %edi,%eax
+  80262b:	29 d8                	sub    %ebx,%eax
+  80262d:	50                   	push   %eax
+  80262e:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  802631:	50                   	push   %eax
+  802632:	e8 52 e0 ff ff       	call   800689 <vsnprintf>
+  802637:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  802639:	83 c4 0c             	add    $0xc,%esp
+  80263c:	68 c7 2b 80 00       	push   $0x802bc7
+  802641:	29 df                	sub    %ebx,%edi
+  802643:	57                   	push   %edi
+  802644:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  802647:	50                   	push   %eax
+  802648:	e8 8a e0 ff ff       	call   8006d7 <snprintf>
+	sys_cputs(buf, r);
+  80264d:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  802650:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  802652:	53                   	push   %ebx
+  802653:	56                   	push   %esi
+  802654:	e8 6b e6 ff ff       	call   800cc4 <sys_cputs>
+  802659:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80265c:	cc                   	int3
+	while (1)
+  80265d:	eb fd                	jmp    80265c <_panic+0x7c>
+
+0080265f <dm>:
+  80265f:	55                   	push   %ebp
+  802660:	57                   	push   %edi
+  802661:	56                   	push   %esi
+  802662:	53                   	push   %ebx
+  802663:	83 ec 24             	sub    $0x24,%esp
+  802666:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80266a:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80266e:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802672:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802676:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80267a:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80267e:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802682:	b8 00 00 00 00       	mov    $0x0,%eax
+  802687:	ba 00 00 00 00       	mov    $0x0,%edx
+  80268c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802691:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802698:	00 
+  802699:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8026a0:	00 
+  8026a1:	89 fb                	mov    %edi,%ebx
+  8026a3:	eb 08                	jmp    8026ad <dm+0x4e>
+  8026a5:	83 e9 01             	sub    $0x1,%ecx
+  8026a8:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8026ab:	74 68                	je     802715 <dm+0xb6>
+  8026ad:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8026b1:	01 c0                	add    %eax,%eax
+  8026b3:	89 c6                	mov    %eax,%esi
+  8026b5:	89 d7                	mov    %edx,%edi
+  8026b7:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8026bb:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026bf:	0f ad d0             	shrd   %cl,%edx,%eax
+  8026c2:	d3 ea                	shr    %cl,%edx
+  8026c4:	f6 c1 20             	test   $0x20,%cl
+  8026c7:	74 04                	je     8026cd <dm+0x6e>
+  8026c9:	89 d0                	mov    %edx,%eax
+  8026cb:	31 d2                	xor    %edx,%edx
+  8026cd:	83 e0 01             	and    $0x1,%eax
+  8026d0:	89 04 24             	mov    %eax,(%esp)
+  8026d3:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8026da:	00 
+  8026db:	8b 04 24             	mov    (%esp),%eax
+  8026de:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8026e2:	09 f0                	or     %esi,%eax
+  8026e4:	09 fa                	or     %edi,%edx
+  8026e6:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8026ea:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8026ee:	39 f0                	cmp    %esi,%eax
+  8026f0:	89 d5                	mov    %edx,%ebp
+  8026f2:	19 fd                	sbb    %edi,%ebp
+  8026f4:	72 af                	jb     8026a5 <dm+0x46>
+  8026f6:	29 f0                	sub    %esi,%eax
+  8026f8:	19 fa                	sbb    %edi,%edx
+  8026fa:	89 cf                	mov    %ecx,%edi
+  8026fc:	c1 ef 05             	shr    $0x5,%edi
+  8026ff:	83 e7 01             	and    $0x1,%edi
+  802702:	89 fe                	mov    %edi,%esi
+  802704:	83 f6 01             	xor    $0x1,%esi
+  802707:	d3 e6                	shl    %cl,%esi
+  802709:	d3 e7                	shl    %cl,%edi
+  80270b:	09 74 24 18          	or     %esi,0x18(%esp)
+  80270f:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802713:	eb 90                	jmp    8026a5 <dm+0x46>
+  802715:	85 db                	test   %ebx,%ebx
+  802717:	74 05                	je     80271e <dm+0xbf>
+  802719:	89 03                	mov    %eax,(%ebx)
+  80271b:	89 53 04             	mov    %edx,0x4(%ebx)
+  80271e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802722:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802726:	83 c4 24             	add    $0x24,%esp
+  802729:	5b                   	pop    %ebx
+  80272a:	5e                   	pop    %esi
+  80272b:	5f                   	pop    %edi
+  80272c:	5d                   	pop    %ebp
+  80272d:	c3                   	ret
+
+0080272e <__udivdi3>:
+  80272e:	83 ec 08             	sub    $0x8,%esp
+  802731:	6a 00                	push   $0x0
+  802733:	ff 74 24 1c          	push   0x1c(%esp)
+  802737:	ff 74 24 1c          	push   0x1c(%esp)
+  80273b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80273f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802743:	e8 17 ff ff ff       	call   80265f <dm>
+  802748:	83 c4 14             	add    $0x14,%esp
+  80274b:	c3                   	ret
+
+0080274c <__umoddi3>:
+  80274c:	83 ec 18             	sub    $0x18,%esp
+  80274f:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802753:	50                   	push   %eax
+  802754:	ff 74 24 2c          	push   0x2c(%esp)
+  802758:	ff 74 24 2c          	push   0x2c(%esp)
+  80275c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802760:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802764:	e8 f6 fe ff ff       	call   80265f <dm>
+  802769:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80276d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802771:	83 c4 24             	add    $0x24,%esp
+  802774:	c3                   	ret
+
+00802775 <__divdi3>:
+  802775:	53                   	push   %ebx
+  802776:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80277a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80277e:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  802782:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  802786:	85 d2                	test   %edx,%edx
+  802788:	78 15                	js     80279f <__divdi3+0x2a>
+  80278a:	85 db                	test   %ebx,%ebx
+  80278c:	78 34                	js     8027c2 <__divdi3+0x4d>
+  80278e:	83 ec 04             	sub    $0x4,%esp
+  802791:	6a 00                	push   $0x0
+  802793:	53                   	push   %ebx
+  802794:	51                   	push   %ecx
+  802795:	e8 c5 fe ff ff       	call   80265f <dm>
+  80279a:	83 c4 10             	add    $0x10,%esp
+  80279d:	eb 21                	jmp    8027c0 <__divdi3+0x4b>
+  80279f:	f7 d8                	neg    %eax
+  8027a1:	83 d2 00             	adc    $0x0,%edx
+  8027a4:	f7 da                	neg    %edx
+  8027a6:	85 db                	test   %ebx,%ebx
+  8027a8:	78 30                	js     8027da <__divdi3+0x65>
+  8027aa:	83 ec 04             	sub    $0x4,%esp
+  8027ad:	6a 00                	push   $0x0
+  8027af:	53                   	push   %ebx
+  8027b0:	51                   	push   %ecx
+  8027b1:	e8 a9 fe ff ff       	call   80265f <dm>
+  8027b6:	83 c4 10             	add    $0x10,%esp
+  8027b9:	f7 d8                	neg    %eax
+  8027bb:	83 d2 00             	adc    $0x0,%edx
+  8027be:	f7 da                	neg    %edx
+  8027c0:	5b                   	pop    %ebx
+  8027c1:	c3                   	ret
+  8027c2:	83 ec 04             	sub    $0x4,%esp
+  8027c5:	6a 00                	push   $0x0
+  8027c7:	f7 d9                	neg    %ecx
+  8027c9:	83 d3 00             	adc    $0x0,%ebx
+  8027cc:	f7 db                	neg    %ebx
+  8027ce:	53                   	push   %ebx
+  8027cf:	51                   	push   %ecx
+  8027d0:	e8 8a fe ff ff       	call   80265f <dm>
+  8027d5:	83 c4 10             	add    $0x10,%esp
+  8027d8:	eb df                	jmp    8027b9 <__divdi3+0x44>
+  8027da:	83 ec 04             	sub    $0x4,%esp
+  8027dd:	6a 00                	push   $0x0
+  8027df:	f7 d9                	neg    %ecx
+  8027e1:	83 d3 00             	adc    $0x0,%ebx
+  8027e4:	f7 db                	neg    %ebx
+  8027e6:	53                   	push   %ebx
+  8027e7:	51                   	push   %ecx
+  8027e8:	e8 72 fe ff ff       	call   80265f <dm>
+  8027ed:	83 c4 10             	add    $0x10,%esp
+  8027f0:	eb ce                	jmp    8027c0 <__divdi3+0x4b>
+
+008027f2 <__moddi3>:
+  8027f2:	55                   	push   %ebp
+  8027f3:	57                   	push   %edi
+  8027f4:	56                   	push   %esi
+  8027f5:	53                   	push   %ebx
+  8027f6:	83 ec 18             	sub    $0x18,%esp
+  8027f9:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  8027fd:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802801:	89 f1                	mov    %esi,%ecx
+  802803:	f7 d9                	neg    %ecx
+  802805:	89 da                	mov    %ebx,%edx
+  802807:	83 d2 00             	adc    $0x0,%edx
+  80280a:	f7 da                	neg    %edx
+  80280c:	0f 48 ce             	cmovs  %esi,%ecx
+  80280f:	0f 48 d3             	cmovs  %ebx,%edx
+  802812:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802816:	50                   	push   %eax
+  802817:	8b 74 24 38          	mov    0x38(%esp),%esi
+  80281b:	f7 de                	neg    %esi
+  80281d:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802821:	83 d0 00             	adc    $0x0,%eax
+  802824:	f7 d8                	neg    %eax
+  802826:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  80282b:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802830:	50                   	push   %eax
+  802831:	56                   	push   %esi
+  802832:	89 c8                	mov    %ecx,%eax
+  802834:	e8 26 fe ff ff       	call   80265f <dm>
+  802839:	83 c4 10             	add    $0x10,%esp
+  80283c:	85 db                	test   %ebx,%ebx
+  80283e:	78 10                	js     802850 <__moddi3+0x5e>
+  802840:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802844:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802848:	83 c4 14             	add    $0x14,%esp
+  80284b:	5b                   	pop    %ebx
+  80284c:	5e                   	pop    %esi
+  80284d:	5f                   	pop    %edi
+  80284e:	5d                   	pop    %ebp
+  80284f:	c3                   	ret
+  802850:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802854:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802858:	f7 d8                	neg    %eax
+  80285a:	83 d2 00             	adc    $0x0,%edx
+  80285d:	f7 da                	neg    %edx
+  80285f:	eb e7                	jmp    802848 <__moddi3+0x56>
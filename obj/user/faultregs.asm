@@ -0,0 +1,5698 @@
+
+obj/user/faultregs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 b0 05 00 00       	call   8005e1 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <check_regs>:
+static struct regs before, during, after;
+
+static void
+check_regs(struct regs* a, const char *an, struct regs* b, const char *bn,
+	   const char *testname)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 0c             	sub    $0xc,%esp
+  80003c:	89 c6                	mov    %eax,%esi
+  80003e:	89 cb                	mov    %ecx,%ebx
+	int mismatch = 0;
+
+	cprintf("%-6s %-8s %-8s\n", "", an, bn);
+  800040:	ff 75 08             	push   0x8(%ebp)
+  800043:	52                   	push   %edx
+  800044:	68 d1 2e 80 00       	push   $0x802ed1
+  800049:	68 a0 2e 80 00       	push   $0x802ea0
+  80004e:	e8 fd 06 00 00       	call   800750 <cprintf>
+			cprintf("MISMATCH\n");				\
+			mismatch = 1;					\
+		}							\
+	} while (0)
+
+	CHECK(edi, regs.reg_edi);
+  800053:	ff 33                	push   (%ebx)
+  800055:	ff 36                	push   (%esi)
+  800057:	68 b0 2e 80 00       	push   $0x802eb0
+  80005c:	68 b4 2e 80 00       	push   $0x802eb4
+  800061:	e8 ea 06 00 00       	call   800750 <cprintf>
+  800066:	83 c4 20             	add    $0x20,%esp
+  800069:	8b 03                	mov    (%ebx),%eax
+  80006b:	39 06                	cmp    %eax,(%esi)
+  80006d:	0f 84 2e 02 00 00    	je     8002a1 <check_regs+0x26e>
+  800073:	83 ec 0c             	sub    $0xc,%esp
+  800076:	68 c8 2e 80 00       	push   $0x802ec8
+  80007b:	e8 d0 06 00 00       	call   800750 <cprintf>
+  800080:	83 c4 10             	add    $0x10,%esp
+  800083:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(esi, regs.reg_esi);
+  800088:	ff 73 04             	push   0x4(%ebx)
+  80008b:	ff 76 04             	push   0x4(%esi)
+  80008e:	68 d2 2e 80 00       	push   $0x802ed2
+  800093:	68 b4 2e 80 00       	push   $0x802eb4
+  800098:	e8 b3 06 00 00       	call   800750 <cprintf>
+  80009d:	83 c4 10             	add    $0x10,%esp
+  8000a0:	8b 43 04             	mov    0x4(%ebx),%eax
+  8000a3:	39 46 04             	cmp    %eax,0x4(%esi)
+  8000a6:	0f 84 0f 02 00 00    	je     8002bb <check_regs+0x288>
+  8000ac:	83 ec 0c             	sub    $0xc,%esp
+  8000af:	68 c8 2e 80 00       	push   $0x802ec8
+  8000b4:	e8 97 06 00 00       	call   800750 <cprintf>
+  8000b9:	83 c4 10             	add    $0x10,%esp
+  8000bc:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(ebp, regs.reg_ebp);
+  8000c1:	ff 73 08             	push   0x8(%ebx)
+  8000c4:	ff 76 08             	push   0x8(%esi)
+  8000c7:	68 d6 2e 80 00       	push   $0x802ed6
+  8000cc:	68 b4 2e 80 00       	push   $0x802eb4
+  8000d1:	e8 7a 06 00 00       	call   800750 <cprintf>
+  8000d6:	83 c4 10             	add    $0x10,%esp
+  8000d9:	8b 43 08             	mov    0x8(%ebx),%eax
+  8000dc:	39 46 08             	cmp    %eax,0x8(%esi)
+  8000df:	0f 84 eb 01 00 00    	je     8002d0 <check_regs+0x29d>
+  8000e5:	83 ec 0c             	sub    $0xc,%esp
+  8000e8:	68 c8 2e 80 00       	push   $0x802ec8
+  8000ed:	e8 5e 06 00 00       	call   800750 <cprintf>
+  8000f2:	83 c4 10             	add    $0x10,%esp
+  8000f5:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(ebx, regs.reg_ebx);
+  8000fa:	ff 73 10             	push   0x10(%ebx)
+  8000fd:	ff 76 10             	push   0x10(%esi)
+  800100:	68 da 2e 80 00       	push   $0x802eda
+  800105:	68 b4 2e 80 00       	push   $0x802eb4
+  80010a:	e8 41 06 00 00       	call   800750 <cprintf>
+  80010f:	83 c4 10             	add    $0x10,%esp
+  800112:	8b 43 10             	mov    0x10(%ebx),%eax
+  800115:	39 46 10             	cmp    %eax,0x10(%esi)
+  800118:	0f 84 c7 01 00 00    	je     8002e5 <check_regs+0x2b2>
+  80011e:	83 ec 0c             	sub    $0xc,%esp
+  800121:	68 c8 2e 80 00       	push   $0x802ec8
+  800126:	e8 25 06 00 00       	call   800750 <cprintf>
+  80012b:	83 c4 10             	add    $0x10,%esp
+  80012e:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(edx, regs.reg_edx);
+  800133:	ff 73 14             	push   0x14(%ebx)
+  800136:	ff 76 14             	push   0x14(%esi)
+  800139:	68 de 2e 80 00       	push   $0x802ede
+  80013e:	68 b4 2e 80 00       	push   $0x802eb4
+  800143:	e8 08 06 00 00       	call   800750 <cprintf>
+  800148:	83 c4 10             	add    $0x10,%esp
+  80014b:	8b 43 14             	mov    0x14(%ebx),%eax
+  80014e:	39 46 14             	cmp    %eax,0x14(%esi)
+  800151:	0f 84 a3 01 00 00    	je     8002fa <check_regs+0x2c7>
+  800157:	83 ec 0c             	sub    $0xc,%esp
+  80015a:	68 c8 2e 80 00       	push   $0x802ec8
+  80015f:	e8 ec 05 00 00       	call   800750 <cprintf>
+  800164:	83 c4 10             	add    $0x10,%esp
+  800167:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(ecx, regs.reg_ecx);
+  80016c:	ff 73 18             	push   0x18(%ebx)
+  80016f:	ff 76 18             	push   0x18(%esi)
+  800172:	68 e2 2e 80 00       	push   $0x802ee2
+  800177:	68 b4 2e 80 00       	push   $0x802eb4
+  80017c:	e8 cf 05 00 00       	call   800750 <cprintf>
+  800181:	83 c4 10             	add    $0x10,%esp
+  800184:	8b 43 18             	mov    0x18(%ebx),%eax
+  800187:	39 46 18             	cmp    %eax,0x18(%esi)
+  80018a:	0f 84 7f 01 00 00    	je     80030f <check_regs+0x2dc>
+  800190:	83 ec 0c             	sub    $0xc,%esp
+  800193:	68 c8 2e 80 00       	push   $0x802ec8
+  800198:	e8 b3 05 00 00       	call   800750 <cprintf>
+  80019d:	83 c4 10             	add    $0x10,%esp
+  8001a0:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(eax, regs.reg_eax);
+  8001a5:	ff 73 1c             	push   0x1c(%ebx)
+  8001a8:	ff 76 1c             	push   0x1c(%esi)
+  8001ab:	68 e6 2e 80 00       	push   $0x802ee6
+  8001b0:	68 b4 2e 80 00       	push   $0x802eb4
+  8001b5:	e8 96 05 00 00       	call   800750 <cprintf>
+  8001ba:	83 c4 10             	add    $0x10,%esp
+  8001bd:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8001c0:	39 46 1c             	cmp    %eax,0x1c(%esi)
+  8001c3:	0f 84 5b 01 00 00    	je     800324 <check_regs+0x2f1>
+  8001c9:	83 ec 0c             	sub    $0xc,%esp
+  8001cc:	68 c8 2e 80 00       	push   $0x802ec8
+  8001d1:	e8 7a 05 00 00       	call   800750 <cprintf>
+  8001d6:	83 c4 10             	add    $0x10,%esp
+  8001d9:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(eip, eip);
+  8001de:	ff 73 20             	push   0x20(%ebx)
+  8001e1:	ff 76 20             	push   0x20(%esi)
+  8001e4:	68 ea 2e 80 00       	push   $0x802eea
+  8001e9:	68 b4 2e 80 00       	push   $0x802eb4
+  8001ee:	e8 5d 05 00 00       	call   800750 <cprintf>
+  8001f3:	83 c4 10             	add    $0x10,%esp
+  8001f6:	8b 43 20             	mov    0x20(%ebx),%eax
+  8001f9:	39 46 20             	cmp    %eax,0x20(%esi)
+  8001fc:	0f 84 37 01 00 00    	je     800339 <check_regs+0x306>
+  800202:	83 ec 0c             	sub    $0xc,%esp
+  800205:	68 c8 2e 80 00       	push   $0x802ec8
+  80020a:	e8 41 05 00 00       	call   800750 <cprintf>
+  80020f:	83 c4 10             	add    $0x10,%esp
+  800212:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(eflags, eflags);
+  800217:	ff 73 24             	push   0x24(%ebx)
+  80021a:	ff 76 24             	push   0x24(%esi)
+  80021d:	68 ee 2e 80 00       	push   $0x802eee
+  800222:	68 b4 2e 80 00       	push   $0x802eb4
+  800227:	e8 24 05 00 00       	call   800750 <cprintf>
+  80022c:	83 c4 10             	add    $0x10,%esp
+  80022f:	8b 43 24             	mov    0x24(%ebx),%eax
+  800232:	39 46 24             	cmp    %eax,0x24(%esi)
+  800235:	0f 84 13 01 00 00    	je     80034e <check_regs+0x31b>
+  80023b:	83 ec 0c             	sub    $0xc,%esp
+  80023e:	68 c8 2e 80 00       	push   $0x802ec8
+  800243:	e8 08 05 00 00       	call   800750 <cprintf>
+	CHECK(esp, esp);
+  800248:	ff 73 28             	push   0x28(%ebx)
+  80024b:	ff 76 28             	push   0x28(%esi)
+  80024e:	68 f5 2e 80 00       	push   $0x802ef5
+  800253:	68 b4 2e 80 00       	push   $0x802eb4
+  800258:	e8 f3 04 00 00       	call   800750 <cprintf>
+  80025d:	83 c4 20             	add    $0x20,%esp
+  800260:	8b 43 28             	mov    0x28(%ebx),%eax
+  800263:	39 46 28             	cmp    %eax,0x28(%esi)
+  800266:	0f 84 53 01 00 00    	je     8003bf <check_regs+0x38c>
+  80026c:	83 ec 0c             	sub    $0xc,%esp
+  80026f:	68 c8 2e 80 00       	push   $0x802ec8
+  800274:	e8 d7 04 00 00       	call   800750 <cprintf>
+
+#undef CHECK
+
+	cprintf("Registers %s ", testname);
+  800279:	83 c4 08             	add    $0x8,%esp
+  80027c:	ff 75 0c             	push   0xc(%ebp)
+  80027f:	68 f9 2e 80 00       	push   $0x802ef9
+  800284:	e8 c7 04 00 00       	call   800750 <cprintf>
+  800289:	83 c4 10             	add    $0x10,%esp
+	if (!mismatch)
+		cprintf("OK\n");
+	else
+		cprintf("MISMATCH\n");
+  80028c:	83 ec 0c             	sub    $0xc,%esp
+  80028f:	68 c8 2e 80 00       	push   $0x802ec8
+  800294:	e8 b7 04 00 00       	call   800750 <cprintf>
+  800299:	83 c4 10             	add    $0x10,%esp
+}
+  80029c:	e9 16 01 00 00       	jmp    8003b7 <check_regs+0x384>
+	CHECK(edi, regs.reg_edi);
+  8002a1:	83 ec 0c             	sub    $0xc,%esp
+  8002a4:	68 c4 2e 80 00       	push   $0x802ec4
+  8002a9:	e8 a2 04 00 00       	call   800750 <cprintf>
+  8002ae:	83 c4 10             	add    $0x10,%esp
+	int mismatch = 0;
+  8002b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002b6:	e9 cd fd ff ff       	jmp    800088 <check_regs+0x55>
+	CHECK(esi, regs.reg_esi);
+  8002bb:	83 ec 0c             	sub    $0xc,%esp
+  8002be:	68 c4 2e 80 00       	push   $0x802ec4
+  8002c3:	e8 88 04 00 00       	call   800750 <cprintf>
+  8002c8:	83 c4 10             	add    $0x10,%esp
+  8002cb:	e9 f1 fd ff ff       	jmp    8000c1 <check_regs+0x8e>
+	CHECK(ebp, regs.reg_ebp);
+  8002d0:	83 ec 0c             	sub    $0xc,%esp
+  8002d3:	68 c4 2e 80 00       	push   $0x802ec4
+  8002d8:	e8 73 04 00 00       	call   800750 <cprintf>
+  8002dd:	83 c4 10             	add    $0x10,%esp
+  8002e0:	e9 15 fe ff ff       	jmp    8000fa <check_regs+0xc7>
+	CHECK(ebx, regs.reg_ebx);
+  8002e5:	83 ec 0c             	sub    $0xc,%esp
+  8002e8:	68 c4 2e 80 00       	push   $0x802ec4
+  8002ed:	e8 5e 04 00 00       	call   800750 <cprintf>
+  8002f2:	83 c4 10             	add    $0x10,%esp
+  8002f5:	e9 39 fe ff ff       	jmp    800133 <check_regs+0x100>
+	CHECK(edx, regs.reg_edx);
+  8002fa:	83 ec 0c             	sub    $0xc,%esp
+  8002fd:	68 c4 2e 80 00       	push   $0x802ec4
+  800302:	e8 49 04 00 00       	call   800750 <cprintf>
+  800307:	83 c4 10             	add    $0x10,%esp
+  80030a:	e9 5d fe ff ff       	jmp    80016c <check_regs+0x139>
+	CHECK(ecx, regs.reg_ecx);
+  80030f:	83 ec 0c             	sub    $0xc,%esp
+  800312:	68 c4 2e 80 00       	push   $0x802ec4
+  800317:	e8 34 04 00 00       	call   800750 <cprintf>
+  80031c:	83 c4 10             	add    $0x10,%esp
+  80031f:	e9 81 fe ff ff       	jmp    8001a5 <check_regs+0x172>
+	CHECK(eax, regs.reg_eax);
+  800324:	83 ec 0c             	sub    $0xc,%esp
+  800327:	68 c4 2e 80 00       	push   $0x802ec4
+  80032c:	e8 1f 04 00 00       	call   800750 <cprintf>
+  800331:	83 c4 10             	add    $0x10,%esp
+  800334:	e9 a5 fe ff ff       	jmp    8001de <check_regs+0x1ab>
+	CHECK(eip, eip);
+  800339:	83 ec 0c             	sub    $0xc,%esp
+  80033c:	68 c4 2e 80 00       	push   $0x802ec4
+  800341:	e8 0a 04 00 00       	call   800750 <cprintf>
+  800346:	83 c4 10             	add    $0x10,%esp
+  800349:	e9 c9 fe ff ff       	jmp    800217 <check_regs+0x1e4>
+	CHECK(eflags, eflags);
+  80034e:	83 ec 0c             	sub    $0xc,%esp
+  800351:	68 c4 2e 80 00       	push   $0x802ec4
+  800356:	e8 f5 03 00 00       	call   800750 <cprintf>
+	CHECK(esp, esp);
+  80035b:	ff 73 28             	push   0x28(%ebx)
+  80035e:	ff 76 28             	push   0x28(%esi)
+  800361:	68 f5 2e 80 00       	push   $0x802ef5
+  800366:	68 b4 2e 80 00       	push   $0x802eb4
+  80036b:	e8 e0 03 00 00       	call   800750 <cprintf>
+  800370:	83 c4 20             	add    $0x20,%esp
+  800373:	8b 43 28             	mov    0x28(%ebx),%eax
+  800376:	39 46 28             	cmp    %eax,0x28(%esi)
+  800379:	0f 85 ed fe ff ff    	jne    80026c <check_regs+0x239>
+  80037f:	83 ec 0c             	sub    $0xc,%esp
+  800382:	68 c4 2e 80 00       	push   $0x802ec4
+  800387:	e8 c4 03 00 00       	call   800750 <cprintf>
+	cprintf("Registers %s ", testname);
+  80038c:	83 c4 08             	add    $0x8,%esp
+  80038f:	ff 75 0c             	push   0xc(%ebp)
+  800392:	68 f9 2e 80 00       	push   $0x802ef9
+  800397:	e8 b4 03 00 00       	call   800750 <cprintf>
+	if (!mismatch)
+  80039c:	83 c4 10             	add    $0x10,%esp
+  80039f:	85 ff                	test   %edi,%edi
+  8003a1:	0f 85 e5 fe ff ff    	jne    80028c <check_regs+0x259>
+		cprintf("OK\n");
+  8003a7:	83 ec 0c             	sub    $0xc,%esp
+  8003aa:	68 c4 2e 80 00       	push   $0x802ec4
+  8003af:	e8 9c 03 00 00       	call   800750 <cprintf>
+  8003b4:	83 c4 10             	add    $0x10,%esp
+}
+  8003b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003ba:	5b                   	pop    %ebx
+  8003bb:	5e                   	pop    %esi
+  8003bc:	5f                   	pop    %edi
+  8003bd:	5d                   	pop    %ebp
+  8003be:	c3                   	ret
+	CHECK(esp, esp);
+  8003bf:	83 ec 0c             	sub    $0xc,%esp
+  8003c2:	68 c4 2e 80 00       	push   $0x802ec4
+  8003c7:	e8 84 03 00 00       	call   800750 <cprintf>
+	cprintf("Registers %s ", testname);
+  8003cc:	83 c4 08             	add    $0x8,%esp
+  8003cf:	ff 75 0c             	push   0xc(%ebp)
+  8003d2:	68 f9 2e 80 00       	push   $0x802ef9
+  8003d7:	e8 74 03 00 00       	call   800750 <cprintf>
+  8003dc:	83 c4 10             	add    $0x10,%esp
+  8003df:	e9 a8 fe ff ff       	jmp    80028c <check_regs+0x259>
+
+008003e4 <pgfault>:
+
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8003e4:	55                   	push   %ebp
+  8003e5:	89 e5                	mov    %esp,%ebp
+  8003e7:	83 ec 08             	sub    $0x8,%esp
+  8003ea:	8b 45 08             	mov    0x8(%ebp),%eax
+	int r;
+
+	if (utf->utf_fault_va != (uint32_t)UTEMP)
+  8003ed:	8b 10                	mov    (%eax),%edx
+  8003ef:	81 fa 00 00 40 00    	cmp    $0x400000,%edx
+  8003f5:	0f 85 a3 00 00 00    	jne    80049e <pgfault+0xba>
+		panic("pgfault expected at UTEMP, got 0x%08x (eip %08x)",
+		      utf->utf_fault_va, utf->utf_eip);
+
+	// Check registers in UTrapframe
+	during.regs = utf->utf_regs;
+  8003fb:	8b 50 08             	mov    0x8(%eax),%edx
+  8003fe:	89 15 60 40 80 00    	mov    %edx,0x804060
+  800404:	8b 50 0c             	mov    0xc(%eax),%edx
+  800407:	89 15 64 40 80 00    	mov    %edx,0x804064
+  80040d:	8b 50 10             	mov    0x10(%eax),%edx
+  800410:	89 15 68 40 80 00    	mov    %edx,0x804068
+  800416:	8b 50 14             	mov    0x14(%eax),%edx
+  800419:	89 15 6c 40 80 00    	mov    %edx,0x80406c
+  80041f:	8b 50 18             	mov    0x18(%eax),%edx
+  800422:	89 15 70 40 80 00    	mov    %edx,0x804070
+  800428:	8b 50 1c             	mov    0x1c(%eax),%edx
+  80042b:	89 15 74 40 80 00    	mov    %edx,0x804074
+  800431:	8b 50 20             	mov    0x20(%eax),%edx
+  800434:	89 15 78 40 80 00    	mov    %edx,0x804078
+  80043a:	8b 50 24             	mov    0x24(%eax),%edx
+  80043d:	89 15 7c 40 80 00    	mov    %edx,0x80407c
+	during.eip = utf->utf_eip;
+  800443:	8b 50 28             	mov    0x28(%eax),%edx
+  800446:	89 15 80 40 80 00    	mov    %edx,0x804080
+	during.eflags = utf->utf_eflags & ~FL_RF;
+  80044c:	8b 50 2c             	mov    0x2c(%eax),%edx
+  80044f:	81 e2 ff ff fe ff    	and    $0xfffeffff,%edx
+  800455:	89 15 84 40 80 00    	mov    %edx,0x804084
+	during.esp = utf->utf_esp;
+  80045b:	8b 40 30             	mov    0x30(%eax),%eax
+  80045e:	a3 88 40 80 00       	mov    %eax,0x804088
+	check_regs(&before, "before", &during, "during", "in UTrapframe");
+  800463:	83 ec 08             	sub    $0x8,%esp
+  800466:	68 1f 2f 80 00       	push   $0x802f1f
+  80046b:	68 2d 2f 80 00       	push   $0x802f2d
+  800470:	b9 60 40 80 00       	mov    $0x804060,%ecx
+  800475:	ba 18 2f 80 00       	mov    $0x802f18,%edx
+  80047a:	b8 a0 40 80 00       	mov    $0x8040a0,%eax
+  80047f:	e8 af fb ff ff       	call   800033 <check_regs>
+
+	// Map UTEMP so the write succeeds
+	if ((r = sys_page_alloc(0, UTEMP, PTE_U|PTE_P|PTE_W)) < 0)
+  800484:	83 c4 0c             	add    $0xc,%esp
+  800487:	6a 07                	push   $0x7
+  800489:	68 00 00 40 00       	push   $0x400000
+  80048e:	6a 00                	push   $0x0
+  800490:	e8 de 10 00 00       	call   801573 <sys_page_alloc>
+  800495:	83 c4 10             	add    $0x10,%esp
+  800498:	85 c0                	test   %eax,%eax
+  80049a:	78 1a                	js     8004b6 <pgfault+0xd2>
+		panic("sys_page_alloc: %e", r);
+}
+  80049c:	c9                   	leave
+  80049d:	c3                   	ret
+		panic("pgfault expected at UTEMP, got 0x%08x (eip %08x)",
+  80049e:	83 ec 0c             	sub    $0xc,%esp
+  8004a1:	ff 70 28             	push   0x28(%eax)
+  8004a4:	52                   	push   %edx
+  8004a5:	68 60 2f 80 00       	push   $0x802f60
+  8004aa:	6a 50                	push   $0x50
+  8004ac:	68 07 2f 80 00       	push   $0x802f07
+  8004b1:	e8 86 01 00 00       	call   80063c <_panic>
+		panic("sys_page_alloc: %e", r);
+  8004b6:	50                   	push   %eax
+  8004b7:	68 34 2f 80 00       	push   $0x802f34
+  8004bc:	6a 5c                	push   $0x5c
+  8004be:	68 07 2f 80 00       	push   $0x802f07
+  8004c3:	e8 74 01 00 00       	call   80063c <_panic>
+
+008004c8 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8004c8:	55                   	push   %ebp
+  8004c9:	89 e5                	mov    %esp,%ebp
+  8004cb:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  8004ce:	68 e4 03 80 00       	push   $0x8003e4
+  8004d3:	e8 1a 27 00 00       	call   802bf2 <set_pgfault_handler>
+
+	asm volatile(
+  8004d8:	50                   	push   %eax
+  8004d9:	9c                   	pushf
+  8004da:	58                   	pop    %eax
+  8004db:	0d d5 08 00 00       	or     $0x8d5,%eax
+  8004e0:	50                   	push   %eax
+  8004e1:	9d                   	popf
+  8004e2:	a3 c4 40 80 00       	mov    %eax,0x8040c4
+  8004e7:	8d 05 22 05 80 00    	lea    0x800522,%eax
+  8004ed:	a3 c0 40 80 00       	mov    %eax,0x8040c0
+  8004f2:	58                   	pop    %eax
+  8004f3:	89 3d a0 40 80 00    	mov    %edi,0x8040a0
+  8004f9:	89 35 a4 40 80 00    	mov    %esi,0x8040a4
+  8004ff:	89 2d a8 40 80 00    	mov    %ebp,0x8040a8
+  800505:	89 1d b0 40 80 00    	mov    %ebx,0x8040b0
+  80050b:	89 15 b4 40 80 00    	mov    %edx,0x8040b4
+  800511:	89 0d b8 40 80 00    	mov    %ecx,0x8040b8
+  800517:	a3 bc 40 80 00       	mov    %eax,0x8040bc
+  80051c:	89 25 c8 40 80 00    	mov    %esp,0x8040c8
+  800522:	c7 05 00 00 40 00 2a 	movl   $0x2a,0x400000
+  800529:	00 00 00 
+  80052c:	89 3d 20 40 80 00    	mov    %edi,0x804020
+  800532:	89 35 24 40 80 00    	mov    %esi,0x804024
+  800538:	89 2d 28 40 80 00    	mov    %ebp,0x804028
+  80053e:	89 1d 30 40 80 00    	mov    %ebx,0x804030
+  800544:	89 15 34 40 80 00    	mov    %edx,0x804034
+  80054a:	89 0d 38 40 80 00    	mov    %ecx,0x804038
+  800550:	a3 3c 40 80 00       	mov    %eax,0x80403c
+  800555:	89 25 48 40 80 00    	mov    %esp,0x804048
+  80055b:	8b 3d a0 40 80 00    	mov    0x8040a0,%edi
+  800561:	8b 35 a4 40 80 00    	mov    0x8040a4,%esi
+  800567:	8b 2d a8 40 80 00    	mov    0x8040a8,%ebp
+  80056d:	8b 1d b0 40 80 00    	mov    0x8040b0,%ebx
+  800573:	8b 15 b4 40 80 00    	mov    0x8040b4,%edx
+  800579:	8b 0d b8 40 80 00    	mov    0x8040b8,%ecx
+  80057f:	a1 bc 40 80 00       	mov    0x8040bc,%eax
+  800584:	8b 25 c8 40 80 00    	mov    0x8040c8,%esp
+  80058a:	50                   	push   %eax
+  80058b:	9c                   	pushf
+  80058c:	58                   	pop    %eax
+  80058d:	a3 44 40 80 00       	mov    %eax,0x804044
+  800592:	58                   	pop    %eax
+		: : "m" (before), "m" (after) : "memory", "cc");
+
+	// Check UTEMP to roughly determine that EIP was restored
+	// correctly (of course, we probably wouldn't get this far if
+	// it weren't)
+	if (*(int*)UTEMP != 42)
+  800593:	83 c4 10             	add    $0x10,%esp
+  800596:	83 3d 00 00 40 00 2a 	cmpl   $0x2a,0x400000
+  80059d:	75 30                	jne    8005cf <umain+0x107>
+		cprintf("EIP after page-fault MISMATCH\n");
+	after.eip = before.eip;
+  80059f:	a1 c0 40 80 00       	mov    0x8040c0,%eax
+  8005a4:	a3 40 40 80 00       	mov    %eax,0x804040
+
+	check_regs(&before, "before", &after, "after", "after page-fault");
+  8005a9:	83 ec 08             	sub    $0x8,%esp
+  8005ac:	68 47 2f 80 00       	push   $0x802f47
+  8005b1:	68 58 2f 80 00       	push   $0x802f58
+  8005b6:	b9 20 40 80 00       	mov    $0x804020,%ecx
+  8005bb:	ba 18 2f 80 00       	mov    $0x802f18,%edx
+  8005c0:	b8 a0 40 80 00       	mov    $0x8040a0,%eax
+  8005c5:	e8 69 fa ff ff       	call   800033 <check_regs>
+}
+  8005ca:	83 c4 10             	add    $0x10,%esp
+  8005cd:	c9                   	leave
+  8005ce:	c3                   	ret
+		cprintf("EIP after page-fault MISMATCH\n");
+  8005cf:	83 ec 0c             	sub    $0xc,%esp
+  8005d2:	68 94 2f 80 00       	push   $0x802f94
+  8005d7:	e8 74 01 00 00       	call   800750 <cprintf>
+  8005dc:	83 c4 10             	add    $0x10,%esp
+  8005df:	eb be                	jmp    80059f <umain+0xd7>
+
+008005e1 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8005e1:	55                   	push   %ebp
+  8005e2:	89 e5                	mov    %esp,%ebp
+  8005e4:	56                   	push   %esi
+  8005e5:	53                   	push   %ebx
+  8005e6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8005e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  8005ec:	e8 e3 0e 00 00       	call   8014d4 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  8005f1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8005f6:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  8005fc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800601:	a3 cc 40 80 00       	mov    %eax,0x8040cc
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800606:	85 db                	test   %ebx,%ebx
+  800608:	7e 07                	jle    800611 <libmain+0x30>
+		binaryname = argv[0];
+  80060a:	8b 06                	mov    (%esi),%eax
+  80060c:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800611:	83 ec 08             	sub    $0x8,%esp
+  800614:	56                   	push   %esi
+  800615:	53                   	push   %ebx
+  800616:	e8 ad fe ff ff       	call   8004c8 <umain>
+
+	// exit gracefully
+	exit();
+  80061b:	e8 0a 00 00 00       	call   80062a <exit>
+}
+  800620:	83 c4 10             	add    $0x10,%esp
+  800623:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800626:	5b                   	pop    %ebx
+  800627:	5e                   	pop    %esi
+  800628:	5d                   	pop    %ebp
+  800629:	c3                   	ret
+
+0080062a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80062a:	55                   	push   %ebp
+  80062b:	89 e5                	mov    %esp,%ebp
+  80062d:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  800630:	6a 00                	push   $0x0
+  800632:	e8 db 0d 00 00       	call   801412 <sys_env_destroy>
+}
+  800637:	83 c4 10             	add    $0x10,%esp
+  80063a:	c9                   	leave
+  80063b:	c3                   	ret
+
+0080063c <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80063c:	55                   	push   %ebp
+  80063d:	89 e5                	mov    %esp,%ebp
+  80063f:	57                   	push   %edi
+  800640:	56                   	push   %esi
+  800641:	53                   	push   %ebx
+  800642:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  800648:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  80064b:	8b 1d 00 40 80 00    	mov    0x804000,%ebx
+  800651:	e8 7e 0e 00 00       	call   8014d4 <sys_getenvid>
+  800656:	83 ec 04             	sub    $0x4,%esp
+  800659:	ff 75 0c             	push   0xc(%ebp)
+  80065c:	ff 75 08             	push   0x8(%ebp)
+  80065f:	53                   	push   %ebx
+  800660:	50                   	push   %eax
+  800661:	68 c0 2f 80 00       	push   $0x802fc0
+  800666:	68 00 01 00 00       	push   $0x100
+  80066b:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  800671:	56                   	push   %esi
+  800672:	e8 72 06 00 00       	call   800ce9 <snprintf>
+  800677:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  800679:	83 c4 20             	add    $0x20,%esp
+  80067c:	57                   	push   %edi
+  80067d:	ff 75 10             	push   0x10(%ebp)
+  800680:	bf 00 01 00 00       	mov    $0x100,%edi
+  800685:	89 f8                	mov    %edi,%eax
+  800687:	29 d8                	sub    %ebx,%eax
+  800689:	50                   	push   %eax
+  80068a:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  80068d:	50                   	push   %eax
+  80068e:	e8 08 06 00 00       	call   800c9b <vsnprintf>
+  800693:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  800695:	83 c4 0c             	add    $0xc,%esp
+  800698:	68 d0 2e 80 00       	push   $0x802ed0
+  80069d:	29 df                	sub    %ebx,%edi
+  80069f:	57                   	push   %edi
+  8006a0:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8006a3:	50                   	push   %eax
+  8006a4:	e8 40 06 00 00       	call   800ce9 <snprintf>
+	sys_cputs(buf, r);
+  8006a9:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  8006ac:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  8006ae:	53                   	push   %ebx
+  8006af:	56                   	push   %esi
+  8006b0:	e8 21 0c 00 00       	call   8012d6 <sys_cputs>
+  8006b5:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8006b8:	cc                   	int3
+	while (1)
+  8006b9:	eb fd                	jmp    8006b8 <_panic+0x7c>
+
+008006bb <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8006bb:	55                   	push   %ebp
+  8006bc:	89 e5                	mov    %esp,%ebp
+  8006be:	53                   	push   %ebx
+  8006bf:	83 ec 04             	sub    $0x4,%esp
+  8006c2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8006c5:	8b 13                	mov    (%ebx),%edx
+  8006c7:	8d 42 01             	lea    0x1(%edx),%eax
+  8006ca:	89 03                	mov    %eax,(%ebx)
+  8006cc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8006cf:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8006d3:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8006d8:	74 09                	je     8006e3 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8006da:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8006de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8006e1:	c9                   	leave
+  8006e2:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8006e3:	83 ec 08             	sub    $0x8,%esp
+  8006e6:	68 ff 00 00 00       	push   $0xff
+  8006eb:	8d 43 08             	lea    0x8(%ebx),%eax
+  8006ee:	50                   	push   %eax
+  8006ef:	e8 e2 0b 00 00       	call   8012d6 <sys_cputs>
+		b->idx = 0;
+  8006f4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8006fa:	83 c4 10             	add    $0x10,%esp
+  8006fd:	eb db                	jmp    8006da <putch+0x1f>
+
+008006ff <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8006ff:	55                   	push   %ebp
+  800700:	89 e5                	mov    %esp,%ebp
+  800702:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800708:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80070f:	00 00 00 
+	b.cnt = 0;
+  800712:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800719:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80071c:	ff 75 0c             	push   0xc(%ebp)
+  80071f:	ff 75 08             	push   0x8(%ebp)
+  800722:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800728:	50                   	push   %eax
+  800729:	68 bb 06 80 00       	push   $0x8006bb
+  80072e:	e8 14 01 00 00       	call   800847 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800733:	83 c4 08             	add    $0x8,%esp
+  800736:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80073c:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800742:	50                   	push   %eax
+  800743:	e8 8e 0b 00 00       	call   8012d6 <sys_cputs>
+
+	return b.cnt;
+}
+  800748:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80074e:	c9                   	leave
+  80074f:	c3                   	ret
+
+00800750 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800750:	55                   	push   %ebp
+  800751:	89 e5                	mov    %esp,%ebp
+  800753:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800756:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800759:	50                   	push   %eax
+  80075a:	ff 75 08             	push   0x8(%ebp)
+  80075d:	e8 9d ff ff ff       	call   8006ff <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800762:	c9                   	leave
+  800763:	c3                   	ret
+
+00800764 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800764:	55                   	push   %ebp
+  800765:	89 e5                	mov    %esp,%ebp
+  800767:	57                   	push   %edi
+  800768:	56                   	push   %esi
+  800769:	53                   	push   %ebx
+  80076a:	83 ec 1c             	sub    $0x1c,%esp
+  80076d:	89 c7                	mov    %eax,%edi
+  80076f:	89 d6                	mov    %edx,%esi
+  800771:	8b 45 08             	mov    0x8(%ebp),%eax
+  800774:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800777:	89 d1                	mov    %edx,%ecx
+  800779:	89 c2                	mov    %eax,%edx
+  80077b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80077e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800781:	8b 45 10             	mov    0x10(%ebp),%eax
+  800784:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800787:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80078a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800791:	39 c2                	cmp    %eax,%edx
+  800793:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800796:	72 3e                	jb     8007d6 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800798:	83 ec 0c             	sub    $0xc,%esp
+  80079b:	ff 75 18             	push   0x18(%ebp)
+  80079e:	83 eb 01             	sub    $0x1,%ebx
+  8007a1:	53                   	push   %ebx
+  8007a2:	50                   	push   %eax
+  8007a3:	83 ec 08             	sub    $0x8,%esp
+  8007a6:	ff 75 e4             	push   -0x1c(%ebp)
+  8007a9:	ff 75 e0             	push   -0x20(%ebp)
+  8007ac:	ff 75 dc             	push   -0x24(%ebp)
+  8007af:	ff 75 d8             	push   -0x28(%ebp)
+  8007b2:	e8 9b 25 00 00       	call   802d52 <__udivdi3>
+  8007b7:	83 c4 18             	add    $0x18,%esp
+  8007ba:	52                   	push   %edx
+  8007bb:	50                   	push   %eax
+  8007bc:	89 f2                	mov    %esi,%edx
+  8007be:	89 f8                	mov    %edi,%eax
+  8007c0:	e8 9f ff ff ff       	call   800764 <printnum>
+  8007c5:	83 c4 20             	add    $0x20,%esp
+  8007c8:	eb 13                	jmp    8007dd <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8007ca:	83 ec 08             	sub    $0x8,%esp
+  8007cd:	56                   	push   %esi
+  8007ce:	ff 75 18             	push   0x18(%ebp)
+  8007d1:	ff d7                	call   *%edi
+  8007d3:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8007d6:	83 eb 01             	sub    $0x1,%ebx
+  8007d9:	85 db                	test   %ebx,%ebx
+  8007db:	7f ed                	jg     8007ca <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8007dd:	83 ec 08             	sub    $0x8,%esp
+  8007e0:	56                   	push   %esi
+  8007e1:	83 ec 04             	sub    $0x4,%esp
+  8007e4:	ff 75 e4             	push   -0x1c(%ebp)
+  8007e7:	ff 75 e0             	push   -0x20(%ebp)
+  8007ea:	ff 75 dc             	push   -0x24(%ebp)
+  8007ed:	ff 75 d8             	push   -0x28(%ebp)
+  8007f0:	e8 7b 25 00 00       	call   802d70 <__umoddi3>
+  8007f5:	83 c4 14             	add    $0x14,%esp
+  8007f8:	0f be 80 e3 2f 80 00 	movsbl 0x802fe3(%eax),%eax
+  8007ff:	50                   	push   %eax
+  800800:	ff d7                	call   *%edi
+}
+  800802:	83 c4 10             	add    $0x10,%esp
+  800805:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800808:	5b                   	pop    %ebx
+  800809:	5e                   	pop    %esi
+  80080a:	5f                   	pop    %edi
+  80080b:	5d                   	pop    %ebp
+  80080c:	c3                   	ret
+
+0080080d <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80080d:	55                   	push   %ebp
+  80080e:	89 e5                	mov    %esp,%ebp
+  800810:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800813:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800817:	8b 10                	mov    (%eax),%edx
+  800819:	3b 50 04             	cmp    0x4(%eax),%edx
+  80081c:	73 0a                	jae    800828 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80081e:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800821:	89 08                	mov    %ecx,(%eax)
+  800823:	8b 45 08             	mov    0x8(%ebp),%eax
+  800826:	88 02                	mov    %al,(%edx)
+}
+  800828:	5d                   	pop    %ebp
+  800829:	c3                   	ret
+
+0080082a <printfmt>:
+{
+  80082a:	55                   	push   %ebp
+  80082b:	89 e5                	mov    %esp,%ebp
+  80082d:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800830:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800833:	50                   	push   %eax
+  800834:	ff 75 10             	push   0x10(%ebp)
+  800837:	ff 75 0c             	push   0xc(%ebp)
+  80083a:	ff 75 08             	push   0x8(%ebp)
+  80083d:	e8 05 00 00 00       	call   800847 <vprintfmt>
+}
+  800842:	83 c4 10             	add    $0x10,%esp
+  800845:	c9                   	leave
+  800846:	c3                   	ret
+
+00800847 <vprintfmt>:
+{
+  800847:	55                   	push   %ebp
+  800848:	89 e5                	mov    %esp,%ebp
+  80084a:	57                   	push   %edi
+  80084b:	56                   	push   %esi
+  80084c:	53                   	push   %ebx
+  80084d:	83 ec 2c             	sub    $0x2c,%esp
+  800850:	8b 75 08             	mov    0x8(%ebp),%esi
+  800853:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800856:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800859:	eb 0a                	jmp    800865 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80085b:	83 ec 08             	sub    $0x8,%esp
+  80085e:	53                   	push   %ebx
+  80085f:	50                   	push   %eax
+  800860:	ff d6                	call   *%esi
+  800862:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800865:	83 c7 01             	add    $0x1,%edi
+  800868:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80086c:	83 f8 25             	cmp    $0x25,%eax
+  80086f:	74 0c                	je     80087d <vprintfmt+0x36>
+			if (ch == '\0')
+  800871:	85 c0                	test   %eax,%eax
+  800873:	75 e6                	jne    80085b <vprintfmt+0x14>
+}
+  800875:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800878:	5b                   	pop    %ebx
+  800879:	5e                   	pop    %esi
+  80087a:	5f                   	pop    %edi
+  80087b:	5d                   	pop    %ebp
+  80087c:	c3                   	ret
+		padc = ' ';
+  80087d:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800881:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800888:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80088f:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800896:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80089b:	8d 47 01             	lea    0x1(%edi),%eax
+  80089e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8008a1:	0f b6 17             	movzbl (%edi),%edx
+  8008a4:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8008a7:	3c 55                	cmp    $0x55,%al
+  8008a9:	0f 87 cf 03 00 00    	ja     800c7e <vprintfmt+0x437>
+  8008af:	0f b6 c0             	movzbl %al,%eax
+  8008b2:	ff 24 85 c0 30 80 00 	jmp    *0x8030c0(,%eax,4)
+  8008b9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8008bc:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8008c0:	eb d9                	jmp    80089b <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8008c2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8008c5:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8008c9:	eb d0                	jmp    80089b <vprintfmt+0x54>
+  8008cb:	0f b6 d2             	movzbl %dl,%edx
+  8008ce:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8008d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d6:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8008d9:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8008dc:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8008e0:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8008e3:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8008e6:	83 f9 09             	cmp    $0x9,%ecx
+  8008e9:	77 55                	ja     800940 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8008eb:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8008ee:	eb e9                	jmp    8008d9 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8008f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f3:	8b 00                	mov    (%eax),%eax
+  8008f5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8008f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008fb:	8d 40 04             	lea    0x4(%eax),%eax
+  8008fe:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800901:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800904:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800908:	79 91                	jns    80089b <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80090a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80090d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800910:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800917:	eb 82                	jmp    80089b <vprintfmt+0x54>
+			if (width < 0)
+  800919:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80091c:	85 d2                	test   %edx,%edx
+  80091e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800923:	0f 49 c2             	cmovns %edx,%eax
+  800926:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800929:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80092c:	e9 6a ff ff ff       	jmp    80089b <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800931:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800934:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80093b:	e9 5b ff ff ff       	jmp    80089b <vprintfmt+0x54>
+  800940:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800943:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800946:	eb bc                	jmp    800904 <vprintfmt+0xbd>
+			lflag++;
+  800948:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80094b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80094e:	e9 48 ff ff ff       	jmp    80089b <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800953:	8b 45 14             	mov    0x14(%ebp),%eax
+  800956:	8d 78 04             	lea    0x4(%eax),%edi
+  800959:	83 ec 08             	sub    $0x8,%esp
+  80095c:	53                   	push   %ebx
+  80095d:	ff 30                	push   (%eax)
+  80095f:	ff d6                	call   *%esi
+			break;
+  800961:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800964:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800967:	e9 b1 02 00 00       	jmp    800c1d <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  80096c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80096f:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800972:	8b 10                	mov    (%eax),%edx
+  800974:	89 d0                	mov    %edx,%eax
+  800976:	f7 d8                	neg    %eax
+  800978:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80097b:	83 f8 0d             	cmp    $0xd,%eax
+  80097e:	7f 23                	jg     8009a3 <vprintfmt+0x15c>
+  800980:	8b 14 85 20 32 80 00 	mov    0x803220(,%eax,4),%edx
+  800987:	85 d2                	test   %edx,%edx
+  800989:	74 18                	je     8009a3 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80098b:	52                   	push   %edx
+  80098c:	68 04 30 80 00       	push   $0x803004
+  800991:	53                   	push   %ebx
+  800992:	56                   	push   %esi
+  800993:	e8 92 fe ff ff       	call   80082a <printfmt>
+  800998:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80099b:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80099e:	e9 7a 02 00 00       	jmp    800c1d <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8009a3:	50                   	push   %eax
+  8009a4:	68 fb 2f 80 00       	push   $0x802ffb
+  8009a9:	53                   	push   %ebx
+  8009aa:	56                   	push   %esi
+  8009ab:	e8 7a fe ff ff       	call   80082a <printfmt>
+  8009b0:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8009b3:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8009b6:	e9 62 02 00 00       	jmp    800c1d <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8009bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009be:	83 c0 04             	add    $0x4,%eax
+  8009c1:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8009c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c7:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8009c9:	85 c9                	test   %ecx,%ecx
+  8009cb:	b8 f4 2f 80 00       	mov    $0x802ff4,%eax
+  8009d0:	0f 45 c1             	cmovne %ecx,%eax
+  8009d3:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8009d6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8009da:	7e 06                	jle    8009e2 <vprintfmt+0x19b>
+  8009dc:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8009e0:	75 0b                	jne    8009ed <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8009e2:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8009e5:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8009e8:	89 75 08             	mov    %esi,0x8(%ebp)
+  8009eb:	eb 5c                	jmp    800a49 <vprintfmt+0x202>
+  8009ed:	83 ec 08             	sub    $0x8,%esp
+  8009f0:	ff 75 d0             	push   -0x30(%ebp)
+  8009f3:	ff 75 cc             	push   -0x34(%ebp)
+  8009f6:	e8 20 03 00 00       	call   800d1b <strnlen>
+  8009fb:	89 c2                	mov    %eax,%edx
+  8009fd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800a00:	29 d0                	sub    %edx,%eax
+  800a02:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800a05:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800a09:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800a0c:	89 75 08             	mov    %esi,0x8(%ebp)
+  800a0f:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800a11:	eb 0e                	jmp    800a21 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800a13:	83 ec 08             	sub    $0x8,%esp
+  800a16:	53                   	push   %ebx
+  800a17:	57                   	push   %edi
+  800a18:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800a1b:	83 ee 01             	sub    $0x1,%esi
+  800a1e:	83 c4 10             	add    $0x10,%esp
+  800a21:	85 f6                	test   %esi,%esi
+  800a23:	7f ee                	jg     800a13 <vprintfmt+0x1cc>
+  800a25:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800a28:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a2b:	85 c0                	test   %eax,%eax
+  800a2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a32:	0f 49 d0             	cmovns %eax,%edx
+  800a35:	29 d0                	sub    %edx,%eax
+  800a37:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800a3a:	eb a6                	jmp    8009e2 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800a3c:	83 ec 08             	sub    $0x8,%esp
+  800a3f:	53                   	push   %ebx
+  800a40:	52                   	push   %edx
+  800a41:	ff 55 08             	call   *0x8(%ebp)
+  800a44:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a47:	89 f1                	mov    %esi,%ecx
+  800a49:	8d 71 01             	lea    0x1(%ecx),%esi
+  800a4c:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800a50:	0f be d0             	movsbl %al,%edx
+  800a53:	85 d2                	test   %edx,%edx
+  800a55:	74 28                	je     800a7f <vprintfmt+0x238>
+  800a57:	85 ff                	test   %edi,%edi
+  800a59:	78 05                	js     800a60 <vprintfmt+0x219>
+  800a5b:	83 ef 01             	sub    $0x1,%edi
+  800a5e:	78 30                	js     800a90 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800a60:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800a64:	74 d6                	je     800a3c <vprintfmt+0x1f5>
+  800a66:	0f be c0             	movsbl %al,%eax
+  800a69:	83 e8 20             	sub    $0x20,%eax
+  800a6c:	83 f8 5e             	cmp    $0x5e,%eax
+  800a6f:	76 cb                	jbe    800a3c <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800a71:	83 ec 08             	sub    $0x8,%esp
+  800a74:	53                   	push   %ebx
+  800a75:	6a 3f                	push   $0x3f
+  800a77:	ff 55 08             	call   *0x8(%ebp)
+  800a7a:	83 c4 10             	add    $0x10,%esp
+  800a7d:	eb c8                	jmp    800a47 <vprintfmt+0x200>
+  800a7f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a82:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a85:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800a88:	01 d0                	add    %edx,%eax
+  800a8a:	29 c8                	sub    %ecx,%eax
+  800a8c:	89 c7                	mov    %eax,%edi
+  800a8e:	eb 13                	jmp    800aa3 <vprintfmt+0x25c>
+  800a90:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a93:	eb ed                	jmp    800a82 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800a95:	83 ec 08             	sub    $0x8,%esp
+  800a98:	53                   	push   %ebx
+  800a99:	6a 20                	push   $0x20
+  800a9b:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800a9d:	83 ef 01             	sub    $0x1,%edi
+  800aa0:	83 c4 10             	add    $0x10,%esp
+  800aa3:	85 ff                	test   %edi,%edi
+  800aa5:	7f ee                	jg     800a95 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800aa7:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800aaa:	89 45 14             	mov    %eax,0x14(%ebp)
+  800aad:	e9 6b 01 00 00       	jmp    800c1d <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800ab2:	83 f9 01             	cmp    $0x1,%ecx
+  800ab5:	7f 1f                	jg     800ad6 <vprintfmt+0x28f>
+	else if (lflag)
+  800ab7:	85 c9                	test   %ecx,%ecx
+  800ab9:	74 67                	je     800b22 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800abb:	8b 45 14             	mov    0x14(%ebp),%eax
+  800abe:	8b 00                	mov    (%eax),%eax
+  800ac0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800ac3:	89 c1                	mov    %eax,%ecx
+  800ac5:	c1 f9 1f             	sar    $0x1f,%ecx
+  800ac8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800acb:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ace:	8d 40 04             	lea    0x4(%eax),%eax
+  800ad1:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ad4:	eb 17                	jmp    800aed <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800ad6:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ad9:	8b 50 04             	mov    0x4(%eax),%edx
+  800adc:	8b 00                	mov    (%eax),%eax
+  800ade:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800ae1:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800ae4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ae7:	8d 40 08             	lea    0x8(%eax),%eax
+  800aea:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800aed:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800af0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800af3:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800af8:	85 c9                	test   %ecx,%ecx
+  800afa:	0f 89 03 01 00 00    	jns    800c03 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800b00:	83 ec 08             	sub    $0x8,%esp
+  800b03:	53                   	push   %ebx
+  800b04:	6a 2d                	push   $0x2d
+  800b06:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800b08:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800b0b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800b0e:	f7 da                	neg    %edx
+  800b10:	83 d1 00             	adc    $0x0,%ecx
+  800b13:	f7 d9                	neg    %ecx
+  800b15:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800b18:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800b1d:	e9 e1 00 00 00       	jmp    800c03 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800b22:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b25:	8b 00                	mov    (%eax),%eax
+  800b27:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800b2a:	89 c1                	mov    %eax,%ecx
+  800b2c:	c1 f9 1f             	sar    $0x1f,%ecx
+  800b2f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b32:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b35:	8d 40 04             	lea    0x4(%eax),%eax
+  800b38:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b3b:	eb b0                	jmp    800aed <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800b3d:	83 f9 01             	cmp    $0x1,%ecx
+  800b40:	7f 1e                	jg     800b60 <vprintfmt+0x319>
+	else if (lflag)
+  800b42:	85 c9                	test   %ecx,%ecx
+  800b44:	74 32                	je     800b78 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800b46:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b49:	8b 10                	mov    (%eax),%edx
+  800b4b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b50:	8d 40 04             	lea    0x4(%eax),%eax
+  800b53:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b56:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800b5b:	e9 a3 00 00 00       	jmp    800c03 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800b60:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b63:	8b 10                	mov    (%eax),%edx
+  800b65:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b68:	8d 40 08             	lea    0x8(%eax),%eax
+  800b6b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b6e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800b73:	e9 8b 00 00 00       	jmp    800c03 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800b78:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b7b:	8b 10                	mov    (%eax),%edx
+  800b7d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b82:	8d 40 04             	lea    0x4(%eax),%eax
+  800b85:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b88:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800b8d:	eb 74                	jmp    800c03 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800b8f:	83 f9 01             	cmp    $0x1,%ecx
+  800b92:	7f 1b                	jg     800baf <vprintfmt+0x368>
+	else if (lflag)
+  800b94:	85 c9                	test   %ecx,%ecx
+  800b96:	74 2c                	je     800bc4 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800b98:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b9b:	8b 10                	mov    (%eax),%edx
+  800b9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ba2:	8d 40 04             	lea    0x4(%eax),%eax
+  800ba5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800ba8:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800bad:	eb 54                	jmp    800c03 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800baf:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bb2:	8b 10                	mov    (%eax),%edx
+  800bb4:	8b 48 04             	mov    0x4(%eax),%ecx
+  800bb7:	8d 40 08             	lea    0x8(%eax),%eax
+  800bba:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800bbd:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800bc2:	eb 3f                	jmp    800c03 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800bc4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bc7:	8b 10                	mov    (%eax),%edx
+  800bc9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bce:	8d 40 04             	lea    0x4(%eax),%eax
+  800bd1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800bd4:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800bd9:	eb 28                	jmp    800c03 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800bdb:	83 ec 08             	sub    $0x8,%esp
+  800bde:	53                   	push   %ebx
+  800bdf:	6a 30                	push   $0x30
+  800be1:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800be3:	83 c4 08             	add    $0x8,%esp
+  800be6:	53                   	push   %ebx
+  800be7:	6a 78                	push   $0x78
+  800be9:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800beb:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bee:	8b 10                	mov    (%eax),%edx
+  800bf0:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800bf5:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800bf8:	8d 40 04             	lea    0x4(%eax),%eax
+  800bfb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800bfe:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800c03:	83 ec 0c             	sub    $0xc,%esp
+  800c06:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800c0a:	50                   	push   %eax
+  800c0b:	ff 75 e0             	push   -0x20(%ebp)
+  800c0e:	57                   	push   %edi
+  800c0f:	51                   	push   %ecx
+  800c10:	52                   	push   %edx
+  800c11:	89 da                	mov    %ebx,%edx
+  800c13:	89 f0                	mov    %esi,%eax
+  800c15:	e8 4a fb ff ff       	call   800764 <printnum>
+			break;
+  800c1a:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800c1d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800c20:	e9 40 fc ff ff       	jmp    800865 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800c25:	83 f9 01             	cmp    $0x1,%ecx
+  800c28:	7f 1b                	jg     800c45 <vprintfmt+0x3fe>
+	else if (lflag)
+  800c2a:	85 c9                	test   %ecx,%ecx
+  800c2c:	74 2c                	je     800c5a <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800c2e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c31:	8b 10                	mov    (%eax),%edx
+  800c33:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c38:	8d 40 04             	lea    0x4(%eax),%eax
+  800c3b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c3e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800c43:	eb be                	jmp    800c03 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800c45:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c48:	8b 10                	mov    (%eax),%edx
+  800c4a:	8b 48 04             	mov    0x4(%eax),%ecx
+  800c4d:	8d 40 08             	lea    0x8(%eax),%eax
+  800c50:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c53:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800c58:	eb a9                	jmp    800c03 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800c5a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c5d:	8b 10                	mov    (%eax),%edx
+  800c5f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c64:	8d 40 04             	lea    0x4(%eax),%eax
+  800c67:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c6a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800c6f:	eb 92                	jmp    800c03 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800c71:	83 ec 08             	sub    $0x8,%esp
+  800c74:	53                   	push   %ebx
+  800c75:	6a 25                	push   $0x25
+  800c77:	ff d6                	call   *%esi
+			break;
+  800c79:	83 c4 10             	add    $0x10,%esp
+  800c7c:	eb 9f                	jmp    800c1d <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800c7e:	83 ec 08             	sub    $0x8,%esp
+  800c81:	53                   	push   %ebx
+  800c82:	6a 25                	push   $0x25
+  800c84:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800c86:	83 c4 10             	add    $0x10,%esp
+  800c89:	89 f8                	mov    %edi,%eax
+  800c8b:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800c8f:	74 05                	je     800c96 <vprintfmt+0x44f>
+  800c91:	83 e8 01             	sub    $0x1,%eax
+  800c94:	eb f5                	jmp    800c8b <vprintfmt+0x444>
+  800c96:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800c99:	eb 82                	jmp    800c1d <vprintfmt+0x3d6>
+
+00800c9b <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800c9b:	55                   	push   %ebp
+  800c9c:	89 e5                	mov    %esp,%ebp
+  800c9e:	83 ec 18             	sub    $0x18,%esp
+  800ca1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ca4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800ca7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800caa:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800cae:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800cb1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800cb8:	85 c0                	test   %eax,%eax
+  800cba:	74 26                	je     800ce2 <vsnprintf+0x47>
+  800cbc:	85 d2                	test   %edx,%edx
+  800cbe:	7e 22                	jle    800ce2 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800cc0:	ff 75 14             	push   0x14(%ebp)
+  800cc3:	ff 75 10             	push   0x10(%ebp)
+  800cc6:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800cc9:	50                   	push   %eax
+  800cca:	68 0d 08 80 00       	push   $0x80080d
+  800ccf:	e8 73 fb ff ff       	call   800847 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800cd4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800cd7:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800cda:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800cdd:	83 c4 10             	add    $0x10,%esp
+}
+  800ce0:	c9                   	leave
+  800ce1:	c3                   	ret
+		return -E_INVAL;
+  800ce2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ce7:	eb f7                	jmp    800ce0 <vsnprintf+0x45>
+
+00800ce9 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800ce9:	55                   	push   %ebp
+  800cea:	89 e5                	mov    %esp,%ebp
+  800cec:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800cef:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800cf2:	50                   	push   %eax
+  800cf3:	ff 75 10             	push   0x10(%ebp)
+  800cf6:	ff 75 0c             	push   0xc(%ebp)
+  800cf9:	ff 75 08             	push   0x8(%ebp)
+  800cfc:	e8 9a ff ff ff       	call   800c9b <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800d01:	c9                   	leave
+  800d02:	c3                   	ret
+
+00800d03 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800d03:	55                   	push   %ebp
+  800d04:	89 e5                	mov    %esp,%ebp
+  800d06:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800d09:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d0e:	eb 03                	jmp    800d13 <strlen+0x10>
+		n++;
+  800d10:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800d13:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800d17:	75 f7                	jne    800d10 <strlen+0xd>
+	return n;
+}
+  800d19:	5d                   	pop    %ebp
+  800d1a:	c3                   	ret
+
+00800d1b <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800d1b:	55                   	push   %ebp
+  800d1c:	89 e5                	mov    %esp,%ebp
+  800d1e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800d21:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d24:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d29:	eb 03                	jmp    800d2e <strnlen+0x13>
+		n++;
+  800d2b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800d2e:	39 d0                	cmp    %edx,%eax
+  800d30:	74 08                	je     800d3a <strnlen+0x1f>
+  800d32:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800d36:	75 f3                	jne    800d2b <strnlen+0x10>
+  800d38:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800d3a:	89 d0                	mov    %edx,%eax
+  800d3c:	5d                   	pop    %ebp
+  800d3d:	c3                   	ret
+
+00800d3e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800d3e:	55                   	push   %ebp
+  800d3f:	89 e5                	mov    %esp,%ebp
+  800d41:	53                   	push   %ebx
+  800d42:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d45:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800d48:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d4d:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800d51:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800d54:	83 c0 01             	add    $0x1,%eax
+  800d57:	84 d2                	test   %dl,%dl
+  800d59:	75 f2                	jne    800d4d <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800d5b:	89 c8                	mov    %ecx,%eax
+  800d5d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d60:	c9                   	leave
+  800d61:	c3                   	ret
+
+00800d62 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800d62:	55                   	push   %ebp
+  800d63:	89 e5                	mov    %esp,%ebp
+  800d65:	53                   	push   %ebx
+  800d66:	83 ec 10             	sub    $0x10,%esp
+  800d69:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800d6c:	53                   	push   %ebx
+  800d6d:	e8 91 ff ff ff       	call   800d03 <strlen>
+  800d72:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800d75:	ff 75 0c             	push   0xc(%ebp)
+  800d78:	01 d8                	add    %ebx,%eax
+  800d7a:	50                   	push   %eax
+  800d7b:	e8 be ff ff ff       	call   800d3e <strcpy>
+	return dst;
+}
+  800d80:	89 d8                	mov    %ebx,%eax
+  800d82:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d85:	c9                   	leave
+  800d86:	c3                   	ret
+
+00800d87 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d87:	55                   	push   %ebp
+  800d88:	89 e5                	mov    %esp,%ebp
+  800d8a:	56                   	push   %esi
+  800d8b:	53                   	push   %ebx
+  800d8c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d8f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800d92:	89 f3                	mov    %esi,%ebx
+  800d94:	03 5d 10             	add    0x10(%ebp),%ebx
+  800d97:	89 f0                	mov    %esi,%eax
+  800d99:	eb 0f                	jmp    800daa <strncpy+0x23>
+		*dst++ = *src;
+  800d9b:	83 c0 01             	add    $0x1,%eax
+  800d9e:	0f b6 0a             	movzbl (%edx),%ecx
+  800da1:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800da4:	80 f9 01             	cmp    $0x1,%cl
+  800da7:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800daa:	39 d8                	cmp    %ebx,%eax
+  800dac:	75 ed                	jne    800d9b <strncpy+0x14>
+	}
+	return ret;
+}
+  800dae:	89 f0                	mov    %esi,%eax
+  800db0:	5b                   	pop    %ebx
+  800db1:	5e                   	pop    %esi
+  800db2:	5d                   	pop    %ebp
+  800db3:	c3                   	ret
+
+00800db4 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800db4:	55                   	push   %ebp
+  800db5:	89 e5                	mov    %esp,%ebp
+  800db7:	56                   	push   %esi
+  800db8:	53                   	push   %ebx
+  800db9:	8b 75 08             	mov    0x8(%ebp),%esi
+  800dbc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dbf:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800dc2:	89 f0                	mov    %esi,%eax
+  800dc4:	85 d2                	test   %edx,%edx
+  800dc6:	74 21                	je     800de9 <strlcpy+0x35>
+  800dc8:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800dcc:	89 f2                	mov    %esi,%edx
+  800dce:	eb 09                	jmp    800dd9 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800dd0:	83 c1 01             	add    $0x1,%ecx
+  800dd3:	83 c2 01             	add    $0x1,%edx
+  800dd6:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800dd9:	39 c2                	cmp    %eax,%edx
+  800ddb:	74 09                	je     800de6 <strlcpy+0x32>
+  800ddd:	0f b6 19             	movzbl (%ecx),%ebx
+  800de0:	84 db                	test   %bl,%bl
+  800de2:	75 ec                	jne    800dd0 <strlcpy+0x1c>
+  800de4:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800de6:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800de9:	29 f0                	sub    %esi,%eax
+}
+  800deb:	5b                   	pop    %ebx
+  800dec:	5e                   	pop    %esi
+  800ded:	5d                   	pop    %ebp
+  800dee:	c3                   	ret
+
+00800def <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800def:	55                   	push   %ebp
+  800df0:	89 e5                	mov    %esp,%ebp
+  800df2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800df5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800df8:	eb 06                	jmp    800e00 <strcmp+0x11>
+		p++, q++;
+  800dfa:	83 c1 01             	add    $0x1,%ecx
+  800dfd:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800e00:	0f b6 01             	movzbl (%ecx),%eax
+  800e03:	84 c0                	test   %al,%al
+  800e05:	74 04                	je     800e0b <strcmp+0x1c>
+  800e07:	3a 02                	cmp    (%edx),%al
+  800e09:	74 ef                	je     800dfa <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800e0b:	0f b6 c0             	movzbl %al,%eax
+  800e0e:	0f b6 12             	movzbl (%edx),%edx
+  800e11:	29 d0                	sub    %edx,%eax
+}
+  800e13:	5d                   	pop    %ebp
+  800e14:	c3                   	ret
+
+00800e15 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800e15:	55                   	push   %ebp
+  800e16:	89 e5                	mov    %esp,%ebp
+  800e18:	53                   	push   %ebx
+  800e19:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e1c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e1f:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800e22:	eb 09                	jmp    800e2d <strncmp+0x18>
+		n--, p++, q++;
+  800e24:	83 ea 01             	sub    $0x1,%edx
+  800e27:	83 c0 01             	add    $0x1,%eax
+  800e2a:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800e2d:	85 d2                	test   %edx,%edx
+  800e2f:	74 18                	je     800e49 <strncmp+0x34>
+  800e31:	0f b6 18             	movzbl (%eax),%ebx
+  800e34:	84 db                	test   %bl,%bl
+  800e36:	74 04                	je     800e3c <strncmp+0x27>
+  800e38:	3a 19                	cmp    (%ecx),%bl
+  800e3a:	74 e8                	je     800e24 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800e3c:	0f b6 00             	movzbl (%eax),%eax
+  800e3f:	0f b6 11             	movzbl (%ecx),%edx
+  800e42:	29 d0                	sub    %edx,%eax
+}
+  800e44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e47:	c9                   	leave
+  800e48:	c3                   	ret
+		return 0;
+  800e49:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e4e:	eb f4                	jmp    800e44 <strncmp+0x2f>
+
+00800e50 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800e50:	55                   	push   %ebp
+  800e51:	89 e5                	mov    %esp,%ebp
+  800e53:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e56:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800e5a:	eb 03                	jmp    800e5f <strchr+0xf>
+  800e5c:	83 c0 01             	add    $0x1,%eax
+  800e5f:	0f b6 10             	movzbl (%eax),%edx
+  800e62:	84 d2                	test   %dl,%dl
+  800e64:	74 06                	je     800e6c <strchr+0x1c>
+		if (*s == c)
+  800e66:	38 ca                	cmp    %cl,%dl
+  800e68:	75 f2                	jne    800e5c <strchr+0xc>
+  800e6a:	eb 05                	jmp    800e71 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800e6c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e71:	5d                   	pop    %ebp
+  800e72:	c3                   	ret
+
+00800e73 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800e73:	55                   	push   %ebp
+  800e74:	89 e5                	mov    %esp,%ebp
+  800e76:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e79:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800e7d:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800e80:	38 ca                	cmp    %cl,%dl
+  800e82:	74 09                	je     800e8d <strfind+0x1a>
+  800e84:	84 d2                	test   %dl,%dl
+  800e86:	74 05                	je     800e8d <strfind+0x1a>
+	for (; *s; s++)
+  800e88:	83 c0 01             	add    $0x1,%eax
+  800e8b:	eb f0                	jmp    800e7d <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800e8d:	5d                   	pop    %ebp
+  800e8e:	c3                   	ret
+
+00800e8f <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800e8f:	55                   	push   %ebp
+  800e90:	89 e5                	mov    %esp,%ebp
+  800e92:	57                   	push   %edi
+  800e93:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800e96:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800e99:	85 c9                	test   %ecx,%ecx
+  800e9b:	74 20                	je     800ebd <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800e9d:	89 f8                	mov    %edi,%eax
+  800e9f:	09 c8                	or     %ecx,%eax
+  800ea1:	a8 03                	test   $0x3,%al
+  800ea3:	75 12                	jne    800eb7 <memset+0x28>
+		c &= 0xFF;
+  800ea5:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800ea9:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800eaf:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800eb2:	fc                   	cld
+  800eb3:	f3 ab                	rep stos %eax,%es:(%edi)
+  800eb5:	eb 06                	jmp    800ebd <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800eb7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800eba:	fc                   	cld
+  800ebb:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800ebd:	89 f8                	mov    %edi,%eax
+  800ebf:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ec2:	c9                   	leave
+  800ec3:	c3                   	ret
+
+00800ec4 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800ec4:	55                   	push   %ebp
+  800ec5:	89 e5                	mov    %esp,%ebp
+  800ec7:	57                   	push   %edi
+  800ec8:	56                   	push   %esi
+  800ec9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ecc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ecf:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800ed2:	39 c6                	cmp    %eax,%esi
+  800ed4:	73 32                	jae    800f08 <memmove+0x44>
+  800ed6:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800ed9:	39 d0                	cmp    %edx,%eax
+  800edb:	73 2b                	jae    800f08 <memmove+0x44>
+		s += n;
+		d += n;
+  800edd:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ee0:	89 d6                	mov    %edx,%esi
+  800ee2:	09 fe                	or     %edi,%esi
+  800ee4:	09 ce                	or     %ecx,%esi
+  800ee6:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800eec:	75 0e                	jne    800efc <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800eee:	83 ef 04             	sub    $0x4,%edi
+  800ef1:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ef4:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ef7:	fd                   	std
+  800ef8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800efa:	eb 09                	jmp    800f05 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800efc:	83 ef 01             	sub    $0x1,%edi
+  800eff:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800f02:	fd                   	std
+  800f03:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800f05:	fc                   	cld
+  800f06:	eb 1a                	jmp    800f22 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800f08:	89 f2                	mov    %esi,%edx
+  800f0a:	09 c2                	or     %eax,%edx
+  800f0c:	09 ca                	or     %ecx,%edx
+  800f0e:	f6 c2 03             	test   $0x3,%dl
+  800f11:	75 0a                	jne    800f1d <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800f13:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800f16:	89 c7                	mov    %eax,%edi
+  800f18:	fc                   	cld
+  800f19:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800f1b:	eb 05                	jmp    800f22 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800f1d:	89 c7                	mov    %eax,%edi
+  800f1f:	fc                   	cld
+  800f20:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800f22:	5e                   	pop    %esi
+  800f23:	5f                   	pop    %edi
+  800f24:	5d                   	pop    %ebp
+  800f25:	c3                   	ret
+
+00800f26 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800f26:	55                   	push   %ebp
+  800f27:	89 e5                	mov    %esp,%ebp
+  800f29:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800f2c:	ff 75 10             	push   0x10(%ebp)
+  800f2f:	ff 75 0c             	push   0xc(%ebp)
+  800f32:	ff 75 08             	push   0x8(%ebp)
+  800f35:	e8 8a ff ff ff       	call   800ec4 <memmove>
+}
+  800f3a:	c9                   	leave
+  800f3b:	c3                   	ret
+
+00800f3c <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800f3c:	55                   	push   %ebp
+  800f3d:	89 e5                	mov    %esp,%ebp
+  800f3f:	56                   	push   %esi
+  800f40:	53                   	push   %ebx
+  800f41:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f44:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800f47:	89 c6                	mov    %eax,%esi
+  800f49:	03 75 10             	add    0x10(%ebp),%esi
+  800f4c:	eb 06                	jmp    800f54 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800f4e:	83 c0 01             	add    $0x1,%eax
+  800f51:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800f54:	39 f0                	cmp    %esi,%eax
+  800f56:	74 14                	je     800f6c <memcmp+0x30>
+		if (*s1 != *s2)
+  800f58:	0f b6 08             	movzbl (%eax),%ecx
+  800f5b:	0f b6 1a             	movzbl (%edx),%ebx
+  800f5e:	38 d9                	cmp    %bl,%cl
+  800f60:	74 ec                	je     800f4e <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800f62:	0f b6 c1             	movzbl %cl,%eax
+  800f65:	0f b6 db             	movzbl %bl,%ebx
+  800f68:	29 d8                	sub    %ebx,%eax
+  800f6a:	eb 05                	jmp    800f71 <memcmp+0x35>
+	}
+
+	return 0;
+  800f6c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f71:	5b                   	pop    %ebx
+  800f72:	5e                   	pop    %esi
+  800f73:	5d                   	pop    %ebp
+  800f74:	c3                   	ret
+
+00800f75 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800f75:	55                   	push   %ebp
+  800f76:	89 e5                	mov    %esp,%ebp
+  800f78:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f7b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800f7e:	89 c2                	mov    %eax,%edx
+  800f80:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800f83:	eb 03                	jmp    800f88 <memfind+0x13>
+  800f85:	83 c0 01             	add    $0x1,%eax
+  800f88:	39 d0                	cmp    %edx,%eax
+  800f8a:	73 04                	jae    800f90 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800f8c:	38 08                	cmp    %cl,(%eax)
+  800f8e:	75 f5                	jne    800f85 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800f90:	5d                   	pop    %ebp
+  800f91:	c3                   	ret
+
+00800f92 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800f92:	55                   	push   %ebp
+  800f93:	89 e5                	mov    %esp,%ebp
+  800f95:	57                   	push   %edi
+  800f96:	56                   	push   %esi
+  800f97:	53                   	push   %ebx
+  800f98:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800f9e:	eb 03                	jmp    800fa3 <strtol+0x11>
+		s++;
+  800fa0:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800fa3:	0f b6 02             	movzbl (%edx),%eax
+  800fa6:	3c 20                	cmp    $0x20,%al
+  800fa8:	74 f6                	je     800fa0 <strtol+0xe>
+  800faa:	3c 09                	cmp    $0x9,%al
+  800fac:	74 f2                	je     800fa0 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800fae:	3c 2b                	cmp    $0x2b,%al
+  800fb0:	74 2a                	je     800fdc <strtol+0x4a>
+	int neg = 0;
+  800fb2:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800fb7:	3c 2d                	cmp    $0x2d,%al
+  800fb9:	74 2b                	je     800fe6 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800fbb:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800fc1:	75 0f                	jne    800fd2 <strtol+0x40>
+  800fc3:	80 3a 30             	cmpb   $0x30,(%edx)
+  800fc6:	74 28                	je     800ff0 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800fc8:	85 db                	test   %ebx,%ebx
+  800fca:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fcf:	0f 44 d8             	cmove  %eax,%ebx
+  800fd2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fd7:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800fda:	eb 46                	jmp    801022 <strtol+0x90>
+		s++;
+  800fdc:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800fdf:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fe4:	eb d5                	jmp    800fbb <strtol+0x29>
+		s++, neg = 1;
+  800fe6:	83 c2 01             	add    $0x1,%edx
+  800fe9:	bf 01 00 00 00       	mov    $0x1,%edi
+  800fee:	eb cb                	jmp    800fbb <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ff0:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ff4:	74 0e                	je     801004 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800ff6:	85 db                	test   %ebx,%ebx
+  800ff8:	75 d8                	jne    800fd2 <strtol+0x40>
+		s++, base = 8;
+  800ffa:	83 c2 01             	add    $0x1,%edx
+  800ffd:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801002:	eb ce                	jmp    800fd2 <strtol+0x40>
+		s += 2, base = 16;
+  801004:	83 c2 02             	add    $0x2,%edx
+  801007:	bb 10 00 00 00       	mov    $0x10,%ebx
+  80100c:	eb c4                	jmp    800fd2 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  80100e:	0f be c0             	movsbl %al,%eax
+  801011:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  801014:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801017:	7d 3a                	jge    801053 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  801019:	83 c2 01             	add    $0x1,%edx
+  80101c:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  801020:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  801022:	0f b6 02             	movzbl (%edx),%eax
+  801025:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801028:	89 f3                	mov    %esi,%ebx
+  80102a:	80 fb 09             	cmp    $0x9,%bl
+  80102d:	76 df                	jbe    80100e <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  80102f:	8d 70 9f             	lea    -0x61(%eax),%esi
+  801032:	89 f3                	mov    %esi,%ebx
+  801034:	80 fb 19             	cmp    $0x19,%bl
+  801037:	77 08                	ja     801041 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  801039:	0f be c0             	movsbl %al,%eax
+  80103c:	83 e8 57             	sub    $0x57,%eax
+  80103f:	eb d3                	jmp    801014 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  801041:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801044:	89 f3                	mov    %esi,%ebx
+  801046:	80 fb 19             	cmp    $0x19,%bl
+  801049:	77 08                	ja     801053 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  80104b:	0f be c0             	movsbl %al,%eax
+  80104e:	83 e8 37             	sub    $0x37,%eax
+  801051:	eb c1                	jmp    801014 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801053:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801057:	74 05                	je     80105e <strtol+0xcc>
+		*endptr = (char *) s;
+  801059:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80105c:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  80105e:	89 c8                	mov    %ecx,%eax
+  801060:	f7 d8                	neg    %eax
+  801062:	85 ff                	test   %edi,%edi
+  801064:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801067:	89 c8                	mov    %ecx,%eax
+  801069:	5b                   	pop    %ebx
+  80106a:	5e                   	pop    %esi
+  80106b:	5f                   	pop    %edi
+  80106c:	5d                   	pop    %ebp
+  80106d:	c3                   	ret
+
+0080106e <atoi>:
+
+int
+atoi(const char *s)
+{
+  80106e:	55                   	push   %ebp
+  80106f:	89 e5                	mov    %esp,%ebp
+  801071:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  801074:	6a 0a                	push   $0xa
+  801076:	6a 00                	push   $0x0
+  801078:	ff 75 08             	push   0x8(%ebp)
+  80107b:	e8 12 ff ff ff       	call   800f92 <strtol>
+}
+  801080:	c9                   	leave
+  801081:	c3                   	ret
+
+00801082 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  801082:	55                   	push   %ebp
+  801083:	89 e5                	mov    %esp,%ebp
+  801085:	57                   	push   %edi
+  801086:	56                   	push   %esi
+  801087:	53                   	push   %ebx
+  801088:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  80108e:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  801094:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  80109a:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  8010a0:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  8010a7:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  8010aa:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  8010b1:	00 00 00 
+		if (num == SYS_page_map_vec)
+  8010b4:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  8010bb:	74 76                	je     801133 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  8010bd:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  8010c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010c6:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  8010cc:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8010d3:	0f 88 06 01 00 00    	js     8011df <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  8010d9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8010e0:	0f 84 48 01 00 00    	je     80122e <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  8010e6:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  8010ec:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  8010f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8010f7:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  8010fd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801100:	55                   	push   %ebp
+  801101:	68 0a 11 80 00       	push   $0x80110a
+  801106:	89 e5                	mov    %esp,%ebp
+  801108:	0f 34                	sysenter
+  80110a:	83 c4 04             	add    $0x4,%esp
+  80110d:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  80110e:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  801114:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  80111a:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  80111d:	0f 85 9a 01 00 00    	jne    8012bd <page_vec_call+0x23b>
+  801123:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801128:	8b 75 08             	mov    0x8(%ebp),%esi
+  80112b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80112e:	e9 29 01 00 00       	jmp    80125c <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  801133:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  801139:	8b 45 08             	mov    0x8(%ebp),%eax
+  80113c:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  80113e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801145:	78 2f                	js     801176 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  801147:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80114e:	74 72                	je     8011c2 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  801150:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  801156:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  80115c:	b8 10 00 00 00       	mov    $0x10,%eax
+  801161:	89 fb                	mov    %edi,%ebx
+  801163:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801166:	55                   	push   %ebp
+  801167:	68 70 11 80 00       	push   $0x801170
+  80116c:	89 e5                	mov    %esp,%ebp
+  80116e:	0f 34                	sysenter
+  801170:	83 c4 04             	add    $0x4,%esp
+  801173:	5d                   	pop    %ebp
+	return ret;
+  801174:	eb 98                	jmp    80110e <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  801176:	b8 01 00 00 00       	mov    $0x1,%eax
+  80117b:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  80117d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801182:	f6 c6 08             	test   $0x8,%dh
+  801185:	74 15                	je     80119c <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801187:	89 c2                	mov    %eax,%edx
+  801189:	c1 ea 08             	shr    $0x8,%edx
+  80118c:	83 e2 0f             	and    $0xf,%edx
+  80118f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801194:	83 fa 06             	cmp    $0x6,%edx
+  801197:	74 0e                	je     8011a7 <page_vec_call+0x125>
+  801199:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80119c:	0f b6 c9             	movzbl %cl,%ecx
+  80119f:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8011a5:	eb a0                	jmp    801147 <page_vec_call+0xc5>
+  8011a7:	89 c2                	mov    %eax,%edx
+  8011a9:	c1 ea 04             	shr    $0x4,%edx
+  8011ac:	83 e2 0f             	and    $0xf,%edx
+  8011af:	83 fa 02             	cmp    $0x2,%edx
+  8011b2:	77 e5                	ja     801199 <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  8011b4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011b7:	83 f8 02             	cmp    $0x2,%eax
+  8011ba:	0f 97 c1             	seta   %cl
+  8011bd:	0f b6 c9             	movzbl %cl,%ecx
+  8011c0:	eb d7                	jmp    801199 <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  8011c2:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011c7:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  8011cd:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  8011d3:	89 fb                	mov    %edi,%ebx
+  8011d5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8011d8:	cd 30                	int    $0x30
+  8011da:	e9 2f ff ff ff       	jmp    80110e <page_vec_call+0x8c>
+  8011df:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011e4:	0f a2                	cpuid
+		return 0;
+  8011e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8011eb:	f6 c6 08             	test   $0x8,%dh
+  8011ee:	74 15                	je     801205 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011f0:	89 c2                	mov    %eax,%edx
+  8011f2:	c1 ea 08             	shr    $0x8,%edx
+  8011f5:	83 e2 0f             	and    $0xf,%edx
+  8011f8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011fd:	83 fa 06             	cmp    $0x6,%edx
+  801200:	74 11                	je     801213 <page_vec_call+0x191>
+  801202:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801205:	0f b6 c9             	movzbl %cl,%ecx
+  801208:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80120e:	e9 c6 fe ff ff       	jmp    8010d9 <page_vec_call+0x57>
+  801213:	89 c2                	mov    %eax,%edx
+  801215:	c1 ea 04             	shr    $0x4,%edx
+  801218:	83 e2 0f             	and    $0xf,%edx
+  80121b:	83 fa 02             	cmp    $0x2,%edx
+  80121e:	77 e2                	ja     801202 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  801220:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801223:	83 f8 02             	cmp    $0x2,%eax
+  801226:	0f 97 c1             	seta   %cl
+  801229:	0f b6 c9             	movzbl %cl,%ecx
+  80122c:	eb d4                	jmp    801202 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  80122e:	be 00 00 00 00       	mov    $0x0,%esi
+  801233:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  801239:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  80123f:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  801245:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801248:	cd 30                	int    $0x30
+  80124a:	e9 bf fe ff ff       	jmp    80110e <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  80124f:	29 da                	sub    %ebx,%edx
+			vec++;
+  801251:	83 c6 10             	add    $0x10,%esi
+			n--;
+  801254:	83 e8 01             	sub    $0x1,%eax
+  801257:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  80125c:	85 c0                	test   %eax,%eax
+  80125e:	74 58                	je     8012b8 <page_vec_call+0x236>
+  801260:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801263:	39 da                	cmp    %ebx,%edx
+  801265:	73 e8                	jae    80124f <page_vec_call+0x1cd>
+  801267:	89 75 08             	mov    %esi,0x8(%ebp)
+  80126a:	89 45 0c             	mov    %eax,0xc(%ebp)
+  80126d:	84 c9                	test   %cl,%cl
+  80126f:	74 06                	je     801277 <page_vec_call+0x1f5>
+  801271:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  801277:	83 ec 04             	sub    $0x4,%esp
+  80127a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80127d:	c1 e0 04             	shl    $0x4,%eax
+  801280:	50                   	push   %eax
+  801281:	ff 75 08             	push   0x8(%ebp)
+  801284:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  80128a:	53                   	push   %ebx
+  80128b:	e8 34 fc ff ff       	call   800ec4 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  801290:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  801296:	89 c2                	mov    %eax,%edx
+  801298:	c1 e2 0c             	shl    $0xc,%edx
+  80129b:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  8012a1:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  8012a7:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  8012ad:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  8012b0:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  8012b3:	e9 f2 fd ff ff       	jmp    8010aa <page_vec_call+0x28>
+			r = 0;
+  8012b8:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  8012bd:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8012c1:	74 0b                	je     8012ce <page_vec_call+0x24c>
+		*done = total;
+  8012c3:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8012c6:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  8012cc:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  8012ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012d1:	5b                   	pop    %ebx
+  8012d2:	5e                   	pop    %esi
+  8012d3:	5f                   	pop    %edi
+  8012d4:	5d                   	pop    %ebp
+  8012d5:	c3                   	ret
+
+008012d6 <sys_cputs>:
+{
+  8012d6:	55                   	push   %ebp
+  8012d7:	89 e5                	mov    %esp,%ebp
+  8012d9:	57                   	push   %edi
+  8012da:	56                   	push   %esi
+  8012db:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8012dc:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8012e3:	78 2d                	js     801312 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  8012e5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8012ec:	74 70                	je     80135e <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  8012ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f9:	89 c3                	mov    %eax,%ebx
+  8012fb:	89 c7                	mov    %eax,%edi
+  8012fd:	89 c6                	mov    %eax,%esi
+  8012ff:	55                   	push   %ebp
+  801300:	68 09 13 80 00       	push   $0x801309
+  801305:	89 e5                	mov    %esp,%ebp
+  801307:	0f 34                	sysenter
+  801309:	83 c4 04             	add    $0x4,%esp
+  80130c:	5d                   	pop    %ebp
+}
+  80130d:	5b                   	pop    %ebx
+  80130e:	5e                   	pop    %esi
+  80130f:	5f                   	pop    %edi
+  801310:	5d                   	pop    %ebp
+  801311:	c3                   	ret
+  801312:	b8 01 00 00 00       	mov    $0x1,%eax
+  801317:	0f a2                	cpuid
+		return 0;
+  801319:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80131e:	f6 c6 08             	test   $0x8,%dh
+  801321:	74 15                	je     801338 <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801323:	89 c2                	mov    %eax,%edx
+  801325:	c1 ea 08             	shr    $0x8,%edx
+  801328:	83 e2 0f             	and    $0xf,%edx
+  80132b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801330:	83 fa 06             	cmp    $0x6,%edx
+  801333:	74 0e                	je     801343 <sys_cputs+0x6d>
+  801335:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801338:	0f b6 c9             	movzbl %cl,%ecx
+  80133b:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801341:	eb a2                	jmp    8012e5 <sys_cputs+0xf>
+  801343:	89 c2                	mov    %eax,%edx
+  801345:	c1 ea 04             	shr    $0x4,%edx
+  801348:	83 e2 0f             	and    $0xf,%edx
+  80134b:	83 fa 02             	cmp    $0x2,%edx
+  80134e:	77 e5                	ja     801335 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  801350:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801353:	83 f8 02             	cmp    $0x2,%eax
+  801356:	0f 97 c1             	seta   %cl
+  801359:	0f b6 c9             	movzbl %cl,%ecx
+  80135c:	eb d7                	jmp    801335 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  80135e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801363:	8b 55 08             	mov    0x8(%ebp),%edx
+  801366:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801369:	89 c3                	mov    %eax,%ebx
+  80136b:	89 c7                	mov    %eax,%edi
+  80136d:	89 c6                	mov    %eax,%esi
+  80136f:	cd 30                	int    $0x30
+}
+  801371:	eb 9a                	jmp    80130d <sys_cputs+0x37>
+
+00801373 <sys_cgetc>:
+{
+  801373:	55                   	push   %ebp
+  801374:	89 e5                	mov    %esp,%ebp
+  801376:	57                   	push   %edi
+  801377:	56                   	push   %esi
+  801378:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801379:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801380:	78 2e                	js     8013b0 <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  801382:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801389:	74 71                	je     8013fc <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  80138b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801390:	b8 01 00 00 00       	mov    $0x1,%eax
+  801395:	89 d1                	mov    %edx,%ecx
+  801397:	89 d3                	mov    %edx,%ebx
+  801399:	89 d7                	mov    %edx,%edi
+  80139b:	89 d6                	mov    %edx,%esi
+  80139d:	55                   	push   %ebp
+  80139e:	68 a7 13 80 00       	push   $0x8013a7
+  8013a3:	89 e5                	mov    %esp,%ebp
+  8013a5:	0f 34                	sysenter
+  8013a7:	83 c4 04             	add    $0x4,%esp
+  8013aa:	5d                   	pop    %ebp
+}
+  8013ab:	5b                   	pop    %ebx
+  8013ac:	5e                   	pop    %esi
+  8013ad:	5f                   	pop    %edi
+  8013ae:	5d                   	pop    %ebp
+  8013af:	c3                   	ret
+  8013b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013b5:	0f a2                	cpuid
+		return 0;
+  8013b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8013bc:	f6 c6 08             	test   $0x8,%dh
+  8013bf:	74 15                	je     8013d6 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013c1:	89 c2                	mov    %eax,%edx
+  8013c3:	c1 ea 08             	shr    $0x8,%edx
+  8013c6:	83 e2 0f             	and    $0xf,%edx
+  8013c9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8013ce:	83 fa 06             	cmp    $0x6,%edx
+  8013d1:	74 0e                	je     8013e1 <sys_cgetc+0x6e>
+  8013d3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8013d6:	0f b6 c9             	movzbl %cl,%ecx
+  8013d9:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8013df:	eb a1                	jmp    801382 <sys_cgetc+0xf>
+  8013e1:	89 c2                	mov    %eax,%edx
+  8013e3:	c1 ea 04             	shr    $0x4,%edx
+  8013e6:	83 e2 0f             	and    $0xf,%edx
+  8013e9:	83 fa 02             	cmp    $0x2,%edx
+  8013ec:	77 e5                	ja     8013d3 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  8013ee:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013f1:	83 f8 02             	cmp    $0x2,%eax
+  8013f4:	0f 97 c1             	seta   %cl
+  8013f7:	0f b6 c9             	movzbl %cl,%ecx
+  8013fa:	eb d7                	jmp    8013d3 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  8013fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801401:	b8 01 00 00 00       	mov    $0x1,%eax
+  801406:	89 d1                	mov    %edx,%ecx
+  801408:	89 d3                	mov    %edx,%ebx
+  80140a:	89 d7                	mov    %edx,%edi
+  80140c:	89 d6                	mov    %edx,%esi
+  80140e:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801410:	eb 99                	jmp    8013ab <sys_cgetc+0x38>
+
+00801412 <sys_env_destroy>:
+{
+  801412:	55                   	push   %ebp
+  801413:	89 e5                	mov    %esp,%ebp
+  801415:	57                   	push   %edi
+  801416:	56                   	push   %esi
+  801417:	53                   	push   %ebx
+  801418:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80141b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801422:	78 36                	js     80145a <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  801424:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80142b:	74 79                	je     8014a6 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  80142d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801430:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801435:	b8 03 00 00 00       	mov    $0x3,%eax
+  80143a:	89 cb                	mov    %ecx,%ebx
+  80143c:	89 cf                	mov    %ecx,%edi
+  80143e:	89 ce                	mov    %ecx,%esi
+  801440:	55                   	push   %ebp
+  801441:	68 4a 14 80 00       	push   $0x80144a
+  801446:	89 e5                	mov    %esp,%ebp
+  801448:	0f 34                	sysenter
+  80144a:	83 c4 04             	add    $0x4,%esp
+  80144d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80144e:	85 c0                	test   %eax,%eax
+  801450:	7f 6b                	jg     8014bd <sys_env_destroy+0xab>
+}
+  801452:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801455:	5b                   	pop    %ebx
+  801456:	5e                   	pop    %esi
+  801457:	5f                   	pop    %edi
+  801458:	5d                   	pop    %ebp
+  801459:	c3                   	ret
+  80145a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80145f:	0f a2                	cpuid
+		return 0;
+  801461:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801466:	f6 c6 08             	test   $0x8,%dh
+  801469:	74 15                	je     801480 <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80146b:	89 c2                	mov    %eax,%edx
+  80146d:	c1 ea 08             	shr    $0x8,%edx
+  801470:	83 e2 0f             	and    $0xf,%edx
+  801473:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801478:	83 fa 06             	cmp    $0x6,%edx
+  80147b:	74 0e                	je     80148b <sys_env_destroy+0x79>
+  80147d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801480:	0f b6 c9             	movzbl %cl,%ecx
+  801483:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801489:	eb 99                	jmp    801424 <sys_env_destroy+0x12>
+  80148b:	89 c2                	mov    %eax,%edx
+  80148d:	c1 ea 04             	shr    $0x4,%edx
+  801490:	83 e2 0f             	and    $0xf,%edx
+  801493:	83 fa 02             	cmp    $0x2,%edx
+  801496:	77 e5                	ja     80147d <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  801498:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80149b:	83 f8 02             	cmp    $0x2,%eax
+  80149e:	0f 97 c1             	seta   %cl
+  8014a1:	0f b6 c9             	movzbl %cl,%ecx
+  8014a4:	eb d7                	jmp    80147d <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  8014a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014ab:	b8 03 00 00 00       	mov    $0x3,%eax
+  8014b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b3:	89 cb                	mov    %ecx,%ebx
+  8014b5:	89 cf                	mov    %ecx,%edi
+  8014b7:	89 ce                	mov    %ecx,%esi
+  8014b9:	cd 30                	int    $0x30
+  8014bb:	eb 91                	jmp    80144e <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014bd:	83 ec 0c             	sub    $0xc,%esp
+  8014c0:	50                   	push   %eax
+  8014c1:	6a 03                	push   $0x3
+  8014c3:	68 99 32 80 00       	push   $0x803299
+  8014c8:	6a 4a                	push   $0x4a
+  8014ca:	68 b6 32 80 00       	push   $0x8032b6
+  8014cf:	e8 68 f1 ff ff       	call   80063c <_panic>
+
+008014d4 <sys_getenvid>:
+{
+  8014d4:	55                   	push   %ebp
+  8014d5:	89 e5                	mov    %esp,%ebp
+  8014d7:	57                   	push   %edi
+  8014d8:	56                   	push   %esi
+  8014d9:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8014da:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8014e1:	78 2e                	js     801511 <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  8014e3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8014ea:	74 71                	je     80155d <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  8014ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014f1:	b8 02 00 00 00       	mov    $0x2,%eax
+  8014f6:	89 d1                	mov    %edx,%ecx
+  8014f8:	89 d3                	mov    %edx,%ebx
+  8014fa:	89 d7                	mov    %edx,%edi
+  8014fc:	89 d6                	mov    %edx,%esi
+  8014fe:	55                   	push   %ebp
+  8014ff:	68 08 15 80 00       	push   $0x801508
+  801504:	89 e5                	mov    %esp,%ebp
+  801506:	0f 34                	sysenter
+  801508:	83 c4 04             	add    $0x4,%esp
+  80150b:	5d                   	pop    %ebp
+}
+  80150c:	5b                   	pop    %ebx
+  80150d:	5e                   	pop    %esi
+  80150e:	5f                   	pop    %edi
+  80150f:	5d                   	pop    %ebp
+  801510:	c3                   	ret
+  801511:	b8 01 00 00 00       	mov    $0x1,%eax
+  801516:	0f a2                	cpuid
+		return 0;
+  801518:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80151d:	f6 c6 08             	test   $0x8,%dh
+  801520:	74 15                	je     801537 <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801522:	89 c2                	mov    %eax,%edx
+  801524:	c1 ea 08             	shr    $0x8,%edx
+  801527:	83 e2 0f             	and    $0xf,%edx
+  80152a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80152f:	83 fa 06             	cmp    $0x6,%edx
+  801532:	74 0e                	je     801542 <sys_getenvid+0x6e>
+  801534:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801537:	0f b6 c9             	movzbl %cl,%ecx
+  80153a:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801540:	eb a1                	jmp    8014e3 <sys_getenvid+0xf>
+  801542:	89 c2                	mov    %eax,%edx
+  801544:	c1 ea 04             	shr    $0x4,%edx
+  801547:	83 e2 0f             	and    $0xf,%edx
+  80154a:	83 fa 02             	cmp    $0x2,%edx
+  80154d:	77 e5                	ja     801534 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  80154f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801552:	83 f8 02             	cmp    $0x2,%eax
+  801555:	0f 97 c1             	seta   %cl
+  801558:	0f b6 c9             	movzbl %cl,%ecx
+  80155b:	eb d7                	jmp    801534 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  80155d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801562:	b8 02 00 00 00       	mov    $0x2,%eax
+  801567:	89 d1                	mov    %edx,%ecx
+  801569:	89 d3                	mov    %edx,%ebx
+  80156b:	89 d7                	mov    %edx,%edi
+  80156d:	89 d6                	mov    %edx,%esi
+  80156f:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801571:	eb 99                	jmp    80150c <sys_getenvid+0x38>
+
+00801573 <sys_page_alloc>:
+{
+  801573:	55                   	push   %ebp
+  801574:	89 e5                	mov    %esp,%ebp
+  801576:	57                   	push   %edi
+  801577:	56                   	push   %esi
+  801578:	53                   	push   %ebx
+  801579:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80157c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801583:	78 38                	js     8015bd <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  801585:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80158c:	74 7b                	je     801609 <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  80158e:	be 00 00 00 00       	mov    $0x0,%esi
+  801593:	8b 55 08             	mov    0x8(%ebp),%edx
+  801596:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801599:	b8 04 00 00 00       	mov    $0x4,%eax
+  80159e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015a1:	89 f7                	mov    %esi,%edi
+  8015a3:	55                   	push   %ebp
+  8015a4:	68 ad 15 80 00       	push   $0x8015ad
+  8015a9:	89 e5                	mov    %esp,%ebp
+  8015ab:	0f 34                	sysenter
+  8015ad:	83 c4 04             	add    $0x4,%esp
+  8015b0:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8015b1:	85 c0                	test   %eax,%eax
+  8015b3:	7f 6d                	jg     801622 <sys_page_alloc+0xaf>
+}
+  8015b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015b8:	5b                   	pop    %ebx
+  8015b9:	5e                   	pop    %esi
+  8015ba:	5f                   	pop    %edi
+  8015bb:	5d                   	pop    %ebp
+  8015bc:	c3                   	ret
+  8015bd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015c2:	0f a2                	cpuid
+		return 0;
+  8015c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8015c9:	f6 c6 08             	test   $0x8,%dh
+  8015cc:	74 15                	je     8015e3 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015ce:	89 c2                	mov    %eax,%edx
+  8015d0:	c1 ea 08             	shr    $0x8,%edx
+  8015d3:	83 e2 0f             	and    $0xf,%edx
+  8015d6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8015db:	83 fa 06             	cmp    $0x6,%edx
+  8015de:	74 0e                	je     8015ee <sys_page_alloc+0x7b>
+  8015e0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8015e3:	0f b6 c9             	movzbl %cl,%ecx
+  8015e6:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8015ec:	eb 97                	jmp    801585 <sys_page_alloc+0x12>
+  8015ee:	89 c2                	mov    %eax,%edx
+  8015f0:	c1 ea 04             	shr    $0x4,%edx
+  8015f3:	83 e2 0f             	and    $0xf,%edx
+  8015f6:	83 fa 02             	cmp    $0x2,%edx
+  8015f9:	77 e5                	ja     8015e0 <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  8015fb:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015fe:	83 f8 02             	cmp    $0x2,%eax
+  801601:	0f 97 c1             	seta   %cl
+  801604:	0f b6 c9             	movzbl %cl,%ecx
+  801607:	eb d7                	jmp    8015e0 <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  801609:	be 00 00 00 00       	mov    $0x0,%esi
+  80160e:	b8 04 00 00 00       	mov    $0x4,%eax
+  801613:	8b 55 08             	mov    0x8(%ebp),%edx
+  801616:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801619:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80161c:	89 f7                	mov    %esi,%edi
+  80161e:	cd 30                	int    $0x30
+  801620:	eb 8f                	jmp    8015b1 <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801622:	83 ec 0c             	sub    $0xc,%esp
+  801625:	50                   	push   %eax
+  801626:	6a 04                	push   $0x4
+  801628:	68 99 32 80 00       	push   $0x803299
+  80162d:	6a 4a                	push   $0x4a
+  80162f:	68 b6 32 80 00       	push   $0x8032b6
+  801634:	e8 03 f0 ff ff       	call   80063c <_panic>
+
+00801639 <sys_page_map>:
+{
+  801639:	55                   	push   %ebp
+  80163a:	89 e5                	mov    %esp,%ebp
+  80163c:	57                   	push   %edi
+  80163d:	56                   	push   %esi
+  80163e:	53                   	push   %ebx
+  80163f:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801642:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801649:	78 37                	js     801682 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  80164b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801652:	74 7a                	je     8016ce <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  801654:	8b 55 08             	mov    0x8(%ebp),%edx
+  801657:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80165a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80165f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801662:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801665:	8b 75 18             	mov    0x18(%ebp),%esi
+  801668:	55                   	push   %ebp
+  801669:	68 72 16 80 00       	push   $0x801672
+  80166e:	89 e5                	mov    %esp,%ebp
+  801670:	0f 34                	sysenter
+  801672:	83 c4 04             	add    $0x4,%esp
+  801675:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801676:	85 c0                	test   %eax,%eax
+  801678:	7f 6c                	jg     8016e6 <sys_page_map+0xad>
+}
+  80167a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80167d:	5b                   	pop    %ebx
+  80167e:	5e                   	pop    %esi
+  80167f:	5f                   	pop    %edi
+  801680:	5d                   	pop    %ebp
+  801681:	c3                   	ret
+  801682:	b8 01 00 00 00       	mov    $0x1,%eax
+  801687:	0f a2                	cpuid
+		return 0;
+  801689:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80168e:	f6 c6 08             	test   $0x8,%dh
+  801691:	74 15                	je     8016a8 <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801693:	89 c2                	mov    %eax,%edx
+  801695:	c1 ea 08             	shr    $0x8,%edx
+  801698:	83 e2 0f             	and    $0xf,%edx
+  80169b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8016a0:	83 fa 06             	cmp    $0x6,%edx
+  8016a3:	74 0e                	je     8016b3 <sys_page_map+0x7a>
+  8016a5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8016a8:	0f b6 c9             	movzbl %cl,%ecx
+  8016ab:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8016b1:	eb 98                	jmp    80164b <sys_page_map+0x12>
+  8016b3:	89 c2                	mov    %eax,%edx
+  8016b5:	c1 ea 04             	shr    $0x4,%edx
+  8016b8:	83 e2 0f             	and    $0xf,%edx
+  8016bb:	83 fa 02             	cmp    $0x2,%edx
+  8016be:	77 e5                	ja     8016a5 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  8016c0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016c3:	83 f8 02             	cmp    $0x2,%eax
+  8016c6:	0f 97 c1             	seta   %cl
+  8016c9:	0f b6 c9             	movzbl %cl,%ecx
+  8016cc:	eb d7                	jmp    8016a5 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  8016ce:	b8 05 00 00 00       	mov    $0x5,%eax
+  8016d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016d9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016dc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8016df:	8b 75 18             	mov    0x18(%ebp),%esi
+  8016e2:	cd 30                	int    $0x30
+  8016e4:	eb 90                	jmp    801676 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016e6:	83 ec 0c             	sub    $0xc,%esp
+  8016e9:	50                   	push   %eax
+  8016ea:	6a 05                	push   $0x5
+  8016ec:	68 99 32 80 00       	push   $0x803299
+  8016f1:	6a 4a                	push   $0x4a
+  8016f3:	68 b6 32 80 00       	push   $0x8032b6
+  8016f8:	e8 3f ef ff ff       	call   80063c <_panic>
+
+008016fd <sys_page_unmap>:
+{
+  8016fd:	55                   	push   %ebp
+  8016fe:	89 e5                	mov    %esp,%ebp
+  801700:	57                   	push   %edi
+  801701:	56                   	push   %esi
+  801702:	53                   	push   %ebx
+  801703:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801706:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80170d:	78 37                	js     801746 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  80170f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801716:	74 7a                	je     801792 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  801718:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80171d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801720:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801723:	b8 06 00 00 00       	mov    $0x6,%eax
+  801728:	89 df                	mov    %ebx,%edi
+  80172a:	89 de                	mov    %ebx,%esi
+  80172c:	55                   	push   %ebp
+  80172d:	68 36 17 80 00       	push   $0x801736
+  801732:	89 e5                	mov    %esp,%ebp
+  801734:	0f 34                	sysenter
+  801736:	83 c4 04             	add    $0x4,%esp
+  801739:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80173a:	85 c0                	test   %eax,%eax
+  80173c:	7f 6c                	jg     8017aa <sys_page_unmap+0xad>
+}
+  80173e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801741:	5b                   	pop    %ebx
+  801742:	5e                   	pop    %esi
+  801743:	5f                   	pop    %edi
+  801744:	5d                   	pop    %ebp
+  801745:	c3                   	ret
+  801746:	b8 01 00 00 00       	mov    $0x1,%eax
+  80174b:	0f a2                	cpuid
+		return 0;
+  80174d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801752:	f6 c6 08             	test   $0x8,%dh
+  801755:	74 15                	je     80176c <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801757:	89 c2                	mov    %eax,%edx
+  801759:	c1 ea 08             	shr    $0x8,%edx
+  80175c:	83 e2 0f             	and    $0xf,%edx
+  80175f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801764:	83 fa 06             	cmp    $0x6,%edx
+  801767:	74 0e                	je     801777 <sys_page_unmap+0x7a>
+  801769:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80176c:	0f b6 c9             	movzbl %cl,%ecx
+  80176f:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801775:	eb 98                	jmp    80170f <sys_page_unmap+0x12>
+  801777:	89 c2                	mov    %eax,%edx
+  801779:	c1 ea 04             	shr    $0x4,%edx
+  80177c:	83 e2 0f             	and    $0xf,%edx
+  80177f:	83 fa 02             	cmp    $0x2,%edx
+  801782:	77 e5                	ja     801769 <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  801784:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801787:	83 f8 02             	cmp    $0x2,%eax
+  80178a:	0f 97 c1             	seta   %cl
+  80178d:	0f b6 c9             	movzbl %cl,%ecx
+  801790:	eb d7                	jmp    801769 <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  801792:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801797:	b8 06 00 00 00       	mov    $0x6,%eax
+  80179c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80179f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017a2:	89 df                	mov    %ebx,%edi
+  8017a4:	89 de                	mov    %ebx,%esi
+  8017a6:	cd 30                	int    $0x30
+  8017a8:	eb 90                	jmp    80173a <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017aa:	83 ec 0c             	sub    $0xc,%esp
+  8017ad:	50                   	push   %eax
+  8017ae:	6a 06                	push   $0x6
+  8017b0:	68 99 32 80 00       	push   $0x803299
+  8017b5:	6a 4a                	push   $0x4a
+  8017b7:	68 b6 32 80 00       	push   $0x8032b6
+  8017bc:	e8 7b ee ff ff       	call   80063c <_panic>
+
+008017c1 <sys_page_copy>:
+{
+  8017c1:	55                   	push   %ebp
+  8017c2:	89 e5                	mov    %esp,%ebp
+  8017c4:	57                   	push   %edi
+  8017c5:	56                   	push   %esi
+  8017c6:	53                   	push   %ebx
+  8017c7:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8017ca:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8017d1:	78 37                	js     80180a <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  8017d3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8017da:	74 7a                	je     801856 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  8017dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017e2:	b8 29 00 00 00       	mov    $0x29,%eax
+  8017e7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017ea:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8017ed:	8b 75 18             	mov    0x18(%ebp),%esi
+  8017f0:	55                   	push   %ebp
+  8017f1:	68 fa 17 80 00       	push   $0x8017fa
+  8017f6:	89 e5                	mov    %esp,%ebp
+  8017f8:	0f 34                	sysenter
+  8017fa:	83 c4 04             	add    $0x4,%esp
+  8017fd:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8017fe:	85 c0                	test   %eax,%eax
+  801800:	7f 6c                	jg     80186e <sys_page_copy+0xad>
+}
+  801802:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801805:	5b                   	pop    %ebx
+  801806:	5e                   	pop    %esi
+  801807:	5f                   	pop    %edi
+  801808:	5d                   	pop    %ebp
+  801809:	c3                   	ret
+  80180a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80180f:	0f a2                	cpuid
+		return 0;
+  801811:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801816:	f6 c6 08             	test   $0x8,%dh
+  801819:	74 15                	je     801830 <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80181b:	89 c2                	mov    %eax,%edx
+  80181d:	c1 ea 08             	shr    $0x8,%edx
+  801820:	83 e2 0f             	and    $0xf,%edx
+  801823:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801828:	83 fa 06             	cmp    $0x6,%edx
+  80182b:	74 0e                	je     80183b <sys_page_copy+0x7a>
+  80182d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801830:	0f b6 c9             	movzbl %cl,%ecx
+  801833:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801839:	eb 98                	jmp    8017d3 <sys_page_copy+0x12>
+  80183b:	89 c2                	mov    %eax,%edx
+  80183d:	c1 ea 04             	shr    $0x4,%edx
+  801840:	83 e2 0f             	and    $0xf,%edx
+  801843:	83 fa 02             	cmp    $0x2,%edx
+  801846:	77 e5                	ja     80182d <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  801848:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80184b:	83 f8 02             	cmp    $0x2,%eax
+  80184e:	0f 97 c1             	seta   %cl
+  801851:	0f b6 c9             	movzbl %cl,%ecx
+  801854:	eb d7                	jmp    80182d <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  801856:	b8 29 00 00 00       	mov    $0x29,%eax
+  80185b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80185e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801861:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801864:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801867:	8b 75 18             	mov    0x18(%ebp),%esi
+  80186a:	cd 30                	int    $0x30
+  80186c:	eb 90                	jmp    8017fe <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80186e:	83 ec 0c             	sub    $0xc,%esp
+  801871:	50                   	push   %eax
+  801872:	6a 29                	push   $0x29
+  801874:	68 99 32 80 00       	push   $0x803299
+  801879:	6a 4a                	push   $0x4a
+  80187b:	68 b6 32 80 00       	push   $0x8032b6
+  801880:	e8 b7 ed ff ff       	call   80063c <_panic>
+
+00801885 <sys_yield>:
+{
+  801885:	55                   	push   %ebp
+  801886:	89 e5                	mov    %esp,%ebp
+  801888:	57                   	push   %edi
+  801889:	56                   	push   %esi
+  80188a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80188b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801892:	78 2e                	js     8018c2 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  801894:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80189b:	74 71                	je     80190e <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  80189d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018a2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8018a7:	89 d1                	mov    %edx,%ecx
+  8018a9:	89 d3                	mov    %edx,%ebx
+  8018ab:	89 d7                	mov    %edx,%edi
+  8018ad:	89 d6                	mov    %edx,%esi
+  8018af:	55                   	push   %ebp
+  8018b0:	68 b9 18 80 00       	push   $0x8018b9
+  8018b5:	89 e5                	mov    %esp,%ebp
+  8018b7:	0f 34                	sysenter
+  8018b9:	83 c4 04             	add    $0x4,%esp
+  8018bc:	5d                   	pop    %ebp
+}
+  8018bd:	5b                   	pop    %ebx
+  8018be:	5e                   	pop    %esi
+  8018bf:	5f                   	pop    %edi
+  8018c0:	5d                   	pop    %ebp
+  8018c1:	c3                   	ret
+  8018c2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018c7:	0f a2                	cpuid
+		return 0;
+  8018c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018ce:	f6 c6 08             	test   $0x8,%dh
+  8018d1:	74 15                	je     8018e8 <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018d3:	89 c2                	mov    %eax,%edx
+  8018d5:	c1 ea 08             	shr    $0x8,%edx
+  8018d8:	83 e2 0f             	and    $0xf,%edx
+  8018db:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018e0:	83 fa 06             	cmp    $0x6,%edx
+  8018e3:	74 0e                	je     8018f3 <sys_yield+0x6e>
+  8018e5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8018e8:	0f b6 c9             	movzbl %cl,%ecx
+  8018eb:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8018f1:	eb a1                	jmp    801894 <sys_yield+0xf>
+  8018f3:	89 c2                	mov    %eax,%edx
+  8018f5:	c1 ea 04             	shr    $0x4,%edx
+  8018f8:	83 e2 0f             	and    $0xf,%edx
+  8018fb:	83 fa 02             	cmp    $0x2,%edx
+  8018fe:	77 e5                	ja     8018e5 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  801900:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801903:	83 f8 02             	cmp    $0x2,%eax
+  801906:	0f 97 c1             	seta   %cl
+  801909:	0f b6 c9             	movzbl %cl,%ecx
+  80190c:	eb d7                	jmp    8018e5 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  80190e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801913:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801918:	89 d1                	mov    %edx,%ecx
+  80191a:	89 d3                	mov    %edx,%ebx
+  80191c:	89 d7                	mov    %edx,%edi
+  80191e:	89 d6                	mov    %edx,%esi
+  801920:	cd 30                	int    $0x30
+}
+  801922:	eb 99                	jmp    8018bd <sys_yield+0x38>
+
+00801924 <sys_env_set_status>:
+{
+  801924:	55                   	push   %ebp
+  801925:	89 e5                	mov    %esp,%ebp
+  801927:	57                   	push   %edi
+  801928:	56                   	push   %esi
+  801929:	53                   	push   %ebx
+  80192a:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80192d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801934:	78 37                	js     80196d <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  801936:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80193d:	74 7a                	je     8019b9 <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  80193f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801944:	8b 55 08             	mov    0x8(%ebp),%edx
+  801947:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80194a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80194f:	89 df                	mov    %ebx,%edi
+  801951:	89 de                	mov    %ebx,%esi
+  801953:	55                   	push   %ebp
+  801954:	68 5d 19 80 00       	push   $0x80195d
+  801959:	89 e5                	mov    %esp,%ebp
+  80195b:	0f 34                	sysenter
+  80195d:	83 c4 04             	add    $0x4,%esp
+  801960:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801961:	85 c0                	test   %eax,%eax
+  801963:	7f 6c                	jg     8019d1 <sys_env_set_status+0xad>
+}
+  801965:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801968:	5b                   	pop    %ebx
+  801969:	5e                   	pop    %esi
+  80196a:	5f                   	pop    %edi
+  80196b:	5d                   	pop    %ebp
+  80196c:	c3                   	ret
+  80196d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801972:	0f a2                	cpuid
+		return 0;
+  801974:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801979:	f6 c6 08             	test   $0x8,%dh
+  80197c:	74 15                	je     801993 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80197e:	89 c2                	mov    %eax,%edx
+  801980:	c1 ea 08             	shr    $0x8,%edx
+  801983:	83 e2 0f             	and    $0xf,%edx
+  801986:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80198b:	83 fa 06             	cmp    $0x6,%edx
+  80198e:	74 0e                	je     80199e <sys_env_set_status+0x7a>
+  801990:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801993:	0f b6 c9             	movzbl %cl,%ecx
+  801996:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80199c:	eb 98                	jmp    801936 <sys_env_set_status+0x12>
+  80199e:	89 c2                	mov    %eax,%edx
+  8019a0:	c1 ea 04             	shr    $0x4,%edx
+  8019a3:	83 e2 0f             	and    $0xf,%edx
+  8019a6:	83 fa 02             	cmp    $0x2,%edx
+  8019a9:	77 e5                	ja     801990 <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  8019ab:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019ae:	83 f8 02             	cmp    $0x2,%eax
+  8019b1:	0f 97 c1             	seta   %cl
+  8019b4:	0f b6 c9             	movzbl %cl,%ecx
+  8019b7:	eb d7                	jmp    801990 <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  8019b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019be:	b8 08 00 00 00       	mov    $0x8,%eax
+  8019c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019c9:	89 df                	mov    %ebx,%edi
+  8019cb:	89 de                	mov    %ebx,%esi
+  8019cd:	cd 30                	int    $0x30
+  8019cf:	eb 90                	jmp    801961 <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8019d1:	83 ec 0c             	sub    $0xc,%esp
+  8019d4:	50                   	push   %eax
+  8019d5:	6a 08                	push   $0x8
+  8019d7:	68 99 32 80 00       	push   $0x803299
+  8019dc:	6a 4a                	push   $0x4a
+  8019de:	68 b6 32 80 00       	push   $0x8032b6
+  8019e3:	e8 54 ec ff ff       	call   80063c <_panic>
+
+008019e8 <sys_sysinfo>:
+{
+  8019e8:	55                   	push   %ebp
+  8019e9:	89 e5                	mov    %esp,%ebp
+  8019eb:	57                   	push   %edi
+  8019ec:	56                   	push   %esi
+  8019ed:	53                   	push   %ebx
+  8019ee:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8019f1:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8019f8:	78 36                	js     801a30 <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  8019fa:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a01:	74 79                	je     801a7c <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  801a03:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a06:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a0b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801a10:	89 cb                	mov    %ecx,%ebx
+  801a12:	89 cf                	mov    %ecx,%edi
+  801a14:	89 ce                	mov    %ecx,%esi
+  801a16:	55                   	push   %ebp
+  801a17:	68 20 1a 80 00       	push   $0x801a20
+  801a1c:	89 e5                	mov    %esp,%ebp
+  801a1e:	0f 34                	sysenter
+  801a20:	83 c4 04             	add    $0x4,%esp
+  801a23:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801a24:	85 c0                	test   %eax,%eax
+  801a26:	7f 6b                	jg     801a93 <sys_sysinfo+0xab>
+}
+  801a28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a2b:	5b                   	pop    %ebx
+  801a2c:	5e                   	pop    %esi
+  801a2d:	5f                   	pop    %edi
+  801a2e:	5d                   	pop    %ebp
+  801a2f:	c3                   	ret
+  801a30:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a35:	0f a2                	cpuid
+		return 0;
+  801a37:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801a3c:	f6 c6 08             	test   $0x8,%dh
+  801a3f:	74 15                	je     801a56 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a41:	89 c2                	mov    %eax,%edx
+  801a43:	c1 ea 08             	shr    $0x8,%edx
+  801a46:	83 e2 0f             	and    $0xf,%edx
+  801a49:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a4e:	83 fa 06             	cmp    $0x6,%edx
+  801a51:	74 0e                	je     801a61 <sys_sysinfo+0x79>
+  801a53:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a56:	0f b6 c9             	movzbl %cl,%ecx
+  801a59:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801a5f:	eb 99                	jmp    8019fa <sys_sysinfo+0x12>
+  801a61:	89 c2                	mov    %eax,%edx
+  801a63:	c1 ea 04             	shr    $0x4,%edx
+  801a66:	83 e2 0f             	and    $0xf,%edx
+  801a69:	83 fa 02             	cmp    $0x2,%edx
+  801a6c:	77 e5                	ja     801a53 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  801a6e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a71:	83 f8 02             	cmp    $0x2,%eax
+  801a74:	0f 97 c1             	seta   %cl
+  801a77:	0f b6 c9             	movzbl %cl,%ecx
+  801a7a:	eb d7                	jmp    801a53 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  801a7c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a81:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801a86:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a89:	89 cb                	mov    %ecx,%ebx
+  801a8b:	89 cf                	mov    %ecx,%edi
+  801a8d:	89 ce                	mov    %ecx,%esi
+  801a8f:	cd 30                	int    $0x30
+  801a91:	eb 91                	jmp    801a24 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a93:	83 ec 0c             	sub    $0xc,%esp
+  801a96:	50                   	push   %eax
+  801a97:	6a 0b                	push   $0xb
+  801a99:	68 99 32 80 00       	push   $0x803299
+  801a9e:	6a 4a                	push   $0x4a
+  801aa0:	68 b6 32 80 00       	push   $0x8032b6
+  801aa5:	e8 92 eb ff ff       	call   80063c <_panic>
+
+00801aaa <sys_env_set_trapframe>:
+{
+  801aaa:	55                   	push   %ebp
+  801aab:	89 e5                	mov    %esp,%ebp
+  801aad:	57                   	push   %edi
+  801aae:	56                   	push   %esi
+  801aaf:	53                   	push   %ebx
+  801ab0:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801ab3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801aba:	78 37                	js     801af3 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  801abc:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ac3:	74 7a                	je     801b3f <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  801ac5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aca:	8b 55 08             	mov    0x8(%ebp),%edx
+  801acd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ad0:	b8 13 00 00 00       	mov    $0x13,%eax
+  801ad5:	89 df                	mov    %ebx,%edi
+  801ad7:	89 de                	mov    %ebx,%esi
+  801ad9:	55                   	push   %ebp
+  801ada:	68 e3 1a 80 00       	push   $0x801ae3
+  801adf:	89 e5                	mov    %esp,%ebp
+  801ae1:	0f 34                	sysenter
+  801ae3:	83 c4 04             	add    $0x4,%esp
+  801ae6:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801ae7:	85 c0                	test   %eax,%eax
+  801ae9:	7f 6c                	jg     801b57 <sys_env_set_trapframe+0xad>
+}
+  801aeb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aee:	5b                   	pop    %ebx
+  801aef:	5e                   	pop    %esi
+  801af0:	5f                   	pop    %edi
+  801af1:	5d                   	pop    %ebp
+  801af2:	c3                   	ret
+  801af3:	b8 01 00 00 00       	mov    $0x1,%eax
+  801af8:	0f a2                	cpuid
+		return 0;
+  801afa:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801aff:	f6 c6 08             	test   $0x8,%dh
+  801b02:	74 15                	je     801b19 <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b04:	89 c2                	mov    %eax,%edx
+  801b06:	c1 ea 08             	shr    $0x8,%edx
+  801b09:	83 e2 0f             	and    $0xf,%edx
+  801b0c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b11:	83 fa 06             	cmp    $0x6,%edx
+  801b14:	74 0e                	je     801b24 <sys_env_set_trapframe+0x7a>
+  801b16:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b19:	0f b6 c9             	movzbl %cl,%ecx
+  801b1c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801b22:	eb 98                	jmp    801abc <sys_env_set_trapframe+0x12>
+  801b24:	89 c2                	mov    %eax,%edx
+  801b26:	c1 ea 04             	shr    $0x4,%edx
+  801b29:	83 e2 0f             	and    $0xf,%edx
+  801b2c:	83 fa 02             	cmp    $0x2,%edx
+  801b2f:	77 e5                	ja     801b16 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  801b31:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b34:	83 f8 02             	cmp    $0x2,%eax
+  801b37:	0f 97 c1             	seta   %cl
+  801b3a:	0f b6 c9             	movzbl %cl,%ecx
+  801b3d:	eb d7                	jmp    801b16 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  801b3f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b44:	b8 13 00 00 00       	mov    $0x13,%eax
+  801b49:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b4c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b4f:	89 df                	mov    %ebx,%edi
+  801b51:	89 de                	mov    %ebx,%esi
+  801b53:	cd 30                	int    $0x30
+  801b55:	eb 90                	jmp    801ae7 <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801b57:	83 ec 0c             	sub    $0xc,%esp
+  801b5a:	50                   	push   %eax
+  801b5b:	6a 13                	push   $0x13
+  801b5d:	68 99 32 80 00       	push   $0x803299
+  801b62:	6a 4a                	push   $0x4a
+  801b64:	68 b6 32 80 00       	push   $0x8032b6
+  801b69:	e8 ce ea ff ff       	call   80063c <_panic>
+
+00801b6e <sys_env_set_stack_limit>:
+{
+  801b6e:	55                   	push   %ebp
+  801b6f:	89 e5                	mov    %esp,%ebp
+  801b71:	57                   	push   %edi
+  801b72:	56                   	push   %esi
+  801b73:	53                   	push   %ebx
+  801b74:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801b77:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b7e:	78 37                	js     801bb7 <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  801b80:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b87:	74 7a                	je     801c03 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  801b89:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b8e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b91:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b94:	b8 19 00 00 00       	mov    $0x19,%eax
+  801b99:	89 df                	mov    %ebx,%edi
+  801b9b:	89 de                	mov    %ebx,%esi
+  801b9d:	55                   	push   %ebp
+  801b9e:	68 a7 1b 80 00       	push   $0x801ba7
+  801ba3:	89 e5                	mov    %esp,%ebp
+  801ba5:	0f 34                	sysenter
+  801ba7:	83 c4 04             	add    $0x4,%esp
+  801baa:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801bab:	85 c0                	test   %eax,%eax
+  801bad:	7f 6c                	jg     801c1b <sys_env_set_stack_limit+0xad>
+}
+  801baf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bb2:	5b                   	pop    %ebx
+  801bb3:	5e                   	pop    %esi
+  801bb4:	5f                   	pop    %edi
+  801bb5:	5d                   	pop    %ebp
+  801bb6:	c3                   	ret
+  801bb7:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bbc:	0f a2                	cpuid
+		return 0;
+  801bbe:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801bc3:	f6 c6 08             	test   $0x8,%dh
+  801bc6:	74 15                	je     801bdd <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bc8:	89 c2                	mov    %eax,%edx
+  801bca:	c1 ea 08             	shr    $0x8,%edx
+  801bcd:	83 e2 0f             	and    $0xf,%edx
+  801bd0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801bd5:	83 fa 06             	cmp    $0x6,%edx
+  801bd8:	74 0e                	je     801be8 <sys_env_set_stack_limit+0x7a>
+  801bda:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801bdd:	0f b6 c9             	movzbl %cl,%ecx
+  801be0:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801be6:	eb 98                	jmp    801b80 <sys_env_set_stack_limit+0x12>
+  801be8:	89 c2                	mov    %eax,%edx
+  801bea:	c1 ea 04             	shr    $0x4,%edx
+  801bed:	83 e2 0f             	and    $0xf,%edx
+  801bf0:	83 fa 02             	cmp    $0x2,%edx
+  801bf3:	77 e5                	ja     801bda <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  801bf5:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bf8:	83 f8 02             	cmp    $0x2,%eax
+  801bfb:	0f 97 c1             	seta   %cl
+  801bfe:	0f b6 c9             	movzbl %cl,%ecx
+  801c01:	eb d7                	jmp    801bda <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  801c03:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c08:	b8 19 00 00 00       	mov    $0x19,%eax
+  801c0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c10:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c13:	89 df                	mov    %ebx,%edi
+  801c15:	89 de                	mov    %ebx,%esi
+  801c17:	cd 30                	int    $0x30
+  801c19:	eb 90                	jmp    801bab <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801c1b:	83 ec 0c             	sub    $0xc,%esp
+  801c1e:	50                   	push   %eax
+  801c1f:	6a 19                	push   $0x19
+  801c21:	68 99 32 80 00       	push   $0x803299
+  801c26:	6a 4a                	push   $0x4a
+  801c28:	68 b6 32 80 00       	push   $0x8032b6
+  801c2d:	e8 0a ea ff ff       	call   80063c <_panic>
+
+00801c32 <sys_env_set_pgfault_upcall>:
+{
+  801c32:	55                   	push   %ebp
+  801c33:	89 e5                	mov    %esp,%ebp
+  801c35:	57                   	push   %edi
+  801c36:	56                   	push   %esi
+  801c37:	53                   	push   %ebx
+  801c38:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801c3b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801c42:	78 37                	js     801c7b <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  801c44:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801c4b:	74 7a                	je     801cc7 <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  801c4d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c52:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c55:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c58:	b8 09 00 00 00       	mov    $0x9,%eax
+  801c5d:	89 df                	mov    %ebx,%edi
+  801c5f:	89 de                	mov    %ebx,%esi
+  801c61:	55                   	push   %ebp
+  801c62:	68 6b 1c 80 00       	push   $0x801c6b
+  801c67:	89 e5                	mov    %esp,%ebp
+  801c69:	0f 34                	sysenter
+  801c6b:	83 c4 04             	add    $0x4,%esp
+  801c6e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801c6f:	85 c0                	test   %eax,%eax
+  801c71:	7f 6c                	jg     801cdf <sys_env_set_pgfault_upcall+0xad>
+}
+  801c73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c76:	5b                   	pop    %ebx
+  801c77:	5e                   	pop    %esi
+  801c78:	5f                   	pop    %edi
+  801c79:	5d                   	pop    %ebp
+  801c7a:	c3                   	ret
+  801c7b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c80:	0f a2                	cpuid
+		return 0;
+  801c82:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801c87:	f6 c6 08             	test   $0x8,%dh
+  801c8a:	74 15                	je     801ca1 <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c8c:	89 c2                	mov    %eax,%edx
+  801c8e:	c1 ea 08             	shr    $0x8,%edx
+  801c91:	83 e2 0f             	and    $0xf,%edx
+  801c94:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801c99:	83 fa 06             	cmp    $0x6,%edx
+  801c9c:	74 0e                	je     801cac <sys_env_set_pgfault_upcall+0x7a>
+  801c9e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801ca1:	0f b6 c9             	movzbl %cl,%ecx
+  801ca4:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801caa:	eb 98                	jmp    801c44 <sys_env_set_pgfault_upcall+0x12>
+  801cac:	89 c2                	mov    %eax,%edx
+  801cae:	c1 ea 04             	shr    $0x4,%edx
+  801cb1:	83 e2 0f             	and    $0xf,%edx
+  801cb4:	83 fa 02             	cmp    $0x2,%edx
+  801cb7:	77 e5                	ja     801c9e <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  801cb9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801cbc:	83 f8 02             	cmp    $0x2,%eax
+  801cbf:	0f 97 c1             	seta   %cl
+  801cc2:	0f b6 c9             	movzbl %cl,%ecx
+  801cc5:	eb d7                	jmp    801c9e <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  801cc7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ccc:	b8 09 00 00 00       	mov    $0x9,%eax
+  801cd1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cd4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cd7:	89 df                	mov    %ebx,%edi
+  801cd9:	89 de                	mov    %ebx,%esi
+  801cdb:	cd 30                	int    $0x30
+  801cdd:	eb 90                	jmp    801c6f <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801cdf:	83 ec 0c             	sub    $0xc,%esp
+  801ce2:	50                   	push   %eax
+  801ce3:	6a 09                	push   $0x9
+  801ce5:	68 99 32 80 00       	push   $0x803299
+  801cea:	6a 4a                	push   $0x4a
+  801cec:	68 b6 32 80 00       	push   $0x8032b6
+  801cf1:	e8 46 e9 ff ff       	call   80063c <_panic>
+
+00801cf6 <sys_ipc_try_send>:
+{
+  801cf6:	55                   	push   %ebp
+  801cf7:	89 e5                	mov    %esp,%ebp
+  801cf9:	57                   	push   %edi
+  801cfa:	56                   	push   %esi
+  801cfb:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801cfc:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801d03:	78 32                	js     801d37 <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  801d05:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801d0c:	74 75                	je     801d83 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801d0e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d11:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d14:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801d19:	be 00 00 00 00       	mov    $0x0,%esi
+  801d1e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d21:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801d24:	55                   	push   %ebp
+  801d25:	68 2e 1d 80 00       	push   $0x801d2e
+  801d2a:	89 e5                	mov    %esp,%ebp
+  801d2c:	0f 34                	sysenter
+  801d2e:	83 c4 04             	add    $0x4,%esp
+  801d31:	5d                   	pop    %ebp
+}
+  801d32:	5b                   	pop    %ebx
+  801d33:	5e                   	pop    %esi
+  801d34:	5f                   	pop    %edi
+  801d35:	5d                   	pop    %ebp
+  801d36:	c3                   	ret
+  801d37:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d3c:	0f a2                	cpuid
+		return 0;
+  801d3e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801d43:	f6 c6 08             	test   $0x8,%dh
+  801d46:	74 15                	je     801d5d <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d48:	89 c2                	mov    %eax,%edx
+  801d4a:	c1 ea 08             	shr    $0x8,%edx
+  801d4d:	83 e2 0f             	and    $0xf,%edx
+  801d50:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d55:	83 fa 06             	cmp    $0x6,%edx
+  801d58:	74 0e                	je     801d68 <sys_ipc_try_send+0x72>
+  801d5a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801d5d:	0f b6 c9             	movzbl %cl,%ecx
+  801d60:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801d66:	eb 9d                	jmp    801d05 <sys_ipc_try_send+0xf>
+  801d68:	89 c2                	mov    %eax,%edx
+  801d6a:	c1 ea 04             	shr    $0x4,%edx
+  801d6d:	83 e2 0f             	and    $0xf,%edx
+  801d70:	83 fa 02             	cmp    $0x2,%edx
+  801d73:	77 e5                	ja     801d5a <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  801d75:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d78:	83 f8 02             	cmp    $0x2,%eax
+  801d7b:	0f 97 c1             	seta   %cl
+  801d7e:	0f b6 c9             	movzbl %cl,%ecx
+  801d81:	eb d7                	jmp    801d5a <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  801d83:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801d88:	be 00 00 00 00       	mov    $0x0,%esi
+  801d8d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d90:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d93:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d96:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801d99:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801d9b:	eb 95                	jmp    801d32 <sys_ipc_try_send+0x3c>
+
+00801d9d <sys_ipc_send>:
+{
+  801d9d:	55                   	push   %ebp
+  801d9e:	89 e5                	mov    %esp,%ebp
+  801da0:	57                   	push   %edi
+  801da1:	56                   	push   %esi
+  801da2:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801da3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801daa:	78 32                	js     801dde <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  801dac:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801db3:	74 75                	je     801e2a <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801db5:	8b 55 08             	mov    0x8(%ebp),%edx
+  801db8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801dbb:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801dc0:	be 00 00 00 00       	mov    $0x0,%esi
+  801dc5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801dc8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801dcb:	55                   	push   %ebp
+  801dcc:	68 d5 1d 80 00       	push   $0x801dd5
+  801dd1:	89 e5                	mov    %esp,%ebp
+  801dd3:	0f 34                	sysenter
+  801dd5:	83 c4 04             	add    $0x4,%esp
+  801dd8:	5d                   	pop    %ebp
+}
+  801dd9:	5b                   	pop    %ebx
+  801dda:	5e                   	pop    %esi
+  801ddb:	5f                   	pop    %edi
+  801ddc:	5d                   	pop    %ebp
+  801ddd:	c3                   	ret
+  801dde:	b8 01 00 00 00       	mov    $0x1,%eax
+  801de3:	0f a2                	cpuid
+		return 0;
+  801de5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801dea:	f6 c6 08             	test   $0x8,%dh
+  801ded:	74 15                	je     801e04 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801def:	89 c2                	mov    %eax,%edx
+  801df1:	c1 ea 08             	shr    $0x8,%edx
+  801df4:	83 e2 0f             	and    $0xf,%edx
+  801df7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801dfc:	83 fa 06             	cmp    $0x6,%edx
+  801dff:	74 0e                	je     801e0f <sys_ipc_send+0x72>
+  801e01:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801e04:	0f b6 c9             	movzbl %cl,%ecx
+  801e07:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801e0d:	eb 9d                	jmp    801dac <sys_ipc_send+0xf>
+  801e0f:	89 c2                	mov    %eax,%edx
+  801e11:	c1 ea 04             	shr    $0x4,%edx
+  801e14:	83 e2 0f             	and    $0xf,%edx
+  801e17:	83 fa 02             	cmp    $0x2,%edx
+  801e1a:	77 e5                	ja     801e01 <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  801e1c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e1f:	83 f8 02             	cmp    $0x2,%eax
+  801e22:	0f 97 c1             	seta   %cl
+  801e25:	0f b6 c9             	movzbl %cl,%ecx
+  801e28:	eb d7                	jmp    801e01 <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  801e2a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801e2f:	be 00 00 00 00       	mov    $0x0,%esi
+  801e34:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e3a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e3d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801e40:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801e42:	eb 95                	jmp    801dd9 <sys_ipc_send+0x3c>
+
+00801e44 <sys_ipc_recv>:
+{
+  801e44:	55                   	push   %ebp
+  801e45:	89 e5                	mov    %esp,%ebp
+  801e47:	57                   	push   %edi
+  801e48:	56                   	push   %esi
+  801e49:	53                   	push   %ebx
+  801e4a:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801e4d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e54:	78 36                	js     801e8c <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  801e56:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e5d:	74 79                	je     801ed8 <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  801e5f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e62:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e67:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801e6c:	89 cb                	mov    %ecx,%ebx
+  801e6e:	89 cf                	mov    %ecx,%edi
+  801e70:	89 ce                	mov    %ecx,%esi
+  801e72:	55                   	push   %ebp
+  801e73:	68 7c 1e 80 00       	push   $0x801e7c
+  801e78:	89 e5                	mov    %esp,%ebp
+  801e7a:	0f 34                	sysenter
+  801e7c:	83 c4 04             	add    $0x4,%esp
+  801e7f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801e80:	85 c0                	test   %eax,%eax
+  801e82:	7f 6b                	jg     801eef <sys_ipc_recv+0xab>
+}
+  801e84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e87:	5b                   	pop    %ebx
+  801e88:	5e                   	pop    %esi
+  801e89:	5f                   	pop    %edi
+  801e8a:	5d                   	pop    %ebp
+  801e8b:	c3                   	ret
+  801e8c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e91:	0f a2                	cpuid
+		return 0;
+  801e93:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801e98:	f6 c6 08             	test   $0x8,%dh
+  801e9b:	74 15                	je     801eb2 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e9d:	89 c2                	mov    %eax,%edx
+  801e9f:	c1 ea 08             	shr    $0x8,%edx
+  801ea2:	83 e2 0f             	and    $0xf,%edx
+  801ea5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801eaa:	83 fa 06             	cmp    $0x6,%edx
+  801ead:	74 0e                	je     801ebd <sys_ipc_recv+0x79>
+  801eaf:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801eb2:	0f b6 c9             	movzbl %cl,%ecx
+  801eb5:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801ebb:	eb 99                	jmp    801e56 <sys_ipc_recv+0x12>
+  801ebd:	89 c2                	mov    %eax,%edx
+  801ebf:	c1 ea 04             	shr    $0x4,%edx
+  801ec2:	83 e2 0f             	and    $0xf,%edx
+  801ec5:	83 fa 02             	cmp    $0x2,%edx
+  801ec8:	77 e5                	ja     801eaf <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  801eca:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ecd:	83 f8 02             	cmp    $0x2,%eax
+  801ed0:	0f 97 c1             	seta   %cl
+  801ed3:	0f b6 c9             	movzbl %cl,%ecx
+  801ed6:	eb d7                	jmp    801eaf <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  801ed8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801edd:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801ee2:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ee5:	89 cb                	mov    %ecx,%ebx
+  801ee7:	89 cf                	mov    %ecx,%edi
+  801ee9:	89 ce                	mov    %ecx,%esi
+  801eeb:	cd 30                	int    $0x30
+  801eed:	eb 91                	jmp    801e80 <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801eef:	83 ec 0c             	sub    $0xc,%esp
+  801ef2:	50                   	push   %eax
+  801ef3:	6a 0d                	push   $0xd
+  801ef5:	68 99 32 80 00       	push   $0x803299
+  801efa:	6a 4a                	push   $0x4a
+  801efc:	68 b6 32 80 00       	push   $0x8032b6
+  801f01:	e8 36 e7 ff ff       	call   80063c <_panic>
+
+00801f06 <sys_ipc_send_range>:
+{
+  801f06:	55                   	push   %ebp
+  801f07:	89 e5                	mov    %esp,%ebp
+  801f09:	57                   	push   %edi
+  801f0a:	56                   	push   %esi
+  801f0b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801f0c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f13:	78 30                	js     801f45 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  801f15:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f1c:	74 73                	je     801f91 <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801f1e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f21:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f24:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801f29:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f2c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801f2f:	8b 75 18             	mov    0x18(%ebp),%esi
+  801f32:	55                   	push   %ebp
+  801f33:	68 3c 1f 80 00       	push   $0x801f3c
+  801f38:	89 e5                	mov    %esp,%ebp
+  801f3a:	0f 34                	sysenter
+  801f3c:	83 c4 04             	add    $0x4,%esp
+  801f3f:	5d                   	pop    %ebp
+}
+  801f40:	5b                   	pop    %ebx
+  801f41:	5e                   	pop    %esi
+  801f42:	5f                   	pop    %edi
+  801f43:	5d                   	pop    %ebp
+  801f44:	c3                   	ret
+  801f45:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f4a:	0f a2                	cpuid
+		return 0;
+  801f4c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801f51:	f6 c6 08             	test   $0x8,%dh
+  801f54:	74 15                	je     801f6b <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f56:	89 c2                	mov    %eax,%edx
+  801f58:	c1 ea 08             	shr    $0x8,%edx
+  801f5b:	83 e2 0f             	and    $0xf,%edx
+  801f5e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f63:	83 fa 06             	cmp    $0x6,%edx
+  801f66:	74 0e                	je     801f76 <sys_ipc_send_range+0x70>
+  801f68:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801f6b:	0f b6 c9             	movzbl %cl,%ecx
+  801f6e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801f74:	eb 9f                	jmp    801f15 <sys_ipc_send_range+0xf>
+  801f76:	89 c2                	mov    %eax,%edx
+  801f78:	c1 ea 04             	shr    $0x4,%edx
+  801f7b:	83 e2 0f             	and    $0xf,%edx
+  801f7e:	83 fa 02             	cmp    $0x2,%edx
+  801f81:	77 e5                	ja     801f68 <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  801f83:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f86:	83 f8 02             	cmp    $0x2,%eax
+  801f89:	0f 97 c1             	seta   %cl
+  801f8c:	0f b6 c9             	movzbl %cl,%ecx
+  801f8f:	eb d7                	jmp    801f68 <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  801f91:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801f96:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f99:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f9c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f9f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801fa2:	8b 75 18             	mov    0x18(%ebp),%esi
+  801fa5:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  801fa7:	eb 97                	jmp    801f40 <sys_ipc_send_range+0x3a>
+
+00801fa9 <sys_ipc_recv_range>:
+{
+  801fa9:	55                   	push   %ebp
+  801faa:	89 e5                	mov    %esp,%ebp
+  801fac:	57                   	push   %edi
+  801fad:	56                   	push   %esi
+  801fae:	53                   	push   %ebx
+  801faf:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801fb2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801fb9:	78 37                	js     801ff2 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  801fbb:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801fc2:	74 7a                	je     80203e <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  801fc4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fc9:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fcc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fcf:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801fd4:	89 df                	mov    %ebx,%edi
+  801fd6:	89 de                	mov    %ebx,%esi
+  801fd8:	55                   	push   %ebp
+  801fd9:	68 e2 1f 80 00       	push   $0x801fe2
+  801fde:	89 e5                	mov    %esp,%ebp
+  801fe0:	0f 34                	sysenter
+  801fe2:	83 c4 04             	add    $0x4,%esp
+  801fe5:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801fe6:	85 c0                	test   %eax,%eax
+  801fe8:	7f 6c                	jg     802056 <sys_ipc_recv_range+0xad>
+}
+  801fea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fed:	5b                   	pop    %ebx
+  801fee:	5e                   	pop    %esi
+  801fef:	5f                   	pop    %edi
+  801ff0:	5d                   	pop    %ebp
+  801ff1:	c3                   	ret
+  801ff2:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ff7:	0f a2                	cpuid
+		return 0;
+  801ff9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801ffe:	f6 c6 08             	test   $0x8,%dh
+  802001:	74 15                	je     802018 <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802003:	89 c2                	mov    %eax,%edx
+  802005:	c1 ea 08             	shr    $0x8,%edx
+  802008:	83 e2 0f             	and    $0xf,%edx
+  80200b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802010:	83 fa 06             	cmp    $0x6,%edx
+  802013:	74 0e                	je     802023 <sys_ipc_recv_range+0x7a>
+  802015:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802018:	0f b6 c9             	movzbl %cl,%ecx
+  80201b:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802021:	eb 98                	jmp    801fbb <sys_ipc_recv_range+0x12>
+  802023:	89 c2                	mov    %eax,%edx
+  802025:	c1 ea 04             	shr    $0x4,%edx
+  802028:	83 e2 0f             	and    $0xf,%edx
+  80202b:	83 fa 02             	cmp    $0x2,%edx
+  80202e:	77 e5                	ja     802015 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  802030:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802033:	83 f8 02             	cmp    $0x2,%eax
+  802036:	0f 97 c1             	seta   %cl
+  802039:	0f b6 c9             	movzbl %cl,%ecx
+  80203c:	eb d7                	jmp    802015 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  80203e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802043:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  802048:	8b 55 08             	mov    0x8(%ebp),%edx
+  80204b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80204e:	89 df                	mov    %ebx,%edi
+  802050:	89 de                	mov    %ebx,%esi
+  802052:	cd 30                	int    $0x30
+  802054:	eb 90                	jmp    801fe6 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802056:	83 ec 0c             	sub    $0xc,%esp
+  802059:	50                   	push   %eax
+  80205a:	6a 1f                	push   $0x1f
+  80205c:	68 99 32 80 00       	push   $0x803299
+  802061:	6a 4a                	push   $0x4a
+  802063:	68 b6 32 80 00       	push   $0x8032b6
+  802068:	e8 cf e5 ff ff       	call   80063c <_panic>
+
+0080206d <sys_ipc_call>:
+{
+  80206d:	55                   	push   %ebp
+  80206e:	89 e5                	mov    %esp,%ebp
+  802070:	57                   	push   %edi
+  802071:	56                   	push   %esi
+  802072:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  802073:	8b 55 08             	mov    0x8(%ebp),%edx
+  802076:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80207b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80207e:	55                   	push   %ebp
+  80207f:	56                   	push   %esi
+  802080:	8b 0e                	mov    (%esi),%ecx
+  802082:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802085:	8b 7e 08             	mov    0x8(%esi),%edi
+  802088:	8b 6e 10             	mov    0x10(%esi),%ebp
+  80208b:	8b 76 0c             	mov    0xc(%esi),%esi
+  80208e:	cd 30                	int    $0x30
+  802090:	87 34 24             	xchg   %esi,(%esp)
+  802093:	89 0e                	mov    %ecx,(%esi)
+  802095:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802098:	89 7e 08             	mov    %edi,0x8(%esi)
+  80209b:	89 6e 10             	mov    %ebp,0x10(%esi)
+  80209e:	8f 46 0c             	pop    0xc(%esi)
+  8020a1:	5d                   	pop    %ebp
+}
+  8020a2:	5b                   	pop    %ebx
+  8020a3:	5e                   	pop    %esi
+  8020a4:	5f                   	pop    %edi
+  8020a5:	5d                   	pop    %ebp
+  8020a6:	c3                   	ret
+
+008020a7 <sys_ipc_reply_wait>:
+{
+  8020a7:	55                   	push   %ebp
+  8020a8:	89 e5                	mov    %esp,%ebp
+  8020aa:	57                   	push   %edi
+  8020ab:	56                   	push   %esi
+  8020ac:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8020ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020b0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8020b5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8020b8:	55                   	push   %ebp
+  8020b9:	56                   	push   %esi
+  8020ba:	8b 0e                	mov    (%esi),%ecx
+  8020bc:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8020bf:	8b 7e 08             	mov    0x8(%esi),%edi
+  8020c2:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8020c5:	8b 76 0c             	mov    0xc(%esi),%esi
+  8020c8:	cd 30                	int    $0x30
+  8020ca:	87 34 24             	xchg   %esi,(%esp)
+  8020cd:	89 0e                	mov    %ecx,(%esi)
+  8020cf:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8020d2:	89 7e 08             	mov    %edi,0x8(%esi)
+  8020d5:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8020d8:	8f 46 0c             	pop    0xc(%esi)
+  8020db:	5d                   	pop    %ebp
+}
+  8020dc:	5b                   	pop    %ebx
+  8020dd:	5e                   	pop    %esi
+  8020de:	5f                   	pop    %edi
+  8020df:	5d                   	pop    %ebp
+  8020e0:	c3                   	ret
+
+008020e1 <sys_ipc_send_msg>:
+{
+  8020e1:	55                   	push   %ebp
+  8020e2:	89 e5                	mov    %esp,%ebp
+  8020e4:	57                   	push   %edi
+  8020e5:	56                   	push   %esi
+  8020e6:	53                   	push   %ebx
+  8020e7:	83 ec 20             	sub    $0x20,%esp
+  8020ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  8020ed:	8b 10                	mov    (%eax),%edx
+  8020ef:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8020f2:	8b 50 04             	mov    0x4(%eax),%edx
+  8020f5:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8020f8:	8b 50 08             	mov    0x8(%eax),%edx
+  8020fb:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  8020fe:	8b 50 0c             	mov    0xc(%eax),%edx
+  802101:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  802104:	8b 40 10             	mov    0x10(%eax),%eax
+  802107:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  80210a:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  80210d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802110:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  802115:	55                   	push   %ebp
+  802116:	56                   	push   %esi
+  802117:	8b 0e                	mov    (%esi),%ecx
+  802119:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80211c:	8b 7e 08             	mov    0x8(%esi),%edi
+  80211f:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802122:	8b 76 0c             	mov    0xc(%esi),%esi
+  802125:	cd 30                	int    $0x30
+  802127:	87 34 24             	xchg   %esi,(%esp)
+  80212a:	89 0e                	mov    %ecx,(%esi)
+  80212c:	89 5e 04             	mov    %ebx,0x4(%esi)
+  80212f:	89 7e 08             	mov    %edi,0x8(%esi)
+  802132:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802135:	8f 46 0c             	pop    0xc(%esi)
+  802138:	5d                   	pop    %ebp
+}
+  802139:	83 c4 20             	add    $0x20,%esp
+  80213c:	5b                   	pop    %ebx
+  80213d:	5e                   	pop    %esi
+  80213e:	5f                   	pop    %edi
+  80213f:	5d                   	pop    %ebp
+  802140:	c3                   	ret
+
+00802141 <sys_fork>:
+{
+  802141:	55                   	push   %ebp
+  802142:	89 e5                	mov    %esp,%ebp
+  802144:	57                   	push   %edi
+  802145:	56                   	push   %esi
+  802146:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802147:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80214e:	78 2e                	js     80217e <sys_fork+0x3d>
+	if (syscall_sysenter)
+  802150:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802157:	74 71                	je     8021ca <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  802159:	ba 00 00 00 00       	mov    $0x0,%edx
+  80215e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802163:	89 d1                	mov    %edx,%ecx
+  802165:	89 d3                	mov    %edx,%ebx
+  802167:	89 d7                	mov    %edx,%edi
+  802169:	89 d6                	mov    %edx,%esi
+  80216b:	55                   	push   %ebp
+  80216c:	68 75 21 80 00       	push   $0x802175
+  802171:	89 e5                	mov    %esp,%ebp
+  802173:	0f 34                	sysenter
+  802175:	83 c4 04             	add    $0x4,%esp
+  802178:	5d                   	pop    %ebp
+}
+  802179:	5b                   	pop    %ebx
+  80217a:	5e                   	pop    %esi
+  80217b:	5f                   	pop    %edi
+  80217c:	5d                   	pop    %ebp
+  80217d:	c3                   	ret
+  80217e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802183:	0f a2                	cpuid
+		return 0;
+  802185:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80218a:	f6 c6 08             	test   $0x8,%dh
+  80218d:	74 15                	je     8021a4 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80218f:	89 c2                	mov    %eax,%edx
+  802191:	c1 ea 08             	shr    $0x8,%edx
+  802194:	83 e2 0f             	and    $0xf,%edx
+  802197:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80219c:	83 fa 06             	cmp    $0x6,%edx
+  80219f:	74 0e                	je     8021af <sys_fork+0x6e>
+  8021a1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8021a4:	0f b6 c9             	movzbl %cl,%ecx
+  8021a7:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8021ad:	eb a1                	jmp    802150 <sys_fork+0xf>
+  8021af:	89 c2                	mov    %eax,%edx
+  8021b1:	c1 ea 04             	shr    $0x4,%edx
+  8021b4:	83 e2 0f             	and    $0xf,%edx
+  8021b7:	83 fa 02             	cmp    $0x2,%edx
+  8021ba:	77 e5                	ja     8021a1 <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  8021bc:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021bf:	83 f8 02             	cmp    $0x2,%eax
+  8021c2:	0f 97 c1             	seta   %cl
+  8021c5:	0f b6 c9             	movzbl %cl,%ecx
+  8021c8:	eb d7                	jmp    8021a1 <sys_fork+0x60>
+		asm volatile("int %1\n"
+  8021ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021cf:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8021d4:	89 d1                	mov    %edx,%ecx
+  8021d6:	89 d3                	mov    %edx,%ebx
+  8021d8:	89 d7                	mov    %edx,%edi
+  8021da:	89 d6                	mov    %edx,%esi
+  8021dc:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  8021de:	eb 99                	jmp    802179 <sys_fork+0x38>
+
+008021e0 <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  8021e0:	55                   	push   %ebp
+  8021e1:	89 e5                	mov    %esp,%ebp
+  8021e3:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  8021e6:	ff 75 14             	push   0x14(%ebp)
+  8021e9:	ff 75 10             	push   0x10(%ebp)
+  8021ec:	ff 75 0c             	push   0xc(%ebp)
+  8021ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021f7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8021fc:	e8 81 ee ff ff       	call   801082 <page_vec_call>
+}
+  802201:	c9                   	leave
+  802202:	c3                   	ret
+
+00802203 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  802203:	55                   	push   %ebp
+  802204:	89 e5                	mov    %esp,%ebp
+  802206:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  802209:	ff 75 18             	push   0x18(%ebp)
+  80220c:	ff 75 14             	push   0x14(%ebp)
+  80220f:	ff 75 10             	push   0x10(%ebp)
+  802212:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802215:	8b 55 08             	mov    0x8(%ebp),%edx
+  802218:	b8 10 00 00 00       	mov    $0x10,%eax
+  80221d:	e8 60 ee ff ff       	call   801082 <page_vec_call>
+}
+  802222:	c9                   	leave
+  802223:	c3                   	ret
+
+00802224 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  802224:	55                   	push   %ebp
+  802225:	89 e5                	mov    %esp,%ebp
+  802227:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  80222a:	ff 75 14             	push   0x14(%ebp)
+  80222d:	ff 75 10             	push   0x10(%ebp)
+  802230:	ff 75 0c             	push   0xc(%ebp)
+  802233:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802238:	8b 55 08             	mov    0x8(%ebp),%edx
+  80223b:	b8 11 00 00 00       	mov    $0x11,%eax
+  802240:	e8 3d ee ff ff       	call   801082 <page_vec_call>
+}
+  802245:	c9                   	leave
+  802246:	c3                   	ret
+
+00802247 <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  802247:	55                   	push   %ebp
+  802248:	89 e5                	mov    %esp,%ebp
+  80224a:	57                   	push   %edi
+  80224b:	56                   	push   %esi
+  80224c:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80224d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802254:	78 32                	js     802288 <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  802256:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80225d:	74 75                	je     8022d4 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  80225f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802262:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802265:	b8 12 00 00 00       	mov    $0x12,%eax
+  80226a:	be 00 00 00 00       	mov    $0x0,%esi
+  80226f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802272:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802275:	55                   	push   %ebp
+  802276:	68 7f 22 80 00       	push   $0x80227f
+  80227b:	89 e5                	mov    %esp,%ebp
+  80227d:	0f 34                	sysenter
+  80227f:	83 c4 04             	add    $0x4,%esp
+  802282:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  802283:	5b                   	pop    %ebx
+  802284:	5e                   	pop    %esi
+  802285:	5f                   	pop    %edi
+  802286:	5d                   	pop    %ebp
+  802287:	c3                   	ret
+  802288:	b8 01 00 00 00       	mov    $0x1,%eax
+  80228d:	0f a2                	cpuid
+		return 0;
+  80228f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802294:	f6 c6 08             	test   $0x8,%dh
+  802297:	74 15                	je     8022ae <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802299:	89 c2                	mov    %eax,%edx
+  80229b:	c1 ea 08             	shr    $0x8,%edx
+  80229e:	83 e2 0f             	and    $0xf,%edx
+  8022a1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8022a6:	83 fa 06             	cmp    $0x6,%edx
+  8022a9:	74 0e                	je     8022b9 <sys_vm_ranges+0x72>
+  8022ab:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8022ae:	0f b6 c9             	movzbl %cl,%ecx
+  8022b1:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8022b7:	eb 9d                	jmp    802256 <sys_vm_ranges+0xf>
+  8022b9:	89 c2                	mov    %eax,%edx
+  8022bb:	c1 ea 04             	shr    $0x4,%edx
+  8022be:	83 e2 0f             	and    $0xf,%edx
+  8022c1:	83 fa 02             	cmp    $0x2,%edx
+  8022c4:	77 e5                	ja     8022ab <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  8022c6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022c9:	83 f8 02             	cmp    $0x2,%eax
+  8022cc:	0f 97 c1             	seta   %cl
+  8022cf:	0f b6 c9             	movzbl %cl,%ecx
+  8022d2:	eb d7                	jmp    8022ab <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  8022d4:	b8 12 00 00 00       	mov    $0x12,%eax
+  8022d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8022de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022e4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8022e7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8022ea:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  8022ec:	eb 95                	jmp    802283 <sys_vm_ranges+0x3c>
+
+008022ee <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  8022ee:	55                   	push   %ebp
+  8022ef:	89 e5                	mov    %esp,%ebp
+  8022f1:	57                   	push   %edi
+  8022f2:	56                   	push   %esi
+  8022f3:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8022f4:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8022fb:	78 31                	js     80232e <sys_spawn+0x40>
+	if (syscall_sysenter)
+  8022fd:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802304:	74 74                	je     80237a <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  802306:	be 00 00 00 00       	mov    $0x0,%esi
+  80230b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80230e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802311:	b8 14 00 00 00       	mov    $0x14,%eax
+  802316:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802319:	89 f7                	mov    %esi,%edi
+  80231b:	55                   	push   %ebp
+  80231c:	68 25 23 80 00       	push   $0x802325
+  802321:	89 e5                	mov    %esp,%ebp
+  802323:	0f 34                	sysenter
+  802325:	83 c4 04             	add    $0x4,%esp
+  802328:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  802329:	5b                   	pop    %ebx
+  80232a:	5e                   	pop    %esi
+  80232b:	5f                   	pop    %edi
+  80232c:	5d                   	pop    %ebp
+  80232d:	c3                   	ret
+  80232e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802333:	0f a2                	cpuid
+		return 0;
+  802335:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80233a:	f6 c6 08             	test   $0x8,%dh
+  80233d:	74 15                	je     802354 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80233f:	89 c2                	mov    %eax,%edx
+  802341:	c1 ea 08             	shr    $0x8,%edx
+  802344:	83 e2 0f             	and    $0xf,%edx
+  802347:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80234c:	83 fa 06             	cmp    $0x6,%edx
+  80234f:	74 0e                	je     80235f <sys_spawn+0x71>
+  802351:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802354:	0f b6 c9             	movzbl %cl,%ecx
+  802357:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80235d:	eb 9e                	jmp    8022fd <sys_spawn+0xf>
+  80235f:	89 c2                	mov    %eax,%edx
+  802361:	c1 ea 04             	shr    $0x4,%edx
+  802364:	83 e2 0f             	and    $0xf,%edx
+  802367:	83 fa 02             	cmp    $0x2,%edx
+  80236a:	77 e5                	ja     802351 <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  80236c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80236f:	83 f8 02             	cmp    $0x2,%eax
+  802372:	0f 97 c1             	seta   %cl
+  802375:	0f b6 c9             	movzbl %cl,%ecx
+  802378:	eb d7                	jmp    802351 <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  80237a:	be 00 00 00 00       	mov    $0x0,%esi
+  80237f:	b8 14 00 00 00       	mov    $0x14,%eax
+  802384:	8b 55 08             	mov    0x8(%ebp),%edx
+  802387:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80238a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80238d:	89 f7                	mov    %esi,%edi
+  80238f:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  802391:	eb 96                	jmp    802329 <sys_spawn+0x3b>
+
+00802393 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  802393:	55                   	push   %ebp
+  802394:	89 e5                	mov    %esp,%ebp
+  802396:	57                   	push   %edi
+  802397:	56                   	push   %esi
+  802398:	53                   	push   %ebx
+  802399:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80239c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8023a3:	78 37                	js     8023dc <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  8023a5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8023ac:	74 7a                	je     802428 <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  8023ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023b9:	b8 15 00 00 00       	mov    $0x15,%eax
+  8023be:	89 df                	mov    %ebx,%edi
+  8023c0:	89 de                	mov    %ebx,%esi
+  8023c2:	55                   	push   %ebp
+  8023c3:	68 cc 23 80 00       	push   $0x8023cc
+  8023c8:	89 e5                	mov    %esp,%ebp
+  8023ca:	0f 34                	sysenter
+  8023cc:	83 c4 04             	add    $0x4,%esp
+  8023cf:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8023d0:	85 c0                	test   %eax,%eax
+  8023d2:	7f 6c                	jg     802440 <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  8023d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023d7:	5b                   	pop    %ebx
+  8023d8:	5e                   	pop    %esi
+  8023d9:	5f                   	pop    %edi
+  8023da:	5d                   	pop    %ebp
+  8023db:	c3                   	ret
+  8023dc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023e1:	0f a2                	cpuid
+		return 0;
+  8023e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8023e8:	f6 c6 08             	test   $0x8,%dh
+  8023eb:	74 15                	je     802402 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023ed:	89 c2                	mov    %eax,%edx
+  8023ef:	c1 ea 08             	shr    $0x8,%edx
+  8023f2:	83 e2 0f             	and    $0xf,%edx
+  8023f5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8023fa:	83 fa 06             	cmp    $0x6,%edx
+  8023fd:	74 0e                	je     80240d <sys_shm_create+0x7a>
+  8023ff:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802402:	0f b6 c9             	movzbl %cl,%ecx
+  802405:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80240b:	eb 98                	jmp    8023a5 <sys_shm_create+0x12>
+  80240d:	89 c2                	mov    %eax,%edx
+  80240f:	c1 ea 04             	shr    $0x4,%edx
+  802412:	83 e2 0f             	and    $0xf,%edx
+  802415:	83 fa 02             	cmp    $0x2,%edx
+  802418:	77 e5                	ja     8023ff <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  80241a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80241d:	83 f8 02             	cmp    $0x2,%eax
+  802420:	0f 97 c1             	seta   %cl
+  802423:	0f b6 c9             	movzbl %cl,%ecx
+  802426:	eb d7                	jmp    8023ff <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  802428:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80242d:	b8 15 00 00 00       	mov    $0x15,%eax
+  802432:	8b 55 08             	mov    0x8(%ebp),%edx
+  802435:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802438:	89 df                	mov    %ebx,%edi
+  80243a:	89 de                	mov    %ebx,%esi
+  80243c:	cd 30                	int    $0x30
+  80243e:	eb 90                	jmp    8023d0 <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802440:	83 ec 0c             	sub    $0xc,%esp
+  802443:	50                   	push   %eax
+  802444:	6a 15                	push   $0x15
+  802446:	68 99 32 80 00       	push   $0x803299
+  80244b:	6a 4a                	push   $0x4a
+  80244d:	68 b6 32 80 00       	push   $0x8032b6
+  802452:	e8 e5 e1 ff ff       	call   80063c <_panic>
+
+00802457 <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  802457:	55                   	push   %ebp
+  802458:	89 e5                	mov    %esp,%ebp
+  80245a:	57                   	push   %edi
+  80245b:	56                   	push   %esi
+  80245c:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80245d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802464:	78 32                	js     802498 <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  802466:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80246d:	74 75                	je     8024e4 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  80246f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802472:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802475:	b8 16 00 00 00       	mov    $0x16,%eax
+  80247a:	be 00 00 00 00       	mov    $0x0,%esi
+  80247f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802482:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802485:	55                   	push   %ebp
+  802486:	68 8f 24 80 00       	push   $0x80248f
+  80248b:	89 e5                	mov    %esp,%ebp
+  80248d:	0f 34                	sysenter
+  80248f:	83 c4 04             	add    $0x4,%esp
+  802492:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  802493:	5b                   	pop    %ebx
+  802494:	5e                   	pop    %esi
+  802495:	5f                   	pop    %edi
+  802496:	5d                   	pop    %ebp
+  802497:	c3                   	ret
+  802498:	b8 01 00 00 00       	mov    $0x1,%eax
+  80249d:	0f a2                	cpuid
+		return 0;
+  80249f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8024a4:	f6 c6 08             	test   $0x8,%dh
+  8024a7:	74 15                	je     8024be <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8024a9:	89 c2                	mov    %eax,%edx
+  8024ab:	c1 ea 08             	shr    $0x8,%edx
+  8024ae:	83 e2 0f             	and    $0xf,%edx
+  8024b1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8024b6:	83 fa 06             	cmp    $0x6,%edx
+  8024b9:	74 0e                	je     8024c9 <sys_shm_attach+0x72>
+  8024bb:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8024be:	0f b6 c9             	movzbl %cl,%ecx
+  8024c1:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8024c7:	eb 9d                	jmp    802466 <sys_shm_attach+0xf>
+  8024c9:	89 c2                	mov    %eax,%edx
+  8024cb:	c1 ea 04             	shr    $0x4,%edx
+  8024ce:	83 e2 0f             	and    $0xf,%edx
+  8024d1:	83 fa 02             	cmp    $0x2,%edx
+  8024d4:	77 e5                	ja     8024bb <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  8024d6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8024d9:	83 f8 02             	cmp    $0x2,%eax
+  8024dc:	0f 97 c1             	seta   %cl
+  8024df:	0f b6 c9             	movzbl %cl,%ecx
+  8024e2:	eb d7                	jmp    8024bb <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  8024e4:	b8 16 00 00 00       	mov    $0x16,%eax
+  8024e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8024ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024f4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8024f7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8024fa:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  8024fc:	eb 95                	jmp    802493 <sys_shm_attach+0x3c>
+
+008024fe <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  8024fe:	55                   	push   %ebp
+  8024ff:	89 e5                	mov    %esp,%ebp
+  802501:	57                   	push   %edi
+  802502:	56                   	push   %esi
+  802503:	53                   	push   %ebx
+  802504:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802507:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80250e:	78 38                	js     802548 <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  802510:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802517:	74 7b                	je     802594 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  802519:	be 00 00 00 00       	mov    $0x0,%esi
+  80251e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802521:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802524:	b8 17 00 00 00       	mov    $0x17,%eax
+  802529:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80252c:	89 f7                	mov    %esi,%edi
+  80252e:	55                   	push   %ebp
+  80252f:	68 38 25 80 00       	push   $0x802538
+  802534:	89 e5                	mov    %esp,%ebp
+  802536:	0f 34                	sysenter
+  802538:	83 c4 04             	add    $0x4,%esp
+  80253b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80253c:	85 c0                	test   %eax,%eax
+  80253e:	7f 6d                	jg     8025ad <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  802540:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802543:	5b                   	pop    %ebx
+  802544:	5e                   	pop    %esi
+  802545:	5f                   	pop    %edi
+  802546:	5d                   	pop    %ebp
+  802547:	c3                   	ret
+  802548:	b8 01 00 00 00       	mov    $0x1,%eax
+  80254d:	0f a2                	cpuid
+		return 0;
+  80254f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802554:	f6 c6 08             	test   $0x8,%dh
+  802557:	74 15                	je     80256e <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802559:	89 c2                	mov    %eax,%edx
+  80255b:	c1 ea 08             	shr    $0x8,%edx
+  80255e:	83 e2 0f             	and    $0xf,%edx
+  802561:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802566:	83 fa 06             	cmp    $0x6,%edx
+  802569:	74 0e                	je     802579 <sys_shm_detach+0x7b>
+  80256b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80256e:	0f b6 c9             	movzbl %cl,%ecx
+  802571:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802577:	eb 97                	jmp    802510 <sys_shm_detach+0x12>
+  802579:	89 c2                	mov    %eax,%edx
+  80257b:	c1 ea 04             	shr    $0x4,%edx
+  80257e:	83 e2 0f             	and    $0xf,%edx
+  802581:	83 fa 02             	cmp    $0x2,%edx
+  802584:	77 e5                	ja     80256b <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  802586:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802589:	83 f8 02             	cmp    $0x2,%eax
+  80258c:	0f 97 c1             	seta   %cl
+  80258f:	0f b6 c9             	movzbl %cl,%ecx
+  802592:	eb d7                	jmp    80256b <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  802594:	be 00 00 00 00       	mov    $0x0,%esi
+  802599:	b8 17 00 00 00       	mov    $0x17,%eax
+  80259e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025a4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8025a7:	89 f7                	mov    %esi,%edi
+  8025a9:	cd 30                	int    $0x30
+  8025ab:	eb 8f                	jmp    80253c <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8025ad:	83 ec 0c             	sub    $0xc,%esp
+  8025b0:	50                   	push   %eax
+  8025b1:	6a 17                	push   $0x17
+  8025b3:	68 99 32 80 00       	push   $0x803299
+  8025b8:	6a 4a                	push   $0x4a
+  8025ba:	68 b6 32 80 00       	push   $0x8032b6
+  8025bf:	e8 78 e0 ff ff       	call   80063c <_panic>
+
+008025c4 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  8025c4:	55                   	push   %ebp
+  8025c5:	89 e5                	mov    %esp,%ebp
+  8025c7:	57                   	push   %edi
+  8025c8:	56                   	push   %esi
+  8025c9:	53                   	push   %ebx
+  8025ca:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8025cd:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8025d4:	78 36                	js     80260c <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  8025d6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8025dd:	74 79                	je     802658 <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  8025df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025e7:	b8 18 00 00 00       	mov    $0x18,%eax
+  8025ec:	89 cb                	mov    %ecx,%ebx
+  8025ee:	89 cf                	mov    %ecx,%edi
+  8025f0:	89 ce                	mov    %ecx,%esi
+  8025f2:	55                   	push   %ebp
+  8025f3:	68 fc 25 80 00       	push   $0x8025fc
+  8025f8:	89 e5                	mov    %esp,%ebp
+  8025fa:	0f 34                	sysenter
+  8025fc:	83 c4 04             	add    $0x4,%esp
+  8025ff:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802600:	85 c0                	test   %eax,%eax
+  802602:	7f 6b                	jg     80266f <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  802604:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802607:	5b                   	pop    %ebx
+  802608:	5e                   	pop    %esi
+  802609:	5f                   	pop    %edi
+  80260a:	5d                   	pop    %ebp
+  80260b:	c3                   	ret
+  80260c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802611:	0f a2                	cpuid
+		return 0;
+  802613:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802618:	f6 c6 08             	test   $0x8,%dh
+  80261b:	74 15                	je     802632 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80261d:	89 c2                	mov    %eax,%edx
+  80261f:	c1 ea 08             	shr    $0x8,%edx
+  802622:	83 e2 0f             	and    $0xf,%edx
+  802625:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80262a:	83 fa 06             	cmp    $0x6,%edx
+  80262d:	74 0e                	je     80263d <sys_shm_remove+0x79>
+  80262f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802632:	0f b6 c9             	movzbl %cl,%ecx
+  802635:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80263b:	eb 99                	jmp    8025d6 <sys_shm_remove+0x12>
+  80263d:	89 c2                	mov    %eax,%edx
+  80263f:	c1 ea 04             	shr    $0x4,%edx
+  802642:	83 e2 0f             	and    $0xf,%edx
+  802645:	83 fa 02             	cmp    $0x2,%edx
+  802648:	77 e5                	ja     80262f <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  80264a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80264d:	83 f8 02             	cmp    $0x2,%eax
+  802650:	0f 97 c1             	seta   %cl
+  802653:	0f b6 c9             	movzbl %cl,%ecx
+  802656:	eb d7                	jmp    80262f <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  802658:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80265d:	b8 18 00 00 00       	mov    $0x18,%eax
+  802662:	8b 55 08             	mov    0x8(%ebp),%edx
+  802665:	89 cb                	mov    %ecx,%ebx
+  802667:	89 cf                	mov    %ecx,%edi
+  802669:	89 ce                	mov    %ecx,%esi
+  80266b:	cd 30                	int    $0x30
+  80266d:	eb 91                	jmp    802600 <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80266f:	83 ec 0c             	sub    $0xc,%esp
+  802672:	50                   	push   %eax
+  802673:	6a 18                	push   $0x18
+  802675:	68 99 32 80 00       	push   $0x803299
+  80267a:	6a 4a                	push   $0x4a
+  80267c:	68 b6 32 80 00       	push   $0x8032b6
+  802681:	e8 b6 df ff ff       	call   80063c <_panic>
+
+00802686 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  802686:	55                   	push   %ebp
+  802687:	89 e5                	mov    %esp,%ebp
+  802689:	57                   	push   %edi
+  80268a:	56                   	push   %esi
+  80268b:	53                   	push   %ebx
+  80268c:	83 ec 0c             	sub    $0xc,%esp
+  80268f:	8b 45 10             	mov    0x10(%ebp),%eax
+  802692:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802695:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  802698:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80269f:	78 32                	js     8026d3 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  8026a1:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8026a8:	74 75                	je     80271f <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  8026aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8026ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026b0:	b8 20 00 00 00       	mov    $0x20,%eax
+  8026b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8026ba:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8026bd:	55                   	push   %ebp
+  8026be:	68 c7 26 80 00       	push   $0x8026c7
+  8026c3:	89 e5                	mov    %esp,%ebp
+  8026c5:	0f 34                	sysenter
+  8026c7:	83 c4 04             	add    $0x4,%esp
+  8026ca:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  8026cb:	83 c4 0c             	add    $0xc,%esp
+  8026ce:	5b                   	pop    %ebx
+  8026cf:	5e                   	pop    %esi
+  8026d0:	5f                   	pop    %edi
+  8026d1:	5d                   	pop    %ebp
+  8026d2:	c3                   	ret
+  8026d3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026d8:	0f a2                	cpuid
+		return 0;
+  8026da:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8026df:	f6 c6 08             	test   $0x8,%dh
+  8026e2:	74 15                	je     8026f9 <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8026e4:	89 c2                	mov    %eax,%edx
+  8026e6:	c1 ea 08             	shr    $0x8,%edx
+  8026e9:	83 e2 0f             	and    $0xf,%edx
+  8026ec:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8026f1:	83 fa 06             	cmp    $0x6,%edx
+  8026f4:	74 0e                	je     802704 <sys_futex_wait+0x7e>
+  8026f6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8026f9:	0f b6 c9             	movzbl %cl,%ecx
+  8026fc:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802702:	eb 9d                	jmp    8026a1 <sys_futex_wait+0x1b>
+  802704:	89 c2                	mov    %eax,%edx
+  802706:	c1 ea 04             	shr    $0x4,%edx
+  802709:	83 e2 0f             	and    $0xf,%edx
+  80270c:	83 fa 02             	cmp    $0x2,%edx
+  80270f:	77 e5                	ja     8026f6 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  802711:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802714:	83 f8 02             	cmp    $0x2,%eax
+  802717:	0f 97 c1             	seta   %cl
+  80271a:	0f b6 c9             	movzbl %cl,%ecx
+  80271d:	eb d7                	jmp    8026f6 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  80271f:	b8 20 00 00 00       	mov    $0x20,%eax
+  802724:	be 00 00 00 00       	mov    $0x0,%esi
+  802729:	8b 55 08             	mov    0x8(%ebp),%edx
+  80272c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80272f:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802732:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  802734:	eb 95                	jmp    8026cb <sys_futex_wait+0x45>
+
+00802736 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  802736:	55                   	push   %ebp
+  802737:	89 e5                	mov    %esp,%ebp
+  802739:	57                   	push   %edi
+  80273a:	56                   	push   %esi
+  80273b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80273c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802743:	78 30                	js     802775 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  802745:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80274c:	74 73                	je     8027c1 <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  80274e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802753:	8b 55 08             	mov    0x8(%ebp),%edx
+  802756:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802759:	b8 21 00 00 00       	mov    $0x21,%eax
+  80275e:	89 df                	mov    %ebx,%edi
+  802760:	89 de                	mov    %ebx,%esi
+  802762:	55                   	push   %ebp
+  802763:	68 6c 27 80 00       	push   $0x80276c
+  802768:	89 e5                	mov    %esp,%ebp
+  80276a:	0f 34                	sysenter
+  80276c:	83 c4 04             	add    $0x4,%esp
+  80276f:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  802770:	5b                   	pop    %ebx
+  802771:	5e                   	pop    %esi
+  802772:	5f                   	pop    %edi
+  802773:	5d                   	pop    %ebp
+  802774:	c3                   	ret
+  802775:	b8 01 00 00 00       	mov    $0x1,%eax
+  80277a:	0f a2                	cpuid
+		return 0;
+  80277c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802781:	f6 c6 08             	test   $0x8,%dh
+  802784:	74 15                	je     80279b <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802786:	89 c2                	mov    %eax,%edx
+  802788:	c1 ea 08             	shr    $0x8,%edx
+  80278b:	83 e2 0f             	and    $0xf,%edx
+  80278e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802793:	83 fa 06             	cmp    $0x6,%edx
+  802796:	74 0e                	je     8027a6 <sys_futex_wake+0x70>
+  802798:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80279b:	0f b6 c9             	movzbl %cl,%ecx
+  80279e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8027a4:	eb 9f                	jmp    802745 <sys_futex_wake+0xf>
+  8027a6:	89 c2                	mov    %eax,%edx
+  8027a8:	c1 ea 04             	shr    $0x4,%edx
+  8027ab:	83 e2 0f             	and    $0xf,%edx
+  8027ae:	83 fa 02             	cmp    $0x2,%edx
+  8027b1:	77 e5                	ja     802798 <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  8027b3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8027b6:	83 f8 02             	cmp    $0x2,%eax
+  8027b9:	0f 97 c1             	seta   %cl
+  8027bc:	0f b6 c9             	movzbl %cl,%ecx
+  8027bf:	eb d7                	jmp    802798 <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  8027c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027c6:	b8 21 00 00 00       	mov    $0x21,%eax
+  8027cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8027ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027d1:	89 df                	mov    %ebx,%edi
+  8027d3:	89 de                	mov    %ebx,%esi
+  8027d5:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  8027d7:	eb 97                	jmp    802770 <sys_futex_wake+0x3a>
+
+008027d9 <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  8027d9:	55                   	push   %ebp
+  8027da:	89 e5                	mov    %esp,%ebp
+  8027dc:	57                   	push   %edi
+  8027dd:	56                   	push   %esi
+  8027de:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8027df:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8027e6:	78 2e                	js     802816 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  8027e8:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8027ef:	74 71                	je     802862 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  8027f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027f6:	b8 22 00 00 00       	mov    $0x22,%eax
+  8027fb:	89 d1                	mov    %edx,%ecx
+  8027fd:	89 d3                	mov    %edx,%ebx
+  8027ff:	89 d7                	mov    %edx,%edi
+  802801:	89 d6                	mov    %edx,%esi
+  802803:	55                   	push   %ebp
+  802804:	68 0d 28 80 00       	push   $0x80280d
+  802809:	89 e5                	mov    %esp,%ebp
+  80280b:	0f 34                	sysenter
+  80280d:	83 c4 04             	add    $0x4,%esp
+  802810:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  802811:	5b                   	pop    %ebx
+  802812:	5e                   	pop    %esi
+  802813:	5f                   	pop    %edi
+  802814:	5d                   	pop    %ebp
+  802815:	c3                   	ret
+  802816:	b8 01 00 00 00       	mov    $0x1,%eax
+  80281b:	0f a2                	cpuid
+		return 0;
+  80281d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802822:	f6 c6 08             	test   $0x8,%dh
+  802825:	74 15                	je     80283c <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802827:	89 c2                	mov    %eax,%edx
+  802829:	c1 ea 08             	shr    $0x8,%edx
+  80282c:	83 e2 0f             	and    $0xf,%edx
+  80282f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802834:	83 fa 06             	cmp    $0x6,%edx
+  802837:	74 0e                	je     802847 <sys_ep_create+0x6e>
+  802839:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80283c:	0f b6 c9             	movzbl %cl,%ecx
+  80283f:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802845:	eb a1                	jmp    8027e8 <sys_ep_create+0xf>
+  802847:	89 c2                	mov    %eax,%edx
+  802849:	c1 ea 04             	shr    $0x4,%edx
+  80284c:	83 e2 0f             	and    $0xf,%edx
+  80284f:	83 fa 02             	cmp    $0x2,%edx
+  802852:	77 e5                	ja     802839 <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  802854:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802857:	83 f8 02             	cmp    $0x2,%eax
+  80285a:	0f 97 c1             	seta   %cl
+  80285d:	0f b6 c9             	movzbl %cl,%ecx
+  802860:	eb d7                	jmp    802839 <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  802862:	ba 00 00 00 00       	mov    $0x0,%edx
+  802867:	b8 22 00 00 00       	mov    $0x22,%eax
+  80286c:	89 d1                	mov    %edx,%ecx
+  80286e:	89 d3                	mov    %edx,%ebx
+  802870:	89 d7                	mov    %edx,%edi
+  802872:	89 d6                	mov    %edx,%esi
+  802874:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  802876:	eb 99                	jmp    802811 <sys_ep_create+0x38>
+
+00802878 <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  802878:	55                   	push   %ebp
+  802879:	89 e5                	mov    %esp,%ebp
+  80287b:	57                   	push   %edi
+  80287c:	56                   	push   %esi
+  80287d:	53                   	push   %ebx
+  80287e:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802881:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802888:	78 36                	js     8028c0 <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  80288a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802891:	74 79                	je     80290c <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  802893:	8b 55 08             	mov    0x8(%ebp),%edx
+  802896:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80289b:	b8 23 00 00 00       	mov    $0x23,%eax
+  8028a0:	89 cb                	mov    %ecx,%ebx
+  8028a2:	89 cf                	mov    %ecx,%edi
+  8028a4:	89 ce                	mov    %ecx,%esi
+  8028a6:	55                   	push   %ebp
+  8028a7:	68 b0 28 80 00       	push   $0x8028b0
+  8028ac:	89 e5                	mov    %esp,%ebp
+  8028ae:	0f 34                	sysenter
+  8028b0:	83 c4 04             	add    $0x4,%esp
+  8028b3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8028b4:	85 c0                	test   %eax,%eax
+  8028b6:	7f 6b                	jg     802923 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  8028b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028bb:	5b                   	pop    %ebx
+  8028bc:	5e                   	pop    %esi
+  8028bd:	5f                   	pop    %edi
+  8028be:	5d                   	pop    %ebp
+  8028bf:	c3                   	ret
+  8028c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028c5:	0f a2                	cpuid
+		return 0;
+  8028c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8028cc:	f6 c6 08             	test   $0x8,%dh
+  8028cf:	74 15                	je     8028e6 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8028d1:	89 c2                	mov    %eax,%edx
+  8028d3:	c1 ea 08             	shr    $0x8,%edx
+  8028d6:	83 e2 0f             	and    $0xf,%edx
+  8028d9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8028de:	83 fa 06             	cmp    $0x6,%edx
+  8028e1:	74 0e                	je     8028f1 <sys_ep_destroy+0x79>
+  8028e3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8028e6:	0f b6 c9             	movzbl %cl,%ecx
+  8028e9:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8028ef:	eb 99                	jmp    80288a <sys_ep_destroy+0x12>
+  8028f1:	89 c2                	mov    %eax,%edx
+  8028f3:	c1 ea 04             	shr    $0x4,%edx
+  8028f6:	83 e2 0f             	and    $0xf,%edx
+  8028f9:	83 fa 02             	cmp    $0x2,%edx
+  8028fc:	77 e5                	ja     8028e3 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  8028fe:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802901:	83 f8 02             	cmp    $0x2,%eax
+  802904:	0f 97 c1             	seta   %cl
+  802907:	0f b6 c9             	movzbl %cl,%ecx
+  80290a:	eb d7                	jmp    8028e3 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  80290c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802911:	b8 23 00 00 00       	mov    $0x23,%eax
+  802916:	8b 55 08             	mov    0x8(%ebp),%edx
+  802919:	89 cb                	mov    %ecx,%ebx
+  80291b:	89 cf                	mov    %ecx,%edi
+  80291d:	89 ce                	mov    %ecx,%esi
+  80291f:	cd 30                	int    $0x30
+  802921:	eb 91                	jmp    8028b4 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802923:	83 ec 0c             	sub    $0xc,%esp
+  802926:	50                   	push   %eax
+  802927:	6a 23                	push   $0x23
+  802929:	68 99 32 80 00       	push   $0x803299
+  80292e:	6a 4a                	push   $0x4a
+  802930:	68 b6 32 80 00       	push   $0x8032b6
+  802935:	e8 02 dd ff ff       	call   80063c <_panic>
+
+0080293a <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  80293a:	55                   	push   %ebp
+  80293b:	89 e5                	mov    %esp,%ebp
+  80293d:	57                   	push   %edi
+  80293e:	56                   	push   %esi
+  80293f:	53                   	push   %ebx
+  802940:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802943:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80294a:	78 37                	js     802983 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  80294c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802953:	74 7a                	je     8029cf <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  802955:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80295a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80295d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802960:	b8 24 00 00 00       	mov    $0x24,%eax
+  802965:	89 df                	mov    %ebx,%edi
+  802967:	89 de                	mov    %ebx,%esi
+  802969:	55                   	push   %ebp
+  80296a:	68 73 29 80 00       	push   $0x802973
+  80296f:	89 e5                	mov    %esp,%ebp
+  802971:	0f 34                	sysenter
+  802973:	83 c4 04             	add    $0x4,%esp
+  802976:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802977:	85 c0                	test   %eax,%eax
+  802979:	7f 6c                	jg     8029e7 <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  80297b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80297e:	5b                   	pop    %ebx
+  80297f:	5e                   	pop    %esi
+  802980:	5f                   	pop    %edi
+  802981:	5d                   	pop    %ebp
+  802982:	c3                   	ret
+  802983:	b8 01 00 00 00       	mov    $0x1,%eax
+  802988:	0f a2                	cpuid
+		return 0;
+  80298a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80298f:	f6 c6 08             	test   $0x8,%dh
+  802992:	74 15                	je     8029a9 <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802994:	89 c2                	mov    %eax,%edx
+  802996:	c1 ea 08             	shr    $0x8,%edx
+  802999:	83 e2 0f             	and    $0xf,%edx
+  80299c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8029a1:	83 fa 06             	cmp    $0x6,%edx
+  8029a4:	74 0e                	je     8029b4 <sys_ep_grant+0x7a>
+  8029a6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8029a9:	0f b6 c9             	movzbl %cl,%ecx
+  8029ac:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8029b2:	eb 98                	jmp    80294c <sys_ep_grant+0x12>
+  8029b4:	89 c2                	mov    %eax,%edx
+  8029b6:	c1 ea 04             	shr    $0x4,%edx
+  8029b9:	83 e2 0f             	and    $0xf,%edx
+  8029bc:	83 fa 02             	cmp    $0x2,%edx
+  8029bf:	77 e5                	ja     8029a6 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  8029c1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8029c4:	83 f8 02             	cmp    $0x2,%eax
+  8029c7:	0f 97 c1             	seta   %cl
+  8029ca:	0f b6 c9             	movzbl %cl,%ecx
+  8029cd:	eb d7                	jmp    8029a6 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  8029cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029d4:	b8 24 00 00 00       	mov    $0x24,%eax
+  8029d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8029dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8029df:	89 df                	mov    %ebx,%edi
+  8029e1:	89 de                	mov    %ebx,%esi
+  8029e3:	cd 30                	int    $0x30
+  8029e5:	eb 90                	jmp    802977 <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8029e7:	83 ec 0c             	sub    $0xc,%esp
+  8029ea:	50                   	push   %eax
+  8029eb:	6a 24                	push   $0x24
+  8029ed:	68 99 32 80 00       	push   $0x803299
+  8029f2:	6a 4a                	push   $0x4a
+  8029f4:	68 b6 32 80 00       	push   $0x8032b6
+  8029f9:	e8 3e dc ff ff       	call   80063c <_panic>
+
+008029fe <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  8029fe:	55                   	push   %ebp
+  8029ff:	89 e5                	mov    %esp,%ebp
+  802a01:	57                   	push   %edi
+  802a02:	56                   	push   %esi
+  802a03:	53                   	push   %ebx
+  802a04:	83 ec 20             	sub    $0x20,%esp
+  802a07:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  802a0a:	8b 10                	mov    (%eax),%edx
+  802a0c:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802a0f:	8b 50 04             	mov    0x4(%eax),%edx
+  802a12:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802a15:	8b 50 08             	mov    0x8(%eax),%edx
+  802a18:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  802a1b:	8b 50 0c             	mov    0xc(%eax),%edx
+  802a1e:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  802a21:	8b 40 10             	mov    0x10(%eax),%eax
+  802a24:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  802a27:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  802a2a:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a2d:	b8 25 00 00 00       	mov    $0x25,%eax
+  802a32:	55                   	push   %ebp
+  802a33:	56                   	push   %esi
+  802a34:	8b 0e                	mov    (%esi),%ecx
+  802a36:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802a39:	8b 7e 08             	mov    0x8(%esi),%edi
+  802a3c:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802a3f:	8b 76 0c             	mov    0xc(%esi),%esi
+  802a42:	cd 30                	int    $0x30
+  802a44:	87 34 24             	xchg   %esi,(%esp)
+  802a47:	89 0e                	mov    %ecx,(%esi)
+  802a49:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802a4c:	89 7e 08             	mov    %edi,0x8(%esi)
+  802a4f:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802a52:	8f 46 0c             	pop    0xc(%esi)
+  802a55:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  802a56:	83 c4 20             	add    $0x20,%esp
+  802a59:	5b                   	pop    %ebx
+  802a5a:	5e                   	pop    %esi
+  802a5b:	5f                   	pop    %edi
+  802a5c:	5d                   	pop    %ebp
+  802a5d:	c3                   	ret
+
+00802a5e <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  802a5e:	55                   	push   %ebp
+  802a5f:	89 e5                	mov    %esp,%ebp
+  802a61:	57                   	push   %edi
+  802a62:	56                   	push   %esi
+  802a63:	53                   	push   %ebx
+  802a64:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  802a67:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a6a:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  802a6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a6f:	b8 26 00 00 00       	mov    $0x26,%eax
+  802a74:	55                   	push   %ebp
+  802a75:	56                   	push   %esi
+  802a76:	8b 0e                	mov    (%esi),%ecx
+  802a78:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802a7b:	8b 7e 08             	mov    0x8(%esi),%edi
+  802a7e:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802a81:	8b 76 0c             	mov    0xc(%esi),%esi
+  802a84:	cd 30                	int    $0x30
+  802a86:	87 34 24             	xchg   %esi,(%esp)
+  802a89:	89 0e                	mov    %ecx,(%esi)
+  802a8b:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802a8e:	89 7e 08             	mov    %edi,0x8(%esi)
+  802a91:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802a94:	8f 46 0c             	pop    0xc(%esi)
+  802a97:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  802a98:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  802a9c:	74 0f                	je     802aad <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  802a9e:	85 c0                	test   %eax,%eax
+  802aa0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802aa5:	0f 48 d1             	cmovs  %ecx,%edx
+  802aa8:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  802aab:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  802aad:	5b                   	pop    %ebx
+  802aae:	5e                   	pop    %esi
+  802aaf:	5f                   	pop    %edi
+  802ab0:	5d                   	pop    %ebp
+  802ab1:	c3                   	ret
+
+00802ab2 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  802ab2:	55                   	push   %ebp
+  802ab3:	89 e5                	mov    %esp,%ebp
+  802ab5:	57                   	push   %edi
+  802ab6:	56                   	push   %esi
+  802ab7:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802ab8:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802abf:	78 2f                	js     802af0 <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  802ac1:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802ac8:	74 72                	je     802b3c <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  802aca:	8b 55 08             	mov    0x8(%ebp),%edx
+  802acd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ad2:	b8 27 00 00 00       	mov    $0x27,%eax
+  802ad7:	89 cb                	mov    %ecx,%ebx
+  802ad9:	89 cf                	mov    %ecx,%edi
+  802adb:	89 ce                	mov    %ecx,%esi
+  802add:	55                   	push   %ebp
+  802ade:	68 e7 2a 80 00       	push   $0x802ae7
+  802ae3:	89 e5                	mov    %esp,%ebp
+  802ae5:	0f 34                	sysenter
+  802ae7:	83 c4 04             	add    $0x4,%esp
+  802aea:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  802aeb:	5b                   	pop    %ebx
+  802aec:	5e                   	pop    %esi
+  802aed:	5f                   	pop    %edi
+  802aee:	5d                   	pop    %ebp
+  802aef:	c3                   	ret
+  802af0:	b8 01 00 00 00       	mov    $0x1,%eax
+  802af5:	0f a2                	cpuid
+		return 0;
+  802af7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802afc:	f6 c6 08             	test   $0x8,%dh
+  802aff:	74 15                	je     802b16 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802b01:	89 c2                	mov    %eax,%edx
+  802b03:	c1 ea 08             	shr    $0x8,%edx
+  802b06:	83 e2 0f             	and    $0xf,%edx
+  802b09:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802b0e:	83 fa 06             	cmp    $0x6,%edx
+  802b11:	74 0e                	je     802b21 <sys_sysring_setup+0x6f>
+  802b13:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802b16:	0f b6 c9             	movzbl %cl,%ecx
+  802b19:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802b1f:	eb a0                	jmp    802ac1 <sys_sysring_setup+0xf>
+  802b21:	89 c2                	mov    %eax,%edx
+  802b23:	c1 ea 04             	shr    $0x4,%edx
+  802b26:	83 e2 0f             	and    $0xf,%edx
+  802b29:	83 fa 02             	cmp    $0x2,%edx
+  802b2c:	77 e5                	ja     802b13 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  802b2e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802b31:	83 f8 02             	cmp    $0x2,%eax
+  802b34:	0f 97 c1             	seta   %cl
+  802b37:	0f b6 c9             	movzbl %cl,%ecx
+  802b3a:	eb d7                	jmp    802b13 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  802b3c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b41:	b8 27 00 00 00       	mov    $0x27,%eax
+  802b46:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b49:	89 cb                	mov    %ecx,%ebx
+  802b4b:	89 cf                	mov    %ecx,%edi
+  802b4d:	89 ce                	mov    %ecx,%esi
+  802b4f:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  802b51:	eb 98                	jmp    802aeb <sys_sysring_setup+0x39>
+
+00802b53 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  802b53:	55                   	push   %ebp
+  802b54:	89 e5                	mov    %esp,%ebp
+  802b56:	57                   	push   %edi
+  802b57:	56                   	push   %esi
+  802b58:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802b59:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802b60:	78 2e                	js     802b90 <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  802b62:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802b69:	74 71                	je     802bdc <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  802b6b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b70:	b8 28 00 00 00       	mov    $0x28,%eax
+  802b75:	89 d1                	mov    %edx,%ecx
+  802b77:	89 d3                	mov    %edx,%ebx
+  802b79:	89 d7                	mov    %edx,%edi
+  802b7b:	89 d6                	mov    %edx,%esi
+  802b7d:	55                   	push   %ebp
+  802b7e:	68 87 2b 80 00       	push   $0x802b87
+  802b83:	89 e5                	mov    %esp,%ebp
+  802b85:	0f 34                	sysenter
+  802b87:	83 c4 04             	add    $0x4,%esp
+  802b8a:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  802b8b:	5b                   	pop    %ebx
+  802b8c:	5e                   	pop    %esi
+  802b8d:	5f                   	pop    %edi
+  802b8e:	5d                   	pop    %ebp
+  802b8f:	c3                   	ret
+  802b90:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b95:	0f a2                	cpuid
+		return 0;
+  802b97:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802b9c:	f6 c6 08             	test   $0x8,%dh
+  802b9f:	74 15                	je     802bb6 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802ba1:	89 c2                	mov    %eax,%edx
+  802ba3:	c1 ea 08             	shr    $0x8,%edx
+  802ba6:	83 e2 0f             	and    $0xf,%edx
+  802ba9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802bae:	83 fa 06             	cmp    $0x6,%edx
+  802bb1:	74 0e                	je     802bc1 <sys_sysring_enter+0x6e>
+  802bb3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802bb6:	0f b6 c9             	movzbl %cl,%ecx
+  802bb9:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802bbf:	eb a1                	jmp    802b62 <sys_sysring_enter+0xf>
+  802bc1:	89 c2                	mov    %eax,%edx
+  802bc3:	c1 ea 04             	shr    $0x4,%edx
+  802bc6:	83 e2 0f             	and    $0xf,%edx
+  802bc9:	83 fa 02             	cmp    $0x2,%edx
+  802bcc:	77 e5                	ja     802bb3 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  802bce:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802bd1:	83 f8 02             	cmp    $0x2,%eax
+  802bd4:	0f 97 c1             	seta   %cl
+  802bd7:	0f b6 c9             	movzbl %cl,%ecx
+  802bda:	eb d7                	jmp    802bb3 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  802bdc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802be1:	b8 28 00 00 00       	mov    $0x28,%eax
+  802be6:	89 d1                	mov    %edx,%ecx
+  802be8:	89 d3                	mov    %edx,%ebx
+  802bea:	89 d7                	mov    %edx,%edi
+  802bec:	89 d6                	mov    %edx,%esi
+  802bee:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  802bf0:	eb 99                	jmp    802b8b <sys_sysring_enter+0x38>
+
+00802bf2 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802bf2:	55                   	push   %ebp
+  802bf3:	89 e5                	mov    %esp,%ebp
+  802bf5:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  802bf8:	83 3d d0 40 80 00 00 	cmpl   $0x0,0x8040d0
+  802bff:	74 0a                	je     802c0b <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  802c01:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c04:	a3 d0 40 80 00       	mov    %eax,0x8040d0
+}
+  802c09:	c9                   	leave
+  802c0a:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE),
+  802c0b:	83 ec 04             	sub    $0x4,%esp
+  802c0e:	6a 07                	push   $0x7
+  802c10:	68 00 f0 bf ee       	push   $0xeebff000
+  802c15:	6a 00                	push   $0x0
+  802c17:	e8 57 e9 ff ff       	call   801573 <sys_page_alloc>
+  802c1c:	83 c4 10             	add    $0x10,%esp
+  802c1f:	85 c0                	test   %eax,%eax
+  802c21:	78 28                	js     802c4b <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  802c23:	83 ec 08             	sub    $0x8,%esp
+  802c26:	68 5d 2c 80 00       	push   $0x802c5d
+  802c2b:	6a 00                	push   $0x0
+  802c2d:	e8 00 f0 ff ff       	call   801c32 <sys_env_set_pgfault_upcall>
+  802c32:	83 c4 10             	add    $0x10,%esp
+  802c35:	85 c0                	test   %eax,%eax
+  802c37:	79 c8                	jns    802c01 <set_pgfault_handler+0xf>
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+  802c39:	50                   	push   %eax
+  802c3a:	68 ec 32 80 00       	push   $0x8032ec
+  802c3f:	6a 24                	push   $0x24
+  802c41:	68 20 33 80 00       	push   $0x803320
+  802c46:	e8 f1 d9 ff ff       	call   80063c <_panic>
+			panic("set_pgfault_handler: sys_page_alloc: %e", r);
+  802c4b:	50                   	push   %eax
+  802c4c:	68 c4 32 80 00       	push   $0x8032c4
+  802c51:	6a 22                	push   $0x22
+  802c53:	68 20 33 80 00       	push   $0x803320
+  802c58:	e8 df d9 ff ff       	call   80063c <_panic>
+
+00802c5d <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802c5d:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802c5e:	a1 d0 40 80 00       	mov    0x8040d0,%eax
+	call *%eax
+  802c63:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802c65:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 0x28(%esp), %ebx		// trap-time eip
+  802c68:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl 0x30(%esp), %eax		// trap-time esp
+  802c6c:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  802c70:	83 e8 04             	sub    $0x4,%eax
+	movl %ebx, (%eax)
+  802c73:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 0x30(%esp)
+  802c75:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp			// skip fault_va and err
+  802c79:	83 c4 08             	add    $0x8,%esp
+	popal
+  802c7c:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp			// skip eip
+  802c7d:	83 c4 04             	add    $0x4,%esp
+	popfl
+  802c80:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802c81:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802c82:	c3                   	ret
+
+00802c83 <dm>:
+  802c83:	55                   	push   %ebp
+  802c84:	57                   	push   %edi
+  802c85:	56                   	push   %esi
+  802c86:	53                   	push   %ebx
+  802c87:	83 ec 24             	sub    $0x24,%esp
+  802c8a:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802c8e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802c92:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802c96:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802c9a:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802c9e:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802ca2:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802ca6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cab:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cb0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802cb5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802cbc:	00 
+  802cbd:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802cc4:	00 
+  802cc5:	89 fb                	mov    %edi,%ebx
+  802cc7:	eb 08                	jmp    802cd1 <dm+0x4e>
+  802cc9:	83 e9 01             	sub    $0x1,%ecx
+  802ccc:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802ccf:	74 68                	je     802d39 <dm+0xb6>
+  802cd1:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802cd5:	01 c0                	add    %eax,%eax
+  802cd7:	89 c6                	mov    %eax,%esi
+  802cd9:	89 d7                	mov    %edx,%edi
+  802cdb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802cdf:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802ce3:	0f ad d0             	shrd   %cl,%edx,%eax
+  802ce6:	d3 ea                	shr    %cl,%edx
+  802ce8:	f6 c1 20             	test   $0x20,%cl
+  802ceb:	74 04                	je     802cf1 <dm+0x6e>
+  802ced:	89 d0                	mov    %edx,%eax
+  802cef:	31 d2                	xor    %edx,%edx
+  802cf1:	83 e0 01             	and    $0x1,%eax
+  802cf4:	89 04 24             	mov    %eax,(%esp)
+  802cf7:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802cfe:	00 
+  802cff:	8b 04 24             	mov    (%esp),%eax
+  802d02:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802d06:	09 f0                	or     %esi,%eax
+  802d08:	09 fa                	or     %edi,%edx
+  802d0a:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802d0e:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802d12:	39 f0                	cmp    %esi,%eax
+  802d14:	89 d5                	mov    %edx,%ebp
+  802d16:	19 fd                	sbb    %edi,%ebp
+  802d18:	72 af                	jb     802cc9 <dm+0x46>
+  802d1a:	29 f0                	sub    %esi,%eax
+  802d1c:	19 fa                	sbb    %edi,%edx
+  802d1e:	89 cf                	mov    %ecx,%edi
+  802d20:	c1 ef 05             	shr    $0x5,%edi
+  802d23:	83 e7 01             	and    $0x1,%edi
+  802d26:	89 fe                	mov    %edi,%esi
+  802d28:	83 f6 01             	xor    $0x1,%esi
+  802d2b:	d3 e6                	shl    %cl,%esi
+  802d2d:	d3 e7                	shl    %cl,%edi
+  802d2f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802d33:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802d37:	eb 90                	jmp    802cc9 <dm+0x46>
+  802d39:	85 db                	test   %ebx,%ebx
+  802d3b:	74 05                	je     802d42 <dm+0xbf>
+  802d3d:	89 03                	mov    %eax,(%ebx)
+  802d3f:	89 53 04             	mov    %edx,0x4(%ebx)
+  802d42:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802d46:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802d4a:	83 c4 24             	add    $0x24,%esp
+  802d4d:	5b                   	pop    %ebx
+  802d4e:	5e                   	pop    %esi
+  802d4f:	5f                   	pop    %edi
+  802d50:	5d                   	pop    %ebp
+  802d51:	c3                   	ret
+
+00802d52 <__udivdi3>:
+  802d52:	83 ec 08             	sub    $0x8,%esp
+  802d55:	6a 00                	push   $0x0
+  802d57:	ff 74 24 1c          	push   0x1c(%esp)
+  802d5b:	ff 74 24 1c          	push   0x1c(%esp)
+  802d5f:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802d63:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802d67:	e8 17 ff ff ff       	call   802c83 <dm>
+  802d6c:	83 c4 14             	add    $0x14,%esp
+  802d6f:	c3                   	ret
+
+00802d70 <__umoddi3>:
+  802d70:	83 ec 18             	sub    $0x18,%esp
+  802d73:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802d77:	50                   	push   %eax
+  802d78:	ff 74 24 2c          	push   0x2c(%esp)
+  802d7c:	ff 74 24 2c          	push   0x2c(%esp)
+  802d80:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802d84:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802d88:	e8 f6 fe ff ff       	call   802c83 <dm>
+  802d8d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802d91:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802d95:	83 c4 24             	add    $0x24,%esp
+  802d98:	c3                   	ret
+
+00802d99 <__divdi3>:
+  802d99:	53                   	push   %ebx
+  802d9a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802d9e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802da2:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  802da6:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  802daa:	85 d2                	test   %edx,%edx
+  802dac:	78 15                	js     802dc3 <__divdi3+0x2a>
+  802dae:	85 db                	test   %ebx,%ebx
+  802db0:	78 34                	js     802de6 <__divdi3+0x4d>
+  802db2:	83 ec 04             	sub    $0x4,%esp
+  802db5:	6a 00                	push   $0x0
+  802db7:	53                   	push   %ebx
+  802db8:	51                   	push   %ecx
+  802db9:	e8 c5 fe ff ff       	call   802c83 <dm>
+  802dbe:	83 c4 10             	add    $0x10,%esp
+  802dc1:	eb 21                	jmp    802de4 <__divdi3+0x4b>
+  802dc3:	f7 d8                	neg    %eax
+  802dc5:	83 d2 00             	adc    $0x0,%edx
+  802dc8:	f7 da                	neg    %edx
+  802dca:	85 db                	test   %ebx,%ebx
+  802dcc:	78 30                	js     802dfe <__divdi3+0x65>
+  802dce:	83 ec 04             	sub    $0x4,%esp
+  802dd1:	6a 00                	push   $0x0
+  802dd3:	53                   	push   %ebx
+  802dd4:	51                   	push   %ecx
+  802dd5:	e8 a9 fe ff ff       	call   802c83 <dm>
+  802dda:	83 c4 10             	add    $0x10,%esp
+  802ddd:	f7 d8                	neg    %eax
+  802ddf:	83 d2 00             	adc    $0x0,%edx
+  802de2:	f7 da                	neg    %edx
+  802de4:	5b                   	pop    %ebx
+  802de5:	c3                   	ret
+  802de6:	83 ec 04             	sub    $0x4,%esp
+  802de9:	6a 00                	push   $0x0
+  802deb:	f7 d9                	neg    %ecx
+  802ded:	83 d3 00             	adc    $0x0,%ebx
+  802df0:	f7 db                	neg    %ebx
+  802df2:	53                   	push   %ebx
+  802df3:	51                   	push   %ecx
+  802df4:	e8 8a fe ff ff       	call   802c83 <dm>
+  802df9:	83 c4 10             	add    $0x10,%esp
+  802dfc:	eb df                	jmp    802ddd <__divdi3+0x44>
+  802dfe:	83 ec 04             	sub    $0x4,%esp
+  802e01:	6a 00                	push   $0x0
+  802e03:	f7 d9                	neg    %ecx
+  802e05:	83 d3 00             	adc    $0x0,%ebx
+  802e08:	f7 db                	neg    %ebx
+  802e0a:	53                   	push   %ebx
+  802e0b:	51                   	push   %ecx
+  802e0c:	e8 72 fe ff ff       	call   802c83 <dm>
+  802e11:	83 c4 10             	add    $0x10,%esp
+  802e14:	eb ce                	jmp    802de4 <__divdi3+0x4b>
+
+00802e16 <__moddi3>:
+  802e16:	55                   	push   %ebp
+  802e17:	57                   	push   %edi
+  802e18:	56                   	push   %esi
+  802e19:	53                   	push   %ebx
+  802e1a:	83 ec 18             	sub    $0x18,%esp
+  802e1d:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802e21:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802e25:	89 f1                	mov    %esi,%ecx
+  802e27:	f7 d9                	neg    %ecx
+  802e29:	89 da                	mov    %ebx,%edx
+  802e2b:	83 d2 00             	adc    $0x0,%edx
+  802e2e:	f7 da                	neg    %edx
+  802e30:	0f 48 ce             	cmovs  %esi,%ecx
+  802e33:	0f 48 d3             	cmovs  %ebx,%edx
+  802e36:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802e3a:	50                   	push   %eax
+  802e3b:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802e3f:	f7 de                	neg    %esi
+  802e41:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802e45:	83 d0 00             	adc    $0x0,%eax
+  802e48:	f7 d8                	neg    %eax
+  802e4a:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802e4f:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802e54:	50                   	push   %eax
+  802e55:	56                   	push   %esi
+  802e56:	89 c8                	mov    %ecx,%eax
+  802e58:	e8 26 fe ff ff       	call   802c83 <dm>
+  802e5d:	83 c4 10             	add    $0x10,%esp
+  802e60:	85 db                	test   %ebx,%ebx
+  802e62:	78 10                	js     802e74 <__moddi3+0x5e>
+  802e64:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802e68:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802e6c:	83 c4 14             	add    $0x14,%esp
+  802e6f:	5b                   	pop    %ebx
+  802e70:	5e                   	pop    %esi
+  802e71:	5f                   	pop    %edi
+  802e72:	5d                   	pop    %ebp
+  802e73:	c3                   	ret
+  802e74:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802e78:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802e7c:	f7 d8                	neg    %eax
+  802e7e:	83 d2 00             	adc    $0x0,%edx
+  802e81:	f7 da                	neg    %edx
+  802e83:	eb e7                	jmp    802e6c <__moddi3+0x56>
@@ -0,0 +1,5032 @@
+
+obj/user/faultwrite:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 0d 00 00 00       	call   80003e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	*(unsigned*)0 = 0;
+  800033:	c7 05 00 00 00 00 00 	movl   $0x0,0x0
+  80003a:	00 00 00 
+}
+  80003d:	c3                   	ret
+
+0080003e <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80003e:	55                   	push   %ebp
+  80003f:	89 e5                	mov    %esp,%ebp
+  800041:	56                   	push   %esi
+  800042:	53                   	push   %ebx
+  800043:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800046:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  800049:	e8 9d 04 00 00       	call   8004eb <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  80004e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800053:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  800059:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80005e:	a3 08 30 80 00       	mov    %eax,0x803008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800063:	85 db                	test   %ebx,%ebx
+  800065:	7e 07                	jle    80006e <libmain+0x30>
+		binaryname = argv[0];
+  800067:	8b 06                	mov    (%esi),%eax
+  800069:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  80006e:	83 ec 08             	sub    $0x8,%esp
+  800071:	56                   	push   %esi
+  800072:	53                   	push   %ebx
+  800073:	e8 bb ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800078:	e8 0a 00 00 00       	call   800087 <exit>
+}
+  80007d:	83 c4 10             	add    $0x10,%esp
+  800080:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800083:	5b                   	pop    %ebx
+  800084:	5e                   	pop    %esi
+  800085:	5d                   	pop    %ebp
+  800086:	c3                   	ret
+
+00800087 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800087:	55                   	push   %ebp
+  800088:	89 e5                	mov    %esp,%ebp
+  80008a:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  80008d:	6a 00                	push   $0x0
+  80008f:	e8 95 03 00 00       	call   800429 <sys_env_destroy>
+}
+  800094:	83 c4 10             	add    $0x10,%esp
+  800097:	c9                   	leave
+  800098:	c3                   	ret
+
+00800099 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800099:	55                   	push   %ebp
+  80009a:	89 e5                	mov    %esp,%ebp
+  80009c:	57                   	push   %edi
+  80009d:	56                   	push   %esi
+  80009e:	53                   	push   %ebx
+  80009f:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  8000a5:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  8000ab:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  8000b1:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  8000b7:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  8000be:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  8000c1:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  8000c8:	00 00 00 
+		if (num == SYS_page_map_vec)
+  8000cb:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  8000d2:	74 76                	je     80014a <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  8000d4:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  8000da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8000dd:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  8000e3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8000ea:	0f 88 06 01 00 00    	js     8001f6 <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  8000f0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8000f7:	0f 84 48 01 00 00    	je     800245 <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  8000fd:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800103:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800109:	be 00 00 00 00       	mov    $0x0,%esi
+  80010e:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800114:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800117:	55                   	push   %ebp
+  800118:	68 21 01 80 00       	push   $0x800121
+  80011d:	89 e5                	mov    %esp,%ebp
+  80011f:	0f 34                	sysenter
+  800121:	83 c4 04             	add    $0x4,%esp
+  800124:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800125:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  80012b:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800131:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800134:	0f 85 9a 01 00 00    	jne    8002d4 <page_vec_call+0x23b>
+  80013a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80013f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800142:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800145:	e9 29 01 00 00       	jmp    800273 <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  80014a:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800150:	8b 45 08             	mov    0x8(%ebp),%eax
+  800153:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800155:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80015c:	78 2f                	js     80018d <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  80015e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800165:	74 72                	je     8001d9 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800167:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  80016d:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800173:	b8 10 00 00 00       	mov    $0x10,%eax
+  800178:	89 fb                	mov    %edi,%ebx
+  80017a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80017d:	55                   	push   %ebp
+  80017e:	68 87 01 80 00       	push   $0x800187
+  800183:	89 e5                	mov    %esp,%ebp
+  800185:	0f 34                	sysenter
+  800187:	83 c4 04             	add    $0x4,%esp
+  80018a:	5d                   	pop    %ebp
+	return ret;
+  80018b:	eb 98                	jmp    800125 <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  80018d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800192:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800194:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800199:	f6 c6 08             	test   $0x8,%dh
+  80019c:	74 15                	je     8001b3 <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80019e:	89 c2                	mov    %eax,%edx
+  8001a0:	c1 ea 08             	shr    $0x8,%edx
+  8001a3:	83 e2 0f             	and    $0xf,%edx
+  8001a6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8001ab:	83 fa 06             	cmp    $0x6,%edx
+  8001ae:	74 0e                	je     8001be <page_vec_call+0x125>
+  8001b0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8001b3:	0f b6 c9             	movzbl %cl,%ecx
+  8001b6:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8001bc:	eb a0                	jmp    80015e <page_vec_call+0xc5>
+  8001be:	89 c2                	mov    %eax,%edx
+  8001c0:	c1 ea 04             	shr    $0x4,%edx
+  8001c3:	83 e2 0f             	and    $0xf,%edx
+  8001c6:	83 fa 02             	cmp    $0x2,%edx
+  8001c9:	77 e5                	ja     8001b0 <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  8001cb:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8001ce:	83 f8 02             	cmp    $0x2,%eax
+  8001d1:	0f 97 c1             	seta   %cl
+  8001d4:	0f b6 c9             	movzbl %cl,%ecx
+  8001d7:	eb d7                	jmp    8001b0 <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  8001d9:	b8 10 00 00 00       	mov    $0x10,%eax
+  8001de:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  8001e4:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  8001ea:	89 fb                	mov    %edi,%ebx
+  8001ec:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8001ef:	cd 30                	int    $0x30
+  8001f1:	e9 2f ff ff ff       	jmp    800125 <page_vec_call+0x8c>
+  8001f6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8001fb:	0f a2                	cpuid
+		return 0;
+  8001fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800202:	f6 c6 08             	test   $0x8,%dh
+  800205:	74 15                	je     80021c <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800207:	89 c2                	mov    %eax,%edx
+  800209:	c1 ea 08             	shr    $0x8,%edx
+  80020c:	83 e2 0f             	and    $0xf,%edx
+  80020f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800214:	83 fa 06             	cmp    $0x6,%edx
+  800217:	74 11                	je     80022a <page_vec_call+0x191>
+  800219:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80021c:	0f b6 c9             	movzbl %cl,%ecx
+  80021f:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800225:	e9 c6 fe ff ff       	jmp    8000f0 <page_vec_call+0x57>
+  80022a:	89 c2                	mov    %eax,%edx
+  80022c:	c1 ea 04             	shr    $0x4,%edx
+  80022f:	83 e2 0f             	and    $0xf,%edx
+  800232:	83 fa 02             	cmp    $0x2,%edx
+  800235:	77 e2                	ja     800219 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800237:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80023a:	83 f8 02             	cmp    $0x2,%eax
+  80023d:	0f 97 c1             	seta   %cl
+  800240:	0f b6 c9             	movzbl %cl,%ecx
+  800243:	eb d4                	jmp    800219 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800245:	be 00 00 00 00       	mov    $0x0,%esi
+  80024a:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800250:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800256:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  80025c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80025f:	cd 30                	int    $0x30
+  800261:	e9 bf fe ff ff       	jmp    800125 <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800266:	29 da                	sub    %ebx,%edx
+			vec++;
+  800268:	83 c6 10             	add    $0x10,%esi
+			n--;
+  80026b:	83 e8 01             	sub    $0x1,%eax
+  80026e:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800273:	85 c0                	test   %eax,%eax
+  800275:	74 58                	je     8002cf <page_vec_call+0x236>
+  800277:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80027a:	39 da                	cmp    %ebx,%edx
+  80027c:	73 e8                	jae    800266 <page_vec_call+0x1cd>
+  80027e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800281:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800284:	84 c9                	test   %cl,%cl
+  800286:	74 06                	je     80028e <page_vec_call+0x1f5>
+  800288:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  80028e:	83 ec 04             	sub    $0x4,%esp
+  800291:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800294:	c1 e0 04             	shl    $0x4,%eax
+  800297:	50                   	push   %eax
+  800298:	ff 75 08             	push   0x8(%ebp)
+  80029b:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  8002a1:	53                   	push   %ebx
+  8002a2:	e8 41 21 00 00       	call   8023e8 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  8002a7:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  8002ad:	89 c2                	mov    %eax,%edx
+  8002af:	c1 e2 0c             	shl    $0xc,%edx
+  8002b2:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  8002b8:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  8002be:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  8002c4:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  8002c7:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  8002ca:	e9 f2 fd ff ff       	jmp    8000c1 <page_vec_call+0x28>
+			r = 0;
+  8002cf:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  8002d4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8002d8:	74 0b                	je     8002e5 <page_vec_call+0x24c>
+		*done = total;
+  8002da:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002dd:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  8002e3:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  8002e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002e8:	5b                   	pop    %ebx
+  8002e9:	5e                   	pop    %esi
+  8002ea:	5f                   	pop    %edi
+  8002eb:	5d                   	pop    %ebp
+  8002ec:	c3                   	ret
+
+008002ed <sys_cputs>:
+{
+  8002ed:	55                   	push   %ebp
+  8002ee:	89 e5                	mov    %esp,%ebp
+  8002f0:	57                   	push   %edi
+  8002f1:	56                   	push   %esi
+  8002f2:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8002f3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8002fa:	78 2d                	js     800329 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  8002fc:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800303:	74 70                	je     800375 <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800305:	b8 00 00 00 00       	mov    $0x0,%eax
+  80030a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80030d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800310:	89 c3                	mov    %eax,%ebx
+  800312:	89 c7                	mov    %eax,%edi
+  800314:	89 c6                	mov    %eax,%esi
+  800316:	55                   	push   %ebp
+  800317:	68 20 03 80 00       	push   $0x800320
+  80031c:	89 e5                	mov    %esp,%ebp
+  80031e:	0f 34                	sysenter
+  800320:	83 c4 04             	add    $0x4,%esp
+  800323:	5d                   	pop    %ebp
+}
+  800324:	5b                   	pop    %ebx
+  800325:	5e                   	pop    %esi
+  800326:	5f                   	pop    %edi
+  800327:	5d                   	pop    %ebp
+  800328:	c3                   	ret
+  800329:	b8 01 00 00 00       	mov    $0x1,%eax
+  80032e:	0f a2                	cpuid
+		return 0;
+  800330:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800335:	f6 c6 08             	test   $0x8,%dh
+  800338:	74 15                	je     80034f <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80033a:	89 c2                	mov    %eax,%edx
+  80033c:	c1 ea 08             	shr    $0x8,%edx
+  80033f:	83 e2 0f             	and    $0xf,%edx
+  800342:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800347:	83 fa 06             	cmp    $0x6,%edx
+  80034a:	74 0e                	je     80035a <sys_cputs+0x6d>
+  80034c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80034f:	0f b6 c9             	movzbl %cl,%ecx
+  800352:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800358:	eb a2                	jmp    8002fc <sys_cputs+0xf>
+  80035a:	89 c2                	mov    %eax,%edx
+  80035c:	c1 ea 04             	shr    $0x4,%edx
+  80035f:	83 e2 0f             	and    $0xf,%edx
+  800362:	83 fa 02             	cmp    $0x2,%edx
+  800365:	77 e5                	ja     80034c <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800367:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80036a:	83 f8 02             	cmp    $0x2,%eax
+  80036d:	0f 97 c1             	seta   %cl
+  800370:	0f b6 c9             	movzbl %cl,%ecx
+  800373:	eb d7                	jmp    80034c <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800375:	b8 00 00 00 00       	mov    $0x0,%eax
+  80037a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80037d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800380:	89 c3                	mov    %eax,%ebx
+  800382:	89 c7                	mov    %eax,%edi
+  800384:	89 c6                	mov    %eax,%esi
+  800386:	cd 30                	int    $0x30
+}
+  800388:	eb 9a                	jmp    800324 <sys_cputs+0x37>
+
+0080038a <sys_cgetc>:
+{
+  80038a:	55                   	push   %ebp
+  80038b:	89 e5                	mov    %esp,%ebp
+  80038d:	57                   	push   %edi
+  80038e:	56                   	push   %esi
+  80038f:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800390:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800397:	78 2e                	js     8003c7 <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  800399:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8003a0:	74 71                	je     800413 <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  8003a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003a7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8003ac:	89 d1                	mov    %edx,%ecx
+  8003ae:	89 d3                	mov    %edx,%ebx
+  8003b0:	89 d7                	mov    %edx,%edi
+  8003b2:	89 d6                	mov    %edx,%esi
+  8003b4:	55                   	push   %ebp
+  8003b5:	68 be 03 80 00       	push   $0x8003be
+  8003ba:	89 e5                	mov    %esp,%ebp
+  8003bc:	0f 34                	sysenter
+  8003be:	83 c4 04             	add    $0x4,%esp
+  8003c1:	5d                   	pop    %ebp
+}
+  8003c2:	5b                   	pop    %ebx
+  8003c3:	5e                   	pop    %esi
+  8003c4:	5f                   	pop    %edi
+  8003c5:	5d                   	pop    %ebp
+  8003c6:	c3                   	ret
+  8003c7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8003cc:	0f a2                	cpuid
+		return 0;
+  8003ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8003d3:	f6 c6 08             	test   $0x8,%dh
+  8003d6:	74 15                	je     8003ed <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8003d8:	89 c2                	mov    %eax,%edx
+  8003da:	c1 ea 08             	shr    $0x8,%edx
+  8003dd:	83 e2 0f             	and    $0xf,%edx
+  8003e0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8003e5:	83 fa 06             	cmp    $0x6,%edx
+  8003e8:	74 0e                	je     8003f8 <sys_cgetc+0x6e>
+  8003ea:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8003ed:	0f b6 c9             	movzbl %cl,%ecx
+  8003f0:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8003f6:	eb a1                	jmp    800399 <sys_cgetc+0xf>
+  8003f8:	89 c2                	mov    %eax,%edx
+  8003fa:	c1 ea 04             	shr    $0x4,%edx
+  8003fd:	83 e2 0f             	and    $0xf,%edx
+  800400:	83 fa 02             	cmp    $0x2,%edx
+  800403:	77 e5                	ja     8003ea <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  800405:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800408:	83 f8 02             	cmp    $0x2,%eax
+  80040b:	0f 97 c1             	seta   %cl
+  80040e:	0f b6 c9             	movzbl %cl,%ecx
+  800411:	eb d7                	jmp    8003ea <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  800413:	ba 00 00 00 00       	mov    $0x0,%edx
+  800418:	b8 01 00 00 00       	mov    $0x1,%eax
+  80041d:	89 d1                	mov    %edx,%ecx
+  80041f:	89 d3                	mov    %edx,%ebx
+  800421:	89 d7                	mov    %edx,%edi
+  800423:	89 d6                	mov    %edx,%esi
+  800425:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800427:	eb 99                	jmp    8003c2 <sys_cgetc+0x38>
+
+00800429 <sys_env_destroy>:
+{
+  800429:	55                   	push   %ebp
+  80042a:	89 e5                	mov    %esp,%ebp
+  80042c:	57                   	push   %edi
+  80042d:	56                   	push   %esi
+  80042e:	53                   	push   %ebx
+  80042f:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800432:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800439:	78 36                	js     800471 <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  80043b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800442:	74 79                	je     8004bd <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  800444:	8b 55 08             	mov    0x8(%ebp),%edx
+  800447:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80044c:	b8 03 00 00 00       	mov    $0x3,%eax
+  800451:	89 cb                	mov    %ecx,%ebx
+  800453:	89 cf                	mov    %ecx,%edi
+  800455:	89 ce                	mov    %ecx,%esi
+  800457:	55                   	push   %ebp
+  800458:	68 61 04 80 00       	push   $0x800461
+  80045d:	89 e5                	mov    %esp,%ebp
+  80045f:	0f 34                	sysenter
+  800461:	83 c4 04             	add    $0x4,%esp
+  800464:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800465:	85 c0                	test   %eax,%eax
+  800467:	7f 6b                	jg     8004d4 <sys_env_destroy+0xab>
+}
+  800469:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80046c:	5b                   	pop    %ebx
+  80046d:	5e                   	pop    %esi
+  80046e:	5f                   	pop    %edi
+  80046f:	5d                   	pop    %ebp
+  800470:	c3                   	ret
+  800471:	b8 01 00 00 00       	mov    $0x1,%eax
+  800476:	0f a2                	cpuid
+		return 0;
+  800478:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80047d:	f6 c6 08             	test   $0x8,%dh
+  800480:	74 15                	je     800497 <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800482:	89 c2                	mov    %eax,%edx
+  800484:	c1 ea 08             	shr    $0x8,%edx
+  800487:	83 e2 0f             	and    $0xf,%edx
+  80048a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80048f:	83 fa 06             	cmp    $0x6,%edx
+  800492:	74 0e                	je     8004a2 <sys_env_destroy+0x79>
+  800494:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800497:	0f b6 c9             	movzbl %cl,%ecx
+  80049a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8004a0:	eb 99                	jmp    80043b <sys_env_destroy+0x12>
+  8004a2:	89 c2                	mov    %eax,%edx
+  8004a4:	c1 ea 04             	shr    $0x4,%edx
+  8004a7:	83 e2 0f             	and    $0xf,%edx
+  8004aa:	83 fa 02             	cmp    $0x2,%edx
+  8004ad:	77 e5                	ja     800494 <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  8004af:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8004b2:	83 f8 02             	cmp    $0x2,%eax
+  8004b5:	0f 97 c1             	seta   %cl
+  8004b8:	0f b6 c9             	movzbl %cl,%ecx
+  8004bb:	eb d7                	jmp    800494 <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  8004bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004c2:	b8 03 00 00 00       	mov    $0x3,%eax
+  8004c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004ca:	89 cb                	mov    %ecx,%ebx
+  8004cc:	89 cf                	mov    %ecx,%edi
+  8004ce:	89 ce                	mov    %ecx,%esi
+  8004d0:	cd 30                	int    $0x30
+  8004d2:	eb 91                	jmp    800465 <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004d4:	83 ec 0c             	sub    $0xc,%esp
+  8004d7:	50                   	push   %eax
+  8004d8:	6a 03                	push   $0x3
+  8004da:	68 ca 27 80 00       	push   $0x8027ca
+  8004df:	6a 4a                	push   $0x4a
+  8004e1:	68 e7 27 80 00       	push   $0x8027e7
+  8004e6:	e8 1e 17 00 00       	call   801c09 <_panic>
+
+008004eb <sys_getenvid>:
+{
+  8004eb:	55                   	push   %ebp
+  8004ec:	89 e5                	mov    %esp,%ebp
+  8004ee:	57                   	push   %edi
+  8004ef:	56                   	push   %esi
+  8004f0:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8004f1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8004f8:	78 2e                	js     800528 <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  8004fa:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800501:	74 71                	je     800574 <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  800503:	ba 00 00 00 00       	mov    $0x0,%edx
+  800508:	b8 02 00 00 00       	mov    $0x2,%eax
+  80050d:	89 d1                	mov    %edx,%ecx
+  80050f:	89 d3                	mov    %edx,%ebx
+  800511:	89 d7                	mov    %edx,%edi
+  800513:	89 d6                	mov    %edx,%esi
+  800515:	55                   	push   %ebp
+  800516:	68 1f 05 80 00       	push   $0x80051f
+  80051b:	89 e5                	mov    %esp,%ebp
+  80051d:	0f 34                	sysenter
+  80051f:	83 c4 04             	add    $0x4,%esp
+  800522:	5d                   	pop    %ebp
+}
+  800523:	5b                   	pop    %ebx
+  800524:	5e                   	pop    %esi
+  800525:	5f                   	pop    %edi
+  800526:	5d                   	pop    %ebp
+  800527:	c3                   	ret
+  800528:	b8 01 00 00 00       	mov    $0x1,%eax
+  80052d:	0f a2                	cpuid
+		return 0;
+  80052f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800534:	f6 c6 08             	test   $0x8,%dh
+  800537:	74 15                	je     80054e <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800539:	89 c2                	mov    %eax,%edx
+  80053b:	c1 ea 08             	shr    $0x8,%edx
+  80053e:	83 e2 0f             	and    $0xf,%edx
+  800541:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800546:	83 fa 06             	cmp    $0x6,%edx
+  800549:	74 0e                	je     800559 <sys_getenvid+0x6e>
+  80054b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80054e:	0f b6 c9             	movzbl %cl,%ecx
+  800551:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800557:	eb a1                	jmp    8004fa <sys_getenvid+0xf>
+  800559:	89 c2                	mov    %eax,%edx
+  80055b:	c1 ea 04             	shr    $0x4,%edx
+  80055e:	83 e2 0f             	and    $0xf,%edx
+  800561:	83 fa 02             	cmp    $0x2,%edx
+  800564:	77 e5                	ja     80054b <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  800566:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800569:	83 f8 02             	cmp    $0x2,%eax
+  80056c:	0f 97 c1             	seta   %cl
+  80056f:	0f b6 c9             	movzbl %cl,%ecx
+  800572:	eb d7                	jmp    80054b <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  800574:	ba 00 00 00 00       	mov    $0x0,%edx
+  800579:	b8 02 00 00 00       	mov    $0x2,%eax
+  80057e:	89 d1                	mov    %edx,%ecx
+  800580:	89 d3                	mov    %edx,%ebx
+  800582:	89 d7                	mov    %edx,%edi
+  800584:	89 d6                	mov    %edx,%esi
+  800586:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  800588:	eb 99                	jmp    800523 <sys_getenvid+0x38>
+
+0080058a <sys_page_alloc>:
+{
+  80058a:	55                   	push   %ebp
+  80058b:	89 e5                	mov    %esp,%ebp
+  80058d:	57                   	push   %edi
+  80058e:	56                   	push   %esi
+  80058f:	53                   	push   %ebx
+  800590:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800593:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80059a:	78 38                	js     8005d4 <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  80059c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8005a3:	74 7b                	je     800620 <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  8005a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8005aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005b0:	b8 04 00 00 00       	mov    $0x4,%eax
+  8005b5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005b8:	89 f7                	mov    %esi,%edi
+  8005ba:	55                   	push   %ebp
+  8005bb:	68 c4 05 80 00       	push   $0x8005c4
+  8005c0:	89 e5                	mov    %esp,%ebp
+  8005c2:	0f 34                	sysenter
+  8005c4:	83 c4 04             	add    $0x4,%esp
+  8005c7:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8005c8:	85 c0                	test   %eax,%eax
+  8005ca:	7f 6d                	jg     800639 <sys_page_alloc+0xaf>
+}
+  8005cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005cf:	5b                   	pop    %ebx
+  8005d0:	5e                   	pop    %esi
+  8005d1:	5f                   	pop    %edi
+  8005d2:	5d                   	pop    %ebp
+  8005d3:	c3                   	ret
+  8005d4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8005d9:	0f a2                	cpuid
+		return 0;
+  8005db:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8005e0:	f6 c6 08             	test   $0x8,%dh
+  8005e3:	74 15                	je     8005fa <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8005e5:	89 c2                	mov    %eax,%edx
+  8005e7:	c1 ea 08             	shr    $0x8,%edx
+  8005ea:	83 e2 0f             	and    $0xf,%edx
+  8005ed:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8005f2:	83 fa 06             	cmp    $0x6,%edx
+  8005f5:	74 0e                	je     800605 <sys_page_alloc+0x7b>
+  8005f7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8005fa:	0f b6 c9             	movzbl %cl,%ecx
+  8005fd:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800603:	eb 97                	jmp    80059c <sys_page_alloc+0x12>
+  800605:	89 c2                	mov    %eax,%edx
+  800607:	c1 ea 04             	shr    $0x4,%edx
+  80060a:	83 e2 0f             	and    $0xf,%edx
+  80060d:	83 fa 02             	cmp    $0x2,%edx
+  800610:	77 e5                	ja     8005f7 <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  800612:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800615:	83 f8 02             	cmp    $0x2,%eax
+  800618:	0f 97 c1             	seta   %cl
+  80061b:	0f b6 c9             	movzbl %cl,%ecx
+  80061e:	eb d7                	jmp    8005f7 <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  800620:	be 00 00 00 00       	mov    $0x0,%esi
+  800625:	b8 04 00 00 00       	mov    $0x4,%eax
+  80062a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80062d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800630:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800633:	89 f7                	mov    %esi,%edi
+  800635:	cd 30                	int    $0x30
+  800637:	eb 8f                	jmp    8005c8 <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800639:	83 ec 0c             	sub    $0xc,%esp
+  80063c:	50                   	push   %eax
+  80063d:	6a 04                	push   $0x4
+  80063f:	68 ca 27 80 00       	push   $0x8027ca
+  800644:	6a 4a                	push   $0x4a
+  800646:	68 e7 27 80 00       	push   $0x8027e7
+  80064b:	e8 b9 15 00 00       	call   801c09 <_panic>
+
+00800650 <sys_page_map>:
+{
+  800650:	55                   	push   %ebp
+  800651:	89 e5                	mov    %esp,%ebp
+  800653:	57                   	push   %edi
+  800654:	56                   	push   %esi
+  800655:	53                   	push   %ebx
+  800656:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800659:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800660:	78 37                	js     800699 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  800662:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800669:	74 7a                	je     8006e5 <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  80066b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80066e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800671:	b8 05 00 00 00       	mov    $0x5,%eax
+  800676:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800679:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80067c:	8b 75 18             	mov    0x18(%ebp),%esi
+  80067f:	55                   	push   %ebp
+  800680:	68 89 06 80 00       	push   $0x800689
+  800685:	89 e5                	mov    %esp,%ebp
+  800687:	0f 34                	sysenter
+  800689:	83 c4 04             	add    $0x4,%esp
+  80068c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80068d:	85 c0                	test   %eax,%eax
+  80068f:	7f 6c                	jg     8006fd <sys_page_map+0xad>
+}
+  800691:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800694:	5b                   	pop    %ebx
+  800695:	5e                   	pop    %esi
+  800696:	5f                   	pop    %edi
+  800697:	5d                   	pop    %ebp
+  800698:	c3                   	ret
+  800699:	b8 01 00 00 00       	mov    $0x1,%eax
+  80069e:	0f a2                	cpuid
+		return 0;
+  8006a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8006a5:	f6 c6 08             	test   $0x8,%dh
+  8006a8:	74 15                	je     8006bf <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8006aa:	89 c2                	mov    %eax,%edx
+  8006ac:	c1 ea 08             	shr    $0x8,%edx
+  8006af:	83 e2 0f             	and    $0xf,%edx
+  8006b2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8006b7:	83 fa 06             	cmp    $0x6,%edx
+  8006ba:	74 0e                	je     8006ca <sys_page_map+0x7a>
+  8006bc:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8006bf:	0f b6 c9             	movzbl %cl,%ecx
+  8006c2:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8006c8:	eb 98                	jmp    800662 <sys_page_map+0x12>
+  8006ca:	89 c2                	mov    %eax,%edx
+  8006cc:	c1 ea 04             	shr    $0x4,%edx
+  8006cf:	83 e2 0f             	and    $0xf,%edx
+  8006d2:	83 fa 02             	cmp    $0x2,%edx
+  8006d5:	77 e5                	ja     8006bc <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  8006d7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8006da:	83 f8 02             	cmp    $0x2,%eax
+  8006dd:	0f 97 c1             	seta   %cl
+  8006e0:	0f b6 c9             	movzbl %cl,%ecx
+  8006e3:	eb d7                	jmp    8006bc <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  8006e5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8006ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006f0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8006f3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8006f6:	8b 75 18             	mov    0x18(%ebp),%esi
+  8006f9:	cd 30                	int    $0x30
+  8006fb:	eb 90                	jmp    80068d <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8006fd:	83 ec 0c             	sub    $0xc,%esp
+  800700:	50                   	push   %eax
+  800701:	6a 05                	push   $0x5
+  800703:	68 ca 27 80 00       	push   $0x8027ca
+  800708:	6a 4a                	push   $0x4a
+  80070a:	68 e7 27 80 00       	push   $0x8027e7
+  80070f:	e8 f5 14 00 00       	call   801c09 <_panic>
+
+00800714 <sys_page_unmap>:
+{
+  800714:	55                   	push   %ebp
+  800715:	89 e5                	mov    %esp,%ebp
+  800717:	57                   	push   %edi
+  800718:	56                   	push   %esi
+  800719:	53                   	push   %ebx
+  80071a:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80071d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800724:	78 37                	js     80075d <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  800726:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80072d:	74 7a                	je     8007a9 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  80072f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800734:	8b 55 08             	mov    0x8(%ebp),%edx
+  800737:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80073a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80073f:	89 df                	mov    %ebx,%edi
+  800741:	89 de                	mov    %ebx,%esi
+  800743:	55                   	push   %ebp
+  800744:	68 4d 07 80 00       	push   $0x80074d
+  800749:	89 e5                	mov    %esp,%ebp
+  80074b:	0f 34                	sysenter
+  80074d:	83 c4 04             	add    $0x4,%esp
+  800750:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800751:	85 c0                	test   %eax,%eax
+  800753:	7f 6c                	jg     8007c1 <sys_page_unmap+0xad>
+}
+  800755:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800758:	5b                   	pop    %ebx
+  800759:	5e                   	pop    %esi
+  80075a:	5f                   	pop    %edi
+  80075b:	5d                   	pop    %ebp
+  80075c:	c3                   	ret
+  80075d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800762:	0f a2                	cpuid
+		return 0;
+  800764:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800769:	f6 c6 08             	test   $0x8,%dh
+  80076c:	74 15                	je     800783 <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80076e:	89 c2                	mov    %eax,%edx
+  800770:	c1 ea 08             	shr    $0x8,%edx
+  800773:	83 e2 0f             	and    $0xf,%edx
+  800776:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80077b:	83 fa 06             	cmp    $0x6,%edx
+  80077e:	74 0e                	je     80078e <sys_page_unmap+0x7a>
+  800780:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800783:	0f b6 c9             	movzbl %cl,%ecx
+  800786:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80078c:	eb 98                	jmp    800726 <sys_page_unmap+0x12>
+  80078e:	89 c2                	mov    %eax,%edx
+  800790:	c1 ea 04             	shr    $0x4,%edx
+  800793:	83 e2 0f             	and    $0xf,%edx
+  800796:	83 fa 02             	cmp    $0x2,%edx
+  800799:	77 e5                	ja     800780 <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  80079b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80079e:	83 f8 02             	cmp    $0x2,%eax
+  8007a1:	0f 97 c1             	seta   %cl
+  8007a4:	0f b6 c9             	movzbl %cl,%ecx
+  8007a7:	eb d7                	jmp    800780 <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  8007a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007ae:	b8 06 00 00 00       	mov    $0x6,%eax
+  8007b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007b9:	89 df                	mov    %ebx,%edi
+  8007bb:	89 de                	mov    %ebx,%esi
+  8007bd:	cd 30                	int    $0x30
+  8007bf:	eb 90                	jmp    800751 <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8007c1:	83 ec 0c             	sub    $0xc,%esp
+  8007c4:	50                   	push   %eax
+  8007c5:	6a 06                	push   $0x6
+  8007c7:	68 ca 27 80 00       	push   $0x8027ca
+  8007cc:	6a 4a                	push   $0x4a
+  8007ce:	68 e7 27 80 00       	push   $0x8027e7
+  8007d3:	e8 31 14 00 00       	call   801c09 <_panic>
+
+008007d8 <sys_page_copy>:
+{
+  8007d8:	55                   	push   %ebp
+  8007d9:	89 e5                	mov    %esp,%ebp
+  8007db:	57                   	push   %edi
+  8007dc:	56                   	push   %esi
+  8007dd:	53                   	push   %ebx
+  8007de:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8007e1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8007e8:	78 37                	js     800821 <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  8007ea:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8007f1:	74 7a                	je     80086d <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  8007f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007f9:	b8 29 00 00 00       	mov    $0x29,%eax
+  8007fe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800801:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800804:	8b 75 18             	mov    0x18(%ebp),%esi
+  800807:	55                   	push   %ebp
+  800808:	68 11 08 80 00       	push   $0x800811
+  80080d:	89 e5                	mov    %esp,%ebp
+  80080f:	0f 34                	sysenter
+  800811:	83 c4 04             	add    $0x4,%esp
+  800814:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800815:	85 c0                	test   %eax,%eax
+  800817:	7f 6c                	jg     800885 <sys_page_copy+0xad>
+}
+  800819:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80081c:	5b                   	pop    %ebx
+  80081d:	5e                   	pop    %esi
+  80081e:	5f                   	pop    %edi
+  80081f:	5d                   	pop    %ebp
+  800820:	c3                   	ret
+  800821:	b8 01 00 00 00       	mov    $0x1,%eax
+  800826:	0f a2                	cpuid
+		return 0;
+  800828:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80082d:	f6 c6 08             	test   $0x8,%dh
+  800830:	74 15                	je     800847 <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800832:	89 c2                	mov    %eax,%edx
+  800834:	c1 ea 08             	shr    $0x8,%edx
+  800837:	83 e2 0f             	and    $0xf,%edx
+  80083a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80083f:	83 fa 06             	cmp    $0x6,%edx
+  800842:	74 0e                	je     800852 <sys_page_copy+0x7a>
+  800844:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800847:	0f b6 c9             	movzbl %cl,%ecx
+  80084a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800850:	eb 98                	jmp    8007ea <sys_page_copy+0x12>
+  800852:	89 c2                	mov    %eax,%edx
+  800854:	c1 ea 04             	shr    $0x4,%edx
+  800857:	83 e2 0f             	and    $0xf,%edx
+  80085a:	83 fa 02             	cmp    $0x2,%edx
+  80085d:	77 e5                	ja     800844 <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  80085f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800862:	83 f8 02             	cmp    $0x2,%eax
+  800865:	0f 97 c1             	seta   %cl
+  800868:	0f b6 c9             	movzbl %cl,%ecx
+  80086b:	eb d7                	jmp    800844 <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  80086d:	b8 29 00 00 00       	mov    $0x29,%eax
+  800872:	8b 55 08             	mov    0x8(%ebp),%edx
+  800875:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800878:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80087b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80087e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800881:	cd 30                	int    $0x30
+  800883:	eb 90                	jmp    800815 <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800885:	83 ec 0c             	sub    $0xc,%esp
+  800888:	50                   	push   %eax
+  800889:	6a 29                	push   $0x29
+  80088b:	68 ca 27 80 00       	push   $0x8027ca
+  800890:	6a 4a                	push   $0x4a
+  800892:	68 e7 27 80 00       	push   $0x8027e7
+  800897:	e8 6d 13 00 00       	call   801c09 <_panic>
+
+0080089c <sys_yield>:
+{
+  80089c:	55                   	push   %ebp
+  80089d:	89 e5                	mov    %esp,%ebp
+  80089f:	57                   	push   %edi
+  8008a0:	56                   	push   %esi
+  8008a1:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8008a2:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8008a9:	78 2e                	js     8008d9 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  8008ab:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8008b2:	74 71                	je     800925 <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  8008b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008b9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8008be:	89 d1                	mov    %edx,%ecx
+  8008c0:	89 d3                	mov    %edx,%ebx
+  8008c2:	89 d7                	mov    %edx,%edi
+  8008c4:	89 d6                	mov    %edx,%esi
+  8008c6:	55                   	push   %ebp
+  8008c7:	68 d0 08 80 00       	push   $0x8008d0
+  8008cc:	89 e5                	mov    %esp,%ebp
+  8008ce:	0f 34                	sysenter
+  8008d0:	83 c4 04             	add    $0x4,%esp
+  8008d3:	5d                   	pop    %ebp
+}
+  8008d4:	5b                   	pop    %ebx
+  8008d5:	5e                   	pop    %esi
+  8008d6:	5f                   	pop    %edi
+  8008d7:	5d                   	pop    %ebp
+  8008d8:	c3                   	ret
+  8008d9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8008de:	0f a2                	cpuid
+		return 0;
+  8008e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8008e5:	f6 c6 08             	test   $0x8,%dh
+  8008e8:	74 15                	je     8008ff <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8008ea:	89 c2                	mov    %eax,%edx
+  8008ec:	c1 ea 08             	shr    $0x8,%edx
+  8008ef:	83 e2 0f             	and    $0xf,%edx
+  8008f2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8008f7:	83 fa 06             	cmp    $0x6,%edx
+  8008fa:	74 0e                	je     80090a <sys_yield+0x6e>
+  8008fc:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8008ff:	0f b6 c9             	movzbl %cl,%ecx
+  800902:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800908:	eb a1                	jmp    8008ab <sys_yield+0xf>
+  80090a:	89 c2                	mov    %eax,%edx
+  80090c:	c1 ea 04             	shr    $0x4,%edx
+  80090f:	83 e2 0f             	and    $0xf,%edx
+  800912:	83 fa 02             	cmp    $0x2,%edx
+  800915:	77 e5                	ja     8008fc <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  800917:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80091a:	83 f8 02             	cmp    $0x2,%eax
+  80091d:	0f 97 c1             	seta   %cl
+  800920:	0f b6 c9             	movzbl %cl,%ecx
+  800923:	eb d7                	jmp    8008fc <sys_yield+0x60>
+		asm volatile("int %1\n"
+  800925:	ba 00 00 00 00       	mov    $0x0,%edx
+  80092a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80092f:	89 d1                	mov    %edx,%ecx
+  800931:	89 d3                	mov    %edx,%ebx
+  800933:	89 d7                	mov    %edx,%edi
+  800935:	89 d6                	mov    %edx,%esi
+  800937:	cd 30                	int    $0x30
+}
+  800939:	eb 99                	jmp    8008d4 <sys_yield+0x38>
+
+0080093b <sys_env_set_status>:
+{
+  80093b:	55                   	push   %ebp
+  80093c:	89 e5                	mov    %esp,%ebp
+  80093e:	57                   	push   %edi
+  80093f:	56                   	push   %esi
+  800940:	53                   	push   %ebx
+  800941:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800944:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80094b:	78 37                	js     800984 <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  80094d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800954:	74 7a                	je     8009d0 <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  800956:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80095b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80095e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800961:	b8 08 00 00 00       	mov    $0x8,%eax
+  800966:	89 df                	mov    %ebx,%edi
+  800968:	89 de                	mov    %ebx,%esi
+  80096a:	55                   	push   %ebp
+  80096b:	68 74 09 80 00       	push   $0x800974
+  800970:	89 e5                	mov    %esp,%ebp
+  800972:	0f 34                	sysenter
+  800974:	83 c4 04             	add    $0x4,%esp
+  800977:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800978:	85 c0                	test   %eax,%eax
+  80097a:	7f 6c                	jg     8009e8 <sys_env_set_status+0xad>
+}
+  80097c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80097f:	5b                   	pop    %ebx
+  800980:	5e                   	pop    %esi
+  800981:	5f                   	pop    %edi
+  800982:	5d                   	pop    %ebp
+  800983:	c3                   	ret
+  800984:	b8 01 00 00 00       	mov    $0x1,%eax
+  800989:	0f a2                	cpuid
+		return 0;
+  80098b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800990:	f6 c6 08             	test   $0x8,%dh
+  800993:	74 15                	je     8009aa <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800995:	89 c2                	mov    %eax,%edx
+  800997:	c1 ea 08             	shr    $0x8,%edx
+  80099a:	83 e2 0f             	and    $0xf,%edx
+  80099d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8009a2:	83 fa 06             	cmp    $0x6,%edx
+  8009a5:	74 0e                	je     8009b5 <sys_env_set_status+0x7a>
+  8009a7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8009aa:	0f b6 c9             	movzbl %cl,%ecx
+  8009ad:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8009b3:	eb 98                	jmp    80094d <sys_env_set_status+0x12>
+  8009b5:	89 c2                	mov    %eax,%edx
+  8009b7:	c1 ea 04             	shr    $0x4,%edx
+  8009ba:	83 e2 0f             	and    $0xf,%edx
+  8009bd:	83 fa 02             	cmp    $0x2,%edx
+  8009c0:	77 e5                	ja     8009a7 <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  8009c2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8009c5:	83 f8 02             	cmp    $0x2,%eax
+  8009c8:	0f 97 c1             	seta   %cl
+  8009cb:	0f b6 c9             	movzbl %cl,%ecx
+  8009ce:	eb d7                	jmp    8009a7 <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  8009d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009d5:	b8 08 00 00 00       	mov    $0x8,%eax
+  8009da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009e0:	89 df                	mov    %ebx,%edi
+  8009e2:	89 de                	mov    %ebx,%esi
+  8009e4:	cd 30                	int    $0x30
+  8009e6:	eb 90                	jmp    800978 <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8009e8:	83 ec 0c             	sub    $0xc,%esp
+  8009eb:	50                   	push   %eax
+  8009ec:	6a 08                	push   $0x8
+  8009ee:	68 ca 27 80 00       	push   $0x8027ca
+  8009f3:	6a 4a                	push   $0x4a
+  8009f5:	68 e7 27 80 00       	push   $0x8027e7
+  8009fa:	e8 0a 12 00 00       	call   801c09 <_panic>
+
+008009ff <sys_sysinfo>:
+{
+  8009ff:	55                   	push   %ebp
+  800a00:	89 e5                	mov    %esp,%ebp
+  800a02:	57                   	push   %edi
+  800a03:	56                   	push   %esi
+  800a04:	53                   	push   %ebx
+  800a05:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800a08:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800a0f:	78 36                	js     800a47 <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  800a11:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800a18:	74 79                	je     800a93 <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  800a1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a1d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a22:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800a27:	89 cb                	mov    %ecx,%ebx
+  800a29:	89 cf                	mov    %ecx,%edi
+  800a2b:	89 ce                	mov    %ecx,%esi
+  800a2d:	55                   	push   %ebp
+  800a2e:	68 37 0a 80 00       	push   $0x800a37
+  800a33:	89 e5                	mov    %esp,%ebp
+  800a35:	0f 34                	sysenter
+  800a37:	83 c4 04             	add    $0x4,%esp
+  800a3a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800a3b:	85 c0                	test   %eax,%eax
+  800a3d:	7f 6b                	jg     800aaa <sys_sysinfo+0xab>
+}
+  800a3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a42:	5b                   	pop    %ebx
+  800a43:	5e                   	pop    %esi
+  800a44:	5f                   	pop    %edi
+  800a45:	5d                   	pop    %ebp
+  800a46:	c3                   	ret
+  800a47:	b8 01 00 00 00       	mov    $0x1,%eax
+  800a4c:	0f a2                	cpuid
+		return 0;
+  800a4e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800a53:	f6 c6 08             	test   $0x8,%dh
+  800a56:	74 15                	je     800a6d <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800a58:	89 c2                	mov    %eax,%edx
+  800a5a:	c1 ea 08             	shr    $0x8,%edx
+  800a5d:	83 e2 0f             	and    $0xf,%edx
+  800a60:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800a65:	83 fa 06             	cmp    $0x6,%edx
+  800a68:	74 0e                	je     800a78 <sys_sysinfo+0x79>
+  800a6a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800a6d:	0f b6 c9             	movzbl %cl,%ecx
+  800a70:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800a76:	eb 99                	jmp    800a11 <sys_sysinfo+0x12>
+  800a78:	89 c2                	mov    %eax,%edx
+  800a7a:	c1 ea 04             	shr    $0x4,%edx
+  800a7d:	83 e2 0f             	and    $0xf,%edx
+  800a80:	83 fa 02             	cmp    $0x2,%edx
+  800a83:	77 e5                	ja     800a6a <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  800a85:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800a88:	83 f8 02             	cmp    $0x2,%eax
+  800a8b:	0f 97 c1             	seta   %cl
+  800a8e:	0f b6 c9             	movzbl %cl,%ecx
+  800a91:	eb d7                	jmp    800a6a <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  800a93:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a98:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800a9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aa0:	89 cb                	mov    %ecx,%ebx
+  800aa2:	89 cf                	mov    %ecx,%edi
+  800aa4:	89 ce                	mov    %ecx,%esi
+  800aa6:	cd 30                	int    $0x30
+  800aa8:	eb 91                	jmp    800a3b <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800aaa:	83 ec 0c             	sub    $0xc,%esp
+  800aad:	50                   	push   %eax
+  800aae:	6a 0b                	push   $0xb
+  800ab0:	68 ca 27 80 00       	push   $0x8027ca
+  800ab5:	6a 4a                	push   $0x4a
+  800ab7:	68 e7 27 80 00       	push   $0x8027e7
+  800abc:	e8 48 11 00 00       	call   801c09 <_panic>
+
+00800ac1 <sys_env_set_trapframe>:
+{
+  800ac1:	55                   	push   %ebp
+  800ac2:	89 e5                	mov    %esp,%ebp
+  800ac4:	57                   	push   %edi
+  800ac5:	56                   	push   %esi
+  800ac6:	53                   	push   %ebx
+  800ac7:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800aca:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ad1:	78 37                	js     800b0a <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  800ad3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ada:	74 7a                	je     800b56 <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  800adc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ae1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ae4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ae7:	b8 13 00 00 00       	mov    $0x13,%eax
+  800aec:	89 df                	mov    %ebx,%edi
+  800aee:	89 de                	mov    %ebx,%esi
+  800af0:	55                   	push   %ebp
+  800af1:	68 fa 0a 80 00       	push   $0x800afa
+  800af6:	89 e5                	mov    %esp,%ebp
+  800af8:	0f 34                	sysenter
+  800afa:	83 c4 04             	add    $0x4,%esp
+  800afd:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800afe:	85 c0                	test   %eax,%eax
+  800b00:	7f 6c                	jg     800b6e <sys_env_set_trapframe+0xad>
+}
+  800b02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b05:	5b                   	pop    %ebx
+  800b06:	5e                   	pop    %esi
+  800b07:	5f                   	pop    %edi
+  800b08:	5d                   	pop    %ebp
+  800b09:	c3                   	ret
+  800b0a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b0f:	0f a2                	cpuid
+		return 0;
+  800b11:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800b16:	f6 c6 08             	test   $0x8,%dh
+  800b19:	74 15                	je     800b30 <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800b1b:	89 c2                	mov    %eax,%edx
+  800b1d:	c1 ea 08             	shr    $0x8,%edx
+  800b20:	83 e2 0f             	and    $0xf,%edx
+  800b23:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800b28:	83 fa 06             	cmp    $0x6,%edx
+  800b2b:	74 0e                	je     800b3b <sys_env_set_trapframe+0x7a>
+  800b2d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800b30:	0f b6 c9             	movzbl %cl,%ecx
+  800b33:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800b39:	eb 98                	jmp    800ad3 <sys_env_set_trapframe+0x12>
+  800b3b:	89 c2                	mov    %eax,%edx
+  800b3d:	c1 ea 04             	shr    $0x4,%edx
+  800b40:	83 e2 0f             	and    $0xf,%edx
+  800b43:	83 fa 02             	cmp    $0x2,%edx
+  800b46:	77 e5                	ja     800b2d <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  800b48:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800b4b:	83 f8 02             	cmp    $0x2,%eax
+  800b4e:	0f 97 c1             	seta   %cl
+  800b51:	0f b6 c9             	movzbl %cl,%ecx
+  800b54:	eb d7                	jmp    800b2d <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  800b56:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b5b:	b8 13 00 00 00       	mov    $0x13,%eax
+  800b60:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b63:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b66:	89 df                	mov    %ebx,%edi
+  800b68:	89 de                	mov    %ebx,%esi
+  800b6a:	cd 30                	int    $0x30
+  800b6c:	eb 90                	jmp    800afe <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b6e:	83 ec 0c             	sub    $0xc,%esp
+  800b71:	50                   	push   %eax
+  800b72:	6a 13                	push   $0x13
+  800b74:	68 ca 27 80 00       	push   $0x8027ca
+  800b79:	6a 4a                	push   $0x4a
+  800b7b:	68 e7 27 80 00       	push   $0x8027e7
+  800b80:	e8 84 10 00 00       	call   801c09 <_panic>
+
+00800b85 <sys_env_set_stack_limit>:
+{
+  800b85:	55                   	push   %ebp
+  800b86:	89 e5                	mov    %esp,%ebp
+  800b88:	57                   	push   %edi
+  800b89:	56                   	push   %esi
+  800b8a:	53                   	push   %ebx
+  800b8b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800b8e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b95:	78 37                	js     800bce <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  800b97:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b9e:	74 7a                	je     800c1a <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  800ba0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ba5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ba8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bab:	b8 19 00 00 00       	mov    $0x19,%eax
+  800bb0:	89 df                	mov    %ebx,%edi
+  800bb2:	89 de                	mov    %ebx,%esi
+  800bb4:	55                   	push   %ebp
+  800bb5:	68 be 0b 80 00       	push   $0x800bbe
+  800bba:	89 e5                	mov    %esp,%ebp
+  800bbc:	0f 34                	sysenter
+  800bbe:	83 c4 04             	add    $0x4,%esp
+  800bc1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800bc2:	85 c0                	test   %eax,%eax
+  800bc4:	7f 6c                	jg     800c32 <sys_env_set_stack_limit+0xad>
+}
+  800bc6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bc9:	5b                   	pop    %ebx
+  800bca:	5e                   	pop    %esi
+  800bcb:	5f                   	pop    %edi
+  800bcc:	5d                   	pop    %ebp
+  800bcd:	c3                   	ret
+  800bce:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bd3:	0f a2                	cpuid
+		return 0;
+  800bd5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800bda:	f6 c6 08             	test   $0x8,%dh
+  800bdd:	74 15                	je     800bf4 <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800bdf:	89 c2                	mov    %eax,%edx
+  800be1:	c1 ea 08             	shr    $0x8,%edx
+  800be4:	83 e2 0f             	and    $0xf,%edx
+  800be7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800bec:	83 fa 06             	cmp    $0x6,%edx
+  800bef:	74 0e                	je     800bff <sys_env_set_stack_limit+0x7a>
+  800bf1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800bf4:	0f b6 c9             	movzbl %cl,%ecx
+  800bf7:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800bfd:	eb 98                	jmp    800b97 <sys_env_set_stack_limit+0x12>
+  800bff:	89 c2                	mov    %eax,%edx
+  800c01:	c1 ea 04             	shr    $0x4,%edx
+  800c04:	83 e2 0f             	and    $0xf,%edx
+  800c07:	83 fa 02             	cmp    $0x2,%edx
+  800c0a:	77 e5                	ja     800bf1 <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  800c0c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c0f:	83 f8 02             	cmp    $0x2,%eax
+  800c12:	0f 97 c1             	seta   %cl
+  800c15:	0f b6 c9             	movzbl %cl,%ecx
+  800c18:	eb d7                	jmp    800bf1 <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  800c1a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c1f:	b8 19 00 00 00       	mov    $0x19,%eax
+  800c24:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c27:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c2a:	89 df                	mov    %ebx,%edi
+  800c2c:	89 de                	mov    %ebx,%esi
+  800c2e:	cd 30                	int    $0x30
+  800c30:	eb 90                	jmp    800bc2 <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c32:	83 ec 0c             	sub    $0xc,%esp
+  800c35:	50                   	push   %eax
+  800c36:	6a 19                	push   $0x19
+  800c38:	68 ca 27 80 00       	push   $0x8027ca
+  800c3d:	6a 4a                	push   $0x4a
+  800c3f:	68 e7 27 80 00       	push   $0x8027e7
+  800c44:	e8 c0 0f 00 00       	call   801c09 <_panic>
+
+00800c49 <sys_env_set_pgfault_upcall>:
+{
+  800c49:	55                   	push   %ebp
+  800c4a:	89 e5                	mov    %esp,%ebp
+  800c4c:	57                   	push   %edi
+  800c4d:	56                   	push   %esi
+  800c4e:	53                   	push   %ebx
+  800c4f:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800c52:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800c59:	78 37                	js     800c92 <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  800c5b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800c62:	74 7a                	je     800cde <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  800c64:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c69:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c6c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c6f:	b8 09 00 00 00       	mov    $0x9,%eax
+  800c74:	89 df                	mov    %ebx,%edi
+  800c76:	89 de                	mov    %ebx,%esi
+  800c78:	55                   	push   %ebp
+  800c79:	68 82 0c 80 00       	push   $0x800c82
+  800c7e:	89 e5                	mov    %esp,%ebp
+  800c80:	0f 34                	sysenter
+  800c82:	83 c4 04             	add    $0x4,%esp
+  800c85:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c86:	85 c0                	test   %eax,%eax
+  800c88:	7f 6c                	jg     800cf6 <sys_env_set_pgfault_upcall+0xad>
+}
+  800c8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c8d:	5b                   	pop    %ebx
+  800c8e:	5e                   	pop    %esi
+  800c8f:	5f                   	pop    %edi
+  800c90:	5d                   	pop    %ebp
+  800c91:	c3                   	ret
+  800c92:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c97:	0f a2                	cpuid
+		return 0;
+  800c99:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800c9e:	f6 c6 08             	test   $0x8,%dh
+  800ca1:	74 15                	je     800cb8 <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ca3:	89 c2                	mov    %eax,%edx
+  800ca5:	c1 ea 08             	shr    $0x8,%edx
+  800ca8:	83 e2 0f             	and    $0xf,%edx
+  800cab:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800cb0:	83 fa 06             	cmp    $0x6,%edx
+  800cb3:	74 0e                	je     800cc3 <sys_env_set_pgfault_upcall+0x7a>
+  800cb5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800cb8:	0f b6 c9             	movzbl %cl,%ecx
+  800cbb:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800cc1:	eb 98                	jmp    800c5b <sys_env_set_pgfault_upcall+0x12>
+  800cc3:	89 c2                	mov    %eax,%edx
+  800cc5:	c1 ea 04             	shr    $0x4,%edx
+  800cc8:	83 e2 0f             	and    $0xf,%edx
+  800ccb:	83 fa 02             	cmp    $0x2,%edx
+  800cce:	77 e5                	ja     800cb5 <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  800cd0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800cd3:	83 f8 02             	cmp    $0x2,%eax
+  800cd6:	0f 97 c1             	seta   %cl
+  800cd9:	0f b6 c9             	movzbl %cl,%ecx
+  800cdc:	eb d7                	jmp    800cb5 <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  800cde:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ce3:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ce8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ceb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cee:	89 df                	mov    %ebx,%edi
+  800cf0:	89 de                	mov    %ebx,%esi
+  800cf2:	cd 30                	int    $0x30
+  800cf4:	eb 90                	jmp    800c86 <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cf6:	83 ec 0c             	sub    $0xc,%esp
+  800cf9:	50                   	push   %eax
+  800cfa:	6a 09                	push   $0x9
+  800cfc:	68 ca 27 80 00       	push   $0x8027ca
+  800d01:	6a 4a                	push   $0x4a
+  800d03:	68 e7 27 80 00       	push   $0x8027e7
+  800d08:	e8 fc 0e 00 00       	call   801c09 <_panic>
+
+00800d0d <sys_ipc_try_send>:
+{
+  800d0d:	55                   	push   %ebp
+  800d0e:	89 e5                	mov    %esp,%ebp
+  800d10:	57                   	push   %edi
+  800d11:	56                   	push   %esi
+  800d12:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800d13:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d1a:	78 32                	js     800d4e <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  800d1c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d23:	74 75                	je     800d9a <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  800d25:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d2b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d30:	be 00 00 00 00       	mov    $0x0,%esi
+  800d35:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d38:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d3b:	55                   	push   %ebp
+  800d3c:	68 45 0d 80 00       	push   $0x800d45
+  800d41:	89 e5                	mov    %esp,%ebp
+  800d43:	0f 34                	sysenter
+  800d45:	83 c4 04             	add    $0x4,%esp
+  800d48:	5d                   	pop    %ebp
+}
+  800d49:	5b                   	pop    %ebx
+  800d4a:	5e                   	pop    %esi
+  800d4b:	5f                   	pop    %edi
+  800d4c:	5d                   	pop    %ebp
+  800d4d:	c3                   	ret
+  800d4e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d53:	0f a2                	cpuid
+		return 0;
+  800d55:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800d5a:	f6 c6 08             	test   $0x8,%dh
+  800d5d:	74 15                	je     800d74 <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d5f:	89 c2                	mov    %eax,%edx
+  800d61:	c1 ea 08             	shr    $0x8,%edx
+  800d64:	83 e2 0f             	and    $0xf,%edx
+  800d67:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d6c:	83 fa 06             	cmp    $0x6,%edx
+  800d6f:	74 0e                	je     800d7f <sys_ipc_try_send+0x72>
+  800d71:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800d74:	0f b6 c9             	movzbl %cl,%ecx
+  800d77:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800d7d:	eb 9d                	jmp    800d1c <sys_ipc_try_send+0xf>
+  800d7f:	89 c2                	mov    %eax,%edx
+  800d81:	c1 ea 04             	shr    $0x4,%edx
+  800d84:	83 e2 0f             	and    $0xf,%edx
+  800d87:	83 fa 02             	cmp    $0x2,%edx
+  800d8a:	77 e5                	ja     800d71 <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  800d8c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d8f:	83 f8 02             	cmp    $0x2,%eax
+  800d92:	0f 97 c1             	seta   %cl
+  800d95:	0f b6 c9             	movzbl %cl,%ecx
+  800d98:	eb d7                	jmp    800d71 <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  800d9a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d9f:	be 00 00 00 00       	mov    $0x0,%esi
+  800da4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800daa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dad:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800db0:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  800db2:	eb 95                	jmp    800d49 <sys_ipc_try_send+0x3c>
+
+00800db4 <sys_ipc_send>:
+{
+  800db4:	55                   	push   %ebp
+  800db5:	89 e5                	mov    %esp,%ebp
+  800db7:	57                   	push   %edi
+  800db8:	56                   	push   %esi
+  800db9:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800dba:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800dc1:	78 32                	js     800df5 <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  800dc3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800dca:	74 75                	je     800e41 <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  800dcc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dcf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd2:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800dd7:	be 00 00 00 00       	mov    $0x0,%esi
+  800ddc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ddf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800de2:	55                   	push   %ebp
+  800de3:	68 ec 0d 80 00       	push   $0x800dec
+  800de8:	89 e5                	mov    %esp,%ebp
+  800dea:	0f 34                	sysenter
+  800dec:	83 c4 04             	add    $0x4,%esp
+  800def:	5d                   	pop    %ebp
+}
+  800df0:	5b                   	pop    %ebx
+  800df1:	5e                   	pop    %esi
+  800df2:	5f                   	pop    %edi
+  800df3:	5d                   	pop    %ebp
+  800df4:	c3                   	ret
+  800df5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dfa:	0f a2                	cpuid
+		return 0;
+  800dfc:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800e01:	f6 c6 08             	test   $0x8,%dh
+  800e04:	74 15                	je     800e1b <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e06:	89 c2                	mov    %eax,%edx
+  800e08:	c1 ea 08             	shr    $0x8,%edx
+  800e0b:	83 e2 0f             	and    $0xf,%edx
+  800e0e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e13:	83 fa 06             	cmp    $0x6,%edx
+  800e16:	74 0e                	je     800e26 <sys_ipc_send+0x72>
+  800e18:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e1b:	0f b6 c9             	movzbl %cl,%ecx
+  800e1e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800e24:	eb 9d                	jmp    800dc3 <sys_ipc_send+0xf>
+  800e26:	89 c2                	mov    %eax,%edx
+  800e28:	c1 ea 04             	shr    $0x4,%edx
+  800e2b:	83 e2 0f             	and    $0xf,%edx
+  800e2e:	83 fa 02             	cmp    $0x2,%edx
+  800e31:	77 e5                	ja     800e18 <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  800e33:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e36:	83 f8 02             	cmp    $0x2,%eax
+  800e39:	0f 97 c1             	seta   %cl
+  800e3c:	0f b6 c9             	movzbl %cl,%ecx
+  800e3f:	eb d7                	jmp    800e18 <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  800e41:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800e46:	be 00 00 00 00       	mov    $0x0,%esi
+  800e4b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e51:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e54:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e57:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  800e59:	eb 95                	jmp    800df0 <sys_ipc_send+0x3c>
+
+00800e5b <sys_ipc_recv>:
+{
+  800e5b:	55                   	push   %ebp
+  800e5c:	89 e5                	mov    %esp,%ebp
+  800e5e:	57                   	push   %edi
+  800e5f:	56                   	push   %esi
+  800e60:	53                   	push   %ebx
+  800e61:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800e64:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e6b:	78 36                	js     800ea3 <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  800e6d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e74:	74 79                	je     800eef <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  800e76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e79:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e7e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e83:	89 cb                	mov    %ecx,%ebx
+  800e85:	89 cf                	mov    %ecx,%edi
+  800e87:	89 ce                	mov    %ecx,%esi
+  800e89:	55                   	push   %ebp
+  800e8a:	68 93 0e 80 00       	push   $0x800e93
+  800e8f:	89 e5                	mov    %esp,%ebp
+  800e91:	0f 34                	sysenter
+  800e93:	83 c4 04             	add    $0x4,%esp
+  800e96:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e97:	85 c0                	test   %eax,%eax
+  800e99:	7f 6b                	jg     800f06 <sys_ipc_recv+0xab>
+}
+  800e9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e9e:	5b                   	pop    %ebx
+  800e9f:	5e                   	pop    %esi
+  800ea0:	5f                   	pop    %edi
+  800ea1:	5d                   	pop    %ebp
+  800ea2:	c3                   	ret
+  800ea3:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ea8:	0f a2                	cpuid
+		return 0;
+  800eaa:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800eaf:	f6 c6 08             	test   $0x8,%dh
+  800eb2:	74 15                	je     800ec9 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800eb4:	89 c2                	mov    %eax,%edx
+  800eb6:	c1 ea 08             	shr    $0x8,%edx
+  800eb9:	83 e2 0f             	and    $0xf,%edx
+  800ebc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ec1:	83 fa 06             	cmp    $0x6,%edx
+  800ec4:	74 0e                	je     800ed4 <sys_ipc_recv+0x79>
+  800ec6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800ec9:	0f b6 c9             	movzbl %cl,%ecx
+  800ecc:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800ed2:	eb 99                	jmp    800e6d <sys_ipc_recv+0x12>
+  800ed4:	89 c2                	mov    %eax,%edx
+  800ed6:	c1 ea 04             	shr    $0x4,%edx
+  800ed9:	83 e2 0f             	and    $0xf,%edx
+  800edc:	83 fa 02             	cmp    $0x2,%edx
+  800edf:	77 e5                	ja     800ec6 <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  800ee1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ee4:	83 f8 02             	cmp    $0x2,%eax
+  800ee7:	0f 97 c1             	seta   %cl
+  800eea:	0f b6 c9             	movzbl %cl,%ecx
+  800eed:	eb d7                	jmp    800ec6 <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  800eef:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ef4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ef9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800efc:	89 cb                	mov    %ecx,%ebx
+  800efe:	89 cf                	mov    %ecx,%edi
+  800f00:	89 ce                	mov    %ecx,%esi
+  800f02:	cd 30                	int    $0x30
+  800f04:	eb 91                	jmp    800e97 <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f06:	83 ec 0c             	sub    $0xc,%esp
+  800f09:	50                   	push   %eax
+  800f0a:	6a 0d                	push   $0xd
+  800f0c:	68 ca 27 80 00       	push   $0x8027ca
+  800f11:	6a 4a                	push   $0x4a
+  800f13:	68 e7 27 80 00       	push   $0x8027e7
+  800f18:	e8 ec 0c 00 00       	call   801c09 <_panic>
+
+00800f1d <sys_ipc_send_range>:
+{
+  800f1d:	55                   	push   %ebp
+  800f1e:	89 e5                	mov    %esp,%ebp
+  800f20:	57                   	push   %edi
+  800f21:	56                   	push   %esi
+  800f22:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800f23:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f2a:	78 30                	js     800f5c <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  800f2c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f33:	74 73                	je     800fa8 <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  800f35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  800f40:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f43:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f46:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f49:	55                   	push   %ebp
+  800f4a:	68 53 0f 80 00       	push   $0x800f53
+  800f4f:	89 e5                	mov    %esp,%ebp
+  800f51:	0f 34                	sysenter
+  800f53:	83 c4 04             	add    $0x4,%esp
+  800f56:	5d                   	pop    %ebp
+}
+  800f57:	5b                   	pop    %ebx
+  800f58:	5e                   	pop    %esi
+  800f59:	5f                   	pop    %edi
+  800f5a:	5d                   	pop    %ebp
+  800f5b:	c3                   	ret
+  800f5c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f61:	0f a2                	cpuid
+		return 0;
+  800f63:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f68:	f6 c6 08             	test   $0x8,%dh
+  800f6b:	74 15                	je     800f82 <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f6d:	89 c2                	mov    %eax,%edx
+  800f6f:	c1 ea 08             	shr    $0x8,%edx
+  800f72:	83 e2 0f             	and    $0xf,%edx
+  800f75:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f7a:	83 fa 06             	cmp    $0x6,%edx
+  800f7d:	74 0e                	je     800f8d <sys_ipc_send_range+0x70>
+  800f7f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f82:	0f b6 c9             	movzbl %cl,%ecx
+  800f85:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800f8b:	eb 9f                	jmp    800f2c <sys_ipc_send_range+0xf>
+  800f8d:	89 c2                	mov    %eax,%edx
+  800f8f:	c1 ea 04             	shr    $0x4,%edx
+  800f92:	83 e2 0f             	and    $0xf,%edx
+  800f95:	83 fa 02             	cmp    $0x2,%edx
+  800f98:	77 e5                	ja     800f7f <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  800f9a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f9d:	83 f8 02             	cmp    $0x2,%eax
+  800fa0:	0f 97 c1             	seta   %cl
+  800fa3:	0f b6 c9             	movzbl %cl,%ecx
+  800fa6:	eb d7                	jmp    800f7f <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  800fa8:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  800fad:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fb6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fb9:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fbc:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  800fbe:	eb 97                	jmp    800f57 <sys_ipc_send_range+0x3a>
+
+00800fc0 <sys_ipc_recv_range>:
+{
+  800fc0:	55                   	push   %ebp
+  800fc1:	89 e5                	mov    %esp,%ebp
+  800fc3:	57                   	push   %edi
+  800fc4:	56                   	push   %esi
+  800fc5:	53                   	push   %ebx
+  800fc6:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800fc9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fd0:	78 37                	js     801009 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  800fd2:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fd9:	74 7a                	je     801055 <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  800fdb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe6:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800feb:	89 df                	mov    %ebx,%edi
+  800fed:	89 de                	mov    %ebx,%esi
+  800fef:	55                   	push   %ebp
+  800ff0:	68 f9 0f 80 00       	push   $0x800ff9
+  800ff5:	89 e5                	mov    %esp,%ebp
+  800ff7:	0f 34                	sysenter
+  800ff9:	83 c4 04             	add    $0x4,%esp
+  800ffc:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ffd:	85 c0                	test   %eax,%eax
+  800fff:	7f 6c                	jg     80106d <sys_ipc_recv_range+0xad>
+}
+  801001:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801004:	5b                   	pop    %ebx
+  801005:	5e                   	pop    %esi
+  801006:	5f                   	pop    %edi
+  801007:	5d                   	pop    %ebp
+  801008:	c3                   	ret
+  801009:	b8 01 00 00 00       	mov    $0x1,%eax
+  80100e:	0f a2                	cpuid
+		return 0;
+  801010:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801015:	f6 c6 08             	test   $0x8,%dh
+  801018:	74 15                	je     80102f <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80101a:	89 c2                	mov    %eax,%edx
+  80101c:	c1 ea 08             	shr    $0x8,%edx
+  80101f:	83 e2 0f             	and    $0xf,%edx
+  801022:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801027:	83 fa 06             	cmp    $0x6,%edx
+  80102a:	74 0e                	je     80103a <sys_ipc_recv_range+0x7a>
+  80102c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80102f:	0f b6 c9             	movzbl %cl,%ecx
+  801032:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801038:	eb 98                	jmp    800fd2 <sys_ipc_recv_range+0x12>
+  80103a:	89 c2                	mov    %eax,%edx
+  80103c:	c1 ea 04             	shr    $0x4,%edx
+  80103f:	83 e2 0f             	and    $0xf,%edx
+  801042:	83 fa 02             	cmp    $0x2,%edx
+  801045:	77 e5                	ja     80102c <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801047:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80104a:	83 f8 02             	cmp    $0x2,%eax
+  80104d:	0f 97 c1             	seta   %cl
+  801050:	0f b6 c9             	movzbl %cl,%ecx
+  801053:	eb d7                	jmp    80102c <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801055:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80105a:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80105f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801062:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801065:	89 df                	mov    %ebx,%edi
+  801067:	89 de                	mov    %ebx,%esi
+  801069:	cd 30                	int    $0x30
+  80106b:	eb 90                	jmp    800ffd <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80106d:	83 ec 0c             	sub    $0xc,%esp
+  801070:	50                   	push   %eax
+  801071:	6a 1f                	push   $0x1f
+  801073:	68 ca 27 80 00       	push   $0x8027ca
+  801078:	6a 4a                	push   $0x4a
+  80107a:	68 e7 27 80 00       	push   $0x8027e7
+  80107f:	e8 85 0b 00 00       	call   801c09 <_panic>
+
+00801084 <sys_ipc_call>:
+{
+  801084:	55                   	push   %ebp
+  801085:	89 e5                	mov    %esp,%ebp
+  801087:	57                   	push   %edi
+  801088:	56                   	push   %esi
+  801089:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80108a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801092:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801095:	55                   	push   %ebp
+  801096:	56                   	push   %esi
+  801097:	8b 0e                	mov    (%esi),%ecx
+  801099:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80109c:	8b 7e 08             	mov    0x8(%esi),%edi
+  80109f:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8010a2:	8b 76 0c             	mov    0xc(%esi),%esi
+  8010a5:	cd 30                	int    $0x30
+  8010a7:	87 34 24             	xchg   %esi,(%esp)
+  8010aa:	89 0e                	mov    %ecx,(%esi)
+  8010ac:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8010af:	89 7e 08             	mov    %edi,0x8(%esi)
+  8010b2:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8010b5:	8f 46 0c             	pop    0xc(%esi)
+  8010b8:	5d                   	pop    %ebp
+}
+  8010b9:	5b                   	pop    %ebx
+  8010ba:	5e                   	pop    %esi
+  8010bb:	5f                   	pop    %edi
+  8010bc:	5d                   	pop    %ebp
+  8010bd:	c3                   	ret
+
+008010be <sys_ipc_reply_wait>:
+{
+  8010be:	55                   	push   %ebp
+  8010bf:	89 e5                	mov    %esp,%ebp
+  8010c1:	57                   	push   %edi
+  8010c2:	56                   	push   %esi
+  8010c3:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c7:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8010cc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8010cf:	55                   	push   %ebp
+  8010d0:	56                   	push   %esi
+  8010d1:	8b 0e                	mov    (%esi),%ecx
+  8010d3:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8010d6:	8b 7e 08             	mov    0x8(%esi),%edi
+  8010d9:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8010dc:	8b 76 0c             	mov    0xc(%esi),%esi
+  8010df:	cd 30                	int    $0x30
+  8010e1:	87 34 24             	xchg   %esi,(%esp)
+  8010e4:	89 0e                	mov    %ecx,(%esi)
+  8010e6:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8010e9:	89 7e 08             	mov    %edi,0x8(%esi)
+  8010ec:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8010ef:	8f 46 0c             	pop    0xc(%esi)
+  8010f2:	5d                   	pop    %ebp
+}
+  8010f3:	5b                   	pop    %ebx
+  8010f4:	5e                   	pop    %esi
+  8010f5:	5f                   	pop    %edi
+  8010f6:	5d                   	pop    %ebp
+  8010f7:	c3                   	ret
+
+008010f8 <sys_ipc_send_msg>:
+{
+  8010f8:	55                   	push   %ebp
+  8010f9:	89 e5                	mov    %esp,%ebp
+  8010fb:	57                   	push   %edi
+  8010fc:	56                   	push   %esi
+  8010fd:	53                   	push   %ebx
+  8010fe:	83 ec 20             	sub    $0x20,%esp
+  801101:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801104:	8b 10                	mov    (%eax),%edx
+  801106:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801109:	8b 50 04             	mov    0x4(%eax),%edx
+  80110c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80110f:	8b 50 08             	mov    0x8(%eax),%edx
+  801112:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801115:	8b 50 0c             	mov    0xc(%eax),%edx
+  801118:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  80111b:	8b 40 10             	mov    0x10(%eax),%eax
+  80111e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801121:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801124:	8b 55 08             	mov    0x8(%ebp),%edx
+  801127:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80112c:	55                   	push   %ebp
+  80112d:	56                   	push   %esi
+  80112e:	8b 0e                	mov    (%esi),%ecx
+  801130:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801133:	8b 7e 08             	mov    0x8(%esi),%edi
+  801136:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801139:	8b 76 0c             	mov    0xc(%esi),%esi
+  80113c:	cd 30                	int    $0x30
+  80113e:	87 34 24             	xchg   %esi,(%esp)
+  801141:	89 0e                	mov    %ecx,(%esi)
+  801143:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801146:	89 7e 08             	mov    %edi,0x8(%esi)
+  801149:	89 6e 10             	mov    %ebp,0x10(%esi)
+  80114c:	8f 46 0c             	pop    0xc(%esi)
+  80114f:	5d                   	pop    %ebp
+}
+  801150:	83 c4 20             	add    $0x20,%esp
+  801153:	5b                   	pop    %ebx
+  801154:	5e                   	pop    %esi
+  801155:	5f                   	pop    %edi
+  801156:	5d                   	pop    %ebp
+  801157:	c3                   	ret
+
+00801158 <sys_fork>:
+{
+  801158:	55                   	push   %ebp
+  801159:	89 e5                	mov    %esp,%ebp
+  80115b:	57                   	push   %edi
+  80115c:	56                   	push   %esi
+  80115d:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80115e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801165:	78 2e                	js     801195 <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801167:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80116e:	74 71                	je     8011e1 <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801170:	ba 00 00 00 00       	mov    $0x0,%edx
+  801175:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80117a:	89 d1                	mov    %edx,%ecx
+  80117c:	89 d3                	mov    %edx,%ebx
+  80117e:	89 d7                	mov    %edx,%edi
+  801180:	89 d6                	mov    %edx,%esi
+  801182:	55                   	push   %ebp
+  801183:	68 8c 11 80 00       	push   $0x80118c
+  801188:	89 e5                	mov    %esp,%ebp
+  80118a:	0f 34                	sysenter
+  80118c:	83 c4 04             	add    $0x4,%esp
+  80118f:	5d                   	pop    %ebp
+}
+  801190:	5b                   	pop    %ebx
+  801191:	5e                   	pop    %esi
+  801192:	5f                   	pop    %edi
+  801193:	5d                   	pop    %ebp
+  801194:	c3                   	ret
+  801195:	b8 01 00 00 00       	mov    $0x1,%eax
+  80119a:	0f a2                	cpuid
+		return 0;
+  80119c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8011a1:	f6 c6 08             	test   $0x8,%dh
+  8011a4:	74 15                	je     8011bb <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011a6:	89 c2                	mov    %eax,%edx
+  8011a8:	c1 ea 08             	shr    $0x8,%edx
+  8011ab:	83 e2 0f             	and    $0xf,%edx
+  8011ae:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011b3:	83 fa 06             	cmp    $0x6,%edx
+  8011b6:	74 0e                	je     8011c6 <sys_fork+0x6e>
+  8011b8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8011bb:	0f b6 c9             	movzbl %cl,%ecx
+  8011be:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8011c4:	eb a1                	jmp    801167 <sys_fork+0xf>
+  8011c6:	89 c2                	mov    %eax,%edx
+  8011c8:	c1 ea 04             	shr    $0x4,%edx
+  8011cb:	83 e2 0f             	and    $0xf,%edx
+  8011ce:	83 fa 02             	cmp    $0x2,%edx
+  8011d1:	77 e5                	ja     8011b8 <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  8011d3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011d6:	83 f8 02             	cmp    $0x2,%eax
+  8011d9:	0f 97 c1             	seta   %cl
+  8011dc:	0f b6 c9             	movzbl %cl,%ecx
+  8011df:	eb d7                	jmp    8011b8 <sys_fork+0x60>
+		asm volatile("int %1\n"
+  8011e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011e6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011eb:	89 d1                	mov    %edx,%ecx
+  8011ed:	89 d3                	mov    %edx,%ebx
+  8011ef:	89 d7                	mov    %edx,%edi
+  8011f1:	89 d6                	mov    %edx,%esi
+  8011f3:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  8011f5:	eb 99                	jmp    801190 <sys_fork+0x38>
+
+008011f7 <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  8011f7:	55                   	push   %ebp
+  8011f8:	89 e5                	mov    %esp,%ebp
+  8011fa:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  8011fd:	ff 75 14             	push   0x14(%ebp)
+  801200:	ff 75 10             	push   0x10(%ebp)
+  801203:	ff 75 0c             	push   0xc(%ebp)
+  801206:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80120b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801213:	e8 81 ee ff ff       	call   800099 <page_vec_call>
+}
+  801218:	c9                   	leave
+  801219:	c3                   	ret
+
+0080121a <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  80121a:	55                   	push   %ebp
+  80121b:	89 e5                	mov    %esp,%ebp
+  80121d:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801220:	ff 75 18             	push   0x18(%ebp)
+  801223:	ff 75 14             	push   0x14(%ebp)
+  801226:	ff 75 10             	push   0x10(%ebp)
+  801229:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80122c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122f:	b8 10 00 00 00       	mov    $0x10,%eax
+  801234:	e8 60 ee ff ff       	call   800099 <page_vec_call>
+}
+  801239:	c9                   	leave
+  80123a:	c3                   	ret
+
+0080123b <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  80123b:	55                   	push   %ebp
+  80123c:	89 e5                	mov    %esp,%ebp
+  80123e:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801241:	ff 75 14             	push   0x14(%ebp)
+  801244:	ff 75 10             	push   0x10(%ebp)
+  801247:	ff 75 0c             	push   0xc(%ebp)
+  80124a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80124f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801252:	b8 11 00 00 00       	mov    $0x11,%eax
+  801257:	e8 3d ee ff ff       	call   800099 <page_vec_call>
+}
+  80125c:	c9                   	leave
+  80125d:	c3                   	ret
+
+0080125e <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  80125e:	55                   	push   %ebp
+  80125f:	89 e5                	mov    %esp,%ebp
+  801261:	57                   	push   %edi
+  801262:	56                   	push   %esi
+  801263:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801264:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80126b:	78 32                	js     80129f <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  80126d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801274:	74 75                	je     8012eb <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801276:	8b 55 08             	mov    0x8(%ebp),%edx
+  801279:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80127c:	b8 12 00 00 00       	mov    $0x12,%eax
+  801281:	be 00 00 00 00       	mov    $0x0,%esi
+  801286:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801289:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80128c:	55                   	push   %ebp
+  80128d:	68 96 12 80 00       	push   $0x801296
+  801292:	89 e5                	mov    %esp,%ebp
+  801294:	0f 34                	sysenter
+  801296:	83 c4 04             	add    $0x4,%esp
+  801299:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  80129a:	5b                   	pop    %ebx
+  80129b:	5e                   	pop    %esi
+  80129c:	5f                   	pop    %edi
+  80129d:	5d                   	pop    %ebp
+  80129e:	c3                   	ret
+  80129f:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012a4:	0f a2                	cpuid
+		return 0;
+  8012a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8012ab:	f6 c6 08             	test   $0x8,%dh
+  8012ae:	74 15                	je     8012c5 <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012b0:	89 c2                	mov    %eax,%edx
+  8012b2:	c1 ea 08             	shr    $0x8,%edx
+  8012b5:	83 e2 0f             	and    $0xf,%edx
+  8012b8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012bd:	83 fa 06             	cmp    $0x6,%edx
+  8012c0:	74 0e                	je     8012d0 <sys_vm_ranges+0x72>
+  8012c2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8012c5:	0f b6 c9             	movzbl %cl,%ecx
+  8012c8:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8012ce:	eb 9d                	jmp    80126d <sys_vm_ranges+0xf>
+  8012d0:	89 c2                	mov    %eax,%edx
+  8012d2:	c1 ea 04             	shr    $0x4,%edx
+  8012d5:	83 e2 0f             	and    $0xf,%edx
+  8012d8:	83 fa 02             	cmp    $0x2,%edx
+  8012db:	77 e5                	ja     8012c2 <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  8012dd:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012e0:	83 f8 02             	cmp    $0x2,%eax
+  8012e3:	0f 97 c1             	seta   %cl
+  8012e6:	0f b6 c9             	movzbl %cl,%ecx
+  8012e9:	eb d7                	jmp    8012c2 <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  8012eb:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012fb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012fe:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801301:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801303:	eb 95                	jmp    80129a <sys_vm_ranges+0x3c>
+
+00801305 <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801305:	55                   	push   %ebp
+  801306:	89 e5                	mov    %esp,%ebp
+  801308:	57                   	push   %edi
+  801309:	56                   	push   %esi
+  80130a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80130b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801312:	78 31                	js     801345 <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801314:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80131b:	74 74                	je     801391 <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  80131d:	be 00 00 00 00       	mov    $0x0,%esi
+  801322:	8b 55 08             	mov    0x8(%ebp),%edx
+  801325:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801328:	b8 14 00 00 00       	mov    $0x14,%eax
+  80132d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801330:	89 f7                	mov    %esi,%edi
+  801332:	55                   	push   %ebp
+  801333:	68 3c 13 80 00       	push   $0x80133c
+  801338:	89 e5                	mov    %esp,%ebp
+  80133a:	0f 34                	sysenter
+  80133c:	83 c4 04             	add    $0x4,%esp
+  80133f:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801340:	5b                   	pop    %ebx
+  801341:	5e                   	pop    %esi
+  801342:	5f                   	pop    %edi
+  801343:	5d                   	pop    %ebp
+  801344:	c3                   	ret
+  801345:	b8 01 00 00 00       	mov    $0x1,%eax
+  80134a:	0f a2                	cpuid
+		return 0;
+  80134c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801351:	f6 c6 08             	test   $0x8,%dh
+  801354:	74 15                	je     80136b <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801356:	89 c2                	mov    %eax,%edx
+  801358:	c1 ea 08             	shr    $0x8,%edx
+  80135b:	83 e2 0f             	and    $0xf,%edx
+  80135e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801363:	83 fa 06             	cmp    $0x6,%edx
+  801366:	74 0e                	je     801376 <sys_spawn+0x71>
+  801368:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80136b:	0f b6 c9             	movzbl %cl,%ecx
+  80136e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801374:	eb 9e                	jmp    801314 <sys_spawn+0xf>
+  801376:	89 c2                	mov    %eax,%edx
+  801378:	c1 ea 04             	shr    $0x4,%edx
+  80137b:	83 e2 0f             	and    $0xf,%edx
+  80137e:	83 fa 02             	cmp    $0x2,%edx
+  801381:	77 e5                	ja     801368 <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  801383:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801386:	83 f8 02             	cmp    $0x2,%eax
+  801389:	0f 97 c1             	seta   %cl
+  80138c:	0f b6 c9             	movzbl %cl,%ecx
+  80138f:	eb d7                	jmp    801368 <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  801391:	be 00 00 00 00       	mov    $0x0,%esi
+  801396:	b8 14 00 00 00       	mov    $0x14,%eax
+  80139b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80139e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013a4:	89 f7                	mov    %esi,%edi
+  8013a6:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  8013a8:	eb 96                	jmp    801340 <sys_spawn+0x3b>
+
+008013aa <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  8013aa:	55                   	push   %ebp
+  8013ab:	89 e5                	mov    %esp,%ebp
+  8013ad:	57                   	push   %edi
+  8013ae:	56                   	push   %esi
+  8013af:	53                   	push   %ebx
+  8013b0:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8013b3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8013ba:	78 37                	js     8013f3 <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  8013bc:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8013c3:	74 7a                	je     80143f <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  8013c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d0:	b8 15 00 00 00       	mov    $0x15,%eax
+  8013d5:	89 df                	mov    %ebx,%edi
+  8013d7:	89 de                	mov    %ebx,%esi
+  8013d9:	55                   	push   %ebp
+  8013da:	68 e3 13 80 00       	push   $0x8013e3
+  8013df:	89 e5                	mov    %esp,%ebp
+  8013e1:	0f 34                	sysenter
+  8013e3:	83 c4 04             	add    $0x4,%esp
+  8013e6:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8013e7:	85 c0                	test   %eax,%eax
+  8013e9:	7f 6c                	jg     801457 <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  8013eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013ee:	5b                   	pop    %ebx
+  8013ef:	5e                   	pop    %esi
+  8013f0:	5f                   	pop    %edi
+  8013f1:	5d                   	pop    %ebp
+  8013f2:	c3                   	ret
+  8013f3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013f8:	0f a2                	cpuid
+		return 0;
+  8013fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8013ff:	f6 c6 08             	test   $0x8,%dh
+  801402:	74 15                	je     801419 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801404:	89 c2                	mov    %eax,%edx
+  801406:	c1 ea 08             	shr    $0x8,%edx
+  801409:	83 e2 0f             	and    $0xf,%edx
+  80140c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801411:	83 fa 06             	cmp    $0x6,%edx
+  801414:	74 0e                	je     801424 <sys_shm_create+0x7a>
+  801416:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801419:	0f b6 c9             	movzbl %cl,%ecx
+  80141c:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801422:	eb 98                	jmp    8013bc <sys_shm_create+0x12>
+  801424:	89 c2                	mov    %eax,%edx
+  801426:	c1 ea 04             	shr    $0x4,%edx
+  801429:	83 e2 0f             	and    $0xf,%edx
+  80142c:	83 fa 02             	cmp    $0x2,%edx
+  80142f:	77 e5                	ja     801416 <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  801431:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801434:	83 f8 02             	cmp    $0x2,%eax
+  801437:	0f 97 c1             	seta   %cl
+  80143a:	0f b6 c9             	movzbl %cl,%ecx
+  80143d:	eb d7                	jmp    801416 <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  80143f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801444:	b8 15 00 00 00       	mov    $0x15,%eax
+  801449:	8b 55 08             	mov    0x8(%ebp),%edx
+  80144c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80144f:	89 df                	mov    %ebx,%edi
+  801451:	89 de                	mov    %ebx,%esi
+  801453:	cd 30                	int    $0x30
+  801455:	eb 90                	jmp    8013e7 <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801457:	83 ec 0c             	sub    $0xc,%esp
+  80145a:	50                   	push   %eax
+  80145b:	6a 15                	push   $0x15
+  80145d:	68 ca 27 80 00       	push   $0x8027ca
+  801462:	6a 4a                	push   $0x4a
+  801464:	68 e7 27 80 00       	push   $0x8027e7
+  801469:	e8 9b 07 00 00       	call   801c09 <_panic>
+
+0080146e <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  80146e:	55                   	push   %ebp
+  80146f:	89 e5                	mov    %esp,%ebp
+  801471:	57                   	push   %edi
+  801472:	56                   	push   %esi
+  801473:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801474:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80147b:	78 32                	js     8014af <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  80147d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801484:	74 75                	je     8014fb <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801486:	8b 55 08             	mov    0x8(%ebp),%edx
+  801489:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80148c:	b8 16 00 00 00       	mov    $0x16,%eax
+  801491:	be 00 00 00 00       	mov    $0x0,%esi
+  801496:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801499:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80149c:	55                   	push   %ebp
+  80149d:	68 a6 14 80 00       	push   $0x8014a6
+  8014a2:	89 e5                	mov    %esp,%ebp
+  8014a4:	0f 34                	sysenter
+  8014a6:	83 c4 04             	add    $0x4,%esp
+  8014a9:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  8014aa:	5b                   	pop    %ebx
+  8014ab:	5e                   	pop    %esi
+  8014ac:	5f                   	pop    %edi
+  8014ad:	5d                   	pop    %ebp
+  8014ae:	c3                   	ret
+  8014af:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014b4:	0f a2                	cpuid
+		return 0;
+  8014b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8014bb:	f6 c6 08             	test   $0x8,%dh
+  8014be:	74 15                	je     8014d5 <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014c0:	89 c2                	mov    %eax,%edx
+  8014c2:	c1 ea 08             	shr    $0x8,%edx
+  8014c5:	83 e2 0f             	and    $0xf,%edx
+  8014c8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8014cd:	83 fa 06             	cmp    $0x6,%edx
+  8014d0:	74 0e                	je     8014e0 <sys_shm_attach+0x72>
+  8014d2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8014d5:	0f b6 c9             	movzbl %cl,%ecx
+  8014d8:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8014de:	eb 9d                	jmp    80147d <sys_shm_attach+0xf>
+  8014e0:	89 c2                	mov    %eax,%edx
+  8014e2:	c1 ea 04             	shr    $0x4,%edx
+  8014e5:	83 e2 0f             	and    $0xf,%edx
+  8014e8:	83 fa 02             	cmp    $0x2,%edx
+  8014eb:	77 e5                	ja     8014d2 <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  8014ed:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014f0:	83 f8 02             	cmp    $0x2,%eax
+  8014f3:	0f 97 c1             	seta   %cl
+  8014f6:	0f b6 c9             	movzbl %cl,%ecx
+  8014f9:	eb d7                	jmp    8014d2 <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  8014fb:	b8 16 00 00 00       	mov    $0x16,%eax
+  801500:	be 00 00 00 00       	mov    $0x0,%esi
+  801505:	8b 55 08             	mov    0x8(%ebp),%edx
+  801508:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80150b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80150e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801511:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  801513:	eb 95                	jmp    8014aa <sys_shm_attach+0x3c>
+
+00801515 <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  801515:	55                   	push   %ebp
+  801516:	89 e5                	mov    %esp,%ebp
+  801518:	57                   	push   %edi
+  801519:	56                   	push   %esi
+  80151a:	53                   	push   %ebx
+  80151b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80151e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801525:	78 38                	js     80155f <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  801527:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80152e:	74 7b                	je     8015ab <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  801530:	be 00 00 00 00       	mov    $0x0,%esi
+  801535:	8b 55 08             	mov    0x8(%ebp),%edx
+  801538:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80153b:	b8 17 00 00 00       	mov    $0x17,%eax
+  801540:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801543:	89 f7                	mov    %esi,%edi
+  801545:	55                   	push   %ebp
+  801546:	68 4f 15 80 00       	push   $0x80154f
+  80154b:	89 e5                	mov    %esp,%ebp
+  80154d:	0f 34                	sysenter
+  80154f:	83 c4 04             	add    $0x4,%esp
+  801552:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801553:	85 c0                	test   %eax,%eax
+  801555:	7f 6d                	jg     8015c4 <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  801557:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80155a:	5b                   	pop    %ebx
+  80155b:	5e                   	pop    %esi
+  80155c:	5f                   	pop    %edi
+  80155d:	5d                   	pop    %ebp
+  80155e:	c3                   	ret
+  80155f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801564:	0f a2                	cpuid
+		return 0;
+  801566:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80156b:	f6 c6 08             	test   $0x8,%dh
+  80156e:	74 15                	je     801585 <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801570:	89 c2                	mov    %eax,%edx
+  801572:	c1 ea 08             	shr    $0x8,%edx
+  801575:	83 e2 0f             	and    $0xf,%edx
+  801578:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80157d:	83 fa 06             	cmp    $0x6,%edx
+  801580:	74 0e                	je     801590 <sys_shm_detach+0x7b>
+  801582:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801585:	0f b6 c9             	movzbl %cl,%ecx
+  801588:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80158e:	eb 97                	jmp    801527 <sys_shm_detach+0x12>
+  801590:	89 c2                	mov    %eax,%edx
+  801592:	c1 ea 04             	shr    $0x4,%edx
+  801595:	83 e2 0f             	and    $0xf,%edx
+  801598:	83 fa 02             	cmp    $0x2,%edx
+  80159b:	77 e5                	ja     801582 <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  80159d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015a0:	83 f8 02             	cmp    $0x2,%eax
+  8015a3:	0f 97 c1             	seta   %cl
+  8015a6:	0f b6 c9             	movzbl %cl,%ecx
+  8015a9:	eb d7                	jmp    801582 <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  8015ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8015b0:	b8 17 00 00 00       	mov    $0x17,%eax
+  8015b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015bb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015be:	89 f7                	mov    %esi,%edi
+  8015c0:	cd 30                	int    $0x30
+  8015c2:	eb 8f                	jmp    801553 <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015c4:	83 ec 0c             	sub    $0xc,%esp
+  8015c7:	50                   	push   %eax
+  8015c8:	6a 17                	push   $0x17
+  8015ca:	68 ca 27 80 00       	push   $0x8027ca
+  8015cf:	6a 4a                	push   $0x4a
+  8015d1:	68 e7 27 80 00       	push   $0x8027e7
+  8015d6:	e8 2e 06 00 00       	call   801c09 <_panic>
+
+008015db <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  8015db:	55                   	push   %ebp
+  8015dc:	89 e5                	mov    %esp,%ebp
+  8015de:	57                   	push   %edi
+  8015df:	56                   	push   %esi
+  8015e0:	53                   	push   %ebx
+  8015e1:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8015e4:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8015eb:	78 36                	js     801623 <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  8015ed:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8015f4:	74 79                	je     80166f <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  8015f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015fe:	b8 18 00 00 00       	mov    $0x18,%eax
+  801603:	89 cb                	mov    %ecx,%ebx
+  801605:	89 cf                	mov    %ecx,%edi
+  801607:	89 ce                	mov    %ecx,%esi
+  801609:	55                   	push   %ebp
+  80160a:	68 13 16 80 00       	push   $0x801613
+  80160f:	89 e5                	mov    %esp,%ebp
+  801611:	0f 34                	sysenter
+  801613:	83 c4 04             	add    $0x4,%esp
+  801616:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801617:	85 c0                	test   %eax,%eax
+  801619:	7f 6b                	jg     801686 <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  80161b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80161e:	5b                   	pop    %ebx
+  80161f:	5e                   	pop    %esi
+  801620:	5f                   	pop    %edi
+  801621:	5d                   	pop    %ebp
+  801622:	c3                   	ret
+  801623:	b8 01 00 00 00       	mov    $0x1,%eax
+  801628:	0f a2                	cpuid
+		return 0;
+  80162a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80162f:	f6 c6 08             	test   $0x8,%dh
+  801632:	74 15                	je     801649 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801634:	89 c2                	mov    %eax,%edx
+  801636:	c1 ea 08             	shr    $0x8,%edx
+  801639:	83 e2 0f             	and    $0xf,%edx
+  80163c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801641:	83 fa 06             	cmp    $0x6,%edx
+  801644:	74 0e                	je     801654 <sys_shm_remove+0x79>
+  801646:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801649:	0f b6 c9             	movzbl %cl,%ecx
+  80164c:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801652:	eb 99                	jmp    8015ed <sys_shm_remove+0x12>
+  801654:	89 c2                	mov    %eax,%edx
+  801656:	c1 ea 04             	shr    $0x4,%edx
+  801659:	83 e2 0f             	and    $0xf,%edx
+  80165c:	83 fa 02             	cmp    $0x2,%edx
+  80165f:	77 e5                	ja     801646 <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  801661:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801664:	83 f8 02             	cmp    $0x2,%eax
+  801667:	0f 97 c1             	seta   %cl
+  80166a:	0f b6 c9             	movzbl %cl,%ecx
+  80166d:	eb d7                	jmp    801646 <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  80166f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801674:	b8 18 00 00 00       	mov    $0x18,%eax
+  801679:	8b 55 08             	mov    0x8(%ebp),%edx
+  80167c:	89 cb                	mov    %ecx,%ebx
+  80167e:	89 cf                	mov    %ecx,%edi
+  801680:	89 ce                	mov    %ecx,%esi
+  801682:	cd 30                	int    $0x30
+  801684:	eb 91                	jmp    801617 <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801686:	83 ec 0c             	sub    $0xc,%esp
+  801689:	50                   	push   %eax
+  80168a:	6a 18                	push   $0x18
+  80168c:	68 ca 27 80 00       	push   $0x8027ca
+  801691:	6a 4a                	push   $0x4a
+  801693:	68 e7 27 80 00       	push   $0x8027e7
+  801698:	e8 6c 05 00 00       	call   801c09 <_panic>
+
+0080169d <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  80169d:	55                   	push   %ebp
+  80169e:	89 e5                	mov    %esp,%ebp
+  8016a0:	57                   	push   %edi
+  8016a1:	56                   	push   %esi
+  8016a2:	53                   	push   %ebx
+  8016a3:	83 ec 0c             	sub    $0xc,%esp
+  8016a6:	8b 45 10             	mov    0x10(%ebp),%eax
+  8016a9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8016ac:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  8016af:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8016b6:	78 32                	js     8016ea <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  8016b8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8016bf:	74 75                	je     801736 <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  8016c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016c7:	b8 20 00 00 00       	mov    $0x20,%eax
+  8016cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d1:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8016d4:	55                   	push   %ebp
+  8016d5:	68 de 16 80 00       	push   $0x8016de
+  8016da:	89 e5                	mov    %esp,%ebp
+  8016dc:	0f 34                	sysenter
+  8016de:	83 c4 04             	add    $0x4,%esp
+  8016e1:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  8016e2:	83 c4 0c             	add    $0xc,%esp
+  8016e5:	5b                   	pop    %ebx
+  8016e6:	5e                   	pop    %esi
+  8016e7:	5f                   	pop    %edi
+  8016e8:	5d                   	pop    %ebp
+  8016e9:	c3                   	ret
+  8016ea:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016ef:	0f a2                	cpuid
+		return 0;
+  8016f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8016f6:	f6 c6 08             	test   $0x8,%dh
+  8016f9:	74 15                	je     801710 <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016fb:	89 c2                	mov    %eax,%edx
+  8016fd:	c1 ea 08             	shr    $0x8,%edx
+  801700:	83 e2 0f             	and    $0xf,%edx
+  801703:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801708:	83 fa 06             	cmp    $0x6,%edx
+  80170b:	74 0e                	je     80171b <sys_futex_wait+0x7e>
+  80170d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801710:	0f b6 c9             	movzbl %cl,%ecx
+  801713:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801719:	eb 9d                	jmp    8016b8 <sys_futex_wait+0x1b>
+  80171b:	89 c2                	mov    %eax,%edx
+  80171d:	c1 ea 04             	shr    $0x4,%edx
+  801720:	83 e2 0f             	and    $0xf,%edx
+  801723:	83 fa 02             	cmp    $0x2,%edx
+  801726:	77 e5                	ja     80170d <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  801728:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80172b:	83 f8 02             	cmp    $0x2,%eax
+  80172e:	0f 97 c1             	seta   %cl
+  801731:	0f b6 c9             	movzbl %cl,%ecx
+  801734:	eb d7                	jmp    80170d <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  801736:	b8 20 00 00 00       	mov    $0x20,%eax
+  80173b:	be 00 00 00 00       	mov    $0x0,%esi
+  801740:	8b 55 08             	mov    0x8(%ebp),%edx
+  801743:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801746:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  801749:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  80174b:	eb 95                	jmp    8016e2 <sys_futex_wait+0x45>
+
+0080174d <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80174d:	55                   	push   %ebp
+  80174e:	89 e5                	mov    %esp,%ebp
+  801750:	57                   	push   %edi
+  801751:	56                   	push   %esi
+  801752:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801753:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80175a:	78 30                	js     80178c <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  80175c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801763:	74 73                	je     8017d8 <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801765:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80176a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80176d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801770:	b8 21 00 00 00       	mov    $0x21,%eax
+  801775:	89 df                	mov    %ebx,%edi
+  801777:	89 de                	mov    %ebx,%esi
+  801779:	55                   	push   %ebp
+  80177a:	68 83 17 80 00       	push   $0x801783
+  80177f:	89 e5                	mov    %esp,%ebp
+  801781:	0f 34                	sysenter
+  801783:	83 c4 04             	add    $0x4,%esp
+  801786:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801787:	5b                   	pop    %ebx
+  801788:	5e                   	pop    %esi
+  801789:	5f                   	pop    %edi
+  80178a:	5d                   	pop    %ebp
+  80178b:	c3                   	ret
+  80178c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801791:	0f a2                	cpuid
+		return 0;
+  801793:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801798:	f6 c6 08             	test   $0x8,%dh
+  80179b:	74 15                	je     8017b2 <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80179d:	89 c2                	mov    %eax,%edx
+  80179f:	c1 ea 08             	shr    $0x8,%edx
+  8017a2:	83 e2 0f             	and    $0xf,%edx
+  8017a5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017aa:	83 fa 06             	cmp    $0x6,%edx
+  8017ad:	74 0e                	je     8017bd <sys_futex_wake+0x70>
+  8017af:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8017b2:	0f b6 c9             	movzbl %cl,%ecx
+  8017b5:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8017bb:	eb 9f                	jmp    80175c <sys_futex_wake+0xf>
+  8017bd:	89 c2                	mov    %eax,%edx
+  8017bf:	c1 ea 04             	shr    $0x4,%edx
+  8017c2:	83 e2 0f             	and    $0xf,%edx
+  8017c5:	83 fa 02             	cmp    $0x2,%edx
+  8017c8:	77 e5                	ja     8017af <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  8017ca:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017cd:	83 f8 02             	cmp    $0x2,%eax
+  8017d0:	0f 97 c1             	seta   %cl
+  8017d3:	0f b6 c9             	movzbl %cl,%ecx
+  8017d6:	eb d7                	jmp    8017af <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  8017d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017dd:	b8 21 00 00 00       	mov    $0x21,%eax
+  8017e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017e8:	89 df                	mov    %ebx,%edi
+  8017ea:	89 de                	mov    %ebx,%esi
+  8017ec:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  8017ee:	eb 97                	jmp    801787 <sys_futex_wake+0x3a>
+
+008017f0 <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  8017f0:	55                   	push   %ebp
+  8017f1:	89 e5                	mov    %esp,%ebp
+  8017f3:	57                   	push   %edi
+  8017f4:	56                   	push   %esi
+  8017f5:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8017f6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8017fd:	78 2e                	js     80182d <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  8017ff:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801806:	74 71                	je     801879 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  801808:	ba 00 00 00 00       	mov    $0x0,%edx
+  80180d:	b8 22 00 00 00       	mov    $0x22,%eax
+  801812:	89 d1                	mov    %edx,%ecx
+  801814:	89 d3                	mov    %edx,%ebx
+  801816:	89 d7                	mov    %edx,%edi
+  801818:	89 d6                	mov    %edx,%esi
+  80181a:	55                   	push   %ebp
+  80181b:	68 24 18 80 00       	push   $0x801824
+  801820:	89 e5                	mov    %esp,%ebp
+  801822:	0f 34                	sysenter
+  801824:	83 c4 04             	add    $0x4,%esp
+  801827:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  801828:	5b                   	pop    %ebx
+  801829:	5e                   	pop    %esi
+  80182a:	5f                   	pop    %edi
+  80182b:	5d                   	pop    %ebp
+  80182c:	c3                   	ret
+  80182d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801832:	0f a2                	cpuid
+		return 0;
+  801834:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801839:	f6 c6 08             	test   $0x8,%dh
+  80183c:	74 15                	je     801853 <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80183e:	89 c2                	mov    %eax,%edx
+  801840:	c1 ea 08             	shr    $0x8,%edx
+  801843:	83 e2 0f             	and    $0xf,%edx
+  801846:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80184b:	83 fa 06             	cmp    $0x6,%edx
+  80184e:	74 0e                	je     80185e <sys_ep_create+0x6e>
+  801850:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801853:	0f b6 c9             	movzbl %cl,%ecx
+  801856:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80185c:	eb a1                	jmp    8017ff <sys_ep_create+0xf>
+  80185e:	89 c2                	mov    %eax,%edx
+  801860:	c1 ea 04             	shr    $0x4,%edx
+  801863:	83 e2 0f             	and    $0xf,%edx
+  801866:	83 fa 02             	cmp    $0x2,%edx
+  801869:	77 e5                	ja     801850 <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  80186b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80186e:	83 f8 02             	cmp    $0x2,%eax
+  801871:	0f 97 c1             	seta   %cl
+  801874:	0f b6 c9             	movzbl %cl,%ecx
+  801877:	eb d7                	jmp    801850 <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  801879:	ba 00 00 00 00       	mov    $0x0,%edx
+  80187e:	b8 22 00 00 00       	mov    $0x22,%eax
+  801883:	89 d1                	mov    %edx,%ecx
+  801885:	89 d3                	mov    %edx,%ebx
+  801887:	89 d7                	mov    %edx,%edi
+  801889:	89 d6                	mov    %edx,%esi
+  80188b:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  80188d:	eb 99                	jmp    801828 <sys_ep_create+0x38>
+
+0080188f <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  80188f:	55                   	push   %ebp
+  801890:	89 e5                	mov    %esp,%ebp
+  801892:	57                   	push   %edi
+  801893:	56                   	push   %esi
+  801894:	53                   	push   %ebx
+  801895:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801898:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80189f:	78 36                	js     8018d7 <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  8018a1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8018a8:	74 79                	je     801923 <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  8018aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018b2:	b8 23 00 00 00       	mov    $0x23,%eax
+  8018b7:	89 cb                	mov    %ecx,%ebx
+  8018b9:	89 cf                	mov    %ecx,%edi
+  8018bb:	89 ce                	mov    %ecx,%esi
+  8018bd:	55                   	push   %ebp
+  8018be:	68 c7 18 80 00       	push   $0x8018c7
+  8018c3:	89 e5                	mov    %esp,%ebp
+  8018c5:	0f 34                	sysenter
+  8018c7:	83 c4 04             	add    $0x4,%esp
+  8018ca:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8018cb:	85 c0                	test   %eax,%eax
+  8018cd:	7f 6b                	jg     80193a <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  8018cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018d2:	5b                   	pop    %ebx
+  8018d3:	5e                   	pop    %esi
+  8018d4:	5f                   	pop    %edi
+  8018d5:	5d                   	pop    %ebp
+  8018d6:	c3                   	ret
+  8018d7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018dc:	0f a2                	cpuid
+		return 0;
+  8018de:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018e3:	f6 c6 08             	test   $0x8,%dh
+  8018e6:	74 15                	je     8018fd <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018e8:	89 c2                	mov    %eax,%edx
+  8018ea:	c1 ea 08             	shr    $0x8,%edx
+  8018ed:	83 e2 0f             	and    $0xf,%edx
+  8018f0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018f5:	83 fa 06             	cmp    $0x6,%edx
+  8018f8:	74 0e                	je     801908 <sys_ep_destroy+0x79>
+  8018fa:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8018fd:	0f b6 c9             	movzbl %cl,%ecx
+  801900:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801906:	eb 99                	jmp    8018a1 <sys_ep_destroy+0x12>
+  801908:	89 c2                	mov    %eax,%edx
+  80190a:	c1 ea 04             	shr    $0x4,%edx
+  80190d:	83 e2 0f             	and    $0xf,%edx
+  801910:	83 fa 02             	cmp    $0x2,%edx
+  801913:	77 e5                	ja     8018fa <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  801915:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801918:	83 f8 02             	cmp    $0x2,%eax
+  80191b:	0f 97 c1             	seta   %cl
+  80191e:	0f b6 c9             	movzbl %cl,%ecx
+  801921:	eb d7                	jmp    8018fa <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  801923:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801928:	b8 23 00 00 00       	mov    $0x23,%eax
+  80192d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801930:	89 cb                	mov    %ecx,%ebx
+  801932:	89 cf                	mov    %ecx,%edi
+  801934:	89 ce                	mov    %ecx,%esi
+  801936:	cd 30                	int    $0x30
+  801938:	eb 91                	jmp    8018cb <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80193a:	83 ec 0c             	sub    $0xc,%esp
+  80193d:	50                   	push   %eax
+  80193e:	6a 23                	push   $0x23
+  801940:	68 ca 27 80 00       	push   $0x8027ca
+  801945:	6a 4a                	push   $0x4a
+  801947:	68 e7 27 80 00       	push   $0x8027e7
+  80194c:	e8 b8 02 00 00       	call   801c09 <_panic>
+
+00801951 <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  801951:	55                   	push   %ebp
+  801952:	89 e5                	mov    %esp,%ebp
+  801954:	57                   	push   %edi
+  801955:	56                   	push   %esi
+  801956:	53                   	push   %ebx
+  801957:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80195a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801961:	78 37                	js     80199a <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  801963:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80196a:	74 7a                	je     8019e6 <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  80196c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801971:	8b 55 08             	mov    0x8(%ebp),%edx
+  801974:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801977:	b8 24 00 00 00       	mov    $0x24,%eax
+  80197c:	89 df                	mov    %ebx,%edi
+  80197e:	89 de                	mov    %ebx,%esi
+  801980:	55                   	push   %ebp
+  801981:	68 8a 19 80 00       	push   $0x80198a
+  801986:	89 e5                	mov    %esp,%ebp
+  801988:	0f 34                	sysenter
+  80198a:	83 c4 04             	add    $0x4,%esp
+  80198d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80198e:	85 c0                	test   %eax,%eax
+  801990:	7f 6c                	jg     8019fe <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  801992:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801995:	5b                   	pop    %ebx
+  801996:	5e                   	pop    %esi
+  801997:	5f                   	pop    %edi
+  801998:	5d                   	pop    %ebp
+  801999:	c3                   	ret
+  80199a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80199f:	0f a2                	cpuid
+		return 0;
+  8019a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8019a6:	f6 c6 08             	test   $0x8,%dh
+  8019a9:	74 15                	je     8019c0 <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019ab:	89 c2                	mov    %eax,%edx
+  8019ad:	c1 ea 08             	shr    $0x8,%edx
+  8019b0:	83 e2 0f             	and    $0xf,%edx
+  8019b3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019b8:	83 fa 06             	cmp    $0x6,%edx
+  8019bb:	74 0e                	je     8019cb <sys_ep_grant+0x7a>
+  8019bd:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8019c0:	0f b6 c9             	movzbl %cl,%ecx
+  8019c3:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8019c9:	eb 98                	jmp    801963 <sys_ep_grant+0x12>
+  8019cb:	89 c2                	mov    %eax,%edx
+  8019cd:	c1 ea 04             	shr    $0x4,%edx
+  8019d0:	83 e2 0f             	and    $0xf,%edx
+  8019d3:	83 fa 02             	cmp    $0x2,%edx
+  8019d6:	77 e5                	ja     8019bd <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  8019d8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019db:	83 f8 02             	cmp    $0x2,%eax
+  8019de:	0f 97 c1             	seta   %cl
+  8019e1:	0f b6 c9             	movzbl %cl,%ecx
+  8019e4:	eb d7                	jmp    8019bd <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  8019e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019eb:	b8 24 00 00 00       	mov    $0x24,%eax
+  8019f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019f6:	89 df                	mov    %ebx,%edi
+  8019f8:	89 de                	mov    %ebx,%esi
+  8019fa:	cd 30                	int    $0x30
+  8019fc:	eb 90                	jmp    80198e <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8019fe:	83 ec 0c             	sub    $0xc,%esp
+  801a01:	50                   	push   %eax
+  801a02:	6a 24                	push   $0x24
+  801a04:	68 ca 27 80 00       	push   $0x8027ca
+  801a09:	6a 4a                	push   $0x4a
+  801a0b:	68 e7 27 80 00       	push   $0x8027e7
+  801a10:	e8 f4 01 00 00       	call   801c09 <_panic>
+
+00801a15 <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  801a15:	55                   	push   %ebp
+  801a16:	89 e5                	mov    %esp,%ebp
+  801a18:	57                   	push   %edi
+  801a19:	56                   	push   %esi
+  801a1a:	53                   	push   %ebx
+  801a1b:	83 ec 20             	sub    $0x20,%esp
+  801a1e:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801a21:	8b 10                	mov    (%eax),%edx
+  801a23:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801a26:	8b 50 04             	mov    0x4(%eax),%edx
+  801a29:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801a2c:	8b 50 08             	mov    0x8(%eax),%edx
+  801a2f:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801a32:	8b 50 0c             	mov    0xc(%eax),%edx
+  801a35:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801a38:	8b 40 10             	mov    0x10(%eax),%eax
+  801a3b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801a3e:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801a41:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a44:	b8 25 00 00 00       	mov    $0x25,%eax
+  801a49:	55                   	push   %ebp
+  801a4a:	56                   	push   %esi
+  801a4b:	8b 0e                	mov    (%esi),%ecx
+  801a4d:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801a50:	8b 7e 08             	mov    0x8(%esi),%edi
+  801a53:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801a56:	8b 76 0c             	mov    0xc(%esi),%esi
+  801a59:	cd 30                	int    $0x30
+  801a5b:	87 34 24             	xchg   %esi,(%esp)
+  801a5e:	89 0e                	mov    %ecx,(%esi)
+  801a60:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801a63:	89 7e 08             	mov    %edi,0x8(%esi)
+  801a66:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801a69:	8f 46 0c             	pop    0xc(%esi)
+  801a6c:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  801a6d:	83 c4 20             	add    $0x20,%esp
+  801a70:	5b                   	pop    %ebx
+  801a71:	5e                   	pop    %esi
+  801a72:	5f                   	pop    %edi
+  801a73:	5d                   	pop    %ebp
+  801a74:	c3                   	ret
+
+00801a75 <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  801a75:	55                   	push   %ebp
+  801a76:	89 e5                	mov    %esp,%ebp
+  801a78:	57                   	push   %edi
+  801a79:	56                   	push   %esi
+  801a7a:	53                   	push   %ebx
+  801a7b:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  801a7e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a81:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  801a83:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a86:	b8 26 00 00 00       	mov    $0x26,%eax
+  801a8b:	55                   	push   %ebp
+  801a8c:	56                   	push   %esi
+  801a8d:	8b 0e                	mov    (%esi),%ecx
+  801a8f:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801a92:	8b 7e 08             	mov    0x8(%esi),%edi
+  801a95:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801a98:	8b 76 0c             	mov    0xc(%esi),%esi
+  801a9b:	cd 30                	int    $0x30
+  801a9d:	87 34 24             	xchg   %esi,(%esp)
+  801aa0:	89 0e                	mov    %ecx,(%esi)
+  801aa2:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801aa5:	89 7e 08             	mov    %edi,0x8(%esi)
+  801aa8:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801aab:	8f 46 0c             	pop    0xc(%esi)
+  801aae:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  801aaf:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  801ab3:	74 0f                	je     801ac4 <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  801ab5:	85 c0                	test   %eax,%eax
+  801ab7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801abc:	0f 48 d1             	cmovs  %ecx,%edx
+  801abf:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  801ac2:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  801ac4:	5b                   	pop    %ebx
+  801ac5:	5e                   	pop    %esi
+  801ac6:	5f                   	pop    %edi
+  801ac7:	5d                   	pop    %ebp
+  801ac8:	c3                   	ret
+
+00801ac9 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  801ac9:	55                   	push   %ebp
+  801aca:	89 e5                	mov    %esp,%ebp
+  801acc:	57                   	push   %edi
+  801acd:	56                   	push   %esi
+  801ace:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801acf:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801ad6:	78 2f                	js     801b07 <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  801ad8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801adf:	74 72                	je     801b53 <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  801ae1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ae4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ae9:	b8 27 00 00 00       	mov    $0x27,%eax
+  801aee:	89 cb                	mov    %ecx,%ebx
+  801af0:	89 cf                	mov    %ecx,%edi
+  801af2:	89 ce                	mov    %ecx,%esi
+  801af4:	55                   	push   %ebp
+  801af5:	68 fe 1a 80 00       	push   $0x801afe
+  801afa:	89 e5                	mov    %esp,%ebp
+  801afc:	0f 34                	sysenter
+  801afe:	83 c4 04             	add    $0x4,%esp
+  801b01:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  801b02:	5b                   	pop    %ebx
+  801b03:	5e                   	pop    %esi
+  801b04:	5f                   	pop    %edi
+  801b05:	5d                   	pop    %ebp
+  801b06:	c3                   	ret
+  801b07:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b0c:	0f a2                	cpuid
+		return 0;
+  801b0e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b13:	f6 c6 08             	test   $0x8,%dh
+  801b16:	74 15                	je     801b2d <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b18:	89 c2                	mov    %eax,%edx
+  801b1a:	c1 ea 08             	shr    $0x8,%edx
+  801b1d:	83 e2 0f             	and    $0xf,%edx
+  801b20:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b25:	83 fa 06             	cmp    $0x6,%edx
+  801b28:	74 0e                	je     801b38 <sys_sysring_setup+0x6f>
+  801b2a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b2d:	0f b6 c9             	movzbl %cl,%ecx
+  801b30:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801b36:	eb a0                	jmp    801ad8 <sys_sysring_setup+0xf>
+  801b38:	89 c2                	mov    %eax,%edx
+  801b3a:	c1 ea 04             	shr    $0x4,%edx
+  801b3d:	83 e2 0f             	and    $0xf,%edx
+  801b40:	83 fa 02             	cmp    $0x2,%edx
+  801b43:	77 e5                	ja     801b2a <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  801b45:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b48:	83 f8 02             	cmp    $0x2,%eax
+  801b4b:	0f 97 c1             	seta   %cl
+  801b4e:	0f b6 c9             	movzbl %cl,%ecx
+  801b51:	eb d7                	jmp    801b2a <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  801b53:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b58:	b8 27 00 00 00       	mov    $0x27,%eax
+  801b5d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b60:	89 cb                	mov    %ecx,%ebx
+  801b62:	89 cf                	mov    %ecx,%edi
+  801b64:	89 ce                	mov    %ecx,%esi
+  801b66:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  801b68:	eb 98                	jmp    801b02 <sys_sysring_setup+0x39>
+
+00801b6a <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  801b6a:	55                   	push   %ebp
+  801b6b:	89 e5                	mov    %esp,%ebp
+  801b6d:	57                   	push   %edi
+  801b6e:	56                   	push   %esi
+  801b6f:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801b70:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b77:	78 2e                	js     801ba7 <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  801b79:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b80:	74 71                	je     801bf3 <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  801b82:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b87:	b8 28 00 00 00       	mov    $0x28,%eax
+  801b8c:	89 d1                	mov    %edx,%ecx
+  801b8e:	89 d3                	mov    %edx,%ebx
+  801b90:	89 d7                	mov    %edx,%edi
+  801b92:	89 d6                	mov    %edx,%esi
+  801b94:	55                   	push   %ebp
+  801b95:	68 9e 1b 80 00       	push   $0x801b9e
+  801b9a:	89 e5                	mov    %esp,%ebp
+  801b9c:	0f 34                	sysenter
+  801b9e:	83 c4 04             	add    $0x4,%esp
+  801ba1:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801ba2:	5b                   	pop    %ebx
+  801ba3:	5e                   	pop    %esi
+  801ba4:	5f                   	pop    %edi
+  801ba5:	5d                   	pop    %ebp
+  801ba6:	c3                   	ret
+  801ba7:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bac:	0f a2                	cpuid
+		return 0;
+  801bae:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801bb3:	f6 c6 08             	test   $0x8,%dh
+  801bb6:	74 15                	je     801bcd <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bb8:	89 c2                	mov    %eax,%edx
+  801bba:	c1 ea 08             	shr    $0x8,%edx
+  801bbd:	83 e2 0f             	and    $0xf,%edx
+  801bc0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801bc5:	83 fa 06             	cmp    $0x6,%edx
+  801bc8:	74 0e                	je     801bd8 <sys_sysring_enter+0x6e>
+  801bca:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801bcd:	0f b6 c9             	movzbl %cl,%ecx
+  801bd0:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801bd6:	eb a1                	jmp    801b79 <sys_sysring_enter+0xf>
+  801bd8:	89 c2                	mov    %eax,%edx
+  801bda:	c1 ea 04             	shr    $0x4,%edx
+  801bdd:	83 e2 0f             	and    $0xf,%edx
+  801be0:	83 fa 02             	cmp    $0x2,%edx
+  801be3:	77 e5                	ja     801bca <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  801be5:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801be8:	83 f8 02             	cmp    $0x2,%eax
+  801beb:	0f 97 c1             	seta   %cl
+  801bee:	0f b6 c9             	movzbl %cl,%ecx
+  801bf1:	eb d7                	jmp    801bca <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  801bf3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bf8:	b8 28 00 00 00       	mov    $0x28,%eax
+  801bfd:	89 d1                	mov    %edx,%ecx
+  801bff:	89 d3                	mov    %edx,%ebx
+  801c01:	89 d7                	mov    %edx,%edi
+  801c03:	89 d6                	mov    %edx,%esi
+  801c05:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  801c07:	eb 99                	jmp    801ba2 <sys_sysring_enter+0x38>
+
+00801c09 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801c09:	55                   	push   %ebp
+  801c0a:	89 e5                	mov    %esp,%ebp
+  801c0c:	57                   	push   %edi
+  801c0d:	56                   	push   %esi
+  801c0e:	53                   	push   %ebx
+  801c0f:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  801c15:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  801c18:	8b 1d 00 30 80 00    	mov    0x803000,%ebx
+  801c1e:	e8 c8 e8 ff ff       	call   8004eb <sys_getenvid>
+  801c23:	83 ec 04             	sub    $0x4,%esp
+  801c26:	ff 75 0c             	push   0xc(%ebp)
+  801c29:	ff 75 08             	push   0x8(%ebp)
+  801c2c:	53                   	push   %ebx
+  801c2d:	50                   	push   %eax
+  801c2e:	68 f8 27 80 00       	push   $0x8027f8
+  801c33:	68 00 01 00 00       	push   $0x100
+  801c38:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  801c3e:	56                   	push   %esi
+  801c3f:	e8 c9 05 00 00       	call   80220d <snprintf>
+  801c44:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  801c46:	83 c4 20             	add    $0x20,%esp
+  801c49:	57                   	push   %edi
+  801c4a:	ff 75 10             	push   0x10(%ebp)
+  801c4d:	bf 00 01 00 00       	mov    $0x100,%edi
+  801c52:	89 f8                	mov    %edi,%eax
+  801c54:	29 d8                	sub    %ebx,%eax
+  801c56:	50                   	push   %eax
+  801c57:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801c5a:	50                   	push   %eax
+  801c5b:	e8 5f 05 00 00       	call   8021bf <vsnprintf>
+  801c60:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  801c62:	83 c4 0c             	add    $0xc,%esp
+  801c65:	68 1b 28 80 00       	push   $0x80281b
+  801c6a:	29 df                	sub    %ebx,%edi
+  801c6c:	57                   	push   %edi
+  801c6d:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801c70:	50                   	push   %eax
+  801c71:	e8 97 05 00 00       	call   80220d <snprintf>
+	sys_cputs(buf, r);
+  801c76:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  801c79:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  801c7b:	53                   	push   %ebx
+  801c7c:	56                   	push   %esi
+  801c7d:	e8 6b e6 ff ff       	call   8002ed <sys_cputs>
+  801c82:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801c85:	cc                   	int3
+	while (1)
+  801c86:	eb fd                	jmp    801c85 <_panic+0x7c>
+
+00801c88 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801c88:	55                   	push   %ebp
+  801c89:	89 e5                	mov    %esp,%ebp
+  801c8b:	57                   	push   %edi
+  801c8c:	56                   	push   %esi
+  801c8d:	53                   	push   %ebx
+  801c8e:	83 ec 1c             	sub    $0x1c,%esp
+  801c91:	89 c7                	mov    %eax,%edi
+  801c93:	89 d6                	mov    %edx,%esi
+  801c95:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c98:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c9b:	89 d1                	mov    %edx,%ecx
+  801c9d:	89 c2                	mov    %eax,%edx
+  801c9f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801ca2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801ca5:	8b 45 10             	mov    0x10(%ebp),%eax
+  801ca8:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  801cab:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801cae:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801cb5:	39 c2                	cmp    %eax,%edx
+  801cb7:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  801cba:	72 3e                	jb     801cfa <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801cbc:	83 ec 0c             	sub    $0xc,%esp
+  801cbf:	ff 75 18             	push   0x18(%ebp)
+  801cc2:	83 eb 01             	sub    $0x1,%ebx
+  801cc5:	53                   	push   %ebx
+  801cc6:	50                   	push   %eax
+  801cc7:	83 ec 08             	sub    $0x8,%esp
+  801cca:	ff 75 e4             	push   -0x1c(%ebp)
+  801ccd:	ff 75 e0             	push   -0x20(%ebp)
+  801cd0:	ff 75 dc             	push   -0x24(%ebp)
+  801cd3:	ff 75 d8             	push   -0x28(%ebp)
+  801cd6:	e8 9a 09 00 00       	call   802675 <__udivdi3>
+  801cdb:	83 c4 18             	add    $0x18,%esp
+  801cde:	52                   	push   %edx
+  801cdf:	50                   	push   %eax
+  801ce0:	89 f2                	mov    %esi,%edx
+  801ce2:	89 f8                	mov    %edi,%eax
+  801ce4:	e8 9f ff ff ff       	call   801c88 <printnum>
+  801ce9:	83 c4 20             	add    $0x20,%esp
+  801cec:	eb 13                	jmp    801d01 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  801cee:	83 ec 08             	sub    $0x8,%esp
+  801cf1:	56                   	push   %esi
+  801cf2:	ff 75 18             	push   0x18(%ebp)
+  801cf5:	ff d7                	call   *%edi
+  801cf7:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  801cfa:	83 eb 01             	sub    $0x1,%ebx
+  801cfd:	85 db                	test   %ebx,%ebx
+  801cff:	7f ed                	jg     801cee <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  801d01:	83 ec 08             	sub    $0x8,%esp
+  801d04:	56                   	push   %esi
+  801d05:	83 ec 04             	sub    $0x4,%esp
+  801d08:	ff 75 e4             	push   -0x1c(%ebp)
+  801d0b:	ff 75 e0             	push   -0x20(%ebp)
+  801d0e:	ff 75 dc             	push   -0x24(%ebp)
+  801d11:	ff 75 d8             	push   -0x28(%ebp)
+  801d14:	e8 7a 09 00 00       	call   802693 <__umoddi3>
+  801d19:	83 c4 14             	add    $0x14,%esp
+  801d1c:	0f be 80 1d 28 80 00 	movsbl 0x80281d(%eax),%eax
+  801d23:	50                   	push   %eax
+  801d24:	ff d7                	call   *%edi
+}
+  801d26:	83 c4 10             	add    $0x10,%esp
+  801d29:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d2c:	5b                   	pop    %ebx
+  801d2d:	5e                   	pop    %esi
+  801d2e:	5f                   	pop    %edi
+  801d2f:	5d                   	pop    %ebp
+  801d30:	c3                   	ret
+
+00801d31 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801d31:	55                   	push   %ebp
+  801d32:	89 e5                	mov    %esp,%ebp
+  801d34:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  801d37:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  801d3b:	8b 10                	mov    (%eax),%edx
+  801d3d:	3b 50 04             	cmp    0x4(%eax),%edx
+  801d40:	73 0a                	jae    801d4c <sprintputch+0x1b>
+		*b->buf++ = ch;
+  801d42:	8d 4a 01             	lea    0x1(%edx),%ecx
+  801d45:	89 08                	mov    %ecx,(%eax)
+  801d47:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d4a:	88 02                	mov    %al,(%edx)
+}
+  801d4c:	5d                   	pop    %ebp
+  801d4d:	c3                   	ret
+
+00801d4e <printfmt>:
+{
+  801d4e:	55                   	push   %ebp
+  801d4f:	89 e5                	mov    %esp,%ebp
+  801d51:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  801d54:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  801d57:	50                   	push   %eax
+  801d58:	ff 75 10             	push   0x10(%ebp)
+  801d5b:	ff 75 0c             	push   0xc(%ebp)
+  801d5e:	ff 75 08             	push   0x8(%ebp)
+  801d61:	e8 05 00 00 00       	call   801d6b <vprintfmt>
+}
+  801d66:	83 c4 10             	add    $0x10,%esp
+  801d69:	c9                   	leave
+  801d6a:	c3                   	ret
+
+00801d6b <vprintfmt>:
+{
+  801d6b:	55                   	push   %ebp
+  801d6c:	89 e5                	mov    %esp,%ebp
+  801d6e:	57                   	push   %edi
+  801d6f:	56                   	push   %esi
+  801d70:	53                   	push   %ebx
+  801d71:	83 ec 2c             	sub    $0x2c,%esp
+  801d74:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d77:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801d7a:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801d7d:	eb 0a                	jmp    801d89 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  801d7f:	83 ec 08             	sub    $0x8,%esp
+  801d82:	53                   	push   %ebx
+  801d83:	50                   	push   %eax
+  801d84:	ff d6                	call   *%esi
+  801d86:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801d89:	83 c7 01             	add    $0x1,%edi
+  801d8c:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801d90:	83 f8 25             	cmp    $0x25,%eax
+  801d93:	74 0c                	je     801da1 <vprintfmt+0x36>
+			if (ch == '\0')
+  801d95:	85 c0                	test   %eax,%eax
+  801d97:	75 e6                	jne    801d7f <vprintfmt+0x14>
+}
+  801d99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d9c:	5b                   	pop    %ebx
+  801d9d:	5e                   	pop    %esi
+  801d9e:	5f                   	pop    %edi
+  801d9f:	5d                   	pop    %ebp
+  801da0:	c3                   	ret
+		padc = ' ';
+  801da1:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801da5:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  801dac:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801db3:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  801dba:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801dbf:	8d 47 01             	lea    0x1(%edi),%eax
+  801dc2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801dc5:	0f b6 17             	movzbl (%edi),%edx
+  801dc8:	8d 42 dd             	lea    -0x23(%edx),%eax
+  801dcb:	3c 55                	cmp    $0x55,%al
+  801dcd:	0f 87 cf 03 00 00    	ja     8021a2 <vprintfmt+0x437>
+  801dd3:	0f b6 c0             	movzbl %al,%eax
+  801dd6:	ff 24 85 00 29 80 00 	jmp    *0x802900(,%eax,4)
+  801ddd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801de0:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801de4:	eb d9                	jmp    801dbf <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801de6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801de9:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  801ded:	eb d0                	jmp    801dbf <vprintfmt+0x54>
+  801def:	0f b6 d2             	movzbl %dl,%edx
+  801df2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  801df5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dfa:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  801dfd:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801e00:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  801e04:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  801e07:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  801e0a:	83 f9 09             	cmp    $0x9,%ecx
+  801e0d:	77 55                	ja     801e64 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  801e0f:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  801e12:	eb e9                	jmp    801dfd <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  801e14:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e17:	8b 00                	mov    (%eax),%eax
+  801e19:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801e1c:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e1f:	8d 40 04             	lea    0x4(%eax),%eax
+  801e22:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801e25:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  801e28:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801e2c:	79 91                	jns    801dbf <vprintfmt+0x54>
+				width = precision, precision = -1;
+  801e2e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801e31:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801e34:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  801e3b:	eb 82                	jmp    801dbf <vprintfmt+0x54>
+			if (width < 0)
+  801e3d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801e40:	85 d2                	test   %edx,%edx
+  801e42:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e47:	0f 49 c2             	cmovns %edx,%eax
+  801e4a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801e4d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801e50:	e9 6a ff ff ff       	jmp    801dbf <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801e55:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  801e58:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  801e5f:	e9 5b ff ff ff       	jmp    801dbf <vprintfmt+0x54>
+  801e64:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801e67:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801e6a:	eb bc                	jmp    801e28 <vprintfmt+0xbd>
+			lflag++;
+  801e6c:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801e6f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801e72:	e9 48 ff ff ff       	jmp    801dbf <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  801e77:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e7a:	8d 78 04             	lea    0x4(%eax),%edi
+  801e7d:	83 ec 08             	sub    $0x8,%esp
+  801e80:	53                   	push   %ebx
+  801e81:	ff 30                	push   (%eax)
+  801e83:	ff d6                	call   *%esi
+			break;
+  801e85:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801e88:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  801e8b:	e9 b1 02 00 00       	jmp    802141 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  801e90:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e93:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801e96:	8b 10                	mov    (%eax),%edx
+  801e98:	89 d0                	mov    %edx,%eax
+  801e9a:	f7 d8                	neg    %eax
+  801e9c:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801e9f:	83 f8 0d             	cmp    $0xd,%eax
+  801ea2:	7f 23                	jg     801ec7 <vprintfmt+0x15c>
+  801ea4:	8b 14 85 60 2a 80 00 	mov    0x802a60(,%eax,4),%edx
+  801eab:	85 d2                	test   %edx,%edx
+  801ead:	74 18                	je     801ec7 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801eaf:	52                   	push   %edx
+  801eb0:	68 3e 28 80 00       	push   $0x80283e
+  801eb5:	53                   	push   %ebx
+  801eb6:	56                   	push   %esi
+  801eb7:	e8 92 fe ff ff       	call   801d4e <printfmt>
+  801ebc:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801ebf:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801ec2:	e9 7a 02 00 00       	jmp    802141 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  801ec7:	50                   	push   %eax
+  801ec8:	68 35 28 80 00       	push   $0x802835
+  801ecd:	53                   	push   %ebx
+  801ece:	56                   	push   %esi
+  801ecf:	e8 7a fe ff ff       	call   801d4e <printfmt>
+  801ed4:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801ed7:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801eda:	e9 62 02 00 00       	jmp    802141 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801edf:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ee2:	83 c0 04             	add    $0x4,%eax
+  801ee5:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801ee8:	8b 45 14             	mov    0x14(%ebp),%eax
+  801eeb:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801eed:	85 c9                	test   %ecx,%ecx
+  801eef:	b8 2e 28 80 00       	mov    $0x80282e,%eax
+  801ef4:	0f 45 c1             	cmovne %ecx,%eax
+  801ef7:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801efa:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801efe:	7e 06                	jle    801f06 <vprintfmt+0x19b>
+  801f00:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801f04:	75 0b                	jne    801f11 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f06:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801f09:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801f0c:	89 75 08             	mov    %esi,0x8(%ebp)
+  801f0f:	eb 5c                	jmp    801f6d <vprintfmt+0x202>
+  801f11:	83 ec 08             	sub    $0x8,%esp
+  801f14:	ff 75 d0             	push   -0x30(%ebp)
+  801f17:	ff 75 cc             	push   -0x34(%ebp)
+  801f1a:	e8 20 03 00 00       	call   80223f <strnlen>
+  801f1f:	89 c2                	mov    %eax,%edx
+  801f21:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f24:	29 d0                	sub    %edx,%eax
+  801f26:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801f29:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  801f2d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801f30:	89 75 08             	mov    %esi,0x8(%ebp)
+  801f33:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f35:	eb 0e                	jmp    801f45 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801f37:	83 ec 08             	sub    $0x8,%esp
+  801f3a:	53                   	push   %ebx
+  801f3b:	57                   	push   %edi
+  801f3c:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f3f:	83 ee 01             	sub    $0x1,%esi
+  801f42:	83 c4 10             	add    $0x10,%esp
+  801f45:	85 f6                	test   %esi,%esi
+  801f47:	7f ee                	jg     801f37 <vprintfmt+0x1cc>
+  801f49:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f4c:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f4f:	85 c0                	test   %eax,%eax
+  801f51:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f56:	0f 49 d0             	cmovns %eax,%edx
+  801f59:	29 d0                	sub    %edx,%eax
+  801f5b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801f5e:	eb a6                	jmp    801f06 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801f60:	83 ec 08             	sub    $0x8,%esp
+  801f63:	53                   	push   %ebx
+  801f64:	52                   	push   %edx
+  801f65:	ff 55 08             	call   *0x8(%ebp)
+  801f68:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801f6b:	89 f1                	mov    %esi,%ecx
+  801f6d:	8d 71 01             	lea    0x1(%ecx),%esi
+  801f70:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801f74:	0f be d0             	movsbl %al,%edx
+  801f77:	85 d2                	test   %edx,%edx
+  801f79:	74 28                	je     801fa3 <vprintfmt+0x238>
+  801f7b:	85 ff                	test   %edi,%edi
+  801f7d:	78 05                	js     801f84 <vprintfmt+0x219>
+  801f7f:	83 ef 01             	sub    $0x1,%edi
+  801f82:	78 30                	js     801fb4 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801f84:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801f88:	74 d6                	je     801f60 <vprintfmt+0x1f5>
+  801f8a:	0f be c0             	movsbl %al,%eax
+  801f8d:	83 e8 20             	sub    $0x20,%eax
+  801f90:	83 f8 5e             	cmp    $0x5e,%eax
+  801f93:	76 cb                	jbe    801f60 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801f95:	83 ec 08             	sub    $0x8,%esp
+  801f98:	53                   	push   %ebx
+  801f99:	6a 3f                	push   $0x3f
+  801f9b:	ff 55 08             	call   *0x8(%ebp)
+  801f9e:	83 c4 10             	add    $0x10,%esp
+  801fa1:	eb c8                	jmp    801f6b <vprintfmt+0x200>
+  801fa3:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fa6:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801fa9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801fac:	01 d0                	add    %edx,%eax
+  801fae:	29 c8                	sub    %ecx,%eax
+  801fb0:	89 c7                	mov    %eax,%edi
+  801fb2:	eb 13                	jmp    801fc7 <vprintfmt+0x25c>
+  801fb4:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fb7:	eb ed                	jmp    801fa6 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801fb9:	83 ec 08             	sub    $0x8,%esp
+  801fbc:	53                   	push   %ebx
+  801fbd:	6a 20                	push   $0x20
+  801fbf:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801fc1:	83 ef 01             	sub    $0x1,%edi
+  801fc4:	83 c4 10             	add    $0x10,%esp
+  801fc7:	85 ff                	test   %edi,%edi
+  801fc9:	7f ee                	jg     801fb9 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801fcb:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801fce:	89 45 14             	mov    %eax,0x14(%ebp)
+  801fd1:	e9 6b 01 00 00       	jmp    802141 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  801fd6:	83 f9 01             	cmp    $0x1,%ecx
+  801fd9:	7f 1f                	jg     801ffa <vprintfmt+0x28f>
+	else if (lflag)
+  801fdb:	85 c9                	test   %ecx,%ecx
+  801fdd:	74 67                	je     802046 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  801fdf:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fe2:	8b 00                	mov    (%eax),%eax
+  801fe4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801fe7:	89 c1                	mov    %eax,%ecx
+  801fe9:	c1 f9 1f             	sar    $0x1f,%ecx
+  801fec:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801fef:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ff2:	8d 40 04             	lea    0x4(%eax),%eax
+  801ff5:	89 45 14             	mov    %eax,0x14(%ebp)
+  801ff8:	eb 17                	jmp    802011 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  801ffa:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ffd:	8b 50 04             	mov    0x4(%eax),%edx
+  802000:	8b 00                	mov    (%eax),%eax
+  802002:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802005:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802008:	8b 45 14             	mov    0x14(%ebp),%eax
+  80200b:	8d 40 08             	lea    0x8(%eax),%eax
+  80200e:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  802011:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802014:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  802017:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80201c:	85 c9                	test   %ecx,%ecx
+  80201e:	0f 89 03 01 00 00    	jns    802127 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  802024:	83 ec 08             	sub    $0x8,%esp
+  802027:	53                   	push   %ebx
+  802028:	6a 2d                	push   $0x2d
+  80202a:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80202c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80202f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802032:	f7 da                	neg    %edx
+  802034:	83 d1 00             	adc    $0x0,%ecx
+  802037:	f7 d9                	neg    %ecx
+  802039:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80203c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802041:	e9 e1 00 00 00       	jmp    802127 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  802046:	8b 45 14             	mov    0x14(%ebp),%eax
+  802049:	8b 00                	mov    (%eax),%eax
+  80204b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80204e:	89 c1                	mov    %eax,%ecx
+  802050:	c1 f9 1f             	sar    $0x1f,%ecx
+  802053:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802056:	8b 45 14             	mov    0x14(%ebp),%eax
+  802059:	8d 40 04             	lea    0x4(%eax),%eax
+  80205c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80205f:	eb b0                	jmp    802011 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  802061:	83 f9 01             	cmp    $0x1,%ecx
+  802064:	7f 1e                	jg     802084 <vprintfmt+0x319>
+	else if (lflag)
+  802066:	85 c9                	test   %ecx,%ecx
+  802068:	74 32                	je     80209c <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  80206a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80206d:	8b 10                	mov    (%eax),%edx
+  80206f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802074:	8d 40 04             	lea    0x4(%eax),%eax
+  802077:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80207a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80207f:	e9 a3 00 00 00       	jmp    802127 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802084:	8b 45 14             	mov    0x14(%ebp),%eax
+  802087:	8b 10                	mov    (%eax),%edx
+  802089:	8b 48 04             	mov    0x4(%eax),%ecx
+  80208c:	8d 40 08             	lea    0x8(%eax),%eax
+  80208f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802092:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  802097:	e9 8b 00 00 00       	jmp    802127 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80209c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80209f:	8b 10                	mov    (%eax),%edx
+  8020a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020a6:	8d 40 04             	lea    0x4(%eax),%eax
+  8020a9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8020ac:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8020b1:	eb 74                	jmp    802127 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8020b3:	83 f9 01             	cmp    $0x1,%ecx
+  8020b6:	7f 1b                	jg     8020d3 <vprintfmt+0x368>
+	else if (lflag)
+  8020b8:	85 c9                	test   %ecx,%ecx
+  8020ba:	74 2c                	je     8020e8 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8020bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020bf:	8b 10                	mov    (%eax),%edx
+  8020c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020c6:	8d 40 04             	lea    0x4(%eax),%eax
+  8020c9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8020cc:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8020d1:	eb 54                	jmp    802127 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8020d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020d6:	8b 10                	mov    (%eax),%edx
+  8020d8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8020db:	8d 40 08             	lea    0x8(%eax),%eax
+  8020de:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8020e1:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8020e6:	eb 3f                	jmp    802127 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8020e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020eb:	8b 10                	mov    (%eax),%edx
+  8020ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020f2:	8d 40 04             	lea    0x4(%eax),%eax
+  8020f5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8020f8:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8020fd:	eb 28                	jmp    802127 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8020ff:	83 ec 08             	sub    $0x8,%esp
+  802102:	53                   	push   %ebx
+  802103:	6a 30                	push   $0x30
+  802105:	ff d6                	call   *%esi
+			putch('x', putdat);
+  802107:	83 c4 08             	add    $0x8,%esp
+  80210a:	53                   	push   %ebx
+  80210b:	6a 78                	push   $0x78
+  80210d:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80210f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802112:	8b 10                	mov    (%eax),%edx
+  802114:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  802119:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80211c:	8d 40 04             	lea    0x4(%eax),%eax
+  80211f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802122:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  802127:	83 ec 0c             	sub    $0xc,%esp
+  80212a:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80212e:	50                   	push   %eax
+  80212f:	ff 75 e0             	push   -0x20(%ebp)
+  802132:	57                   	push   %edi
+  802133:	51                   	push   %ecx
+  802134:	52                   	push   %edx
+  802135:	89 da                	mov    %ebx,%edx
+  802137:	89 f0                	mov    %esi,%eax
+  802139:	e8 4a fb ff ff       	call   801c88 <printnum>
+			break;
+  80213e:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  802141:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802144:	e9 40 fc ff ff       	jmp    801d89 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  802149:	83 f9 01             	cmp    $0x1,%ecx
+  80214c:	7f 1b                	jg     802169 <vprintfmt+0x3fe>
+	else if (lflag)
+  80214e:	85 c9                	test   %ecx,%ecx
+  802150:	74 2c                	je     80217e <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  802152:	8b 45 14             	mov    0x14(%ebp),%eax
+  802155:	8b 10                	mov    (%eax),%edx
+  802157:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80215c:	8d 40 04             	lea    0x4(%eax),%eax
+  80215f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802162:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  802167:	eb be                	jmp    802127 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802169:	8b 45 14             	mov    0x14(%ebp),%eax
+  80216c:	8b 10                	mov    (%eax),%edx
+  80216e:	8b 48 04             	mov    0x4(%eax),%ecx
+  802171:	8d 40 08             	lea    0x8(%eax),%eax
+  802174:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802177:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80217c:	eb a9                	jmp    802127 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80217e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802181:	8b 10                	mov    (%eax),%edx
+  802183:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802188:	8d 40 04             	lea    0x4(%eax),%eax
+  80218b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80218e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  802193:	eb 92                	jmp    802127 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  802195:	83 ec 08             	sub    $0x8,%esp
+  802198:	53                   	push   %ebx
+  802199:	6a 25                	push   $0x25
+  80219b:	ff d6                	call   *%esi
+			break;
+  80219d:	83 c4 10             	add    $0x10,%esp
+  8021a0:	eb 9f                	jmp    802141 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8021a2:	83 ec 08             	sub    $0x8,%esp
+  8021a5:	53                   	push   %ebx
+  8021a6:	6a 25                	push   $0x25
+  8021a8:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8021aa:	83 c4 10             	add    $0x10,%esp
+  8021ad:	89 f8                	mov    %edi,%eax
+  8021af:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8021b3:	74 05                	je     8021ba <vprintfmt+0x44f>
+  8021b5:	83 e8 01             	sub    $0x1,%eax
+  8021b8:	eb f5                	jmp    8021af <vprintfmt+0x444>
+  8021ba:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8021bd:	eb 82                	jmp    802141 <vprintfmt+0x3d6>
+
+008021bf <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8021bf:	55                   	push   %ebp
+  8021c0:	89 e5                	mov    %esp,%ebp
+  8021c2:	83 ec 18             	sub    $0x18,%esp
+  8021c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021c8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8021cb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8021ce:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8021d2:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8021d5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8021dc:	85 c0                	test   %eax,%eax
+  8021de:	74 26                	je     802206 <vsnprintf+0x47>
+  8021e0:	85 d2                	test   %edx,%edx
+  8021e2:	7e 22                	jle    802206 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8021e4:	ff 75 14             	push   0x14(%ebp)
+  8021e7:	ff 75 10             	push   0x10(%ebp)
+  8021ea:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8021ed:	50                   	push   %eax
+  8021ee:	68 31 1d 80 00       	push   $0x801d31
+  8021f3:	e8 73 fb ff ff       	call   801d6b <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8021f8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8021fb:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8021fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802201:	83 c4 10             	add    $0x10,%esp
+}
+  802204:	c9                   	leave
+  802205:	c3                   	ret
+		return -E_INVAL;
+  802206:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80220b:	eb f7                	jmp    802204 <vsnprintf+0x45>
+
+0080220d <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80220d:	55                   	push   %ebp
+  80220e:	89 e5                	mov    %esp,%ebp
+  802210:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  802213:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  802216:	50                   	push   %eax
+  802217:	ff 75 10             	push   0x10(%ebp)
+  80221a:	ff 75 0c             	push   0xc(%ebp)
+  80221d:	ff 75 08             	push   0x8(%ebp)
+  802220:	e8 9a ff ff ff       	call   8021bf <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  802225:	c9                   	leave
+  802226:	c3                   	ret
+
+00802227 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  802227:	55                   	push   %ebp
+  802228:	89 e5                	mov    %esp,%ebp
+  80222a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80222d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802232:	eb 03                	jmp    802237 <strlen+0x10>
+		n++;
+  802234:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  802237:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80223b:	75 f7                	jne    802234 <strlen+0xd>
+	return n;
+}
+  80223d:	5d                   	pop    %ebp
+  80223e:	c3                   	ret
+
+0080223f <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80223f:	55                   	push   %ebp
+  802240:	89 e5                	mov    %esp,%ebp
+  802242:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802245:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802248:	b8 00 00 00 00       	mov    $0x0,%eax
+  80224d:	eb 03                	jmp    802252 <strnlen+0x13>
+		n++;
+  80224f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802252:	39 d0                	cmp    %edx,%eax
+  802254:	74 08                	je     80225e <strnlen+0x1f>
+  802256:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80225a:	75 f3                	jne    80224f <strnlen+0x10>
+  80225c:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80225e:	89 d0                	mov    %edx,%eax
+  802260:	5d                   	pop    %ebp
+  802261:	c3                   	ret
+
+00802262 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  802262:	55                   	push   %ebp
+  802263:	89 e5                	mov    %esp,%ebp
+  802265:	53                   	push   %ebx
+  802266:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802269:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80226c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802271:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  802275:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  802278:	83 c0 01             	add    $0x1,%eax
+  80227b:	84 d2                	test   %dl,%dl
+  80227d:	75 f2                	jne    802271 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80227f:	89 c8                	mov    %ecx,%eax
+  802281:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802284:	c9                   	leave
+  802285:	c3                   	ret
+
+00802286 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  802286:	55                   	push   %ebp
+  802287:	89 e5                	mov    %esp,%ebp
+  802289:	53                   	push   %ebx
+  80228a:	83 ec 10             	sub    $0x10,%esp
+  80228d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  802290:	53                   	push   %ebx
+  802291:	e8 91 ff ff ff       	call   802227 <strlen>
+  802296:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  802299:	ff 75 0c             	push   0xc(%ebp)
+  80229c:	01 d8                	add    %ebx,%eax
+  80229e:	50                   	push   %eax
+  80229f:	e8 be ff ff ff       	call   802262 <strcpy>
+	return dst;
+}
+  8022a4:	89 d8                	mov    %ebx,%eax
+  8022a6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022a9:	c9                   	leave
+  8022aa:	c3                   	ret
+
+008022ab <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8022ab:	55                   	push   %ebp
+  8022ac:	89 e5                	mov    %esp,%ebp
+  8022ae:	56                   	push   %esi
+  8022af:	53                   	push   %ebx
+  8022b0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8022b3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8022b6:	89 f3                	mov    %esi,%ebx
+  8022b8:	03 5d 10             	add    0x10(%ebp),%ebx
+  8022bb:	89 f0                	mov    %esi,%eax
+  8022bd:	eb 0f                	jmp    8022ce <strncpy+0x23>
+		*dst++ = *src;
+  8022bf:	83 c0 01             	add    $0x1,%eax
+  8022c2:	0f b6 0a             	movzbl (%edx),%ecx
+  8022c5:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8022c8:	80 f9 01             	cmp    $0x1,%cl
+  8022cb:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8022ce:	39 d8                	cmp    %ebx,%eax
+  8022d0:	75 ed                	jne    8022bf <strncpy+0x14>
+	}
+	return ret;
+}
+  8022d2:	89 f0                	mov    %esi,%eax
+  8022d4:	5b                   	pop    %ebx
+  8022d5:	5e                   	pop    %esi
+  8022d6:	5d                   	pop    %ebp
+  8022d7:	c3                   	ret
+
+008022d8 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8022d8:	55                   	push   %ebp
+  8022d9:	89 e5                	mov    %esp,%ebp
+  8022db:	56                   	push   %esi
+  8022dc:	53                   	push   %ebx
+  8022dd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8022e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022e3:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8022e6:	89 f0                	mov    %esi,%eax
+  8022e8:	85 d2                	test   %edx,%edx
+  8022ea:	74 21                	je     80230d <strlcpy+0x35>
+  8022ec:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8022f0:	89 f2                	mov    %esi,%edx
+  8022f2:	eb 09                	jmp    8022fd <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8022f4:	83 c1 01             	add    $0x1,%ecx
+  8022f7:	83 c2 01             	add    $0x1,%edx
+  8022fa:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8022fd:	39 c2                	cmp    %eax,%edx
+  8022ff:	74 09                	je     80230a <strlcpy+0x32>
+  802301:	0f b6 19             	movzbl (%ecx),%ebx
+  802304:	84 db                	test   %bl,%bl
+  802306:	75 ec                	jne    8022f4 <strlcpy+0x1c>
+  802308:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80230a:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80230d:	29 f0                	sub    %esi,%eax
+}
+  80230f:	5b                   	pop    %ebx
+  802310:	5e                   	pop    %esi
+  802311:	5d                   	pop    %ebp
+  802312:	c3                   	ret
+
+00802313 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  802313:	55                   	push   %ebp
+  802314:	89 e5                	mov    %esp,%ebp
+  802316:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802319:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80231c:	eb 06                	jmp    802324 <strcmp+0x11>
+		p++, q++;
+  80231e:	83 c1 01             	add    $0x1,%ecx
+  802321:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  802324:	0f b6 01             	movzbl (%ecx),%eax
+  802327:	84 c0                	test   %al,%al
+  802329:	74 04                	je     80232f <strcmp+0x1c>
+  80232b:	3a 02                	cmp    (%edx),%al
+  80232d:	74 ef                	je     80231e <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80232f:	0f b6 c0             	movzbl %al,%eax
+  802332:	0f b6 12             	movzbl (%edx),%edx
+  802335:	29 d0                	sub    %edx,%eax
+}
+  802337:	5d                   	pop    %ebp
+  802338:	c3                   	ret
+
+00802339 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  802339:	55                   	push   %ebp
+  80233a:	89 e5                	mov    %esp,%ebp
+  80233c:	53                   	push   %ebx
+  80233d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802340:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802343:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  802346:	eb 09                	jmp    802351 <strncmp+0x18>
+		n--, p++, q++;
+  802348:	83 ea 01             	sub    $0x1,%edx
+  80234b:	83 c0 01             	add    $0x1,%eax
+  80234e:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  802351:	85 d2                	test   %edx,%edx
+  802353:	74 18                	je     80236d <strncmp+0x34>
+  802355:	0f b6 18             	movzbl (%eax),%ebx
+  802358:	84 db                	test   %bl,%bl
+  80235a:	74 04                	je     802360 <strncmp+0x27>
+  80235c:	3a 19                	cmp    (%ecx),%bl
+  80235e:	74 e8                	je     802348 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  802360:	0f b6 00             	movzbl (%eax),%eax
+  802363:	0f b6 11             	movzbl (%ecx),%edx
+  802366:	29 d0                	sub    %edx,%eax
+}
+  802368:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80236b:	c9                   	leave
+  80236c:	c3                   	ret
+		return 0;
+  80236d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802372:	eb f4                	jmp    802368 <strncmp+0x2f>
+
+00802374 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  802374:	55                   	push   %ebp
+  802375:	89 e5                	mov    %esp,%ebp
+  802377:	8b 45 08             	mov    0x8(%ebp),%eax
+  80237a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80237e:	eb 03                	jmp    802383 <strchr+0xf>
+  802380:	83 c0 01             	add    $0x1,%eax
+  802383:	0f b6 10             	movzbl (%eax),%edx
+  802386:	84 d2                	test   %dl,%dl
+  802388:	74 06                	je     802390 <strchr+0x1c>
+		if (*s == c)
+  80238a:	38 ca                	cmp    %cl,%dl
+  80238c:	75 f2                	jne    802380 <strchr+0xc>
+  80238e:	eb 05                	jmp    802395 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  802390:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802395:	5d                   	pop    %ebp
+  802396:	c3                   	ret
+
+00802397 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  802397:	55                   	push   %ebp
+  802398:	89 e5                	mov    %esp,%ebp
+  80239a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80239d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8023a1:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8023a4:	38 ca                	cmp    %cl,%dl
+  8023a6:	74 09                	je     8023b1 <strfind+0x1a>
+  8023a8:	84 d2                	test   %dl,%dl
+  8023aa:	74 05                	je     8023b1 <strfind+0x1a>
+	for (; *s; s++)
+  8023ac:	83 c0 01             	add    $0x1,%eax
+  8023af:	eb f0                	jmp    8023a1 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8023b1:	5d                   	pop    %ebp
+  8023b2:	c3                   	ret
+
+008023b3 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8023b3:	55                   	push   %ebp
+  8023b4:	89 e5                	mov    %esp,%ebp
+  8023b6:	57                   	push   %edi
+  8023b7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8023ba:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8023bd:	85 c9                	test   %ecx,%ecx
+  8023bf:	74 20                	je     8023e1 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8023c1:	89 f8                	mov    %edi,%eax
+  8023c3:	09 c8                	or     %ecx,%eax
+  8023c5:	a8 03                	test   $0x3,%al
+  8023c7:	75 12                	jne    8023db <memset+0x28>
+		c &= 0xFF;
+  8023c9:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8023cd:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8023d3:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8023d6:	fc                   	cld
+  8023d7:	f3 ab                	rep stos %eax,%es:(%edi)
+  8023d9:	eb 06                	jmp    8023e1 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8023db:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023de:	fc                   	cld
+  8023df:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8023e1:	89 f8                	mov    %edi,%eax
+  8023e3:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8023e6:	c9                   	leave
+  8023e7:	c3                   	ret
+
+008023e8 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8023e8:	55                   	push   %ebp
+  8023e9:	89 e5                	mov    %esp,%ebp
+  8023eb:	57                   	push   %edi
+  8023ec:	56                   	push   %esi
+  8023ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023f0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8023f3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8023f6:	39 c6                	cmp    %eax,%esi
+  8023f8:	73 32                	jae    80242c <memmove+0x44>
+  8023fa:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8023fd:	39 d0                	cmp    %edx,%eax
+  8023ff:	73 2b                	jae    80242c <memmove+0x44>
+		s += n;
+		d += n;
+  802401:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802404:	89 d6                	mov    %edx,%esi
+  802406:	09 fe                	or     %edi,%esi
+  802408:	09 ce                	or     %ecx,%esi
+  80240a:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  802410:	75 0e                	jne    802420 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  802412:	83 ef 04             	sub    $0x4,%edi
+  802415:	8d 72 fc             	lea    -0x4(%edx),%esi
+  802418:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80241b:	fd                   	std
+  80241c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80241e:	eb 09                	jmp    802429 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  802420:	83 ef 01             	sub    $0x1,%edi
+  802423:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  802426:	fd                   	std
+  802427:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  802429:	fc                   	cld
+  80242a:	eb 1a                	jmp    802446 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80242c:	89 f2                	mov    %esi,%edx
+  80242e:	09 c2                	or     %eax,%edx
+  802430:	09 ca                	or     %ecx,%edx
+  802432:	f6 c2 03             	test   $0x3,%dl
+  802435:	75 0a                	jne    802441 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  802437:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80243a:	89 c7                	mov    %eax,%edi
+  80243c:	fc                   	cld
+  80243d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80243f:	eb 05                	jmp    802446 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  802441:	89 c7                	mov    %eax,%edi
+  802443:	fc                   	cld
+  802444:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  802446:	5e                   	pop    %esi
+  802447:	5f                   	pop    %edi
+  802448:	5d                   	pop    %ebp
+  802449:	c3                   	ret
+
+0080244a <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80244a:	55                   	push   %ebp
+  80244b:	89 e5                	mov    %esp,%ebp
+  80244d:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  802450:	ff 75 10             	push   0x10(%ebp)
+  802453:	ff 75 0c             	push   0xc(%ebp)
+  802456:	ff 75 08             	push   0x8(%ebp)
+  802459:	e8 8a ff ff ff       	call   8023e8 <memmove>
+}
+  80245e:	c9                   	leave
+  80245f:	c3                   	ret
+
+00802460 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  802460:	55                   	push   %ebp
+  802461:	89 e5                	mov    %esp,%ebp
+  802463:	56                   	push   %esi
+  802464:	53                   	push   %ebx
+  802465:	8b 45 08             	mov    0x8(%ebp),%eax
+  802468:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80246b:	89 c6                	mov    %eax,%esi
+  80246d:	03 75 10             	add    0x10(%ebp),%esi
+  802470:	eb 06                	jmp    802478 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  802472:	83 c0 01             	add    $0x1,%eax
+  802475:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  802478:	39 f0                	cmp    %esi,%eax
+  80247a:	74 14                	je     802490 <memcmp+0x30>
+		if (*s1 != *s2)
+  80247c:	0f b6 08             	movzbl (%eax),%ecx
+  80247f:	0f b6 1a             	movzbl (%edx),%ebx
+  802482:	38 d9                	cmp    %bl,%cl
+  802484:	74 ec                	je     802472 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  802486:	0f b6 c1             	movzbl %cl,%eax
+  802489:	0f b6 db             	movzbl %bl,%ebx
+  80248c:	29 d8                	sub    %ebx,%eax
+  80248e:	eb 05                	jmp    802495 <memcmp+0x35>
+	}
+
+	return 0;
+  802490:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802495:	5b                   	pop    %ebx
+  802496:	5e                   	pop    %esi
+  802497:	5d                   	pop    %ebp
+  802498:	c3                   	ret
+
+00802499 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802499:	55                   	push   %ebp
+  80249a:	89 e5                	mov    %esp,%ebp
+  80249c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80249f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8024a2:	89 c2                	mov    %eax,%edx
+  8024a4:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8024a7:	eb 03                	jmp    8024ac <memfind+0x13>
+  8024a9:	83 c0 01             	add    $0x1,%eax
+  8024ac:	39 d0                	cmp    %edx,%eax
+  8024ae:	73 04                	jae    8024b4 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8024b0:	38 08                	cmp    %cl,(%eax)
+  8024b2:	75 f5                	jne    8024a9 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8024b4:	5d                   	pop    %ebp
+  8024b5:	c3                   	ret
+
+008024b6 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8024b6:	55                   	push   %ebp
+  8024b7:	89 e5                	mov    %esp,%ebp
+  8024b9:	57                   	push   %edi
+  8024ba:	56                   	push   %esi
+  8024bb:	53                   	push   %ebx
+  8024bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024bf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8024c2:	eb 03                	jmp    8024c7 <strtol+0x11>
+		s++;
+  8024c4:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8024c7:	0f b6 02             	movzbl (%edx),%eax
+  8024ca:	3c 20                	cmp    $0x20,%al
+  8024cc:	74 f6                	je     8024c4 <strtol+0xe>
+  8024ce:	3c 09                	cmp    $0x9,%al
+  8024d0:	74 f2                	je     8024c4 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8024d2:	3c 2b                	cmp    $0x2b,%al
+  8024d4:	74 2a                	je     802500 <strtol+0x4a>
+	int neg = 0;
+  8024d6:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8024db:	3c 2d                	cmp    $0x2d,%al
+  8024dd:	74 2b                	je     80250a <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8024df:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8024e5:	75 0f                	jne    8024f6 <strtol+0x40>
+  8024e7:	80 3a 30             	cmpb   $0x30,(%edx)
+  8024ea:	74 28                	je     802514 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8024ec:	85 db                	test   %ebx,%ebx
+  8024ee:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8024f3:	0f 44 d8             	cmove  %eax,%ebx
+  8024f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024fb:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8024fe:	eb 46                	jmp    802546 <strtol+0x90>
+		s++;
+  802500:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  802503:	bf 00 00 00 00       	mov    $0x0,%edi
+  802508:	eb d5                	jmp    8024df <strtol+0x29>
+		s++, neg = 1;
+  80250a:	83 c2 01             	add    $0x1,%edx
+  80250d:	bf 01 00 00 00       	mov    $0x1,%edi
+  802512:	eb cb                	jmp    8024df <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802514:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802518:	74 0e                	je     802528 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  80251a:	85 db                	test   %ebx,%ebx
+  80251c:	75 d8                	jne    8024f6 <strtol+0x40>
+		s++, base = 8;
+  80251e:	83 c2 01             	add    $0x1,%edx
+  802521:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802526:	eb ce                	jmp    8024f6 <strtol+0x40>
+		s += 2, base = 16;
+  802528:	83 c2 02             	add    $0x2,%edx
+  80252b:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802530:	eb c4                	jmp    8024f6 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  802532:	0f be c0             	movsbl %al,%eax
+  802535:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  802538:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80253b:	7d 3a                	jge    802577 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  80253d:	83 c2 01             	add    $0x1,%edx
+  802540:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802544:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  802546:	0f b6 02             	movzbl (%edx),%eax
+  802549:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80254c:	89 f3                	mov    %esi,%ebx
+  80254e:	80 fb 09             	cmp    $0x9,%bl
+  802551:	76 df                	jbe    802532 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  802553:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802556:	89 f3                	mov    %esi,%ebx
+  802558:	80 fb 19             	cmp    $0x19,%bl
+  80255b:	77 08                	ja     802565 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  80255d:	0f be c0             	movsbl %al,%eax
+  802560:	83 e8 57             	sub    $0x57,%eax
+  802563:	eb d3                	jmp    802538 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  802565:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802568:	89 f3                	mov    %esi,%ebx
+  80256a:	80 fb 19             	cmp    $0x19,%bl
+  80256d:	77 08                	ja     802577 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  80256f:	0f be c0             	movsbl %al,%eax
+  802572:	83 e8 37             	sub    $0x37,%eax
+  802575:	eb c1                	jmp    802538 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  802577:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80257b:	74 05                	je     802582 <strtol+0xcc>
+		*endptr = (char *) s;
+  80257d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802580:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  802582:	89 c8                	mov    %ecx,%eax
+  802584:	f7 d8                	neg    %eax
+  802586:	85 ff                	test   %edi,%edi
+  802588:	0f 45 c8             	cmovne %eax,%ecx
+}
+  80258b:	89 c8                	mov    %ecx,%eax
+  80258d:	5b                   	pop    %ebx
+  80258e:	5e                   	pop    %esi
+  80258f:	5f                   	pop    %edi
+  802590:	5d                   	pop    %ebp
+  802591:	c3                   	ret
+
+00802592 <atoi>:
+
+int
+atoi(const char *s)
+{
+  802592:	55                   	push   %ebp
+  802593:	89 e5                	mov    %esp,%ebp
+  802595:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  802598:	6a 0a                	push   $0xa
+  80259a:	6a 00                	push   $0x0
+  80259c:	ff 75 08             	push   0x8(%ebp)
+  80259f:	e8 12 ff ff ff       	call   8024b6 <strtol>
+}
+  8025a4:	c9                   	leave
+  8025a5:	c3                   	ret
+
+008025a6 <dm>:
+  8025a6:	55                   	push   %ebp
+  8025a7:	57                   	push   %edi
+  8025a8:	56                   	push   %esi
+  8025a9:	53                   	push   %ebx
+  8025aa:	83 ec 24             	sub    $0x24,%esp
+  8025ad:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8025b1:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8025b5:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8025b9:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8025bd:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8025c1:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8025c5:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8025c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025d3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025d8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8025df:	00 
+  8025e0:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8025e7:	00 
+  8025e8:	89 fb                	mov    %edi,%ebx
+  8025ea:	eb 08                	jmp    8025f4 <dm+0x4e>
+  8025ec:	83 e9 01             	sub    $0x1,%ecx
+  8025ef:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8025f2:	74 68                	je     80265c <dm+0xb6>
+  8025f4:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8025f8:	01 c0                	add    %eax,%eax
+  8025fa:	89 c6                	mov    %eax,%esi
+  8025fc:	89 d7                	mov    %edx,%edi
+  8025fe:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802602:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802606:	0f ad d0             	shrd   %cl,%edx,%eax
+  802609:	d3 ea                	shr    %cl,%edx
+  80260b:	f6 c1 20             	test   $0x20,%cl
+  80260e:	74 04                	je     802614 <dm+0x6e>
+  802610:	89 d0                	mov    %edx,%eax
+  802612:	31 d2                	xor    %edx,%edx
+  802614:	83 e0 01             	and    $0x1,%eax
+  802617:	89 04 24             	mov    %eax,(%esp)
+  80261a:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802621:	00 
+  802622:	8b 04 24             	mov    (%esp),%eax
+  802625:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802629:	09 f0                	or     %esi,%eax
+  80262b:	09 fa                	or     %edi,%edx
+  80262d:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802631:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802635:	39 f0                	cmp    %esi,%eax
+  802637:	89 d5                	mov    %edx,%ebp
+  802639:	19 fd                	sbb    %edi,%ebp
+  80263b:	72 af                	jb     8025ec <dm+0x46>
+  80263d:	29 f0                	sub    %esi,%eax
+  80263f:	19 fa                	sbb    %edi,%edx
+  802641:	89 cf                	mov    %ecx,%edi
+  802643:	c1 ef 05             	shr    $0x5,%edi
+  802646:	83 e7 01             	and    $0x1,%edi
+  802649:	89 fe                	mov    %edi,%esi
+  80264b:	83 f6 01             	xor    $0x1,%esi
+  80264e:	d3 e6                	shl    %cl,%esi
+  802650:	d3 e7                	shl    %cl,%edi
+  802652:	09 74 24 18          	or     %esi,0x18(%esp)
+  802656:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80265a:	eb 90                	jmp    8025ec <dm+0x46>
+  80265c:	85 db                	test   %ebx,%ebx
+  80265e:	74 05                	je     802665 <dm+0xbf>
+  802660:	89 03                	mov    %eax,(%ebx)
+  802662:	89 53 04             	mov    %edx,0x4(%ebx)
+  802665:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802669:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80266d:	83 c4 24             	add    $0x24,%esp
+  802670:	5b                   	pop    %ebx
+  802671:	5e                   	pop    %esi
+  802672:	5f                   	pop    %edi
+  802673:	5d                   	pop    %ebp
+  802674:	c3                   	ret
+
+00802675 <__udivdi3>:
+  802675:	83 ec 08             	sub    $0x8,%esp
+  802678:	6a 00                	push   $0x0
+  80267a:	ff 74 24 1c          	push   0x1c(%esp)
+  80267e:	ff 74 24 1c          	push   0x1c(%esp)
+  802682:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802686:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80268a:	e8 17 ff ff ff       	call   8025a6 <dm>
+  80268f:	83 c4 14             	add    $0x14,%esp
+  802692:	c3                   	ret
+
+00802693 <__umoddi3>:
+  802693:	83 ec 18             	sub    $0x18,%esp
+  802696:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80269a:	50                   	push   %eax
+  80269b:	ff 74 24 2c          	push   0x2c(%esp)
+  80269f:	ff 74 24 2c          	push   0x2c(%esp)
+  8026a3:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8026a7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8026ab:	e8 f6 fe ff ff       	call   8025a6 <dm>
+  8026b0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8026b4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8026b8:	83 c4 24             	add    $0x24,%esp
+  8026bb:	c3                   	ret
+
+008026bc <__divdi3>:
+  8026bc:	53                   	push   %ebx
+  8026bd:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8026c1:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026c5:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8026c9:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8026cd:	85 d2                	test   %edx,%edx
+  8026cf:	78 15                	js     8026e6 <__divdi3+0x2a>
+  8026d1:	85 db                	test   %ebx,%ebx
+  8026d3:	78 34                	js     802709 <__divdi3+0x4d>
+  8026d5:	83 ec 04             	sub    $0x4,%esp
+  8026d8:	6a 00                	push   $0x0
+  8026da:	53                   	push   %ebx
+  8026db:	51                   	push   %ecx
+  8026dc:	e8 c5 fe ff ff       	call   8025a6 <dm>
+  8026e1:	83 c4 10             	add    $0x10,%esp
+  8026e4:	eb 21                	jmp    802707 <__divdi3+0x4b>
+  8026e6:	f7 d8                	neg    %eax
+  8026e8:	83 d2 00             	adc    $0x0,%edx
+  8026eb:	f7 da                	neg    %edx
+  8026ed:	85 db                	test   %ebx,%ebx
+  8026ef:	78 30                	js     802721 <__divdi3+0x65>
+  8026f1:	83 ec 04             	sub    $0x4,%esp
+  8026f4:	6a 00                	push   $0x0
+  8026f6:	53                   	push   %ebx
+  8026f7:	51                   	push   %ecx
+  8026f8:	e8 a9 fe ff ff       	call   8025a6 <dm>
+  8026fd:	83 c4 10             	add    $0x10,%esp
+  802700:	f7 d8                	neg    %eax
+  802702:	83 d2 00             	adc    $0x0,%edx
+  802705:	f7 da                	neg    %edx
+  802707:	5b                   	pop    %ebx
+  802708:	c3                   	ret
+  802709:	83 ec 04             	sub    $0x4,%esp
+  80270c:	6a 00                	push   $0x0
+  80270e:	f7 d9                	neg    %ecx
+  802710:	83 d3 00             	adc    $0x0,%ebx
+  802713:	f7 db                	neg    %ebx
+  802715:	53                   	push   %ebx
+  802716:	51                   	push   %ecx
+  802717:	e8 8a fe ff ff       	call   8025a6 <dm>
+  80271c:	83 c4 10             	add    $0x10,%esp
+  80271f:	eb df                	jmp    802700 <__divdi3+0x44>
+  802721:	83 ec 04             	sub    $0x4,%esp
+  802724:	6a 00                	push   $0x0
+  802726:	f7 d9                	neg    %ecx
+  802728:	83 d3 00             	adc    $0x0,%ebx
+  80272b:	f7 db                	neg    %ebx
+  80272d:	53                   	push   %ebx
+  80272e:	51                   	push   %ecx
+  80272f:	e8 72 fe ff ff       	call   8025a6 <dm>
+  802734:	83 c4 10             	add    $0x10,%esp
+  802737:	eb ce                	jmp    802707 <__divdi3+0x4b>
+
+00802739 <__moddi3>:
+  802739:	55                   	push   %ebp
+  80273a:	57                   	push   %edi
+  80273b:	56                   	push   %esi
+  80273c:	53                   	push   %ebx
+  80273d:	83 ec 18             	sub    $0x18,%esp
+  802740:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802744:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802748:	89 f1                	mov    %esi,%ecx
+  80274a:	f7 d9                	neg    %ecx
+  80274c:	89 da                	mov    %ebx,%edx
+  80274e:	83 d2 00             	adc    $0x0,%edx
+  802751:	f7 da                	neg    %edx
+  802753:	0f 48 ce             	cmovs  %esi,%ecx
+  802756:	0f 48 d3             	cmovs  %ebx,%edx
+  802759:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80275d:	50                   	push   %eax
+  80275e:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802762:	f7 de                	neg    %esi
+  802764:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802768:	83 d0 00             	adc    $0x0,%eax
+  80276b:	f7 d8                	neg    %eax
+  80276d:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802772:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802777:	50                   	push   %eax
+  802778:	56                   	push   %esi
+  802779:	89 c8                	mov    %ecx,%eax
+  80277b:	e8 26 fe ff ff       	call   8025a6 <dm>
+  802780:	83 c4 10             	add    $0x10,%esp
+  802783:	85 db                	test   %ebx,%ebx
+  802785:	78 10                	js     802797 <__moddi3+0x5e>
+  802787:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80278b:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80278f:	83 c4 14             	add    $0x14,%esp
+  802792:	5b                   	pop    %ebx
+  802793:	5e                   	pop    %esi
+  802794:	5f                   	pop    %edi
+  802795:	5d                   	pop    %ebp
+  802796:	c3                   	ret
+  802797:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80279b:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80279f:	f7 d8                	neg    %eax
+  8027a1:	83 d2 00             	adc    $0x0,%edx
+  8027a4:	f7 da                	neg    %edx
+  8027a6:	eb e7                	jmp    80278f <__moddi3+0x56>
@@ -0,0 +1,6330 @@
+
+obj/user/forkbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 43 03 00 00       	call   800374 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <timed_fork>:
+		sys_yield();
+}
+
+static envid_t
+timed_fork(envid_t (*forkfn)(void))
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+  80003c:	89 c1                	mov    %eax,%ecx
+
+static inline uint64_t
+read_tsc(void)
+{
+	uint64_t tsc;
+	asm volatile("rdtsc" : "=A" (tsc));
+  80003e:	0f 31                	rdtsc
+  800040:	89 c6                	mov    %eax,%esi
+  800042:	89 d7                	mov    %edx,%edi
+	uint64_t start;
+	envid_t envid;
+
+	start = read_tsc();
+	envid = forkfn();
+  800044:	ff d1                	call   *%ecx
+  800046:	89 c1                	mov    %eax,%ecx
+	if (envid < 0)
+  800048:	85 c0                	test   %eax,%eax
+  80004a:	78 4f                	js     80009b <timed_fork+0x68>
+		panic("fork: %e", envid);
+	if (envid > 0) {
+  80004c:	7e 43                	jle    800091 <timed_fork+0x5e>
+  80004e:	0f 31                	rdtsc
+		__sync_fetch_and_add(&res->cycles, read_tsc() - start);
+  800050:	29 f0                	sub    %esi,%eax
+  800052:	19 fa                	sbb    %edi,%edx
+  800054:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800057:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80005a:	a1 00 00 40 00       	mov    0x400000,%eax
+  80005f:	8b 15 04 00 40 00    	mov    0x400004,%edx
+  800065:	89 ce                	mov    %ecx,%esi
+  800067:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80006a:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  80006d:	01 c1                	add    %eax,%ecx
+  80006f:	11 d3                	adc    %edx,%ebx
+  800071:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800074:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800077:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80007a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80007d:	f0 0f c7 0d 00 00 40 	lock cmpxchg8b 0x400000
+  800084:	00 
+  800085:	75 e0                	jne    800067 <timed_fork+0x34>
+		__sync_fetch_and_add(&res->forks, 1);
+  800087:	89 f1                	mov    %esi,%ecx
+  800089:	f0 83 05 08 00 40 00 	lock addl $0x1,0x400008
+  800090:	01 
+	}
+	return envid;
+}
+  800091:	89 c8                	mov    %ecx,%eax
+  800093:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800096:	5b                   	pop    %ebx
+  800097:	5e                   	pop    %esi
+  800098:	5f                   	pop    %edi
+  800099:	5d                   	pop    %ebp
+  80009a:	c3                   	ret
+		panic("fork: %e", envid);
+  80009b:	50                   	push   %eax
+  80009c:	68 40 32 80 00       	push   $0x803240
+  8000a1:	6a 2c                	push   $0x2c
+  8000a3:	68 49 32 80 00       	push   $0x803249
+  8000a8:	e8 3e 06 00 00       	call   8006eb <_panic>
+
+008000ad <wait_env>:
+{
+  8000ad:	55                   	push   %ebp
+  8000ae:	89 e5                	mov    %esp,%ebp
+  8000b0:	56                   	push   %esi
+  8000b1:	53                   	push   %ebx
+  8000b2:	89 c6                	mov    %eax,%esi
+	while (envs[ENVX(envid)].env_id == envid
+  8000b4:	89 c3                	mov    %eax,%ebx
+  8000b6:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8000bc:	69 db 68 01 00 00    	imul   $0x168,%ebx,%ebx
+  8000c2:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8000c8:	eb 05                	jmp    8000cf <wait_env+0x22>
+		sys_yield();
+  8000ca:	e8 65 18 00 00       	call   801934 <sys_yield>
+	while (envs[ENVX(envid)].env_id == envid
+  8000cf:	8b 43 48             	mov    0x48(%ebx),%eax
+	       && envs[ENVX(envid)].env_status != ENV_FREE)
+  8000d2:	39 f0                	cmp    %esi,%eax
+  8000d4:	75 07                	jne    8000dd <wait_env+0x30>
+  8000d6:	8b 43 54             	mov    0x54(%ebx),%eax
+  8000d9:	85 c0                	test   %eax,%eax
+  8000db:	75 ed                	jne    8000ca <wait_env+0x1d>
+}
+  8000dd:	5b                   	pop    %ebx
+  8000de:	5e                   	pop    %esi
+  8000df:	5d                   	pop    %ebp
+  8000e0:	c3                   	ret
+
+008000e1 <bigfork>:
+		wait_env(kids[i]);
+}
+
+static void
+bigfork(envid_t (*forkfn)(void))
+{
+  8000e1:	55                   	push   %ebp
+  8000e2:	89 e5                	mov    %esp,%ebp
+  8000e4:	57                   	push   %edi
+  8000e5:	56                   	push   %esi
+  8000e6:	53                   	push   %ebx
+  8000e7:	83 ec 0c             	sub    $0xc,%esp
+  8000ea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	static char *big;
+	envid_t envid;
+	int i;
+
+	if (!big && !(big = malloc(BIGSIZE)))
+  8000ed:	83 3d 08 40 80 00 00 	cmpl   $0x0,0x804008
+  8000f4:	74 2f                	je     800125 <bigfork+0x44>
+		panic("bigfork: out of memory");
+	for (i = 0; i < BIGSIZE; i += PGSIZE)
+		big[i] = i / PGSIZE;
+  8000f6:	8b 0d 08 40 80 00    	mov    0x804008,%ecx
+  8000fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800101:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  800107:	85 c0                	test   %eax,%eax
+  800109:	0f 49 d0             	cmovns %eax,%edx
+  80010c:	c1 fa 0c             	sar    $0xc,%edx
+  80010f:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+	for (i = 0; i < BIGSIZE; i += PGSIZE)
+  800112:	05 00 10 00 00       	add    $0x1000,%eax
+  800117:	3d 00 00 40 00       	cmp    $0x400000,%eax
+  80011c:	75 e3                	jne    800101 <bigfork+0x20>
+  80011e:	bf 0b 00 00 00       	mov    $0xb,%edi
+  800123:	eb 34                	jmp    800159 <bigfork+0x78>
+	if (!big && !(big = malloc(BIGSIZE)))
+  800125:	83 ec 0c             	sub    $0xc,%esp
+  800128:	68 00 00 40 00       	push   $0x400000
+  80012d:	e8 a7 03 00 00       	call   8004d9 <malloc>
+  800132:	a3 08 40 80 00       	mov    %eax,0x804008
+  800137:	83 c4 10             	add    $0x10,%esp
+  80013a:	85 c0                	test   %eax,%eax
+  80013c:	75 b8                	jne    8000f6 <bigfork+0x15>
+		panic("bigfork: out of memory");
+  80013e:	83 ec 04             	sub    $0x4,%esp
+  800141:	68 5a 32 80 00       	push   $0x80325a
+  800146:	6a 5a                	push   $0x5a
+  800148:	68 49 32 80 00       	push   $0x803249
+  80014d:	e8 99 05 00 00       	call   8006eb <_panic>
+	for (i = 0; i < NBIG; i++) {
+		if ((envid = timed_fork(forkfn)) == 0)
+			exit();
+		wait_env(envid);
+  800152:	89 f0                	mov    %esi,%eax
+  800154:	e8 54 ff ff ff       	call   8000ad <wait_env>
+	for (i = 0; i < NBIG; i++) {
+  800159:	83 ef 01             	sub    $0x1,%edi
+  80015c:	74 14                	je     800172 <bigfork+0x91>
+		if ((envid = timed_fork(forkfn)) == 0)
+  80015e:	89 d8                	mov    %ebx,%eax
+  800160:	e8 ce fe ff ff       	call   800033 <timed_fork>
+  800165:	89 c6                	mov    %eax,%esi
+  800167:	85 c0                	test   %eax,%eax
+  800169:	75 e7                	jne    800152 <bigfork+0x71>
+			exit();
+  80016b:	e8 4d 02 00 00       	call   8003bd <exit>
+  800170:	eb e0                	jmp    800152 <bigfork+0x71>
+	}
+}
+  800172:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800175:	5b                   	pop    %ebx
+  800176:	5e                   	pop    %esi
+  800177:	5f                   	pop    %edi
+  800178:	5d                   	pop    %ebp
+  800179:	c3                   	ret
+
+0080017a <stresssched>:
+{
+  80017a:	55                   	push   %ebp
+  80017b:	89 e5                	mov    %esp,%ebp
+  80017d:	57                   	push   %edi
+  80017e:	56                   	push   %esi
+  80017f:	53                   	push   %ebx
+  800180:	83 ec 5c             	sub    $0x5c,%esp
+	for (i = 0; i < NSTRESS; i++)
+  800183:	8d 75 98             	lea    -0x68(%ebp),%esi
+  800186:	8d 7d e8             	lea    -0x18(%ebp),%edi
+  800189:	89 f3                	mov    %esi,%ebx
+  80018b:	eb 03                	jmp    800190 <stresssched+0x16>
+  80018d:	83 c3 04             	add    $0x4,%ebx
+  800190:	39 fb                	cmp    %edi,%ebx
+  800192:	74 1f                	je     8001b3 <stresssched+0x39>
+		if ((kids[i] = timed_fork(forkfn)) == 0)
+  800194:	8b 45 08             	mov    0x8(%ebp),%eax
+  800197:	e8 97 fe ff ff       	call   800033 <timed_fork>
+  80019c:	89 03                	mov    %eax,(%ebx)
+  80019e:	85 c0                	test   %eax,%eax
+  8001a0:	75 eb                	jne    80018d <stresssched+0x13>
+			exit();
+  8001a2:	e8 16 02 00 00       	call   8003bd <exit>
+  8001a7:	eb e4                	jmp    80018d <stresssched+0x13>
+		wait_env(kids[i]);
+  8001a9:	8b 06                	mov    (%esi),%eax
+  8001ab:	e8 fd fe ff ff       	call   8000ad <wait_env>
+	for (i = 0; i < NSTRESS; i++)
+  8001b0:	83 c6 04             	add    $0x4,%esi
+  8001b3:	39 de                	cmp    %ebx,%esi
+  8001b5:	75 f2                	jne    8001a9 <stresssched+0x2f>
+}
+  8001b7:	83 c4 5c             	add    $0x5c,%esp
+  8001ba:	5b                   	pop    %ebx
+  8001bb:	5e                   	pop    %esi
+  8001bc:	5f                   	pop    %edi
+  8001bd:	5d                   	pop    %ebp
+  8001be:	c3                   	ret
+
+008001bf <forktree>:
+	if (depth == TREE_DEPTH)
+  8001bf:	83 fa 04             	cmp    $0x4,%edx
+  8001c2:	74 5f                	je     800223 <forktree+0x64>
+{
+  8001c4:	55                   	push   %ebp
+  8001c5:	89 e5                	mov    %esp,%ebp
+  8001c7:	57                   	push   %edi
+  8001c8:	56                   	push   %esi
+  8001c9:	53                   	push   %ebx
+  8001ca:	83 ec 1c             	sub    $0x1c,%esp
+  8001cd:	89 c3                	mov    %eax,%ebx
+  8001cf:	89 d6                	mov    %edx,%esi
+		if ((kids[i] = timed_fork(forkfn)) == 0) {
+  8001d1:	e8 5d fe ff ff       	call   800033 <timed_fork>
+  8001d6:	89 c7                	mov    %eax,%edi
+  8001d8:	85 c0                	test   %eax,%eax
+  8001da:	74 25                	je     800201 <forktree+0x42>
+  8001dc:	89 d8                	mov    %ebx,%eax
+  8001de:	e8 50 fe ff ff       	call   800033 <timed_fork>
+  8001e3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8001e6:	85 c0                	test   %eax,%eax
+  8001e8:	74 28                	je     800212 <forktree+0x53>
+		wait_env(kids[i]);
+  8001ea:	89 f8                	mov    %edi,%eax
+  8001ec:	e8 bc fe ff ff       	call   8000ad <wait_env>
+  8001f1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8001f4:	e8 b4 fe ff ff       	call   8000ad <wait_env>
+}
+  8001f9:	83 c4 1c             	add    $0x1c,%esp
+  8001fc:	5b                   	pop    %ebx
+  8001fd:	5e                   	pop    %esi
+  8001fe:	5f                   	pop    %edi
+  8001ff:	5d                   	pop    %ebp
+  800200:	c3                   	ret
+			forktree(forkfn, depth + 1);
+  800201:	8d 56 01             	lea    0x1(%esi),%edx
+  800204:	89 d8                	mov    %ebx,%eax
+  800206:	e8 b4 ff ff ff       	call   8001bf <forktree>
+			exit();
+  80020b:	e8 ad 01 00 00       	call   8003bd <exit>
+  800210:	eb ca                	jmp    8001dc <forktree+0x1d>
+			forktree(forkfn, depth + 1);
+  800212:	8d 56 01             	lea    0x1(%esi),%edx
+  800215:	89 d8                	mov    %ebx,%eax
+  800217:	e8 a3 ff ff ff       	call   8001bf <forktree>
+			exit();
+  80021c:	e8 9c 01 00 00       	call   8003bd <exit>
+  800221:	eb c7                	jmp    8001ea <forktree+0x2b>
+  800223:	c3                   	ret
+
+00800224 <forktree_top>:
+	}
+}
+
+static void
+forktree_top(envid_t (*forkfn)(void))
+{
+  800224:	55                   	push   %ebp
+  800225:	89 e5                	mov    %esp,%ebp
+  800227:	83 ec 08             	sub    $0x8,%esp
+	forktree(forkfn, 0);
+  80022a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80022f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800232:	e8 88 ff ff ff       	call   8001bf <forktree>
+}
+  800237:	c9                   	leave
+  800238:	c3                   	ret
+
+00800239 <run>:
+{
+  800239:	55                   	push   %ebp
+  80023a:	89 e5                	mov    %esp,%ebp
+  80023c:	57                   	push   %edi
+  80023d:	56                   	push   %esi
+  80023e:	53                   	push   %ebx
+  80023f:	83 ec 10             	sub    $0x10,%esp
+  800242:	89 c3                	mov    %eax,%ebx
+  800244:	89 d6                	mov    %edx,%esi
+		memset(res, 0, sizeof(*res));
+  800246:	6a 0c                	push   $0xc
+  800248:	6a 00                	push   $0x0
+  80024a:	68 00 00 40 00       	push   $0x400000
+  80024f:	e8 ea 0c 00 00       	call   800f3e <memset>
+		workload(impls[i].fn);
+  800254:	c7 04 24 1c 2d 80 00 	movl   $0x802d1c,(%esp)
+  80025b:	ff d6                	call   *%esi
+			res->forks ? res->cycles / res->forks : 0);
+  80025d:	8b 3d 08 00 40 00    	mov    0x400008,%edi
+		cprintf("%-12s %-6s %3d forks %10llu cycles/fork\n",
+  800263:	83 c4 10             	add    $0x10,%esp
+  800266:	b8 00 00 00 00       	mov    $0x0,%eax
+  80026b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800270:	85 ff                	test   %edi,%edi
+  800272:	74 1b                	je     80028f <run+0x56>
+			res->forks ? res->cycles / res->forks : 0);
+  800274:	ba 00 00 00 00       	mov    $0x0,%edx
+		cprintf("%-12s %-6s %3d forks %10llu cycles/fork\n",
+  800279:	52                   	push   %edx
+  80027a:	57                   	push   %edi
+  80027b:	ff 35 04 00 40 00    	push   0x400004
+  800281:	ff 35 00 00 40 00    	push   0x400000
+  800287:	e8 77 2e 00 00       	call   803103 <__udivdi3>
+  80028c:	83 c4 10             	add    $0x10,%esp
+  80028f:	83 ec 08             	sub    $0x8,%esp
+  800292:	52                   	push   %edx
+  800293:	50                   	push   %eax
+  800294:	57                   	push   %edi
+  800295:	68 71 32 80 00       	push   $0x803271
+  80029a:	53                   	push   %ebx
+  80029b:	68 a8 32 80 00       	push   $0x8032a8
+  8002a0:	e8 5a 05 00 00       	call   8007ff <cprintf>
+		memset(res, 0, sizeof(*res));
+  8002a5:	83 c4 1c             	add    $0x1c,%esp
+  8002a8:	6a 0c                	push   $0xc
+  8002aa:	6a 00                	push   $0x0
+  8002ac:	68 00 00 40 00       	push   $0x400000
+  8002b1:	e8 88 0c 00 00       	call   800f3e <memset>
+		workload(impls[i].fn);
+  8002b6:	c7 04 24 54 2f 80 00 	movl   $0x802f54,(%esp)
+  8002bd:	ff d6                	call   *%esi
+			res->forks ? res->cycles / res->forks : 0);
+  8002bf:	8b 35 08 00 40 00    	mov    0x400008,%esi
+		cprintf("%-12s %-6s %3d forks %10llu cycles/fork\n",
+  8002c5:	83 c4 10             	add    $0x10,%esp
+  8002c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002d2:	85 f6                	test   %esi,%esi
+  8002d4:	74 1b                	je     8002f1 <run+0xb8>
+			res->forks ? res->cycles / res->forks : 0);
+  8002d6:	ba 00 00 00 00       	mov    $0x0,%edx
+		cprintf("%-12s %-6s %3d forks %10llu cycles/fork\n",
+  8002db:	52                   	push   %edx
+  8002dc:	56                   	push   %esi
+  8002dd:	ff 35 04 00 40 00    	push   0x400004
+  8002e3:	ff 35 00 00 40 00    	push   0x400000
+  8002e9:	e8 15 2e 00 00       	call   803103 <__udivdi3>
+  8002ee:	83 c4 10             	add    $0x10,%esp
+  8002f1:	83 ec 08             	sub    $0x8,%esp
+  8002f4:	52                   	push   %edx
+  8002f5:	50                   	push   %eax
+  8002f6:	56                   	push   %esi
+  8002f7:	68 a2 32 80 00       	push   $0x8032a2
+  8002fc:	53                   	push   %ebx
+  8002fd:	68 a8 32 80 00       	push   $0x8032a8
+  800302:	e8 f8 04 00 00       	call   8007ff <cprintf>
+}
+  800307:	83 c4 20             	add    $0x20,%esp
+  80030a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80030d:	5b                   	pop    %ebx
+  80030e:	5e                   	pop    %esi
+  80030f:	5f                   	pop    %edi
+  800310:	5d                   	pop    %ebp
+  800311:	c3                   	ret
+
+00800312 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800312:	55                   	push   %ebp
+  800313:	89 e5                	mov    %esp,%ebp
+  800315:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+
+	if ((r = sys_page_alloc(0, res, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  800318:	68 07 04 00 00       	push   $0x407
+  80031d:	68 00 00 40 00       	push   $0x400000
+  800322:	6a 00                	push   $0x0
+  800324:	e8 f9 12 00 00       	call   801622 <sys_page_alloc>
+  800329:	83 c4 10             	add    $0x10,%esp
+  80032c:	85 c0                	test   %eax,%eax
+  80032e:	78 2f                	js     80035f <umain+0x4d>
+		panic("sys_page_alloc: %e", r);
+
+	run("forktree", forktree_top);
+  800330:	ba 24 02 80 00       	mov    $0x800224,%edx
+  800335:	b8 8a 32 80 00       	mov    $0x80328a,%eax
+  80033a:	e8 fa fe ff ff       	call   800239 <run>
+	run("stresssched", stresssched);
+  80033f:	ba 7a 01 80 00       	mov    $0x80017a,%edx
+  800344:	b8 93 32 80 00       	mov    $0x803293,%eax
+  800349:	e8 eb fe ff ff       	call   800239 <run>
+	run("bigfork", bigfork);
+  80034e:	ba e1 00 80 00       	mov    $0x8000e1,%edx
+  800353:	b8 9f 32 80 00       	mov    $0x80329f,%eax
+  800358:	e8 dc fe ff ff       	call   800239 <run>
+}
+  80035d:	c9                   	leave
+  80035e:	c3                   	ret
+		panic("sys_page_alloc: %e", r);
+  80035f:	50                   	push   %eax
+  800360:	68 77 32 80 00       	push   $0x803277
+  800365:	68 85 00 00 00       	push   $0x85
+  80036a:	68 49 32 80 00       	push   $0x803249
+  80036f:	e8 77 03 00 00       	call   8006eb <_panic>
+
+00800374 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800374:	55                   	push   %ebp
+  800375:	89 e5                	mov    %esp,%ebp
+  800377:	56                   	push   %esi
+  800378:	53                   	push   %ebx
+  800379:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80037c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  80037f:	e8 ff 11 00 00       	call   801583 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  800384:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800389:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  80038f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800394:	a3 0c 40 80 00       	mov    %eax,0x80400c
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800399:	85 db                	test   %ebx,%ebx
+  80039b:	7e 07                	jle    8003a4 <libmain+0x30>
+		binaryname = argv[0];
+  80039d:	8b 06                	mov    (%esi),%eax
+  80039f:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8003a4:	83 ec 08             	sub    $0x8,%esp
+  8003a7:	56                   	push   %esi
+  8003a8:	53                   	push   %ebx
+  8003a9:	e8 64 ff ff ff       	call   800312 <umain>
+
+	// exit gracefully
+	exit();
+  8003ae:	e8 0a 00 00 00       	call   8003bd <exit>
+}
+  8003b3:	83 c4 10             	add    $0x10,%esp
+  8003b6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8003b9:	5b                   	pop    %ebx
+  8003ba:	5e                   	pop    %esi
+  8003bb:	5d                   	pop    %ebp
+  8003bc:	c3                   	ret
+
+008003bd <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8003bd:	55                   	push   %ebp
+  8003be:	89 e5                	mov    %esp,%ebp
+  8003c0:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  8003c3:	6a 00                	push   $0x0
+  8003c5:	e8 f7 10 00 00       	call   8014c1 <sys_env_destroy>
+}
+  8003ca:	83 c4 10             	add    $0x10,%esp
+  8003cd:	c9                   	leave
+  8003ce:	c3                   	ret
+
+008003cf <ismapped>:
+static uint8_t *mptr;
+
+static int
+ismapped(uintptr_t va)
+{
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  8003cf:	89 c2                	mov    %eax,%edx
+  8003d1:	c1 ea 16             	shr    $0x16,%edx
+  8003d4:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8003db:	f6 c2 01             	test   $0x1,%dl
+  8003de:	74 0e                	je     8003ee <ismapped+0x1f>
+  8003e0:	c1 e8 0c             	shr    $0xc,%eax
+  8003e3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8003ea:	83 e0 01             	and    $0x1,%eax
+  8003ed:	c3                   	ret
+  8003ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003f3:	c3                   	ret
+
+008003f4 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  8003f4:	55                   	push   %ebp
+  8003f5:	89 e5                	mov    %esp,%ebp
+  8003f7:	56                   	push   %esi
+  8003f8:	53                   	push   %ebx
+  8003f9:	83 ec 10             	sub    $0x10,%esp
+  8003fc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint8_t *c;
+	uint32_t *ref;
+	struct page_range range;
+
+	if (v == 0)
+  8003ff:	85 db                	test   %ebx,%ebx
+  800401:	0f 84 a7 00 00 00    	je     8004ae <free+0xba>
+		return;
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  800407:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  80040d:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  800412:	77 65                	ja     800479 <free+0x85>
+
+	c = ROUNDDOWN(v, PGSIZE);
+  800414:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+
+	range.pr_va = c;
+  80041a:	89 5d e8             	mov    %ebx,-0x18(%ebp)
+	range.pr_npages = 0;
+  80041d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  800424:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800429:	b8 00 00 00 00       	mov    $0x0,%eax
+  80042e:	be 01 00 00 00       	mov    $0x1,%esi
+  800433:	89 da                	mov    %ebx,%edx
+  800435:	c1 ea 0c             	shr    $0xc,%edx
+  800438:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80043f:	f6 c6 02             	test   $0x2,%dh
+  800442:	74 4e                	je     800492 <free+0x9e>
+		range.pr_npages++;
+  800444:	83 c0 01             	add    $0x1,%eax
+		c += PGSIZE;
+  800447:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  80044d:	89 f1                	mov    %esi,%ecx
+  80044f:	8d 93 00 00 00 f8    	lea    -0x8000000(%ebx),%edx
+  800455:	81 fa ff ff ff 07    	cmp    $0x7ffffff,%edx
+  80045b:	76 d6                	jbe    800433 <free+0x3f>
+  80045d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800460:	68 2c 33 80 00       	push   $0x80332c
+  800465:	68 0a 33 80 00       	push   $0x80330a
+  80046a:	68 a5 00 00 00       	push   $0xa5
+  80046f:	68 1f 33 80 00       	push   $0x80331f
+  800474:	e8 72 02 00 00       	call   8006eb <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  800479:	68 dc 32 80 00       	push   $0x8032dc
+  80047e:	68 0a 33 80 00       	push   $0x80330a
+  800483:	68 9c 00 00 00       	push   $0x9c
+  800488:	68 1f 33 80 00       	push   $0x80331f
+  80048d:	e8 59 02 00 00       	call   8006eb <_panic>
+  800492:	84 c9                	test   %cl,%cl
+  800494:	74 07                	je     80049d <free+0xa9>
+  800496:	89 45 ec             	mov    %eax,-0x14(%ebp)
+	}
+	if (range.pr_npages)
+  800499:	85 c0                	test   %eax,%eax
+  80049b:	75 18                	jne    8004b5 <free+0xc1>
+	/*
+	 * c is just a piece of this page, so dec the ref count
+	 * and maybe free the page.
+	 */
+	ref = (uint32_t*) (c + PGSIZE - 4);
+	if (--(*ref) == 0)
+  80049d:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  8004a3:	83 e8 01             	sub    $0x1,%eax
+  8004a6:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  8004ac:	74 1b                	je     8004c9 <free+0xd5>
+		sys_page_unmap(0, c);
+}
+  8004ae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8004b1:	5b                   	pop    %ebx
+  8004b2:	5e                   	pop    %esi
+  8004b3:	5d                   	pop    %ebp
+  8004b4:	c3                   	ret
+		sys_page_unmap_vec(0, &range, 1, 0);
+  8004b5:	6a 00                	push   $0x0
+  8004b7:	6a 01                	push   $0x1
+  8004b9:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  8004bc:	50                   	push   %eax
+  8004bd:	6a 00                	push   $0x0
+  8004bf:	e8 0f 1e 00 00       	call   8022d3 <sys_page_unmap_vec>
+  8004c4:	83 c4 10             	add    $0x10,%esp
+  8004c7:	eb d4                	jmp    80049d <free+0xa9>
+		sys_page_unmap(0, c);
+  8004c9:	83 ec 08             	sub    $0x8,%esp
+  8004cc:	53                   	push   %ebx
+  8004cd:	6a 00                	push   $0x0
+  8004cf:	e8 d8 12 00 00       	call   8017ac <sys_page_unmap>
+  8004d4:	83 c4 10             	add    $0x10,%esp
+  8004d7:	eb d5                	jmp    8004ae <free+0xba>
+
+008004d9 <malloc>:
+{
+  8004d9:	55                   	push   %ebp
+  8004da:	89 e5                	mov    %esp,%ebp
+  8004dc:	57                   	push   %edi
+  8004dd:	56                   	push   %esi
+  8004de:	53                   	push   %ebx
+  8004df:	83 ec 5c             	sub    $0x5c,%esp
+	if (mptr == 0)
+  8004e2:	a1 10 40 80 00       	mov    0x804010,%eax
+  8004e7:	85 c0                	test   %eax,%eax
+  8004e9:	74 5d                	je     800548 <malloc+0x6f>
+	n = ROUNDUP(n, 4);
+  8004eb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8004ee:	8d 71 03             	lea    0x3(%ecx),%esi
+  8004f1:	89 f7                	mov    %esi,%edi
+  8004f3:	83 e7 fc             	and    $0xfffffffc,%edi
+	if (n >= MAXMALLOC)
+  8004f6:	81 ff ff ff 0f 00    	cmp    $0xfffff,%edi
+  8004fc:	0f 87 d5 01 00 00    	ja     8006d7 <malloc+0x1fe>
+	if ((uintptr_t) mptr % PGSIZE){
+  800502:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  800507:	74 30                	je     800539 <malloc+0x60>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  800509:	89 c3                	mov    %eax,%ebx
+  80050b:	c1 eb 0c             	shr    $0xc,%ebx
+  80050e:	8d 54 38 03          	lea    0x3(%eax,%edi,1),%edx
+  800512:	c1 ea 0c             	shr    $0xc,%edx
+  800515:	39 d3                	cmp    %edx,%ebx
+  800517:	74 51                	je     80056a <malloc+0x91>
+		free(mptr);	/* drop reference to this page */
+  800519:	83 ec 0c             	sub    $0xc,%esp
+  80051c:	50                   	push   %eax
+  80051d:	e8 d2 fe ff ff       	call   8003f4 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  800522:	a1 10 40 80 00       	mov    0x804010,%eax
+  800527:	05 00 10 00 00       	add    $0x1000,%eax
+  80052c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800531:	a3 10 40 80 00       	mov    %eax,0x804010
+  800536:	83 c4 10             	add    $0x10,%esp
+{
+  800539:	c7 45 a0 02 00 00 00 	movl   $0x2,-0x60(%ebp)
+	    || sys_vm_ranges(0, (void*) va, &r, 1) <= 0)
+  800540:	89 75 a4             	mov    %esi,-0x5c(%ebp)
+  800543:	e9 8c 00 00 00       	jmp    8005d4 <malloc+0xfb>
+		mptr = mbegin;
+  800548:	c7 05 10 40 80 00 00 	movl   $0x8000000,0x804010
+  80054f:	00 00 08 
+	n = ROUNDUP(n, 4);
+  800552:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800555:	8d 71 03             	lea    0x3(%ecx),%esi
+  800558:	89 f7                	mov    %esi,%edi
+  80055a:	83 e7 fc             	and    $0xfffffffc,%edi
+	if (n >= MAXMALLOC)
+  80055d:	81 ff ff ff 0f 00    	cmp    $0xfffff,%edi
+  800563:	76 d4                	jbe    800539 <malloc+0x60>
+  800565:	e9 ed 00 00 00       	jmp    800657 <malloc+0x17e>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  80056a:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  800570:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+			(*ref)++;
+  800576:	83 42 fc 01          	addl   $0x1,-0x4(%edx)
+			mptr += n;
+  80057a:	01 c7                	add    %eax,%edi
+  80057c:	89 3d 10 40 80 00    	mov    %edi,0x804010
+			return v;
+  800582:	e9 d0 00 00 00       	jmp    800657 <malloc+0x17e>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE) {
+  800587:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80058d:	39 f3                	cmp    %esi,%ebx
+  80058f:	73 4f                	jae    8005e0 <malloc+0x107>
+		if (va >= (uintptr_t) mend)
+  800591:	81 fb ff ff ff 0f    	cmp    $0xfffffff,%ebx
+  800597:	0f 87 44 01 00 00    	ja     8006e1 <malloc+0x208>
+		if (ismapped(va))
+  80059d:	89 d8                	mov    %ebx,%eax
+  80059f:	e8 2b fe ff ff       	call   8003cf <ismapped>
+  8005a4:	85 c0                	test   %eax,%eax
+  8005a6:	74 df                	je     800587 <malloc+0xae>
+	va += PGSIZE;
+  8005a8:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+	if (va >= (uintptr_t) mend || !ismapped(va)
+  8005ae:	81 fb ff ff ff 0f    	cmp    $0xfffffff,%ebx
+  8005b4:	0f 86 a5 00 00 00    	jbe    80065f <malloc+0x186>
+		if (!(next = next_free(mptr, n + 4)))
+  8005ba:	85 db                	test   %ebx,%ebx
+  8005bc:	0f 84 ee 00 00 00    	je     8006b0 <malloc+0x1d7>
+		mptr = next;
+  8005c2:	89 1d 10 40 80 00    	mov    %ebx,0x804010
+		if (mptr >= mend) {
+  8005c8:	81 fb ff ff ff 0f    	cmp    $0xfffffff,%ebx
+  8005ce:	0f 87 c1 00 00 00    	ja     800695 <malloc+0x1bc>
+	uintptr_t va, end_va = (uintptr_t) v + n;
+  8005d4:	8b 1d 10 40 80 00    	mov    0x804010,%ebx
+  8005da:	8d 74 1f 04          	lea    0x4(%edi,%ebx,1),%esi
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE) {
+  8005de:	eb ad                	jmp    80058d <malloc+0xb4>
+  8005e0:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+	npages = ROUNDUP(n + 4, PGSIZE) / PGSIZE;
+  8005e3:	8d 9f 03 10 00 00    	lea    0x1003(%edi),%ebx
+  8005e9:	c1 eb 0c             	shr    $0xc,%ebx
+	vec[0].pr_va = mptr;
+  8005ec:	a1 10 40 80 00       	mov    0x804010,%eax
+  8005f1:	89 45 c8             	mov    %eax,-0x38(%ebp)
+	vec[0].pr_npages = npages - 1;
+  8005f4:	8d 53 ff             	lea    -0x1(%ebx),%edx
+  8005f7:	89 55 cc             	mov    %edx,-0x34(%ebp)
+	vec[0].pr_perm = PTE_P|PTE_U|PTE_W|PTE_CONTINUED|PAGE_ZERO_FILL;
+  8005fa:	c7 45 d0 07 12 00 00 	movl   $0x1207,-0x30(%ebp)
+	vec[1].pr_va = mptr + (npages - 1) * PGSIZE;
+  800601:	c1 e2 0c             	shl    $0xc,%edx
+  800604:	01 d0                	add    %edx,%eax
+  800606:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	vec[1].pr_npages = 1;
+  800609:	c7 45 dc 01 00 00 00 	movl   $0x1,-0x24(%ebp)
+	vec[1].pr_perm = PTE_P|PTE_U|PTE_W|PAGE_ZERO_FILL;
+  800610:	c7 45 e0 07 10 00 00 	movl   $0x1007,-0x20(%ebp)
+	if (sys_page_alloc_vec(0, vec, 2, &done) < 0) {
+  800617:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+  80061a:	50                   	push   %eax
+  80061b:	6a 02                	push   $0x2
+  80061d:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  800620:	50                   	push   %eax
+  800621:	6a 00                	push   $0x0
+  800623:	e8 67 1c 00 00       	call   80228f <sys_page_alloc_vec>
+  800628:	83 c4 10             	add    $0x10,%esp
+  80062b:	85 c0                	test   %eax,%eax
+  80062d:	0f 88 85 00 00 00    	js     8006b8 <malloc+0x1df>
+	ref = (uint32_t*) (mptr + i - 4);
+  800633:	a1 10 40 80 00       	mov    0x804010,%eax
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  800638:	c1 e3 0c             	shl    $0xc,%ebx
+  80063b:	c7 44 18 fc 02 00 00 	movl   $0x2,-0x4(%eax,%ebx,1)
+  800642:	00 
+	mptr += n;
+  800643:	01 c7                	add    %eax,%edi
+  800645:	8d 57 04             	lea    0x4(%edi),%edx
+  800648:	f7 c6 fc 0f 00 00    	test   $0xffc,%esi
+  80064e:	0f 45 d7             	cmovne %edi,%edx
+  800651:	89 15 10 40 80 00    	mov    %edx,0x804010
+}
+  800657:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80065a:	5b                   	pop    %ebx
+  80065b:	5e                   	pop    %esi
+  80065c:	5f                   	pop    %edi
+  80065d:	5d                   	pop    %ebp
+  80065e:	c3                   	ret
+	if (va >= (uintptr_t) mend || !ismapped(va)
+  80065f:	89 d8                	mov    %ebx,%eax
+  800661:	e8 69 fd ff ff       	call   8003cf <ismapped>
+  800666:	85 c0                	test   %eax,%eax
+  800668:	0f 84 4c ff ff ff    	je     8005ba <malloc+0xe1>
+	    || sys_vm_ranges(0, (void*) va, &r, 1) <= 0)
+  80066e:	6a 01                	push   $0x1
+  800670:	8d 45 b4             	lea    -0x4c(%ebp),%eax
+  800673:	50                   	push   %eax
+  800674:	53                   	push   %ebx
+  800675:	6a 00                	push   $0x0
+  800677:	e8 7a 1c 00 00       	call   8022f6 <sys_vm_ranges>
+  80067c:	83 c4 10             	add    $0x10,%esp
+  80067f:	85 c0                	test   %eax,%eax
+  800681:	0f 8e 33 ff ff ff    	jle    8005ba <malloc+0xe1>
+	return (uint8_t*) r.pr_va + r.pr_npages * PGSIZE;
+  800687:	8b 5d b8             	mov    -0x48(%ebp),%ebx
+  80068a:	c1 e3 0c             	shl    $0xc,%ebx
+  80068d:	03 5d b4             	add    -0x4c(%ebp),%ebx
+  800690:	e9 25 ff ff ff       	jmp    8005ba <malloc+0xe1>
+			mptr = mbegin;
+  800695:	c7 05 10 40 80 00 00 	movl   $0x8000000,0x804010
+  80069c:	00 00 08 
+			if (++nwrap == 2)
+  80069f:	83 6d a0 01          	subl   $0x1,-0x60(%ebp)
+  8006a3:	0f 85 2b ff ff ff    	jne    8005d4 <malloc+0xfb>
+				return 0;	/* out of address space */
+  8006a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ae:	eb a7                	jmp    800657 <malloc+0x17e>
+  8006b0:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  8006b3:	e9 2b ff ff ff       	jmp    8005e3 <malloc+0x10a>
+		vec[0].pr_npages = done;
+  8006b8:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8006bb:	89 45 cc             	mov    %eax,-0x34(%ebp)
+		sys_page_unmap_vec(0, vec, 1, 0);
+  8006be:	6a 00                	push   $0x0
+  8006c0:	6a 01                	push   $0x1
+  8006c2:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  8006c5:	50                   	push   %eax
+  8006c6:	6a 00                	push   $0x0
+  8006c8:	e8 06 1c 00 00       	call   8022d3 <sys_page_unmap_vec>
+		return 0;	/* out of physical memory */
+  8006cd:	83 c4 10             	add    $0x10,%esp
+  8006d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d5:	eb 80                	jmp    800657 <malloc+0x17e>
+		return 0;
+  8006d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006dc:	e9 76 ff ff ff       	jmp    800657 <malloc+0x17e>
+			return mend;
+  8006e1:	bb 00 00 00 10       	mov    $0x10000000,%ebx
+  8006e6:	e9 d7 fe ff ff       	jmp    8005c2 <malloc+0xe9>
+
+008006eb <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8006eb:	55                   	push   %ebp
+  8006ec:	89 e5                	mov    %esp,%ebp
+  8006ee:	57                   	push   %edi
+  8006ef:	56                   	push   %esi
+  8006f0:	53                   	push   %ebx
+  8006f1:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  8006f7:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  8006fa:	8b 1d 00 40 80 00    	mov    0x804000,%ebx
+  800700:	e8 7e 0e 00 00       	call   801583 <sys_getenvid>
+  800705:	83 ec 04             	sub    $0x4,%esp
+  800708:	ff 75 0c             	push   0xc(%ebp)
+  80070b:	ff 75 08             	push   0x8(%ebp)
+  80070e:	53                   	push   %ebx
+  80070f:	50                   	push   %eax
+  800710:	68 44 33 80 00       	push   $0x803344
+  800715:	68 00 01 00 00       	push   $0x100
+  80071a:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  800720:	56                   	push   %esi
+  800721:	e8 72 06 00 00       	call   800d98 <snprintf>
+  800726:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  800728:	83 c4 20             	add    $0x20,%esp
+  80072b:	57                   	push   %edi
+  80072c:	ff 75 10             	push   0x10(%ebp)
+  80072f:	bf 00 01 00 00       	mov    $0x100,%edi
+  800734:	89 f8                	mov    %edi,%eax
+  800736:	29 d8                	sub    %ebx,%eax
+  800738:	50                   	push   %eax
+  800739:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  80073c:	50                   	push   %eax
+  80073d:	e8 08 06 00 00       	call   800d4a <vsnprintf>
+  800742:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  800744:	83 c4 0c             	add    $0xc,%esp
+  800747:	68 67 33 80 00       	push   $0x803367
+  80074c:	29 df                	sub    %ebx,%edi
+  80074e:	57                   	push   %edi
+  80074f:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  800752:	50                   	push   %eax
+  800753:	e8 40 06 00 00       	call   800d98 <snprintf>
+	sys_cputs(buf, r);
+  800758:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  80075b:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  80075d:	53                   	push   %ebx
+  80075e:	56                   	push   %esi
+  80075f:	e8 21 0c 00 00       	call   801385 <sys_cputs>
+  800764:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800767:	cc                   	int3
+	while (1)
+  800768:	eb fd                	jmp    800767 <_panic+0x7c>
+
+0080076a <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80076a:	55                   	push   %ebp
+  80076b:	89 e5                	mov    %esp,%ebp
+  80076d:	53                   	push   %ebx
+  80076e:	83 ec 04             	sub    $0x4,%esp
+  800771:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800774:	8b 13                	mov    (%ebx),%edx
+  800776:	8d 42 01             	lea    0x1(%edx),%eax
+  800779:	89 03                	mov    %eax,(%ebx)
+  80077b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80077e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800782:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800787:	74 09                	je     800792 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800789:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80078d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800790:	c9                   	leave
+  800791:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800792:	83 ec 08             	sub    $0x8,%esp
+  800795:	68 ff 00 00 00       	push   $0xff
+  80079a:	8d 43 08             	lea    0x8(%ebx),%eax
+  80079d:	50                   	push   %eax
+  80079e:	e8 e2 0b 00 00       	call   801385 <sys_cputs>
+		b->idx = 0;
+  8007a3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8007a9:	83 c4 10             	add    $0x10,%esp
+  8007ac:	eb db                	jmp    800789 <putch+0x1f>
+
+008007ae <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8007ae:	55                   	push   %ebp
+  8007af:	89 e5                	mov    %esp,%ebp
+  8007b1:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8007b7:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8007be:	00 00 00 
+	b.cnt = 0;
+  8007c1:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8007c8:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8007cb:	ff 75 0c             	push   0xc(%ebp)
+  8007ce:	ff 75 08             	push   0x8(%ebp)
+  8007d1:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8007d7:	50                   	push   %eax
+  8007d8:	68 6a 07 80 00       	push   $0x80076a
+  8007dd:	e8 14 01 00 00       	call   8008f6 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8007e2:	83 c4 08             	add    $0x8,%esp
+  8007e5:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8007eb:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8007f1:	50                   	push   %eax
+  8007f2:	e8 8e 0b 00 00       	call   801385 <sys_cputs>
+
+	return b.cnt;
+}
+  8007f7:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8007fd:	c9                   	leave
+  8007fe:	c3                   	ret
+
+008007ff <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8007ff:	55                   	push   %ebp
+  800800:	89 e5                	mov    %esp,%ebp
+  800802:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800805:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800808:	50                   	push   %eax
+  800809:	ff 75 08             	push   0x8(%ebp)
+  80080c:	e8 9d ff ff ff       	call   8007ae <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800811:	c9                   	leave
+  800812:	c3                   	ret
+
+00800813 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800813:	55                   	push   %ebp
+  800814:	89 e5                	mov    %esp,%ebp
+  800816:	57                   	push   %edi
+  800817:	56                   	push   %esi
+  800818:	53                   	push   %ebx
+  800819:	83 ec 1c             	sub    $0x1c,%esp
+  80081c:	89 c7                	mov    %eax,%edi
+  80081e:	89 d6                	mov    %edx,%esi
+  800820:	8b 45 08             	mov    0x8(%ebp),%eax
+  800823:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800826:	89 d1                	mov    %edx,%ecx
+  800828:	89 c2                	mov    %eax,%edx
+  80082a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80082d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800830:	8b 45 10             	mov    0x10(%ebp),%eax
+  800833:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800836:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800839:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800840:	39 c2                	cmp    %eax,%edx
+  800842:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800845:	72 3e                	jb     800885 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800847:	83 ec 0c             	sub    $0xc,%esp
+  80084a:	ff 75 18             	push   0x18(%ebp)
+  80084d:	83 eb 01             	sub    $0x1,%ebx
+  800850:	53                   	push   %ebx
+  800851:	50                   	push   %eax
+  800852:	83 ec 08             	sub    $0x8,%esp
+  800855:	ff 75 e4             	push   -0x1c(%ebp)
+  800858:	ff 75 e0             	push   -0x20(%ebp)
+  80085b:	ff 75 dc             	push   -0x24(%ebp)
+  80085e:	ff 75 d8             	push   -0x28(%ebp)
+  800861:	e8 9d 28 00 00       	call   803103 <__udivdi3>
+  800866:	83 c4 18             	add    $0x18,%esp
+  800869:	52                   	push   %edx
+  80086a:	50                   	push   %eax
+  80086b:	89 f2                	mov    %esi,%edx
+  80086d:	89 f8                	mov    %edi,%eax
+  80086f:	e8 9f ff ff ff       	call   800813 <printnum>
+  800874:	83 c4 20             	add    $0x20,%esp
+  800877:	eb 13                	jmp    80088c <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800879:	83 ec 08             	sub    $0x8,%esp
+  80087c:	56                   	push   %esi
+  80087d:	ff 75 18             	push   0x18(%ebp)
+  800880:	ff d7                	call   *%edi
+  800882:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800885:	83 eb 01             	sub    $0x1,%ebx
+  800888:	85 db                	test   %ebx,%ebx
+  80088a:	7f ed                	jg     800879 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80088c:	83 ec 08             	sub    $0x8,%esp
+  80088f:	56                   	push   %esi
+  800890:	83 ec 04             	sub    $0x4,%esp
+  800893:	ff 75 e4             	push   -0x1c(%ebp)
+  800896:	ff 75 e0             	push   -0x20(%ebp)
+  800899:	ff 75 dc             	push   -0x24(%ebp)
+  80089c:	ff 75 d8             	push   -0x28(%ebp)
+  80089f:	e8 7d 28 00 00       	call   803121 <__umoddi3>
+  8008a4:	83 c4 14             	add    $0x14,%esp
+  8008a7:	0f be 80 69 33 80 00 	movsbl 0x803369(%eax),%eax
+  8008ae:	50                   	push   %eax
+  8008af:	ff d7                	call   *%edi
+}
+  8008b1:	83 c4 10             	add    $0x10,%esp
+  8008b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008b7:	5b                   	pop    %ebx
+  8008b8:	5e                   	pop    %esi
+  8008b9:	5f                   	pop    %edi
+  8008ba:	5d                   	pop    %ebp
+  8008bb:	c3                   	ret
+
+008008bc <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8008bc:	55                   	push   %ebp
+  8008bd:	89 e5                	mov    %esp,%ebp
+  8008bf:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8008c2:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8008c6:	8b 10                	mov    (%eax),%edx
+  8008c8:	3b 50 04             	cmp    0x4(%eax),%edx
+  8008cb:	73 0a                	jae    8008d7 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8008cd:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8008d0:	89 08                	mov    %ecx,(%eax)
+  8008d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008d5:	88 02                	mov    %al,(%edx)
+}
+  8008d7:	5d                   	pop    %ebp
+  8008d8:	c3                   	ret
+
+008008d9 <printfmt>:
+{
+  8008d9:	55                   	push   %ebp
+  8008da:	89 e5                	mov    %esp,%ebp
+  8008dc:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8008df:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8008e2:	50                   	push   %eax
+  8008e3:	ff 75 10             	push   0x10(%ebp)
+  8008e6:	ff 75 0c             	push   0xc(%ebp)
+  8008e9:	ff 75 08             	push   0x8(%ebp)
+  8008ec:	e8 05 00 00 00       	call   8008f6 <vprintfmt>
+}
+  8008f1:	83 c4 10             	add    $0x10,%esp
+  8008f4:	c9                   	leave
+  8008f5:	c3                   	ret
+
+008008f6 <vprintfmt>:
+{
+  8008f6:	55                   	push   %ebp
+  8008f7:	89 e5                	mov    %esp,%ebp
+  8008f9:	57                   	push   %edi
+  8008fa:	56                   	push   %esi
+  8008fb:	53                   	push   %ebx
+  8008fc:	83 ec 2c             	sub    $0x2c,%esp
+  8008ff:	8b 75 08             	mov    0x8(%ebp),%esi
+  800902:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800905:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800908:	eb 0a                	jmp    800914 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80090a:	83 ec 08             	sub    $0x8,%esp
+  80090d:	53                   	push   %ebx
+  80090e:	50                   	push   %eax
+  80090f:	ff d6                	call   *%esi
+  800911:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800914:	83 c7 01             	add    $0x1,%edi
+  800917:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80091b:	83 f8 25             	cmp    $0x25,%eax
+  80091e:	74 0c                	je     80092c <vprintfmt+0x36>
+			if (ch == '\0')
+  800920:	85 c0                	test   %eax,%eax
+  800922:	75 e6                	jne    80090a <vprintfmt+0x14>
+}
+  800924:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800927:	5b                   	pop    %ebx
+  800928:	5e                   	pop    %esi
+  800929:	5f                   	pop    %edi
+  80092a:	5d                   	pop    %ebp
+  80092b:	c3                   	ret
+		padc = ' ';
+  80092c:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800930:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800937:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80093e:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800945:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80094a:	8d 47 01             	lea    0x1(%edi),%eax
+  80094d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800950:	0f b6 17             	movzbl (%edi),%edx
+  800953:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800956:	3c 55                	cmp    $0x55,%al
+  800958:	0f 87 cf 03 00 00    	ja     800d2d <vprintfmt+0x437>
+  80095e:	0f b6 c0             	movzbl %al,%eax
+  800961:	ff 24 85 40 34 80 00 	jmp    *0x803440(,%eax,4)
+  800968:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80096b:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80096f:	eb d9                	jmp    80094a <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800971:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800974:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800978:	eb d0                	jmp    80094a <vprintfmt+0x54>
+  80097a:	0f b6 d2             	movzbl %dl,%edx
+  80097d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800980:	b8 00 00 00 00       	mov    $0x0,%eax
+  800985:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800988:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80098b:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80098f:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800992:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800995:	83 f9 09             	cmp    $0x9,%ecx
+  800998:	77 55                	ja     8009ef <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80099a:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80099d:	eb e9                	jmp    800988 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80099f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009a2:	8b 00                	mov    (%eax),%eax
+  8009a4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8009a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009aa:	8d 40 04             	lea    0x4(%eax),%eax
+  8009ad:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8009b0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8009b3:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8009b7:	79 91                	jns    80094a <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8009b9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8009bc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8009bf:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8009c6:	eb 82                	jmp    80094a <vprintfmt+0x54>
+			if (width < 0)
+  8009c8:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8009cb:	85 d2                	test   %edx,%edx
+  8009cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d2:	0f 49 c2             	cmovns %edx,%eax
+  8009d5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8009d8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8009db:	e9 6a ff ff ff       	jmp    80094a <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8009e0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8009e3:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8009ea:	e9 5b ff ff ff       	jmp    80094a <vprintfmt+0x54>
+  8009ef:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8009f2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8009f5:	eb bc                	jmp    8009b3 <vprintfmt+0xbd>
+			lflag++;
+  8009f7:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8009fa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8009fd:	e9 48 ff ff ff       	jmp    80094a <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800a02:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a05:	8d 78 04             	lea    0x4(%eax),%edi
+  800a08:	83 ec 08             	sub    $0x8,%esp
+  800a0b:	53                   	push   %ebx
+  800a0c:	ff 30                	push   (%eax)
+  800a0e:	ff d6                	call   *%esi
+			break;
+  800a10:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800a13:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800a16:	e9 b1 02 00 00       	jmp    800ccc <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800a1b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a1e:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800a21:	8b 10                	mov    (%eax),%edx
+  800a23:	89 d0                	mov    %edx,%eax
+  800a25:	f7 d8                	neg    %eax
+  800a27:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800a2a:	83 f8 0d             	cmp    $0xd,%eax
+  800a2d:	7f 23                	jg     800a52 <vprintfmt+0x15c>
+  800a2f:	8b 14 85 a0 35 80 00 	mov    0x8035a0(,%eax,4),%edx
+  800a36:	85 d2                	test   %edx,%edx
+  800a38:	74 18                	je     800a52 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800a3a:	52                   	push   %edx
+  800a3b:	68 1c 33 80 00       	push   $0x80331c
+  800a40:	53                   	push   %ebx
+  800a41:	56                   	push   %esi
+  800a42:	e8 92 fe ff ff       	call   8008d9 <printfmt>
+  800a47:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800a4a:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800a4d:	e9 7a 02 00 00       	jmp    800ccc <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800a52:	50                   	push   %eax
+  800a53:	68 81 33 80 00       	push   $0x803381
+  800a58:	53                   	push   %ebx
+  800a59:	56                   	push   %esi
+  800a5a:	e8 7a fe ff ff       	call   8008d9 <printfmt>
+  800a5f:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800a62:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800a65:	e9 62 02 00 00       	jmp    800ccc <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800a6a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a6d:	83 c0 04             	add    $0x4,%eax
+  800a70:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800a73:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a76:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800a78:	85 c9                	test   %ecx,%ecx
+  800a7a:	b8 7a 33 80 00       	mov    $0x80337a,%eax
+  800a7f:	0f 45 c1             	cmovne %ecx,%eax
+  800a82:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800a85:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800a89:	7e 06                	jle    800a91 <vprintfmt+0x19b>
+  800a8b:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800a8f:	75 0b                	jne    800a9c <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800a91:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800a94:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800a97:	89 75 08             	mov    %esi,0x8(%ebp)
+  800a9a:	eb 5c                	jmp    800af8 <vprintfmt+0x202>
+  800a9c:	83 ec 08             	sub    $0x8,%esp
+  800a9f:	ff 75 d0             	push   -0x30(%ebp)
+  800aa2:	ff 75 cc             	push   -0x34(%ebp)
+  800aa5:	e8 20 03 00 00       	call   800dca <strnlen>
+  800aaa:	89 c2                	mov    %eax,%edx
+  800aac:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800aaf:	29 d0                	sub    %edx,%eax
+  800ab1:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800ab4:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800ab8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800abb:	89 75 08             	mov    %esi,0x8(%ebp)
+  800abe:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800ac0:	eb 0e                	jmp    800ad0 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800ac2:	83 ec 08             	sub    $0x8,%esp
+  800ac5:	53                   	push   %ebx
+  800ac6:	57                   	push   %edi
+  800ac7:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800aca:	83 ee 01             	sub    $0x1,%esi
+  800acd:	83 c4 10             	add    $0x10,%esp
+  800ad0:	85 f6                	test   %esi,%esi
+  800ad2:	7f ee                	jg     800ac2 <vprintfmt+0x1cc>
+  800ad4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800ad7:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ada:	85 c0                	test   %eax,%eax
+  800adc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ae1:	0f 49 d0             	cmovns %eax,%edx
+  800ae4:	29 d0                	sub    %edx,%eax
+  800ae6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800ae9:	eb a6                	jmp    800a91 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800aeb:	83 ec 08             	sub    $0x8,%esp
+  800aee:	53                   	push   %ebx
+  800aef:	52                   	push   %edx
+  800af0:	ff 55 08             	call   *0x8(%ebp)
+  800af3:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800af6:	89 f1                	mov    %esi,%ecx
+  800af8:	8d 71 01             	lea    0x1(%ecx),%esi
+  800afb:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800aff:	0f be d0             	movsbl %al,%edx
+  800b02:	85 d2                	test   %edx,%edx
+  800b04:	74 28                	je     800b2e <vprintfmt+0x238>
+  800b06:	85 ff                	test   %edi,%edi
+  800b08:	78 05                	js     800b0f <vprintfmt+0x219>
+  800b0a:	83 ef 01             	sub    $0x1,%edi
+  800b0d:	78 30                	js     800b3f <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800b0f:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800b13:	74 d6                	je     800aeb <vprintfmt+0x1f5>
+  800b15:	0f be c0             	movsbl %al,%eax
+  800b18:	83 e8 20             	sub    $0x20,%eax
+  800b1b:	83 f8 5e             	cmp    $0x5e,%eax
+  800b1e:	76 cb                	jbe    800aeb <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800b20:	83 ec 08             	sub    $0x8,%esp
+  800b23:	53                   	push   %ebx
+  800b24:	6a 3f                	push   $0x3f
+  800b26:	ff 55 08             	call   *0x8(%ebp)
+  800b29:	83 c4 10             	add    $0x10,%esp
+  800b2c:	eb c8                	jmp    800af6 <vprintfmt+0x200>
+  800b2e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b31:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800b34:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800b37:	01 d0                	add    %edx,%eax
+  800b39:	29 c8                	sub    %ecx,%eax
+  800b3b:	89 c7                	mov    %eax,%edi
+  800b3d:	eb 13                	jmp    800b52 <vprintfmt+0x25c>
+  800b3f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b42:	eb ed                	jmp    800b31 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800b44:	83 ec 08             	sub    $0x8,%esp
+  800b47:	53                   	push   %ebx
+  800b48:	6a 20                	push   $0x20
+  800b4a:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800b4c:	83 ef 01             	sub    $0x1,%edi
+  800b4f:	83 c4 10             	add    $0x10,%esp
+  800b52:	85 ff                	test   %edi,%edi
+  800b54:	7f ee                	jg     800b44 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800b56:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800b59:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b5c:	e9 6b 01 00 00       	jmp    800ccc <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800b61:	83 f9 01             	cmp    $0x1,%ecx
+  800b64:	7f 1f                	jg     800b85 <vprintfmt+0x28f>
+	else if (lflag)
+  800b66:	85 c9                	test   %ecx,%ecx
+  800b68:	74 67                	je     800bd1 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800b6a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b6d:	8b 00                	mov    (%eax),%eax
+  800b6f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800b72:	89 c1                	mov    %eax,%ecx
+  800b74:	c1 f9 1f             	sar    $0x1f,%ecx
+  800b77:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b7a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b7d:	8d 40 04             	lea    0x4(%eax),%eax
+  800b80:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b83:	eb 17                	jmp    800b9c <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800b85:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b88:	8b 50 04             	mov    0x4(%eax),%edx
+  800b8b:	8b 00                	mov    (%eax),%eax
+  800b8d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800b90:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800b93:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b96:	8d 40 08             	lea    0x8(%eax),%eax
+  800b99:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800b9c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800b9f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800ba2:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800ba7:	85 c9                	test   %ecx,%ecx
+  800ba9:	0f 89 03 01 00 00    	jns    800cb2 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800baf:	83 ec 08             	sub    $0x8,%esp
+  800bb2:	53                   	push   %ebx
+  800bb3:	6a 2d                	push   $0x2d
+  800bb5:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800bb7:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800bba:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800bbd:	f7 da                	neg    %edx
+  800bbf:	83 d1 00             	adc    $0x0,%ecx
+  800bc2:	f7 d9                	neg    %ecx
+  800bc4:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800bc7:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800bcc:	e9 e1 00 00 00       	jmp    800cb2 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800bd1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bd4:	8b 00                	mov    (%eax),%eax
+  800bd6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800bd9:	89 c1                	mov    %eax,%ecx
+  800bdb:	c1 f9 1f             	sar    $0x1f,%ecx
+  800bde:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800be1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800be4:	8d 40 04             	lea    0x4(%eax),%eax
+  800be7:	89 45 14             	mov    %eax,0x14(%ebp)
+  800bea:	eb b0                	jmp    800b9c <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800bec:	83 f9 01             	cmp    $0x1,%ecx
+  800bef:	7f 1e                	jg     800c0f <vprintfmt+0x319>
+	else if (lflag)
+  800bf1:	85 c9                	test   %ecx,%ecx
+  800bf3:	74 32                	je     800c27 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800bf5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bf8:	8b 10                	mov    (%eax),%edx
+  800bfa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bff:	8d 40 04             	lea    0x4(%eax),%eax
+  800c02:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800c05:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800c0a:	e9 a3 00 00 00       	jmp    800cb2 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800c0f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c12:	8b 10                	mov    (%eax),%edx
+  800c14:	8b 48 04             	mov    0x4(%eax),%ecx
+  800c17:	8d 40 08             	lea    0x8(%eax),%eax
+  800c1a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800c1d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800c22:	e9 8b 00 00 00       	jmp    800cb2 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800c27:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c2a:	8b 10                	mov    (%eax),%edx
+  800c2c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c31:	8d 40 04             	lea    0x4(%eax),%eax
+  800c34:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800c37:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800c3c:	eb 74                	jmp    800cb2 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800c3e:	83 f9 01             	cmp    $0x1,%ecx
+  800c41:	7f 1b                	jg     800c5e <vprintfmt+0x368>
+	else if (lflag)
+  800c43:	85 c9                	test   %ecx,%ecx
+  800c45:	74 2c                	je     800c73 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800c47:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c4a:	8b 10                	mov    (%eax),%edx
+  800c4c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c51:	8d 40 04             	lea    0x4(%eax),%eax
+  800c54:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800c57:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800c5c:	eb 54                	jmp    800cb2 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800c5e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c61:	8b 10                	mov    (%eax),%edx
+  800c63:	8b 48 04             	mov    0x4(%eax),%ecx
+  800c66:	8d 40 08             	lea    0x8(%eax),%eax
+  800c69:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800c6c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800c71:	eb 3f                	jmp    800cb2 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800c73:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c76:	8b 10                	mov    (%eax),%edx
+  800c78:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c7d:	8d 40 04             	lea    0x4(%eax),%eax
+  800c80:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800c83:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800c88:	eb 28                	jmp    800cb2 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800c8a:	83 ec 08             	sub    $0x8,%esp
+  800c8d:	53                   	push   %ebx
+  800c8e:	6a 30                	push   $0x30
+  800c90:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800c92:	83 c4 08             	add    $0x8,%esp
+  800c95:	53                   	push   %ebx
+  800c96:	6a 78                	push   $0x78
+  800c98:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800c9a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c9d:	8b 10                	mov    (%eax),%edx
+  800c9f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800ca4:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800ca7:	8d 40 04             	lea    0x4(%eax),%eax
+  800caa:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800cad:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800cb2:	83 ec 0c             	sub    $0xc,%esp
+  800cb5:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800cb9:	50                   	push   %eax
+  800cba:	ff 75 e0             	push   -0x20(%ebp)
+  800cbd:	57                   	push   %edi
+  800cbe:	51                   	push   %ecx
+  800cbf:	52                   	push   %edx
+  800cc0:	89 da                	mov    %ebx,%edx
+  800cc2:	89 f0                	mov    %esi,%eax
+  800cc4:	e8 4a fb ff ff       	call   800813 <printnum>
+			break;
+  800cc9:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800ccc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800ccf:	e9 40 fc ff ff       	jmp    800914 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800cd4:	83 f9 01             	cmp    $0x1,%ecx
+  800cd7:	7f 1b                	jg     800cf4 <vprintfmt+0x3fe>
+	else if (lflag)
+  800cd9:	85 c9                	test   %ecx,%ecx
+  800cdb:	74 2c                	je     800d09 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800cdd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ce0:	8b 10                	mov    (%eax),%edx
+  800ce2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ce7:	8d 40 04             	lea    0x4(%eax),%eax
+  800cea:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ced:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800cf2:	eb be                	jmp    800cb2 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800cf4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cf7:	8b 10                	mov    (%eax),%edx
+  800cf9:	8b 48 04             	mov    0x4(%eax),%ecx
+  800cfc:	8d 40 08             	lea    0x8(%eax),%eax
+  800cff:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800d02:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800d07:	eb a9                	jmp    800cb2 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800d09:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d0c:	8b 10                	mov    (%eax),%edx
+  800d0e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d13:	8d 40 04             	lea    0x4(%eax),%eax
+  800d16:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800d19:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800d1e:	eb 92                	jmp    800cb2 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800d20:	83 ec 08             	sub    $0x8,%esp
+  800d23:	53                   	push   %ebx
+  800d24:	6a 25                	push   $0x25
+  800d26:	ff d6                	call   *%esi
+			break;
+  800d28:	83 c4 10             	add    $0x10,%esp
+  800d2b:	eb 9f                	jmp    800ccc <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800d2d:	83 ec 08             	sub    $0x8,%esp
+  800d30:	53                   	push   %ebx
+  800d31:	6a 25                	push   $0x25
+  800d33:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800d35:	83 c4 10             	add    $0x10,%esp
+  800d38:	89 f8                	mov    %edi,%eax
+  800d3a:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800d3e:	74 05                	je     800d45 <vprintfmt+0x44f>
+  800d40:	83 e8 01             	sub    $0x1,%eax
+  800d43:	eb f5                	jmp    800d3a <vprintfmt+0x444>
+  800d45:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800d48:	eb 82                	jmp    800ccc <vprintfmt+0x3d6>
+
+00800d4a <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800d4a:	55                   	push   %ebp
+  800d4b:	89 e5                	mov    %esp,%ebp
+  800d4d:	83 ec 18             	sub    $0x18,%esp
+  800d50:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d53:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800d56:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800d59:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800d5d:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800d60:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800d67:	85 c0                	test   %eax,%eax
+  800d69:	74 26                	je     800d91 <vsnprintf+0x47>
+  800d6b:	85 d2                	test   %edx,%edx
+  800d6d:	7e 22                	jle    800d91 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800d6f:	ff 75 14             	push   0x14(%ebp)
+  800d72:	ff 75 10             	push   0x10(%ebp)
+  800d75:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800d78:	50                   	push   %eax
+  800d79:	68 bc 08 80 00       	push   $0x8008bc
+  800d7e:	e8 73 fb ff ff       	call   8008f6 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800d83:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800d86:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800d89:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d8c:	83 c4 10             	add    $0x10,%esp
+}
+  800d8f:	c9                   	leave
+  800d90:	c3                   	ret
+		return -E_INVAL;
+  800d91:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d96:	eb f7                	jmp    800d8f <vsnprintf+0x45>
+
+00800d98 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800d98:	55                   	push   %ebp
+  800d99:	89 e5                	mov    %esp,%ebp
+  800d9b:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800d9e:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800da1:	50                   	push   %eax
+  800da2:	ff 75 10             	push   0x10(%ebp)
+  800da5:	ff 75 0c             	push   0xc(%ebp)
+  800da8:	ff 75 08             	push   0x8(%ebp)
+  800dab:	e8 9a ff ff ff       	call   800d4a <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800db0:	c9                   	leave
+  800db1:	c3                   	ret
+
+00800db2 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800db2:	55                   	push   %ebp
+  800db3:	89 e5                	mov    %esp,%ebp
+  800db5:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800db8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dbd:	eb 03                	jmp    800dc2 <strlen+0x10>
+		n++;
+  800dbf:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800dc2:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800dc6:	75 f7                	jne    800dbf <strlen+0xd>
+	return n;
+}
+  800dc8:	5d                   	pop    %ebp
+  800dc9:	c3                   	ret
+
+00800dca <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800dca:	55                   	push   %ebp
+  800dcb:	89 e5                	mov    %esp,%ebp
+  800dcd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800dd0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800dd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dd8:	eb 03                	jmp    800ddd <strnlen+0x13>
+		n++;
+  800dda:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800ddd:	39 d0                	cmp    %edx,%eax
+  800ddf:	74 08                	je     800de9 <strnlen+0x1f>
+  800de1:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800de5:	75 f3                	jne    800dda <strnlen+0x10>
+  800de7:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800de9:	89 d0                	mov    %edx,%eax
+  800deb:	5d                   	pop    %ebp
+  800dec:	c3                   	ret
+
+00800ded <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800ded:	55                   	push   %ebp
+  800dee:	89 e5                	mov    %esp,%ebp
+  800df0:	53                   	push   %ebx
+  800df1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800df4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800df7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dfc:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800e00:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800e03:	83 c0 01             	add    $0x1,%eax
+  800e06:	84 d2                	test   %dl,%dl
+  800e08:	75 f2                	jne    800dfc <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800e0a:	89 c8                	mov    %ecx,%eax
+  800e0c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e0f:	c9                   	leave
+  800e10:	c3                   	ret
+
+00800e11 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800e11:	55                   	push   %ebp
+  800e12:	89 e5                	mov    %esp,%ebp
+  800e14:	53                   	push   %ebx
+  800e15:	83 ec 10             	sub    $0x10,%esp
+  800e18:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800e1b:	53                   	push   %ebx
+  800e1c:	e8 91 ff ff ff       	call   800db2 <strlen>
+  800e21:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800e24:	ff 75 0c             	push   0xc(%ebp)
+  800e27:	01 d8                	add    %ebx,%eax
+  800e29:	50                   	push   %eax
+  800e2a:	e8 be ff ff ff       	call   800ded <strcpy>
+	return dst;
+}
+  800e2f:	89 d8                	mov    %ebx,%eax
+  800e31:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e34:	c9                   	leave
+  800e35:	c3                   	ret
+
+00800e36 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e36:	55                   	push   %ebp
+  800e37:	89 e5                	mov    %esp,%ebp
+  800e39:	56                   	push   %esi
+  800e3a:	53                   	push   %ebx
+  800e3b:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e3e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800e41:	89 f3                	mov    %esi,%ebx
+  800e43:	03 5d 10             	add    0x10(%ebp),%ebx
+  800e46:	89 f0                	mov    %esi,%eax
+  800e48:	eb 0f                	jmp    800e59 <strncpy+0x23>
+		*dst++ = *src;
+  800e4a:	83 c0 01             	add    $0x1,%eax
+  800e4d:	0f b6 0a             	movzbl (%edx),%ecx
+  800e50:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800e53:	80 f9 01             	cmp    $0x1,%cl
+  800e56:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800e59:	39 d8                	cmp    %ebx,%eax
+  800e5b:	75 ed                	jne    800e4a <strncpy+0x14>
+	}
+	return ret;
+}
+  800e5d:	89 f0                	mov    %esi,%eax
+  800e5f:	5b                   	pop    %ebx
+  800e60:	5e                   	pop    %esi
+  800e61:	5d                   	pop    %ebp
+  800e62:	c3                   	ret
+
+00800e63 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800e63:	55                   	push   %ebp
+  800e64:	89 e5                	mov    %esp,%ebp
+  800e66:	56                   	push   %esi
+  800e67:	53                   	push   %ebx
+  800e68:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e6b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e6e:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800e71:	89 f0                	mov    %esi,%eax
+  800e73:	85 d2                	test   %edx,%edx
+  800e75:	74 21                	je     800e98 <strlcpy+0x35>
+  800e77:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800e7b:	89 f2                	mov    %esi,%edx
+  800e7d:	eb 09                	jmp    800e88 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800e7f:	83 c1 01             	add    $0x1,%ecx
+  800e82:	83 c2 01             	add    $0x1,%edx
+  800e85:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800e88:	39 c2                	cmp    %eax,%edx
+  800e8a:	74 09                	je     800e95 <strlcpy+0x32>
+  800e8c:	0f b6 19             	movzbl (%ecx),%ebx
+  800e8f:	84 db                	test   %bl,%bl
+  800e91:	75 ec                	jne    800e7f <strlcpy+0x1c>
+  800e93:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800e95:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800e98:	29 f0                	sub    %esi,%eax
+}
+  800e9a:	5b                   	pop    %ebx
+  800e9b:	5e                   	pop    %esi
+  800e9c:	5d                   	pop    %ebp
+  800e9d:	c3                   	ret
+
+00800e9e <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800e9e:	55                   	push   %ebp
+  800e9f:	89 e5                	mov    %esp,%ebp
+  800ea1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ea4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800ea7:	eb 06                	jmp    800eaf <strcmp+0x11>
+		p++, q++;
+  800ea9:	83 c1 01             	add    $0x1,%ecx
+  800eac:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800eaf:	0f b6 01             	movzbl (%ecx),%eax
+  800eb2:	84 c0                	test   %al,%al
+  800eb4:	74 04                	je     800eba <strcmp+0x1c>
+  800eb6:	3a 02                	cmp    (%edx),%al
+  800eb8:	74 ef                	je     800ea9 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800eba:	0f b6 c0             	movzbl %al,%eax
+  800ebd:	0f b6 12             	movzbl (%edx),%edx
+  800ec0:	29 d0                	sub    %edx,%eax
+}
+  800ec2:	5d                   	pop    %ebp
+  800ec3:	c3                   	ret
+
+00800ec4 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800ec4:	55                   	push   %ebp
+  800ec5:	89 e5                	mov    %esp,%ebp
+  800ec7:	53                   	push   %ebx
+  800ec8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ecb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ece:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800ed1:	eb 09                	jmp    800edc <strncmp+0x18>
+		n--, p++, q++;
+  800ed3:	83 ea 01             	sub    $0x1,%edx
+  800ed6:	83 c0 01             	add    $0x1,%eax
+  800ed9:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800edc:	85 d2                	test   %edx,%edx
+  800ede:	74 18                	je     800ef8 <strncmp+0x34>
+  800ee0:	0f b6 18             	movzbl (%eax),%ebx
+  800ee3:	84 db                	test   %bl,%bl
+  800ee5:	74 04                	je     800eeb <strncmp+0x27>
+  800ee7:	3a 19                	cmp    (%ecx),%bl
+  800ee9:	74 e8                	je     800ed3 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800eeb:	0f b6 00             	movzbl (%eax),%eax
+  800eee:	0f b6 11             	movzbl (%ecx),%edx
+  800ef1:	29 d0                	sub    %edx,%eax
+}
+  800ef3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ef6:	c9                   	leave
+  800ef7:	c3                   	ret
+		return 0;
+  800ef8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800efd:	eb f4                	jmp    800ef3 <strncmp+0x2f>
+
+00800eff <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800eff:	55                   	push   %ebp
+  800f00:	89 e5                	mov    %esp,%ebp
+  800f02:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f05:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800f09:	eb 03                	jmp    800f0e <strchr+0xf>
+  800f0b:	83 c0 01             	add    $0x1,%eax
+  800f0e:	0f b6 10             	movzbl (%eax),%edx
+  800f11:	84 d2                	test   %dl,%dl
+  800f13:	74 06                	je     800f1b <strchr+0x1c>
+		if (*s == c)
+  800f15:	38 ca                	cmp    %cl,%dl
+  800f17:	75 f2                	jne    800f0b <strchr+0xc>
+  800f19:	eb 05                	jmp    800f20 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800f1b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f20:	5d                   	pop    %ebp
+  800f21:	c3                   	ret
+
+00800f22 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800f22:	55                   	push   %ebp
+  800f23:	89 e5                	mov    %esp,%ebp
+  800f25:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f28:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800f2c:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800f2f:	38 ca                	cmp    %cl,%dl
+  800f31:	74 09                	je     800f3c <strfind+0x1a>
+  800f33:	84 d2                	test   %dl,%dl
+  800f35:	74 05                	je     800f3c <strfind+0x1a>
+	for (; *s; s++)
+  800f37:	83 c0 01             	add    $0x1,%eax
+  800f3a:	eb f0                	jmp    800f2c <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800f3c:	5d                   	pop    %ebp
+  800f3d:	c3                   	ret
+
+00800f3e <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800f3e:	55                   	push   %ebp
+  800f3f:	89 e5                	mov    %esp,%ebp
+  800f41:	57                   	push   %edi
+  800f42:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800f45:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800f48:	85 c9                	test   %ecx,%ecx
+  800f4a:	74 20                	je     800f6c <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800f4c:	89 f8                	mov    %edi,%eax
+  800f4e:	09 c8                	or     %ecx,%eax
+  800f50:	a8 03                	test   $0x3,%al
+  800f52:	75 12                	jne    800f66 <memset+0x28>
+		c &= 0xFF;
+  800f54:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800f58:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800f5e:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800f61:	fc                   	cld
+  800f62:	f3 ab                	rep stos %eax,%es:(%edi)
+  800f64:	eb 06                	jmp    800f6c <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800f66:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f69:	fc                   	cld
+  800f6a:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800f6c:	89 f8                	mov    %edi,%eax
+  800f6e:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800f71:	c9                   	leave
+  800f72:	c3                   	ret
+
+00800f73 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800f73:	55                   	push   %ebp
+  800f74:	89 e5                	mov    %esp,%ebp
+  800f76:	57                   	push   %edi
+  800f77:	56                   	push   %esi
+  800f78:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f7b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800f7e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800f81:	39 c6                	cmp    %eax,%esi
+  800f83:	73 32                	jae    800fb7 <memmove+0x44>
+  800f85:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800f88:	39 d0                	cmp    %edx,%eax
+  800f8a:	73 2b                	jae    800fb7 <memmove+0x44>
+		s += n;
+		d += n;
+  800f8c:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800f8f:	89 d6                	mov    %edx,%esi
+  800f91:	09 fe                	or     %edi,%esi
+  800f93:	09 ce                	or     %ecx,%esi
+  800f95:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800f9b:	75 0e                	jne    800fab <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800f9d:	83 ef 04             	sub    $0x4,%edi
+  800fa0:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800fa3:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800fa6:	fd                   	std
+  800fa7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800fa9:	eb 09                	jmp    800fb4 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800fab:	83 ef 01             	sub    $0x1,%edi
+  800fae:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800fb1:	fd                   	std
+  800fb2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800fb4:	fc                   	cld
+  800fb5:	eb 1a                	jmp    800fd1 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800fb7:	89 f2                	mov    %esi,%edx
+  800fb9:	09 c2                	or     %eax,%edx
+  800fbb:	09 ca                	or     %ecx,%edx
+  800fbd:	f6 c2 03             	test   $0x3,%dl
+  800fc0:	75 0a                	jne    800fcc <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800fc2:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800fc5:	89 c7                	mov    %eax,%edi
+  800fc7:	fc                   	cld
+  800fc8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800fca:	eb 05                	jmp    800fd1 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800fcc:	89 c7                	mov    %eax,%edi
+  800fce:	fc                   	cld
+  800fcf:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800fd1:	5e                   	pop    %esi
+  800fd2:	5f                   	pop    %edi
+  800fd3:	5d                   	pop    %ebp
+  800fd4:	c3                   	ret
+
+00800fd5 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800fd5:	55                   	push   %ebp
+  800fd6:	89 e5                	mov    %esp,%ebp
+  800fd8:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800fdb:	ff 75 10             	push   0x10(%ebp)
+  800fde:	ff 75 0c             	push   0xc(%ebp)
+  800fe1:	ff 75 08             	push   0x8(%ebp)
+  800fe4:	e8 8a ff ff ff       	call   800f73 <memmove>
+}
+  800fe9:	c9                   	leave
+  800fea:	c3                   	ret
+
+00800feb <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800feb:	55                   	push   %ebp
+  800fec:	89 e5                	mov    %esp,%ebp
+  800fee:	56                   	push   %esi
+  800fef:	53                   	push   %ebx
+  800ff0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ff3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ff6:	89 c6                	mov    %eax,%esi
+  800ff8:	03 75 10             	add    0x10(%ebp),%esi
+  800ffb:	eb 06                	jmp    801003 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ffd:	83 c0 01             	add    $0x1,%eax
+  801000:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801003:	39 f0                	cmp    %esi,%eax
+  801005:	74 14                	je     80101b <memcmp+0x30>
+		if (*s1 != *s2)
+  801007:	0f b6 08             	movzbl (%eax),%ecx
+  80100a:	0f b6 1a             	movzbl (%edx),%ebx
+  80100d:	38 d9                	cmp    %bl,%cl
+  80100f:	74 ec                	je     800ffd <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  801011:	0f b6 c1             	movzbl %cl,%eax
+  801014:	0f b6 db             	movzbl %bl,%ebx
+  801017:	29 d8                	sub    %ebx,%eax
+  801019:	eb 05                	jmp    801020 <memcmp+0x35>
+	}
+
+	return 0;
+  80101b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801020:	5b                   	pop    %ebx
+  801021:	5e                   	pop    %esi
+  801022:	5d                   	pop    %ebp
+  801023:	c3                   	ret
+
+00801024 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801024:	55                   	push   %ebp
+  801025:	89 e5                	mov    %esp,%ebp
+  801027:	8b 45 08             	mov    0x8(%ebp),%eax
+  80102a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80102d:	89 c2                	mov    %eax,%edx
+  80102f:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  801032:	eb 03                	jmp    801037 <memfind+0x13>
+  801034:	83 c0 01             	add    $0x1,%eax
+  801037:	39 d0                	cmp    %edx,%eax
+  801039:	73 04                	jae    80103f <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80103b:	38 08                	cmp    %cl,(%eax)
+  80103d:	75 f5                	jne    801034 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  80103f:	5d                   	pop    %ebp
+  801040:	c3                   	ret
+
+00801041 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801041:	55                   	push   %ebp
+  801042:	89 e5                	mov    %esp,%ebp
+  801044:	57                   	push   %edi
+  801045:	56                   	push   %esi
+  801046:	53                   	push   %ebx
+  801047:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80104d:	eb 03                	jmp    801052 <strtol+0x11>
+		s++;
+  80104f:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  801052:	0f b6 02             	movzbl (%edx),%eax
+  801055:	3c 20                	cmp    $0x20,%al
+  801057:	74 f6                	je     80104f <strtol+0xe>
+  801059:	3c 09                	cmp    $0x9,%al
+  80105b:	74 f2                	je     80104f <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  80105d:	3c 2b                	cmp    $0x2b,%al
+  80105f:	74 2a                	je     80108b <strtol+0x4a>
+	int neg = 0;
+  801061:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  801066:	3c 2d                	cmp    $0x2d,%al
+  801068:	74 2b                	je     801095 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80106a:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801070:	75 0f                	jne    801081 <strtol+0x40>
+  801072:	80 3a 30             	cmpb   $0x30,(%edx)
+  801075:	74 28                	je     80109f <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801077:	85 db                	test   %ebx,%ebx
+  801079:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80107e:	0f 44 d8             	cmove  %eax,%ebx
+  801081:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801086:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801089:	eb 46                	jmp    8010d1 <strtol+0x90>
+		s++;
+  80108b:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  80108e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801093:	eb d5                	jmp    80106a <strtol+0x29>
+		s++, neg = 1;
+  801095:	83 c2 01             	add    $0x1,%edx
+  801098:	bf 01 00 00 00       	mov    $0x1,%edi
+  80109d:	eb cb                	jmp    80106a <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80109f:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8010a3:	74 0e                	je     8010b3 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8010a5:	85 db                	test   %ebx,%ebx
+  8010a7:	75 d8                	jne    801081 <strtol+0x40>
+		s++, base = 8;
+  8010a9:	83 c2 01             	add    $0x1,%edx
+  8010ac:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8010b1:	eb ce                	jmp    801081 <strtol+0x40>
+		s += 2, base = 16;
+  8010b3:	83 c2 02             	add    $0x2,%edx
+  8010b6:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8010bb:	eb c4                	jmp    801081 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8010bd:	0f be c0             	movsbl %al,%eax
+  8010c0:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8010c3:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8010c6:	7d 3a                	jge    801102 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8010c8:	83 c2 01             	add    $0x1,%edx
+  8010cb:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8010cf:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8010d1:	0f b6 02             	movzbl (%edx),%eax
+  8010d4:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8010d7:	89 f3                	mov    %esi,%ebx
+  8010d9:	80 fb 09             	cmp    $0x9,%bl
+  8010dc:	76 df                	jbe    8010bd <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  8010de:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8010e1:	89 f3                	mov    %esi,%ebx
+  8010e3:	80 fb 19             	cmp    $0x19,%bl
+  8010e6:	77 08                	ja     8010f0 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  8010e8:	0f be c0             	movsbl %al,%eax
+  8010eb:	83 e8 57             	sub    $0x57,%eax
+  8010ee:	eb d3                	jmp    8010c3 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  8010f0:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8010f3:	89 f3                	mov    %esi,%ebx
+  8010f5:	80 fb 19             	cmp    $0x19,%bl
+  8010f8:	77 08                	ja     801102 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  8010fa:	0f be c0             	movsbl %al,%eax
+  8010fd:	83 e8 37             	sub    $0x37,%eax
+  801100:	eb c1                	jmp    8010c3 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801102:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801106:	74 05                	je     80110d <strtol+0xcc>
+		*endptr = (char *) s;
+  801108:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80110b:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  80110d:	89 c8                	mov    %ecx,%eax
+  80110f:	f7 d8                	neg    %eax
+  801111:	85 ff                	test   %edi,%edi
+  801113:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801116:	89 c8                	mov    %ecx,%eax
+  801118:	5b                   	pop    %ebx
+  801119:	5e                   	pop    %esi
+  80111a:	5f                   	pop    %edi
+  80111b:	5d                   	pop    %ebp
+  80111c:	c3                   	ret
+
+0080111d <atoi>:
+
+int
+atoi(const char *s)
+{
+  80111d:	55                   	push   %ebp
+  80111e:	89 e5                	mov    %esp,%ebp
+  801120:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  801123:	6a 0a                	push   $0xa
+  801125:	6a 00                	push   $0x0
+  801127:	ff 75 08             	push   0x8(%ebp)
+  80112a:	e8 12 ff ff ff       	call   801041 <strtol>
+}
+  80112f:	c9                   	leave
+  801130:	c3                   	ret
+
+00801131 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  801131:	55                   	push   %ebp
+  801132:	89 e5                	mov    %esp,%ebp
+  801134:	57                   	push   %edi
+  801135:	56                   	push   %esi
+  801136:	53                   	push   %ebx
+  801137:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  80113d:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  801143:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  801149:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  80114f:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  801156:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  801159:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  801160:	00 00 00 
+		if (num == SYS_page_map_vec)
+  801163:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  80116a:	74 76                	je     8011e2 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  80116c:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  801172:	8b 45 08             	mov    0x8(%ebp),%eax
+  801175:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  80117b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801182:	0f 88 06 01 00 00    	js     80128e <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  801188:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80118f:	0f 84 48 01 00 00    	je     8012dd <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  801195:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  80119b:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  8011a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a6:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  8011ac:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8011af:	55                   	push   %ebp
+  8011b0:	68 b9 11 80 00       	push   $0x8011b9
+  8011b5:	89 e5                	mov    %esp,%ebp
+  8011b7:	0f 34                	sysenter
+  8011b9:	83 c4 04             	add    $0x4,%esp
+  8011bc:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  8011bd:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  8011c3:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  8011c9:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  8011cc:	0f 85 9a 01 00 00    	jne    80136c <page_vec_call+0x23b>
+  8011d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011d7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8011da:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8011dd:	e9 29 01 00 00       	jmp    80130b <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  8011e2:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  8011e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011eb:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  8011ed:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8011f4:	78 2f                	js     801225 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  8011f6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8011fd:	74 72                	je     801271 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  8011ff:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  801205:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  80120b:	b8 10 00 00 00       	mov    $0x10,%eax
+  801210:	89 fb                	mov    %edi,%ebx
+  801212:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801215:	55                   	push   %ebp
+  801216:	68 1f 12 80 00       	push   $0x80121f
+  80121b:	89 e5                	mov    %esp,%ebp
+  80121d:	0f 34                	sysenter
+  80121f:	83 c4 04             	add    $0x4,%esp
+  801222:	5d                   	pop    %ebp
+	return ret;
+  801223:	eb 98                	jmp    8011bd <page_vec_call+0x8c>
+	asm volatile("cpuid"
+  801225:	b8 01 00 00 00       	mov    $0x1,%eax
+  80122a:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  80122c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801231:	f6 c6 08             	test   $0x8,%dh
+  801234:	74 15                	je     80124b <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801236:	89 c2                	mov    %eax,%edx
+  801238:	c1 ea 08             	shr    $0x8,%edx
+  80123b:	83 e2 0f             	and    $0xf,%edx
+  80123e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801243:	83 fa 06             	cmp    $0x6,%edx
+  801246:	74 0e                	je     801256 <page_vec_call+0x125>
+  801248:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80124b:	0f b6 c9             	movzbl %cl,%ecx
+  80124e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801254:	eb a0                	jmp    8011f6 <page_vec_call+0xc5>
+  801256:	89 c2                	mov    %eax,%edx
+  801258:	c1 ea 04             	shr    $0x4,%edx
+  80125b:	83 e2 0f             	and    $0xf,%edx
+  80125e:	83 fa 02             	cmp    $0x2,%edx
+  801261:	77 e5                	ja     801248 <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  801263:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801266:	83 f8 02             	cmp    $0x2,%eax
+  801269:	0f 97 c1             	seta   %cl
+  80126c:	0f b6 c9             	movzbl %cl,%ecx
+  80126f:	eb d7                	jmp    801248 <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  801271:	b8 10 00 00 00       	mov    $0x10,%eax
+  801276:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  80127c:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  801282:	89 fb                	mov    %edi,%ebx
+  801284:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801287:	cd 30                	int    $0x30
+  801289:	e9 2f ff ff ff       	jmp    8011bd <page_vec_call+0x8c>
+  80128e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801293:	0f a2                	cpuid
+		return 0;
+  801295:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80129a:	f6 c6 08             	test   $0x8,%dh
+  80129d:	74 15                	je     8012b4 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80129f:	89 c2                	mov    %eax,%edx
+  8012a1:	c1 ea 08             	shr    $0x8,%edx
+  8012a4:	83 e2 0f             	and    $0xf,%edx
+  8012a7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012ac:	83 fa 06             	cmp    $0x6,%edx
+  8012af:	74 11                	je     8012c2 <page_vec_call+0x191>
+  8012b1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8012b4:	0f b6 c9             	movzbl %cl,%ecx
+  8012b7:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8012bd:	e9 c6 fe ff ff       	jmp    801188 <page_vec_call+0x57>
+  8012c2:	89 c2                	mov    %eax,%edx
+  8012c4:	c1 ea 04             	shr    $0x4,%edx
+  8012c7:	83 e2 0f             	and    $0xf,%edx
+  8012ca:	83 fa 02             	cmp    $0x2,%edx
+  8012cd:	77 e2                	ja     8012b1 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  8012cf:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012d2:	83 f8 02             	cmp    $0x2,%eax
+  8012d5:	0f 97 c1             	seta   %cl
+  8012d8:	0f b6 c9             	movzbl %cl,%ecx
+  8012db:	eb d4                	jmp    8012b1 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  8012dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e2:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  8012e8:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  8012ee:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  8012f4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8012f7:	cd 30                	int    $0x30
+  8012f9:	e9 bf fe ff ff       	jmp    8011bd <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  8012fe:	29 da                	sub    %ebx,%edx
+			vec++;
+  801300:	83 c6 10             	add    $0x10,%esi
+			n--;
+  801303:	83 e8 01             	sub    $0x1,%eax
+  801306:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  80130b:	85 c0                	test   %eax,%eax
+  80130d:	74 58                	je     801367 <page_vec_call+0x236>
+  80130f:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801312:	39 da                	cmp    %ebx,%edx
+  801314:	73 e8                	jae    8012fe <page_vec_call+0x1cd>
+  801316:	89 75 08             	mov    %esi,0x8(%ebp)
+  801319:	89 45 0c             	mov    %eax,0xc(%ebp)
+  80131c:	84 c9                	test   %cl,%cl
+  80131e:	74 06                	je     801326 <page_vec_call+0x1f5>
+  801320:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  801326:	83 ec 04             	sub    $0x4,%esp
+  801329:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80132c:	c1 e0 04             	shl    $0x4,%eax
+  80132f:	50                   	push   %eax
+  801330:	ff 75 08             	push   0x8(%ebp)
+  801333:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  801339:	53                   	push   %ebx
+  80133a:	e8 34 fc ff ff       	call   800f73 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  80133f:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  801345:	89 c2                	mov    %eax,%edx
+  801347:	c1 e2 0c             	shl    $0xc,%edx
+  80134a:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  801350:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  801356:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  80135c:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  80135f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  801362:	e9 f2 fd ff ff       	jmp    801159 <page_vec_call+0x28>
+			r = 0;
+  801367:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  80136c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801370:	74 0b                	je     80137d <page_vec_call+0x24c>
+		*done = total;
+  801372:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801375:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  80137b:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  80137d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801380:	5b                   	pop    %ebx
+  801381:	5e                   	pop    %esi
+  801382:	5f                   	pop    %edi
+  801383:	5d                   	pop    %ebp
+  801384:	c3                   	ret
+
+00801385 <sys_cputs>:
+{
+  801385:	55                   	push   %ebp
+  801386:	89 e5                	mov    %esp,%ebp
+  801388:	57                   	push   %edi
+  801389:	56                   	push   %esi
+  80138a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80138b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801392:	78 2d                	js     8013c1 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  801394:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80139b:	74 70                	je     80140d <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  80139d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a8:	89 c3                	mov    %eax,%ebx
+  8013aa:	89 c7                	mov    %eax,%edi
+  8013ac:	89 c6                	mov    %eax,%esi
+  8013ae:	55                   	push   %ebp
+  8013af:	68 b8 13 80 00       	push   $0x8013b8
+  8013b4:	89 e5                	mov    %esp,%ebp
+  8013b6:	0f 34                	sysenter
+  8013b8:	83 c4 04             	add    $0x4,%esp
+  8013bb:	5d                   	pop    %ebp
+}
+  8013bc:	5b                   	pop    %ebx
+  8013bd:	5e                   	pop    %esi
+  8013be:	5f                   	pop    %edi
+  8013bf:	5d                   	pop    %ebp
+  8013c0:	c3                   	ret
+  8013c1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013c6:	0f a2                	cpuid
+		return 0;
+  8013c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8013cd:	f6 c6 08             	test   $0x8,%dh
+  8013d0:	74 15                	je     8013e7 <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013d2:	89 c2                	mov    %eax,%edx
+  8013d4:	c1 ea 08             	shr    $0x8,%edx
+  8013d7:	83 e2 0f             	and    $0xf,%edx
+  8013da:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8013df:	83 fa 06             	cmp    $0x6,%edx
+  8013e2:	74 0e                	je     8013f2 <sys_cputs+0x6d>
+  8013e4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8013e7:	0f b6 c9             	movzbl %cl,%ecx
+  8013ea:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8013f0:	eb a2                	jmp    801394 <sys_cputs+0xf>
+  8013f2:	89 c2                	mov    %eax,%edx
+  8013f4:	c1 ea 04             	shr    $0x4,%edx
+  8013f7:	83 e2 0f             	and    $0xf,%edx
+  8013fa:	83 fa 02             	cmp    $0x2,%edx
+  8013fd:	77 e5                	ja     8013e4 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  8013ff:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801402:	83 f8 02             	cmp    $0x2,%eax
+  801405:	0f 97 c1             	seta   %cl
+  801408:	0f b6 c9             	movzbl %cl,%ecx
+  80140b:	eb d7                	jmp    8013e4 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  80140d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801412:	8b 55 08             	mov    0x8(%ebp),%edx
+  801415:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801418:	89 c3                	mov    %eax,%ebx
+  80141a:	89 c7                	mov    %eax,%edi
+  80141c:	89 c6                	mov    %eax,%esi
+  80141e:	cd 30                	int    $0x30
+}
+  801420:	eb 9a                	jmp    8013bc <sys_cputs+0x37>
+
+00801422 <sys_cgetc>:
+{
+  801422:	55                   	push   %ebp
+  801423:	89 e5                	mov    %esp,%ebp
+  801425:	57                   	push   %edi
+  801426:	56                   	push   %esi
+  801427:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801428:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80142f:	78 2e                	js     80145f <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  801431:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801438:	74 71                	je     8014ab <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  80143a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80143f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801444:	89 d1                	mov    %edx,%ecx
+  801446:	89 d3                	mov    %edx,%ebx
+  801448:	89 d7                	mov    %edx,%edi
+  80144a:	89 d6                	mov    %edx,%esi
+  80144c:	55                   	push   %ebp
+  80144d:	68 56 14 80 00       	push   $0x801456
+  801452:	89 e5                	mov    %esp,%ebp
+  801454:	0f 34                	sysenter
+  801456:	83 c4 04             	add    $0x4,%esp
+  801459:	5d                   	pop    %ebp
+}
+  80145a:	5b                   	pop    %ebx
+  80145b:	5e                   	pop    %esi
+  80145c:	5f                   	pop    %edi
+  80145d:	5d                   	pop    %ebp
+  80145e:	c3                   	ret
+  80145f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801464:	0f a2                	cpuid
+		return 0;
+  801466:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80146b:	f6 c6 08             	test   $0x8,%dh
+  80146e:	74 15                	je     801485 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801470:	89 c2                	mov    %eax,%edx
+  801472:	c1 ea 08             	shr    $0x8,%edx
+  801475:	83 e2 0f             	and    $0xf,%edx
+  801478:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80147d:	83 fa 06             	cmp    $0x6,%edx
+  801480:	74 0e                	je     801490 <sys_cgetc+0x6e>
+  801482:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801485:	0f b6 c9             	movzbl %cl,%ecx
+  801488:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80148e:	eb a1                	jmp    801431 <sys_cgetc+0xf>
+  801490:	89 c2                	mov    %eax,%edx
+  801492:	c1 ea 04             	shr    $0x4,%edx
+  801495:	83 e2 0f             	and    $0xf,%edx
+  801498:	83 fa 02             	cmp    $0x2,%edx
+  80149b:	77 e5                	ja     801482 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  80149d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014a0:	83 f8 02             	cmp    $0x2,%eax
+  8014a3:	0f 97 c1             	seta   %cl
+  8014a6:	0f b6 c9             	movzbl %cl,%ecx
+  8014a9:	eb d7                	jmp    801482 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  8014ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014b5:	89 d1                	mov    %edx,%ecx
+  8014b7:	89 d3                	mov    %edx,%ebx
+  8014b9:	89 d7                	mov    %edx,%edi
+  8014bb:	89 d6                	mov    %edx,%esi
+  8014bd:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8014bf:	eb 99                	jmp    80145a <sys_cgetc+0x38>
+
+008014c1 <sys_env_destroy>:
+{
+  8014c1:	55                   	push   %ebp
+  8014c2:	89 e5                	mov    %esp,%ebp
+  8014c4:	57                   	push   %edi
+  8014c5:	56                   	push   %esi
+  8014c6:	53                   	push   %ebx
+  8014c7:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8014ca:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8014d1:	78 36                	js     801509 <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  8014d3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8014da:	74 79                	je     801555 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  8014dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014e4:	b8 03 00 00 00       	mov    $0x3,%eax
+  8014e9:	89 cb                	mov    %ecx,%ebx
+  8014eb:	89 cf                	mov    %ecx,%edi
+  8014ed:	89 ce                	mov    %ecx,%esi
+  8014ef:	55                   	push   %ebp
+  8014f0:	68 f9 14 80 00       	push   $0x8014f9
+  8014f5:	89 e5                	mov    %esp,%ebp
+  8014f7:	0f 34                	sysenter
+  8014f9:	83 c4 04             	add    $0x4,%esp
+  8014fc:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8014fd:	85 c0                	test   %eax,%eax
+  8014ff:	7f 6b                	jg     80156c <sys_env_destroy+0xab>
+}
+  801501:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801504:	5b                   	pop    %ebx
+  801505:	5e                   	pop    %esi
+  801506:	5f                   	pop    %edi
+  801507:	5d                   	pop    %ebp
+  801508:	c3                   	ret
+  801509:	b8 01 00 00 00       	mov    $0x1,%eax
+  80150e:	0f a2                	cpuid
+		return 0;
+  801510:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801515:	f6 c6 08             	test   $0x8,%dh
+  801518:	74 15                	je     80152f <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80151a:	89 c2                	mov    %eax,%edx
+  80151c:	c1 ea 08             	shr    $0x8,%edx
+  80151f:	83 e2 0f             	and    $0xf,%edx
+  801522:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801527:	83 fa 06             	cmp    $0x6,%edx
+  80152a:	74 0e                	je     80153a <sys_env_destroy+0x79>
+  80152c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80152f:	0f b6 c9             	movzbl %cl,%ecx
+  801532:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801538:	eb 99                	jmp    8014d3 <sys_env_destroy+0x12>
+  80153a:	89 c2                	mov    %eax,%edx
+  80153c:	c1 ea 04             	shr    $0x4,%edx
+  80153f:	83 e2 0f             	and    $0xf,%edx
+  801542:	83 fa 02             	cmp    $0x2,%edx
+  801545:	77 e5                	ja     80152c <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  801547:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80154a:	83 f8 02             	cmp    $0x2,%eax
+  80154d:	0f 97 c1             	seta   %cl
+  801550:	0f b6 c9             	movzbl %cl,%ecx
+  801553:	eb d7                	jmp    80152c <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  801555:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80155a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80155f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801562:	89 cb                	mov    %ecx,%ebx
+  801564:	89 cf                	mov    %ecx,%edi
+  801566:	89 ce                	mov    %ecx,%esi
+  801568:	cd 30                	int    $0x30
+  80156a:	eb 91                	jmp    8014fd <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80156c:	83 ec 0c             	sub    $0xc,%esp
+  80156f:	50                   	push   %eax
+  801570:	6a 03                	push   $0x3
+  801572:	68 19 36 80 00       	push   $0x803619
+  801577:	6a 4a                	push   $0x4a
+  801579:	68 36 36 80 00       	push   $0x803636
+  80157e:	e8 68 f1 ff ff       	call   8006eb <_panic>
+
+00801583 <sys_getenvid>:
+{
+  801583:	55                   	push   %ebp
+  801584:	89 e5                	mov    %esp,%ebp
+  801586:	57                   	push   %edi
+  801587:	56                   	push   %esi
+  801588:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801589:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801590:	78 2e                	js     8015c0 <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  801592:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801599:	74 71                	je     80160c <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  80159b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015a0:	b8 02 00 00 00       	mov    $0x2,%eax
+  8015a5:	89 d1                	mov    %edx,%ecx
+  8015a7:	89 d3                	mov    %edx,%ebx
+  8015a9:	89 d7                	mov    %edx,%edi
+  8015ab:	89 d6                	mov    %edx,%esi
+  8015ad:	55                   	push   %ebp
+  8015ae:	68 b7 15 80 00       	push   $0x8015b7
+  8015b3:	89 e5                	mov    %esp,%ebp
+  8015b5:	0f 34                	sysenter
+  8015b7:	83 c4 04             	add    $0x4,%esp
+  8015ba:	5d                   	pop    %ebp
+}
+  8015bb:	5b                   	pop    %ebx
+  8015bc:	5e                   	pop    %esi
+  8015bd:	5f                   	pop    %edi
+  8015be:	5d                   	pop    %ebp
+  8015bf:	c3                   	ret
+  8015c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015c5:	0f a2                	cpuid
+		return 0;
+  8015c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8015cc:	f6 c6 08             	test   $0x8,%dh
+  8015cf:	74 15                	je     8015e6 <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015d1:	89 c2                	mov    %eax,%edx
+  8015d3:	c1 ea 08             	shr    $0x8,%edx
+  8015d6:	83 e2 0f             	and    $0xf,%edx
+  8015d9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8015de:	83 fa 06             	cmp    $0x6,%edx
+  8015e1:	74 0e                	je     8015f1 <sys_getenvid+0x6e>
+  8015e3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8015e6:	0f b6 c9             	movzbl %cl,%ecx
+  8015e9:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8015ef:	eb a1                	jmp    801592 <sys_getenvid+0xf>
+  8015f1:	89 c2                	mov    %eax,%edx
+  8015f3:	c1 ea 04             	shr    $0x4,%edx
+  8015f6:	83 e2 0f             	and    $0xf,%edx
+  8015f9:	83 fa 02             	cmp    $0x2,%edx
+  8015fc:	77 e5                	ja     8015e3 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  8015fe:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801601:	83 f8 02             	cmp    $0x2,%eax
+  801604:	0f 97 c1             	seta   %cl
+  801607:	0f b6 c9             	movzbl %cl,%ecx
+  80160a:	eb d7                	jmp    8015e3 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  80160c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801611:	b8 02 00 00 00       	mov    $0x2,%eax
+  801616:	89 d1                	mov    %edx,%ecx
+  801618:	89 d3                	mov    %edx,%ebx
+  80161a:	89 d7                	mov    %edx,%edi
+  80161c:	89 d6                	mov    %edx,%esi
+  80161e:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801620:	eb 99                	jmp    8015bb <sys_getenvid+0x38>
+
+00801622 <sys_page_alloc>:
+{
+  801622:	55                   	push   %ebp
+  801623:	89 e5                	mov    %esp,%ebp
+  801625:	57                   	push   %edi
+  801626:	56                   	push   %esi
+  801627:	53                   	push   %ebx
+  801628:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80162b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801632:	78 38                	js     80166c <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  801634:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80163b:	74 7b                	je     8016b8 <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  80163d:	be 00 00 00 00       	mov    $0x0,%esi
+  801642:	8b 55 08             	mov    0x8(%ebp),%edx
+  801645:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801648:	b8 04 00 00 00       	mov    $0x4,%eax
+  80164d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801650:	89 f7                	mov    %esi,%edi
+  801652:	55                   	push   %ebp
+  801653:	68 5c 16 80 00       	push   $0x80165c
+  801658:	89 e5                	mov    %esp,%ebp
+  80165a:	0f 34                	sysenter
+  80165c:	83 c4 04             	add    $0x4,%esp
+  80165f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801660:	85 c0                	test   %eax,%eax
+  801662:	7f 6d                	jg     8016d1 <sys_page_alloc+0xaf>
+}
+  801664:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801667:	5b                   	pop    %ebx
+  801668:	5e                   	pop    %esi
+  801669:	5f                   	pop    %edi
+  80166a:	5d                   	pop    %ebp
+  80166b:	c3                   	ret
+  80166c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801671:	0f a2                	cpuid
+		return 0;
+  801673:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801678:	f6 c6 08             	test   $0x8,%dh
+  80167b:	74 15                	je     801692 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80167d:	89 c2                	mov    %eax,%edx
+  80167f:	c1 ea 08             	shr    $0x8,%edx
+  801682:	83 e2 0f             	and    $0xf,%edx
+  801685:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80168a:	83 fa 06             	cmp    $0x6,%edx
+  80168d:	74 0e                	je     80169d <sys_page_alloc+0x7b>
+  80168f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801692:	0f b6 c9             	movzbl %cl,%ecx
+  801695:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80169b:	eb 97                	jmp    801634 <sys_page_alloc+0x12>
+  80169d:	89 c2                	mov    %eax,%edx
+  80169f:	c1 ea 04             	shr    $0x4,%edx
+  8016a2:	83 e2 0f             	and    $0xf,%edx
+  8016a5:	83 fa 02             	cmp    $0x2,%edx
+  8016a8:	77 e5                	ja     80168f <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  8016aa:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016ad:	83 f8 02             	cmp    $0x2,%eax
+  8016b0:	0f 97 c1             	seta   %cl
+  8016b3:	0f b6 c9             	movzbl %cl,%ecx
+  8016b6:	eb d7                	jmp    80168f <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  8016b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8016bd:	b8 04 00 00 00       	mov    $0x4,%eax
+  8016c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016c8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016cb:	89 f7                	mov    %esi,%edi
+  8016cd:	cd 30                	int    $0x30
+  8016cf:	eb 8f                	jmp    801660 <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016d1:	83 ec 0c             	sub    $0xc,%esp
+  8016d4:	50                   	push   %eax
+  8016d5:	6a 04                	push   $0x4
+  8016d7:	68 19 36 80 00       	push   $0x803619
+  8016dc:	6a 4a                	push   $0x4a
+  8016de:	68 36 36 80 00       	push   $0x803636
+  8016e3:	e8 03 f0 ff ff       	call   8006eb <_panic>
+
+008016e8 <sys_page_map>:
+{
+  8016e8:	55                   	push   %ebp
+  8016e9:	89 e5                	mov    %esp,%ebp
+  8016eb:	57                   	push   %edi
+  8016ec:	56                   	push   %esi
+  8016ed:	53                   	push   %ebx
+  8016ee:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8016f1:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8016f8:	78 37                	js     801731 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  8016fa:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801701:	74 7a                	je     80177d <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  801703:	8b 55 08             	mov    0x8(%ebp),%edx
+  801706:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801709:	b8 05 00 00 00       	mov    $0x5,%eax
+  80170e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801711:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801714:	8b 75 18             	mov    0x18(%ebp),%esi
+  801717:	55                   	push   %ebp
+  801718:	68 21 17 80 00       	push   $0x801721
+  80171d:	89 e5                	mov    %esp,%ebp
+  80171f:	0f 34                	sysenter
+  801721:	83 c4 04             	add    $0x4,%esp
+  801724:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801725:	85 c0                	test   %eax,%eax
+  801727:	7f 6c                	jg     801795 <sys_page_map+0xad>
+}
+  801729:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80172c:	5b                   	pop    %ebx
+  80172d:	5e                   	pop    %esi
+  80172e:	5f                   	pop    %edi
+  80172f:	5d                   	pop    %ebp
+  801730:	c3                   	ret
+  801731:	b8 01 00 00 00       	mov    $0x1,%eax
+  801736:	0f a2                	cpuid
+		return 0;
+  801738:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80173d:	f6 c6 08             	test   $0x8,%dh
+  801740:	74 15                	je     801757 <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801742:	89 c2                	mov    %eax,%edx
+  801744:	c1 ea 08             	shr    $0x8,%edx
+  801747:	83 e2 0f             	and    $0xf,%edx
+  80174a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80174f:	83 fa 06             	cmp    $0x6,%edx
+  801752:	74 0e                	je     801762 <sys_page_map+0x7a>
+  801754:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801757:	0f b6 c9             	movzbl %cl,%ecx
+  80175a:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801760:	eb 98                	jmp    8016fa <sys_page_map+0x12>
+  801762:	89 c2                	mov    %eax,%edx
+  801764:	c1 ea 04             	shr    $0x4,%edx
+  801767:	83 e2 0f             	and    $0xf,%edx
+  80176a:	83 fa 02             	cmp    $0x2,%edx
+  80176d:	77 e5                	ja     801754 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  80176f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801772:	83 f8 02             	cmp    $0x2,%eax
+  801775:	0f 97 c1             	seta   %cl
+  801778:	0f b6 c9             	movzbl %cl,%ecx
+  80177b:	eb d7                	jmp    801754 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  80177d:	b8 05 00 00 00       	mov    $0x5,%eax
+  801782:	8b 55 08             	mov    0x8(%ebp),%edx
+  801785:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801788:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80178b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80178e:	8b 75 18             	mov    0x18(%ebp),%esi
+  801791:	cd 30                	int    $0x30
+  801793:	eb 90                	jmp    801725 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801795:	83 ec 0c             	sub    $0xc,%esp
+  801798:	50                   	push   %eax
+  801799:	6a 05                	push   $0x5
+  80179b:	68 19 36 80 00       	push   $0x803619
+  8017a0:	6a 4a                	push   $0x4a
+  8017a2:	68 36 36 80 00       	push   $0x803636
+  8017a7:	e8 3f ef ff ff       	call   8006eb <_panic>
+
+008017ac <sys_page_unmap>:
+{
+  8017ac:	55                   	push   %ebp
+  8017ad:	89 e5                	mov    %esp,%ebp
+  8017af:	57                   	push   %edi
+  8017b0:	56                   	push   %esi
+  8017b1:	53                   	push   %ebx
+  8017b2:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8017b5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8017bc:	78 37                	js     8017f5 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  8017be:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8017c5:	74 7a                	je     801841 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  8017c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017d2:	b8 06 00 00 00       	mov    $0x6,%eax
+  8017d7:	89 df                	mov    %ebx,%edi
+  8017d9:	89 de                	mov    %ebx,%esi
+  8017db:	55                   	push   %ebp
+  8017dc:	68 e5 17 80 00       	push   $0x8017e5
+  8017e1:	89 e5                	mov    %esp,%ebp
+  8017e3:	0f 34                	sysenter
+  8017e5:	83 c4 04             	add    $0x4,%esp
+  8017e8:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8017e9:	85 c0                	test   %eax,%eax
+  8017eb:	7f 6c                	jg     801859 <sys_page_unmap+0xad>
+}
+  8017ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017f0:	5b                   	pop    %ebx
+  8017f1:	5e                   	pop    %esi
+  8017f2:	5f                   	pop    %edi
+  8017f3:	5d                   	pop    %ebp
+  8017f4:	c3                   	ret
+  8017f5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8017fa:	0f a2                	cpuid
+		return 0;
+  8017fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801801:	f6 c6 08             	test   $0x8,%dh
+  801804:	74 15                	je     80181b <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801806:	89 c2                	mov    %eax,%edx
+  801808:	c1 ea 08             	shr    $0x8,%edx
+  80180b:	83 e2 0f             	and    $0xf,%edx
+  80180e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801813:	83 fa 06             	cmp    $0x6,%edx
+  801816:	74 0e                	je     801826 <sys_page_unmap+0x7a>
+  801818:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80181b:	0f b6 c9             	movzbl %cl,%ecx
+  80181e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801824:	eb 98                	jmp    8017be <sys_page_unmap+0x12>
+  801826:	89 c2                	mov    %eax,%edx
+  801828:	c1 ea 04             	shr    $0x4,%edx
+  80182b:	83 e2 0f             	and    $0xf,%edx
+  80182e:	83 fa 02             	cmp    $0x2,%edx
+  801831:	77 e5                	ja     801818 <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  801833:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801836:	83 f8 02             	cmp    $0x2,%eax
+  801839:	0f 97 c1             	seta   %cl
+  80183c:	0f b6 c9             	movzbl %cl,%ecx
+  80183f:	eb d7                	jmp    801818 <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  801841:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801846:	b8 06 00 00 00       	mov    $0x6,%eax
+  80184b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80184e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801851:	89 df                	mov    %ebx,%edi
+  801853:	89 de                	mov    %ebx,%esi
+  801855:	cd 30                	int    $0x30
+  801857:	eb 90                	jmp    8017e9 <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801859:	83 ec 0c             	sub    $0xc,%esp
+  80185c:	50                   	push   %eax
+  80185d:	6a 06                	push   $0x6
+  80185f:	68 19 36 80 00       	push   $0x803619
+  801864:	6a 4a                	push   $0x4a
+  801866:	68 36 36 80 00       	push   $0x803636
+  80186b:	e8 7b ee ff ff       	call   8006eb <_panic>
+
+00801870 <sys_page_copy>:
+{
+  801870:	55                   	push   %ebp
+  801871:	89 e5                	mov    %esp,%ebp
+  801873:	57                   	push   %edi
+  801874:	56                   	push   %esi
+  801875:	53                   	push   %ebx
+  801876:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801879:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801880:	78 37                	js     8018b9 <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  801882:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801889:	74 7a                	je     801905 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  80188b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80188e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801891:	b8 29 00 00 00       	mov    $0x29,%eax
+  801896:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801899:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80189c:	8b 75 18             	mov    0x18(%ebp),%esi
+  80189f:	55                   	push   %ebp
+  8018a0:	68 a9 18 80 00       	push   $0x8018a9
+  8018a5:	89 e5                	mov    %esp,%ebp
+  8018a7:	0f 34                	sysenter
+  8018a9:	83 c4 04             	add    $0x4,%esp
+  8018ac:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8018ad:	85 c0                	test   %eax,%eax
+  8018af:	7f 6c                	jg     80191d <sys_page_copy+0xad>
+}
+  8018b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018b4:	5b                   	pop    %ebx
+  8018b5:	5e                   	pop    %esi
+  8018b6:	5f                   	pop    %edi
+  8018b7:	5d                   	pop    %ebp
+  8018b8:	c3                   	ret
+  8018b9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018be:	0f a2                	cpuid
+		return 0;
+  8018c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018c5:	f6 c6 08             	test   $0x8,%dh
+  8018c8:	74 15                	je     8018df <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018ca:	89 c2                	mov    %eax,%edx
+  8018cc:	c1 ea 08             	shr    $0x8,%edx
+  8018cf:	83 e2 0f             	and    $0xf,%edx
+  8018d2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018d7:	83 fa 06             	cmp    $0x6,%edx
+  8018da:	74 0e                	je     8018ea <sys_page_copy+0x7a>
+  8018dc:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8018df:	0f b6 c9             	movzbl %cl,%ecx
+  8018e2:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8018e8:	eb 98                	jmp    801882 <sys_page_copy+0x12>
+  8018ea:	89 c2                	mov    %eax,%edx
+  8018ec:	c1 ea 04             	shr    $0x4,%edx
+  8018ef:	83 e2 0f             	and    $0xf,%edx
+  8018f2:	83 fa 02             	cmp    $0x2,%edx
+  8018f5:	77 e5                	ja     8018dc <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  8018f7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018fa:	83 f8 02             	cmp    $0x2,%eax
+  8018fd:	0f 97 c1             	seta   %cl
+  801900:	0f b6 c9             	movzbl %cl,%ecx
+  801903:	eb d7                	jmp    8018dc <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  801905:	b8 29 00 00 00       	mov    $0x29,%eax
+  80190a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80190d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801910:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801913:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801916:	8b 75 18             	mov    0x18(%ebp),%esi
+  801919:	cd 30                	int    $0x30
+  80191b:	eb 90                	jmp    8018ad <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80191d:	83 ec 0c             	sub    $0xc,%esp
+  801920:	50                   	push   %eax
+  801921:	6a 29                	push   $0x29
+  801923:	68 19 36 80 00       	push   $0x803619
+  801928:	6a 4a                	push   $0x4a
+  80192a:	68 36 36 80 00       	push   $0x803636
+  80192f:	e8 b7 ed ff ff       	call   8006eb <_panic>
+
+00801934 <sys_yield>:
+{
+  801934:	55                   	push   %ebp
+  801935:	89 e5                	mov    %esp,%ebp
+  801937:	57                   	push   %edi
+  801938:	56                   	push   %esi
+  801939:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80193a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801941:	78 2e                	js     801971 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  801943:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80194a:	74 71                	je     8019bd <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  80194c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801951:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801956:	89 d1                	mov    %edx,%ecx
+  801958:	89 d3                	mov    %edx,%ebx
+  80195a:	89 d7                	mov    %edx,%edi
+  80195c:	89 d6                	mov    %edx,%esi
+  80195e:	55                   	push   %ebp
+  80195f:	68 68 19 80 00       	push   $0x801968
+  801964:	89 e5                	mov    %esp,%ebp
+  801966:	0f 34                	sysenter
+  801968:	83 c4 04             	add    $0x4,%esp
+  80196b:	5d                   	pop    %ebp
+}
+  80196c:	5b                   	pop    %ebx
+  80196d:	5e                   	pop    %esi
+  80196e:	5f                   	pop    %edi
+  80196f:	5d                   	pop    %ebp
+  801970:	c3                   	ret
+  801971:	b8 01 00 00 00       	mov    $0x1,%eax
+  801976:	0f a2                	cpuid
+		return 0;
+  801978:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80197d:	f6 c6 08             	test   $0x8,%dh
+  801980:	74 15                	je     801997 <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801982:	89 c2                	mov    %eax,%edx
+  801984:	c1 ea 08             	shr    $0x8,%edx
+  801987:	83 e2 0f             	and    $0xf,%edx
+  80198a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80198f:	83 fa 06             	cmp    $0x6,%edx
+  801992:	74 0e                	je     8019a2 <sys_yield+0x6e>
+  801994:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801997:	0f b6 c9             	movzbl %cl,%ecx
+  80199a:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8019a0:	eb a1                	jmp    801943 <sys_yield+0xf>
+  8019a2:	89 c2                	mov    %eax,%edx
+  8019a4:	c1 ea 04             	shr    $0x4,%edx
+  8019a7:	83 e2 0f             	and    $0xf,%edx
+  8019aa:	83 fa 02             	cmp    $0x2,%edx
+  8019ad:	77 e5                	ja     801994 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  8019af:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019b2:	83 f8 02             	cmp    $0x2,%eax
+  8019b5:	0f 97 c1             	seta   %cl
+  8019b8:	0f b6 c9             	movzbl %cl,%ecx
+  8019bb:	eb d7                	jmp    801994 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  8019bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019c2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8019c7:	89 d1                	mov    %edx,%ecx
+  8019c9:	89 d3                	mov    %edx,%ebx
+  8019cb:	89 d7                	mov    %edx,%edi
+  8019cd:	89 d6                	mov    %edx,%esi
+  8019cf:	cd 30                	int    $0x30
+}
+  8019d1:	eb 99                	jmp    80196c <sys_yield+0x38>
+
+008019d3 <sys_env_set_status>:
+{
+  8019d3:	55                   	push   %ebp
+  8019d4:	89 e5                	mov    %esp,%ebp
+  8019d6:	57                   	push   %edi
+  8019d7:	56                   	push   %esi
+  8019d8:	53                   	push   %ebx
+  8019d9:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8019dc:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8019e3:	78 37                	js     801a1c <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  8019e5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8019ec:	74 7a                	je     801a68 <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  8019ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019f9:	b8 08 00 00 00       	mov    $0x8,%eax
+  8019fe:	89 df                	mov    %ebx,%edi
+  801a00:	89 de                	mov    %ebx,%esi
+  801a02:	55                   	push   %ebp
+  801a03:	68 0c 1a 80 00       	push   $0x801a0c
+  801a08:	89 e5                	mov    %esp,%ebp
+  801a0a:	0f 34                	sysenter
+  801a0c:	83 c4 04             	add    $0x4,%esp
+  801a0f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801a10:	85 c0                	test   %eax,%eax
+  801a12:	7f 6c                	jg     801a80 <sys_env_set_status+0xad>
+}
+  801a14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a17:	5b                   	pop    %ebx
+  801a18:	5e                   	pop    %esi
+  801a19:	5f                   	pop    %edi
+  801a1a:	5d                   	pop    %ebp
+  801a1b:	c3                   	ret
+  801a1c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a21:	0f a2                	cpuid
+		return 0;
+  801a23:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801a28:	f6 c6 08             	test   $0x8,%dh
+  801a2b:	74 15                	je     801a42 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a2d:	89 c2                	mov    %eax,%edx
+  801a2f:	c1 ea 08             	shr    $0x8,%edx
+  801a32:	83 e2 0f             	and    $0xf,%edx
+  801a35:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a3a:	83 fa 06             	cmp    $0x6,%edx
+  801a3d:	74 0e                	je     801a4d <sys_env_set_status+0x7a>
+  801a3f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a42:	0f b6 c9             	movzbl %cl,%ecx
+  801a45:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801a4b:	eb 98                	jmp    8019e5 <sys_env_set_status+0x12>
+  801a4d:	89 c2                	mov    %eax,%edx
+  801a4f:	c1 ea 04             	shr    $0x4,%edx
+  801a52:	83 e2 0f             	and    $0xf,%edx
+  801a55:	83 fa 02             	cmp    $0x2,%edx
+  801a58:	77 e5                	ja     801a3f <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  801a5a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a5d:	83 f8 02             	cmp    $0x2,%eax
+  801a60:	0f 97 c1             	seta   %cl
+  801a63:	0f b6 c9             	movzbl %cl,%ecx
+  801a66:	eb d7                	jmp    801a3f <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  801a68:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a6d:	b8 08 00 00 00       	mov    $0x8,%eax
+  801a72:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a75:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a78:	89 df                	mov    %ebx,%edi
+  801a7a:	89 de                	mov    %ebx,%esi
+  801a7c:	cd 30                	int    $0x30
+  801a7e:	eb 90                	jmp    801a10 <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a80:	83 ec 0c             	sub    $0xc,%esp
+  801a83:	50                   	push   %eax
+  801a84:	6a 08                	push   $0x8
+  801a86:	68 19 36 80 00       	push   $0x803619
+  801a8b:	6a 4a                	push   $0x4a
+  801a8d:	68 36 36 80 00       	push   $0x803636
+  801a92:	e8 54 ec ff ff       	call   8006eb <_panic>
+
+00801a97 <sys_sysinfo>:
+{
+  801a97:	55                   	push   %ebp
+  801a98:	89 e5                	mov    %esp,%ebp
+  801a9a:	57                   	push   %edi
+  801a9b:	56                   	push   %esi
+  801a9c:	53                   	push   %ebx
+  801a9d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801aa0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801aa7:	78 36                	js     801adf <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  801aa9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ab0:	74 79                	je     801b2b <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  801ab2:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ab5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801aba:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801abf:	89 cb                	mov    %ecx,%ebx
+  801ac1:	89 cf                	mov    %ecx,%edi
+  801ac3:	89 ce                	mov    %ecx,%esi
+  801ac5:	55                   	push   %ebp
+  801ac6:	68 cf 1a 80 00       	push   $0x801acf
+  801acb:	89 e5                	mov    %esp,%ebp
+  801acd:	0f 34                	sysenter
+  801acf:	83 c4 04             	add    $0x4,%esp
+  801ad2:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801ad3:	85 c0                	test   %eax,%eax
+  801ad5:	7f 6b                	jg     801b42 <sys_sysinfo+0xab>
+}
+  801ad7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ada:	5b                   	pop    %ebx
+  801adb:	5e                   	pop    %esi
+  801adc:	5f                   	pop    %edi
+  801add:	5d                   	pop    %ebp
+  801ade:	c3                   	ret
+  801adf:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ae4:	0f a2                	cpuid
+		return 0;
+  801ae6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801aeb:	f6 c6 08             	test   $0x8,%dh
+  801aee:	74 15                	je     801b05 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801af0:	89 c2                	mov    %eax,%edx
+  801af2:	c1 ea 08             	shr    $0x8,%edx
+  801af5:	83 e2 0f             	and    $0xf,%edx
+  801af8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801afd:	83 fa 06             	cmp    $0x6,%edx
+  801b00:	74 0e                	je     801b10 <sys_sysinfo+0x79>
+  801b02:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b05:	0f b6 c9             	movzbl %cl,%ecx
+  801b08:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801b0e:	eb 99                	jmp    801aa9 <sys_sysinfo+0x12>
+  801b10:	89 c2                	mov    %eax,%edx
+  801b12:	c1 ea 04             	shr    $0x4,%edx
+  801b15:	83 e2 0f             	and    $0xf,%edx
+  801b18:	83 fa 02             	cmp    $0x2,%edx
+  801b1b:	77 e5                	ja     801b02 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  801b1d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b20:	83 f8 02             	cmp    $0x2,%eax
+  801b23:	0f 97 c1             	seta   %cl
+  801b26:	0f b6 c9             	movzbl %cl,%ecx
+  801b29:	eb d7                	jmp    801b02 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  801b2b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b30:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801b35:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b38:	89 cb                	mov    %ecx,%ebx
+  801b3a:	89 cf                	mov    %ecx,%edi
+  801b3c:	89 ce                	mov    %ecx,%esi
+  801b3e:	cd 30                	int    $0x30
+  801b40:	eb 91                	jmp    801ad3 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801b42:	83 ec 0c             	sub    $0xc,%esp
+  801b45:	50                   	push   %eax
+  801b46:	6a 0b                	push   $0xb
+  801b48:	68 19 36 80 00       	push   $0x803619
+  801b4d:	6a 4a                	push   $0x4a
+  801b4f:	68 36 36 80 00       	push   $0x803636
+  801b54:	e8 92 eb ff ff       	call   8006eb <_panic>
+
+00801b59 <sys_env_set_trapframe>:
+{
+  801b59:	55                   	push   %ebp
+  801b5a:	89 e5                	mov    %esp,%ebp
+  801b5c:	57                   	push   %edi
+  801b5d:	56                   	push   %esi
+  801b5e:	53                   	push   %ebx
+  801b5f:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801b62:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b69:	78 37                	js     801ba2 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  801b6b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b72:	74 7a                	je     801bee <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  801b74:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b79:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b7c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b7f:	b8 13 00 00 00       	mov    $0x13,%eax
+  801b84:	89 df                	mov    %ebx,%edi
+  801b86:	89 de                	mov    %ebx,%esi
+  801b88:	55                   	push   %ebp
+  801b89:	68 92 1b 80 00       	push   $0x801b92
+  801b8e:	89 e5                	mov    %esp,%ebp
+  801b90:	0f 34                	sysenter
+  801b92:	83 c4 04             	add    $0x4,%esp
+  801b95:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801b96:	85 c0                	test   %eax,%eax
+  801b98:	7f 6c                	jg     801c06 <sys_env_set_trapframe+0xad>
+}
+  801b9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b9d:	5b                   	pop    %ebx
+  801b9e:	5e                   	pop    %esi
+  801b9f:	5f                   	pop    %edi
+  801ba0:	5d                   	pop    %ebp
+  801ba1:	c3                   	ret
+  801ba2:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ba7:	0f a2                	cpuid
+		return 0;
+  801ba9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801bae:	f6 c6 08             	test   $0x8,%dh
+  801bb1:	74 15                	je     801bc8 <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bb3:	89 c2                	mov    %eax,%edx
+  801bb5:	c1 ea 08             	shr    $0x8,%edx
+  801bb8:	83 e2 0f             	and    $0xf,%edx
+  801bbb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801bc0:	83 fa 06             	cmp    $0x6,%edx
+  801bc3:	74 0e                	je     801bd3 <sys_env_set_trapframe+0x7a>
+  801bc5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801bc8:	0f b6 c9             	movzbl %cl,%ecx
+  801bcb:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801bd1:	eb 98                	jmp    801b6b <sys_env_set_trapframe+0x12>
+  801bd3:	89 c2                	mov    %eax,%edx
+  801bd5:	c1 ea 04             	shr    $0x4,%edx
+  801bd8:	83 e2 0f             	and    $0xf,%edx
+  801bdb:	83 fa 02             	cmp    $0x2,%edx
+  801bde:	77 e5                	ja     801bc5 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  801be0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801be3:	83 f8 02             	cmp    $0x2,%eax
+  801be6:	0f 97 c1             	seta   %cl
+  801be9:	0f b6 c9             	movzbl %cl,%ecx
+  801bec:	eb d7                	jmp    801bc5 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  801bee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bf3:	b8 13 00 00 00       	mov    $0x13,%eax
+  801bf8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bfb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bfe:	89 df                	mov    %ebx,%edi
+  801c00:	89 de                	mov    %ebx,%esi
+  801c02:	cd 30                	int    $0x30
+  801c04:	eb 90                	jmp    801b96 <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801c06:	83 ec 0c             	sub    $0xc,%esp
+  801c09:	50                   	push   %eax
+  801c0a:	6a 13                	push   $0x13
+  801c0c:	68 19 36 80 00       	push   $0x803619
+  801c11:	6a 4a                	push   $0x4a
+  801c13:	68 36 36 80 00       	push   $0x803636
+  801c18:	e8 ce ea ff ff       	call   8006eb <_panic>
+
+00801c1d <sys_env_set_stack_limit>:
+{
+  801c1d:	55                   	push   %ebp
+  801c1e:	89 e5                	mov    %esp,%ebp
+  801c20:	57                   	push   %edi
+  801c21:	56                   	push   %esi
+  801c22:	53                   	push   %ebx
+  801c23:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801c26:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801c2d:	78 37                	js     801c66 <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  801c2f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801c36:	74 7a                	je     801cb2 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  801c38:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c3d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c40:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c43:	b8 19 00 00 00       	mov    $0x19,%eax
+  801c48:	89 df                	mov    %ebx,%edi
+  801c4a:	89 de                	mov    %ebx,%esi
+  801c4c:	55                   	push   %ebp
+  801c4d:	68 56 1c 80 00       	push   $0x801c56
+  801c52:	89 e5                	mov    %esp,%ebp
+  801c54:	0f 34                	sysenter
+  801c56:	83 c4 04             	add    $0x4,%esp
+  801c59:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801c5a:	85 c0                	test   %eax,%eax
+  801c5c:	7f 6c                	jg     801cca <sys_env_set_stack_limit+0xad>
+}
+  801c5e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c61:	5b                   	pop    %ebx
+  801c62:	5e                   	pop    %esi
+  801c63:	5f                   	pop    %edi
+  801c64:	5d                   	pop    %ebp
+  801c65:	c3                   	ret
+  801c66:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c6b:	0f a2                	cpuid
+		return 0;
+  801c6d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801c72:	f6 c6 08             	test   $0x8,%dh
+  801c75:	74 15                	je     801c8c <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c77:	89 c2                	mov    %eax,%edx
+  801c79:	c1 ea 08             	shr    $0x8,%edx
+  801c7c:	83 e2 0f             	and    $0xf,%edx
+  801c7f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801c84:	83 fa 06             	cmp    $0x6,%edx
+  801c87:	74 0e                	je     801c97 <sys_env_set_stack_limit+0x7a>
+  801c89:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801c8c:	0f b6 c9             	movzbl %cl,%ecx
+  801c8f:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801c95:	eb 98                	jmp    801c2f <sys_env_set_stack_limit+0x12>
+  801c97:	89 c2                	mov    %eax,%edx
+  801c99:	c1 ea 04             	shr    $0x4,%edx
+  801c9c:	83 e2 0f             	and    $0xf,%edx
+  801c9f:	83 fa 02             	cmp    $0x2,%edx
+  801ca2:	77 e5                	ja     801c89 <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  801ca4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ca7:	83 f8 02             	cmp    $0x2,%eax
+  801caa:	0f 97 c1             	seta   %cl
+  801cad:	0f b6 c9             	movzbl %cl,%ecx
+  801cb0:	eb d7                	jmp    801c89 <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  801cb2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cb7:	b8 19 00 00 00       	mov    $0x19,%eax
+  801cbc:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cbf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cc2:	89 df                	mov    %ebx,%edi
+  801cc4:	89 de                	mov    %ebx,%esi
+  801cc6:	cd 30                	int    $0x30
+  801cc8:	eb 90                	jmp    801c5a <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801cca:	83 ec 0c             	sub    $0xc,%esp
+  801ccd:	50                   	push   %eax
+  801cce:	6a 19                	push   $0x19
+  801cd0:	68 19 36 80 00       	push   $0x803619
+  801cd5:	6a 4a                	push   $0x4a
+  801cd7:	68 36 36 80 00       	push   $0x803636
+  801cdc:	e8 0a ea ff ff       	call   8006eb <_panic>
+
+00801ce1 <sys_env_set_pgfault_upcall>:
+{
+  801ce1:	55                   	push   %ebp
+  801ce2:	89 e5                	mov    %esp,%ebp
+  801ce4:	57                   	push   %edi
+  801ce5:	56                   	push   %esi
+  801ce6:	53                   	push   %ebx
+  801ce7:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801cea:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801cf1:	78 37                	js     801d2a <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  801cf3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801cfa:	74 7a                	je     801d76 <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  801cfc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d01:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d04:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d07:	b8 09 00 00 00       	mov    $0x9,%eax
+  801d0c:	89 df                	mov    %ebx,%edi
+  801d0e:	89 de                	mov    %ebx,%esi
+  801d10:	55                   	push   %ebp
+  801d11:	68 1a 1d 80 00       	push   $0x801d1a
+  801d16:	89 e5                	mov    %esp,%ebp
+  801d18:	0f 34                	sysenter
+  801d1a:	83 c4 04             	add    $0x4,%esp
+  801d1d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801d1e:	85 c0                	test   %eax,%eax
+  801d20:	7f 6c                	jg     801d8e <sys_env_set_pgfault_upcall+0xad>
+}
+  801d22:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d25:	5b                   	pop    %ebx
+  801d26:	5e                   	pop    %esi
+  801d27:	5f                   	pop    %edi
+  801d28:	5d                   	pop    %ebp
+  801d29:	c3                   	ret
+  801d2a:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d2f:	0f a2                	cpuid
+		return 0;
+  801d31:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801d36:	f6 c6 08             	test   $0x8,%dh
+  801d39:	74 15                	je     801d50 <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d3b:	89 c2                	mov    %eax,%edx
+  801d3d:	c1 ea 08             	shr    $0x8,%edx
+  801d40:	83 e2 0f             	and    $0xf,%edx
+  801d43:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d48:	83 fa 06             	cmp    $0x6,%edx
+  801d4b:	74 0e                	je     801d5b <sys_env_set_pgfault_upcall+0x7a>
+  801d4d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801d50:	0f b6 c9             	movzbl %cl,%ecx
+  801d53:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801d59:	eb 98                	jmp    801cf3 <sys_env_set_pgfault_upcall+0x12>
+  801d5b:	89 c2                	mov    %eax,%edx
+  801d5d:	c1 ea 04             	shr    $0x4,%edx
+  801d60:	83 e2 0f             	and    $0xf,%edx
+  801d63:	83 fa 02             	cmp    $0x2,%edx
+  801d66:	77 e5                	ja     801d4d <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  801d68:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d6b:	83 f8 02             	cmp    $0x2,%eax
+  801d6e:	0f 97 c1             	seta   %cl
+  801d71:	0f b6 c9             	movzbl %cl,%ecx
+  801d74:	eb d7                	jmp    801d4d <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  801d76:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d7b:	b8 09 00 00 00       	mov    $0x9,%eax
+  801d80:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d83:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d86:	89 df                	mov    %ebx,%edi
+  801d88:	89 de                	mov    %ebx,%esi
+  801d8a:	cd 30                	int    $0x30
+  801d8c:	eb 90                	jmp    801d1e <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801d8e:	83 ec 0c             	sub    $0xc,%esp
+  801d91:	50                   	push   %eax
+  801d92:	6a 09                	push   $0x9
+  801d94:	68 19 36 80 00       	push   $0x803619
+  801d99:	6a 4a                	push   $0x4a
+  801d9b:	68 36 36 80 00       	push   $0x803636
+  801da0:	e8 46 e9 ff ff       	call   8006eb <_panic>
+
+00801da5 <sys_ipc_try_send>:
+{
+  801da5:	55                   	push   %ebp
+  801da6:	89 e5                	mov    %esp,%ebp
+  801da8:	57                   	push   %edi
+  801da9:	56                   	push   %esi
+  801daa:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801dab:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801db2:	78 32                	js     801de6 <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  801db4:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801dbb:	74 75                	je     801e32 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801dbd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801dc0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801dc3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801dc8:	be 00 00 00 00       	mov    $0x0,%esi
+  801dcd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801dd0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801dd3:	55                   	push   %ebp
+  801dd4:	68 dd 1d 80 00       	push   $0x801ddd
+  801dd9:	89 e5                	mov    %esp,%ebp
+  801ddb:	0f 34                	sysenter
+  801ddd:	83 c4 04             	add    $0x4,%esp
+  801de0:	5d                   	pop    %ebp
+}
+  801de1:	5b                   	pop    %ebx
+  801de2:	5e                   	pop    %esi
+  801de3:	5f                   	pop    %edi
+  801de4:	5d                   	pop    %ebp
+  801de5:	c3                   	ret
+  801de6:	b8 01 00 00 00       	mov    $0x1,%eax
+  801deb:	0f a2                	cpuid
+		return 0;
+  801ded:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801df2:	f6 c6 08             	test   $0x8,%dh
+  801df5:	74 15                	je     801e0c <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801df7:	89 c2                	mov    %eax,%edx
+  801df9:	c1 ea 08             	shr    $0x8,%edx
+  801dfc:	83 e2 0f             	and    $0xf,%edx
+  801dff:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e04:	83 fa 06             	cmp    $0x6,%edx
+  801e07:	74 0e                	je     801e17 <sys_ipc_try_send+0x72>
+  801e09:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801e0c:	0f b6 c9             	movzbl %cl,%ecx
+  801e0f:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801e15:	eb 9d                	jmp    801db4 <sys_ipc_try_send+0xf>
+  801e17:	89 c2                	mov    %eax,%edx
+  801e19:	c1 ea 04             	shr    $0x4,%edx
+  801e1c:	83 e2 0f             	and    $0xf,%edx
+  801e1f:	83 fa 02             	cmp    $0x2,%edx
+  801e22:	77 e5                	ja     801e09 <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  801e24:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e27:	83 f8 02             	cmp    $0x2,%eax
+  801e2a:	0f 97 c1             	seta   %cl
+  801e2d:	0f b6 c9             	movzbl %cl,%ecx
+  801e30:	eb d7                	jmp    801e09 <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  801e32:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801e37:	be 00 00 00 00       	mov    $0x0,%esi
+  801e3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e3f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e42:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e45:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801e48:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801e4a:	eb 95                	jmp    801de1 <sys_ipc_try_send+0x3c>
+
+00801e4c <sys_ipc_send>:
+{
+  801e4c:	55                   	push   %ebp
+  801e4d:	89 e5                	mov    %esp,%ebp
+  801e4f:	57                   	push   %edi
+  801e50:	56                   	push   %esi
+  801e51:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801e52:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e59:	78 32                	js     801e8d <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  801e5b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e62:	74 75                	je     801ed9 <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801e64:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e6a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801e6f:	be 00 00 00 00       	mov    $0x0,%esi
+  801e74:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e77:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801e7a:	55                   	push   %ebp
+  801e7b:	68 84 1e 80 00       	push   $0x801e84
+  801e80:	89 e5                	mov    %esp,%ebp
+  801e82:	0f 34                	sysenter
+  801e84:	83 c4 04             	add    $0x4,%esp
+  801e87:	5d                   	pop    %ebp
+}
+  801e88:	5b                   	pop    %ebx
+  801e89:	5e                   	pop    %esi
+  801e8a:	5f                   	pop    %edi
+  801e8b:	5d                   	pop    %ebp
+  801e8c:	c3                   	ret
+  801e8d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e92:	0f a2                	cpuid
+		return 0;
+  801e94:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801e99:	f6 c6 08             	test   $0x8,%dh
+  801e9c:	74 15                	je     801eb3 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e9e:	89 c2                	mov    %eax,%edx
+  801ea0:	c1 ea 08             	shr    $0x8,%edx
+  801ea3:	83 e2 0f             	and    $0xf,%edx
+  801ea6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801eab:	83 fa 06             	cmp    $0x6,%edx
+  801eae:	74 0e                	je     801ebe <sys_ipc_send+0x72>
+  801eb0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801eb3:	0f b6 c9             	movzbl %cl,%ecx
+  801eb6:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801ebc:	eb 9d                	jmp    801e5b <sys_ipc_send+0xf>
+  801ebe:	89 c2                	mov    %eax,%edx
+  801ec0:	c1 ea 04             	shr    $0x4,%edx
+  801ec3:	83 e2 0f             	and    $0xf,%edx
+  801ec6:	83 fa 02             	cmp    $0x2,%edx
+  801ec9:	77 e5                	ja     801eb0 <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  801ecb:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ece:	83 f8 02             	cmp    $0x2,%eax
+  801ed1:	0f 97 c1             	seta   %cl
+  801ed4:	0f b6 c9             	movzbl %cl,%ecx
+  801ed7:	eb d7                	jmp    801eb0 <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  801ed9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801ede:	be 00 00 00 00       	mov    $0x0,%esi
+  801ee3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ee6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ee9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801eec:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801eef:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801ef1:	eb 95                	jmp    801e88 <sys_ipc_send+0x3c>
+
+00801ef3 <sys_ipc_recv>:
+{
+  801ef3:	55                   	push   %ebp
+  801ef4:	89 e5                	mov    %esp,%ebp
+  801ef6:	57                   	push   %edi
+  801ef7:	56                   	push   %esi
+  801ef8:	53                   	push   %ebx
+  801ef9:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801efc:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f03:	78 36                	js     801f3b <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  801f05:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f0c:	74 79                	je     801f87 <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  801f0e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f11:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f16:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801f1b:	89 cb                	mov    %ecx,%ebx
+  801f1d:	89 cf                	mov    %ecx,%edi
+  801f1f:	89 ce                	mov    %ecx,%esi
+  801f21:	55                   	push   %ebp
+  801f22:	68 2b 1f 80 00       	push   $0x801f2b
+  801f27:	89 e5                	mov    %esp,%ebp
+  801f29:	0f 34                	sysenter
+  801f2b:	83 c4 04             	add    $0x4,%esp
+  801f2e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801f2f:	85 c0                	test   %eax,%eax
+  801f31:	7f 6b                	jg     801f9e <sys_ipc_recv+0xab>
+}
+  801f33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f36:	5b                   	pop    %ebx
+  801f37:	5e                   	pop    %esi
+  801f38:	5f                   	pop    %edi
+  801f39:	5d                   	pop    %ebp
+  801f3a:	c3                   	ret
+  801f3b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f40:	0f a2                	cpuid
+		return 0;
+  801f42:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801f47:	f6 c6 08             	test   $0x8,%dh
+  801f4a:	74 15                	je     801f61 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f4c:	89 c2                	mov    %eax,%edx
+  801f4e:	c1 ea 08             	shr    $0x8,%edx
+  801f51:	83 e2 0f             	and    $0xf,%edx
+  801f54:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f59:	83 fa 06             	cmp    $0x6,%edx
+  801f5c:	74 0e                	je     801f6c <sys_ipc_recv+0x79>
+  801f5e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801f61:	0f b6 c9             	movzbl %cl,%ecx
+  801f64:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801f6a:	eb 99                	jmp    801f05 <sys_ipc_recv+0x12>
+  801f6c:	89 c2                	mov    %eax,%edx
+  801f6e:	c1 ea 04             	shr    $0x4,%edx
+  801f71:	83 e2 0f             	and    $0xf,%edx
+  801f74:	83 fa 02             	cmp    $0x2,%edx
+  801f77:	77 e5                	ja     801f5e <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  801f79:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f7c:	83 f8 02             	cmp    $0x2,%eax
+  801f7f:	0f 97 c1             	seta   %cl
+  801f82:	0f b6 c9             	movzbl %cl,%ecx
+  801f85:	eb d7                	jmp    801f5e <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  801f87:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f8c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801f91:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f94:	89 cb                	mov    %ecx,%ebx
+  801f96:	89 cf                	mov    %ecx,%edi
+  801f98:	89 ce                	mov    %ecx,%esi
+  801f9a:	cd 30                	int    $0x30
+  801f9c:	eb 91                	jmp    801f2f <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801f9e:	83 ec 0c             	sub    $0xc,%esp
+  801fa1:	50                   	push   %eax
+  801fa2:	6a 0d                	push   $0xd
+  801fa4:	68 19 36 80 00       	push   $0x803619
+  801fa9:	6a 4a                	push   $0x4a
+  801fab:	68 36 36 80 00       	push   $0x803636
+  801fb0:	e8 36 e7 ff ff       	call   8006eb <_panic>
+
+00801fb5 <sys_ipc_send_range>:
+{
+  801fb5:	55                   	push   %ebp
+  801fb6:	89 e5                	mov    %esp,%ebp
+  801fb8:	57                   	push   %edi
+  801fb9:	56                   	push   %esi
+  801fba:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801fbb:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801fc2:	78 30                	js     801ff4 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  801fc4:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801fcb:	74 73                	je     802040 <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801fcd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fd0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fd3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801fd8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801fdb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801fde:	8b 75 18             	mov    0x18(%ebp),%esi
+  801fe1:	55                   	push   %ebp
+  801fe2:	68 eb 1f 80 00       	push   $0x801feb
+  801fe7:	89 e5                	mov    %esp,%ebp
+  801fe9:	0f 34                	sysenter
+  801feb:	83 c4 04             	add    $0x4,%esp
+  801fee:	5d                   	pop    %ebp
+}
+  801fef:	5b                   	pop    %ebx
+  801ff0:	5e                   	pop    %esi
+  801ff1:	5f                   	pop    %edi
+  801ff2:	5d                   	pop    %ebp
+  801ff3:	c3                   	ret
+  801ff4:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ff9:	0f a2                	cpuid
+		return 0;
+  801ffb:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802000:	f6 c6 08             	test   $0x8,%dh
+  802003:	74 15                	je     80201a <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802005:	89 c2                	mov    %eax,%edx
+  802007:	c1 ea 08             	shr    $0x8,%edx
+  80200a:	83 e2 0f             	and    $0xf,%edx
+  80200d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802012:	83 fa 06             	cmp    $0x6,%edx
+  802015:	74 0e                	je     802025 <sys_ipc_send_range+0x70>
+  802017:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80201a:	0f b6 c9             	movzbl %cl,%ecx
+  80201d:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802023:	eb 9f                	jmp    801fc4 <sys_ipc_send_range+0xf>
+  802025:	89 c2                	mov    %eax,%edx
+  802027:	c1 ea 04             	shr    $0x4,%edx
+  80202a:	83 e2 0f             	and    $0xf,%edx
+  80202d:	83 fa 02             	cmp    $0x2,%edx
+  802030:	77 e5                	ja     802017 <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  802032:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802035:	83 f8 02             	cmp    $0x2,%eax
+  802038:	0f 97 c1             	seta   %cl
+  80203b:	0f b6 c9             	movzbl %cl,%ecx
+  80203e:	eb d7                	jmp    802017 <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  802040:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  802045:	8b 55 08             	mov    0x8(%ebp),%edx
+  802048:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80204b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80204e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802051:	8b 75 18             	mov    0x18(%ebp),%esi
+  802054:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  802056:	eb 97                	jmp    801fef <sys_ipc_send_range+0x3a>
+
+00802058 <sys_ipc_recv_range>:
+{
+  802058:	55                   	push   %ebp
+  802059:	89 e5                	mov    %esp,%ebp
+  80205b:	57                   	push   %edi
+  80205c:	56                   	push   %esi
+  80205d:	53                   	push   %ebx
+  80205e:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802061:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802068:	78 37                	js     8020a1 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  80206a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802071:	74 7a                	je     8020ed <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  802073:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802078:	8b 55 08             	mov    0x8(%ebp),%edx
+  80207b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80207e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  802083:	89 df                	mov    %ebx,%edi
+  802085:	89 de                	mov    %ebx,%esi
+  802087:	55                   	push   %ebp
+  802088:	68 91 20 80 00       	push   $0x802091
+  80208d:	89 e5                	mov    %esp,%ebp
+  80208f:	0f 34                	sysenter
+  802091:	83 c4 04             	add    $0x4,%esp
+  802094:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802095:	85 c0                	test   %eax,%eax
+  802097:	7f 6c                	jg     802105 <sys_ipc_recv_range+0xad>
+}
+  802099:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80209c:	5b                   	pop    %ebx
+  80209d:	5e                   	pop    %esi
+  80209e:	5f                   	pop    %edi
+  80209f:	5d                   	pop    %ebp
+  8020a0:	c3                   	ret
+  8020a1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020a6:	0f a2                	cpuid
+		return 0;
+  8020a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8020ad:	f6 c6 08             	test   $0x8,%dh
+  8020b0:	74 15                	je     8020c7 <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020b2:	89 c2                	mov    %eax,%edx
+  8020b4:	c1 ea 08             	shr    $0x8,%edx
+  8020b7:	83 e2 0f             	and    $0xf,%edx
+  8020ba:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8020bf:	83 fa 06             	cmp    $0x6,%edx
+  8020c2:	74 0e                	je     8020d2 <sys_ipc_recv_range+0x7a>
+  8020c4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8020c7:	0f b6 c9             	movzbl %cl,%ecx
+  8020ca:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8020d0:	eb 98                	jmp    80206a <sys_ipc_recv_range+0x12>
+  8020d2:	89 c2                	mov    %eax,%edx
+  8020d4:	c1 ea 04             	shr    $0x4,%edx
+  8020d7:	83 e2 0f             	and    $0xf,%edx
+  8020da:	83 fa 02             	cmp    $0x2,%edx
+  8020dd:	77 e5                	ja     8020c4 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  8020df:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020e2:	83 f8 02             	cmp    $0x2,%eax
+  8020e5:	0f 97 c1             	seta   %cl
+  8020e8:	0f b6 c9             	movzbl %cl,%ecx
+  8020eb:	eb d7                	jmp    8020c4 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  8020ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020f2:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8020f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020fd:	89 df                	mov    %ebx,%edi
+  8020ff:	89 de                	mov    %ebx,%esi
+  802101:	cd 30                	int    $0x30
+  802103:	eb 90                	jmp    802095 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802105:	83 ec 0c             	sub    $0xc,%esp
+  802108:	50                   	push   %eax
+  802109:	6a 1f                	push   $0x1f
+  80210b:	68 19 36 80 00       	push   $0x803619
+  802110:	6a 4a                	push   $0x4a
+  802112:	68 36 36 80 00       	push   $0x803636
+  802117:	e8 cf e5 ff ff       	call   8006eb <_panic>
+
+0080211c <sys_ipc_call>:
+{
+  80211c:	55                   	push   %ebp
+  80211d:	89 e5                	mov    %esp,%ebp
+  80211f:	57                   	push   %edi
+  802120:	56                   	push   %esi
+  802121:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  802122:	8b 55 08             	mov    0x8(%ebp),%edx
+  802125:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80212a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80212d:	55                   	push   %ebp
+  80212e:	56                   	push   %esi
+  80212f:	8b 0e                	mov    (%esi),%ecx
+  802131:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802134:	8b 7e 08             	mov    0x8(%esi),%edi
+  802137:	8b 6e 10             	mov    0x10(%esi),%ebp
+  80213a:	8b 76 0c             	mov    0xc(%esi),%esi
+  80213d:	cd 30                	int    $0x30
+  80213f:	87 34 24             	xchg   %esi,(%esp)
+  802142:	89 0e                	mov    %ecx,(%esi)
+  802144:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802147:	89 7e 08             	mov    %edi,0x8(%esi)
+  80214a:	89 6e 10             	mov    %ebp,0x10(%esi)
+  80214d:	8f 46 0c             	pop    0xc(%esi)
+  802150:	5d                   	pop    %ebp
+}
+  802151:	5b                   	pop    %ebx
+  802152:	5e                   	pop    %esi
+  802153:	5f                   	pop    %edi
+  802154:	5d                   	pop    %ebp
+  802155:	c3                   	ret
+
+00802156 <sys_ipc_reply_wait>:
+{
+  802156:	55                   	push   %ebp
+  802157:	89 e5                	mov    %esp,%ebp
+  802159:	57                   	push   %edi
+  80215a:	56                   	push   %esi
+  80215b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80215c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80215f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  802164:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802167:	55                   	push   %ebp
+  802168:	56                   	push   %esi
+  802169:	8b 0e                	mov    (%esi),%ecx
+  80216b:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80216e:	8b 7e 08             	mov    0x8(%esi),%edi
+  802171:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802174:	8b 76 0c             	mov    0xc(%esi),%esi
+  802177:	cd 30                	int    $0x30
+  802179:	87 34 24             	xchg   %esi,(%esp)
+  80217c:	89 0e                	mov    %ecx,(%esi)
+  80217e:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802181:	89 7e 08             	mov    %edi,0x8(%esi)
+  802184:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802187:	8f 46 0c             	pop    0xc(%esi)
+  80218a:	5d                   	pop    %ebp
+}
+  80218b:	5b                   	pop    %ebx
+  80218c:	5e                   	pop    %esi
+  80218d:	5f                   	pop    %edi
+  80218e:	5d                   	pop    %ebp
+  80218f:	c3                   	ret
+
+00802190 <sys_ipc_send_msg>:
+{
+  802190:	55                   	push   %ebp
+  802191:	89 e5                	mov    %esp,%ebp
+  802193:	57                   	push   %edi
+  802194:	56                   	push   %esi
+  802195:	53                   	push   %ebx
+  802196:	83 ec 20             	sub    $0x20,%esp
+  802199:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  80219c:	8b 10                	mov    (%eax),%edx
+  80219e:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8021a1:	8b 50 04             	mov    0x4(%eax),%edx
+  8021a4:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8021a7:	8b 50 08             	mov    0x8(%eax),%edx
+  8021aa:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  8021ad:	8b 50 0c             	mov    0xc(%eax),%edx
+  8021b0:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  8021b3:	8b 40 10             	mov    0x10(%eax),%eax
+  8021b6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  8021b9:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  8021bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021bf:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8021c4:	55                   	push   %ebp
+  8021c5:	56                   	push   %esi
+  8021c6:	8b 0e                	mov    (%esi),%ecx
+  8021c8:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8021cb:	8b 7e 08             	mov    0x8(%esi),%edi
+  8021ce:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8021d1:	8b 76 0c             	mov    0xc(%esi),%esi
+  8021d4:	cd 30                	int    $0x30
+  8021d6:	87 34 24             	xchg   %esi,(%esp)
+  8021d9:	89 0e                	mov    %ecx,(%esi)
+  8021db:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8021de:	89 7e 08             	mov    %edi,0x8(%esi)
+  8021e1:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8021e4:	8f 46 0c             	pop    0xc(%esi)
+  8021e7:	5d                   	pop    %ebp
+}
+  8021e8:	83 c4 20             	add    $0x20,%esp
+  8021eb:	5b                   	pop    %ebx
+  8021ec:	5e                   	pop    %esi
+  8021ed:	5f                   	pop    %edi
+  8021ee:	5d                   	pop    %ebp
+  8021ef:	c3                   	ret
+
+008021f0 <sys_fork>:
+{
+  8021f0:	55                   	push   %ebp
+  8021f1:	89 e5                	mov    %esp,%ebp
+  8021f3:	57                   	push   %edi
+  8021f4:	56                   	push   %esi
+  8021f5:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8021f6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8021fd:	78 2e                	js     80222d <sys_fork+0x3d>
+	if (syscall_sysenter)
+  8021ff:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802206:	74 71                	je     802279 <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  802208:	ba 00 00 00 00       	mov    $0x0,%edx
+  80220d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802212:	89 d1                	mov    %edx,%ecx
+  802214:	89 d3                	mov    %edx,%ebx
+  802216:	89 d7                	mov    %edx,%edi
+  802218:	89 d6                	mov    %edx,%esi
+  80221a:	55                   	push   %ebp
+  80221b:	68 24 22 80 00       	push   $0x802224
+  802220:	89 e5                	mov    %esp,%ebp
+  802222:	0f 34                	sysenter
+  802224:	83 c4 04             	add    $0x4,%esp
+  802227:	5d                   	pop    %ebp
+}
+  802228:	5b                   	pop    %ebx
+  802229:	5e                   	pop    %esi
+  80222a:	5f                   	pop    %edi
+  80222b:	5d                   	pop    %ebp
+  80222c:	c3                   	ret
+  80222d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802232:	0f a2                	cpuid
+		return 0;
+  802234:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802239:	f6 c6 08             	test   $0x8,%dh
+  80223c:	74 15                	je     802253 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80223e:	89 c2                	mov    %eax,%edx
+  802240:	c1 ea 08             	shr    $0x8,%edx
+  802243:	83 e2 0f             	and    $0xf,%edx
+  802246:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80224b:	83 fa 06             	cmp    $0x6,%edx
+  80224e:	74 0e                	je     80225e <sys_fork+0x6e>
+  802250:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802253:	0f b6 c9             	movzbl %cl,%ecx
+  802256:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80225c:	eb a1                	jmp    8021ff <sys_fork+0xf>
+  80225e:	89 c2                	mov    %eax,%edx
+  802260:	c1 ea 04             	shr    $0x4,%edx
+  802263:	83 e2 0f             	and    $0xf,%edx
+  802266:	83 fa 02             	cmp    $0x2,%edx
+  802269:	77 e5                	ja     802250 <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  80226b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80226e:	83 f8 02             	cmp    $0x2,%eax
+  802271:	0f 97 c1             	seta   %cl
+  802274:	0f b6 c9             	movzbl %cl,%ecx
+  802277:	eb d7                	jmp    802250 <sys_fork+0x60>
+		asm volatile("int %1\n"
+  802279:	ba 00 00 00 00       	mov    $0x0,%edx
+  80227e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802283:	89 d1                	mov    %edx,%ecx
+  802285:	89 d3                	mov    %edx,%ebx
+  802287:	89 d7                	mov    %edx,%edi
+  802289:	89 d6                	mov    %edx,%esi
+  80228b:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  80228d:	eb 99                	jmp    802228 <sys_fork+0x38>
+
+0080228f <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  80228f:	55                   	push   %ebp
+  802290:	89 e5                	mov    %esp,%ebp
+  802292:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  802295:	ff 75 14             	push   0x14(%ebp)
+  802298:	ff 75 10             	push   0x10(%ebp)
+  80229b:	ff 75 0c             	push   0xc(%ebp)
+  80229e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022a6:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8022ab:	e8 81 ee ff ff       	call   801131 <page_vec_call>
+}
+  8022b0:	c9                   	leave
+  8022b1:	c3                   	ret
+
+008022b2 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  8022b2:	55                   	push   %ebp
+  8022b3:	89 e5                	mov    %esp,%ebp
+  8022b5:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  8022b8:	ff 75 18             	push   0x18(%ebp)
+  8022bb:	ff 75 14             	push   0x14(%ebp)
+  8022be:	ff 75 10             	push   0x10(%ebp)
+  8022c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022c7:	b8 10 00 00 00       	mov    $0x10,%eax
+  8022cc:	e8 60 ee ff ff       	call   801131 <page_vec_call>
+}
+  8022d1:	c9                   	leave
+  8022d2:	c3                   	ret
+
+008022d3 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  8022d3:	55                   	push   %ebp
+  8022d4:	89 e5                	mov    %esp,%ebp
+  8022d6:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  8022d9:	ff 75 14             	push   0x14(%ebp)
+  8022dc:	ff 75 10             	push   0x10(%ebp)
+  8022df:	ff 75 0c             	push   0xc(%ebp)
+  8022e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022ea:	b8 11 00 00 00       	mov    $0x11,%eax
+  8022ef:	e8 3d ee ff ff       	call   801131 <page_vec_call>
+}
+  8022f4:	c9                   	leave
+  8022f5:	c3                   	ret
+
+008022f6 <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  8022f6:	55                   	push   %ebp
+  8022f7:	89 e5                	mov    %esp,%ebp
+  8022f9:	57                   	push   %edi
+  8022fa:	56                   	push   %esi
+  8022fb:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8022fc:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802303:	78 32                	js     802337 <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  802305:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80230c:	74 75                	je     802383 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  80230e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802311:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802314:	b8 12 00 00 00       	mov    $0x12,%eax
+  802319:	be 00 00 00 00       	mov    $0x0,%esi
+  80231e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802321:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802324:	55                   	push   %ebp
+  802325:	68 2e 23 80 00       	push   $0x80232e
+  80232a:	89 e5                	mov    %esp,%ebp
+  80232c:	0f 34                	sysenter
+  80232e:	83 c4 04             	add    $0x4,%esp
+  802331:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  802332:	5b                   	pop    %ebx
+  802333:	5e                   	pop    %esi
+  802334:	5f                   	pop    %edi
+  802335:	5d                   	pop    %ebp
+  802336:	c3                   	ret
+  802337:	b8 01 00 00 00       	mov    $0x1,%eax
+  80233c:	0f a2                	cpuid
+		return 0;
+  80233e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802343:	f6 c6 08             	test   $0x8,%dh
+  802346:	74 15                	je     80235d <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802348:	89 c2                	mov    %eax,%edx
+  80234a:	c1 ea 08             	shr    $0x8,%edx
+  80234d:	83 e2 0f             	and    $0xf,%edx
+  802350:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802355:	83 fa 06             	cmp    $0x6,%edx
+  802358:	74 0e                	je     802368 <sys_vm_ranges+0x72>
+  80235a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80235d:	0f b6 c9             	movzbl %cl,%ecx
+  802360:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802366:	eb 9d                	jmp    802305 <sys_vm_ranges+0xf>
+  802368:	89 c2                	mov    %eax,%edx
+  80236a:	c1 ea 04             	shr    $0x4,%edx
+  80236d:	83 e2 0f             	and    $0xf,%edx
+  802370:	83 fa 02             	cmp    $0x2,%edx
+  802373:	77 e5                	ja     80235a <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  802375:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802378:	83 f8 02             	cmp    $0x2,%eax
+  80237b:	0f 97 c1             	seta   %cl
+  80237e:	0f b6 c9             	movzbl %cl,%ecx
+  802381:	eb d7                	jmp    80235a <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  802383:	b8 12 00 00 00       	mov    $0x12,%eax
+  802388:	be 00 00 00 00       	mov    $0x0,%esi
+  80238d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802390:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802393:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802396:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802399:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  80239b:	eb 95                	jmp    802332 <sys_vm_ranges+0x3c>
+
+0080239d <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  80239d:	55                   	push   %ebp
+  80239e:	89 e5                	mov    %esp,%ebp
+  8023a0:	57                   	push   %edi
+  8023a1:	56                   	push   %esi
+  8023a2:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8023a3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8023aa:	78 31                	js     8023dd <sys_spawn+0x40>
+	if (syscall_sysenter)
+  8023ac:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8023b3:	74 74                	je     802429 <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  8023b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8023ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023c0:	b8 14 00 00 00       	mov    $0x14,%eax
+  8023c5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8023c8:	89 f7                	mov    %esi,%edi
+  8023ca:	55                   	push   %ebp
+  8023cb:	68 d4 23 80 00       	push   $0x8023d4
+  8023d0:	89 e5                	mov    %esp,%ebp
+  8023d2:	0f 34                	sysenter
+  8023d4:	83 c4 04             	add    $0x4,%esp
+  8023d7:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  8023d8:	5b                   	pop    %ebx
+  8023d9:	5e                   	pop    %esi
+  8023da:	5f                   	pop    %edi
+  8023db:	5d                   	pop    %ebp
+  8023dc:	c3                   	ret
+  8023dd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023e2:	0f a2                	cpuid
+		return 0;
+  8023e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8023e9:	f6 c6 08             	test   $0x8,%dh
+  8023ec:	74 15                	je     802403 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023ee:	89 c2                	mov    %eax,%edx
+  8023f0:	c1 ea 08             	shr    $0x8,%edx
+  8023f3:	83 e2 0f             	and    $0xf,%edx
+  8023f6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8023fb:	83 fa 06             	cmp    $0x6,%edx
+  8023fe:	74 0e                	je     80240e <sys_spawn+0x71>
+  802400:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802403:	0f b6 c9             	movzbl %cl,%ecx
+  802406:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80240c:	eb 9e                	jmp    8023ac <sys_spawn+0xf>
+  80240e:	89 c2                	mov    %eax,%edx
+  802410:	c1 ea 04             	shr    $0x4,%edx
+  802413:	83 e2 0f             	and    $0xf,%edx
+  802416:	83 fa 02             	cmp    $0x2,%edx
+  802419:	77 e5                	ja     802400 <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  80241b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80241e:	83 f8 02             	cmp    $0x2,%eax
+  802421:	0f 97 c1             	seta   %cl
+  802424:	0f b6 c9             	movzbl %cl,%ecx
+  802427:	eb d7                	jmp    802400 <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  802429:	be 00 00 00 00       	mov    $0x0,%esi
+  80242e:	b8 14 00 00 00       	mov    $0x14,%eax
+  802433:	8b 55 08             	mov    0x8(%ebp),%edx
+  802436:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802439:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80243c:	89 f7                	mov    %esi,%edi
+  80243e:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  802440:	eb 96                	jmp    8023d8 <sys_spawn+0x3b>
+
+00802442 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  802442:	55                   	push   %ebp
+  802443:	89 e5                	mov    %esp,%ebp
+  802445:	57                   	push   %edi
+  802446:	56                   	push   %esi
+  802447:	53                   	push   %ebx
+  802448:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80244b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802452:	78 37                	js     80248b <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  802454:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80245b:	74 7a                	je     8024d7 <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  80245d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802462:	8b 55 08             	mov    0x8(%ebp),%edx
+  802465:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802468:	b8 15 00 00 00       	mov    $0x15,%eax
+  80246d:	89 df                	mov    %ebx,%edi
+  80246f:	89 de                	mov    %ebx,%esi
+  802471:	55                   	push   %ebp
+  802472:	68 7b 24 80 00       	push   $0x80247b
+  802477:	89 e5                	mov    %esp,%ebp
+  802479:	0f 34                	sysenter
+  80247b:	83 c4 04             	add    $0x4,%esp
+  80247e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80247f:	85 c0                	test   %eax,%eax
+  802481:	7f 6c                	jg     8024ef <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  802483:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802486:	5b                   	pop    %ebx
+  802487:	5e                   	pop    %esi
+  802488:	5f                   	pop    %edi
+  802489:	5d                   	pop    %ebp
+  80248a:	c3                   	ret
+  80248b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802490:	0f a2                	cpuid
+		return 0;
+  802492:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802497:	f6 c6 08             	test   $0x8,%dh
+  80249a:	74 15                	je     8024b1 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80249c:	89 c2                	mov    %eax,%edx
+  80249e:	c1 ea 08             	shr    $0x8,%edx
+  8024a1:	83 e2 0f             	and    $0xf,%edx
+  8024a4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8024a9:	83 fa 06             	cmp    $0x6,%edx
+  8024ac:	74 0e                	je     8024bc <sys_shm_create+0x7a>
+  8024ae:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8024b1:	0f b6 c9             	movzbl %cl,%ecx
+  8024b4:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8024ba:	eb 98                	jmp    802454 <sys_shm_create+0x12>
+  8024bc:	89 c2                	mov    %eax,%edx
+  8024be:	c1 ea 04             	shr    $0x4,%edx
+  8024c1:	83 e2 0f             	and    $0xf,%edx
+  8024c4:	83 fa 02             	cmp    $0x2,%edx
+  8024c7:	77 e5                	ja     8024ae <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  8024c9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8024cc:	83 f8 02             	cmp    $0x2,%eax
+  8024cf:	0f 97 c1             	seta   %cl
+  8024d2:	0f b6 c9             	movzbl %cl,%ecx
+  8024d5:	eb d7                	jmp    8024ae <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  8024d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024dc:	b8 15 00 00 00       	mov    $0x15,%eax
+  8024e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024e7:	89 df                	mov    %ebx,%edi
+  8024e9:	89 de                	mov    %ebx,%esi
+  8024eb:	cd 30                	int    $0x30
+  8024ed:	eb 90                	jmp    80247f <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8024ef:	83 ec 0c             	sub    $0xc,%esp
+  8024f2:	50                   	push   %eax
+  8024f3:	6a 15                	push   $0x15
+  8024f5:	68 19 36 80 00       	push   $0x803619
+  8024fa:	6a 4a                	push   $0x4a
+  8024fc:	68 36 36 80 00       	push   $0x803636
+  802501:	e8 e5 e1 ff ff       	call   8006eb <_panic>
+
+00802506 <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  802506:	55                   	push   %ebp
+  802507:	89 e5                	mov    %esp,%ebp
+  802509:	57                   	push   %edi
+  80250a:	56                   	push   %esi
+  80250b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80250c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802513:	78 32                	js     802547 <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  802515:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80251c:	74 75                	je     802593 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  80251e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802521:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802524:	b8 16 00 00 00       	mov    $0x16,%eax
+  802529:	be 00 00 00 00       	mov    $0x0,%esi
+  80252e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802531:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802534:	55                   	push   %ebp
+  802535:	68 3e 25 80 00       	push   $0x80253e
+  80253a:	89 e5                	mov    %esp,%ebp
+  80253c:	0f 34                	sysenter
+  80253e:	83 c4 04             	add    $0x4,%esp
+  802541:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  802542:	5b                   	pop    %ebx
+  802543:	5e                   	pop    %esi
+  802544:	5f                   	pop    %edi
+  802545:	5d                   	pop    %ebp
+  802546:	c3                   	ret
+  802547:	b8 01 00 00 00       	mov    $0x1,%eax
+  80254c:	0f a2                	cpuid
+		return 0;
+  80254e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802553:	f6 c6 08             	test   $0x8,%dh
+  802556:	74 15                	je     80256d <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802558:	89 c2                	mov    %eax,%edx
+  80255a:	c1 ea 08             	shr    $0x8,%edx
+  80255d:	83 e2 0f             	and    $0xf,%edx
+  802560:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802565:	83 fa 06             	cmp    $0x6,%edx
+  802568:	74 0e                	je     802578 <sys_shm_attach+0x72>
+  80256a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80256d:	0f b6 c9             	movzbl %cl,%ecx
+  802570:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802576:	eb 9d                	jmp    802515 <sys_shm_attach+0xf>
+  802578:	89 c2                	mov    %eax,%edx
+  80257a:	c1 ea 04             	shr    $0x4,%edx
+  80257d:	83 e2 0f             	and    $0xf,%edx
+  802580:	83 fa 02             	cmp    $0x2,%edx
+  802583:	77 e5                	ja     80256a <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  802585:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802588:	83 f8 02             	cmp    $0x2,%eax
+  80258b:	0f 97 c1             	seta   %cl
+  80258e:	0f b6 c9             	movzbl %cl,%ecx
+  802591:	eb d7                	jmp    80256a <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  802593:	b8 16 00 00 00       	mov    $0x16,%eax
+  802598:	be 00 00 00 00       	mov    $0x0,%esi
+  80259d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025a3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8025a6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8025a9:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  8025ab:	eb 95                	jmp    802542 <sys_shm_attach+0x3c>
+
+008025ad <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  8025ad:	55                   	push   %ebp
+  8025ae:	89 e5                	mov    %esp,%ebp
+  8025b0:	57                   	push   %edi
+  8025b1:	56                   	push   %esi
+  8025b2:	53                   	push   %ebx
+  8025b3:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8025b6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8025bd:	78 38                	js     8025f7 <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  8025bf:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8025c6:	74 7b                	je     802643 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  8025c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8025cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025d3:	b8 17 00 00 00       	mov    $0x17,%eax
+  8025d8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8025db:	89 f7                	mov    %esi,%edi
+  8025dd:	55                   	push   %ebp
+  8025de:	68 e7 25 80 00       	push   $0x8025e7
+  8025e3:	89 e5                	mov    %esp,%ebp
+  8025e5:	0f 34                	sysenter
+  8025e7:	83 c4 04             	add    $0x4,%esp
+  8025ea:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8025eb:	85 c0                	test   %eax,%eax
+  8025ed:	7f 6d                	jg     80265c <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  8025ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025f2:	5b                   	pop    %ebx
+  8025f3:	5e                   	pop    %esi
+  8025f4:	5f                   	pop    %edi
+  8025f5:	5d                   	pop    %ebp
+  8025f6:	c3                   	ret
+  8025f7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025fc:	0f a2                	cpuid
+		return 0;
+  8025fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802603:	f6 c6 08             	test   $0x8,%dh
+  802606:	74 15                	je     80261d <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802608:	89 c2                	mov    %eax,%edx
+  80260a:	c1 ea 08             	shr    $0x8,%edx
+  80260d:	83 e2 0f             	and    $0xf,%edx
+  802610:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802615:	83 fa 06             	cmp    $0x6,%edx
+  802618:	74 0e                	je     802628 <sys_shm_detach+0x7b>
+  80261a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80261d:	0f b6 c9             	movzbl %cl,%ecx
+  802620:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802626:	eb 97                	jmp    8025bf <sys_shm_detach+0x12>
+  802628:	89 c2                	mov    %eax,%edx
+  80262a:	c1 ea 04             	shr    $0x4,%edx
+  80262d:	83 e2 0f             	and    $0xf,%edx
+  802630:	83 fa 02             	cmp    $0x2,%edx
+  802633:	77 e5                	ja     80261a <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  802635:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802638:	83 f8 02             	cmp    $0x2,%eax
+  80263b:	0f 97 c1             	seta   %cl
+  80263e:	0f b6 c9             	movzbl %cl,%ecx
+  802641:	eb d7                	jmp    80261a <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  802643:	be 00 00 00 00       	mov    $0x0,%esi
+  802648:	b8 17 00 00 00       	mov    $0x17,%eax
+  80264d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802650:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802653:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802656:	89 f7                	mov    %esi,%edi
+  802658:	cd 30                	int    $0x30
+  80265a:	eb 8f                	jmp    8025eb <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80265c:	83 ec 0c             	sub    $0xc,%esp
+  80265f:	50                   	push   %eax
+  802660:	6a 17                	push   $0x17
+  802662:	68 19 36 80 00       	push   $0x803619
+  802667:	6a 4a                	push   $0x4a
+  802669:	68 36 36 80 00       	push   $0x803636
+  80266e:	e8 78 e0 ff ff       	call   8006eb <_panic>
+
+00802673 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  802673:	55                   	push   %ebp
+  802674:	89 e5                	mov    %esp,%ebp
+  802676:	57                   	push   %edi
+  802677:	56                   	push   %esi
+  802678:	53                   	push   %ebx
+  802679:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80267c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802683:	78 36                	js     8026bb <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  802685:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80268c:	74 79                	je     802707 <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  80268e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802691:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802696:	b8 18 00 00 00       	mov    $0x18,%eax
+  80269b:	89 cb                	mov    %ecx,%ebx
+  80269d:	89 cf                	mov    %ecx,%edi
+  80269f:	89 ce                	mov    %ecx,%esi
+  8026a1:	55                   	push   %ebp
+  8026a2:	68 ab 26 80 00       	push   $0x8026ab
+  8026a7:	89 e5                	mov    %esp,%ebp
+  8026a9:	0f 34                	sysenter
+  8026ab:	83 c4 04             	add    $0x4,%esp
+  8026ae:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8026af:	85 c0                	test   %eax,%eax
+  8026b1:	7f 6b                	jg     80271e <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  8026b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026b6:	5b                   	pop    %ebx
+  8026b7:	5e                   	pop    %esi
+  8026b8:	5f                   	pop    %edi
+  8026b9:	5d                   	pop    %ebp
+  8026ba:	c3                   	ret
+  8026bb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026c0:	0f a2                	cpuid
+		return 0;
+  8026c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8026c7:	f6 c6 08             	test   $0x8,%dh
+  8026ca:	74 15                	je     8026e1 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8026cc:	89 c2                	mov    %eax,%edx
+  8026ce:	c1 ea 08             	shr    $0x8,%edx
+  8026d1:	83 e2 0f             	and    $0xf,%edx
+  8026d4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8026d9:	83 fa 06             	cmp    $0x6,%edx
+  8026dc:	74 0e                	je     8026ec <sys_shm_remove+0x79>
+  8026de:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8026e1:	0f b6 c9             	movzbl %cl,%ecx
+  8026e4:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8026ea:	eb 99                	jmp    802685 <sys_shm_remove+0x12>
+  8026ec:	89 c2                	mov    %eax,%edx
+  8026ee:	c1 ea 04             	shr    $0x4,%edx
+  8026f1:	83 e2 0f             	and    $0xf,%edx
+  8026f4:	83 fa 02             	cmp    $0x2,%edx
+  8026f7:	77 e5                	ja     8026de <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  8026f9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8026fc:	83 f8 02             	cmp    $0x2,%eax
+  8026ff:	0f 97 c1             	seta   %cl
+  802702:	0f b6 c9             	movzbl %cl,%ecx
+  802705:	eb d7                	jmp    8026de <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  802707:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80270c:	b8 18 00 00 00       	mov    $0x18,%eax
+  802711:	8b 55 08             	mov    0x8(%ebp),%edx
+  802714:	89 cb                	mov    %ecx,%ebx
+  802716:	89 cf                	mov    %ecx,%edi
+  802718:	89 ce                	mov    %ecx,%esi
+  80271a:	cd 30                	int    $0x30
+  80271c:	eb 91                	jmp    8026af <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80271e:	83 ec 0c             	sub    $0xc,%esp
+  802721:	50                   	push   %eax
+  802722:	6a 18                	push   $0x18
+  802724:	68 19 36 80 00       	push   $0x803619
+  802729:	6a 4a                	push   $0x4a
+  80272b:	68 36 36 80 00       	push   $0x803636
+  802730:	e8 b6 df ff ff       	call   8006eb <_panic>
+
+00802735 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  802735:	55                   	push   %ebp
+  802736:	89 e5                	mov    %esp,%ebp
+  802738:	57                   	push   %edi
+  802739:	56                   	push   %esi
+  80273a:	53                   	push   %ebx
+  80273b:	83 ec 0c             	sub    $0xc,%esp
+  80273e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802741:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802744:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  802747:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80274e:	78 32                	js     802782 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  802750:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802757:	74 75                	je     8027ce <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  802759:	8b 55 08             	mov    0x8(%ebp),%edx
+  80275c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80275f:	b8 20 00 00 00       	mov    $0x20,%eax
+  802764:	be 00 00 00 00       	mov    $0x0,%esi
+  802769:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  80276c:	55                   	push   %ebp
+  80276d:	68 76 27 80 00       	push   $0x802776
+  802772:	89 e5                	mov    %esp,%ebp
+  802774:	0f 34                	sysenter
+  802776:	83 c4 04             	add    $0x4,%esp
+  802779:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  80277a:	83 c4 0c             	add    $0xc,%esp
+  80277d:	5b                   	pop    %ebx
+  80277e:	5e                   	pop    %esi
+  80277f:	5f                   	pop    %edi
+  802780:	5d                   	pop    %ebp
+  802781:	c3                   	ret
+  802782:	b8 01 00 00 00       	mov    $0x1,%eax
+  802787:	0f a2                	cpuid
+		return 0;
+  802789:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80278e:	f6 c6 08             	test   $0x8,%dh
+  802791:	74 15                	je     8027a8 <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802793:	89 c2                	mov    %eax,%edx
+  802795:	c1 ea 08             	shr    $0x8,%edx
+  802798:	83 e2 0f             	and    $0xf,%edx
+  80279b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8027a0:	83 fa 06             	cmp    $0x6,%edx
+  8027a3:	74 0e                	je     8027b3 <sys_futex_wait+0x7e>
+  8027a5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8027a8:	0f b6 c9             	movzbl %cl,%ecx
+  8027ab:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8027b1:	eb 9d                	jmp    802750 <sys_futex_wait+0x1b>
+  8027b3:	89 c2                	mov    %eax,%edx
+  8027b5:	c1 ea 04             	shr    $0x4,%edx
+  8027b8:	83 e2 0f             	and    $0xf,%edx
+  8027bb:	83 fa 02             	cmp    $0x2,%edx
+  8027be:	77 e5                	ja     8027a5 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  8027c0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8027c3:	83 f8 02             	cmp    $0x2,%eax
+  8027c6:	0f 97 c1             	seta   %cl
+  8027c9:	0f b6 c9             	movzbl %cl,%ecx
+  8027cc:	eb d7                	jmp    8027a5 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  8027ce:	b8 20 00 00 00       	mov    $0x20,%eax
+  8027d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8027d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8027db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027de:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8027e1:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  8027e3:	eb 95                	jmp    80277a <sys_futex_wait+0x45>
+
+008027e5 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8027e5:	55                   	push   %ebp
+  8027e6:	89 e5                	mov    %esp,%ebp
+  8027e8:	57                   	push   %edi
+  8027e9:	56                   	push   %esi
+  8027ea:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8027eb:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8027f2:	78 30                	js     802824 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  8027f4:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8027fb:	74 73                	je     802870 <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  8027fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802802:	8b 55 08             	mov    0x8(%ebp),%edx
+  802805:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802808:	b8 21 00 00 00       	mov    $0x21,%eax
+  80280d:	89 df                	mov    %ebx,%edi
+  80280f:	89 de                	mov    %ebx,%esi
+  802811:	55                   	push   %ebp
+  802812:	68 1b 28 80 00       	push   $0x80281b
+  802817:	89 e5                	mov    %esp,%ebp
+  802819:	0f 34                	sysenter
+  80281b:	83 c4 04             	add    $0x4,%esp
+  80281e:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80281f:	5b                   	pop    %ebx
+  802820:	5e                   	pop    %esi
+  802821:	5f                   	pop    %edi
+  802822:	5d                   	pop    %ebp
+  802823:	c3                   	ret
+  802824:	b8 01 00 00 00       	mov    $0x1,%eax
+  802829:	0f a2                	cpuid
+		return 0;
+  80282b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802830:	f6 c6 08             	test   $0x8,%dh
+  802833:	74 15                	je     80284a <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802835:	89 c2                	mov    %eax,%edx
+  802837:	c1 ea 08             	shr    $0x8,%edx
+  80283a:	83 e2 0f             	and    $0xf,%edx
+  80283d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802842:	83 fa 06             	cmp    $0x6,%edx
+  802845:	74 0e                	je     802855 <sys_futex_wake+0x70>
+  802847:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80284a:	0f b6 c9             	movzbl %cl,%ecx
+  80284d:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802853:	eb 9f                	jmp    8027f4 <sys_futex_wake+0xf>
+  802855:	89 c2                	mov    %eax,%edx
+  802857:	c1 ea 04             	shr    $0x4,%edx
+  80285a:	83 e2 0f             	and    $0xf,%edx
+  80285d:	83 fa 02             	cmp    $0x2,%edx
+  802860:	77 e5                	ja     802847 <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  802862:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802865:	83 f8 02             	cmp    $0x2,%eax
+  802868:	0f 97 c1             	seta   %cl
+  80286b:	0f b6 c9             	movzbl %cl,%ecx
+  80286e:	eb d7                	jmp    802847 <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  802870:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802875:	b8 21 00 00 00       	mov    $0x21,%eax
+  80287a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80287d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802880:	89 df                	mov    %ebx,%edi
+  802882:	89 de                	mov    %ebx,%esi
+  802884:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  802886:	eb 97                	jmp    80281f <sys_futex_wake+0x3a>
+
+00802888 <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  802888:	55                   	push   %ebp
+  802889:	89 e5                	mov    %esp,%ebp
+  80288b:	57                   	push   %edi
+  80288c:	56                   	push   %esi
+  80288d:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80288e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802895:	78 2e                	js     8028c5 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  802897:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80289e:	74 71                	je     802911 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  8028a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028a5:	b8 22 00 00 00       	mov    $0x22,%eax
+  8028aa:	89 d1                	mov    %edx,%ecx
+  8028ac:	89 d3                	mov    %edx,%ebx
+  8028ae:	89 d7                	mov    %edx,%edi
+  8028b0:	89 d6                	mov    %edx,%esi
+  8028b2:	55                   	push   %ebp
+  8028b3:	68 bc 28 80 00       	push   $0x8028bc
+  8028b8:	89 e5                	mov    %esp,%ebp
+  8028ba:	0f 34                	sysenter
+  8028bc:	83 c4 04             	add    $0x4,%esp
+  8028bf:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  8028c0:	5b                   	pop    %ebx
+  8028c1:	5e                   	pop    %esi
+  8028c2:	5f                   	pop    %edi
+  8028c3:	5d                   	pop    %ebp
+  8028c4:	c3                   	ret
+  8028c5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028ca:	0f a2                	cpuid
+		return 0;
+  8028cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8028d1:	f6 c6 08             	test   $0x8,%dh
+  8028d4:	74 15                	je     8028eb <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8028d6:	89 c2                	mov    %eax,%edx
+  8028d8:	c1 ea 08             	shr    $0x8,%edx
+  8028db:	83 e2 0f             	and    $0xf,%edx
+  8028de:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8028e3:	83 fa 06             	cmp    $0x6,%edx
+  8028e6:	74 0e                	je     8028f6 <sys_ep_create+0x6e>
+  8028e8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8028eb:	0f b6 c9             	movzbl %cl,%ecx
+  8028ee:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8028f4:	eb a1                	jmp    802897 <sys_ep_create+0xf>
+  8028f6:	89 c2                	mov    %eax,%edx
+  8028f8:	c1 ea 04             	shr    $0x4,%edx
+  8028fb:	83 e2 0f             	and    $0xf,%edx
+  8028fe:	83 fa 02             	cmp    $0x2,%edx
+  802901:	77 e5                	ja     8028e8 <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  802903:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802906:	83 f8 02             	cmp    $0x2,%eax
+  802909:	0f 97 c1             	seta   %cl
+  80290c:	0f b6 c9             	movzbl %cl,%ecx
+  80290f:	eb d7                	jmp    8028e8 <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  802911:	ba 00 00 00 00       	mov    $0x0,%edx
+  802916:	b8 22 00 00 00       	mov    $0x22,%eax
+  80291b:	89 d1                	mov    %edx,%ecx
+  80291d:	89 d3                	mov    %edx,%ebx
+  80291f:	89 d7                	mov    %edx,%edi
+  802921:	89 d6                	mov    %edx,%esi
+  802923:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  802925:	eb 99                	jmp    8028c0 <sys_ep_create+0x38>
+
+00802927 <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  802927:	55                   	push   %ebp
+  802928:	89 e5                	mov    %esp,%ebp
+  80292a:	57                   	push   %edi
+  80292b:	56                   	push   %esi
+  80292c:	53                   	push   %ebx
+  80292d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802930:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802937:	78 36                	js     80296f <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  802939:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802940:	74 79                	je     8029bb <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  802942:	8b 55 08             	mov    0x8(%ebp),%edx
+  802945:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80294a:	b8 23 00 00 00       	mov    $0x23,%eax
+  80294f:	89 cb                	mov    %ecx,%ebx
+  802951:	89 cf                	mov    %ecx,%edi
+  802953:	89 ce                	mov    %ecx,%esi
+  802955:	55                   	push   %ebp
+  802956:	68 5f 29 80 00       	push   $0x80295f
+  80295b:	89 e5                	mov    %esp,%ebp
+  80295d:	0f 34                	sysenter
+  80295f:	83 c4 04             	add    $0x4,%esp
+  802962:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802963:	85 c0                	test   %eax,%eax
+  802965:	7f 6b                	jg     8029d2 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  802967:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80296a:	5b                   	pop    %ebx
+  80296b:	5e                   	pop    %esi
+  80296c:	5f                   	pop    %edi
+  80296d:	5d                   	pop    %ebp
+  80296e:	c3                   	ret
+  80296f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802974:	0f a2                	cpuid
+		return 0;
+  802976:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80297b:	f6 c6 08             	test   $0x8,%dh
+  80297e:	74 15                	je     802995 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802980:	89 c2                	mov    %eax,%edx
+  802982:	c1 ea 08             	shr    $0x8,%edx
+  802985:	83 e2 0f             	and    $0xf,%edx
+  802988:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80298d:	83 fa 06             	cmp    $0x6,%edx
+  802990:	74 0e                	je     8029a0 <sys_ep_destroy+0x79>
+  802992:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802995:	0f b6 c9             	movzbl %cl,%ecx
+  802998:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80299e:	eb 99                	jmp    802939 <sys_ep_destroy+0x12>
+  8029a0:	89 c2                	mov    %eax,%edx
+  8029a2:	c1 ea 04             	shr    $0x4,%edx
+  8029a5:	83 e2 0f             	and    $0xf,%edx
+  8029a8:	83 fa 02             	cmp    $0x2,%edx
+  8029ab:	77 e5                	ja     802992 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  8029ad:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8029b0:	83 f8 02             	cmp    $0x2,%eax
+  8029b3:	0f 97 c1             	seta   %cl
+  8029b6:	0f b6 c9             	movzbl %cl,%ecx
+  8029b9:	eb d7                	jmp    802992 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  8029bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029c0:	b8 23 00 00 00       	mov    $0x23,%eax
+  8029c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8029c8:	89 cb                	mov    %ecx,%ebx
+  8029ca:	89 cf                	mov    %ecx,%edi
+  8029cc:	89 ce                	mov    %ecx,%esi
+  8029ce:	cd 30                	int    $0x30
+  8029d0:	eb 91                	jmp    802963 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8029d2:	83 ec 0c             	sub    $0xc,%esp
+  8029d5:	50                   	push   %eax
+  8029d6:	6a 23                	push   $0x23
+  8029d8:	68 19 36 80 00       	push   $0x803619
+  8029dd:	6a 4a                	push   $0x4a
+  8029df:	68 36 36 80 00       	push   $0x803636
+  8029e4:	e8 02 dd ff ff       	call   8006eb <_panic>
+
+008029e9 <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  8029e9:	55                   	push   %ebp
+  8029ea:	89 e5                	mov    %esp,%ebp
+  8029ec:	57                   	push   %edi
+  8029ed:	56                   	push   %esi
+  8029ee:	53                   	push   %ebx
+  8029ef:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8029f2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8029f9:	78 37                	js     802a32 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  8029fb:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802a02:	74 7a                	je     802a7e <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  802a04:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a09:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a0c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a0f:	b8 24 00 00 00       	mov    $0x24,%eax
+  802a14:	89 df                	mov    %ebx,%edi
+  802a16:	89 de                	mov    %ebx,%esi
+  802a18:	55                   	push   %ebp
+  802a19:	68 22 2a 80 00       	push   $0x802a22
+  802a1e:	89 e5                	mov    %esp,%ebp
+  802a20:	0f 34                	sysenter
+  802a22:	83 c4 04             	add    $0x4,%esp
+  802a25:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802a26:	85 c0                	test   %eax,%eax
+  802a28:	7f 6c                	jg     802a96 <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  802a2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a2d:	5b                   	pop    %ebx
+  802a2e:	5e                   	pop    %esi
+  802a2f:	5f                   	pop    %edi
+  802a30:	5d                   	pop    %ebp
+  802a31:	c3                   	ret
+  802a32:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a37:	0f a2                	cpuid
+		return 0;
+  802a39:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802a3e:	f6 c6 08             	test   $0x8,%dh
+  802a41:	74 15                	je     802a58 <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802a43:	89 c2                	mov    %eax,%edx
+  802a45:	c1 ea 08             	shr    $0x8,%edx
+  802a48:	83 e2 0f             	and    $0xf,%edx
+  802a4b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802a50:	83 fa 06             	cmp    $0x6,%edx
+  802a53:	74 0e                	je     802a63 <sys_ep_grant+0x7a>
+  802a55:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802a58:	0f b6 c9             	movzbl %cl,%ecx
+  802a5b:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802a61:	eb 98                	jmp    8029fb <sys_ep_grant+0x12>
+  802a63:	89 c2                	mov    %eax,%edx
+  802a65:	c1 ea 04             	shr    $0x4,%edx
+  802a68:	83 e2 0f             	and    $0xf,%edx
+  802a6b:	83 fa 02             	cmp    $0x2,%edx
+  802a6e:	77 e5                	ja     802a55 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  802a70:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802a73:	83 f8 02             	cmp    $0x2,%eax
+  802a76:	0f 97 c1             	seta   %cl
+  802a79:	0f b6 c9             	movzbl %cl,%ecx
+  802a7c:	eb d7                	jmp    802a55 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  802a7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a83:	b8 24 00 00 00       	mov    $0x24,%eax
+  802a88:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a8b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a8e:	89 df                	mov    %ebx,%edi
+  802a90:	89 de                	mov    %ebx,%esi
+  802a92:	cd 30                	int    $0x30
+  802a94:	eb 90                	jmp    802a26 <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802a96:	83 ec 0c             	sub    $0xc,%esp
+  802a99:	50                   	push   %eax
+  802a9a:	6a 24                	push   $0x24
+  802a9c:	68 19 36 80 00       	push   $0x803619
+  802aa1:	6a 4a                	push   $0x4a
+  802aa3:	68 36 36 80 00       	push   $0x803636
+  802aa8:	e8 3e dc ff ff       	call   8006eb <_panic>
+
+00802aad <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  802aad:	55                   	push   %ebp
+  802aae:	89 e5                	mov    %esp,%ebp
+  802ab0:	57                   	push   %edi
+  802ab1:	56                   	push   %esi
+  802ab2:	53                   	push   %ebx
+  802ab3:	83 ec 20             	sub    $0x20,%esp
+  802ab6:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  802ab9:	8b 10                	mov    (%eax),%edx
+  802abb:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802abe:	8b 50 04             	mov    0x4(%eax),%edx
+  802ac1:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802ac4:	8b 50 08             	mov    0x8(%eax),%edx
+  802ac7:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  802aca:	8b 50 0c             	mov    0xc(%eax),%edx
+  802acd:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  802ad0:	8b 40 10             	mov    0x10(%eax),%eax
+  802ad3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  802ad6:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  802ad9:	8b 55 08             	mov    0x8(%ebp),%edx
+  802adc:	b8 25 00 00 00       	mov    $0x25,%eax
+  802ae1:	55                   	push   %ebp
+  802ae2:	56                   	push   %esi
+  802ae3:	8b 0e                	mov    (%esi),%ecx
+  802ae5:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802ae8:	8b 7e 08             	mov    0x8(%esi),%edi
+  802aeb:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802aee:	8b 76 0c             	mov    0xc(%esi),%esi
+  802af1:	cd 30                	int    $0x30
+  802af3:	87 34 24             	xchg   %esi,(%esp)
+  802af6:	89 0e                	mov    %ecx,(%esi)
+  802af8:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802afb:	89 7e 08             	mov    %edi,0x8(%esi)
+  802afe:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802b01:	8f 46 0c             	pop    0xc(%esi)
+  802b04:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  802b05:	83 c4 20             	add    $0x20,%esp
+  802b08:	5b                   	pop    %ebx
+  802b09:	5e                   	pop    %esi
+  802b0a:	5f                   	pop    %edi
+  802b0b:	5d                   	pop    %ebp
+  802b0c:	c3                   	ret
+
+00802b0d <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  802b0d:	55                   	push   %ebp
+  802b0e:	89 e5                	mov    %esp,%ebp
+  802b10:	57                   	push   %edi
+  802b11:	56                   	push   %esi
+  802b12:	53                   	push   %ebx
+  802b13:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  802b16:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b19:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  802b1b:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b1e:	b8 26 00 00 00       	mov    $0x26,%eax
+  802b23:	55                   	push   %ebp
+  802b24:	56                   	push   %esi
+  802b25:	8b 0e                	mov    (%esi),%ecx
+  802b27:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802b2a:	8b 7e 08             	mov    0x8(%esi),%edi
+  802b2d:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802b30:	8b 76 0c             	mov    0xc(%esi),%esi
+  802b33:	cd 30                	int    $0x30
+  802b35:	87 34 24             	xchg   %esi,(%esp)
+  802b38:	89 0e                	mov    %ecx,(%esi)
+  802b3a:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802b3d:	89 7e 08             	mov    %edi,0x8(%esi)
+  802b40:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802b43:	8f 46 0c             	pop    0xc(%esi)
+  802b46:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  802b47:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  802b4b:	74 0f                	je     802b5c <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  802b4d:	85 c0                	test   %eax,%eax
+  802b4f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b54:	0f 48 d1             	cmovs  %ecx,%edx
+  802b57:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  802b5a:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  802b5c:	5b                   	pop    %ebx
+  802b5d:	5e                   	pop    %esi
+  802b5e:	5f                   	pop    %edi
+  802b5f:	5d                   	pop    %ebp
+  802b60:	c3                   	ret
+
+00802b61 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  802b61:	55                   	push   %ebp
+  802b62:	89 e5                	mov    %esp,%ebp
+  802b64:	57                   	push   %edi
+  802b65:	56                   	push   %esi
+  802b66:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802b67:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802b6e:	78 2f                	js     802b9f <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  802b70:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802b77:	74 72                	je     802beb <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  802b79:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b7c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b81:	b8 27 00 00 00       	mov    $0x27,%eax
+  802b86:	89 cb                	mov    %ecx,%ebx
+  802b88:	89 cf                	mov    %ecx,%edi
+  802b8a:	89 ce                	mov    %ecx,%esi
+  802b8c:	55                   	push   %ebp
+  802b8d:	68 96 2b 80 00       	push   $0x802b96
+  802b92:	89 e5                	mov    %esp,%ebp
+  802b94:	0f 34                	sysenter
+  802b96:	83 c4 04             	add    $0x4,%esp
+  802b99:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  802b9a:	5b                   	pop    %ebx
+  802b9b:	5e                   	pop    %esi
+  802b9c:	5f                   	pop    %edi
+  802b9d:	5d                   	pop    %ebp
+  802b9e:	c3                   	ret
+  802b9f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ba4:	0f a2                	cpuid
+		return 0;
+  802ba6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802bab:	f6 c6 08             	test   $0x8,%dh
+  802bae:	74 15                	je     802bc5 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802bb0:	89 c2                	mov    %eax,%edx
+  802bb2:	c1 ea 08             	shr    $0x8,%edx
+  802bb5:	83 e2 0f             	and    $0xf,%edx
+  802bb8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802bbd:	83 fa 06             	cmp    $0x6,%edx
+  802bc0:	74 0e                	je     802bd0 <sys_sysring_setup+0x6f>
+  802bc2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802bc5:	0f b6 c9             	movzbl %cl,%ecx
+  802bc8:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802bce:	eb a0                	jmp    802b70 <sys_sysring_setup+0xf>
+  802bd0:	89 c2                	mov    %eax,%edx
+  802bd2:	c1 ea 04             	shr    $0x4,%edx
+  802bd5:	83 e2 0f             	and    $0xf,%edx
+  802bd8:	83 fa 02             	cmp    $0x2,%edx
+  802bdb:	77 e5                	ja     802bc2 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  802bdd:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802be0:	83 f8 02             	cmp    $0x2,%eax
+  802be3:	0f 97 c1             	seta   %cl
+  802be6:	0f b6 c9             	movzbl %cl,%ecx
+  802be9:	eb d7                	jmp    802bc2 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  802beb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802bf0:	b8 27 00 00 00       	mov    $0x27,%eax
+  802bf5:	8b 55 08             	mov    0x8(%ebp),%edx
+  802bf8:	89 cb                	mov    %ecx,%ebx
+  802bfa:	89 cf                	mov    %ecx,%edi
+  802bfc:	89 ce                	mov    %ecx,%esi
+  802bfe:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  802c00:	eb 98                	jmp    802b9a <sys_sysring_setup+0x39>
+
+00802c02 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  802c02:	55                   	push   %ebp
+  802c03:	89 e5                	mov    %esp,%ebp
+  802c05:	57                   	push   %edi
+  802c06:	56                   	push   %esi
+  802c07:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802c08:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802c0f:	78 2e                	js     802c3f <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  802c11:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802c18:	74 71                	je     802c8b <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  802c1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c1f:	b8 28 00 00 00       	mov    $0x28,%eax
+  802c24:	89 d1                	mov    %edx,%ecx
+  802c26:	89 d3                	mov    %edx,%ebx
+  802c28:	89 d7                	mov    %edx,%edi
+  802c2a:	89 d6                	mov    %edx,%esi
+  802c2c:	55                   	push   %ebp
+  802c2d:	68 36 2c 80 00       	push   $0x802c36
+  802c32:	89 e5                	mov    %esp,%ebp
+  802c34:	0f 34                	sysenter
+  802c36:	83 c4 04             	add    $0x4,%esp
+  802c39:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  802c3a:	5b                   	pop    %ebx
+  802c3b:	5e                   	pop    %esi
+  802c3c:	5f                   	pop    %edi
+  802c3d:	5d                   	pop    %ebp
+  802c3e:	c3                   	ret
+  802c3f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c44:	0f a2                	cpuid
+		return 0;
+  802c46:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802c4b:	f6 c6 08             	test   $0x8,%dh
+  802c4e:	74 15                	je     802c65 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802c50:	89 c2                	mov    %eax,%edx
+  802c52:	c1 ea 08             	shr    $0x8,%edx
+  802c55:	83 e2 0f             	and    $0xf,%edx
+  802c58:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802c5d:	83 fa 06             	cmp    $0x6,%edx
+  802c60:	74 0e                	je     802c70 <sys_sysring_enter+0x6e>
+  802c62:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802c65:	0f b6 c9             	movzbl %cl,%ecx
+  802c68:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802c6e:	eb a1                	jmp    802c11 <sys_sysring_enter+0xf>
+  802c70:	89 c2                	mov    %eax,%edx
+  802c72:	c1 ea 04             	shr    $0x4,%edx
+  802c75:	83 e2 0f             	and    $0xf,%edx
+  802c78:	83 fa 02             	cmp    $0x2,%edx
+  802c7b:	77 e5                	ja     802c62 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  802c7d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802c80:	83 f8 02             	cmp    $0x2,%eax
+  802c83:	0f 97 c1             	seta   %cl
+  802c86:	0f b6 c9             	movzbl %cl,%ecx
+  802c89:	eb d7                	jmp    802c62 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  802c8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c90:	b8 28 00 00 00       	mov    $0x28,%eax
+  802c95:	89 d1                	mov    %edx,%ecx
+  802c97:	89 d3                	mov    %edx,%ebx
+  802c99:	89 d7                	mov    %edx,%edi
+  802c9b:	89 d6                	mov    %edx,%esi
+  802c9d:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  802c9f:	eb 99                	jmp    802c3a <sys_sysring_enter+0x38>
+
+00802ca1 <pgfault>:
+// The kernel normally resolves these faults itself (page_fault_cow in
+// kern/trap.c); we only get here if it ran out of memory doing so.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802ca1:	55                   	push   %ebp
+  802ca2:	89 e5                	mov    %esp,%ebp
+  802ca4:	83 ec 08             	sub    $0x8,%esp
+  802ca7:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  802caa:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  802cac:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  802caf:	f6 c2 02             	test   $0x2,%dl
+  802cb2:	74 40                	je     802cf4 <pgfault+0x53>
+  802cb4:	89 c1                	mov    %eax,%ecx
+  802cb6:	c1 e9 16             	shr    $0x16,%ecx
+  802cb9:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802cc0:	f6 c1 01             	test   $0x1,%cl
+  802cc3:	74 2f                	je     802cf4 <pgfault+0x53>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW))
+  802cc5:	89 c1                	mov    %eax,%ecx
+  802cc7:	c1 e9 0c             	shr    $0xc,%ecx
+  802cca:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  802cd1:	f6 c5 08             	test   $0x8,%ch
+  802cd4:	74 1e                	je     802cf4 <pgfault+0x53>
+	// Replace the page with a private writable copy of itself.  The
+	// kernel allocates, copies and maps it in one system call, so no
+	// temporary mapping at PFTEMP is needed.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  802cd6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r = sys_page_copy(0, addr, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  802cdb:	83 ec 0c             	sub    $0xc,%esp
+  802cde:	6a 07                	push   $0x7
+  802ce0:	50                   	push   %eax
+  802ce1:	6a 00                	push   $0x0
+  802ce3:	50                   	push   %eax
+  802ce4:	6a 00                	push   $0x0
+  802ce6:	e8 85 eb ff ff       	call   801870 <sys_page_copy>
+  802ceb:	83 c4 20             	add    $0x20,%esp
+  802cee:	85 c0                	test   %eax,%eax
+  802cf0:	78 18                	js     802d0a <pgfault+0x69>
+		panic("pgfault: sys_page_copy: %e", r);
+}
+  802cf2:	c9                   	leave
+  802cf3:	c3                   	ret
+		panic("pgfault: va %08x err %x is not a copy-on-write write",
+  802cf4:	83 ec 0c             	sub    $0xc,%esp
+  802cf7:	52                   	push   %edx
+  802cf8:	50                   	push   %eax
+  802cf9:	68 44 36 80 00       	push   $0x803644
+  802cfe:	6a 1c                	push   $0x1c
+  802d00:	68 79 36 80 00       	push   $0x803679
+  802d05:	e8 e1 d9 ff ff       	call   8006eb <_panic>
+		panic("pgfault: sys_page_copy: %e", r);
+  802d0a:	50                   	push   %eax
+  802d0b:	68 84 36 80 00       	push   $0x803684
+  802d10:	6a 26                	push   $0x26
+  802d12:	68 79 36 80 00       	push   $0x803679
+  802d17:	e8 cf d9 ff ff       	call   8006eb <_panic>
+
+00802d1c <ufork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+ufork(void)
+{
+  802d1c:	55                   	push   %ebp
+  802d1d:	89 e5                	mov    %esp,%ebp
+  802d1f:	57                   	push   %edi
+  802d20:	56                   	push   %esi
+  802d21:	53                   	push   %ebx
+  802d22:	81 ec 38 04 00 00    	sub    $0x438,%esp
+	struct page_range vec[PAGE_VEC_MAX], *last;
+	uintptr_t va;
+	size_t n;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  802d28:	68 a1 2c 80 00       	push   $0x802ca1
+  802d2d:	e8 71 02 00 00       	call   802fa3 <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  802d32:	b8 07 00 00 00       	mov    $0x7,%eax
+  802d37:	cd 30                	int    $0x30
+  802d39:	89 85 d4 fb ff ff    	mov    %eax,-0x42c(%ebp)
+
+	envid = sys_exofork();
+	if (envid < 0)
+  802d3f:	83 c4 10             	add    $0x10,%esp
+  802d42:	85 c0                	test   %eax,%eax
+  802d44:	0f 88 f2 01 00 00    	js     802f3c <ufork+0x220>
+		return 0;
+	}
+
+	// Copy every run of mapped pages below the exception stack, which
+	// must not be shared.
+	va = 0;
+  802d4a:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  802d4f:	74 0b                	je     802d5c <ufork+0x40>
+  802d51:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  802d57:	e9 07 01 00 00       	jmp    802e63 <ufork+0x147>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  802d5c:	e8 22 e8 ff ff       	call   801583 <sys_getenvid>
+  802d61:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802d66:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802d6c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802d71:	a3 0c 40 80 00       	mov    %eax,0x80400c
+		return 0;
+  802d76:	e9 c1 01 00 00       	jmp    802f3c <ufork+0x220>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+		n = r;
+		last = &vec[n - 1];
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  802d7b:	83 ea 01             	sub    $0x1,%edx
+  802d7e:	89 c1                	mov    %eax,%ecx
+  802d80:	c1 e1 04             	shl    $0x4,%ecx
+  802d83:	89 94 0d ec fd ff ff 	mov    %edx,-0x214(%ebp,%ecx,1)
+			n--;
+  802d8a:	85 d2                	test   %edx,%edx
+  802d8c:	0f 44 f0             	cmove  %eax,%esi
+  802d8f:	e9 12 01 00 00       	jmp    802ea6 <ufork+0x18a>
+	for (i = 0; i < n; i++) {
+  802d94:	83 c1 01             	add    $0x1,%ecx
+  802d97:	83 c0 10             	add    $0x10,%eax
+  802d9a:	39 8d e4 fb ff ff    	cmp    %ecx,-0x41c(%ebp)
+  802da0:	74 6a                	je     802e0c <ufork+0xf0>
+		vec[i].pr_dstva = vec[i].pr_va;
+  802da2:	89 c3                	mov    %eax,%ebx
+  802da4:	8b 10                	mov    (%eax),%edx
+  802da6:	89 50 0c             	mov    %edx,0xc(%eax)
+		if (vec[i].pr_perm & PTE_SHARE)
+  802da9:	8b 50 08             	mov    0x8(%eax),%edx
+  802dac:	f6 c6 04             	test   $0x4,%dh
+  802daf:	75 e3                	jne    802d94 <ufork+0x78>
+		if (vec[i].pr_perm & (PTE_W | PTE_COW)) {
+  802db1:	f7 c2 02 08 00 00    	test   $0x802,%edx
+  802db7:	74 db                	je     802d94 <ufork+0x78>
+			vec[i].pr_perm = (vec[i].pr_perm & ~PTE_W) | PTE_COW;
+  802db9:	81 e2 fd f7 ff ff    	and    $0xfffff7fd,%edx
+  802dbf:	80 ce 08             	or     $0x8,%dh
+  802dc2:	89 95 dc fb ff ff    	mov    %edx,-0x424(%ebp)
+  802dc8:	89 53 08             	mov    %edx,0x8(%ebx)
+			cow[ncow++] = vec[i];
+  802dcb:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  802dd1:	c1 e6 04             	shl    $0x4,%esi
+  802dd4:	89 f2                	mov    %esi,%edx
+  802dd6:	8d b4 35 e8 fb ff ff 	lea    -0x418(%ebp,%esi,1),%esi
+  802ddd:	8b 38                	mov    (%eax),%edi
+  802ddf:	89 bc 15 e8 fb ff ff 	mov    %edi,-0x418(%ebp,%edx,1)
+  802de6:	8b 78 04             	mov    0x4(%eax),%edi
+  802de9:	89 7e 04             	mov    %edi,0x4(%esi)
+  802dec:	8b bd dc fb ff ff    	mov    -0x424(%ebp),%edi
+  802df2:	89 7e 08             	mov    %edi,0x8(%esi)
+  802df5:	8b 50 0c             	mov    0xc(%eax),%edx
+  802df8:	89 56 0c             	mov    %edx,0xc(%esi)
+  802dfb:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  802e01:	8d 7e 01             	lea    0x1(%esi),%edi
+  802e04:	89 bd e0 fb ff ff    	mov    %edi,-0x420(%ebp)
+  802e0a:	eb 88                	jmp    802d94 <ufork+0x78>
+	if ((r = sys_page_map_vec(0, envid, vec, n, 0)) < 0)
+  802e0c:	8b b5 e4 fb ff ff    	mov    -0x41c(%ebp),%esi
+  802e12:	8b bd d8 fb ff ff    	mov    -0x428(%ebp),%edi
+  802e18:	83 ec 0c             	sub    $0xc,%esp
+  802e1b:	6a 00                	push   $0x0
+  802e1d:	56                   	push   %esi
+  802e1e:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802e24:	50                   	push   %eax
+  802e25:	ff b5 d4 fb ff ff    	push   -0x42c(%ebp)
+  802e2b:	6a 00                	push   $0x0
+  802e2d:	e8 80 f4 ff ff       	call   8022b2 <sys_page_map_vec>
+  802e32:	83 c4 20             	add    $0x20,%esp
+  802e35:	85 c0                	test   %eax,%eax
+  802e37:	0f 88 e5 00 00 00    	js     802f22 <ufork+0x206>
+	return sys_page_map_vec(0, 0, cow, ncow, 0);
+  802e3d:	83 ec 0c             	sub    $0xc,%esp
+  802e40:	6a 00                	push   $0x0
+  802e42:	ff b5 e0 fb ff ff    	push   -0x420(%ebp)
+  802e48:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  802e4e:	50                   	push   %eax
+  802e4f:	6a 00                	push   $0x0
+  802e51:	6a 00                	push   $0x0
+  802e53:	e8 5a f4 ff ff       	call   8022b2 <sys_page_map_vec>
+		if ((r = duppages(envid, vec, n)) < 0)
+  802e58:	83 c4 20             	add    $0x20,%esp
+  802e5b:	85 c0                	test   %eax,%eax
+  802e5d:	0f 88 e7 00 00 00    	js     802f4a <ufork+0x22e>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+  802e63:	6a 20                	push   $0x20
+  802e65:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802e6b:	50                   	push   %eax
+  802e6c:	57                   	push   %edi
+  802e6d:	6a 00                	push   $0x0
+  802e6f:	e8 82 f4 ff ff       	call   8022f6 <sys_vm_ranges>
+  802e74:	83 c4 10             	add    $0x10,%esp
+  802e77:	85 c0                	test   %eax,%eax
+  802e79:	7e 51                	jle    802ecc <ufork+0x1b0>
+		n = r;
+  802e7b:	89 c6                	mov    %eax,%esi
+		last = &vec[n - 1];
+  802e7d:	83 e8 01             	sub    $0x1,%eax
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+  802e80:	89 c1                	mov    %eax,%ecx
+  802e82:	c1 e1 04             	shl    $0x4,%ecx
+  802e85:	8b 94 0d ec fd ff ff 	mov    -0x214(%ebp,%ecx,1),%edx
+  802e8c:	89 d3                	mov    %edx,%ebx
+  802e8e:	c1 e3 0c             	shl    $0xc,%ebx
+  802e91:	89 df                	mov    %ebx,%edi
+  802e93:	03 bc 0d e8 fd ff ff 	add    -0x218(%ebp,%ecx,1),%edi
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  802e9a:	81 ff 00 00 c0 ee    	cmp    $0xeec00000,%edi
+  802ea0:	0f 84 d5 fe ff ff    	je     802d7b <ufork+0x5f>
+	for (i = 0; i < n; i++) {
+  802ea6:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+	size_t i, ncow = 0;
+  802eac:	c7 85 e0 fb ff ff 00 	movl   $0x0,-0x420(%ebp)
+  802eb3:	00 00 00 
+	for (i = 0; i < n; i++) {
+  802eb6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ebb:	89 bd d8 fb ff ff    	mov    %edi,-0x428(%ebp)
+  802ec1:	89 b5 e4 fb ff ff    	mov    %esi,-0x41c(%ebp)
+  802ec7:	e9 ce fe ff ff       	jmp    802d9a <ufork+0x7e>
+			goto fail;
+	}
+	if (r < 0)
+  802ecc:	89 c6                	mov    %eax,%esi
+  802ece:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  802ed4:	85 c0                	test   %eax,%eax
+  802ed6:	78 52                	js     802f2a <ufork+0x20e>
+		goto fail;
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE),
+  802ed8:	83 ec 04             	sub    $0x4,%esp
+  802edb:	6a 07                	push   $0x7
+  802edd:	68 00 f0 bf ee       	push   $0xeebff000
+  802ee2:	53                   	push   %ebx
+  802ee3:	e8 3a e7 ff ff       	call   801622 <sys_page_alloc>
+  802ee8:	89 c6                	mov    %eax,%esi
+  802eea:	83 c4 10             	add    $0x10,%esp
+  802eed:	85 c0                	test   %eax,%eax
+  802eef:	78 39                	js     802f2a <ufork+0x20e>
+				PTE_P | PTE_U | PTE_W)) < 0
+	    || (r = sys_env_set_pgfault_upcall(envid,
+			thisenv->env_pgfault_upcall)) < 0
+  802ef1:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  802ef6:	8b 40 74             	mov    0x74(%eax),%eax
+	    || (r = sys_env_set_pgfault_upcall(envid,
+  802ef9:	83 ec 08             	sub    $0x8,%esp
+  802efc:	50                   	push   %eax
+  802efd:	53                   	push   %ebx
+  802efe:	e8 de ed ff ff       	call   801ce1 <sys_env_set_pgfault_upcall>
+  802f03:	89 c6                	mov    %eax,%esi
+  802f05:	83 c4 10             	add    $0x10,%esp
+  802f08:	85 c0                	test   %eax,%eax
+  802f0a:	78 1e                	js     802f2a <ufork+0x20e>
+	    || (r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  802f0c:	83 ec 08             	sub    $0x8,%esp
+  802f0f:	6a 02                	push   $0x2
+  802f11:	53                   	push   %ebx
+  802f12:	e8 bc ea ff ff       	call   8019d3 <sys_env_set_status>
+  802f17:	89 c6                	mov    %eax,%esi
+  802f19:	83 c4 10             	add    $0x10,%esp
+  802f1c:	85 c0                	test   %eax,%eax
+  802f1e:	79 1c                	jns    802f3c <ufork+0x220>
+  802f20:	eb 08                	jmp    802f2a <ufork+0x20e>
+  802f22:	89 c6                	mov    %eax,%esi
+  802f24:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+		goto fail;
+	return envid;
+
+fail:
+	sys_env_destroy(envid);
+  802f2a:	83 ec 0c             	sub    $0xc,%esp
+  802f2d:	53                   	push   %ebx
+  802f2e:	e8 8e e5 ff ff       	call   8014c1 <sys_env_destroy>
+	return r;
+  802f33:	83 c4 10             	add    $0x10,%esp
+  802f36:	89 b5 d4 fb ff ff    	mov    %esi,-0x42c(%ebp)
+}
+  802f3c:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+  802f42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f45:	5b                   	pop    %ebx
+  802f46:	5e                   	pop    %esi
+  802f47:	5f                   	pop    %edi
+  802f48:	5d                   	pop    %ebp
+  802f49:	c3                   	ret
+  802f4a:	89 c6                	mov    %eax,%esi
+  802f4c:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  802f52:	eb d6                	jmp    802f2a <ufork+0x20e>
+
+00802f54 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  802f54:	55                   	push   %ebp
+  802f55:	89 e5                	mov    %esp,%ebp
+  802f57:	53                   	push   %ebx
+  802f58:	83 ec 04             	sub    $0x4,%esp
+	envid_t envid;
+
+	envid = sys_fork();
+  802f5b:	e8 90 f2 ff ff       	call   8021f0 <sys_fork>
+  802f60:	89 c3                	mov    %eax,%ebx
+	if (envid == 0)
+  802f62:	85 c0                	test   %eax,%eax
+  802f64:	74 07                	je     802f6d <fork+0x19>
+		thisenv = &envs[ENVX(sys_getenvid())];
+	return envid;
+}
+  802f66:	89 d8                	mov    %ebx,%eax
+  802f68:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f6b:	c9                   	leave
+  802f6c:	c3                   	ret
+		thisenv = &envs[ENVX(sys_getenvid())];
+  802f6d:	e8 11 e6 ff ff       	call   801583 <sys_getenvid>
+  802f72:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802f77:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802f7d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802f82:	a3 0c 40 80 00       	mov    %eax,0x80400c
+	return envid;
+  802f87:	eb dd                	jmp    802f66 <fork+0x12>
+
+00802f89 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  802f89:	55                   	push   %ebp
+  802f8a:	89 e5                	mov    %esp,%ebp
+  802f8c:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  802f8f:	68 9f 36 80 00       	push   $0x80369f
+  802f94:	68 a1 00 00 00       	push   $0xa1
+  802f99:	68 79 36 80 00       	push   $0x803679
+  802f9e:	e8 48 d7 ff ff       	call   8006eb <_panic>
+
+00802fa3 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802fa3:	55                   	push   %ebp
+  802fa4:	89 e5                	mov    %esp,%ebp
+  802fa6:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  802fa9:	83 3d 14 40 80 00 00 	cmpl   $0x0,0x804014
+  802fb0:	74 0a                	je     802fbc <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  802fb2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fb5:	a3 14 40 80 00       	mov    %eax,0x804014
+}
+  802fba:	c9                   	leave
+  802fbb:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE),
+  802fbc:	83 ec 04             	sub    $0x4,%esp
+  802fbf:	6a 07                	push   $0x7
+  802fc1:	68 00 f0 bf ee       	push   $0xeebff000
+  802fc6:	6a 00                	push   $0x0
+  802fc8:	e8 55 e6 ff ff       	call   801622 <sys_page_alloc>
+  802fcd:	83 c4 10             	add    $0x10,%esp
+  802fd0:	85 c0                	test   %eax,%eax
+  802fd2:	78 28                	js     802ffc <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  802fd4:	83 ec 08             	sub    $0x8,%esp
+  802fd7:	68 0e 30 80 00       	push   $0x80300e
+  802fdc:	6a 00                	push   $0x0
+  802fde:	e8 fe ec ff ff       	call   801ce1 <sys_env_set_pgfault_upcall>
+  802fe3:	83 c4 10             	add    $0x10,%esp
+  802fe6:	85 c0                	test   %eax,%eax
+  802fe8:	79 c8                	jns    802fb2 <set_pgfault_handler+0xf>
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+  802fea:	50                   	push   %eax
+  802feb:	68 e0 36 80 00       	push   $0x8036e0
+  802ff0:	6a 24                	push   $0x24
+  802ff2:	68 14 37 80 00       	push   $0x803714
+  802ff7:	e8 ef d6 ff ff       	call   8006eb <_panic>
+			panic("set_pgfault_handler: sys_page_alloc: %e", r);
+  802ffc:	50                   	push   %eax
+  802ffd:	68 b8 36 80 00       	push   $0x8036b8
+  803002:	6a 22                	push   $0x22
+  803004:	68 14 37 80 00       	push   $0x803714
+  803009:	e8 dd d6 ff ff       	call   8006eb <_panic>
+
+0080300e <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80300e:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80300f:	a1 14 40 80 00       	mov    0x804014,%eax
+	call *%eax
+  803014:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803016:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 0x28(%esp), %ebx		// trap-time eip
+  803019:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl 0x30(%esp), %eax		// trap-time esp
+  80301d:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  803021:	83 e8 04             	sub    $0x4,%eax
+	movl %ebx, (%eax)
+  803024:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 0x30(%esp)
+  803026:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp			// skip fault_va and err
+  80302a:	83 c4 08             	add    $0x8,%esp
+	popal
+  80302d:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp			// skip eip
+  80302e:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803031:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  803032:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803033:	c3                   	ret
+
+00803034 <dm>:
+  803034:	55                   	push   %ebp
+  803035:	57                   	push   %edi
+  803036:	56                   	push   %esi
+  803037:	53                   	push   %ebx
+  803038:	83 ec 24             	sub    $0x24,%esp
+  80303b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80303f:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803043:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803047:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80304b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80304f:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803053:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  803057:	b8 00 00 00 00       	mov    $0x0,%eax
+  80305c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803061:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803066:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80306d:	00 
+  80306e:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803075:	00 
+  803076:	89 fb                	mov    %edi,%ebx
+  803078:	eb 08                	jmp    803082 <dm+0x4e>
+  80307a:	83 e9 01             	sub    $0x1,%ecx
+  80307d:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803080:	74 68                	je     8030ea <dm+0xb6>
+  803082:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803086:	01 c0                	add    %eax,%eax
+  803088:	89 c6                	mov    %eax,%esi
+  80308a:	89 d7                	mov    %edx,%edi
+  80308c:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803090:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803094:	0f ad d0             	shrd   %cl,%edx,%eax
+  803097:	d3 ea                	shr    %cl,%edx
+  803099:	f6 c1 20             	test   $0x20,%cl
+  80309c:	74 04                	je     8030a2 <dm+0x6e>
+  80309e:	89 d0                	mov    %edx,%eax
+  8030a0:	31 d2                	xor    %edx,%edx
+  8030a2:	83 e0 01             	and    $0x1,%eax
+  8030a5:	89 04 24             	mov    %eax,(%esp)
+  8030a8:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8030af:	00 
+  8030b0:	8b 04 24             	mov    (%esp),%eax
+  8030b3:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8030b7:	09 f0                	or     %esi,%eax
+  8030b9:	09 fa                	or     %edi,%edx
+  8030bb:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8030bf:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8030c3:	39 f0                	cmp    %esi,%eax
+  8030c5:	89 d5                	mov    %edx,%ebp
+  8030c7:	19 fd                	sbb    %edi,%ebp
+  8030c9:	72 af                	jb     80307a <dm+0x46>
+  8030cb:	29 f0                	sub    %esi,%eax
+  8030cd:	19 fa                	sbb    %edi,%edx
+  8030cf:	89 cf                	mov    %ecx,%edi
+  8030d1:	c1 ef 05             	shr    $0x5,%edi
+  8030d4:	83 e7 01             	and    $0x1,%edi
+  8030d7:	89 fe                	mov    %edi,%esi
+  8030d9:	83 f6 01             	xor    $0x1,%esi
+  8030dc:	d3 e6                	shl    %cl,%esi
+  8030de:	d3 e7                	shl    %cl,%edi
+  8030e0:	09 74 24 18          	or     %esi,0x18(%esp)
+  8030e4:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8030e8:	eb 90                	jmp    80307a <dm+0x46>
+  8030ea:	85 db                	test   %ebx,%ebx
+  8030ec:	74 05                	je     8030f3 <dm+0xbf>
+  8030ee:	89 03                	mov    %eax,(%ebx)
+  8030f0:	89 53 04             	mov    %edx,0x4(%ebx)
+  8030f3:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8030f7:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8030fb:	83 c4 24             	add    $0x24,%esp
+  8030fe:	5b                   	pop    %ebx
+  8030ff:	5e                   	pop    %esi
+  803100:	5f                   	pop    %edi
+  803101:	5d                   	pop    %ebp
+  803102:	c3                   	ret
+
+00803103 <__udivdi3>:
+  803103:	83 ec 08             	sub    $0x8,%esp
+  803106:	6a 00                	push   $0x0
+  803108:	ff 74 24 1c          	push   0x1c(%esp)
+  80310c:	ff 74 24 1c          	push   0x1c(%esp)
+  803110:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803114:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803118:	e8 17 ff ff ff       	call   803034 <dm>
+  80311d:	83 c4 14             	add    $0x14,%esp
+  803120:	c3                   	ret
+
+00803121 <__umoddi3>:
+  803121:	83 ec 18             	sub    $0x18,%esp
+  803124:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803128:	50                   	push   %eax
+  803129:	ff 74 24 2c          	push   0x2c(%esp)
+  80312d:	ff 74 24 2c          	push   0x2c(%esp)
+  803131:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803135:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803139:	e8 f6 fe ff ff       	call   803034 <dm>
+  80313e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803142:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803146:	83 c4 24             	add    $0x24,%esp
+  803149:	c3                   	ret
+
+0080314a <__divdi3>:
+  80314a:	53                   	push   %ebx
+  80314b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80314f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803153:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803157:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80315b:	85 d2                	test   %edx,%edx
+  80315d:	78 15                	js     803174 <__divdi3+0x2a>
+  80315f:	85 db                	test   %ebx,%ebx
+  803161:	78 34                	js     803197 <__divdi3+0x4d>
+  803163:	83 ec 04             	sub    $0x4,%esp
+  803166:	6a 00                	push   $0x0
+  803168:	53                   	push   %ebx
+  803169:	51                   	push   %ecx
+  80316a:	e8 c5 fe ff ff       	call   803034 <dm>
+  80316f:	83 c4 10             	add    $0x10,%esp
+  803172:	eb 21                	jmp    803195 <__divdi3+0x4b>
+  803174:	f7 d8                	neg    %eax
+  803176:	83 d2 00             	adc    $0x0,%edx
+  803179:	f7 da                	neg    %edx
+  80317b:	85 db                	test   %ebx,%ebx
+  80317d:	78 30                	js     8031af <__divdi3+0x65>
+  80317f:	83 ec 04             	sub    $0x4,%esp
+  803182:	6a 00                	push   $0x0
+  803184:	53                   	push   %ebx
+  803185:	51                   	push   %ecx
+  803186:	e8 a9 fe ff ff       	call   803034 <dm>
+  80318b:	83 c4 10             	add    $0x10,%esp
+  80318e:	f7 d8                	neg    %eax
+  803190:	83 d2 00             	adc    $0x0,%edx
+  803193:	f7 da                	neg    %edx
+  803195:	5b                   	pop    %ebx
+  803196:	c3                   	ret
+  803197:	83 ec 04             	sub    $0x4,%esp
+  80319a:	6a 00                	push   $0x0
+  80319c:	f7 d9                	neg    %ecx
+  80319e:	83 d3 00             	adc    $0x0,%ebx
+  8031a1:	f7 db                	neg    %ebx
+  8031a3:	53                   	push   %ebx
+  8031a4:	51                   	push   %ecx
+  8031a5:	e8 8a fe ff ff       	call   803034 <dm>
+  8031aa:	83 c4 10             	add    $0x10,%esp
+  8031ad:	eb df                	jmp    80318e <__divdi3+0x44>
+  8031af:	83 ec 04             	sub    $0x4,%esp
+  8031b2:	6a 00                	push   $0x0
+  8031b4:	f7 d9                	neg    %ecx
+  8031b6:	83 d3 00             	adc    $0x0,%ebx
+  8031b9:	f7 db                	neg    %ebx
+  8031bb:	53                   	push   %ebx
+  8031bc:	51                   	push   %ecx
+  8031bd:	e8 72 fe ff ff       	call   803034 <dm>
+  8031c2:	83 c4 10             	add    $0x10,%esp
+  8031c5:	eb ce                	jmp    803195 <__divdi3+0x4b>
+
+008031c7 <__moddi3>:
+  8031c7:	55                   	push   %ebp
+  8031c8:	57                   	push   %edi
+  8031c9:	56                   	push   %esi
+  8031ca:	53                   	push   %ebx
+  8031cb:	83 ec 18             	sub    $0x18,%esp
+  8031ce:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  8031d2:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8031d6:	89 f1                	mov    %esi,%ecx
+  8031d8:	f7 d9                	neg    %ecx
+  8031da:	89 da                	mov    %ebx,%edx
+  8031dc:	83 d2 00             	adc    $0x0,%edx
+  8031df:	f7 da                	neg    %edx
+  8031e1:	0f 48 ce             	cmovs  %esi,%ecx
+  8031e4:	0f 48 d3             	cmovs  %ebx,%edx
+  8031e7:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8031eb:	50                   	push   %eax
+  8031ec:	8b 74 24 38          	mov    0x38(%esp),%esi
+  8031f0:	f7 de                	neg    %esi
+  8031f2:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  8031f6:	83 d0 00             	adc    $0x0,%eax
+  8031f9:	f7 d8                	neg    %eax
+  8031fb:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  803200:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  803205:	50                   	push   %eax
+  803206:	56                   	push   %esi
+  803207:	89 c8                	mov    %ecx,%eax
+  803209:	e8 26 fe ff ff       	call   803034 <dm>
+  80320e:	83 c4 10             	add    $0x10,%esp
+  803211:	85 db                	test   %ebx,%ebx
+  803213:	78 10                	js     803225 <__moddi3+0x5e>
+  803215:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803219:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80321d:	83 c4 14             	add    $0x14,%esp
+  803220:	5b                   	pop    %ebx
+  803221:	5e                   	pop    %esi
+  803222:	5f                   	pop    %edi
+  803223:	5d                   	pop    %ebp
+  803224:	c3                   	ret
+  803225:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803229:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80322d:	f7 d8                	neg    %eax
+  80322f:	83 d2 00             	adc    $0x0,%edx
+  803232:	f7 da                	neg    %edx
+  803234:	eb e7                	jmp    80321d <__moddi3+0x56>
@@ -0,0 +1,5690 @@
+
+obj/user/forktree:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 b2 00 00 00       	call   8000e3 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <forktree>:
+	}
+}
+
+void
+forktree(const char *cur)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+  80003a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("%04x: I am '%s'\n", sys_getenvid(), cur);
+  80003d:	e8 15 0f 00 00       	call   800f57 <sys_getenvid>
+  800042:	83 ec 04             	sub    $0x4,%esp
+  800045:	53                   	push   %ebx
+  800046:	50                   	push   %eax
+  800047:	68 a0 2c 80 00       	push   $0x802ca0
+  80004c:	e8 82 01 00 00       	call   8001d3 <cprintf>
+
+	forkchild(cur, '0');
+  800051:	83 c4 08             	add    $0x8,%esp
+  800054:	6a 30                	push   $0x30
+  800056:	53                   	push   %ebx
+  800057:	e8 13 00 00 00       	call   80006f <forkchild>
+	forkchild(cur, '1');
+  80005c:	83 c4 08             	add    $0x8,%esp
+  80005f:	6a 31                	push   $0x31
+  800061:	53                   	push   %ebx
+  800062:	e8 08 00 00 00       	call   80006f <forkchild>
+}
+  800067:	83 c4 10             	add    $0x10,%esp
+  80006a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80006d:	c9                   	leave
+  80006e:	c3                   	ret
+
+0080006f <forkchild>:
+{
+  80006f:	55                   	push   %ebp
+  800070:	89 e5                	mov    %esp,%ebp
+  800072:	56                   	push   %esi
+  800073:	53                   	push   %ebx
+  800074:	83 ec 1c             	sub    $0x1c,%esp
+  800077:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80007a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if (strlen(cur) >= DEPTH)
+  80007d:	53                   	push   %ebx
+  80007e:	e8 03 07 00 00       	call   800786 <strlen>
+  800083:	83 c4 10             	add    $0x10,%esp
+  800086:	83 f8 02             	cmp    $0x2,%eax
+  800089:	7e 07                	jle    800092 <forkchild+0x23>
+}
+  80008b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008e:	5b                   	pop    %ebx
+  80008f:	5e                   	pop    %esi
+  800090:	5d                   	pop    %ebp
+  800091:	c3                   	ret
+	snprintf(nxt, DEPTH+1, "%s%c", cur, branch);
+  800092:	83 ec 0c             	sub    $0xc,%esp
+  800095:	89 f0                	mov    %esi,%eax
+  800097:	0f be f0             	movsbl %al,%esi
+  80009a:	56                   	push   %esi
+  80009b:	53                   	push   %ebx
+  80009c:	68 b1 2c 80 00       	push   $0x802cb1
+  8000a1:	6a 04                	push   $0x4
+  8000a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000a6:	50                   	push   %eax
+  8000a7:	e8 c0 06 00 00       	call   80076c <snprintf>
+	if (fork() == 0) {
+  8000ac:	83 c4 20             	add    $0x20,%esp
+  8000af:	e8 74 28 00 00       	call   802928 <fork>
+  8000b4:	85 c0                	test   %eax,%eax
+  8000b6:	75 d3                	jne    80008b <forkchild+0x1c>
+		forktree(nxt);
+  8000b8:	83 ec 0c             	sub    $0xc,%esp
+  8000bb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000be:	50                   	push   %eax
+  8000bf:	e8 6f ff ff ff       	call   800033 <forktree>
+		exit();
+  8000c4:	e8 63 00 00 00       	call   80012c <exit>
+  8000c9:	83 c4 10             	add    $0x10,%esp
+  8000cc:	eb bd                	jmp    80008b <forkchild+0x1c>
+
+008000ce <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000ce:	55                   	push   %ebp
+  8000cf:	89 e5                	mov    %esp,%ebp
+  8000d1:	83 ec 14             	sub    $0x14,%esp
+	forktree("");
+  8000d4:	68 b0 2c 80 00       	push   $0x802cb0
+  8000d9:	e8 55 ff ff ff       	call   800033 <forktree>
+}
+  8000de:	83 c4 10             	add    $0x10,%esp
+  8000e1:	c9                   	leave
+  8000e2:	c3                   	ret
+
+008000e3 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000e3:	55                   	push   %ebp
+  8000e4:	89 e5                	mov    %esp,%ebp
+  8000e6:	56                   	push   %esi
+  8000e7:	53                   	push   %ebx
+  8000e8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  8000ee:	e8 64 0e 00 00       	call   800f57 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  8000f3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000f8:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  8000fe:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800103:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800108:	85 db                	test   %ebx,%ebx
+  80010a:	7e 07                	jle    800113 <libmain+0x30>
+		binaryname = argv[0];
+  80010c:	8b 06                	mov    (%esi),%eax
+  80010e:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800113:	83 ec 08             	sub    $0x8,%esp
+  800116:	56                   	push   %esi
+  800117:	53                   	push   %ebx
+  800118:	e8 b1 ff ff ff       	call   8000ce <umain>
+
+	// exit gracefully
+	exit();
+  80011d:	e8 0a 00 00 00       	call   80012c <exit>
+}
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800128:	5b                   	pop    %ebx
+  800129:	5e                   	pop    %esi
+  80012a:	5d                   	pop    %ebp
+  80012b:	c3                   	ret
+
+0080012c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80012c:	55                   	push   %ebp
+  80012d:	89 e5                	mov    %esp,%ebp
+  80012f:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  800132:	6a 00                	push   $0x0
+  800134:	e8 5c 0d 00 00       	call   800e95 <sys_env_destroy>
+}
+  800139:	83 c4 10             	add    $0x10,%esp
+  80013c:	c9                   	leave
+  80013d:	c3                   	ret
+
+0080013e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80013e:	55                   	push   %ebp
+  80013f:	89 e5                	mov    %esp,%ebp
+  800141:	53                   	push   %ebx
+  800142:	83 ec 04             	sub    $0x4,%esp
+  800145:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800148:	8b 13                	mov    (%ebx),%edx
+  80014a:	8d 42 01             	lea    0x1(%edx),%eax
+  80014d:	89 03                	mov    %eax,(%ebx)
+  80014f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800152:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800156:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80015b:	74 09                	je     800166 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80015d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800161:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800164:	c9                   	leave
+  800165:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800166:	83 ec 08             	sub    $0x8,%esp
+  800169:	68 ff 00 00 00       	push   $0xff
+  80016e:	8d 43 08             	lea    0x8(%ebx),%eax
+  800171:	50                   	push   %eax
+  800172:	e8 e2 0b 00 00       	call   800d59 <sys_cputs>
+		b->idx = 0;
+  800177:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80017d:	83 c4 10             	add    $0x10,%esp
+  800180:	eb db                	jmp    80015d <putch+0x1f>
+
+00800182 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800182:	55                   	push   %ebp
+  800183:	89 e5                	mov    %esp,%ebp
+  800185:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80018b:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800192:	00 00 00 
+	b.cnt = 0;
+  800195:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80019c:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80019f:	ff 75 0c             	push   0xc(%ebp)
+  8001a2:	ff 75 08             	push   0x8(%ebp)
+  8001a5:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001ab:	50                   	push   %eax
+  8001ac:	68 3e 01 80 00       	push   $0x80013e
+  8001b1:	e8 14 01 00 00       	call   8002ca <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001b6:	83 c4 08             	add    $0x8,%esp
+  8001b9:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001bf:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001c5:	50                   	push   %eax
+  8001c6:	e8 8e 0b 00 00       	call   800d59 <sys_cputs>
+
+	return b.cnt;
+}
+  8001cb:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001d1:	c9                   	leave
+  8001d2:	c3                   	ret
+
+008001d3 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001d3:	55                   	push   %ebp
+  8001d4:	89 e5                	mov    %esp,%ebp
+  8001d6:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001d9:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001dc:	50                   	push   %eax
+  8001dd:	ff 75 08             	push   0x8(%ebp)
+  8001e0:	e8 9d ff ff ff       	call   800182 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001e5:	c9                   	leave
+  8001e6:	c3                   	ret
+
+008001e7 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001e7:	55                   	push   %ebp
+  8001e8:	89 e5                	mov    %esp,%ebp
+  8001ea:	57                   	push   %edi
+  8001eb:	56                   	push   %esi
+  8001ec:	53                   	push   %ebx
+  8001ed:	83 ec 1c             	sub    $0x1c,%esp
+  8001f0:	89 c7                	mov    %eax,%edi
+  8001f2:	89 d6                	mov    %edx,%esi
+  8001f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001f7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001fa:	89 d1                	mov    %edx,%ecx
+  8001fc:	89 c2                	mov    %eax,%edx
+  8001fe:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800201:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800204:	8b 45 10             	mov    0x10(%ebp),%eax
+  800207:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80020a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80020d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800214:	39 c2                	cmp    %eax,%edx
+  800216:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800219:	72 3e                	jb     800259 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80021b:	83 ec 0c             	sub    $0xc,%esp
+  80021e:	ff 75 18             	push   0x18(%ebp)
+  800221:	83 eb 01             	sub    $0x1,%ebx
+  800224:	53                   	push   %ebx
+  800225:	50                   	push   %eax
+  800226:	83 ec 08             	sub    $0x8,%esp
+  800229:	ff 75 e4             	push   -0x1c(%ebp)
+  80022c:	ff 75 e0             	push   -0x20(%ebp)
+  80022f:	ff 75 dc             	push   -0x24(%ebp)
+  800232:	ff 75 d8             	push   -0x28(%ebp)
+  800235:	e8 1c 29 00 00       	call   802b56 <__udivdi3>
+  80023a:	83 c4 18             	add    $0x18,%esp
+  80023d:	52                   	push   %edx
+  80023e:	50                   	push   %eax
+  80023f:	89 f2                	mov    %esi,%edx
+  800241:	89 f8                	mov    %edi,%eax
+  800243:	e8 9f ff ff ff       	call   8001e7 <printnum>
+  800248:	83 c4 20             	add    $0x20,%esp
+  80024b:	eb 13                	jmp    800260 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80024d:	83 ec 08             	sub    $0x8,%esp
+  800250:	56                   	push   %esi
+  800251:	ff 75 18             	push   0x18(%ebp)
+  800254:	ff d7                	call   *%edi
+  800256:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800259:	83 eb 01             	sub    $0x1,%ebx
+  80025c:	85 db                	test   %ebx,%ebx
+  80025e:	7f ed                	jg     80024d <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800260:	83 ec 08             	sub    $0x8,%esp
+  800263:	56                   	push   %esi
+  800264:	83 ec 04             	sub    $0x4,%esp
+  800267:	ff 75 e4             	push   -0x1c(%ebp)
+  80026a:	ff 75 e0             	push   -0x20(%ebp)
+  80026d:	ff 75 dc             	push   -0x24(%ebp)
+  800270:	ff 75 d8             	push   -0x28(%ebp)
+  800273:	e8 fc 28 00 00       	call   802b74 <__umoddi3>
+  800278:	83 c4 14             	add    $0x14,%esp
+  80027b:	0f be 80 c0 2c 80 00 	movsbl 0x802cc0(%eax),%eax
+  800282:	50                   	push   %eax
+  800283:	ff d7                	call   *%edi
+}
+  800285:	83 c4 10             	add    $0x10,%esp
+  800288:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80028b:	5b                   	pop    %ebx
+  80028c:	5e                   	pop    %esi
+  80028d:	5f                   	pop    %edi
+  80028e:	5d                   	pop    %ebp
+  80028f:	c3                   	ret
+
+00800290 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800290:	55                   	push   %ebp
+  800291:	89 e5                	mov    %esp,%ebp
+  800293:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800296:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80029a:	8b 10                	mov    (%eax),%edx
+  80029c:	3b 50 04             	cmp    0x4(%eax),%edx
+  80029f:	73 0a                	jae    8002ab <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002a1:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002a4:	89 08                	mov    %ecx,(%eax)
+  8002a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002a9:	88 02                	mov    %al,(%edx)
+}
+  8002ab:	5d                   	pop    %ebp
+  8002ac:	c3                   	ret
+
+008002ad <printfmt>:
+{
+  8002ad:	55                   	push   %ebp
+  8002ae:	89 e5                	mov    %esp,%ebp
+  8002b0:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002b3:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002b6:	50                   	push   %eax
+  8002b7:	ff 75 10             	push   0x10(%ebp)
+  8002ba:	ff 75 0c             	push   0xc(%ebp)
+  8002bd:	ff 75 08             	push   0x8(%ebp)
+  8002c0:	e8 05 00 00 00       	call   8002ca <vprintfmt>
+}
+  8002c5:	83 c4 10             	add    $0x10,%esp
+  8002c8:	c9                   	leave
+  8002c9:	c3                   	ret
+
+008002ca <vprintfmt>:
+{
+  8002ca:	55                   	push   %ebp
+  8002cb:	89 e5                	mov    %esp,%ebp
+  8002cd:	57                   	push   %edi
+  8002ce:	56                   	push   %esi
+  8002cf:	53                   	push   %ebx
+  8002d0:	83 ec 2c             	sub    $0x2c,%esp
+  8002d3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002d6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002d9:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002dc:	eb 0a                	jmp    8002e8 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002de:	83 ec 08             	sub    $0x8,%esp
+  8002e1:	53                   	push   %ebx
+  8002e2:	50                   	push   %eax
+  8002e3:	ff d6                	call   *%esi
+  8002e5:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002e8:	83 c7 01             	add    $0x1,%edi
+  8002eb:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002ef:	83 f8 25             	cmp    $0x25,%eax
+  8002f2:	74 0c                	je     800300 <vprintfmt+0x36>
+			if (ch == '\0')
+  8002f4:	85 c0                	test   %eax,%eax
+  8002f6:	75 e6                	jne    8002de <vprintfmt+0x14>
+}
+  8002f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002fb:	5b                   	pop    %ebx
+  8002fc:	5e                   	pop    %esi
+  8002fd:	5f                   	pop    %edi
+  8002fe:	5d                   	pop    %ebp
+  8002ff:	c3                   	ret
+		padc = ' ';
+  800300:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800304:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80030b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800312:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800319:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80031e:	8d 47 01             	lea    0x1(%edi),%eax
+  800321:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800324:	0f b6 17             	movzbl (%edi),%edx
+  800327:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80032a:	3c 55                	cmp    $0x55,%al
+  80032c:	0f 87 cf 03 00 00    	ja     800701 <vprintfmt+0x437>
+  800332:	0f b6 c0             	movzbl %al,%eax
+  800335:	ff 24 85 a0 2d 80 00 	jmp    *0x802da0(,%eax,4)
+  80033c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80033f:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800343:	eb d9                	jmp    80031e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800345:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800348:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80034c:	eb d0                	jmp    80031e <vprintfmt+0x54>
+  80034e:	0f b6 d2             	movzbl %dl,%edx
+  800351:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800354:	b8 00 00 00 00       	mov    $0x0,%eax
+  800359:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80035c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80035f:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800363:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800366:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800369:	83 f9 09             	cmp    $0x9,%ecx
+  80036c:	77 55                	ja     8003c3 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80036e:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800371:	eb e9                	jmp    80035c <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800373:	8b 45 14             	mov    0x14(%ebp),%eax
+  800376:	8b 00                	mov    (%eax),%eax
+  800378:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80037b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80037e:	8d 40 04             	lea    0x4(%eax),%eax
+  800381:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800384:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800387:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80038b:	79 91                	jns    80031e <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80038d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800390:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800393:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80039a:	eb 82                	jmp    80031e <vprintfmt+0x54>
+			if (width < 0)
+  80039c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80039f:	85 d2                	test   %edx,%edx
+  8003a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a6:	0f 49 c2             	cmovns %edx,%eax
+  8003a9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ac:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003af:	e9 6a ff ff ff       	jmp    80031e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003b7:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003be:	e9 5b ff ff ff       	jmp    80031e <vprintfmt+0x54>
+  8003c3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003c6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003c9:	eb bc                	jmp    800387 <vprintfmt+0xbd>
+			lflag++;
+  8003cb:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ce:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003d1:	e9 48 ff ff ff       	jmp    80031e <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d9:	8d 78 04             	lea    0x4(%eax),%edi
+  8003dc:	83 ec 08             	sub    $0x8,%esp
+  8003df:	53                   	push   %ebx
+  8003e0:	ff 30                	push   (%eax)
+  8003e2:	ff d6                	call   *%esi
+			break;
+  8003e4:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003e7:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003ea:	e9 b1 02 00 00       	jmp    8006a0 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8003ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f2:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003f5:	8b 10                	mov    (%eax),%edx
+  8003f7:	89 d0                	mov    %edx,%eax
+  8003f9:	f7 d8                	neg    %eax
+  8003fb:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003fe:	83 f8 0d             	cmp    $0xd,%eax
+  800401:	7f 23                	jg     800426 <vprintfmt+0x15c>
+  800403:	8b 14 85 00 2f 80 00 	mov    0x802f00(,%eax,4),%edx
+  80040a:	85 d2                	test   %edx,%edx
+  80040c:	74 18                	je     800426 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80040e:	52                   	push   %edx
+  80040f:	68 e1 2c 80 00       	push   $0x802ce1
+  800414:	53                   	push   %ebx
+  800415:	56                   	push   %esi
+  800416:	e8 92 fe ff ff       	call   8002ad <printfmt>
+  80041b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80041e:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800421:	e9 7a 02 00 00       	jmp    8006a0 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800426:	50                   	push   %eax
+  800427:	68 d8 2c 80 00       	push   $0x802cd8
+  80042c:	53                   	push   %ebx
+  80042d:	56                   	push   %esi
+  80042e:	e8 7a fe ff ff       	call   8002ad <printfmt>
+  800433:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800436:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800439:	e9 62 02 00 00       	jmp    8006a0 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80043e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800441:	83 c0 04             	add    $0x4,%eax
+  800444:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800447:	8b 45 14             	mov    0x14(%ebp),%eax
+  80044a:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80044c:	85 c9                	test   %ecx,%ecx
+  80044e:	b8 d1 2c 80 00       	mov    $0x802cd1,%eax
+  800453:	0f 45 c1             	cmovne %ecx,%eax
+  800456:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800459:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80045d:	7e 06                	jle    800465 <vprintfmt+0x19b>
+  80045f:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800463:	75 0b                	jne    800470 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800465:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800468:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80046b:	89 75 08             	mov    %esi,0x8(%ebp)
+  80046e:	eb 5c                	jmp    8004cc <vprintfmt+0x202>
+  800470:	83 ec 08             	sub    $0x8,%esp
+  800473:	ff 75 d0             	push   -0x30(%ebp)
+  800476:	ff 75 cc             	push   -0x34(%ebp)
+  800479:	e8 20 03 00 00       	call   80079e <strnlen>
+  80047e:	89 c2                	mov    %eax,%edx
+  800480:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800483:	29 d0                	sub    %edx,%eax
+  800485:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800488:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80048c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80048f:	89 75 08             	mov    %esi,0x8(%ebp)
+  800492:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800494:	eb 0e                	jmp    8004a4 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800496:	83 ec 08             	sub    $0x8,%esp
+  800499:	53                   	push   %ebx
+  80049a:	57                   	push   %edi
+  80049b:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80049e:	83 ee 01             	sub    $0x1,%esi
+  8004a1:	83 c4 10             	add    $0x10,%esp
+  8004a4:	85 f6                	test   %esi,%esi
+  8004a6:	7f ee                	jg     800496 <vprintfmt+0x1cc>
+  8004a8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004ab:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004ae:	85 c0                	test   %eax,%eax
+  8004b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004b5:	0f 49 d0             	cmovns %eax,%edx
+  8004b8:	29 d0                	sub    %edx,%eax
+  8004ba:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004bd:	eb a6                	jmp    800465 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004bf:	83 ec 08             	sub    $0x8,%esp
+  8004c2:	53                   	push   %ebx
+  8004c3:	52                   	push   %edx
+  8004c4:	ff 55 08             	call   *0x8(%ebp)
+  8004c7:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004ca:	89 f1                	mov    %esi,%ecx
+  8004cc:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004cf:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004d3:	0f be d0             	movsbl %al,%edx
+  8004d6:	85 d2                	test   %edx,%edx
+  8004d8:	74 28                	je     800502 <vprintfmt+0x238>
+  8004da:	85 ff                	test   %edi,%edi
+  8004dc:	78 05                	js     8004e3 <vprintfmt+0x219>
+  8004de:	83 ef 01             	sub    $0x1,%edi
+  8004e1:	78 30                	js     800513 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004e3:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004e7:	74 d6                	je     8004bf <vprintfmt+0x1f5>
+  8004e9:	0f be c0             	movsbl %al,%eax
+  8004ec:	83 e8 20             	sub    $0x20,%eax
+  8004ef:	83 f8 5e             	cmp    $0x5e,%eax
+  8004f2:	76 cb                	jbe    8004bf <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004f4:	83 ec 08             	sub    $0x8,%esp
+  8004f7:	53                   	push   %ebx
+  8004f8:	6a 3f                	push   $0x3f
+  8004fa:	ff 55 08             	call   *0x8(%ebp)
+  8004fd:	83 c4 10             	add    $0x10,%esp
+  800500:	eb c8                	jmp    8004ca <vprintfmt+0x200>
+  800502:	8b 75 08             	mov    0x8(%ebp),%esi
+  800505:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800508:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80050b:	01 d0                	add    %edx,%eax
+  80050d:	29 c8                	sub    %ecx,%eax
+  80050f:	89 c7                	mov    %eax,%edi
+  800511:	eb 13                	jmp    800526 <vprintfmt+0x25c>
+  800513:	8b 75 08             	mov    0x8(%ebp),%esi
+  800516:	eb ed                	jmp    800505 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800518:	83 ec 08             	sub    $0x8,%esp
+  80051b:	53                   	push   %ebx
+  80051c:	6a 20                	push   $0x20
+  80051e:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800520:	83 ef 01             	sub    $0x1,%edi
+  800523:	83 c4 10             	add    $0x10,%esp
+  800526:	85 ff                	test   %edi,%edi
+  800528:	7f ee                	jg     800518 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80052a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80052d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800530:	e9 6b 01 00 00       	jmp    8006a0 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800535:	83 f9 01             	cmp    $0x1,%ecx
+  800538:	7f 1f                	jg     800559 <vprintfmt+0x28f>
+	else if (lflag)
+  80053a:	85 c9                	test   %ecx,%ecx
+  80053c:	74 67                	je     8005a5 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80053e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800541:	8b 00                	mov    (%eax),%eax
+  800543:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800546:	89 c1                	mov    %eax,%ecx
+  800548:	c1 f9 1f             	sar    $0x1f,%ecx
+  80054b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80054e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800551:	8d 40 04             	lea    0x4(%eax),%eax
+  800554:	89 45 14             	mov    %eax,0x14(%ebp)
+  800557:	eb 17                	jmp    800570 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800559:	8b 45 14             	mov    0x14(%ebp),%eax
+  80055c:	8b 50 04             	mov    0x4(%eax),%edx
+  80055f:	8b 00                	mov    (%eax),%eax
+  800561:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800564:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800567:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056a:	8d 40 08             	lea    0x8(%eax),%eax
+  80056d:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800570:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800573:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800576:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80057b:	85 c9                	test   %ecx,%ecx
+  80057d:	0f 89 03 01 00 00    	jns    800686 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800583:	83 ec 08             	sub    $0x8,%esp
+  800586:	53                   	push   %ebx
+  800587:	6a 2d                	push   $0x2d
+  800589:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80058b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80058e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800591:	f7 da                	neg    %edx
+  800593:	83 d1 00             	adc    $0x0,%ecx
+  800596:	f7 d9                	neg    %ecx
+  800598:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80059b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005a0:	e9 e1 00 00 00       	jmp    800686 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8005a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a8:	8b 00                	mov    (%eax),%eax
+  8005aa:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005ad:	89 c1                	mov    %eax,%ecx
+  8005af:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005b2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b8:	8d 40 04             	lea    0x4(%eax),%eax
+  8005bb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005be:	eb b0                	jmp    800570 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8005c0:	83 f9 01             	cmp    $0x1,%ecx
+  8005c3:	7f 1e                	jg     8005e3 <vprintfmt+0x319>
+	else if (lflag)
+  8005c5:	85 c9                	test   %ecx,%ecx
+  8005c7:	74 32                	je     8005fb <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8005c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005cc:	8b 10                	mov    (%eax),%edx
+  8005ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005d3:	8d 40 04             	lea    0x4(%eax),%eax
+  8005d6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005d9:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005de:	e9 a3 00 00 00       	jmp    800686 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e6:	8b 10                	mov    (%eax),%edx
+  8005e8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005eb:	8d 40 08             	lea    0x8(%eax),%eax
+  8005ee:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005f1:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005f6:	e9 8b 00 00 00       	jmp    800686 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fe:	8b 10                	mov    (%eax),%edx
+  800600:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800605:	8d 40 04             	lea    0x4(%eax),%eax
+  800608:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80060b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800610:	eb 74                	jmp    800686 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800612:	83 f9 01             	cmp    $0x1,%ecx
+  800615:	7f 1b                	jg     800632 <vprintfmt+0x368>
+	else if (lflag)
+  800617:	85 c9                	test   %ecx,%ecx
+  800619:	74 2c                	je     800647 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  80061b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061e:	8b 10                	mov    (%eax),%edx
+  800620:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800625:	8d 40 04             	lea    0x4(%eax),%eax
+  800628:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80062b:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800630:	eb 54                	jmp    800686 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800632:	8b 45 14             	mov    0x14(%ebp),%eax
+  800635:	8b 10                	mov    (%eax),%edx
+  800637:	8b 48 04             	mov    0x4(%eax),%ecx
+  80063a:	8d 40 08             	lea    0x8(%eax),%eax
+  80063d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800640:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800645:	eb 3f                	jmp    800686 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800647:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064a:	8b 10                	mov    (%eax),%edx
+  80064c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800651:	8d 40 04             	lea    0x4(%eax),%eax
+  800654:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800657:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80065c:	eb 28                	jmp    800686 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  80065e:	83 ec 08             	sub    $0x8,%esp
+  800661:	53                   	push   %ebx
+  800662:	6a 30                	push   $0x30
+  800664:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800666:	83 c4 08             	add    $0x8,%esp
+  800669:	53                   	push   %ebx
+  80066a:	6a 78                	push   $0x78
+  80066c:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80066e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800671:	8b 10                	mov    (%eax),%edx
+  800673:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800678:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80067b:	8d 40 04             	lea    0x4(%eax),%eax
+  80067e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800681:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800686:	83 ec 0c             	sub    $0xc,%esp
+  800689:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80068d:	50                   	push   %eax
+  80068e:	ff 75 e0             	push   -0x20(%ebp)
+  800691:	57                   	push   %edi
+  800692:	51                   	push   %ecx
+  800693:	52                   	push   %edx
+  800694:	89 da                	mov    %ebx,%edx
+  800696:	89 f0                	mov    %esi,%eax
+  800698:	e8 4a fb ff ff       	call   8001e7 <printnum>
+			break;
+  80069d:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006a0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006a3:	e9 40 fc ff ff       	jmp    8002e8 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006a8:	83 f9 01             	cmp    $0x1,%ecx
+  8006ab:	7f 1b                	jg     8006c8 <vprintfmt+0x3fe>
+	else if (lflag)
+  8006ad:	85 c9                	test   %ecx,%ecx
+  8006af:	74 2c                	je     8006dd <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8006b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b4:	8b 10                	mov    (%eax),%edx
+  8006b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006bb:	8d 40 04             	lea    0x4(%eax),%eax
+  8006be:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006c1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006c6:	eb be                	jmp    800686 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cb:	8b 10                	mov    (%eax),%edx
+  8006cd:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006d0:	8d 40 08             	lea    0x8(%eax),%eax
+  8006d3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006d6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006db:	eb a9                	jmp    800686 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e0:	8b 10                	mov    (%eax),%edx
+  8006e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e7:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ea:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006ed:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006f2:	eb 92                	jmp    800686 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8006f4:	83 ec 08             	sub    $0x8,%esp
+  8006f7:	53                   	push   %ebx
+  8006f8:	6a 25                	push   $0x25
+  8006fa:	ff d6                	call   *%esi
+			break;
+  8006fc:	83 c4 10             	add    $0x10,%esp
+  8006ff:	eb 9f                	jmp    8006a0 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800701:	83 ec 08             	sub    $0x8,%esp
+  800704:	53                   	push   %ebx
+  800705:	6a 25                	push   $0x25
+  800707:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800709:	83 c4 10             	add    $0x10,%esp
+  80070c:	89 f8                	mov    %edi,%eax
+  80070e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800712:	74 05                	je     800719 <vprintfmt+0x44f>
+  800714:	83 e8 01             	sub    $0x1,%eax
+  800717:	eb f5                	jmp    80070e <vprintfmt+0x444>
+  800719:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80071c:	eb 82                	jmp    8006a0 <vprintfmt+0x3d6>
+
+0080071e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80071e:	55                   	push   %ebp
+  80071f:	89 e5                	mov    %esp,%ebp
+  800721:	83 ec 18             	sub    $0x18,%esp
+  800724:	8b 45 08             	mov    0x8(%ebp),%eax
+  800727:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80072a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80072d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800731:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800734:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80073b:	85 c0                	test   %eax,%eax
+  80073d:	74 26                	je     800765 <vsnprintf+0x47>
+  80073f:	85 d2                	test   %edx,%edx
+  800741:	7e 22                	jle    800765 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800743:	ff 75 14             	push   0x14(%ebp)
+  800746:	ff 75 10             	push   0x10(%ebp)
+  800749:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80074c:	50                   	push   %eax
+  80074d:	68 90 02 80 00       	push   $0x800290
+  800752:	e8 73 fb ff ff       	call   8002ca <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800757:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80075a:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80075d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800760:	83 c4 10             	add    $0x10,%esp
+}
+  800763:	c9                   	leave
+  800764:	c3                   	ret
+		return -E_INVAL;
+  800765:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80076a:	eb f7                	jmp    800763 <vsnprintf+0x45>
+
+0080076c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80076c:	55                   	push   %ebp
+  80076d:	89 e5                	mov    %esp,%ebp
+  80076f:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800772:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800775:	50                   	push   %eax
+  800776:	ff 75 10             	push   0x10(%ebp)
+  800779:	ff 75 0c             	push   0xc(%ebp)
+  80077c:	ff 75 08             	push   0x8(%ebp)
+  80077f:	e8 9a ff ff ff       	call   80071e <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800784:	c9                   	leave
+  800785:	c3                   	ret
+
+00800786 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800786:	55                   	push   %ebp
+  800787:	89 e5                	mov    %esp,%ebp
+  800789:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80078c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800791:	eb 03                	jmp    800796 <strlen+0x10>
+		n++;
+  800793:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800796:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80079a:	75 f7                	jne    800793 <strlen+0xd>
+	return n;
+}
+  80079c:	5d                   	pop    %ebp
+  80079d:	c3                   	ret
+
+0080079e <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80079e:	55                   	push   %ebp
+  80079f:	89 e5                	mov    %esp,%ebp
+  8007a1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007a4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ac:	eb 03                	jmp    8007b1 <strnlen+0x13>
+		n++;
+  8007ae:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007b1:	39 d0                	cmp    %edx,%eax
+  8007b3:	74 08                	je     8007bd <strnlen+0x1f>
+  8007b5:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007b9:	75 f3                	jne    8007ae <strnlen+0x10>
+  8007bb:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007bd:	89 d0                	mov    %edx,%eax
+  8007bf:	5d                   	pop    %ebp
+  8007c0:	c3                   	ret
+
+008007c1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007c1:	55                   	push   %ebp
+  8007c2:	89 e5                	mov    %esp,%ebp
+  8007c4:	53                   	push   %ebx
+  8007c5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007c8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007d4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007d7:	83 c0 01             	add    $0x1,%eax
+  8007da:	84 d2                	test   %dl,%dl
+  8007dc:	75 f2                	jne    8007d0 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007de:	89 c8                	mov    %ecx,%eax
+  8007e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007e3:	c9                   	leave
+  8007e4:	c3                   	ret
+
+008007e5 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007e5:	55                   	push   %ebp
+  8007e6:	89 e5                	mov    %esp,%ebp
+  8007e8:	53                   	push   %ebx
+  8007e9:	83 ec 10             	sub    $0x10,%esp
+  8007ec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007ef:	53                   	push   %ebx
+  8007f0:	e8 91 ff ff ff       	call   800786 <strlen>
+  8007f5:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007f8:	ff 75 0c             	push   0xc(%ebp)
+  8007fb:	01 d8                	add    %ebx,%eax
+  8007fd:	50                   	push   %eax
+  8007fe:	e8 be ff ff ff       	call   8007c1 <strcpy>
+	return dst;
+}
+  800803:	89 d8                	mov    %ebx,%eax
+  800805:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800808:	c9                   	leave
+  800809:	c3                   	ret
+
+0080080a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80080a:	55                   	push   %ebp
+  80080b:	89 e5                	mov    %esp,%ebp
+  80080d:	56                   	push   %esi
+  80080e:	53                   	push   %ebx
+  80080f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800812:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800815:	89 f3                	mov    %esi,%ebx
+  800817:	03 5d 10             	add    0x10(%ebp),%ebx
+  80081a:	89 f0                	mov    %esi,%eax
+  80081c:	eb 0f                	jmp    80082d <strncpy+0x23>
+		*dst++ = *src;
+  80081e:	83 c0 01             	add    $0x1,%eax
+  800821:	0f b6 0a             	movzbl (%edx),%ecx
+  800824:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800827:	80 f9 01             	cmp    $0x1,%cl
+  80082a:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80082d:	39 d8                	cmp    %ebx,%eax
+  80082f:	75 ed                	jne    80081e <strncpy+0x14>
+	}
+	return ret;
+}
+  800831:	89 f0                	mov    %esi,%eax
+  800833:	5b                   	pop    %ebx
+  800834:	5e                   	pop    %esi
+  800835:	5d                   	pop    %ebp
+  800836:	c3                   	ret
+
+00800837 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800837:	55                   	push   %ebp
+  800838:	89 e5                	mov    %esp,%ebp
+  80083a:	56                   	push   %esi
+  80083b:	53                   	push   %ebx
+  80083c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80083f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800842:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800845:	89 f0                	mov    %esi,%eax
+  800847:	85 d2                	test   %edx,%edx
+  800849:	74 21                	je     80086c <strlcpy+0x35>
+  80084b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80084f:	89 f2                	mov    %esi,%edx
+  800851:	eb 09                	jmp    80085c <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800853:	83 c1 01             	add    $0x1,%ecx
+  800856:	83 c2 01             	add    $0x1,%edx
+  800859:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80085c:	39 c2                	cmp    %eax,%edx
+  80085e:	74 09                	je     800869 <strlcpy+0x32>
+  800860:	0f b6 19             	movzbl (%ecx),%ebx
+  800863:	84 db                	test   %bl,%bl
+  800865:	75 ec                	jne    800853 <strlcpy+0x1c>
+  800867:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800869:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80086c:	29 f0                	sub    %esi,%eax
+}
+  80086e:	5b                   	pop    %ebx
+  80086f:	5e                   	pop    %esi
+  800870:	5d                   	pop    %ebp
+  800871:	c3                   	ret
+
+00800872 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800872:	55                   	push   %ebp
+  800873:	89 e5                	mov    %esp,%ebp
+  800875:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800878:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80087b:	eb 06                	jmp    800883 <strcmp+0x11>
+		p++, q++;
+  80087d:	83 c1 01             	add    $0x1,%ecx
+  800880:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800883:	0f b6 01             	movzbl (%ecx),%eax
+  800886:	84 c0                	test   %al,%al
+  800888:	74 04                	je     80088e <strcmp+0x1c>
+  80088a:	3a 02                	cmp    (%edx),%al
+  80088c:	74 ef                	je     80087d <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80088e:	0f b6 c0             	movzbl %al,%eax
+  800891:	0f b6 12             	movzbl (%edx),%edx
+  800894:	29 d0                	sub    %edx,%eax
+}
+  800896:	5d                   	pop    %ebp
+  800897:	c3                   	ret
+
+00800898 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800898:	55                   	push   %ebp
+  800899:	89 e5                	mov    %esp,%ebp
+  80089b:	53                   	push   %ebx
+  80089c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80089f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008a2:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008a5:	eb 09                	jmp    8008b0 <strncmp+0x18>
+		n--, p++, q++;
+  8008a7:	83 ea 01             	sub    $0x1,%edx
+  8008aa:	83 c0 01             	add    $0x1,%eax
+  8008ad:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008b0:	85 d2                	test   %edx,%edx
+  8008b2:	74 18                	je     8008cc <strncmp+0x34>
+  8008b4:	0f b6 18             	movzbl (%eax),%ebx
+  8008b7:	84 db                	test   %bl,%bl
+  8008b9:	74 04                	je     8008bf <strncmp+0x27>
+  8008bb:	3a 19                	cmp    (%ecx),%bl
+  8008bd:	74 e8                	je     8008a7 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008bf:	0f b6 00             	movzbl (%eax),%eax
+  8008c2:	0f b6 11             	movzbl (%ecx),%edx
+  8008c5:	29 d0                	sub    %edx,%eax
+}
+  8008c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008ca:	c9                   	leave
+  8008cb:	c3                   	ret
+		return 0;
+  8008cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d1:	eb f4                	jmp    8008c7 <strncmp+0x2f>
+
+008008d3 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008d3:	55                   	push   %ebp
+  8008d4:	89 e5                	mov    %esp,%ebp
+  8008d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008d9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008dd:	eb 03                	jmp    8008e2 <strchr+0xf>
+  8008df:	83 c0 01             	add    $0x1,%eax
+  8008e2:	0f b6 10             	movzbl (%eax),%edx
+  8008e5:	84 d2                	test   %dl,%dl
+  8008e7:	74 06                	je     8008ef <strchr+0x1c>
+		if (*s == c)
+  8008e9:	38 ca                	cmp    %cl,%dl
+  8008eb:	75 f2                	jne    8008df <strchr+0xc>
+  8008ed:	eb 05                	jmp    8008f4 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008f4:	5d                   	pop    %ebp
+  8008f5:	c3                   	ret
+
+008008f6 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008f6:	55                   	push   %ebp
+  8008f7:	89 e5                	mov    %esp,%ebp
+  8008f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008fc:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800900:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800903:	38 ca                	cmp    %cl,%dl
+  800905:	74 09                	je     800910 <strfind+0x1a>
+  800907:	84 d2                	test   %dl,%dl
+  800909:	74 05                	je     800910 <strfind+0x1a>
+	for (; *s; s++)
+  80090b:	83 c0 01             	add    $0x1,%eax
+  80090e:	eb f0                	jmp    800900 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800910:	5d                   	pop    %ebp
+  800911:	c3                   	ret
+
+00800912 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800912:	55                   	push   %ebp
+  800913:	89 e5                	mov    %esp,%ebp
+  800915:	57                   	push   %edi
+  800916:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800919:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80091c:	85 c9                	test   %ecx,%ecx
+  80091e:	74 20                	je     800940 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800920:	89 f8                	mov    %edi,%eax
+  800922:	09 c8                	or     %ecx,%eax
+  800924:	a8 03                	test   $0x3,%al
+  800926:	75 12                	jne    80093a <memset+0x28>
+		c &= 0xFF;
+  800928:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80092c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800932:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800935:	fc                   	cld
+  800936:	f3 ab                	rep stos %eax,%es:(%edi)
+  800938:	eb 06                	jmp    800940 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80093a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80093d:	fc                   	cld
+  80093e:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800940:	89 f8                	mov    %edi,%eax
+  800942:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800945:	c9                   	leave
+  800946:	c3                   	ret
+
+00800947 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800947:	55                   	push   %ebp
+  800948:	89 e5                	mov    %esp,%ebp
+  80094a:	57                   	push   %edi
+  80094b:	56                   	push   %esi
+  80094c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80094f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800952:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800955:	39 c6                	cmp    %eax,%esi
+  800957:	73 32                	jae    80098b <memmove+0x44>
+  800959:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80095c:	39 d0                	cmp    %edx,%eax
+  80095e:	73 2b                	jae    80098b <memmove+0x44>
+		s += n;
+		d += n;
+  800960:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800963:	89 d6                	mov    %edx,%esi
+  800965:	09 fe                	or     %edi,%esi
+  800967:	09 ce                	or     %ecx,%esi
+  800969:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80096f:	75 0e                	jne    80097f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800971:	83 ef 04             	sub    $0x4,%edi
+  800974:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800977:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80097a:	fd                   	std
+  80097b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80097d:	eb 09                	jmp    800988 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80097f:	83 ef 01             	sub    $0x1,%edi
+  800982:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800985:	fd                   	std
+  800986:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800988:	fc                   	cld
+  800989:	eb 1a                	jmp    8009a5 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80098b:	89 f2                	mov    %esi,%edx
+  80098d:	09 c2                	or     %eax,%edx
+  80098f:	09 ca                	or     %ecx,%edx
+  800991:	f6 c2 03             	test   $0x3,%dl
+  800994:	75 0a                	jne    8009a0 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800996:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800999:	89 c7                	mov    %eax,%edi
+  80099b:	fc                   	cld
+  80099c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80099e:	eb 05                	jmp    8009a5 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009a0:	89 c7                	mov    %eax,%edi
+  8009a2:	fc                   	cld
+  8009a3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009a5:	5e                   	pop    %esi
+  8009a6:	5f                   	pop    %edi
+  8009a7:	5d                   	pop    %ebp
+  8009a8:	c3                   	ret
+
+008009a9 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009a9:	55                   	push   %ebp
+  8009aa:	89 e5                	mov    %esp,%ebp
+  8009ac:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009af:	ff 75 10             	push   0x10(%ebp)
+  8009b2:	ff 75 0c             	push   0xc(%ebp)
+  8009b5:	ff 75 08             	push   0x8(%ebp)
+  8009b8:	e8 8a ff ff ff       	call   800947 <memmove>
+}
+  8009bd:	c9                   	leave
+  8009be:	c3                   	ret
+
+008009bf <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009bf:	55                   	push   %ebp
+  8009c0:	89 e5                	mov    %esp,%ebp
+  8009c2:	56                   	push   %esi
+  8009c3:	53                   	push   %ebx
+  8009c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009ca:	89 c6                	mov    %eax,%esi
+  8009cc:	03 75 10             	add    0x10(%ebp),%esi
+  8009cf:	eb 06                	jmp    8009d7 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009d1:	83 c0 01             	add    $0x1,%eax
+  8009d4:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009d7:	39 f0                	cmp    %esi,%eax
+  8009d9:	74 14                	je     8009ef <memcmp+0x30>
+		if (*s1 != *s2)
+  8009db:	0f b6 08             	movzbl (%eax),%ecx
+  8009de:	0f b6 1a             	movzbl (%edx),%ebx
+  8009e1:	38 d9                	cmp    %bl,%cl
+  8009e3:	74 ec                	je     8009d1 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009e5:	0f b6 c1             	movzbl %cl,%eax
+  8009e8:	0f b6 db             	movzbl %bl,%ebx
+  8009eb:	29 d8                	sub    %ebx,%eax
+  8009ed:	eb 05                	jmp    8009f4 <memcmp+0x35>
+	}
+
+	return 0;
+  8009ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009f4:	5b                   	pop    %ebx
+  8009f5:	5e                   	pop    %esi
+  8009f6:	5d                   	pop    %ebp
+  8009f7:	c3                   	ret
+
+008009f8 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009f8:	55                   	push   %ebp
+  8009f9:	89 e5                	mov    %esp,%ebp
+  8009fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a01:	89 c2                	mov    %eax,%edx
+  800a03:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a06:	eb 03                	jmp    800a0b <memfind+0x13>
+  800a08:	83 c0 01             	add    $0x1,%eax
+  800a0b:	39 d0                	cmp    %edx,%eax
+  800a0d:	73 04                	jae    800a13 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a0f:	38 08                	cmp    %cl,(%eax)
+  800a11:	75 f5                	jne    800a08 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a13:	5d                   	pop    %ebp
+  800a14:	c3                   	ret
+
+00800a15 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a15:	55                   	push   %ebp
+  800a16:	89 e5                	mov    %esp,%ebp
+  800a18:	57                   	push   %edi
+  800a19:	56                   	push   %esi
+  800a1a:	53                   	push   %ebx
+  800a1b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a1e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a21:	eb 03                	jmp    800a26 <strtol+0x11>
+		s++;
+  800a23:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a26:	0f b6 02             	movzbl (%edx),%eax
+  800a29:	3c 20                	cmp    $0x20,%al
+  800a2b:	74 f6                	je     800a23 <strtol+0xe>
+  800a2d:	3c 09                	cmp    $0x9,%al
+  800a2f:	74 f2                	je     800a23 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a31:	3c 2b                	cmp    $0x2b,%al
+  800a33:	74 2a                	je     800a5f <strtol+0x4a>
+	int neg = 0;
+  800a35:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a3a:	3c 2d                	cmp    $0x2d,%al
+  800a3c:	74 2b                	je     800a69 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a3e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a44:	75 0f                	jne    800a55 <strtol+0x40>
+  800a46:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a49:	74 28                	je     800a73 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a4b:	85 db                	test   %ebx,%ebx
+  800a4d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a52:	0f 44 d8             	cmove  %eax,%ebx
+  800a55:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a5a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a5d:	eb 46                	jmp    800aa5 <strtol+0x90>
+		s++;
+  800a5f:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a62:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a67:	eb d5                	jmp    800a3e <strtol+0x29>
+		s++, neg = 1;
+  800a69:	83 c2 01             	add    $0x1,%edx
+  800a6c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a71:	eb cb                	jmp    800a3e <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a73:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a77:	74 0e                	je     800a87 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a79:	85 db                	test   %ebx,%ebx
+  800a7b:	75 d8                	jne    800a55 <strtol+0x40>
+		s++, base = 8;
+  800a7d:	83 c2 01             	add    $0x1,%edx
+  800a80:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a85:	eb ce                	jmp    800a55 <strtol+0x40>
+		s += 2, base = 16;
+  800a87:	83 c2 02             	add    $0x2,%edx
+  800a8a:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a8f:	eb c4                	jmp    800a55 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a91:	0f be c0             	movsbl %al,%eax
+  800a94:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a97:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a9a:	7d 3a                	jge    800ad6 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a9c:	83 c2 01             	add    $0x1,%edx
+  800a9f:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800aa3:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800aa5:	0f b6 02             	movzbl (%edx),%eax
+  800aa8:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800aab:	89 f3                	mov    %esi,%ebx
+  800aad:	80 fb 09             	cmp    $0x9,%bl
+  800ab0:	76 df                	jbe    800a91 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ab2:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ab5:	89 f3                	mov    %esi,%ebx
+  800ab7:	80 fb 19             	cmp    $0x19,%bl
+  800aba:	77 08                	ja     800ac4 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800abc:	0f be c0             	movsbl %al,%eax
+  800abf:	83 e8 57             	sub    $0x57,%eax
+  800ac2:	eb d3                	jmp    800a97 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ac4:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ac7:	89 f3                	mov    %esi,%ebx
+  800ac9:	80 fb 19             	cmp    $0x19,%bl
+  800acc:	77 08                	ja     800ad6 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800ace:	0f be c0             	movsbl %al,%eax
+  800ad1:	83 e8 37             	sub    $0x37,%eax
+  800ad4:	eb c1                	jmp    800a97 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ad6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ada:	74 05                	je     800ae1 <strtol+0xcc>
+		*endptr = (char *) s;
+  800adc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800adf:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ae1:	89 c8                	mov    %ecx,%eax
+  800ae3:	f7 d8                	neg    %eax
+  800ae5:	85 ff                	test   %edi,%edi
+  800ae7:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800aea:	89 c8                	mov    %ecx,%eax
+  800aec:	5b                   	pop    %ebx
+  800aed:	5e                   	pop    %esi
+  800aee:	5f                   	pop    %edi
+  800aef:	5d                   	pop    %ebp
+  800af0:	c3                   	ret
+
+00800af1 <atoi>:
+
+int
+atoi(const char *s)
+{
+  800af1:	55                   	push   %ebp
+  800af2:	89 e5                	mov    %esp,%ebp
+  800af4:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800af7:	6a 0a                	push   $0xa
+  800af9:	6a 00                	push   $0x0
+  800afb:	ff 75 08             	push   0x8(%ebp)
+  800afe:	e8 12 ff ff ff       	call   800a15 <strtol>
+}
+  800b03:	c9                   	leave
+  800b04:	c3                   	ret
+
+00800b05 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800b05:	55                   	push   %ebp
+  800b06:	89 e5                	mov    %esp,%ebp
+  800b08:	57                   	push   %edi
+  800b09:	56                   	push   %esi
+  800b0a:	53                   	push   %ebx
+  800b0b:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800b11:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800b17:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800b1d:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800b23:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800b2a:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800b2d:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800b34:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800b37:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800b3e:	74 76                	je     800bb6 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800b40:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800b46:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b49:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800b4f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800b56:	0f 88 06 01 00 00    	js     800c62 <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800b5c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800b63:	0f 84 48 01 00 00    	je     800cb1 <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800b69:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800b6f:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800b75:	be 00 00 00 00       	mov    $0x0,%esi
+  800b7a:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800b80:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b83:	55                   	push   %ebp
+  800b84:	68 8d 0b 80 00       	push   $0x800b8d
+  800b89:	89 e5                	mov    %esp,%ebp
+  800b8b:	0f 34                	sysenter
+  800b8d:	83 c4 04             	add    $0x4,%esp
+  800b90:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800b91:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800b97:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800b9d:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800ba0:	0f 85 9a 01 00 00    	jne    800d40 <page_vec_call+0x23b>
+  800ba6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bab:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bae:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bb1:	e9 29 01 00 00       	jmp    800cdf <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800bb6:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800bbc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bbf:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800bc1:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800bc8:	78 2f                	js     800bf9 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800bca:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800bd1:	74 72                	je     800c45 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800bd3:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800bd9:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800bdf:	b8 10 00 00 00       	mov    $0x10,%eax
+  800be4:	89 fb                	mov    %edi,%ebx
+  800be6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800be9:	55                   	push   %ebp
+  800bea:	68 f3 0b 80 00       	push   $0x800bf3
+  800bef:	89 e5                	mov    %esp,%ebp
+  800bf1:	0f 34                	sysenter
+  800bf3:	83 c4 04             	add    $0x4,%esp
+  800bf6:	5d                   	pop    %ebp
+	return ret;
+  800bf7:	eb 98                	jmp    800b91 <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800bf9:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bfe:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800c00:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800c05:	f6 c6 08             	test   $0x8,%dh
+  800c08:	74 15                	je     800c1f <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c0a:	89 c2                	mov    %eax,%edx
+  800c0c:	c1 ea 08             	shr    $0x8,%edx
+  800c0f:	83 e2 0f             	and    $0xf,%edx
+  800c12:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800c17:	83 fa 06             	cmp    $0x6,%edx
+  800c1a:	74 0e                	je     800c2a <page_vec_call+0x125>
+  800c1c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800c1f:	0f b6 c9             	movzbl %cl,%ecx
+  800c22:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800c28:	eb a0                	jmp    800bca <page_vec_call+0xc5>
+  800c2a:	89 c2                	mov    %eax,%edx
+  800c2c:	c1 ea 04             	shr    $0x4,%edx
+  800c2f:	83 e2 0f             	and    $0xf,%edx
+  800c32:	83 fa 02             	cmp    $0x2,%edx
+  800c35:	77 e5                	ja     800c1c <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800c37:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c3a:	83 f8 02             	cmp    $0x2,%eax
+  800c3d:	0f 97 c1             	seta   %cl
+  800c40:	0f b6 c9             	movzbl %cl,%ecx
+  800c43:	eb d7                	jmp    800c1c <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800c45:	b8 10 00 00 00       	mov    $0x10,%eax
+  800c4a:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800c50:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800c56:	89 fb                	mov    %edi,%ebx
+  800c58:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c5b:	cd 30                	int    $0x30
+  800c5d:	e9 2f ff ff ff       	jmp    800b91 <page_vec_call+0x8c>
+  800c62:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c67:	0f a2                	cpuid
+		return 0;
+  800c69:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800c6e:	f6 c6 08             	test   $0x8,%dh
+  800c71:	74 15                	je     800c88 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c73:	89 c2                	mov    %eax,%edx
+  800c75:	c1 ea 08             	shr    $0x8,%edx
+  800c78:	83 e2 0f             	and    $0xf,%edx
+  800c7b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800c80:	83 fa 06             	cmp    $0x6,%edx
+  800c83:	74 11                	je     800c96 <page_vec_call+0x191>
+  800c85:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800c88:	0f b6 c9             	movzbl %cl,%ecx
+  800c8b:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800c91:	e9 c6 fe ff ff       	jmp    800b5c <page_vec_call+0x57>
+  800c96:	89 c2                	mov    %eax,%edx
+  800c98:	c1 ea 04             	shr    $0x4,%edx
+  800c9b:	83 e2 0f             	and    $0xf,%edx
+  800c9e:	83 fa 02             	cmp    $0x2,%edx
+  800ca1:	77 e2                	ja     800c85 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800ca3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ca6:	83 f8 02             	cmp    $0x2,%eax
+  800ca9:	0f 97 c1             	seta   %cl
+  800cac:	0f b6 c9             	movzbl %cl,%ecx
+  800caf:	eb d4                	jmp    800c85 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800cb1:	be 00 00 00 00       	mov    $0x0,%esi
+  800cb6:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800cbc:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800cc2:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800cc8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ccb:	cd 30                	int    $0x30
+  800ccd:	e9 bf fe ff ff       	jmp    800b91 <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800cd2:	29 da                	sub    %ebx,%edx
+			vec++;
+  800cd4:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800cd7:	83 e8 01             	sub    $0x1,%eax
+  800cda:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800cdf:	85 c0                	test   %eax,%eax
+  800ce1:	74 58                	je     800d3b <page_vec_call+0x236>
+  800ce3:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800ce6:	39 da                	cmp    %ebx,%edx
+  800ce8:	73 e8                	jae    800cd2 <page_vec_call+0x1cd>
+  800cea:	89 75 08             	mov    %esi,0x8(%ebp)
+  800ced:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800cf0:	84 c9                	test   %cl,%cl
+  800cf2:	74 06                	je     800cfa <page_vec_call+0x1f5>
+  800cf4:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800cfa:	83 ec 04             	sub    $0x4,%esp
+  800cfd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d00:	c1 e0 04             	shl    $0x4,%eax
+  800d03:	50                   	push   %eax
+  800d04:	ff 75 08             	push   0x8(%ebp)
+  800d07:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800d0d:	53                   	push   %ebx
+  800d0e:	e8 34 fc ff ff       	call   800947 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800d13:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800d19:	89 c2                	mov    %eax,%edx
+  800d1b:	c1 e2 0c             	shl    $0xc,%edx
+  800d1e:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  800d24:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  800d2a:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  800d30:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  800d33:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  800d36:	e9 f2 fd ff ff       	jmp    800b2d <page_vec_call+0x28>
+			r = 0;
+  800d3b:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  800d40:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800d44:	74 0b                	je     800d51 <page_vec_call+0x24c>
+		*done = total;
+  800d46:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800d49:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  800d4f:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  800d51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d54:	5b                   	pop    %ebx
+  800d55:	5e                   	pop    %esi
+  800d56:	5f                   	pop    %edi
+  800d57:	5d                   	pop    %ebp
+  800d58:	c3                   	ret
+
+00800d59 <sys_cputs>:
+{
+  800d59:	55                   	push   %ebp
+  800d5a:	89 e5                	mov    %esp,%ebp
+  800d5c:	57                   	push   %edi
+  800d5d:	56                   	push   %esi
+  800d5e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800d5f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800d66:	78 2d                	js     800d95 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800d68:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800d6f:	74 70                	je     800de1 <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800d71:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d7c:	89 c3                	mov    %eax,%ebx
+  800d7e:	89 c7                	mov    %eax,%edi
+  800d80:	89 c6                	mov    %eax,%esi
+  800d82:	55                   	push   %ebp
+  800d83:	68 8c 0d 80 00       	push   $0x800d8c
+  800d88:	89 e5                	mov    %esp,%ebp
+  800d8a:	0f 34                	sysenter
+  800d8c:	83 c4 04             	add    $0x4,%esp
+  800d8f:	5d                   	pop    %ebp
+}
+  800d90:	5b                   	pop    %ebx
+  800d91:	5e                   	pop    %esi
+  800d92:	5f                   	pop    %edi
+  800d93:	5d                   	pop    %ebp
+  800d94:	c3                   	ret
+  800d95:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d9a:	0f a2                	cpuid
+		return 0;
+  800d9c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800da1:	f6 c6 08             	test   $0x8,%dh
+  800da4:	74 15                	je     800dbb <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800da6:	89 c2                	mov    %eax,%edx
+  800da8:	c1 ea 08             	shr    $0x8,%edx
+  800dab:	83 e2 0f             	and    $0xf,%edx
+  800dae:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800db3:	83 fa 06             	cmp    $0x6,%edx
+  800db6:	74 0e                	je     800dc6 <sys_cputs+0x6d>
+  800db8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800dbb:	0f b6 c9             	movzbl %cl,%ecx
+  800dbe:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800dc4:	eb a2                	jmp    800d68 <sys_cputs+0xf>
+  800dc6:	89 c2                	mov    %eax,%edx
+  800dc8:	c1 ea 04             	shr    $0x4,%edx
+  800dcb:	83 e2 0f             	and    $0xf,%edx
+  800dce:	83 fa 02             	cmp    $0x2,%edx
+  800dd1:	77 e5                	ja     800db8 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800dd3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800dd6:	83 f8 02             	cmp    $0x2,%eax
+  800dd9:	0f 97 c1             	seta   %cl
+  800ddc:	0f b6 c9             	movzbl %cl,%ecx
+  800ddf:	eb d7                	jmp    800db8 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800de1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800de6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dec:	89 c3                	mov    %eax,%ebx
+  800dee:	89 c7                	mov    %eax,%edi
+  800df0:	89 c6                	mov    %eax,%esi
+  800df2:	cd 30                	int    $0x30
+}
+  800df4:	eb 9a                	jmp    800d90 <sys_cputs+0x37>
+
+00800df6 <sys_cgetc>:
+{
+  800df6:	55                   	push   %ebp
+  800df7:	89 e5                	mov    %esp,%ebp
+  800df9:	57                   	push   %edi
+  800dfa:	56                   	push   %esi
+  800dfb:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800dfc:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e03:	78 2e                	js     800e33 <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  800e05:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e0c:	74 71                	je     800e7f <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  800e0e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e13:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e18:	89 d1                	mov    %edx,%ecx
+  800e1a:	89 d3                	mov    %edx,%ebx
+  800e1c:	89 d7                	mov    %edx,%edi
+  800e1e:	89 d6                	mov    %edx,%esi
+  800e20:	55                   	push   %ebp
+  800e21:	68 2a 0e 80 00       	push   $0x800e2a
+  800e26:	89 e5                	mov    %esp,%ebp
+  800e28:	0f 34                	sysenter
+  800e2a:	83 c4 04             	add    $0x4,%esp
+  800e2d:	5d                   	pop    %ebp
+}
+  800e2e:	5b                   	pop    %ebx
+  800e2f:	5e                   	pop    %esi
+  800e30:	5f                   	pop    %edi
+  800e31:	5d                   	pop    %ebp
+  800e32:	c3                   	ret
+  800e33:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e38:	0f a2                	cpuid
+		return 0;
+  800e3a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800e3f:	f6 c6 08             	test   $0x8,%dh
+  800e42:	74 15                	je     800e59 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e44:	89 c2                	mov    %eax,%edx
+  800e46:	c1 ea 08             	shr    $0x8,%edx
+  800e49:	83 e2 0f             	and    $0xf,%edx
+  800e4c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e51:	83 fa 06             	cmp    $0x6,%edx
+  800e54:	74 0e                	je     800e64 <sys_cgetc+0x6e>
+  800e56:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e59:	0f b6 c9             	movzbl %cl,%ecx
+  800e5c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800e62:	eb a1                	jmp    800e05 <sys_cgetc+0xf>
+  800e64:	89 c2                	mov    %eax,%edx
+  800e66:	c1 ea 04             	shr    $0x4,%edx
+  800e69:	83 e2 0f             	and    $0xf,%edx
+  800e6c:	83 fa 02             	cmp    $0x2,%edx
+  800e6f:	77 e5                	ja     800e56 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  800e71:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e74:	83 f8 02             	cmp    $0x2,%eax
+  800e77:	0f 97 c1             	seta   %cl
+  800e7a:	0f b6 c9             	movzbl %cl,%ecx
+  800e7d:	eb d7                	jmp    800e56 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  800e7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e84:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e89:	89 d1                	mov    %edx,%ecx
+  800e8b:	89 d3                	mov    %edx,%ebx
+  800e8d:	89 d7                	mov    %edx,%edi
+  800e8f:	89 d6                	mov    %edx,%esi
+  800e91:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800e93:	eb 99                	jmp    800e2e <sys_cgetc+0x38>
+
+00800e95 <sys_env_destroy>:
+{
+  800e95:	55                   	push   %ebp
+  800e96:	89 e5                	mov    %esp,%ebp
+  800e98:	57                   	push   %edi
+  800e99:	56                   	push   %esi
+  800e9a:	53                   	push   %ebx
+  800e9b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800e9e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800ea5:	78 36                	js     800edd <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  800ea7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800eae:	74 79                	je     800f29 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  800eb0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800eb8:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ebd:	89 cb                	mov    %ecx,%ebx
+  800ebf:	89 cf                	mov    %ecx,%edi
+  800ec1:	89 ce                	mov    %ecx,%esi
+  800ec3:	55                   	push   %ebp
+  800ec4:	68 cd 0e 80 00       	push   $0x800ecd
+  800ec9:	89 e5                	mov    %esp,%ebp
+  800ecb:	0f 34                	sysenter
+  800ecd:	83 c4 04             	add    $0x4,%esp
+  800ed0:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ed1:	85 c0                	test   %eax,%eax
+  800ed3:	7f 6b                	jg     800f40 <sys_env_destroy+0xab>
+}
+  800ed5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed8:	5b                   	pop    %ebx
+  800ed9:	5e                   	pop    %esi
+  800eda:	5f                   	pop    %edi
+  800edb:	5d                   	pop    %ebp
+  800edc:	c3                   	ret
+  800edd:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ee2:	0f a2                	cpuid
+		return 0;
+  800ee4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800ee9:	f6 c6 08             	test   $0x8,%dh
+  800eec:	74 15                	je     800f03 <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800eee:	89 c2                	mov    %eax,%edx
+  800ef0:	c1 ea 08             	shr    $0x8,%edx
+  800ef3:	83 e2 0f             	and    $0xf,%edx
+  800ef6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800efb:	83 fa 06             	cmp    $0x6,%edx
+  800efe:	74 0e                	je     800f0e <sys_env_destroy+0x79>
+  800f00:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f03:	0f b6 c9             	movzbl %cl,%ecx
+  800f06:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800f0c:	eb 99                	jmp    800ea7 <sys_env_destroy+0x12>
+  800f0e:	89 c2                	mov    %eax,%edx
+  800f10:	c1 ea 04             	shr    $0x4,%edx
+  800f13:	83 e2 0f             	and    $0xf,%edx
+  800f16:	83 fa 02             	cmp    $0x2,%edx
+  800f19:	77 e5                	ja     800f00 <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  800f1b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f1e:	83 f8 02             	cmp    $0x2,%eax
+  800f21:	0f 97 c1             	seta   %cl
+  800f24:	0f b6 c9             	movzbl %cl,%ecx
+  800f27:	eb d7                	jmp    800f00 <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  800f29:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f2e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f33:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f36:	89 cb                	mov    %ecx,%ebx
+  800f38:	89 cf                	mov    %ecx,%edi
+  800f3a:	89 ce                	mov    %ecx,%esi
+  800f3c:	cd 30                	int    $0x30
+  800f3e:	eb 91                	jmp    800ed1 <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f40:	83 ec 0c             	sub    $0xc,%esp
+  800f43:	50                   	push   %eax
+  800f44:	6a 03                	push   $0x3
+  800f46:	68 79 2f 80 00       	push   $0x802f79
+  800f4b:	6a 4a                	push   $0x4a
+  800f4d:	68 96 2f 80 00       	push   $0x802f96
+  800f52:	e8 20 1a 00 00       	call   802977 <_panic>
+
+00800f57 <sys_getenvid>:
+{
+  800f57:	55                   	push   %ebp
+  800f58:	89 e5                	mov    %esp,%ebp
+  800f5a:	57                   	push   %edi
+  800f5b:	56                   	push   %esi
+  800f5c:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800f5d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800f64:	78 2e                	js     800f94 <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  800f66:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800f6d:	74 71                	je     800fe0 <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  800f6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f74:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f79:	89 d1                	mov    %edx,%ecx
+  800f7b:	89 d3                	mov    %edx,%ebx
+  800f7d:	89 d7                	mov    %edx,%edi
+  800f7f:	89 d6                	mov    %edx,%esi
+  800f81:	55                   	push   %ebp
+  800f82:	68 8b 0f 80 00       	push   $0x800f8b
+  800f87:	89 e5                	mov    %esp,%ebp
+  800f89:	0f 34                	sysenter
+  800f8b:	83 c4 04             	add    $0x4,%esp
+  800f8e:	5d                   	pop    %ebp
+}
+  800f8f:	5b                   	pop    %ebx
+  800f90:	5e                   	pop    %esi
+  800f91:	5f                   	pop    %edi
+  800f92:	5d                   	pop    %ebp
+  800f93:	c3                   	ret
+  800f94:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f99:	0f a2                	cpuid
+		return 0;
+  800f9b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800fa0:	f6 c6 08             	test   $0x8,%dh
+  800fa3:	74 15                	je     800fba <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800fa5:	89 c2                	mov    %eax,%edx
+  800fa7:	c1 ea 08             	shr    $0x8,%edx
+  800faa:	83 e2 0f             	and    $0xf,%edx
+  800fad:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800fb2:	83 fa 06             	cmp    $0x6,%edx
+  800fb5:	74 0e                	je     800fc5 <sys_getenvid+0x6e>
+  800fb7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800fba:	0f b6 c9             	movzbl %cl,%ecx
+  800fbd:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800fc3:	eb a1                	jmp    800f66 <sys_getenvid+0xf>
+  800fc5:	89 c2                	mov    %eax,%edx
+  800fc7:	c1 ea 04             	shr    $0x4,%edx
+  800fca:	83 e2 0f             	and    $0xf,%edx
+  800fcd:	83 fa 02             	cmp    $0x2,%edx
+  800fd0:	77 e5                	ja     800fb7 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  800fd2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800fd5:	83 f8 02             	cmp    $0x2,%eax
+  800fd8:	0f 97 c1             	seta   %cl
+  800fdb:	0f b6 c9             	movzbl %cl,%ecx
+  800fde:	eb d7                	jmp    800fb7 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  800fe0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fe5:	b8 02 00 00 00       	mov    $0x2,%eax
+  800fea:	89 d1                	mov    %edx,%ecx
+  800fec:	89 d3                	mov    %edx,%ebx
+  800fee:	89 d7                	mov    %edx,%edi
+  800ff0:	89 d6                	mov    %edx,%esi
+  800ff2:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  800ff4:	eb 99                	jmp    800f8f <sys_getenvid+0x38>
+
+00800ff6 <sys_page_alloc>:
+{
+  800ff6:	55                   	push   %ebp
+  800ff7:	89 e5                	mov    %esp,%ebp
+  800ff9:	57                   	push   %edi
+  800ffa:	56                   	push   %esi
+  800ffb:	53                   	push   %ebx
+  800ffc:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800fff:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801006:	78 38                	js     801040 <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  801008:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80100f:	74 7b                	je     80108c <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  801011:	be 00 00 00 00       	mov    $0x0,%esi
+  801016:	8b 55 08             	mov    0x8(%ebp),%edx
+  801019:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80101c:	b8 04 00 00 00       	mov    $0x4,%eax
+  801021:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801024:	89 f7                	mov    %esi,%edi
+  801026:	55                   	push   %ebp
+  801027:	68 30 10 80 00       	push   $0x801030
+  80102c:	89 e5                	mov    %esp,%ebp
+  80102e:	0f 34                	sysenter
+  801030:	83 c4 04             	add    $0x4,%esp
+  801033:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801034:	85 c0                	test   %eax,%eax
+  801036:	7f 6d                	jg     8010a5 <sys_page_alloc+0xaf>
+}
+  801038:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80103b:	5b                   	pop    %ebx
+  80103c:	5e                   	pop    %esi
+  80103d:	5f                   	pop    %edi
+  80103e:	5d                   	pop    %ebp
+  80103f:	c3                   	ret
+  801040:	b8 01 00 00 00       	mov    $0x1,%eax
+  801045:	0f a2                	cpuid
+		return 0;
+  801047:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80104c:	f6 c6 08             	test   $0x8,%dh
+  80104f:	74 15                	je     801066 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801051:	89 c2                	mov    %eax,%edx
+  801053:	c1 ea 08             	shr    $0x8,%edx
+  801056:	83 e2 0f             	and    $0xf,%edx
+  801059:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80105e:	83 fa 06             	cmp    $0x6,%edx
+  801061:	74 0e                	je     801071 <sys_page_alloc+0x7b>
+  801063:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801066:	0f b6 c9             	movzbl %cl,%ecx
+  801069:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80106f:	eb 97                	jmp    801008 <sys_page_alloc+0x12>
+  801071:	89 c2                	mov    %eax,%edx
+  801073:	c1 ea 04             	shr    $0x4,%edx
+  801076:	83 e2 0f             	and    $0xf,%edx
+  801079:	83 fa 02             	cmp    $0x2,%edx
+  80107c:	77 e5                	ja     801063 <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  80107e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801081:	83 f8 02             	cmp    $0x2,%eax
+  801084:	0f 97 c1             	seta   %cl
+  801087:	0f b6 c9             	movzbl %cl,%ecx
+  80108a:	eb d7                	jmp    801063 <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  80108c:	be 00 00 00 00       	mov    $0x0,%esi
+  801091:	b8 04 00 00 00       	mov    $0x4,%eax
+  801096:	8b 55 08             	mov    0x8(%ebp),%edx
+  801099:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80109c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80109f:	89 f7                	mov    %esi,%edi
+  8010a1:	cd 30                	int    $0x30
+  8010a3:	eb 8f                	jmp    801034 <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010a5:	83 ec 0c             	sub    $0xc,%esp
+  8010a8:	50                   	push   %eax
+  8010a9:	6a 04                	push   $0x4
+  8010ab:	68 79 2f 80 00       	push   $0x802f79
+  8010b0:	6a 4a                	push   $0x4a
+  8010b2:	68 96 2f 80 00       	push   $0x802f96
+  8010b7:	e8 bb 18 00 00       	call   802977 <_panic>
+
+008010bc <sys_page_map>:
+{
+  8010bc:	55                   	push   %ebp
+  8010bd:	89 e5                	mov    %esp,%ebp
+  8010bf:	57                   	push   %edi
+  8010c0:	56                   	push   %esi
+  8010c1:	53                   	push   %ebx
+  8010c2:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8010c5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8010cc:	78 37                	js     801105 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  8010ce:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8010d5:	74 7a                	je     801151 <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  8010d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010dd:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010e2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010e5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010e8:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010eb:	55                   	push   %ebp
+  8010ec:	68 f5 10 80 00       	push   $0x8010f5
+  8010f1:	89 e5                	mov    %esp,%ebp
+  8010f3:	0f 34                	sysenter
+  8010f5:	83 c4 04             	add    $0x4,%esp
+  8010f8:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8010f9:	85 c0                	test   %eax,%eax
+  8010fb:	7f 6c                	jg     801169 <sys_page_map+0xad>
+}
+  8010fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801100:	5b                   	pop    %ebx
+  801101:	5e                   	pop    %esi
+  801102:	5f                   	pop    %edi
+  801103:	5d                   	pop    %ebp
+  801104:	c3                   	ret
+  801105:	b8 01 00 00 00       	mov    $0x1,%eax
+  80110a:	0f a2                	cpuid
+		return 0;
+  80110c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801111:	f6 c6 08             	test   $0x8,%dh
+  801114:	74 15                	je     80112b <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801116:	89 c2                	mov    %eax,%edx
+  801118:	c1 ea 08             	shr    $0x8,%edx
+  80111b:	83 e2 0f             	and    $0xf,%edx
+  80111e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801123:	83 fa 06             	cmp    $0x6,%edx
+  801126:	74 0e                	je     801136 <sys_page_map+0x7a>
+  801128:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80112b:	0f b6 c9             	movzbl %cl,%ecx
+  80112e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801134:	eb 98                	jmp    8010ce <sys_page_map+0x12>
+  801136:	89 c2                	mov    %eax,%edx
+  801138:	c1 ea 04             	shr    $0x4,%edx
+  80113b:	83 e2 0f             	and    $0xf,%edx
+  80113e:	83 fa 02             	cmp    $0x2,%edx
+  801141:	77 e5                	ja     801128 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  801143:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801146:	83 f8 02             	cmp    $0x2,%eax
+  801149:	0f 97 c1             	seta   %cl
+  80114c:	0f b6 c9             	movzbl %cl,%ecx
+  80114f:	eb d7                	jmp    801128 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  801151:	b8 05 00 00 00       	mov    $0x5,%eax
+  801156:	8b 55 08             	mov    0x8(%ebp),%edx
+  801159:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80115f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801162:	8b 75 18             	mov    0x18(%ebp),%esi
+  801165:	cd 30                	int    $0x30
+  801167:	eb 90                	jmp    8010f9 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801169:	83 ec 0c             	sub    $0xc,%esp
+  80116c:	50                   	push   %eax
+  80116d:	6a 05                	push   $0x5
+  80116f:	68 79 2f 80 00       	push   $0x802f79
+  801174:	6a 4a                	push   $0x4a
+  801176:	68 96 2f 80 00       	push   $0x802f96
+  80117b:	e8 f7 17 00 00       	call   802977 <_panic>
+
+00801180 <sys_page_unmap>:
+{
+  801180:	55                   	push   %ebp
+  801181:	89 e5                	mov    %esp,%ebp
+  801183:	57                   	push   %edi
+  801184:	56                   	push   %esi
+  801185:	53                   	push   %ebx
+  801186:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801189:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801190:	78 37                	js     8011c9 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  801192:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801199:	74 7a                	je     801215 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  80119b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a6:	b8 06 00 00 00       	mov    $0x6,%eax
+  8011ab:	89 df                	mov    %ebx,%edi
+  8011ad:	89 de                	mov    %ebx,%esi
+  8011af:	55                   	push   %ebp
+  8011b0:	68 b9 11 80 00       	push   $0x8011b9
+  8011b5:	89 e5                	mov    %esp,%ebp
+  8011b7:	0f 34                	sysenter
+  8011b9:	83 c4 04             	add    $0x4,%esp
+  8011bc:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8011bd:	85 c0                	test   %eax,%eax
+  8011bf:	7f 6c                	jg     80122d <sys_page_unmap+0xad>
+}
+  8011c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011c4:	5b                   	pop    %ebx
+  8011c5:	5e                   	pop    %esi
+  8011c6:	5f                   	pop    %edi
+  8011c7:	5d                   	pop    %ebp
+  8011c8:	c3                   	ret
+  8011c9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011ce:	0f a2                	cpuid
+		return 0;
+  8011d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8011d5:	f6 c6 08             	test   $0x8,%dh
+  8011d8:	74 15                	je     8011ef <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011da:	89 c2                	mov    %eax,%edx
+  8011dc:	c1 ea 08             	shr    $0x8,%edx
+  8011df:	83 e2 0f             	and    $0xf,%edx
+  8011e2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011e7:	83 fa 06             	cmp    $0x6,%edx
+  8011ea:	74 0e                	je     8011fa <sys_page_unmap+0x7a>
+  8011ec:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8011ef:	0f b6 c9             	movzbl %cl,%ecx
+  8011f2:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8011f8:	eb 98                	jmp    801192 <sys_page_unmap+0x12>
+  8011fa:	89 c2                	mov    %eax,%edx
+  8011fc:	c1 ea 04             	shr    $0x4,%edx
+  8011ff:	83 e2 0f             	and    $0xf,%edx
+  801202:	83 fa 02             	cmp    $0x2,%edx
+  801205:	77 e5                	ja     8011ec <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  801207:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80120a:	83 f8 02             	cmp    $0x2,%eax
+  80120d:	0f 97 c1             	seta   %cl
+  801210:	0f b6 c9             	movzbl %cl,%ecx
+  801213:	eb d7                	jmp    8011ec <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  801215:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80121a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80121f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801222:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801225:	89 df                	mov    %ebx,%edi
+  801227:	89 de                	mov    %ebx,%esi
+  801229:	cd 30                	int    $0x30
+  80122b:	eb 90                	jmp    8011bd <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80122d:	83 ec 0c             	sub    $0xc,%esp
+  801230:	50                   	push   %eax
+  801231:	6a 06                	push   $0x6
+  801233:	68 79 2f 80 00       	push   $0x802f79
+  801238:	6a 4a                	push   $0x4a
+  80123a:	68 96 2f 80 00       	push   $0x802f96
+  80123f:	e8 33 17 00 00       	call   802977 <_panic>
+
+00801244 <sys_page_copy>:
+{
+  801244:	55                   	push   %ebp
+  801245:	89 e5                	mov    %esp,%ebp
+  801247:	57                   	push   %edi
+  801248:	56                   	push   %esi
+  801249:	53                   	push   %ebx
+  80124a:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80124d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801254:	78 37                	js     80128d <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  801256:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80125d:	74 7a                	je     8012d9 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  80125f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801262:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801265:	b8 29 00 00 00       	mov    $0x29,%eax
+  80126a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80126d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801270:	8b 75 18             	mov    0x18(%ebp),%esi
+  801273:	55                   	push   %ebp
+  801274:	68 7d 12 80 00       	push   $0x80127d
+  801279:	89 e5                	mov    %esp,%ebp
+  80127b:	0f 34                	sysenter
+  80127d:	83 c4 04             	add    $0x4,%esp
+  801280:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801281:	85 c0                	test   %eax,%eax
+  801283:	7f 6c                	jg     8012f1 <sys_page_copy+0xad>
+}
+  801285:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801288:	5b                   	pop    %ebx
+  801289:	5e                   	pop    %esi
+  80128a:	5f                   	pop    %edi
+  80128b:	5d                   	pop    %ebp
+  80128c:	c3                   	ret
+  80128d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801292:	0f a2                	cpuid
+		return 0;
+  801294:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801299:	f6 c6 08             	test   $0x8,%dh
+  80129c:	74 15                	je     8012b3 <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80129e:	89 c2                	mov    %eax,%edx
+  8012a0:	c1 ea 08             	shr    $0x8,%edx
+  8012a3:	83 e2 0f             	and    $0xf,%edx
+  8012a6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012ab:	83 fa 06             	cmp    $0x6,%edx
+  8012ae:	74 0e                	je     8012be <sys_page_copy+0x7a>
+  8012b0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8012b3:	0f b6 c9             	movzbl %cl,%ecx
+  8012b6:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8012bc:	eb 98                	jmp    801256 <sys_page_copy+0x12>
+  8012be:	89 c2                	mov    %eax,%edx
+  8012c0:	c1 ea 04             	shr    $0x4,%edx
+  8012c3:	83 e2 0f             	and    $0xf,%edx
+  8012c6:	83 fa 02             	cmp    $0x2,%edx
+  8012c9:	77 e5                	ja     8012b0 <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  8012cb:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012ce:	83 f8 02             	cmp    $0x2,%eax
+  8012d1:	0f 97 c1             	seta   %cl
+  8012d4:	0f b6 c9             	movzbl %cl,%ecx
+  8012d7:	eb d7                	jmp    8012b0 <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  8012d9:	b8 29 00 00 00       	mov    $0x29,%eax
+  8012de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012e7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012ea:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012ed:	cd 30                	int    $0x30
+  8012ef:	eb 90                	jmp    801281 <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012f1:	83 ec 0c             	sub    $0xc,%esp
+  8012f4:	50                   	push   %eax
+  8012f5:	6a 29                	push   $0x29
+  8012f7:	68 79 2f 80 00       	push   $0x802f79
+  8012fc:	6a 4a                	push   $0x4a
+  8012fe:	68 96 2f 80 00       	push   $0x802f96
+  801303:	e8 6f 16 00 00       	call   802977 <_panic>
+
+00801308 <sys_yield>:
+{
+  801308:	55                   	push   %ebp
+  801309:	89 e5                	mov    %esp,%ebp
+  80130b:	57                   	push   %edi
+  80130c:	56                   	push   %esi
+  80130d:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80130e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801315:	78 2e                	js     801345 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  801317:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80131e:	74 71                	je     801391 <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  801320:	ba 00 00 00 00       	mov    $0x0,%edx
+  801325:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80132a:	89 d1                	mov    %edx,%ecx
+  80132c:	89 d3                	mov    %edx,%ebx
+  80132e:	89 d7                	mov    %edx,%edi
+  801330:	89 d6                	mov    %edx,%esi
+  801332:	55                   	push   %ebp
+  801333:	68 3c 13 80 00       	push   $0x80133c
+  801338:	89 e5                	mov    %esp,%ebp
+  80133a:	0f 34                	sysenter
+  80133c:	83 c4 04             	add    $0x4,%esp
+  80133f:	5d                   	pop    %ebp
+}
+  801340:	5b                   	pop    %ebx
+  801341:	5e                   	pop    %esi
+  801342:	5f                   	pop    %edi
+  801343:	5d                   	pop    %ebp
+  801344:	c3                   	ret
+  801345:	b8 01 00 00 00       	mov    $0x1,%eax
+  80134a:	0f a2                	cpuid
+		return 0;
+  80134c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801351:	f6 c6 08             	test   $0x8,%dh
+  801354:	74 15                	je     80136b <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801356:	89 c2                	mov    %eax,%edx
+  801358:	c1 ea 08             	shr    $0x8,%edx
+  80135b:	83 e2 0f             	and    $0xf,%edx
+  80135e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801363:	83 fa 06             	cmp    $0x6,%edx
+  801366:	74 0e                	je     801376 <sys_yield+0x6e>
+  801368:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80136b:	0f b6 c9             	movzbl %cl,%ecx
+  80136e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801374:	eb a1                	jmp    801317 <sys_yield+0xf>
+  801376:	89 c2                	mov    %eax,%edx
+  801378:	c1 ea 04             	shr    $0x4,%edx
+  80137b:	83 e2 0f             	and    $0xf,%edx
+  80137e:	83 fa 02             	cmp    $0x2,%edx
+  801381:	77 e5                	ja     801368 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  801383:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801386:	83 f8 02             	cmp    $0x2,%eax
+  801389:	0f 97 c1             	seta   %cl
+  80138c:	0f b6 c9             	movzbl %cl,%ecx
+  80138f:	eb d7                	jmp    801368 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  801391:	ba 00 00 00 00       	mov    $0x0,%edx
+  801396:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80139b:	89 d1                	mov    %edx,%ecx
+  80139d:	89 d3                	mov    %edx,%ebx
+  80139f:	89 d7                	mov    %edx,%edi
+  8013a1:	89 d6                	mov    %edx,%esi
+  8013a3:	cd 30                	int    $0x30
+}
+  8013a5:	eb 99                	jmp    801340 <sys_yield+0x38>
+
+008013a7 <sys_env_set_status>:
+{
+  8013a7:	55                   	push   %ebp
+  8013a8:	89 e5                	mov    %esp,%ebp
+  8013aa:	57                   	push   %edi
+  8013ab:	56                   	push   %esi
+  8013ac:	53                   	push   %ebx
+  8013ad:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8013b0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8013b7:	78 37                	js     8013f0 <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  8013b9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8013c0:	74 7a                	je     80143c <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  8013c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013cd:	b8 08 00 00 00       	mov    $0x8,%eax
+  8013d2:	89 df                	mov    %ebx,%edi
+  8013d4:	89 de                	mov    %ebx,%esi
+  8013d6:	55                   	push   %ebp
+  8013d7:	68 e0 13 80 00       	push   $0x8013e0
+  8013dc:	89 e5                	mov    %esp,%ebp
+  8013de:	0f 34                	sysenter
+  8013e0:	83 c4 04             	add    $0x4,%esp
+  8013e3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8013e4:	85 c0                	test   %eax,%eax
+  8013e6:	7f 6c                	jg     801454 <sys_env_set_status+0xad>
+}
+  8013e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013eb:	5b                   	pop    %ebx
+  8013ec:	5e                   	pop    %esi
+  8013ed:	5f                   	pop    %edi
+  8013ee:	5d                   	pop    %ebp
+  8013ef:	c3                   	ret
+  8013f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013f5:	0f a2                	cpuid
+		return 0;
+  8013f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8013fc:	f6 c6 08             	test   $0x8,%dh
+  8013ff:	74 15                	je     801416 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801401:	89 c2                	mov    %eax,%edx
+  801403:	c1 ea 08             	shr    $0x8,%edx
+  801406:	83 e2 0f             	and    $0xf,%edx
+  801409:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80140e:	83 fa 06             	cmp    $0x6,%edx
+  801411:	74 0e                	je     801421 <sys_env_set_status+0x7a>
+  801413:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801416:	0f b6 c9             	movzbl %cl,%ecx
+  801419:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80141f:	eb 98                	jmp    8013b9 <sys_env_set_status+0x12>
+  801421:	89 c2                	mov    %eax,%edx
+  801423:	c1 ea 04             	shr    $0x4,%edx
+  801426:	83 e2 0f             	and    $0xf,%edx
+  801429:	83 fa 02             	cmp    $0x2,%edx
+  80142c:	77 e5                	ja     801413 <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  80142e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801431:	83 f8 02             	cmp    $0x2,%eax
+  801434:	0f 97 c1             	seta   %cl
+  801437:	0f b6 c9             	movzbl %cl,%ecx
+  80143a:	eb d7                	jmp    801413 <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  80143c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801441:	b8 08 00 00 00       	mov    $0x8,%eax
+  801446:	8b 55 08             	mov    0x8(%ebp),%edx
+  801449:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80144c:	89 df                	mov    %ebx,%edi
+  80144e:	89 de                	mov    %ebx,%esi
+  801450:	cd 30                	int    $0x30
+  801452:	eb 90                	jmp    8013e4 <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801454:	83 ec 0c             	sub    $0xc,%esp
+  801457:	50                   	push   %eax
+  801458:	6a 08                	push   $0x8
+  80145a:	68 79 2f 80 00       	push   $0x802f79
+  80145f:	6a 4a                	push   $0x4a
+  801461:	68 96 2f 80 00       	push   $0x802f96
+  801466:	e8 0c 15 00 00       	call   802977 <_panic>
+
+0080146b <sys_sysinfo>:
+{
+  80146b:	55                   	push   %ebp
+  80146c:	89 e5                	mov    %esp,%ebp
+  80146e:	57                   	push   %edi
+  80146f:	56                   	push   %esi
+  801470:	53                   	push   %ebx
+  801471:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801474:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80147b:	78 36                	js     8014b3 <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  80147d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801484:	74 79                	je     8014ff <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  801486:	8b 55 08             	mov    0x8(%ebp),%edx
+  801489:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80148e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801493:	89 cb                	mov    %ecx,%ebx
+  801495:	89 cf                	mov    %ecx,%edi
+  801497:	89 ce                	mov    %ecx,%esi
+  801499:	55                   	push   %ebp
+  80149a:	68 a3 14 80 00       	push   $0x8014a3
+  80149f:	89 e5                	mov    %esp,%ebp
+  8014a1:	0f 34                	sysenter
+  8014a3:	83 c4 04             	add    $0x4,%esp
+  8014a6:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8014a7:	85 c0                	test   %eax,%eax
+  8014a9:	7f 6b                	jg     801516 <sys_sysinfo+0xab>
+}
+  8014ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ae:	5b                   	pop    %ebx
+  8014af:	5e                   	pop    %esi
+  8014b0:	5f                   	pop    %edi
+  8014b1:	5d                   	pop    %ebp
+  8014b2:	c3                   	ret
+  8014b3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014b8:	0f a2                	cpuid
+		return 0;
+  8014ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8014bf:	f6 c6 08             	test   $0x8,%dh
+  8014c2:	74 15                	je     8014d9 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014c4:	89 c2                	mov    %eax,%edx
+  8014c6:	c1 ea 08             	shr    $0x8,%edx
+  8014c9:	83 e2 0f             	and    $0xf,%edx
+  8014cc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8014d1:	83 fa 06             	cmp    $0x6,%edx
+  8014d4:	74 0e                	je     8014e4 <sys_sysinfo+0x79>
+  8014d6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8014d9:	0f b6 c9             	movzbl %cl,%ecx
+  8014dc:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8014e2:	eb 99                	jmp    80147d <sys_sysinfo+0x12>
+  8014e4:	89 c2                	mov    %eax,%edx
+  8014e6:	c1 ea 04             	shr    $0x4,%edx
+  8014e9:	83 e2 0f             	and    $0xf,%edx
+  8014ec:	83 fa 02             	cmp    $0x2,%edx
+  8014ef:	77 e5                	ja     8014d6 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  8014f1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014f4:	83 f8 02             	cmp    $0x2,%eax
+  8014f7:	0f 97 c1             	seta   %cl
+  8014fa:	0f b6 c9             	movzbl %cl,%ecx
+  8014fd:	eb d7                	jmp    8014d6 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  8014ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801504:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801509:	8b 55 08             	mov    0x8(%ebp),%edx
+  80150c:	89 cb                	mov    %ecx,%ebx
+  80150e:	89 cf                	mov    %ecx,%edi
+  801510:	89 ce                	mov    %ecx,%esi
+  801512:	cd 30                	int    $0x30
+  801514:	eb 91                	jmp    8014a7 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801516:	83 ec 0c             	sub    $0xc,%esp
+  801519:	50                   	push   %eax
+  80151a:	6a 0b                	push   $0xb
+  80151c:	68 79 2f 80 00       	push   $0x802f79
+  801521:	6a 4a                	push   $0x4a
+  801523:	68 96 2f 80 00       	push   $0x802f96
+  801528:	e8 4a 14 00 00       	call   802977 <_panic>
+
+0080152d <sys_env_set_trapframe>:
+{
+  80152d:	55                   	push   %ebp
+  80152e:	89 e5                	mov    %esp,%ebp
+  801530:	57                   	push   %edi
+  801531:	56                   	push   %esi
+  801532:	53                   	push   %ebx
+  801533:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801536:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80153d:	78 37                	js     801576 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  80153f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801546:	74 7a                	je     8015c2 <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  801548:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80154d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801550:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801553:	b8 13 00 00 00       	mov    $0x13,%eax
+  801558:	89 df                	mov    %ebx,%edi
+  80155a:	89 de                	mov    %ebx,%esi
+  80155c:	55                   	push   %ebp
+  80155d:	68 66 15 80 00       	push   $0x801566
+  801562:	89 e5                	mov    %esp,%ebp
+  801564:	0f 34                	sysenter
+  801566:	83 c4 04             	add    $0x4,%esp
+  801569:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80156a:	85 c0                	test   %eax,%eax
+  80156c:	7f 6c                	jg     8015da <sys_env_set_trapframe+0xad>
+}
+  80156e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801571:	5b                   	pop    %ebx
+  801572:	5e                   	pop    %esi
+  801573:	5f                   	pop    %edi
+  801574:	5d                   	pop    %ebp
+  801575:	c3                   	ret
+  801576:	b8 01 00 00 00       	mov    $0x1,%eax
+  80157b:	0f a2                	cpuid
+		return 0;
+  80157d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801582:	f6 c6 08             	test   $0x8,%dh
+  801585:	74 15                	je     80159c <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801587:	89 c2                	mov    %eax,%edx
+  801589:	c1 ea 08             	shr    $0x8,%edx
+  80158c:	83 e2 0f             	and    $0xf,%edx
+  80158f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801594:	83 fa 06             	cmp    $0x6,%edx
+  801597:	74 0e                	je     8015a7 <sys_env_set_trapframe+0x7a>
+  801599:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80159c:	0f b6 c9             	movzbl %cl,%ecx
+  80159f:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8015a5:	eb 98                	jmp    80153f <sys_env_set_trapframe+0x12>
+  8015a7:	89 c2                	mov    %eax,%edx
+  8015a9:	c1 ea 04             	shr    $0x4,%edx
+  8015ac:	83 e2 0f             	and    $0xf,%edx
+  8015af:	83 fa 02             	cmp    $0x2,%edx
+  8015b2:	77 e5                	ja     801599 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  8015b4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015b7:	83 f8 02             	cmp    $0x2,%eax
+  8015ba:	0f 97 c1             	seta   %cl
+  8015bd:	0f b6 c9             	movzbl %cl,%ecx
+  8015c0:	eb d7                	jmp    801599 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  8015c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015c7:	b8 13 00 00 00       	mov    $0x13,%eax
+  8015cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015d2:	89 df                	mov    %ebx,%edi
+  8015d4:	89 de                	mov    %ebx,%esi
+  8015d6:	cd 30                	int    $0x30
+  8015d8:	eb 90                	jmp    80156a <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015da:	83 ec 0c             	sub    $0xc,%esp
+  8015dd:	50                   	push   %eax
+  8015de:	6a 13                	push   $0x13
+  8015e0:	68 79 2f 80 00       	push   $0x802f79
+  8015e5:	6a 4a                	push   $0x4a
+  8015e7:	68 96 2f 80 00       	push   $0x802f96
+  8015ec:	e8 86 13 00 00       	call   802977 <_panic>
+
+008015f1 <sys_env_set_stack_limit>:
+{
+  8015f1:	55                   	push   %ebp
+  8015f2:	89 e5                	mov    %esp,%ebp
+  8015f4:	57                   	push   %edi
+  8015f5:	56                   	push   %esi
+  8015f6:	53                   	push   %ebx
+  8015f7:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8015fa:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801601:	78 37                	js     80163a <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  801603:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80160a:	74 7a                	je     801686 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  80160c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801611:	8b 55 08             	mov    0x8(%ebp),%edx
+  801614:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801617:	b8 19 00 00 00       	mov    $0x19,%eax
+  80161c:	89 df                	mov    %ebx,%edi
+  80161e:	89 de                	mov    %ebx,%esi
+  801620:	55                   	push   %ebp
+  801621:	68 2a 16 80 00       	push   $0x80162a
+  801626:	89 e5                	mov    %esp,%ebp
+  801628:	0f 34                	sysenter
+  80162a:	83 c4 04             	add    $0x4,%esp
+  80162d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80162e:	85 c0                	test   %eax,%eax
+  801630:	7f 6c                	jg     80169e <sys_env_set_stack_limit+0xad>
+}
+  801632:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801635:	5b                   	pop    %ebx
+  801636:	5e                   	pop    %esi
+  801637:	5f                   	pop    %edi
+  801638:	5d                   	pop    %ebp
+  801639:	c3                   	ret
+  80163a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80163f:	0f a2                	cpuid
+		return 0;
+  801641:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801646:	f6 c6 08             	test   $0x8,%dh
+  801649:	74 15                	je     801660 <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80164b:	89 c2                	mov    %eax,%edx
+  80164d:	c1 ea 08             	shr    $0x8,%edx
+  801650:	83 e2 0f             	and    $0xf,%edx
+  801653:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801658:	83 fa 06             	cmp    $0x6,%edx
+  80165b:	74 0e                	je     80166b <sys_env_set_stack_limit+0x7a>
+  80165d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801660:	0f b6 c9             	movzbl %cl,%ecx
+  801663:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801669:	eb 98                	jmp    801603 <sys_env_set_stack_limit+0x12>
+  80166b:	89 c2                	mov    %eax,%edx
+  80166d:	c1 ea 04             	shr    $0x4,%edx
+  801670:	83 e2 0f             	and    $0xf,%edx
+  801673:	83 fa 02             	cmp    $0x2,%edx
+  801676:	77 e5                	ja     80165d <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  801678:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80167b:	83 f8 02             	cmp    $0x2,%eax
+  80167e:	0f 97 c1             	seta   %cl
+  801681:	0f b6 c9             	movzbl %cl,%ecx
+  801684:	eb d7                	jmp    80165d <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  801686:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80168b:	b8 19 00 00 00       	mov    $0x19,%eax
+  801690:	8b 55 08             	mov    0x8(%ebp),%edx
+  801693:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801696:	89 df                	mov    %ebx,%edi
+  801698:	89 de                	mov    %ebx,%esi
+  80169a:	cd 30                	int    $0x30
+  80169c:	eb 90                	jmp    80162e <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80169e:	83 ec 0c             	sub    $0xc,%esp
+  8016a1:	50                   	push   %eax
+  8016a2:	6a 19                	push   $0x19
+  8016a4:	68 79 2f 80 00       	push   $0x802f79
+  8016a9:	6a 4a                	push   $0x4a
+  8016ab:	68 96 2f 80 00       	push   $0x802f96
+  8016b0:	e8 c2 12 00 00       	call   802977 <_panic>
+
+008016b5 <sys_env_set_pgfault_upcall>:
+{
+  8016b5:	55                   	push   %ebp
+  8016b6:	89 e5                	mov    %esp,%ebp
+  8016b8:	57                   	push   %edi
+  8016b9:	56                   	push   %esi
+  8016ba:	53                   	push   %ebx
+  8016bb:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8016be:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8016c5:	78 37                	js     8016fe <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  8016c7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8016ce:	74 7a                	je     80174a <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  8016d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016db:	b8 09 00 00 00       	mov    $0x9,%eax
+  8016e0:	89 df                	mov    %ebx,%edi
+  8016e2:	89 de                	mov    %ebx,%esi
+  8016e4:	55                   	push   %ebp
+  8016e5:	68 ee 16 80 00       	push   $0x8016ee
+  8016ea:	89 e5                	mov    %esp,%ebp
+  8016ec:	0f 34                	sysenter
+  8016ee:	83 c4 04             	add    $0x4,%esp
+  8016f1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8016f2:	85 c0                	test   %eax,%eax
+  8016f4:	7f 6c                	jg     801762 <sys_env_set_pgfault_upcall+0xad>
+}
+  8016f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016f9:	5b                   	pop    %ebx
+  8016fa:	5e                   	pop    %esi
+  8016fb:	5f                   	pop    %edi
+  8016fc:	5d                   	pop    %ebp
+  8016fd:	c3                   	ret
+  8016fe:	b8 01 00 00 00       	mov    $0x1,%eax
+  801703:	0f a2                	cpuid
+		return 0;
+  801705:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80170a:	f6 c6 08             	test   $0x8,%dh
+  80170d:	74 15                	je     801724 <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80170f:	89 c2                	mov    %eax,%edx
+  801711:	c1 ea 08             	shr    $0x8,%edx
+  801714:	83 e2 0f             	and    $0xf,%edx
+  801717:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80171c:	83 fa 06             	cmp    $0x6,%edx
+  80171f:	74 0e                	je     80172f <sys_env_set_pgfault_upcall+0x7a>
+  801721:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801724:	0f b6 c9             	movzbl %cl,%ecx
+  801727:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80172d:	eb 98                	jmp    8016c7 <sys_env_set_pgfault_upcall+0x12>
+  80172f:	89 c2                	mov    %eax,%edx
+  801731:	c1 ea 04             	shr    $0x4,%edx
+  801734:	83 e2 0f             	and    $0xf,%edx
+  801737:	83 fa 02             	cmp    $0x2,%edx
+  80173a:	77 e5                	ja     801721 <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  80173c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80173f:	83 f8 02             	cmp    $0x2,%eax
+  801742:	0f 97 c1             	seta   %cl
+  801745:	0f b6 c9             	movzbl %cl,%ecx
+  801748:	eb d7                	jmp    801721 <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  80174a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80174f:	b8 09 00 00 00       	mov    $0x9,%eax
+  801754:	8b 55 08             	mov    0x8(%ebp),%edx
+  801757:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80175a:	89 df                	mov    %ebx,%edi
+  80175c:	89 de                	mov    %ebx,%esi
+  80175e:	cd 30                	int    $0x30
+  801760:	eb 90                	jmp    8016f2 <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801762:	83 ec 0c             	sub    $0xc,%esp
+  801765:	50                   	push   %eax
+  801766:	6a 09                	push   $0x9
+  801768:	68 79 2f 80 00       	push   $0x802f79
+  80176d:	6a 4a                	push   $0x4a
+  80176f:	68 96 2f 80 00       	push   $0x802f96
+  801774:	e8 fe 11 00 00       	call   802977 <_panic>
+
+00801779 <sys_ipc_try_send>:
+{
+  801779:	55                   	push   %ebp
+  80177a:	89 e5                	mov    %esp,%ebp
+  80177c:	57                   	push   %edi
+  80177d:	56                   	push   %esi
+  80177e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80177f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801786:	78 32                	js     8017ba <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  801788:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80178f:	74 75                	je     801806 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801791:	8b 55 08             	mov    0x8(%ebp),%edx
+  801794:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801797:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80179c:	be 00 00 00 00       	mov    $0x0,%esi
+  8017a1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017a4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8017a7:	55                   	push   %ebp
+  8017a8:	68 b1 17 80 00       	push   $0x8017b1
+  8017ad:	89 e5                	mov    %esp,%ebp
+  8017af:	0f 34                	sysenter
+  8017b1:	83 c4 04             	add    $0x4,%esp
+  8017b4:	5d                   	pop    %ebp
+}
+  8017b5:	5b                   	pop    %ebx
+  8017b6:	5e                   	pop    %esi
+  8017b7:	5f                   	pop    %edi
+  8017b8:	5d                   	pop    %ebp
+  8017b9:	c3                   	ret
+  8017ba:	b8 01 00 00 00       	mov    $0x1,%eax
+  8017bf:	0f a2                	cpuid
+		return 0;
+  8017c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8017c6:	f6 c6 08             	test   $0x8,%dh
+  8017c9:	74 15                	je     8017e0 <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017cb:	89 c2                	mov    %eax,%edx
+  8017cd:	c1 ea 08             	shr    $0x8,%edx
+  8017d0:	83 e2 0f             	and    $0xf,%edx
+  8017d3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017d8:	83 fa 06             	cmp    $0x6,%edx
+  8017db:	74 0e                	je     8017eb <sys_ipc_try_send+0x72>
+  8017dd:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8017e0:	0f b6 c9             	movzbl %cl,%ecx
+  8017e3:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8017e9:	eb 9d                	jmp    801788 <sys_ipc_try_send+0xf>
+  8017eb:	89 c2                	mov    %eax,%edx
+  8017ed:	c1 ea 04             	shr    $0x4,%edx
+  8017f0:	83 e2 0f             	and    $0xf,%edx
+  8017f3:	83 fa 02             	cmp    $0x2,%edx
+  8017f6:	77 e5                	ja     8017dd <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  8017f8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017fb:	83 f8 02             	cmp    $0x2,%eax
+  8017fe:	0f 97 c1             	seta   %cl
+  801801:	0f b6 c9             	movzbl %cl,%ecx
+  801804:	eb d7                	jmp    8017dd <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  801806:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80180b:	be 00 00 00 00       	mov    $0x0,%esi
+  801810:	8b 55 08             	mov    0x8(%ebp),%edx
+  801813:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801816:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801819:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80181c:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  80181e:	eb 95                	jmp    8017b5 <sys_ipc_try_send+0x3c>
+
+00801820 <sys_ipc_send>:
+{
+  801820:	55                   	push   %ebp
+  801821:	89 e5                	mov    %esp,%ebp
+  801823:	57                   	push   %edi
+  801824:	56                   	push   %esi
+  801825:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801826:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80182d:	78 32                	js     801861 <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  80182f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801836:	74 75                	je     8018ad <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801838:	8b 55 08             	mov    0x8(%ebp),%edx
+  80183b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80183e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801843:	be 00 00 00 00       	mov    $0x0,%esi
+  801848:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80184b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80184e:	55                   	push   %ebp
+  80184f:	68 58 18 80 00       	push   $0x801858
+  801854:	89 e5                	mov    %esp,%ebp
+  801856:	0f 34                	sysenter
+  801858:	83 c4 04             	add    $0x4,%esp
+  80185b:	5d                   	pop    %ebp
+}
+  80185c:	5b                   	pop    %ebx
+  80185d:	5e                   	pop    %esi
+  80185e:	5f                   	pop    %edi
+  80185f:	5d                   	pop    %ebp
+  801860:	c3                   	ret
+  801861:	b8 01 00 00 00       	mov    $0x1,%eax
+  801866:	0f a2                	cpuid
+		return 0;
+  801868:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80186d:	f6 c6 08             	test   $0x8,%dh
+  801870:	74 15                	je     801887 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801872:	89 c2                	mov    %eax,%edx
+  801874:	c1 ea 08             	shr    $0x8,%edx
+  801877:	83 e2 0f             	and    $0xf,%edx
+  80187a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80187f:	83 fa 06             	cmp    $0x6,%edx
+  801882:	74 0e                	je     801892 <sys_ipc_send+0x72>
+  801884:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801887:	0f b6 c9             	movzbl %cl,%ecx
+  80188a:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801890:	eb 9d                	jmp    80182f <sys_ipc_send+0xf>
+  801892:	89 c2                	mov    %eax,%edx
+  801894:	c1 ea 04             	shr    $0x4,%edx
+  801897:	83 e2 0f             	and    $0xf,%edx
+  80189a:	83 fa 02             	cmp    $0x2,%edx
+  80189d:	77 e5                	ja     801884 <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  80189f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018a2:	83 f8 02             	cmp    $0x2,%eax
+  8018a5:	0f 97 c1             	seta   %cl
+  8018a8:	0f b6 c9             	movzbl %cl,%ecx
+  8018ab:	eb d7                	jmp    801884 <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  8018ad:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8018b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8018b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018bd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018c0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8018c3:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  8018c5:	eb 95                	jmp    80185c <sys_ipc_send+0x3c>
+
+008018c7 <sys_ipc_recv>:
+{
+  8018c7:	55                   	push   %ebp
+  8018c8:	89 e5                	mov    %esp,%ebp
+  8018ca:	57                   	push   %edi
+  8018cb:	56                   	push   %esi
+  8018cc:	53                   	push   %ebx
+  8018cd:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8018d0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8018d7:	78 36                	js     80190f <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  8018d9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8018e0:	74 79                	je     80195b <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  8018e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018ea:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8018ef:	89 cb                	mov    %ecx,%ebx
+  8018f1:	89 cf                	mov    %ecx,%edi
+  8018f3:	89 ce                	mov    %ecx,%esi
+  8018f5:	55                   	push   %ebp
+  8018f6:	68 ff 18 80 00       	push   $0x8018ff
+  8018fb:	89 e5                	mov    %esp,%ebp
+  8018fd:	0f 34                	sysenter
+  8018ff:	83 c4 04             	add    $0x4,%esp
+  801902:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801903:	85 c0                	test   %eax,%eax
+  801905:	7f 6b                	jg     801972 <sys_ipc_recv+0xab>
+}
+  801907:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80190a:	5b                   	pop    %ebx
+  80190b:	5e                   	pop    %esi
+  80190c:	5f                   	pop    %edi
+  80190d:	5d                   	pop    %ebp
+  80190e:	c3                   	ret
+  80190f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801914:	0f a2                	cpuid
+		return 0;
+  801916:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80191b:	f6 c6 08             	test   $0x8,%dh
+  80191e:	74 15                	je     801935 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801920:	89 c2                	mov    %eax,%edx
+  801922:	c1 ea 08             	shr    $0x8,%edx
+  801925:	83 e2 0f             	and    $0xf,%edx
+  801928:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80192d:	83 fa 06             	cmp    $0x6,%edx
+  801930:	74 0e                	je     801940 <sys_ipc_recv+0x79>
+  801932:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801935:	0f b6 c9             	movzbl %cl,%ecx
+  801938:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80193e:	eb 99                	jmp    8018d9 <sys_ipc_recv+0x12>
+  801940:	89 c2                	mov    %eax,%edx
+  801942:	c1 ea 04             	shr    $0x4,%edx
+  801945:	83 e2 0f             	and    $0xf,%edx
+  801948:	83 fa 02             	cmp    $0x2,%edx
+  80194b:	77 e5                	ja     801932 <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  80194d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801950:	83 f8 02             	cmp    $0x2,%eax
+  801953:	0f 97 c1             	seta   %cl
+  801956:	0f b6 c9             	movzbl %cl,%ecx
+  801959:	eb d7                	jmp    801932 <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  80195b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801960:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801965:	8b 55 08             	mov    0x8(%ebp),%edx
+  801968:	89 cb                	mov    %ecx,%ebx
+  80196a:	89 cf                	mov    %ecx,%edi
+  80196c:	89 ce                	mov    %ecx,%esi
+  80196e:	cd 30                	int    $0x30
+  801970:	eb 91                	jmp    801903 <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801972:	83 ec 0c             	sub    $0xc,%esp
+  801975:	50                   	push   %eax
+  801976:	6a 0d                	push   $0xd
+  801978:	68 79 2f 80 00       	push   $0x802f79
+  80197d:	6a 4a                	push   $0x4a
+  80197f:	68 96 2f 80 00       	push   $0x802f96
+  801984:	e8 ee 0f 00 00       	call   802977 <_panic>
+
+00801989 <sys_ipc_send_range>:
+{
+  801989:	55                   	push   %ebp
+  80198a:	89 e5                	mov    %esp,%ebp
+  80198c:	57                   	push   %edi
+  80198d:	56                   	push   %esi
+  80198e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80198f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801996:	78 30                	js     8019c8 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  801998:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80199f:	74 73                	je     801a14 <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  8019a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019a7:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8019ac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019af:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8019b2:	8b 75 18             	mov    0x18(%ebp),%esi
+  8019b5:	55                   	push   %ebp
+  8019b6:	68 bf 19 80 00       	push   $0x8019bf
+  8019bb:	89 e5                	mov    %esp,%ebp
+  8019bd:	0f 34                	sysenter
+  8019bf:	83 c4 04             	add    $0x4,%esp
+  8019c2:	5d                   	pop    %ebp
+}
+  8019c3:	5b                   	pop    %ebx
+  8019c4:	5e                   	pop    %esi
+  8019c5:	5f                   	pop    %edi
+  8019c6:	5d                   	pop    %ebp
+  8019c7:	c3                   	ret
+  8019c8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019cd:	0f a2                	cpuid
+		return 0;
+  8019cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8019d4:	f6 c6 08             	test   $0x8,%dh
+  8019d7:	74 15                	je     8019ee <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019d9:	89 c2                	mov    %eax,%edx
+  8019db:	c1 ea 08             	shr    $0x8,%edx
+  8019de:	83 e2 0f             	and    $0xf,%edx
+  8019e1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019e6:	83 fa 06             	cmp    $0x6,%edx
+  8019e9:	74 0e                	je     8019f9 <sys_ipc_send_range+0x70>
+  8019eb:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8019ee:	0f b6 c9             	movzbl %cl,%ecx
+  8019f1:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8019f7:	eb 9f                	jmp    801998 <sys_ipc_send_range+0xf>
+  8019f9:	89 c2                	mov    %eax,%edx
+  8019fb:	c1 ea 04             	shr    $0x4,%edx
+  8019fe:	83 e2 0f             	and    $0xf,%edx
+  801a01:	83 fa 02             	cmp    $0x2,%edx
+  801a04:	77 e5                	ja     8019eb <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  801a06:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a09:	83 f8 02             	cmp    $0x2,%eax
+  801a0c:	0f 97 c1             	seta   %cl
+  801a0f:	0f b6 c9             	movzbl %cl,%ecx
+  801a12:	eb d7                	jmp    8019eb <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  801a14:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801a19:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a1c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a1f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a22:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a25:	8b 75 18             	mov    0x18(%ebp),%esi
+  801a28:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  801a2a:	eb 97                	jmp    8019c3 <sys_ipc_send_range+0x3a>
+
+00801a2c <sys_ipc_recv_range>:
+{
+  801a2c:	55                   	push   %ebp
+  801a2d:	89 e5                	mov    %esp,%ebp
+  801a2f:	57                   	push   %edi
+  801a30:	56                   	push   %esi
+  801a31:	53                   	push   %ebx
+  801a32:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801a35:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a3c:	78 37                	js     801a75 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  801a3e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a45:	74 7a                	je     801ac1 <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  801a47:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a4f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a52:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801a57:	89 df                	mov    %ebx,%edi
+  801a59:	89 de                	mov    %ebx,%esi
+  801a5b:	55                   	push   %ebp
+  801a5c:	68 65 1a 80 00       	push   $0x801a65
+  801a61:	89 e5                	mov    %esp,%ebp
+  801a63:	0f 34                	sysenter
+  801a65:	83 c4 04             	add    $0x4,%esp
+  801a68:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801a69:	85 c0                	test   %eax,%eax
+  801a6b:	7f 6c                	jg     801ad9 <sys_ipc_recv_range+0xad>
+}
+  801a6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a70:	5b                   	pop    %ebx
+  801a71:	5e                   	pop    %esi
+  801a72:	5f                   	pop    %edi
+  801a73:	5d                   	pop    %ebp
+  801a74:	c3                   	ret
+  801a75:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a7a:	0f a2                	cpuid
+		return 0;
+  801a7c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801a81:	f6 c6 08             	test   $0x8,%dh
+  801a84:	74 15                	je     801a9b <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a86:	89 c2                	mov    %eax,%edx
+  801a88:	c1 ea 08             	shr    $0x8,%edx
+  801a8b:	83 e2 0f             	and    $0xf,%edx
+  801a8e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a93:	83 fa 06             	cmp    $0x6,%edx
+  801a96:	74 0e                	je     801aa6 <sys_ipc_recv_range+0x7a>
+  801a98:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a9b:	0f b6 c9             	movzbl %cl,%ecx
+  801a9e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801aa4:	eb 98                	jmp    801a3e <sys_ipc_recv_range+0x12>
+  801aa6:	89 c2                	mov    %eax,%edx
+  801aa8:	c1 ea 04             	shr    $0x4,%edx
+  801aab:	83 e2 0f             	and    $0xf,%edx
+  801aae:	83 fa 02             	cmp    $0x2,%edx
+  801ab1:	77 e5                	ja     801a98 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801ab3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ab6:	83 f8 02             	cmp    $0x2,%eax
+  801ab9:	0f 97 c1             	seta   %cl
+  801abc:	0f b6 c9             	movzbl %cl,%ecx
+  801abf:	eb d7                	jmp    801a98 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801ac1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ac6:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801acb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ace:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ad1:	89 df                	mov    %ebx,%edi
+  801ad3:	89 de                	mov    %ebx,%esi
+  801ad5:	cd 30                	int    $0x30
+  801ad7:	eb 90                	jmp    801a69 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801ad9:	83 ec 0c             	sub    $0xc,%esp
+  801adc:	50                   	push   %eax
+  801add:	6a 1f                	push   $0x1f
+  801adf:	68 79 2f 80 00       	push   $0x802f79
+  801ae4:	6a 4a                	push   $0x4a
+  801ae6:	68 96 2f 80 00       	push   $0x802f96
+  801aeb:	e8 87 0e 00 00       	call   802977 <_panic>
+
+00801af0 <sys_ipc_call>:
+{
+  801af0:	55                   	push   %ebp
+  801af1:	89 e5                	mov    %esp,%ebp
+  801af3:	57                   	push   %edi
+  801af4:	56                   	push   %esi
+  801af5:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801af6:	8b 55 08             	mov    0x8(%ebp),%edx
+  801af9:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801afe:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b01:	55                   	push   %ebp
+  801b02:	56                   	push   %esi
+  801b03:	8b 0e                	mov    (%esi),%ecx
+  801b05:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801b08:	8b 7e 08             	mov    0x8(%esi),%edi
+  801b0b:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801b0e:	8b 76 0c             	mov    0xc(%esi),%esi
+  801b11:	cd 30                	int    $0x30
+  801b13:	87 34 24             	xchg   %esi,(%esp)
+  801b16:	89 0e                	mov    %ecx,(%esi)
+  801b18:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801b1b:	89 7e 08             	mov    %edi,0x8(%esi)
+  801b1e:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801b21:	8f 46 0c             	pop    0xc(%esi)
+  801b24:	5d                   	pop    %ebp
+}
+  801b25:	5b                   	pop    %ebx
+  801b26:	5e                   	pop    %esi
+  801b27:	5f                   	pop    %edi
+  801b28:	5d                   	pop    %ebp
+  801b29:	c3                   	ret
+
+00801b2a <sys_ipc_reply_wait>:
+{
+  801b2a:	55                   	push   %ebp
+  801b2b:	89 e5                	mov    %esp,%ebp
+  801b2d:	57                   	push   %edi
+  801b2e:	56                   	push   %esi
+  801b2f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801b30:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b33:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801b38:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b3b:	55                   	push   %ebp
+  801b3c:	56                   	push   %esi
+  801b3d:	8b 0e                	mov    (%esi),%ecx
+  801b3f:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801b42:	8b 7e 08             	mov    0x8(%esi),%edi
+  801b45:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801b48:	8b 76 0c             	mov    0xc(%esi),%esi
+  801b4b:	cd 30                	int    $0x30
+  801b4d:	87 34 24             	xchg   %esi,(%esp)
+  801b50:	89 0e                	mov    %ecx,(%esi)
+  801b52:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801b55:	89 7e 08             	mov    %edi,0x8(%esi)
+  801b58:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801b5b:	8f 46 0c             	pop    0xc(%esi)
+  801b5e:	5d                   	pop    %ebp
+}
+  801b5f:	5b                   	pop    %ebx
+  801b60:	5e                   	pop    %esi
+  801b61:	5f                   	pop    %edi
+  801b62:	5d                   	pop    %ebp
+  801b63:	c3                   	ret
+
+00801b64 <sys_ipc_send_msg>:
+{
+  801b64:	55                   	push   %ebp
+  801b65:	89 e5                	mov    %esp,%ebp
+  801b67:	57                   	push   %edi
+  801b68:	56                   	push   %esi
+  801b69:	53                   	push   %ebx
+  801b6a:	83 ec 20             	sub    $0x20,%esp
+  801b6d:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801b70:	8b 10                	mov    (%eax),%edx
+  801b72:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801b75:	8b 50 04             	mov    0x4(%eax),%edx
+  801b78:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801b7b:	8b 50 08             	mov    0x8(%eax),%edx
+  801b7e:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801b81:	8b 50 0c             	mov    0xc(%eax),%edx
+  801b84:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801b87:	8b 40 10             	mov    0x10(%eax),%eax
+  801b8a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801b8d:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801b90:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b93:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801b98:	55                   	push   %ebp
+  801b99:	56                   	push   %esi
+  801b9a:	8b 0e                	mov    (%esi),%ecx
+  801b9c:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801b9f:	8b 7e 08             	mov    0x8(%esi),%edi
+  801ba2:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801ba5:	8b 76 0c             	mov    0xc(%esi),%esi
+  801ba8:	cd 30                	int    $0x30
+  801baa:	87 34 24             	xchg   %esi,(%esp)
+  801bad:	89 0e                	mov    %ecx,(%esi)
+  801baf:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801bb2:	89 7e 08             	mov    %edi,0x8(%esi)
+  801bb5:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801bb8:	8f 46 0c             	pop    0xc(%esi)
+  801bbb:	5d                   	pop    %ebp
+}
+  801bbc:	83 c4 20             	add    $0x20,%esp
+  801bbf:	5b                   	pop    %ebx
+  801bc0:	5e                   	pop    %esi
+  801bc1:	5f                   	pop    %edi
+  801bc2:	5d                   	pop    %ebp
+  801bc3:	c3                   	ret
+
+00801bc4 <sys_fork>:
+{
+  801bc4:	55                   	push   %ebp
+  801bc5:	89 e5                	mov    %esp,%ebp
+  801bc7:	57                   	push   %edi
+  801bc8:	56                   	push   %esi
+  801bc9:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801bca:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801bd1:	78 2e                	js     801c01 <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801bd3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801bda:	74 71                	je     801c4d <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801bdc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801be1:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801be6:	89 d1                	mov    %edx,%ecx
+  801be8:	89 d3                	mov    %edx,%ebx
+  801bea:	89 d7                	mov    %edx,%edi
+  801bec:	89 d6                	mov    %edx,%esi
+  801bee:	55                   	push   %ebp
+  801bef:	68 f8 1b 80 00       	push   $0x801bf8
+  801bf4:	89 e5                	mov    %esp,%ebp
+  801bf6:	0f 34                	sysenter
+  801bf8:	83 c4 04             	add    $0x4,%esp
+  801bfb:	5d                   	pop    %ebp
+}
+  801bfc:	5b                   	pop    %ebx
+  801bfd:	5e                   	pop    %esi
+  801bfe:	5f                   	pop    %edi
+  801bff:	5d                   	pop    %ebp
+  801c00:	c3                   	ret
+  801c01:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c06:	0f a2                	cpuid
+		return 0;
+  801c08:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801c0d:	f6 c6 08             	test   $0x8,%dh
+  801c10:	74 15                	je     801c27 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c12:	89 c2                	mov    %eax,%edx
+  801c14:	c1 ea 08             	shr    $0x8,%edx
+  801c17:	83 e2 0f             	and    $0xf,%edx
+  801c1a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801c1f:	83 fa 06             	cmp    $0x6,%edx
+  801c22:	74 0e                	je     801c32 <sys_fork+0x6e>
+  801c24:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801c27:	0f b6 c9             	movzbl %cl,%ecx
+  801c2a:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801c30:	eb a1                	jmp    801bd3 <sys_fork+0xf>
+  801c32:	89 c2                	mov    %eax,%edx
+  801c34:	c1 ea 04             	shr    $0x4,%edx
+  801c37:	83 e2 0f             	and    $0xf,%edx
+  801c3a:	83 fa 02             	cmp    $0x2,%edx
+  801c3d:	77 e5                	ja     801c24 <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801c3f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c42:	83 f8 02             	cmp    $0x2,%eax
+  801c45:	0f 97 c1             	seta   %cl
+  801c48:	0f b6 c9             	movzbl %cl,%ecx
+  801c4b:	eb d7                	jmp    801c24 <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801c4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c52:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801c57:	89 d1                	mov    %edx,%ecx
+  801c59:	89 d3                	mov    %edx,%ebx
+  801c5b:	89 d7                	mov    %edx,%edi
+  801c5d:	89 d6                	mov    %edx,%esi
+  801c5f:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801c61:	eb 99                	jmp    801bfc <sys_fork+0x38>
+
+00801c63 <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801c63:	55                   	push   %ebp
+  801c64:	89 e5                	mov    %esp,%ebp
+  801c66:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801c69:	ff 75 14             	push   0x14(%ebp)
+  801c6c:	ff 75 10             	push   0x10(%ebp)
+  801c6f:	ff 75 0c             	push   0xc(%ebp)
+  801c72:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c77:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c7a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801c7f:	e8 81 ee ff ff       	call   800b05 <page_vec_call>
+}
+  801c84:	c9                   	leave
+  801c85:	c3                   	ret
+
+00801c86 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801c86:	55                   	push   %ebp
+  801c87:	89 e5                	mov    %esp,%ebp
+  801c89:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801c8c:	ff 75 18             	push   0x18(%ebp)
+  801c8f:	ff 75 14             	push   0x14(%ebp)
+  801c92:	ff 75 10             	push   0x10(%ebp)
+  801c95:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c98:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c9b:	b8 10 00 00 00       	mov    $0x10,%eax
+  801ca0:	e8 60 ee ff ff       	call   800b05 <page_vec_call>
+}
+  801ca5:	c9                   	leave
+  801ca6:	c3                   	ret
+
+00801ca7 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801ca7:	55                   	push   %ebp
+  801ca8:	89 e5                	mov    %esp,%ebp
+  801caa:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801cad:	ff 75 14             	push   0x14(%ebp)
+  801cb0:	ff 75 10             	push   0x10(%ebp)
+  801cb3:	ff 75 0c             	push   0xc(%ebp)
+  801cb6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cbb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cbe:	b8 11 00 00 00       	mov    $0x11,%eax
+  801cc3:	e8 3d ee ff ff       	call   800b05 <page_vec_call>
+}
+  801cc8:	c9                   	leave
+  801cc9:	c3                   	ret
+
+00801cca <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801cca:	55                   	push   %ebp
+  801ccb:	89 e5                	mov    %esp,%ebp
+  801ccd:	57                   	push   %edi
+  801cce:	56                   	push   %esi
+  801ccf:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801cd0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801cd7:	78 32                	js     801d0b <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801cd9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ce0:	74 75                	je     801d57 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801ce2:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ce5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ce8:	b8 12 00 00 00       	mov    $0x12,%eax
+  801ced:	be 00 00 00 00       	mov    $0x0,%esi
+  801cf2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801cf5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801cf8:	55                   	push   %ebp
+  801cf9:	68 02 1d 80 00       	push   $0x801d02
+  801cfe:	89 e5                	mov    %esp,%ebp
+  801d00:	0f 34                	sysenter
+  801d02:	83 c4 04             	add    $0x4,%esp
+  801d05:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801d06:	5b                   	pop    %ebx
+  801d07:	5e                   	pop    %esi
+  801d08:	5f                   	pop    %edi
+  801d09:	5d                   	pop    %ebp
+  801d0a:	c3                   	ret
+  801d0b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d10:	0f a2                	cpuid
+		return 0;
+  801d12:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801d17:	f6 c6 08             	test   $0x8,%dh
+  801d1a:	74 15                	je     801d31 <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d1c:	89 c2                	mov    %eax,%edx
+  801d1e:	c1 ea 08             	shr    $0x8,%edx
+  801d21:	83 e2 0f             	and    $0xf,%edx
+  801d24:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d29:	83 fa 06             	cmp    $0x6,%edx
+  801d2c:	74 0e                	je     801d3c <sys_vm_ranges+0x72>
+  801d2e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801d31:	0f b6 c9             	movzbl %cl,%ecx
+  801d34:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801d3a:	eb 9d                	jmp    801cd9 <sys_vm_ranges+0xf>
+  801d3c:	89 c2                	mov    %eax,%edx
+  801d3e:	c1 ea 04             	shr    $0x4,%edx
+  801d41:	83 e2 0f             	and    $0xf,%edx
+  801d44:	83 fa 02             	cmp    $0x2,%edx
+  801d47:	77 e5                	ja     801d2e <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  801d49:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d4c:	83 f8 02             	cmp    $0x2,%eax
+  801d4f:	0f 97 c1             	seta   %cl
+  801d52:	0f b6 c9             	movzbl %cl,%ecx
+  801d55:	eb d7                	jmp    801d2e <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801d57:	b8 12 00 00 00       	mov    $0x12,%eax
+  801d5c:	be 00 00 00 00       	mov    $0x0,%esi
+  801d61:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d67:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d6a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801d6d:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801d6f:	eb 95                	jmp    801d06 <sys_vm_ranges+0x3c>
+
+00801d71 <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801d71:	55                   	push   %ebp
+  801d72:	89 e5                	mov    %esp,%ebp
+  801d74:	57                   	push   %edi
+  801d75:	56                   	push   %esi
+  801d76:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801d77:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801d7e:	78 31                	js     801db1 <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801d80:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801d87:	74 74                	je     801dfd <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801d89:	be 00 00 00 00       	mov    $0x0,%esi
+  801d8e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d91:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d94:	b8 14 00 00 00       	mov    $0x14,%eax
+  801d99:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d9c:	89 f7                	mov    %esi,%edi
+  801d9e:	55                   	push   %ebp
+  801d9f:	68 a8 1d 80 00       	push   $0x801da8
+  801da4:	89 e5                	mov    %esp,%ebp
+  801da6:	0f 34                	sysenter
+  801da8:	83 c4 04             	add    $0x4,%esp
+  801dab:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801dac:	5b                   	pop    %ebx
+  801dad:	5e                   	pop    %esi
+  801dae:	5f                   	pop    %edi
+  801daf:	5d                   	pop    %ebp
+  801db0:	c3                   	ret
+  801db1:	b8 01 00 00 00       	mov    $0x1,%eax
+  801db6:	0f a2                	cpuid
+		return 0;
+  801db8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801dbd:	f6 c6 08             	test   $0x8,%dh
+  801dc0:	74 15                	je     801dd7 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801dc2:	89 c2                	mov    %eax,%edx
+  801dc4:	c1 ea 08             	shr    $0x8,%edx
+  801dc7:	83 e2 0f             	and    $0xf,%edx
+  801dca:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801dcf:	83 fa 06             	cmp    $0x6,%edx
+  801dd2:	74 0e                	je     801de2 <sys_spawn+0x71>
+  801dd4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801dd7:	0f b6 c9             	movzbl %cl,%ecx
+  801dda:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801de0:	eb 9e                	jmp    801d80 <sys_spawn+0xf>
+  801de2:	89 c2                	mov    %eax,%edx
+  801de4:	c1 ea 04             	shr    $0x4,%edx
+  801de7:	83 e2 0f             	and    $0xf,%edx
+  801dea:	83 fa 02             	cmp    $0x2,%edx
+  801ded:	77 e5                	ja     801dd4 <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  801def:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801df2:	83 f8 02             	cmp    $0x2,%eax
+  801df5:	0f 97 c1             	seta   %cl
+  801df8:	0f b6 c9             	movzbl %cl,%ecx
+  801dfb:	eb d7                	jmp    801dd4 <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  801dfd:	be 00 00 00 00       	mov    $0x0,%esi
+  801e02:	b8 14 00 00 00       	mov    $0x14,%eax
+  801e07:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e0a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e0d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e10:	89 f7                	mov    %esi,%edi
+  801e12:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  801e14:	eb 96                	jmp    801dac <sys_spawn+0x3b>
+
+00801e16 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  801e16:	55                   	push   %ebp
+  801e17:	89 e5                	mov    %esp,%ebp
+  801e19:	57                   	push   %edi
+  801e1a:	56                   	push   %esi
+  801e1b:	53                   	push   %ebx
+  801e1c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801e1f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e26:	78 37                	js     801e5f <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  801e28:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e2f:	74 7a                	je     801eab <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  801e31:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e36:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e39:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e3c:	b8 15 00 00 00       	mov    $0x15,%eax
+  801e41:	89 df                	mov    %ebx,%edi
+  801e43:	89 de                	mov    %ebx,%esi
+  801e45:	55                   	push   %ebp
+  801e46:	68 4f 1e 80 00       	push   $0x801e4f
+  801e4b:	89 e5                	mov    %esp,%ebp
+  801e4d:	0f 34                	sysenter
+  801e4f:	83 c4 04             	add    $0x4,%esp
+  801e52:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801e53:	85 c0                	test   %eax,%eax
+  801e55:	7f 6c                	jg     801ec3 <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  801e57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e5a:	5b                   	pop    %ebx
+  801e5b:	5e                   	pop    %esi
+  801e5c:	5f                   	pop    %edi
+  801e5d:	5d                   	pop    %ebp
+  801e5e:	c3                   	ret
+  801e5f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e64:	0f a2                	cpuid
+		return 0;
+  801e66:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801e6b:	f6 c6 08             	test   $0x8,%dh
+  801e6e:	74 15                	je     801e85 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e70:	89 c2                	mov    %eax,%edx
+  801e72:	c1 ea 08             	shr    $0x8,%edx
+  801e75:	83 e2 0f             	and    $0xf,%edx
+  801e78:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e7d:	83 fa 06             	cmp    $0x6,%edx
+  801e80:	74 0e                	je     801e90 <sys_shm_create+0x7a>
+  801e82:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801e85:	0f b6 c9             	movzbl %cl,%ecx
+  801e88:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801e8e:	eb 98                	jmp    801e28 <sys_shm_create+0x12>
+  801e90:	89 c2                	mov    %eax,%edx
+  801e92:	c1 ea 04             	shr    $0x4,%edx
+  801e95:	83 e2 0f             	and    $0xf,%edx
+  801e98:	83 fa 02             	cmp    $0x2,%edx
+  801e9b:	77 e5                	ja     801e82 <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  801e9d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ea0:	83 f8 02             	cmp    $0x2,%eax
+  801ea3:	0f 97 c1             	seta   %cl
+  801ea6:	0f b6 c9             	movzbl %cl,%ecx
+  801ea9:	eb d7                	jmp    801e82 <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  801eab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801eb0:	b8 15 00 00 00       	mov    $0x15,%eax
+  801eb5:	8b 55 08             	mov    0x8(%ebp),%edx
+  801eb8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ebb:	89 df                	mov    %ebx,%edi
+  801ebd:	89 de                	mov    %ebx,%esi
+  801ebf:	cd 30                	int    $0x30
+  801ec1:	eb 90                	jmp    801e53 <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801ec3:	83 ec 0c             	sub    $0xc,%esp
+  801ec6:	50                   	push   %eax
+  801ec7:	6a 15                	push   $0x15
+  801ec9:	68 79 2f 80 00       	push   $0x802f79
+  801ece:	6a 4a                	push   $0x4a
+  801ed0:	68 96 2f 80 00       	push   $0x802f96
+  801ed5:	e8 9d 0a 00 00       	call   802977 <_panic>
+
+00801eda <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  801eda:	55                   	push   %ebp
+  801edb:	89 e5                	mov    %esp,%ebp
+  801edd:	57                   	push   %edi
+  801ede:	56                   	push   %esi
+  801edf:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801ee0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ee7:	78 32                	js     801f1b <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  801ee9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ef0:	74 75                	je     801f67 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801ef2:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ef5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ef8:	b8 16 00 00 00       	mov    $0x16,%eax
+  801efd:	be 00 00 00 00       	mov    $0x0,%esi
+  801f02:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f05:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801f08:	55                   	push   %ebp
+  801f09:	68 12 1f 80 00       	push   $0x801f12
+  801f0e:	89 e5                	mov    %esp,%ebp
+  801f10:	0f 34                	sysenter
+  801f12:	83 c4 04             	add    $0x4,%esp
+  801f15:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  801f16:	5b                   	pop    %ebx
+  801f17:	5e                   	pop    %esi
+  801f18:	5f                   	pop    %edi
+  801f19:	5d                   	pop    %ebp
+  801f1a:	c3                   	ret
+  801f1b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f20:	0f a2                	cpuid
+		return 0;
+  801f22:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801f27:	f6 c6 08             	test   $0x8,%dh
+  801f2a:	74 15                	je     801f41 <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f2c:	89 c2                	mov    %eax,%edx
+  801f2e:	c1 ea 08             	shr    $0x8,%edx
+  801f31:	83 e2 0f             	and    $0xf,%edx
+  801f34:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f39:	83 fa 06             	cmp    $0x6,%edx
+  801f3c:	74 0e                	je     801f4c <sys_shm_attach+0x72>
+  801f3e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801f41:	0f b6 c9             	movzbl %cl,%ecx
+  801f44:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801f4a:	eb 9d                	jmp    801ee9 <sys_shm_attach+0xf>
+  801f4c:	89 c2                	mov    %eax,%edx
+  801f4e:	c1 ea 04             	shr    $0x4,%edx
+  801f51:	83 e2 0f             	and    $0xf,%edx
+  801f54:	83 fa 02             	cmp    $0x2,%edx
+  801f57:	77 e5                	ja     801f3e <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  801f59:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f5c:	83 f8 02             	cmp    $0x2,%eax
+  801f5f:	0f 97 c1             	seta   %cl
+  801f62:	0f b6 c9             	movzbl %cl,%ecx
+  801f65:	eb d7                	jmp    801f3e <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  801f67:	b8 16 00 00 00       	mov    $0x16,%eax
+  801f6c:	be 00 00 00 00       	mov    $0x0,%esi
+  801f71:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f74:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f77:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f7a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801f7d:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  801f7f:	eb 95                	jmp    801f16 <sys_shm_attach+0x3c>
+
+00801f81 <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  801f81:	55                   	push   %ebp
+  801f82:	89 e5                	mov    %esp,%ebp
+  801f84:	57                   	push   %edi
+  801f85:	56                   	push   %esi
+  801f86:	53                   	push   %ebx
+  801f87:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801f8a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f91:	78 38                	js     801fcb <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  801f93:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f9a:	74 7b                	je     802017 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  801f9c:	be 00 00 00 00       	mov    $0x0,%esi
+  801fa1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fa4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fa7:	b8 17 00 00 00       	mov    $0x17,%eax
+  801fac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801faf:	89 f7                	mov    %esi,%edi
+  801fb1:	55                   	push   %ebp
+  801fb2:	68 bb 1f 80 00       	push   $0x801fbb
+  801fb7:	89 e5                	mov    %esp,%ebp
+  801fb9:	0f 34                	sysenter
+  801fbb:	83 c4 04             	add    $0x4,%esp
+  801fbe:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801fbf:	85 c0                	test   %eax,%eax
+  801fc1:	7f 6d                	jg     802030 <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  801fc3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fc6:	5b                   	pop    %ebx
+  801fc7:	5e                   	pop    %esi
+  801fc8:	5f                   	pop    %edi
+  801fc9:	5d                   	pop    %ebp
+  801fca:	c3                   	ret
+  801fcb:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fd0:	0f a2                	cpuid
+		return 0;
+  801fd2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801fd7:	f6 c6 08             	test   $0x8,%dh
+  801fda:	74 15                	je     801ff1 <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fdc:	89 c2                	mov    %eax,%edx
+  801fde:	c1 ea 08             	shr    $0x8,%edx
+  801fe1:	83 e2 0f             	and    $0xf,%edx
+  801fe4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801fe9:	83 fa 06             	cmp    $0x6,%edx
+  801fec:	74 0e                	je     801ffc <sys_shm_detach+0x7b>
+  801fee:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801ff1:	0f b6 c9             	movzbl %cl,%ecx
+  801ff4:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801ffa:	eb 97                	jmp    801f93 <sys_shm_detach+0x12>
+  801ffc:	89 c2                	mov    %eax,%edx
+  801ffe:	c1 ea 04             	shr    $0x4,%edx
+  802001:	83 e2 0f             	and    $0xf,%edx
+  802004:	83 fa 02             	cmp    $0x2,%edx
+  802007:	77 e5                	ja     801fee <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  802009:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80200c:	83 f8 02             	cmp    $0x2,%eax
+  80200f:	0f 97 c1             	seta   %cl
+  802012:	0f b6 c9             	movzbl %cl,%ecx
+  802015:	eb d7                	jmp    801fee <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  802017:	be 00 00 00 00       	mov    $0x0,%esi
+  80201c:	b8 17 00 00 00       	mov    $0x17,%eax
+  802021:	8b 55 08             	mov    0x8(%ebp),%edx
+  802024:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802027:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80202a:	89 f7                	mov    %esi,%edi
+  80202c:	cd 30                	int    $0x30
+  80202e:	eb 8f                	jmp    801fbf <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802030:	83 ec 0c             	sub    $0xc,%esp
+  802033:	50                   	push   %eax
+  802034:	6a 17                	push   $0x17
+  802036:	68 79 2f 80 00       	push   $0x802f79
+  80203b:	6a 4a                	push   $0x4a
+  80203d:	68 96 2f 80 00       	push   $0x802f96
+  802042:	e8 30 09 00 00       	call   802977 <_panic>
+
+00802047 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  802047:	55                   	push   %ebp
+  802048:	89 e5                	mov    %esp,%ebp
+  80204a:	57                   	push   %edi
+  80204b:	56                   	push   %esi
+  80204c:	53                   	push   %ebx
+  80204d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802050:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802057:	78 36                	js     80208f <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  802059:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802060:	74 79                	je     8020db <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  802062:	8b 55 08             	mov    0x8(%ebp),%edx
+  802065:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80206a:	b8 18 00 00 00       	mov    $0x18,%eax
+  80206f:	89 cb                	mov    %ecx,%ebx
+  802071:	89 cf                	mov    %ecx,%edi
+  802073:	89 ce                	mov    %ecx,%esi
+  802075:	55                   	push   %ebp
+  802076:	68 7f 20 80 00       	push   $0x80207f
+  80207b:	89 e5                	mov    %esp,%ebp
+  80207d:	0f 34                	sysenter
+  80207f:	83 c4 04             	add    $0x4,%esp
+  802082:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802083:	85 c0                	test   %eax,%eax
+  802085:	7f 6b                	jg     8020f2 <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  802087:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80208a:	5b                   	pop    %ebx
+  80208b:	5e                   	pop    %esi
+  80208c:	5f                   	pop    %edi
+  80208d:	5d                   	pop    %ebp
+  80208e:	c3                   	ret
+  80208f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802094:	0f a2                	cpuid
+		return 0;
+  802096:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80209b:	f6 c6 08             	test   $0x8,%dh
+  80209e:	74 15                	je     8020b5 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020a0:	89 c2                	mov    %eax,%edx
+  8020a2:	c1 ea 08             	shr    $0x8,%edx
+  8020a5:	83 e2 0f             	and    $0xf,%edx
+  8020a8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8020ad:	83 fa 06             	cmp    $0x6,%edx
+  8020b0:	74 0e                	je     8020c0 <sys_shm_remove+0x79>
+  8020b2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8020b5:	0f b6 c9             	movzbl %cl,%ecx
+  8020b8:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8020be:	eb 99                	jmp    802059 <sys_shm_remove+0x12>
+  8020c0:	89 c2                	mov    %eax,%edx
+  8020c2:	c1 ea 04             	shr    $0x4,%edx
+  8020c5:	83 e2 0f             	and    $0xf,%edx
+  8020c8:	83 fa 02             	cmp    $0x2,%edx
+  8020cb:	77 e5                	ja     8020b2 <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  8020cd:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020d0:	83 f8 02             	cmp    $0x2,%eax
+  8020d3:	0f 97 c1             	seta   %cl
+  8020d6:	0f b6 c9             	movzbl %cl,%ecx
+  8020d9:	eb d7                	jmp    8020b2 <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  8020db:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020e0:	b8 18 00 00 00       	mov    $0x18,%eax
+  8020e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020e8:	89 cb                	mov    %ecx,%ebx
+  8020ea:	89 cf                	mov    %ecx,%edi
+  8020ec:	89 ce                	mov    %ecx,%esi
+  8020ee:	cd 30                	int    $0x30
+  8020f0:	eb 91                	jmp    802083 <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8020f2:	83 ec 0c             	sub    $0xc,%esp
+  8020f5:	50                   	push   %eax
+  8020f6:	6a 18                	push   $0x18
+  8020f8:	68 79 2f 80 00       	push   $0x802f79
+  8020fd:	6a 4a                	push   $0x4a
+  8020ff:	68 96 2f 80 00       	push   $0x802f96
+  802104:	e8 6e 08 00 00       	call   802977 <_panic>
+
+00802109 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  802109:	55                   	push   %ebp
+  80210a:	89 e5                	mov    %esp,%ebp
+  80210c:	57                   	push   %edi
+  80210d:	56                   	push   %esi
+  80210e:	53                   	push   %ebx
+  80210f:	83 ec 0c             	sub    $0xc,%esp
+  802112:	8b 45 10             	mov    0x10(%ebp),%eax
+  802115:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802118:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  80211b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802122:	78 32                	js     802156 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  802124:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80212b:	74 75                	je     8021a2 <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  80212d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802130:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802133:	b8 20 00 00 00       	mov    $0x20,%eax
+  802138:	be 00 00 00 00       	mov    $0x0,%esi
+  80213d:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802140:	55                   	push   %ebp
+  802141:	68 4a 21 80 00       	push   $0x80214a
+  802146:	89 e5                	mov    %esp,%ebp
+  802148:	0f 34                	sysenter
+  80214a:	83 c4 04             	add    $0x4,%esp
+  80214d:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  80214e:	83 c4 0c             	add    $0xc,%esp
+  802151:	5b                   	pop    %ebx
+  802152:	5e                   	pop    %esi
+  802153:	5f                   	pop    %edi
+  802154:	5d                   	pop    %ebp
+  802155:	c3                   	ret
+  802156:	b8 01 00 00 00       	mov    $0x1,%eax
+  80215b:	0f a2                	cpuid
+		return 0;
+  80215d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802162:	f6 c6 08             	test   $0x8,%dh
+  802165:	74 15                	je     80217c <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802167:	89 c2                	mov    %eax,%edx
+  802169:	c1 ea 08             	shr    $0x8,%edx
+  80216c:	83 e2 0f             	and    $0xf,%edx
+  80216f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802174:	83 fa 06             	cmp    $0x6,%edx
+  802177:	74 0e                	je     802187 <sys_futex_wait+0x7e>
+  802179:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80217c:	0f b6 c9             	movzbl %cl,%ecx
+  80217f:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802185:	eb 9d                	jmp    802124 <sys_futex_wait+0x1b>
+  802187:	89 c2                	mov    %eax,%edx
+  802189:	c1 ea 04             	shr    $0x4,%edx
+  80218c:	83 e2 0f             	and    $0xf,%edx
+  80218f:	83 fa 02             	cmp    $0x2,%edx
+  802192:	77 e5                	ja     802179 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  802194:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802197:	83 f8 02             	cmp    $0x2,%eax
+  80219a:	0f 97 c1             	seta   %cl
+  80219d:	0f b6 c9             	movzbl %cl,%ecx
+  8021a0:	eb d7                	jmp    802179 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  8021a2:	b8 20 00 00 00       	mov    $0x20,%eax
+  8021a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8021ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021b2:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8021b5:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  8021b7:	eb 95                	jmp    80214e <sys_futex_wait+0x45>
+
+008021b9 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8021b9:	55                   	push   %ebp
+  8021ba:	89 e5                	mov    %esp,%ebp
+  8021bc:	57                   	push   %edi
+  8021bd:	56                   	push   %esi
+  8021be:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8021bf:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8021c6:	78 30                	js     8021f8 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  8021c8:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8021cf:	74 73                	je     802244 <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  8021d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021dc:	b8 21 00 00 00       	mov    $0x21,%eax
+  8021e1:	89 df                	mov    %ebx,%edi
+  8021e3:	89 de                	mov    %ebx,%esi
+  8021e5:	55                   	push   %ebp
+  8021e6:	68 ef 21 80 00       	push   $0x8021ef
+  8021eb:	89 e5                	mov    %esp,%ebp
+  8021ed:	0f 34                	sysenter
+  8021ef:	83 c4 04             	add    $0x4,%esp
+  8021f2:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8021f3:	5b                   	pop    %ebx
+  8021f4:	5e                   	pop    %esi
+  8021f5:	5f                   	pop    %edi
+  8021f6:	5d                   	pop    %ebp
+  8021f7:	c3                   	ret
+  8021f8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021fd:	0f a2                	cpuid
+		return 0;
+  8021ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802204:	f6 c6 08             	test   $0x8,%dh
+  802207:	74 15                	je     80221e <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802209:	89 c2                	mov    %eax,%edx
+  80220b:	c1 ea 08             	shr    $0x8,%edx
+  80220e:	83 e2 0f             	and    $0xf,%edx
+  802211:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802216:	83 fa 06             	cmp    $0x6,%edx
+  802219:	74 0e                	je     802229 <sys_futex_wake+0x70>
+  80221b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80221e:	0f b6 c9             	movzbl %cl,%ecx
+  802221:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802227:	eb 9f                	jmp    8021c8 <sys_futex_wake+0xf>
+  802229:	89 c2                	mov    %eax,%edx
+  80222b:	c1 ea 04             	shr    $0x4,%edx
+  80222e:	83 e2 0f             	and    $0xf,%edx
+  802231:	83 fa 02             	cmp    $0x2,%edx
+  802234:	77 e5                	ja     80221b <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  802236:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802239:	83 f8 02             	cmp    $0x2,%eax
+  80223c:	0f 97 c1             	seta   %cl
+  80223f:	0f b6 c9             	movzbl %cl,%ecx
+  802242:	eb d7                	jmp    80221b <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  802244:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802249:	b8 21 00 00 00       	mov    $0x21,%eax
+  80224e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802251:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802254:	89 df                	mov    %ebx,%edi
+  802256:	89 de                	mov    %ebx,%esi
+  802258:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  80225a:	eb 97                	jmp    8021f3 <sys_futex_wake+0x3a>
+
+0080225c <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  80225c:	55                   	push   %ebp
+  80225d:	89 e5                	mov    %esp,%ebp
+  80225f:	57                   	push   %edi
+  802260:	56                   	push   %esi
+  802261:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802262:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802269:	78 2e                	js     802299 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  80226b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802272:	74 71                	je     8022e5 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  802274:	ba 00 00 00 00       	mov    $0x0,%edx
+  802279:	b8 22 00 00 00       	mov    $0x22,%eax
+  80227e:	89 d1                	mov    %edx,%ecx
+  802280:	89 d3                	mov    %edx,%ebx
+  802282:	89 d7                	mov    %edx,%edi
+  802284:	89 d6                	mov    %edx,%esi
+  802286:	55                   	push   %ebp
+  802287:	68 90 22 80 00       	push   $0x802290
+  80228c:	89 e5                	mov    %esp,%ebp
+  80228e:	0f 34                	sysenter
+  802290:	83 c4 04             	add    $0x4,%esp
+  802293:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  802294:	5b                   	pop    %ebx
+  802295:	5e                   	pop    %esi
+  802296:	5f                   	pop    %edi
+  802297:	5d                   	pop    %ebp
+  802298:	c3                   	ret
+  802299:	b8 01 00 00 00       	mov    $0x1,%eax
+  80229e:	0f a2                	cpuid
+		return 0;
+  8022a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8022a5:	f6 c6 08             	test   $0x8,%dh
+  8022a8:	74 15                	je     8022bf <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022aa:	89 c2                	mov    %eax,%edx
+  8022ac:	c1 ea 08             	shr    $0x8,%edx
+  8022af:	83 e2 0f             	and    $0xf,%edx
+  8022b2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8022b7:	83 fa 06             	cmp    $0x6,%edx
+  8022ba:	74 0e                	je     8022ca <sys_ep_create+0x6e>
+  8022bc:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8022bf:	0f b6 c9             	movzbl %cl,%ecx
+  8022c2:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8022c8:	eb a1                	jmp    80226b <sys_ep_create+0xf>
+  8022ca:	89 c2                	mov    %eax,%edx
+  8022cc:	c1 ea 04             	shr    $0x4,%edx
+  8022cf:	83 e2 0f             	and    $0xf,%edx
+  8022d2:	83 fa 02             	cmp    $0x2,%edx
+  8022d5:	77 e5                	ja     8022bc <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  8022d7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022da:	83 f8 02             	cmp    $0x2,%eax
+  8022dd:	0f 97 c1             	seta   %cl
+  8022e0:	0f b6 c9             	movzbl %cl,%ecx
+  8022e3:	eb d7                	jmp    8022bc <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  8022e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022ea:	b8 22 00 00 00       	mov    $0x22,%eax
+  8022ef:	89 d1                	mov    %edx,%ecx
+  8022f1:	89 d3                	mov    %edx,%ebx
+  8022f3:	89 d7                	mov    %edx,%edi
+  8022f5:	89 d6                	mov    %edx,%esi
+  8022f7:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  8022f9:	eb 99                	jmp    802294 <sys_ep_create+0x38>
+
+008022fb <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  8022fb:	55                   	push   %ebp
+  8022fc:	89 e5                	mov    %esp,%ebp
+  8022fe:	57                   	push   %edi
+  8022ff:	56                   	push   %esi
+  802300:	53                   	push   %ebx
+  802301:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802304:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80230b:	78 36                	js     802343 <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  80230d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802314:	74 79                	je     80238f <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  802316:	8b 55 08             	mov    0x8(%ebp),%edx
+  802319:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80231e:	b8 23 00 00 00       	mov    $0x23,%eax
+  802323:	89 cb                	mov    %ecx,%ebx
+  802325:	89 cf                	mov    %ecx,%edi
+  802327:	89 ce                	mov    %ecx,%esi
+  802329:	55                   	push   %ebp
+  80232a:	68 33 23 80 00       	push   $0x802333
+  80232f:	89 e5                	mov    %esp,%ebp
+  802331:	0f 34                	sysenter
+  802333:	83 c4 04             	add    $0x4,%esp
+  802336:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802337:	85 c0                	test   %eax,%eax
+  802339:	7f 6b                	jg     8023a6 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  80233b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80233e:	5b                   	pop    %ebx
+  80233f:	5e                   	pop    %esi
+  802340:	5f                   	pop    %edi
+  802341:	5d                   	pop    %ebp
+  802342:	c3                   	ret
+  802343:	b8 01 00 00 00       	mov    $0x1,%eax
+  802348:	0f a2                	cpuid
+		return 0;
+  80234a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80234f:	f6 c6 08             	test   $0x8,%dh
+  802352:	74 15                	je     802369 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802354:	89 c2                	mov    %eax,%edx
+  802356:	c1 ea 08             	shr    $0x8,%edx
+  802359:	83 e2 0f             	and    $0xf,%edx
+  80235c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802361:	83 fa 06             	cmp    $0x6,%edx
+  802364:	74 0e                	je     802374 <sys_ep_destroy+0x79>
+  802366:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802369:	0f b6 c9             	movzbl %cl,%ecx
+  80236c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802372:	eb 99                	jmp    80230d <sys_ep_destroy+0x12>
+  802374:	89 c2                	mov    %eax,%edx
+  802376:	c1 ea 04             	shr    $0x4,%edx
+  802379:	83 e2 0f             	and    $0xf,%edx
+  80237c:	83 fa 02             	cmp    $0x2,%edx
+  80237f:	77 e5                	ja     802366 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  802381:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802384:	83 f8 02             	cmp    $0x2,%eax
+  802387:	0f 97 c1             	seta   %cl
+  80238a:	0f b6 c9             	movzbl %cl,%ecx
+  80238d:	eb d7                	jmp    802366 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  80238f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802394:	b8 23 00 00 00       	mov    $0x23,%eax
+  802399:	8b 55 08             	mov    0x8(%ebp),%edx
+  80239c:	89 cb                	mov    %ecx,%ebx
+  80239e:	89 cf                	mov    %ecx,%edi
+  8023a0:	89 ce                	mov    %ecx,%esi
+  8023a2:	cd 30                	int    $0x30
+  8023a4:	eb 91                	jmp    802337 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8023a6:	83 ec 0c             	sub    $0xc,%esp
+  8023a9:	50                   	push   %eax
+  8023aa:	6a 23                	push   $0x23
+  8023ac:	68 79 2f 80 00       	push   $0x802f79
+  8023b1:	6a 4a                	push   $0x4a
+  8023b3:	68 96 2f 80 00       	push   $0x802f96
+  8023b8:	e8 ba 05 00 00       	call   802977 <_panic>
+
+008023bd <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  8023bd:	55                   	push   %ebp
+  8023be:	89 e5                	mov    %esp,%ebp
+  8023c0:	57                   	push   %edi
+  8023c1:	56                   	push   %esi
+  8023c2:	53                   	push   %ebx
+  8023c3:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8023c6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8023cd:	78 37                	js     802406 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  8023cf:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8023d6:	74 7a                	je     802452 <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  8023d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023e3:	b8 24 00 00 00       	mov    $0x24,%eax
+  8023e8:	89 df                	mov    %ebx,%edi
+  8023ea:	89 de                	mov    %ebx,%esi
+  8023ec:	55                   	push   %ebp
+  8023ed:	68 f6 23 80 00       	push   $0x8023f6
+  8023f2:	89 e5                	mov    %esp,%ebp
+  8023f4:	0f 34                	sysenter
+  8023f6:	83 c4 04             	add    $0x4,%esp
+  8023f9:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8023fa:	85 c0                	test   %eax,%eax
+  8023fc:	7f 6c                	jg     80246a <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  8023fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802401:	5b                   	pop    %ebx
+  802402:	5e                   	pop    %esi
+  802403:	5f                   	pop    %edi
+  802404:	5d                   	pop    %ebp
+  802405:	c3                   	ret
+  802406:	b8 01 00 00 00       	mov    $0x1,%eax
+  80240b:	0f a2                	cpuid
+		return 0;
+  80240d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802412:	f6 c6 08             	test   $0x8,%dh
+  802415:	74 15                	je     80242c <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802417:	89 c2                	mov    %eax,%edx
+  802419:	c1 ea 08             	shr    $0x8,%edx
+  80241c:	83 e2 0f             	and    $0xf,%edx
+  80241f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802424:	83 fa 06             	cmp    $0x6,%edx
+  802427:	74 0e                	je     802437 <sys_ep_grant+0x7a>
+  802429:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80242c:	0f b6 c9             	movzbl %cl,%ecx
+  80242f:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802435:	eb 98                	jmp    8023cf <sys_ep_grant+0x12>
+  802437:	89 c2                	mov    %eax,%edx
+  802439:	c1 ea 04             	shr    $0x4,%edx
+  80243c:	83 e2 0f             	and    $0xf,%edx
+  80243f:	83 fa 02             	cmp    $0x2,%edx
+  802442:	77 e5                	ja     802429 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  802444:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802447:	83 f8 02             	cmp    $0x2,%eax
+  80244a:	0f 97 c1             	seta   %cl
+  80244d:	0f b6 c9             	movzbl %cl,%ecx
+  802450:	eb d7                	jmp    802429 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  802452:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802457:	b8 24 00 00 00       	mov    $0x24,%eax
+  80245c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80245f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802462:	89 df                	mov    %ebx,%edi
+  802464:	89 de                	mov    %ebx,%esi
+  802466:	cd 30                	int    $0x30
+  802468:	eb 90                	jmp    8023fa <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80246a:	83 ec 0c             	sub    $0xc,%esp
+  80246d:	50                   	push   %eax
+  80246e:	6a 24                	push   $0x24
+  802470:	68 79 2f 80 00       	push   $0x802f79
+  802475:	6a 4a                	push   $0x4a
+  802477:	68 96 2f 80 00       	push   $0x802f96
+  80247c:	e8 f6 04 00 00       	call   802977 <_panic>
+
+00802481 <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  802481:	55                   	push   %ebp
+  802482:	89 e5                	mov    %esp,%ebp
+  802484:	57                   	push   %edi
+  802485:	56                   	push   %esi
+  802486:	53                   	push   %ebx
+  802487:	83 ec 20             	sub    $0x20,%esp
+  80248a:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  80248d:	8b 10                	mov    (%eax),%edx
+  80248f:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802492:	8b 50 04             	mov    0x4(%eax),%edx
+  802495:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802498:	8b 50 08             	mov    0x8(%eax),%edx
+  80249b:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  80249e:	8b 50 0c             	mov    0xc(%eax),%edx
+  8024a1:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  8024a4:	8b 40 10             	mov    0x10(%eax),%eax
+  8024a7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  8024aa:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  8024ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024b0:	b8 25 00 00 00       	mov    $0x25,%eax
+  8024b5:	55                   	push   %ebp
+  8024b6:	56                   	push   %esi
+  8024b7:	8b 0e                	mov    (%esi),%ecx
+  8024b9:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8024bc:	8b 7e 08             	mov    0x8(%esi),%edi
+  8024bf:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8024c2:	8b 76 0c             	mov    0xc(%esi),%esi
+  8024c5:	cd 30                	int    $0x30
+  8024c7:	87 34 24             	xchg   %esi,(%esp)
+  8024ca:	89 0e                	mov    %ecx,(%esi)
+  8024cc:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8024cf:	89 7e 08             	mov    %edi,0x8(%esi)
+  8024d2:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8024d5:	8f 46 0c             	pop    0xc(%esi)
+  8024d8:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  8024d9:	83 c4 20             	add    $0x20,%esp
+  8024dc:	5b                   	pop    %ebx
+  8024dd:	5e                   	pop    %esi
+  8024de:	5f                   	pop    %edi
+  8024df:	5d                   	pop    %ebp
+  8024e0:	c3                   	ret
+
+008024e1 <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  8024e1:	55                   	push   %ebp
+  8024e2:	89 e5                	mov    %esp,%ebp
+  8024e4:	57                   	push   %edi
+  8024e5:	56                   	push   %esi
+  8024e6:	53                   	push   %ebx
+  8024e7:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  8024ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024ed:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  8024ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024f2:	b8 26 00 00 00       	mov    $0x26,%eax
+  8024f7:	55                   	push   %ebp
+  8024f8:	56                   	push   %esi
+  8024f9:	8b 0e                	mov    (%esi),%ecx
+  8024fb:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8024fe:	8b 7e 08             	mov    0x8(%esi),%edi
+  802501:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802504:	8b 76 0c             	mov    0xc(%esi),%esi
+  802507:	cd 30                	int    $0x30
+  802509:	87 34 24             	xchg   %esi,(%esp)
+  80250c:	89 0e                	mov    %ecx,(%esi)
+  80250e:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802511:	89 7e 08             	mov    %edi,0x8(%esi)
+  802514:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802517:	8f 46 0c             	pop    0xc(%esi)
+  80251a:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  80251b:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  80251f:	74 0f                	je     802530 <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  802521:	85 c0                	test   %eax,%eax
+  802523:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802528:	0f 48 d1             	cmovs  %ecx,%edx
+  80252b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  80252e:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  802530:	5b                   	pop    %ebx
+  802531:	5e                   	pop    %esi
+  802532:	5f                   	pop    %edi
+  802533:	5d                   	pop    %ebp
+  802534:	c3                   	ret
+
+00802535 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  802535:	55                   	push   %ebp
+  802536:	89 e5                	mov    %esp,%ebp
+  802538:	57                   	push   %edi
+  802539:	56                   	push   %esi
+  80253a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80253b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802542:	78 2f                	js     802573 <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  802544:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80254b:	74 72                	je     8025bf <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  80254d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802550:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802555:	b8 27 00 00 00       	mov    $0x27,%eax
+  80255a:	89 cb                	mov    %ecx,%ebx
+  80255c:	89 cf                	mov    %ecx,%edi
+  80255e:	89 ce                	mov    %ecx,%esi
+  802560:	55                   	push   %ebp
+  802561:	68 6a 25 80 00       	push   $0x80256a
+  802566:	89 e5                	mov    %esp,%ebp
+  802568:	0f 34                	sysenter
+  80256a:	83 c4 04             	add    $0x4,%esp
+  80256d:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  80256e:	5b                   	pop    %ebx
+  80256f:	5e                   	pop    %esi
+  802570:	5f                   	pop    %edi
+  802571:	5d                   	pop    %ebp
+  802572:	c3                   	ret
+  802573:	b8 01 00 00 00       	mov    $0x1,%eax
+  802578:	0f a2                	cpuid
+		return 0;
+  80257a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80257f:	f6 c6 08             	test   $0x8,%dh
+  802582:	74 15                	je     802599 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802584:	89 c2                	mov    %eax,%edx
+  802586:	c1 ea 08             	shr    $0x8,%edx
+  802589:	83 e2 0f             	and    $0xf,%edx
+  80258c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802591:	83 fa 06             	cmp    $0x6,%edx
+  802594:	74 0e                	je     8025a4 <sys_sysring_setup+0x6f>
+  802596:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802599:	0f b6 c9             	movzbl %cl,%ecx
+  80259c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8025a2:	eb a0                	jmp    802544 <sys_sysring_setup+0xf>
+  8025a4:	89 c2                	mov    %eax,%edx
+  8025a6:	c1 ea 04             	shr    $0x4,%edx
+  8025a9:	83 e2 0f             	and    $0xf,%edx
+  8025ac:	83 fa 02             	cmp    $0x2,%edx
+  8025af:	77 e5                	ja     802596 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  8025b1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025b4:	83 f8 02             	cmp    $0x2,%eax
+  8025b7:	0f 97 c1             	seta   %cl
+  8025ba:	0f b6 c9             	movzbl %cl,%ecx
+  8025bd:	eb d7                	jmp    802596 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  8025bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025c4:	b8 27 00 00 00       	mov    $0x27,%eax
+  8025c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025cc:	89 cb                	mov    %ecx,%ebx
+  8025ce:	89 cf                	mov    %ecx,%edi
+  8025d0:	89 ce                	mov    %ecx,%esi
+  8025d2:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  8025d4:	eb 98                	jmp    80256e <sys_sysring_setup+0x39>
+
+008025d6 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  8025d6:	55                   	push   %ebp
+  8025d7:	89 e5                	mov    %esp,%ebp
+  8025d9:	57                   	push   %edi
+  8025da:	56                   	push   %esi
+  8025db:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8025dc:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8025e3:	78 2e                	js     802613 <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  8025e5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8025ec:	74 71                	je     80265f <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  8025ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025f3:	b8 28 00 00 00       	mov    $0x28,%eax
+  8025f8:	89 d1                	mov    %edx,%ecx
+  8025fa:	89 d3                	mov    %edx,%ebx
+  8025fc:	89 d7                	mov    %edx,%edi
+  8025fe:	89 d6                	mov    %edx,%esi
+  802600:	55                   	push   %ebp
+  802601:	68 0a 26 80 00       	push   $0x80260a
+  802606:	89 e5                	mov    %esp,%ebp
+  802608:	0f 34                	sysenter
+  80260a:	83 c4 04             	add    $0x4,%esp
+  80260d:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  80260e:	5b                   	pop    %ebx
+  80260f:	5e                   	pop    %esi
+  802610:	5f                   	pop    %edi
+  802611:	5d                   	pop    %ebp
+  802612:	c3                   	ret
+  802613:	b8 01 00 00 00       	mov    $0x1,%eax
+  802618:	0f a2                	cpuid
+		return 0;
+  80261a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80261f:	f6 c6 08             	test   $0x8,%dh
+  802622:	74 15                	je     802639 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802624:	89 c2                	mov    %eax,%edx
+  802626:	c1 ea 08             	shr    $0x8,%edx
+  802629:	83 e2 0f             	and    $0xf,%edx
+  80262c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802631:	83 fa 06             	cmp    $0x6,%edx
+  802634:	74 0e                	je     802644 <sys_sysring_enter+0x6e>
+  802636:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802639:	0f b6 c9             	movzbl %cl,%ecx
+  80263c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802642:	eb a1                	jmp    8025e5 <sys_sysring_enter+0xf>
+  802644:	89 c2                	mov    %eax,%edx
+  802646:	c1 ea 04             	shr    $0x4,%edx
+  802649:	83 e2 0f             	and    $0xf,%edx
+  80264c:	83 fa 02             	cmp    $0x2,%edx
+  80264f:	77 e5                	ja     802636 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  802651:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802654:	83 f8 02             	cmp    $0x2,%eax
+  802657:	0f 97 c1             	seta   %cl
+  80265a:	0f b6 c9             	movzbl %cl,%ecx
+  80265d:	eb d7                	jmp    802636 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  80265f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802664:	b8 28 00 00 00       	mov    $0x28,%eax
+  802669:	89 d1                	mov    %edx,%ecx
+  80266b:	89 d3                	mov    %edx,%ebx
+  80266d:	89 d7                	mov    %edx,%edi
+  80266f:	89 d6                	mov    %edx,%esi
+  802671:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  802673:	eb 99                	jmp    80260e <sys_sysring_enter+0x38>
+
+00802675 <pgfault>:
+// The kernel normally resolves these faults itself (page_fault_cow in
+// kern/trap.c); we only get here if it ran out of memory doing so.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802675:	55                   	push   %ebp
+  802676:	89 e5                	mov    %esp,%ebp
+  802678:	83 ec 08             	sub    $0x8,%esp
+  80267b:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  80267e:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  802680:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  802683:	f6 c2 02             	test   $0x2,%dl
+  802686:	74 40                	je     8026c8 <pgfault+0x53>
+  802688:	89 c1                	mov    %eax,%ecx
+  80268a:	c1 e9 16             	shr    $0x16,%ecx
+  80268d:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802694:	f6 c1 01             	test   $0x1,%cl
+  802697:	74 2f                	je     8026c8 <pgfault+0x53>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW))
+  802699:	89 c1                	mov    %eax,%ecx
+  80269b:	c1 e9 0c             	shr    $0xc,%ecx
+  80269e:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  8026a5:	f6 c5 08             	test   $0x8,%ch
+  8026a8:	74 1e                	je     8026c8 <pgfault+0x53>
+	// Replace the page with a private writable copy of itself.  The
+	// kernel allocates, copies and maps it in one system call, so no
+	// temporary mapping at PFTEMP is needed.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8026aa:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r = sys_page_copy(0, addr, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  8026af:	83 ec 0c             	sub    $0xc,%esp
+  8026b2:	6a 07                	push   $0x7
+  8026b4:	50                   	push   %eax
+  8026b5:	6a 00                	push   $0x0
+  8026b7:	50                   	push   %eax
+  8026b8:	6a 00                	push   $0x0
+  8026ba:	e8 85 eb ff ff       	call   801244 <sys_page_copy>
+  8026bf:	83 c4 20             	add    $0x20,%esp
+  8026c2:	85 c0                	test   %eax,%eax
+  8026c4:	78 18                	js     8026de <pgfault+0x69>
+		panic("pgfault: sys_page_copy: %e", r);
+}
+  8026c6:	c9                   	leave
+  8026c7:	c3                   	ret
+		panic("pgfault: va %08x err %x is not a copy-on-write write",
+  8026c8:	83 ec 0c             	sub    $0xc,%esp
+  8026cb:	52                   	push   %edx
+  8026cc:	50                   	push   %eax
+  8026cd:	68 a4 2f 80 00       	push   $0x802fa4
+  8026d2:	6a 1c                	push   $0x1c
+  8026d4:	68 d9 2f 80 00       	push   $0x802fd9
+  8026d9:	e8 99 02 00 00       	call   802977 <_panic>
+		panic("pgfault: sys_page_copy: %e", r);
+  8026de:	50                   	push   %eax
+  8026df:	68 e4 2f 80 00       	push   $0x802fe4
+  8026e4:	6a 26                	push   $0x26
+  8026e6:	68 d9 2f 80 00       	push   $0x802fd9
+  8026eb:	e8 87 02 00 00       	call   802977 <_panic>
+
+008026f0 <ufork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+ufork(void)
+{
+  8026f0:	55                   	push   %ebp
+  8026f1:	89 e5                	mov    %esp,%ebp
+  8026f3:	57                   	push   %edi
+  8026f4:	56                   	push   %esi
+  8026f5:	53                   	push   %ebx
+  8026f6:	81 ec 38 04 00 00    	sub    $0x438,%esp
+	struct page_range vec[PAGE_VEC_MAX], *last;
+	uintptr_t va;
+	size_t n;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8026fc:	68 75 26 80 00       	push   $0x802675
+  802701:	e8 f0 02 00 00       	call   8029f6 <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  802706:	b8 07 00 00 00       	mov    $0x7,%eax
+  80270b:	cd 30                	int    $0x30
+  80270d:	89 85 d4 fb ff ff    	mov    %eax,-0x42c(%ebp)
+
+	envid = sys_exofork();
+	if (envid < 0)
+  802713:	83 c4 10             	add    $0x10,%esp
+  802716:	85 c0                	test   %eax,%eax
+  802718:	0f 88 f2 01 00 00    	js     802910 <ufork+0x220>
+		return 0;
+	}
+
+	// Copy every run of mapped pages below the exception stack, which
+	// must not be shared.
+	va = 0;
+  80271e:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  802723:	74 0b                	je     802730 <ufork+0x40>
+  802725:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  80272b:	e9 07 01 00 00       	jmp    802837 <ufork+0x147>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  802730:	e8 22 e8 ff ff       	call   800f57 <sys_getenvid>
+  802735:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80273a:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802740:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802745:	a3 08 40 80 00       	mov    %eax,0x804008
+		return 0;
+  80274a:	e9 c1 01 00 00       	jmp    802910 <ufork+0x220>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+		n = r;
+		last = &vec[n - 1];
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  80274f:	83 ea 01             	sub    $0x1,%edx
+  802752:	89 c1                	mov    %eax,%ecx
+  802754:	c1 e1 04             	shl    $0x4,%ecx
+  802757:	89 94 0d ec fd ff ff 	mov    %edx,-0x214(%ebp,%ecx,1)
+			n--;
+  80275e:	85 d2                	test   %edx,%edx
+  802760:	0f 44 f0             	cmove  %eax,%esi
+  802763:	e9 12 01 00 00       	jmp    80287a <ufork+0x18a>
+	for (i = 0; i < n; i++) {
+  802768:	83 c1 01             	add    $0x1,%ecx
+  80276b:	83 c0 10             	add    $0x10,%eax
+  80276e:	39 8d e4 fb ff ff    	cmp    %ecx,-0x41c(%ebp)
+  802774:	74 6a                	je     8027e0 <ufork+0xf0>
+		vec[i].pr_dstva = vec[i].pr_va;
+  802776:	89 c3                	mov    %eax,%ebx
+  802778:	8b 10                	mov    (%eax),%edx
+  80277a:	89 50 0c             	mov    %edx,0xc(%eax)
+		if (vec[i].pr_perm & PTE_SHARE)
+  80277d:	8b 50 08             	mov    0x8(%eax),%edx
+  802780:	f6 c6 04             	test   $0x4,%dh
+  802783:	75 e3                	jne    802768 <ufork+0x78>
+		if (vec[i].pr_perm & (PTE_W | PTE_COW)) {
+  802785:	f7 c2 02 08 00 00    	test   $0x802,%edx
+  80278b:	74 db                	je     802768 <ufork+0x78>
+			vec[i].pr_perm = (vec[i].pr_perm & ~PTE_W) | PTE_COW;
+  80278d:	81 e2 fd f7 ff ff    	and    $0xfffff7fd,%edx
+  802793:	80 ce 08             	or     $0x8,%dh
+  802796:	89 95 dc fb ff ff    	mov    %edx,-0x424(%ebp)
+  80279c:	89 53 08             	mov    %edx,0x8(%ebx)
+			cow[ncow++] = vec[i];
+  80279f:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  8027a5:	c1 e6 04             	shl    $0x4,%esi
+  8027a8:	89 f2                	mov    %esi,%edx
+  8027aa:	8d b4 35 e8 fb ff ff 	lea    -0x418(%ebp,%esi,1),%esi
+  8027b1:	8b 38                	mov    (%eax),%edi
+  8027b3:	89 bc 15 e8 fb ff ff 	mov    %edi,-0x418(%ebp,%edx,1)
+  8027ba:	8b 78 04             	mov    0x4(%eax),%edi
+  8027bd:	89 7e 04             	mov    %edi,0x4(%esi)
+  8027c0:	8b bd dc fb ff ff    	mov    -0x424(%ebp),%edi
+  8027c6:	89 7e 08             	mov    %edi,0x8(%esi)
+  8027c9:	8b 50 0c             	mov    0xc(%eax),%edx
+  8027cc:	89 56 0c             	mov    %edx,0xc(%esi)
+  8027cf:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  8027d5:	8d 7e 01             	lea    0x1(%esi),%edi
+  8027d8:	89 bd e0 fb ff ff    	mov    %edi,-0x420(%ebp)
+  8027de:	eb 88                	jmp    802768 <ufork+0x78>
+	if ((r = sys_page_map_vec(0, envid, vec, n, 0)) < 0)
+  8027e0:	8b b5 e4 fb ff ff    	mov    -0x41c(%ebp),%esi
+  8027e6:	8b bd d8 fb ff ff    	mov    -0x428(%ebp),%edi
+  8027ec:	83 ec 0c             	sub    $0xc,%esp
+  8027ef:	6a 00                	push   $0x0
+  8027f1:	56                   	push   %esi
+  8027f2:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  8027f8:	50                   	push   %eax
+  8027f9:	ff b5 d4 fb ff ff    	push   -0x42c(%ebp)
+  8027ff:	6a 00                	push   $0x0
+  802801:	e8 80 f4 ff ff       	call   801c86 <sys_page_map_vec>
+  802806:	83 c4 20             	add    $0x20,%esp
+  802809:	85 c0                	test   %eax,%eax
+  80280b:	0f 88 e5 00 00 00    	js     8028f6 <ufork+0x206>
+	return sys_page_map_vec(0, 0, cow, ncow, 0);
+  802811:	83 ec 0c             	sub    $0xc,%esp
+  802814:	6a 00                	push   $0x0
+  802816:	ff b5 e0 fb ff ff    	push   -0x420(%ebp)
+  80281c:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  802822:	50                   	push   %eax
+  802823:	6a 00                	push   $0x0
+  802825:	6a 00                	push   $0x0
+  802827:	e8 5a f4 ff ff       	call   801c86 <sys_page_map_vec>
+		if ((r = duppages(envid, vec, n)) < 0)
+  80282c:	83 c4 20             	add    $0x20,%esp
+  80282f:	85 c0                	test   %eax,%eax
+  802831:	0f 88 e7 00 00 00    	js     80291e <ufork+0x22e>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+  802837:	6a 20                	push   $0x20
+  802839:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  80283f:	50                   	push   %eax
+  802840:	57                   	push   %edi
+  802841:	6a 00                	push   $0x0
+  802843:	e8 82 f4 ff ff       	call   801cca <sys_vm_ranges>
+  802848:	83 c4 10             	add    $0x10,%esp
+  80284b:	85 c0                	test   %eax,%eax
+  80284d:	7e 51                	jle    8028a0 <ufork+0x1b0>
+		n = r;
+  80284f:	89 c6                	mov    %eax,%esi
+		last = &vec[n - 1];
+  802851:	83 e8 01             	sub    $0x1,%eax
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+  802854:	89 c1                	mov    %eax,%ecx
+  802856:	c1 e1 04             	shl    $0x4,%ecx
+  802859:	8b 94 0d ec fd ff ff 	mov    -0x214(%ebp,%ecx,1),%edx
+  802860:	89 d3                	mov    %edx,%ebx
+  802862:	c1 e3 0c             	shl    $0xc,%ebx
+  802865:	89 df                	mov    %ebx,%edi
+  802867:	03 bc 0d e8 fd ff ff 	add    -0x218(%ebp,%ecx,1),%edi
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  80286e:	81 ff 00 00 c0 ee    	cmp    $0xeec00000,%edi
+  802874:	0f 84 d5 fe ff ff    	je     80274f <ufork+0x5f>
+	for (i = 0; i < n; i++) {
+  80287a:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+	size_t i, ncow = 0;
+  802880:	c7 85 e0 fb ff ff 00 	movl   $0x0,-0x420(%ebp)
+  802887:	00 00 00 
+	for (i = 0; i < n; i++) {
+  80288a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80288f:	89 bd d8 fb ff ff    	mov    %edi,-0x428(%ebp)
+  802895:	89 b5 e4 fb ff ff    	mov    %esi,-0x41c(%ebp)
+  80289b:	e9 ce fe ff ff       	jmp    80276e <ufork+0x7e>
+			goto fail;
+	}
+	if (r < 0)
+  8028a0:	89 c6                	mov    %eax,%esi
+  8028a2:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  8028a8:	85 c0                	test   %eax,%eax
+  8028aa:	78 52                	js     8028fe <ufork+0x20e>
+		goto fail;
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE),
+  8028ac:	83 ec 04             	sub    $0x4,%esp
+  8028af:	6a 07                	push   $0x7
+  8028b1:	68 00 f0 bf ee       	push   $0xeebff000
+  8028b6:	53                   	push   %ebx
+  8028b7:	e8 3a e7 ff ff       	call   800ff6 <sys_page_alloc>
+  8028bc:	89 c6                	mov    %eax,%esi
+  8028be:	83 c4 10             	add    $0x10,%esp
+  8028c1:	85 c0                	test   %eax,%eax
+  8028c3:	78 39                	js     8028fe <ufork+0x20e>
+				PTE_P | PTE_U | PTE_W)) < 0
+	    || (r = sys_env_set_pgfault_upcall(envid,
+			thisenv->env_pgfault_upcall)) < 0
+  8028c5:	a1 08 40 80 00       	mov    0x804008,%eax
+  8028ca:	8b 40 74             	mov    0x74(%eax),%eax
+	    || (r = sys_env_set_pgfault_upcall(envid,
+  8028cd:	83 ec 08             	sub    $0x8,%esp
+  8028d0:	50                   	push   %eax
+  8028d1:	53                   	push   %ebx
+  8028d2:	e8 de ed ff ff       	call   8016b5 <sys_env_set_pgfault_upcall>
+  8028d7:	89 c6                	mov    %eax,%esi
+  8028d9:	83 c4 10             	add    $0x10,%esp
+  8028dc:	85 c0                	test   %eax,%eax
+  8028de:	78 1e                	js     8028fe <ufork+0x20e>
+	    || (r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  8028e0:	83 ec 08             	sub    $0x8,%esp
+  8028e3:	6a 02                	push   $0x2
+  8028e5:	53                   	push   %ebx
+  8028e6:	e8 bc ea ff ff       	call   8013a7 <sys_env_set_status>
+  8028eb:	89 c6                	mov    %eax,%esi
+  8028ed:	83 c4 10             	add    $0x10,%esp
+  8028f0:	85 c0                	test   %eax,%eax
+  8028f2:	79 1c                	jns    802910 <ufork+0x220>
+  8028f4:	eb 08                	jmp    8028fe <ufork+0x20e>
+  8028f6:	89 c6                	mov    %eax,%esi
+  8028f8:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+		goto fail;
+	return envid;
+
+fail:
+	sys_env_destroy(envid);
+  8028fe:	83 ec 0c             	sub    $0xc,%esp
+  802901:	53                   	push   %ebx
+  802902:	e8 8e e5 ff ff       	call   800e95 <sys_env_destroy>
+	return r;
+  802907:	83 c4 10             	add    $0x10,%esp
+  80290a:	89 b5 d4 fb ff ff    	mov    %esi,-0x42c(%ebp)
+}
+  802910:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+  802916:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802919:	5b                   	pop    %ebx
+  80291a:	5e                   	pop    %esi
+  80291b:	5f                   	pop    %edi
+  80291c:	5d                   	pop    %ebp
+  80291d:	c3                   	ret
+  80291e:	89 c6                	mov    %eax,%esi
+  802920:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  802926:	eb d6                	jmp    8028fe <ufork+0x20e>
+
+00802928 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  802928:	55                   	push   %ebp
+  802929:	89 e5                	mov    %esp,%ebp
+  80292b:	53                   	push   %ebx
+  80292c:	83 ec 04             	sub    $0x4,%esp
+	envid_t envid;
+
+	envid = sys_fork();
+  80292f:	e8 90 f2 ff ff       	call   801bc4 <sys_fork>
+  802934:	89 c3                	mov    %eax,%ebx
+	if (envid == 0)
+  802936:	85 c0                	test   %eax,%eax
+  802938:	74 07                	je     802941 <fork+0x19>
+		thisenv = &envs[ENVX(sys_getenvid())];
+	return envid;
+}
+  80293a:	89 d8                	mov    %ebx,%eax
+  80293c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80293f:	c9                   	leave
+  802940:	c3                   	ret
+		thisenv = &envs[ENVX(sys_getenvid())];
+  802941:	e8 11 e6 ff ff       	call   800f57 <sys_getenvid>
+  802946:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80294b:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802951:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802956:	a3 08 40 80 00       	mov    %eax,0x804008
+	return envid;
+  80295b:	eb dd                	jmp    80293a <fork+0x12>
+
+0080295d <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  80295d:	55                   	push   %ebp
+  80295e:	89 e5                	mov    %esp,%ebp
+  802960:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  802963:	68 ff 2f 80 00       	push   $0x802fff
+  802968:	68 a1 00 00 00       	push   $0xa1
+  80296d:	68 d9 2f 80 00       	push   $0x802fd9
+  802972:	e8 00 00 00 00       	call   802977 <_panic>
+
+00802977 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802977:	55                   	push   %ebp
+  802978:	89 e5                	mov    %esp,%ebp
+  80297a:	57                   	push   %edi
+  80297b:	56                   	push   %esi
+  80297c:	53                   	push   %ebx
+  80297d:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  802983:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  802986:	8b 1d 00 40 80 00    	mov    0x804000,%ebx
+  80298c:	e8 c6 e5 ff ff       	call   800f57 <sys_getenvid>
+  802991:	83 ec 04             	sub    $0x4,%esp
+  802994:	ff 75 0c             	push   0xc(%ebp)
+  802997:	ff 75 08             	push   0x8(%ebp)
+  80299a:	53                   	push   %ebx
+  80299b:	50                   	push   %eax
+  80299c:	68 18 30 80 00       	push   $0x803018
+  8029a1:	68 00 01 00 00       	push   $0x100
+  8029a6:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  8029ac:	56                   	push   %esi
+  8029ad:	e8 ba dd ff ff       	call   80076c <snprintf>
+  8029b2:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  8029b4:	83 c4 20             	add    $0x20,%esp
+  8029b7:	57                   	push   %edi
+  8029b8:	ff 75 10             	push   0x10(%ebp)
+  8029bb:	bf 00 01 00 00       	mov    $0x100,%edi
+  8029c0:	89 f8                	mov    %edi,%eax
+  8029c2:	29 d8                	sub    %ebx,%eax
+  8029c4:	50                   	push   %eax
+  8029c5:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8029c8:	50                   	push   %eax
+  8029c9:	e8 50 dd ff ff       	call   80071e <vsnprintf>
+  8029ce:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  8029d0:	83 c4 0c             	add    $0xc,%esp
+  8029d3:	68 af 2c 80 00       	push   $0x802caf
+  8029d8:	29 df                	sub    %ebx,%edi
+  8029da:	57                   	push   %edi
+  8029db:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8029de:	50                   	push   %eax
+  8029df:	e8 88 dd ff ff       	call   80076c <snprintf>
+	sys_cputs(buf, r);
+  8029e4:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  8029e7:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  8029e9:	53                   	push   %ebx
+  8029ea:	56                   	push   %esi
+  8029eb:	e8 69 e3 ff ff       	call   800d59 <sys_cputs>
+  8029f0:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8029f3:	cc                   	int3
+	while (1)
+  8029f4:	eb fd                	jmp    8029f3 <_panic+0x7c>
+
+008029f6 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8029f6:	55                   	push   %ebp
+  8029f7:	89 e5                	mov    %esp,%ebp
+  8029f9:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8029fc:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  802a03:	74 0a                	je     802a0f <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  802a05:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a08:	a3 0c 40 80 00       	mov    %eax,0x80400c
+}
+  802a0d:	c9                   	leave
+  802a0e:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE),
+  802a0f:	83 ec 04             	sub    $0x4,%esp
+  802a12:	6a 07                	push   $0x7
+  802a14:	68 00 f0 bf ee       	push   $0xeebff000
+  802a19:	6a 00                	push   $0x0
+  802a1b:	e8 d6 e5 ff ff       	call   800ff6 <sys_page_alloc>
+  802a20:	83 c4 10             	add    $0x10,%esp
+  802a23:	85 c0                	test   %eax,%eax
+  802a25:	78 28                	js     802a4f <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  802a27:	83 ec 08             	sub    $0x8,%esp
+  802a2a:	68 61 2a 80 00       	push   $0x802a61
+  802a2f:	6a 00                	push   $0x0
+  802a31:	e8 7f ec ff ff       	call   8016b5 <sys_env_set_pgfault_upcall>
+  802a36:	83 c4 10             	add    $0x10,%esp
+  802a39:	85 c0                	test   %eax,%eax
+  802a3b:	79 c8                	jns    802a05 <set_pgfault_handler+0xf>
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+  802a3d:	50                   	push   %eax
+  802a3e:	68 64 30 80 00       	push   $0x803064
+  802a43:	6a 24                	push   $0x24
+  802a45:	68 98 30 80 00       	push   $0x803098
+  802a4a:	e8 28 ff ff ff       	call   802977 <_panic>
+			panic("set_pgfault_handler: sys_page_alloc: %e", r);
+  802a4f:	50                   	push   %eax
+  802a50:	68 3c 30 80 00       	push   $0x80303c
+  802a55:	6a 22                	push   $0x22
+  802a57:	68 98 30 80 00       	push   $0x803098
+  802a5c:	e8 16 ff ff ff       	call   802977 <_panic>
+
+00802a61 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802a61:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802a62:	a1 0c 40 80 00       	mov    0x80400c,%eax
+	call *%eax
+  802a67:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802a69:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 0x28(%esp), %ebx		// trap-time eip
+  802a6c:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl 0x30(%esp), %eax		// trap-time esp
+  802a70:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  802a74:	83 e8 04             	sub    $0x4,%eax
+	movl %ebx, (%eax)
+  802a77:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 0x30(%esp)
+  802a79:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp			// skip fault_va and err
+  802a7d:	83 c4 08             	add    $0x8,%esp
+	popal
+  802a80:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp			// skip eip
+  802a81:	83 c4 04             	add    $0x4,%esp
+	popfl
+  802a84:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802a85:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802a86:	c3                   	ret
+
+00802a87 <dm>:
+  802a87:	55                   	push   %ebp
+  802a88:	57                   	push   %edi
+  802a89:	56                   	push   %esi
+  802a8a:	53                   	push   %ebx
+  802a8b:	83 ec 24             	sub    $0x24,%esp
+  802a8e:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802a92:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802a96:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802a9a:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802a9e:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802aa2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802aa6:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802aaa:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aaf:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ab4:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802ab9:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802ac0:	00 
+  802ac1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802ac8:	00 
+  802ac9:	89 fb                	mov    %edi,%ebx
+  802acb:	eb 08                	jmp    802ad5 <dm+0x4e>
+  802acd:	83 e9 01             	sub    $0x1,%ecx
+  802ad0:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802ad3:	74 68                	je     802b3d <dm+0xb6>
+  802ad5:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802ad9:	01 c0                	add    %eax,%eax
+  802adb:	89 c6                	mov    %eax,%esi
+  802add:	89 d7                	mov    %edx,%edi
+  802adf:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802ae3:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802ae7:	0f ad d0             	shrd   %cl,%edx,%eax
+  802aea:	d3 ea                	shr    %cl,%edx
+  802aec:	f6 c1 20             	test   $0x20,%cl
+  802aef:	74 04                	je     802af5 <dm+0x6e>
+  802af1:	89 d0                	mov    %edx,%eax
+  802af3:	31 d2                	xor    %edx,%edx
+  802af5:	83 e0 01             	and    $0x1,%eax
+  802af8:	89 04 24             	mov    %eax,(%esp)
+  802afb:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802b02:	00 
+  802b03:	8b 04 24             	mov    (%esp),%eax
+  802b06:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802b0a:	09 f0                	or     %esi,%eax
+  802b0c:	09 fa                	or     %edi,%edx
+  802b0e:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802b12:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802b16:	39 f0                	cmp    %esi,%eax
+  802b18:	89 d5                	mov    %edx,%ebp
+  802b1a:	19 fd                	sbb    %edi,%ebp
+  802b1c:	72 af                	jb     802acd <dm+0x46>
+  802b1e:	29 f0                	sub    %esi,%eax
+  802b20:	19 fa                	sbb    %edi,%edx
+  802b22:	89 cf                	mov    %ecx,%edi
+  802b24:	c1 ef 05             	shr    $0x5,%edi
+  802b27:	83 e7 01             	and    $0x1,%edi
+  802b2a:	89 fe                	mov    %edi,%esi
+  802b2c:	83 f6 01             	xor    $0x1,%esi
+  802b2f:	d3 e6                	shl    %cl,%esi
+  802b31:	d3 e7                	shl    %cl,%edi
+  802b33:	09 74 24 18          	or     %esi,0x18(%esp)
+  802b37:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802b3b:	eb 90                	jmp    802acd <dm+0x46>
+  802b3d:	85 db                	test   %ebx,%ebx
+  802b3f:	74 05                	je     802b46 <dm+0xbf>
+  802b41:	89 03                	mov    %eax,(%ebx)
+  802b43:	89 53 04             	mov    %edx,0x4(%ebx)
+  802b46:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802b4a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802b4e:	83 c4 24             	add    $0x24,%esp
+  802b51:	5b                   	pop    %ebx
+  802b52:	5e                   	pop    %esi
+  802b53:	5f                   	pop    %edi
+  802b54:	5d                   	pop    %ebp
+  802b55:	c3                   	ret
+
+00802b56 <__udivdi3>:
+  802b56:	83 ec 08             	sub    $0x8,%esp
+  802b59:	6a 00                	push   $0x0
+  802b5b:	ff 74 24 1c          	push   0x1c(%esp)
+  802b5f:	ff 74 24 1c          	push   0x1c(%esp)
+  802b63:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802b67:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802b6b:	e8 17 ff ff ff       	call   802a87 <dm>
+  802b70:	83 c4 14             	add    $0x14,%esp
+  802b73:	c3                   	ret
+
+00802b74 <__umoddi3>:
+  802b74:	83 ec 18             	sub    $0x18,%esp
+  802b77:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802b7b:	50                   	push   %eax
+  802b7c:	ff 74 24 2c          	push   0x2c(%esp)
+  802b80:	ff 74 24 2c          	push   0x2c(%esp)
+  802b84:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802b88:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802b8c:	e8 f6 fe ff ff       	call   802a87 <dm>
+  802b91:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802b95:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802b99:	83 c4 24             	add    $0x24,%esp
+  802b9c:	c3                   	ret
+
+00802b9d <__divdi3>:
+  802b9d:	53                   	push   %ebx
+  802b9e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802ba2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802ba6:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  802baa:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  802bae:	85 d2                	test   %edx,%edx
+  802bb0:	78 15                	js     802bc7 <__divdi3+0x2a>
+  802bb2:	85 db                	test   %ebx,%ebx
+  802bb4:	78 34                	js     802bea <__divdi3+0x4d>
+  802bb6:	83 ec 04             	sub    $0x4,%esp
+  802bb9:	6a 00                	push   $0x0
+  802bbb:	53                   	push   %ebx
+  802bbc:	51                   	push   %ecx
+  802bbd:	e8 c5 fe ff ff       	call   802a87 <dm>
+  802bc2:	83 c4 10             	add    $0x10,%esp
+  802bc5:	eb 21                	jmp    802be8 <__divdi3+0x4b>
+  802bc7:	f7 d8                	neg    %eax
+  802bc9:	83 d2 00             	adc    $0x0,%edx
+  802bcc:	f7 da                	neg    %edx
+  802bce:	85 db                	test   %ebx,%ebx
+  802bd0:	78 30                	js     802c02 <__divdi3+0x65>
+  802bd2:	83 ec 04             	sub    $0x4,%esp
+  802bd5:	6a 00                	push   $0x0
+  802bd7:	53                   	push   %ebx
+  802bd8:	51                   	push   %ecx
+  802bd9:	e8 a9 fe ff ff       	call   802a87 <dm>
+  802bde:	83 c4 10             	add    $0x10,%esp
+  802be1:	f7 d8                	neg    %eax
+  802be3:	83 d2 00             	adc    $0x0,%edx
+  802be6:	f7 da                	neg    %edx
+  802be8:	5b                   	pop    %ebx
+  802be9:	c3                   	ret
+  802bea:	83 ec 04             	sub    $0x4,%esp
+  802bed:	6a 00                	push   $0x0
+  802bef:	f7 d9                	neg    %ecx
+  802bf1:	83 d3 00             	adc    $0x0,%ebx
+  802bf4:	f7 db                	neg    %ebx
+  802bf6:	53                   	push   %ebx
+  802bf7:	51                   	push   %ecx
+  802bf8:	e8 8a fe ff ff       	call   802a87 <dm>
+  802bfd:	83 c4 10             	add    $0x10,%esp
+  802c00:	eb df                	jmp    802be1 <__divdi3+0x44>
+  802c02:	83 ec 04             	sub    $0x4,%esp
+  802c05:	6a 00                	push   $0x0
+  802c07:	f7 d9                	neg    %ecx
+  802c09:	83 d3 00             	adc    $0x0,%ebx
+  802c0c:	f7 db                	neg    %ebx
+  802c0e:	53                   	push   %ebx
+  802c0f:	51                   	push   %ecx
+  802c10:	e8 72 fe ff ff       	call   802a87 <dm>
+  802c15:	83 c4 10             	add    $0x10,%esp
+  802c18:	eb ce                	jmp    802be8 <__divdi3+0x4b>
+
+00802c1a <__moddi3>:
+  802c1a:	55                   	push   %ebp
+  802c1b:	57                   	push   %edi
+  802c1c:	56                   	push   %esi
+  802c1d:	53                   	push   %ebx
+  802c1e:	83 ec 18             	sub    $0x18,%esp
+  802c21:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802c25:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802c29:	89 f1                	mov    %esi,%ecx
+  802c2b:	f7 d9                	neg    %ecx
+  802c2d:	89 da                	mov    %ebx,%edx
+  802c2f:	83 d2 00             	adc    $0x0,%edx
+  802c32:	f7 da                	neg    %edx
+  802c34:	0f 48 ce             	cmovs  %esi,%ecx
+  802c37:	0f 48 d3             	cmovs  %ebx,%edx
+  802c3a:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802c3e:	50                   	push   %eax
+  802c3f:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802c43:	f7 de                	neg    %esi
+  802c45:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802c49:	83 d0 00             	adc    $0x0,%eax
+  802c4c:	f7 d8                	neg    %eax
+  802c4e:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802c53:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802c58:	50                   	push   %eax
+  802c59:	56                   	push   %esi
+  802c5a:	89 c8                	mov    %ecx,%eax
+  802c5c:	e8 26 fe ff ff       	call   802a87 <dm>
+  802c61:	83 c4 10             	add    $0x10,%esp
+  802c64:	85 db                	test   %ebx,%ebx
+  802c66:	78 10                	js     802c78 <__moddi3+0x5e>
+  802c68:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802c6c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802c70:	83 c4 14             	add    $0x14,%esp
+  802c73:	5b                   	pop    %ebx
+  802c74:	5e                   	pop    %esi
+  802c75:	5f                   	pop    %edi
+  802c76:	5d                   	pop    %ebp
+  802c77:	c3                   	ret
+  802c78:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802c7c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802c80:	f7 d8                	neg    %eax
+  802c82:	83 d2 00             	adc    $0x0,%edx
+  802c85:	f7 da                	neg    %edx
+  802c87:	eb e7                	jmp    802c70 <__moddi3+0x56>
@@ -0,0 +1,6451 @@
+
+obj/user/futex:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 cd 01 00 00       	call   8001fe <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+	mutex_unlock(&sh->mu);
+}
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 10             	sub    $0x10,%esp
+	nanoseconds_t start;
+	envid_t envid;
+	int i, r;
+
+	if ((r = sys_page_alloc(0, sh, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  80003c:	68 07 04 00 00       	push   $0x407
+  800041:	68 00 00 40 00       	push   $0x400000
+  800046:	6a 00                	push   $0x0
+  800048:	e8 43 11 00 00       	call   801190 <sys_page_alloc>
+  80004d:	83 c4 10             	add    $0x10,%esp
+  800050:	85 c0                	test   %eax,%eax
+  800052:	78 3c                	js     800090 <umain+0x5d>
+		panic("sys_page_alloc: %e", r);
+	mutex_init(&sh->mu);
+  800054:	83 ec 0c             	sub    $0xc,%esp
+  800057:	68 00 00 40 00       	push   $0x400000
+  80005c:	e8 62 2e 00 00       	call   802ec3 <mutex_init>
+	cond_init(&sh->done_cv);
+  800061:	c7 04 24 04 00 40 00 	movl   $0x400004,(%esp)
+  800068:	e8 cc 2e 00 00       	call   802f39 <cond_init>
+
+	for (i = 0; i < NCHILD; i++) {
+  80006d:	83 c4 10             	add    $0x10,%esp
+  800070:	bb 09 00 00 00       	mov    $0x9,%ebx
+  800075:	83 eb 01             	sub    $0x1,%ebx
+  800078:	0f 84 92 00 00 00    	je     800110 <umain+0xdd>
+		if ((envid = fork()) < 0)
+  80007e:	e8 3f 2a 00 00       	call   802ac2 <fork>
+  800083:	85 c0                	test   %eax,%eax
+  800085:	78 1b                	js     8000a2 <umain+0x6f>
+			panic("fork: %e", envid);
+		if (envid == 0) {
+  800087:	75 ec                	jne    800075 <umain+0x42>
+  800089:	bb e9 03 00 00       	mov    $0x3e9,%ebx
+  80008e:	eb 47                	jmp    8000d7 <umain+0xa4>
+		panic("sys_page_alloc: %e", r);
+  800090:	50                   	push   %eax
+  800091:	68 80 32 80 00       	push   $0x803280
+  800096:	6a 2d                	push   $0x2d
+  800098:	68 93 32 80 00       	push   $0x803293
+  80009d:	e8 b7 01 00 00       	call   800259 <_panic>
+			panic("fork: %e", envid);
+  8000a2:	50                   	push   %eax
+  8000a3:	68 a0 32 80 00       	push   $0x8032a0
+  8000a8:	6a 33                	push   $0x33
+  8000aa:	68 93 32 80 00       	push   $0x803293
+  8000af:	e8 a5 01 00 00       	call   800259 <_panic>
+		mutex_lock(&sh->mu);
+  8000b4:	83 ec 0c             	sub    $0xc,%esp
+  8000b7:	68 00 00 40 00       	push   $0x400000
+  8000bc:	e8 10 2e 00 00       	call   802ed1 <mutex_lock>
+		sh->counter++;
+  8000c1:	83 05 08 00 40 00 01 	addl   $0x1,0x400008
+		mutex_unlock(&sh->mu);
+  8000c8:	c7 04 24 00 00 40 00 	movl   $0x400000,(%esp)
+  8000cf:	e8 3e 2e 00 00       	call   802f12 <mutex_unlock>
+  8000d4:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NITER; i++) {
+  8000d7:	83 eb 01             	sub    $0x1,%ebx
+  8000da:	75 d8                	jne    8000b4 <umain+0x81>
+	mutex_lock(&sh->mu);
+  8000dc:	83 ec 0c             	sub    $0xc,%esp
+  8000df:	68 00 00 40 00       	push   $0x400000
+  8000e4:	e8 e8 2d 00 00       	call   802ed1 <mutex_lock>
+	sh->done++;
+  8000e9:	83 05 0c 00 40 00 01 	addl   $0x1,0x40000c
+	cond_signal(&sh->done_cv);
+  8000f0:	c7 04 24 04 00 40 00 	movl   $0x400004,(%esp)
+  8000f7:	e8 ad 2e 00 00       	call   802fa9 <cond_signal>
+	mutex_unlock(&sh->mu);
+  8000fc:	c7 04 24 00 00 40 00 	movl   $0x400000,(%esp)
+  800103:	e8 0a 2e 00 00       	call   802f12 <mutex_unlock>
+}
+  800108:	83 c4 10             	add    $0x10,%esp
+  80010b:	e9 ba 00 00 00       	jmp    8001ca <umain+0x197>
+			child();
+			return;
+		}
+	}
+
+	mutex_lock(&sh->mu);
+  800110:	83 ec 0c             	sub    $0xc,%esp
+  800113:	68 00 00 40 00       	push   $0x400000
+  800118:	e8 b4 2d 00 00       	call   802ed1 <mutex_lock>
+	while (sh->done < NCHILD)
+  80011d:	83 c4 10             	add    $0x10,%esp
+  800120:	bb 00 00 40 00       	mov    $0x400000,%ebx
+  800125:	83 7b 0c 07          	cmpl   $0x7,0xc(%ebx)
+  800129:	77 17                	ja     800142 <umain+0x10f>
+		cond_wait(&sh->done_cv, &sh->mu);
+  80012b:	83 ec 08             	sub    $0x8,%esp
+  80012e:	68 00 00 40 00       	push   $0x400000
+  800133:	68 04 00 40 00       	push   $0x400004
+  800138:	e8 52 2e 00 00       	call   802f8f <cond_wait>
+  80013d:	83 c4 10             	add    $0x10,%esp
+  800140:	eb e3                	jmp    800125 <umain+0xf2>
+	if (sh->counter != NCHILD * NITER)
+  800142:	a1 08 00 40 00       	mov    0x400008,%eax
+  800147:	3d 40 1f 00 00       	cmp    $0x1f40,%eax
+  80014c:	0f 85 80 00 00 00    	jne    8001d2 <umain+0x19f>
+		panic("counter is %d, expected %d", sh->counter,
+		      NCHILD * NITER);
+	cprintf("%d envs x %d increments: counter %d\n", NCHILD, NITER,
+  800152:	68 40 1f 00 00       	push   $0x1f40
+  800157:	68 e8 03 00 00       	push   $0x3e8
+  80015c:	6a 08                	push   $0x8
+  80015e:	68 c4 32 80 00       	push   $0x8032c4
+  800163:	e8 05 02 00 00       	call   80036d <cprintf>
+		sh->counter);
+
+	start = uptime();
+  800168:	e8 a4 29 00 00       	call   802b11 <uptime>
+  80016d:	89 c6                	mov    %eax,%esi
+  80016f:	89 d7                	mov    %edx,%edi
+	r = cond_timedwait(&sh->done_cv, &sh->mu, TIMEOUT);
+  800171:	6a 00                	push   $0x0
+  800173:	68 80 f0 fa 02       	push   $0x2faf080
+  800178:	68 00 00 40 00       	push   $0x400000
+  80017d:	68 04 00 40 00       	push   $0x400004
+  800182:	e8 c0 2d 00 00       	call   802f47 <cond_timedwait>
+  800187:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&sh->mu);
+  800189:	83 c4 14             	add    $0x14,%esp
+  80018c:	68 00 00 40 00       	push   $0x400000
+  800191:	e8 7c 2d 00 00       	call   802f12 <mutex_unlock>
+	if (r != -E_TIMEOUT)
+  800196:	83 c4 10             	add    $0x10,%esp
+  800199:	83 fb f3             	cmp    $0xfffffff3,%ebx
+  80019c:	75 4e                	jne    8001ec <umain+0x1b9>
+		panic("cond_timedwait: got %e, expected a timeout", r);
+	cprintf("timed wait gave up after %llu ms\n",
+		(uptime() - start) / NANOSECONDS_PER_MILLISECOND);
+  80019e:	e8 6e 29 00 00       	call   802b11 <uptime>
+	cprintf("timed wait gave up after %llu ms\n",
+  8001a3:	83 ec 10             	sub    $0x10,%esp
+		(uptime() - start) / NANOSECONDS_PER_MILLISECOND);
+  8001a6:	29 f0                	sub    %esi,%eax
+  8001a8:	19 fa                	sbb    %edi,%edx
+	cprintf("timed wait gave up after %llu ms\n",
+  8001aa:	6a 00                	push   $0x0
+  8001ac:	68 40 42 0f 00       	push   $0xf4240
+  8001b1:	52                   	push   %edx
+  8001b2:	50                   	push   %eax
+  8001b3:	e8 88 2f 00 00       	call   803140 <__udivdi3>
+  8001b8:	83 c4 1c             	add    $0x1c,%esp
+  8001bb:	52                   	push   %edx
+  8001bc:	50                   	push   %eax
+  8001bd:	68 18 33 80 00       	push   $0x803318
+  8001c2:	e8 a6 01 00 00       	call   80036d <cprintf>
+  8001c7:	83 c4 10             	add    $0x10,%esp
+}
+  8001ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001cd:	5b                   	pop    %ebx
+  8001ce:	5e                   	pop    %esi
+  8001cf:	5f                   	pop    %edi
+  8001d0:	5d                   	pop    %ebp
+  8001d1:	c3                   	ret
+		panic("counter is %d, expected %d", sh->counter,
+  8001d2:	83 ec 0c             	sub    $0xc,%esp
+  8001d5:	68 40 1f 00 00       	push   $0x1f40
+  8001da:	50                   	push   %eax
+  8001db:	68 a9 32 80 00       	push   $0x8032a9
+  8001e0:	6a 3e                	push   $0x3e
+  8001e2:	68 93 32 80 00       	push   $0x803293
+  8001e7:	e8 6d 00 00 00       	call   800259 <_panic>
+		panic("cond_timedwait: got %e, expected a timeout", r);
+  8001ec:	53                   	push   %ebx
+  8001ed:	68 ec 32 80 00       	push   $0x8032ec
+  8001f2:	6a 47                	push   $0x47
+  8001f4:	68 93 32 80 00       	push   $0x803293
+  8001f9:	e8 5b 00 00 00       	call   800259 <_panic>
+
+008001fe <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001fe:	55                   	push   %ebp
+  8001ff:	89 e5                	mov    %esp,%ebp
+  800201:	56                   	push   %esi
+  800202:	53                   	push   %ebx
+  800203:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800206:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  800209:	e8 e3 0e 00 00       	call   8010f1 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  80020e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800213:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  800219:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80021e:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800223:	85 db                	test   %ebx,%ebx
+  800225:	7e 07                	jle    80022e <libmain+0x30>
+		binaryname = argv[0];
+  800227:	8b 06                	mov    (%esi),%eax
+  800229:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  80022e:	83 ec 08             	sub    $0x8,%esp
+  800231:	56                   	push   %esi
+  800232:	53                   	push   %ebx
+  800233:	e8 fb fd ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800238:	e8 0a 00 00 00       	call   800247 <exit>
+}
+  80023d:	83 c4 10             	add    $0x10,%esp
+  800240:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800243:	5b                   	pop    %ebx
+  800244:	5e                   	pop    %esi
+  800245:	5d                   	pop    %ebp
+  800246:	c3                   	ret
+
+00800247 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800247:	55                   	push   %ebp
+  800248:	89 e5                	mov    %esp,%ebp
+  80024a:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  80024d:	6a 00                	push   $0x0
+  80024f:	e8 db 0d 00 00       	call   80102f <sys_env_destroy>
+}
+  800254:	83 c4 10             	add    $0x10,%esp
+  800257:	c9                   	leave
+  800258:	c3                   	ret
+
+00800259 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800259:	55                   	push   %ebp
+  80025a:	89 e5                	mov    %esp,%ebp
+  80025c:	57                   	push   %edi
+  80025d:	56                   	push   %esi
+  80025e:	53                   	push   %ebx
+  80025f:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  800265:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  800268:	8b 1d 00 40 80 00    	mov    0x804000,%ebx
+  80026e:	e8 7e 0e 00 00       	call   8010f1 <sys_getenvid>
+  800273:	83 ec 04             	sub    $0x4,%esp
+  800276:	ff 75 0c             	push   0xc(%ebp)
+  800279:	ff 75 08             	push   0x8(%ebp)
+  80027c:	53                   	push   %ebx
+  80027d:	50                   	push   %eax
+  80027e:	68 44 33 80 00       	push   $0x803344
+  800283:	68 00 01 00 00       	push   $0x100
+  800288:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  80028e:	56                   	push   %esi
+  80028f:	e8 72 06 00 00       	call   800906 <snprintf>
+  800294:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  800296:	83 c4 20             	add    $0x20,%esp
+  800299:	57                   	push   %edi
+  80029a:	ff 75 10             	push   0x10(%ebp)
+  80029d:	bf 00 01 00 00       	mov    $0x100,%edi
+  8002a2:	89 f8                	mov    %edi,%eax
+  8002a4:	29 d8                	sub    %ebx,%eax
+  8002a6:	50                   	push   %eax
+  8002a7:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8002aa:	50                   	push   %eax
+  8002ab:	e8 08 06 00 00       	call   8008b8 <vsnprintf>
+  8002b0:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  8002b2:	83 c4 0c             	add    $0xc,%esp
+  8002b5:	68 67 33 80 00       	push   $0x803367
+  8002ba:	29 df                	sub    %ebx,%edi
+  8002bc:	57                   	push   %edi
+  8002bd:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8002c0:	50                   	push   %eax
+  8002c1:	e8 40 06 00 00       	call   800906 <snprintf>
+	sys_cputs(buf, r);
+  8002c6:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  8002c9:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  8002cb:	53                   	push   %ebx
+  8002cc:	56                   	push   %esi
+  8002cd:	e8 21 0c 00 00       	call   800ef3 <sys_cputs>
+  8002d2:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002d5:	cc                   	int3
+	while (1)
+  8002d6:	eb fd                	jmp    8002d5 <_panic+0x7c>
+
+008002d8 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002d8:	55                   	push   %ebp
+  8002d9:	89 e5                	mov    %esp,%ebp
+  8002db:	53                   	push   %ebx
+  8002dc:	83 ec 04             	sub    $0x4,%esp
+  8002df:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8002e2:	8b 13                	mov    (%ebx),%edx
+  8002e4:	8d 42 01             	lea    0x1(%edx),%eax
+  8002e7:	89 03                	mov    %eax,(%ebx)
+  8002e9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002ec:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8002f0:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002f5:	74 09                	je     800300 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002f7:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002fe:	c9                   	leave
+  8002ff:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800300:	83 ec 08             	sub    $0x8,%esp
+  800303:	68 ff 00 00 00       	push   $0xff
+  800308:	8d 43 08             	lea    0x8(%ebx),%eax
+  80030b:	50                   	push   %eax
+  80030c:	e8 e2 0b 00 00       	call   800ef3 <sys_cputs>
+		b->idx = 0;
+  800311:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800317:	83 c4 10             	add    $0x10,%esp
+  80031a:	eb db                	jmp    8002f7 <putch+0x1f>
+
+0080031c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80031c:	55                   	push   %ebp
+  80031d:	89 e5                	mov    %esp,%ebp
+  80031f:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800325:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80032c:	00 00 00 
+	b.cnt = 0;
+  80032f:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800336:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800339:	ff 75 0c             	push   0xc(%ebp)
+  80033c:	ff 75 08             	push   0x8(%ebp)
+  80033f:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800345:	50                   	push   %eax
+  800346:	68 d8 02 80 00       	push   $0x8002d8
+  80034b:	e8 14 01 00 00       	call   800464 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800350:	83 c4 08             	add    $0x8,%esp
+  800353:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800359:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80035f:	50                   	push   %eax
+  800360:	e8 8e 0b 00 00       	call   800ef3 <sys_cputs>
+
+	return b.cnt;
+}
+  800365:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80036b:	c9                   	leave
+  80036c:	c3                   	ret
+
+0080036d <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80036d:	55                   	push   %ebp
+  80036e:	89 e5                	mov    %esp,%ebp
+  800370:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800373:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800376:	50                   	push   %eax
+  800377:	ff 75 08             	push   0x8(%ebp)
+  80037a:	e8 9d ff ff ff       	call   80031c <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80037f:	c9                   	leave
+  800380:	c3                   	ret
+
+00800381 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800381:	55                   	push   %ebp
+  800382:	89 e5                	mov    %esp,%ebp
+  800384:	57                   	push   %edi
+  800385:	56                   	push   %esi
+  800386:	53                   	push   %ebx
+  800387:	83 ec 1c             	sub    $0x1c,%esp
+  80038a:	89 c7                	mov    %eax,%edi
+  80038c:	89 d6                	mov    %edx,%esi
+  80038e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800391:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800394:	89 d1                	mov    %edx,%ecx
+  800396:	89 c2                	mov    %eax,%edx
+  800398:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80039b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80039e:	8b 45 10             	mov    0x10(%ebp),%eax
+  8003a1:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8003a4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003a7:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003ae:	39 c2                	cmp    %eax,%edx
+  8003b0:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8003b3:	72 3e                	jb     8003f3 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003b5:	83 ec 0c             	sub    $0xc,%esp
+  8003b8:	ff 75 18             	push   0x18(%ebp)
+  8003bb:	83 eb 01             	sub    $0x1,%ebx
+  8003be:	53                   	push   %ebx
+  8003bf:	50                   	push   %eax
+  8003c0:	83 ec 08             	sub    $0x8,%esp
+  8003c3:	ff 75 e4             	push   -0x1c(%ebp)
+  8003c6:	ff 75 e0             	push   -0x20(%ebp)
+  8003c9:	ff 75 dc             	push   -0x24(%ebp)
+  8003cc:	ff 75 d8             	push   -0x28(%ebp)
+  8003cf:	e8 6c 2d 00 00       	call   803140 <__udivdi3>
+  8003d4:	83 c4 18             	add    $0x18,%esp
+  8003d7:	52                   	push   %edx
+  8003d8:	50                   	push   %eax
+  8003d9:	89 f2                	mov    %esi,%edx
+  8003db:	89 f8                	mov    %edi,%eax
+  8003dd:	e8 9f ff ff ff       	call   800381 <printnum>
+  8003e2:	83 c4 20             	add    $0x20,%esp
+  8003e5:	eb 13                	jmp    8003fa <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8003e7:	83 ec 08             	sub    $0x8,%esp
+  8003ea:	56                   	push   %esi
+  8003eb:	ff 75 18             	push   0x18(%ebp)
+  8003ee:	ff d7                	call   *%edi
+  8003f0:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8003f3:	83 eb 01             	sub    $0x1,%ebx
+  8003f6:	85 db                	test   %ebx,%ebx
+  8003f8:	7f ed                	jg     8003e7 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8003fa:	83 ec 08             	sub    $0x8,%esp
+  8003fd:	56                   	push   %esi
+  8003fe:	83 ec 04             	sub    $0x4,%esp
+  800401:	ff 75 e4             	push   -0x1c(%ebp)
+  800404:	ff 75 e0             	push   -0x20(%ebp)
+  800407:	ff 75 dc             	push   -0x24(%ebp)
+  80040a:	ff 75 d8             	push   -0x28(%ebp)
+  80040d:	e8 4c 2d 00 00       	call   80315e <__umoddi3>
+  800412:	83 c4 14             	add    $0x14,%esp
+  800415:	0f be 80 69 33 80 00 	movsbl 0x803369(%eax),%eax
+  80041c:	50                   	push   %eax
+  80041d:	ff d7                	call   *%edi
+}
+  80041f:	83 c4 10             	add    $0x10,%esp
+  800422:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800425:	5b                   	pop    %ebx
+  800426:	5e                   	pop    %esi
+  800427:	5f                   	pop    %edi
+  800428:	5d                   	pop    %ebp
+  800429:	c3                   	ret
+
+0080042a <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80042a:	55                   	push   %ebp
+  80042b:	89 e5                	mov    %esp,%ebp
+  80042d:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800430:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800434:	8b 10                	mov    (%eax),%edx
+  800436:	3b 50 04             	cmp    0x4(%eax),%edx
+  800439:	73 0a                	jae    800445 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80043b:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80043e:	89 08                	mov    %ecx,(%eax)
+  800440:	8b 45 08             	mov    0x8(%ebp),%eax
+  800443:	88 02                	mov    %al,(%edx)
+}
+  800445:	5d                   	pop    %ebp
+  800446:	c3                   	ret
+
+00800447 <printfmt>:
+{
+  800447:	55                   	push   %ebp
+  800448:	89 e5                	mov    %esp,%ebp
+  80044a:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80044d:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800450:	50                   	push   %eax
+  800451:	ff 75 10             	push   0x10(%ebp)
+  800454:	ff 75 0c             	push   0xc(%ebp)
+  800457:	ff 75 08             	push   0x8(%ebp)
+  80045a:	e8 05 00 00 00       	call   800464 <vprintfmt>
+}
+  80045f:	83 c4 10             	add    $0x10,%esp
+  800462:	c9                   	leave
+  800463:	c3                   	ret
+
+00800464 <vprintfmt>:
+{
+  800464:	55                   	push   %ebp
+  800465:	89 e5                	mov    %esp,%ebp
+  800467:	57                   	push   %edi
+  800468:	56                   	push   %esi
+  800469:	53                   	push   %ebx
+  80046a:	83 ec 2c             	sub    $0x2c,%esp
+  80046d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800470:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800473:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800476:	eb 0a                	jmp    800482 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800478:	83 ec 08             	sub    $0x8,%esp
+  80047b:	53                   	push   %ebx
+  80047c:	50                   	push   %eax
+  80047d:	ff d6                	call   *%esi
+  80047f:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800482:	83 c7 01             	add    $0x1,%edi
+  800485:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800489:	83 f8 25             	cmp    $0x25,%eax
+  80048c:	74 0c                	je     80049a <vprintfmt+0x36>
+			if (ch == '\0')
+  80048e:	85 c0                	test   %eax,%eax
+  800490:	75 e6                	jne    800478 <vprintfmt+0x14>
+}
+  800492:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800495:	5b                   	pop    %ebx
+  800496:	5e                   	pop    %esi
+  800497:	5f                   	pop    %edi
+  800498:	5d                   	pop    %ebp
+  800499:	c3                   	ret
+		padc = ' ';
+  80049a:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80049e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8004a5:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8004ac:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8004b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004b8:	8d 47 01             	lea    0x1(%edi),%eax
+  8004bb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004be:	0f b6 17             	movzbl (%edi),%edx
+  8004c1:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8004c4:	3c 55                	cmp    $0x55,%al
+  8004c6:	0f 87 cf 03 00 00    	ja     80089b <vprintfmt+0x437>
+  8004cc:	0f b6 c0             	movzbl %al,%eax
+  8004cf:	ff 24 85 60 34 80 00 	jmp    *0x803460(,%eax,4)
+  8004d6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8004d9:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8004dd:	eb d9                	jmp    8004b8 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004df:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8004e2:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8004e6:	eb d0                	jmp    8004b8 <vprintfmt+0x54>
+  8004e8:	0f b6 d2             	movzbl %dl,%edx
+  8004eb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8004ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f3:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8004f6:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8004f9:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8004fd:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800500:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800503:	83 f9 09             	cmp    $0x9,%ecx
+  800506:	77 55                	ja     80055d <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800508:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80050b:	eb e9                	jmp    8004f6 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80050d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800510:	8b 00                	mov    (%eax),%eax
+  800512:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800515:	8b 45 14             	mov    0x14(%ebp),%eax
+  800518:	8d 40 04             	lea    0x4(%eax),%eax
+  80051b:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80051e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800521:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800525:	79 91                	jns    8004b8 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800527:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80052a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80052d:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800534:	eb 82                	jmp    8004b8 <vprintfmt+0x54>
+			if (width < 0)
+  800536:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800539:	85 d2                	test   %edx,%edx
+  80053b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800540:	0f 49 c2             	cmovns %edx,%eax
+  800543:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800546:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800549:	e9 6a ff ff ff       	jmp    8004b8 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80054e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800551:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800558:	e9 5b ff ff ff       	jmp    8004b8 <vprintfmt+0x54>
+  80055d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800560:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800563:	eb bc                	jmp    800521 <vprintfmt+0xbd>
+			lflag++;
+  800565:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800568:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80056b:	e9 48 ff ff ff       	jmp    8004b8 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800570:	8b 45 14             	mov    0x14(%ebp),%eax
+  800573:	8d 78 04             	lea    0x4(%eax),%edi
+  800576:	83 ec 08             	sub    $0x8,%esp
+  800579:	53                   	push   %ebx
+  80057a:	ff 30                	push   (%eax)
+  80057c:	ff d6                	call   *%esi
+			break;
+  80057e:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800581:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800584:	e9 b1 02 00 00       	jmp    80083a <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800589:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058c:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80058f:	8b 10                	mov    (%eax),%edx
+  800591:	89 d0                	mov    %edx,%eax
+  800593:	f7 d8                	neg    %eax
+  800595:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800598:	83 f8 0d             	cmp    $0xd,%eax
+  80059b:	7f 23                	jg     8005c0 <vprintfmt+0x15c>
+  80059d:	8b 14 85 c0 35 80 00 	mov    0x8035c0(,%eax,4),%edx
+  8005a4:	85 d2                	test   %edx,%edx
+  8005a6:	74 18                	je     8005c0 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8005a8:	52                   	push   %edx
+  8005a9:	68 8a 33 80 00       	push   $0x80338a
+  8005ae:	53                   	push   %ebx
+  8005af:	56                   	push   %esi
+  8005b0:	e8 92 fe ff ff       	call   800447 <printfmt>
+  8005b5:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005b8:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8005bb:	e9 7a 02 00 00       	jmp    80083a <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8005c0:	50                   	push   %eax
+  8005c1:	68 81 33 80 00       	push   $0x803381
+  8005c6:	53                   	push   %ebx
+  8005c7:	56                   	push   %esi
+  8005c8:	e8 7a fe ff ff       	call   800447 <printfmt>
+  8005cd:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005d0:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8005d3:	e9 62 02 00 00       	jmp    80083a <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005db:	83 c0 04             	add    $0x4,%eax
+  8005de:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8005e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e4:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8005e6:	85 c9                	test   %ecx,%ecx
+  8005e8:	b8 7a 33 80 00       	mov    $0x80337a,%eax
+  8005ed:	0f 45 c1             	cmovne %ecx,%eax
+  8005f0:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8005f3:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005f7:	7e 06                	jle    8005ff <vprintfmt+0x19b>
+  8005f9:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8005fd:	75 0b                	jne    80060a <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005ff:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800602:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800605:	89 75 08             	mov    %esi,0x8(%ebp)
+  800608:	eb 5c                	jmp    800666 <vprintfmt+0x202>
+  80060a:	83 ec 08             	sub    $0x8,%esp
+  80060d:	ff 75 d0             	push   -0x30(%ebp)
+  800610:	ff 75 cc             	push   -0x34(%ebp)
+  800613:	e8 20 03 00 00       	call   800938 <strnlen>
+  800618:	89 c2                	mov    %eax,%edx
+  80061a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80061d:	29 d0                	sub    %edx,%eax
+  80061f:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800622:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800626:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800629:	89 75 08             	mov    %esi,0x8(%ebp)
+  80062c:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80062e:	eb 0e                	jmp    80063e <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800630:	83 ec 08             	sub    $0x8,%esp
+  800633:	53                   	push   %ebx
+  800634:	57                   	push   %edi
+  800635:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800638:	83 ee 01             	sub    $0x1,%esi
+  80063b:	83 c4 10             	add    $0x10,%esp
+  80063e:	85 f6                	test   %esi,%esi
+  800640:	7f ee                	jg     800630 <vprintfmt+0x1cc>
+  800642:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800645:	8b 75 08             	mov    0x8(%ebp),%esi
+  800648:	85 c0                	test   %eax,%eax
+  80064a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80064f:	0f 49 d0             	cmovns %eax,%edx
+  800652:	29 d0                	sub    %edx,%eax
+  800654:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800657:	eb a6                	jmp    8005ff <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800659:	83 ec 08             	sub    $0x8,%esp
+  80065c:	53                   	push   %ebx
+  80065d:	52                   	push   %edx
+  80065e:	ff 55 08             	call   *0x8(%ebp)
+  800661:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800664:	89 f1                	mov    %esi,%ecx
+  800666:	8d 71 01             	lea    0x1(%ecx),%esi
+  800669:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80066d:	0f be d0             	movsbl %al,%edx
+  800670:	85 d2                	test   %edx,%edx
+  800672:	74 28                	je     80069c <vprintfmt+0x238>
+  800674:	85 ff                	test   %edi,%edi
+  800676:	78 05                	js     80067d <vprintfmt+0x219>
+  800678:	83 ef 01             	sub    $0x1,%edi
+  80067b:	78 30                	js     8006ad <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80067d:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800681:	74 d6                	je     800659 <vprintfmt+0x1f5>
+  800683:	0f be c0             	movsbl %al,%eax
+  800686:	83 e8 20             	sub    $0x20,%eax
+  800689:	83 f8 5e             	cmp    $0x5e,%eax
+  80068c:	76 cb                	jbe    800659 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80068e:	83 ec 08             	sub    $0x8,%esp
+  800691:	53                   	push   %ebx
+  800692:	6a 3f                	push   $0x3f
+  800694:	ff 55 08             	call   *0x8(%ebp)
+  800697:	83 c4 10             	add    $0x10,%esp
+  80069a:	eb c8                	jmp    800664 <vprintfmt+0x200>
+  80069c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80069f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006a2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8006a5:	01 d0                	add    %edx,%eax
+  8006a7:	29 c8                	sub    %ecx,%eax
+  8006a9:	89 c7                	mov    %eax,%edi
+  8006ab:	eb 13                	jmp    8006c0 <vprintfmt+0x25c>
+  8006ad:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006b0:	eb ed                	jmp    80069f <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8006b2:	83 ec 08             	sub    $0x8,%esp
+  8006b5:	53                   	push   %ebx
+  8006b6:	6a 20                	push   $0x20
+  8006b8:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8006ba:	83 ef 01             	sub    $0x1,%edi
+  8006bd:	83 c4 10             	add    $0x10,%esp
+  8006c0:	85 ff                	test   %edi,%edi
+  8006c2:	7f ee                	jg     8006b2 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006c4:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8006c7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006ca:	e9 6b 01 00 00       	jmp    80083a <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8006cf:	83 f9 01             	cmp    $0x1,%ecx
+  8006d2:	7f 1f                	jg     8006f3 <vprintfmt+0x28f>
+	else if (lflag)
+  8006d4:	85 c9                	test   %ecx,%ecx
+  8006d6:	74 67                	je     80073f <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8006d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006db:	8b 00                	mov    (%eax),%eax
+  8006dd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006e0:	89 c1                	mov    %eax,%ecx
+  8006e2:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006e5:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006eb:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ee:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f1:	eb 17                	jmp    80070a <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8006f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f6:	8b 50 04             	mov    0x4(%eax),%edx
+  8006f9:	8b 00                	mov    (%eax),%eax
+  8006fb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006fe:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800701:	8b 45 14             	mov    0x14(%ebp),%eax
+  800704:	8d 40 08             	lea    0x8(%eax),%eax
+  800707:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80070a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80070d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800710:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800715:	85 c9                	test   %ecx,%ecx
+  800717:	0f 89 03 01 00 00    	jns    800820 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  80071d:	83 ec 08             	sub    $0x8,%esp
+  800720:	53                   	push   %ebx
+  800721:	6a 2d                	push   $0x2d
+  800723:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800725:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800728:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80072b:	f7 da                	neg    %edx
+  80072d:	83 d1 00             	adc    $0x0,%ecx
+  800730:	f7 d9                	neg    %ecx
+  800732:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800735:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80073a:	e9 e1 00 00 00       	jmp    800820 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80073f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800742:	8b 00                	mov    (%eax),%eax
+  800744:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800747:	89 c1                	mov    %eax,%ecx
+  800749:	c1 f9 1f             	sar    $0x1f,%ecx
+  80074c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80074f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800752:	8d 40 04             	lea    0x4(%eax),%eax
+  800755:	89 45 14             	mov    %eax,0x14(%ebp)
+  800758:	eb b0                	jmp    80070a <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80075a:	83 f9 01             	cmp    $0x1,%ecx
+  80075d:	7f 1e                	jg     80077d <vprintfmt+0x319>
+	else if (lflag)
+  80075f:	85 c9                	test   %ecx,%ecx
+  800761:	74 32                	je     800795 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800763:	8b 45 14             	mov    0x14(%ebp),%eax
+  800766:	8b 10                	mov    (%eax),%edx
+  800768:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80076d:	8d 40 04             	lea    0x4(%eax),%eax
+  800770:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800773:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800778:	e9 a3 00 00 00       	jmp    800820 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80077d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800780:	8b 10                	mov    (%eax),%edx
+  800782:	8b 48 04             	mov    0x4(%eax),%ecx
+  800785:	8d 40 08             	lea    0x8(%eax),%eax
+  800788:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80078b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800790:	e9 8b 00 00 00       	jmp    800820 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800795:	8b 45 14             	mov    0x14(%ebp),%eax
+  800798:	8b 10                	mov    (%eax),%edx
+  80079a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80079f:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007a5:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8007aa:	eb 74                	jmp    800820 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8007ac:	83 f9 01             	cmp    $0x1,%ecx
+  8007af:	7f 1b                	jg     8007cc <vprintfmt+0x368>
+	else if (lflag)
+  8007b1:	85 c9                	test   %ecx,%ecx
+  8007b3:	74 2c                	je     8007e1 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8007b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b8:	8b 10                	mov    (%eax),%edx
+  8007ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007bf:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007c5:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8007ca:	eb 54                	jmp    800820 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8007cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007cf:	8b 10                	mov    (%eax),%edx
+  8007d1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007d4:	8d 40 08             	lea    0x8(%eax),%eax
+  8007d7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007da:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8007df:	eb 3f                	jmp    800820 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8007e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e4:	8b 10                	mov    (%eax),%edx
+  8007e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007eb:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ee:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007f1:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8007f6:	eb 28                	jmp    800820 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8007f8:	83 ec 08             	sub    $0x8,%esp
+  8007fb:	53                   	push   %ebx
+  8007fc:	6a 30                	push   $0x30
+  8007fe:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800800:	83 c4 08             	add    $0x8,%esp
+  800803:	53                   	push   %ebx
+  800804:	6a 78                	push   $0x78
+  800806:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800808:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080b:	8b 10                	mov    (%eax),%edx
+  80080d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800812:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800815:	8d 40 04             	lea    0x4(%eax),%eax
+  800818:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80081b:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800820:	83 ec 0c             	sub    $0xc,%esp
+  800823:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800827:	50                   	push   %eax
+  800828:	ff 75 e0             	push   -0x20(%ebp)
+  80082b:	57                   	push   %edi
+  80082c:	51                   	push   %ecx
+  80082d:	52                   	push   %edx
+  80082e:	89 da                	mov    %ebx,%edx
+  800830:	89 f0                	mov    %esi,%eax
+  800832:	e8 4a fb ff ff       	call   800381 <printnum>
+			break;
+  800837:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80083a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80083d:	e9 40 fc ff ff       	jmp    800482 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800842:	83 f9 01             	cmp    $0x1,%ecx
+  800845:	7f 1b                	jg     800862 <vprintfmt+0x3fe>
+	else if (lflag)
+  800847:	85 c9                	test   %ecx,%ecx
+  800849:	74 2c                	je     800877 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  80084b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80084e:	8b 10                	mov    (%eax),%edx
+  800850:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800855:	8d 40 04             	lea    0x4(%eax),%eax
+  800858:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80085b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800860:	eb be                	jmp    800820 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800862:	8b 45 14             	mov    0x14(%ebp),%eax
+  800865:	8b 10                	mov    (%eax),%edx
+  800867:	8b 48 04             	mov    0x4(%eax),%ecx
+  80086a:	8d 40 08             	lea    0x8(%eax),%eax
+  80086d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800870:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800875:	eb a9                	jmp    800820 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800877:	8b 45 14             	mov    0x14(%ebp),%eax
+  80087a:	8b 10                	mov    (%eax),%edx
+  80087c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800881:	8d 40 04             	lea    0x4(%eax),%eax
+  800884:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800887:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80088c:	eb 92                	jmp    800820 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  80088e:	83 ec 08             	sub    $0x8,%esp
+  800891:	53                   	push   %ebx
+  800892:	6a 25                	push   $0x25
+  800894:	ff d6                	call   *%esi
+			break;
+  800896:	83 c4 10             	add    $0x10,%esp
+  800899:	eb 9f                	jmp    80083a <vprintfmt+0x3d6>
+			putch('%', putdat);
+  80089b:	83 ec 08             	sub    $0x8,%esp
+  80089e:	53                   	push   %ebx
+  80089f:	6a 25                	push   $0x25
+  8008a1:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8008a3:	83 c4 10             	add    $0x10,%esp
+  8008a6:	89 f8                	mov    %edi,%eax
+  8008a8:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8008ac:	74 05                	je     8008b3 <vprintfmt+0x44f>
+  8008ae:	83 e8 01             	sub    $0x1,%eax
+  8008b1:	eb f5                	jmp    8008a8 <vprintfmt+0x444>
+  8008b3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8008b6:	eb 82                	jmp    80083a <vprintfmt+0x3d6>
+
+008008b8 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8008b8:	55                   	push   %ebp
+  8008b9:	89 e5                	mov    %esp,%ebp
+  8008bb:	83 ec 18             	sub    $0x18,%esp
+  8008be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008c1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8008c4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008c7:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008cb:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008ce:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8008d5:	85 c0                	test   %eax,%eax
+  8008d7:	74 26                	je     8008ff <vsnprintf+0x47>
+  8008d9:	85 d2                	test   %edx,%edx
+  8008db:	7e 22                	jle    8008ff <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008dd:	ff 75 14             	push   0x14(%ebp)
+  8008e0:	ff 75 10             	push   0x10(%ebp)
+  8008e3:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008e6:	50                   	push   %eax
+  8008e7:	68 2a 04 80 00       	push   $0x80042a
+  8008ec:	e8 73 fb ff ff       	call   800464 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008f1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008f4:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008fa:	83 c4 10             	add    $0x10,%esp
+}
+  8008fd:	c9                   	leave
+  8008fe:	c3                   	ret
+		return -E_INVAL;
+  8008ff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800904:	eb f7                	jmp    8008fd <vsnprintf+0x45>
+
+00800906 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800906:	55                   	push   %ebp
+  800907:	89 e5                	mov    %esp,%ebp
+  800909:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80090c:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80090f:	50                   	push   %eax
+  800910:	ff 75 10             	push   0x10(%ebp)
+  800913:	ff 75 0c             	push   0xc(%ebp)
+  800916:	ff 75 08             	push   0x8(%ebp)
+  800919:	e8 9a ff ff ff       	call   8008b8 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80091e:	c9                   	leave
+  80091f:	c3                   	ret
+
+00800920 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800920:	55                   	push   %ebp
+  800921:	89 e5                	mov    %esp,%ebp
+  800923:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800926:	b8 00 00 00 00       	mov    $0x0,%eax
+  80092b:	eb 03                	jmp    800930 <strlen+0x10>
+		n++;
+  80092d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800930:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800934:	75 f7                	jne    80092d <strlen+0xd>
+	return n;
+}
+  800936:	5d                   	pop    %ebp
+  800937:	c3                   	ret
+
+00800938 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800938:	55                   	push   %ebp
+  800939:	89 e5                	mov    %esp,%ebp
+  80093b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80093e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800941:	b8 00 00 00 00       	mov    $0x0,%eax
+  800946:	eb 03                	jmp    80094b <strnlen+0x13>
+		n++;
+  800948:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80094b:	39 d0                	cmp    %edx,%eax
+  80094d:	74 08                	je     800957 <strnlen+0x1f>
+  80094f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800953:	75 f3                	jne    800948 <strnlen+0x10>
+  800955:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800957:	89 d0                	mov    %edx,%eax
+  800959:	5d                   	pop    %ebp
+  80095a:	c3                   	ret
+
+0080095b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80095b:	55                   	push   %ebp
+  80095c:	89 e5                	mov    %esp,%ebp
+  80095e:	53                   	push   %ebx
+  80095f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800962:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800965:	b8 00 00 00 00       	mov    $0x0,%eax
+  80096a:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80096e:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800971:	83 c0 01             	add    $0x1,%eax
+  800974:	84 d2                	test   %dl,%dl
+  800976:	75 f2                	jne    80096a <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800978:	89 c8                	mov    %ecx,%eax
+  80097a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80097d:	c9                   	leave
+  80097e:	c3                   	ret
+
+0080097f <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80097f:	55                   	push   %ebp
+  800980:	89 e5                	mov    %esp,%ebp
+  800982:	53                   	push   %ebx
+  800983:	83 ec 10             	sub    $0x10,%esp
+  800986:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800989:	53                   	push   %ebx
+  80098a:	e8 91 ff ff ff       	call   800920 <strlen>
+  80098f:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800992:	ff 75 0c             	push   0xc(%ebp)
+  800995:	01 d8                	add    %ebx,%eax
+  800997:	50                   	push   %eax
+  800998:	e8 be ff ff ff       	call   80095b <strcpy>
+	return dst;
+}
+  80099d:	89 d8                	mov    %ebx,%eax
+  80099f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009a2:	c9                   	leave
+  8009a3:	c3                   	ret
+
+008009a4 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8009a4:	55                   	push   %ebp
+  8009a5:	89 e5                	mov    %esp,%ebp
+  8009a7:	56                   	push   %esi
+  8009a8:	53                   	push   %ebx
+  8009a9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009ac:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8009af:	89 f3                	mov    %esi,%ebx
+  8009b1:	03 5d 10             	add    0x10(%ebp),%ebx
+  8009b4:	89 f0                	mov    %esi,%eax
+  8009b6:	eb 0f                	jmp    8009c7 <strncpy+0x23>
+		*dst++ = *src;
+  8009b8:	83 c0 01             	add    $0x1,%eax
+  8009bb:	0f b6 0a             	movzbl (%edx),%ecx
+  8009be:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8009c1:	80 f9 01             	cmp    $0x1,%cl
+  8009c4:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8009c7:	39 d8                	cmp    %ebx,%eax
+  8009c9:	75 ed                	jne    8009b8 <strncpy+0x14>
+	}
+	return ret;
+}
+  8009cb:	89 f0                	mov    %esi,%eax
+  8009cd:	5b                   	pop    %ebx
+  8009ce:	5e                   	pop    %esi
+  8009cf:	5d                   	pop    %ebp
+  8009d0:	c3                   	ret
+
+008009d1 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8009d1:	55                   	push   %ebp
+  8009d2:	89 e5                	mov    %esp,%ebp
+  8009d4:	56                   	push   %esi
+  8009d5:	53                   	push   %ebx
+  8009d6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009dc:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8009df:	89 f0                	mov    %esi,%eax
+  8009e1:	85 d2                	test   %edx,%edx
+  8009e3:	74 21                	je     800a06 <strlcpy+0x35>
+  8009e5:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8009e9:	89 f2                	mov    %esi,%edx
+  8009eb:	eb 09                	jmp    8009f6 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8009ed:	83 c1 01             	add    $0x1,%ecx
+  8009f0:	83 c2 01             	add    $0x1,%edx
+  8009f3:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8009f6:	39 c2                	cmp    %eax,%edx
+  8009f8:	74 09                	je     800a03 <strlcpy+0x32>
+  8009fa:	0f b6 19             	movzbl (%ecx),%ebx
+  8009fd:	84 db                	test   %bl,%bl
+  8009ff:	75 ec                	jne    8009ed <strlcpy+0x1c>
+  800a01:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800a03:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a06:	29 f0                	sub    %esi,%eax
+}
+  800a08:	5b                   	pop    %ebx
+  800a09:	5e                   	pop    %esi
+  800a0a:	5d                   	pop    %ebp
+  800a0b:	c3                   	ret
+
+00800a0c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a0c:	55                   	push   %ebp
+  800a0d:	89 e5                	mov    %esp,%ebp
+  800a0f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a12:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a15:	eb 06                	jmp    800a1d <strcmp+0x11>
+		p++, q++;
+  800a17:	83 c1 01             	add    $0x1,%ecx
+  800a1a:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a1d:	0f b6 01             	movzbl (%ecx),%eax
+  800a20:	84 c0                	test   %al,%al
+  800a22:	74 04                	je     800a28 <strcmp+0x1c>
+  800a24:	3a 02                	cmp    (%edx),%al
+  800a26:	74 ef                	je     800a17 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a28:	0f b6 c0             	movzbl %al,%eax
+  800a2b:	0f b6 12             	movzbl (%edx),%edx
+  800a2e:	29 d0                	sub    %edx,%eax
+}
+  800a30:	5d                   	pop    %ebp
+  800a31:	c3                   	ret
+
+00800a32 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a32:	55                   	push   %ebp
+  800a33:	89 e5                	mov    %esp,%ebp
+  800a35:	53                   	push   %ebx
+  800a36:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a39:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a3c:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800a3f:	eb 09                	jmp    800a4a <strncmp+0x18>
+		n--, p++, q++;
+  800a41:	83 ea 01             	sub    $0x1,%edx
+  800a44:	83 c0 01             	add    $0x1,%eax
+  800a47:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800a4a:	85 d2                	test   %edx,%edx
+  800a4c:	74 18                	je     800a66 <strncmp+0x34>
+  800a4e:	0f b6 18             	movzbl (%eax),%ebx
+  800a51:	84 db                	test   %bl,%bl
+  800a53:	74 04                	je     800a59 <strncmp+0x27>
+  800a55:	3a 19                	cmp    (%ecx),%bl
+  800a57:	74 e8                	je     800a41 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a59:	0f b6 00             	movzbl (%eax),%eax
+  800a5c:	0f b6 11             	movzbl (%ecx),%edx
+  800a5f:	29 d0                	sub    %edx,%eax
+}
+  800a61:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a64:	c9                   	leave
+  800a65:	c3                   	ret
+		return 0;
+  800a66:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a6b:	eb f4                	jmp    800a61 <strncmp+0x2f>
+
+00800a6d <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a6d:	55                   	push   %ebp
+  800a6e:	89 e5                	mov    %esp,%ebp
+  800a70:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a73:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a77:	eb 03                	jmp    800a7c <strchr+0xf>
+  800a79:	83 c0 01             	add    $0x1,%eax
+  800a7c:	0f b6 10             	movzbl (%eax),%edx
+  800a7f:	84 d2                	test   %dl,%dl
+  800a81:	74 06                	je     800a89 <strchr+0x1c>
+		if (*s == c)
+  800a83:	38 ca                	cmp    %cl,%dl
+  800a85:	75 f2                	jne    800a79 <strchr+0xc>
+  800a87:	eb 05                	jmp    800a8e <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a89:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a8e:	5d                   	pop    %ebp
+  800a8f:	c3                   	ret
+
+00800a90 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a90:	55                   	push   %ebp
+  800a91:	89 e5                	mov    %esp,%ebp
+  800a93:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a96:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a9a:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a9d:	38 ca                	cmp    %cl,%dl
+  800a9f:	74 09                	je     800aaa <strfind+0x1a>
+  800aa1:	84 d2                	test   %dl,%dl
+  800aa3:	74 05                	je     800aaa <strfind+0x1a>
+	for (; *s; s++)
+  800aa5:	83 c0 01             	add    $0x1,%eax
+  800aa8:	eb f0                	jmp    800a9a <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800aaa:	5d                   	pop    %ebp
+  800aab:	c3                   	ret
+
+00800aac <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800aac:	55                   	push   %ebp
+  800aad:	89 e5                	mov    %esp,%ebp
+  800aaf:	57                   	push   %edi
+  800ab0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ab3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800ab6:	85 c9                	test   %ecx,%ecx
+  800ab8:	74 20                	je     800ada <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800aba:	89 f8                	mov    %edi,%eax
+  800abc:	09 c8                	or     %ecx,%eax
+  800abe:	a8 03                	test   $0x3,%al
+  800ac0:	75 12                	jne    800ad4 <memset+0x28>
+		c &= 0xFF;
+  800ac2:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800ac6:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800acc:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800acf:	fc                   	cld
+  800ad0:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ad2:	eb 06                	jmp    800ada <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800ad4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ad7:	fc                   	cld
+  800ad8:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800ada:	89 f8                	mov    %edi,%eax
+  800adc:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800adf:	c9                   	leave
+  800ae0:	c3                   	ret
+
+00800ae1 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800ae1:	55                   	push   %ebp
+  800ae2:	89 e5                	mov    %esp,%ebp
+  800ae4:	57                   	push   %edi
+  800ae5:	56                   	push   %esi
+  800ae6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ae9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800aec:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800aef:	39 c6                	cmp    %eax,%esi
+  800af1:	73 32                	jae    800b25 <memmove+0x44>
+  800af3:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800af6:	39 d0                	cmp    %edx,%eax
+  800af8:	73 2b                	jae    800b25 <memmove+0x44>
+		s += n;
+		d += n;
+  800afa:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800afd:	89 d6                	mov    %edx,%esi
+  800aff:	09 fe                	or     %edi,%esi
+  800b01:	09 ce                	or     %ecx,%esi
+  800b03:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b09:	75 0e                	jne    800b19 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b0b:	83 ef 04             	sub    $0x4,%edi
+  800b0e:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b11:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b14:	fd                   	std
+  800b15:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b17:	eb 09                	jmp    800b22 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b19:	83 ef 01             	sub    $0x1,%edi
+  800b1c:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b1f:	fd                   	std
+  800b20:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b22:	fc                   	cld
+  800b23:	eb 1a                	jmp    800b3f <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b25:	89 f2                	mov    %esi,%edx
+  800b27:	09 c2                	or     %eax,%edx
+  800b29:	09 ca                	or     %ecx,%edx
+  800b2b:	f6 c2 03             	test   $0x3,%dl
+  800b2e:	75 0a                	jne    800b3a <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b30:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b33:	89 c7                	mov    %eax,%edi
+  800b35:	fc                   	cld
+  800b36:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b38:	eb 05                	jmp    800b3f <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b3a:	89 c7                	mov    %eax,%edi
+  800b3c:	fc                   	cld
+  800b3d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b3f:	5e                   	pop    %esi
+  800b40:	5f                   	pop    %edi
+  800b41:	5d                   	pop    %ebp
+  800b42:	c3                   	ret
+
+00800b43 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b43:	55                   	push   %ebp
+  800b44:	89 e5                	mov    %esp,%ebp
+  800b46:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b49:	ff 75 10             	push   0x10(%ebp)
+  800b4c:	ff 75 0c             	push   0xc(%ebp)
+  800b4f:	ff 75 08             	push   0x8(%ebp)
+  800b52:	e8 8a ff ff ff       	call   800ae1 <memmove>
+}
+  800b57:	c9                   	leave
+  800b58:	c3                   	ret
+
+00800b59 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b59:	55                   	push   %ebp
+  800b5a:	89 e5                	mov    %esp,%ebp
+  800b5c:	56                   	push   %esi
+  800b5d:	53                   	push   %ebx
+  800b5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b61:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b64:	89 c6                	mov    %eax,%esi
+  800b66:	03 75 10             	add    0x10(%ebp),%esi
+  800b69:	eb 06                	jmp    800b71 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b6b:	83 c0 01             	add    $0x1,%eax
+  800b6e:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b71:	39 f0                	cmp    %esi,%eax
+  800b73:	74 14                	je     800b89 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b75:	0f b6 08             	movzbl (%eax),%ecx
+  800b78:	0f b6 1a             	movzbl (%edx),%ebx
+  800b7b:	38 d9                	cmp    %bl,%cl
+  800b7d:	74 ec                	je     800b6b <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b7f:	0f b6 c1             	movzbl %cl,%eax
+  800b82:	0f b6 db             	movzbl %bl,%ebx
+  800b85:	29 d8                	sub    %ebx,%eax
+  800b87:	eb 05                	jmp    800b8e <memcmp+0x35>
+	}
+
+	return 0;
+  800b89:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b8e:	5b                   	pop    %ebx
+  800b8f:	5e                   	pop    %esi
+  800b90:	5d                   	pop    %ebp
+  800b91:	c3                   	ret
+
+00800b92 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b92:	55                   	push   %ebp
+  800b93:	89 e5                	mov    %esp,%ebp
+  800b95:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b98:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b9b:	89 c2                	mov    %eax,%edx
+  800b9d:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800ba0:	eb 03                	jmp    800ba5 <memfind+0x13>
+  800ba2:	83 c0 01             	add    $0x1,%eax
+  800ba5:	39 d0                	cmp    %edx,%eax
+  800ba7:	73 04                	jae    800bad <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800ba9:	38 08                	cmp    %cl,(%eax)
+  800bab:	75 f5                	jne    800ba2 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800bad:	5d                   	pop    %ebp
+  800bae:	c3                   	ret
+
+00800baf <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800baf:	55                   	push   %ebp
+  800bb0:	89 e5                	mov    %esp,%ebp
+  800bb2:	57                   	push   %edi
+  800bb3:	56                   	push   %esi
+  800bb4:	53                   	push   %ebx
+  800bb5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bb8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800bbb:	eb 03                	jmp    800bc0 <strtol+0x11>
+		s++;
+  800bbd:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800bc0:	0f b6 02             	movzbl (%edx),%eax
+  800bc3:	3c 20                	cmp    $0x20,%al
+  800bc5:	74 f6                	je     800bbd <strtol+0xe>
+  800bc7:	3c 09                	cmp    $0x9,%al
+  800bc9:	74 f2                	je     800bbd <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800bcb:	3c 2b                	cmp    $0x2b,%al
+  800bcd:	74 2a                	je     800bf9 <strtol+0x4a>
+	int neg = 0;
+  800bcf:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800bd4:	3c 2d                	cmp    $0x2d,%al
+  800bd6:	74 2b                	je     800c03 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bd8:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800bde:	75 0f                	jne    800bef <strtol+0x40>
+  800be0:	80 3a 30             	cmpb   $0x30,(%edx)
+  800be3:	74 28                	je     800c0d <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800be5:	85 db                	test   %ebx,%ebx
+  800be7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bec:	0f 44 d8             	cmove  %eax,%ebx
+  800bef:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bf4:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bf7:	eb 46                	jmp    800c3f <strtol+0x90>
+		s++;
+  800bf9:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800bfc:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c01:	eb d5                	jmp    800bd8 <strtol+0x29>
+		s++, neg = 1;
+  800c03:	83 c2 01             	add    $0x1,%edx
+  800c06:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c0b:	eb cb                	jmp    800bd8 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c0d:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c11:	74 0e                	je     800c21 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800c13:	85 db                	test   %ebx,%ebx
+  800c15:	75 d8                	jne    800bef <strtol+0x40>
+		s++, base = 8;
+  800c17:	83 c2 01             	add    $0x1,%edx
+  800c1a:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c1f:	eb ce                	jmp    800bef <strtol+0x40>
+		s += 2, base = 16;
+  800c21:	83 c2 02             	add    $0x2,%edx
+  800c24:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c29:	eb c4                	jmp    800bef <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c2b:	0f be c0             	movsbl %al,%eax
+  800c2e:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800c31:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c34:	7d 3a                	jge    800c70 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800c36:	83 c2 01             	add    $0x1,%edx
+  800c39:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c3d:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800c3f:	0f b6 02             	movzbl (%edx),%eax
+  800c42:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c45:	89 f3                	mov    %esi,%ebx
+  800c47:	80 fb 09             	cmp    $0x9,%bl
+  800c4a:	76 df                	jbe    800c2b <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800c4c:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c4f:	89 f3                	mov    %esi,%ebx
+  800c51:	80 fb 19             	cmp    $0x19,%bl
+  800c54:	77 08                	ja     800c5e <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800c56:	0f be c0             	movsbl %al,%eax
+  800c59:	83 e8 57             	sub    $0x57,%eax
+  800c5c:	eb d3                	jmp    800c31 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c5e:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c61:	89 f3                	mov    %esi,%ebx
+  800c63:	80 fb 19             	cmp    $0x19,%bl
+  800c66:	77 08                	ja     800c70 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800c68:	0f be c0             	movsbl %al,%eax
+  800c6b:	83 e8 37             	sub    $0x37,%eax
+  800c6e:	eb c1                	jmp    800c31 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c70:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c74:	74 05                	je     800c7b <strtol+0xcc>
+		*endptr = (char *) s;
+  800c76:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c79:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c7b:	89 c8                	mov    %ecx,%eax
+  800c7d:	f7 d8                	neg    %eax
+  800c7f:	85 ff                	test   %edi,%edi
+  800c81:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c84:	89 c8                	mov    %ecx,%eax
+  800c86:	5b                   	pop    %ebx
+  800c87:	5e                   	pop    %esi
+  800c88:	5f                   	pop    %edi
+  800c89:	5d                   	pop    %ebp
+  800c8a:	c3                   	ret
+
+00800c8b <atoi>:
+
+int
+atoi(const char *s)
+{
+  800c8b:	55                   	push   %ebp
+  800c8c:	89 e5                	mov    %esp,%ebp
+  800c8e:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800c91:	6a 0a                	push   $0xa
+  800c93:	6a 00                	push   $0x0
+  800c95:	ff 75 08             	push   0x8(%ebp)
+  800c98:	e8 12 ff ff ff       	call   800baf <strtol>
+}
+  800c9d:	c9                   	leave
+  800c9e:	c3                   	ret
+
+00800c9f <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800c9f:	55                   	push   %ebp
+  800ca0:	89 e5                	mov    %esp,%ebp
+  800ca2:	57                   	push   %edi
+  800ca3:	56                   	push   %esi
+  800ca4:	53                   	push   %ebx
+  800ca5:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800cab:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800cb1:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800cb7:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800cbd:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800cc4:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800cc7:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800cce:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800cd1:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800cd8:	74 76                	je     800d50 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800cda:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800ce0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ce3:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800ce9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800cf0:	0f 88 06 01 00 00    	js     800dfc <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800cf6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800cfd:	0f 84 48 01 00 00    	je     800e4b <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800d03:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800d09:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800d0f:	be 00 00 00 00       	mov    $0x0,%esi
+  800d14:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800d1a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800d1d:	55                   	push   %ebp
+  800d1e:	68 27 0d 80 00       	push   $0x800d27
+  800d23:	89 e5                	mov    %esp,%ebp
+  800d25:	0f 34                	sysenter
+  800d27:	83 c4 04             	add    $0x4,%esp
+  800d2a:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800d2b:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800d31:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800d37:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800d3a:	0f 85 9a 01 00 00    	jne    800eda <page_vec_call+0x23b>
+  800d40:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d45:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d48:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d4b:	e9 29 01 00 00       	jmp    800e79 <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800d50:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800d56:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d59:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800d5b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800d62:	78 2f                	js     800d93 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800d64:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800d6b:	74 72                	je     800ddf <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800d6d:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800d73:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800d79:	b8 10 00 00 00       	mov    $0x10,%eax
+  800d7e:	89 fb                	mov    %edi,%ebx
+  800d80:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800d83:	55                   	push   %ebp
+  800d84:	68 8d 0d 80 00       	push   $0x800d8d
+  800d89:	89 e5                	mov    %esp,%ebp
+  800d8b:	0f 34                	sysenter
+  800d8d:	83 c4 04             	add    $0x4,%esp
+  800d90:	5d                   	pop    %ebp
+	return ret;
+  800d91:	eb 98                	jmp    800d2b <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800d93:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d98:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800d9a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800d9f:	f6 c6 08             	test   $0x8,%dh
+  800da2:	74 15                	je     800db9 <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800da4:	89 c2                	mov    %eax,%edx
+  800da6:	c1 ea 08             	shr    $0x8,%edx
+  800da9:	83 e2 0f             	and    $0xf,%edx
+  800dac:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800db1:	83 fa 06             	cmp    $0x6,%edx
+  800db4:	74 0e                	je     800dc4 <page_vec_call+0x125>
+  800db6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800db9:	0f b6 c9             	movzbl %cl,%ecx
+  800dbc:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800dc2:	eb a0                	jmp    800d64 <page_vec_call+0xc5>
+  800dc4:	89 c2                	mov    %eax,%edx
+  800dc6:	c1 ea 04             	shr    $0x4,%edx
+  800dc9:	83 e2 0f             	and    $0xf,%edx
+  800dcc:	83 fa 02             	cmp    $0x2,%edx
+  800dcf:	77 e5                	ja     800db6 <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800dd1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800dd4:	83 f8 02             	cmp    $0x2,%eax
+  800dd7:	0f 97 c1             	seta   %cl
+  800dda:	0f b6 c9             	movzbl %cl,%ecx
+  800ddd:	eb d7                	jmp    800db6 <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800ddf:	b8 10 00 00 00       	mov    $0x10,%eax
+  800de4:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800dea:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800df0:	89 fb                	mov    %edi,%ebx
+  800df2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800df5:	cd 30                	int    $0x30
+  800df7:	e9 2f ff ff ff       	jmp    800d2b <page_vec_call+0x8c>
+  800dfc:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e01:	0f a2                	cpuid
+		return 0;
+  800e03:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800e08:	f6 c6 08             	test   $0x8,%dh
+  800e0b:	74 15                	je     800e22 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e0d:	89 c2                	mov    %eax,%edx
+  800e0f:	c1 ea 08             	shr    $0x8,%edx
+  800e12:	83 e2 0f             	and    $0xf,%edx
+  800e15:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e1a:	83 fa 06             	cmp    $0x6,%edx
+  800e1d:	74 11                	je     800e30 <page_vec_call+0x191>
+  800e1f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e22:	0f b6 c9             	movzbl %cl,%ecx
+  800e25:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800e2b:	e9 c6 fe ff ff       	jmp    800cf6 <page_vec_call+0x57>
+  800e30:	89 c2                	mov    %eax,%edx
+  800e32:	c1 ea 04             	shr    $0x4,%edx
+  800e35:	83 e2 0f             	and    $0xf,%edx
+  800e38:	83 fa 02             	cmp    $0x2,%edx
+  800e3b:	77 e2                	ja     800e1f <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800e3d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e40:	83 f8 02             	cmp    $0x2,%eax
+  800e43:	0f 97 c1             	seta   %cl
+  800e46:	0f b6 c9             	movzbl %cl,%ecx
+  800e49:	eb d4                	jmp    800e1f <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800e4b:	be 00 00 00 00       	mov    $0x0,%esi
+  800e50:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800e56:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800e5c:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800e62:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800e65:	cd 30                	int    $0x30
+  800e67:	e9 bf fe ff ff       	jmp    800d2b <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800e6c:	29 da                	sub    %ebx,%edx
+			vec++;
+  800e6e:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800e71:	83 e8 01             	sub    $0x1,%eax
+  800e74:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800e79:	85 c0                	test   %eax,%eax
+  800e7b:	74 58                	je     800ed5 <page_vec_call+0x236>
+  800e7d:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800e80:	39 da                	cmp    %ebx,%edx
+  800e82:	73 e8                	jae    800e6c <page_vec_call+0x1cd>
+  800e84:	89 75 08             	mov    %esi,0x8(%ebp)
+  800e87:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800e8a:	84 c9                	test   %cl,%cl
+  800e8c:	74 06                	je     800e94 <page_vec_call+0x1f5>
+  800e8e:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800e94:	83 ec 04             	sub    $0x4,%esp
+  800e97:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e9a:	c1 e0 04             	shl    $0x4,%eax
+  800e9d:	50                   	push   %eax
+  800e9e:	ff 75 08             	push   0x8(%ebp)
+  800ea1:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800ea7:	53                   	push   %ebx
+  800ea8:	e8 34 fc ff ff       	call   800ae1 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800ead:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800eb3:	89 c2                	mov    %eax,%edx
+  800eb5:	c1 e2 0c             	shl    $0xc,%edx
+  800eb8:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  800ebe:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  800ec4:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  800eca:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  800ecd:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  800ed0:	e9 f2 fd ff ff       	jmp    800cc7 <page_vec_call+0x28>
+			r = 0;
+  800ed5:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  800eda:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800ede:	74 0b                	je     800eeb <page_vec_call+0x24c>
+		*done = total;
+  800ee0:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800ee3:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  800ee9:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  800eeb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eee:	5b                   	pop    %ebx
+  800eef:	5e                   	pop    %esi
+  800ef0:	5f                   	pop    %edi
+  800ef1:	5d                   	pop    %ebp
+  800ef2:	c3                   	ret
+
+00800ef3 <sys_cputs>:
+{
+  800ef3:	55                   	push   %ebp
+  800ef4:	89 e5                	mov    %esp,%ebp
+  800ef6:	57                   	push   %edi
+  800ef7:	56                   	push   %esi
+  800ef8:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800ef9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800f00:	78 2d                	js     800f2f <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800f02:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800f09:	74 70                	je     800f7b <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800f0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f10:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f13:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f16:	89 c3                	mov    %eax,%ebx
+  800f18:	89 c7                	mov    %eax,%edi
+  800f1a:	89 c6                	mov    %eax,%esi
+  800f1c:	55                   	push   %ebp
+  800f1d:	68 26 0f 80 00       	push   $0x800f26
+  800f22:	89 e5                	mov    %esp,%ebp
+  800f24:	0f 34                	sysenter
+  800f26:	83 c4 04             	add    $0x4,%esp
+  800f29:	5d                   	pop    %ebp
+}
+  800f2a:	5b                   	pop    %ebx
+  800f2b:	5e                   	pop    %esi
+  800f2c:	5f                   	pop    %edi
+  800f2d:	5d                   	pop    %ebp
+  800f2e:	c3                   	ret
+  800f2f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f34:	0f a2                	cpuid
+		return 0;
+  800f36:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f3b:	f6 c6 08             	test   $0x8,%dh
+  800f3e:	74 15                	je     800f55 <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f40:	89 c2                	mov    %eax,%edx
+  800f42:	c1 ea 08             	shr    $0x8,%edx
+  800f45:	83 e2 0f             	and    $0xf,%edx
+  800f48:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f4d:	83 fa 06             	cmp    $0x6,%edx
+  800f50:	74 0e                	je     800f60 <sys_cputs+0x6d>
+  800f52:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f55:	0f b6 c9             	movzbl %cl,%ecx
+  800f58:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800f5e:	eb a2                	jmp    800f02 <sys_cputs+0xf>
+  800f60:	89 c2                	mov    %eax,%edx
+  800f62:	c1 ea 04             	shr    $0x4,%edx
+  800f65:	83 e2 0f             	and    $0xf,%edx
+  800f68:	83 fa 02             	cmp    $0x2,%edx
+  800f6b:	77 e5                	ja     800f52 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800f6d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f70:	83 f8 02             	cmp    $0x2,%eax
+  800f73:	0f 97 c1             	seta   %cl
+  800f76:	0f b6 c9             	movzbl %cl,%ecx
+  800f79:	eb d7                	jmp    800f52 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800f7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f80:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f83:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f86:	89 c3                	mov    %eax,%ebx
+  800f88:	89 c7                	mov    %eax,%edi
+  800f8a:	89 c6                	mov    %eax,%esi
+  800f8c:	cd 30                	int    $0x30
+}
+  800f8e:	eb 9a                	jmp    800f2a <sys_cputs+0x37>
+
+00800f90 <sys_cgetc>:
+{
+  800f90:	55                   	push   %ebp
+  800f91:	89 e5                	mov    %esp,%ebp
+  800f93:	57                   	push   %edi
+  800f94:	56                   	push   %esi
+  800f95:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800f96:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800f9d:	78 2e                	js     800fcd <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  800f9f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800fa6:	74 71                	je     801019 <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  800fa8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fad:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fb2:	89 d1                	mov    %edx,%ecx
+  800fb4:	89 d3                	mov    %edx,%ebx
+  800fb6:	89 d7                	mov    %edx,%edi
+  800fb8:	89 d6                	mov    %edx,%esi
+  800fba:	55                   	push   %ebp
+  800fbb:	68 c4 0f 80 00       	push   $0x800fc4
+  800fc0:	89 e5                	mov    %esp,%ebp
+  800fc2:	0f 34                	sysenter
+  800fc4:	83 c4 04             	add    $0x4,%esp
+  800fc7:	5d                   	pop    %ebp
+}
+  800fc8:	5b                   	pop    %ebx
+  800fc9:	5e                   	pop    %esi
+  800fca:	5f                   	pop    %edi
+  800fcb:	5d                   	pop    %ebp
+  800fcc:	c3                   	ret
+  800fcd:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fd2:	0f a2                	cpuid
+		return 0;
+  800fd4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800fd9:	f6 c6 08             	test   $0x8,%dh
+  800fdc:	74 15                	je     800ff3 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800fde:	89 c2                	mov    %eax,%edx
+  800fe0:	c1 ea 08             	shr    $0x8,%edx
+  800fe3:	83 e2 0f             	and    $0xf,%edx
+  800fe6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800feb:	83 fa 06             	cmp    $0x6,%edx
+  800fee:	74 0e                	je     800ffe <sys_cgetc+0x6e>
+  800ff0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800ff3:	0f b6 c9             	movzbl %cl,%ecx
+  800ff6:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800ffc:	eb a1                	jmp    800f9f <sys_cgetc+0xf>
+  800ffe:	89 c2                	mov    %eax,%edx
+  801000:	c1 ea 04             	shr    $0x4,%edx
+  801003:	83 e2 0f             	and    $0xf,%edx
+  801006:	83 fa 02             	cmp    $0x2,%edx
+  801009:	77 e5                	ja     800ff0 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  80100b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80100e:	83 f8 02             	cmp    $0x2,%eax
+  801011:	0f 97 c1             	seta   %cl
+  801014:	0f b6 c9             	movzbl %cl,%ecx
+  801017:	eb d7                	jmp    800ff0 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  801019:	ba 00 00 00 00       	mov    $0x0,%edx
+  80101e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801023:	89 d1                	mov    %edx,%ecx
+  801025:	89 d3                	mov    %edx,%ebx
+  801027:	89 d7                	mov    %edx,%edi
+  801029:	89 d6                	mov    %edx,%esi
+  80102b:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  80102d:	eb 99                	jmp    800fc8 <sys_cgetc+0x38>
+
+0080102f <sys_env_destroy>:
+{
+  80102f:	55                   	push   %ebp
+  801030:	89 e5                	mov    %esp,%ebp
+  801032:	57                   	push   %edi
+  801033:	56                   	push   %esi
+  801034:	53                   	push   %ebx
+  801035:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801038:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80103f:	78 36                	js     801077 <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  801041:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801048:	74 79                	je     8010c3 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  80104a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801052:	b8 03 00 00 00       	mov    $0x3,%eax
+  801057:	89 cb                	mov    %ecx,%ebx
+  801059:	89 cf                	mov    %ecx,%edi
+  80105b:	89 ce                	mov    %ecx,%esi
+  80105d:	55                   	push   %ebp
+  80105e:	68 67 10 80 00       	push   $0x801067
+  801063:	89 e5                	mov    %esp,%ebp
+  801065:	0f 34                	sysenter
+  801067:	83 c4 04             	add    $0x4,%esp
+  80106a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80106b:	85 c0                	test   %eax,%eax
+  80106d:	7f 6b                	jg     8010da <sys_env_destroy+0xab>
+}
+  80106f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801072:	5b                   	pop    %ebx
+  801073:	5e                   	pop    %esi
+  801074:	5f                   	pop    %edi
+  801075:	5d                   	pop    %ebp
+  801076:	c3                   	ret
+  801077:	b8 01 00 00 00       	mov    $0x1,%eax
+  80107c:	0f a2                	cpuid
+		return 0;
+  80107e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801083:	f6 c6 08             	test   $0x8,%dh
+  801086:	74 15                	je     80109d <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801088:	89 c2                	mov    %eax,%edx
+  80108a:	c1 ea 08             	shr    $0x8,%edx
+  80108d:	83 e2 0f             	and    $0xf,%edx
+  801090:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801095:	83 fa 06             	cmp    $0x6,%edx
+  801098:	74 0e                	je     8010a8 <sys_env_destroy+0x79>
+  80109a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80109d:	0f b6 c9             	movzbl %cl,%ecx
+  8010a0:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8010a6:	eb 99                	jmp    801041 <sys_env_destroy+0x12>
+  8010a8:	89 c2                	mov    %eax,%edx
+  8010aa:	c1 ea 04             	shr    $0x4,%edx
+  8010ad:	83 e2 0f             	and    $0xf,%edx
+  8010b0:	83 fa 02             	cmp    $0x2,%edx
+  8010b3:	77 e5                	ja     80109a <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  8010b5:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010b8:	83 f8 02             	cmp    $0x2,%eax
+  8010bb:	0f 97 c1             	seta   %cl
+  8010be:	0f b6 c9             	movzbl %cl,%ecx
+  8010c1:	eb d7                	jmp    80109a <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  8010c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010c8:	b8 03 00 00 00       	mov    $0x3,%eax
+  8010cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d0:	89 cb                	mov    %ecx,%ebx
+  8010d2:	89 cf                	mov    %ecx,%edi
+  8010d4:	89 ce                	mov    %ecx,%esi
+  8010d6:	cd 30                	int    $0x30
+  8010d8:	eb 91                	jmp    80106b <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010da:	83 ec 0c             	sub    $0xc,%esp
+  8010dd:	50                   	push   %eax
+  8010de:	6a 03                	push   $0x3
+  8010e0:	68 39 36 80 00       	push   $0x803639
+  8010e5:	6a 4a                	push   $0x4a
+  8010e7:	68 56 36 80 00       	push   $0x803656
+  8010ec:	e8 68 f1 ff ff       	call   800259 <_panic>
+
+008010f1 <sys_getenvid>:
+{
+  8010f1:	55                   	push   %ebp
+  8010f2:	89 e5                	mov    %esp,%ebp
+  8010f4:	57                   	push   %edi
+  8010f5:	56                   	push   %esi
+  8010f6:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8010f7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8010fe:	78 2e                	js     80112e <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  801100:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801107:	74 71                	je     80117a <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  801109:	ba 00 00 00 00       	mov    $0x0,%edx
+  80110e:	b8 02 00 00 00       	mov    $0x2,%eax
+  801113:	89 d1                	mov    %edx,%ecx
+  801115:	89 d3                	mov    %edx,%ebx
+  801117:	89 d7                	mov    %edx,%edi
+  801119:	89 d6                	mov    %edx,%esi
+  80111b:	55                   	push   %ebp
+  80111c:	68 25 11 80 00       	push   $0x801125
+  801121:	89 e5                	mov    %esp,%ebp
+  801123:	0f 34                	sysenter
+  801125:	83 c4 04             	add    $0x4,%esp
+  801128:	5d                   	pop    %ebp
+}
+  801129:	5b                   	pop    %ebx
+  80112a:	5e                   	pop    %esi
+  80112b:	5f                   	pop    %edi
+  80112c:	5d                   	pop    %ebp
+  80112d:	c3                   	ret
+  80112e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801133:	0f a2                	cpuid
+		return 0;
+  801135:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80113a:	f6 c6 08             	test   $0x8,%dh
+  80113d:	74 15                	je     801154 <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80113f:	89 c2                	mov    %eax,%edx
+  801141:	c1 ea 08             	shr    $0x8,%edx
+  801144:	83 e2 0f             	and    $0xf,%edx
+  801147:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80114c:	83 fa 06             	cmp    $0x6,%edx
+  80114f:	74 0e                	je     80115f <sys_getenvid+0x6e>
+  801151:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801154:	0f b6 c9             	movzbl %cl,%ecx
+  801157:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80115d:	eb a1                	jmp    801100 <sys_getenvid+0xf>
+  80115f:	89 c2                	mov    %eax,%edx
+  801161:	c1 ea 04             	shr    $0x4,%edx
+  801164:	83 e2 0f             	and    $0xf,%edx
+  801167:	83 fa 02             	cmp    $0x2,%edx
+  80116a:	77 e5                	ja     801151 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  80116c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80116f:	83 f8 02             	cmp    $0x2,%eax
+  801172:	0f 97 c1             	seta   %cl
+  801175:	0f b6 c9             	movzbl %cl,%ecx
+  801178:	eb d7                	jmp    801151 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  80117a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80117f:	b8 02 00 00 00       	mov    $0x2,%eax
+  801184:	89 d1                	mov    %edx,%ecx
+  801186:	89 d3                	mov    %edx,%ebx
+  801188:	89 d7                	mov    %edx,%edi
+  80118a:	89 d6                	mov    %edx,%esi
+  80118c:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80118e:	eb 99                	jmp    801129 <sys_getenvid+0x38>
+
+00801190 <sys_page_alloc>:
+{
+  801190:	55                   	push   %ebp
+  801191:	89 e5                	mov    %esp,%ebp
+  801193:	57                   	push   %edi
+  801194:	56                   	push   %esi
+  801195:	53                   	push   %ebx
+  801196:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801199:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8011a0:	78 38                	js     8011da <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  8011a2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8011a9:	74 7b                	je     801226 <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  8011ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8011b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b6:	b8 04 00 00 00       	mov    $0x4,%eax
+  8011bb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011be:	89 f7                	mov    %esi,%edi
+  8011c0:	55                   	push   %ebp
+  8011c1:	68 ca 11 80 00       	push   $0x8011ca
+  8011c6:	89 e5                	mov    %esp,%ebp
+  8011c8:	0f 34                	sysenter
+  8011ca:	83 c4 04             	add    $0x4,%esp
+  8011cd:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8011ce:	85 c0                	test   %eax,%eax
+  8011d0:	7f 6d                	jg     80123f <sys_page_alloc+0xaf>
+}
+  8011d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011d5:	5b                   	pop    %ebx
+  8011d6:	5e                   	pop    %esi
+  8011d7:	5f                   	pop    %edi
+  8011d8:	5d                   	pop    %ebp
+  8011d9:	c3                   	ret
+  8011da:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011df:	0f a2                	cpuid
+		return 0;
+  8011e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8011e6:	f6 c6 08             	test   $0x8,%dh
+  8011e9:	74 15                	je     801200 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011eb:	89 c2                	mov    %eax,%edx
+  8011ed:	c1 ea 08             	shr    $0x8,%edx
+  8011f0:	83 e2 0f             	and    $0xf,%edx
+  8011f3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011f8:	83 fa 06             	cmp    $0x6,%edx
+  8011fb:	74 0e                	je     80120b <sys_page_alloc+0x7b>
+  8011fd:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801200:	0f b6 c9             	movzbl %cl,%ecx
+  801203:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801209:	eb 97                	jmp    8011a2 <sys_page_alloc+0x12>
+  80120b:	89 c2                	mov    %eax,%edx
+  80120d:	c1 ea 04             	shr    $0x4,%edx
+  801210:	83 e2 0f             	and    $0xf,%edx
+  801213:	83 fa 02             	cmp    $0x2,%edx
+  801216:	77 e5                	ja     8011fd <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  801218:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80121b:	83 f8 02             	cmp    $0x2,%eax
+  80121e:	0f 97 c1             	seta   %cl
+  801221:	0f b6 c9             	movzbl %cl,%ecx
+  801224:	eb d7                	jmp    8011fd <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  801226:	be 00 00 00 00       	mov    $0x0,%esi
+  80122b:	b8 04 00 00 00       	mov    $0x4,%eax
+  801230:	8b 55 08             	mov    0x8(%ebp),%edx
+  801233:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801236:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801239:	89 f7                	mov    %esi,%edi
+  80123b:	cd 30                	int    $0x30
+  80123d:	eb 8f                	jmp    8011ce <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80123f:	83 ec 0c             	sub    $0xc,%esp
+  801242:	50                   	push   %eax
+  801243:	6a 04                	push   $0x4
+  801245:	68 39 36 80 00       	push   $0x803639
+  80124a:	6a 4a                	push   $0x4a
+  80124c:	68 56 36 80 00       	push   $0x803656
+  801251:	e8 03 f0 ff ff       	call   800259 <_panic>
+
+00801256 <sys_page_map>:
+{
+  801256:	55                   	push   %ebp
+  801257:	89 e5                	mov    %esp,%ebp
+  801259:	57                   	push   %edi
+  80125a:	56                   	push   %esi
+  80125b:	53                   	push   %ebx
+  80125c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80125f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801266:	78 37                	js     80129f <sys_page_map+0x49>
+	if (syscall_sysenter)
+  801268:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80126f:	74 7a                	je     8012eb <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  801271:	8b 55 08             	mov    0x8(%ebp),%edx
+  801274:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801277:	b8 05 00 00 00       	mov    $0x5,%eax
+  80127c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80127f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801282:	8b 75 18             	mov    0x18(%ebp),%esi
+  801285:	55                   	push   %ebp
+  801286:	68 8f 12 80 00       	push   $0x80128f
+  80128b:	89 e5                	mov    %esp,%ebp
+  80128d:	0f 34                	sysenter
+  80128f:	83 c4 04             	add    $0x4,%esp
+  801292:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801293:	85 c0                	test   %eax,%eax
+  801295:	7f 6c                	jg     801303 <sys_page_map+0xad>
+}
+  801297:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80129a:	5b                   	pop    %ebx
+  80129b:	5e                   	pop    %esi
+  80129c:	5f                   	pop    %edi
+  80129d:	5d                   	pop    %ebp
+  80129e:	c3                   	ret
+  80129f:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012a4:	0f a2                	cpuid
+		return 0;
+  8012a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8012ab:	f6 c6 08             	test   $0x8,%dh
+  8012ae:	74 15                	je     8012c5 <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012b0:	89 c2                	mov    %eax,%edx
+  8012b2:	c1 ea 08             	shr    $0x8,%edx
+  8012b5:	83 e2 0f             	and    $0xf,%edx
+  8012b8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012bd:	83 fa 06             	cmp    $0x6,%edx
+  8012c0:	74 0e                	je     8012d0 <sys_page_map+0x7a>
+  8012c2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8012c5:	0f b6 c9             	movzbl %cl,%ecx
+  8012c8:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8012ce:	eb 98                	jmp    801268 <sys_page_map+0x12>
+  8012d0:	89 c2                	mov    %eax,%edx
+  8012d2:	c1 ea 04             	shr    $0x4,%edx
+  8012d5:	83 e2 0f             	and    $0xf,%edx
+  8012d8:	83 fa 02             	cmp    $0x2,%edx
+  8012db:	77 e5                	ja     8012c2 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  8012dd:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012e0:	83 f8 02             	cmp    $0x2,%eax
+  8012e3:	0f 97 c1             	seta   %cl
+  8012e6:	0f b6 c9             	movzbl %cl,%ecx
+  8012e9:	eb d7                	jmp    8012c2 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  8012eb:	b8 05 00 00 00       	mov    $0x5,%eax
+  8012f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012f9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012fc:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012ff:	cd 30                	int    $0x30
+  801301:	eb 90                	jmp    801293 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801303:	83 ec 0c             	sub    $0xc,%esp
+  801306:	50                   	push   %eax
+  801307:	6a 05                	push   $0x5
+  801309:	68 39 36 80 00       	push   $0x803639
+  80130e:	6a 4a                	push   $0x4a
+  801310:	68 56 36 80 00       	push   $0x803656
+  801315:	e8 3f ef ff ff       	call   800259 <_panic>
+
+0080131a <sys_page_unmap>:
+{
+  80131a:	55                   	push   %ebp
+  80131b:	89 e5                	mov    %esp,%ebp
+  80131d:	57                   	push   %edi
+  80131e:	56                   	push   %esi
+  80131f:	53                   	push   %ebx
+  801320:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801323:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80132a:	78 37                	js     801363 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  80132c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801333:	74 7a                	je     8013af <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  801335:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801340:	b8 06 00 00 00       	mov    $0x6,%eax
+  801345:	89 df                	mov    %ebx,%edi
+  801347:	89 de                	mov    %ebx,%esi
+  801349:	55                   	push   %ebp
+  80134a:	68 53 13 80 00       	push   $0x801353
+  80134f:	89 e5                	mov    %esp,%ebp
+  801351:	0f 34                	sysenter
+  801353:	83 c4 04             	add    $0x4,%esp
+  801356:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801357:	85 c0                	test   %eax,%eax
+  801359:	7f 6c                	jg     8013c7 <sys_page_unmap+0xad>
+}
+  80135b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80135e:	5b                   	pop    %ebx
+  80135f:	5e                   	pop    %esi
+  801360:	5f                   	pop    %edi
+  801361:	5d                   	pop    %ebp
+  801362:	c3                   	ret
+  801363:	b8 01 00 00 00       	mov    $0x1,%eax
+  801368:	0f a2                	cpuid
+		return 0;
+  80136a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80136f:	f6 c6 08             	test   $0x8,%dh
+  801372:	74 15                	je     801389 <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801374:	89 c2                	mov    %eax,%edx
+  801376:	c1 ea 08             	shr    $0x8,%edx
+  801379:	83 e2 0f             	and    $0xf,%edx
+  80137c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801381:	83 fa 06             	cmp    $0x6,%edx
+  801384:	74 0e                	je     801394 <sys_page_unmap+0x7a>
+  801386:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801389:	0f b6 c9             	movzbl %cl,%ecx
+  80138c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801392:	eb 98                	jmp    80132c <sys_page_unmap+0x12>
+  801394:	89 c2                	mov    %eax,%edx
+  801396:	c1 ea 04             	shr    $0x4,%edx
+  801399:	83 e2 0f             	and    $0xf,%edx
+  80139c:	83 fa 02             	cmp    $0x2,%edx
+  80139f:	77 e5                	ja     801386 <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  8013a1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013a4:	83 f8 02             	cmp    $0x2,%eax
+  8013a7:	0f 97 c1             	seta   %cl
+  8013aa:	0f b6 c9             	movzbl %cl,%ecx
+  8013ad:	eb d7                	jmp    801386 <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  8013af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b4:	b8 06 00 00 00       	mov    $0x6,%eax
+  8013b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013bf:	89 df                	mov    %ebx,%edi
+  8013c1:	89 de                	mov    %ebx,%esi
+  8013c3:	cd 30                	int    $0x30
+  8013c5:	eb 90                	jmp    801357 <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013c7:	83 ec 0c             	sub    $0xc,%esp
+  8013ca:	50                   	push   %eax
+  8013cb:	6a 06                	push   $0x6
+  8013cd:	68 39 36 80 00       	push   $0x803639
+  8013d2:	6a 4a                	push   $0x4a
+  8013d4:	68 56 36 80 00       	push   $0x803656
+  8013d9:	e8 7b ee ff ff       	call   800259 <_panic>
+
+008013de <sys_page_copy>:
+{
+  8013de:	55                   	push   %ebp
+  8013df:	89 e5                	mov    %esp,%ebp
+  8013e1:	57                   	push   %edi
+  8013e2:	56                   	push   %esi
+  8013e3:	53                   	push   %ebx
+  8013e4:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8013e7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8013ee:	78 37                	js     801427 <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  8013f0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8013f7:	74 7a                	je     801473 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  8013f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013ff:	b8 29 00 00 00       	mov    $0x29,%eax
+  801404:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801407:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80140a:	8b 75 18             	mov    0x18(%ebp),%esi
+  80140d:	55                   	push   %ebp
+  80140e:	68 17 14 80 00       	push   $0x801417
+  801413:	89 e5                	mov    %esp,%ebp
+  801415:	0f 34                	sysenter
+  801417:	83 c4 04             	add    $0x4,%esp
+  80141a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80141b:	85 c0                	test   %eax,%eax
+  80141d:	7f 6c                	jg     80148b <sys_page_copy+0xad>
+}
+  80141f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801422:	5b                   	pop    %ebx
+  801423:	5e                   	pop    %esi
+  801424:	5f                   	pop    %edi
+  801425:	5d                   	pop    %ebp
+  801426:	c3                   	ret
+  801427:	b8 01 00 00 00       	mov    $0x1,%eax
+  80142c:	0f a2                	cpuid
+		return 0;
+  80142e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801433:	f6 c6 08             	test   $0x8,%dh
+  801436:	74 15                	je     80144d <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801438:	89 c2                	mov    %eax,%edx
+  80143a:	c1 ea 08             	shr    $0x8,%edx
+  80143d:	83 e2 0f             	and    $0xf,%edx
+  801440:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801445:	83 fa 06             	cmp    $0x6,%edx
+  801448:	74 0e                	je     801458 <sys_page_copy+0x7a>
+  80144a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80144d:	0f b6 c9             	movzbl %cl,%ecx
+  801450:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801456:	eb 98                	jmp    8013f0 <sys_page_copy+0x12>
+  801458:	89 c2                	mov    %eax,%edx
+  80145a:	c1 ea 04             	shr    $0x4,%edx
+  80145d:	83 e2 0f             	and    $0xf,%edx
+  801460:	83 fa 02             	cmp    $0x2,%edx
+  801463:	77 e5                	ja     80144a <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  801465:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801468:	83 f8 02             	cmp    $0x2,%eax
+  80146b:	0f 97 c1             	seta   %cl
+  80146e:	0f b6 c9             	movzbl %cl,%ecx
+  801471:	eb d7                	jmp    80144a <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  801473:	b8 29 00 00 00       	mov    $0x29,%eax
+  801478:	8b 55 08             	mov    0x8(%ebp),%edx
+  80147b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80147e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801481:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801484:	8b 75 18             	mov    0x18(%ebp),%esi
+  801487:	cd 30                	int    $0x30
+  801489:	eb 90                	jmp    80141b <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80148b:	83 ec 0c             	sub    $0xc,%esp
+  80148e:	50                   	push   %eax
+  80148f:	6a 29                	push   $0x29
+  801491:	68 39 36 80 00       	push   $0x803639
+  801496:	6a 4a                	push   $0x4a
+  801498:	68 56 36 80 00       	push   $0x803656
+  80149d:	e8 b7 ed ff ff       	call   800259 <_panic>
+
+008014a2 <sys_yield>:
+{
+  8014a2:	55                   	push   %ebp
+  8014a3:	89 e5                	mov    %esp,%ebp
+  8014a5:	57                   	push   %edi
+  8014a6:	56                   	push   %esi
+  8014a7:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8014a8:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8014af:	78 2e                	js     8014df <sys_yield+0x3d>
+	if (syscall_sysenter)
+  8014b1:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8014b8:	74 71                	je     80152b <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  8014ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014bf:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8014c4:	89 d1                	mov    %edx,%ecx
+  8014c6:	89 d3                	mov    %edx,%ebx
+  8014c8:	89 d7                	mov    %edx,%edi
+  8014ca:	89 d6                	mov    %edx,%esi
+  8014cc:	55                   	push   %ebp
+  8014cd:	68 d6 14 80 00       	push   $0x8014d6
+  8014d2:	89 e5                	mov    %esp,%ebp
+  8014d4:	0f 34                	sysenter
+  8014d6:	83 c4 04             	add    $0x4,%esp
+  8014d9:	5d                   	pop    %ebp
+}
+  8014da:	5b                   	pop    %ebx
+  8014db:	5e                   	pop    %esi
+  8014dc:	5f                   	pop    %edi
+  8014dd:	5d                   	pop    %ebp
+  8014de:	c3                   	ret
+  8014df:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014e4:	0f a2                	cpuid
+		return 0;
+  8014e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8014eb:	f6 c6 08             	test   $0x8,%dh
+  8014ee:	74 15                	je     801505 <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014f0:	89 c2                	mov    %eax,%edx
+  8014f2:	c1 ea 08             	shr    $0x8,%edx
+  8014f5:	83 e2 0f             	and    $0xf,%edx
+  8014f8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8014fd:	83 fa 06             	cmp    $0x6,%edx
+  801500:	74 0e                	je     801510 <sys_yield+0x6e>
+  801502:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801505:	0f b6 c9             	movzbl %cl,%ecx
+  801508:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80150e:	eb a1                	jmp    8014b1 <sys_yield+0xf>
+  801510:	89 c2                	mov    %eax,%edx
+  801512:	c1 ea 04             	shr    $0x4,%edx
+  801515:	83 e2 0f             	and    $0xf,%edx
+  801518:	83 fa 02             	cmp    $0x2,%edx
+  80151b:	77 e5                	ja     801502 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  80151d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801520:	83 f8 02             	cmp    $0x2,%eax
+  801523:	0f 97 c1             	seta   %cl
+  801526:	0f b6 c9             	movzbl %cl,%ecx
+  801529:	eb d7                	jmp    801502 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  80152b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801530:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801535:	89 d1                	mov    %edx,%ecx
+  801537:	89 d3                	mov    %edx,%ebx
+  801539:	89 d7                	mov    %edx,%edi
+  80153b:	89 d6                	mov    %edx,%esi
+  80153d:	cd 30                	int    $0x30
+}
+  80153f:	eb 99                	jmp    8014da <sys_yield+0x38>
+
+00801541 <sys_env_set_status>:
+{
+  801541:	55                   	push   %ebp
+  801542:	89 e5                	mov    %esp,%ebp
+  801544:	57                   	push   %edi
+  801545:	56                   	push   %esi
+  801546:	53                   	push   %ebx
+  801547:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80154a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801551:	78 37                	js     80158a <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  801553:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80155a:	74 7a                	je     8015d6 <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  80155c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801561:	8b 55 08             	mov    0x8(%ebp),%edx
+  801564:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801567:	b8 08 00 00 00       	mov    $0x8,%eax
+  80156c:	89 df                	mov    %ebx,%edi
+  80156e:	89 de                	mov    %ebx,%esi
+  801570:	55                   	push   %ebp
+  801571:	68 7a 15 80 00       	push   $0x80157a
+  801576:	89 e5                	mov    %esp,%ebp
+  801578:	0f 34                	sysenter
+  80157a:	83 c4 04             	add    $0x4,%esp
+  80157d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80157e:	85 c0                	test   %eax,%eax
+  801580:	7f 6c                	jg     8015ee <sys_env_set_status+0xad>
+}
+  801582:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801585:	5b                   	pop    %ebx
+  801586:	5e                   	pop    %esi
+  801587:	5f                   	pop    %edi
+  801588:	5d                   	pop    %ebp
+  801589:	c3                   	ret
+  80158a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80158f:	0f a2                	cpuid
+		return 0;
+  801591:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801596:	f6 c6 08             	test   $0x8,%dh
+  801599:	74 15                	je     8015b0 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80159b:	89 c2                	mov    %eax,%edx
+  80159d:	c1 ea 08             	shr    $0x8,%edx
+  8015a0:	83 e2 0f             	and    $0xf,%edx
+  8015a3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8015a8:	83 fa 06             	cmp    $0x6,%edx
+  8015ab:	74 0e                	je     8015bb <sys_env_set_status+0x7a>
+  8015ad:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8015b0:	0f b6 c9             	movzbl %cl,%ecx
+  8015b3:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8015b9:	eb 98                	jmp    801553 <sys_env_set_status+0x12>
+  8015bb:	89 c2                	mov    %eax,%edx
+  8015bd:	c1 ea 04             	shr    $0x4,%edx
+  8015c0:	83 e2 0f             	and    $0xf,%edx
+  8015c3:	83 fa 02             	cmp    $0x2,%edx
+  8015c6:	77 e5                	ja     8015ad <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  8015c8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015cb:	83 f8 02             	cmp    $0x2,%eax
+  8015ce:	0f 97 c1             	seta   %cl
+  8015d1:	0f b6 c9             	movzbl %cl,%ecx
+  8015d4:	eb d7                	jmp    8015ad <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  8015d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015db:	b8 08 00 00 00       	mov    $0x8,%eax
+  8015e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015e6:	89 df                	mov    %ebx,%edi
+  8015e8:	89 de                	mov    %ebx,%esi
+  8015ea:	cd 30                	int    $0x30
+  8015ec:	eb 90                	jmp    80157e <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015ee:	83 ec 0c             	sub    $0xc,%esp
+  8015f1:	50                   	push   %eax
+  8015f2:	6a 08                	push   $0x8
+  8015f4:	68 39 36 80 00       	push   $0x803639
+  8015f9:	6a 4a                	push   $0x4a
+  8015fb:	68 56 36 80 00       	push   $0x803656
+  801600:	e8 54 ec ff ff       	call   800259 <_panic>
+
+00801605 <sys_sysinfo>:
+{
+  801605:	55                   	push   %ebp
+  801606:	89 e5                	mov    %esp,%ebp
+  801608:	57                   	push   %edi
+  801609:	56                   	push   %esi
+  80160a:	53                   	push   %ebx
+  80160b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80160e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801615:	78 36                	js     80164d <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  801617:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80161e:	74 79                	je     801699 <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  801620:	8b 55 08             	mov    0x8(%ebp),%edx
+  801623:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801628:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80162d:	89 cb                	mov    %ecx,%ebx
+  80162f:	89 cf                	mov    %ecx,%edi
+  801631:	89 ce                	mov    %ecx,%esi
+  801633:	55                   	push   %ebp
+  801634:	68 3d 16 80 00       	push   $0x80163d
+  801639:	89 e5                	mov    %esp,%ebp
+  80163b:	0f 34                	sysenter
+  80163d:	83 c4 04             	add    $0x4,%esp
+  801640:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801641:	85 c0                	test   %eax,%eax
+  801643:	7f 6b                	jg     8016b0 <sys_sysinfo+0xab>
+}
+  801645:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801648:	5b                   	pop    %ebx
+  801649:	5e                   	pop    %esi
+  80164a:	5f                   	pop    %edi
+  80164b:	5d                   	pop    %ebp
+  80164c:	c3                   	ret
+  80164d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801652:	0f a2                	cpuid
+		return 0;
+  801654:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801659:	f6 c6 08             	test   $0x8,%dh
+  80165c:	74 15                	je     801673 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80165e:	89 c2                	mov    %eax,%edx
+  801660:	c1 ea 08             	shr    $0x8,%edx
+  801663:	83 e2 0f             	and    $0xf,%edx
+  801666:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80166b:	83 fa 06             	cmp    $0x6,%edx
+  80166e:	74 0e                	je     80167e <sys_sysinfo+0x79>
+  801670:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801673:	0f b6 c9             	movzbl %cl,%ecx
+  801676:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80167c:	eb 99                	jmp    801617 <sys_sysinfo+0x12>
+  80167e:	89 c2                	mov    %eax,%edx
+  801680:	c1 ea 04             	shr    $0x4,%edx
+  801683:	83 e2 0f             	and    $0xf,%edx
+  801686:	83 fa 02             	cmp    $0x2,%edx
+  801689:	77 e5                	ja     801670 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  80168b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80168e:	83 f8 02             	cmp    $0x2,%eax
+  801691:	0f 97 c1             	seta   %cl
+  801694:	0f b6 c9             	movzbl %cl,%ecx
+  801697:	eb d7                	jmp    801670 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  801699:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80169e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8016a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016a6:	89 cb                	mov    %ecx,%ebx
+  8016a8:	89 cf                	mov    %ecx,%edi
+  8016aa:	89 ce                	mov    %ecx,%esi
+  8016ac:	cd 30                	int    $0x30
+  8016ae:	eb 91                	jmp    801641 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016b0:	83 ec 0c             	sub    $0xc,%esp
+  8016b3:	50                   	push   %eax
+  8016b4:	6a 0b                	push   $0xb
+  8016b6:	68 39 36 80 00       	push   $0x803639
+  8016bb:	6a 4a                	push   $0x4a
+  8016bd:	68 56 36 80 00       	push   $0x803656
+  8016c2:	e8 92 eb ff ff       	call   800259 <_panic>
+
+008016c7 <sys_env_set_trapframe>:
+{
+  8016c7:	55                   	push   %ebp
+  8016c8:	89 e5                	mov    %esp,%ebp
+  8016ca:	57                   	push   %edi
+  8016cb:	56                   	push   %esi
+  8016cc:	53                   	push   %ebx
+  8016cd:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8016d0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8016d7:	78 37                	js     801710 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  8016d9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8016e0:	74 7a                	je     80175c <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  8016e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016ea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016ed:	b8 13 00 00 00       	mov    $0x13,%eax
+  8016f2:	89 df                	mov    %ebx,%edi
+  8016f4:	89 de                	mov    %ebx,%esi
+  8016f6:	55                   	push   %ebp
+  8016f7:	68 00 17 80 00       	push   $0x801700
+  8016fc:	89 e5                	mov    %esp,%ebp
+  8016fe:	0f 34                	sysenter
+  801700:	83 c4 04             	add    $0x4,%esp
+  801703:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801704:	85 c0                	test   %eax,%eax
+  801706:	7f 6c                	jg     801774 <sys_env_set_trapframe+0xad>
+}
+  801708:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80170b:	5b                   	pop    %ebx
+  80170c:	5e                   	pop    %esi
+  80170d:	5f                   	pop    %edi
+  80170e:	5d                   	pop    %ebp
+  80170f:	c3                   	ret
+  801710:	b8 01 00 00 00       	mov    $0x1,%eax
+  801715:	0f a2                	cpuid
+		return 0;
+  801717:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80171c:	f6 c6 08             	test   $0x8,%dh
+  80171f:	74 15                	je     801736 <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801721:	89 c2                	mov    %eax,%edx
+  801723:	c1 ea 08             	shr    $0x8,%edx
+  801726:	83 e2 0f             	and    $0xf,%edx
+  801729:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80172e:	83 fa 06             	cmp    $0x6,%edx
+  801731:	74 0e                	je     801741 <sys_env_set_trapframe+0x7a>
+  801733:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801736:	0f b6 c9             	movzbl %cl,%ecx
+  801739:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80173f:	eb 98                	jmp    8016d9 <sys_env_set_trapframe+0x12>
+  801741:	89 c2                	mov    %eax,%edx
+  801743:	c1 ea 04             	shr    $0x4,%edx
+  801746:	83 e2 0f             	and    $0xf,%edx
+  801749:	83 fa 02             	cmp    $0x2,%edx
+  80174c:	77 e5                	ja     801733 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  80174e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801751:	83 f8 02             	cmp    $0x2,%eax
+  801754:	0f 97 c1             	seta   %cl
+  801757:	0f b6 c9             	movzbl %cl,%ecx
+  80175a:	eb d7                	jmp    801733 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  80175c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801761:	b8 13 00 00 00       	mov    $0x13,%eax
+  801766:	8b 55 08             	mov    0x8(%ebp),%edx
+  801769:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80176c:	89 df                	mov    %ebx,%edi
+  80176e:	89 de                	mov    %ebx,%esi
+  801770:	cd 30                	int    $0x30
+  801772:	eb 90                	jmp    801704 <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801774:	83 ec 0c             	sub    $0xc,%esp
+  801777:	50                   	push   %eax
+  801778:	6a 13                	push   $0x13
+  80177a:	68 39 36 80 00       	push   $0x803639
+  80177f:	6a 4a                	push   $0x4a
+  801781:	68 56 36 80 00       	push   $0x803656
+  801786:	e8 ce ea ff ff       	call   800259 <_panic>
+
+0080178b <sys_env_set_stack_limit>:
+{
+  80178b:	55                   	push   %ebp
+  80178c:	89 e5                	mov    %esp,%ebp
+  80178e:	57                   	push   %edi
+  80178f:	56                   	push   %esi
+  801790:	53                   	push   %ebx
+  801791:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801794:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80179b:	78 37                	js     8017d4 <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  80179d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8017a4:	74 7a                	je     801820 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  8017a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017b1:	b8 19 00 00 00       	mov    $0x19,%eax
+  8017b6:	89 df                	mov    %ebx,%edi
+  8017b8:	89 de                	mov    %ebx,%esi
+  8017ba:	55                   	push   %ebp
+  8017bb:	68 c4 17 80 00       	push   $0x8017c4
+  8017c0:	89 e5                	mov    %esp,%ebp
+  8017c2:	0f 34                	sysenter
+  8017c4:	83 c4 04             	add    $0x4,%esp
+  8017c7:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8017c8:	85 c0                	test   %eax,%eax
+  8017ca:	7f 6c                	jg     801838 <sys_env_set_stack_limit+0xad>
+}
+  8017cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017cf:	5b                   	pop    %ebx
+  8017d0:	5e                   	pop    %esi
+  8017d1:	5f                   	pop    %edi
+  8017d2:	5d                   	pop    %ebp
+  8017d3:	c3                   	ret
+  8017d4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8017d9:	0f a2                	cpuid
+		return 0;
+  8017db:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8017e0:	f6 c6 08             	test   $0x8,%dh
+  8017e3:	74 15                	je     8017fa <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017e5:	89 c2                	mov    %eax,%edx
+  8017e7:	c1 ea 08             	shr    $0x8,%edx
+  8017ea:	83 e2 0f             	and    $0xf,%edx
+  8017ed:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017f2:	83 fa 06             	cmp    $0x6,%edx
+  8017f5:	74 0e                	je     801805 <sys_env_set_stack_limit+0x7a>
+  8017f7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8017fa:	0f b6 c9             	movzbl %cl,%ecx
+  8017fd:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801803:	eb 98                	jmp    80179d <sys_env_set_stack_limit+0x12>
+  801805:	89 c2                	mov    %eax,%edx
+  801807:	c1 ea 04             	shr    $0x4,%edx
+  80180a:	83 e2 0f             	and    $0xf,%edx
+  80180d:	83 fa 02             	cmp    $0x2,%edx
+  801810:	77 e5                	ja     8017f7 <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  801812:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801815:	83 f8 02             	cmp    $0x2,%eax
+  801818:	0f 97 c1             	seta   %cl
+  80181b:	0f b6 c9             	movzbl %cl,%ecx
+  80181e:	eb d7                	jmp    8017f7 <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  801820:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801825:	b8 19 00 00 00       	mov    $0x19,%eax
+  80182a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80182d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801830:	89 df                	mov    %ebx,%edi
+  801832:	89 de                	mov    %ebx,%esi
+  801834:	cd 30                	int    $0x30
+  801836:	eb 90                	jmp    8017c8 <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801838:	83 ec 0c             	sub    $0xc,%esp
+  80183b:	50                   	push   %eax
+  80183c:	6a 19                	push   $0x19
+  80183e:	68 39 36 80 00       	push   $0x803639
+  801843:	6a 4a                	push   $0x4a
+  801845:	68 56 36 80 00       	push   $0x803656
+  80184a:	e8 0a ea ff ff       	call   800259 <_panic>
+
+0080184f <sys_env_set_pgfault_upcall>:
+{
+  80184f:	55                   	push   %ebp
+  801850:	89 e5                	mov    %esp,%ebp
+  801852:	57                   	push   %edi
+  801853:	56                   	push   %esi
+  801854:	53                   	push   %ebx
+  801855:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801858:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80185f:	78 37                	js     801898 <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  801861:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801868:	74 7a                	je     8018e4 <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  80186a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80186f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801872:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801875:	b8 09 00 00 00       	mov    $0x9,%eax
+  80187a:	89 df                	mov    %ebx,%edi
+  80187c:	89 de                	mov    %ebx,%esi
+  80187e:	55                   	push   %ebp
+  80187f:	68 88 18 80 00       	push   $0x801888
+  801884:	89 e5                	mov    %esp,%ebp
+  801886:	0f 34                	sysenter
+  801888:	83 c4 04             	add    $0x4,%esp
+  80188b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80188c:	85 c0                	test   %eax,%eax
+  80188e:	7f 6c                	jg     8018fc <sys_env_set_pgfault_upcall+0xad>
+}
+  801890:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801893:	5b                   	pop    %ebx
+  801894:	5e                   	pop    %esi
+  801895:	5f                   	pop    %edi
+  801896:	5d                   	pop    %ebp
+  801897:	c3                   	ret
+  801898:	b8 01 00 00 00       	mov    $0x1,%eax
+  80189d:	0f a2                	cpuid
+		return 0;
+  80189f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018a4:	f6 c6 08             	test   $0x8,%dh
+  8018a7:	74 15                	je     8018be <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018a9:	89 c2                	mov    %eax,%edx
+  8018ab:	c1 ea 08             	shr    $0x8,%edx
+  8018ae:	83 e2 0f             	and    $0xf,%edx
+  8018b1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018b6:	83 fa 06             	cmp    $0x6,%edx
+  8018b9:	74 0e                	je     8018c9 <sys_env_set_pgfault_upcall+0x7a>
+  8018bb:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8018be:	0f b6 c9             	movzbl %cl,%ecx
+  8018c1:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8018c7:	eb 98                	jmp    801861 <sys_env_set_pgfault_upcall+0x12>
+  8018c9:	89 c2                	mov    %eax,%edx
+  8018cb:	c1 ea 04             	shr    $0x4,%edx
+  8018ce:	83 e2 0f             	and    $0xf,%edx
+  8018d1:	83 fa 02             	cmp    $0x2,%edx
+  8018d4:	77 e5                	ja     8018bb <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  8018d6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018d9:	83 f8 02             	cmp    $0x2,%eax
+  8018dc:	0f 97 c1             	seta   %cl
+  8018df:	0f b6 c9             	movzbl %cl,%ecx
+  8018e2:	eb d7                	jmp    8018bb <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  8018e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018e9:	b8 09 00 00 00       	mov    $0x9,%eax
+  8018ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018f4:	89 df                	mov    %ebx,%edi
+  8018f6:	89 de                	mov    %ebx,%esi
+  8018f8:	cd 30                	int    $0x30
+  8018fa:	eb 90                	jmp    80188c <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8018fc:	83 ec 0c             	sub    $0xc,%esp
+  8018ff:	50                   	push   %eax
+  801900:	6a 09                	push   $0x9
+  801902:	68 39 36 80 00       	push   $0x803639
+  801907:	6a 4a                	push   $0x4a
+  801909:	68 56 36 80 00       	push   $0x803656
+  80190e:	e8 46 e9 ff ff       	call   800259 <_panic>
+
+00801913 <sys_ipc_try_send>:
+{
+  801913:	55                   	push   %ebp
+  801914:	89 e5                	mov    %esp,%ebp
+  801916:	57                   	push   %edi
+  801917:	56                   	push   %esi
+  801918:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801919:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801920:	78 32                	js     801954 <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  801922:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801929:	74 75                	je     8019a0 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  80192b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80192e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801931:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801936:	be 00 00 00 00       	mov    $0x0,%esi
+  80193b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80193e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801941:	55                   	push   %ebp
+  801942:	68 4b 19 80 00       	push   $0x80194b
+  801947:	89 e5                	mov    %esp,%ebp
+  801949:	0f 34                	sysenter
+  80194b:	83 c4 04             	add    $0x4,%esp
+  80194e:	5d                   	pop    %ebp
+}
+  80194f:	5b                   	pop    %ebx
+  801950:	5e                   	pop    %esi
+  801951:	5f                   	pop    %edi
+  801952:	5d                   	pop    %ebp
+  801953:	c3                   	ret
+  801954:	b8 01 00 00 00       	mov    $0x1,%eax
+  801959:	0f a2                	cpuid
+		return 0;
+  80195b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801960:	f6 c6 08             	test   $0x8,%dh
+  801963:	74 15                	je     80197a <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801965:	89 c2                	mov    %eax,%edx
+  801967:	c1 ea 08             	shr    $0x8,%edx
+  80196a:	83 e2 0f             	and    $0xf,%edx
+  80196d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801972:	83 fa 06             	cmp    $0x6,%edx
+  801975:	74 0e                	je     801985 <sys_ipc_try_send+0x72>
+  801977:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80197a:	0f b6 c9             	movzbl %cl,%ecx
+  80197d:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801983:	eb 9d                	jmp    801922 <sys_ipc_try_send+0xf>
+  801985:	89 c2                	mov    %eax,%edx
+  801987:	c1 ea 04             	shr    $0x4,%edx
+  80198a:	83 e2 0f             	and    $0xf,%edx
+  80198d:	83 fa 02             	cmp    $0x2,%edx
+  801990:	77 e5                	ja     801977 <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  801992:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801995:	83 f8 02             	cmp    $0x2,%eax
+  801998:	0f 97 c1             	seta   %cl
+  80199b:	0f b6 c9             	movzbl %cl,%ecx
+  80199e:	eb d7                	jmp    801977 <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  8019a0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8019a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8019aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019b0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019b3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8019b6:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  8019b8:	eb 95                	jmp    80194f <sys_ipc_try_send+0x3c>
+
+008019ba <sys_ipc_send>:
+{
+  8019ba:	55                   	push   %ebp
+  8019bb:	89 e5                	mov    %esp,%ebp
+  8019bd:	57                   	push   %edi
+  8019be:	56                   	push   %esi
+  8019bf:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8019c0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8019c7:	78 32                	js     8019fb <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  8019c9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8019d0:	74 75                	je     801a47 <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  8019d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019d8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8019dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8019e2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019e5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8019e8:	55                   	push   %ebp
+  8019e9:	68 f2 19 80 00       	push   $0x8019f2
+  8019ee:	89 e5                	mov    %esp,%ebp
+  8019f0:	0f 34                	sysenter
+  8019f2:	83 c4 04             	add    $0x4,%esp
+  8019f5:	5d                   	pop    %ebp
+}
+  8019f6:	5b                   	pop    %ebx
+  8019f7:	5e                   	pop    %esi
+  8019f8:	5f                   	pop    %edi
+  8019f9:	5d                   	pop    %ebp
+  8019fa:	c3                   	ret
+  8019fb:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a00:	0f a2                	cpuid
+		return 0;
+  801a02:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801a07:	f6 c6 08             	test   $0x8,%dh
+  801a0a:	74 15                	je     801a21 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a0c:	89 c2                	mov    %eax,%edx
+  801a0e:	c1 ea 08             	shr    $0x8,%edx
+  801a11:	83 e2 0f             	and    $0xf,%edx
+  801a14:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a19:	83 fa 06             	cmp    $0x6,%edx
+  801a1c:	74 0e                	je     801a2c <sys_ipc_send+0x72>
+  801a1e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a21:	0f b6 c9             	movzbl %cl,%ecx
+  801a24:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801a2a:	eb 9d                	jmp    8019c9 <sys_ipc_send+0xf>
+  801a2c:	89 c2                	mov    %eax,%edx
+  801a2e:	c1 ea 04             	shr    $0x4,%edx
+  801a31:	83 e2 0f             	and    $0xf,%edx
+  801a34:	83 fa 02             	cmp    $0x2,%edx
+  801a37:	77 e5                	ja     801a1e <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  801a39:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a3c:	83 f8 02             	cmp    $0x2,%eax
+  801a3f:	0f 97 c1             	seta   %cl
+  801a42:	0f b6 c9             	movzbl %cl,%ecx
+  801a45:	eb d7                	jmp    801a1e <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  801a47:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801a4c:	be 00 00 00 00       	mov    $0x0,%esi
+  801a51:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a54:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a57:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a5a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a5d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801a5f:	eb 95                	jmp    8019f6 <sys_ipc_send+0x3c>
+
+00801a61 <sys_ipc_recv>:
+{
+  801a61:	55                   	push   %ebp
+  801a62:	89 e5                	mov    %esp,%ebp
+  801a64:	57                   	push   %edi
+  801a65:	56                   	push   %esi
+  801a66:	53                   	push   %ebx
+  801a67:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801a6a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a71:	78 36                	js     801aa9 <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  801a73:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a7a:	74 79                	je     801af5 <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  801a7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a7f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a84:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801a89:	89 cb                	mov    %ecx,%ebx
+  801a8b:	89 cf                	mov    %ecx,%edi
+  801a8d:	89 ce                	mov    %ecx,%esi
+  801a8f:	55                   	push   %ebp
+  801a90:	68 99 1a 80 00       	push   $0x801a99
+  801a95:	89 e5                	mov    %esp,%ebp
+  801a97:	0f 34                	sysenter
+  801a99:	83 c4 04             	add    $0x4,%esp
+  801a9c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801a9d:	85 c0                	test   %eax,%eax
+  801a9f:	7f 6b                	jg     801b0c <sys_ipc_recv+0xab>
+}
+  801aa1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aa4:	5b                   	pop    %ebx
+  801aa5:	5e                   	pop    %esi
+  801aa6:	5f                   	pop    %edi
+  801aa7:	5d                   	pop    %ebp
+  801aa8:	c3                   	ret
+  801aa9:	b8 01 00 00 00       	mov    $0x1,%eax
+  801aae:	0f a2                	cpuid
+		return 0;
+  801ab0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801ab5:	f6 c6 08             	test   $0x8,%dh
+  801ab8:	74 15                	je     801acf <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801aba:	89 c2                	mov    %eax,%edx
+  801abc:	c1 ea 08             	shr    $0x8,%edx
+  801abf:	83 e2 0f             	and    $0xf,%edx
+  801ac2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ac7:	83 fa 06             	cmp    $0x6,%edx
+  801aca:	74 0e                	je     801ada <sys_ipc_recv+0x79>
+  801acc:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801acf:	0f b6 c9             	movzbl %cl,%ecx
+  801ad2:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801ad8:	eb 99                	jmp    801a73 <sys_ipc_recv+0x12>
+  801ada:	89 c2                	mov    %eax,%edx
+  801adc:	c1 ea 04             	shr    $0x4,%edx
+  801adf:	83 e2 0f             	and    $0xf,%edx
+  801ae2:	83 fa 02             	cmp    $0x2,%edx
+  801ae5:	77 e5                	ja     801acc <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  801ae7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801aea:	83 f8 02             	cmp    $0x2,%eax
+  801aed:	0f 97 c1             	seta   %cl
+  801af0:	0f b6 c9             	movzbl %cl,%ecx
+  801af3:	eb d7                	jmp    801acc <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  801af5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801afa:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801aff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b02:	89 cb                	mov    %ecx,%ebx
+  801b04:	89 cf                	mov    %ecx,%edi
+  801b06:	89 ce                	mov    %ecx,%esi
+  801b08:	cd 30                	int    $0x30
+  801b0a:	eb 91                	jmp    801a9d <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801b0c:	83 ec 0c             	sub    $0xc,%esp
+  801b0f:	50                   	push   %eax
+  801b10:	6a 0d                	push   $0xd
+  801b12:	68 39 36 80 00       	push   $0x803639
+  801b17:	6a 4a                	push   $0x4a
+  801b19:	68 56 36 80 00       	push   $0x803656
+  801b1e:	e8 36 e7 ff ff       	call   800259 <_panic>
+
+00801b23 <sys_ipc_send_range>:
+{
+  801b23:	55                   	push   %ebp
+  801b24:	89 e5                	mov    %esp,%ebp
+  801b26:	57                   	push   %edi
+  801b27:	56                   	push   %esi
+  801b28:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801b29:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b30:	78 30                	js     801b62 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  801b32:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b39:	74 73                	je     801bae <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801b3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b3e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b41:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801b46:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b49:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801b4c:	8b 75 18             	mov    0x18(%ebp),%esi
+  801b4f:	55                   	push   %ebp
+  801b50:	68 59 1b 80 00       	push   $0x801b59
+  801b55:	89 e5                	mov    %esp,%ebp
+  801b57:	0f 34                	sysenter
+  801b59:	83 c4 04             	add    $0x4,%esp
+  801b5c:	5d                   	pop    %ebp
+}
+  801b5d:	5b                   	pop    %ebx
+  801b5e:	5e                   	pop    %esi
+  801b5f:	5f                   	pop    %edi
+  801b60:	5d                   	pop    %ebp
+  801b61:	c3                   	ret
+  801b62:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b67:	0f a2                	cpuid
+		return 0;
+  801b69:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b6e:	f6 c6 08             	test   $0x8,%dh
+  801b71:	74 15                	je     801b88 <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b73:	89 c2                	mov    %eax,%edx
+  801b75:	c1 ea 08             	shr    $0x8,%edx
+  801b78:	83 e2 0f             	and    $0xf,%edx
+  801b7b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b80:	83 fa 06             	cmp    $0x6,%edx
+  801b83:	74 0e                	je     801b93 <sys_ipc_send_range+0x70>
+  801b85:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b88:	0f b6 c9             	movzbl %cl,%ecx
+  801b8b:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801b91:	eb 9f                	jmp    801b32 <sys_ipc_send_range+0xf>
+  801b93:	89 c2                	mov    %eax,%edx
+  801b95:	c1 ea 04             	shr    $0x4,%edx
+  801b98:	83 e2 0f             	and    $0xf,%edx
+  801b9b:	83 fa 02             	cmp    $0x2,%edx
+  801b9e:	77 e5                	ja     801b85 <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  801ba0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ba3:	83 f8 02             	cmp    $0x2,%eax
+  801ba6:	0f 97 c1             	seta   %cl
+  801ba9:	0f b6 c9             	movzbl %cl,%ecx
+  801bac:	eb d7                	jmp    801b85 <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  801bae:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801bb3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bb6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bb9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801bbc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801bbf:	8b 75 18             	mov    0x18(%ebp),%esi
+  801bc2:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  801bc4:	eb 97                	jmp    801b5d <sys_ipc_send_range+0x3a>
+
+00801bc6 <sys_ipc_recv_range>:
+{
+  801bc6:	55                   	push   %ebp
+  801bc7:	89 e5                	mov    %esp,%ebp
+  801bc9:	57                   	push   %edi
+  801bca:	56                   	push   %esi
+  801bcb:	53                   	push   %ebx
+  801bcc:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801bcf:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801bd6:	78 37                	js     801c0f <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  801bd8:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801bdf:	74 7a                	je     801c5b <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  801be1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801be6:	8b 55 08             	mov    0x8(%ebp),%edx
+  801be9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bec:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801bf1:	89 df                	mov    %ebx,%edi
+  801bf3:	89 de                	mov    %ebx,%esi
+  801bf5:	55                   	push   %ebp
+  801bf6:	68 ff 1b 80 00       	push   $0x801bff
+  801bfb:	89 e5                	mov    %esp,%ebp
+  801bfd:	0f 34                	sysenter
+  801bff:	83 c4 04             	add    $0x4,%esp
+  801c02:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801c03:	85 c0                	test   %eax,%eax
+  801c05:	7f 6c                	jg     801c73 <sys_ipc_recv_range+0xad>
+}
+  801c07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c0a:	5b                   	pop    %ebx
+  801c0b:	5e                   	pop    %esi
+  801c0c:	5f                   	pop    %edi
+  801c0d:	5d                   	pop    %ebp
+  801c0e:	c3                   	ret
+  801c0f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c14:	0f a2                	cpuid
+		return 0;
+  801c16:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801c1b:	f6 c6 08             	test   $0x8,%dh
+  801c1e:	74 15                	je     801c35 <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c20:	89 c2                	mov    %eax,%edx
+  801c22:	c1 ea 08             	shr    $0x8,%edx
+  801c25:	83 e2 0f             	and    $0xf,%edx
+  801c28:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801c2d:	83 fa 06             	cmp    $0x6,%edx
+  801c30:	74 0e                	je     801c40 <sys_ipc_recv_range+0x7a>
+  801c32:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801c35:	0f b6 c9             	movzbl %cl,%ecx
+  801c38:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801c3e:	eb 98                	jmp    801bd8 <sys_ipc_recv_range+0x12>
+  801c40:	89 c2                	mov    %eax,%edx
+  801c42:	c1 ea 04             	shr    $0x4,%edx
+  801c45:	83 e2 0f             	and    $0xf,%edx
+  801c48:	83 fa 02             	cmp    $0x2,%edx
+  801c4b:	77 e5                	ja     801c32 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801c4d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c50:	83 f8 02             	cmp    $0x2,%eax
+  801c53:	0f 97 c1             	seta   %cl
+  801c56:	0f b6 c9             	movzbl %cl,%ecx
+  801c59:	eb d7                	jmp    801c32 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801c5b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c60:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801c65:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c68:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c6b:	89 df                	mov    %ebx,%edi
+  801c6d:	89 de                	mov    %ebx,%esi
+  801c6f:	cd 30                	int    $0x30
+  801c71:	eb 90                	jmp    801c03 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801c73:	83 ec 0c             	sub    $0xc,%esp
+  801c76:	50                   	push   %eax
+  801c77:	6a 1f                	push   $0x1f
+  801c79:	68 39 36 80 00       	push   $0x803639
+  801c7e:	6a 4a                	push   $0x4a
+  801c80:	68 56 36 80 00       	push   $0x803656
+  801c85:	e8 cf e5 ff ff       	call   800259 <_panic>
+
+00801c8a <sys_ipc_call>:
+{
+  801c8a:	55                   	push   %ebp
+  801c8b:	89 e5                	mov    %esp,%ebp
+  801c8d:	57                   	push   %edi
+  801c8e:	56                   	push   %esi
+  801c8f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801c90:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c93:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801c98:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801c9b:	55                   	push   %ebp
+  801c9c:	56                   	push   %esi
+  801c9d:	8b 0e                	mov    (%esi),%ecx
+  801c9f:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801ca2:	8b 7e 08             	mov    0x8(%esi),%edi
+  801ca5:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801ca8:	8b 76 0c             	mov    0xc(%esi),%esi
+  801cab:	cd 30                	int    $0x30
+  801cad:	87 34 24             	xchg   %esi,(%esp)
+  801cb0:	89 0e                	mov    %ecx,(%esi)
+  801cb2:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801cb5:	89 7e 08             	mov    %edi,0x8(%esi)
+  801cb8:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801cbb:	8f 46 0c             	pop    0xc(%esi)
+  801cbe:	5d                   	pop    %ebp
+}
+  801cbf:	5b                   	pop    %ebx
+  801cc0:	5e                   	pop    %esi
+  801cc1:	5f                   	pop    %edi
+  801cc2:	5d                   	pop    %ebp
+  801cc3:	c3                   	ret
+
+00801cc4 <sys_ipc_reply_wait>:
+{
+  801cc4:	55                   	push   %ebp
+  801cc5:	89 e5                	mov    %esp,%ebp
+  801cc7:	57                   	push   %edi
+  801cc8:	56                   	push   %esi
+  801cc9:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801cca:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ccd:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801cd2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801cd5:	55                   	push   %ebp
+  801cd6:	56                   	push   %esi
+  801cd7:	8b 0e                	mov    (%esi),%ecx
+  801cd9:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801cdc:	8b 7e 08             	mov    0x8(%esi),%edi
+  801cdf:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801ce2:	8b 76 0c             	mov    0xc(%esi),%esi
+  801ce5:	cd 30                	int    $0x30
+  801ce7:	87 34 24             	xchg   %esi,(%esp)
+  801cea:	89 0e                	mov    %ecx,(%esi)
+  801cec:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801cef:	89 7e 08             	mov    %edi,0x8(%esi)
+  801cf2:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801cf5:	8f 46 0c             	pop    0xc(%esi)
+  801cf8:	5d                   	pop    %ebp
+}
+  801cf9:	5b                   	pop    %ebx
+  801cfa:	5e                   	pop    %esi
+  801cfb:	5f                   	pop    %edi
+  801cfc:	5d                   	pop    %ebp
+  801cfd:	c3                   	ret
+
+00801cfe <sys_ipc_send_msg>:
+{
+  801cfe:	55                   	push   %ebp
+  801cff:	89 e5                	mov    %esp,%ebp
+  801d01:	57                   	push   %edi
+  801d02:	56                   	push   %esi
+  801d03:	53                   	push   %ebx
+  801d04:	83 ec 20             	sub    $0x20,%esp
+  801d07:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801d0a:	8b 10                	mov    (%eax),%edx
+  801d0c:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801d0f:	8b 50 04             	mov    0x4(%eax),%edx
+  801d12:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801d15:	8b 50 08             	mov    0x8(%eax),%edx
+  801d18:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801d1b:	8b 50 0c             	mov    0xc(%eax),%edx
+  801d1e:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801d21:	8b 40 10             	mov    0x10(%eax),%eax
+  801d24:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801d27:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801d2a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d2d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801d32:	55                   	push   %ebp
+  801d33:	56                   	push   %esi
+  801d34:	8b 0e                	mov    (%esi),%ecx
+  801d36:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801d39:	8b 7e 08             	mov    0x8(%esi),%edi
+  801d3c:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801d3f:	8b 76 0c             	mov    0xc(%esi),%esi
+  801d42:	cd 30                	int    $0x30
+  801d44:	87 34 24             	xchg   %esi,(%esp)
+  801d47:	89 0e                	mov    %ecx,(%esi)
+  801d49:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801d4c:	89 7e 08             	mov    %edi,0x8(%esi)
+  801d4f:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801d52:	8f 46 0c             	pop    0xc(%esi)
+  801d55:	5d                   	pop    %ebp
+}
+  801d56:	83 c4 20             	add    $0x20,%esp
+  801d59:	5b                   	pop    %ebx
+  801d5a:	5e                   	pop    %esi
+  801d5b:	5f                   	pop    %edi
+  801d5c:	5d                   	pop    %ebp
+  801d5d:	c3                   	ret
+
+00801d5e <sys_fork>:
+{
+  801d5e:	55                   	push   %ebp
+  801d5f:	89 e5                	mov    %esp,%ebp
+  801d61:	57                   	push   %edi
+  801d62:	56                   	push   %esi
+  801d63:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801d64:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801d6b:	78 2e                	js     801d9b <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801d6d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801d74:	74 71                	je     801de7 <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801d76:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d7b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801d80:	89 d1                	mov    %edx,%ecx
+  801d82:	89 d3                	mov    %edx,%ebx
+  801d84:	89 d7                	mov    %edx,%edi
+  801d86:	89 d6                	mov    %edx,%esi
+  801d88:	55                   	push   %ebp
+  801d89:	68 92 1d 80 00       	push   $0x801d92
+  801d8e:	89 e5                	mov    %esp,%ebp
+  801d90:	0f 34                	sysenter
+  801d92:	83 c4 04             	add    $0x4,%esp
+  801d95:	5d                   	pop    %ebp
+}
+  801d96:	5b                   	pop    %ebx
+  801d97:	5e                   	pop    %esi
+  801d98:	5f                   	pop    %edi
+  801d99:	5d                   	pop    %ebp
+  801d9a:	c3                   	ret
+  801d9b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801da0:	0f a2                	cpuid
+		return 0;
+  801da2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801da7:	f6 c6 08             	test   $0x8,%dh
+  801daa:	74 15                	je     801dc1 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801dac:	89 c2                	mov    %eax,%edx
+  801dae:	c1 ea 08             	shr    $0x8,%edx
+  801db1:	83 e2 0f             	and    $0xf,%edx
+  801db4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801db9:	83 fa 06             	cmp    $0x6,%edx
+  801dbc:	74 0e                	je     801dcc <sys_fork+0x6e>
+  801dbe:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801dc1:	0f b6 c9             	movzbl %cl,%ecx
+  801dc4:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801dca:	eb a1                	jmp    801d6d <sys_fork+0xf>
+  801dcc:	89 c2                	mov    %eax,%edx
+  801dce:	c1 ea 04             	shr    $0x4,%edx
+  801dd1:	83 e2 0f             	and    $0xf,%edx
+  801dd4:	83 fa 02             	cmp    $0x2,%edx
+  801dd7:	77 e5                	ja     801dbe <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801dd9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ddc:	83 f8 02             	cmp    $0x2,%eax
+  801ddf:	0f 97 c1             	seta   %cl
+  801de2:	0f b6 c9             	movzbl %cl,%ecx
+  801de5:	eb d7                	jmp    801dbe <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801de7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dec:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801df1:	89 d1                	mov    %edx,%ecx
+  801df3:	89 d3                	mov    %edx,%ebx
+  801df5:	89 d7                	mov    %edx,%edi
+  801df7:	89 d6                	mov    %edx,%esi
+  801df9:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801dfb:	eb 99                	jmp    801d96 <sys_fork+0x38>
+
+00801dfd <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801dfd:	55                   	push   %ebp
+  801dfe:	89 e5                	mov    %esp,%ebp
+  801e00:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801e03:	ff 75 14             	push   0x14(%ebp)
+  801e06:	ff 75 10             	push   0x10(%ebp)
+  801e09:	ff 75 0c             	push   0xc(%ebp)
+  801e0c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e11:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e14:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801e19:	e8 81 ee ff ff       	call   800c9f <page_vec_call>
+}
+  801e1e:	c9                   	leave
+  801e1f:	c3                   	ret
+
+00801e20 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801e20:	55                   	push   %ebp
+  801e21:	89 e5                	mov    %esp,%ebp
+  801e23:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801e26:	ff 75 18             	push   0x18(%ebp)
+  801e29:	ff 75 14             	push   0x14(%ebp)
+  801e2c:	ff 75 10             	push   0x10(%ebp)
+  801e2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e32:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e35:	b8 10 00 00 00       	mov    $0x10,%eax
+  801e3a:	e8 60 ee ff ff       	call   800c9f <page_vec_call>
+}
+  801e3f:	c9                   	leave
+  801e40:	c3                   	ret
+
+00801e41 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801e41:	55                   	push   %ebp
+  801e42:	89 e5                	mov    %esp,%ebp
+  801e44:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801e47:	ff 75 14             	push   0x14(%ebp)
+  801e4a:	ff 75 10             	push   0x10(%ebp)
+  801e4d:	ff 75 0c             	push   0xc(%ebp)
+  801e50:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e55:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e58:	b8 11 00 00 00       	mov    $0x11,%eax
+  801e5d:	e8 3d ee ff ff       	call   800c9f <page_vec_call>
+}
+  801e62:	c9                   	leave
+  801e63:	c3                   	ret
+
+00801e64 <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801e64:	55                   	push   %ebp
+  801e65:	89 e5                	mov    %esp,%ebp
+  801e67:	57                   	push   %edi
+  801e68:	56                   	push   %esi
+  801e69:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801e6a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e71:	78 32                	js     801ea5 <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801e73:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e7a:	74 75                	je     801ef1 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801e7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e82:	b8 12 00 00 00       	mov    $0x12,%eax
+  801e87:	be 00 00 00 00       	mov    $0x0,%esi
+  801e8c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e8f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801e92:	55                   	push   %ebp
+  801e93:	68 9c 1e 80 00       	push   $0x801e9c
+  801e98:	89 e5                	mov    %esp,%ebp
+  801e9a:	0f 34                	sysenter
+  801e9c:	83 c4 04             	add    $0x4,%esp
+  801e9f:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801ea0:	5b                   	pop    %ebx
+  801ea1:	5e                   	pop    %esi
+  801ea2:	5f                   	pop    %edi
+  801ea3:	5d                   	pop    %ebp
+  801ea4:	c3                   	ret
+  801ea5:	b8 01 00 00 00       	mov    $0x1,%eax
+  801eaa:	0f a2                	cpuid
+		return 0;
+  801eac:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801eb1:	f6 c6 08             	test   $0x8,%dh
+  801eb4:	74 15                	je     801ecb <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801eb6:	89 c2                	mov    %eax,%edx
+  801eb8:	c1 ea 08             	shr    $0x8,%edx
+  801ebb:	83 e2 0f             	and    $0xf,%edx
+  801ebe:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ec3:	83 fa 06             	cmp    $0x6,%edx
+  801ec6:	74 0e                	je     801ed6 <sys_vm_ranges+0x72>
+  801ec8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801ecb:	0f b6 c9             	movzbl %cl,%ecx
+  801ece:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801ed4:	eb 9d                	jmp    801e73 <sys_vm_ranges+0xf>
+  801ed6:	89 c2                	mov    %eax,%edx
+  801ed8:	c1 ea 04             	shr    $0x4,%edx
+  801edb:	83 e2 0f             	and    $0xf,%edx
+  801ede:	83 fa 02             	cmp    $0x2,%edx
+  801ee1:	77 e5                	ja     801ec8 <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  801ee3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ee6:	83 f8 02             	cmp    $0x2,%eax
+  801ee9:	0f 97 c1             	seta   %cl
+  801eec:	0f b6 c9             	movzbl %cl,%ecx
+  801eef:	eb d7                	jmp    801ec8 <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801ef1:	b8 12 00 00 00       	mov    $0x12,%eax
+  801ef6:	be 00 00 00 00       	mov    $0x0,%esi
+  801efb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801efe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f01:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f04:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801f07:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801f09:	eb 95                	jmp    801ea0 <sys_vm_ranges+0x3c>
+
+00801f0b <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801f0b:	55                   	push   %ebp
+  801f0c:	89 e5                	mov    %esp,%ebp
+  801f0e:	57                   	push   %edi
+  801f0f:	56                   	push   %esi
+  801f10:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801f11:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f18:	78 31                	js     801f4b <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801f1a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f21:	74 74                	je     801f97 <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801f23:	be 00 00 00 00       	mov    $0x0,%esi
+  801f28:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f2b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f2e:	b8 14 00 00 00       	mov    $0x14,%eax
+  801f33:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f36:	89 f7                	mov    %esi,%edi
+  801f38:	55                   	push   %ebp
+  801f39:	68 42 1f 80 00       	push   $0x801f42
+  801f3e:	89 e5                	mov    %esp,%ebp
+  801f40:	0f 34                	sysenter
+  801f42:	83 c4 04             	add    $0x4,%esp
+  801f45:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801f46:	5b                   	pop    %ebx
+  801f47:	5e                   	pop    %esi
+  801f48:	5f                   	pop    %edi
+  801f49:	5d                   	pop    %ebp
+  801f4a:	c3                   	ret
+  801f4b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f50:	0f a2                	cpuid
+		return 0;
+  801f52:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801f57:	f6 c6 08             	test   $0x8,%dh
+  801f5a:	74 15                	je     801f71 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f5c:	89 c2                	mov    %eax,%edx
+  801f5e:	c1 ea 08             	shr    $0x8,%edx
+  801f61:	83 e2 0f             	and    $0xf,%edx
+  801f64:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f69:	83 fa 06             	cmp    $0x6,%edx
+  801f6c:	74 0e                	je     801f7c <sys_spawn+0x71>
+  801f6e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801f71:	0f b6 c9             	movzbl %cl,%ecx
+  801f74:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801f7a:	eb 9e                	jmp    801f1a <sys_spawn+0xf>
+  801f7c:	89 c2                	mov    %eax,%edx
+  801f7e:	c1 ea 04             	shr    $0x4,%edx
+  801f81:	83 e2 0f             	and    $0xf,%edx
+  801f84:	83 fa 02             	cmp    $0x2,%edx
+  801f87:	77 e5                	ja     801f6e <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  801f89:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f8c:	83 f8 02             	cmp    $0x2,%eax
+  801f8f:	0f 97 c1             	seta   %cl
+  801f92:	0f b6 c9             	movzbl %cl,%ecx
+  801f95:	eb d7                	jmp    801f6e <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  801f97:	be 00 00 00 00       	mov    $0x0,%esi
+  801f9c:	b8 14 00 00 00       	mov    $0x14,%eax
+  801fa1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fa4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fa7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801faa:	89 f7                	mov    %esi,%edi
+  801fac:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  801fae:	eb 96                	jmp    801f46 <sys_spawn+0x3b>
+
+00801fb0 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  801fb0:	55                   	push   %ebp
+  801fb1:	89 e5                	mov    %esp,%ebp
+  801fb3:	57                   	push   %edi
+  801fb4:	56                   	push   %esi
+  801fb5:	53                   	push   %ebx
+  801fb6:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801fb9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801fc0:	78 37                	js     801ff9 <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  801fc2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801fc9:	74 7a                	je     802045 <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  801fcb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fd0:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fd3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fd6:	b8 15 00 00 00       	mov    $0x15,%eax
+  801fdb:	89 df                	mov    %ebx,%edi
+  801fdd:	89 de                	mov    %ebx,%esi
+  801fdf:	55                   	push   %ebp
+  801fe0:	68 e9 1f 80 00       	push   $0x801fe9
+  801fe5:	89 e5                	mov    %esp,%ebp
+  801fe7:	0f 34                	sysenter
+  801fe9:	83 c4 04             	add    $0x4,%esp
+  801fec:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801fed:	85 c0                	test   %eax,%eax
+  801fef:	7f 6c                	jg     80205d <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  801ff1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ff4:	5b                   	pop    %ebx
+  801ff5:	5e                   	pop    %esi
+  801ff6:	5f                   	pop    %edi
+  801ff7:	5d                   	pop    %ebp
+  801ff8:	c3                   	ret
+  801ff9:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ffe:	0f a2                	cpuid
+		return 0;
+  802000:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802005:	f6 c6 08             	test   $0x8,%dh
+  802008:	74 15                	je     80201f <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80200a:	89 c2                	mov    %eax,%edx
+  80200c:	c1 ea 08             	shr    $0x8,%edx
+  80200f:	83 e2 0f             	and    $0xf,%edx
+  802012:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802017:	83 fa 06             	cmp    $0x6,%edx
+  80201a:	74 0e                	je     80202a <sys_shm_create+0x7a>
+  80201c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80201f:	0f b6 c9             	movzbl %cl,%ecx
+  802022:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802028:	eb 98                	jmp    801fc2 <sys_shm_create+0x12>
+  80202a:	89 c2                	mov    %eax,%edx
+  80202c:	c1 ea 04             	shr    $0x4,%edx
+  80202f:	83 e2 0f             	and    $0xf,%edx
+  802032:	83 fa 02             	cmp    $0x2,%edx
+  802035:	77 e5                	ja     80201c <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  802037:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80203a:	83 f8 02             	cmp    $0x2,%eax
+  80203d:	0f 97 c1             	seta   %cl
+  802040:	0f b6 c9             	movzbl %cl,%ecx
+  802043:	eb d7                	jmp    80201c <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  802045:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80204a:	b8 15 00 00 00       	mov    $0x15,%eax
+  80204f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802052:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802055:	89 df                	mov    %ebx,%edi
+  802057:	89 de                	mov    %ebx,%esi
+  802059:	cd 30                	int    $0x30
+  80205b:	eb 90                	jmp    801fed <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80205d:	83 ec 0c             	sub    $0xc,%esp
+  802060:	50                   	push   %eax
+  802061:	6a 15                	push   $0x15
+  802063:	68 39 36 80 00       	push   $0x803639
+  802068:	6a 4a                	push   $0x4a
+  80206a:	68 56 36 80 00       	push   $0x803656
+  80206f:	e8 e5 e1 ff ff       	call   800259 <_panic>
+
+00802074 <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  802074:	55                   	push   %ebp
+  802075:	89 e5                	mov    %esp,%ebp
+  802077:	57                   	push   %edi
+  802078:	56                   	push   %esi
+  802079:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80207a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802081:	78 32                	js     8020b5 <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  802083:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80208a:	74 75                	je     802101 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  80208c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80208f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802092:	b8 16 00 00 00       	mov    $0x16,%eax
+  802097:	be 00 00 00 00       	mov    $0x0,%esi
+  80209c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80209f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8020a2:	55                   	push   %ebp
+  8020a3:	68 ac 20 80 00       	push   $0x8020ac
+  8020a8:	89 e5                	mov    %esp,%ebp
+  8020aa:	0f 34                	sysenter
+  8020ac:	83 c4 04             	add    $0x4,%esp
+  8020af:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  8020b0:	5b                   	pop    %ebx
+  8020b1:	5e                   	pop    %esi
+  8020b2:	5f                   	pop    %edi
+  8020b3:	5d                   	pop    %ebp
+  8020b4:	c3                   	ret
+  8020b5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020ba:	0f a2                	cpuid
+		return 0;
+  8020bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8020c1:	f6 c6 08             	test   $0x8,%dh
+  8020c4:	74 15                	je     8020db <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020c6:	89 c2                	mov    %eax,%edx
+  8020c8:	c1 ea 08             	shr    $0x8,%edx
+  8020cb:	83 e2 0f             	and    $0xf,%edx
+  8020ce:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8020d3:	83 fa 06             	cmp    $0x6,%edx
+  8020d6:	74 0e                	je     8020e6 <sys_shm_attach+0x72>
+  8020d8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8020db:	0f b6 c9             	movzbl %cl,%ecx
+  8020de:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8020e4:	eb 9d                	jmp    802083 <sys_shm_attach+0xf>
+  8020e6:	89 c2                	mov    %eax,%edx
+  8020e8:	c1 ea 04             	shr    $0x4,%edx
+  8020eb:	83 e2 0f             	and    $0xf,%edx
+  8020ee:	83 fa 02             	cmp    $0x2,%edx
+  8020f1:	77 e5                	ja     8020d8 <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  8020f3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020f6:	83 f8 02             	cmp    $0x2,%eax
+  8020f9:	0f 97 c1             	seta   %cl
+  8020fc:	0f b6 c9             	movzbl %cl,%ecx
+  8020ff:	eb d7                	jmp    8020d8 <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  802101:	b8 16 00 00 00       	mov    $0x16,%eax
+  802106:	be 00 00 00 00       	mov    $0x0,%esi
+  80210b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80210e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802111:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802114:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802117:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  802119:	eb 95                	jmp    8020b0 <sys_shm_attach+0x3c>
+
+0080211b <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  80211b:	55                   	push   %ebp
+  80211c:	89 e5                	mov    %esp,%ebp
+  80211e:	57                   	push   %edi
+  80211f:	56                   	push   %esi
+  802120:	53                   	push   %ebx
+  802121:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802124:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80212b:	78 38                	js     802165 <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  80212d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802134:	74 7b                	je     8021b1 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  802136:	be 00 00 00 00       	mov    $0x0,%esi
+  80213b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80213e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802141:	b8 17 00 00 00       	mov    $0x17,%eax
+  802146:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802149:	89 f7                	mov    %esi,%edi
+  80214b:	55                   	push   %ebp
+  80214c:	68 55 21 80 00       	push   $0x802155
+  802151:	89 e5                	mov    %esp,%ebp
+  802153:	0f 34                	sysenter
+  802155:	83 c4 04             	add    $0x4,%esp
+  802158:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802159:	85 c0                	test   %eax,%eax
+  80215b:	7f 6d                	jg     8021ca <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  80215d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802160:	5b                   	pop    %ebx
+  802161:	5e                   	pop    %esi
+  802162:	5f                   	pop    %edi
+  802163:	5d                   	pop    %ebp
+  802164:	c3                   	ret
+  802165:	b8 01 00 00 00       	mov    $0x1,%eax
+  80216a:	0f a2                	cpuid
+		return 0;
+  80216c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802171:	f6 c6 08             	test   $0x8,%dh
+  802174:	74 15                	je     80218b <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802176:	89 c2                	mov    %eax,%edx
+  802178:	c1 ea 08             	shr    $0x8,%edx
+  80217b:	83 e2 0f             	and    $0xf,%edx
+  80217e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802183:	83 fa 06             	cmp    $0x6,%edx
+  802186:	74 0e                	je     802196 <sys_shm_detach+0x7b>
+  802188:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80218b:	0f b6 c9             	movzbl %cl,%ecx
+  80218e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802194:	eb 97                	jmp    80212d <sys_shm_detach+0x12>
+  802196:	89 c2                	mov    %eax,%edx
+  802198:	c1 ea 04             	shr    $0x4,%edx
+  80219b:	83 e2 0f             	and    $0xf,%edx
+  80219e:	83 fa 02             	cmp    $0x2,%edx
+  8021a1:	77 e5                	ja     802188 <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  8021a3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021a6:	83 f8 02             	cmp    $0x2,%eax
+  8021a9:	0f 97 c1             	seta   %cl
+  8021ac:	0f b6 c9             	movzbl %cl,%ecx
+  8021af:	eb d7                	jmp    802188 <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  8021b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8021b6:	b8 17 00 00 00       	mov    $0x17,%eax
+  8021bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021c1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8021c4:	89 f7                	mov    %esi,%edi
+  8021c6:	cd 30                	int    $0x30
+  8021c8:	eb 8f                	jmp    802159 <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8021ca:	83 ec 0c             	sub    $0xc,%esp
+  8021cd:	50                   	push   %eax
+  8021ce:	6a 17                	push   $0x17
+  8021d0:	68 39 36 80 00       	push   $0x803639
+  8021d5:	6a 4a                	push   $0x4a
+  8021d7:	68 56 36 80 00       	push   $0x803656
+  8021dc:	e8 78 e0 ff ff       	call   800259 <_panic>
+
+008021e1 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  8021e1:	55                   	push   %ebp
+  8021e2:	89 e5                	mov    %esp,%ebp
+  8021e4:	57                   	push   %edi
+  8021e5:	56                   	push   %esi
+  8021e6:	53                   	push   %ebx
+  8021e7:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8021ea:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8021f1:	78 36                	js     802229 <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  8021f3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8021fa:	74 79                	je     802275 <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  8021fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802204:	b8 18 00 00 00       	mov    $0x18,%eax
+  802209:	89 cb                	mov    %ecx,%ebx
+  80220b:	89 cf                	mov    %ecx,%edi
+  80220d:	89 ce                	mov    %ecx,%esi
+  80220f:	55                   	push   %ebp
+  802210:	68 19 22 80 00       	push   $0x802219
+  802215:	89 e5                	mov    %esp,%ebp
+  802217:	0f 34                	sysenter
+  802219:	83 c4 04             	add    $0x4,%esp
+  80221c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80221d:	85 c0                	test   %eax,%eax
+  80221f:	7f 6b                	jg     80228c <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  802221:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802224:	5b                   	pop    %ebx
+  802225:	5e                   	pop    %esi
+  802226:	5f                   	pop    %edi
+  802227:	5d                   	pop    %ebp
+  802228:	c3                   	ret
+  802229:	b8 01 00 00 00       	mov    $0x1,%eax
+  80222e:	0f a2                	cpuid
+		return 0;
+  802230:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802235:	f6 c6 08             	test   $0x8,%dh
+  802238:	74 15                	je     80224f <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80223a:	89 c2                	mov    %eax,%edx
+  80223c:	c1 ea 08             	shr    $0x8,%edx
+  80223f:	83 e2 0f             	and    $0xf,%edx
+  802242:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802247:	83 fa 06             	cmp    $0x6,%edx
+  80224a:	74 0e                	je     80225a <sys_shm_remove+0x79>
+  80224c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80224f:	0f b6 c9             	movzbl %cl,%ecx
+  802252:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802258:	eb 99                	jmp    8021f3 <sys_shm_remove+0x12>
+  80225a:	89 c2                	mov    %eax,%edx
+  80225c:	c1 ea 04             	shr    $0x4,%edx
+  80225f:	83 e2 0f             	and    $0xf,%edx
+  802262:	83 fa 02             	cmp    $0x2,%edx
+  802265:	77 e5                	ja     80224c <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  802267:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80226a:	83 f8 02             	cmp    $0x2,%eax
+  80226d:	0f 97 c1             	seta   %cl
+  802270:	0f b6 c9             	movzbl %cl,%ecx
+  802273:	eb d7                	jmp    80224c <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  802275:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80227a:	b8 18 00 00 00       	mov    $0x18,%eax
+  80227f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802282:	89 cb                	mov    %ecx,%ebx
+  802284:	89 cf                	mov    %ecx,%edi
+  802286:	89 ce                	mov    %ecx,%esi
+  802288:	cd 30                	int    $0x30
+  80228a:	eb 91                	jmp    80221d <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80228c:	83 ec 0c             	sub    $0xc,%esp
+  80228f:	50                   	push   %eax
+  802290:	6a 18                	push   $0x18
+  802292:	68 39 36 80 00       	push   $0x803639
+  802297:	6a 4a                	push   $0x4a
+  802299:	68 56 36 80 00       	push   $0x803656
+  80229e:	e8 b6 df ff ff       	call   800259 <_panic>
+
+008022a3 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  8022a3:	55                   	push   %ebp
+  8022a4:	89 e5                	mov    %esp,%ebp
+  8022a6:	57                   	push   %edi
+  8022a7:	56                   	push   %esi
+  8022a8:	53                   	push   %ebx
+  8022a9:	83 ec 0c             	sub    $0xc,%esp
+  8022ac:	8b 45 10             	mov    0x10(%ebp),%eax
+  8022af:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8022b2:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  8022b5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8022bc:	78 32                	js     8022f0 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  8022be:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8022c5:	74 75                	je     80233c <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  8022c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022cd:	b8 20 00 00 00       	mov    $0x20,%eax
+  8022d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8022d7:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8022da:	55                   	push   %ebp
+  8022db:	68 e4 22 80 00       	push   $0x8022e4
+  8022e0:	89 e5                	mov    %esp,%ebp
+  8022e2:	0f 34                	sysenter
+  8022e4:	83 c4 04             	add    $0x4,%esp
+  8022e7:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  8022e8:	83 c4 0c             	add    $0xc,%esp
+  8022eb:	5b                   	pop    %ebx
+  8022ec:	5e                   	pop    %esi
+  8022ed:	5f                   	pop    %edi
+  8022ee:	5d                   	pop    %ebp
+  8022ef:	c3                   	ret
+  8022f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022f5:	0f a2                	cpuid
+		return 0;
+  8022f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8022fc:	f6 c6 08             	test   $0x8,%dh
+  8022ff:	74 15                	je     802316 <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802301:	89 c2                	mov    %eax,%edx
+  802303:	c1 ea 08             	shr    $0x8,%edx
+  802306:	83 e2 0f             	and    $0xf,%edx
+  802309:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80230e:	83 fa 06             	cmp    $0x6,%edx
+  802311:	74 0e                	je     802321 <sys_futex_wait+0x7e>
+  802313:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802316:	0f b6 c9             	movzbl %cl,%ecx
+  802319:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80231f:	eb 9d                	jmp    8022be <sys_futex_wait+0x1b>
+  802321:	89 c2                	mov    %eax,%edx
+  802323:	c1 ea 04             	shr    $0x4,%edx
+  802326:	83 e2 0f             	and    $0xf,%edx
+  802329:	83 fa 02             	cmp    $0x2,%edx
+  80232c:	77 e5                	ja     802313 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  80232e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802331:	83 f8 02             	cmp    $0x2,%eax
+  802334:	0f 97 c1             	seta   %cl
+  802337:	0f b6 c9             	movzbl %cl,%ecx
+  80233a:	eb d7                	jmp    802313 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  80233c:	b8 20 00 00 00       	mov    $0x20,%eax
+  802341:	be 00 00 00 00       	mov    $0x0,%esi
+  802346:	8b 55 08             	mov    0x8(%ebp),%edx
+  802349:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80234c:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  80234f:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  802351:	eb 95                	jmp    8022e8 <sys_futex_wait+0x45>
+
+00802353 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  802353:	55                   	push   %ebp
+  802354:	89 e5                	mov    %esp,%ebp
+  802356:	57                   	push   %edi
+  802357:	56                   	push   %esi
+  802358:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802359:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802360:	78 30                	js     802392 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  802362:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802369:	74 73                	je     8023de <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  80236b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802370:	8b 55 08             	mov    0x8(%ebp),%edx
+  802373:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802376:	b8 21 00 00 00       	mov    $0x21,%eax
+  80237b:	89 df                	mov    %ebx,%edi
+  80237d:	89 de                	mov    %ebx,%esi
+  80237f:	55                   	push   %ebp
+  802380:	68 89 23 80 00       	push   $0x802389
+  802385:	89 e5                	mov    %esp,%ebp
+  802387:	0f 34                	sysenter
+  802389:	83 c4 04             	add    $0x4,%esp
+  80238c:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80238d:	5b                   	pop    %ebx
+  80238e:	5e                   	pop    %esi
+  80238f:	5f                   	pop    %edi
+  802390:	5d                   	pop    %ebp
+  802391:	c3                   	ret
+  802392:	b8 01 00 00 00       	mov    $0x1,%eax
+  802397:	0f a2                	cpuid
+		return 0;
+  802399:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80239e:	f6 c6 08             	test   $0x8,%dh
+  8023a1:	74 15                	je     8023b8 <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023a3:	89 c2                	mov    %eax,%edx
+  8023a5:	c1 ea 08             	shr    $0x8,%edx
+  8023a8:	83 e2 0f             	and    $0xf,%edx
+  8023ab:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8023b0:	83 fa 06             	cmp    $0x6,%edx
+  8023b3:	74 0e                	je     8023c3 <sys_futex_wake+0x70>
+  8023b5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8023b8:	0f b6 c9             	movzbl %cl,%ecx
+  8023bb:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8023c1:	eb 9f                	jmp    802362 <sys_futex_wake+0xf>
+  8023c3:	89 c2                	mov    %eax,%edx
+  8023c5:	c1 ea 04             	shr    $0x4,%edx
+  8023c8:	83 e2 0f             	and    $0xf,%edx
+  8023cb:	83 fa 02             	cmp    $0x2,%edx
+  8023ce:	77 e5                	ja     8023b5 <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  8023d0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023d3:	83 f8 02             	cmp    $0x2,%eax
+  8023d6:	0f 97 c1             	seta   %cl
+  8023d9:	0f b6 c9             	movzbl %cl,%ecx
+  8023dc:	eb d7                	jmp    8023b5 <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  8023de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023e3:	b8 21 00 00 00       	mov    $0x21,%eax
+  8023e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023ee:	89 df                	mov    %ebx,%edi
+  8023f0:	89 de                	mov    %ebx,%esi
+  8023f2:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  8023f4:	eb 97                	jmp    80238d <sys_futex_wake+0x3a>
+
+008023f6 <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  8023f6:	55                   	push   %ebp
+  8023f7:	89 e5                	mov    %esp,%ebp
+  8023f9:	57                   	push   %edi
+  8023fa:	56                   	push   %esi
+  8023fb:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8023fc:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802403:	78 2e                	js     802433 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  802405:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80240c:	74 71                	je     80247f <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  80240e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802413:	b8 22 00 00 00       	mov    $0x22,%eax
+  802418:	89 d1                	mov    %edx,%ecx
+  80241a:	89 d3                	mov    %edx,%ebx
+  80241c:	89 d7                	mov    %edx,%edi
+  80241e:	89 d6                	mov    %edx,%esi
+  802420:	55                   	push   %ebp
+  802421:	68 2a 24 80 00       	push   $0x80242a
+  802426:	89 e5                	mov    %esp,%ebp
+  802428:	0f 34                	sysenter
+  80242a:	83 c4 04             	add    $0x4,%esp
+  80242d:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  80242e:	5b                   	pop    %ebx
+  80242f:	5e                   	pop    %esi
+  802430:	5f                   	pop    %edi
+  802431:	5d                   	pop    %ebp
+  802432:	c3                   	ret
+  802433:	b8 01 00 00 00       	mov    $0x1,%eax
+  802438:	0f a2                	cpuid
+		return 0;
+  80243a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80243f:	f6 c6 08             	test   $0x8,%dh
+  802442:	74 15                	je     802459 <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802444:	89 c2                	mov    %eax,%edx
+  802446:	c1 ea 08             	shr    $0x8,%edx
+  802449:	83 e2 0f             	and    $0xf,%edx
+  80244c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802451:	83 fa 06             	cmp    $0x6,%edx
+  802454:	74 0e                	je     802464 <sys_ep_create+0x6e>
+  802456:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802459:	0f b6 c9             	movzbl %cl,%ecx
+  80245c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802462:	eb a1                	jmp    802405 <sys_ep_create+0xf>
+  802464:	89 c2                	mov    %eax,%edx
+  802466:	c1 ea 04             	shr    $0x4,%edx
+  802469:	83 e2 0f             	and    $0xf,%edx
+  80246c:	83 fa 02             	cmp    $0x2,%edx
+  80246f:	77 e5                	ja     802456 <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  802471:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802474:	83 f8 02             	cmp    $0x2,%eax
+  802477:	0f 97 c1             	seta   %cl
+  80247a:	0f b6 c9             	movzbl %cl,%ecx
+  80247d:	eb d7                	jmp    802456 <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  80247f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802484:	b8 22 00 00 00       	mov    $0x22,%eax
+  802489:	89 d1                	mov    %edx,%ecx
+  80248b:	89 d3                	mov    %edx,%ebx
+  80248d:	89 d7                	mov    %edx,%edi
+  80248f:	89 d6                	mov    %edx,%esi
+  802491:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  802493:	eb 99                	jmp    80242e <sys_ep_create+0x38>
+
+00802495 <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  802495:	55                   	push   %ebp
+  802496:	89 e5                	mov    %esp,%ebp
+  802498:	57                   	push   %edi
+  802499:	56                   	push   %esi
+  80249a:	53                   	push   %ebx
+  80249b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80249e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8024a5:	78 36                	js     8024dd <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  8024a7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8024ae:	74 79                	je     802529 <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  8024b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024b8:	b8 23 00 00 00       	mov    $0x23,%eax
+  8024bd:	89 cb                	mov    %ecx,%ebx
+  8024bf:	89 cf                	mov    %ecx,%edi
+  8024c1:	89 ce                	mov    %ecx,%esi
+  8024c3:	55                   	push   %ebp
+  8024c4:	68 cd 24 80 00       	push   $0x8024cd
+  8024c9:	89 e5                	mov    %esp,%ebp
+  8024cb:	0f 34                	sysenter
+  8024cd:	83 c4 04             	add    $0x4,%esp
+  8024d0:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8024d1:	85 c0                	test   %eax,%eax
+  8024d3:	7f 6b                	jg     802540 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  8024d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024d8:	5b                   	pop    %ebx
+  8024d9:	5e                   	pop    %esi
+  8024da:	5f                   	pop    %edi
+  8024db:	5d                   	pop    %ebp
+  8024dc:	c3                   	ret
+  8024dd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024e2:	0f a2                	cpuid
+		return 0;
+  8024e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8024e9:	f6 c6 08             	test   $0x8,%dh
+  8024ec:	74 15                	je     802503 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8024ee:	89 c2                	mov    %eax,%edx
+  8024f0:	c1 ea 08             	shr    $0x8,%edx
+  8024f3:	83 e2 0f             	and    $0xf,%edx
+  8024f6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8024fb:	83 fa 06             	cmp    $0x6,%edx
+  8024fe:	74 0e                	je     80250e <sys_ep_destroy+0x79>
+  802500:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802503:	0f b6 c9             	movzbl %cl,%ecx
+  802506:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80250c:	eb 99                	jmp    8024a7 <sys_ep_destroy+0x12>
+  80250e:	89 c2                	mov    %eax,%edx
+  802510:	c1 ea 04             	shr    $0x4,%edx
+  802513:	83 e2 0f             	and    $0xf,%edx
+  802516:	83 fa 02             	cmp    $0x2,%edx
+  802519:	77 e5                	ja     802500 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  80251b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80251e:	83 f8 02             	cmp    $0x2,%eax
+  802521:	0f 97 c1             	seta   %cl
+  802524:	0f b6 c9             	movzbl %cl,%ecx
+  802527:	eb d7                	jmp    802500 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  802529:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80252e:	b8 23 00 00 00       	mov    $0x23,%eax
+  802533:	8b 55 08             	mov    0x8(%ebp),%edx
+  802536:	89 cb                	mov    %ecx,%ebx
+  802538:	89 cf                	mov    %ecx,%edi
+  80253a:	89 ce                	mov    %ecx,%esi
+  80253c:	cd 30                	int    $0x30
+  80253e:	eb 91                	jmp    8024d1 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802540:	83 ec 0c             	sub    $0xc,%esp
+  802543:	50                   	push   %eax
+  802544:	6a 23                	push   $0x23
+  802546:	68 39 36 80 00       	push   $0x803639
+  80254b:	6a 4a                	push   $0x4a
+  80254d:	68 56 36 80 00       	push   $0x803656
+  802552:	e8 02 dd ff ff       	call   800259 <_panic>
+
+00802557 <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  802557:	55                   	push   %ebp
+  802558:	89 e5                	mov    %esp,%ebp
+  80255a:	57                   	push   %edi
+  80255b:	56                   	push   %esi
+  80255c:	53                   	push   %ebx
+  80255d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802560:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802567:	78 37                	js     8025a0 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  802569:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802570:	74 7a                	je     8025ec <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  802572:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802577:	8b 55 08             	mov    0x8(%ebp),%edx
+  80257a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80257d:	b8 24 00 00 00       	mov    $0x24,%eax
+  802582:	89 df                	mov    %ebx,%edi
+  802584:	89 de                	mov    %ebx,%esi
+  802586:	55                   	push   %ebp
+  802587:	68 90 25 80 00       	push   $0x802590
+  80258c:	89 e5                	mov    %esp,%ebp
+  80258e:	0f 34                	sysenter
+  802590:	83 c4 04             	add    $0x4,%esp
+  802593:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802594:	85 c0                	test   %eax,%eax
+  802596:	7f 6c                	jg     802604 <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  802598:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80259b:	5b                   	pop    %ebx
+  80259c:	5e                   	pop    %esi
+  80259d:	5f                   	pop    %edi
+  80259e:	5d                   	pop    %ebp
+  80259f:	c3                   	ret
+  8025a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025a5:	0f a2                	cpuid
+		return 0;
+  8025a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8025ac:	f6 c6 08             	test   $0x8,%dh
+  8025af:	74 15                	je     8025c6 <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025b1:	89 c2                	mov    %eax,%edx
+  8025b3:	c1 ea 08             	shr    $0x8,%edx
+  8025b6:	83 e2 0f             	and    $0xf,%edx
+  8025b9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8025be:	83 fa 06             	cmp    $0x6,%edx
+  8025c1:	74 0e                	je     8025d1 <sys_ep_grant+0x7a>
+  8025c3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8025c6:	0f b6 c9             	movzbl %cl,%ecx
+  8025c9:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8025cf:	eb 98                	jmp    802569 <sys_ep_grant+0x12>
+  8025d1:	89 c2                	mov    %eax,%edx
+  8025d3:	c1 ea 04             	shr    $0x4,%edx
+  8025d6:	83 e2 0f             	and    $0xf,%edx
+  8025d9:	83 fa 02             	cmp    $0x2,%edx
+  8025dc:	77 e5                	ja     8025c3 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  8025de:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025e1:	83 f8 02             	cmp    $0x2,%eax
+  8025e4:	0f 97 c1             	seta   %cl
+  8025e7:	0f b6 c9             	movzbl %cl,%ecx
+  8025ea:	eb d7                	jmp    8025c3 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  8025ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025f1:	b8 24 00 00 00       	mov    $0x24,%eax
+  8025f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025fc:	89 df                	mov    %ebx,%edi
+  8025fe:	89 de                	mov    %ebx,%esi
+  802600:	cd 30                	int    $0x30
+  802602:	eb 90                	jmp    802594 <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802604:	83 ec 0c             	sub    $0xc,%esp
+  802607:	50                   	push   %eax
+  802608:	6a 24                	push   $0x24
+  80260a:	68 39 36 80 00       	push   $0x803639
+  80260f:	6a 4a                	push   $0x4a
+  802611:	68 56 36 80 00       	push   $0x803656
+  802616:	e8 3e dc ff ff       	call   800259 <_panic>
+
+0080261b <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  80261b:	55                   	push   %ebp
+  80261c:	89 e5                	mov    %esp,%ebp
+  80261e:	57                   	push   %edi
+  80261f:	56                   	push   %esi
+  802620:	53                   	push   %ebx
+  802621:	83 ec 20             	sub    $0x20,%esp
+  802624:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  802627:	8b 10                	mov    (%eax),%edx
+  802629:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  80262c:	8b 50 04             	mov    0x4(%eax),%edx
+  80262f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802632:	8b 50 08             	mov    0x8(%eax),%edx
+  802635:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  802638:	8b 50 0c             	mov    0xc(%eax),%edx
+  80263b:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  80263e:	8b 40 10             	mov    0x10(%eax),%eax
+  802641:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  802644:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  802647:	8b 55 08             	mov    0x8(%ebp),%edx
+  80264a:	b8 25 00 00 00       	mov    $0x25,%eax
+  80264f:	55                   	push   %ebp
+  802650:	56                   	push   %esi
+  802651:	8b 0e                	mov    (%esi),%ecx
+  802653:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802656:	8b 7e 08             	mov    0x8(%esi),%edi
+  802659:	8b 6e 10             	mov    0x10(%esi),%ebp
+  80265c:	8b 76 0c             	mov    0xc(%esi),%esi
+  80265f:	cd 30                	int    $0x30
+  802661:	87 34 24             	xchg   %esi,(%esp)
+  802664:	89 0e                	mov    %ecx,(%esi)
+  802666:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802669:	89 7e 08             	mov    %edi,0x8(%esi)
+  80266c:	89 6e 10             	mov    %ebp,0x10(%esi)
+  80266f:	8f 46 0c             	pop    0xc(%esi)
+  802672:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  802673:	83 c4 20             	add    $0x20,%esp
+  802676:	5b                   	pop    %ebx
+  802677:	5e                   	pop    %esi
+  802678:	5f                   	pop    %edi
+  802679:	5d                   	pop    %ebp
+  80267a:	c3                   	ret
+
+0080267b <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  80267b:	55                   	push   %ebp
+  80267c:	89 e5                	mov    %esp,%ebp
+  80267e:	57                   	push   %edi
+  80267f:	56                   	push   %esi
+  802680:	53                   	push   %ebx
+  802681:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  802684:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802687:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  802689:	8b 55 08             	mov    0x8(%ebp),%edx
+  80268c:	b8 26 00 00 00       	mov    $0x26,%eax
+  802691:	55                   	push   %ebp
+  802692:	56                   	push   %esi
+  802693:	8b 0e                	mov    (%esi),%ecx
+  802695:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802698:	8b 7e 08             	mov    0x8(%esi),%edi
+  80269b:	8b 6e 10             	mov    0x10(%esi),%ebp
+  80269e:	8b 76 0c             	mov    0xc(%esi),%esi
+  8026a1:	cd 30                	int    $0x30
+  8026a3:	87 34 24             	xchg   %esi,(%esp)
+  8026a6:	89 0e                	mov    %ecx,(%esi)
+  8026a8:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8026ab:	89 7e 08             	mov    %edi,0x8(%esi)
+  8026ae:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8026b1:	8f 46 0c             	pop    0xc(%esi)
+  8026b4:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  8026b5:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  8026b9:	74 0f                	je     8026ca <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  8026bb:	85 c0                	test   %eax,%eax
+  8026bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026c2:	0f 48 d1             	cmovs  %ecx,%edx
+  8026c5:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8026c8:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  8026ca:	5b                   	pop    %ebx
+  8026cb:	5e                   	pop    %esi
+  8026cc:	5f                   	pop    %edi
+  8026cd:	5d                   	pop    %ebp
+  8026ce:	c3                   	ret
+
+008026cf <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  8026cf:	55                   	push   %ebp
+  8026d0:	89 e5                	mov    %esp,%ebp
+  8026d2:	57                   	push   %edi
+  8026d3:	56                   	push   %esi
+  8026d4:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8026d5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8026dc:	78 2f                	js     80270d <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  8026de:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8026e5:	74 72                	je     802759 <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  8026e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8026ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026ef:	b8 27 00 00 00       	mov    $0x27,%eax
+  8026f4:	89 cb                	mov    %ecx,%ebx
+  8026f6:	89 cf                	mov    %ecx,%edi
+  8026f8:	89 ce                	mov    %ecx,%esi
+  8026fa:	55                   	push   %ebp
+  8026fb:	68 04 27 80 00       	push   $0x802704
+  802700:	89 e5                	mov    %esp,%ebp
+  802702:	0f 34                	sysenter
+  802704:	83 c4 04             	add    $0x4,%esp
+  802707:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  802708:	5b                   	pop    %ebx
+  802709:	5e                   	pop    %esi
+  80270a:	5f                   	pop    %edi
+  80270b:	5d                   	pop    %ebp
+  80270c:	c3                   	ret
+  80270d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802712:	0f a2                	cpuid
+		return 0;
+  802714:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802719:	f6 c6 08             	test   $0x8,%dh
+  80271c:	74 15                	je     802733 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80271e:	89 c2                	mov    %eax,%edx
+  802720:	c1 ea 08             	shr    $0x8,%edx
+  802723:	83 e2 0f             	and    $0xf,%edx
+  802726:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80272b:	83 fa 06             	cmp    $0x6,%edx
+  80272e:	74 0e                	je     80273e <sys_sysring_setup+0x6f>
+  802730:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802733:	0f b6 c9             	movzbl %cl,%ecx
+  802736:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80273c:	eb a0                	jmp    8026de <sys_sysring_setup+0xf>
+  80273e:	89 c2                	mov    %eax,%edx
+  802740:	c1 ea 04             	shr    $0x4,%edx
+  802743:	83 e2 0f             	and    $0xf,%edx
+  802746:	83 fa 02             	cmp    $0x2,%edx
+  802749:	77 e5                	ja     802730 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  80274b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80274e:	83 f8 02             	cmp    $0x2,%eax
+  802751:	0f 97 c1             	seta   %cl
+  802754:	0f b6 c9             	movzbl %cl,%ecx
+  802757:	eb d7                	jmp    802730 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  802759:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80275e:	b8 27 00 00 00       	mov    $0x27,%eax
+  802763:	8b 55 08             	mov    0x8(%ebp),%edx
+  802766:	89 cb                	mov    %ecx,%ebx
+  802768:	89 cf                	mov    %ecx,%edi
+  80276a:	89 ce                	mov    %ecx,%esi
+  80276c:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  80276e:	eb 98                	jmp    802708 <sys_sysring_setup+0x39>
+
+00802770 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  802770:	55                   	push   %ebp
+  802771:	89 e5                	mov    %esp,%ebp
+  802773:	57                   	push   %edi
+  802774:	56                   	push   %esi
+  802775:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802776:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80277d:	78 2e                	js     8027ad <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  80277f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802786:	74 71                	je     8027f9 <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  802788:	ba 00 00 00 00       	mov    $0x0,%edx
+  80278d:	b8 28 00 00 00       	mov    $0x28,%eax
+  802792:	89 d1                	mov    %edx,%ecx
+  802794:	89 d3                	mov    %edx,%ebx
+  802796:	89 d7                	mov    %edx,%edi
+  802798:	89 d6                	mov    %edx,%esi
+  80279a:	55                   	push   %ebp
+  80279b:	68 a4 27 80 00       	push   $0x8027a4
+  8027a0:	89 e5                	mov    %esp,%ebp
+  8027a2:	0f 34                	sysenter
+  8027a4:	83 c4 04             	add    $0x4,%esp
+  8027a7:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8027a8:	5b                   	pop    %ebx
+  8027a9:	5e                   	pop    %esi
+  8027aa:	5f                   	pop    %edi
+  8027ab:	5d                   	pop    %ebp
+  8027ac:	c3                   	ret
+  8027ad:	b8 01 00 00 00       	mov    $0x1,%eax
+  8027b2:	0f a2                	cpuid
+		return 0;
+  8027b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8027b9:	f6 c6 08             	test   $0x8,%dh
+  8027bc:	74 15                	je     8027d3 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8027be:	89 c2                	mov    %eax,%edx
+  8027c0:	c1 ea 08             	shr    $0x8,%edx
+  8027c3:	83 e2 0f             	and    $0xf,%edx
+  8027c6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8027cb:	83 fa 06             	cmp    $0x6,%edx
+  8027ce:	74 0e                	je     8027de <sys_sysring_enter+0x6e>
+  8027d0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8027d3:	0f b6 c9             	movzbl %cl,%ecx
+  8027d6:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8027dc:	eb a1                	jmp    80277f <sys_sysring_enter+0xf>
+  8027de:	89 c2                	mov    %eax,%edx
+  8027e0:	c1 ea 04             	shr    $0x4,%edx
+  8027e3:	83 e2 0f             	and    $0xf,%edx
+  8027e6:	83 fa 02             	cmp    $0x2,%edx
+  8027e9:	77 e5                	ja     8027d0 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  8027eb:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8027ee:	83 f8 02             	cmp    $0x2,%eax
+  8027f1:	0f 97 c1             	seta   %cl
+  8027f4:	0f b6 c9             	movzbl %cl,%ecx
+  8027f7:	eb d7                	jmp    8027d0 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  8027f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027fe:	b8 28 00 00 00       	mov    $0x28,%eax
+  802803:	89 d1                	mov    %edx,%ecx
+  802805:	89 d3                	mov    %edx,%ebx
+  802807:	89 d7                	mov    %edx,%edi
+  802809:	89 d6                	mov    %edx,%esi
+  80280b:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  80280d:	eb 99                	jmp    8027a8 <sys_sysring_enter+0x38>
+
+0080280f <pgfault>:
+// The kernel normally resolves these faults itself (page_fault_cow in
+// kern/trap.c); we only get here if it ran out of memory doing so.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  80280f:	55                   	push   %ebp
+  802810:	89 e5                	mov    %esp,%ebp
+  802812:	83 ec 08             	sub    $0x8,%esp
+  802815:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  802818:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  80281a:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  80281d:	f6 c2 02             	test   $0x2,%dl
+  802820:	74 40                	je     802862 <pgfault+0x53>
+  802822:	89 c1                	mov    %eax,%ecx
+  802824:	c1 e9 16             	shr    $0x16,%ecx
+  802827:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  80282e:	f6 c1 01             	test   $0x1,%cl
+  802831:	74 2f                	je     802862 <pgfault+0x53>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW))
+  802833:	89 c1                	mov    %eax,%ecx
+  802835:	c1 e9 0c             	shr    $0xc,%ecx
+  802838:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  80283f:	f6 c5 08             	test   $0x8,%ch
+  802842:	74 1e                	je     802862 <pgfault+0x53>
+	// Replace the page with a private writable copy of itself.  The
+	// kernel allocates, copies and maps it in one system call, so no
+	// temporary mapping at PFTEMP is needed.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  802844:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r = sys_page_copy(0, addr, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  802849:	83 ec 0c             	sub    $0xc,%esp
+  80284c:	6a 07                	push   $0x7
+  80284e:	50                   	push   %eax
+  80284f:	6a 00                	push   $0x0
+  802851:	50                   	push   %eax
+  802852:	6a 00                	push   $0x0
+  802854:	e8 85 eb ff ff       	call   8013de <sys_page_copy>
+  802859:	83 c4 20             	add    $0x20,%esp
+  80285c:	85 c0                	test   %eax,%eax
+  80285e:	78 18                	js     802878 <pgfault+0x69>
+		panic("pgfault: sys_page_copy: %e", r);
+}
+  802860:	c9                   	leave
+  802861:	c3                   	ret
+		panic("pgfault: va %08x err %x is not a copy-on-write write",
+  802862:	83 ec 0c             	sub    $0xc,%esp
+  802865:	52                   	push   %edx
+  802866:	50                   	push   %eax
+  802867:	68 64 36 80 00       	push   $0x803664
+  80286c:	6a 1c                	push   $0x1c
+  80286e:	68 99 36 80 00       	push   $0x803699
+  802873:	e8 e1 d9 ff ff       	call   800259 <_panic>
+		panic("pgfault: sys_page_copy: %e", r);
+  802878:	50                   	push   %eax
+  802879:	68 a4 36 80 00       	push   $0x8036a4
+  80287e:	6a 26                	push   $0x26
+  802880:	68 99 36 80 00       	push   $0x803699
+  802885:	e8 cf d9 ff ff       	call   800259 <_panic>
+
+0080288a <ufork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+ufork(void)
+{
+  80288a:	55                   	push   %ebp
+  80288b:	89 e5                	mov    %esp,%ebp
+  80288d:	57                   	push   %edi
+  80288e:	56                   	push   %esi
+  80288f:	53                   	push   %ebx
+  802890:	81 ec 38 04 00 00    	sub    $0x438,%esp
+	struct page_range vec[PAGE_VEC_MAX], *last;
+	uintptr_t va;
+	size_t n;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  802896:	68 0f 28 80 00       	push   $0x80280f
+  80289b:	e8 40 07 00 00       	call   802fe0 <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8028a0:	b8 07 00 00 00       	mov    $0x7,%eax
+  8028a5:	cd 30                	int    $0x30
+  8028a7:	89 85 d4 fb ff ff    	mov    %eax,-0x42c(%ebp)
+
+	envid = sys_exofork();
+	if (envid < 0)
+  8028ad:	83 c4 10             	add    $0x10,%esp
+  8028b0:	85 c0                	test   %eax,%eax
+  8028b2:	0f 88 f2 01 00 00    	js     802aaa <ufork+0x220>
+		return 0;
+	}
+
+	// Copy every run of mapped pages below the exception stack, which
+	// must not be shared.
+	va = 0;
+  8028b8:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  8028bd:	74 0b                	je     8028ca <ufork+0x40>
+  8028bf:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  8028c5:	e9 07 01 00 00       	jmp    8029d1 <ufork+0x147>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8028ca:	e8 22 e8 ff ff       	call   8010f1 <sys_getenvid>
+  8028cf:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8028d4:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  8028da:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8028df:	a3 08 40 80 00       	mov    %eax,0x804008
+		return 0;
+  8028e4:	e9 c1 01 00 00       	jmp    802aaa <ufork+0x220>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+		n = r;
+		last = &vec[n - 1];
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  8028e9:	83 ea 01             	sub    $0x1,%edx
+  8028ec:	89 c1                	mov    %eax,%ecx
+  8028ee:	c1 e1 04             	shl    $0x4,%ecx
+  8028f1:	89 94 0d ec fd ff ff 	mov    %edx,-0x214(%ebp,%ecx,1)
+			n--;
+  8028f8:	85 d2                	test   %edx,%edx
+  8028fa:	0f 44 f0             	cmove  %eax,%esi
+  8028fd:	e9 12 01 00 00       	jmp    802a14 <ufork+0x18a>
+	for (i = 0; i < n; i++) {
+  802902:	83 c1 01             	add    $0x1,%ecx
+  802905:	83 c0 10             	add    $0x10,%eax
+  802908:	39 8d e4 fb ff ff    	cmp    %ecx,-0x41c(%ebp)
+  80290e:	74 6a                	je     80297a <ufork+0xf0>
+		vec[i].pr_dstva = vec[i].pr_va;
+  802910:	89 c3                	mov    %eax,%ebx
+  802912:	8b 10                	mov    (%eax),%edx
+  802914:	89 50 0c             	mov    %edx,0xc(%eax)
+		if (vec[i].pr_perm & PTE_SHARE)
+  802917:	8b 50 08             	mov    0x8(%eax),%edx
+  80291a:	f6 c6 04             	test   $0x4,%dh
+  80291d:	75 e3                	jne    802902 <ufork+0x78>
+		if (vec[i].pr_perm & (PTE_W | PTE_COW)) {
+  80291f:	f7 c2 02 08 00 00    	test   $0x802,%edx
+  802925:	74 db                	je     802902 <ufork+0x78>
+			vec[i].pr_perm = (vec[i].pr_perm & ~PTE_W) | PTE_COW;
+  802927:	81 e2 fd f7 ff ff    	and    $0xfffff7fd,%edx
+  80292d:	80 ce 08             	or     $0x8,%dh
+  802930:	89 95 dc fb ff ff    	mov    %edx,-0x424(%ebp)
+  802936:	89 53 08             	mov    %edx,0x8(%ebx)
+			cow[ncow++] = vec[i];
+  802939:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  80293f:	c1 e6 04             	shl    $0x4,%esi
+  802942:	89 f2                	mov    %esi,%edx
+  802944:	8d b4 35 e8 fb ff ff 	lea    -0x418(%ebp,%esi,1),%esi
+  80294b:	8b 38                	mov    (%eax),%edi
+  80294d:	89 bc 15 e8 fb ff ff 	mov    %edi,-0x418(%ebp,%edx,1)
+  802954:	8b 78 04             	mov    0x4(%eax),%edi
+  802957:	89 7e 04             	mov    %edi,0x4(%esi)
+  80295a:	8b bd dc fb ff ff    	mov    -0x424(%ebp),%edi
+  802960:	89 7e 08             	mov    %edi,0x8(%esi)
+  802963:	8b 50 0c             	mov    0xc(%eax),%edx
+  802966:	89 56 0c             	mov    %edx,0xc(%esi)
+  802969:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  80296f:	8d 7e 01             	lea    0x1(%esi),%edi
+  802972:	89 bd e0 fb ff ff    	mov    %edi,-0x420(%ebp)
+  802978:	eb 88                	jmp    802902 <ufork+0x78>
+	if ((r = sys_page_map_vec(0, envid, vec, n, 0)) < 0)
+  80297a:	8b b5 e4 fb ff ff    	mov    -0x41c(%ebp),%esi
+  802980:	8b bd d8 fb ff ff    	mov    -0x428(%ebp),%edi
+  802986:	83 ec 0c             	sub    $0xc,%esp
+  802989:	6a 00                	push   $0x0
+  80298b:	56                   	push   %esi
+  80298c:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802992:	50                   	push   %eax
+  802993:	ff b5 d4 fb ff ff    	push   -0x42c(%ebp)
+  802999:	6a 00                	push   $0x0
+  80299b:	e8 80 f4 ff ff       	call   801e20 <sys_page_map_vec>
+  8029a0:	83 c4 20             	add    $0x20,%esp
+  8029a3:	85 c0                	test   %eax,%eax
+  8029a5:	0f 88 e5 00 00 00    	js     802a90 <ufork+0x206>
+	return sys_page_map_vec(0, 0, cow, ncow, 0);
+  8029ab:	83 ec 0c             	sub    $0xc,%esp
+  8029ae:	6a 00                	push   $0x0
+  8029b0:	ff b5 e0 fb ff ff    	push   -0x420(%ebp)
+  8029b6:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  8029bc:	50                   	push   %eax
+  8029bd:	6a 00                	push   $0x0
+  8029bf:	6a 00                	push   $0x0
+  8029c1:	e8 5a f4 ff ff       	call   801e20 <sys_page_map_vec>
+		if ((r = duppages(envid, vec, n)) < 0)
+  8029c6:	83 c4 20             	add    $0x20,%esp
+  8029c9:	85 c0                	test   %eax,%eax
+  8029cb:	0f 88 e7 00 00 00    	js     802ab8 <ufork+0x22e>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+  8029d1:	6a 20                	push   $0x20
+  8029d3:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  8029d9:	50                   	push   %eax
+  8029da:	57                   	push   %edi
+  8029db:	6a 00                	push   $0x0
+  8029dd:	e8 82 f4 ff ff       	call   801e64 <sys_vm_ranges>
+  8029e2:	83 c4 10             	add    $0x10,%esp
+  8029e5:	85 c0                	test   %eax,%eax
+  8029e7:	7e 51                	jle    802a3a <ufork+0x1b0>
+		n = r;
+  8029e9:	89 c6                	mov    %eax,%esi
+		last = &vec[n - 1];
+  8029eb:	83 e8 01             	sub    $0x1,%eax
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+  8029ee:	89 c1                	mov    %eax,%ecx
+  8029f0:	c1 e1 04             	shl    $0x4,%ecx
+  8029f3:	8b 94 0d ec fd ff ff 	mov    -0x214(%ebp,%ecx,1),%edx
+  8029fa:	89 d3                	mov    %edx,%ebx
+  8029fc:	c1 e3 0c             	shl    $0xc,%ebx
+  8029ff:	89 df                	mov    %ebx,%edi
+  802a01:	03 bc 0d e8 fd ff ff 	add    -0x218(%ebp,%ecx,1),%edi
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  802a08:	81 ff 00 00 c0 ee    	cmp    $0xeec00000,%edi
+  802a0e:	0f 84 d5 fe ff ff    	je     8028e9 <ufork+0x5f>
+	for (i = 0; i < n; i++) {
+  802a14:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+	size_t i, ncow = 0;
+  802a1a:	c7 85 e0 fb ff ff 00 	movl   $0x0,-0x420(%ebp)
+  802a21:	00 00 00 
+	for (i = 0; i < n; i++) {
+  802a24:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a29:	89 bd d8 fb ff ff    	mov    %edi,-0x428(%ebp)
+  802a2f:	89 b5 e4 fb ff ff    	mov    %esi,-0x41c(%ebp)
+  802a35:	e9 ce fe ff ff       	jmp    802908 <ufork+0x7e>
+			goto fail;
+	}
+	if (r < 0)
+  802a3a:	89 c6                	mov    %eax,%esi
+  802a3c:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  802a42:	85 c0                	test   %eax,%eax
+  802a44:	78 52                	js     802a98 <ufork+0x20e>
+		goto fail;
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE),
+  802a46:	83 ec 04             	sub    $0x4,%esp
+  802a49:	6a 07                	push   $0x7
+  802a4b:	68 00 f0 bf ee       	push   $0xeebff000
+  802a50:	53                   	push   %ebx
+  802a51:	e8 3a e7 ff ff       	call   801190 <sys_page_alloc>
+  802a56:	89 c6                	mov    %eax,%esi
+  802a58:	83 c4 10             	add    $0x10,%esp
+  802a5b:	85 c0                	test   %eax,%eax
+  802a5d:	78 39                	js     802a98 <ufork+0x20e>
+				PTE_P | PTE_U | PTE_W)) < 0
+	    || (r = sys_env_set_pgfault_upcall(envid,
+			thisenv->env_pgfault_upcall)) < 0
+  802a5f:	a1 08 40 80 00       	mov    0x804008,%eax
+  802a64:	8b 40 74             	mov    0x74(%eax),%eax
+	    || (r = sys_env_set_pgfault_upcall(envid,
+  802a67:	83 ec 08             	sub    $0x8,%esp
+  802a6a:	50                   	push   %eax
+  802a6b:	53                   	push   %ebx
+  802a6c:	e8 de ed ff ff       	call   80184f <sys_env_set_pgfault_upcall>
+  802a71:	89 c6                	mov    %eax,%esi
+  802a73:	83 c4 10             	add    $0x10,%esp
+  802a76:	85 c0                	test   %eax,%eax
+  802a78:	78 1e                	js     802a98 <ufork+0x20e>
+	    || (r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  802a7a:	83 ec 08             	sub    $0x8,%esp
+  802a7d:	6a 02                	push   $0x2
+  802a7f:	53                   	push   %ebx
+  802a80:	e8 bc ea ff ff       	call   801541 <sys_env_set_status>
+  802a85:	89 c6                	mov    %eax,%esi
+  802a87:	83 c4 10             	add    $0x10,%esp
+  802a8a:	85 c0                	test   %eax,%eax
+  802a8c:	79 1c                	jns    802aaa <ufork+0x220>
+  802a8e:	eb 08                	jmp    802a98 <ufork+0x20e>
+  802a90:	89 c6                	mov    %eax,%esi
+  802a92:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+		goto fail;
+	return envid;
+
+fail:
+	sys_env_destroy(envid);
+  802a98:	83 ec 0c             	sub    $0xc,%esp
+  802a9b:	53                   	push   %ebx
+  802a9c:	e8 8e e5 ff ff       	call   80102f <sys_env_destroy>
+	return r;
+  802aa1:	83 c4 10             	add    $0x10,%esp
+  802aa4:	89 b5 d4 fb ff ff    	mov    %esi,-0x42c(%ebp)
+}
+  802aaa:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+  802ab0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ab3:	5b                   	pop    %ebx
+  802ab4:	5e                   	pop    %esi
+  802ab5:	5f                   	pop    %edi
+  802ab6:	5d                   	pop    %ebp
+  802ab7:	c3                   	ret
+  802ab8:	89 c6                	mov    %eax,%esi
+  802aba:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  802ac0:	eb d6                	jmp    802a98 <ufork+0x20e>
+
+00802ac2 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  802ac2:	55                   	push   %ebp
+  802ac3:	89 e5                	mov    %esp,%ebp
+  802ac5:	53                   	push   %ebx
+  802ac6:	83 ec 04             	sub    $0x4,%esp
+	envid_t envid;
+
+	envid = sys_fork();
+  802ac9:	e8 90 f2 ff ff       	call   801d5e <sys_fork>
+  802ace:	89 c3                	mov    %eax,%ebx
+	if (envid == 0)
+  802ad0:	85 c0                	test   %eax,%eax
+  802ad2:	74 07                	je     802adb <fork+0x19>
+		thisenv = &envs[ENVX(sys_getenvid())];
+	return envid;
+}
+  802ad4:	89 d8                	mov    %ebx,%eax
+  802ad6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ad9:	c9                   	leave
+  802ada:	c3                   	ret
+		thisenv = &envs[ENVX(sys_getenvid())];
+  802adb:	e8 11 e6 ff ff       	call   8010f1 <sys_getenvid>
+  802ae0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802ae5:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802aeb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802af0:	a3 08 40 80 00       	mov    %eax,0x804008
+	return envid;
+  802af5:	eb dd                	jmp    802ad4 <fork+0x12>
+
+00802af7 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  802af7:	55                   	push   %ebp
+  802af8:	89 e5                	mov    %esp,%ebp
+  802afa:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  802afd:	68 bf 36 80 00       	push   $0x8036bf
+  802b02:	68 a1 00 00 00       	push   $0xa1
+  802b07:	68 99 36 80 00       	push   $0x803699
+  802b0c:	e8 48 d7 ff ff       	call   800259 <_panic>
+
+00802b11 <uptime>:
+// with the TSC however long it is, as time_now() does in the kernel.
+// The kernel advances vd_uptime by the TSC too, so the result does not
+// go backwards when the next refresh comes.
+nanoseconds_t
+uptime(void)
+{
+  802b11:	55                   	push   %ebp
+  802b12:	89 e5                	mov    %esp,%ebp
+  802b14:	57                   	push   %edi
+  802b15:	56                   	push   %esi
+  802b16:	53                   	push   %ebx
+  802b17:	83 ec 2c             	sub    $0x2c,%esp
+  802b1a:	eb 02                	jmp    802b1e <uptime+0xd>
+vdso_begin(const volatile struct vdso *vd)
+{
+	uint32_t seq;
+
+	while ((seq = vd->vd_seq) & 1)
+		asm volatile("pause");
+  802b1c:	f3 90                	pause
+	while ((seq = vd->vd_seq) & 1)
+  802b1e:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  802b23:	a8 01                	test   $0x1,%al
+  802b25:	75 f5                	jne    802b1c <uptime+0xb>
+	uint64_t tick_tsc, tsc_per_tick, delta;
+	uint32_t seq;
+
+	do {
+		seq = vdso_begin(&vdso);
+		now = vdso.vd_uptime;
+  802b27:	8b 1d 04 f0 ff ee    	mov    0xeefff004,%ebx
+  802b2d:	8b 35 08 f0 ff ee    	mov    0xeefff008,%esi
+  802b33:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802b36:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+		ns_per_tick = vdso.vd_ns_per_tick;
+  802b39:	8b 0d 0c f0 ff ee    	mov    0xeefff00c,%ecx
+  802b3f:	8b 1d 10 f0 ff ee    	mov    0xeefff010,%ebx
+  802b45:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  802b48:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		tick_tsc = vdso.vd_tick_tsc;
+  802b4b:	8b 0d 14 f0 ff ee    	mov    0xeefff014,%ecx
+  802b51:	8b 1d 18 f0 ff ee    	mov    0xeefff018,%ebx
+		tsc_per_tick = vdso.vd_tsc_per_tick;
+  802b57:	8b 35 1c f0 ff ee    	mov    0xeefff01c,%esi
+  802b5d:	8b 3d 20 f0 ff ee    	mov    0xeefff020,%edi
+
+static inline bool
+vdso_retry(const volatile struct vdso *vd, uint32_t seq)
+{
+	asm volatile("" : : : "memory");
+	return vd->vd_seq != seq;
+  802b63:	8b 15 00 f0 ff ee    	mov    0xeefff000,%edx
+	} while (vdso_retry(&vdso, seq));
+  802b69:	39 c2                	cmp    %eax,%edx
+  802b6b:	75 b1                	jne    802b1e <uptime+0xd>
+
+	if (tsc_per_tick) {
+  802b6d:	89 75 d0             	mov    %esi,-0x30(%ebp)
+  802b70:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  802b73:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802b76:	0b 45 d0             	or     -0x30(%ebp),%eax
+  802b79:	74 7e                	je     802bf9 <uptime+0xe8>
+
+static inline uint64_t
+read_tsc(void)
+{
+	uint64_t tsc;
+	asm volatile("rdtsc" : "=A" (tsc));
+  802b7b:	0f 31                	rdtsc
+		delta = read_tsc() - tick_tsc;
+  802b7d:	29 c8                	sub    %ecx,%eax
+  802b7f:	19 da                	sbb    %ebx,%edx
+		now += delta / tsc_per_tick * ns_per_tick
+  802b81:	57                   	push   %edi
+  802b82:	56                   	push   %esi
+  802b83:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  802b86:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  802b89:	52                   	push   %edx
+  802b8a:	50                   	push   %eax
+  802b8b:	e8 b0 05 00 00       	call   803140 <__udivdi3>
+  802b90:	83 c4 10             	add    $0x10,%esp
+  802b93:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  802b96:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  802b99:	0f af d1             	imul   %ecx,%edx
+  802b9c:	89 ce                	mov    %ecx,%esi
+  802b9e:	89 df                	mov    %ebx,%edi
+  802ba0:	0f af d8             	imul   %eax,%ebx
+  802ba3:	89 d9                	mov    %ebx,%ecx
+  802ba5:	01 d1                	add    %edx,%ecx
+  802ba7:	f7 e6                	mul    %esi
+  802ba9:	01 ca                	add    %ecx,%edx
+  802bab:	89 d1                	mov    %edx,%ecx
+  802bad:	89 c2                	mov    %eax,%edx
+  802baf:	03 55 e0             	add    -0x20(%ebp),%edx
+  802bb2:	13 4d e4             	adc    -0x1c(%ebp),%ecx
+  802bb5:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802bb8:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+			+ delta % tsc_per_tick * ns_per_tick / tsc_per_tick;
+  802bbb:	ff 75 d4             	push   -0x2c(%ebp)
+  802bbe:	ff 75 d0             	push   -0x30(%ebp)
+  802bc1:	ff 75 cc             	push   -0x34(%ebp)
+  802bc4:	ff 75 c8             	push   -0x38(%ebp)
+  802bc7:	e8 92 05 00 00       	call   80315e <__umoddi3>
+  802bcc:	83 c4 10             	add    $0x10,%esp
+  802bcf:	0f af d6             	imul   %esi,%edx
+  802bd2:	89 f9                	mov    %edi,%ecx
+  802bd4:	0f af c8             	imul   %eax,%ecx
+  802bd7:	01 d1                	add    %edx,%ecx
+  802bd9:	f7 e6                	mul    %esi
+  802bdb:	01 ca                	add    %ecx,%edx
+  802bdd:	ff 75 d4             	push   -0x2c(%ebp)
+  802be0:	ff 75 d0             	push   -0x30(%ebp)
+  802be3:	52                   	push   %edx
+  802be4:	50                   	push   %eax
+  802be5:	e8 56 05 00 00       	call   803140 <__udivdi3>
+  802bea:	83 c4 10             	add    $0x10,%esp
+		now += delta / tsc_per_tick * ns_per_tick
+  802bed:	03 45 e0             	add    -0x20(%ebp),%eax
+  802bf0:	13 55 e4             	adc    -0x1c(%ebp),%edx
+  802bf3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802bf6:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	}
+	return now;
+}
+  802bf9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802bfc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802bff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c02:	5b                   	pop    %ebx
+  802c03:	5e                   	pop    %esi
+  802c04:	5f                   	pop    %edi
+  802c05:	5d                   	pop    %ebp
+  802c06:	c3                   	ret
+
+00802c07 <nanosleep>:
+
+// Sleep in the kernel, on a futex word nobody wakes, until the timeout
+// runs out, rather than spinning through sys_yield.
+void
+nanosleep(nanoseconds_t nanoseconds)
+{
+  802c07:	55                   	push   %ebp
+  802c08:	89 e5                	mov    %esp,%ebp
+  802c0a:	57                   	push   %edi
+  802c0b:	56                   	push   %esi
+  802c0c:	53                   	push   %ebx
+  802c0d:	83 ec 1c             	sub    $0x1c,%esp
+  802c10:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c13:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	volatile uint32_t word = 0;
+  802c16:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	nanoseconds_t now, end;
+	int r;
+
+	now = uptime();
+  802c1d:	e8 ef fe ff ff       	call   802b11 <uptime>
+	end = now + nanoseconds;
+  802c22:	01 c6                	add    %eax,%esi
+  802c24:	11 d7                	adc    %edx,%edi
+	if (end < now)
+  802c26:	39 c6                	cmp    %eax,%esi
+  802c28:	89 fb                	mov    %edi,%ebx
+  802c2a:	19 d3                	sbb    %edx,%ebx
+  802c2c:	72 39                	jb     802c67 <nanosleep+0x60>
+		panic("nanosleep: wrap");
+
+	while ((now = uptime()) < end)
+  802c2e:	e8 de fe ff ff       	call   802b11 <uptime>
+  802c33:	89 c1                	mov    %eax,%ecx
+  802c35:	89 d3                	mov    %edx,%ebx
+  802c37:	39 f0                	cmp    %esi,%eax
+  802c39:	89 d0                	mov    %edx,%eax
+  802c3b:	19 f8                	sbb    %edi,%eax
+  802c3d:	73 3c                	jae    802c7b <nanosleep+0x74>
+		if ((r = sys_futex_wait(&word, 0, end - now)) < 0
+  802c3f:	89 f0                	mov    %esi,%eax
+  802c41:	89 fa                	mov    %edi,%edx
+  802c43:	29 c8                	sub    %ecx,%eax
+  802c45:	19 da                	sbb    %ebx,%edx
+  802c47:	52                   	push   %edx
+  802c48:	50                   	push   %eax
+  802c49:	6a 00                	push   $0x0
+  802c4b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802c4e:	50                   	push   %eax
+  802c4f:	e8 4f f6 ff ff       	call   8022a3 <sys_futex_wait>
+		    && r != -E_TIMEOUT)
+  802c54:	83 c4 10             	add    $0x10,%esp
+  802c57:	83 f8 f3             	cmp    $0xfffffff3,%eax
+  802c5a:	74 d2                	je     802c2e <nanosleep+0x27>
+  802c5c:	85 c0                	test   %eax,%eax
+  802c5e:	79 ce                	jns    802c2e <nanosleep+0x27>
+			sys_yield();
+  802c60:	e8 3d e8 ff ff       	call   8014a2 <sys_yield>
+  802c65:	eb c7                	jmp    802c2e <nanosleep+0x27>
+		panic("nanosleep: wrap");
+  802c67:	83 ec 04             	sub    $0x4,%esp
+  802c6a:	68 d5 36 80 00       	push   $0x8036d5
+  802c6f:	6a 2d                	push   $0x2d
+  802c71:	68 e5 36 80 00       	push   $0x8036e5
+  802c76:	e8 de d5 ff ff       	call   800259 <_panic>
+}
+  802c7b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c7e:	5b                   	pop    %ebx
+  802c7f:	5e                   	pop    %esi
+  802c80:	5f                   	pop    %edi
+  802c81:	5d                   	pop    %ebp
+  802c82:	c3                   	ret
+
+00802c83 <sleep>:
+
+void
+sleep(seconds_t seconds)
+{
+  802c83:	55                   	push   %ebp
+  802c84:	89 e5                	mov    %esp,%ebp
+  802c86:	83 ec 10             	sub    $0x10,%esp
+	nanosleep(seconds * NANOSECONDS_PER_SECOND);
+  802c89:	69 4d 0c 00 ca 9a 3b 	imul   $0x3b9aca00,0xc(%ebp),%ecx
+  802c90:	b8 00 ca 9a 3b       	mov    $0x3b9aca00,%eax
+  802c95:	f7 65 08             	mull   0x8(%ebp)
+  802c98:	01 ca                	add    %ecx,%edx
+  802c9a:	52                   	push   %edx
+  802c9b:	50                   	push   %eax
+  802c9c:	e8 66 ff ff ff       	call   802c07 <nanosleep>
+}
+  802ca1:	83 c4 10             	add    $0x10,%esp
+  802ca4:	c9                   	leave
+  802ca5:	c3                   	ret
+
+00802ca6 <epoch_to_tm>:
+	return days[month];
+}
+
+// ignore leap seconds
+void epoch_to_tm(seconds_t epoch, struct tm *tm)
+{
+  802ca6:	55                   	push   %ebp
+  802ca7:	89 e5                	mov    %esp,%ebp
+  802ca9:	57                   	push   %edi
+  802caa:	56                   	push   %esi
+  802cab:	53                   	push   %ebx
+  802cac:	83 ec 4c             	sub    $0x4c,%esp
+  802caf:	8b 75 08             	mov    0x8(%ebp),%esi
+  802cb2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	int year, month, days, dsec;
+
+	days = epoch / 86400;
+  802cb5:	6a 00                	push   $0x0
+  802cb7:	68 80 51 01 00       	push   $0x15180
+  802cbc:	57                   	push   %edi
+  802cbd:	56                   	push   %esi
+  802cbe:	e8 7d 04 00 00       	call   803140 <__udivdi3>
+  802cc3:	83 c4 10             	add    $0x10,%esp
+  802cc6:	89 c3                	mov    %eax,%ebx
+	dsec = epoch % 86400;
+  802cc8:	6a 00                	push   $0x0
+  802cca:	68 80 51 01 00       	push   $0x15180
+  802ccf:	57                   	push   %edi
+  802cd0:	56                   	push   %esi
+  802cd1:	e8 88 04 00 00       	call   80315e <__umoddi3>
+  802cd6:	83 c4 10             	add    $0x10,%esp
+  802cd9:	89 c1                	mov    %eax,%ecx
+
+	tm->tm_sec = dsec % 60;
+  802cdb:	b8 89 88 88 88       	mov    $0x88888889,%eax
+  802ce0:	f7 e9                	imul   %ecx
+  802ce2:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802ce5:	c1 f8 05             	sar    $0x5,%eax
+  802ce8:	89 cf                	mov    %ecx,%edi
+  802cea:	c1 ff 1f             	sar    $0x1f,%edi
+  802ced:	29 f8                	sub    %edi,%eax
+  802cef:	6b c0 3c             	imul   $0x3c,%eax,%eax
+  802cf2:	89 ca                	mov    %ecx,%edx
+  802cf4:	29 c2                	sub    %eax,%edx
+  802cf6:	8b 45 10             	mov    0x10(%ebp),%eax
+  802cf9:	89 10                	mov    %edx,(%eax)
+	tm->tm_min = (dsec % 3600) / 60;
+  802cfb:	ba c5 b3 a2 91       	mov    $0x91a2b3c5,%edx
+  802d00:	89 c8                	mov    %ecx,%eax
+  802d02:	f7 ea                	imul   %edx
+  802d04:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  802d07:	c1 fe 0b             	sar    $0xb,%esi
+  802d0a:	29 fe                	sub    %edi,%esi
+  802d0c:	69 c6 10 0e 00 00    	imul   $0xe10,%esi,%eax
+  802d12:	29 c1                	sub    %eax,%ecx
+  802d14:	b8 89 88 88 88       	mov    $0x88888889,%eax
+  802d19:	f7 e9                	imul   %ecx
+  802d1b:	01 ca                	add    %ecx,%edx
+  802d1d:	c1 fa 05             	sar    $0x5,%edx
+  802d20:	c1 f9 1f             	sar    $0x1f,%ecx
+  802d23:	29 ca                	sub    %ecx,%edx
+  802d25:	8b 45 10             	mov    0x10(%ebp),%eax
+  802d28:	89 50 04             	mov    %edx,0x4(%eax)
+	tm->tm_hour = dsec / 3600;
+  802d2b:	89 70 08             	mov    %esi,0x8(%eax)
+	tm->tm_wday = (days + 4) % 7;
+  802d2e:	8d 4b 04             	lea    0x4(%ebx),%ecx
+  802d31:	ba 93 24 49 92       	mov    $0x92492493,%edx
+  802d36:	89 c8                	mov    %ecx,%eax
+  802d38:	f7 ea                	imul   %edx
+  802d3a:	01 ca                	add    %ecx,%edx
+  802d3c:	c1 fa 02             	sar    $0x2,%edx
+  802d3f:	89 c8                	mov    %ecx,%eax
+  802d41:	c1 f8 1f             	sar    $0x1f,%eax
+  802d44:	29 c2                	sub    %eax,%edx
+  802d46:	8d 04 d5 00 00 00 00 	lea    0x0(,%edx,8),%eax
+  802d4d:	29 d0                	sub    %edx,%eax
+  802d4f:	29 c1                	sub    %eax,%ecx
+  802d51:	8b 45 10             	mov    0x10(%ebp),%eax
+  802d54:	89 48 18             	mov    %ecx,0x18(%eax)
+
+	for (year = 1970; days >= days_per_year(year); ++year)
+  802d57:	b9 b2 07 00 00       	mov    $0x7b2,%ecx
+	return (year % 4 == 0) && !((year % 100 == 0) && (year % 400 != 0));
+  802d5c:	bf 00 00 00 00       	mov    $0x0,%edi
+	for (year = 1970; days >= days_per_year(year); ++year)
+  802d61:	eb 0e                	jmp    802d71 <epoch_to_tm+0xcb>
+  802d63:	05 6d 01 00 00       	add    $0x16d,%eax
+  802d68:	39 c3                	cmp    %eax,%ebx
+  802d6a:	7c 4c                	jl     802db8 <epoch_to_tm+0x112>
+		days -= days_per_year(year);
+  802d6c:	29 c3                	sub    %eax,%ebx
+	for (year = 1970; days >= days_per_year(year); ++year)
+  802d6e:	83 c1 01             	add    $0x1,%ecx
+	return (year % 4 == 0) && !((year % 100 == 0) && (year % 400 != 0));
+  802d71:	89 f8                	mov    %edi,%eax
+  802d73:	89 ce                	mov    %ecx,%esi
+  802d75:	83 e6 03             	and    $0x3,%esi
+  802d78:	75 e9                	jne    802d63 <epoch_to_tm+0xbd>
+  802d7a:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+  802d7f:	f7 e9                	imul   %ecx
+  802d81:	c1 fa 05             	sar    $0x5,%edx
+  802d84:	89 c8                	mov    %ecx,%eax
+  802d86:	c1 f8 1f             	sar    $0x1f,%eax
+  802d89:	29 c2                	sub    %eax,%edx
+  802d8b:	6b d2 64             	imul   $0x64,%edx,%edx
+  802d8e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d93:	39 d1                	cmp    %edx,%ecx
+  802d95:	75 cc                	jne    802d63 <epoch_to_tm+0xbd>
+  802d97:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+  802d9c:	f7 e9                	imul   %ecx
+  802d9e:	c1 fa 07             	sar    $0x7,%edx
+  802da1:	89 c8                	mov    %ecx,%eax
+  802da3:	c1 f8 1f             	sar    $0x1f,%eax
+  802da6:	29 c2                	sub    %eax,%edx
+  802da8:	69 d2 90 01 00 00    	imul   $0x190,%edx,%edx
+  802dae:	39 d1                	cmp    %edx,%ecx
+  802db0:	0f 94 c0             	sete   %al
+  802db3:	0f b6 c0             	movzbl %al,%eax
+  802db6:	eb ab                	jmp    802d63 <epoch_to_tm+0xbd>
+	tm->tm_year = year - 1900;
+  802db8:	8d 81 94 f8 ff ff    	lea    -0x76c(%ecx),%eax
+  802dbe:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802dc1:	89 47 14             	mov    %eax,0x14(%edi)
+	tm->tm_yday = days;
+  802dc4:	89 5f 1c             	mov    %ebx,0x1c(%edi)
+	return (year % 4 == 0) && !((year % 100 == 0) && (year % 400 != 0));
+  802dc7:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+  802dcc:	89 c8                	mov    %ecx,%eax
+  802dce:	f7 ea                	imul   %edx
+  802dd0:	89 d7                	mov    %edx,%edi
+  802dd2:	c1 ff 07             	sar    $0x7,%edi
+  802dd5:	89 c8                	mov    %ecx,%eax
+  802dd7:	c1 f8 1f             	sar    $0x1f,%eax
+  802dda:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  802ddd:	29 c7                	sub    %eax,%edi
+  802ddf:	69 ff 90 01 00 00    	imul   $0x190,%edi,%edi
+  802de5:	39 f9                	cmp    %edi,%ecx
+  802de7:	0f 94 c0             	sete   %al
+  802dea:	0f b6 c0             	movzbl %al,%eax
+  802ded:	89 c7                	mov    %eax,%edi
+  802def:	c1 fa 05             	sar    $0x5,%edx
+  802df2:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  802df5:	29 c2                	sub    %eax,%edx
+  802df7:	6b d2 64             	imul   $0x64,%edx,%edx
+  802dfa:	39 d1                	cmp    %edx,%ecx
+  802dfc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802e01:	0f 44 cf             	cmove  %edi,%ecx
+
+	for (month = 0; days >= days_per_month(year, month); ++month)
+  802e04:	b8 00 00 00 00       	mov    $0x0,%eax
+		return 29;
+  802e09:	bf 1d 00 00 00       	mov    $0x1d,%edi
+	for (month = 0; days >= days_per_month(year, month); ++month)
+  802e0e:	eb 0d                	jmp    802e1d <epoch_to_tm+0x177>
+	return days[month];
+  802e10:	8b 54 85 b8          	mov    -0x48(%ebp,%eax,4),%edx
+	for (month = 0; days >= days_per_month(year, month); ++month)
+  802e14:	39 d3                	cmp    %edx,%ebx
+  802e16:	7c 6a                	jl     802e82 <epoch_to_tm+0x1dc>
+		days -= days_per_month(year, month);
+  802e18:	29 d3                	sub    %edx,%ebx
+	for (month = 0; days >= days_per_month(year, month); ++month)
+  802e1a:	83 c0 01             	add    $0x1,%eax
+	int days[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  802e1d:	c7 45 b8 1f 00 00 00 	movl   $0x1f,-0x48(%ebp)
+  802e24:	c7 45 bc 1c 00 00 00 	movl   $0x1c,-0x44(%ebp)
+  802e2b:	c7 45 c0 1f 00 00 00 	movl   $0x1f,-0x40(%ebp)
+  802e32:	c7 45 c4 1e 00 00 00 	movl   $0x1e,-0x3c(%ebp)
+  802e39:	c7 45 c8 1f 00 00 00 	movl   $0x1f,-0x38(%ebp)
+  802e40:	c7 45 cc 1e 00 00 00 	movl   $0x1e,-0x34(%ebp)
+  802e47:	c7 45 d0 1f 00 00 00 	movl   $0x1f,-0x30(%ebp)
+  802e4e:	c7 45 d4 1f 00 00 00 	movl   $0x1f,-0x2c(%ebp)
+  802e55:	c7 45 d8 1e 00 00 00 	movl   $0x1e,-0x28(%ebp)
+  802e5c:	c7 45 dc 1f 00 00 00 	movl   $0x1f,-0x24(%ebp)
+  802e63:	c7 45 e0 1e 00 00 00 	movl   $0x1e,-0x20(%ebp)
+  802e6a:	c7 45 e4 1f 00 00 00 	movl   $0x1f,-0x1c(%ebp)
+	return (year % 4 == 0) && !((year % 100 == 0) && (year % 400 != 0));
+  802e71:	85 f6                	test   %esi,%esi
+  802e73:	75 9b                	jne    802e10 <epoch_to_tm+0x16a>
+	if (isleap(year) && month == 1)
+  802e75:	83 f8 01             	cmp    $0x1,%eax
+  802e78:	75 96                	jne    802e10 <epoch_to_tm+0x16a>
+		return 29;
+  802e7a:	89 fa                	mov    %edi,%edx
+	if (isleap(year) && month == 1)
+  802e7c:	84 c9                	test   %cl,%cl
+  802e7e:	74 90                	je     802e10 <epoch_to_tm+0x16a>
+  802e80:	eb 92                	jmp    802e14 <epoch_to_tm+0x16e>
+	tm->tm_mon = month;
+  802e82:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802e85:	89 47 10             	mov    %eax,0x10(%edi)
+	tm->tm_mday = days + 1;
+  802e88:	83 c3 01             	add    $0x1,%ebx
+  802e8b:	89 5f 0c             	mov    %ebx,0xc(%edi)
+}
+  802e8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e91:	5b                   	pop    %ebx
+  802e92:	5e                   	pop    %esi
+  802e93:	5f                   	pop    %edi
+  802e94:	5d                   	pop    %ebp
+  802e95:	c3                   	ret
+
+00802e96 <mutex_lock_contended>:
+
+// Take 'm' the slow way: mark it contended and sleep until it is
+// free.  Used whenever other envs might be sleeping on it.
+static void
+mutex_lock_contended(struct mutex *m)
+{
+  802e96:	55                   	push   %ebp
+  802e97:	89 e5                	mov    %esp,%ebp
+  802e99:	56                   	push   %esi
+  802e9a:	53                   	push   %ebx
+  802e9b:	89 c3                	mov    %eax,%ebx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  802e9d:	be 02 00 00 00       	mov    $0x2,%esi
+	while (xchg(&m->m_state, 2) != 0)
+  802ea2:	eb 0f                	jmp    802eb3 <mutex_lock_contended+0x1d>
+		sys_futex_wait(&m->m_state, 2, 0);
+  802ea4:	6a 00                	push   $0x0
+  802ea6:	6a 00                	push   $0x0
+  802ea8:	6a 02                	push   $0x2
+  802eaa:	53                   	push   %ebx
+  802eab:	e8 f3 f3 ff ff       	call   8022a3 <sys_futex_wait>
+  802eb0:	83 c4 10             	add    $0x10,%esp
+  802eb3:	89 f0                	mov    %esi,%eax
+  802eb5:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  802eb8:	85 c0                	test   %eax,%eax
+  802eba:	75 e8                	jne    802ea4 <mutex_lock_contended+0xe>
+}
+  802ebc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ebf:	5b                   	pop    %ebx
+  802ec0:	5e                   	pop    %esi
+  802ec1:	5d                   	pop    %ebp
+  802ec2:	c3                   	ret
+
+00802ec3 <mutex_init>:
+{
+  802ec3:	55                   	push   %ebp
+  802ec4:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  802ec6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ec9:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  802ecf:	5d                   	pop    %ebp
+  802ed0:	c3                   	ret
+
+00802ed1 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+  802ed1:	55                   	push   %ebp
+  802ed2:	89 e5                	mov    %esp,%ebp
+  802ed4:	83 ec 08             	sub    $0x8,%esp
+  802ed7:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (__sync_val_compare_and_swap(&m->m_state, 0, 1) != 0)
+  802eda:	b8 00 00 00 00       	mov    $0x0,%eax
+  802edf:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802ee4:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+  802ee8:	85 c0                	test   %eax,%eax
+  802eea:	75 02                	jne    802eee <mutex_lock+0x1d>
+		mutex_lock_contended(m);
+}
+  802eec:	c9                   	leave
+  802eed:	c3                   	ret
+		mutex_lock_contended(m);
+  802eee:	89 d0                	mov    %edx,%eax
+  802ef0:	e8 a1 ff ff ff       	call   802e96 <mutex_lock_contended>
+}
+  802ef5:	eb f5                	jmp    802eec <mutex_lock+0x1b>
+
+00802ef7 <mutex_trylock>:
+
+// Take 'm' if it is free.  Returns whether we got it.
+bool
+mutex_trylock(struct mutex *m)
+{
+  802ef7:	55                   	push   %ebp
+  802ef8:	89 e5                	mov    %esp,%ebp
+  802efa:	8b 55 08             	mov    0x8(%ebp),%edx
+	return __sync_val_compare_and_swap(&m->m_state, 0, 1) == 0;
+  802efd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f02:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802f07:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+  802f0b:	85 c0                	test   %eax,%eax
+  802f0d:	0f 94 c0             	sete   %al
+}
+  802f10:	5d                   	pop    %ebp
+  802f11:	c3                   	ret
+
+00802f12 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  802f12:	55                   	push   %ebp
+  802f13:	89 e5                	mov    %esp,%ebp
+  802f15:	83 ec 08             	sub    $0x8,%esp
+  802f18:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (__sync_fetch_and_sub(&m->m_state, 1) != 1) {
+  802f1b:	f0 83 28 01          	lock subl $0x1,(%eax)
+  802f1f:	75 02                	jne    802f23 <mutex_unlock+0x11>
+		m->m_state = 0;
+		sys_futex_wake(&m->m_state, 1);
+	}
+}
+  802f21:	c9                   	leave
+  802f22:	c3                   	ret
+		m->m_state = 0;
+  802f23:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+		sys_futex_wake(&m->m_state, 1);
+  802f29:	83 ec 08             	sub    $0x8,%esp
+  802f2c:	6a 01                	push   $0x1
+  802f2e:	50                   	push   %eax
+  802f2f:	e8 1f f4 ff ff       	call   802353 <sys_futex_wake>
+  802f34:	83 c4 10             	add    $0x10,%esp
+}
+  802f37:	eb e8                	jmp    802f21 <mutex_unlock+0xf>
+
+00802f39 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+  802f39:	55                   	push   %ebp
+  802f3a:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  802f3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f3f:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  802f45:	5d                   	pop    %ebp
+  802f46:	c3                   	ret
+
+00802f47 <cond_timedwait>:
+
+// Like cond_wait, but give up after 'timeout' nanoseconds (0 means
+// never).  Returns 0, or -E_TIMEOUT if the time ran out.
+int
+cond_timedwait(struct cond *c, struct mutex *m, nanoseconds_t timeout)
+{
+  802f47:	55                   	push   %ebp
+  802f48:	89 e5                	mov    %esp,%ebp
+  802f4a:	57                   	push   %edi
+  802f4b:	56                   	push   %esi
+  802f4c:	53                   	push   %ebx
+  802f4d:	83 ec 18             	sub    $0x18,%esp
+  802f50:	8b 75 10             	mov    0x10(%ebp),%esi
+  802f53:	8b 7d 14             	mov    0x14(%ebp),%edi
+	uint32_t seq = c->c_seq;
+  802f56:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f59:	8b 18                	mov    (%eax),%ebx
+	int r;
+
+	mutex_unlock(m);
+  802f5b:	ff 75 0c             	push   0xc(%ebp)
+  802f5e:	e8 af ff ff ff       	call   802f12 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, timeout);
+  802f63:	57                   	push   %edi
+  802f64:	56                   	push   %esi
+  802f65:	53                   	push   %ebx
+  802f66:	ff 75 08             	push   0x8(%ebp)
+  802f69:	e8 35 f3 ff ff       	call   8022a3 <sys_futex_wait>
+  802f6e:	89 c3                	mov    %eax,%ebx
+	// Others woken with us may be asleep on the mutex by now.
+	mutex_lock_contended(m);
+  802f70:	83 c4 20             	add    $0x20,%esp
+  802f73:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f76:	e8 1b ff ff ff       	call   802e96 <mutex_lock_contended>
+	return r == -E_TIMEOUT ? r : 0;
+  802f7b:	83 fb f3             	cmp    $0xfffffff3,%ebx
+  802f7e:	74 05                	je     802f85 <cond_timedwait+0x3e>
+  802f80:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802f85:	89 d8                	mov    %ebx,%eax
+  802f87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f8a:	5b                   	pop    %ebx
+  802f8b:	5e                   	pop    %esi
+  802f8c:	5f                   	pop    %edi
+  802f8d:	5d                   	pop    %ebp
+  802f8e:	c3                   	ret
+
+00802f8f <cond_wait>:
+{
+  802f8f:	55                   	push   %ebp
+  802f90:	89 e5                	mov    %esp,%ebp
+  802f92:	83 ec 08             	sub    $0x8,%esp
+	cond_timedwait(c, m, 0);
+  802f95:	6a 00                	push   $0x0
+  802f97:	6a 00                	push   $0x0
+  802f99:	ff 75 0c             	push   0xc(%ebp)
+  802f9c:	ff 75 08             	push   0x8(%ebp)
+  802f9f:	e8 a3 ff ff ff       	call   802f47 <cond_timedwait>
+}
+  802fa4:	83 c4 10             	add    $0x10,%esp
+  802fa7:	c9                   	leave
+  802fa8:	c3                   	ret
+
+00802fa9 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  802fa9:	55                   	push   %ebp
+  802faa:	89 e5                	mov    %esp,%ebp
+  802fac:	83 ec 10             	sub    $0x10,%esp
+  802faf:	8b 45 08             	mov    0x8(%ebp),%eax
+	__sync_fetch_and_add(&c->c_seq, 1);
+  802fb2:	f0 83 00 01          	lock addl $0x1,(%eax)
+	sys_futex_wake(&c->c_seq, 1);
+  802fb6:	6a 01                	push   $0x1
+  802fb8:	50                   	push   %eax
+  802fb9:	e8 95 f3 ff ff       	call   802353 <sys_futex_wake>
+}
+  802fbe:	83 c4 10             	add    $0x10,%esp
+  802fc1:	c9                   	leave
+  802fc2:	c3                   	ret
+
+00802fc3 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  802fc3:	55                   	push   %ebp
+  802fc4:	89 e5                	mov    %esp,%ebp
+  802fc6:	83 ec 10             	sub    $0x10,%esp
+  802fc9:	8b 45 08             	mov    0x8(%ebp),%eax
+	__sync_fetch_and_add(&c->c_seq, 1);
+  802fcc:	f0 83 00 01          	lock addl $0x1,(%eax)
+	sys_futex_wake(&c->c_seq, INT_MAX);
+  802fd0:	68 ff ff ff 7f       	push   $0x7fffffff
+  802fd5:	50                   	push   %eax
+  802fd6:	e8 78 f3 ff ff       	call   802353 <sys_futex_wake>
+}
+  802fdb:	83 c4 10             	add    $0x10,%esp
+  802fde:	c9                   	leave
+  802fdf:	c3                   	ret
+
+00802fe0 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802fe0:	55                   	push   %ebp
+  802fe1:	89 e5                	mov    %esp,%ebp
+  802fe3:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  802fe6:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  802fed:	74 0a                	je     802ff9 <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  802fef:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ff2:	a3 0c 40 80 00       	mov    %eax,0x80400c
+}
+  802ff7:	c9                   	leave
+  802ff8:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE),
+  802ff9:	83 ec 04             	sub    $0x4,%esp
+  802ffc:	6a 07                	push   $0x7
+  802ffe:	68 00 f0 bf ee       	push   $0xeebff000
+  803003:	6a 00                	push   $0x0
+  803005:	e8 86 e1 ff ff       	call   801190 <sys_page_alloc>
+  80300a:	83 c4 10             	add    $0x10,%esp
+  80300d:	85 c0                	test   %eax,%eax
+  80300f:	78 28                	js     803039 <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  803011:	83 ec 08             	sub    $0x8,%esp
+  803014:	68 4b 30 80 00       	push   $0x80304b
+  803019:	6a 00                	push   $0x0
+  80301b:	e8 2f e8 ff ff       	call   80184f <sys_env_set_pgfault_upcall>
+  803020:	83 c4 10             	add    $0x10,%esp
+  803023:	85 c0                	test   %eax,%eax
+  803025:	79 c8                	jns    802fef <set_pgfault_handler+0xf>
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+  803027:	50                   	push   %eax
+  803028:	68 18 37 80 00       	push   $0x803718
+  80302d:	6a 24                	push   $0x24
+  80302f:	68 4c 37 80 00       	push   $0x80374c
+  803034:	e8 20 d2 ff ff       	call   800259 <_panic>
+			panic("set_pgfault_handler: sys_page_alloc: %e", r);
+  803039:	50                   	push   %eax
+  80303a:	68 f0 36 80 00       	push   $0x8036f0
+  80303f:	6a 22                	push   $0x22
+  803041:	68 4c 37 80 00       	push   $0x80374c
+  803046:	e8 0e d2 ff ff       	call   800259 <_panic>
+
+0080304b <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80304b:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80304c:	a1 0c 40 80 00       	mov    0x80400c,%eax
+	call *%eax
+  803051:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803053:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 0x28(%esp), %ebx		// trap-time eip
+  803056:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl 0x30(%esp), %eax		// trap-time esp
+  80305a:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  80305e:	83 e8 04             	sub    $0x4,%eax
+	movl %ebx, (%eax)
+  803061:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 0x30(%esp)
+  803063:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp			// skip fault_va and err
+  803067:	83 c4 08             	add    $0x8,%esp
+	popal
+  80306a:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp			// skip eip
+  80306b:	83 c4 04             	add    $0x4,%esp
+	popfl
+  80306e:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  80306f:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803070:	c3                   	ret
+
+00803071 <dm>:
+  803071:	55                   	push   %ebp
+  803072:	57                   	push   %edi
+  803073:	56                   	push   %esi
+  803074:	53                   	push   %ebx
+  803075:	83 ec 24             	sub    $0x24,%esp
+  803078:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80307c:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803080:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803084:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803088:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80308c:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803090:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  803094:	b8 00 00 00 00       	mov    $0x0,%eax
+  803099:	ba 00 00 00 00       	mov    $0x0,%edx
+  80309e:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8030a3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8030aa:	00 
+  8030ab:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8030b2:	00 
+  8030b3:	89 fb                	mov    %edi,%ebx
+  8030b5:	eb 08                	jmp    8030bf <dm+0x4e>
+  8030b7:	83 e9 01             	sub    $0x1,%ecx
+  8030ba:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8030bd:	74 68                	je     803127 <dm+0xb6>
+  8030bf:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8030c3:	01 c0                	add    %eax,%eax
+  8030c5:	89 c6                	mov    %eax,%esi
+  8030c7:	89 d7                	mov    %edx,%edi
+  8030c9:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8030cd:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8030d1:	0f ad d0             	shrd   %cl,%edx,%eax
+  8030d4:	d3 ea                	shr    %cl,%edx
+  8030d6:	f6 c1 20             	test   $0x20,%cl
+  8030d9:	74 04                	je     8030df <dm+0x6e>
+  8030db:	89 d0                	mov    %edx,%eax
+  8030dd:	31 d2                	xor    %edx,%edx
+  8030df:	83 e0 01             	and    $0x1,%eax
+  8030e2:	89 04 24             	mov    %eax,(%esp)
+  8030e5:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8030ec:	00 
+  8030ed:	8b 04 24             	mov    (%esp),%eax
+  8030f0:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8030f4:	09 f0                	or     %esi,%eax
+  8030f6:	09 fa                	or     %edi,%edx
+  8030f8:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8030fc:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803100:	39 f0                	cmp    %esi,%eax
+  803102:	89 d5                	mov    %edx,%ebp
+  803104:	19 fd                	sbb    %edi,%ebp
+  803106:	72 af                	jb     8030b7 <dm+0x46>
+  803108:	29 f0                	sub    %esi,%eax
+  80310a:	19 fa                	sbb    %edi,%edx
+  80310c:	89 cf                	mov    %ecx,%edi
+  80310e:	c1 ef 05             	shr    $0x5,%edi
+  803111:	83 e7 01             	and    $0x1,%edi
+  803114:	89 fe                	mov    %edi,%esi
+  803116:	83 f6 01             	xor    $0x1,%esi
+  803119:	d3 e6                	shl    %cl,%esi
+  80311b:	d3 e7                	shl    %cl,%edi
+  80311d:	09 74 24 18          	or     %esi,0x18(%esp)
+  803121:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803125:	eb 90                	jmp    8030b7 <dm+0x46>
+  803127:	85 db                	test   %ebx,%ebx
+  803129:	74 05                	je     803130 <dm+0xbf>
+  80312b:	89 03                	mov    %eax,(%ebx)
+  80312d:	89 53 04             	mov    %edx,0x4(%ebx)
+  803130:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803134:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803138:	83 c4 24             	add    $0x24,%esp
+  80313b:	5b                   	pop    %ebx
+  80313c:	5e                   	pop    %esi
+  80313d:	5f                   	pop    %edi
+  80313e:	5d                   	pop    %ebp
+  80313f:	c3                   	ret
+
+00803140 <__udivdi3>:
+  803140:	83 ec 08             	sub    $0x8,%esp
+  803143:	6a 00                	push   $0x0
+  803145:	ff 74 24 1c          	push   0x1c(%esp)
+  803149:	ff 74 24 1c          	push   0x1c(%esp)
+  80314d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803151:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803155:	e8 17 ff ff ff       	call   803071 <dm>
+  80315a:	83 c4 14             	add    $0x14,%esp
+  80315d:	c3                   	ret
+
+0080315e <__umoddi3>:
+  80315e:	83 ec 18             	sub    $0x18,%esp
+  803161:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803165:	50                   	push   %eax
+  803166:	ff 74 24 2c          	push   0x2c(%esp)
+  80316a:	ff 74 24 2c          	push   0x2c(%esp)
+  80316e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803172:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803176:	e8 f6 fe ff ff       	call   803071 <dm>
+  80317b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80317f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803183:	83 c4 24             	add    $0x24,%esp
+  803186:	c3                   	ret
+
+00803187 <__divdi3>:
+  803187:	53                   	push   %ebx
+  803188:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80318c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803190:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803194:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803198:	85 d2                	test   %edx,%edx
+  80319a:	78 15                	js     8031b1 <__divdi3+0x2a>
+  80319c:	85 db                	test   %ebx,%ebx
+  80319e:	78 34                	js     8031d4 <__divdi3+0x4d>
+  8031a0:	83 ec 04             	sub    $0x4,%esp
+  8031a3:	6a 00                	push   $0x0
+  8031a5:	53                   	push   %ebx
+  8031a6:	51                   	push   %ecx
+  8031a7:	e8 c5 fe ff ff       	call   803071 <dm>
+  8031ac:	83 c4 10             	add    $0x10,%esp
+  8031af:	eb 21                	jmp    8031d2 <__divdi3+0x4b>
+  8031b1:	f7 d8                	neg    %eax
+  8031b3:	83 d2 00             	adc    $0x0,%edx
+  8031b6:	f7 da                	neg    %edx
+  8031b8:	85 db                	test   %ebx,%ebx
+  8031ba:	78 30                	js     8031ec <__divdi3+0x65>
+  8031bc:	83 ec 04             	sub    $0x4,%esp
+  8031bf:	6a 00                	push   $0x0
+  8031c1:	53                   	push   %ebx
+  8031c2:	51                   	push   %ecx
+  8031c3:	e8 a9 fe ff ff       	call   803071 <dm>
+  8031c8:	83 c4 10             	add    $0x10,%esp
+  8031cb:	f7 d8                	neg    %eax
+  8031cd:	83 d2 00             	adc    $0x0,%edx
+  8031d0:	f7 da                	neg    %edx
+  8031d2:	5b                   	pop    %ebx
+  8031d3:	c3                   	ret
+  8031d4:	83 ec 04             	sub    $0x4,%esp
+  8031d7:	6a 00                	push   $0x0
+  8031d9:	f7 d9                	neg    %ecx
+  8031db:	83 d3 00             	adc    $0x0,%ebx
+  8031de:	f7 db                	neg    %ebx
+  8031e0:	53                   	push   %ebx
+  8031e1:	51                   	push   %ecx
+  8031e2:	e8 8a fe ff ff       	call   803071 <dm>
+  8031e7:	83 c4 10             	add    $0x10,%esp
+  8031ea:	eb df                	jmp    8031cb <__divdi3+0x44>
+  8031ec:	83 ec 04             	sub    $0x4,%esp
+  8031ef:	6a 00                	push   $0x0
+  8031f1:	f7 d9                	neg    %ecx
+  8031f3:	83 d3 00             	adc    $0x0,%ebx
+  8031f6:	f7 db                	neg    %ebx
+  8031f8:	53                   	push   %ebx
+  8031f9:	51                   	push   %ecx
+  8031fa:	e8 72 fe ff ff       	call   803071 <dm>
+  8031ff:	83 c4 10             	add    $0x10,%esp
+  803202:	eb ce                	jmp    8031d2 <__divdi3+0x4b>
+
+00803204 <__moddi3>:
+  803204:	55                   	push   %ebp
+  803205:	57                   	push   %edi
+  803206:	56                   	push   %esi
+  803207:	53                   	push   %ebx
+  803208:	83 ec 18             	sub    $0x18,%esp
+  80320b:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  80320f:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  803213:	89 f1                	mov    %esi,%ecx
+  803215:	f7 d9                	neg    %ecx
+  803217:	89 da                	mov    %ebx,%edx
+  803219:	83 d2 00             	adc    $0x0,%edx
+  80321c:	f7 da                	neg    %edx
+  80321e:	0f 48 ce             	cmovs  %esi,%ecx
+  803221:	0f 48 d3             	cmovs  %ebx,%edx
+  803224:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803228:	50                   	push   %eax
+  803229:	8b 74 24 38          	mov    0x38(%esp),%esi
+  80322d:	f7 de                	neg    %esi
+  80322f:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  803233:	83 d0 00             	adc    $0x0,%eax
+  803236:	f7 d8                	neg    %eax
+  803238:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  80323d:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  803242:	50                   	push   %eax
+  803243:	56                   	push   %esi
+  803244:	89 c8                	mov    %ecx,%eax
+  803246:	e8 26 fe ff ff       	call   803071 <dm>
+  80324b:	83 c4 10             	add    $0x10,%esp
+  80324e:	85 db                	test   %ebx,%ebx
+  803250:	78 10                	js     803262 <__moddi3+0x5e>
+  803252:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803256:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80325a:	83 c4 14             	add    $0x14,%esp
+  80325d:	5b                   	pop    %ebx
+  80325e:	5e                   	pop    %esi
+  80325f:	5f                   	pop    %edi
+  803260:	5d                   	pop    %ebp
+  803261:	c3                   	ret
+  803262:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803266:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80326a:	f7 d8                	neg    %eax
+  80326c:	83 d2 00             	adc    $0x0,%edx
+  80326f:	f7 da                	neg    %edx
+  803271:	eb e7                	jmp    80325a <__moddi3+0x56>
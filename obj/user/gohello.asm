@@ -0,0 +1,5027 @@
+
+obj/user/gohello:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 08 00 00 00       	call   800039 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	90                   	nop
+  800037:	5d                   	pop    %ebp
+  800038:	c3                   	ret
+
+00800039 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800039:	55                   	push   %ebp
+  80003a:	89 e5                	mov    %esp,%ebp
+  80003c:	56                   	push   %esi
+  80003d:	53                   	push   %ebx
+  80003e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800041:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  800044:	e8 9d 04 00 00       	call   8004e6 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  800049:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80004e:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  800054:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800059:	a3 08 30 80 00       	mov    %eax,0x803008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80005e:	85 db                	test   %ebx,%ebx
+  800060:	7e 07                	jle    800069 <libmain+0x30>
+		binaryname = argv[0];
+  800062:	8b 06                	mov    (%esi),%eax
+  800064:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  800069:	83 ec 08             	sub    $0x8,%esp
+  80006c:	56                   	push   %esi
+  80006d:	53                   	push   %ebx
+  80006e:	e8 c0 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800073:	e8 0a 00 00 00       	call   800082 <exit>
+}
+  800078:	83 c4 10             	add    $0x10,%esp
+  80007b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80007e:	5b                   	pop    %ebx
+  80007f:	5e                   	pop    %esi
+  800080:	5d                   	pop    %ebp
+  800081:	c3                   	ret
+
+00800082 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800082:	55                   	push   %ebp
+  800083:	89 e5                	mov    %esp,%ebp
+  800085:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  800088:	6a 00                	push   $0x0
+  80008a:	e8 95 03 00 00       	call   800424 <sys_env_destroy>
+}
+  80008f:	83 c4 10             	add    $0x10,%esp
+  800092:	c9                   	leave
+  800093:	c3                   	ret
+
+00800094 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800094:	55                   	push   %ebp
+  800095:	89 e5                	mov    %esp,%ebp
+  800097:	57                   	push   %edi
+  800098:	56                   	push   %esi
+  800099:	53                   	push   %ebx
+  80009a:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  8000a0:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  8000a6:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  8000ac:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  8000b2:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  8000b9:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  8000bc:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  8000c3:	00 00 00 
+		if (num == SYS_page_map_vec)
+  8000c6:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  8000cd:	74 76                	je     800145 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  8000cf:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  8000d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8000d8:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  8000de:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8000e5:	0f 88 06 01 00 00    	js     8001f1 <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  8000eb:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8000f2:	0f 84 48 01 00 00    	je     800240 <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  8000f8:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  8000fe:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800104:	be 00 00 00 00       	mov    $0x0,%esi
+  800109:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  80010f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800112:	55                   	push   %ebp
+  800113:	68 1c 01 80 00       	push   $0x80011c
+  800118:	89 e5                	mov    %esp,%ebp
+  80011a:	0f 34                	sysenter
+  80011c:	83 c4 04             	add    $0x4,%esp
+  80011f:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800120:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800126:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  80012c:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  80012f:	0f 85 9a 01 00 00    	jne    8002cf <page_vec_call+0x23b>
+  800135:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80013a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80013d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800140:	e9 29 01 00 00       	jmp    80026e <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800145:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  80014b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80014e:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800150:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800157:	78 2f                	js     800188 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800159:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800160:	74 72                	je     8001d4 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800162:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800168:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  80016e:	b8 10 00 00 00       	mov    $0x10,%eax
+  800173:	89 fb                	mov    %edi,%ebx
+  800175:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800178:	55                   	push   %ebp
+  800179:	68 82 01 80 00       	push   $0x800182
+  80017e:	89 e5                	mov    %esp,%ebp
+  800180:	0f 34                	sysenter
+  800182:	83 c4 04             	add    $0x4,%esp
+  800185:	5d                   	pop    %ebp
+	return ret;
+  800186:	eb 98                	jmp    800120 <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800188:	b8 01 00 00 00       	mov    $0x1,%eax
+  80018d:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  80018f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800194:	f6 c6 08             	test   $0x8,%dh
+  800197:	74 15                	je     8001ae <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800199:	89 c2                	mov    %eax,%edx
+  80019b:	c1 ea 08             	shr    $0x8,%edx
+  80019e:	83 e2 0f             	and    $0xf,%edx
+  8001a1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8001a6:	83 fa 06             	cmp    $0x6,%edx
+  8001a9:	74 0e                	je     8001b9 <page_vec_call+0x125>
+  8001ab:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8001ae:	0f b6 c9             	movzbl %cl,%ecx
+  8001b1:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8001b7:	eb a0                	jmp    800159 <page_vec_call+0xc5>
+  8001b9:	89 c2                	mov    %eax,%edx
+  8001bb:	c1 ea 04             	shr    $0x4,%edx
+  8001be:	83 e2 0f             	and    $0xf,%edx
+  8001c1:	83 fa 02             	cmp    $0x2,%edx
+  8001c4:	77 e5                	ja     8001ab <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  8001c6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8001c9:	83 f8 02             	cmp    $0x2,%eax
+  8001cc:	0f 97 c1             	seta   %cl
+  8001cf:	0f b6 c9             	movzbl %cl,%ecx
+  8001d2:	eb d7                	jmp    8001ab <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  8001d4:	b8 10 00 00 00       	mov    $0x10,%eax
+  8001d9:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  8001df:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  8001e5:	89 fb                	mov    %edi,%ebx
+  8001e7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8001ea:	cd 30                	int    $0x30
+  8001ec:	e9 2f ff ff ff       	jmp    800120 <page_vec_call+0x8c>
+  8001f1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8001f6:	0f a2                	cpuid
+		return 0;
+  8001f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8001fd:	f6 c6 08             	test   $0x8,%dh
+  800200:	74 15                	je     800217 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800202:	89 c2                	mov    %eax,%edx
+  800204:	c1 ea 08             	shr    $0x8,%edx
+  800207:	83 e2 0f             	and    $0xf,%edx
+  80020a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80020f:	83 fa 06             	cmp    $0x6,%edx
+  800212:	74 11                	je     800225 <page_vec_call+0x191>
+  800214:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800217:	0f b6 c9             	movzbl %cl,%ecx
+  80021a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800220:	e9 c6 fe ff ff       	jmp    8000eb <page_vec_call+0x57>
+  800225:	89 c2                	mov    %eax,%edx
+  800227:	c1 ea 04             	shr    $0x4,%edx
+  80022a:	83 e2 0f             	and    $0xf,%edx
+  80022d:	83 fa 02             	cmp    $0x2,%edx
+  800230:	77 e2                	ja     800214 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800232:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800235:	83 f8 02             	cmp    $0x2,%eax
+  800238:	0f 97 c1             	seta   %cl
+  80023b:	0f b6 c9             	movzbl %cl,%ecx
+  80023e:	eb d4                	jmp    800214 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800240:	be 00 00 00 00       	mov    $0x0,%esi
+  800245:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  80024b:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800251:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800257:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80025a:	cd 30                	int    $0x30
+  80025c:	e9 bf fe ff ff       	jmp    800120 <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800261:	29 da                	sub    %ebx,%edx
+			vec++;
+  800263:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800266:	83 e8 01             	sub    $0x1,%eax
+  800269:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  80026e:	85 c0                	test   %eax,%eax
+  800270:	74 58                	je     8002ca <page_vec_call+0x236>
+  800272:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800275:	39 da                	cmp    %ebx,%edx
+  800277:	73 e8                	jae    800261 <page_vec_call+0x1cd>
+  800279:	89 75 08             	mov    %esi,0x8(%ebp)
+  80027c:	89 45 0c             	mov    %eax,0xc(%ebp)
+  80027f:	84 c9                	test   %cl,%cl
+  800281:	74 06                	je     800289 <page_vec_call+0x1f5>
+  800283:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800289:	83 ec 04             	sub    $0x4,%esp
+  80028c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80028f:	c1 e0 04             	shl    $0x4,%eax
+  800292:	50                   	push   %eax
+  800293:	ff 75 08             	push   0x8(%ebp)
+  800296:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  80029c:	53                   	push   %ebx
+  80029d:	e8 41 21 00 00       	call   8023e3 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  8002a2:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  8002a8:	89 c2                	mov    %eax,%edx
+  8002aa:	c1 e2 0c             	shl    $0xc,%edx
+  8002ad:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  8002b3:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  8002b9:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  8002bf:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  8002c2:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  8002c5:	e9 f2 fd ff ff       	jmp    8000bc <page_vec_call+0x28>
+			r = 0;
+  8002ca:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  8002cf:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8002d3:	74 0b                	je     8002e0 <page_vec_call+0x24c>
+		*done = total;
+  8002d5:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002d8:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  8002de:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  8002e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002e3:	5b                   	pop    %ebx
+  8002e4:	5e                   	pop    %esi
+  8002e5:	5f                   	pop    %edi
+  8002e6:	5d                   	pop    %ebp
+  8002e7:	c3                   	ret
+
+008002e8 <sys_cputs>:
+{
+  8002e8:	55                   	push   %ebp
+  8002e9:	89 e5                	mov    %esp,%ebp
+  8002eb:	57                   	push   %edi
+  8002ec:	56                   	push   %esi
+  8002ed:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8002ee:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8002f5:	78 2d                	js     800324 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  8002f7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8002fe:	74 70                	je     800370 <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800300:	b8 00 00 00 00       	mov    $0x0,%eax
+  800305:	8b 55 08             	mov    0x8(%ebp),%edx
+  800308:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80030b:	89 c3                	mov    %eax,%ebx
+  80030d:	89 c7                	mov    %eax,%edi
+  80030f:	89 c6                	mov    %eax,%esi
+  800311:	55                   	push   %ebp
+  800312:	68 1b 03 80 00       	push   $0x80031b
+  800317:	89 e5                	mov    %esp,%ebp
+  800319:	0f 34                	sysenter
+  80031b:	83 c4 04             	add    $0x4,%esp
+  80031e:	5d                   	pop    %ebp
+}
+  80031f:	5b                   	pop    %ebx
+  800320:	5e                   	pop    %esi
+  800321:	5f                   	pop    %edi
+  800322:	5d                   	pop    %ebp
+  800323:	c3                   	ret
+  800324:	b8 01 00 00 00       	mov    $0x1,%eax
+  800329:	0f a2                	cpuid
+		return 0;
+  80032b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800330:	f6 c6 08             	test   $0x8,%dh
+  800333:	74 15                	je     80034a <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800335:	89 c2                	mov    %eax,%edx
+  800337:	c1 ea 08             	shr    $0x8,%edx
+  80033a:	83 e2 0f             	and    $0xf,%edx
+  80033d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800342:	83 fa 06             	cmp    $0x6,%edx
+  800345:	74 0e                	je     800355 <sys_cputs+0x6d>
+  800347:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80034a:	0f b6 c9             	movzbl %cl,%ecx
+  80034d:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800353:	eb a2                	jmp    8002f7 <sys_cputs+0xf>
+  800355:	89 c2                	mov    %eax,%edx
+  800357:	c1 ea 04             	shr    $0x4,%edx
+  80035a:	83 e2 0f             	and    $0xf,%edx
+  80035d:	83 fa 02             	cmp    $0x2,%edx
+  800360:	77 e5                	ja     800347 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800362:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800365:	83 f8 02             	cmp    $0x2,%eax
+  800368:	0f 97 c1             	seta   %cl
+  80036b:	0f b6 c9             	movzbl %cl,%ecx
+  80036e:	eb d7                	jmp    800347 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800370:	b8 00 00 00 00       	mov    $0x0,%eax
+  800375:	8b 55 08             	mov    0x8(%ebp),%edx
+  800378:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80037b:	89 c3                	mov    %eax,%ebx
+  80037d:	89 c7                	mov    %eax,%edi
+  80037f:	89 c6                	mov    %eax,%esi
+  800381:	cd 30                	int    $0x30
+}
+  800383:	eb 9a                	jmp    80031f <sys_cputs+0x37>
+
+00800385 <sys_cgetc>:
+{
+  800385:	55                   	push   %ebp
+  800386:	89 e5                	mov    %esp,%ebp
+  800388:	57                   	push   %edi
+  800389:	56                   	push   %esi
+  80038a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80038b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800392:	78 2e                	js     8003c2 <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  800394:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80039b:	74 71                	je     80040e <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  80039d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003a2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8003a7:	89 d1                	mov    %edx,%ecx
+  8003a9:	89 d3                	mov    %edx,%ebx
+  8003ab:	89 d7                	mov    %edx,%edi
+  8003ad:	89 d6                	mov    %edx,%esi
+  8003af:	55                   	push   %ebp
+  8003b0:	68 b9 03 80 00       	push   $0x8003b9
+  8003b5:	89 e5                	mov    %esp,%ebp
+  8003b7:	0f 34                	sysenter
+  8003b9:	83 c4 04             	add    $0x4,%esp
+  8003bc:	5d                   	pop    %ebp
+}
+  8003bd:	5b                   	pop    %ebx
+  8003be:	5e                   	pop    %esi
+  8003bf:	5f                   	pop    %edi
+  8003c0:	5d                   	pop    %ebp
+  8003c1:	c3                   	ret
+  8003c2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8003c7:	0f a2                	cpuid
+		return 0;
+  8003c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8003ce:	f6 c6 08             	test   $0x8,%dh
+  8003d1:	74 15                	je     8003e8 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8003d3:	89 c2                	mov    %eax,%edx
+  8003d5:	c1 ea 08             	shr    $0x8,%edx
+  8003d8:	83 e2 0f             	and    $0xf,%edx
+  8003db:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8003e0:	83 fa 06             	cmp    $0x6,%edx
+  8003e3:	74 0e                	je     8003f3 <sys_cgetc+0x6e>
+  8003e5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8003e8:	0f b6 c9             	movzbl %cl,%ecx
+  8003eb:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8003f1:	eb a1                	jmp    800394 <sys_cgetc+0xf>
+  8003f3:	89 c2                	mov    %eax,%edx
+  8003f5:	c1 ea 04             	shr    $0x4,%edx
+  8003f8:	83 e2 0f             	and    $0xf,%edx
+  8003fb:	83 fa 02             	cmp    $0x2,%edx
+  8003fe:	77 e5                	ja     8003e5 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  800400:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800403:	83 f8 02             	cmp    $0x2,%eax
+  800406:	0f 97 c1             	seta   %cl
+  800409:	0f b6 c9             	movzbl %cl,%ecx
+  80040c:	eb d7                	jmp    8003e5 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  80040e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800413:	b8 01 00 00 00       	mov    $0x1,%eax
+  800418:	89 d1                	mov    %edx,%ecx
+  80041a:	89 d3                	mov    %edx,%ebx
+  80041c:	89 d7                	mov    %edx,%edi
+  80041e:	89 d6                	mov    %edx,%esi
+  800420:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800422:	eb 99                	jmp    8003bd <sys_cgetc+0x38>
+
+00800424 <sys_env_destroy>:
+{
+  800424:	55                   	push   %ebp
+  800425:	89 e5                	mov    %esp,%ebp
+  800427:	57                   	push   %edi
+  800428:	56                   	push   %esi
+  800429:	53                   	push   %ebx
+  80042a:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80042d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800434:	78 36                	js     80046c <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  800436:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80043d:	74 79                	je     8004b8 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  80043f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800442:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800447:	b8 03 00 00 00       	mov    $0x3,%eax
+  80044c:	89 cb                	mov    %ecx,%ebx
+  80044e:	89 cf                	mov    %ecx,%edi
+  800450:	89 ce                	mov    %ecx,%esi
+  800452:	55                   	push   %ebp
+  800453:	68 5c 04 80 00       	push   $0x80045c
+  800458:	89 e5                	mov    %esp,%ebp
+  80045a:	0f 34                	sysenter
+  80045c:	83 c4 04             	add    $0x4,%esp
+  80045f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800460:	85 c0                	test   %eax,%eax
+  800462:	7f 6b                	jg     8004cf <sys_env_destroy+0xab>
+}
+  800464:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800467:	5b                   	pop    %ebx
+  800468:	5e                   	pop    %esi
+  800469:	5f                   	pop    %edi
+  80046a:	5d                   	pop    %ebp
+  80046b:	c3                   	ret
+  80046c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800471:	0f a2                	cpuid
+		return 0;
+  800473:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800478:	f6 c6 08             	test   $0x8,%dh
+  80047b:	74 15                	je     800492 <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80047d:	89 c2                	mov    %eax,%edx
+  80047f:	c1 ea 08             	shr    $0x8,%edx
+  800482:	83 e2 0f             	and    $0xf,%edx
+  800485:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80048a:	83 fa 06             	cmp    $0x6,%edx
+  80048d:	74 0e                	je     80049d <sys_env_destroy+0x79>
+  80048f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800492:	0f b6 c9             	movzbl %cl,%ecx
+  800495:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80049b:	eb 99                	jmp    800436 <sys_env_destroy+0x12>
+  80049d:	89 c2                	mov    %eax,%edx
+  80049f:	c1 ea 04             	shr    $0x4,%edx
+  8004a2:	83 e2 0f             	and    $0xf,%edx
+  8004a5:	83 fa 02             	cmp    $0x2,%edx
+  8004a8:	77 e5                	ja     80048f <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  8004aa:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8004ad:	83 f8 02             	cmp    $0x2,%eax
+  8004b0:	0f 97 c1             	seta   %cl
+  8004b3:	0f b6 c9             	movzbl %cl,%ecx
+  8004b6:	eb d7                	jmp    80048f <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  8004b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004bd:	b8 03 00 00 00       	mov    $0x3,%eax
+  8004c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004c5:	89 cb                	mov    %ecx,%ebx
+  8004c7:	89 cf                	mov    %ecx,%edi
+  8004c9:	89 ce                	mov    %ecx,%esi
+  8004cb:	cd 30                	int    $0x30
+  8004cd:	eb 91                	jmp    800460 <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004cf:	83 ec 0c             	sub    $0xc,%esp
+  8004d2:	50                   	push   %eax
+  8004d3:	6a 03                	push   $0x3
+  8004d5:	68 ca 27 80 00       	push   $0x8027ca
+  8004da:	6a 4a                	push   $0x4a
+  8004dc:	68 e7 27 80 00       	push   $0x8027e7
+  8004e1:	e8 1e 17 00 00       	call   801c04 <_panic>
+
+008004e6 <sys_getenvid>:
+{
+  8004e6:	55                   	push   %ebp
+  8004e7:	89 e5                	mov    %esp,%ebp
+  8004e9:	57                   	push   %edi
+  8004ea:	56                   	push   %esi
+  8004eb:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8004ec:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8004f3:	78 2e                	js     800523 <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  8004f5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8004fc:	74 71                	je     80056f <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  8004fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  800503:	b8 02 00 00 00       	mov    $0x2,%eax
+  800508:	89 d1                	mov    %edx,%ecx
+  80050a:	89 d3                	mov    %edx,%ebx
+  80050c:	89 d7                	mov    %edx,%edi
+  80050e:	89 d6                	mov    %edx,%esi
+  800510:	55                   	push   %ebp
+  800511:	68 1a 05 80 00       	push   $0x80051a
+  800516:	89 e5                	mov    %esp,%ebp
+  800518:	0f 34                	sysenter
+  80051a:	83 c4 04             	add    $0x4,%esp
+  80051d:	5d                   	pop    %ebp
+}
+  80051e:	5b                   	pop    %ebx
+  80051f:	5e                   	pop    %esi
+  800520:	5f                   	pop    %edi
+  800521:	5d                   	pop    %ebp
+  800522:	c3                   	ret
+  800523:	b8 01 00 00 00       	mov    $0x1,%eax
+  800528:	0f a2                	cpuid
+		return 0;
+  80052a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80052f:	f6 c6 08             	test   $0x8,%dh
+  800532:	74 15                	je     800549 <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800534:	89 c2                	mov    %eax,%edx
+  800536:	c1 ea 08             	shr    $0x8,%edx
+  800539:	83 e2 0f             	and    $0xf,%edx
+  80053c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800541:	83 fa 06             	cmp    $0x6,%edx
+  800544:	74 0e                	je     800554 <sys_getenvid+0x6e>
+  800546:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800549:	0f b6 c9             	movzbl %cl,%ecx
+  80054c:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800552:	eb a1                	jmp    8004f5 <sys_getenvid+0xf>
+  800554:	89 c2                	mov    %eax,%edx
+  800556:	c1 ea 04             	shr    $0x4,%edx
+  800559:	83 e2 0f             	and    $0xf,%edx
+  80055c:	83 fa 02             	cmp    $0x2,%edx
+  80055f:	77 e5                	ja     800546 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  800561:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800564:	83 f8 02             	cmp    $0x2,%eax
+  800567:	0f 97 c1             	seta   %cl
+  80056a:	0f b6 c9             	movzbl %cl,%ecx
+  80056d:	eb d7                	jmp    800546 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  80056f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800574:	b8 02 00 00 00       	mov    $0x2,%eax
+  800579:	89 d1                	mov    %edx,%ecx
+  80057b:	89 d3                	mov    %edx,%ebx
+  80057d:	89 d7                	mov    %edx,%edi
+  80057f:	89 d6                	mov    %edx,%esi
+  800581:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  800583:	eb 99                	jmp    80051e <sys_getenvid+0x38>
+
+00800585 <sys_page_alloc>:
+{
+  800585:	55                   	push   %ebp
+  800586:	89 e5                	mov    %esp,%ebp
+  800588:	57                   	push   %edi
+  800589:	56                   	push   %esi
+  80058a:	53                   	push   %ebx
+  80058b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80058e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800595:	78 38                	js     8005cf <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  800597:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80059e:	74 7b                	je     80061b <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  8005a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8005a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005ab:	b8 04 00 00 00       	mov    $0x4,%eax
+  8005b0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005b3:	89 f7                	mov    %esi,%edi
+  8005b5:	55                   	push   %ebp
+  8005b6:	68 bf 05 80 00       	push   $0x8005bf
+  8005bb:	89 e5                	mov    %esp,%ebp
+  8005bd:	0f 34                	sysenter
+  8005bf:	83 c4 04             	add    $0x4,%esp
+  8005c2:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8005c3:	85 c0                	test   %eax,%eax
+  8005c5:	7f 6d                	jg     800634 <sys_page_alloc+0xaf>
+}
+  8005c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005ca:	5b                   	pop    %ebx
+  8005cb:	5e                   	pop    %esi
+  8005cc:	5f                   	pop    %edi
+  8005cd:	5d                   	pop    %ebp
+  8005ce:	c3                   	ret
+  8005cf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8005d4:	0f a2                	cpuid
+		return 0;
+  8005d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8005db:	f6 c6 08             	test   $0x8,%dh
+  8005de:	74 15                	je     8005f5 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8005e0:	89 c2                	mov    %eax,%edx
+  8005e2:	c1 ea 08             	shr    $0x8,%edx
+  8005e5:	83 e2 0f             	and    $0xf,%edx
+  8005e8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8005ed:	83 fa 06             	cmp    $0x6,%edx
+  8005f0:	74 0e                	je     800600 <sys_page_alloc+0x7b>
+  8005f2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8005f5:	0f b6 c9             	movzbl %cl,%ecx
+  8005f8:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8005fe:	eb 97                	jmp    800597 <sys_page_alloc+0x12>
+  800600:	89 c2                	mov    %eax,%edx
+  800602:	c1 ea 04             	shr    $0x4,%edx
+  800605:	83 e2 0f             	and    $0xf,%edx
+  800608:	83 fa 02             	cmp    $0x2,%edx
+  80060b:	77 e5                	ja     8005f2 <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  80060d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800610:	83 f8 02             	cmp    $0x2,%eax
+  800613:	0f 97 c1             	seta   %cl
+  800616:	0f b6 c9             	movzbl %cl,%ecx
+  800619:	eb d7                	jmp    8005f2 <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  80061b:	be 00 00 00 00       	mov    $0x0,%esi
+  800620:	b8 04 00 00 00       	mov    $0x4,%eax
+  800625:	8b 55 08             	mov    0x8(%ebp),%edx
+  800628:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80062b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80062e:	89 f7                	mov    %esi,%edi
+  800630:	cd 30                	int    $0x30
+  800632:	eb 8f                	jmp    8005c3 <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800634:	83 ec 0c             	sub    $0xc,%esp
+  800637:	50                   	push   %eax
+  800638:	6a 04                	push   $0x4
+  80063a:	68 ca 27 80 00       	push   $0x8027ca
+  80063f:	6a 4a                	push   $0x4a
+  800641:	68 e7 27 80 00       	push   $0x8027e7
+  800646:	e8 b9 15 00 00       	call   801c04 <_panic>
+
+0080064b <sys_page_map>:
+{
+  80064b:	55                   	push   %ebp
+  80064c:	89 e5                	mov    %esp,%ebp
+  80064e:	57                   	push   %edi
+  80064f:	56                   	push   %esi
+  800650:	53                   	push   %ebx
+  800651:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800654:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80065b:	78 37                	js     800694 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  80065d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800664:	74 7a                	je     8006e0 <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  800666:	8b 55 08             	mov    0x8(%ebp),%edx
+  800669:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80066c:	b8 05 00 00 00       	mov    $0x5,%eax
+  800671:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800674:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800677:	8b 75 18             	mov    0x18(%ebp),%esi
+  80067a:	55                   	push   %ebp
+  80067b:	68 84 06 80 00       	push   $0x800684
+  800680:	89 e5                	mov    %esp,%ebp
+  800682:	0f 34                	sysenter
+  800684:	83 c4 04             	add    $0x4,%esp
+  800687:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800688:	85 c0                	test   %eax,%eax
+  80068a:	7f 6c                	jg     8006f8 <sys_page_map+0xad>
+}
+  80068c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80068f:	5b                   	pop    %ebx
+  800690:	5e                   	pop    %esi
+  800691:	5f                   	pop    %edi
+  800692:	5d                   	pop    %ebp
+  800693:	c3                   	ret
+  800694:	b8 01 00 00 00       	mov    $0x1,%eax
+  800699:	0f a2                	cpuid
+		return 0;
+  80069b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8006a0:	f6 c6 08             	test   $0x8,%dh
+  8006a3:	74 15                	je     8006ba <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8006a5:	89 c2                	mov    %eax,%edx
+  8006a7:	c1 ea 08             	shr    $0x8,%edx
+  8006aa:	83 e2 0f             	and    $0xf,%edx
+  8006ad:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8006b2:	83 fa 06             	cmp    $0x6,%edx
+  8006b5:	74 0e                	je     8006c5 <sys_page_map+0x7a>
+  8006b7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8006ba:	0f b6 c9             	movzbl %cl,%ecx
+  8006bd:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8006c3:	eb 98                	jmp    80065d <sys_page_map+0x12>
+  8006c5:	89 c2                	mov    %eax,%edx
+  8006c7:	c1 ea 04             	shr    $0x4,%edx
+  8006ca:	83 e2 0f             	and    $0xf,%edx
+  8006cd:	83 fa 02             	cmp    $0x2,%edx
+  8006d0:	77 e5                	ja     8006b7 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  8006d2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8006d5:	83 f8 02             	cmp    $0x2,%eax
+  8006d8:	0f 97 c1             	seta   %cl
+  8006db:	0f b6 c9             	movzbl %cl,%ecx
+  8006de:	eb d7                	jmp    8006b7 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  8006e0:	b8 05 00 00 00       	mov    $0x5,%eax
+  8006e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006eb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8006ee:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8006f1:	8b 75 18             	mov    0x18(%ebp),%esi
+  8006f4:	cd 30                	int    $0x30
+  8006f6:	eb 90                	jmp    800688 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8006f8:	83 ec 0c             	sub    $0xc,%esp
+  8006fb:	50                   	push   %eax
+  8006fc:	6a 05                	push   $0x5
+  8006fe:	68 ca 27 80 00       	push   $0x8027ca
+  800703:	6a 4a                	push   $0x4a
+  800705:	68 e7 27 80 00       	push   $0x8027e7
+  80070a:	e8 f5 14 00 00       	call   801c04 <_panic>
+
+0080070f <sys_page_unmap>:
+{
+  80070f:	55                   	push   %ebp
+  800710:	89 e5                	mov    %esp,%ebp
+  800712:	57                   	push   %edi
+  800713:	56                   	push   %esi
+  800714:	53                   	push   %ebx
+  800715:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800718:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80071f:	78 37                	js     800758 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  800721:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800728:	74 7a                	je     8007a4 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  80072a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80072f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800732:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800735:	b8 06 00 00 00       	mov    $0x6,%eax
+  80073a:	89 df                	mov    %ebx,%edi
+  80073c:	89 de                	mov    %ebx,%esi
+  80073e:	55                   	push   %ebp
+  80073f:	68 48 07 80 00       	push   $0x800748
+  800744:	89 e5                	mov    %esp,%ebp
+  800746:	0f 34                	sysenter
+  800748:	83 c4 04             	add    $0x4,%esp
+  80074b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80074c:	85 c0                	test   %eax,%eax
+  80074e:	7f 6c                	jg     8007bc <sys_page_unmap+0xad>
+}
+  800750:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800753:	5b                   	pop    %ebx
+  800754:	5e                   	pop    %esi
+  800755:	5f                   	pop    %edi
+  800756:	5d                   	pop    %ebp
+  800757:	c3                   	ret
+  800758:	b8 01 00 00 00       	mov    $0x1,%eax
+  80075d:	0f a2                	cpuid
+		return 0;
+  80075f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800764:	f6 c6 08             	test   $0x8,%dh
+  800767:	74 15                	je     80077e <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800769:	89 c2                	mov    %eax,%edx
+  80076b:	c1 ea 08             	shr    $0x8,%edx
+  80076e:	83 e2 0f             	and    $0xf,%edx
+  800771:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800776:	83 fa 06             	cmp    $0x6,%edx
+  800779:	74 0e                	je     800789 <sys_page_unmap+0x7a>
+  80077b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80077e:	0f b6 c9             	movzbl %cl,%ecx
+  800781:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800787:	eb 98                	jmp    800721 <sys_page_unmap+0x12>
+  800789:	89 c2                	mov    %eax,%edx
+  80078b:	c1 ea 04             	shr    $0x4,%edx
+  80078e:	83 e2 0f             	and    $0xf,%edx
+  800791:	83 fa 02             	cmp    $0x2,%edx
+  800794:	77 e5                	ja     80077b <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  800796:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800799:	83 f8 02             	cmp    $0x2,%eax
+  80079c:	0f 97 c1             	seta   %cl
+  80079f:	0f b6 c9             	movzbl %cl,%ecx
+  8007a2:	eb d7                	jmp    80077b <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  8007a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007a9:	b8 06 00 00 00       	mov    $0x6,%eax
+  8007ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007b4:	89 df                	mov    %ebx,%edi
+  8007b6:	89 de                	mov    %ebx,%esi
+  8007b8:	cd 30                	int    $0x30
+  8007ba:	eb 90                	jmp    80074c <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8007bc:	83 ec 0c             	sub    $0xc,%esp
+  8007bf:	50                   	push   %eax
+  8007c0:	6a 06                	push   $0x6
+  8007c2:	68 ca 27 80 00       	push   $0x8027ca
+  8007c7:	6a 4a                	push   $0x4a
+  8007c9:	68 e7 27 80 00       	push   $0x8027e7
+  8007ce:	e8 31 14 00 00       	call   801c04 <_panic>
+
+008007d3 <sys_page_copy>:
+{
+  8007d3:	55                   	push   %ebp
+  8007d4:	89 e5                	mov    %esp,%ebp
+  8007d6:	57                   	push   %edi
+  8007d7:	56                   	push   %esi
+  8007d8:	53                   	push   %ebx
+  8007d9:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8007dc:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8007e3:	78 37                	js     80081c <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  8007e5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8007ec:	74 7a                	je     800868 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  8007ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007f4:	b8 29 00 00 00       	mov    $0x29,%eax
+  8007f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8007fc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8007ff:	8b 75 18             	mov    0x18(%ebp),%esi
+  800802:	55                   	push   %ebp
+  800803:	68 0c 08 80 00       	push   $0x80080c
+  800808:	89 e5                	mov    %esp,%ebp
+  80080a:	0f 34                	sysenter
+  80080c:	83 c4 04             	add    $0x4,%esp
+  80080f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800810:	85 c0                	test   %eax,%eax
+  800812:	7f 6c                	jg     800880 <sys_page_copy+0xad>
+}
+  800814:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800817:	5b                   	pop    %ebx
+  800818:	5e                   	pop    %esi
+  800819:	5f                   	pop    %edi
+  80081a:	5d                   	pop    %ebp
+  80081b:	c3                   	ret
+  80081c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800821:	0f a2                	cpuid
+		return 0;
+  800823:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800828:	f6 c6 08             	test   $0x8,%dh
+  80082b:	74 15                	je     800842 <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80082d:	89 c2                	mov    %eax,%edx
+  80082f:	c1 ea 08             	shr    $0x8,%edx
+  800832:	83 e2 0f             	and    $0xf,%edx
+  800835:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80083a:	83 fa 06             	cmp    $0x6,%edx
+  80083d:	74 0e                	je     80084d <sys_page_copy+0x7a>
+  80083f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800842:	0f b6 c9             	movzbl %cl,%ecx
+  800845:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80084b:	eb 98                	jmp    8007e5 <sys_page_copy+0x12>
+  80084d:	89 c2                	mov    %eax,%edx
+  80084f:	c1 ea 04             	shr    $0x4,%edx
+  800852:	83 e2 0f             	and    $0xf,%edx
+  800855:	83 fa 02             	cmp    $0x2,%edx
+  800858:	77 e5                	ja     80083f <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  80085a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80085d:	83 f8 02             	cmp    $0x2,%eax
+  800860:	0f 97 c1             	seta   %cl
+  800863:	0f b6 c9             	movzbl %cl,%ecx
+  800866:	eb d7                	jmp    80083f <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  800868:	b8 29 00 00 00       	mov    $0x29,%eax
+  80086d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800870:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800873:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800876:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800879:	8b 75 18             	mov    0x18(%ebp),%esi
+  80087c:	cd 30                	int    $0x30
+  80087e:	eb 90                	jmp    800810 <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800880:	83 ec 0c             	sub    $0xc,%esp
+  800883:	50                   	push   %eax
+  800884:	6a 29                	push   $0x29
+  800886:	68 ca 27 80 00       	push   $0x8027ca
+  80088b:	6a 4a                	push   $0x4a
+  80088d:	68 e7 27 80 00       	push   $0x8027e7
+  800892:	e8 6d 13 00 00       	call   801c04 <_panic>
+
+00800897 <sys_yield>:
+{
+  800897:	55                   	push   %ebp
+  800898:	89 e5                	mov    %esp,%ebp
+  80089a:	57                   	push   %edi
+  80089b:	56                   	push   %esi
+  80089c:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80089d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8008a4:	78 2e                	js     8008d4 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  8008a6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8008ad:	74 71                	je     800920 <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  8008af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008b4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8008b9:	89 d1                	mov    %edx,%ecx
+  8008bb:	89 d3                	mov    %edx,%ebx
+  8008bd:	89 d7                	mov    %edx,%edi
+  8008bf:	89 d6                	mov    %edx,%esi
+  8008c1:	55                   	push   %ebp
+  8008c2:	68 cb 08 80 00       	push   $0x8008cb
+  8008c7:	89 e5                	mov    %esp,%ebp
+  8008c9:	0f 34                	sysenter
+  8008cb:	83 c4 04             	add    $0x4,%esp
+  8008ce:	5d                   	pop    %ebp
+}
+  8008cf:	5b                   	pop    %ebx
+  8008d0:	5e                   	pop    %esi
+  8008d1:	5f                   	pop    %edi
+  8008d2:	5d                   	pop    %ebp
+  8008d3:	c3                   	ret
+  8008d4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8008d9:	0f a2                	cpuid
+		return 0;
+  8008db:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8008e0:	f6 c6 08             	test   $0x8,%dh
+  8008e3:	74 15                	je     8008fa <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8008e5:	89 c2                	mov    %eax,%edx
+  8008e7:	c1 ea 08             	shr    $0x8,%edx
+  8008ea:	83 e2 0f             	and    $0xf,%edx
+  8008ed:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8008f2:	83 fa 06             	cmp    $0x6,%edx
+  8008f5:	74 0e                	je     800905 <sys_yield+0x6e>
+  8008f7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8008fa:	0f b6 c9             	movzbl %cl,%ecx
+  8008fd:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800903:	eb a1                	jmp    8008a6 <sys_yield+0xf>
+  800905:	89 c2                	mov    %eax,%edx
+  800907:	c1 ea 04             	shr    $0x4,%edx
+  80090a:	83 e2 0f             	and    $0xf,%edx
+  80090d:	83 fa 02             	cmp    $0x2,%edx
+  800910:	77 e5                	ja     8008f7 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  800912:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800915:	83 f8 02             	cmp    $0x2,%eax
+  800918:	0f 97 c1             	seta   %cl
+  80091b:	0f b6 c9             	movzbl %cl,%ecx
+  80091e:	eb d7                	jmp    8008f7 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  800920:	ba 00 00 00 00       	mov    $0x0,%edx
+  800925:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80092a:	89 d1                	mov    %edx,%ecx
+  80092c:	89 d3                	mov    %edx,%ebx
+  80092e:	89 d7                	mov    %edx,%edi
+  800930:	89 d6                	mov    %edx,%esi
+  800932:	cd 30                	int    $0x30
+}
+  800934:	eb 99                	jmp    8008cf <sys_yield+0x38>
+
+00800936 <sys_env_set_status>:
+{
+  800936:	55                   	push   %ebp
+  800937:	89 e5                	mov    %esp,%ebp
+  800939:	57                   	push   %edi
+  80093a:	56                   	push   %esi
+  80093b:	53                   	push   %ebx
+  80093c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80093f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800946:	78 37                	js     80097f <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  800948:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80094f:	74 7a                	je     8009cb <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  800951:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800956:	8b 55 08             	mov    0x8(%ebp),%edx
+  800959:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80095c:	b8 08 00 00 00       	mov    $0x8,%eax
+  800961:	89 df                	mov    %ebx,%edi
+  800963:	89 de                	mov    %ebx,%esi
+  800965:	55                   	push   %ebp
+  800966:	68 6f 09 80 00       	push   $0x80096f
+  80096b:	89 e5                	mov    %esp,%ebp
+  80096d:	0f 34                	sysenter
+  80096f:	83 c4 04             	add    $0x4,%esp
+  800972:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800973:	85 c0                	test   %eax,%eax
+  800975:	7f 6c                	jg     8009e3 <sys_env_set_status+0xad>
+}
+  800977:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80097a:	5b                   	pop    %ebx
+  80097b:	5e                   	pop    %esi
+  80097c:	5f                   	pop    %edi
+  80097d:	5d                   	pop    %ebp
+  80097e:	c3                   	ret
+  80097f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800984:	0f a2                	cpuid
+		return 0;
+  800986:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80098b:	f6 c6 08             	test   $0x8,%dh
+  80098e:	74 15                	je     8009a5 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800990:	89 c2                	mov    %eax,%edx
+  800992:	c1 ea 08             	shr    $0x8,%edx
+  800995:	83 e2 0f             	and    $0xf,%edx
+  800998:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80099d:	83 fa 06             	cmp    $0x6,%edx
+  8009a0:	74 0e                	je     8009b0 <sys_env_set_status+0x7a>
+  8009a2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8009a5:	0f b6 c9             	movzbl %cl,%ecx
+  8009a8:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8009ae:	eb 98                	jmp    800948 <sys_env_set_status+0x12>
+  8009b0:	89 c2                	mov    %eax,%edx
+  8009b2:	c1 ea 04             	shr    $0x4,%edx
+  8009b5:	83 e2 0f             	and    $0xf,%edx
+  8009b8:	83 fa 02             	cmp    $0x2,%edx
+  8009bb:	77 e5                	ja     8009a2 <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  8009bd:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8009c0:	83 f8 02             	cmp    $0x2,%eax
+  8009c3:	0f 97 c1             	seta   %cl
+  8009c6:	0f b6 c9             	movzbl %cl,%ecx
+  8009c9:	eb d7                	jmp    8009a2 <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  8009cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009d0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8009d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009db:	89 df                	mov    %ebx,%edi
+  8009dd:	89 de                	mov    %ebx,%esi
+  8009df:	cd 30                	int    $0x30
+  8009e1:	eb 90                	jmp    800973 <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8009e3:	83 ec 0c             	sub    $0xc,%esp
+  8009e6:	50                   	push   %eax
+  8009e7:	6a 08                	push   $0x8
+  8009e9:	68 ca 27 80 00       	push   $0x8027ca
+  8009ee:	6a 4a                	push   $0x4a
+  8009f0:	68 e7 27 80 00       	push   $0x8027e7
+  8009f5:	e8 0a 12 00 00       	call   801c04 <_panic>
+
+008009fa <sys_sysinfo>:
+{
+  8009fa:	55                   	push   %ebp
+  8009fb:	89 e5                	mov    %esp,%ebp
+  8009fd:	57                   	push   %edi
+  8009fe:	56                   	push   %esi
+  8009ff:	53                   	push   %ebx
+  800a00:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800a03:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800a0a:	78 36                	js     800a42 <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  800a0c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800a13:	74 79                	je     800a8e <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  800a15:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a18:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a1d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800a22:	89 cb                	mov    %ecx,%ebx
+  800a24:	89 cf                	mov    %ecx,%edi
+  800a26:	89 ce                	mov    %ecx,%esi
+  800a28:	55                   	push   %ebp
+  800a29:	68 32 0a 80 00       	push   $0x800a32
+  800a2e:	89 e5                	mov    %esp,%ebp
+  800a30:	0f 34                	sysenter
+  800a32:	83 c4 04             	add    $0x4,%esp
+  800a35:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800a36:	85 c0                	test   %eax,%eax
+  800a38:	7f 6b                	jg     800aa5 <sys_sysinfo+0xab>
+}
+  800a3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a3d:	5b                   	pop    %ebx
+  800a3e:	5e                   	pop    %esi
+  800a3f:	5f                   	pop    %edi
+  800a40:	5d                   	pop    %ebp
+  800a41:	c3                   	ret
+  800a42:	b8 01 00 00 00       	mov    $0x1,%eax
+  800a47:	0f a2                	cpuid
+		return 0;
+  800a49:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800a4e:	f6 c6 08             	test   $0x8,%dh
+  800a51:	74 15                	je     800a68 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800a53:	89 c2                	mov    %eax,%edx
+  800a55:	c1 ea 08             	shr    $0x8,%edx
+  800a58:	83 e2 0f             	and    $0xf,%edx
+  800a5b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800a60:	83 fa 06             	cmp    $0x6,%edx
+  800a63:	74 0e                	je     800a73 <sys_sysinfo+0x79>
+  800a65:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800a68:	0f b6 c9             	movzbl %cl,%ecx
+  800a6b:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800a71:	eb 99                	jmp    800a0c <sys_sysinfo+0x12>
+  800a73:	89 c2                	mov    %eax,%edx
+  800a75:	c1 ea 04             	shr    $0x4,%edx
+  800a78:	83 e2 0f             	and    $0xf,%edx
+  800a7b:	83 fa 02             	cmp    $0x2,%edx
+  800a7e:	77 e5                	ja     800a65 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  800a80:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800a83:	83 f8 02             	cmp    $0x2,%eax
+  800a86:	0f 97 c1             	seta   %cl
+  800a89:	0f b6 c9             	movzbl %cl,%ecx
+  800a8c:	eb d7                	jmp    800a65 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  800a8e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a93:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800a98:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a9b:	89 cb                	mov    %ecx,%ebx
+  800a9d:	89 cf                	mov    %ecx,%edi
+  800a9f:	89 ce                	mov    %ecx,%esi
+  800aa1:	cd 30                	int    $0x30
+  800aa3:	eb 91                	jmp    800a36 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800aa5:	83 ec 0c             	sub    $0xc,%esp
+  800aa8:	50                   	push   %eax
+  800aa9:	6a 0b                	push   $0xb
+  800aab:	68 ca 27 80 00       	push   $0x8027ca
+  800ab0:	6a 4a                	push   $0x4a
+  800ab2:	68 e7 27 80 00       	push   $0x8027e7
+  800ab7:	e8 48 11 00 00       	call   801c04 <_panic>
+
+00800abc <sys_env_set_trapframe>:
+{
+  800abc:	55                   	push   %ebp
+  800abd:	89 e5                	mov    %esp,%ebp
+  800abf:	57                   	push   %edi
+  800ac0:	56                   	push   %esi
+  800ac1:	53                   	push   %ebx
+  800ac2:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800ac5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800acc:	78 37                	js     800b05 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  800ace:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ad5:	74 7a                	je     800b51 <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  800ad7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800adc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800adf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ae2:	b8 13 00 00 00       	mov    $0x13,%eax
+  800ae7:	89 df                	mov    %ebx,%edi
+  800ae9:	89 de                	mov    %ebx,%esi
+  800aeb:	55                   	push   %ebp
+  800aec:	68 f5 0a 80 00       	push   $0x800af5
+  800af1:	89 e5                	mov    %esp,%ebp
+  800af3:	0f 34                	sysenter
+  800af5:	83 c4 04             	add    $0x4,%esp
+  800af8:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800af9:	85 c0                	test   %eax,%eax
+  800afb:	7f 6c                	jg     800b69 <sys_env_set_trapframe+0xad>
+}
+  800afd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b00:	5b                   	pop    %ebx
+  800b01:	5e                   	pop    %esi
+  800b02:	5f                   	pop    %edi
+  800b03:	5d                   	pop    %ebp
+  800b04:	c3                   	ret
+  800b05:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b0a:	0f a2                	cpuid
+		return 0;
+  800b0c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800b11:	f6 c6 08             	test   $0x8,%dh
+  800b14:	74 15                	je     800b2b <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800b16:	89 c2                	mov    %eax,%edx
+  800b18:	c1 ea 08             	shr    $0x8,%edx
+  800b1b:	83 e2 0f             	and    $0xf,%edx
+  800b1e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800b23:	83 fa 06             	cmp    $0x6,%edx
+  800b26:	74 0e                	je     800b36 <sys_env_set_trapframe+0x7a>
+  800b28:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800b2b:	0f b6 c9             	movzbl %cl,%ecx
+  800b2e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800b34:	eb 98                	jmp    800ace <sys_env_set_trapframe+0x12>
+  800b36:	89 c2                	mov    %eax,%edx
+  800b38:	c1 ea 04             	shr    $0x4,%edx
+  800b3b:	83 e2 0f             	and    $0xf,%edx
+  800b3e:	83 fa 02             	cmp    $0x2,%edx
+  800b41:	77 e5                	ja     800b28 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  800b43:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800b46:	83 f8 02             	cmp    $0x2,%eax
+  800b49:	0f 97 c1             	seta   %cl
+  800b4c:	0f b6 c9             	movzbl %cl,%ecx
+  800b4f:	eb d7                	jmp    800b28 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  800b51:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b56:	b8 13 00 00 00       	mov    $0x13,%eax
+  800b5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b5e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b61:	89 df                	mov    %ebx,%edi
+  800b63:	89 de                	mov    %ebx,%esi
+  800b65:	cd 30                	int    $0x30
+  800b67:	eb 90                	jmp    800af9 <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b69:	83 ec 0c             	sub    $0xc,%esp
+  800b6c:	50                   	push   %eax
+  800b6d:	6a 13                	push   $0x13
+  800b6f:	68 ca 27 80 00       	push   $0x8027ca
+  800b74:	6a 4a                	push   $0x4a
+  800b76:	68 e7 27 80 00       	push   $0x8027e7
+  800b7b:	e8 84 10 00 00       	call   801c04 <_panic>
+
+00800b80 <sys_env_set_stack_limit>:
+{
+  800b80:	55                   	push   %ebp
+  800b81:	89 e5                	mov    %esp,%ebp
+  800b83:	57                   	push   %edi
+  800b84:	56                   	push   %esi
+  800b85:	53                   	push   %ebx
+  800b86:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800b89:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b90:	78 37                	js     800bc9 <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  800b92:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b99:	74 7a                	je     800c15 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  800b9b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ba0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ba3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ba6:	b8 19 00 00 00       	mov    $0x19,%eax
+  800bab:	89 df                	mov    %ebx,%edi
+  800bad:	89 de                	mov    %ebx,%esi
+  800baf:	55                   	push   %ebp
+  800bb0:	68 b9 0b 80 00       	push   $0x800bb9
+  800bb5:	89 e5                	mov    %esp,%ebp
+  800bb7:	0f 34                	sysenter
+  800bb9:	83 c4 04             	add    $0x4,%esp
+  800bbc:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800bbd:	85 c0                	test   %eax,%eax
+  800bbf:	7f 6c                	jg     800c2d <sys_env_set_stack_limit+0xad>
+}
+  800bc1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bc4:	5b                   	pop    %ebx
+  800bc5:	5e                   	pop    %esi
+  800bc6:	5f                   	pop    %edi
+  800bc7:	5d                   	pop    %ebp
+  800bc8:	c3                   	ret
+  800bc9:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bce:	0f a2                	cpuid
+		return 0;
+  800bd0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800bd5:	f6 c6 08             	test   $0x8,%dh
+  800bd8:	74 15                	je     800bef <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800bda:	89 c2                	mov    %eax,%edx
+  800bdc:	c1 ea 08             	shr    $0x8,%edx
+  800bdf:	83 e2 0f             	and    $0xf,%edx
+  800be2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800be7:	83 fa 06             	cmp    $0x6,%edx
+  800bea:	74 0e                	je     800bfa <sys_env_set_stack_limit+0x7a>
+  800bec:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800bef:	0f b6 c9             	movzbl %cl,%ecx
+  800bf2:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800bf8:	eb 98                	jmp    800b92 <sys_env_set_stack_limit+0x12>
+  800bfa:	89 c2                	mov    %eax,%edx
+  800bfc:	c1 ea 04             	shr    $0x4,%edx
+  800bff:	83 e2 0f             	and    $0xf,%edx
+  800c02:	83 fa 02             	cmp    $0x2,%edx
+  800c05:	77 e5                	ja     800bec <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  800c07:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c0a:	83 f8 02             	cmp    $0x2,%eax
+  800c0d:	0f 97 c1             	seta   %cl
+  800c10:	0f b6 c9             	movzbl %cl,%ecx
+  800c13:	eb d7                	jmp    800bec <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  800c15:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c1a:	b8 19 00 00 00       	mov    $0x19,%eax
+  800c1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c22:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c25:	89 df                	mov    %ebx,%edi
+  800c27:	89 de                	mov    %ebx,%esi
+  800c29:	cd 30                	int    $0x30
+  800c2b:	eb 90                	jmp    800bbd <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c2d:	83 ec 0c             	sub    $0xc,%esp
+  800c30:	50                   	push   %eax
+  800c31:	6a 19                	push   $0x19
+  800c33:	68 ca 27 80 00       	push   $0x8027ca
+  800c38:	6a 4a                	push   $0x4a
+  800c3a:	68 e7 27 80 00       	push   $0x8027e7
+  800c3f:	e8 c0 0f 00 00       	call   801c04 <_panic>
+
+00800c44 <sys_env_set_pgfault_upcall>:
+{
+  800c44:	55                   	push   %ebp
+  800c45:	89 e5                	mov    %esp,%ebp
+  800c47:	57                   	push   %edi
+  800c48:	56                   	push   %esi
+  800c49:	53                   	push   %ebx
+  800c4a:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800c4d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800c54:	78 37                	js     800c8d <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  800c56:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800c5d:	74 7a                	je     800cd9 <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  800c5f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c64:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c6a:	b8 09 00 00 00       	mov    $0x9,%eax
+  800c6f:	89 df                	mov    %ebx,%edi
+  800c71:	89 de                	mov    %ebx,%esi
+  800c73:	55                   	push   %ebp
+  800c74:	68 7d 0c 80 00       	push   $0x800c7d
+  800c79:	89 e5                	mov    %esp,%ebp
+  800c7b:	0f 34                	sysenter
+  800c7d:	83 c4 04             	add    $0x4,%esp
+  800c80:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c81:	85 c0                	test   %eax,%eax
+  800c83:	7f 6c                	jg     800cf1 <sys_env_set_pgfault_upcall+0xad>
+}
+  800c85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c88:	5b                   	pop    %ebx
+  800c89:	5e                   	pop    %esi
+  800c8a:	5f                   	pop    %edi
+  800c8b:	5d                   	pop    %ebp
+  800c8c:	c3                   	ret
+  800c8d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c92:	0f a2                	cpuid
+		return 0;
+  800c94:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800c99:	f6 c6 08             	test   $0x8,%dh
+  800c9c:	74 15                	je     800cb3 <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c9e:	89 c2                	mov    %eax,%edx
+  800ca0:	c1 ea 08             	shr    $0x8,%edx
+  800ca3:	83 e2 0f             	and    $0xf,%edx
+  800ca6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800cab:	83 fa 06             	cmp    $0x6,%edx
+  800cae:	74 0e                	je     800cbe <sys_env_set_pgfault_upcall+0x7a>
+  800cb0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800cb3:	0f b6 c9             	movzbl %cl,%ecx
+  800cb6:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800cbc:	eb 98                	jmp    800c56 <sys_env_set_pgfault_upcall+0x12>
+  800cbe:	89 c2                	mov    %eax,%edx
+  800cc0:	c1 ea 04             	shr    $0x4,%edx
+  800cc3:	83 e2 0f             	and    $0xf,%edx
+  800cc6:	83 fa 02             	cmp    $0x2,%edx
+  800cc9:	77 e5                	ja     800cb0 <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  800ccb:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800cce:	83 f8 02             	cmp    $0x2,%eax
+  800cd1:	0f 97 c1             	seta   %cl
+  800cd4:	0f b6 c9             	movzbl %cl,%ecx
+  800cd7:	eb d7                	jmp    800cb0 <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  800cd9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cde:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ce3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce9:	89 df                	mov    %ebx,%edi
+  800ceb:	89 de                	mov    %ebx,%esi
+  800ced:	cd 30                	int    $0x30
+  800cef:	eb 90                	jmp    800c81 <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cf1:	83 ec 0c             	sub    $0xc,%esp
+  800cf4:	50                   	push   %eax
+  800cf5:	6a 09                	push   $0x9
+  800cf7:	68 ca 27 80 00       	push   $0x8027ca
+  800cfc:	6a 4a                	push   $0x4a
+  800cfe:	68 e7 27 80 00       	push   $0x8027e7
+  800d03:	e8 fc 0e 00 00       	call   801c04 <_panic>
+
+00800d08 <sys_ipc_try_send>:
+{
+  800d08:	55                   	push   %ebp
+  800d09:	89 e5                	mov    %esp,%ebp
+  800d0b:	57                   	push   %edi
+  800d0c:	56                   	push   %esi
+  800d0d:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800d0e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d15:	78 32                	js     800d49 <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  800d17:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d1e:	74 75                	je     800d95 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  800d20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d26:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d2b:	be 00 00 00 00       	mov    $0x0,%esi
+  800d30:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d33:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d36:	55                   	push   %ebp
+  800d37:	68 40 0d 80 00       	push   $0x800d40
+  800d3c:	89 e5                	mov    %esp,%ebp
+  800d3e:	0f 34                	sysenter
+  800d40:	83 c4 04             	add    $0x4,%esp
+  800d43:	5d                   	pop    %ebp
+}
+  800d44:	5b                   	pop    %ebx
+  800d45:	5e                   	pop    %esi
+  800d46:	5f                   	pop    %edi
+  800d47:	5d                   	pop    %ebp
+  800d48:	c3                   	ret
+  800d49:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d4e:	0f a2                	cpuid
+		return 0;
+  800d50:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800d55:	f6 c6 08             	test   $0x8,%dh
+  800d58:	74 15                	je     800d6f <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d5a:	89 c2                	mov    %eax,%edx
+  800d5c:	c1 ea 08             	shr    $0x8,%edx
+  800d5f:	83 e2 0f             	and    $0xf,%edx
+  800d62:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d67:	83 fa 06             	cmp    $0x6,%edx
+  800d6a:	74 0e                	je     800d7a <sys_ipc_try_send+0x72>
+  800d6c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800d6f:	0f b6 c9             	movzbl %cl,%ecx
+  800d72:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800d78:	eb 9d                	jmp    800d17 <sys_ipc_try_send+0xf>
+  800d7a:	89 c2                	mov    %eax,%edx
+  800d7c:	c1 ea 04             	shr    $0x4,%edx
+  800d7f:	83 e2 0f             	and    $0xf,%edx
+  800d82:	83 fa 02             	cmp    $0x2,%edx
+  800d85:	77 e5                	ja     800d6c <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  800d87:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d8a:	83 f8 02             	cmp    $0x2,%eax
+  800d8d:	0f 97 c1             	seta   %cl
+  800d90:	0f b6 c9             	movzbl %cl,%ecx
+  800d93:	eb d7                	jmp    800d6c <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  800d95:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d9a:	be 00 00 00 00       	mov    $0x0,%esi
+  800d9f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800da8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dab:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  800dad:	eb 95                	jmp    800d44 <sys_ipc_try_send+0x3c>
+
+00800daf <sys_ipc_send>:
+{
+  800daf:	55                   	push   %ebp
+  800db0:	89 e5                	mov    %esp,%ebp
+  800db2:	57                   	push   %edi
+  800db3:	56                   	push   %esi
+  800db4:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800db5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800dbc:	78 32                	js     800df0 <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  800dbe:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800dc5:	74 75                	je     800e3c <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  800dc7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dcd:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800dd2:	be 00 00 00 00       	mov    $0x0,%esi
+  800dd7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dda:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ddd:	55                   	push   %ebp
+  800dde:	68 e7 0d 80 00       	push   $0x800de7
+  800de3:	89 e5                	mov    %esp,%ebp
+  800de5:	0f 34                	sysenter
+  800de7:	83 c4 04             	add    $0x4,%esp
+  800dea:	5d                   	pop    %ebp
+}
+  800deb:	5b                   	pop    %ebx
+  800dec:	5e                   	pop    %esi
+  800ded:	5f                   	pop    %edi
+  800dee:	5d                   	pop    %ebp
+  800def:	c3                   	ret
+  800df0:	b8 01 00 00 00       	mov    $0x1,%eax
+  800df5:	0f a2                	cpuid
+		return 0;
+  800df7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800dfc:	f6 c6 08             	test   $0x8,%dh
+  800dff:	74 15                	je     800e16 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e01:	89 c2                	mov    %eax,%edx
+  800e03:	c1 ea 08             	shr    $0x8,%edx
+  800e06:	83 e2 0f             	and    $0xf,%edx
+  800e09:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e0e:	83 fa 06             	cmp    $0x6,%edx
+  800e11:	74 0e                	je     800e21 <sys_ipc_send+0x72>
+  800e13:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e16:	0f b6 c9             	movzbl %cl,%ecx
+  800e19:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800e1f:	eb 9d                	jmp    800dbe <sys_ipc_send+0xf>
+  800e21:	89 c2                	mov    %eax,%edx
+  800e23:	c1 ea 04             	shr    $0x4,%edx
+  800e26:	83 e2 0f             	and    $0xf,%edx
+  800e29:	83 fa 02             	cmp    $0x2,%edx
+  800e2c:	77 e5                	ja     800e13 <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  800e2e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e31:	83 f8 02             	cmp    $0x2,%eax
+  800e34:	0f 97 c1             	seta   %cl
+  800e37:	0f b6 c9             	movzbl %cl,%ecx
+  800e3a:	eb d7                	jmp    800e13 <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  800e3c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800e41:	be 00 00 00 00       	mov    $0x0,%esi
+  800e46:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e49:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e4c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e4f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e52:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  800e54:	eb 95                	jmp    800deb <sys_ipc_send+0x3c>
+
+00800e56 <sys_ipc_recv>:
+{
+  800e56:	55                   	push   %ebp
+  800e57:	89 e5                	mov    %esp,%ebp
+  800e59:	57                   	push   %edi
+  800e5a:	56                   	push   %esi
+  800e5b:	53                   	push   %ebx
+  800e5c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800e5f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e66:	78 36                	js     800e9e <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  800e68:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e6f:	74 79                	je     800eea <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  800e71:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e74:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e79:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e7e:	89 cb                	mov    %ecx,%ebx
+  800e80:	89 cf                	mov    %ecx,%edi
+  800e82:	89 ce                	mov    %ecx,%esi
+  800e84:	55                   	push   %ebp
+  800e85:	68 8e 0e 80 00       	push   $0x800e8e
+  800e8a:	89 e5                	mov    %esp,%ebp
+  800e8c:	0f 34                	sysenter
+  800e8e:	83 c4 04             	add    $0x4,%esp
+  800e91:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e92:	85 c0                	test   %eax,%eax
+  800e94:	7f 6b                	jg     800f01 <sys_ipc_recv+0xab>
+}
+  800e96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e99:	5b                   	pop    %ebx
+  800e9a:	5e                   	pop    %esi
+  800e9b:	5f                   	pop    %edi
+  800e9c:	5d                   	pop    %ebp
+  800e9d:	c3                   	ret
+  800e9e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ea3:	0f a2                	cpuid
+		return 0;
+  800ea5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800eaa:	f6 c6 08             	test   $0x8,%dh
+  800ead:	74 15                	je     800ec4 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800eaf:	89 c2                	mov    %eax,%edx
+  800eb1:	c1 ea 08             	shr    $0x8,%edx
+  800eb4:	83 e2 0f             	and    $0xf,%edx
+  800eb7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ebc:	83 fa 06             	cmp    $0x6,%edx
+  800ebf:	74 0e                	je     800ecf <sys_ipc_recv+0x79>
+  800ec1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800ec4:	0f b6 c9             	movzbl %cl,%ecx
+  800ec7:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800ecd:	eb 99                	jmp    800e68 <sys_ipc_recv+0x12>
+  800ecf:	89 c2                	mov    %eax,%edx
+  800ed1:	c1 ea 04             	shr    $0x4,%edx
+  800ed4:	83 e2 0f             	and    $0xf,%edx
+  800ed7:	83 fa 02             	cmp    $0x2,%edx
+  800eda:	77 e5                	ja     800ec1 <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  800edc:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800edf:	83 f8 02             	cmp    $0x2,%eax
+  800ee2:	0f 97 c1             	seta   %cl
+  800ee5:	0f b6 c9             	movzbl %cl,%ecx
+  800ee8:	eb d7                	jmp    800ec1 <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  800eea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800eef:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ef4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef7:	89 cb                	mov    %ecx,%ebx
+  800ef9:	89 cf                	mov    %ecx,%edi
+  800efb:	89 ce                	mov    %ecx,%esi
+  800efd:	cd 30                	int    $0x30
+  800eff:	eb 91                	jmp    800e92 <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f01:	83 ec 0c             	sub    $0xc,%esp
+  800f04:	50                   	push   %eax
+  800f05:	6a 0d                	push   $0xd
+  800f07:	68 ca 27 80 00       	push   $0x8027ca
+  800f0c:	6a 4a                	push   $0x4a
+  800f0e:	68 e7 27 80 00       	push   $0x8027e7
+  800f13:	e8 ec 0c 00 00       	call   801c04 <_panic>
+
+00800f18 <sys_ipc_send_range>:
+{
+  800f18:	55                   	push   %ebp
+  800f19:	89 e5                	mov    %esp,%ebp
+  800f1b:	57                   	push   %edi
+  800f1c:	56                   	push   %esi
+  800f1d:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800f1e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f25:	78 30                	js     800f57 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  800f27:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f2e:	74 73                	je     800fa3 <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  800f30:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f33:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f36:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  800f3b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f3e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f41:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f44:	55                   	push   %ebp
+  800f45:	68 4e 0f 80 00       	push   $0x800f4e
+  800f4a:	89 e5                	mov    %esp,%ebp
+  800f4c:	0f 34                	sysenter
+  800f4e:	83 c4 04             	add    $0x4,%esp
+  800f51:	5d                   	pop    %ebp
+}
+  800f52:	5b                   	pop    %ebx
+  800f53:	5e                   	pop    %esi
+  800f54:	5f                   	pop    %edi
+  800f55:	5d                   	pop    %ebp
+  800f56:	c3                   	ret
+  800f57:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f5c:	0f a2                	cpuid
+		return 0;
+  800f5e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f63:	f6 c6 08             	test   $0x8,%dh
+  800f66:	74 15                	je     800f7d <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f68:	89 c2                	mov    %eax,%edx
+  800f6a:	c1 ea 08             	shr    $0x8,%edx
+  800f6d:	83 e2 0f             	and    $0xf,%edx
+  800f70:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f75:	83 fa 06             	cmp    $0x6,%edx
+  800f78:	74 0e                	je     800f88 <sys_ipc_send_range+0x70>
+  800f7a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f7d:	0f b6 c9             	movzbl %cl,%ecx
+  800f80:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800f86:	eb 9f                	jmp    800f27 <sys_ipc_send_range+0xf>
+  800f88:	89 c2                	mov    %eax,%edx
+  800f8a:	c1 ea 04             	shr    $0x4,%edx
+  800f8d:	83 e2 0f             	and    $0xf,%edx
+  800f90:	83 fa 02             	cmp    $0x2,%edx
+  800f93:	77 e5                	ja     800f7a <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  800f95:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f98:	83 f8 02             	cmp    $0x2,%eax
+  800f9b:	0f 97 c1             	seta   %cl
+  800f9e:	0f b6 c9             	movzbl %cl,%ecx
+  800fa1:	eb d7                	jmp    800f7a <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  800fa3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  800fa8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fb1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fb4:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fb7:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  800fb9:	eb 97                	jmp    800f52 <sys_ipc_send_range+0x3a>
+
+00800fbb <sys_ipc_recv_range>:
+{
+  800fbb:	55                   	push   %ebp
+  800fbc:	89 e5                	mov    %esp,%ebp
+  800fbe:	57                   	push   %edi
+  800fbf:	56                   	push   %esi
+  800fc0:	53                   	push   %ebx
+  800fc1:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800fc4:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fcb:	78 37                	js     801004 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  800fcd:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fd4:	74 7a                	je     801050 <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  800fd6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fdb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fde:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe1:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800fe6:	89 df                	mov    %ebx,%edi
+  800fe8:	89 de                	mov    %ebx,%esi
+  800fea:	55                   	push   %ebp
+  800feb:	68 f4 0f 80 00       	push   $0x800ff4
+  800ff0:	89 e5                	mov    %esp,%ebp
+  800ff2:	0f 34                	sysenter
+  800ff4:	83 c4 04             	add    $0x4,%esp
+  800ff7:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ff8:	85 c0                	test   %eax,%eax
+  800ffa:	7f 6c                	jg     801068 <sys_ipc_recv_range+0xad>
+}
+  800ffc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fff:	5b                   	pop    %ebx
+  801000:	5e                   	pop    %esi
+  801001:	5f                   	pop    %edi
+  801002:	5d                   	pop    %ebp
+  801003:	c3                   	ret
+  801004:	b8 01 00 00 00       	mov    $0x1,%eax
+  801009:	0f a2                	cpuid
+		return 0;
+  80100b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801010:	f6 c6 08             	test   $0x8,%dh
+  801013:	74 15                	je     80102a <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801015:	89 c2                	mov    %eax,%edx
+  801017:	c1 ea 08             	shr    $0x8,%edx
+  80101a:	83 e2 0f             	and    $0xf,%edx
+  80101d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801022:	83 fa 06             	cmp    $0x6,%edx
+  801025:	74 0e                	je     801035 <sys_ipc_recv_range+0x7a>
+  801027:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80102a:	0f b6 c9             	movzbl %cl,%ecx
+  80102d:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801033:	eb 98                	jmp    800fcd <sys_ipc_recv_range+0x12>
+  801035:	89 c2                	mov    %eax,%edx
+  801037:	c1 ea 04             	shr    $0x4,%edx
+  80103a:	83 e2 0f             	and    $0xf,%edx
+  80103d:	83 fa 02             	cmp    $0x2,%edx
+  801040:	77 e5                	ja     801027 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801042:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801045:	83 f8 02             	cmp    $0x2,%eax
+  801048:	0f 97 c1             	seta   %cl
+  80104b:	0f b6 c9             	movzbl %cl,%ecx
+  80104e:	eb d7                	jmp    801027 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801050:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801055:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80105a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801060:	89 df                	mov    %ebx,%edi
+  801062:	89 de                	mov    %ebx,%esi
+  801064:	cd 30                	int    $0x30
+  801066:	eb 90                	jmp    800ff8 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801068:	83 ec 0c             	sub    $0xc,%esp
+  80106b:	50                   	push   %eax
+  80106c:	6a 1f                	push   $0x1f
+  80106e:	68 ca 27 80 00       	push   $0x8027ca
+  801073:	6a 4a                	push   $0x4a
+  801075:	68 e7 27 80 00       	push   $0x8027e7
+  80107a:	e8 85 0b 00 00       	call   801c04 <_panic>
+
+0080107f <sys_ipc_call>:
+{
+  80107f:	55                   	push   %ebp
+  801080:	89 e5                	mov    %esp,%ebp
+  801082:	57                   	push   %edi
+  801083:	56                   	push   %esi
+  801084:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801085:	8b 55 08             	mov    0x8(%ebp),%edx
+  801088:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80108d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801090:	55                   	push   %ebp
+  801091:	56                   	push   %esi
+  801092:	8b 0e                	mov    (%esi),%ecx
+  801094:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801097:	8b 7e 08             	mov    0x8(%esi),%edi
+  80109a:	8b 6e 10             	mov    0x10(%esi),%ebp
+  80109d:	8b 76 0c             	mov    0xc(%esi),%esi
+  8010a0:	cd 30                	int    $0x30
+  8010a2:	87 34 24             	xchg   %esi,(%esp)
+  8010a5:	89 0e                	mov    %ecx,(%esi)
+  8010a7:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8010aa:	89 7e 08             	mov    %edi,0x8(%esi)
+  8010ad:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8010b0:	8f 46 0c             	pop    0xc(%esi)
+  8010b3:	5d                   	pop    %ebp
+}
+  8010b4:	5b                   	pop    %ebx
+  8010b5:	5e                   	pop    %esi
+  8010b6:	5f                   	pop    %edi
+  8010b7:	5d                   	pop    %ebp
+  8010b8:	c3                   	ret
+
+008010b9 <sys_ipc_reply_wait>:
+{
+  8010b9:	55                   	push   %ebp
+  8010ba:	89 e5                	mov    %esp,%ebp
+  8010bc:	57                   	push   %edi
+  8010bd:	56                   	push   %esi
+  8010be:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c2:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8010c7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8010ca:	55                   	push   %ebp
+  8010cb:	56                   	push   %esi
+  8010cc:	8b 0e                	mov    (%esi),%ecx
+  8010ce:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8010d1:	8b 7e 08             	mov    0x8(%esi),%edi
+  8010d4:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8010d7:	8b 76 0c             	mov    0xc(%esi),%esi
+  8010da:	cd 30                	int    $0x30
+  8010dc:	87 34 24             	xchg   %esi,(%esp)
+  8010df:	89 0e                	mov    %ecx,(%esi)
+  8010e1:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8010e4:	89 7e 08             	mov    %edi,0x8(%esi)
+  8010e7:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8010ea:	8f 46 0c             	pop    0xc(%esi)
+  8010ed:	5d                   	pop    %ebp
+}
+  8010ee:	5b                   	pop    %ebx
+  8010ef:	5e                   	pop    %esi
+  8010f0:	5f                   	pop    %edi
+  8010f1:	5d                   	pop    %ebp
+  8010f2:	c3                   	ret
+
+008010f3 <sys_ipc_send_msg>:
+{
+  8010f3:	55                   	push   %ebp
+  8010f4:	89 e5                	mov    %esp,%ebp
+  8010f6:	57                   	push   %edi
+  8010f7:	56                   	push   %esi
+  8010f8:	53                   	push   %ebx
+  8010f9:	83 ec 20             	sub    $0x20,%esp
+  8010fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  8010ff:	8b 10                	mov    (%eax),%edx
+  801101:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801104:	8b 50 04             	mov    0x4(%eax),%edx
+  801107:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80110a:	8b 50 08             	mov    0x8(%eax),%edx
+  80110d:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801110:	8b 50 0c             	mov    0xc(%eax),%edx
+  801113:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801116:	8b 40 10             	mov    0x10(%eax),%eax
+  801119:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  80111c:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  80111f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801122:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801127:	55                   	push   %ebp
+  801128:	56                   	push   %esi
+  801129:	8b 0e                	mov    (%esi),%ecx
+  80112b:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80112e:	8b 7e 08             	mov    0x8(%esi),%edi
+  801131:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801134:	8b 76 0c             	mov    0xc(%esi),%esi
+  801137:	cd 30                	int    $0x30
+  801139:	87 34 24             	xchg   %esi,(%esp)
+  80113c:	89 0e                	mov    %ecx,(%esi)
+  80113e:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801141:	89 7e 08             	mov    %edi,0x8(%esi)
+  801144:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801147:	8f 46 0c             	pop    0xc(%esi)
+  80114a:	5d                   	pop    %ebp
+}
+  80114b:	83 c4 20             	add    $0x20,%esp
+  80114e:	5b                   	pop    %ebx
+  80114f:	5e                   	pop    %esi
+  801150:	5f                   	pop    %edi
+  801151:	5d                   	pop    %ebp
+  801152:	c3                   	ret
+
+00801153 <sys_fork>:
+{
+  801153:	55                   	push   %ebp
+  801154:	89 e5                	mov    %esp,%ebp
+  801156:	57                   	push   %edi
+  801157:	56                   	push   %esi
+  801158:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801159:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801160:	78 2e                	js     801190 <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801162:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801169:	74 71                	je     8011dc <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  80116b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801170:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801175:	89 d1                	mov    %edx,%ecx
+  801177:	89 d3                	mov    %edx,%ebx
+  801179:	89 d7                	mov    %edx,%edi
+  80117b:	89 d6                	mov    %edx,%esi
+  80117d:	55                   	push   %ebp
+  80117e:	68 87 11 80 00       	push   $0x801187
+  801183:	89 e5                	mov    %esp,%ebp
+  801185:	0f 34                	sysenter
+  801187:	83 c4 04             	add    $0x4,%esp
+  80118a:	5d                   	pop    %ebp
+}
+  80118b:	5b                   	pop    %ebx
+  80118c:	5e                   	pop    %esi
+  80118d:	5f                   	pop    %edi
+  80118e:	5d                   	pop    %ebp
+  80118f:	c3                   	ret
+  801190:	b8 01 00 00 00       	mov    $0x1,%eax
+  801195:	0f a2                	cpuid
+		return 0;
+  801197:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80119c:	f6 c6 08             	test   $0x8,%dh
+  80119f:	74 15                	je     8011b6 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011a1:	89 c2                	mov    %eax,%edx
+  8011a3:	c1 ea 08             	shr    $0x8,%edx
+  8011a6:	83 e2 0f             	and    $0xf,%edx
+  8011a9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011ae:	83 fa 06             	cmp    $0x6,%edx
+  8011b1:	74 0e                	je     8011c1 <sys_fork+0x6e>
+  8011b3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8011b6:	0f b6 c9             	movzbl %cl,%ecx
+  8011b9:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8011bf:	eb a1                	jmp    801162 <sys_fork+0xf>
+  8011c1:	89 c2                	mov    %eax,%edx
+  8011c3:	c1 ea 04             	shr    $0x4,%edx
+  8011c6:	83 e2 0f             	and    $0xf,%edx
+  8011c9:	83 fa 02             	cmp    $0x2,%edx
+  8011cc:	77 e5                	ja     8011b3 <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  8011ce:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011d1:	83 f8 02             	cmp    $0x2,%eax
+  8011d4:	0f 97 c1             	seta   %cl
+  8011d7:	0f b6 c9             	movzbl %cl,%ecx
+  8011da:	eb d7                	jmp    8011b3 <sys_fork+0x60>
+		asm volatile("int %1\n"
+  8011dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011e1:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011e6:	89 d1                	mov    %edx,%ecx
+  8011e8:	89 d3                	mov    %edx,%ebx
+  8011ea:	89 d7                	mov    %edx,%edi
+  8011ec:	89 d6                	mov    %edx,%esi
+  8011ee:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  8011f0:	eb 99                	jmp    80118b <sys_fork+0x38>
+
+008011f2 <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  8011f2:	55                   	push   %ebp
+  8011f3:	89 e5                	mov    %esp,%ebp
+  8011f5:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  8011f8:	ff 75 14             	push   0x14(%ebp)
+  8011fb:	ff 75 10             	push   0x10(%ebp)
+  8011fe:	ff 75 0c             	push   0xc(%ebp)
+  801201:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801206:	8b 55 08             	mov    0x8(%ebp),%edx
+  801209:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80120e:	e8 81 ee ff ff       	call   800094 <page_vec_call>
+}
+  801213:	c9                   	leave
+  801214:	c3                   	ret
+
+00801215 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801215:	55                   	push   %ebp
+  801216:	89 e5                	mov    %esp,%ebp
+  801218:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  80121b:	ff 75 18             	push   0x18(%ebp)
+  80121e:	ff 75 14             	push   0x14(%ebp)
+  801221:	ff 75 10             	push   0x10(%ebp)
+  801224:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801227:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122a:	b8 10 00 00 00       	mov    $0x10,%eax
+  80122f:	e8 60 ee ff ff       	call   800094 <page_vec_call>
+}
+  801234:	c9                   	leave
+  801235:	c3                   	ret
+
+00801236 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801236:	55                   	push   %ebp
+  801237:	89 e5                	mov    %esp,%ebp
+  801239:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  80123c:	ff 75 14             	push   0x14(%ebp)
+  80123f:	ff 75 10             	push   0x10(%ebp)
+  801242:	ff 75 0c             	push   0xc(%ebp)
+  801245:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80124a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124d:	b8 11 00 00 00       	mov    $0x11,%eax
+  801252:	e8 3d ee ff ff       	call   800094 <page_vec_call>
+}
+  801257:	c9                   	leave
+  801258:	c3                   	ret
+
+00801259 <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801259:	55                   	push   %ebp
+  80125a:	89 e5                	mov    %esp,%ebp
+  80125c:	57                   	push   %edi
+  80125d:	56                   	push   %esi
+  80125e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80125f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801266:	78 32                	js     80129a <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801268:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80126f:	74 75                	je     8012e6 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801271:	8b 55 08             	mov    0x8(%ebp),%edx
+  801274:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801277:	b8 12 00 00 00       	mov    $0x12,%eax
+  80127c:	be 00 00 00 00       	mov    $0x0,%esi
+  801281:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801284:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801287:	55                   	push   %ebp
+  801288:	68 91 12 80 00       	push   $0x801291
+  80128d:	89 e5                	mov    %esp,%ebp
+  80128f:	0f 34                	sysenter
+  801291:	83 c4 04             	add    $0x4,%esp
+  801294:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801295:	5b                   	pop    %ebx
+  801296:	5e                   	pop    %esi
+  801297:	5f                   	pop    %edi
+  801298:	5d                   	pop    %ebp
+  801299:	c3                   	ret
+  80129a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80129f:	0f a2                	cpuid
+		return 0;
+  8012a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8012a6:	f6 c6 08             	test   $0x8,%dh
+  8012a9:	74 15                	je     8012c0 <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012ab:	89 c2                	mov    %eax,%edx
+  8012ad:	c1 ea 08             	shr    $0x8,%edx
+  8012b0:	83 e2 0f             	and    $0xf,%edx
+  8012b3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012b8:	83 fa 06             	cmp    $0x6,%edx
+  8012bb:	74 0e                	je     8012cb <sys_vm_ranges+0x72>
+  8012bd:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8012c0:	0f b6 c9             	movzbl %cl,%ecx
+  8012c3:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8012c9:	eb 9d                	jmp    801268 <sys_vm_ranges+0xf>
+  8012cb:	89 c2                	mov    %eax,%edx
+  8012cd:	c1 ea 04             	shr    $0x4,%edx
+  8012d0:	83 e2 0f             	and    $0xf,%edx
+  8012d3:	83 fa 02             	cmp    $0x2,%edx
+  8012d6:	77 e5                	ja     8012bd <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  8012d8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012db:	83 f8 02             	cmp    $0x2,%eax
+  8012de:	0f 97 c1             	seta   %cl
+  8012e1:	0f b6 c9             	movzbl %cl,%ecx
+  8012e4:	eb d7                	jmp    8012bd <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  8012e6:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012f9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012fc:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  8012fe:	eb 95                	jmp    801295 <sys_vm_ranges+0x3c>
+
+00801300 <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801300:	55                   	push   %ebp
+  801301:	89 e5                	mov    %esp,%ebp
+  801303:	57                   	push   %edi
+  801304:	56                   	push   %esi
+  801305:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801306:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80130d:	78 31                	js     801340 <sys_spawn+0x40>
+	if (syscall_sysenter)
+  80130f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801316:	74 74                	je     80138c <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801318:	be 00 00 00 00       	mov    $0x0,%esi
+  80131d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801320:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801323:	b8 14 00 00 00       	mov    $0x14,%eax
+  801328:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80132b:	89 f7                	mov    %esi,%edi
+  80132d:	55                   	push   %ebp
+  80132e:	68 37 13 80 00       	push   $0x801337
+  801333:	89 e5                	mov    %esp,%ebp
+  801335:	0f 34                	sysenter
+  801337:	83 c4 04             	add    $0x4,%esp
+  80133a:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  80133b:	5b                   	pop    %ebx
+  80133c:	5e                   	pop    %esi
+  80133d:	5f                   	pop    %edi
+  80133e:	5d                   	pop    %ebp
+  80133f:	c3                   	ret
+  801340:	b8 01 00 00 00       	mov    $0x1,%eax
+  801345:	0f a2                	cpuid
+		return 0;
+  801347:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80134c:	f6 c6 08             	test   $0x8,%dh
+  80134f:	74 15                	je     801366 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801351:	89 c2                	mov    %eax,%edx
+  801353:	c1 ea 08             	shr    $0x8,%edx
+  801356:	83 e2 0f             	and    $0xf,%edx
+  801359:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80135e:	83 fa 06             	cmp    $0x6,%edx
+  801361:	74 0e                	je     801371 <sys_spawn+0x71>
+  801363:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801366:	0f b6 c9             	movzbl %cl,%ecx
+  801369:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80136f:	eb 9e                	jmp    80130f <sys_spawn+0xf>
+  801371:	89 c2                	mov    %eax,%edx
+  801373:	c1 ea 04             	shr    $0x4,%edx
+  801376:	83 e2 0f             	and    $0xf,%edx
+  801379:	83 fa 02             	cmp    $0x2,%edx
+  80137c:	77 e5                	ja     801363 <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  80137e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801381:	83 f8 02             	cmp    $0x2,%eax
+  801384:	0f 97 c1             	seta   %cl
+  801387:	0f b6 c9             	movzbl %cl,%ecx
+  80138a:	eb d7                	jmp    801363 <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  80138c:	be 00 00 00 00       	mov    $0x0,%esi
+  801391:	b8 14 00 00 00       	mov    $0x14,%eax
+  801396:	8b 55 08             	mov    0x8(%ebp),%edx
+  801399:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80139c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80139f:	89 f7                	mov    %esi,%edi
+  8013a1:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  8013a3:	eb 96                	jmp    80133b <sys_spawn+0x3b>
+
+008013a5 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  8013a5:	55                   	push   %ebp
+  8013a6:	89 e5                	mov    %esp,%ebp
+  8013a8:	57                   	push   %edi
+  8013a9:	56                   	push   %esi
+  8013aa:	53                   	push   %ebx
+  8013ab:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8013ae:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8013b5:	78 37                	js     8013ee <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  8013b7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8013be:	74 7a                	je     80143a <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  8013c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013cb:	b8 15 00 00 00       	mov    $0x15,%eax
+  8013d0:	89 df                	mov    %ebx,%edi
+  8013d2:	89 de                	mov    %ebx,%esi
+  8013d4:	55                   	push   %ebp
+  8013d5:	68 de 13 80 00       	push   $0x8013de
+  8013da:	89 e5                	mov    %esp,%ebp
+  8013dc:	0f 34                	sysenter
+  8013de:	83 c4 04             	add    $0x4,%esp
+  8013e1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8013e2:	85 c0                	test   %eax,%eax
+  8013e4:	7f 6c                	jg     801452 <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  8013e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e9:	5b                   	pop    %ebx
+  8013ea:	5e                   	pop    %esi
+  8013eb:	5f                   	pop    %edi
+  8013ec:	5d                   	pop    %ebp
+  8013ed:	c3                   	ret
+  8013ee:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013f3:	0f a2                	cpuid
+		return 0;
+  8013f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8013fa:	f6 c6 08             	test   $0x8,%dh
+  8013fd:	74 15                	je     801414 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013ff:	89 c2                	mov    %eax,%edx
+  801401:	c1 ea 08             	shr    $0x8,%edx
+  801404:	83 e2 0f             	and    $0xf,%edx
+  801407:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80140c:	83 fa 06             	cmp    $0x6,%edx
+  80140f:	74 0e                	je     80141f <sys_shm_create+0x7a>
+  801411:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801414:	0f b6 c9             	movzbl %cl,%ecx
+  801417:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80141d:	eb 98                	jmp    8013b7 <sys_shm_create+0x12>
+  80141f:	89 c2                	mov    %eax,%edx
+  801421:	c1 ea 04             	shr    $0x4,%edx
+  801424:	83 e2 0f             	and    $0xf,%edx
+  801427:	83 fa 02             	cmp    $0x2,%edx
+  80142a:	77 e5                	ja     801411 <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  80142c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80142f:	83 f8 02             	cmp    $0x2,%eax
+  801432:	0f 97 c1             	seta   %cl
+  801435:	0f b6 c9             	movzbl %cl,%ecx
+  801438:	eb d7                	jmp    801411 <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  80143a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80143f:	b8 15 00 00 00       	mov    $0x15,%eax
+  801444:	8b 55 08             	mov    0x8(%ebp),%edx
+  801447:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80144a:	89 df                	mov    %ebx,%edi
+  80144c:	89 de                	mov    %ebx,%esi
+  80144e:	cd 30                	int    $0x30
+  801450:	eb 90                	jmp    8013e2 <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801452:	83 ec 0c             	sub    $0xc,%esp
+  801455:	50                   	push   %eax
+  801456:	6a 15                	push   $0x15
+  801458:	68 ca 27 80 00       	push   $0x8027ca
+  80145d:	6a 4a                	push   $0x4a
+  80145f:	68 e7 27 80 00       	push   $0x8027e7
+  801464:	e8 9b 07 00 00       	call   801c04 <_panic>
+
+00801469 <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  801469:	55                   	push   %ebp
+  80146a:	89 e5                	mov    %esp,%ebp
+  80146c:	57                   	push   %edi
+  80146d:	56                   	push   %esi
+  80146e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80146f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801476:	78 32                	js     8014aa <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  801478:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80147f:	74 75                	je     8014f6 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801481:	8b 55 08             	mov    0x8(%ebp),%edx
+  801484:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801487:	b8 16 00 00 00       	mov    $0x16,%eax
+  80148c:	be 00 00 00 00       	mov    $0x0,%esi
+  801491:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801494:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801497:	55                   	push   %ebp
+  801498:	68 a1 14 80 00       	push   $0x8014a1
+  80149d:	89 e5                	mov    %esp,%ebp
+  80149f:	0f 34                	sysenter
+  8014a1:	83 c4 04             	add    $0x4,%esp
+  8014a4:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  8014a5:	5b                   	pop    %ebx
+  8014a6:	5e                   	pop    %esi
+  8014a7:	5f                   	pop    %edi
+  8014a8:	5d                   	pop    %ebp
+  8014a9:	c3                   	ret
+  8014aa:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014af:	0f a2                	cpuid
+		return 0;
+  8014b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8014b6:	f6 c6 08             	test   $0x8,%dh
+  8014b9:	74 15                	je     8014d0 <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014bb:	89 c2                	mov    %eax,%edx
+  8014bd:	c1 ea 08             	shr    $0x8,%edx
+  8014c0:	83 e2 0f             	and    $0xf,%edx
+  8014c3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8014c8:	83 fa 06             	cmp    $0x6,%edx
+  8014cb:	74 0e                	je     8014db <sys_shm_attach+0x72>
+  8014cd:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8014d0:	0f b6 c9             	movzbl %cl,%ecx
+  8014d3:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8014d9:	eb 9d                	jmp    801478 <sys_shm_attach+0xf>
+  8014db:	89 c2                	mov    %eax,%edx
+  8014dd:	c1 ea 04             	shr    $0x4,%edx
+  8014e0:	83 e2 0f             	and    $0xf,%edx
+  8014e3:	83 fa 02             	cmp    $0x2,%edx
+  8014e6:	77 e5                	ja     8014cd <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  8014e8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014eb:	83 f8 02             	cmp    $0x2,%eax
+  8014ee:	0f 97 c1             	seta   %cl
+  8014f1:	0f b6 c9             	movzbl %cl,%ecx
+  8014f4:	eb d7                	jmp    8014cd <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  8014f6:	b8 16 00 00 00       	mov    $0x16,%eax
+  8014fb:	be 00 00 00 00       	mov    $0x0,%esi
+  801500:	8b 55 08             	mov    0x8(%ebp),%edx
+  801503:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801506:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801509:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80150c:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  80150e:	eb 95                	jmp    8014a5 <sys_shm_attach+0x3c>
+
+00801510 <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  801510:	55                   	push   %ebp
+  801511:	89 e5                	mov    %esp,%ebp
+  801513:	57                   	push   %edi
+  801514:	56                   	push   %esi
+  801515:	53                   	push   %ebx
+  801516:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801519:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801520:	78 38                	js     80155a <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  801522:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801529:	74 7b                	je     8015a6 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  80152b:	be 00 00 00 00       	mov    $0x0,%esi
+  801530:	8b 55 08             	mov    0x8(%ebp),%edx
+  801533:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801536:	b8 17 00 00 00       	mov    $0x17,%eax
+  80153b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80153e:	89 f7                	mov    %esi,%edi
+  801540:	55                   	push   %ebp
+  801541:	68 4a 15 80 00       	push   $0x80154a
+  801546:	89 e5                	mov    %esp,%ebp
+  801548:	0f 34                	sysenter
+  80154a:	83 c4 04             	add    $0x4,%esp
+  80154d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80154e:	85 c0                	test   %eax,%eax
+  801550:	7f 6d                	jg     8015bf <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  801552:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801555:	5b                   	pop    %ebx
+  801556:	5e                   	pop    %esi
+  801557:	5f                   	pop    %edi
+  801558:	5d                   	pop    %ebp
+  801559:	c3                   	ret
+  80155a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80155f:	0f a2                	cpuid
+		return 0;
+  801561:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801566:	f6 c6 08             	test   $0x8,%dh
+  801569:	74 15                	je     801580 <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80156b:	89 c2                	mov    %eax,%edx
+  80156d:	c1 ea 08             	shr    $0x8,%edx
+  801570:	83 e2 0f             	and    $0xf,%edx
+  801573:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801578:	83 fa 06             	cmp    $0x6,%edx
+  80157b:	74 0e                	je     80158b <sys_shm_detach+0x7b>
+  80157d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801580:	0f b6 c9             	movzbl %cl,%ecx
+  801583:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801589:	eb 97                	jmp    801522 <sys_shm_detach+0x12>
+  80158b:	89 c2                	mov    %eax,%edx
+  80158d:	c1 ea 04             	shr    $0x4,%edx
+  801590:	83 e2 0f             	and    $0xf,%edx
+  801593:	83 fa 02             	cmp    $0x2,%edx
+  801596:	77 e5                	ja     80157d <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  801598:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80159b:	83 f8 02             	cmp    $0x2,%eax
+  80159e:	0f 97 c1             	seta   %cl
+  8015a1:	0f b6 c9             	movzbl %cl,%ecx
+  8015a4:	eb d7                	jmp    80157d <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  8015a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ab:	b8 17 00 00 00       	mov    $0x17,%eax
+  8015b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015b9:	89 f7                	mov    %esi,%edi
+  8015bb:	cd 30                	int    $0x30
+  8015bd:	eb 8f                	jmp    80154e <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015bf:	83 ec 0c             	sub    $0xc,%esp
+  8015c2:	50                   	push   %eax
+  8015c3:	6a 17                	push   $0x17
+  8015c5:	68 ca 27 80 00       	push   $0x8027ca
+  8015ca:	6a 4a                	push   $0x4a
+  8015cc:	68 e7 27 80 00       	push   $0x8027e7
+  8015d1:	e8 2e 06 00 00       	call   801c04 <_panic>
+
+008015d6 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  8015d6:	55                   	push   %ebp
+  8015d7:	89 e5                	mov    %esp,%ebp
+  8015d9:	57                   	push   %edi
+  8015da:	56                   	push   %esi
+  8015db:	53                   	push   %ebx
+  8015dc:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8015df:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8015e6:	78 36                	js     80161e <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  8015e8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8015ef:	74 79                	je     80166a <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  8015f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015f9:	b8 18 00 00 00       	mov    $0x18,%eax
+  8015fe:	89 cb                	mov    %ecx,%ebx
+  801600:	89 cf                	mov    %ecx,%edi
+  801602:	89 ce                	mov    %ecx,%esi
+  801604:	55                   	push   %ebp
+  801605:	68 0e 16 80 00       	push   $0x80160e
+  80160a:	89 e5                	mov    %esp,%ebp
+  80160c:	0f 34                	sysenter
+  80160e:	83 c4 04             	add    $0x4,%esp
+  801611:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801612:	85 c0                	test   %eax,%eax
+  801614:	7f 6b                	jg     801681 <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  801616:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801619:	5b                   	pop    %ebx
+  80161a:	5e                   	pop    %esi
+  80161b:	5f                   	pop    %edi
+  80161c:	5d                   	pop    %ebp
+  80161d:	c3                   	ret
+  80161e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801623:	0f a2                	cpuid
+		return 0;
+  801625:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80162a:	f6 c6 08             	test   $0x8,%dh
+  80162d:	74 15                	je     801644 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80162f:	89 c2                	mov    %eax,%edx
+  801631:	c1 ea 08             	shr    $0x8,%edx
+  801634:	83 e2 0f             	and    $0xf,%edx
+  801637:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80163c:	83 fa 06             	cmp    $0x6,%edx
+  80163f:	74 0e                	je     80164f <sys_shm_remove+0x79>
+  801641:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801644:	0f b6 c9             	movzbl %cl,%ecx
+  801647:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80164d:	eb 99                	jmp    8015e8 <sys_shm_remove+0x12>
+  80164f:	89 c2                	mov    %eax,%edx
+  801651:	c1 ea 04             	shr    $0x4,%edx
+  801654:	83 e2 0f             	and    $0xf,%edx
+  801657:	83 fa 02             	cmp    $0x2,%edx
+  80165a:	77 e5                	ja     801641 <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  80165c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80165f:	83 f8 02             	cmp    $0x2,%eax
+  801662:	0f 97 c1             	seta   %cl
+  801665:	0f b6 c9             	movzbl %cl,%ecx
+  801668:	eb d7                	jmp    801641 <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  80166a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80166f:	b8 18 00 00 00       	mov    $0x18,%eax
+  801674:	8b 55 08             	mov    0x8(%ebp),%edx
+  801677:	89 cb                	mov    %ecx,%ebx
+  801679:	89 cf                	mov    %ecx,%edi
+  80167b:	89 ce                	mov    %ecx,%esi
+  80167d:	cd 30                	int    $0x30
+  80167f:	eb 91                	jmp    801612 <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801681:	83 ec 0c             	sub    $0xc,%esp
+  801684:	50                   	push   %eax
+  801685:	6a 18                	push   $0x18
+  801687:	68 ca 27 80 00       	push   $0x8027ca
+  80168c:	6a 4a                	push   $0x4a
+  80168e:	68 e7 27 80 00       	push   $0x8027e7
+  801693:	e8 6c 05 00 00       	call   801c04 <_panic>
+
+00801698 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  801698:	55                   	push   %ebp
+  801699:	89 e5                	mov    %esp,%ebp
+  80169b:	57                   	push   %edi
+  80169c:	56                   	push   %esi
+  80169d:	53                   	push   %ebx
+  80169e:	83 ec 0c             	sub    $0xc,%esp
+  8016a1:	8b 45 10             	mov    0x10(%ebp),%eax
+  8016a4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8016a7:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  8016aa:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8016b1:	78 32                	js     8016e5 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  8016b3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8016ba:	74 75                	je     801731 <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  8016bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016c2:	b8 20 00 00 00       	mov    $0x20,%eax
+  8016c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8016cc:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8016cf:	55                   	push   %ebp
+  8016d0:	68 d9 16 80 00       	push   $0x8016d9
+  8016d5:	89 e5                	mov    %esp,%ebp
+  8016d7:	0f 34                	sysenter
+  8016d9:	83 c4 04             	add    $0x4,%esp
+  8016dc:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  8016dd:	83 c4 0c             	add    $0xc,%esp
+  8016e0:	5b                   	pop    %ebx
+  8016e1:	5e                   	pop    %esi
+  8016e2:	5f                   	pop    %edi
+  8016e3:	5d                   	pop    %ebp
+  8016e4:	c3                   	ret
+  8016e5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016ea:	0f a2                	cpuid
+		return 0;
+  8016ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8016f1:	f6 c6 08             	test   $0x8,%dh
+  8016f4:	74 15                	je     80170b <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016f6:	89 c2                	mov    %eax,%edx
+  8016f8:	c1 ea 08             	shr    $0x8,%edx
+  8016fb:	83 e2 0f             	and    $0xf,%edx
+  8016fe:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801703:	83 fa 06             	cmp    $0x6,%edx
+  801706:	74 0e                	je     801716 <sys_futex_wait+0x7e>
+  801708:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80170b:	0f b6 c9             	movzbl %cl,%ecx
+  80170e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801714:	eb 9d                	jmp    8016b3 <sys_futex_wait+0x1b>
+  801716:	89 c2                	mov    %eax,%edx
+  801718:	c1 ea 04             	shr    $0x4,%edx
+  80171b:	83 e2 0f             	and    $0xf,%edx
+  80171e:	83 fa 02             	cmp    $0x2,%edx
+  801721:	77 e5                	ja     801708 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  801723:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801726:	83 f8 02             	cmp    $0x2,%eax
+  801729:	0f 97 c1             	seta   %cl
+  80172c:	0f b6 c9             	movzbl %cl,%ecx
+  80172f:	eb d7                	jmp    801708 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  801731:	b8 20 00 00 00       	mov    $0x20,%eax
+  801736:	be 00 00 00 00       	mov    $0x0,%esi
+  80173b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80173e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801741:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  801744:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  801746:	eb 95                	jmp    8016dd <sys_futex_wait+0x45>
+
+00801748 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801748:	55                   	push   %ebp
+  801749:	89 e5                	mov    %esp,%ebp
+  80174b:	57                   	push   %edi
+  80174c:	56                   	push   %esi
+  80174d:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80174e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801755:	78 30                	js     801787 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  801757:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80175e:	74 73                	je     8017d3 <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801760:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801765:	8b 55 08             	mov    0x8(%ebp),%edx
+  801768:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80176b:	b8 21 00 00 00       	mov    $0x21,%eax
+  801770:	89 df                	mov    %ebx,%edi
+  801772:	89 de                	mov    %ebx,%esi
+  801774:	55                   	push   %ebp
+  801775:	68 7e 17 80 00       	push   $0x80177e
+  80177a:	89 e5                	mov    %esp,%ebp
+  80177c:	0f 34                	sysenter
+  80177e:	83 c4 04             	add    $0x4,%esp
+  801781:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801782:	5b                   	pop    %ebx
+  801783:	5e                   	pop    %esi
+  801784:	5f                   	pop    %edi
+  801785:	5d                   	pop    %ebp
+  801786:	c3                   	ret
+  801787:	b8 01 00 00 00       	mov    $0x1,%eax
+  80178c:	0f a2                	cpuid
+		return 0;
+  80178e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801793:	f6 c6 08             	test   $0x8,%dh
+  801796:	74 15                	je     8017ad <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801798:	89 c2                	mov    %eax,%edx
+  80179a:	c1 ea 08             	shr    $0x8,%edx
+  80179d:	83 e2 0f             	and    $0xf,%edx
+  8017a0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017a5:	83 fa 06             	cmp    $0x6,%edx
+  8017a8:	74 0e                	je     8017b8 <sys_futex_wake+0x70>
+  8017aa:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8017ad:	0f b6 c9             	movzbl %cl,%ecx
+  8017b0:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8017b6:	eb 9f                	jmp    801757 <sys_futex_wake+0xf>
+  8017b8:	89 c2                	mov    %eax,%edx
+  8017ba:	c1 ea 04             	shr    $0x4,%edx
+  8017bd:	83 e2 0f             	and    $0xf,%edx
+  8017c0:	83 fa 02             	cmp    $0x2,%edx
+  8017c3:	77 e5                	ja     8017aa <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  8017c5:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017c8:	83 f8 02             	cmp    $0x2,%eax
+  8017cb:	0f 97 c1             	seta   %cl
+  8017ce:	0f b6 c9             	movzbl %cl,%ecx
+  8017d1:	eb d7                	jmp    8017aa <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  8017d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d8:	b8 21 00 00 00       	mov    $0x21,%eax
+  8017dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017e3:	89 df                	mov    %ebx,%edi
+  8017e5:	89 de                	mov    %ebx,%esi
+  8017e7:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  8017e9:	eb 97                	jmp    801782 <sys_futex_wake+0x3a>
+
+008017eb <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  8017eb:	55                   	push   %ebp
+  8017ec:	89 e5                	mov    %esp,%ebp
+  8017ee:	57                   	push   %edi
+  8017ef:	56                   	push   %esi
+  8017f0:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8017f1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8017f8:	78 2e                	js     801828 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  8017fa:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801801:	74 71                	je     801874 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  801803:	ba 00 00 00 00       	mov    $0x0,%edx
+  801808:	b8 22 00 00 00       	mov    $0x22,%eax
+  80180d:	89 d1                	mov    %edx,%ecx
+  80180f:	89 d3                	mov    %edx,%ebx
+  801811:	89 d7                	mov    %edx,%edi
+  801813:	89 d6                	mov    %edx,%esi
+  801815:	55                   	push   %ebp
+  801816:	68 1f 18 80 00       	push   $0x80181f
+  80181b:	89 e5                	mov    %esp,%ebp
+  80181d:	0f 34                	sysenter
+  80181f:	83 c4 04             	add    $0x4,%esp
+  801822:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  801823:	5b                   	pop    %ebx
+  801824:	5e                   	pop    %esi
+  801825:	5f                   	pop    %edi
+  801826:	5d                   	pop    %ebp
+  801827:	c3                   	ret
+  801828:	b8 01 00 00 00       	mov    $0x1,%eax
+  80182d:	0f a2                	cpuid
+		return 0;
+  80182f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801834:	f6 c6 08             	test   $0x8,%dh
+  801837:	74 15                	je     80184e <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801839:	89 c2                	mov    %eax,%edx
+  80183b:	c1 ea 08             	shr    $0x8,%edx
+  80183e:	83 e2 0f             	and    $0xf,%edx
+  801841:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801846:	83 fa 06             	cmp    $0x6,%edx
+  801849:	74 0e                	je     801859 <sys_ep_create+0x6e>
+  80184b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80184e:	0f b6 c9             	movzbl %cl,%ecx
+  801851:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801857:	eb a1                	jmp    8017fa <sys_ep_create+0xf>
+  801859:	89 c2                	mov    %eax,%edx
+  80185b:	c1 ea 04             	shr    $0x4,%edx
+  80185e:	83 e2 0f             	and    $0xf,%edx
+  801861:	83 fa 02             	cmp    $0x2,%edx
+  801864:	77 e5                	ja     80184b <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  801866:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801869:	83 f8 02             	cmp    $0x2,%eax
+  80186c:	0f 97 c1             	seta   %cl
+  80186f:	0f b6 c9             	movzbl %cl,%ecx
+  801872:	eb d7                	jmp    80184b <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  801874:	ba 00 00 00 00       	mov    $0x0,%edx
+  801879:	b8 22 00 00 00       	mov    $0x22,%eax
+  80187e:	89 d1                	mov    %edx,%ecx
+  801880:	89 d3                	mov    %edx,%ebx
+  801882:	89 d7                	mov    %edx,%edi
+  801884:	89 d6                	mov    %edx,%esi
+  801886:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  801888:	eb 99                	jmp    801823 <sys_ep_create+0x38>
+
+0080188a <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  80188a:	55                   	push   %ebp
+  80188b:	89 e5                	mov    %esp,%ebp
+  80188d:	57                   	push   %edi
+  80188e:	56                   	push   %esi
+  80188f:	53                   	push   %ebx
+  801890:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801893:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80189a:	78 36                	js     8018d2 <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  80189c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8018a3:	74 79                	je     80191e <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  8018a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018ad:	b8 23 00 00 00       	mov    $0x23,%eax
+  8018b2:	89 cb                	mov    %ecx,%ebx
+  8018b4:	89 cf                	mov    %ecx,%edi
+  8018b6:	89 ce                	mov    %ecx,%esi
+  8018b8:	55                   	push   %ebp
+  8018b9:	68 c2 18 80 00       	push   $0x8018c2
+  8018be:	89 e5                	mov    %esp,%ebp
+  8018c0:	0f 34                	sysenter
+  8018c2:	83 c4 04             	add    $0x4,%esp
+  8018c5:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8018c6:	85 c0                	test   %eax,%eax
+  8018c8:	7f 6b                	jg     801935 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  8018ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018cd:	5b                   	pop    %ebx
+  8018ce:	5e                   	pop    %esi
+  8018cf:	5f                   	pop    %edi
+  8018d0:	5d                   	pop    %ebp
+  8018d1:	c3                   	ret
+  8018d2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018d7:	0f a2                	cpuid
+		return 0;
+  8018d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018de:	f6 c6 08             	test   $0x8,%dh
+  8018e1:	74 15                	je     8018f8 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018e3:	89 c2                	mov    %eax,%edx
+  8018e5:	c1 ea 08             	shr    $0x8,%edx
+  8018e8:	83 e2 0f             	and    $0xf,%edx
+  8018eb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018f0:	83 fa 06             	cmp    $0x6,%edx
+  8018f3:	74 0e                	je     801903 <sys_ep_destroy+0x79>
+  8018f5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8018f8:	0f b6 c9             	movzbl %cl,%ecx
+  8018fb:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801901:	eb 99                	jmp    80189c <sys_ep_destroy+0x12>
+  801903:	89 c2                	mov    %eax,%edx
+  801905:	c1 ea 04             	shr    $0x4,%edx
+  801908:	83 e2 0f             	and    $0xf,%edx
+  80190b:	83 fa 02             	cmp    $0x2,%edx
+  80190e:	77 e5                	ja     8018f5 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  801910:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801913:	83 f8 02             	cmp    $0x2,%eax
+  801916:	0f 97 c1             	seta   %cl
+  801919:	0f b6 c9             	movzbl %cl,%ecx
+  80191c:	eb d7                	jmp    8018f5 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  80191e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801923:	b8 23 00 00 00       	mov    $0x23,%eax
+  801928:	8b 55 08             	mov    0x8(%ebp),%edx
+  80192b:	89 cb                	mov    %ecx,%ebx
+  80192d:	89 cf                	mov    %ecx,%edi
+  80192f:	89 ce                	mov    %ecx,%esi
+  801931:	cd 30                	int    $0x30
+  801933:	eb 91                	jmp    8018c6 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801935:	83 ec 0c             	sub    $0xc,%esp
+  801938:	50                   	push   %eax
+  801939:	6a 23                	push   $0x23
+  80193b:	68 ca 27 80 00       	push   $0x8027ca
+  801940:	6a 4a                	push   $0x4a
+  801942:	68 e7 27 80 00       	push   $0x8027e7
+  801947:	e8 b8 02 00 00       	call   801c04 <_panic>
+
+0080194c <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  80194c:	55                   	push   %ebp
+  80194d:	89 e5                	mov    %esp,%ebp
+  80194f:	57                   	push   %edi
+  801950:	56                   	push   %esi
+  801951:	53                   	push   %ebx
+  801952:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801955:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80195c:	78 37                	js     801995 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  80195e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801965:	74 7a                	je     8019e1 <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  801967:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80196c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80196f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801972:	b8 24 00 00 00       	mov    $0x24,%eax
+  801977:	89 df                	mov    %ebx,%edi
+  801979:	89 de                	mov    %ebx,%esi
+  80197b:	55                   	push   %ebp
+  80197c:	68 85 19 80 00       	push   $0x801985
+  801981:	89 e5                	mov    %esp,%ebp
+  801983:	0f 34                	sysenter
+  801985:	83 c4 04             	add    $0x4,%esp
+  801988:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801989:	85 c0                	test   %eax,%eax
+  80198b:	7f 6c                	jg     8019f9 <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  80198d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801990:	5b                   	pop    %ebx
+  801991:	5e                   	pop    %esi
+  801992:	5f                   	pop    %edi
+  801993:	5d                   	pop    %ebp
+  801994:	c3                   	ret
+  801995:	b8 01 00 00 00       	mov    $0x1,%eax
+  80199a:	0f a2                	cpuid
+		return 0;
+  80199c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8019a1:	f6 c6 08             	test   $0x8,%dh
+  8019a4:	74 15                	je     8019bb <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019a6:	89 c2                	mov    %eax,%edx
+  8019a8:	c1 ea 08             	shr    $0x8,%edx
+  8019ab:	83 e2 0f             	and    $0xf,%edx
+  8019ae:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019b3:	83 fa 06             	cmp    $0x6,%edx
+  8019b6:	74 0e                	je     8019c6 <sys_ep_grant+0x7a>
+  8019b8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8019bb:	0f b6 c9             	movzbl %cl,%ecx
+  8019be:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8019c4:	eb 98                	jmp    80195e <sys_ep_grant+0x12>
+  8019c6:	89 c2                	mov    %eax,%edx
+  8019c8:	c1 ea 04             	shr    $0x4,%edx
+  8019cb:	83 e2 0f             	and    $0xf,%edx
+  8019ce:	83 fa 02             	cmp    $0x2,%edx
+  8019d1:	77 e5                	ja     8019b8 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  8019d3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019d6:	83 f8 02             	cmp    $0x2,%eax
+  8019d9:	0f 97 c1             	seta   %cl
+  8019dc:	0f b6 c9             	movzbl %cl,%ecx
+  8019df:	eb d7                	jmp    8019b8 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  8019e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019e6:	b8 24 00 00 00       	mov    $0x24,%eax
+  8019eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019f1:	89 df                	mov    %ebx,%edi
+  8019f3:	89 de                	mov    %ebx,%esi
+  8019f5:	cd 30                	int    $0x30
+  8019f7:	eb 90                	jmp    801989 <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8019f9:	83 ec 0c             	sub    $0xc,%esp
+  8019fc:	50                   	push   %eax
+  8019fd:	6a 24                	push   $0x24
+  8019ff:	68 ca 27 80 00       	push   $0x8027ca
+  801a04:	6a 4a                	push   $0x4a
+  801a06:	68 e7 27 80 00       	push   $0x8027e7
+  801a0b:	e8 f4 01 00 00       	call   801c04 <_panic>
+
+00801a10 <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  801a10:	55                   	push   %ebp
+  801a11:	89 e5                	mov    %esp,%ebp
+  801a13:	57                   	push   %edi
+  801a14:	56                   	push   %esi
+  801a15:	53                   	push   %ebx
+  801a16:	83 ec 20             	sub    $0x20,%esp
+  801a19:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801a1c:	8b 10                	mov    (%eax),%edx
+  801a1e:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801a21:	8b 50 04             	mov    0x4(%eax),%edx
+  801a24:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801a27:	8b 50 08             	mov    0x8(%eax),%edx
+  801a2a:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801a2d:	8b 50 0c             	mov    0xc(%eax),%edx
+  801a30:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801a33:	8b 40 10             	mov    0x10(%eax),%eax
+  801a36:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801a39:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801a3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a3f:	b8 25 00 00 00       	mov    $0x25,%eax
+  801a44:	55                   	push   %ebp
+  801a45:	56                   	push   %esi
+  801a46:	8b 0e                	mov    (%esi),%ecx
+  801a48:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801a4b:	8b 7e 08             	mov    0x8(%esi),%edi
+  801a4e:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801a51:	8b 76 0c             	mov    0xc(%esi),%esi
+  801a54:	cd 30                	int    $0x30
+  801a56:	87 34 24             	xchg   %esi,(%esp)
+  801a59:	89 0e                	mov    %ecx,(%esi)
+  801a5b:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801a5e:	89 7e 08             	mov    %edi,0x8(%esi)
+  801a61:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801a64:	8f 46 0c             	pop    0xc(%esi)
+  801a67:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  801a68:	83 c4 20             	add    $0x20,%esp
+  801a6b:	5b                   	pop    %ebx
+  801a6c:	5e                   	pop    %esi
+  801a6d:	5f                   	pop    %edi
+  801a6e:	5d                   	pop    %ebp
+  801a6f:	c3                   	ret
+
+00801a70 <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  801a70:	55                   	push   %ebp
+  801a71:	89 e5                	mov    %esp,%ebp
+  801a73:	57                   	push   %edi
+  801a74:	56                   	push   %esi
+  801a75:	53                   	push   %ebx
+  801a76:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  801a79:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a7c:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  801a7e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a81:	b8 26 00 00 00       	mov    $0x26,%eax
+  801a86:	55                   	push   %ebp
+  801a87:	56                   	push   %esi
+  801a88:	8b 0e                	mov    (%esi),%ecx
+  801a8a:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801a8d:	8b 7e 08             	mov    0x8(%esi),%edi
+  801a90:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801a93:	8b 76 0c             	mov    0xc(%esi),%esi
+  801a96:	cd 30                	int    $0x30
+  801a98:	87 34 24             	xchg   %esi,(%esp)
+  801a9b:	89 0e                	mov    %ecx,(%esi)
+  801a9d:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801aa0:	89 7e 08             	mov    %edi,0x8(%esi)
+  801aa3:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801aa6:	8f 46 0c             	pop    0xc(%esi)
+  801aa9:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  801aaa:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  801aae:	74 0f                	je     801abf <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  801ab0:	85 c0                	test   %eax,%eax
+  801ab2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ab7:	0f 48 d1             	cmovs  %ecx,%edx
+  801aba:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  801abd:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  801abf:	5b                   	pop    %ebx
+  801ac0:	5e                   	pop    %esi
+  801ac1:	5f                   	pop    %edi
+  801ac2:	5d                   	pop    %ebp
+  801ac3:	c3                   	ret
+
+00801ac4 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  801ac4:	55                   	push   %ebp
+  801ac5:	89 e5                	mov    %esp,%ebp
+  801ac7:	57                   	push   %edi
+  801ac8:	56                   	push   %esi
+  801ac9:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801aca:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801ad1:	78 2f                	js     801b02 <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  801ad3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801ada:	74 72                	je     801b4e <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  801adc:	8b 55 08             	mov    0x8(%ebp),%edx
+  801adf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ae4:	b8 27 00 00 00       	mov    $0x27,%eax
+  801ae9:	89 cb                	mov    %ecx,%ebx
+  801aeb:	89 cf                	mov    %ecx,%edi
+  801aed:	89 ce                	mov    %ecx,%esi
+  801aef:	55                   	push   %ebp
+  801af0:	68 f9 1a 80 00       	push   $0x801af9
+  801af5:	89 e5                	mov    %esp,%ebp
+  801af7:	0f 34                	sysenter
+  801af9:	83 c4 04             	add    $0x4,%esp
+  801afc:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  801afd:	5b                   	pop    %ebx
+  801afe:	5e                   	pop    %esi
+  801aff:	5f                   	pop    %edi
+  801b00:	5d                   	pop    %ebp
+  801b01:	c3                   	ret
+  801b02:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b07:	0f a2                	cpuid
+		return 0;
+  801b09:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b0e:	f6 c6 08             	test   $0x8,%dh
+  801b11:	74 15                	je     801b28 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b13:	89 c2                	mov    %eax,%edx
+  801b15:	c1 ea 08             	shr    $0x8,%edx
+  801b18:	83 e2 0f             	and    $0xf,%edx
+  801b1b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b20:	83 fa 06             	cmp    $0x6,%edx
+  801b23:	74 0e                	je     801b33 <sys_sysring_setup+0x6f>
+  801b25:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b28:	0f b6 c9             	movzbl %cl,%ecx
+  801b2b:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801b31:	eb a0                	jmp    801ad3 <sys_sysring_setup+0xf>
+  801b33:	89 c2                	mov    %eax,%edx
+  801b35:	c1 ea 04             	shr    $0x4,%edx
+  801b38:	83 e2 0f             	and    $0xf,%edx
+  801b3b:	83 fa 02             	cmp    $0x2,%edx
+  801b3e:	77 e5                	ja     801b25 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  801b40:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b43:	83 f8 02             	cmp    $0x2,%eax
+  801b46:	0f 97 c1             	seta   %cl
+  801b49:	0f b6 c9             	movzbl %cl,%ecx
+  801b4c:	eb d7                	jmp    801b25 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  801b4e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b53:	b8 27 00 00 00       	mov    $0x27,%eax
+  801b58:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b5b:	89 cb                	mov    %ecx,%ebx
+  801b5d:	89 cf                	mov    %ecx,%edi
+  801b5f:	89 ce                	mov    %ecx,%esi
+  801b61:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  801b63:	eb 98                	jmp    801afd <sys_sysring_setup+0x39>
+
+00801b65 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  801b65:	55                   	push   %ebp
+  801b66:	89 e5                	mov    %esp,%ebp
+  801b68:	57                   	push   %edi
+  801b69:	56                   	push   %esi
+  801b6a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801b6b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b72:	78 2e                	js     801ba2 <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  801b74:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b7b:	74 71                	je     801bee <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  801b7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b82:	b8 28 00 00 00       	mov    $0x28,%eax
+  801b87:	89 d1                	mov    %edx,%ecx
+  801b89:	89 d3                	mov    %edx,%ebx
+  801b8b:	89 d7                	mov    %edx,%edi
+  801b8d:	89 d6                	mov    %edx,%esi
+  801b8f:	55                   	push   %ebp
+  801b90:	68 99 1b 80 00       	push   $0x801b99
+  801b95:	89 e5                	mov    %esp,%ebp
+  801b97:	0f 34                	sysenter
+  801b99:	83 c4 04             	add    $0x4,%esp
+  801b9c:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801b9d:	5b                   	pop    %ebx
+  801b9e:	5e                   	pop    %esi
+  801b9f:	5f                   	pop    %edi
+  801ba0:	5d                   	pop    %ebp
+  801ba1:	c3                   	ret
+  801ba2:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ba7:	0f a2                	cpuid
+		return 0;
+  801ba9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801bae:	f6 c6 08             	test   $0x8,%dh
+  801bb1:	74 15                	je     801bc8 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bb3:	89 c2                	mov    %eax,%edx
+  801bb5:	c1 ea 08             	shr    $0x8,%edx
+  801bb8:	83 e2 0f             	and    $0xf,%edx
+  801bbb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801bc0:	83 fa 06             	cmp    $0x6,%edx
+  801bc3:	74 0e                	je     801bd3 <sys_sysring_enter+0x6e>
+  801bc5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801bc8:	0f b6 c9             	movzbl %cl,%ecx
+  801bcb:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801bd1:	eb a1                	jmp    801b74 <sys_sysring_enter+0xf>
+  801bd3:	89 c2                	mov    %eax,%edx
+  801bd5:	c1 ea 04             	shr    $0x4,%edx
+  801bd8:	83 e2 0f             	and    $0xf,%edx
+  801bdb:	83 fa 02             	cmp    $0x2,%edx
+  801bde:	77 e5                	ja     801bc5 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  801be0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801be3:	83 f8 02             	cmp    $0x2,%eax
+  801be6:	0f 97 c1             	seta   %cl
+  801be9:	0f b6 c9             	movzbl %cl,%ecx
+  801bec:	eb d7                	jmp    801bc5 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  801bee:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bf3:	b8 28 00 00 00       	mov    $0x28,%eax
+  801bf8:	89 d1                	mov    %edx,%ecx
+  801bfa:	89 d3                	mov    %edx,%ebx
+  801bfc:	89 d7                	mov    %edx,%edi
+  801bfe:	89 d6                	mov    %edx,%esi
+  801c00:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  801c02:	eb 99                	jmp    801b9d <sys_sysring_enter+0x38>
+
+00801c04 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801c04:	55                   	push   %ebp
+  801c05:	89 e5                	mov    %esp,%ebp
+  801c07:	57                   	push   %edi
+  801c08:	56                   	push   %esi
+  801c09:	53                   	push   %ebx
+  801c0a:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  801c10:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  801c13:	8b 1d 00 30 80 00    	mov    0x803000,%ebx
+  801c19:	e8 c8 e8 ff ff       	call   8004e6 <sys_getenvid>
+  801c1e:	83 ec 04             	sub    $0x4,%esp
+  801c21:	ff 75 0c             	push   0xc(%ebp)
+  801c24:	ff 75 08             	push   0x8(%ebp)
+  801c27:	53                   	push   %ebx
+  801c28:	50                   	push   %eax
+  801c29:	68 f8 27 80 00       	push   $0x8027f8
+  801c2e:	68 00 01 00 00       	push   $0x100
+  801c33:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  801c39:	56                   	push   %esi
+  801c3a:	e8 c9 05 00 00       	call   802208 <snprintf>
+  801c3f:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  801c41:	83 c4 20             	add    $0x20,%esp
+  801c44:	57                   	push   %edi
+  801c45:	ff 75 10             	push   0x10(%ebp)
+  801c48:	bf 00 01 00 00       	mov    $0x100,%edi
+  801c4d:	89 f8                	mov    %edi,%eax
+  801c4f:	29 d8                	sub    %ebx,%eax
+  801c51:	50                   	push   %eax
+  801c52:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801c55:	50                   	push   %eax
+  801c56:	e8 5f 05 00 00       	call   8021ba <vsnprintf>
+  801c5b:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  801c5d:	83 c4 0c             	add    $0xc,%esp
+  801c60:	68 1b 28 80 00       	push   $0x80281b
+  801c65:	29 df                	sub    %ebx,%edi
+  801c67:	57                   	push   %edi
+  801c68:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801c6b:	50                   	push   %eax
+  801c6c:	e8 97 05 00 00       	call   802208 <snprintf>
+	sys_cputs(buf, r);
+  801c71:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  801c74:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  801c76:	53                   	push   %ebx
+  801c77:	56                   	push   %esi
+  801c78:	e8 6b e6 ff ff       	call   8002e8 <sys_cputs>
+  801c7d:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801c80:	cc                   	int3
+	while (1)
+  801c81:	eb fd                	jmp    801c80 <_panic+0x7c>
+
+00801c83 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801c83:	55                   	push   %ebp
+  801c84:	89 e5                	mov    %esp,%ebp
+  801c86:	57                   	push   %edi
+  801c87:	56                   	push   %esi
+  801c88:	53                   	push   %ebx
+  801c89:	83 ec 1c             	sub    $0x1c,%esp
+  801c8c:	89 c7                	mov    %eax,%edi
+  801c8e:	89 d6                	mov    %edx,%esi
+  801c90:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c93:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c96:	89 d1                	mov    %edx,%ecx
+  801c98:	89 c2                	mov    %eax,%edx
+  801c9a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801c9d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801ca0:	8b 45 10             	mov    0x10(%ebp),%eax
+  801ca3:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  801ca6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801ca9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801cb0:	39 c2                	cmp    %eax,%edx
+  801cb2:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  801cb5:	72 3e                	jb     801cf5 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801cb7:	83 ec 0c             	sub    $0xc,%esp
+  801cba:	ff 75 18             	push   0x18(%ebp)
+  801cbd:	83 eb 01             	sub    $0x1,%ebx
+  801cc0:	53                   	push   %ebx
+  801cc1:	50                   	push   %eax
+  801cc2:	83 ec 08             	sub    $0x8,%esp
+  801cc5:	ff 75 e4             	push   -0x1c(%ebp)
+  801cc8:	ff 75 e0             	push   -0x20(%ebp)
+  801ccb:	ff 75 dc             	push   -0x24(%ebp)
+  801cce:	ff 75 d8             	push   -0x28(%ebp)
+  801cd1:	e8 9a 09 00 00       	call   802670 <__udivdi3>
+  801cd6:	83 c4 18             	add    $0x18,%esp
+  801cd9:	52                   	push   %edx
+  801cda:	50                   	push   %eax
+  801cdb:	89 f2                	mov    %esi,%edx
+  801cdd:	89 f8                	mov    %edi,%eax
+  801cdf:	e8 9f ff ff ff       	call   801c83 <printnum>
+  801ce4:	83 c4 20             	add    $0x20,%esp
+  801ce7:	eb 13                	jmp    801cfc <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  801ce9:	83 ec 08             	sub    $0x8,%esp
+  801cec:	56                   	push   %esi
+  801ced:	ff 75 18             	push   0x18(%ebp)
+  801cf0:	ff d7                	call   *%edi
+  801cf2:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  801cf5:	83 eb 01             	sub    $0x1,%ebx
+  801cf8:	85 db                	test   %ebx,%ebx
+  801cfa:	7f ed                	jg     801ce9 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  801cfc:	83 ec 08             	sub    $0x8,%esp
+  801cff:	56                   	push   %esi
+  801d00:	83 ec 04             	sub    $0x4,%esp
+  801d03:	ff 75 e4             	push   -0x1c(%ebp)
+  801d06:	ff 75 e0             	push   -0x20(%ebp)
+  801d09:	ff 75 dc             	push   -0x24(%ebp)
+  801d0c:	ff 75 d8             	push   -0x28(%ebp)
+  801d0f:	e8 7a 09 00 00       	call   80268e <__umoddi3>
+  801d14:	83 c4 14             	add    $0x14,%esp
+  801d17:	0f be 80 1d 28 80 00 	movsbl 0x80281d(%eax),%eax
+  801d1e:	50                   	push   %eax
+  801d1f:	ff d7                	call   *%edi
+}
+  801d21:	83 c4 10             	add    $0x10,%esp
+  801d24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d27:	5b                   	pop    %ebx
+  801d28:	5e                   	pop    %esi
+  801d29:	5f                   	pop    %edi
+  801d2a:	5d                   	pop    %ebp
+  801d2b:	c3                   	ret
+
+00801d2c <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801d2c:	55                   	push   %ebp
+  801d2d:	89 e5                	mov    %esp,%ebp
+  801d2f:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  801d32:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  801d36:	8b 10                	mov    (%eax),%edx
+  801d38:	3b 50 04             	cmp    0x4(%eax),%edx
+  801d3b:	73 0a                	jae    801d47 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  801d3d:	8d 4a 01             	lea    0x1(%edx),%ecx
+  801d40:	89 08                	mov    %ecx,(%eax)
+  801d42:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d45:	88 02                	mov    %al,(%edx)
+}
+  801d47:	5d                   	pop    %ebp
+  801d48:	c3                   	ret
+
+00801d49 <printfmt>:
+{
+  801d49:	55                   	push   %ebp
+  801d4a:	89 e5                	mov    %esp,%ebp
+  801d4c:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  801d4f:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  801d52:	50                   	push   %eax
+  801d53:	ff 75 10             	push   0x10(%ebp)
+  801d56:	ff 75 0c             	push   0xc(%ebp)
+  801d59:	ff 75 08             	push   0x8(%ebp)
+  801d5c:	e8 05 00 00 00       	call   801d66 <vprintfmt>
+}
+  801d61:	83 c4 10             	add    $0x10,%esp
+  801d64:	c9                   	leave
+  801d65:	c3                   	ret
+
+00801d66 <vprintfmt>:
+{
+  801d66:	55                   	push   %ebp
+  801d67:	89 e5                	mov    %esp,%ebp
+  801d69:	57                   	push   %edi
+  801d6a:	56                   	push   %esi
+  801d6b:	53                   	push   %ebx
+  801d6c:	83 ec 2c             	sub    $0x2c,%esp
+  801d6f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d72:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801d75:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801d78:	eb 0a                	jmp    801d84 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  801d7a:	83 ec 08             	sub    $0x8,%esp
+  801d7d:	53                   	push   %ebx
+  801d7e:	50                   	push   %eax
+  801d7f:	ff d6                	call   *%esi
+  801d81:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801d84:	83 c7 01             	add    $0x1,%edi
+  801d87:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801d8b:	83 f8 25             	cmp    $0x25,%eax
+  801d8e:	74 0c                	je     801d9c <vprintfmt+0x36>
+			if (ch == '\0')
+  801d90:	85 c0                	test   %eax,%eax
+  801d92:	75 e6                	jne    801d7a <vprintfmt+0x14>
+}
+  801d94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d97:	5b                   	pop    %ebx
+  801d98:	5e                   	pop    %esi
+  801d99:	5f                   	pop    %edi
+  801d9a:	5d                   	pop    %ebp
+  801d9b:	c3                   	ret
+		padc = ' ';
+  801d9c:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801da0:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  801da7:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801dae:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  801db5:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801dba:	8d 47 01             	lea    0x1(%edi),%eax
+  801dbd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801dc0:	0f b6 17             	movzbl (%edi),%edx
+  801dc3:	8d 42 dd             	lea    -0x23(%edx),%eax
+  801dc6:	3c 55                	cmp    $0x55,%al
+  801dc8:	0f 87 cf 03 00 00    	ja     80219d <vprintfmt+0x437>
+  801dce:	0f b6 c0             	movzbl %al,%eax
+  801dd1:	ff 24 85 00 29 80 00 	jmp    *0x802900(,%eax,4)
+  801dd8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801ddb:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801ddf:	eb d9                	jmp    801dba <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801de1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801de4:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  801de8:	eb d0                	jmp    801dba <vprintfmt+0x54>
+  801dea:	0f b6 d2             	movzbl %dl,%edx
+  801ded:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  801df0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  801df8:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801dfb:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  801dff:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  801e02:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  801e05:	83 f9 09             	cmp    $0x9,%ecx
+  801e08:	77 55                	ja     801e5f <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  801e0a:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  801e0d:	eb e9                	jmp    801df8 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  801e0f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e12:	8b 00                	mov    (%eax),%eax
+  801e14:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801e17:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e1a:	8d 40 04             	lea    0x4(%eax),%eax
+  801e1d:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801e20:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  801e23:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801e27:	79 91                	jns    801dba <vprintfmt+0x54>
+				width = precision, precision = -1;
+  801e29:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801e2c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801e2f:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  801e36:	eb 82                	jmp    801dba <vprintfmt+0x54>
+			if (width < 0)
+  801e38:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801e3b:	85 d2                	test   %edx,%edx
+  801e3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e42:	0f 49 c2             	cmovns %edx,%eax
+  801e45:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801e48:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801e4b:	e9 6a ff ff ff       	jmp    801dba <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801e50:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  801e53:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  801e5a:	e9 5b ff ff ff       	jmp    801dba <vprintfmt+0x54>
+  801e5f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801e62:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801e65:	eb bc                	jmp    801e23 <vprintfmt+0xbd>
+			lflag++;
+  801e67:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801e6a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801e6d:	e9 48 ff ff ff       	jmp    801dba <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  801e72:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e75:	8d 78 04             	lea    0x4(%eax),%edi
+  801e78:	83 ec 08             	sub    $0x8,%esp
+  801e7b:	53                   	push   %ebx
+  801e7c:	ff 30                	push   (%eax)
+  801e7e:	ff d6                	call   *%esi
+			break;
+  801e80:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801e83:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  801e86:	e9 b1 02 00 00       	jmp    80213c <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  801e8b:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e8e:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801e91:	8b 10                	mov    (%eax),%edx
+  801e93:	89 d0                	mov    %edx,%eax
+  801e95:	f7 d8                	neg    %eax
+  801e97:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801e9a:	83 f8 0d             	cmp    $0xd,%eax
+  801e9d:	7f 23                	jg     801ec2 <vprintfmt+0x15c>
+  801e9f:	8b 14 85 60 2a 80 00 	mov    0x802a60(,%eax,4),%edx
+  801ea6:	85 d2                	test   %edx,%edx
+  801ea8:	74 18                	je     801ec2 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801eaa:	52                   	push   %edx
+  801eab:	68 3e 28 80 00       	push   $0x80283e
+  801eb0:	53                   	push   %ebx
+  801eb1:	56                   	push   %esi
+  801eb2:	e8 92 fe ff ff       	call   801d49 <printfmt>
+  801eb7:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801eba:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801ebd:	e9 7a 02 00 00       	jmp    80213c <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  801ec2:	50                   	push   %eax
+  801ec3:	68 35 28 80 00       	push   $0x802835
+  801ec8:	53                   	push   %ebx
+  801ec9:	56                   	push   %esi
+  801eca:	e8 7a fe ff ff       	call   801d49 <printfmt>
+  801ecf:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801ed2:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801ed5:	e9 62 02 00 00       	jmp    80213c <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801eda:	8b 45 14             	mov    0x14(%ebp),%eax
+  801edd:	83 c0 04             	add    $0x4,%eax
+  801ee0:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801ee3:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ee6:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801ee8:	85 c9                	test   %ecx,%ecx
+  801eea:	b8 2e 28 80 00       	mov    $0x80282e,%eax
+  801eef:	0f 45 c1             	cmovne %ecx,%eax
+  801ef2:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801ef5:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801ef9:	7e 06                	jle    801f01 <vprintfmt+0x19b>
+  801efb:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801eff:	75 0b                	jne    801f0c <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f01:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801f04:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801f07:	89 75 08             	mov    %esi,0x8(%ebp)
+  801f0a:	eb 5c                	jmp    801f68 <vprintfmt+0x202>
+  801f0c:	83 ec 08             	sub    $0x8,%esp
+  801f0f:	ff 75 d0             	push   -0x30(%ebp)
+  801f12:	ff 75 cc             	push   -0x34(%ebp)
+  801f15:	e8 20 03 00 00       	call   80223a <strnlen>
+  801f1a:	89 c2                	mov    %eax,%edx
+  801f1c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f1f:	29 d0                	sub    %edx,%eax
+  801f21:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801f24:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  801f28:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801f2b:	89 75 08             	mov    %esi,0x8(%ebp)
+  801f2e:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f30:	eb 0e                	jmp    801f40 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801f32:	83 ec 08             	sub    $0x8,%esp
+  801f35:	53                   	push   %ebx
+  801f36:	57                   	push   %edi
+  801f37:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f3a:	83 ee 01             	sub    $0x1,%esi
+  801f3d:	83 c4 10             	add    $0x10,%esp
+  801f40:	85 f6                	test   %esi,%esi
+  801f42:	7f ee                	jg     801f32 <vprintfmt+0x1cc>
+  801f44:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f47:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f4a:	85 c0                	test   %eax,%eax
+  801f4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f51:	0f 49 d0             	cmovns %eax,%edx
+  801f54:	29 d0                	sub    %edx,%eax
+  801f56:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801f59:	eb a6                	jmp    801f01 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801f5b:	83 ec 08             	sub    $0x8,%esp
+  801f5e:	53                   	push   %ebx
+  801f5f:	52                   	push   %edx
+  801f60:	ff 55 08             	call   *0x8(%ebp)
+  801f63:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801f66:	89 f1                	mov    %esi,%ecx
+  801f68:	8d 71 01             	lea    0x1(%ecx),%esi
+  801f6b:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801f6f:	0f be d0             	movsbl %al,%edx
+  801f72:	85 d2                	test   %edx,%edx
+  801f74:	74 28                	je     801f9e <vprintfmt+0x238>
+  801f76:	85 ff                	test   %edi,%edi
+  801f78:	78 05                	js     801f7f <vprintfmt+0x219>
+  801f7a:	83 ef 01             	sub    $0x1,%edi
+  801f7d:	78 30                	js     801faf <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801f7f:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801f83:	74 d6                	je     801f5b <vprintfmt+0x1f5>
+  801f85:	0f be c0             	movsbl %al,%eax
+  801f88:	83 e8 20             	sub    $0x20,%eax
+  801f8b:	83 f8 5e             	cmp    $0x5e,%eax
+  801f8e:	76 cb                	jbe    801f5b <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801f90:	83 ec 08             	sub    $0x8,%esp
+  801f93:	53                   	push   %ebx
+  801f94:	6a 3f                	push   $0x3f
+  801f96:	ff 55 08             	call   *0x8(%ebp)
+  801f99:	83 c4 10             	add    $0x10,%esp
+  801f9c:	eb c8                	jmp    801f66 <vprintfmt+0x200>
+  801f9e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fa1:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801fa4:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801fa7:	01 d0                	add    %edx,%eax
+  801fa9:	29 c8                	sub    %ecx,%eax
+  801fab:	89 c7                	mov    %eax,%edi
+  801fad:	eb 13                	jmp    801fc2 <vprintfmt+0x25c>
+  801faf:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fb2:	eb ed                	jmp    801fa1 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801fb4:	83 ec 08             	sub    $0x8,%esp
+  801fb7:	53                   	push   %ebx
+  801fb8:	6a 20                	push   $0x20
+  801fba:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801fbc:	83 ef 01             	sub    $0x1,%edi
+  801fbf:	83 c4 10             	add    $0x10,%esp
+  801fc2:	85 ff                	test   %edi,%edi
+  801fc4:	7f ee                	jg     801fb4 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801fc6:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801fc9:	89 45 14             	mov    %eax,0x14(%ebp)
+  801fcc:	e9 6b 01 00 00       	jmp    80213c <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  801fd1:	83 f9 01             	cmp    $0x1,%ecx
+  801fd4:	7f 1f                	jg     801ff5 <vprintfmt+0x28f>
+	else if (lflag)
+  801fd6:	85 c9                	test   %ecx,%ecx
+  801fd8:	74 67                	je     802041 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  801fda:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fdd:	8b 00                	mov    (%eax),%eax
+  801fdf:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801fe2:	89 c1                	mov    %eax,%ecx
+  801fe4:	c1 f9 1f             	sar    $0x1f,%ecx
+  801fe7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801fea:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fed:	8d 40 04             	lea    0x4(%eax),%eax
+  801ff0:	89 45 14             	mov    %eax,0x14(%ebp)
+  801ff3:	eb 17                	jmp    80200c <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  801ff5:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ff8:	8b 50 04             	mov    0x4(%eax),%edx
+  801ffb:	8b 00                	mov    (%eax),%eax
+  801ffd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802000:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802003:	8b 45 14             	mov    0x14(%ebp),%eax
+  802006:	8d 40 08             	lea    0x8(%eax),%eax
+  802009:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80200c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80200f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  802012:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  802017:	85 c9                	test   %ecx,%ecx
+  802019:	0f 89 03 01 00 00    	jns    802122 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  80201f:	83 ec 08             	sub    $0x8,%esp
+  802022:	53                   	push   %ebx
+  802023:	6a 2d                	push   $0x2d
+  802025:	ff d6                	call   *%esi
+				num = -(long long) num;
+  802027:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80202a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80202d:	f7 da                	neg    %edx
+  80202f:	83 d1 00             	adc    $0x0,%ecx
+  802032:	f7 d9                	neg    %ecx
+  802034:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  802037:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80203c:	e9 e1 00 00 00       	jmp    802122 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  802041:	8b 45 14             	mov    0x14(%ebp),%eax
+  802044:	8b 00                	mov    (%eax),%eax
+  802046:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802049:	89 c1                	mov    %eax,%ecx
+  80204b:	c1 f9 1f             	sar    $0x1f,%ecx
+  80204e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802051:	8b 45 14             	mov    0x14(%ebp),%eax
+  802054:	8d 40 04             	lea    0x4(%eax),%eax
+  802057:	89 45 14             	mov    %eax,0x14(%ebp)
+  80205a:	eb b0                	jmp    80200c <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80205c:	83 f9 01             	cmp    $0x1,%ecx
+  80205f:	7f 1e                	jg     80207f <vprintfmt+0x319>
+	else if (lflag)
+  802061:	85 c9                	test   %ecx,%ecx
+  802063:	74 32                	je     802097 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  802065:	8b 45 14             	mov    0x14(%ebp),%eax
+  802068:	8b 10                	mov    (%eax),%edx
+  80206a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80206f:	8d 40 04             	lea    0x4(%eax),%eax
+  802072:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802075:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80207a:	e9 a3 00 00 00       	jmp    802122 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80207f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802082:	8b 10                	mov    (%eax),%edx
+  802084:	8b 48 04             	mov    0x4(%eax),%ecx
+  802087:	8d 40 08             	lea    0x8(%eax),%eax
+  80208a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80208d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  802092:	e9 8b 00 00 00       	jmp    802122 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802097:	8b 45 14             	mov    0x14(%ebp),%eax
+  80209a:	8b 10                	mov    (%eax),%edx
+  80209c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020a1:	8d 40 04             	lea    0x4(%eax),%eax
+  8020a4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8020a7:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8020ac:	eb 74                	jmp    802122 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8020ae:	83 f9 01             	cmp    $0x1,%ecx
+  8020b1:	7f 1b                	jg     8020ce <vprintfmt+0x368>
+	else if (lflag)
+  8020b3:	85 c9                	test   %ecx,%ecx
+  8020b5:	74 2c                	je     8020e3 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8020b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020ba:	8b 10                	mov    (%eax),%edx
+  8020bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020c1:	8d 40 04             	lea    0x4(%eax),%eax
+  8020c4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8020c7:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8020cc:	eb 54                	jmp    802122 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8020ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020d1:	8b 10                	mov    (%eax),%edx
+  8020d3:	8b 48 04             	mov    0x4(%eax),%ecx
+  8020d6:	8d 40 08             	lea    0x8(%eax),%eax
+  8020d9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8020dc:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8020e1:	eb 3f                	jmp    802122 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8020e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020e6:	8b 10                	mov    (%eax),%edx
+  8020e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020ed:	8d 40 04             	lea    0x4(%eax),%eax
+  8020f0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8020f3:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8020f8:	eb 28                	jmp    802122 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8020fa:	83 ec 08             	sub    $0x8,%esp
+  8020fd:	53                   	push   %ebx
+  8020fe:	6a 30                	push   $0x30
+  802100:	ff d6                	call   *%esi
+			putch('x', putdat);
+  802102:	83 c4 08             	add    $0x8,%esp
+  802105:	53                   	push   %ebx
+  802106:	6a 78                	push   $0x78
+  802108:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80210a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80210d:	8b 10                	mov    (%eax),%edx
+  80210f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  802114:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  802117:	8d 40 04             	lea    0x4(%eax),%eax
+  80211a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80211d:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  802122:	83 ec 0c             	sub    $0xc,%esp
+  802125:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  802129:	50                   	push   %eax
+  80212a:	ff 75 e0             	push   -0x20(%ebp)
+  80212d:	57                   	push   %edi
+  80212e:	51                   	push   %ecx
+  80212f:	52                   	push   %edx
+  802130:	89 da                	mov    %ebx,%edx
+  802132:	89 f0                	mov    %esi,%eax
+  802134:	e8 4a fb ff ff       	call   801c83 <printnum>
+			break;
+  802139:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80213c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80213f:	e9 40 fc ff ff       	jmp    801d84 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  802144:	83 f9 01             	cmp    $0x1,%ecx
+  802147:	7f 1b                	jg     802164 <vprintfmt+0x3fe>
+	else if (lflag)
+  802149:	85 c9                	test   %ecx,%ecx
+  80214b:	74 2c                	je     802179 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  80214d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802150:	8b 10                	mov    (%eax),%edx
+  802152:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802157:	8d 40 04             	lea    0x4(%eax),%eax
+  80215a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80215d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  802162:	eb be                	jmp    802122 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802164:	8b 45 14             	mov    0x14(%ebp),%eax
+  802167:	8b 10                	mov    (%eax),%edx
+  802169:	8b 48 04             	mov    0x4(%eax),%ecx
+  80216c:	8d 40 08             	lea    0x8(%eax),%eax
+  80216f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802172:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  802177:	eb a9                	jmp    802122 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802179:	8b 45 14             	mov    0x14(%ebp),%eax
+  80217c:	8b 10                	mov    (%eax),%edx
+  80217e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802183:	8d 40 04             	lea    0x4(%eax),%eax
+  802186:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802189:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80218e:	eb 92                	jmp    802122 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  802190:	83 ec 08             	sub    $0x8,%esp
+  802193:	53                   	push   %ebx
+  802194:	6a 25                	push   $0x25
+  802196:	ff d6                	call   *%esi
+			break;
+  802198:	83 c4 10             	add    $0x10,%esp
+  80219b:	eb 9f                	jmp    80213c <vprintfmt+0x3d6>
+			putch('%', putdat);
+  80219d:	83 ec 08             	sub    $0x8,%esp
+  8021a0:	53                   	push   %ebx
+  8021a1:	6a 25                	push   $0x25
+  8021a3:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8021a5:	83 c4 10             	add    $0x10,%esp
+  8021a8:	89 f8                	mov    %edi,%eax
+  8021aa:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8021ae:	74 05                	je     8021b5 <vprintfmt+0x44f>
+  8021b0:	83 e8 01             	sub    $0x1,%eax
+  8021b3:	eb f5                	jmp    8021aa <vprintfmt+0x444>
+  8021b5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8021b8:	eb 82                	jmp    80213c <vprintfmt+0x3d6>
+
+008021ba <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8021ba:	55                   	push   %ebp
+  8021bb:	89 e5                	mov    %esp,%ebp
+  8021bd:	83 ec 18             	sub    $0x18,%esp
+  8021c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8021c6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8021c9:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8021cd:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8021d0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8021d7:	85 c0                	test   %eax,%eax
+  8021d9:	74 26                	je     802201 <vsnprintf+0x47>
+  8021db:	85 d2                	test   %edx,%edx
+  8021dd:	7e 22                	jle    802201 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8021df:	ff 75 14             	push   0x14(%ebp)
+  8021e2:	ff 75 10             	push   0x10(%ebp)
+  8021e5:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8021e8:	50                   	push   %eax
+  8021e9:	68 2c 1d 80 00       	push   $0x801d2c
+  8021ee:	e8 73 fb ff ff       	call   801d66 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8021f3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8021f6:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8021f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021fc:	83 c4 10             	add    $0x10,%esp
+}
+  8021ff:	c9                   	leave
+  802200:	c3                   	ret
+		return -E_INVAL;
+  802201:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802206:	eb f7                	jmp    8021ff <vsnprintf+0x45>
+
+00802208 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  802208:	55                   	push   %ebp
+  802209:	89 e5                	mov    %esp,%ebp
+  80220b:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80220e:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  802211:	50                   	push   %eax
+  802212:	ff 75 10             	push   0x10(%ebp)
+  802215:	ff 75 0c             	push   0xc(%ebp)
+  802218:	ff 75 08             	push   0x8(%ebp)
+  80221b:	e8 9a ff ff ff       	call   8021ba <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  802220:	c9                   	leave
+  802221:	c3                   	ret
+
+00802222 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  802222:	55                   	push   %ebp
+  802223:	89 e5                	mov    %esp,%ebp
+  802225:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  802228:	b8 00 00 00 00       	mov    $0x0,%eax
+  80222d:	eb 03                	jmp    802232 <strlen+0x10>
+		n++;
+  80222f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  802232:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802236:	75 f7                	jne    80222f <strlen+0xd>
+	return n;
+}
+  802238:	5d                   	pop    %ebp
+  802239:	c3                   	ret
+
+0080223a <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80223a:	55                   	push   %ebp
+  80223b:	89 e5                	mov    %esp,%ebp
+  80223d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802240:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802243:	b8 00 00 00 00       	mov    $0x0,%eax
+  802248:	eb 03                	jmp    80224d <strnlen+0x13>
+		n++;
+  80224a:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80224d:	39 d0                	cmp    %edx,%eax
+  80224f:	74 08                	je     802259 <strnlen+0x1f>
+  802251:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802255:	75 f3                	jne    80224a <strnlen+0x10>
+  802257:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  802259:	89 d0                	mov    %edx,%eax
+  80225b:	5d                   	pop    %ebp
+  80225c:	c3                   	ret
+
+0080225d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80225d:	55                   	push   %ebp
+  80225e:	89 e5                	mov    %esp,%ebp
+  802260:	53                   	push   %ebx
+  802261:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802264:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  802267:	b8 00 00 00 00       	mov    $0x0,%eax
+  80226c:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  802270:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  802273:	83 c0 01             	add    $0x1,%eax
+  802276:	84 d2                	test   %dl,%dl
+  802278:	75 f2                	jne    80226c <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80227a:	89 c8                	mov    %ecx,%eax
+  80227c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80227f:	c9                   	leave
+  802280:	c3                   	ret
+
+00802281 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  802281:	55                   	push   %ebp
+  802282:	89 e5                	mov    %esp,%ebp
+  802284:	53                   	push   %ebx
+  802285:	83 ec 10             	sub    $0x10,%esp
+  802288:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80228b:	53                   	push   %ebx
+  80228c:	e8 91 ff ff ff       	call   802222 <strlen>
+  802291:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  802294:	ff 75 0c             	push   0xc(%ebp)
+  802297:	01 d8                	add    %ebx,%eax
+  802299:	50                   	push   %eax
+  80229a:	e8 be ff ff ff       	call   80225d <strcpy>
+	return dst;
+}
+  80229f:	89 d8                	mov    %ebx,%eax
+  8022a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022a4:	c9                   	leave
+  8022a5:	c3                   	ret
+
+008022a6 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8022a6:	55                   	push   %ebp
+  8022a7:	89 e5                	mov    %esp,%ebp
+  8022a9:	56                   	push   %esi
+  8022aa:	53                   	push   %ebx
+  8022ab:	8b 75 08             	mov    0x8(%ebp),%esi
+  8022ae:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8022b1:	89 f3                	mov    %esi,%ebx
+  8022b3:	03 5d 10             	add    0x10(%ebp),%ebx
+  8022b6:	89 f0                	mov    %esi,%eax
+  8022b8:	eb 0f                	jmp    8022c9 <strncpy+0x23>
+		*dst++ = *src;
+  8022ba:	83 c0 01             	add    $0x1,%eax
+  8022bd:	0f b6 0a             	movzbl (%edx),%ecx
+  8022c0:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8022c3:	80 f9 01             	cmp    $0x1,%cl
+  8022c6:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8022c9:	39 d8                	cmp    %ebx,%eax
+  8022cb:	75 ed                	jne    8022ba <strncpy+0x14>
+	}
+	return ret;
+}
+  8022cd:	89 f0                	mov    %esi,%eax
+  8022cf:	5b                   	pop    %ebx
+  8022d0:	5e                   	pop    %esi
+  8022d1:	5d                   	pop    %ebp
+  8022d2:	c3                   	ret
+
+008022d3 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8022d3:	55                   	push   %ebp
+  8022d4:	89 e5                	mov    %esp,%ebp
+  8022d6:	56                   	push   %esi
+  8022d7:	53                   	push   %ebx
+  8022d8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8022db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022de:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8022e1:	89 f0                	mov    %esi,%eax
+  8022e3:	85 d2                	test   %edx,%edx
+  8022e5:	74 21                	je     802308 <strlcpy+0x35>
+  8022e7:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8022eb:	89 f2                	mov    %esi,%edx
+  8022ed:	eb 09                	jmp    8022f8 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8022ef:	83 c1 01             	add    $0x1,%ecx
+  8022f2:	83 c2 01             	add    $0x1,%edx
+  8022f5:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8022f8:	39 c2                	cmp    %eax,%edx
+  8022fa:	74 09                	je     802305 <strlcpy+0x32>
+  8022fc:	0f b6 19             	movzbl (%ecx),%ebx
+  8022ff:	84 db                	test   %bl,%bl
+  802301:	75 ec                	jne    8022ef <strlcpy+0x1c>
+  802303:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  802305:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  802308:	29 f0                	sub    %esi,%eax
+}
+  80230a:	5b                   	pop    %ebx
+  80230b:	5e                   	pop    %esi
+  80230c:	5d                   	pop    %ebp
+  80230d:	c3                   	ret
+
+0080230e <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80230e:	55                   	push   %ebp
+  80230f:	89 e5                	mov    %esp,%ebp
+  802311:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802314:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  802317:	eb 06                	jmp    80231f <strcmp+0x11>
+		p++, q++;
+  802319:	83 c1 01             	add    $0x1,%ecx
+  80231c:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80231f:	0f b6 01             	movzbl (%ecx),%eax
+  802322:	84 c0                	test   %al,%al
+  802324:	74 04                	je     80232a <strcmp+0x1c>
+  802326:	3a 02                	cmp    (%edx),%al
+  802328:	74 ef                	je     802319 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80232a:	0f b6 c0             	movzbl %al,%eax
+  80232d:	0f b6 12             	movzbl (%edx),%edx
+  802330:	29 d0                	sub    %edx,%eax
+}
+  802332:	5d                   	pop    %ebp
+  802333:	c3                   	ret
+
+00802334 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  802334:	55                   	push   %ebp
+  802335:	89 e5                	mov    %esp,%ebp
+  802337:	53                   	push   %ebx
+  802338:	8b 45 08             	mov    0x8(%ebp),%eax
+  80233b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80233e:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  802341:	eb 09                	jmp    80234c <strncmp+0x18>
+		n--, p++, q++;
+  802343:	83 ea 01             	sub    $0x1,%edx
+  802346:	83 c0 01             	add    $0x1,%eax
+  802349:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80234c:	85 d2                	test   %edx,%edx
+  80234e:	74 18                	je     802368 <strncmp+0x34>
+  802350:	0f b6 18             	movzbl (%eax),%ebx
+  802353:	84 db                	test   %bl,%bl
+  802355:	74 04                	je     80235b <strncmp+0x27>
+  802357:	3a 19                	cmp    (%ecx),%bl
+  802359:	74 e8                	je     802343 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80235b:	0f b6 00             	movzbl (%eax),%eax
+  80235e:	0f b6 11             	movzbl (%ecx),%edx
+  802361:	29 d0                	sub    %edx,%eax
+}
+  802363:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802366:	c9                   	leave
+  802367:	c3                   	ret
+		return 0;
+  802368:	b8 00 00 00 00       	mov    $0x0,%eax
+  80236d:	eb f4                	jmp    802363 <strncmp+0x2f>
+
+0080236f <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80236f:	55                   	push   %ebp
+  802370:	89 e5                	mov    %esp,%ebp
+  802372:	8b 45 08             	mov    0x8(%ebp),%eax
+  802375:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  802379:	eb 03                	jmp    80237e <strchr+0xf>
+  80237b:	83 c0 01             	add    $0x1,%eax
+  80237e:	0f b6 10             	movzbl (%eax),%edx
+  802381:	84 d2                	test   %dl,%dl
+  802383:	74 06                	je     80238b <strchr+0x1c>
+		if (*s == c)
+  802385:	38 ca                	cmp    %cl,%dl
+  802387:	75 f2                	jne    80237b <strchr+0xc>
+  802389:	eb 05                	jmp    802390 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80238b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802390:	5d                   	pop    %ebp
+  802391:	c3                   	ret
+
+00802392 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  802392:	55                   	push   %ebp
+  802393:	89 e5                	mov    %esp,%ebp
+  802395:	8b 45 08             	mov    0x8(%ebp),%eax
+  802398:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80239c:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80239f:	38 ca                	cmp    %cl,%dl
+  8023a1:	74 09                	je     8023ac <strfind+0x1a>
+  8023a3:	84 d2                	test   %dl,%dl
+  8023a5:	74 05                	je     8023ac <strfind+0x1a>
+	for (; *s; s++)
+  8023a7:	83 c0 01             	add    $0x1,%eax
+  8023aa:	eb f0                	jmp    80239c <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8023ac:	5d                   	pop    %ebp
+  8023ad:	c3                   	ret
+
+008023ae <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8023ae:	55                   	push   %ebp
+  8023af:	89 e5                	mov    %esp,%ebp
+  8023b1:	57                   	push   %edi
+  8023b2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8023b5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8023b8:	85 c9                	test   %ecx,%ecx
+  8023ba:	74 20                	je     8023dc <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8023bc:	89 f8                	mov    %edi,%eax
+  8023be:	09 c8                	or     %ecx,%eax
+  8023c0:	a8 03                	test   $0x3,%al
+  8023c2:	75 12                	jne    8023d6 <memset+0x28>
+		c &= 0xFF;
+  8023c4:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8023c8:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8023ce:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8023d1:	fc                   	cld
+  8023d2:	f3 ab                	rep stos %eax,%es:(%edi)
+  8023d4:	eb 06                	jmp    8023dc <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8023d6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023d9:	fc                   	cld
+  8023da:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8023dc:	89 f8                	mov    %edi,%eax
+  8023de:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8023e1:	c9                   	leave
+  8023e2:	c3                   	ret
+
+008023e3 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8023e3:	55                   	push   %ebp
+  8023e4:	89 e5                	mov    %esp,%ebp
+  8023e6:	57                   	push   %edi
+  8023e7:	56                   	push   %esi
+  8023e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8023ee:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8023f1:	39 c6                	cmp    %eax,%esi
+  8023f3:	73 32                	jae    802427 <memmove+0x44>
+  8023f5:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8023f8:	39 d0                	cmp    %edx,%eax
+  8023fa:	73 2b                	jae    802427 <memmove+0x44>
+		s += n;
+		d += n;
+  8023fc:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8023ff:	89 d6                	mov    %edx,%esi
+  802401:	09 fe                	or     %edi,%esi
+  802403:	09 ce                	or     %ecx,%esi
+  802405:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80240b:	75 0e                	jne    80241b <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80240d:	83 ef 04             	sub    $0x4,%edi
+  802410:	8d 72 fc             	lea    -0x4(%edx),%esi
+  802413:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  802416:	fd                   	std
+  802417:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802419:	eb 09                	jmp    802424 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80241b:	83 ef 01             	sub    $0x1,%edi
+  80241e:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  802421:	fd                   	std
+  802422:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  802424:	fc                   	cld
+  802425:	eb 1a                	jmp    802441 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802427:	89 f2                	mov    %esi,%edx
+  802429:	09 c2                	or     %eax,%edx
+  80242b:	09 ca                	or     %ecx,%edx
+  80242d:	f6 c2 03             	test   $0x3,%dl
+  802430:	75 0a                	jne    80243c <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  802432:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  802435:	89 c7                	mov    %eax,%edi
+  802437:	fc                   	cld
+  802438:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80243a:	eb 05                	jmp    802441 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80243c:	89 c7                	mov    %eax,%edi
+  80243e:	fc                   	cld
+  80243f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  802441:	5e                   	pop    %esi
+  802442:	5f                   	pop    %edi
+  802443:	5d                   	pop    %ebp
+  802444:	c3                   	ret
+
+00802445 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  802445:	55                   	push   %ebp
+  802446:	89 e5                	mov    %esp,%ebp
+  802448:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80244b:	ff 75 10             	push   0x10(%ebp)
+  80244e:	ff 75 0c             	push   0xc(%ebp)
+  802451:	ff 75 08             	push   0x8(%ebp)
+  802454:	e8 8a ff ff ff       	call   8023e3 <memmove>
+}
+  802459:	c9                   	leave
+  80245a:	c3                   	ret
+
+0080245b <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80245b:	55                   	push   %ebp
+  80245c:	89 e5                	mov    %esp,%ebp
+  80245e:	56                   	push   %esi
+  80245f:	53                   	push   %ebx
+  802460:	8b 45 08             	mov    0x8(%ebp),%eax
+  802463:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  802466:	89 c6                	mov    %eax,%esi
+  802468:	03 75 10             	add    0x10(%ebp),%esi
+  80246b:	eb 06                	jmp    802473 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  80246d:	83 c0 01             	add    $0x1,%eax
+  802470:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  802473:	39 f0                	cmp    %esi,%eax
+  802475:	74 14                	je     80248b <memcmp+0x30>
+		if (*s1 != *s2)
+  802477:	0f b6 08             	movzbl (%eax),%ecx
+  80247a:	0f b6 1a             	movzbl (%edx),%ebx
+  80247d:	38 d9                	cmp    %bl,%cl
+  80247f:	74 ec                	je     80246d <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  802481:	0f b6 c1             	movzbl %cl,%eax
+  802484:	0f b6 db             	movzbl %bl,%ebx
+  802487:	29 d8                	sub    %ebx,%eax
+  802489:	eb 05                	jmp    802490 <memcmp+0x35>
+	}
+
+	return 0;
+  80248b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802490:	5b                   	pop    %ebx
+  802491:	5e                   	pop    %esi
+  802492:	5d                   	pop    %ebp
+  802493:	c3                   	ret
+
+00802494 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802494:	55                   	push   %ebp
+  802495:	89 e5                	mov    %esp,%ebp
+  802497:	8b 45 08             	mov    0x8(%ebp),%eax
+  80249a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80249d:	89 c2                	mov    %eax,%edx
+  80249f:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8024a2:	eb 03                	jmp    8024a7 <memfind+0x13>
+  8024a4:	83 c0 01             	add    $0x1,%eax
+  8024a7:	39 d0                	cmp    %edx,%eax
+  8024a9:	73 04                	jae    8024af <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8024ab:	38 08                	cmp    %cl,(%eax)
+  8024ad:	75 f5                	jne    8024a4 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8024af:	5d                   	pop    %ebp
+  8024b0:	c3                   	ret
+
+008024b1 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8024b1:	55                   	push   %ebp
+  8024b2:	89 e5                	mov    %esp,%ebp
+  8024b4:	57                   	push   %edi
+  8024b5:	56                   	push   %esi
+  8024b6:	53                   	push   %ebx
+  8024b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024ba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8024bd:	eb 03                	jmp    8024c2 <strtol+0x11>
+		s++;
+  8024bf:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8024c2:	0f b6 02             	movzbl (%edx),%eax
+  8024c5:	3c 20                	cmp    $0x20,%al
+  8024c7:	74 f6                	je     8024bf <strtol+0xe>
+  8024c9:	3c 09                	cmp    $0x9,%al
+  8024cb:	74 f2                	je     8024bf <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8024cd:	3c 2b                	cmp    $0x2b,%al
+  8024cf:	74 2a                	je     8024fb <strtol+0x4a>
+	int neg = 0;
+  8024d1:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8024d6:	3c 2d                	cmp    $0x2d,%al
+  8024d8:	74 2b                	je     802505 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8024da:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8024e0:	75 0f                	jne    8024f1 <strtol+0x40>
+  8024e2:	80 3a 30             	cmpb   $0x30,(%edx)
+  8024e5:	74 28                	je     80250f <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8024e7:	85 db                	test   %ebx,%ebx
+  8024e9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8024ee:	0f 44 d8             	cmove  %eax,%ebx
+  8024f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024f6:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8024f9:	eb 46                	jmp    802541 <strtol+0x90>
+		s++;
+  8024fb:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8024fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  802503:	eb d5                	jmp    8024da <strtol+0x29>
+		s++, neg = 1;
+  802505:	83 c2 01             	add    $0x1,%edx
+  802508:	bf 01 00 00 00       	mov    $0x1,%edi
+  80250d:	eb cb                	jmp    8024da <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80250f:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802513:	74 0e                	je     802523 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  802515:	85 db                	test   %ebx,%ebx
+  802517:	75 d8                	jne    8024f1 <strtol+0x40>
+		s++, base = 8;
+  802519:	83 c2 01             	add    $0x1,%edx
+  80251c:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802521:	eb ce                	jmp    8024f1 <strtol+0x40>
+		s += 2, base = 16;
+  802523:	83 c2 02             	add    $0x2,%edx
+  802526:	bb 10 00 00 00       	mov    $0x10,%ebx
+  80252b:	eb c4                	jmp    8024f1 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  80252d:	0f be c0             	movsbl %al,%eax
+  802530:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  802533:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802536:	7d 3a                	jge    802572 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  802538:	83 c2 01             	add    $0x1,%edx
+  80253b:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  80253f:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  802541:	0f b6 02             	movzbl (%edx),%eax
+  802544:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802547:	89 f3                	mov    %esi,%ebx
+  802549:	80 fb 09             	cmp    $0x9,%bl
+  80254c:	76 df                	jbe    80252d <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  80254e:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802551:	89 f3                	mov    %esi,%ebx
+  802553:	80 fb 19             	cmp    $0x19,%bl
+  802556:	77 08                	ja     802560 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  802558:	0f be c0             	movsbl %al,%eax
+  80255b:	83 e8 57             	sub    $0x57,%eax
+  80255e:	eb d3                	jmp    802533 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  802560:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802563:	89 f3                	mov    %esi,%ebx
+  802565:	80 fb 19             	cmp    $0x19,%bl
+  802568:	77 08                	ja     802572 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  80256a:	0f be c0             	movsbl %al,%eax
+  80256d:	83 e8 37             	sub    $0x37,%eax
+  802570:	eb c1                	jmp    802533 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  802572:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802576:	74 05                	je     80257d <strtol+0xcc>
+		*endptr = (char *) s;
+  802578:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80257b:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  80257d:	89 c8                	mov    %ecx,%eax
+  80257f:	f7 d8                	neg    %eax
+  802581:	85 ff                	test   %edi,%edi
+  802583:	0f 45 c8             	cmovne %eax,%ecx
+}
+  802586:	89 c8                	mov    %ecx,%eax
+  802588:	5b                   	pop    %ebx
+  802589:	5e                   	pop    %esi
+  80258a:	5f                   	pop    %edi
+  80258b:	5d                   	pop    %ebp
+  80258c:	c3                   	ret
+
+0080258d <atoi>:
+
+int
+atoi(const char *s)
+{
+  80258d:	55                   	push   %ebp
+  80258e:	89 e5                	mov    %esp,%ebp
+  802590:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  802593:	6a 0a                	push   $0xa
+  802595:	6a 00                	push   $0x0
+  802597:	ff 75 08             	push   0x8(%ebp)
+  80259a:	e8 12 ff ff ff       	call   8024b1 <strtol>
+}
+  80259f:	c9                   	leave
+  8025a0:	c3                   	ret
+
+008025a1 <dm>:
+  8025a1:	55                   	push   %ebp
+  8025a2:	57                   	push   %edi
+  8025a3:	56                   	push   %esi
+  8025a4:	53                   	push   %ebx
+  8025a5:	83 ec 24             	sub    $0x24,%esp
+  8025a8:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8025ac:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8025b0:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8025b4:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8025b8:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8025bc:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8025c0:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8025c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025ce:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025d3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8025da:	00 
+  8025db:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8025e2:	00 
+  8025e3:	89 fb                	mov    %edi,%ebx
+  8025e5:	eb 08                	jmp    8025ef <dm+0x4e>
+  8025e7:	83 e9 01             	sub    $0x1,%ecx
+  8025ea:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8025ed:	74 68                	je     802657 <dm+0xb6>
+  8025ef:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8025f3:	01 c0                	add    %eax,%eax
+  8025f5:	89 c6                	mov    %eax,%esi
+  8025f7:	89 d7                	mov    %edx,%edi
+  8025f9:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8025fd:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802601:	0f ad d0             	shrd   %cl,%edx,%eax
+  802604:	d3 ea                	shr    %cl,%edx
+  802606:	f6 c1 20             	test   $0x20,%cl
+  802609:	74 04                	je     80260f <dm+0x6e>
+  80260b:	89 d0                	mov    %edx,%eax
+  80260d:	31 d2                	xor    %edx,%edx
+  80260f:	83 e0 01             	and    $0x1,%eax
+  802612:	89 04 24             	mov    %eax,(%esp)
+  802615:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80261c:	00 
+  80261d:	8b 04 24             	mov    (%esp),%eax
+  802620:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802624:	09 f0                	or     %esi,%eax
+  802626:	09 fa                	or     %edi,%edx
+  802628:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80262c:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802630:	39 f0                	cmp    %esi,%eax
+  802632:	89 d5                	mov    %edx,%ebp
+  802634:	19 fd                	sbb    %edi,%ebp
+  802636:	72 af                	jb     8025e7 <dm+0x46>
+  802638:	29 f0                	sub    %esi,%eax
+  80263a:	19 fa                	sbb    %edi,%edx
+  80263c:	89 cf                	mov    %ecx,%edi
+  80263e:	c1 ef 05             	shr    $0x5,%edi
+  802641:	83 e7 01             	and    $0x1,%edi
+  802644:	89 fe                	mov    %edi,%esi
+  802646:	83 f6 01             	xor    $0x1,%esi
+  802649:	d3 e6                	shl    %cl,%esi
+  80264b:	d3 e7                	shl    %cl,%edi
+  80264d:	09 74 24 18          	or     %esi,0x18(%esp)
+  802651:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802655:	eb 90                	jmp    8025e7 <dm+0x46>
+  802657:	85 db                	test   %ebx,%ebx
+  802659:	74 05                	je     802660 <dm+0xbf>
+  80265b:	89 03                	mov    %eax,(%ebx)
+  80265d:	89 53 04             	mov    %edx,0x4(%ebx)
+  802660:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802664:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802668:	83 c4 24             	add    $0x24,%esp
+  80266b:	5b                   	pop    %ebx
+  80266c:	5e                   	pop    %esi
+  80266d:	5f                   	pop    %edi
+  80266e:	5d                   	pop    %ebp
+  80266f:	c3                   	ret
+
+00802670 <__udivdi3>:
+  802670:	83 ec 08             	sub    $0x8,%esp
+  802673:	6a 00                	push   $0x0
+  802675:	ff 74 24 1c          	push   0x1c(%esp)
+  802679:	ff 74 24 1c          	push   0x1c(%esp)
+  80267d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802681:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802685:	e8 17 ff ff ff       	call   8025a1 <dm>
+  80268a:	83 c4 14             	add    $0x14,%esp
+  80268d:	c3                   	ret
+
+0080268e <__umoddi3>:
+  80268e:	83 ec 18             	sub    $0x18,%esp
+  802691:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802695:	50                   	push   %eax
+  802696:	ff 74 24 2c          	push   0x2c(%esp)
+  80269a:	ff 74 24 2c          	push   0x2c(%esp)
+  80269e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8026a2:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8026a6:	e8 f6 fe ff ff       	call   8025a1 <dm>
+  8026ab:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8026af:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8026b3:	83 c4 24             	add    $0x24,%esp
+  8026b6:	c3                   	ret
+
+008026b7 <__divdi3>:
+  8026b7:	53                   	push   %ebx
+  8026b8:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8026bc:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026c0:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8026c4:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8026c8:	85 d2                	test   %edx,%edx
+  8026ca:	78 15                	js     8026e1 <__divdi3+0x2a>
+  8026cc:	85 db                	test   %ebx,%ebx
+  8026ce:	78 34                	js     802704 <__divdi3+0x4d>
+  8026d0:	83 ec 04             	sub    $0x4,%esp
+  8026d3:	6a 00                	push   $0x0
+  8026d5:	53                   	push   %ebx
+  8026d6:	51                   	push   %ecx
+  8026d7:	e8 c5 fe ff ff       	call   8025a1 <dm>
+  8026dc:	83 c4 10             	add    $0x10,%esp
+  8026df:	eb 21                	jmp    802702 <__divdi3+0x4b>
+  8026e1:	f7 d8                	neg    %eax
+  8026e3:	83 d2 00             	adc    $0x0,%edx
+  8026e6:	f7 da                	neg    %edx
+  8026e8:	85 db                	test   %ebx,%ebx
+  8026ea:	78 30                	js     80271c <__divdi3+0x65>
+  8026ec:	83 ec 04             	sub    $0x4,%esp
+  8026ef:	6a 00                	push   $0x0
+  8026f1:	53                   	push   %ebx
+  8026f2:	51                   	push   %ecx
+  8026f3:	e8 a9 fe ff ff       	call   8025a1 <dm>
+  8026f8:	83 c4 10             	add    $0x10,%esp
+  8026fb:	f7 d8                	neg    %eax
+  8026fd:	83 d2 00             	adc    $0x0,%edx
+  802700:	f7 da                	neg    %edx
+  802702:	5b                   	pop    %ebx
+  802703:	c3                   	ret
+  802704:	83 ec 04             	sub    $0x4,%esp
+  802707:	6a 00                	push   $0x0
+  802709:	f7 d9                	neg    %ecx
+  80270b:	83 d3 00             	adc    $0x0,%ebx
+  80270e:	f7 db                	neg    %ebx
+  802710:	53                   	push   %ebx
+  802711:	51                   	push   %ecx
+  802712:	e8 8a fe ff ff       	call   8025a1 <dm>
+  802717:	83 c4 10             	add    $0x10,%esp
+  80271a:	eb df                	jmp    8026fb <__divdi3+0x44>
+  80271c:	83 ec 04             	sub    $0x4,%esp
+  80271f:	6a 00                	push   $0x0
+  802721:	f7 d9                	neg    %ecx
+  802723:	83 d3 00             	adc    $0x0,%ebx
+  802726:	f7 db                	neg    %ebx
+  802728:	53                   	push   %ebx
+  802729:	51                   	push   %ecx
+  80272a:	e8 72 fe ff ff       	call   8025a1 <dm>
+  80272f:	83 c4 10             	add    $0x10,%esp
+  802732:	eb ce                	jmp    802702 <__divdi3+0x4b>
+
+00802734 <__moddi3>:
+  802734:	55                   	push   %ebp
+  802735:	57                   	push   %edi
+  802736:	56                   	push   %esi
+  802737:	53                   	push   %ebx
+  802738:	83 ec 18             	sub    $0x18,%esp
+  80273b:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  80273f:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802743:	89 f1                	mov    %esi,%ecx
+  802745:	f7 d9                	neg    %ecx
+  802747:	89 da                	mov    %ebx,%edx
+  802749:	83 d2 00             	adc    $0x0,%edx
+  80274c:	f7 da                	neg    %edx
+  80274e:	0f 48 ce             	cmovs  %esi,%ecx
+  802751:	0f 48 d3             	cmovs  %ebx,%edx
+  802754:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802758:	50                   	push   %eax
+  802759:	8b 74 24 38          	mov    0x38(%esp),%esi
+  80275d:	f7 de                	neg    %esi
+  80275f:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802763:	83 d0 00             	adc    $0x0,%eax
+  802766:	f7 d8                	neg    %eax
+  802768:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  80276d:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802772:	50                   	push   %eax
+  802773:	56                   	push   %esi
+  802774:	89 c8                	mov    %ecx,%eax
+  802776:	e8 26 fe ff ff       	call   8025a1 <dm>
+  80277b:	83 c4 10             	add    $0x10,%esp
+  80277e:	85 db                	test   %ebx,%ebx
+  802780:	78 10                	js     802792 <__moddi3+0x5e>
+  802782:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802786:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80278a:	83 c4 14             	add    $0x14,%esp
+  80278d:	5b                   	pop    %ebx
+  80278e:	5e                   	pop    %esi
+  80278f:	5f                   	pop    %edi
+  802790:	5d                   	pop    %ebp
+  802791:	c3                   	ret
+  802792:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802796:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80279a:	f7 d8                	neg    %eax
+  80279c:	83 d2 00             	adc    $0x0,%edx
+  80279f:	f7 da                	neg    %edx
+  8027a1:	eb e7                	jmp    80278a <__moddi3+0x56>
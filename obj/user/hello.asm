@@ -0,0 +1,5146 @@
+
+obj/user/hello:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 2d 00 00 00       	call   80005e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+// hello, world
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 14             	sub    $0x14,%esp
+	cprintf("hello, world\n");
+  800039:	68 80 28 80 00       	push   $0x802880
+  80003e:	e8 0b 01 00 00       	call   80014e <cprintf>
+	cprintf("i am environment %08x\n", thisenv->env_id);
+  800043:	a1 08 30 80 00       	mov    0x803008,%eax
+  800048:	8b 40 48             	mov    0x48(%eax),%eax
+  80004b:	83 c4 08             	add    $0x8,%esp
+  80004e:	50                   	push   %eax
+  80004f:	68 8e 28 80 00       	push   $0x80288e
+  800054:	e8 f5 00 00 00       	call   80014e <cprintf>
+}
+  800059:	83 c4 10             	add    $0x10,%esp
+  80005c:	c9                   	leave
+  80005d:	c3                   	ret
+
+0080005e <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80005e:	55                   	push   %ebp
+  80005f:	89 e5                	mov    %esp,%ebp
+  800061:	56                   	push   %esi
+  800062:	53                   	push   %ebx
+  800063:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800066:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  800069:	e8 64 0e 00 00       	call   800ed2 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  80006e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800073:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  800079:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80007e:	a3 08 30 80 00       	mov    %eax,0x803008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800083:	85 db                	test   %ebx,%ebx
+  800085:	7e 07                	jle    80008e <libmain+0x30>
+		binaryname = argv[0];
+  800087:	8b 06                	mov    (%esi),%eax
+  800089:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  80008e:	83 ec 08             	sub    $0x8,%esp
+  800091:	56                   	push   %esi
+  800092:	53                   	push   %ebx
+  800093:	e8 9b ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800098:	e8 0a 00 00 00       	call   8000a7 <exit>
+}
+  80009d:	83 c4 10             	add    $0x10,%esp
+  8000a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000a3:	5b                   	pop    %ebx
+  8000a4:	5e                   	pop    %esi
+  8000a5:	5d                   	pop    %ebp
+  8000a6:	c3                   	ret
+
+008000a7 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000a7:	55                   	push   %ebp
+  8000a8:	89 e5                	mov    %esp,%ebp
+  8000aa:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  8000ad:	6a 00                	push   $0x0
+  8000af:	e8 5c 0d 00 00       	call   800e10 <sys_env_destroy>
+}
+  8000b4:	83 c4 10             	add    $0x10,%esp
+  8000b7:	c9                   	leave
+  8000b8:	c3                   	ret
+
+008000b9 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000b9:	55                   	push   %ebp
+  8000ba:	89 e5                	mov    %esp,%ebp
+  8000bc:	53                   	push   %ebx
+  8000bd:	83 ec 04             	sub    $0x4,%esp
+  8000c0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8000c3:	8b 13                	mov    (%ebx),%edx
+  8000c5:	8d 42 01             	lea    0x1(%edx),%eax
+  8000c8:	89 03                	mov    %eax,(%ebx)
+  8000ca:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000cd:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8000d1:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8000d6:	74 09                	je     8000e1 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8000d8:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8000dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000df:	c9                   	leave
+  8000e0:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8000e1:	83 ec 08             	sub    $0x8,%esp
+  8000e4:	68 ff 00 00 00       	push   $0xff
+  8000e9:	8d 43 08             	lea    0x8(%ebx),%eax
+  8000ec:	50                   	push   %eax
+  8000ed:	e8 e2 0b 00 00       	call   800cd4 <sys_cputs>
+		b->idx = 0;
+  8000f2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8000f8:	83 c4 10             	add    $0x10,%esp
+  8000fb:	eb db                	jmp    8000d8 <putch+0x1f>
+
+008000fd <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8000fd:	55                   	push   %ebp
+  8000fe:	89 e5                	mov    %esp,%ebp
+  800100:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800106:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80010d:	00 00 00 
+	b.cnt = 0;
+  800110:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800117:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80011a:	ff 75 0c             	push   0xc(%ebp)
+  80011d:	ff 75 08             	push   0x8(%ebp)
+  800120:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800126:	50                   	push   %eax
+  800127:	68 b9 00 80 00       	push   $0x8000b9
+  80012c:	e8 14 01 00 00       	call   800245 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800131:	83 c4 08             	add    $0x8,%esp
+  800134:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80013a:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800140:	50                   	push   %eax
+  800141:	e8 8e 0b 00 00       	call   800cd4 <sys_cputs>
+
+	return b.cnt;
+}
+  800146:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80014c:	c9                   	leave
+  80014d:	c3                   	ret
+
+0080014e <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80014e:	55                   	push   %ebp
+  80014f:	89 e5                	mov    %esp,%ebp
+  800151:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800154:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800157:	50                   	push   %eax
+  800158:	ff 75 08             	push   0x8(%ebp)
+  80015b:	e8 9d ff ff ff       	call   8000fd <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800160:	c9                   	leave
+  800161:	c3                   	ret
+
+00800162 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800162:	55                   	push   %ebp
+  800163:	89 e5                	mov    %esp,%ebp
+  800165:	57                   	push   %edi
+  800166:	56                   	push   %esi
+  800167:	53                   	push   %ebx
+  800168:	83 ec 1c             	sub    $0x1c,%esp
+  80016b:	89 c7                	mov    %eax,%edi
+  80016d:	89 d6                	mov    %edx,%esi
+  80016f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800172:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800175:	89 d1                	mov    %edx,%ecx
+  800177:	89 c2                	mov    %eax,%edx
+  800179:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80017c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80017f:	8b 45 10             	mov    0x10(%ebp),%eax
+  800182:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800185:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800188:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80018f:	39 c2                	cmp    %eax,%edx
+  800191:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800194:	72 3e                	jb     8001d4 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800196:	83 ec 0c             	sub    $0xc,%esp
+  800199:	ff 75 18             	push   0x18(%ebp)
+  80019c:	83 eb 01             	sub    $0x1,%ebx
+  80019f:	53                   	push   %ebx
+  8001a0:	50                   	push   %eax
+  8001a1:	83 ec 08             	sub    $0x8,%esp
+  8001a4:	ff 75 e4             	push   -0x1c(%ebp)
+  8001a7:	ff 75 e0             	push   -0x20(%ebp)
+  8001aa:	ff 75 dc             	push   -0x24(%ebp)
+  8001ad:	ff 75 d8             	push   -0x28(%ebp)
+  8001b0:	e8 89 25 00 00       	call   80273e <__udivdi3>
+  8001b5:	83 c4 18             	add    $0x18,%esp
+  8001b8:	52                   	push   %edx
+  8001b9:	50                   	push   %eax
+  8001ba:	89 f2                	mov    %esi,%edx
+  8001bc:	89 f8                	mov    %edi,%eax
+  8001be:	e8 9f ff ff ff       	call   800162 <printnum>
+  8001c3:	83 c4 20             	add    $0x20,%esp
+  8001c6:	eb 13                	jmp    8001db <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8001c8:	83 ec 08             	sub    $0x8,%esp
+  8001cb:	56                   	push   %esi
+  8001cc:	ff 75 18             	push   0x18(%ebp)
+  8001cf:	ff d7                	call   *%edi
+  8001d1:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8001d4:	83 eb 01             	sub    $0x1,%ebx
+  8001d7:	85 db                	test   %ebx,%ebx
+  8001d9:	7f ed                	jg     8001c8 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8001db:	83 ec 08             	sub    $0x8,%esp
+  8001de:	56                   	push   %esi
+  8001df:	83 ec 04             	sub    $0x4,%esp
+  8001e2:	ff 75 e4             	push   -0x1c(%ebp)
+  8001e5:	ff 75 e0             	push   -0x20(%ebp)
+  8001e8:	ff 75 dc             	push   -0x24(%ebp)
+  8001eb:	ff 75 d8             	push   -0x28(%ebp)
+  8001ee:	e8 69 25 00 00       	call   80275c <__umoddi3>
+  8001f3:	83 c4 14             	add    $0x14,%esp
+  8001f6:	0f be 80 af 28 80 00 	movsbl 0x8028af(%eax),%eax
+  8001fd:	50                   	push   %eax
+  8001fe:	ff d7                	call   *%edi
+}
+  800200:	83 c4 10             	add    $0x10,%esp
+  800203:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800206:	5b                   	pop    %ebx
+  800207:	5e                   	pop    %esi
+  800208:	5f                   	pop    %edi
+  800209:	5d                   	pop    %ebp
+  80020a:	c3                   	ret
+
+0080020b <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80020b:	55                   	push   %ebp
+  80020c:	89 e5                	mov    %esp,%ebp
+  80020e:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800211:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800215:	8b 10                	mov    (%eax),%edx
+  800217:	3b 50 04             	cmp    0x4(%eax),%edx
+  80021a:	73 0a                	jae    800226 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80021c:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80021f:	89 08                	mov    %ecx,(%eax)
+  800221:	8b 45 08             	mov    0x8(%ebp),%eax
+  800224:	88 02                	mov    %al,(%edx)
+}
+  800226:	5d                   	pop    %ebp
+  800227:	c3                   	ret
+
+00800228 <printfmt>:
+{
+  800228:	55                   	push   %ebp
+  800229:	89 e5                	mov    %esp,%ebp
+  80022b:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80022e:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800231:	50                   	push   %eax
+  800232:	ff 75 10             	push   0x10(%ebp)
+  800235:	ff 75 0c             	push   0xc(%ebp)
+  800238:	ff 75 08             	push   0x8(%ebp)
+  80023b:	e8 05 00 00 00       	call   800245 <vprintfmt>
+}
+  800240:	83 c4 10             	add    $0x10,%esp
+  800243:	c9                   	leave
+  800244:	c3                   	ret
+
+00800245 <vprintfmt>:
+{
+  800245:	55                   	push   %ebp
+  800246:	89 e5                	mov    %esp,%ebp
+  800248:	57                   	push   %edi
+  800249:	56                   	push   %esi
+  80024a:	53                   	push   %ebx
+  80024b:	83 ec 2c             	sub    $0x2c,%esp
+  80024e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800251:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800254:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800257:	eb 0a                	jmp    800263 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800259:	83 ec 08             	sub    $0x8,%esp
+  80025c:	53                   	push   %ebx
+  80025d:	50                   	push   %eax
+  80025e:	ff d6                	call   *%esi
+  800260:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800263:	83 c7 01             	add    $0x1,%edi
+  800266:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80026a:	83 f8 25             	cmp    $0x25,%eax
+  80026d:	74 0c                	je     80027b <vprintfmt+0x36>
+			if (ch == '\0')
+  80026f:	85 c0                	test   %eax,%eax
+  800271:	75 e6                	jne    800259 <vprintfmt+0x14>
+}
+  800273:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800276:	5b                   	pop    %ebx
+  800277:	5e                   	pop    %esi
+  800278:	5f                   	pop    %edi
+  800279:	5d                   	pop    %ebp
+  80027a:	c3                   	ret
+		padc = ' ';
+  80027b:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80027f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800286:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80028d:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800294:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800299:	8d 47 01             	lea    0x1(%edi),%eax
+  80029c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80029f:	0f b6 17             	movzbl (%edi),%edx
+  8002a2:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002a5:	3c 55                	cmp    $0x55,%al
+  8002a7:	0f 87 cf 03 00 00    	ja     80067c <vprintfmt+0x437>
+  8002ad:	0f b6 c0             	movzbl %al,%eax
+  8002b0:	ff 24 85 a0 29 80 00 	jmp    *0x8029a0(,%eax,4)
+  8002b7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8002ba:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002be:	eb d9                	jmp    800299 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8002c0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002c3:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8002c7:	eb d0                	jmp    800299 <vprintfmt+0x54>
+  8002c9:	0f b6 d2             	movzbl %dl,%edx
+  8002cc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8002cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d4:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8002d7:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8002da:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8002de:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8002e1:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8002e4:	83 f9 09             	cmp    $0x9,%ecx
+  8002e7:	77 55                	ja     80033e <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8002e9:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8002ec:	eb e9                	jmp    8002d7 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8002ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002f1:	8b 00                	mov    (%eax),%eax
+  8002f3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8002f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002f9:	8d 40 04             	lea    0x4(%eax),%eax
+  8002fc:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8002ff:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800302:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800306:	79 91                	jns    800299 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800308:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80030b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80030e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800315:	eb 82                	jmp    800299 <vprintfmt+0x54>
+			if (width < 0)
+  800317:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80031a:	85 d2                	test   %edx,%edx
+  80031c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800321:	0f 49 c2             	cmovns %edx,%eax
+  800324:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800327:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80032a:	e9 6a ff ff ff       	jmp    800299 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80032f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800332:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800339:	e9 5b ff ff ff       	jmp    800299 <vprintfmt+0x54>
+  80033e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800341:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800344:	eb bc                	jmp    800302 <vprintfmt+0xbd>
+			lflag++;
+  800346:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800349:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80034c:	e9 48 ff ff ff       	jmp    800299 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800351:	8b 45 14             	mov    0x14(%ebp),%eax
+  800354:	8d 78 04             	lea    0x4(%eax),%edi
+  800357:	83 ec 08             	sub    $0x8,%esp
+  80035a:	53                   	push   %ebx
+  80035b:	ff 30                	push   (%eax)
+  80035d:	ff d6                	call   *%esi
+			break;
+  80035f:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800362:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800365:	e9 b1 02 00 00       	jmp    80061b <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  80036a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80036d:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800370:	8b 10                	mov    (%eax),%edx
+  800372:	89 d0                	mov    %edx,%eax
+  800374:	f7 d8                	neg    %eax
+  800376:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800379:	83 f8 0d             	cmp    $0xd,%eax
+  80037c:	7f 23                	jg     8003a1 <vprintfmt+0x15c>
+  80037e:	8b 14 85 00 2b 80 00 	mov    0x802b00(,%eax,4),%edx
+  800385:	85 d2                	test   %edx,%edx
+  800387:	74 18                	je     8003a1 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800389:	52                   	push   %edx
+  80038a:	68 d0 28 80 00       	push   $0x8028d0
+  80038f:	53                   	push   %ebx
+  800390:	56                   	push   %esi
+  800391:	e8 92 fe ff ff       	call   800228 <printfmt>
+  800396:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800399:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80039c:	e9 7a 02 00 00       	jmp    80061b <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8003a1:	50                   	push   %eax
+  8003a2:	68 c7 28 80 00       	push   $0x8028c7
+  8003a7:	53                   	push   %ebx
+  8003a8:	56                   	push   %esi
+  8003a9:	e8 7a fe ff ff       	call   800228 <printfmt>
+  8003ae:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003b1:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003b4:	e9 62 02 00 00       	jmp    80061b <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003bc:	83 c0 04             	add    $0x4,%eax
+  8003bf:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c5:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8003c7:	85 c9                	test   %ecx,%ecx
+  8003c9:	b8 c0 28 80 00       	mov    $0x8028c0,%eax
+  8003ce:	0f 45 c1             	cmovne %ecx,%eax
+  8003d1:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8003d4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003d8:	7e 06                	jle    8003e0 <vprintfmt+0x19b>
+  8003da:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8003de:	75 0b                	jne    8003eb <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8003e0:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8003e3:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8003e6:	89 75 08             	mov    %esi,0x8(%ebp)
+  8003e9:	eb 5c                	jmp    800447 <vprintfmt+0x202>
+  8003eb:	83 ec 08             	sub    $0x8,%esp
+  8003ee:	ff 75 d0             	push   -0x30(%ebp)
+  8003f1:	ff 75 cc             	push   -0x34(%ebp)
+  8003f4:	e8 20 03 00 00       	call   800719 <strnlen>
+  8003f9:	89 c2                	mov    %eax,%edx
+  8003fb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8003fe:	29 d0                	sub    %edx,%eax
+  800400:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800403:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800407:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80040a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80040d:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80040f:	eb 0e                	jmp    80041f <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800411:	83 ec 08             	sub    $0x8,%esp
+  800414:	53                   	push   %ebx
+  800415:	57                   	push   %edi
+  800416:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800419:	83 ee 01             	sub    $0x1,%esi
+  80041c:	83 c4 10             	add    $0x10,%esp
+  80041f:	85 f6                	test   %esi,%esi
+  800421:	7f ee                	jg     800411 <vprintfmt+0x1cc>
+  800423:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800426:	8b 75 08             	mov    0x8(%ebp),%esi
+  800429:	85 c0                	test   %eax,%eax
+  80042b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800430:	0f 49 d0             	cmovns %eax,%edx
+  800433:	29 d0                	sub    %edx,%eax
+  800435:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800438:	eb a6                	jmp    8003e0 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80043a:	83 ec 08             	sub    $0x8,%esp
+  80043d:	53                   	push   %ebx
+  80043e:	52                   	push   %edx
+  80043f:	ff 55 08             	call   *0x8(%ebp)
+  800442:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800445:	89 f1                	mov    %esi,%ecx
+  800447:	8d 71 01             	lea    0x1(%ecx),%esi
+  80044a:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80044e:	0f be d0             	movsbl %al,%edx
+  800451:	85 d2                	test   %edx,%edx
+  800453:	74 28                	je     80047d <vprintfmt+0x238>
+  800455:	85 ff                	test   %edi,%edi
+  800457:	78 05                	js     80045e <vprintfmt+0x219>
+  800459:	83 ef 01             	sub    $0x1,%edi
+  80045c:	78 30                	js     80048e <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80045e:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800462:	74 d6                	je     80043a <vprintfmt+0x1f5>
+  800464:	0f be c0             	movsbl %al,%eax
+  800467:	83 e8 20             	sub    $0x20,%eax
+  80046a:	83 f8 5e             	cmp    $0x5e,%eax
+  80046d:	76 cb                	jbe    80043a <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80046f:	83 ec 08             	sub    $0x8,%esp
+  800472:	53                   	push   %ebx
+  800473:	6a 3f                	push   $0x3f
+  800475:	ff 55 08             	call   *0x8(%ebp)
+  800478:	83 c4 10             	add    $0x10,%esp
+  80047b:	eb c8                	jmp    800445 <vprintfmt+0x200>
+  80047d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800480:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800483:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800486:	01 d0                	add    %edx,%eax
+  800488:	29 c8                	sub    %ecx,%eax
+  80048a:	89 c7                	mov    %eax,%edi
+  80048c:	eb 13                	jmp    8004a1 <vprintfmt+0x25c>
+  80048e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800491:	eb ed                	jmp    800480 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800493:	83 ec 08             	sub    $0x8,%esp
+  800496:	53                   	push   %ebx
+  800497:	6a 20                	push   $0x20
+  800499:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80049b:	83 ef 01             	sub    $0x1,%edi
+  80049e:	83 c4 10             	add    $0x10,%esp
+  8004a1:	85 ff                	test   %edi,%edi
+  8004a3:	7f ee                	jg     800493 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004a5:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004a8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004ab:	e9 6b 01 00 00       	jmp    80061b <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8004b0:	83 f9 01             	cmp    $0x1,%ecx
+  8004b3:	7f 1f                	jg     8004d4 <vprintfmt+0x28f>
+	else if (lflag)
+  8004b5:	85 c9                	test   %ecx,%ecx
+  8004b7:	74 67                	je     800520 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8004b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004bc:	8b 00                	mov    (%eax),%eax
+  8004be:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004c1:	89 c1                	mov    %eax,%ecx
+  8004c3:	c1 f9 1f             	sar    $0x1f,%ecx
+  8004c6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004cc:	8d 40 04             	lea    0x4(%eax),%eax
+  8004cf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004d2:	eb 17                	jmp    8004eb <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8004d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d7:	8b 50 04             	mov    0x4(%eax),%edx
+  8004da:	8b 00                	mov    (%eax),%eax
+  8004dc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004df:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8004e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e5:	8d 40 08             	lea    0x8(%eax),%eax
+  8004e8:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8004eb:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8004ee:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8004f1:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8004f6:	85 c9                	test   %ecx,%ecx
+  8004f8:	0f 89 03 01 00 00    	jns    800601 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8004fe:	83 ec 08             	sub    $0x8,%esp
+  800501:	53                   	push   %ebx
+  800502:	6a 2d                	push   $0x2d
+  800504:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800506:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800509:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80050c:	f7 da                	neg    %edx
+  80050e:	83 d1 00             	adc    $0x0,%ecx
+  800511:	f7 d9                	neg    %ecx
+  800513:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800516:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80051b:	e9 e1 00 00 00       	jmp    800601 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800520:	8b 45 14             	mov    0x14(%ebp),%eax
+  800523:	8b 00                	mov    (%eax),%eax
+  800525:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800528:	89 c1                	mov    %eax,%ecx
+  80052a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80052d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800530:	8b 45 14             	mov    0x14(%ebp),%eax
+  800533:	8d 40 04             	lea    0x4(%eax),%eax
+  800536:	89 45 14             	mov    %eax,0x14(%ebp)
+  800539:	eb b0                	jmp    8004eb <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80053b:	83 f9 01             	cmp    $0x1,%ecx
+  80053e:	7f 1e                	jg     80055e <vprintfmt+0x319>
+	else if (lflag)
+  800540:	85 c9                	test   %ecx,%ecx
+  800542:	74 32                	je     800576 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800544:	8b 45 14             	mov    0x14(%ebp),%eax
+  800547:	8b 10                	mov    (%eax),%edx
+  800549:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80054e:	8d 40 04             	lea    0x4(%eax),%eax
+  800551:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800554:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800559:	e9 a3 00 00 00       	jmp    800601 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80055e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800561:	8b 10                	mov    (%eax),%edx
+  800563:	8b 48 04             	mov    0x4(%eax),%ecx
+  800566:	8d 40 08             	lea    0x8(%eax),%eax
+  800569:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80056c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800571:	e9 8b 00 00 00       	jmp    800601 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800576:	8b 45 14             	mov    0x14(%ebp),%eax
+  800579:	8b 10                	mov    (%eax),%edx
+  80057b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800580:	8d 40 04             	lea    0x4(%eax),%eax
+  800583:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800586:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80058b:	eb 74                	jmp    800601 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  80058d:	83 f9 01             	cmp    $0x1,%ecx
+  800590:	7f 1b                	jg     8005ad <vprintfmt+0x368>
+	else if (lflag)
+  800592:	85 c9                	test   %ecx,%ecx
+  800594:	74 2c                	je     8005c2 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800596:	8b 45 14             	mov    0x14(%ebp),%eax
+  800599:	8b 10                	mov    (%eax),%edx
+  80059b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005a0:	8d 40 04             	lea    0x4(%eax),%eax
+  8005a3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005a6:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8005ab:	eb 54                	jmp    800601 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b0:	8b 10                	mov    (%eax),%edx
+  8005b2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005b5:	8d 40 08             	lea    0x8(%eax),%eax
+  8005b8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005bb:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8005c0:	eb 3f                	jmp    800601 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c5:	8b 10                	mov    (%eax),%edx
+  8005c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005cc:	8d 40 04             	lea    0x4(%eax),%eax
+  8005cf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005d2:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8005d7:	eb 28                	jmp    800601 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8005d9:	83 ec 08             	sub    $0x8,%esp
+  8005dc:	53                   	push   %ebx
+  8005dd:	6a 30                	push   $0x30
+  8005df:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8005e1:	83 c4 08             	add    $0x8,%esp
+  8005e4:	53                   	push   %ebx
+  8005e5:	6a 78                	push   $0x78
+  8005e7:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8005e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ec:	8b 10                	mov    (%eax),%edx
+  8005ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8005f3:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8005f6:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8005fc:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800601:	83 ec 0c             	sub    $0xc,%esp
+  800604:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800608:	50                   	push   %eax
+  800609:	ff 75 e0             	push   -0x20(%ebp)
+  80060c:	57                   	push   %edi
+  80060d:	51                   	push   %ecx
+  80060e:	52                   	push   %edx
+  80060f:	89 da                	mov    %ebx,%edx
+  800611:	89 f0                	mov    %esi,%eax
+  800613:	e8 4a fb ff ff       	call   800162 <printnum>
+			break;
+  800618:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80061b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80061e:	e9 40 fc ff ff       	jmp    800263 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800623:	83 f9 01             	cmp    $0x1,%ecx
+  800626:	7f 1b                	jg     800643 <vprintfmt+0x3fe>
+	else if (lflag)
+  800628:	85 c9                	test   %ecx,%ecx
+  80062a:	74 2c                	je     800658 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  80062c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062f:	8b 10                	mov    (%eax),%edx
+  800631:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800636:	8d 40 04             	lea    0x4(%eax),%eax
+  800639:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80063c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800641:	eb be                	jmp    800601 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800643:	8b 45 14             	mov    0x14(%ebp),%eax
+  800646:	8b 10                	mov    (%eax),%edx
+  800648:	8b 48 04             	mov    0x4(%eax),%ecx
+  80064b:	8d 40 08             	lea    0x8(%eax),%eax
+  80064e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800651:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800656:	eb a9                	jmp    800601 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800658:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065b:	8b 10                	mov    (%eax),%edx
+  80065d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800662:	8d 40 04             	lea    0x4(%eax),%eax
+  800665:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800668:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80066d:	eb 92                	jmp    800601 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  80066f:	83 ec 08             	sub    $0x8,%esp
+  800672:	53                   	push   %ebx
+  800673:	6a 25                	push   $0x25
+  800675:	ff d6                	call   *%esi
+			break;
+  800677:	83 c4 10             	add    $0x10,%esp
+  80067a:	eb 9f                	jmp    80061b <vprintfmt+0x3d6>
+			putch('%', putdat);
+  80067c:	83 ec 08             	sub    $0x8,%esp
+  80067f:	53                   	push   %ebx
+  800680:	6a 25                	push   $0x25
+  800682:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800684:	83 c4 10             	add    $0x10,%esp
+  800687:	89 f8                	mov    %edi,%eax
+  800689:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80068d:	74 05                	je     800694 <vprintfmt+0x44f>
+  80068f:	83 e8 01             	sub    $0x1,%eax
+  800692:	eb f5                	jmp    800689 <vprintfmt+0x444>
+  800694:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800697:	eb 82                	jmp    80061b <vprintfmt+0x3d6>
+
+00800699 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800699:	55                   	push   %ebp
+  80069a:	89 e5                	mov    %esp,%ebp
+  80069c:	83 ec 18             	sub    $0x18,%esp
+  80069f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006a2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006a5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006a8:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006ac:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006af:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006b6:	85 c0                	test   %eax,%eax
+  8006b8:	74 26                	je     8006e0 <vsnprintf+0x47>
+  8006ba:	85 d2                	test   %edx,%edx
+  8006bc:	7e 22                	jle    8006e0 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006be:	ff 75 14             	push   0x14(%ebp)
+  8006c1:	ff 75 10             	push   0x10(%ebp)
+  8006c4:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006c7:	50                   	push   %eax
+  8006c8:	68 0b 02 80 00       	push   $0x80020b
+  8006cd:	e8 73 fb ff ff       	call   800245 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8006d2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8006d5:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8006d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8006db:	83 c4 10             	add    $0x10,%esp
+}
+  8006de:	c9                   	leave
+  8006df:	c3                   	ret
+		return -E_INVAL;
+  8006e0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006e5:	eb f7                	jmp    8006de <vsnprintf+0x45>
+
+008006e7 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8006e7:	55                   	push   %ebp
+  8006e8:	89 e5                	mov    %esp,%ebp
+  8006ea:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8006ed:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8006f0:	50                   	push   %eax
+  8006f1:	ff 75 10             	push   0x10(%ebp)
+  8006f4:	ff 75 0c             	push   0xc(%ebp)
+  8006f7:	ff 75 08             	push   0x8(%ebp)
+  8006fa:	e8 9a ff ff ff       	call   800699 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8006ff:	c9                   	leave
+  800700:	c3                   	ret
+
+00800701 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800701:	55                   	push   %ebp
+  800702:	89 e5                	mov    %esp,%ebp
+  800704:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800707:	b8 00 00 00 00       	mov    $0x0,%eax
+  80070c:	eb 03                	jmp    800711 <strlen+0x10>
+		n++;
+  80070e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800711:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800715:	75 f7                	jne    80070e <strlen+0xd>
+	return n;
+}
+  800717:	5d                   	pop    %ebp
+  800718:	c3                   	ret
+
+00800719 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800719:	55                   	push   %ebp
+  80071a:	89 e5                	mov    %esp,%ebp
+  80071c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80071f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800722:	b8 00 00 00 00       	mov    $0x0,%eax
+  800727:	eb 03                	jmp    80072c <strnlen+0x13>
+		n++;
+  800729:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80072c:	39 d0                	cmp    %edx,%eax
+  80072e:	74 08                	je     800738 <strnlen+0x1f>
+  800730:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800734:	75 f3                	jne    800729 <strnlen+0x10>
+  800736:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800738:	89 d0                	mov    %edx,%eax
+  80073a:	5d                   	pop    %ebp
+  80073b:	c3                   	ret
+
+0080073c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80073c:	55                   	push   %ebp
+  80073d:	89 e5                	mov    %esp,%ebp
+  80073f:	53                   	push   %ebx
+  800740:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800743:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800746:	b8 00 00 00 00       	mov    $0x0,%eax
+  80074b:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80074f:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800752:	83 c0 01             	add    $0x1,%eax
+  800755:	84 d2                	test   %dl,%dl
+  800757:	75 f2                	jne    80074b <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800759:	89 c8                	mov    %ecx,%eax
+  80075b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80075e:	c9                   	leave
+  80075f:	c3                   	ret
+
+00800760 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800760:	55                   	push   %ebp
+  800761:	89 e5                	mov    %esp,%ebp
+  800763:	53                   	push   %ebx
+  800764:	83 ec 10             	sub    $0x10,%esp
+  800767:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80076a:	53                   	push   %ebx
+  80076b:	e8 91 ff ff ff       	call   800701 <strlen>
+  800770:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800773:	ff 75 0c             	push   0xc(%ebp)
+  800776:	01 d8                	add    %ebx,%eax
+  800778:	50                   	push   %eax
+  800779:	e8 be ff ff ff       	call   80073c <strcpy>
+	return dst;
+}
+  80077e:	89 d8                	mov    %ebx,%eax
+  800780:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800783:	c9                   	leave
+  800784:	c3                   	ret
+
+00800785 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800785:	55                   	push   %ebp
+  800786:	89 e5                	mov    %esp,%ebp
+  800788:	56                   	push   %esi
+  800789:	53                   	push   %ebx
+  80078a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80078d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800790:	89 f3                	mov    %esi,%ebx
+  800792:	03 5d 10             	add    0x10(%ebp),%ebx
+  800795:	89 f0                	mov    %esi,%eax
+  800797:	eb 0f                	jmp    8007a8 <strncpy+0x23>
+		*dst++ = *src;
+  800799:	83 c0 01             	add    $0x1,%eax
+  80079c:	0f b6 0a             	movzbl (%edx),%ecx
+  80079f:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007a2:	80 f9 01             	cmp    $0x1,%cl
+  8007a5:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007a8:	39 d8                	cmp    %ebx,%eax
+  8007aa:	75 ed                	jne    800799 <strncpy+0x14>
+	}
+	return ret;
+}
+  8007ac:	89 f0                	mov    %esi,%eax
+  8007ae:	5b                   	pop    %ebx
+  8007af:	5e                   	pop    %esi
+  8007b0:	5d                   	pop    %ebp
+  8007b1:	c3                   	ret
+
+008007b2 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007b2:	55                   	push   %ebp
+  8007b3:	89 e5                	mov    %esp,%ebp
+  8007b5:	56                   	push   %esi
+  8007b6:	53                   	push   %ebx
+  8007b7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007bd:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8007c0:	89 f0                	mov    %esi,%eax
+  8007c2:	85 d2                	test   %edx,%edx
+  8007c4:	74 21                	je     8007e7 <strlcpy+0x35>
+  8007c6:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8007ca:	89 f2                	mov    %esi,%edx
+  8007cc:	eb 09                	jmp    8007d7 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8007ce:	83 c1 01             	add    $0x1,%ecx
+  8007d1:	83 c2 01             	add    $0x1,%edx
+  8007d4:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8007d7:	39 c2                	cmp    %eax,%edx
+  8007d9:	74 09                	je     8007e4 <strlcpy+0x32>
+  8007db:	0f b6 19             	movzbl (%ecx),%ebx
+  8007de:	84 db                	test   %bl,%bl
+  8007e0:	75 ec                	jne    8007ce <strlcpy+0x1c>
+  8007e2:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8007e4:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8007e7:	29 f0                	sub    %esi,%eax
+}
+  8007e9:	5b                   	pop    %ebx
+  8007ea:	5e                   	pop    %esi
+  8007eb:	5d                   	pop    %ebp
+  8007ec:	c3                   	ret
+
+008007ed <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8007ed:	55                   	push   %ebp
+  8007ee:	89 e5                	mov    %esp,%ebp
+  8007f0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007f3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8007f6:	eb 06                	jmp    8007fe <strcmp+0x11>
+		p++, q++;
+  8007f8:	83 c1 01             	add    $0x1,%ecx
+  8007fb:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8007fe:	0f b6 01             	movzbl (%ecx),%eax
+  800801:	84 c0                	test   %al,%al
+  800803:	74 04                	je     800809 <strcmp+0x1c>
+  800805:	3a 02                	cmp    (%edx),%al
+  800807:	74 ef                	je     8007f8 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800809:	0f b6 c0             	movzbl %al,%eax
+  80080c:	0f b6 12             	movzbl (%edx),%edx
+  80080f:	29 d0                	sub    %edx,%eax
+}
+  800811:	5d                   	pop    %ebp
+  800812:	c3                   	ret
+
+00800813 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800813:	55                   	push   %ebp
+  800814:	89 e5                	mov    %esp,%ebp
+  800816:	53                   	push   %ebx
+  800817:	8b 45 08             	mov    0x8(%ebp),%eax
+  80081a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80081d:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800820:	eb 09                	jmp    80082b <strncmp+0x18>
+		n--, p++, q++;
+  800822:	83 ea 01             	sub    $0x1,%edx
+  800825:	83 c0 01             	add    $0x1,%eax
+  800828:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80082b:	85 d2                	test   %edx,%edx
+  80082d:	74 18                	je     800847 <strncmp+0x34>
+  80082f:	0f b6 18             	movzbl (%eax),%ebx
+  800832:	84 db                	test   %bl,%bl
+  800834:	74 04                	je     80083a <strncmp+0x27>
+  800836:	3a 19                	cmp    (%ecx),%bl
+  800838:	74 e8                	je     800822 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80083a:	0f b6 00             	movzbl (%eax),%eax
+  80083d:	0f b6 11             	movzbl (%ecx),%edx
+  800840:	29 d0                	sub    %edx,%eax
+}
+  800842:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800845:	c9                   	leave
+  800846:	c3                   	ret
+		return 0;
+  800847:	b8 00 00 00 00       	mov    $0x0,%eax
+  80084c:	eb f4                	jmp    800842 <strncmp+0x2f>
+
+0080084e <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80084e:	55                   	push   %ebp
+  80084f:	89 e5                	mov    %esp,%ebp
+  800851:	8b 45 08             	mov    0x8(%ebp),%eax
+  800854:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800858:	eb 03                	jmp    80085d <strchr+0xf>
+  80085a:	83 c0 01             	add    $0x1,%eax
+  80085d:	0f b6 10             	movzbl (%eax),%edx
+  800860:	84 d2                	test   %dl,%dl
+  800862:	74 06                	je     80086a <strchr+0x1c>
+		if (*s == c)
+  800864:	38 ca                	cmp    %cl,%dl
+  800866:	75 f2                	jne    80085a <strchr+0xc>
+  800868:	eb 05                	jmp    80086f <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80086a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80086f:	5d                   	pop    %ebp
+  800870:	c3                   	ret
+
+00800871 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800871:	55                   	push   %ebp
+  800872:	89 e5                	mov    %esp,%ebp
+  800874:	8b 45 08             	mov    0x8(%ebp),%eax
+  800877:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80087b:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80087e:	38 ca                	cmp    %cl,%dl
+  800880:	74 09                	je     80088b <strfind+0x1a>
+  800882:	84 d2                	test   %dl,%dl
+  800884:	74 05                	je     80088b <strfind+0x1a>
+	for (; *s; s++)
+  800886:	83 c0 01             	add    $0x1,%eax
+  800889:	eb f0                	jmp    80087b <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80088b:	5d                   	pop    %ebp
+  80088c:	c3                   	ret
+
+0080088d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80088d:	55                   	push   %ebp
+  80088e:	89 e5                	mov    %esp,%ebp
+  800890:	57                   	push   %edi
+  800891:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800894:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800897:	85 c9                	test   %ecx,%ecx
+  800899:	74 20                	je     8008bb <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80089b:	89 f8                	mov    %edi,%eax
+  80089d:	09 c8                	or     %ecx,%eax
+  80089f:	a8 03                	test   $0x3,%al
+  8008a1:	75 12                	jne    8008b5 <memset+0x28>
+		c &= 0xFF;
+  8008a3:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008a7:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008ad:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008b0:	fc                   	cld
+  8008b1:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008b3:	eb 06                	jmp    8008bb <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008b5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008b8:	fc                   	cld
+  8008b9:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008bb:	89 f8                	mov    %edi,%eax
+  8008bd:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008c0:	c9                   	leave
+  8008c1:	c3                   	ret
+
+008008c2 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008c2:	55                   	push   %ebp
+  8008c3:	89 e5                	mov    %esp,%ebp
+  8008c5:	57                   	push   %edi
+  8008c6:	56                   	push   %esi
+  8008c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008ca:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008cd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8008d0:	39 c6                	cmp    %eax,%esi
+  8008d2:	73 32                	jae    800906 <memmove+0x44>
+  8008d4:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8008d7:	39 d0                	cmp    %edx,%eax
+  8008d9:	73 2b                	jae    800906 <memmove+0x44>
+		s += n;
+		d += n;
+  8008db:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008de:	89 d6                	mov    %edx,%esi
+  8008e0:	09 fe                	or     %edi,%esi
+  8008e2:	09 ce                	or     %ecx,%esi
+  8008e4:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8008ea:	75 0e                	jne    8008fa <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8008ec:	83 ef 04             	sub    $0x4,%edi
+  8008ef:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8008f2:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8008f5:	fd                   	std
+  8008f6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8008f8:	eb 09                	jmp    800903 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8008fa:	83 ef 01             	sub    $0x1,%edi
+  8008fd:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800900:	fd                   	std
+  800901:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800903:	fc                   	cld
+  800904:	eb 1a                	jmp    800920 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800906:	89 f2                	mov    %esi,%edx
+  800908:	09 c2                	or     %eax,%edx
+  80090a:	09 ca                	or     %ecx,%edx
+  80090c:	f6 c2 03             	test   $0x3,%dl
+  80090f:	75 0a                	jne    80091b <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800911:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800914:	89 c7                	mov    %eax,%edi
+  800916:	fc                   	cld
+  800917:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800919:	eb 05                	jmp    800920 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80091b:	89 c7                	mov    %eax,%edi
+  80091d:	fc                   	cld
+  80091e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800920:	5e                   	pop    %esi
+  800921:	5f                   	pop    %edi
+  800922:	5d                   	pop    %ebp
+  800923:	c3                   	ret
+
+00800924 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800924:	55                   	push   %ebp
+  800925:	89 e5                	mov    %esp,%ebp
+  800927:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80092a:	ff 75 10             	push   0x10(%ebp)
+  80092d:	ff 75 0c             	push   0xc(%ebp)
+  800930:	ff 75 08             	push   0x8(%ebp)
+  800933:	e8 8a ff ff ff       	call   8008c2 <memmove>
+}
+  800938:	c9                   	leave
+  800939:	c3                   	ret
+
+0080093a <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80093a:	55                   	push   %ebp
+  80093b:	89 e5                	mov    %esp,%ebp
+  80093d:	56                   	push   %esi
+  80093e:	53                   	push   %ebx
+  80093f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800942:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800945:	89 c6                	mov    %eax,%esi
+  800947:	03 75 10             	add    0x10(%ebp),%esi
+  80094a:	eb 06                	jmp    800952 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  80094c:	83 c0 01             	add    $0x1,%eax
+  80094f:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800952:	39 f0                	cmp    %esi,%eax
+  800954:	74 14                	je     80096a <memcmp+0x30>
+		if (*s1 != *s2)
+  800956:	0f b6 08             	movzbl (%eax),%ecx
+  800959:	0f b6 1a             	movzbl (%edx),%ebx
+  80095c:	38 d9                	cmp    %bl,%cl
+  80095e:	74 ec                	je     80094c <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800960:	0f b6 c1             	movzbl %cl,%eax
+  800963:	0f b6 db             	movzbl %bl,%ebx
+  800966:	29 d8                	sub    %ebx,%eax
+  800968:	eb 05                	jmp    80096f <memcmp+0x35>
+	}
+
+	return 0;
+  80096a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80096f:	5b                   	pop    %ebx
+  800970:	5e                   	pop    %esi
+  800971:	5d                   	pop    %ebp
+  800972:	c3                   	ret
+
+00800973 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800973:	55                   	push   %ebp
+  800974:	89 e5                	mov    %esp,%ebp
+  800976:	8b 45 08             	mov    0x8(%ebp),%eax
+  800979:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80097c:	89 c2                	mov    %eax,%edx
+  80097e:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800981:	eb 03                	jmp    800986 <memfind+0x13>
+  800983:	83 c0 01             	add    $0x1,%eax
+  800986:	39 d0                	cmp    %edx,%eax
+  800988:	73 04                	jae    80098e <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80098a:	38 08                	cmp    %cl,(%eax)
+  80098c:	75 f5                	jne    800983 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  80098e:	5d                   	pop    %ebp
+  80098f:	c3                   	ret
+
+00800990 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800990:	55                   	push   %ebp
+  800991:	89 e5                	mov    %esp,%ebp
+  800993:	57                   	push   %edi
+  800994:	56                   	push   %esi
+  800995:	53                   	push   %ebx
+  800996:	8b 55 08             	mov    0x8(%ebp),%edx
+  800999:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80099c:	eb 03                	jmp    8009a1 <strtol+0x11>
+		s++;
+  80099e:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8009a1:	0f b6 02             	movzbl (%edx),%eax
+  8009a4:	3c 20                	cmp    $0x20,%al
+  8009a6:	74 f6                	je     80099e <strtol+0xe>
+  8009a8:	3c 09                	cmp    $0x9,%al
+  8009aa:	74 f2                	je     80099e <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009ac:	3c 2b                	cmp    $0x2b,%al
+  8009ae:	74 2a                	je     8009da <strtol+0x4a>
+	int neg = 0;
+  8009b0:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009b5:	3c 2d                	cmp    $0x2d,%al
+  8009b7:	74 2b                	je     8009e4 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009b9:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009bf:	75 0f                	jne    8009d0 <strtol+0x40>
+  8009c1:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009c4:	74 28                	je     8009ee <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8009c6:	85 db                	test   %ebx,%ebx
+  8009c8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009cd:	0f 44 d8             	cmove  %eax,%ebx
+  8009d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009d5:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8009d8:	eb 46                	jmp    800a20 <strtol+0x90>
+		s++;
+  8009da:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8009dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009e2:	eb d5                	jmp    8009b9 <strtol+0x29>
+		s++, neg = 1;
+  8009e4:	83 c2 01             	add    $0x1,%edx
+  8009e7:	bf 01 00 00 00       	mov    $0x1,%edi
+  8009ec:	eb cb                	jmp    8009b9 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009ee:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8009f2:	74 0e                	je     800a02 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8009f4:	85 db                	test   %ebx,%ebx
+  8009f6:	75 d8                	jne    8009d0 <strtol+0x40>
+		s++, base = 8;
+  8009f8:	83 c2 01             	add    $0x1,%edx
+  8009fb:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a00:	eb ce                	jmp    8009d0 <strtol+0x40>
+		s += 2, base = 16;
+  800a02:	83 c2 02             	add    $0x2,%edx
+  800a05:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a0a:	eb c4                	jmp    8009d0 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a0c:	0f be c0             	movsbl %al,%eax
+  800a0f:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a12:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a15:	7d 3a                	jge    800a51 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a17:	83 c2 01             	add    $0x1,%edx
+  800a1a:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a1e:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a20:	0f b6 02             	movzbl (%edx),%eax
+  800a23:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a26:	89 f3                	mov    %esi,%ebx
+  800a28:	80 fb 09             	cmp    $0x9,%bl
+  800a2b:	76 df                	jbe    800a0c <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a2d:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a30:	89 f3                	mov    %esi,%ebx
+  800a32:	80 fb 19             	cmp    $0x19,%bl
+  800a35:	77 08                	ja     800a3f <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a37:	0f be c0             	movsbl %al,%eax
+  800a3a:	83 e8 57             	sub    $0x57,%eax
+  800a3d:	eb d3                	jmp    800a12 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a3f:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a42:	89 f3                	mov    %esi,%ebx
+  800a44:	80 fb 19             	cmp    $0x19,%bl
+  800a47:	77 08                	ja     800a51 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a49:	0f be c0             	movsbl %al,%eax
+  800a4c:	83 e8 37             	sub    $0x37,%eax
+  800a4f:	eb c1                	jmp    800a12 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a51:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a55:	74 05                	je     800a5c <strtol+0xcc>
+		*endptr = (char *) s;
+  800a57:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a5a:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a5c:	89 c8                	mov    %ecx,%eax
+  800a5e:	f7 d8                	neg    %eax
+  800a60:	85 ff                	test   %edi,%edi
+  800a62:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a65:	89 c8                	mov    %ecx,%eax
+  800a67:	5b                   	pop    %ebx
+  800a68:	5e                   	pop    %esi
+  800a69:	5f                   	pop    %edi
+  800a6a:	5d                   	pop    %ebp
+  800a6b:	c3                   	ret
+
+00800a6c <atoi>:
+
+int
+atoi(const char *s)
+{
+  800a6c:	55                   	push   %ebp
+  800a6d:	89 e5                	mov    %esp,%ebp
+  800a6f:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800a72:	6a 0a                	push   $0xa
+  800a74:	6a 00                	push   $0x0
+  800a76:	ff 75 08             	push   0x8(%ebp)
+  800a79:	e8 12 ff ff ff       	call   800990 <strtol>
+}
+  800a7e:	c9                   	leave
+  800a7f:	c3                   	ret
+
+00800a80 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800a80:	55                   	push   %ebp
+  800a81:	89 e5                	mov    %esp,%ebp
+  800a83:	57                   	push   %edi
+  800a84:	56                   	push   %esi
+  800a85:	53                   	push   %ebx
+  800a86:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800a8c:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800a92:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800a98:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800a9e:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800aa5:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800aa8:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800aaf:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800ab2:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800ab9:	74 76                	je     800b31 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800abb:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800ac1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ac4:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800aca:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ad1:	0f 88 06 01 00 00    	js     800bdd <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800ad7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ade:	0f 84 48 01 00 00    	je     800c2c <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800ae4:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800aea:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800af0:	be 00 00 00 00       	mov    $0x0,%esi
+  800af5:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800afb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800afe:	55                   	push   %ebp
+  800aff:	68 08 0b 80 00       	push   $0x800b08
+  800b04:	89 e5                	mov    %esp,%ebp
+  800b06:	0f 34                	sysenter
+  800b08:	83 c4 04             	add    $0x4,%esp
+  800b0b:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800b0c:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800b12:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800b18:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800b1b:	0f 85 9a 01 00 00    	jne    800cbb <page_vec_call+0x23b>
+  800b21:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b26:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b29:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b2c:	e9 29 01 00 00       	jmp    800c5a <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800b31:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800b37:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b3a:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800b3c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b43:	78 2f                	js     800b74 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800b45:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b4c:	74 72                	je     800bc0 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800b4e:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800b54:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800b5a:	b8 10 00 00 00       	mov    $0x10,%eax
+  800b5f:	89 fb                	mov    %edi,%ebx
+  800b61:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800b64:	55                   	push   %ebp
+  800b65:	68 6e 0b 80 00       	push   $0x800b6e
+  800b6a:	89 e5                	mov    %esp,%ebp
+  800b6c:	0f 34                	sysenter
+  800b6e:	83 c4 04             	add    $0x4,%esp
+  800b71:	5d                   	pop    %ebp
+	return ret;
+  800b72:	eb 98                	jmp    800b0c <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800b74:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b79:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800b7b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800b80:	f6 c6 08             	test   $0x8,%dh
+  800b83:	74 15                	je     800b9a <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800b85:	89 c2                	mov    %eax,%edx
+  800b87:	c1 ea 08             	shr    $0x8,%edx
+  800b8a:	83 e2 0f             	and    $0xf,%edx
+  800b8d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800b92:	83 fa 06             	cmp    $0x6,%edx
+  800b95:	74 0e                	je     800ba5 <page_vec_call+0x125>
+  800b97:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800b9a:	0f b6 c9             	movzbl %cl,%ecx
+  800b9d:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800ba3:	eb a0                	jmp    800b45 <page_vec_call+0xc5>
+  800ba5:	89 c2                	mov    %eax,%edx
+  800ba7:	c1 ea 04             	shr    $0x4,%edx
+  800baa:	83 e2 0f             	and    $0xf,%edx
+  800bad:	83 fa 02             	cmp    $0x2,%edx
+  800bb0:	77 e5                	ja     800b97 <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800bb2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800bb5:	83 f8 02             	cmp    $0x2,%eax
+  800bb8:	0f 97 c1             	seta   %cl
+  800bbb:	0f b6 c9             	movzbl %cl,%ecx
+  800bbe:	eb d7                	jmp    800b97 <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800bc0:	b8 10 00 00 00       	mov    $0x10,%eax
+  800bc5:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800bcb:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800bd1:	89 fb                	mov    %edi,%ebx
+  800bd3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800bd6:	cd 30                	int    $0x30
+  800bd8:	e9 2f ff ff ff       	jmp    800b0c <page_vec_call+0x8c>
+  800bdd:	b8 01 00 00 00       	mov    $0x1,%eax
+  800be2:	0f a2                	cpuid
+		return 0;
+  800be4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800be9:	f6 c6 08             	test   $0x8,%dh
+  800bec:	74 15                	je     800c03 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800bee:	89 c2                	mov    %eax,%edx
+  800bf0:	c1 ea 08             	shr    $0x8,%edx
+  800bf3:	83 e2 0f             	and    $0xf,%edx
+  800bf6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800bfb:	83 fa 06             	cmp    $0x6,%edx
+  800bfe:	74 11                	je     800c11 <page_vec_call+0x191>
+  800c00:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800c03:	0f b6 c9             	movzbl %cl,%ecx
+  800c06:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800c0c:	e9 c6 fe ff ff       	jmp    800ad7 <page_vec_call+0x57>
+  800c11:	89 c2                	mov    %eax,%edx
+  800c13:	c1 ea 04             	shr    $0x4,%edx
+  800c16:	83 e2 0f             	and    $0xf,%edx
+  800c19:	83 fa 02             	cmp    $0x2,%edx
+  800c1c:	77 e2                	ja     800c00 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800c1e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c21:	83 f8 02             	cmp    $0x2,%eax
+  800c24:	0f 97 c1             	seta   %cl
+  800c27:	0f b6 c9             	movzbl %cl,%ecx
+  800c2a:	eb d4                	jmp    800c00 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800c2c:	be 00 00 00 00       	mov    $0x0,%esi
+  800c31:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800c37:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800c3d:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800c43:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c46:	cd 30                	int    $0x30
+  800c48:	e9 bf fe ff ff       	jmp    800b0c <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800c4d:	29 da                	sub    %ebx,%edx
+			vec++;
+  800c4f:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800c52:	83 e8 01             	sub    $0x1,%eax
+  800c55:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800c5a:	85 c0                	test   %eax,%eax
+  800c5c:	74 58                	je     800cb6 <page_vec_call+0x236>
+  800c5e:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800c61:	39 da                	cmp    %ebx,%edx
+  800c63:	73 e8                	jae    800c4d <page_vec_call+0x1cd>
+  800c65:	89 75 08             	mov    %esi,0x8(%ebp)
+  800c68:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800c6b:	84 c9                	test   %cl,%cl
+  800c6d:	74 06                	je     800c75 <page_vec_call+0x1f5>
+  800c6f:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800c75:	83 ec 04             	sub    $0x4,%esp
+  800c78:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c7b:	c1 e0 04             	shl    $0x4,%eax
+  800c7e:	50                   	push   %eax
+  800c7f:	ff 75 08             	push   0x8(%ebp)
+  800c82:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800c88:	53                   	push   %ebx
+  800c89:	e8 34 fc ff ff       	call   8008c2 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800c8e:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800c94:	89 c2                	mov    %eax,%edx
+  800c96:	c1 e2 0c             	shl    $0xc,%edx
+  800c99:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  800c9f:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  800ca5:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  800cab:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  800cae:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  800cb1:	e9 f2 fd ff ff       	jmp    800aa8 <page_vec_call+0x28>
+			r = 0;
+  800cb6:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  800cbb:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800cbf:	74 0b                	je     800ccc <page_vec_call+0x24c>
+		*done = total;
+  800cc1:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800cc4:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  800cca:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  800ccc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ccf:	5b                   	pop    %ebx
+  800cd0:	5e                   	pop    %esi
+  800cd1:	5f                   	pop    %edi
+  800cd2:	5d                   	pop    %ebp
+  800cd3:	c3                   	ret
+
+00800cd4 <sys_cputs>:
+{
+  800cd4:	55                   	push   %ebp
+  800cd5:	89 e5                	mov    %esp,%ebp
+  800cd7:	57                   	push   %edi
+  800cd8:	56                   	push   %esi
+  800cd9:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800cda:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ce1:	78 2d                	js     800d10 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800ce3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800cea:	74 70                	je     800d5c <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800cec:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf7:	89 c3                	mov    %eax,%ebx
+  800cf9:	89 c7                	mov    %eax,%edi
+  800cfb:	89 c6                	mov    %eax,%esi
+  800cfd:	55                   	push   %ebp
+  800cfe:	68 07 0d 80 00       	push   $0x800d07
+  800d03:	89 e5                	mov    %esp,%ebp
+  800d05:	0f 34                	sysenter
+  800d07:	83 c4 04             	add    $0x4,%esp
+  800d0a:	5d                   	pop    %ebp
+}
+  800d0b:	5b                   	pop    %ebx
+  800d0c:	5e                   	pop    %esi
+  800d0d:	5f                   	pop    %edi
+  800d0e:	5d                   	pop    %ebp
+  800d0f:	c3                   	ret
+  800d10:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d15:	0f a2                	cpuid
+		return 0;
+  800d17:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800d1c:	f6 c6 08             	test   $0x8,%dh
+  800d1f:	74 15                	je     800d36 <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d21:	89 c2                	mov    %eax,%edx
+  800d23:	c1 ea 08             	shr    $0x8,%edx
+  800d26:	83 e2 0f             	and    $0xf,%edx
+  800d29:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d2e:	83 fa 06             	cmp    $0x6,%edx
+  800d31:	74 0e                	je     800d41 <sys_cputs+0x6d>
+  800d33:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800d36:	0f b6 c9             	movzbl %cl,%ecx
+  800d39:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800d3f:	eb a2                	jmp    800ce3 <sys_cputs+0xf>
+  800d41:	89 c2                	mov    %eax,%edx
+  800d43:	c1 ea 04             	shr    $0x4,%edx
+  800d46:	83 e2 0f             	and    $0xf,%edx
+  800d49:	83 fa 02             	cmp    $0x2,%edx
+  800d4c:	77 e5                	ja     800d33 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800d4e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d51:	83 f8 02             	cmp    $0x2,%eax
+  800d54:	0f 97 c1             	seta   %cl
+  800d57:	0f b6 c9             	movzbl %cl,%ecx
+  800d5a:	eb d7                	jmp    800d33 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800d5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d67:	89 c3                	mov    %eax,%ebx
+  800d69:	89 c7                	mov    %eax,%edi
+  800d6b:	89 c6                	mov    %eax,%esi
+  800d6d:	cd 30                	int    $0x30
+}
+  800d6f:	eb 9a                	jmp    800d0b <sys_cputs+0x37>
+
+00800d71 <sys_cgetc>:
+{
+  800d71:	55                   	push   %ebp
+  800d72:	89 e5                	mov    %esp,%ebp
+  800d74:	57                   	push   %edi
+  800d75:	56                   	push   %esi
+  800d76:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800d77:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d7e:	78 2e                	js     800dae <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  800d80:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d87:	74 71                	je     800dfa <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  800d89:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d8e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d93:	89 d1                	mov    %edx,%ecx
+  800d95:	89 d3                	mov    %edx,%ebx
+  800d97:	89 d7                	mov    %edx,%edi
+  800d99:	89 d6                	mov    %edx,%esi
+  800d9b:	55                   	push   %ebp
+  800d9c:	68 a5 0d 80 00       	push   $0x800da5
+  800da1:	89 e5                	mov    %esp,%ebp
+  800da3:	0f 34                	sysenter
+  800da5:	83 c4 04             	add    $0x4,%esp
+  800da8:	5d                   	pop    %ebp
+}
+  800da9:	5b                   	pop    %ebx
+  800daa:	5e                   	pop    %esi
+  800dab:	5f                   	pop    %edi
+  800dac:	5d                   	pop    %ebp
+  800dad:	c3                   	ret
+  800dae:	b8 01 00 00 00       	mov    $0x1,%eax
+  800db3:	0f a2                	cpuid
+		return 0;
+  800db5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800dba:	f6 c6 08             	test   $0x8,%dh
+  800dbd:	74 15                	je     800dd4 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800dbf:	89 c2                	mov    %eax,%edx
+  800dc1:	c1 ea 08             	shr    $0x8,%edx
+  800dc4:	83 e2 0f             	and    $0xf,%edx
+  800dc7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800dcc:	83 fa 06             	cmp    $0x6,%edx
+  800dcf:	74 0e                	je     800ddf <sys_cgetc+0x6e>
+  800dd1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800dd4:	0f b6 c9             	movzbl %cl,%ecx
+  800dd7:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800ddd:	eb a1                	jmp    800d80 <sys_cgetc+0xf>
+  800ddf:	89 c2                	mov    %eax,%edx
+  800de1:	c1 ea 04             	shr    $0x4,%edx
+  800de4:	83 e2 0f             	and    $0xf,%edx
+  800de7:	83 fa 02             	cmp    $0x2,%edx
+  800dea:	77 e5                	ja     800dd1 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  800dec:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800def:	83 f8 02             	cmp    $0x2,%eax
+  800df2:	0f 97 c1             	seta   %cl
+  800df5:	0f b6 c9             	movzbl %cl,%ecx
+  800df8:	eb d7                	jmp    800dd1 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  800dfa:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dff:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e04:	89 d1                	mov    %edx,%ecx
+  800e06:	89 d3                	mov    %edx,%ebx
+  800e08:	89 d7                	mov    %edx,%edi
+  800e0a:	89 d6                	mov    %edx,%esi
+  800e0c:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800e0e:	eb 99                	jmp    800da9 <sys_cgetc+0x38>
+
+00800e10 <sys_env_destroy>:
+{
+  800e10:	55                   	push   %ebp
+  800e11:	89 e5                	mov    %esp,%ebp
+  800e13:	57                   	push   %edi
+  800e14:	56                   	push   %esi
+  800e15:	53                   	push   %ebx
+  800e16:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800e19:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e20:	78 36                	js     800e58 <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  800e22:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e29:	74 79                	je     800ea4 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  800e2b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e2e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e33:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e38:	89 cb                	mov    %ecx,%ebx
+  800e3a:	89 cf                	mov    %ecx,%edi
+  800e3c:	89 ce                	mov    %ecx,%esi
+  800e3e:	55                   	push   %ebp
+  800e3f:	68 48 0e 80 00       	push   $0x800e48
+  800e44:	89 e5                	mov    %esp,%ebp
+  800e46:	0f 34                	sysenter
+  800e48:	83 c4 04             	add    $0x4,%esp
+  800e4b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e4c:	85 c0                	test   %eax,%eax
+  800e4e:	7f 6b                	jg     800ebb <sys_env_destroy+0xab>
+}
+  800e50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e53:	5b                   	pop    %ebx
+  800e54:	5e                   	pop    %esi
+  800e55:	5f                   	pop    %edi
+  800e56:	5d                   	pop    %ebp
+  800e57:	c3                   	ret
+  800e58:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e5d:	0f a2                	cpuid
+		return 0;
+  800e5f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800e64:	f6 c6 08             	test   $0x8,%dh
+  800e67:	74 15                	je     800e7e <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e69:	89 c2                	mov    %eax,%edx
+  800e6b:	c1 ea 08             	shr    $0x8,%edx
+  800e6e:	83 e2 0f             	and    $0xf,%edx
+  800e71:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e76:	83 fa 06             	cmp    $0x6,%edx
+  800e79:	74 0e                	je     800e89 <sys_env_destroy+0x79>
+  800e7b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e7e:	0f b6 c9             	movzbl %cl,%ecx
+  800e81:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800e87:	eb 99                	jmp    800e22 <sys_env_destroy+0x12>
+  800e89:	89 c2                	mov    %eax,%edx
+  800e8b:	c1 ea 04             	shr    $0x4,%edx
+  800e8e:	83 e2 0f             	and    $0xf,%edx
+  800e91:	83 fa 02             	cmp    $0x2,%edx
+  800e94:	77 e5                	ja     800e7b <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  800e96:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e99:	83 f8 02             	cmp    $0x2,%eax
+  800e9c:	0f 97 c1             	seta   %cl
+  800e9f:	0f b6 c9             	movzbl %cl,%ecx
+  800ea2:	eb d7                	jmp    800e7b <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  800ea4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ea9:	b8 03 00 00 00       	mov    $0x3,%eax
+  800eae:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb1:	89 cb                	mov    %ecx,%ebx
+  800eb3:	89 cf                	mov    %ecx,%edi
+  800eb5:	89 ce                	mov    %ecx,%esi
+  800eb7:	cd 30                	int    $0x30
+  800eb9:	eb 91                	jmp    800e4c <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ebb:	83 ec 0c             	sub    $0xc,%esp
+  800ebe:	50                   	push   %eax
+  800ebf:	6a 03                	push   $0x3
+  800ec1:	68 79 2b 80 00       	push   $0x802b79
+  800ec6:	6a 4a                	push   $0x4a
+  800ec8:	68 96 2b 80 00       	push   $0x802b96
+  800ecd:	e8 1e 17 00 00       	call   8025f0 <_panic>
+
+00800ed2 <sys_getenvid>:
+{
+  800ed2:	55                   	push   %ebp
+  800ed3:	89 e5                	mov    %esp,%ebp
+  800ed5:	57                   	push   %edi
+  800ed6:	56                   	push   %esi
+  800ed7:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800ed8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800edf:	78 2e                	js     800f0f <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  800ee1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ee8:	74 71                	je     800f5b <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  800eea:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eef:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ef4:	89 d1                	mov    %edx,%ecx
+  800ef6:	89 d3                	mov    %edx,%ebx
+  800ef8:	89 d7                	mov    %edx,%edi
+  800efa:	89 d6                	mov    %edx,%esi
+  800efc:	55                   	push   %ebp
+  800efd:	68 06 0f 80 00       	push   $0x800f06
+  800f02:	89 e5                	mov    %esp,%ebp
+  800f04:	0f 34                	sysenter
+  800f06:	83 c4 04             	add    $0x4,%esp
+  800f09:	5d                   	pop    %ebp
+}
+  800f0a:	5b                   	pop    %ebx
+  800f0b:	5e                   	pop    %esi
+  800f0c:	5f                   	pop    %edi
+  800f0d:	5d                   	pop    %ebp
+  800f0e:	c3                   	ret
+  800f0f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f14:	0f a2                	cpuid
+		return 0;
+  800f16:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f1b:	f6 c6 08             	test   $0x8,%dh
+  800f1e:	74 15                	je     800f35 <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f20:	89 c2                	mov    %eax,%edx
+  800f22:	c1 ea 08             	shr    $0x8,%edx
+  800f25:	83 e2 0f             	and    $0xf,%edx
+  800f28:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f2d:	83 fa 06             	cmp    $0x6,%edx
+  800f30:	74 0e                	je     800f40 <sys_getenvid+0x6e>
+  800f32:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f35:	0f b6 c9             	movzbl %cl,%ecx
+  800f38:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800f3e:	eb a1                	jmp    800ee1 <sys_getenvid+0xf>
+  800f40:	89 c2                	mov    %eax,%edx
+  800f42:	c1 ea 04             	shr    $0x4,%edx
+  800f45:	83 e2 0f             	and    $0xf,%edx
+  800f48:	83 fa 02             	cmp    $0x2,%edx
+  800f4b:	77 e5                	ja     800f32 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  800f4d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f50:	83 f8 02             	cmp    $0x2,%eax
+  800f53:	0f 97 c1             	seta   %cl
+  800f56:	0f b6 c9             	movzbl %cl,%ecx
+  800f59:	eb d7                	jmp    800f32 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  800f5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f60:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f65:	89 d1                	mov    %edx,%ecx
+  800f67:	89 d3                	mov    %edx,%ebx
+  800f69:	89 d7                	mov    %edx,%edi
+  800f6b:	89 d6                	mov    %edx,%esi
+  800f6d:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  800f6f:	eb 99                	jmp    800f0a <sys_getenvid+0x38>
+
+00800f71 <sys_page_alloc>:
+{
+  800f71:	55                   	push   %ebp
+  800f72:	89 e5                	mov    %esp,%ebp
+  800f74:	57                   	push   %edi
+  800f75:	56                   	push   %esi
+  800f76:	53                   	push   %ebx
+  800f77:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800f7a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f81:	78 38                	js     800fbb <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  800f83:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f8a:	74 7b                	je     801007 <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  800f8c:	be 00 00 00 00       	mov    $0x0,%esi
+  800f91:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f94:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f97:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f9c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f9f:	89 f7                	mov    %esi,%edi
+  800fa1:	55                   	push   %ebp
+  800fa2:	68 ab 0f 80 00       	push   $0x800fab
+  800fa7:	89 e5                	mov    %esp,%ebp
+  800fa9:	0f 34                	sysenter
+  800fab:	83 c4 04             	add    $0x4,%esp
+  800fae:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800faf:	85 c0                	test   %eax,%eax
+  800fb1:	7f 6d                	jg     801020 <sys_page_alloc+0xaf>
+}
+  800fb3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb6:	5b                   	pop    %ebx
+  800fb7:	5e                   	pop    %esi
+  800fb8:	5f                   	pop    %edi
+  800fb9:	5d                   	pop    %ebp
+  800fba:	c3                   	ret
+  800fbb:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fc0:	0f a2                	cpuid
+		return 0;
+  800fc2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800fc7:	f6 c6 08             	test   $0x8,%dh
+  800fca:	74 15                	je     800fe1 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800fcc:	89 c2                	mov    %eax,%edx
+  800fce:	c1 ea 08             	shr    $0x8,%edx
+  800fd1:	83 e2 0f             	and    $0xf,%edx
+  800fd4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800fd9:	83 fa 06             	cmp    $0x6,%edx
+  800fdc:	74 0e                	je     800fec <sys_page_alloc+0x7b>
+  800fde:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800fe1:	0f b6 c9             	movzbl %cl,%ecx
+  800fe4:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800fea:	eb 97                	jmp    800f83 <sys_page_alloc+0x12>
+  800fec:	89 c2                	mov    %eax,%edx
+  800fee:	c1 ea 04             	shr    $0x4,%edx
+  800ff1:	83 e2 0f             	and    $0xf,%edx
+  800ff4:	83 fa 02             	cmp    $0x2,%edx
+  800ff7:	77 e5                	ja     800fde <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  800ff9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ffc:	83 f8 02             	cmp    $0x2,%eax
+  800fff:	0f 97 c1             	seta   %cl
+  801002:	0f b6 c9             	movzbl %cl,%ecx
+  801005:	eb d7                	jmp    800fde <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  801007:	be 00 00 00 00       	mov    $0x0,%esi
+  80100c:	b8 04 00 00 00       	mov    $0x4,%eax
+  801011:	8b 55 08             	mov    0x8(%ebp),%edx
+  801014:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801017:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80101a:	89 f7                	mov    %esi,%edi
+  80101c:	cd 30                	int    $0x30
+  80101e:	eb 8f                	jmp    800faf <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801020:	83 ec 0c             	sub    $0xc,%esp
+  801023:	50                   	push   %eax
+  801024:	6a 04                	push   $0x4
+  801026:	68 79 2b 80 00       	push   $0x802b79
+  80102b:	6a 4a                	push   $0x4a
+  80102d:	68 96 2b 80 00       	push   $0x802b96
+  801032:	e8 b9 15 00 00       	call   8025f0 <_panic>
+
+00801037 <sys_page_map>:
+{
+  801037:	55                   	push   %ebp
+  801038:	89 e5                	mov    %esp,%ebp
+  80103a:	57                   	push   %edi
+  80103b:	56                   	push   %esi
+  80103c:	53                   	push   %ebx
+  80103d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801040:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801047:	78 37                	js     801080 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  801049:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801050:	74 7a                	je     8010cc <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  801052:	8b 55 08             	mov    0x8(%ebp),%edx
+  801055:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801058:	b8 05 00 00 00       	mov    $0x5,%eax
+  80105d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801060:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801063:	8b 75 18             	mov    0x18(%ebp),%esi
+  801066:	55                   	push   %ebp
+  801067:	68 70 10 80 00       	push   $0x801070
+  80106c:	89 e5                	mov    %esp,%ebp
+  80106e:	0f 34                	sysenter
+  801070:	83 c4 04             	add    $0x4,%esp
+  801073:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801074:	85 c0                	test   %eax,%eax
+  801076:	7f 6c                	jg     8010e4 <sys_page_map+0xad>
+}
+  801078:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80107b:	5b                   	pop    %ebx
+  80107c:	5e                   	pop    %esi
+  80107d:	5f                   	pop    %edi
+  80107e:	5d                   	pop    %ebp
+  80107f:	c3                   	ret
+  801080:	b8 01 00 00 00       	mov    $0x1,%eax
+  801085:	0f a2                	cpuid
+		return 0;
+  801087:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80108c:	f6 c6 08             	test   $0x8,%dh
+  80108f:	74 15                	je     8010a6 <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801091:	89 c2                	mov    %eax,%edx
+  801093:	c1 ea 08             	shr    $0x8,%edx
+  801096:	83 e2 0f             	and    $0xf,%edx
+  801099:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80109e:	83 fa 06             	cmp    $0x6,%edx
+  8010a1:	74 0e                	je     8010b1 <sys_page_map+0x7a>
+  8010a3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8010a6:	0f b6 c9             	movzbl %cl,%ecx
+  8010a9:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8010af:	eb 98                	jmp    801049 <sys_page_map+0x12>
+  8010b1:	89 c2                	mov    %eax,%edx
+  8010b3:	c1 ea 04             	shr    $0x4,%edx
+  8010b6:	83 e2 0f             	and    $0xf,%edx
+  8010b9:	83 fa 02             	cmp    $0x2,%edx
+  8010bc:	77 e5                	ja     8010a3 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  8010be:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010c1:	83 f8 02             	cmp    $0x2,%eax
+  8010c4:	0f 97 c1             	seta   %cl
+  8010c7:	0f b6 c9             	movzbl %cl,%ecx
+  8010ca:	eb d7                	jmp    8010a3 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  8010cc:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010da:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010dd:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010e0:	cd 30                	int    $0x30
+  8010e2:	eb 90                	jmp    801074 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010e4:	83 ec 0c             	sub    $0xc,%esp
+  8010e7:	50                   	push   %eax
+  8010e8:	6a 05                	push   $0x5
+  8010ea:	68 79 2b 80 00       	push   $0x802b79
+  8010ef:	6a 4a                	push   $0x4a
+  8010f1:	68 96 2b 80 00       	push   $0x802b96
+  8010f6:	e8 f5 14 00 00       	call   8025f0 <_panic>
+
+008010fb <sys_page_unmap>:
+{
+  8010fb:	55                   	push   %ebp
+  8010fc:	89 e5                	mov    %esp,%ebp
+  8010fe:	57                   	push   %edi
+  8010ff:	56                   	push   %esi
+  801100:	53                   	push   %ebx
+  801101:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801104:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80110b:	78 37                	js     801144 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  80110d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801114:	74 7a                	je     801190 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  801116:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80111b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80111e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801121:	b8 06 00 00 00       	mov    $0x6,%eax
+  801126:	89 df                	mov    %ebx,%edi
+  801128:	89 de                	mov    %ebx,%esi
+  80112a:	55                   	push   %ebp
+  80112b:	68 34 11 80 00       	push   $0x801134
+  801130:	89 e5                	mov    %esp,%ebp
+  801132:	0f 34                	sysenter
+  801134:	83 c4 04             	add    $0x4,%esp
+  801137:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801138:	85 c0                	test   %eax,%eax
+  80113a:	7f 6c                	jg     8011a8 <sys_page_unmap+0xad>
+}
+  80113c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80113f:	5b                   	pop    %ebx
+  801140:	5e                   	pop    %esi
+  801141:	5f                   	pop    %edi
+  801142:	5d                   	pop    %ebp
+  801143:	c3                   	ret
+  801144:	b8 01 00 00 00       	mov    $0x1,%eax
+  801149:	0f a2                	cpuid
+		return 0;
+  80114b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801150:	f6 c6 08             	test   $0x8,%dh
+  801153:	74 15                	je     80116a <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801155:	89 c2                	mov    %eax,%edx
+  801157:	c1 ea 08             	shr    $0x8,%edx
+  80115a:	83 e2 0f             	and    $0xf,%edx
+  80115d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801162:	83 fa 06             	cmp    $0x6,%edx
+  801165:	74 0e                	je     801175 <sys_page_unmap+0x7a>
+  801167:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80116a:	0f b6 c9             	movzbl %cl,%ecx
+  80116d:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801173:	eb 98                	jmp    80110d <sys_page_unmap+0x12>
+  801175:	89 c2                	mov    %eax,%edx
+  801177:	c1 ea 04             	shr    $0x4,%edx
+  80117a:	83 e2 0f             	and    $0xf,%edx
+  80117d:	83 fa 02             	cmp    $0x2,%edx
+  801180:	77 e5                	ja     801167 <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  801182:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801185:	83 f8 02             	cmp    $0x2,%eax
+  801188:	0f 97 c1             	seta   %cl
+  80118b:	0f b6 c9             	movzbl %cl,%ecx
+  80118e:	eb d7                	jmp    801167 <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  801190:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801195:	b8 06 00 00 00       	mov    $0x6,%eax
+  80119a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a0:	89 df                	mov    %ebx,%edi
+  8011a2:	89 de                	mov    %ebx,%esi
+  8011a4:	cd 30                	int    $0x30
+  8011a6:	eb 90                	jmp    801138 <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011a8:	83 ec 0c             	sub    $0xc,%esp
+  8011ab:	50                   	push   %eax
+  8011ac:	6a 06                	push   $0x6
+  8011ae:	68 79 2b 80 00       	push   $0x802b79
+  8011b3:	6a 4a                	push   $0x4a
+  8011b5:	68 96 2b 80 00       	push   $0x802b96
+  8011ba:	e8 31 14 00 00       	call   8025f0 <_panic>
+
+008011bf <sys_page_copy>:
+{
+  8011bf:	55                   	push   %ebp
+  8011c0:	89 e5                	mov    %esp,%ebp
+  8011c2:	57                   	push   %edi
+  8011c3:	56                   	push   %esi
+  8011c4:	53                   	push   %ebx
+  8011c5:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8011c8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8011cf:	78 37                	js     801208 <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  8011d1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8011d8:	74 7a                	je     801254 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  8011da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e0:	b8 29 00 00 00       	mov    $0x29,%eax
+  8011e5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011e8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011eb:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011ee:	55                   	push   %ebp
+  8011ef:	68 f8 11 80 00       	push   $0x8011f8
+  8011f4:	89 e5                	mov    %esp,%ebp
+  8011f6:	0f 34                	sysenter
+  8011f8:	83 c4 04             	add    $0x4,%esp
+  8011fb:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8011fc:	85 c0                	test   %eax,%eax
+  8011fe:	7f 6c                	jg     80126c <sys_page_copy+0xad>
+}
+  801200:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801203:	5b                   	pop    %ebx
+  801204:	5e                   	pop    %esi
+  801205:	5f                   	pop    %edi
+  801206:	5d                   	pop    %ebp
+  801207:	c3                   	ret
+  801208:	b8 01 00 00 00       	mov    $0x1,%eax
+  80120d:	0f a2                	cpuid
+		return 0;
+  80120f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801214:	f6 c6 08             	test   $0x8,%dh
+  801217:	74 15                	je     80122e <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801219:	89 c2                	mov    %eax,%edx
+  80121b:	c1 ea 08             	shr    $0x8,%edx
+  80121e:	83 e2 0f             	and    $0xf,%edx
+  801221:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801226:	83 fa 06             	cmp    $0x6,%edx
+  801229:	74 0e                	je     801239 <sys_page_copy+0x7a>
+  80122b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80122e:	0f b6 c9             	movzbl %cl,%ecx
+  801231:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801237:	eb 98                	jmp    8011d1 <sys_page_copy+0x12>
+  801239:	89 c2                	mov    %eax,%edx
+  80123b:	c1 ea 04             	shr    $0x4,%edx
+  80123e:	83 e2 0f             	and    $0xf,%edx
+  801241:	83 fa 02             	cmp    $0x2,%edx
+  801244:	77 e5                	ja     80122b <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  801246:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801249:	83 f8 02             	cmp    $0x2,%eax
+  80124c:	0f 97 c1             	seta   %cl
+  80124f:	0f b6 c9             	movzbl %cl,%ecx
+  801252:	eb d7                	jmp    80122b <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  801254:	b8 29 00 00 00       	mov    $0x29,%eax
+  801259:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80125f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801262:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801265:	8b 75 18             	mov    0x18(%ebp),%esi
+  801268:	cd 30                	int    $0x30
+  80126a:	eb 90                	jmp    8011fc <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80126c:	83 ec 0c             	sub    $0xc,%esp
+  80126f:	50                   	push   %eax
+  801270:	6a 29                	push   $0x29
+  801272:	68 79 2b 80 00       	push   $0x802b79
+  801277:	6a 4a                	push   $0x4a
+  801279:	68 96 2b 80 00       	push   $0x802b96
+  80127e:	e8 6d 13 00 00       	call   8025f0 <_panic>
+
+00801283 <sys_yield>:
+{
+  801283:	55                   	push   %ebp
+  801284:	89 e5                	mov    %esp,%ebp
+  801286:	57                   	push   %edi
+  801287:	56                   	push   %esi
+  801288:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801289:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801290:	78 2e                	js     8012c0 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  801292:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801299:	74 71                	je     80130c <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  80129b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012a0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8012a5:	89 d1                	mov    %edx,%ecx
+  8012a7:	89 d3                	mov    %edx,%ebx
+  8012a9:	89 d7                	mov    %edx,%edi
+  8012ab:	89 d6                	mov    %edx,%esi
+  8012ad:	55                   	push   %ebp
+  8012ae:	68 b7 12 80 00       	push   $0x8012b7
+  8012b3:	89 e5                	mov    %esp,%ebp
+  8012b5:	0f 34                	sysenter
+  8012b7:	83 c4 04             	add    $0x4,%esp
+  8012ba:	5d                   	pop    %ebp
+}
+  8012bb:	5b                   	pop    %ebx
+  8012bc:	5e                   	pop    %esi
+  8012bd:	5f                   	pop    %edi
+  8012be:	5d                   	pop    %ebp
+  8012bf:	c3                   	ret
+  8012c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012c5:	0f a2                	cpuid
+		return 0;
+  8012c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8012cc:	f6 c6 08             	test   $0x8,%dh
+  8012cf:	74 15                	je     8012e6 <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012d1:	89 c2                	mov    %eax,%edx
+  8012d3:	c1 ea 08             	shr    $0x8,%edx
+  8012d6:	83 e2 0f             	and    $0xf,%edx
+  8012d9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012de:	83 fa 06             	cmp    $0x6,%edx
+  8012e1:	74 0e                	je     8012f1 <sys_yield+0x6e>
+  8012e3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8012e6:	0f b6 c9             	movzbl %cl,%ecx
+  8012e9:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8012ef:	eb a1                	jmp    801292 <sys_yield+0xf>
+  8012f1:	89 c2                	mov    %eax,%edx
+  8012f3:	c1 ea 04             	shr    $0x4,%edx
+  8012f6:	83 e2 0f             	and    $0xf,%edx
+  8012f9:	83 fa 02             	cmp    $0x2,%edx
+  8012fc:	77 e5                	ja     8012e3 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  8012fe:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801301:	83 f8 02             	cmp    $0x2,%eax
+  801304:	0f 97 c1             	seta   %cl
+  801307:	0f b6 c9             	movzbl %cl,%ecx
+  80130a:	eb d7                	jmp    8012e3 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  80130c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801311:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801316:	89 d1                	mov    %edx,%ecx
+  801318:	89 d3                	mov    %edx,%ebx
+  80131a:	89 d7                	mov    %edx,%edi
+  80131c:	89 d6                	mov    %edx,%esi
+  80131e:	cd 30                	int    $0x30
+}
+  801320:	eb 99                	jmp    8012bb <sys_yield+0x38>
+
+00801322 <sys_env_set_status>:
+{
+  801322:	55                   	push   %ebp
+  801323:	89 e5                	mov    %esp,%ebp
+  801325:	57                   	push   %edi
+  801326:	56                   	push   %esi
+  801327:	53                   	push   %ebx
+  801328:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80132b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801332:	78 37                	js     80136b <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  801334:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80133b:	74 7a                	je     8013b7 <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  80133d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801342:	8b 55 08             	mov    0x8(%ebp),%edx
+  801345:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801348:	b8 08 00 00 00       	mov    $0x8,%eax
+  80134d:	89 df                	mov    %ebx,%edi
+  80134f:	89 de                	mov    %ebx,%esi
+  801351:	55                   	push   %ebp
+  801352:	68 5b 13 80 00       	push   $0x80135b
+  801357:	89 e5                	mov    %esp,%ebp
+  801359:	0f 34                	sysenter
+  80135b:	83 c4 04             	add    $0x4,%esp
+  80135e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80135f:	85 c0                	test   %eax,%eax
+  801361:	7f 6c                	jg     8013cf <sys_env_set_status+0xad>
+}
+  801363:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801366:	5b                   	pop    %ebx
+  801367:	5e                   	pop    %esi
+  801368:	5f                   	pop    %edi
+  801369:	5d                   	pop    %ebp
+  80136a:	c3                   	ret
+  80136b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801370:	0f a2                	cpuid
+		return 0;
+  801372:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801377:	f6 c6 08             	test   $0x8,%dh
+  80137a:	74 15                	je     801391 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80137c:	89 c2                	mov    %eax,%edx
+  80137e:	c1 ea 08             	shr    $0x8,%edx
+  801381:	83 e2 0f             	and    $0xf,%edx
+  801384:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801389:	83 fa 06             	cmp    $0x6,%edx
+  80138c:	74 0e                	je     80139c <sys_env_set_status+0x7a>
+  80138e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801391:	0f b6 c9             	movzbl %cl,%ecx
+  801394:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80139a:	eb 98                	jmp    801334 <sys_env_set_status+0x12>
+  80139c:	89 c2                	mov    %eax,%edx
+  80139e:	c1 ea 04             	shr    $0x4,%edx
+  8013a1:	83 e2 0f             	and    $0xf,%edx
+  8013a4:	83 fa 02             	cmp    $0x2,%edx
+  8013a7:	77 e5                	ja     80138e <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  8013a9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013ac:	83 f8 02             	cmp    $0x2,%eax
+  8013af:	0f 97 c1             	seta   %cl
+  8013b2:	0f b6 c9             	movzbl %cl,%ecx
+  8013b5:	eb d7                	jmp    80138e <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  8013b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013bc:	b8 08 00 00 00       	mov    $0x8,%eax
+  8013c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c7:	89 df                	mov    %ebx,%edi
+  8013c9:	89 de                	mov    %ebx,%esi
+  8013cb:	cd 30                	int    $0x30
+  8013cd:	eb 90                	jmp    80135f <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013cf:	83 ec 0c             	sub    $0xc,%esp
+  8013d2:	50                   	push   %eax
+  8013d3:	6a 08                	push   $0x8
+  8013d5:	68 79 2b 80 00       	push   $0x802b79
+  8013da:	6a 4a                	push   $0x4a
+  8013dc:	68 96 2b 80 00       	push   $0x802b96
+  8013e1:	e8 0a 12 00 00       	call   8025f0 <_panic>
+
+008013e6 <sys_sysinfo>:
+{
+  8013e6:	55                   	push   %ebp
+  8013e7:	89 e5                	mov    %esp,%ebp
+  8013e9:	57                   	push   %edi
+  8013ea:	56                   	push   %esi
+  8013eb:	53                   	push   %ebx
+  8013ec:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8013ef:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8013f6:	78 36                	js     80142e <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  8013f8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8013ff:	74 79                	je     80147a <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  801401:	8b 55 08             	mov    0x8(%ebp),%edx
+  801404:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801409:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80140e:	89 cb                	mov    %ecx,%ebx
+  801410:	89 cf                	mov    %ecx,%edi
+  801412:	89 ce                	mov    %ecx,%esi
+  801414:	55                   	push   %ebp
+  801415:	68 1e 14 80 00       	push   $0x80141e
+  80141a:	89 e5                	mov    %esp,%ebp
+  80141c:	0f 34                	sysenter
+  80141e:	83 c4 04             	add    $0x4,%esp
+  801421:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801422:	85 c0                	test   %eax,%eax
+  801424:	7f 6b                	jg     801491 <sys_sysinfo+0xab>
+}
+  801426:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801429:	5b                   	pop    %ebx
+  80142a:	5e                   	pop    %esi
+  80142b:	5f                   	pop    %edi
+  80142c:	5d                   	pop    %ebp
+  80142d:	c3                   	ret
+  80142e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801433:	0f a2                	cpuid
+		return 0;
+  801435:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80143a:	f6 c6 08             	test   $0x8,%dh
+  80143d:	74 15                	je     801454 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80143f:	89 c2                	mov    %eax,%edx
+  801441:	c1 ea 08             	shr    $0x8,%edx
+  801444:	83 e2 0f             	and    $0xf,%edx
+  801447:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80144c:	83 fa 06             	cmp    $0x6,%edx
+  80144f:	74 0e                	je     80145f <sys_sysinfo+0x79>
+  801451:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801454:	0f b6 c9             	movzbl %cl,%ecx
+  801457:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80145d:	eb 99                	jmp    8013f8 <sys_sysinfo+0x12>
+  80145f:	89 c2                	mov    %eax,%edx
+  801461:	c1 ea 04             	shr    $0x4,%edx
+  801464:	83 e2 0f             	and    $0xf,%edx
+  801467:	83 fa 02             	cmp    $0x2,%edx
+  80146a:	77 e5                	ja     801451 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  80146c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80146f:	83 f8 02             	cmp    $0x2,%eax
+  801472:	0f 97 c1             	seta   %cl
+  801475:	0f b6 c9             	movzbl %cl,%ecx
+  801478:	eb d7                	jmp    801451 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  80147a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80147f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801484:	8b 55 08             	mov    0x8(%ebp),%edx
+  801487:	89 cb                	mov    %ecx,%ebx
+  801489:	89 cf                	mov    %ecx,%edi
+  80148b:	89 ce                	mov    %ecx,%esi
+  80148d:	cd 30                	int    $0x30
+  80148f:	eb 91                	jmp    801422 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801491:	83 ec 0c             	sub    $0xc,%esp
+  801494:	50                   	push   %eax
+  801495:	6a 0b                	push   $0xb
+  801497:	68 79 2b 80 00       	push   $0x802b79
+  80149c:	6a 4a                	push   $0x4a
+  80149e:	68 96 2b 80 00       	push   $0x802b96
+  8014a3:	e8 48 11 00 00       	call   8025f0 <_panic>
+
+008014a8 <sys_env_set_trapframe>:
+{
+  8014a8:	55                   	push   %ebp
+  8014a9:	89 e5                	mov    %esp,%ebp
+  8014ab:	57                   	push   %edi
+  8014ac:	56                   	push   %esi
+  8014ad:	53                   	push   %ebx
+  8014ae:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8014b1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8014b8:	78 37                	js     8014f1 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  8014ba:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8014c1:	74 7a                	je     80153d <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  8014c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ce:	b8 13 00 00 00       	mov    $0x13,%eax
+  8014d3:	89 df                	mov    %ebx,%edi
+  8014d5:	89 de                	mov    %ebx,%esi
+  8014d7:	55                   	push   %ebp
+  8014d8:	68 e1 14 80 00       	push   $0x8014e1
+  8014dd:	89 e5                	mov    %esp,%ebp
+  8014df:	0f 34                	sysenter
+  8014e1:	83 c4 04             	add    $0x4,%esp
+  8014e4:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8014e5:	85 c0                	test   %eax,%eax
+  8014e7:	7f 6c                	jg     801555 <sys_env_set_trapframe+0xad>
+}
+  8014e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ec:	5b                   	pop    %ebx
+  8014ed:	5e                   	pop    %esi
+  8014ee:	5f                   	pop    %edi
+  8014ef:	5d                   	pop    %ebp
+  8014f0:	c3                   	ret
+  8014f1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014f6:	0f a2                	cpuid
+		return 0;
+  8014f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8014fd:	f6 c6 08             	test   $0x8,%dh
+  801500:	74 15                	je     801517 <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801502:	89 c2                	mov    %eax,%edx
+  801504:	c1 ea 08             	shr    $0x8,%edx
+  801507:	83 e2 0f             	and    $0xf,%edx
+  80150a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80150f:	83 fa 06             	cmp    $0x6,%edx
+  801512:	74 0e                	je     801522 <sys_env_set_trapframe+0x7a>
+  801514:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801517:	0f b6 c9             	movzbl %cl,%ecx
+  80151a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801520:	eb 98                	jmp    8014ba <sys_env_set_trapframe+0x12>
+  801522:	89 c2                	mov    %eax,%edx
+  801524:	c1 ea 04             	shr    $0x4,%edx
+  801527:	83 e2 0f             	and    $0xf,%edx
+  80152a:	83 fa 02             	cmp    $0x2,%edx
+  80152d:	77 e5                	ja     801514 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  80152f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801532:	83 f8 02             	cmp    $0x2,%eax
+  801535:	0f 97 c1             	seta   %cl
+  801538:	0f b6 c9             	movzbl %cl,%ecx
+  80153b:	eb d7                	jmp    801514 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  80153d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801542:	b8 13 00 00 00       	mov    $0x13,%eax
+  801547:	8b 55 08             	mov    0x8(%ebp),%edx
+  80154a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80154d:	89 df                	mov    %ebx,%edi
+  80154f:	89 de                	mov    %ebx,%esi
+  801551:	cd 30                	int    $0x30
+  801553:	eb 90                	jmp    8014e5 <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801555:	83 ec 0c             	sub    $0xc,%esp
+  801558:	50                   	push   %eax
+  801559:	6a 13                	push   $0x13
+  80155b:	68 79 2b 80 00       	push   $0x802b79
+  801560:	6a 4a                	push   $0x4a
+  801562:	68 96 2b 80 00       	push   $0x802b96
+  801567:	e8 84 10 00 00       	call   8025f0 <_panic>
+
+0080156c <sys_env_set_stack_limit>:
+{
+  80156c:	55                   	push   %ebp
+  80156d:	89 e5                	mov    %esp,%ebp
+  80156f:	57                   	push   %edi
+  801570:	56                   	push   %esi
+  801571:	53                   	push   %ebx
+  801572:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801575:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80157c:	78 37                	js     8015b5 <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  80157e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801585:	74 7a                	je     801601 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  801587:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80158c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80158f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801592:	b8 19 00 00 00       	mov    $0x19,%eax
+  801597:	89 df                	mov    %ebx,%edi
+  801599:	89 de                	mov    %ebx,%esi
+  80159b:	55                   	push   %ebp
+  80159c:	68 a5 15 80 00       	push   $0x8015a5
+  8015a1:	89 e5                	mov    %esp,%ebp
+  8015a3:	0f 34                	sysenter
+  8015a5:	83 c4 04             	add    $0x4,%esp
+  8015a8:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8015a9:	85 c0                	test   %eax,%eax
+  8015ab:	7f 6c                	jg     801619 <sys_env_set_stack_limit+0xad>
+}
+  8015ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015b0:	5b                   	pop    %ebx
+  8015b1:	5e                   	pop    %esi
+  8015b2:	5f                   	pop    %edi
+  8015b3:	5d                   	pop    %ebp
+  8015b4:	c3                   	ret
+  8015b5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015ba:	0f a2                	cpuid
+		return 0;
+  8015bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8015c1:	f6 c6 08             	test   $0x8,%dh
+  8015c4:	74 15                	je     8015db <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015c6:	89 c2                	mov    %eax,%edx
+  8015c8:	c1 ea 08             	shr    $0x8,%edx
+  8015cb:	83 e2 0f             	and    $0xf,%edx
+  8015ce:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8015d3:	83 fa 06             	cmp    $0x6,%edx
+  8015d6:	74 0e                	je     8015e6 <sys_env_set_stack_limit+0x7a>
+  8015d8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8015db:	0f b6 c9             	movzbl %cl,%ecx
+  8015de:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8015e4:	eb 98                	jmp    80157e <sys_env_set_stack_limit+0x12>
+  8015e6:	89 c2                	mov    %eax,%edx
+  8015e8:	c1 ea 04             	shr    $0x4,%edx
+  8015eb:	83 e2 0f             	and    $0xf,%edx
+  8015ee:	83 fa 02             	cmp    $0x2,%edx
+  8015f1:	77 e5                	ja     8015d8 <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  8015f3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015f6:	83 f8 02             	cmp    $0x2,%eax
+  8015f9:	0f 97 c1             	seta   %cl
+  8015fc:	0f b6 c9             	movzbl %cl,%ecx
+  8015ff:	eb d7                	jmp    8015d8 <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  801601:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801606:	b8 19 00 00 00       	mov    $0x19,%eax
+  80160b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80160e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801611:	89 df                	mov    %ebx,%edi
+  801613:	89 de                	mov    %ebx,%esi
+  801615:	cd 30                	int    $0x30
+  801617:	eb 90                	jmp    8015a9 <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801619:	83 ec 0c             	sub    $0xc,%esp
+  80161c:	50                   	push   %eax
+  80161d:	6a 19                	push   $0x19
+  80161f:	68 79 2b 80 00       	push   $0x802b79
+  801624:	6a 4a                	push   $0x4a
+  801626:	68 96 2b 80 00       	push   $0x802b96
+  80162b:	e8 c0 0f 00 00       	call   8025f0 <_panic>
+
+00801630 <sys_env_set_pgfault_upcall>:
+{
+  801630:	55                   	push   %ebp
+  801631:	89 e5                	mov    %esp,%ebp
+  801633:	57                   	push   %edi
+  801634:	56                   	push   %esi
+  801635:	53                   	push   %ebx
+  801636:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801639:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801640:	78 37                	js     801679 <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  801642:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801649:	74 7a                	je     8016c5 <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  80164b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801650:	8b 55 08             	mov    0x8(%ebp),%edx
+  801653:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801656:	b8 09 00 00 00       	mov    $0x9,%eax
+  80165b:	89 df                	mov    %ebx,%edi
+  80165d:	89 de                	mov    %ebx,%esi
+  80165f:	55                   	push   %ebp
+  801660:	68 69 16 80 00       	push   $0x801669
+  801665:	89 e5                	mov    %esp,%ebp
+  801667:	0f 34                	sysenter
+  801669:	83 c4 04             	add    $0x4,%esp
+  80166c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80166d:	85 c0                	test   %eax,%eax
+  80166f:	7f 6c                	jg     8016dd <sys_env_set_pgfault_upcall+0xad>
+}
+  801671:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801674:	5b                   	pop    %ebx
+  801675:	5e                   	pop    %esi
+  801676:	5f                   	pop    %edi
+  801677:	5d                   	pop    %ebp
+  801678:	c3                   	ret
+  801679:	b8 01 00 00 00       	mov    $0x1,%eax
+  80167e:	0f a2                	cpuid
+		return 0;
+  801680:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801685:	f6 c6 08             	test   $0x8,%dh
+  801688:	74 15                	je     80169f <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80168a:	89 c2                	mov    %eax,%edx
+  80168c:	c1 ea 08             	shr    $0x8,%edx
+  80168f:	83 e2 0f             	and    $0xf,%edx
+  801692:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801697:	83 fa 06             	cmp    $0x6,%edx
+  80169a:	74 0e                	je     8016aa <sys_env_set_pgfault_upcall+0x7a>
+  80169c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80169f:	0f b6 c9             	movzbl %cl,%ecx
+  8016a2:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8016a8:	eb 98                	jmp    801642 <sys_env_set_pgfault_upcall+0x12>
+  8016aa:	89 c2                	mov    %eax,%edx
+  8016ac:	c1 ea 04             	shr    $0x4,%edx
+  8016af:	83 e2 0f             	and    $0xf,%edx
+  8016b2:	83 fa 02             	cmp    $0x2,%edx
+  8016b5:	77 e5                	ja     80169c <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  8016b7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016ba:	83 f8 02             	cmp    $0x2,%eax
+  8016bd:	0f 97 c1             	seta   %cl
+  8016c0:	0f b6 c9             	movzbl %cl,%ecx
+  8016c3:	eb d7                	jmp    80169c <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  8016c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016ca:	b8 09 00 00 00       	mov    $0x9,%eax
+  8016cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016d5:	89 df                	mov    %ebx,%edi
+  8016d7:	89 de                	mov    %ebx,%esi
+  8016d9:	cd 30                	int    $0x30
+  8016db:	eb 90                	jmp    80166d <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016dd:	83 ec 0c             	sub    $0xc,%esp
+  8016e0:	50                   	push   %eax
+  8016e1:	6a 09                	push   $0x9
+  8016e3:	68 79 2b 80 00       	push   $0x802b79
+  8016e8:	6a 4a                	push   $0x4a
+  8016ea:	68 96 2b 80 00       	push   $0x802b96
+  8016ef:	e8 fc 0e 00 00       	call   8025f0 <_panic>
+
+008016f4 <sys_ipc_try_send>:
+{
+  8016f4:	55                   	push   %ebp
+  8016f5:	89 e5                	mov    %esp,%ebp
+  8016f7:	57                   	push   %edi
+  8016f8:	56                   	push   %esi
+  8016f9:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8016fa:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801701:	78 32                	js     801735 <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  801703:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80170a:	74 75                	je     801781 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  80170c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80170f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801712:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801717:	be 00 00 00 00       	mov    $0x0,%esi
+  80171c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80171f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801722:	55                   	push   %ebp
+  801723:	68 2c 17 80 00       	push   $0x80172c
+  801728:	89 e5                	mov    %esp,%ebp
+  80172a:	0f 34                	sysenter
+  80172c:	83 c4 04             	add    $0x4,%esp
+  80172f:	5d                   	pop    %ebp
+}
+  801730:	5b                   	pop    %ebx
+  801731:	5e                   	pop    %esi
+  801732:	5f                   	pop    %edi
+  801733:	5d                   	pop    %ebp
+  801734:	c3                   	ret
+  801735:	b8 01 00 00 00       	mov    $0x1,%eax
+  80173a:	0f a2                	cpuid
+		return 0;
+  80173c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801741:	f6 c6 08             	test   $0x8,%dh
+  801744:	74 15                	je     80175b <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801746:	89 c2                	mov    %eax,%edx
+  801748:	c1 ea 08             	shr    $0x8,%edx
+  80174b:	83 e2 0f             	and    $0xf,%edx
+  80174e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801753:	83 fa 06             	cmp    $0x6,%edx
+  801756:	74 0e                	je     801766 <sys_ipc_try_send+0x72>
+  801758:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80175b:	0f b6 c9             	movzbl %cl,%ecx
+  80175e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801764:	eb 9d                	jmp    801703 <sys_ipc_try_send+0xf>
+  801766:	89 c2                	mov    %eax,%edx
+  801768:	c1 ea 04             	shr    $0x4,%edx
+  80176b:	83 e2 0f             	and    $0xf,%edx
+  80176e:	83 fa 02             	cmp    $0x2,%edx
+  801771:	77 e5                	ja     801758 <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  801773:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801776:	83 f8 02             	cmp    $0x2,%eax
+  801779:	0f 97 c1             	seta   %cl
+  80177c:	0f b6 c9             	movzbl %cl,%ecx
+  80177f:	eb d7                	jmp    801758 <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  801781:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801786:	be 00 00 00 00       	mov    $0x0,%esi
+  80178b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80178e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801791:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801794:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801797:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801799:	eb 95                	jmp    801730 <sys_ipc_try_send+0x3c>
+
+0080179b <sys_ipc_send>:
+{
+  80179b:	55                   	push   %ebp
+  80179c:	89 e5                	mov    %esp,%ebp
+  80179e:	57                   	push   %edi
+  80179f:	56                   	push   %esi
+  8017a0:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8017a1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8017a8:	78 32                	js     8017dc <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  8017aa:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8017b1:	74 75                	je     801828 <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  8017b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017b9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8017be:	be 00 00 00 00       	mov    $0x0,%esi
+  8017c3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017c6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8017c9:	55                   	push   %ebp
+  8017ca:	68 d3 17 80 00       	push   $0x8017d3
+  8017cf:	89 e5                	mov    %esp,%ebp
+  8017d1:	0f 34                	sysenter
+  8017d3:	83 c4 04             	add    $0x4,%esp
+  8017d6:	5d                   	pop    %ebp
+}
+  8017d7:	5b                   	pop    %ebx
+  8017d8:	5e                   	pop    %esi
+  8017d9:	5f                   	pop    %edi
+  8017da:	5d                   	pop    %ebp
+  8017db:	c3                   	ret
+  8017dc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8017e1:	0f a2                	cpuid
+		return 0;
+  8017e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8017e8:	f6 c6 08             	test   $0x8,%dh
+  8017eb:	74 15                	je     801802 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017ed:	89 c2                	mov    %eax,%edx
+  8017ef:	c1 ea 08             	shr    $0x8,%edx
+  8017f2:	83 e2 0f             	and    $0xf,%edx
+  8017f5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017fa:	83 fa 06             	cmp    $0x6,%edx
+  8017fd:	74 0e                	je     80180d <sys_ipc_send+0x72>
+  8017ff:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801802:	0f b6 c9             	movzbl %cl,%ecx
+  801805:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80180b:	eb 9d                	jmp    8017aa <sys_ipc_send+0xf>
+  80180d:	89 c2                	mov    %eax,%edx
+  80180f:	c1 ea 04             	shr    $0x4,%edx
+  801812:	83 e2 0f             	and    $0xf,%edx
+  801815:	83 fa 02             	cmp    $0x2,%edx
+  801818:	77 e5                	ja     8017ff <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  80181a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80181d:	83 f8 02             	cmp    $0x2,%eax
+  801820:	0f 97 c1             	seta   %cl
+  801823:	0f b6 c9             	movzbl %cl,%ecx
+  801826:	eb d7                	jmp    8017ff <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  801828:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80182d:	be 00 00 00 00       	mov    $0x0,%esi
+  801832:	8b 55 08             	mov    0x8(%ebp),%edx
+  801835:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801838:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80183b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80183e:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801840:	eb 95                	jmp    8017d7 <sys_ipc_send+0x3c>
+
+00801842 <sys_ipc_recv>:
+{
+  801842:	55                   	push   %ebp
+  801843:	89 e5                	mov    %esp,%ebp
+  801845:	57                   	push   %edi
+  801846:	56                   	push   %esi
+  801847:	53                   	push   %ebx
+  801848:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80184b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801852:	78 36                	js     80188a <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  801854:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80185b:	74 79                	je     8018d6 <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  80185d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801860:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801865:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80186a:	89 cb                	mov    %ecx,%ebx
+  80186c:	89 cf                	mov    %ecx,%edi
+  80186e:	89 ce                	mov    %ecx,%esi
+  801870:	55                   	push   %ebp
+  801871:	68 7a 18 80 00       	push   $0x80187a
+  801876:	89 e5                	mov    %esp,%ebp
+  801878:	0f 34                	sysenter
+  80187a:	83 c4 04             	add    $0x4,%esp
+  80187d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80187e:	85 c0                	test   %eax,%eax
+  801880:	7f 6b                	jg     8018ed <sys_ipc_recv+0xab>
+}
+  801882:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801885:	5b                   	pop    %ebx
+  801886:	5e                   	pop    %esi
+  801887:	5f                   	pop    %edi
+  801888:	5d                   	pop    %ebp
+  801889:	c3                   	ret
+  80188a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80188f:	0f a2                	cpuid
+		return 0;
+  801891:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801896:	f6 c6 08             	test   $0x8,%dh
+  801899:	74 15                	je     8018b0 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80189b:	89 c2                	mov    %eax,%edx
+  80189d:	c1 ea 08             	shr    $0x8,%edx
+  8018a0:	83 e2 0f             	and    $0xf,%edx
+  8018a3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018a8:	83 fa 06             	cmp    $0x6,%edx
+  8018ab:	74 0e                	je     8018bb <sys_ipc_recv+0x79>
+  8018ad:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8018b0:	0f b6 c9             	movzbl %cl,%ecx
+  8018b3:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8018b9:	eb 99                	jmp    801854 <sys_ipc_recv+0x12>
+  8018bb:	89 c2                	mov    %eax,%edx
+  8018bd:	c1 ea 04             	shr    $0x4,%edx
+  8018c0:	83 e2 0f             	and    $0xf,%edx
+  8018c3:	83 fa 02             	cmp    $0x2,%edx
+  8018c6:	77 e5                	ja     8018ad <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  8018c8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018cb:	83 f8 02             	cmp    $0x2,%eax
+  8018ce:	0f 97 c1             	seta   %cl
+  8018d1:	0f b6 c9             	movzbl %cl,%ecx
+  8018d4:	eb d7                	jmp    8018ad <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  8018d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018db:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8018e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018e3:	89 cb                	mov    %ecx,%ebx
+  8018e5:	89 cf                	mov    %ecx,%edi
+  8018e7:	89 ce                	mov    %ecx,%esi
+  8018e9:	cd 30                	int    $0x30
+  8018eb:	eb 91                	jmp    80187e <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8018ed:	83 ec 0c             	sub    $0xc,%esp
+  8018f0:	50                   	push   %eax
+  8018f1:	6a 0d                	push   $0xd
+  8018f3:	68 79 2b 80 00       	push   $0x802b79
+  8018f8:	6a 4a                	push   $0x4a
+  8018fa:	68 96 2b 80 00       	push   $0x802b96
+  8018ff:	e8 ec 0c 00 00       	call   8025f0 <_panic>
+
+00801904 <sys_ipc_send_range>:
+{
+  801904:	55                   	push   %ebp
+  801905:	89 e5                	mov    %esp,%ebp
+  801907:	57                   	push   %edi
+  801908:	56                   	push   %esi
+  801909:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80190a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801911:	78 30                	js     801943 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  801913:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80191a:	74 73                	je     80198f <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  80191c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80191f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801922:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801927:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80192a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80192d:	8b 75 18             	mov    0x18(%ebp),%esi
+  801930:	55                   	push   %ebp
+  801931:	68 3a 19 80 00       	push   $0x80193a
+  801936:	89 e5                	mov    %esp,%ebp
+  801938:	0f 34                	sysenter
+  80193a:	83 c4 04             	add    $0x4,%esp
+  80193d:	5d                   	pop    %ebp
+}
+  80193e:	5b                   	pop    %ebx
+  80193f:	5e                   	pop    %esi
+  801940:	5f                   	pop    %edi
+  801941:	5d                   	pop    %ebp
+  801942:	c3                   	ret
+  801943:	b8 01 00 00 00       	mov    $0x1,%eax
+  801948:	0f a2                	cpuid
+		return 0;
+  80194a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80194f:	f6 c6 08             	test   $0x8,%dh
+  801952:	74 15                	je     801969 <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801954:	89 c2                	mov    %eax,%edx
+  801956:	c1 ea 08             	shr    $0x8,%edx
+  801959:	83 e2 0f             	and    $0xf,%edx
+  80195c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801961:	83 fa 06             	cmp    $0x6,%edx
+  801964:	74 0e                	je     801974 <sys_ipc_send_range+0x70>
+  801966:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801969:	0f b6 c9             	movzbl %cl,%ecx
+  80196c:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801972:	eb 9f                	jmp    801913 <sys_ipc_send_range+0xf>
+  801974:	89 c2                	mov    %eax,%edx
+  801976:	c1 ea 04             	shr    $0x4,%edx
+  801979:	83 e2 0f             	and    $0xf,%edx
+  80197c:	83 fa 02             	cmp    $0x2,%edx
+  80197f:	77 e5                	ja     801966 <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  801981:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801984:	83 f8 02             	cmp    $0x2,%eax
+  801987:	0f 97 c1             	seta   %cl
+  80198a:	0f b6 c9             	movzbl %cl,%ecx
+  80198d:	eb d7                	jmp    801966 <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  80198f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801994:	8b 55 08             	mov    0x8(%ebp),%edx
+  801997:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80199a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80199d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8019a0:	8b 75 18             	mov    0x18(%ebp),%esi
+  8019a3:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  8019a5:	eb 97                	jmp    80193e <sys_ipc_send_range+0x3a>
+
+008019a7 <sys_ipc_recv_range>:
+{
+  8019a7:	55                   	push   %ebp
+  8019a8:	89 e5                	mov    %esp,%ebp
+  8019aa:	57                   	push   %edi
+  8019ab:	56                   	push   %esi
+  8019ac:	53                   	push   %ebx
+  8019ad:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8019b0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8019b7:	78 37                	js     8019f0 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  8019b9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8019c0:	74 7a                	je     801a3c <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  8019c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019cd:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8019d2:	89 df                	mov    %ebx,%edi
+  8019d4:	89 de                	mov    %ebx,%esi
+  8019d6:	55                   	push   %ebp
+  8019d7:	68 e0 19 80 00       	push   $0x8019e0
+  8019dc:	89 e5                	mov    %esp,%ebp
+  8019de:	0f 34                	sysenter
+  8019e0:	83 c4 04             	add    $0x4,%esp
+  8019e3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8019e4:	85 c0                	test   %eax,%eax
+  8019e6:	7f 6c                	jg     801a54 <sys_ipc_recv_range+0xad>
+}
+  8019e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019eb:	5b                   	pop    %ebx
+  8019ec:	5e                   	pop    %esi
+  8019ed:	5f                   	pop    %edi
+  8019ee:	5d                   	pop    %ebp
+  8019ef:	c3                   	ret
+  8019f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019f5:	0f a2                	cpuid
+		return 0;
+  8019f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8019fc:	f6 c6 08             	test   $0x8,%dh
+  8019ff:	74 15                	je     801a16 <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a01:	89 c2                	mov    %eax,%edx
+  801a03:	c1 ea 08             	shr    $0x8,%edx
+  801a06:	83 e2 0f             	and    $0xf,%edx
+  801a09:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a0e:	83 fa 06             	cmp    $0x6,%edx
+  801a11:	74 0e                	je     801a21 <sys_ipc_recv_range+0x7a>
+  801a13:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a16:	0f b6 c9             	movzbl %cl,%ecx
+  801a19:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801a1f:	eb 98                	jmp    8019b9 <sys_ipc_recv_range+0x12>
+  801a21:	89 c2                	mov    %eax,%edx
+  801a23:	c1 ea 04             	shr    $0x4,%edx
+  801a26:	83 e2 0f             	and    $0xf,%edx
+  801a29:	83 fa 02             	cmp    $0x2,%edx
+  801a2c:	77 e5                	ja     801a13 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801a2e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a31:	83 f8 02             	cmp    $0x2,%eax
+  801a34:	0f 97 c1             	seta   %cl
+  801a37:	0f b6 c9             	movzbl %cl,%ecx
+  801a3a:	eb d7                	jmp    801a13 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801a3c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a41:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801a46:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a49:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a4c:	89 df                	mov    %ebx,%edi
+  801a4e:	89 de                	mov    %ebx,%esi
+  801a50:	cd 30                	int    $0x30
+  801a52:	eb 90                	jmp    8019e4 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a54:	83 ec 0c             	sub    $0xc,%esp
+  801a57:	50                   	push   %eax
+  801a58:	6a 1f                	push   $0x1f
+  801a5a:	68 79 2b 80 00       	push   $0x802b79
+  801a5f:	6a 4a                	push   $0x4a
+  801a61:	68 96 2b 80 00       	push   $0x802b96
+  801a66:	e8 85 0b 00 00       	call   8025f0 <_panic>
+
+00801a6b <sys_ipc_call>:
+{
+  801a6b:	55                   	push   %ebp
+  801a6c:	89 e5                	mov    %esp,%ebp
+  801a6e:	57                   	push   %edi
+  801a6f:	56                   	push   %esi
+  801a70:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801a71:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a74:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801a79:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801a7c:	55                   	push   %ebp
+  801a7d:	56                   	push   %esi
+  801a7e:	8b 0e                	mov    (%esi),%ecx
+  801a80:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801a83:	8b 7e 08             	mov    0x8(%esi),%edi
+  801a86:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801a89:	8b 76 0c             	mov    0xc(%esi),%esi
+  801a8c:	cd 30                	int    $0x30
+  801a8e:	87 34 24             	xchg   %esi,(%esp)
+  801a91:	89 0e                	mov    %ecx,(%esi)
+  801a93:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801a96:	89 7e 08             	mov    %edi,0x8(%esi)
+  801a99:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801a9c:	8f 46 0c             	pop    0xc(%esi)
+  801a9f:	5d                   	pop    %ebp
+}
+  801aa0:	5b                   	pop    %ebx
+  801aa1:	5e                   	pop    %esi
+  801aa2:	5f                   	pop    %edi
+  801aa3:	5d                   	pop    %ebp
+  801aa4:	c3                   	ret
+
+00801aa5 <sys_ipc_reply_wait>:
+{
+  801aa5:	55                   	push   %ebp
+  801aa6:	89 e5                	mov    %esp,%ebp
+  801aa8:	57                   	push   %edi
+  801aa9:	56                   	push   %esi
+  801aaa:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801aab:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aae:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801ab3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801ab6:	55                   	push   %ebp
+  801ab7:	56                   	push   %esi
+  801ab8:	8b 0e                	mov    (%esi),%ecx
+  801aba:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801abd:	8b 7e 08             	mov    0x8(%esi),%edi
+  801ac0:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801ac3:	8b 76 0c             	mov    0xc(%esi),%esi
+  801ac6:	cd 30                	int    $0x30
+  801ac8:	87 34 24             	xchg   %esi,(%esp)
+  801acb:	89 0e                	mov    %ecx,(%esi)
+  801acd:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801ad0:	89 7e 08             	mov    %edi,0x8(%esi)
+  801ad3:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801ad6:	8f 46 0c             	pop    0xc(%esi)
+  801ad9:	5d                   	pop    %ebp
+}
+  801ada:	5b                   	pop    %ebx
+  801adb:	5e                   	pop    %esi
+  801adc:	5f                   	pop    %edi
+  801add:	5d                   	pop    %ebp
+  801ade:	c3                   	ret
+
+00801adf <sys_ipc_send_msg>:
+{
+  801adf:	55                   	push   %ebp
+  801ae0:	89 e5                	mov    %esp,%ebp
+  801ae2:	57                   	push   %edi
+  801ae3:	56                   	push   %esi
+  801ae4:	53                   	push   %ebx
+  801ae5:	83 ec 20             	sub    $0x20,%esp
+  801ae8:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801aeb:	8b 10                	mov    (%eax),%edx
+  801aed:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801af0:	8b 50 04             	mov    0x4(%eax),%edx
+  801af3:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801af6:	8b 50 08             	mov    0x8(%eax),%edx
+  801af9:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801afc:	8b 50 0c             	mov    0xc(%eax),%edx
+  801aff:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801b02:	8b 40 10             	mov    0x10(%eax),%eax
+  801b05:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801b08:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801b0b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b0e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801b13:	55                   	push   %ebp
+  801b14:	56                   	push   %esi
+  801b15:	8b 0e                	mov    (%esi),%ecx
+  801b17:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801b1a:	8b 7e 08             	mov    0x8(%esi),%edi
+  801b1d:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801b20:	8b 76 0c             	mov    0xc(%esi),%esi
+  801b23:	cd 30                	int    $0x30
+  801b25:	87 34 24             	xchg   %esi,(%esp)
+  801b28:	89 0e                	mov    %ecx,(%esi)
+  801b2a:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801b2d:	89 7e 08             	mov    %edi,0x8(%esi)
+  801b30:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801b33:	8f 46 0c             	pop    0xc(%esi)
+  801b36:	5d                   	pop    %ebp
+}
+  801b37:	83 c4 20             	add    $0x20,%esp
+  801b3a:	5b                   	pop    %ebx
+  801b3b:	5e                   	pop    %esi
+  801b3c:	5f                   	pop    %edi
+  801b3d:	5d                   	pop    %ebp
+  801b3e:	c3                   	ret
+
+00801b3f <sys_fork>:
+{
+  801b3f:	55                   	push   %ebp
+  801b40:	89 e5                	mov    %esp,%ebp
+  801b42:	57                   	push   %edi
+  801b43:	56                   	push   %esi
+  801b44:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801b45:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b4c:	78 2e                	js     801b7c <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801b4e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b55:	74 71                	je     801bc8 <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801b57:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b5c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801b61:	89 d1                	mov    %edx,%ecx
+  801b63:	89 d3                	mov    %edx,%ebx
+  801b65:	89 d7                	mov    %edx,%edi
+  801b67:	89 d6                	mov    %edx,%esi
+  801b69:	55                   	push   %ebp
+  801b6a:	68 73 1b 80 00       	push   $0x801b73
+  801b6f:	89 e5                	mov    %esp,%ebp
+  801b71:	0f 34                	sysenter
+  801b73:	83 c4 04             	add    $0x4,%esp
+  801b76:	5d                   	pop    %ebp
+}
+  801b77:	5b                   	pop    %ebx
+  801b78:	5e                   	pop    %esi
+  801b79:	5f                   	pop    %edi
+  801b7a:	5d                   	pop    %ebp
+  801b7b:	c3                   	ret
+  801b7c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b81:	0f a2                	cpuid
+		return 0;
+  801b83:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b88:	f6 c6 08             	test   $0x8,%dh
+  801b8b:	74 15                	je     801ba2 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b8d:	89 c2                	mov    %eax,%edx
+  801b8f:	c1 ea 08             	shr    $0x8,%edx
+  801b92:	83 e2 0f             	and    $0xf,%edx
+  801b95:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b9a:	83 fa 06             	cmp    $0x6,%edx
+  801b9d:	74 0e                	je     801bad <sys_fork+0x6e>
+  801b9f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801ba2:	0f b6 c9             	movzbl %cl,%ecx
+  801ba5:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801bab:	eb a1                	jmp    801b4e <sys_fork+0xf>
+  801bad:	89 c2                	mov    %eax,%edx
+  801baf:	c1 ea 04             	shr    $0x4,%edx
+  801bb2:	83 e2 0f             	and    $0xf,%edx
+  801bb5:	83 fa 02             	cmp    $0x2,%edx
+  801bb8:	77 e5                	ja     801b9f <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801bba:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bbd:	83 f8 02             	cmp    $0x2,%eax
+  801bc0:	0f 97 c1             	seta   %cl
+  801bc3:	0f b6 c9             	movzbl %cl,%ecx
+  801bc6:	eb d7                	jmp    801b9f <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801bc8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bcd:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801bd2:	89 d1                	mov    %edx,%ecx
+  801bd4:	89 d3                	mov    %edx,%ebx
+  801bd6:	89 d7                	mov    %edx,%edi
+  801bd8:	89 d6                	mov    %edx,%esi
+  801bda:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801bdc:	eb 99                	jmp    801b77 <sys_fork+0x38>
+
+00801bde <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801bde:	55                   	push   %ebp
+  801bdf:	89 e5                	mov    %esp,%ebp
+  801be1:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801be4:	ff 75 14             	push   0x14(%ebp)
+  801be7:	ff 75 10             	push   0x10(%ebp)
+  801bea:	ff 75 0c             	push   0xc(%ebp)
+  801bed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bf2:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bf5:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801bfa:	e8 81 ee ff ff       	call   800a80 <page_vec_call>
+}
+  801bff:	c9                   	leave
+  801c00:	c3                   	ret
+
+00801c01 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801c01:	55                   	push   %ebp
+  801c02:	89 e5                	mov    %esp,%ebp
+  801c04:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801c07:	ff 75 18             	push   0x18(%ebp)
+  801c0a:	ff 75 14             	push   0x14(%ebp)
+  801c0d:	ff 75 10             	push   0x10(%ebp)
+  801c10:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c13:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c16:	b8 10 00 00 00       	mov    $0x10,%eax
+  801c1b:	e8 60 ee ff ff       	call   800a80 <page_vec_call>
+}
+  801c20:	c9                   	leave
+  801c21:	c3                   	ret
+
+00801c22 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801c22:	55                   	push   %ebp
+  801c23:	89 e5                	mov    %esp,%ebp
+  801c25:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801c28:	ff 75 14             	push   0x14(%ebp)
+  801c2b:	ff 75 10             	push   0x10(%ebp)
+  801c2e:	ff 75 0c             	push   0xc(%ebp)
+  801c31:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c36:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c39:	b8 11 00 00 00       	mov    $0x11,%eax
+  801c3e:	e8 3d ee ff ff       	call   800a80 <page_vec_call>
+}
+  801c43:	c9                   	leave
+  801c44:	c3                   	ret
+
+00801c45 <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801c45:	55                   	push   %ebp
+  801c46:	89 e5                	mov    %esp,%ebp
+  801c48:	57                   	push   %edi
+  801c49:	56                   	push   %esi
+  801c4a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801c4b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801c52:	78 32                	js     801c86 <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801c54:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801c5b:	74 75                	je     801cd2 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801c5d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c60:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c63:	b8 12 00 00 00       	mov    $0x12,%eax
+  801c68:	be 00 00 00 00       	mov    $0x0,%esi
+  801c6d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801c70:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801c73:	55                   	push   %ebp
+  801c74:	68 7d 1c 80 00       	push   $0x801c7d
+  801c79:	89 e5                	mov    %esp,%ebp
+  801c7b:	0f 34                	sysenter
+  801c7d:	83 c4 04             	add    $0x4,%esp
+  801c80:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801c81:	5b                   	pop    %ebx
+  801c82:	5e                   	pop    %esi
+  801c83:	5f                   	pop    %edi
+  801c84:	5d                   	pop    %ebp
+  801c85:	c3                   	ret
+  801c86:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c8b:	0f a2                	cpuid
+		return 0;
+  801c8d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801c92:	f6 c6 08             	test   $0x8,%dh
+  801c95:	74 15                	je     801cac <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c97:	89 c2                	mov    %eax,%edx
+  801c99:	c1 ea 08             	shr    $0x8,%edx
+  801c9c:	83 e2 0f             	and    $0xf,%edx
+  801c9f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ca4:	83 fa 06             	cmp    $0x6,%edx
+  801ca7:	74 0e                	je     801cb7 <sys_vm_ranges+0x72>
+  801ca9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801cac:	0f b6 c9             	movzbl %cl,%ecx
+  801caf:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801cb5:	eb 9d                	jmp    801c54 <sys_vm_ranges+0xf>
+  801cb7:	89 c2                	mov    %eax,%edx
+  801cb9:	c1 ea 04             	shr    $0x4,%edx
+  801cbc:	83 e2 0f             	and    $0xf,%edx
+  801cbf:	83 fa 02             	cmp    $0x2,%edx
+  801cc2:	77 e5                	ja     801ca9 <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  801cc4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801cc7:	83 f8 02             	cmp    $0x2,%eax
+  801cca:	0f 97 c1             	seta   %cl
+  801ccd:	0f b6 c9             	movzbl %cl,%ecx
+  801cd0:	eb d7                	jmp    801ca9 <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801cd2:	b8 12 00 00 00       	mov    $0x12,%eax
+  801cd7:	be 00 00 00 00       	mov    $0x0,%esi
+  801cdc:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cdf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ce2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ce5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ce8:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801cea:	eb 95                	jmp    801c81 <sys_vm_ranges+0x3c>
+
+00801cec <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801cec:	55                   	push   %ebp
+  801ced:	89 e5                	mov    %esp,%ebp
+  801cef:	57                   	push   %edi
+  801cf0:	56                   	push   %esi
+  801cf1:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801cf2:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801cf9:	78 31                	js     801d2c <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801cfb:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801d02:	74 74                	je     801d78 <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801d04:	be 00 00 00 00       	mov    $0x0,%esi
+  801d09:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d0c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d0f:	b8 14 00 00 00       	mov    $0x14,%eax
+  801d14:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d17:	89 f7                	mov    %esi,%edi
+  801d19:	55                   	push   %ebp
+  801d1a:	68 23 1d 80 00       	push   $0x801d23
+  801d1f:	89 e5                	mov    %esp,%ebp
+  801d21:	0f 34                	sysenter
+  801d23:	83 c4 04             	add    $0x4,%esp
+  801d26:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801d27:	5b                   	pop    %ebx
+  801d28:	5e                   	pop    %esi
+  801d29:	5f                   	pop    %edi
+  801d2a:	5d                   	pop    %ebp
+  801d2b:	c3                   	ret
+  801d2c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d31:	0f a2                	cpuid
+		return 0;
+  801d33:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801d38:	f6 c6 08             	test   $0x8,%dh
+  801d3b:	74 15                	je     801d52 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d3d:	89 c2                	mov    %eax,%edx
+  801d3f:	c1 ea 08             	shr    $0x8,%edx
+  801d42:	83 e2 0f             	and    $0xf,%edx
+  801d45:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d4a:	83 fa 06             	cmp    $0x6,%edx
+  801d4d:	74 0e                	je     801d5d <sys_spawn+0x71>
+  801d4f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801d52:	0f b6 c9             	movzbl %cl,%ecx
+  801d55:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801d5b:	eb 9e                	jmp    801cfb <sys_spawn+0xf>
+  801d5d:	89 c2                	mov    %eax,%edx
+  801d5f:	c1 ea 04             	shr    $0x4,%edx
+  801d62:	83 e2 0f             	and    $0xf,%edx
+  801d65:	83 fa 02             	cmp    $0x2,%edx
+  801d68:	77 e5                	ja     801d4f <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  801d6a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d6d:	83 f8 02             	cmp    $0x2,%eax
+  801d70:	0f 97 c1             	seta   %cl
+  801d73:	0f b6 c9             	movzbl %cl,%ecx
+  801d76:	eb d7                	jmp    801d4f <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  801d78:	be 00 00 00 00       	mov    $0x0,%esi
+  801d7d:	b8 14 00 00 00       	mov    $0x14,%eax
+  801d82:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d85:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d88:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d8b:	89 f7                	mov    %esi,%edi
+  801d8d:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  801d8f:	eb 96                	jmp    801d27 <sys_spawn+0x3b>
+
+00801d91 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  801d91:	55                   	push   %ebp
+  801d92:	89 e5                	mov    %esp,%ebp
+  801d94:	57                   	push   %edi
+  801d95:	56                   	push   %esi
+  801d96:	53                   	push   %ebx
+  801d97:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801d9a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801da1:	78 37                	js     801dda <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  801da3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801daa:	74 7a                	je     801e26 <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  801dac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801db1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801db4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801db7:	b8 15 00 00 00       	mov    $0x15,%eax
+  801dbc:	89 df                	mov    %ebx,%edi
+  801dbe:	89 de                	mov    %ebx,%esi
+  801dc0:	55                   	push   %ebp
+  801dc1:	68 ca 1d 80 00       	push   $0x801dca
+  801dc6:	89 e5                	mov    %esp,%ebp
+  801dc8:	0f 34                	sysenter
+  801dca:	83 c4 04             	add    $0x4,%esp
+  801dcd:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801dce:	85 c0                	test   %eax,%eax
+  801dd0:	7f 6c                	jg     801e3e <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  801dd2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dd5:	5b                   	pop    %ebx
+  801dd6:	5e                   	pop    %esi
+  801dd7:	5f                   	pop    %edi
+  801dd8:	5d                   	pop    %ebp
+  801dd9:	c3                   	ret
+  801dda:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ddf:	0f a2                	cpuid
+		return 0;
+  801de1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801de6:	f6 c6 08             	test   $0x8,%dh
+  801de9:	74 15                	je     801e00 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801deb:	89 c2                	mov    %eax,%edx
+  801ded:	c1 ea 08             	shr    $0x8,%edx
+  801df0:	83 e2 0f             	and    $0xf,%edx
+  801df3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801df8:	83 fa 06             	cmp    $0x6,%edx
+  801dfb:	74 0e                	je     801e0b <sys_shm_create+0x7a>
+  801dfd:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801e00:	0f b6 c9             	movzbl %cl,%ecx
+  801e03:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801e09:	eb 98                	jmp    801da3 <sys_shm_create+0x12>
+  801e0b:	89 c2                	mov    %eax,%edx
+  801e0d:	c1 ea 04             	shr    $0x4,%edx
+  801e10:	83 e2 0f             	and    $0xf,%edx
+  801e13:	83 fa 02             	cmp    $0x2,%edx
+  801e16:	77 e5                	ja     801dfd <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  801e18:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e1b:	83 f8 02             	cmp    $0x2,%eax
+  801e1e:	0f 97 c1             	seta   %cl
+  801e21:	0f b6 c9             	movzbl %cl,%ecx
+  801e24:	eb d7                	jmp    801dfd <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  801e26:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e2b:	b8 15 00 00 00       	mov    $0x15,%eax
+  801e30:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e33:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e36:	89 df                	mov    %ebx,%edi
+  801e38:	89 de                	mov    %ebx,%esi
+  801e3a:	cd 30                	int    $0x30
+  801e3c:	eb 90                	jmp    801dce <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801e3e:	83 ec 0c             	sub    $0xc,%esp
+  801e41:	50                   	push   %eax
+  801e42:	6a 15                	push   $0x15
+  801e44:	68 79 2b 80 00       	push   $0x802b79
+  801e49:	6a 4a                	push   $0x4a
+  801e4b:	68 96 2b 80 00       	push   $0x802b96
+  801e50:	e8 9b 07 00 00       	call   8025f0 <_panic>
+
+00801e55 <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  801e55:	55                   	push   %ebp
+  801e56:	89 e5                	mov    %esp,%ebp
+  801e58:	57                   	push   %edi
+  801e59:	56                   	push   %esi
+  801e5a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801e5b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801e62:	78 32                	js     801e96 <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  801e64:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801e6b:	74 75                	je     801ee2 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801e6d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e70:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e73:	b8 16 00 00 00       	mov    $0x16,%eax
+  801e78:	be 00 00 00 00       	mov    $0x0,%esi
+  801e7d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e80:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801e83:	55                   	push   %ebp
+  801e84:	68 8d 1e 80 00       	push   $0x801e8d
+  801e89:	89 e5                	mov    %esp,%ebp
+  801e8b:	0f 34                	sysenter
+  801e8d:	83 c4 04             	add    $0x4,%esp
+  801e90:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  801e91:	5b                   	pop    %ebx
+  801e92:	5e                   	pop    %esi
+  801e93:	5f                   	pop    %edi
+  801e94:	5d                   	pop    %ebp
+  801e95:	c3                   	ret
+  801e96:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e9b:	0f a2                	cpuid
+		return 0;
+  801e9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801ea2:	f6 c6 08             	test   $0x8,%dh
+  801ea5:	74 15                	je     801ebc <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ea7:	89 c2                	mov    %eax,%edx
+  801ea9:	c1 ea 08             	shr    $0x8,%edx
+  801eac:	83 e2 0f             	and    $0xf,%edx
+  801eaf:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801eb4:	83 fa 06             	cmp    $0x6,%edx
+  801eb7:	74 0e                	je     801ec7 <sys_shm_attach+0x72>
+  801eb9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801ebc:	0f b6 c9             	movzbl %cl,%ecx
+  801ebf:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801ec5:	eb 9d                	jmp    801e64 <sys_shm_attach+0xf>
+  801ec7:	89 c2                	mov    %eax,%edx
+  801ec9:	c1 ea 04             	shr    $0x4,%edx
+  801ecc:	83 e2 0f             	and    $0xf,%edx
+  801ecf:	83 fa 02             	cmp    $0x2,%edx
+  801ed2:	77 e5                	ja     801eb9 <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  801ed4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ed7:	83 f8 02             	cmp    $0x2,%eax
+  801eda:	0f 97 c1             	seta   %cl
+  801edd:	0f b6 c9             	movzbl %cl,%ecx
+  801ee0:	eb d7                	jmp    801eb9 <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  801ee2:	b8 16 00 00 00       	mov    $0x16,%eax
+  801ee7:	be 00 00 00 00       	mov    $0x0,%esi
+  801eec:	8b 55 08             	mov    0x8(%ebp),%edx
+  801eef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ef2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ef5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ef8:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  801efa:	eb 95                	jmp    801e91 <sys_shm_attach+0x3c>
+
+00801efc <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  801efc:	55                   	push   %ebp
+  801efd:	89 e5                	mov    %esp,%ebp
+  801eff:	57                   	push   %edi
+  801f00:	56                   	push   %esi
+  801f01:	53                   	push   %ebx
+  801f02:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801f05:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801f0c:	78 38                	js     801f46 <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  801f0e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801f15:	74 7b                	je     801f92 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  801f17:	be 00 00 00 00       	mov    $0x0,%esi
+  801f1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f1f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f22:	b8 17 00 00 00       	mov    $0x17,%eax
+  801f27:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f2a:	89 f7                	mov    %esi,%edi
+  801f2c:	55                   	push   %ebp
+  801f2d:	68 36 1f 80 00       	push   $0x801f36
+  801f32:	89 e5                	mov    %esp,%ebp
+  801f34:	0f 34                	sysenter
+  801f36:	83 c4 04             	add    $0x4,%esp
+  801f39:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801f3a:	85 c0                	test   %eax,%eax
+  801f3c:	7f 6d                	jg     801fab <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  801f3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f41:	5b                   	pop    %ebx
+  801f42:	5e                   	pop    %esi
+  801f43:	5f                   	pop    %edi
+  801f44:	5d                   	pop    %ebp
+  801f45:	c3                   	ret
+  801f46:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f4b:	0f a2                	cpuid
+		return 0;
+  801f4d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801f52:	f6 c6 08             	test   $0x8,%dh
+  801f55:	74 15                	je     801f6c <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f57:	89 c2                	mov    %eax,%edx
+  801f59:	c1 ea 08             	shr    $0x8,%edx
+  801f5c:	83 e2 0f             	and    $0xf,%edx
+  801f5f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f64:	83 fa 06             	cmp    $0x6,%edx
+  801f67:	74 0e                	je     801f77 <sys_shm_detach+0x7b>
+  801f69:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801f6c:	0f b6 c9             	movzbl %cl,%ecx
+  801f6f:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801f75:	eb 97                	jmp    801f0e <sys_shm_detach+0x12>
+  801f77:	89 c2                	mov    %eax,%edx
+  801f79:	c1 ea 04             	shr    $0x4,%edx
+  801f7c:	83 e2 0f             	and    $0xf,%edx
+  801f7f:	83 fa 02             	cmp    $0x2,%edx
+  801f82:	77 e5                	ja     801f69 <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  801f84:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f87:	83 f8 02             	cmp    $0x2,%eax
+  801f8a:	0f 97 c1             	seta   %cl
+  801f8d:	0f b6 c9             	movzbl %cl,%ecx
+  801f90:	eb d7                	jmp    801f69 <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  801f92:	be 00 00 00 00       	mov    $0x0,%esi
+  801f97:	b8 17 00 00 00       	mov    $0x17,%eax
+  801f9c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f9f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fa2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801fa5:	89 f7                	mov    %esi,%edi
+  801fa7:	cd 30                	int    $0x30
+  801fa9:	eb 8f                	jmp    801f3a <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801fab:	83 ec 0c             	sub    $0xc,%esp
+  801fae:	50                   	push   %eax
+  801faf:	6a 17                	push   $0x17
+  801fb1:	68 79 2b 80 00       	push   $0x802b79
+  801fb6:	6a 4a                	push   $0x4a
+  801fb8:	68 96 2b 80 00       	push   $0x802b96
+  801fbd:	e8 2e 06 00 00       	call   8025f0 <_panic>
+
+00801fc2 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  801fc2:	55                   	push   %ebp
+  801fc3:	89 e5                	mov    %esp,%ebp
+  801fc5:	57                   	push   %edi
+  801fc6:	56                   	push   %esi
+  801fc7:	53                   	push   %ebx
+  801fc8:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801fcb:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801fd2:	78 36                	js     80200a <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  801fd4:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801fdb:	74 79                	je     802056 <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  801fdd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fe0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fe5:	b8 18 00 00 00       	mov    $0x18,%eax
+  801fea:	89 cb                	mov    %ecx,%ebx
+  801fec:	89 cf                	mov    %ecx,%edi
+  801fee:	89 ce                	mov    %ecx,%esi
+  801ff0:	55                   	push   %ebp
+  801ff1:	68 fa 1f 80 00       	push   $0x801ffa
+  801ff6:	89 e5                	mov    %esp,%ebp
+  801ff8:	0f 34                	sysenter
+  801ffa:	83 c4 04             	add    $0x4,%esp
+  801ffd:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801ffe:	85 c0                	test   %eax,%eax
+  802000:	7f 6b                	jg     80206d <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  802002:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802005:	5b                   	pop    %ebx
+  802006:	5e                   	pop    %esi
+  802007:	5f                   	pop    %edi
+  802008:	5d                   	pop    %ebp
+  802009:	c3                   	ret
+  80200a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80200f:	0f a2                	cpuid
+		return 0;
+  802011:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802016:	f6 c6 08             	test   $0x8,%dh
+  802019:	74 15                	je     802030 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80201b:	89 c2                	mov    %eax,%edx
+  80201d:	c1 ea 08             	shr    $0x8,%edx
+  802020:	83 e2 0f             	and    $0xf,%edx
+  802023:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802028:	83 fa 06             	cmp    $0x6,%edx
+  80202b:	74 0e                	je     80203b <sys_shm_remove+0x79>
+  80202d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802030:	0f b6 c9             	movzbl %cl,%ecx
+  802033:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802039:	eb 99                	jmp    801fd4 <sys_shm_remove+0x12>
+  80203b:	89 c2                	mov    %eax,%edx
+  80203d:	c1 ea 04             	shr    $0x4,%edx
+  802040:	83 e2 0f             	and    $0xf,%edx
+  802043:	83 fa 02             	cmp    $0x2,%edx
+  802046:	77 e5                	ja     80202d <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  802048:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80204b:	83 f8 02             	cmp    $0x2,%eax
+  80204e:	0f 97 c1             	seta   %cl
+  802051:	0f b6 c9             	movzbl %cl,%ecx
+  802054:	eb d7                	jmp    80202d <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  802056:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80205b:	b8 18 00 00 00       	mov    $0x18,%eax
+  802060:	8b 55 08             	mov    0x8(%ebp),%edx
+  802063:	89 cb                	mov    %ecx,%ebx
+  802065:	89 cf                	mov    %ecx,%edi
+  802067:	89 ce                	mov    %ecx,%esi
+  802069:	cd 30                	int    $0x30
+  80206b:	eb 91                	jmp    801ffe <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80206d:	83 ec 0c             	sub    $0xc,%esp
+  802070:	50                   	push   %eax
+  802071:	6a 18                	push   $0x18
+  802073:	68 79 2b 80 00       	push   $0x802b79
+  802078:	6a 4a                	push   $0x4a
+  80207a:	68 96 2b 80 00       	push   $0x802b96
+  80207f:	e8 6c 05 00 00       	call   8025f0 <_panic>
+
+00802084 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  802084:	55                   	push   %ebp
+  802085:	89 e5                	mov    %esp,%ebp
+  802087:	57                   	push   %edi
+  802088:	56                   	push   %esi
+  802089:	53                   	push   %ebx
+  80208a:	83 ec 0c             	sub    $0xc,%esp
+  80208d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802090:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802093:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  802096:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80209d:	78 32                	js     8020d1 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  80209f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8020a6:	74 75                	je     80211d <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  8020a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020ae:	b8 20 00 00 00       	mov    $0x20,%eax
+  8020b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8020b8:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8020bb:	55                   	push   %ebp
+  8020bc:	68 c5 20 80 00       	push   $0x8020c5
+  8020c1:	89 e5                	mov    %esp,%ebp
+  8020c3:	0f 34                	sysenter
+  8020c5:	83 c4 04             	add    $0x4,%esp
+  8020c8:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  8020c9:	83 c4 0c             	add    $0xc,%esp
+  8020cc:	5b                   	pop    %ebx
+  8020cd:	5e                   	pop    %esi
+  8020ce:	5f                   	pop    %edi
+  8020cf:	5d                   	pop    %ebp
+  8020d0:	c3                   	ret
+  8020d1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020d6:	0f a2                	cpuid
+		return 0;
+  8020d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8020dd:	f6 c6 08             	test   $0x8,%dh
+  8020e0:	74 15                	je     8020f7 <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020e2:	89 c2                	mov    %eax,%edx
+  8020e4:	c1 ea 08             	shr    $0x8,%edx
+  8020e7:	83 e2 0f             	and    $0xf,%edx
+  8020ea:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8020ef:	83 fa 06             	cmp    $0x6,%edx
+  8020f2:	74 0e                	je     802102 <sys_futex_wait+0x7e>
+  8020f4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8020f7:	0f b6 c9             	movzbl %cl,%ecx
+  8020fa:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802100:	eb 9d                	jmp    80209f <sys_futex_wait+0x1b>
+  802102:	89 c2                	mov    %eax,%edx
+  802104:	c1 ea 04             	shr    $0x4,%edx
+  802107:	83 e2 0f             	and    $0xf,%edx
+  80210a:	83 fa 02             	cmp    $0x2,%edx
+  80210d:	77 e5                	ja     8020f4 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  80210f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802112:	83 f8 02             	cmp    $0x2,%eax
+  802115:	0f 97 c1             	seta   %cl
+  802118:	0f b6 c9             	movzbl %cl,%ecx
+  80211b:	eb d7                	jmp    8020f4 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  80211d:	b8 20 00 00 00       	mov    $0x20,%eax
+  802122:	be 00 00 00 00       	mov    $0x0,%esi
+  802127:	8b 55 08             	mov    0x8(%ebp),%edx
+  80212a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80212d:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802130:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  802132:	eb 95                	jmp    8020c9 <sys_futex_wait+0x45>
+
+00802134 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  802134:	55                   	push   %ebp
+  802135:	89 e5                	mov    %esp,%ebp
+  802137:	57                   	push   %edi
+  802138:	56                   	push   %esi
+  802139:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80213a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802141:	78 30                	js     802173 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  802143:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80214a:	74 73                	je     8021bf <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  80214c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802151:	8b 55 08             	mov    0x8(%ebp),%edx
+  802154:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802157:	b8 21 00 00 00       	mov    $0x21,%eax
+  80215c:	89 df                	mov    %ebx,%edi
+  80215e:	89 de                	mov    %ebx,%esi
+  802160:	55                   	push   %ebp
+  802161:	68 6a 21 80 00       	push   $0x80216a
+  802166:	89 e5                	mov    %esp,%ebp
+  802168:	0f 34                	sysenter
+  80216a:	83 c4 04             	add    $0x4,%esp
+  80216d:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80216e:	5b                   	pop    %ebx
+  80216f:	5e                   	pop    %esi
+  802170:	5f                   	pop    %edi
+  802171:	5d                   	pop    %ebp
+  802172:	c3                   	ret
+  802173:	b8 01 00 00 00       	mov    $0x1,%eax
+  802178:	0f a2                	cpuid
+		return 0;
+  80217a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80217f:	f6 c6 08             	test   $0x8,%dh
+  802182:	74 15                	je     802199 <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802184:	89 c2                	mov    %eax,%edx
+  802186:	c1 ea 08             	shr    $0x8,%edx
+  802189:	83 e2 0f             	and    $0xf,%edx
+  80218c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802191:	83 fa 06             	cmp    $0x6,%edx
+  802194:	74 0e                	je     8021a4 <sys_futex_wake+0x70>
+  802196:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802199:	0f b6 c9             	movzbl %cl,%ecx
+  80219c:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8021a2:	eb 9f                	jmp    802143 <sys_futex_wake+0xf>
+  8021a4:	89 c2                	mov    %eax,%edx
+  8021a6:	c1 ea 04             	shr    $0x4,%edx
+  8021a9:	83 e2 0f             	and    $0xf,%edx
+  8021ac:	83 fa 02             	cmp    $0x2,%edx
+  8021af:	77 e5                	ja     802196 <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  8021b1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021b4:	83 f8 02             	cmp    $0x2,%eax
+  8021b7:	0f 97 c1             	seta   %cl
+  8021ba:	0f b6 c9             	movzbl %cl,%ecx
+  8021bd:	eb d7                	jmp    802196 <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  8021bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021c4:	b8 21 00 00 00       	mov    $0x21,%eax
+  8021c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021cf:	89 df                	mov    %ebx,%edi
+  8021d1:	89 de                	mov    %ebx,%esi
+  8021d3:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  8021d5:	eb 97                	jmp    80216e <sys_futex_wake+0x3a>
+
+008021d7 <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  8021d7:	55                   	push   %ebp
+  8021d8:	89 e5                	mov    %esp,%ebp
+  8021da:	57                   	push   %edi
+  8021db:	56                   	push   %esi
+  8021dc:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8021dd:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8021e4:	78 2e                	js     802214 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  8021e6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8021ed:	74 71                	je     802260 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  8021ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021f4:	b8 22 00 00 00       	mov    $0x22,%eax
+  8021f9:	89 d1                	mov    %edx,%ecx
+  8021fb:	89 d3                	mov    %edx,%ebx
+  8021fd:	89 d7                	mov    %edx,%edi
+  8021ff:	89 d6                	mov    %edx,%esi
+  802201:	55                   	push   %ebp
+  802202:	68 0b 22 80 00       	push   $0x80220b
+  802207:	89 e5                	mov    %esp,%ebp
+  802209:	0f 34                	sysenter
+  80220b:	83 c4 04             	add    $0x4,%esp
+  80220e:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  80220f:	5b                   	pop    %ebx
+  802210:	5e                   	pop    %esi
+  802211:	5f                   	pop    %edi
+  802212:	5d                   	pop    %ebp
+  802213:	c3                   	ret
+  802214:	b8 01 00 00 00       	mov    $0x1,%eax
+  802219:	0f a2                	cpuid
+		return 0;
+  80221b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802220:	f6 c6 08             	test   $0x8,%dh
+  802223:	74 15                	je     80223a <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802225:	89 c2                	mov    %eax,%edx
+  802227:	c1 ea 08             	shr    $0x8,%edx
+  80222a:	83 e2 0f             	and    $0xf,%edx
+  80222d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802232:	83 fa 06             	cmp    $0x6,%edx
+  802235:	74 0e                	je     802245 <sys_ep_create+0x6e>
+  802237:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80223a:	0f b6 c9             	movzbl %cl,%ecx
+  80223d:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802243:	eb a1                	jmp    8021e6 <sys_ep_create+0xf>
+  802245:	89 c2                	mov    %eax,%edx
+  802247:	c1 ea 04             	shr    $0x4,%edx
+  80224a:	83 e2 0f             	and    $0xf,%edx
+  80224d:	83 fa 02             	cmp    $0x2,%edx
+  802250:	77 e5                	ja     802237 <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  802252:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802255:	83 f8 02             	cmp    $0x2,%eax
+  802258:	0f 97 c1             	seta   %cl
+  80225b:	0f b6 c9             	movzbl %cl,%ecx
+  80225e:	eb d7                	jmp    802237 <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  802260:	ba 00 00 00 00       	mov    $0x0,%edx
+  802265:	b8 22 00 00 00       	mov    $0x22,%eax
+  80226a:	89 d1                	mov    %edx,%ecx
+  80226c:	89 d3                	mov    %edx,%ebx
+  80226e:	89 d7                	mov    %edx,%edi
+  802270:	89 d6                	mov    %edx,%esi
+  802272:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  802274:	eb 99                	jmp    80220f <sys_ep_create+0x38>
+
+00802276 <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  802276:	55                   	push   %ebp
+  802277:	89 e5                	mov    %esp,%ebp
+  802279:	57                   	push   %edi
+  80227a:	56                   	push   %esi
+  80227b:	53                   	push   %ebx
+  80227c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80227f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802286:	78 36                	js     8022be <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  802288:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80228f:	74 79                	je     80230a <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  802291:	8b 55 08             	mov    0x8(%ebp),%edx
+  802294:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802299:	b8 23 00 00 00       	mov    $0x23,%eax
+  80229e:	89 cb                	mov    %ecx,%ebx
+  8022a0:	89 cf                	mov    %ecx,%edi
+  8022a2:	89 ce                	mov    %ecx,%esi
+  8022a4:	55                   	push   %ebp
+  8022a5:	68 ae 22 80 00       	push   $0x8022ae
+  8022aa:	89 e5                	mov    %esp,%ebp
+  8022ac:	0f 34                	sysenter
+  8022ae:	83 c4 04             	add    $0x4,%esp
+  8022b1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8022b2:	85 c0                	test   %eax,%eax
+  8022b4:	7f 6b                	jg     802321 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  8022b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022b9:	5b                   	pop    %ebx
+  8022ba:	5e                   	pop    %esi
+  8022bb:	5f                   	pop    %edi
+  8022bc:	5d                   	pop    %ebp
+  8022bd:	c3                   	ret
+  8022be:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022c3:	0f a2                	cpuid
+		return 0;
+  8022c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8022ca:	f6 c6 08             	test   $0x8,%dh
+  8022cd:	74 15                	je     8022e4 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022cf:	89 c2                	mov    %eax,%edx
+  8022d1:	c1 ea 08             	shr    $0x8,%edx
+  8022d4:	83 e2 0f             	and    $0xf,%edx
+  8022d7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8022dc:	83 fa 06             	cmp    $0x6,%edx
+  8022df:	74 0e                	je     8022ef <sys_ep_destroy+0x79>
+  8022e1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8022e4:	0f b6 c9             	movzbl %cl,%ecx
+  8022e7:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8022ed:	eb 99                	jmp    802288 <sys_ep_destroy+0x12>
+  8022ef:	89 c2                	mov    %eax,%edx
+  8022f1:	c1 ea 04             	shr    $0x4,%edx
+  8022f4:	83 e2 0f             	and    $0xf,%edx
+  8022f7:	83 fa 02             	cmp    $0x2,%edx
+  8022fa:	77 e5                	ja     8022e1 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  8022fc:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022ff:	83 f8 02             	cmp    $0x2,%eax
+  802302:	0f 97 c1             	seta   %cl
+  802305:	0f b6 c9             	movzbl %cl,%ecx
+  802308:	eb d7                	jmp    8022e1 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  80230a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80230f:	b8 23 00 00 00       	mov    $0x23,%eax
+  802314:	8b 55 08             	mov    0x8(%ebp),%edx
+  802317:	89 cb                	mov    %ecx,%ebx
+  802319:	89 cf                	mov    %ecx,%edi
+  80231b:	89 ce                	mov    %ecx,%esi
+  80231d:	cd 30                	int    $0x30
+  80231f:	eb 91                	jmp    8022b2 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802321:	83 ec 0c             	sub    $0xc,%esp
+  802324:	50                   	push   %eax
+  802325:	6a 23                	push   $0x23
+  802327:	68 79 2b 80 00       	push   $0x802b79
+  80232c:	6a 4a                	push   $0x4a
+  80232e:	68 96 2b 80 00       	push   $0x802b96
+  802333:	e8 b8 02 00 00       	call   8025f0 <_panic>
+
+00802338 <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  802338:	55                   	push   %ebp
+  802339:	89 e5                	mov    %esp,%ebp
+  80233b:	57                   	push   %edi
+  80233c:	56                   	push   %esi
+  80233d:	53                   	push   %ebx
+  80233e:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802341:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802348:	78 37                	js     802381 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  80234a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802351:	74 7a                	je     8023cd <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  802353:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802358:	8b 55 08             	mov    0x8(%ebp),%edx
+  80235b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80235e:	b8 24 00 00 00       	mov    $0x24,%eax
+  802363:	89 df                	mov    %ebx,%edi
+  802365:	89 de                	mov    %ebx,%esi
+  802367:	55                   	push   %ebp
+  802368:	68 71 23 80 00       	push   $0x802371
+  80236d:	89 e5                	mov    %esp,%ebp
+  80236f:	0f 34                	sysenter
+  802371:	83 c4 04             	add    $0x4,%esp
+  802374:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802375:	85 c0                	test   %eax,%eax
+  802377:	7f 6c                	jg     8023e5 <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  802379:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80237c:	5b                   	pop    %ebx
+  80237d:	5e                   	pop    %esi
+  80237e:	5f                   	pop    %edi
+  80237f:	5d                   	pop    %ebp
+  802380:	c3                   	ret
+  802381:	b8 01 00 00 00       	mov    $0x1,%eax
+  802386:	0f a2                	cpuid
+		return 0;
+  802388:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80238d:	f6 c6 08             	test   $0x8,%dh
+  802390:	74 15                	je     8023a7 <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802392:	89 c2                	mov    %eax,%edx
+  802394:	c1 ea 08             	shr    $0x8,%edx
+  802397:	83 e2 0f             	and    $0xf,%edx
+  80239a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80239f:	83 fa 06             	cmp    $0x6,%edx
+  8023a2:	74 0e                	je     8023b2 <sys_ep_grant+0x7a>
+  8023a4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8023a7:	0f b6 c9             	movzbl %cl,%ecx
+  8023aa:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8023b0:	eb 98                	jmp    80234a <sys_ep_grant+0x12>
+  8023b2:	89 c2                	mov    %eax,%edx
+  8023b4:	c1 ea 04             	shr    $0x4,%edx
+  8023b7:	83 e2 0f             	and    $0xf,%edx
+  8023ba:	83 fa 02             	cmp    $0x2,%edx
+  8023bd:	77 e5                	ja     8023a4 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  8023bf:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023c2:	83 f8 02             	cmp    $0x2,%eax
+  8023c5:	0f 97 c1             	seta   %cl
+  8023c8:	0f b6 c9             	movzbl %cl,%ecx
+  8023cb:	eb d7                	jmp    8023a4 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  8023cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023d2:	b8 24 00 00 00       	mov    $0x24,%eax
+  8023d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023dd:	89 df                	mov    %ebx,%edi
+  8023df:	89 de                	mov    %ebx,%esi
+  8023e1:	cd 30                	int    $0x30
+  8023e3:	eb 90                	jmp    802375 <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8023e5:	83 ec 0c             	sub    $0xc,%esp
+  8023e8:	50                   	push   %eax
+  8023e9:	6a 24                	push   $0x24
+  8023eb:	68 79 2b 80 00       	push   $0x802b79
+  8023f0:	6a 4a                	push   $0x4a
+  8023f2:	68 96 2b 80 00       	push   $0x802b96
+  8023f7:	e8 f4 01 00 00       	call   8025f0 <_panic>
+
+008023fc <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  8023fc:	55                   	push   %ebp
+  8023fd:	89 e5                	mov    %esp,%ebp
+  8023ff:	57                   	push   %edi
+  802400:	56                   	push   %esi
+  802401:	53                   	push   %ebx
+  802402:	83 ec 20             	sub    $0x20,%esp
+  802405:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  802408:	8b 10                	mov    (%eax),%edx
+  80240a:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  80240d:	8b 50 04             	mov    0x4(%eax),%edx
+  802410:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802413:	8b 50 08             	mov    0x8(%eax),%edx
+  802416:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  802419:	8b 50 0c             	mov    0xc(%eax),%edx
+  80241c:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  80241f:	8b 40 10             	mov    0x10(%eax),%eax
+  802422:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  802425:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  802428:	8b 55 08             	mov    0x8(%ebp),%edx
+  80242b:	b8 25 00 00 00       	mov    $0x25,%eax
+  802430:	55                   	push   %ebp
+  802431:	56                   	push   %esi
+  802432:	8b 0e                	mov    (%esi),%ecx
+  802434:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802437:	8b 7e 08             	mov    0x8(%esi),%edi
+  80243a:	8b 6e 10             	mov    0x10(%esi),%ebp
+  80243d:	8b 76 0c             	mov    0xc(%esi),%esi
+  802440:	cd 30                	int    $0x30
+  802442:	87 34 24             	xchg   %esi,(%esp)
+  802445:	89 0e                	mov    %ecx,(%esi)
+  802447:	89 5e 04             	mov    %ebx,0x4(%esi)
+  80244a:	89 7e 08             	mov    %edi,0x8(%esi)
+  80244d:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802450:	8f 46 0c             	pop    0xc(%esi)
+  802453:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  802454:	83 c4 20             	add    $0x20,%esp
+  802457:	5b                   	pop    %ebx
+  802458:	5e                   	pop    %esi
+  802459:	5f                   	pop    %edi
+  80245a:	5d                   	pop    %ebp
+  80245b:	c3                   	ret
+
+0080245c <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  80245c:	55                   	push   %ebp
+  80245d:	89 e5                	mov    %esp,%ebp
+  80245f:	57                   	push   %edi
+  802460:	56                   	push   %esi
+  802461:	53                   	push   %ebx
+  802462:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  802465:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802468:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  80246a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80246d:	b8 26 00 00 00       	mov    $0x26,%eax
+  802472:	55                   	push   %ebp
+  802473:	56                   	push   %esi
+  802474:	8b 0e                	mov    (%esi),%ecx
+  802476:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802479:	8b 7e 08             	mov    0x8(%esi),%edi
+  80247c:	8b 6e 10             	mov    0x10(%esi),%ebp
+  80247f:	8b 76 0c             	mov    0xc(%esi),%esi
+  802482:	cd 30                	int    $0x30
+  802484:	87 34 24             	xchg   %esi,(%esp)
+  802487:	89 0e                	mov    %ecx,(%esi)
+  802489:	89 5e 04             	mov    %ebx,0x4(%esi)
+  80248c:	89 7e 08             	mov    %edi,0x8(%esi)
+  80248f:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802492:	8f 46 0c             	pop    0xc(%esi)
+  802495:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  802496:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  80249a:	74 0f                	je     8024ab <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  80249c:	85 c0                	test   %eax,%eax
+  80249e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024a3:	0f 48 d1             	cmovs  %ecx,%edx
+  8024a6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8024a9:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  8024ab:	5b                   	pop    %ebx
+  8024ac:	5e                   	pop    %esi
+  8024ad:	5f                   	pop    %edi
+  8024ae:	5d                   	pop    %ebp
+  8024af:	c3                   	ret
+
+008024b0 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  8024b0:	55                   	push   %ebp
+  8024b1:	89 e5                	mov    %esp,%ebp
+  8024b3:	57                   	push   %edi
+  8024b4:	56                   	push   %esi
+  8024b5:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8024b6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8024bd:	78 2f                	js     8024ee <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  8024bf:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8024c6:	74 72                	je     80253a <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  8024c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024d0:	b8 27 00 00 00       	mov    $0x27,%eax
+  8024d5:	89 cb                	mov    %ecx,%ebx
+  8024d7:	89 cf                	mov    %ecx,%edi
+  8024d9:	89 ce                	mov    %ecx,%esi
+  8024db:	55                   	push   %ebp
+  8024dc:	68 e5 24 80 00       	push   $0x8024e5
+  8024e1:	89 e5                	mov    %esp,%ebp
+  8024e3:	0f 34                	sysenter
+  8024e5:	83 c4 04             	add    $0x4,%esp
+  8024e8:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  8024e9:	5b                   	pop    %ebx
+  8024ea:	5e                   	pop    %esi
+  8024eb:	5f                   	pop    %edi
+  8024ec:	5d                   	pop    %ebp
+  8024ed:	c3                   	ret
+  8024ee:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024f3:	0f a2                	cpuid
+		return 0;
+  8024f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8024fa:	f6 c6 08             	test   $0x8,%dh
+  8024fd:	74 15                	je     802514 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8024ff:	89 c2                	mov    %eax,%edx
+  802501:	c1 ea 08             	shr    $0x8,%edx
+  802504:	83 e2 0f             	and    $0xf,%edx
+  802507:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80250c:	83 fa 06             	cmp    $0x6,%edx
+  80250f:	74 0e                	je     80251f <sys_sysring_setup+0x6f>
+  802511:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802514:	0f b6 c9             	movzbl %cl,%ecx
+  802517:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80251d:	eb a0                	jmp    8024bf <sys_sysring_setup+0xf>
+  80251f:	89 c2                	mov    %eax,%edx
+  802521:	c1 ea 04             	shr    $0x4,%edx
+  802524:	83 e2 0f             	and    $0xf,%edx
+  802527:	83 fa 02             	cmp    $0x2,%edx
+  80252a:	77 e5                	ja     802511 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  80252c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80252f:	83 f8 02             	cmp    $0x2,%eax
+  802532:	0f 97 c1             	seta   %cl
+  802535:	0f b6 c9             	movzbl %cl,%ecx
+  802538:	eb d7                	jmp    802511 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  80253a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80253f:	b8 27 00 00 00       	mov    $0x27,%eax
+  802544:	8b 55 08             	mov    0x8(%ebp),%edx
+  802547:	89 cb                	mov    %ecx,%ebx
+  802549:	89 cf                	mov    %ecx,%edi
+  80254b:	89 ce                	mov    %ecx,%esi
+  80254d:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  80254f:	eb 98                	jmp    8024e9 <sys_sysring_setup+0x39>
+
+00802551 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  802551:	55                   	push   %ebp
+  802552:	89 e5                	mov    %esp,%ebp
+  802554:	57                   	push   %edi
+  802555:	56                   	push   %esi
+  802556:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802557:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80255e:	78 2e                	js     80258e <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  802560:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802567:	74 71                	je     8025da <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  802569:	ba 00 00 00 00       	mov    $0x0,%edx
+  80256e:	b8 28 00 00 00       	mov    $0x28,%eax
+  802573:	89 d1                	mov    %edx,%ecx
+  802575:	89 d3                	mov    %edx,%ebx
+  802577:	89 d7                	mov    %edx,%edi
+  802579:	89 d6                	mov    %edx,%esi
+  80257b:	55                   	push   %ebp
+  80257c:	68 85 25 80 00       	push   $0x802585
+  802581:	89 e5                	mov    %esp,%ebp
+  802583:	0f 34                	sysenter
+  802585:	83 c4 04             	add    $0x4,%esp
+  802588:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  802589:	5b                   	pop    %ebx
+  80258a:	5e                   	pop    %esi
+  80258b:	5f                   	pop    %edi
+  80258c:	5d                   	pop    %ebp
+  80258d:	c3                   	ret
+  80258e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802593:	0f a2                	cpuid
+		return 0;
+  802595:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80259a:	f6 c6 08             	test   $0x8,%dh
+  80259d:	74 15                	je     8025b4 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80259f:	89 c2                	mov    %eax,%edx
+  8025a1:	c1 ea 08             	shr    $0x8,%edx
+  8025a4:	83 e2 0f             	and    $0xf,%edx
+  8025a7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8025ac:	83 fa 06             	cmp    $0x6,%edx
+  8025af:	74 0e                	je     8025bf <sys_sysring_enter+0x6e>
+  8025b1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8025b4:	0f b6 c9             	movzbl %cl,%ecx
+  8025b7:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8025bd:	eb a1                	jmp    802560 <sys_sysring_enter+0xf>
+  8025bf:	89 c2                	mov    %eax,%edx
+  8025c1:	c1 ea 04             	shr    $0x4,%edx
+  8025c4:	83 e2 0f             	and    $0xf,%edx
+  8025c7:	83 fa 02             	cmp    $0x2,%edx
+  8025ca:	77 e5                	ja     8025b1 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  8025cc:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025cf:	83 f8 02             	cmp    $0x2,%eax
+  8025d2:	0f 97 c1             	seta   %cl
+  8025d5:	0f b6 c9             	movzbl %cl,%ecx
+  8025d8:	eb d7                	jmp    8025b1 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  8025da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025df:	b8 28 00 00 00       	mov    $0x28,%eax
+  8025e4:	89 d1                	mov    %edx,%ecx
+  8025e6:	89 d3                	mov    %edx,%ebx
+  8025e8:	89 d7                	mov    %edx,%edi
+  8025ea:	89 d6                	mov    %edx,%esi
+  8025ec:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  8025ee:	eb 99                	jmp    802589 <sys_sysring_enter+0x38>
+
+008025f0 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8025f0:	55                   	push   %ebp
+  8025f1:	89 e5                	mov    %esp,%ebp
+  8025f3:	57                   	push   %edi
+  8025f4:	56                   	push   %esi
+  8025f5:	53                   	push   %ebx
+  8025f6:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  8025fc:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  8025ff:	8b 1d 00 30 80 00    	mov    0x803000,%ebx
+  802605:	e8 c8 e8 ff ff       	call   800ed2 <sys_getenvid>
+  80260a:	83 ec 04             	sub    $0x4,%esp
+  80260d:	ff 75 0c             	push   0xc(%ebp)
+  802610:	ff 75 08             	push   0x8(%ebp)
+  802613:	53                   	push   %ebx
+  802614:	50                   	push   %eax
+  802615:	68 a4 2b 80 00       	push   $0x802ba4
+  80261a:	68 00 01 00 00       	push   $0x100
+  80261f:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  802625:	56                   	push   %esi
+  802626:	e8 bc e0 ff ff       	call   8006e7 <snprintf>
+  80262b:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  80262d:	83 c4 20             	add    $0x20,%esp
+  802630:	57                   	push   %edi
+  802631:	ff 75 10             	push   0x10(%ebp)
+  802634:	bf 00 01 00 00       	mov    $0x100,%edi
+  802639:	89 f8                	mov    %edi,%eax
+  80263b:	29 d8                	sub    %ebx,%eax
+  80263d:	50                   	push   %eax
+  80263e:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  802641:	50                   	push   %eax
+  802642:	e8 52 e0 ff ff       	call   800699 <vsnprintf>
+  802647:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  802649:	83 c4 0c             	add    $0xc,%esp
+  80264c:	68 8c 28 80 00       	push   $0x80288c
+  802651:	29 df                	sub    %ebx,%edi
+  802653:	57                   	push   %edi
+  802654:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  802657:	50                   	push   %eax
+  802658:	e8 8a e0 ff ff       	call   8006e7 <snprintf>
+	sys_cputs(buf, r);
+  80265d:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  802660:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  802662:	53                   	push   %ebx
+  802663:	56                   	push   %esi
+  802664:	e8 6b e6 ff ff       	call   800cd4 <sys_cputs>
+  802669:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80266c:	cc                   	int3
+	while (1)
+  80266d:	eb fd                	jmp    80266c <_panic+0x7c>
+
+0080266f <dm>:
+  80266f:	55                   	push   %ebp
+  802670:	57                   	push   %edi
+  802671:	56                   	push   %esi
+  802672:	53                   	push   %ebx
+  802673:	83 ec 24             	sub    $0x24,%esp
+  802676:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80267a:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80267e:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802682:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802686:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80268a:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80268e:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802692:	b8 00 00 00 00       	mov    $0x0,%eax
+  802697:	ba 00 00 00 00       	mov    $0x0,%edx
+  80269c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8026a1:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8026a8:	00 
+  8026a9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8026b0:	00 
+  8026b1:	89 fb                	mov    %edi,%ebx
+  8026b3:	eb 08                	jmp    8026bd <dm+0x4e>
+  8026b5:	83 e9 01             	sub    $0x1,%ecx
+  8026b8:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8026bb:	74 68                	je     802725 <dm+0xb6>
+  8026bd:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8026c1:	01 c0                	add    %eax,%eax
+  8026c3:	89 c6                	mov    %eax,%esi
+  8026c5:	89 d7                	mov    %edx,%edi
+  8026c7:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8026cb:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026cf:	0f ad d0             	shrd   %cl,%edx,%eax
+  8026d2:	d3 ea                	shr    %cl,%edx
+  8026d4:	f6 c1 20             	test   $0x20,%cl
+  8026d7:	74 04                	je     8026dd <dm+0x6e>
+  8026d9:	89 d0                	mov    %edx,%eax
+  8026db:	31 d2                	xor    %edx,%edx
+  8026dd:	83 e0 01             	and    $0x1,%eax
+  8026e0:	89 04 24             	mov    %eax,(%esp)
+  8026e3:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8026ea:	00 
+  8026eb:	8b 04 24             	mov    (%esp),%eax
+  8026ee:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8026f2:	09 f0                	or     %esi,%eax
+  8026f4:	09 fa                	or     %edi,%edx
+  8026f6:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8026fa:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8026fe:	39 f0                	cmp    %esi,%eax
+  802700:	89 d5                	mov    %edx,%ebp
+  802702:	19 fd                	sbb    %edi,%ebp
+  802704:	72 af                	jb     8026b5 <dm+0x46>
+  802706:	29 f0                	sub    %esi,%eax
+  802708:	19 fa                	sbb    %edi,%edx
+  80270a:	89 cf                	mov    %ecx,%edi
+  80270c:	c1 ef 05             	shr    $0x5,%edi
+  80270f:	83 e7 01             	and    $0x1,%edi
+  802712:	89 fe                	mov    %edi,%esi
+  802714:	83 f6 01             	xor    $0x1,%esi
+  802717:	d3 e6                	shl    %cl,%esi
+  802719:	d3 e7                	shl    %cl,%edi
+  80271b:	09 74 24 18          	or     %esi,0x18(%esp)
+  80271f:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802723:	eb 90                	jmp    8026b5 <dm+0x46>
+  802725:	85 db                	test   %ebx,%ebx
+  802727:	74 05                	je     80272e <dm+0xbf>
+  802729:	89 03                	mov    %eax,(%ebx)
+  80272b:	89 53 04             	mov    %edx,0x4(%ebx)
+  80272e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802732:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802736:	83 c4 24             	add    $0x24,%esp
+  802739:	5b                   	pop    %ebx
+  80273a:	5e                   	pop    %esi
+  80273b:	5f                   	pop    %edi
+  80273c:	5d                   	pop    %ebp
+  80273d:	c3                   	ret
+
+0080273e <__udivdi3>:
+  80273e:	83 ec 08             	sub    $0x8,%esp
+  802741:	6a 00                	push   $0x0
+  802743:	ff 74 24 1c          	push   0x1c(%esp)
+  802747:	ff 74 24 1c          	push   0x1c(%esp)
+  80274b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80274f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802753:	e8 17 ff ff ff       	call   80266f <dm>
+  802758:	83 c4 14             	add    $0x14,%esp
+  80275b:	c3                   	ret
+
+0080275c <__umoddi3>:
+  80275c:	83 ec 18             	sub    $0x18,%esp
+  80275f:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802763:	50                   	push   %eax
+  802764:	ff 74 24 2c          	push   0x2c(%esp)
+  802768:	ff 74 24 2c          	push   0x2c(%esp)
+  80276c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802770:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802774:	e8 f6 fe ff ff       	call   80266f <dm>
+  802779:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80277d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802781:	83 c4 24             	add    $0x24,%esp
+  802784:	c3                   	ret
+
+00802785 <__divdi3>:
+  802785:	53                   	push   %ebx
+  802786:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80278a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80278e:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  802792:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  802796:	85 d2                	test   %edx,%edx
+  802798:	78 15                	js     8027af <__divdi3+0x2a>
+  80279a:	85 db                	test   %ebx,%ebx
+  80279c:	78 34                	js     8027d2 <__divdi3+0x4d>
+  80279e:	83 ec 04             	sub    $0x4,%esp
+  8027a1:	6a 00                	push   $0x0
+  8027a3:	53                   	push   %ebx
+  8027a4:	51                   	push   %ecx
+  8027a5:	e8 c5 fe ff ff       	call   80266f <dm>
+  8027aa:	83 c4 10             	add    $0x10,%esp
+  8027ad:	eb 21                	jmp    8027d0 <__divdi3+0x4b>
+  8027af:	f7 d8                	neg    %eax
+  8027b1:	83 d2 00             	adc    $0x0,%edx
+  8027b4:	f7 da                	neg    %edx
+  8027b6:	85 db                	test   %ebx,%ebx
+  8027b8:	78 30                	js     8027ea <__divdi3+0x65>
+  8027ba:	83 ec 04             	sub    $0x4,%esp
+  8027bd:	6a 00                	push   $0x0
+  8027bf:	53                   	push   %ebx
+  8027c0:	51                   	push   %ecx
+  8027c1:	e8 a9 fe ff ff       	call   80266f <dm>
+  8027c6:	83 c4 10             	add    $0x10,%esp
+  8027c9:	f7 d8                	neg    %eax
+  8027cb:	83 d2 00             	adc    $0x0,%edx
+  8027ce:	f7 da                	neg    %edx
+  8027d0:	5b                   	pop    %ebx
+  8027d1:	c3                   	ret
+  8027d2:	83 ec 04             	sub    $0x4,%esp
+  8027d5:	6a 00                	push   $0x0
+  8027d7:	f7 d9                	neg    %ecx
+  8027d9:	83 d3 00             	adc    $0x0,%ebx
+  8027dc:	f7 db                	neg    %ebx
+  8027de:	53                   	push   %ebx
+  8027df:	51                   	push   %ecx
+  8027e0:	e8 8a fe ff ff       	call   80266f <dm>
+  8027e5:	83 c4 10             	add    $0x10,%esp
+  8027e8:	eb df                	jmp    8027c9 <__divdi3+0x44>
+  8027ea:	83 ec 04             	sub    $0x4,%esp
+  8027ed:	6a 00                	push   $0x0
+  8027ef:	f7 d9                	neg    %ecx
+  8027f1:	83 d3 00             	adc    $0x0,%ebx
+  8027f4:	f7 db                	neg    %ebx
+  8027f6:	53                   	push   %ebx
+  8027f7:	51                   	push   %ecx
+  8027f8:	e8 72 fe ff ff       	call   80266f <dm>
+  8027fd:	83 c4 10             	add    $0x10,%esp
+  802800:	eb ce                	jmp    8027d0 <__divdi3+0x4b>
+
+00802802 <__moddi3>:
+  802802:	55                   	push   %ebp
+  802803:	57                   	push   %edi
+  802804:	56                   	push   %esi
+  802805:	53                   	push   %ebx
+  802806:	83 ec 18             	sub    $0x18,%esp
+  802809:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  80280d:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802811:	89 f1                	mov    %esi,%ecx
+  802813:	f7 d9                	neg    %ecx
+  802815:	89 da                	mov    %ebx,%edx
+  802817:	83 d2 00             	adc    $0x0,%edx
+  80281a:	f7 da                	neg    %edx
+  80281c:	0f 48 ce             	cmovs  %esi,%ecx
+  80281f:	0f 48 d3             	cmovs  %ebx,%edx
+  802822:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802826:	50                   	push   %eax
+  802827:	8b 74 24 38          	mov    0x38(%esp),%esi
+  80282b:	f7 de                	neg    %esi
+  80282d:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802831:	83 d0 00             	adc    $0x0,%eax
+  802834:	f7 d8                	neg    %eax
+  802836:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  80283b:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802840:	50                   	push   %eax
+  802841:	56                   	push   %esi
+  802842:	89 c8                	mov    %ecx,%eax
+  802844:	e8 26 fe ff ff       	call   80266f <dm>
+  802849:	83 c4 10             	add    $0x10,%esp
+  80284c:	85 db                	test   %ebx,%ebx
+  80284e:	78 10                	js     802860 <__moddi3+0x5e>
+  802850:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802854:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802858:	83 c4 14             	add    $0x14,%esp
+  80285b:	5b                   	pop    %ebx
+  80285c:	5e                   	pop    %esi
+  80285d:	5f                   	pop    %edi
+  80285e:	5d                   	pop    %ebp
+  80285f:	c3                   	ret
+  802860:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802864:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802868:	f7 d8                	neg    %eax
+  80286a:	83 d2 00             	adc    $0x0,%edx
+  80286d:	f7 da                	neg    %edx
+  80286f:	eb e7                	jmp    802858 <__moddi3+0x56>
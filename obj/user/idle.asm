@@ -0,0 +1,5043 @@
+
+obj/user/idle:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 19 00 00 00       	call   80004a <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/x86.h>
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 08             	sub    $0x8,%esp
+	binaryname = "idle";
+  800039:	c7 05 00 30 80 00 c0 	movl   $0x8027c0,0x803000
+  800040:	27 80 00 
+	// Instead of busy-waiting like this,
+	// a better way would be to use the processor's HLT instruction
+	// to cause the processor to stop executing until the next interrupt -
+	// doing so allows the processor to conserve power more effectively.
+	while (1) {
+		sys_yield();
+  800043:	e8 60 08 00 00       	call   8008a8 <sys_yield>
+	while (1) {
+  800048:	eb f9                	jmp    800043 <umain+0x10>
+
+0080004a <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80004a:	55                   	push   %ebp
+  80004b:	89 e5                	mov    %esp,%ebp
+  80004d:	56                   	push   %esi
+  80004e:	53                   	push   %ebx
+  80004f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800052:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  800055:	e8 9d 04 00 00       	call   8004f7 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  80005a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80005f:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  800065:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80006a:	a3 08 30 80 00       	mov    %eax,0x803008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80006f:	85 db                	test   %ebx,%ebx
+  800071:	7e 07                	jle    80007a <libmain+0x30>
+		binaryname = argv[0];
+  800073:	8b 06                	mov    (%esi),%eax
+  800075:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  80007a:	83 ec 08             	sub    $0x8,%esp
+  80007d:	56                   	push   %esi
+  80007e:	53                   	push   %ebx
+  80007f:	e8 af ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800084:	e8 0a 00 00 00       	call   800093 <exit>
+}
+  800089:	83 c4 10             	add    $0x10,%esp
+  80008c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008f:	5b                   	pop    %ebx
+  800090:	5e                   	pop    %esi
+  800091:	5d                   	pop    %ebp
+  800092:	c3                   	ret
+
+00800093 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800093:	55                   	push   %ebp
+  800094:	89 e5                	mov    %esp,%ebp
+  800096:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  800099:	6a 00                	push   $0x0
+  80009b:	e8 95 03 00 00       	call   800435 <sys_env_destroy>
+}
+  8000a0:	83 c4 10             	add    $0x10,%esp
+  8000a3:	c9                   	leave
+  8000a4:	c3                   	ret
+
+008000a5 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  8000a5:	55                   	push   %ebp
+  8000a6:	89 e5                	mov    %esp,%ebp
+  8000a8:	57                   	push   %edi
+  8000a9:	56                   	push   %esi
+  8000aa:	53                   	push   %ebx
+  8000ab:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  8000b1:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  8000b7:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  8000bd:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  8000c3:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  8000ca:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  8000cd:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  8000d4:	00 00 00 
+		if (num == SYS_page_map_vec)
+  8000d7:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  8000de:	74 76                	je     800156 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  8000e0:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  8000e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8000e9:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  8000ef:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8000f6:	0f 88 06 01 00 00    	js     800202 <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  8000fc:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800103:	0f 84 48 01 00 00    	je     800251 <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800109:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  80010f:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800115:	be 00 00 00 00       	mov    $0x0,%esi
+  80011a:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800120:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800123:	55                   	push   %ebp
+  800124:	68 2d 01 80 00       	push   $0x80012d
+  800129:	89 e5                	mov    %esp,%ebp
+  80012b:	0f 34                	sysenter
+  80012d:	83 c4 04             	add    $0x4,%esp
+  800130:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800131:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800137:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  80013d:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800140:	0f 85 9a 01 00 00    	jne    8002e0 <page_vec_call+0x23b>
+  800146:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80014b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80014e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800151:	e9 29 01 00 00       	jmp    80027f <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800156:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  80015c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80015f:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800161:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800168:	78 2f                	js     800199 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  80016a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800171:	74 72                	je     8001e5 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800173:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800179:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  80017f:	b8 10 00 00 00       	mov    $0x10,%eax
+  800184:	89 fb                	mov    %edi,%ebx
+  800186:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800189:	55                   	push   %ebp
+  80018a:	68 93 01 80 00       	push   $0x800193
+  80018f:	89 e5                	mov    %esp,%ebp
+  800191:	0f 34                	sysenter
+  800193:	83 c4 04             	add    $0x4,%esp
+  800196:	5d                   	pop    %ebp
+	return ret;
+  800197:	eb 98                	jmp    800131 <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800199:	b8 01 00 00 00       	mov    $0x1,%eax
+  80019e:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  8001a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8001a5:	f6 c6 08             	test   $0x8,%dh
+  8001a8:	74 15                	je     8001bf <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8001aa:	89 c2                	mov    %eax,%edx
+  8001ac:	c1 ea 08             	shr    $0x8,%edx
+  8001af:	83 e2 0f             	and    $0xf,%edx
+  8001b2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8001b7:	83 fa 06             	cmp    $0x6,%edx
+  8001ba:	74 0e                	je     8001ca <page_vec_call+0x125>
+  8001bc:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8001bf:	0f b6 c9             	movzbl %cl,%ecx
+  8001c2:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8001c8:	eb a0                	jmp    80016a <page_vec_call+0xc5>
+  8001ca:	89 c2                	mov    %eax,%edx
+  8001cc:	c1 ea 04             	shr    $0x4,%edx
+  8001cf:	83 e2 0f             	and    $0xf,%edx
+  8001d2:	83 fa 02             	cmp    $0x2,%edx
+  8001d5:	77 e5                	ja     8001bc <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  8001d7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8001da:	83 f8 02             	cmp    $0x2,%eax
+  8001dd:	0f 97 c1             	seta   %cl
+  8001e0:	0f b6 c9             	movzbl %cl,%ecx
+  8001e3:	eb d7                	jmp    8001bc <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  8001e5:	b8 10 00 00 00       	mov    $0x10,%eax
+  8001ea:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  8001f0:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  8001f6:	89 fb                	mov    %edi,%ebx
+  8001f8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8001fb:	cd 30                	int    $0x30
+  8001fd:	e9 2f ff ff ff       	jmp    800131 <page_vec_call+0x8c>
+  800202:	b8 01 00 00 00       	mov    $0x1,%eax
+  800207:	0f a2                	cpuid
+		return 0;
+  800209:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80020e:	f6 c6 08             	test   $0x8,%dh
+  800211:	74 15                	je     800228 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800213:	89 c2                	mov    %eax,%edx
+  800215:	c1 ea 08             	shr    $0x8,%edx
+  800218:	83 e2 0f             	and    $0xf,%edx
+  80021b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800220:	83 fa 06             	cmp    $0x6,%edx
+  800223:	74 11                	je     800236 <page_vec_call+0x191>
+  800225:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800228:	0f b6 c9             	movzbl %cl,%ecx
+  80022b:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800231:	e9 c6 fe ff ff       	jmp    8000fc <page_vec_call+0x57>
+  800236:	89 c2                	mov    %eax,%edx
+  800238:	c1 ea 04             	shr    $0x4,%edx
+  80023b:	83 e2 0f             	and    $0xf,%edx
+  80023e:	83 fa 02             	cmp    $0x2,%edx
+  800241:	77 e2                	ja     800225 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800243:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800246:	83 f8 02             	cmp    $0x2,%eax
+  800249:	0f 97 c1             	seta   %cl
+  80024c:	0f b6 c9             	movzbl %cl,%ecx
+  80024f:	eb d4                	jmp    800225 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800251:	be 00 00 00 00       	mov    $0x0,%esi
+  800256:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  80025c:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800262:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800268:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80026b:	cd 30                	int    $0x30
+  80026d:	e9 bf fe ff ff       	jmp    800131 <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800272:	29 da                	sub    %ebx,%edx
+			vec++;
+  800274:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800277:	83 e8 01             	sub    $0x1,%eax
+  80027a:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  80027f:	85 c0                	test   %eax,%eax
+  800281:	74 58                	je     8002db <page_vec_call+0x236>
+  800283:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800286:	39 da                	cmp    %ebx,%edx
+  800288:	73 e8                	jae    800272 <page_vec_call+0x1cd>
+  80028a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80028d:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800290:	84 c9                	test   %cl,%cl
+  800292:	74 06                	je     80029a <page_vec_call+0x1f5>
+  800294:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  80029a:	83 ec 04             	sub    $0x4,%esp
+  80029d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8002a0:	c1 e0 04             	shl    $0x4,%eax
+  8002a3:	50                   	push   %eax
+  8002a4:	ff 75 08             	push   0x8(%ebp)
+  8002a7:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  8002ad:	53                   	push   %ebx
+  8002ae:	e8 41 21 00 00       	call   8023f4 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  8002b3:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  8002b9:	89 c2                	mov    %eax,%edx
+  8002bb:	c1 e2 0c             	shl    $0xc,%edx
+  8002be:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  8002c4:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  8002ca:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  8002d0:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  8002d3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  8002d6:	e9 f2 fd ff ff       	jmp    8000cd <page_vec_call+0x28>
+			r = 0;
+  8002db:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  8002e0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8002e4:	74 0b                	je     8002f1 <page_vec_call+0x24c>
+		*done = total;
+  8002e6:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002e9:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  8002ef:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  8002f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002f4:	5b                   	pop    %ebx
+  8002f5:	5e                   	pop    %esi
+  8002f6:	5f                   	pop    %edi
+  8002f7:	5d                   	pop    %ebp
+  8002f8:	c3                   	ret
+
+008002f9 <sys_cputs>:
+{
+  8002f9:	55                   	push   %ebp
+  8002fa:	89 e5                	mov    %esp,%ebp
+  8002fc:	57                   	push   %edi
+  8002fd:	56                   	push   %esi
+  8002fe:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8002ff:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800306:	78 2d                	js     800335 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800308:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80030f:	74 70                	je     800381 <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800311:	b8 00 00 00 00       	mov    $0x0,%eax
+  800316:	8b 55 08             	mov    0x8(%ebp),%edx
+  800319:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80031c:	89 c3                	mov    %eax,%ebx
+  80031e:	89 c7                	mov    %eax,%edi
+  800320:	89 c6                	mov    %eax,%esi
+  800322:	55                   	push   %ebp
+  800323:	68 2c 03 80 00       	push   $0x80032c
+  800328:	89 e5                	mov    %esp,%ebp
+  80032a:	0f 34                	sysenter
+  80032c:	83 c4 04             	add    $0x4,%esp
+  80032f:	5d                   	pop    %ebp
+}
+  800330:	5b                   	pop    %ebx
+  800331:	5e                   	pop    %esi
+  800332:	5f                   	pop    %edi
+  800333:	5d                   	pop    %ebp
+  800334:	c3                   	ret
+  800335:	b8 01 00 00 00       	mov    $0x1,%eax
+  80033a:	0f a2                	cpuid
+		return 0;
+  80033c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800341:	f6 c6 08             	test   $0x8,%dh
+  800344:	74 15                	je     80035b <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800346:	89 c2                	mov    %eax,%edx
+  800348:	c1 ea 08             	shr    $0x8,%edx
+  80034b:	83 e2 0f             	and    $0xf,%edx
+  80034e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800353:	83 fa 06             	cmp    $0x6,%edx
+  800356:	74 0e                	je     800366 <sys_cputs+0x6d>
+  800358:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80035b:	0f b6 c9             	movzbl %cl,%ecx
+  80035e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800364:	eb a2                	jmp    800308 <sys_cputs+0xf>
+  800366:	89 c2                	mov    %eax,%edx
+  800368:	c1 ea 04             	shr    $0x4,%edx
+  80036b:	83 e2 0f             	and    $0xf,%edx
+  80036e:	83 fa 02             	cmp    $0x2,%edx
+  800371:	77 e5                	ja     800358 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800373:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800376:	83 f8 02             	cmp    $0x2,%eax
+  800379:	0f 97 c1             	seta   %cl
+  80037c:	0f b6 c9             	movzbl %cl,%ecx
+  80037f:	eb d7                	jmp    800358 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800381:	b8 00 00 00 00       	mov    $0x0,%eax
+  800386:	8b 55 08             	mov    0x8(%ebp),%edx
+  800389:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80038c:	89 c3                	mov    %eax,%ebx
+  80038e:	89 c7                	mov    %eax,%edi
+  800390:	89 c6                	mov    %eax,%esi
+  800392:	cd 30                	int    $0x30
+}
+  800394:	eb 9a                	jmp    800330 <sys_cputs+0x37>
+
+00800396 <sys_cgetc>:
+{
+  800396:	55                   	push   %ebp
+  800397:	89 e5                	mov    %esp,%ebp
+  800399:	57                   	push   %edi
+  80039a:	56                   	push   %esi
+  80039b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80039c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8003a3:	78 2e                	js     8003d3 <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  8003a5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8003ac:	74 71                	je     80041f <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  8003ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003b3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8003b8:	89 d1                	mov    %edx,%ecx
+  8003ba:	89 d3                	mov    %edx,%ebx
+  8003bc:	89 d7                	mov    %edx,%edi
+  8003be:	89 d6                	mov    %edx,%esi
+  8003c0:	55                   	push   %ebp
+  8003c1:	68 ca 03 80 00       	push   $0x8003ca
+  8003c6:	89 e5                	mov    %esp,%ebp
+  8003c8:	0f 34                	sysenter
+  8003ca:	83 c4 04             	add    $0x4,%esp
+  8003cd:	5d                   	pop    %ebp
+}
+  8003ce:	5b                   	pop    %ebx
+  8003cf:	5e                   	pop    %esi
+  8003d0:	5f                   	pop    %edi
+  8003d1:	5d                   	pop    %ebp
+  8003d2:	c3                   	ret
+  8003d3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8003d8:	0f a2                	cpuid
+		return 0;
+  8003da:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8003df:	f6 c6 08             	test   $0x8,%dh
+  8003e2:	74 15                	je     8003f9 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8003e4:	89 c2                	mov    %eax,%edx
+  8003e6:	c1 ea 08             	shr    $0x8,%edx
+  8003e9:	83 e2 0f             	and    $0xf,%edx
+  8003ec:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8003f1:	83 fa 06             	cmp    $0x6,%edx
+  8003f4:	74 0e                	je     800404 <sys_cgetc+0x6e>
+  8003f6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8003f9:	0f b6 c9             	movzbl %cl,%ecx
+  8003fc:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800402:	eb a1                	jmp    8003a5 <sys_cgetc+0xf>
+  800404:	89 c2                	mov    %eax,%edx
+  800406:	c1 ea 04             	shr    $0x4,%edx
+  800409:	83 e2 0f             	and    $0xf,%edx
+  80040c:	83 fa 02             	cmp    $0x2,%edx
+  80040f:	77 e5                	ja     8003f6 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  800411:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800414:	83 f8 02             	cmp    $0x2,%eax
+  800417:	0f 97 c1             	seta   %cl
+  80041a:	0f b6 c9             	movzbl %cl,%ecx
+  80041d:	eb d7                	jmp    8003f6 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  80041f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800424:	b8 01 00 00 00       	mov    $0x1,%eax
+  800429:	89 d1                	mov    %edx,%ecx
+  80042b:	89 d3                	mov    %edx,%ebx
+  80042d:	89 d7                	mov    %edx,%edi
+  80042f:	89 d6                	mov    %edx,%esi
+  800431:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800433:	eb 99                	jmp    8003ce <sys_cgetc+0x38>
+
+00800435 <sys_env_destroy>:
+{
+  800435:	55                   	push   %ebp
+  800436:	89 e5                	mov    %esp,%ebp
+  800438:	57                   	push   %edi
+  800439:	56                   	push   %esi
+  80043a:	53                   	push   %ebx
+  80043b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80043e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800445:	78 36                	js     80047d <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  800447:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80044e:	74 79                	je     8004c9 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  800450:	8b 55 08             	mov    0x8(%ebp),%edx
+  800453:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800458:	b8 03 00 00 00       	mov    $0x3,%eax
+  80045d:	89 cb                	mov    %ecx,%ebx
+  80045f:	89 cf                	mov    %ecx,%edi
+  800461:	89 ce                	mov    %ecx,%esi
+  800463:	55                   	push   %ebp
+  800464:	68 6d 04 80 00       	push   $0x80046d
+  800469:	89 e5                	mov    %esp,%ebp
+  80046b:	0f 34                	sysenter
+  80046d:	83 c4 04             	add    $0x4,%esp
+  800470:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800471:	85 c0                	test   %eax,%eax
+  800473:	7f 6b                	jg     8004e0 <sys_env_destroy+0xab>
+}
+  800475:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800478:	5b                   	pop    %ebx
+  800479:	5e                   	pop    %esi
+  80047a:	5f                   	pop    %edi
+  80047b:	5d                   	pop    %ebp
+  80047c:	c3                   	ret
+  80047d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800482:	0f a2                	cpuid
+		return 0;
+  800484:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800489:	f6 c6 08             	test   $0x8,%dh
+  80048c:	74 15                	je     8004a3 <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80048e:	89 c2                	mov    %eax,%edx
+  800490:	c1 ea 08             	shr    $0x8,%edx
+  800493:	83 e2 0f             	and    $0xf,%edx
+  800496:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80049b:	83 fa 06             	cmp    $0x6,%edx
+  80049e:	74 0e                	je     8004ae <sys_env_destroy+0x79>
+  8004a0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8004a3:	0f b6 c9             	movzbl %cl,%ecx
+  8004a6:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8004ac:	eb 99                	jmp    800447 <sys_env_destroy+0x12>
+  8004ae:	89 c2                	mov    %eax,%edx
+  8004b0:	c1 ea 04             	shr    $0x4,%edx
+  8004b3:	83 e2 0f             	and    $0xf,%edx
+  8004b6:	83 fa 02             	cmp    $0x2,%edx
+  8004b9:	77 e5                	ja     8004a0 <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  8004bb:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8004be:	83 f8 02             	cmp    $0x2,%eax
+  8004c1:	0f 97 c1             	seta   %cl
+  8004c4:	0f b6 c9             	movzbl %cl,%ecx
+  8004c7:	eb d7                	jmp    8004a0 <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  8004c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004ce:	b8 03 00 00 00       	mov    $0x3,%eax
+  8004d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004d6:	89 cb                	mov    %ecx,%ebx
+  8004d8:	89 cf                	mov    %ecx,%edi
+  8004da:	89 ce                	mov    %ecx,%esi
+  8004dc:	cd 30                	int    $0x30
+  8004de:	eb 91                	jmp    800471 <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004e0:	83 ec 0c             	sub    $0xc,%esp
+  8004e3:	50                   	push   %eax
+  8004e4:	6a 03                	push   $0x3
+  8004e6:	68 cf 27 80 00       	push   $0x8027cf
+  8004eb:	6a 4a                	push   $0x4a
+  8004ed:	68 ec 27 80 00       	push   $0x8027ec
+  8004f2:	e8 1e 17 00 00       	call   801c15 <_panic>
+
+008004f7 <sys_getenvid>:
+{
+  8004f7:	55                   	push   %ebp
+  8004f8:	89 e5                	mov    %esp,%ebp
+  8004fa:	57                   	push   %edi
+  8004fb:	56                   	push   %esi
+  8004fc:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8004fd:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800504:	78 2e                	js     800534 <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  800506:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80050d:	74 71                	je     800580 <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  80050f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800514:	b8 02 00 00 00       	mov    $0x2,%eax
+  800519:	89 d1                	mov    %edx,%ecx
+  80051b:	89 d3                	mov    %edx,%ebx
+  80051d:	89 d7                	mov    %edx,%edi
+  80051f:	89 d6                	mov    %edx,%esi
+  800521:	55                   	push   %ebp
+  800522:	68 2b 05 80 00       	push   $0x80052b
+  800527:	89 e5                	mov    %esp,%ebp
+  800529:	0f 34                	sysenter
+  80052b:	83 c4 04             	add    $0x4,%esp
+  80052e:	5d                   	pop    %ebp
+}
+  80052f:	5b                   	pop    %ebx
+  800530:	5e                   	pop    %esi
+  800531:	5f                   	pop    %edi
+  800532:	5d                   	pop    %ebp
+  800533:	c3                   	ret
+  800534:	b8 01 00 00 00       	mov    $0x1,%eax
+  800539:	0f a2                	cpuid
+		return 0;
+  80053b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800540:	f6 c6 08             	test   $0x8,%dh
+  800543:	74 15                	je     80055a <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800545:	89 c2                	mov    %eax,%edx
+  800547:	c1 ea 08             	shr    $0x8,%edx
+  80054a:	83 e2 0f             	and    $0xf,%edx
+  80054d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800552:	83 fa 06             	cmp    $0x6,%edx
+  800555:	74 0e                	je     800565 <sys_getenvid+0x6e>
+  800557:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80055a:	0f b6 c9             	movzbl %cl,%ecx
+  80055d:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800563:	eb a1                	jmp    800506 <sys_getenvid+0xf>
+  800565:	89 c2                	mov    %eax,%edx
+  800567:	c1 ea 04             	shr    $0x4,%edx
+  80056a:	83 e2 0f             	and    $0xf,%edx
+  80056d:	83 fa 02             	cmp    $0x2,%edx
+  800570:	77 e5                	ja     800557 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  800572:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800575:	83 f8 02             	cmp    $0x2,%eax
+  800578:	0f 97 c1             	seta   %cl
+  80057b:	0f b6 c9             	movzbl %cl,%ecx
+  80057e:	eb d7                	jmp    800557 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  800580:	ba 00 00 00 00       	mov    $0x0,%edx
+  800585:	b8 02 00 00 00       	mov    $0x2,%eax
+  80058a:	89 d1                	mov    %edx,%ecx
+  80058c:	89 d3                	mov    %edx,%ebx
+  80058e:	89 d7                	mov    %edx,%edi
+  800590:	89 d6                	mov    %edx,%esi
+  800592:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  800594:	eb 99                	jmp    80052f <sys_getenvid+0x38>
+
+00800596 <sys_page_alloc>:
+{
+  800596:	55                   	push   %ebp
+  800597:	89 e5                	mov    %esp,%ebp
+  800599:	57                   	push   %edi
+  80059a:	56                   	push   %esi
+  80059b:	53                   	push   %ebx
+  80059c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80059f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8005a6:	78 38                	js     8005e0 <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  8005a8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8005af:	74 7b                	je     80062c <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  8005b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8005b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005bc:	b8 04 00 00 00       	mov    $0x4,%eax
+  8005c1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005c4:	89 f7                	mov    %esi,%edi
+  8005c6:	55                   	push   %ebp
+  8005c7:	68 d0 05 80 00       	push   $0x8005d0
+  8005cc:	89 e5                	mov    %esp,%ebp
+  8005ce:	0f 34                	sysenter
+  8005d0:	83 c4 04             	add    $0x4,%esp
+  8005d3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8005d4:	85 c0                	test   %eax,%eax
+  8005d6:	7f 6d                	jg     800645 <sys_page_alloc+0xaf>
+}
+  8005d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005db:	5b                   	pop    %ebx
+  8005dc:	5e                   	pop    %esi
+  8005dd:	5f                   	pop    %edi
+  8005de:	5d                   	pop    %ebp
+  8005df:	c3                   	ret
+  8005e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8005e5:	0f a2                	cpuid
+		return 0;
+  8005e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8005ec:	f6 c6 08             	test   $0x8,%dh
+  8005ef:	74 15                	je     800606 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8005f1:	89 c2                	mov    %eax,%edx
+  8005f3:	c1 ea 08             	shr    $0x8,%edx
+  8005f6:	83 e2 0f             	and    $0xf,%edx
+  8005f9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8005fe:	83 fa 06             	cmp    $0x6,%edx
+  800601:	74 0e                	je     800611 <sys_page_alloc+0x7b>
+  800603:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800606:	0f b6 c9             	movzbl %cl,%ecx
+  800609:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80060f:	eb 97                	jmp    8005a8 <sys_page_alloc+0x12>
+  800611:	89 c2                	mov    %eax,%edx
+  800613:	c1 ea 04             	shr    $0x4,%edx
+  800616:	83 e2 0f             	and    $0xf,%edx
+  800619:	83 fa 02             	cmp    $0x2,%edx
+  80061c:	77 e5                	ja     800603 <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  80061e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800621:	83 f8 02             	cmp    $0x2,%eax
+  800624:	0f 97 c1             	seta   %cl
+  800627:	0f b6 c9             	movzbl %cl,%ecx
+  80062a:	eb d7                	jmp    800603 <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  80062c:	be 00 00 00 00       	mov    $0x0,%esi
+  800631:	b8 04 00 00 00       	mov    $0x4,%eax
+  800636:	8b 55 08             	mov    0x8(%ebp),%edx
+  800639:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80063c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80063f:	89 f7                	mov    %esi,%edi
+  800641:	cd 30                	int    $0x30
+  800643:	eb 8f                	jmp    8005d4 <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800645:	83 ec 0c             	sub    $0xc,%esp
+  800648:	50                   	push   %eax
+  800649:	6a 04                	push   $0x4
+  80064b:	68 cf 27 80 00       	push   $0x8027cf
+  800650:	6a 4a                	push   $0x4a
+  800652:	68 ec 27 80 00       	push   $0x8027ec
+  800657:	e8 b9 15 00 00       	call   801c15 <_panic>
+
+0080065c <sys_page_map>:
+{
+  80065c:	55                   	push   %ebp
+  80065d:	89 e5                	mov    %esp,%ebp
+  80065f:	57                   	push   %edi
+  800660:	56                   	push   %esi
+  800661:	53                   	push   %ebx
+  800662:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800665:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80066c:	78 37                	js     8006a5 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  80066e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800675:	74 7a                	je     8006f1 <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  800677:	8b 55 08             	mov    0x8(%ebp),%edx
+  80067a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80067d:	b8 05 00 00 00       	mov    $0x5,%eax
+  800682:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800685:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800688:	8b 75 18             	mov    0x18(%ebp),%esi
+  80068b:	55                   	push   %ebp
+  80068c:	68 95 06 80 00       	push   $0x800695
+  800691:	89 e5                	mov    %esp,%ebp
+  800693:	0f 34                	sysenter
+  800695:	83 c4 04             	add    $0x4,%esp
+  800698:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800699:	85 c0                	test   %eax,%eax
+  80069b:	7f 6c                	jg     800709 <sys_page_map+0xad>
+}
+  80069d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006a0:	5b                   	pop    %ebx
+  8006a1:	5e                   	pop    %esi
+  8006a2:	5f                   	pop    %edi
+  8006a3:	5d                   	pop    %ebp
+  8006a4:	c3                   	ret
+  8006a5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8006aa:	0f a2                	cpuid
+		return 0;
+  8006ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8006b1:	f6 c6 08             	test   $0x8,%dh
+  8006b4:	74 15                	je     8006cb <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8006b6:	89 c2                	mov    %eax,%edx
+  8006b8:	c1 ea 08             	shr    $0x8,%edx
+  8006bb:	83 e2 0f             	and    $0xf,%edx
+  8006be:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8006c3:	83 fa 06             	cmp    $0x6,%edx
+  8006c6:	74 0e                	je     8006d6 <sys_page_map+0x7a>
+  8006c8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8006cb:	0f b6 c9             	movzbl %cl,%ecx
+  8006ce:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8006d4:	eb 98                	jmp    80066e <sys_page_map+0x12>
+  8006d6:	89 c2                	mov    %eax,%edx
+  8006d8:	c1 ea 04             	shr    $0x4,%edx
+  8006db:	83 e2 0f             	and    $0xf,%edx
+  8006de:	83 fa 02             	cmp    $0x2,%edx
+  8006e1:	77 e5                	ja     8006c8 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  8006e3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8006e6:	83 f8 02             	cmp    $0x2,%eax
+  8006e9:	0f 97 c1             	seta   %cl
+  8006ec:	0f b6 c9             	movzbl %cl,%ecx
+  8006ef:	eb d7                	jmp    8006c8 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  8006f1:	b8 05 00 00 00       	mov    $0x5,%eax
+  8006f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8006ff:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800702:	8b 75 18             	mov    0x18(%ebp),%esi
+  800705:	cd 30                	int    $0x30
+  800707:	eb 90                	jmp    800699 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800709:	83 ec 0c             	sub    $0xc,%esp
+  80070c:	50                   	push   %eax
+  80070d:	6a 05                	push   $0x5
+  80070f:	68 cf 27 80 00       	push   $0x8027cf
+  800714:	6a 4a                	push   $0x4a
+  800716:	68 ec 27 80 00       	push   $0x8027ec
+  80071b:	e8 f5 14 00 00       	call   801c15 <_panic>
+
+00800720 <sys_page_unmap>:
+{
+  800720:	55                   	push   %ebp
+  800721:	89 e5                	mov    %esp,%ebp
+  800723:	57                   	push   %edi
+  800724:	56                   	push   %esi
+  800725:	53                   	push   %ebx
+  800726:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800729:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800730:	78 37                	js     800769 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  800732:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800739:	74 7a                	je     8007b5 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  80073b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800740:	8b 55 08             	mov    0x8(%ebp),%edx
+  800743:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800746:	b8 06 00 00 00       	mov    $0x6,%eax
+  80074b:	89 df                	mov    %ebx,%edi
+  80074d:	89 de                	mov    %ebx,%esi
+  80074f:	55                   	push   %ebp
+  800750:	68 59 07 80 00       	push   $0x800759
+  800755:	89 e5                	mov    %esp,%ebp
+  800757:	0f 34                	sysenter
+  800759:	83 c4 04             	add    $0x4,%esp
+  80075c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80075d:	85 c0                	test   %eax,%eax
+  80075f:	7f 6c                	jg     8007cd <sys_page_unmap+0xad>
+}
+  800761:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800764:	5b                   	pop    %ebx
+  800765:	5e                   	pop    %esi
+  800766:	5f                   	pop    %edi
+  800767:	5d                   	pop    %ebp
+  800768:	c3                   	ret
+  800769:	b8 01 00 00 00       	mov    $0x1,%eax
+  80076e:	0f a2                	cpuid
+		return 0;
+  800770:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800775:	f6 c6 08             	test   $0x8,%dh
+  800778:	74 15                	je     80078f <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80077a:	89 c2                	mov    %eax,%edx
+  80077c:	c1 ea 08             	shr    $0x8,%edx
+  80077f:	83 e2 0f             	and    $0xf,%edx
+  800782:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800787:	83 fa 06             	cmp    $0x6,%edx
+  80078a:	74 0e                	je     80079a <sys_page_unmap+0x7a>
+  80078c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80078f:	0f b6 c9             	movzbl %cl,%ecx
+  800792:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800798:	eb 98                	jmp    800732 <sys_page_unmap+0x12>
+  80079a:	89 c2                	mov    %eax,%edx
+  80079c:	c1 ea 04             	shr    $0x4,%edx
+  80079f:	83 e2 0f             	and    $0xf,%edx
+  8007a2:	83 fa 02             	cmp    $0x2,%edx
+  8007a5:	77 e5                	ja     80078c <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  8007a7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8007aa:	83 f8 02             	cmp    $0x2,%eax
+  8007ad:	0f 97 c1             	seta   %cl
+  8007b0:	0f b6 c9             	movzbl %cl,%ecx
+  8007b3:	eb d7                	jmp    80078c <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  8007b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007ba:	b8 06 00 00 00       	mov    $0x6,%eax
+  8007bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007c5:	89 df                	mov    %ebx,%edi
+  8007c7:	89 de                	mov    %ebx,%esi
+  8007c9:	cd 30                	int    $0x30
+  8007cb:	eb 90                	jmp    80075d <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8007cd:	83 ec 0c             	sub    $0xc,%esp
+  8007d0:	50                   	push   %eax
+  8007d1:	6a 06                	push   $0x6
+  8007d3:	68 cf 27 80 00       	push   $0x8027cf
+  8007d8:	6a 4a                	push   $0x4a
+  8007da:	68 ec 27 80 00       	push   $0x8027ec
+  8007df:	e8 31 14 00 00       	call   801c15 <_panic>
+
+008007e4 <sys_page_copy>:
+{
+  8007e4:	55                   	push   %ebp
+  8007e5:	89 e5                	mov    %esp,%ebp
+  8007e7:	57                   	push   %edi
+  8007e8:	56                   	push   %esi
+  8007e9:	53                   	push   %ebx
+  8007ea:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8007ed:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8007f4:	78 37                	js     80082d <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  8007f6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8007fd:	74 7a                	je     800879 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  8007ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  800802:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800805:	b8 29 00 00 00       	mov    $0x29,%eax
+  80080a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80080d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800810:	8b 75 18             	mov    0x18(%ebp),%esi
+  800813:	55                   	push   %ebp
+  800814:	68 1d 08 80 00       	push   $0x80081d
+  800819:	89 e5                	mov    %esp,%ebp
+  80081b:	0f 34                	sysenter
+  80081d:	83 c4 04             	add    $0x4,%esp
+  800820:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800821:	85 c0                	test   %eax,%eax
+  800823:	7f 6c                	jg     800891 <sys_page_copy+0xad>
+}
+  800825:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800828:	5b                   	pop    %ebx
+  800829:	5e                   	pop    %esi
+  80082a:	5f                   	pop    %edi
+  80082b:	5d                   	pop    %ebp
+  80082c:	c3                   	ret
+  80082d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800832:	0f a2                	cpuid
+		return 0;
+  800834:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800839:	f6 c6 08             	test   $0x8,%dh
+  80083c:	74 15                	je     800853 <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80083e:	89 c2                	mov    %eax,%edx
+  800840:	c1 ea 08             	shr    $0x8,%edx
+  800843:	83 e2 0f             	and    $0xf,%edx
+  800846:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80084b:	83 fa 06             	cmp    $0x6,%edx
+  80084e:	74 0e                	je     80085e <sys_page_copy+0x7a>
+  800850:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800853:	0f b6 c9             	movzbl %cl,%ecx
+  800856:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80085c:	eb 98                	jmp    8007f6 <sys_page_copy+0x12>
+  80085e:	89 c2                	mov    %eax,%edx
+  800860:	c1 ea 04             	shr    $0x4,%edx
+  800863:	83 e2 0f             	and    $0xf,%edx
+  800866:	83 fa 02             	cmp    $0x2,%edx
+  800869:	77 e5                	ja     800850 <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  80086b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80086e:	83 f8 02             	cmp    $0x2,%eax
+  800871:	0f 97 c1             	seta   %cl
+  800874:	0f b6 c9             	movzbl %cl,%ecx
+  800877:	eb d7                	jmp    800850 <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  800879:	b8 29 00 00 00       	mov    $0x29,%eax
+  80087e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800881:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800884:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800887:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80088a:	8b 75 18             	mov    0x18(%ebp),%esi
+  80088d:	cd 30                	int    $0x30
+  80088f:	eb 90                	jmp    800821 <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800891:	83 ec 0c             	sub    $0xc,%esp
+  800894:	50                   	push   %eax
+  800895:	6a 29                	push   $0x29
+  800897:	68 cf 27 80 00       	push   $0x8027cf
+  80089c:	6a 4a                	push   $0x4a
+  80089e:	68 ec 27 80 00       	push   $0x8027ec
+  8008a3:	e8 6d 13 00 00       	call   801c15 <_panic>
+
+008008a8 <sys_yield>:
+{
+  8008a8:	55                   	push   %ebp
+  8008a9:	89 e5                	mov    %esp,%ebp
+  8008ab:	57                   	push   %edi
+  8008ac:	56                   	push   %esi
+  8008ad:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8008ae:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8008b5:	78 2e                	js     8008e5 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  8008b7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8008be:	74 71                	je     800931 <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  8008c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008c5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8008ca:	89 d1                	mov    %edx,%ecx
+  8008cc:	89 d3                	mov    %edx,%ebx
+  8008ce:	89 d7                	mov    %edx,%edi
+  8008d0:	89 d6                	mov    %edx,%esi
+  8008d2:	55                   	push   %ebp
+  8008d3:	68 dc 08 80 00       	push   $0x8008dc
+  8008d8:	89 e5                	mov    %esp,%ebp
+  8008da:	0f 34                	sysenter
+  8008dc:	83 c4 04             	add    $0x4,%esp
+  8008df:	5d                   	pop    %ebp
+}
+  8008e0:	5b                   	pop    %ebx
+  8008e1:	5e                   	pop    %esi
+  8008e2:	5f                   	pop    %edi
+  8008e3:	5d                   	pop    %ebp
+  8008e4:	c3                   	ret
+  8008e5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8008ea:	0f a2                	cpuid
+		return 0;
+  8008ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8008f1:	f6 c6 08             	test   $0x8,%dh
+  8008f4:	74 15                	je     80090b <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8008f6:	89 c2                	mov    %eax,%edx
+  8008f8:	c1 ea 08             	shr    $0x8,%edx
+  8008fb:	83 e2 0f             	and    $0xf,%edx
+  8008fe:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800903:	83 fa 06             	cmp    $0x6,%edx
+  800906:	74 0e                	je     800916 <sys_yield+0x6e>
+  800908:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80090b:	0f b6 c9             	movzbl %cl,%ecx
+  80090e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800914:	eb a1                	jmp    8008b7 <sys_yield+0xf>
+  800916:	89 c2                	mov    %eax,%edx
+  800918:	c1 ea 04             	shr    $0x4,%edx
+  80091b:	83 e2 0f             	and    $0xf,%edx
+  80091e:	83 fa 02             	cmp    $0x2,%edx
+  800921:	77 e5                	ja     800908 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  800923:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800926:	83 f8 02             	cmp    $0x2,%eax
+  800929:	0f 97 c1             	seta   %cl
+  80092c:	0f b6 c9             	movzbl %cl,%ecx
+  80092f:	eb d7                	jmp    800908 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  800931:	ba 00 00 00 00       	mov    $0x0,%edx
+  800936:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80093b:	89 d1                	mov    %edx,%ecx
+  80093d:	89 d3                	mov    %edx,%ebx
+  80093f:	89 d7                	mov    %edx,%edi
+  800941:	89 d6                	mov    %edx,%esi
+  800943:	cd 30                	int    $0x30
+}
+  800945:	eb 99                	jmp    8008e0 <sys_yield+0x38>
+
+00800947 <sys_env_set_status>:
+{
+  800947:	55                   	push   %ebp
+  800948:	89 e5                	mov    %esp,%ebp
+  80094a:	57                   	push   %edi
+  80094b:	56                   	push   %esi
+  80094c:	53                   	push   %ebx
+  80094d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800950:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800957:	78 37                	js     800990 <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  800959:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800960:	74 7a                	je     8009dc <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  800962:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800967:	8b 55 08             	mov    0x8(%ebp),%edx
+  80096a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80096d:	b8 08 00 00 00       	mov    $0x8,%eax
+  800972:	89 df                	mov    %ebx,%edi
+  800974:	89 de                	mov    %ebx,%esi
+  800976:	55                   	push   %ebp
+  800977:	68 80 09 80 00       	push   $0x800980
+  80097c:	89 e5                	mov    %esp,%ebp
+  80097e:	0f 34                	sysenter
+  800980:	83 c4 04             	add    $0x4,%esp
+  800983:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800984:	85 c0                	test   %eax,%eax
+  800986:	7f 6c                	jg     8009f4 <sys_env_set_status+0xad>
+}
+  800988:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80098b:	5b                   	pop    %ebx
+  80098c:	5e                   	pop    %esi
+  80098d:	5f                   	pop    %edi
+  80098e:	5d                   	pop    %ebp
+  80098f:	c3                   	ret
+  800990:	b8 01 00 00 00       	mov    $0x1,%eax
+  800995:	0f a2                	cpuid
+		return 0;
+  800997:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80099c:	f6 c6 08             	test   $0x8,%dh
+  80099f:	74 15                	je     8009b6 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8009a1:	89 c2                	mov    %eax,%edx
+  8009a3:	c1 ea 08             	shr    $0x8,%edx
+  8009a6:	83 e2 0f             	and    $0xf,%edx
+  8009a9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8009ae:	83 fa 06             	cmp    $0x6,%edx
+  8009b1:	74 0e                	je     8009c1 <sys_env_set_status+0x7a>
+  8009b3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8009b6:	0f b6 c9             	movzbl %cl,%ecx
+  8009b9:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8009bf:	eb 98                	jmp    800959 <sys_env_set_status+0x12>
+  8009c1:	89 c2                	mov    %eax,%edx
+  8009c3:	c1 ea 04             	shr    $0x4,%edx
+  8009c6:	83 e2 0f             	and    $0xf,%edx
+  8009c9:	83 fa 02             	cmp    $0x2,%edx
+  8009cc:	77 e5                	ja     8009b3 <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  8009ce:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8009d1:	83 f8 02             	cmp    $0x2,%eax
+  8009d4:	0f 97 c1             	seta   %cl
+  8009d7:	0f b6 c9             	movzbl %cl,%ecx
+  8009da:	eb d7                	jmp    8009b3 <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  8009dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009e1:	b8 08 00 00 00       	mov    $0x8,%eax
+  8009e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009ec:	89 df                	mov    %ebx,%edi
+  8009ee:	89 de                	mov    %ebx,%esi
+  8009f0:	cd 30                	int    $0x30
+  8009f2:	eb 90                	jmp    800984 <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8009f4:	83 ec 0c             	sub    $0xc,%esp
+  8009f7:	50                   	push   %eax
+  8009f8:	6a 08                	push   $0x8
+  8009fa:	68 cf 27 80 00       	push   $0x8027cf
+  8009ff:	6a 4a                	push   $0x4a
+  800a01:	68 ec 27 80 00       	push   $0x8027ec
+  800a06:	e8 0a 12 00 00       	call   801c15 <_panic>
+
+00800a0b <sys_sysinfo>:
+{
+  800a0b:	55                   	push   %ebp
+  800a0c:	89 e5                	mov    %esp,%ebp
+  800a0e:	57                   	push   %edi
+  800a0f:	56                   	push   %esi
+  800a10:	53                   	push   %ebx
+  800a11:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800a14:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800a1b:	78 36                	js     800a53 <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  800a1d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800a24:	74 79                	je     800a9f <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  800a26:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a29:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a2e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800a33:	89 cb                	mov    %ecx,%ebx
+  800a35:	89 cf                	mov    %ecx,%edi
+  800a37:	89 ce                	mov    %ecx,%esi
+  800a39:	55                   	push   %ebp
+  800a3a:	68 43 0a 80 00       	push   $0x800a43
+  800a3f:	89 e5                	mov    %esp,%ebp
+  800a41:	0f 34                	sysenter
+  800a43:	83 c4 04             	add    $0x4,%esp
+  800a46:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800a47:	85 c0                	test   %eax,%eax
+  800a49:	7f 6b                	jg     800ab6 <sys_sysinfo+0xab>
+}
+  800a4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a4e:	5b                   	pop    %ebx
+  800a4f:	5e                   	pop    %esi
+  800a50:	5f                   	pop    %edi
+  800a51:	5d                   	pop    %ebp
+  800a52:	c3                   	ret
+  800a53:	b8 01 00 00 00       	mov    $0x1,%eax
+  800a58:	0f a2                	cpuid
+		return 0;
+  800a5a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800a5f:	f6 c6 08             	test   $0x8,%dh
+  800a62:	74 15                	je     800a79 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800a64:	89 c2                	mov    %eax,%edx
+  800a66:	c1 ea 08             	shr    $0x8,%edx
+  800a69:	83 e2 0f             	and    $0xf,%edx
+  800a6c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800a71:	83 fa 06             	cmp    $0x6,%edx
+  800a74:	74 0e                	je     800a84 <sys_sysinfo+0x79>
+  800a76:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800a79:	0f b6 c9             	movzbl %cl,%ecx
+  800a7c:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800a82:	eb 99                	jmp    800a1d <sys_sysinfo+0x12>
+  800a84:	89 c2                	mov    %eax,%edx
+  800a86:	c1 ea 04             	shr    $0x4,%edx
+  800a89:	83 e2 0f             	and    $0xf,%edx
+  800a8c:	83 fa 02             	cmp    $0x2,%edx
+  800a8f:	77 e5                	ja     800a76 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  800a91:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800a94:	83 f8 02             	cmp    $0x2,%eax
+  800a97:	0f 97 c1             	seta   %cl
+  800a9a:	0f b6 c9             	movzbl %cl,%ecx
+  800a9d:	eb d7                	jmp    800a76 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  800a9f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aa4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800aa9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aac:	89 cb                	mov    %ecx,%ebx
+  800aae:	89 cf                	mov    %ecx,%edi
+  800ab0:	89 ce                	mov    %ecx,%esi
+  800ab2:	cd 30                	int    $0x30
+  800ab4:	eb 91                	jmp    800a47 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ab6:	83 ec 0c             	sub    $0xc,%esp
+  800ab9:	50                   	push   %eax
+  800aba:	6a 0b                	push   $0xb
+  800abc:	68 cf 27 80 00       	push   $0x8027cf
+  800ac1:	6a 4a                	push   $0x4a
+  800ac3:	68 ec 27 80 00       	push   $0x8027ec
+  800ac8:	e8 48 11 00 00       	call   801c15 <_panic>
+
+00800acd <sys_env_set_trapframe>:
+{
+  800acd:	55                   	push   %ebp
+  800ace:	89 e5                	mov    %esp,%ebp
+  800ad0:	57                   	push   %edi
+  800ad1:	56                   	push   %esi
+  800ad2:	53                   	push   %ebx
+  800ad3:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800ad6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800add:	78 37                	js     800b16 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  800adf:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ae6:	74 7a                	je     800b62 <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  800ae8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800aed:	8b 55 08             	mov    0x8(%ebp),%edx
+  800af0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800af3:	b8 13 00 00 00       	mov    $0x13,%eax
+  800af8:	89 df                	mov    %ebx,%edi
+  800afa:	89 de                	mov    %ebx,%esi
+  800afc:	55                   	push   %ebp
+  800afd:	68 06 0b 80 00       	push   $0x800b06
+  800b02:	89 e5                	mov    %esp,%ebp
+  800b04:	0f 34                	sysenter
+  800b06:	83 c4 04             	add    $0x4,%esp
+  800b09:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800b0a:	85 c0                	test   %eax,%eax
+  800b0c:	7f 6c                	jg     800b7a <sys_env_set_trapframe+0xad>
+}
+  800b0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b11:	5b                   	pop    %ebx
+  800b12:	5e                   	pop    %esi
+  800b13:	5f                   	pop    %edi
+  800b14:	5d                   	pop    %ebp
+  800b15:	c3                   	ret
+  800b16:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b1b:	0f a2                	cpuid
+		return 0;
+  800b1d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800b22:	f6 c6 08             	test   $0x8,%dh
+  800b25:	74 15                	je     800b3c <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800b27:	89 c2                	mov    %eax,%edx
+  800b29:	c1 ea 08             	shr    $0x8,%edx
+  800b2c:	83 e2 0f             	and    $0xf,%edx
+  800b2f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800b34:	83 fa 06             	cmp    $0x6,%edx
+  800b37:	74 0e                	je     800b47 <sys_env_set_trapframe+0x7a>
+  800b39:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800b3c:	0f b6 c9             	movzbl %cl,%ecx
+  800b3f:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800b45:	eb 98                	jmp    800adf <sys_env_set_trapframe+0x12>
+  800b47:	89 c2                	mov    %eax,%edx
+  800b49:	c1 ea 04             	shr    $0x4,%edx
+  800b4c:	83 e2 0f             	and    $0xf,%edx
+  800b4f:	83 fa 02             	cmp    $0x2,%edx
+  800b52:	77 e5                	ja     800b39 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  800b54:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800b57:	83 f8 02             	cmp    $0x2,%eax
+  800b5a:	0f 97 c1             	seta   %cl
+  800b5d:	0f b6 c9             	movzbl %cl,%ecx
+  800b60:	eb d7                	jmp    800b39 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  800b62:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b67:	b8 13 00 00 00       	mov    $0x13,%eax
+  800b6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b72:	89 df                	mov    %ebx,%edi
+  800b74:	89 de                	mov    %ebx,%esi
+  800b76:	cd 30                	int    $0x30
+  800b78:	eb 90                	jmp    800b0a <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b7a:	83 ec 0c             	sub    $0xc,%esp
+  800b7d:	50                   	push   %eax
+  800b7e:	6a 13                	push   $0x13
+  800b80:	68 cf 27 80 00       	push   $0x8027cf
+  800b85:	6a 4a                	push   $0x4a
+  800b87:	68 ec 27 80 00       	push   $0x8027ec
+  800b8c:	e8 84 10 00 00       	call   801c15 <_panic>
+
+00800b91 <sys_env_set_stack_limit>:
+{
+  800b91:	55                   	push   %ebp
+  800b92:	89 e5                	mov    %esp,%ebp
+  800b94:	57                   	push   %edi
+  800b95:	56                   	push   %esi
+  800b96:	53                   	push   %ebx
+  800b97:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800b9a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ba1:	78 37                	js     800bda <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  800ba3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800baa:	74 7a                	je     800c26 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  800bac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bb1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bb4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bb7:	b8 19 00 00 00       	mov    $0x19,%eax
+  800bbc:	89 df                	mov    %ebx,%edi
+  800bbe:	89 de                	mov    %ebx,%esi
+  800bc0:	55                   	push   %ebp
+  800bc1:	68 ca 0b 80 00       	push   $0x800bca
+  800bc6:	89 e5                	mov    %esp,%ebp
+  800bc8:	0f 34                	sysenter
+  800bca:	83 c4 04             	add    $0x4,%esp
+  800bcd:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800bce:	85 c0                	test   %eax,%eax
+  800bd0:	7f 6c                	jg     800c3e <sys_env_set_stack_limit+0xad>
+}
+  800bd2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bd5:	5b                   	pop    %ebx
+  800bd6:	5e                   	pop    %esi
+  800bd7:	5f                   	pop    %edi
+  800bd8:	5d                   	pop    %ebp
+  800bd9:	c3                   	ret
+  800bda:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bdf:	0f a2                	cpuid
+		return 0;
+  800be1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800be6:	f6 c6 08             	test   $0x8,%dh
+  800be9:	74 15                	je     800c00 <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800beb:	89 c2                	mov    %eax,%edx
+  800bed:	c1 ea 08             	shr    $0x8,%edx
+  800bf0:	83 e2 0f             	and    $0xf,%edx
+  800bf3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800bf8:	83 fa 06             	cmp    $0x6,%edx
+  800bfb:	74 0e                	je     800c0b <sys_env_set_stack_limit+0x7a>
+  800bfd:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800c00:	0f b6 c9             	movzbl %cl,%ecx
+  800c03:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800c09:	eb 98                	jmp    800ba3 <sys_env_set_stack_limit+0x12>
+  800c0b:	89 c2                	mov    %eax,%edx
+  800c0d:	c1 ea 04             	shr    $0x4,%edx
+  800c10:	83 e2 0f             	and    $0xf,%edx
+  800c13:	83 fa 02             	cmp    $0x2,%edx
+  800c16:	77 e5                	ja     800bfd <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  800c18:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c1b:	83 f8 02             	cmp    $0x2,%eax
+  800c1e:	0f 97 c1             	seta   %cl
+  800c21:	0f b6 c9             	movzbl %cl,%ecx
+  800c24:	eb d7                	jmp    800bfd <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  800c26:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c2b:	b8 19 00 00 00       	mov    $0x19,%eax
+  800c30:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c33:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c36:	89 df                	mov    %ebx,%edi
+  800c38:	89 de                	mov    %ebx,%esi
+  800c3a:	cd 30                	int    $0x30
+  800c3c:	eb 90                	jmp    800bce <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c3e:	83 ec 0c             	sub    $0xc,%esp
+  800c41:	50                   	push   %eax
+  800c42:	6a 19                	push   $0x19
+  800c44:	68 cf 27 80 00       	push   $0x8027cf
+  800c49:	6a 4a                	push   $0x4a
+  800c4b:	68 ec 27 80 00       	push   $0x8027ec
+  800c50:	e8 c0 0f 00 00       	call   801c15 <_panic>
+
+00800c55 <sys_env_set_pgfault_upcall>:
+{
+  800c55:	55                   	push   %ebp
+  800c56:	89 e5                	mov    %esp,%ebp
+  800c58:	57                   	push   %edi
+  800c59:	56                   	push   %esi
+  800c5a:	53                   	push   %ebx
+  800c5b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800c5e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800c65:	78 37                	js     800c9e <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  800c67:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800c6e:	74 7a                	je     800cea <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  800c70:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c75:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c78:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c7b:	b8 09 00 00 00       	mov    $0x9,%eax
+  800c80:	89 df                	mov    %ebx,%edi
+  800c82:	89 de                	mov    %ebx,%esi
+  800c84:	55                   	push   %ebp
+  800c85:	68 8e 0c 80 00       	push   $0x800c8e
+  800c8a:	89 e5                	mov    %esp,%ebp
+  800c8c:	0f 34                	sysenter
+  800c8e:	83 c4 04             	add    $0x4,%esp
+  800c91:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c92:	85 c0                	test   %eax,%eax
+  800c94:	7f 6c                	jg     800d02 <sys_env_set_pgfault_upcall+0xad>
+}
+  800c96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c99:	5b                   	pop    %ebx
+  800c9a:	5e                   	pop    %esi
+  800c9b:	5f                   	pop    %edi
+  800c9c:	5d                   	pop    %ebp
+  800c9d:	c3                   	ret
+  800c9e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ca3:	0f a2                	cpuid
+		return 0;
+  800ca5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800caa:	f6 c6 08             	test   $0x8,%dh
+  800cad:	74 15                	je     800cc4 <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800caf:	89 c2                	mov    %eax,%edx
+  800cb1:	c1 ea 08             	shr    $0x8,%edx
+  800cb4:	83 e2 0f             	and    $0xf,%edx
+  800cb7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800cbc:	83 fa 06             	cmp    $0x6,%edx
+  800cbf:	74 0e                	je     800ccf <sys_env_set_pgfault_upcall+0x7a>
+  800cc1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800cc4:	0f b6 c9             	movzbl %cl,%ecx
+  800cc7:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800ccd:	eb 98                	jmp    800c67 <sys_env_set_pgfault_upcall+0x12>
+  800ccf:	89 c2                	mov    %eax,%edx
+  800cd1:	c1 ea 04             	shr    $0x4,%edx
+  800cd4:	83 e2 0f             	and    $0xf,%edx
+  800cd7:	83 fa 02             	cmp    $0x2,%edx
+  800cda:	77 e5                	ja     800cc1 <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  800cdc:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800cdf:	83 f8 02             	cmp    $0x2,%eax
+  800ce2:	0f 97 c1             	seta   %cl
+  800ce5:	0f b6 c9             	movzbl %cl,%ecx
+  800ce8:	eb d7                	jmp    800cc1 <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  800cea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cef:	b8 09 00 00 00       	mov    $0x9,%eax
+  800cf4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cfa:	89 df                	mov    %ebx,%edi
+  800cfc:	89 de                	mov    %ebx,%esi
+  800cfe:	cd 30                	int    $0x30
+  800d00:	eb 90                	jmp    800c92 <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d02:	83 ec 0c             	sub    $0xc,%esp
+  800d05:	50                   	push   %eax
+  800d06:	6a 09                	push   $0x9
+  800d08:	68 cf 27 80 00       	push   $0x8027cf
+  800d0d:	6a 4a                	push   $0x4a
+  800d0f:	68 ec 27 80 00       	push   $0x8027ec
+  800d14:	e8 fc 0e 00 00       	call   801c15 <_panic>
+
+00800d19 <sys_ipc_try_send>:
+{
+  800d19:	55                   	push   %ebp
+  800d1a:	89 e5                	mov    %esp,%ebp
+  800d1c:	57                   	push   %edi
+  800d1d:	56                   	push   %esi
+  800d1e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800d1f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d26:	78 32                	js     800d5a <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  800d28:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d2f:	74 75                	je     800da6 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  800d31:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d34:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d37:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d3c:	be 00 00 00 00       	mov    $0x0,%esi
+  800d41:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d44:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d47:	55                   	push   %ebp
+  800d48:	68 51 0d 80 00       	push   $0x800d51
+  800d4d:	89 e5                	mov    %esp,%ebp
+  800d4f:	0f 34                	sysenter
+  800d51:	83 c4 04             	add    $0x4,%esp
+  800d54:	5d                   	pop    %ebp
+}
+  800d55:	5b                   	pop    %ebx
+  800d56:	5e                   	pop    %esi
+  800d57:	5f                   	pop    %edi
+  800d58:	5d                   	pop    %ebp
+  800d59:	c3                   	ret
+  800d5a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d5f:	0f a2                	cpuid
+		return 0;
+  800d61:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800d66:	f6 c6 08             	test   $0x8,%dh
+  800d69:	74 15                	je     800d80 <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d6b:	89 c2                	mov    %eax,%edx
+  800d6d:	c1 ea 08             	shr    $0x8,%edx
+  800d70:	83 e2 0f             	and    $0xf,%edx
+  800d73:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d78:	83 fa 06             	cmp    $0x6,%edx
+  800d7b:	74 0e                	je     800d8b <sys_ipc_try_send+0x72>
+  800d7d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800d80:	0f b6 c9             	movzbl %cl,%ecx
+  800d83:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800d89:	eb 9d                	jmp    800d28 <sys_ipc_try_send+0xf>
+  800d8b:	89 c2                	mov    %eax,%edx
+  800d8d:	c1 ea 04             	shr    $0x4,%edx
+  800d90:	83 e2 0f             	and    $0xf,%edx
+  800d93:	83 fa 02             	cmp    $0x2,%edx
+  800d96:	77 e5                	ja     800d7d <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  800d98:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d9b:	83 f8 02             	cmp    $0x2,%eax
+  800d9e:	0f 97 c1             	seta   %cl
+  800da1:	0f b6 c9             	movzbl %cl,%ecx
+  800da4:	eb d7                	jmp    800d7d <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  800da6:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800dab:	be 00 00 00 00       	mov    $0x0,%esi
+  800db0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800db9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dbc:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  800dbe:	eb 95                	jmp    800d55 <sys_ipc_try_send+0x3c>
+
+00800dc0 <sys_ipc_send>:
+{
+  800dc0:	55                   	push   %ebp
+  800dc1:	89 e5                	mov    %esp,%ebp
+  800dc3:	57                   	push   %edi
+  800dc4:	56                   	push   %esi
+  800dc5:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800dc6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800dcd:	78 32                	js     800e01 <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  800dcf:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800dd6:	74 75                	je     800e4d <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  800dd8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ddb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dde:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800de3:	be 00 00 00 00       	mov    $0x0,%esi
+  800de8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800deb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dee:	55                   	push   %ebp
+  800def:	68 f8 0d 80 00       	push   $0x800df8
+  800df4:	89 e5                	mov    %esp,%ebp
+  800df6:	0f 34                	sysenter
+  800df8:	83 c4 04             	add    $0x4,%esp
+  800dfb:	5d                   	pop    %ebp
+}
+  800dfc:	5b                   	pop    %ebx
+  800dfd:	5e                   	pop    %esi
+  800dfe:	5f                   	pop    %edi
+  800dff:	5d                   	pop    %ebp
+  800e00:	c3                   	ret
+  800e01:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e06:	0f a2                	cpuid
+		return 0;
+  800e08:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800e0d:	f6 c6 08             	test   $0x8,%dh
+  800e10:	74 15                	je     800e27 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e12:	89 c2                	mov    %eax,%edx
+  800e14:	c1 ea 08             	shr    $0x8,%edx
+  800e17:	83 e2 0f             	and    $0xf,%edx
+  800e1a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e1f:	83 fa 06             	cmp    $0x6,%edx
+  800e22:	74 0e                	je     800e32 <sys_ipc_send+0x72>
+  800e24:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e27:	0f b6 c9             	movzbl %cl,%ecx
+  800e2a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800e30:	eb 9d                	jmp    800dcf <sys_ipc_send+0xf>
+  800e32:	89 c2                	mov    %eax,%edx
+  800e34:	c1 ea 04             	shr    $0x4,%edx
+  800e37:	83 e2 0f             	and    $0xf,%edx
+  800e3a:	83 fa 02             	cmp    $0x2,%edx
+  800e3d:	77 e5                	ja     800e24 <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  800e3f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e42:	83 f8 02             	cmp    $0x2,%eax
+  800e45:	0f 97 c1             	seta   %cl
+  800e48:	0f b6 c9             	movzbl %cl,%ecx
+  800e4b:	eb d7                	jmp    800e24 <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  800e4d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800e52:	be 00 00 00 00       	mov    $0x0,%esi
+  800e57:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e5d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e60:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e63:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  800e65:	eb 95                	jmp    800dfc <sys_ipc_send+0x3c>
+
+00800e67 <sys_ipc_recv>:
+{
+  800e67:	55                   	push   %ebp
+  800e68:	89 e5                	mov    %esp,%ebp
+  800e6a:	57                   	push   %edi
+  800e6b:	56                   	push   %esi
+  800e6c:	53                   	push   %ebx
+  800e6d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800e70:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e77:	78 36                	js     800eaf <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  800e79:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e80:	74 79                	je     800efb <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  800e82:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e85:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e8a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e8f:	89 cb                	mov    %ecx,%ebx
+  800e91:	89 cf                	mov    %ecx,%edi
+  800e93:	89 ce                	mov    %ecx,%esi
+  800e95:	55                   	push   %ebp
+  800e96:	68 9f 0e 80 00       	push   $0x800e9f
+  800e9b:	89 e5                	mov    %esp,%ebp
+  800e9d:	0f 34                	sysenter
+  800e9f:	83 c4 04             	add    $0x4,%esp
+  800ea2:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ea3:	85 c0                	test   %eax,%eax
+  800ea5:	7f 6b                	jg     800f12 <sys_ipc_recv+0xab>
+}
+  800ea7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eaa:	5b                   	pop    %ebx
+  800eab:	5e                   	pop    %esi
+  800eac:	5f                   	pop    %edi
+  800ead:	5d                   	pop    %ebp
+  800eae:	c3                   	ret
+  800eaf:	b8 01 00 00 00       	mov    $0x1,%eax
+  800eb4:	0f a2                	cpuid
+		return 0;
+  800eb6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800ebb:	f6 c6 08             	test   $0x8,%dh
+  800ebe:	74 15                	je     800ed5 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ec0:	89 c2                	mov    %eax,%edx
+  800ec2:	c1 ea 08             	shr    $0x8,%edx
+  800ec5:	83 e2 0f             	and    $0xf,%edx
+  800ec8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ecd:	83 fa 06             	cmp    $0x6,%edx
+  800ed0:	74 0e                	je     800ee0 <sys_ipc_recv+0x79>
+  800ed2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800ed5:	0f b6 c9             	movzbl %cl,%ecx
+  800ed8:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800ede:	eb 99                	jmp    800e79 <sys_ipc_recv+0x12>
+  800ee0:	89 c2                	mov    %eax,%edx
+  800ee2:	c1 ea 04             	shr    $0x4,%edx
+  800ee5:	83 e2 0f             	and    $0xf,%edx
+  800ee8:	83 fa 02             	cmp    $0x2,%edx
+  800eeb:	77 e5                	ja     800ed2 <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  800eed:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ef0:	83 f8 02             	cmp    $0x2,%eax
+  800ef3:	0f 97 c1             	seta   %cl
+  800ef6:	0f b6 c9             	movzbl %cl,%ecx
+  800ef9:	eb d7                	jmp    800ed2 <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  800efb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f00:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f05:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f08:	89 cb                	mov    %ecx,%ebx
+  800f0a:	89 cf                	mov    %ecx,%edi
+  800f0c:	89 ce                	mov    %ecx,%esi
+  800f0e:	cd 30                	int    $0x30
+  800f10:	eb 91                	jmp    800ea3 <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f12:	83 ec 0c             	sub    $0xc,%esp
+  800f15:	50                   	push   %eax
+  800f16:	6a 0d                	push   $0xd
+  800f18:	68 cf 27 80 00       	push   $0x8027cf
+  800f1d:	6a 4a                	push   $0x4a
+  800f1f:	68 ec 27 80 00       	push   $0x8027ec
+  800f24:	e8 ec 0c 00 00       	call   801c15 <_panic>
+
+00800f29 <sys_ipc_send_range>:
+{
+  800f29:	55                   	push   %ebp
+  800f2a:	89 e5                	mov    %esp,%ebp
+  800f2c:	57                   	push   %edi
+  800f2d:	56                   	push   %esi
+  800f2e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800f2f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f36:	78 30                	js     800f68 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  800f38:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f3f:	74 73                	je     800fb4 <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  800f41:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f47:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  800f4c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f4f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f52:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f55:	55                   	push   %ebp
+  800f56:	68 5f 0f 80 00       	push   $0x800f5f
+  800f5b:	89 e5                	mov    %esp,%ebp
+  800f5d:	0f 34                	sysenter
+  800f5f:	83 c4 04             	add    $0x4,%esp
+  800f62:	5d                   	pop    %ebp
+}
+  800f63:	5b                   	pop    %ebx
+  800f64:	5e                   	pop    %esi
+  800f65:	5f                   	pop    %edi
+  800f66:	5d                   	pop    %ebp
+  800f67:	c3                   	ret
+  800f68:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f6d:	0f a2                	cpuid
+		return 0;
+  800f6f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f74:	f6 c6 08             	test   $0x8,%dh
+  800f77:	74 15                	je     800f8e <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f79:	89 c2                	mov    %eax,%edx
+  800f7b:	c1 ea 08             	shr    $0x8,%edx
+  800f7e:	83 e2 0f             	and    $0xf,%edx
+  800f81:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f86:	83 fa 06             	cmp    $0x6,%edx
+  800f89:	74 0e                	je     800f99 <sys_ipc_send_range+0x70>
+  800f8b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f8e:	0f b6 c9             	movzbl %cl,%ecx
+  800f91:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800f97:	eb 9f                	jmp    800f38 <sys_ipc_send_range+0xf>
+  800f99:	89 c2                	mov    %eax,%edx
+  800f9b:	c1 ea 04             	shr    $0x4,%edx
+  800f9e:	83 e2 0f             	and    $0xf,%edx
+  800fa1:	83 fa 02             	cmp    $0x2,%edx
+  800fa4:	77 e5                	ja     800f8b <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  800fa6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800fa9:	83 f8 02             	cmp    $0x2,%eax
+  800fac:	0f 97 c1             	seta   %cl
+  800faf:	0f b6 c9             	movzbl %cl,%ecx
+  800fb2:	eb d7                	jmp    800f8b <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  800fb4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  800fb9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fbc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fc2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fc5:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fc8:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  800fca:	eb 97                	jmp    800f63 <sys_ipc_send_range+0x3a>
+
+00800fcc <sys_ipc_recv_range>:
+{
+  800fcc:	55                   	push   %ebp
+  800fcd:	89 e5                	mov    %esp,%ebp
+  800fcf:	57                   	push   %edi
+  800fd0:	56                   	push   %esi
+  800fd1:	53                   	push   %ebx
+  800fd2:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800fd5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fdc:	78 37                	js     801015 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  800fde:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fe5:	74 7a                	je     801061 <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  800fe7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fec:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff2:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800ff7:	89 df                	mov    %ebx,%edi
+  800ff9:	89 de                	mov    %ebx,%esi
+  800ffb:	55                   	push   %ebp
+  800ffc:	68 05 10 80 00       	push   $0x801005
+  801001:	89 e5                	mov    %esp,%ebp
+  801003:	0f 34                	sysenter
+  801005:	83 c4 04             	add    $0x4,%esp
+  801008:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801009:	85 c0                	test   %eax,%eax
+  80100b:	7f 6c                	jg     801079 <sys_ipc_recv_range+0xad>
+}
+  80100d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801010:	5b                   	pop    %ebx
+  801011:	5e                   	pop    %esi
+  801012:	5f                   	pop    %edi
+  801013:	5d                   	pop    %ebp
+  801014:	c3                   	ret
+  801015:	b8 01 00 00 00       	mov    $0x1,%eax
+  80101a:	0f a2                	cpuid
+		return 0;
+  80101c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801021:	f6 c6 08             	test   $0x8,%dh
+  801024:	74 15                	je     80103b <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801026:	89 c2                	mov    %eax,%edx
+  801028:	c1 ea 08             	shr    $0x8,%edx
+  80102b:	83 e2 0f             	and    $0xf,%edx
+  80102e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801033:	83 fa 06             	cmp    $0x6,%edx
+  801036:	74 0e                	je     801046 <sys_ipc_recv_range+0x7a>
+  801038:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80103b:	0f b6 c9             	movzbl %cl,%ecx
+  80103e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801044:	eb 98                	jmp    800fde <sys_ipc_recv_range+0x12>
+  801046:	89 c2                	mov    %eax,%edx
+  801048:	c1 ea 04             	shr    $0x4,%edx
+  80104b:	83 e2 0f             	and    $0xf,%edx
+  80104e:	83 fa 02             	cmp    $0x2,%edx
+  801051:	77 e5                	ja     801038 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801053:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801056:	83 f8 02             	cmp    $0x2,%eax
+  801059:	0f 97 c1             	seta   %cl
+  80105c:	0f b6 c9             	movzbl %cl,%ecx
+  80105f:	eb d7                	jmp    801038 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801061:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801066:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80106b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801071:	89 df                	mov    %ebx,%edi
+  801073:	89 de                	mov    %ebx,%esi
+  801075:	cd 30                	int    $0x30
+  801077:	eb 90                	jmp    801009 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801079:	83 ec 0c             	sub    $0xc,%esp
+  80107c:	50                   	push   %eax
+  80107d:	6a 1f                	push   $0x1f
+  80107f:	68 cf 27 80 00       	push   $0x8027cf
+  801084:	6a 4a                	push   $0x4a
+  801086:	68 ec 27 80 00       	push   $0x8027ec
+  80108b:	e8 85 0b 00 00       	call   801c15 <_panic>
+
+00801090 <sys_ipc_call>:
+{
+  801090:	55                   	push   %ebp
+  801091:	89 e5                	mov    %esp,%ebp
+  801093:	57                   	push   %edi
+  801094:	56                   	push   %esi
+  801095:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801096:	8b 55 08             	mov    0x8(%ebp),%edx
+  801099:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80109e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8010a1:	55                   	push   %ebp
+  8010a2:	56                   	push   %esi
+  8010a3:	8b 0e                	mov    (%esi),%ecx
+  8010a5:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8010a8:	8b 7e 08             	mov    0x8(%esi),%edi
+  8010ab:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8010ae:	8b 76 0c             	mov    0xc(%esi),%esi
+  8010b1:	cd 30                	int    $0x30
+  8010b3:	87 34 24             	xchg   %esi,(%esp)
+  8010b6:	89 0e                	mov    %ecx,(%esi)
+  8010b8:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8010bb:	89 7e 08             	mov    %edi,0x8(%esi)
+  8010be:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8010c1:	8f 46 0c             	pop    0xc(%esi)
+  8010c4:	5d                   	pop    %ebp
+}
+  8010c5:	5b                   	pop    %ebx
+  8010c6:	5e                   	pop    %esi
+  8010c7:	5f                   	pop    %edi
+  8010c8:	5d                   	pop    %ebp
+  8010c9:	c3                   	ret
+
+008010ca <sys_ipc_reply_wait>:
+{
+  8010ca:	55                   	push   %ebp
+  8010cb:	89 e5                	mov    %esp,%ebp
+  8010cd:	57                   	push   %edi
+  8010ce:	56                   	push   %esi
+  8010cf:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8010d8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8010db:	55                   	push   %ebp
+  8010dc:	56                   	push   %esi
+  8010dd:	8b 0e                	mov    (%esi),%ecx
+  8010df:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8010e2:	8b 7e 08             	mov    0x8(%esi),%edi
+  8010e5:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8010e8:	8b 76 0c             	mov    0xc(%esi),%esi
+  8010eb:	cd 30                	int    $0x30
+  8010ed:	87 34 24             	xchg   %esi,(%esp)
+  8010f0:	89 0e                	mov    %ecx,(%esi)
+  8010f2:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8010f5:	89 7e 08             	mov    %edi,0x8(%esi)
+  8010f8:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8010fb:	8f 46 0c             	pop    0xc(%esi)
+  8010fe:	5d                   	pop    %ebp
+}
+  8010ff:	5b                   	pop    %ebx
+  801100:	5e                   	pop    %esi
+  801101:	5f                   	pop    %edi
+  801102:	5d                   	pop    %ebp
+  801103:	c3                   	ret
+
+00801104 <sys_ipc_send_msg>:
+{
+  801104:	55                   	push   %ebp
+  801105:	89 e5                	mov    %esp,%ebp
+  801107:	57                   	push   %edi
+  801108:	56                   	push   %esi
+  801109:	53                   	push   %ebx
+  80110a:	83 ec 20             	sub    $0x20,%esp
+  80110d:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801110:	8b 10                	mov    (%eax),%edx
+  801112:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801115:	8b 50 04             	mov    0x4(%eax),%edx
+  801118:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80111b:	8b 50 08             	mov    0x8(%eax),%edx
+  80111e:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801121:	8b 50 0c             	mov    0xc(%eax),%edx
+  801124:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801127:	8b 40 10             	mov    0x10(%eax),%eax
+  80112a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  80112d:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801130:	8b 55 08             	mov    0x8(%ebp),%edx
+  801133:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801138:	55                   	push   %ebp
+  801139:	56                   	push   %esi
+  80113a:	8b 0e                	mov    (%esi),%ecx
+  80113c:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80113f:	8b 7e 08             	mov    0x8(%esi),%edi
+  801142:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801145:	8b 76 0c             	mov    0xc(%esi),%esi
+  801148:	cd 30                	int    $0x30
+  80114a:	87 34 24             	xchg   %esi,(%esp)
+  80114d:	89 0e                	mov    %ecx,(%esi)
+  80114f:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801152:	89 7e 08             	mov    %edi,0x8(%esi)
+  801155:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801158:	8f 46 0c             	pop    0xc(%esi)
+  80115b:	5d                   	pop    %ebp
+}
+  80115c:	83 c4 20             	add    $0x20,%esp
+  80115f:	5b                   	pop    %ebx
+  801160:	5e                   	pop    %esi
+  801161:	5f                   	pop    %edi
+  801162:	5d                   	pop    %ebp
+  801163:	c3                   	ret
+
+00801164 <sys_fork>:
+{
+  801164:	55                   	push   %ebp
+  801165:	89 e5                	mov    %esp,%ebp
+  801167:	57                   	push   %edi
+  801168:	56                   	push   %esi
+  801169:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80116a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801171:	78 2e                	js     8011a1 <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801173:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80117a:	74 71                	je     8011ed <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  80117c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801181:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801186:	89 d1                	mov    %edx,%ecx
+  801188:	89 d3                	mov    %edx,%ebx
+  80118a:	89 d7                	mov    %edx,%edi
+  80118c:	89 d6                	mov    %edx,%esi
+  80118e:	55                   	push   %ebp
+  80118f:	68 98 11 80 00       	push   $0x801198
+  801194:	89 e5                	mov    %esp,%ebp
+  801196:	0f 34                	sysenter
+  801198:	83 c4 04             	add    $0x4,%esp
+  80119b:	5d                   	pop    %ebp
+}
+  80119c:	5b                   	pop    %ebx
+  80119d:	5e                   	pop    %esi
+  80119e:	5f                   	pop    %edi
+  80119f:	5d                   	pop    %ebp
+  8011a0:	c3                   	ret
+  8011a1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011a6:	0f a2                	cpuid
+		return 0;
+  8011a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8011ad:	f6 c6 08             	test   $0x8,%dh
+  8011b0:	74 15                	je     8011c7 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011b2:	89 c2                	mov    %eax,%edx
+  8011b4:	c1 ea 08             	shr    $0x8,%edx
+  8011b7:	83 e2 0f             	and    $0xf,%edx
+  8011ba:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011bf:	83 fa 06             	cmp    $0x6,%edx
+  8011c2:	74 0e                	je     8011d2 <sys_fork+0x6e>
+  8011c4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8011c7:	0f b6 c9             	movzbl %cl,%ecx
+  8011ca:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8011d0:	eb a1                	jmp    801173 <sys_fork+0xf>
+  8011d2:	89 c2                	mov    %eax,%edx
+  8011d4:	c1 ea 04             	shr    $0x4,%edx
+  8011d7:	83 e2 0f             	and    $0xf,%edx
+  8011da:	83 fa 02             	cmp    $0x2,%edx
+  8011dd:	77 e5                	ja     8011c4 <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  8011df:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011e2:	83 f8 02             	cmp    $0x2,%eax
+  8011e5:	0f 97 c1             	seta   %cl
+  8011e8:	0f b6 c9             	movzbl %cl,%ecx
+  8011eb:	eb d7                	jmp    8011c4 <sys_fork+0x60>
+		asm volatile("int %1\n"
+  8011ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011f2:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011f7:	89 d1                	mov    %edx,%ecx
+  8011f9:	89 d3                	mov    %edx,%ebx
+  8011fb:	89 d7                	mov    %edx,%edi
+  8011fd:	89 d6                	mov    %edx,%esi
+  8011ff:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801201:	eb 99                	jmp    80119c <sys_fork+0x38>
+
+00801203 <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801203:	55                   	push   %ebp
+  801204:	89 e5                	mov    %esp,%ebp
+  801206:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801209:	ff 75 14             	push   0x14(%ebp)
+  80120c:	ff 75 10             	push   0x10(%ebp)
+  80120f:	ff 75 0c             	push   0xc(%ebp)
+  801212:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801217:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80121f:	e8 81 ee ff ff       	call   8000a5 <page_vec_call>
+}
+  801224:	c9                   	leave
+  801225:	c3                   	ret
+
+00801226 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801226:	55                   	push   %ebp
+  801227:	89 e5                	mov    %esp,%ebp
+  801229:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  80122c:	ff 75 18             	push   0x18(%ebp)
+  80122f:	ff 75 14             	push   0x14(%ebp)
+  801232:	ff 75 10             	push   0x10(%ebp)
+  801235:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801238:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123b:	b8 10 00 00 00       	mov    $0x10,%eax
+  801240:	e8 60 ee ff ff       	call   8000a5 <page_vec_call>
+}
+  801245:	c9                   	leave
+  801246:	c3                   	ret
+
+00801247 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801247:	55                   	push   %ebp
+  801248:	89 e5                	mov    %esp,%ebp
+  80124a:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  80124d:	ff 75 14             	push   0x14(%ebp)
+  801250:	ff 75 10             	push   0x10(%ebp)
+  801253:	ff 75 0c             	push   0xc(%ebp)
+  801256:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80125b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125e:	b8 11 00 00 00       	mov    $0x11,%eax
+  801263:	e8 3d ee ff ff       	call   8000a5 <page_vec_call>
+}
+  801268:	c9                   	leave
+  801269:	c3                   	ret
+
+0080126a <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  80126a:	55                   	push   %ebp
+  80126b:	89 e5                	mov    %esp,%ebp
+  80126d:	57                   	push   %edi
+  80126e:	56                   	push   %esi
+  80126f:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801270:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801277:	78 32                	js     8012ab <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801279:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801280:	74 75                	je     8012f7 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801282:	8b 55 08             	mov    0x8(%ebp),%edx
+  801285:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801288:	b8 12 00 00 00       	mov    $0x12,%eax
+  80128d:	be 00 00 00 00       	mov    $0x0,%esi
+  801292:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801295:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801298:	55                   	push   %ebp
+  801299:	68 a2 12 80 00       	push   $0x8012a2
+  80129e:	89 e5                	mov    %esp,%ebp
+  8012a0:	0f 34                	sysenter
+  8012a2:	83 c4 04             	add    $0x4,%esp
+  8012a5:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  8012a6:	5b                   	pop    %ebx
+  8012a7:	5e                   	pop    %esi
+  8012a8:	5f                   	pop    %edi
+  8012a9:	5d                   	pop    %ebp
+  8012aa:	c3                   	ret
+  8012ab:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012b0:	0f a2                	cpuid
+		return 0;
+  8012b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8012b7:	f6 c6 08             	test   $0x8,%dh
+  8012ba:	74 15                	je     8012d1 <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012bc:	89 c2                	mov    %eax,%edx
+  8012be:	c1 ea 08             	shr    $0x8,%edx
+  8012c1:	83 e2 0f             	and    $0xf,%edx
+  8012c4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012c9:	83 fa 06             	cmp    $0x6,%edx
+  8012cc:	74 0e                	je     8012dc <sys_vm_ranges+0x72>
+  8012ce:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8012d1:	0f b6 c9             	movzbl %cl,%ecx
+  8012d4:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8012da:	eb 9d                	jmp    801279 <sys_vm_ranges+0xf>
+  8012dc:	89 c2                	mov    %eax,%edx
+  8012de:	c1 ea 04             	shr    $0x4,%edx
+  8012e1:	83 e2 0f             	and    $0xf,%edx
+  8012e4:	83 fa 02             	cmp    $0x2,%edx
+  8012e7:	77 e5                	ja     8012ce <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  8012e9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012ec:	83 f8 02             	cmp    $0x2,%eax
+  8012ef:	0f 97 c1             	seta   %cl
+  8012f2:	0f b6 c9             	movzbl %cl,%ecx
+  8012f5:	eb d7                	jmp    8012ce <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  8012f7:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801301:	8b 55 08             	mov    0x8(%ebp),%edx
+  801304:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801307:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80130a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80130d:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  80130f:	eb 95                	jmp    8012a6 <sys_vm_ranges+0x3c>
+
+00801311 <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801311:	55                   	push   %ebp
+  801312:	89 e5                	mov    %esp,%ebp
+  801314:	57                   	push   %edi
+  801315:	56                   	push   %esi
+  801316:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801317:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80131e:	78 31                	js     801351 <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801320:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801327:	74 74                	je     80139d <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801329:	be 00 00 00 00       	mov    $0x0,%esi
+  80132e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801331:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801334:	b8 14 00 00 00       	mov    $0x14,%eax
+  801339:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80133c:	89 f7                	mov    %esi,%edi
+  80133e:	55                   	push   %ebp
+  80133f:	68 48 13 80 00       	push   $0x801348
+  801344:	89 e5                	mov    %esp,%ebp
+  801346:	0f 34                	sysenter
+  801348:	83 c4 04             	add    $0x4,%esp
+  80134b:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  80134c:	5b                   	pop    %ebx
+  80134d:	5e                   	pop    %esi
+  80134e:	5f                   	pop    %edi
+  80134f:	5d                   	pop    %ebp
+  801350:	c3                   	ret
+  801351:	b8 01 00 00 00       	mov    $0x1,%eax
+  801356:	0f a2                	cpuid
+		return 0;
+  801358:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80135d:	f6 c6 08             	test   $0x8,%dh
+  801360:	74 15                	je     801377 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801362:	89 c2                	mov    %eax,%edx
+  801364:	c1 ea 08             	shr    $0x8,%edx
+  801367:	83 e2 0f             	and    $0xf,%edx
+  80136a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80136f:	83 fa 06             	cmp    $0x6,%edx
+  801372:	74 0e                	je     801382 <sys_spawn+0x71>
+  801374:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801377:	0f b6 c9             	movzbl %cl,%ecx
+  80137a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801380:	eb 9e                	jmp    801320 <sys_spawn+0xf>
+  801382:	89 c2                	mov    %eax,%edx
+  801384:	c1 ea 04             	shr    $0x4,%edx
+  801387:	83 e2 0f             	and    $0xf,%edx
+  80138a:	83 fa 02             	cmp    $0x2,%edx
+  80138d:	77 e5                	ja     801374 <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  80138f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801392:	83 f8 02             	cmp    $0x2,%eax
+  801395:	0f 97 c1             	seta   %cl
+  801398:	0f b6 c9             	movzbl %cl,%ecx
+  80139b:	eb d7                	jmp    801374 <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  80139d:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a2:	b8 14 00 00 00       	mov    $0x14,%eax
+  8013a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013ad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013b0:	89 f7                	mov    %esi,%edi
+  8013b2:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  8013b4:	eb 96                	jmp    80134c <sys_spawn+0x3b>
+
+008013b6 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  8013b6:	55                   	push   %ebp
+  8013b7:	89 e5                	mov    %esp,%ebp
+  8013b9:	57                   	push   %edi
+  8013ba:	56                   	push   %esi
+  8013bb:	53                   	push   %ebx
+  8013bc:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8013bf:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8013c6:	78 37                	js     8013ff <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  8013c8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8013cf:	74 7a                	je     80144b <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  8013d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013dc:	b8 15 00 00 00       	mov    $0x15,%eax
+  8013e1:	89 df                	mov    %ebx,%edi
+  8013e3:	89 de                	mov    %ebx,%esi
+  8013e5:	55                   	push   %ebp
+  8013e6:	68 ef 13 80 00       	push   $0x8013ef
+  8013eb:	89 e5                	mov    %esp,%ebp
+  8013ed:	0f 34                	sysenter
+  8013ef:	83 c4 04             	add    $0x4,%esp
+  8013f2:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8013f3:	85 c0                	test   %eax,%eax
+  8013f5:	7f 6c                	jg     801463 <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  8013f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013fa:	5b                   	pop    %ebx
+  8013fb:	5e                   	pop    %esi
+  8013fc:	5f                   	pop    %edi
+  8013fd:	5d                   	pop    %ebp
+  8013fe:	c3                   	ret
+  8013ff:	b8 01 00 00 00       	mov    $0x1,%eax
+  801404:	0f a2                	cpuid
+		return 0;
+  801406:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80140b:	f6 c6 08             	test   $0x8,%dh
+  80140e:	74 15                	je     801425 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801410:	89 c2                	mov    %eax,%edx
+  801412:	c1 ea 08             	shr    $0x8,%edx
+  801415:	83 e2 0f             	and    $0xf,%edx
+  801418:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80141d:	83 fa 06             	cmp    $0x6,%edx
+  801420:	74 0e                	je     801430 <sys_shm_create+0x7a>
+  801422:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801425:	0f b6 c9             	movzbl %cl,%ecx
+  801428:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80142e:	eb 98                	jmp    8013c8 <sys_shm_create+0x12>
+  801430:	89 c2                	mov    %eax,%edx
+  801432:	c1 ea 04             	shr    $0x4,%edx
+  801435:	83 e2 0f             	and    $0xf,%edx
+  801438:	83 fa 02             	cmp    $0x2,%edx
+  80143b:	77 e5                	ja     801422 <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  80143d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801440:	83 f8 02             	cmp    $0x2,%eax
+  801443:	0f 97 c1             	seta   %cl
+  801446:	0f b6 c9             	movzbl %cl,%ecx
+  801449:	eb d7                	jmp    801422 <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  80144b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801450:	b8 15 00 00 00       	mov    $0x15,%eax
+  801455:	8b 55 08             	mov    0x8(%ebp),%edx
+  801458:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80145b:	89 df                	mov    %ebx,%edi
+  80145d:	89 de                	mov    %ebx,%esi
+  80145f:	cd 30                	int    $0x30
+  801461:	eb 90                	jmp    8013f3 <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801463:	83 ec 0c             	sub    $0xc,%esp
+  801466:	50                   	push   %eax
+  801467:	6a 15                	push   $0x15
+  801469:	68 cf 27 80 00       	push   $0x8027cf
+  80146e:	6a 4a                	push   $0x4a
+  801470:	68 ec 27 80 00       	push   $0x8027ec
+  801475:	e8 9b 07 00 00       	call   801c15 <_panic>
+
+0080147a <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  80147a:	55                   	push   %ebp
+  80147b:	89 e5                	mov    %esp,%ebp
+  80147d:	57                   	push   %edi
+  80147e:	56                   	push   %esi
+  80147f:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801480:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801487:	78 32                	js     8014bb <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  801489:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801490:	74 75                	je     801507 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801492:	8b 55 08             	mov    0x8(%ebp),%edx
+  801495:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801498:	b8 16 00 00 00       	mov    $0x16,%eax
+  80149d:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014a5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014a8:	55                   	push   %ebp
+  8014a9:	68 b2 14 80 00       	push   $0x8014b2
+  8014ae:	89 e5                	mov    %esp,%ebp
+  8014b0:	0f 34                	sysenter
+  8014b2:	83 c4 04             	add    $0x4,%esp
+  8014b5:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  8014b6:	5b                   	pop    %ebx
+  8014b7:	5e                   	pop    %esi
+  8014b8:	5f                   	pop    %edi
+  8014b9:	5d                   	pop    %ebp
+  8014ba:	c3                   	ret
+  8014bb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014c0:	0f a2                	cpuid
+		return 0;
+  8014c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8014c7:	f6 c6 08             	test   $0x8,%dh
+  8014ca:	74 15                	je     8014e1 <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014cc:	89 c2                	mov    %eax,%edx
+  8014ce:	c1 ea 08             	shr    $0x8,%edx
+  8014d1:	83 e2 0f             	and    $0xf,%edx
+  8014d4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8014d9:	83 fa 06             	cmp    $0x6,%edx
+  8014dc:	74 0e                	je     8014ec <sys_shm_attach+0x72>
+  8014de:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8014e1:	0f b6 c9             	movzbl %cl,%ecx
+  8014e4:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8014ea:	eb 9d                	jmp    801489 <sys_shm_attach+0xf>
+  8014ec:	89 c2                	mov    %eax,%edx
+  8014ee:	c1 ea 04             	shr    $0x4,%edx
+  8014f1:	83 e2 0f             	and    $0xf,%edx
+  8014f4:	83 fa 02             	cmp    $0x2,%edx
+  8014f7:	77 e5                	ja     8014de <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  8014f9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014fc:	83 f8 02             	cmp    $0x2,%eax
+  8014ff:	0f 97 c1             	seta   %cl
+  801502:	0f b6 c9             	movzbl %cl,%ecx
+  801505:	eb d7                	jmp    8014de <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  801507:	b8 16 00 00 00       	mov    $0x16,%eax
+  80150c:	be 00 00 00 00       	mov    $0x0,%esi
+  801511:	8b 55 08             	mov    0x8(%ebp),%edx
+  801514:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801517:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80151a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80151d:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  80151f:	eb 95                	jmp    8014b6 <sys_shm_attach+0x3c>
+
+00801521 <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  801521:	55                   	push   %ebp
+  801522:	89 e5                	mov    %esp,%ebp
+  801524:	57                   	push   %edi
+  801525:	56                   	push   %esi
+  801526:	53                   	push   %ebx
+  801527:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80152a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801531:	78 38                	js     80156b <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  801533:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80153a:	74 7b                	je     8015b7 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  80153c:	be 00 00 00 00       	mov    $0x0,%esi
+  801541:	8b 55 08             	mov    0x8(%ebp),%edx
+  801544:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801547:	b8 17 00 00 00       	mov    $0x17,%eax
+  80154c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80154f:	89 f7                	mov    %esi,%edi
+  801551:	55                   	push   %ebp
+  801552:	68 5b 15 80 00       	push   $0x80155b
+  801557:	89 e5                	mov    %esp,%ebp
+  801559:	0f 34                	sysenter
+  80155b:	83 c4 04             	add    $0x4,%esp
+  80155e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80155f:	85 c0                	test   %eax,%eax
+  801561:	7f 6d                	jg     8015d0 <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  801563:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801566:	5b                   	pop    %ebx
+  801567:	5e                   	pop    %esi
+  801568:	5f                   	pop    %edi
+  801569:	5d                   	pop    %ebp
+  80156a:	c3                   	ret
+  80156b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801570:	0f a2                	cpuid
+		return 0;
+  801572:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801577:	f6 c6 08             	test   $0x8,%dh
+  80157a:	74 15                	je     801591 <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80157c:	89 c2                	mov    %eax,%edx
+  80157e:	c1 ea 08             	shr    $0x8,%edx
+  801581:	83 e2 0f             	and    $0xf,%edx
+  801584:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801589:	83 fa 06             	cmp    $0x6,%edx
+  80158c:	74 0e                	je     80159c <sys_shm_detach+0x7b>
+  80158e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801591:	0f b6 c9             	movzbl %cl,%ecx
+  801594:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80159a:	eb 97                	jmp    801533 <sys_shm_detach+0x12>
+  80159c:	89 c2                	mov    %eax,%edx
+  80159e:	c1 ea 04             	shr    $0x4,%edx
+  8015a1:	83 e2 0f             	and    $0xf,%edx
+  8015a4:	83 fa 02             	cmp    $0x2,%edx
+  8015a7:	77 e5                	ja     80158e <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  8015a9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015ac:	83 f8 02             	cmp    $0x2,%eax
+  8015af:	0f 97 c1             	seta   %cl
+  8015b2:	0f b6 c9             	movzbl %cl,%ecx
+  8015b5:	eb d7                	jmp    80158e <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  8015b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8015bc:	b8 17 00 00 00       	mov    $0x17,%eax
+  8015c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015c7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015ca:	89 f7                	mov    %esi,%edi
+  8015cc:	cd 30                	int    $0x30
+  8015ce:	eb 8f                	jmp    80155f <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015d0:	83 ec 0c             	sub    $0xc,%esp
+  8015d3:	50                   	push   %eax
+  8015d4:	6a 17                	push   $0x17
+  8015d6:	68 cf 27 80 00       	push   $0x8027cf
+  8015db:	6a 4a                	push   $0x4a
+  8015dd:	68 ec 27 80 00       	push   $0x8027ec
+  8015e2:	e8 2e 06 00 00       	call   801c15 <_panic>
+
+008015e7 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  8015e7:	55                   	push   %ebp
+  8015e8:	89 e5                	mov    %esp,%ebp
+  8015ea:	57                   	push   %edi
+  8015eb:	56                   	push   %esi
+  8015ec:	53                   	push   %ebx
+  8015ed:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8015f0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8015f7:	78 36                	js     80162f <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  8015f9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801600:	74 79                	je     80167b <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  801602:	8b 55 08             	mov    0x8(%ebp),%edx
+  801605:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80160a:	b8 18 00 00 00       	mov    $0x18,%eax
+  80160f:	89 cb                	mov    %ecx,%ebx
+  801611:	89 cf                	mov    %ecx,%edi
+  801613:	89 ce                	mov    %ecx,%esi
+  801615:	55                   	push   %ebp
+  801616:	68 1f 16 80 00       	push   $0x80161f
+  80161b:	89 e5                	mov    %esp,%ebp
+  80161d:	0f 34                	sysenter
+  80161f:	83 c4 04             	add    $0x4,%esp
+  801622:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801623:	85 c0                	test   %eax,%eax
+  801625:	7f 6b                	jg     801692 <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  801627:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80162a:	5b                   	pop    %ebx
+  80162b:	5e                   	pop    %esi
+  80162c:	5f                   	pop    %edi
+  80162d:	5d                   	pop    %ebp
+  80162e:	c3                   	ret
+  80162f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801634:	0f a2                	cpuid
+		return 0;
+  801636:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80163b:	f6 c6 08             	test   $0x8,%dh
+  80163e:	74 15                	je     801655 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801640:	89 c2                	mov    %eax,%edx
+  801642:	c1 ea 08             	shr    $0x8,%edx
+  801645:	83 e2 0f             	and    $0xf,%edx
+  801648:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80164d:	83 fa 06             	cmp    $0x6,%edx
+  801650:	74 0e                	je     801660 <sys_shm_remove+0x79>
+  801652:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801655:	0f b6 c9             	movzbl %cl,%ecx
+  801658:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80165e:	eb 99                	jmp    8015f9 <sys_shm_remove+0x12>
+  801660:	89 c2                	mov    %eax,%edx
+  801662:	c1 ea 04             	shr    $0x4,%edx
+  801665:	83 e2 0f             	and    $0xf,%edx
+  801668:	83 fa 02             	cmp    $0x2,%edx
+  80166b:	77 e5                	ja     801652 <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  80166d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801670:	83 f8 02             	cmp    $0x2,%eax
+  801673:	0f 97 c1             	seta   %cl
+  801676:	0f b6 c9             	movzbl %cl,%ecx
+  801679:	eb d7                	jmp    801652 <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  80167b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801680:	b8 18 00 00 00       	mov    $0x18,%eax
+  801685:	8b 55 08             	mov    0x8(%ebp),%edx
+  801688:	89 cb                	mov    %ecx,%ebx
+  80168a:	89 cf                	mov    %ecx,%edi
+  80168c:	89 ce                	mov    %ecx,%esi
+  80168e:	cd 30                	int    $0x30
+  801690:	eb 91                	jmp    801623 <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801692:	83 ec 0c             	sub    $0xc,%esp
+  801695:	50                   	push   %eax
+  801696:	6a 18                	push   $0x18
+  801698:	68 cf 27 80 00       	push   $0x8027cf
+  80169d:	6a 4a                	push   $0x4a
+  80169f:	68 ec 27 80 00       	push   $0x8027ec
+  8016a4:	e8 6c 05 00 00       	call   801c15 <_panic>
+
+008016a9 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  8016a9:	55                   	push   %ebp
+  8016aa:	89 e5                	mov    %esp,%ebp
+  8016ac:	57                   	push   %edi
+  8016ad:	56                   	push   %esi
+  8016ae:	53                   	push   %ebx
+  8016af:	83 ec 0c             	sub    $0xc,%esp
+  8016b2:	8b 45 10             	mov    0x10(%ebp),%eax
+  8016b5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8016b8:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  8016bb:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8016c2:	78 32                	js     8016f6 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  8016c4:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8016cb:	74 75                	je     801742 <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  8016cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016d3:	b8 20 00 00 00       	mov    $0x20,%eax
+  8016d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8016dd:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8016e0:	55                   	push   %ebp
+  8016e1:	68 ea 16 80 00       	push   $0x8016ea
+  8016e6:	89 e5                	mov    %esp,%ebp
+  8016e8:	0f 34                	sysenter
+  8016ea:	83 c4 04             	add    $0x4,%esp
+  8016ed:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  8016ee:	83 c4 0c             	add    $0xc,%esp
+  8016f1:	5b                   	pop    %ebx
+  8016f2:	5e                   	pop    %esi
+  8016f3:	5f                   	pop    %edi
+  8016f4:	5d                   	pop    %ebp
+  8016f5:	c3                   	ret
+  8016f6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016fb:	0f a2                	cpuid
+		return 0;
+  8016fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801702:	f6 c6 08             	test   $0x8,%dh
+  801705:	74 15                	je     80171c <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801707:	89 c2                	mov    %eax,%edx
+  801709:	c1 ea 08             	shr    $0x8,%edx
+  80170c:	83 e2 0f             	and    $0xf,%edx
+  80170f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801714:	83 fa 06             	cmp    $0x6,%edx
+  801717:	74 0e                	je     801727 <sys_futex_wait+0x7e>
+  801719:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80171c:	0f b6 c9             	movzbl %cl,%ecx
+  80171f:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801725:	eb 9d                	jmp    8016c4 <sys_futex_wait+0x1b>
+  801727:	89 c2                	mov    %eax,%edx
+  801729:	c1 ea 04             	shr    $0x4,%edx
+  80172c:	83 e2 0f             	and    $0xf,%edx
+  80172f:	83 fa 02             	cmp    $0x2,%edx
+  801732:	77 e5                	ja     801719 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  801734:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801737:	83 f8 02             	cmp    $0x2,%eax
+  80173a:	0f 97 c1             	seta   %cl
+  80173d:	0f b6 c9             	movzbl %cl,%ecx
+  801740:	eb d7                	jmp    801719 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  801742:	b8 20 00 00 00       	mov    $0x20,%eax
+  801747:	be 00 00 00 00       	mov    $0x0,%esi
+  80174c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80174f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801752:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  801755:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  801757:	eb 95                	jmp    8016ee <sys_futex_wait+0x45>
+
+00801759 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801759:	55                   	push   %ebp
+  80175a:	89 e5                	mov    %esp,%ebp
+  80175c:	57                   	push   %edi
+  80175d:	56                   	push   %esi
+  80175e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80175f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801766:	78 30                	js     801798 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  801768:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80176f:	74 73                	je     8017e4 <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801771:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801776:	8b 55 08             	mov    0x8(%ebp),%edx
+  801779:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80177c:	b8 21 00 00 00       	mov    $0x21,%eax
+  801781:	89 df                	mov    %ebx,%edi
+  801783:	89 de                	mov    %ebx,%esi
+  801785:	55                   	push   %ebp
+  801786:	68 8f 17 80 00       	push   $0x80178f
+  80178b:	89 e5                	mov    %esp,%ebp
+  80178d:	0f 34                	sysenter
+  80178f:	83 c4 04             	add    $0x4,%esp
+  801792:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801793:	5b                   	pop    %ebx
+  801794:	5e                   	pop    %esi
+  801795:	5f                   	pop    %edi
+  801796:	5d                   	pop    %ebp
+  801797:	c3                   	ret
+  801798:	b8 01 00 00 00       	mov    $0x1,%eax
+  80179d:	0f a2                	cpuid
+		return 0;
+  80179f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8017a4:	f6 c6 08             	test   $0x8,%dh
+  8017a7:	74 15                	je     8017be <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017a9:	89 c2                	mov    %eax,%edx
+  8017ab:	c1 ea 08             	shr    $0x8,%edx
+  8017ae:	83 e2 0f             	and    $0xf,%edx
+  8017b1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017b6:	83 fa 06             	cmp    $0x6,%edx
+  8017b9:	74 0e                	je     8017c9 <sys_futex_wake+0x70>
+  8017bb:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8017be:	0f b6 c9             	movzbl %cl,%ecx
+  8017c1:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8017c7:	eb 9f                	jmp    801768 <sys_futex_wake+0xf>
+  8017c9:	89 c2                	mov    %eax,%edx
+  8017cb:	c1 ea 04             	shr    $0x4,%edx
+  8017ce:	83 e2 0f             	and    $0xf,%edx
+  8017d1:	83 fa 02             	cmp    $0x2,%edx
+  8017d4:	77 e5                	ja     8017bb <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  8017d6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017d9:	83 f8 02             	cmp    $0x2,%eax
+  8017dc:	0f 97 c1             	seta   %cl
+  8017df:	0f b6 c9             	movzbl %cl,%ecx
+  8017e2:	eb d7                	jmp    8017bb <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  8017e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017e9:	b8 21 00 00 00       	mov    $0x21,%eax
+  8017ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017f4:	89 df                	mov    %ebx,%edi
+  8017f6:	89 de                	mov    %ebx,%esi
+  8017f8:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  8017fa:	eb 97                	jmp    801793 <sys_futex_wake+0x3a>
+
+008017fc <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  8017fc:	55                   	push   %ebp
+  8017fd:	89 e5                	mov    %esp,%ebp
+  8017ff:	57                   	push   %edi
+  801800:	56                   	push   %esi
+  801801:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801802:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801809:	78 2e                	js     801839 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  80180b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801812:	74 71                	je     801885 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  801814:	ba 00 00 00 00       	mov    $0x0,%edx
+  801819:	b8 22 00 00 00       	mov    $0x22,%eax
+  80181e:	89 d1                	mov    %edx,%ecx
+  801820:	89 d3                	mov    %edx,%ebx
+  801822:	89 d7                	mov    %edx,%edi
+  801824:	89 d6                	mov    %edx,%esi
+  801826:	55                   	push   %ebp
+  801827:	68 30 18 80 00       	push   $0x801830
+  80182c:	89 e5                	mov    %esp,%ebp
+  80182e:	0f 34                	sysenter
+  801830:	83 c4 04             	add    $0x4,%esp
+  801833:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  801834:	5b                   	pop    %ebx
+  801835:	5e                   	pop    %esi
+  801836:	5f                   	pop    %edi
+  801837:	5d                   	pop    %ebp
+  801838:	c3                   	ret
+  801839:	b8 01 00 00 00       	mov    $0x1,%eax
+  80183e:	0f a2                	cpuid
+		return 0;
+  801840:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801845:	f6 c6 08             	test   $0x8,%dh
+  801848:	74 15                	je     80185f <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80184a:	89 c2                	mov    %eax,%edx
+  80184c:	c1 ea 08             	shr    $0x8,%edx
+  80184f:	83 e2 0f             	and    $0xf,%edx
+  801852:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801857:	83 fa 06             	cmp    $0x6,%edx
+  80185a:	74 0e                	je     80186a <sys_ep_create+0x6e>
+  80185c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80185f:	0f b6 c9             	movzbl %cl,%ecx
+  801862:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801868:	eb a1                	jmp    80180b <sys_ep_create+0xf>
+  80186a:	89 c2                	mov    %eax,%edx
+  80186c:	c1 ea 04             	shr    $0x4,%edx
+  80186f:	83 e2 0f             	and    $0xf,%edx
+  801872:	83 fa 02             	cmp    $0x2,%edx
+  801875:	77 e5                	ja     80185c <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  801877:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80187a:	83 f8 02             	cmp    $0x2,%eax
+  80187d:	0f 97 c1             	seta   %cl
+  801880:	0f b6 c9             	movzbl %cl,%ecx
+  801883:	eb d7                	jmp    80185c <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  801885:	ba 00 00 00 00       	mov    $0x0,%edx
+  80188a:	b8 22 00 00 00       	mov    $0x22,%eax
+  80188f:	89 d1                	mov    %edx,%ecx
+  801891:	89 d3                	mov    %edx,%ebx
+  801893:	89 d7                	mov    %edx,%edi
+  801895:	89 d6                	mov    %edx,%esi
+  801897:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  801899:	eb 99                	jmp    801834 <sys_ep_create+0x38>
+
+0080189b <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  80189b:	55                   	push   %ebp
+  80189c:	89 e5                	mov    %esp,%ebp
+  80189e:	57                   	push   %edi
+  80189f:	56                   	push   %esi
+  8018a0:	53                   	push   %ebx
+  8018a1:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8018a4:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8018ab:	78 36                	js     8018e3 <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  8018ad:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8018b4:	74 79                	je     80192f <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  8018b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018be:	b8 23 00 00 00       	mov    $0x23,%eax
+  8018c3:	89 cb                	mov    %ecx,%ebx
+  8018c5:	89 cf                	mov    %ecx,%edi
+  8018c7:	89 ce                	mov    %ecx,%esi
+  8018c9:	55                   	push   %ebp
+  8018ca:	68 d3 18 80 00       	push   $0x8018d3
+  8018cf:	89 e5                	mov    %esp,%ebp
+  8018d1:	0f 34                	sysenter
+  8018d3:	83 c4 04             	add    $0x4,%esp
+  8018d6:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8018d7:	85 c0                	test   %eax,%eax
+  8018d9:	7f 6b                	jg     801946 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  8018db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018de:	5b                   	pop    %ebx
+  8018df:	5e                   	pop    %esi
+  8018e0:	5f                   	pop    %edi
+  8018e1:	5d                   	pop    %ebp
+  8018e2:	c3                   	ret
+  8018e3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018e8:	0f a2                	cpuid
+		return 0;
+  8018ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018ef:	f6 c6 08             	test   $0x8,%dh
+  8018f2:	74 15                	je     801909 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018f4:	89 c2                	mov    %eax,%edx
+  8018f6:	c1 ea 08             	shr    $0x8,%edx
+  8018f9:	83 e2 0f             	and    $0xf,%edx
+  8018fc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801901:	83 fa 06             	cmp    $0x6,%edx
+  801904:	74 0e                	je     801914 <sys_ep_destroy+0x79>
+  801906:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801909:	0f b6 c9             	movzbl %cl,%ecx
+  80190c:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801912:	eb 99                	jmp    8018ad <sys_ep_destroy+0x12>
+  801914:	89 c2                	mov    %eax,%edx
+  801916:	c1 ea 04             	shr    $0x4,%edx
+  801919:	83 e2 0f             	and    $0xf,%edx
+  80191c:	83 fa 02             	cmp    $0x2,%edx
+  80191f:	77 e5                	ja     801906 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  801921:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801924:	83 f8 02             	cmp    $0x2,%eax
+  801927:	0f 97 c1             	seta   %cl
+  80192a:	0f b6 c9             	movzbl %cl,%ecx
+  80192d:	eb d7                	jmp    801906 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  80192f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801934:	b8 23 00 00 00       	mov    $0x23,%eax
+  801939:	8b 55 08             	mov    0x8(%ebp),%edx
+  80193c:	89 cb                	mov    %ecx,%ebx
+  80193e:	89 cf                	mov    %ecx,%edi
+  801940:	89 ce                	mov    %ecx,%esi
+  801942:	cd 30                	int    $0x30
+  801944:	eb 91                	jmp    8018d7 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801946:	83 ec 0c             	sub    $0xc,%esp
+  801949:	50                   	push   %eax
+  80194a:	6a 23                	push   $0x23
+  80194c:	68 cf 27 80 00       	push   $0x8027cf
+  801951:	6a 4a                	push   $0x4a
+  801953:	68 ec 27 80 00       	push   $0x8027ec
+  801958:	e8 b8 02 00 00       	call   801c15 <_panic>
+
+0080195d <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  80195d:	55                   	push   %ebp
+  80195e:	89 e5                	mov    %esp,%ebp
+  801960:	57                   	push   %edi
+  801961:	56                   	push   %esi
+  801962:	53                   	push   %ebx
+  801963:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801966:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80196d:	78 37                	js     8019a6 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  80196f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801976:	74 7a                	je     8019f2 <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  801978:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80197d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801980:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801983:	b8 24 00 00 00       	mov    $0x24,%eax
+  801988:	89 df                	mov    %ebx,%edi
+  80198a:	89 de                	mov    %ebx,%esi
+  80198c:	55                   	push   %ebp
+  80198d:	68 96 19 80 00       	push   $0x801996
+  801992:	89 e5                	mov    %esp,%ebp
+  801994:	0f 34                	sysenter
+  801996:	83 c4 04             	add    $0x4,%esp
+  801999:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80199a:	85 c0                	test   %eax,%eax
+  80199c:	7f 6c                	jg     801a0a <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  80199e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019a1:	5b                   	pop    %ebx
+  8019a2:	5e                   	pop    %esi
+  8019a3:	5f                   	pop    %edi
+  8019a4:	5d                   	pop    %ebp
+  8019a5:	c3                   	ret
+  8019a6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019ab:	0f a2                	cpuid
+		return 0;
+  8019ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8019b2:	f6 c6 08             	test   $0x8,%dh
+  8019b5:	74 15                	je     8019cc <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019b7:	89 c2                	mov    %eax,%edx
+  8019b9:	c1 ea 08             	shr    $0x8,%edx
+  8019bc:	83 e2 0f             	and    $0xf,%edx
+  8019bf:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019c4:	83 fa 06             	cmp    $0x6,%edx
+  8019c7:	74 0e                	je     8019d7 <sys_ep_grant+0x7a>
+  8019c9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8019cc:	0f b6 c9             	movzbl %cl,%ecx
+  8019cf:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8019d5:	eb 98                	jmp    80196f <sys_ep_grant+0x12>
+  8019d7:	89 c2                	mov    %eax,%edx
+  8019d9:	c1 ea 04             	shr    $0x4,%edx
+  8019dc:	83 e2 0f             	and    $0xf,%edx
+  8019df:	83 fa 02             	cmp    $0x2,%edx
+  8019e2:	77 e5                	ja     8019c9 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  8019e4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019e7:	83 f8 02             	cmp    $0x2,%eax
+  8019ea:	0f 97 c1             	seta   %cl
+  8019ed:	0f b6 c9             	movzbl %cl,%ecx
+  8019f0:	eb d7                	jmp    8019c9 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  8019f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019f7:	b8 24 00 00 00       	mov    $0x24,%eax
+  8019fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a02:	89 df                	mov    %ebx,%edi
+  801a04:	89 de                	mov    %ebx,%esi
+  801a06:	cd 30                	int    $0x30
+  801a08:	eb 90                	jmp    80199a <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a0a:	83 ec 0c             	sub    $0xc,%esp
+  801a0d:	50                   	push   %eax
+  801a0e:	6a 24                	push   $0x24
+  801a10:	68 cf 27 80 00       	push   $0x8027cf
+  801a15:	6a 4a                	push   $0x4a
+  801a17:	68 ec 27 80 00       	push   $0x8027ec
+  801a1c:	e8 f4 01 00 00       	call   801c15 <_panic>
+
+00801a21 <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  801a21:	55                   	push   %ebp
+  801a22:	89 e5                	mov    %esp,%ebp
+  801a24:	57                   	push   %edi
+  801a25:	56                   	push   %esi
+  801a26:	53                   	push   %ebx
+  801a27:	83 ec 20             	sub    $0x20,%esp
+  801a2a:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801a2d:	8b 10                	mov    (%eax),%edx
+  801a2f:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801a32:	8b 50 04             	mov    0x4(%eax),%edx
+  801a35:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801a38:	8b 50 08             	mov    0x8(%eax),%edx
+  801a3b:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801a3e:	8b 50 0c             	mov    0xc(%eax),%edx
+  801a41:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801a44:	8b 40 10             	mov    0x10(%eax),%eax
+  801a47:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801a4a:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801a4d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a50:	b8 25 00 00 00       	mov    $0x25,%eax
+  801a55:	55                   	push   %ebp
+  801a56:	56                   	push   %esi
+  801a57:	8b 0e                	mov    (%esi),%ecx
+  801a59:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801a5c:	8b 7e 08             	mov    0x8(%esi),%edi
+  801a5f:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801a62:	8b 76 0c             	mov    0xc(%esi),%esi
+  801a65:	cd 30                	int    $0x30
+  801a67:	87 34 24             	xchg   %esi,(%esp)
+  801a6a:	89 0e                	mov    %ecx,(%esi)
+  801a6c:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801a6f:	89 7e 08             	mov    %edi,0x8(%esi)
+  801a72:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801a75:	8f 46 0c             	pop    0xc(%esi)
+  801a78:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  801a79:	83 c4 20             	add    $0x20,%esp
+  801a7c:	5b                   	pop    %ebx
+  801a7d:	5e                   	pop    %esi
+  801a7e:	5f                   	pop    %edi
+  801a7f:	5d                   	pop    %ebp
+  801a80:	c3                   	ret
+
+00801a81 <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  801a81:	55                   	push   %ebp
+  801a82:	89 e5                	mov    %esp,%ebp
+  801a84:	57                   	push   %edi
+  801a85:	56                   	push   %esi
+  801a86:	53                   	push   %ebx
+  801a87:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  801a8a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a8d:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  801a8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a92:	b8 26 00 00 00       	mov    $0x26,%eax
+  801a97:	55                   	push   %ebp
+  801a98:	56                   	push   %esi
+  801a99:	8b 0e                	mov    (%esi),%ecx
+  801a9b:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801a9e:	8b 7e 08             	mov    0x8(%esi),%edi
+  801aa1:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801aa4:	8b 76 0c             	mov    0xc(%esi),%esi
+  801aa7:	cd 30                	int    $0x30
+  801aa9:	87 34 24             	xchg   %esi,(%esp)
+  801aac:	89 0e                	mov    %ecx,(%esi)
+  801aae:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801ab1:	89 7e 08             	mov    %edi,0x8(%esi)
+  801ab4:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801ab7:	8f 46 0c             	pop    0xc(%esi)
+  801aba:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  801abb:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  801abf:	74 0f                	je     801ad0 <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  801ac1:	85 c0                	test   %eax,%eax
+  801ac3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ac8:	0f 48 d1             	cmovs  %ecx,%edx
+  801acb:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  801ace:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  801ad0:	5b                   	pop    %ebx
+  801ad1:	5e                   	pop    %esi
+  801ad2:	5f                   	pop    %edi
+  801ad3:	5d                   	pop    %ebp
+  801ad4:	c3                   	ret
+
+00801ad5 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  801ad5:	55                   	push   %ebp
+  801ad6:	89 e5                	mov    %esp,%ebp
+  801ad8:	57                   	push   %edi
+  801ad9:	56                   	push   %esi
+  801ada:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801adb:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801ae2:	78 2f                	js     801b13 <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  801ae4:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801aeb:	74 72                	je     801b5f <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  801aed:	8b 55 08             	mov    0x8(%ebp),%edx
+  801af0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801af5:	b8 27 00 00 00       	mov    $0x27,%eax
+  801afa:	89 cb                	mov    %ecx,%ebx
+  801afc:	89 cf                	mov    %ecx,%edi
+  801afe:	89 ce                	mov    %ecx,%esi
+  801b00:	55                   	push   %ebp
+  801b01:	68 0a 1b 80 00       	push   $0x801b0a
+  801b06:	89 e5                	mov    %esp,%ebp
+  801b08:	0f 34                	sysenter
+  801b0a:	83 c4 04             	add    $0x4,%esp
+  801b0d:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  801b0e:	5b                   	pop    %ebx
+  801b0f:	5e                   	pop    %esi
+  801b10:	5f                   	pop    %edi
+  801b11:	5d                   	pop    %ebp
+  801b12:	c3                   	ret
+  801b13:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b18:	0f a2                	cpuid
+		return 0;
+  801b1a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b1f:	f6 c6 08             	test   $0x8,%dh
+  801b22:	74 15                	je     801b39 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b24:	89 c2                	mov    %eax,%edx
+  801b26:	c1 ea 08             	shr    $0x8,%edx
+  801b29:	83 e2 0f             	and    $0xf,%edx
+  801b2c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b31:	83 fa 06             	cmp    $0x6,%edx
+  801b34:	74 0e                	je     801b44 <sys_sysring_setup+0x6f>
+  801b36:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b39:	0f b6 c9             	movzbl %cl,%ecx
+  801b3c:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801b42:	eb a0                	jmp    801ae4 <sys_sysring_setup+0xf>
+  801b44:	89 c2                	mov    %eax,%edx
+  801b46:	c1 ea 04             	shr    $0x4,%edx
+  801b49:	83 e2 0f             	and    $0xf,%edx
+  801b4c:	83 fa 02             	cmp    $0x2,%edx
+  801b4f:	77 e5                	ja     801b36 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  801b51:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b54:	83 f8 02             	cmp    $0x2,%eax
+  801b57:	0f 97 c1             	seta   %cl
+  801b5a:	0f b6 c9             	movzbl %cl,%ecx
+  801b5d:	eb d7                	jmp    801b36 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  801b5f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b64:	b8 27 00 00 00       	mov    $0x27,%eax
+  801b69:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b6c:	89 cb                	mov    %ecx,%ebx
+  801b6e:	89 cf                	mov    %ecx,%edi
+  801b70:	89 ce                	mov    %ecx,%esi
+  801b72:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  801b74:	eb 98                	jmp    801b0e <sys_sysring_setup+0x39>
+
+00801b76 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  801b76:	55                   	push   %ebp
+  801b77:	89 e5                	mov    %esp,%ebp
+  801b79:	57                   	push   %edi
+  801b7a:	56                   	push   %esi
+  801b7b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801b7c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b83:	78 2e                	js     801bb3 <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  801b85:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b8c:	74 71                	je     801bff <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  801b8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b93:	b8 28 00 00 00       	mov    $0x28,%eax
+  801b98:	89 d1                	mov    %edx,%ecx
+  801b9a:	89 d3                	mov    %edx,%ebx
+  801b9c:	89 d7                	mov    %edx,%edi
+  801b9e:	89 d6                	mov    %edx,%esi
+  801ba0:	55                   	push   %ebp
+  801ba1:	68 aa 1b 80 00       	push   $0x801baa
+  801ba6:	89 e5                	mov    %esp,%ebp
+  801ba8:	0f 34                	sysenter
+  801baa:	83 c4 04             	add    $0x4,%esp
+  801bad:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801bae:	5b                   	pop    %ebx
+  801baf:	5e                   	pop    %esi
+  801bb0:	5f                   	pop    %edi
+  801bb1:	5d                   	pop    %ebp
+  801bb2:	c3                   	ret
+  801bb3:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bb8:	0f a2                	cpuid
+		return 0;
+  801bba:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801bbf:	f6 c6 08             	test   $0x8,%dh
+  801bc2:	74 15                	je     801bd9 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bc4:	89 c2                	mov    %eax,%edx
+  801bc6:	c1 ea 08             	shr    $0x8,%edx
+  801bc9:	83 e2 0f             	and    $0xf,%edx
+  801bcc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801bd1:	83 fa 06             	cmp    $0x6,%edx
+  801bd4:	74 0e                	je     801be4 <sys_sysring_enter+0x6e>
+  801bd6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801bd9:	0f b6 c9             	movzbl %cl,%ecx
+  801bdc:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801be2:	eb a1                	jmp    801b85 <sys_sysring_enter+0xf>
+  801be4:	89 c2                	mov    %eax,%edx
+  801be6:	c1 ea 04             	shr    $0x4,%edx
+  801be9:	83 e2 0f             	and    $0xf,%edx
+  801bec:	83 fa 02             	cmp    $0x2,%edx
+  801bef:	77 e5                	ja     801bd6 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  801bf1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bf4:	83 f8 02             	cmp    $0x2,%eax
+  801bf7:	0f 97 c1             	seta   %cl
+  801bfa:	0f b6 c9             	movzbl %cl,%ecx
+  801bfd:	eb d7                	jmp    801bd6 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  801bff:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c04:	b8 28 00 00 00       	mov    $0x28,%eax
+  801c09:	89 d1                	mov    %edx,%ecx
+  801c0b:	89 d3                	mov    %edx,%ebx
+  801c0d:	89 d7                	mov    %edx,%edi
+  801c0f:	89 d6                	mov    %edx,%esi
+  801c11:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  801c13:	eb 99                	jmp    801bae <sys_sysring_enter+0x38>
+
+00801c15 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801c15:	55                   	push   %ebp
+  801c16:	89 e5                	mov    %esp,%ebp
+  801c18:	57                   	push   %edi
+  801c19:	56                   	push   %esi
+  801c1a:	53                   	push   %ebx
+  801c1b:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  801c21:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  801c24:	8b 1d 00 30 80 00    	mov    0x803000,%ebx
+  801c2a:	e8 c8 e8 ff ff       	call   8004f7 <sys_getenvid>
+  801c2f:	83 ec 04             	sub    $0x4,%esp
+  801c32:	ff 75 0c             	push   0xc(%ebp)
+  801c35:	ff 75 08             	push   0x8(%ebp)
+  801c38:	53                   	push   %ebx
+  801c39:	50                   	push   %eax
+  801c3a:	68 fc 27 80 00       	push   $0x8027fc
+  801c3f:	68 00 01 00 00       	push   $0x100
+  801c44:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  801c4a:	56                   	push   %esi
+  801c4b:	e8 c9 05 00 00       	call   802219 <snprintf>
+  801c50:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  801c52:	83 c4 20             	add    $0x20,%esp
+  801c55:	57                   	push   %edi
+  801c56:	ff 75 10             	push   0x10(%ebp)
+  801c59:	bf 00 01 00 00       	mov    $0x100,%edi
+  801c5e:	89 f8                	mov    %edi,%eax
+  801c60:	29 d8                	sub    %ebx,%eax
+  801c62:	50                   	push   %eax
+  801c63:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801c66:	50                   	push   %eax
+  801c67:	e8 5f 05 00 00       	call   8021cb <vsnprintf>
+  801c6c:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  801c6e:	83 c4 0c             	add    $0xc,%esp
+  801c71:	68 1f 28 80 00       	push   $0x80281f
+  801c76:	29 df                	sub    %ebx,%edi
+  801c78:	57                   	push   %edi
+  801c79:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801c7c:	50                   	push   %eax
+  801c7d:	e8 97 05 00 00       	call   802219 <snprintf>
+	sys_cputs(buf, r);
+  801c82:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  801c85:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  801c87:	53                   	push   %ebx
+  801c88:	56                   	push   %esi
+  801c89:	e8 6b e6 ff ff       	call   8002f9 <sys_cputs>
+  801c8e:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801c91:	cc                   	int3
+	while (1)
+  801c92:	eb fd                	jmp    801c91 <_panic+0x7c>
+
+00801c94 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801c94:	55                   	push   %ebp
+  801c95:	89 e5                	mov    %esp,%ebp
+  801c97:	57                   	push   %edi
+  801c98:	56                   	push   %esi
+  801c99:	53                   	push   %ebx
+  801c9a:	83 ec 1c             	sub    $0x1c,%esp
+  801c9d:	89 c7                	mov    %eax,%edi
+  801c9f:	89 d6                	mov    %edx,%esi
+  801ca1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ca4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ca7:	89 d1                	mov    %edx,%ecx
+  801ca9:	89 c2                	mov    %eax,%edx
+  801cab:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801cae:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801cb1:	8b 45 10             	mov    0x10(%ebp),%eax
+  801cb4:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  801cb7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801cba:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801cc1:	39 c2                	cmp    %eax,%edx
+  801cc3:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  801cc6:	72 3e                	jb     801d06 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801cc8:	83 ec 0c             	sub    $0xc,%esp
+  801ccb:	ff 75 18             	push   0x18(%ebp)
+  801cce:	83 eb 01             	sub    $0x1,%ebx
+  801cd1:	53                   	push   %ebx
+  801cd2:	50                   	push   %eax
+  801cd3:	83 ec 08             	sub    $0x8,%esp
+  801cd6:	ff 75 e4             	push   -0x1c(%ebp)
+  801cd9:	ff 75 e0             	push   -0x20(%ebp)
+  801cdc:	ff 75 dc             	push   -0x24(%ebp)
+  801cdf:	ff 75 d8             	push   -0x28(%ebp)
+  801ce2:	e8 9a 09 00 00       	call   802681 <__udivdi3>
+  801ce7:	83 c4 18             	add    $0x18,%esp
+  801cea:	52                   	push   %edx
+  801ceb:	50                   	push   %eax
+  801cec:	89 f2                	mov    %esi,%edx
+  801cee:	89 f8                	mov    %edi,%eax
+  801cf0:	e8 9f ff ff ff       	call   801c94 <printnum>
+  801cf5:	83 c4 20             	add    $0x20,%esp
+  801cf8:	eb 13                	jmp    801d0d <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  801cfa:	83 ec 08             	sub    $0x8,%esp
+  801cfd:	56                   	push   %esi
+  801cfe:	ff 75 18             	push   0x18(%ebp)
+  801d01:	ff d7                	call   *%edi
+  801d03:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  801d06:	83 eb 01             	sub    $0x1,%ebx
+  801d09:	85 db                	test   %ebx,%ebx
+  801d0b:	7f ed                	jg     801cfa <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  801d0d:	83 ec 08             	sub    $0x8,%esp
+  801d10:	56                   	push   %esi
+  801d11:	83 ec 04             	sub    $0x4,%esp
+  801d14:	ff 75 e4             	push   -0x1c(%ebp)
+  801d17:	ff 75 e0             	push   -0x20(%ebp)
+  801d1a:	ff 75 dc             	push   -0x24(%ebp)
+  801d1d:	ff 75 d8             	push   -0x28(%ebp)
+  801d20:	e8 7a 09 00 00       	call   80269f <__umoddi3>
+  801d25:	83 c4 14             	add    $0x14,%esp
+  801d28:	0f be 80 21 28 80 00 	movsbl 0x802821(%eax),%eax
+  801d2f:	50                   	push   %eax
+  801d30:	ff d7                	call   *%edi
+}
+  801d32:	83 c4 10             	add    $0x10,%esp
+  801d35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d38:	5b                   	pop    %ebx
+  801d39:	5e                   	pop    %esi
+  801d3a:	5f                   	pop    %edi
+  801d3b:	5d                   	pop    %ebp
+  801d3c:	c3                   	ret
+
+00801d3d <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801d3d:	55                   	push   %ebp
+  801d3e:	89 e5                	mov    %esp,%ebp
+  801d40:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  801d43:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  801d47:	8b 10                	mov    (%eax),%edx
+  801d49:	3b 50 04             	cmp    0x4(%eax),%edx
+  801d4c:	73 0a                	jae    801d58 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  801d4e:	8d 4a 01             	lea    0x1(%edx),%ecx
+  801d51:	89 08                	mov    %ecx,(%eax)
+  801d53:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d56:	88 02                	mov    %al,(%edx)
+}
+  801d58:	5d                   	pop    %ebp
+  801d59:	c3                   	ret
+
+00801d5a <printfmt>:
+{
+  801d5a:	55                   	push   %ebp
+  801d5b:	89 e5                	mov    %esp,%ebp
+  801d5d:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  801d60:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  801d63:	50                   	push   %eax
+  801d64:	ff 75 10             	push   0x10(%ebp)
+  801d67:	ff 75 0c             	push   0xc(%ebp)
+  801d6a:	ff 75 08             	push   0x8(%ebp)
+  801d6d:	e8 05 00 00 00       	call   801d77 <vprintfmt>
+}
+  801d72:	83 c4 10             	add    $0x10,%esp
+  801d75:	c9                   	leave
+  801d76:	c3                   	ret
+
+00801d77 <vprintfmt>:
+{
+  801d77:	55                   	push   %ebp
+  801d78:	89 e5                	mov    %esp,%ebp
+  801d7a:	57                   	push   %edi
+  801d7b:	56                   	push   %esi
+  801d7c:	53                   	push   %ebx
+  801d7d:	83 ec 2c             	sub    $0x2c,%esp
+  801d80:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d83:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801d86:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801d89:	eb 0a                	jmp    801d95 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  801d8b:	83 ec 08             	sub    $0x8,%esp
+  801d8e:	53                   	push   %ebx
+  801d8f:	50                   	push   %eax
+  801d90:	ff d6                	call   *%esi
+  801d92:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801d95:	83 c7 01             	add    $0x1,%edi
+  801d98:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801d9c:	83 f8 25             	cmp    $0x25,%eax
+  801d9f:	74 0c                	je     801dad <vprintfmt+0x36>
+			if (ch == '\0')
+  801da1:	85 c0                	test   %eax,%eax
+  801da3:	75 e6                	jne    801d8b <vprintfmt+0x14>
+}
+  801da5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801da8:	5b                   	pop    %ebx
+  801da9:	5e                   	pop    %esi
+  801daa:	5f                   	pop    %edi
+  801dab:	5d                   	pop    %ebp
+  801dac:	c3                   	ret
+		padc = ' ';
+  801dad:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801db1:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  801db8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801dbf:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  801dc6:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801dcb:	8d 47 01             	lea    0x1(%edi),%eax
+  801dce:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801dd1:	0f b6 17             	movzbl (%edi),%edx
+  801dd4:	8d 42 dd             	lea    -0x23(%edx),%eax
+  801dd7:	3c 55                	cmp    $0x55,%al
+  801dd9:	0f 87 cf 03 00 00    	ja     8021ae <vprintfmt+0x437>
+  801ddf:	0f b6 c0             	movzbl %al,%eax
+  801de2:	ff 24 85 00 29 80 00 	jmp    *0x802900(,%eax,4)
+  801de9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801dec:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801df0:	eb d9                	jmp    801dcb <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801df2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801df5:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  801df9:	eb d0                	jmp    801dcb <vprintfmt+0x54>
+  801dfb:	0f b6 d2             	movzbl %dl,%edx
+  801dfe:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  801e01:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e06:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  801e09:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801e0c:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  801e10:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  801e13:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  801e16:	83 f9 09             	cmp    $0x9,%ecx
+  801e19:	77 55                	ja     801e70 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  801e1b:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  801e1e:	eb e9                	jmp    801e09 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  801e20:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e23:	8b 00                	mov    (%eax),%eax
+  801e25:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801e28:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e2b:	8d 40 04             	lea    0x4(%eax),%eax
+  801e2e:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801e31:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  801e34:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801e38:	79 91                	jns    801dcb <vprintfmt+0x54>
+				width = precision, precision = -1;
+  801e3a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801e3d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801e40:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  801e47:	eb 82                	jmp    801dcb <vprintfmt+0x54>
+			if (width < 0)
+  801e49:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801e4c:	85 d2                	test   %edx,%edx
+  801e4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e53:	0f 49 c2             	cmovns %edx,%eax
+  801e56:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801e59:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801e5c:	e9 6a ff ff ff       	jmp    801dcb <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801e61:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  801e64:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  801e6b:	e9 5b ff ff ff       	jmp    801dcb <vprintfmt+0x54>
+  801e70:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801e73:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801e76:	eb bc                	jmp    801e34 <vprintfmt+0xbd>
+			lflag++;
+  801e78:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801e7b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801e7e:	e9 48 ff ff ff       	jmp    801dcb <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  801e83:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e86:	8d 78 04             	lea    0x4(%eax),%edi
+  801e89:	83 ec 08             	sub    $0x8,%esp
+  801e8c:	53                   	push   %ebx
+  801e8d:	ff 30                	push   (%eax)
+  801e8f:	ff d6                	call   *%esi
+			break;
+  801e91:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801e94:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  801e97:	e9 b1 02 00 00       	jmp    80214d <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  801e9c:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e9f:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801ea2:	8b 10                	mov    (%eax),%edx
+  801ea4:	89 d0                	mov    %edx,%eax
+  801ea6:	f7 d8                	neg    %eax
+  801ea8:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801eab:	83 f8 0d             	cmp    $0xd,%eax
+  801eae:	7f 23                	jg     801ed3 <vprintfmt+0x15c>
+  801eb0:	8b 14 85 60 2a 80 00 	mov    0x802a60(,%eax,4),%edx
+  801eb7:	85 d2                	test   %edx,%edx
+  801eb9:	74 18                	je     801ed3 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801ebb:	52                   	push   %edx
+  801ebc:	68 42 28 80 00       	push   $0x802842
+  801ec1:	53                   	push   %ebx
+  801ec2:	56                   	push   %esi
+  801ec3:	e8 92 fe ff ff       	call   801d5a <printfmt>
+  801ec8:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801ecb:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801ece:	e9 7a 02 00 00       	jmp    80214d <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  801ed3:	50                   	push   %eax
+  801ed4:	68 39 28 80 00       	push   $0x802839
+  801ed9:	53                   	push   %ebx
+  801eda:	56                   	push   %esi
+  801edb:	e8 7a fe ff ff       	call   801d5a <printfmt>
+  801ee0:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801ee3:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801ee6:	e9 62 02 00 00       	jmp    80214d <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801eeb:	8b 45 14             	mov    0x14(%ebp),%eax
+  801eee:	83 c0 04             	add    $0x4,%eax
+  801ef1:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801ef4:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ef7:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801ef9:	85 c9                	test   %ecx,%ecx
+  801efb:	b8 32 28 80 00       	mov    $0x802832,%eax
+  801f00:	0f 45 c1             	cmovne %ecx,%eax
+  801f03:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801f06:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801f0a:	7e 06                	jle    801f12 <vprintfmt+0x19b>
+  801f0c:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801f10:	75 0b                	jne    801f1d <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f12:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801f15:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801f18:	89 75 08             	mov    %esi,0x8(%ebp)
+  801f1b:	eb 5c                	jmp    801f79 <vprintfmt+0x202>
+  801f1d:	83 ec 08             	sub    $0x8,%esp
+  801f20:	ff 75 d0             	push   -0x30(%ebp)
+  801f23:	ff 75 cc             	push   -0x34(%ebp)
+  801f26:	e8 20 03 00 00       	call   80224b <strnlen>
+  801f2b:	89 c2                	mov    %eax,%edx
+  801f2d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f30:	29 d0                	sub    %edx,%eax
+  801f32:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801f35:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  801f39:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801f3c:	89 75 08             	mov    %esi,0x8(%ebp)
+  801f3f:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f41:	eb 0e                	jmp    801f51 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801f43:	83 ec 08             	sub    $0x8,%esp
+  801f46:	53                   	push   %ebx
+  801f47:	57                   	push   %edi
+  801f48:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f4b:	83 ee 01             	sub    $0x1,%esi
+  801f4e:	83 c4 10             	add    $0x10,%esp
+  801f51:	85 f6                	test   %esi,%esi
+  801f53:	7f ee                	jg     801f43 <vprintfmt+0x1cc>
+  801f55:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f58:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f5b:	85 c0                	test   %eax,%eax
+  801f5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f62:	0f 49 d0             	cmovns %eax,%edx
+  801f65:	29 d0                	sub    %edx,%eax
+  801f67:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801f6a:	eb a6                	jmp    801f12 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801f6c:	83 ec 08             	sub    $0x8,%esp
+  801f6f:	53                   	push   %ebx
+  801f70:	52                   	push   %edx
+  801f71:	ff 55 08             	call   *0x8(%ebp)
+  801f74:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801f77:	89 f1                	mov    %esi,%ecx
+  801f79:	8d 71 01             	lea    0x1(%ecx),%esi
+  801f7c:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801f80:	0f be d0             	movsbl %al,%edx
+  801f83:	85 d2                	test   %edx,%edx
+  801f85:	74 28                	je     801faf <vprintfmt+0x238>
+  801f87:	85 ff                	test   %edi,%edi
+  801f89:	78 05                	js     801f90 <vprintfmt+0x219>
+  801f8b:	83 ef 01             	sub    $0x1,%edi
+  801f8e:	78 30                	js     801fc0 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801f90:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801f94:	74 d6                	je     801f6c <vprintfmt+0x1f5>
+  801f96:	0f be c0             	movsbl %al,%eax
+  801f99:	83 e8 20             	sub    $0x20,%eax
+  801f9c:	83 f8 5e             	cmp    $0x5e,%eax
+  801f9f:	76 cb                	jbe    801f6c <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801fa1:	83 ec 08             	sub    $0x8,%esp
+  801fa4:	53                   	push   %ebx
+  801fa5:	6a 3f                	push   $0x3f
+  801fa7:	ff 55 08             	call   *0x8(%ebp)
+  801faa:	83 c4 10             	add    $0x10,%esp
+  801fad:	eb c8                	jmp    801f77 <vprintfmt+0x200>
+  801faf:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fb2:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801fb5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801fb8:	01 d0                	add    %edx,%eax
+  801fba:	29 c8                	sub    %ecx,%eax
+  801fbc:	89 c7                	mov    %eax,%edi
+  801fbe:	eb 13                	jmp    801fd3 <vprintfmt+0x25c>
+  801fc0:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fc3:	eb ed                	jmp    801fb2 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801fc5:	83 ec 08             	sub    $0x8,%esp
+  801fc8:	53                   	push   %ebx
+  801fc9:	6a 20                	push   $0x20
+  801fcb:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801fcd:	83 ef 01             	sub    $0x1,%edi
+  801fd0:	83 c4 10             	add    $0x10,%esp
+  801fd3:	85 ff                	test   %edi,%edi
+  801fd5:	7f ee                	jg     801fc5 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801fd7:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801fda:	89 45 14             	mov    %eax,0x14(%ebp)
+  801fdd:	e9 6b 01 00 00       	jmp    80214d <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  801fe2:	83 f9 01             	cmp    $0x1,%ecx
+  801fe5:	7f 1f                	jg     802006 <vprintfmt+0x28f>
+	else if (lflag)
+  801fe7:	85 c9                	test   %ecx,%ecx
+  801fe9:	74 67                	je     802052 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  801feb:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fee:	8b 00                	mov    (%eax),%eax
+  801ff0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801ff3:	89 c1                	mov    %eax,%ecx
+  801ff5:	c1 f9 1f             	sar    $0x1f,%ecx
+  801ff8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801ffb:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ffe:	8d 40 04             	lea    0x4(%eax),%eax
+  802001:	89 45 14             	mov    %eax,0x14(%ebp)
+  802004:	eb 17                	jmp    80201d <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  802006:	8b 45 14             	mov    0x14(%ebp),%eax
+  802009:	8b 50 04             	mov    0x4(%eax),%edx
+  80200c:	8b 00                	mov    (%eax),%eax
+  80200e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802011:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802014:	8b 45 14             	mov    0x14(%ebp),%eax
+  802017:	8d 40 08             	lea    0x8(%eax),%eax
+  80201a:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80201d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802020:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  802023:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  802028:	85 c9                	test   %ecx,%ecx
+  80202a:	0f 89 03 01 00 00    	jns    802133 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  802030:	83 ec 08             	sub    $0x8,%esp
+  802033:	53                   	push   %ebx
+  802034:	6a 2d                	push   $0x2d
+  802036:	ff d6                	call   *%esi
+				num = -(long long) num;
+  802038:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80203b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80203e:	f7 da                	neg    %edx
+  802040:	83 d1 00             	adc    $0x0,%ecx
+  802043:	f7 d9                	neg    %ecx
+  802045:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  802048:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80204d:	e9 e1 00 00 00       	jmp    802133 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  802052:	8b 45 14             	mov    0x14(%ebp),%eax
+  802055:	8b 00                	mov    (%eax),%eax
+  802057:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80205a:	89 c1                	mov    %eax,%ecx
+  80205c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80205f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802062:	8b 45 14             	mov    0x14(%ebp),%eax
+  802065:	8d 40 04             	lea    0x4(%eax),%eax
+  802068:	89 45 14             	mov    %eax,0x14(%ebp)
+  80206b:	eb b0                	jmp    80201d <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80206d:	83 f9 01             	cmp    $0x1,%ecx
+  802070:	7f 1e                	jg     802090 <vprintfmt+0x319>
+	else if (lflag)
+  802072:	85 c9                	test   %ecx,%ecx
+  802074:	74 32                	je     8020a8 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  802076:	8b 45 14             	mov    0x14(%ebp),%eax
+  802079:	8b 10                	mov    (%eax),%edx
+  80207b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802080:	8d 40 04             	lea    0x4(%eax),%eax
+  802083:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802086:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80208b:	e9 a3 00 00 00       	jmp    802133 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802090:	8b 45 14             	mov    0x14(%ebp),%eax
+  802093:	8b 10                	mov    (%eax),%edx
+  802095:	8b 48 04             	mov    0x4(%eax),%ecx
+  802098:	8d 40 08             	lea    0x8(%eax),%eax
+  80209b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80209e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8020a3:	e9 8b 00 00 00       	jmp    802133 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8020a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020ab:	8b 10                	mov    (%eax),%edx
+  8020ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020b2:	8d 40 04             	lea    0x4(%eax),%eax
+  8020b5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8020b8:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8020bd:	eb 74                	jmp    802133 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8020bf:	83 f9 01             	cmp    $0x1,%ecx
+  8020c2:	7f 1b                	jg     8020df <vprintfmt+0x368>
+	else if (lflag)
+  8020c4:	85 c9                	test   %ecx,%ecx
+  8020c6:	74 2c                	je     8020f4 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8020c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020cb:	8b 10                	mov    (%eax),%edx
+  8020cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020d2:	8d 40 04             	lea    0x4(%eax),%eax
+  8020d5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8020d8:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8020dd:	eb 54                	jmp    802133 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8020df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020e2:	8b 10                	mov    (%eax),%edx
+  8020e4:	8b 48 04             	mov    0x4(%eax),%ecx
+  8020e7:	8d 40 08             	lea    0x8(%eax),%eax
+  8020ea:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8020ed:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8020f2:	eb 3f                	jmp    802133 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8020f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020f7:	8b 10                	mov    (%eax),%edx
+  8020f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020fe:	8d 40 04             	lea    0x4(%eax),%eax
+  802101:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802104:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  802109:	eb 28                	jmp    802133 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  80210b:	83 ec 08             	sub    $0x8,%esp
+  80210e:	53                   	push   %ebx
+  80210f:	6a 30                	push   $0x30
+  802111:	ff d6                	call   *%esi
+			putch('x', putdat);
+  802113:	83 c4 08             	add    $0x8,%esp
+  802116:	53                   	push   %ebx
+  802117:	6a 78                	push   $0x78
+  802119:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80211b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80211e:	8b 10                	mov    (%eax),%edx
+  802120:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  802125:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  802128:	8d 40 04             	lea    0x4(%eax),%eax
+  80212b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80212e:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  802133:	83 ec 0c             	sub    $0xc,%esp
+  802136:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80213a:	50                   	push   %eax
+  80213b:	ff 75 e0             	push   -0x20(%ebp)
+  80213e:	57                   	push   %edi
+  80213f:	51                   	push   %ecx
+  802140:	52                   	push   %edx
+  802141:	89 da                	mov    %ebx,%edx
+  802143:	89 f0                	mov    %esi,%eax
+  802145:	e8 4a fb ff ff       	call   801c94 <printnum>
+			break;
+  80214a:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80214d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802150:	e9 40 fc ff ff       	jmp    801d95 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  802155:	83 f9 01             	cmp    $0x1,%ecx
+  802158:	7f 1b                	jg     802175 <vprintfmt+0x3fe>
+	else if (lflag)
+  80215a:	85 c9                	test   %ecx,%ecx
+  80215c:	74 2c                	je     80218a <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  80215e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802161:	8b 10                	mov    (%eax),%edx
+  802163:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802168:	8d 40 04             	lea    0x4(%eax),%eax
+  80216b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80216e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  802173:	eb be                	jmp    802133 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802175:	8b 45 14             	mov    0x14(%ebp),%eax
+  802178:	8b 10                	mov    (%eax),%edx
+  80217a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80217d:	8d 40 08             	lea    0x8(%eax),%eax
+  802180:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802183:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  802188:	eb a9                	jmp    802133 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80218a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80218d:	8b 10                	mov    (%eax),%edx
+  80218f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802194:	8d 40 04             	lea    0x4(%eax),%eax
+  802197:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80219a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80219f:	eb 92                	jmp    802133 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8021a1:	83 ec 08             	sub    $0x8,%esp
+  8021a4:	53                   	push   %ebx
+  8021a5:	6a 25                	push   $0x25
+  8021a7:	ff d6                	call   *%esi
+			break;
+  8021a9:	83 c4 10             	add    $0x10,%esp
+  8021ac:	eb 9f                	jmp    80214d <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8021ae:	83 ec 08             	sub    $0x8,%esp
+  8021b1:	53                   	push   %ebx
+  8021b2:	6a 25                	push   $0x25
+  8021b4:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8021b6:	83 c4 10             	add    $0x10,%esp
+  8021b9:	89 f8                	mov    %edi,%eax
+  8021bb:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8021bf:	74 05                	je     8021c6 <vprintfmt+0x44f>
+  8021c1:	83 e8 01             	sub    $0x1,%eax
+  8021c4:	eb f5                	jmp    8021bb <vprintfmt+0x444>
+  8021c6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8021c9:	eb 82                	jmp    80214d <vprintfmt+0x3d6>
+
+008021cb <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8021cb:	55                   	push   %ebp
+  8021cc:	89 e5                	mov    %esp,%ebp
+  8021ce:	83 ec 18             	sub    $0x18,%esp
+  8021d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021d4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8021d7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8021da:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8021de:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8021e1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8021e8:	85 c0                	test   %eax,%eax
+  8021ea:	74 26                	je     802212 <vsnprintf+0x47>
+  8021ec:	85 d2                	test   %edx,%edx
+  8021ee:	7e 22                	jle    802212 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8021f0:	ff 75 14             	push   0x14(%ebp)
+  8021f3:	ff 75 10             	push   0x10(%ebp)
+  8021f6:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8021f9:	50                   	push   %eax
+  8021fa:	68 3d 1d 80 00       	push   $0x801d3d
+  8021ff:	e8 73 fb ff ff       	call   801d77 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  802204:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802207:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80220a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80220d:	83 c4 10             	add    $0x10,%esp
+}
+  802210:	c9                   	leave
+  802211:	c3                   	ret
+		return -E_INVAL;
+  802212:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802217:	eb f7                	jmp    802210 <vsnprintf+0x45>
+
+00802219 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  802219:	55                   	push   %ebp
+  80221a:	89 e5                	mov    %esp,%ebp
+  80221c:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80221f:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  802222:	50                   	push   %eax
+  802223:	ff 75 10             	push   0x10(%ebp)
+  802226:	ff 75 0c             	push   0xc(%ebp)
+  802229:	ff 75 08             	push   0x8(%ebp)
+  80222c:	e8 9a ff ff ff       	call   8021cb <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  802231:	c9                   	leave
+  802232:	c3                   	ret
+
+00802233 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  802233:	55                   	push   %ebp
+  802234:	89 e5                	mov    %esp,%ebp
+  802236:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  802239:	b8 00 00 00 00       	mov    $0x0,%eax
+  80223e:	eb 03                	jmp    802243 <strlen+0x10>
+		n++;
+  802240:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  802243:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802247:	75 f7                	jne    802240 <strlen+0xd>
+	return n;
+}
+  802249:	5d                   	pop    %ebp
+  80224a:	c3                   	ret
+
+0080224b <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80224b:	55                   	push   %ebp
+  80224c:	89 e5                	mov    %esp,%ebp
+  80224e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802251:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802254:	b8 00 00 00 00       	mov    $0x0,%eax
+  802259:	eb 03                	jmp    80225e <strnlen+0x13>
+		n++;
+  80225b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80225e:	39 d0                	cmp    %edx,%eax
+  802260:	74 08                	je     80226a <strnlen+0x1f>
+  802262:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802266:	75 f3                	jne    80225b <strnlen+0x10>
+  802268:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80226a:	89 d0                	mov    %edx,%eax
+  80226c:	5d                   	pop    %ebp
+  80226d:	c3                   	ret
+
+0080226e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80226e:	55                   	push   %ebp
+  80226f:	89 e5                	mov    %esp,%ebp
+  802271:	53                   	push   %ebx
+  802272:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802275:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  802278:	b8 00 00 00 00       	mov    $0x0,%eax
+  80227d:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  802281:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  802284:	83 c0 01             	add    $0x1,%eax
+  802287:	84 d2                	test   %dl,%dl
+  802289:	75 f2                	jne    80227d <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80228b:	89 c8                	mov    %ecx,%eax
+  80228d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802290:	c9                   	leave
+  802291:	c3                   	ret
+
+00802292 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  802292:	55                   	push   %ebp
+  802293:	89 e5                	mov    %esp,%ebp
+  802295:	53                   	push   %ebx
+  802296:	83 ec 10             	sub    $0x10,%esp
+  802299:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80229c:	53                   	push   %ebx
+  80229d:	e8 91 ff ff ff       	call   802233 <strlen>
+  8022a2:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8022a5:	ff 75 0c             	push   0xc(%ebp)
+  8022a8:	01 d8                	add    %ebx,%eax
+  8022aa:	50                   	push   %eax
+  8022ab:	e8 be ff ff ff       	call   80226e <strcpy>
+	return dst;
+}
+  8022b0:	89 d8                	mov    %ebx,%eax
+  8022b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022b5:	c9                   	leave
+  8022b6:	c3                   	ret
+
+008022b7 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8022b7:	55                   	push   %ebp
+  8022b8:	89 e5                	mov    %esp,%ebp
+  8022ba:	56                   	push   %esi
+  8022bb:	53                   	push   %ebx
+  8022bc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8022bf:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8022c2:	89 f3                	mov    %esi,%ebx
+  8022c4:	03 5d 10             	add    0x10(%ebp),%ebx
+  8022c7:	89 f0                	mov    %esi,%eax
+  8022c9:	eb 0f                	jmp    8022da <strncpy+0x23>
+		*dst++ = *src;
+  8022cb:	83 c0 01             	add    $0x1,%eax
+  8022ce:	0f b6 0a             	movzbl (%edx),%ecx
+  8022d1:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8022d4:	80 f9 01             	cmp    $0x1,%cl
+  8022d7:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8022da:	39 d8                	cmp    %ebx,%eax
+  8022dc:	75 ed                	jne    8022cb <strncpy+0x14>
+	}
+	return ret;
+}
+  8022de:	89 f0                	mov    %esi,%eax
+  8022e0:	5b                   	pop    %ebx
+  8022e1:	5e                   	pop    %esi
+  8022e2:	5d                   	pop    %ebp
+  8022e3:	c3                   	ret
+
+008022e4 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8022e4:	55                   	push   %ebp
+  8022e5:	89 e5                	mov    %esp,%ebp
+  8022e7:	56                   	push   %esi
+  8022e8:	53                   	push   %ebx
+  8022e9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8022ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022ef:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8022f2:	89 f0                	mov    %esi,%eax
+  8022f4:	85 d2                	test   %edx,%edx
+  8022f6:	74 21                	je     802319 <strlcpy+0x35>
+  8022f8:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8022fc:	89 f2                	mov    %esi,%edx
+  8022fe:	eb 09                	jmp    802309 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  802300:	83 c1 01             	add    $0x1,%ecx
+  802303:	83 c2 01             	add    $0x1,%edx
+  802306:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  802309:	39 c2                	cmp    %eax,%edx
+  80230b:	74 09                	je     802316 <strlcpy+0x32>
+  80230d:	0f b6 19             	movzbl (%ecx),%ebx
+  802310:	84 db                	test   %bl,%bl
+  802312:	75 ec                	jne    802300 <strlcpy+0x1c>
+  802314:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  802316:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  802319:	29 f0                	sub    %esi,%eax
+}
+  80231b:	5b                   	pop    %ebx
+  80231c:	5e                   	pop    %esi
+  80231d:	5d                   	pop    %ebp
+  80231e:	c3                   	ret
+
+0080231f <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80231f:	55                   	push   %ebp
+  802320:	89 e5                	mov    %esp,%ebp
+  802322:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802325:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  802328:	eb 06                	jmp    802330 <strcmp+0x11>
+		p++, q++;
+  80232a:	83 c1 01             	add    $0x1,%ecx
+  80232d:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  802330:	0f b6 01             	movzbl (%ecx),%eax
+  802333:	84 c0                	test   %al,%al
+  802335:	74 04                	je     80233b <strcmp+0x1c>
+  802337:	3a 02                	cmp    (%edx),%al
+  802339:	74 ef                	je     80232a <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80233b:	0f b6 c0             	movzbl %al,%eax
+  80233e:	0f b6 12             	movzbl (%edx),%edx
+  802341:	29 d0                	sub    %edx,%eax
+}
+  802343:	5d                   	pop    %ebp
+  802344:	c3                   	ret
+
+00802345 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  802345:	55                   	push   %ebp
+  802346:	89 e5                	mov    %esp,%ebp
+  802348:	53                   	push   %ebx
+  802349:	8b 45 08             	mov    0x8(%ebp),%eax
+  80234c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80234f:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  802352:	eb 09                	jmp    80235d <strncmp+0x18>
+		n--, p++, q++;
+  802354:	83 ea 01             	sub    $0x1,%edx
+  802357:	83 c0 01             	add    $0x1,%eax
+  80235a:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80235d:	85 d2                	test   %edx,%edx
+  80235f:	74 18                	je     802379 <strncmp+0x34>
+  802361:	0f b6 18             	movzbl (%eax),%ebx
+  802364:	84 db                	test   %bl,%bl
+  802366:	74 04                	je     80236c <strncmp+0x27>
+  802368:	3a 19                	cmp    (%ecx),%bl
+  80236a:	74 e8                	je     802354 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80236c:	0f b6 00             	movzbl (%eax),%eax
+  80236f:	0f b6 11             	movzbl (%ecx),%edx
+  802372:	29 d0                	sub    %edx,%eax
+}
+  802374:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802377:	c9                   	leave
+  802378:	c3                   	ret
+		return 0;
+  802379:	b8 00 00 00 00       	mov    $0x0,%eax
+  80237e:	eb f4                	jmp    802374 <strncmp+0x2f>
+
+00802380 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  802380:	55                   	push   %ebp
+  802381:	89 e5                	mov    %esp,%ebp
+  802383:	8b 45 08             	mov    0x8(%ebp),%eax
+  802386:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80238a:	eb 03                	jmp    80238f <strchr+0xf>
+  80238c:	83 c0 01             	add    $0x1,%eax
+  80238f:	0f b6 10             	movzbl (%eax),%edx
+  802392:	84 d2                	test   %dl,%dl
+  802394:	74 06                	je     80239c <strchr+0x1c>
+		if (*s == c)
+  802396:	38 ca                	cmp    %cl,%dl
+  802398:	75 f2                	jne    80238c <strchr+0xc>
+  80239a:	eb 05                	jmp    8023a1 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80239c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023a1:	5d                   	pop    %ebp
+  8023a2:	c3                   	ret
+
+008023a3 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8023a3:	55                   	push   %ebp
+  8023a4:	89 e5                	mov    %esp,%ebp
+  8023a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023a9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8023ad:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8023b0:	38 ca                	cmp    %cl,%dl
+  8023b2:	74 09                	je     8023bd <strfind+0x1a>
+  8023b4:	84 d2                	test   %dl,%dl
+  8023b6:	74 05                	je     8023bd <strfind+0x1a>
+	for (; *s; s++)
+  8023b8:	83 c0 01             	add    $0x1,%eax
+  8023bb:	eb f0                	jmp    8023ad <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8023bd:	5d                   	pop    %ebp
+  8023be:	c3                   	ret
+
+008023bf <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8023bf:	55                   	push   %ebp
+  8023c0:	89 e5                	mov    %esp,%ebp
+  8023c2:	57                   	push   %edi
+  8023c3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8023c6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8023c9:	85 c9                	test   %ecx,%ecx
+  8023cb:	74 20                	je     8023ed <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8023cd:	89 f8                	mov    %edi,%eax
+  8023cf:	09 c8                	or     %ecx,%eax
+  8023d1:	a8 03                	test   $0x3,%al
+  8023d3:	75 12                	jne    8023e7 <memset+0x28>
+		c &= 0xFF;
+  8023d5:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8023d9:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8023df:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8023e2:	fc                   	cld
+  8023e3:	f3 ab                	rep stos %eax,%es:(%edi)
+  8023e5:	eb 06                	jmp    8023ed <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8023e7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023ea:	fc                   	cld
+  8023eb:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8023ed:	89 f8                	mov    %edi,%eax
+  8023ef:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8023f2:	c9                   	leave
+  8023f3:	c3                   	ret
+
+008023f4 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8023f4:	55                   	push   %ebp
+  8023f5:	89 e5                	mov    %esp,%ebp
+  8023f7:	57                   	push   %edi
+  8023f8:	56                   	push   %esi
+  8023f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023fc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8023ff:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  802402:	39 c6                	cmp    %eax,%esi
+  802404:	73 32                	jae    802438 <memmove+0x44>
+  802406:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  802409:	39 d0                	cmp    %edx,%eax
+  80240b:	73 2b                	jae    802438 <memmove+0x44>
+		s += n;
+		d += n;
+  80240d:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802410:	89 d6                	mov    %edx,%esi
+  802412:	09 fe                	or     %edi,%esi
+  802414:	09 ce                	or     %ecx,%esi
+  802416:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80241c:	75 0e                	jne    80242c <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80241e:	83 ef 04             	sub    $0x4,%edi
+  802421:	8d 72 fc             	lea    -0x4(%edx),%esi
+  802424:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  802427:	fd                   	std
+  802428:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80242a:	eb 09                	jmp    802435 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80242c:	83 ef 01             	sub    $0x1,%edi
+  80242f:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  802432:	fd                   	std
+  802433:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  802435:	fc                   	cld
+  802436:	eb 1a                	jmp    802452 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802438:	89 f2                	mov    %esi,%edx
+  80243a:	09 c2                	or     %eax,%edx
+  80243c:	09 ca                	or     %ecx,%edx
+  80243e:	f6 c2 03             	test   $0x3,%dl
+  802441:	75 0a                	jne    80244d <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  802443:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  802446:	89 c7                	mov    %eax,%edi
+  802448:	fc                   	cld
+  802449:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80244b:	eb 05                	jmp    802452 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80244d:	89 c7                	mov    %eax,%edi
+  80244f:	fc                   	cld
+  802450:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  802452:	5e                   	pop    %esi
+  802453:	5f                   	pop    %edi
+  802454:	5d                   	pop    %ebp
+  802455:	c3                   	ret
+
+00802456 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  802456:	55                   	push   %ebp
+  802457:	89 e5                	mov    %esp,%ebp
+  802459:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80245c:	ff 75 10             	push   0x10(%ebp)
+  80245f:	ff 75 0c             	push   0xc(%ebp)
+  802462:	ff 75 08             	push   0x8(%ebp)
+  802465:	e8 8a ff ff ff       	call   8023f4 <memmove>
+}
+  80246a:	c9                   	leave
+  80246b:	c3                   	ret
+
+0080246c <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80246c:	55                   	push   %ebp
+  80246d:	89 e5                	mov    %esp,%ebp
+  80246f:	56                   	push   %esi
+  802470:	53                   	push   %ebx
+  802471:	8b 45 08             	mov    0x8(%ebp),%eax
+  802474:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  802477:	89 c6                	mov    %eax,%esi
+  802479:	03 75 10             	add    0x10(%ebp),%esi
+  80247c:	eb 06                	jmp    802484 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  80247e:	83 c0 01             	add    $0x1,%eax
+  802481:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  802484:	39 f0                	cmp    %esi,%eax
+  802486:	74 14                	je     80249c <memcmp+0x30>
+		if (*s1 != *s2)
+  802488:	0f b6 08             	movzbl (%eax),%ecx
+  80248b:	0f b6 1a             	movzbl (%edx),%ebx
+  80248e:	38 d9                	cmp    %bl,%cl
+  802490:	74 ec                	je     80247e <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  802492:	0f b6 c1             	movzbl %cl,%eax
+  802495:	0f b6 db             	movzbl %bl,%ebx
+  802498:	29 d8                	sub    %ebx,%eax
+  80249a:	eb 05                	jmp    8024a1 <memcmp+0x35>
+	}
+
+	return 0;
+  80249c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024a1:	5b                   	pop    %ebx
+  8024a2:	5e                   	pop    %esi
+  8024a3:	5d                   	pop    %ebp
+  8024a4:	c3                   	ret
+
+008024a5 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8024a5:	55                   	push   %ebp
+  8024a6:	89 e5                	mov    %esp,%ebp
+  8024a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8024ae:	89 c2                	mov    %eax,%edx
+  8024b0:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8024b3:	eb 03                	jmp    8024b8 <memfind+0x13>
+  8024b5:	83 c0 01             	add    $0x1,%eax
+  8024b8:	39 d0                	cmp    %edx,%eax
+  8024ba:	73 04                	jae    8024c0 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8024bc:	38 08                	cmp    %cl,(%eax)
+  8024be:	75 f5                	jne    8024b5 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8024c0:	5d                   	pop    %ebp
+  8024c1:	c3                   	ret
+
+008024c2 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8024c2:	55                   	push   %ebp
+  8024c3:	89 e5                	mov    %esp,%ebp
+  8024c5:	57                   	push   %edi
+  8024c6:	56                   	push   %esi
+  8024c7:	53                   	push   %ebx
+  8024c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024cb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8024ce:	eb 03                	jmp    8024d3 <strtol+0x11>
+		s++;
+  8024d0:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8024d3:	0f b6 02             	movzbl (%edx),%eax
+  8024d6:	3c 20                	cmp    $0x20,%al
+  8024d8:	74 f6                	je     8024d0 <strtol+0xe>
+  8024da:	3c 09                	cmp    $0x9,%al
+  8024dc:	74 f2                	je     8024d0 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8024de:	3c 2b                	cmp    $0x2b,%al
+  8024e0:	74 2a                	je     80250c <strtol+0x4a>
+	int neg = 0;
+  8024e2:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8024e7:	3c 2d                	cmp    $0x2d,%al
+  8024e9:	74 2b                	je     802516 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8024eb:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8024f1:	75 0f                	jne    802502 <strtol+0x40>
+  8024f3:	80 3a 30             	cmpb   $0x30,(%edx)
+  8024f6:	74 28                	je     802520 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8024f8:	85 db                	test   %ebx,%ebx
+  8024fa:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8024ff:	0f 44 d8             	cmove  %eax,%ebx
+  802502:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802507:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80250a:	eb 46                	jmp    802552 <strtol+0x90>
+		s++;
+  80250c:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  80250f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802514:	eb d5                	jmp    8024eb <strtol+0x29>
+		s++, neg = 1;
+  802516:	83 c2 01             	add    $0x1,%edx
+  802519:	bf 01 00 00 00       	mov    $0x1,%edi
+  80251e:	eb cb                	jmp    8024eb <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802520:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802524:	74 0e                	je     802534 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  802526:	85 db                	test   %ebx,%ebx
+  802528:	75 d8                	jne    802502 <strtol+0x40>
+		s++, base = 8;
+  80252a:	83 c2 01             	add    $0x1,%edx
+  80252d:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802532:	eb ce                	jmp    802502 <strtol+0x40>
+		s += 2, base = 16;
+  802534:	83 c2 02             	add    $0x2,%edx
+  802537:	bb 10 00 00 00       	mov    $0x10,%ebx
+  80253c:	eb c4                	jmp    802502 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  80253e:	0f be c0             	movsbl %al,%eax
+  802541:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  802544:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802547:	7d 3a                	jge    802583 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  802549:	83 c2 01             	add    $0x1,%edx
+  80254c:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802550:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  802552:	0f b6 02             	movzbl (%edx),%eax
+  802555:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802558:	89 f3                	mov    %esi,%ebx
+  80255a:	80 fb 09             	cmp    $0x9,%bl
+  80255d:	76 df                	jbe    80253e <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  80255f:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802562:	89 f3                	mov    %esi,%ebx
+  802564:	80 fb 19             	cmp    $0x19,%bl
+  802567:	77 08                	ja     802571 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  802569:	0f be c0             	movsbl %al,%eax
+  80256c:	83 e8 57             	sub    $0x57,%eax
+  80256f:	eb d3                	jmp    802544 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  802571:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802574:	89 f3                	mov    %esi,%ebx
+  802576:	80 fb 19             	cmp    $0x19,%bl
+  802579:	77 08                	ja     802583 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  80257b:	0f be c0             	movsbl %al,%eax
+  80257e:	83 e8 37             	sub    $0x37,%eax
+  802581:	eb c1                	jmp    802544 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  802583:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802587:	74 05                	je     80258e <strtol+0xcc>
+		*endptr = (char *) s;
+  802589:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80258c:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  80258e:	89 c8                	mov    %ecx,%eax
+  802590:	f7 d8                	neg    %eax
+  802592:	85 ff                	test   %edi,%edi
+  802594:	0f 45 c8             	cmovne %eax,%ecx
+}
+  802597:	89 c8                	mov    %ecx,%eax
+  802599:	5b                   	pop    %ebx
+  80259a:	5e                   	pop    %esi
+  80259b:	5f                   	pop    %edi
+  80259c:	5d                   	pop    %ebp
+  80259d:	c3                   	ret
+
+0080259e <atoi>:
+
+int
+atoi(const char *s)
+{
+  80259e:	55                   	push   %ebp
+  80259f:	89 e5                	mov    %esp,%ebp
+  8025a1:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  8025a4:	6a 0a                	push   $0xa
+  8025a6:	6a 00                	push   $0x0
+  8025a8:	ff 75 08             	push   0x8(%ebp)
+  8025ab:	e8 12 ff ff ff       	call   8024c2 <strtol>
+}
+  8025b0:	c9                   	leave
+  8025b1:	c3                   	ret
+
+008025b2 <dm>:
+  8025b2:	55                   	push   %ebp
+  8025b3:	57                   	push   %edi
+  8025b4:	56                   	push   %esi
+  8025b5:	53                   	push   %ebx
+  8025b6:	83 ec 24             	sub    $0x24,%esp
+  8025b9:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8025bd:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8025c1:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8025c5:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8025c9:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8025cd:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8025d1:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8025d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025df:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025e4:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8025eb:	00 
+  8025ec:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8025f3:	00 
+  8025f4:	89 fb                	mov    %edi,%ebx
+  8025f6:	eb 08                	jmp    802600 <dm+0x4e>
+  8025f8:	83 e9 01             	sub    $0x1,%ecx
+  8025fb:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8025fe:	74 68                	je     802668 <dm+0xb6>
+  802600:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802604:	01 c0                	add    %eax,%eax
+  802606:	89 c6                	mov    %eax,%esi
+  802608:	89 d7                	mov    %edx,%edi
+  80260a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80260e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802612:	0f ad d0             	shrd   %cl,%edx,%eax
+  802615:	d3 ea                	shr    %cl,%edx
+  802617:	f6 c1 20             	test   $0x20,%cl
+  80261a:	74 04                	je     802620 <dm+0x6e>
+  80261c:	89 d0                	mov    %edx,%eax
+  80261e:	31 d2                	xor    %edx,%edx
+  802620:	83 e0 01             	and    $0x1,%eax
+  802623:	89 04 24             	mov    %eax,(%esp)
+  802626:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80262d:	00 
+  80262e:	8b 04 24             	mov    (%esp),%eax
+  802631:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802635:	09 f0                	or     %esi,%eax
+  802637:	09 fa                	or     %edi,%edx
+  802639:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80263d:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802641:	39 f0                	cmp    %esi,%eax
+  802643:	89 d5                	mov    %edx,%ebp
+  802645:	19 fd                	sbb    %edi,%ebp
+  802647:	72 af                	jb     8025f8 <dm+0x46>
+  802649:	29 f0                	sub    %esi,%eax
+  80264b:	19 fa                	sbb    %edi,%edx
+  80264d:	89 cf                	mov    %ecx,%edi
+  80264f:	c1 ef 05             	shr    $0x5,%edi
+  802652:	83 e7 01             	and    $0x1,%edi
+  802655:	89 fe                	mov    %edi,%esi
+  802657:	83 f6 01             	xor    $0x1,%esi
+  80265a:	d3 e6                	shl    %cl,%esi
+  80265c:	d3 e7                	shl    %cl,%edi
+  80265e:	09 74 24 18          	or     %esi,0x18(%esp)
+  802662:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802666:	eb 90                	jmp    8025f8 <dm+0x46>
+  802668:	85 db                	test   %ebx,%ebx
+  80266a:	74 05                	je     802671 <dm+0xbf>
+  80266c:	89 03                	mov    %eax,(%ebx)
+  80266e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802671:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802675:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802679:	83 c4 24             	add    $0x24,%esp
+  80267c:	5b                   	pop    %ebx
+  80267d:	5e                   	pop    %esi
+  80267e:	5f                   	pop    %edi
+  80267f:	5d                   	pop    %ebp
+  802680:	c3                   	ret
+
+00802681 <__udivdi3>:
+  802681:	83 ec 08             	sub    $0x8,%esp
+  802684:	6a 00                	push   $0x0
+  802686:	ff 74 24 1c          	push   0x1c(%esp)
+  80268a:	ff 74 24 1c          	push   0x1c(%esp)
+  80268e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802692:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802696:	e8 17 ff ff ff       	call   8025b2 <dm>
+  80269b:	83 c4 14             	add    $0x14,%esp
+  80269e:	c3                   	ret
+
+0080269f <__umoddi3>:
+  80269f:	83 ec 18             	sub    $0x18,%esp
+  8026a2:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8026a6:	50                   	push   %eax
+  8026a7:	ff 74 24 2c          	push   0x2c(%esp)
+  8026ab:	ff 74 24 2c          	push   0x2c(%esp)
+  8026af:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8026b3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8026b7:	e8 f6 fe ff ff       	call   8025b2 <dm>
+  8026bc:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8026c0:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8026c4:	83 c4 24             	add    $0x24,%esp
+  8026c7:	c3                   	ret
+
+008026c8 <__divdi3>:
+  8026c8:	53                   	push   %ebx
+  8026c9:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8026cd:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026d1:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8026d5:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8026d9:	85 d2                	test   %edx,%edx
+  8026db:	78 15                	js     8026f2 <__divdi3+0x2a>
+  8026dd:	85 db                	test   %ebx,%ebx
+  8026df:	78 34                	js     802715 <__divdi3+0x4d>
+  8026e1:	83 ec 04             	sub    $0x4,%esp
+  8026e4:	6a 00                	push   $0x0
+  8026e6:	53                   	push   %ebx
+  8026e7:	51                   	push   %ecx
+  8026e8:	e8 c5 fe ff ff       	call   8025b2 <dm>
+  8026ed:	83 c4 10             	add    $0x10,%esp
+  8026f0:	eb 21                	jmp    802713 <__divdi3+0x4b>
+  8026f2:	f7 d8                	neg    %eax
+  8026f4:	83 d2 00             	adc    $0x0,%edx
+  8026f7:	f7 da                	neg    %edx
+  8026f9:	85 db                	test   %ebx,%ebx
+  8026fb:	78 30                	js     80272d <__divdi3+0x65>
+  8026fd:	83 ec 04             	sub    $0x4,%esp
+  802700:	6a 00                	push   $0x0
+  802702:	53                   	push   %ebx
+  802703:	51                   	push   %ecx
+  802704:	e8 a9 fe ff ff       	call   8025b2 <dm>
+  802709:	83 c4 10             	add    $0x10,%esp
+  80270c:	f7 d8                	neg    %eax
+  80270e:	83 d2 00             	adc    $0x0,%edx
+  802711:	f7 da                	neg    %edx
+  802713:	5b                   	pop    %ebx
+  802714:	c3                   	ret
+  802715:	83 ec 04             	sub    $0x4,%esp
+  802718:	6a 00                	push   $0x0
+  80271a:	f7 d9                	neg    %ecx
+  80271c:	83 d3 00             	adc    $0x0,%ebx
+  80271f:	f7 db                	neg    %ebx
+  802721:	53                   	push   %ebx
+  802722:	51                   	push   %ecx
+  802723:	e8 8a fe ff ff       	call   8025b2 <dm>
+  802728:	83 c4 10             	add    $0x10,%esp
+  80272b:	eb df                	jmp    80270c <__divdi3+0x44>
+  80272d:	83 ec 04             	sub    $0x4,%esp
+  802730:	6a 00                	push   $0x0
+  802732:	f7 d9                	neg    %ecx
+  802734:	83 d3 00             	adc    $0x0,%ebx
+  802737:	f7 db                	neg    %ebx
+  802739:	53                   	push   %ebx
+  80273a:	51                   	push   %ecx
+  80273b:	e8 72 fe ff ff       	call   8025b2 <dm>
+  802740:	83 c4 10             	add    $0x10,%esp
+  802743:	eb ce                	jmp    802713 <__divdi3+0x4b>
+
+00802745 <__moddi3>:
+  802745:	55                   	push   %ebp
+  802746:	57                   	push   %edi
+  802747:	56                   	push   %esi
+  802748:	53                   	push   %ebx
+  802749:	83 ec 18             	sub    $0x18,%esp
+  80274c:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802750:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802754:	89 f1                	mov    %esi,%ecx
+  802756:	f7 d9                	neg    %ecx
+  802758:	89 da                	mov    %ebx,%edx
+  80275a:	83 d2 00             	adc    $0x0,%edx
+  80275d:	f7 da                	neg    %edx
+  80275f:	0f 48 ce             	cmovs  %esi,%ecx
+  802762:	0f 48 d3             	cmovs  %ebx,%edx
+  802765:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802769:	50                   	push   %eax
+  80276a:	8b 74 24 38          	mov    0x38(%esp),%esi
+  80276e:	f7 de                	neg    %esi
+  802770:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802774:	83 d0 00             	adc    $0x0,%eax
+  802777:	f7 d8                	neg    %eax
+  802779:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  80277e:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802783:	50                   	push   %eax
+  802784:	56                   	push   %esi
+  802785:	89 c8                	mov    %ecx,%eax
+  802787:	e8 26 fe ff ff       	call   8025b2 <dm>
+  80278c:	83 c4 10             	add    $0x10,%esp
+  80278f:	85 db                	test   %ebx,%ebx
+  802791:	78 10                	js     8027a3 <__moddi3+0x5e>
+  802793:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802797:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80279b:	83 c4 14             	add    $0x14,%esp
+  80279e:	5b                   	pop    %ebx
+  80279f:	5e                   	pop    %esi
+  8027a0:	5f                   	pop    %edi
+  8027a1:	5d                   	pop    %ebp
+  8027a2:	c3                   	ret
+  8027a3:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8027a7:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8027ab:	f7 d8                	neg    %eax
+  8027ad:	83 d2 00             	adc    $0x0,%edx
+  8027b0:	f7 da                	neg    %edx
+  8027b2:	eb e7                	jmp    80279b <__moddi3+0x56>
@@ -0,0 +1,6170 @@
+
+obj/user/ipcqueue:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 20 01 00 00       	call   800151 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#define NSENDERS	6
+#define NMSGS		200
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 4c             	sub    $0x4c,%esp
+	envid_t kids[NSENDERS], who, parent = thisenv->env_id;
+  80003c:	a1 08 40 80 00       	mov    0x804008,%eax
+  800041:	8b 78 48             	mov    0x48(%eax),%edi
+	uint32_t got[NSENDERS];
+	const volatile struct Env *e;
+	int i, j, v;
+
+	for (i = 0; i < NSENDERS; i++) {
+  800044:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if ((kids[i] = fork()) < 0)
+  800049:	e8 c7 29 00 00       	call   802a15 <fork>
+  80004e:	89 de                	mov    %ebx,%esi
+  800050:	89 44 9d d0          	mov    %eax,-0x30(%ebp,%ebx,4)
+  800054:	85 c0                	test   %eax,%eax
+  800056:	78 1c                	js     800074 <umain+0x41>
+			panic("fork: %e", kids[i]);
+		if (kids[i] == 0) {
+  800058:	74 44                	je     80009e <umain+0x6b>
+			for (j = 0; j < NMSGS; j++)
+				ipc_send(parent, i, 0, 0);
+			return;
+		}
+		got[i] = 0;
+  80005a:	c7 44 9d b4 00 00 00 	movl   $0x0,-0x4c(%ebp,%ebx,4)
+  800061:	00 
+	for (i = 0; i < NSENDERS; i++) {
+  800062:	83 c3 01             	add    $0x1,%ebx
+  800065:	83 fb 06             	cmp    $0x6,%ebx
+  800068:	75 df                	jne    800049 <umain+0x16>
+	}
+
+	for (j = 0; j < NSENDERS * NMSGS; j++) {
+  80006a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		v = ipc_recv(&who, 0, 0);
+  80006f:	8d 75 cc             	lea    -0x34(%ebp),%esi
+  800072:	eb 74                	jmp    8000e8 <umain+0xb5>
+			panic("fork: %e", kids[i]);
+  800074:	50                   	push   %eax
+  800075:	68 a0 2f 80 00       	push   $0x802fa0
+  80007a:	6a 16                	push   $0x16
+  80007c:	68 a9 2f 80 00       	push   $0x802fa9
+  800081:	e8 26 01 00 00       	call   8001ac <_panic>
+				ipc_send(parent, i, 0, 0);
+  800086:	6a 00                	push   $0x0
+  800088:	6a 00                	push   $0x0
+  80008a:	56                   	push   %esi
+  80008b:	57                   	push   %edi
+  80008c:	e8 45 2a 00 00       	call   802ad6 <ipc_send>
+  800091:	83 c4 10             	add    $0x10,%esp
+			for (j = 0; j < NMSGS; j++)
+  800094:	83 eb 01             	sub    $0x1,%ebx
+  800097:	75 ed                	jne    800086 <umain+0x53>
+  800099:	e9 ab 00 00 00       	jmp    800149 <umain+0x116>
+  80009e:	bb c9 00 00 00       	mov    $0xc9,%ebx
+  8000a3:	eb ef                	jmp    800094 <umain+0x61>
+		if (v < 0 || v >= NSENDERS || kids[v] != who)
+			panic("bad message %d from %08x", v, who);
+  8000a5:	83 ec 0c             	sub    $0xc,%esp
+  8000a8:	ff 75 cc             	push   -0x34(%ebp)
+  8000ab:	50                   	push   %eax
+  8000ac:	68 b9 2f 80 00       	push   $0x802fb9
+  8000b1:	6a 22                	push   $0x22
+  8000b3:	68 a9 2f 80 00       	push   $0x802fa9
+  8000b8:	e8 ef 00 00 00       	call   8001ac <_panic>
+		got[v]++;
+		// Halfway through, everyone should have had a fair share.
+		if (j == NSENDERS * NMSGS / 2)
+			for (i = 0; i < NSENDERS; i++)
+				cprintf("halfway: sender %08x %d messages\n",
+  8000bd:	83 ec 04             	sub    $0x4,%esp
+  8000c0:	ff 74 bd b4          	push   -0x4c(%ebp,%edi,4)
+  8000c4:	ff 74 bd d0          	push   -0x30(%ebp,%edi,4)
+  8000c8:	68 d4 2f 80 00       	push   $0x802fd4
+  8000cd:	e8 ee 01 00 00       	call   8002c0 <cprintf>
+			for (i = 0; i < NSENDERS; i++)
+  8000d2:	83 c7 01             	add    $0x1,%edi
+  8000d5:	83 c4 10             	add    $0x10,%esp
+  8000d8:	83 ff 06             	cmp    $0x6,%edi
+  8000db:	75 e0                	jne    8000bd <umain+0x8a>
+	for (j = 0; j < NSENDERS * NMSGS; j++) {
+  8000dd:	83 c3 01             	add    $0x1,%ebx
+  8000e0:	81 fb b0 04 00 00    	cmp    $0x4b0,%ebx
+  8000e6:	74 32                	je     80011a <umain+0xe7>
+		v = ipc_recv(&who, 0, 0);
+  8000e8:	83 ec 04             	sub    $0x4,%esp
+  8000eb:	6a 00                	push   $0x0
+  8000ed:	6a 00                	push   $0x0
+  8000ef:	56                   	push   %esi
+  8000f0:	e8 6f 29 00 00       	call   802a64 <ipc_recv>
+		if (v < 0 || v >= NSENDERS || kids[v] != who)
+  8000f5:	83 c4 10             	add    $0x10,%esp
+  8000f8:	83 f8 05             	cmp    $0x5,%eax
+  8000fb:	77 a8                	ja     8000a5 <umain+0x72>
+  8000fd:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  800100:	39 54 85 d0          	cmp    %edx,-0x30(%ebp,%eax,4)
+  800104:	75 9f                	jne    8000a5 <umain+0x72>
+		got[v]++;
+  800106:	83 44 85 b4 01       	addl   $0x1,-0x4c(%ebp,%eax,4)
+		if (j == NSENDERS * NMSGS / 2)
+  80010b:	81 fb 58 02 00 00    	cmp    $0x258,%ebx
+  800111:	75 ca                	jne    8000dd <umain+0xaa>
+			for (i = 0; i < NSENDERS; i++)
+  800113:	bf 00 00 00 00       	mov    $0x0,%edi
+  800118:	eb a3                	jmp    8000bd <umain+0x8a>
+					kids[i], got[i]);
+	}
+
+	e = thisenv;
+  80011a:	a1 08 40 80 00       	mov    0x804008,%eax
+	cprintf("received %d messages; queue now %d, %d senders queued, "
+		"%d refused\n", NSENDERS * NMSGS, e->env_ipc_qlen,
+		e->env_ipc_queued, e->env_ipc_drops);
+  80011f:	8b 88 dc 00 00 00    	mov    0xdc(%eax),%ecx
+  800125:	8b 90 d8 00 00 00    	mov    0xd8(%eax),%edx
+		"%d refused\n", NSENDERS * NMSGS, e->env_ipc_qlen,
+  80012b:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+	cprintf("received %d messages; queue now %d, %d senders queued, "
+  800131:	83 ec 0c             	sub    $0xc,%esp
+  800134:	51                   	push   %ecx
+  800135:	52                   	push   %edx
+  800136:	50                   	push   %eax
+  800137:	68 b0 04 00 00       	push   $0x4b0
+  80013c:	68 f8 2f 80 00       	push   $0x802ff8
+  800141:	e8 7a 01 00 00       	call   8002c0 <cprintf>
+  800146:	83 c4 20             	add    $0x20,%esp
+}
+  800149:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80014c:	5b                   	pop    %ebx
+  80014d:	5e                   	pop    %esi
+  80014e:	5f                   	pop    %edi
+  80014f:	5d                   	pop    %ebp
+  800150:	c3                   	ret
+
+00800151 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800151:	55                   	push   %ebp
+  800152:	89 e5                	mov    %esp,%ebp
+  800154:	56                   	push   %esi
+  800155:	53                   	push   %ebx
+  800156:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800159:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  80015c:	e8 e3 0e 00 00       	call   801044 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  800161:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800166:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  80016c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800171:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800176:	85 db                	test   %ebx,%ebx
+  800178:	7e 07                	jle    800181 <libmain+0x30>
+		binaryname = argv[0];
+  80017a:	8b 06                	mov    (%esi),%eax
+  80017c:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800181:	83 ec 08             	sub    $0x8,%esp
+  800184:	56                   	push   %esi
+  800185:	53                   	push   %ebx
+  800186:	e8 a8 fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80018b:	e8 0a 00 00 00       	call   80019a <exit>
+}
+  800190:	83 c4 10             	add    $0x10,%esp
+  800193:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800196:	5b                   	pop    %ebx
+  800197:	5e                   	pop    %esi
+  800198:	5d                   	pop    %ebp
+  800199:	c3                   	ret
+
+0080019a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80019a:	55                   	push   %ebp
+  80019b:	89 e5                	mov    %esp,%ebp
+  80019d:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  8001a0:	6a 00                	push   $0x0
+  8001a2:	e8 db 0d 00 00       	call   800f82 <sys_env_destroy>
+}
+  8001a7:	83 c4 10             	add    $0x10,%esp
+  8001aa:	c9                   	leave
+  8001ab:	c3                   	ret
+
+008001ac <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001ac:	55                   	push   %ebp
+  8001ad:	89 e5                	mov    %esp,%ebp
+  8001af:	57                   	push   %edi
+  8001b0:	56                   	push   %esi
+  8001b1:	53                   	push   %ebx
+  8001b2:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  8001b8:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  8001bb:	8b 1d 00 40 80 00    	mov    0x804000,%ebx
+  8001c1:	e8 7e 0e 00 00       	call   801044 <sys_getenvid>
+  8001c6:	83 ec 04             	sub    $0x4,%esp
+  8001c9:	ff 75 0c             	push   0xc(%ebp)
+  8001cc:	ff 75 08             	push   0x8(%ebp)
+  8001cf:	53                   	push   %ebx
+  8001d0:	50                   	push   %eax
+  8001d1:	68 48 30 80 00       	push   $0x803048
+  8001d6:	68 00 01 00 00       	push   $0x100
+  8001db:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  8001e1:	56                   	push   %esi
+  8001e2:	e8 72 06 00 00       	call   800859 <snprintf>
+  8001e7:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  8001e9:	83 c4 20             	add    $0x20,%esp
+  8001ec:	57                   	push   %edi
+  8001ed:	ff 75 10             	push   0x10(%ebp)
+  8001f0:	bf 00 01 00 00       	mov    $0x100,%edi
+  8001f5:	89 f8                	mov    %edi,%eax
+  8001f7:	29 d8                	sub    %ebx,%eax
+  8001f9:	50                   	push   %eax
+  8001fa:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8001fd:	50                   	push   %eax
+  8001fe:	e8 08 06 00 00       	call   80080b <vsnprintf>
+  800203:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  800205:	83 c4 0c             	add    $0xc,%esp
+  800208:	68 6b 30 80 00       	push   $0x80306b
+  80020d:	29 df                	sub    %ebx,%edi
+  80020f:	57                   	push   %edi
+  800210:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  800213:	50                   	push   %eax
+  800214:	e8 40 06 00 00       	call   800859 <snprintf>
+	sys_cputs(buf, r);
+  800219:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  80021c:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  80021e:	53                   	push   %ebx
+  80021f:	56                   	push   %esi
+  800220:	e8 21 0c 00 00       	call   800e46 <sys_cputs>
+  800225:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800228:	cc                   	int3
+	while (1)
+  800229:	eb fd                	jmp    800228 <_panic+0x7c>
+
+0080022b <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80022b:	55                   	push   %ebp
+  80022c:	89 e5                	mov    %esp,%ebp
+  80022e:	53                   	push   %ebx
+  80022f:	83 ec 04             	sub    $0x4,%esp
+  800232:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800235:	8b 13                	mov    (%ebx),%edx
+  800237:	8d 42 01             	lea    0x1(%edx),%eax
+  80023a:	89 03                	mov    %eax,(%ebx)
+  80023c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80023f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800243:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800248:	74 09                	je     800253 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80024a:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80024e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800251:	c9                   	leave
+  800252:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800253:	83 ec 08             	sub    $0x8,%esp
+  800256:	68 ff 00 00 00       	push   $0xff
+  80025b:	8d 43 08             	lea    0x8(%ebx),%eax
+  80025e:	50                   	push   %eax
+  80025f:	e8 e2 0b 00 00       	call   800e46 <sys_cputs>
+		b->idx = 0;
+  800264:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80026a:	83 c4 10             	add    $0x10,%esp
+  80026d:	eb db                	jmp    80024a <putch+0x1f>
+
+0080026f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80026f:	55                   	push   %ebp
+  800270:	89 e5                	mov    %esp,%ebp
+  800272:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800278:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80027f:	00 00 00 
+	b.cnt = 0;
+  800282:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800289:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80028c:	ff 75 0c             	push   0xc(%ebp)
+  80028f:	ff 75 08             	push   0x8(%ebp)
+  800292:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800298:	50                   	push   %eax
+  800299:	68 2b 02 80 00       	push   $0x80022b
+  80029e:	e8 14 01 00 00       	call   8003b7 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002a3:	83 c4 08             	add    $0x8,%esp
+  8002a6:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002ac:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002b2:	50                   	push   %eax
+  8002b3:	e8 8e 0b 00 00       	call   800e46 <sys_cputs>
+
+	return b.cnt;
+}
+  8002b8:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002be:	c9                   	leave
+  8002bf:	c3                   	ret
+
+008002c0 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002c0:	55                   	push   %ebp
+  8002c1:	89 e5                	mov    %esp,%ebp
+  8002c3:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002c6:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002c9:	50                   	push   %eax
+  8002ca:	ff 75 08             	push   0x8(%ebp)
+  8002cd:	e8 9d ff ff ff       	call   80026f <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002d2:	c9                   	leave
+  8002d3:	c3                   	ret
+
+008002d4 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8002d4:	55                   	push   %ebp
+  8002d5:	89 e5                	mov    %esp,%ebp
+  8002d7:	57                   	push   %edi
+  8002d8:	56                   	push   %esi
+  8002d9:	53                   	push   %ebx
+  8002da:	83 ec 1c             	sub    $0x1c,%esp
+  8002dd:	89 c7                	mov    %eax,%edi
+  8002df:	89 d6                	mov    %edx,%esi
+  8002e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002e4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002e7:	89 d1                	mov    %edx,%ecx
+  8002e9:	89 c2                	mov    %eax,%edx
+  8002eb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002ee:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002f1:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002f4:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002f7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002fa:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800301:	39 c2                	cmp    %eax,%edx
+  800303:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800306:	72 3e                	jb     800346 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800308:	83 ec 0c             	sub    $0xc,%esp
+  80030b:	ff 75 18             	push   0x18(%ebp)
+  80030e:	83 eb 01             	sub    $0x1,%ebx
+  800311:	53                   	push   %ebx
+  800312:	50                   	push   %eax
+  800313:	83 ec 08             	sub    $0x8,%esp
+  800316:	ff 75 e4             	push   -0x1c(%ebp)
+  800319:	ff 75 e0             	push   -0x20(%ebp)
+  80031c:	ff 75 dc             	push   -0x24(%ebp)
+  80031f:	ff 75 d8             	push   -0x28(%ebp)
+  800322:	e8 2f 2b 00 00       	call   802e56 <__udivdi3>
+  800327:	83 c4 18             	add    $0x18,%esp
+  80032a:	52                   	push   %edx
+  80032b:	50                   	push   %eax
+  80032c:	89 f2                	mov    %esi,%edx
+  80032e:	89 f8                	mov    %edi,%eax
+  800330:	e8 9f ff ff ff       	call   8002d4 <printnum>
+  800335:	83 c4 20             	add    $0x20,%esp
+  800338:	eb 13                	jmp    80034d <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80033a:	83 ec 08             	sub    $0x8,%esp
+  80033d:	56                   	push   %esi
+  80033e:	ff 75 18             	push   0x18(%ebp)
+  800341:	ff d7                	call   *%edi
+  800343:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800346:	83 eb 01             	sub    $0x1,%ebx
+  800349:	85 db                	test   %ebx,%ebx
+  80034b:	7f ed                	jg     80033a <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80034d:	83 ec 08             	sub    $0x8,%esp
+  800350:	56                   	push   %esi
+  800351:	83 ec 04             	sub    $0x4,%esp
+  800354:	ff 75 e4             	push   -0x1c(%ebp)
+  800357:	ff 75 e0             	push   -0x20(%ebp)
+  80035a:	ff 75 dc             	push   -0x24(%ebp)
+  80035d:	ff 75 d8             	push   -0x28(%ebp)
+  800360:	e8 0f 2b 00 00       	call   802e74 <__umoddi3>
+  800365:	83 c4 14             	add    $0x14,%esp
+  800368:	0f be 80 6d 30 80 00 	movsbl 0x80306d(%eax),%eax
+  80036f:	50                   	push   %eax
+  800370:	ff d7                	call   *%edi
+}
+  800372:	83 c4 10             	add    $0x10,%esp
+  800375:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800378:	5b                   	pop    %ebx
+  800379:	5e                   	pop    %esi
+  80037a:	5f                   	pop    %edi
+  80037b:	5d                   	pop    %ebp
+  80037c:	c3                   	ret
+
+0080037d <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80037d:	55                   	push   %ebp
+  80037e:	89 e5                	mov    %esp,%ebp
+  800380:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800383:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800387:	8b 10                	mov    (%eax),%edx
+  800389:	3b 50 04             	cmp    0x4(%eax),%edx
+  80038c:	73 0a                	jae    800398 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80038e:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800391:	89 08                	mov    %ecx,(%eax)
+  800393:	8b 45 08             	mov    0x8(%ebp),%eax
+  800396:	88 02                	mov    %al,(%edx)
+}
+  800398:	5d                   	pop    %ebp
+  800399:	c3                   	ret
+
+0080039a <printfmt>:
+{
+  80039a:	55                   	push   %ebp
+  80039b:	89 e5                	mov    %esp,%ebp
+  80039d:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003a0:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003a3:	50                   	push   %eax
+  8003a4:	ff 75 10             	push   0x10(%ebp)
+  8003a7:	ff 75 0c             	push   0xc(%ebp)
+  8003aa:	ff 75 08             	push   0x8(%ebp)
+  8003ad:	e8 05 00 00 00       	call   8003b7 <vprintfmt>
+}
+  8003b2:	83 c4 10             	add    $0x10,%esp
+  8003b5:	c9                   	leave
+  8003b6:	c3                   	ret
+
+008003b7 <vprintfmt>:
+{
+  8003b7:	55                   	push   %ebp
+  8003b8:	89 e5                	mov    %esp,%ebp
+  8003ba:	57                   	push   %edi
+  8003bb:	56                   	push   %esi
+  8003bc:	53                   	push   %ebx
+  8003bd:	83 ec 2c             	sub    $0x2c,%esp
+  8003c0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8003c3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8003c6:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003c9:	eb 0a                	jmp    8003d5 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8003cb:	83 ec 08             	sub    $0x8,%esp
+  8003ce:	53                   	push   %ebx
+  8003cf:	50                   	push   %eax
+  8003d0:	ff d6                	call   *%esi
+  8003d2:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003d5:	83 c7 01             	add    $0x1,%edi
+  8003d8:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8003dc:	83 f8 25             	cmp    $0x25,%eax
+  8003df:	74 0c                	je     8003ed <vprintfmt+0x36>
+			if (ch == '\0')
+  8003e1:	85 c0                	test   %eax,%eax
+  8003e3:	75 e6                	jne    8003cb <vprintfmt+0x14>
+}
+  8003e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003e8:	5b                   	pop    %ebx
+  8003e9:	5e                   	pop    %esi
+  8003ea:	5f                   	pop    %edi
+  8003eb:	5d                   	pop    %ebp
+  8003ec:	c3                   	ret
+		padc = ' ';
+  8003ed:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8003f1:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003f8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8003ff:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800406:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80040b:	8d 47 01             	lea    0x1(%edi),%eax
+  80040e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800411:	0f b6 17             	movzbl (%edi),%edx
+  800414:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800417:	3c 55                	cmp    $0x55,%al
+  800419:	0f 87 cf 03 00 00    	ja     8007ee <vprintfmt+0x437>
+  80041f:	0f b6 c0             	movzbl %al,%eax
+  800422:	ff 24 85 60 31 80 00 	jmp    *0x803160(,%eax,4)
+  800429:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80042c:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800430:	eb d9                	jmp    80040b <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800432:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800435:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800439:	eb d0                	jmp    80040b <vprintfmt+0x54>
+  80043b:	0f b6 d2             	movzbl %dl,%edx
+  80043e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800441:	b8 00 00 00 00       	mov    $0x0,%eax
+  800446:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800449:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80044c:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800450:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800453:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800456:	83 f9 09             	cmp    $0x9,%ecx
+  800459:	77 55                	ja     8004b0 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80045b:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80045e:	eb e9                	jmp    800449 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800460:	8b 45 14             	mov    0x14(%ebp),%eax
+  800463:	8b 00                	mov    (%eax),%eax
+  800465:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800468:	8b 45 14             	mov    0x14(%ebp),%eax
+  80046b:	8d 40 04             	lea    0x4(%eax),%eax
+  80046e:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800471:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800474:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800478:	79 91                	jns    80040b <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80047a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80047d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800480:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800487:	eb 82                	jmp    80040b <vprintfmt+0x54>
+			if (width < 0)
+  800489:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80048c:	85 d2                	test   %edx,%edx
+  80048e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800493:	0f 49 c2             	cmovns %edx,%eax
+  800496:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800499:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80049c:	e9 6a ff ff ff       	jmp    80040b <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004a1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8004a4:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004ab:	e9 5b ff ff ff       	jmp    80040b <vprintfmt+0x54>
+  8004b0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004b3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004b6:	eb bc                	jmp    800474 <vprintfmt+0xbd>
+			lflag++;
+  8004b8:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004bb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004be:	e9 48 ff ff ff       	jmp    80040b <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8004c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c6:	8d 78 04             	lea    0x4(%eax),%edi
+  8004c9:	83 ec 08             	sub    $0x8,%esp
+  8004cc:	53                   	push   %ebx
+  8004cd:	ff 30                	push   (%eax)
+  8004cf:	ff d6                	call   *%esi
+			break;
+  8004d1:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8004d4:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8004d7:	e9 b1 02 00 00       	jmp    80078d <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8004dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004df:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8004e2:	8b 10                	mov    (%eax),%edx
+  8004e4:	89 d0                	mov    %edx,%eax
+  8004e6:	f7 d8                	neg    %eax
+  8004e8:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004eb:	83 f8 0d             	cmp    $0xd,%eax
+  8004ee:	7f 23                	jg     800513 <vprintfmt+0x15c>
+  8004f0:	8b 14 85 c0 32 80 00 	mov    0x8032c0(,%eax,4),%edx
+  8004f7:	85 d2                	test   %edx,%edx
+  8004f9:	74 18                	je     800513 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8004fb:	52                   	push   %edx
+  8004fc:	68 8e 30 80 00       	push   $0x80308e
+  800501:	53                   	push   %ebx
+  800502:	56                   	push   %esi
+  800503:	e8 92 fe ff ff       	call   80039a <printfmt>
+  800508:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80050b:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80050e:	e9 7a 02 00 00       	jmp    80078d <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800513:	50                   	push   %eax
+  800514:	68 85 30 80 00       	push   $0x803085
+  800519:	53                   	push   %ebx
+  80051a:	56                   	push   %esi
+  80051b:	e8 7a fe ff ff       	call   80039a <printfmt>
+  800520:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800523:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800526:	e9 62 02 00 00       	jmp    80078d <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80052b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052e:	83 c0 04             	add    $0x4,%eax
+  800531:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800534:	8b 45 14             	mov    0x14(%ebp),%eax
+  800537:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800539:	85 c9                	test   %ecx,%ecx
+  80053b:	b8 7e 30 80 00       	mov    $0x80307e,%eax
+  800540:	0f 45 c1             	cmovne %ecx,%eax
+  800543:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800546:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80054a:	7e 06                	jle    800552 <vprintfmt+0x19b>
+  80054c:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800550:	75 0b                	jne    80055d <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800552:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800555:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800558:	89 75 08             	mov    %esi,0x8(%ebp)
+  80055b:	eb 5c                	jmp    8005b9 <vprintfmt+0x202>
+  80055d:	83 ec 08             	sub    $0x8,%esp
+  800560:	ff 75 d0             	push   -0x30(%ebp)
+  800563:	ff 75 cc             	push   -0x34(%ebp)
+  800566:	e8 20 03 00 00       	call   80088b <strnlen>
+  80056b:	89 c2                	mov    %eax,%edx
+  80056d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800570:	29 d0                	sub    %edx,%eax
+  800572:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800575:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800579:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80057c:	89 75 08             	mov    %esi,0x8(%ebp)
+  80057f:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800581:	eb 0e                	jmp    800591 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800583:	83 ec 08             	sub    $0x8,%esp
+  800586:	53                   	push   %ebx
+  800587:	57                   	push   %edi
+  800588:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80058b:	83 ee 01             	sub    $0x1,%esi
+  80058e:	83 c4 10             	add    $0x10,%esp
+  800591:	85 f6                	test   %esi,%esi
+  800593:	7f ee                	jg     800583 <vprintfmt+0x1cc>
+  800595:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800598:	8b 75 08             	mov    0x8(%ebp),%esi
+  80059b:	85 c0                	test   %eax,%eax
+  80059d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005a2:	0f 49 d0             	cmovns %eax,%edx
+  8005a5:	29 d0                	sub    %edx,%eax
+  8005a7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005aa:	eb a6                	jmp    800552 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8005ac:	83 ec 08             	sub    $0x8,%esp
+  8005af:	53                   	push   %ebx
+  8005b0:	52                   	push   %edx
+  8005b1:	ff 55 08             	call   *0x8(%ebp)
+  8005b4:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005b7:	89 f1                	mov    %esi,%ecx
+  8005b9:	8d 71 01             	lea    0x1(%ecx),%esi
+  8005bc:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005c0:	0f be d0             	movsbl %al,%edx
+  8005c3:	85 d2                	test   %edx,%edx
+  8005c5:	74 28                	je     8005ef <vprintfmt+0x238>
+  8005c7:	85 ff                	test   %edi,%edi
+  8005c9:	78 05                	js     8005d0 <vprintfmt+0x219>
+  8005cb:	83 ef 01             	sub    $0x1,%edi
+  8005ce:	78 30                	js     800600 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005d0:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005d4:	74 d6                	je     8005ac <vprintfmt+0x1f5>
+  8005d6:	0f be c0             	movsbl %al,%eax
+  8005d9:	83 e8 20             	sub    $0x20,%eax
+  8005dc:	83 f8 5e             	cmp    $0x5e,%eax
+  8005df:	76 cb                	jbe    8005ac <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8005e1:	83 ec 08             	sub    $0x8,%esp
+  8005e4:	53                   	push   %ebx
+  8005e5:	6a 3f                	push   $0x3f
+  8005e7:	ff 55 08             	call   *0x8(%ebp)
+  8005ea:	83 c4 10             	add    $0x10,%esp
+  8005ed:	eb c8                	jmp    8005b7 <vprintfmt+0x200>
+  8005ef:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005f2:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005f5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005f8:	01 d0                	add    %edx,%eax
+  8005fa:	29 c8                	sub    %ecx,%eax
+  8005fc:	89 c7                	mov    %eax,%edi
+  8005fe:	eb 13                	jmp    800613 <vprintfmt+0x25c>
+  800600:	8b 75 08             	mov    0x8(%ebp),%esi
+  800603:	eb ed                	jmp    8005f2 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800605:	83 ec 08             	sub    $0x8,%esp
+  800608:	53                   	push   %ebx
+  800609:	6a 20                	push   $0x20
+  80060b:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80060d:	83 ef 01             	sub    $0x1,%edi
+  800610:	83 c4 10             	add    $0x10,%esp
+  800613:	85 ff                	test   %edi,%edi
+  800615:	7f ee                	jg     800605 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800617:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80061a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80061d:	e9 6b 01 00 00       	jmp    80078d <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800622:	83 f9 01             	cmp    $0x1,%ecx
+  800625:	7f 1f                	jg     800646 <vprintfmt+0x28f>
+	else if (lflag)
+  800627:	85 c9                	test   %ecx,%ecx
+  800629:	74 67                	je     800692 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80062b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062e:	8b 00                	mov    (%eax),%eax
+  800630:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800633:	89 c1                	mov    %eax,%ecx
+  800635:	c1 f9 1f             	sar    $0x1f,%ecx
+  800638:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80063b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063e:	8d 40 04             	lea    0x4(%eax),%eax
+  800641:	89 45 14             	mov    %eax,0x14(%ebp)
+  800644:	eb 17                	jmp    80065d <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800646:	8b 45 14             	mov    0x14(%ebp),%eax
+  800649:	8b 50 04             	mov    0x4(%eax),%edx
+  80064c:	8b 00                	mov    (%eax),%eax
+  80064e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800651:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800654:	8b 45 14             	mov    0x14(%ebp),%eax
+  800657:	8d 40 08             	lea    0x8(%eax),%eax
+  80065a:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80065d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800660:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800663:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800668:	85 c9                	test   %ecx,%ecx
+  80066a:	0f 89 03 01 00 00    	jns    800773 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800670:	83 ec 08             	sub    $0x8,%esp
+  800673:	53                   	push   %ebx
+  800674:	6a 2d                	push   $0x2d
+  800676:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800678:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80067b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80067e:	f7 da                	neg    %edx
+  800680:	83 d1 00             	adc    $0x0,%ecx
+  800683:	f7 d9                	neg    %ecx
+  800685:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800688:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80068d:	e9 e1 00 00 00       	jmp    800773 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800692:	8b 45 14             	mov    0x14(%ebp),%eax
+  800695:	8b 00                	mov    (%eax),%eax
+  800697:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80069a:	89 c1                	mov    %eax,%ecx
+  80069c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80069f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a5:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006ab:	eb b0                	jmp    80065d <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8006ad:	83 f9 01             	cmp    $0x1,%ecx
+  8006b0:	7f 1e                	jg     8006d0 <vprintfmt+0x319>
+	else if (lflag)
+  8006b2:	85 c9                	test   %ecx,%ecx
+  8006b4:	74 32                	je     8006e8 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8006b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b9:	8b 10                	mov    (%eax),%edx
+  8006bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006c0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006c6:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8006cb:	e9 a3 00 00 00       	jmp    800773 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d3:	8b 10                	mov    (%eax),%edx
+  8006d5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006d8:	8d 40 08             	lea    0x8(%eax),%eax
+  8006db:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006de:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8006e3:	e9 8b 00 00 00       	jmp    800773 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006eb:	8b 10                	mov    (%eax),%edx
+  8006ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006f2:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006f8:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8006fd:	eb 74                	jmp    800773 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8006ff:	83 f9 01             	cmp    $0x1,%ecx
+  800702:	7f 1b                	jg     80071f <vprintfmt+0x368>
+	else if (lflag)
+  800704:	85 c9                	test   %ecx,%ecx
+  800706:	74 2c                	je     800734 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800708:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070b:	8b 10                	mov    (%eax),%edx
+  80070d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800712:	8d 40 04             	lea    0x4(%eax),%eax
+  800715:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800718:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80071d:	eb 54                	jmp    800773 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80071f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800722:	8b 10                	mov    (%eax),%edx
+  800724:	8b 48 04             	mov    0x4(%eax),%ecx
+  800727:	8d 40 08             	lea    0x8(%eax),%eax
+  80072a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80072d:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800732:	eb 3f                	jmp    800773 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800734:	8b 45 14             	mov    0x14(%ebp),%eax
+  800737:	8b 10                	mov    (%eax),%edx
+  800739:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80073e:	8d 40 04             	lea    0x4(%eax),%eax
+  800741:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800744:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800749:	eb 28                	jmp    800773 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  80074b:	83 ec 08             	sub    $0x8,%esp
+  80074e:	53                   	push   %ebx
+  80074f:	6a 30                	push   $0x30
+  800751:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800753:	83 c4 08             	add    $0x8,%esp
+  800756:	53                   	push   %ebx
+  800757:	6a 78                	push   $0x78
+  800759:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80075b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075e:	8b 10                	mov    (%eax),%edx
+  800760:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800765:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800768:	8d 40 04             	lea    0x4(%eax),%eax
+  80076b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80076e:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800773:	83 ec 0c             	sub    $0xc,%esp
+  800776:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80077a:	50                   	push   %eax
+  80077b:	ff 75 e0             	push   -0x20(%ebp)
+  80077e:	57                   	push   %edi
+  80077f:	51                   	push   %ecx
+  800780:	52                   	push   %edx
+  800781:	89 da                	mov    %ebx,%edx
+  800783:	89 f0                	mov    %esi,%eax
+  800785:	e8 4a fb ff ff       	call   8002d4 <printnum>
+			break;
+  80078a:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80078d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800790:	e9 40 fc ff ff       	jmp    8003d5 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800795:	83 f9 01             	cmp    $0x1,%ecx
+  800798:	7f 1b                	jg     8007b5 <vprintfmt+0x3fe>
+	else if (lflag)
+  80079a:	85 c9                	test   %ecx,%ecx
+  80079c:	74 2c                	je     8007ca <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  80079e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a1:	8b 10                	mov    (%eax),%edx
+  8007a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007a8:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ab:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007ae:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8007b3:	eb be                	jmp    800773 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8007b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b8:	8b 10                	mov    (%eax),%edx
+  8007ba:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007bd:	8d 40 08             	lea    0x8(%eax),%eax
+  8007c0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007c3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8007c8:	eb a9                	jmp    800773 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8007ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007cd:	8b 10                	mov    (%eax),%edx
+  8007cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007d4:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007da:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8007df:	eb 92                	jmp    800773 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8007e1:	83 ec 08             	sub    $0x8,%esp
+  8007e4:	53                   	push   %ebx
+  8007e5:	6a 25                	push   $0x25
+  8007e7:	ff d6                	call   *%esi
+			break;
+  8007e9:	83 c4 10             	add    $0x10,%esp
+  8007ec:	eb 9f                	jmp    80078d <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8007ee:	83 ec 08             	sub    $0x8,%esp
+  8007f1:	53                   	push   %ebx
+  8007f2:	6a 25                	push   $0x25
+  8007f4:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007f6:	83 c4 10             	add    $0x10,%esp
+  8007f9:	89 f8                	mov    %edi,%eax
+  8007fb:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007ff:	74 05                	je     800806 <vprintfmt+0x44f>
+  800801:	83 e8 01             	sub    $0x1,%eax
+  800804:	eb f5                	jmp    8007fb <vprintfmt+0x444>
+  800806:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800809:	eb 82                	jmp    80078d <vprintfmt+0x3d6>
+
+0080080b <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80080b:	55                   	push   %ebp
+  80080c:	89 e5                	mov    %esp,%ebp
+  80080e:	83 ec 18             	sub    $0x18,%esp
+  800811:	8b 45 08             	mov    0x8(%ebp),%eax
+  800814:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800817:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80081a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80081e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800821:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800828:	85 c0                	test   %eax,%eax
+  80082a:	74 26                	je     800852 <vsnprintf+0x47>
+  80082c:	85 d2                	test   %edx,%edx
+  80082e:	7e 22                	jle    800852 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800830:	ff 75 14             	push   0x14(%ebp)
+  800833:	ff 75 10             	push   0x10(%ebp)
+  800836:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800839:	50                   	push   %eax
+  80083a:	68 7d 03 80 00       	push   $0x80037d
+  80083f:	e8 73 fb ff ff       	call   8003b7 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800844:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800847:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80084a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80084d:	83 c4 10             	add    $0x10,%esp
+}
+  800850:	c9                   	leave
+  800851:	c3                   	ret
+		return -E_INVAL;
+  800852:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800857:	eb f7                	jmp    800850 <vsnprintf+0x45>
+
+00800859 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800859:	55                   	push   %ebp
+  80085a:	89 e5                	mov    %esp,%ebp
+  80085c:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80085f:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800862:	50                   	push   %eax
+  800863:	ff 75 10             	push   0x10(%ebp)
+  800866:	ff 75 0c             	push   0xc(%ebp)
+  800869:	ff 75 08             	push   0x8(%ebp)
+  80086c:	e8 9a ff ff ff       	call   80080b <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800871:	c9                   	leave
+  800872:	c3                   	ret
+
+00800873 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800873:	55                   	push   %ebp
+  800874:	89 e5                	mov    %esp,%ebp
+  800876:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800879:	b8 00 00 00 00       	mov    $0x0,%eax
+  80087e:	eb 03                	jmp    800883 <strlen+0x10>
+		n++;
+  800880:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800883:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800887:	75 f7                	jne    800880 <strlen+0xd>
+	return n;
+}
+  800889:	5d                   	pop    %ebp
+  80088a:	c3                   	ret
+
+0080088b <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80088b:	55                   	push   %ebp
+  80088c:	89 e5                	mov    %esp,%ebp
+  80088e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800891:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800894:	b8 00 00 00 00       	mov    $0x0,%eax
+  800899:	eb 03                	jmp    80089e <strnlen+0x13>
+		n++;
+  80089b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80089e:	39 d0                	cmp    %edx,%eax
+  8008a0:	74 08                	je     8008aa <strnlen+0x1f>
+  8008a2:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008a6:	75 f3                	jne    80089b <strnlen+0x10>
+  8008a8:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008aa:	89 d0                	mov    %edx,%eax
+  8008ac:	5d                   	pop    %ebp
+  8008ad:	c3                   	ret
+
+008008ae <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008ae:	55                   	push   %ebp
+  8008af:	89 e5                	mov    %esp,%ebp
+  8008b1:	53                   	push   %ebx
+  8008b2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008b5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008bd:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008c1:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008c4:	83 c0 01             	add    $0x1,%eax
+  8008c7:	84 d2                	test   %dl,%dl
+  8008c9:	75 f2                	jne    8008bd <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008cb:	89 c8                	mov    %ecx,%eax
+  8008cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008d0:	c9                   	leave
+  8008d1:	c3                   	ret
+
+008008d2 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008d2:	55                   	push   %ebp
+  8008d3:	89 e5                	mov    %esp,%ebp
+  8008d5:	53                   	push   %ebx
+  8008d6:	83 ec 10             	sub    $0x10,%esp
+  8008d9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008dc:	53                   	push   %ebx
+  8008dd:	e8 91 ff ff ff       	call   800873 <strlen>
+  8008e2:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008e5:	ff 75 0c             	push   0xc(%ebp)
+  8008e8:	01 d8                	add    %ebx,%eax
+  8008ea:	50                   	push   %eax
+  8008eb:	e8 be ff ff ff       	call   8008ae <strcpy>
+	return dst;
+}
+  8008f0:	89 d8                	mov    %ebx,%eax
+  8008f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008f5:	c9                   	leave
+  8008f6:	c3                   	ret
+
+008008f7 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008f7:	55                   	push   %ebp
+  8008f8:	89 e5                	mov    %esp,%ebp
+  8008fa:	56                   	push   %esi
+  8008fb:	53                   	push   %ebx
+  8008fc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008ff:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800902:	89 f3                	mov    %esi,%ebx
+  800904:	03 5d 10             	add    0x10(%ebp),%ebx
+  800907:	89 f0                	mov    %esi,%eax
+  800909:	eb 0f                	jmp    80091a <strncpy+0x23>
+		*dst++ = *src;
+  80090b:	83 c0 01             	add    $0x1,%eax
+  80090e:	0f b6 0a             	movzbl (%edx),%ecx
+  800911:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800914:	80 f9 01             	cmp    $0x1,%cl
+  800917:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80091a:	39 d8                	cmp    %ebx,%eax
+  80091c:	75 ed                	jne    80090b <strncpy+0x14>
+	}
+	return ret;
+}
+  80091e:	89 f0                	mov    %esi,%eax
+  800920:	5b                   	pop    %ebx
+  800921:	5e                   	pop    %esi
+  800922:	5d                   	pop    %ebp
+  800923:	c3                   	ret
+
+00800924 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800924:	55                   	push   %ebp
+  800925:	89 e5                	mov    %esp,%ebp
+  800927:	56                   	push   %esi
+  800928:	53                   	push   %ebx
+  800929:	8b 75 08             	mov    0x8(%ebp),%esi
+  80092c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80092f:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800932:	89 f0                	mov    %esi,%eax
+  800934:	85 d2                	test   %edx,%edx
+  800936:	74 21                	je     800959 <strlcpy+0x35>
+  800938:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80093c:	89 f2                	mov    %esi,%edx
+  80093e:	eb 09                	jmp    800949 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800940:	83 c1 01             	add    $0x1,%ecx
+  800943:	83 c2 01             	add    $0x1,%edx
+  800946:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800949:	39 c2                	cmp    %eax,%edx
+  80094b:	74 09                	je     800956 <strlcpy+0x32>
+  80094d:	0f b6 19             	movzbl (%ecx),%ebx
+  800950:	84 db                	test   %bl,%bl
+  800952:	75 ec                	jne    800940 <strlcpy+0x1c>
+  800954:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800956:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800959:	29 f0                	sub    %esi,%eax
+}
+  80095b:	5b                   	pop    %ebx
+  80095c:	5e                   	pop    %esi
+  80095d:	5d                   	pop    %ebp
+  80095e:	c3                   	ret
+
+0080095f <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80095f:	55                   	push   %ebp
+  800960:	89 e5                	mov    %esp,%ebp
+  800962:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800965:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800968:	eb 06                	jmp    800970 <strcmp+0x11>
+		p++, q++;
+  80096a:	83 c1 01             	add    $0x1,%ecx
+  80096d:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800970:	0f b6 01             	movzbl (%ecx),%eax
+  800973:	84 c0                	test   %al,%al
+  800975:	74 04                	je     80097b <strcmp+0x1c>
+  800977:	3a 02                	cmp    (%edx),%al
+  800979:	74 ef                	je     80096a <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80097b:	0f b6 c0             	movzbl %al,%eax
+  80097e:	0f b6 12             	movzbl (%edx),%edx
+  800981:	29 d0                	sub    %edx,%eax
+}
+  800983:	5d                   	pop    %ebp
+  800984:	c3                   	ret
+
+00800985 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800985:	55                   	push   %ebp
+  800986:	89 e5                	mov    %esp,%ebp
+  800988:	53                   	push   %ebx
+  800989:	8b 45 08             	mov    0x8(%ebp),%eax
+  80098c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80098f:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800992:	eb 09                	jmp    80099d <strncmp+0x18>
+		n--, p++, q++;
+  800994:	83 ea 01             	sub    $0x1,%edx
+  800997:	83 c0 01             	add    $0x1,%eax
+  80099a:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80099d:	85 d2                	test   %edx,%edx
+  80099f:	74 18                	je     8009b9 <strncmp+0x34>
+  8009a1:	0f b6 18             	movzbl (%eax),%ebx
+  8009a4:	84 db                	test   %bl,%bl
+  8009a6:	74 04                	je     8009ac <strncmp+0x27>
+  8009a8:	3a 19                	cmp    (%ecx),%bl
+  8009aa:	74 e8                	je     800994 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009ac:	0f b6 00             	movzbl (%eax),%eax
+  8009af:	0f b6 11             	movzbl (%ecx),%edx
+  8009b2:	29 d0                	sub    %edx,%eax
+}
+  8009b4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009b7:	c9                   	leave
+  8009b8:	c3                   	ret
+		return 0;
+  8009b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009be:	eb f4                	jmp    8009b4 <strncmp+0x2f>
+
+008009c0 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009c0:	55                   	push   %ebp
+  8009c1:	89 e5                	mov    %esp,%ebp
+  8009c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009ca:	eb 03                	jmp    8009cf <strchr+0xf>
+  8009cc:	83 c0 01             	add    $0x1,%eax
+  8009cf:	0f b6 10             	movzbl (%eax),%edx
+  8009d2:	84 d2                	test   %dl,%dl
+  8009d4:	74 06                	je     8009dc <strchr+0x1c>
+		if (*s == c)
+  8009d6:	38 ca                	cmp    %cl,%dl
+  8009d8:	75 f2                	jne    8009cc <strchr+0xc>
+  8009da:	eb 05                	jmp    8009e1 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009dc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009e1:	5d                   	pop    %ebp
+  8009e2:	c3                   	ret
+
+008009e3 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009e3:	55                   	push   %ebp
+  8009e4:	89 e5                	mov    %esp,%ebp
+  8009e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009ed:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8009f0:	38 ca                	cmp    %cl,%dl
+  8009f2:	74 09                	je     8009fd <strfind+0x1a>
+  8009f4:	84 d2                	test   %dl,%dl
+  8009f6:	74 05                	je     8009fd <strfind+0x1a>
+	for (; *s; s++)
+  8009f8:	83 c0 01             	add    $0x1,%eax
+  8009fb:	eb f0                	jmp    8009ed <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009fd:	5d                   	pop    %ebp
+  8009fe:	c3                   	ret
+
+008009ff <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009ff:	55                   	push   %ebp
+  800a00:	89 e5                	mov    %esp,%ebp
+  800a02:	57                   	push   %edi
+  800a03:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a06:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a09:	85 c9                	test   %ecx,%ecx
+  800a0b:	74 20                	je     800a2d <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a0d:	89 f8                	mov    %edi,%eax
+  800a0f:	09 c8                	or     %ecx,%eax
+  800a11:	a8 03                	test   $0x3,%al
+  800a13:	75 12                	jne    800a27 <memset+0x28>
+		c &= 0xFF;
+  800a15:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a19:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a1f:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a22:	fc                   	cld
+  800a23:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a25:	eb 06                	jmp    800a2d <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a27:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a2a:	fc                   	cld
+  800a2b:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a2d:	89 f8                	mov    %edi,%eax
+  800a2f:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a32:	c9                   	leave
+  800a33:	c3                   	ret
+
+00800a34 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a34:	55                   	push   %ebp
+  800a35:	89 e5                	mov    %esp,%ebp
+  800a37:	57                   	push   %edi
+  800a38:	56                   	push   %esi
+  800a39:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a3c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a3f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a42:	39 c6                	cmp    %eax,%esi
+  800a44:	73 32                	jae    800a78 <memmove+0x44>
+  800a46:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a49:	39 d0                	cmp    %edx,%eax
+  800a4b:	73 2b                	jae    800a78 <memmove+0x44>
+		s += n;
+		d += n;
+  800a4d:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a50:	89 d6                	mov    %edx,%esi
+  800a52:	09 fe                	or     %edi,%esi
+  800a54:	09 ce                	or     %ecx,%esi
+  800a56:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a5c:	75 0e                	jne    800a6c <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a5e:	83 ef 04             	sub    $0x4,%edi
+  800a61:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a64:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a67:	fd                   	std
+  800a68:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a6a:	eb 09                	jmp    800a75 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a6c:	83 ef 01             	sub    $0x1,%edi
+  800a6f:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a72:	fd                   	std
+  800a73:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a75:	fc                   	cld
+  800a76:	eb 1a                	jmp    800a92 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	09 c2                	or     %eax,%edx
+  800a7c:	09 ca                	or     %ecx,%edx
+  800a7e:	f6 c2 03             	test   $0x3,%dl
+  800a81:	75 0a                	jne    800a8d <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a83:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a86:	89 c7                	mov    %eax,%edi
+  800a88:	fc                   	cld
+  800a89:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a8b:	eb 05                	jmp    800a92 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a8d:	89 c7                	mov    %eax,%edi
+  800a8f:	fc                   	cld
+  800a90:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a92:	5e                   	pop    %esi
+  800a93:	5f                   	pop    %edi
+  800a94:	5d                   	pop    %ebp
+  800a95:	c3                   	ret
+
+00800a96 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a96:	55                   	push   %ebp
+  800a97:	89 e5                	mov    %esp,%ebp
+  800a99:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a9c:	ff 75 10             	push   0x10(%ebp)
+  800a9f:	ff 75 0c             	push   0xc(%ebp)
+  800aa2:	ff 75 08             	push   0x8(%ebp)
+  800aa5:	e8 8a ff ff ff       	call   800a34 <memmove>
+}
+  800aaa:	c9                   	leave
+  800aab:	c3                   	ret
+
+00800aac <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800aac:	55                   	push   %ebp
+  800aad:	89 e5                	mov    %esp,%ebp
+  800aaf:	56                   	push   %esi
+  800ab0:	53                   	push   %ebx
+  800ab1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ab4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ab7:	89 c6                	mov    %eax,%esi
+  800ab9:	03 75 10             	add    0x10(%ebp),%esi
+  800abc:	eb 06                	jmp    800ac4 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800abe:	83 c0 01             	add    $0x1,%eax
+  800ac1:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800ac4:	39 f0                	cmp    %esi,%eax
+  800ac6:	74 14                	je     800adc <memcmp+0x30>
+		if (*s1 != *s2)
+  800ac8:	0f b6 08             	movzbl (%eax),%ecx
+  800acb:	0f b6 1a             	movzbl (%edx),%ebx
+  800ace:	38 d9                	cmp    %bl,%cl
+  800ad0:	74 ec                	je     800abe <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800ad2:	0f b6 c1             	movzbl %cl,%eax
+  800ad5:	0f b6 db             	movzbl %bl,%ebx
+  800ad8:	29 d8                	sub    %ebx,%eax
+  800ada:	eb 05                	jmp    800ae1 <memcmp+0x35>
+	}
+
+	return 0;
+  800adc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ae1:	5b                   	pop    %ebx
+  800ae2:	5e                   	pop    %esi
+  800ae3:	5d                   	pop    %ebp
+  800ae4:	c3                   	ret
+
+00800ae5 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ae5:	55                   	push   %ebp
+  800ae6:	89 e5                	mov    %esp,%ebp
+  800ae8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aeb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800aee:	89 c2                	mov    %eax,%edx
+  800af0:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800af3:	eb 03                	jmp    800af8 <memfind+0x13>
+  800af5:	83 c0 01             	add    $0x1,%eax
+  800af8:	39 d0                	cmp    %edx,%eax
+  800afa:	73 04                	jae    800b00 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800afc:	38 08                	cmp    %cl,(%eax)
+  800afe:	75 f5                	jne    800af5 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b00:	5d                   	pop    %ebp
+  800b01:	c3                   	ret
+
+00800b02 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b02:	55                   	push   %ebp
+  800b03:	89 e5                	mov    %esp,%ebp
+  800b05:	57                   	push   %edi
+  800b06:	56                   	push   %esi
+  800b07:	53                   	push   %ebx
+  800b08:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b0b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b0e:	eb 03                	jmp    800b13 <strtol+0x11>
+		s++;
+  800b10:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b13:	0f b6 02             	movzbl (%edx),%eax
+  800b16:	3c 20                	cmp    $0x20,%al
+  800b18:	74 f6                	je     800b10 <strtol+0xe>
+  800b1a:	3c 09                	cmp    $0x9,%al
+  800b1c:	74 f2                	je     800b10 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b1e:	3c 2b                	cmp    $0x2b,%al
+  800b20:	74 2a                	je     800b4c <strtol+0x4a>
+	int neg = 0;
+  800b22:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b27:	3c 2d                	cmp    $0x2d,%al
+  800b29:	74 2b                	je     800b56 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b2b:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b31:	75 0f                	jne    800b42 <strtol+0x40>
+  800b33:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b36:	74 28                	je     800b60 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b38:	85 db                	test   %ebx,%ebx
+  800b3a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b3f:	0f 44 d8             	cmove  %eax,%ebx
+  800b42:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b47:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b4a:	eb 46                	jmp    800b92 <strtol+0x90>
+		s++;
+  800b4c:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b4f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b54:	eb d5                	jmp    800b2b <strtol+0x29>
+		s++, neg = 1;
+  800b56:	83 c2 01             	add    $0x1,%edx
+  800b59:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b5e:	eb cb                	jmp    800b2b <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b60:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b64:	74 0e                	je     800b74 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b66:	85 db                	test   %ebx,%ebx
+  800b68:	75 d8                	jne    800b42 <strtol+0x40>
+		s++, base = 8;
+  800b6a:	83 c2 01             	add    $0x1,%edx
+  800b6d:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b72:	eb ce                	jmp    800b42 <strtol+0x40>
+		s += 2, base = 16;
+  800b74:	83 c2 02             	add    $0x2,%edx
+  800b77:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b7c:	eb c4                	jmp    800b42 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b7e:	0f be c0             	movsbl %al,%eax
+  800b81:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b84:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b87:	7d 3a                	jge    800bc3 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b89:	83 c2 01             	add    $0x1,%edx
+  800b8c:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b90:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b92:	0f b6 02             	movzbl (%edx),%eax
+  800b95:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b98:	89 f3                	mov    %esi,%ebx
+  800b9a:	80 fb 09             	cmp    $0x9,%bl
+  800b9d:	76 df                	jbe    800b7e <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b9f:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ba2:	89 f3                	mov    %esi,%ebx
+  800ba4:	80 fb 19             	cmp    $0x19,%bl
+  800ba7:	77 08                	ja     800bb1 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800ba9:	0f be c0             	movsbl %al,%eax
+  800bac:	83 e8 57             	sub    $0x57,%eax
+  800baf:	eb d3                	jmp    800b84 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bb1:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bb4:	89 f3                	mov    %esi,%ebx
+  800bb6:	80 fb 19             	cmp    $0x19,%bl
+  800bb9:	77 08                	ja     800bc3 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800bbb:	0f be c0             	movsbl %al,%eax
+  800bbe:	83 e8 37             	sub    $0x37,%eax
+  800bc1:	eb c1                	jmp    800b84 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800bc3:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800bc7:	74 05                	je     800bce <strtol+0xcc>
+		*endptr = (char *) s;
+  800bc9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bcc:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800bce:	89 c8                	mov    %ecx,%eax
+  800bd0:	f7 d8                	neg    %eax
+  800bd2:	85 ff                	test   %edi,%edi
+  800bd4:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800bd7:	89 c8                	mov    %ecx,%eax
+  800bd9:	5b                   	pop    %ebx
+  800bda:	5e                   	pop    %esi
+  800bdb:	5f                   	pop    %edi
+  800bdc:	5d                   	pop    %ebp
+  800bdd:	c3                   	ret
+
+00800bde <atoi>:
+
+int
+atoi(const char *s)
+{
+  800bde:	55                   	push   %ebp
+  800bdf:	89 e5                	mov    %esp,%ebp
+  800be1:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800be4:	6a 0a                	push   $0xa
+  800be6:	6a 00                	push   $0x0
+  800be8:	ff 75 08             	push   0x8(%ebp)
+  800beb:	e8 12 ff ff ff       	call   800b02 <strtol>
+}
+  800bf0:	c9                   	leave
+  800bf1:	c3                   	ret
+
+00800bf2 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800bf2:	55                   	push   %ebp
+  800bf3:	89 e5                	mov    %esp,%ebp
+  800bf5:	57                   	push   %edi
+  800bf6:	56                   	push   %esi
+  800bf7:	53                   	push   %ebx
+  800bf8:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800bfe:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800c04:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800c0a:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800c10:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800c17:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800c1a:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800c21:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800c24:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800c2b:	74 76                	je     800ca3 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800c2d:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800c33:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c36:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800c3c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800c43:	0f 88 06 01 00 00    	js     800d4f <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800c49:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800c50:	0f 84 48 01 00 00    	je     800d9e <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800c56:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800c5c:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800c62:	be 00 00 00 00       	mov    $0x0,%esi
+  800c67:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800c6d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c70:	55                   	push   %ebp
+  800c71:	68 7a 0c 80 00       	push   $0x800c7a
+  800c76:	89 e5                	mov    %esp,%ebp
+  800c78:	0f 34                	sysenter
+  800c7a:	83 c4 04             	add    $0x4,%esp
+  800c7d:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800c7e:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800c84:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800c8a:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800c8d:	0f 85 9a 01 00 00    	jne    800e2d <page_vec_call+0x23b>
+  800c93:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c98:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c9b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c9e:	e9 29 01 00 00       	jmp    800dcc <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800ca3:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800ca9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cac:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800cae:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800cb5:	78 2f                	js     800ce6 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800cb7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800cbe:	74 72                	je     800d32 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800cc0:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800cc6:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800ccc:	b8 10 00 00 00       	mov    $0x10,%eax
+  800cd1:	89 fb                	mov    %edi,%ebx
+  800cd3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800cd6:	55                   	push   %ebp
+  800cd7:	68 e0 0c 80 00       	push   $0x800ce0
+  800cdc:	89 e5                	mov    %esp,%ebp
+  800cde:	0f 34                	sysenter
+  800ce0:	83 c4 04             	add    $0x4,%esp
+  800ce3:	5d                   	pop    %ebp
+	return ret;
+  800ce4:	eb 98                	jmp    800c7e <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800ce6:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ceb:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800ced:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800cf2:	f6 c6 08             	test   $0x8,%dh
+  800cf5:	74 15                	je     800d0c <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800cf7:	89 c2                	mov    %eax,%edx
+  800cf9:	c1 ea 08             	shr    $0x8,%edx
+  800cfc:	83 e2 0f             	and    $0xf,%edx
+  800cff:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d04:	83 fa 06             	cmp    $0x6,%edx
+  800d07:	74 0e                	je     800d17 <page_vec_call+0x125>
+  800d09:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800d0c:	0f b6 c9             	movzbl %cl,%ecx
+  800d0f:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800d15:	eb a0                	jmp    800cb7 <page_vec_call+0xc5>
+  800d17:	89 c2                	mov    %eax,%edx
+  800d19:	c1 ea 04             	shr    $0x4,%edx
+  800d1c:	83 e2 0f             	and    $0xf,%edx
+  800d1f:	83 fa 02             	cmp    $0x2,%edx
+  800d22:	77 e5                	ja     800d09 <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800d24:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d27:	83 f8 02             	cmp    $0x2,%eax
+  800d2a:	0f 97 c1             	seta   %cl
+  800d2d:	0f b6 c9             	movzbl %cl,%ecx
+  800d30:	eb d7                	jmp    800d09 <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800d32:	b8 10 00 00 00       	mov    $0x10,%eax
+  800d37:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800d3d:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800d43:	89 fb                	mov    %edi,%ebx
+  800d45:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800d48:	cd 30                	int    $0x30
+  800d4a:	e9 2f ff ff ff       	jmp    800c7e <page_vec_call+0x8c>
+  800d4f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d54:	0f a2                	cpuid
+		return 0;
+  800d56:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800d5b:	f6 c6 08             	test   $0x8,%dh
+  800d5e:	74 15                	je     800d75 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d60:	89 c2                	mov    %eax,%edx
+  800d62:	c1 ea 08             	shr    $0x8,%edx
+  800d65:	83 e2 0f             	and    $0xf,%edx
+  800d68:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d6d:	83 fa 06             	cmp    $0x6,%edx
+  800d70:	74 11                	je     800d83 <page_vec_call+0x191>
+  800d72:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800d75:	0f b6 c9             	movzbl %cl,%ecx
+  800d78:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800d7e:	e9 c6 fe ff ff       	jmp    800c49 <page_vec_call+0x57>
+  800d83:	89 c2                	mov    %eax,%edx
+  800d85:	c1 ea 04             	shr    $0x4,%edx
+  800d88:	83 e2 0f             	and    $0xf,%edx
+  800d8b:	83 fa 02             	cmp    $0x2,%edx
+  800d8e:	77 e2                	ja     800d72 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800d90:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d93:	83 f8 02             	cmp    $0x2,%eax
+  800d96:	0f 97 c1             	seta   %cl
+  800d99:	0f b6 c9             	movzbl %cl,%ecx
+  800d9c:	eb d4                	jmp    800d72 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800d9e:	be 00 00 00 00       	mov    $0x0,%esi
+  800da3:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800da9:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800daf:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800db5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800db8:	cd 30                	int    $0x30
+  800dba:	e9 bf fe ff ff       	jmp    800c7e <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800dbf:	29 da                	sub    %ebx,%edx
+			vec++;
+  800dc1:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800dc4:	83 e8 01             	sub    $0x1,%eax
+  800dc7:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800dcc:	85 c0                	test   %eax,%eax
+  800dce:	74 58                	je     800e28 <page_vec_call+0x236>
+  800dd0:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800dd3:	39 da                	cmp    %ebx,%edx
+  800dd5:	73 e8                	jae    800dbf <page_vec_call+0x1cd>
+  800dd7:	89 75 08             	mov    %esi,0x8(%ebp)
+  800dda:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800ddd:	84 c9                	test   %cl,%cl
+  800ddf:	74 06                	je     800de7 <page_vec_call+0x1f5>
+  800de1:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800de7:	83 ec 04             	sub    $0x4,%esp
+  800dea:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ded:	c1 e0 04             	shl    $0x4,%eax
+  800df0:	50                   	push   %eax
+  800df1:	ff 75 08             	push   0x8(%ebp)
+  800df4:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800dfa:	53                   	push   %ebx
+  800dfb:	e8 34 fc ff ff       	call   800a34 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800e00:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800e06:	89 c2                	mov    %eax,%edx
+  800e08:	c1 e2 0c             	shl    $0xc,%edx
+  800e0b:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  800e11:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  800e17:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  800e1d:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  800e20:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  800e23:	e9 f2 fd ff ff       	jmp    800c1a <page_vec_call+0x28>
+			r = 0;
+  800e28:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  800e2d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800e31:	74 0b                	je     800e3e <page_vec_call+0x24c>
+		*done = total;
+  800e33:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800e36:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  800e3c:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  800e3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e41:	5b                   	pop    %ebx
+  800e42:	5e                   	pop    %esi
+  800e43:	5f                   	pop    %edi
+  800e44:	5d                   	pop    %ebp
+  800e45:	c3                   	ret
+
+00800e46 <sys_cputs>:
+{
+  800e46:	55                   	push   %ebp
+  800e47:	89 e5                	mov    %esp,%ebp
+  800e49:	57                   	push   %edi
+  800e4a:	56                   	push   %esi
+  800e4b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800e4c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e53:	78 2d                	js     800e82 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800e55:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e5c:	74 70                	je     800ece <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800e5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e63:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e66:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e69:	89 c3                	mov    %eax,%ebx
+  800e6b:	89 c7                	mov    %eax,%edi
+  800e6d:	89 c6                	mov    %eax,%esi
+  800e6f:	55                   	push   %ebp
+  800e70:	68 79 0e 80 00       	push   $0x800e79
+  800e75:	89 e5                	mov    %esp,%ebp
+  800e77:	0f 34                	sysenter
+  800e79:	83 c4 04             	add    $0x4,%esp
+  800e7c:	5d                   	pop    %ebp
+}
+  800e7d:	5b                   	pop    %ebx
+  800e7e:	5e                   	pop    %esi
+  800e7f:	5f                   	pop    %edi
+  800e80:	5d                   	pop    %ebp
+  800e81:	c3                   	ret
+  800e82:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e87:	0f a2                	cpuid
+		return 0;
+  800e89:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800e8e:	f6 c6 08             	test   $0x8,%dh
+  800e91:	74 15                	je     800ea8 <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e93:	89 c2                	mov    %eax,%edx
+  800e95:	c1 ea 08             	shr    $0x8,%edx
+  800e98:	83 e2 0f             	and    $0xf,%edx
+  800e9b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ea0:	83 fa 06             	cmp    $0x6,%edx
+  800ea3:	74 0e                	je     800eb3 <sys_cputs+0x6d>
+  800ea5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800ea8:	0f b6 c9             	movzbl %cl,%ecx
+  800eab:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800eb1:	eb a2                	jmp    800e55 <sys_cputs+0xf>
+  800eb3:	89 c2                	mov    %eax,%edx
+  800eb5:	c1 ea 04             	shr    $0x4,%edx
+  800eb8:	83 e2 0f             	and    $0xf,%edx
+  800ebb:	83 fa 02             	cmp    $0x2,%edx
+  800ebe:	77 e5                	ja     800ea5 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800ec0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ec3:	83 f8 02             	cmp    $0x2,%eax
+  800ec6:	0f 97 c1             	seta   %cl
+  800ec9:	0f b6 c9             	movzbl %cl,%ecx
+  800ecc:	eb d7                	jmp    800ea5 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800ece:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ed3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed9:	89 c3                	mov    %eax,%ebx
+  800edb:	89 c7                	mov    %eax,%edi
+  800edd:	89 c6                	mov    %eax,%esi
+  800edf:	cd 30                	int    $0x30
+}
+  800ee1:	eb 9a                	jmp    800e7d <sys_cputs+0x37>
+
+00800ee3 <sys_cgetc>:
+{
+  800ee3:	55                   	push   %ebp
+  800ee4:	89 e5                	mov    %esp,%ebp
+  800ee6:	57                   	push   %edi
+  800ee7:	56                   	push   %esi
+  800ee8:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800ee9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800ef0:	78 2e                	js     800f20 <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  800ef2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800ef9:	74 71                	je     800f6c <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  800efb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f00:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f05:	89 d1                	mov    %edx,%ecx
+  800f07:	89 d3                	mov    %edx,%ebx
+  800f09:	89 d7                	mov    %edx,%edi
+  800f0b:	89 d6                	mov    %edx,%esi
+  800f0d:	55                   	push   %ebp
+  800f0e:	68 17 0f 80 00       	push   $0x800f17
+  800f13:	89 e5                	mov    %esp,%ebp
+  800f15:	0f 34                	sysenter
+  800f17:	83 c4 04             	add    $0x4,%esp
+  800f1a:	5d                   	pop    %ebp
+}
+  800f1b:	5b                   	pop    %ebx
+  800f1c:	5e                   	pop    %esi
+  800f1d:	5f                   	pop    %edi
+  800f1e:	5d                   	pop    %ebp
+  800f1f:	c3                   	ret
+  800f20:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f25:	0f a2                	cpuid
+		return 0;
+  800f27:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f2c:	f6 c6 08             	test   $0x8,%dh
+  800f2f:	74 15                	je     800f46 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f31:	89 c2                	mov    %eax,%edx
+  800f33:	c1 ea 08             	shr    $0x8,%edx
+  800f36:	83 e2 0f             	and    $0xf,%edx
+  800f39:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f3e:	83 fa 06             	cmp    $0x6,%edx
+  800f41:	74 0e                	je     800f51 <sys_cgetc+0x6e>
+  800f43:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f46:	0f b6 c9             	movzbl %cl,%ecx
+  800f49:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800f4f:	eb a1                	jmp    800ef2 <sys_cgetc+0xf>
+  800f51:	89 c2                	mov    %eax,%edx
+  800f53:	c1 ea 04             	shr    $0x4,%edx
+  800f56:	83 e2 0f             	and    $0xf,%edx
+  800f59:	83 fa 02             	cmp    $0x2,%edx
+  800f5c:	77 e5                	ja     800f43 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  800f5e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f61:	83 f8 02             	cmp    $0x2,%eax
+  800f64:	0f 97 c1             	seta   %cl
+  800f67:	0f b6 c9             	movzbl %cl,%ecx
+  800f6a:	eb d7                	jmp    800f43 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  800f6c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f71:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f76:	89 d1                	mov    %edx,%ecx
+  800f78:	89 d3                	mov    %edx,%ebx
+  800f7a:	89 d7                	mov    %edx,%edi
+  800f7c:	89 d6                	mov    %edx,%esi
+  800f7e:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800f80:	eb 99                	jmp    800f1b <sys_cgetc+0x38>
+
+00800f82 <sys_env_destroy>:
+{
+  800f82:	55                   	push   %ebp
+  800f83:	89 e5                	mov    %esp,%ebp
+  800f85:	57                   	push   %edi
+  800f86:	56                   	push   %esi
+  800f87:	53                   	push   %ebx
+  800f88:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800f8b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800f92:	78 36                	js     800fca <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  800f94:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800f9b:	74 79                	je     801016 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  800f9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fa5:	b8 03 00 00 00       	mov    $0x3,%eax
+  800faa:	89 cb                	mov    %ecx,%ebx
+  800fac:	89 cf                	mov    %ecx,%edi
+  800fae:	89 ce                	mov    %ecx,%esi
+  800fb0:	55                   	push   %ebp
+  800fb1:	68 ba 0f 80 00       	push   $0x800fba
+  800fb6:	89 e5                	mov    %esp,%ebp
+  800fb8:	0f 34                	sysenter
+  800fba:	83 c4 04             	add    $0x4,%esp
+  800fbd:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800fbe:	85 c0                	test   %eax,%eax
+  800fc0:	7f 6b                	jg     80102d <sys_env_destroy+0xab>
+}
+  800fc2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fc5:	5b                   	pop    %ebx
+  800fc6:	5e                   	pop    %esi
+  800fc7:	5f                   	pop    %edi
+  800fc8:	5d                   	pop    %ebp
+  800fc9:	c3                   	ret
+  800fca:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fcf:	0f a2                	cpuid
+		return 0;
+  800fd1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800fd6:	f6 c6 08             	test   $0x8,%dh
+  800fd9:	74 15                	je     800ff0 <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800fdb:	89 c2                	mov    %eax,%edx
+  800fdd:	c1 ea 08             	shr    $0x8,%edx
+  800fe0:	83 e2 0f             	and    $0xf,%edx
+  800fe3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800fe8:	83 fa 06             	cmp    $0x6,%edx
+  800feb:	74 0e                	je     800ffb <sys_env_destroy+0x79>
+  800fed:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800ff0:	0f b6 c9             	movzbl %cl,%ecx
+  800ff3:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800ff9:	eb 99                	jmp    800f94 <sys_env_destroy+0x12>
+  800ffb:	89 c2                	mov    %eax,%edx
+  800ffd:	c1 ea 04             	shr    $0x4,%edx
+  801000:	83 e2 0f             	and    $0xf,%edx
+  801003:	83 fa 02             	cmp    $0x2,%edx
+  801006:	77 e5                	ja     800fed <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  801008:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80100b:	83 f8 02             	cmp    $0x2,%eax
+  80100e:	0f 97 c1             	seta   %cl
+  801011:	0f b6 c9             	movzbl %cl,%ecx
+  801014:	eb d7                	jmp    800fed <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  801016:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80101b:	b8 03 00 00 00       	mov    $0x3,%eax
+  801020:	8b 55 08             	mov    0x8(%ebp),%edx
+  801023:	89 cb                	mov    %ecx,%ebx
+  801025:	89 cf                	mov    %ecx,%edi
+  801027:	89 ce                	mov    %ecx,%esi
+  801029:	cd 30                	int    $0x30
+  80102b:	eb 91                	jmp    800fbe <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80102d:	83 ec 0c             	sub    $0xc,%esp
+  801030:	50                   	push   %eax
+  801031:	6a 03                	push   $0x3
+  801033:	68 39 33 80 00       	push   $0x803339
+  801038:	6a 4a                	push   $0x4a
+  80103a:	68 56 33 80 00       	push   $0x803356
+  80103f:	e8 68 f1 ff ff       	call   8001ac <_panic>
+
+00801044 <sys_getenvid>:
+{
+  801044:	55                   	push   %ebp
+  801045:	89 e5                	mov    %esp,%ebp
+  801047:	57                   	push   %edi
+  801048:	56                   	push   %esi
+  801049:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80104a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801051:	78 2e                	js     801081 <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  801053:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80105a:	74 71                	je     8010cd <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  80105c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801061:	b8 02 00 00 00       	mov    $0x2,%eax
+  801066:	89 d1                	mov    %edx,%ecx
+  801068:	89 d3                	mov    %edx,%ebx
+  80106a:	89 d7                	mov    %edx,%edi
+  80106c:	89 d6                	mov    %edx,%esi
+  80106e:	55                   	push   %ebp
+  80106f:	68 78 10 80 00       	push   $0x801078
+  801074:	89 e5                	mov    %esp,%ebp
+  801076:	0f 34                	sysenter
+  801078:	83 c4 04             	add    $0x4,%esp
+  80107b:	5d                   	pop    %ebp
+}
+  80107c:	5b                   	pop    %ebx
+  80107d:	5e                   	pop    %esi
+  80107e:	5f                   	pop    %edi
+  80107f:	5d                   	pop    %ebp
+  801080:	c3                   	ret
+  801081:	b8 01 00 00 00       	mov    $0x1,%eax
+  801086:	0f a2                	cpuid
+		return 0;
+  801088:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80108d:	f6 c6 08             	test   $0x8,%dh
+  801090:	74 15                	je     8010a7 <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801092:	89 c2                	mov    %eax,%edx
+  801094:	c1 ea 08             	shr    $0x8,%edx
+  801097:	83 e2 0f             	and    $0xf,%edx
+  80109a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80109f:	83 fa 06             	cmp    $0x6,%edx
+  8010a2:	74 0e                	je     8010b2 <sys_getenvid+0x6e>
+  8010a4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8010a7:	0f b6 c9             	movzbl %cl,%ecx
+  8010aa:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8010b0:	eb a1                	jmp    801053 <sys_getenvid+0xf>
+  8010b2:	89 c2                	mov    %eax,%edx
+  8010b4:	c1 ea 04             	shr    $0x4,%edx
+  8010b7:	83 e2 0f             	and    $0xf,%edx
+  8010ba:	83 fa 02             	cmp    $0x2,%edx
+  8010bd:	77 e5                	ja     8010a4 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  8010bf:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010c2:	83 f8 02             	cmp    $0x2,%eax
+  8010c5:	0f 97 c1             	seta   %cl
+  8010c8:	0f b6 c9             	movzbl %cl,%ecx
+  8010cb:	eb d7                	jmp    8010a4 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  8010cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010d2:	b8 02 00 00 00       	mov    $0x2,%eax
+  8010d7:	89 d1                	mov    %edx,%ecx
+  8010d9:	89 d3                	mov    %edx,%ebx
+  8010db:	89 d7                	mov    %edx,%edi
+  8010dd:	89 d6                	mov    %edx,%esi
+  8010df:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  8010e1:	eb 99                	jmp    80107c <sys_getenvid+0x38>
+
+008010e3 <sys_page_alloc>:
+{
+  8010e3:	55                   	push   %ebp
+  8010e4:	89 e5                	mov    %esp,%ebp
+  8010e6:	57                   	push   %edi
+  8010e7:	56                   	push   %esi
+  8010e8:	53                   	push   %ebx
+  8010e9:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8010ec:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8010f3:	78 38                	js     80112d <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  8010f5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8010fc:	74 7b                	je     801179 <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  8010fe:	be 00 00 00 00       	mov    $0x0,%esi
+  801103:	8b 55 08             	mov    0x8(%ebp),%edx
+  801106:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801109:	b8 04 00 00 00       	mov    $0x4,%eax
+  80110e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801111:	89 f7                	mov    %esi,%edi
+  801113:	55                   	push   %ebp
+  801114:	68 1d 11 80 00       	push   $0x80111d
+  801119:	89 e5                	mov    %esp,%ebp
+  80111b:	0f 34                	sysenter
+  80111d:	83 c4 04             	add    $0x4,%esp
+  801120:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801121:	85 c0                	test   %eax,%eax
+  801123:	7f 6d                	jg     801192 <sys_page_alloc+0xaf>
+}
+  801125:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801128:	5b                   	pop    %ebx
+  801129:	5e                   	pop    %esi
+  80112a:	5f                   	pop    %edi
+  80112b:	5d                   	pop    %ebp
+  80112c:	c3                   	ret
+  80112d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801132:	0f a2                	cpuid
+		return 0;
+  801134:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801139:	f6 c6 08             	test   $0x8,%dh
+  80113c:	74 15                	je     801153 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80113e:	89 c2                	mov    %eax,%edx
+  801140:	c1 ea 08             	shr    $0x8,%edx
+  801143:	83 e2 0f             	and    $0xf,%edx
+  801146:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80114b:	83 fa 06             	cmp    $0x6,%edx
+  80114e:	74 0e                	je     80115e <sys_page_alloc+0x7b>
+  801150:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801153:	0f b6 c9             	movzbl %cl,%ecx
+  801156:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80115c:	eb 97                	jmp    8010f5 <sys_page_alloc+0x12>
+  80115e:	89 c2                	mov    %eax,%edx
+  801160:	c1 ea 04             	shr    $0x4,%edx
+  801163:	83 e2 0f             	and    $0xf,%edx
+  801166:	83 fa 02             	cmp    $0x2,%edx
+  801169:	77 e5                	ja     801150 <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  80116b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80116e:	83 f8 02             	cmp    $0x2,%eax
+  801171:	0f 97 c1             	seta   %cl
+  801174:	0f b6 c9             	movzbl %cl,%ecx
+  801177:	eb d7                	jmp    801150 <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  801179:	be 00 00 00 00       	mov    $0x0,%esi
+  80117e:	b8 04 00 00 00       	mov    $0x4,%eax
+  801183:	8b 55 08             	mov    0x8(%ebp),%edx
+  801186:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801189:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80118c:	89 f7                	mov    %esi,%edi
+  80118e:	cd 30                	int    $0x30
+  801190:	eb 8f                	jmp    801121 <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801192:	83 ec 0c             	sub    $0xc,%esp
+  801195:	50                   	push   %eax
+  801196:	6a 04                	push   $0x4
+  801198:	68 39 33 80 00       	push   $0x803339
+  80119d:	6a 4a                	push   $0x4a
+  80119f:	68 56 33 80 00       	push   $0x803356
+  8011a4:	e8 03 f0 ff ff       	call   8001ac <_panic>
+
+008011a9 <sys_page_map>:
+{
+  8011a9:	55                   	push   %ebp
+  8011aa:	89 e5                	mov    %esp,%ebp
+  8011ac:	57                   	push   %edi
+  8011ad:	56                   	push   %esi
+  8011ae:	53                   	push   %ebx
+  8011af:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8011b2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8011b9:	78 37                	js     8011f2 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  8011bb:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8011c2:	74 7a                	je     80123e <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  8011c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ca:	b8 05 00 00 00       	mov    $0x5,%eax
+  8011cf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011d2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011d5:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011d8:	55                   	push   %ebp
+  8011d9:	68 e2 11 80 00       	push   $0x8011e2
+  8011de:	89 e5                	mov    %esp,%ebp
+  8011e0:	0f 34                	sysenter
+  8011e2:	83 c4 04             	add    $0x4,%esp
+  8011e5:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8011e6:	85 c0                	test   %eax,%eax
+  8011e8:	7f 6c                	jg     801256 <sys_page_map+0xad>
+}
+  8011ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ed:	5b                   	pop    %ebx
+  8011ee:	5e                   	pop    %esi
+  8011ef:	5f                   	pop    %edi
+  8011f0:	5d                   	pop    %ebp
+  8011f1:	c3                   	ret
+  8011f2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011f7:	0f a2                	cpuid
+		return 0;
+  8011f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8011fe:	f6 c6 08             	test   $0x8,%dh
+  801201:	74 15                	je     801218 <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801203:	89 c2                	mov    %eax,%edx
+  801205:	c1 ea 08             	shr    $0x8,%edx
+  801208:	83 e2 0f             	and    $0xf,%edx
+  80120b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801210:	83 fa 06             	cmp    $0x6,%edx
+  801213:	74 0e                	je     801223 <sys_page_map+0x7a>
+  801215:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801218:	0f b6 c9             	movzbl %cl,%ecx
+  80121b:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801221:	eb 98                	jmp    8011bb <sys_page_map+0x12>
+  801223:	89 c2                	mov    %eax,%edx
+  801225:	c1 ea 04             	shr    $0x4,%edx
+  801228:	83 e2 0f             	and    $0xf,%edx
+  80122b:	83 fa 02             	cmp    $0x2,%edx
+  80122e:	77 e5                	ja     801215 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  801230:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801233:	83 f8 02             	cmp    $0x2,%eax
+  801236:	0f 97 c1             	seta   %cl
+  801239:	0f b6 c9             	movzbl %cl,%ecx
+  80123c:	eb d7                	jmp    801215 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  80123e:	b8 05 00 00 00       	mov    $0x5,%eax
+  801243:	8b 55 08             	mov    0x8(%ebp),%edx
+  801246:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801249:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80124c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80124f:	8b 75 18             	mov    0x18(%ebp),%esi
+  801252:	cd 30                	int    $0x30
+  801254:	eb 90                	jmp    8011e6 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801256:	83 ec 0c             	sub    $0xc,%esp
+  801259:	50                   	push   %eax
+  80125a:	6a 05                	push   $0x5
+  80125c:	68 39 33 80 00       	push   $0x803339
+  801261:	6a 4a                	push   $0x4a
+  801263:	68 56 33 80 00       	push   $0x803356
+  801268:	e8 3f ef ff ff       	call   8001ac <_panic>
+
+0080126d <sys_page_unmap>:
+{
+  80126d:	55                   	push   %ebp
+  80126e:	89 e5                	mov    %esp,%ebp
+  801270:	57                   	push   %edi
+  801271:	56                   	push   %esi
+  801272:	53                   	push   %ebx
+  801273:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801276:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80127d:	78 37                	js     8012b6 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  80127f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801286:	74 7a                	je     801302 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  801288:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80128d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801290:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801293:	b8 06 00 00 00       	mov    $0x6,%eax
+  801298:	89 df                	mov    %ebx,%edi
+  80129a:	89 de                	mov    %ebx,%esi
+  80129c:	55                   	push   %ebp
+  80129d:	68 a6 12 80 00       	push   $0x8012a6
+  8012a2:	89 e5                	mov    %esp,%ebp
+  8012a4:	0f 34                	sysenter
+  8012a6:	83 c4 04             	add    $0x4,%esp
+  8012a9:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8012aa:	85 c0                	test   %eax,%eax
+  8012ac:	7f 6c                	jg     80131a <sys_page_unmap+0xad>
+}
+  8012ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012b1:	5b                   	pop    %ebx
+  8012b2:	5e                   	pop    %esi
+  8012b3:	5f                   	pop    %edi
+  8012b4:	5d                   	pop    %ebp
+  8012b5:	c3                   	ret
+  8012b6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012bb:	0f a2                	cpuid
+		return 0;
+  8012bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8012c2:	f6 c6 08             	test   $0x8,%dh
+  8012c5:	74 15                	je     8012dc <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012c7:	89 c2                	mov    %eax,%edx
+  8012c9:	c1 ea 08             	shr    $0x8,%edx
+  8012cc:	83 e2 0f             	and    $0xf,%edx
+  8012cf:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012d4:	83 fa 06             	cmp    $0x6,%edx
+  8012d7:	74 0e                	je     8012e7 <sys_page_unmap+0x7a>
+  8012d9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8012dc:	0f b6 c9             	movzbl %cl,%ecx
+  8012df:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8012e5:	eb 98                	jmp    80127f <sys_page_unmap+0x12>
+  8012e7:	89 c2                	mov    %eax,%edx
+  8012e9:	c1 ea 04             	shr    $0x4,%edx
+  8012ec:	83 e2 0f             	and    $0xf,%edx
+  8012ef:	83 fa 02             	cmp    $0x2,%edx
+  8012f2:	77 e5                	ja     8012d9 <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  8012f4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012f7:	83 f8 02             	cmp    $0x2,%eax
+  8012fa:	0f 97 c1             	seta   %cl
+  8012fd:	0f b6 c9             	movzbl %cl,%ecx
+  801300:	eb d7                	jmp    8012d9 <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  801302:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801307:	b8 06 00 00 00       	mov    $0x6,%eax
+  80130c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801312:	89 df                	mov    %ebx,%edi
+  801314:	89 de                	mov    %ebx,%esi
+  801316:	cd 30                	int    $0x30
+  801318:	eb 90                	jmp    8012aa <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80131a:	83 ec 0c             	sub    $0xc,%esp
+  80131d:	50                   	push   %eax
+  80131e:	6a 06                	push   $0x6
+  801320:	68 39 33 80 00       	push   $0x803339
+  801325:	6a 4a                	push   $0x4a
+  801327:	68 56 33 80 00       	push   $0x803356
+  80132c:	e8 7b ee ff ff       	call   8001ac <_panic>
+
+00801331 <sys_page_copy>:
+{
+  801331:	55                   	push   %ebp
+  801332:	89 e5                	mov    %esp,%ebp
+  801334:	57                   	push   %edi
+  801335:	56                   	push   %esi
+  801336:	53                   	push   %ebx
+  801337:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80133a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801341:	78 37                	js     80137a <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  801343:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80134a:	74 7a                	je     8013c6 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  80134c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80134f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801352:	b8 29 00 00 00       	mov    $0x29,%eax
+  801357:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80135a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80135d:	8b 75 18             	mov    0x18(%ebp),%esi
+  801360:	55                   	push   %ebp
+  801361:	68 6a 13 80 00       	push   $0x80136a
+  801366:	89 e5                	mov    %esp,%ebp
+  801368:	0f 34                	sysenter
+  80136a:	83 c4 04             	add    $0x4,%esp
+  80136d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80136e:	85 c0                	test   %eax,%eax
+  801370:	7f 6c                	jg     8013de <sys_page_copy+0xad>
+}
+  801372:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801375:	5b                   	pop    %ebx
+  801376:	5e                   	pop    %esi
+  801377:	5f                   	pop    %edi
+  801378:	5d                   	pop    %ebp
+  801379:	c3                   	ret
+  80137a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80137f:	0f a2                	cpuid
+		return 0;
+  801381:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801386:	f6 c6 08             	test   $0x8,%dh
+  801389:	74 15                	je     8013a0 <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80138b:	89 c2                	mov    %eax,%edx
+  80138d:	c1 ea 08             	shr    $0x8,%edx
+  801390:	83 e2 0f             	and    $0xf,%edx
+  801393:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801398:	83 fa 06             	cmp    $0x6,%edx
+  80139b:	74 0e                	je     8013ab <sys_page_copy+0x7a>
+  80139d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8013a0:	0f b6 c9             	movzbl %cl,%ecx
+  8013a3:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8013a9:	eb 98                	jmp    801343 <sys_page_copy+0x12>
+  8013ab:	89 c2                	mov    %eax,%edx
+  8013ad:	c1 ea 04             	shr    $0x4,%edx
+  8013b0:	83 e2 0f             	and    $0xf,%edx
+  8013b3:	83 fa 02             	cmp    $0x2,%edx
+  8013b6:	77 e5                	ja     80139d <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  8013b8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013bb:	83 f8 02             	cmp    $0x2,%eax
+  8013be:	0f 97 c1             	seta   %cl
+  8013c1:	0f b6 c9             	movzbl %cl,%ecx
+  8013c4:	eb d7                	jmp    80139d <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  8013c6:	b8 29 00 00 00       	mov    $0x29,%eax
+  8013cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013d4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013d7:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013da:	cd 30                	int    $0x30
+  8013dc:	eb 90                	jmp    80136e <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013de:	83 ec 0c             	sub    $0xc,%esp
+  8013e1:	50                   	push   %eax
+  8013e2:	6a 29                	push   $0x29
+  8013e4:	68 39 33 80 00       	push   $0x803339
+  8013e9:	6a 4a                	push   $0x4a
+  8013eb:	68 56 33 80 00       	push   $0x803356
+  8013f0:	e8 b7 ed ff ff       	call   8001ac <_panic>
+
+008013f5 <sys_yield>:
+{
+  8013f5:	55                   	push   %ebp
+  8013f6:	89 e5                	mov    %esp,%ebp
+  8013f8:	57                   	push   %edi
+  8013f9:	56                   	push   %esi
+  8013fa:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8013fb:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801402:	78 2e                	js     801432 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  801404:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80140b:	74 71                	je     80147e <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  80140d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801412:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801417:	89 d1                	mov    %edx,%ecx
+  801419:	89 d3                	mov    %edx,%ebx
+  80141b:	89 d7                	mov    %edx,%edi
+  80141d:	89 d6                	mov    %edx,%esi
+  80141f:	55                   	push   %ebp
+  801420:	68 29 14 80 00       	push   $0x801429
+  801425:	89 e5                	mov    %esp,%ebp
+  801427:	0f 34                	sysenter
+  801429:	83 c4 04             	add    $0x4,%esp
+  80142c:	5d                   	pop    %ebp
+}
+  80142d:	5b                   	pop    %ebx
+  80142e:	5e                   	pop    %esi
+  80142f:	5f                   	pop    %edi
+  801430:	5d                   	pop    %ebp
+  801431:	c3                   	ret
+  801432:	b8 01 00 00 00       	mov    $0x1,%eax
+  801437:	0f a2                	cpuid
+		return 0;
+  801439:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80143e:	f6 c6 08             	test   $0x8,%dh
+  801441:	74 15                	je     801458 <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801443:	89 c2                	mov    %eax,%edx
+  801445:	c1 ea 08             	shr    $0x8,%edx
+  801448:	83 e2 0f             	and    $0xf,%edx
+  80144b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801450:	83 fa 06             	cmp    $0x6,%edx
+  801453:	74 0e                	je     801463 <sys_yield+0x6e>
+  801455:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801458:	0f b6 c9             	movzbl %cl,%ecx
+  80145b:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801461:	eb a1                	jmp    801404 <sys_yield+0xf>
+  801463:	89 c2                	mov    %eax,%edx
+  801465:	c1 ea 04             	shr    $0x4,%edx
+  801468:	83 e2 0f             	and    $0xf,%edx
+  80146b:	83 fa 02             	cmp    $0x2,%edx
+  80146e:	77 e5                	ja     801455 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  801470:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801473:	83 f8 02             	cmp    $0x2,%eax
+  801476:	0f 97 c1             	seta   %cl
+  801479:	0f b6 c9             	movzbl %cl,%ecx
+  80147c:	eb d7                	jmp    801455 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  80147e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801483:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801488:	89 d1                	mov    %edx,%ecx
+  80148a:	89 d3                	mov    %edx,%ebx
+  80148c:	89 d7                	mov    %edx,%edi
+  80148e:	89 d6                	mov    %edx,%esi
+  801490:	cd 30                	int    $0x30
+}
+  801492:	eb 99                	jmp    80142d <sys_yield+0x38>
+
+00801494 <sys_env_set_status>:
+{
+  801494:	55                   	push   %ebp
+  801495:	89 e5                	mov    %esp,%ebp
+  801497:	57                   	push   %edi
+  801498:	56                   	push   %esi
+  801499:	53                   	push   %ebx
+  80149a:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80149d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8014a4:	78 37                	js     8014dd <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  8014a6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8014ad:	74 7a                	je     801529 <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  8014af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ba:	b8 08 00 00 00       	mov    $0x8,%eax
+  8014bf:	89 df                	mov    %ebx,%edi
+  8014c1:	89 de                	mov    %ebx,%esi
+  8014c3:	55                   	push   %ebp
+  8014c4:	68 cd 14 80 00       	push   $0x8014cd
+  8014c9:	89 e5                	mov    %esp,%ebp
+  8014cb:	0f 34                	sysenter
+  8014cd:	83 c4 04             	add    $0x4,%esp
+  8014d0:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8014d1:	85 c0                	test   %eax,%eax
+  8014d3:	7f 6c                	jg     801541 <sys_env_set_status+0xad>
+}
+  8014d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014d8:	5b                   	pop    %ebx
+  8014d9:	5e                   	pop    %esi
+  8014da:	5f                   	pop    %edi
+  8014db:	5d                   	pop    %ebp
+  8014dc:	c3                   	ret
+  8014dd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014e2:	0f a2                	cpuid
+		return 0;
+  8014e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8014e9:	f6 c6 08             	test   $0x8,%dh
+  8014ec:	74 15                	je     801503 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014ee:	89 c2                	mov    %eax,%edx
+  8014f0:	c1 ea 08             	shr    $0x8,%edx
+  8014f3:	83 e2 0f             	and    $0xf,%edx
+  8014f6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8014fb:	83 fa 06             	cmp    $0x6,%edx
+  8014fe:	74 0e                	je     80150e <sys_env_set_status+0x7a>
+  801500:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801503:	0f b6 c9             	movzbl %cl,%ecx
+  801506:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80150c:	eb 98                	jmp    8014a6 <sys_env_set_status+0x12>
+  80150e:	89 c2                	mov    %eax,%edx
+  801510:	c1 ea 04             	shr    $0x4,%edx
+  801513:	83 e2 0f             	and    $0xf,%edx
+  801516:	83 fa 02             	cmp    $0x2,%edx
+  801519:	77 e5                	ja     801500 <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  80151b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80151e:	83 f8 02             	cmp    $0x2,%eax
+  801521:	0f 97 c1             	seta   %cl
+  801524:	0f b6 c9             	movzbl %cl,%ecx
+  801527:	eb d7                	jmp    801500 <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  801529:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80152e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801533:	8b 55 08             	mov    0x8(%ebp),%edx
+  801536:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801539:	89 df                	mov    %ebx,%edi
+  80153b:	89 de                	mov    %ebx,%esi
+  80153d:	cd 30                	int    $0x30
+  80153f:	eb 90                	jmp    8014d1 <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801541:	83 ec 0c             	sub    $0xc,%esp
+  801544:	50                   	push   %eax
+  801545:	6a 08                	push   $0x8
+  801547:	68 39 33 80 00       	push   $0x803339
+  80154c:	6a 4a                	push   $0x4a
+  80154e:	68 56 33 80 00       	push   $0x803356
+  801553:	e8 54 ec ff ff       	call   8001ac <_panic>
+
+00801558 <sys_sysinfo>:
+{
+  801558:	55                   	push   %ebp
+  801559:	89 e5                	mov    %esp,%ebp
+  80155b:	57                   	push   %edi
+  80155c:	56                   	push   %esi
+  80155d:	53                   	push   %ebx
+  80155e:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801561:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801568:	78 36                	js     8015a0 <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  80156a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801571:	74 79                	je     8015ec <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  801573:	8b 55 08             	mov    0x8(%ebp),%edx
+  801576:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80157b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801580:	89 cb                	mov    %ecx,%ebx
+  801582:	89 cf                	mov    %ecx,%edi
+  801584:	89 ce                	mov    %ecx,%esi
+  801586:	55                   	push   %ebp
+  801587:	68 90 15 80 00       	push   $0x801590
+  80158c:	89 e5                	mov    %esp,%ebp
+  80158e:	0f 34                	sysenter
+  801590:	83 c4 04             	add    $0x4,%esp
+  801593:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801594:	85 c0                	test   %eax,%eax
+  801596:	7f 6b                	jg     801603 <sys_sysinfo+0xab>
+}
+  801598:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80159b:	5b                   	pop    %ebx
+  80159c:	5e                   	pop    %esi
+  80159d:	5f                   	pop    %edi
+  80159e:	5d                   	pop    %ebp
+  80159f:	c3                   	ret
+  8015a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015a5:	0f a2                	cpuid
+		return 0;
+  8015a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8015ac:	f6 c6 08             	test   $0x8,%dh
+  8015af:	74 15                	je     8015c6 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015b1:	89 c2                	mov    %eax,%edx
+  8015b3:	c1 ea 08             	shr    $0x8,%edx
+  8015b6:	83 e2 0f             	and    $0xf,%edx
+  8015b9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8015be:	83 fa 06             	cmp    $0x6,%edx
+  8015c1:	74 0e                	je     8015d1 <sys_sysinfo+0x79>
+  8015c3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8015c6:	0f b6 c9             	movzbl %cl,%ecx
+  8015c9:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8015cf:	eb 99                	jmp    80156a <sys_sysinfo+0x12>
+  8015d1:	89 c2                	mov    %eax,%edx
+  8015d3:	c1 ea 04             	shr    $0x4,%edx
+  8015d6:	83 e2 0f             	and    $0xf,%edx
+  8015d9:	83 fa 02             	cmp    $0x2,%edx
+  8015dc:	77 e5                	ja     8015c3 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  8015de:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015e1:	83 f8 02             	cmp    $0x2,%eax
+  8015e4:	0f 97 c1             	seta   %cl
+  8015e7:	0f b6 c9             	movzbl %cl,%ecx
+  8015ea:	eb d7                	jmp    8015c3 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  8015ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015f1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8015f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f9:	89 cb                	mov    %ecx,%ebx
+  8015fb:	89 cf                	mov    %ecx,%edi
+  8015fd:	89 ce                	mov    %ecx,%esi
+  8015ff:	cd 30                	int    $0x30
+  801601:	eb 91                	jmp    801594 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801603:	83 ec 0c             	sub    $0xc,%esp
+  801606:	50                   	push   %eax
+  801607:	6a 0b                	push   $0xb
+  801609:	68 39 33 80 00       	push   $0x803339
+  80160e:	6a 4a                	push   $0x4a
+  801610:	68 56 33 80 00       	push   $0x803356
+  801615:	e8 92 eb ff ff       	call   8001ac <_panic>
+
+0080161a <sys_env_set_trapframe>:
+{
+  80161a:	55                   	push   %ebp
+  80161b:	89 e5                	mov    %esp,%ebp
+  80161d:	57                   	push   %edi
+  80161e:	56                   	push   %esi
+  80161f:	53                   	push   %ebx
+  801620:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801623:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80162a:	78 37                	js     801663 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  80162c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801633:	74 7a                	je     8016af <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  801635:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80163a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80163d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801640:	b8 13 00 00 00       	mov    $0x13,%eax
+  801645:	89 df                	mov    %ebx,%edi
+  801647:	89 de                	mov    %ebx,%esi
+  801649:	55                   	push   %ebp
+  80164a:	68 53 16 80 00       	push   $0x801653
+  80164f:	89 e5                	mov    %esp,%ebp
+  801651:	0f 34                	sysenter
+  801653:	83 c4 04             	add    $0x4,%esp
+  801656:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801657:	85 c0                	test   %eax,%eax
+  801659:	7f 6c                	jg     8016c7 <sys_env_set_trapframe+0xad>
+}
+  80165b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80165e:	5b                   	pop    %ebx
+  80165f:	5e                   	pop    %esi
+  801660:	5f                   	pop    %edi
+  801661:	5d                   	pop    %ebp
+  801662:	c3                   	ret
+  801663:	b8 01 00 00 00       	mov    $0x1,%eax
+  801668:	0f a2                	cpuid
+		return 0;
+  80166a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80166f:	f6 c6 08             	test   $0x8,%dh
+  801672:	74 15                	je     801689 <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801674:	89 c2                	mov    %eax,%edx
+  801676:	c1 ea 08             	shr    $0x8,%edx
+  801679:	83 e2 0f             	and    $0xf,%edx
+  80167c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801681:	83 fa 06             	cmp    $0x6,%edx
+  801684:	74 0e                	je     801694 <sys_env_set_trapframe+0x7a>
+  801686:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801689:	0f b6 c9             	movzbl %cl,%ecx
+  80168c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801692:	eb 98                	jmp    80162c <sys_env_set_trapframe+0x12>
+  801694:	89 c2                	mov    %eax,%edx
+  801696:	c1 ea 04             	shr    $0x4,%edx
+  801699:	83 e2 0f             	and    $0xf,%edx
+  80169c:	83 fa 02             	cmp    $0x2,%edx
+  80169f:	77 e5                	ja     801686 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  8016a1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016a4:	83 f8 02             	cmp    $0x2,%eax
+  8016a7:	0f 97 c1             	seta   %cl
+  8016aa:	0f b6 c9             	movzbl %cl,%ecx
+  8016ad:	eb d7                	jmp    801686 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  8016af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016b4:	b8 13 00 00 00       	mov    $0x13,%eax
+  8016b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016bf:	89 df                	mov    %ebx,%edi
+  8016c1:	89 de                	mov    %ebx,%esi
+  8016c3:	cd 30                	int    $0x30
+  8016c5:	eb 90                	jmp    801657 <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016c7:	83 ec 0c             	sub    $0xc,%esp
+  8016ca:	50                   	push   %eax
+  8016cb:	6a 13                	push   $0x13
+  8016cd:	68 39 33 80 00       	push   $0x803339
+  8016d2:	6a 4a                	push   $0x4a
+  8016d4:	68 56 33 80 00       	push   $0x803356
+  8016d9:	e8 ce ea ff ff       	call   8001ac <_panic>
+
+008016de <sys_env_set_stack_limit>:
+{
+  8016de:	55                   	push   %ebp
+  8016df:	89 e5                	mov    %esp,%ebp
+  8016e1:	57                   	push   %edi
+  8016e2:	56                   	push   %esi
+  8016e3:	53                   	push   %ebx
+  8016e4:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8016e7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8016ee:	78 37                	js     801727 <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  8016f0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8016f7:	74 7a                	je     801773 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  8016f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801701:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801704:	b8 19 00 00 00       	mov    $0x19,%eax
+  801709:	89 df                	mov    %ebx,%edi
+  80170b:	89 de                	mov    %ebx,%esi
+  80170d:	55                   	push   %ebp
+  80170e:	68 17 17 80 00       	push   $0x801717
+  801713:	89 e5                	mov    %esp,%ebp
+  801715:	0f 34                	sysenter
+  801717:	83 c4 04             	add    $0x4,%esp
+  80171a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80171b:	85 c0                	test   %eax,%eax
+  80171d:	7f 6c                	jg     80178b <sys_env_set_stack_limit+0xad>
+}
+  80171f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801722:	5b                   	pop    %ebx
+  801723:	5e                   	pop    %esi
+  801724:	5f                   	pop    %edi
+  801725:	5d                   	pop    %ebp
+  801726:	c3                   	ret
+  801727:	b8 01 00 00 00       	mov    $0x1,%eax
+  80172c:	0f a2                	cpuid
+		return 0;
+  80172e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801733:	f6 c6 08             	test   $0x8,%dh
+  801736:	74 15                	je     80174d <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801738:	89 c2                	mov    %eax,%edx
+  80173a:	c1 ea 08             	shr    $0x8,%edx
+  80173d:	83 e2 0f             	and    $0xf,%edx
+  801740:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801745:	83 fa 06             	cmp    $0x6,%edx
+  801748:	74 0e                	je     801758 <sys_env_set_stack_limit+0x7a>
+  80174a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80174d:	0f b6 c9             	movzbl %cl,%ecx
+  801750:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801756:	eb 98                	jmp    8016f0 <sys_env_set_stack_limit+0x12>
+  801758:	89 c2                	mov    %eax,%edx
+  80175a:	c1 ea 04             	shr    $0x4,%edx
+  80175d:	83 e2 0f             	and    $0xf,%edx
+  801760:	83 fa 02             	cmp    $0x2,%edx
+  801763:	77 e5                	ja     80174a <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  801765:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801768:	83 f8 02             	cmp    $0x2,%eax
+  80176b:	0f 97 c1             	seta   %cl
+  80176e:	0f b6 c9             	movzbl %cl,%ecx
+  801771:	eb d7                	jmp    80174a <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  801773:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801778:	b8 19 00 00 00       	mov    $0x19,%eax
+  80177d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801780:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801783:	89 df                	mov    %ebx,%edi
+  801785:	89 de                	mov    %ebx,%esi
+  801787:	cd 30                	int    $0x30
+  801789:	eb 90                	jmp    80171b <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80178b:	83 ec 0c             	sub    $0xc,%esp
+  80178e:	50                   	push   %eax
+  80178f:	6a 19                	push   $0x19
+  801791:	68 39 33 80 00       	push   $0x803339
+  801796:	6a 4a                	push   $0x4a
+  801798:	68 56 33 80 00       	push   $0x803356
+  80179d:	e8 0a ea ff ff       	call   8001ac <_panic>
+
+008017a2 <sys_env_set_pgfault_upcall>:
+{
+  8017a2:	55                   	push   %ebp
+  8017a3:	89 e5                	mov    %esp,%ebp
+  8017a5:	57                   	push   %edi
+  8017a6:	56                   	push   %esi
+  8017a7:	53                   	push   %ebx
+  8017a8:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8017ab:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8017b2:	78 37                	js     8017eb <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  8017b4:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8017bb:	74 7a                	je     801837 <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  8017bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017c8:	b8 09 00 00 00       	mov    $0x9,%eax
+  8017cd:	89 df                	mov    %ebx,%edi
+  8017cf:	89 de                	mov    %ebx,%esi
+  8017d1:	55                   	push   %ebp
+  8017d2:	68 db 17 80 00       	push   $0x8017db
+  8017d7:	89 e5                	mov    %esp,%ebp
+  8017d9:	0f 34                	sysenter
+  8017db:	83 c4 04             	add    $0x4,%esp
+  8017de:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8017df:	85 c0                	test   %eax,%eax
+  8017e1:	7f 6c                	jg     80184f <sys_env_set_pgfault_upcall+0xad>
+}
+  8017e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017e6:	5b                   	pop    %ebx
+  8017e7:	5e                   	pop    %esi
+  8017e8:	5f                   	pop    %edi
+  8017e9:	5d                   	pop    %ebp
+  8017ea:	c3                   	ret
+  8017eb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8017f0:	0f a2                	cpuid
+		return 0;
+  8017f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8017f7:	f6 c6 08             	test   $0x8,%dh
+  8017fa:	74 15                	je     801811 <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017fc:	89 c2                	mov    %eax,%edx
+  8017fe:	c1 ea 08             	shr    $0x8,%edx
+  801801:	83 e2 0f             	and    $0xf,%edx
+  801804:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801809:	83 fa 06             	cmp    $0x6,%edx
+  80180c:	74 0e                	je     80181c <sys_env_set_pgfault_upcall+0x7a>
+  80180e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801811:	0f b6 c9             	movzbl %cl,%ecx
+  801814:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80181a:	eb 98                	jmp    8017b4 <sys_env_set_pgfault_upcall+0x12>
+  80181c:	89 c2                	mov    %eax,%edx
+  80181e:	c1 ea 04             	shr    $0x4,%edx
+  801821:	83 e2 0f             	and    $0xf,%edx
+  801824:	83 fa 02             	cmp    $0x2,%edx
+  801827:	77 e5                	ja     80180e <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  801829:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80182c:	83 f8 02             	cmp    $0x2,%eax
+  80182f:	0f 97 c1             	seta   %cl
+  801832:	0f b6 c9             	movzbl %cl,%ecx
+  801835:	eb d7                	jmp    80180e <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  801837:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80183c:	b8 09 00 00 00       	mov    $0x9,%eax
+  801841:	8b 55 08             	mov    0x8(%ebp),%edx
+  801844:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801847:	89 df                	mov    %ebx,%edi
+  801849:	89 de                	mov    %ebx,%esi
+  80184b:	cd 30                	int    $0x30
+  80184d:	eb 90                	jmp    8017df <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80184f:	83 ec 0c             	sub    $0xc,%esp
+  801852:	50                   	push   %eax
+  801853:	6a 09                	push   $0x9
+  801855:	68 39 33 80 00       	push   $0x803339
+  80185a:	6a 4a                	push   $0x4a
+  80185c:	68 56 33 80 00       	push   $0x803356
+  801861:	e8 46 e9 ff ff       	call   8001ac <_panic>
+
+00801866 <sys_ipc_try_send>:
+{
+  801866:	55                   	push   %ebp
+  801867:	89 e5                	mov    %esp,%ebp
+  801869:	57                   	push   %edi
+  80186a:	56                   	push   %esi
+  80186b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80186c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801873:	78 32                	js     8018a7 <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  801875:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80187c:	74 75                	je     8018f3 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  80187e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801881:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801884:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801889:	be 00 00 00 00       	mov    $0x0,%esi
+  80188e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801891:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801894:	55                   	push   %ebp
+  801895:	68 9e 18 80 00       	push   $0x80189e
+  80189a:	89 e5                	mov    %esp,%ebp
+  80189c:	0f 34                	sysenter
+  80189e:	83 c4 04             	add    $0x4,%esp
+  8018a1:	5d                   	pop    %ebp
+}
+  8018a2:	5b                   	pop    %ebx
+  8018a3:	5e                   	pop    %esi
+  8018a4:	5f                   	pop    %edi
+  8018a5:	5d                   	pop    %ebp
+  8018a6:	c3                   	ret
+  8018a7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018ac:	0f a2                	cpuid
+		return 0;
+  8018ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018b3:	f6 c6 08             	test   $0x8,%dh
+  8018b6:	74 15                	je     8018cd <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018b8:	89 c2                	mov    %eax,%edx
+  8018ba:	c1 ea 08             	shr    $0x8,%edx
+  8018bd:	83 e2 0f             	and    $0xf,%edx
+  8018c0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018c5:	83 fa 06             	cmp    $0x6,%edx
+  8018c8:	74 0e                	je     8018d8 <sys_ipc_try_send+0x72>
+  8018ca:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8018cd:	0f b6 c9             	movzbl %cl,%ecx
+  8018d0:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8018d6:	eb 9d                	jmp    801875 <sys_ipc_try_send+0xf>
+  8018d8:	89 c2                	mov    %eax,%edx
+  8018da:	c1 ea 04             	shr    $0x4,%edx
+  8018dd:	83 e2 0f             	and    $0xf,%edx
+  8018e0:	83 fa 02             	cmp    $0x2,%edx
+  8018e3:	77 e5                	ja     8018ca <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  8018e5:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018e8:	83 f8 02             	cmp    $0x2,%eax
+  8018eb:	0f 97 c1             	seta   %cl
+  8018ee:	0f b6 c9             	movzbl %cl,%ecx
+  8018f1:	eb d7                	jmp    8018ca <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  8018f3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8018f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8018fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801900:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801903:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801906:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801909:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  80190b:	eb 95                	jmp    8018a2 <sys_ipc_try_send+0x3c>
+
+0080190d <sys_ipc_send>:
+{
+  80190d:	55                   	push   %ebp
+  80190e:	89 e5                	mov    %esp,%ebp
+  801910:	57                   	push   %edi
+  801911:	56                   	push   %esi
+  801912:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801913:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80191a:	78 32                	js     80194e <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  80191c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801923:	74 75                	je     80199a <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801925:	8b 55 08             	mov    0x8(%ebp),%edx
+  801928:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80192b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801930:	be 00 00 00 00       	mov    $0x0,%esi
+  801935:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801938:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80193b:	55                   	push   %ebp
+  80193c:	68 45 19 80 00       	push   $0x801945
+  801941:	89 e5                	mov    %esp,%ebp
+  801943:	0f 34                	sysenter
+  801945:	83 c4 04             	add    $0x4,%esp
+  801948:	5d                   	pop    %ebp
+}
+  801949:	5b                   	pop    %ebx
+  80194a:	5e                   	pop    %esi
+  80194b:	5f                   	pop    %edi
+  80194c:	5d                   	pop    %ebp
+  80194d:	c3                   	ret
+  80194e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801953:	0f a2                	cpuid
+		return 0;
+  801955:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80195a:	f6 c6 08             	test   $0x8,%dh
+  80195d:	74 15                	je     801974 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80195f:	89 c2                	mov    %eax,%edx
+  801961:	c1 ea 08             	shr    $0x8,%edx
+  801964:	83 e2 0f             	and    $0xf,%edx
+  801967:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80196c:	83 fa 06             	cmp    $0x6,%edx
+  80196f:	74 0e                	je     80197f <sys_ipc_send+0x72>
+  801971:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801974:	0f b6 c9             	movzbl %cl,%ecx
+  801977:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80197d:	eb 9d                	jmp    80191c <sys_ipc_send+0xf>
+  80197f:	89 c2                	mov    %eax,%edx
+  801981:	c1 ea 04             	shr    $0x4,%edx
+  801984:	83 e2 0f             	and    $0xf,%edx
+  801987:	83 fa 02             	cmp    $0x2,%edx
+  80198a:	77 e5                	ja     801971 <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  80198c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80198f:	83 f8 02             	cmp    $0x2,%eax
+  801992:	0f 97 c1             	seta   %cl
+  801995:	0f b6 c9             	movzbl %cl,%ecx
+  801998:	eb d7                	jmp    801971 <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  80199a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80199f:	be 00 00 00 00       	mov    $0x0,%esi
+  8019a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019aa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019ad:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8019b0:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  8019b2:	eb 95                	jmp    801949 <sys_ipc_send+0x3c>
+
+008019b4 <sys_ipc_recv>:
+{
+  8019b4:	55                   	push   %ebp
+  8019b5:	89 e5                	mov    %esp,%ebp
+  8019b7:	57                   	push   %edi
+  8019b8:	56                   	push   %esi
+  8019b9:	53                   	push   %ebx
+  8019ba:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8019bd:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8019c4:	78 36                	js     8019fc <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  8019c6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8019cd:	74 79                	je     801a48 <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  8019cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019d7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8019dc:	89 cb                	mov    %ecx,%ebx
+  8019de:	89 cf                	mov    %ecx,%edi
+  8019e0:	89 ce                	mov    %ecx,%esi
+  8019e2:	55                   	push   %ebp
+  8019e3:	68 ec 19 80 00       	push   $0x8019ec
+  8019e8:	89 e5                	mov    %esp,%ebp
+  8019ea:	0f 34                	sysenter
+  8019ec:	83 c4 04             	add    $0x4,%esp
+  8019ef:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8019f0:	85 c0                	test   %eax,%eax
+  8019f2:	7f 6b                	jg     801a5f <sys_ipc_recv+0xab>
+}
+  8019f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019f7:	5b                   	pop    %ebx
+  8019f8:	5e                   	pop    %esi
+  8019f9:	5f                   	pop    %edi
+  8019fa:	5d                   	pop    %ebp
+  8019fb:	c3                   	ret
+  8019fc:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a01:	0f a2                	cpuid
+		return 0;
+  801a03:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801a08:	f6 c6 08             	test   $0x8,%dh
+  801a0b:	74 15                	je     801a22 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a0d:	89 c2                	mov    %eax,%edx
+  801a0f:	c1 ea 08             	shr    $0x8,%edx
+  801a12:	83 e2 0f             	and    $0xf,%edx
+  801a15:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a1a:	83 fa 06             	cmp    $0x6,%edx
+  801a1d:	74 0e                	je     801a2d <sys_ipc_recv+0x79>
+  801a1f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a22:	0f b6 c9             	movzbl %cl,%ecx
+  801a25:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801a2b:	eb 99                	jmp    8019c6 <sys_ipc_recv+0x12>
+  801a2d:	89 c2                	mov    %eax,%edx
+  801a2f:	c1 ea 04             	shr    $0x4,%edx
+  801a32:	83 e2 0f             	and    $0xf,%edx
+  801a35:	83 fa 02             	cmp    $0x2,%edx
+  801a38:	77 e5                	ja     801a1f <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  801a3a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a3d:	83 f8 02             	cmp    $0x2,%eax
+  801a40:	0f 97 c1             	seta   %cl
+  801a43:	0f b6 c9             	movzbl %cl,%ecx
+  801a46:	eb d7                	jmp    801a1f <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  801a48:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a4d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801a52:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a55:	89 cb                	mov    %ecx,%ebx
+  801a57:	89 cf                	mov    %ecx,%edi
+  801a59:	89 ce                	mov    %ecx,%esi
+  801a5b:	cd 30                	int    $0x30
+  801a5d:	eb 91                	jmp    8019f0 <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a5f:	83 ec 0c             	sub    $0xc,%esp
+  801a62:	50                   	push   %eax
+  801a63:	6a 0d                	push   $0xd
+  801a65:	68 39 33 80 00       	push   $0x803339
+  801a6a:	6a 4a                	push   $0x4a
+  801a6c:	68 56 33 80 00       	push   $0x803356
+  801a71:	e8 36 e7 ff ff       	call   8001ac <_panic>
+
+00801a76 <sys_ipc_send_range>:
+{
+  801a76:	55                   	push   %ebp
+  801a77:	89 e5                	mov    %esp,%ebp
+  801a79:	57                   	push   %edi
+  801a7a:	56                   	push   %esi
+  801a7b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801a7c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a83:	78 30                	js     801ab5 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  801a85:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a8c:	74 73                	je     801b01 <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801a8e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a91:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a94:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801a99:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a9c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a9f:	8b 75 18             	mov    0x18(%ebp),%esi
+  801aa2:	55                   	push   %ebp
+  801aa3:	68 ac 1a 80 00       	push   $0x801aac
+  801aa8:	89 e5                	mov    %esp,%ebp
+  801aaa:	0f 34                	sysenter
+  801aac:	83 c4 04             	add    $0x4,%esp
+  801aaf:	5d                   	pop    %ebp
+}
+  801ab0:	5b                   	pop    %ebx
+  801ab1:	5e                   	pop    %esi
+  801ab2:	5f                   	pop    %edi
+  801ab3:	5d                   	pop    %ebp
+  801ab4:	c3                   	ret
+  801ab5:	b8 01 00 00 00       	mov    $0x1,%eax
+  801aba:	0f a2                	cpuid
+		return 0;
+  801abc:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801ac1:	f6 c6 08             	test   $0x8,%dh
+  801ac4:	74 15                	je     801adb <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ac6:	89 c2                	mov    %eax,%edx
+  801ac8:	c1 ea 08             	shr    $0x8,%edx
+  801acb:	83 e2 0f             	and    $0xf,%edx
+  801ace:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ad3:	83 fa 06             	cmp    $0x6,%edx
+  801ad6:	74 0e                	je     801ae6 <sys_ipc_send_range+0x70>
+  801ad8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801adb:	0f b6 c9             	movzbl %cl,%ecx
+  801ade:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801ae4:	eb 9f                	jmp    801a85 <sys_ipc_send_range+0xf>
+  801ae6:	89 c2                	mov    %eax,%edx
+  801ae8:	c1 ea 04             	shr    $0x4,%edx
+  801aeb:	83 e2 0f             	and    $0xf,%edx
+  801aee:	83 fa 02             	cmp    $0x2,%edx
+  801af1:	77 e5                	ja     801ad8 <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  801af3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801af6:	83 f8 02             	cmp    $0x2,%eax
+  801af9:	0f 97 c1             	seta   %cl
+  801afc:	0f b6 c9             	movzbl %cl,%ecx
+  801aff:	eb d7                	jmp    801ad8 <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  801b01:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801b06:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b09:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b0c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b0f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801b12:	8b 75 18             	mov    0x18(%ebp),%esi
+  801b15:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  801b17:	eb 97                	jmp    801ab0 <sys_ipc_send_range+0x3a>
+
+00801b19 <sys_ipc_recv_range>:
+{
+  801b19:	55                   	push   %ebp
+  801b1a:	89 e5                	mov    %esp,%ebp
+  801b1c:	57                   	push   %edi
+  801b1d:	56                   	push   %esi
+  801b1e:	53                   	push   %ebx
+  801b1f:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801b22:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b29:	78 37                	js     801b62 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  801b2b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b32:	74 7a                	je     801bae <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  801b34:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b39:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b3f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801b44:	89 df                	mov    %ebx,%edi
+  801b46:	89 de                	mov    %ebx,%esi
+  801b48:	55                   	push   %ebp
+  801b49:	68 52 1b 80 00       	push   $0x801b52
+  801b4e:	89 e5                	mov    %esp,%ebp
+  801b50:	0f 34                	sysenter
+  801b52:	83 c4 04             	add    $0x4,%esp
+  801b55:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801b56:	85 c0                	test   %eax,%eax
+  801b58:	7f 6c                	jg     801bc6 <sys_ipc_recv_range+0xad>
+}
+  801b5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b5d:	5b                   	pop    %ebx
+  801b5e:	5e                   	pop    %esi
+  801b5f:	5f                   	pop    %edi
+  801b60:	5d                   	pop    %ebp
+  801b61:	c3                   	ret
+  801b62:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b67:	0f a2                	cpuid
+		return 0;
+  801b69:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b6e:	f6 c6 08             	test   $0x8,%dh
+  801b71:	74 15                	je     801b88 <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b73:	89 c2                	mov    %eax,%edx
+  801b75:	c1 ea 08             	shr    $0x8,%edx
+  801b78:	83 e2 0f             	and    $0xf,%edx
+  801b7b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b80:	83 fa 06             	cmp    $0x6,%edx
+  801b83:	74 0e                	je     801b93 <sys_ipc_recv_range+0x7a>
+  801b85:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b88:	0f b6 c9             	movzbl %cl,%ecx
+  801b8b:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801b91:	eb 98                	jmp    801b2b <sys_ipc_recv_range+0x12>
+  801b93:	89 c2                	mov    %eax,%edx
+  801b95:	c1 ea 04             	shr    $0x4,%edx
+  801b98:	83 e2 0f             	and    $0xf,%edx
+  801b9b:	83 fa 02             	cmp    $0x2,%edx
+  801b9e:	77 e5                	ja     801b85 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801ba0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ba3:	83 f8 02             	cmp    $0x2,%eax
+  801ba6:	0f 97 c1             	seta   %cl
+  801ba9:	0f b6 c9             	movzbl %cl,%ecx
+  801bac:	eb d7                	jmp    801b85 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801bae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bb3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801bb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bbb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bbe:	89 df                	mov    %ebx,%edi
+  801bc0:	89 de                	mov    %ebx,%esi
+  801bc2:	cd 30                	int    $0x30
+  801bc4:	eb 90                	jmp    801b56 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801bc6:	83 ec 0c             	sub    $0xc,%esp
+  801bc9:	50                   	push   %eax
+  801bca:	6a 1f                	push   $0x1f
+  801bcc:	68 39 33 80 00       	push   $0x803339
+  801bd1:	6a 4a                	push   $0x4a
+  801bd3:	68 56 33 80 00       	push   $0x803356
+  801bd8:	e8 cf e5 ff ff       	call   8001ac <_panic>
+
+00801bdd <sys_ipc_call>:
+{
+  801bdd:	55                   	push   %ebp
+  801bde:	89 e5                	mov    %esp,%ebp
+  801be0:	57                   	push   %edi
+  801be1:	56                   	push   %esi
+  801be2:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801be3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801be6:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801beb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801bee:	55                   	push   %ebp
+  801bef:	56                   	push   %esi
+  801bf0:	8b 0e                	mov    (%esi),%ecx
+  801bf2:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801bf5:	8b 7e 08             	mov    0x8(%esi),%edi
+  801bf8:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801bfb:	8b 76 0c             	mov    0xc(%esi),%esi
+  801bfe:	cd 30                	int    $0x30
+  801c00:	87 34 24             	xchg   %esi,(%esp)
+  801c03:	89 0e                	mov    %ecx,(%esi)
+  801c05:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801c08:	89 7e 08             	mov    %edi,0x8(%esi)
+  801c0b:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801c0e:	8f 46 0c             	pop    0xc(%esi)
+  801c11:	5d                   	pop    %ebp
+}
+  801c12:	5b                   	pop    %ebx
+  801c13:	5e                   	pop    %esi
+  801c14:	5f                   	pop    %edi
+  801c15:	5d                   	pop    %ebp
+  801c16:	c3                   	ret
+
+00801c17 <sys_ipc_reply_wait>:
+{
+  801c17:	55                   	push   %ebp
+  801c18:	89 e5                	mov    %esp,%ebp
+  801c1a:	57                   	push   %edi
+  801c1b:	56                   	push   %esi
+  801c1c:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801c1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c20:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801c25:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801c28:	55                   	push   %ebp
+  801c29:	56                   	push   %esi
+  801c2a:	8b 0e                	mov    (%esi),%ecx
+  801c2c:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801c2f:	8b 7e 08             	mov    0x8(%esi),%edi
+  801c32:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801c35:	8b 76 0c             	mov    0xc(%esi),%esi
+  801c38:	cd 30                	int    $0x30
+  801c3a:	87 34 24             	xchg   %esi,(%esp)
+  801c3d:	89 0e                	mov    %ecx,(%esi)
+  801c3f:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801c42:	89 7e 08             	mov    %edi,0x8(%esi)
+  801c45:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801c48:	8f 46 0c             	pop    0xc(%esi)
+  801c4b:	5d                   	pop    %ebp
+}
+  801c4c:	5b                   	pop    %ebx
+  801c4d:	5e                   	pop    %esi
+  801c4e:	5f                   	pop    %edi
+  801c4f:	5d                   	pop    %ebp
+  801c50:	c3                   	ret
+
+00801c51 <sys_ipc_send_msg>:
+{
+  801c51:	55                   	push   %ebp
+  801c52:	89 e5                	mov    %esp,%ebp
+  801c54:	57                   	push   %edi
+  801c55:	56                   	push   %esi
+  801c56:	53                   	push   %ebx
+  801c57:	83 ec 20             	sub    $0x20,%esp
+  801c5a:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801c5d:	8b 10                	mov    (%eax),%edx
+  801c5f:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801c62:	8b 50 04             	mov    0x4(%eax),%edx
+  801c65:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801c68:	8b 50 08             	mov    0x8(%eax),%edx
+  801c6b:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801c6e:	8b 50 0c             	mov    0xc(%eax),%edx
+  801c71:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801c74:	8b 40 10             	mov    0x10(%eax),%eax
+  801c77:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801c7a:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801c7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c80:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801c85:	55                   	push   %ebp
+  801c86:	56                   	push   %esi
+  801c87:	8b 0e                	mov    (%esi),%ecx
+  801c89:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801c8c:	8b 7e 08             	mov    0x8(%esi),%edi
+  801c8f:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801c92:	8b 76 0c             	mov    0xc(%esi),%esi
+  801c95:	cd 30                	int    $0x30
+  801c97:	87 34 24             	xchg   %esi,(%esp)
+  801c9a:	89 0e                	mov    %ecx,(%esi)
+  801c9c:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801c9f:	89 7e 08             	mov    %edi,0x8(%esi)
+  801ca2:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801ca5:	8f 46 0c             	pop    0xc(%esi)
+  801ca8:	5d                   	pop    %ebp
+}
+  801ca9:	83 c4 20             	add    $0x20,%esp
+  801cac:	5b                   	pop    %ebx
+  801cad:	5e                   	pop    %esi
+  801cae:	5f                   	pop    %edi
+  801caf:	5d                   	pop    %ebp
+  801cb0:	c3                   	ret
+
+00801cb1 <sys_fork>:
+{
+  801cb1:	55                   	push   %ebp
+  801cb2:	89 e5                	mov    %esp,%ebp
+  801cb4:	57                   	push   %edi
+  801cb5:	56                   	push   %esi
+  801cb6:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801cb7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801cbe:	78 2e                	js     801cee <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801cc0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801cc7:	74 71                	je     801d3a <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801cc9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cce:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801cd3:	89 d1                	mov    %edx,%ecx
+  801cd5:	89 d3                	mov    %edx,%ebx
+  801cd7:	89 d7                	mov    %edx,%edi
+  801cd9:	89 d6                	mov    %edx,%esi
+  801cdb:	55                   	push   %ebp
+  801cdc:	68 e5 1c 80 00       	push   $0x801ce5
+  801ce1:	89 e5                	mov    %esp,%ebp
+  801ce3:	0f 34                	sysenter
+  801ce5:	83 c4 04             	add    $0x4,%esp
+  801ce8:	5d                   	pop    %ebp
+}
+  801ce9:	5b                   	pop    %ebx
+  801cea:	5e                   	pop    %esi
+  801ceb:	5f                   	pop    %edi
+  801cec:	5d                   	pop    %ebp
+  801ced:	c3                   	ret
+  801cee:	b8 01 00 00 00       	mov    $0x1,%eax
+  801cf3:	0f a2                	cpuid
+		return 0;
+  801cf5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801cfa:	f6 c6 08             	test   $0x8,%dh
+  801cfd:	74 15                	je     801d14 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801cff:	89 c2                	mov    %eax,%edx
+  801d01:	c1 ea 08             	shr    $0x8,%edx
+  801d04:	83 e2 0f             	and    $0xf,%edx
+  801d07:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d0c:	83 fa 06             	cmp    $0x6,%edx
+  801d0f:	74 0e                	je     801d1f <sys_fork+0x6e>
+  801d11:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801d14:	0f b6 c9             	movzbl %cl,%ecx
+  801d17:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801d1d:	eb a1                	jmp    801cc0 <sys_fork+0xf>
+  801d1f:	89 c2                	mov    %eax,%edx
+  801d21:	c1 ea 04             	shr    $0x4,%edx
+  801d24:	83 e2 0f             	and    $0xf,%edx
+  801d27:	83 fa 02             	cmp    $0x2,%edx
+  801d2a:	77 e5                	ja     801d11 <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801d2c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d2f:	83 f8 02             	cmp    $0x2,%eax
+  801d32:	0f 97 c1             	seta   %cl
+  801d35:	0f b6 c9             	movzbl %cl,%ecx
+  801d38:	eb d7                	jmp    801d11 <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801d3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d3f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801d44:	89 d1                	mov    %edx,%ecx
+  801d46:	89 d3                	mov    %edx,%ebx
+  801d48:	89 d7                	mov    %edx,%edi
+  801d4a:	89 d6                	mov    %edx,%esi
+  801d4c:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801d4e:	eb 99                	jmp    801ce9 <sys_fork+0x38>
+
+00801d50 <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801d50:	55                   	push   %ebp
+  801d51:	89 e5                	mov    %esp,%ebp
+  801d53:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801d56:	ff 75 14             	push   0x14(%ebp)
+  801d59:	ff 75 10             	push   0x10(%ebp)
+  801d5c:	ff 75 0c             	push   0xc(%ebp)
+  801d5f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d64:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d67:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801d6c:	e8 81 ee ff ff       	call   800bf2 <page_vec_call>
+}
+  801d71:	c9                   	leave
+  801d72:	c3                   	ret
+
+00801d73 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801d73:	55                   	push   %ebp
+  801d74:	89 e5                	mov    %esp,%ebp
+  801d76:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801d79:	ff 75 18             	push   0x18(%ebp)
+  801d7c:	ff 75 14             	push   0x14(%ebp)
+  801d7f:	ff 75 10             	push   0x10(%ebp)
+  801d82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d85:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d88:	b8 10 00 00 00       	mov    $0x10,%eax
+  801d8d:	e8 60 ee ff ff       	call   800bf2 <page_vec_call>
+}
+  801d92:	c9                   	leave
+  801d93:	c3                   	ret
+
+00801d94 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801d94:	55                   	push   %ebp
+  801d95:	89 e5                	mov    %esp,%ebp
+  801d97:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801d9a:	ff 75 14             	push   0x14(%ebp)
+  801d9d:	ff 75 10             	push   0x10(%ebp)
+  801da0:	ff 75 0c             	push   0xc(%ebp)
+  801da3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801da8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801dab:	b8 11 00 00 00       	mov    $0x11,%eax
+  801db0:	e8 3d ee ff ff       	call   800bf2 <page_vec_call>
+}
+  801db5:	c9                   	leave
+  801db6:	c3                   	ret
+
+00801db7 <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801db7:	55                   	push   %ebp
+  801db8:	89 e5                	mov    %esp,%ebp
+  801dba:	57                   	push   %edi
+  801dbb:	56                   	push   %esi
+  801dbc:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801dbd:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801dc4:	78 32                	js     801df8 <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801dc6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801dcd:	74 75                	je     801e44 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801dcf:	8b 55 08             	mov    0x8(%ebp),%edx
+  801dd2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801dd5:	b8 12 00 00 00       	mov    $0x12,%eax
+  801dda:	be 00 00 00 00       	mov    $0x0,%esi
+  801ddf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801de2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801de5:	55                   	push   %ebp
+  801de6:	68 ef 1d 80 00       	push   $0x801def
+  801deb:	89 e5                	mov    %esp,%ebp
+  801ded:	0f 34                	sysenter
+  801def:	83 c4 04             	add    $0x4,%esp
+  801df2:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801df3:	5b                   	pop    %ebx
+  801df4:	5e                   	pop    %esi
+  801df5:	5f                   	pop    %edi
+  801df6:	5d                   	pop    %ebp
+  801df7:	c3                   	ret
+  801df8:	b8 01 00 00 00       	mov    $0x1,%eax
+  801dfd:	0f a2                	cpuid
+		return 0;
+  801dff:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801e04:	f6 c6 08             	test   $0x8,%dh
+  801e07:	74 15                	je     801e1e <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e09:	89 c2                	mov    %eax,%edx
+  801e0b:	c1 ea 08             	shr    $0x8,%edx
+  801e0e:	83 e2 0f             	and    $0xf,%edx
+  801e11:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e16:	83 fa 06             	cmp    $0x6,%edx
+  801e19:	74 0e                	je     801e29 <sys_vm_ranges+0x72>
+  801e1b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801e1e:	0f b6 c9             	movzbl %cl,%ecx
+  801e21:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801e27:	eb 9d                	jmp    801dc6 <sys_vm_ranges+0xf>
+  801e29:	89 c2                	mov    %eax,%edx
+  801e2b:	c1 ea 04             	shr    $0x4,%edx
+  801e2e:	83 e2 0f             	and    $0xf,%edx
+  801e31:	83 fa 02             	cmp    $0x2,%edx
+  801e34:	77 e5                	ja     801e1b <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  801e36:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e39:	83 f8 02             	cmp    $0x2,%eax
+  801e3c:	0f 97 c1             	seta   %cl
+  801e3f:	0f b6 c9             	movzbl %cl,%ecx
+  801e42:	eb d7                	jmp    801e1b <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801e44:	b8 12 00 00 00       	mov    $0x12,%eax
+  801e49:	be 00 00 00 00       	mov    $0x0,%esi
+  801e4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e54:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e57:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801e5a:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801e5c:	eb 95                	jmp    801df3 <sys_vm_ranges+0x3c>
+
+00801e5e <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801e5e:	55                   	push   %ebp
+  801e5f:	89 e5                	mov    %esp,%ebp
+  801e61:	57                   	push   %edi
+  801e62:	56                   	push   %esi
+  801e63:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801e64:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e6b:	78 31                	js     801e9e <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801e6d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e74:	74 74                	je     801eea <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801e76:	be 00 00 00 00       	mov    $0x0,%esi
+  801e7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e7e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e81:	b8 14 00 00 00       	mov    $0x14,%eax
+  801e86:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e89:	89 f7                	mov    %esi,%edi
+  801e8b:	55                   	push   %ebp
+  801e8c:	68 95 1e 80 00       	push   $0x801e95
+  801e91:	89 e5                	mov    %esp,%ebp
+  801e93:	0f 34                	sysenter
+  801e95:	83 c4 04             	add    $0x4,%esp
+  801e98:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801e99:	5b                   	pop    %ebx
+  801e9a:	5e                   	pop    %esi
+  801e9b:	5f                   	pop    %edi
+  801e9c:	5d                   	pop    %ebp
+  801e9d:	c3                   	ret
+  801e9e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ea3:	0f a2                	cpuid
+		return 0;
+  801ea5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801eaa:	f6 c6 08             	test   $0x8,%dh
+  801ead:	74 15                	je     801ec4 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801eaf:	89 c2                	mov    %eax,%edx
+  801eb1:	c1 ea 08             	shr    $0x8,%edx
+  801eb4:	83 e2 0f             	and    $0xf,%edx
+  801eb7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ebc:	83 fa 06             	cmp    $0x6,%edx
+  801ebf:	74 0e                	je     801ecf <sys_spawn+0x71>
+  801ec1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801ec4:	0f b6 c9             	movzbl %cl,%ecx
+  801ec7:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801ecd:	eb 9e                	jmp    801e6d <sys_spawn+0xf>
+  801ecf:	89 c2                	mov    %eax,%edx
+  801ed1:	c1 ea 04             	shr    $0x4,%edx
+  801ed4:	83 e2 0f             	and    $0xf,%edx
+  801ed7:	83 fa 02             	cmp    $0x2,%edx
+  801eda:	77 e5                	ja     801ec1 <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  801edc:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801edf:	83 f8 02             	cmp    $0x2,%eax
+  801ee2:	0f 97 c1             	seta   %cl
+  801ee5:	0f b6 c9             	movzbl %cl,%ecx
+  801ee8:	eb d7                	jmp    801ec1 <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  801eea:	be 00 00 00 00       	mov    $0x0,%esi
+  801eef:	b8 14 00 00 00       	mov    $0x14,%eax
+  801ef4:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ef7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801efa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801efd:	89 f7                	mov    %esi,%edi
+  801eff:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  801f01:	eb 96                	jmp    801e99 <sys_spawn+0x3b>
+
+00801f03 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  801f03:	55                   	push   %ebp
+  801f04:	89 e5                	mov    %esp,%ebp
+  801f06:	57                   	push   %edi
+  801f07:	56                   	push   %esi
+  801f08:	53                   	push   %ebx
+  801f09:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801f0c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f13:	78 37                	js     801f4c <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  801f15:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f1c:	74 7a                	je     801f98 <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  801f1e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f23:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f26:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f29:	b8 15 00 00 00       	mov    $0x15,%eax
+  801f2e:	89 df                	mov    %ebx,%edi
+  801f30:	89 de                	mov    %ebx,%esi
+  801f32:	55                   	push   %ebp
+  801f33:	68 3c 1f 80 00       	push   $0x801f3c
+  801f38:	89 e5                	mov    %esp,%ebp
+  801f3a:	0f 34                	sysenter
+  801f3c:	83 c4 04             	add    $0x4,%esp
+  801f3f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801f40:	85 c0                	test   %eax,%eax
+  801f42:	7f 6c                	jg     801fb0 <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  801f44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f47:	5b                   	pop    %ebx
+  801f48:	5e                   	pop    %esi
+  801f49:	5f                   	pop    %edi
+  801f4a:	5d                   	pop    %ebp
+  801f4b:	c3                   	ret
+  801f4c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f51:	0f a2                	cpuid
+		return 0;
+  801f53:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801f58:	f6 c6 08             	test   $0x8,%dh
+  801f5b:	74 15                	je     801f72 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f5d:	89 c2                	mov    %eax,%edx
+  801f5f:	c1 ea 08             	shr    $0x8,%edx
+  801f62:	83 e2 0f             	and    $0xf,%edx
+  801f65:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f6a:	83 fa 06             	cmp    $0x6,%edx
+  801f6d:	74 0e                	je     801f7d <sys_shm_create+0x7a>
+  801f6f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801f72:	0f b6 c9             	movzbl %cl,%ecx
+  801f75:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801f7b:	eb 98                	jmp    801f15 <sys_shm_create+0x12>
+  801f7d:	89 c2                	mov    %eax,%edx
+  801f7f:	c1 ea 04             	shr    $0x4,%edx
+  801f82:	83 e2 0f             	and    $0xf,%edx
+  801f85:	83 fa 02             	cmp    $0x2,%edx
+  801f88:	77 e5                	ja     801f6f <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  801f8a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f8d:	83 f8 02             	cmp    $0x2,%eax
+  801f90:	0f 97 c1             	seta   %cl
+  801f93:	0f b6 c9             	movzbl %cl,%ecx
+  801f96:	eb d7                	jmp    801f6f <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  801f98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f9d:	b8 15 00 00 00       	mov    $0x15,%eax
+  801fa2:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fa5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fa8:	89 df                	mov    %ebx,%edi
+  801faa:	89 de                	mov    %ebx,%esi
+  801fac:	cd 30                	int    $0x30
+  801fae:	eb 90                	jmp    801f40 <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801fb0:	83 ec 0c             	sub    $0xc,%esp
+  801fb3:	50                   	push   %eax
+  801fb4:	6a 15                	push   $0x15
+  801fb6:	68 39 33 80 00       	push   $0x803339
+  801fbb:	6a 4a                	push   $0x4a
+  801fbd:	68 56 33 80 00       	push   $0x803356
+  801fc2:	e8 e5 e1 ff ff       	call   8001ac <_panic>
+
+00801fc7 <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  801fc7:	55                   	push   %ebp
+  801fc8:	89 e5                	mov    %esp,%ebp
+  801fca:	57                   	push   %edi
+  801fcb:	56                   	push   %esi
+  801fcc:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801fcd:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801fd4:	78 32                	js     802008 <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  801fd6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801fdd:	74 75                	je     802054 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801fdf:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fe2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fe5:	b8 16 00 00 00       	mov    $0x16,%eax
+  801fea:	be 00 00 00 00       	mov    $0x0,%esi
+  801fef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ff2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ff5:	55                   	push   %ebp
+  801ff6:	68 ff 1f 80 00       	push   $0x801fff
+  801ffb:	89 e5                	mov    %esp,%ebp
+  801ffd:	0f 34                	sysenter
+  801fff:	83 c4 04             	add    $0x4,%esp
+  802002:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  802003:	5b                   	pop    %ebx
+  802004:	5e                   	pop    %esi
+  802005:	5f                   	pop    %edi
+  802006:	5d                   	pop    %ebp
+  802007:	c3                   	ret
+  802008:	b8 01 00 00 00       	mov    $0x1,%eax
+  80200d:	0f a2                	cpuid
+		return 0;
+  80200f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802014:	f6 c6 08             	test   $0x8,%dh
+  802017:	74 15                	je     80202e <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802019:	89 c2                	mov    %eax,%edx
+  80201b:	c1 ea 08             	shr    $0x8,%edx
+  80201e:	83 e2 0f             	and    $0xf,%edx
+  802021:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802026:	83 fa 06             	cmp    $0x6,%edx
+  802029:	74 0e                	je     802039 <sys_shm_attach+0x72>
+  80202b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80202e:	0f b6 c9             	movzbl %cl,%ecx
+  802031:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802037:	eb 9d                	jmp    801fd6 <sys_shm_attach+0xf>
+  802039:	89 c2                	mov    %eax,%edx
+  80203b:	c1 ea 04             	shr    $0x4,%edx
+  80203e:	83 e2 0f             	and    $0xf,%edx
+  802041:	83 fa 02             	cmp    $0x2,%edx
+  802044:	77 e5                	ja     80202b <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  802046:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802049:	83 f8 02             	cmp    $0x2,%eax
+  80204c:	0f 97 c1             	seta   %cl
+  80204f:	0f b6 c9             	movzbl %cl,%ecx
+  802052:	eb d7                	jmp    80202b <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  802054:	b8 16 00 00 00       	mov    $0x16,%eax
+  802059:	be 00 00 00 00       	mov    $0x0,%esi
+  80205e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802061:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802064:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802067:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80206a:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  80206c:	eb 95                	jmp    802003 <sys_shm_attach+0x3c>
+
+0080206e <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  80206e:	55                   	push   %ebp
+  80206f:	89 e5                	mov    %esp,%ebp
+  802071:	57                   	push   %edi
+  802072:	56                   	push   %esi
+  802073:	53                   	push   %ebx
+  802074:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802077:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80207e:	78 38                	js     8020b8 <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  802080:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802087:	74 7b                	je     802104 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  802089:	be 00 00 00 00       	mov    $0x0,%esi
+  80208e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802091:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802094:	b8 17 00 00 00       	mov    $0x17,%eax
+  802099:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80209c:	89 f7                	mov    %esi,%edi
+  80209e:	55                   	push   %ebp
+  80209f:	68 a8 20 80 00       	push   $0x8020a8
+  8020a4:	89 e5                	mov    %esp,%ebp
+  8020a6:	0f 34                	sysenter
+  8020a8:	83 c4 04             	add    $0x4,%esp
+  8020ab:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8020ac:	85 c0                	test   %eax,%eax
+  8020ae:	7f 6d                	jg     80211d <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  8020b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020b3:	5b                   	pop    %ebx
+  8020b4:	5e                   	pop    %esi
+  8020b5:	5f                   	pop    %edi
+  8020b6:	5d                   	pop    %ebp
+  8020b7:	c3                   	ret
+  8020b8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020bd:	0f a2                	cpuid
+		return 0;
+  8020bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8020c4:	f6 c6 08             	test   $0x8,%dh
+  8020c7:	74 15                	je     8020de <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020c9:	89 c2                	mov    %eax,%edx
+  8020cb:	c1 ea 08             	shr    $0x8,%edx
+  8020ce:	83 e2 0f             	and    $0xf,%edx
+  8020d1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8020d6:	83 fa 06             	cmp    $0x6,%edx
+  8020d9:	74 0e                	je     8020e9 <sys_shm_detach+0x7b>
+  8020db:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8020de:	0f b6 c9             	movzbl %cl,%ecx
+  8020e1:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8020e7:	eb 97                	jmp    802080 <sys_shm_detach+0x12>
+  8020e9:	89 c2                	mov    %eax,%edx
+  8020eb:	c1 ea 04             	shr    $0x4,%edx
+  8020ee:	83 e2 0f             	and    $0xf,%edx
+  8020f1:	83 fa 02             	cmp    $0x2,%edx
+  8020f4:	77 e5                	ja     8020db <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  8020f6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020f9:	83 f8 02             	cmp    $0x2,%eax
+  8020fc:	0f 97 c1             	seta   %cl
+  8020ff:	0f b6 c9             	movzbl %cl,%ecx
+  802102:	eb d7                	jmp    8020db <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  802104:	be 00 00 00 00       	mov    $0x0,%esi
+  802109:	b8 17 00 00 00       	mov    $0x17,%eax
+  80210e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802111:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802114:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802117:	89 f7                	mov    %esi,%edi
+  802119:	cd 30                	int    $0x30
+  80211b:	eb 8f                	jmp    8020ac <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80211d:	83 ec 0c             	sub    $0xc,%esp
+  802120:	50                   	push   %eax
+  802121:	6a 17                	push   $0x17
+  802123:	68 39 33 80 00       	push   $0x803339
+  802128:	6a 4a                	push   $0x4a
+  80212a:	68 56 33 80 00       	push   $0x803356
+  80212f:	e8 78 e0 ff ff       	call   8001ac <_panic>
+
+00802134 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  802134:	55                   	push   %ebp
+  802135:	89 e5                	mov    %esp,%ebp
+  802137:	57                   	push   %edi
+  802138:	56                   	push   %esi
+  802139:	53                   	push   %ebx
+  80213a:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80213d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802144:	78 36                	js     80217c <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  802146:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80214d:	74 79                	je     8021c8 <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  80214f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802152:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802157:	b8 18 00 00 00       	mov    $0x18,%eax
+  80215c:	89 cb                	mov    %ecx,%ebx
+  80215e:	89 cf                	mov    %ecx,%edi
+  802160:	89 ce                	mov    %ecx,%esi
+  802162:	55                   	push   %ebp
+  802163:	68 6c 21 80 00       	push   $0x80216c
+  802168:	89 e5                	mov    %esp,%ebp
+  80216a:	0f 34                	sysenter
+  80216c:	83 c4 04             	add    $0x4,%esp
+  80216f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802170:	85 c0                	test   %eax,%eax
+  802172:	7f 6b                	jg     8021df <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  802174:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802177:	5b                   	pop    %ebx
+  802178:	5e                   	pop    %esi
+  802179:	5f                   	pop    %edi
+  80217a:	5d                   	pop    %ebp
+  80217b:	c3                   	ret
+  80217c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802181:	0f a2                	cpuid
+		return 0;
+  802183:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802188:	f6 c6 08             	test   $0x8,%dh
+  80218b:	74 15                	je     8021a2 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80218d:	89 c2                	mov    %eax,%edx
+  80218f:	c1 ea 08             	shr    $0x8,%edx
+  802192:	83 e2 0f             	and    $0xf,%edx
+  802195:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80219a:	83 fa 06             	cmp    $0x6,%edx
+  80219d:	74 0e                	je     8021ad <sys_shm_remove+0x79>
+  80219f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8021a2:	0f b6 c9             	movzbl %cl,%ecx
+  8021a5:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8021ab:	eb 99                	jmp    802146 <sys_shm_remove+0x12>
+  8021ad:	89 c2                	mov    %eax,%edx
+  8021af:	c1 ea 04             	shr    $0x4,%edx
+  8021b2:	83 e2 0f             	and    $0xf,%edx
+  8021b5:	83 fa 02             	cmp    $0x2,%edx
+  8021b8:	77 e5                	ja     80219f <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  8021ba:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021bd:	83 f8 02             	cmp    $0x2,%eax
+  8021c0:	0f 97 c1             	seta   %cl
+  8021c3:	0f b6 c9             	movzbl %cl,%ecx
+  8021c6:	eb d7                	jmp    80219f <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  8021c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021cd:	b8 18 00 00 00       	mov    $0x18,%eax
+  8021d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021d5:	89 cb                	mov    %ecx,%ebx
+  8021d7:	89 cf                	mov    %ecx,%edi
+  8021d9:	89 ce                	mov    %ecx,%esi
+  8021db:	cd 30                	int    $0x30
+  8021dd:	eb 91                	jmp    802170 <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8021df:	83 ec 0c             	sub    $0xc,%esp
+  8021e2:	50                   	push   %eax
+  8021e3:	6a 18                	push   $0x18
+  8021e5:	68 39 33 80 00       	push   $0x803339
+  8021ea:	6a 4a                	push   $0x4a
+  8021ec:	68 56 33 80 00       	push   $0x803356
+  8021f1:	e8 b6 df ff ff       	call   8001ac <_panic>
+
+008021f6 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  8021f6:	55                   	push   %ebp
+  8021f7:	89 e5                	mov    %esp,%ebp
+  8021f9:	57                   	push   %edi
+  8021fa:	56                   	push   %esi
+  8021fb:	53                   	push   %ebx
+  8021fc:	83 ec 0c             	sub    $0xc,%esp
+  8021ff:	8b 45 10             	mov    0x10(%ebp),%eax
+  802202:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802205:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  802208:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80220f:	78 32                	js     802243 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  802211:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802218:	74 75                	je     80228f <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  80221a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80221d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802220:	b8 20 00 00 00       	mov    $0x20,%eax
+  802225:	be 00 00 00 00       	mov    $0x0,%esi
+  80222a:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  80222d:	55                   	push   %ebp
+  80222e:	68 37 22 80 00       	push   $0x802237
+  802233:	89 e5                	mov    %esp,%ebp
+  802235:	0f 34                	sysenter
+  802237:	83 c4 04             	add    $0x4,%esp
+  80223a:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  80223b:	83 c4 0c             	add    $0xc,%esp
+  80223e:	5b                   	pop    %ebx
+  80223f:	5e                   	pop    %esi
+  802240:	5f                   	pop    %edi
+  802241:	5d                   	pop    %ebp
+  802242:	c3                   	ret
+  802243:	b8 01 00 00 00       	mov    $0x1,%eax
+  802248:	0f a2                	cpuid
+		return 0;
+  80224a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80224f:	f6 c6 08             	test   $0x8,%dh
+  802252:	74 15                	je     802269 <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802254:	89 c2                	mov    %eax,%edx
+  802256:	c1 ea 08             	shr    $0x8,%edx
+  802259:	83 e2 0f             	and    $0xf,%edx
+  80225c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802261:	83 fa 06             	cmp    $0x6,%edx
+  802264:	74 0e                	je     802274 <sys_futex_wait+0x7e>
+  802266:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802269:	0f b6 c9             	movzbl %cl,%ecx
+  80226c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802272:	eb 9d                	jmp    802211 <sys_futex_wait+0x1b>
+  802274:	89 c2                	mov    %eax,%edx
+  802276:	c1 ea 04             	shr    $0x4,%edx
+  802279:	83 e2 0f             	and    $0xf,%edx
+  80227c:	83 fa 02             	cmp    $0x2,%edx
+  80227f:	77 e5                	ja     802266 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  802281:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802284:	83 f8 02             	cmp    $0x2,%eax
+  802287:	0f 97 c1             	seta   %cl
+  80228a:	0f b6 c9             	movzbl %cl,%ecx
+  80228d:	eb d7                	jmp    802266 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  80228f:	b8 20 00 00 00       	mov    $0x20,%eax
+  802294:	be 00 00 00 00       	mov    $0x0,%esi
+  802299:	8b 55 08             	mov    0x8(%ebp),%edx
+  80229c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80229f:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8022a2:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  8022a4:	eb 95                	jmp    80223b <sys_futex_wait+0x45>
+
+008022a6 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8022a6:	55                   	push   %ebp
+  8022a7:	89 e5                	mov    %esp,%ebp
+  8022a9:	57                   	push   %edi
+  8022aa:	56                   	push   %esi
+  8022ab:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8022ac:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8022b3:	78 30                	js     8022e5 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  8022b5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8022bc:	74 73                	je     802331 <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  8022be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022c9:	b8 21 00 00 00       	mov    $0x21,%eax
+  8022ce:	89 df                	mov    %ebx,%edi
+  8022d0:	89 de                	mov    %ebx,%esi
+  8022d2:	55                   	push   %ebp
+  8022d3:	68 dc 22 80 00       	push   $0x8022dc
+  8022d8:	89 e5                	mov    %esp,%ebp
+  8022da:	0f 34                	sysenter
+  8022dc:	83 c4 04             	add    $0x4,%esp
+  8022df:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8022e0:	5b                   	pop    %ebx
+  8022e1:	5e                   	pop    %esi
+  8022e2:	5f                   	pop    %edi
+  8022e3:	5d                   	pop    %ebp
+  8022e4:	c3                   	ret
+  8022e5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022ea:	0f a2                	cpuid
+		return 0;
+  8022ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8022f1:	f6 c6 08             	test   $0x8,%dh
+  8022f4:	74 15                	je     80230b <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022f6:	89 c2                	mov    %eax,%edx
+  8022f8:	c1 ea 08             	shr    $0x8,%edx
+  8022fb:	83 e2 0f             	and    $0xf,%edx
+  8022fe:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802303:	83 fa 06             	cmp    $0x6,%edx
+  802306:	74 0e                	je     802316 <sys_futex_wake+0x70>
+  802308:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80230b:	0f b6 c9             	movzbl %cl,%ecx
+  80230e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802314:	eb 9f                	jmp    8022b5 <sys_futex_wake+0xf>
+  802316:	89 c2                	mov    %eax,%edx
+  802318:	c1 ea 04             	shr    $0x4,%edx
+  80231b:	83 e2 0f             	and    $0xf,%edx
+  80231e:	83 fa 02             	cmp    $0x2,%edx
+  802321:	77 e5                	ja     802308 <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  802323:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802326:	83 f8 02             	cmp    $0x2,%eax
+  802329:	0f 97 c1             	seta   %cl
+  80232c:	0f b6 c9             	movzbl %cl,%ecx
+  80232f:	eb d7                	jmp    802308 <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  802331:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802336:	b8 21 00 00 00       	mov    $0x21,%eax
+  80233b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80233e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802341:	89 df                	mov    %ebx,%edi
+  802343:	89 de                	mov    %ebx,%esi
+  802345:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  802347:	eb 97                	jmp    8022e0 <sys_futex_wake+0x3a>
+
+00802349 <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  802349:	55                   	push   %ebp
+  80234a:	89 e5                	mov    %esp,%ebp
+  80234c:	57                   	push   %edi
+  80234d:	56                   	push   %esi
+  80234e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80234f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802356:	78 2e                	js     802386 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  802358:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80235f:	74 71                	je     8023d2 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  802361:	ba 00 00 00 00       	mov    $0x0,%edx
+  802366:	b8 22 00 00 00       	mov    $0x22,%eax
+  80236b:	89 d1                	mov    %edx,%ecx
+  80236d:	89 d3                	mov    %edx,%ebx
+  80236f:	89 d7                	mov    %edx,%edi
+  802371:	89 d6                	mov    %edx,%esi
+  802373:	55                   	push   %ebp
+  802374:	68 7d 23 80 00       	push   $0x80237d
+  802379:	89 e5                	mov    %esp,%ebp
+  80237b:	0f 34                	sysenter
+  80237d:	83 c4 04             	add    $0x4,%esp
+  802380:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  802381:	5b                   	pop    %ebx
+  802382:	5e                   	pop    %esi
+  802383:	5f                   	pop    %edi
+  802384:	5d                   	pop    %ebp
+  802385:	c3                   	ret
+  802386:	b8 01 00 00 00       	mov    $0x1,%eax
+  80238b:	0f a2                	cpuid
+		return 0;
+  80238d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802392:	f6 c6 08             	test   $0x8,%dh
+  802395:	74 15                	je     8023ac <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802397:	89 c2                	mov    %eax,%edx
+  802399:	c1 ea 08             	shr    $0x8,%edx
+  80239c:	83 e2 0f             	and    $0xf,%edx
+  80239f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8023a4:	83 fa 06             	cmp    $0x6,%edx
+  8023a7:	74 0e                	je     8023b7 <sys_ep_create+0x6e>
+  8023a9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8023ac:	0f b6 c9             	movzbl %cl,%ecx
+  8023af:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8023b5:	eb a1                	jmp    802358 <sys_ep_create+0xf>
+  8023b7:	89 c2                	mov    %eax,%edx
+  8023b9:	c1 ea 04             	shr    $0x4,%edx
+  8023bc:	83 e2 0f             	and    $0xf,%edx
+  8023bf:	83 fa 02             	cmp    $0x2,%edx
+  8023c2:	77 e5                	ja     8023a9 <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  8023c4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023c7:	83 f8 02             	cmp    $0x2,%eax
+  8023ca:	0f 97 c1             	seta   %cl
+  8023cd:	0f b6 c9             	movzbl %cl,%ecx
+  8023d0:	eb d7                	jmp    8023a9 <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  8023d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023d7:	b8 22 00 00 00       	mov    $0x22,%eax
+  8023dc:	89 d1                	mov    %edx,%ecx
+  8023de:	89 d3                	mov    %edx,%ebx
+  8023e0:	89 d7                	mov    %edx,%edi
+  8023e2:	89 d6                	mov    %edx,%esi
+  8023e4:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  8023e6:	eb 99                	jmp    802381 <sys_ep_create+0x38>
+
+008023e8 <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  8023e8:	55                   	push   %ebp
+  8023e9:	89 e5                	mov    %esp,%ebp
+  8023eb:	57                   	push   %edi
+  8023ec:	56                   	push   %esi
+  8023ed:	53                   	push   %ebx
+  8023ee:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8023f1:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8023f8:	78 36                	js     802430 <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  8023fa:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802401:	74 79                	je     80247c <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  802403:	8b 55 08             	mov    0x8(%ebp),%edx
+  802406:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80240b:	b8 23 00 00 00       	mov    $0x23,%eax
+  802410:	89 cb                	mov    %ecx,%ebx
+  802412:	89 cf                	mov    %ecx,%edi
+  802414:	89 ce                	mov    %ecx,%esi
+  802416:	55                   	push   %ebp
+  802417:	68 20 24 80 00       	push   $0x802420
+  80241c:	89 e5                	mov    %esp,%ebp
+  80241e:	0f 34                	sysenter
+  802420:	83 c4 04             	add    $0x4,%esp
+  802423:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802424:	85 c0                	test   %eax,%eax
+  802426:	7f 6b                	jg     802493 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  802428:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80242b:	5b                   	pop    %ebx
+  80242c:	5e                   	pop    %esi
+  80242d:	5f                   	pop    %edi
+  80242e:	5d                   	pop    %ebp
+  80242f:	c3                   	ret
+  802430:	b8 01 00 00 00       	mov    $0x1,%eax
+  802435:	0f a2                	cpuid
+		return 0;
+  802437:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80243c:	f6 c6 08             	test   $0x8,%dh
+  80243f:	74 15                	je     802456 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802441:	89 c2                	mov    %eax,%edx
+  802443:	c1 ea 08             	shr    $0x8,%edx
+  802446:	83 e2 0f             	and    $0xf,%edx
+  802449:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80244e:	83 fa 06             	cmp    $0x6,%edx
+  802451:	74 0e                	je     802461 <sys_ep_destroy+0x79>
+  802453:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802456:	0f b6 c9             	movzbl %cl,%ecx
+  802459:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80245f:	eb 99                	jmp    8023fa <sys_ep_destroy+0x12>
+  802461:	89 c2                	mov    %eax,%edx
+  802463:	c1 ea 04             	shr    $0x4,%edx
+  802466:	83 e2 0f             	and    $0xf,%edx
+  802469:	83 fa 02             	cmp    $0x2,%edx
+  80246c:	77 e5                	ja     802453 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  80246e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802471:	83 f8 02             	cmp    $0x2,%eax
+  802474:	0f 97 c1             	seta   %cl
+  802477:	0f b6 c9             	movzbl %cl,%ecx
+  80247a:	eb d7                	jmp    802453 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  80247c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802481:	b8 23 00 00 00       	mov    $0x23,%eax
+  802486:	8b 55 08             	mov    0x8(%ebp),%edx
+  802489:	89 cb                	mov    %ecx,%ebx
+  80248b:	89 cf                	mov    %ecx,%edi
+  80248d:	89 ce                	mov    %ecx,%esi
+  80248f:	cd 30                	int    $0x30
+  802491:	eb 91                	jmp    802424 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802493:	83 ec 0c             	sub    $0xc,%esp
+  802496:	50                   	push   %eax
+  802497:	6a 23                	push   $0x23
+  802499:	68 39 33 80 00       	push   $0x803339
+  80249e:	6a 4a                	push   $0x4a
+  8024a0:	68 56 33 80 00       	push   $0x803356
+  8024a5:	e8 02 dd ff ff       	call   8001ac <_panic>
+
+008024aa <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  8024aa:	55                   	push   %ebp
+  8024ab:	89 e5                	mov    %esp,%ebp
+  8024ad:	57                   	push   %edi
+  8024ae:	56                   	push   %esi
+  8024af:	53                   	push   %ebx
+  8024b0:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8024b3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8024ba:	78 37                	js     8024f3 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  8024bc:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8024c3:	74 7a                	je     80253f <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  8024c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024d0:	b8 24 00 00 00       	mov    $0x24,%eax
+  8024d5:	89 df                	mov    %ebx,%edi
+  8024d7:	89 de                	mov    %ebx,%esi
+  8024d9:	55                   	push   %ebp
+  8024da:	68 e3 24 80 00       	push   $0x8024e3
+  8024df:	89 e5                	mov    %esp,%ebp
+  8024e1:	0f 34                	sysenter
+  8024e3:	83 c4 04             	add    $0x4,%esp
+  8024e6:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8024e7:	85 c0                	test   %eax,%eax
+  8024e9:	7f 6c                	jg     802557 <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  8024eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024ee:	5b                   	pop    %ebx
+  8024ef:	5e                   	pop    %esi
+  8024f0:	5f                   	pop    %edi
+  8024f1:	5d                   	pop    %ebp
+  8024f2:	c3                   	ret
+  8024f3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024f8:	0f a2                	cpuid
+		return 0;
+  8024fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8024ff:	f6 c6 08             	test   $0x8,%dh
+  802502:	74 15                	je     802519 <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802504:	89 c2                	mov    %eax,%edx
+  802506:	c1 ea 08             	shr    $0x8,%edx
+  802509:	83 e2 0f             	and    $0xf,%edx
+  80250c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802511:	83 fa 06             	cmp    $0x6,%edx
+  802514:	74 0e                	je     802524 <sys_ep_grant+0x7a>
+  802516:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802519:	0f b6 c9             	movzbl %cl,%ecx
+  80251c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802522:	eb 98                	jmp    8024bc <sys_ep_grant+0x12>
+  802524:	89 c2                	mov    %eax,%edx
+  802526:	c1 ea 04             	shr    $0x4,%edx
+  802529:	83 e2 0f             	and    $0xf,%edx
+  80252c:	83 fa 02             	cmp    $0x2,%edx
+  80252f:	77 e5                	ja     802516 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  802531:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802534:	83 f8 02             	cmp    $0x2,%eax
+  802537:	0f 97 c1             	seta   %cl
+  80253a:	0f b6 c9             	movzbl %cl,%ecx
+  80253d:	eb d7                	jmp    802516 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  80253f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802544:	b8 24 00 00 00       	mov    $0x24,%eax
+  802549:	8b 55 08             	mov    0x8(%ebp),%edx
+  80254c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80254f:	89 df                	mov    %ebx,%edi
+  802551:	89 de                	mov    %ebx,%esi
+  802553:	cd 30                	int    $0x30
+  802555:	eb 90                	jmp    8024e7 <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802557:	83 ec 0c             	sub    $0xc,%esp
+  80255a:	50                   	push   %eax
+  80255b:	6a 24                	push   $0x24
+  80255d:	68 39 33 80 00       	push   $0x803339
+  802562:	6a 4a                	push   $0x4a
+  802564:	68 56 33 80 00       	push   $0x803356
+  802569:	e8 3e dc ff ff       	call   8001ac <_panic>
+
+0080256e <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  80256e:	55                   	push   %ebp
+  80256f:	89 e5                	mov    %esp,%ebp
+  802571:	57                   	push   %edi
+  802572:	56                   	push   %esi
+  802573:	53                   	push   %ebx
+  802574:	83 ec 20             	sub    $0x20,%esp
+  802577:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  80257a:	8b 10                	mov    (%eax),%edx
+  80257c:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  80257f:	8b 50 04             	mov    0x4(%eax),%edx
+  802582:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802585:	8b 50 08             	mov    0x8(%eax),%edx
+  802588:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  80258b:	8b 50 0c             	mov    0xc(%eax),%edx
+  80258e:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  802591:	8b 40 10             	mov    0x10(%eax),%eax
+  802594:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  802597:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  80259a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80259d:	b8 25 00 00 00       	mov    $0x25,%eax
+  8025a2:	55                   	push   %ebp
+  8025a3:	56                   	push   %esi
+  8025a4:	8b 0e                	mov    (%esi),%ecx
+  8025a6:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8025a9:	8b 7e 08             	mov    0x8(%esi),%edi
+  8025ac:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8025af:	8b 76 0c             	mov    0xc(%esi),%esi
+  8025b2:	cd 30                	int    $0x30
+  8025b4:	87 34 24             	xchg   %esi,(%esp)
+  8025b7:	89 0e                	mov    %ecx,(%esi)
+  8025b9:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8025bc:	89 7e 08             	mov    %edi,0x8(%esi)
+  8025bf:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8025c2:	8f 46 0c             	pop    0xc(%esi)
+  8025c5:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  8025c6:	83 c4 20             	add    $0x20,%esp
+  8025c9:	5b                   	pop    %ebx
+  8025ca:	5e                   	pop    %esi
+  8025cb:	5f                   	pop    %edi
+  8025cc:	5d                   	pop    %ebp
+  8025cd:	c3                   	ret
+
+008025ce <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  8025ce:	55                   	push   %ebp
+  8025cf:	89 e5                	mov    %esp,%ebp
+  8025d1:	57                   	push   %edi
+  8025d2:	56                   	push   %esi
+  8025d3:	53                   	push   %ebx
+  8025d4:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  8025d7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025da:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  8025dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025df:	b8 26 00 00 00       	mov    $0x26,%eax
+  8025e4:	55                   	push   %ebp
+  8025e5:	56                   	push   %esi
+  8025e6:	8b 0e                	mov    (%esi),%ecx
+  8025e8:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8025eb:	8b 7e 08             	mov    0x8(%esi),%edi
+  8025ee:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8025f1:	8b 76 0c             	mov    0xc(%esi),%esi
+  8025f4:	cd 30                	int    $0x30
+  8025f6:	87 34 24             	xchg   %esi,(%esp)
+  8025f9:	89 0e                	mov    %ecx,(%esi)
+  8025fb:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8025fe:	89 7e 08             	mov    %edi,0x8(%esi)
+  802601:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802604:	8f 46 0c             	pop    0xc(%esi)
+  802607:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  802608:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  80260c:	74 0f                	je     80261d <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  80260e:	85 c0                	test   %eax,%eax
+  802610:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802615:	0f 48 d1             	cmovs  %ecx,%edx
+  802618:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  80261b:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  80261d:	5b                   	pop    %ebx
+  80261e:	5e                   	pop    %esi
+  80261f:	5f                   	pop    %edi
+  802620:	5d                   	pop    %ebp
+  802621:	c3                   	ret
+
+00802622 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  802622:	55                   	push   %ebp
+  802623:	89 e5                	mov    %esp,%ebp
+  802625:	57                   	push   %edi
+  802626:	56                   	push   %esi
+  802627:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802628:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80262f:	78 2f                	js     802660 <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  802631:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802638:	74 72                	je     8026ac <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  80263a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80263d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802642:	b8 27 00 00 00       	mov    $0x27,%eax
+  802647:	89 cb                	mov    %ecx,%ebx
+  802649:	89 cf                	mov    %ecx,%edi
+  80264b:	89 ce                	mov    %ecx,%esi
+  80264d:	55                   	push   %ebp
+  80264e:	68 57 26 80 00       	push   $0x802657
+  802653:	89 e5                	mov    %esp,%ebp
+  802655:	0f 34                	sysenter
+  802657:	83 c4 04             	add    $0x4,%esp
+  80265a:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  80265b:	5b                   	pop    %ebx
+  80265c:	5e                   	pop    %esi
+  80265d:	5f                   	pop    %edi
+  80265e:	5d                   	pop    %ebp
+  80265f:	c3                   	ret
+  802660:	b8 01 00 00 00       	mov    $0x1,%eax
+  802665:	0f a2                	cpuid
+		return 0;
+  802667:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80266c:	f6 c6 08             	test   $0x8,%dh
+  80266f:	74 15                	je     802686 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802671:	89 c2                	mov    %eax,%edx
+  802673:	c1 ea 08             	shr    $0x8,%edx
+  802676:	83 e2 0f             	and    $0xf,%edx
+  802679:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80267e:	83 fa 06             	cmp    $0x6,%edx
+  802681:	74 0e                	je     802691 <sys_sysring_setup+0x6f>
+  802683:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802686:	0f b6 c9             	movzbl %cl,%ecx
+  802689:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80268f:	eb a0                	jmp    802631 <sys_sysring_setup+0xf>
+  802691:	89 c2                	mov    %eax,%edx
+  802693:	c1 ea 04             	shr    $0x4,%edx
+  802696:	83 e2 0f             	and    $0xf,%edx
+  802699:	83 fa 02             	cmp    $0x2,%edx
+  80269c:	77 e5                	ja     802683 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  80269e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8026a1:	83 f8 02             	cmp    $0x2,%eax
+  8026a4:	0f 97 c1             	seta   %cl
+  8026a7:	0f b6 c9             	movzbl %cl,%ecx
+  8026aa:	eb d7                	jmp    802683 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  8026ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026b1:	b8 27 00 00 00       	mov    $0x27,%eax
+  8026b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8026b9:	89 cb                	mov    %ecx,%ebx
+  8026bb:	89 cf                	mov    %ecx,%edi
+  8026bd:	89 ce                	mov    %ecx,%esi
+  8026bf:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  8026c1:	eb 98                	jmp    80265b <sys_sysring_setup+0x39>
+
+008026c3 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  8026c3:	55                   	push   %ebp
+  8026c4:	89 e5                	mov    %esp,%ebp
+  8026c6:	57                   	push   %edi
+  8026c7:	56                   	push   %esi
+  8026c8:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8026c9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8026d0:	78 2e                	js     802700 <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  8026d2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8026d9:	74 71                	je     80274c <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  8026db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026e0:	b8 28 00 00 00       	mov    $0x28,%eax
+  8026e5:	89 d1                	mov    %edx,%ecx
+  8026e7:	89 d3                	mov    %edx,%ebx
+  8026e9:	89 d7                	mov    %edx,%edi
+  8026eb:	89 d6                	mov    %edx,%esi
+  8026ed:	55                   	push   %ebp
+  8026ee:	68 f7 26 80 00       	push   $0x8026f7
+  8026f3:	89 e5                	mov    %esp,%ebp
+  8026f5:	0f 34                	sysenter
+  8026f7:	83 c4 04             	add    $0x4,%esp
+  8026fa:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8026fb:	5b                   	pop    %ebx
+  8026fc:	5e                   	pop    %esi
+  8026fd:	5f                   	pop    %edi
+  8026fe:	5d                   	pop    %ebp
+  8026ff:	c3                   	ret
+  802700:	b8 01 00 00 00       	mov    $0x1,%eax
+  802705:	0f a2                	cpuid
+		return 0;
+  802707:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80270c:	f6 c6 08             	test   $0x8,%dh
+  80270f:	74 15                	je     802726 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802711:	89 c2                	mov    %eax,%edx
+  802713:	c1 ea 08             	shr    $0x8,%edx
+  802716:	83 e2 0f             	and    $0xf,%edx
+  802719:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80271e:	83 fa 06             	cmp    $0x6,%edx
+  802721:	74 0e                	je     802731 <sys_sysring_enter+0x6e>
+  802723:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802726:	0f b6 c9             	movzbl %cl,%ecx
+  802729:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80272f:	eb a1                	jmp    8026d2 <sys_sysring_enter+0xf>
+  802731:	89 c2                	mov    %eax,%edx
+  802733:	c1 ea 04             	shr    $0x4,%edx
+  802736:	83 e2 0f             	and    $0xf,%edx
+  802739:	83 fa 02             	cmp    $0x2,%edx
+  80273c:	77 e5                	ja     802723 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  80273e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802741:	83 f8 02             	cmp    $0x2,%eax
+  802744:	0f 97 c1             	seta   %cl
+  802747:	0f b6 c9             	movzbl %cl,%ecx
+  80274a:	eb d7                	jmp    802723 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  80274c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802751:	b8 28 00 00 00       	mov    $0x28,%eax
+  802756:	89 d1                	mov    %edx,%ecx
+  802758:	89 d3                	mov    %edx,%ebx
+  80275a:	89 d7                	mov    %edx,%edi
+  80275c:	89 d6                	mov    %edx,%esi
+  80275e:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  802760:	eb 99                	jmp    8026fb <sys_sysring_enter+0x38>
+
+00802762 <pgfault>:
+// The kernel normally resolves these faults itself (page_fault_cow in
+// kern/trap.c); we only get here if it ran out of memory doing so.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802762:	55                   	push   %ebp
+  802763:	89 e5                	mov    %esp,%ebp
+  802765:	83 ec 08             	sub    $0x8,%esp
+  802768:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  80276b:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  80276d:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  802770:	f6 c2 02             	test   $0x2,%dl
+  802773:	74 40                	je     8027b5 <pgfault+0x53>
+  802775:	89 c1                	mov    %eax,%ecx
+  802777:	c1 e9 16             	shr    $0x16,%ecx
+  80277a:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802781:	f6 c1 01             	test   $0x1,%cl
+  802784:	74 2f                	je     8027b5 <pgfault+0x53>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW))
+  802786:	89 c1                	mov    %eax,%ecx
+  802788:	c1 e9 0c             	shr    $0xc,%ecx
+  80278b:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  802792:	f6 c5 08             	test   $0x8,%ch
+  802795:	74 1e                	je     8027b5 <pgfault+0x53>
+	// Replace the page with a private writable copy of itself.  The
+	// kernel allocates, copies and maps it in one system call, so no
+	// temporary mapping at PFTEMP is needed.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  802797:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r = sys_page_copy(0, addr, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  80279c:	83 ec 0c             	sub    $0xc,%esp
+  80279f:	6a 07                	push   $0x7
+  8027a1:	50                   	push   %eax
+  8027a2:	6a 00                	push   $0x0
+  8027a4:	50                   	push   %eax
+  8027a5:	6a 00                	push   $0x0
+  8027a7:	e8 85 eb ff ff       	call   801331 <sys_page_copy>
+  8027ac:	83 c4 20             	add    $0x20,%esp
+  8027af:	85 c0                	test   %eax,%eax
+  8027b1:	78 18                	js     8027cb <pgfault+0x69>
+		panic("pgfault: sys_page_copy: %e", r);
+}
+  8027b3:	c9                   	leave
+  8027b4:	c3                   	ret
+		panic("pgfault: va %08x err %x is not a copy-on-write write",
+  8027b5:	83 ec 0c             	sub    $0xc,%esp
+  8027b8:	52                   	push   %edx
+  8027b9:	50                   	push   %eax
+  8027ba:	68 64 33 80 00       	push   $0x803364
+  8027bf:	6a 1c                	push   $0x1c
+  8027c1:	68 99 33 80 00       	push   $0x803399
+  8027c6:	e8 e1 d9 ff ff       	call   8001ac <_panic>
+		panic("pgfault: sys_page_copy: %e", r);
+  8027cb:	50                   	push   %eax
+  8027cc:	68 a4 33 80 00       	push   $0x8033a4
+  8027d1:	6a 26                	push   $0x26
+  8027d3:	68 99 33 80 00       	push   $0x803399
+  8027d8:	e8 cf d9 ff ff       	call   8001ac <_panic>
+
+008027dd <ufork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+ufork(void)
+{
+  8027dd:	55                   	push   %ebp
+  8027de:	89 e5                	mov    %esp,%ebp
+  8027e0:	57                   	push   %edi
+  8027e1:	56                   	push   %esi
+  8027e2:	53                   	push   %ebx
+  8027e3:	81 ec 38 04 00 00    	sub    $0x438,%esp
+	struct page_range vec[PAGE_VEC_MAX], *last;
+	uintptr_t va;
+	size_t n;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8027e9:	68 62 27 80 00       	push   $0x802762
+  8027ee:	e8 03 05 00 00       	call   802cf6 <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8027f3:	b8 07 00 00 00       	mov    $0x7,%eax
+  8027f8:	cd 30                	int    $0x30
+  8027fa:	89 85 d4 fb ff ff    	mov    %eax,-0x42c(%ebp)
+
+	envid = sys_exofork();
+	if (envid < 0)
+  802800:	83 c4 10             	add    $0x10,%esp
+  802803:	85 c0                	test   %eax,%eax
+  802805:	0f 88 f2 01 00 00    	js     8029fd <ufork+0x220>
+		return 0;
+	}
+
+	// Copy every run of mapped pages below the exception stack, which
+	// must not be shared.
+	va = 0;
+  80280b:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  802810:	74 0b                	je     80281d <ufork+0x40>
+  802812:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  802818:	e9 07 01 00 00       	jmp    802924 <ufork+0x147>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80281d:	e8 22 e8 ff ff       	call   801044 <sys_getenvid>
+  802822:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802827:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  80282d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802832:	a3 08 40 80 00       	mov    %eax,0x804008
+		return 0;
+  802837:	e9 c1 01 00 00       	jmp    8029fd <ufork+0x220>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+		n = r;
+		last = &vec[n - 1];
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  80283c:	83 ea 01             	sub    $0x1,%edx
+  80283f:	89 c1                	mov    %eax,%ecx
+  802841:	c1 e1 04             	shl    $0x4,%ecx
+  802844:	89 94 0d ec fd ff ff 	mov    %edx,-0x214(%ebp,%ecx,1)
+			n--;
+  80284b:	85 d2                	test   %edx,%edx
+  80284d:	0f 44 f0             	cmove  %eax,%esi
+  802850:	e9 12 01 00 00       	jmp    802967 <ufork+0x18a>
+	for (i = 0; i < n; i++) {
+  802855:	83 c1 01             	add    $0x1,%ecx
+  802858:	83 c0 10             	add    $0x10,%eax
+  80285b:	39 8d e4 fb ff ff    	cmp    %ecx,-0x41c(%ebp)
+  802861:	74 6a                	je     8028cd <ufork+0xf0>
+		vec[i].pr_dstva = vec[i].pr_va;
+  802863:	89 c3                	mov    %eax,%ebx
+  802865:	8b 10                	mov    (%eax),%edx
+  802867:	89 50 0c             	mov    %edx,0xc(%eax)
+		if (vec[i].pr_perm & PTE_SHARE)
+  80286a:	8b 50 08             	mov    0x8(%eax),%edx
+  80286d:	f6 c6 04             	test   $0x4,%dh
+  802870:	75 e3                	jne    802855 <ufork+0x78>
+		if (vec[i].pr_perm & (PTE_W | PTE_COW)) {
+  802872:	f7 c2 02 08 00 00    	test   $0x802,%edx
+  802878:	74 db                	je     802855 <ufork+0x78>
+			vec[i].pr_perm = (vec[i].pr_perm & ~PTE_W) | PTE_COW;
+  80287a:	81 e2 fd f7 ff ff    	and    $0xfffff7fd,%edx
+  802880:	80 ce 08             	or     $0x8,%dh
+  802883:	89 95 dc fb ff ff    	mov    %edx,-0x424(%ebp)
+  802889:	89 53 08             	mov    %edx,0x8(%ebx)
+			cow[ncow++] = vec[i];
+  80288c:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  802892:	c1 e6 04             	shl    $0x4,%esi
+  802895:	89 f2                	mov    %esi,%edx
+  802897:	8d b4 35 e8 fb ff ff 	lea    -0x418(%ebp,%esi,1),%esi
+  80289e:	8b 38                	mov    (%eax),%edi
+  8028a0:	89 bc 15 e8 fb ff ff 	mov    %edi,-0x418(%ebp,%edx,1)
+  8028a7:	8b 78 04             	mov    0x4(%eax),%edi
+  8028aa:	89 7e 04             	mov    %edi,0x4(%esi)
+  8028ad:	8b bd dc fb ff ff    	mov    -0x424(%ebp),%edi
+  8028b3:	89 7e 08             	mov    %edi,0x8(%esi)
+  8028b6:	8b 50 0c             	mov    0xc(%eax),%edx
+  8028b9:	89 56 0c             	mov    %edx,0xc(%esi)
+  8028bc:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  8028c2:	8d 7e 01             	lea    0x1(%esi),%edi
+  8028c5:	89 bd e0 fb ff ff    	mov    %edi,-0x420(%ebp)
+  8028cb:	eb 88                	jmp    802855 <ufork+0x78>
+	if ((r = sys_page_map_vec(0, envid, vec, n, 0)) < 0)
+  8028cd:	8b b5 e4 fb ff ff    	mov    -0x41c(%ebp),%esi
+  8028d3:	8b bd d8 fb ff ff    	mov    -0x428(%ebp),%edi
+  8028d9:	83 ec 0c             	sub    $0xc,%esp
+  8028dc:	6a 00                	push   $0x0
+  8028de:	56                   	push   %esi
+  8028df:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  8028e5:	50                   	push   %eax
+  8028e6:	ff b5 d4 fb ff ff    	push   -0x42c(%ebp)
+  8028ec:	6a 00                	push   $0x0
+  8028ee:	e8 80 f4 ff ff       	call   801d73 <sys_page_map_vec>
+  8028f3:	83 c4 20             	add    $0x20,%esp
+  8028f6:	85 c0                	test   %eax,%eax
+  8028f8:	0f 88 e5 00 00 00    	js     8029e3 <ufork+0x206>
+	return sys_page_map_vec(0, 0, cow, ncow, 0);
+  8028fe:	83 ec 0c             	sub    $0xc,%esp
+  802901:	6a 00                	push   $0x0
+  802903:	ff b5 e0 fb ff ff    	push   -0x420(%ebp)
+  802909:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  80290f:	50                   	push   %eax
+  802910:	6a 00                	push   $0x0
+  802912:	6a 00                	push   $0x0
+  802914:	e8 5a f4 ff ff       	call   801d73 <sys_page_map_vec>
+		if ((r = duppages(envid, vec, n)) < 0)
+  802919:	83 c4 20             	add    $0x20,%esp
+  80291c:	85 c0                	test   %eax,%eax
+  80291e:	0f 88 e7 00 00 00    	js     802a0b <ufork+0x22e>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+  802924:	6a 20                	push   $0x20
+  802926:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  80292c:	50                   	push   %eax
+  80292d:	57                   	push   %edi
+  80292e:	6a 00                	push   $0x0
+  802930:	e8 82 f4 ff ff       	call   801db7 <sys_vm_ranges>
+  802935:	83 c4 10             	add    $0x10,%esp
+  802938:	85 c0                	test   %eax,%eax
+  80293a:	7e 51                	jle    80298d <ufork+0x1b0>
+		n = r;
+  80293c:	89 c6                	mov    %eax,%esi
+		last = &vec[n - 1];
+  80293e:	83 e8 01             	sub    $0x1,%eax
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+  802941:	89 c1                	mov    %eax,%ecx
+  802943:	c1 e1 04             	shl    $0x4,%ecx
+  802946:	8b 94 0d ec fd ff ff 	mov    -0x214(%ebp,%ecx,1),%edx
+  80294d:	89 d3                	mov    %edx,%ebx
+  80294f:	c1 e3 0c             	shl    $0xc,%ebx
+  802952:	89 df                	mov    %ebx,%edi
+  802954:	03 bc 0d e8 fd ff ff 	add    -0x218(%ebp,%ecx,1),%edi
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  80295b:	81 ff 00 00 c0 ee    	cmp    $0xeec00000,%edi
+  802961:	0f 84 d5 fe ff ff    	je     80283c <ufork+0x5f>
+	for (i = 0; i < n; i++) {
+  802967:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+	size_t i, ncow = 0;
+  80296d:	c7 85 e0 fb ff ff 00 	movl   $0x0,-0x420(%ebp)
+  802974:	00 00 00 
+	for (i = 0; i < n; i++) {
+  802977:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80297c:	89 bd d8 fb ff ff    	mov    %edi,-0x428(%ebp)
+  802982:	89 b5 e4 fb ff ff    	mov    %esi,-0x41c(%ebp)
+  802988:	e9 ce fe ff ff       	jmp    80285b <ufork+0x7e>
+			goto fail;
+	}
+	if (r < 0)
+  80298d:	89 c6                	mov    %eax,%esi
+  80298f:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  802995:	85 c0                	test   %eax,%eax
+  802997:	78 52                	js     8029eb <ufork+0x20e>
+		goto fail;
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE),
+  802999:	83 ec 04             	sub    $0x4,%esp
+  80299c:	6a 07                	push   $0x7
+  80299e:	68 00 f0 bf ee       	push   $0xeebff000
+  8029a3:	53                   	push   %ebx
+  8029a4:	e8 3a e7 ff ff       	call   8010e3 <sys_page_alloc>
+  8029a9:	89 c6                	mov    %eax,%esi
+  8029ab:	83 c4 10             	add    $0x10,%esp
+  8029ae:	85 c0                	test   %eax,%eax
+  8029b0:	78 39                	js     8029eb <ufork+0x20e>
+				PTE_P | PTE_U | PTE_W)) < 0
+	    || (r = sys_env_set_pgfault_upcall(envid,
+			thisenv->env_pgfault_upcall)) < 0
+  8029b2:	a1 08 40 80 00       	mov    0x804008,%eax
+  8029b7:	8b 40 74             	mov    0x74(%eax),%eax
+	    || (r = sys_env_set_pgfault_upcall(envid,
+  8029ba:	83 ec 08             	sub    $0x8,%esp
+  8029bd:	50                   	push   %eax
+  8029be:	53                   	push   %ebx
+  8029bf:	e8 de ed ff ff       	call   8017a2 <sys_env_set_pgfault_upcall>
+  8029c4:	89 c6                	mov    %eax,%esi
+  8029c6:	83 c4 10             	add    $0x10,%esp
+  8029c9:	85 c0                	test   %eax,%eax
+  8029cb:	78 1e                	js     8029eb <ufork+0x20e>
+	    || (r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  8029cd:	83 ec 08             	sub    $0x8,%esp
+  8029d0:	6a 02                	push   $0x2
+  8029d2:	53                   	push   %ebx
+  8029d3:	e8 bc ea ff ff       	call   801494 <sys_env_set_status>
+  8029d8:	89 c6                	mov    %eax,%esi
+  8029da:	83 c4 10             	add    $0x10,%esp
+  8029dd:	85 c0                	test   %eax,%eax
+  8029df:	79 1c                	jns    8029fd <ufork+0x220>
+  8029e1:	eb 08                	jmp    8029eb <ufork+0x20e>
+  8029e3:	89 c6                	mov    %eax,%esi
+  8029e5:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+		goto fail;
+	return envid;
+
+fail:
+	sys_env_destroy(envid);
+  8029eb:	83 ec 0c             	sub    $0xc,%esp
+  8029ee:	53                   	push   %ebx
+  8029ef:	e8 8e e5 ff ff       	call   800f82 <sys_env_destroy>
+	return r;
+  8029f4:	83 c4 10             	add    $0x10,%esp
+  8029f7:	89 b5 d4 fb ff ff    	mov    %esi,-0x42c(%ebp)
+}
+  8029fd:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+  802a03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a06:	5b                   	pop    %ebx
+  802a07:	5e                   	pop    %esi
+  802a08:	5f                   	pop    %edi
+  802a09:	5d                   	pop    %ebp
+  802a0a:	c3                   	ret
+  802a0b:	89 c6                	mov    %eax,%esi
+  802a0d:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  802a13:	eb d6                	jmp    8029eb <ufork+0x20e>
+
+00802a15 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  802a15:	55                   	push   %ebp
+  802a16:	89 e5                	mov    %esp,%ebp
+  802a18:	53                   	push   %ebx
+  802a19:	83 ec 04             	sub    $0x4,%esp
+	envid_t envid;
+
+	envid = sys_fork();
+  802a1c:	e8 90 f2 ff ff       	call   801cb1 <sys_fork>
+  802a21:	89 c3                	mov    %eax,%ebx
+	if (envid == 0)
+  802a23:	85 c0                	test   %eax,%eax
+  802a25:	74 07                	je     802a2e <fork+0x19>
+		thisenv = &envs[ENVX(sys_getenvid())];
+	return envid;
+}
+  802a27:	89 d8                	mov    %ebx,%eax
+  802a29:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a2c:	c9                   	leave
+  802a2d:	c3                   	ret
+		thisenv = &envs[ENVX(sys_getenvid())];
+  802a2e:	e8 11 e6 ff ff       	call   801044 <sys_getenvid>
+  802a33:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802a38:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802a3e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802a43:	a3 08 40 80 00       	mov    %eax,0x804008
+	return envid;
+  802a48:	eb dd                	jmp    802a27 <fork+0x12>
+
+00802a4a <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  802a4a:	55                   	push   %ebp
+  802a4b:	89 e5                	mov    %esp,%ebp
+  802a4d:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  802a50:	68 bf 33 80 00       	push   $0x8033bf
+  802a55:	68 a1 00 00 00       	push   $0xa1
+  802a5a:	68 99 33 80 00       	push   $0x803399
+  802a5f:	e8 48 d7 ff ff       	call   8001ac <_panic>
+
+00802a64 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802a64:	55                   	push   %ebp
+  802a65:	89 e5                	mov    %esp,%ebp
+  802a67:	56                   	push   %esi
+  802a68:	53                   	push   %ebx
+  802a69:	8b 75 08             	mov    0x8(%ebp),%esi
+  802a6c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a6f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if ((r = sys_ipc_recv(pg ? pg : (void *) UTOP)) < 0) {
+  802a72:	85 c0                	test   %eax,%eax
+  802a74:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802a79:	0f 44 c2             	cmove  %edx,%eax
+  802a7c:	83 ec 0c             	sub    $0xc,%esp
+  802a7f:	50                   	push   %eax
+  802a80:	e8 2f ef ff ff       	call   8019b4 <sys_ipc_recv>
+  802a85:	83 c4 10             	add    $0x10,%esp
+  802a88:	85 c0                	test   %eax,%eax
+  802a8a:	78 34                	js     802ac0 <ipc_recv+0x5c>
+			*from_env_store = 0;
+		if (perm_store)
+			*perm_store = 0;
+		return r;
+	}
+	if (from_env_store)
+  802a8c:	85 f6                	test   %esi,%esi
+  802a8e:	74 0d                	je     802a9d <ipc_recv+0x39>
+		*from_env_store = thisenv->env_ipc_from;
+  802a90:	a1 08 40 80 00       	mov    0x804008,%eax
+  802a95:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  802a9b:	89 06                	mov    %eax,(%esi)
+	if (perm_store)
+  802a9d:	85 db                	test   %ebx,%ebx
+  802a9f:	74 0d                	je     802aae <ipc_recv+0x4a>
+		*perm_store = thisenv->env_ipc_perm;
+  802aa1:	a1 08 40 80 00       	mov    0x804008,%eax
+  802aa6:	8b 80 9c 00 00 00    	mov    0x9c(%eax),%eax
+  802aac:	89 03                	mov    %eax,(%ebx)
+	return thisenv->env_ipc_msg.m_w[0];
+  802aae:	a1 08 40 80 00       	mov    0x804008,%eax
+  802ab3:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802ab9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802abc:	5b                   	pop    %ebx
+  802abd:	5e                   	pop    %esi
+  802abe:	5d                   	pop    %ebp
+  802abf:	c3                   	ret
+		if (from_env_store)
+  802ac0:	85 f6                	test   %esi,%esi
+  802ac2:	74 06                	je     802aca <ipc_recv+0x66>
+			*from_env_store = 0;
+  802ac4:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802aca:	85 db                	test   %ebx,%ebx
+  802acc:	74 eb                	je     802ab9 <ipc_recv+0x55>
+			*perm_store = 0;
+  802ace:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802ad4:	eb e3                	jmp    802ab9 <ipc_recv+0x55>
+
+00802ad6 <ipc_send>:
+//
+// The kernel queues us behind any other senders until 'toenv'
+// receives, so we only come back to retry if its queue was full.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802ad6:	55                   	push   %ebp
+  802ad7:	89 e5                	mov    %esp,%ebp
+  802ad9:	57                   	push   %edi
+  802ada:	56                   	push   %esi
+  802adb:	53                   	push   %ebx
+  802adc:	83 ec 0c             	sub    $0xc,%esp
+  802adf:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802ae2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802ae5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_send(to_env, val, pg ? pg : (void *) UTOP, perm))
+  802ae8:	85 db                	test   %ebx,%ebx
+  802aea:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802aef:	0f 44 d8             	cmove  %eax,%ebx
+  802af2:	eb 05                	jmp    802af9 <ipc_send+0x23>
+	       == -E_AGAIN)
+		sys_yield();
+  802af4:	e8 fc e8 ff ff       	call   8013f5 <sys_yield>
+	while ((r = sys_ipc_send(to_env, val, pg ? pg : (void *) UTOP, perm))
+  802af9:	ff 75 14             	push   0x14(%ebp)
+  802afc:	53                   	push   %ebx
+  802afd:	56                   	push   %esi
+  802afe:	57                   	push   %edi
+  802aff:	e8 09 ee ff ff       	call   80190d <sys_ipc_send>
+	       == -E_AGAIN)
+  802b04:	83 c4 10             	add    $0x10,%esp
+  802b07:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802b0a:	74 e8                	je     802af4 <ipc_send+0x1e>
+	if (r < 0)
+  802b0c:	85 c0                	test   %eax,%eax
+  802b0e:	78 08                	js     802b18 <ipc_send+0x42>
+		panic("ipc_send: %e", r);
+}
+  802b10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b13:	5b                   	pop    %ebx
+  802b14:	5e                   	pop    %esi
+  802b15:	5f                   	pop    %edi
+  802b16:	5d                   	pop    %ebp
+  802b17:	c3                   	ret
+		panic("ipc_send: %e", r);
+  802b18:	50                   	push   %eax
+  802b19:	68 d5 33 80 00       	push   $0x8033d5
+  802b1e:	6a 3a                	push   $0x3a
+  802b20:	68 e2 33 80 00       	push   $0x8033e2
+  802b25:	e8 82 d6 ff ff       	call   8001ac <_panic>
+
+00802b2a <ipc_send_range>:
+
+// Like ipc_send, but send the 'npages' contiguous pages at 'pg' in one
+// message.  The receiver maps as many as fit in its window.
+void
+ipc_send_range(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  802b2a:	55                   	push   %ebp
+  802b2b:	89 e5                	mov    %esp,%ebp
+  802b2d:	57                   	push   %edi
+  802b2e:	56                   	push   %esi
+  802b2f:	53                   	push   %ebx
+  802b30:	83 ec 0c             	sub    $0xc,%esp
+  802b33:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b36:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b39:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_send_range(to_env, val, pg, npages, perm))
+  802b3c:	eb 05                	jmp    802b43 <ipc_send_range+0x19>
+	       == -E_AGAIN)
+		sys_yield();
+  802b3e:	e8 b2 e8 ff ff       	call   8013f5 <sys_yield>
+	while ((r = sys_ipc_send_range(to_env, val, pg, npages, perm))
+  802b43:	83 ec 0c             	sub    $0xc,%esp
+  802b46:	ff 75 18             	push   0x18(%ebp)
+  802b49:	ff 75 14             	push   0x14(%ebp)
+  802b4c:	53                   	push   %ebx
+  802b4d:	56                   	push   %esi
+  802b4e:	57                   	push   %edi
+  802b4f:	e8 22 ef ff ff       	call   801a76 <sys_ipc_send_range>
+	       == -E_AGAIN)
+  802b54:	83 c4 20             	add    $0x20,%esp
+  802b57:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802b5a:	74 e2                	je     802b3e <ipc_send_range+0x14>
+	if (r < 0)
+  802b5c:	85 c0                	test   %eax,%eax
+  802b5e:	78 08                	js     802b68 <ipc_send_range+0x3e>
+		panic("ipc_send_range: %e", r);
+}
+  802b60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b63:	5b                   	pop    %ebx
+  802b64:	5e                   	pop    %esi
+  802b65:	5f                   	pop    %edi
+  802b66:	5d                   	pop    %ebp
+  802b67:	c3                   	ret
+		panic("ipc_send_range: %e", r);
+  802b68:	50                   	push   %eax
+  802b69:	68 ec 33 80 00       	push   $0x8033ec
+  802b6e:	6a 48                	push   $0x48
+  802b70:	68 e2 33 80 00       	push   $0x8033e2
+  802b75:	e8 32 d6 ff ff       	call   8001ac <_panic>
+
+00802b7a <ipc_recv_range>:
+// (which must not be null).  On return *npages holds the number of
+// pages received, which is 0 on error or if the sender sent none.
+int32_t
+ipc_recv_range(envid_t *from_env_store, void *pg, size_t *npages,
+	       int *perm_store)
+{
+  802b7a:	55                   	push   %ebp
+  802b7b:	89 e5                	mov    %esp,%ebp
+  802b7d:	57                   	push   %edi
+  802b7e:	56                   	push   %esi
+  802b7f:	53                   	push   %ebx
+  802b80:	83 ec 14             	sub    $0x14,%esp
+  802b83:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b86:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802b89:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if ((r = sys_ipc_recv_range(pg, *npages)) < 0) {
+  802b8c:	ff 33                	push   (%ebx)
+  802b8e:	ff 75 0c             	push   0xc(%ebp)
+  802b91:	e8 83 ef ff ff       	call   801b19 <sys_ipc_recv_range>
+  802b96:	83 c4 10             	add    $0x10,%esp
+  802b99:	85 c0                	test   %eax,%eax
+  802b9b:	78 42                	js     802bdf <ipc_recv_range+0x65>
+		if (perm_store)
+			*perm_store = 0;
+		*npages = 0;
+		return r;
+	}
+	if (from_env_store)
+  802b9d:	85 ff                	test   %edi,%edi
+  802b9f:	74 0d                	je     802bae <ipc_recv_range+0x34>
+		*from_env_store = thisenv->env_ipc_from;
+  802ba1:	a1 08 40 80 00       	mov    0x804008,%eax
+  802ba6:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  802bac:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  802bae:	85 f6                	test   %esi,%esi
+  802bb0:	74 0d                	je     802bbf <ipc_recv_range+0x45>
+		*perm_store = thisenv->env_ipc_perm;
+  802bb2:	a1 08 40 80 00       	mov    0x804008,%eax
+  802bb7:	8b 80 9c 00 00 00    	mov    0x9c(%eax),%eax
+  802bbd:	89 06                	mov    %eax,(%esi)
+	*npages = thisenv->env_ipc_npages;
+  802bbf:	a1 08 40 80 00       	mov    0x804008,%eax
+  802bc4:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802bca:	89 03                	mov    %eax,(%ebx)
+	return thisenv->env_ipc_msg.m_w[0];
+  802bcc:	a1 08 40 80 00       	mov    0x804008,%eax
+  802bd1:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802bd7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bda:	5b                   	pop    %ebx
+  802bdb:	5e                   	pop    %esi
+  802bdc:	5f                   	pop    %edi
+  802bdd:	5d                   	pop    %ebp
+  802bde:	c3                   	ret
+		if (from_env_store)
+  802bdf:	85 ff                	test   %edi,%edi
+  802be1:	74 06                	je     802be9 <ipc_recv_range+0x6f>
+			*from_env_store = 0;
+  802be3:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  802be9:	85 f6                	test   %esi,%esi
+  802beb:	74 06                	je     802bf3 <ipc_recv_range+0x79>
+			*perm_store = 0;
+  802bed:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		*npages = 0;
+  802bf3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		return r;
+  802bf9:	eb dc                	jmp    802bd7 <ipc_recv_range+0x5d>
+
+00802bfb <ipc_send_msg>:
+// Send the IPC_MSG_WORDS words of 'msg' to 'to_env', in registers and
+// without a page.  Waits like ipc_send until 'to_env' takes them, and
+// panics on any error other than -E_AGAIN.
+void
+ipc_send_msg(envid_t to_env, const struct ipc_msg *msg)
+{
+  802bfb:	55                   	push   %ebp
+  802bfc:	89 e5                	mov    %esp,%ebp
+  802bfe:	56                   	push   %esi
+  802bff:	53                   	push   %ebx
+  802c00:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c03:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_send_msg(to_env, msg)) == -E_AGAIN)
+  802c06:	eb 05                	jmp    802c0d <ipc_send_msg+0x12>
+		sys_yield();
+  802c08:	e8 e8 e7 ff ff       	call   8013f5 <sys_yield>
+	while ((r = sys_ipc_send_msg(to_env, msg)) == -E_AGAIN)
+  802c0d:	83 ec 08             	sub    $0x8,%esp
+  802c10:	53                   	push   %ebx
+  802c11:	56                   	push   %esi
+  802c12:	e8 3a f0 ff ff       	call   801c51 <sys_ipc_send_msg>
+  802c17:	83 c4 10             	add    $0x10,%esp
+  802c1a:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802c1d:	74 e9                	je     802c08 <ipc_send_msg+0xd>
+	if (r < 0)
+  802c1f:	85 c0                	test   %eax,%eax
+  802c21:	78 07                	js     802c2a <ipc_send_msg+0x2f>
+		panic("ipc_send_msg: %e", r);
+}
+  802c23:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c26:	5b                   	pop    %ebx
+  802c27:	5e                   	pop    %esi
+  802c28:	5d                   	pop    %ebp
+  802c29:	c3                   	ret
+		panic("ipc_send_msg: %e", r);
+  802c2a:	50                   	push   %eax
+  802c2b:	68 ff 33 80 00       	push   $0x8033ff
+  802c30:	6a 6f                	push   $0x6f
+  802c32:	68 e2 33 80 00       	push   $0x8033e2
+  802c37:	e8 70 d5 ff ff       	call   8001ac <_panic>
+
+00802c3c <ipc_recv_msg>:
+// ipc_call or plain ipc_send (whose value is word 0, and whose page is
+// not taken), it arrives in registers and needs no page.
+// Returns the sender's envid, < 0 on error.
+envid_t
+ipc_recv_msg(struct ipc_msg *msg)
+{
+  802c3c:	55                   	push   %ebp
+  802c3d:	89 e5                	mov    %esp,%ebp
+  802c3f:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_reply_wait(0, msg);
+  802c42:	ff 75 08             	push   0x8(%ebp)
+  802c45:	6a 00                	push   $0x0
+  802c47:	e8 cb ef ff ff       	call   801c17 <sys_ipc_reply_wait>
+}
+  802c4c:	c9                   	leave
+  802c4d:	c3                   	ret
+
+00802c4e <ipc_call>:
+// ipc_reply_wait (or ipc_recv), and straight back when it replies.
+// Retries while to_env's queue is full.
+// Returns 0 on success, < 0 on error.
+int
+ipc_call(envid_t to_env, struct ipc_msg *msg)
+{
+  802c4e:	55                   	push   %ebp
+  802c4f:	89 e5                	mov    %esp,%ebp
+  802c51:	56                   	push   %esi
+  802c52:	53                   	push   %ebx
+  802c53:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c56:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_call(to_env, msg)) == -E_AGAIN)
+  802c59:	eb 05                	jmp    802c60 <ipc_call+0x12>
+		sys_yield();
+  802c5b:	e8 95 e7 ff ff       	call   8013f5 <sys_yield>
+	while ((r = sys_ipc_call(to_env, msg)) == -E_AGAIN)
+  802c60:	83 ec 08             	sub    $0x8,%esp
+  802c63:	53                   	push   %ebx
+  802c64:	56                   	push   %esi
+  802c65:	e8 73 ef ff ff       	call   801bdd <sys_ipc_call>
+  802c6a:	83 c4 10             	add    $0x10,%esp
+  802c6d:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802c70:	74 e9                	je     802c5b <ipc_call+0xd>
+	return r;
+}
+  802c72:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c75:	5b                   	pop    %ebx
+  802c76:	5e                   	pop    %esi
+  802c77:	5d                   	pop    %ebp
+  802c78:	c3                   	ret
+
+00802c79 <ipc_reply_wait>:
+//	}
+//
+// Returns the envid of the sender, < 0 on error.
+envid_t
+ipc_reply_wait(envid_t to_env, struct ipc_msg *msg)
+{
+  802c79:	55                   	push   %ebp
+  802c7a:	89 e5                	mov    %esp,%ebp
+  802c7c:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_reply_wait(to_env, msg);
+  802c7f:	ff 75 0c             	push   0xc(%ebp)
+  802c82:	ff 75 08             	push   0x8(%ebp)
+  802c85:	e8 8d ef ff ff       	call   801c17 <sys_ipc_reply_wait>
+}
+  802c8a:	c9                   	leave
+  802c8b:	c3                   	ret
+
+00802c8c <ep_send>:
+
+// Send 'msg' to endpoint 'epid', waiting while its queue is full.
+// Returns 0 on success, < 0 if the endpoint is gone or not ours to use.
+int
+ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  802c8c:	55                   	push   %ebp
+  802c8d:	89 e5                	mov    %esp,%ebp
+  802c8f:	56                   	push   %esi
+  802c90:	53                   	push   %ebx
+  802c91:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c94:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ep_send(epid, msg)) == -E_AGAIN)
+  802c97:	eb 05                	jmp    802c9e <ep_send+0x12>
+		sys_yield();
+  802c99:	e8 57 e7 ff ff       	call   8013f5 <sys_yield>
+	while ((r = sys_ep_send(epid, msg)) == -E_AGAIN)
+  802c9e:	83 ec 08             	sub    $0x8,%esp
+  802ca1:	53                   	push   %ebx
+  802ca2:	56                   	push   %esi
+  802ca3:	e8 c6 f8 ff ff       	call   80256e <sys_ep_send>
+  802ca8:	83 c4 10             	add    $0x10,%esp
+  802cab:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802cae:	74 e9                	je     802c99 <ep_send+0xd>
+	return r;
+}
+  802cb0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cb3:	5b                   	pop    %ebx
+  802cb4:	5e                   	pop    %esi
+  802cb5:	5d                   	pop    %ebp
+  802cb6:	c3                   	ret
+
+00802cb7 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802cb7:	55                   	push   %ebp
+  802cb8:	89 e5                	mov    %esp,%ebp
+  802cba:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802cbd:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802cc2:	69 d0 68 01 00 00    	imul   $0x168,%eax,%edx
+  802cc8:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802cce:	8b 52 50             	mov    0x50(%edx),%edx
+  802cd1:	39 ca                	cmp    %ecx,%edx
+  802cd3:	74 11                	je     802ce6 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802cd5:	83 c0 01             	add    $0x1,%eax
+  802cd8:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802cdd:	75 e3                	jne    802cc2 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802cdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ce4:	eb 0e                	jmp    802cf4 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802ce6:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802cec:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802cf1:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802cf4:	5d                   	pop    %ebp
+  802cf5:	c3                   	ret
+
+00802cf6 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802cf6:	55                   	push   %ebp
+  802cf7:	89 e5                	mov    %esp,%ebp
+  802cf9:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  802cfc:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  802d03:	74 0a                	je     802d0f <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  802d05:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d08:	a3 0c 40 80 00       	mov    %eax,0x80400c
+}
+  802d0d:	c9                   	leave
+  802d0e:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE),
+  802d0f:	83 ec 04             	sub    $0x4,%esp
+  802d12:	6a 07                	push   $0x7
+  802d14:	68 00 f0 bf ee       	push   $0xeebff000
+  802d19:	6a 00                	push   $0x0
+  802d1b:	e8 c3 e3 ff ff       	call   8010e3 <sys_page_alloc>
+  802d20:	83 c4 10             	add    $0x10,%esp
+  802d23:	85 c0                	test   %eax,%eax
+  802d25:	78 28                	js     802d4f <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  802d27:	83 ec 08             	sub    $0x8,%esp
+  802d2a:	68 61 2d 80 00       	push   $0x802d61
+  802d2f:	6a 00                	push   $0x0
+  802d31:	e8 6c ea ff ff       	call   8017a2 <sys_env_set_pgfault_upcall>
+  802d36:	83 c4 10             	add    $0x10,%esp
+  802d39:	85 c0                	test   %eax,%eax
+  802d3b:	79 c8                	jns    802d05 <set_pgfault_handler+0xf>
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+  802d3d:	50                   	push   %eax
+  802d3e:	68 38 34 80 00       	push   $0x803438
+  802d43:	6a 24                	push   $0x24
+  802d45:	68 6c 34 80 00       	push   $0x80346c
+  802d4a:	e8 5d d4 ff ff       	call   8001ac <_panic>
+			panic("set_pgfault_handler: sys_page_alloc: %e", r);
+  802d4f:	50                   	push   %eax
+  802d50:	68 10 34 80 00       	push   $0x803410
+  802d55:	6a 22                	push   $0x22
+  802d57:	68 6c 34 80 00       	push   $0x80346c
+  802d5c:	e8 4b d4 ff ff       	call   8001ac <_panic>
+
+00802d61 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802d61:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802d62:	a1 0c 40 80 00       	mov    0x80400c,%eax
+	call *%eax
+  802d67:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802d69:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 0x28(%esp), %ebx		// trap-time eip
+  802d6c:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl 0x30(%esp), %eax		// trap-time esp
+  802d70:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  802d74:	83 e8 04             	sub    $0x4,%eax
+	movl %ebx, (%eax)
+  802d77:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 0x30(%esp)
+  802d79:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp			// skip fault_va and err
+  802d7d:	83 c4 08             	add    $0x8,%esp
+	popal
+  802d80:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp			// skip eip
+  802d81:	83 c4 04             	add    $0x4,%esp
+	popfl
+  802d84:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802d85:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802d86:	c3                   	ret
+
+00802d87 <dm>:
+  802d87:	55                   	push   %ebp
+  802d88:	57                   	push   %edi
+  802d89:	56                   	push   %esi
+  802d8a:	53                   	push   %ebx
+  802d8b:	83 ec 24             	sub    $0x24,%esp
+  802d8e:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802d92:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802d96:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802d9a:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802d9e:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802da2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802da6:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802daa:	b8 00 00 00 00       	mov    $0x0,%eax
+  802daf:	ba 00 00 00 00       	mov    $0x0,%edx
+  802db4:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802db9:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802dc0:	00 
+  802dc1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802dc8:	00 
+  802dc9:	89 fb                	mov    %edi,%ebx
+  802dcb:	eb 08                	jmp    802dd5 <dm+0x4e>
+  802dcd:	83 e9 01             	sub    $0x1,%ecx
+  802dd0:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802dd3:	74 68                	je     802e3d <dm+0xb6>
+  802dd5:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802dd9:	01 c0                	add    %eax,%eax
+  802ddb:	89 c6                	mov    %eax,%esi
+  802ddd:	89 d7                	mov    %edx,%edi
+  802ddf:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802de3:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802de7:	0f ad d0             	shrd   %cl,%edx,%eax
+  802dea:	d3 ea                	shr    %cl,%edx
+  802dec:	f6 c1 20             	test   $0x20,%cl
+  802def:	74 04                	je     802df5 <dm+0x6e>
+  802df1:	89 d0                	mov    %edx,%eax
+  802df3:	31 d2                	xor    %edx,%edx
+  802df5:	83 e0 01             	and    $0x1,%eax
+  802df8:	89 04 24             	mov    %eax,(%esp)
+  802dfb:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802e02:	00 
+  802e03:	8b 04 24             	mov    (%esp),%eax
+  802e06:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802e0a:	09 f0                	or     %esi,%eax
+  802e0c:	09 fa                	or     %edi,%edx
+  802e0e:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802e12:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802e16:	39 f0                	cmp    %esi,%eax
+  802e18:	89 d5                	mov    %edx,%ebp
+  802e1a:	19 fd                	sbb    %edi,%ebp
+  802e1c:	72 af                	jb     802dcd <dm+0x46>
+  802e1e:	29 f0                	sub    %esi,%eax
+  802e20:	19 fa                	sbb    %edi,%edx
+  802e22:	89 cf                	mov    %ecx,%edi
+  802e24:	c1 ef 05             	shr    $0x5,%edi
+  802e27:	83 e7 01             	and    $0x1,%edi
+  802e2a:	89 fe                	mov    %edi,%esi
+  802e2c:	83 f6 01             	xor    $0x1,%esi
+  802e2f:	d3 e6                	shl    %cl,%esi
+  802e31:	d3 e7                	shl    %cl,%edi
+  802e33:	09 74 24 18          	or     %esi,0x18(%esp)
+  802e37:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802e3b:	eb 90                	jmp    802dcd <dm+0x46>
+  802e3d:	85 db                	test   %ebx,%ebx
+  802e3f:	74 05                	je     802e46 <dm+0xbf>
+  802e41:	89 03                	mov    %eax,(%ebx)
+  802e43:	89 53 04             	mov    %edx,0x4(%ebx)
+  802e46:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802e4a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802e4e:	83 c4 24             	add    $0x24,%esp
+  802e51:	5b                   	pop    %ebx
+  802e52:	5e                   	pop    %esi
+  802e53:	5f                   	pop    %edi
+  802e54:	5d                   	pop    %ebp
+  802e55:	c3                   	ret
+
+00802e56 <__udivdi3>:
+  802e56:	83 ec 08             	sub    $0x8,%esp
+  802e59:	6a 00                	push   $0x0
+  802e5b:	ff 74 24 1c          	push   0x1c(%esp)
+  802e5f:	ff 74 24 1c          	push   0x1c(%esp)
+  802e63:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802e67:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802e6b:	e8 17 ff ff ff       	call   802d87 <dm>
+  802e70:	83 c4 14             	add    $0x14,%esp
+  802e73:	c3                   	ret
+
+00802e74 <__umoddi3>:
+  802e74:	83 ec 18             	sub    $0x18,%esp
+  802e77:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802e7b:	50                   	push   %eax
+  802e7c:	ff 74 24 2c          	push   0x2c(%esp)
+  802e80:	ff 74 24 2c          	push   0x2c(%esp)
+  802e84:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e88:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e8c:	e8 f6 fe ff ff       	call   802d87 <dm>
+  802e91:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802e95:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802e99:	83 c4 24             	add    $0x24,%esp
+  802e9c:	c3                   	ret
+
+00802e9d <__divdi3>:
+  802e9d:	53                   	push   %ebx
+  802e9e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802ea2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802ea6:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  802eaa:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  802eae:	85 d2                	test   %edx,%edx
+  802eb0:	78 15                	js     802ec7 <__divdi3+0x2a>
+  802eb2:	85 db                	test   %ebx,%ebx
+  802eb4:	78 34                	js     802eea <__divdi3+0x4d>
+  802eb6:	83 ec 04             	sub    $0x4,%esp
+  802eb9:	6a 00                	push   $0x0
+  802ebb:	53                   	push   %ebx
+  802ebc:	51                   	push   %ecx
+  802ebd:	e8 c5 fe ff ff       	call   802d87 <dm>
+  802ec2:	83 c4 10             	add    $0x10,%esp
+  802ec5:	eb 21                	jmp    802ee8 <__divdi3+0x4b>
+  802ec7:	f7 d8                	neg    %eax
+  802ec9:	83 d2 00             	adc    $0x0,%edx
+  802ecc:	f7 da                	neg    %edx
+  802ece:	85 db                	test   %ebx,%ebx
+  802ed0:	78 30                	js     802f02 <__divdi3+0x65>
+  802ed2:	83 ec 04             	sub    $0x4,%esp
+  802ed5:	6a 00                	push   $0x0
+  802ed7:	53                   	push   %ebx
+  802ed8:	51                   	push   %ecx
+  802ed9:	e8 a9 fe ff ff       	call   802d87 <dm>
+  802ede:	83 c4 10             	add    $0x10,%esp
+  802ee1:	f7 d8                	neg    %eax
+  802ee3:	83 d2 00             	adc    $0x0,%edx
+  802ee6:	f7 da                	neg    %edx
+  802ee8:	5b                   	pop    %ebx
+  802ee9:	c3                   	ret
+  802eea:	83 ec 04             	sub    $0x4,%esp
+  802eed:	6a 00                	push   $0x0
+  802eef:	f7 d9                	neg    %ecx
+  802ef1:	83 d3 00             	adc    $0x0,%ebx
+  802ef4:	f7 db                	neg    %ebx
+  802ef6:	53                   	push   %ebx
+  802ef7:	51                   	push   %ecx
+  802ef8:	e8 8a fe ff ff       	call   802d87 <dm>
+  802efd:	83 c4 10             	add    $0x10,%esp
+  802f00:	eb df                	jmp    802ee1 <__divdi3+0x44>
+  802f02:	83 ec 04             	sub    $0x4,%esp
+  802f05:	6a 00                	push   $0x0
+  802f07:	f7 d9                	neg    %ecx
+  802f09:	83 d3 00             	adc    $0x0,%ebx
+  802f0c:	f7 db                	neg    %ebx
+  802f0e:	53                   	push   %ebx
+  802f0f:	51                   	push   %ecx
+  802f10:	e8 72 fe ff ff       	call   802d87 <dm>
+  802f15:	83 c4 10             	add    $0x10,%esp
+  802f18:	eb ce                	jmp    802ee8 <__divdi3+0x4b>
+
+00802f1a <__moddi3>:
+  802f1a:	55                   	push   %ebp
+  802f1b:	57                   	push   %edi
+  802f1c:	56                   	push   %esi
+  802f1d:	53                   	push   %ebx
+  802f1e:	83 ec 18             	sub    $0x18,%esp
+  802f21:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802f25:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802f29:	89 f1                	mov    %esi,%ecx
+  802f2b:	f7 d9                	neg    %ecx
+  802f2d:	89 da                	mov    %ebx,%edx
+  802f2f:	83 d2 00             	adc    $0x0,%edx
+  802f32:	f7 da                	neg    %edx
+  802f34:	0f 48 ce             	cmovs  %esi,%ecx
+  802f37:	0f 48 d3             	cmovs  %ebx,%edx
+  802f3a:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802f3e:	50                   	push   %eax
+  802f3f:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802f43:	f7 de                	neg    %esi
+  802f45:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802f49:	83 d0 00             	adc    $0x0,%eax
+  802f4c:	f7 d8                	neg    %eax
+  802f4e:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802f53:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802f58:	50                   	push   %eax
+  802f59:	56                   	push   %esi
+  802f5a:	89 c8                	mov    %ecx,%eax
+  802f5c:	e8 26 fe ff ff       	call   802d87 <dm>
+  802f61:	83 c4 10             	add    $0x10,%esp
+  802f64:	85 db                	test   %ebx,%ebx
+  802f66:	78 10                	js     802f78 <__moddi3+0x5e>
+  802f68:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802f6c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802f70:	83 c4 14             	add    $0x14,%esp
+  802f73:	5b                   	pop    %ebx
+  802f74:	5e                   	pop    %esi
+  802f75:	5f                   	pop    %edi
+  802f76:	5d                   	pop    %ebp
+  802f77:	c3                   	ret
+  802f78:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802f7c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802f80:	f7 d8                	neg    %eax
+  802f82:	83 d2 00             	adc    $0x0,%edx
+  802f85:	f7 da                	neg    %edx
+  802f87:	eb e7                	jmp    802f70 <__moddi3+0x56>
@@ -0,0 +1,6366 @@
+
+obj/user/ipcrange:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 0b 03 00 00       	call   80033c <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <fill>:
+	}
+}
+
+static void
+fill(int round)
+{
+  800033:	ba 00 00 00 10       	mov    $0x10000000,%edx
+	int i;
+
+	for (i = 0; i < NPAGES; i++)
+		buf[i * PGSIZE] = round + i;
+  800038:	88 02                	mov    %al,(%edx)
+	for (i = 0; i < NPAGES; i++)
+  80003a:	83 c0 01             	add    $0x1,%eax
+  80003d:	81 c2 00 10 00 00    	add    $0x1000,%edx
+  800043:	81 fa 00 00 10 10    	cmp    $0x10100000,%edx
+  800049:	75 ed                	jne    800038 <fill+0x5>
+}
+  80004b:	c3                   	ret
+
+0080004c <check>:
+{
+  80004c:	55                   	push   %ebp
+  80004d:	89 e5                	mov    %esp,%ebp
+  80004f:	57                   	push   %edi
+  800050:	56                   	push   %esi
+  800051:	53                   	push   %ebx
+  800052:	83 ec 0c             	sub    $0xc,%esp
+  800055:	89 c6                	mov    %eax,%esi
+  800057:	89 d7                	mov    %edx,%edi
+  800059:	b9 00 00 00 20       	mov    $0x20000000,%ecx
+	for (i = 0; i < NPAGES; i++)
+  80005e:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (win[i * PGSIZE] != (uint8_t) (round + i))
+  800063:	0f b6 11             	movzbl (%ecx),%edx
+  800066:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  80006c:	8d 1c 07             	lea    (%edi,%eax,1),%ebx
+  80006f:	38 da                	cmp    %bl,%dl
+  800071:	75 12                	jne    800085 <check+0x39>
+	for (i = 0; i < NPAGES; i++)
+  800073:	83 c0 01             	add    $0x1,%eax
+  800076:	3d 00 01 00 00       	cmp    $0x100,%eax
+  80007b:	75 e6                	jne    800063 <check+0x17>
+}
+  80007d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800080:	5b                   	pop    %ebx
+  800081:	5e                   	pop    %esi
+  800082:	5f                   	pop    %edi
+  800083:	5d                   	pop    %ebp
+  800084:	c3                   	ret
+			panic("%s: page %d holds %d in round %d", name, i,
+  800085:	83 ec 04             	sub    $0x4,%esp
+  800088:	57                   	push   %edi
+  800089:	0f b6 d2             	movzbl %dl,%edx
+  80008c:	52                   	push   %edx
+  80008d:	50                   	push   %eax
+  80008e:	56                   	push   %esi
+  80008f:	68 80 31 80 00       	push   $0x803180
+  800094:	6a 17                	push   $0x17
+  800096:	68 fb 31 80 00       	push   $0x8031fb
+  80009b:	e8 f7 02 00 00       	call   800397 <_panic>
+
+008000a0 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000a0:	55                   	push   %ebp
+  8000a1:	89 e5                	mov    %esp,%ebp
+  8000a3:	57                   	push   %edi
+  8000a4:	56                   	push   %esi
+  8000a5:	53                   	push   %ebx
+  8000a6:	83 ec 2c             	sub    $0x2c,%esp
+	envid_t child, parent = thisenv->env_id;
+  8000a9:	a1 08 40 80 00       	mov    0x804008,%eax
+  8000ae:	8b 40 48             	mov    0x48(%eax),%eax
+  8000b1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+	uint64_t start;
+	int round, i, r;
+
+	if ((child = fork()) < 0)
+  8000b4:	e8 47 2b 00 00       	call   802c00 <fork>
+  8000b9:	89 c6                	mov    %eax,%esi
+  8000bb:	85 c0                	test   %eax,%eax
+  8000bd:	0f 88 a4 01 00 00    	js     800267 <umain+0x1c7>
+		panic("fork: %e", child);
+	if (child == 0) {
+  8000c3:	0f 84 d4 01 00 00    	je     80029d <umain+0x1fd>
+  8000c9:	bb 00 00 00 10       	mov    $0x10000000,%ebx
+		receiver(parent);
+		return;
+	}
+
+	for (i = 0; i < NPAGES; i++)
+		if ((r = sys_page_alloc(0, buf + i * PGSIZE, PERM)) < 0)
+  8000ce:	83 ec 04             	sub    $0x4,%esp
+  8000d1:	6a 07                	push   $0x7
+  8000d3:	53                   	push   %ebx
+  8000d4:	6a 00                	push   $0x0
+  8000d6:	e8 f3 11 00 00       	call   8012ce <sys_page_alloc>
+  8000db:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8000e1:	83 c4 10             	add    $0x10,%esp
+  8000e4:	85 c0                	test   %eax,%eax
+  8000e6:	0f 88 9f 01 00 00    	js     80028b <umain+0x1eb>
+	for (i = 0; i < NPAGES; i++)
+  8000ec:	81 fb 00 00 10 10    	cmp    $0x10100000,%ebx
+  8000f2:	75 da                	jne    8000ce <umain+0x2e>
+
+static inline uint64_t
+read_tsc(void)
+{
+	uint64_t tsc;
+	asm volatile("rdtsc" : "=A" (tsc));
+  8000f4:	0f 31                	rdtsc
+  8000f6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8000f9:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+			panic("sys_page_alloc: %e", r);
+
+	start = read_tsc();
+	for (round = 0; round < NROUNDS; round++) {
+  8000fc:	bf 00 00 00 00       	mov    $0x0,%edi
+		fill(round);
+  800101:	89 f8                	mov    %edi,%eax
+  800103:	e8 2b ff ff ff       	call   800033 <fill>
+  800108:	bb 00 00 00 10       	mov    $0x10000000,%ebx
+		for (i = 0; i < NPAGES; i++)
+			ipc_send(child, 0, buf + i * PGSIZE, PERM);
+  80010d:	6a 07                	push   $0x7
+  80010f:	53                   	push   %ebx
+  800110:	6a 00                	push   $0x0
+  800112:	56                   	push   %esi
+  800113:	e8 a9 2b 00 00       	call   802cc1 <ipc_send>
+		for (i = 0; i < NPAGES; i++)
+  800118:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80011e:	83 c4 10             	add    $0x10,%esp
+  800121:	81 fb 00 00 10 10    	cmp    $0x10100000,%ebx
+  800127:	75 e4                	jne    80010d <umain+0x6d>
+		ipc_recv(0, 0, 0);
+  800129:	83 ec 04             	sub    $0x4,%esp
+  80012c:	6a 00                	push   $0x0
+  80012e:	6a 00                	push   $0x0
+  800130:	6a 00                	push   $0x0
+  800132:	e8 18 2b 00 00       	call   802c4f <ipc_recv>
+	for (round = 0; round < NROUNDS; round++) {
+  800137:	83 c7 01             	add    $0x1,%edi
+  80013a:	83 c4 10             	add    $0x10,%esp
+  80013d:	83 ff 14             	cmp    $0x14,%edi
+  800140:	75 bf                	jne    800101 <umain+0x61>
+  800142:	0f 31                	rdtsc
+	}
+	cprintf("per page  %d pages %10llu cycles/transfer\n",
+		NPAGES, (read_tsc() - start) / NROUNDS);
+  800144:	2b 45 d0             	sub    -0x30(%ebp),%eax
+  800147:	1b 55 d4             	sbb    -0x2c(%ebp),%edx
+	cprintf("per page  %d pages %10llu cycles/transfer\n",
+  80014a:	89 c1                	mov    %eax,%ecx
+  80014c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80014f:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  800152:	01 d1                	add    %edx,%ecx
+  800154:	83 d1 00             	adc    $0x0,%ecx
+  800157:	bf cd cc cc cc       	mov    $0xcccccccd,%edi
+  80015c:	89 c8                	mov    %ecx,%eax
+  80015e:	f7 e7                	mul    %edi
+  800160:	89 d3                	mov    %edx,%ebx
+  800162:	c1 eb 02             	shr    $0x2,%ebx
+  800165:	83 e2 fc             	and    $0xfffffffc,%edx
+  800168:	89 d0                	mov    %edx,%eax
+  80016a:	01 d8                	add    %ebx,%eax
+  80016c:	29 c1                	sub    %eax,%ecx
+  80016e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800173:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800176:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  800179:	29 c8                	sub    %ecx,%eax
+  80017b:	19 da                	sbb    %ebx,%edx
+  80017d:	69 ca cd cc cc cc    	imul   $0xcccccccd,%edx,%ecx
+  800183:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800186:	69 55 d0 cc cc cc cc 	imul   $0xcccccccc,-0x30(%ebp),%edx
+  80018d:	01 d1                	add    %edx,%ecx
+  80018f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800192:	f7 e7                	mul    %edi
+  800194:	01 ca                	add    %ecx,%edx
+  800196:	0f ac d0 02          	shrd   $0x2,%edx,%eax
+  80019a:	c1 ea 02             	shr    $0x2,%edx
+  80019d:	52                   	push   %edx
+  80019e:	50                   	push   %eax
+  80019f:	68 00 01 00 00       	push   $0x100
+  8001a4:	68 a4 31 80 00       	push   $0x8031a4
+  8001a9:	e8 fd 02 00 00       	call   8004ab <cprintf>
+  8001ae:	0f 31                	rdtsc
+  8001b0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8001b3:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  8001b6:	83 c4 10             	add    $0x10,%esp
+
+	start = read_tsc();
+	for (round = 0; round < NROUNDS; round++) {
+  8001b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		fill(round);
+  8001be:	89 d8                	mov    %ebx,%eax
+  8001c0:	e8 6e fe ff ff       	call   800033 <fill>
+		ipc_send_range(child, 0, buf, NPAGES, PERM);
+  8001c5:	83 ec 0c             	sub    $0xc,%esp
+  8001c8:	6a 07                	push   $0x7
+  8001ca:	68 00 01 00 00       	push   $0x100
+  8001cf:	68 00 00 00 10       	push   $0x10000000
+  8001d4:	6a 00                	push   $0x0
+  8001d6:	56                   	push   %esi
+  8001d7:	e8 39 2b 00 00       	call   802d15 <ipc_send_range>
+		ipc_recv(0, 0, 0);
+  8001dc:	83 c4 1c             	add    $0x1c,%esp
+  8001df:	6a 00                	push   $0x0
+  8001e1:	6a 00                	push   $0x0
+  8001e3:	6a 00                	push   $0x0
+  8001e5:	e8 65 2a 00 00       	call   802c4f <ipc_recv>
+	for (round = 0; round < NROUNDS; round++) {
+  8001ea:	83 c3 01             	add    $0x1,%ebx
+  8001ed:	83 c4 10             	add    $0x10,%esp
+  8001f0:	83 fb 14             	cmp    $0x14,%ebx
+  8001f3:	75 c9                	jne    8001be <umain+0x11e>
+  8001f5:	0f 31                	rdtsc
+	}
+	cprintf("range     %d pages %10llu cycles/transfer\n",
+		NPAGES, (read_tsc() - start) / NROUNDS);
+  8001f7:	2b 45 d0             	sub    -0x30(%ebp),%eax
+  8001fa:	1b 55 d4             	sbb    -0x2c(%ebp),%edx
+  8001fd:	89 c1                	mov    %eax,%ecx
+  8001ff:	89 d3                	mov    %edx,%ebx
+	cprintf("range     %d pages %10llu cycles/transfer\n",
+  800201:	89 c7                	mov    %eax,%edi
+  800203:	01 d7                	add    %edx,%edi
+  800205:	83 d7 00             	adc    $0x0,%edi
+  800208:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+  80020d:	89 f8                	mov    %edi,%eax
+  80020f:	f7 e6                	mul    %esi
+  800211:	89 d0                	mov    %edx,%eax
+  800213:	c1 e8 02             	shr    $0x2,%eax
+  800216:	83 e2 fc             	and    $0xfffffffc,%edx
+  800219:	01 d0                	add    %edx,%eax
+  80021b:	29 c7                	sub    %eax,%edi
+  80021d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800222:	29 f9                	sub    %edi,%ecx
+  800224:	19 d3                	sbb    %edx,%ebx
+  800226:	89 da                	mov    %ebx,%edx
+  800228:	69 db cd cc cc cc    	imul   $0xcccccccd,%ebx,%ebx
+  80022e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  800231:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  800234:	69 45 d0 cc cc cc cc 	imul   $0xcccccccc,-0x30(%ebp),%eax
+  80023b:	01 c3                	add    %eax,%ebx
+  80023d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800240:	f7 e6                	mul    %esi
+  800242:	01 da                	add    %ebx,%edx
+  800244:	0f ac d0 02          	shrd   $0x2,%edx,%eax
+  800248:	c1 ea 02             	shr    $0x2,%edx
+  80024b:	52                   	push   %edx
+  80024c:	50                   	push   %eax
+  80024d:	68 00 01 00 00       	push   $0x100
+  800252:	68 d0 31 80 00       	push   $0x8031d0
+  800257:	e8 4f 02 00 00       	call   8004ab <cprintf>
+  80025c:	83 c4 10             	add    $0x10,%esp
+}
+  80025f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800262:	5b                   	pop    %ebx
+  800263:	5e                   	pop    %esi
+  800264:	5f                   	pop    %edi
+  800265:	5d                   	pop    %ebp
+  800266:	c3                   	ret
+		panic("fork: %e", child);
+  800267:	50                   	push   %eax
+  800268:	68 0b 32 80 00       	push   $0x80320b
+  80026d:	6a 42                	push   $0x42
+  80026f:	68 fb 31 80 00       	push   $0x8031fb
+  800274:	e8 1e 01 00 00       	call   800397 <_panic>
+			panic("range: got %d pages", n);
+  800279:	50                   	push   %eax
+  80027a:	68 1d 32 80 00       	push   $0x80321d
+  80027f:	6a 2b                	push   $0x2b
+  800281:	68 fb 31 80 00       	push   $0x8031fb
+  800286:	e8 0c 01 00 00       	call   800397 <_panic>
+			panic("sys_page_alloc: %e", r);
+  80028b:	50                   	push   %eax
+  80028c:	68 37 32 80 00       	push   $0x803237
+  800291:	6a 4a                	push   $0x4a
+  800293:	68 fb 31 80 00       	push   $0x8031fb
+  800298:	e8 fa 00 00 00       	call   800397 <_panic>
+	for (round = 0; round < NROUNDS; round++) {
+  80029d:	89 c7                	mov    %eax,%edi
+{
+  80029f:	bb 00 00 00 20       	mov    $0x20000000,%ebx
+			ipc_recv(0, win + i * PGSIZE, 0);
+  8002a4:	83 ec 04             	sub    $0x4,%esp
+  8002a7:	6a 00                	push   $0x0
+  8002a9:	53                   	push   %ebx
+  8002aa:	6a 00                	push   $0x0
+  8002ac:	e8 9e 29 00 00       	call   802c4f <ipc_recv>
+		for (i = 0; i < NPAGES; i++)
+  8002b1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8002b7:	83 c4 10             	add    $0x10,%esp
+  8002ba:	81 fb 00 00 10 20    	cmp    $0x20100000,%ebx
+  8002c0:	75 e2                	jne    8002a4 <umain+0x204>
+		check("per page", round);
+  8002c2:	89 fa                	mov    %edi,%edx
+  8002c4:	b8 14 32 80 00       	mov    $0x803214,%eax
+  8002c9:	e8 7e fd ff ff       	call   80004c <check>
+		ipc_send(parent, 0, 0, 0);
+  8002ce:	6a 00                	push   $0x0
+  8002d0:	6a 00                	push   $0x0
+  8002d2:	6a 00                	push   $0x0
+  8002d4:	ff 75 d0             	push   -0x30(%ebp)
+  8002d7:	e8 e5 29 00 00       	call   802cc1 <ipc_send>
+	for (round = 0; round < NROUNDS; round++) {
+  8002dc:	83 c7 01             	add    $0x1,%edi
+  8002df:	83 c4 10             	add    $0x10,%esp
+  8002e2:	83 ff 14             	cmp    $0x14,%edi
+  8002e5:	75 b8                	jne    80029f <umain+0x1ff>
+		ipc_recv_range(0, win, &n, 0);
+  8002e7:	8d 5d e4             	lea    -0x1c(%ebp),%ebx
+  8002ea:	8b 7d d0             	mov    -0x30(%ebp),%edi
+		n = NPAGES;
+  8002ed:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+		ipc_recv_range(0, win, &n, 0);
+  8002f4:	6a 00                	push   $0x0
+  8002f6:	53                   	push   %ebx
+  8002f7:	68 00 00 00 20       	push   $0x20000000
+  8002fc:	6a 00                	push   $0x0
+  8002fe:	e8 62 2a 00 00       	call   802d65 <ipc_recv_range>
+		if (n != NPAGES)
+  800303:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800306:	83 c4 10             	add    $0x10,%esp
+  800309:	3d 00 01 00 00       	cmp    $0x100,%eax
+  80030e:	0f 85 65 ff ff ff    	jne    800279 <umain+0x1d9>
+		check("range", round);
+  800314:	89 f2                	mov    %esi,%edx
+  800316:	b8 31 32 80 00       	mov    $0x803231,%eax
+  80031b:	e8 2c fd ff ff       	call   80004c <check>
+		ipc_send(parent, 0, 0, 0);
+  800320:	6a 00                	push   $0x0
+  800322:	6a 00                	push   $0x0
+  800324:	6a 00                	push   $0x0
+  800326:	57                   	push   %edi
+  800327:	e8 95 29 00 00       	call   802cc1 <ipc_send>
+	for (round = 0; round < NROUNDS; round++) {
+  80032c:	83 c6 01             	add    $0x1,%esi
+  80032f:	83 c4 10             	add    $0x10,%esp
+  800332:	83 fe 14             	cmp    $0x14,%esi
+  800335:	75 b6                	jne    8002ed <umain+0x24d>
+  800337:	e9 23 ff ff ff       	jmp    80025f <umain+0x1bf>
+
+0080033c <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80033c:	55                   	push   %ebp
+  80033d:	89 e5                	mov    %esp,%ebp
+  80033f:	56                   	push   %esi
+  800340:	53                   	push   %ebx
+  800341:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800344:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  800347:	e8 e3 0e 00 00       	call   80122f <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  80034c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800351:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  800357:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80035c:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800361:	85 db                	test   %ebx,%ebx
+  800363:	7e 07                	jle    80036c <libmain+0x30>
+		binaryname = argv[0];
+  800365:	8b 06                	mov    (%esi),%eax
+  800367:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  80036c:	83 ec 08             	sub    $0x8,%esp
+  80036f:	56                   	push   %esi
+  800370:	53                   	push   %ebx
+  800371:	e8 2a fd ff ff       	call   8000a0 <umain>
+
+	// exit gracefully
+	exit();
+  800376:	e8 0a 00 00 00       	call   800385 <exit>
+}
+  80037b:	83 c4 10             	add    $0x10,%esp
+  80037e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800381:	5b                   	pop    %ebx
+  800382:	5e                   	pop    %esi
+  800383:	5d                   	pop    %ebp
+  800384:	c3                   	ret
+
+00800385 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800385:	55                   	push   %ebp
+  800386:	89 e5                	mov    %esp,%ebp
+  800388:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  80038b:	6a 00                	push   $0x0
+  80038d:	e8 db 0d 00 00       	call   80116d <sys_env_destroy>
+}
+  800392:	83 c4 10             	add    $0x10,%esp
+  800395:	c9                   	leave
+  800396:	c3                   	ret
+
+00800397 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800397:	55                   	push   %ebp
+  800398:	89 e5                	mov    %esp,%ebp
+  80039a:	57                   	push   %edi
+  80039b:	56                   	push   %esi
+  80039c:	53                   	push   %ebx
+  80039d:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  8003a3:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  8003a6:	8b 1d 00 40 80 00    	mov    0x804000,%ebx
+  8003ac:	e8 7e 0e 00 00       	call   80122f <sys_getenvid>
+  8003b1:	83 ec 04             	sub    $0x4,%esp
+  8003b4:	ff 75 0c             	push   0xc(%ebp)
+  8003b7:	ff 75 08             	push   0x8(%ebp)
+  8003ba:	53                   	push   %ebx
+  8003bb:	50                   	push   %eax
+  8003bc:	68 54 32 80 00       	push   $0x803254
+  8003c1:	68 00 01 00 00       	push   $0x100
+  8003c6:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  8003cc:	56                   	push   %esi
+  8003cd:	e8 72 06 00 00       	call   800a44 <snprintf>
+  8003d2:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  8003d4:	83 c4 20             	add    $0x20,%esp
+  8003d7:	57                   	push   %edi
+  8003d8:	ff 75 10             	push   0x10(%ebp)
+  8003db:	bf 00 01 00 00       	mov    $0x100,%edi
+  8003e0:	89 f8                	mov    %edi,%eax
+  8003e2:	29 d8                	sub    %ebx,%eax
+  8003e4:	50                   	push   %eax
+  8003e5:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8003e8:	50                   	push   %eax
+  8003e9:	e8 08 06 00 00       	call   8009f6 <vsnprintf>
+  8003ee:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  8003f0:	83 c4 0c             	add    $0xc,%esp
+  8003f3:	68 77 32 80 00       	push   $0x803277
+  8003f8:	29 df                	sub    %ebx,%edi
+  8003fa:	57                   	push   %edi
+  8003fb:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8003fe:	50                   	push   %eax
+  8003ff:	e8 40 06 00 00       	call   800a44 <snprintf>
+	sys_cputs(buf, r);
+  800404:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  800407:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  800409:	53                   	push   %ebx
+  80040a:	56                   	push   %esi
+  80040b:	e8 21 0c 00 00       	call   801031 <sys_cputs>
+  800410:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800413:	cc                   	int3
+	while (1)
+  800414:	eb fd                	jmp    800413 <_panic+0x7c>
+
+00800416 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800416:	55                   	push   %ebp
+  800417:	89 e5                	mov    %esp,%ebp
+  800419:	53                   	push   %ebx
+  80041a:	83 ec 04             	sub    $0x4,%esp
+  80041d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800420:	8b 13                	mov    (%ebx),%edx
+  800422:	8d 42 01             	lea    0x1(%edx),%eax
+  800425:	89 03                	mov    %eax,(%ebx)
+  800427:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80042a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80042e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800433:	74 09                	je     80043e <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800435:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800439:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80043c:	c9                   	leave
+  80043d:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80043e:	83 ec 08             	sub    $0x8,%esp
+  800441:	68 ff 00 00 00       	push   $0xff
+  800446:	8d 43 08             	lea    0x8(%ebx),%eax
+  800449:	50                   	push   %eax
+  80044a:	e8 e2 0b 00 00       	call   801031 <sys_cputs>
+		b->idx = 0;
+  80044f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800455:	83 c4 10             	add    $0x10,%esp
+  800458:	eb db                	jmp    800435 <putch+0x1f>
+
+0080045a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80045a:	55                   	push   %ebp
+  80045b:	89 e5                	mov    %esp,%ebp
+  80045d:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800463:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80046a:	00 00 00 
+	b.cnt = 0;
+  80046d:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800474:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800477:	ff 75 0c             	push   0xc(%ebp)
+  80047a:	ff 75 08             	push   0x8(%ebp)
+  80047d:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800483:	50                   	push   %eax
+  800484:	68 16 04 80 00       	push   $0x800416
+  800489:	e8 14 01 00 00       	call   8005a2 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80048e:	83 c4 08             	add    $0x8,%esp
+  800491:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800497:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80049d:	50                   	push   %eax
+  80049e:	e8 8e 0b 00 00       	call   801031 <sys_cputs>
+
+	return b.cnt;
+}
+  8004a3:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8004a9:	c9                   	leave
+  8004aa:	c3                   	ret
+
+008004ab <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8004ab:	55                   	push   %ebp
+  8004ac:	89 e5                	mov    %esp,%ebp
+  8004ae:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8004b1:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8004b4:	50                   	push   %eax
+  8004b5:	ff 75 08             	push   0x8(%ebp)
+  8004b8:	e8 9d ff ff ff       	call   80045a <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8004bd:	c9                   	leave
+  8004be:	c3                   	ret
+
+008004bf <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8004bf:	55                   	push   %ebp
+  8004c0:	89 e5                	mov    %esp,%ebp
+  8004c2:	57                   	push   %edi
+  8004c3:	56                   	push   %esi
+  8004c4:	53                   	push   %ebx
+  8004c5:	83 ec 1c             	sub    $0x1c,%esp
+  8004c8:	89 c7                	mov    %eax,%edi
+  8004ca:	89 d6                	mov    %edx,%esi
+  8004cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004cf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8004d2:	89 d1                	mov    %edx,%ecx
+  8004d4:	89 c2                	mov    %eax,%edx
+  8004d6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004d9:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004dc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8004df:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8004e2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004e5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8004ec:	39 c2                	cmp    %eax,%edx
+  8004ee:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8004f1:	72 3e                	jb     800531 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8004f3:	83 ec 0c             	sub    $0xc,%esp
+  8004f6:	ff 75 18             	push   0x18(%ebp)
+  8004f9:	83 eb 01             	sub    $0x1,%ebx
+  8004fc:	53                   	push   %ebx
+  8004fd:	50                   	push   %eax
+  8004fe:	83 ec 08             	sub    $0x8,%esp
+  800501:	ff 75 e4             	push   -0x1c(%ebp)
+  800504:	ff 75 e0             	push   -0x20(%ebp)
+  800507:	ff 75 dc             	push   -0x24(%ebp)
+  80050a:	ff 75 d8             	push   -0x28(%ebp)
+  80050d:	e8 2f 2b 00 00       	call   803041 <__udivdi3>
+  800512:	83 c4 18             	add    $0x18,%esp
+  800515:	52                   	push   %edx
+  800516:	50                   	push   %eax
+  800517:	89 f2                	mov    %esi,%edx
+  800519:	89 f8                	mov    %edi,%eax
+  80051b:	e8 9f ff ff ff       	call   8004bf <printnum>
+  800520:	83 c4 20             	add    $0x20,%esp
+  800523:	eb 13                	jmp    800538 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800525:	83 ec 08             	sub    $0x8,%esp
+  800528:	56                   	push   %esi
+  800529:	ff 75 18             	push   0x18(%ebp)
+  80052c:	ff d7                	call   *%edi
+  80052e:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800531:	83 eb 01             	sub    $0x1,%ebx
+  800534:	85 db                	test   %ebx,%ebx
+  800536:	7f ed                	jg     800525 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800538:	83 ec 08             	sub    $0x8,%esp
+  80053b:	56                   	push   %esi
+  80053c:	83 ec 04             	sub    $0x4,%esp
+  80053f:	ff 75 e4             	push   -0x1c(%ebp)
+  800542:	ff 75 e0             	push   -0x20(%ebp)
+  800545:	ff 75 dc             	push   -0x24(%ebp)
+  800548:	ff 75 d8             	push   -0x28(%ebp)
+  80054b:	e8 0f 2b 00 00       	call   80305f <__umoddi3>
+  800550:	83 c4 14             	add    $0x14,%esp
+  800553:	0f be 80 79 32 80 00 	movsbl 0x803279(%eax),%eax
+  80055a:	50                   	push   %eax
+  80055b:	ff d7                	call   *%edi
+}
+  80055d:	83 c4 10             	add    $0x10,%esp
+  800560:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800563:	5b                   	pop    %ebx
+  800564:	5e                   	pop    %esi
+  800565:	5f                   	pop    %edi
+  800566:	5d                   	pop    %ebp
+  800567:	c3                   	ret
+
+00800568 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800568:	55                   	push   %ebp
+  800569:	89 e5                	mov    %esp,%ebp
+  80056b:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80056e:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800572:	8b 10                	mov    (%eax),%edx
+  800574:	3b 50 04             	cmp    0x4(%eax),%edx
+  800577:	73 0a                	jae    800583 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800579:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80057c:	89 08                	mov    %ecx,(%eax)
+  80057e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800581:	88 02                	mov    %al,(%edx)
+}
+  800583:	5d                   	pop    %ebp
+  800584:	c3                   	ret
+
+00800585 <printfmt>:
+{
+  800585:	55                   	push   %ebp
+  800586:	89 e5                	mov    %esp,%ebp
+  800588:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80058b:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80058e:	50                   	push   %eax
+  80058f:	ff 75 10             	push   0x10(%ebp)
+  800592:	ff 75 0c             	push   0xc(%ebp)
+  800595:	ff 75 08             	push   0x8(%ebp)
+  800598:	e8 05 00 00 00       	call   8005a2 <vprintfmt>
+}
+  80059d:	83 c4 10             	add    $0x10,%esp
+  8005a0:	c9                   	leave
+  8005a1:	c3                   	ret
+
+008005a2 <vprintfmt>:
+{
+  8005a2:	55                   	push   %ebp
+  8005a3:	89 e5                	mov    %esp,%ebp
+  8005a5:	57                   	push   %edi
+  8005a6:	56                   	push   %esi
+  8005a7:	53                   	push   %ebx
+  8005a8:	83 ec 2c             	sub    $0x2c,%esp
+  8005ab:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005ae:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005b1:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8005b4:	eb 0a                	jmp    8005c0 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8005b6:	83 ec 08             	sub    $0x8,%esp
+  8005b9:	53                   	push   %ebx
+  8005ba:	50                   	push   %eax
+  8005bb:	ff d6                	call   *%esi
+  8005bd:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8005c0:	83 c7 01             	add    $0x1,%edi
+  8005c3:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8005c7:	83 f8 25             	cmp    $0x25,%eax
+  8005ca:	74 0c                	je     8005d8 <vprintfmt+0x36>
+			if (ch == '\0')
+  8005cc:	85 c0                	test   %eax,%eax
+  8005ce:	75 e6                	jne    8005b6 <vprintfmt+0x14>
+}
+  8005d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005d3:	5b                   	pop    %ebx
+  8005d4:	5e                   	pop    %esi
+  8005d5:	5f                   	pop    %edi
+  8005d6:	5d                   	pop    %ebp
+  8005d7:	c3                   	ret
+		padc = ' ';
+  8005d8:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8005dc:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8005e3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8005ea:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8005f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8005f6:	8d 47 01             	lea    0x1(%edi),%eax
+  8005f9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8005fc:	0f b6 17             	movzbl (%edi),%edx
+  8005ff:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800602:	3c 55                	cmp    $0x55,%al
+  800604:	0f 87 cf 03 00 00    	ja     8009d9 <vprintfmt+0x437>
+  80060a:	0f b6 c0             	movzbl %al,%eax
+  80060d:	ff 24 85 60 33 80 00 	jmp    *0x803360(,%eax,4)
+  800614:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800617:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80061b:	eb d9                	jmp    8005f6 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80061d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800620:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800624:	eb d0                	jmp    8005f6 <vprintfmt+0x54>
+  800626:	0f b6 d2             	movzbl %dl,%edx
+  800629:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80062c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800631:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800634:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800637:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80063b:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80063e:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800641:	83 f9 09             	cmp    $0x9,%ecx
+  800644:	77 55                	ja     80069b <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800646:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800649:	eb e9                	jmp    800634 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80064b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064e:	8b 00                	mov    (%eax),%eax
+  800650:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800653:	8b 45 14             	mov    0x14(%ebp),%eax
+  800656:	8d 40 04             	lea    0x4(%eax),%eax
+  800659:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80065c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80065f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800663:	79 91                	jns    8005f6 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800665:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800668:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80066b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800672:	eb 82                	jmp    8005f6 <vprintfmt+0x54>
+			if (width < 0)
+  800674:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800677:	85 d2                	test   %edx,%edx
+  800679:	b8 00 00 00 00       	mov    $0x0,%eax
+  80067e:	0f 49 c2             	cmovns %edx,%eax
+  800681:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800684:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800687:	e9 6a ff ff ff       	jmp    8005f6 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80068c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80068f:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800696:	e9 5b ff ff ff       	jmp    8005f6 <vprintfmt+0x54>
+  80069b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80069e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006a1:	eb bc                	jmp    80065f <vprintfmt+0xbd>
+			lflag++;
+  8006a3:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8006a6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8006a9:	e9 48 ff ff ff       	jmp    8005f6 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8006ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b1:	8d 78 04             	lea    0x4(%eax),%edi
+  8006b4:	83 ec 08             	sub    $0x8,%esp
+  8006b7:	53                   	push   %ebx
+  8006b8:	ff 30                	push   (%eax)
+  8006ba:	ff d6                	call   *%esi
+			break;
+  8006bc:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8006bf:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8006c2:	e9 b1 02 00 00       	jmp    800978 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8006c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ca:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8006cd:	8b 10                	mov    (%eax),%edx
+  8006cf:	89 d0                	mov    %edx,%eax
+  8006d1:	f7 d8                	neg    %eax
+  8006d3:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8006d6:	83 f8 0d             	cmp    $0xd,%eax
+  8006d9:	7f 23                	jg     8006fe <vprintfmt+0x15c>
+  8006db:	8b 14 85 c0 34 80 00 	mov    0x8034c0(,%eax,4),%edx
+  8006e2:	85 d2                	test   %edx,%edx
+  8006e4:	74 18                	je     8006fe <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8006e6:	52                   	push   %edx
+  8006e7:	68 9a 32 80 00       	push   $0x80329a
+  8006ec:	53                   	push   %ebx
+  8006ed:	56                   	push   %esi
+  8006ee:	e8 92 fe ff ff       	call   800585 <printfmt>
+  8006f3:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006f6:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8006f9:	e9 7a 02 00 00       	jmp    800978 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8006fe:	50                   	push   %eax
+  8006ff:	68 91 32 80 00       	push   $0x803291
+  800704:	53                   	push   %ebx
+  800705:	56                   	push   %esi
+  800706:	e8 7a fe ff ff       	call   800585 <printfmt>
+  80070b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80070e:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800711:	e9 62 02 00 00       	jmp    800978 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800716:	8b 45 14             	mov    0x14(%ebp),%eax
+  800719:	83 c0 04             	add    $0x4,%eax
+  80071c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80071f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800722:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800724:	85 c9                	test   %ecx,%ecx
+  800726:	b8 8a 32 80 00       	mov    $0x80328a,%eax
+  80072b:	0f 45 c1             	cmovne %ecx,%eax
+  80072e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800731:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800735:	7e 06                	jle    80073d <vprintfmt+0x19b>
+  800737:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80073b:	75 0b                	jne    800748 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80073d:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800740:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800743:	89 75 08             	mov    %esi,0x8(%ebp)
+  800746:	eb 5c                	jmp    8007a4 <vprintfmt+0x202>
+  800748:	83 ec 08             	sub    $0x8,%esp
+  80074b:	ff 75 d0             	push   -0x30(%ebp)
+  80074e:	ff 75 cc             	push   -0x34(%ebp)
+  800751:	e8 20 03 00 00       	call   800a76 <strnlen>
+  800756:	89 c2                	mov    %eax,%edx
+  800758:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80075b:	29 d0                	sub    %edx,%eax
+  80075d:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800760:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800764:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800767:	89 75 08             	mov    %esi,0x8(%ebp)
+  80076a:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80076c:	eb 0e                	jmp    80077c <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80076e:	83 ec 08             	sub    $0x8,%esp
+  800771:	53                   	push   %ebx
+  800772:	57                   	push   %edi
+  800773:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800776:	83 ee 01             	sub    $0x1,%esi
+  800779:	83 c4 10             	add    $0x10,%esp
+  80077c:	85 f6                	test   %esi,%esi
+  80077e:	7f ee                	jg     80076e <vprintfmt+0x1cc>
+  800780:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800783:	8b 75 08             	mov    0x8(%ebp),%esi
+  800786:	85 c0                	test   %eax,%eax
+  800788:	ba 00 00 00 00       	mov    $0x0,%edx
+  80078d:	0f 49 d0             	cmovns %eax,%edx
+  800790:	29 d0                	sub    %edx,%eax
+  800792:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800795:	eb a6                	jmp    80073d <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800797:	83 ec 08             	sub    $0x8,%esp
+  80079a:	53                   	push   %ebx
+  80079b:	52                   	push   %edx
+  80079c:	ff 55 08             	call   *0x8(%ebp)
+  80079f:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007a2:	89 f1                	mov    %esi,%ecx
+  8007a4:	8d 71 01             	lea    0x1(%ecx),%esi
+  8007a7:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8007ab:	0f be d0             	movsbl %al,%edx
+  8007ae:	85 d2                	test   %edx,%edx
+  8007b0:	74 28                	je     8007da <vprintfmt+0x238>
+  8007b2:	85 ff                	test   %edi,%edi
+  8007b4:	78 05                	js     8007bb <vprintfmt+0x219>
+  8007b6:	83 ef 01             	sub    $0x1,%edi
+  8007b9:	78 30                	js     8007eb <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8007bb:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8007bf:	74 d6                	je     800797 <vprintfmt+0x1f5>
+  8007c1:	0f be c0             	movsbl %al,%eax
+  8007c4:	83 e8 20             	sub    $0x20,%eax
+  8007c7:	83 f8 5e             	cmp    $0x5e,%eax
+  8007ca:	76 cb                	jbe    800797 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8007cc:	83 ec 08             	sub    $0x8,%esp
+  8007cf:	53                   	push   %ebx
+  8007d0:	6a 3f                	push   $0x3f
+  8007d2:	ff 55 08             	call   *0x8(%ebp)
+  8007d5:	83 c4 10             	add    $0x10,%esp
+  8007d8:	eb c8                	jmp    8007a2 <vprintfmt+0x200>
+  8007da:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007dd:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007e0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8007e3:	01 d0                	add    %edx,%eax
+  8007e5:	29 c8                	sub    %ecx,%eax
+  8007e7:	89 c7                	mov    %eax,%edi
+  8007e9:	eb 13                	jmp    8007fe <vprintfmt+0x25c>
+  8007eb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007ee:	eb ed                	jmp    8007dd <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8007f0:	83 ec 08             	sub    $0x8,%esp
+  8007f3:	53                   	push   %ebx
+  8007f4:	6a 20                	push   $0x20
+  8007f6:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8007f8:	83 ef 01             	sub    $0x1,%edi
+  8007fb:	83 c4 10             	add    $0x10,%esp
+  8007fe:	85 ff                	test   %edi,%edi
+  800800:	7f ee                	jg     8007f0 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800802:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800805:	89 45 14             	mov    %eax,0x14(%ebp)
+  800808:	e9 6b 01 00 00       	jmp    800978 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80080d:	83 f9 01             	cmp    $0x1,%ecx
+  800810:	7f 1f                	jg     800831 <vprintfmt+0x28f>
+	else if (lflag)
+  800812:	85 c9                	test   %ecx,%ecx
+  800814:	74 67                	je     80087d <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800816:	8b 45 14             	mov    0x14(%ebp),%eax
+  800819:	8b 00                	mov    (%eax),%eax
+  80081b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80081e:	89 c1                	mov    %eax,%ecx
+  800820:	c1 f9 1f             	sar    $0x1f,%ecx
+  800823:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800826:	8b 45 14             	mov    0x14(%ebp),%eax
+  800829:	8d 40 04             	lea    0x4(%eax),%eax
+  80082c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80082f:	eb 17                	jmp    800848 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800831:	8b 45 14             	mov    0x14(%ebp),%eax
+  800834:	8b 50 04             	mov    0x4(%eax),%edx
+  800837:	8b 00                	mov    (%eax),%eax
+  800839:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80083c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80083f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800842:	8d 40 08             	lea    0x8(%eax),%eax
+  800845:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800848:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80084b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80084e:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800853:	85 c9                	test   %ecx,%ecx
+  800855:	0f 89 03 01 00 00    	jns    80095e <vprintfmt+0x3bc>
+				putch('-', putdat);
+  80085b:	83 ec 08             	sub    $0x8,%esp
+  80085e:	53                   	push   %ebx
+  80085f:	6a 2d                	push   $0x2d
+  800861:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800863:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800866:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800869:	f7 da                	neg    %edx
+  80086b:	83 d1 00             	adc    $0x0,%ecx
+  80086e:	f7 d9                	neg    %ecx
+  800870:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800873:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800878:	e9 e1 00 00 00       	jmp    80095e <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80087d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800880:	8b 00                	mov    (%eax),%eax
+  800882:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800885:	89 c1                	mov    %eax,%ecx
+  800887:	c1 f9 1f             	sar    $0x1f,%ecx
+  80088a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80088d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800890:	8d 40 04             	lea    0x4(%eax),%eax
+  800893:	89 45 14             	mov    %eax,0x14(%ebp)
+  800896:	eb b0                	jmp    800848 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800898:	83 f9 01             	cmp    $0x1,%ecx
+  80089b:	7f 1e                	jg     8008bb <vprintfmt+0x319>
+	else if (lflag)
+  80089d:	85 c9                	test   %ecx,%ecx
+  80089f:	74 32                	je     8008d3 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8008a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a4:	8b 10                	mov    (%eax),%edx
+  8008a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008ab:	8d 40 04             	lea    0x4(%eax),%eax
+  8008ae:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008b1:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8008b6:	e9 a3 00 00 00       	jmp    80095e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8008bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008be:	8b 10                	mov    (%eax),%edx
+  8008c0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008c3:	8d 40 08             	lea    0x8(%eax),%eax
+  8008c6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008c9:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8008ce:	e9 8b 00 00 00       	jmp    80095e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8008d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d6:	8b 10                	mov    (%eax),%edx
+  8008d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008dd:	8d 40 04             	lea    0x4(%eax),%eax
+  8008e0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008e3:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8008e8:	eb 74                	jmp    80095e <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8008ea:	83 f9 01             	cmp    $0x1,%ecx
+  8008ed:	7f 1b                	jg     80090a <vprintfmt+0x368>
+	else if (lflag)
+  8008ef:	85 c9                	test   %ecx,%ecx
+  8008f1:	74 2c                	je     80091f <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8008f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f6:	8b 10                	mov    (%eax),%edx
+  8008f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008fd:	8d 40 04             	lea    0x4(%eax),%eax
+  800900:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800903:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800908:	eb 54                	jmp    80095e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80090a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80090d:	8b 10                	mov    (%eax),%edx
+  80090f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800912:	8d 40 08             	lea    0x8(%eax),%eax
+  800915:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800918:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80091d:	eb 3f                	jmp    80095e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80091f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800922:	8b 10                	mov    (%eax),%edx
+  800924:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800929:	8d 40 04             	lea    0x4(%eax),%eax
+  80092c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80092f:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800934:	eb 28                	jmp    80095e <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800936:	83 ec 08             	sub    $0x8,%esp
+  800939:	53                   	push   %ebx
+  80093a:	6a 30                	push   $0x30
+  80093c:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80093e:	83 c4 08             	add    $0x8,%esp
+  800941:	53                   	push   %ebx
+  800942:	6a 78                	push   $0x78
+  800944:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800946:	8b 45 14             	mov    0x14(%ebp),%eax
+  800949:	8b 10                	mov    (%eax),%edx
+  80094b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800950:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800953:	8d 40 04             	lea    0x4(%eax),%eax
+  800956:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800959:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80095e:	83 ec 0c             	sub    $0xc,%esp
+  800961:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800965:	50                   	push   %eax
+  800966:	ff 75 e0             	push   -0x20(%ebp)
+  800969:	57                   	push   %edi
+  80096a:	51                   	push   %ecx
+  80096b:	52                   	push   %edx
+  80096c:	89 da                	mov    %ebx,%edx
+  80096e:	89 f0                	mov    %esi,%eax
+  800970:	e8 4a fb ff ff       	call   8004bf <printnum>
+			break;
+  800975:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800978:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80097b:	e9 40 fc ff ff       	jmp    8005c0 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800980:	83 f9 01             	cmp    $0x1,%ecx
+  800983:	7f 1b                	jg     8009a0 <vprintfmt+0x3fe>
+	else if (lflag)
+  800985:	85 c9                	test   %ecx,%ecx
+  800987:	74 2c                	je     8009b5 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800989:	8b 45 14             	mov    0x14(%ebp),%eax
+  80098c:	8b 10                	mov    (%eax),%edx
+  80098e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800993:	8d 40 04             	lea    0x4(%eax),%eax
+  800996:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800999:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80099e:	eb be                	jmp    80095e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8009a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009a3:	8b 10                	mov    (%eax),%edx
+  8009a5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009a8:	8d 40 08             	lea    0x8(%eax),%eax
+  8009ab:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009ae:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8009b3:	eb a9                	jmp    80095e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8009b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009b8:	8b 10                	mov    (%eax),%edx
+  8009ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009bf:	8d 40 04             	lea    0x4(%eax),%eax
+  8009c2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009c5:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8009ca:	eb 92                	jmp    80095e <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8009cc:	83 ec 08             	sub    $0x8,%esp
+  8009cf:	53                   	push   %ebx
+  8009d0:	6a 25                	push   $0x25
+  8009d2:	ff d6                	call   *%esi
+			break;
+  8009d4:	83 c4 10             	add    $0x10,%esp
+  8009d7:	eb 9f                	jmp    800978 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8009d9:	83 ec 08             	sub    $0x8,%esp
+  8009dc:	53                   	push   %ebx
+  8009dd:	6a 25                	push   $0x25
+  8009df:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8009e1:	83 c4 10             	add    $0x10,%esp
+  8009e4:	89 f8                	mov    %edi,%eax
+  8009e6:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8009ea:	74 05                	je     8009f1 <vprintfmt+0x44f>
+  8009ec:	83 e8 01             	sub    $0x1,%eax
+  8009ef:	eb f5                	jmp    8009e6 <vprintfmt+0x444>
+  8009f1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8009f4:	eb 82                	jmp    800978 <vprintfmt+0x3d6>
+
+008009f6 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8009f6:	55                   	push   %ebp
+  8009f7:	89 e5                	mov    %esp,%ebp
+  8009f9:	83 ec 18             	sub    $0x18,%esp
+  8009fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ff:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800a02:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800a05:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a09:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800a0c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800a13:	85 c0                	test   %eax,%eax
+  800a15:	74 26                	je     800a3d <vsnprintf+0x47>
+  800a17:	85 d2                	test   %edx,%edx
+  800a19:	7e 22                	jle    800a3d <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800a1b:	ff 75 14             	push   0x14(%ebp)
+  800a1e:	ff 75 10             	push   0x10(%ebp)
+  800a21:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800a24:	50                   	push   %eax
+  800a25:	68 68 05 80 00       	push   $0x800568
+  800a2a:	e8 73 fb ff ff       	call   8005a2 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800a2f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800a32:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800a35:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a38:	83 c4 10             	add    $0x10,%esp
+}
+  800a3b:	c9                   	leave
+  800a3c:	c3                   	ret
+		return -E_INVAL;
+  800a3d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a42:	eb f7                	jmp    800a3b <vsnprintf+0x45>
+
+00800a44 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a44:	55                   	push   %ebp
+  800a45:	89 e5                	mov    %esp,%ebp
+  800a47:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800a4a:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800a4d:	50                   	push   %eax
+  800a4e:	ff 75 10             	push   0x10(%ebp)
+  800a51:	ff 75 0c             	push   0xc(%ebp)
+  800a54:	ff 75 08             	push   0x8(%ebp)
+  800a57:	e8 9a ff ff ff       	call   8009f6 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800a5c:	c9                   	leave
+  800a5d:	c3                   	ret
+
+00800a5e <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a5e:	55                   	push   %ebp
+  800a5f:	89 e5                	mov    %esp,%ebp
+  800a61:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800a64:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a69:	eb 03                	jmp    800a6e <strlen+0x10>
+		n++;
+  800a6b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800a6e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a72:	75 f7                	jne    800a6b <strlen+0xd>
+	return n;
+}
+  800a74:	5d                   	pop    %ebp
+  800a75:	c3                   	ret
+
+00800a76 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a76:	55                   	push   %ebp
+  800a77:	89 e5                	mov    %esp,%ebp
+  800a79:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a7c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a84:	eb 03                	jmp    800a89 <strnlen+0x13>
+		n++;
+  800a86:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a89:	39 d0                	cmp    %edx,%eax
+  800a8b:	74 08                	je     800a95 <strnlen+0x1f>
+  800a8d:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a91:	75 f3                	jne    800a86 <strnlen+0x10>
+  800a93:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800a95:	89 d0                	mov    %edx,%eax
+  800a97:	5d                   	pop    %ebp
+  800a98:	c3                   	ret
+
+00800a99 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a99:	55                   	push   %ebp
+  800a9a:	89 e5                	mov    %esp,%ebp
+  800a9c:	53                   	push   %ebx
+  800a9d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800aa0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800aa3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aa8:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800aac:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800aaf:	83 c0 01             	add    $0x1,%eax
+  800ab2:	84 d2                	test   %dl,%dl
+  800ab4:	75 f2                	jne    800aa8 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800ab6:	89 c8                	mov    %ecx,%eax
+  800ab8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800abb:	c9                   	leave
+  800abc:	c3                   	ret
+
+00800abd <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800abd:	55                   	push   %ebp
+  800abe:	89 e5                	mov    %esp,%ebp
+  800ac0:	53                   	push   %ebx
+  800ac1:	83 ec 10             	sub    $0x10,%esp
+  800ac4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800ac7:	53                   	push   %ebx
+  800ac8:	e8 91 ff ff ff       	call   800a5e <strlen>
+  800acd:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800ad0:	ff 75 0c             	push   0xc(%ebp)
+  800ad3:	01 d8                	add    %ebx,%eax
+  800ad5:	50                   	push   %eax
+  800ad6:	e8 be ff ff ff       	call   800a99 <strcpy>
+	return dst;
+}
+  800adb:	89 d8                	mov    %ebx,%eax
+  800add:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ae0:	c9                   	leave
+  800ae1:	c3                   	ret
+
+00800ae2 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ae2:	55                   	push   %ebp
+  800ae3:	89 e5                	mov    %esp,%ebp
+  800ae5:	56                   	push   %esi
+  800ae6:	53                   	push   %ebx
+  800ae7:	8b 75 08             	mov    0x8(%ebp),%esi
+  800aea:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800aed:	89 f3                	mov    %esi,%ebx
+  800aef:	03 5d 10             	add    0x10(%ebp),%ebx
+  800af2:	89 f0                	mov    %esi,%eax
+  800af4:	eb 0f                	jmp    800b05 <strncpy+0x23>
+		*dst++ = *src;
+  800af6:	83 c0 01             	add    $0x1,%eax
+  800af9:	0f b6 0a             	movzbl (%edx),%ecx
+  800afc:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800aff:	80 f9 01             	cmp    $0x1,%cl
+  800b02:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800b05:	39 d8                	cmp    %ebx,%eax
+  800b07:	75 ed                	jne    800af6 <strncpy+0x14>
+	}
+	return ret;
+}
+  800b09:	89 f0                	mov    %esi,%eax
+  800b0b:	5b                   	pop    %ebx
+  800b0c:	5e                   	pop    %esi
+  800b0d:	5d                   	pop    %ebp
+  800b0e:	c3                   	ret
+
+00800b0f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800b0f:	55                   	push   %ebp
+  800b10:	89 e5                	mov    %esp,%ebp
+  800b12:	56                   	push   %esi
+  800b13:	53                   	push   %ebx
+  800b14:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b1a:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800b1d:	89 f0                	mov    %esi,%eax
+  800b1f:	85 d2                	test   %edx,%edx
+  800b21:	74 21                	je     800b44 <strlcpy+0x35>
+  800b23:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800b27:	89 f2                	mov    %esi,%edx
+  800b29:	eb 09                	jmp    800b34 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800b2b:	83 c1 01             	add    $0x1,%ecx
+  800b2e:	83 c2 01             	add    $0x1,%edx
+  800b31:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800b34:	39 c2                	cmp    %eax,%edx
+  800b36:	74 09                	je     800b41 <strlcpy+0x32>
+  800b38:	0f b6 19             	movzbl (%ecx),%ebx
+  800b3b:	84 db                	test   %bl,%bl
+  800b3d:	75 ec                	jne    800b2b <strlcpy+0x1c>
+  800b3f:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800b41:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800b44:	29 f0                	sub    %esi,%eax
+}
+  800b46:	5b                   	pop    %ebx
+  800b47:	5e                   	pop    %esi
+  800b48:	5d                   	pop    %ebp
+  800b49:	c3                   	ret
+
+00800b4a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b4a:	55                   	push   %ebp
+  800b4b:	89 e5                	mov    %esp,%ebp
+  800b4d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b50:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800b53:	eb 06                	jmp    800b5b <strcmp+0x11>
+		p++, q++;
+  800b55:	83 c1 01             	add    $0x1,%ecx
+  800b58:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800b5b:	0f b6 01             	movzbl (%ecx),%eax
+  800b5e:	84 c0                	test   %al,%al
+  800b60:	74 04                	je     800b66 <strcmp+0x1c>
+  800b62:	3a 02                	cmp    (%edx),%al
+  800b64:	74 ef                	je     800b55 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b66:	0f b6 c0             	movzbl %al,%eax
+  800b69:	0f b6 12             	movzbl (%edx),%edx
+  800b6c:	29 d0                	sub    %edx,%eax
+}
+  800b6e:	5d                   	pop    %ebp
+  800b6f:	c3                   	ret
+
+00800b70 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b70:	55                   	push   %ebp
+  800b71:	89 e5                	mov    %esp,%ebp
+  800b73:	53                   	push   %ebx
+  800b74:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b77:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b7a:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800b7d:	eb 09                	jmp    800b88 <strncmp+0x18>
+		n--, p++, q++;
+  800b7f:	83 ea 01             	sub    $0x1,%edx
+  800b82:	83 c0 01             	add    $0x1,%eax
+  800b85:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800b88:	85 d2                	test   %edx,%edx
+  800b8a:	74 18                	je     800ba4 <strncmp+0x34>
+  800b8c:	0f b6 18             	movzbl (%eax),%ebx
+  800b8f:	84 db                	test   %bl,%bl
+  800b91:	74 04                	je     800b97 <strncmp+0x27>
+  800b93:	3a 19                	cmp    (%ecx),%bl
+  800b95:	74 e8                	je     800b7f <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b97:	0f b6 00             	movzbl (%eax),%eax
+  800b9a:	0f b6 11             	movzbl (%ecx),%edx
+  800b9d:	29 d0                	sub    %edx,%eax
+}
+  800b9f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ba2:	c9                   	leave
+  800ba3:	c3                   	ret
+		return 0;
+  800ba4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba9:	eb f4                	jmp    800b9f <strncmp+0x2f>
+
+00800bab <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800bab:	55                   	push   %ebp
+  800bac:	89 e5                	mov    %esp,%ebp
+  800bae:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bb1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800bb5:	eb 03                	jmp    800bba <strchr+0xf>
+  800bb7:	83 c0 01             	add    $0x1,%eax
+  800bba:	0f b6 10             	movzbl (%eax),%edx
+  800bbd:	84 d2                	test   %dl,%dl
+  800bbf:	74 06                	je     800bc7 <strchr+0x1c>
+		if (*s == c)
+  800bc1:	38 ca                	cmp    %cl,%dl
+  800bc3:	75 f2                	jne    800bb7 <strchr+0xc>
+  800bc5:	eb 05                	jmp    800bcc <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800bc7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bcc:	5d                   	pop    %ebp
+  800bcd:	c3                   	ret
+
+00800bce <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800bce:	55                   	push   %ebp
+  800bcf:	89 e5                	mov    %esp,%ebp
+  800bd1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bd4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800bd8:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800bdb:	38 ca                	cmp    %cl,%dl
+  800bdd:	74 09                	je     800be8 <strfind+0x1a>
+  800bdf:	84 d2                	test   %dl,%dl
+  800be1:	74 05                	je     800be8 <strfind+0x1a>
+	for (; *s; s++)
+  800be3:	83 c0 01             	add    $0x1,%eax
+  800be6:	eb f0                	jmp    800bd8 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800be8:	5d                   	pop    %ebp
+  800be9:	c3                   	ret
+
+00800bea <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800bea:	55                   	push   %ebp
+  800beb:	89 e5                	mov    %esp,%ebp
+  800bed:	57                   	push   %edi
+  800bee:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800bf1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800bf4:	85 c9                	test   %ecx,%ecx
+  800bf6:	74 20                	je     800c18 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800bf8:	89 f8                	mov    %edi,%eax
+  800bfa:	09 c8                	or     %ecx,%eax
+  800bfc:	a8 03                	test   $0x3,%al
+  800bfe:	75 12                	jne    800c12 <memset+0x28>
+		c &= 0xFF;
+  800c00:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800c04:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800c0a:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800c0d:	fc                   	cld
+  800c0e:	f3 ab                	rep stos %eax,%es:(%edi)
+  800c10:	eb 06                	jmp    800c18 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800c12:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c15:	fc                   	cld
+  800c16:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800c18:	89 f8                	mov    %edi,%eax
+  800c1a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c1d:	c9                   	leave
+  800c1e:	c3                   	ret
+
+00800c1f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800c1f:	55                   	push   %ebp
+  800c20:	89 e5                	mov    %esp,%ebp
+  800c22:	57                   	push   %edi
+  800c23:	56                   	push   %esi
+  800c24:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c27:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c2a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800c2d:	39 c6                	cmp    %eax,%esi
+  800c2f:	73 32                	jae    800c63 <memmove+0x44>
+  800c31:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c34:	39 d0                	cmp    %edx,%eax
+  800c36:	73 2b                	jae    800c63 <memmove+0x44>
+		s += n;
+		d += n;
+  800c38:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c3b:	89 d6                	mov    %edx,%esi
+  800c3d:	09 fe                	or     %edi,%esi
+  800c3f:	09 ce                	or     %ecx,%esi
+  800c41:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c47:	75 0e                	jne    800c57 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c49:	83 ef 04             	sub    $0x4,%edi
+  800c4c:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c4f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800c52:	fd                   	std
+  800c53:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c55:	eb 09                	jmp    800c60 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c57:	83 ef 01             	sub    $0x1,%edi
+  800c5a:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800c5d:	fd                   	std
+  800c5e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c60:	fc                   	cld
+  800c61:	eb 1a                	jmp    800c7d <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c63:	89 f2                	mov    %esi,%edx
+  800c65:	09 c2                	or     %eax,%edx
+  800c67:	09 ca                	or     %ecx,%edx
+  800c69:	f6 c2 03             	test   $0x3,%dl
+  800c6c:	75 0a                	jne    800c78 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c6e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c71:	89 c7                	mov    %eax,%edi
+  800c73:	fc                   	cld
+  800c74:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c76:	eb 05                	jmp    800c7d <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c78:	89 c7                	mov    %eax,%edi
+  800c7a:	fc                   	cld
+  800c7b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c7d:	5e                   	pop    %esi
+  800c7e:	5f                   	pop    %edi
+  800c7f:	5d                   	pop    %ebp
+  800c80:	c3                   	ret
+
+00800c81 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c81:	55                   	push   %ebp
+  800c82:	89 e5                	mov    %esp,%ebp
+  800c84:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c87:	ff 75 10             	push   0x10(%ebp)
+  800c8a:	ff 75 0c             	push   0xc(%ebp)
+  800c8d:	ff 75 08             	push   0x8(%ebp)
+  800c90:	e8 8a ff ff ff       	call   800c1f <memmove>
+}
+  800c95:	c9                   	leave
+  800c96:	c3                   	ret
+
+00800c97 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c97:	55                   	push   %ebp
+  800c98:	89 e5                	mov    %esp,%ebp
+  800c9a:	56                   	push   %esi
+  800c9b:	53                   	push   %ebx
+  800c9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c9f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ca2:	89 c6                	mov    %eax,%esi
+  800ca4:	03 75 10             	add    0x10(%ebp),%esi
+  800ca7:	eb 06                	jmp    800caf <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ca9:	83 c0 01             	add    $0x1,%eax
+  800cac:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800caf:	39 f0                	cmp    %esi,%eax
+  800cb1:	74 14                	je     800cc7 <memcmp+0x30>
+		if (*s1 != *s2)
+  800cb3:	0f b6 08             	movzbl (%eax),%ecx
+  800cb6:	0f b6 1a             	movzbl (%edx),%ebx
+  800cb9:	38 d9                	cmp    %bl,%cl
+  800cbb:	74 ec                	je     800ca9 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800cbd:	0f b6 c1             	movzbl %cl,%eax
+  800cc0:	0f b6 db             	movzbl %bl,%ebx
+  800cc3:	29 d8                	sub    %ebx,%eax
+  800cc5:	eb 05                	jmp    800ccc <memcmp+0x35>
+	}
+
+	return 0;
+  800cc7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ccc:	5b                   	pop    %ebx
+  800ccd:	5e                   	pop    %esi
+  800cce:	5d                   	pop    %ebp
+  800ccf:	c3                   	ret
+
+00800cd0 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800cd0:	55                   	push   %ebp
+  800cd1:	89 e5                	mov    %esp,%ebp
+  800cd3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cd6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800cd9:	89 c2                	mov    %eax,%edx
+  800cdb:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800cde:	eb 03                	jmp    800ce3 <memfind+0x13>
+  800ce0:	83 c0 01             	add    $0x1,%eax
+  800ce3:	39 d0                	cmp    %edx,%eax
+  800ce5:	73 04                	jae    800ceb <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800ce7:	38 08                	cmp    %cl,(%eax)
+  800ce9:	75 f5                	jne    800ce0 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800ceb:	5d                   	pop    %ebp
+  800cec:	c3                   	ret
+
+00800ced <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800ced:	55                   	push   %ebp
+  800cee:	89 e5                	mov    %esp,%ebp
+  800cf0:	57                   	push   %edi
+  800cf1:	56                   	push   %esi
+  800cf2:	53                   	push   %ebx
+  800cf3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800cf9:	eb 03                	jmp    800cfe <strtol+0x11>
+		s++;
+  800cfb:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800cfe:	0f b6 02             	movzbl (%edx),%eax
+  800d01:	3c 20                	cmp    $0x20,%al
+  800d03:	74 f6                	je     800cfb <strtol+0xe>
+  800d05:	3c 09                	cmp    $0x9,%al
+  800d07:	74 f2                	je     800cfb <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800d09:	3c 2b                	cmp    $0x2b,%al
+  800d0b:	74 2a                	je     800d37 <strtol+0x4a>
+	int neg = 0;
+  800d0d:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800d12:	3c 2d                	cmp    $0x2d,%al
+  800d14:	74 2b                	je     800d41 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d16:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800d1c:	75 0f                	jne    800d2d <strtol+0x40>
+  800d1e:	80 3a 30             	cmpb   $0x30,(%edx)
+  800d21:	74 28                	je     800d4b <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800d23:	85 db                	test   %ebx,%ebx
+  800d25:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d2a:	0f 44 d8             	cmove  %eax,%ebx
+  800d2d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d32:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d35:	eb 46                	jmp    800d7d <strtol+0x90>
+		s++;
+  800d37:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800d3a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d3f:	eb d5                	jmp    800d16 <strtol+0x29>
+		s++, neg = 1;
+  800d41:	83 c2 01             	add    $0x1,%edx
+  800d44:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d49:	eb cb                	jmp    800d16 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d4b:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d4f:	74 0e                	je     800d5f <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800d51:	85 db                	test   %ebx,%ebx
+  800d53:	75 d8                	jne    800d2d <strtol+0x40>
+		s++, base = 8;
+  800d55:	83 c2 01             	add    $0x1,%edx
+  800d58:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d5d:	eb ce                	jmp    800d2d <strtol+0x40>
+		s += 2, base = 16;
+  800d5f:	83 c2 02             	add    $0x2,%edx
+  800d62:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d67:	eb c4                	jmp    800d2d <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800d69:	0f be c0             	movsbl %al,%eax
+  800d6c:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800d6f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d72:	7d 3a                	jge    800dae <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800d74:	83 c2 01             	add    $0x1,%edx
+  800d77:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d7b:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800d7d:	0f b6 02             	movzbl (%edx),%eax
+  800d80:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d83:	89 f3                	mov    %esi,%ebx
+  800d85:	80 fb 09             	cmp    $0x9,%bl
+  800d88:	76 df                	jbe    800d69 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800d8a:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d8d:	89 f3                	mov    %esi,%ebx
+  800d8f:	80 fb 19             	cmp    $0x19,%bl
+  800d92:	77 08                	ja     800d9c <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800d94:	0f be c0             	movsbl %al,%eax
+  800d97:	83 e8 57             	sub    $0x57,%eax
+  800d9a:	eb d3                	jmp    800d6f <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d9c:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d9f:	89 f3                	mov    %esi,%ebx
+  800da1:	80 fb 19             	cmp    $0x19,%bl
+  800da4:	77 08                	ja     800dae <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800da6:	0f be c0             	movsbl %al,%eax
+  800da9:	83 e8 37             	sub    $0x37,%eax
+  800dac:	eb c1                	jmp    800d6f <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800dae:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800db2:	74 05                	je     800db9 <strtol+0xcc>
+		*endptr = (char *) s;
+  800db4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800db7:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800db9:	89 c8                	mov    %ecx,%eax
+  800dbb:	f7 d8                	neg    %eax
+  800dbd:	85 ff                	test   %edi,%edi
+  800dbf:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800dc2:	89 c8                	mov    %ecx,%eax
+  800dc4:	5b                   	pop    %ebx
+  800dc5:	5e                   	pop    %esi
+  800dc6:	5f                   	pop    %edi
+  800dc7:	5d                   	pop    %ebp
+  800dc8:	c3                   	ret
+
+00800dc9 <atoi>:
+
+int
+atoi(const char *s)
+{
+  800dc9:	55                   	push   %ebp
+  800dca:	89 e5                	mov    %esp,%ebp
+  800dcc:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800dcf:	6a 0a                	push   $0xa
+  800dd1:	6a 00                	push   $0x0
+  800dd3:	ff 75 08             	push   0x8(%ebp)
+  800dd6:	e8 12 ff ff ff       	call   800ced <strtol>
+}
+  800ddb:	c9                   	leave
+  800ddc:	c3                   	ret
+
+00800ddd <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800ddd:	55                   	push   %ebp
+  800dde:	89 e5                	mov    %esp,%ebp
+  800de0:	57                   	push   %edi
+  800de1:	56                   	push   %esi
+  800de2:	53                   	push   %ebx
+  800de3:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800de9:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800def:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800df5:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800dfb:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800e02:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800e05:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800e0c:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800e0f:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800e16:	74 76                	je     800e8e <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800e18:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800e1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e21:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800e27:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e2e:	0f 88 06 01 00 00    	js     800f3a <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800e34:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e3b:	0f 84 48 01 00 00    	je     800f89 <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800e41:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800e47:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800e4d:	be 00 00 00 00       	mov    $0x0,%esi
+  800e52:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800e58:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800e5b:	55                   	push   %ebp
+  800e5c:	68 65 0e 80 00       	push   $0x800e65
+  800e61:	89 e5                	mov    %esp,%ebp
+  800e63:	0f 34                	sysenter
+  800e65:	83 c4 04             	add    $0x4,%esp
+  800e68:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800e69:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800e6f:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800e75:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800e78:	0f 85 9a 01 00 00    	jne    801018 <page_vec_call+0x23b>
+  800e7e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e83:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e86:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e89:	e9 29 01 00 00       	jmp    800fb7 <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800e8e:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800e94:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e97:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800e99:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800ea0:	78 2f                	js     800ed1 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800ea2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800ea9:	74 72                	je     800f1d <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800eab:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800eb1:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800eb7:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ebc:	89 fb                	mov    %edi,%ebx
+  800ebe:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800ec1:	55                   	push   %ebp
+  800ec2:	68 cb 0e 80 00       	push   $0x800ecb
+  800ec7:	89 e5                	mov    %esp,%ebp
+  800ec9:	0f 34                	sysenter
+  800ecb:	83 c4 04             	add    $0x4,%esp
+  800ece:	5d                   	pop    %ebp
+	return ret;
+  800ecf:	eb 98                	jmp    800e69 <page_vec_call+0x8c>
+	asm volatile("cpuid"
+  800ed1:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ed6:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800ed8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800edd:	f6 c6 08             	test   $0x8,%dh
+  800ee0:	74 15                	je     800ef7 <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ee2:	89 c2                	mov    %eax,%edx
+  800ee4:	c1 ea 08             	shr    $0x8,%edx
+  800ee7:	83 e2 0f             	and    $0xf,%edx
+  800eea:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800eef:	83 fa 06             	cmp    $0x6,%edx
+  800ef2:	74 0e                	je     800f02 <page_vec_call+0x125>
+  800ef4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800ef7:	0f b6 c9             	movzbl %cl,%ecx
+  800efa:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800f00:	eb a0                	jmp    800ea2 <page_vec_call+0xc5>
+  800f02:	89 c2                	mov    %eax,%edx
+  800f04:	c1 ea 04             	shr    $0x4,%edx
+  800f07:	83 e2 0f             	and    $0xf,%edx
+  800f0a:	83 fa 02             	cmp    $0x2,%edx
+  800f0d:	77 e5                	ja     800ef4 <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800f0f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f12:	83 f8 02             	cmp    $0x2,%eax
+  800f15:	0f 97 c1             	seta   %cl
+  800f18:	0f b6 c9             	movzbl %cl,%ecx
+  800f1b:	eb d7                	jmp    800ef4 <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800f1d:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f22:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800f28:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800f2e:	89 fb                	mov    %edi,%ebx
+  800f30:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800f33:	cd 30                	int    $0x30
+  800f35:	e9 2f ff ff ff       	jmp    800e69 <page_vec_call+0x8c>
+  800f3a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f3f:	0f a2                	cpuid
+		return 0;
+  800f41:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f46:	f6 c6 08             	test   $0x8,%dh
+  800f49:	74 15                	je     800f60 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f4b:	89 c2                	mov    %eax,%edx
+  800f4d:	c1 ea 08             	shr    $0x8,%edx
+  800f50:	83 e2 0f             	and    $0xf,%edx
+  800f53:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f58:	83 fa 06             	cmp    $0x6,%edx
+  800f5b:	74 11                	je     800f6e <page_vec_call+0x191>
+  800f5d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f60:	0f b6 c9             	movzbl %cl,%ecx
+  800f63:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800f69:	e9 c6 fe ff ff       	jmp    800e34 <page_vec_call+0x57>
+  800f6e:	89 c2                	mov    %eax,%edx
+  800f70:	c1 ea 04             	shr    $0x4,%edx
+  800f73:	83 e2 0f             	and    $0xf,%edx
+  800f76:	83 fa 02             	cmp    $0x2,%edx
+  800f79:	77 e2                	ja     800f5d <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800f7b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f7e:	83 f8 02             	cmp    $0x2,%eax
+  800f81:	0f 97 c1             	seta   %cl
+  800f84:	0f b6 c9             	movzbl %cl,%ecx
+  800f87:	eb d4                	jmp    800f5d <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800f89:	be 00 00 00 00       	mov    $0x0,%esi
+  800f8e:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800f94:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800f9a:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800fa0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800fa3:	cd 30                	int    $0x30
+  800fa5:	e9 bf fe ff ff       	jmp    800e69 <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800faa:	29 da                	sub    %ebx,%edx
+			vec++;
+  800fac:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800faf:	83 e8 01             	sub    $0x1,%eax
+  800fb2:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800fb7:	85 c0                	test   %eax,%eax
+  800fb9:	74 58                	je     801013 <page_vec_call+0x236>
+  800fbb:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800fbe:	39 da                	cmp    %ebx,%edx
+  800fc0:	73 e8                	jae    800faa <page_vec_call+0x1cd>
+  800fc2:	89 75 08             	mov    %esi,0x8(%ebp)
+  800fc5:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800fc8:	84 c9                	test   %cl,%cl
+  800fca:	74 06                	je     800fd2 <page_vec_call+0x1f5>
+  800fcc:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800fd2:	83 ec 04             	sub    $0x4,%esp
+  800fd5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800fd8:	c1 e0 04             	shl    $0x4,%eax
+  800fdb:	50                   	push   %eax
+  800fdc:	ff 75 08             	push   0x8(%ebp)
+  800fdf:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800fe5:	53                   	push   %ebx
+  800fe6:	e8 34 fc ff ff       	call   800c1f <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800feb:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800ff1:	89 c2                	mov    %eax,%edx
+  800ff3:	c1 e2 0c             	shl    $0xc,%edx
+  800ff6:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  800ffc:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  801002:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  801008:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  80100b:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  80100e:	e9 f2 fd ff ff       	jmp    800e05 <page_vec_call+0x28>
+			r = 0;
+  801013:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  801018:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80101c:	74 0b                	je     801029 <page_vec_call+0x24c>
+		*done = total;
+  80101e:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801021:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  801027:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  801029:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80102c:	5b                   	pop    %ebx
+  80102d:	5e                   	pop    %esi
+  80102e:	5f                   	pop    %edi
+  80102f:	5d                   	pop    %ebp
+  801030:	c3                   	ret
+
+00801031 <sys_cputs>:
+{
+  801031:	55                   	push   %ebp
+  801032:	89 e5                	mov    %esp,%ebp
+  801034:	57                   	push   %edi
+  801035:	56                   	push   %esi
+  801036:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801037:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80103e:	78 2d                	js     80106d <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  801040:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801047:	74 70                	je     8010b9 <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  801049:	b8 00 00 00 00       	mov    $0x0,%eax
+  80104e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801051:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801054:	89 c3                	mov    %eax,%ebx
+  801056:	89 c7                	mov    %eax,%edi
+  801058:	89 c6                	mov    %eax,%esi
+  80105a:	55                   	push   %ebp
+  80105b:	68 64 10 80 00       	push   $0x801064
+  801060:	89 e5                	mov    %esp,%ebp
+  801062:	0f 34                	sysenter
+  801064:	83 c4 04             	add    $0x4,%esp
+  801067:	5d                   	pop    %ebp
+}
+  801068:	5b                   	pop    %ebx
+  801069:	5e                   	pop    %esi
+  80106a:	5f                   	pop    %edi
+  80106b:	5d                   	pop    %ebp
+  80106c:	c3                   	ret
+  80106d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801072:	0f a2                	cpuid
+		return 0;
+  801074:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801079:	f6 c6 08             	test   $0x8,%dh
+  80107c:	74 15                	je     801093 <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80107e:	89 c2                	mov    %eax,%edx
+  801080:	c1 ea 08             	shr    $0x8,%edx
+  801083:	83 e2 0f             	and    $0xf,%edx
+  801086:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80108b:	83 fa 06             	cmp    $0x6,%edx
+  80108e:	74 0e                	je     80109e <sys_cputs+0x6d>
+  801090:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801093:	0f b6 c9             	movzbl %cl,%ecx
+  801096:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80109c:	eb a2                	jmp    801040 <sys_cputs+0xf>
+  80109e:	89 c2                	mov    %eax,%edx
+  8010a0:	c1 ea 04             	shr    $0x4,%edx
+  8010a3:	83 e2 0f             	and    $0xf,%edx
+  8010a6:	83 fa 02             	cmp    $0x2,%edx
+  8010a9:	77 e5                	ja     801090 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  8010ab:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010ae:	83 f8 02             	cmp    $0x2,%eax
+  8010b1:	0f 97 c1             	seta   %cl
+  8010b4:	0f b6 c9             	movzbl %cl,%ecx
+  8010b7:	eb d7                	jmp    801090 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  8010b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c4:	89 c3                	mov    %eax,%ebx
+  8010c6:	89 c7                	mov    %eax,%edi
+  8010c8:	89 c6                	mov    %eax,%esi
+  8010ca:	cd 30                	int    $0x30
+}
+  8010cc:	eb 9a                	jmp    801068 <sys_cputs+0x37>
+
+008010ce <sys_cgetc>:
+{
+  8010ce:	55                   	push   %ebp
+  8010cf:	89 e5                	mov    %esp,%ebp
+  8010d1:	57                   	push   %edi
+  8010d2:	56                   	push   %esi
+  8010d3:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8010d4:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8010db:	78 2e                	js     80110b <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  8010dd:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8010e4:	74 71                	je     801157 <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  8010e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010eb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010f0:	89 d1                	mov    %edx,%ecx
+  8010f2:	89 d3                	mov    %edx,%ebx
+  8010f4:	89 d7                	mov    %edx,%edi
+  8010f6:	89 d6                	mov    %edx,%esi
+  8010f8:	55                   	push   %ebp
+  8010f9:	68 02 11 80 00       	push   $0x801102
+  8010fe:	89 e5                	mov    %esp,%ebp
+  801100:	0f 34                	sysenter
+  801102:	83 c4 04             	add    $0x4,%esp
+  801105:	5d                   	pop    %ebp
+}
+  801106:	5b                   	pop    %ebx
+  801107:	5e                   	pop    %esi
+  801108:	5f                   	pop    %edi
+  801109:	5d                   	pop    %ebp
+  80110a:	c3                   	ret
+  80110b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801110:	0f a2                	cpuid
+		return 0;
+  801112:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801117:	f6 c6 08             	test   $0x8,%dh
+  80111a:	74 15                	je     801131 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80111c:	89 c2                	mov    %eax,%edx
+  80111e:	c1 ea 08             	shr    $0x8,%edx
+  801121:	83 e2 0f             	and    $0xf,%edx
+  801124:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801129:	83 fa 06             	cmp    $0x6,%edx
+  80112c:	74 0e                	je     80113c <sys_cgetc+0x6e>
+  80112e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801131:	0f b6 c9             	movzbl %cl,%ecx
+  801134:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80113a:	eb a1                	jmp    8010dd <sys_cgetc+0xf>
+  80113c:	89 c2                	mov    %eax,%edx
+  80113e:	c1 ea 04             	shr    $0x4,%edx
+  801141:	83 e2 0f             	and    $0xf,%edx
+  801144:	83 fa 02             	cmp    $0x2,%edx
+  801147:	77 e5                	ja     80112e <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  801149:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80114c:	83 f8 02             	cmp    $0x2,%eax
+  80114f:	0f 97 c1             	seta   %cl
+  801152:	0f b6 c9             	movzbl %cl,%ecx
+  801155:	eb d7                	jmp    80112e <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  801157:	ba 00 00 00 00       	mov    $0x0,%edx
+  80115c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801161:	89 d1                	mov    %edx,%ecx
+  801163:	89 d3                	mov    %edx,%ebx
+  801165:	89 d7                	mov    %edx,%edi
+  801167:	89 d6                	mov    %edx,%esi
+  801169:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  80116b:	eb 99                	jmp    801106 <sys_cgetc+0x38>
+
+0080116d <sys_env_destroy>:
+{
+  80116d:	55                   	push   %ebp
+  80116e:	89 e5                	mov    %esp,%ebp
+  801170:	57                   	push   %edi
+  801171:	56                   	push   %esi
+  801172:	53                   	push   %ebx
+  801173:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801176:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80117d:	78 36                	js     8011b5 <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  80117f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801186:	74 79                	je     801201 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  801188:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801190:	b8 03 00 00 00       	mov    $0x3,%eax
+  801195:	89 cb                	mov    %ecx,%ebx
+  801197:	89 cf                	mov    %ecx,%edi
+  801199:	89 ce                	mov    %ecx,%esi
+  80119b:	55                   	push   %ebp
+  80119c:	68 a5 11 80 00       	push   $0x8011a5
+  8011a1:	89 e5                	mov    %esp,%ebp
+  8011a3:	0f 34                	sysenter
+  8011a5:	83 c4 04             	add    $0x4,%esp
+  8011a8:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8011a9:	85 c0                	test   %eax,%eax
+  8011ab:	7f 6b                	jg     801218 <sys_env_destroy+0xab>
+}
+  8011ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011b0:	5b                   	pop    %ebx
+  8011b1:	5e                   	pop    %esi
+  8011b2:	5f                   	pop    %edi
+  8011b3:	5d                   	pop    %ebp
+  8011b4:	c3                   	ret
+  8011b5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011ba:	0f a2                	cpuid
+		return 0;
+  8011bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8011c1:	f6 c6 08             	test   $0x8,%dh
+  8011c4:	74 15                	je     8011db <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011c6:	89 c2                	mov    %eax,%edx
+  8011c8:	c1 ea 08             	shr    $0x8,%edx
+  8011cb:	83 e2 0f             	and    $0xf,%edx
+  8011ce:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011d3:	83 fa 06             	cmp    $0x6,%edx
+  8011d6:	74 0e                	je     8011e6 <sys_env_destroy+0x79>
+  8011d8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8011db:	0f b6 c9             	movzbl %cl,%ecx
+  8011de:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8011e4:	eb 99                	jmp    80117f <sys_env_destroy+0x12>
+  8011e6:	89 c2                	mov    %eax,%edx
+  8011e8:	c1 ea 04             	shr    $0x4,%edx
+  8011eb:	83 e2 0f             	and    $0xf,%edx
+  8011ee:	83 fa 02             	cmp    $0x2,%edx
+  8011f1:	77 e5                	ja     8011d8 <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  8011f3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011f6:	83 f8 02             	cmp    $0x2,%eax
+  8011f9:	0f 97 c1             	seta   %cl
+  8011fc:	0f b6 c9             	movzbl %cl,%ecx
+  8011ff:	eb d7                	jmp    8011d8 <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  801201:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801206:	b8 03 00 00 00       	mov    $0x3,%eax
+  80120b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120e:	89 cb                	mov    %ecx,%ebx
+  801210:	89 cf                	mov    %ecx,%edi
+  801212:	89 ce                	mov    %ecx,%esi
+  801214:	cd 30                	int    $0x30
+  801216:	eb 91                	jmp    8011a9 <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801218:	83 ec 0c             	sub    $0xc,%esp
+  80121b:	50                   	push   %eax
+  80121c:	6a 03                	push   $0x3
+  80121e:	68 39 35 80 00       	push   $0x803539
+  801223:	6a 4a                	push   $0x4a
+  801225:	68 56 35 80 00       	push   $0x803556
+  80122a:	e8 68 f1 ff ff       	call   800397 <_panic>
+
+0080122f <sys_getenvid>:
+{
+  80122f:	55                   	push   %ebp
+  801230:	89 e5                	mov    %esp,%ebp
+  801232:	57                   	push   %edi
+  801233:	56                   	push   %esi
+  801234:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801235:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80123c:	78 2e                	js     80126c <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  80123e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801245:	74 71                	je     8012b8 <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  801247:	ba 00 00 00 00       	mov    $0x0,%edx
+  80124c:	b8 02 00 00 00       	mov    $0x2,%eax
+  801251:	89 d1                	mov    %edx,%ecx
+  801253:	89 d3                	mov    %edx,%ebx
+  801255:	89 d7                	mov    %edx,%edi
+  801257:	89 d6                	mov    %edx,%esi
+  801259:	55                   	push   %ebp
+  80125a:	68 63 12 80 00       	push   $0x801263
+  80125f:	89 e5                	mov    %esp,%ebp
+  801261:	0f 34                	sysenter
+  801263:	83 c4 04             	add    $0x4,%esp
+  801266:	5d                   	pop    %ebp
+}
+  801267:	5b                   	pop    %ebx
+  801268:	5e                   	pop    %esi
+  801269:	5f                   	pop    %edi
+  80126a:	5d                   	pop    %ebp
+  80126b:	c3                   	ret
+  80126c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801271:	0f a2                	cpuid
+		return 0;
+  801273:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801278:	f6 c6 08             	test   $0x8,%dh
+  80127b:	74 15                	je     801292 <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80127d:	89 c2                	mov    %eax,%edx
+  80127f:	c1 ea 08             	shr    $0x8,%edx
+  801282:	83 e2 0f             	and    $0xf,%edx
+  801285:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80128a:	83 fa 06             	cmp    $0x6,%edx
+  80128d:	74 0e                	je     80129d <sys_getenvid+0x6e>
+  80128f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801292:	0f b6 c9             	movzbl %cl,%ecx
+  801295:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80129b:	eb a1                	jmp    80123e <sys_getenvid+0xf>
+  80129d:	89 c2                	mov    %eax,%edx
+  80129f:	c1 ea 04             	shr    $0x4,%edx
+  8012a2:	83 e2 0f             	and    $0xf,%edx
+  8012a5:	83 fa 02             	cmp    $0x2,%edx
+  8012a8:	77 e5                	ja     80128f <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  8012aa:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012ad:	83 f8 02             	cmp    $0x2,%eax
+  8012b0:	0f 97 c1             	seta   %cl
+  8012b3:	0f b6 c9             	movzbl %cl,%ecx
+  8012b6:	eb d7                	jmp    80128f <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  8012b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012bd:	b8 02 00 00 00       	mov    $0x2,%eax
+  8012c2:	89 d1                	mov    %edx,%ecx
+  8012c4:	89 d3                	mov    %edx,%ebx
+  8012c6:	89 d7                	mov    %edx,%edi
+  8012c8:	89 d6                	mov    %edx,%esi
+  8012ca:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  8012cc:	eb 99                	jmp    801267 <sys_getenvid+0x38>
+
+008012ce <sys_page_alloc>:
+{
+  8012ce:	55                   	push   %ebp
+  8012cf:	89 e5                	mov    %esp,%ebp
+  8012d1:	57                   	push   %edi
+  8012d2:	56                   	push   %esi
+  8012d3:	53                   	push   %ebx
+  8012d4:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8012d7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8012de:	78 38                	js     801318 <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  8012e0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8012e7:	74 7b                	je     801364 <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  8012e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f4:	b8 04 00 00 00       	mov    $0x4,%eax
+  8012f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012fc:	89 f7                	mov    %esi,%edi
+  8012fe:	55                   	push   %ebp
+  8012ff:	68 08 13 80 00       	push   $0x801308
+  801304:	89 e5                	mov    %esp,%ebp
+  801306:	0f 34                	sysenter
+  801308:	83 c4 04             	add    $0x4,%esp
+  80130b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80130c:	85 c0                	test   %eax,%eax
+  80130e:	7f 6d                	jg     80137d <sys_page_alloc+0xaf>
+}
+  801310:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801313:	5b                   	pop    %ebx
+  801314:	5e                   	pop    %esi
+  801315:	5f                   	pop    %edi
+  801316:	5d                   	pop    %ebp
+  801317:	c3                   	ret
+  801318:	b8 01 00 00 00       	mov    $0x1,%eax
+  80131d:	0f a2                	cpuid
+		return 0;
+  80131f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801324:	f6 c6 08             	test   $0x8,%dh
+  801327:	74 15                	je     80133e <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801329:	89 c2                	mov    %eax,%edx
+  80132b:	c1 ea 08             	shr    $0x8,%edx
+  80132e:	83 e2 0f             	and    $0xf,%edx
+  801331:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801336:	83 fa 06             	cmp    $0x6,%edx
+  801339:	74 0e                	je     801349 <sys_page_alloc+0x7b>
+  80133b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80133e:	0f b6 c9             	movzbl %cl,%ecx
+  801341:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801347:	eb 97                	jmp    8012e0 <sys_page_alloc+0x12>
+  801349:	89 c2                	mov    %eax,%edx
+  80134b:	c1 ea 04             	shr    $0x4,%edx
+  80134e:	83 e2 0f             	and    $0xf,%edx
+  801351:	83 fa 02             	cmp    $0x2,%edx
+  801354:	77 e5                	ja     80133b <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  801356:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801359:	83 f8 02             	cmp    $0x2,%eax
+  80135c:	0f 97 c1             	seta   %cl
+  80135f:	0f b6 c9             	movzbl %cl,%ecx
+  801362:	eb d7                	jmp    80133b <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  801364:	be 00 00 00 00       	mov    $0x0,%esi
+  801369:	b8 04 00 00 00       	mov    $0x4,%eax
+  80136e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801371:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801374:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801377:	89 f7                	mov    %esi,%edi
+  801379:	cd 30                	int    $0x30
+  80137b:	eb 8f                	jmp    80130c <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80137d:	83 ec 0c             	sub    $0xc,%esp
+  801380:	50                   	push   %eax
+  801381:	6a 04                	push   $0x4
+  801383:	68 39 35 80 00       	push   $0x803539
+  801388:	6a 4a                	push   $0x4a
+  80138a:	68 56 35 80 00       	push   $0x803556
+  80138f:	e8 03 f0 ff ff       	call   800397 <_panic>
+
+00801394 <sys_page_map>:
+{
+  801394:	55                   	push   %ebp
+  801395:	89 e5                	mov    %esp,%ebp
+  801397:	57                   	push   %edi
+  801398:	56                   	push   %esi
+  801399:	53                   	push   %ebx
+  80139a:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80139d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8013a4:	78 37                	js     8013dd <sys_page_map+0x49>
+	if (syscall_sysenter)
+  8013a6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8013ad:	74 7a                	je     801429 <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  8013af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8013ba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013bd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013c0:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013c3:	55                   	push   %ebp
+  8013c4:	68 cd 13 80 00       	push   $0x8013cd
+  8013c9:	89 e5                	mov    %esp,%ebp
+  8013cb:	0f 34                	sysenter
+  8013cd:	83 c4 04             	add    $0x4,%esp
+  8013d0:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8013d1:	85 c0                	test   %eax,%eax
+  8013d3:	7f 6c                	jg     801441 <sys_page_map+0xad>
+}
+  8013d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013d8:	5b                   	pop    %ebx
+  8013d9:	5e                   	pop    %esi
+  8013da:	5f                   	pop    %edi
+  8013db:	5d                   	pop    %ebp
+  8013dc:	c3                   	ret
+  8013dd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013e2:	0f a2                	cpuid
+		return 0;
+  8013e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8013e9:	f6 c6 08             	test   $0x8,%dh
+  8013ec:	74 15                	je     801403 <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013ee:	89 c2                	mov    %eax,%edx
+  8013f0:	c1 ea 08             	shr    $0x8,%edx
+  8013f3:	83 e2 0f             	and    $0xf,%edx
+  8013f6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8013fb:	83 fa 06             	cmp    $0x6,%edx
+  8013fe:	74 0e                	je     80140e <sys_page_map+0x7a>
+  801400:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801403:	0f b6 c9             	movzbl %cl,%ecx
+  801406:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80140c:	eb 98                	jmp    8013a6 <sys_page_map+0x12>
+  80140e:	89 c2                	mov    %eax,%edx
+  801410:	c1 ea 04             	shr    $0x4,%edx
+  801413:	83 e2 0f             	and    $0xf,%edx
+  801416:	83 fa 02             	cmp    $0x2,%edx
+  801419:	77 e5                	ja     801400 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  80141b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80141e:	83 f8 02             	cmp    $0x2,%eax
+  801421:	0f 97 c1             	seta   %cl
+  801424:	0f b6 c9             	movzbl %cl,%ecx
+  801427:	eb d7                	jmp    801400 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  801429:	b8 05 00 00 00       	mov    $0x5,%eax
+  80142e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801431:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801434:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801437:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80143a:	8b 75 18             	mov    0x18(%ebp),%esi
+  80143d:	cd 30                	int    $0x30
+  80143f:	eb 90                	jmp    8013d1 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801441:	83 ec 0c             	sub    $0xc,%esp
+  801444:	50                   	push   %eax
+  801445:	6a 05                	push   $0x5
+  801447:	68 39 35 80 00       	push   $0x803539
+  80144c:	6a 4a                	push   $0x4a
+  80144e:	68 56 35 80 00       	push   $0x803556
+  801453:	e8 3f ef ff ff       	call   800397 <_panic>
+
+00801458 <sys_page_unmap>:
+{
+  801458:	55                   	push   %ebp
+  801459:	89 e5                	mov    %esp,%ebp
+  80145b:	57                   	push   %edi
+  80145c:	56                   	push   %esi
+  80145d:	53                   	push   %ebx
+  80145e:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801461:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801468:	78 37                	js     8014a1 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  80146a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801471:	74 7a                	je     8014ed <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  801473:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801478:	8b 55 08             	mov    0x8(%ebp),%edx
+  80147b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80147e:	b8 06 00 00 00       	mov    $0x6,%eax
+  801483:	89 df                	mov    %ebx,%edi
+  801485:	89 de                	mov    %ebx,%esi
+  801487:	55                   	push   %ebp
+  801488:	68 91 14 80 00       	push   $0x801491
+  80148d:	89 e5                	mov    %esp,%ebp
+  80148f:	0f 34                	sysenter
+  801491:	83 c4 04             	add    $0x4,%esp
+  801494:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801495:	85 c0                	test   %eax,%eax
+  801497:	7f 6c                	jg     801505 <sys_page_unmap+0xad>
+}
+  801499:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80149c:	5b                   	pop    %ebx
+  80149d:	5e                   	pop    %esi
+  80149e:	5f                   	pop    %edi
+  80149f:	5d                   	pop    %ebp
+  8014a0:	c3                   	ret
+  8014a1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014a6:	0f a2                	cpuid
+		return 0;
+  8014a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8014ad:	f6 c6 08             	test   $0x8,%dh
+  8014b0:	74 15                	je     8014c7 <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014b2:	89 c2                	mov    %eax,%edx
+  8014b4:	c1 ea 08             	shr    $0x8,%edx
+  8014b7:	83 e2 0f             	and    $0xf,%edx
+  8014ba:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8014bf:	83 fa 06             	cmp    $0x6,%edx
+  8014c2:	74 0e                	je     8014d2 <sys_page_unmap+0x7a>
+  8014c4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8014c7:	0f b6 c9             	movzbl %cl,%ecx
+  8014ca:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8014d0:	eb 98                	jmp    80146a <sys_page_unmap+0x12>
+  8014d2:	89 c2                	mov    %eax,%edx
+  8014d4:	c1 ea 04             	shr    $0x4,%edx
+  8014d7:	83 e2 0f             	and    $0xf,%edx
+  8014da:	83 fa 02             	cmp    $0x2,%edx
+  8014dd:	77 e5                	ja     8014c4 <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  8014df:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014e2:	83 f8 02             	cmp    $0x2,%eax
+  8014e5:	0f 97 c1             	seta   %cl
+  8014e8:	0f b6 c9             	movzbl %cl,%ecx
+  8014eb:	eb d7                	jmp    8014c4 <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  8014ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014f2:	b8 06 00 00 00       	mov    $0x6,%eax
+  8014f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014fd:	89 df                	mov    %ebx,%edi
+  8014ff:	89 de                	mov    %ebx,%esi
+  801501:	cd 30                	int    $0x30
+  801503:	eb 90                	jmp    801495 <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801505:	83 ec 0c             	sub    $0xc,%esp
+  801508:	50                   	push   %eax
+  801509:	6a 06                	push   $0x6
+  80150b:	68 39 35 80 00       	push   $0x803539
+  801510:	6a 4a                	push   $0x4a
+  801512:	68 56 35 80 00       	push   $0x803556
+  801517:	e8 7b ee ff ff       	call   800397 <_panic>
+
+0080151c <sys_page_copy>:
+{
+  80151c:	55                   	push   %ebp
+  80151d:	89 e5                	mov    %esp,%ebp
+  80151f:	57                   	push   %edi
+  801520:	56                   	push   %esi
+  801521:	53                   	push   %ebx
+  801522:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801525:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80152c:	78 37                	js     801565 <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  80152e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801535:	74 7a                	je     8015b1 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  801537:	8b 55 08             	mov    0x8(%ebp),%edx
+  80153a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80153d:	b8 29 00 00 00       	mov    $0x29,%eax
+  801542:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801545:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801548:	8b 75 18             	mov    0x18(%ebp),%esi
+  80154b:	55                   	push   %ebp
+  80154c:	68 55 15 80 00       	push   $0x801555
+  801551:	89 e5                	mov    %esp,%ebp
+  801553:	0f 34                	sysenter
+  801555:	83 c4 04             	add    $0x4,%esp
+  801558:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801559:	85 c0                	test   %eax,%eax
+  80155b:	7f 6c                	jg     8015c9 <sys_page_copy+0xad>
+}
+  80155d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801560:	5b                   	pop    %ebx
+  801561:	5e                   	pop    %esi
+  801562:	5f                   	pop    %edi
+  801563:	5d                   	pop    %ebp
+  801564:	c3                   	ret
+  801565:	b8 01 00 00 00       	mov    $0x1,%eax
+  80156a:	0f a2                	cpuid
+		return 0;
+  80156c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801571:	f6 c6 08             	test   $0x8,%dh
+  801574:	74 15                	je     80158b <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801576:	89 c2                	mov    %eax,%edx
+  801578:	c1 ea 08             	shr    $0x8,%edx
+  80157b:	83 e2 0f             	and    $0xf,%edx
+  80157e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801583:	83 fa 06             	cmp    $0x6,%edx
+  801586:	74 0e                	je     801596 <sys_page_copy+0x7a>
+  801588:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80158b:	0f b6 c9             	movzbl %cl,%ecx
+  80158e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801594:	eb 98                	jmp    80152e <sys_page_copy+0x12>
+  801596:	89 c2                	mov    %eax,%edx
+  801598:	c1 ea 04             	shr    $0x4,%edx
+  80159b:	83 e2 0f             	and    $0xf,%edx
+  80159e:	83 fa 02             	cmp    $0x2,%edx
+  8015a1:	77 e5                	ja     801588 <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  8015a3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015a6:	83 f8 02             	cmp    $0x2,%eax
+  8015a9:	0f 97 c1             	seta   %cl
+  8015ac:	0f b6 c9             	movzbl %cl,%ecx
+  8015af:	eb d7                	jmp    801588 <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  8015b1:	b8 29 00 00 00       	mov    $0x29,%eax
+  8015b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015bc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015bf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8015c2:	8b 75 18             	mov    0x18(%ebp),%esi
+  8015c5:	cd 30                	int    $0x30
+  8015c7:	eb 90                	jmp    801559 <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015c9:	83 ec 0c             	sub    $0xc,%esp
+  8015cc:	50                   	push   %eax
+  8015cd:	6a 29                	push   $0x29
+  8015cf:	68 39 35 80 00       	push   $0x803539
+  8015d4:	6a 4a                	push   $0x4a
+  8015d6:	68 56 35 80 00       	push   $0x803556
+  8015db:	e8 b7 ed ff ff       	call   800397 <_panic>
+
+008015e0 <sys_yield>:
+{
+  8015e0:	55                   	push   %ebp
+  8015e1:	89 e5                	mov    %esp,%ebp
+  8015e3:	57                   	push   %edi
+  8015e4:	56                   	push   %esi
+  8015e5:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8015e6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8015ed:	78 2e                	js     80161d <sys_yield+0x3d>
+	if (syscall_sysenter)
+  8015ef:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8015f6:	74 71                	je     801669 <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  8015f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015fd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801602:	89 d1                	mov    %edx,%ecx
+  801604:	89 d3                	mov    %edx,%ebx
+  801606:	89 d7                	mov    %edx,%edi
+  801608:	89 d6                	mov    %edx,%esi
+  80160a:	55                   	push   %ebp
+  80160b:	68 14 16 80 00       	push   $0x801614
+  801610:	89 e5                	mov    %esp,%ebp
+  801612:	0f 34                	sysenter
+  801614:	83 c4 04             	add    $0x4,%esp
+  801617:	5d                   	pop    %ebp
+}
+  801618:	5b                   	pop    %ebx
+  801619:	5e                   	pop    %esi
+  80161a:	5f                   	pop    %edi
+  80161b:	5d                   	pop    %ebp
+  80161c:	c3                   	ret
+  80161d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801622:	0f a2                	cpuid
+		return 0;
+  801624:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801629:	f6 c6 08             	test   $0x8,%dh
+  80162c:	74 15                	je     801643 <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80162e:	89 c2                	mov    %eax,%edx
+  801630:	c1 ea 08             	shr    $0x8,%edx
+  801633:	83 e2 0f             	and    $0xf,%edx
+  801636:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80163b:	83 fa 06             	cmp    $0x6,%edx
+  80163e:	74 0e                	je     80164e <sys_yield+0x6e>
+  801640:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801643:	0f b6 c9             	movzbl %cl,%ecx
+  801646:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80164c:	eb a1                	jmp    8015ef <sys_yield+0xf>
+  80164e:	89 c2                	mov    %eax,%edx
+  801650:	c1 ea 04             	shr    $0x4,%edx
+  801653:	83 e2 0f             	and    $0xf,%edx
+  801656:	83 fa 02             	cmp    $0x2,%edx
+  801659:	77 e5                	ja     801640 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  80165b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80165e:	83 f8 02             	cmp    $0x2,%eax
+  801661:	0f 97 c1             	seta   %cl
+  801664:	0f b6 c9             	movzbl %cl,%ecx
+  801667:	eb d7                	jmp    801640 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  801669:	ba 00 00 00 00       	mov    $0x0,%edx
+  80166e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801673:	89 d1                	mov    %edx,%ecx
+  801675:	89 d3                	mov    %edx,%ebx
+  801677:	89 d7                	mov    %edx,%edi
+  801679:	89 d6                	mov    %edx,%esi
+  80167b:	cd 30                	int    $0x30
+}
+  80167d:	eb 99                	jmp    801618 <sys_yield+0x38>
+
+0080167f <sys_env_set_status>:
+{
+  80167f:	55                   	push   %ebp
+  801680:	89 e5                	mov    %esp,%ebp
+  801682:	57                   	push   %edi
+  801683:	56                   	push   %esi
+  801684:	53                   	push   %ebx
+  801685:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801688:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80168f:	78 37                	js     8016c8 <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  801691:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801698:	74 7a                	je     801714 <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  80169a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80169f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016a5:	b8 08 00 00 00       	mov    $0x8,%eax
+  8016aa:	89 df                	mov    %ebx,%edi
+  8016ac:	89 de                	mov    %ebx,%esi
+  8016ae:	55                   	push   %ebp
+  8016af:	68 b8 16 80 00       	push   $0x8016b8
+  8016b4:	89 e5                	mov    %esp,%ebp
+  8016b6:	0f 34                	sysenter
+  8016b8:	83 c4 04             	add    $0x4,%esp
+  8016bb:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8016bc:	85 c0                	test   %eax,%eax
+  8016be:	7f 6c                	jg     80172c <sys_env_set_status+0xad>
+}
+  8016c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016c3:	5b                   	pop    %ebx
+  8016c4:	5e                   	pop    %esi
+  8016c5:	5f                   	pop    %edi
+  8016c6:	5d                   	pop    %ebp
+  8016c7:	c3                   	ret
+  8016c8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016cd:	0f a2                	cpuid
+		return 0;
+  8016cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8016d4:	f6 c6 08             	test   $0x8,%dh
+  8016d7:	74 15                	je     8016ee <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016d9:	89 c2                	mov    %eax,%edx
+  8016db:	c1 ea 08             	shr    $0x8,%edx
+  8016de:	83 e2 0f             	and    $0xf,%edx
+  8016e1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8016e6:	83 fa 06             	cmp    $0x6,%edx
+  8016e9:	74 0e                	je     8016f9 <sys_env_set_status+0x7a>
+  8016eb:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8016ee:	0f b6 c9             	movzbl %cl,%ecx
+  8016f1:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8016f7:	eb 98                	jmp    801691 <sys_env_set_status+0x12>
+  8016f9:	89 c2                	mov    %eax,%edx
+  8016fb:	c1 ea 04             	shr    $0x4,%edx
+  8016fe:	83 e2 0f             	and    $0xf,%edx
+  801701:	83 fa 02             	cmp    $0x2,%edx
+  801704:	77 e5                	ja     8016eb <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  801706:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801709:	83 f8 02             	cmp    $0x2,%eax
+  80170c:	0f 97 c1             	seta   %cl
+  80170f:	0f b6 c9             	movzbl %cl,%ecx
+  801712:	eb d7                	jmp    8016eb <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  801714:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801719:	b8 08 00 00 00       	mov    $0x8,%eax
+  80171e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801721:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801724:	89 df                	mov    %ebx,%edi
+  801726:	89 de                	mov    %ebx,%esi
+  801728:	cd 30                	int    $0x30
+  80172a:	eb 90                	jmp    8016bc <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80172c:	83 ec 0c             	sub    $0xc,%esp
+  80172f:	50                   	push   %eax
+  801730:	6a 08                	push   $0x8
+  801732:	68 39 35 80 00       	push   $0x803539
+  801737:	6a 4a                	push   $0x4a
+  801739:	68 56 35 80 00       	push   $0x803556
+  80173e:	e8 54 ec ff ff       	call   800397 <_panic>
+
+00801743 <sys_sysinfo>:
+{
+  801743:	55                   	push   %ebp
+  801744:	89 e5                	mov    %esp,%ebp
+  801746:	57                   	push   %edi
+  801747:	56                   	push   %esi
+  801748:	53                   	push   %ebx
+  801749:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80174c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801753:	78 36                	js     80178b <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  801755:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80175c:	74 79                	je     8017d7 <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  80175e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801761:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801766:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80176b:	89 cb                	mov    %ecx,%ebx
+  80176d:	89 cf                	mov    %ecx,%edi
+  80176f:	89 ce                	mov    %ecx,%esi
+  801771:	55                   	push   %ebp
+  801772:	68 7b 17 80 00       	push   $0x80177b
+  801777:	89 e5                	mov    %esp,%ebp
+  801779:	0f 34                	sysenter
+  80177b:	83 c4 04             	add    $0x4,%esp
+  80177e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80177f:	85 c0                	test   %eax,%eax
+  801781:	7f 6b                	jg     8017ee <sys_sysinfo+0xab>
+}
+  801783:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801786:	5b                   	pop    %ebx
+  801787:	5e                   	pop    %esi
+  801788:	5f                   	pop    %edi
+  801789:	5d                   	pop    %ebp
+  80178a:	c3                   	ret
+  80178b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801790:	0f a2                	cpuid
+		return 0;
+  801792:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801797:	f6 c6 08             	test   $0x8,%dh
+  80179a:	74 15                	je     8017b1 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80179c:	89 c2                	mov    %eax,%edx
+  80179e:	c1 ea 08             	shr    $0x8,%edx
+  8017a1:	83 e2 0f             	and    $0xf,%edx
+  8017a4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017a9:	83 fa 06             	cmp    $0x6,%edx
+  8017ac:	74 0e                	je     8017bc <sys_sysinfo+0x79>
+  8017ae:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8017b1:	0f b6 c9             	movzbl %cl,%ecx
+  8017b4:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8017ba:	eb 99                	jmp    801755 <sys_sysinfo+0x12>
+  8017bc:	89 c2                	mov    %eax,%edx
+  8017be:	c1 ea 04             	shr    $0x4,%edx
+  8017c1:	83 e2 0f             	and    $0xf,%edx
+  8017c4:	83 fa 02             	cmp    $0x2,%edx
+  8017c7:	77 e5                	ja     8017ae <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  8017c9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017cc:	83 f8 02             	cmp    $0x2,%eax
+  8017cf:	0f 97 c1             	seta   %cl
+  8017d2:	0f b6 c9             	movzbl %cl,%ecx
+  8017d5:	eb d7                	jmp    8017ae <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  8017d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017dc:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8017e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017e4:	89 cb                	mov    %ecx,%ebx
+  8017e6:	89 cf                	mov    %ecx,%edi
+  8017e8:	89 ce                	mov    %ecx,%esi
+  8017ea:	cd 30                	int    $0x30
+  8017ec:	eb 91                	jmp    80177f <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017ee:	83 ec 0c             	sub    $0xc,%esp
+  8017f1:	50                   	push   %eax
+  8017f2:	6a 0b                	push   $0xb
+  8017f4:	68 39 35 80 00       	push   $0x803539
+  8017f9:	6a 4a                	push   $0x4a
+  8017fb:	68 56 35 80 00       	push   $0x803556
+  801800:	e8 92 eb ff ff       	call   800397 <_panic>
+
+00801805 <sys_env_set_trapframe>:
+{
+  801805:	55                   	push   %ebp
+  801806:	89 e5                	mov    %esp,%ebp
+  801808:	57                   	push   %edi
+  801809:	56                   	push   %esi
+  80180a:	53                   	push   %ebx
+  80180b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80180e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801815:	78 37                	js     80184e <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  801817:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80181e:	74 7a                	je     80189a <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  801820:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801825:	8b 55 08             	mov    0x8(%ebp),%edx
+  801828:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80182b:	b8 13 00 00 00       	mov    $0x13,%eax
+  801830:	89 df                	mov    %ebx,%edi
+  801832:	89 de                	mov    %ebx,%esi
+  801834:	55                   	push   %ebp
+  801835:	68 3e 18 80 00       	push   $0x80183e
+  80183a:	89 e5                	mov    %esp,%ebp
+  80183c:	0f 34                	sysenter
+  80183e:	83 c4 04             	add    $0x4,%esp
+  801841:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801842:	85 c0                	test   %eax,%eax
+  801844:	7f 6c                	jg     8018b2 <sys_env_set_trapframe+0xad>
+}
+  801846:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801849:	5b                   	pop    %ebx
+  80184a:	5e                   	pop    %esi
+  80184b:	5f                   	pop    %edi
+  80184c:	5d                   	pop    %ebp
+  80184d:	c3                   	ret
+  80184e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801853:	0f a2                	cpuid
+		return 0;
+  801855:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80185a:	f6 c6 08             	test   $0x8,%dh
+  80185d:	74 15                	je     801874 <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80185f:	89 c2                	mov    %eax,%edx
+  801861:	c1 ea 08             	shr    $0x8,%edx
+  801864:	83 e2 0f             	and    $0xf,%edx
+  801867:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80186c:	83 fa 06             	cmp    $0x6,%edx
+  80186f:	74 0e                	je     80187f <sys_env_set_trapframe+0x7a>
+  801871:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801874:	0f b6 c9             	movzbl %cl,%ecx
+  801877:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80187d:	eb 98                	jmp    801817 <sys_env_set_trapframe+0x12>
+  80187f:	89 c2                	mov    %eax,%edx
+  801881:	c1 ea 04             	shr    $0x4,%edx
+  801884:	83 e2 0f             	and    $0xf,%edx
+  801887:	83 fa 02             	cmp    $0x2,%edx
+  80188a:	77 e5                	ja     801871 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  80188c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80188f:	83 f8 02             	cmp    $0x2,%eax
+  801892:	0f 97 c1             	seta   %cl
+  801895:	0f b6 c9             	movzbl %cl,%ecx
+  801898:	eb d7                	jmp    801871 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  80189a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80189f:	b8 13 00 00 00       	mov    $0x13,%eax
+  8018a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018aa:	89 df                	mov    %ebx,%edi
+  8018ac:	89 de                	mov    %ebx,%esi
+  8018ae:	cd 30                	int    $0x30
+  8018b0:	eb 90                	jmp    801842 <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8018b2:	83 ec 0c             	sub    $0xc,%esp
+  8018b5:	50                   	push   %eax
+  8018b6:	6a 13                	push   $0x13
+  8018b8:	68 39 35 80 00       	push   $0x803539
+  8018bd:	6a 4a                	push   $0x4a
+  8018bf:	68 56 35 80 00       	push   $0x803556
+  8018c4:	e8 ce ea ff ff       	call   800397 <_panic>
+
+008018c9 <sys_env_set_stack_limit>:
+{
+  8018c9:	55                   	push   %ebp
+  8018ca:	89 e5                	mov    %esp,%ebp
+  8018cc:	57                   	push   %edi
+  8018cd:	56                   	push   %esi
+  8018ce:	53                   	push   %ebx
+  8018cf:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8018d2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8018d9:	78 37                	js     801912 <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  8018db:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8018e2:	74 7a                	je     80195e <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  8018e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018ef:	b8 19 00 00 00       	mov    $0x19,%eax
+  8018f4:	89 df                	mov    %ebx,%edi
+  8018f6:	89 de                	mov    %ebx,%esi
+  8018f8:	55                   	push   %ebp
+  8018f9:	68 02 19 80 00       	push   $0x801902
+  8018fe:	89 e5                	mov    %esp,%ebp
+  801900:	0f 34                	sysenter
+  801902:	83 c4 04             	add    $0x4,%esp
+  801905:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801906:	85 c0                	test   %eax,%eax
+  801908:	7f 6c                	jg     801976 <sys_env_set_stack_limit+0xad>
+}
+  80190a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80190d:	5b                   	pop    %ebx
+  80190e:	5e                   	pop    %esi
+  80190f:	5f                   	pop    %edi
+  801910:	5d                   	pop    %ebp
+  801911:	c3                   	ret
+  801912:	b8 01 00 00 00       	mov    $0x1,%eax
+  801917:	0f a2                	cpuid
+		return 0;
+  801919:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80191e:	f6 c6 08             	test   $0x8,%dh
+  801921:	74 15                	je     801938 <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801923:	89 c2                	mov    %eax,%edx
+  801925:	c1 ea 08             	shr    $0x8,%edx
+  801928:	83 e2 0f             	and    $0xf,%edx
+  80192b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801930:	83 fa 06             	cmp    $0x6,%edx
+  801933:	74 0e                	je     801943 <sys_env_set_stack_limit+0x7a>
+  801935:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801938:	0f b6 c9             	movzbl %cl,%ecx
+  80193b:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801941:	eb 98                	jmp    8018db <sys_env_set_stack_limit+0x12>
+  801943:	89 c2                	mov    %eax,%edx
+  801945:	c1 ea 04             	shr    $0x4,%edx
+  801948:	83 e2 0f             	and    $0xf,%edx
+  80194b:	83 fa 02             	cmp    $0x2,%edx
+  80194e:	77 e5                	ja     801935 <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  801950:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801953:	83 f8 02             	cmp    $0x2,%eax
+  801956:	0f 97 c1             	seta   %cl
+  801959:	0f b6 c9             	movzbl %cl,%ecx
+  80195c:	eb d7                	jmp    801935 <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  80195e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801963:	b8 19 00 00 00       	mov    $0x19,%eax
+  801968:	8b 55 08             	mov    0x8(%ebp),%edx
+  80196b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80196e:	89 df                	mov    %ebx,%edi
+  801970:	89 de                	mov    %ebx,%esi
+  801972:	cd 30                	int    $0x30
+  801974:	eb 90                	jmp    801906 <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801976:	83 ec 0c             	sub    $0xc,%esp
+  801979:	50                   	push   %eax
+  80197a:	6a 19                	push   $0x19
+  80197c:	68 39 35 80 00       	push   $0x803539
+  801981:	6a 4a                	push   $0x4a
+  801983:	68 56 35 80 00       	push   $0x803556
+  801988:	e8 0a ea ff ff       	call   800397 <_panic>
+
+0080198d <sys_env_set_pgfault_upcall>:
+{
+  80198d:	55                   	push   %ebp
+  80198e:	89 e5                	mov    %esp,%ebp
+  801990:	57                   	push   %edi
+  801991:	56                   	push   %esi
+  801992:	53                   	push   %ebx
+  801993:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801996:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80199d:	78 37                	js     8019d6 <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  80199f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8019a6:	74 7a                	je     801a22 <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  8019a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019b3:	b8 09 00 00 00       	mov    $0x9,%eax
+  8019b8:	89 df                	mov    %ebx,%edi
+  8019ba:	89 de                	mov    %ebx,%esi
+  8019bc:	55                   	push   %ebp
+  8019bd:	68 c6 19 80 00       	push   $0x8019c6
+  8019c2:	89 e5                	mov    %esp,%ebp
+  8019c4:	0f 34                	sysenter
+  8019c6:	83 c4 04             	add    $0x4,%esp
+  8019c9:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8019ca:	85 c0                	test   %eax,%eax
+  8019cc:	7f 6c                	jg     801a3a <sys_env_set_pgfault_upcall+0xad>
+}
+  8019ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019d1:	5b                   	pop    %ebx
+  8019d2:	5e                   	pop    %esi
+  8019d3:	5f                   	pop    %edi
+  8019d4:	5d                   	pop    %ebp
+  8019d5:	c3                   	ret
+  8019d6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019db:	0f a2                	cpuid
+		return 0;
+  8019dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8019e2:	f6 c6 08             	test   $0x8,%dh
+  8019e5:	74 15                	je     8019fc <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019e7:	89 c2                	mov    %eax,%edx
+  8019e9:	c1 ea 08             	shr    $0x8,%edx
+  8019ec:	83 e2 0f             	and    $0xf,%edx
+  8019ef:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019f4:	83 fa 06             	cmp    $0x6,%edx
+  8019f7:	74 0e                	je     801a07 <sys_env_set_pgfault_upcall+0x7a>
+  8019f9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8019fc:	0f b6 c9             	movzbl %cl,%ecx
+  8019ff:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801a05:	eb 98                	jmp    80199f <sys_env_set_pgfault_upcall+0x12>
+  801a07:	89 c2                	mov    %eax,%edx
+  801a09:	c1 ea 04             	shr    $0x4,%edx
+  801a0c:	83 e2 0f             	and    $0xf,%edx
+  801a0f:	83 fa 02             	cmp    $0x2,%edx
+  801a12:	77 e5                	ja     8019f9 <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  801a14:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a17:	83 f8 02             	cmp    $0x2,%eax
+  801a1a:	0f 97 c1             	seta   %cl
+  801a1d:	0f b6 c9             	movzbl %cl,%ecx
+  801a20:	eb d7                	jmp    8019f9 <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  801a22:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a27:	b8 09 00 00 00       	mov    $0x9,%eax
+  801a2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a32:	89 df                	mov    %ebx,%edi
+  801a34:	89 de                	mov    %ebx,%esi
+  801a36:	cd 30                	int    $0x30
+  801a38:	eb 90                	jmp    8019ca <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a3a:	83 ec 0c             	sub    $0xc,%esp
+  801a3d:	50                   	push   %eax
+  801a3e:	6a 09                	push   $0x9
+  801a40:	68 39 35 80 00       	push   $0x803539
+  801a45:	6a 4a                	push   $0x4a
+  801a47:	68 56 35 80 00       	push   $0x803556
+  801a4c:	e8 46 e9 ff ff       	call   800397 <_panic>
+
+00801a51 <sys_ipc_try_send>:
+{
+  801a51:	55                   	push   %ebp
+  801a52:	89 e5                	mov    %esp,%ebp
+  801a54:	57                   	push   %edi
+  801a55:	56                   	push   %esi
+  801a56:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801a57:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a5e:	78 32                	js     801a92 <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  801a60:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a67:	74 75                	je     801ade <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801a69:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a6c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a6f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801a74:	be 00 00 00 00       	mov    $0x0,%esi
+  801a79:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a7c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a7f:	55                   	push   %ebp
+  801a80:	68 89 1a 80 00       	push   $0x801a89
+  801a85:	89 e5                	mov    %esp,%ebp
+  801a87:	0f 34                	sysenter
+  801a89:	83 c4 04             	add    $0x4,%esp
+  801a8c:	5d                   	pop    %ebp
+}
+  801a8d:	5b                   	pop    %ebx
+  801a8e:	5e                   	pop    %esi
+  801a8f:	5f                   	pop    %edi
+  801a90:	5d                   	pop    %ebp
+  801a91:	c3                   	ret
+  801a92:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a97:	0f a2                	cpuid
+		return 0;
+  801a99:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801a9e:	f6 c6 08             	test   $0x8,%dh
+  801aa1:	74 15                	je     801ab8 <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801aa3:	89 c2                	mov    %eax,%edx
+  801aa5:	c1 ea 08             	shr    $0x8,%edx
+  801aa8:	83 e2 0f             	and    $0xf,%edx
+  801aab:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ab0:	83 fa 06             	cmp    $0x6,%edx
+  801ab3:	74 0e                	je     801ac3 <sys_ipc_try_send+0x72>
+  801ab5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801ab8:	0f b6 c9             	movzbl %cl,%ecx
+  801abb:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801ac1:	eb 9d                	jmp    801a60 <sys_ipc_try_send+0xf>
+  801ac3:	89 c2                	mov    %eax,%edx
+  801ac5:	c1 ea 04             	shr    $0x4,%edx
+  801ac8:	83 e2 0f             	and    $0xf,%edx
+  801acb:	83 fa 02             	cmp    $0x2,%edx
+  801ace:	77 e5                	ja     801ab5 <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  801ad0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ad3:	83 f8 02             	cmp    $0x2,%eax
+  801ad6:	0f 97 c1             	seta   %cl
+  801ad9:	0f b6 c9             	movzbl %cl,%ecx
+  801adc:	eb d7                	jmp    801ab5 <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  801ade:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801ae3:	be 00 00 00 00       	mov    $0x0,%esi
+  801ae8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aeb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801aee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801af1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801af4:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801af6:	eb 95                	jmp    801a8d <sys_ipc_try_send+0x3c>
+
+00801af8 <sys_ipc_send>:
+{
+  801af8:	55                   	push   %ebp
+  801af9:	89 e5                	mov    %esp,%ebp
+  801afb:	57                   	push   %edi
+  801afc:	56                   	push   %esi
+  801afd:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801afe:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b05:	78 32                	js     801b39 <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  801b07:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b0e:	74 75                	je     801b85 <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801b10:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b13:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b16:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801b1b:	be 00 00 00 00       	mov    $0x0,%esi
+  801b20:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b23:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801b26:	55                   	push   %ebp
+  801b27:	68 30 1b 80 00       	push   $0x801b30
+  801b2c:	89 e5                	mov    %esp,%ebp
+  801b2e:	0f 34                	sysenter
+  801b30:	83 c4 04             	add    $0x4,%esp
+  801b33:	5d                   	pop    %ebp
+}
+  801b34:	5b                   	pop    %ebx
+  801b35:	5e                   	pop    %esi
+  801b36:	5f                   	pop    %edi
+  801b37:	5d                   	pop    %ebp
+  801b38:	c3                   	ret
+  801b39:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b3e:	0f a2                	cpuid
+		return 0;
+  801b40:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b45:	f6 c6 08             	test   $0x8,%dh
+  801b48:	74 15                	je     801b5f <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b4a:	89 c2                	mov    %eax,%edx
+  801b4c:	c1 ea 08             	shr    $0x8,%edx
+  801b4f:	83 e2 0f             	and    $0xf,%edx
+  801b52:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b57:	83 fa 06             	cmp    $0x6,%edx
+  801b5a:	74 0e                	je     801b6a <sys_ipc_send+0x72>
+  801b5c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b5f:	0f b6 c9             	movzbl %cl,%ecx
+  801b62:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801b68:	eb 9d                	jmp    801b07 <sys_ipc_send+0xf>
+  801b6a:	89 c2                	mov    %eax,%edx
+  801b6c:	c1 ea 04             	shr    $0x4,%edx
+  801b6f:	83 e2 0f             	and    $0xf,%edx
+  801b72:	83 fa 02             	cmp    $0x2,%edx
+  801b75:	77 e5                	ja     801b5c <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  801b77:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b7a:	83 f8 02             	cmp    $0x2,%eax
+  801b7d:	0f 97 c1             	seta   %cl
+  801b80:	0f b6 c9             	movzbl %cl,%ecx
+  801b83:	eb d7                	jmp    801b5c <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  801b85:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801b8a:	be 00 00 00 00       	mov    $0x0,%esi
+  801b8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b92:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b95:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b98:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801b9b:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801b9d:	eb 95                	jmp    801b34 <sys_ipc_send+0x3c>
+
+00801b9f <sys_ipc_recv>:
+{
+  801b9f:	55                   	push   %ebp
+  801ba0:	89 e5                	mov    %esp,%ebp
+  801ba2:	57                   	push   %edi
+  801ba3:	56                   	push   %esi
+  801ba4:	53                   	push   %ebx
+  801ba5:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801ba8:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801baf:	78 36                	js     801be7 <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  801bb1:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801bb8:	74 79                	je     801c33 <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  801bba:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bbd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bc2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801bc7:	89 cb                	mov    %ecx,%ebx
+  801bc9:	89 cf                	mov    %ecx,%edi
+  801bcb:	89 ce                	mov    %ecx,%esi
+  801bcd:	55                   	push   %ebp
+  801bce:	68 d7 1b 80 00       	push   $0x801bd7
+  801bd3:	89 e5                	mov    %esp,%ebp
+  801bd5:	0f 34                	sysenter
+  801bd7:	83 c4 04             	add    $0x4,%esp
+  801bda:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801bdb:	85 c0                	test   %eax,%eax
+  801bdd:	7f 6b                	jg     801c4a <sys_ipc_recv+0xab>
+}
+  801bdf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801be2:	5b                   	pop    %ebx
+  801be3:	5e                   	pop    %esi
+  801be4:	5f                   	pop    %edi
+  801be5:	5d                   	pop    %ebp
+  801be6:	c3                   	ret
+  801be7:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bec:	0f a2                	cpuid
+		return 0;
+  801bee:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801bf3:	f6 c6 08             	test   $0x8,%dh
+  801bf6:	74 15                	je     801c0d <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bf8:	89 c2                	mov    %eax,%edx
+  801bfa:	c1 ea 08             	shr    $0x8,%edx
+  801bfd:	83 e2 0f             	and    $0xf,%edx
+  801c00:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801c05:	83 fa 06             	cmp    $0x6,%edx
+  801c08:	74 0e                	je     801c18 <sys_ipc_recv+0x79>
+  801c0a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801c0d:	0f b6 c9             	movzbl %cl,%ecx
+  801c10:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801c16:	eb 99                	jmp    801bb1 <sys_ipc_recv+0x12>
+  801c18:	89 c2                	mov    %eax,%edx
+  801c1a:	c1 ea 04             	shr    $0x4,%edx
+  801c1d:	83 e2 0f             	and    $0xf,%edx
+  801c20:	83 fa 02             	cmp    $0x2,%edx
+  801c23:	77 e5                	ja     801c0a <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  801c25:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c28:	83 f8 02             	cmp    $0x2,%eax
+  801c2b:	0f 97 c1             	seta   %cl
+  801c2e:	0f b6 c9             	movzbl %cl,%ecx
+  801c31:	eb d7                	jmp    801c0a <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  801c33:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c38:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801c3d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c40:	89 cb                	mov    %ecx,%ebx
+  801c42:	89 cf                	mov    %ecx,%edi
+  801c44:	89 ce                	mov    %ecx,%esi
+  801c46:	cd 30                	int    $0x30
+  801c48:	eb 91                	jmp    801bdb <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801c4a:	83 ec 0c             	sub    $0xc,%esp
+  801c4d:	50                   	push   %eax
+  801c4e:	6a 0d                	push   $0xd
+  801c50:	68 39 35 80 00       	push   $0x803539
+  801c55:	6a 4a                	push   $0x4a
+  801c57:	68 56 35 80 00       	push   $0x803556
+  801c5c:	e8 36 e7 ff ff       	call   800397 <_panic>
+
+00801c61 <sys_ipc_send_range>:
+{
+  801c61:	55                   	push   %ebp
+  801c62:	89 e5                	mov    %esp,%ebp
+  801c64:	57                   	push   %edi
+  801c65:	56                   	push   %esi
+  801c66:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801c67:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801c6e:	78 30                	js     801ca0 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  801c70:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801c77:	74 73                	je     801cec <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801c79:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c7c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c7f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801c84:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801c87:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801c8a:	8b 75 18             	mov    0x18(%ebp),%esi
+  801c8d:	55                   	push   %ebp
+  801c8e:	68 97 1c 80 00       	push   $0x801c97
+  801c93:	89 e5                	mov    %esp,%ebp
+  801c95:	0f 34                	sysenter
+  801c97:	83 c4 04             	add    $0x4,%esp
+  801c9a:	5d                   	pop    %ebp
+}
+  801c9b:	5b                   	pop    %ebx
+  801c9c:	5e                   	pop    %esi
+  801c9d:	5f                   	pop    %edi
+  801c9e:	5d                   	pop    %ebp
+  801c9f:	c3                   	ret
+  801ca0:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ca5:	0f a2                	cpuid
+		return 0;
+  801ca7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801cac:	f6 c6 08             	test   $0x8,%dh
+  801caf:	74 15                	je     801cc6 <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801cb1:	89 c2                	mov    %eax,%edx
+  801cb3:	c1 ea 08             	shr    $0x8,%edx
+  801cb6:	83 e2 0f             	and    $0xf,%edx
+  801cb9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801cbe:	83 fa 06             	cmp    $0x6,%edx
+  801cc1:	74 0e                	je     801cd1 <sys_ipc_send_range+0x70>
+  801cc3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801cc6:	0f b6 c9             	movzbl %cl,%ecx
+  801cc9:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801ccf:	eb 9f                	jmp    801c70 <sys_ipc_send_range+0xf>
+  801cd1:	89 c2                	mov    %eax,%edx
+  801cd3:	c1 ea 04             	shr    $0x4,%edx
+  801cd6:	83 e2 0f             	and    $0xf,%edx
+  801cd9:	83 fa 02             	cmp    $0x2,%edx
+  801cdc:	77 e5                	ja     801cc3 <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  801cde:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ce1:	83 f8 02             	cmp    $0x2,%eax
+  801ce4:	0f 97 c1             	seta   %cl
+  801ce7:	0f b6 c9             	movzbl %cl,%ecx
+  801cea:	eb d7                	jmp    801cc3 <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  801cec:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801cf1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cf4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cf7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801cfa:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801cfd:	8b 75 18             	mov    0x18(%ebp),%esi
+  801d00:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  801d02:	eb 97                	jmp    801c9b <sys_ipc_send_range+0x3a>
+
+00801d04 <sys_ipc_recv_range>:
+{
+  801d04:	55                   	push   %ebp
+  801d05:	89 e5                	mov    %esp,%ebp
+  801d07:	57                   	push   %edi
+  801d08:	56                   	push   %esi
+  801d09:	53                   	push   %ebx
+  801d0a:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801d0d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801d14:	78 37                	js     801d4d <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  801d16:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801d1d:	74 7a                	je     801d99 <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  801d1f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d24:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d27:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d2a:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801d2f:	89 df                	mov    %ebx,%edi
+  801d31:	89 de                	mov    %ebx,%esi
+  801d33:	55                   	push   %ebp
+  801d34:	68 3d 1d 80 00       	push   $0x801d3d
+  801d39:	89 e5                	mov    %esp,%ebp
+  801d3b:	0f 34                	sysenter
+  801d3d:	83 c4 04             	add    $0x4,%esp
+  801d40:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801d41:	85 c0                	test   %eax,%eax
+  801d43:	7f 6c                	jg     801db1 <sys_ipc_recv_range+0xad>
+}
+  801d45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d48:	5b                   	pop    %ebx
+  801d49:	5e                   	pop    %esi
+  801d4a:	5f                   	pop    %edi
+  801d4b:	5d                   	pop    %ebp
+  801d4c:	c3                   	ret
+  801d4d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d52:	0f a2                	cpuid
+		return 0;
+  801d54:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801d59:	f6 c6 08             	test   $0x8,%dh
+  801d5c:	74 15                	je     801d73 <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d5e:	89 c2                	mov    %eax,%edx
+  801d60:	c1 ea 08             	shr    $0x8,%edx
+  801d63:	83 e2 0f             	and    $0xf,%edx
+  801d66:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d6b:	83 fa 06             	cmp    $0x6,%edx
+  801d6e:	74 0e                	je     801d7e <sys_ipc_recv_range+0x7a>
+  801d70:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801d73:	0f b6 c9             	movzbl %cl,%ecx
+  801d76:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801d7c:	eb 98                	jmp    801d16 <sys_ipc_recv_range+0x12>
+  801d7e:	89 c2                	mov    %eax,%edx
+  801d80:	c1 ea 04             	shr    $0x4,%edx
+  801d83:	83 e2 0f             	and    $0xf,%edx
+  801d86:	83 fa 02             	cmp    $0x2,%edx
+  801d89:	77 e5                	ja     801d70 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801d8b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d8e:	83 f8 02             	cmp    $0x2,%eax
+  801d91:	0f 97 c1             	seta   %cl
+  801d94:	0f b6 c9             	movzbl %cl,%ecx
+  801d97:	eb d7                	jmp    801d70 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801d99:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d9e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801da3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801da6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801da9:	89 df                	mov    %ebx,%edi
+  801dab:	89 de                	mov    %ebx,%esi
+  801dad:	cd 30                	int    $0x30
+  801daf:	eb 90                	jmp    801d41 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801db1:	83 ec 0c             	sub    $0xc,%esp
+  801db4:	50                   	push   %eax
+  801db5:	6a 1f                	push   $0x1f
+  801db7:	68 39 35 80 00       	push   $0x803539
+  801dbc:	6a 4a                	push   $0x4a
+  801dbe:	68 56 35 80 00       	push   $0x803556
+  801dc3:	e8 cf e5 ff ff       	call   800397 <_panic>
+
+00801dc8 <sys_ipc_call>:
+{
+  801dc8:	55                   	push   %ebp
+  801dc9:	89 e5                	mov    %esp,%ebp
+  801dcb:	57                   	push   %edi
+  801dcc:	56                   	push   %esi
+  801dcd:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801dce:	8b 55 08             	mov    0x8(%ebp),%edx
+  801dd1:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801dd6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801dd9:	55                   	push   %ebp
+  801dda:	56                   	push   %esi
+  801ddb:	8b 0e                	mov    (%esi),%ecx
+  801ddd:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801de0:	8b 7e 08             	mov    0x8(%esi),%edi
+  801de3:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801de6:	8b 76 0c             	mov    0xc(%esi),%esi
+  801de9:	cd 30                	int    $0x30
+  801deb:	87 34 24             	xchg   %esi,(%esp)
+  801dee:	89 0e                	mov    %ecx,(%esi)
+  801df0:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801df3:	89 7e 08             	mov    %edi,0x8(%esi)
+  801df6:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801df9:	8f 46 0c             	pop    0xc(%esi)
+  801dfc:	5d                   	pop    %ebp
+}
+  801dfd:	5b                   	pop    %ebx
+  801dfe:	5e                   	pop    %esi
+  801dff:	5f                   	pop    %edi
+  801e00:	5d                   	pop    %ebp
+  801e01:	c3                   	ret
+
+00801e02 <sys_ipc_reply_wait>:
+{
+  801e02:	55                   	push   %ebp
+  801e03:	89 e5                	mov    %esp,%ebp
+  801e05:	57                   	push   %edi
+  801e06:	56                   	push   %esi
+  801e07:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801e08:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e0b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801e10:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801e13:	55                   	push   %ebp
+  801e14:	56                   	push   %esi
+  801e15:	8b 0e                	mov    (%esi),%ecx
+  801e17:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801e1a:	8b 7e 08             	mov    0x8(%esi),%edi
+  801e1d:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801e20:	8b 76 0c             	mov    0xc(%esi),%esi
+  801e23:	cd 30                	int    $0x30
+  801e25:	87 34 24             	xchg   %esi,(%esp)
+  801e28:	89 0e                	mov    %ecx,(%esi)
+  801e2a:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801e2d:	89 7e 08             	mov    %edi,0x8(%esi)
+  801e30:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801e33:	8f 46 0c             	pop    0xc(%esi)
+  801e36:	5d                   	pop    %ebp
+}
+  801e37:	5b                   	pop    %ebx
+  801e38:	5e                   	pop    %esi
+  801e39:	5f                   	pop    %edi
+  801e3a:	5d                   	pop    %ebp
+  801e3b:	c3                   	ret
+
+00801e3c <sys_ipc_send_msg>:
+{
+  801e3c:	55                   	push   %ebp
+  801e3d:	89 e5                	mov    %esp,%ebp
+  801e3f:	57                   	push   %edi
+  801e40:	56                   	push   %esi
+  801e41:	53                   	push   %ebx
+  801e42:	83 ec 20             	sub    $0x20,%esp
+  801e45:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801e48:	8b 10                	mov    (%eax),%edx
+  801e4a:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801e4d:	8b 50 04             	mov    0x4(%eax),%edx
+  801e50:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801e53:	8b 50 08             	mov    0x8(%eax),%edx
+  801e56:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801e59:	8b 50 0c             	mov    0xc(%eax),%edx
+  801e5c:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801e5f:	8b 40 10             	mov    0x10(%eax),%eax
+  801e62:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801e65:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801e68:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e6b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801e70:	55                   	push   %ebp
+  801e71:	56                   	push   %esi
+  801e72:	8b 0e                	mov    (%esi),%ecx
+  801e74:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801e77:	8b 7e 08             	mov    0x8(%esi),%edi
+  801e7a:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801e7d:	8b 76 0c             	mov    0xc(%esi),%esi
+  801e80:	cd 30                	int    $0x30
+  801e82:	87 34 24             	xchg   %esi,(%esp)
+  801e85:	89 0e                	mov    %ecx,(%esi)
+  801e87:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801e8a:	89 7e 08             	mov    %edi,0x8(%esi)
+  801e8d:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801e90:	8f 46 0c             	pop    0xc(%esi)
+  801e93:	5d                   	pop    %ebp
+}
+  801e94:	83 c4 20             	add    $0x20,%esp
+  801e97:	5b                   	pop    %ebx
+  801e98:	5e                   	pop    %esi
+  801e99:	5f                   	pop    %edi
+  801e9a:	5d                   	pop    %ebp
+  801e9b:	c3                   	ret
+
+00801e9c <sys_fork>:
+{
+  801e9c:	55                   	push   %ebp
+  801e9d:	89 e5                	mov    %esp,%ebp
+  801e9f:	57                   	push   %edi
+  801ea0:	56                   	push   %esi
+  801ea1:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801ea2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ea9:	78 2e                	js     801ed9 <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801eab:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801eb2:	74 71                	je     801f25 <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801eb4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eb9:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801ebe:	89 d1                	mov    %edx,%ecx
+  801ec0:	89 d3                	mov    %edx,%ebx
+  801ec2:	89 d7                	mov    %edx,%edi
+  801ec4:	89 d6                	mov    %edx,%esi
+  801ec6:	55                   	push   %ebp
+  801ec7:	68 d0 1e 80 00       	push   $0x801ed0
+  801ecc:	89 e5                	mov    %esp,%ebp
+  801ece:	0f 34                	sysenter
+  801ed0:	83 c4 04             	add    $0x4,%esp
+  801ed3:	5d                   	pop    %ebp
+}
+  801ed4:	5b                   	pop    %ebx
+  801ed5:	5e                   	pop    %esi
+  801ed6:	5f                   	pop    %edi
+  801ed7:	5d                   	pop    %ebp
+  801ed8:	c3                   	ret
+  801ed9:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ede:	0f a2                	cpuid
+		return 0;
+  801ee0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801ee5:	f6 c6 08             	test   $0x8,%dh
+  801ee8:	74 15                	je     801eff <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801eea:	89 c2                	mov    %eax,%edx
+  801eec:	c1 ea 08             	shr    $0x8,%edx
+  801eef:	83 e2 0f             	and    $0xf,%edx
+  801ef2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ef7:	83 fa 06             	cmp    $0x6,%edx
+  801efa:	74 0e                	je     801f0a <sys_fork+0x6e>
+  801efc:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801eff:	0f b6 c9             	movzbl %cl,%ecx
+  801f02:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801f08:	eb a1                	jmp    801eab <sys_fork+0xf>
+  801f0a:	89 c2                	mov    %eax,%edx
+  801f0c:	c1 ea 04             	shr    $0x4,%edx
+  801f0f:	83 e2 0f             	and    $0xf,%edx
+  801f12:	83 fa 02             	cmp    $0x2,%edx
+  801f15:	77 e5                	ja     801efc <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801f17:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f1a:	83 f8 02             	cmp    $0x2,%eax
+  801f1d:	0f 97 c1             	seta   %cl
+  801f20:	0f b6 c9             	movzbl %cl,%ecx
+  801f23:	eb d7                	jmp    801efc <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801f25:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f2a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801f2f:	89 d1                	mov    %edx,%ecx
+  801f31:	89 d3                	mov    %edx,%ebx
+  801f33:	89 d7                	mov    %edx,%edi
+  801f35:	89 d6                	mov    %edx,%esi
+  801f37:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801f39:	eb 99                	jmp    801ed4 <sys_fork+0x38>
+
+00801f3b <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801f3b:	55                   	push   %ebp
+  801f3c:	89 e5                	mov    %esp,%ebp
+  801f3e:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801f41:	ff 75 14             	push   0x14(%ebp)
+  801f44:	ff 75 10             	push   0x10(%ebp)
+  801f47:	ff 75 0c             	push   0xc(%ebp)
+  801f4a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f52:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801f57:	e8 81 ee ff ff       	call   800ddd <page_vec_call>
+}
+  801f5c:	c9                   	leave
+  801f5d:	c3                   	ret
+
+00801f5e <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801f5e:	55                   	push   %ebp
+  801f5f:	89 e5                	mov    %esp,%ebp
+  801f61:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801f64:	ff 75 18             	push   0x18(%ebp)
+  801f67:	ff 75 14             	push   0x14(%ebp)
+  801f6a:	ff 75 10             	push   0x10(%ebp)
+  801f6d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f70:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f73:	b8 10 00 00 00       	mov    $0x10,%eax
+  801f78:	e8 60 ee ff ff       	call   800ddd <page_vec_call>
+}
+  801f7d:	c9                   	leave
+  801f7e:	c3                   	ret
+
+00801f7f <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801f7f:	55                   	push   %ebp
+  801f80:	89 e5                	mov    %esp,%ebp
+  801f82:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801f85:	ff 75 14             	push   0x14(%ebp)
+  801f88:	ff 75 10             	push   0x10(%ebp)
+  801f8b:	ff 75 0c             	push   0xc(%ebp)
+  801f8e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f93:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f96:	b8 11 00 00 00       	mov    $0x11,%eax
+  801f9b:	e8 3d ee ff ff       	call   800ddd <page_vec_call>
+}
+  801fa0:	c9                   	leave
+  801fa1:	c3                   	ret
+
+00801fa2 <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801fa2:	55                   	push   %ebp
+  801fa3:	89 e5                	mov    %esp,%ebp
+  801fa5:	57                   	push   %edi
+  801fa6:	56                   	push   %esi
+  801fa7:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801fa8:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801faf:	78 32                	js     801fe3 <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801fb1:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801fb8:	74 75                	je     80202f <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801fba:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fbd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fc0:	b8 12 00 00 00       	mov    $0x12,%eax
+  801fc5:	be 00 00 00 00       	mov    $0x0,%esi
+  801fca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801fcd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801fd0:	55                   	push   %ebp
+  801fd1:	68 da 1f 80 00       	push   $0x801fda
+  801fd6:	89 e5                	mov    %esp,%ebp
+  801fd8:	0f 34                	sysenter
+  801fda:	83 c4 04             	add    $0x4,%esp
+  801fdd:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801fde:	5b                   	pop    %ebx
+  801fdf:	5e                   	pop    %esi
+  801fe0:	5f                   	pop    %edi
+  801fe1:	5d                   	pop    %ebp
+  801fe2:	c3                   	ret
+  801fe3:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fe8:	0f a2                	cpuid
+		return 0;
+  801fea:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801fef:	f6 c6 08             	test   $0x8,%dh
+  801ff2:	74 15                	je     802009 <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ff4:	89 c2                	mov    %eax,%edx
+  801ff6:	c1 ea 08             	shr    $0x8,%edx
+  801ff9:	83 e2 0f             	and    $0xf,%edx
+  801ffc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802001:	83 fa 06             	cmp    $0x6,%edx
+  802004:	74 0e                	je     802014 <sys_vm_ranges+0x72>
+  802006:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802009:	0f b6 c9             	movzbl %cl,%ecx
+  80200c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802012:	eb 9d                	jmp    801fb1 <sys_vm_ranges+0xf>
+  802014:	89 c2                	mov    %eax,%edx
+  802016:	c1 ea 04             	shr    $0x4,%edx
+  802019:	83 e2 0f             	and    $0xf,%edx
+  80201c:	83 fa 02             	cmp    $0x2,%edx
+  80201f:	77 e5                	ja     802006 <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  802021:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802024:	83 f8 02             	cmp    $0x2,%eax
+  802027:	0f 97 c1             	seta   %cl
+  80202a:	0f b6 c9             	movzbl %cl,%ecx
+  80202d:	eb d7                	jmp    802006 <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  80202f:	b8 12 00 00 00       	mov    $0x12,%eax
+  802034:	be 00 00 00 00       	mov    $0x0,%esi
+  802039:	8b 55 08             	mov    0x8(%ebp),%edx
+  80203c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80203f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802042:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802045:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  802047:	eb 95                	jmp    801fde <sys_vm_ranges+0x3c>
+
+00802049 <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  802049:	55                   	push   %ebp
+  80204a:	89 e5                	mov    %esp,%ebp
+  80204c:	57                   	push   %edi
+  80204d:	56                   	push   %esi
+  80204e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80204f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802056:	78 31                	js     802089 <sys_spawn+0x40>
+	if (syscall_sysenter)
+  802058:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80205f:	74 74                	je     8020d5 <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  802061:	be 00 00 00 00       	mov    $0x0,%esi
+  802066:	8b 55 08             	mov    0x8(%ebp),%edx
+  802069:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80206c:	b8 14 00 00 00       	mov    $0x14,%eax
+  802071:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802074:	89 f7                	mov    %esi,%edi
+  802076:	55                   	push   %ebp
+  802077:	68 80 20 80 00       	push   $0x802080
+  80207c:	89 e5                	mov    %esp,%ebp
+  80207e:	0f 34                	sysenter
+  802080:	83 c4 04             	add    $0x4,%esp
+  802083:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  802084:	5b                   	pop    %ebx
+  802085:	5e                   	pop    %esi
+  802086:	5f                   	pop    %edi
+  802087:	5d                   	pop    %ebp
+  802088:	c3                   	ret
+  802089:	b8 01 00 00 00       	mov    $0x1,%eax
+  80208e:	0f a2                	cpuid
+		return 0;
+  802090:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802095:	f6 c6 08             	test   $0x8,%dh
+  802098:	74 15                	je     8020af <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80209a:	89 c2                	mov    %eax,%edx
+  80209c:	c1 ea 08             	shr    $0x8,%edx
+  80209f:	83 e2 0f             	and    $0xf,%edx
+  8020a2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8020a7:	83 fa 06             	cmp    $0x6,%edx
+  8020aa:	74 0e                	je     8020ba <sys_spawn+0x71>
+  8020ac:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8020af:	0f b6 c9             	movzbl %cl,%ecx
+  8020b2:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8020b8:	eb 9e                	jmp    802058 <sys_spawn+0xf>
+  8020ba:	89 c2                	mov    %eax,%edx
+  8020bc:	c1 ea 04             	shr    $0x4,%edx
+  8020bf:	83 e2 0f             	and    $0xf,%edx
+  8020c2:	83 fa 02             	cmp    $0x2,%edx
+  8020c5:	77 e5                	ja     8020ac <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  8020c7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020ca:	83 f8 02             	cmp    $0x2,%eax
+  8020cd:	0f 97 c1             	seta   %cl
+  8020d0:	0f b6 c9             	movzbl %cl,%ecx
+  8020d3:	eb d7                	jmp    8020ac <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  8020d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8020da:	b8 14 00 00 00       	mov    $0x14,%eax
+  8020df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020e5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8020e8:	89 f7                	mov    %esi,%edi
+  8020ea:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  8020ec:	eb 96                	jmp    802084 <sys_spawn+0x3b>
+
+008020ee <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  8020ee:	55                   	push   %ebp
+  8020ef:	89 e5                	mov    %esp,%ebp
+  8020f1:	57                   	push   %edi
+  8020f2:	56                   	push   %esi
+  8020f3:	53                   	push   %ebx
+  8020f4:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8020f7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8020fe:	78 37                	js     802137 <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  802100:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802107:	74 7a                	je     802183 <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  802109:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80210e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802111:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802114:	b8 15 00 00 00       	mov    $0x15,%eax
+  802119:	89 df                	mov    %ebx,%edi
+  80211b:	89 de                	mov    %ebx,%esi
+  80211d:	55                   	push   %ebp
+  80211e:	68 27 21 80 00       	push   $0x802127
+  802123:	89 e5                	mov    %esp,%ebp
+  802125:	0f 34                	sysenter
+  802127:	83 c4 04             	add    $0x4,%esp
+  80212a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80212b:	85 c0                	test   %eax,%eax
+  80212d:	7f 6c                	jg     80219b <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  80212f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802132:	5b                   	pop    %ebx
+  802133:	5e                   	pop    %esi
+  802134:	5f                   	pop    %edi
+  802135:	5d                   	pop    %ebp
+  802136:	c3                   	ret
+  802137:	b8 01 00 00 00       	mov    $0x1,%eax
+  80213c:	0f a2                	cpuid
+		return 0;
+  80213e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802143:	f6 c6 08             	test   $0x8,%dh
+  802146:	74 15                	je     80215d <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802148:	89 c2                	mov    %eax,%edx
+  80214a:	c1 ea 08             	shr    $0x8,%edx
+  80214d:	83 e2 0f             	and    $0xf,%edx
+  802150:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802155:	83 fa 06             	cmp    $0x6,%edx
+  802158:	74 0e                	je     802168 <sys_shm_create+0x7a>
+  80215a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80215d:	0f b6 c9             	movzbl %cl,%ecx
+  802160:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802166:	eb 98                	jmp    802100 <sys_shm_create+0x12>
+  802168:	89 c2                	mov    %eax,%edx
+  80216a:	c1 ea 04             	shr    $0x4,%edx
+  80216d:	83 e2 0f             	and    $0xf,%edx
+  802170:	83 fa 02             	cmp    $0x2,%edx
+  802173:	77 e5                	ja     80215a <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  802175:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802178:	83 f8 02             	cmp    $0x2,%eax
+  80217b:	0f 97 c1             	seta   %cl
+  80217e:	0f b6 c9             	movzbl %cl,%ecx
+  802181:	eb d7                	jmp    80215a <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  802183:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802188:	b8 15 00 00 00       	mov    $0x15,%eax
+  80218d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802190:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802193:	89 df                	mov    %ebx,%edi
+  802195:	89 de                	mov    %ebx,%esi
+  802197:	cd 30                	int    $0x30
+  802199:	eb 90                	jmp    80212b <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80219b:	83 ec 0c             	sub    $0xc,%esp
+  80219e:	50                   	push   %eax
+  80219f:	6a 15                	push   $0x15
+  8021a1:	68 39 35 80 00       	push   $0x803539
+  8021a6:	6a 4a                	push   $0x4a
+  8021a8:	68 56 35 80 00       	push   $0x803556
+  8021ad:	e8 e5 e1 ff ff       	call   800397 <_panic>
+
+008021b2 <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  8021b2:	55                   	push   %ebp
+  8021b3:	89 e5                	mov    %esp,%ebp
+  8021b5:	57                   	push   %edi
+  8021b6:	56                   	push   %esi
+  8021b7:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8021b8:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8021bf:	78 32                	js     8021f3 <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  8021c1:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8021c8:	74 75                	je     80223f <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  8021ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021d0:	b8 16 00 00 00       	mov    $0x16,%eax
+  8021d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8021da:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8021dd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8021e0:	55                   	push   %ebp
+  8021e1:	68 ea 21 80 00       	push   $0x8021ea
+  8021e6:	89 e5                	mov    %esp,%ebp
+  8021e8:	0f 34                	sysenter
+  8021ea:	83 c4 04             	add    $0x4,%esp
+  8021ed:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  8021ee:	5b                   	pop    %ebx
+  8021ef:	5e                   	pop    %esi
+  8021f0:	5f                   	pop    %edi
+  8021f1:	5d                   	pop    %ebp
+  8021f2:	c3                   	ret
+  8021f3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021f8:	0f a2                	cpuid
+		return 0;
+  8021fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8021ff:	f6 c6 08             	test   $0x8,%dh
+  802202:	74 15                	je     802219 <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802204:	89 c2                	mov    %eax,%edx
+  802206:	c1 ea 08             	shr    $0x8,%edx
+  802209:	83 e2 0f             	and    $0xf,%edx
+  80220c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802211:	83 fa 06             	cmp    $0x6,%edx
+  802214:	74 0e                	je     802224 <sys_shm_attach+0x72>
+  802216:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802219:	0f b6 c9             	movzbl %cl,%ecx
+  80221c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802222:	eb 9d                	jmp    8021c1 <sys_shm_attach+0xf>
+  802224:	89 c2                	mov    %eax,%edx
+  802226:	c1 ea 04             	shr    $0x4,%edx
+  802229:	83 e2 0f             	and    $0xf,%edx
+  80222c:	83 fa 02             	cmp    $0x2,%edx
+  80222f:	77 e5                	ja     802216 <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  802231:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802234:	83 f8 02             	cmp    $0x2,%eax
+  802237:	0f 97 c1             	seta   %cl
+  80223a:	0f b6 c9             	movzbl %cl,%ecx
+  80223d:	eb d7                	jmp    802216 <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  80223f:	b8 16 00 00 00       	mov    $0x16,%eax
+  802244:	be 00 00 00 00       	mov    $0x0,%esi
+  802249:	8b 55 08             	mov    0x8(%ebp),%edx
+  80224c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80224f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802252:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802255:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  802257:	eb 95                	jmp    8021ee <sys_shm_attach+0x3c>
+
+00802259 <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  802259:	55                   	push   %ebp
+  80225a:	89 e5                	mov    %esp,%ebp
+  80225c:	57                   	push   %edi
+  80225d:	56                   	push   %esi
+  80225e:	53                   	push   %ebx
+  80225f:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802262:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802269:	78 38                	js     8022a3 <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  80226b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802272:	74 7b                	je     8022ef <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  802274:	be 00 00 00 00       	mov    $0x0,%esi
+  802279:	8b 55 08             	mov    0x8(%ebp),%edx
+  80227c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80227f:	b8 17 00 00 00       	mov    $0x17,%eax
+  802284:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802287:	89 f7                	mov    %esi,%edi
+  802289:	55                   	push   %ebp
+  80228a:	68 93 22 80 00       	push   $0x802293
+  80228f:	89 e5                	mov    %esp,%ebp
+  802291:	0f 34                	sysenter
+  802293:	83 c4 04             	add    $0x4,%esp
+  802296:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802297:	85 c0                	test   %eax,%eax
+  802299:	7f 6d                	jg     802308 <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  80229b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80229e:	5b                   	pop    %ebx
+  80229f:	5e                   	pop    %esi
+  8022a0:	5f                   	pop    %edi
+  8022a1:	5d                   	pop    %ebp
+  8022a2:	c3                   	ret
+  8022a3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022a8:	0f a2                	cpuid
+		return 0;
+  8022aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8022af:	f6 c6 08             	test   $0x8,%dh
+  8022b2:	74 15                	je     8022c9 <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022b4:	89 c2                	mov    %eax,%edx
+  8022b6:	c1 ea 08             	shr    $0x8,%edx
+  8022b9:	83 e2 0f             	and    $0xf,%edx
+  8022bc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8022c1:	83 fa 06             	cmp    $0x6,%edx
+  8022c4:	74 0e                	je     8022d4 <sys_shm_detach+0x7b>
+  8022c6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8022c9:	0f b6 c9             	movzbl %cl,%ecx
+  8022cc:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8022d2:	eb 97                	jmp    80226b <sys_shm_detach+0x12>
+  8022d4:	89 c2                	mov    %eax,%edx
+  8022d6:	c1 ea 04             	shr    $0x4,%edx
+  8022d9:	83 e2 0f             	and    $0xf,%edx
+  8022dc:	83 fa 02             	cmp    $0x2,%edx
+  8022df:	77 e5                	ja     8022c6 <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  8022e1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022e4:	83 f8 02             	cmp    $0x2,%eax
+  8022e7:	0f 97 c1             	seta   %cl
+  8022ea:	0f b6 c9             	movzbl %cl,%ecx
+  8022ed:	eb d7                	jmp    8022c6 <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  8022ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8022f4:	b8 17 00 00 00       	mov    $0x17,%eax
+  8022f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022ff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802302:	89 f7                	mov    %esi,%edi
+  802304:	cd 30                	int    $0x30
+  802306:	eb 8f                	jmp    802297 <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802308:	83 ec 0c             	sub    $0xc,%esp
+  80230b:	50                   	push   %eax
+  80230c:	6a 17                	push   $0x17
+  80230e:	68 39 35 80 00       	push   $0x803539
+  802313:	6a 4a                	push   $0x4a
+  802315:	68 56 35 80 00       	push   $0x803556
+  80231a:	e8 78 e0 ff ff       	call   800397 <_panic>
+
+0080231f <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  80231f:	55                   	push   %ebp
+  802320:	89 e5                	mov    %esp,%ebp
+  802322:	57                   	push   %edi
+  802323:	56                   	push   %esi
+  802324:	53                   	push   %ebx
+  802325:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802328:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80232f:	78 36                	js     802367 <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  802331:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802338:	74 79                	je     8023b3 <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  80233a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80233d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802342:	b8 18 00 00 00       	mov    $0x18,%eax
+  802347:	89 cb                	mov    %ecx,%ebx
+  802349:	89 cf                	mov    %ecx,%edi
+  80234b:	89 ce                	mov    %ecx,%esi
+  80234d:	55                   	push   %ebp
+  80234e:	68 57 23 80 00       	push   $0x802357
+  802353:	89 e5                	mov    %esp,%ebp
+  802355:	0f 34                	sysenter
+  802357:	83 c4 04             	add    $0x4,%esp
+  80235a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80235b:	85 c0                	test   %eax,%eax
+  80235d:	7f 6b                	jg     8023ca <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  80235f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802362:	5b                   	pop    %ebx
+  802363:	5e                   	pop    %esi
+  802364:	5f                   	pop    %edi
+  802365:	5d                   	pop    %ebp
+  802366:	c3                   	ret
+  802367:	b8 01 00 00 00       	mov    $0x1,%eax
+  80236c:	0f a2                	cpuid
+		return 0;
+  80236e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802373:	f6 c6 08             	test   $0x8,%dh
+  802376:	74 15                	je     80238d <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802378:	89 c2                	mov    %eax,%edx
+  80237a:	c1 ea 08             	shr    $0x8,%edx
+  80237d:	83 e2 0f             	and    $0xf,%edx
+  802380:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802385:	83 fa 06             	cmp    $0x6,%edx
+  802388:	74 0e                	je     802398 <sys_shm_remove+0x79>
+  80238a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80238d:	0f b6 c9             	movzbl %cl,%ecx
+  802390:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802396:	eb 99                	jmp    802331 <sys_shm_remove+0x12>
+  802398:	89 c2                	mov    %eax,%edx
+  80239a:	c1 ea 04             	shr    $0x4,%edx
+  80239d:	83 e2 0f             	and    $0xf,%edx
+  8023a0:	83 fa 02             	cmp    $0x2,%edx
+  8023a3:	77 e5                	ja     80238a <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  8023a5:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023a8:	83 f8 02             	cmp    $0x2,%eax
+  8023ab:	0f 97 c1             	seta   %cl
+  8023ae:	0f b6 c9             	movzbl %cl,%ecx
+  8023b1:	eb d7                	jmp    80238a <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  8023b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023b8:	b8 18 00 00 00       	mov    $0x18,%eax
+  8023bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023c0:	89 cb                	mov    %ecx,%ebx
+  8023c2:	89 cf                	mov    %ecx,%edi
+  8023c4:	89 ce                	mov    %ecx,%esi
+  8023c6:	cd 30                	int    $0x30
+  8023c8:	eb 91                	jmp    80235b <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8023ca:	83 ec 0c             	sub    $0xc,%esp
+  8023cd:	50                   	push   %eax
+  8023ce:	6a 18                	push   $0x18
+  8023d0:	68 39 35 80 00       	push   $0x803539
+  8023d5:	6a 4a                	push   $0x4a
+  8023d7:	68 56 35 80 00       	push   $0x803556
+  8023dc:	e8 b6 df ff ff       	call   800397 <_panic>
+
+008023e1 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  8023e1:	55                   	push   %ebp
+  8023e2:	89 e5                	mov    %esp,%ebp
+  8023e4:	57                   	push   %edi
+  8023e5:	56                   	push   %esi
+  8023e6:	53                   	push   %ebx
+  8023e7:	83 ec 0c             	sub    $0xc,%esp
+  8023ea:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023ed:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8023f0:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  8023f3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8023fa:	78 32                	js     80242e <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  8023fc:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802403:	74 75                	je     80247a <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  802405:	8b 55 08             	mov    0x8(%ebp),%edx
+  802408:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80240b:	b8 20 00 00 00       	mov    $0x20,%eax
+  802410:	be 00 00 00 00       	mov    $0x0,%esi
+  802415:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802418:	55                   	push   %ebp
+  802419:	68 22 24 80 00       	push   $0x802422
+  80241e:	89 e5                	mov    %esp,%ebp
+  802420:	0f 34                	sysenter
+  802422:	83 c4 04             	add    $0x4,%esp
+  802425:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  802426:	83 c4 0c             	add    $0xc,%esp
+  802429:	5b                   	pop    %ebx
+  80242a:	5e                   	pop    %esi
+  80242b:	5f                   	pop    %edi
+  80242c:	5d                   	pop    %ebp
+  80242d:	c3                   	ret
+  80242e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802433:	0f a2                	cpuid
+		return 0;
+  802435:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80243a:	f6 c6 08             	test   $0x8,%dh
+  80243d:	74 15                	je     802454 <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80243f:	89 c2                	mov    %eax,%edx
+  802441:	c1 ea 08             	shr    $0x8,%edx
+  802444:	83 e2 0f             	and    $0xf,%edx
+  802447:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80244c:	83 fa 06             	cmp    $0x6,%edx
+  80244f:	74 0e                	je     80245f <sys_futex_wait+0x7e>
+  802451:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802454:	0f b6 c9             	movzbl %cl,%ecx
+  802457:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80245d:	eb 9d                	jmp    8023fc <sys_futex_wait+0x1b>
+  80245f:	89 c2                	mov    %eax,%edx
+  802461:	c1 ea 04             	shr    $0x4,%edx
+  802464:	83 e2 0f             	and    $0xf,%edx
+  802467:	83 fa 02             	cmp    $0x2,%edx
+  80246a:	77 e5                	ja     802451 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  80246c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80246f:	83 f8 02             	cmp    $0x2,%eax
+  802472:	0f 97 c1             	seta   %cl
+  802475:	0f b6 c9             	movzbl %cl,%ecx
+  802478:	eb d7                	jmp    802451 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  80247a:	b8 20 00 00 00       	mov    $0x20,%eax
+  80247f:	be 00 00 00 00       	mov    $0x0,%esi
+  802484:	8b 55 08             	mov    0x8(%ebp),%edx
+  802487:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80248a:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  80248d:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  80248f:	eb 95                	jmp    802426 <sys_futex_wait+0x45>
+
+00802491 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  802491:	55                   	push   %ebp
+  802492:	89 e5                	mov    %esp,%ebp
+  802494:	57                   	push   %edi
+  802495:	56                   	push   %esi
+  802496:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802497:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80249e:	78 30                	js     8024d0 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  8024a0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8024a7:	74 73                	je     80251c <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  8024a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024b4:	b8 21 00 00 00       	mov    $0x21,%eax
+  8024b9:	89 df                	mov    %ebx,%edi
+  8024bb:	89 de                	mov    %ebx,%esi
+  8024bd:	55                   	push   %ebp
+  8024be:	68 c7 24 80 00       	push   $0x8024c7
+  8024c3:	89 e5                	mov    %esp,%ebp
+  8024c5:	0f 34                	sysenter
+  8024c7:	83 c4 04             	add    $0x4,%esp
+  8024ca:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8024cb:	5b                   	pop    %ebx
+  8024cc:	5e                   	pop    %esi
+  8024cd:	5f                   	pop    %edi
+  8024ce:	5d                   	pop    %ebp
+  8024cf:	c3                   	ret
+  8024d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024d5:	0f a2                	cpuid
+		return 0;
+  8024d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8024dc:	f6 c6 08             	test   $0x8,%dh
+  8024df:	74 15                	je     8024f6 <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8024e1:	89 c2                	mov    %eax,%edx
+  8024e3:	c1 ea 08             	shr    $0x8,%edx
+  8024e6:	83 e2 0f             	and    $0xf,%edx
+  8024e9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8024ee:	83 fa 06             	cmp    $0x6,%edx
+  8024f1:	74 0e                	je     802501 <sys_futex_wake+0x70>
+  8024f3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8024f6:	0f b6 c9             	movzbl %cl,%ecx
+  8024f9:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8024ff:	eb 9f                	jmp    8024a0 <sys_futex_wake+0xf>
+  802501:	89 c2                	mov    %eax,%edx
+  802503:	c1 ea 04             	shr    $0x4,%edx
+  802506:	83 e2 0f             	and    $0xf,%edx
+  802509:	83 fa 02             	cmp    $0x2,%edx
+  80250c:	77 e5                	ja     8024f3 <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  80250e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802511:	83 f8 02             	cmp    $0x2,%eax
+  802514:	0f 97 c1             	seta   %cl
+  802517:	0f b6 c9             	movzbl %cl,%ecx
+  80251a:	eb d7                	jmp    8024f3 <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  80251c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802521:	b8 21 00 00 00       	mov    $0x21,%eax
+  802526:	8b 55 08             	mov    0x8(%ebp),%edx
+  802529:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80252c:	89 df                	mov    %ebx,%edi
+  80252e:	89 de                	mov    %ebx,%esi
+  802530:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  802532:	eb 97                	jmp    8024cb <sys_futex_wake+0x3a>
+
+00802534 <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  802534:	55                   	push   %ebp
+  802535:	89 e5                	mov    %esp,%ebp
+  802537:	57                   	push   %edi
+  802538:	56                   	push   %esi
+  802539:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80253a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802541:	78 2e                	js     802571 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  802543:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80254a:	74 71                	je     8025bd <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  80254c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802551:	b8 22 00 00 00       	mov    $0x22,%eax
+  802556:	89 d1                	mov    %edx,%ecx
+  802558:	89 d3                	mov    %edx,%ebx
+  80255a:	89 d7                	mov    %edx,%edi
+  80255c:	89 d6                	mov    %edx,%esi
+  80255e:	55                   	push   %ebp
+  80255f:	68 68 25 80 00       	push   $0x802568
+  802564:	89 e5                	mov    %esp,%ebp
+  802566:	0f 34                	sysenter
+  802568:	83 c4 04             	add    $0x4,%esp
+  80256b:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  80256c:	5b                   	pop    %ebx
+  80256d:	5e                   	pop    %esi
+  80256e:	5f                   	pop    %edi
+  80256f:	5d                   	pop    %ebp
+  802570:	c3                   	ret
+  802571:	b8 01 00 00 00       	mov    $0x1,%eax
+  802576:	0f a2                	cpuid
+		return 0;
+  802578:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80257d:	f6 c6 08             	test   $0x8,%dh
+  802580:	74 15                	je     802597 <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802582:	89 c2                	mov    %eax,%edx
+  802584:	c1 ea 08             	shr    $0x8,%edx
+  802587:	83 e2 0f             	and    $0xf,%edx
+  80258a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80258f:	83 fa 06             	cmp    $0x6,%edx
+  802592:	74 0e                	je     8025a2 <sys_ep_create+0x6e>
+  802594:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802597:	0f b6 c9             	movzbl %cl,%ecx
+  80259a:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8025a0:	eb a1                	jmp    802543 <sys_ep_create+0xf>
+  8025a2:	89 c2                	mov    %eax,%edx
+  8025a4:	c1 ea 04             	shr    $0x4,%edx
+  8025a7:	83 e2 0f             	and    $0xf,%edx
+  8025aa:	83 fa 02             	cmp    $0x2,%edx
+  8025ad:	77 e5                	ja     802594 <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  8025af:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025b2:	83 f8 02             	cmp    $0x2,%eax
+  8025b5:	0f 97 c1             	seta   %cl
+  8025b8:	0f b6 c9             	movzbl %cl,%ecx
+  8025bb:	eb d7                	jmp    802594 <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  8025bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025c2:	b8 22 00 00 00       	mov    $0x22,%eax
+  8025c7:	89 d1                	mov    %edx,%ecx
+  8025c9:	89 d3                	mov    %edx,%ebx
+  8025cb:	89 d7                	mov    %edx,%edi
+  8025cd:	89 d6                	mov    %edx,%esi
+  8025cf:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  8025d1:	eb 99                	jmp    80256c <sys_ep_create+0x38>
+
+008025d3 <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  8025d3:	55                   	push   %ebp
+  8025d4:	89 e5                	mov    %esp,%ebp
+  8025d6:	57                   	push   %edi
+  8025d7:	56                   	push   %esi
+  8025d8:	53                   	push   %ebx
+  8025d9:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8025dc:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8025e3:	78 36                	js     80261b <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  8025e5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8025ec:	74 79                	je     802667 <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  8025ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025f6:	b8 23 00 00 00       	mov    $0x23,%eax
+  8025fb:	89 cb                	mov    %ecx,%ebx
+  8025fd:	89 cf                	mov    %ecx,%edi
+  8025ff:	89 ce                	mov    %ecx,%esi
+  802601:	55                   	push   %ebp
+  802602:	68 0b 26 80 00       	push   $0x80260b
+  802607:	89 e5                	mov    %esp,%ebp
+  802609:	0f 34                	sysenter
+  80260b:	83 c4 04             	add    $0x4,%esp
+  80260e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80260f:	85 c0                	test   %eax,%eax
+  802611:	7f 6b                	jg     80267e <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  802613:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802616:	5b                   	pop    %ebx
+  802617:	5e                   	pop    %esi
+  802618:	5f                   	pop    %edi
+  802619:	5d                   	pop    %ebp
+  80261a:	c3                   	ret
+  80261b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802620:	0f a2                	cpuid
+		return 0;
+  802622:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802627:	f6 c6 08             	test   $0x8,%dh
+  80262a:	74 15                	je     802641 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80262c:	89 c2                	mov    %eax,%edx
+  80262e:	c1 ea 08             	shr    $0x8,%edx
+  802631:	83 e2 0f             	and    $0xf,%edx
+  802634:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802639:	83 fa 06             	cmp    $0x6,%edx
+  80263c:	74 0e                	je     80264c <sys_ep_destroy+0x79>
+  80263e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802641:	0f b6 c9             	movzbl %cl,%ecx
+  802644:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80264a:	eb 99                	jmp    8025e5 <sys_ep_destroy+0x12>
+  80264c:	89 c2                	mov    %eax,%edx
+  80264e:	c1 ea 04             	shr    $0x4,%edx
+  802651:	83 e2 0f             	and    $0xf,%edx
+  802654:	83 fa 02             	cmp    $0x2,%edx
+  802657:	77 e5                	ja     80263e <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  802659:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80265c:	83 f8 02             	cmp    $0x2,%eax
+  80265f:	0f 97 c1             	seta   %cl
+  802662:	0f b6 c9             	movzbl %cl,%ecx
+  802665:	eb d7                	jmp    80263e <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  802667:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80266c:	b8 23 00 00 00       	mov    $0x23,%eax
+  802671:	8b 55 08             	mov    0x8(%ebp),%edx
+  802674:	89 cb                	mov    %ecx,%ebx
+  802676:	89 cf                	mov    %ecx,%edi
+  802678:	89 ce                	mov    %ecx,%esi
+  80267a:	cd 30                	int    $0x30
+  80267c:	eb 91                	jmp    80260f <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80267e:	83 ec 0c             	sub    $0xc,%esp
+  802681:	50                   	push   %eax
+  802682:	6a 23                	push   $0x23
+  802684:	68 39 35 80 00       	push   $0x803539
+  802689:	6a 4a                	push   $0x4a
+  80268b:	68 56 35 80 00       	push   $0x803556
+  802690:	e8 02 dd ff ff       	call   800397 <_panic>
+
+00802695 <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  802695:	55                   	push   %ebp
+  802696:	89 e5                	mov    %esp,%ebp
+  802698:	57                   	push   %edi
+  802699:	56                   	push   %esi
+  80269a:	53                   	push   %ebx
+  80269b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80269e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8026a5:	78 37                	js     8026de <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  8026a7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8026ae:	74 7a                	je     80272a <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  8026b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8026b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026bb:	b8 24 00 00 00       	mov    $0x24,%eax
+  8026c0:	89 df                	mov    %ebx,%edi
+  8026c2:	89 de                	mov    %ebx,%esi
+  8026c4:	55                   	push   %ebp
+  8026c5:	68 ce 26 80 00       	push   $0x8026ce
+  8026ca:	89 e5                	mov    %esp,%ebp
+  8026cc:	0f 34                	sysenter
+  8026ce:	83 c4 04             	add    $0x4,%esp
+  8026d1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8026d2:	85 c0                	test   %eax,%eax
+  8026d4:	7f 6c                	jg     802742 <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  8026d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026d9:	5b                   	pop    %ebx
+  8026da:	5e                   	pop    %esi
+  8026db:	5f                   	pop    %edi
+  8026dc:	5d                   	pop    %ebp
+  8026dd:	c3                   	ret
+  8026de:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026e3:	0f a2                	cpuid
+		return 0;
+  8026e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8026ea:	f6 c6 08             	test   $0x8,%dh
+  8026ed:	74 15                	je     802704 <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8026ef:	89 c2                	mov    %eax,%edx
+  8026f1:	c1 ea 08             	shr    $0x8,%edx
+  8026f4:	83 e2 0f             	and    $0xf,%edx
+  8026f7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8026fc:	83 fa 06             	cmp    $0x6,%edx
+  8026ff:	74 0e                	je     80270f <sys_ep_grant+0x7a>
+  802701:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802704:	0f b6 c9             	movzbl %cl,%ecx
+  802707:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80270d:	eb 98                	jmp    8026a7 <sys_ep_grant+0x12>
+  80270f:	89 c2                	mov    %eax,%edx
+  802711:	c1 ea 04             	shr    $0x4,%edx
+  802714:	83 e2 0f             	and    $0xf,%edx
+  802717:	83 fa 02             	cmp    $0x2,%edx
+  80271a:	77 e5                	ja     802701 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  80271c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80271f:	83 f8 02             	cmp    $0x2,%eax
+  802722:	0f 97 c1             	seta   %cl
+  802725:	0f b6 c9             	movzbl %cl,%ecx
+  802728:	eb d7                	jmp    802701 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  80272a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80272f:	b8 24 00 00 00       	mov    $0x24,%eax
+  802734:	8b 55 08             	mov    0x8(%ebp),%edx
+  802737:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80273a:	89 df                	mov    %ebx,%edi
+  80273c:	89 de                	mov    %ebx,%esi
+  80273e:	cd 30                	int    $0x30
+  802740:	eb 90                	jmp    8026d2 <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802742:	83 ec 0c             	sub    $0xc,%esp
+  802745:	50                   	push   %eax
+  802746:	6a 24                	push   $0x24
+  802748:	68 39 35 80 00       	push   $0x803539
+  80274d:	6a 4a                	push   $0x4a
+  80274f:	68 56 35 80 00       	push   $0x803556
+  802754:	e8 3e dc ff ff       	call   800397 <_panic>
+
+00802759 <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  802759:	55                   	push   %ebp
+  80275a:	89 e5                	mov    %esp,%ebp
+  80275c:	57                   	push   %edi
+  80275d:	56                   	push   %esi
+  80275e:	53                   	push   %ebx
+  80275f:	83 ec 20             	sub    $0x20,%esp
+  802762:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  802765:	8b 10                	mov    (%eax),%edx
+  802767:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  80276a:	8b 50 04             	mov    0x4(%eax),%edx
+  80276d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802770:	8b 50 08             	mov    0x8(%eax),%edx
+  802773:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  802776:	8b 50 0c             	mov    0xc(%eax),%edx
+  802779:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  80277c:	8b 40 10             	mov    0x10(%eax),%eax
+  80277f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  802782:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  802785:	8b 55 08             	mov    0x8(%ebp),%edx
+  802788:	b8 25 00 00 00       	mov    $0x25,%eax
+  80278d:	55                   	push   %ebp
+  80278e:	56                   	push   %esi
+  80278f:	8b 0e                	mov    (%esi),%ecx
+  802791:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802794:	8b 7e 08             	mov    0x8(%esi),%edi
+  802797:	8b 6e 10             	mov    0x10(%esi),%ebp
+  80279a:	8b 76 0c             	mov    0xc(%esi),%esi
+  80279d:	cd 30                	int    $0x30
+  80279f:	87 34 24             	xchg   %esi,(%esp)
+  8027a2:	89 0e                	mov    %ecx,(%esi)
+  8027a4:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8027a7:	89 7e 08             	mov    %edi,0x8(%esi)
+  8027aa:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8027ad:	8f 46 0c             	pop    0xc(%esi)
+  8027b0:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  8027b1:	83 c4 20             	add    $0x20,%esp
+  8027b4:	5b                   	pop    %ebx
+  8027b5:	5e                   	pop    %esi
+  8027b6:	5f                   	pop    %edi
+  8027b7:	5d                   	pop    %ebp
+  8027b8:	c3                   	ret
+
+008027b9 <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  8027b9:	55                   	push   %ebp
+  8027ba:	89 e5                	mov    %esp,%ebp
+  8027bc:	57                   	push   %edi
+  8027bd:	56                   	push   %esi
+  8027be:	53                   	push   %ebx
+  8027bf:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  8027c2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8027c5:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  8027c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8027ca:	b8 26 00 00 00       	mov    $0x26,%eax
+  8027cf:	55                   	push   %ebp
+  8027d0:	56                   	push   %esi
+  8027d1:	8b 0e                	mov    (%esi),%ecx
+  8027d3:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8027d6:	8b 7e 08             	mov    0x8(%esi),%edi
+  8027d9:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8027dc:	8b 76 0c             	mov    0xc(%esi),%esi
+  8027df:	cd 30                	int    $0x30
+  8027e1:	87 34 24             	xchg   %esi,(%esp)
+  8027e4:	89 0e                	mov    %ecx,(%esi)
+  8027e6:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8027e9:	89 7e 08             	mov    %edi,0x8(%esi)
+  8027ec:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8027ef:	8f 46 0c             	pop    0xc(%esi)
+  8027f2:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  8027f3:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  8027f7:	74 0f                	je     802808 <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  8027f9:	85 c0                	test   %eax,%eax
+  8027fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802800:	0f 48 d1             	cmovs  %ecx,%edx
+  802803:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  802806:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  802808:	5b                   	pop    %ebx
+  802809:	5e                   	pop    %esi
+  80280a:	5f                   	pop    %edi
+  80280b:	5d                   	pop    %ebp
+  80280c:	c3                   	ret
+
+0080280d <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  80280d:	55                   	push   %ebp
+  80280e:	89 e5                	mov    %esp,%ebp
+  802810:	57                   	push   %edi
+  802811:	56                   	push   %esi
+  802812:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802813:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80281a:	78 2f                	js     80284b <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  80281c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802823:	74 72                	je     802897 <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  802825:	8b 55 08             	mov    0x8(%ebp),%edx
+  802828:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80282d:	b8 27 00 00 00       	mov    $0x27,%eax
+  802832:	89 cb                	mov    %ecx,%ebx
+  802834:	89 cf                	mov    %ecx,%edi
+  802836:	89 ce                	mov    %ecx,%esi
+  802838:	55                   	push   %ebp
+  802839:	68 42 28 80 00       	push   $0x802842
+  80283e:	89 e5                	mov    %esp,%ebp
+  802840:	0f 34                	sysenter
+  802842:	83 c4 04             	add    $0x4,%esp
+  802845:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  802846:	5b                   	pop    %ebx
+  802847:	5e                   	pop    %esi
+  802848:	5f                   	pop    %edi
+  802849:	5d                   	pop    %ebp
+  80284a:	c3                   	ret
+  80284b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802850:	0f a2                	cpuid
+		return 0;
+  802852:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802857:	f6 c6 08             	test   $0x8,%dh
+  80285a:	74 15                	je     802871 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80285c:	89 c2                	mov    %eax,%edx
+  80285e:	c1 ea 08             	shr    $0x8,%edx
+  802861:	83 e2 0f             	and    $0xf,%edx
+  802864:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802869:	83 fa 06             	cmp    $0x6,%edx
+  80286c:	74 0e                	je     80287c <sys_sysring_setup+0x6f>
+  80286e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802871:	0f b6 c9             	movzbl %cl,%ecx
+  802874:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80287a:	eb a0                	jmp    80281c <sys_sysring_setup+0xf>
+  80287c:	89 c2                	mov    %eax,%edx
+  80287e:	c1 ea 04             	shr    $0x4,%edx
+  802881:	83 e2 0f             	and    $0xf,%edx
+  802884:	83 fa 02             	cmp    $0x2,%edx
+  802887:	77 e5                	ja     80286e <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  802889:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80288c:	83 f8 02             	cmp    $0x2,%eax
+  80288f:	0f 97 c1             	seta   %cl
+  802892:	0f b6 c9             	movzbl %cl,%ecx
+  802895:	eb d7                	jmp    80286e <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  802897:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80289c:	b8 27 00 00 00       	mov    $0x27,%eax
+  8028a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8028a4:	89 cb                	mov    %ecx,%ebx
+  8028a6:	89 cf                	mov    %ecx,%edi
+  8028a8:	89 ce                	mov    %ecx,%esi
+  8028aa:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  8028ac:	eb 98                	jmp    802846 <sys_sysring_setup+0x39>
+
+008028ae <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  8028ae:	55                   	push   %ebp
+  8028af:	89 e5                	mov    %esp,%ebp
+  8028b1:	57                   	push   %edi
+  8028b2:	56                   	push   %esi
+  8028b3:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8028b4:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8028bb:	78 2e                	js     8028eb <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  8028bd:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8028c4:	74 71                	je     802937 <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  8028c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028cb:	b8 28 00 00 00       	mov    $0x28,%eax
+  8028d0:	89 d1                	mov    %edx,%ecx
+  8028d2:	89 d3                	mov    %edx,%ebx
+  8028d4:	89 d7                	mov    %edx,%edi
+  8028d6:	89 d6                	mov    %edx,%esi
+  8028d8:	55                   	push   %ebp
+  8028d9:	68 e2 28 80 00       	push   $0x8028e2
+  8028de:	89 e5                	mov    %esp,%ebp
+  8028e0:	0f 34                	sysenter
+  8028e2:	83 c4 04             	add    $0x4,%esp
+  8028e5:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8028e6:	5b                   	pop    %ebx
+  8028e7:	5e                   	pop    %esi
+  8028e8:	5f                   	pop    %edi
+  8028e9:	5d                   	pop    %ebp
+  8028ea:	c3                   	ret
+  8028eb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028f0:	0f a2                	cpuid
+		return 0;
+  8028f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8028f7:	f6 c6 08             	test   $0x8,%dh
+  8028fa:	74 15                	je     802911 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8028fc:	89 c2                	mov    %eax,%edx
+  8028fe:	c1 ea 08             	shr    $0x8,%edx
+  802901:	83 e2 0f             	and    $0xf,%edx
+  802904:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802909:	83 fa 06             	cmp    $0x6,%edx
+  80290c:	74 0e                	je     80291c <sys_sysring_enter+0x6e>
+  80290e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802911:	0f b6 c9             	movzbl %cl,%ecx
+  802914:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80291a:	eb a1                	jmp    8028bd <sys_sysring_enter+0xf>
+  80291c:	89 c2                	mov    %eax,%edx
+  80291e:	c1 ea 04             	shr    $0x4,%edx
+  802921:	83 e2 0f             	and    $0xf,%edx
+  802924:	83 fa 02             	cmp    $0x2,%edx
+  802927:	77 e5                	ja     80290e <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  802929:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80292c:	83 f8 02             	cmp    $0x2,%eax
+  80292f:	0f 97 c1             	seta   %cl
+  802932:	0f b6 c9             	movzbl %cl,%ecx
+  802935:	eb d7                	jmp    80290e <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  802937:	ba 00 00 00 00       	mov    $0x0,%edx
+  80293c:	b8 28 00 00 00       	mov    $0x28,%eax
+  802941:	89 d1                	mov    %edx,%ecx
+  802943:	89 d3                	mov    %edx,%ebx
+  802945:	89 d7                	mov    %edx,%edi
+  802947:	89 d6                	mov    %edx,%esi
+  802949:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  80294b:	eb 99                	jmp    8028e6 <sys_sysring_enter+0x38>
+
+0080294d <pgfault>:
+// The kernel normally resolves these faults itself (page_fault_cow in
+// kern/trap.c); we only get here if it ran out of memory doing so.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  80294d:	55                   	push   %ebp
+  80294e:	89 e5                	mov    %esp,%ebp
+  802950:	83 ec 08             	sub    $0x8,%esp
+  802953:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  802956:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  802958:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  80295b:	f6 c2 02             	test   $0x2,%dl
+  80295e:	74 40                	je     8029a0 <pgfault+0x53>
+  802960:	89 c1                	mov    %eax,%ecx
+  802962:	c1 e9 16             	shr    $0x16,%ecx
+  802965:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  80296c:	f6 c1 01             	test   $0x1,%cl
+  80296f:	74 2f                	je     8029a0 <pgfault+0x53>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW))
+  802971:	89 c1                	mov    %eax,%ecx
+  802973:	c1 e9 0c             	shr    $0xc,%ecx
+  802976:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  80297d:	f6 c5 08             	test   $0x8,%ch
+  802980:	74 1e                	je     8029a0 <pgfault+0x53>
+	// Replace the page with a private writable copy of itself.  The
+	// kernel allocates, copies and maps it in one system call, so no
+	// temporary mapping at PFTEMP is needed.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  802982:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r = sys_page_copy(0, addr, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  802987:	83 ec 0c             	sub    $0xc,%esp
+  80298a:	6a 07                	push   $0x7
+  80298c:	50                   	push   %eax
+  80298d:	6a 00                	push   $0x0
+  80298f:	50                   	push   %eax
+  802990:	6a 00                	push   $0x0
+  802992:	e8 85 eb ff ff       	call   80151c <sys_page_copy>
+  802997:	83 c4 20             	add    $0x20,%esp
+  80299a:	85 c0                	test   %eax,%eax
+  80299c:	78 18                	js     8029b6 <pgfault+0x69>
+		panic("pgfault: sys_page_copy: %e", r);
+}
+  80299e:	c9                   	leave
+  80299f:	c3                   	ret
+		panic("pgfault: va %08x err %x is not a copy-on-write write",
+  8029a0:	83 ec 0c             	sub    $0xc,%esp
+  8029a3:	52                   	push   %edx
+  8029a4:	50                   	push   %eax
+  8029a5:	68 64 35 80 00       	push   $0x803564
+  8029aa:	6a 1c                	push   $0x1c
+  8029ac:	68 99 35 80 00       	push   $0x803599
+  8029b1:	e8 e1 d9 ff ff       	call   800397 <_panic>
+		panic("pgfault: sys_page_copy: %e", r);
+  8029b6:	50                   	push   %eax
+  8029b7:	68 a4 35 80 00       	push   $0x8035a4
+  8029bc:	6a 26                	push   $0x26
+  8029be:	68 99 35 80 00       	push   $0x803599
+  8029c3:	e8 cf d9 ff ff       	call   800397 <_panic>
+
+008029c8 <ufork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+ufork(void)
+{
+  8029c8:	55                   	push   %ebp
+  8029c9:	89 e5                	mov    %esp,%ebp
+  8029cb:	57                   	push   %edi
+  8029cc:	56                   	push   %esi
+  8029cd:	53                   	push   %ebx
+  8029ce:	81 ec 38 04 00 00    	sub    $0x438,%esp
+	struct page_range vec[PAGE_VEC_MAX], *last;
+	uintptr_t va;
+	size_t n;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8029d4:	68 4d 29 80 00       	push   $0x80294d
+  8029d9:	e8 03 05 00 00       	call   802ee1 <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8029de:	b8 07 00 00 00       	mov    $0x7,%eax
+  8029e3:	cd 30                	int    $0x30
+  8029e5:	89 85 d4 fb ff ff    	mov    %eax,-0x42c(%ebp)
+
+	envid = sys_exofork();
+	if (envid < 0)
+  8029eb:	83 c4 10             	add    $0x10,%esp
+  8029ee:	85 c0                	test   %eax,%eax
+  8029f0:	0f 88 f2 01 00 00    	js     802be8 <ufork+0x220>
+		return 0;
+	}
+
+	// Copy every run of mapped pages below the exception stack, which
+	// must not be shared.
+	va = 0;
+  8029f6:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  8029fb:	74 0b                	je     802a08 <ufork+0x40>
+  8029fd:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  802a03:	e9 07 01 00 00       	jmp    802b0f <ufork+0x147>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  802a08:	e8 22 e8 ff ff       	call   80122f <sys_getenvid>
+  802a0d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802a12:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802a18:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802a1d:	a3 08 40 80 00       	mov    %eax,0x804008
+		return 0;
+  802a22:	e9 c1 01 00 00       	jmp    802be8 <ufork+0x220>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+		n = r;
+		last = &vec[n - 1];
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  802a27:	83 ea 01             	sub    $0x1,%edx
+  802a2a:	89 c1                	mov    %eax,%ecx
+  802a2c:	c1 e1 04             	shl    $0x4,%ecx
+  802a2f:	89 94 0d ec fd ff ff 	mov    %edx,-0x214(%ebp,%ecx,1)
+			n--;
+  802a36:	85 d2                	test   %edx,%edx
+  802a38:	0f 44 f0             	cmove  %eax,%esi
+  802a3b:	e9 12 01 00 00       	jmp    802b52 <ufork+0x18a>
+	for (i = 0; i < n; i++) {
+  802a40:	83 c1 01             	add    $0x1,%ecx
+  802a43:	83 c0 10             	add    $0x10,%eax
+  802a46:	39 8d e4 fb ff ff    	cmp    %ecx,-0x41c(%ebp)
+  802a4c:	74 6a                	je     802ab8 <ufork+0xf0>
+		vec[i].pr_dstva = vec[i].pr_va;
+  802a4e:	89 c3                	mov    %eax,%ebx
+  802a50:	8b 10                	mov    (%eax),%edx
+  802a52:	89 50 0c             	mov    %edx,0xc(%eax)
+		if (vec[i].pr_perm & PTE_SHARE)
+  802a55:	8b 50 08             	mov    0x8(%eax),%edx
+  802a58:	f6 c6 04             	test   $0x4,%dh
+  802a5b:	75 e3                	jne    802a40 <ufork+0x78>
+		if (vec[i].pr_perm & (PTE_W | PTE_COW)) {
+  802a5d:	f7 c2 02 08 00 00    	test   $0x802,%edx
+  802a63:	74 db                	je     802a40 <ufork+0x78>
+			vec[i].pr_perm = (vec[i].pr_perm & ~PTE_W) | PTE_COW;
+  802a65:	81 e2 fd f7 ff ff    	and    $0xfffff7fd,%edx
+  802a6b:	80 ce 08             	or     $0x8,%dh
+  802a6e:	89 95 dc fb ff ff    	mov    %edx,-0x424(%ebp)
+  802a74:	89 53 08             	mov    %edx,0x8(%ebx)
+			cow[ncow++] = vec[i];
+  802a77:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  802a7d:	c1 e6 04             	shl    $0x4,%esi
+  802a80:	89 f2                	mov    %esi,%edx
+  802a82:	8d b4 35 e8 fb ff ff 	lea    -0x418(%ebp,%esi,1),%esi
+  802a89:	8b 38                	mov    (%eax),%edi
+  802a8b:	89 bc 15 e8 fb ff ff 	mov    %edi,-0x418(%ebp,%edx,1)
+  802a92:	8b 78 04             	mov    0x4(%eax),%edi
+  802a95:	89 7e 04             	mov    %edi,0x4(%esi)
+  802a98:	8b bd dc fb ff ff    	mov    -0x424(%ebp),%edi
+  802a9e:	89 7e 08             	mov    %edi,0x8(%esi)
+  802aa1:	8b 50 0c             	mov    0xc(%eax),%edx
+  802aa4:	89 56 0c             	mov    %edx,0xc(%esi)
+  802aa7:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  802aad:	8d 7e 01             	lea    0x1(%esi),%edi
+  802ab0:	89 bd e0 fb ff ff    	mov    %edi,-0x420(%ebp)
+  802ab6:	eb 88                	jmp    802a40 <ufork+0x78>
+	if ((r = sys_page_map_vec(0, envid, vec, n, 0)) < 0)
+  802ab8:	8b b5 e4 fb ff ff    	mov    -0x41c(%ebp),%esi
+  802abe:	8b bd d8 fb ff ff    	mov    -0x428(%ebp),%edi
+  802ac4:	83 ec 0c             	sub    $0xc,%esp
+  802ac7:	6a 00                	push   $0x0
+  802ac9:	56                   	push   %esi
+  802aca:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802ad0:	50                   	push   %eax
+  802ad1:	ff b5 d4 fb ff ff    	push   -0x42c(%ebp)
+  802ad7:	6a 00                	push   $0x0
+  802ad9:	e8 80 f4 ff ff       	call   801f5e <sys_page_map_vec>
+  802ade:	83 c4 20             	add    $0x20,%esp
+  802ae1:	85 c0                	test   %eax,%eax
+  802ae3:	0f 88 e5 00 00 00    	js     802bce <ufork+0x206>
+	return sys_page_map_vec(0, 0, cow, ncow, 0);
+  802ae9:	83 ec 0c             	sub    $0xc,%esp
+  802aec:	6a 00                	push   $0x0
+  802aee:	ff b5 e0 fb ff ff    	push   -0x420(%ebp)
+  802af4:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  802afa:	50                   	push   %eax
+  802afb:	6a 00                	push   $0x0
+  802afd:	6a 00                	push   $0x0
+  802aff:	e8 5a f4 ff ff       	call   801f5e <sys_page_map_vec>
+		if ((r = duppages(envid, vec, n)) < 0)
+  802b04:	83 c4 20             	add    $0x20,%esp
+  802b07:	85 c0                	test   %eax,%eax
+  802b09:	0f 88 e7 00 00 00    	js     802bf6 <ufork+0x22e>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+  802b0f:	6a 20                	push   $0x20
+  802b11:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802b17:	50                   	push   %eax
+  802b18:	57                   	push   %edi
+  802b19:	6a 00                	push   $0x0
+  802b1b:	e8 82 f4 ff ff       	call   801fa2 <sys_vm_ranges>
+  802b20:	83 c4 10             	add    $0x10,%esp
+  802b23:	85 c0                	test   %eax,%eax
+  802b25:	7e 51                	jle    802b78 <ufork+0x1b0>
+		n = r;
+  802b27:	89 c6                	mov    %eax,%esi
+		last = &vec[n - 1];
+  802b29:	83 e8 01             	sub    $0x1,%eax
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+  802b2c:	89 c1                	mov    %eax,%ecx
+  802b2e:	c1 e1 04             	shl    $0x4,%ecx
+  802b31:	8b 94 0d ec fd ff ff 	mov    -0x214(%ebp,%ecx,1),%edx
+  802b38:	89 d3                	mov    %edx,%ebx
+  802b3a:	c1 e3 0c             	shl    $0xc,%ebx
+  802b3d:	89 df                	mov    %ebx,%edi
+  802b3f:	03 bc 0d e8 fd ff ff 	add    -0x218(%ebp,%ecx,1),%edi
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  802b46:	81 ff 00 00 c0 ee    	cmp    $0xeec00000,%edi
+  802b4c:	0f 84 d5 fe ff ff    	je     802a27 <ufork+0x5f>
+	for (i = 0; i < n; i++) {
+  802b52:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+	size_t i, ncow = 0;
+  802b58:	c7 85 e0 fb ff ff 00 	movl   $0x0,-0x420(%ebp)
+  802b5f:	00 00 00 
+	for (i = 0; i < n; i++) {
+  802b62:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b67:	89 bd d8 fb ff ff    	mov    %edi,-0x428(%ebp)
+  802b6d:	89 b5 e4 fb ff ff    	mov    %esi,-0x41c(%ebp)
+  802b73:	e9 ce fe ff ff       	jmp    802a46 <ufork+0x7e>
+			goto fail;
+	}
+	if (r < 0)
+  802b78:	89 c6                	mov    %eax,%esi
+  802b7a:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  802b80:	85 c0                	test   %eax,%eax
+  802b82:	78 52                	js     802bd6 <ufork+0x20e>
+		goto fail;
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE),
+  802b84:	83 ec 04             	sub    $0x4,%esp
+  802b87:	6a 07                	push   $0x7
+  802b89:	68 00 f0 bf ee       	push   $0xeebff000
+  802b8e:	53                   	push   %ebx
+  802b8f:	e8 3a e7 ff ff       	call   8012ce <sys_page_alloc>
+  802b94:	89 c6                	mov    %eax,%esi
+  802b96:	83 c4 10             	add    $0x10,%esp
+  802b99:	85 c0                	test   %eax,%eax
+  802b9b:	78 39                	js     802bd6 <ufork+0x20e>
+				PTE_P | PTE_U | PTE_W)) < 0
+	    || (r = sys_env_set_pgfault_upcall(envid,
+			thisenv->env_pgfault_upcall)) < 0
+  802b9d:	a1 08 40 80 00       	mov    0x804008,%eax
+  802ba2:	8b 40 74             	mov    0x74(%eax),%eax
+	    || (r = sys_env_set_pgfault_upcall(envid,
+  802ba5:	83 ec 08             	sub    $0x8,%esp
+  802ba8:	50                   	push   %eax
+  802ba9:	53                   	push   %ebx
+  802baa:	e8 de ed ff ff       	call   80198d <sys_env_set_pgfault_upcall>
+  802baf:	89 c6                	mov    %eax,%esi
+  802bb1:	83 c4 10             	add    $0x10,%esp
+  802bb4:	85 c0                	test   %eax,%eax
+  802bb6:	78 1e                	js     802bd6 <ufork+0x20e>
+	    || (r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  802bb8:	83 ec 08             	sub    $0x8,%esp
+  802bbb:	6a 02                	push   $0x2
+  802bbd:	53                   	push   %ebx
+  802bbe:	e8 bc ea ff ff       	call   80167f <sys_env_set_status>
+  802bc3:	89 c6                	mov    %eax,%esi
+  802bc5:	83 c4 10             	add    $0x10,%esp
+  802bc8:	85 c0                	test   %eax,%eax
+  802bca:	79 1c                	jns    802be8 <ufork+0x220>
+  802bcc:	eb 08                	jmp    802bd6 <ufork+0x20e>
+  802bce:	89 c6                	mov    %eax,%esi
+  802bd0:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+		goto fail;
+	return envid;
+
+fail:
+	sys_env_destroy(envid);
+  802bd6:	83 ec 0c             	sub    $0xc,%esp
+  802bd9:	53                   	push   %ebx
+  802bda:	e8 8e e5 ff ff       	call   80116d <sys_env_destroy>
+	return r;
+  802bdf:	83 c4 10             	add    $0x10,%esp
+  802be2:	89 b5 d4 fb ff ff    	mov    %esi,-0x42c(%ebp)
+}
+  802be8:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+  802bee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bf1:	5b                   	pop    %ebx
+  802bf2:	5e                   	pop    %esi
+  802bf3:	5f                   	pop    %edi
+  802bf4:	5d                   	pop    %ebp
+  802bf5:	c3                   	ret
+  802bf6:	89 c6                	mov    %eax,%esi
+  802bf8:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  802bfe:	eb d6                	jmp    802bd6 <ufork+0x20e>
+
+00802c00 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  802c00:	55                   	push   %ebp
+  802c01:	89 e5                	mov    %esp,%ebp
+  802c03:	53                   	push   %ebx
+  802c04:	83 ec 04             	sub    $0x4,%esp
+	envid_t envid;
+
+	envid = sys_fork();
+  802c07:	e8 90 f2 ff ff       	call   801e9c <sys_fork>
+  802c0c:	89 c3                	mov    %eax,%ebx
+	if (envid == 0)
+  802c0e:	85 c0                	test   %eax,%eax
+  802c10:	74 07                	je     802c19 <fork+0x19>
+		thisenv = &envs[ENVX(sys_getenvid())];
+	return envid;
+}
+  802c12:	89 d8                	mov    %ebx,%eax
+  802c14:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c17:	c9                   	leave
+  802c18:	c3                   	ret
+		thisenv = &envs[ENVX(sys_getenvid())];
+  802c19:	e8 11 e6 ff ff       	call   80122f <sys_getenvid>
+  802c1e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802c23:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802c29:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802c2e:	a3 08 40 80 00       	mov    %eax,0x804008
+	return envid;
+  802c33:	eb dd                	jmp    802c12 <fork+0x12>
+
+00802c35 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  802c35:	55                   	push   %ebp
+  802c36:	89 e5                	mov    %esp,%ebp
+  802c38:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  802c3b:	68 bf 35 80 00       	push   $0x8035bf
+  802c40:	68 a1 00 00 00       	push   $0xa1
+  802c45:	68 99 35 80 00       	push   $0x803599
+  802c4a:	e8 48 d7 ff ff       	call   800397 <_panic>
+
+00802c4f <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802c4f:	55                   	push   %ebp
+  802c50:	89 e5                	mov    %esp,%ebp
+  802c52:	56                   	push   %esi
+  802c53:	53                   	push   %ebx
+  802c54:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c57:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c5a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if ((r = sys_ipc_recv(pg ? pg : (void *) UTOP)) < 0) {
+  802c5d:	85 c0                	test   %eax,%eax
+  802c5f:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802c64:	0f 44 c2             	cmove  %edx,%eax
+  802c67:	83 ec 0c             	sub    $0xc,%esp
+  802c6a:	50                   	push   %eax
+  802c6b:	e8 2f ef ff ff       	call   801b9f <sys_ipc_recv>
+  802c70:	83 c4 10             	add    $0x10,%esp
+  802c73:	85 c0                	test   %eax,%eax
+  802c75:	78 34                	js     802cab <ipc_recv+0x5c>
+			*from_env_store = 0;
+		if (perm_store)
+			*perm_store = 0;
+		return r;
+	}
+	if (from_env_store)
+  802c77:	85 f6                	test   %esi,%esi
+  802c79:	74 0d                	je     802c88 <ipc_recv+0x39>
+		*from_env_store = thisenv->env_ipc_from;
+  802c7b:	a1 08 40 80 00       	mov    0x804008,%eax
+  802c80:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  802c86:	89 06                	mov    %eax,(%esi)
+	if (perm_store)
+  802c88:	85 db                	test   %ebx,%ebx
+  802c8a:	74 0d                	je     802c99 <ipc_recv+0x4a>
+		*perm_store = thisenv->env_ipc_perm;
+  802c8c:	a1 08 40 80 00       	mov    0x804008,%eax
+  802c91:	8b 80 9c 00 00 00    	mov    0x9c(%eax),%eax
+  802c97:	89 03                	mov    %eax,(%ebx)
+	return thisenv->env_ipc_msg.m_w[0];
+  802c99:	a1 08 40 80 00       	mov    0x804008,%eax
+  802c9e:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802ca4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ca7:	5b                   	pop    %ebx
+  802ca8:	5e                   	pop    %esi
+  802ca9:	5d                   	pop    %ebp
+  802caa:	c3                   	ret
+		if (from_env_store)
+  802cab:	85 f6                	test   %esi,%esi
+  802cad:	74 06                	je     802cb5 <ipc_recv+0x66>
+			*from_env_store = 0;
+  802caf:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802cb5:	85 db                	test   %ebx,%ebx
+  802cb7:	74 eb                	je     802ca4 <ipc_recv+0x55>
+			*perm_store = 0;
+  802cb9:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802cbf:	eb e3                	jmp    802ca4 <ipc_recv+0x55>
+
+00802cc1 <ipc_send>:
+//
+// The kernel queues us behind any other senders until 'toenv'
+// receives, so we only come back to retry if its queue was full.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802cc1:	55                   	push   %ebp
+  802cc2:	89 e5                	mov    %esp,%ebp
+  802cc4:	57                   	push   %edi
+  802cc5:	56                   	push   %esi
+  802cc6:	53                   	push   %ebx
+  802cc7:	83 ec 0c             	sub    $0xc,%esp
+  802cca:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802ccd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802cd0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_send(to_env, val, pg ? pg : (void *) UTOP, perm))
+  802cd3:	85 db                	test   %ebx,%ebx
+  802cd5:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802cda:	0f 44 d8             	cmove  %eax,%ebx
+  802cdd:	eb 05                	jmp    802ce4 <ipc_send+0x23>
+	       == -E_AGAIN)
+		sys_yield();
+  802cdf:	e8 fc e8 ff ff       	call   8015e0 <sys_yield>
+	while ((r = sys_ipc_send(to_env, val, pg ? pg : (void *) UTOP, perm))
+  802ce4:	ff 75 14             	push   0x14(%ebp)
+  802ce7:	53                   	push   %ebx
+  802ce8:	56                   	push   %esi
+  802ce9:	57                   	push   %edi
+  802cea:	e8 09 ee ff ff       	call   801af8 <sys_ipc_send>
+	       == -E_AGAIN)
+  802cef:	83 c4 10             	add    $0x10,%esp
+  802cf2:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802cf5:	74 e8                	je     802cdf <ipc_send+0x1e>
+	if (r < 0)
+  802cf7:	85 c0                	test   %eax,%eax
+  802cf9:	78 08                	js     802d03 <ipc_send+0x42>
+		panic("ipc_send: %e", r);
+}
+  802cfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cfe:	5b                   	pop    %ebx
+  802cff:	5e                   	pop    %esi
+  802d00:	5f                   	pop    %edi
+  802d01:	5d                   	pop    %ebp
+  802d02:	c3                   	ret
+		panic("ipc_send: %e", r);
+  802d03:	50                   	push   %eax
+  802d04:	68 d5 35 80 00       	push   $0x8035d5
+  802d09:	6a 3a                	push   $0x3a
+  802d0b:	68 e2 35 80 00       	push   $0x8035e2
+  802d10:	e8 82 d6 ff ff       	call   800397 <_panic>
+
+00802d15 <ipc_send_range>:
+
+// Like ipc_send, but send the 'npages' contiguous pages at 'pg' in one
+// message.  The receiver maps as many as fit in its window.
+void
+ipc_send_range(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  802d15:	55                   	push   %ebp
+  802d16:	89 e5                	mov    %esp,%ebp
+  802d18:	57                   	push   %edi
+  802d19:	56                   	push   %esi
+  802d1a:	53                   	push   %ebx
+  802d1b:	83 ec 0c             	sub    $0xc,%esp
+  802d1e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d21:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802d24:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_send_range(to_env, val, pg, npages, perm))
+  802d27:	eb 05                	jmp    802d2e <ipc_send_range+0x19>
+	       == -E_AGAIN)
+		sys_yield();
+  802d29:	e8 b2 e8 ff ff       	call   8015e0 <sys_yield>
+	while ((r = sys_ipc_send_range(to_env, val, pg, npages, perm))
+  802d2e:	83 ec 0c             	sub    $0xc,%esp
+  802d31:	ff 75 18             	push   0x18(%ebp)
+  802d34:	ff 75 14             	push   0x14(%ebp)
+  802d37:	53                   	push   %ebx
+  802d38:	56                   	push   %esi
+  802d39:	57                   	push   %edi
+  802d3a:	e8 22 ef ff ff       	call   801c61 <sys_ipc_send_range>
+	       == -E_AGAIN)
+  802d3f:	83 c4 20             	add    $0x20,%esp
+  802d42:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802d45:	74 e2                	je     802d29 <ipc_send_range+0x14>
+	if (r < 0)
+  802d47:	85 c0                	test   %eax,%eax
+  802d49:	78 08                	js     802d53 <ipc_send_range+0x3e>
+		panic("ipc_send_range: %e", r);
+}
+  802d4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d4e:	5b                   	pop    %ebx
+  802d4f:	5e                   	pop    %esi
+  802d50:	5f                   	pop    %edi
+  802d51:	5d                   	pop    %ebp
+  802d52:	c3                   	ret
+		panic("ipc_send_range: %e", r);
+  802d53:	50                   	push   %eax
+  802d54:	68 ec 35 80 00       	push   $0x8035ec
+  802d59:	6a 48                	push   $0x48
+  802d5b:	68 e2 35 80 00       	push   $0x8035e2
+  802d60:	e8 32 d6 ff ff       	call   800397 <_panic>
+
+00802d65 <ipc_recv_range>:
+// (which must not be null).  On return *npages holds the number of
+// pages received, which is 0 on error or if the sender sent none.
+int32_t
+ipc_recv_range(envid_t *from_env_store, void *pg, size_t *npages,
+	       int *perm_store)
+{
+  802d65:	55                   	push   %ebp
+  802d66:	89 e5                	mov    %esp,%ebp
+  802d68:	57                   	push   %edi
+  802d69:	56                   	push   %esi
+  802d6a:	53                   	push   %ebx
+  802d6b:	83 ec 14             	sub    $0x14,%esp
+  802d6e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d71:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d74:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if ((r = sys_ipc_recv_range(pg, *npages)) < 0) {
+  802d77:	ff 33                	push   (%ebx)
+  802d79:	ff 75 0c             	push   0xc(%ebp)
+  802d7c:	e8 83 ef ff ff       	call   801d04 <sys_ipc_recv_range>
+  802d81:	83 c4 10             	add    $0x10,%esp
+  802d84:	85 c0                	test   %eax,%eax
+  802d86:	78 42                	js     802dca <ipc_recv_range+0x65>
+		if (perm_store)
+			*perm_store = 0;
+		*npages = 0;
+		return r;
+	}
+	if (from_env_store)
+  802d88:	85 ff                	test   %edi,%edi
+  802d8a:	74 0d                	je     802d99 <ipc_recv_range+0x34>
+		*from_env_store = thisenv->env_ipc_from;
+  802d8c:	a1 08 40 80 00       	mov    0x804008,%eax
+  802d91:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  802d97:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  802d99:	85 f6                	test   %esi,%esi
+  802d9b:	74 0d                	je     802daa <ipc_recv_range+0x45>
+		*perm_store = thisenv->env_ipc_perm;
+  802d9d:	a1 08 40 80 00       	mov    0x804008,%eax
+  802da2:	8b 80 9c 00 00 00    	mov    0x9c(%eax),%eax
+  802da8:	89 06                	mov    %eax,(%esi)
+	*npages = thisenv->env_ipc_npages;
+  802daa:	a1 08 40 80 00       	mov    0x804008,%eax
+  802daf:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802db5:	89 03                	mov    %eax,(%ebx)
+	return thisenv->env_ipc_msg.m_w[0];
+  802db7:	a1 08 40 80 00       	mov    0x804008,%eax
+  802dbc:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802dc2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802dc5:	5b                   	pop    %ebx
+  802dc6:	5e                   	pop    %esi
+  802dc7:	5f                   	pop    %edi
+  802dc8:	5d                   	pop    %ebp
+  802dc9:	c3                   	ret
+		if (from_env_store)
+  802dca:	85 ff                	test   %edi,%edi
+  802dcc:	74 06                	je     802dd4 <ipc_recv_range+0x6f>
+			*from_env_store = 0;
+  802dce:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  802dd4:	85 f6                	test   %esi,%esi
+  802dd6:	74 06                	je     802dde <ipc_recv_range+0x79>
+			*perm_store = 0;
+  802dd8:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		*npages = 0;
+  802dde:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		return r;
+  802de4:	eb dc                	jmp    802dc2 <ipc_recv_range+0x5d>
+
+00802de6 <ipc_send_msg>:
+// Send the IPC_MSG_WORDS words of 'msg' to 'to_env', in registers and
+// without a page.  Waits like ipc_send until 'to_env' takes them, and
+// panics on any error other than -E_AGAIN.
+void
+ipc_send_msg(envid_t to_env, const struct ipc_msg *msg)
+{
+  802de6:	55                   	push   %ebp
+  802de7:	89 e5                	mov    %esp,%ebp
+  802de9:	56                   	push   %esi
+  802dea:	53                   	push   %ebx
+  802deb:	8b 75 08             	mov    0x8(%ebp),%esi
+  802dee:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_send_msg(to_env, msg)) == -E_AGAIN)
+  802df1:	eb 05                	jmp    802df8 <ipc_send_msg+0x12>
+		sys_yield();
+  802df3:	e8 e8 e7 ff ff       	call   8015e0 <sys_yield>
+	while ((r = sys_ipc_send_msg(to_env, msg)) == -E_AGAIN)
+  802df8:	83 ec 08             	sub    $0x8,%esp
+  802dfb:	53                   	push   %ebx
+  802dfc:	56                   	push   %esi
+  802dfd:	e8 3a f0 ff ff       	call   801e3c <sys_ipc_send_msg>
+  802e02:	83 c4 10             	add    $0x10,%esp
+  802e05:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802e08:	74 e9                	je     802df3 <ipc_send_msg+0xd>
+	if (r < 0)
+  802e0a:	85 c0                	test   %eax,%eax
+  802e0c:	78 07                	js     802e15 <ipc_send_msg+0x2f>
+		panic("ipc_send_msg: %e", r);
+}
+  802e0e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e11:	5b                   	pop    %ebx
+  802e12:	5e                   	pop    %esi
+  802e13:	5d                   	pop    %ebp
+  802e14:	c3                   	ret
+		panic("ipc_send_msg: %e", r);
+  802e15:	50                   	push   %eax
+  802e16:	68 ff 35 80 00       	push   $0x8035ff
+  802e1b:	6a 6f                	push   $0x6f
+  802e1d:	68 e2 35 80 00       	push   $0x8035e2
+  802e22:	e8 70 d5 ff ff       	call   800397 <_panic>
+
+00802e27 <ipc_recv_msg>:
+// ipc_call or plain ipc_send (whose value is word 0, and whose page is
+// not taken), it arrives in registers and needs no page.
+// Returns the sender's envid, < 0 on error.
+envid_t
+ipc_recv_msg(struct ipc_msg *msg)
+{
+  802e27:	55                   	push   %ebp
+  802e28:	89 e5                	mov    %esp,%ebp
+  802e2a:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_reply_wait(0, msg);
+  802e2d:	ff 75 08             	push   0x8(%ebp)
+  802e30:	6a 00                	push   $0x0
+  802e32:	e8 cb ef ff ff       	call   801e02 <sys_ipc_reply_wait>
+}
+  802e37:	c9                   	leave
+  802e38:	c3                   	ret
+
+00802e39 <ipc_call>:
+// ipc_reply_wait (or ipc_recv), and straight back when it replies.
+// Retries while to_env's queue is full.
+// Returns 0 on success, < 0 on error.
+int
+ipc_call(envid_t to_env, struct ipc_msg *msg)
+{
+  802e39:	55                   	push   %ebp
+  802e3a:	89 e5                	mov    %esp,%ebp
+  802e3c:	56                   	push   %esi
+  802e3d:	53                   	push   %ebx
+  802e3e:	8b 75 08             	mov    0x8(%ebp),%esi
+  802e41:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_call(to_env, msg)) == -E_AGAIN)
+  802e44:	eb 05                	jmp    802e4b <ipc_call+0x12>
+		sys_yield();
+  802e46:	e8 95 e7 ff ff       	call   8015e0 <sys_yield>
+	while ((r = sys_ipc_call(to_env, msg)) == -E_AGAIN)
+  802e4b:	83 ec 08             	sub    $0x8,%esp
+  802e4e:	53                   	push   %ebx
+  802e4f:	56                   	push   %esi
+  802e50:	e8 73 ef ff ff       	call   801dc8 <sys_ipc_call>
+  802e55:	83 c4 10             	add    $0x10,%esp
+  802e58:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802e5b:	74 e9                	je     802e46 <ipc_call+0xd>
+	return r;
+}
+  802e5d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e60:	5b                   	pop    %ebx
+  802e61:	5e                   	pop    %esi
+  802e62:	5d                   	pop    %ebp
+  802e63:	c3                   	ret
+
+00802e64 <ipc_reply_wait>:
+//	}
+//
+// Returns the envid of the sender, < 0 on error.
+envid_t
+ipc_reply_wait(envid_t to_env, struct ipc_msg *msg)
+{
+  802e64:	55                   	push   %ebp
+  802e65:	89 e5                	mov    %esp,%ebp
+  802e67:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_reply_wait(to_env, msg);
+  802e6a:	ff 75 0c             	push   0xc(%ebp)
+  802e6d:	ff 75 08             	push   0x8(%ebp)
+  802e70:	e8 8d ef ff ff       	call   801e02 <sys_ipc_reply_wait>
+}
+  802e75:	c9                   	leave
+  802e76:	c3                   	ret
+
+00802e77 <ep_send>:
+
+// Send 'msg' to endpoint 'epid', waiting while its queue is full.
+// Returns 0 on success, < 0 if the endpoint is gone or not ours to use.
+int
+ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  802e77:	55                   	push   %ebp
+  802e78:	89 e5                	mov    %esp,%ebp
+  802e7a:	56                   	push   %esi
+  802e7b:	53                   	push   %ebx
+  802e7c:	8b 75 08             	mov    0x8(%ebp),%esi
+  802e7f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ep_send(epid, msg)) == -E_AGAIN)
+  802e82:	eb 05                	jmp    802e89 <ep_send+0x12>
+		sys_yield();
+  802e84:	e8 57 e7 ff ff       	call   8015e0 <sys_yield>
+	while ((r = sys_ep_send(epid, msg)) == -E_AGAIN)
+  802e89:	83 ec 08             	sub    $0x8,%esp
+  802e8c:	53                   	push   %ebx
+  802e8d:	56                   	push   %esi
+  802e8e:	e8 c6 f8 ff ff       	call   802759 <sys_ep_send>
+  802e93:	83 c4 10             	add    $0x10,%esp
+  802e96:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802e99:	74 e9                	je     802e84 <ep_send+0xd>
+	return r;
+}
+  802e9b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e9e:	5b                   	pop    %ebx
+  802e9f:	5e                   	pop    %esi
+  802ea0:	5d                   	pop    %ebp
+  802ea1:	c3                   	ret
+
+00802ea2 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802ea2:	55                   	push   %ebp
+  802ea3:	89 e5                	mov    %esp,%ebp
+  802ea5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802ea8:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802ead:	69 d0 68 01 00 00    	imul   $0x168,%eax,%edx
+  802eb3:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802eb9:	8b 52 50             	mov    0x50(%edx),%edx
+  802ebc:	39 ca                	cmp    %ecx,%edx
+  802ebe:	74 11                	je     802ed1 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802ec0:	83 c0 01             	add    $0x1,%eax
+  802ec3:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802ec8:	75 e3                	jne    802ead <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802eca:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ecf:	eb 0e                	jmp    802edf <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802ed1:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802ed7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802edc:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802edf:	5d                   	pop    %ebp
+  802ee0:	c3                   	ret
+
+00802ee1 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802ee1:	55                   	push   %ebp
+  802ee2:	89 e5                	mov    %esp,%ebp
+  802ee4:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  802ee7:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  802eee:	74 0a                	je     802efa <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  802ef0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ef3:	a3 0c 40 80 00       	mov    %eax,0x80400c
+}
+  802ef8:	c9                   	leave
+  802ef9:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE),
+  802efa:	83 ec 04             	sub    $0x4,%esp
+  802efd:	6a 07                	push   $0x7
+  802eff:	68 00 f0 bf ee       	push   $0xeebff000
+  802f04:	6a 00                	push   $0x0
+  802f06:	e8 c3 e3 ff ff       	call   8012ce <sys_page_alloc>
+  802f0b:	83 c4 10             	add    $0x10,%esp
+  802f0e:	85 c0                	test   %eax,%eax
+  802f10:	78 28                	js     802f3a <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  802f12:	83 ec 08             	sub    $0x8,%esp
+  802f15:	68 4c 2f 80 00       	push   $0x802f4c
+  802f1a:	6a 00                	push   $0x0
+  802f1c:	e8 6c ea ff ff       	call   80198d <sys_env_set_pgfault_upcall>
+  802f21:	83 c4 10             	add    $0x10,%esp
+  802f24:	85 c0                	test   %eax,%eax
+  802f26:	79 c8                	jns    802ef0 <set_pgfault_handler+0xf>
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+  802f28:	50                   	push   %eax
+  802f29:	68 38 36 80 00       	push   $0x803638
+  802f2e:	6a 24                	push   $0x24
+  802f30:	68 6c 36 80 00       	push   $0x80366c
+  802f35:	e8 5d d4 ff ff       	call   800397 <_panic>
+			panic("set_pgfault_handler: sys_page_alloc: %e", r);
+  802f3a:	50                   	push   %eax
+  802f3b:	68 10 36 80 00       	push   $0x803610
+  802f40:	6a 22                	push   $0x22
+  802f42:	68 6c 36 80 00       	push   $0x80366c
+  802f47:	e8 4b d4 ff ff       	call   800397 <_panic>
+
+00802f4c <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802f4c:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802f4d:	a1 0c 40 80 00       	mov    0x80400c,%eax
+	call *%eax
+  802f52:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802f54:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 0x28(%esp), %ebx		// trap-time eip
+  802f57:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl 0x30(%esp), %eax		// trap-time esp
+  802f5b:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  802f5f:	83 e8 04             	sub    $0x4,%eax
+	movl %ebx, (%eax)
+  802f62:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 0x30(%esp)
+  802f64:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp			// skip fault_va and err
+  802f68:	83 c4 08             	add    $0x8,%esp
+	popal
+  802f6b:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp			// skip eip
+  802f6c:	83 c4 04             	add    $0x4,%esp
+	popfl
+  802f6f:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802f70:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802f71:	c3                   	ret
+
+00802f72 <dm>:
+  802f72:	55                   	push   %ebp
+  802f73:	57                   	push   %edi
+  802f74:	56                   	push   %esi
+  802f75:	53                   	push   %ebx
+  802f76:	83 ec 24             	sub    $0x24,%esp
+  802f79:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802f7d:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802f81:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802f85:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802f89:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802f8d:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802f91:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802f95:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f9f:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802fa4:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802fab:	00 
+  802fac:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802fb3:	00 
+  802fb4:	89 fb                	mov    %edi,%ebx
+  802fb6:	eb 08                	jmp    802fc0 <dm+0x4e>
+  802fb8:	83 e9 01             	sub    $0x1,%ecx
+  802fbb:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802fbe:	74 68                	je     803028 <dm+0xb6>
+  802fc0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802fc4:	01 c0                	add    %eax,%eax
+  802fc6:	89 c6                	mov    %eax,%esi
+  802fc8:	89 d7                	mov    %edx,%edi
+  802fca:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802fce:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802fd2:	0f ad d0             	shrd   %cl,%edx,%eax
+  802fd5:	d3 ea                	shr    %cl,%edx
+  802fd7:	f6 c1 20             	test   $0x20,%cl
+  802fda:	74 04                	je     802fe0 <dm+0x6e>
+  802fdc:	89 d0                	mov    %edx,%eax
+  802fde:	31 d2                	xor    %edx,%edx
+  802fe0:	83 e0 01             	and    $0x1,%eax
+  802fe3:	89 04 24             	mov    %eax,(%esp)
+  802fe6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802fed:	00 
+  802fee:	8b 04 24             	mov    (%esp),%eax
+  802ff1:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802ff5:	09 f0                	or     %esi,%eax
+  802ff7:	09 fa                	or     %edi,%edx
+  802ff9:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802ffd:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803001:	39 f0                	cmp    %esi,%eax
+  803003:	89 d5                	mov    %edx,%ebp
+  803005:	19 fd                	sbb    %edi,%ebp
+  803007:	72 af                	jb     802fb8 <dm+0x46>
+  803009:	29 f0                	sub    %esi,%eax
+  80300b:	19 fa                	sbb    %edi,%edx
+  80300d:	89 cf                	mov    %ecx,%edi
+  80300f:	c1 ef 05             	shr    $0x5,%edi
+  803012:	83 e7 01             	and    $0x1,%edi
+  803015:	89 fe                	mov    %edi,%esi
+  803017:	83 f6 01             	xor    $0x1,%esi
+  80301a:	d3 e6                	shl    %cl,%esi
+  80301c:	d3 e7                	shl    %cl,%edi
+  80301e:	09 74 24 18          	or     %esi,0x18(%esp)
+  803022:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803026:	eb 90                	jmp    802fb8 <dm+0x46>
+  803028:	85 db                	test   %ebx,%ebx
+  80302a:	74 05                	je     803031 <dm+0xbf>
+  80302c:	89 03                	mov    %eax,(%ebx)
+  80302e:	89 53 04             	mov    %edx,0x4(%ebx)
+  803031:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803035:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803039:	83 c4 24             	add    $0x24,%esp
+  80303c:	5b                   	pop    %ebx
+  80303d:	5e                   	pop    %esi
+  80303e:	5f                   	pop    %edi
+  80303f:	5d                   	pop    %ebp
+  803040:	c3                   	ret
+
+00803041 <__udivdi3>:
+  803041:	83 ec 08             	sub    $0x8,%esp
+  803044:	6a 00                	push   $0x0
+  803046:	ff 74 24 1c          	push   0x1c(%esp)
+  80304a:	ff 74 24 1c          	push   0x1c(%esp)
+  80304e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803052:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803056:	e8 17 ff ff ff       	call   802f72 <dm>
+  80305b:	83 c4 14             	add    $0x14,%esp
+  80305e:	c3                   	ret
+
+0080305f <__umoddi3>:
+  80305f:	83 ec 18             	sub    $0x18,%esp
+  803062:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803066:	50                   	push   %eax
+  803067:	ff 74 24 2c          	push   0x2c(%esp)
+  80306b:	ff 74 24 2c          	push   0x2c(%esp)
+  80306f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803073:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803077:	e8 f6 fe ff ff       	call   802f72 <dm>
+  80307c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803080:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803084:	83 c4 24             	add    $0x24,%esp
+  803087:	c3                   	ret
+
+00803088 <__divdi3>:
+  803088:	53                   	push   %ebx
+  803089:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80308d:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803091:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803095:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803099:	85 d2                	test   %edx,%edx
+  80309b:	78 15                	js     8030b2 <__divdi3+0x2a>
+  80309d:	85 db                	test   %ebx,%ebx
+  80309f:	78 34                	js     8030d5 <__divdi3+0x4d>
+  8030a1:	83 ec 04             	sub    $0x4,%esp
+  8030a4:	6a 00                	push   $0x0
+  8030a6:	53                   	push   %ebx
+  8030a7:	51                   	push   %ecx
+  8030a8:	e8 c5 fe ff ff       	call   802f72 <dm>
+  8030ad:	83 c4 10             	add    $0x10,%esp
+  8030b0:	eb 21                	jmp    8030d3 <__divdi3+0x4b>
+  8030b2:	f7 d8                	neg    %eax
+  8030b4:	83 d2 00             	adc    $0x0,%edx
+  8030b7:	f7 da                	neg    %edx
+  8030b9:	85 db                	test   %ebx,%ebx
+  8030bb:	78 30                	js     8030ed <__divdi3+0x65>
+  8030bd:	83 ec 04             	sub    $0x4,%esp
+  8030c0:	6a 00                	push   $0x0
+  8030c2:	53                   	push   %ebx
+  8030c3:	51                   	push   %ecx
+  8030c4:	e8 a9 fe ff ff       	call   802f72 <dm>
+  8030c9:	83 c4 10             	add    $0x10,%esp
+  8030cc:	f7 d8                	neg    %eax
+  8030ce:	83 d2 00             	adc    $0x0,%edx
+  8030d1:	f7 da                	neg    %edx
+  8030d3:	5b                   	pop    %ebx
+  8030d4:	c3                   	ret
+  8030d5:	83 ec 04             	sub    $0x4,%esp
+  8030d8:	6a 00                	push   $0x0
+  8030da:	f7 d9                	neg    %ecx
+  8030dc:	83 d3 00             	adc    $0x0,%ebx
+  8030df:	f7 db                	neg    %ebx
+  8030e1:	53                   	push   %ebx
+  8030e2:	51                   	push   %ecx
+  8030e3:	e8 8a fe ff ff       	call   802f72 <dm>
+  8030e8:	83 c4 10             	add    $0x10,%esp
+  8030eb:	eb df                	jmp    8030cc <__divdi3+0x44>
+  8030ed:	83 ec 04             	sub    $0x4,%esp
+  8030f0:	6a 00                	push   $0x0
+  8030f2:	f7 d9                	neg    %ecx
+  8030f4:	83 d3 00             	adc    $0x0,%ebx
+  8030f7:	f7 db                	neg    %ebx
+  8030f9:	53                   	push   %ebx
+  8030fa:	51                   	push   %ecx
+  8030fb:	e8 72 fe ff ff       	call   802f72 <dm>
+  803100:	83 c4 10             	add    $0x10,%esp
+  803103:	eb ce                	jmp    8030d3 <__divdi3+0x4b>
+
+00803105 <__moddi3>:
+  803105:	55                   	push   %ebp
+  803106:	57                   	push   %edi
+  803107:	56                   	push   %esi
+  803108:	53                   	push   %ebx
+  803109:	83 ec 18             	sub    $0x18,%esp
+  80310c:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  803110:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  803114:	89 f1                	mov    %esi,%ecx
+  803116:	f7 d9                	neg    %ecx
+  803118:	89 da                	mov    %ebx,%edx
+  80311a:	83 d2 00             	adc    $0x0,%edx
+  80311d:	f7 da                	neg    %edx
+  80311f:	0f 48 ce             	cmovs  %esi,%ecx
+  803122:	0f 48 d3             	cmovs  %ebx,%edx
+  803125:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803129:	50                   	push   %eax
+  80312a:	8b 74 24 38          	mov    0x38(%esp),%esi
+  80312e:	f7 de                	neg    %esi
+  803130:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  803134:	83 d0 00             	adc    $0x0,%eax
+  803137:	f7 d8                	neg    %eax
+  803139:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  80313e:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  803143:	50                   	push   %eax
+  803144:	56                   	push   %esi
+  803145:	89 c8                	mov    %ecx,%eax
+  803147:	e8 26 fe ff ff       	call   802f72 <dm>
+  80314c:	83 c4 10             	add    $0x10,%esp
+  80314f:	85 db                	test   %ebx,%ebx
+  803151:	78 10                	js     803163 <__moddi3+0x5e>
+  803153:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803157:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80315b:	83 c4 14             	add    $0x14,%esp
+  80315e:	5b                   	pop    %ebx
+  80315f:	5e                   	pop    %esi
+  803160:	5f                   	pop    %edi
+  803161:	5d                   	pop    %ebp
+  803162:	c3                   	ret
+  803163:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803167:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80316b:	f7 d8                	neg    %eax
+  80316d:	83 d2 00             	adc    $0x0,%edx
+  803170:	f7 da                	neg    %edx
+  803172:	eb e7                	jmp    80315b <__moddi3+0x56>
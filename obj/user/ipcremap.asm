@@ -0,0 +1,6184 @@
+
+obj/user/ipcremap:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 69 01 00 00       	call   80019a <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#define SRC	((char *) 0x10000000)
+#define DST	((char *) 0x20000000)
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+	envid_t child, who, parent = thisenv->env_id;
+  80003c:	a1 08 40 80 00       	mov    0x804008,%eax
+  800041:	8b 70 48             	mov    0x48(%eax),%esi
+	void *text = ROUNDDOWN((void *) umain, PGSIZE);
+	int perm, r, v;
+
+	if ((child = fork()) < 0)
+  800044:	e8 15 2a 00 00       	call   802a5e <fork>
+  800049:	89 c7                	mov    %eax,%edi
+  80004b:	85 c0                	test   %eax,%eax
+  80004d:	78 18                	js     800067 <umain+0x34>
+		panic("fork: %e", child);
+	if (child == 0) {
+  80004f:	74 28                	je     800079 <umain+0x46>
+		cprintf("queued send returned %e\n", r);
+		ipc_send(parent, 2, 0, 0);
+		return;
+	}
+
+	while (envs[ENVX(child)].env_ipc_sendto != parent)
+  800051:	89 c3                	mov    %eax,%ebx
+  800053:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  800059:	69 db 68 01 00 00    	imul   $0x168,%ebx,%ebx
+  80005f:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  800065:	eb 72                	jmp    8000d9 <umain+0xa6>
+		panic("fork: %e", child);
+  800067:	50                   	push   %eax
+  800068:	68 e0 2f 80 00       	push   $0x802fe0
+  80006d:	6a 15                	push   $0x15
+  80006f:	68 e9 2f 80 00       	push   $0x802fe9
+  800074:	e8 7c 01 00 00       	call   8001f5 <_panic>
+		if ((r = sys_page_alloc(0, SRC, PTE_P | PTE_U | PTE_W)) < 0)
+  800079:	83 ec 04             	sub    $0x4,%esp
+  80007c:	6a 07                	push   $0x7
+  80007e:	68 00 00 00 10       	push   $0x10000000
+  800083:	6a 00                	push   $0x0
+  800085:	e8 a2 10 00 00       	call   80112c <sys_page_alloc>
+  80008a:	83 c4 10             	add    $0x10,%esp
+  80008d:	85 c0                	test   %eax,%eax
+  80008f:	78 31                	js     8000c2 <umain+0x8f>
+		r = sys_ipc_send(parent, 1, SRC, PTE_P | PTE_U | PTE_W);
+  800091:	6a 07                	push   $0x7
+  800093:	68 00 00 00 10       	push   $0x10000000
+  800098:	6a 01                	push   $0x1
+  80009a:	56                   	push   %esi
+  80009b:	e8 b6 18 00 00       	call   801956 <sys_ipc_send>
+		cprintf("queued send returned %e\n", r);
+  8000a0:	83 c4 08             	add    $0x8,%esp
+  8000a3:	50                   	push   %eax
+  8000a4:	68 0c 30 80 00       	push   $0x80300c
+  8000a9:	e8 5b 02 00 00       	call   800309 <cprintf>
+		ipc_send(parent, 2, 0, 0);
+  8000ae:	6a 00                	push   $0x0
+  8000b0:	6a 00                	push   $0x0
+  8000b2:	6a 02                	push   $0x2
+  8000b4:	56                   	push   %esi
+  8000b5:	e8 65 2a 00 00       	call   802b1f <ipc_send>
+  8000ba:	83 c4 20             	add    $0x20,%esp
+  8000bd:	e9 94 00 00 00       	jmp    800156 <umain+0x123>
+			panic("sys_page_alloc: %e", r);
+  8000c2:	50                   	push   %eax
+  8000c3:	68 f9 2f 80 00       	push   $0x802ff9
+  8000c8:	6a 18                	push   $0x18
+  8000ca:	68 e9 2f 80 00       	push   $0x802fe9
+  8000cf:	e8 21 01 00 00       	call   8001f5 <_panic>
+		sys_yield();
+  8000d4:	e8 65 13 00 00       	call   80143e <sys_yield>
+	while (envs[ENVX(child)].env_ipc_sendto != parent)
+  8000d9:	8b 83 b0 00 00 00    	mov    0xb0(%ebx),%eax
+  8000df:	39 f0                	cmp    %esi,%eax
+  8000e1:	75 f1                	jne    8000d4 <umain+0xa1>
+	if ((r = sys_page_map(0, text, child, SRC, PTE_P | PTE_U)) < 0)
+  8000e3:	83 ec 0c             	sub    $0xc,%esp
+  8000e6:	6a 05                	push   $0x5
+  8000e8:	68 00 00 00 10       	push   $0x10000000
+  8000ed:	57                   	push   %edi
+	void *text = ROUNDDOWN((void *) umain, PGSIZE);
+  8000ee:	b8 33 00 80 00       	mov    $0x800033,%eax
+  8000f3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r = sys_page_map(0, text, child, SRC, PTE_P | PTE_U)) < 0)
+  8000f8:	50                   	push   %eax
+  8000f9:	6a 00                	push   $0x0
+  8000fb:	e8 f2 10 00 00       	call   8011f2 <sys_page_map>
+  800100:	83 c4 20             	add    $0x20,%esp
+  800103:	85 c0                	test   %eax,%eax
+  800105:	78 57                	js     80015e <umain+0x12b>
+		panic("sys_page_map: %e", r);
+
+	v = ipc_recv(&who, DST, &perm);
+  800107:	83 ec 04             	sub    $0x4,%esp
+  80010a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80010d:	50                   	push   %eax
+  80010e:	68 00 00 00 20       	push   $0x20000000
+  800113:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800116:	50                   	push   %eax
+  800117:	e8 91 29 00 00       	call   802aad <ipc_recv>
+	if (v != 2 || who != child)
+  80011c:	83 c4 10             	add    $0x10,%esp
+  80011f:	83 f8 02             	cmp    $0x2,%eax
+  800122:	75 4c                	jne    800170 <umain+0x13d>
+  800124:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  800127:	75 47                	jne    800170 <umain+0x13d>
+		panic("got message %d from %08x", v, who);
+	if (perm || ((uvpd[PDX(DST)] & PTE_P) && (uvpt[PGNUM(DST)] & PTE_P)))
+  800129:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80012c:	85 c0                	test   %eax,%eax
+  80012e:	75 58                	jne    800188 <umain+0x155>
+  800130:	8b 15 00 d2 7b ef    	mov    0xef7bd200,%edx
+  800136:	f6 c2 01             	test   $0x1,%dl
+  800139:	74 0b                	je     800146 <umain+0x113>
+  80013b:	8b 15 00 00 48 ef    	mov    0xef480000,%edx
+  800141:	f6 c2 01             	test   $0x1,%dl
+  800144:	75 42                	jne    800188 <umain+0x155>
+		panic("read-only page delivered with perm %x", perm);
+	cprintf("ipcremap OK\n");
+  800146:	83 ec 0c             	sub    $0xc,%esp
+  800149:	68 4f 30 80 00       	push   $0x80304f
+  80014e:	e8 b6 01 00 00       	call   800309 <cprintf>
+  800153:	83 c4 10             	add    $0x10,%esp
+}
+  800156:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800159:	5b                   	pop    %ebx
+  80015a:	5e                   	pop    %esi
+  80015b:	5f                   	pop    %edi
+  80015c:	5d                   	pop    %ebp
+  80015d:	c3                   	ret
+		panic("sys_page_map: %e", r);
+  80015e:	50                   	push   %eax
+  80015f:	68 25 30 80 00       	push   $0x803025
+  800164:	6a 22                	push   $0x22
+  800166:	68 e9 2f 80 00       	push   $0x802fe9
+  80016b:	e8 85 00 00 00       	call   8001f5 <_panic>
+		panic("got message %d from %08x", v, who);
+  800170:	83 ec 0c             	sub    $0xc,%esp
+  800173:	ff 75 e4             	push   -0x1c(%ebp)
+  800176:	50                   	push   %eax
+  800177:	68 36 30 80 00       	push   $0x803036
+  80017c:	6a 26                	push   $0x26
+  80017e:	68 e9 2f 80 00       	push   $0x802fe9
+  800183:	e8 6d 00 00 00       	call   8001f5 <_panic>
+		panic("read-only page delivered with perm %x", perm);
+  800188:	50                   	push   %eax
+  800189:	68 5c 30 80 00       	push   $0x80305c
+  80018e:	6a 28                	push   $0x28
+  800190:	68 e9 2f 80 00       	push   $0x802fe9
+  800195:	e8 5b 00 00 00       	call   8001f5 <_panic>
+
+0080019a <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80019a:	55                   	push   %ebp
+  80019b:	89 e5                	mov    %esp,%ebp
+  80019d:	56                   	push   %esi
+  80019e:	53                   	push   %ebx
+  80019f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001a2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  8001a5:	e8 e3 0e 00 00       	call   80108d <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  8001aa:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001af:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  8001b5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001ba:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001bf:	85 db                	test   %ebx,%ebx
+  8001c1:	7e 07                	jle    8001ca <libmain+0x30>
+		binaryname = argv[0];
+  8001c3:	8b 06                	mov    (%esi),%eax
+  8001c5:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8001ca:	83 ec 08             	sub    $0x8,%esp
+  8001cd:	56                   	push   %esi
+  8001ce:	53                   	push   %ebx
+  8001cf:	e8 5f fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8001d4:	e8 0a 00 00 00       	call   8001e3 <exit>
+}
+  8001d9:	83 c4 10             	add    $0x10,%esp
+  8001dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001df:	5b                   	pop    %ebx
+  8001e0:	5e                   	pop    %esi
+  8001e1:	5d                   	pop    %ebp
+  8001e2:	c3                   	ret
+
+008001e3 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001e3:	55                   	push   %ebp
+  8001e4:	89 e5                	mov    %esp,%ebp
+  8001e6:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  8001e9:	6a 00                	push   $0x0
+  8001eb:	e8 db 0d 00 00       	call   800fcb <sys_env_destroy>
+}
+  8001f0:	83 c4 10             	add    $0x10,%esp
+  8001f3:	c9                   	leave
+  8001f4:	c3                   	ret
+
+008001f5 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001f5:	55                   	push   %ebp
+  8001f6:	89 e5                	mov    %esp,%ebp
+  8001f8:	57                   	push   %edi
+  8001f9:	56                   	push   %esi
+  8001fa:	53                   	push   %ebx
+  8001fb:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  800201:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  800204:	8b 1d 00 40 80 00    	mov    0x804000,%ebx
+  80020a:	e8 7e 0e 00 00       	call   80108d <sys_getenvid>
+  80020f:	83 ec 04             	sub    $0x4,%esp
+  800212:	ff 75 0c             	push   0xc(%ebp)
+  800215:	ff 75 08             	push   0x8(%ebp)
+  800218:	53                   	push   %ebx
+  800219:	50                   	push   %eax
+  80021a:	68 8c 30 80 00       	push   $0x80308c
+  80021f:	68 00 01 00 00       	push   $0x100
+  800224:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  80022a:	56                   	push   %esi
+  80022b:	e8 72 06 00 00       	call   8008a2 <snprintf>
+  800230:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  800232:	83 c4 20             	add    $0x20,%esp
+  800235:	57                   	push   %edi
+  800236:	ff 75 10             	push   0x10(%ebp)
+  800239:	bf 00 01 00 00       	mov    $0x100,%edi
+  80023e:	89 f8                	mov    %edi,%eax
+  800240:	29 d8                	sub    %ebx,%eax
+  800242:	50                   	push   %eax
+  800243:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  800246:	50                   	push   %eax
+  800247:	e8 08 06 00 00       	call   800854 <vsnprintf>
+  80024c:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  80024e:	83 c4 0c             	add    $0xc,%esp
+  800251:	68 5a 30 80 00       	push   $0x80305a
+  800256:	29 df                	sub    %ebx,%edi
+  800258:	57                   	push   %edi
+  800259:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  80025c:	50                   	push   %eax
+  80025d:	e8 40 06 00 00       	call   8008a2 <snprintf>
+	sys_cputs(buf, r);
+  800262:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  800265:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  800267:	53                   	push   %ebx
+  800268:	56                   	push   %esi
+  800269:	e8 21 0c 00 00       	call   800e8f <sys_cputs>
+  80026e:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800271:	cc                   	int3
+	while (1)
+  800272:	eb fd                	jmp    800271 <_panic+0x7c>
+
+00800274 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800274:	55                   	push   %ebp
+  800275:	89 e5                	mov    %esp,%ebp
+  800277:	53                   	push   %ebx
+  800278:	83 ec 04             	sub    $0x4,%esp
+  80027b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80027e:	8b 13                	mov    (%ebx),%edx
+  800280:	8d 42 01             	lea    0x1(%edx),%eax
+  800283:	89 03                	mov    %eax,(%ebx)
+  800285:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800288:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80028c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800291:	74 09                	je     80029c <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800293:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800297:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80029a:	c9                   	leave
+  80029b:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80029c:	83 ec 08             	sub    $0x8,%esp
+  80029f:	68 ff 00 00 00       	push   $0xff
+  8002a4:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002a7:	50                   	push   %eax
+  8002a8:	e8 e2 0b 00 00       	call   800e8f <sys_cputs>
+		b->idx = 0;
+  8002ad:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002b3:	83 c4 10             	add    $0x10,%esp
+  8002b6:	eb db                	jmp    800293 <putch+0x1f>
+
+008002b8 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002b8:	55                   	push   %ebp
+  8002b9:	89 e5                	mov    %esp,%ebp
+  8002bb:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002c1:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002c8:	00 00 00 
+	b.cnt = 0;
+  8002cb:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002d2:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002d5:	ff 75 0c             	push   0xc(%ebp)
+  8002d8:	ff 75 08             	push   0x8(%ebp)
+  8002db:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002e1:	50                   	push   %eax
+  8002e2:	68 74 02 80 00       	push   $0x800274
+  8002e7:	e8 14 01 00 00       	call   800400 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002ec:	83 c4 08             	add    $0x8,%esp
+  8002ef:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002f5:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002fb:	50                   	push   %eax
+  8002fc:	e8 8e 0b 00 00       	call   800e8f <sys_cputs>
+
+	return b.cnt;
+}
+  800301:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800307:	c9                   	leave
+  800308:	c3                   	ret
+
+00800309 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800309:	55                   	push   %ebp
+  80030a:	89 e5                	mov    %esp,%ebp
+  80030c:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80030f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800312:	50                   	push   %eax
+  800313:	ff 75 08             	push   0x8(%ebp)
+  800316:	e8 9d ff ff ff       	call   8002b8 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80031b:	c9                   	leave
+  80031c:	c3                   	ret
+
+0080031d <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80031d:	55                   	push   %ebp
+  80031e:	89 e5                	mov    %esp,%ebp
+  800320:	57                   	push   %edi
+  800321:	56                   	push   %esi
+  800322:	53                   	push   %ebx
+  800323:	83 ec 1c             	sub    $0x1c,%esp
+  800326:	89 c7                	mov    %eax,%edi
+  800328:	89 d6                	mov    %edx,%esi
+  80032a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80032d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800330:	89 d1                	mov    %edx,%ecx
+  800332:	89 c2                	mov    %eax,%edx
+  800334:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800337:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80033a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80033d:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800340:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800343:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80034a:	39 c2                	cmp    %eax,%edx
+  80034c:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80034f:	72 3e                	jb     80038f <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800351:	83 ec 0c             	sub    $0xc,%esp
+  800354:	ff 75 18             	push   0x18(%ebp)
+  800357:	83 eb 01             	sub    $0x1,%ebx
+  80035a:	53                   	push   %ebx
+  80035b:	50                   	push   %eax
+  80035c:	83 ec 08             	sub    $0x8,%esp
+  80035f:	ff 75 e4             	push   -0x1c(%ebp)
+  800362:	ff 75 e0             	push   -0x20(%ebp)
+  800365:	ff 75 dc             	push   -0x24(%ebp)
+  800368:	ff 75 d8             	push   -0x28(%ebp)
+  80036b:	e8 2f 2b 00 00       	call   802e9f <__udivdi3>
+  800370:	83 c4 18             	add    $0x18,%esp
+  800373:	52                   	push   %edx
+  800374:	50                   	push   %eax
+  800375:	89 f2                	mov    %esi,%edx
+  800377:	89 f8                	mov    %edi,%eax
+  800379:	e8 9f ff ff ff       	call   80031d <printnum>
+  80037e:	83 c4 20             	add    $0x20,%esp
+  800381:	eb 13                	jmp    800396 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800383:	83 ec 08             	sub    $0x8,%esp
+  800386:	56                   	push   %esi
+  800387:	ff 75 18             	push   0x18(%ebp)
+  80038a:	ff d7                	call   *%edi
+  80038c:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80038f:	83 eb 01             	sub    $0x1,%ebx
+  800392:	85 db                	test   %ebx,%ebx
+  800394:	7f ed                	jg     800383 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800396:	83 ec 08             	sub    $0x8,%esp
+  800399:	56                   	push   %esi
+  80039a:	83 ec 04             	sub    $0x4,%esp
+  80039d:	ff 75 e4             	push   -0x1c(%ebp)
+  8003a0:	ff 75 e0             	push   -0x20(%ebp)
+  8003a3:	ff 75 dc             	push   -0x24(%ebp)
+  8003a6:	ff 75 d8             	push   -0x28(%ebp)
+  8003a9:	e8 0f 2b 00 00       	call   802ebd <__umoddi3>
+  8003ae:	83 c4 14             	add    $0x14,%esp
+  8003b1:	0f be 80 af 30 80 00 	movsbl 0x8030af(%eax),%eax
+  8003b8:	50                   	push   %eax
+  8003b9:	ff d7                	call   *%edi
+}
+  8003bb:	83 c4 10             	add    $0x10,%esp
+  8003be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003c1:	5b                   	pop    %ebx
+  8003c2:	5e                   	pop    %esi
+  8003c3:	5f                   	pop    %edi
+  8003c4:	5d                   	pop    %ebp
+  8003c5:	c3                   	ret
+
+008003c6 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003c6:	55                   	push   %ebp
+  8003c7:	89 e5                	mov    %esp,%ebp
+  8003c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003cc:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003d0:	8b 10                	mov    (%eax),%edx
+  8003d2:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003d5:	73 0a                	jae    8003e1 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003d7:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003da:	89 08                	mov    %ecx,(%eax)
+  8003dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003df:	88 02                	mov    %al,(%edx)
+}
+  8003e1:	5d                   	pop    %ebp
+  8003e2:	c3                   	ret
+
+008003e3 <printfmt>:
+{
+  8003e3:	55                   	push   %ebp
+  8003e4:	89 e5                	mov    %esp,%ebp
+  8003e6:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003e9:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003ec:	50                   	push   %eax
+  8003ed:	ff 75 10             	push   0x10(%ebp)
+  8003f0:	ff 75 0c             	push   0xc(%ebp)
+  8003f3:	ff 75 08             	push   0x8(%ebp)
+  8003f6:	e8 05 00 00 00       	call   800400 <vprintfmt>
+}
+  8003fb:	83 c4 10             	add    $0x10,%esp
+  8003fe:	c9                   	leave
+  8003ff:	c3                   	ret
+
+00800400 <vprintfmt>:
+{
+  800400:	55                   	push   %ebp
+  800401:	89 e5                	mov    %esp,%ebp
+  800403:	57                   	push   %edi
+  800404:	56                   	push   %esi
+  800405:	53                   	push   %ebx
+  800406:	83 ec 2c             	sub    $0x2c,%esp
+  800409:	8b 75 08             	mov    0x8(%ebp),%esi
+  80040c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80040f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800412:	eb 0a                	jmp    80041e <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800414:	83 ec 08             	sub    $0x8,%esp
+  800417:	53                   	push   %ebx
+  800418:	50                   	push   %eax
+  800419:	ff d6                	call   *%esi
+  80041b:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80041e:	83 c7 01             	add    $0x1,%edi
+  800421:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800425:	83 f8 25             	cmp    $0x25,%eax
+  800428:	74 0c                	je     800436 <vprintfmt+0x36>
+			if (ch == '\0')
+  80042a:	85 c0                	test   %eax,%eax
+  80042c:	75 e6                	jne    800414 <vprintfmt+0x14>
+}
+  80042e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800431:	5b                   	pop    %ebx
+  800432:	5e                   	pop    %esi
+  800433:	5f                   	pop    %edi
+  800434:	5d                   	pop    %ebp
+  800435:	c3                   	ret
+		padc = ' ';
+  800436:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80043a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800441:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800448:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80044f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800454:	8d 47 01             	lea    0x1(%edi),%eax
+  800457:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80045a:	0f b6 17             	movzbl (%edi),%edx
+  80045d:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800460:	3c 55                	cmp    $0x55,%al
+  800462:	0f 87 cf 03 00 00    	ja     800837 <vprintfmt+0x437>
+  800468:	0f b6 c0             	movzbl %al,%eax
+  80046b:	ff 24 85 a0 31 80 00 	jmp    *0x8031a0(,%eax,4)
+  800472:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800475:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800479:	eb d9                	jmp    800454 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80047b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80047e:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800482:	eb d0                	jmp    800454 <vprintfmt+0x54>
+  800484:	0f b6 d2             	movzbl %dl,%edx
+  800487:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80048a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800492:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800495:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800499:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80049c:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80049f:	83 f9 09             	cmp    $0x9,%ecx
+  8004a2:	77 55                	ja     8004f9 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8004a4:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8004a7:	eb e9                	jmp    800492 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8004a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ac:	8b 00                	mov    (%eax),%eax
+  8004ae:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b4:	8d 40 04             	lea    0x4(%eax),%eax
+  8004b7:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ba:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8004bd:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004c1:	79 91                	jns    800454 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8004c3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004c6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004c9:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004d0:	eb 82                	jmp    800454 <vprintfmt+0x54>
+			if (width < 0)
+  8004d2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004d5:	85 d2                	test   %edx,%edx
+  8004d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004dc:	0f 49 c2             	cmovns %edx,%eax
+  8004df:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004e5:	e9 6a ff ff ff       	jmp    800454 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ea:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8004ed:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004f4:	e9 5b ff ff ff       	jmp    800454 <vprintfmt+0x54>
+  8004f9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004fc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004ff:	eb bc                	jmp    8004bd <vprintfmt+0xbd>
+			lflag++;
+  800501:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800504:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800507:	e9 48 ff ff ff       	jmp    800454 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80050c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050f:	8d 78 04             	lea    0x4(%eax),%edi
+  800512:	83 ec 08             	sub    $0x8,%esp
+  800515:	53                   	push   %ebx
+  800516:	ff 30                	push   (%eax)
+  800518:	ff d6                	call   *%esi
+			break;
+  80051a:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80051d:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800520:	e9 b1 02 00 00       	jmp    8007d6 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800525:	8b 45 14             	mov    0x14(%ebp),%eax
+  800528:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80052b:	8b 10                	mov    (%eax),%edx
+  80052d:	89 d0                	mov    %edx,%eax
+  80052f:	f7 d8                	neg    %eax
+  800531:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800534:	83 f8 0d             	cmp    $0xd,%eax
+  800537:	7f 23                	jg     80055c <vprintfmt+0x15c>
+  800539:	8b 14 85 00 33 80 00 	mov    0x803300(,%eax,4),%edx
+  800540:	85 d2                	test   %edx,%edx
+  800542:	74 18                	je     80055c <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800544:	52                   	push   %edx
+  800545:	68 d0 30 80 00       	push   $0x8030d0
+  80054a:	53                   	push   %ebx
+  80054b:	56                   	push   %esi
+  80054c:	e8 92 fe ff ff       	call   8003e3 <printfmt>
+  800551:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800554:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800557:	e9 7a 02 00 00       	jmp    8007d6 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80055c:	50                   	push   %eax
+  80055d:	68 c7 30 80 00       	push   $0x8030c7
+  800562:	53                   	push   %ebx
+  800563:	56                   	push   %esi
+  800564:	e8 7a fe ff ff       	call   8003e3 <printfmt>
+  800569:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80056c:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80056f:	e9 62 02 00 00       	jmp    8007d6 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800574:	8b 45 14             	mov    0x14(%ebp),%eax
+  800577:	83 c0 04             	add    $0x4,%eax
+  80057a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80057d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800580:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800582:	85 c9                	test   %ecx,%ecx
+  800584:	b8 c0 30 80 00       	mov    $0x8030c0,%eax
+  800589:	0f 45 c1             	cmovne %ecx,%eax
+  80058c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80058f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800593:	7e 06                	jle    80059b <vprintfmt+0x19b>
+  800595:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800599:	75 0b                	jne    8005a6 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80059b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80059e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005a1:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005a4:	eb 5c                	jmp    800602 <vprintfmt+0x202>
+  8005a6:	83 ec 08             	sub    $0x8,%esp
+  8005a9:	ff 75 d0             	push   -0x30(%ebp)
+  8005ac:	ff 75 cc             	push   -0x34(%ebp)
+  8005af:	e8 20 03 00 00       	call   8008d4 <strnlen>
+  8005b4:	89 c2                	mov    %eax,%edx
+  8005b6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005b9:	29 d0                	sub    %edx,%eax
+  8005bb:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005be:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005c2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005c5:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005c8:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005ca:	eb 0e                	jmp    8005da <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8005cc:	83 ec 08             	sub    $0x8,%esp
+  8005cf:	53                   	push   %ebx
+  8005d0:	57                   	push   %edi
+  8005d1:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005d4:	83 ee 01             	sub    $0x1,%esi
+  8005d7:	83 c4 10             	add    $0x10,%esp
+  8005da:	85 f6                	test   %esi,%esi
+  8005dc:	7f ee                	jg     8005cc <vprintfmt+0x1cc>
+  8005de:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005e1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005e4:	85 c0                	test   %eax,%eax
+  8005e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005eb:	0f 49 d0             	cmovns %eax,%edx
+  8005ee:	29 d0                	sub    %edx,%eax
+  8005f0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005f3:	eb a6                	jmp    80059b <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8005f5:	83 ec 08             	sub    $0x8,%esp
+  8005f8:	53                   	push   %ebx
+  8005f9:	52                   	push   %edx
+  8005fa:	ff 55 08             	call   *0x8(%ebp)
+  8005fd:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800600:	89 f1                	mov    %esi,%ecx
+  800602:	8d 71 01             	lea    0x1(%ecx),%esi
+  800605:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800609:	0f be d0             	movsbl %al,%edx
+  80060c:	85 d2                	test   %edx,%edx
+  80060e:	74 28                	je     800638 <vprintfmt+0x238>
+  800610:	85 ff                	test   %edi,%edi
+  800612:	78 05                	js     800619 <vprintfmt+0x219>
+  800614:	83 ef 01             	sub    $0x1,%edi
+  800617:	78 30                	js     800649 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800619:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80061d:	74 d6                	je     8005f5 <vprintfmt+0x1f5>
+  80061f:	0f be c0             	movsbl %al,%eax
+  800622:	83 e8 20             	sub    $0x20,%eax
+  800625:	83 f8 5e             	cmp    $0x5e,%eax
+  800628:	76 cb                	jbe    8005f5 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80062a:	83 ec 08             	sub    $0x8,%esp
+  80062d:	53                   	push   %ebx
+  80062e:	6a 3f                	push   $0x3f
+  800630:	ff 55 08             	call   *0x8(%ebp)
+  800633:	83 c4 10             	add    $0x10,%esp
+  800636:	eb c8                	jmp    800600 <vprintfmt+0x200>
+  800638:	8b 75 08             	mov    0x8(%ebp),%esi
+  80063b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80063e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800641:	01 d0                	add    %edx,%eax
+  800643:	29 c8                	sub    %ecx,%eax
+  800645:	89 c7                	mov    %eax,%edi
+  800647:	eb 13                	jmp    80065c <vprintfmt+0x25c>
+  800649:	8b 75 08             	mov    0x8(%ebp),%esi
+  80064c:	eb ed                	jmp    80063b <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80064e:	83 ec 08             	sub    $0x8,%esp
+  800651:	53                   	push   %ebx
+  800652:	6a 20                	push   $0x20
+  800654:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800656:	83 ef 01             	sub    $0x1,%edi
+  800659:	83 c4 10             	add    $0x10,%esp
+  80065c:	85 ff                	test   %edi,%edi
+  80065e:	7f ee                	jg     80064e <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800660:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800663:	89 45 14             	mov    %eax,0x14(%ebp)
+  800666:	e9 6b 01 00 00       	jmp    8007d6 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80066b:	83 f9 01             	cmp    $0x1,%ecx
+  80066e:	7f 1f                	jg     80068f <vprintfmt+0x28f>
+	else if (lflag)
+  800670:	85 c9                	test   %ecx,%ecx
+  800672:	74 67                	je     8006db <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800674:	8b 45 14             	mov    0x14(%ebp),%eax
+  800677:	8b 00                	mov    (%eax),%eax
+  800679:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80067c:	89 c1                	mov    %eax,%ecx
+  80067e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800681:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800684:	8b 45 14             	mov    0x14(%ebp),%eax
+  800687:	8d 40 04             	lea    0x4(%eax),%eax
+  80068a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80068d:	eb 17                	jmp    8006a6 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80068f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800692:	8b 50 04             	mov    0x4(%eax),%edx
+  800695:	8b 00                	mov    (%eax),%eax
+  800697:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80069a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80069d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a0:	8d 40 08             	lea    0x8(%eax),%eax
+  8006a3:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006a6:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006a9:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8006ac:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8006b1:	85 c9                	test   %ecx,%ecx
+  8006b3:	0f 89 03 01 00 00    	jns    8007bc <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8006b9:	83 ec 08             	sub    $0x8,%esp
+  8006bc:	53                   	push   %ebx
+  8006bd:	6a 2d                	push   $0x2d
+  8006bf:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8006c1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006c4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006c7:	f7 da                	neg    %edx
+  8006c9:	83 d1 00             	adc    $0x0,%ecx
+  8006cc:	f7 d9                	neg    %ecx
+  8006ce:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006d1:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006d6:	e9 e1 00 00 00       	jmp    8007bc <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8006db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006de:	8b 00                	mov    (%eax),%eax
+  8006e0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006e3:	89 c1                	mov    %eax,%ecx
+  8006e5:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006e8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ee:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f4:	eb b0                	jmp    8006a6 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8006f6:	83 f9 01             	cmp    $0x1,%ecx
+  8006f9:	7f 1e                	jg     800719 <vprintfmt+0x319>
+	else if (lflag)
+  8006fb:	85 c9                	test   %ecx,%ecx
+  8006fd:	74 32                	je     800731 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8006ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800702:	8b 10                	mov    (%eax),%edx
+  800704:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800709:	8d 40 04             	lea    0x4(%eax),%eax
+  80070c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80070f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800714:	e9 a3 00 00 00       	jmp    8007bc <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800719:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071c:	8b 10                	mov    (%eax),%edx
+  80071e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800721:	8d 40 08             	lea    0x8(%eax),%eax
+  800724:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800727:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80072c:	e9 8b 00 00 00       	jmp    8007bc <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800731:	8b 45 14             	mov    0x14(%ebp),%eax
+  800734:	8b 10                	mov    (%eax),%edx
+  800736:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80073b:	8d 40 04             	lea    0x4(%eax),%eax
+  80073e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800741:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800746:	eb 74                	jmp    8007bc <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800748:	83 f9 01             	cmp    $0x1,%ecx
+  80074b:	7f 1b                	jg     800768 <vprintfmt+0x368>
+	else if (lflag)
+  80074d:	85 c9                	test   %ecx,%ecx
+  80074f:	74 2c                	je     80077d <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800751:	8b 45 14             	mov    0x14(%ebp),%eax
+  800754:	8b 10                	mov    (%eax),%edx
+  800756:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80075b:	8d 40 04             	lea    0x4(%eax),%eax
+  80075e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800761:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800766:	eb 54                	jmp    8007bc <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800768:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076b:	8b 10                	mov    (%eax),%edx
+  80076d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800770:	8d 40 08             	lea    0x8(%eax),%eax
+  800773:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800776:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80077b:	eb 3f                	jmp    8007bc <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80077d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800780:	8b 10                	mov    (%eax),%edx
+  800782:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800787:	8d 40 04             	lea    0x4(%eax),%eax
+  80078a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80078d:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800792:	eb 28                	jmp    8007bc <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800794:	83 ec 08             	sub    $0x8,%esp
+  800797:	53                   	push   %ebx
+  800798:	6a 30                	push   $0x30
+  80079a:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80079c:	83 c4 08             	add    $0x8,%esp
+  80079f:	53                   	push   %ebx
+  8007a0:	6a 78                	push   $0x78
+  8007a2:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8007a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a7:	8b 10                	mov    (%eax),%edx
+  8007a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007ae:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007b1:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007b7:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8007bc:	83 ec 0c             	sub    $0xc,%esp
+  8007bf:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8007c3:	50                   	push   %eax
+  8007c4:	ff 75 e0             	push   -0x20(%ebp)
+  8007c7:	57                   	push   %edi
+  8007c8:	51                   	push   %ecx
+  8007c9:	52                   	push   %edx
+  8007ca:	89 da                	mov    %ebx,%edx
+  8007cc:	89 f0                	mov    %esi,%eax
+  8007ce:	e8 4a fb ff ff       	call   80031d <printnum>
+			break;
+  8007d3:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8007d6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8007d9:	e9 40 fc ff ff       	jmp    80041e <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8007de:	83 f9 01             	cmp    $0x1,%ecx
+  8007e1:	7f 1b                	jg     8007fe <vprintfmt+0x3fe>
+	else if (lflag)
+  8007e3:	85 c9                	test   %ecx,%ecx
+  8007e5:	74 2c                	je     800813 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8007e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ea:	8b 10                	mov    (%eax),%edx
+  8007ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007f1:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007f7:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8007fc:	eb be                	jmp    8007bc <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8007fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800801:	8b 10                	mov    (%eax),%edx
+  800803:	8b 48 04             	mov    0x4(%eax),%ecx
+  800806:	8d 40 08             	lea    0x8(%eax),%eax
+  800809:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80080c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800811:	eb a9                	jmp    8007bc <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800813:	8b 45 14             	mov    0x14(%ebp),%eax
+  800816:	8b 10                	mov    (%eax),%edx
+  800818:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80081d:	8d 40 04             	lea    0x4(%eax),%eax
+  800820:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800823:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800828:	eb 92                	jmp    8007bc <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  80082a:	83 ec 08             	sub    $0x8,%esp
+  80082d:	53                   	push   %ebx
+  80082e:	6a 25                	push   $0x25
+  800830:	ff d6                	call   *%esi
+			break;
+  800832:	83 c4 10             	add    $0x10,%esp
+  800835:	eb 9f                	jmp    8007d6 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800837:	83 ec 08             	sub    $0x8,%esp
+  80083a:	53                   	push   %ebx
+  80083b:	6a 25                	push   $0x25
+  80083d:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80083f:	83 c4 10             	add    $0x10,%esp
+  800842:	89 f8                	mov    %edi,%eax
+  800844:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800848:	74 05                	je     80084f <vprintfmt+0x44f>
+  80084a:	83 e8 01             	sub    $0x1,%eax
+  80084d:	eb f5                	jmp    800844 <vprintfmt+0x444>
+  80084f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800852:	eb 82                	jmp    8007d6 <vprintfmt+0x3d6>
+
+00800854 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800854:	55                   	push   %ebp
+  800855:	89 e5                	mov    %esp,%ebp
+  800857:	83 ec 18             	sub    $0x18,%esp
+  80085a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80085d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800860:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800863:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800867:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80086a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800871:	85 c0                	test   %eax,%eax
+  800873:	74 26                	je     80089b <vsnprintf+0x47>
+  800875:	85 d2                	test   %edx,%edx
+  800877:	7e 22                	jle    80089b <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800879:	ff 75 14             	push   0x14(%ebp)
+  80087c:	ff 75 10             	push   0x10(%ebp)
+  80087f:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800882:	50                   	push   %eax
+  800883:	68 c6 03 80 00       	push   $0x8003c6
+  800888:	e8 73 fb ff ff       	call   800400 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80088d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800890:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800893:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800896:	83 c4 10             	add    $0x10,%esp
+}
+  800899:	c9                   	leave
+  80089a:	c3                   	ret
+		return -E_INVAL;
+  80089b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008a0:	eb f7                	jmp    800899 <vsnprintf+0x45>
+
+008008a2 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008a2:	55                   	push   %ebp
+  8008a3:	89 e5                	mov    %esp,%ebp
+  8008a5:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8008a8:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008ab:	50                   	push   %eax
+  8008ac:	ff 75 10             	push   0x10(%ebp)
+  8008af:	ff 75 0c             	push   0xc(%ebp)
+  8008b2:	ff 75 08             	push   0x8(%ebp)
+  8008b5:	e8 9a ff ff ff       	call   800854 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008ba:	c9                   	leave
+  8008bb:	c3                   	ret
+
+008008bc <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008bc:	55                   	push   %ebp
+  8008bd:	89 e5                	mov    %esp,%ebp
+  8008bf:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c7:	eb 03                	jmp    8008cc <strlen+0x10>
+		n++;
+  8008c9:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008cc:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008d0:	75 f7                	jne    8008c9 <strlen+0xd>
+	return n;
+}
+  8008d2:	5d                   	pop    %ebp
+  8008d3:	c3                   	ret
+
+008008d4 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008d4:	55                   	push   %ebp
+  8008d5:	89 e5                	mov    %esp,%ebp
+  8008d7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008da:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e2:	eb 03                	jmp    8008e7 <strnlen+0x13>
+		n++;
+  8008e4:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008e7:	39 d0                	cmp    %edx,%eax
+  8008e9:	74 08                	je     8008f3 <strnlen+0x1f>
+  8008eb:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008ef:	75 f3                	jne    8008e4 <strnlen+0x10>
+  8008f1:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008f3:	89 d0                	mov    %edx,%eax
+  8008f5:	5d                   	pop    %ebp
+  8008f6:	c3                   	ret
+
+008008f7 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008f7:	55                   	push   %ebp
+  8008f8:	89 e5                	mov    %esp,%ebp
+  8008fa:	53                   	push   %ebx
+  8008fb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008fe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800901:	b8 00 00 00 00       	mov    $0x0,%eax
+  800906:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80090a:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80090d:	83 c0 01             	add    $0x1,%eax
+  800910:	84 d2                	test   %dl,%dl
+  800912:	75 f2                	jne    800906 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800914:	89 c8                	mov    %ecx,%eax
+  800916:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800919:	c9                   	leave
+  80091a:	c3                   	ret
+
+0080091b <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80091b:	55                   	push   %ebp
+  80091c:	89 e5                	mov    %esp,%ebp
+  80091e:	53                   	push   %ebx
+  80091f:	83 ec 10             	sub    $0x10,%esp
+  800922:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800925:	53                   	push   %ebx
+  800926:	e8 91 ff ff ff       	call   8008bc <strlen>
+  80092b:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80092e:	ff 75 0c             	push   0xc(%ebp)
+  800931:	01 d8                	add    %ebx,%eax
+  800933:	50                   	push   %eax
+  800934:	e8 be ff ff ff       	call   8008f7 <strcpy>
+	return dst;
+}
+  800939:	89 d8                	mov    %ebx,%eax
+  80093b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80093e:	c9                   	leave
+  80093f:	c3                   	ret
+
+00800940 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800940:	55                   	push   %ebp
+  800941:	89 e5                	mov    %esp,%ebp
+  800943:	56                   	push   %esi
+  800944:	53                   	push   %ebx
+  800945:	8b 75 08             	mov    0x8(%ebp),%esi
+  800948:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80094b:	89 f3                	mov    %esi,%ebx
+  80094d:	03 5d 10             	add    0x10(%ebp),%ebx
+  800950:	89 f0                	mov    %esi,%eax
+  800952:	eb 0f                	jmp    800963 <strncpy+0x23>
+		*dst++ = *src;
+  800954:	83 c0 01             	add    $0x1,%eax
+  800957:	0f b6 0a             	movzbl (%edx),%ecx
+  80095a:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80095d:	80 f9 01             	cmp    $0x1,%cl
+  800960:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800963:	39 d8                	cmp    %ebx,%eax
+  800965:	75 ed                	jne    800954 <strncpy+0x14>
+	}
+	return ret;
+}
+  800967:	89 f0                	mov    %esi,%eax
+  800969:	5b                   	pop    %ebx
+  80096a:	5e                   	pop    %esi
+  80096b:	5d                   	pop    %ebp
+  80096c:	c3                   	ret
+
+0080096d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80096d:	55                   	push   %ebp
+  80096e:	89 e5                	mov    %esp,%ebp
+  800970:	56                   	push   %esi
+  800971:	53                   	push   %ebx
+  800972:	8b 75 08             	mov    0x8(%ebp),%esi
+  800975:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800978:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80097b:	89 f0                	mov    %esi,%eax
+  80097d:	85 d2                	test   %edx,%edx
+  80097f:	74 21                	je     8009a2 <strlcpy+0x35>
+  800981:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800985:	89 f2                	mov    %esi,%edx
+  800987:	eb 09                	jmp    800992 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800989:	83 c1 01             	add    $0x1,%ecx
+  80098c:	83 c2 01             	add    $0x1,%edx
+  80098f:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800992:	39 c2                	cmp    %eax,%edx
+  800994:	74 09                	je     80099f <strlcpy+0x32>
+  800996:	0f b6 19             	movzbl (%ecx),%ebx
+  800999:	84 db                	test   %bl,%bl
+  80099b:	75 ec                	jne    800989 <strlcpy+0x1c>
+  80099d:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80099f:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009a2:	29 f0                	sub    %esi,%eax
+}
+  8009a4:	5b                   	pop    %ebx
+  8009a5:	5e                   	pop    %esi
+  8009a6:	5d                   	pop    %ebp
+  8009a7:	c3                   	ret
+
+008009a8 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009a8:	55                   	push   %ebp
+  8009a9:	89 e5                	mov    %esp,%ebp
+  8009ab:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009ae:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009b1:	eb 06                	jmp    8009b9 <strcmp+0x11>
+		p++, q++;
+  8009b3:	83 c1 01             	add    $0x1,%ecx
+  8009b6:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009b9:	0f b6 01             	movzbl (%ecx),%eax
+  8009bc:	84 c0                	test   %al,%al
+  8009be:	74 04                	je     8009c4 <strcmp+0x1c>
+  8009c0:	3a 02                	cmp    (%edx),%al
+  8009c2:	74 ef                	je     8009b3 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009c4:	0f b6 c0             	movzbl %al,%eax
+  8009c7:	0f b6 12             	movzbl (%edx),%edx
+  8009ca:	29 d0                	sub    %edx,%eax
+}
+  8009cc:	5d                   	pop    %ebp
+  8009cd:	c3                   	ret
+
+008009ce <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009ce:	55                   	push   %ebp
+  8009cf:	89 e5                	mov    %esp,%ebp
+  8009d1:	53                   	push   %ebx
+  8009d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009d8:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009db:	eb 09                	jmp    8009e6 <strncmp+0x18>
+		n--, p++, q++;
+  8009dd:	83 ea 01             	sub    $0x1,%edx
+  8009e0:	83 c0 01             	add    $0x1,%eax
+  8009e3:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009e6:	85 d2                	test   %edx,%edx
+  8009e8:	74 18                	je     800a02 <strncmp+0x34>
+  8009ea:	0f b6 18             	movzbl (%eax),%ebx
+  8009ed:	84 db                	test   %bl,%bl
+  8009ef:	74 04                	je     8009f5 <strncmp+0x27>
+  8009f1:	3a 19                	cmp    (%ecx),%bl
+  8009f3:	74 e8                	je     8009dd <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009f5:	0f b6 00             	movzbl (%eax),%eax
+  8009f8:	0f b6 11             	movzbl (%ecx),%edx
+  8009fb:	29 d0                	sub    %edx,%eax
+}
+  8009fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a00:	c9                   	leave
+  800a01:	c3                   	ret
+		return 0;
+  800a02:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a07:	eb f4                	jmp    8009fd <strncmp+0x2f>
+
+00800a09 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a09:	55                   	push   %ebp
+  800a0a:	89 e5                	mov    %esp,%ebp
+  800a0c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a0f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a13:	eb 03                	jmp    800a18 <strchr+0xf>
+  800a15:	83 c0 01             	add    $0x1,%eax
+  800a18:	0f b6 10             	movzbl (%eax),%edx
+  800a1b:	84 d2                	test   %dl,%dl
+  800a1d:	74 06                	je     800a25 <strchr+0x1c>
+		if (*s == c)
+  800a1f:	38 ca                	cmp    %cl,%dl
+  800a21:	75 f2                	jne    800a15 <strchr+0xc>
+  800a23:	eb 05                	jmp    800a2a <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a25:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a2a:	5d                   	pop    %ebp
+  800a2b:	c3                   	ret
+
+00800a2c <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a2c:	55                   	push   %ebp
+  800a2d:	89 e5                	mov    %esp,%ebp
+  800a2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a32:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a36:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a39:	38 ca                	cmp    %cl,%dl
+  800a3b:	74 09                	je     800a46 <strfind+0x1a>
+  800a3d:	84 d2                	test   %dl,%dl
+  800a3f:	74 05                	je     800a46 <strfind+0x1a>
+	for (; *s; s++)
+  800a41:	83 c0 01             	add    $0x1,%eax
+  800a44:	eb f0                	jmp    800a36 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a46:	5d                   	pop    %ebp
+  800a47:	c3                   	ret
+
+00800a48 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a48:	55                   	push   %ebp
+  800a49:	89 e5                	mov    %esp,%ebp
+  800a4b:	57                   	push   %edi
+  800a4c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a4f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a52:	85 c9                	test   %ecx,%ecx
+  800a54:	74 20                	je     800a76 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a56:	89 f8                	mov    %edi,%eax
+  800a58:	09 c8                	or     %ecx,%eax
+  800a5a:	a8 03                	test   $0x3,%al
+  800a5c:	75 12                	jne    800a70 <memset+0x28>
+		c &= 0xFF;
+  800a5e:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a62:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a68:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a6b:	fc                   	cld
+  800a6c:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a6e:	eb 06                	jmp    800a76 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a70:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a73:	fc                   	cld
+  800a74:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a76:	89 f8                	mov    %edi,%eax
+  800a78:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a7b:	c9                   	leave
+  800a7c:	c3                   	ret
+
+00800a7d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a7d:	55                   	push   %ebp
+  800a7e:	89 e5                	mov    %esp,%ebp
+  800a80:	57                   	push   %edi
+  800a81:	56                   	push   %esi
+  800a82:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a85:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a88:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a8b:	39 c6                	cmp    %eax,%esi
+  800a8d:	73 32                	jae    800ac1 <memmove+0x44>
+  800a8f:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a92:	39 d0                	cmp    %edx,%eax
+  800a94:	73 2b                	jae    800ac1 <memmove+0x44>
+		s += n;
+		d += n;
+  800a96:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a99:	89 d6                	mov    %edx,%esi
+  800a9b:	09 fe                	or     %edi,%esi
+  800a9d:	09 ce                	or     %ecx,%esi
+  800a9f:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800aa5:	75 0e                	jne    800ab5 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800aa7:	83 ef 04             	sub    $0x4,%edi
+  800aaa:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800aad:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ab0:	fd                   	std
+  800ab1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ab3:	eb 09                	jmp    800abe <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ab5:	83 ef 01             	sub    $0x1,%edi
+  800ab8:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800abb:	fd                   	std
+  800abc:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800abe:	fc                   	cld
+  800abf:	eb 1a                	jmp    800adb <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ac1:	89 f2                	mov    %esi,%edx
+  800ac3:	09 c2                	or     %eax,%edx
+  800ac5:	09 ca                	or     %ecx,%edx
+  800ac7:	f6 c2 03             	test   $0x3,%dl
+  800aca:	75 0a                	jne    800ad6 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800acc:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800acf:	89 c7                	mov    %eax,%edi
+  800ad1:	fc                   	cld
+  800ad2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ad4:	eb 05                	jmp    800adb <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800ad6:	89 c7                	mov    %eax,%edi
+  800ad8:	fc                   	cld
+  800ad9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800adb:	5e                   	pop    %esi
+  800adc:	5f                   	pop    %edi
+  800add:	5d                   	pop    %ebp
+  800ade:	c3                   	ret
+
+00800adf <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800adf:	55                   	push   %ebp
+  800ae0:	89 e5                	mov    %esp,%ebp
+  800ae2:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ae5:	ff 75 10             	push   0x10(%ebp)
+  800ae8:	ff 75 0c             	push   0xc(%ebp)
+  800aeb:	ff 75 08             	push   0x8(%ebp)
+  800aee:	e8 8a ff ff ff       	call   800a7d <memmove>
+}
+  800af3:	c9                   	leave
+  800af4:	c3                   	ret
+
+00800af5 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800af5:	55                   	push   %ebp
+  800af6:	89 e5                	mov    %esp,%ebp
+  800af8:	56                   	push   %esi
+  800af9:	53                   	push   %ebx
+  800afa:	8b 45 08             	mov    0x8(%ebp),%eax
+  800afd:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b00:	89 c6                	mov    %eax,%esi
+  800b02:	03 75 10             	add    0x10(%ebp),%esi
+  800b05:	eb 06                	jmp    800b0d <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b07:	83 c0 01             	add    $0x1,%eax
+  800b0a:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b0d:	39 f0                	cmp    %esi,%eax
+  800b0f:	74 14                	je     800b25 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b11:	0f b6 08             	movzbl (%eax),%ecx
+  800b14:	0f b6 1a             	movzbl (%edx),%ebx
+  800b17:	38 d9                	cmp    %bl,%cl
+  800b19:	74 ec                	je     800b07 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b1b:	0f b6 c1             	movzbl %cl,%eax
+  800b1e:	0f b6 db             	movzbl %bl,%ebx
+  800b21:	29 d8                	sub    %ebx,%eax
+  800b23:	eb 05                	jmp    800b2a <memcmp+0x35>
+	}
+
+	return 0;
+  800b25:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b2a:	5b                   	pop    %ebx
+  800b2b:	5e                   	pop    %esi
+  800b2c:	5d                   	pop    %ebp
+  800b2d:	c3                   	ret
+
+00800b2e <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b2e:	55                   	push   %ebp
+  800b2f:	89 e5                	mov    %esp,%ebp
+  800b31:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b34:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b37:	89 c2                	mov    %eax,%edx
+  800b39:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b3c:	eb 03                	jmp    800b41 <memfind+0x13>
+  800b3e:	83 c0 01             	add    $0x1,%eax
+  800b41:	39 d0                	cmp    %edx,%eax
+  800b43:	73 04                	jae    800b49 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b45:	38 08                	cmp    %cl,(%eax)
+  800b47:	75 f5                	jne    800b3e <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b49:	5d                   	pop    %ebp
+  800b4a:	c3                   	ret
+
+00800b4b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b4b:	55                   	push   %ebp
+  800b4c:	89 e5                	mov    %esp,%ebp
+  800b4e:	57                   	push   %edi
+  800b4f:	56                   	push   %esi
+  800b50:	53                   	push   %ebx
+  800b51:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b54:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b57:	eb 03                	jmp    800b5c <strtol+0x11>
+		s++;
+  800b59:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b5c:	0f b6 02             	movzbl (%edx),%eax
+  800b5f:	3c 20                	cmp    $0x20,%al
+  800b61:	74 f6                	je     800b59 <strtol+0xe>
+  800b63:	3c 09                	cmp    $0x9,%al
+  800b65:	74 f2                	je     800b59 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b67:	3c 2b                	cmp    $0x2b,%al
+  800b69:	74 2a                	je     800b95 <strtol+0x4a>
+	int neg = 0;
+  800b6b:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b70:	3c 2d                	cmp    $0x2d,%al
+  800b72:	74 2b                	je     800b9f <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b74:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b7a:	75 0f                	jne    800b8b <strtol+0x40>
+  800b7c:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b7f:	74 28                	je     800ba9 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b81:	85 db                	test   %ebx,%ebx
+  800b83:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b88:	0f 44 d8             	cmove  %eax,%ebx
+  800b8b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b90:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b93:	eb 46                	jmp    800bdb <strtol+0x90>
+		s++;
+  800b95:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b98:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b9d:	eb d5                	jmp    800b74 <strtol+0x29>
+		s++, neg = 1;
+  800b9f:	83 c2 01             	add    $0x1,%edx
+  800ba2:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ba7:	eb cb                	jmp    800b74 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ba9:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800bad:	74 0e                	je     800bbd <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800baf:	85 db                	test   %ebx,%ebx
+  800bb1:	75 d8                	jne    800b8b <strtol+0x40>
+		s++, base = 8;
+  800bb3:	83 c2 01             	add    $0x1,%edx
+  800bb6:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bbb:	eb ce                	jmp    800b8b <strtol+0x40>
+		s += 2, base = 16;
+  800bbd:	83 c2 02             	add    $0x2,%edx
+  800bc0:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bc5:	eb c4                	jmp    800b8b <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800bc7:	0f be c0             	movsbl %al,%eax
+  800bca:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800bcd:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bd0:	7d 3a                	jge    800c0c <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800bd2:	83 c2 01             	add    $0x1,%edx
+  800bd5:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bd9:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800bdb:	0f b6 02             	movzbl (%edx),%eax
+  800bde:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800be1:	89 f3                	mov    %esi,%ebx
+  800be3:	80 fb 09             	cmp    $0x9,%bl
+  800be6:	76 df                	jbe    800bc7 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800be8:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800beb:	89 f3                	mov    %esi,%ebx
+  800bed:	80 fb 19             	cmp    $0x19,%bl
+  800bf0:	77 08                	ja     800bfa <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800bf2:	0f be c0             	movsbl %al,%eax
+  800bf5:	83 e8 57             	sub    $0x57,%eax
+  800bf8:	eb d3                	jmp    800bcd <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bfa:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bfd:	89 f3                	mov    %esi,%ebx
+  800bff:	80 fb 19             	cmp    $0x19,%bl
+  800c02:	77 08                	ja     800c0c <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800c04:	0f be c0             	movsbl %al,%eax
+  800c07:	83 e8 37             	sub    $0x37,%eax
+  800c0a:	eb c1                	jmp    800bcd <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c0c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c10:	74 05                	je     800c17 <strtol+0xcc>
+		*endptr = (char *) s;
+  800c12:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c15:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c17:	89 c8                	mov    %ecx,%eax
+  800c19:	f7 d8                	neg    %eax
+  800c1b:	85 ff                	test   %edi,%edi
+  800c1d:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c20:	89 c8                	mov    %ecx,%eax
+  800c22:	5b                   	pop    %ebx
+  800c23:	5e                   	pop    %esi
+  800c24:	5f                   	pop    %edi
+  800c25:	5d                   	pop    %ebp
+  800c26:	c3                   	ret
+
+00800c27 <atoi>:
+
+int
+atoi(const char *s)
+{
+  800c27:	55                   	push   %ebp
+  800c28:	89 e5                	mov    %esp,%ebp
+  800c2a:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800c2d:	6a 0a                	push   $0xa
+  800c2f:	6a 00                	push   $0x0
+  800c31:	ff 75 08             	push   0x8(%ebp)
+  800c34:	e8 12 ff ff ff       	call   800b4b <strtol>
+}
+  800c39:	c9                   	leave
+  800c3a:	c3                   	ret
+
+00800c3b <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800c3b:	55                   	push   %ebp
+  800c3c:	89 e5                	mov    %esp,%ebp
+  800c3e:	57                   	push   %edi
+  800c3f:	56                   	push   %esi
+  800c40:	53                   	push   %ebx
+  800c41:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800c47:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800c4d:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800c53:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800c59:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800c60:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800c63:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800c6a:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800c6d:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800c74:	74 76                	je     800cec <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800c76:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800c7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c7f:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800c85:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800c8c:	0f 88 06 01 00 00    	js     800d98 <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800c92:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800c99:	0f 84 48 01 00 00    	je     800de7 <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800c9f:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800ca5:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800cab:	be 00 00 00 00       	mov    $0x0,%esi
+  800cb0:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800cb6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800cb9:	55                   	push   %ebp
+  800cba:	68 c3 0c 80 00       	push   $0x800cc3
+  800cbf:	89 e5                	mov    %esp,%ebp
+  800cc1:	0f 34                	sysenter
+  800cc3:	83 c4 04             	add    $0x4,%esp
+  800cc6:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800cc7:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800ccd:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800cd3:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800cd6:	0f 85 9a 01 00 00    	jne    800e76 <page_vec_call+0x23b>
+  800cdc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ce1:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ce4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ce7:	e9 29 01 00 00       	jmp    800e15 <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800cec:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800cf2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cf5:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800cf7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800cfe:	78 2f                	js     800d2f <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800d00:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800d07:	74 72                	je     800d7b <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800d09:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800d0f:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800d15:	b8 10 00 00 00       	mov    $0x10,%eax
+  800d1a:	89 fb                	mov    %edi,%ebx
+  800d1c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800d1f:	55                   	push   %ebp
+  800d20:	68 29 0d 80 00       	push   $0x800d29
+  800d25:	89 e5                	mov    %esp,%ebp
+  800d27:	0f 34                	sysenter
+  800d29:	83 c4 04             	add    $0x4,%esp
+  800d2c:	5d                   	pop    %ebp
+	return ret;
+  800d2d:	eb 98                	jmp    800cc7 <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800d2f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d34:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800d36:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800d3b:	f6 c6 08             	test   $0x8,%dh
+  800d3e:	74 15                	je     800d55 <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d40:	89 c2                	mov    %eax,%edx
+  800d42:	c1 ea 08             	shr    $0x8,%edx
+  800d45:	83 e2 0f             	and    $0xf,%edx
+  800d48:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d4d:	83 fa 06             	cmp    $0x6,%edx
+  800d50:	74 0e                	je     800d60 <page_vec_call+0x125>
+  800d52:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800d55:	0f b6 c9             	movzbl %cl,%ecx
+  800d58:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800d5e:	eb a0                	jmp    800d00 <page_vec_call+0xc5>
+  800d60:	89 c2                	mov    %eax,%edx
+  800d62:	c1 ea 04             	shr    $0x4,%edx
+  800d65:	83 e2 0f             	and    $0xf,%edx
+  800d68:	83 fa 02             	cmp    $0x2,%edx
+  800d6b:	77 e5                	ja     800d52 <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800d6d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d70:	83 f8 02             	cmp    $0x2,%eax
+  800d73:	0f 97 c1             	seta   %cl
+  800d76:	0f b6 c9             	movzbl %cl,%ecx
+  800d79:	eb d7                	jmp    800d52 <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800d7b:	b8 10 00 00 00       	mov    $0x10,%eax
+  800d80:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800d86:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800d8c:	89 fb                	mov    %edi,%ebx
+  800d8e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800d91:	cd 30                	int    $0x30
+  800d93:	e9 2f ff ff ff       	jmp    800cc7 <page_vec_call+0x8c>
+  800d98:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d9d:	0f a2                	cpuid
+		return 0;
+  800d9f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800da4:	f6 c6 08             	test   $0x8,%dh
+  800da7:	74 15                	je     800dbe <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800da9:	89 c2                	mov    %eax,%edx
+  800dab:	c1 ea 08             	shr    $0x8,%edx
+  800dae:	83 e2 0f             	and    $0xf,%edx
+  800db1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800db6:	83 fa 06             	cmp    $0x6,%edx
+  800db9:	74 11                	je     800dcc <page_vec_call+0x191>
+  800dbb:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800dbe:	0f b6 c9             	movzbl %cl,%ecx
+  800dc1:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800dc7:	e9 c6 fe ff ff       	jmp    800c92 <page_vec_call+0x57>
+  800dcc:	89 c2                	mov    %eax,%edx
+  800dce:	c1 ea 04             	shr    $0x4,%edx
+  800dd1:	83 e2 0f             	and    $0xf,%edx
+  800dd4:	83 fa 02             	cmp    $0x2,%edx
+  800dd7:	77 e2                	ja     800dbb <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800dd9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ddc:	83 f8 02             	cmp    $0x2,%eax
+  800ddf:	0f 97 c1             	seta   %cl
+  800de2:	0f b6 c9             	movzbl %cl,%ecx
+  800de5:	eb d4                	jmp    800dbb <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800de7:	be 00 00 00 00       	mov    $0x0,%esi
+  800dec:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800df2:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800df8:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800dfe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800e01:	cd 30                	int    $0x30
+  800e03:	e9 bf fe ff ff       	jmp    800cc7 <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800e08:	29 da                	sub    %ebx,%edx
+			vec++;
+  800e0a:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800e0d:	83 e8 01             	sub    $0x1,%eax
+  800e10:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800e15:	85 c0                	test   %eax,%eax
+  800e17:	74 58                	je     800e71 <page_vec_call+0x236>
+  800e19:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800e1c:	39 da                	cmp    %ebx,%edx
+  800e1e:	73 e8                	jae    800e08 <page_vec_call+0x1cd>
+  800e20:	89 75 08             	mov    %esi,0x8(%ebp)
+  800e23:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800e26:	84 c9                	test   %cl,%cl
+  800e28:	74 06                	je     800e30 <page_vec_call+0x1f5>
+  800e2a:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800e30:	83 ec 04             	sub    $0x4,%esp
+  800e33:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e36:	c1 e0 04             	shl    $0x4,%eax
+  800e39:	50                   	push   %eax
+  800e3a:	ff 75 08             	push   0x8(%ebp)
+  800e3d:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800e43:	53                   	push   %ebx
+  800e44:	e8 34 fc ff ff       	call   800a7d <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800e49:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800e4f:	89 c2                	mov    %eax,%edx
+  800e51:	c1 e2 0c             	shl    $0xc,%edx
+  800e54:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  800e5a:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  800e60:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  800e66:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  800e69:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  800e6c:	e9 f2 fd ff ff       	jmp    800c63 <page_vec_call+0x28>
+			r = 0;
+  800e71:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  800e76:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800e7a:	74 0b                	je     800e87 <page_vec_call+0x24c>
+		*done = total;
+  800e7c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800e7f:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  800e85:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  800e87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e8a:	5b                   	pop    %ebx
+  800e8b:	5e                   	pop    %esi
+  800e8c:	5f                   	pop    %edi
+  800e8d:	5d                   	pop    %ebp
+  800e8e:	c3                   	ret
+
+00800e8f <sys_cputs>:
+{
+  800e8f:	55                   	push   %ebp
+  800e90:	89 e5                	mov    %esp,%ebp
+  800e92:	57                   	push   %edi
+  800e93:	56                   	push   %esi
+  800e94:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800e95:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e9c:	78 2d                	js     800ecb <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800e9e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800ea5:	74 70                	je     800f17 <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800ea7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eac:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eaf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb2:	89 c3                	mov    %eax,%ebx
+  800eb4:	89 c7                	mov    %eax,%edi
+  800eb6:	89 c6                	mov    %eax,%esi
+  800eb8:	55                   	push   %ebp
+  800eb9:	68 c2 0e 80 00       	push   $0x800ec2
+  800ebe:	89 e5                	mov    %esp,%ebp
+  800ec0:	0f 34                	sysenter
+  800ec2:	83 c4 04             	add    $0x4,%esp
+  800ec5:	5d                   	pop    %ebp
+}
+  800ec6:	5b                   	pop    %ebx
+  800ec7:	5e                   	pop    %esi
+  800ec8:	5f                   	pop    %edi
+  800ec9:	5d                   	pop    %ebp
+  800eca:	c3                   	ret
+  800ecb:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ed0:	0f a2                	cpuid
+		return 0;
+  800ed2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800ed7:	f6 c6 08             	test   $0x8,%dh
+  800eda:	74 15                	je     800ef1 <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800edc:	89 c2                	mov    %eax,%edx
+  800ede:	c1 ea 08             	shr    $0x8,%edx
+  800ee1:	83 e2 0f             	and    $0xf,%edx
+  800ee4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ee9:	83 fa 06             	cmp    $0x6,%edx
+  800eec:	74 0e                	je     800efc <sys_cputs+0x6d>
+  800eee:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800ef1:	0f b6 c9             	movzbl %cl,%ecx
+  800ef4:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800efa:	eb a2                	jmp    800e9e <sys_cputs+0xf>
+  800efc:	89 c2                	mov    %eax,%edx
+  800efe:	c1 ea 04             	shr    $0x4,%edx
+  800f01:	83 e2 0f             	and    $0xf,%edx
+  800f04:	83 fa 02             	cmp    $0x2,%edx
+  800f07:	77 e5                	ja     800eee <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800f09:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f0c:	83 f8 02             	cmp    $0x2,%eax
+  800f0f:	0f 97 c1             	seta   %cl
+  800f12:	0f b6 c9             	movzbl %cl,%ecx
+  800f15:	eb d7                	jmp    800eee <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800f17:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f22:	89 c3                	mov    %eax,%ebx
+  800f24:	89 c7                	mov    %eax,%edi
+  800f26:	89 c6                	mov    %eax,%esi
+  800f28:	cd 30                	int    $0x30
+}
+  800f2a:	eb 9a                	jmp    800ec6 <sys_cputs+0x37>
+
+00800f2c <sys_cgetc>:
+{
+  800f2c:	55                   	push   %ebp
+  800f2d:	89 e5                	mov    %esp,%ebp
+  800f2f:	57                   	push   %edi
+  800f30:	56                   	push   %esi
+  800f31:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800f32:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800f39:	78 2e                	js     800f69 <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  800f3b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800f42:	74 71                	je     800fb5 <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  800f44:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f49:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f4e:	89 d1                	mov    %edx,%ecx
+  800f50:	89 d3                	mov    %edx,%ebx
+  800f52:	89 d7                	mov    %edx,%edi
+  800f54:	89 d6                	mov    %edx,%esi
+  800f56:	55                   	push   %ebp
+  800f57:	68 60 0f 80 00       	push   $0x800f60
+  800f5c:	89 e5                	mov    %esp,%ebp
+  800f5e:	0f 34                	sysenter
+  800f60:	83 c4 04             	add    $0x4,%esp
+  800f63:	5d                   	pop    %ebp
+}
+  800f64:	5b                   	pop    %ebx
+  800f65:	5e                   	pop    %esi
+  800f66:	5f                   	pop    %edi
+  800f67:	5d                   	pop    %ebp
+  800f68:	c3                   	ret
+  800f69:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f6e:	0f a2                	cpuid
+		return 0;
+  800f70:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f75:	f6 c6 08             	test   $0x8,%dh
+  800f78:	74 15                	je     800f8f <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f7a:	89 c2                	mov    %eax,%edx
+  800f7c:	c1 ea 08             	shr    $0x8,%edx
+  800f7f:	83 e2 0f             	and    $0xf,%edx
+  800f82:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f87:	83 fa 06             	cmp    $0x6,%edx
+  800f8a:	74 0e                	je     800f9a <sys_cgetc+0x6e>
+  800f8c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f8f:	0f b6 c9             	movzbl %cl,%ecx
+  800f92:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800f98:	eb a1                	jmp    800f3b <sys_cgetc+0xf>
+  800f9a:	89 c2                	mov    %eax,%edx
+  800f9c:	c1 ea 04             	shr    $0x4,%edx
+  800f9f:	83 e2 0f             	and    $0xf,%edx
+  800fa2:	83 fa 02             	cmp    $0x2,%edx
+  800fa5:	77 e5                	ja     800f8c <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  800fa7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800faa:	83 f8 02             	cmp    $0x2,%eax
+  800fad:	0f 97 c1             	seta   %cl
+  800fb0:	0f b6 c9             	movzbl %cl,%ecx
+  800fb3:	eb d7                	jmp    800f8c <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  800fb5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fba:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fbf:	89 d1                	mov    %edx,%ecx
+  800fc1:	89 d3                	mov    %edx,%ebx
+  800fc3:	89 d7                	mov    %edx,%edi
+  800fc5:	89 d6                	mov    %edx,%esi
+  800fc7:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800fc9:	eb 99                	jmp    800f64 <sys_cgetc+0x38>
+
+00800fcb <sys_env_destroy>:
+{
+  800fcb:	55                   	push   %ebp
+  800fcc:	89 e5                	mov    %esp,%ebp
+  800fce:	57                   	push   %edi
+  800fcf:	56                   	push   %esi
+  800fd0:	53                   	push   %ebx
+  800fd1:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800fd4:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800fdb:	78 36                	js     801013 <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  800fdd:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800fe4:	74 79                	je     80105f <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  800fe6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fee:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ff3:	89 cb                	mov    %ecx,%ebx
+  800ff5:	89 cf                	mov    %ecx,%edi
+  800ff7:	89 ce                	mov    %ecx,%esi
+  800ff9:	55                   	push   %ebp
+  800ffa:	68 03 10 80 00       	push   $0x801003
+  800fff:	89 e5                	mov    %esp,%ebp
+  801001:	0f 34                	sysenter
+  801003:	83 c4 04             	add    $0x4,%esp
+  801006:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801007:	85 c0                	test   %eax,%eax
+  801009:	7f 6b                	jg     801076 <sys_env_destroy+0xab>
+}
+  80100b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80100e:	5b                   	pop    %ebx
+  80100f:	5e                   	pop    %esi
+  801010:	5f                   	pop    %edi
+  801011:	5d                   	pop    %ebp
+  801012:	c3                   	ret
+  801013:	b8 01 00 00 00       	mov    $0x1,%eax
+  801018:	0f a2                	cpuid
+		return 0;
+  80101a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80101f:	f6 c6 08             	test   $0x8,%dh
+  801022:	74 15                	je     801039 <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801024:	89 c2                	mov    %eax,%edx
+  801026:	c1 ea 08             	shr    $0x8,%edx
+  801029:	83 e2 0f             	and    $0xf,%edx
+  80102c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801031:	83 fa 06             	cmp    $0x6,%edx
+  801034:	74 0e                	je     801044 <sys_env_destroy+0x79>
+  801036:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801039:	0f b6 c9             	movzbl %cl,%ecx
+  80103c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801042:	eb 99                	jmp    800fdd <sys_env_destroy+0x12>
+  801044:	89 c2                	mov    %eax,%edx
+  801046:	c1 ea 04             	shr    $0x4,%edx
+  801049:	83 e2 0f             	and    $0xf,%edx
+  80104c:	83 fa 02             	cmp    $0x2,%edx
+  80104f:	77 e5                	ja     801036 <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  801051:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801054:	83 f8 02             	cmp    $0x2,%eax
+  801057:	0f 97 c1             	seta   %cl
+  80105a:	0f b6 c9             	movzbl %cl,%ecx
+  80105d:	eb d7                	jmp    801036 <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  80105f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801064:	b8 03 00 00 00       	mov    $0x3,%eax
+  801069:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106c:	89 cb                	mov    %ecx,%ebx
+  80106e:	89 cf                	mov    %ecx,%edi
+  801070:	89 ce                	mov    %ecx,%esi
+  801072:	cd 30                	int    $0x30
+  801074:	eb 91                	jmp    801007 <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801076:	83 ec 0c             	sub    $0xc,%esp
+  801079:	50                   	push   %eax
+  80107a:	6a 03                	push   $0x3
+  80107c:	68 79 33 80 00       	push   $0x803379
+  801081:	6a 4a                	push   $0x4a
+  801083:	68 96 33 80 00       	push   $0x803396
+  801088:	e8 68 f1 ff ff       	call   8001f5 <_panic>
+
+0080108d <sys_getenvid>:
+{
+  80108d:	55                   	push   %ebp
+  80108e:	89 e5                	mov    %esp,%ebp
+  801090:	57                   	push   %edi
+  801091:	56                   	push   %esi
+  801092:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801093:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80109a:	78 2e                	js     8010ca <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  80109c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8010a3:	74 71                	je     801116 <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  8010a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010aa:	b8 02 00 00 00       	mov    $0x2,%eax
+  8010af:	89 d1                	mov    %edx,%ecx
+  8010b1:	89 d3                	mov    %edx,%ebx
+  8010b3:	89 d7                	mov    %edx,%edi
+  8010b5:	89 d6                	mov    %edx,%esi
+  8010b7:	55                   	push   %ebp
+  8010b8:	68 c1 10 80 00       	push   $0x8010c1
+  8010bd:	89 e5                	mov    %esp,%ebp
+  8010bf:	0f 34                	sysenter
+  8010c1:	83 c4 04             	add    $0x4,%esp
+  8010c4:	5d                   	pop    %ebp
+}
+  8010c5:	5b                   	pop    %ebx
+  8010c6:	5e                   	pop    %esi
+  8010c7:	5f                   	pop    %edi
+  8010c8:	5d                   	pop    %ebp
+  8010c9:	c3                   	ret
+  8010ca:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010cf:	0f a2                	cpuid
+		return 0;
+  8010d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8010d6:	f6 c6 08             	test   $0x8,%dh
+  8010d9:	74 15                	je     8010f0 <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010db:	89 c2                	mov    %eax,%edx
+  8010dd:	c1 ea 08             	shr    $0x8,%edx
+  8010e0:	83 e2 0f             	and    $0xf,%edx
+  8010e3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8010e8:	83 fa 06             	cmp    $0x6,%edx
+  8010eb:	74 0e                	je     8010fb <sys_getenvid+0x6e>
+  8010ed:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8010f0:	0f b6 c9             	movzbl %cl,%ecx
+  8010f3:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8010f9:	eb a1                	jmp    80109c <sys_getenvid+0xf>
+  8010fb:	89 c2                	mov    %eax,%edx
+  8010fd:	c1 ea 04             	shr    $0x4,%edx
+  801100:	83 e2 0f             	and    $0xf,%edx
+  801103:	83 fa 02             	cmp    $0x2,%edx
+  801106:	77 e5                	ja     8010ed <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  801108:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80110b:	83 f8 02             	cmp    $0x2,%eax
+  80110e:	0f 97 c1             	seta   %cl
+  801111:	0f b6 c9             	movzbl %cl,%ecx
+  801114:	eb d7                	jmp    8010ed <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  801116:	ba 00 00 00 00       	mov    $0x0,%edx
+  80111b:	b8 02 00 00 00       	mov    $0x2,%eax
+  801120:	89 d1                	mov    %edx,%ecx
+  801122:	89 d3                	mov    %edx,%ebx
+  801124:	89 d7                	mov    %edx,%edi
+  801126:	89 d6                	mov    %edx,%esi
+  801128:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80112a:	eb 99                	jmp    8010c5 <sys_getenvid+0x38>
+
+0080112c <sys_page_alloc>:
+{
+  80112c:	55                   	push   %ebp
+  80112d:	89 e5                	mov    %esp,%ebp
+  80112f:	57                   	push   %edi
+  801130:	56                   	push   %esi
+  801131:	53                   	push   %ebx
+  801132:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801135:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80113c:	78 38                	js     801176 <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  80113e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801145:	74 7b                	je     8011c2 <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  801147:	be 00 00 00 00       	mov    $0x0,%esi
+  80114c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801152:	b8 04 00 00 00       	mov    $0x4,%eax
+  801157:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80115a:	89 f7                	mov    %esi,%edi
+  80115c:	55                   	push   %ebp
+  80115d:	68 66 11 80 00       	push   $0x801166
+  801162:	89 e5                	mov    %esp,%ebp
+  801164:	0f 34                	sysenter
+  801166:	83 c4 04             	add    $0x4,%esp
+  801169:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80116a:	85 c0                	test   %eax,%eax
+  80116c:	7f 6d                	jg     8011db <sys_page_alloc+0xaf>
+}
+  80116e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801171:	5b                   	pop    %ebx
+  801172:	5e                   	pop    %esi
+  801173:	5f                   	pop    %edi
+  801174:	5d                   	pop    %ebp
+  801175:	c3                   	ret
+  801176:	b8 01 00 00 00       	mov    $0x1,%eax
+  80117b:	0f a2                	cpuid
+		return 0;
+  80117d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801182:	f6 c6 08             	test   $0x8,%dh
+  801185:	74 15                	je     80119c <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801187:	89 c2                	mov    %eax,%edx
+  801189:	c1 ea 08             	shr    $0x8,%edx
+  80118c:	83 e2 0f             	and    $0xf,%edx
+  80118f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801194:	83 fa 06             	cmp    $0x6,%edx
+  801197:	74 0e                	je     8011a7 <sys_page_alloc+0x7b>
+  801199:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80119c:	0f b6 c9             	movzbl %cl,%ecx
+  80119f:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8011a5:	eb 97                	jmp    80113e <sys_page_alloc+0x12>
+  8011a7:	89 c2                	mov    %eax,%edx
+  8011a9:	c1 ea 04             	shr    $0x4,%edx
+  8011ac:	83 e2 0f             	and    $0xf,%edx
+  8011af:	83 fa 02             	cmp    $0x2,%edx
+  8011b2:	77 e5                	ja     801199 <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  8011b4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011b7:	83 f8 02             	cmp    $0x2,%eax
+  8011ba:	0f 97 c1             	seta   %cl
+  8011bd:	0f b6 c9             	movzbl %cl,%ecx
+  8011c0:	eb d7                	jmp    801199 <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  8011c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c7:	b8 04 00 00 00       	mov    $0x4,%eax
+  8011cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011d5:	89 f7                	mov    %esi,%edi
+  8011d7:	cd 30                	int    $0x30
+  8011d9:	eb 8f                	jmp    80116a <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011db:	83 ec 0c             	sub    $0xc,%esp
+  8011de:	50                   	push   %eax
+  8011df:	6a 04                	push   $0x4
+  8011e1:	68 79 33 80 00       	push   $0x803379
+  8011e6:	6a 4a                	push   $0x4a
+  8011e8:	68 96 33 80 00       	push   $0x803396
+  8011ed:	e8 03 f0 ff ff       	call   8001f5 <_panic>
+
+008011f2 <sys_page_map>:
+{
+  8011f2:	55                   	push   %ebp
+  8011f3:	89 e5                	mov    %esp,%ebp
+  8011f5:	57                   	push   %edi
+  8011f6:	56                   	push   %esi
+  8011f7:	53                   	push   %ebx
+  8011f8:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8011fb:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801202:	78 37                	js     80123b <sys_page_map+0x49>
+	if (syscall_sysenter)
+  801204:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80120b:	74 7a                	je     801287 <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  80120d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801210:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801213:	b8 05 00 00 00       	mov    $0x5,%eax
+  801218:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80121b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80121e:	8b 75 18             	mov    0x18(%ebp),%esi
+  801221:	55                   	push   %ebp
+  801222:	68 2b 12 80 00       	push   $0x80122b
+  801227:	89 e5                	mov    %esp,%ebp
+  801229:	0f 34                	sysenter
+  80122b:	83 c4 04             	add    $0x4,%esp
+  80122e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80122f:	85 c0                	test   %eax,%eax
+  801231:	7f 6c                	jg     80129f <sys_page_map+0xad>
+}
+  801233:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801236:	5b                   	pop    %ebx
+  801237:	5e                   	pop    %esi
+  801238:	5f                   	pop    %edi
+  801239:	5d                   	pop    %ebp
+  80123a:	c3                   	ret
+  80123b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801240:	0f a2                	cpuid
+		return 0;
+  801242:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801247:	f6 c6 08             	test   $0x8,%dh
+  80124a:	74 15                	je     801261 <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80124c:	89 c2                	mov    %eax,%edx
+  80124e:	c1 ea 08             	shr    $0x8,%edx
+  801251:	83 e2 0f             	and    $0xf,%edx
+  801254:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801259:	83 fa 06             	cmp    $0x6,%edx
+  80125c:	74 0e                	je     80126c <sys_page_map+0x7a>
+  80125e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801261:	0f b6 c9             	movzbl %cl,%ecx
+  801264:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80126a:	eb 98                	jmp    801204 <sys_page_map+0x12>
+  80126c:	89 c2                	mov    %eax,%edx
+  80126e:	c1 ea 04             	shr    $0x4,%edx
+  801271:	83 e2 0f             	and    $0xf,%edx
+  801274:	83 fa 02             	cmp    $0x2,%edx
+  801277:	77 e5                	ja     80125e <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  801279:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80127c:	83 f8 02             	cmp    $0x2,%eax
+  80127f:	0f 97 c1             	seta   %cl
+  801282:	0f b6 c9             	movzbl %cl,%ecx
+  801285:	eb d7                	jmp    80125e <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  801287:	b8 05 00 00 00       	mov    $0x5,%eax
+  80128c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80128f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801292:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801295:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801298:	8b 75 18             	mov    0x18(%ebp),%esi
+  80129b:	cd 30                	int    $0x30
+  80129d:	eb 90                	jmp    80122f <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80129f:	83 ec 0c             	sub    $0xc,%esp
+  8012a2:	50                   	push   %eax
+  8012a3:	6a 05                	push   $0x5
+  8012a5:	68 79 33 80 00       	push   $0x803379
+  8012aa:	6a 4a                	push   $0x4a
+  8012ac:	68 96 33 80 00       	push   $0x803396
+  8012b1:	e8 3f ef ff ff       	call   8001f5 <_panic>
+
+008012b6 <sys_page_unmap>:
+{
+  8012b6:	55                   	push   %ebp
+  8012b7:	89 e5                	mov    %esp,%ebp
+  8012b9:	57                   	push   %edi
+  8012ba:	56                   	push   %esi
+  8012bb:	53                   	push   %ebx
+  8012bc:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8012bf:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8012c6:	78 37                	js     8012ff <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  8012c8:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8012cf:	74 7a                	je     80134b <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  8012d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012dc:	b8 06 00 00 00       	mov    $0x6,%eax
+  8012e1:	89 df                	mov    %ebx,%edi
+  8012e3:	89 de                	mov    %ebx,%esi
+  8012e5:	55                   	push   %ebp
+  8012e6:	68 ef 12 80 00       	push   $0x8012ef
+  8012eb:	89 e5                	mov    %esp,%ebp
+  8012ed:	0f 34                	sysenter
+  8012ef:	83 c4 04             	add    $0x4,%esp
+  8012f2:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8012f3:	85 c0                	test   %eax,%eax
+  8012f5:	7f 6c                	jg     801363 <sys_page_unmap+0xad>
+}
+  8012f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012fa:	5b                   	pop    %ebx
+  8012fb:	5e                   	pop    %esi
+  8012fc:	5f                   	pop    %edi
+  8012fd:	5d                   	pop    %ebp
+  8012fe:	c3                   	ret
+  8012ff:	b8 01 00 00 00       	mov    $0x1,%eax
+  801304:	0f a2                	cpuid
+		return 0;
+  801306:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80130b:	f6 c6 08             	test   $0x8,%dh
+  80130e:	74 15                	je     801325 <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801310:	89 c2                	mov    %eax,%edx
+  801312:	c1 ea 08             	shr    $0x8,%edx
+  801315:	83 e2 0f             	and    $0xf,%edx
+  801318:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80131d:	83 fa 06             	cmp    $0x6,%edx
+  801320:	74 0e                	je     801330 <sys_page_unmap+0x7a>
+  801322:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801325:	0f b6 c9             	movzbl %cl,%ecx
+  801328:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80132e:	eb 98                	jmp    8012c8 <sys_page_unmap+0x12>
+  801330:	89 c2                	mov    %eax,%edx
+  801332:	c1 ea 04             	shr    $0x4,%edx
+  801335:	83 e2 0f             	and    $0xf,%edx
+  801338:	83 fa 02             	cmp    $0x2,%edx
+  80133b:	77 e5                	ja     801322 <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  80133d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801340:	83 f8 02             	cmp    $0x2,%eax
+  801343:	0f 97 c1             	seta   %cl
+  801346:	0f b6 c9             	movzbl %cl,%ecx
+  801349:	eb d7                	jmp    801322 <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  80134b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801350:	b8 06 00 00 00       	mov    $0x6,%eax
+  801355:	8b 55 08             	mov    0x8(%ebp),%edx
+  801358:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80135b:	89 df                	mov    %ebx,%edi
+  80135d:	89 de                	mov    %ebx,%esi
+  80135f:	cd 30                	int    $0x30
+  801361:	eb 90                	jmp    8012f3 <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801363:	83 ec 0c             	sub    $0xc,%esp
+  801366:	50                   	push   %eax
+  801367:	6a 06                	push   $0x6
+  801369:	68 79 33 80 00       	push   $0x803379
+  80136e:	6a 4a                	push   $0x4a
+  801370:	68 96 33 80 00       	push   $0x803396
+  801375:	e8 7b ee ff ff       	call   8001f5 <_panic>
+
+0080137a <sys_page_copy>:
+{
+  80137a:	55                   	push   %ebp
+  80137b:	89 e5                	mov    %esp,%ebp
+  80137d:	57                   	push   %edi
+  80137e:	56                   	push   %esi
+  80137f:	53                   	push   %ebx
+  801380:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801383:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80138a:	78 37                	js     8013c3 <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  80138c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801393:	74 7a                	je     80140f <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  801395:	8b 55 08             	mov    0x8(%ebp),%edx
+  801398:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80139b:	b8 29 00 00 00       	mov    $0x29,%eax
+  8013a0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013a3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013a6:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013a9:	55                   	push   %ebp
+  8013aa:	68 b3 13 80 00       	push   $0x8013b3
+  8013af:	89 e5                	mov    %esp,%ebp
+  8013b1:	0f 34                	sysenter
+  8013b3:	83 c4 04             	add    $0x4,%esp
+  8013b6:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8013b7:	85 c0                	test   %eax,%eax
+  8013b9:	7f 6c                	jg     801427 <sys_page_copy+0xad>
+}
+  8013bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013be:	5b                   	pop    %ebx
+  8013bf:	5e                   	pop    %esi
+  8013c0:	5f                   	pop    %edi
+  8013c1:	5d                   	pop    %ebp
+  8013c2:	c3                   	ret
+  8013c3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013c8:	0f a2                	cpuid
+		return 0;
+  8013ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8013cf:	f6 c6 08             	test   $0x8,%dh
+  8013d2:	74 15                	je     8013e9 <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013d4:	89 c2                	mov    %eax,%edx
+  8013d6:	c1 ea 08             	shr    $0x8,%edx
+  8013d9:	83 e2 0f             	and    $0xf,%edx
+  8013dc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8013e1:	83 fa 06             	cmp    $0x6,%edx
+  8013e4:	74 0e                	je     8013f4 <sys_page_copy+0x7a>
+  8013e6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8013e9:	0f b6 c9             	movzbl %cl,%ecx
+  8013ec:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8013f2:	eb 98                	jmp    80138c <sys_page_copy+0x12>
+  8013f4:	89 c2                	mov    %eax,%edx
+  8013f6:	c1 ea 04             	shr    $0x4,%edx
+  8013f9:	83 e2 0f             	and    $0xf,%edx
+  8013fc:	83 fa 02             	cmp    $0x2,%edx
+  8013ff:	77 e5                	ja     8013e6 <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  801401:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801404:	83 f8 02             	cmp    $0x2,%eax
+  801407:	0f 97 c1             	seta   %cl
+  80140a:	0f b6 c9             	movzbl %cl,%ecx
+  80140d:	eb d7                	jmp    8013e6 <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  80140f:	b8 29 00 00 00       	mov    $0x29,%eax
+  801414:	8b 55 08             	mov    0x8(%ebp),%edx
+  801417:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80141a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80141d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801420:	8b 75 18             	mov    0x18(%ebp),%esi
+  801423:	cd 30                	int    $0x30
+  801425:	eb 90                	jmp    8013b7 <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801427:	83 ec 0c             	sub    $0xc,%esp
+  80142a:	50                   	push   %eax
+  80142b:	6a 29                	push   $0x29
+  80142d:	68 79 33 80 00       	push   $0x803379
+  801432:	6a 4a                	push   $0x4a
+  801434:	68 96 33 80 00       	push   $0x803396
+  801439:	e8 b7 ed ff ff       	call   8001f5 <_panic>
+
+0080143e <sys_yield>:
+{
+  80143e:	55                   	push   %ebp
+  80143f:	89 e5                	mov    %esp,%ebp
+  801441:	57                   	push   %edi
+  801442:	56                   	push   %esi
+  801443:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801444:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80144b:	78 2e                	js     80147b <sys_yield+0x3d>
+	if (syscall_sysenter)
+  80144d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801454:	74 71                	je     8014c7 <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  801456:	ba 00 00 00 00       	mov    $0x0,%edx
+  80145b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801460:	89 d1                	mov    %edx,%ecx
+  801462:	89 d3                	mov    %edx,%ebx
+  801464:	89 d7                	mov    %edx,%edi
+  801466:	89 d6                	mov    %edx,%esi
+  801468:	55                   	push   %ebp
+  801469:	68 72 14 80 00       	push   $0x801472
+  80146e:	89 e5                	mov    %esp,%ebp
+  801470:	0f 34                	sysenter
+  801472:	83 c4 04             	add    $0x4,%esp
+  801475:	5d                   	pop    %ebp
+}
+  801476:	5b                   	pop    %ebx
+  801477:	5e                   	pop    %esi
+  801478:	5f                   	pop    %edi
+  801479:	5d                   	pop    %ebp
+  80147a:	c3                   	ret
+  80147b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801480:	0f a2                	cpuid
+		return 0;
+  801482:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801487:	f6 c6 08             	test   $0x8,%dh
+  80148a:	74 15                	je     8014a1 <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80148c:	89 c2                	mov    %eax,%edx
+  80148e:	c1 ea 08             	shr    $0x8,%edx
+  801491:	83 e2 0f             	and    $0xf,%edx
+  801494:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801499:	83 fa 06             	cmp    $0x6,%edx
+  80149c:	74 0e                	je     8014ac <sys_yield+0x6e>
+  80149e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8014a1:	0f b6 c9             	movzbl %cl,%ecx
+  8014a4:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8014aa:	eb a1                	jmp    80144d <sys_yield+0xf>
+  8014ac:	89 c2                	mov    %eax,%edx
+  8014ae:	c1 ea 04             	shr    $0x4,%edx
+  8014b1:	83 e2 0f             	and    $0xf,%edx
+  8014b4:	83 fa 02             	cmp    $0x2,%edx
+  8014b7:	77 e5                	ja     80149e <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  8014b9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014bc:	83 f8 02             	cmp    $0x2,%eax
+  8014bf:	0f 97 c1             	seta   %cl
+  8014c2:	0f b6 c9             	movzbl %cl,%ecx
+  8014c5:	eb d7                	jmp    80149e <sys_yield+0x60>
+		asm volatile("int %1\n"
+  8014c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014cc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8014d1:	89 d1                	mov    %edx,%ecx
+  8014d3:	89 d3                	mov    %edx,%ebx
+  8014d5:	89 d7                	mov    %edx,%edi
+  8014d7:	89 d6                	mov    %edx,%esi
+  8014d9:	cd 30                	int    $0x30
+}
+  8014db:	eb 99                	jmp    801476 <sys_yield+0x38>
+
+008014dd <sys_env_set_status>:
+{
+  8014dd:	55                   	push   %ebp
+  8014de:	89 e5                	mov    %esp,%ebp
+  8014e0:	57                   	push   %edi
+  8014e1:	56                   	push   %esi
+  8014e2:	53                   	push   %ebx
+  8014e3:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8014e6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8014ed:	78 37                	js     801526 <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  8014ef:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8014f6:	74 7a                	je     801572 <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  8014f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801500:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801503:	b8 08 00 00 00       	mov    $0x8,%eax
+  801508:	89 df                	mov    %ebx,%edi
+  80150a:	89 de                	mov    %ebx,%esi
+  80150c:	55                   	push   %ebp
+  80150d:	68 16 15 80 00       	push   $0x801516
+  801512:	89 e5                	mov    %esp,%ebp
+  801514:	0f 34                	sysenter
+  801516:	83 c4 04             	add    $0x4,%esp
+  801519:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80151a:	85 c0                	test   %eax,%eax
+  80151c:	7f 6c                	jg     80158a <sys_env_set_status+0xad>
+}
+  80151e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801521:	5b                   	pop    %ebx
+  801522:	5e                   	pop    %esi
+  801523:	5f                   	pop    %edi
+  801524:	5d                   	pop    %ebp
+  801525:	c3                   	ret
+  801526:	b8 01 00 00 00       	mov    $0x1,%eax
+  80152b:	0f a2                	cpuid
+		return 0;
+  80152d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801532:	f6 c6 08             	test   $0x8,%dh
+  801535:	74 15                	je     80154c <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801537:	89 c2                	mov    %eax,%edx
+  801539:	c1 ea 08             	shr    $0x8,%edx
+  80153c:	83 e2 0f             	and    $0xf,%edx
+  80153f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801544:	83 fa 06             	cmp    $0x6,%edx
+  801547:	74 0e                	je     801557 <sys_env_set_status+0x7a>
+  801549:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80154c:	0f b6 c9             	movzbl %cl,%ecx
+  80154f:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801555:	eb 98                	jmp    8014ef <sys_env_set_status+0x12>
+  801557:	89 c2                	mov    %eax,%edx
+  801559:	c1 ea 04             	shr    $0x4,%edx
+  80155c:	83 e2 0f             	and    $0xf,%edx
+  80155f:	83 fa 02             	cmp    $0x2,%edx
+  801562:	77 e5                	ja     801549 <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  801564:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801567:	83 f8 02             	cmp    $0x2,%eax
+  80156a:	0f 97 c1             	seta   %cl
+  80156d:	0f b6 c9             	movzbl %cl,%ecx
+  801570:	eb d7                	jmp    801549 <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  801572:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801577:	b8 08 00 00 00       	mov    $0x8,%eax
+  80157c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80157f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801582:	89 df                	mov    %ebx,%edi
+  801584:	89 de                	mov    %ebx,%esi
+  801586:	cd 30                	int    $0x30
+  801588:	eb 90                	jmp    80151a <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80158a:	83 ec 0c             	sub    $0xc,%esp
+  80158d:	50                   	push   %eax
+  80158e:	6a 08                	push   $0x8
+  801590:	68 79 33 80 00       	push   $0x803379
+  801595:	6a 4a                	push   $0x4a
+  801597:	68 96 33 80 00       	push   $0x803396
+  80159c:	e8 54 ec ff ff       	call   8001f5 <_panic>
+
+008015a1 <sys_sysinfo>:
+{
+  8015a1:	55                   	push   %ebp
+  8015a2:	89 e5                	mov    %esp,%ebp
+  8015a4:	57                   	push   %edi
+  8015a5:	56                   	push   %esi
+  8015a6:	53                   	push   %ebx
+  8015a7:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8015aa:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8015b1:	78 36                	js     8015e9 <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  8015b3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8015ba:	74 79                	je     801635 <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  8015bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015c4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8015c9:	89 cb                	mov    %ecx,%ebx
+  8015cb:	89 cf                	mov    %ecx,%edi
+  8015cd:	89 ce                	mov    %ecx,%esi
+  8015cf:	55                   	push   %ebp
+  8015d0:	68 d9 15 80 00       	push   $0x8015d9
+  8015d5:	89 e5                	mov    %esp,%ebp
+  8015d7:	0f 34                	sysenter
+  8015d9:	83 c4 04             	add    $0x4,%esp
+  8015dc:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8015dd:	85 c0                	test   %eax,%eax
+  8015df:	7f 6b                	jg     80164c <sys_sysinfo+0xab>
+}
+  8015e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015e4:	5b                   	pop    %ebx
+  8015e5:	5e                   	pop    %esi
+  8015e6:	5f                   	pop    %edi
+  8015e7:	5d                   	pop    %ebp
+  8015e8:	c3                   	ret
+  8015e9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015ee:	0f a2                	cpuid
+		return 0;
+  8015f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8015f5:	f6 c6 08             	test   $0x8,%dh
+  8015f8:	74 15                	je     80160f <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015fa:	89 c2                	mov    %eax,%edx
+  8015fc:	c1 ea 08             	shr    $0x8,%edx
+  8015ff:	83 e2 0f             	and    $0xf,%edx
+  801602:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801607:	83 fa 06             	cmp    $0x6,%edx
+  80160a:	74 0e                	je     80161a <sys_sysinfo+0x79>
+  80160c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80160f:	0f b6 c9             	movzbl %cl,%ecx
+  801612:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801618:	eb 99                	jmp    8015b3 <sys_sysinfo+0x12>
+  80161a:	89 c2                	mov    %eax,%edx
+  80161c:	c1 ea 04             	shr    $0x4,%edx
+  80161f:	83 e2 0f             	and    $0xf,%edx
+  801622:	83 fa 02             	cmp    $0x2,%edx
+  801625:	77 e5                	ja     80160c <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  801627:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80162a:	83 f8 02             	cmp    $0x2,%eax
+  80162d:	0f 97 c1             	seta   %cl
+  801630:	0f b6 c9             	movzbl %cl,%ecx
+  801633:	eb d7                	jmp    80160c <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  801635:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80163a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80163f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801642:	89 cb                	mov    %ecx,%ebx
+  801644:	89 cf                	mov    %ecx,%edi
+  801646:	89 ce                	mov    %ecx,%esi
+  801648:	cd 30                	int    $0x30
+  80164a:	eb 91                	jmp    8015dd <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80164c:	83 ec 0c             	sub    $0xc,%esp
+  80164f:	50                   	push   %eax
+  801650:	6a 0b                	push   $0xb
+  801652:	68 79 33 80 00       	push   $0x803379
+  801657:	6a 4a                	push   $0x4a
+  801659:	68 96 33 80 00       	push   $0x803396
+  80165e:	e8 92 eb ff ff       	call   8001f5 <_panic>
+
+00801663 <sys_env_set_trapframe>:
+{
+  801663:	55                   	push   %ebp
+  801664:	89 e5                	mov    %esp,%ebp
+  801666:	57                   	push   %edi
+  801667:	56                   	push   %esi
+  801668:	53                   	push   %ebx
+  801669:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80166c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801673:	78 37                	js     8016ac <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  801675:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80167c:	74 7a                	je     8016f8 <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  80167e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801683:	8b 55 08             	mov    0x8(%ebp),%edx
+  801686:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801689:	b8 13 00 00 00       	mov    $0x13,%eax
+  80168e:	89 df                	mov    %ebx,%edi
+  801690:	89 de                	mov    %ebx,%esi
+  801692:	55                   	push   %ebp
+  801693:	68 9c 16 80 00       	push   $0x80169c
+  801698:	89 e5                	mov    %esp,%ebp
+  80169a:	0f 34                	sysenter
+  80169c:	83 c4 04             	add    $0x4,%esp
+  80169f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8016a0:	85 c0                	test   %eax,%eax
+  8016a2:	7f 6c                	jg     801710 <sys_env_set_trapframe+0xad>
+}
+  8016a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016a7:	5b                   	pop    %ebx
+  8016a8:	5e                   	pop    %esi
+  8016a9:	5f                   	pop    %edi
+  8016aa:	5d                   	pop    %ebp
+  8016ab:	c3                   	ret
+  8016ac:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016b1:	0f a2                	cpuid
+		return 0;
+  8016b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8016b8:	f6 c6 08             	test   $0x8,%dh
+  8016bb:	74 15                	je     8016d2 <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016bd:	89 c2                	mov    %eax,%edx
+  8016bf:	c1 ea 08             	shr    $0x8,%edx
+  8016c2:	83 e2 0f             	and    $0xf,%edx
+  8016c5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8016ca:	83 fa 06             	cmp    $0x6,%edx
+  8016cd:	74 0e                	je     8016dd <sys_env_set_trapframe+0x7a>
+  8016cf:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8016d2:	0f b6 c9             	movzbl %cl,%ecx
+  8016d5:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8016db:	eb 98                	jmp    801675 <sys_env_set_trapframe+0x12>
+  8016dd:	89 c2                	mov    %eax,%edx
+  8016df:	c1 ea 04             	shr    $0x4,%edx
+  8016e2:	83 e2 0f             	and    $0xf,%edx
+  8016e5:	83 fa 02             	cmp    $0x2,%edx
+  8016e8:	77 e5                	ja     8016cf <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  8016ea:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016ed:	83 f8 02             	cmp    $0x2,%eax
+  8016f0:	0f 97 c1             	seta   %cl
+  8016f3:	0f b6 c9             	movzbl %cl,%ecx
+  8016f6:	eb d7                	jmp    8016cf <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  8016f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016fd:	b8 13 00 00 00       	mov    $0x13,%eax
+  801702:	8b 55 08             	mov    0x8(%ebp),%edx
+  801705:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801708:	89 df                	mov    %ebx,%edi
+  80170a:	89 de                	mov    %ebx,%esi
+  80170c:	cd 30                	int    $0x30
+  80170e:	eb 90                	jmp    8016a0 <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801710:	83 ec 0c             	sub    $0xc,%esp
+  801713:	50                   	push   %eax
+  801714:	6a 13                	push   $0x13
+  801716:	68 79 33 80 00       	push   $0x803379
+  80171b:	6a 4a                	push   $0x4a
+  80171d:	68 96 33 80 00       	push   $0x803396
+  801722:	e8 ce ea ff ff       	call   8001f5 <_panic>
+
+00801727 <sys_env_set_stack_limit>:
+{
+  801727:	55                   	push   %ebp
+  801728:	89 e5                	mov    %esp,%ebp
+  80172a:	57                   	push   %edi
+  80172b:	56                   	push   %esi
+  80172c:	53                   	push   %ebx
+  80172d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801730:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801737:	78 37                	js     801770 <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  801739:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801740:	74 7a                	je     8017bc <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  801742:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801747:	8b 55 08             	mov    0x8(%ebp),%edx
+  80174a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80174d:	b8 19 00 00 00       	mov    $0x19,%eax
+  801752:	89 df                	mov    %ebx,%edi
+  801754:	89 de                	mov    %ebx,%esi
+  801756:	55                   	push   %ebp
+  801757:	68 60 17 80 00       	push   $0x801760
+  80175c:	89 e5                	mov    %esp,%ebp
+  80175e:	0f 34                	sysenter
+  801760:	83 c4 04             	add    $0x4,%esp
+  801763:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801764:	85 c0                	test   %eax,%eax
+  801766:	7f 6c                	jg     8017d4 <sys_env_set_stack_limit+0xad>
+}
+  801768:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80176b:	5b                   	pop    %ebx
+  80176c:	5e                   	pop    %esi
+  80176d:	5f                   	pop    %edi
+  80176e:	5d                   	pop    %ebp
+  80176f:	c3                   	ret
+  801770:	b8 01 00 00 00       	mov    $0x1,%eax
+  801775:	0f a2                	cpuid
+		return 0;
+  801777:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80177c:	f6 c6 08             	test   $0x8,%dh
+  80177f:	74 15                	je     801796 <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801781:	89 c2                	mov    %eax,%edx
+  801783:	c1 ea 08             	shr    $0x8,%edx
+  801786:	83 e2 0f             	and    $0xf,%edx
+  801789:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80178e:	83 fa 06             	cmp    $0x6,%edx
+  801791:	74 0e                	je     8017a1 <sys_env_set_stack_limit+0x7a>
+  801793:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801796:	0f b6 c9             	movzbl %cl,%ecx
+  801799:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80179f:	eb 98                	jmp    801739 <sys_env_set_stack_limit+0x12>
+  8017a1:	89 c2                	mov    %eax,%edx
+  8017a3:	c1 ea 04             	shr    $0x4,%edx
+  8017a6:	83 e2 0f             	and    $0xf,%edx
+  8017a9:	83 fa 02             	cmp    $0x2,%edx
+  8017ac:	77 e5                	ja     801793 <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  8017ae:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017b1:	83 f8 02             	cmp    $0x2,%eax
+  8017b4:	0f 97 c1             	seta   %cl
+  8017b7:	0f b6 c9             	movzbl %cl,%ecx
+  8017ba:	eb d7                	jmp    801793 <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  8017bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017c1:	b8 19 00 00 00       	mov    $0x19,%eax
+  8017c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017cc:	89 df                	mov    %ebx,%edi
+  8017ce:	89 de                	mov    %ebx,%esi
+  8017d0:	cd 30                	int    $0x30
+  8017d2:	eb 90                	jmp    801764 <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017d4:	83 ec 0c             	sub    $0xc,%esp
+  8017d7:	50                   	push   %eax
+  8017d8:	6a 19                	push   $0x19
+  8017da:	68 79 33 80 00       	push   $0x803379
+  8017df:	6a 4a                	push   $0x4a
+  8017e1:	68 96 33 80 00       	push   $0x803396
+  8017e6:	e8 0a ea ff ff       	call   8001f5 <_panic>
+
+008017eb <sys_env_set_pgfault_upcall>:
+{
+  8017eb:	55                   	push   %ebp
+  8017ec:	89 e5                	mov    %esp,%ebp
+  8017ee:	57                   	push   %edi
+  8017ef:	56                   	push   %esi
+  8017f0:	53                   	push   %ebx
+  8017f1:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8017f4:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8017fb:	78 37                	js     801834 <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  8017fd:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801804:	74 7a                	je     801880 <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  801806:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80180b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80180e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801811:	b8 09 00 00 00       	mov    $0x9,%eax
+  801816:	89 df                	mov    %ebx,%edi
+  801818:	89 de                	mov    %ebx,%esi
+  80181a:	55                   	push   %ebp
+  80181b:	68 24 18 80 00       	push   $0x801824
+  801820:	89 e5                	mov    %esp,%ebp
+  801822:	0f 34                	sysenter
+  801824:	83 c4 04             	add    $0x4,%esp
+  801827:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801828:	85 c0                	test   %eax,%eax
+  80182a:	7f 6c                	jg     801898 <sys_env_set_pgfault_upcall+0xad>
+}
+  80182c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80182f:	5b                   	pop    %ebx
+  801830:	5e                   	pop    %esi
+  801831:	5f                   	pop    %edi
+  801832:	5d                   	pop    %ebp
+  801833:	c3                   	ret
+  801834:	b8 01 00 00 00       	mov    $0x1,%eax
+  801839:	0f a2                	cpuid
+		return 0;
+  80183b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801840:	f6 c6 08             	test   $0x8,%dh
+  801843:	74 15                	je     80185a <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801845:	89 c2                	mov    %eax,%edx
+  801847:	c1 ea 08             	shr    $0x8,%edx
+  80184a:	83 e2 0f             	and    $0xf,%edx
+  80184d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801852:	83 fa 06             	cmp    $0x6,%edx
+  801855:	74 0e                	je     801865 <sys_env_set_pgfault_upcall+0x7a>
+  801857:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80185a:	0f b6 c9             	movzbl %cl,%ecx
+  80185d:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801863:	eb 98                	jmp    8017fd <sys_env_set_pgfault_upcall+0x12>
+  801865:	89 c2                	mov    %eax,%edx
+  801867:	c1 ea 04             	shr    $0x4,%edx
+  80186a:	83 e2 0f             	and    $0xf,%edx
+  80186d:	83 fa 02             	cmp    $0x2,%edx
+  801870:	77 e5                	ja     801857 <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  801872:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801875:	83 f8 02             	cmp    $0x2,%eax
+  801878:	0f 97 c1             	seta   %cl
+  80187b:	0f b6 c9             	movzbl %cl,%ecx
+  80187e:	eb d7                	jmp    801857 <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  801880:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801885:	b8 09 00 00 00       	mov    $0x9,%eax
+  80188a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80188d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801890:	89 df                	mov    %ebx,%edi
+  801892:	89 de                	mov    %ebx,%esi
+  801894:	cd 30                	int    $0x30
+  801896:	eb 90                	jmp    801828 <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801898:	83 ec 0c             	sub    $0xc,%esp
+  80189b:	50                   	push   %eax
+  80189c:	6a 09                	push   $0x9
+  80189e:	68 79 33 80 00       	push   $0x803379
+  8018a3:	6a 4a                	push   $0x4a
+  8018a5:	68 96 33 80 00       	push   $0x803396
+  8018aa:	e8 46 e9 ff ff       	call   8001f5 <_panic>
+
+008018af <sys_ipc_try_send>:
+{
+  8018af:	55                   	push   %ebp
+  8018b0:	89 e5                	mov    %esp,%ebp
+  8018b2:	57                   	push   %edi
+  8018b3:	56                   	push   %esi
+  8018b4:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8018b5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8018bc:	78 32                	js     8018f0 <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  8018be:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8018c5:	74 75                	je     80193c <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  8018c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018cd:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8018d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8018d7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018da:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8018dd:	55                   	push   %ebp
+  8018de:	68 e7 18 80 00       	push   $0x8018e7
+  8018e3:	89 e5                	mov    %esp,%ebp
+  8018e5:	0f 34                	sysenter
+  8018e7:	83 c4 04             	add    $0x4,%esp
+  8018ea:	5d                   	pop    %ebp
+}
+  8018eb:	5b                   	pop    %ebx
+  8018ec:	5e                   	pop    %esi
+  8018ed:	5f                   	pop    %edi
+  8018ee:	5d                   	pop    %ebp
+  8018ef:	c3                   	ret
+  8018f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018f5:	0f a2                	cpuid
+		return 0;
+  8018f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018fc:	f6 c6 08             	test   $0x8,%dh
+  8018ff:	74 15                	je     801916 <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801901:	89 c2                	mov    %eax,%edx
+  801903:	c1 ea 08             	shr    $0x8,%edx
+  801906:	83 e2 0f             	and    $0xf,%edx
+  801909:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80190e:	83 fa 06             	cmp    $0x6,%edx
+  801911:	74 0e                	je     801921 <sys_ipc_try_send+0x72>
+  801913:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801916:	0f b6 c9             	movzbl %cl,%ecx
+  801919:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80191f:	eb 9d                	jmp    8018be <sys_ipc_try_send+0xf>
+  801921:	89 c2                	mov    %eax,%edx
+  801923:	c1 ea 04             	shr    $0x4,%edx
+  801926:	83 e2 0f             	and    $0xf,%edx
+  801929:	83 fa 02             	cmp    $0x2,%edx
+  80192c:	77 e5                	ja     801913 <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  80192e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801931:	83 f8 02             	cmp    $0x2,%eax
+  801934:	0f 97 c1             	seta   %cl
+  801937:	0f b6 c9             	movzbl %cl,%ecx
+  80193a:	eb d7                	jmp    801913 <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  80193c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801941:	be 00 00 00 00       	mov    $0x0,%esi
+  801946:	8b 55 08             	mov    0x8(%ebp),%edx
+  801949:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80194c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80194f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801952:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801954:	eb 95                	jmp    8018eb <sys_ipc_try_send+0x3c>
+
+00801956 <sys_ipc_send>:
+{
+  801956:	55                   	push   %ebp
+  801957:	89 e5                	mov    %esp,%ebp
+  801959:	57                   	push   %edi
+  80195a:	56                   	push   %esi
+  80195b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80195c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801963:	78 32                	js     801997 <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  801965:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80196c:	74 75                	je     8019e3 <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  80196e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801971:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801974:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801979:	be 00 00 00 00       	mov    $0x0,%esi
+  80197e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801981:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801984:	55                   	push   %ebp
+  801985:	68 8e 19 80 00       	push   $0x80198e
+  80198a:	89 e5                	mov    %esp,%ebp
+  80198c:	0f 34                	sysenter
+  80198e:	83 c4 04             	add    $0x4,%esp
+  801991:	5d                   	pop    %ebp
+}
+  801992:	5b                   	pop    %ebx
+  801993:	5e                   	pop    %esi
+  801994:	5f                   	pop    %edi
+  801995:	5d                   	pop    %ebp
+  801996:	c3                   	ret
+  801997:	b8 01 00 00 00       	mov    $0x1,%eax
+  80199c:	0f a2                	cpuid
+		return 0;
+  80199e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8019a3:	f6 c6 08             	test   $0x8,%dh
+  8019a6:	74 15                	je     8019bd <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019a8:	89 c2                	mov    %eax,%edx
+  8019aa:	c1 ea 08             	shr    $0x8,%edx
+  8019ad:	83 e2 0f             	and    $0xf,%edx
+  8019b0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019b5:	83 fa 06             	cmp    $0x6,%edx
+  8019b8:	74 0e                	je     8019c8 <sys_ipc_send+0x72>
+  8019ba:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8019bd:	0f b6 c9             	movzbl %cl,%ecx
+  8019c0:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8019c6:	eb 9d                	jmp    801965 <sys_ipc_send+0xf>
+  8019c8:	89 c2                	mov    %eax,%edx
+  8019ca:	c1 ea 04             	shr    $0x4,%edx
+  8019cd:	83 e2 0f             	and    $0xf,%edx
+  8019d0:	83 fa 02             	cmp    $0x2,%edx
+  8019d3:	77 e5                	ja     8019ba <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  8019d5:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019d8:	83 f8 02             	cmp    $0x2,%eax
+  8019db:	0f 97 c1             	seta   %cl
+  8019de:	0f b6 c9             	movzbl %cl,%ecx
+  8019e1:	eb d7                	jmp    8019ba <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  8019e3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8019e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8019ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019f3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019f6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8019f9:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  8019fb:	eb 95                	jmp    801992 <sys_ipc_send+0x3c>
+
+008019fd <sys_ipc_recv>:
+{
+  8019fd:	55                   	push   %ebp
+  8019fe:	89 e5                	mov    %esp,%ebp
+  801a00:	57                   	push   %edi
+  801a01:	56                   	push   %esi
+  801a02:	53                   	push   %ebx
+  801a03:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801a06:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a0d:	78 36                	js     801a45 <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  801a0f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a16:	74 79                	je     801a91 <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  801a18:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a1b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a20:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801a25:	89 cb                	mov    %ecx,%ebx
+  801a27:	89 cf                	mov    %ecx,%edi
+  801a29:	89 ce                	mov    %ecx,%esi
+  801a2b:	55                   	push   %ebp
+  801a2c:	68 35 1a 80 00       	push   $0x801a35
+  801a31:	89 e5                	mov    %esp,%ebp
+  801a33:	0f 34                	sysenter
+  801a35:	83 c4 04             	add    $0x4,%esp
+  801a38:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801a39:	85 c0                	test   %eax,%eax
+  801a3b:	7f 6b                	jg     801aa8 <sys_ipc_recv+0xab>
+}
+  801a3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a40:	5b                   	pop    %ebx
+  801a41:	5e                   	pop    %esi
+  801a42:	5f                   	pop    %edi
+  801a43:	5d                   	pop    %ebp
+  801a44:	c3                   	ret
+  801a45:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a4a:	0f a2                	cpuid
+		return 0;
+  801a4c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801a51:	f6 c6 08             	test   $0x8,%dh
+  801a54:	74 15                	je     801a6b <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a56:	89 c2                	mov    %eax,%edx
+  801a58:	c1 ea 08             	shr    $0x8,%edx
+  801a5b:	83 e2 0f             	and    $0xf,%edx
+  801a5e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a63:	83 fa 06             	cmp    $0x6,%edx
+  801a66:	74 0e                	je     801a76 <sys_ipc_recv+0x79>
+  801a68:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a6b:	0f b6 c9             	movzbl %cl,%ecx
+  801a6e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801a74:	eb 99                	jmp    801a0f <sys_ipc_recv+0x12>
+  801a76:	89 c2                	mov    %eax,%edx
+  801a78:	c1 ea 04             	shr    $0x4,%edx
+  801a7b:	83 e2 0f             	and    $0xf,%edx
+  801a7e:	83 fa 02             	cmp    $0x2,%edx
+  801a81:	77 e5                	ja     801a68 <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  801a83:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a86:	83 f8 02             	cmp    $0x2,%eax
+  801a89:	0f 97 c1             	seta   %cl
+  801a8c:	0f b6 c9             	movzbl %cl,%ecx
+  801a8f:	eb d7                	jmp    801a68 <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  801a91:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a96:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801a9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a9e:	89 cb                	mov    %ecx,%ebx
+  801aa0:	89 cf                	mov    %ecx,%edi
+  801aa2:	89 ce                	mov    %ecx,%esi
+  801aa4:	cd 30                	int    $0x30
+  801aa6:	eb 91                	jmp    801a39 <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801aa8:	83 ec 0c             	sub    $0xc,%esp
+  801aab:	50                   	push   %eax
+  801aac:	6a 0d                	push   $0xd
+  801aae:	68 79 33 80 00       	push   $0x803379
+  801ab3:	6a 4a                	push   $0x4a
+  801ab5:	68 96 33 80 00       	push   $0x803396
+  801aba:	e8 36 e7 ff ff       	call   8001f5 <_panic>
+
+00801abf <sys_ipc_send_range>:
+{
+  801abf:	55                   	push   %ebp
+  801ac0:	89 e5                	mov    %esp,%ebp
+  801ac2:	57                   	push   %edi
+  801ac3:	56                   	push   %esi
+  801ac4:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801ac5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801acc:	78 30                	js     801afe <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  801ace:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ad5:	74 73                	je     801b4a <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801ad7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ada:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801add:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801ae2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ae5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ae8:	8b 75 18             	mov    0x18(%ebp),%esi
+  801aeb:	55                   	push   %ebp
+  801aec:	68 f5 1a 80 00       	push   $0x801af5
+  801af1:	89 e5                	mov    %esp,%ebp
+  801af3:	0f 34                	sysenter
+  801af5:	83 c4 04             	add    $0x4,%esp
+  801af8:	5d                   	pop    %ebp
+}
+  801af9:	5b                   	pop    %ebx
+  801afa:	5e                   	pop    %esi
+  801afb:	5f                   	pop    %edi
+  801afc:	5d                   	pop    %ebp
+  801afd:	c3                   	ret
+  801afe:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b03:	0f a2                	cpuid
+		return 0;
+  801b05:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b0a:	f6 c6 08             	test   $0x8,%dh
+  801b0d:	74 15                	je     801b24 <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b0f:	89 c2                	mov    %eax,%edx
+  801b11:	c1 ea 08             	shr    $0x8,%edx
+  801b14:	83 e2 0f             	and    $0xf,%edx
+  801b17:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b1c:	83 fa 06             	cmp    $0x6,%edx
+  801b1f:	74 0e                	je     801b2f <sys_ipc_send_range+0x70>
+  801b21:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b24:	0f b6 c9             	movzbl %cl,%ecx
+  801b27:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801b2d:	eb 9f                	jmp    801ace <sys_ipc_send_range+0xf>
+  801b2f:	89 c2                	mov    %eax,%edx
+  801b31:	c1 ea 04             	shr    $0x4,%edx
+  801b34:	83 e2 0f             	and    $0xf,%edx
+  801b37:	83 fa 02             	cmp    $0x2,%edx
+  801b3a:	77 e5                	ja     801b21 <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  801b3c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b3f:	83 f8 02             	cmp    $0x2,%eax
+  801b42:	0f 97 c1             	seta   %cl
+  801b45:	0f b6 c9             	movzbl %cl,%ecx
+  801b48:	eb d7                	jmp    801b21 <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  801b4a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801b4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b52:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b55:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b58:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801b5b:	8b 75 18             	mov    0x18(%ebp),%esi
+  801b5e:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  801b60:	eb 97                	jmp    801af9 <sys_ipc_send_range+0x3a>
+
+00801b62 <sys_ipc_recv_range>:
+{
+  801b62:	55                   	push   %ebp
+  801b63:	89 e5                	mov    %esp,%ebp
+  801b65:	57                   	push   %edi
+  801b66:	56                   	push   %esi
+  801b67:	53                   	push   %ebx
+  801b68:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801b6b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b72:	78 37                	js     801bab <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  801b74:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b7b:	74 7a                	je     801bf7 <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  801b7d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b82:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b85:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b88:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801b8d:	89 df                	mov    %ebx,%edi
+  801b8f:	89 de                	mov    %ebx,%esi
+  801b91:	55                   	push   %ebp
+  801b92:	68 9b 1b 80 00       	push   $0x801b9b
+  801b97:	89 e5                	mov    %esp,%ebp
+  801b99:	0f 34                	sysenter
+  801b9b:	83 c4 04             	add    $0x4,%esp
+  801b9e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801b9f:	85 c0                	test   %eax,%eax
+  801ba1:	7f 6c                	jg     801c0f <sys_ipc_recv_range+0xad>
+}
+  801ba3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ba6:	5b                   	pop    %ebx
+  801ba7:	5e                   	pop    %esi
+  801ba8:	5f                   	pop    %edi
+  801ba9:	5d                   	pop    %ebp
+  801baa:	c3                   	ret
+  801bab:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bb0:	0f a2                	cpuid
+		return 0;
+  801bb2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801bb7:	f6 c6 08             	test   $0x8,%dh
+  801bba:	74 15                	je     801bd1 <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bbc:	89 c2                	mov    %eax,%edx
+  801bbe:	c1 ea 08             	shr    $0x8,%edx
+  801bc1:	83 e2 0f             	and    $0xf,%edx
+  801bc4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801bc9:	83 fa 06             	cmp    $0x6,%edx
+  801bcc:	74 0e                	je     801bdc <sys_ipc_recv_range+0x7a>
+  801bce:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801bd1:	0f b6 c9             	movzbl %cl,%ecx
+  801bd4:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801bda:	eb 98                	jmp    801b74 <sys_ipc_recv_range+0x12>
+  801bdc:	89 c2                	mov    %eax,%edx
+  801bde:	c1 ea 04             	shr    $0x4,%edx
+  801be1:	83 e2 0f             	and    $0xf,%edx
+  801be4:	83 fa 02             	cmp    $0x2,%edx
+  801be7:	77 e5                	ja     801bce <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801be9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bec:	83 f8 02             	cmp    $0x2,%eax
+  801bef:	0f 97 c1             	seta   %cl
+  801bf2:	0f b6 c9             	movzbl %cl,%ecx
+  801bf5:	eb d7                	jmp    801bce <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801bf7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bfc:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801c01:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c04:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c07:	89 df                	mov    %ebx,%edi
+  801c09:	89 de                	mov    %ebx,%esi
+  801c0b:	cd 30                	int    $0x30
+  801c0d:	eb 90                	jmp    801b9f <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801c0f:	83 ec 0c             	sub    $0xc,%esp
+  801c12:	50                   	push   %eax
+  801c13:	6a 1f                	push   $0x1f
+  801c15:	68 79 33 80 00       	push   $0x803379
+  801c1a:	6a 4a                	push   $0x4a
+  801c1c:	68 96 33 80 00       	push   $0x803396
+  801c21:	e8 cf e5 ff ff       	call   8001f5 <_panic>
+
+00801c26 <sys_ipc_call>:
+{
+  801c26:	55                   	push   %ebp
+  801c27:	89 e5                	mov    %esp,%ebp
+  801c29:	57                   	push   %edi
+  801c2a:	56                   	push   %esi
+  801c2b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801c2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c2f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801c34:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801c37:	55                   	push   %ebp
+  801c38:	56                   	push   %esi
+  801c39:	8b 0e                	mov    (%esi),%ecx
+  801c3b:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801c3e:	8b 7e 08             	mov    0x8(%esi),%edi
+  801c41:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801c44:	8b 76 0c             	mov    0xc(%esi),%esi
+  801c47:	cd 30                	int    $0x30
+  801c49:	87 34 24             	xchg   %esi,(%esp)
+  801c4c:	89 0e                	mov    %ecx,(%esi)
+  801c4e:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801c51:	89 7e 08             	mov    %edi,0x8(%esi)
+  801c54:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801c57:	8f 46 0c             	pop    0xc(%esi)
+  801c5a:	5d                   	pop    %ebp
+}
+  801c5b:	5b                   	pop    %ebx
+  801c5c:	5e                   	pop    %esi
+  801c5d:	5f                   	pop    %edi
+  801c5e:	5d                   	pop    %ebp
+  801c5f:	c3                   	ret
+
+00801c60 <sys_ipc_reply_wait>:
+{
+  801c60:	55                   	push   %ebp
+  801c61:	89 e5                	mov    %esp,%ebp
+  801c63:	57                   	push   %edi
+  801c64:	56                   	push   %esi
+  801c65:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801c66:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c69:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801c6e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801c71:	55                   	push   %ebp
+  801c72:	56                   	push   %esi
+  801c73:	8b 0e                	mov    (%esi),%ecx
+  801c75:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801c78:	8b 7e 08             	mov    0x8(%esi),%edi
+  801c7b:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801c7e:	8b 76 0c             	mov    0xc(%esi),%esi
+  801c81:	cd 30                	int    $0x30
+  801c83:	87 34 24             	xchg   %esi,(%esp)
+  801c86:	89 0e                	mov    %ecx,(%esi)
+  801c88:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801c8b:	89 7e 08             	mov    %edi,0x8(%esi)
+  801c8e:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801c91:	8f 46 0c             	pop    0xc(%esi)
+  801c94:	5d                   	pop    %ebp
+}
+  801c95:	5b                   	pop    %ebx
+  801c96:	5e                   	pop    %esi
+  801c97:	5f                   	pop    %edi
+  801c98:	5d                   	pop    %ebp
+  801c99:	c3                   	ret
+
+00801c9a <sys_ipc_send_msg>:
+{
+  801c9a:	55                   	push   %ebp
+  801c9b:	89 e5                	mov    %esp,%ebp
+  801c9d:	57                   	push   %edi
+  801c9e:	56                   	push   %esi
+  801c9f:	53                   	push   %ebx
+  801ca0:	83 ec 20             	sub    $0x20,%esp
+  801ca3:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801ca6:	8b 10                	mov    (%eax),%edx
+  801ca8:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801cab:	8b 50 04             	mov    0x4(%eax),%edx
+  801cae:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801cb1:	8b 50 08             	mov    0x8(%eax),%edx
+  801cb4:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801cb7:	8b 50 0c             	mov    0xc(%eax),%edx
+  801cba:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801cbd:	8b 40 10             	mov    0x10(%eax),%eax
+  801cc0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801cc3:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801cc6:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cc9:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801cce:	55                   	push   %ebp
+  801ccf:	56                   	push   %esi
+  801cd0:	8b 0e                	mov    (%esi),%ecx
+  801cd2:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801cd5:	8b 7e 08             	mov    0x8(%esi),%edi
+  801cd8:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801cdb:	8b 76 0c             	mov    0xc(%esi),%esi
+  801cde:	cd 30                	int    $0x30
+  801ce0:	87 34 24             	xchg   %esi,(%esp)
+  801ce3:	89 0e                	mov    %ecx,(%esi)
+  801ce5:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801ce8:	89 7e 08             	mov    %edi,0x8(%esi)
+  801ceb:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801cee:	8f 46 0c             	pop    0xc(%esi)
+  801cf1:	5d                   	pop    %ebp
+}
+  801cf2:	83 c4 20             	add    $0x20,%esp
+  801cf5:	5b                   	pop    %ebx
+  801cf6:	5e                   	pop    %esi
+  801cf7:	5f                   	pop    %edi
+  801cf8:	5d                   	pop    %ebp
+  801cf9:	c3                   	ret
+
+00801cfa <sys_fork>:
+{
+  801cfa:	55                   	push   %ebp
+  801cfb:	89 e5                	mov    %esp,%ebp
+  801cfd:	57                   	push   %edi
+  801cfe:	56                   	push   %esi
+  801cff:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801d00:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801d07:	78 2e                	js     801d37 <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801d09:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801d10:	74 71                	je     801d83 <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801d12:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d17:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801d1c:	89 d1                	mov    %edx,%ecx
+  801d1e:	89 d3                	mov    %edx,%ebx
+  801d20:	89 d7                	mov    %edx,%edi
+  801d22:	89 d6                	mov    %edx,%esi
+  801d24:	55                   	push   %ebp
+  801d25:	68 2e 1d 80 00       	push   $0x801d2e
+  801d2a:	89 e5                	mov    %esp,%ebp
+  801d2c:	0f 34                	sysenter
+  801d2e:	83 c4 04             	add    $0x4,%esp
+  801d31:	5d                   	pop    %ebp
+}
+  801d32:	5b                   	pop    %ebx
+  801d33:	5e                   	pop    %esi
+  801d34:	5f                   	pop    %edi
+  801d35:	5d                   	pop    %ebp
+  801d36:	c3                   	ret
+  801d37:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d3c:	0f a2                	cpuid
+		return 0;
+  801d3e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801d43:	f6 c6 08             	test   $0x8,%dh
+  801d46:	74 15                	je     801d5d <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d48:	89 c2                	mov    %eax,%edx
+  801d4a:	c1 ea 08             	shr    $0x8,%edx
+  801d4d:	83 e2 0f             	and    $0xf,%edx
+  801d50:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d55:	83 fa 06             	cmp    $0x6,%edx
+  801d58:	74 0e                	je     801d68 <sys_fork+0x6e>
+  801d5a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801d5d:	0f b6 c9             	movzbl %cl,%ecx
+  801d60:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801d66:	eb a1                	jmp    801d09 <sys_fork+0xf>
+  801d68:	89 c2                	mov    %eax,%edx
+  801d6a:	c1 ea 04             	shr    $0x4,%edx
+  801d6d:	83 e2 0f             	and    $0xf,%edx
+  801d70:	83 fa 02             	cmp    $0x2,%edx
+  801d73:	77 e5                	ja     801d5a <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801d75:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d78:	83 f8 02             	cmp    $0x2,%eax
+  801d7b:	0f 97 c1             	seta   %cl
+  801d7e:	0f b6 c9             	movzbl %cl,%ecx
+  801d81:	eb d7                	jmp    801d5a <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801d83:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d88:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801d8d:	89 d1                	mov    %edx,%ecx
+  801d8f:	89 d3                	mov    %edx,%ebx
+  801d91:	89 d7                	mov    %edx,%edi
+  801d93:	89 d6                	mov    %edx,%esi
+  801d95:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801d97:	eb 99                	jmp    801d32 <sys_fork+0x38>
+
+00801d99 <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801d99:	55                   	push   %ebp
+  801d9a:	89 e5                	mov    %esp,%ebp
+  801d9c:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801d9f:	ff 75 14             	push   0x14(%ebp)
+  801da2:	ff 75 10             	push   0x10(%ebp)
+  801da5:	ff 75 0c             	push   0xc(%ebp)
+  801da8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801dad:	8b 55 08             	mov    0x8(%ebp),%edx
+  801db0:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801db5:	e8 81 ee ff ff       	call   800c3b <page_vec_call>
+}
+  801dba:	c9                   	leave
+  801dbb:	c3                   	ret
+
+00801dbc <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801dbc:	55                   	push   %ebp
+  801dbd:	89 e5                	mov    %esp,%ebp
+  801dbf:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801dc2:	ff 75 18             	push   0x18(%ebp)
+  801dc5:	ff 75 14             	push   0x14(%ebp)
+  801dc8:	ff 75 10             	push   0x10(%ebp)
+  801dcb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801dce:	8b 55 08             	mov    0x8(%ebp),%edx
+  801dd1:	b8 10 00 00 00       	mov    $0x10,%eax
+  801dd6:	e8 60 ee ff ff       	call   800c3b <page_vec_call>
+}
+  801ddb:	c9                   	leave
+  801ddc:	c3                   	ret
+
+00801ddd <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801ddd:	55                   	push   %ebp
+  801dde:	89 e5                	mov    %esp,%ebp
+  801de0:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801de3:	ff 75 14             	push   0x14(%ebp)
+  801de6:	ff 75 10             	push   0x10(%ebp)
+  801de9:	ff 75 0c             	push   0xc(%ebp)
+  801dec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801df1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801df4:	b8 11 00 00 00       	mov    $0x11,%eax
+  801df9:	e8 3d ee ff ff       	call   800c3b <page_vec_call>
+}
+  801dfe:	c9                   	leave
+  801dff:	c3                   	ret
+
+00801e00 <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801e00:	55                   	push   %ebp
+  801e01:	89 e5                	mov    %esp,%ebp
+  801e03:	57                   	push   %edi
+  801e04:	56                   	push   %esi
+  801e05:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801e06:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e0d:	78 32                	js     801e41 <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801e0f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e16:	74 75                	je     801e8d <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801e18:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e1b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e1e:	b8 12 00 00 00       	mov    $0x12,%eax
+  801e23:	be 00 00 00 00       	mov    $0x0,%esi
+  801e28:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e2b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801e2e:	55                   	push   %ebp
+  801e2f:	68 38 1e 80 00       	push   $0x801e38
+  801e34:	89 e5                	mov    %esp,%ebp
+  801e36:	0f 34                	sysenter
+  801e38:	83 c4 04             	add    $0x4,%esp
+  801e3b:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801e3c:	5b                   	pop    %ebx
+  801e3d:	5e                   	pop    %esi
+  801e3e:	5f                   	pop    %edi
+  801e3f:	5d                   	pop    %ebp
+  801e40:	c3                   	ret
+  801e41:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e46:	0f a2                	cpuid
+		return 0;
+  801e48:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801e4d:	f6 c6 08             	test   $0x8,%dh
+  801e50:	74 15                	je     801e67 <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e52:	89 c2                	mov    %eax,%edx
+  801e54:	c1 ea 08             	shr    $0x8,%edx
+  801e57:	83 e2 0f             	and    $0xf,%edx
+  801e5a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e5f:	83 fa 06             	cmp    $0x6,%edx
+  801e62:	74 0e                	je     801e72 <sys_vm_ranges+0x72>
+  801e64:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801e67:	0f b6 c9             	movzbl %cl,%ecx
+  801e6a:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801e70:	eb 9d                	jmp    801e0f <sys_vm_ranges+0xf>
+  801e72:	89 c2                	mov    %eax,%edx
+  801e74:	c1 ea 04             	shr    $0x4,%edx
+  801e77:	83 e2 0f             	and    $0xf,%edx
+  801e7a:	83 fa 02             	cmp    $0x2,%edx
+  801e7d:	77 e5                	ja     801e64 <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  801e7f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e82:	83 f8 02             	cmp    $0x2,%eax
+  801e85:	0f 97 c1             	seta   %cl
+  801e88:	0f b6 c9             	movzbl %cl,%ecx
+  801e8b:	eb d7                	jmp    801e64 <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801e8d:	b8 12 00 00 00       	mov    $0x12,%eax
+  801e92:	be 00 00 00 00       	mov    $0x0,%esi
+  801e97:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e9a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e9d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ea0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ea3:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801ea5:	eb 95                	jmp    801e3c <sys_vm_ranges+0x3c>
+
+00801ea7 <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801ea7:	55                   	push   %ebp
+  801ea8:	89 e5                	mov    %esp,%ebp
+  801eaa:	57                   	push   %edi
+  801eab:	56                   	push   %esi
+  801eac:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801ead:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801eb4:	78 31                	js     801ee7 <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801eb6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ebd:	74 74                	je     801f33 <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801ebf:	be 00 00 00 00       	mov    $0x0,%esi
+  801ec4:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ec7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801eca:	b8 14 00 00 00       	mov    $0x14,%eax
+  801ecf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ed2:	89 f7                	mov    %esi,%edi
+  801ed4:	55                   	push   %ebp
+  801ed5:	68 de 1e 80 00       	push   $0x801ede
+  801eda:	89 e5                	mov    %esp,%ebp
+  801edc:	0f 34                	sysenter
+  801ede:	83 c4 04             	add    $0x4,%esp
+  801ee1:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801ee2:	5b                   	pop    %ebx
+  801ee3:	5e                   	pop    %esi
+  801ee4:	5f                   	pop    %edi
+  801ee5:	5d                   	pop    %ebp
+  801ee6:	c3                   	ret
+  801ee7:	b8 01 00 00 00       	mov    $0x1,%eax
+  801eec:	0f a2                	cpuid
+		return 0;
+  801eee:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801ef3:	f6 c6 08             	test   $0x8,%dh
+  801ef6:	74 15                	je     801f0d <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ef8:	89 c2                	mov    %eax,%edx
+  801efa:	c1 ea 08             	shr    $0x8,%edx
+  801efd:	83 e2 0f             	and    $0xf,%edx
+  801f00:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f05:	83 fa 06             	cmp    $0x6,%edx
+  801f08:	74 0e                	je     801f18 <sys_spawn+0x71>
+  801f0a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801f0d:	0f b6 c9             	movzbl %cl,%ecx
+  801f10:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801f16:	eb 9e                	jmp    801eb6 <sys_spawn+0xf>
+  801f18:	89 c2                	mov    %eax,%edx
+  801f1a:	c1 ea 04             	shr    $0x4,%edx
+  801f1d:	83 e2 0f             	and    $0xf,%edx
+  801f20:	83 fa 02             	cmp    $0x2,%edx
+  801f23:	77 e5                	ja     801f0a <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  801f25:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f28:	83 f8 02             	cmp    $0x2,%eax
+  801f2b:	0f 97 c1             	seta   %cl
+  801f2e:	0f b6 c9             	movzbl %cl,%ecx
+  801f31:	eb d7                	jmp    801f0a <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  801f33:	be 00 00 00 00       	mov    $0x0,%esi
+  801f38:	b8 14 00 00 00       	mov    $0x14,%eax
+  801f3d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f40:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f43:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f46:	89 f7                	mov    %esi,%edi
+  801f48:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  801f4a:	eb 96                	jmp    801ee2 <sys_spawn+0x3b>
+
+00801f4c <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  801f4c:	55                   	push   %ebp
+  801f4d:	89 e5                	mov    %esp,%ebp
+  801f4f:	57                   	push   %edi
+  801f50:	56                   	push   %esi
+  801f51:	53                   	push   %ebx
+  801f52:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801f55:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f5c:	78 37                	js     801f95 <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  801f5e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f65:	74 7a                	je     801fe1 <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  801f67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f72:	b8 15 00 00 00       	mov    $0x15,%eax
+  801f77:	89 df                	mov    %ebx,%edi
+  801f79:	89 de                	mov    %ebx,%esi
+  801f7b:	55                   	push   %ebp
+  801f7c:	68 85 1f 80 00       	push   $0x801f85
+  801f81:	89 e5                	mov    %esp,%ebp
+  801f83:	0f 34                	sysenter
+  801f85:	83 c4 04             	add    $0x4,%esp
+  801f88:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801f89:	85 c0                	test   %eax,%eax
+  801f8b:	7f 6c                	jg     801ff9 <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  801f8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f90:	5b                   	pop    %ebx
+  801f91:	5e                   	pop    %esi
+  801f92:	5f                   	pop    %edi
+  801f93:	5d                   	pop    %ebp
+  801f94:	c3                   	ret
+  801f95:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f9a:	0f a2                	cpuid
+		return 0;
+  801f9c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801fa1:	f6 c6 08             	test   $0x8,%dh
+  801fa4:	74 15                	je     801fbb <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fa6:	89 c2                	mov    %eax,%edx
+  801fa8:	c1 ea 08             	shr    $0x8,%edx
+  801fab:	83 e2 0f             	and    $0xf,%edx
+  801fae:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801fb3:	83 fa 06             	cmp    $0x6,%edx
+  801fb6:	74 0e                	je     801fc6 <sys_shm_create+0x7a>
+  801fb8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801fbb:	0f b6 c9             	movzbl %cl,%ecx
+  801fbe:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801fc4:	eb 98                	jmp    801f5e <sys_shm_create+0x12>
+  801fc6:	89 c2                	mov    %eax,%edx
+  801fc8:	c1 ea 04             	shr    $0x4,%edx
+  801fcb:	83 e2 0f             	and    $0xf,%edx
+  801fce:	83 fa 02             	cmp    $0x2,%edx
+  801fd1:	77 e5                	ja     801fb8 <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  801fd3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fd6:	83 f8 02             	cmp    $0x2,%eax
+  801fd9:	0f 97 c1             	seta   %cl
+  801fdc:	0f b6 c9             	movzbl %cl,%ecx
+  801fdf:	eb d7                	jmp    801fb8 <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  801fe1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fe6:	b8 15 00 00 00       	mov    $0x15,%eax
+  801feb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ff1:	89 df                	mov    %ebx,%edi
+  801ff3:	89 de                	mov    %ebx,%esi
+  801ff5:	cd 30                	int    $0x30
+  801ff7:	eb 90                	jmp    801f89 <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801ff9:	83 ec 0c             	sub    $0xc,%esp
+  801ffc:	50                   	push   %eax
+  801ffd:	6a 15                	push   $0x15
+  801fff:	68 79 33 80 00       	push   $0x803379
+  802004:	6a 4a                	push   $0x4a
+  802006:	68 96 33 80 00       	push   $0x803396
+  80200b:	e8 e5 e1 ff ff       	call   8001f5 <_panic>
+
+00802010 <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  802010:	55                   	push   %ebp
+  802011:	89 e5                	mov    %esp,%ebp
+  802013:	57                   	push   %edi
+  802014:	56                   	push   %esi
+  802015:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802016:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80201d:	78 32                	js     802051 <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  80201f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802026:	74 75                	je     80209d <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  802028:	8b 55 08             	mov    0x8(%ebp),%edx
+  80202b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80202e:	b8 16 00 00 00       	mov    $0x16,%eax
+  802033:	be 00 00 00 00       	mov    $0x0,%esi
+  802038:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80203b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80203e:	55                   	push   %ebp
+  80203f:	68 48 20 80 00       	push   $0x802048
+  802044:	89 e5                	mov    %esp,%ebp
+  802046:	0f 34                	sysenter
+  802048:	83 c4 04             	add    $0x4,%esp
+  80204b:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  80204c:	5b                   	pop    %ebx
+  80204d:	5e                   	pop    %esi
+  80204e:	5f                   	pop    %edi
+  80204f:	5d                   	pop    %ebp
+  802050:	c3                   	ret
+  802051:	b8 01 00 00 00       	mov    $0x1,%eax
+  802056:	0f a2                	cpuid
+		return 0;
+  802058:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80205d:	f6 c6 08             	test   $0x8,%dh
+  802060:	74 15                	je     802077 <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802062:	89 c2                	mov    %eax,%edx
+  802064:	c1 ea 08             	shr    $0x8,%edx
+  802067:	83 e2 0f             	and    $0xf,%edx
+  80206a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80206f:	83 fa 06             	cmp    $0x6,%edx
+  802072:	74 0e                	je     802082 <sys_shm_attach+0x72>
+  802074:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802077:	0f b6 c9             	movzbl %cl,%ecx
+  80207a:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802080:	eb 9d                	jmp    80201f <sys_shm_attach+0xf>
+  802082:	89 c2                	mov    %eax,%edx
+  802084:	c1 ea 04             	shr    $0x4,%edx
+  802087:	83 e2 0f             	and    $0xf,%edx
+  80208a:	83 fa 02             	cmp    $0x2,%edx
+  80208d:	77 e5                	ja     802074 <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  80208f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802092:	83 f8 02             	cmp    $0x2,%eax
+  802095:	0f 97 c1             	seta   %cl
+  802098:	0f b6 c9             	movzbl %cl,%ecx
+  80209b:	eb d7                	jmp    802074 <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  80209d:	b8 16 00 00 00       	mov    $0x16,%eax
+  8020a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8020a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020ad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8020b0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8020b3:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  8020b5:	eb 95                	jmp    80204c <sys_shm_attach+0x3c>
+
+008020b7 <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  8020b7:	55                   	push   %ebp
+  8020b8:	89 e5                	mov    %esp,%ebp
+  8020ba:	57                   	push   %edi
+  8020bb:	56                   	push   %esi
+  8020bc:	53                   	push   %ebx
+  8020bd:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8020c0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8020c7:	78 38                	js     802101 <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  8020c9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8020d0:	74 7b                	je     80214d <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  8020d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8020d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020dd:	b8 17 00 00 00       	mov    $0x17,%eax
+  8020e2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8020e5:	89 f7                	mov    %esi,%edi
+  8020e7:	55                   	push   %ebp
+  8020e8:	68 f1 20 80 00       	push   $0x8020f1
+  8020ed:	89 e5                	mov    %esp,%ebp
+  8020ef:	0f 34                	sysenter
+  8020f1:	83 c4 04             	add    $0x4,%esp
+  8020f4:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8020f5:	85 c0                	test   %eax,%eax
+  8020f7:	7f 6d                	jg     802166 <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  8020f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020fc:	5b                   	pop    %ebx
+  8020fd:	5e                   	pop    %esi
+  8020fe:	5f                   	pop    %edi
+  8020ff:	5d                   	pop    %ebp
+  802100:	c3                   	ret
+  802101:	b8 01 00 00 00       	mov    $0x1,%eax
+  802106:	0f a2                	cpuid
+		return 0;
+  802108:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80210d:	f6 c6 08             	test   $0x8,%dh
+  802110:	74 15                	je     802127 <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802112:	89 c2                	mov    %eax,%edx
+  802114:	c1 ea 08             	shr    $0x8,%edx
+  802117:	83 e2 0f             	and    $0xf,%edx
+  80211a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80211f:	83 fa 06             	cmp    $0x6,%edx
+  802122:	74 0e                	je     802132 <sys_shm_detach+0x7b>
+  802124:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802127:	0f b6 c9             	movzbl %cl,%ecx
+  80212a:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802130:	eb 97                	jmp    8020c9 <sys_shm_detach+0x12>
+  802132:	89 c2                	mov    %eax,%edx
+  802134:	c1 ea 04             	shr    $0x4,%edx
+  802137:	83 e2 0f             	and    $0xf,%edx
+  80213a:	83 fa 02             	cmp    $0x2,%edx
+  80213d:	77 e5                	ja     802124 <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  80213f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802142:	83 f8 02             	cmp    $0x2,%eax
+  802145:	0f 97 c1             	seta   %cl
+  802148:	0f b6 c9             	movzbl %cl,%ecx
+  80214b:	eb d7                	jmp    802124 <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  80214d:	be 00 00 00 00       	mov    $0x0,%esi
+  802152:	b8 17 00 00 00       	mov    $0x17,%eax
+  802157:	8b 55 08             	mov    0x8(%ebp),%edx
+  80215a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80215d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802160:	89 f7                	mov    %esi,%edi
+  802162:	cd 30                	int    $0x30
+  802164:	eb 8f                	jmp    8020f5 <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802166:	83 ec 0c             	sub    $0xc,%esp
+  802169:	50                   	push   %eax
+  80216a:	6a 17                	push   $0x17
+  80216c:	68 79 33 80 00       	push   $0x803379
+  802171:	6a 4a                	push   $0x4a
+  802173:	68 96 33 80 00       	push   $0x803396
+  802178:	e8 78 e0 ff ff       	call   8001f5 <_panic>
+
+0080217d <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  80217d:	55                   	push   %ebp
+  80217e:	89 e5                	mov    %esp,%ebp
+  802180:	57                   	push   %edi
+  802181:	56                   	push   %esi
+  802182:	53                   	push   %ebx
+  802183:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802186:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80218d:	78 36                	js     8021c5 <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  80218f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802196:	74 79                	je     802211 <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  802198:	8b 55 08             	mov    0x8(%ebp),%edx
+  80219b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021a0:	b8 18 00 00 00       	mov    $0x18,%eax
+  8021a5:	89 cb                	mov    %ecx,%ebx
+  8021a7:	89 cf                	mov    %ecx,%edi
+  8021a9:	89 ce                	mov    %ecx,%esi
+  8021ab:	55                   	push   %ebp
+  8021ac:	68 b5 21 80 00       	push   $0x8021b5
+  8021b1:	89 e5                	mov    %esp,%ebp
+  8021b3:	0f 34                	sysenter
+  8021b5:	83 c4 04             	add    $0x4,%esp
+  8021b8:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8021b9:	85 c0                	test   %eax,%eax
+  8021bb:	7f 6b                	jg     802228 <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  8021bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021c0:	5b                   	pop    %ebx
+  8021c1:	5e                   	pop    %esi
+  8021c2:	5f                   	pop    %edi
+  8021c3:	5d                   	pop    %ebp
+  8021c4:	c3                   	ret
+  8021c5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021ca:	0f a2                	cpuid
+		return 0;
+  8021cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8021d1:	f6 c6 08             	test   $0x8,%dh
+  8021d4:	74 15                	je     8021eb <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021d6:	89 c2                	mov    %eax,%edx
+  8021d8:	c1 ea 08             	shr    $0x8,%edx
+  8021db:	83 e2 0f             	and    $0xf,%edx
+  8021de:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8021e3:	83 fa 06             	cmp    $0x6,%edx
+  8021e6:	74 0e                	je     8021f6 <sys_shm_remove+0x79>
+  8021e8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8021eb:	0f b6 c9             	movzbl %cl,%ecx
+  8021ee:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8021f4:	eb 99                	jmp    80218f <sys_shm_remove+0x12>
+  8021f6:	89 c2                	mov    %eax,%edx
+  8021f8:	c1 ea 04             	shr    $0x4,%edx
+  8021fb:	83 e2 0f             	and    $0xf,%edx
+  8021fe:	83 fa 02             	cmp    $0x2,%edx
+  802201:	77 e5                	ja     8021e8 <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  802203:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802206:	83 f8 02             	cmp    $0x2,%eax
+  802209:	0f 97 c1             	seta   %cl
+  80220c:	0f b6 c9             	movzbl %cl,%ecx
+  80220f:	eb d7                	jmp    8021e8 <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  802211:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802216:	b8 18 00 00 00       	mov    $0x18,%eax
+  80221b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80221e:	89 cb                	mov    %ecx,%ebx
+  802220:	89 cf                	mov    %ecx,%edi
+  802222:	89 ce                	mov    %ecx,%esi
+  802224:	cd 30                	int    $0x30
+  802226:	eb 91                	jmp    8021b9 <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802228:	83 ec 0c             	sub    $0xc,%esp
+  80222b:	50                   	push   %eax
+  80222c:	6a 18                	push   $0x18
+  80222e:	68 79 33 80 00       	push   $0x803379
+  802233:	6a 4a                	push   $0x4a
+  802235:	68 96 33 80 00       	push   $0x803396
+  80223a:	e8 b6 df ff ff       	call   8001f5 <_panic>
+
+0080223f <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  80223f:	55                   	push   %ebp
+  802240:	89 e5                	mov    %esp,%ebp
+  802242:	57                   	push   %edi
+  802243:	56                   	push   %esi
+  802244:	53                   	push   %ebx
+  802245:	83 ec 0c             	sub    $0xc,%esp
+  802248:	8b 45 10             	mov    0x10(%ebp),%eax
+  80224b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80224e:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  802251:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802258:	78 32                	js     80228c <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  80225a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802261:	74 75                	je     8022d8 <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  802263:	8b 55 08             	mov    0x8(%ebp),%edx
+  802266:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802269:	b8 20 00 00 00       	mov    $0x20,%eax
+  80226e:	be 00 00 00 00       	mov    $0x0,%esi
+  802273:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802276:	55                   	push   %ebp
+  802277:	68 80 22 80 00       	push   $0x802280
+  80227c:	89 e5                	mov    %esp,%ebp
+  80227e:	0f 34                	sysenter
+  802280:	83 c4 04             	add    $0x4,%esp
+  802283:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  802284:	83 c4 0c             	add    $0xc,%esp
+  802287:	5b                   	pop    %ebx
+  802288:	5e                   	pop    %esi
+  802289:	5f                   	pop    %edi
+  80228a:	5d                   	pop    %ebp
+  80228b:	c3                   	ret
+  80228c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802291:	0f a2                	cpuid
+		return 0;
+  802293:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802298:	f6 c6 08             	test   $0x8,%dh
+  80229b:	74 15                	je     8022b2 <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80229d:	89 c2                	mov    %eax,%edx
+  80229f:	c1 ea 08             	shr    $0x8,%edx
+  8022a2:	83 e2 0f             	and    $0xf,%edx
+  8022a5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8022aa:	83 fa 06             	cmp    $0x6,%edx
+  8022ad:	74 0e                	je     8022bd <sys_futex_wait+0x7e>
+  8022af:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8022b2:	0f b6 c9             	movzbl %cl,%ecx
+  8022b5:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8022bb:	eb 9d                	jmp    80225a <sys_futex_wait+0x1b>
+  8022bd:	89 c2                	mov    %eax,%edx
+  8022bf:	c1 ea 04             	shr    $0x4,%edx
+  8022c2:	83 e2 0f             	and    $0xf,%edx
+  8022c5:	83 fa 02             	cmp    $0x2,%edx
+  8022c8:	77 e5                	ja     8022af <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  8022ca:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022cd:	83 f8 02             	cmp    $0x2,%eax
+  8022d0:	0f 97 c1             	seta   %cl
+  8022d3:	0f b6 c9             	movzbl %cl,%ecx
+  8022d6:	eb d7                	jmp    8022af <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  8022d8:	b8 20 00 00 00       	mov    $0x20,%eax
+  8022dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8022e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022e8:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8022eb:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  8022ed:	eb 95                	jmp    802284 <sys_futex_wait+0x45>
+
+008022ef <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8022ef:	55                   	push   %ebp
+  8022f0:	89 e5                	mov    %esp,%ebp
+  8022f2:	57                   	push   %edi
+  8022f3:	56                   	push   %esi
+  8022f4:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8022f5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8022fc:	78 30                	js     80232e <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  8022fe:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802305:	74 73                	je     80237a <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  802307:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80230c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80230f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802312:	b8 21 00 00 00       	mov    $0x21,%eax
+  802317:	89 df                	mov    %ebx,%edi
+  802319:	89 de                	mov    %ebx,%esi
+  80231b:	55                   	push   %ebp
+  80231c:	68 25 23 80 00       	push   $0x802325
+  802321:	89 e5                	mov    %esp,%ebp
+  802323:	0f 34                	sysenter
+  802325:	83 c4 04             	add    $0x4,%esp
+  802328:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  802329:	5b                   	pop    %ebx
+  80232a:	5e                   	pop    %esi
+  80232b:	5f                   	pop    %edi
+  80232c:	5d                   	pop    %ebp
+  80232d:	c3                   	ret
+  80232e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802333:	0f a2                	cpuid
+		return 0;
+  802335:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80233a:	f6 c6 08             	test   $0x8,%dh
+  80233d:	74 15                	je     802354 <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80233f:	89 c2                	mov    %eax,%edx
+  802341:	c1 ea 08             	shr    $0x8,%edx
+  802344:	83 e2 0f             	and    $0xf,%edx
+  802347:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80234c:	83 fa 06             	cmp    $0x6,%edx
+  80234f:	74 0e                	je     80235f <sys_futex_wake+0x70>
+  802351:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802354:	0f b6 c9             	movzbl %cl,%ecx
+  802357:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80235d:	eb 9f                	jmp    8022fe <sys_futex_wake+0xf>
+  80235f:	89 c2                	mov    %eax,%edx
+  802361:	c1 ea 04             	shr    $0x4,%edx
+  802364:	83 e2 0f             	and    $0xf,%edx
+  802367:	83 fa 02             	cmp    $0x2,%edx
+  80236a:	77 e5                	ja     802351 <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  80236c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80236f:	83 f8 02             	cmp    $0x2,%eax
+  802372:	0f 97 c1             	seta   %cl
+  802375:	0f b6 c9             	movzbl %cl,%ecx
+  802378:	eb d7                	jmp    802351 <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  80237a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80237f:	b8 21 00 00 00       	mov    $0x21,%eax
+  802384:	8b 55 08             	mov    0x8(%ebp),%edx
+  802387:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80238a:	89 df                	mov    %ebx,%edi
+  80238c:	89 de                	mov    %ebx,%esi
+  80238e:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  802390:	eb 97                	jmp    802329 <sys_futex_wake+0x3a>
+
+00802392 <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  802392:	55                   	push   %ebp
+  802393:	89 e5                	mov    %esp,%ebp
+  802395:	57                   	push   %edi
+  802396:	56                   	push   %esi
+  802397:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802398:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80239f:	78 2e                	js     8023cf <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  8023a1:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8023a8:	74 71                	je     80241b <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  8023aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023af:	b8 22 00 00 00       	mov    $0x22,%eax
+  8023b4:	89 d1                	mov    %edx,%ecx
+  8023b6:	89 d3                	mov    %edx,%ebx
+  8023b8:	89 d7                	mov    %edx,%edi
+  8023ba:	89 d6                	mov    %edx,%esi
+  8023bc:	55                   	push   %ebp
+  8023bd:	68 c6 23 80 00       	push   $0x8023c6
+  8023c2:	89 e5                	mov    %esp,%ebp
+  8023c4:	0f 34                	sysenter
+  8023c6:	83 c4 04             	add    $0x4,%esp
+  8023c9:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  8023ca:	5b                   	pop    %ebx
+  8023cb:	5e                   	pop    %esi
+  8023cc:	5f                   	pop    %edi
+  8023cd:	5d                   	pop    %ebp
+  8023ce:	c3                   	ret
+  8023cf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023d4:	0f a2                	cpuid
+		return 0;
+  8023d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8023db:	f6 c6 08             	test   $0x8,%dh
+  8023de:	74 15                	je     8023f5 <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023e0:	89 c2                	mov    %eax,%edx
+  8023e2:	c1 ea 08             	shr    $0x8,%edx
+  8023e5:	83 e2 0f             	and    $0xf,%edx
+  8023e8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8023ed:	83 fa 06             	cmp    $0x6,%edx
+  8023f0:	74 0e                	je     802400 <sys_ep_create+0x6e>
+  8023f2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8023f5:	0f b6 c9             	movzbl %cl,%ecx
+  8023f8:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8023fe:	eb a1                	jmp    8023a1 <sys_ep_create+0xf>
+  802400:	89 c2                	mov    %eax,%edx
+  802402:	c1 ea 04             	shr    $0x4,%edx
+  802405:	83 e2 0f             	and    $0xf,%edx
+  802408:	83 fa 02             	cmp    $0x2,%edx
+  80240b:	77 e5                	ja     8023f2 <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  80240d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802410:	83 f8 02             	cmp    $0x2,%eax
+  802413:	0f 97 c1             	seta   %cl
+  802416:	0f b6 c9             	movzbl %cl,%ecx
+  802419:	eb d7                	jmp    8023f2 <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  80241b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802420:	b8 22 00 00 00       	mov    $0x22,%eax
+  802425:	89 d1                	mov    %edx,%ecx
+  802427:	89 d3                	mov    %edx,%ebx
+  802429:	89 d7                	mov    %edx,%edi
+  80242b:	89 d6                	mov    %edx,%esi
+  80242d:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  80242f:	eb 99                	jmp    8023ca <sys_ep_create+0x38>
+
+00802431 <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  802431:	55                   	push   %ebp
+  802432:	89 e5                	mov    %esp,%ebp
+  802434:	57                   	push   %edi
+  802435:	56                   	push   %esi
+  802436:	53                   	push   %ebx
+  802437:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80243a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802441:	78 36                	js     802479 <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  802443:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80244a:	74 79                	je     8024c5 <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  80244c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80244f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802454:	b8 23 00 00 00       	mov    $0x23,%eax
+  802459:	89 cb                	mov    %ecx,%ebx
+  80245b:	89 cf                	mov    %ecx,%edi
+  80245d:	89 ce                	mov    %ecx,%esi
+  80245f:	55                   	push   %ebp
+  802460:	68 69 24 80 00       	push   $0x802469
+  802465:	89 e5                	mov    %esp,%ebp
+  802467:	0f 34                	sysenter
+  802469:	83 c4 04             	add    $0x4,%esp
+  80246c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80246d:	85 c0                	test   %eax,%eax
+  80246f:	7f 6b                	jg     8024dc <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  802471:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802474:	5b                   	pop    %ebx
+  802475:	5e                   	pop    %esi
+  802476:	5f                   	pop    %edi
+  802477:	5d                   	pop    %ebp
+  802478:	c3                   	ret
+  802479:	b8 01 00 00 00       	mov    $0x1,%eax
+  80247e:	0f a2                	cpuid
+		return 0;
+  802480:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802485:	f6 c6 08             	test   $0x8,%dh
+  802488:	74 15                	je     80249f <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80248a:	89 c2                	mov    %eax,%edx
+  80248c:	c1 ea 08             	shr    $0x8,%edx
+  80248f:	83 e2 0f             	and    $0xf,%edx
+  802492:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802497:	83 fa 06             	cmp    $0x6,%edx
+  80249a:	74 0e                	je     8024aa <sys_ep_destroy+0x79>
+  80249c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80249f:	0f b6 c9             	movzbl %cl,%ecx
+  8024a2:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8024a8:	eb 99                	jmp    802443 <sys_ep_destroy+0x12>
+  8024aa:	89 c2                	mov    %eax,%edx
+  8024ac:	c1 ea 04             	shr    $0x4,%edx
+  8024af:	83 e2 0f             	and    $0xf,%edx
+  8024b2:	83 fa 02             	cmp    $0x2,%edx
+  8024b5:	77 e5                	ja     80249c <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  8024b7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8024ba:	83 f8 02             	cmp    $0x2,%eax
+  8024bd:	0f 97 c1             	seta   %cl
+  8024c0:	0f b6 c9             	movzbl %cl,%ecx
+  8024c3:	eb d7                	jmp    80249c <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  8024c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024ca:	b8 23 00 00 00       	mov    $0x23,%eax
+  8024cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024d2:	89 cb                	mov    %ecx,%ebx
+  8024d4:	89 cf                	mov    %ecx,%edi
+  8024d6:	89 ce                	mov    %ecx,%esi
+  8024d8:	cd 30                	int    $0x30
+  8024da:	eb 91                	jmp    80246d <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8024dc:	83 ec 0c             	sub    $0xc,%esp
+  8024df:	50                   	push   %eax
+  8024e0:	6a 23                	push   $0x23
+  8024e2:	68 79 33 80 00       	push   $0x803379
+  8024e7:	6a 4a                	push   $0x4a
+  8024e9:	68 96 33 80 00       	push   $0x803396
+  8024ee:	e8 02 dd ff ff       	call   8001f5 <_panic>
+
+008024f3 <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  8024f3:	55                   	push   %ebp
+  8024f4:	89 e5                	mov    %esp,%ebp
+  8024f6:	57                   	push   %edi
+  8024f7:	56                   	push   %esi
+  8024f8:	53                   	push   %ebx
+  8024f9:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8024fc:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802503:	78 37                	js     80253c <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  802505:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80250c:	74 7a                	je     802588 <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  80250e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802513:	8b 55 08             	mov    0x8(%ebp),%edx
+  802516:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802519:	b8 24 00 00 00       	mov    $0x24,%eax
+  80251e:	89 df                	mov    %ebx,%edi
+  802520:	89 de                	mov    %ebx,%esi
+  802522:	55                   	push   %ebp
+  802523:	68 2c 25 80 00       	push   $0x80252c
+  802528:	89 e5                	mov    %esp,%ebp
+  80252a:	0f 34                	sysenter
+  80252c:	83 c4 04             	add    $0x4,%esp
+  80252f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802530:	85 c0                	test   %eax,%eax
+  802532:	7f 6c                	jg     8025a0 <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  802534:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802537:	5b                   	pop    %ebx
+  802538:	5e                   	pop    %esi
+  802539:	5f                   	pop    %edi
+  80253a:	5d                   	pop    %ebp
+  80253b:	c3                   	ret
+  80253c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802541:	0f a2                	cpuid
+		return 0;
+  802543:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802548:	f6 c6 08             	test   $0x8,%dh
+  80254b:	74 15                	je     802562 <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80254d:	89 c2                	mov    %eax,%edx
+  80254f:	c1 ea 08             	shr    $0x8,%edx
+  802552:	83 e2 0f             	and    $0xf,%edx
+  802555:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80255a:	83 fa 06             	cmp    $0x6,%edx
+  80255d:	74 0e                	je     80256d <sys_ep_grant+0x7a>
+  80255f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802562:	0f b6 c9             	movzbl %cl,%ecx
+  802565:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80256b:	eb 98                	jmp    802505 <sys_ep_grant+0x12>
+  80256d:	89 c2                	mov    %eax,%edx
+  80256f:	c1 ea 04             	shr    $0x4,%edx
+  802572:	83 e2 0f             	and    $0xf,%edx
+  802575:	83 fa 02             	cmp    $0x2,%edx
+  802578:	77 e5                	ja     80255f <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  80257a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80257d:	83 f8 02             	cmp    $0x2,%eax
+  802580:	0f 97 c1             	seta   %cl
+  802583:	0f b6 c9             	movzbl %cl,%ecx
+  802586:	eb d7                	jmp    80255f <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  802588:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80258d:	b8 24 00 00 00       	mov    $0x24,%eax
+  802592:	8b 55 08             	mov    0x8(%ebp),%edx
+  802595:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802598:	89 df                	mov    %ebx,%edi
+  80259a:	89 de                	mov    %ebx,%esi
+  80259c:	cd 30                	int    $0x30
+  80259e:	eb 90                	jmp    802530 <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8025a0:	83 ec 0c             	sub    $0xc,%esp
+  8025a3:	50                   	push   %eax
+  8025a4:	6a 24                	push   $0x24
+  8025a6:	68 79 33 80 00       	push   $0x803379
+  8025ab:	6a 4a                	push   $0x4a
+  8025ad:	68 96 33 80 00       	push   $0x803396
+  8025b2:	e8 3e dc ff ff       	call   8001f5 <_panic>
+
+008025b7 <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  8025b7:	55                   	push   %ebp
+  8025b8:	89 e5                	mov    %esp,%ebp
+  8025ba:	57                   	push   %edi
+  8025bb:	56                   	push   %esi
+  8025bc:	53                   	push   %ebx
+  8025bd:	83 ec 20             	sub    $0x20,%esp
+  8025c0:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  8025c3:	8b 10                	mov    (%eax),%edx
+  8025c5:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8025c8:	8b 50 04             	mov    0x4(%eax),%edx
+  8025cb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8025ce:	8b 50 08             	mov    0x8(%eax),%edx
+  8025d1:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  8025d4:	8b 50 0c             	mov    0xc(%eax),%edx
+  8025d7:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  8025da:	8b 40 10             	mov    0x10(%eax),%eax
+  8025dd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  8025e0:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  8025e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025e6:	b8 25 00 00 00       	mov    $0x25,%eax
+  8025eb:	55                   	push   %ebp
+  8025ec:	56                   	push   %esi
+  8025ed:	8b 0e                	mov    (%esi),%ecx
+  8025ef:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8025f2:	8b 7e 08             	mov    0x8(%esi),%edi
+  8025f5:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8025f8:	8b 76 0c             	mov    0xc(%esi),%esi
+  8025fb:	cd 30                	int    $0x30
+  8025fd:	87 34 24             	xchg   %esi,(%esp)
+  802600:	89 0e                	mov    %ecx,(%esi)
+  802602:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802605:	89 7e 08             	mov    %edi,0x8(%esi)
+  802608:	89 6e 10             	mov    %ebp,0x10(%esi)
+  80260b:	8f 46 0c             	pop    0xc(%esi)
+  80260e:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  80260f:	83 c4 20             	add    $0x20,%esp
+  802612:	5b                   	pop    %ebx
+  802613:	5e                   	pop    %esi
+  802614:	5f                   	pop    %edi
+  802615:	5d                   	pop    %ebp
+  802616:	c3                   	ret
+
+00802617 <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  802617:	55                   	push   %ebp
+  802618:	89 e5                	mov    %esp,%ebp
+  80261a:	57                   	push   %edi
+  80261b:	56                   	push   %esi
+  80261c:	53                   	push   %ebx
+  80261d:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  802620:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802623:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  802625:	8b 55 08             	mov    0x8(%ebp),%edx
+  802628:	b8 26 00 00 00       	mov    $0x26,%eax
+  80262d:	55                   	push   %ebp
+  80262e:	56                   	push   %esi
+  80262f:	8b 0e                	mov    (%esi),%ecx
+  802631:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802634:	8b 7e 08             	mov    0x8(%esi),%edi
+  802637:	8b 6e 10             	mov    0x10(%esi),%ebp
+  80263a:	8b 76 0c             	mov    0xc(%esi),%esi
+  80263d:	cd 30                	int    $0x30
+  80263f:	87 34 24             	xchg   %esi,(%esp)
+  802642:	89 0e                	mov    %ecx,(%esi)
+  802644:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802647:	89 7e 08             	mov    %edi,0x8(%esi)
+  80264a:	89 6e 10             	mov    %ebp,0x10(%esi)
+  80264d:	8f 46 0c             	pop    0xc(%esi)
+  802650:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  802651:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  802655:	74 0f                	je     802666 <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  802657:	85 c0                	test   %eax,%eax
+  802659:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80265e:	0f 48 d1             	cmovs  %ecx,%edx
+  802661:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  802664:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  802666:	5b                   	pop    %ebx
+  802667:	5e                   	pop    %esi
+  802668:	5f                   	pop    %edi
+  802669:	5d                   	pop    %ebp
+  80266a:	c3                   	ret
+
+0080266b <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  80266b:	55                   	push   %ebp
+  80266c:	89 e5                	mov    %esp,%ebp
+  80266e:	57                   	push   %edi
+  80266f:	56                   	push   %esi
+  802670:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802671:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802678:	78 2f                	js     8026a9 <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  80267a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802681:	74 72                	je     8026f5 <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  802683:	8b 55 08             	mov    0x8(%ebp),%edx
+  802686:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80268b:	b8 27 00 00 00       	mov    $0x27,%eax
+  802690:	89 cb                	mov    %ecx,%ebx
+  802692:	89 cf                	mov    %ecx,%edi
+  802694:	89 ce                	mov    %ecx,%esi
+  802696:	55                   	push   %ebp
+  802697:	68 a0 26 80 00       	push   $0x8026a0
+  80269c:	89 e5                	mov    %esp,%ebp
+  80269e:	0f 34                	sysenter
+  8026a0:	83 c4 04             	add    $0x4,%esp
+  8026a3:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  8026a4:	5b                   	pop    %ebx
+  8026a5:	5e                   	pop    %esi
+  8026a6:	5f                   	pop    %edi
+  8026a7:	5d                   	pop    %ebp
+  8026a8:	c3                   	ret
+  8026a9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026ae:	0f a2                	cpuid
+		return 0;
+  8026b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8026b5:	f6 c6 08             	test   $0x8,%dh
+  8026b8:	74 15                	je     8026cf <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8026ba:	89 c2                	mov    %eax,%edx
+  8026bc:	c1 ea 08             	shr    $0x8,%edx
+  8026bf:	83 e2 0f             	and    $0xf,%edx
+  8026c2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8026c7:	83 fa 06             	cmp    $0x6,%edx
+  8026ca:	74 0e                	je     8026da <sys_sysring_setup+0x6f>
+  8026cc:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8026cf:	0f b6 c9             	movzbl %cl,%ecx
+  8026d2:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8026d8:	eb a0                	jmp    80267a <sys_sysring_setup+0xf>
+  8026da:	89 c2                	mov    %eax,%edx
+  8026dc:	c1 ea 04             	shr    $0x4,%edx
+  8026df:	83 e2 0f             	and    $0xf,%edx
+  8026e2:	83 fa 02             	cmp    $0x2,%edx
+  8026e5:	77 e5                	ja     8026cc <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  8026e7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8026ea:	83 f8 02             	cmp    $0x2,%eax
+  8026ed:	0f 97 c1             	seta   %cl
+  8026f0:	0f b6 c9             	movzbl %cl,%ecx
+  8026f3:	eb d7                	jmp    8026cc <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  8026f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026fa:	b8 27 00 00 00       	mov    $0x27,%eax
+  8026ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  802702:	89 cb                	mov    %ecx,%ebx
+  802704:	89 cf                	mov    %ecx,%edi
+  802706:	89 ce                	mov    %ecx,%esi
+  802708:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  80270a:	eb 98                	jmp    8026a4 <sys_sysring_setup+0x39>
+
+0080270c <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  80270c:	55                   	push   %ebp
+  80270d:	89 e5                	mov    %esp,%ebp
+  80270f:	57                   	push   %edi
+  802710:	56                   	push   %esi
+  802711:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802712:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802719:	78 2e                	js     802749 <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  80271b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802722:	74 71                	je     802795 <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  802724:	ba 00 00 00 00       	mov    $0x0,%edx
+  802729:	b8 28 00 00 00       	mov    $0x28,%eax
+  80272e:	89 d1                	mov    %edx,%ecx
+  802730:	89 d3                	mov    %edx,%ebx
+  802732:	89 d7                	mov    %edx,%edi
+  802734:	89 d6                	mov    %edx,%esi
+  802736:	55                   	push   %ebp
+  802737:	68 40 27 80 00       	push   $0x802740
+  80273c:	89 e5                	mov    %esp,%ebp
+  80273e:	0f 34                	sysenter
+  802740:	83 c4 04             	add    $0x4,%esp
+  802743:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  802744:	5b                   	pop    %ebx
+  802745:	5e                   	pop    %esi
+  802746:	5f                   	pop    %edi
+  802747:	5d                   	pop    %ebp
+  802748:	c3                   	ret
+  802749:	b8 01 00 00 00       	mov    $0x1,%eax
+  80274e:	0f a2                	cpuid
+		return 0;
+  802750:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802755:	f6 c6 08             	test   $0x8,%dh
+  802758:	74 15                	je     80276f <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80275a:	89 c2                	mov    %eax,%edx
+  80275c:	c1 ea 08             	shr    $0x8,%edx
+  80275f:	83 e2 0f             	and    $0xf,%edx
+  802762:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802767:	83 fa 06             	cmp    $0x6,%edx
+  80276a:	74 0e                	je     80277a <sys_sysring_enter+0x6e>
+  80276c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80276f:	0f b6 c9             	movzbl %cl,%ecx
+  802772:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802778:	eb a1                	jmp    80271b <sys_sysring_enter+0xf>
+  80277a:	89 c2                	mov    %eax,%edx
+  80277c:	c1 ea 04             	shr    $0x4,%edx
+  80277f:	83 e2 0f             	and    $0xf,%edx
+  802782:	83 fa 02             	cmp    $0x2,%edx
+  802785:	77 e5                	ja     80276c <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  802787:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80278a:	83 f8 02             	cmp    $0x2,%eax
+  80278d:	0f 97 c1             	seta   %cl
+  802790:	0f b6 c9             	movzbl %cl,%ecx
+  802793:	eb d7                	jmp    80276c <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  802795:	ba 00 00 00 00       	mov    $0x0,%edx
+  80279a:	b8 28 00 00 00       	mov    $0x28,%eax
+  80279f:	89 d1                	mov    %edx,%ecx
+  8027a1:	89 d3                	mov    %edx,%ebx
+  8027a3:	89 d7                	mov    %edx,%edi
+  8027a5:	89 d6                	mov    %edx,%esi
+  8027a7:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  8027a9:	eb 99                	jmp    802744 <sys_sysring_enter+0x38>
+
+008027ab <pgfault>:
+// The kernel normally resolves these faults itself (page_fault_cow in
+// kern/trap.c); we only get here if it ran out of memory doing so.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8027ab:	55                   	push   %ebp
+  8027ac:	89 e5                	mov    %esp,%ebp
+  8027ae:	83 ec 08             	sub    $0x8,%esp
+  8027b1:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  8027b4:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  8027b6:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  8027b9:	f6 c2 02             	test   $0x2,%dl
+  8027bc:	74 40                	je     8027fe <pgfault+0x53>
+  8027be:	89 c1                	mov    %eax,%ecx
+  8027c0:	c1 e9 16             	shr    $0x16,%ecx
+  8027c3:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  8027ca:	f6 c1 01             	test   $0x1,%cl
+  8027cd:	74 2f                	je     8027fe <pgfault+0x53>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW))
+  8027cf:	89 c1                	mov    %eax,%ecx
+  8027d1:	c1 e9 0c             	shr    $0xc,%ecx
+  8027d4:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  8027db:	f6 c5 08             	test   $0x8,%ch
+  8027de:	74 1e                	je     8027fe <pgfault+0x53>
+	// Replace the page with a private writable copy of itself.  The
+	// kernel allocates, copies and maps it in one system call, so no
+	// temporary mapping at PFTEMP is needed.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8027e0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r = sys_page_copy(0, addr, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  8027e5:	83 ec 0c             	sub    $0xc,%esp
+  8027e8:	6a 07                	push   $0x7
+  8027ea:	50                   	push   %eax
+  8027eb:	6a 00                	push   $0x0
+  8027ed:	50                   	push   %eax
+  8027ee:	6a 00                	push   $0x0
+  8027f0:	e8 85 eb ff ff       	call   80137a <sys_page_copy>
+  8027f5:	83 c4 20             	add    $0x20,%esp
+  8027f8:	85 c0                	test   %eax,%eax
+  8027fa:	78 18                	js     802814 <pgfault+0x69>
+		panic("pgfault: sys_page_copy: %e", r);
+}
+  8027fc:	c9                   	leave
+  8027fd:	c3                   	ret
+		panic("pgfault: va %08x err %x is not a copy-on-write write",
+  8027fe:	83 ec 0c             	sub    $0xc,%esp
+  802801:	52                   	push   %edx
+  802802:	50                   	push   %eax
+  802803:	68 a4 33 80 00       	push   $0x8033a4
+  802808:	6a 1c                	push   $0x1c
+  80280a:	68 d9 33 80 00       	push   $0x8033d9
+  80280f:	e8 e1 d9 ff ff       	call   8001f5 <_panic>
+		panic("pgfault: sys_page_copy: %e", r);
+  802814:	50                   	push   %eax
+  802815:	68 e4 33 80 00       	push   $0x8033e4
+  80281a:	6a 26                	push   $0x26
+  80281c:	68 d9 33 80 00       	push   $0x8033d9
+  802821:	e8 cf d9 ff ff       	call   8001f5 <_panic>
+
+00802826 <ufork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+ufork(void)
+{
+  802826:	55                   	push   %ebp
+  802827:	89 e5                	mov    %esp,%ebp
+  802829:	57                   	push   %edi
+  80282a:	56                   	push   %esi
+  80282b:	53                   	push   %ebx
+  80282c:	81 ec 38 04 00 00    	sub    $0x438,%esp
+	struct page_range vec[PAGE_VEC_MAX], *last;
+	uintptr_t va;
+	size_t n;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  802832:	68 ab 27 80 00       	push   $0x8027ab
+  802837:	e8 03 05 00 00       	call   802d3f <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  80283c:	b8 07 00 00 00       	mov    $0x7,%eax
+  802841:	cd 30                	int    $0x30
+  802843:	89 85 d4 fb ff ff    	mov    %eax,-0x42c(%ebp)
+
+	envid = sys_exofork();
+	if (envid < 0)
+  802849:	83 c4 10             	add    $0x10,%esp
+  80284c:	85 c0                	test   %eax,%eax
+  80284e:	0f 88 f2 01 00 00    	js     802a46 <ufork+0x220>
+		return 0;
+	}
+
+	// Copy every run of mapped pages below the exception stack, which
+	// must not be shared.
+	va = 0;
+  802854:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  802859:	74 0b                	je     802866 <ufork+0x40>
+  80285b:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  802861:	e9 07 01 00 00       	jmp    80296d <ufork+0x147>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  802866:	e8 22 e8 ff ff       	call   80108d <sys_getenvid>
+  80286b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802870:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802876:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80287b:	a3 08 40 80 00       	mov    %eax,0x804008
+		return 0;
+  802880:	e9 c1 01 00 00       	jmp    802a46 <ufork+0x220>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+		n = r;
+		last = &vec[n - 1];
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  802885:	83 ea 01             	sub    $0x1,%edx
+  802888:	89 c1                	mov    %eax,%ecx
+  80288a:	c1 e1 04             	shl    $0x4,%ecx
+  80288d:	89 94 0d ec fd ff ff 	mov    %edx,-0x214(%ebp,%ecx,1)
+			n--;
+  802894:	85 d2                	test   %edx,%edx
+  802896:	0f 44 f0             	cmove  %eax,%esi
+  802899:	e9 12 01 00 00       	jmp    8029b0 <ufork+0x18a>
+	for (i = 0; i < n; i++) {
+  80289e:	83 c1 01             	add    $0x1,%ecx
+  8028a1:	83 c0 10             	add    $0x10,%eax
+  8028a4:	39 8d e4 fb ff ff    	cmp    %ecx,-0x41c(%ebp)
+  8028aa:	74 6a                	je     802916 <ufork+0xf0>
+		vec[i].pr_dstva = vec[i].pr_va;
+  8028ac:	89 c3                	mov    %eax,%ebx
+  8028ae:	8b 10                	mov    (%eax),%edx
+  8028b0:	89 50 0c             	mov    %edx,0xc(%eax)
+		if (vec[i].pr_perm & PTE_SHARE)
+  8028b3:	8b 50 08             	mov    0x8(%eax),%edx
+  8028b6:	f6 c6 04             	test   $0x4,%dh
+  8028b9:	75 e3                	jne    80289e <ufork+0x78>
+		if (vec[i].pr_perm & (PTE_W | PTE_COW)) {
+  8028bb:	f7 c2 02 08 00 00    	test   $0x802,%edx
+  8028c1:	74 db                	je     80289e <ufork+0x78>
+			vec[i].pr_perm = (vec[i].pr_perm & ~PTE_W) | PTE_COW;
+  8028c3:	81 e2 fd f7 ff ff    	and    $0xfffff7fd,%edx
+  8028c9:	80 ce 08             	or     $0x8,%dh
+  8028cc:	89 95 dc fb ff ff    	mov    %edx,-0x424(%ebp)
+  8028d2:	89 53 08             	mov    %edx,0x8(%ebx)
+			cow[ncow++] = vec[i];
+  8028d5:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  8028db:	c1 e6 04             	shl    $0x4,%esi
+  8028de:	89 f2                	mov    %esi,%edx
+  8028e0:	8d b4 35 e8 fb ff ff 	lea    -0x418(%ebp,%esi,1),%esi
+  8028e7:	8b 38                	mov    (%eax),%edi
+  8028e9:	89 bc 15 e8 fb ff ff 	mov    %edi,-0x418(%ebp,%edx,1)
+  8028f0:	8b 78 04             	mov    0x4(%eax),%edi
+  8028f3:	89 7e 04             	mov    %edi,0x4(%esi)
+  8028f6:	8b bd dc fb ff ff    	mov    -0x424(%ebp),%edi
+  8028fc:	89 7e 08             	mov    %edi,0x8(%esi)
+  8028ff:	8b 50 0c             	mov    0xc(%eax),%edx
+  802902:	89 56 0c             	mov    %edx,0xc(%esi)
+  802905:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  80290b:	8d 7e 01             	lea    0x1(%esi),%edi
+  80290e:	89 bd e0 fb ff ff    	mov    %edi,-0x420(%ebp)
+  802914:	eb 88                	jmp    80289e <ufork+0x78>
+	if ((r = sys_page_map_vec(0, envid, vec, n, 0)) < 0)
+  802916:	8b b5 e4 fb ff ff    	mov    -0x41c(%ebp),%esi
+  80291c:	8b bd d8 fb ff ff    	mov    -0x428(%ebp),%edi
+  802922:	83 ec 0c             	sub    $0xc,%esp
+  802925:	6a 00                	push   $0x0
+  802927:	56                   	push   %esi
+  802928:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  80292e:	50                   	push   %eax
+  80292f:	ff b5 d4 fb ff ff    	push   -0x42c(%ebp)
+  802935:	6a 00                	push   $0x0
+  802937:	e8 80 f4 ff ff       	call   801dbc <sys_page_map_vec>
+  80293c:	83 c4 20             	add    $0x20,%esp
+  80293f:	85 c0                	test   %eax,%eax
+  802941:	0f 88 e5 00 00 00    	js     802a2c <ufork+0x206>
+	return sys_page_map_vec(0, 0, cow, ncow, 0);
+  802947:	83 ec 0c             	sub    $0xc,%esp
+  80294a:	6a 00                	push   $0x0
+  80294c:	ff b5 e0 fb ff ff    	push   -0x420(%ebp)
+  802952:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  802958:	50                   	push   %eax
+  802959:	6a 00                	push   $0x0
+  80295b:	6a 00                	push   $0x0
+  80295d:	e8 5a f4 ff ff       	call   801dbc <sys_page_map_vec>
+		if ((r = duppages(envid, vec, n)) < 0)
+  802962:	83 c4 20             	add    $0x20,%esp
+  802965:	85 c0                	test   %eax,%eax
+  802967:	0f 88 e7 00 00 00    	js     802a54 <ufork+0x22e>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+  80296d:	6a 20                	push   $0x20
+  80296f:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802975:	50                   	push   %eax
+  802976:	57                   	push   %edi
+  802977:	6a 00                	push   $0x0
+  802979:	e8 82 f4 ff ff       	call   801e00 <sys_vm_ranges>
+  80297e:	83 c4 10             	add    $0x10,%esp
+  802981:	85 c0                	test   %eax,%eax
+  802983:	7e 51                	jle    8029d6 <ufork+0x1b0>
+		n = r;
+  802985:	89 c6                	mov    %eax,%esi
+		last = &vec[n - 1];
+  802987:	83 e8 01             	sub    $0x1,%eax
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+  80298a:	89 c1                	mov    %eax,%ecx
+  80298c:	c1 e1 04             	shl    $0x4,%ecx
+  80298f:	8b 94 0d ec fd ff ff 	mov    -0x214(%ebp,%ecx,1),%edx
+  802996:	89 d3                	mov    %edx,%ebx
+  802998:	c1 e3 0c             	shl    $0xc,%ebx
+  80299b:	89 df                	mov    %ebx,%edi
+  80299d:	03 bc 0d e8 fd ff ff 	add    -0x218(%ebp,%ecx,1),%edi
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  8029a4:	81 ff 00 00 c0 ee    	cmp    $0xeec00000,%edi
+  8029aa:	0f 84 d5 fe ff ff    	je     802885 <ufork+0x5f>
+	for (i = 0; i < n; i++) {
+  8029b0:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+	size_t i, ncow = 0;
+  8029b6:	c7 85 e0 fb ff ff 00 	movl   $0x0,-0x420(%ebp)
+  8029bd:	00 00 00 
+	for (i = 0; i < n; i++) {
+  8029c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029c5:	89 bd d8 fb ff ff    	mov    %edi,-0x428(%ebp)
+  8029cb:	89 b5 e4 fb ff ff    	mov    %esi,-0x41c(%ebp)
+  8029d1:	e9 ce fe ff ff       	jmp    8028a4 <ufork+0x7e>
+			goto fail;
+	}
+	if (r < 0)
+  8029d6:	89 c6                	mov    %eax,%esi
+  8029d8:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  8029de:	85 c0                	test   %eax,%eax
+  8029e0:	78 52                	js     802a34 <ufork+0x20e>
+		goto fail;
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE),
+  8029e2:	83 ec 04             	sub    $0x4,%esp
+  8029e5:	6a 07                	push   $0x7
+  8029e7:	68 00 f0 bf ee       	push   $0xeebff000
+  8029ec:	53                   	push   %ebx
+  8029ed:	e8 3a e7 ff ff       	call   80112c <sys_page_alloc>
+  8029f2:	89 c6                	mov    %eax,%esi
+  8029f4:	83 c4 10             	add    $0x10,%esp
+  8029f7:	85 c0                	test   %eax,%eax
+  8029f9:	78 39                	js     802a34 <ufork+0x20e>
+				PTE_P | PTE_U | PTE_W)) < 0
+	    || (r = sys_env_set_pgfault_upcall(envid,
+			thisenv->env_pgfault_upcall)) < 0
+  8029fb:	a1 08 40 80 00       	mov    0x804008,%eax
+  802a00:	8b 40 74             	mov    0x74(%eax),%eax
+	    || (r = sys_env_set_pgfault_upcall(envid,
+  802a03:	83 ec 08             	sub    $0x8,%esp
+  802a06:	50                   	push   %eax
+  802a07:	53                   	push   %ebx
+  802a08:	e8 de ed ff ff       	call   8017eb <sys_env_set_pgfault_upcall>
+  802a0d:	89 c6                	mov    %eax,%esi
+  802a0f:	83 c4 10             	add    $0x10,%esp
+  802a12:	85 c0                	test   %eax,%eax
+  802a14:	78 1e                	js     802a34 <ufork+0x20e>
+	    || (r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  802a16:	83 ec 08             	sub    $0x8,%esp
+  802a19:	6a 02                	push   $0x2
+  802a1b:	53                   	push   %ebx
+  802a1c:	e8 bc ea ff ff       	call   8014dd <sys_env_set_status>
+  802a21:	89 c6                	mov    %eax,%esi
+  802a23:	83 c4 10             	add    $0x10,%esp
+  802a26:	85 c0                	test   %eax,%eax
+  802a28:	79 1c                	jns    802a46 <ufork+0x220>
+  802a2a:	eb 08                	jmp    802a34 <ufork+0x20e>
+  802a2c:	89 c6                	mov    %eax,%esi
+  802a2e:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+		goto fail;
+	return envid;
+
+fail:
+	sys_env_destroy(envid);
+  802a34:	83 ec 0c             	sub    $0xc,%esp
+  802a37:	53                   	push   %ebx
+  802a38:	e8 8e e5 ff ff       	call   800fcb <sys_env_destroy>
+	return r;
+  802a3d:	83 c4 10             	add    $0x10,%esp
+  802a40:	89 b5 d4 fb ff ff    	mov    %esi,-0x42c(%ebp)
+}
+  802a46:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+  802a4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a4f:	5b                   	pop    %ebx
+  802a50:	5e                   	pop    %esi
+  802a51:	5f                   	pop    %edi
+  802a52:	5d                   	pop    %ebp
+  802a53:	c3                   	ret
+  802a54:	89 c6                	mov    %eax,%esi
+  802a56:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  802a5c:	eb d6                	jmp    802a34 <ufork+0x20e>
+
+00802a5e <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  802a5e:	55                   	push   %ebp
+  802a5f:	89 e5                	mov    %esp,%ebp
+  802a61:	53                   	push   %ebx
+  802a62:	83 ec 04             	sub    $0x4,%esp
+	envid_t envid;
+
+	envid = sys_fork();
+  802a65:	e8 90 f2 ff ff       	call   801cfa <sys_fork>
+  802a6a:	89 c3                	mov    %eax,%ebx
+	if (envid == 0)
+  802a6c:	85 c0                	test   %eax,%eax
+  802a6e:	74 07                	je     802a77 <fork+0x19>
+		thisenv = &envs[ENVX(sys_getenvid())];
+	return envid;
+}
+  802a70:	89 d8                	mov    %ebx,%eax
+  802a72:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a75:	c9                   	leave
+  802a76:	c3                   	ret
+		thisenv = &envs[ENVX(sys_getenvid())];
+  802a77:	e8 11 e6 ff ff       	call   80108d <sys_getenvid>
+  802a7c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802a81:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802a87:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802a8c:	a3 08 40 80 00       	mov    %eax,0x804008
+	return envid;
+  802a91:	eb dd                	jmp    802a70 <fork+0x12>
+
+00802a93 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  802a93:	55                   	push   %ebp
+  802a94:	89 e5                	mov    %esp,%ebp
+  802a96:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  802a99:	68 ff 33 80 00       	push   $0x8033ff
+  802a9e:	68 a1 00 00 00       	push   $0xa1
+  802aa3:	68 d9 33 80 00       	push   $0x8033d9
+  802aa8:	e8 48 d7 ff ff       	call   8001f5 <_panic>
+
+00802aad <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802aad:	55                   	push   %ebp
+  802aae:	89 e5                	mov    %esp,%ebp
+  802ab0:	56                   	push   %esi
+  802ab1:	53                   	push   %ebx
+  802ab2:	8b 75 08             	mov    0x8(%ebp),%esi
+  802ab5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ab8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if ((r = sys_ipc_recv(pg ? pg : (void *) UTOP)) < 0) {
+  802abb:	85 c0                	test   %eax,%eax
+  802abd:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802ac2:	0f 44 c2             	cmove  %edx,%eax
+  802ac5:	83 ec 0c             	sub    $0xc,%esp
+  802ac8:	50                   	push   %eax
+  802ac9:	e8 2f ef ff ff       	call   8019fd <sys_ipc_recv>
+  802ace:	83 c4 10             	add    $0x10,%esp
+  802ad1:	85 c0                	test   %eax,%eax
+  802ad3:	78 34                	js     802b09 <ipc_recv+0x5c>
+			*from_env_store = 0;
+		if (perm_store)
+			*perm_store = 0;
+		return r;
+	}
+	if (from_env_store)
+  802ad5:	85 f6                	test   %esi,%esi
+  802ad7:	74 0d                	je     802ae6 <ipc_recv+0x39>
+		*from_env_store = thisenv->env_ipc_from;
+  802ad9:	a1 08 40 80 00       	mov    0x804008,%eax
+  802ade:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  802ae4:	89 06                	mov    %eax,(%esi)
+	if (perm_store)
+  802ae6:	85 db                	test   %ebx,%ebx
+  802ae8:	74 0d                	je     802af7 <ipc_recv+0x4a>
+		*perm_store = thisenv->env_ipc_perm;
+  802aea:	a1 08 40 80 00       	mov    0x804008,%eax
+  802aef:	8b 80 9c 00 00 00    	mov    0x9c(%eax),%eax
+  802af5:	89 03                	mov    %eax,(%ebx)
+	return thisenv->env_ipc_msg.m_w[0];
+  802af7:	a1 08 40 80 00       	mov    0x804008,%eax
+  802afc:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802b02:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b05:	5b                   	pop    %ebx
+  802b06:	5e                   	pop    %esi
+  802b07:	5d                   	pop    %ebp
+  802b08:	c3                   	ret
+		if (from_env_store)
+  802b09:	85 f6                	test   %esi,%esi
+  802b0b:	74 06                	je     802b13 <ipc_recv+0x66>
+			*from_env_store = 0;
+  802b0d:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802b13:	85 db                	test   %ebx,%ebx
+  802b15:	74 eb                	je     802b02 <ipc_recv+0x55>
+			*perm_store = 0;
+  802b17:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802b1d:	eb e3                	jmp    802b02 <ipc_recv+0x55>
+
+00802b1f <ipc_send>:
+//
+// The kernel queues us behind any other senders until 'toenv'
+// receives, so we only come back to retry if its queue was full.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802b1f:	55                   	push   %ebp
+  802b20:	89 e5                	mov    %esp,%ebp
+  802b22:	57                   	push   %edi
+  802b23:	56                   	push   %esi
+  802b24:	53                   	push   %ebx
+  802b25:	83 ec 0c             	sub    $0xc,%esp
+  802b28:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b2b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b2e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_send(to_env, val, pg ? pg : (void *) UTOP, perm))
+  802b31:	85 db                	test   %ebx,%ebx
+  802b33:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802b38:	0f 44 d8             	cmove  %eax,%ebx
+  802b3b:	eb 05                	jmp    802b42 <ipc_send+0x23>
+	       == -E_AGAIN)
+		sys_yield();
+  802b3d:	e8 fc e8 ff ff       	call   80143e <sys_yield>
+	while ((r = sys_ipc_send(to_env, val, pg ? pg : (void *) UTOP, perm))
+  802b42:	ff 75 14             	push   0x14(%ebp)
+  802b45:	53                   	push   %ebx
+  802b46:	56                   	push   %esi
+  802b47:	57                   	push   %edi
+  802b48:	e8 09 ee ff ff       	call   801956 <sys_ipc_send>
+	       == -E_AGAIN)
+  802b4d:	83 c4 10             	add    $0x10,%esp
+  802b50:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802b53:	74 e8                	je     802b3d <ipc_send+0x1e>
+	if (r < 0)
+  802b55:	85 c0                	test   %eax,%eax
+  802b57:	78 08                	js     802b61 <ipc_send+0x42>
+		panic("ipc_send: %e", r);
+}
+  802b59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b5c:	5b                   	pop    %ebx
+  802b5d:	5e                   	pop    %esi
+  802b5e:	5f                   	pop    %edi
+  802b5f:	5d                   	pop    %ebp
+  802b60:	c3                   	ret
+		panic("ipc_send: %e", r);
+  802b61:	50                   	push   %eax
+  802b62:	68 15 34 80 00       	push   $0x803415
+  802b67:	6a 3a                	push   $0x3a
+  802b69:	68 22 34 80 00       	push   $0x803422
+  802b6e:	e8 82 d6 ff ff       	call   8001f5 <_panic>
+
+00802b73 <ipc_send_range>:
+
+// Like ipc_send, but send the 'npages' contiguous pages at 'pg' in one
+// message.  The receiver maps as many as fit in its window.
+void
+ipc_send_range(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  802b73:	55                   	push   %ebp
+  802b74:	89 e5                	mov    %esp,%ebp
+  802b76:	57                   	push   %edi
+  802b77:	56                   	push   %esi
+  802b78:	53                   	push   %ebx
+  802b79:	83 ec 0c             	sub    $0xc,%esp
+  802b7c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b7f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b82:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_send_range(to_env, val, pg, npages, perm))
+  802b85:	eb 05                	jmp    802b8c <ipc_send_range+0x19>
+	       == -E_AGAIN)
+		sys_yield();
+  802b87:	e8 b2 e8 ff ff       	call   80143e <sys_yield>
+	while ((r = sys_ipc_send_range(to_env, val, pg, npages, perm))
+  802b8c:	83 ec 0c             	sub    $0xc,%esp
+  802b8f:	ff 75 18             	push   0x18(%ebp)
+  802b92:	ff 75 14             	push   0x14(%ebp)
+  802b95:	53                   	push   %ebx
+  802b96:	56                   	push   %esi
+  802b97:	57                   	push   %edi
+  802b98:	e8 22 ef ff ff       	call   801abf <sys_ipc_send_range>
+	       == -E_AGAIN)
+  802b9d:	83 c4 20             	add    $0x20,%esp
+  802ba0:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802ba3:	74 e2                	je     802b87 <ipc_send_range+0x14>
+	if (r < 0)
+  802ba5:	85 c0                	test   %eax,%eax
+  802ba7:	78 08                	js     802bb1 <ipc_send_range+0x3e>
+		panic("ipc_send_range: %e", r);
+}
+  802ba9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bac:	5b                   	pop    %ebx
+  802bad:	5e                   	pop    %esi
+  802bae:	5f                   	pop    %edi
+  802baf:	5d                   	pop    %ebp
+  802bb0:	c3                   	ret
+		panic("ipc_send_range: %e", r);
+  802bb1:	50                   	push   %eax
+  802bb2:	68 2c 34 80 00       	push   $0x80342c
+  802bb7:	6a 48                	push   $0x48
+  802bb9:	68 22 34 80 00       	push   $0x803422
+  802bbe:	e8 32 d6 ff ff       	call   8001f5 <_panic>
+
+00802bc3 <ipc_recv_range>:
+// (which must not be null).  On return *npages holds the number of
+// pages received, which is 0 on error or if the sender sent none.
+int32_t
+ipc_recv_range(envid_t *from_env_store, void *pg, size_t *npages,
+	       int *perm_store)
+{
+  802bc3:	55                   	push   %ebp
+  802bc4:	89 e5                	mov    %esp,%ebp
+  802bc6:	57                   	push   %edi
+  802bc7:	56                   	push   %esi
+  802bc8:	53                   	push   %ebx
+  802bc9:	83 ec 14             	sub    $0x14,%esp
+  802bcc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802bcf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802bd2:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if ((r = sys_ipc_recv_range(pg, *npages)) < 0) {
+  802bd5:	ff 33                	push   (%ebx)
+  802bd7:	ff 75 0c             	push   0xc(%ebp)
+  802bda:	e8 83 ef ff ff       	call   801b62 <sys_ipc_recv_range>
+  802bdf:	83 c4 10             	add    $0x10,%esp
+  802be2:	85 c0                	test   %eax,%eax
+  802be4:	78 42                	js     802c28 <ipc_recv_range+0x65>
+		if (perm_store)
+			*perm_store = 0;
+		*npages = 0;
+		return r;
+	}
+	if (from_env_store)
+  802be6:	85 ff                	test   %edi,%edi
+  802be8:	74 0d                	je     802bf7 <ipc_recv_range+0x34>
+		*from_env_store = thisenv->env_ipc_from;
+  802bea:	a1 08 40 80 00       	mov    0x804008,%eax
+  802bef:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  802bf5:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  802bf7:	85 f6                	test   %esi,%esi
+  802bf9:	74 0d                	je     802c08 <ipc_recv_range+0x45>
+		*perm_store = thisenv->env_ipc_perm;
+  802bfb:	a1 08 40 80 00       	mov    0x804008,%eax
+  802c00:	8b 80 9c 00 00 00    	mov    0x9c(%eax),%eax
+  802c06:	89 06                	mov    %eax,(%esi)
+	*npages = thisenv->env_ipc_npages;
+  802c08:	a1 08 40 80 00       	mov    0x804008,%eax
+  802c0d:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802c13:	89 03                	mov    %eax,(%ebx)
+	return thisenv->env_ipc_msg.m_w[0];
+  802c15:	a1 08 40 80 00       	mov    0x804008,%eax
+  802c1a:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802c20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c23:	5b                   	pop    %ebx
+  802c24:	5e                   	pop    %esi
+  802c25:	5f                   	pop    %edi
+  802c26:	5d                   	pop    %ebp
+  802c27:	c3                   	ret
+		if (from_env_store)
+  802c28:	85 ff                	test   %edi,%edi
+  802c2a:	74 06                	je     802c32 <ipc_recv_range+0x6f>
+			*from_env_store = 0;
+  802c2c:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  802c32:	85 f6                	test   %esi,%esi
+  802c34:	74 06                	je     802c3c <ipc_recv_range+0x79>
+			*perm_store = 0;
+  802c36:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		*npages = 0;
+  802c3c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		return r;
+  802c42:	eb dc                	jmp    802c20 <ipc_recv_range+0x5d>
+
+00802c44 <ipc_send_msg>:
+// Send the IPC_MSG_WORDS words of 'msg' to 'to_env', in registers and
+// without a page.  Waits like ipc_send until 'to_env' takes them, and
+// panics on any error other than -E_AGAIN.
+void
+ipc_send_msg(envid_t to_env, const struct ipc_msg *msg)
+{
+  802c44:	55                   	push   %ebp
+  802c45:	89 e5                	mov    %esp,%ebp
+  802c47:	56                   	push   %esi
+  802c48:	53                   	push   %ebx
+  802c49:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c4c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_send_msg(to_env, msg)) == -E_AGAIN)
+  802c4f:	eb 05                	jmp    802c56 <ipc_send_msg+0x12>
+		sys_yield();
+  802c51:	e8 e8 e7 ff ff       	call   80143e <sys_yield>
+	while ((r = sys_ipc_send_msg(to_env, msg)) == -E_AGAIN)
+  802c56:	83 ec 08             	sub    $0x8,%esp
+  802c59:	53                   	push   %ebx
+  802c5a:	56                   	push   %esi
+  802c5b:	e8 3a f0 ff ff       	call   801c9a <sys_ipc_send_msg>
+  802c60:	83 c4 10             	add    $0x10,%esp
+  802c63:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802c66:	74 e9                	je     802c51 <ipc_send_msg+0xd>
+	if (r < 0)
+  802c68:	85 c0                	test   %eax,%eax
+  802c6a:	78 07                	js     802c73 <ipc_send_msg+0x2f>
+		panic("ipc_send_msg: %e", r);
+}
+  802c6c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c6f:	5b                   	pop    %ebx
+  802c70:	5e                   	pop    %esi
+  802c71:	5d                   	pop    %ebp
+  802c72:	c3                   	ret
+		panic("ipc_send_msg: %e", r);
+  802c73:	50                   	push   %eax
+  802c74:	68 3f 34 80 00       	push   $0x80343f
+  802c79:	6a 6f                	push   $0x6f
+  802c7b:	68 22 34 80 00       	push   $0x803422
+  802c80:	e8 70 d5 ff ff       	call   8001f5 <_panic>
+
+00802c85 <ipc_recv_msg>:
+// ipc_call or plain ipc_send (whose value is word 0, and whose page is
+// not taken), it arrives in registers and needs no page.
+// Returns the sender's envid, < 0 on error.
+envid_t
+ipc_recv_msg(struct ipc_msg *msg)
+{
+  802c85:	55                   	push   %ebp
+  802c86:	89 e5                	mov    %esp,%ebp
+  802c88:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_reply_wait(0, msg);
+  802c8b:	ff 75 08             	push   0x8(%ebp)
+  802c8e:	6a 00                	push   $0x0
+  802c90:	e8 cb ef ff ff       	call   801c60 <sys_ipc_reply_wait>
+}
+  802c95:	c9                   	leave
+  802c96:	c3                   	ret
+
+00802c97 <ipc_call>:
+// ipc_reply_wait (or ipc_recv), and straight back when it replies.
+// Retries while to_env's queue is full.
+// Returns 0 on success, < 0 on error.
+int
+ipc_call(envid_t to_env, struct ipc_msg *msg)
+{
+  802c97:	55                   	push   %ebp
+  802c98:	89 e5                	mov    %esp,%ebp
+  802c9a:	56                   	push   %esi
+  802c9b:	53                   	push   %ebx
+  802c9c:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c9f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_call(to_env, msg)) == -E_AGAIN)
+  802ca2:	eb 05                	jmp    802ca9 <ipc_call+0x12>
+		sys_yield();
+  802ca4:	e8 95 e7 ff ff       	call   80143e <sys_yield>
+	while ((r = sys_ipc_call(to_env, msg)) == -E_AGAIN)
+  802ca9:	83 ec 08             	sub    $0x8,%esp
+  802cac:	53                   	push   %ebx
+  802cad:	56                   	push   %esi
+  802cae:	e8 73 ef ff ff       	call   801c26 <sys_ipc_call>
+  802cb3:	83 c4 10             	add    $0x10,%esp
+  802cb6:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802cb9:	74 e9                	je     802ca4 <ipc_call+0xd>
+	return r;
+}
+  802cbb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cbe:	5b                   	pop    %ebx
+  802cbf:	5e                   	pop    %esi
+  802cc0:	5d                   	pop    %ebp
+  802cc1:	c3                   	ret
+
+00802cc2 <ipc_reply_wait>:
+//	}
+//
+// Returns the envid of the sender, < 0 on error.
+envid_t
+ipc_reply_wait(envid_t to_env, struct ipc_msg *msg)
+{
+  802cc2:	55                   	push   %ebp
+  802cc3:	89 e5                	mov    %esp,%ebp
+  802cc5:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_reply_wait(to_env, msg);
+  802cc8:	ff 75 0c             	push   0xc(%ebp)
+  802ccb:	ff 75 08             	push   0x8(%ebp)
+  802cce:	e8 8d ef ff ff       	call   801c60 <sys_ipc_reply_wait>
+}
+  802cd3:	c9                   	leave
+  802cd4:	c3                   	ret
+
+00802cd5 <ep_send>:
+
+// Send 'msg' to endpoint 'epid', waiting while its queue is full.
+// Returns 0 on success, < 0 if the endpoint is gone or not ours to use.
+int
+ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  802cd5:	55                   	push   %ebp
+  802cd6:	89 e5                	mov    %esp,%ebp
+  802cd8:	56                   	push   %esi
+  802cd9:	53                   	push   %ebx
+  802cda:	8b 75 08             	mov    0x8(%ebp),%esi
+  802cdd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ep_send(epid, msg)) == -E_AGAIN)
+  802ce0:	eb 05                	jmp    802ce7 <ep_send+0x12>
+		sys_yield();
+  802ce2:	e8 57 e7 ff ff       	call   80143e <sys_yield>
+	while ((r = sys_ep_send(epid, msg)) == -E_AGAIN)
+  802ce7:	83 ec 08             	sub    $0x8,%esp
+  802cea:	53                   	push   %ebx
+  802ceb:	56                   	push   %esi
+  802cec:	e8 c6 f8 ff ff       	call   8025b7 <sys_ep_send>
+  802cf1:	83 c4 10             	add    $0x10,%esp
+  802cf4:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802cf7:	74 e9                	je     802ce2 <ep_send+0xd>
+	return r;
+}
+  802cf9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cfc:	5b                   	pop    %ebx
+  802cfd:	5e                   	pop    %esi
+  802cfe:	5d                   	pop    %ebp
+  802cff:	c3                   	ret
+
+00802d00 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802d00:	55                   	push   %ebp
+  802d01:	89 e5                	mov    %esp,%ebp
+  802d03:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802d06:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802d0b:	69 d0 68 01 00 00    	imul   $0x168,%eax,%edx
+  802d11:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802d17:	8b 52 50             	mov    0x50(%edx),%edx
+  802d1a:	39 ca                	cmp    %ecx,%edx
+  802d1c:	74 11                	je     802d2f <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802d1e:	83 c0 01             	add    $0x1,%eax
+  802d21:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802d26:	75 e3                	jne    802d0b <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802d28:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d2d:	eb 0e                	jmp    802d3d <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802d2f:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802d35:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802d3a:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802d3d:	5d                   	pop    %ebp
+  802d3e:	c3                   	ret
+
+00802d3f <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802d3f:	55                   	push   %ebp
+  802d40:	89 e5                	mov    %esp,%ebp
+  802d42:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  802d45:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  802d4c:	74 0a                	je     802d58 <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  802d4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d51:	a3 0c 40 80 00       	mov    %eax,0x80400c
+}
+  802d56:	c9                   	leave
+  802d57:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE),
+  802d58:	83 ec 04             	sub    $0x4,%esp
+  802d5b:	6a 07                	push   $0x7
+  802d5d:	68 00 f0 bf ee       	push   $0xeebff000
+  802d62:	6a 00                	push   $0x0
+  802d64:	e8 c3 e3 ff ff       	call   80112c <sys_page_alloc>
+  802d69:	83 c4 10             	add    $0x10,%esp
+  802d6c:	85 c0                	test   %eax,%eax
+  802d6e:	78 28                	js     802d98 <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  802d70:	83 ec 08             	sub    $0x8,%esp
+  802d73:	68 aa 2d 80 00       	push   $0x802daa
+  802d78:	6a 00                	push   $0x0
+  802d7a:	e8 6c ea ff ff       	call   8017eb <sys_env_set_pgfault_upcall>
+  802d7f:	83 c4 10             	add    $0x10,%esp
+  802d82:	85 c0                	test   %eax,%eax
+  802d84:	79 c8                	jns    802d4e <set_pgfault_handler+0xf>
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+  802d86:	50                   	push   %eax
+  802d87:	68 78 34 80 00       	push   $0x803478
+  802d8c:	6a 24                	push   $0x24
+  802d8e:	68 ac 34 80 00       	push   $0x8034ac
+  802d93:	e8 5d d4 ff ff       	call   8001f5 <_panic>
+			panic("set_pgfault_handler: sys_page_alloc: %e", r);
+  802d98:	50                   	push   %eax
+  802d99:	68 50 34 80 00       	push   $0x803450
+  802d9e:	6a 22                	push   $0x22
+  802da0:	68 ac 34 80 00       	push   $0x8034ac
+  802da5:	e8 4b d4 ff ff       	call   8001f5 <_panic>
+
+00802daa <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802daa:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802dab:	a1 0c 40 80 00       	mov    0x80400c,%eax
+	call *%eax
+  802db0:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802db2:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 0x28(%esp), %ebx		// trap-time eip
+  802db5:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl 0x30(%esp), %eax		// trap-time esp
+  802db9:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  802dbd:	83 e8 04             	sub    $0x4,%eax
+	movl %ebx, (%eax)
+  802dc0:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 0x30(%esp)
+  802dc2:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp			// skip fault_va and err
+  802dc6:	83 c4 08             	add    $0x8,%esp
+	popal
+  802dc9:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp			// skip eip
+  802dca:	83 c4 04             	add    $0x4,%esp
+	popfl
+  802dcd:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802dce:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802dcf:	c3                   	ret
+
+00802dd0 <dm>:
+  802dd0:	55                   	push   %ebp
+  802dd1:	57                   	push   %edi
+  802dd2:	56                   	push   %esi
+  802dd3:	53                   	push   %ebx
+  802dd4:	83 ec 24             	sub    $0x24,%esp
+  802dd7:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802ddb:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802ddf:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802de3:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802de7:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802deb:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802def:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802df3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802df8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dfd:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802e02:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802e09:	00 
+  802e0a:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802e11:	00 
+  802e12:	89 fb                	mov    %edi,%ebx
+  802e14:	eb 08                	jmp    802e1e <dm+0x4e>
+  802e16:	83 e9 01             	sub    $0x1,%ecx
+  802e19:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802e1c:	74 68                	je     802e86 <dm+0xb6>
+  802e1e:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802e22:	01 c0                	add    %eax,%eax
+  802e24:	89 c6                	mov    %eax,%esi
+  802e26:	89 d7                	mov    %edx,%edi
+  802e28:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802e2c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802e30:	0f ad d0             	shrd   %cl,%edx,%eax
+  802e33:	d3 ea                	shr    %cl,%edx
+  802e35:	f6 c1 20             	test   $0x20,%cl
+  802e38:	74 04                	je     802e3e <dm+0x6e>
+  802e3a:	89 d0                	mov    %edx,%eax
+  802e3c:	31 d2                	xor    %edx,%edx
+  802e3e:	83 e0 01             	and    $0x1,%eax
+  802e41:	89 04 24             	mov    %eax,(%esp)
+  802e44:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802e4b:	00 
+  802e4c:	8b 04 24             	mov    (%esp),%eax
+  802e4f:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802e53:	09 f0                	or     %esi,%eax
+  802e55:	09 fa                	or     %edi,%edx
+  802e57:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802e5b:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802e5f:	39 f0                	cmp    %esi,%eax
+  802e61:	89 d5                	mov    %edx,%ebp
+  802e63:	19 fd                	sbb    %edi,%ebp
+  802e65:	72 af                	jb     802e16 <dm+0x46>
+  802e67:	29 f0                	sub    %esi,%eax
+  802e69:	19 fa                	sbb    %edi,%edx
+  802e6b:	89 cf                	mov    %ecx,%edi
+  802e6d:	c1 ef 05             	shr    $0x5,%edi
+  802e70:	83 e7 01             	and    $0x1,%edi
+  802e73:	89 fe                	mov    %edi,%esi
+  802e75:	83 f6 01             	xor    $0x1,%esi
+  802e78:	d3 e6                	shl    %cl,%esi
+  802e7a:	d3 e7                	shl    %cl,%edi
+  802e7c:	09 74 24 18          	or     %esi,0x18(%esp)
+  802e80:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802e84:	eb 90                	jmp    802e16 <dm+0x46>
+  802e86:	85 db                	test   %ebx,%ebx
+  802e88:	74 05                	je     802e8f <dm+0xbf>
+  802e8a:	89 03                	mov    %eax,(%ebx)
+  802e8c:	89 53 04             	mov    %edx,0x4(%ebx)
+  802e8f:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802e93:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802e97:	83 c4 24             	add    $0x24,%esp
+  802e9a:	5b                   	pop    %ebx
+  802e9b:	5e                   	pop    %esi
+  802e9c:	5f                   	pop    %edi
+  802e9d:	5d                   	pop    %ebp
+  802e9e:	c3                   	ret
+
+00802e9f <__udivdi3>:
+  802e9f:	83 ec 08             	sub    $0x8,%esp
+  802ea2:	6a 00                	push   $0x0
+  802ea4:	ff 74 24 1c          	push   0x1c(%esp)
+  802ea8:	ff 74 24 1c          	push   0x1c(%esp)
+  802eac:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802eb0:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802eb4:	e8 17 ff ff ff       	call   802dd0 <dm>
+  802eb9:	83 c4 14             	add    $0x14,%esp
+  802ebc:	c3                   	ret
+
+00802ebd <__umoddi3>:
+  802ebd:	83 ec 18             	sub    $0x18,%esp
+  802ec0:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802ec4:	50                   	push   %eax
+  802ec5:	ff 74 24 2c          	push   0x2c(%esp)
+  802ec9:	ff 74 24 2c          	push   0x2c(%esp)
+  802ecd:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802ed1:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802ed5:	e8 f6 fe ff ff       	call   802dd0 <dm>
+  802eda:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802ede:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802ee2:	83 c4 24             	add    $0x24,%esp
+  802ee5:	c3                   	ret
+
+00802ee6 <__divdi3>:
+  802ee6:	53                   	push   %ebx
+  802ee7:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802eeb:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802eef:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  802ef3:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  802ef7:	85 d2                	test   %edx,%edx
+  802ef9:	78 15                	js     802f10 <__divdi3+0x2a>
+  802efb:	85 db                	test   %ebx,%ebx
+  802efd:	78 34                	js     802f33 <__divdi3+0x4d>
+  802eff:	83 ec 04             	sub    $0x4,%esp
+  802f02:	6a 00                	push   $0x0
+  802f04:	53                   	push   %ebx
+  802f05:	51                   	push   %ecx
+  802f06:	e8 c5 fe ff ff       	call   802dd0 <dm>
+  802f0b:	83 c4 10             	add    $0x10,%esp
+  802f0e:	eb 21                	jmp    802f31 <__divdi3+0x4b>
+  802f10:	f7 d8                	neg    %eax
+  802f12:	83 d2 00             	adc    $0x0,%edx
+  802f15:	f7 da                	neg    %edx
+  802f17:	85 db                	test   %ebx,%ebx
+  802f19:	78 30                	js     802f4b <__divdi3+0x65>
+  802f1b:	83 ec 04             	sub    $0x4,%esp
+  802f1e:	6a 00                	push   $0x0
+  802f20:	53                   	push   %ebx
+  802f21:	51                   	push   %ecx
+  802f22:	e8 a9 fe ff ff       	call   802dd0 <dm>
+  802f27:	83 c4 10             	add    $0x10,%esp
+  802f2a:	f7 d8                	neg    %eax
+  802f2c:	83 d2 00             	adc    $0x0,%edx
+  802f2f:	f7 da                	neg    %edx
+  802f31:	5b                   	pop    %ebx
+  802f32:	c3                   	ret
+  802f33:	83 ec 04             	sub    $0x4,%esp
+  802f36:	6a 00                	push   $0x0
+  802f38:	f7 d9                	neg    %ecx
+  802f3a:	83 d3 00             	adc    $0x0,%ebx
+  802f3d:	f7 db                	neg    %ebx
+  802f3f:	53                   	push   %ebx
+  802f40:	51                   	push   %ecx
+  802f41:	e8 8a fe ff ff       	call   802dd0 <dm>
+  802f46:	83 c4 10             	add    $0x10,%esp
+  802f49:	eb df                	jmp    802f2a <__divdi3+0x44>
+  802f4b:	83 ec 04             	sub    $0x4,%esp
+  802f4e:	6a 00                	push   $0x0
+  802f50:	f7 d9                	neg    %ecx
+  802f52:	83 d3 00             	adc    $0x0,%ebx
+  802f55:	f7 db                	neg    %ebx
+  802f57:	53                   	push   %ebx
+  802f58:	51                   	push   %ecx
+  802f59:	e8 72 fe ff ff       	call   802dd0 <dm>
+  802f5e:	83 c4 10             	add    $0x10,%esp
+  802f61:	eb ce                	jmp    802f31 <__divdi3+0x4b>
+
+00802f63 <__moddi3>:
+  802f63:	55                   	push   %ebp
+  802f64:	57                   	push   %edi
+  802f65:	56                   	push   %esi
+  802f66:	53                   	push   %ebx
+  802f67:	83 ec 18             	sub    $0x18,%esp
+  802f6a:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802f6e:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802f72:	89 f1                	mov    %esi,%ecx
+  802f74:	f7 d9                	neg    %ecx
+  802f76:	89 da                	mov    %ebx,%edx
+  802f78:	83 d2 00             	adc    $0x0,%edx
+  802f7b:	f7 da                	neg    %edx
+  802f7d:	0f 48 ce             	cmovs  %esi,%ecx
+  802f80:	0f 48 d3             	cmovs  %ebx,%edx
+  802f83:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802f87:	50                   	push   %eax
+  802f88:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802f8c:	f7 de                	neg    %esi
+  802f8e:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802f92:	83 d0 00             	adc    $0x0,%eax
+  802f95:	f7 d8                	neg    %eax
+  802f97:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802f9c:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802fa1:	50                   	push   %eax
+  802fa2:	56                   	push   %esi
+  802fa3:	89 c8                	mov    %ecx,%eax
+  802fa5:	e8 26 fe ff ff       	call   802dd0 <dm>
+  802faa:	83 c4 10             	add    $0x10,%esp
+  802fad:	85 db                	test   %ebx,%ebx
+  802faf:	78 10                	js     802fc1 <__moddi3+0x5e>
+  802fb1:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802fb5:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802fb9:	83 c4 14             	add    $0x14,%esp
+  802fbc:	5b                   	pop    %ebx
+  802fbd:	5e                   	pop    %esi
+  802fbe:	5f                   	pop    %edi
+  802fbf:	5d                   	pop    %ebp
+  802fc0:	c3                   	ret
+  802fc1:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802fc5:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802fc9:	f7 d8                	neg    %eax
+  802fcb:	83 d2 00             	adc    $0x0,%edx
+  802fce:	f7 da                	neg    %edx
+  802fd0:	eb e7                	jmp    802fb9 <__moddi3+0x56>
@@ -0,0 +1,6247 @@
+
+obj/user/pagemove:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 dd 01 00 00       	call   80020e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <produce>:
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+}
+
+static void
+produce(envid_t consumer, uint32_t i, bool move)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 10             	sub    $0x10,%esp
+  80003c:	89 c7                	mov    %eax,%edi
+  80003e:	89 d3                	mov    %edx,%ebx
+  800040:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	if ((r = sys_page_alloc(0, buf, PERM)) < 0)
+  800042:	6a 07                	push   $0x7
+  800044:	68 00 00 00 10       	push   $0x10000000
+  800049:	6a 00                	push   $0x0
+  80004b:	e8 50 11 00 00       	call   8011a0 <sys_page_alloc>
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	85 c0                	test   %eax,%eax
+  800055:	78 44                	js     80009b <produce+0x68>
+		panic("sys_page_alloc: %e", r);
+	buf[0] = i;
+  800057:	89 1d 00 00 00 10    	mov    %ebx,0x10000000
+	if (move) {
+  80005d:	89 f0                	mov    %esi,%eax
+  80005f:	84 c0                	test   %al,%al
+  800061:	74 4a                	je     8000ad <produce+0x7a>
+		ipc_send(consumer, i, buf, PERM | PAGE_MOVE);
+  800063:	68 07 20 00 00       	push   $0x2007
+  800068:	68 00 00 00 10       	push   $0x10000000
+  80006d:	53                   	push   %ebx
+  80006e:	57                   	push   %edi
+  80006f:	e8 1f 2b 00 00       	call   802b93 <ipc_send>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  800074:	a1 00 d1 7b ef       	mov    0xef7bd100,%eax
+  800079:	83 c4 10             	add    $0x10,%esp
+  80007c:	a8 01                	test   $0x1,%al
+  80007e:	74 51                	je     8000d1 <produce+0x9e>
+  800080:	a1 00 00 44 ef       	mov    0xef440000,%eax
+		if (mapped(buf))
+  800085:	a8 01                	test   $0x1,%al
+  800087:	74 48                	je     8000d1 <produce+0x9e>
+			panic("page %d still mapped after a move", i);
+  800089:	53                   	push   %ebx
+  80008a:	68 bc 30 80 00       	push   $0x8030bc
+  80008f:	6a 2e                	push   $0x2e
+  800091:	68 73 30 80 00       	push   $0x803073
+  800096:	e8 ce 01 00 00       	call   800269 <_panic>
+		panic("sys_page_alloc: %e", r);
+  80009b:	50                   	push   %eax
+  80009c:	68 60 30 80 00       	push   $0x803060
+  8000a1:	6a 29                	push   $0x29
+  8000a3:	68 73 30 80 00       	push   $0x803073
+  8000a8:	e8 bc 01 00 00       	call   800269 <_panic>
+	} else {
+		ipc_send(consumer, i, buf, PERM);
+  8000ad:	6a 07                	push   $0x7
+  8000af:	68 00 00 00 10       	push   $0x10000000
+  8000b4:	53                   	push   %ebx
+  8000b5:	57                   	push   %edi
+  8000b6:	e8 d8 2a 00 00       	call   802b93 <ipc_send>
+		if ((r = sys_page_unmap(0, buf)) < 0)
+  8000bb:	83 c4 08             	add    $0x8,%esp
+  8000be:	68 00 00 00 10       	push   $0x10000000
+  8000c3:	6a 00                	push   $0x0
+  8000c5:	e8 60 12 00 00       	call   80132a <sys_page_unmap>
+  8000ca:	83 c4 10             	add    $0x10,%esp
+  8000cd:	85 c0                	test   %eax,%eax
+  8000cf:	78 08                	js     8000d9 <produce+0xa6>
+			panic("sys_page_unmap: %e", r);
+	}
+}
+  8000d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000d4:	5b                   	pop    %ebx
+  8000d5:	5e                   	pop    %esi
+  8000d6:	5f                   	pop    %edi
+  8000d7:	5d                   	pop    %ebp
+  8000d8:	c3                   	ret
+			panic("sys_page_unmap: %e", r);
+  8000d9:	50                   	push   %eax
+  8000da:	68 83 30 80 00       	push   $0x803083
+  8000df:	6a 32                	push   $0x32
+  8000e1:	68 73 30 80 00       	push   $0x803073
+  8000e6:	e8 7e 01 00 00       	call   800269 <_panic>
+
+008000eb <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000eb:	55                   	push   %ebp
+  8000ec:	89 e5                	mov    %esp,%ebp
+  8000ee:	56                   	push   %esi
+  8000ef:	53                   	push   %ebx
+  8000f0:	83 ec 20             	sub    $0x20,%esp
+	envid_t child;
+	uint64_t start;
+	uint32_t i;
+
+	if ((child = fork()) < 0)
+  8000f3:	e8 da 29 00 00       	call   802ad2 <fork>
+  8000f8:	89 c6                	mov    %eax,%esi
+  8000fa:	85 c0                	test   %eax,%eax
+  8000fc:	0f 88 bb 00 00 00    	js     8001bd <umain+0xd2>
+		panic("fork: %e", child);
+	if (child == 0) {
+  800102:	0f 84 c7 00 00 00    	je     8001cf <umain+0xe4>
+
+static inline uint64_t
+read_tsc(void)
+{
+	uint64_t tsc;
+	asm volatile("rdtsc" : "=A" (tsc));
+  800108:	0f 31                	rdtsc
+  80010a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80010d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+		consumer();
+		return;
+	}
+
+	start = read_tsc();
+	for (i = 0; i < NROUNDS; i++)
+  800110:	bb 00 00 00 00       	mov    $0x0,%ebx
+		produce(child, i, 0);
+  800115:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80011a:	89 da                	mov    %ebx,%edx
+  80011c:	89 f0                	mov    %esi,%eax
+  80011e:	e8 10 ff ff ff       	call   800033 <produce>
+	for (i = 0; i < NROUNDS; i++)
+  800123:	83 c3 01             	add    $0x1,%ebx
+  800126:	81 fb d0 07 00 00    	cmp    $0x7d0,%ebx
+  80012c:	75 e7                	jne    800115 <umain+0x2a>
+  80012e:	0f 31                	rdtsc
+	cprintf("share+unmap %6d pages %8llu cycles/page\n",
+		NROUNDS, (read_tsc() - start) / NROUNDS);
+  800130:	2b 45 e0             	sub    -0x20(%ebp),%eax
+  800133:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+	cprintf("share+unmap %6d pages %8llu cycles/page\n",
+  800136:	6a 00                	push   $0x0
+  800138:	68 d0 07 00 00       	push   $0x7d0
+  80013d:	52                   	push   %edx
+  80013e:	50                   	push   %eax
+  80013f:	e8 cf 2d 00 00       	call   802f13 <__udivdi3>
+  800144:	83 c4 10             	add    $0x10,%esp
+  800147:	52                   	push   %edx
+  800148:	50                   	push   %eax
+  800149:	68 d0 07 00 00       	push   $0x7d0
+  80014e:	68 e0 30 80 00       	push   $0x8030e0
+  800153:	e8 25 02 00 00       	call   80037d <cprintf>
+  800158:	0f 31                	rdtsc
+  80015a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80015d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  800160:	83 c4 10             	add    $0x10,%esp
+
+	start = read_tsc();
+	for (i = 0; i < NROUNDS; i++)
+  800163:	bb 00 00 00 00       	mov    $0x0,%ebx
+		produce(child, i, 1);
+  800168:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80016d:	89 da                	mov    %ebx,%edx
+  80016f:	89 f0                	mov    %esi,%eax
+  800171:	e8 bd fe ff ff       	call   800033 <produce>
+	for (i = 0; i < NROUNDS; i++)
+  800176:	83 c3 01             	add    $0x1,%ebx
+  800179:	81 fb d0 07 00 00    	cmp    $0x7d0,%ebx
+  80017f:	75 e7                	jne    800168 <umain+0x7d>
+  800181:	0f 31                	rdtsc
+	cprintf("move        %6d pages %8llu cycles/page\n",
+		NROUNDS, (read_tsc() - start) / NROUNDS);
+  800183:	2b 45 e0             	sub    -0x20(%ebp),%eax
+  800186:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+	cprintf("move        %6d pages %8llu cycles/page\n",
+  800189:	6a 00                	push   $0x0
+  80018b:	68 d0 07 00 00       	push   $0x7d0
+  800190:	52                   	push   %edx
+  800191:	50                   	push   %eax
+  800192:	e8 7c 2d 00 00       	call   802f13 <__udivdi3>
+  800197:	83 c4 10             	add    $0x10,%esp
+  80019a:	52                   	push   %edx
+  80019b:	50                   	push   %eax
+  80019c:	68 d0 07 00 00       	push   $0x7d0
+  8001a1:	68 0c 31 80 00       	push   $0x80310c
+  8001a6:	e8 d2 01 00 00       	call   80037d <cprintf>
+
+	sys_env_destroy(child);
+  8001ab:	89 34 24             	mov    %esi,(%esp)
+  8001ae:	e8 8c 0e 00 00       	call   80103f <sys_env_destroy>
+  8001b3:	83 c4 10             	add    $0x10,%esp
+}
+  8001b6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001b9:	5b                   	pop    %ebx
+  8001ba:	5e                   	pop    %esi
+  8001bb:	5d                   	pop    %ebp
+  8001bc:	c3                   	ret
+		panic("fork: %e", child);
+  8001bd:	50                   	push   %eax
+  8001be:	68 96 30 80 00       	push   $0x803096
+  8001c3:	6a 3e                	push   $0x3e
+  8001c5:	68 73 30 80 00       	push   $0x803073
+  8001ca:	e8 9a 00 00 00       	call   800269 <_panic>
+		i = ipc_recv(0, win, &perm);
+  8001cf:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+  8001d2:	83 ec 04             	sub    $0x4,%esp
+  8001d5:	53                   	push   %ebx
+  8001d6:	68 00 00 00 20       	push   $0x20000000
+  8001db:	6a 00                	push   $0x0
+  8001dd:	e8 3f 29 00 00       	call   802b21 <ipc_recv>
+		if (!perm || win[0] != i)
+  8001e2:	83 c4 10             	add    $0x10,%esp
+  8001e5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  8001e9:	74 08                	je     8001f3 <umain+0x108>
+  8001eb:	3b 05 00 00 00 20    	cmp    0x20000000,%eax
+  8001f1:	74 df                	je     8001d2 <umain+0xe7>
+			panic("consumer: page %d holds %d", i, win[0]);
+  8001f3:	83 ec 0c             	sub    $0xc,%esp
+  8001f6:	ff 35 00 00 00 20    	push   0x20000000
+  8001fc:	50                   	push   %eax
+  8001fd:	68 9f 30 80 00       	push   $0x80309f
+  800202:	6a 19                	push   $0x19
+  800204:	68 73 30 80 00       	push   $0x803073
+  800209:	e8 5b 00 00 00       	call   800269 <_panic>
+
+0080020e <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80020e:	55                   	push   %ebp
+  80020f:	89 e5                	mov    %esp,%ebp
+  800211:	56                   	push   %esi
+  800212:	53                   	push   %ebx
+  800213:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800216:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  800219:	e8 e3 0e 00 00       	call   801101 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  80021e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800223:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  800229:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80022e:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800233:	85 db                	test   %ebx,%ebx
+  800235:	7e 07                	jle    80023e <libmain+0x30>
+		binaryname = argv[0];
+  800237:	8b 06                	mov    (%esi),%eax
+  800239:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  80023e:	83 ec 08             	sub    $0x8,%esp
+  800241:	56                   	push   %esi
+  800242:	53                   	push   %ebx
+  800243:	e8 a3 fe ff ff       	call   8000eb <umain>
+
+	// exit gracefully
+	exit();
+  800248:	e8 0a 00 00 00       	call   800257 <exit>
+}
+  80024d:	83 c4 10             	add    $0x10,%esp
+  800250:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800253:	5b                   	pop    %ebx
+  800254:	5e                   	pop    %esi
+  800255:	5d                   	pop    %ebp
+  800256:	c3                   	ret
+
+00800257 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800257:	55                   	push   %ebp
+  800258:	89 e5                	mov    %esp,%ebp
+  80025a:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  80025d:	6a 00                	push   $0x0
+  80025f:	e8 db 0d 00 00       	call   80103f <sys_env_destroy>
+}
+  800264:	83 c4 10             	add    $0x10,%esp
+  800267:	c9                   	leave
+  800268:	c3                   	ret
+
+00800269 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800269:	55                   	push   %ebp
+  80026a:	89 e5                	mov    %esp,%ebp
+  80026c:	57                   	push   %edi
+  80026d:	56                   	push   %esi
+  80026e:	53                   	push   %ebx
+  80026f:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  800275:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  800278:	8b 1d 00 40 80 00    	mov    0x804000,%ebx
+  80027e:	e8 7e 0e 00 00       	call   801101 <sys_getenvid>
+  800283:	83 ec 04             	sub    $0x4,%esp
+  800286:	ff 75 0c             	push   0xc(%ebp)
+  800289:	ff 75 08             	push   0x8(%ebp)
+  80028c:	53                   	push   %ebx
+  80028d:	50                   	push   %eax
+  80028e:	68 40 31 80 00       	push   $0x803140
+  800293:	68 00 01 00 00       	push   $0x100
+  800298:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  80029e:	56                   	push   %esi
+  80029f:	e8 72 06 00 00       	call   800916 <snprintf>
+  8002a4:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  8002a6:	83 c4 20             	add    $0x20,%esp
+  8002a9:	57                   	push   %edi
+  8002aa:	ff 75 10             	push   0x10(%ebp)
+  8002ad:	bf 00 01 00 00       	mov    $0x100,%edi
+  8002b2:	89 f8                	mov    %edi,%eax
+  8002b4:	29 d8                	sub    %ebx,%eax
+  8002b6:	50                   	push   %eax
+  8002b7:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8002ba:	50                   	push   %eax
+  8002bb:	e8 08 06 00 00       	call   8008c8 <vsnprintf>
+  8002c0:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  8002c2:	83 c4 0c             	add    $0xc,%esp
+  8002c5:	68 63 31 80 00       	push   $0x803163
+  8002ca:	29 df                	sub    %ebx,%edi
+  8002cc:	57                   	push   %edi
+  8002cd:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8002d0:	50                   	push   %eax
+  8002d1:	e8 40 06 00 00       	call   800916 <snprintf>
+	sys_cputs(buf, r);
+  8002d6:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  8002d9:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  8002db:	53                   	push   %ebx
+  8002dc:	56                   	push   %esi
+  8002dd:	e8 21 0c 00 00       	call   800f03 <sys_cputs>
+  8002e2:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002e5:	cc                   	int3
+	while (1)
+  8002e6:	eb fd                	jmp    8002e5 <_panic+0x7c>
+
+008002e8 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002e8:	55                   	push   %ebp
+  8002e9:	89 e5                	mov    %esp,%ebp
+  8002eb:	53                   	push   %ebx
+  8002ec:	83 ec 04             	sub    $0x4,%esp
+  8002ef:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8002f2:	8b 13                	mov    (%ebx),%edx
+  8002f4:	8d 42 01             	lea    0x1(%edx),%eax
+  8002f7:	89 03                	mov    %eax,(%ebx)
+  8002f9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002fc:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800300:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800305:	74 09                	je     800310 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800307:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80030b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80030e:	c9                   	leave
+  80030f:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800310:	83 ec 08             	sub    $0x8,%esp
+  800313:	68 ff 00 00 00       	push   $0xff
+  800318:	8d 43 08             	lea    0x8(%ebx),%eax
+  80031b:	50                   	push   %eax
+  80031c:	e8 e2 0b 00 00       	call   800f03 <sys_cputs>
+		b->idx = 0;
+  800321:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800327:	83 c4 10             	add    $0x10,%esp
+  80032a:	eb db                	jmp    800307 <putch+0x1f>
+
+0080032c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80032c:	55                   	push   %ebp
+  80032d:	89 e5                	mov    %esp,%ebp
+  80032f:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800335:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80033c:	00 00 00 
+	b.cnt = 0;
+  80033f:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800346:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800349:	ff 75 0c             	push   0xc(%ebp)
+  80034c:	ff 75 08             	push   0x8(%ebp)
+  80034f:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800355:	50                   	push   %eax
+  800356:	68 e8 02 80 00       	push   $0x8002e8
+  80035b:	e8 14 01 00 00       	call   800474 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800360:	83 c4 08             	add    $0x8,%esp
+  800363:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800369:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80036f:	50                   	push   %eax
+  800370:	e8 8e 0b 00 00       	call   800f03 <sys_cputs>
+
+	return b.cnt;
+}
+  800375:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80037b:	c9                   	leave
+  80037c:	c3                   	ret
+
+0080037d <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80037d:	55                   	push   %ebp
+  80037e:	89 e5                	mov    %esp,%ebp
+  800380:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800383:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800386:	50                   	push   %eax
+  800387:	ff 75 08             	push   0x8(%ebp)
+  80038a:	e8 9d ff ff ff       	call   80032c <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80038f:	c9                   	leave
+  800390:	c3                   	ret
+
+00800391 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800391:	55                   	push   %ebp
+  800392:	89 e5                	mov    %esp,%ebp
+  800394:	57                   	push   %edi
+  800395:	56                   	push   %esi
+  800396:	53                   	push   %ebx
+  800397:	83 ec 1c             	sub    $0x1c,%esp
+  80039a:	89 c7                	mov    %eax,%edi
+  80039c:	89 d6                	mov    %edx,%esi
+  80039e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003a1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8003a4:	89 d1                	mov    %edx,%ecx
+  8003a6:	89 c2                	mov    %eax,%edx
+  8003a8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8003ab:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8003ae:	8b 45 10             	mov    0x10(%ebp),%eax
+  8003b1:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8003b4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003b7:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003be:	39 c2                	cmp    %eax,%edx
+  8003c0:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8003c3:	72 3e                	jb     800403 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003c5:	83 ec 0c             	sub    $0xc,%esp
+  8003c8:	ff 75 18             	push   0x18(%ebp)
+  8003cb:	83 eb 01             	sub    $0x1,%ebx
+  8003ce:	53                   	push   %ebx
+  8003cf:	50                   	push   %eax
+  8003d0:	83 ec 08             	sub    $0x8,%esp
+  8003d3:	ff 75 e4             	push   -0x1c(%ebp)
+  8003d6:	ff 75 e0             	push   -0x20(%ebp)
+  8003d9:	ff 75 dc             	push   -0x24(%ebp)
+  8003dc:	ff 75 d8             	push   -0x28(%ebp)
+  8003df:	e8 2f 2b 00 00       	call   802f13 <__udivdi3>
+  8003e4:	83 c4 18             	add    $0x18,%esp
+  8003e7:	52                   	push   %edx
+  8003e8:	50                   	push   %eax
+  8003e9:	89 f2                	mov    %esi,%edx
+  8003eb:	89 f8                	mov    %edi,%eax
+  8003ed:	e8 9f ff ff ff       	call   800391 <printnum>
+  8003f2:	83 c4 20             	add    $0x20,%esp
+  8003f5:	eb 13                	jmp    80040a <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8003f7:	83 ec 08             	sub    $0x8,%esp
+  8003fa:	56                   	push   %esi
+  8003fb:	ff 75 18             	push   0x18(%ebp)
+  8003fe:	ff d7                	call   *%edi
+  800400:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800403:	83 eb 01             	sub    $0x1,%ebx
+  800406:	85 db                	test   %ebx,%ebx
+  800408:	7f ed                	jg     8003f7 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80040a:	83 ec 08             	sub    $0x8,%esp
+  80040d:	56                   	push   %esi
+  80040e:	83 ec 04             	sub    $0x4,%esp
+  800411:	ff 75 e4             	push   -0x1c(%ebp)
+  800414:	ff 75 e0             	push   -0x20(%ebp)
+  800417:	ff 75 dc             	push   -0x24(%ebp)
+  80041a:	ff 75 d8             	push   -0x28(%ebp)
+  80041d:	e8 0f 2b 00 00       	call   802f31 <__umoddi3>
+  800422:	83 c4 14             	add    $0x14,%esp
+  800425:	0f be 80 65 31 80 00 	movsbl 0x803165(%eax),%eax
+  80042c:	50                   	push   %eax
+  80042d:	ff d7                	call   *%edi
+}
+  80042f:	83 c4 10             	add    $0x10,%esp
+  800432:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800435:	5b                   	pop    %ebx
+  800436:	5e                   	pop    %esi
+  800437:	5f                   	pop    %edi
+  800438:	5d                   	pop    %ebp
+  800439:	c3                   	ret
+
+0080043a <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80043a:	55                   	push   %ebp
+  80043b:	89 e5                	mov    %esp,%ebp
+  80043d:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800440:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800444:	8b 10                	mov    (%eax),%edx
+  800446:	3b 50 04             	cmp    0x4(%eax),%edx
+  800449:	73 0a                	jae    800455 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80044b:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80044e:	89 08                	mov    %ecx,(%eax)
+  800450:	8b 45 08             	mov    0x8(%ebp),%eax
+  800453:	88 02                	mov    %al,(%edx)
+}
+  800455:	5d                   	pop    %ebp
+  800456:	c3                   	ret
+
+00800457 <printfmt>:
+{
+  800457:	55                   	push   %ebp
+  800458:	89 e5                	mov    %esp,%ebp
+  80045a:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80045d:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800460:	50                   	push   %eax
+  800461:	ff 75 10             	push   0x10(%ebp)
+  800464:	ff 75 0c             	push   0xc(%ebp)
+  800467:	ff 75 08             	push   0x8(%ebp)
+  80046a:	e8 05 00 00 00       	call   800474 <vprintfmt>
+}
+  80046f:	83 c4 10             	add    $0x10,%esp
+  800472:	c9                   	leave
+  800473:	c3                   	ret
+
+00800474 <vprintfmt>:
+{
+  800474:	55                   	push   %ebp
+  800475:	89 e5                	mov    %esp,%ebp
+  800477:	57                   	push   %edi
+  800478:	56                   	push   %esi
+  800479:	53                   	push   %ebx
+  80047a:	83 ec 2c             	sub    $0x2c,%esp
+  80047d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800480:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800483:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800486:	eb 0a                	jmp    800492 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800488:	83 ec 08             	sub    $0x8,%esp
+  80048b:	53                   	push   %ebx
+  80048c:	50                   	push   %eax
+  80048d:	ff d6                	call   *%esi
+  80048f:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800492:	83 c7 01             	add    $0x1,%edi
+  800495:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800499:	83 f8 25             	cmp    $0x25,%eax
+  80049c:	74 0c                	je     8004aa <vprintfmt+0x36>
+			if (ch == '\0')
+  80049e:	85 c0                	test   %eax,%eax
+  8004a0:	75 e6                	jne    800488 <vprintfmt+0x14>
+}
+  8004a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004a5:	5b                   	pop    %ebx
+  8004a6:	5e                   	pop    %esi
+  8004a7:	5f                   	pop    %edi
+  8004a8:	5d                   	pop    %ebp
+  8004a9:	c3                   	ret
+		padc = ' ';
+  8004aa:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8004ae:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8004b5:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8004bc:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8004c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004c8:	8d 47 01             	lea    0x1(%edi),%eax
+  8004cb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004ce:	0f b6 17             	movzbl (%edi),%edx
+  8004d1:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8004d4:	3c 55                	cmp    $0x55,%al
+  8004d6:	0f 87 cf 03 00 00    	ja     8008ab <vprintfmt+0x437>
+  8004dc:	0f b6 c0             	movzbl %al,%eax
+  8004df:	ff 24 85 40 32 80 00 	jmp    *0x803240(,%eax,4)
+  8004e6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8004e9:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8004ed:	eb d9                	jmp    8004c8 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ef:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8004f2:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8004f6:	eb d0                	jmp    8004c8 <vprintfmt+0x54>
+  8004f8:	0f b6 d2             	movzbl %dl,%edx
+  8004fb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8004fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800503:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800506:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800509:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80050d:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800510:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800513:	83 f9 09             	cmp    $0x9,%ecx
+  800516:	77 55                	ja     80056d <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800518:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80051b:	eb e9                	jmp    800506 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80051d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800520:	8b 00                	mov    (%eax),%eax
+  800522:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800525:	8b 45 14             	mov    0x14(%ebp),%eax
+  800528:	8d 40 04             	lea    0x4(%eax),%eax
+  80052b:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80052e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800531:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800535:	79 91                	jns    8004c8 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800537:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80053a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80053d:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800544:	eb 82                	jmp    8004c8 <vprintfmt+0x54>
+			if (width < 0)
+  800546:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800549:	85 d2                	test   %edx,%edx
+  80054b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800550:	0f 49 c2             	cmovns %edx,%eax
+  800553:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800556:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800559:	e9 6a ff ff ff       	jmp    8004c8 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80055e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800561:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800568:	e9 5b ff ff ff       	jmp    8004c8 <vprintfmt+0x54>
+  80056d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800570:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800573:	eb bc                	jmp    800531 <vprintfmt+0xbd>
+			lflag++;
+  800575:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800578:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80057b:	e9 48 ff ff ff       	jmp    8004c8 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800580:	8b 45 14             	mov    0x14(%ebp),%eax
+  800583:	8d 78 04             	lea    0x4(%eax),%edi
+  800586:	83 ec 08             	sub    $0x8,%esp
+  800589:	53                   	push   %ebx
+  80058a:	ff 30                	push   (%eax)
+  80058c:	ff d6                	call   *%esi
+			break;
+  80058e:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800591:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800594:	e9 b1 02 00 00       	jmp    80084a <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800599:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059c:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80059f:	8b 10                	mov    (%eax),%edx
+  8005a1:	89 d0                	mov    %edx,%eax
+  8005a3:	f7 d8                	neg    %eax
+  8005a5:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8005a8:	83 f8 0d             	cmp    $0xd,%eax
+  8005ab:	7f 23                	jg     8005d0 <vprintfmt+0x15c>
+  8005ad:	8b 14 85 a0 33 80 00 	mov    0x8033a0(,%eax,4),%edx
+  8005b4:	85 d2                	test   %edx,%edx
+  8005b6:	74 18                	je     8005d0 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8005b8:	52                   	push   %edx
+  8005b9:	68 86 31 80 00       	push   $0x803186
+  8005be:	53                   	push   %ebx
+  8005bf:	56                   	push   %esi
+  8005c0:	e8 92 fe ff ff       	call   800457 <printfmt>
+  8005c5:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005c8:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8005cb:	e9 7a 02 00 00       	jmp    80084a <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8005d0:	50                   	push   %eax
+  8005d1:	68 7d 31 80 00       	push   $0x80317d
+  8005d6:	53                   	push   %ebx
+  8005d7:	56                   	push   %esi
+  8005d8:	e8 7a fe ff ff       	call   800457 <printfmt>
+  8005dd:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005e0:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8005e3:	e9 62 02 00 00       	jmp    80084a <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005eb:	83 c0 04             	add    $0x4,%eax
+  8005ee:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8005f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f4:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8005f6:	85 c9                	test   %ecx,%ecx
+  8005f8:	b8 76 31 80 00       	mov    $0x803176,%eax
+  8005fd:	0f 45 c1             	cmovne %ecx,%eax
+  800600:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800603:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800607:	7e 06                	jle    80060f <vprintfmt+0x19b>
+  800609:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80060d:	75 0b                	jne    80061a <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80060f:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800612:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800615:	89 75 08             	mov    %esi,0x8(%ebp)
+  800618:	eb 5c                	jmp    800676 <vprintfmt+0x202>
+  80061a:	83 ec 08             	sub    $0x8,%esp
+  80061d:	ff 75 d0             	push   -0x30(%ebp)
+  800620:	ff 75 cc             	push   -0x34(%ebp)
+  800623:	e8 20 03 00 00       	call   800948 <strnlen>
+  800628:	89 c2                	mov    %eax,%edx
+  80062a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80062d:	29 d0                	sub    %edx,%eax
+  80062f:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800632:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800636:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800639:	89 75 08             	mov    %esi,0x8(%ebp)
+  80063c:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80063e:	eb 0e                	jmp    80064e <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800640:	83 ec 08             	sub    $0x8,%esp
+  800643:	53                   	push   %ebx
+  800644:	57                   	push   %edi
+  800645:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800648:	83 ee 01             	sub    $0x1,%esi
+  80064b:	83 c4 10             	add    $0x10,%esp
+  80064e:	85 f6                	test   %esi,%esi
+  800650:	7f ee                	jg     800640 <vprintfmt+0x1cc>
+  800652:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800655:	8b 75 08             	mov    0x8(%ebp),%esi
+  800658:	85 c0                	test   %eax,%eax
+  80065a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80065f:	0f 49 d0             	cmovns %eax,%edx
+  800662:	29 d0                	sub    %edx,%eax
+  800664:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800667:	eb a6                	jmp    80060f <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800669:	83 ec 08             	sub    $0x8,%esp
+  80066c:	53                   	push   %ebx
+  80066d:	52                   	push   %edx
+  80066e:	ff 55 08             	call   *0x8(%ebp)
+  800671:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800674:	89 f1                	mov    %esi,%ecx
+  800676:	8d 71 01             	lea    0x1(%ecx),%esi
+  800679:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80067d:	0f be d0             	movsbl %al,%edx
+  800680:	85 d2                	test   %edx,%edx
+  800682:	74 28                	je     8006ac <vprintfmt+0x238>
+  800684:	85 ff                	test   %edi,%edi
+  800686:	78 05                	js     80068d <vprintfmt+0x219>
+  800688:	83 ef 01             	sub    $0x1,%edi
+  80068b:	78 30                	js     8006bd <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80068d:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800691:	74 d6                	je     800669 <vprintfmt+0x1f5>
+  800693:	0f be c0             	movsbl %al,%eax
+  800696:	83 e8 20             	sub    $0x20,%eax
+  800699:	83 f8 5e             	cmp    $0x5e,%eax
+  80069c:	76 cb                	jbe    800669 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80069e:	83 ec 08             	sub    $0x8,%esp
+  8006a1:	53                   	push   %ebx
+  8006a2:	6a 3f                	push   $0x3f
+  8006a4:	ff 55 08             	call   *0x8(%ebp)
+  8006a7:	83 c4 10             	add    $0x10,%esp
+  8006aa:	eb c8                	jmp    800674 <vprintfmt+0x200>
+  8006ac:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006af:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006b2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8006b5:	01 d0                	add    %edx,%eax
+  8006b7:	29 c8                	sub    %ecx,%eax
+  8006b9:	89 c7                	mov    %eax,%edi
+  8006bb:	eb 13                	jmp    8006d0 <vprintfmt+0x25c>
+  8006bd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006c0:	eb ed                	jmp    8006af <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8006c2:	83 ec 08             	sub    $0x8,%esp
+  8006c5:	53                   	push   %ebx
+  8006c6:	6a 20                	push   $0x20
+  8006c8:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8006ca:	83 ef 01             	sub    $0x1,%edi
+  8006cd:	83 c4 10             	add    $0x10,%esp
+  8006d0:	85 ff                	test   %edi,%edi
+  8006d2:	7f ee                	jg     8006c2 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006d4:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8006d7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006da:	e9 6b 01 00 00       	jmp    80084a <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8006df:	83 f9 01             	cmp    $0x1,%ecx
+  8006e2:	7f 1f                	jg     800703 <vprintfmt+0x28f>
+	else if (lflag)
+  8006e4:	85 c9                	test   %ecx,%ecx
+  8006e6:	74 67                	je     80074f <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8006e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006eb:	8b 00                	mov    (%eax),%eax
+  8006ed:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006f0:	89 c1                	mov    %eax,%ecx
+  8006f2:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006f5:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fb:	8d 40 04             	lea    0x4(%eax),%eax
+  8006fe:	89 45 14             	mov    %eax,0x14(%ebp)
+  800701:	eb 17                	jmp    80071a <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800703:	8b 45 14             	mov    0x14(%ebp),%eax
+  800706:	8b 50 04             	mov    0x4(%eax),%edx
+  800709:	8b 00                	mov    (%eax),%eax
+  80070b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80070e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800711:	8b 45 14             	mov    0x14(%ebp),%eax
+  800714:	8d 40 08             	lea    0x8(%eax),%eax
+  800717:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80071a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80071d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800720:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800725:	85 c9                	test   %ecx,%ecx
+  800727:	0f 89 03 01 00 00    	jns    800830 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  80072d:	83 ec 08             	sub    $0x8,%esp
+  800730:	53                   	push   %ebx
+  800731:	6a 2d                	push   $0x2d
+  800733:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800735:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800738:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80073b:	f7 da                	neg    %edx
+  80073d:	83 d1 00             	adc    $0x0,%ecx
+  800740:	f7 d9                	neg    %ecx
+  800742:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800745:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80074a:	e9 e1 00 00 00       	jmp    800830 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80074f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800752:	8b 00                	mov    (%eax),%eax
+  800754:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800757:	89 c1                	mov    %eax,%ecx
+  800759:	c1 f9 1f             	sar    $0x1f,%ecx
+  80075c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80075f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800762:	8d 40 04             	lea    0x4(%eax),%eax
+  800765:	89 45 14             	mov    %eax,0x14(%ebp)
+  800768:	eb b0                	jmp    80071a <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80076a:	83 f9 01             	cmp    $0x1,%ecx
+  80076d:	7f 1e                	jg     80078d <vprintfmt+0x319>
+	else if (lflag)
+  80076f:	85 c9                	test   %ecx,%ecx
+  800771:	74 32                	je     8007a5 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800773:	8b 45 14             	mov    0x14(%ebp),%eax
+  800776:	8b 10                	mov    (%eax),%edx
+  800778:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80077d:	8d 40 04             	lea    0x4(%eax),%eax
+  800780:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800783:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800788:	e9 a3 00 00 00       	jmp    800830 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80078d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800790:	8b 10                	mov    (%eax),%edx
+  800792:	8b 48 04             	mov    0x4(%eax),%ecx
+  800795:	8d 40 08             	lea    0x8(%eax),%eax
+  800798:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80079b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8007a0:	e9 8b 00 00 00       	jmp    800830 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8007a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a8:	8b 10                	mov    (%eax),%edx
+  8007aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007af:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007b5:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8007ba:	eb 74                	jmp    800830 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8007bc:	83 f9 01             	cmp    $0x1,%ecx
+  8007bf:	7f 1b                	jg     8007dc <vprintfmt+0x368>
+	else if (lflag)
+  8007c1:	85 c9                	test   %ecx,%ecx
+  8007c3:	74 2c                	je     8007f1 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8007c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c8:	8b 10                	mov    (%eax),%edx
+  8007ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007cf:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007d5:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8007da:	eb 54                	jmp    800830 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8007dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007df:	8b 10                	mov    (%eax),%edx
+  8007e1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007e4:	8d 40 08             	lea    0x8(%eax),%eax
+  8007e7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007ea:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8007ef:	eb 3f                	jmp    800830 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8007f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f4:	8b 10                	mov    (%eax),%edx
+  8007f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007fb:	8d 40 04             	lea    0x4(%eax),%eax
+  8007fe:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800801:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800806:	eb 28                	jmp    800830 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800808:	83 ec 08             	sub    $0x8,%esp
+  80080b:	53                   	push   %ebx
+  80080c:	6a 30                	push   $0x30
+  80080e:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800810:	83 c4 08             	add    $0x8,%esp
+  800813:	53                   	push   %ebx
+  800814:	6a 78                	push   $0x78
+  800816:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800818:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081b:	8b 10                	mov    (%eax),%edx
+  80081d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800822:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800825:	8d 40 04             	lea    0x4(%eax),%eax
+  800828:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80082b:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800830:	83 ec 0c             	sub    $0xc,%esp
+  800833:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800837:	50                   	push   %eax
+  800838:	ff 75 e0             	push   -0x20(%ebp)
+  80083b:	57                   	push   %edi
+  80083c:	51                   	push   %ecx
+  80083d:	52                   	push   %edx
+  80083e:	89 da                	mov    %ebx,%edx
+  800840:	89 f0                	mov    %esi,%eax
+  800842:	e8 4a fb ff ff       	call   800391 <printnum>
+			break;
+  800847:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80084a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80084d:	e9 40 fc ff ff       	jmp    800492 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800852:	83 f9 01             	cmp    $0x1,%ecx
+  800855:	7f 1b                	jg     800872 <vprintfmt+0x3fe>
+	else if (lflag)
+  800857:	85 c9                	test   %ecx,%ecx
+  800859:	74 2c                	je     800887 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  80085b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085e:	8b 10                	mov    (%eax),%edx
+  800860:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800865:	8d 40 04             	lea    0x4(%eax),%eax
+  800868:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80086b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800870:	eb be                	jmp    800830 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800872:	8b 45 14             	mov    0x14(%ebp),%eax
+  800875:	8b 10                	mov    (%eax),%edx
+  800877:	8b 48 04             	mov    0x4(%eax),%ecx
+  80087a:	8d 40 08             	lea    0x8(%eax),%eax
+  80087d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800880:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800885:	eb a9                	jmp    800830 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800887:	8b 45 14             	mov    0x14(%ebp),%eax
+  80088a:	8b 10                	mov    (%eax),%edx
+  80088c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800891:	8d 40 04             	lea    0x4(%eax),%eax
+  800894:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800897:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80089c:	eb 92                	jmp    800830 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  80089e:	83 ec 08             	sub    $0x8,%esp
+  8008a1:	53                   	push   %ebx
+  8008a2:	6a 25                	push   $0x25
+  8008a4:	ff d6                	call   *%esi
+			break;
+  8008a6:	83 c4 10             	add    $0x10,%esp
+  8008a9:	eb 9f                	jmp    80084a <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8008ab:	83 ec 08             	sub    $0x8,%esp
+  8008ae:	53                   	push   %ebx
+  8008af:	6a 25                	push   $0x25
+  8008b1:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8008b3:	83 c4 10             	add    $0x10,%esp
+  8008b6:	89 f8                	mov    %edi,%eax
+  8008b8:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8008bc:	74 05                	je     8008c3 <vprintfmt+0x44f>
+  8008be:	83 e8 01             	sub    $0x1,%eax
+  8008c1:	eb f5                	jmp    8008b8 <vprintfmt+0x444>
+  8008c3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8008c6:	eb 82                	jmp    80084a <vprintfmt+0x3d6>
+
+008008c8 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8008c8:	55                   	push   %ebp
+  8008c9:	89 e5                	mov    %esp,%ebp
+  8008cb:	83 ec 18             	sub    $0x18,%esp
+  8008ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8008d4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008d7:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008db:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008de:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8008e5:	85 c0                	test   %eax,%eax
+  8008e7:	74 26                	je     80090f <vsnprintf+0x47>
+  8008e9:	85 d2                	test   %edx,%edx
+  8008eb:	7e 22                	jle    80090f <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008ed:	ff 75 14             	push   0x14(%ebp)
+  8008f0:	ff 75 10             	push   0x10(%ebp)
+  8008f3:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008f6:	50                   	push   %eax
+  8008f7:	68 3a 04 80 00       	push   $0x80043a
+  8008fc:	e8 73 fb ff ff       	call   800474 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800901:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800904:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800907:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80090a:	83 c4 10             	add    $0x10,%esp
+}
+  80090d:	c9                   	leave
+  80090e:	c3                   	ret
+		return -E_INVAL;
+  80090f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800914:	eb f7                	jmp    80090d <vsnprintf+0x45>
+
+00800916 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800916:	55                   	push   %ebp
+  800917:	89 e5                	mov    %esp,%ebp
+  800919:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80091c:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80091f:	50                   	push   %eax
+  800920:	ff 75 10             	push   0x10(%ebp)
+  800923:	ff 75 0c             	push   0xc(%ebp)
+  800926:	ff 75 08             	push   0x8(%ebp)
+  800929:	e8 9a ff ff ff       	call   8008c8 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80092e:	c9                   	leave
+  80092f:	c3                   	ret
+
+00800930 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800930:	55                   	push   %ebp
+  800931:	89 e5                	mov    %esp,%ebp
+  800933:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800936:	b8 00 00 00 00       	mov    $0x0,%eax
+  80093b:	eb 03                	jmp    800940 <strlen+0x10>
+		n++;
+  80093d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800940:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800944:	75 f7                	jne    80093d <strlen+0xd>
+	return n;
+}
+  800946:	5d                   	pop    %ebp
+  800947:	c3                   	ret
+
+00800948 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800948:	55                   	push   %ebp
+  800949:	89 e5                	mov    %esp,%ebp
+  80094b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80094e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800951:	b8 00 00 00 00       	mov    $0x0,%eax
+  800956:	eb 03                	jmp    80095b <strnlen+0x13>
+		n++;
+  800958:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80095b:	39 d0                	cmp    %edx,%eax
+  80095d:	74 08                	je     800967 <strnlen+0x1f>
+  80095f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800963:	75 f3                	jne    800958 <strnlen+0x10>
+  800965:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800967:	89 d0                	mov    %edx,%eax
+  800969:	5d                   	pop    %ebp
+  80096a:	c3                   	ret
+
+0080096b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80096b:	55                   	push   %ebp
+  80096c:	89 e5                	mov    %esp,%ebp
+  80096e:	53                   	push   %ebx
+  80096f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800972:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800975:	b8 00 00 00 00       	mov    $0x0,%eax
+  80097a:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80097e:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800981:	83 c0 01             	add    $0x1,%eax
+  800984:	84 d2                	test   %dl,%dl
+  800986:	75 f2                	jne    80097a <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800988:	89 c8                	mov    %ecx,%eax
+  80098a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80098d:	c9                   	leave
+  80098e:	c3                   	ret
+
+0080098f <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80098f:	55                   	push   %ebp
+  800990:	89 e5                	mov    %esp,%ebp
+  800992:	53                   	push   %ebx
+  800993:	83 ec 10             	sub    $0x10,%esp
+  800996:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800999:	53                   	push   %ebx
+  80099a:	e8 91 ff ff ff       	call   800930 <strlen>
+  80099f:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8009a2:	ff 75 0c             	push   0xc(%ebp)
+  8009a5:	01 d8                	add    %ebx,%eax
+  8009a7:	50                   	push   %eax
+  8009a8:	e8 be ff ff ff       	call   80096b <strcpy>
+	return dst;
+}
+  8009ad:	89 d8                	mov    %ebx,%eax
+  8009af:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009b2:	c9                   	leave
+  8009b3:	c3                   	ret
+
+008009b4 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8009b4:	55                   	push   %ebp
+  8009b5:	89 e5                	mov    %esp,%ebp
+  8009b7:	56                   	push   %esi
+  8009b8:	53                   	push   %ebx
+  8009b9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009bc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8009bf:	89 f3                	mov    %esi,%ebx
+  8009c1:	03 5d 10             	add    0x10(%ebp),%ebx
+  8009c4:	89 f0                	mov    %esi,%eax
+  8009c6:	eb 0f                	jmp    8009d7 <strncpy+0x23>
+		*dst++ = *src;
+  8009c8:	83 c0 01             	add    $0x1,%eax
+  8009cb:	0f b6 0a             	movzbl (%edx),%ecx
+  8009ce:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8009d1:	80 f9 01             	cmp    $0x1,%cl
+  8009d4:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8009d7:	39 d8                	cmp    %ebx,%eax
+  8009d9:	75 ed                	jne    8009c8 <strncpy+0x14>
+	}
+	return ret;
+}
+  8009db:	89 f0                	mov    %esi,%eax
+  8009dd:	5b                   	pop    %ebx
+  8009de:	5e                   	pop    %esi
+  8009df:	5d                   	pop    %ebp
+  8009e0:	c3                   	ret
+
+008009e1 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8009e1:	55                   	push   %ebp
+  8009e2:	89 e5                	mov    %esp,%ebp
+  8009e4:	56                   	push   %esi
+  8009e5:	53                   	push   %ebx
+  8009e6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009ec:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8009ef:	89 f0                	mov    %esi,%eax
+  8009f1:	85 d2                	test   %edx,%edx
+  8009f3:	74 21                	je     800a16 <strlcpy+0x35>
+  8009f5:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8009f9:	89 f2                	mov    %esi,%edx
+  8009fb:	eb 09                	jmp    800a06 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8009fd:	83 c1 01             	add    $0x1,%ecx
+  800a00:	83 c2 01             	add    $0x1,%edx
+  800a03:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800a06:	39 c2                	cmp    %eax,%edx
+  800a08:	74 09                	je     800a13 <strlcpy+0x32>
+  800a0a:	0f b6 19             	movzbl (%ecx),%ebx
+  800a0d:	84 db                	test   %bl,%bl
+  800a0f:	75 ec                	jne    8009fd <strlcpy+0x1c>
+  800a11:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800a13:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a16:	29 f0                	sub    %esi,%eax
+}
+  800a18:	5b                   	pop    %ebx
+  800a19:	5e                   	pop    %esi
+  800a1a:	5d                   	pop    %ebp
+  800a1b:	c3                   	ret
+
+00800a1c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a1c:	55                   	push   %ebp
+  800a1d:	89 e5                	mov    %esp,%ebp
+  800a1f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a22:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a25:	eb 06                	jmp    800a2d <strcmp+0x11>
+		p++, q++;
+  800a27:	83 c1 01             	add    $0x1,%ecx
+  800a2a:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a2d:	0f b6 01             	movzbl (%ecx),%eax
+  800a30:	84 c0                	test   %al,%al
+  800a32:	74 04                	je     800a38 <strcmp+0x1c>
+  800a34:	3a 02                	cmp    (%edx),%al
+  800a36:	74 ef                	je     800a27 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a38:	0f b6 c0             	movzbl %al,%eax
+  800a3b:	0f b6 12             	movzbl (%edx),%edx
+  800a3e:	29 d0                	sub    %edx,%eax
+}
+  800a40:	5d                   	pop    %ebp
+  800a41:	c3                   	ret
+
+00800a42 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a42:	55                   	push   %ebp
+  800a43:	89 e5                	mov    %esp,%ebp
+  800a45:	53                   	push   %ebx
+  800a46:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a49:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a4c:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800a4f:	eb 09                	jmp    800a5a <strncmp+0x18>
+		n--, p++, q++;
+  800a51:	83 ea 01             	sub    $0x1,%edx
+  800a54:	83 c0 01             	add    $0x1,%eax
+  800a57:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800a5a:	85 d2                	test   %edx,%edx
+  800a5c:	74 18                	je     800a76 <strncmp+0x34>
+  800a5e:	0f b6 18             	movzbl (%eax),%ebx
+  800a61:	84 db                	test   %bl,%bl
+  800a63:	74 04                	je     800a69 <strncmp+0x27>
+  800a65:	3a 19                	cmp    (%ecx),%bl
+  800a67:	74 e8                	je     800a51 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a69:	0f b6 00             	movzbl (%eax),%eax
+  800a6c:	0f b6 11             	movzbl (%ecx),%edx
+  800a6f:	29 d0                	sub    %edx,%eax
+}
+  800a71:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a74:	c9                   	leave
+  800a75:	c3                   	ret
+		return 0;
+  800a76:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a7b:	eb f4                	jmp    800a71 <strncmp+0x2f>
+
+00800a7d <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a7d:	55                   	push   %ebp
+  800a7e:	89 e5                	mov    %esp,%ebp
+  800a80:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a83:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a87:	eb 03                	jmp    800a8c <strchr+0xf>
+  800a89:	83 c0 01             	add    $0x1,%eax
+  800a8c:	0f b6 10             	movzbl (%eax),%edx
+  800a8f:	84 d2                	test   %dl,%dl
+  800a91:	74 06                	je     800a99 <strchr+0x1c>
+		if (*s == c)
+  800a93:	38 ca                	cmp    %cl,%dl
+  800a95:	75 f2                	jne    800a89 <strchr+0xc>
+  800a97:	eb 05                	jmp    800a9e <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a99:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a9e:	5d                   	pop    %ebp
+  800a9f:	c3                   	ret
+
+00800aa0 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800aa0:	55                   	push   %ebp
+  800aa1:	89 e5                	mov    %esp,%ebp
+  800aa3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aa6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800aaa:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800aad:	38 ca                	cmp    %cl,%dl
+  800aaf:	74 09                	je     800aba <strfind+0x1a>
+  800ab1:	84 d2                	test   %dl,%dl
+  800ab3:	74 05                	je     800aba <strfind+0x1a>
+	for (; *s; s++)
+  800ab5:	83 c0 01             	add    $0x1,%eax
+  800ab8:	eb f0                	jmp    800aaa <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800aba:	5d                   	pop    %ebp
+  800abb:	c3                   	ret
+
+00800abc <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800abc:	55                   	push   %ebp
+  800abd:	89 e5                	mov    %esp,%ebp
+  800abf:	57                   	push   %edi
+  800ac0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ac3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800ac6:	85 c9                	test   %ecx,%ecx
+  800ac8:	74 20                	je     800aea <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800aca:	89 f8                	mov    %edi,%eax
+  800acc:	09 c8                	or     %ecx,%eax
+  800ace:	a8 03                	test   $0x3,%al
+  800ad0:	75 12                	jne    800ae4 <memset+0x28>
+		c &= 0xFF;
+  800ad2:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800ad6:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800adc:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800adf:	fc                   	cld
+  800ae0:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ae2:	eb 06                	jmp    800aea <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800ae4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ae7:	fc                   	cld
+  800ae8:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800aea:	89 f8                	mov    %edi,%eax
+  800aec:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800aef:	c9                   	leave
+  800af0:	c3                   	ret
+
+00800af1 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800af1:	55                   	push   %ebp
+  800af2:	89 e5                	mov    %esp,%ebp
+  800af4:	57                   	push   %edi
+  800af5:	56                   	push   %esi
+  800af6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800af9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800afc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800aff:	39 c6                	cmp    %eax,%esi
+  800b01:	73 32                	jae    800b35 <memmove+0x44>
+  800b03:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b06:	39 d0                	cmp    %edx,%eax
+  800b08:	73 2b                	jae    800b35 <memmove+0x44>
+		s += n;
+		d += n;
+  800b0a:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b0d:	89 d6                	mov    %edx,%esi
+  800b0f:	09 fe                	or     %edi,%esi
+  800b11:	09 ce                	or     %ecx,%esi
+  800b13:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b19:	75 0e                	jne    800b29 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b1b:	83 ef 04             	sub    $0x4,%edi
+  800b1e:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b21:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b24:	fd                   	std
+  800b25:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b27:	eb 09                	jmp    800b32 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b29:	83 ef 01             	sub    $0x1,%edi
+  800b2c:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b2f:	fd                   	std
+  800b30:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b32:	fc                   	cld
+  800b33:	eb 1a                	jmp    800b4f <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b35:	89 f2                	mov    %esi,%edx
+  800b37:	09 c2                	or     %eax,%edx
+  800b39:	09 ca                	or     %ecx,%edx
+  800b3b:	f6 c2 03             	test   $0x3,%dl
+  800b3e:	75 0a                	jne    800b4a <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b40:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b43:	89 c7                	mov    %eax,%edi
+  800b45:	fc                   	cld
+  800b46:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b48:	eb 05                	jmp    800b4f <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b4a:	89 c7                	mov    %eax,%edi
+  800b4c:	fc                   	cld
+  800b4d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b4f:	5e                   	pop    %esi
+  800b50:	5f                   	pop    %edi
+  800b51:	5d                   	pop    %ebp
+  800b52:	c3                   	ret
+
+00800b53 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b53:	55                   	push   %ebp
+  800b54:	89 e5                	mov    %esp,%ebp
+  800b56:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b59:	ff 75 10             	push   0x10(%ebp)
+  800b5c:	ff 75 0c             	push   0xc(%ebp)
+  800b5f:	ff 75 08             	push   0x8(%ebp)
+  800b62:	e8 8a ff ff ff       	call   800af1 <memmove>
+}
+  800b67:	c9                   	leave
+  800b68:	c3                   	ret
+
+00800b69 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b69:	55                   	push   %ebp
+  800b6a:	89 e5                	mov    %esp,%ebp
+  800b6c:	56                   	push   %esi
+  800b6d:	53                   	push   %ebx
+  800b6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b71:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b74:	89 c6                	mov    %eax,%esi
+  800b76:	03 75 10             	add    0x10(%ebp),%esi
+  800b79:	eb 06                	jmp    800b81 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b7b:	83 c0 01             	add    $0x1,%eax
+  800b7e:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b81:	39 f0                	cmp    %esi,%eax
+  800b83:	74 14                	je     800b99 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b85:	0f b6 08             	movzbl (%eax),%ecx
+  800b88:	0f b6 1a             	movzbl (%edx),%ebx
+  800b8b:	38 d9                	cmp    %bl,%cl
+  800b8d:	74 ec                	je     800b7b <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b8f:	0f b6 c1             	movzbl %cl,%eax
+  800b92:	0f b6 db             	movzbl %bl,%ebx
+  800b95:	29 d8                	sub    %ebx,%eax
+  800b97:	eb 05                	jmp    800b9e <memcmp+0x35>
+	}
+
+	return 0;
+  800b99:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b9e:	5b                   	pop    %ebx
+  800b9f:	5e                   	pop    %esi
+  800ba0:	5d                   	pop    %ebp
+  800ba1:	c3                   	ret
+
+00800ba2 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ba2:	55                   	push   %ebp
+  800ba3:	89 e5                	mov    %esp,%ebp
+  800ba5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ba8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800bab:	89 c2                	mov    %eax,%edx
+  800bad:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800bb0:	eb 03                	jmp    800bb5 <memfind+0x13>
+  800bb2:	83 c0 01             	add    $0x1,%eax
+  800bb5:	39 d0                	cmp    %edx,%eax
+  800bb7:	73 04                	jae    800bbd <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800bb9:	38 08                	cmp    %cl,(%eax)
+  800bbb:	75 f5                	jne    800bb2 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800bbd:	5d                   	pop    %ebp
+  800bbe:	c3                   	ret
+
+00800bbf <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800bbf:	55                   	push   %ebp
+  800bc0:	89 e5                	mov    %esp,%ebp
+  800bc2:	57                   	push   %edi
+  800bc3:	56                   	push   %esi
+  800bc4:	53                   	push   %ebx
+  800bc5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bc8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800bcb:	eb 03                	jmp    800bd0 <strtol+0x11>
+		s++;
+  800bcd:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800bd0:	0f b6 02             	movzbl (%edx),%eax
+  800bd3:	3c 20                	cmp    $0x20,%al
+  800bd5:	74 f6                	je     800bcd <strtol+0xe>
+  800bd7:	3c 09                	cmp    $0x9,%al
+  800bd9:	74 f2                	je     800bcd <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800bdb:	3c 2b                	cmp    $0x2b,%al
+  800bdd:	74 2a                	je     800c09 <strtol+0x4a>
+	int neg = 0;
+  800bdf:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800be4:	3c 2d                	cmp    $0x2d,%al
+  800be6:	74 2b                	je     800c13 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800be8:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800bee:	75 0f                	jne    800bff <strtol+0x40>
+  800bf0:	80 3a 30             	cmpb   $0x30,(%edx)
+  800bf3:	74 28                	je     800c1d <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800bf5:	85 db                	test   %ebx,%ebx
+  800bf7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bfc:	0f 44 d8             	cmove  %eax,%ebx
+  800bff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c04:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c07:	eb 46                	jmp    800c4f <strtol+0x90>
+		s++;
+  800c09:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800c0c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c11:	eb d5                	jmp    800be8 <strtol+0x29>
+		s++, neg = 1;
+  800c13:	83 c2 01             	add    $0x1,%edx
+  800c16:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c1b:	eb cb                	jmp    800be8 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c1d:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c21:	74 0e                	je     800c31 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800c23:	85 db                	test   %ebx,%ebx
+  800c25:	75 d8                	jne    800bff <strtol+0x40>
+		s++, base = 8;
+  800c27:	83 c2 01             	add    $0x1,%edx
+  800c2a:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c2f:	eb ce                	jmp    800bff <strtol+0x40>
+		s += 2, base = 16;
+  800c31:	83 c2 02             	add    $0x2,%edx
+  800c34:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c39:	eb c4                	jmp    800bff <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c3b:	0f be c0             	movsbl %al,%eax
+  800c3e:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800c41:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c44:	7d 3a                	jge    800c80 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800c46:	83 c2 01             	add    $0x1,%edx
+  800c49:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c4d:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800c4f:	0f b6 02             	movzbl (%edx),%eax
+  800c52:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c55:	89 f3                	mov    %esi,%ebx
+  800c57:	80 fb 09             	cmp    $0x9,%bl
+  800c5a:	76 df                	jbe    800c3b <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800c5c:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c5f:	89 f3                	mov    %esi,%ebx
+  800c61:	80 fb 19             	cmp    $0x19,%bl
+  800c64:	77 08                	ja     800c6e <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800c66:	0f be c0             	movsbl %al,%eax
+  800c69:	83 e8 57             	sub    $0x57,%eax
+  800c6c:	eb d3                	jmp    800c41 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c6e:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c71:	89 f3                	mov    %esi,%ebx
+  800c73:	80 fb 19             	cmp    $0x19,%bl
+  800c76:	77 08                	ja     800c80 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800c78:	0f be c0             	movsbl %al,%eax
+  800c7b:	83 e8 37             	sub    $0x37,%eax
+  800c7e:	eb c1                	jmp    800c41 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c80:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c84:	74 05                	je     800c8b <strtol+0xcc>
+		*endptr = (char *) s;
+  800c86:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c89:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c8b:	89 c8                	mov    %ecx,%eax
+  800c8d:	f7 d8                	neg    %eax
+  800c8f:	85 ff                	test   %edi,%edi
+  800c91:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c94:	89 c8                	mov    %ecx,%eax
+  800c96:	5b                   	pop    %ebx
+  800c97:	5e                   	pop    %esi
+  800c98:	5f                   	pop    %edi
+  800c99:	5d                   	pop    %ebp
+  800c9a:	c3                   	ret
+
+00800c9b <atoi>:
+
+int
+atoi(const char *s)
+{
+  800c9b:	55                   	push   %ebp
+  800c9c:	89 e5                	mov    %esp,%ebp
+  800c9e:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800ca1:	6a 0a                	push   $0xa
+  800ca3:	6a 00                	push   $0x0
+  800ca5:	ff 75 08             	push   0x8(%ebp)
+  800ca8:	e8 12 ff ff ff       	call   800bbf <strtol>
+}
+  800cad:	c9                   	leave
+  800cae:	c3                   	ret
+
+00800caf <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800caf:	55                   	push   %ebp
+  800cb0:	89 e5                	mov    %esp,%ebp
+  800cb2:	57                   	push   %edi
+  800cb3:	56                   	push   %esi
+  800cb4:	53                   	push   %ebx
+  800cb5:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800cbb:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800cc1:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800cc7:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800ccd:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800cd4:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800cd7:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800cde:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800ce1:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800ce8:	74 76                	je     800d60 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800cea:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800cf0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cf3:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800cf9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800d00:	0f 88 06 01 00 00    	js     800e0c <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800d06:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800d0d:	0f 84 48 01 00 00    	je     800e5b <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800d13:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800d19:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800d1f:	be 00 00 00 00       	mov    $0x0,%esi
+  800d24:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800d2a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800d2d:	55                   	push   %ebp
+  800d2e:	68 37 0d 80 00       	push   $0x800d37
+  800d33:	89 e5                	mov    %esp,%ebp
+  800d35:	0f 34                	sysenter
+  800d37:	83 c4 04             	add    $0x4,%esp
+  800d3a:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800d3b:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800d41:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800d47:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800d4a:	0f 85 9a 01 00 00    	jne    800eea <page_vec_call+0x23b>
+  800d50:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d55:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d58:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d5b:	e9 29 01 00 00       	jmp    800e89 <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800d60:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800d66:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d69:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800d6b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800d72:	78 2f                	js     800da3 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800d74:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800d7b:	74 72                	je     800def <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800d7d:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800d83:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800d89:	b8 10 00 00 00       	mov    $0x10,%eax
+  800d8e:	89 fb                	mov    %edi,%ebx
+  800d90:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800d93:	55                   	push   %ebp
+  800d94:	68 9d 0d 80 00       	push   $0x800d9d
+  800d99:	89 e5                	mov    %esp,%ebp
+  800d9b:	0f 34                	sysenter
+  800d9d:	83 c4 04             	add    $0x4,%esp
+  800da0:	5d                   	pop    %ebp
+	return ret;
+  800da1:	eb 98                	jmp    800d3b <page_vec_call+0x8c>
+	asm volatile("cpuid"
+  800da3:	b8 01 00 00 00       	mov    $0x1,%eax
+  800da8:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800daa:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800daf:	f6 c6 08             	test   $0x8,%dh
+  800db2:	74 15                	je     800dc9 <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800db4:	89 c2                	mov    %eax,%edx
+  800db6:	c1 ea 08             	shr    $0x8,%edx
+  800db9:	83 e2 0f             	and    $0xf,%edx
+  800dbc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800dc1:	83 fa 06             	cmp    $0x6,%edx
+  800dc4:	74 0e                	je     800dd4 <page_vec_call+0x125>
+  800dc6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800dc9:	0f b6 c9             	movzbl %cl,%ecx
+  800dcc:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800dd2:	eb a0                	jmp    800d74 <page_vec_call+0xc5>
+  800dd4:	89 c2                	mov    %eax,%edx
+  800dd6:	c1 ea 04             	shr    $0x4,%edx
+  800dd9:	83 e2 0f             	and    $0xf,%edx
+  800ddc:	83 fa 02             	cmp    $0x2,%edx
+  800ddf:	77 e5                	ja     800dc6 <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800de1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800de4:	83 f8 02             	cmp    $0x2,%eax
+  800de7:	0f 97 c1             	seta   %cl
+  800dea:	0f b6 c9             	movzbl %cl,%ecx
+  800ded:	eb d7                	jmp    800dc6 <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800def:	b8 10 00 00 00       	mov    $0x10,%eax
+  800df4:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800dfa:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800e00:	89 fb                	mov    %edi,%ebx
+  800e02:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800e05:	cd 30                	int    $0x30
+  800e07:	e9 2f ff ff ff       	jmp    800d3b <page_vec_call+0x8c>
+  800e0c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e11:	0f a2                	cpuid
+		return 0;
+  800e13:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800e18:	f6 c6 08             	test   $0x8,%dh
+  800e1b:	74 15                	je     800e32 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e1d:	89 c2                	mov    %eax,%edx
+  800e1f:	c1 ea 08             	shr    $0x8,%edx
+  800e22:	83 e2 0f             	and    $0xf,%edx
+  800e25:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e2a:	83 fa 06             	cmp    $0x6,%edx
+  800e2d:	74 11                	je     800e40 <page_vec_call+0x191>
+  800e2f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e32:	0f b6 c9             	movzbl %cl,%ecx
+  800e35:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800e3b:	e9 c6 fe ff ff       	jmp    800d06 <page_vec_call+0x57>
+  800e40:	89 c2                	mov    %eax,%edx
+  800e42:	c1 ea 04             	shr    $0x4,%edx
+  800e45:	83 e2 0f             	and    $0xf,%edx
+  800e48:	83 fa 02             	cmp    $0x2,%edx
+  800e4b:	77 e2                	ja     800e2f <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800e4d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e50:	83 f8 02             	cmp    $0x2,%eax
+  800e53:	0f 97 c1             	seta   %cl
+  800e56:	0f b6 c9             	movzbl %cl,%ecx
+  800e59:	eb d4                	jmp    800e2f <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800e5b:	be 00 00 00 00       	mov    $0x0,%esi
+  800e60:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800e66:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800e6c:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800e72:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800e75:	cd 30                	int    $0x30
+  800e77:	e9 bf fe ff ff       	jmp    800d3b <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800e7c:	29 da                	sub    %ebx,%edx
+			vec++;
+  800e7e:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800e81:	83 e8 01             	sub    $0x1,%eax
+  800e84:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800e89:	85 c0                	test   %eax,%eax
+  800e8b:	74 58                	je     800ee5 <page_vec_call+0x236>
+  800e8d:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800e90:	39 da                	cmp    %ebx,%edx
+  800e92:	73 e8                	jae    800e7c <page_vec_call+0x1cd>
+  800e94:	89 75 08             	mov    %esi,0x8(%ebp)
+  800e97:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800e9a:	84 c9                	test   %cl,%cl
+  800e9c:	74 06                	je     800ea4 <page_vec_call+0x1f5>
+  800e9e:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800ea4:	83 ec 04             	sub    $0x4,%esp
+  800ea7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800eaa:	c1 e0 04             	shl    $0x4,%eax
+  800ead:	50                   	push   %eax
+  800eae:	ff 75 08             	push   0x8(%ebp)
+  800eb1:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800eb7:	53                   	push   %ebx
+  800eb8:	e8 34 fc ff ff       	call   800af1 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800ebd:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800ec3:	89 c2                	mov    %eax,%edx
+  800ec5:	c1 e2 0c             	shl    $0xc,%edx
+  800ec8:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  800ece:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  800ed4:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  800eda:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  800edd:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  800ee0:	e9 f2 fd ff ff       	jmp    800cd7 <page_vec_call+0x28>
+			r = 0;
+  800ee5:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  800eea:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800eee:	74 0b                	je     800efb <page_vec_call+0x24c>
+		*done = total;
+  800ef0:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800ef3:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  800ef9:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  800efb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800efe:	5b                   	pop    %ebx
+  800eff:	5e                   	pop    %esi
+  800f00:	5f                   	pop    %edi
+  800f01:	5d                   	pop    %ebp
+  800f02:	c3                   	ret
+
+00800f03 <sys_cputs>:
+{
+  800f03:	55                   	push   %ebp
+  800f04:	89 e5                	mov    %esp,%ebp
+  800f06:	57                   	push   %edi
+  800f07:	56                   	push   %esi
+  800f08:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800f09:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800f10:	78 2d                	js     800f3f <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800f12:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800f19:	74 70                	je     800f8b <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800f1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f26:	89 c3                	mov    %eax,%ebx
+  800f28:	89 c7                	mov    %eax,%edi
+  800f2a:	89 c6                	mov    %eax,%esi
+  800f2c:	55                   	push   %ebp
+  800f2d:	68 36 0f 80 00       	push   $0x800f36
+  800f32:	89 e5                	mov    %esp,%ebp
+  800f34:	0f 34                	sysenter
+  800f36:	83 c4 04             	add    $0x4,%esp
+  800f39:	5d                   	pop    %ebp
+}
+  800f3a:	5b                   	pop    %ebx
+  800f3b:	5e                   	pop    %esi
+  800f3c:	5f                   	pop    %edi
+  800f3d:	5d                   	pop    %ebp
+  800f3e:	c3                   	ret
+  800f3f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f44:	0f a2                	cpuid
+		return 0;
+  800f46:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f4b:	f6 c6 08             	test   $0x8,%dh
+  800f4e:	74 15                	je     800f65 <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f50:	89 c2                	mov    %eax,%edx
+  800f52:	c1 ea 08             	shr    $0x8,%edx
+  800f55:	83 e2 0f             	and    $0xf,%edx
+  800f58:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f5d:	83 fa 06             	cmp    $0x6,%edx
+  800f60:	74 0e                	je     800f70 <sys_cputs+0x6d>
+  800f62:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f65:	0f b6 c9             	movzbl %cl,%ecx
+  800f68:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800f6e:	eb a2                	jmp    800f12 <sys_cputs+0xf>
+  800f70:	89 c2                	mov    %eax,%edx
+  800f72:	c1 ea 04             	shr    $0x4,%edx
+  800f75:	83 e2 0f             	and    $0xf,%edx
+  800f78:	83 fa 02             	cmp    $0x2,%edx
+  800f7b:	77 e5                	ja     800f62 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800f7d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f80:	83 f8 02             	cmp    $0x2,%eax
+  800f83:	0f 97 c1             	seta   %cl
+  800f86:	0f b6 c9             	movzbl %cl,%ecx
+  800f89:	eb d7                	jmp    800f62 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800f8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f90:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f93:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f96:	89 c3                	mov    %eax,%ebx
+  800f98:	89 c7                	mov    %eax,%edi
+  800f9a:	89 c6                	mov    %eax,%esi
+  800f9c:	cd 30                	int    $0x30
+}
+  800f9e:	eb 9a                	jmp    800f3a <sys_cputs+0x37>
+
+00800fa0 <sys_cgetc>:
+{
+  800fa0:	55                   	push   %ebp
+  800fa1:	89 e5                	mov    %esp,%ebp
+  800fa3:	57                   	push   %edi
+  800fa4:	56                   	push   %esi
+  800fa5:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800fa6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800fad:	78 2e                	js     800fdd <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  800faf:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800fb6:	74 71                	je     801029 <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  800fb8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fbd:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fc2:	89 d1                	mov    %edx,%ecx
+  800fc4:	89 d3                	mov    %edx,%ebx
+  800fc6:	89 d7                	mov    %edx,%edi
+  800fc8:	89 d6                	mov    %edx,%esi
+  800fca:	55                   	push   %ebp
+  800fcb:	68 d4 0f 80 00       	push   $0x800fd4
+  800fd0:	89 e5                	mov    %esp,%ebp
+  800fd2:	0f 34                	sysenter
+  800fd4:	83 c4 04             	add    $0x4,%esp
+  800fd7:	5d                   	pop    %ebp
+}
+  800fd8:	5b                   	pop    %ebx
+  800fd9:	5e                   	pop    %esi
+  800fda:	5f                   	pop    %edi
+  800fdb:	5d                   	pop    %ebp
+  800fdc:	c3                   	ret
+  800fdd:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fe2:	0f a2                	cpuid
+		return 0;
+  800fe4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800fe9:	f6 c6 08             	test   $0x8,%dh
+  800fec:	74 15                	je     801003 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800fee:	89 c2                	mov    %eax,%edx
+  800ff0:	c1 ea 08             	shr    $0x8,%edx
+  800ff3:	83 e2 0f             	and    $0xf,%edx
+  800ff6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ffb:	83 fa 06             	cmp    $0x6,%edx
+  800ffe:	74 0e                	je     80100e <sys_cgetc+0x6e>
+  801000:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801003:	0f b6 c9             	movzbl %cl,%ecx
+  801006:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80100c:	eb a1                	jmp    800faf <sys_cgetc+0xf>
+  80100e:	89 c2                	mov    %eax,%edx
+  801010:	c1 ea 04             	shr    $0x4,%edx
+  801013:	83 e2 0f             	and    $0xf,%edx
+  801016:	83 fa 02             	cmp    $0x2,%edx
+  801019:	77 e5                	ja     801000 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  80101b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80101e:	83 f8 02             	cmp    $0x2,%eax
+  801021:	0f 97 c1             	seta   %cl
+  801024:	0f b6 c9             	movzbl %cl,%ecx
+  801027:	eb d7                	jmp    801000 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  801029:	ba 00 00 00 00       	mov    $0x0,%edx
+  80102e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801033:	89 d1                	mov    %edx,%ecx
+  801035:	89 d3                	mov    %edx,%ebx
+  801037:	89 d7                	mov    %edx,%edi
+  801039:	89 d6                	mov    %edx,%esi
+  80103b:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  80103d:	eb 99                	jmp    800fd8 <sys_cgetc+0x38>
+
+0080103f <sys_env_destroy>:
+{
+  80103f:	55                   	push   %ebp
+  801040:	89 e5                	mov    %esp,%ebp
+  801042:	57                   	push   %edi
+  801043:	56                   	push   %esi
+  801044:	53                   	push   %ebx
+  801045:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801048:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80104f:	78 36                	js     801087 <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  801051:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801058:	74 79                	je     8010d3 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  80105a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801062:	b8 03 00 00 00       	mov    $0x3,%eax
+  801067:	89 cb                	mov    %ecx,%ebx
+  801069:	89 cf                	mov    %ecx,%edi
+  80106b:	89 ce                	mov    %ecx,%esi
+  80106d:	55                   	push   %ebp
+  80106e:	68 77 10 80 00       	push   $0x801077
+  801073:	89 e5                	mov    %esp,%ebp
+  801075:	0f 34                	sysenter
+  801077:	83 c4 04             	add    $0x4,%esp
+  80107a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80107b:	85 c0                	test   %eax,%eax
+  80107d:	7f 6b                	jg     8010ea <sys_env_destroy+0xab>
+}
+  80107f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801082:	5b                   	pop    %ebx
+  801083:	5e                   	pop    %esi
+  801084:	5f                   	pop    %edi
+  801085:	5d                   	pop    %ebp
+  801086:	c3                   	ret
+  801087:	b8 01 00 00 00       	mov    $0x1,%eax
+  80108c:	0f a2                	cpuid
+		return 0;
+  80108e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801093:	f6 c6 08             	test   $0x8,%dh
+  801096:	74 15                	je     8010ad <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801098:	89 c2                	mov    %eax,%edx
+  80109a:	c1 ea 08             	shr    $0x8,%edx
+  80109d:	83 e2 0f             	and    $0xf,%edx
+  8010a0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8010a5:	83 fa 06             	cmp    $0x6,%edx
+  8010a8:	74 0e                	je     8010b8 <sys_env_destroy+0x79>
+  8010aa:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8010ad:	0f b6 c9             	movzbl %cl,%ecx
+  8010b0:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8010b6:	eb 99                	jmp    801051 <sys_env_destroy+0x12>
+  8010b8:	89 c2                	mov    %eax,%edx
+  8010ba:	c1 ea 04             	shr    $0x4,%edx
+  8010bd:	83 e2 0f             	and    $0xf,%edx
+  8010c0:	83 fa 02             	cmp    $0x2,%edx
+  8010c3:	77 e5                	ja     8010aa <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  8010c5:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010c8:	83 f8 02             	cmp    $0x2,%eax
+  8010cb:	0f 97 c1             	seta   %cl
+  8010ce:	0f b6 c9             	movzbl %cl,%ecx
+  8010d1:	eb d7                	jmp    8010aa <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  8010d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010d8:	b8 03 00 00 00       	mov    $0x3,%eax
+  8010dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e0:	89 cb                	mov    %ecx,%ebx
+  8010e2:	89 cf                	mov    %ecx,%edi
+  8010e4:	89 ce                	mov    %ecx,%esi
+  8010e6:	cd 30                	int    $0x30
+  8010e8:	eb 91                	jmp    80107b <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010ea:	83 ec 0c             	sub    $0xc,%esp
+  8010ed:	50                   	push   %eax
+  8010ee:	6a 03                	push   $0x3
+  8010f0:	68 19 34 80 00       	push   $0x803419
+  8010f5:	6a 4a                	push   $0x4a
+  8010f7:	68 36 34 80 00       	push   $0x803436
+  8010fc:	e8 68 f1 ff ff       	call   800269 <_panic>
+
+00801101 <sys_getenvid>:
+{
+  801101:	55                   	push   %ebp
+  801102:	89 e5                	mov    %esp,%ebp
+  801104:	57                   	push   %edi
+  801105:	56                   	push   %esi
+  801106:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801107:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80110e:	78 2e                	js     80113e <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  801110:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801117:	74 71                	je     80118a <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  801119:	ba 00 00 00 00       	mov    $0x0,%edx
+  80111e:	b8 02 00 00 00       	mov    $0x2,%eax
+  801123:	89 d1                	mov    %edx,%ecx
+  801125:	89 d3                	mov    %edx,%ebx
+  801127:	89 d7                	mov    %edx,%edi
+  801129:	89 d6                	mov    %edx,%esi
+  80112b:	55                   	push   %ebp
+  80112c:	68 35 11 80 00       	push   $0x801135
+  801131:	89 e5                	mov    %esp,%ebp
+  801133:	0f 34                	sysenter
+  801135:	83 c4 04             	add    $0x4,%esp
+  801138:	5d                   	pop    %ebp
+}
+  801139:	5b                   	pop    %ebx
+  80113a:	5e                   	pop    %esi
+  80113b:	5f                   	pop    %edi
+  80113c:	5d                   	pop    %ebp
+  80113d:	c3                   	ret
+  80113e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801143:	0f a2                	cpuid
+		return 0;
+  801145:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80114a:	f6 c6 08             	test   $0x8,%dh
+  80114d:	74 15                	je     801164 <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80114f:	89 c2                	mov    %eax,%edx
+  801151:	c1 ea 08             	shr    $0x8,%edx
+  801154:	83 e2 0f             	and    $0xf,%edx
+  801157:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80115c:	83 fa 06             	cmp    $0x6,%edx
+  80115f:	74 0e                	je     80116f <sys_getenvid+0x6e>
+  801161:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801164:	0f b6 c9             	movzbl %cl,%ecx
+  801167:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80116d:	eb a1                	jmp    801110 <sys_getenvid+0xf>
+  80116f:	89 c2                	mov    %eax,%edx
+  801171:	c1 ea 04             	shr    $0x4,%edx
+  801174:	83 e2 0f             	and    $0xf,%edx
+  801177:	83 fa 02             	cmp    $0x2,%edx
+  80117a:	77 e5                	ja     801161 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  80117c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80117f:	83 f8 02             	cmp    $0x2,%eax
+  801182:	0f 97 c1             	seta   %cl
+  801185:	0f b6 c9             	movzbl %cl,%ecx
+  801188:	eb d7                	jmp    801161 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  80118a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80118f:	b8 02 00 00 00       	mov    $0x2,%eax
+  801194:	89 d1                	mov    %edx,%ecx
+  801196:	89 d3                	mov    %edx,%ebx
+  801198:	89 d7                	mov    %edx,%edi
+  80119a:	89 d6                	mov    %edx,%esi
+  80119c:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80119e:	eb 99                	jmp    801139 <sys_getenvid+0x38>
+
+008011a0 <sys_page_alloc>:
+{
+  8011a0:	55                   	push   %ebp
+  8011a1:	89 e5                	mov    %esp,%ebp
+  8011a3:	57                   	push   %edi
+  8011a4:	56                   	push   %esi
+  8011a5:	53                   	push   %ebx
+  8011a6:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8011a9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8011b0:	78 38                	js     8011ea <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  8011b2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8011b9:	74 7b                	je     801236 <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  8011bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c6:	b8 04 00 00 00       	mov    $0x4,%eax
+  8011cb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011ce:	89 f7                	mov    %esi,%edi
+  8011d0:	55                   	push   %ebp
+  8011d1:	68 da 11 80 00       	push   $0x8011da
+  8011d6:	89 e5                	mov    %esp,%ebp
+  8011d8:	0f 34                	sysenter
+  8011da:	83 c4 04             	add    $0x4,%esp
+  8011dd:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8011de:	85 c0                	test   %eax,%eax
+  8011e0:	7f 6d                	jg     80124f <sys_page_alloc+0xaf>
+}
+  8011e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e5:	5b                   	pop    %ebx
+  8011e6:	5e                   	pop    %esi
+  8011e7:	5f                   	pop    %edi
+  8011e8:	5d                   	pop    %ebp
+  8011e9:	c3                   	ret
+  8011ea:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011ef:	0f a2                	cpuid
+		return 0;
+  8011f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8011f6:	f6 c6 08             	test   $0x8,%dh
+  8011f9:	74 15                	je     801210 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011fb:	89 c2                	mov    %eax,%edx
+  8011fd:	c1 ea 08             	shr    $0x8,%edx
+  801200:	83 e2 0f             	and    $0xf,%edx
+  801203:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801208:	83 fa 06             	cmp    $0x6,%edx
+  80120b:	74 0e                	je     80121b <sys_page_alloc+0x7b>
+  80120d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801210:	0f b6 c9             	movzbl %cl,%ecx
+  801213:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801219:	eb 97                	jmp    8011b2 <sys_page_alloc+0x12>
+  80121b:	89 c2                	mov    %eax,%edx
+  80121d:	c1 ea 04             	shr    $0x4,%edx
+  801220:	83 e2 0f             	and    $0xf,%edx
+  801223:	83 fa 02             	cmp    $0x2,%edx
+  801226:	77 e5                	ja     80120d <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  801228:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80122b:	83 f8 02             	cmp    $0x2,%eax
+  80122e:	0f 97 c1             	seta   %cl
+  801231:	0f b6 c9             	movzbl %cl,%ecx
+  801234:	eb d7                	jmp    80120d <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  801236:	be 00 00 00 00       	mov    $0x0,%esi
+  80123b:	b8 04 00 00 00       	mov    $0x4,%eax
+  801240:	8b 55 08             	mov    0x8(%ebp),%edx
+  801243:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801246:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801249:	89 f7                	mov    %esi,%edi
+  80124b:	cd 30                	int    $0x30
+  80124d:	eb 8f                	jmp    8011de <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80124f:	83 ec 0c             	sub    $0xc,%esp
+  801252:	50                   	push   %eax
+  801253:	6a 04                	push   $0x4
+  801255:	68 19 34 80 00       	push   $0x803419
+  80125a:	6a 4a                	push   $0x4a
+  80125c:	68 36 34 80 00       	push   $0x803436
+  801261:	e8 03 f0 ff ff       	call   800269 <_panic>
+
+00801266 <sys_page_map>:
+{
+  801266:	55                   	push   %ebp
+  801267:	89 e5                	mov    %esp,%ebp
+  801269:	57                   	push   %edi
+  80126a:	56                   	push   %esi
+  80126b:	53                   	push   %ebx
+  80126c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80126f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801276:	78 37                	js     8012af <sys_page_map+0x49>
+	if (syscall_sysenter)
+  801278:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80127f:	74 7a                	je     8012fb <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  801281:	8b 55 08             	mov    0x8(%ebp),%edx
+  801284:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801287:	b8 05 00 00 00       	mov    $0x5,%eax
+  80128c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80128f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801292:	8b 75 18             	mov    0x18(%ebp),%esi
+  801295:	55                   	push   %ebp
+  801296:	68 9f 12 80 00       	push   $0x80129f
+  80129b:	89 e5                	mov    %esp,%ebp
+  80129d:	0f 34                	sysenter
+  80129f:	83 c4 04             	add    $0x4,%esp
+  8012a2:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8012a3:	85 c0                	test   %eax,%eax
+  8012a5:	7f 6c                	jg     801313 <sys_page_map+0xad>
+}
+  8012a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012aa:	5b                   	pop    %ebx
+  8012ab:	5e                   	pop    %esi
+  8012ac:	5f                   	pop    %edi
+  8012ad:	5d                   	pop    %ebp
+  8012ae:	c3                   	ret
+  8012af:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012b4:	0f a2                	cpuid
+		return 0;
+  8012b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8012bb:	f6 c6 08             	test   $0x8,%dh
+  8012be:	74 15                	je     8012d5 <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012c0:	89 c2                	mov    %eax,%edx
+  8012c2:	c1 ea 08             	shr    $0x8,%edx
+  8012c5:	83 e2 0f             	and    $0xf,%edx
+  8012c8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012cd:	83 fa 06             	cmp    $0x6,%edx
+  8012d0:	74 0e                	je     8012e0 <sys_page_map+0x7a>
+  8012d2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8012d5:	0f b6 c9             	movzbl %cl,%ecx
+  8012d8:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8012de:	eb 98                	jmp    801278 <sys_page_map+0x12>
+  8012e0:	89 c2                	mov    %eax,%edx
+  8012e2:	c1 ea 04             	shr    $0x4,%edx
+  8012e5:	83 e2 0f             	and    $0xf,%edx
+  8012e8:	83 fa 02             	cmp    $0x2,%edx
+  8012eb:	77 e5                	ja     8012d2 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  8012ed:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012f0:	83 f8 02             	cmp    $0x2,%eax
+  8012f3:	0f 97 c1             	seta   %cl
+  8012f6:	0f b6 c9             	movzbl %cl,%ecx
+  8012f9:	eb d7                	jmp    8012d2 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  8012fb:	b8 05 00 00 00       	mov    $0x5,%eax
+  801300:	8b 55 08             	mov    0x8(%ebp),%edx
+  801303:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801306:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801309:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80130c:	8b 75 18             	mov    0x18(%ebp),%esi
+  80130f:	cd 30                	int    $0x30
+  801311:	eb 90                	jmp    8012a3 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801313:	83 ec 0c             	sub    $0xc,%esp
+  801316:	50                   	push   %eax
+  801317:	6a 05                	push   $0x5
+  801319:	68 19 34 80 00       	push   $0x803419
+  80131e:	6a 4a                	push   $0x4a
+  801320:	68 36 34 80 00       	push   $0x803436
+  801325:	e8 3f ef ff ff       	call   800269 <_panic>
+
+0080132a <sys_page_unmap>:
+{
+  80132a:	55                   	push   %ebp
+  80132b:	89 e5                	mov    %esp,%ebp
+  80132d:	57                   	push   %edi
+  80132e:	56                   	push   %esi
+  80132f:	53                   	push   %ebx
+  801330:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801333:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80133a:	78 37                	js     801373 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  80133c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801343:	74 7a                	je     8013bf <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  801345:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80134a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80134d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801350:	b8 06 00 00 00       	mov    $0x6,%eax
+  801355:	89 df                	mov    %ebx,%edi
+  801357:	89 de                	mov    %ebx,%esi
+  801359:	55                   	push   %ebp
+  80135a:	68 63 13 80 00       	push   $0x801363
+  80135f:	89 e5                	mov    %esp,%ebp
+  801361:	0f 34                	sysenter
+  801363:	83 c4 04             	add    $0x4,%esp
+  801366:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801367:	85 c0                	test   %eax,%eax
+  801369:	7f 6c                	jg     8013d7 <sys_page_unmap+0xad>
+}
+  80136b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80136e:	5b                   	pop    %ebx
+  80136f:	5e                   	pop    %esi
+  801370:	5f                   	pop    %edi
+  801371:	5d                   	pop    %ebp
+  801372:	c3                   	ret
+  801373:	b8 01 00 00 00       	mov    $0x1,%eax
+  801378:	0f a2                	cpuid
+		return 0;
+  80137a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80137f:	f6 c6 08             	test   $0x8,%dh
+  801382:	74 15                	je     801399 <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801384:	89 c2                	mov    %eax,%edx
+  801386:	c1 ea 08             	shr    $0x8,%edx
+  801389:	83 e2 0f             	and    $0xf,%edx
+  80138c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801391:	83 fa 06             	cmp    $0x6,%edx
+  801394:	74 0e                	je     8013a4 <sys_page_unmap+0x7a>
+  801396:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801399:	0f b6 c9             	movzbl %cl,%ecx
+  80139c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8013a2:	eb 98                	jmp    80133c <sys_page_unmap+0x12>
+  8013a4:	89 c2                	mov    %eax,%edx
+  8013a6:	c1 ea 04             	shr    $0x4,%edx
+  8013a9:	83 e2 0f             	and    $0xf,%edx
+  8013ac:	83 fa 02             	cmp    $0x2,%edx
+  8013af:	77 e5                	ja     801396 <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  8013b1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013b4:	83 f8 02             	cmp    $0x2,%eax
+  8013b7:	0f 97 c1             	seta   %cl
+  8013ba:	0f b6 c9             	movzbl %cl,%ecx
+  8013bd:	eb d7                	jmp    801396 <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  8013bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013c4:	b8 06 00 00 00       	mov    $0x6,%eax
+  8013c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013cf:	89 df                	mov    %ebx,%edi
+  8013d1:	89 de                	mov    %ebx,%esi
+  8013d3:	cd 30                	int    $0x30
+  8013d5:	eb 90                	jmp    801367 <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013d7:	83 ec 0c             	sub    $0xc,%esp
+  8013da:	50                   	push   %eax
+  8013db:	6a 06                	push   $0x6
+  8013dd:	68 19 34 80 00       	push   $0x803419
+  8013e2:	6a 4a                	push   $0x4a
+  8013e4:	68 36 34 80 00       	push   $0x803436
+  8013e9:	e8 7b ee ff ff       	call   800269 <_panic>
+
+008013ee <sys_page_copy>:
+{
+  8013ee:	55                   	push   %ebp
+  8013ef:	89 e5                	mov    %esp,%ebp
+  8013f1:	57                   	push   %edi
+  8013f2:	56                   	push   %esi
+  8013f3:	53                   	push   %ebx
+  8013f4:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8013f7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8013fe:	78 37                	js     801437 <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  801400:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801407:	74 7a                	je     801483 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  801409:	8b 55 08             	mov    0x8(%ebp),%edx
+  80140c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80140f:	b8 29 00 00 00       	mov    $0x29,%eax
+  801414:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801417:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80141a:	8b 75 18             	mov    0x18(%ebp),%esi
+  80141d:	55                   	push   %ebp
+  80141e:	68 27 14 80 00       	push   $0x801427
+  801423:	89 e5                	mov    %esp,%ebp
+  801425:	0f 34                	sysenter
+  801427:	83 c4 04             	add    $0x4,%esp
+  80142a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80142b:	85 c0                	test   %eax,%eax
+  80142d:	7f 6c                	jg     80149b <sys_page_copy+0xad>
+}
+  80142f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801432:	5b                   	pop    %ebx
+  801433:	5e                   	pop    %esi
+  801434:	5f                   	pop    %edi
+  801435:	5d                   	pop    %ebp
+  801436:	c3                   	ret
+  801437:	b8 01 00 00 00       	mov    $0x1,%eax
+  80143c:	0f a2                	cpuid
+		return 0;
+  80143e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801443:	f6 c6 08             	test   $0x8,%dh
+  801446:	74 15                	je     80145d <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801448:	89 c2                	mov    %eax,%edx
+  80144a:	c1 ea 08             	shr    $0x8,%edx
+  80144d:	83 e2 0f             	and    $0xf,%edx
+  801450:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801455:	83 fa 06             	cmp    $0x6,%edx
+  801458:	74 0e                	je     801468 <sys_page_copy+0x7a>
+  80145a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80145d:	0f b6 c9             	movzbl %cl,%ecx
+  801460:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801466:	eb 98                	jmp    801400 <sys_page_copy+0x12>
+  801468:	89 c2                	mov    %eax,%edx
+  80146a:	c1 ea 04             	shr    $0x4,%edx
+  80146d:	83 e2 0f             	and    $0xf,%edx
+  801470:	83 fa 02             	cmp    $0x2,%edx
+  801473:	77 e5                	ja     80145a <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  801475:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801478:	83 f8 02             	cmp    $0x2,%eax
+  80147b:	0f 97 c1             	seta   %cl
+  80147e:	0f b6 c9             	movzbl %cl,%ecx
+  801481:	eb d7                	jmp    80145a <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  801483:	b8 29 00 00 00       	mov    $0x29,%eax
+  801488:	8b 55 08             	mov    0x8(%ebp),%edx
+  80148b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80148e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801491:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801494:	8b 75 18             	mov    0x18(%ebp),%esi
+  801497:	cd 30                	int    $0x30
+  801499:	eb 90                	jmp    80142b <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80149b:	83 ec 0c             	sub    $0xc,%esp
+  80149e:	50                   	push   %eax
+  80149f:	6a 29                	push   $0x29
+  8014a1:	68 19 34 80 00       	push   $0x803419
+  8014a6:	6a 4a                	push   $0x4a
+  8014a8:	68 36 34 80 00       	push   $0x803436
+  8014ad:	e8 b7 ed ff ff       	call   800269 <_panic>
+
+008014b2 <sys_yield>:
+{
+  8014b2:	55                   	push   %ebp
+  8014b3:	89 e5                	mov    %esp,%ebp
+  8014b5:	57                   	push   %edi
+  8014b6:	56                   	push   %esi
+  8014b7:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8014b8:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8014bf:	78 2e                	js     8014ef <sys_yield+0x3d>
+	if (syscall_sysenter)
+  8014c1:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8014c8:	74 71                	je     80153b <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  8014ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014cf:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8014d4:	89 d1                	mov    %edx,%ecx
+  8014d6:	89 d3                	mov    %edx,%ebx
+  8014d8:	89 d7                	mov    %edx,%edi
+  8014da:	89 d6                	mov    %edx,%esi
+  8014dc:	55                   	push   %ebp
+  8014dd:	68 e6 14 80 00       	push   $0x8014e6
+  8014e2:	89 e5                	mov    %esp,%ebp
+  8014e4:	0f 34                	sysenter
+  8014e6:	83 c4 04             	add    $0x4,%esp
+  8014e9:	5d                   	pop    %ebp
+}
+  8014ea:	5b                   	pop    %ebx
+  8014eb:	5e                   	pop    %esi
+  8014ec:	5f                   	pop    %edi
+  8014ed:	5d                   	pop    %ebp
+  8014ee:	c3                   	ret
+  8014ef:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014f4:	0f a2                	cpuid
+		return 0;
+  8014f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8014fb:	f6 c6 08             	test   $0x8,%dh
+  8014fe:	74 15                	je     801515 <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801500:	89 c2                	mov    %eax,%edx
+  801502:	c1 ea 08             	shr    $0x8,%edx
+  801505:	83 e2 0f             	and    $0xf,%edx
+  801508:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80150d:	83 fa 06             	cmp    $0x6,%edx
+  801510:	74 0e                	je     801520 <sys_yield+0x6e>
+  801512:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801515:	0f b6 c9             	movzbl %cl,%ecx
+  801518:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80151e:	eb a1                	jmp    8014c1 <sys_yield+0xf>
+  801520:	89 c2                	mov    %eax,%edx
+  801522:	c1 ea 04             	shr    $0x4,%edx
+  801525:	83 e2 0f             	and    $0xf,%edx
+  801528:	83 fa 02             	cmp    $0x2,%edx
+  80152b:	77 e5                	ja     801512 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  80152d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801530:	83 f8 02             	cmp    $0x2,%eax
+  801533:	0f 97 c1             	seta   %cl
+  801536:	0f b6 c9             	movzbl %cl,%ecx
+  801539:	eb d7                	jmp    801512 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  80153b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801540:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801545:	89 d1                	mov    %edx,%ecx
+  801547:	89 d3                	mov    %edx,%ebx
+  801549:	89 d7                	mov    %edx,%edi
+  80154b:	89 d6                	mov    %edx,%esi
+  80154d:	cd 30                	int    $0x30
+}
+  80154f:	eb 99                	jmp    8014ea <sys_yield+0x38>
+
+00801551 <sys_env_set_status>:
+{
+  801551:	55                   	push   %ebp
+  801552:	89 e5                	mov    %esp,%ebp
+  801554:	57                   	push   %edi
+  801555:	56                   	push   %esi
+  801556:	53                   	push   %ebx
+  801557:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80155a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801561:	78 37                	js     80159a <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  801563:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80156a:	74 7a                	je     8015e6 <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  80156c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801571:	8b 55 08             	mov    0x8(%ebp),%edx
+  801574:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801577:	b8 08 00 00 00       	mov    $0x8,%eax
+  80157c:	89 df                	mov    %ebx,%edi
+  80157e:	89 de                	mov    %ebx,%esi
+  801580:	55                   	push   %ebp
+  801581:	68 8a 15 80 00       	push   $0x80158a
+  801586:	89 e5                	mov    %esp,%ebp
+  801588:	0f 34                	sysenter
+  80158a:	83 c4 04             	add    $0x4,%esp
+  80158d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80158e:	85 c0                	test   %eax,%eax
+  801590:	7f 6c                	jg     8015fe <sys_env_set_status+0xad>
+}
+  801592:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801595:	5b                   	pop    %ebx
+  801596:	5e                   	pop    %esi
+  801597:	5f                   	pop    %edi
+  801598:	5d                   	pop    %ebp
+  801599:	c3                   	ret
+  80159a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80159f:	0f a2                	cpuid
+		return 0;
+  8015a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8015a6:	f6 c6 08             	test   $0x8,%dh
+  8015a9:	74 15                	je     8015c0 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015ab:	89 c2                	mov    %eax,%edx
+  8015ad:	c1 ea 08             	shr    $0x8,%edx
+  8015b0:	83 e2 0f             	and    $0xf,%edx
+  8015b3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8015b8:	83 fa 06             	cmp    $0x6,%edx
+  8015bb:	74 0e                	je     8015cb <sys_env_set_status+0x7a>
+  8015bd:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8015c0:	0f b6 c9             	movzbl %cl,%ecx
+  8015c3:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8015c9:	eb 98                	jmp    801563 <sys_env_set_status+0x12>
+  8015cb:	89 c2                	mov    %eax,%edx
+  8015cd:	c1 ea 04             	shr    $0x4,%edx
+  8015d0:	83 e2 0f             	and    $0xf,%edx
+  8015d3:	83 fa 02             	cmp    $0x2,%edx
+  8015d6:	77 e5                	ja     8015bd <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  8015d8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015db:	83 f8 02             	cmp    $0x2,%eax
+  8015de:	0f 97 c1             	seta   %cl
+  8015e1:	0f b6 c9             	movzbl %cl,%ecx
+  8015e4:	eb d7                	jmp    8015bd <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  8015e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015eb:	b8 08 00 00 00       	mov    $0x8,%eax
+  8015f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015f6:	89 df                	mov    %ebx,%edi
+  8015f8:	89 de                	mov    %ebx,%esi
+  8015fa:	cd 30                	int    $0x30
+  8015fc:	eb 90                	jmp    80158e <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015fe:	83 ec 0c             	sub    $0xc,%esp
+  801601:	50                   	push   %eax
+  801602:	6a 08                	push   $0x8
+  801604:	68 19 34 80 00       	push   $0x803419
+  801609:	6a 4a                	push   $0x4a
+  80160b:	68 36 34 80 00       	push   $0x803436
+  801610:	e8 54 ec ff ff       	call   800269 <_panic>
+
+00801615 <sys_sysinfo>:
+{
+  801615:	55                   	push   %ebp
+  801616:	89 e5                	mov    %esp,%ebp
+  801618:	57                   	push   %edi
+  801619:	56                   	push   %esi
+  80161a:	53                   	push   %ebx
+  80161b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80161e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801625:	78 36                	js     80165d <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  801627:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80162e:	74 79                	je     8016a9 <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  801630:	8b 55 08             	mov    0x8(%ebp),%edx
+  801633:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801638:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80163d:	89 cb                	mov    %ecx,%ebx
+  80163f:	89 cf                	mov    %ecx,%edi
+  801641:	89 ce                	mov    %ecx,%esi
+  801643:	55                   	push   %ebp
+  801644:	68 4d 16 80 00       	push   $0x80164d
+  801649:	89 e5                	mov    %esp,%ebp
+  80164b:	0f 34                	sysenter
+  80164d:	83 c4 04             	add    $0x4,%esp
+  801650:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801651:	85 c0                	test   %eax,%eax
+  801653:	7f 6b                	jg     8016c0 <sys_sysinfo+0xab>
+}
+  801655:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801658:	5b                   	pop    %ebx
+  801659:	5e                   	pop    %esi
+  80165a:	5f                   	pop    %edi
+  80165b:	5d                   	pop    %ebp
+  80165c:	c3                   	ret
+  80165d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801662:	0f a2                	cpuid
+		return 0;
+  801664:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801669:	f6 c6 08             	test   $0x8,%dh
+  80166c:	74 15                	je     801683 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80166e:	89 c2                	mov    %eax,%edx
+  801670:	c1 ea 08             	shr    $0x8,%edx
+  801673:	83 e2 0f             	and    $0xf,%edx
+  801676:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80167b:	83 fa 06             	cmp    $0x6,%edx
+  80167e:	74 0e                	je     80168e <sys_sysinfo+0x79>
+  801680:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801683:	0f b6 c9             	movzbl %cl,%ecx
+  801686:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80168c:	eb 99                	jmp    801627 <sys_sysinfo+0x12>
+  80168e:	89 c2                	mov    %eax,%edx
+  801690:	c1 ea 04             	shr    $0x4,%edx
+  801693:	83 e2 0f             	and    $0xf,%edx
+  801696:	83 fa 02             	cmp    $0x2,%edx
+  801699:	77 e5                	ja     801680 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  80169b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80169e:	83 f8 02             	cmp    $0x2,%eax
+  8016a1:	0f 97 c1             	seta   %cl
+  8016a4:	0f b6 c9             	movzbl %cl,%ecx
+  8016a7:	eb d7                	jmp    801680 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  8016a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016ae:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8016b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b6:	89 cb                	mov    %ecx,%ebx
+  8016b8:	89 cf                	mov    %ecx,%edi
+  8016ba:	89 ce                	mov    %ecx,%esi
+  8016bc:	cd 30                	int    $0x30
+  8016be:	eb 91                	jmp    801651 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016c0:	83 ec 0c             	sub    $0xc,%esp
+  8016c3:	50                   	push   %eax
+  8016c4:	6a 0b                	push   $0xb
+  8016c6:	68 19 34 80 00       	push   $0x803419
+  8016cb:	6a 4a                	push   $0x4a
+  8016cd:	68 36 34 80 00       	push   $0x803436
+  8016d2:	e8 92 eb ff ff       	call   800269 <_panic>
+
+008016d7 <sys_env_set_trapframe>:
+{
+  8016d7:	55                   	push   %ebp
+  8016d8:	89 e5                	mov    %esp,%ebp
+  8016da:	57                   	push   %edi
+  8016db:	56                   	push   %esi
+  8016dc:	53                   	push   %ebx
+  8016dd:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8016e0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8016e7:	78 37                	js     801720 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  8016e9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8016f0:	74 7a                	je     80176c <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  8016f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016fd:	b8 13 00 00 00       	mov    $0x13,%eax
+  801702:	89 df                	mov    %ebx,%edi
+  801704:	89 de                	mov    %ebx,%esi
+  801706:	55                   	push   %ebp
+  801707:	68 10 17 80 00       	push   $0x801710
+  80170c:	89 e5                	mov    %esp,%ebp
+  80170e:	0f 34                	sysenter
+  801710:	83 c4 04             	add    $0x4,%esp
+  801713:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801714:	85 c0                	test   %eax,%eax
+  801716:	7f 6c                	jg     801784 <sys_env_set_trapframe+0xad>
+}
+  801718:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80171b:	5b                   	pop    %ebx
+  80171c:	5e                   	pop    %esi
+  80171d:	5f                   	pop    %edi
+  80171e:	5d                   	pop    %ebp
+  80171f:	c3                   	ret
+  801720:	b8 01 00 00 00       	mov    $0x1,%eax
+  801725:	0f a2                	cpuid
+		return 0;
+  801727:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80172c:	f6 c6 08             	test   $0x8,%dh
+  80172f:	74 15                	je     801746 <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801731:	89 c2                	mov    %eax,%edx
+  801733:	c1 ea 08             	shr    $0x8,%edx
+  801736:	83 e2 0f             	and    $0xf,%edx
+  801739:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80173e:	83 fa 06             	cmp    $0x6,%edx
+  801741:	74 0e                	je     801751 <sys_env_set_trapframe+0x7a>
+  801743:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801746:	0f b6 c9             	movzbl %cl,%ecx
+  801749:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80174f:	eb 98                	jmp    8016e9 <sys_env_set_trapframe+0x12>
+  801751:	89 c2                	mov    %eax,%edx
+  801753:	c1 ea 04             	shr    $0x4,%edx
+  801756:	83 e2 0f             	and    $0xf,%edx
+  801759:	83 fa 02             	cmp    $0x2,%edx
+  80175c:	77 e5                	ja     801743 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  80175e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801761:	83 f8 02             	cmp    $0x2,%eax
+  801764:	0f 97 c1             	seta   %cl
+  801767:	0f b6 c9             	movzbl %cl,%ecx
+  80176a:	eb d7                	jmp    801743 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  80176c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801771:	b8 13 00 00 00       	mov    $0x13,%eax
+  801776:	8b 55 08             	mov    0x8(%ebp),%edx
+  801779:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80177c:	89 df                	mov    %ebx,%edi
+  80177e:	89 de                	mov    %ebx,%esi
+  801780:	cd 30                	int    $0x30
+  801782:	eb 90                	jmp    801714 <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801784:	83 ec 0c             	sub    $0xc,%esp
+  801787:	50                   	push   %eax
+  801788:	6a 13                	push   $0x13
+  80178a:	68 19 34 80 00       	push   $0x803419
+  80178f:	6a 4a                	push   $0x4a
+  801791:	68 36 34 80 00       	push   $0x803436
+  801796:	e8 ce ea ff ff       	call   800269 <_panic>
+
+0080179b <sys_env_set_stack_limit>:
+{
+  80179b:	55                   	push   %ebp
+  80179c:	89 e5                	mov    %esp,%ebp
+  80179e:	57                   	push   %edi
+  80179f:	56                   	push   %esi
+  8017a0:	53                   	push   %ebx
+  8017a1:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8017a4:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8017ab:	78 37                	js     8017e4 <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  8017ad:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8017b4:	74 7a                	je     801830 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  8017b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017c1:	b8 19 00 00 00       	mov    $0x19,%eax
+  8017c6:	89 df                	mov    %ebx,%edi
+  8017c8:	89 de                	mov    %ebx,%esi
+  8017ca:	55                   	push   %ebp
+  8017cb:	68 d4 17 80 00       	push   $0x8017d4
+  8017d0:	89 e5                	mov    %esp,%ebp
+  8017d2:	0f 34                	sysenter
+  8017d4:	83 c4 04             	add    $0x4,%esp
+  8017d7:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8017d8:	85 c0                	test   %eax,%eax
+  8017da:	7f 6c                	jg     801848 <sys_env_set_stack_limit+0xad>
+}
+  8017dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017df:	5b                   	pop    %ebx
+  8017e0:	5e                   	pop    %esi
+  8017e1:	5f                   	pop    %edi
+  8017e2:	5d                   	pop    %ebp
+  8017e3:	c3                   	ret
+  8017e4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8017e9:	0f a2                	cpuid
+		return 0;
+  8017eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8017f0:	f6 c6 08             	test   $0x8,%dh
+  8017f3:	74 15                	je     80180a <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017f5:	89 c2                	mov    %eax,%edx
+  8017f7:	c1 ea 08             	shr    $0x8,%edx
+  8017fa:	83 e2 0f             	and    $0xf,%edx
+  8017fd:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801802:	83 fa 06             	cmp    $0x6,%edx
+  801805:	74 0e                	je     801815 <sys_env_set_stack_limit+0x7a>
+  801807:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80180a:	0f b6 c9             	movzbl %cl,%ecx
+  80180d:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801813:	eb 98                	jmp    8017ad <sys_env_set_stack_limit+0x12>
+  801815:	89 c2                	mov    %eax,%edx
+  801817:	c1 ea 04             	shr    $0x4,%edx
+  80181a:	83 e2 0f             	and    $0xf,%edx
+  80181d:	83 fa 02             	cmp    $0x2,%edx
+  801820:	77 e5                	ja     801807 <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  801822:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801825:	83 f8 02             	cmp    $0x2,%eax
+  801828:	0f 97 c1             	seta   %cl
+  80182b:	0f b6 c9             	movzbl %cl,%ecx
+  80182e:	eb d7                	jmp    801807 <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  801830:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801835:	b8 19 00 00 00       	mov    $0x19,%eax
+  80183a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80183d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801840:	89 df                	mov    %ebx,%edi
+  801842:	89 de                	mov    %ebx,%esi
+  801844:	cd 30                	int    $0x30
+  801846:	eb 90                	jmp    8017d8 <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801848:	83 ec 0c             	sub    $0xc,%esp
+  80184b:	50                   	push   %eax
+  80184c:	6a 19                	push   $0x19
+  80184e:	68 19 34 80 00       	push   $0x803419
+  801853:	6a 4a                	push   $0x4a
+  801855:	68 36 34 80 00       	push   $0x803436
+  80185a:	e8 0a ea ff ff       	call   800269 <_panic>
+
+0080185f <sys_env_set_pgfault_upcall>:
+{
+  80185f:	55                   	push   %ebp
+  801860:	89 e5                	mov    %esp,%ebp
+  801862:	57                   	push   %edi
+  801863:	56                   	push   %esi
+  801864:	53                   	push   %ebx
+  801865:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801868:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80186f:	78 37                	js     8018a8 <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  801871:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801878:	74 7a                	je     8018f4 <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  80187a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80187f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801882:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801885:	b8 09 00 00 00       	mov    $0x9,%eax
+  80188a:	89 df                	mov    %ebx,%edi
+  80188c:	89 de                	mov    %ebx,%esi
+  80188e:	55                   	push   %ebp
+  80188f:	68 98 18 80 00       	push   $0x801898
+  801894:	89 e5                	mov    %esp,%ebp
+  801896:	0f 34                	sysenter
+  801898:	83 c4 04             	add    $0x4,%esp
+  80189b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80189c:	85 c0                	test   %eax,%eax
+  80189e:	7f 6c                	jg     80190c <sys_env_set_pgfault_upcall+0xad>
+}
+  8018a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018a3:	5b                   	pop    %ebx
+  8018a4:	5e                   	pop    %esi
+  8018a5:	5f                   	pop    %edi
+  8018a6:	5d                   	pop    %ebp
+  8018a7:	c3                   	ret
+  8018a8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018ad:	0f a2                	cpuid
+		return 0;
+  8018af:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018b4:	f6 c6 08             	test   $0x8,%dh
+  8018b7:	74 15                	je     8018ce <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018b9:	89 c2                	mov    %eax,%edx
+  8018bb:	c1 ea 08             	shr    $0x8,%edx
+  8018be:	83 e2 0f             	and    $0xf,%edx
+  8018c1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018c6:	83 fa 06             	cmp    $0x6,%edx
+  8018c9:	74 0e                	je     8018d9 <sys_env_set_pgfault_upcall+0x7a>
+  8018cb:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8018ce:	0f b6 c9             	movzbl %cl,%ecx
+  8018d1:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8018d7:	eb 98                	jmp    801871 <sys_env_set_pgfault_upcall+0x12>
+  8018d9:	89 c2                	mov    %eax,%edx
+  8018db:	c1 ea 04             	shr    $0x4,%edx
+  8018de:	83 e2 0f             	and    $0xf,%edx
+  8018e1:	83 fa 02             	cmp    $0x2,%edx
+  8018e4:	77 e5                	ja     8018cb <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  8018e6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018e9:	83 f8 02             	cmp    $0x2,%eax
+  8018ec:	0f 97 c1             	seta   %cl
+  8018ef:	0f b6 c9             	movzbl %cl,%ecx
+  8018f2:	eb d7                	jmp    8018cb <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  8018f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018f9:	b8 09 00 00 00       	mov    $0x9,%eax
+  8018fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801901:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801904:	89 df                	mov    %ebx,%edi
+  801906:	89 de                	mov    %ebx,%esi
+  801908:	cd 30                	int    $0x30
+  80190a:	eb 90                	jmp    80189c <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80190c:	83 ec 0c             	sub    $0xc,%esp
+  80190f:	50                   	push   %eax
+  801910:	6a 09                	push   $0x9
+  801912:	68 19 34 80 00       	push   $0x803419
+  801917:	6a 4a                	push   $0x4a
+  801919:	68 36 34 80 00       	push   $0x803436
+  80191e:	e8 46 e9 ff ff       	call   800269 <_panic>
+
+00801923 <sys_ipc_try_send>:
+{
+  801923:	55                   	push   %ebp
+  801924:	89 e5                	mov    %esp,%ebp
+  801926:	57                   	push   %edi
+  801927:	56                   	push   %esi
+  801928:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801929:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801930:	78 32                	js     801964 <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  801932:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801939:	74 75                	je     8019b0 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  80193b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80193e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801941:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801946:	be 00 00 00 00       	mov    $0x0,%esi
+  80194b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80194e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801951:	55                   	push   %ebp
+  801952:	68 5b 19 80 00       	push   $0x80195b
+  801957:	89 e5                	mov    %esp,%ebp
+  801959:	0f 34                	sysenter
+  80195b:	83 c4 04             	add    $0x4,%esp
+  80195e:	5d                   	pop    %ebp
+}
+  80195f:	5b                   	pop    %ebx
+  801960:	5e                   	pop    %esi
+  801961:	5f                   	pop    %edi
+  801962:	5d                   	pop    %ebp
+  801963:	c3                   	ret
+  801964:	b8 01 00 00 00       	mov    $0x1,%eax
+  801969:	0f a2                	cpuid
+		return 0;
+  80196b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801970:	f6 c6 08             	test   $0x8,%dh
+  801973:	74 15                	je     80198a <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801975:	89 c2                	mov    %eax,%edx
+  801977:	c1 ea 08             	shr    $0x8,%edx
+  80197a:	83 e2 0f             	and    $0xf,%edx
+  80197d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801982:	83 fa 06             	cmp    $0x6,%edx
+  801985:	74 0e                	je     801995 <sys_ipc_try_send+0x72>
+  801987:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80198a:	0f b6 c9             	movzbl %cl,%ecx
+  80198d:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801993:	eb 9d                	jmp    801932 <sys_ipc_try_send+0xf>
+  801995:	89 c2                	mov    %eax,%edx
+  801997:	c1 ea 04             	shr    $0x4,%edx
+  80199a:	83 e2 0f             	and    $0xf,%edx
+  80199d:	83 fa 02             	cmp    $0x2,%edx
+  8019a0:	77 e5                	ja     801987 <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  8019a2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019a5:	83 f8 02             	cmp    $0x2,%eax
+  8019a8:	0f 97 c1             	seta   %cl
+  8019ab:	0f b6 c9             	movzbl %cl,%ecx
+  8019ae:	eb d7                	jmp    801987 <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  8019b0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8019b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8019ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019c0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019c3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8019c6:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  8019c8:	eb 95                	jmp    80195f <sys_ipc_try_send+0x3c>
+
+008019ca <sys_ipc_send>:
+{
+  8019ca:	55                   	push   %ebp
+  8019cb:	89 e5                	mov    %esp,%ebp
+  8019cd:	57                   	push   %edi
+  8019ce:	56                   	push   %esi
+  8019cf:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8019d0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8019d7:	78 32                	js     801a0b <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  8019d9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8019e0:	74 75                	je     801a57 <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  8019e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019e8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8019ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8019f2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019f5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8019f8:	55                   	push   %ebp
+  8019f9:	68 02 1a 80 00       	push   $0x801a02
+  8019fe:	89 e5                	mov    %esp,%ebp
+  801a00:	0f 34                	sysenter
+  801a02:	83 c4 04             	add    $0x4,%esp
+  801a05:	5d                   	pop    %ebp
+}
+  801a06:	5b                   	pop    %ebx
+  801a07:	5e                   	pop    %esi
+  801a08:	5f                   	pop    %edi
+  801a09:	5d                   	pop    %ebp
+  801a0a:	c3                   	ret
+  801a0b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a10:	0f a2                	cpuid
+		return 0;
+  801a12:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801a17:	f6 c6 08             	test   $0x8,%dh
+  801a1a:	74 15                	je     801a31 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a1c:	89 c2                	mov    %eax,%edx
+  801a1e:	c1 ea 08             	shr    $0x8,%edx
+  801a21:	83 e2 0f             	and    $0xf,%edx
+  801a24:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a29:	83 fa 06             	cmp    $0x6,%edx
+  801a2c:	74 0e                	je     801a3c <sys_ipc_send+0x72>
+  801a2e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a31:	0f b6 c9             	movzbl %cl,%ecx
+  801a34:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801a3a:	eb 9d                	jmp    8019d9 <sys_ipc_send+0xf>
+  801a3c:	89 c2                	mov    %eax,%edx
+  801a3e:	c1 ea 04             	shr    $0x4,%edx
+  801a41:	83 e2 0f             	and    $0xf,%edx
+  801a44:	83 fa 02             	cmp    $0x2,%edx
+  801a47:	77 e5                	ja     801a2e <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  801a49:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a4c:	83 f8 02             	cmp    $0x2,%eax
+  801a4f:	0f 97 c1             	seta   %cl
+  801a52:	0f b6 c9             	movzbl %cl,%ecx
+  801a55:	eb d7                	jmp    801a2e <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  801a57:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801a5c:	be 00 00 00 00       	mov    $0x0,%esi
+  801a61:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a67:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a6a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a6d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801a6f:	eb 95                	jmp    801a06 <sys_ipc_send+0x3c>
+
+00801a71 <sys_ipc_recv>:
+{
+  801a71:	55                   	push   %ebp
+  801a72:	89 e5                	mov    %esp,%ebp
+  801a74:	57                   	push   %edi
+  801a75:	56                   	push   %esi
+  801a76:	53                   	push   %ebx
+  801a77:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801a7a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a81:	78 36                	js     801ab9 <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  801a83:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a8a:	74 79                	je     801b05 <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  801a8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a8f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a94:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801a99:	89 cb                	mov    %ecx,%ebx
+  801a9b:	89 cf                	mov    %ecx,%edi
+  801a9d:	89 ce                	mov    %ecx,%esi
+  801a9f:	55                   	push   %ebp
+  801aa0:	68 a9 1a 80 00       	push   $0x801aa9
+  801aa5:	89 e5                	mov    %esp,%ebp
+  801aa7:	0f 34                	sysenter
+  801aa9:	83 c4 04             	add    $0x4,%esp
+  801aac:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801aad:	85 c0                	test   %eax,%eax
+  801aaf:	7f 6b                	jg     801b1c <sys_ipc_recv+0xab>
+}
+  801ab1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ab4:	5b                   	pop    %ebx
+  801ab5:	5e                   	pop    %esi
+  801ab6:	5f                   	pop    %edi
+  801ab7:	5d                   	pop    %ebp
+  801ab8:	c3                   	ret
+  801ab9:	b8 01 00 00 00       	mov    $0x1,%eax
+  801abe:	0f a2                	cpuid
+		return 0;
+  801ac0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801ac5:	f6 c6 08             	test   $0x8,%dh
+  801ac8:	74 15                	je     801adf <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801aca:	89 c2                	mov    %eax,%edx
+  801acc:	c1 ea 08             	shr    $0x8,%edx
+  801acf:	83 e2 0f             	and    $0xf,%edx
+  801ad2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ad7:	83 fa 06             	cmp    $0x6,%edx
+  801ada:	74 0e                	je     801aea <sys_ipc_recv+0x79>
+  801adc:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801adf:	0f b6 c9             	movzbl %cl,%ecx
+  801ae2:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801ae8:	eb 99                	jmp    801a83 <sys_ipc_recv+0x12>
+  801aea:	89 c2                	mov    %eax,%edx
+  801aec:	c1 ea 04             	shr    $0x4,%edx
+  801aef:	83 e2 0f             	and    $0xf,%edx
+  801af2:	83 fa 02             	cmp    $0x2,%edx
+  801af5:	77 e5                	ja     801adc <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  801af7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801afa:	83 f8 02             	cmp    $0x2,%eax
+  801afd:	0f 97 c1             	seta   %cl
+  801b00:	0f b6 c9             	movzbl %cl,%ecx
+  801b03:	eb d7                	jmp    801adc <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  801b05:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b0a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801b0f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b12:	89 cb                	mov    %ecx,%ebx
+  801b14:	89 cf                	mov    %ecx,%edi
+  801b16:	89 ce                	mov    %ecx,%esi
+  801b18:	cd 30                	int    $0x30
+  801b1a:	eb 91                	jmp    801aad <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801b1c:	83 ec 0c             	sub    $0xc,%esp
+  801b1f:	50                   	push   %eax
+  801b20:	6a 0d                	push   $0xd
+  801b22:	68 19 34 80 00       	push   $0x803419
+  801b27:	6a 4a                	push   $0x4a
+  801b29:	68 36 34 80 00       	push   $0x803436
+  801b2e:	e8 36 e7 ff ff       	call   800269 <_panic>
+
+00801b33 <sys_ipc_send_range>:
+{
+  801b33:	55                   	push   %ebp
+  801b34:	89 e5                	mov    %esp,%ebp
+  801b36:	57                   	push   %edi
+  801b37:	56                   	push   %esi
+  801b38:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801b39:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b40:	78 30                	js     801b72 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  801b42:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b49:	74 73                	je     801bbe <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801b4b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b4e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b51:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801b56:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b59:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801b5c:	8b 75 18             	mov    0x18(%ebp),%esi
+  801b5f:	55                   	push   %ebp
+  801b60:	68 69 1b 80 00       	push   $0x801b69
+  801b65:	89 e5                	mov    %esp,%ebp
+  801b67:	0f 34                	sysenter
+  801b69:	83 c4 04             	add    $0x4,%esp
+  801b6c:	5d                   	pop    %ebp
+}
+  801b6d:	5b                   	pop    %ebx
+  801b6e:	5e                   	pop    %esi
+  801b6f:	5f                   	pop    %edi
+  801b70:	5d                   	pop    %ebp
+  801b71:	c3                   	ret
+  801b72:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b77:	0f a2                	cpuid
+		return 0;
+  801b79:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b7e:	f6 c6 08             	test   $0x8,%dh
+  801b81:	74 15                	je     801b98 <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b83:	89 c2                	mov    %eax,%edx
+  801b85:	c1 ea 08             	shr    $0x8,%edx
+  801b88:	83 e2 0f             	and    $0xf,%edx
+  801b8b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b90:	83 fa 06             	cmp    $0x6,%edx
+  801b93:	74 0e                	je     801ba3 <sys_ipc_send_range+0x70>
+  801b95:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b98:	0f b6 c9             	movzbl %cl,%ecx
+  801b9b:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801ba1:	eb 9f                	jmp    801b42 <sys_ipc_send_range+0xf>
+  801ba3:	89 c2                	mov    %eax,%edx
+  801ba5:	c1 ea 04             	shr    $0x4,%edx
+  801ba8:	83 e2 0f             	and    $0xf,%edx
+  801bab:	83 fa 02             	cmp    $0x2,%edx
+  801bae:	77 e5                	ja     801b95 <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  801bb0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bb3:	83 f8 02             	cmp    $0x2,%eax
+  801bb6:	0f 97 c1             	seta   %cl
+  801bb9:	0f b6 c9             	movzbl %cl,%ecx
+  801bbc:	eb d7                	jmp    801b95 <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  801bbe:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801bc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bc6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bc9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801bcc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801bcf:	8b 75 18             	mov    0x18(%ebp),%esi
+  801bd2:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  801bd4:	eb 97                	jmp    801b6d <sys_ipc_send_range+0x3a>
+
+00801bd6 <sys_ipc_recv_range>:
+{
+  801bd6:	55                   	push   %ebp
+  801bd7:	89 e5                	mov    %esp,%ebp
+  801bd9:	57                   	push   %edi
+  801bda:	56                   	push   %esi
+  801bdb:	53                   	push   %ebx
+  801bdc:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801bdf:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801be6:	78 37                	js     801c1f <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  801be8:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801bef:	74 7a                	je     801c6b <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  801bf1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bf6:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bf9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bfc:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801c01:	89 df                	mov    %ebx,%edi
+  801c03:	89 de                	mov    %ebx,%esi
+  801c05:	55                   	push   %ebp
+  801c06:	68 0f 1c 80 00       	push   $0x801c0f
+  801c0b:	89 e5                	mov    %esp,%ebp
+  801c0d:	0f 34                	sysenter
+  801c0f:	83 c4 04             	add    $0x4,%esp
+  801c12:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801c13:	85 c0                	test   %eax,%eax
+  801c15:	7f 6c                	jg     801c83 <sys_ipc_recv_range+0xad>
+}
+  801c17:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c1a:	5b                   	pop    %ebx
+  801c1b:	5e                   	pop    %esi
+  801c1c:	5f                   	pop    %edi
+  801c1d:	5d                   	pop    %ebp
+  801c1e:	c3                   	ret
+  801c1f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c24:	0f a2                	cpuid
+		return 0;
+  801c26:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801c2b:	f6 c6 08             	test   $0x8,%dh
+  801c2e:	74 15                	je     801c45 <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c30:	89 c2                	mov    %eax,%edx
+  801c32:	c1 ea 08             	shr    $0x8,%edx
+  801c35:	83 e2 0f             	and    $0xf,%edx
+  801c38:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801c3d:	83 fa 06             	cmp    $0x6,%edx
+  801c40:	74 0e                	je     801c50 <sys_ipc_recv_range+0x7a>
+  801c42:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801c45:	0f b6 c9             	movzbl %cl,%ecx
+  801c48:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801c4e:	eb 98                	jmp    801be8 <sys_ipc_recv_range+0x12>
+  801c50:	89 c2                	mov    %eax,%edx
+  801c52:	c1 ea 04             	shr    $0x4,%edx
+  801c55:	83 e2 0f             	and    $0xf,%edx
+  801c58:	83 fa 02             	cmp    $0x2,%edx
+  801c5b:	77 e5                	ja     801c42 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801c5d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c60:	83 f8 02             	cmp    $0x2,%eax
+  801c63:	0f 97 c1             	seta   %cl
+  801c66:	0f b6 c9             	movzbl %cl,%ecx
+  801c69:	eb d7                	jmp    801c42 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801c6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c70:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801c75:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c78:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c7b:	89 df                	mov    %ebx,%edi
+  801c7d:	89 de                	mov    %ebx,%esi
+  801c7f:	cd 30                	int    $0x30
+  801c81:	eb 90                	jmp    801c13 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801c83:	83 ec 0c             	sub    $0xc,%esp
+  801c86:	50                   	push   %eax
+  801c87:	6a 1f                	push   $0x1f
+  801c89:	68 19 34 80 00       	push   $0x803419
+  801c8e:	6a 4a                	push   $0x4a
+  801c90:	68 36 34 80 00       	push   $0x803436
+  801c95:	e8 cf e5 ff ff       	call   800269 <_panic>
+
+00801c9a <sys_ipc_call>:
+{
+  801c9a:	55                   	push   %ebp
+  801c9b:	89 e5                	mov    %esp,%ebp
+  801c9d:	57                   	push   %edi
+  801c9e:	56                   	push   %esi
+  801c9f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801ca0:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ca3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801ca8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801cab:	55                   	push   %ebp
+  801cac:	56                   	push   %esi
+  801cad:	8b 0e                	mov    (%esi),%ecx
+  801caf:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801cb2:	8b 7e 08             	mov    0x8(%esi),%edi
+  801cb5:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801cb8:	8b 76 0c             	mov    0xc(%esi),%esi
+  801cbb:	cd 30                	int    $0x30
+  801cbd:	87 34 24             	xchg   %esi,(%esp)
+  801cc0:	89 0e                	mov    %ecx,(%esi)
+  801cc2:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801cc5:	89 7e 08             	mov    %edi,0x8(%esi)
+  801cc8:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801ccb:	8f 46 0c             	pop    0xc(%esi)
+  801cce:	5d                   	pop    %ebp
+}
+  801ccf:	5b                   	pop    %ebx
+  801cd0:	5e                   	pop    %esi
+  801cd1:	5f                   	pop    %edi
+  801cd2:	5d                   	pop    %ebp
+  801cd3:	c3                   	ret
+
+00801cd4 <sys_ipc_reply_wait>:
+{
+  801cd4:	55                   	push   %ebp
+  801cd5:	89 e5                	mov    %esp,%ebp
+  801cd7:	57                   	push   %edi
+  801cd8:	56                   	push   %esi
+  801cd9:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801cda:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cdd:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801ce2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801ce5:	55                   	push   %ebp
+  801ce6:	56                   	push   %esi
+  801ce7:	8b 0e                	mov    (%esi),%ecx
+  801ce9:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801cec:	8b 7e 08             	mov    0x8(%esi),%edi
+  801cef:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801cf2:	8b 76 0c             	mov    0xc(%esi),%esi
+  801cf5:	cd 30                	int    $0x30
+  801cf7:	87 34 24             	xchg   %esi,(%esp)
+  801cfa:	89 0e                	mov    %ecx,(%esi)
+  801cfc:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801cff:	89 7e 08             	mov    %edi,0x8(%esi)
+  801d02:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801d05:	8f 46 0c             	pop    0xc(%esi)
+  801d08:	5d                   	pop    %ebp
+}
+  801d09:	5b                   	pop    %ebx
+  801d0a:	5e                   	pop    %esi
+  801d0b:	5f                   	pop    %edi
+  801d0c:	5d                   	pop    %ebp
+  801d0d:	c3                   	ret
+
+00801d0e <sys_ipc_send_msg>:
+{
+  801d0e:	55                   	push   %ebp
+  801d0f:	89 e5                	mov    %esp,%ebp
+  801d11:	57                   	push   %edi
+  801d12:	56                   	push   %esi
+  801d13:	53                   	push   %ebx
+  801d14:	83 ec 20             	sub    $0x20,%esp
+  801d17:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801d1a:	8b 10                	mov    (%eax),%edx
+  801d1c:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801d1f:	8b 50 04             	mov    0x4(%eax),%edx
+  801d22:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801d25:	8b 50 08             	mov    0x8(%eax),%edx
+  801d28:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801d2b:	8b 50 0c             	mov    0xc(%eax),%edx
+  801d2e:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801d31:	8b 40 10             	mov    0x10(%eax),%eax
+  801d34:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801d37:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801d3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d3d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801d42:	55                   	push   %ebp
+  801d43:	56                   	push   %esi
+  801d44:	8b 0e                	mov    (%esi),%ecx
+  801d46:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801d49:	8b 7e 08             	mov    0x8(%esi),%edi
+  801d4c:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801d4f:	8b 76 0c             	mov    0xc(%esi),%esi
+  801d52:	cd 30                	int    $0x30
+  801d54:	87 34 24             	xchg   %esi,(%esp)
+  801d57:	89 0e                	mov    %ecx,(%esi)
+  801d59:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801d5c:	89 7e 08             	mov    %edi,0x8(%esi)
+  801d5f:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801d62:	8f 46 0c             	pop    0xc(%esi)
+  801d65:	5d                   	pop    %ebp
+}
+  801d66:	83 c4 20             	add    $0x20,%esp
+  801d69:	5b                   	pop    %ebx
+  801d6a:	5e                   	pop    %esi
+  801d6b:	5f                   	pop    %edi
+  801d6c:	5d                   	pop    %ebp
+  801d6d:	c3                   	ret
+
+00801d6e <sys_fork>:
+{
+  801d6e:	55                   	push   %ebp
+  801d6f:	89 e5                	mov    %esp,%ebp
+  801d71:	57                   	push   %edi
+  801d72:	56                   	push   %esi
+  801d73:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801d74:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801d7b:	78 2e                	js     801dab <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801d7d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801d84:	74 71                	je     801df7 <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801d86:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d8b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801d90:	89 d1                	mov    %edx,%ecx
+  801d92:	89 d3                	mov    %edx,%ebx
+  801d94:	89 d7                	mov    %edx,%edi
+  801d96:	89 d6                	mov    %edx,%esi
+  801d98:	55                   	push   %ebp
+  801d99:	68 a2 1d 80 00       	push   $0x801da2
+  801d9e:	89 e5                	mov    %esp,%ebp
+  801da0:	0f 34                	sysenter
+  801da2:	83 c4 04             	add    $0x4,%esp
+  801da5:	5d                   	pop    %ebp
+}
+  801da6:	5b                   	pop    %ebx
+  801da7:	5e                   	pop    %esi
+  801da8:	5f                   	pop    %edi
+  801da9:	5d                   	pop    %ebp
+  801daa:	c3                   	ret
+  801dab:	b8 01 00 00 00       	mov    $0x1,%eax
+  801db0:	0f a2                	cpuid
+		return 0;
+  801db2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801db7:	f6 c6 08             	test   $0x8,%dh
+  801dba:	74 15                	je     801dd1 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801dbc:	89 c2                	mov    %eax,%edx
+  801dbe:	c1 ea 08             	shr    $0x8,%edx
+  801dc1:	83 e2 0f             	and    $0xf,%edx
+  801dc4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801dc9:	83 fa 06             	cmp    $0x6,%edx
+  801dcc:	74 0e                	je     801ddc <sys_fork+0x6e>
+  801dce:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801dd1:	0f b6 c9             	movzbl %cl,%ecx
+  801dd4:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801dda:	eb a1                	jmp    801d7d <sys_fork+0xf>
+  801ddc:	89 c2                	mov    %eax,%edx
+  801dde:	c1 ea 04             	shr    $0x4,%edx
+  801de1:	83 e2 0f             	and    $0xf,%edx
+  801de4:	83 fa 02             	cmp    $0x2,%edx
+  801de7:	77 e5                	ja     801dce <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801de9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801dec:	83 f8 02             	cmp    $0x2,%eax
+  801def:	0f 97 c1             	seta   %cl
+  801df2:	0f b6 c9             	movzbl %cl,%ecx
+  801df5:	eb d7                	jmp    801dce <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801df7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dfc:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801e01:	89 d1                	mov    %edx,%ecx
+  801e03:	89 d3                	mov    %edx,%ebx
+  801e05:	89 d7                	mov    %edx,%edi
+  801e07:	89 d6                	mov    %edx,%esi
+  801e09:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801e0b:	eb 99                	jmp    801da6 <sys_fork+0x38>
+
+00801e0d <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801e0d:	55                   	push   %ebp
+  801e0e:	89 e5                	mov    %esp,%ebp
+  801e10:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801e13:	ff 75 14             	push   0x14(%ebp)
+  801e16:	ff 75 10             	push   0x10(%ebp)
+  801e19:	ff 75 0c             	push   0xc(%ebp)
+  801e1c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e21:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e24:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801e29:	e8 81 ee ff ff       	call   800caf <page_vec_call>
+}
+  801e2e:	c9                   	leave
+  801e2f:	c3                   	ret
+
+00801e30 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801e30:	55                   	push   %ebp
+  801e31:	89 e5                	mov    %esp,%ebp
+  801e33:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801e36:	ff 75 18             	push   0x18(%ebp)
+  801e39:	ff 75 14             	push   0x14(%ebp)
+  801e3c:	ff 75 10             	push   0x10(%ebp)
+  801e3f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e42:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e45:	b8 10 00 00 00       	mov    $0x10,%eax
+  801e4a:	e8 60 ee ff ff       	call   800caf <page_vec_call>
+}
+  801e4f:	c9                   	leave
+  801e50:	c3                   	ret
+
+00801e51 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801e51:	55                   	push   %ebp
+  801e52:	89 e5                	mov    %esp,%ebp
+  801e54:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801e57:	ff 75 14             	push   0x14(%ebp)
+  801e5a:	ff 75 10             	push   0x10(%ebp)
+  801e5d:	ff 75 0c             	push   0xc(%ebp)
+  801e60:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e65:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e68:	b8 11 00 00 00       	mov    $0x11,%eax
+  801e6d:	e8 3d ee ff ff       	call   800caf <page_vec_call>
+}
+  801e72:	c9                   	leave
+  801e73:	c3                   	ret
+
+00801e74 <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801e74:	55                   	push   %ebp
+  801e75:	89 e5                	mov    %esp,%ebp
+  801e77:	57                   	push   %edi
+  801e78:	56                   	push   %esi
+  801e79:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801e7a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e81:	78 32                	js     801eb5 <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801e83:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e8a:	74 75                	je     801f01 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801e8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e92:	b8 12 00 00 00       	mov    $0x12,%eax
+  801e97:	be 00 00 00 00       	mov    $0x0,%esi
+  801e9c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e9f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ea2:	55                   	push   %ebp
+  801ea3:	68 ac 1e 80 00       	push   $0x801eac
+  801ea8:	89 e5                	mov    %esp,%ebp
+  801eaa:	0f 34                	sysenter
+  801eac:	83 c4 04             	add    $0x4,%esp
+  801eaf:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801eb0:	5b                   	pop    %ebx
+  801eb1:	5e                   	pop    %esi
+  801eb2:	5f                   	pop    %edi
+  801eb3:	5d                   	pop    %ebp
+  801eb4:	c3                   	ret
+  801eb5:	b8 01 00 00 00       	mov    $0x1,%eax
+  801eba:	0f a2                	cpuid
+		return 0;
+  801ebc:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801ec1:	f6 c6 08             	test   $0x8,%dh
+  801ec4:	74 15                	je     801edb <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ec6:	89 c2                	mov    %eax,%edx
+  801ec8:	c1 ea 08             	shr    $0x8,%edx
+  801ecb:	83 e2 0f             	and    $0xf,%edx
+  801ece:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ed3:	83 fa 06             	cmp    $0x6,%edx
+  801ed6:	74 0e                	je     801ee6 <sys_vm_ranges+0x72>
+  801ed8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801edb:	0f b6 c9             	movzbl %cl,%ecx
+  801ede:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801ee4:	eb 9d                	jmp    801e83 <sys_vm_ranges+0xf>
+  801ee6:	89 c2                	mov    %eax,%edx
+  801ee8:	c1 ea 04             	shr    $0x4,%edx
+  801eeb:	83 e2 0f             	and    $0xf,%edx
+  801eee:	83 fa 02             	cmp    $0x2,%edx
+  801ef1:	77 e5                	ja     801ed8 <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  801ef3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ef6:	83 f8 02             	cmp    $0x2,%eax
+  801ef9:	0f 97 c1             	seta   %cl
+  801efc:	0f b6 c9             	movzbl %cl,%ecx
+  801eff:	eb d7                	jmp    801ed8 <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801f01:	b8 12 00 00 00       	mov    $0x12,%eax
+  801f06:	be 00 00 00 00       	mov    $0x0,%esi
+  801f0b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f0e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f11:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f14:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801f17:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801f19:	eb 95                	jmp    801eb0 <sys_vm_ranges+0x3c>
+
+00801f1b <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801f1b:	55                   	push   %ebp
+  801f1c:	89 e5                	mov    %esp,%ebp
+  801f1e:	57                   	push   %edi
+  801f1f:	56                   	push   %esi
+  801f20:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801f21:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f28:	78 31                	js     801f5b <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801f2a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f31:	74 74                	je     801fa7 <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801f33:	be 00 00 00 00       	mov    $0x0,%esi
+  801f38:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f3b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f3e:	b8 14 00 00 00       	mov    $0x14,%eax
+  801f43:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f46:	89 f7                	mov    %esi,%edi
+  801f48:	55                   	push   %ebp
+  801f49:	68 52 1f 80 00       	push   $0x801f52
+  801f4e:	89 e5                	mov    %esp,%ebp
+  801f50:	0f 34                	sysenter
+  801f52:	83 c4 04             	add    $0x4,%esp
+  801f55:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801f56:	5b                   	pop    %ebx
+  801f57:	5e                   	pop    %esi
+  801f58:	5f                   	pop    %edi
+  801f59:	5d                   	pop    %ebp
+  801f5a:	c3                   	ret
+  801f5b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f60:	0f a2                	cpuid
+		return 0;
+  801f62:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801f67:	f6 c6 08             	test   $0x8,%dh
+  801f6a:	74 15                	je     801f81 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f6c:	89 c2                	mov    %eax,%edx
+  801f6e:	c1 ea 08             	shr    $0x8,%edx
+  801f71:	83 e2 0f             	and    $0xf,%edx
+  801f74:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f79:	83 fa 06             	cmp    $0x6,%edx
+  801f7c:	74 0e                	je     801f8c <sys_spawn+0x71>
+  801f7e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801f81:	0f b6 c9             	movzbl %cl,%ecx
+  801f84:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801f8a:	eb 9e                	jmp    801f2a <sys_spawn+0xf>
+  801f8c:	89 c2                	mov    %eax,%edx
+  801f8e:	c1 ea 04             	shr    $0x4,%edx
+  801f91:	83 e2 0f             	and    $0xf,%edx
+  801f94:	83 fa 02             	cmp    $0x2,%edx
+  801f97:	77 e5                	ja     801f7e <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  801f99:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f9c:	83 f8 02             	cmp    $0x2,%eax
+  801f9f:	0f 97 c1             	seta   %cl
+  801fa2:	0f b6 c9             	movzbl %cl,%ecx
+  801fa5:	eb d7                	jmp    801f7e <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  801fa7:	be 00 00 00 00       	mov    $0x0,%esi
+  801fac:	b8 14 00 00 00       	mov    $0x14,%eax
+  801fb1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fb4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fb7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801fba:	89 f7                	mov    %esi,%edi
+  801fbc:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  801fbe:	eb 96                	jmp    801f56 <sys_spawn+0x3b>
+
+00801fc0 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  801fc0:	55                   	push   %ebp
+  801fc1:	89 e5                	mov    %esp,%ebp
+  801fc3:	57                   	push   %edi
+  801fc4:	56                   	push   %esi
+  801fc5:	53                   	push   %ebx
+  801fc6:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801fc9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801fd0:	78 37                	js     802009 <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  801fd2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801fd9:	74 7a                	je     802055 <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  801fdb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fe0:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fe3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fe6:	b8 15 00 00 00       	mov    $0x15,%eax
+  801feb:	89 df                	mov    %ebx,%edi
+  801fed:	89 de                	mov    %ebx,%esi
+  801fef:	55                   	push   %ebp
+  801ff0:	68 f9 1f 80 00       	push   $0x801ff9
+  801ff5:	89 e5                	mov    %esp,%ebp
+  801ff7:	0f 34                	sysenter
+  801ff9:	83 c4 04             	add    $0x4,%esp
+  801ffc:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801ffd:	85 c0                	test   %eax,%eax
+  801fff:	7f 6c                	jg     80206d <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  802001:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802004:	5b                   	pop    %ebx
+  802005:	5e                   	pop    %esi
+  802006:	5f                   	pop    %edi
+  802007:	5d                   	pop    %ebp
+  802008:	c3                   	ret
+  802009:	b8 01 00 00 00       	mov    $0x1,%eax
+  80200e:	0f a2                	cpuid
+		return 0;
+  802010:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802015:	f6 c6 08             	test   $0x8,%dh
+  802018:	74 15                	je     80202f <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80201a:	89 c2                	mov    %eax,%edx
+  80201c:	c1 ea 08             	shr    $0x8,%edx
+  80201f:	83 e2 0f             	and    $0xf,%edx
+  802022:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802027:	83 fa 06             	cmp    $0x6,%edx
+  80202a:	74 0e                	je     80203a <sys_shm_create+0x7a>
+  80202c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80202f:	0f b6 c9             	movzbl %cl,%ecx
+  802032:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802038:	eb 98                	jmp    801fd2 <sys_shm_create+0x12>
+  80203a:	89 c2                	mov    %eax,%edx
+  80203c:	c1 ea 04             	shr    $0x4,%edx
+  80203f:	83 e2 0f             	and    $0xf,%edx
+  802042:	83 fa 02             	cmp    $0x2,%edx
+  802045:	77 e5                	ja     80202c <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  802047:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80204a:	83 f8 02             	cmp    $0x2,%eax
+  80204d:	0f 97 c1             	seta   %cl
+  802050:	0f b6 c9             	movzbl %cl,%ecx
+  802053:	eb d7                	jmp    80202c <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  802055:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80205a:	b8 15 00 00 00       	mov    $0x15,%eax
+  80205f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802062:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802065:	89 df                	mov    %ebx,%edi
+  802067:	89 de                	mov    %ebx,%esi
+  802069:	cd 30                	int    $0x30
+  80206b:	eb 90                	jmp    801ffd <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80206d:	83 ec 0c             	sub    $0xc,%esp
+  802070:	50                   	push   %eax
+  802071:	6a 15                	push   $0x15
+  802073:	68 19 34 80 00       	push   $0x803419
+  802078:	6a 4a                	push   $0x4a
+  80207a:	68 36 34 80 00       	push   $0x803436
+  80207f:	e8 e5 e1 ff ff       	call   800269 <_panic>
+
+00802084 <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  802084:	55                   	push   %ebp
+  802085:	89 e5                	mov    %esp,%ebp
+  802087:	57                   	push   %edi
+  802088:	56                   	push   %esi
+  802089:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80208a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802091:	78 32                	js     8020c5 <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  802093:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80209a:	74 75                	je     802111 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  80209c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80209f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020a2:	b8 16 00 00 00       	mov    $0x16,%eax
+  8020a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8020ac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8020af:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8020b2:	55                   	push   %ebp
+  8020b3:	68 bc 20 80 00       	push   $0x8020bc
+  8020b8:	89 e5                	mov    %esp,%ebp
+  8020ba:	0f 34                	sysenter
+  8020bc:	83 c4 04             	add    $0x4,%esp
+  8020bf:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  8020c0:	5b                   	pop    %ebx
+  8020c1:	5e                   	pop    %esi
+  8020c2:	5f                   	pop    %edi
+  8020c3:	5d                   	pop    %ebp
+  8020c4:	c3                   	ret
+  8020c5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020ca:	0f a2                	cpuid
+		return 0;
+  8020cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8020d1:	f6 c6 08             	test   $0x8,%dh
+  8020d4:	74 15                	je     8020eb <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020d6:	89 c2                	mov    %eax,%edx
+  8020d8:	c1 ea 08             	shr    $0x8,%edx
+  8020db:	83 e2 0f             	and    $0xf,%edx
+  8020de:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8020e3:	83 fa 06             	cmp    $0x6,%edx
+  8020e6:	74 0e                	je     8020f6 <sys_shm_attach+0x72>
+  8020e8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8020eb:	0f b6 c9             	movzbl %cl,%ecx
+  8020ee:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8020f4:	eb 9d                	jmp    802093 <sys_shm_attach+0xf>
+  8020f6:	89 c2                	mov    %eax,%edx
+  8020f8:	c1 ea 04             	shr    $0x4,%edx
+  8020fb:	83 e2 0f             	and    $0xf,%edx
+  8020fe:	83 fa 02             	cmp    $0x2,%edx
+  802101:	77 e5                	ja     8020e8 <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  802103:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802106:	83 f8 02             	cmp    $0x2,%eax
+  802109:	0f 97 c1             	seta   %cl
+  80210c:	0f b6 c9             	movzbl %cl,%ecx
+  80210f:	eb d7                	jmp    8020e8 <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  802111:	b8 16 00 00 00       	mov    $0x16,%eax
+  802116:	be 00 00 00 00       	mov    $0x0,%esi
+  80211b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80211e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802121:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802124:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802127:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  802129:	eb 95                	jmp    8020c0 <sys_shm_attach+0x3c>
+
+0080212b <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  80212b:	55                   	push   %ebp
+  80212c:	89 e5                	mov    %esp,%ebp
+  80212e:	57                   	push   %edi
+  80212f:	56                   	push   %esi
+  802130:	53                   	push   %ebx
+  802131:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802134:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80213b:	78 38                	js     802175 <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  80213d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802144:	74 7b                	je     8021c1 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  802146:	be 00 00 00 00       	mov    $0x0,%esi
+  80214b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80214e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802151:	b8 17 00 00 00       	mov    $0x17,%eax
+  802156:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802159:	89 f7                	mov    %esi,%edi
+  80215b:	55                   	push   %ebp
+  80215c:	68 65 21 80 00       	push   $0x802165
+  802161:	89 e5                	mov    %esp,%ebp
+  802163:	0f 34                	sysenter
+  802165:	83 c4 04             	add    $0x4,%esp
+  802168:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802169:	85 c0                	test   %eax,%eax
+  80216b:	7f 6d                	jg     8021da <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  80216d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802170:	5b                   	pop    %ebx
+  802171:	5e                   	pop    %esi
+  802172:	5f                   	pop    %edi
+  802173:	5d                   	pop    %ebp
+  802174:	c3                   	ret
+  802175:	b8 01 00 00 00       	mov    $0x1,%eax
+  80217a:	0f a2                	cpuid
+		return 0;
+  80217c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802181:	f6 c6 08             	test   $0x8,%dh
+  802184:	74 15                	je     80219b <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802186:	89 c2                	mov    %eax,%edx
+  802188:	c1 ea 08             	shr    $0x8,%edx
+  80218b:	83 e2 0f             	and    $0xf,%edx
+  80218e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802193:	83 fa 06             	cmp    $0x6,%edx
+  802196:	74 0e                	je     8021a6 <sys_shm_detach+0x7b>
+  802198:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80219b:	0f b6 c9             	movzbl %cl,%ecx
+  80219e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8021a4:	eb 97                	jmp    80213d <sys_shm_detach+0x12>
+  8021a6:	89 c2                	mov    %eax,%edx
+  8021a8:	c1 ea 04             	shr    $0x4,%edx
+  8021ab:	83 e2 0f             	and    $0xf,%edx
+  8021ae:	83 fa 02             	cmp    $0x2,%edx
+  8021b1:	77 e5                	ja     802198 <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  8021b3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021b6:	83 f8 02             	cmp    $0x2,%eax
+  8021b9:	0f 97 c1             	seta   %cl
+  8021bc:	0f b6 c9             	movzbl %cl,%ecx
+  8021bf:	eb d7                	jmp    802198 <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  8021c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8021c6:	b8 17 00 00 00       	mov    $0x17,%eax
+  8021cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8021d4:	89 f7                	mov    %esi,%edi
+  8021d6:	cd 30                	int    $0x30
+  8021d8:	eb 8f                	jmp    802169 <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8021da:	83 ec 0c             	sub    $0xc,%esp
+  8021dd:	50                   	push   %eax
+  8021de:	6a 17                	push   $0x17
+  8021e0:	68 19 34 80 00       	push   $0x803419
+  8021e5:	6a 4a                	push   $0x4a
+  8021e7:	68 36 34 80 00       	push   $0x803436
+  8021ec:	e8 78 e0 ff ff       	call   800269 <_panic>
+
+008021f1 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  8021f1:	55                   	push   %ebp
+  8021f2:	89 e5                	mov    %esp,%ebp
+  8021f4:	57                   	push   %edi
+  8021f5:	56                   	push   %esi
+  8021f6:	53                   	push   %ebx
+  8021f7:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8021fa:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802201:	78 36                	js     802239 <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  802203:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80220a:	74 79                	je     802285 <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  80220c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80220f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802214:	b8 18 00 00 00       	mov    $0x18,%eax
+  802219:	89 cb                	mov    %ecx,%ebx
+  80221b:	89 cf                	mov    %ecx,%edi
+  80221d:	89 ce                	mov    %ecx,%esi
+  80221f:	55                   	push   %ebp
+  802220:	68 29 22 80 00       	push   $0x802229
+  802225:	89 e5                	mov    %esp,%ebp
+  802227:	0f 34                	sysenter
+  802229:	83 c4 04             	add    $0x4,%esp
+  80222c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80222d:	85 c0                	test   %eax,%eax
+  80222f:	7f 6b                	jg     80229c <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  802231:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802234:	5b                   	pop    %ebx
+  802235:	5e                   	pop    %esi
+  802236:	5f                   	pop    %edi
+  802237:	5d                   	pop    %ebp
+  802238:	c3                   	ret
+  802239:	b8 01 00 00 00       	mov    $0x1,%eax
+  80223e:	0f a2                	cpuid
+		return 0;
+  802240:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802245:	f6 c6 08             	test   $0x8,%dh
+  802248:	74 15                	je     80225f <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80224a:	89 c2                	mov    %eax,%edx
+  80224c:	c1 ea 08             	shr    $0x8,%edx
+  80224f:	83 e2 0f             	and    $0xf,%edx
+  802252:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802257:	83 fa 06             	cmp    $0x6,%edx
+  80225a:	74 0e                	je     80226a <sys_shm_remove+0x79>
+  80225c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80225f:	0f b6 c9             	movzbl %cl,%ecx
+  802262:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802268:	eb 99                	jmp    802203 <sys_shm_remove+0x12>
+  80226a:	89 c2                	mov    %eax,%edx
+  80226c:	c1 ea 04             	shr    $0x4,%edx
+  80226f:	83 e2 0f             	and    $0xf,%edx
+  802272:	83 fa 02             	cmp    $0x2,%edx
+  802275:	77 e5                	ja     80225c <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  802277:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80227a:	83 f8 02             	cmp    $0x2,%eax
+  80227d:	0f 97 c1             	seta   %cl
+  802280:	0f b6 c9             	movzbl %cl,%ecx
+  802283:	eb d7                	jmp    80225c <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  802285:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80228a:	b8 18 00 00 00       	mov    $0x18,%eax
+  80228f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802292:	89 cb                	mov    %ecx,%ebx
+  802294:	89 cf                	mov    %ecx,%edi
+  802296:	89 ce                	mov    %ecx,%esi
+  802298:	cd 30                	int    $0x30
+  80229a:	eb 91                	jmp    80222d <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80229c:	83 ec 0c             	sub    $0xc,%esp
+  80229f:	50                   	push   %eax
+  8022a0:	6a 18                	push   $0x18
+  8022a2:	68 19 34 80 00       	push   $0x803419
+  8022a7:	6a 4a                	push   $0x4a
+  8022a9:	68 36 34 80 00       	push   $0x803436
+  8022ae:	e8 b6 df ff ff       	call   800269 <_panic>
+
+008022b3 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  8022b3:	55                   	push   %ebp
+  8022b4:	89 e5                	mov    %esp,%ebp
+  8022b6:	57                   	push   %edi
+  8022b7:	56                   	push   %esi
+  8022b8:	53                   	push   %ebx
+  8022b9:	83 ec 0c             	sub    $0xc,%esp
+  8022bc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8022bf:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8022c2:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  8022c5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8022cc:	78 32                	js     802300 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  8022ce:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8022d5:	74 75                	je     80234c <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  8022d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022dd:	b8 20 00 00 00       	mov    $0x20,%eax
+  8022e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8022e7:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8022ea:	55                   	push   %ebp
+  8022eb:	68 f4 22 80 00       	push   $0x8022f4
+  8022f0:	89 e5                	mov    %esp,%ebp
+  8022f2:	0f 34                	sysenter
+  8022f4:	83 c4 04             	add    $0x4,%esp
+  8022f7:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  8022f8:	83 c4 0c             	add    $0xc,%esp
+  8022fb:	5b                   	pop    %ebx
+  8022fc:	5e                   	pop    %esi
+  8022fd:	5f                   	pop    %edi
+  8022fe:	5d                   	pop    %ebp
+  8022ff:	c3                   	ret
+  802300:	b8 01 00 00 00       	mov    $0x1,%eax
+  802305:	0f a2                	cpuid
+		return 0;
+  802307:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80230c:	f6 c6 08             	test   $0x8,%dh
+  80230f:	74 15                	je     802326 <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802311:	89 c2                	mov    %eax,%edx
+  802313:	c1 ea 08             	shr    $0x8,%edx
+  802316:	83 e2 0f             	and    $0xf,%edx
+  802319:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80231e:	83 fa 06             	cmp    $0x6,%edx
+  802321:	74 0e                	je     802331 <sys_futex_wait+0x7e>
+  802323:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802326:	0f b6 c9             	movzbl %cl,%ecx
+  802329:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80232f:	eb 9d                	jmp    8022ce <sys_futex_wait+0x1b>
+  802331:	89 c2                	mov    %eax,%edx
+  802333:	c1 ea 04             	shr    $0x4,%edx
+  802336:	83 e2 0f             	and    $0xf,%edx
+  802339:	83 fa 02             	cmp    $0x2,%edx
+  80233c:	77 e5                	ja     802323 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  80233e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802341:	83 f8 02             	cmp    $0x2,%eax
+  802344:	0f 97 c1             	seta   %cl
+  802347:	0f b6 c9             	movzbl %cl,%ecx
+  80234a:	eb d7                	jmp    802323 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  80234c:	b8 20 00 00 00       	mov    $0x20,%eax
+  802351:	be 00 00 00 00       	mov    $0x0,%esi
+  802356:	8b 55 08             	mov    0x8(%ebp),%edx
+  802359:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80235c:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  80235f:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  802361:	eb 95                	jmp    8022f8 <sys_futex_wait+0x45>
+
+00802363 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  802363:	55                   	push   %ebp
+  802364:	89 e5                	mov    %esp,%ebp
+  802366:	57                   	push   %edi
+  802367:	56                   	push   %esi
+  802368:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802369:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802370:	78 30                	js     8023a2 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  802372:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802379:	74 73                	je     8023ee <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  80237b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802380:	8b 55 08             	mov    0x8(%ebp),%edx
+  802383:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802386:	b8 21 00 00 00       	mov    $0x21,%eax
+  80238b:	89 df                	mov    %ebx,%edi
+  80238d:	89 de                	mov    %ebx,%esi
+  80238f:	55                   	push   %ebp
+  802390:	68 99 23 80 00       	push   $0x802399
+  802395:	89 e5                	mov    %esp,%ebp
+  802397:	0f 34                	sysenter
+  802399:	83 c4 04             	add    $0x4,%esp
+  80239c:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80239d:	5b                   	pop    %ebx
+  80239e:	5e                   	pop    %esi
+  80239f:	5f                   	pop    %edi
+  8023a0:	5d                   	pop    %ebp
+  8023a1:	c3                   	ret
+  8023a2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023a7:	0f a2                	cpuid
+		return 0;
+  8023a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8023ae:	f6 c6 08             	test   $0x8,%dh
+  8023b1:	74 15                	je     8023c8 <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023b3:	89 c2                	mov    %eax,%edx
+  8023b5:	c1 ea 08             	shr    $0x8,%edx
+  8023b8:	83 e2 0f             	and    $0xf,%edx
+  8023bb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8023c0:	83 fa 06             	cmp    $0x6,%edx
+  8023c3:	74 0e                	je     8023d3 <sys_futex_wake+0x70>
+  8023c5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8023c8:	0f b6 c9             	movzbl %cl,%ecx
+  8023cb:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8023d1:	eb 9f                	jmp    802372 <sys_futex_wake+0xf>
+  8023d3:	89 c2                	mov    %eax,%edx
+  8023d5:	c1 ea 04             	shr    $0x4,%edx
+  8023d8:	83 e2 0f             	and    $0xf,%edx
+  8023db:	83 fa 02             	cmp    $0x2,%edx
+  8023de:	77 e5                	ja     8023c5 <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  8023e0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023e3:	83 f8 02             	cmp    $0x2,%eax
+  8023e6:	0f 97 c1             	seta   %cl
+  8023e9:	0f b6 c9             	movzbl %cl,%ecx
+  8023ec:	eb d7                	jmp    8023c5 <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  8023ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023f3:	b8 21 00 00 00       	mov    $0x21,%eax
+  8023f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023fe:	89 df                	mov    %ebx,%edi
+  802400:	89 de                	mov    %ebx,%esi
+  802402:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  802404:	eb 97                	jmp    80239d <sys_futex_wake+0x3a>
+
+00802406 <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  802406:	55                   	push   %ebp
+  802407:	89 e5                	mov    %esp,%ebp
+  802409:	57                   	push   %edi
+  80240a:	56                   	push   %esi
+  80240b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80240c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802413:	78 2e                	js     802443 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  802415:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80241c:	74 71                	je     80248f <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  80241e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802423:	b8 22 00 00 00       	mov    $0x22,%eax
+  802428:	89 d1                	mov    %edx,%ecx
+  80242a:	89 d3                	mov    %edx,%ebx
+  80242c:	89 d7                	mov    %edx,%edi
+  80242e:	89 d6                	mov    %edx,%esi
+  802430:	55                   	push   %ebp
+  802431:	68 3a 24 80 00       	push   $0x80243a
+  802436:	89 e5                	mov    %esp,%ebp
+  802438:	0f 34                	sysenter
+  80243a:	83 c4 04             	add    $0x4,%esp
+  80243d:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  80243e:	5b                   	pop    %ebx
+  80243f:	5e                   	pop    %esi
+  802440:	5f                   	pop    %edi
+  802441:	5d                   	pop    %ebp
+  802442:	c3                   	ret
+  802443:	b8 01 00 00 00       	mov    $0x1,%eax
+  802448:	0f a2                	cpuid
+		return 0;
+  80244a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80244f:	f6 c6 08             	test   $0x8,%dh
+  802452:	74 15                	je     802469 <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802454:	89 c2                	mov    %eax,%edx
+  802456:	c1 ea 08             	shr    $0x8,%edx
+  802459:	83 e2 0f             	and    $0xf,%edx
+  80245c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802461:	83 fa 06             	cmp    $0x6,%edx
+  802464:	74 0e                	je     802474 <sys_ep_create+0x6e>
+  802466:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802469:	0f b6 c9             	movzbl %cl,%ecx
+  80246c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802472:	eb a1                	jmp    802415 <sys_ep_create+0xf>
+  802474:	89 c2                	mov    %eax,%edx
+  802476:	c1 ea 04             	shr    $0x4,%edx
+  802479:	83 e2 0f             	and    $0xf,%edx
+  80247c:	83 fa 02             	cmp    $0x2,%edx
+  80247f:	77 e5                	ja     802466 <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  802481:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802484:	83 f8 02             	cmp    $0x2,%eax
+  802487:	0f 97 c1             	seta   %cl
+  80248a:	0f b6 c9             	movzbl %cl,%ecx
+  80248d:	eb d7                	jmp    802466 <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  80248f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802494:	b8 22 00 00 00       	mov    $0x22,%eax
+  802499:	89 d1                	mov    %edx,%ecx
+  80249b:	89 d3                	mov    %edx,%ebx
+  80249d:	89 d7                	mov    %edx,%edi
+  80249f:	89 d6                	mov    %edx,%esi
+  8024a1:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  8024a3:	eb 99                	jmp    80243e <sys_ep_create+0x38>
+
+008024a5 <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  8024a5:	55                   	push   %ebp
+  8024a6:	89 e5                	mov    %esp,%ebp
+  8024a8:	57                   	push   %edi
+  8024a9:	56                   	push   %esi
+  8024aa:	53                   	push   %ebx
+  8024ab:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8024ae:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8024b5:	78 36                	js     8024ed <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  8024b7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8024be:	74 79                	je     802539 <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  8024c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024c8:	b8 23 00 00 00       	mov    $0x23,%eax
+  8024cd:	89 cb                	mov    %ecx,%ebx
+  8024cf:	89 cf                	mov    %ecx,%edi
+  8024d1:	89 ce                	mov    %ecx,%esi
+  8024d3:	55                   	push   %ebp
+  8024d4:	68 dd 24 80 00       	push   $0x8024dd
+  8024d9:	89 e5                	mov    %esp,%ebp
+  8024db:	0f 34                	sysenter
+  8024dd:	83 c4 04             	add    $0x4,%esp
+  8024e0:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8024e1:	85 c0                	test   %eax,%eax
+  8024e3:	7f 6b                	jg     802550 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  8024e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024e8:	5b                   	pop    %ebx
+  8024e9:	5e                   	pop    %esi
+  8024ea:	5f                   	pop    %edi
+  8024eb:	5d                   	pop    %ebp
+  8024ec:	c3                   	ret
+  8024ed:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024f2:	0f a2                	cpuid
+		return 0;
+  8024f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8024f9:	f6 c6 08             	test   $0x8,%dh
+  8024fc:	74 15                	je     802513 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8024fe:	89 c2                	mov    %eax,%edx
+  802500:	c1 ea 08             	shr    $0x8,%edx
+  802503:	83 e2 0f             	and    $0xf,%edx
+  802506:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80250b:	83 fa 06             	cmp    $0x6,%edx
+  80250e:	74 0e                	je     80251e <sys_ep_destroy+0x79>
+  802510:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802513:	0f b6 c9             	movzbl %cl,%ecx
+  802516:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80251c:	eb 99                	jmp    8024b7 <sys_ep_destroy+0x12>
+  80251e:	89 c2                	mov    %eax,%edx
+  802520:	c1 ea 04             	shr    $0x4,%edx
+  802523:	83 e2 0f             	and    $0xf,%edx
+  802526:	83 fa 02             	cmp    $0x2,%edx
+  802529:	77 e5                	ja     802510 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  80252b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80252e:	83 f8 02             	cmp    $0x2,%eax
+  802531:	0f 97 c1             	seta   %cl
+  802534:	0f b6 c9             	movzbl %cl,%ecx
+  802537:	eb d7                	jmp    802510 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  802539:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80253e:	b8 23 00 00 00       	mov    $0x23,%eax
+  802543:	8b 55 08             	mov    0x8(%ebp),%edx
+  802546:	89 cb                	mov    %ecx,%ebx
+  802548:	89 cf                	mov    %ecx,%edi
+  80254a:	89 ce                	mov    %ecx,%esi
+  80254c:	cd 30                	int    $0x30
+  80254e:	eb 91                	jmp    8024e1 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802550:	83 ec 0c             	sub    $0xc,%esp
+  802553:	50                   	push   %eax
+  802554:	6a 23                	push   $0x23
+  802556:	68 19 34 80 00       	push   $0x803419
+  80255b:	6a 4a                	push   $0x4a
+  80255d:	68 36 34 80 00       	push   $0x803436
+  802562:	e8 02 dd ff ff       	call   800269 <_panic>
+
+00802567 <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  802567:	55                   	push   %ebp
+  802568:	89 e5                	mov    %esp,%ebp
+  80256a:	57                   	push   %edi
+  80256b:	56                   	push   %esi
+  80256c:	53                   	push   %ebx
+  80256d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802570:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802577:	78 37                	js     8025b0 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  802579:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802580:	74 7a                	je     8025fc <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  802582:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802587:	8b 55 08             	mov    0x8(%ebp),%edx
+  80258a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80258d:	b8 24 00 00 00       	mov    $0x24,%eax
+  802592:	89 df                	mov    %ebx,%edi
+  802594:	89 de                	mov    %ebx,%esi
+  802596:	55                   	push   %ebp
+  802597:	68 a0 25 80 00       	push   $0x8025a0
+  80259c:	89 e5                	mov    %esp,%ebp
+  80259e:	0f 34                	sysenter
+  8025a0:	83 c4 04             	add    $0x4,%esp
+  8025a3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8025a4:	85 c0                	test   %eax,%eax
+  8025a6:	7f 6c                	jg     802614 <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  8025a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025ab:	5b                   	pop    %ebx
+  8025ac:	5e                   	pop    %esi
+  8025ad:	5f                   	pop    %edi
+  8025ae:	5d                   	pop    %ebp
+  8025af:	c3                   	ret
+  8025b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025b5:	0f a2                	cpuid
+		return 0;
+  8025b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8025bc:	f6 c6 08             	test   $0x8,%dh
+  8025bf:	74 15                	je     8025d6 <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025c1:	89 c2                	mov    %eax,%edx
+  8025c3:	c1 ea 08             	shr    $0x8,%edx
+  8025c6:	83 e2 0f             	and    $0xf,%edx
+  8025c9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8025ce:	83 fa 06             	cmp    $0x6,%edx
+  8025d1:	74 0e                	je     8025e1 <sys_ep_grant+0x7a>
+  8025d3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8025d6:	0f b6 c9             	movzbl %cl,%ecx
+  8025d9:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8025df:	eb 98                	jmp    802579 <sys_ep_grant+0x12>
+  8025e1:	89 c2                	mov    %eax,%edx
+  8025e3:	c1 ea 04             	shr    $0x4,%edx
+  8025e6:	83 e2 0f             	and    $0xf,%edx
+  8025e9:	83 fa 02             	cmp    $0x2,%edx
+  8025ec:	77 e5                	ja     8025d3 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  8025ee:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025f1:	83 f8 02             	cmp    $0x2,%eax
+  8025f4:	0f 97 c1             	seta   %cl
+  8025f7:	0f b6 c9             	movzbl %cl,%ecx
+  8025fa:	eb d7                	jmp    8025d3 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  8025fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802601:	b8 24 00 00 00       	mov    $0x24,%eax
+  802606:	8b 55 08             	mov    0x8(%ebp),%edx
+  802609:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80260c:	89 df                	mov    %ebx,%edi
+  80260e:	89 de                	mov    %ebx,%esi
+  802610:	cd 30                	int    $0x30
+  802612:	eb 90                	jmp    8025a4 <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802614:	83 ec 0c             	sub    $0xc,%esp
+  802617:	50                   	push   %eax
+  802618:	6a 24                	push   $0x24
+  80261a:	68 19 34 80 00       	push   $0x803419
+  80261f:	6a 4a                	push   $0x4a
+  802621:	68 36 34 80 00       	push   $0x803436
+  802626:	e8 3e dc ff ff       	call   800269 <_panic>
+
+0080262b <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  80262b:	55                   	push   %ebp
+  80262c:	89 e5                	mov    %esp,%ebp
+  80262e:	57                   	push   %edi
+  80262f:	56                   	push   %esi
+  802630:	53                   	push   %ebx
+  802631:	83 ec 20             	sub    $0x20,%esp
+  802634:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  802637:	8b 10                	mov    (%eax),%edx
+  802639:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  80263c:	8b 50 04             	mov    0x4(%eax),%edx
+  80263f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802642:	8b 50 08             	mov    0x8(%eax),%edx
+  802645:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  802648:	8b 50 0c             	mov    0xc(%eax),%edx
+  80264b:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  80264e:	8b 40 10             	mov    0x10(%eax),%eax
+  802651:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  802654:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  802657:	8b 55 08             	mov    0x8(%ebp),%edx
+  80265a:	b8 25 00 00 00       	mov    $0x25,%eax
+  80265f:	55                   	push   %ebp
+  802660:	56                   	push   %esi
+  802661:	8b 0e                	mov    (%esi),%ecx
+  802663:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802666:	8b 7e 08             	mov    0x8(%esi),%edi
+  802669:	8b 6e 10             	mov    0x10(%esi),%ebp
+  80266c:	8b 76 0c             	mov    0xc(%esi),%esi
+  80266f:	cd 30                	int    $0x30
+  802671:	87 34 24             	xchg   %esi,(%esp)
+  802674:	89 0e                	mov    %ecx,(%esi)
+  802676:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802679:	89 7e 08             	mov    %edi,0x8(%esi)
+  80267c:	89 6e 10             	mov    %ebp,0x10(%esi)
+  80267f:	8f 46 0c             	pop    0xc(%esi)
+  802682:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  802683:	83 c4 20             	add    $0x20,%esp
+  802686:	5b                   	pop    %ebx
+  802687:	5e                   	pop    %esi
+  802688:	5f                   	pop    %edi
+  802689:	5d                   	pop    %ebp
+  80268a:	c3                   	ret
+
+0080268b <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  80268b:	55                   	push   %ebp
+  80268c:	89 e5                	mov    %esp,%ebp
+  80268e:	57                   	push   %edi
+  80268f:	56                   	push   %esi
+  802690:	53                   	push   %ebx
+  802691:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  802694:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802697:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  802699:	8b 55 08             	mov    0x8(%ebp),%edx
+  80269c:	b8 26 00 00 00       	mov    $0x26,%eax
+  8026a1:	55                   	push   %ebp
+  8026a2:	56                   	push   %esi
+  8026a3:	8b 0e                	mov    (%esi),%ecx
+  8026a5:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8026a8:	8b 7e 08             	mov    0x8(%esi),%edi
+  8026ab:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8026ae:	8b 76 0c             	mov    0xc(%esi),%esi
+  8026b1:	cd 30                	int    $0x30
+  8026b3:	87 34 24             	xchg   %esi,(%esp)
+  8026b6:	89 0e                	mov    %ecx,(%esi)
+  8026b8:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8026bb:	89 7e 08             	mov    %edi,0x8(%esi)
+  8026be:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8026c1:	8f 46 0c             	pop    0xc(%esi)
+  8026c4:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  8026c5:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  8026c9:	74 0f                	je     8026da <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  8026cb:	85 c0                	test   %eax,%eax
+  8026cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026d2:	0f 48 d1             	cmovs  %ecx,%edx
+  8026d5:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8026d8:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  8026da:	5b                   	pop    %ebx
+  8026db:	5e                   	pop    %esi
+  8026dc:	5f                   	pop    %edi
+  8026dd:	5d                   	pop    %ebp
+  8026de:	c3                   	ret
+
+008026df <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  8026df:	55                   	push   %ebp
+  8026e0:	89 e5                	mov    %esp,%ebp
+  8026e2:	57                   	push   %edi
+  8026e3:	56                   	push   %esi
+  8026e4:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8026e5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8026ec:	78 2f                	js     80271d <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  8026ee:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8026f5:	74 72                	je     802769 <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  8026f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8026fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026ff:	b8 27 00 00 00       	mov    $0x27,%eax
+  802704:	89 cb                	mov    %ecx,%ebx
+  802706:	89 cf                	mov    %ecx,%edi
+  802708:	89 ce                	mov    %ecx,%esi
+  80270a:	55                   	push   %ebp
+  80270b:	68 14 27 80 00       	push   $0x802714
+  802710:	89 e5                	mov    %esp,%ebp
+  802712:	0f 34                	sysenter
+  802714:	83 c4 04             	add    $0x4,%esp
+  802717:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  802718:	5b                   	pop    %ebx
+  802719:	5e                   	pop    %esi
+  80271a:	5f                   	pop    %edi
+  80271b:	5d                   	pop    %ebp
+  80271c:	c3                   	ret
+  80271d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802722:	0f a2                	cpuid
+		return 0;
+  802724:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802729:	f6 c6 08             	test   $0x8,%dh
+  80272c:	74 15                	je     802743 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80272e:	89 c2                	mov    %eax,%edx
+  802730:	c1 ea 08             	shr    $0x8,%edx
+  802733:	83 e2 0f             	and    $0xf,%edx
+  802736:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80273b:	83 fa 06             	cmp    $0x6,%edx
+  80273e:	74 0e                	je     80274e <sys_sysring_setup+0x6f>
+  802740:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802743:	0f b6 c9             	movzbl %cl,%ecx
+  802746:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80274c:	eb a0                	jmp    8026ee <sys_sysring_setup+0xf>
+  80274e:	89 c2                	mov    %eax,%edx
+  802750:	c1 ea 04             	shr    $0x4,%edx
+  802753:	83 e2 0f             	and    $0xf,%edx
+  802756:	83 fa 02             	cmp    $0x2,%edx
+  802759:	77 e5                	ja     802740 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  80275b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80275e:	83 f8 02             	cmp    $0x2,%eax
+  802761:	0f 97 c1             	seta   %cl
+  802764:	0f b6 c9             	movzbl %cl,%ecx
+  802767:	eb d7                	jmp    802740 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  802769:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80276e:	b8 27 00 00 00       	mov    $0x27,%eax
+  802773:	8b 55 08             	mov    0x8(%ebp),%edx
+  802776:	89 cb                	mov    %ecx,%ebx
+  802778:	89 cf                	mov    %ecx,%edi
+  80277a:	89 ce                	mov    %ecx,%esi
+  80277c:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  80277e:	eb 98                	jmp    802718 <sys_sysring_setup+0x39>
+
+00802780 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  802780:	55                   	push   %ebp
+  802781:	89 e5                	mov    %esp,%ebp
+  802783:	57                   	push   %edi
+  802784:	56                   	push   %esi
+  802785:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802786:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80278d:	78 2e                	js     8027bd <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  80278f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802796:	74 71                	je     802809 <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  802798:	ba 00 00 00 00       	mov    $0x0,%edx
+  80279d:	b8 28 00 00 00       	mov    $0x28,%eax
+  8027a2:	89 d1                	mov    %edx,%ecx
+  8027a4:	89 d3                	mov    %edx,%ebx
+  8027a6:	89 d7                	mov    %edx,%edi
+  8027a8:	89 d6                	mov    %edx,%esi
+  8027aa:	55                   	push   %ebp
+  8027ab:	68 b4 27 80 00       	push   $0x8027b4
+  8027b0:	89 e5                	mov    %esp,%ebp
+  8027b2:	0f 34                	sysenter
+  8027b4:	83 c4 04             	add    $0x4,%esp
+  8027b7:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8027b8:	5b                   	pop    %ebx
+  8027b9:	5e                   	pop    %esi
+  8027ba:	5f                   	pop    %edi
+  8027bb:	5d                   	pop    %ebp
+  8027bc:	c3                   	ret
+  8027bd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8027c2:	0f a2                	cpuid
+		return 0;
+  8027c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8027c9:	f6 c6 08             	test   $0x8,%dh
+  8027cc:	74 15                	je     8027e3 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8027ce:	89 c2                	mov    %eax,%edx
+  8027d0:	c1 ea 08             	shr    $0x8,%edx
+  8027d3:	83 e2 0f             	and    $0xf,%edx
+  8027d6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8027db:	83 fa 06             	cmp    $0x6,%edx
+  8027de:	74 0e                	je     8027ee <sys_sysring_enter+0x6e>
+  8027e0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8027e3:	0f b6 c9             	movzbl %cl,%ecx
+  8027e6:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8027ec:	eb a1                	jmp    80278f <sys_sysring_enter+0xf>
+  8027ee:	89 c2                	mov    %eax,%edx
+  8027f0:	c1 ea 04             	shr    $0x4,%edx
+  8027f3:	83 e2 0f             	and    $0xf,%edx
+  8027f6:	83 fa 02             	cmp    $0x2,%edx
+  8027f9:	77 e5                	ja     8027e0 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  8027fb:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8027fe:	83 f8 02             	cmp    $0x2,%eax
+  802801:	0f 97 c1             	seta   %cl
+  802804:	0f b6 c9             	movzbl %cl,%ecx
+  802807:	eb d7                	jmp    8027e0 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  802809:	ba 00 00 00 00       	mov    $0x0,%edx
+  80280e:	b8 28 00 00 00       	mov    $0x28,%eax
+  802813:	89 d1                	mov    %edx,%ecx
+  802815:	89 d3                	mov    %edx,%ebx
+  802817:	89 d7                	mov    %edx,%edi
+  802819:	89 d6                	mov    %edx,%esi
+  80281b:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  80281d:	eb 99                	jmp    8027b8 <sys_sysring_enter+0x38>
+
+0080281f <pgfault>:
+// The kernel normally resolves these faults itself (page_fault_cow in
+// kern/trap.c); we only get here if it ran out of memory doing so.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  80281f:	55                   	push   %ebp
+  802820:	89 e5                	mov    %esp,%ebp
+  802822:	83 ec 08             	sub    $0x8,%esp
+  802825:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  802828:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  80282a:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  80282d:	f6 c2 02             	test   $0x2,%dl
+  802830:	74 40                	je     802872 <pgfault+0x53>
+  802832:	89 c1                	mov    %eax,%ecx
+  802834:	c1 e9 16             	shr    $0x16,%ecx
+  802837:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  80283e:	f6 c1 01             	test   $0x1,%cl
+  802841:	74 2f                	je     802872 <pgfault+0x53>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW))
+  802843:	89 c1                	mov    %eax,%ecx
+  802845:	c1 e9 0c             	shr    $0xc,%ecx
+  802848:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  80284f:	f6 c5 08             	test   $0x8,%ch
+  802852:	74 1e                	je     802872 <pgfault+0x53>
+	// Replace the page with a private writable copy of itself.  The
+	// kernel allocates, copies and maps it in one system call, so no
+	// temporary mapping at PFTEMP is needed.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  802854:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r = sys_page_copy(0, addr, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  802859:	83 ec 0c             	sub    $0xc,%esp
+  80285c:	6a 07                	push   $0x7
+  80285e:	50                   	push   %eax
+  80285f:	6a 00                	push   $0x0
+  802861:	50                   	push   %eax
+  802862:	6a 00                	push   $0x0
+  802864:	e8 85 eb ff ff       	call   8013ee <sys_page_copy>
+  802869:	83 c4 20             	add    $0x20,%esp
+  80286c:	85 c0                	test   %eax,%eax
+  80286e:	78 18                	js     802888 <pgfault+0x69>
+		panic("pgfault: sys_page_copy: %e", r);
+}
+  802870:	c9                   	leave
+  802871:	c3                   	ret
+		panic("pgfault: va %08x err %x is not a copy-on-write write",
+  802872:	83 ec 0c             	sub    $0xc,%esp
+  802875:	52                   	push   %edx
+  802876:	50                   	push   %eax
+  802877:	68 44 34 80 00       	push   $0x803444
+  80287c:	6a 1c                	push   $0x1c
+  80287e:	68 79 34 80 00       	push   $0x803479
+  802883:	e8 e1 d9 ff ff       	call   800269 <_panic>
+		panic("pgfault: sys_page_copy: %e", r);
+  802888:	50                   	push   %eax
+  802889:	68 84 34 80 00       	push   $0x803484
+  80288e:	6a 26                	push   $0x26
+  802890:	68 79 34 80 00       	push   $0x803479
+  802895:	e8 cf d9 ff ff       	call   800269 <_panic>
+
+0080289a <ufork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+ufork(void)
+{
+  80289a:	55                   	push   %ebp
+  80289b:	89 e5                	mov    %esp,%ebp
+  80289d:	57                   	push   %edi
+  80289e:	56                   	push   %esi
+  80289f:	53                   	push   %ebx
+  8028a0:	81 ec 38 04 00 00    	sub    $0x438,%esp
+	struct page_range vec[PAGE_VEC_MAX], *last;
+	uintptr_t va;
+	size_t n;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8028a6:	68 1f 28 80 00       	push   $0x80281f
+  8028ab:	e8 03 05 00 00       	call   802db3 <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8028b0:	b8 07 00 00 00       	mov    $0x7,%eax
+  8028b5:	cd 30                	int    $0x30
+  8028b7:	89 85 d4 fb ff ff    	mov    %eax,-0x42c(%ebp)
+
+	envid = sys_exofork();
+	if (envid < 0)
+  8028bd:	83 c4 10             	add    $0x10,%esp
+  8028c0:	85 c0                	test   %eax,%eax
+  8028c2:	0f 88 f2 01 00 00    	js     802aba <ufork+0x220>
+		return 0;
+	}
+
+	// Copy every run of mapped pages below the exception stack, which
+	// must not be shared.
+	va = 0;
+  8028c8:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  8028cd:	74 0b                	je     8028da <ufork+0x40>
+  8028cf:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  8028d5:	e9 07 01 00 00       	jmp    8029e1 <ufork+0x147>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8028da:	e8 22 e8 ff ff       	call   801101 <sys_getenvid>
+  8028df:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8028e4:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  8028ea:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8028ef:	a3 08 40 80 00       	mov    %eax,0x804008
+		return 0;
+  8028f4:	e9 c1 01 00 00       	jmp    802aba <ufork+0x220>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+		n = r;
+		last = &vec[n - 1];
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  8028f9:	83 ea 01             	sub    $0x1,%edx
+  8028fc:	89 c1                	mov    %eax,%ecx
+  8028fe:	c1 e1 04             	shl    $0x4,%ecx
+  802901:	89 94 0d ec fd ff ff 	mov    %edx,-0x214(%ebp,%ecx,1)
+			n--;
+  802908:	85 d2                	test   %edx,%edx
+  80290a:	0f 44 f0             	cmove  %eax,%esi
+  80290d:	e9 12 01 00 00       	jmp    802a24 <ufork+0x18a>
+	for (i = 0; i < n; i++) {
+  802912:	83 c1 01             	add    $0x1,%ecx
+  802915:	83 c0 10             	add    $0x10,%eax
+  802918:	39 8d e4 fb ff ff    	cmp    %ecx,-0x41c(%ebp)
+  80291e:	74 6a                	je     80298a <ufork+0xf0>
+		vec[i].pr_dstva = vec[i].pr_va;
+  802920:	89 c3                	mov    %eax,%ebx
+  802922:	8b 10                	mov    (%eax),%edx
+  802924:	89 50 0c             	mov    %edx,0xc(%eax)
+		if (vec[i].pr_perm & PTE_SHARE)
+  802927:	8b 50 08             	mov    0x8(%eax),%edx
+  80292a:	f6 c6 04             	test   $0x4,%dh
+  80292d:	75 e3                	jne    802912 <ufork+0x78>
+		if (vec[i].pr_perm & (PTE_W | PTE_COW)) {
+  80292f:	f7 c2 02 08 00 00    	test   $0x802,%edx
+  802935:	74 db                	je     802912 <ufork+0x78>
+			vec[i].pr_perm = (vec[i].pr_perm & ~PTE_W) | PTE_COW;
+  802937:	81 e2 fd f7 ff ff    	and    $0xfffff7fd,%edx
+  80293d:	80 ce 08             	or     $0x8,%dh
+  802940:	89 95 dc fb ff ff    	mov    %edx,-0x424(%ebp)
+  802946:	89 53 08             	mov    %edx,0x8(%ebx)
+			cow[ncow++] = vec[i];
+  802949:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  80294f:	c1 e6 04             	shl    $0x4,%esi
+  802952:	89 f2                	mov    %esi,%edx
+  802954:	8d b4 35 e8 fb ff ff 	lea    -0x418(%ebp,%esi,1),%esi
+  80295b:	8b 38                	mov    (%eax),%edi
+  80295d:	89 bc 15 e8 fb ff ff 	mov    %edi,-0x418(%ebp,%edx,1)
+  802964:	8b 78 04             	mov    0x4(%eax),%edi
+  802967:	89 7e 04             	mov    %edi,0x4(%esi)
+  80296a:	8b bd dc fb ff ff    	mov    -0x424(%ebp),%edi
+  802970:	89 7e 08             	mov    %edi,0x8(%esi)
+  802973:	8b 50 0c             	mov    0xc(%eax),%edx
+  802976:	89 56 0c             	mov    %edx,0xc(%esi)
+  802979:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  80297f:	8d 7e 01             	lea    0x1(%esi),%edi
+  802982:	89 bd e0 fb ff ff    	mov    %edi,-0x420(%ebp)
+  802988:	eb 88                	jmp    802912 <ufork+0x78>
+	if ((r = sys_page_map_vec(0, envid, vec, n, 0)) < 0)
+  80298a:	8b b5 e4 fb ff ff    	mov    -0x41c(%ebp),%esi
+  802990:	8b bd d8 fb ff ff    	mov    -0x428(%ebp),%edi
+  802996:	83 ec 0c             	sub    $0xc,%esp
+  802999:	6a 00                	push   $0x0
+  80299b:	56                   	push   %esi
+  80299c:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  8029a2:	50                   	push   %eax
+  8029a3:	ff b5 d4 fb ff ff    	push   -0x42c(%ebp)
+  8029a9:	6a 00                	push   $0x0
+  8029ab:	e8 80 f4 ff ff       	call   801e30 <sys_page_map_vec>
+  8029b0:	83 c4 20             	add    $0x20,%esp
+  8029b3:	85 c0                	test   %eax,%eax
+  8029b5:	0f 88 e5 00 00 00    	js     802aa0 <ufork+0x206>
+	return sys_page_map_vec(0, 0, cow, ncow, 0);
+  8029bb:	83 ec 0c             	sub    $0xc,%esp
+  8029be:	6a 00                	push   $0x0
+  8029c0:	ff b5 e0 fb ff ff    	push   -0x420(%ebp)
+  8029c6:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  8029cc:	50                   	push   %eax
+  8029cd:	6a 00                	push   $0x0
+  8029cf:	6a 00                	push   $0x0
+  8029d1:	e8 5a f4 ff ff       	call   801e30 <sys_page_map_vec>
+		if ((r = duppages(envid, vec, n)) < 0)
+  8029d6:	83 c4 20             	add    $0x20,%esp
+  8029d9:	85 c0                	test   %eax,%eax
+  8029db:	0f 88 e7 00 00 00    	js     802ac8 <ufork+0x22e>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+  8029e1:	6a 20                	push   $0x20
+  8029e3:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  8029e9:	50                   	push   %eax
+  8029ea:	57                   	push   %edi
+  8029eb:	6a 00                	push   $0x0
+  8029ed:	e8 82 f4 ff ff       	call   801e74 <sys_vm_ranges>
+  8029f2:	83 c4 10             	add    $0x10,%esp
+  8029f5:	85 c0                	test   %eax,%eax
+  8029f7:	7e 51                	jle    802a4a <ufork+0x1b0>
+		n = r;
+  8029f9:	89 c6                	mov    %eax,%esi
+		last = &vec[n - 1];
+  8029fb:	83 e8 01             	sub    $0x1,%eax
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+  8029fe:	89 c1                	mov    %eax,%ecx
+  802a00:	c1 e1 04             	shl    $0x4,%ecx
+  802a03:	8b 94 0d ec fd ff ff 	mov    -0x214(%ebp,%ecx,1),%edx
+  802a0a:	89 d3                	mov    %edx,%ebx
+  802a0c:	c1 e3 0c             	shl    $0xc,%ebx
+  802a0f:	89 df                	mov    %ebx,%edi
+  802a11:	03 bc 0d e8 fd ff ff 	add    -0x218(%ebp,%ecx,1),%edi
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  802a18:	81 ff 00 00 c0 ee    	cmp    $0xeec00000,%edi
+  802a1e:	0f 84 d5 fe ff ff    	je     8028f9 <ufork+0x5f>
+	for (i = 0; i < n; i++) {
+  802a24:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+	size_t i, ncow = 0;
+  802a2a:	c7 85 e0 fb ff ff 00 	movl   $0x0,-0x420(%ebp)
+  802a31:	00 00 00 
+	for (i = 0; i < n; i++) {
+  802a34:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a39:	89 bd d8 fb ff ff    	mov    %edi,-0x428(%ebp)
+  802a3f:	89 b5 e4 fb ff ff    	mov    %esi,-0x41c(%ebp)
+  802a45:	e9 ce fe ff ff       	jmp    802918 <ufork+0x7e>
+			goto fail;
+	}
+	if (r < 0)
+  802a4a:	89 c6                	mov    %eax,%esi
+  802a4c:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  802a52:	85 c0                	test   %eax,%eax
+  802a54:	78 52                	js     802aa8 <ufork+0x20e>
+		goto fail;
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE),
+  802a56:	83 ec 04             	sub    $0x4,%esp
+  802a59:	6a 07                	push   $0x7
+  802a5b:	68 00 f0 bf ee       	push   $0xeebff000
+  802a60:	53                   	push   %ebx
+  802a61:	e8 3a e7 ff ff       	call   8011a0 <sys_page_alloc>
+  802a66:	89 c6                	mov    %eax,%esi
+  802a68:	83 c4 10             	add    $0x10,%esp
+  802a6b:	85 c0                	test   %eax,%eax
+  802a6d:	78 39                	js     802aa8 <ufork+0x20e>
+				PTE_P | PTE_U | PTE_W)) < 0
+	    || (r = sys_env_set_pgfault_upcall(envid,
+			thisenv->env_pgfault_upcall)) < 0
+  802a6f:	a1 08 40 80 00       	mov    0x804008,%eax
+  802a74:	8b 40 74             	mov    0x74(%eax),%eax
+	    || (r = sys_env_set_pgfault_upcall(envid,
+  802a77:	83 ec 08             	sub    $0x8,%esp
+  802a7a:	50                   	push   %eax
+  802a7b:	53                   	push   %ebx
+  802a7c:	e8 de ed ff ff       	call   80185f <sys_env_set_pgfault_upcall>
+  802a81:	89 c6                	mov    %eax,%esi
+  802a83:	83 c4 10             	add    $0x10,%esp
+  802a86:	85 c0                	test   %eax,%eax
+  802a88:	78 1e                	js     802aa8 <ufork+0x20e>
+	    || (r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  802a8a:	83 ec 08             	sub    $0x8,%esp
+  802a8d:	6a 02                	push   $0x2
+  802a8f:	53                   	push   %ebx
+  802a90:	e8 bc ea ff ff       	call   801551 <sys_env_set_status>
+  802a95:	89 c6                	mov    %eax,%esi
+  802a97:	83 c4 10             	add    $0x10,%esp
+  802a9a:	85 c0                	test   %eax,%eax
+  802a9c:	79 1c                	jns    802aba <ufork+0x220>
+  802a9e:	eb 08                	jmp    802aa8 <ufork+0x20e>
+  802aa0:	89 c6                	mov    %eax,%esi
+  802aa2:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+		goto fail;
+	return envid;
+
+fail:
+	sys_env_destroy(envid);
+  802aa8:	83 ec 0c             	sub    $0xc,%esp
+  802aab:	53                   	push   %ebx
+  802aac:	e8 8e e5 ff ff       	call   80103f <sys_env_destroy>
+	return r;
+  802ab1:	83 c4 10             	add    $0x10,%esp
+  802ab4:	89 b5 d4 fb ff ff    	mov    %esi,-0x42c(%ebp)
+}
+  802aba:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+  802ac0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ac3:	5b                   	pop    %ebx
+  802ac4:	5e                   	pop    %esi
+  802ac5:	5f                   	pop    %edi
+  802ac6:	5d                   	pop    %ebp
+  802ac7:	c3                   	ret
+  802ac8:	89 c6                	mov    %eax,%esi
+  802aca:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  802ad0:	eb d6                	jmp    802aa8 <ufork+0x20e>
+
+00802ad2 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  802ad2:	55                   	push   %ebp
+  802ad3:	89 e5                	mov    %esp,%ebp
+  802ad5:	53                   	push   %ebx
+  802ad6:	83 ec 04             	sub    $0x4,%esp
+	envid_t envid;
+
+	envid = sys_fork();
+  802ad9:	e8 90 f2 ff ff       	call   801d6e <sys_fork>
+  802ade:	89 c3                	mov    %eax,%ebx
+	if (envid == 0)
+  802ae0:	85 c0                	test   %eax,%eax
+  802ae2:	74 07                	je     802aeb <fork+0x19>
+		thisenv = &envs[ENVX(sys_getenvid())];
+	return envid;
+}
+  802ae4:	89 d8                	mov    %ebx,%eax
+  802ae6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ae9:	c9                   	leave
+  802aea:	c3                   	ret
+		thisenv = &envs[ENVX(sys_getenvid())];
+  802aeb:	e8 11 e6 ff ff       	call   801101 <sys_getenvid>
+  802af0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802af5:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802afb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802b00:	a3 08 40 80 00       	mov    %eax,0x804008
+	return envid;
+  802b05:	eb dd                	jmp    802ae4 <fork+0x12>
+
+00802b07 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  802b07:	55                   	push   %ebp
+  802b08:	89 e5                	mov    %esp,%ebp
+  802b0a:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  802b0d:	68 9f 34 80 00       	push   $0x80349f
+  802b12:	68 a1 00 00 00       	push   $0xa1
+  802b17:	68 79 34 80 00       	push   $0x803479
+  802b1c:	e8 48 d7 ff ff       	call   800269 <_panic>
+
+00802b21 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802b21:	55                   	push   %ebp
+  802b22:	89 e5                	mov    %esp,%ebp
+  802b24:	56                   	push   %esi
+  802b25:	53                   	push   %ebx
+  802b26:	8b 75 08             	mov    0x8(%ebp),%esi
+  802b29:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b2c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if ((r = sys_ipc_recv(pg ? pg : (void *) UTOP)) < 0) {
+  802b2f:	85 c0                	test   %eax,%eax
+  802b31:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802b36:	0f 44 c2             	cmove  %edx,%eax
+  802b39:	83 ec 0c             	sub    $0xc,%esp
+  802b3c:	50                   	push   %eax
+  802b3d:	e8 2f ef ff ff       	call   801a71 <sys_ipc_recv>
+  802b42:	83 c4 10             	add    $0x10,%esp
+  802b45:	85 c0                	test   %eax,%eax
+  802b47:	78 34                	js     802b7d <ipc_recv+0x5c>
+			*from_env_store = 0;
+		if (perm_store)
+			*perm_store = 0;
+		return r;
+	}
+	if (from_env_store)
+  802b49:	85 f6                	test   %esi,%esi
+  802b4b:	74 0d                	je     802b5a <ipc_recv+0x39>
+		*from_env_store = thisenv->env_ipc_from;
+  802b4d:	a1 08 40 80 00       	mov    0x804008,%eax
+  802b52:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  802b58:	89 06                	mov    %eax,(%esi)
+	if (perm_store)
+  802b5a:	85 db                	test   %ebx,%ebx
+  802b5c:	74 0d                	je     802b6b <ipc_recv+0x4a>
+		*perm_store = thisenv->env_ipc_perm;
+  802b5e:	a1 08 40 80 00       	mov    0x804008,%eax
+  802b63:	8b 80 9c 00 00 00    	mov    0x9c(%eax),%eax
+  802b69:	89 03                	mov    %eax,(%ebx)
+	return thisenv->env_ipc_msg.m_w[0];
+  802b6b:	a1 08 40 80 00       	mov    0x804008,%eax
+  802b70:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802b76:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b79:	5b                   	pop    %ebx
+  802b7a:	5e                   	pop    %esi
+  802b7b:	5d                   	pop    %ebp
+  802b7c:	c3                   	ret
+		if (from_env_store)
+  802b7d:	85 f6                	test   %esi,%esi
+  802b7f:	74 06                	je     802b87 <ipc_recv+0x66>
+			*from_env_store = 0;
+  802b81:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802b87:	85 db                	test   %ebx,%ebx
+  802b89:	74 eb                	je     802b76 <ipc_recv+0x55>
+			*perm_store = 0;
+  802b8b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802b91:	eb e3                	jmp    802b76 <ipc_recv+0x55>
+
+00802b93 <ipc_send>:
+//
+// The kernel queues us behind any other senders until 'toenv'
+// receives, so we only come back to retry if its queue was full.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802b93:	55                   	push   %ebp
+  802b94:	89 e5                	mov    %esp,%ebp
+  802b96:	57                   	push   %edi
+  802b97:	56                   	push   %esi
+  802b98:	53                   	push   %ebx
+  802b99:	83 ec 0c             	sub    $0xc,%esp
+  802b9c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b9f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802ba2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_send(to_env, val, pg ? pg : (void *) UTOP, perm))
+  802ba5:	85 db                	test   %ebx,%ebx
+  802ba7:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802bac:	0f 44 d8             	cmove  %eax,%ebx
+  802baf:	eb 05                	jmp    802bb6 <ipc_send+0x23>
+	       == -E_AGAIN)
+		sys_yield();
+  802bb1:	e8 fc e8 ff ff       	call   8014b2 <sys_yield>
+	while ((r = sys_ipc_send(to_env, val, pg ? pg : (void *) UTOP, perm))
+  802bb6:	ff 75 14             	push   0x14(%ebp)
+  802bb9:	53                   	push   %ebx
+  802bba:	56                   	push   %esi
+  802bbb:	57                   	push   %edi
+  802bbc:	e8 09 ee ff ff       	call   8019ca <sys_ipc_send>
+	       == -E_AGAIN)
+  802bc1:	83 c4 10             	add    $0x10,%esp
+  802bc4:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802bc7:	74 e8                	je     802bb1 <ipc_send+0x1e>
+	if (r < 0)
+  802bc9:	85 c0                	test   %eax,%eax
+  802bcb:	78 08                	js     802bd5 <ipc_send+0x42>
+		panic("ipc_send: %e", r);
+}
+  802bcd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bd0:	5b                   	pop    %ebx
+  802bd1:	5e                   	pop    %esi
+  802bd2:	5f                   	pop    %edi
+  802bd3:	5d                   	pop    %ebp
+  802bd4:	c3                   	ret
+		panic("ipc_send: %e", r);
+  802bd5:	50                   	push   %eax
+  802bd6:	68 b5 34 80 00       	push   $0x8034b5
+  802bdb:	6a 3a                	push   $0x3a
+  802bdd:	68 c2 34 80 00       	push   $0x8034c2
+  802be2:	e8 82 d6 ff ff       	call   800269 <_panic>
+
+00802be7 <ipc_send_range>:
+
+// Like ipc_send, but send the 'npages' contiguous pages at 'pg' in one
+// message.  The receiver maps as many as fit in its window.
+void
+ipc_send_range(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  802be7:	55                   	push   %ebp
+  802be8:	89 e5                	mov    %esp,%ebp
+  802bea:	57                   	push   %edi
+  802beb:	56                   	push   %esi
+  802bec:	53                   	push   %ebx
+  802bed:	83 ec 0c             	sub    $0xc,%esp
+  802bf0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802bf3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802bf6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_send_range(to_env, val, pg, npages, perm))
+  802bf9:	eb 05                	jmp    802c00 <ipc_send_range+0x19>
+	       == -E_AGAIN)
+		sys_yield();
+  802bfb:	e8 b2 e8 ff ff       	call   8014b2 <sys_yield>
+	while ((r = sys_ipc_send_range(to_env, val, pg, npages, perm))
+  802c00:	83 ec 0c             	sub    $0xc,%esp
+  802c03:	ff 75 18             	push   0x18(%ebp)
+  802c06:	ff 75 14             	push   0x14(%ebp)
+  802c09:	53                   	push   %ebx
+  802c0a:	56                   	push   %esi
+  802c0b:	57                   	push   %edi
+  802c0c:	e8 22 ef ff ff       	call   801b33 <sys_ipc_send_range>
+	       == -E_AGAIN)
+  802c11:	83 c4 20             	add    $0x20,%esp
+  802c14:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802c17:	74 e2                	je     802bfb <ipc_send_range+0x14>
+	if (r < 0)
+  802c19:	85 c0                	test   %eax,%eax
+  802c1b:	78 08                	js     802c25 <ipc_send_range+0x3e>
+		panic("ipc_send_range: %e", r);
+}
+  802c1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c20:	5b                   	pop    %ebx
+  802c21:	5e                   	pop    %esi
+  802c22:	5f                   	pop    %edi
+  802c23:	5d                   	pop    %ebp
+  802c24:	c3                   	ret
+		panic("ipc_send_range: %e", r);
+  802c25:	50                   	push   %eax
+  802c26:	68 cc 34 80 00       	push   $0x8034cc
+  802c2b:	6a 48                	push   $0x48
+  802c2d:	68 c2 34 80 00       	push   $0x8034c2
+  802c32:	e8 32 d6 ff ff       	call   800269 <_panic>
+
+00802c37 <ipc_recv_range>:
+// (which must not be null).  On return *npages holds the number of
+// pages received, which is 0 on error or if the sender sent none.
+int32_t
+ipc_recv_range(envid_t *from_env_store, void *pg, size_t *npages,
+	       int *perm_store)
+{
+  802c37:	55                   	push   %ebp
+  802c38:	89 e5                	mov    %esp,%ebp
+  802c3a:	57                   	push   %edi
+  802c3b:	56                   	push   %esi
+  802c3c:	53                   	push   %ebx
+  802c3d:	83 ec 14             	sub    $0x14,%esp
+  802c40:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802c43:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802c46:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if ((r = sys_ipc_recv_range(pg, *npages)) < 0) {
+  802c49:	ff 33                	push   (%ebx)
+  802c4b:	ff 75 0c             	push   0xc(%ebp)
+  802c4e:	e8 83 ef ff ff       	call   801bd6 <sys_ipc_recv_range>
+  802c53:	83 c4 10             	add    $0x10,%esp
+  802c56:	85 c0                	test   %eax,%eax
+  802c58:	78 42                	js     802c9c <ipc_recv_range+0x65>
+		if (perm_store)
+			*perm_store = 0;
+		*npages = 0;
+		return r;
+	}
+	if (from_env_store)
+  802c5a:	85 ff                	test   %edi,%edi
+  802c5c:	74 0d                	je     802c6b <ipc_recv_range+0x34>
+		*from_env_store = thisenv->env_ipc_from;
+  802c5e:	a1 08 40 80 00       	mov    0x804008,%eax
+  802c63:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  802c69:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  802c6b:	85 f6                	test   %esi,%esi
+  802c6d:	74 0d                	je     802c7c <ipc_recv_range+0x45>
+		*perm_store = thisenv->env_ipc_perm;
+  802c6f:	a1 08 40 80 00       	mov    0x804008,%eax
+  802c74:	8b 80 9c 00 00 00    	mov    0x9c(%eax),%eax
+  802c7a:	89 06                	mov    %eax,(%esi)
+	*npages = thisenv->env_ipc_npages;
+  802c7c:	a1 08 40 80 00       	mov    0x804008,%eax
+  802c81:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802c87:	89 03                	mov    %eax,(%ebx)
+	return thisenv->env_ipc_msg.m_w[0];
+  802c89:	a1 08 40 80 00       	mov    0x804008,%eax
+  802c8e:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802c94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c97:	5b                   	pop    %ebx
+  802c98:	5e                   	pop    %esi
+  802c99:	5f                   	pop    %edi
+  802c9a:	5d                   	pop    %ebp
+  802c9b:	c3                   	ret
+		if (from_env_store)
+  802c9c:	85 ff                	test   %edi,%edi
+  802c9e:	74 06                	je     802ca6 <ipc_recv_range+0x6f>
+			*from_env_store = 0;
+  802ca0:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  802ca6:	85 f6                	test   %esi,%esi
+  802ca8:	74 06                	je     802cb0 <ipc_recv_range+0x79>
+			*perm_store = 0;
+  802caa:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		*npages = 0;
+  802cb0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		return r;
+  802cb6:	eb dc                	jmp    802c94 <ipc_recv_range+0x5d>
+
+00802cb8 <ipc_send_msg>:
+// Send the IPC_MSG_WORDS words of 'msg' to 'to_env', in registers and
+// without a page.  Waits like ipc_send until 'to_env' takes them, and
+// panics on any error other than -E_AGAIN.
+void
+ipc_send_msg(envid_t to_env, const struct ipc_msg *msg)
+{
+  802cb8:	55                   	push   %ebp
+  802cb9:	89 e5                	mov    %esp,%ebp
+  802cbb:	56                   	push   %esi
+  802cbc:	53                   	push   %ebx
+  802cbd:	8b 75 08             	mov    0x8(%ebp),%esi
+  802cc0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_send_msg(to_env, msg)) == -E_AGAIN)
+  802cc3:	eb 05                	jmp    802cca <ipc_send_msg+0x12>
+		sys_yield();
+  802cc5:	e8 e8 e7 ff ff       	call   8014b2 <sys_yield>
+	while ((r = sys_ipc_send_msg(to_env, msg)) == -E_AGAIN)
+  802cca:	83 ec 08             	sub    $0x8,%esp
+  802ccd:	53                   	push   %ebx
+  802cce:	56                   	push   %esi
+  802ccf:	e8 3a f0 ff ff       	call   801d0e <sys_ipc_send_msg>
+  802cd4:	83 c4 10             	add    $0x10,%esp
+  802cd7:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802cda:	74 e9                	je     802cc5 <ipc_send_msg+0xd>
+	if (r < 0)
+  802cdc:	85 c0                	test   %eax,%eax
+  802cde:	78 07                	js     802ce7 <ipc_send_msg+0x2f>
+		panic("ipc_send_msg: %e", r);
+}
+  802ce0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ce3:	5b                   	pop    %ebx
+  802ce4:	5e                   	pop    %esi
+  802ce5:	5d                   	pop    %ebp
+  802ce6:	c3                   	ret
+		panic("ipc_send_msg: %e", r);
+  802ce7:	50                   	push   %eax
+  802ce8:	68 df 34 80 00       	push   $0x8034df
+  802ced:	6a 6f                	push   $0x6f
+  802cef:	68 c2 34 80 00       	push   $0x8034c2
+  802cf4:	e8 70 d5 ff ff       	call   800269 <_panic>
+
+00802cf9 <ipc_recv_msg>:
+// ipc_call or plain ipc_send (whose value is word 0, and whose page is
+// not taken), it arrives in registers and needs no page.
+// Returns the sender's envid, < 0 on error.
+envid_t
+ipc_recv_msg(struct ipc_msg *msg)
+{
+  802cf9:	55                   	push   %ebp
+  802cfa:	89 e5                	mov    %esp,%ebp
+  802cfc:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_reply_wait(0, msg);
+  802cff:	ff 75 08             	push   0x8(%ebp)
+  802d02:	6a 00                	push   $0x0
+  802d04:	e8 cb ef ff ff       	call   801cd4 <sys_ipc_reply_wait>
+}
+  802d09:	c9                   	leave
+  802d0a:	c3                   	ret
+
+00802d0b <ipc_call>:
+// ipc_reply_wait (or ipc_recv), and straight back when it replies.
+// Retries while to_env's queue is full.
+// Returns 0 on success, < 0 on error.
+int
+ipc_call(envid_t to_env, struct ipc_msg *msg)
+{
+  802d0b:	55                   	push   %ebp
+  802d0c:	89 e5                	mov    %esp,%ebp
+  802d0e:	56                   	push   %esi
+  802d0f:	53                   	push   %ebx
+  802d10:	8b 75 08             	mov    0x8(%ebp),%esi
+  802d13:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_call(to_env, msg)) == -E_AGAIN)
+  802d16:	eb 05                	jmp    802d1d <ipc_call+0x12>
+		sys_yield();
+  802d18:	e8 95 e7 ff ff       	call   8014b2 <sys_yield>
+	while ((r = sys_ipc_call(to_env, msg)) == -E_AGAIN)
+  802d1d:	83 ec 08             	sub    $0x8,%esp
+  802d20:	53                   	push   %ebx
+  802d21:	56                   	push   %esi
+  802d22:	e8 73 ef ff ff       	call   801c9a <sys_ipc_call>
+  802d27:	83 c4 10             	add    $0x10,%esp
+  802d2a:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802d2d:	74 e9                	je     802d18 <ipc_call+0xd>
+	return r;
+}
+  802d2f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d32:	5b                   	pop    %ebx
+  802d33:	5e                   	pop    %esi
+  802d34:	5d                   	pop    %ebp
+  802d35:	c3                   	ret
+
+00802d36 <ipc_reply_wait>:
+//	}
+//
+// Returns the envid of the sender, < 0 on error.
+envid_t
+ipc_reply_wait(envid_t to_env, struct ipc_msg *msg)
+{
+  802d36:	55                   	push   %ebp
+  802d37:	89 e5                	mov    %esp,%ebp
+  802d39:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_reply_wait(to_env, msg);
+  802d3c:	ff 75 0c             	push   0xc(%ebp)
+  802d3f:	ff 75 08             	push   0x8(%ebp)
+  802d42:	e8 8d ef ff ff       	call   801cd4 <sys_ipc_reply_wait>
+}
+  802d47:	c9                   	leave
+  802d48:	c3                   	ret
+
+00802d49 <ep_send>:
+
+// Send 'msg' to endpoint 'epid', waiting while its queue is full.
+// Returns 0 on success, < 0 if the endpoint is gone or not ours to use.
+int
+ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  802d49:	55                   	push   %ebp
+  802d4a:	89 e5                	mov    %esp,%ebp
+  802d4c:	56                   	push   %esi
+  802d4d:	53                   	push   %ebx
+  802d4e:	8b 75 08             	mov    0x8(%ebp),%esi
+  802d51:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ep_send(epid, msg)) == -E_AGAIN)
+  802d54:	eb 05                	jmp    802d5b <ep_send+0x12>
+		sys_yield();
+  802d56:	e8 57 e7 ff ff       	call   8014b2 <sys_yield>
+	while ((r = sys_ep_send(epid, msg)) == -E_AGAIN)
+  802d5b:	83 ec 08             	sub    $0x8,%esp
+  802d5e:	53                   	push   %ebx
+  802d5f:	56                   	push   %esi
+  802d60:	e8 c6 f8 ff ff       	call   80262b <sys_ep_send>
+  802d65:	83 c4 10             	add    $0x10,%esp
+  802d68:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802d6b:	74 e9                	je     802d56 <ep_send+0xd>
+	return r;
+}
+  802d6d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d70:	5b                   	pop    %ebx
+  802d71:	5e                   	pop    %esi
+  802d72:	5d                   	pop    %ebp
+  802d73:	c3                   	ret
+
+00802d74 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802d74:	55                   	push   %ebp
+  802d75:	89 e5                	mov    %esp,%ebp
+  802d77:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802d7a:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802d7f:	69 d0 68 01 00 00    	imul   $0x168,%eax,%edx
+  802d85:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802d8b:	8b 52 50             	mov    0x50(%edx),%edx
+  802d8e:	39 ca                	cmp    %ecx,%edx
+  802d90:	74 11                	je     802da3 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802d92:	83 c0 01             	add    $0x1,%eax
+  802d95:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802d9a:	75 e3                	jne    802d7f <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802d9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802da1:	eb 0e                	jmp    802db1 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802da3:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802da9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802dae:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802db1:	5d                   	pop    %ebp
+  802db2:	c3                   	ret
+
+00802db3 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802db3:	55                   	push   %ebp
+  802db4:	89 e5                	mov    %esp,%ebp
+  802db6:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  802db9:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  802dc0:	74 0a                	je     802dcc <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  802dc2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dc5:	a3 0c 40 80 00       	mov    %eax,0x80400c
+}
+  802dca:	c9                   	leave
+  802dcb:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE),
+  802dcc:	83 ec 04             	sub    $0x4,%esp
+  802dcf:	6a 07                	push   $0x7
+  802dd1:	68 00 f0 bf ee       	push   $0xeebff000
+  802dd6:	6a 00                	push   $0x0
+  802dd8:	e8 c3 e3 ff ff       	call   8011a0 <sys_page_alloc>
+  802ddd:	83 c4 10             	add    $0x10,%esp
+  802de0:	85 c0                	test   %eax,%eax
+  802de2:	78 28                	js     802e0c <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  802de4:	83 ec 08             	sub    $0x8,%esp
+  802de7:	68 1e 2e 80 00       	push   $0x802e1e
+  802dec:	6a 00                	push   $0x0
+  802dee:	e8 6c ea ff ff       	call   80185f <sys_env_set_pgfault_upcall>
+  802df3:	83 c4 10             	add    $0x10,%esp
+  802df6:	85 c0                	test   %eax,%eax
+  802df8:	79 c8                	jns    802dc2 <set_pgfault_handler+0xf>
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+  802dfa:	50                   	push   %eax
+  802dfb:	68 18 35 80 00       	push   $0x803518
+  802e00:	6a 24                	push   $0x24
+  802e02:	68 4c 35 80 00       	push   $0x80354c
+  802e07:	e8 5d d4 ff ff       	call   800269 <_panic>
+			panic("set_pgfault_handler: sys_page_alloc: %e", r);
+  802e0c:	50                   	push   %eax
+  802e0d:	68 f0 34 80 00       	push   $0x8034f0
+  802e12:	6a 22                	push   $0x22
+  802e14:	68 4c 35 80 00       	push   $0x80354c
+  802e19:	e8 4b d4 ff ff       	call   800269 <_panic>
+
+00802e1e <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802e1e:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802e1f:	a1 0c 40 80 00       	mov    0x80400c,%eax
+	call *%eax
+  802e24:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802e26:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 0x28(%esp), %ebx		// trap-time eip
+  802e29:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl 0x30(%esp), %eax		// trap-time esp
+  802e2d:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  802e31:	83 e8 04             	sub    $0x4,%eax
+	movl %ebx, (%eax)
+  802e34:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 0x30(%esp)
+  802e36:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp			// skip fault_va and err
+  802e3a:	83 c4 08             	add    $0x8,%esp
+	popal
+  802e3d:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp			// skip eip
+  802e3e:	83 c4 04             	add    $0x4,%esp
+	popfl
+  802e41:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802e42:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802e43:	c3                   	ret
+
+00802e44 <dm>:
+  802e44:	55                   	push   %ebp
+  802e45:	57                   	push   %edi
+  802e46:	56                   	push   %esi
+  802e47:	53                   	push   %ebx
+  802e48:	83 ec 24             	sub    $0x24,%esp
+  802e4b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802e4f:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802e53:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802e57:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802e5b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802e5f:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802e63:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802e67:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e6c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e71:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802e76:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802e7d:	00 
+  802e7e:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802e85:	00 
+  802e86:	89 fb                	mov    %edi,%ebx
+  802e88:	eb 08                	jmp    802e92 <dm+0x4e>
+  802e8a:	83 e9 01             	sub    $0x1,%ecx
+  802e8d:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802e90:	74 68                	je     802efa <dm+0xb6>
+  802e92:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802e96:	01 c0                	add    %eax,%eax
+  802e98:	89 c6                	mov    %eax,%esi
+  802e9a:	89 d7                	mov    %edx,%edi
+  802e9c:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802ea0:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802ea4:	0f ad d0             	shrd   %cl,%edx,%eax
+  802ea7:	d3 ea                	shr    %cl,%edx
+  802ea9:	f6 c1 20             	test   $0x20,%cl
+  802eac:	74 04                	je     802eb2 <dm+0x6e>
+  802eae:	89 d0                	mov    %edx,%eax
+  802eb0:	31 d2                	xor    %edx,%edx
+  802eb2:	83 e0 01             	and    $0x1,%eax
+  802eb5:	89 04 24             	mov    %eax,(%esp)
+  802eb8:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802ebf:	00 
+  802ec0:	8b 04 24             	mov    (%esp),%eax
+  802ec3:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802ec7:	09 f0                	or     %esi,%eax
+  802ec9:	09 fa                	or     %edi,%edx
+  802ecb:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802ecf:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802ed3:	39 f0                	cmp    %esi,%eax
+  802ed5:	89 d5                	mov    %edx,%ebp
+  802ed7:	19 fd                	sbb    %edi,%ebp
+  802ed9:	72 af                	jb     802e8a <dm+0x46>
+  802edb:	29 f0                	sub    %esi,%eax
+  802edd:	19 fa                	sbb    %edi,%edx
+  802edf:	89 cf                	mov    %ecx,%edi
+  802ee1:	c1 ef 05             	shr    $0x5,%edi
+  802ee4:	83 e7 01             	and    $0x1,%edi
+  802ee7:	89 fe                	mov    %edi,%esi
+  802ee9:	83 f6 01             	xor    $0x1,%esi
+  802eec:	d3 e6                	shl    %cl,%esi
+  802eee:	d3 e7                	shl    %cl,%edi
+  802ef0:	09 74 24 18          	or     %esi,0x18(%esp)
+  802ef4:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802ef8:	eb 90                	jmp    802e8a <dm+0x46>
+  802efa:	85 db                	test   %ebx,%ebx
+  802efc:	74 05                	je     802f03 <dm+0xbf>
+  802efe:	89 03                	mov    %eax,(%ebx)
+  802f00:	89 53 04             	mov    %edx,0x4(%ebx)
+  802f03:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802f07:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802f0b:	83 c4 24             	add    $0x24,%esp
+  802f0e:	5b                   	pop    %ebx
+  802f0f:	5e                   	pop    %esi
+  802f10:	5f                   	pop    %edi
+  802f11:	5d                   	pop    %ebp
+  802f12:	c3                   	ret
+
+00802f13 <__udivdi3>:
+  802f13:	83 ec 08             	sub    $0x8,%esp
+  802f16:	6a 00                	push   $0x0
+  802f18:	ff 74 24 1c          	push   0x1c(%esp)
+  802f1c:	ff 74 24 1c          	push   0x1c(%esp)
+  802f20:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802f24:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802f28:	e8 17 ff ff ff       	call   802e44 <dm>
+  802f2d:	83 c4 14             	add    $0x14,%esp
+  802f30:	c3                   	ret
+
+00802f31 <__umoddi3>:
+  802f31:	83 ec 18             	sub    $0x18,%esp
+  802f34:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802f38:	50                   	push   %eax
+  802f39:	ff 74 24 2c          	push   0x2c(%esp)
+  802f3d:	ff 74 24 2c          	push   0x2c(%esp)
+  802f41:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802f45:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802f49:	e8 f6 fe ff ff       	call   802e44 <dm>
+  802f4e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802f52:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802f56:	83 c4 24             	add    $0x24,%esp
+  802f59:	c3                   	ret
+
+00802f5a <__divdi3>:
+  802f5a:	53                   	push   %ebx
+  802f5b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802f5f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802f63:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  802f67:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  802f6b:	85 d2                	test   %edx,%edx
+  802f6d:	78 15                	js     802f84 <__divdi3+0x2a>
+  802f6f:	85 db                	test   %ebx,%ebx
+  802f71:	78 34                	js     802fa7 <__divdi3+0x4d>
+  802f73:	83 ec 04             	sub    $0x4,%esp
+  802f76:	6a 00                	push   $0x0
+  802f78:	53                   	push   %ebx
+  802f79:	51                   	push   %ecx
+  802f7a:	e8 c5 fe ff ff       	call   802e44 <dm>
+  802f7f:	83 c4 10             	add    $0x10,%esp
+  802f82:	eb 21                	jmp    802fa5 <__divdi3+0x4b>
+  802f84:	f7 d8                	neg    %eax
+  802f86:	83 d2 00             	adc    $0x0,%edx
+  802f89:	f7 da                	neg    %edx
+  802f8b:	85 db                	test   %ebx,%ebx
+  802f8d:	78 30                	js     802fbf <__divdi3+0x65>
+  802f8f:	83 ec 04             	sub    $0x4,%esp
+  802f92:	6a 00                	push   $0x0
+  802f94:	53                   	push   %ebx
+  802f95:	51                   	push   %ecx
+  802f96:	e8 a9 fe ff ff       	call   802e44 <dm>
+  802f9b:	83 c4 10             	add    $0x10,%esp
+  802f9e:	f7 d8                	neg    %eax
+  802fa0:	83 d2 00             	adc    $0x0,%edx
+  802fa3:	f7 da                	neg    %edx
+  802fa5:	5b                   	pop    %ebx
+  802fa6:	c3                   	ret
+  802fa7:	83 ec 04             	sub    $0x4,%esp
+  802faa:	6a 00                	push   $0x0
+  802fac:	f7 d9                	neg    %ecx
+  802fae:	83 d3 00             	adc    $0x0,%ebx
+  802fb1:	f7 db                	neg    %ebx
+  802fb3:	53                   	push   %ebx
+  802fb4:	51                   	push   %ecx
+  802fb5:	e8 8a fe ff ff       	call   802e44 <dm>
+  802fba:	83 c4 10             	add    $0x10,%esp
+  802fbd:	eb df                	jmp    802f9e <__divdi3+0x44>
+  802fbf:	83 ec 04             	sub    $0x4,%esp
+  802fc2:	6a 00                	push   $0x0
+  802fc4:	f7 d9                	neg    %ecx
+  802fc6:	83 d3 00             	adc    $0x0,%ebx
+  802fc9:	f7 db                	neg    %ebx
+  802fcb:	53                   	push   %ebx
+  802fcc:	51                   	push   %ecx
+  802fcd:	e8 72 fe ff ff       	call   802e44 <dm>
+  802fd2:	83 c4 10             	add    $0x10,%esp
+  802fd5:	eb ce                	jmp    802fa5 <__divdi3+0x4b>
+
+00802fd7 <__moddi3>:
+  802fd7:	55                   	push   %ebp
+  802fd8:	57                   	push   %edi
+  802fd9:	56                   	push   %esi
+  802fda:	53                   	push   %ebx
+  802fdb:	83 ec 18             	sub    $0x18,%esp
+  802fde:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802fe2:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802fe6:	89 f1                	mov    %esi,%ecx
+  802fe8:	f7 d9                	neg    %ecx
+  802fea:	89 da                	mov    %ebx,%edx
+  802fec:	83 d2 00             	adc    $0x0,%edx
+  802fef:	f7 da                	neg    %edx
+  802ff1:	0f 48 ce             	cmovs  %esi,%ecx
+  802ff4:	0f 48 d3             	cmovs  %ebx,%edx
+  802ff7:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802ffb:	50                   	push   %eax
+  802ffc:	8b 74 24 38          	mov    0x38(%esp),%esi
+  803000:	f7 de                	neg    %esi
+  803002:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  803006:	83 d0 00             	adc    $0x0,%eax
+  803009:	f7 d8                	neg    %eax
+  80300b:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  803010:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  803015:	50                   	push   %eax
+  803016:	56                   	push   %esi
+  803017:	89 c8                	mov    %ecx,%eax
+  803019:	e8 26 fe ff ff       	call   802e44 <dm>
+  80301e:	83 c4 10             	add    $0x10,%esp
+  803021:	85 db                	test   %ebx,%ebx
+  803023:	78 10                	js     803035 <__moddi3+0x5e>
+  803025:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803029:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80302d:	83 c4 14             	add    $0x14,%esp
+  803030:	5b                   	pop    %ebx
+  803031:	5e                   	pop    %esi
+  803032:	5f                   	pop    %edi
+  803033:	5d                   	pop    %ebp
+  803034:	c3                   	ret
+  803035:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803039:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80303d:	f7 d8                	neg    %eax
+  80303f:	83 d2 00             	adc    $0x0,%edx
+  803042:	f7 da                	neg    %edx
+  803044:	eb e7                	jmp    80302d <__moddi3+0x56>
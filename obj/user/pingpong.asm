@@ -0,0 +1,6109 @@
+
+obj/user/pingpong:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 8f 00 00 00       	call   8000c0 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+	envid_t who;
+
+	if ((who = fork()) != 0) {
+  80003c:	e8 c4 28 00 00       	call   802905 <fork>
+  800041:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800044:	85 c0                	test   %eax,%eax
+  800046:	75 4f                	jne    800097 <umain+0x64>
+		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+		ipc_send(who, 0, 0, 0);
+	}
+
+	while (1) {
+		uint32_t i = ipc_recv(&who, 0, 0);
+  800048:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  80004b:	83 ec 04             	sub    $0x4,%esp
+  80004e:	6a 00                	push   $0x0
+  800050:	6a 00                	push   $0x0
+  800052:	56                   	push   %esi
+  800053:	e8 fc 28 00 00       	call   802954 <ipc_recv>
+  800058:	89 c3                	mov    %eax,%ebx
+		cprintf("%x got %d from %x\n", sys_getenvid(), i, who);
+  80005a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80005d:	e8 d2 0e 00 00       	call   800f34 <sys_getenvid>
+  800062:	57                   	push   %edi
+  800063:	53                   	push   %ebx
+  800064:	50                   	push   %eax
+  800065:	68 16 2f 80 00       	push   $0x802f16
+  80006a:	e8 41 01 00 00       	call   8001b0 <cprintf>
+		if (i == 10)
+  80006f:	83 c4 20             	add    $0x20,%esp
+  800072:	83 fb 0a             	cmp    $0xa,%ebx
+  800075:	74 18                	je     80008f <umain+0x5c>
+			return;
+		i++;
+  800077:	83 c3 01             	add    $0x1,%ebx
+		ipc_send(who, i, 0, 0);
+  80007a:	6a 00                	push   $0x0
+  80007c:	6a 00                	push   $0x0
+  80007e:	53                   	push   %ebx
+  80007f:	ff 75 e4             	push   -0x1c(%ebp)
+  800082:	e8 3f 29 00 00       	call   8029c6 <ipc_send>
+		if (i == 10)
+  800087:	83 c4 10             	add    $0x10,%esp
+  80008a:	83 fb 0a             	cmp    $0xa,%ebx
+  80008d:	75 bc                	jne    80004b <umain+0x18>
+			return;
+	}
+
+}
+  80008f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800092:	5b                   	pop    %ebx
+  800093:	5e                   	pop    %esi
+  800094:	5f                   	pop    %edi
+  800095:	5d                   	pop    %ebp
+  800096:	c3                   	ret
+  800097:	89 c3                	mov    %eax,%ebx
+		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  800099:	e8 96 0e 00 00       	call   800f34 <sys_getenvid>
+  80009e:	83 ec 04             	sub    $0x4,%esp
+  8000a1:	53                   	push   %ebx
+  8000a2:	50                   	push   %eax
+  8000a3:	68 00 2f 80 00       	push   $0x802f00
+  8000a8:	e8 03 01 00 00       	call   8001b0 <cprintf>
+		ipc_send(who, 0, 0, 0);
+  8000ad:	6a 00                	push   $0x0
+  8000af:	6a 00                	push   $0x0
+  8000b1:	6a 00                	push   $0x0
+  8000b3:	ff 75 e4             	push   -0x1c(%ebp)
+  8000b6:	e8 0b 29 00 00       	call   8029c6 <ipc_send>
+  8000bb:	83 c4 20             	add    $0x20,%esp
+  8000be:	eb 88                	jmp    800048 <umain+0x15>
+
+008000c0 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000c0:	55                   	push   %ebp
+  8000c1:	89 e5                	mov    %esp,%ebp
+  8000c3:	56                   	push   %esi
+  8000c4:	53                   	push   %ebx
+  8000c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000c8:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  8000cb:	e8 64 0e 00 00       	call   800f34 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  8000d0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000d5:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  8000db:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000e0:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000e5:	85 db                	test   %ebx,%ebx
+  8000e7:	7e 07                	jle    8000f0 <libmain+0x30>
+		binaryname = argv[0];
+  8000e9:	8b 06                	mov    (%esi),%eax
+  8000eb:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000f0:	83 ec 08             	sub    $0x8,%esp
+  8000f3:	56                   	push   %esi
+  8000f4:	53                   	push   %ebx
+  8000f5:	e8 39 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000fa:	e8 0a 00 00 00       	call   800109 <exit>
+}
+  8000ff:	83 c4 10             	add    $0x10,%esp
+  800102:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800105:	5b                   	pop    %ebx
+  800106:	5e                   	pop    %esi
+  800107:	5d                   	pop    %ebp
+  800108:	c3                   	ret
+
+00800109 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800109:	55                   	push   %ebp
+  80010a:	89 e5                	mov    %esp,%ebp
+  80010c:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  80010f:	6a 00                	push   $0x0
+  800111:	e8 5c 0d 00 00       	call   800e72 <sys_env_destroy>
+}
+  800116:	83 c4 10             	add    $0x10,%esp
+  800119:	c9                   	leave
+  80011a:	c3                   	ret
+
+0080011b <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80011b:	55                   	push   %ebp
+  80011c:	89 e5                	mov    %esp,%ebp
+  80011e:	53                   	push   %ebx
+  80011f:	83 ec 04             	sub    $0x4,%esp
+  800122:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800125:	8b 13                	mov    (%ebx),%edx
+  800127:	8d 42 01             	lea    0x1(%edx),%eax
+  80012a:	89 03                	mov    %eax,(%ebx)
+  80012c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80012f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800133:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800138:	74 09                	je     800143 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80013a:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80013e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800141:	c9                   	leave
+  800142:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800143:	83 ec 08             	sub    $0x8,%esp
+  800146:	68 ff 00 00 00       	push   $0xff
+  80014b:	8d 43 08             	lea    0x8(%ebx),%eax
+  80014e:	50                   	push   %eax
+  80014f:	e8 e2 0b 00 00       	call   800d36 <sys_cputs>
+		b->idx = 0;
+  800154:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80015a:	83 c4 10             	add    $0x10,%esp
+  80015d:	eb db                	jmp    80013a <putch+0x1f>
+
+0080015f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80015f:	55                   	push   %ebp
+  800160:	89 e5                	mov    %esp,%ebp
+  800162:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800168:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80016f:	00 00 00 
+	b.cnt = 0;
+  800172:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800179:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80017c:	ff 75 0c             	push   0xc(%ebp)
+  80017f:	ff 75 08             	push   0x8(%ebp)
+  800182:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800188:	50                   	push   %eax
+  800189:	68 1b 01 80 00       	push   $0x80011b
+  80018e:	e8 14 01 00 00       	call   8002a7 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800193:	83 c4 08             	add    $0x8,%esp
+  800196:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80019c:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001a2:	50                   	push   %eax
+  8001a3:	e8 8e 0b 00 00       	call   800d36 <sys_cputs>
+
+	return b.cnt;
+}
+  8001a8:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001ae:	c9                   	leave
+  8001af:	c3                   	ret
+
+008001b0 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001b0:	55                   	push   %ebp
+  8001b1:	89 e5                	mov    %esp,%ebp
+  8001b3:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001b6:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001b9:	50                   	push   %eax
+  8001ba:	ff 75 08             	push   0x8(%ebp)
+  8001bd:	e8 9d ff ff ff       	call   80015f <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001c2:	c9                   	leave
+  8001c3:	c3                   	ret
+
+008001c4 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001c4:	55                   	push   %ebp
+  8001c5:	89 e5                	mov    %esp,%ebp
+  8001c7:	57                   	push   %edi
+  8001c8:	56                   	push   %esi
+  8001c9:	53                   	push   %ebx
+  8001ca:	83 ec 1c             	sub    $0x1c,%esp
+  8001cd:	89 c7                	mov    %eax,%edi
+  8001cf:	89 d6                	mov    %edx,%esi
+  8001d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001d4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001d7:	89 d1                	mov    %edx,%ecx
+  8001d9:	89 c2                	mov    %eax,%edx
+  8001db:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001de:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001e1:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001e4:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001e7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001ea:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001f1:	39 c2                	cmp    %eax,%edx
+  8001f3:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001f6:	72 3e                	jb     800236 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001f8:	83 ec 0c             	sub    $0xc,%esp
+  8001fb:	ff 75 18             	push   0x18(%ebp)
+  8001fe:	83 eb 01             	sub    $0x1,%ebx
+  800201:	53                   	push   %ebx
+  800202:	50                   	push   %eax
+  800203:	83 ec 08             	sub    $0x8,%esp
+  800206:	ff 75 e4             	push   -0x1c(%ebp)
+  800209:	ff 75 e0             	push   -0x20(%ebp)
+  80020c:	ff 75 dc             	push   -0x24(%ebp)
+  80020f:	ff 75 d8             	push   -0x28(%ebp)
+  800212:	e8 ae 2b 00 00       	call   802dc5 <__udivdi3>
+  800217:	83 c4 18             	add    $0x18,%esp
+  80021a:	52                   	push   %edx
+  80021b:	50                   	push   %eax
+  80021c:	89 f2                	mov    %esi,%edx
+  80021e:	89 f8                	mov    %edi,%eax
+  800220:	e8 9f ff ff ff       	call   8001c4 <printnum>
+  800225:	83 c4 20             	add    $0x20,%esp
+  800228:	eb 13                	jmp    80023d <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80022a:	83 ec 08             	sub    $0x8,%esp
+  80022d:	56                   	push   %esi
+  80022e:	ff 75 18             	push   0x18(%ebp)
+  800231:	ff d7                	call   *%edi
+  800233:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800236:	83 eb 01             	sub    $0x1,%ebx
+  800239:	85 db                	test   %ebx,%ebx
+  80023b:	7f ed                	jg     80022a <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80023d:	83 ec 08             	sub    $0x8,%esp
+  800240:	56                   	push   %esi
+  800241:	83 ec 04             	sub    $0x4,%esp
+  800244:	ff 75 e4             	push   -0x1c(%ebp)
+  800247:	ff 75 e0             	push   -0x20(%ebp)
+  80024a:	ff 75 dc             	push   -0x24(%ebp)
+  80024d:	ff 75 d8             	push   -0x28(%ebp)
+  800250:	e8 8e 2b 00 00       	call   802de3 <__umoddi3>
+  800255:	83 c4 14             	add    $0x14,%esp
+  800258:	0f be 80 33 2f 80 00 	movsbl 0x802f33(%eax),%eax
+  80025f:	50                   	push   %eax
+  800260:	ff d7                	call   *%edi
+}
+  800262:	83 c4 10             	add    $0x10,%esp
+  800265:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800268:	5b                   	pop    %ebx
+  800269:	5e                   	pop    %esi
+  80026a:	5f                   	pop    %edi
+  80026b:	5d                   	pop    %ebp
+  80026c:	c3                   	ret
+
+0080026d <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80026d:	55                   	push   %ebp
+  80026e:	89 e5                	mov    %esp,%ebp
+  800270:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800273:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800277:	8b 10                	mov    (%eax),%edx
+  800279:	3b 50 04             	cmp    0x4(%eax),%edx
+  80027c:	73 0a                	jae    800288 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80027e:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800281:	89 08                	mov    %ecx,(%eax)
+  800283:	8b 45 08             	mov    0x8(%ebp),%eax
+  800286:	88 02                	mov    %al,(%edx)
+}
+  800288:	5d                   	pop    %ebp
+  800289:	c3                   	ret
+
+0080028a <printfmt>:
+{
+  80028a:	55                   	push   %ebp
+  80028b:	89 e5                	mov    %esp,%ebp
+  80028d:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800290:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800293:	50                   	push   %eax
+  800294:	ff 75 10             	push   0x10(%ebp)
+  800297:	ff 75 0c             	push   0xc(%ebp)
+  80029a:	ff 75 08             	push   0x8(%ebp)
+  80029d:	e8 05 00 00 00       	call   8002a7 <vprintfmt>
+}
+  8002a2:	83 c4 10             	add    $0x10,%esp
+  8002a5:	c9                   	leave
+  8002a6:	c3                   	ret
+
+008002a7 <vprintfmt>:
+{
+  8002a7:	55                   	push   %ebp
+  8002a8:	89 e5                	mov    %esp,%ebp
+  8002aa:	57                   	push   %edi
+  8002ab:	56                   	push   %esi
+  8002ac:	53                   	push   %ebx
+  8002ad:	83 ec 2c             	sub    $0x2c,%esp
+  8002b0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002b3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002b6:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002b9:	eb 0a                	jmp    8002c5 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002bb:	83 ec 08             	sub    $0x8,%esp
+  8002be:	53                   	push   %ebx
+  8002bf:	50                   	push   %eax
+  8002c0:	ff d6                	call   *%esi
+  8002c2:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002c5:	83 c7 01             	add    $0x1,%edi
+  8002c8:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002cc:	83 f8 25             	cmp    $0x25,%eax
+  8002cf:	74 0c                	je     8002dd <vprintfmt+0x36>
+			if (ch == '\0')
+  8002d1:	85 c0                	test   %eax,%eax
+  8002d3:	75 e6                	jne    8002bb <vprintfmt+0x14>
+}
+  8002d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002d8:	5b                   	pop    %ebx
+  8002d9:	5e                   	pop    %esi
+  8002da:	5f                   	pop    %edi
+  8002db:	5d                   	pop    %ebp
+  8002dc:	c3                   	ret
+		padc = ' ';
+  8002dd:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002e1:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002e8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002ef:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8002fb:	8d 47 01             	lea    0x1(%edi),%eax
+  8002fe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800301:	0f b6 17             	movzbl (%edi),%edx
+  800304:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800307:	3c 55                	cmp    $0x55,%al
+  800309:	0f 87 cf 03 00 00    	ja     8006de <vprintfmt+0x437>
+  80030f:	0f b6 c0             	movzbl %al,%eax
+  800312:	ff 24 85 20 30 80 00 	jmp    *0x803020(,%eax,4)
+  800319:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80031c:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800320:	eb d9                	jmp    8002fb <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800322:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800325:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800329:	eb d0                	jmp    8002fb <vprintfmt+0x54>
+  80032b:	0f b6 d2             	movzbl %dl,%edx
+  80032e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800331:	b8 00 00 00 00       	mov    $0x0,%eax
+  800336:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800339:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80033c:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800340:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800343:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800346:	83 f9 09             	cmp    $0x9,%ecx
+  800349:	77 55                	ja     8003a0 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80034b:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80034e:	eb e9                	jmp    800339 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800350:	8b 45 14             	mov    0x14(%ebp),%eax
+  800353:	8b 00                	mov    (%eax),%eax
+  800355:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800358:	8b 45 14             	mov    0x14(%ebp),%eax
+  80035b:	8d 40 04             	lea    0x4(%eax),%eax
+  80035e:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800361:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800364:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800368:	79 91                	jns    8002fb <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80036a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80036d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800370:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800377:	eb 82                	jmp    8002fb <vprintfmt+0x54>
+			if (width < 0)
+  800379:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80037c:	85 d2                	test   %edx,%edx
+  80037e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800383:	0f 49 c2             	cmovns %edx,%eax
+  800386:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800389:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80038c:	e9 6a ff ff ff       	jmp    8002fb <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800391:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800394:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80039b:	e9 5b ff ff ff       	jmp    8002fb <vprintfmt+0x54>
+  8003a0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003a3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003a6:	eb bc                	jmp    800364 <vprintfmt+0xbd>
+			lflag++;
+  8003a8:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ab:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003ae:	e9 48 ff ff ff       	jmp    8002fb <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b6:	8d 78 04             	lea    0x4(%eax),%edi
+  8003b9:	83 ec 08             	sub    $0x8,%esp
+  8003bc:	53                   	push   %ebx
+  8003bd:	ff 30                	push   (%eax)
+  8003bf:	ff d6                	call   *%esi
+			break;
+  8003c1:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003c4:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003c7:	e9 b1 02 00 00       	jmp    80067d <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8003cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003cf:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003d2:	8b 10                	mov    (%eax),%edx
+  8003d4:	89 d0                	mov    %edx,%eax
+  8003d6:	f7 d8                	neg    %eax
+  8003d8:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003db:	83 f8 0d             	cmp    $0xd,%eax
+  8003de:	7f 23                	jg     800403 <vprintfmt+0x15c>
+  8003e0:	8b 14 85 80 31 80 00 	mov    0x803180(,%eax,4),%edx
+  8003e7:	85 d2                	test   %edx,%edx
+  8003e9:	74 18                	je     800403 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003eb:	52                   	push   %edx
+  8003ec:	68 54 2f 80 00       	push   $0x802f54
+  8003f1:	53                   	push   %ebx
+  8003f2:	56                   	push   %esi
+  8003f3:	e8 92 fe ff ff       	call   80028a <printfmt>
+  8003f8:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003fb:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003fe:	e9 7a 02 00 00       	jmp    80067d <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800403:	50                   	push   %eax
+  800404:	68 4b 2f 80 00       	push   $0x802f4b
+  800409:	53                   	push   %ebx
+  80040a:	56                   	push   %esi
+  80040b:	e8 7a fe ff ff       	call   80028a <printfmt>
+  800410:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800413:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800416:	e9 62 02 00 00       	jmp    80067d <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80041b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80041e:	83 c0 04             	add    $0x4,%eax
+  800421:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800424:	8b 45 14             	mov    0x14(%ebp),%eax
+  800427:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800429:	85 c9                	test   %ecx,%ecx
+  80042b:	b8 44 2f 80 00       	mov    $0x802f44,%eax
+  800430:	0f 45 c1             	cmovne %ecx,%eax
+  800433:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800436:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80043a:	7e 06                	jle    800442 <vprintfmt+0x19b>
+  80043c:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800440:	75 0b                	jne    80044d <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800442:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800445:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800448:	89 75 08             	mov    %esi,0x8(%ebp)
+  80044b:	eb 5c                	jmp    8004a9 <vprintfmt+0x202>
+  80044d:	83 ec 08             	sub    $0x8,%esp
+  800450:	ff 75 d0             	push   -0x30(%ebp)
+  800453:	ff 75 cc             	push   -0x34(%ebp)
+  800456:	e8 20 03 00 00       	call   80077b <strnlen>
+  80045b:	89 c2                	mov    %eax,%edx
+  80045d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800460:	29 d0                	sub    %edx,%eax
+  800462:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800465:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800469:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80046c:	89 75 08             	mov    %esi,0x8(%ebp)
+  80046f:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800471:	eb 0e                	jmp    800481 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800473:	83 ec 08             	sub    $0x8,%esp
+  800476:	53                   	push   %ebx
+  800477:	57                   	push   %edi
+  800478:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80047b:	83 ee 01             	sub    $0x1,%esi
+  80047e:	83 c4 10             	add    $0x10,%esp
+  800481:	85 f6                	test   %esi,%esi
+  800483:	7f ee                	jg     800473 <vprintfmt+0x1cc>
+  800485:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800488:	8b 75 08             	mov    0x8(%ebp),%esi
+  80048b:	85 c0                	test   %eax,%eax
+  80048d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800492:	0f 49 d0             	cmovns %eax,%edx
+  800495:	29 d0                	sub    %edx,%eax
+  800497:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80049a:	eb a6                	jmp    800442 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80049c:	83 ec 08             	sub    $0x8,%esp
+  80049f:	53                   	push   %ebx
+  8004a0:	52                   	push   %edx
+  8004a1:	ff 55 08             	call   *0x8(%ebp)
+  8004a4:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004a7:	89 f1                	mov    %esi,%ecx
+  8004a9:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004ac:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004b0:	0f be d0             	movsbl %al,%edx
+  8004b3:	85 d2                	test   %edx,%edx
+  8004b5:	74 28                	je     8004df <vprintfmt+0x238>
+  8004b7:	85 ff                	test   %edi,%edi
+  8004b9:	78 05                	js     8004c0 <vprintfmt+0x219>
+  8004bb:	83 ef 01             	sub    $0x1,%edi
+  8004be:	78 30                	js     8004f0 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004c0:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004c4:	74 d6                	je     80049c <vprintfmt+0x1f5>
+  8004c6:	0f be c0             	movsbl %al,%eax
+  8004c9:	83 e8 20             	sub    $0x20,%eax
+  8004cc:	83 f8 5e             	cmp    $0x5e,%eax
+  8004cf:	76 cb                	jbe    80049c <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004d1:	83 ec 08             	sub    $0x8,%esp
+  8004d4:	53                   	push   %ebx
+  8004d5:	6a 3f                	push   $0x3f
+  8004d7:	ff 55 08             	call   *0x8(%ebp)
+  8004da:	83 c4 10             	add    $0x10,%esp
+  8004dd:	eb c8                	jmp    8004a7 <vprintfmt+0x200>
+  8004df:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004e2:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004e5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004e8:	01 d0                	add    %edx,%eax
+  8004ea:	29 c8                	sub    %ecx,%eax
+  8004ec:	89 c7                	mov    %eax,%edi
+  8004ee:	eb 13                	jmp    800503 <vprintfmt+0x25c>
+  8004f0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004f3:	eb ed                	jmp    8004e2 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004f5:	83 ec 08             	sub    $0x8,%esp
+  8004f8:	53                   	push   %ebx
+  8004f9:	6a 20                	push   $0x20
+  8004fb:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004fd:	83 ef 01             	sub    $0x1,%edi
+  800500:	83 c4 10             	add    $0x10,%esp
+  800503:	85 ff                	test   %edi,%edi
+  800505:	7f ee                	jg     8004f5 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800507:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80050a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80050d:	e9 6b 01 00 00       	jmp    80067d <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800512:	83 f9 01             	cmp    $0x1,%ecx
+  800515:	7f 1f                	jg     800536 <vprintfmt+0x28f>
+	else if (lflag)
+  800517:	85 c9                	test   %ecx,%ecx
+  800519:	74 67                	je     800582 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80051b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051e:	8b 00                	mov    (%eax),%eax
+  800520:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800523:	89 c1                	mov    %eax,%ecx
+  800525:	c1 f9 1f             	sar    $0x1f,%ecx
+  800528:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80052b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052e:	8d 40 04             	lea    0x4(%eax),%eax
+  800531:	89 45 14             	mov    %eax,0x14(%ebp)
+  800534:	eb 17                	jmp    80054d <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800536:	8b 45 14             	mov    0x14(%ebp),%eax
+  800539:	8b 50 04             	mov    0x4(%eax),%edx
+  80053c:	8b 00                	mov    (%eax),%eax
+  80053e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800541:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800544:	8b 45 14             	mov    0x14(%ebp),%eax
+  800547:	8d 40 08             	lea    0x8(%eax),%eax
+  80054a:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80054d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800550:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800553:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800558:	85 c9                	test   %ecx,%ecx
+  80055a:	0f 89 03 01 00 00    	jns    800663 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800560:	83 ec 08             	sub    $0x8,%esp
+  800563:	53                   	push   %ebx
+  800564:	6a 2d                	push   $0x2d
+  800566:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800568:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80056b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80056e:	f7 da                	neg    %edx
+  800570:	83 d1 00             	adc    $0x0,%ecx
+  800573:	f7 d9                	neg    %ecx
+  800575:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800578:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80057d:	e9 e1 00 00 00       	jmp    800663 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800582:	8b 45 14             	mov    0x14(%ebp),%eax
+  800585:	8b 00                	mov    (%eax),%eax
+  800587:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80058a:	89 c1                	mov    %eax,%ecx
+  80058c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80058f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800592:	8b 45 14             	mov    0x14(%ebp),%eax
+  800595:	8d 40 04             	lea    0x4(%eax),%eax
+  800598:	89 45 14             	mov    %eax,0x14(%ebp)
+  80059b:	eb b0                	jmp    80054d <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80059d:	83 f9 01             	cmp    $0x1,%ecx
+  8005a0:	7f 1e                	jg     8005c0 <vprintfmt+0x319>
+	else if (lflag)
+  8005a2:	85 c9                	test   %ecx,%ecx
+  8005a4:	74 32                	je     8005d8 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8005a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a9:	8b 10                	mov    (%eax),%edx
+  8005ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005b6:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005bb:	e9 a3 00 00 00       	jmp    800663 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c3:	8b 10                	mov    (%eax),%edx
+  8005c5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005c8:	8d 40 08             	lea    0x8(%eax),%eax
+  8005cb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005ce:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005d3:	e9 8b 00 00 00       	jmp    800663 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005db:	8b 10                	mov    (%eax),%edx
+  8005dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005e2:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005e8:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005ed:	eb 74                	jmp    800663 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8005ef:	83 f9 01             	cmp    $0x1,%ecx
+  8005f2:	7f 1b                	jg     80060f <vprintfmt+0x368>
+	else if (lflag)
+  8005f4:	85 c9                	test   %ecx,%ecx
+  8005f6:	74 2c                	je     800624 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8005f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fb:	8b 10                	mov    (%eax),%edx
+  8005fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800602:	8d 40 04             	lea    0x4(%eax),%eax
+  800605:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800608:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80060d:	eb 54                	jmp    800663 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80060f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800612:	8b 10                	mov    (%eax),%edx
+  800614:	8b 48 04             	mov    0x4(%eax),%ecx
+  800617:	8d 40 08             	lea    0x8(%eax),%eax
+  80061a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80061d:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800622:	eb 3f                	jmp    800663 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800624:	8b 45 14             	mov    0x14(%ebp),%eax
+  800627:	8b 10                	mov    (%eax),%edx
+  800629:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80062e:	8d 40 04             	lea    0x4(%eax),%eax
+  800631:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800634:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800639:	eb 28                	jmp    800663 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  80063b:	83 ec 08             	sub    $0x8,%esp
+  80063e:	53                   	push   %ebx
+  80063f:	6a 30                	push   $0x30
+  800641:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800643:	83 c4 08             	add    $0x8,%esp
+  800646:	53                   	push   %ebx
+  800647:	6a 78                	push   $0x78
+  800649:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80064b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064e:	8b 10                	mov    (%eax),%edx
+  800650:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800655:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800658:	8d 40 04             	lea    0x4(%eax),%eax
+  80065b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80065e:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800663:	83 ec 0c             	sub    $0xc,%esp
+  800666:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80066a:	50                   	push   %eax
+  80066b:	ff 75 e0             	push   -0x20(%ebp)
+  80066e:	57                   	push   %edi
+  80066f:	51                   	push   %ecx
+  800670:	52                   	push   %edx
+  800671:	89 da                	mov    %ebx,%edx
+  800673:	89 f0                	mov    %esi,%eax
+  800675:	e8 4a fb ff ff       	call   8001c4 <printnum>
+			break;
+  80067a:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80067d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800680:	e9 40 fc ff ff       	jmp    8002c5 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800685:	83 f9 01             	cmp    $0x1,%ecx
+  800688:	7f 1b                	jg     8006a5 <vprintfmt+0x3fe>
+	else if (lflag)
+  80068a:	85 c9                	test   %ecx,%ecx
+  80068c:	74 2c                	je     8006ba <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  80068e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800691:	8b 10                	mov    (%eax),%edx
+  800693:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800698:	8d 40 04             	lea    0x4(%eax),%eax
+  80069b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80069e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006a3:	eb be                	jmp    800663 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a8:	8b 10                	mov    (%eax),%edx
+  8006aa:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006ad:	8d 40 08             	lea    0x8(%eax),%eax
+  8006b0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006b3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006b8:	eb a9                	jmp    800663 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bd:	8b 10                	mov    (%eax),%edx
+  8006bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006c4:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006ca:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006cf:	eb 92                	jmp    800663 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8006d1:	83 ec 08             	sub    $0x8,%esp
+  8006d4:	53                   	push   %ebx
+  8006d5:	6a 25                	push   $0x25
+  8006d7:	ff d6                	call   *%esi
+			break;
+  8006d9:	83 c4 10             	add    $0x10,%esp
+  8006dc:	eb 9f                	jmp    80067d <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8006de:	83 ec 08             	sub    $0x8,%esp
+  8006e1:	53                   	push   %ebx
+  8006e2:	6a 25                	push   $0x25
+  8006e4:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006e6:	83 c4 10             	add    $0x10,%esp
+  8006e9:	89 f8                	mov    %edi,%eax
+  8006eb:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006ef:	74 05                	je     8006f6 <vprintfmt+0x44f>
+  8006f1:	83 e8 01             	sub    $0x1,%eax
+  8006f4:	eb f5                	jmp    8006eb <vprintfmt+0x444>
+  8006f6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006f9:	eb 82                	jmp    80067d <vprintfmt+0x3d6>
+
+008006fb <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006fb:	55                   	push   %ebp
+  8006fc:	89 e5                	mov    %esp,%ebp
+  8006fe:	83 ec 18             	sub    $0x18,%esp
+  800701:	8b 45 08             	mov    0x8(%ebp),%eax
+  800704:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800707:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80070a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80070e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800711:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800718:	85 c0                	test   %eax,%eax
+  80071a:	74 26                	je     800742 <vsnprintf+0x47>
+  80071c:	85 d2                	test   %edx,%edx
+  80071e:	7e 22                	jle    800742 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800720:	ff 75 14             	push   0x14(%ebp)
+  800723:	ff 75 10             	push   0x10(%ebp)
+  800726:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800729:	50                   	push   %eax
+  80072a:	68 6d 02 80 00       	push   $0x80026d
+  80072f:	e8 73 fb ff ff       	call   8002a7 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800734:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800737:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80073a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80073d:	83 c4 10             	add    $0x10,%esp
+}
+  800740:	c9                   	leave
+  800741:	c3                   	ret
+		return -E_INVAL;
+  800742:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800747:	eb f7                	jmp    800740 <vsnprintf+0x45>
+
+00800749 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800749:	55                   	push   %ebp
+  80074a:	89 e5                	mov    %esp,%ebp
+  80074c:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80074f:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800752:	50                   	push   %eax
+  800753:	ff 75 10             	push   0x10(%ebp)
+  800756:	ff 75 0c             	push   0xc(%ebp)
+  800759:	ff 75 08             	push   0x8(%ebp)
+  80075c:	e8 9a ff ff ff       	call   8006fb <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800761:	c9                   	leave
+  800762:	c3                   	ret
+
+00800763 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800763:	55                   	push   %ebp
+  800764:	89 e5                	mov    %esp,%ebp
+  800766:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800769:	b8 00 00 00 00       	mov    $0x0,%eax
+  80076e:	eb 03                	jmp    800773 <strlen+0x10>
+		n++;
+  800770:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800773:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800777:	75 f7                	jne    800770 <strlen+0xd>
+	return n;
+}
+  800779:	5d                   	pop    %ebp
+  80077a:	c3                   	ret
+
+0080077b <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80077b:	55                   	push   %ebp
+  80077c:	89 e5                	mov    %esp,%ebp
+  80077e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800781:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800784:	b8 00 00 00 00       	mov    $0x0,%eax
+  800789:	eb 03                	jmp    80078e <strnlen+0x13>
+		n++;
+  80078b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80078e:	39 d0                	cmp    %edx,%eax
+  800790:	74 08                	je     80079a <strnlen+0x1f>
+  800792:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800796:	75 f3                	jne    80078b <strnlen+0x10>
+  800798:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80079a:	89 d0                	mov    %edx,%eax
+  80079c:	5d                   	pop    %ebp
+  80079d:	c3                   	ret
+
+0080079e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80079e:	55                   	push   %ebp
+  80079f:	89 e5                	mov    %esp,%ebp
+  8007a1:	53                   	push   %ebx
+  8007a2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007a5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ad:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007b1:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007b4:	83 c0 01             	add    $0x1,%eax
+  8007b7:	84 d2                	test   %dl,%dl
+  8007b9:	75 f2                	jne    8007ad <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007bb:	89 c8                	mov    %ecx,%eax
+  8007bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007c0:	c9                   	leave
+  8007c1:	c3                   	ret
+
+008007c2 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007c2:	55                   	push   %ebp
+  8007c3:	89 e5                	mov    %esp,%ebp
+  8007c5:	53                   	push   %ebx
+  8007c6:	83 ec 10             	sub    $0x10,%esp
+  8007c9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007cc:	53                   	push   %ebx
+  8007cd:	e8 91 ff ff ff       	call   800763 <strlen>
+  8007d2:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007d5:	ff 75 0c             	push   0xc(%ebp)
+  8007d8:	01 d8                	add    %ebx,%eax
+  8007da:	50                   	push   %eax
+  8007db:	e8 be ff ff ff       	call   80079e <strcpy>
+	return dst;
+}
+  8007e0:	89 d8                	mov    %ebx,%eax
+  8007e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007e5:	c9                   	leave
+  8007e6:	c3                   	ret
+
+008007e7 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007e7:	55                   	push   %ebp
+  8007e8:	89 e5                	mov    %esp,%ebp
+  8007ea:	56                   	push   %esi
+  8007eb:	53                   	push   %ebx
+  8007ec:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007ef:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007f2:	89 f3                	mov    %esi,%ebx
+  8007f4:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007f7:	89 f0                	mov    %esi,%eax
+  8007f9:	eb 0f                	jmp    80080a <strncpy+0x23>
+		*dst++ = *src;
+  8007fb:	83 c0 01             	add    $0x1,%eax
+  8007fe:	0f b6 0a             	movzbl (%edx),%ecx
+  800801:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800804:	80 f9 01             	cmp    $0x1,%cl
+  800807:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80080a:	39 d8                	cmp    %ebx,%eax
+  80080c:	75 ed                	jne    8007fb <strncpy+0x14>
+	}
+	return ret;
+}
+  80080e:	89 f0                	mov    %esi,%eax
+  800810:	5b                   	pop    %ebx
+  800811:	5e                   	pop    %esi
+  800812:	5d                   	pop    %ebp
+  800813:	c3                   	ret
+
+00800814 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800814:	55                   	push   %ebp
+  800815:	89 e5                	mov    %esp,%ebp
+  800817:	56                   	push   %esi
+  800818:	53                   	push   %ebx
+  800819:	8b 75 08             	mov    0x8(%ebp),%esi
+  80081c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80081f:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800822:	89 f0                	mov    %esi,%eax
+  800824:	85 d2                	test   %edx,%edx
+  800826:	74 21                	je     800849 <strlcpy+0x35>
+  800828:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80082c:	89 f2                	mov    %esi,%edx
+  80082e:	eb 09                	jmp    800839 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800830:	83 c1 01             	add    $0x1,%ecx
+  800833:	83 c2 01             	add    $0x1,%edx
+  800836:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800839:	39 c2                	cmp    %eax,%edx
+  80083b:	74 09                	je     800846 <strlcpy+0x32>
+  80083d:	0f b6 19             	movzbl (%ecx),%ebx
+  800840:	84 db                	test   %bl,%bl
+  800842:	75 ec                	jne    800830 <strlcpy+0x1c>
+  800844:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800846:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800849:	29 f0                	sub    %esi,%eax
+}
+  80084b:	5b                   	pop    %ebx
+  80084c:	5e                   	pop    %esi
+  80084d:	5d                   	pop    %ebp
+  80084e:	c3                   	ret
+
+0080084f <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80084f:	55                   	push   %ebp
+  800850:	89 e5                	mov    %esp,%ebp
+  800852:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800855:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800858:	eb 06                	jmp    800860 <strcmp+0x11>
+		p++, q++;
+  80085a:	83 c1 01             	add    $0x1,%ecx
+  80085d:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800860:	0f b6 01             	movzbl (%ecx),%eax
+  800863:	84 c0                	test   %al,%al
+  800865:	74 04                	je     80086b <strcmp+0x1c>
+  800867:	3a 02                	cmp    (%edx),%al
+  800869:	74 ef                	je     80085a <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80086b:	0f b6 c0             	movzbl %al,%eax
+  80086e:	0f b6 12             	movzbl (%edx),%edx
+  800871:	29 d0                	sub    %edx,%eax
+}
+  800873:	5d                   	pop    %ebp
+  800874:	c3                   	ret
+
+00800875 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800875:	55                   	push   %ebp
+  800876:	89 e5                	mov    %esp,%ebp
+  800878:	53                   	push   %ebx
+  800879:	8b 45 08             	mov    0x8(%ebp),%eax
+  80087c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80087f:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800882:	eb 09                	jmp    80088d <strncmp+0x18>
+		n--, p++, q++;
+  800884:	83 ea 01             	sub    $0x1,%edx
+  800887:	83 c0 01             	add    $0x1,%eax
+  80088a:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80088d:	85 d2                	test   %edx,%edx
+  80088f:	74 18                	je     8008a9 <strncmp+0x34>
+  800891:	0f b6 18             	movzbl (%eax),%ebx
+  800894:	84 db                	test   %bl,%bl
+  800896:	74 04                	je     80089c <strncmp+0x27>
+  800898:	3a 19                	cmp    (%ecx),%bl
+  80089a:	74 e8                	je     800884 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80089c:	0f b6 00             	movzbl (%eax),%eax
+  80089f:	0f b6 11             	movzbl (%ecx),%edx
+  8008a2:	29 d0                	sub    %edx,%eax
+}
+  8008a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008a7:	c9                   	leave
+  8008a8:	c3                   	ret
+		return 0;
+  8008a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ae:	eb f4                	jmp    8008a4 <strncmp+0x2f>
+
+008008b0 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008b0:	55                   	push   %ebp
+  8008b1:	89 e5                	mov    %esp,%ebp
+  8008b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008ba:	eb 03                	jmp    8008bf <strchr+0xf>
+  8008bc:	83 c0 01             	add    $0x1,%eax
+  8008bf:	0f b6 10             	movzbl (%eax),%edx
+  8008c2:	84 d2                	test   %dl,%dl
+  8008c4:	74 06                	je     8008cc <strchr+0x1c>
+		if (*s == c)
+  8008c6:	38 ca                	cmp    %cl,%dl
+  8008c8:	75 f2                	jne    8008bc <strchr+0xc>
+  8008ca:	eb 05                	jmp    8008d1 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008cc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008d1:	5d                   	pop    %ebp
+  8008d2:	c3                   	ret
+
+008008d3 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008d3:	55                   	push   %ebp
+  8008d4:	89 e5                	mov    %esp,%ebp
+  8008d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008d9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008dd:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008e0:	38 ca                	cmp    %cl,%dl
+  8008e2:	74 09                	je     8008ed <strfind+0x1a>
+  8008e4:	84 d2                	test   %dl,%dl
+  8008e6:	74 05                	je     8008ed <strfind+0x1a>
+	for (; *s; s++)
+  8008e8:	83 c0 01             	add    $0x1,%eax
+  8008eb:	eb f0                	jmp    8008dd <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008ed:	5d                   	pop    %ebp
+  8008ee:	c3                   	ret
+
+008008ef <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008ef:	55                   	push   %ebp
+  8008f0:	89 e5                	mov    %esp,%ebp
+  8008f2:	57                   	push   %edi
+  8008f3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008f6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008f9:	85 c9                	test   %ecx,%ecx
+  8008fb:	74 20                	je     80091d <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008fd:	89 f8                	mov    %edi,%eax
+  8008ff:	09 c8                	or     %ecx,%eax
+  800901:	a8 03                	test   $0x3,%al
+  800903:	75 12                	jne    800917 <memset+0x28>
+		c &= 0xFF;
+  800905:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800909:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80090f:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800912:	fc                   	cld
+  800913:	f3 ab                	rep stos %eax,%es:(%edi)
+  800915:	eb 06                	jmp    80091d <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800917:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80091a:	fc                   	cld
+  80091b:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80091d:	89 f8                	mov    %edi,%eax
+  80091f:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800922:	c9                   	leave
+  800923:	c3                   	ret
+
+00800924 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800924:	55                   	push   %ebp
+  800925:	89 e5                	mov    %esp,%ebp
+  800927:	57                   	push   %edi
+  800928:	56                   	push   %esi
+  800929:	8b 45 08             	mov    0x8(%ebp),%eax
+  80092c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80092f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800932:	39 c6                	cmp    %eax,%esi
+  800934:	73 32                	jae    800968 <memmove+0x44>
+  800936:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800939:	39 d0                	cmp    %edx,%eax
+  80093b:	73 2b                	jae    800968 <memmove+0x44>
+		s += n;
+		d += n;
+  80093d:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800940:	89 d6                	mov    %edx,%esi
+  800942:	09 fe                	or     %edi,%esi
+  800944:	09 ce                	or     %ecx,%esi
+  800946:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80094c:	75 0e                	jne    80095c <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80094e:	83 ef 04             	sub    $0x4,%edi
+  800951:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800954:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800957:	fd                   	std
+  800958:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80095a:	eb 09                	jmp    800965 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80095c:	83 ef 01             	sub    $0x1,%edi
+  80095f:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800962:	fd                   	std
+  800963:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800965:	fc                   	cld
+  800966:	eb 1a                	jmp    800982 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800968:	89 f2                	mov    %esi,%edx
+  80096a:	09 c2                	or     %eax,%edx
+  80096c:	09 ca                	or     %ecx,%edx
+  80096e:	f6 c2 03             	test   $0x3,%dl
+  800971:	75 0a                	jne    80097d <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800973:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800976:	89 c7                	mov    %eax,%edi
+  800978:	fc                   	cld
+  800979:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80097b:	eb 05                	jmp    800982 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80097d:	89 c7                	mov    %eax,%edi
+  80097f:	fc                   	cld
+  800980:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800982:	5e                   	pop    %esi
+  800983:	5f                   	pop    %edi
+  800984:	5d                   	pop    %ebp
+  800985:	c3                   	ret
+
+00800986 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800986:	55                   	push   %ebp
+  800987:	89 e5                	mov    %esp,%ebp
+  800989:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80098c:	ff 75 10             	push   0x10(%ebp)
+  80098f:	ff 75 0c             	push   0xc(%ebp)
+  800992:	ff 75 08             	push   0x8(%ebp)
+  800995:	e8 8a ff ff ff       	call   800924 <memmove>
+}
+  80099a:	c9                   	leave
+  80099b:	c3                   	ret
+
+0080099c <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80099c:	55                   	push   %ebp
+  80099d:	89 e5                	mov    %esp,%ebp
+  80099f:	56                   	push   %esi
+  8009a0:	53                   	push   %ebx
+  8009a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009a7:	89 c6                	mov    %eax,%esi
+  8009a9:	03 75 10             	add    0x10(%ebp),%esi
+  8009ac:	eb 06                	jmp    8009b4 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009ae:	83 c0 01             	add    $0x1,%eax
+  8009b1:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009b4:	39 f0                	cmp    %esi,%eax
+  8009b6:	74 14                	je     8009cc <memcmp+0x30>
+		if (*s1 != *s2)
+  8009b8:	0f b6 08             	movzbl (%eax),%ecx
+  8009bb:	0f b6 1a             	movzbl (%edx),%ebx
+  8009be:	38 d9                	cmp    %bl,%cl
+  8009c0:	74 ec                	je     8009ae <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009c2:	0f b6 c1             	movzbl %cl,%eax
+  8009c5:	0f b6 db             	movzbl %bl,%ebx
+  8009c8:	29 d8                	sub    %ebx,%eax
+  8009ca:	eb 05                	jmp    8009d1 <memcmp+0x35>
+	}
+
+	return 0;
+  8009cc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009d1:	5b                   	pop    %ebx
+  8009d2:	5e                   	pop    %esi
+  8009d3:	5d                   	pop    %ebp
+  8009d4:	c3                   	ret
+
+008009d5 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009d5:	55                   	push   %ebp
+  8009d6:	89 e5                	mov    %esp,%ebp
+  8009d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009de:	89 c2                	mov    %eax,%edx
+  8009e0:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009e3:	eb 03                	jmp    8009e8 <memfind+0x13>
+  8009e5:	83 c0 01             	add    $0x1,%eax
+  8009e8:	39 d0                	cmp    %edx,%eax
+  8009ea:	73 04                	jae    8009f0 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009ec:	38 08                	cmp    %cl,(%eax)
+  8009ee:	75 f5                	jne    8009e5 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009f0:	5d                   	pop    %ebp
+  8009f1:	c3                   	ret
+
+008009f2 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009f2:	55                   	push   %ebp
+  8009f3:	89 e5                	mov    %esp,%ebp
+  8009f5:	57                   	push   %edi
+  8009f6:	56                   	push   %esi
+  8009f7:	53                   	push   %ebx
+  8009f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009fb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009fe:	eb 03                	jmp    800a03 <strtol+0x11>
+		s++;
+  800a00:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a03:	0f b6 02             	movzbl (%edx),%eax
+  800a06:	3c 20                	cmp    $0x20,%al
+  800a08:	74 f6                	je     800a00 <strtol+0xe>
+  800a0a:	3c 09                	cmp    $0x9,%al
+  800a0c:	74 f2                	je     800a00 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a0e:	3c 2b                	cmp    $0x2b,%al
+  800a10:	74 2a                	je     800a3c <strtol+0x4a>
+	int neg = 0;
+  800a12:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a17:	3c 2d                	cmp    $0x2d,%al
+  800a19:	74 2b                	je     800a46 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a1b:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a21:	75 0f                	jne    800a32 <strtol+0x40>
+  800a23:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a26:	74 28                	je     800a50 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a28:	85 db                	test   %ebx,%ebx
+  800a2a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a2f:	0f 44 d8             	cmove  %eax,%ebx
+  800a32:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a37:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a3a:	eb 46                	jmp    800a82 <strtol+0x90>
+		s++;
+  800a3c:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a44:	eb d5                	jmp    800a1b <strtol+0x29>
+		s++, neg = 1;
+  800a46:	83 c2 01             	add    $0x1,%edx
+  800a49:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a4e:	eb cb                	jmp    800a1b <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a50:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a54:	74 0e                	je     800a64 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a56:	85 db                	test   %ebx,%ebx
+  800a58:	75 d8                	jne    800a32 <strtol+0x40>
+		s++, base = 8;
+  800a5a:	83 c2 01             	add    $0x1,%edx
+  800a5d:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a62:	eb ce                	jmp    800a32 <strtol+0x40>
+		s += 2, base = 16;
+  800a64:	83 c2 02             	add    $0x2,%edx
+  800a67:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a6c:	eb c4                	jmp    800a32 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a6e:	0f be c0             	movsbl %al,%eax
+  800a71:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a74:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a77:	7d 3a                	jge    800ab3 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a79:	83 c2 01             	add    $0x1,%edx
+  800a7c:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a80:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a82:	0f b6 02             	movzbl (%edx),%eax
+  800a85:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a88:	89 f3                	mov    %esi,%ebx
+  800a8a:	80 fb 09             	cmp    $0x9,%bl
+  800a8d:	76 df                	jbe    800a6e <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a8f:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a92:	89 f3                	mov    %esi,%ebx
+  800a94:	80 fb 19             	cmp    $0x19,%bl
+  800a97:	77 08                	ja     800aa1 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a99:	0f be c0             	movsbl %al,%eax
+  800a9c:	83 e8 57             	sub    $0x57,%eax
+  800a9f:	eb d3                	jmp    800a74 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800aa1:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800aa4:	89 f3                	mov    %esi,%ebx
+  800aa6:	80 fb 19             	cmp    $0x19,%bl
+  800aa9:	77 08                	ja     800ab3 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800aab:	0f be c0             	movsbl %al,%eax
+  800aae:	83 e8 37             	sub    $0x37,%eax
+  800ab1:	eb c1                	jmp    800a74 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ab3:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ab7:	74 05                	je     800abe <strtol+0xcc>
+		*endptr = (char *) s;
+  800ab9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800abc:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800abe:	89 c8                	mov    %ecx,%eax
+  800ac0:	f7 d8                	neg    %eax
+  800ac2:	85 ff                	test   %edi,%edi
+  800ac4:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ac7:	89 c8                	mov    %ecx,%eax
+  800ac9:	5b                   	pop    %ebx
+  800aca:	5e                   	pop    %esi
+  800acb:	5f                   	pop    %edi
+  800acc:	5d                   	pop    %ebp
+  800acd:	c3                   	ret
+
+00800ace <atoi>:
+
+int
+atoi(const char *s)
+{
+  800ace:	55                   	push   %ebp
+  800acf:	89 e5                	mov    %esp,%ebp
+  800ad1:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800ad4:	6a 0a                	push   $0xa
+  800ad6:	6a 00                	push   $0x0
+  800ad8:	ff 75 08             	push   0x8(%ebp)
+  800adb:	e8 12 ff ff ff       	call   8009f2 <strtol>
+}
+  800ae0:	c9                   	leave
+  800ae1:	c3                   	ret
+
+00800ae2 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800ae2:	55                   	push   %ebp
+  800ae3:	89 e5                	mov    %esp,%ebp
+  800ae5:	57                   	push   %edi
+  800ae6:	56                   	push   %esi
+  800ae7:	53                   	push   %ebx
+  800ae8:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800aee:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800af4:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800afa:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800b00:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800b07:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800b0a:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800b11:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800b14:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800b1b:	74 76                	je     800b93 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800b1d:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800b23:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b26:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800b2c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800b33:	0f 88 06 01 00 00    	js     800c3f <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800b39:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800b40:	0f 84 48 01 00 00    	je     800c8e <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800b46:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800b4c:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800b52:	be 00 00 00 00       	mov    $0x0,%esi
+  800b57:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800b5d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b60:	55                   	push   %ebp
+  800b61:	68 6a 0b 80 00       	push   $0x800b6a
+  800b66:	89 e5                	mov    %esp,%ebp
+  800b68:	0f 34                	sysenter
+  800b6a:	83 c4 04             	add    $0x4,%esp
+  800b6d:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800b6e:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800b74:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800b7a:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800b7d:	0f 85 9a 01 00 00    	jne    800d1d <page_vec_call+0x23b>
+  800b83:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b88:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b8b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b8e:	e9 29 01 00 00       	jmp    800cbc <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800b93:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800b99:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b9c:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800b9e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800ba5:	78 2f                	js     800bd6 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800ba7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800bae:	74 72                	je     800c22 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800bb0:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800bb6:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800bbc:	b8 10 00 00 00       	mov    $0x10,%eax
+  800bc1:	89 fb                	mov    %edi,%ebx
+  800bc3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800bc6:	55                   	push   %ebp
+  800bc7:	68 d0 0b 80 00       	push   $0x800bd0
+  800bcc:	89 e5                	mov    %esp,%ebp
+  800bce:	0f 34                	sysenter
+  800bd0:	83 c4 04             	add    $0x4,%esp
+  800bd3:	5d                   	pop    %ebp
+	return ret;
+  800bd4:	eb 98                	jmp    800b6e <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800bd6:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bdb:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800bdd:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800be2:	f6 c6 08             	test   $0x8,%dh
+  800be5:	74 15                	je     800bfc <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800be7:	89 c2                	mov    %eax,%edx
+  800be9:	c1 ea 08             	shr    $0x8,%edx
+  800bec:	83 e2 0f             	and    $0xf,%edx
+  800bef:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800bf4:	83 fa 06             	cmp    $0x6,%edx
+  800bf7:	74 0e                	je     800c07 <page_vec_call+0x125>
+  800bf9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800bfc:	0f b6 c9             	movzbl %cl,%ecx
+  800bff:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800c05:	eb a0                	jmp    800ba7 <page_vec_call+0xc5>
+  800c07:	89 c2                	mov    %eax,%edx
+  800c09:	c1 ea 04             	shr    $0x4,%edx
+  800c0c:	83 e2 0f             	and    $0xf,%edx
+  800c0f:	83 fa 02             	cmp    $0x2,%edx
+  800c12:	77 e5                	ja     800bf9 <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800c14:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c17:	83 f8 02             	cmp    $0x2,%eax
+  800c1a:	0f 97 c1             	seta   %cl
+  800c1d:	0f b6 c9             	movzbl %cl,%ecx
+  800c20:	eb d7                	jmp    800bf9 <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800c22:	b8 10 00 00 00       	mov    $0x10,%eax
+  800c27:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800c2d:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800c33:	89 fb                	mov    %edi,%ebx
+  800c35:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c38:	cd 30                	int    $0x30
+  800c3a:	e9 2f ff ff ff       	jmp    800b6e <page_vec_call+0x8c>
+  800c3f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c44:	0f a2                	cpuid
+		return 0;
+  800c46:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800c4b:	f6 c6 08             	test   $0x8,%dh
+  800c4e:	74 15                	je     800c65 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c50:	89 c2                	mov    %eax,%edx
+  800c52:	c1 ea 08             	shr    $0x8,%edx
+  800c55:	83 e2 0f             	and    $0xf,%edx
+  800c58:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800c5d:	83 fa 06             	cmp    $0x6,%edx
+  800c60:	74 11                	je     800c73 <page_vec_call+0x191>
+  800c62:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800c65:	0f b6 c9             	movzbl %cl,%ecx
+  800c68:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800c6e:	e9 c6 fe ff ff       	jmp    800b39 <page_vec_call+0x57>
+  800c73:	89 c2                	mov    %eax,%edx
+  800c75:	c1 ea 04             	shr    $0x4,%edx
+  800c78:	83 e2 0f             	and    $0xf,%edx
+  800c7b:	83 fa 02             	cmp    $0x2,%edx
+  800c7e:	77 e2                	ja     800c62 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800c80:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c83:	83 f8 02             	cmp    $0x2,%eax
+  800c86:	0f 97 c1             	seta   %cl
+  800c89:	0f b6 c9             	movzbl %cl,%ecx
+  800c8c:	eb d4                	jmp    800c62 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800c8e:	be 00 00 00 00       	mov    $0x0,%esi
+  800c93:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800c99:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800c9f:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800ca5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ca8:	cd 30                	int    $0x30
+  800caa:	e9 bf fe ff ff       	jmp    800b6e <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800caf:	29 da                	sub    %ebx,%edx
+			vec++;
+  800cb1:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800cb4:	83 e8 01             	sub    $0x1,%eax
+  800cb7:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800cbc:	85 c0                	test   %eax,%eax
+  800cbe:	74 58                	je     800d18 <page_vec_call+0x236>
+  800cc0:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800cc3:	39 da                	cmp    %ebx,%edx
+  800cc5:	73 e8                	jae    800caf <page_vec_call+0x1cd>
+  800cc7:	89 75 08             	mov    %esi,0x8(%ebp)
+  800cca:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800ccd:	84 c9                	test   %cl,%cl
+  800ccf:	74 06                	je     800cd7 <page_vec_call+0x1f5>
+  800cd1:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800cd7:	83 ec 04             	sub    $0x4,%esp
+  800cda:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cdd:	c1 e0 04             	shl    $0x4,%eax
+  800ce0:	50                   	push   %eax
+  800ce1:	ff 75 08             	push   0x8(%ebp)
+  800ce4:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800cea:	53                   	push   %ebx
+  800ceb:	e8 34 fc ff ff       	call   800924 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800cf0:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800cf6:	89 c2                	mov    %eax,%edx
+  800cf8:	c1 e2 0c             	shl    $0xc,%edx
+  800cfb:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  800d01:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  800d07:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  800d0d:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  800d10:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  800d13:	e9 f2 fd ff ff       	jmp    800b0a <page_vec_call+0x28>
+			r = 0;
+  800d18:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  800d1d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800d21:	74 0b                	je     800d2e <page_vec_call+0x24c>
+		*done = total;
+  800d23:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800d26:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  800d2c:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  800d2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d31:	5b                   	pop    %ebx
+  800d32:	5e                   	pop    %esi
+  800d33:	5f                   	pop    %edi
+  800d34:	5d                   	pop    %ebp
+  800d35:	c3                   	ret
+
+00800d36 <sys_cputs>:
+{
+  800d36:	55                   	push   %ebp
+  800d37:	89 e5                	mov    %esp,%ebp
+  800d39:	57                   	push   %edi
+  800d3a:	56                   	push   %esi
+  800d3b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800d3c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800d43:	78 2d                	js     800d72 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800d45:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800d4c:	74 70                	je     800dbe <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800d4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d53:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d56:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d59:	89 c3                	mov    %eax,%ebx
+  800d5b:	89 c7                	mov    %eax,%edi
+  800d5d:	89 c6                	mov    %eax,%esi
+  800d5f:	55                   	push   %ebp
+  800d60:	68 69 0d 80 00       	push   $0x800d69
+  800d65:	89 e5                	mov    %esp,%ebp
+  800d67:	0f 34                	sysenter
+  800d69:	83 c4 04             	add    $0x4,%esp
+  800d6c:	5d                   	pop    %ebp
+}
+  800d6d:	5b                   	pop    %ebx
+  800d6e:	5e                   	pop    %esi
+  800d6f:	5f                   	pop    %edi
+  800d70:	5d                   	pop    %ebp
+  800d71:	c3                   	ret
+  800d72:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d77:	0f a2                	cpuid
+		return 0;
+  800d79:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800d7e:	f6 c6 08             	test   $0x8,%dh
+  800d81:	74 15                	je     800d98 <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d83:	89 c2                	mov    %eax,%edx
+  800d85:	c1 ea 08             	shr    $0x8,%edx
+  800d88:	83 e2 0f             	and    $0xf,%edx
+  800d8b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d90:	83 fa 06             	cmp    $0x6,%edx
+  800d93:	74 0e                	je     800da3 <sys_cputs+0x6d>
+  800d95:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800d98:	0f b6 c9             	movzbl %cl,%ecx
+  800d9b:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800da1:	eb a2                	jmp    800d45 <sys_cputs+0xf>
+  800da3:	89 c2                	mov    %eax,%edx
+  800da5:	c1 ea 04             	shr    $0x4,%edx
+  800da8:	83 e2 0f             	and    $0xf,%edx
+  800dab:	83 fa 02             	cmp    $0x2,%edx
+  800dae:	77 e5                	ja     800d95 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800db0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800db3:	83 f8 02             	cmp    $0x2,%eax
+  800db6:	0f 97 c1             	seta   %cl
+  800db9:	0f b6 c9             	movzbl %cl,%ecx
+  800dbc:	eb d7                	jmp    800d95 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800dbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc9:	89 c3                	mov    %eax,%ebx
+  800dcb:	89 c7                	mov    %eax,%edi
+  800dcd:	89 c6                	mov    %eax,%esi
+  800dcf:	cd 30                	int    $0x30
+}
+  800dd1:	eb 9a                	jmp    800d6d <sys_cputs+0x37>
+
+00800dd3 <sys_cgetc>:
+{
+  800dd3:	55                   	push   %ebp
+  800dd4:	89 e5                	mov    %esp,%ebp
+  800dd6:	57                   	push   %edi
+  800dd7:	56                   	push   %esi
+  800dd8:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800dd9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800de0:	78 2e                	js     800e10 <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  800de2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800de9:	74 71                	je     800e5c <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  800deb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800df0:	b8 01 00 00 00       	mov    $0x1,%eax
+  800df5:	89 d1                	mov    %edx,%ecx
+  800df7:	89 d3                	mov    %edx,%ebx
+  800df9:	89 d7                	mov    %edx,%edi
+  800dfb:	89 d6                	mov    %edx,%esi
+  800dfd:	55                   	push   %ebp
+  800dfe:	68 07 0e 80 00       	push   $0x800e07
+  800e03:	89 e5                	mov    %esp,%ebp
+  800e05:	0f 34                	sysenter
+  800e07:	83 c4 04             	add    $0x4,%esp
+  800e0a:	5d                   	pop    %ebp
+}
+  800e0b:	5b                   	pop    %ebx
+  800e0c:	5e                   	pop    %esi
+  800e0d:	5f                   	pop    %edi
+  800e0e:	5d                   	pop    %ebp
+  800e0f:	c3                   	ret
+  800e10:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e15:	0f a2                	cpuid
+		return 0;
+  800e17:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800e1c:	f6 c6 08             	test   $0x8,%dh
+  800e1f:	74 15                	je     800e36 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e21:	89 c2                	mov    %eax,%edx
+  800e23:	c1 ea 08             	shr    $0x8,%edx
+  800e26:	83 e2 0f             	and    $0xf,%edx
+  800e29:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e2e:	83 fa 06             	cmp    $0x6,%edx
+  800e31:	74 0e                	je     800e41 <sys_cgetc+0x6e>
+  800e33:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e36:	0f b6 c9             	movzbl %cl,%ecx
+  800e39:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800e3f:	eb a1                	jmp    800de2 <sys_cgetc+0xf>
+  800e41:	89 c2                	mov    %eax,%edx
+  800e43:	c1 ea 04             	shr    $0x4,%edx
+  800e46:	83 e2 0f             	and    $0xf,%edx
+  800e49:	83 fa 02             	cmp    $0x2,%edx
+  800e4c:	77 e5                	ja     800e33 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  800e4e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e51:	83 f8 02             	cmp    $0x2,%eax
+  800e54:	0f 97 c1             	seta   %cl
+  800e57:	0f b6 c9             	movzbl %cl,%ecx
+  800e5a:	eb d7                	jmp    800e33 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  800e5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e61:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e66:	89 d1                	mov    %edx,%ecx
+  800e68:	89 d3                	mov    %edx,%ebx
+  800e6a:	89 d7                	mov    %edx,%edi
+  800e6c:	89 d6                	mov    %edx,%esi
+  800e6e:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800e70:	eb 99                	jmp    800e0b <sys_cgetc+0x38>
+
+00800e72 <sys_env_destroy>:
+{
+  800e72:	55                   	push   %ebp
+  800e73:	89 e5                	mov    %esp,%ebp
+  800e75:	57                   	push   %edi
+  800e76:	56                   	push   %esi
+  800e77:	53                   	push   %ebx
+  800e78:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800e7b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e82:	78 36                	js     800eba <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  800e84:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e8b:	74 79                	je     800f06 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  800e8d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e90:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e95:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e9a:	89 cb                	mov    %ecx,%ebx
+  800e9c:	89 cf                	mov    %ecx,%edi
+  800e9e:	89 ce                	mov    %ecx,%esi
+  800ea0:	55                   	push   %ebp
+  800ea1:	68 aa 0e 80 00       	push   $0x800eaa
+  800ea6:	89 e5                	mov    %esp,%ebp
+  800ea8:	0f 34                	sysenter
+  800eaa:	83 c4 04             	add    $0x4,%esp
+  800ead:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800eae:	85 c0                	test   %eax,%eax
+  800eb0:	7f 6b                	jg     800f1d <sys_env_destroy+0xab>
+}
+  800eb2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eb5:	5b                   	pop    %ebx
+  800eb6:	5e                   	pop    %esi
+  800eb7:	5f                   	pop    %edi
+  800eb8:	5d                   	pop    %ebp
+  800eb9:	c3                   	ret
+  800eba:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ebf:	0f a2                	cpuid
+		return 0;
+  800ec1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800ec6:	f6 c6 08             	test   $0x8,%dh
+  800ec9:	74 15                	je     800ee0 <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ecb:	89 c2                	mov    %eax,%edx
+  800ecd:	c1 ea 08             	shr    $0x8,%edx
+  800ed0:	83 e2 0f             	and    $0xf,%edx
+  800ed3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ed8:	83 fa 06             	cmp    $0x6,%edx
+  800edb:	74 0e                	je     800eeb <sys_env_destroy+0x79>
+  800edd:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800ee0:	0f b6 c9             	movzbl %cl,%ecx
+  800ee3:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800ee9:	eb 99                	jmp    800e84 <sys_env_destroy+0x12>
+  800eeb:	89 c2                	mov    %eax,%edx
+  800eed:	c1 ea 04             	shr    $0x4,%edx
+  800ef0:	83 e2 0f             	and    $0xf,%edx
+  800ef3:	83 fa 02             	cmp    $0x2,%edx
+  800ef6:	77 e5                	ja     800edd <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  800ef8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800efb:	83 f8 02             	cmp    $0x2,%eax
+  800efe:	0f 97 c1             	seta   %cl
+  800f01:	0f b6 c9             	movzbl %cl,%ecx
+  800f04:	eb d7                	jmp    800edd <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  800f06:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f0b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f10:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f13:	89 cb                	mov    %ecx,%ebx
+  800f15:	89 cf                	mov    %ecx,%edi
+  800f17:	89 ce                	mov    %ecx,%esi
+  800f19:	cd 30                	int    $0x30
+  800f1b:	eb 91                	jmp    800eae <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f1d:	83 ec 0c             	sub    $0xc,%esp
+  800f20:	50                   	push   %eax
+  800f21:	6a 03                	push   $0x3
+  800f23:	68 f9 31 80 00       	push   $0x8031f9
+  800f28:	6a 4a                	push   $0x4a
+  800f2a:	68 16 32 80 00       	push   $0x803216
+  800f2f:	e8 b2 1c 00 00       	call   802be6 <_panic>
+
+00800f34 <sys_getenvid>:
+{
+  800f34:	55                   	push   %ebp
+  800f35:	89 e5                	mov    %esp,%ebp
+  800f37:	57                   	push   %edi
+  800f38:	56                   	push   %esi
+  800f39:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800f3a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800f41:	78 2e                	js     800f71 <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  800f43:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800f4a:	74 71                	je     800fbd <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  800f4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f51:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f56:	89 d1                	mov    %edx,%ecx
+  800f58:	89 d3                	mov    %edx,%ebx
+  800f5a:	89 d7                	mov    %edx,%edi
+  800f5c:	89 d6                	mov    %edx,%esi
+  800f5e:	55                   	push   %ebp
+  800f5f:	68 68 0f 80 00       	push   $0x800f68
+  800f64:	89 e5                	mov    %esp,%ebp
+  800f66:	0f 34                	sysenter
+  800f68:	83 c4 04             	add    $0x4,%esp
+  800f6b:	5d                   	pop    %ebp
+}
+  800f6c:	5b                   	pop    %ebx
+  800f6d:	5e                   	pop    %esi
+  800f6e:	5f                   	pop    %edi
+  800f6f:	5d                   	pop    %ebp
+  800f70:	c3                   	ret
+  800f71:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f76:	0f a2                	cpuid
+		return 0;
+  800f78:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f7d:	f6 c6 08             	test   $0x8,%dh
+  800f80:	74 15                	je     800f97 <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f82:	89 c2                	mov    %eax,%edx
+  800f84:	c1 ea 08             	shr    $0x8,%edx
+  800f87:	83 e2 0f             	and    $0xf,%edx
+  800f8a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f8f:	83 fa 06             	cmp    $0x6,%edx
+  800f92:	74 0e                	je     800fa2 <sys_getenvid+0x6e>
+  800f94:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f97:	0f b6 c9             	movzbl %cl,%ecx
+  800f9a:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800fa0:	eb a1                	jmp    800f43 <sys_getenvid+0xf>
+  800fa2:	89 c2                	mov    %eax,%edx
+  800fa4:	c1 ea 04             	shr    $0x4,%edx
+  800fa7:	83 e2 0f             	and    $0xf,%edx
+  800faa:	83 fa 02             	cmp    $0x2,%edx
+  800fad:	77 e5                	ja     800f94 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  800faf:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800fb2:	83 f8 02             	cmp    $0x2,%eax
+  800fb5:	0f 97 c1             	seta   %cl
+  800fb8:	0f b6 c9             	movzbl %cl,%ecx
+  800fbb:	eb d7                	jmp    800f94 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  800fbd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fc2:	b8 02 00 00 00       	mov    $0x2,%eax
+  800fc7:	89 d1                	mov    %edx,%ecx
+  800fc9:	89 d3                	mov    %edx,%ebx
+  800fcb:	89 d7                	mov    %edx,%edi
+  800fcd:	89 d6                	mov    %edx,%esi
+  800fcf:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  800fd1:	eb 99                	jmp    800f6c <sys_getenvid+0x38>
+
+00800fd3 <sys_page_alloc>:
+{
+  800fd3:	55                   	push   %ebp
+  800fd4:	89 e5                	mov    %esp,%ebp
+  800fd6:	57                   	push   %edi
+  800fd7:	56                   	push   %esi
+  800fd8:	53                   	push   %ebx
+  800fd9:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800fdc:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800fe3:	78 38                	js     80101d <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  800fe5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800fec:	74 7b                	je     801069 <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  800fee:	be 00 00 00 00       	mov    $0x0,%esi
+  800ff3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff9:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ffe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801001:	89 f7                	mov    %esi,%edi
+  801003:	55                   	push   %ebp
+  801004:	68 0d 10 80 00       	push   $0x80100d
+  801009:	89 e5                	mov    %esp,%ebp
+  80100b:	0f 34                	sysenter
+  80100d:	83 c4 04             	add    $0x4,%esp
+  801010:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801011:	85 c0                	test   %eax,%eax
+  801013:	7f 6d                	jg     801082 <sys_page_alloc+0xaf>
+}
+  801015:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801018:	5b                   	pop    %ebx
+  801019:	5e                   	pop    %esi
+  80101a:	5f                   	pop    %edi
+  80101b:	5d                   	pop    %ebp
+  80101c:	c3                   	ret
+  80101d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801022:	0f a2                	cpuid
+		return 0;
+  801024:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801029:	f6 c6 08             	test   $0x8,%dh
+  80102c:	74 15                	je     801043 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80102e:	89 c2                	mov    %eax,%edx
+  801030:	c1 ea 08             	shr    $0x8,%edx
+  801033:	83 e2 0f             	and    $0xf,%edx
+  801036:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80103b:	83 fa 06             	cmp    $0x6,%edx
+  80103e:	74 0e                	je     80104e <sys_page_alloc+0x7b>
+  801040:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801043:	0f b6 c9             	movzbl %cl,%ecx
+  801046:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80104c:	eb 97                	jmp    800fe5 <sys_page_alloc+0x12>
+  80104e:	89 c2                	mov    %eax,%edx
+  801050:	c1 ea 04             	shr    $0x4,%edx
+  801053:	83 e2 0f             	and    $0xf,%edx
+  801056:	83 fa 02             	cmp    $0x2,%edx
+  801059:	77 e5                	ja     801040 <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  80105b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80105e:	83 f8 02             	cmp    $0x2,%eax
+  801061:	0f 97 c1             	seta   %cl
+  801064:	0f b6 c9             	movzbl %cl,%ecx
+  801067:	eb d7                	jmp    801040 <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  801069:	be 00 00 00 00       	mov    $0x0,%esi
+  80106e:	b8 04 00 00 00       	mov    $0x4,%eax
+  801073:	8b 55 08             	mov    0x8(%ebp),%edx
+  801076:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801079:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80107c:	89 f7                	mov    %esi,%edi
+  80107e:	cd 30                	int    $0x30
+  801080:	eb 8f                	jmp    801011 <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801082:	83 ec 0c             	sub    $0xc,%esp
+  801085:	50                   	push   %eax
+  801086:	6a 04                	push   $0x4
+  801088:	68 f9 31 80 00       	push   $0x8031f9
+  80108d:	6a 4a                	push   $0x4a
+  80108f:	68 16 32 80 00       	push   $0x803216
+  801094:	e8 4d 1b 00 00       	call   802be6 <_panic>
+
+00801099 <sys_page_map>:
+{
+  801099:	55                   	push   %ebp
+  80109a:	89 e5                	mov    %esp,%ebp
+  80109c:	57                   	push   %edi
+  80109d:	56                   	push   %esi
+  80109e:	53                   	push   %ebx
+  80109f:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8010a2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8010a9:	78 37                	js     8010e2 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  8010ab:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8010b2:	74 7a                	je     80112e <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  8010b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ba:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010bf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010c2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010c5:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010c8:	55                   	push   %ebp
+  8010c9:	68 d2 10 80 00       	push   $0x8010d2
+  8010ce:	89 e5                	mov    %esp,%ebp
+  8010d0:	0f 34                	sysenter
+  8010d2:	83 c4 04             	add    $0x4,%esp
+  8010d5:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8010d6:	85 c0                	test   %eax,%eax
+  8010d8:	7f 6c                	jg     801146 <sys_page_map+0xad>
+}
+  8010da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010dd:	5b                   	pop    %ebx
+  8010de:	5e                   	pop    %esi
+  8010df:	5f                   	pop    %edi
+  8010e0:	5d                   	pop    %ebp
+  8010e1:	c3                   	ret
+  8010e2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010e7:	0f a2                	cpuid
+		return 0;
+  8010e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8010ee:	f6 c6 08             	test   $0x8,%dh
+  8010f1:	74 15                	je     801108 <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010f3:	89 c2                	mov    %eax,%edx
+  8010f5:	c1 ea 08             	shr    $0x8,%edx
+  8010f8:	83 e2 0f             	and    $0xf,%edx
+  8010fb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801100:	83 fa 06             	cmp    $0x6,%edx
+  801103:	74 0e                	je     801113 <sys_page_map+0x7a>
+  801105:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801108:	0f b6 c9             	movzbl %cl,%ecx
+  80110b:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801111:	eb 98                	jmp    8010ab <sys_page_map+0x12>
+  801113:	89 c2                	mov    %eax,%edx
+  801115:	c1 ea 04             	shr    $0x4,%edx
+  801118:	83 e2 0f             	and    $0xf,%edx
+  80111b:	83 fa 02             	cmp    $0x2,%edx
+  80111e:	77 e5                	ja     801105 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  801120:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801123:	83 f8 02             	cmp    $0x2,%eax
+  801126:	0f 97 c1             	seta   %cl
+  801129:	0f b6 c9             	movzbl %cl,%ecx
+  80112c:	eb d7                	jmp    801105 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  80112e:	b8 05 00 00 00       	mov    $0x5,%eax
+  801133:	8b 55 08             	mov    0x8(%ebp),%edx
+  801136:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801139:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80113c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80113f:	8b 75 18             	mov    0x18(%ebp),%esi
+  801142:	cd 30                	int    $0x30
+  801144:	eb 90                	jmp    8010d6 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801146:	83 ec 0c             	sub    $0xc,%esp
+  801149:	50                   	push   %eax
+  80114a:	6a 05                	push   $0x5
+  80114c:	68 f9 31 80 00       	push   $0x8031f9
+  801151:	6a 4a                	push   $0x4a
+  801153:	68 16 32 80 00       	push   $0x803216
+  801158:	e8 89 1a 00 00       	call   802be6 <_panic>
+
+0080115d <sys_page_unmap>:
+{
+  80115d:	55                   	push   %ebp
+  80115e:	89 e5                	mov    %esp,%ebp
+  801160:	57                   	push   %edi
+  801161:	56                   	push   %esi
+  801162:	53                   	push   %ebx
+  801163:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801166:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80116d:	78 37                	js     8011a6 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  80116f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801176:	74 7a                	je     8011f2 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  801178:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80117d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801180:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801183:	b8 06 00 00 00       	mov    $0x6,%eax
+  801188:	89 df                	mov    %ebx,%edi
+  80118a:	89 de                	mov    %ebx,%esi
+  80118c:	55                   	push   %ebp
+  80118d:	68 96 11 80 00       	push   $0x801196
+  801192:	89 e5                	mov    %esp,%ebp
+  801194:	0f 34                	sysenter
+  801196:	83 c4 04             	add    $0x4,%esp
+  801199:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80119a:	85 c0                	test   %eax,%eax
+  80119c:	7f 6c                	jg     80120a <sys_page_unmap+0xad>
+}
+  80119e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a1:	5b                   	pop    %ebx
+  8011a2:	5e                   	pop    %esi
+  8011a3:	5f                   	pop    %edi
+  8011a4:	5d                   	pop    %ebp
+  8011a5:	c3                   	ret
+  8011a6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011ab:	0f a2                	cpuid
+		return 0;
+  8011ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8011b2:	f6 c6 08             	test   $0x8,%dh
+  8011b5:	74 15                	je     8011cc <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011b7:	89 c2                	mov    %eax,%edx
+  8011b9:	c1 ea 08             	shr    $0x8,%edx
+  8011bc:	83 e2 0f             	and    $0xf,%edx
+  8011bf:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011c4:	83 fa 06             	cmp    $0x6,%edx
+  8011c7:	74 0e                	je     8011d7 <sys_page_unmap+0x7a>
+  8011c9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8011cc:	0f b6 c9             	movzbl %cl,%ecx
+  8011cf:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8011d5:	eb 98                	jmp    80116f <sys_page_unmap+0x12>
+  8011d7:	89 c2                	mov    %eax,%edx
+  8011d9:	c1 ea 04             	shr    $0x4,%edx
+  8011dc:	83 e2 0f             	and    $0xf,%edx
+  8011df:	83 fa 02             	cmp    $0x2,%edx
+  8011e2:	77 e5                	ja     8011c9 <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  8011e4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011e7:	83 f8 02             	cmp    $0x2,%eax
+  8011ea:	0f 97 c1             	seta   %cl
+  8011ed:	0f b6 c9             	movzbl %cl,%ecx
+  8011f0:	eb d7                	jmp    8011c9 <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  8011f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f7:	b8 06 00 00 00       	mov    $0x6,%eax
+  8011fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801202:	89 df                	mov    %ebx,%edi
+  801204:	89 de                	mov    %ebx,%esi
+  801206:	cd 30                	int    $0x30
+  801208:	eb 90                	jmp    80119a <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80120a:	83 ec 0c             	sub    $0xc,%esp
+  80120d:	50                   	push   %eax
+  80120e:	6a 06                	push   $0x6
+  801210:	68 f9 31 80 00       	push   $0x8031f9
+  801215:	6a 4a                	push   $0x4a
+  801217:	68 16 32 80 00       	push   $0x803216
+  80121c:	e8 c5 19 00 00       	call   802be6 <_panic>
+
+00801221 <sys_page_copy>:
+{
+  801221:	55                   	push   %ebp
+  801222:	89 e5                	mov    %esp,%ebp
+  801224:	57                   	push   %edi
+  801225:	56                   	push   %esi
+  801226:	53                   	push   %ebx
+  801227:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80122a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801231:	78 37                	js     80126a <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  801233:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80123a:	74 7a                	je     8012b6 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  80123c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801242:	b8 29 00 00 00       	mov    $0x29,%eax
+  801247:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80124a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80124d:	8b 75 18             	mov    0x18(%ebp),%esi
+  801250:	55                   	push   %ebp
+  801251:	68 5a 12 80 00       	push   $0x80125a
+  801256:	89 e5                	mov    %esp,%ebp
+  801258:	0f 34                	sysenter
+  80125a:	83 c4 04             	add    $0x4,%esp
+  80125d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80125e:	85 c0                	test   %eax,%eax
+  801260:	7f 6c                	jg     8012ce <sys_page_copy+0xad>
+}
+  801262:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801265:	5b                   	pop    %ebx
+  801266:	5e                   	pop    %esi
+  801267:	5f                   	pop    %edi
+  801268:	5d                   	pop    %ebp
+  801269:	c3                   	ret
+  80126a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80126f:	0f a2                	cpuid
+		return 0;
+  801271:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801276:	f6 c6 08             	test   $0x8,%dh
+  801279:	74 15                	je     801290 <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80127b:	89 c2                	mov    %eax,%edx
+  80127d:	c1 ea 08             	shr    $0x8,%edx
+  801280:	83 e2 0f             	and    $0xf,%edx
+  801283:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801288:	83 fa 06             	cmp    $0x6,%edx
+  80128b:	74 0e                	je     80129b <sys_page_copy+0x7a>
+  80128d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801290:	0f b6 c9             	movzbl %cl,%ecx
+  801293:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801299:	eb 98                	jmp    801233 <sys_page_copy+0x12>
+  80129b:	89 c2                	mov    %eax,%edx
+  80129d:	c1 ea 04             	shr    $0x4,%edx
+  8012a0:	83 e2 0f             	and    $0xf,%edx
+  8012a3:	83 fa 02             	cmp    $0x2,%edx
+  8012a6:	77 e5                	ja     80128d <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  8012a8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012ab:	83 f8 02             	cmp    $0x2,%eax
+  8012ae:	0f 97 c1             	seta   %cl
+  8012b1:	0f b6 c9             	movzbl %cl,%ecx
+  8012b4:	eb d7                	jmp    80128d <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  8012b6:	b8 29 00 00 00       	mov    $0x29,%eax
+  8012bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012c1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012c4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012c7:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012ca:	cd 30                	int    $0x30
+  8012cc:	eb 90                	jmp    80125e <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012ce:	83 ec 0c             	sub    $0xc,%esp
+  8012d1:	50                   	push   %eax
+  8012d2:	6a 29                	push   $0x29
+  8012d4:	68 f9 31 80 00       	push   $0x8031f9
+  8012d9:	6a 4a                	push   $0x4a
+  8012db:	68 16 32 80 00       	push   $0x803216
+  8012e0:	e8 01 19 00 00       	call   802be6 <_panic>
+
+008012e5 <sys_yield>:
+{
+  8012e5:	55                   	push   %ebp
+  8012e6:	89 e5                	mov    %esp,%ebp
+  8012e8:	57                   	push   %edi
+  8012e9:	56                   	push   %esi
+  8012ea:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8012eb:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8012f2:	78 2e                	js     801322 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  8012f4:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8012fb:	74 71                	je     80136e <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  8012fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801302:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801307:	89 d1                	mov    %edx,%ecx
+  801309:	89 d3                	mov    %edx,%ebx
+  80130b:	89 d7                	mov    %edx,%edi
+  80130d:	89 d6                	mov    %edx,%esi
+  80130f:	55                   	push   %ebp
+  801310:	68 19 13 80 00       	push   $0x801319
+  801315:	89 e5                	mov    %esp,%ebp
+  801317:	0f 34                	sysenter
+  801319:	83 c4 04             	add    $0x4,%esp
+  80131c:	5d                   	pop    %ebp
+}
+  80131d:	5b                   	pop    %ebx
+  80131e:	5e                   	pop    %esi
+  80131f:	5f                   	pop    %edi
+  801320:	5d                   	pop    %ebp
+  801321:	c3                   	ret
+  801322:	b8 01 00 00 00       	mov    $0x1,%eax
+  801327:	0f a2                	cpuid
+		return 0;
+  801329:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80132e:	f6 c6 08             	test   $0x8,%dh
+  801331:	74 15                	je     801348 <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801333:	89 c2                	mov    %eax,%edx
+  801335:	c1 ea 08             	shr    $0x8,%edx
+  801338:	83 e2 0f             	and    $0xf,%edx
+  80133b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801340:	83 fa 06             	cmp    $0x6,%edx
+  801343:	74 0e                	je     801353 <sys_yield+0x6e>
+  801345:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801348:	0f b6 c9             	movzbl %cl,%ecx
+  80134b:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801351:	eb a1                	jmp    8012f4 <sys_yield+0xf>
+  801353:	89 c2                	mov    %eax,%edx
+  801355:	c1 ea 04             	shr    $0x4,%edx
+  801358:	83 e2 0f             	and    $0xf,%edx
+  80135b:	83 fa 02             	cmp    $0x2,%edx
+  80135e:	77 e5                	ja     801345 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  801360:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801363:	83 f8 02             	cmp    $0x2,%eax
+  801366:	0f 97 c1             	seta   %cl
+  801369:	0f b6 c9             	movzbl %cl,%ecx
+  80136c:	eb d7                	jmp    801345 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  80136e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801373:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801378:	89 d1                	mov    %edx,%ecx
+  80137a:	89 d3                	mov    %edx,%ebx
+  80137c:	89 d7                	mov    %edx,%edi
+  80137e:	89 d6                	mov    %edx,%esi
+  801380:	cd 30                	int    $0x30
+}
+  801382:	eb 99                	jmp    80131d <sys_yield+0x38>
+
+00801384 <sys_env_set_status>:
+{
+  801384:	55                   	push   %ebp
+  801385:	89 e5                	mov    %esp,%ebp
+  801387:	57                   	push   %edi
+  801388:	56                   	push   %esi
+  801389:	53                   	push   %ebx
+  80138a:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80138d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801394:	78 37                	js     8013cd <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  801396:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80139d:	74 7a                	je     801419 <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  80139f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013aa:	b8 08 00 00 00       	mov    $0x8,%eax
+  8013af:	89 df                	mov    %ebx,%edi
+  8013b1:	89 de                	mov    %ebx,%esi
+  8013b3:	55                   	push   %ebp
+  8013b4:	68 bd 13 80 00       	push   $0x8013bd
+  8013b9:	89 e5                	mov    %esp,%ebp
+  8013bb:	0f 34                	sysenter
+  8013bd:	83 c4 04             	add    $0x4,%esp
+  8013c0:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8013c1:	85 c0                	test   %eax,%eax
+  8013c3:	7f 6c                	jg     801431 <sys_env_set_status+0xad>
+}
+  8013c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013c8:	5b                   	pop    %ebx
+  8013c9:	5e                   	pop    %esi
+  8013ca:	5f                   	pop    %edi
+  8013cb:	5d                   	pop    %ebp
+  8013cc:	c3                   	ret
+  8013cd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013d2:	0f a2                	cpuid
+		return 0;
+  8013d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8013d9:	f6 c6 08             	test   $0x8,%dh
+  8013dc:	74 15                	je     8013f3 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013de:	89 c2                	mov    %eax,%edx
+  8013e0:	c1 ea 08             	shr    $0x8,%edx
+  8013e3:	83 e2 0f             	and    $0xf,%edx
+  8013e6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8013eb:	83 fa 06             	cmp    $0x6,%edx
+  8013ee:	74 0e                	je     8013fe <sys_env_set_status+0x7a>
+  8013f0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8013f3:	0f b6 c9             	movzbl %cl,%ecx
+  8013f6:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8013fc:	eb 98                	jmp    801396 <sys_env_set_status+0x12>
+  8013fe:	89 c2                	mov    %eax,%edx
+  801400:	c1 ea 04             	shr    $0x4,%edx
+  801403:	83 e2 0f             	and    $0xf,%edx
+  801406:	83 fa 02             	cmp    $0x2,%edx
+  801409:	77 e5                	ja     8013f0 <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  80140b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80140e:	83 f8 02             	cmp    $0x2,%eax
+  801411:	0f 97 c1             	seta   %cl
+  801414:	0f b6 c9             	movzbl %cl,%ecx
+  801417:	eb d7                	jmp    8013f0 <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  801419:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80141e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801423:	8b 55 08             	mov    0x8(%ebp),%edx
+  801426:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801429:	89 df                	mov    %ebx,%edi
+  80142b:	89 de                	mov    %ebx,%esi
+  80142d:	cd 30                	int    $0x30
+  80142f:	eb 90                	jmp    8013c1 <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801431:	83 ec 0c             	sub    $0xc,%esp
+  801434:	50                   	push   %eax
+  801435:	6a 08                	push   $0x8
+  801437:	68 f9 31 80 00       	push   $0x8031f9
+  80143c:	6a 4a                	push   $0x4a
+  80143e:	68 16 32 80 00       	push   $0x803216
+  801443:	e8 9e 17 00 00       	call   802be6 <_panic>
+
+00801448 <sys_sysinfo>:
+{
+  801448:	55                   	push   %ebp
+  801449:	89 e5                	mov    %esp,%ebp
+  80144b:	57                   	push   %edi
+  80144c:	56                   	push   %esi
+  80144d:	53                   	push   %ebx
+  80144e:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801451:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801458:	78 36                	js     801490 <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  80145a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801461:	74 79                	je     8014dc <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  801463:	8b 55 08             	mov    0x8(%ebp),%edx
+  801466:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80146b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801470:	89 cb                	mov    %ecx,%ebx
+  801472:	89 cf                	mov    %ecx,%edi
+  801474:	89 ce                	mov    %ecx,%esi
+  801476:	55                   	push   %ebp
+  801477:	68 80 14 80 00       	push   $0x801480
+  80147c:	89 e5                	mov    %esp,%ebp
+  80147e:	0f 34                	sysenter
+  801480:	83 c4 04             	add    $0x4,%esp
+  801483:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801484:	85 c0                	test   %eax,%eax
+  801486:	7f 6b                	jg     8014f3 <sys_sysinfo+0xab>
+}
+  801488:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80148b:	5b                   	pop    %ebx
+  80148c:	5e                   	pop    %esi
+  80148d:	5f                   	pop    %edi
+  80148e:	5d                   	pop    %ebp
+  80148f:	c3                   	ret
+  801490:	b8 01 00 00 00       	mov    $0x1,%eax
+  801495:	0f a2                	cpuid
+		return 0;
+  801497:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80149c:	f6 c6 08             	test   $0x8,%dh
+  80149f:	74 15                	je     8014b6 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014a1:	89 c2                	mov    %eax,%edx
+  8014a3:	c1 ea 08             	shr    $0x8,%edx
+  8014a6:	83 e2 0f             	and    $0xf,%edx
+  8014a9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8014ae:	83 fa 06             	cmp    $0x6,%edx
+  8014b1:	74 0e                	je     8014c1 <sys_sysinfo+0x79>
+  8014b3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8014b6:	0f b6 c9             	movzbl %cl,%ecx
+  8014b9:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8014bf:	eb 99                	jmp    80145a <sys_sysinfo+0x12>
+  8014c1:	89 c2                	mov    %eax,%edx
+  8014c3:	c1 ea 04             	shr    $0x4,%edx
+  8014c6:	83 e2 0f             	and    $0xf,%edx
+  8014c9:	83 fa 02             	cmp    $0x2,%edx
+  8014cc:	77 e5                	ja     8014b3 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  8014ce:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014d1:	83 f8 02             	cmp    $0x2,%eax
+  8014d4:	0f 97 c1             	seta   %cl
+  8014d7:	0f b6 c9             	movzbl %cl,%ecx
+  8014da:	eb d7                	jmp    8014b3 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  8014dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014e1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8014e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014e9:	89 cb                	mov    %ecx,%ebx
+  8014eb:	89 cf                	mov    %ecx,%edi
+  8014ed:	89 ce                	mov    %ecx,%esi
+  8014ef:	cd 30                	int    $0x30
+  8014f1:	eb 91                	jmp    801484 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014f3:	83 ec 0c             	sub    $0xc,%esp
+  8014f6:	50                   	push   %eax
+  8014f7:	6a 0b                	push   $0xb
+  8014f9:	68 f9 31 80 00       	push   $0x8031f9
+  8014fe:	6a 4a                	push   $0x4a
+  801500:	68 16 32 80 00       	push   $0x803216
+  801505:	e8 dc 16 00 00       	call   802be6 <_panic>
+
+0080150a <sys_env_set_trapframe>:
+{
+  80150a:	55                   	push   %ebp
+  80150b:	89 e5                	mov    %esp,%ebp
+  80150d:	57                   	push   %edi
+  80150e:	56                   	push   %esi
+  80150f:	53                   	push   %ebx
+  801510:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801513:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80151a:	78 37                	js     801553 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  80151c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801523:	74 7a                	je     80159f <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  801525:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80152a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80152d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801530:	b8 13 00 00 00       	mov    $0x13,%eax
+  801535:	89 df                	mov    %ebx,%edi
+  801537:	89 de                	mov    %ebx,%esi
+  801539:	55                   	push   %ebp
+  80153a:	68 43 15 80 00       	push   $0x801543
+  80153f:	89 e5                	mov    %esp,%ebp
+  801541:	0f 34                	sysenter
+  801543:	83 c4 04             	add    $0x4,%esp
+  801546:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801547:	85 c0                	test   %eax,%eax
+  801549:	7f 6c                	jg     8015b7 <sys_env_set_trapframe+0xad>
+}
+  80154b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80154e:	5b                   	pop    %ebx
+  80154f:	5e                   	pop    %esi
+  801550:	5f                   	pop    %edi
+  801551:	5d                   	pop    %ebp
+  801552:	c3                   	ret
+  801553:	b8 01 00 00 00       	mov    $0x1,%eax
+  801558:	0f a2                	cpuid
+		return 0;
+  80155a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80155f:	f6 c6 08             	test   $0x8,%dh
+  801562:	74 15                	je     801579 <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801564:	89 c2                	mov    %eax,%edx
+  801566:	c1 ea 08             	shr    $0x8,%edx
+  801569:	83 e2 0f             	and    $0xf,%edx
+  80156c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801571:	83 fa 06             	cmp    $0x6,%edx
+  801574:	74 0e                	je     801584 <sys_env_set_trapframe+0x7a>
+  801576:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801579:	0f b6 c9             	movzbl %cl,%ecx
+  80157c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801582:	eb 98                	jmp    80151c <sys_env_set_trapframe+0x12>
+  801584:	89 c2                	mov    %eax,%edx
+  801586:	c1 ea 04             	shr    $0x4,%edx
+  801589:	83 e2 0f             	and    $0xf,%edx
+  80158c:	83 fa 02             	cmp    $0x2,%edx
+  80158f:	77 e5                	ja     801576 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  801591:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801594:	83 f8 02             	cmp    $0x2,%eax
+  801597:	0f 97 c1             	seta   %cl
+  80159a:	0f b6 c9             	movzbl %cl,%ecx
+  80159d:	eb d7                	jmp    801576 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  80159f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015a4:	b8 13 00 00 00       	mov    $0x13,%eax
+  8015a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015af:	89 df                	mov    %ebx,%edi
+  8015b1:	89 de                	mov    %ebx,%esi
+  8015b3:	cd 30                	int    $0x30
+  8015b5:	eb 90                	jmp    801547 <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015b7:	83 ec 0c             	sub    $0xc,%esp
+  8015ba:	50                   	push   %eax
+  8015bb:	6a 13                	push   $0x13
+  8015bd:	68 f9 31 80 00       	push   $0x8031f9
+  8015c2:	6a 4a                	push   $0x4a
+  8015c4:	68 16 32 80 00       	push   $0x803216
+  8015c9:	e8 18 16 00 00       	call   802be6 <_panic>
+
+008015ce <sys_env_set_stack_limit>:
+{
+  8015ce:	55                   	push   %ebp
+  8015cf:	89 e5                	mov    %esp,%ebp
+  8015d1:	57                   	push   %edi
+  8015d2:	56                   	push   %esi
+  8015d3:	53                   	push   %ebx
+  8015d4:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8015d7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8015de:	78 37                	js     801617 <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  8015e0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8015e7:	74 7a                	je     801663 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  8015e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015f4:	b8 19 00 00 00       	mov    $0x19,%eax
+  8015f9:	89 df                	mov    %ebx,%edi
+  8015fb:	89 de                	mov    %ebx,%esi
+  8015fd:	55                   	push   %ebp
+  8015fe:	68 07 16 80 00       	push   $0x801607
+  801603:	89 e5                	mov    %esp,%ebp
+  801605:	0f 34                	sysenter
+  801607:	83 c4 04             	add    $0x4,%esp
+  80160a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80160b:	85 c0                	test   %eax,%eax
+  80160d:	7f 6c                	jg     80167b <sys_env_set_stack_limit+0xad>
+}
+  80160f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801612:	5b                   	pop    %ebx
+  801613:	5e                   	pop    %esi
+  801614:	5f                   	pop    %edi
+  801615:	5d                   	pop    %ebp
+  801616:	c3                   	ret
+  801617:	b8 01 00 00 00       	mov    $0x1,%eax
+  80161c:	0f a2                	cpuid
+		return 0;
+  80161e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801623:	f6 c6 08             	test   $0x8,%dh
+  801626:	74 15                	je     80163d <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801628:	89 c2                	mov    %eax,%edx
+  80162a:	c1 ea 08             	shr    $0x8,%edx
+  80162d:	83 e2 0f             	and    $0xf,%edx
+  801630:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801635:	83 fa 06             	cmp    $0x6,%edx
+  801638:	74 0e                	je     801648 <sys_env_set_stack_limit+0x7a>
+  80163a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80163d:	0f b6 c9             	movzbl %cl,%ecx
+  801640:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801646:	eb 98                	jmp    8015e0 <sys_env_set_stack_limit+0x12>
+  801648:	89 c2                	mov    %eax,%edx
+  80164a:	c1 ea 04             	shr    $0x4,%edx
+  80164d:	83 e2 0f             	and    $0xf,%edx
+  801650:	83 fa 02             	cmp    $0x2,%edx
+  801653:	77 e5                	ja     80163a <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  801655:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801658:	83 f8 02             	cmp    $0x2,%eax
+  80165b:	0f 97 c1             	seta   %cl
+  80165e:	0f b6 c9             	movzbl %cl,%ecx
+  801661:	eb d7                	jmp    80163a <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  801663:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801668:	b8 19 00 00 00       	mov    $0x19,%eax
+  80166d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801670:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801673:	89 df                	mov    %ebx,%edi
+  801675:	89 de                	mov    %ebx,%esi
+  801677:	cd 30                	int    $0x30
+  801679:	eb 90                	jmp    80160b <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80167b:	83 ec 0c             	sub    $0xc,%esp
+  80167e:	50                   	push   %eax
+  80167f:	6a 19                	push   $0x19
+  801681:	68 f9 31 80 00       	push   $0x8031f9
+  801686:	6a 4a                	push   $0x4a
+  801688:	68 16 32 80 00       	push   $0x803216
+  80168d:	e8 54 15 00 00       	call   802be6 <_panic>
+
+00801692 <sys_env_set_pgfault_upcall>:
+{
+  801692:	55                   	push   %ebp
+  801693:	89 e5                	mov    %esp,%ebp
+  801695:	57                   	push   %edi
+  801696:	56                   	push   %esi
+  801697:	53                   	push   %ebx
+  801698:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80169b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8016a2:	78 37                	js     8016db <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  8016a4:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8016ab:	74 7a                	je     801727 <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  8016ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016b8:	b8 09 00 00 00       	mov    $0x9,%eax
+  8016bd:	89 df                	mov    %ebx,%edi
+  8016bf:	89 de                	mov    %ebx,%esi
+  8016c1:	55                   	push   %ebp
+  8016c2:	68 cb 16 80 00       	push   $0x8016cb
+  8016c7:	89 e5                	mov    %esp,%ebp
+  8016c9:	0f 34                	sysenter
+  8016cb:	83 c4 04             	add    $0x4,%esp
+  8016ce:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8016cf:	85 c0                	test   %eax,%eax
+  8016d1:	7f 6c                	jg     80173f <sys_env_set_pgfault_upcall+0xad>
+}
+  8016d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016d6:	5b                   	pop    %ebx
+  8016d7:	5e                   	pop    %esi
+  8016d8:	5f                   	pop    %edi
+  8016d9:	5d                   	pop    %ebp
+  8016da:	c3                   	ret
+  8016db:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016e0:	0f a2                	cpuid
+		return 0;
+  8016e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8016e7:	f6 c6 08             	test   $0x8,%dh
+  8016ea:	74 15                	je     801701 <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016ec:	89 c2                	mov    %eax,%edx
+  8016ee:	c1 ea 08             	shr    $0x8,%edx
+  8016f1:	83 e2 0f             	and    $0xf,%edx
+  8016f4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8016f9:	83 fa 06             	cmp    $0x6,%edx
+  8016fc:	74 0e                	je     80170c <sys_env_set_pgfault_upcall+0x7a>
+  8016fe:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801701:	0f b6 c9             	movzbl %cl,%ecx
+  801704:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80170a:	eb 98                	jmp    8016a4 <sys_env_set_pgfault_upcall+0x12>
+  80170c:	89 c2                	mov    %eax,%edx
+  80170e:	c1 ea 04             	shr    $0x4,%edx
+  801711:	83 e2 0f             	and    $0xf,%edx
+  801714:	83 fa 02             	cmp    $0x2,%edx
+  801717:	77 e5                	ja     8016fe <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  801719:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80171c:	83 f8 02             	cmp    $0x2,%eax
+  80171f:	0f 97 c1             	seta   %cl
+  801722:	0f b6 c9             	movzbl %cl,%ecx
+  801725:	eb d7                	jmp    8016fe <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  801727:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80172c:	b8 09 00 00 00       	mov    $0x9,%eax
+  801731:	8b 55 08             	mov    0x8(%ebp),%edx
+  801734:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801737:	89 df                	mov    %ebx,%edi
+  801739:	89 de                	mov    %ebx,%esi
+  80173b:	cd 30                	int    $0x30
+  80173d:	eb 90                	jmp    8016cf <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80173f:	83 ec 0c             	sub    $0xc,%esp
+  801742:	50                   	push   %eax
+  801743:	6a 09                	push   $0x9
+  801745:	68 f9 31 80 00       	push   $0x8031f9
+  80174a:	6a 4a                	push   $0x4a
+  80174c:	68 16 32 80 00       	push   $0x803216
+  801751:	e8 90 14 00 00       	call   802be6 <_panic>
+
+00801756 <sys_ipc_try_send>:
+{
+  801756:	55                   	push   %ebp
+  801757:	89 e5                	mov    %esp,%ebp
+  801759:	57                   	push   %edi
+  80175a:	56                   	push   %esi
+  80175b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80175c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801763:	78 32                	js     801797 <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  801765:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80176c:	74 75                	je     8017e3 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  80176e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801771:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801774:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801779:	be 00 00 00 00       	mov    $0x0,%esi
+  80177e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801781:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801784:	55                   	push   %ebp
+  801785:	68 8e 17 80 00       	push   $0x80178e
+  80178a:	89 e5                	mov    %esp,%ebp
+  80178c:	0f 34                	sysenter
+  80178e:	83 c4 04             	add    $0x4,%esp
+  801791:	5d                   	pop    %ebp
+}
+  801792:	5b                   	pop    %ebx
+  801793:	5e                   	pop    %esi
+  801794:	5f                   	pop    %edi
+  801795:	5d                   	pop    %ebp
+  801796:	c3                   	ret
+  801797:	b8 01 00 00 00       	mov    $0x1,%eax
+  80179c:	0f a2                	cpuid
+		return 0;
+  80179e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8017a3:	f6 c6 08             	test   $0x8,%dh
+  8017a6:	74 15                	je     8017bd <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017a8:	89 c2                	mov    %eax,%edx
+  8017aa:	c1 ea 08             	shr    $0x8,%edx
+  8017ad:	83 e2 0f             	and    $0xf,%edx
+  8017b0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017b5:	83 fa 06             	cmp    $0x6,%edx
+  8017b8:	74 0e                	je     8017c8 <sys_ipc_try_send+0x72>
+  8017ba:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8017bd:	0f b6 c9             	movzbl %cl,%ecx
+  8017c0:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8017c6:	eb 9d                	jmp    801765 <sys_ipc_try_send+0xf>
+  8017c8:	89 c2                	mov    %eax,%edx
+  8017ca:	c1 ea 04             	shr    $0x4,%edx
+  8017cd:	83 e2 0f             	and    $0xf,%edx
+  8017d0:	83 fa 02             	cmp    $0x2,%edx
+  8017d3:	77 e5                	ja     8017ba <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  8017d5:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017d8:	83 f8 02             	cmp    $0x2,%eax
+  8017db:	0f 97 c1             	seta   %cl
+  8017de:	0f b6 c9             	movzbl %cl,%ecx
+  8017e1:	eb d7                	jmp    8017ba <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  8017e3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8017e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8017ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017f3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017f6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8017f9:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  8017fb:	eb 95                	jmp    801792 <sys_ipc_try_send+0x3c>
+
+008017fd <sys_ipc_send>:
+{
+  8017fd:	55                   	push   %ebp
+  8017fe:	89 e5                	mov    %esp,%ebp
+  801800:	57                   	push   %edi
+  801801:	56                   	push   %esi
+  801802:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801803:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80180a:	78 32                	js     80183e <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  80180c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801813:	74 75                	je     80188a <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801815:	8b 55 08             	mov    0x8(%ebp),%edx
+  801818:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80181b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801820:	be 00 00 00 00       	mov    $0x0,%esi
+  801825:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801828:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80182b:	55                   	push   %ebp
+  80182c:	68 35 18 80 00       	push   $0x801835
+  801831:	89 e5                	mov    %esp,%ebp
+  801833:	0f 34                	sysenter
+  801835:	83 c4 04             	add    $0x4,%esp
+  801838:	5d                   	pop    %ebp
+}
+  801839:	5b                   	pop    %ebx
+  80183a:	5e                   	pop    %esi
+  80183b:	5f                   	pop    %edi
+  80183c:	5d                   	pop    %ebp
+  80183d:	c3                   	ret
+  80183e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801843:	0f a2                	cpuid
+		return 0;
+  801845:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80184a:	f6 c6 08             	test   $0x8,%dh
+  80184d:	74 15                	je     801864 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80184f:	89 c2                	mov    %eax,%edx
+  801851:	c1 ea 08             	shr    $0x8,%edx
+  801854:	83 e2 0f             	and    $0xf,%edx
+  801857:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80185c:	83 fa 06             	cmp    $0x6,%edx
+  80185f:	74 0e                	je     80186f <sys_ipc_send+0x72>
+  801861:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801864:	0f b6 c9             	movzbl %cl,%ecx
+  801867:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80186d:	eb 9d                	jmp    80180c <sys_ipc_send+0xf>
+  80186f:	89 c2                	mov    %eax,%edx
+  801871:	c1 ea 04             	shr    $0x4,%edx
+  801874:	83 e2 0f             	and    $0xf,%edx
+  801877:	83 fa 02             	cmp    $0x2,%edx
+  80187a:	77 e5                	ja     801861 <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  80187c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80187f:	83 f8 02             	cmp    $0x2,%eax
+  801882:	0f 97 c1             	seta   %cl
+  801885:	0f b6 c9             	movzbl %cl,%ecx
+  801888:	eb d7                	jmp    801861 <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  80188a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80188f:	be 00 00 00 00       	mov    $0x0,%esi
+  801894:	8b 55 08             	mov    0x8(%ebp),%edx
+  801897:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80189a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80189d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8018a0:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  8018a2:	eb 95                	jmp    801839 <sys_ipc_send+0x3c>
+
+008018a4 <sys_ipc_recv>:
+{
+  8018a4:	55                   	push   %ebp
+  8018a5:	89 e5                	mov    %esp,%ebp
+  8018a7:	57                   	push   %edi
+  8018a8:	56                   	push   %esi
+  8018a9:	53                   	push   %ebx
+  8018aa:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8018ad:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8018b4:	78 36                	js     8018ec <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  8018b6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8018bd:	74 79                	je     801938 <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  8018bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018c7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8018cc:	89 cb                	mov    %ecx,%ebx
+  8018ce:	89 cf                	mov    %ecx,%edi
+  8018d0:	89 ce                	mov    %ecx,%esi
+  8018d2:	55                   	push   %ebp
+  8018d3:	68 dc 18 80 00       	push   $0x8018dc
+  8018d8:	89 e5                	mov    %esp,%ebp
+  8018da:	0f 34                	sysenter
+  8018dc:	83 c4 04             	add    $0x4,%esp
+  8018df:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8018e0:	85 c0                	test   %eax,%eax
+  8018e2:	7f 6b                	jg     80194f <sys_ipc_recv+0xab>
+}
+  8018e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018e7:	5b                   	pop    %ebx
+  8018e8:	5e                   	pop    %esi
+  8018e9:	5f                   	pop    %edi
+  8018ea:	5d                   	pop    %ebp
+  8018eb:	c3                   	ret
+  8018ec:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018f1:	0f a2                	cpuid
+		return 0;
+  8018f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018f8:	f6 c6 08             	test   $0x8,%dh
+  8018fb:	74 15                	je     801912 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018fd:	89 c2                	mov    %eax,%edx
+  8018ff:	c1 ea 08             	shr    $0x8,%edx
+  801902:	83 e2 0f             	and    $0xf,%edx
+  801905:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80190a:	83 fa 06             	cmp    $0x6,%edx
+  80190d:	74 0e                	je     80191d <sys_ipc_recv+0x79>
+  80190f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801912:	0f b6 c9             	movzbl %cl,%ecx
+  801915:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80191b:	eb 99                	jmp    8018b6 <sys_ipc_recv+0x12>
+  80191d:	89 c2                	mov    %eax,%edx
+  80191f:	c1 ea 04             	shr    $0x4,%edx
+  801922:	83 e2 0f             	and    $0xf,%edx
+  801925:	83 fa 02             	cmp    $0x2,%edx
+  801928:	77 e5                	ja     80190f <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  80192a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80192d:	83 f8 02             	cmp    $0x2,%eax
+  801930:	0f 97 c1             	seta   %cl
+  801933:	0f b6 c9             	movzbl %cl,%ecx
+  801936:	eb d7                	jmp    80190f <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  801938:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80193d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801942:	8b 55 08             	mov    0x8(%ebp),%edx
+  801945:	89 cb                	mov    %ecx,%ebx
+  801947:	89 cf                	mov    %ecx,%edi
+  801949:	89 ce                	mov    %ecx,%esi
+  80194b:	cd 30                	int    $0x30
+  80194d:	eb 91                	jmp    8018e0 <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80194f:	83 ec 0c             	sub    $0xc,%esp
+  801952:	50                   	push   %eax
+  801953:	6a 0d                	push   $0xd
+  801955:	68 f9 31 80 00       	push   $0x8031f9
+  80195a:	6a 4a                	push   $0x4a
+  80195c:	68 16 32 80 00       	push   $0x803216
+  801961:	e8 80 12 00 00       	call   802be6 <_panic>
+
+00801966 <sys_ipc_send_range>:
+{
+  801966:	55                   	push   %ebp
+  801967:	89 e5                	mov    %esp,%ebp
+  801969:	57                   	push   %edi
+  80196a:	56                   	push   %esi
+  80196b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80196c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801973:	78 30                	js     8019a5 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  801975:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80197c:	74 73                	je     8019f1 <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  80197e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801981:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801984:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801989:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80198c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80198f:	8b 75 18             	mov    0x18(%ebp),%esi
+  801992:	55                   	push   %ebp
+  801993:	68 9c 19 80 00       	push   $0x80199c
+  801998:	89 e5                	mov    %esp,%ebp
+  80199a:	0f 34                	sysenter
+  80199c:	83 c4 04             	add    $0x4,%esp
+  80199f:	5d                   	pop    %ebp
+}
+  8019a0:	5b                   	pop    %ebx
+  8019a1:	5e                   	pop    %esi
+  8019a2:	5f                   	pop    %edi
+  8019a3:	5d                   	pop    %ebp
+  8019a4:	c3                   	ret
+  8019a5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019aa:	0f a2                	cpuid
+		return 0;
+  8019ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8019b1:	f6 c6 08             	test   $0x8,%dh
+  8019b4:	74 15                	je     8019cb <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019b6:	89 c2                	mov    %eax,%edx
+  8019b8:	c1 ea 08             	shr    $0x8,%edx
+  8019bb:	83 e2 0f             	and    $0xf,%edx
+  8019be:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019c3:	83 fa 06             	cmp    $0x6,%edx
+  8019c6:	74 0e                	je     8019d6 <sys_ipc_send_range+0x70>
+  8019c8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8019cb:	0f b6 c9             	movzbl %cl,%ecx
+  8019ce:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8019d4:	eb 9f                	jmp    801975 <sys_ipc_send_range+0xf>
+  8019d6:	89 c2                	mov    %eax,%edx
+  8019d8:	c1 ea 04             	shr    $0x4,%edx
+  8019db:	83 e2 0f             	and    $0xf,%edx
+  8019de:	83 fa 02             	cmp    $0x2,%edx
+  8019e1:	77 e5                	ja     8019c8 <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  8019e3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019e6:	83 f8 02             	cmp    $0x2,%eax
+  8019e9:	0f 97 c1             	seta   %cl
+  8019ec:	0f b6 c9             	movzbl %cl,%ecx
+  8019ef:	eb d7                	jmp    8019c8 <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  8019f1:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8019f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019ff:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a02:	8b 75 18             	mov    0x18(%ebp),%esi
+  801a05:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  801a07:	eb 97                	jmp    8019a0 <sys_ipc_send_range+0x3a>
+
+00801a09 <sys_ipc_recv_range>:
+{
+  801a09:	55                   	push   %ebp
+  801a0a:	89 e5                	mov    %esp,%ebp
+  801a0c:	57                   	push   %edi
+  801a0d:	56                   	push   %esi
+  801a0e:	53                   	push   %ebx
+  801a0f:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801a12:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a19:	78 37                	js     801a52 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  801a1b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a22:	74 7a                	je     801a9e <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  801a24:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a29:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a2c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a2f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801a34:	89 df                	mov    %ebx,%edi
+  801a36:	89 de                	mov    %ebx,%esi
+  801a38:	55                   	push   %ebp
+  801a39:	68 42 1a 80 00       	push   $0x801a42
+  801a3e:	89 e5                	mov    %esp,%ebp
+  801a40:	0f 34                	sysenter
+  801a42:	83 c4 04             	add    $0x4,%esp
+  801a45:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801a46:	85 c0                	test   %eax,%eax
+  801a48:	7f 6c                	jg     801ab6 <sys_ipc_recv_range+0xad>
+}
+  801a4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a4d:	5b                   	pop    %ebx
+  801a4e:	5e                   	pop    %esi
+  801a4f:	5f                   	pop    %edi
+  801a50:	5d                   	pop    %ebp
+  801a51:	c3                   	ret
+  801a52:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a57:	0f a2                	cpuid
+		return 0;
+  801a59:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801a5e:	f6 c6 08             	test   $0x8,%dh
+  801a61:	74 15                	je     801a78 <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a63:	89 c2                	mov    %eax,%edx
+  801a65:	c1 ea 08             	shr    $0x8,%edx
+  801a68:	83 e2 0f             	and    $0xf,%edx
+  801a6b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a70:	83 fa 06             	cmp    $0x6,%edx
+  801a73:	74 0e                	je     801a83 <sys_ipc_recv_range+0x7a>
+  801a75:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a78:	0f b6 c9             	movzbl %cl,%ecx
+  801a7b:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801a81:	eb 98                	jmp    801a1b <sys_ipc_recv_range+0x12>
+  801a83:	89 c2                	mov    %eax,%edx
+  801a85:	c1 ea 04             	shr    $0x4,%edx
+  801a88:	83 e2 0f             	and    $0xf,%edx
+  801a8b:	83 fa 02             	cmp    $0x2,%edx
+  801a8e:	77 e5                	ja     801a75 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801a90:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a93:	83 f8 02             	cmp    $0x2,%eax
+  801a96:	0f 97 c1             	seta   %cl
+  801a99:	0f b6 c9             	movzbl %cl,%ecx
+  801a9c:	eb d7                	jmp    801a75 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801a9e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aa3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801aa8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801aae:	89 df                	mov    %ebx,%edi
+  801ab0:	89 de                	mov    %ebx,%esi
+  801ab2:	cd 30                	int    $0x30
+  801ab4:	eb 90                	jmp    801a46 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801ab6:	83 ec 0c             	sub    $0xc,%esp
+  801ab9:	50                   	push   %eax
+  801aba:	6a 1f                	push   $0x1f
+  801abc:	68 f9 31 80 00       	push   $0x8031f9
+  801ac1:	6a 4a                	push   $0x4a
+  801ac3:	68 16 32 80 00       	push   $0x803216
+  801ac8:	e8 19 11 00 00       	call   802be6 <_panic>
+
+00801acd <sys_ipc_call>:
+{
+  801acd:	55                   	push   %ebp
+  801ace:	89 e5                	mov    %esp,%ebp
+  801ad0:	57                   	push   %edi
+  801ad1:	56                   	push   %esi
+  801ad2:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801ad3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ad6:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801adb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801ade:	55                   	push   %ebp
+  801adf:	56                   	push   %esi
+  801ae0:	8b 0e                	mov    (%esi),%ecx
+  801ae2:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801ae5:	8b 7e 08             	mov    0x8(%esi),%edi
+  801ae8:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801aeb:	8b 76 0c             	mov    0xc(%esi),%esi
+  801aee:	cd 30                	int    $0x30
+  801af0:	87 34 24             	xchg   %esi,(%esp)
+  801af3:	89 0e                	mov    %ecx,(%esi)
+  801af5:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801af8:	89 7e 08             	mov    %edi,0x8(%esi)
+  801afb:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801afe:	8f 46 0c             	pop    0xc(%esi)
+  801b01:	5d                   	pop    %ebp
+}
+  801b02:	5b                   	pop    %ebx
+  801b03:	5e                   	pop    %esi
+  801b04:	5f                   	pop    %edi
+  801b05:	5d                   	pop    %ebp
+  801b06:	c3                   	ret
+
+00801b07 <sys_ipc_reply_wait>:
+{
+  801b07:	55                   	push   %ebp
+  801b08:	89 e5                	mov    %esp,%ebp
+  801b0a:	57                   	push   %edi
+  801b0b:	56                   	push   %esi
+  801b0c:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801b0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b10:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801b15:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b18:	55                   	push   %ebp
+  801b19:	56                   	push   %esi
+  801b1a:	8b 0e                	mov    (%esi),%ecx
+  801b1c:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801b1f:	8b 7e 08             	mov    0x8(%esi),%edi
+  801b22:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801b25:	8b 76 0c             	mov    0xc(%esi),%esi
+  801b28:	cd 30                	int    $0x30
+  801b2a:	87 34 24             	xchg   %esi,(%esp)
+  801b2d:	89 0e                	mov    %ecx,(%esi)
+  801b2f:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801b32:	89 7e 08             	mov    %edi,0x8(%esi)
+  801b35:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801b38:	8f 46 0c             	pop    0xc(%esi)
+  801b3b:	5d                   	pop    %ebp
+}
+  801b3c:	5b                   	pop    %ebx
+  801b3d:	5e                   	pop    %esi
+  801b3e:	5f                   	pop    %edi
+  801b3f:	5d                   	pop    %ebp
+  801b40:	c3                   	ret
+
+00801b41 <sys_ipc_send_msg>:
+{
+  801b41:	55                   	push   %ebp
+  801b42:	89 e5                	mov    %esp,%ebp
+  801b44:	57                   	push   %edi
+  801b45:	56                   	push   %esi
+  801b46:	53                   	push   %ebx
+  801b47:	83 ec 20             	sub    $0x20,%esp
+  801b4a:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801b4d:	8b 10                	mov    (%eax),%edx
+  801b4f:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801b52:	8b 50 04             	mov    0x4(%eax),%edx
+  801b55:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801b58:	8b 50 08             	mov    0x8(%eax),%edx
+  801b5b:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801b5e:	8b 50 0c             	mov    0xc(%eax),%edx
+  801b61:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801b64:	8b 40 10             	mov    0x10(%eax),%eax
+  801b67:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801b6a:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801b6d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b70:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801b75:	55                   	push   %ebp
+  801b76:	56                   	push   %esi
+  801b77:	8b 0e                	mov    (%esi),%ecx
+  801b79:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801b7c:	8b 7e 08             	mov    0x8(%esi),%edi
+  801b7f:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801b82:	8b 76 0c             	mov    0xc(%esi),%esi
+  801b85:	cd 30                	int    $0x30
+  801b87:	87 34 24             	xchg   %esi,(%esp)
+  801b8a:	89 0e                	mov    %ecx,(%esi)
+  801b8c:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801b8f:	89 7e 08             	mov    %edi,0x8(%esi)
+  801b92:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801b95:	8f 46 0c             	pop    0xc(%esi)
+  801b98:	5d                   	pop    %ebp
+}
+  801b99:	83 c4 20             	add    $0x20,%esp
+  801b9c:	5b                   	pop    %ebx
+  801b9d:	5e                   	pop    %esi
+  801b9e:	5f                   	pop    %edi
+  801b9f:	5d                   	pop    %ebp
+  801ba0:	c3                   	ret
+
+00801ba1 <sys_fork>:
+{
+  801ba1:	55                   	push   %ebp
+  801ba2:	89 e5                	mov    %esp,%ebp
+  801ba4:	57                   	push   %edi
+  801ba5:	56                   	push   %esi
+  801ba6:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801ba7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801bae:	78 2e                	js     801bde <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801bb0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801bb7:	74 71                	je     801c2a <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801bb9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bbe:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801bc3:	89 d1                	mov    %edx,%ecx
+  801bc5:	89 d3                	mov    %edx,%ebx
+  801bc7:	89 d7                	mov    %edx,%edi
+  801bc9:	89 d6                	mov    %edx,%esi
+  801bcb:	55                   	push   %ebp
+  801bcc:	68 d5 1b 80 00       	push   $0x801bd5
+  801bd1:	89 e5                	mov    %esp,%ebp
+  801bd3:	0f 34                	sysenter
+  801bd5:	83 c4 04             	add    $0x4,%esp
+  801bd8:	5d                   	pop    %ebp
+}
+  801bd9:	5b                   	pop    %ebx
+  801bda:	5e                   	pop    %esi
+  801bdb:	5f                   	pop    %edi
+  801bdc:	5d                   	pop    %ebp
+  801bdd:	c3                   	ret
+  801bde:	b8 01 00 00 00       	mov    $0x1,%eax
+  801be3:	0f a2                	cpuid
+		return 0;
+  801be5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801bea:	f6 c6 08             	test   $0x8,%dh
+  801bed:	74 15                	je     801c04 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bef:	89 c2                	mov    %eax,%edx
+  801bf1:	c1 ea 08             	shr    $0x8,%edx
+  801bf4:	83 e2 0f             	and    $0xf,%edx
+  801bf7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801bfc:	83 fa 06             	cmp    $0x6,%edx
+  801bff:	74 0e                	je     801c0f <sys_fork+0x6e>
+  801c01:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801c04:	0f b6 c9             	movzbl %cl,%ecx
+  801c07:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801c0d:	eb a1                	jmp    801bb0 <sys_fork+0xf>
+  801c0f:	89 c2                	mov    %eax,%edx
+  801c11:	c1 ea 04             	shr    $0x4,%edx
+  801c14:	83 e2 0f             	and    $0xf,%edx
+  801c17:	83 fa 02             	cmp    $0x2,%edx
+  801c1a:	77 e5                	ja     801c01 <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801c1c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c1f:	83 f8 02             	cmp    $0x2,%eax
+  801c22:	0f 97 c1             	seta   %cl
+  801c25:	0f b6 c9             	movzbl %cl,%ecx
+  801c28:	eb d7                	jmp    801c01 <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801c2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c2f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801c34:	89 d1                	mov    %edx,%ecx
+  801c36:	89 d3                	mov    %edx,%ebx
+  801c38:	89 d7                	mov    %edx,%edi
+  801c3a:	89 d6                	mov    %edx,%esi
+  801c3c:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801c3e:	eb 99                	jmp    801bd9 <sys_fork+0x38>
+
+00801c40 <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801c40:	55                   	push   %ebp
+  801c41:	89 e5                	mov    %esp,%ebp
+  801c43:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801c46:	ff 75 14             	push   0x14(%ebp)
+  801c49:	ff 75 10             	push   0x10(%ebp)
+  801c4c:	ff 75 0c             	push   0xc(%ebp)
+  801c4f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c54:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c57:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801c5c:	e8 81 ee ff ff       	call   800ae2 <page_vec_call>
+}
+  801c61:	c9                   	leave
+  801c62:	c3                   	ret
+
+00801c63 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801c63:	55                   	push   %ebp
+  801c64:	89 e5                	mov    %esp,%ebp
+  801c66:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801c69:	ff 75 18             	push   0x18(%ebp)
+  801c6c:	ff 75 14             	push   0x14(%ebp)
+  801c6f:	ff 75 10             	push   0x10(%ebp)
+  801c72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c75:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c78:	b8 10 00 00 00       	mov    $0x10,%eax
+  801c7d:	e8 60 ee ff ff       	call   800ae2 <page_vec_call>
+}
+  801c82:	c9                   	leave
+  801c83:	c3                   	ret
+
+00801c84 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801c84:	55                   	push   %ebp
+  801c85:	89 e5                	mov    %esp,%ebp
+  801c87:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801c8a:	ff 75 14             	push   0x14(%ebp)
+  801c8d:	ff 75 10             	push   0x10(%ebp)
+  801c90:	ff 75 0c             	push   0xc(%ebp)
+  801c93:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c98:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c9b:	b8 11 00 00 00       	mov    $0x11,%eax
+  801ca0:	e8 3d ee ff ff       	call   800ae2 <page_vec_call>
+}
+  801ca5:	c9                   	leave
+  801ca6:	c3                   	ret
+
+00801ca7 <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801ca7:	55                   	push   %ebp
+  801ca8:	89 e5                	mov    %esp,%ebp
+  801caa:	57                   	push   %edi
+  801cab:	56                   	push   %esi
+  801cac:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801cad:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801cb4:	78 32                	js     801ce8 <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801cb6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801cbd:	74 75                	je     801d34 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801cbf:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cc2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cc5:	b8 12 00 00 00       	mov    $0x12,%eax
+  801cca:	be 00 00 00 00       	mov    $0x0,%esi
+  801ccf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801cd2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801cd5:	55                   	push   %ebp
+  801cd6:	68 df 1c 80 00       	push   $0x801cdf
+  801cdb:	89 e5                	mov    %esp,%ebp
+  801cdd:	0f 34                	sysenter
+  801cdf:	83 c4 04             	add    $0x4,%esp
+  801ce2:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801ce3:	5b                   	pop    %ebx
+  801ce4:	5e                   	pop    %esi
+  801ce5:	5f                   	pop    %edi
+  801ce6:	5d                   	pop    %ebp
+  801ce7:	c3                   	ret
+  801ce8:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ced:	0f a2                	cpuid
+		return 0;
+  801cef:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801cf4:	f6 c6 08             	test   $0x8,%dh
+  801cf7:	74 15                	je     801d0e <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801cf9:	89 c2                	mov    %eax,%edx
+  801cfb:	c1 ea 08             	shr    $0x8,%edx
+  801cfe:	83 e2 0f             	and    $0xf,%edx
+  801d01:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d06:	83 fa 06             	cmp    $0x6,%edx
+  801d09:	74 0e                	je     801d19 <sys_vm_ranges+0x72>
+  801d0b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801d0e:	0f b6 c9             	movzbl %cl,%ecx
+  801d11:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801d17:	eb 9d                	jmp    801cb6 <sys_vm_ranges+0xf>
+  801d19:	89 c2                	mov    %eax,%edx
+  801d1b:	c1 ea 04             	shr    $0x4,%edx
+  801d1e:	83 e2 0f             	and    $0xf,%edx
+  801d21:	83 fa 02             	cmp    $0x2,%edx
+  801d24:	77 e5                	ja     801d0b <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  801d26:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d29:	83 f8 02             	cmp    $0x2,%eax
+  801d2c:	0f 97 c1             	seta   %cl
+  801d2f:	0f b6 c9             	movzbl %cl,%ecx
+  801d32:	eb d7                	jmp    801d0b <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801d34:	b8 12 00 00 00       	mov    $0x12,%eax
+  801d39:	be 00 00 00 00       	mov    $0x0,%esi
+  801d3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d41:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d44:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d47:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801d4a:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801d4c:	eb 95                	jmp    801ce3 <sys_vm_ranges+0x3c>
+
+00801d4e <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801d4e:	55                   	push   %ebp
+  801d4f:	89 e5                	mov    %esp,%ebp
+  801d51:	57                   	push   %edi
+  801d52:	56                   	push   %esi
+  801d53:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801d54:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801d5b:	78 31                	js     801d8e <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801d5d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801d64:	74 74                	je     801dda <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801d66:	be 00 00 00 00       	mov    $0x0,%esi
+  801d6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d6e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d71:	b8 14 00 00 00       	mov    $0x14,%eax
+  801d76:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d79:	89 f7                	mov    %esi,%edi
+  801d7b:	55                   	push   %ebp
+  801d7c:	68 85 1d 80 00       	push   $0x801d85
+  801d81:	89 e5                	mov    %esp,%ebp
+  801d83:	0f 34                	sysenter
+  801d85:	83 c4 04             	add    $0x4,%esp
+  801d88:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801d89:	5b                   	pop    %ebx
+  801d8a:	5e                   	pop    %esi
+  801d8b:	5f                   	pop    %edi
+  801d8c:	5d                   	pop    %ebp
+  801d8d:	c3                   	ret
+  801d8e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d93:	0f a2                	cpuid
+		return 0;
+  801d95:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801d9a:	f6 c6 08             	test   $0x8,%dh
+  801d9d:	74 15                	je     801db4 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d9f:	89 c2                	mov    %eax,%edx
+  801da1:	c1 ea 08             	shr    $0x8,%edx
+  801da4:	83 e2 0f             	and    $0xf,%edx
+  801da7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801dac:	83 fa 06             	cmp    $0x6,%edx
+  801daf:	74 0e                	je     801dbf <sys_spawn+0x71>
+  801db1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801db4:	0f b6 c9             	movzbl %cl,%ecx
+  801db7:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801dbd:	eb 9e                	jmp    801d5d <sys_spawn+0xf>
+  801dbf:	89 c2                	mov    %eax,%edx
+  801dc1:	c1 ea 04             	shr    $0x4,%edx
+  801dc4:	83 e2 0f             	and    $0xf,%edx
+  801dc7:	83 fa 02             	cmp    $0x2,%edx
+  801dca:	77 e5                	ja     801db1 <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  801dcc:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801dcf:	83 f8 02             	cmp    $0x2,%eax
+  801dd2:	0f 97 c1             	seta   %cl
+  801dd5:	0f b6 c9             	movzbl %cl,%ecx
+  801dd8:	eb d7                	jmp    801db1 <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  801dda:	be 00 00 00 00       	mov    $0x0,%esi
+  801ddf:	b8 14 00 00 00       	mov    $0x14,%eax
+  801de4:	8b 55 08             	mov    0x8(%ebp),%edx
+  801de7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801dea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ded:	89 f7                	mov    %esi,%edi
+  801def:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  801df1:	eb 96                	jmp    801d89 <sys_spawn+0x3b>
+
+00801df3 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  801df3:	55                   	push   %ebp
+  801df4:	89 e5                	mov    %esp,%ebp
+  801df6:	57                   	push   %edi
+  801df7:	56                   	push   %esi
+  801df8:	53                   	push   %ebx
+  801df9:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801dfc:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e03:	78 37                	js     801e3c <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  801e05:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e0c:	74 7a                	je     801e88 <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  801e0e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e13:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e16:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e19:	b8 15 00 00 00       	mov    $0x15,%eax
+  801e1e:	89 df                	mov    %ebx,%edi
+  801e20:	89 de                	mov    %ebx,%esi
+  801e22:	55                   	push   %ebp
+  801e23:	68 2c 1e 80 00       	push   $0x801e2c
+  801e28:	89 e5                	mov    %esp,%ebp
+  801e2a:	0f 34                	sysenter
+  801e2c:	83 c4 04             	add    $0x4,%esp
+  801e2f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801e30:	85 c0                	test   %eax,%eax
+  801e32:	7f 6c                	jg     801ea0 <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  801e34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e37:	5b                   	pop    %ebx
+  801e38:	5e                   	pop    %esi
+  801e39:	5f                   	pop    %edi
+  801e3a:	5d                   	pop    %ebp
+  801e3b:	c3                   	ret
+  801e3c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e41:	0f a2                	cpuid
+		return 0;
+  801e43:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801e48:	f6 c6 08             	test   $0x8,%dh
+  801e4b:	74 15                	je     801e62 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e4d:	89 c2                	mov    %eax,%edx
+  801e4f:	c1 ea 08             	shr    $0x8,%edx
+  801e52:	83 e2 0f             	and    $0xf,%edx
+  801e55:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e5a:	83 fa 06             	cmp    $0x6,%edx
+  801e5d:	74 0e                	je     801e6d <sys_shm_create+0x7a>
+  801e5f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801e62:	0f b6 c9             	movzbl %cl,%ecx
+  801e65:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801e6b:	eb 98                	jmp    801e05 <sys_shm_create+0x12>
+  801e6d:	89 c2                	mov    %eax,%edx
+  801e6f:	c1 ea 04             	shr    $0x4,%edx
+  801e72:	83 e2 0f             	and    $0xf,%edx
+  801e75:	83 fa 02             	cmp    $0x2,%edx
+  801e78:	77 e5                	ja     801e5f <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  801e7a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e7d:	83 f8 02             	cmp    $0x2,%eax
+  801e80:	0f 97 c1             	seta   %cl
+  801e83:	0f b6 c9             	movzbl %cl,%ecx
+  801e86:	eb d7                	jmp    801e5f <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  801e88:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e8d:	b8 15 00 00 00       	mov    $0x15,%eax
+  801e92:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e95:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e98:	89 df                	mov    %ebx,%edi
+  801e9a:	89 de                	mov    %ebx,%esi
+  801e9c:	cd 30                	int    $0x30
+  801e9e:	eb 90                	jmp    801e30 <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801ea0:	83 ec 0c             	sub    $0xc,%esp
+  801ea3:	50                   	push   %eax
+  801ea4:	6a 15                	push   $0x15
+  801ea6:	68 f9 31 80 00       	push   $0x8031f9
+  801eab:	6a 4a                	push   $0x4a
+  801ead:	68 16 32 80 00       	push   $0x803216
+  801eb2:	e8 2f 0d 00 00       	call   802be6 <_panic>
+
+00801eb7 <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  801eb7:	55                   	push   %ebp
+  801eb8:	89 e5                	mov    %esp,%ebp
+  801eba:	57                   	push   %edi
+  801ebb:	56                   	push   %esi
+  801ebc:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801ebd:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ec4:	78 32                	js     801ef8 <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  801ec6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ecd:	74 75                	je     801f44 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801ecf:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ed2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ed5:	b8 16 00 00 00       	mov    $0x16,%eax
+  801eda:	be 00 00 00 00       	mov    $0x0,%esi
+  801edf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ee2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ee5:	55                   	push   %ebp
+  801ee6:	68 ef 1e 80 00       	push   $0x801eef
+  801eeb:	89 e5                	mov    %esp,%ebp
+  801eed:	0f 34                	sysenter
+  801eef:	83 c4 04             	add    $0x4,%esp
+  801ef2:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  801ef3:	5b                   	pop    %ebx
+  801ef4:	5e                   	pop    %esi
+  801ef5:	5f                   	pop    %edi
+  801ef6:	5d                   	pop    %ebp
+  801ef7:	c3                   	ret
+  801ef8:	b8 01 00 00 00       	mov    $0x1,%eax
+  801efd:	0f a2                	cpuid
+		return 0;
+  801eff:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801f04:	f6 c6 08             	test   $0x8,%dh
+  801f07:	74 15                	je     801f1e <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f09:	89 c2                	mov    %eax,%edx
+  801f0b:	c1 ea 08             	shr    $0x8,%edx
+  801f0e:	83 e2 0f             	and    $0xf,%edx
+  801f11:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f16:	83 fa 06             	cmp    $0x6,%edx
+  801f19:	74 0e                	je     801f29 <sys_shm_attach+0x72>
+  801f1b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801f1e:	0f b6 c9             	movzbl %cl,%ecx
+  801f21:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801f27:	eb 9d                	jmp    801ec6 <sys_shm_attach+0xf>
+  801f29:	89 c2                	mov    %eax,%edx
+  801f2b:	c1 ea 04             	shr    $0x4,%edx
+  801f2e:	83 e2 0f             	and    $0xf,%edx
+  801f31:	83 fa 02             	cmp    $0x2,%edx
+  801f34:	77 e5                	ja     801f1b <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  801f36:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f39:	83 f8 02             	cmp    $0x2,%eax
+  801f3c:	0f 97 c1             	seta   %cl
+  801f3f:	0f b6 c9             	movzbl %cl,%ecx
+  801f42:	eb d7                	jmp    801f1b <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  801f44:	b8 16 00 00 00       	mov    $0x16,%eax
+  801f49:	be 00 00 00 00       	mov    $0x0,%esi
+  801f4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f54:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f57:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801f5a:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  801f5c:	eb 95                	jmp    801ef3 <sys_shm_attach+0x3c>
+
+00801f5e <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  801f5e:	55                   	push   %ebp
+  801f5f:	89 e5                	mov    %esp,%ebp
+  801f61:	57                   	push   %edi
+  801f62:	56                   	push   %esi
+  801f63:	53                   	push   %ebx
+  801f64:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801f67:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f6e:	78 38                	js     801fa8 <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  801f70:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f77:	74 7b                	je     801ff4 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  801f79:	be 00 00 00 00       	mov    $0x0,%esi
+  801f7e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f81:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f84:	b8 17 00 00 00       	mov    $0x17,%eax
+  801f89:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f8c:	89 f7                	mov    %esi,%edi
+  801f8e:	55                   	push   %ebp
+  801f8f:	68 98 1f 80 00       	push   $0x801f98
+  801f94:	89 e5                	mov    %esp,%ebp
+  801f96:	0f 34                	sysenter
+  801f98:	83 c4 04             	add    $0x4,%esp
+  801f9b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801f9c:	85 c0                	test   %eax,%eax
+  801f9e:	7f 6d                	jg     80200d <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  801fa0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fa3:	5b                   	pop    %ebx
+  801fa4:	5e                   	pop    %esi
+  801fa5:	5f                   	pop    %edi
+  801fa6:	5d                   	pop    %ebp
+  801fa7:	c3                   	ret
+  801fa8:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fad:	0f a2                	cpuid
+		return 0;
+  801faf:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801fb4:	f6 c6 08             	test   $0x8,%dh
+  801fb7:	74 15                	je     801fce <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fb9:	89 c2                	mov    %eax,%edx
+  801fbb:	c1 ea 08             	shr    $0x8,%edx
+  801fbe:	83 e2 0f             	and    $0xf,%edx
+  801fc1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801fc6:	83 fa 06             	cmp    $0x6,%edx
+  801fc9:	74 0e                	je     801fd9 <sys_shm_detach+0x7b>
+  801fcb:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801fce:	0f b6 c9             	movzbl %cl,%ecx
+  801fd1:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801fd7:	eb 97                	jmp    801f70 <sys_shm_detach+0x12>
+  801fd9:	89 c2                	mov    %eax,%edx
+  801fdb:	c1 ea 04             	shr    $0x4,%edx
+  801fde:	83 e2 0f             	and    $0xf,%edx
+  801fe1:	83 fa 02             	cmp    $0x2,%edx
+  801fe4:	77 e5                	ja     801fcb <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  801fe6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fe9:	83 f8 02             	cmp    $0x2,%eax
+  801fec:	0f 97 c1             	seta   %cl
+  801fef:	0f b6 c9             	movzbl %cl,%ecx
+  801ff2:	eb d7                	jmp    801fcb <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  801ff4:	be 00 00 00 00       	mov    $0x0,%esi
+  801ff9:	b8 17 00 00 00       	mov    $0x17,%eax
+  801ffe:	8b 55 08             	mov    0x8(%ebp),%edx
+  802001:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802004:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802007:	89 f7                	mov    %esi,%edi
+  802009:	cd 30                	int    $0x30
+  80200b:	eb 8f                	jmp    801f9c <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80200d:	83 ec 0c             	sub    $0xc,%esp
+  802010:	50                   	push   %eax
+  802011:	6a 17                	push   $0x17
+  802013:	68 f9 31 80 00       	push   $0x8031f9
+  802018:	6a 4a                	push   $0x4a
+  80201a:	68 16 32 80 00       	push   $0x803216
+  80201f:	e8 c2 0b 00 00       	call   802be6 <_panic>
+
+00802024 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  802024:	55                   	push   %ebp
+  802025:	89 e5                	mov    %esp,%ebp
+  802027:	57                   	push   %edi
+  802028:	56                   	push   %esi
+  802029:	53                   	push   %ebx
+  80202a:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80202d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802034:	78 36                	js     80206c <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  802036:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80203d:	74 79                	je     8020b8 <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  80203f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802042:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802047:	b8 18 00 00 00       	mov    $0x18,%eax
+  80204c:	89 cb                	mov    %ecx,%ebx
+  80204e:	89 cf                	mov    %ecx,%edi
+  802050:	89 ce                	mov    %ecx,%esi
+  802052:	55                   	push   %ebp
+  802053:	68 5c 20 80 00       	push   $0x80205c
+  802058:	89 e5                	mov    %esp,%ebp
+  80205a:	0f 34                	sysenter
+  80205c:	83 c4 04             	add    $0x4,%esp
+  80205f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802060:	85 c0                	test   %eax,%eax
+  802062:	7f 6b                	jg     8020cf <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  802064:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802067:	5b                   	pop    %ebx
+  802068:	5e                   	pop    %esi
+  802069:	5f                   	pop    %edi
+  80206a:	5d                   	pop    %ebp
+  80206b:	c3                   	ret
+  80206c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802071:	0f a2                	cpuid
+		return 0;
+  802073:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802078:	f6 c6 08             	test   $0x8,%dh
+  80207b:	74 15                	je     802092 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80207d:	89 c2                	mov    %eax,%edx
+  80207f:	c1 ea 08             	shr    $0x8,%edx
+  802082:	83 e2 0f             	and    $0xf,%edx
+  802085:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80208a:	83 fa 06             	cmp    $0x6,%edx
+  80208d:	74 0e                	je     80209d <sys_shm_remove+0x79>
+  80208f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802092:	0f b6 c9             	movzbl %cl,%ecx
+  802095:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80209b:	eb 99                	jmp    802036 <sys_shm_remove+0x12>
+  80209d:	89 c2                	mov    %eax,%edx
+  80209f:	c1 ea 04             	shr    $0x4,%edx
+  8020a2:	83 e2 0f             	and    $0xf,%edx
+  8020a5:	83 fa 02             	cmp    $0x2,%edx
+  8020a8:	77 e5                	ja     80208f <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  8020aa:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020ad:	83 f8 02             	cmp    $0x2,%eax
+  8020b0:	0f 97 c1             	seta   %cl
+  8020b3:	0f b6 c9             	movzbl %cl,%ecx
+  8020b6:	eb d7                	jmp    80208f <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  8020b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020bd:	b8 18 00 00 00       	mov    $0x18,%eax
+  8020c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020c5:	89 cb                	mov    %ecx,%ebx
+  8020c7:	89 cf                	mov    %ecx,%edi
+  8020c9:	89 ce                	mov    %ecx,%esi
+  8020cb:	cd 30                	int    $0x30
+  8020cd:	eb 91                	jmp    802060 <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8020cf:	83 ec 0c             	sub    $0xc,%esp
+  8020d2:	50                   	push   %eax
+  8020d3:	6a 18                	push   $0x18
+  8020d5:	68 f9 31 80 00       	push   $0x8031f9
+  8020da:	6a 4a                	push   $0x4a
+  8020dc:	68 16 32 80 00       	push   $0x803216
+  8020e1:	e8 00 0b 00 00       	call   802be6 <_panic>
+
+008020e6 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  8020e6:	55                   	push   %ebp
+  8020e7:	89 e5                	mov    %esp,%ebp
+  8020e9:	57                   	push   %edi
+  8020ea:	56                   	push   %esi
+  8020eb:	53                   	push   %ebx
+  8020ec:	83 ec 0c             	sub    $0xc,%esp
+  8020ef:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020f2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8020f5:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  8020f8:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8020ff:	78 32                	js     802133 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  802101:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802108:	74 75                	je     80217f <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  80210a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80210d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802110:	b8 20 00 00 00       	mov    $0x20,%eax
+  802115:	be 00 00 00 00       	mov    $0x0,%esi
+  80211a:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  80211d:	55                   	push   %ebp
+  80211e:	68 27 21 80 00       	push   $0x802127
+  802123:	89 e5                	mov    %esp,%ebp
+  802125:	0f 34                	sysenter
+  802127:	83 c4 04             	add    $0x4,%esp
+  80212a:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  80212b:	83 c4 0c             	add    $0xc,%esp
+  80212e:	5b                   	pop    %ebx
+  80212f:	5e                   	pop    %esi
+  802130:	5f                   	pop    %edi
+  802131:	5d                   	pop    %ebp
+  802132:	c3                   	ret
+  802133:	b8 01 00 00 00       	mov    $0x1,%eax
+  802138:	0f a2                	cpuid
+		return 0;
+  80213a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80213f:	f6 c6 08             	test   $0x8,%dh
+  802142:	74 15                	je     802159 <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802144:	89 c2                	mov    %eax,%edx
+  802146:	c1 ea 08             	shr    $0x8,%edx
+  802149:	83 e2 0f             	and    $0xf,%edx
+  80214c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802151:	83 fa 06             	cmp    $0x6,%edx
+  802154:	74 0e                	je     802164 <sys_futex_wait+0x7e>
+  802156:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802159:	0f b6 c9             	movzbl %cl,%ecx
+  80215c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802162:	eb 9d                	jmp    802101 <sys_futex_wait+0x1b>
+  802164:	89 c2                	mov    %eax,%edx
+  802166:	c1 ea 04             	shr    $0x4,%edx
+  802169:	83 e2 0f             	and    $0xf,%edx
+  80216c:	83 fa 02             	cmp    $0x2,%edx
+  80216f:	77 e5                	ja     802156 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  802171:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802174:	83 f8 02             	cmp    $0x2,%eax
+  802177:	0f 97 c1             	seta   %cl
+  80217a:	0f b6 c9             	movzbl %cl,%ecx
+  80217d:	eb d7                	jmp    802156 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  80217f:	b8 20 00 00 00       	mov    $0x20,%eax
+  802184:	be 00 00 00 00       	mov    $0x0,%esi
+  802189:	8b 55 08             	mov    0x8(%ebp),%edx
+  80218c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80218f:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802192:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  802194:	eb 95                	jmp    80212b <sys_futex_wait+0x45>
+
+00802196 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  802196:	55                   	push   %ebp
+  802197:	89 e5                	mov    %esp,%ebp
+  802199:	57                   	push   %edi
+  80219a:	56                   	push   %esi
+  80219b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80219c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8021a3:	78 30                	js     8021d5 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  8021a5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8021ac:	74 73                	je     802221 <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  8021ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021b9:	b8 21 00 00 00       	mov    $0x21,%eax
+  8021be:	89 df                	mov    %ebx,%edi
+  8021c0:	89 de                	mov    %ebx,%esi
+  8021c2:	55                   	push   %ebp
+  8021c3:	68 cc 21 80 00       	push   $0x8021cc
+  8021c8:	89 e5                	mov    %esp,%ebp
+  8021ca:	0f 34                	sysenter
+  8021cc:	83 c4 04             	add    $0x4,%esp
+  8021cf:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8021d0:	5b                   	pop    %ebx
+  8021d1:	5e                   	pop    %esi
+  8021d2:	5f                   	pop    %edi
+  8021d3:	5d                   	pop    %ebp
+  8021d4:	c3                   	ret
+  8021d5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021da:	0f a2                	cpuid
+		return 0;
+  8021dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8021e1:	f6 c6 08             	test   $0x8,%dh
+  8021e4:	74 15                	je     8021fb <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021e6:	89 c2                	mov    %eax,%edx
+  8021e8:	c1 ea 08             	shr    $0x8,%edx
+  8021eb:	83 e2 0f             	and    $0xf,%edx
+  8021ee:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8021f3:	83 fa 06             	cmp    $0x6,%edx
+  8021f6:	74 0e                	je     802206 <sys_futex_wake+0x70>
+  8021f8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8021fb:	0f b6 c9             	movzbl %cl,%ecx
+  8021fe:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802204:	eb 9f                	jmp    8021a5 <sys_futex_wake+0xf>
+  802206:	89 c2                	mov    %eax,%edx
+  802208:	c1 ea 04             	shr    $0x4,%edx
+  80220b:	83 e2 0f             	and    $0xf,%edx
+  80220e:	83 fa 02             	cmp    $0x2,%edx
+  802211:	77 e5                	ja     8021f8 <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  802213:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802216:	83 f8 02             	cmp    $0x2,%eax
+  802219:	0f 97 c1             	seta   %cl
+  80221c:	0f b6 c9             	movzbl %cl,%ecx
+  80221f:	eb d7                	jmp    8021f8 <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  802221:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802226:	b8 21 00 00 00       	mov    $0x21,%eax
+  80222b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80222e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802231:	89 df                	mov    %ebx,%edi
+  802233:	89 de                	mov    %ebx,%esi
+  802235:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  802237:	eb 97                	jmp    8021d0 <sys_futex_wake+0x3a>
+
+00802239 <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  802239:	55                   	push   %ebp
+  80223a:	89 e5                	mov    %esp,%ebp
+  80223c:	57                   	push   %edi
+  80223d:	56                   	push   %esi
+  80223e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80223f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802246:	78 2e                	js     802276 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  802248:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80224f:	74 71                	je     8022c2 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  802251:	ba 00 00 00 00       	mov    $0x0,%edx
+  802256:	b8 22 00 00 00       	mov    $0x22,%eax
+  80225b:	89 d1                	mov    %edx,%ecx
+  80225d:	89 d3                	mov    %edx,%ebx
+  80225f:	89 d7                	mov    %edx,%edi
+  802261:	89 d6                	mov    %edx,%esi
+  802263:	55                   	push   %ebp
+  802264:	68 6d 22 80 00       	push   $0x80226d
+  802269:	89 e5                	mov    %esp,%ebp
+  80226b:	0f 34                	sysenter
+  80226d:	83 c4 04             	add    $0x4,%esp
+  802270:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  802271:	5b                   	pop    %ebx
+  802272:	5e                   	pop    %esi
+  802273:	5f                   	pop    %edi
+  802274:	5d                   	pop    %ebp
+  802275:	c3                   	ret
+  802276:	b8 01 00 00 00       	mov    $0x1,%eax
+  80227b:	0f a2                	cpuid
+		return 0;
+  80227d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802282:	f6 c6 08             	test   $0x8,%dh
+  802285:	74 15                	je     80229c <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802287:	89 c2                	mov    %eax,%edx
+  802289:	c1 ea 08             	shr    $0x8,%edx
+  80228c:	83 e2 0f             	and    $0xf,%edx
+  80228f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802294:	83 fa 06             	cmp    $0x6,%edx
+  802297:	74 0e                	je     8022a7 <sys_ep_create+0x6e>
+  802299:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80229c:	0f b6 c9             	movzbl %cl,%ecx
+  80229f:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8022a5:	eb a1                	jmp    802248 <sys_ep_create+0xf>
+  8022a7:	89 c2                	mov    %eax,%edx
+  8022a9:	c1 ea 04             	shr    $0x4,%edx
+  8022ac:	83 e2 0f             	and    $0xf,%edx
+  8022af:	83 fa 02             	cmp    $0x2,%edx
+  8022b2:	77 e5                	ja     802299 <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  8022b4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022b7:	83 f8 02             	cmp    $0x2,%eax
+  8022ba:	0f 97 c1             	seta   %cl
+  8022bd:	0f b6 c9             	movzbl %cl,%ecx
+  8022c0:	eb d7                	jmp    802299 <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  8022c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022c7:	b8 22 00 00 00       	mov    $0x22,%eax
+  8022cc:	89 d1                	mov    %edx,%ecx
+  8022ce:	89 d3                	mov    %edx,%ebx
+  8022d0:	89 d7                	mov    %edx,%edi
+  8022d2:	89 d6                	mov    %edx,%esi
+  8022d4:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  8022d6:	eb 99                	jmp    802271 <sys_ep_create+0x38>
+
+008022d8 <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  8022d8:	55                   	push   %ebp
+  8022d9:	89 e5                	mov    %esp,%ebp
+  8022db:	57                   	push   %edi
+  8022dc:	56                   	push   %esi
+  8022dd:	53                   	push   %ebx
+  8022de:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8022e1:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8022e8:	78 36                	js     802320 <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  8022ea:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8022f1:	74 79                	je     80236c <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  8022f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022fb:	b8 23 00 00 00       	mov    $0x23,%eax
+  802300:	89 cb                	mov    %ecx,%ebx
+  802302:	89 cf                	mov    %ecx,%edi
+  802304:	89 ce                	mov    %ecx,%esi
+  802306:	55                   	push   %ebp
+  802307:	68 10 23 80 00       	push   $0x802310
+  80230c:	89 e5                	mov    %esp,%ebp
+  80230e:	0f 34                	sysenter
+  802310:	83 c4 04             	add    $0x4,%esp
+  802313:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802314:	85 c0                	test   %eax,%eax
+  802316:	7f 6b                	jg     802383 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  802318:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80231b:	5b                   	pop    %ebx
+  80231c:	5e                   	pop    %esi
+  80231d:	5f                   	pop    %edi
+  80231e:	5d                   	pop    %ebp
+  80231f:	c3                   	ret
+  802320:	b8 01 00 00 00       	mov    $0x1,%eax
+  802325:	0f a2                	cpuid
+		return 0;
+  802327:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80232c:	f6 c6 08             	test   $0x8,%dh
+  80232f:	74 15                	je     802346 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802331:	89 c2                	mov    %eax,%edx
+  802333:	c1 ea 08             	shr    $0x8,%edx
+  802336:	83 e2 0f             	and    $0xf,%edx
+  802339:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80233e:	83 fa 06             	cmp    $0x6,%edx
+  802341:	74 0e                	je     802351 <sys_ep_destroy+0x79>
+  802343:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802346:	0f b6 c9             	movzbl %cl,%ecx
+  802349:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80234f:	eb 99                	jmp    8022ea <sys_ep_destroy+0x12>
+  802351:	89 c2                	mov    %eax,%edx
+  802353:	c1 ea 04             	shr    $0x4,%edx
+  802356:	83 e2 0f             	and    $0xf,%edx
+  802359:	83 fa 02             	cmp    $0x2,%edx
+  80235c:	77 e5                	ja     802343 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  80235e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802361:	83 f8 02             	cmp    $0x2,%eax
+  802364:	0f 97 c1             	seta   %cl
+  802367:	0f b6 c9             	movzbl %cl,%ecx
+  80236a:	eb d7                	jmp    802343 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  80236c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802371:	b8 23 00 00 00       	mov    $0x23,%eax
+  802376:	8b 55 08             	mov    0x8(%ebp),%edx
+  802379:	89 cb                	mov    %ecx,%ebx
+  80237b:	89 cf                	mov    %ecx,%edi
+  80237d:	89 ce                	mov    %ecx,%esi
+  80237f:	cd 30                	int    $0x30
+  802381:	eb 91                	jmp    802314 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802383:	83 ec 0c             	sub    $0xc,%esp
+  802386:	50                   	push   %eax
+  802387:	6a 23                	push   $0x23
+  802389:	68 f9 31 80 00       	push   $0x8031f9
+  80238e:	6a 4a                	push   $0x4a
+  802390:	68 16 32 80 00       	push   $0x803216
+  802395:	e8 4c 08 00 00       	call   802be6 <_panic>
+
+0080239a <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  80239a:	55                   	push   %ebp
+  80239b:	89 e5                	mov    %esp,%ebp
+  80239d:	57                   	push   %edi
+  80239e:	56                   	push   %esi
+  80239f:	53                   	push   %ebx
+  8023a0:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8023a3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8023aa:	78 37                	js     8023e3 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  8023ac:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8023b3:	74 7a                	je     80242f <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  8023b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023c0:	b8 24 00 00 00       	mov    $0x24,%eax
+  8023c5:	89 df                	mov    %ebx,%edi
+  8023c7:	89 de                	mov    %ebx,%esi
+  8023c9:	55                   	push   %ebp
+  8023ca:	68 d3 23 80 00       	push   $0x8023d3
+  8023cf:	89 e5                	mov    %esp,%ebp
+  8023d1:	0f 34                	sysenter
+  8023d3:	83 c4 04             	add    $0x4,%esp
+  8023d6:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8023d7:	85 c0                	test   %eax,%eax
+  8023d9:	7f 6c                	jg     802447 <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  8023db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023de:	5b                   	pop    %ebx
+  8023df:	5e                   	pop    %esi
+  8023e0:	5f                   	pop    %edi
+  8023e1:	5d                   	pop    %ebp
+  8023e2:	c3                   	ret
+  8023e3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023e8:	0f a2                	cpuid
+		return 0;
+  8023ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8023ef:	f6 c6 08             	test   $0x8,%dh
+  8023f2:	74 15                	je     802409 <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023f4:	89 c2                	mov    %eax,%edx
+  8023f6:	c1 ea 08             	shr    $0x8,%edx
+  8023f9:	83 e2 0f             	and    $0xf,%edx
+  8023fc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802401:	83 fa 06             	cmp    $0x6,%edx
+  802404:	74 0e                	je     802414 <sys_ep_grant+0x7a>
+  802406:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802409:	0f b6 c9             	movzbl %cl,%ecx
+  80240c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802412:	eb 98                	jmp    8023ac <sys_ep_grant+0x12>
+  802414:	89 c2                	mov    %eax,%edx
+  802416:	c1 ea 04             	shr    $0x4,%edx
+  802419:	83 e2 0f             	and    $0xf,%edx
+  80241c:	83 fa 02             	cmp    $0x2,%edx
+  80241f:	77 e5                	ja     802406 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  802421:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802424:	83 f8 02             	cmp    $0x2,%eax
+  802427:	0f 97 c1             	seta   %cl
+  80242a:	0f b6 c9             	movzbl %cl,%ecx
+  80242d:	eb d7                	jmp    802406 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  80242f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802434:	b8 24 00 00 00       	mov    $0x24,%eax
+  802439:	8b 55 08             	mov    0x8(%ebp),%edx
+  80243c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80243f:	89 df                	mov    %ebx,%edi
+  802441:	89 de                	mov    %ebx,%esi
+  802443:	cd 30                	int    $0x30
+  802445:	eb 90                	jmp    8023d7 <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802447:	83 ec 0c             	sub    $0xc,%esp
+  80244a:	50                   	push   %eax
+  80244b:	6a 24                	push   $0x24
+  80244d:	68 f9 31 80 00       	push   $0x8031f9
+  802452:	6a 4a                	push   $0x4a
+  802454:	68 16 32 80 00       	push   $0x803216
+  802459:	e8 88 07 00 00       	call   802be6 <_panic>
+
+0080245e <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  80245e:	55                   	push   %ebp
+  80245f:	89 e5                	mov    %esp,%ebp
+  802461:	57                   	push   %edi
+  802462:	56                   	push   %esi
+  802463:	53                   	push   %ebx
+  802464:	83 ec 20             	sub    $0x20,%esp
+  802467:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  80246a:	8b 10                	mov    (%eax),%edx
+  80246c:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  80246f:	8b 50 04             	mov    0x4(%eax),%edx
+  802472:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802475:	8b 50 08             	mov    0x8(%eax),%edx
+  802478:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  80247b:	8b 50 0c             	mov    0xc(%eax),%edx
+  80247e:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  802481:	8b 40 10             	mov    0x10(%eax),%eax
+  802484:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  802487:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  80248a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80248d:	b8 25 00 00 00       	mov    $0x25,%eax
+  802492:	55                   	push   %ebp
+  802493:	56                   	push   %esi
+  802494:	8b 0e                	mov    (%esi),%ecx
+  802496:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802499:	8b 7e 08             	mov    0x8(%esi),%edi
+  80249c:	8b 6e 10             	mov    0x10(%esi),%ebp
+  80249f:	8b 76 0c             	mov    0xc(%esi),%esi
+  8024a2:	cd 30                	int    $0x30
+  8024a4:	87 34 24             	xchg   %esi,(%esp)
+  8024a7:	89 0e                	mov    %ecx,(%esi)
+  8024a9:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8024ac:	89 7e 08             	mov    %edi,0x8(%esi)
+  8024af:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8024b2:	8f 46 0c             	pop    0xc(%esi)
+  8024b5:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  8024b6:	83 c4 20             	add    $0x20,%esp
+  8024b9:	5b                   	pop    %ebx
+  8024ba:	5e                   	pop    %esi
+  8024bb:	5f                   	pop    %edi
+  8024bc:	5d                   	pop    %ebp
+  8024bd:	c3                   	ret
+
+008024be <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  8024be:	55                   	push   %ebp
+  8024bf:	89 e5                	mov    %esp,%ebp
+  8024c1:	57                   	push   %edi
+  8024c2:	56                   	push   %esi
+  8024c3:	53                   	push   %ebx
+  8024c4:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  8024c7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024ca:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  8024cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024cf:	b8 26 00 00 00       	mov    $0x26,%eax
+  8024d4:	55                   	push   %ebp
+  8024d5:	56                   	push   %esi
+  8024d6:	8b 0e                	mov    (%esi),%ecx
+  8024d8:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8024db:	8b 7e 08             	mov    0x8(%esi),%edi
+  8024de:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8024e1:	8b 76 0c             	mov    0xc(%esi),%esi
+  8024e4:	cd 30                	int    $0x30
+  8024e6:	87 34 24             	xchg   %esi,(%esp)
+  8024e9:	89 0e                	mov    %ecx,(%esi)
+  8024eb:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8024ee:	89 7e 08             	mov    %edi,0x8(%esi)
+  8024f1:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8024f4:	8f 46 0c             	pop    0xc(%esi)
+  8024f7:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  8024f8:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  8024fc:	74 0f                	je     80250d <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  8024fe:	85 c0                	test   %eax,%eax
+  802500:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802505:	0f 48 d1             	cmovs  %ecx,%edx
+  802508:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  80250b:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  80250d:	5b                   	pop    %ebx
+  80250e:	5e                   	pop    %esi
+  80250f:	5f                   	pop    %edi
+  802510:	5d                   	pop    %ebp
+  802511:	c3                   	ret
+
+00802512 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  802512:	55                   	push   %ebp
+  802513:	89 e5                	mov    %esp,%ebp
+  802515:	57                   	push   %edi
+  802516:	56                   	push   %esi
+  802517:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802518:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80251f:	78 2f                	js     802550 <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  802521:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802528:	74 72                	je     80259c <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  80252a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80252d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802532:	b8 27 00 00 00       	mov    $0x27,%eax
+  802537:	89 cb                	mov    %ecx,%ebx
+  802539:	89 cf                	mov    %ecx,%edi
+  80253b:	89 ce                	mov    %ecx,%esi
+  80253d:	55                   	push   %ebp
+  80253e:	68 47 25 80 00       	push   $0x802547
+  802543:	89 e5                	mov    %esp,%ebp
+  802545:	0f 34                	sysenter
+  802547:	83 c4 04             	add    $0x4,%esp
+  80254a:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  80254b:	5b                   	pop    %ebx
+  80254c:	5e                   	pop    %esi
+  80254d:	5f                   	pop    %edi
+  80254e:	5d                   	pop    %ebp
+  80254f:	c3                   	ret
+  802550:	b8 01 00 00 00       	mov    $0x1,%eax
+  802555:	0f a2                	cpuid
+		return 0;
+  802557:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80255c:	f6 c6 08             	test   $0x8,%dh
+  80255f:	74 15                	je     802576 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802561:	89 c2                	mov    %eax,%edx
+  802563:	c1 ea 08             	shr    $0x8,%edx
+  802566:	83 e2 0f             	and    $0xf,%edx
+  802569:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80256e:	83 fa 06             	cmp    $0x6,%edx
+  802571:	74 0e                	je     802581 <sys_sysring_setup+0x6f>
+  802573:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802576:	0f b6 c9             	movzbl %cl,%ecx
+  802579:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80257f:	eb a0                	jmp    802521 <sys_sysring_setup+0xf>
+  802581:	89 c2                	mov    %eax,%edx
+  802583:	c1 ea 04             	shr    $0x4,%edx
+  802586:	83 e2 0f             	and    $0xf,%edx
+  802589:	83 fa 02             	cmp    $0x2,%edx
+  80258c:	77 e5                	ja     802573 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  80258e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802591:	83 f8 02             	cmp    $0x2,%eax
+  802594:	0f 97 c1             	seta   %cl
+  802597:	0f b6 c9             	movzbl %cl,%ecx
+  80259a:	eb d7                	jmp    802573 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  80259c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025a1:	b8 27 00 00 00       	mov    $0x27,%eax
+  8025a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025a9:	89 cb                	mov    %ecx,%ebx
+  8025ab:	89 cf                	mov    %ecx,%edi
+  8025ad:	89 ce                	mov    %ecx,%esi
+  8025af:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  8025b1:	eb 98                	jmp    80254b <sys_sysring_setup+0x39>
+
+008025b3 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  8025b3:	55                   	push   %ebp
+  8025b4:	89 e5                	mov    %esp,%ebp
+  8025b6:	57                   	push   %edi
+  8025b7:	56                   	push   %esi
+  8025b8:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8025b9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8025c0:	78 2e                	js     8025f0 <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  8025c2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8025c9:	74 71                	je     80263c <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  8025cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025d0:	b8 28 00 00 00       	mov    $0x28,%eax
+  8025d5:	89 d1                	mov    %edx,%ecx
+  8025d7:	89 d3                	mov    %edx,%ebx
+  8025d9:	89 d7                	mov    %edx,%edi
+  8025db:	89 d6                	mov    %edx,%esi
+  8025dd:	55                   	push   %ebp
+  8025de:	68 e7 25 80 00       	push   $0x8025e7
+  8025e3:	89 e5                	mov    %esp,%ebp
+  8025e5:	0f 34                	sysenter
+  8025e7:	83 c4 04             	add    $0x4,%esp
+  8025ea:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8025eb:	5b                   	pop    %ebx
+  8025ec:	5e                   	pop    %esi
+  8025ed:	5f                   	pop    %edi
+  8025ee:	5d                   	pop    %ebp
+  8025ef:	c3                   	ret
+  8025f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025f5:	0f a2                	cpuid
+		return 0;
+  8025f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8025fc:	f6 c6 08             	test   $0x8,%dh
+  8025ff:	74 15                	je     802616 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802601:	89 c2                	mov    %eax,%edx
+  802603:	c1 ea 08             	shr    $0x8,%edx
+  802606:	83 e2 0f             	and    $0xf,%edx
+  802609:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80260e:	83 fa 06             	cmp    $0x6,%edx
+  802611:	74 0e                	je     802621 <sys_sysring_enter+0x6e>
+  802613:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802616:	0f b6 c9             	movzbl %cl,%ecx
+  802619:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80261f:	eb a1                	jmp    8025c2 <sys_sysring_enter+0xf>
+  802621:	89 c2                	mov    %eax,%edx
+  802623:	c1 ea 04             	shr    $0x4,%edx
+  802626:	83 e2 0f             	and    $0xf,%edx
+  802629:	83 fa 02             	cmp    $0x2,%edx
+  80262c:	77 e5                	ja     802613 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  80262e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802631:	83 f8 02             	cmp    $0x2,%eax
+  802634:	0f 97 c1             	seta   %cl
+  802637:	0f b6 c9             	movzbl %cl,%ecx
+  80263a:	eb d7                	jmp    802613 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  80263c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802641:	b8 28 00 00 00       	mov    $0x28,%eax
+  802646:	89 d1                	mov    %edx,%ecx
+  802648:	89 d3                	mov    %edx,%ebx
+  80264a:	89 d7                	mov    %edx,%edi
+  80264c:	89 d6                	mov    %edx,%esi
+  80264e:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  802650:	eb 99                	jmp    8025eb <sys_sysring_enter+0x38>
+
+00802652 <pgfault>:
+// The kernel normally resolves these faults itself (page_fault_cow in
+// kern/trap.c); we only get here if it ran out of memory doing so.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802652:	55                   	push   %ebp
+  802653:	89 e5                	mov    %esp,%ebp
+  802655:	83 ec 08             	sub    $0x8,%esp
+  802658:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  80265b:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  80265d:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  802660:	f6 c2 02             	test   $0x2,%dl
+  802663:	74 40                	je     8026a5 <pgfault+0x53>
+  802665:	89 c1                	mov    %eax,%ecx
+  802667:	c1 e9 16             	shr    $0x16,%ecx
+  80266a:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802671:	f6 c1 01             	test   $0x1,%cl
+  802674:	74 2f                	je     8026a5 <pgfault+0x53>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW))
+  802676:	89 c1                	mov    %eax,%ecx
+  802678:	c1 e9 0c             	shr    $0xc,%ecx
+  80267b:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  802682:	f6 c5 08             	test   $0x8,%ch
+  802685:	74 1e                	je     8026a5 <pgfault+0x53>
+	// Replace the page with a private writable copy of itself.  The
+	// kernel allocates, copies and maps it in one system call, so no
+	// temporary mapping at PFTEMP is needed.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  802687:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r = sys_page_copy(0, addr, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  80268c:	83 ec 0c             	sub    $0xc,%esp
+  80268f:	6a 07                	push   $0x7
+  802691:	50                   	push   %eax
+  802692:	6a 00                	push   $0x0
+  802694:	50                   	push   %eax
+  802695:	6a 00                	push   $0x0
+  802697:	e8 85 eb ff ff       	call   801221 <sys_page_copy>
+  80269c:	83 c4 20             	add    $0x20,%esp
+  80269f:	85 c0                	test   %eax,%eax
+  8026a1:	78 18                	js     8026bb <pgfault+0x69>
+		panic("pgfault: sys_page_copy: %e", r);
+}
+  8026a3:	c9                   	leave
+  8026a4:	c3                   	ret
+		panic("pgfault: va %08x err %x is not a copy-on-write write",
+  8026a5:	83 ec 0c             	sub    $0xc,%esp
+  8026a8:	52                   	push   %edx
+  8026a9:	50                   	push   %eax
+  8026aa:	68 24 32 80 00       	push   $0x803224
+  8026af:	6a 1c                	push   $0x1c
+  8026b1:	68 59 32 80 00       	push   $0x803259
+  8026b6:	e8 2b 05 00 00       	call   802be6 <_panic>
+		panic("pgfault: sys_page_copy: %e", r);
+  8026bb:	50                   	push   %eax
+  8026bc:	68 64 32 80 00       	push   $0x803264
+  8026c1:	6a 26                	push   $0x26
+  8026c3:	68 59 32 80 00       	push   $0x803259
+  8026c8:	e8 19 05 00 00       	call   802be6 <_panic>
+
+008026cd <ufork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+ufork(void)
+{
+  8026cd:	55                   	push   %ebp
+  8026ce:	89 e5                	mov    %esp,%ebp
+  8026d0:	57                   	push   %edi
+  8026d1:	56                   	push   %esi
+  8026d2:	53                   	push   %ebx
+  8026d3:	81 ec 38 04 00 00    	sub    $0x438,%esp
+	struct page_range vec[PAGE_VEC_MAX], *last;
+	uintptr_t va;
+	size_t n;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8026d9:	68 52 26 80 00       	push   $0x802652
+  8026de:	e8 82 05 00 00       	call   802c65 <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8026e3:	b8 07 00 00 00       	mov    $0x7,%eax
+  8026e8:	cd 30                	int    $0x30
+  8026ea:	89 85 d4 fb ff ff    	mov    %eax,-0x42c(%ebp)
+
+	envid = sys_exofork();
+	if (envid < 0)
+  8026f0:	83 c4 10             	add    $0x10,%esp
+  8026f3:	85 c0                	test   %eax,%eax
+  8026f5:	0f 88 f2 01 00 00    	js     8028ed <ufork+0x220>
+		return 0;
+	}
+
+	// Copy every run of mapped pages below the exception stack, which
+	// must not be shared.
+	va = 0;
+  8026fb:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  802700:	74 0b                	je     80270d <ufork+0x40>
+  802702:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  802708:	e9 07 01 00 00       	jmp    802814 <ufork+0x147>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80270d:	e8 22 e8 ff ff       	call   800f34 <sys_getenvid>
+  802712:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802717:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  80271d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802722:	a3 08 40 80 00       	mov    %eax,0x804008
+		return 0;
+  802727:	e9 c1 01 00 00       	jmp    8028ed <ufork+0x220>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+		n = r;
+		last = &vec[n - 1];
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  80272c:	83 ea 01             	sub    $0x1,%edx
+  80272f:	89 c1                	mov    %eax,%ecx
+  802731:	c1 e1 04             	shl    $0x4,%ecx
+  802734:	89 94 0d ec fd ff ff 	mov    %edx,-0x214(%ebp,%ecx,1)
+			n--;
+  80273b:	85 d2                	test   %edx,%edx
+  80273d:	0f 44 f0             	cmove  %eax,%esi
+  802740:	e9 12 01 00 00       	jmp    802857 <ufork+0x18a>
+	for (i = 0; i < n; i++) {
+  802745:	83 c1 01             	add    $0x1,%ecx
+  802748:	83 c0 10             	add    $0x10,%eax
+  80274b:	39 8d e4 fb ff ff    	cmp    %ecx,-0x41c(%ebp)
+  802751:	74 6a                	je     8027bd <ufork+0xf0>
+		vec[i].pr_dstva = vec[i].pr_va;
+  802753:	89 c3                	mov    %eax,%ebx
+  802755:	8b 10                	mov    (%eax),%edx
+  802757:	89 50 0c             	mov    %edx,0xc(%eax)
+		if (vec[i].pr_perm & PTE_SHARE)
+  80275a:	8b 50 08             	mov    0x8(%eax),%edx
+  80275d:	f6 c6 04             	test   $0x4,%dh
+  802760:	75 e3                	jne    802745 <ufork+0x78>
+		if (vec[i].pr_perm & (PTE_W | PTE_COW)) {
+  802762:	f7 c2 02 08 00 00    	test   $0x802,%edx
+  802768:	74 db                	je     802745 <ufork+0x78>
+			vec[i].pr_perm = (vec[i].pr_perm & ~PTE_W) | PTE_COW;
+  80276a:	81 e2 fd f7 ff ff    	and    $0xfffff7fd,%edx
+  802770:	80 ce 08             	or     $0x8,%dh
+  802773:	89 95 dc fb ff ff    	mov    %edx,-0x424(%ebp)
+  802779:	89 53 08             	mov    %edx,0x8(%ebx)
+			cow[ncow++] = vec[i];
+  80277c:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  802782:	c1 e6 04             	shl    $0x4,%esi
+  802785:	89 f2                	mov    %esi,%edx
+  802787:	8d b4 35 e8 fb ff ff 	lea    -0x418(%ebp,%esi,1),%esi
+  80278e:	8b 38                	mov    (%eax),%edi
+  802790:	89 bc 15 e8 fb ff ff 	mov    %edi,-0x418(%ebp,%edx,1)
+  802797:	8b 78 04             	mov    0x4(%eax),%edi
+  80279a:	89 7e 04             	mov    %edi,0x4(%esi)
+  80279d:	8b bd dc fb ff ff    	mov    -0x424(%ebp),%edi
+  8027a3:	89 7e 08             	mov    %edi,0x8(%esi)
+  8027a6:	8b 50 0c             	mov    0xc(%eax),%edx
+  8027a9:	89 56 0c             	mov    %edx,0xc(%esi)
+  8027ac:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  8027b2:	8d 7e 01             	lea    0x1(%esi),%edi
+  8027b5:	89 bd e0 fb ff ff    	mov    %edi,-0x420(%ebp)
+  8027bb:	eb 88                	jmp    802745 <ufork+0x78>
+	if ((r = sys_page_map_vec(0, envid, vec, n, 0)) < 0)
+  8027bd:	8b b5 e4 fb ff ff    	mov    -0x41c(%ebp),%esi
+  8027c3:	8b bd d8 fb ff ff    	mov    -0x428(%ebp),%edi
+  8027c9:	83 ec 0c             	sub    $0xc,%esp
+  8027cc:	6a 00                	push   $0x0
+  8027ce:	56                   	push   %esi
+  8027cf:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  8027d5:	50                   	push   %eax
+  8027d6:	ff b5 d4 fb ff ff    	push   -0x42c(%ebp)
+  8027dc:	6a 00                	push   $0x0
+  8027de:	e8 80 f4 ff ff       	call   801c63 <sys_page_map_vec>
+  8027e3:	83 c4 20             	add    $0x20,%esp
+  8027e6:	85 c0                	test   %eax,%eax
+  8027e8:	0f 88 e5 00 00 00    	js     8028d3 <ufork+0x206>
+	return sys_page_map_vec(0, 0, cow, ncow, 0);
+  8027ee:	83 ec 0c             	sub    $0xc,%esp
+  8027f1:	6a 00                	push   $0x0
+  8027f3:	ff b5 e0 fb ff ff    	push   -0x420(%ebp)
+  8027f9:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  8027ff:	50                   	push   %eax
+  802800:	6a 00                	push   $0x0
+  802802:	6a 00                	push   $0x0
+  802804:	e8 5a f4 ff ff       	call   801c63 <sys_page_map_vec>
+		if ((r = duppages(envid, vec, n)) < 0)
+  802809:	83 c4 20             	add    $0x20,%esp
+  80280c:	85 c0                	test   %eax,%eax
+  80280e:	0f 88 e7 00 00 00    	js     8028fb <ufork+0x22e>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+  802814:	6a 20                	push   $0x20
+  802816:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  80281c:	50                   	push   %eax
+  80281d:	57                   	push   %edi
+  80281e:	6a 00                	push   $0x0
+  802820:	e8 82 f4 ff ff       	call   801ca7 <sys_vm_ranges>
+  802825:	83 c4 10             	add    $0x10,%esp
+  802828:	85 c0                	test   %eax,%eax
+  80282a:	7e 51                	jle    80287d <ufork+0x1b0>
+		n = r;
+  80282c:	89 c6                	mov    %eax,%esi
+		last = &vec[n - 1];
+  80282e:	83 e8 01             	sub    $0x1,%eax
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+  802831:	89 c1                	mov    %eax,%ecx
+  802833:	c1 e1 04             	shl    $0x4,%ecx
+  802836:	8b 94 0d ec fd ff ff 	mov    -0x214(%ebp,%ecx,1),%edx
+  80283d:	89 d3                	mov    %edx,%ebx
+  80283f:	c1 e3 0c             	shl    $0xc,%ebx
+  802842:	89 df                	mov    %ebx,%edi
+  802844:	03 bc 0d e8 fd ff ff 	add    -0x218(%ebp,%ecx,1),%edi
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  80284b:	81 ff 00 00 c0 ee    	cmp    $0xeec00000,%edi
+  802851:	0f 84 d5 fe ff ff    	je     80272c <ufork+0x5f>
+	for (i = 0; i < n; i++) {
+  802857:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+	size_t i, ncow = 0;
+  80285d:	c7 85 e0 fb ff ff 00 	movl   $0x0,-0x420(%ebp)
+  802864:	00 00 00 
+	for (i = 0; i < n; i++) {
+  802867:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80286c:	89 bd d8 fb ff ff    	mov    %edi,-0x428(%ebp)
+  802872:	89 b5 e4 fb ff ff    	mov    %esi,-0x41c(%ebp)
+  802878:	e9 ce fe ff ff       	jmp    80274b <ufork+0x7e>
+			goto fail;
+	}
+	if (r < 0)
+  80287d:	89 c6                	mov    %eax,%esi
+  80287f:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  802885:	85 c0                	test   %eax,%eax
+  802887:	78 52                	js     8028db <ufork+0x20e>
+		goto fail;
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE),
+  802889:	83 ec 04             	sub    $0x4,%esp
+  80288c:	6a 07                	push   $0x7
+  80288e:	68 00 f0 bf ee       	push   $0xeebff000
+  802893:	53                   	push   %ebx
+  802894:	e8 3a e7 ff ff       	call   800fd3 <sys_page_alloc>
+  802899:	89 c6                	mov    %eax,%esi
+  80289b:	83 c4 10             	add    $0x10,%esp
+  80289e:	85 c0                	test   %eax,%eax
+  8028a0:	78 39                	js     8028db <ufork+0x20e>
+				PTE_P | PTE_U | PTE_W)) < 0
+	    || (r = sys_env_set_pgfault_upcall(envid,
+			thisenv->env_pgfault_upcall)) < 0
+  8028a2:	a1 08 40 80 00       	mov    0x804008,%eax
+  8028a7:	8b 40 74             	mov    0x74(%eax),%eax
+	    || (r = sys_env_set_pgfault_upcall(envid,
+  8028aa:	83 ec 08             	sub    $0x8,%esp
+  8028ad:	50                   	push   %eax
+  8028ae:	53                   	push   %ebx
+  8028af:	e8 de ed ff ff       	call   801692 <sys_env_set_pgfault_upcall>
+  8028b4:	89 c6                	mov    %eax,%esi
+  8028b6:	83 c4 10             	add    $0x10,%esp
+  8028b9:	85 c0                	test   %eax,%eax
+  8028bb:	78 1e                	js     8028db <ufork+0x20e>
+	    || (r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  8028bd:	83 ec 08             	sub    $0x8,%esp
+  8028c0:	6a 02                	push   $0x2
+  8028c2:	53                   	push   %ebx
+  8028c3:	e8 bc ea ff ff       	call   801384 <sys_env_set_status>
+  8028c8:	89 c6                	mov    %eax,%esi
+  8028ca:	83 c4 10             	add    $0x10,%esp
+  8028cd:	85 c0                	test   %eax,%eax
+  8028cf:	79 1c                	jns    8028ed <ufork+0x220>
+  8028d1:	eb 08                	jmp    8028db <ufork+0x20e>
+  8028d3:	89 c6                	mov    %eax,%esi
+  8028d5:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+		goto fail;
+	return envid;
+
+fail:
+	sys_env_destroy(envid);
+  8028db:	83 ec 0c             	sub    $0xc,%esp
+  8028de:	53                   	push   %ebx
+  8028df:	e8 8e e5 ff ff       	call   800e72 <sys_env_destroy>
+	return r;
+  8028e4:	83 c4 10             	add    $0x10,%esp
+  8028e7:	89 b5 d4 fb ff ff    	mov    %esi,-0x42c(%ebp)
+}
+  8028ed:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+  8028f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028f6:	5b                   	pop    %ebx
+  8028f7:	5e                   	pop    %esi
+  8028f8:	5f                   	pop    %edi
+  8028f9:	5d                   	pop    %ebp
+  8028fa:	c3                   	ret
+  8028fb:	89 c6                	mov    %eax,%esi
+  8028fd:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  802903:	eb d6                	jmp    8028db <ufork+0x20e>
+
+00802905 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  802905:	55                   	push   %ebp
+  802906:	89 e5                	mov    %esp,%ebp
+  802908:	53                   	push   %ebx
+  802909:	83 ec 04             	sub    $0x4,%esp
+	envid_t envid;
+
+	envid = sys_fork();
+  80290c:	e8 90 f2 ff ff       	call   801ba1 <sys_fork>
+  802911:	89 c3                	mov    %eax,%ebx
+	if (envid == 0)
+  802913:	85 c0                	test   %eax,%eax
+  802915:	74 07                	je     80291e <fork+0x19>
+		thisenv = &envs[ENVX(sys_getenvid())];
+	return envid;
+}
+  802917:	89 d8                	mov    %ebx,%eax
+  802919:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80291c:	c9                   	leave
+  80291d:	c3                   	ret
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80291e:	e8 11 e6 ff ff       	call   800f34 <sys_getenvid>
+  802923:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802928:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  80292e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802933:	a3 08 40 80 00       	mov    %eax,0x804008
+	return envid;
+  802938:	eb dd                	jmp    802917 <fork+0x12>
+
+0080293a <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  80293a:	55                   	push   %ebp
+  80293b:	89 e5                	mov    %esp,%ebp
+  80293d:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  802940:	68 7f 32 80 00       	push   $0x80327f
+  802945:	68 a1 00 00 00       	push   $0xa1
+  80294a:	68 59 32 80 00       	push   $0x803259
+  80294f:	e8 92 02 00 00       	call   802be6 <_panic>
+
+00802954 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802954:	55                   	push   %ebp
+  802955:	89 e5                	mov    %esp,%ebp
+  802957:	56                   	push   %esi
+  802958:	53                   	push   %ebx
+  802959:	8b 75 08             	mov    0x8(%ebp),%esi
+  80295c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80295f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if ((r = sys_ipc_recv(pg ? pg : (void *) UTOP)) < 0) {
+  802962:	85 c0                	test   %eax,%eax
+  802964:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802969:	0f 44 c2             	cmove  %edx,%eax
+  80296c:	83 ec 0c             	sub    $0xc,%esp
+  80296f:	50                   	push   %eax
+  802970:	e8 2f ef ff ff       	call   8018a4 <sys_ipc_recv>
+  802975:	83 c4 10             	add    $0x10,%esp
+  802978:	85 c0                	test   %eax,%eax
+  80297a:	78 34                	js     8029b0 <ipc_recv+0x5c>
+			*from_env_store = 0;
+		if (perm_store)
+			*perm_store = 0;
+		return r;
+	}
+	if (from_env_store)
+  80297c:	85 f6                	test   %esi,%esi
+  80297e:	74 0d                	je     80298d <ipc_recv+0x39>
+		*from_env_store = thisenv->env_ipc_from;
+  802980:	a1 08 40 80 00       	mov    0x804008,%eax
+  802985:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  80298b:	89 06                	mov    %eax,(%esi)
+	if (perm_store)
+  80298d:	85 db                	test   %ebx,%ebx
+  80298f:	74 0d                	je     80299e <ipc_recv+0x4a>
+		*perm_store = thisenv->env_ipc_perm;
+  802991:	a1 08 40 80 00       	mov    0x804008,%eax
+  802996:	8b 80 9c 00 00 00    	mov    0x9c(%eax),%eax
+  80299c:	89 03                	mov    %eax,(%ebx)
+	return thisenv->env_ipc_msg.m_w[0];
+  80299e:	a1 08 40 80 00       	mov    0x804008,%eax
+  8029a3:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8029a9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029ac:	5b                   	pop    %ebx
+  8029ad:	5e                   	pop    %esi
+  8029ae:	5d                   	pop    %ebp
+  8029af:	c3                   	ret
+		if (from_env_store)
+  8029b0:	85 f6                	test   %esi,%esi
+  8029b2:	74 06                	je     8029ba <ipc_recv+0x66>
+			*from_env_store = 0;
+  8029b4:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  8029ba:	85 db                	test   %ebx,%ebx
+  8029bc:	74 eb                	je     8029a9 <ipc_recv+0x55>
+			*perm_store = 0;
+  8029be:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8029c4:	eb e3                	jmp    8029a9 <ipc_recv+0x55>
+
+008029c6 <ipc_send>:
+//
+// The kernel queues us behind any other senders until 'toenv'
+// receives, so we only come back to retry if its queue was full.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8029c6:	55                   	push   %ebp
+  8029c7:	89 e5                	mov    %esp,%ebp
+  8029c9:	57                   	push   %edi
+  8029ca:	56                   	push   %esi
+  8029cb:	53                   	push   %ebx
+  8029cc:	83 ec 0c             	sub    $0xc,%esp
+  8029cf:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8029d2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8029d5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_send(to_env, val, pg ? pg : (void *) UTOP, perm))
+  8029d8:	85 db                	test   %ebx,%ebx
+  8029da:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8029df:	0f 44 d8             	cmove  %eax,%ebx
+  8029e2:	eb 05                	jmp    8029e9 <ipc_send+0x23>
+	       == -E_AGAIN)
+		sys_yield();
+  8029e4:	e8 fc e8 ff ff       	call   8012e5 <sys_yield>
+	while ((r = sys_ipc_send(to_env, val, pg ? pg : (void *) UTOP, perm))
+  8029e9:	ff 75 14             	push   0x14(%ebp)
+  8029ec:	53                   	push   %ebx
+  8029ed:	56                   	push   %esi
+  8029ee:	57                   	push   %edi
+  8029ef:	e8 09 ee ff ff       	call   8017fd <sys_ipc_send>
+	       == -E_AGAIN)
+  8029f4:	83 c4 10             	add    $0x10,%esp
+  8029f7:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  8029fa:	74 e8                	je     8029e4 <ipc_send+0x1e>
+	if (r < 0)
+  8029fc:	85 c0                	test   %eax,%eax
+  8029fe:	78 08                	js     802a08 <ipc_send+0x42>
+		panic("ipc_send: %e", r);
+}
+  802a00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a03:	5b                   	pop    %ebx
+  802a04:	5e                   	pop    %esi
+  802a05:	5f                   	pop    %edi
+  802a06:	5d                   	pop    %ebp
+  802a07:	c3                   	ret
+		panic("ipc_send: %e", r);
+  802a08:	50                   	push   %eax
+  802a09:	68 95 32 80 00       	push   $0x803295
+  802a0e:	6a 3a                	push   $0x3a
+  802a10:	68 a2 32 80 00       	push   $0x8032a2
+  802a15:	e8 cc 01 00 00       	call   802be6 <_panic>
+
+00802a1a <ipc_send_range>:
+
+// Like ipc_send, but send the 'npages' contiguous pages at 'pg' in one
+// message.  The receiver maps as many as fit in its window.
+void
+ipc_send_range(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  802a1a:	55                   	push   %ebp
+  802a1b:	89 e5                	mov    %esp,%ebp
+  802a1d:	57                   	push   %edi
+  802a1e:	56                   	push   %esi
+  802a1f:	53                   	push   %ebx
+  802a20:	83 ec 0c             	sub    $0xc,%esp
+  802a23:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a26:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802a29:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_send_range(to_env, val, pg, npages, perm))
+  802a2c:	eb 05                	jmp    802a33 <ipc_send_range+0x19>
+	       == -E_AGAIN)
+		sys_yield();
+  802a2e:	e8 b2 e8 ff ff       	call   8012e5 <sys_yield>
+	while ((r = sys_ipc_send_range(to_env, val, pg, npages, perm))
+  802a33:	83 ec 0c             	sub    $0xc,%esp
+  802a36:	ff 75 18             	push   0x18(%ebp)
+  802a39:	ff 75 14             	push   0x14(%ebp)
+  802a3c:	53                   	push   %ebx
+  802a3d:	56                   	push   %esi
+  802a3e:	57                   	push   %edi
+  802a3f:	e8 22 ef ff ff       	call   801966 <sys_ipc_send_range>
+	       == -E_AGAIN)
+  802a44:	83 c4 20             	add    $0x20,%esp
+  802a47:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802a4a:	74 e2                	je     802a2e <ipc_send_range+0x14>
+	if (r < 0)
+  802a4c:	85 c0                	test   %eax,%eax
+  802a4e:	78 08                	js     802a58 <ipc_send_range+0x3e>
+		panic("ipc_send_range: %e", r);
+}
+  802a50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a53:	5b                   	pop    %ebx
+  802a54:	5e                   	pop    %esi
+  802a55:	5f                   	pop    %edi
+  802a56:	5d                   	pop    %ebp
+  802a57:	c3                   	ret
+		panic("ipc_send_range: %e", r);
+  802a58:	50                   	push   %eax
+  802a59:	68 ac 32 80 00       	push   $0x8032ac
+  802a5e:	6a 48                	push   $0x48
+  802a60:	68 a2 32 80 00       	push   $0x8032a2
+  802a65:	e8 7c 01 00 00       	call   802be6 <_panic>
+
+00802a6a <ipc_recv_range>:
+// (which must not be null).  On return *npages holds the number of
+// pages received, which is 0 on error or if the sender sent none.
+int32_t
+ipc_recv_range(envid_t *from_env_store, void *pg, size_t *npages,
+	       int *perm_store)
+{
+  802a6a:	55                   	push   %ebp
+  802a6b:	89 e5                	mov    %esp,%ebp
+  802a6d:	57                   	push   %edi
+  802a6e:	56                   	push   %esi
+  802a6f:	53                   	push   %ebx
+  802a70:	83 ec 14             	sub    $0x14,%esp
+  802a73:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a76:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802a79:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if ((r = sys_ipc_recv_range(pg, *npages)) < 0) {
+  802a7c:	ff 33                	push   (%ebx)
+  802a7e:	ff 75 0c             	push   0xc(%ebp)
+  802a81:	e8 83 ef ff ff       	call   801a09 <sys_ipc_recv_range>
+  802a86:	83 c4 10             	add    $0x10,%esp
+  802a89:	85 c0                	test   %eax,%eax
+  802a8b:	78 42                	js     802acf <ipc_recv_range+0x65>
+		if (perm_store)
+			*perm_store = 0;
+		*npages = 0;
+		return r;
+	}
+	if (from_env_store)
+  802a8d:	85 ff                	test   %edi,%edi
+  802a8f:	74 0d                	je     802a9e <ipc_recv_range+0x34>
+		*from_env_store = thisenv->env_ipc_from;
+  802a91:	a1 08 40 80 00       	mov    0x804008,%eax
+  802a96:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  802a9c:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  802a9e:	85 f6                	test   %esi,%esi
+  802aa0:	74 0d                	je     802aaf <ipc_recv_range+0x45>
+		*perm_store = thisenv->env_ipc_perm;
+  802aa2:	a1 08 40 80 00       	mov    0x804008,%eax
+  802aa7:	8b 80 9c 00 00 00    	mov    0x9c(%eax),%eax
+  802aad:	89 06                	mov    %eax,(%esi)
+	*npages = thisenv->env_ipc_npages;
+  802aaf:	a1 08 40 80 00       	mov    0x804008,%eax
+  802ab4:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802aba:	89 03                	mov    %eax,(%ebx)
+	return thisenv->env_ipc_msg.m_w[0];
+  802abc:	a1 08 40 80 00       	mov    0x804008,%eax
+  802ac1:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802ac7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802aca:	5b                   	pop    %ebx
+  802acb:	5e                   	pop    %esi
+  802acc:	5f                   	pop    %edi
+  802acd:	5d                   	pop    %ebp
+  802ace:	c3                   	ret
+		if (from_env_store)
+  802acf:	85 ff                	test   %edi,%edi
+  802ad1:	74 06                	je     802ad9 <ipc_recv_range+0x6f>
+			*from_env_store = 0;
+  802ad3:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  802ad9:	85 f6                	test   %esi,%esi
+  802adb:	74 06                	je     802ae3 <ipc_recv_range+0x79>
+			*perm_store = 0;
+  802add:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		*npages = 0;
+  802ae3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		return r;
+  802ae9:	eb dc                	jmp    802ac7 <ipc_recv_range+0x5d>
+
+00802aeb <ipc_send_msg>:
+// Send the IPC_MSG_WORDS words of 'msg' to 'to_env', in registers and
+// without a page.  Waits like ipc_send until 'to_env' takes them, and
+// panics on any error other than -E_AGAIN.
+void
+ipc_send_msg(envid_t to_env, const struct ipc_msg *msg)
+{
+  802aeb:	55                   	push   %ebp
+  802aec:	89 e5                	mov    %esp,%ebp
+  802aee:	56                   	push   %esi
+  802aef:	53                   	push   %ebx
+  802af0:	8b 75 08             	mov    0x8(%ebp),%esi
+  802af3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_send_msg(to_env, msg)) == -E_AGAIN)
+  802af6:	eb 05                	jmp    802afd <ipc_send_msg+0x12>
+		sys_yield();
+  802af8:	e8 e8 e7 ff ff       	call   8012e5 <sys_yield>
+	while ((r = sys_ipc_send_msg(to_env, msg)) == -E_AGAIN)
+  802afd:	83 ec 08             	sub    $0x8,%esp
+  802b00:	53                   	push   %ebx
+  802b01:	56                   	push   %esi
+  802b02:	e8 3a f0 ff ff       	call   801b41 <sys_ipc_send_msg>
+  802b07:	83 c4 10             	add    $0x10,%esp
+  802b0a:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802b0d:	74 e9                	je     802af8 <ipc_send_msg+0xd>
+	if (r < 0)
+  802b0f:	85 c0                	test   %eax,%eax
+  802b11:	78 07                	js     802b1a <ipc_send_msg+0x2f>
+		panic("ipc_send_msg: %e", r);
+}
+  802b13:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b16:	5b                   	pop    %ebx
+  802b17:	5e                   	pop    %esi
+  802b18:	5d                   	pop    %ebp
+  802b19:	c3                   	ret
+		panic("ipc_send_msg: %e", r);
+  802b1a:	50                   	push   %eax
+  802b1b:	68 bf 32 80 00       	push   $0x8032bf
+  802b20:	6a 6f                	push   $0x6f
+  802b22:	68 a2 32 80 00       	push   $0x8032a2
+  802b27:	e8 ba 00 00 00       	call   802be6 <_panic>
+
+00802b2c <ipc_recv_msg>:
+// ipc_call or plain ipc_send (whose value is word 0, and whose page is
+// not taken), it arrives in registers and needs no page.
+// Returns the sender's envid, < 0 on error.
+envid_t
+ipc_recv_msg(struct ipc_msg *msg)
+{
+  802b2c:	55                   	push   %ebp
+  802b2d:	89 e5                	mov    %esp,%ebp
+  802b2f:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_reply_wait(0, msg);
+  802b32:	ff 75 08             	push   0x8(%ebp)
+  802b35:	6a 00                	push   $0x0
+  802b37:	e8 cb ef ff ff       	call   801b07 <sys_ipc_reply_wait>
+}
+  802b3c:	c9                   	leave
+  802b3d:	c3                   	ret
+
+00802b3e <ipc_call>:
+// ipc_reply_wait (or ipc_recv), and straight back when it replies.
+// Retries while to_env's queue is full.
+// Returns 0 on success, < 0 on error.
+int
+ipc_call(envid_t to_env, struct ipc_msg *msg)
+{
+  802b3e:	55                   	push   %ebp
+  802b3f:	89 e5                	mov    %esp,%ebp
+  802b41:	56                   	push   %esi
+  802b42:	53                   	push   %ebx
+  802b43:	8b 75 08             	mov    0x8(%ebp),%esi
+  802b46:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_call(to_env, msg)) == -E_AGAIN)
+  802b49:	eb 05                	jmp    802b50 <ipc_call+0x12>
+		sys_yield();
+  802b4b:	e8 95 e7 ff ff       	call   8012e5 <sys_yield>
+	while ((r = sys_ipc_call(to_env, msg)) == -E_AGAIN)
+  802b50:	83 ec 08             	sub    $0x8,%esp
+  802b53:	53                   	push   %ebx
+  802b54:	56                   	push   %esi
+  802b55:	e8 73 ef ff ff       	call   801acd <sys_ipc_call>
+  802b5a:	83 c4 10             	add    $0x10,%esp
+  802b5d:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802b60:	74 e9                	je     802b4b <ipc_call+0xd>
+	return r;
+}
+  802b62:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b65:	5b                   	pop    %ebx
+  802b66:	5e                   	pop    %esi
+  802b67:	5d                   	pop    %ebp
+  802b68:	c3                   	ret
+
+00802b69 <ipc_reply_wait>:
+//	}
+//
+// Returns the envid of the sender, < 0 on error.
+envid_t
+ipc_reply_wait(envid_t to_env, struct ipc_msg *msg)
+{
+  802b69:	55                   	push   %ebp
+  802b6a:	89 e5                	mov    %esp,%ebp
+  802b6c:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_reply_wait(to_env, msg);
+  802b6f:	ff 75 0c             	push   0xc(%ebp)
+  802b72:	ff 75 08             	push   0x8(%ebp)
+  802b75:	e8 8d ef ff ff       	call   801b07 <sys_ipc_reply_wait>
+}
+  802b7a:	c9                   	leave
+  802b7b:	c3                   	ret
+
+00802b7c <ep_send>:
+
+// Send 'msg' to endpoint 'epid', waiting while its queue is full.
+// Returns 0 on success, < 0 if the endpoint is gone or not ours to use.
+int
+ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  802b7c:	55                   	push   %ebp
+  802b7d:	89 e5                	mov    %esp,%ebp
+  802b7f:	56                   	push   %esi
+  802b80:	53                   	push   %ebx
+  802b81:	8b 75 08             	mov    0x8(%ebp),%esi
+  802b84:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ep_send(epid, msg)) == -E_AGAIN)
+  802b87:	eb 05                	jmp    802b8e <ep_send+0x12>
+		sys_yield();
+  802b89:	e8 57 e7 ff ff       	call   8012e5 <sys_yield>
+	while ((r = sys_ep_send(epid, msg)) == -E_AGAIN)
+  802b8e:	83 ec 08             	sub    $0x8,%esp
+  802b91:	53                   	push   %ebx
+  802b92:	56                   	push   %esi
+  802b93:	e8 c6 f8 ff ff       	call   80245e <sys_ep_send>
+  802b98:	83 c4 10             	add    $0x10,%esp
+  802b9b:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802b9e:	74 e9                	je     802b89 <ep_send+0xd>
+	return r;
+}
+  802ba0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ba3:	5b                   	pop    %ebx
+  802ba4:	5e                   	pop    %esi
+  802ba5:	5d                   	pop    %ebp
+  802ba6:	c3                   	ret
+
+00802ba7 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802ba7:	55                   	push   %ebp
+  802ba8:	89 e5                	mov    %esp,%ebp
+  802baa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802bad:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802bb2:	69 d0 68 01 00 00    	imul   $0x168,%eax,%edx
+  802bb8:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802bbe:	8b 52 50             	mov    0x50(%edx),%edx
+  802bc1:	39 ca                	cmp    %ecx,%edx
+  802bc3:	74 11                	je     802bd6 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802bc5:	83 c0 01             	add    $0x1,%eax
+  802bc8:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802bcd:	75 e3                	jne    802bb2 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802bcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd4:	eb 0e                	jmp    802be4 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802bd6:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802bdc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802be1:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802be4:	5d                   	pop    %ebp
+  802be5:	c3                   	ret
+
+00802be6 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802be6:	55                   	push   %ebp
+  802be7:	89 e5                	mov    %esp,%ebp
+  802be9:	57                   	push   %edi
+  802bea:	56                   	push   %esi
+  802beb:	53                   	push   %ebx
+  802bec:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  802bf2:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  802bf5:	8b 1d 00 40 80 00    	mov    0x804000,%ebx
+  802bfb:	e8 34 e3 ff ff       	call   800f34 <sys_getenvid>
+  802c00:	83 ec 04             	sub    $0x4,%esp
+  802c03:	ff 75 0c             	push   0xc(%ebp)
+  802c06:	ff 75 08             	push   0x8(%ebp)
+  802c09:	53                   	push   %ebx
+  802c0a:	50                   	push   %eax
+  802c0b:	68 d0 32 80 00       	push   $0x8032d0
+  802c10:	68 00 01 00 00       	push   $0x100
+  802c15:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  802c1b:	56                   	push   %esi
+  802c1c:	e8 28 db ff ff       	call   800749 <snprintf>
+  802c21:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  802c23:	83 c4 20             	add    $0x20,%esp
+  802c26:	57                   	push   %edi
+  802c27:	ff 75 10             	push   0x10(%ebp)
+  802c2a:	bf 00 01 00 00       	mov    $0x100,%edi
+  802c2f:	89 f8                	mov    %edi,%eax
+  802c31:	29 d8                	sub    %ebx,%eax
+  802c33:	50                   	push   %eax
+  802c34:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  802c37:	50                   	push   %eax
+  802c38:	e8 be da ff ff       	call   8006fb <vsnprintf>
+  802c3d:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  802c3f:	83 c4 0c             	add    $0xc,%esp
+  802c42:	68 27 2f 80 00       	push   $0x802f27
+  802c47:	29 df                	sub    %ebx,%edi
+  802c49:	57                   	push   %edi
+  802c4a:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  802c4d:	50                   	push   %eax
+  802c4e:	e8 f6 da ff ff       	call   800749 <snprintf>
+	sys_cputs(buf, r);
+  802c53:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  802c56:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  802c58:	53                   	push   %ebx
+  802c59:	56                   	push   %esi
+  802c5a:	e8 d7 e0 ff ff       	call   800d36 <sys_cputs>
+  802c5f:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802c62:	cc                   	int3
+	while (1)
+  802c63:	eb fd                	jmp    802c62 <_panic+0x7c>
+
+00802c65 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802c65:	55                   	push   %ebp
+  802c66:	89 e5                	mov    %esp,%ebp
+  802c68:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  802c6b:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  802c72:	74 0a                	je     802c7e <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  802c74:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c77:	a3 0c 40 80 00       	mov    %eax,0x80400c
+}
+  802c7c:	c9                   	leave
+  802c7d:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE),
+  802c7e:	83 ec 04             	sub    $0x4,%esp
+  802c81:	6a 07                	push   $0x7
+  802c83:	68 00 f0 bf ee       	push   $0xeebff000
+  802c88:	6a 00                	push   $0x0
+  802c8a:	e8 44 e3 ff ff       	call   800fd3 <sys_page_alloc>
+  802c8f:	83 c4 10             	add    $0x10,%esp
+  802c92:	85 c0                	test   %eax,%eax
+  802c94:	78 28                	js     802cbe <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  802c96:	83 ec 08             	sub    $0x8,%esp
+  802c99:	68 d0 2c 80 00       	push   $0x802cd0
+  802c9e:	6a 00                	push   $0x0
+  802ca0:	e8 ed e9 ff ff       	call   801692 <sys_env_set_pgfault_upcall>
+  802ca5:	83 c4 10             	add    $0x10,%esp
+  802ca8:	85 c0                	test   %eax,%eax
+  802caa:	79 c8                	jns    802c74 <set_pgfault_handler+0xf>
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+  802cac:	50                   	push   %eax
+  802cad:	68 1c 33 80 00       	push   $0x80331c
+  802cb2:	6a 24                	push   $0x24
+  802cb4:	68 50 33 80 00       	push   $0x803350
+  802cb9:	e8 28 ff ff ff       	call   802be6 <_panic>
+			panic("set_pgfault_handler: sys_page_alloc: %e", r);
+  802cbe:	50                   	push   %eax
+  802cbf:	68 f4 32 80 00       	push   $0x8032f4
+  802cc4:	6a 22                	push   $0x22
+  802cc6:	68 50 33 80 00       	push   $0x803350
+  802ccb:	e8 16 ff ff ff       	call   802be6 <_panic>
+
+00802cd0 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802cd0:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802cd1:	a1 0c 40 80 00       	mov    0x80400c,%eax
+	call *%eax
+  802cd6:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802cd8:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 0x28(%esp), %ebx		// trap-time eip
+  802cdb:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl 0x30(%esp), %eax		// trap-time esp
+  802cdf:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  802ce3:	83 e8 04             	sub    $0x4,%eax
+	movl %ebx, (%eax)
+  802ce6:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 0x30(%esp)
+  802ce8:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp			// skip fault_va and err
+  802cec:	83 c4 08             	add    $0x8,%esp
+	popal
+  802cef:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp			// skip eip
+  802cf0:	83 c4 04             	add    $0x4,%esp
+	popfl
+  802cf3:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802cf4:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802cf5:	c3                   	ret
+
+00802cf6 <dm>:
+  802cf6:	55                   	push   %ebp
+  802cf7:	57                   	push   %edi
+  802cf8:	56                   	push   %esi
+  802cf9:	53                   	push   %ebx
+  802cfa:	83 ec 24             	sub    $0x24,%esp
+  802cfd:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802d01:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802d05:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802d09:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802d0d:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802d11:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802d15:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802d19:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d23:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802d28:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802d2f:	00 
+  802d30:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802d37:	00 
+  802d38:	89 fb                	mov    %edi,%ebx
+  802d3a:	eb 08                	jmp    802d44 <dm+0x4e>
+  802d3c:	83 e9 01             	sub    $0x1,%ecx
+  802d3f:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802d42:	74 68                	je     802dac <dm+0xb6>
+  802d44:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802d48:	01 c0                	add    %eax,%eax
+  802d4a:	89 c6                	mov    %eax,%esi
+  802d4c:	89 d7                	mov    %edx,%edi
+  802d4e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802d52:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802d56:	0f ad d0             	shrd   %cl,%edx,%eax
+  802d59:	d3 ea                	shr    %cl,%edx
+  802d5b:	f6 c1 20             	test   $0x20,%cl
+  802d5e:	74 04                	je     802d64 <dm+0x6e>
+  802d60:	89 d0                	mov    %edx,%eax
+  802d62:	31 d2                	xor    %edx,%edx
+  802d64:	83 e0 01             	and    $0x1,%eax
+  802d67:	89 04 24             	mov    %eax,(%esp)
+  802d6a:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802d71:	00 
+  802d72:	8b 04 24             	mov    (%esp),%eax
+  802d75:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802d79:	09 f0                	or     %esi,%eax
+  802d7b:	09 fa                	or     %edi,%edx
+  802d7d:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802d81:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802d85:	39 f0                	cmp    %esi,%eax
+  802d87:	89 d5                	mov    %edx,%ebp
+  802d89:	19 fd                	sbb    %edi,%ebp
+  802d8b:	72 af                	jb     802d3c <dm+0x46>
+  802d8d:	29 f0                	sub    %esi,%eax
+  802d8f:	19 fa                	sbb    %edi,%edx
+  802d91:	89 cf                	mov    %ecx,%edi
+  802d93:	c1 ef 05             	shr    $0x5,%edi
+  802d96:	83 e7 01             	and    $0x1,%edi
+  802d99:	89 fe                	mov    %edi,%esi
+  802d9b:	83 f6 01             	xor    $0x1,%esi
+  802d9e:	d3 e6                	shl    %cl,%esi
+  802da0:	d3 e7                	shl    %cl,%edi
+  802da2:	09 74 24 18          	or     %esi,0x18(%esp)
+  802da6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802daa:	eb 90                	jmp    802d3c <dm+0x46>
+  802dac:	85 db                	test   %ebx,%ebx
+  802dae:	74 05                	je     802db5 <dm+0xbf>
+  802db0:	89 03                	mov    %eax,(%ebx)
+  802db2:	89 53 04             	mov    %edx,0x4(%ebx)
+  802db5:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802db9:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802dbd:	83 c4 24             	add    $0x24,%esp
+  802dc0:	5b                   	pop    %ebx
+  802dc1:	5e                   	pop    %esi
+  802dc2:	5f                   	pop    %edi
+  802dc3:	5d                   	pop    %ebp
+  802dc4:	c3                   	ret
+
+00802dc5 <__udivdi3>:
+  802dc5:	83 ec 08             	sub    $0x8,%esp
+  802dc8:	6a 00                	push   $0x0
+  802dca:	ff 74 24 1c          	push   0x1c(%esp)
+  802dce:	ff 74 24 1c          	push   0x1c(%esp)
+  802dd2:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802dd6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802dda:	e8 17 ff ff ff       	call   802cf6 <dm>
+  802ddf:	83 c4 14             	add    $0x14,%esp
+  802de2:	c3                   	ret
+
+00802de3 <__umoddi3>:
+  802de3:	83 ec 18             	sub    $0x18,%esp
+  802de6:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802dea:	50                   	push   %eax
+  802deb:	ff 74 24 2c          	push   0x2c(%esp)
+  802def:	ff 74 24 2c          	push   0x2c(%esp)
+  802df3:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802df7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802dfb:	e8 f6 fe ff ff       	call   802cf6 <dm>
+  802e00:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802e04:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802e08:	83 c4 24             	add    $0x24,%esp
+  802e0b:	c3                   	ret
+
+00802e0c <__divdi3>:
+  802e0c:	53                   	push   %ebx
+  802e0d:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802e11:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802e15:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  802e19:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  802e1d:	85 d2                	test   %edx,%edx
+  802e1f:	78 15                	js     802e36 <__divdi3+0x2a>
+  802e21:	85 db                	test   %ebx,%ebx
+  802e23:	78 34                	js     802e59 <__divdi3+0x4d>
+  802e25:	83 ec 04             	sub    $0x4,%esp
+  802e28:	6a 00                	push   $0x0
+  802e2a:	53                   	push   %ebx
+  802e2b:	51                   	push   %ecx
+  802e2c:	e8 c5 fe ff ff       	call   802cf6 <dm>
+  802e31:	83 c4 10             	add    $0x10,%esp
+  802e34:	eb 21                	jmp    802e57 <__divdi3+0x4b>
+  802e36:	f7 d8                	neg    %eax
+  802e38:	83 d2 00             	adc    $0x0,%edx
+  802e3b:	f7 da                	neg    %edx
+  802e3d:	85 db                	test   %ebx,%ebx
+  802e3f:	78 30                	js     802e71 <__divdi3+0x65>
+  802e41:	83 ec 04             	sub    $0x4,%esp
+  802e44:	6a 00                	push   $0x0
+  802e46:	53                   	push   %ebx
+  802e47:	51                   	push   %ecx
+  802e48:	e8 a9 fe ff ff       	call   802cf6 <dm>
+  802e4d:	83 c4 10             	add    $0x10,%esp
+  802e50:	f7 d8                	neg    %eax
+  802e52:	83 d2 00             	adc    $0x0,%edx
+  802e55:	f7 da                	neg    %edx
+  802e57:	5b                   	pop    %ebx
+  802e58:	c3                   	ret
+  802e59:	83 ec 04             	sub    $0x4,%esp
+  802e5c:	6a 00                	push   $0x0
+  802e5e:	f7 d9                	neg    %ecx
+  802e60:	83 d3 00             	adc    $0x0,%ebx
+  802e63:	f7 db                	neg    %ebx
+  802e65:	53                   	push   %ebx
+  802e66:	51                   	push   %ecx
+  802e67:	e8 8a fe ff ff       	call   802cf6 <dm>
+  802e6c:	83 c4 10             	add    $0x10,%esp
+  802e6f:	eb df                	jmp    802e50 <__divdi3+0x44>
+  802e71:	83 ec 04             	sub    $0x4,%esp
+  802e74:	6a 00                	push   $0x0
+  802e76:	f7 d9                	neg    %ecx
+  802e78:	83 d3 00             	adc    $0x0,%ebx
+  802e7b:	f7 db                	neg    %ebx
+  802e7d:	53                   	push   %ebx
+  802e7e:	51                   	push   %ecx
+  802e7f:	e8 72 fe ff ff       	call   802cf6 <dm>
+  802e84:	83 c4 10             	add    $0x10,%esp
+  802e87:	eb ce                	jmp    802e57 <__divdi3+0x4b>
+
+00802e89 <__moddi3>:
+  802e89:	55                   	push   %ebp
+  802e8a:	57                   	push   %edi
+  802e8b:	56                   	push   %esi
+  802e8c:	53                   	push   %ebx
+  802e8d:	83 ec 18             	sub    $0x18,%esp
+  802e90:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802e94:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802e98:	89 f1                	mov    %esi,%ecx
+  802e9a:	f7 d9                	neg    %ecx
+  802e9c:	89 da                	mov    %ebx,%edx
+  802e9e:	83 d2 00             	adc    $0x0,%edx
+  802ea1:	f7 da                	neg    %edx
+  802ea3:	0f 48 ce             	cmovs  %esi,%ecx
+  802ea6:	0f 48 d3             	cmovs  %ebx,%edx
+  802ea9:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802ead:	50                   	push   %eax
+  802eae:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802eb2:	f7 de                	neg    %esi
+  802eb4:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802eb8:	83 d0 00             	adc    $0x0,%eax
+  802ebb:	f7 d8                	neg    %eax
+  802ebd:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802ec2:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802ec7:	50                   	push   %eax
+  802ec8:	56                   	push   %esi
+  802ec9:	89 c8                	mov    %ecx,%eax
+  802ecb:	e8 26 fe ff ff       	call   802cf6 <dm>
+  802ed0:	83 c4 10             	add    $0x10,%esp
+  802ed3:	85 db                	test   %ebx,%ebx
+  802ed5:	78 10                	js     802ee7 <__moddi3+0x5e>
+  802ed7:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802edb:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802edf:	83 c4 14             	add    $0x14,%esp
+  802ee2:	5b                   	pop    %ebx
+  802ee3:	5e                   	pop    %esi
+  802ee4:	5f                   	pop    %edi
+  802ee5:	5d                   	pop    %ebp
+  802ee6:	c3                   	ret
+  802ee7:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802eeb:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802eef:	f7 d8                	neg    %eax
+  802ef1:	83 d2 00             	adc    $0x0,%edx
+  802ef4:	f7 da                	neg    %edx
+  802ef6:	eb e7                	jmp    802edf <__moddi3+0x56>
@@ -0,0 +1,6410 @@
+
+obj/user/pingpongcall:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 3e 03 00 00       	call   80036f <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <check>:
+		msg->m_w[i] = n * IPC_MSG_WORDS + i;
+}
+
+static void
+check(const char *name, const struct ipc_msg *msg, uint32_t n)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+  80003c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80003f:	89 d3                	mov    %edx,%ebx
+  800041:	89 cf                	mov    %ecx,%edi
+	int i;
+
+	for (i = 0; i < IPC_MSG_WORDS; i++)
+  800043:	8d 74 89 01          	lea    0x1(%ecx,%ecx,4),%esi
+  800047:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (msg->m_w[i] != n * IPC_MSG_WORDS + i + 1)
+  80004c:	8b 14 83             	mov    (%ebx,%eax,4),%edx
+  80004f:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  800052:	39 ca                	cmp    %ecx,%edx
+  800054:	75 10                	jne    800066 <check+0x33>
+	for (i = 0; i < IPC_MSG_WORDS; i++)
+  800056:	83 c0 01             	add    $0x1,%eax
+  800059:	83 f8 05             	cmp    $0x5,%eax
+  80005c:	75 ee                	jne    80004c <check+0x19>
+			panic("%s: word %d is %d in round %d", name, i,
+			      msg->m_w[i], n);
+}
+  80005e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800061:	5b                   	pop    %ebx
+  800062:	5e                   	pop    %esi
+  800063:	5f                   	pop    %edi
+  800064:	5d                   	pop    %ebp
+  800065:	c3                   	ret
+			panic("%s: word %d is %d in round %d", name, i,
+  800066:	83 ec 04             	sub    $0x4,%esp
+  800069:	57                   	push   %edi
+  80006a:	52                   	push   %edx
+  80006b:	50                   	push   %eax
+  80006c:	ff 75 e4             	push   -0x1c(%ebp)
+  80006f:	68 c0 31 80 00       	push   $0x8031c0
+  800074:	6a 2a                	push   $0x2a
+  800076:	68 de 31 80 00       	push   $0x8031de
+  80007b:	e8 4a 03 00 00       	call   8003ca <_panic>
+
+00800080 <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  800080:	55                   	push   %ebp
+  800081:	89 e5                	mov    %esp,%ebp
+  800083:	57                   	push   %edi
+  800084:	56                   	push   %esi
+  800085:	53                   	push   %ebx
+  800086:	83 ec 4c             	sub    $0x4c,%esp
+	envid_t who, from;
+	uint64_t start;
+	uint32_t i, reply;
+	int r;
+
+	if ((who = fork()) < 0)
+  800089:	e8 a5 2b 00 00       	call   802c33 <fork>
+  80008e:	89 c7                	mov    %eax,%edi
+  800090:	85 c0                	test   %eax,%eax
+  800092:	0f 88 b9 01 00 00    	js     800251 <umain+0x1d1>
+		panic("fork: %e", who);
+	if (who == 0) {
+  800098:	0f 84 c5 01 00 00    	je     800263 <umain+0x1e3>
+
+static inline uint64_t
+read_tsc(void)
+{
+	uint64_t tsc;
+	asm volatile("rdtsc" : "=A" (tsc));
+  80009e:	0f 31                	rdtsc
+  8000a0:	89 45 b0             	mov    %eax,-0x50(%ebp)
+  8000a3:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+		server();
+		return;
+	}
+
+	start = read_tsc();
+	for (i = 0; i < NROUNDS; i++) {
+  8000a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+		ipc_send(who, i, 0, 0);
+		if ((reply = ipc_recv(&from, 0, 0)) != i + 1 || from != who)
+  8000ab:	8d 75 d0             	lea    -0x30(%ebp),%esi
+		ipc_send(who, i, 0, 0);
+  8000ae:	6a 00                	push   $0x0
+  8000b0:	6a 00                	push   $0x0
+  8000b2:	53                   	push   %ebx
+  8000b3:	57                   	push   %edi
+  8000b4:	e8 3b 2c 00 00       	call   802cf4 <ipc_send>
+		if ((reply = ipc_recv(&from, 0, 0)) != i + 1 || from != who)
+  8000b9:	83 c4 0c             	add    $0xc,%esp
+  8000bc:	6a 00                	push   $0x0
+  8000be:	6a 00                	push   $0x0
+  8000c0:	56                   	push   %esi
+  8000c1:	e8 bc 2b 00 00       	call   802c82 <ipc_recv>
+  8000c6:	89 da                	mov    %ebx,%edx
+  8000c8:	89 c3                	mov    %eax,%ebx
+  8000ca:	83 c2 01             	add    $0x1,%edx
+  8000cd:	83 c4 10             	add    $0x10,%esp
+  8000d0:	39 c2                	cmp    %eax,%edx
+  8000d2:	0f 85 5b 02 00 00    	jne    800333 <umain+0x2b3>
+  8000d8:	39 7d d0             	cmp    %edi,-0x30(%ebp)
+  8000db:	0f 85 52 02 00 00    	jne    800333 <umain+0x2b3>
+	for (i = 0; i < NROUNDS; i++) {
+  8000e1:	3d 0f 27 00 00       	cmp    $0x270f,%eax
+  8000e6:	76 c6                	jbe    8000ae <umain+0x2e>
+  8000e8:	0f 31                	rdtsc
+			panic("send/recv: got %d from %x", reply, from);
+	}
+	cprintf("send/recv  %6d rounds %8llu cycles/round trip\n",
+		NROUNDS, (read_tsc() - start) / NROUNDS);
+  8000ea:	2b 45 b0             	sub    -0x50(%ebp),%eax
+  8000ed:	1b 55 b4             	sbb    -0x4c(%ebp),%edx
+	cprintf("send/recv  %6d rounds %8llu cycles/round trip\n",
+  8000f0:	6a 00                	push   $0x0
+  8000f2:	68 10 27 00 00       	push   $0x2710
+  8000f7:	52                   	push   %edx
+  8000f8:	50                   	push   %eax
+  8000f9:	e8 76 2f 00 00       	call   803074 <__udivdi3>
+  8000fe:	83 c4 10             	add    $0x10,%esp
+  800101:	52                   	push   %edx
+  800102:	50                   	push   %eax
+  800103:	68 10 27 00 00       	push   $0x2710
+  800108:	68 74 32 80 00       	push   $0x803274
+  80010d:	e8 cc 03 00 00       	call   8004de <cprintf>
+  800112:	0f 31                	rdtsc
+  800114:	89 45 b0             	mov    %eax,-0x50(%ebp)
+  800117:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+  80011a:	83 c4 10             	add    $0x10,%esp
+  80011d:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	start = read_tsc();
+	for (i = 0; i < NROUNDS; i++) {
+  800122:	be 00 00 00 00       	mov    $0x0,%esi
+		msg->m_w[i] = n * IPC_MSG_WORDS + i;
+  800127:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+  80012a:	8d 43 01             	lea    0x1(%ebx),%eax
+  80012d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800130:	8d 43 02             	lea    0x2(%ebx),%eax
+  800133:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800136:	8d 43 03             	lea    0x3(%ebx),%eax
+  800139:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80013c:	8d 43 04             	lea    0x4(%ebx),%eax
+  80013f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		fill(&msg, i);
+		ipc_send_msg(who, &msg);
+  800142:	83 ec 08             	sub    $0x8,%esp
+  800145:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  800148:	50                   	push   %eax
+  800149:	57                   	push   %edi
+  80014a:	e8 ca 2c 00 00       	call   802e19 <ipc_send_msg>
+		if ((from = ipc_recv_msg(&msg)) != who)
+  80014f:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  800152:	89 04 24             	mov    %eax,(%esp)
+  800155:	e8 00 2d 00 00       	call   802e5a <ipc_recv_msg>
+  80015a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80015d:	83 c3 05             	add    $0x5,%ebx
+  800160:	83 c4 10             	add    $0x10,%esp
+  800163:	39 f8                	cmp    %edi,%eax
+  800165:	0f 85 e0 01 00 00    	jne    80034b <umain+0x2cb>
+			panic("ipc_recv_msg: reply from %x", from);
+		check("msg", &msg, i);
+  80016b:	89 f1                	mov    %esi,%ecx
+  80016d:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+  800170:	b8 55 32 80 00       	mov    $0x803255,%eax
+  800175:	e8 b9 fe ff ff       	call   800033 <check>
+	for (i = 0; i < NROUNDS; i++) {
+  80017a:	83 c6 01             	add    $0x1,%esi
+  80017d:	81 fe 10 27 00 00    	cmp    $0x2710,%esi
+  800183:	75 a2                	jne    800127 <umain+0xa7>
+  800185:	0f 31                	rdtsc
+	}
+	cprintf("msg        %6d rounds %8llu cycles/round trip\n",
+		NROUNDS, (read_tsc() - start) / NROUNDS);
+  800187:	2b 45 b0             	sub    -0x50(%ebp),%eax
+  80018a:	1b 55 b4             	sbb    -0x4c(%ebp),%edx
+	cprintf("msg        %6d rounds %8llu cycles/round trip\n",
+  80018d:	6a 00                	push   $0x0
+  80018f:	68 10 27 00 00       	push   $0x2710
+  800194:	52                   	push   %edx
+  800195:	50                   	push   %eax
+  800196:	e8 d9 2e 00 00       	call   803074 <__udivdi3>
+  80019b:	83 c4 10             	add    $0x10,%esp
+  80019e:	52                   	push   %edx
+  80019f:	50                   	push   %eax
+  8001a0:	68 10 27 00 00       	push   $0x2710
+  8001a5:	68 a4 32 80 00       	push   $0x8032a4
+  8001aa:	e8 2f 03 00 00       	call   8004de <cprintf>
+  8001af:	0f 31                	rdtsc
+  8001b1:	89 45 b0             	mov    %eax,-0x50(%ebp)
+  8001b4:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+  8001b7:	83 c4 10             	add    $0x10,%esp
+  8001ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	start = read_tsc();
+	for (i = 0; i < NROUNDS; i++) {
+  8001bf:	be 00 00 00 00       	mov    $0x0,%esi
+		msg->m_w[i] = n * IPC_MSG_WORDS + i;
+  8001c4:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+  8001c7:	8d 43 01             	lea    0x1(%ebx),%eax
+  8001ca:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001cd:	8d 43 02             	lea    0x2(%ebx),%eax
+  8001d0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8001d3:	8d 43 03             	lea    0x3(%ebx),%eax
+  8001d6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001d9:	8d 43 04             	lea    0x4(%ebx),%eax
+  8001dc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		fill(&msg, i);
+		if ((r = ipc_call(who, &msg)) < 0)
+  8001df:	83 ec 08             	sub    $0x8,%esp
+  8001e2:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  8001e5:	50                   	push   %eax
+  8001e6:	57                   	push   %edi
+  8001e7:	e8 80 2c 00 00       	call   802e6c <ipc_call>
+  8001ec:	83 c3 05             	add    $0x5,%ebx
+  8001ef:	83 c4 10             	add    $0x10,%esp
+  8001f2:	85 c0                	test   %eax,%eax
+  8001f4:	0f 88 63 01 00 00    	js     80035d <umain+0x2dd>
+			panic("ipc_call: %e", r);
+		check("call/reply", &msg, i);
+  8001fa:	89 f1                	mov    %esi,%ecx
+  8001fc:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+  8001ff:	b8 66 32 80 00       	mov    $0x803266,%eax
+  800204:	e8 2a fe ff ff       	call   800033 <check>
+	for (i = 0; i < NROUNDS; i++) {
+  800209:	83 c6 01             	add    $0x1,%esi
+  80020c:	81 fe 10 27 00 00    	cmp    $0x2710,%esi
+  800212:	75 b0                	jne    8001c4 <umain+0x144>
+  800214:	0f 31                	rdtsc
+	}
+	cprintf("call/reply %6d rounds %8llu cycles/round trip\n",
+		NROUNDS, (read_tsc() - start) / NROUNDS);
+  800216:	2b 45 b0             	sub    -0x50(%ebp),%eax
+  800219:	1b 55 b4             	sbb    -0x4c(%ebp),%edx
+	cprintf("call/reply %6d rounds %8llu cycles/round trip\n",
+  80021c:	6a 00                	push   $0x0
+  80021e:	68 10 27 00 00       	push   $0x2710
+  800223:	52                   	push   %edx
+  800224:	50                   	push   %eax
+  800225:	e8 4a 2e 00 00       	call   803074 <__udivdi3>
+  80022a:	83 c4 10             	add    $0x10,%esp
+  80022d:	52                   	push   %edx
+  80022e:	50                   	push   %eax
+  80022f:	68 10 27 00 00       	push   $0x2710
+  800234:	68 d4 32 80 00       	push   $0x8032d4
+  800239:	e8 a0 02 00 00       	call   8004de <cprintf>
+
+	sys_env_destroy(who);
+  80023e:	89 3c 24             	mov    %edi,(%esp)
+  800241:	e8 5a 0f 00 00       	call   8011a0 <sys_env_destroy>
+  800246:	83 c4 10             	add    $0x10,%esp
+}
+  800249:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80024c:	5b                   	pop    %ebx
+  80024d:	5e                   	pop    %esi
+  80024e:	5f                   	pop    %edi
+  80024f:	5d                   	pop    %ebp
+  800250:	c3                   	ret
+		panic("fork: %e", who);
+  800251:	50                   	push   %eax
+  800252:	68 f2 31 80 00       	push   $0x8031f2
+  800257:	6a 55                	push   $0x55
+  800259:	68 de 31 80 00       	push   $0x8031de
+  80025e:	e8 67 01 00 00       	call   8003ca <_panic>
+  800263:	bb 11 27 00 00       	mov    $0x2711,%ebx
+		i = ipc_recv(&who, 0, 0);
+  800268:	8d 75 b8             	lea    -0x48(%ebp),%esi
+	for (n = 0; n < NROUNDS; n++) {
+  80026b:	83 eb 01             	sub    $0x1,%ebx
+  80026e:	74 22                	je     800292 <umain+0x212>
+		i = ipc_recv(&who, 0, 0);
+  800270:	83 ec 04             	sub    $0x4,%esp
+  800273:	6a 00                	push   $0x0
+  800275:	6a 00                	push   $0x0
+  800277:	56                   	push   %esi
+  800278:	e8 05 2a 00 00       	call   802c82 <ipc_recv>
+		ipc_send(who, i + 1, 0, 0);
+  80027d:	6a 00                	push   $0x0
+  80027f:	6a 00                	push   $0x0
+  800281:	83 c0 01             	add    $0x1,%eax
+  800284:	50                   	push   %eax
+  800285:	ff 75 b8             	push   -0x48(%ebp)
+  800288:	e8 67 2a 00 00       	call   802cf4 <ipc_send>
+  80028d:	83 c4 20             	add    $0x20,%esp
+  800290:	eb d9                	jmp    80026b <umain+0x1eb>
+  800292:	bb 11 27 00 00       	mov    $0x2711,%ebx
+		if ((who = ipc_recv_msg(&msg)) < 0)
+  800297:	8d 75 bc             	lea    -0x44(%ebp),%esi
+  80029a:	8d 7d d0             	lea    -0x30(%ebp),%edi
+  80029d:	eb 29                	jmp    8002c8 <umain+0x248>
+			panic("ipc_recv_msg: %e", who);
+  80029f:	50                   	push   %eax
+  8002a0:	68 fb 31 80 00       	push   $0x8031fb
+  8002a5:	6a 3d                	push   $0x3d
+  8002a7:	68 de 31 80 00       	push   $0x8031de
+  8002ac:	e8 19 01 00 00       	call   8003ca <_panic>
+		msg->m_w[i]++;
+  8002b1:	83 02 01             	addl   $0x1,(%edx)
+	for (i = 0; i < IPC_MSG_WORDS; i++)
+  8002b4:	83 c2 04             	add    $0x4,%edx
+  8002b7:	39 d7                	cmp    %edx,%edi
+  8002b9:	75 f6                	jne    8002b1 <umain+0x231>
+		ipc_send_msg(who, &msg);
+  8002bb:	83 ec 08             	sub    $0x8,%esp
+  8002be:	56                   	push   %esi
+  8002bf:	50                   	push   %eax
+  8002c0:	e8 54 2b 00 00       	call   802e19 <ipc_send_msg>
+  8002c5:	83 c4 10             	add    $0x10,%esp
+	for (n = 0; n < NROUNDS; n++) {
+  8002c8:	83 eb 01             	sub    $0x1,%ebx
+  8002cb:	74 18                	je     8002e5 <umain+0x265>
+		if ((who = ipc_recv_msg(&msg)) < 0)
+  8002cd:	83 ec 0c             	sub    $0xc,%esp
+  8002d0:	56                   	push   %esi
+  8002d1:	e8 84 2b 00 00       	call   802e5a <ipc_recv_msg>
+  8002d6:	89 45 b8             	mov    %eax,-0x48(%ebp)
+  8002d9:	83 c4 10             	add    $0x10,%esp
+  8002dc:	85 c0                	test   %eax,%eax
+  8002de:	78 bf                	js     80029f <umain+0x21f>
+  8002e0:	8d 55 bc             	lea    -0x44(%ebp),%edx
+  8002e3:	eb d2                	jmp    8002b7 <umain+0x237>
+	who = ipc_reply_wait(0, &msg);
+  8002e5:	83 ec 08             	sub    $0x8,%esp
+  8002e8:	8d 45 bc             	lea    -0x44(%ebp),%eax
+  8002eb:	50                   	push   %eax
+  8002ec:	6a 00                	push   $0x0
+  8002ee:	e8 a4 2b 00 00       	call   802e97 <ipc_reply_wait>
+  8002f3:	83 c4 10             	add    $0x10,%esp
+  8002f6:	8d 75 d0             	lea    -0x30(%ebp),%esi
+		who = ipc_reply_wait(who, &msg);
+  8002f9:	8d 5d bc             	lea    -0x44(%ebp),%ebx
+  8002fc:	eb 29                	jmp    800327 <umain+0x2a7>
+			panic("ipc_reply_wait: %e", who);
+  8002fe:	50                   	push   %eax
+  8002ff:	68 0c 32 80 00       	push   $0x80320c
+  800304:	6a 45                	push   $0x45
+  800306:	68 de 31 80 00       	push   $0x8031de
+  80030b:	e8 ba 00 00 00       	call   8003ca <_panic>
+		msg->m_w[i]++;
+  800310:	83 02 01             	addl   $0x1,(%edx)
+	for (i = 0; i < IPC_MSG_WORDS; i++)
+  800313:	83 c2 04             	add    $0x4,%edx
+  800316:	39 f2                	cmp    %esi,%edx
+  800318:	75 f6                	jne    800310 <umain+0x290>
+		who = ipc_reply_wait(who, &msg);
+  80031a:	83 ec 08             	sub    $0x8,%esp
+  80031d:	53                   	push   %ebx
+  80031e:	50                   	push   %eax
+  80031f:	e8 73 2b 00 00       	call   802e97 <ipc_reply_wait>
+		if (who < 0)
+  800324:	83 c4 10             	add    $0x10,%esp
+	who = ipc_reply_wait(0, &msg);
+  800327:	89 45 b8             	mov    %eax,-0x48(%ebp)
+		if (who < 0)
+  80032a:	85 c0                	test   %eax,%eax
+  80032c:	78 d0                	js     8002fe <umain+0x27e>
+  80032e:	8d 55 bc             	lea    -0x44(%ebp),%edx
+  800331:	eb e3                	jmp    800316 <umain+0x296>
+			panic("send/recv: got %d from %x", reply, from);
+  800333:	83 ec 0c             	sub    $0xc,%esp
+  800336:	ff 75 d0             	push   -0x30(%ebp)
+  800339:	50                   	push   %eax
+  80033a:	68 1f 32 80 00       	push   $0x80321f
+  80033f:	6a 5f                	push   $0x5f
+  800341:	68 de 31 80 00       	push   $0x8031de
+  800346:	e8 7f 00 00 00       	call   8003ca <_panic>
+			panic("ipc_recv_msg: reply from %x", from);
+  80034b:	50                   	push   %eax
+  80034c:	68 39 32 80 00       	push   $0x803239
+  800351:	6a 69                	push   $0x69
+  800353:	68 de 31 80 00       	push   $0x8031de
+  800358:	e8 6d 00 00 00       	call   8003ca <_panic>
+			panic("ipc_call: %e", r);
+  80035d:	50                   	push   %eax
+  80035e:	68 59 32 80 00       	push   $0x803259
+  800363:	6a 73                	push   $0x73
+  800365:	68 de 31 80 00       	push   $0x8031de
+  80036a:	e8 5b 00 00 00       	call   8003ca <_panic>
+
+0080036f <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80036f:	55                   	push   %ebp
+  800370:	89 e5                	mov    %esp,%ebp
+  800372:	56                   	push   %esi
+  800373:	53                   	push   %ebx
+  800374:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800377:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  80037a:	e8 e3 0e 00 00       	call   801262 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  80037f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800384:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  80038a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80038f:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800394:	85 db                	test   %ebx,%ebx
+  800396:	7e 07                	jle    80039f <libmain+0x30>
+		binaryname = argv[0];
+  800398:	8b 06                	mov    (%esi),%eax
+  80039a:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  80039f:	83 ec 08             	sub    $0x8,%esp
+  8003a2:	56                   	push   %esi
+  8003a3:	53                   	push   %ebx
+  8003a4:	e8 d7 fc ff ff       	call   800080 <umain>
+
+	// exit gracefully
+	exit();
+  8003a9:	e8 0a 00 00 00       	call   8003b8 <exit>
+}
+  8003ae:	83 c4 10             	add    $0x10,%esp
+  8003b1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8003b4:	5b                   	pop    %ebx
+  8003b5:	5e                   	pop    %esi
+  8003b6:	5d                   	pop    %ebp
+  8003b7:	c3                   	ret
+
+008003b8 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8003b8:	55                   	push   %ebp
+  8003b9:	89 e5                	mov    %esp,%ebp
+  8003bb:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  8003be:	6a 00                	push   $0x0
+  8003c0:	e8 db 0d 00 00       	call   8011a0 <sys_env_destroy>
+}
+  8003c5:	83 c4 10             	add    $0x10,%esp
+  8003c8:	c9                   	leave
+  8003c9:	c3                   	ret
+
+008003ca <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8003ca:	55                   	push   %ebp
+  8003cb:	89 e5                	mov    %esp,%ebp
+  8003cd:	57                   	push   %edi
+  8003ce:	56                   	push   %esi
+  8003cf:	53                   	push   %ebx
+  8003d0:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  8003d6:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  8003d9:	8b 1d 00 40 80 00    	mov    0x804000,%ebx
+  8003df:	e8 7e 0e 00 00       	call   801262 <sys_getenvid>
+  8003e4:	83 ec 04             	sub    $0x4,%esp
+  8003e7:	ff 75 0c             	push   0xc(%ebp)
+  8003ea:	ff 75 08             	push   0x8(%ebp)
+  8003ed:	53                   	push   %ebx
+  8003ee:	50                   	push   %eax
+  8003ef:	68 10 33 80 00       	push   $0x803310
+  8003f4:	68 00 01 00 00       	push   $0x100
+  8003f9:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  8003ff:	56                   	push   %esi
+  800400:	e8 72 06 00 00       	call   800a77 <snprintf>
+  800405:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  800407:	83 c4 20             	add    $0x20,%esp
+  80040a:	57                   	push   %edi
+  80040b:	ff 75 10             	push   0x10(%ebp)
+  80040e:	bf 00 01 00 00       	mov    $0x100,%edi
+  800413:	89 f8                	mov    %edi,%eax
+  800415:	29 d8                	sub    %ebx,%eax
+  800417:	50                   	push   %eax
+  800418:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  80041b:	50                   	push   %eax
+  80041c:	e8 08 06 00 00       	call   800a29 <vsnprintf>
+  800421:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  800423:	83 c4 0c             	add    $0xc,%esp
+  800426:	68 33 33 80 00       	push   $0x803333
+  80042b:	29 df                	sub    %ebx,%edi
+  80042d:	57                   	push   %edi
+  80042e:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  800431:	50                   	push   %eax
+  800432:	e8 40 06 00 00       	call   800a77 <snprintf>
+	sys_cputs(buf, r);
+  800437:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  80043a:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  80043c:	53                   	push   %ebx
+  80043d:	56                   	push   %esi
+  80043e:	e8 21 0c 00 00       	call   801064 <sys_cputs>
+  800443:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800446:	cc                   	int3
+	while (1)
+  800447:	eb fd                	jmp    800446 <_panic+0x7c>
+
+00800449 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800449:	55                   	push   %ebp
+  80044a:	89 e5                	mov    %esp,%ebp
+  80044c:	53                   	push   %ebx
+  80044d:	83 ec 04             	sub    $0x4,%esp
+  800450:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800453:	8b 13                	mov    (%ebx),%edx
+  800455:	8d 42 01             	lea    0x1(%edx),%eax
+  800458:	89 03                	mov    %eax,(%ebx)
+  80045a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80045d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800461:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800466:	74 09                	je     800471 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800468:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80046c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80046f:	c9                   	leave
+  800470:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800471:	83 ec 08             	sub    $0x8,%esp
+  800474:	68 ff 00 00 00       	push   $0xff
+  800479:	8d 43 08             	lea    0x8(%ebx),%eax
+  80047c:	50                   	push   %eax
+  80047d:	e8 e2 0b 00 00       	call   801064 <sys_cputs>
+		b->idx = 0;
+  800482:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800488:	83 c4 10             	add    $0x10,%esp
+  80048b:	eb db                	jmp    800468 <putch+0x1f>
+
+0080048d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80048d:	55                   	push   %ebp
+  80048e:	89 e5                	mov    %esp,%ebp
+  800490:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800496:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80049d:	00 00 00 
+	b.cnt = 0;
+  8004a0:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8004a7:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8004aa:	ff 75 0c             	push   0xc(%ebp)
+  8004ad:	ff 75 08             	push   0x8(%ebp)
+  8004b0:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8004b6:	50                   	push   %eax
+  8004b7:	68 49 04 80 00       	push   $0x800449
+  8004bc:	e8 14 01 00 00       	call   8005d5 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8004c1:	83 c4 08             	add    $0x8,%esp
+  8004c4:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8004ca:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8004d0:	50                   	push   %eax
+  8004d1:	e8 8e 0b 00 00       	call   801064 <sys_cputs>
+
+	return b.cnt;
+}
+  8004d6:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8004dc:	c9                   	leave
+  8004dd:	c3                   	ret
+
+008004de <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8004de:	55                   	push   %ebp
+  8004df:	89 e5                	mov    %esp,%ebp
+  8004e1:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8004e4:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8004e7:	50                   	push   %eax
+  8004e8:	ff 75 08             	push   0x8(%ebp)
+  8004eb:	e8 9d ff ff ff       	call   80048d <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8004f0:	c9                   	leave
+  8004f1:	c3                   	ret
+
+008004f2 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8004f2:	55                   	push   %ebp
+  8004f3:	89 e5                	mov    %esp,%ebp
+  8004f5:	57                   	push   %edi
+  8004f6:	56                   	push   %esi
+  8004f7:	53                   	push   %ebx
+  8004f8:	83 ec 1c             	sub    $0x1c,%esp
+  8004fb:	89 c7                	mov    %eax,%edi
+  8004fd:	89 d6                	mov    %edx,%esi
+  8004ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  800502:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800505:	89 d1                	mov    %edx,%ecx
+  800507:	89 c2                	mov    %eax,%edx
+  800509:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80050c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80050f:	8b 45 10             	mov    0x10(%ebp),%eax
+  800512:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800515:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800518:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80051f:	39 c2                	cmp    %eax,%edx
+  800521:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800524:	72 3e                	jb     800564 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800526:	83 ec 0c             	sub    $0xc,%esp
+  800529:	ff 75 18             	push   0x18(%ebp)
+  80052c:	83 eb 01             	sub    $0x1,%ebx
+  80052f:	53                   	push   %ebx
+  800530:	50                   	push   %eax
+  800531:	83 ec 08             	sub    $0x8,%esp
+  800534:	ff 75 e4             	push   -0x1c(%ebp)
+  800537:	ff 75 e0             	push   -0x20(%ebp)
+  80053a:	ff 75 dc             	push   -0x24(%ebp)
+  80053d:	ff 75 d8             	push   -0x28(%ebp)
+  800540:	e8 2f 2b 00 00       	call   803074 <__udivdi3>
+  800545:	83 c4 18             	add    $0x18,%esp
+  800548:	52                   	push   %edx
+  800549:	50                   	push   %eax
+  80054a:	89 f2                	mov    %esi,%edx
+  80054c:	89 f8                	mov    %edi,%eax
+  80054e:	e8 9f ff ff ff       	call   8004f2 <printnum>
+  800553:	83 c4 20             	add    $0x20,%esp
+  800556:	eb 13                	jmp    80056b <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800558:	83 ec 08             	sub    $0x8,%esp
+  80055b:	56                   	push   %esi
+  80055c:	ff 75 18             	push   0x18(%ebp)
+  80055f:	ff d7                	call   *%edi
+  800561:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800564:	83 eb 01             	sub    $0x1,%ebx
+  800567:	85 db                	test   %ebx,%ebx
+  800569:	7f ed                	jg     800558 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80056b:	83 ec 08             	sub    $0x8,%esp
+  80056e:	56                   	push   %esi
+  80056f:	83 ec 04             	sub    $0x4,%esp
+  800572:	ff 75 e4             	push   -0x1c(%ebp)
+  800575:	ff 75 e0             	push   -0x20(%ebp)
+  800578:	ff 75 dc             	push   -0x24(%ebp)
+  80057b:	ff 75 d8             	push   -0x28(%ebp)
+  80057e:	e8 0f 2b 00 00       	call   803092 <__umoddi3>
+  800583:	83 c4 14             	add    $0x14,%esp
+  800586:	0f be 80 35 33 80 00 	movsbl 0x803335(%eax),%eax
+  80058d:	50                   	push   %eax
+  80058e:	ff d7                	call   *%edi
+}
+  800590:	83 c4 10             	add    $0x10,%esp
+  800593:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800596:	5b                   	pop    %ebx
+  800597:	5e                   	pop    %esi
+  800598:	5f                   	pop    %edi
+  800599:	5d                   	pop    %ebp
+  80059a:	c3                   	ret
+
+0080059b <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80059b:	55                   	push   %ebp
+  80059c:	89 e5                	mov    %esp,%ebp
+  80059e:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8005a1:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8005a5:	8b 10                	mov    (%eax),%edx
+  8005a7:	3b 50 04             	cmp    0x4(%eax),%edx
+  8005aa:	73 0a                	jae    8005b6 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8005ac:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8005af:	89 08                	mov    %ecx,(%eax)
+  8005b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005b4:	88 02                	mov    %al,(%edx)
+}
+  8005b6:	5d                   	pop    %ebp
+  8005b7:	c3                   	ret
+
+008005b8 <printfmt>:
+{
+  8005b8:	55                   	push   %ebp
+  8005b9:	89 e5                	mov    %esp,%ebp
+  8005bb:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8005be:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8005c1:	50                   	push   %eax
+  8005c2:	ff 75 10             	push   0x10(%ebp)
+  8005c5:	ff 75 0c             	push   0xc(%ebp)
+  8005c8:	ff 75 08             	push   0x8(%ebp)
+  8005cb:	e8 05 00 00 00       	call   8005d5 <vprintfmt>
+}
+  8005d0:	83 c4 10             	add    $0x10,%esp
+  8005d3:	c9                   	leave
+  8005d4:	c3                   	ret
+
+008005d5 <vprintfmt>:
+{
+  8005d5:	55                   	push   %ebp
+  8005d6:	89 e5                	mov    %esp,%ebp
+  8005d8:	57                   	push   %edi
+  8005d9:	56                   	push   %esi
+  8005da:	53                   	push   %ebx
+  8005db:	83 ec 2c             	sub    $0x2c,%esp
+  8005de:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005e1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005e4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8005e7:	eb 0a                	jmp    8005f3 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8005e9:	83 ec 08             	sub    $0x8,%esp
+  8005ec:	53                   	push   %ebx
+  8005ed:	50                   	push   %eax
+  8005ee:	ff d6                	call   *%esi
+  8005f0:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8005f3:	83 c7 01             	add    $0x1,%edi
+  8005f6:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8005fa:	83 f8 25             	cmp    $0x25,%eax
+  8005fd:	74 0c                	je     80060b <vprintfmt+0x36>
+			if (ch == '\0')
+  8005ff:	85 c0                	test   %eax,%eax
+  800601:	75 e6                	jne    8005e9 <vprintfmt+0x14>
+}
+  800603:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800606:	5b                   	pop    %ebx
+  800607:	5e                   	pop    %esi
+  800608:	5f                   	pop    %edi
+  800609:	5d                   	pop    %ebp
+  80060a:	c3                   	ret
+		padc = ' ';
+  80060b:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80060f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800616:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80061d:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800624:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800629:	8d 47 01             	lea    0x1(%edi),%eax
+  80062c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80062f:	0f b6 17             	movzbl (%edi),%edx
+  800632:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800635:	3c 55                	cmp    $0x55,%al
+  800637:	0f 87 cf 03 00 00    	ja     800a0c <vprintfmt+0x437>
+  80063d:	0f b6 c0             	movzbl %al,%eax
+  800640:	ff 24 85 20 34 80 00 	jmp    *0x803420(,%eax,4)
+  800647:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80064a:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80064e:	eb d9                	jmp    800629 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800650:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800653:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800657:	eb d0                	jmp    800629 <vprintfmt+0x54>
+  800659:	0f b6 d2             	movzbl %dl,%edx
+  80065c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80065f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800664:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800667:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80066a:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80066e:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800671:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800674:	83 f9 09             	cmp    $0x9,%ecx
+  800677:	77 55                	ja     8006ce <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800679:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80067c:	eb e9                	jmp    800667 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80067e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800681:	8b 00                	mov    (%eax),%eax
+  800683:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800686:	8b 45 14             	mov    0x14(%ebp),%eax
+  800689:	8d 40 04             	lea    0x4(%eax),%eax
+  80068c:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80068f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800692:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800696:	79 91                	jns    800629 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800698:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80069b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80069e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8006a5:	eb 82                	jmp    800629 <vprintfmt+0x54>
+			if (width < 0)
+  8006a7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8006aa:	85 d2                	test   %edx,%edx
+  8006ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006b1:	0f 49 c2             	cmovns %edx,%eax
+  8006b4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006b7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8006ba:	e9 6a ff ff ff       	jmp    800629 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8006bf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8006c2:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8006c9:	e9 5b ff ff ff       	jmp    800629 <vprintfmt+0x54>
+  8006ce:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8006d1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006d4:	eb bc                	jmp    800692 <vprintfmt+0xbd>
+			lflag++;
+  8006d6:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8006d9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8006dc:	e9 48 ff ff ff       	jmp    800629 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8006e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e4:	8d 78 04             	lea    0x4(%eax),%edi
+  8006e7:	83 ec 08             	sub    $0x8,%esp
+  8006ea:	53                   	push   %ebx
+  8006eb:	ff 30                	push   (%eax)
+  8006ed:	ff d6                	call   *%esi
+			break;
+  8006ef:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8006f2:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8006f5:	e9 b1 02 00 00       	jmp    8009ab <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8006fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fd:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800700:	8b 10                	mov    (%eax),%edx
+  800702:	89 d0                	mov    %edx,%eax
+  800704:	f7 d8                	neg    %eax
+  800706:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800709:	83 f8 0d             	cmp    $0xd,%eax
+  80070c:	7f 23                	jg     800731 <vprintfmt+0x15c>
+  80070e:	8b 14 85 80 35 80 00 	mov    0x803580(,%eax,4),%edx
+  800715:	85 d2                	test   %edx,%edx
+  800717:	74 18                	je     800731 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800719:	52                   	push   %edx
+  80071a:	68 56 33 80 00       	push   $0x803356
+  80071f:	53                   	push   %ebx
+  800720:	56                   	push   %esi
+  800721:	e8 92 fe ff ff       	call   8005b8 <printfmt>
+  800726:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800729:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80072c:	e9 7a 02 00 00       	jmp    8009ab <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800731:	50                   	push   %eax
+  800732:	68 4d 33 80 00       	push   $0x80334d
+  800737:	53                   	push   %ebx
+  800738:	56                   	push   %esi
+  800739:	e8 7a fe ff ff       	call   8005b8 <printfmt>
+  80073e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800741:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800744:	e9 62 02 00 00       	jmp    8009ab <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800749:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074c:	83 c0 04             	add    $0x4,%eax
+  80074f:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800752:	8b 45 14             	mov    0x14(%ebp),%eax
+  800755:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800757:	85 c9                	test   %ecx,%ecx
+  800759:	b8 46 33 80 00       	mov    $0x803346,%eax
+  80075e:	0f 45 c1             	cmovne %ecx,%eax
+  800761:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800764:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800768:	7e 06                	jle    800770 <vprintfmt+0x19b>
+  80076a:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80076e:	75 0b                	jne    80077b <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800770:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800773:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800776:	89 75 08             	mov    %esi,0x8(%ebp)
+  800779:	eb 5c                	jmp    8007d7 <vprintfmt+0x202>
+  80077b:	83 ec 08             	sub    $0x8,%esp
+  80077e:	ff 75 d0             	push   -0x30(%ebp)
+  800781:	ff 75 cc             	push   -0x34(%ebp)
+  800784:	e8 20 03 00 00       	call   800aa9 <strnlen>
+  800789:	89 c2                	mov    %eax,%edx
+  80078b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80078e:	29 d0                	sub    %edx,%eax
+  800790:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800793:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800797:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80079a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80079d:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80079f:	eb 0e                	jmp    8007af <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8007a1:	83 ec 08             	sub    $0x8,%esp
+  8007a4:	53                   	push   %ebx
+  8007a5:	57                   	push   %edi
+  8007a6:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007a9:	83 ee 01             	sub    $0x1,%esi
+  8007ac:	83 c4 10             	add    $0x10,%esp
+  8007af:	85 f6                	test   %esi,%esi
+  8007b1:	7f ee                	jg     8007a1 <vprintfmt+0x1cc>
+  8007b3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007b6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007b9:	85 c0                	test   %eax,%eax
+  8007bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007c0:	0f 49 d0             	cmovns %eax,%edx
+  8007c3:	29 d0                	sub    %edx,%eax
+  8007c5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007c8:	eb a6                	jmp    800770 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8007ca:	83 ec 08             	sub    $0x8,%esp
+  8007cd:	53                   	push   %ebx
+  8007ce:	52                   	push   %edx
+  8007cf:	ff 55 08             	call   *0x8(%ebp)
+  8007d2:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007d5:	89 f1                	mov    %esi,%ecx
+  8007d7:	8d 71 01             	lea    0x1(%ecx),%esi
+  8007da:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8007de:	0f be d0             	movsbl %al,%edx
+  8007e1:	85 d2                	test   %edx,%edx
+  8007e3:	74 28                	je     80080d <vprintfmt+0x238>
+  8007e5:	85 ff                	test   %edi,%edi
+  8007e7:	78 05                	js     8007ee <vprintfmt+0x219>
+  8007e9:	83 ef 01             	sub    $0x1,%edi
+  8007ec:	78 30                	js     80081e <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8007ee:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8007f2:	74 d6                	je     8007ca <vprintfmt+0x1f5>
+  8007f4:	0f be c0             	movsbl %al,%eax
+  8007f7:	83 e8 20             	sub    $0x20,%eax
+  8007fa:	83 f8 5e             	cmp    $0x5e,%eax
+  8007fd:	76 cb                	jbe    8007ca <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8007ff:	83 ec 08             	sub    $0x8,%esp
+  800802:	53                   	push   %ebx
+  800803:	6a 3f                	push   $0x3f
+  800805:	ff 55 08             	call   *0x8(%ebp)
+  800808:	83 c4 10             	add    $0x10,%esp
+  80080b:	eb c8                	jmp    8007d5 <vprintfmt+0x200>
+  80080d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800810:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800813:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800816:	01 d0                	add    %edx,%eax
+  800818:	29 c8                	sub    %ecx,%eax
+  80081a:	89 c7                	mov    %eax,%edi
+  80081c:	eb 13                	jmp    800831 <vprintfmt+0x25c>
+  80081e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800821:	eb ed                	jmp    800810 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800823:	83 ec 08             	sub    $0x8,%esp
+  800826:	53                   	push   %ebx
+  800827:	6a 20                	push   $0x20
+  800829:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80082b:	83 ef 01             	sub    $0x1,%edi
+  80082e:	83 c4 10             	add    $0x10,%esp
+  800831:	85 ff                	test   %edi,%edi
+  800833:	7f ee                	jg     800823 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800835:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800838:	89 45 14             	mov    %eax,0x14(%ebp)
+  80083b:	e9 6b 01 00 00       	jmp    8009ab <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800840:	83 f9 01             	cmp    $0x1,%ecx
+  800843:	7f 1f                	jg     800864 <vprintfmt+0x28f>
+	else if (lflag)
+  800845:	85 c9                	test   %ecx,%ecx
+  800847:	74 67                	je     8008b0 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800849:	8b 45 14             	mov    0x14(%ebp),%eax
+  80084c:	8b 00                	mov    (%eax),%eax
+  80084e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800851:	89 c1                	mov    %eax,%ecx
+  800853:	c1 f9 1f             	sar    $0x1f,%ecx
+  800856:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800859:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085c:	8d 40 04             	lea    0x4(%eax),%eax
+  80085f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800862:	eb 17                	jmp    80087b <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800864:	8b 45 14             	mov    0x14(%ebp),%eax
+  800867:	8b 50 04             	mov    0x4(%eax),%edx
+  80086a:	8b 00                	mov    (%eax),%eax
+  80086c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80086f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800872:	8b 45 14             	mov    0x14(%ebp),%eax
+  800875:	8d 40 08             	lea    0x8(%eax),%eax
+  800878:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80087b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80087e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800881:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800886:	85 c9                	test   %ecx,%ecx
+  800888:	0f 89 03 01 00 00    	jns    800991 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  80088e:	83 ec 08             	sub    $0x8,%esp
+  800891:	53                   	push   %ebx
+  800892:	6a 2d                	push   $0x2d
+  800894:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800896:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800899:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80089c:	f7 da                	neg    %edx
+  80089e:	83 d1 00             	adc    $0x0,%ecx
+  8008a1:	f7 d9                	neg    %ecx
+  8008a3:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8008a6:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8008ab:	e9 e1 00 00 00       	jmp    800991 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8008b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b3:	8b 00                	mov    (%eax),%eax
+  8008b5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008b8:	89 c1                	mov    %eax,%ecx
+  8008ba:	c1 f9 1f             	sar    $0x1f,%ecx
+  8008bd:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8008c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c3:	8d 40 04             	lea    0x4(%eax),%eax
+  8008c6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008c9:	eb b0                	jmp    80087b <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8008cb:	83 f9 01             	cmp    $0x1,%ecx
+  8008ce:	7f 1e                	jg     8008ee <vprintfmt+0x319>
+	else if (lflag)
+  8008d0:	85 c9                	test   %ecx,%ecx
+  8008d2:	74 32                	je     800906 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8008d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d7:	8b 10                	mov    (%eax),%edx
+  8008d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008de:	8d 40 04             	lea    0x4(%eax),%eax
+  8008e1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008e4:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8008e9:	e9 a3 00 00 00       	jmp    800991 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8008ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f1:	8b 10                	mov    (%eax),%edx
+  8008f3:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008f6:	8d 40 08             	lea    0x8(%eax),%eax
+  8008f9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008fc:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800901:	e9 8b 00 00 00       	jmp    800991 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800906:	8b 45 14             	mov    0x14(%ebp),%eax
+  800909:	8b 10                	mov    (%eax),%edx
+  80090b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800910:	8d 40 04             	lea    0x4(%eax),%eax
+  800913:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800916:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80091b:	eb 74                	jmp    800991 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  80091d:	83 f9 01             	cmp    $0x1,%ecx
+  800920:	7f 1b                	jg     80093d <vprintfmt+0x368>
+	else if (lflag)
+  800922:	85 c9                	test   %ecx,%ecx
+  800924:	74 2c                	je     800952 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800926:	8b 45 14             	mov    0x14(%ebp),%eax
+  800929:	8b 10                	mov    (%eax),%edx
+  80092b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800930:	8d 40 04             	lea    0x4(%eax),%eax
+  800933:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800936:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80093b:	eb 54                	jmp    800991 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80093d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800940:	8b 10                	mov    (%eax),%edx
+  800942:	8b 48 04             	mov    0x4(%eax),%ecx
+  800945:	8d 40 08             	lea    0x8(%eax),%eax
+  800948:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80094b:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800950:	eb 3f                	jmp    800991 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800952:	8b 45 14             	mov    0x14(%ebp),%eax
+  800955:	8b 10                	mov    (%eax),%edx
+  800957:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80095c:	8d 40 04             	lea    0x4(%eax),%eax
+  80095f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800962:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800967:	eb 28                	jmp    800991 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800969:	83 ec 08             	sub    $0x8,%esp
+  80096c:	53                   	push   %ebx
+  80096d:	6a 30                	push   $0x30
+  80096f:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800971:	83 c4 08             	add    $0x8,%esp
+  800974:	53                   	push   %ebx
+  800975:	6a 78                	push   $0x78
+  800977:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800979:	8b 45 14             	mov    0x14(%ebp),%eax
+  80097c:	8b 10                	mov    (%eax),%edx
+  80097e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800983:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800986:	8d 40 04             	lea    0x4(%eax),%eax
+  800989:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80098c:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800991:	83 ec 0c             	sub    $0xc,%esp
+  800994:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800998:	50                   	push   %eax
+  800999:	ff 75 e0             	push   -0x20(%ebp)
+  80099c:	57                   	push   %edi
+  80099d:	51                   	push   %ecx
+  80099e:	52                   	push   %edx
+  80099f:	89 da                	mov    %ebx,%edx
+  8009a1:	89 f0                	mov    %esi,%eax
+  8009a3:	e8 4a fb ff ff       	call   8004f2 <printnum>
+			break;
+  8009a8:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8009ab:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8009ae:	e9 40 fc ff ff       	jmp    8005f3 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8009b3:	83 f9 01             	cmp    $0x1,%ecx
+  8009b6:	7f 1b                	jg     8009d3 <vprintfmt+0x3fe>
+	else if (lflag)
+  8009b8:	85 c9                	test   %ecx,%ecx
+  8009ba:	74 2c                	je     8009e8 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8009bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009bf:	8b 10                	mov    (%eax),%edx
+  8009c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009c6:	8d 40 04             	lea    0x4(%eax),%eax
+  8009c9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009cc:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8009d1:	eb be                	jmp    800991 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8009d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009d6:	8b 10                	mov    (%eax),%edx
+  8009d8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009db:	8d 40 08             	lea    0x8(%eax),%eax
+  8009de:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009e1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8009e6:	eb a9                	jmp    800991 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8009e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009eb:	8b 10                	mov    (%eax),%edx
+  8009ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009f2:	8d 40 04             	lea    0x4(%eax),%eax
+  8009f5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009f8:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8009fd:	eb 92                	jmp    800991 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8009ff:	83 ec 08             	sub    $0x8,%esp
+  800a02:	53                   	push   %ebx
+  800a03:	6a 25                	push   $0x25
+  800a05:	ff d6                	call   *%esi
+			break;
+  800a07:	83 c4 10             	add    $0x10,%esp
+  800a0a:	eb 9f                	jmp    8009ab <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800a0c:	83 ec 08             	sub    $0x8,%esp
+  800a0f:	53                   	push   %ebx
+  800a10:	6a 25                	push   $0x25
+  800a12:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800a14:	83 c4 10             	add    $0x10,%esp
+  800a17:	89 f8                	mov    %edi,%eax
+  800a19:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800a1d:	74 05                	je     800a24 <vprintfmt+0x44f>
+  800a1f:	83 e8 01             	sub    $0x1,%eax
+  800a22:	eb f5                	jmp    800a19 <vprintfmt+0x444>
+  800a24:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800a27:	eb 82                	jmp    8009ab <vprintfmt+0x3d6>
+
+00800a29 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800a29:	55                   	push   %ebp
+  800a2a:	89 e5                	mov    %esp,%ebp
+  800a2c:	83 ec 18             	sub    $0x18,%esp
+  800a2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a32:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800a35:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800a38:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a3c:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800a3f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800a46:	85 c0                	test   %eax,%eax
+  800a48:	74 26                	je     800a70 <vsnprintf+0x47>
+  800a4a:	85 d2                	test   %edx,%edx
+  800a4c:	7e 22                	jle    800a70 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800a4e:	ff 75 14             	push   0x14(%ebp)
+  800a51:	ff 75 10             	push   0x10(%ebp)
+  800a54:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800a57:	50                   	push   %eax
+  800a58:	68 9b 05 80 00       	push   $0x80059b
+  800a5d:	e8 73 fb ff ff       	call   8005d5 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800a62:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800a65:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800a68:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a6b:	83 c4 10             	add    $0x10,%esp
+}
+  800a6e:	c9                   	leave
+  800a6f:	c3                   	ret
+		return -E_INVAL;
+  800a70:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a75:	eb f7                	jmp    800a6e <vsnprintf+0x45>
+
+00800a77 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a77:	55                   	push   %ebp
+  800a78:	89 e5                	mov    %esp,%ebp
+  800a7a:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800a7d:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800a80:	50                   	push   %eax
+  800a81:	ff 75 10             	push   0x10(%ebp)
+  800a84:	ff 75 0c             	push   0xc(%ebp)
+  800a87:	ff 75 08             	push   0x8(%ebp)
+  800a8a:	e8 9a ff ff ff       	call   800a29 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800a8f:	c9                   	leave
+  800a90:	c3                   	ret
+
+00800a91 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a91:	55                   	push   %ebp
+  800a92:	89 e5                	mov    %esp,%ebp
+  800a94:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800a97:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a9c:	eb 03                	jmp    800aa1 <strlen+0x10>
+		n++;
+  800a9e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800aa1:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800aa5:	75 f7                	jne    800a9e <strlen+0xd>
+	return n;
+}
+  800aa7:	5d                   	pop    %ebp
+  800aa8:	c3                   	ret
+
+00800aa9 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800aa9:	55                   	push   %ebp
+  800aaa:	89 e5                	mov    %esp,%ebp
+  800aac:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800aaf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ab2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ab7:	eb 03                	jmp    800abc <strnlen+0x13>
+		n++;
+  800ab9:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800abc:	39 d0                	cmp    %edx,%eax
+  800abe:	74 08                	je     800ac8 <strnlen+0x1f>
+  800ac0:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800ac4:	75 f3                	jne    800ab9 <strnlen+0x10>
+  800ac6:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800ac8:	89 d0                	mov    %edx,%eax
+  800aca:	5d                   	pop    %ebp
+  800acb:	c3                   	ret
+
+00800acc <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800acc:	55                   	push   %ebp
+  800acd:	89 e5                	mov    %esp,%ebp
+  800acf:	53                   	push   %ebx
+  800ad0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ad3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800ad6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800adb:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800adf:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800ae2:	83 c0 01             	add    $0x1,%eax
+  800ae5:	84 d2                	test   %dl,%dl
+  800ae7:	75 f2                	jne    800adb <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800ae9:	89 c8                	mov    %ecx,%eax
+  800aeb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800aee:	c9                   	leave
+  800aef:	c3                   	ret
+
+00800af0 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800af0:	55                   	push   %ebp
+  800af1:	89 e5                	mov    %esp,%ebp
+  800af3:	53                   	push   %ebx
+  800af4:	83 ec 10             	sub    $0x10,%esp
+  800af7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800afa:	53                   	push   %ebx
+  800afb:	e8 91 ff ff ff       	call   800a91 <strlen>
+  800b00:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800b03:	ff 75 0c             	push   0xc(%ebp)
+  800b06:	01 d8                	add    %ebx,%eax
+  800b08:	50                   	push   %eax
+  800b09:	e8 be ff ff ff       	call   800acc <strcpy>
+	return dst;
+}
+  800b0e:	89 d8                	mov    %ebx,%eax
+  800b10:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b13:	c9                   	leave
+  800b14:	c3                   	ret
+
+00800b15 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b15:	55                   	push   %ebp
+  800b16:	89 e5                	mov    %esp,%ebp
+  800b18:	56                   	push   %esi
+  800b19:	53                   	push   %ebx
+  800b1a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b1d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800b20:	89 f3                	mov    %esi,%ebx
+  800b22:	03 5d 10             	add    0x10(%ebp),%ebx
+  800b25:	89 f0                	mov    %esi,%eax
+  800b27:	eb 0f                	jmp    800b38 <strncpy+0x23>
+		*dst++ = *src;
+  800b29:	83 c0 01             	add    $0x1,%eax
+  800b2c:	0f b6 0a             	movzbl (%edx),%ecx
+  800b2f:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800b32:	80 f9 01             	cmp    $0x1,%cl
+  800b35:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800b38:	39 d8                	cmp    %ebx,%eax
+  800b3a:	75 ed                	jne    800b29 <strncpy+0x14>
+	}
+	return ret;
+}
+  800b3c:	89 f0                	mov    %esi,%eax
+  800b3e:	5b                   	pop    %ebx
+  800b3f:	5e                   	pop    %esi
+  800b40:	5d                   	pop    %ebp
+  800b41:	c3                   	ret
+
+00800b42 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800b42:	55                   	push   %ebp
+  800b43:	89 e5                	mov    %esp,%ebp
+  800b45:	56                   	push   %esi
+  800b46:	53                   	push   %ebx
+  800b47:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b4a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b4d:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800b50:	89 f0                	mov    %esi,%eax
+  800b52:	85 d2                	test   %edx,%edx
+  800b54:	74 21                	je     800b77 <strlcpy+0x35>
+  800b56:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800b5a:	89 f2                	mov    %esi,%edx
+  800b5c:	eb 09                	jmp    800b67 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800b5e:	83 c1 01             	add    $0x1,%ecx
+  800b61:	83 c2 01             	add    $0x1,%edx
+  800b64:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800b67:	39 c2                	cmp    %eax,%edx
+  800b69:	74 09                	je     800b74 <strlcpy+0x32>
+  800b6b:	0f b6 19             	movzbl (%ecx),%ebx
+  800b6e:	84 db                	test   %bl,%bl
+  800b70:	75 ec                	jne    800b5e <strlcpy+0x1c>
+  800b72:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800b74:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800b77:	29 f0                	sub    %esi,%eax
+}
+  800b79:	5b                   	pop    %ebx
+  800b7a:	5e                   	pop    %esi
+  800b7b:	5d                   	pop    %ebp
+  800b7c:	c3                   	ret
+
+00800b7d <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b7d:	55                   	push   %ebp
+  800b7e:	89 e5                	mov    %esp,%ebp
+  800b80:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b83:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800b86:	eb 06                	jmp    800b8e <strcmp+0x11>
+		p++, q++;
+  800b88:	83 c1 01             	add    $0x1,%ecx
+  800b8b:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800b8e:	0f b6 01             	movzbl (%ecx),%eax
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 04                	je     800b99 <strcmp+0x1c>
+  800b95:	3a 02                	cmp    (%edx),%al
+  800b97:	74 ef                	je     800b88 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b99:	0f b6 c0             	movzbl %al,%eax
+  800b9c:	0f b6 12             	movzbl (%edx),%edx
+  800b9f:	29 d0                	sub    %edx,%eax
+}
+  800ba1:	5d                   	pop    %ebp
+  800ba2:	c3                   	ret
+
+00800ba3 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800ba3:	55                   	push   %ebp
+  800ba4:	89 e5                	mov    %esp,%ebp
+  800ba6:	53                   	push   %ebx
+  800ba7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800baa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bad:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800bb0:	eb 09                	jmp    800bbb <strncmp+0x18>
+		n--, p++, q++;
+  800bb2:	83 ea 01             	sub    $0x1,%edx
+  800bb5:	83 c0 01             	add    $0x1,%eax
+  800bb8:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800bbb:	85 d2                	test   %edx,%edx
+  800bbd:	74 18                	je     800bd7 <strncmp+0x34>
+  800bbf:	0f b6 18             	movzbl (%eax),%ebx
+  800bc2:	84 db                	test   %bl,%bl
+  800bc4:	74 04                	je     800bca <strncmp+0x27>
+  800bc6:	3a 19                	cmp    (%ecx),%bl
+  800bc8:	74 e8                	je     800bb2 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800bca:	0f b6 00             	movzbl (%eax),%eax
+  800bcd:	0f b6 11             	movzbl (%ecx),%edx
+  800bd0:	29 d0                	sub    %edx,%eax
+}
+  800bd2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bd5:	c9                   	leave
+  800bd6:	c3                   	ret
+		return 0;
+  800bd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bdc:	eb f4                	jmp    800bd2 <strncmp+0x2f>
+
+00800bde <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800bde:	55                   	push   %ebp
+  800bdf:	89 e5                	mov    %esp,%ebp
+  800be1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800be4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800be8:	eb 03                	jmp    800bed <strchr+0xf>
+  800bea:	83 c0 01             	add    $0x1,%eax
+  800bed:	0f b6 10             	movzbl (%eax),%edx
+  800bf0:	84 d2                	test   %dl,%dl
+  800bf2:	74 06                	je     800bfa <strchr+0x1c>
+		if (*s == c)
+  800bf4:	38 ca                	cmp    %cl,%dl
+  800bf6:	75 f2                	jne    800bea <strchr+0xc>
+  800bf8:	eb 05                	jmp    800bff <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800bfa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bff:	5d                   	pop    %ebp
+  800c00:	c3                   	ret
+
+00800c01 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800c01:	55                   	push   %ebp
+  800c02:	89 e5                	mov    %esp,%ebp
+  800c04:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c07:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800c0b:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800c0e:	38 ca                	cmp    %cl,%dl
+  800c10:	74 09                	je     800c1b <strfind+0x1a>
+  800c12:	84 d2                	test   %dl,%dl
+  800c14:	74 05                	je     800c1b <strfind+0x1a>
+	for (; *s; s++)
+  800c16:	83 c0 01             	add    $0x1,%eax
+  800c19:	eb f0                	jmp    800c0b <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800c1b:	5d                   	pop    %ebp
+  800c1c:	c3                   	ret
+
+00800c1d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800c1d:	55                   	push   %ebp
+  800c1e:	89 e5                	mov    %esp,%ebp
+  800c20:	57                   	push   %edi
+  800c21:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800c24:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800c27:	85 c9                	test   %ecx,%ecx
+  800c29:	74 20                	je     800c4b <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800c2b:	89 f8                	mov    %edi,%eax
+  800c2d:	09 c8                	or     %ecx,%eax
+  800c2f:	a8 03                	test   $0x3,%al
+  800c31:	75 12                	jne    800c45 <memset+0x28>
+		c &= 0xFF;
+  800c33:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800c37:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800c3d:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800c40:	fc                   	cld
+  800c41:	f3 ab                	rep stos %eax,%es:(%edi)
+  800c43:	eb 06                	jmp    800c4b <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800c45:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c48:	fc                   	cld
+  800c49:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800c4b:	89 f8                	mov    %edi,%eax
+  800c4d:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c50:	c9                   	leave
+  800c51:	c3                   	ret
+
+00800c52 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800c52:	55                   	push   %ebp
+  800c53:	89 e5                	mov    %esp,%ebp
+  800c55:	57                   	push   %edi
+  800c56:	56                   	push   %esi
+  800c57:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c5a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c5d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800c60:	39 c6                	cmp    %eax,%esi
+  800c62:	73 32                	jae    800c96 <memmove+0x44>
+  800c64:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c67:	39 d0                	cmp    %edx,%eax
+  800c69:	73 2b                	jae    800c96 <memmove+0x44>
+		s += n;
+		d += n;
+  800c6b:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c6e:	89 d6                	mov    %edx,%esi
+  800c70:	09 fe                	or     %edi,%esi
+  800c72:	09 ce                	or     %ecx,%esi
+  800c74:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c7a:	75 0e                	jne    800c8a <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c7c:	83 ef 04             	sub    $0x4,%edi
+  800c7f:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c82:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800c85:	fd                   	std
+  800c86:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c88:	eb 09                	jmp    800c93 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c8a:	83 ef 01             	sub    $0x1,%edi
+  800c8d:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800c90:	fd                   	std
+  800c91:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c93:	fc                   	cld
+  800c94:	eb 1a                	jmp    800cb0 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c96:	89 f2                	mov    %esi,%edx
+  800c98:	09 c2                	or     %eax,%edx
+  800c9a:	09 ca                	or     %ecx,%edx
+  800c9c:	f6 c2 03             	test   $0x3,%dl
+  800c9f:	75 0a                	jne    800cab <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800ca1:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800ca4:	89 c7                	mov    %eax,%edi
+  800ca6:	fc                   	cld
+  800ca7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ca9:	eb 05                	jmp    800cb0 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800cab:	89 c7                	mov    %eax,%edi
+  800cad:	fc                   	cld
+  800cae:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800cb0:	5e                   	pop    %esi
+  800cb1:	5f                   	pop    %edi
+  800cb2:	5d                   	pop    %ebp
+  800cb3:	c3                   	ret
+
+00800cb4 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800cb4:	55                   	push   %ebp
+  800cb5:	89 e5                	mov    %esp,%ebp
+  800cb7:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800cba:	ff 75 10             	push   0x10(%ebp)
+  800cbd:	ff 75 0c             	push   0xc(%ebp)
+  800cc0:	ff 75 08             	push   0x8(%ebp)
+  800cc3:	e8 8a ff ff ff       	call   800c52 <memmove>
+}
+  800cc8:	c9                   	leave
+  800cc9:	c3                   	ret
+
+00800cca <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800cca:	55                   	push   %ebp
+  800ccb:	89 e5                	mov    %esp,%ebp
+  800ccd:	56                   	push   %esi
+  800cce:	53                   	push   %ebx
+  800ccf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cd2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800cd5:	89 c6                	mov    %eax,%esi
+  800cd7:	03 75 10             	add    0x10(%ebp),%esi
+  800cda:	eb 06                	jmp    800ce2 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800cdc:	83 c0 01             	add    $0x1,%eax
+  800cdf:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800ce2:	39 f0                	cmp    %esi,%eax
+  800ce4:	74 14                	je     800cfa <memcmp+0x30>
+		if (*s1 != *s2)
+  800ce6:	0f b6 08             	movzbl (%eax),%ecx
+  800ce9:	0f b6 1a             	movzbl (%edx),%ebx
+  800cec:	38 d9                	cmp    %bl,%cl
+  800cee:	74 ec                	je     800cdc <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800cf0:	0f b6 c1             	movzbl %cl,%eax
+  800cf3:	0f b6 db             	movzbl %bl,%ebx
+  800cf6:	29 d8                	sub    %ebx,%eax
+  800cf8:	eb 05                	jmp    800cff <memcmp+0x35>
+	}
+
+	return 0;
+  800cfa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cff:	5b                   	pop    %ebx
+  800d00:	5e                   	pop    %esi
+  800d01:	5d                   	pop    %ebp
+  800d02:	c3                   	ret
+
+00800d03 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800d03:	55                   	push   %ebp
+  800d04:	89 e5                	mov    %esp,%ebp
+  800d06:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d09:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800d0c:	89 c2                	mov    %eax,%edx
+  800d0e:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800d11:	eb 03                	jmp    800d16 <memfind+0x13>
+  800d13:	83 c0 01             	add    $0x1,%eax
+  800d16:	39 d0                	cmp    %edx,%eax
+  800d18:	73 04                	jae    800d1e <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800d1a:	38 08                	cmp    %cl,(%eax)
+  800d1c:	75 f5                	jne    800d13 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800d1e:	5d                   	pop    %ebp
+  800d1f:	c3                   	ret
+
+00800d20 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800d20:	55                   	push   %ebp
+  800d21:	89 e5                	mov    %esp,%ebp
+  800d23:	57                   	push   %edi
+  800d24:	56                   	push   %esi
+  800d25:	53                   	push   %ebx
+  800d26:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d29:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800d2c:	eb 03                	jmp    800d31 <strtol+0x11>
+		s++;
+  800d2e:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800d31:	0f b6 02             	movzbl (%edx),%eax
+  800d34:	3c 20                	cmp    $0x20,%al
+  800d36:	74 f6                	je     800d2e <strtol+0xe>
+  800d38:	3c 09                	cmp    $0x9,%al
+  800d3a:	74 f2                	je     800d2e <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800d3c:	3c 2b                	cmp    $0x2b,%al
+  800d3e:	74 2a                	je     800d6a <strtol+0x4a>
+	int neg = 0;
+  800d40:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800d45:	3c 2d                	cmp    $0x2d,%al
+  800d47:	74 2b                	je     800d74 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d49:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800d4f:	75 0f                	jne    800d60 <strtol+0x40>
+  800d51:	80 3a 30             	cmpb   $0x30,(%edx)
+  800d54:	74 28                	je     800d7e <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800d56:	85 db                	test   %ebx,%ebx
+  800d58:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d5d:	0f 44 d8             	cmove  %eax,%ebx
+  800d60:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d65:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d68:	eb 46                	jmp    800db0 <strtol+0x90>
+		s++;
+  800d6a:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800d6d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d72:	eb d5                	jmp    800d49 <strtol+0x29>
+		s++, neg = 1;
+  800d74:	83 c2 01             	add    $0x1,%edx
+  800d77:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d7c:	eb cb                	jmp    800d49 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d7e:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d82:	74 0e                	je     800d92 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800d84:	85 db                	test   %ebx,%ebx
+  800d86:	75 d8                	jne    800d60 <strtol+0x40>
+		s++, base = 8;
+  800d88:	83 c2 01             	add    $0x1,%edx
+  800d8b:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d90:	eb ce                	jmp    800d60 <strtol+0x40>
+		s += 2, base = 16;
+  800d92:	83 c2 02             	add    $0x2,%edx
+  800d95:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d9a:	eb c4                	jmp    800d60 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800d9c:	0f be c0             	movsbl %al,%eax
+  800d9f:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800da2:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800da5:	7d 3a                	jge    800de1 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800da7:	83 c2 01             	add    $0x1,%edx
+  800daa:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800dae:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800db0:	0f b6 02             	movzbl (%edx),%eax
+  800db3:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800db6:	89 f3                	mov    %esi,%ebx
+  800db8:	80 fb 09             	cmp    $0x9,%bl
+  800dbb:	76 df                	jbe    800d9c <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800dbd:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800dc0:	89 f3                	mov    %esi,%ebx
+  800dc2:	80 fb 19             	cmp    $0x19,%bl
+  800dc5:	77 08                	ja     800dcf <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800dc7:	0f be c0             	movsbl %al,%eax
+  800dca:	83 e8 57             	sub    $0x57,%eax
+  800dcd:	eb d3                	jmp    800da2 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800dcf:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800dd2:	89 f3                	mov    %esi,%ebx
+  800dd4:	80 fb 19             	cmp    $0x19,%bl
+  800dd7:	77 08                	ja     800de1 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800dd9:	0f be c0             	movsbl %al,%eax
+  800ddc:	83 e8 37             	sub    $0x37,%eax
+  800ddf:	eb c1                	jmp    800da2 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800de1:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800de5:	74 05                	je     800dec <strtol+0xcc>
+		*endptr = (char *) s;
+  800de7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800dea:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800dec:	89 c8                	mov    %ecx,%eax
+  800dee:	f7 d8                	neg    %eax
+  800df0:	85 ff                	test   %edi,%edi
+  800df2:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800df5:	89 c8                	mov    %ecx,%eax
+  800df7:	5b                   	pop    %ebx
+  800df8:	5e                   	pop    %esi
+  800df9:	5f                   	pop    %edi
+  800dfa:	5d                   	pop    %ebp
+  800dfb:	c3                   	ret
+
+00800dfc <atoi>:
+
+int
+atoi(const char *s)
+{
+  800dfc:	55                   	push   %ebp
+  800dfd:	89 e5                	mov    %esp,%ebp
+  800dff:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800e02:	6a 0a                	push   $0xa
+  800e04:	6a 00                	push   $0x0
+  800e06:	ff 75 08             	push   0x8(%ebp)
+  800e09:	e8 12 ff ff ff       	call   800d20 <strtol>
+}
+  800e0e:	c9                   	leave
+  800e0f:	c3                   	ret
+
+00800e10 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800e10:	55                   	push   %ebp
+  800e11:	89 e5                	mov    %esp,%ebp
+  800e13:	57                   	push   %edi
+  800e14:	56                   	push   %esi
+  800e15:	53                   	push   %ebx
+  800e16:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800e1c:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800e22:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800e28:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800e2e:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800e35:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800e38:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800e3f:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800e42:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800e49:	74 76                	je     800ec1 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800e4b:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800e51:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e54:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800e5a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e61:	0f 88 06 01 00 00    	js     800f6d <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800e67:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e6e:	0f 84 48 01 00 00    	je     800fbc <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800e74:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800e7a:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800e80:	be 00 00 00 00       	mov    $0x0,%esi
+  800e85:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800e8b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800e8e:	55                   	push   %ebp
+  800e8f:	68 98 0e 80 00       	push   $0x800e98
+  800e94:	89 e5                	mov    %esp,%ebp
+  800e96:	0f 34                	sysenter
+  800e98:	83 c4 04             	add    $0x4,%esp
+  800e9b:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800e9c:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800ea2:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800ea8:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800eab:	0f 85 9a 01 00 00    	jne    80104b <page_vec_call+0x23b>
+  800eb1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800eb6:	8b 75 08             	mov    0x8(%ebp),%esi
+  800eb9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ebc:	e9 29 01 00 00       	jmp    800fea <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800ec1:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800ec7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800eca:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800ecc:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800ed3:	78 2f                	js     800f04 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800ed5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800edc:	74 72                	je     800f50 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800ede:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800ee4:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800eea:	b8 10 00 00 00       	mov    $0x10,%eax
+  800eef:	89 fb                	mov    %edi,%ebx
+  800ef1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800ef4:	55                   	push   %ebp
+  800ef5:	68 fe 0e 80 00       	push   $0x800efe
+  800efa:	89 e5                	mov    %esp,%ebp
+  800efc:	0f 34                	sysenter
+  800efe:	83 c4 04             	add    $0x4,%esp
+  800f01:	5d                   	pop    %ebp
+	return ret;
+  800f02:	eb 98                	jmp    800e9c <page_vec_call+0x8c>
+	asm volatile("cpuid"
+  800f04:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f09:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800f0b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f10:	f6 c6 08             	test   $0x8,%dh
+  800f13:	74 15                	je     800f2a <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f15:	89 c2                	mov    %eax,%edx
+  800f17:	c1 ea 08             	shr    $0x8,%edx
+  800f1a:	83 e2 0f             	and    $0xf,%edx
+  800f1d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f22:	83 fa 06             	cmp    $0x6,%edx
+  800f25:	74 0e                	je     800f35 <page_vec_call+0x125>
+  800f27:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f2a:	0f b6 c9             	movzbl %cl,%ecx
+  800f2d:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800f33:	eb a0                	jmp    800ed5 <page_vec_call+0xc5>
+  800f35:	89 c2                	mov    %eax,%edx
+  800f37:	c1 ea 04             	shr    $0x4,%edx
+  800f3a:	83 e2 0f             	and    $0xf,%edx
+  800f3d:	83 fa 02             	cmp    $0x2,%edx
+  800f40:	77 e5                	ja     800f27 <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800f42:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f45:	83 f8 02             	cmp    $0x2,%eax
+  800f48:	0f 97 c1             	seta   %cl
+  800f4b:	0f b6 c9             	movzbl %cl,%ecx
+  800f4e:	eb d7                	jmp    800f27 <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800f50:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f55:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800f5b:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800f61:	89 fb                	mov    %edi,%ebx
+  800f63:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800f66:	cd 30                	int    $0x30
+  800f68:	e9 2f ff ff ff       	jmp    800e9c <page_vec_call+0x8c>
+  800f6d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f72:	0f a2                	cpuid
+		return 0;
+  800f74:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f79:	f6 c6 08             	test   $0x8,%dh
+  800f7c:	74 15                	je     800f93 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f7e:	89 c2                	mov    %eax,%edx
+  800f80:	c1 ea 08             	shr    $0x8,%edx
+  800f83:	83 e2 0f             	and    $0xf,%edx
+  800f86:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f8b:	83 fa 06             	cmp    $0x6,%edx
+  800f8e:	74 11                	je     800fa1 <page_vec_call+0x191>
+  800f90:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f93:	0f b6 c9             	movzbl %cl,%ecx
+  800f96:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800f9c:	e9 c6 fe ff ff       	jmp    800e67 <page_vec_call+0x57>
+  800fa1:	89 c2                	mov    %eax,%edx
+  800fa3:	c1 ea 04             	shr    $0x4,%edx
+  800fa6:	83 e2 0f             	and    $0xf,%edx
+  800fa9:	83 fa 02             	cmp    $0x2,%edx
+  800fac:	77 e2                	ja     800f90 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800fae:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800fb1:	83 f8 02             	cmp    $0x2,%eax
+  800fb4:	0f 97 c1             	seta   %cl
+  800fb7:	0f b6 c9             	movzbl %cl,%ecx
+  800fba:	eb d4                	jmp    800f90 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800fbc:	be 00 00 00 00       	mov    $0x0,%esi
+  800fc1:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800fc7:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800fcd:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800fd3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800fd6:	cd 30                	int    $0x30
+  800fd8:	e9 bf fe ff ff       	jmp    800e9c <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800fdd:	29 da                	sub    %ebx,%edx
+			vec++;
+  800fdf:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800fe2:	83 e8 01             	sub    $0x1,%eax
+  800fe5:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800fea:	85 c0                	test   %eax,%eax
+  800fec:	74 58                	je     801046 <page_vec_call+0x236>
+  800fee:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800ff1:	39 da                	cmp    %ebx,%edx
+  800ff3:	73 e8                	jae    800fdd <page_vec_call+0x1cd>
+  800ff5:	89 75 08             	mov    %esi,0x8(%ebp)
+  800ff8:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800ffb:	84 c9                	test   %cl,%cl
+  800ffd:	74 06                	je     801005 <page_vec_call+0x1f5>
+  800fff:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  801005:	83 ec 04             	sub    $0x4,%esp
+  801008:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80100b:	c1 e0 04             	shl    $0x4,%eax
+  80100e:	50                   	push   %eax
+  80100f:	ff 75 08             	push   0x8(%ebp)
+  801012:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  801018:	53                   	push   %ebx
+  801019:	e8 34 fc ff ff       	call   800c52 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  80101e:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  801024:	89 c2                	mov    %eax,%edx
+  801026:	c1 e2 0c             	shl    $0xc,%edx
+  801029:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  80102f:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  801035:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  80103b:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  80103e:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  801041:	e9 f2 fd ff ff       	jmp    800e38 <page_vec_call+0x28>
+			r = 0;
+  801046:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  80104b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80104f:	74 0b                	je     80105c <page_vec_call+0x24c>
+		*done = total;
+  801051:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801054:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  80105a:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  80105c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80105f:	5b                   	pop    %ebx
+  801060:	5e                   	pop    %esi
+  801061:	5f                   	pop    %edi
+  801062:	5d                   	pop    %ebp
+  801063:	c3                   	ret
+
+00801064 <sys_cputs>:
+{
+  801064:	55                   	push   %ebp
+  801065:	89 e5                	mov    %esp,%ebp
+  801067:	57                   	push   %edi
+  801068:	56                   	push   %esi
+  801069:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80106a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801071:	78 2d                	js     8010a0 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  801073:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80107a:	74 70                	je     8010ec <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  80107c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801081:	8b 55 08             	mov    0x8(%ebp),%edx
+  801084:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801087:	89 c3                	mov    %eax,%ebx
+  801089:	89 c7                	mov    %eax,%edi
+  80108b:	89 c6                	mov    %eax,%esi
+  80108d:	55                   	push   %ebp
+  80108e:	68 97 10 80 00       	push   $0x801097
+  801093:	89 e5                	mov    %esp,%ebp
+  801095:	0f 34                	sysenter
+  801097:	83 c4 04             	add    $0x4,%esp
+  80109a:	5d                   	pop    %ebp
+}
+  80109b:	5b                   	pop    %ebx
+  80109c:	5e                   	pop    %esi
+  80109d:	5f                   	pop    %edi
+  80109e:	5d                   	pop    %ebp
+  80109f:	c3                   	ret
+  8010a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010a5:	0f a2                	cpuid
+		return 0;
+  8010a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8010ac:	f6 c6 08             	test   $0x8,%dh
+  8010af:	74 15                	je     8010c6 <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010b1:	89 c2                	mov    %eax,%edx
+  8010b3:	c1 ea 08             	shr    $0x8,%edx
+  8010b6:	83 e2 0f             	and    $0xf,%edx
+  8010b9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8010be:	83 fa 06             	cmp    $0x6,%edx
+  8010c1:	74 0e                	je     8010d1 <sys_cputs+0x6d>
+  8010c3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8010c6:	0f b6 c9             	movzbl %cl,%ecx
+  8010c9:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8010cf:	eb a2                	jmp    801073 <sys_cputs+0xf>
+  8010d1:	89 c2                	mov    %eax,%edx
+  8010d3:	c1 ea 04             	shr    $0x4,%edx
+  8010d6:	83 e2 0f             	and    $0xf,%edx
+  8010d9:	83 fa 02             	cmp    $0x2,%edx
+  8010dc:	77 e5                	ja     8010c3 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  8010de:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010e1:	83 f8 02             	cmp    $0x2,%eax
+  8010e4:	0f 97 c1             	seta   %cl
+  8010e7:	0f b6 c9             	movzbl %cl,%ecx
+  8010ea:	eb d7                	jmp    8010c3 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  8010ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f7:	89 c3                	mov    %eax,%ebx
+  8010f9:	89 c7                	mov    %eax,%edi
+  8010fb:	89 c6                	mov    %eax,%esi
+  8010fd:	cd 30                	int    $0x30
+}
+  8010ff:	eb 9a                	jmp    80109b <sys_cputs+0x37>
+
+00801101 <sys_cgetc>:
+{
+  801101:	55                   	push   %ebp
+  801102:	89 e5                	mov    %esp,%ebp
+  801104:	57                   	push   %edi
+  801105:	56                   	push   %esi
+  801106:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801107:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80110e:	78 2e                	js     80113e <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  801110:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801117:	74 71                	je     80118a <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  801119:	ba 00 00 00 00       	mov    $0x0,%edx
+  80111e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801123:	89 d1                	mov    %edx,%ecx
+  801125:	89 d3                	mov    %edx,%ebx
+  801127:	89 d7                	mov    %edx,%edi
+  801129:	89 d6                	mov    %edx,%esi
+  80112b:	55                   	push   %ebp
+  80112c:	68 35 11 80 00       	push   $0x801135
+  801131:	89 e5                	mov    %esp,%ebp
+  801133:	0f 34                	sysenter
+  801135:	83 c4 04             	add    $0x4,%esp
+  801138:	5d                   	pop    %ebp
+}
+  801139:	5b                   	pop    %ebx
+  80113a:	5e                   	pop    %esi
+  80113b:	5f                   	pop    %edi
+  80113c:	5d                   	pop    %ebp
+  80113d:	c3                   	ret
+  80113e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801143:	0f a2                	cpuid
+		return 0;
+  801145:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80114a:	f6 c6 08             	test   $0x8,%dh
+  80114d:	74 15                	je     801164 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80114f:	89 c2                	mov    %eax,%edx
+  801151:	c1 ea 08             	shr    $0x8,%edx
+  801154:	83 e2 0f             	and    $0xf,%edx
+  801157:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80115c:	83 fa 06             	cmp    $0x6,%edx
+  80115f:	74 0e                	je     80116f <sys_cgetc+0x6e>
+  801161:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801164:	0f b6 c9             	movzbl %cl,%ecx
+  801167:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80116d:	eb a1                	jmp    801110 <sys_cgetc+0xf>
+  80116f:	89 c2                	mov    %eax,%edx
+  801171:	c1 ea 04             	shr    $0x4,%edx
+  801174:	83 e2 0f             	and    $0xf,%edx
+  801177:	83 fa 02             	cmp    $0x2,%edx
+  80117a:	77 e5                	ja     801161 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  80117c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80117f:	83 f8 02             	cmp    $0x2,%eax
+  801182:	0f 97 c1             	seta   %cl
+  801185:	0f b6 c9             	movzbl %cl,%ecx
+  801188:	eb d7                	jmp    801161 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  80118a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80118f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801194:	89 d1                	mov    %edx,%ecx
+  801196:	89 d3                	mov    %edx,%ebx
+  801198:	89 d7                	mov    %edx,%edi
+  80119a:	89 d6                	mov    %edx,%esi
+  80119c:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  80119e:	eb 99                	jmp    801139 <sys_cgetc+0x38>
+
+008011a0 <sys_env_destroy>:
+{
+  8011a0:	55                   	push   %ebp
+  8011a1:	89 e5                	mov    %esp,%ebp
+  8011a3:	57                   	push   %edi
+  8011a4:	56                   	push   %esi
+  8011a5:	53                   	push   %ebx
+  8011a6:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8011a9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8011b0:	78 36                	js     8011e8 <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  8011b2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8011b9:	74 79                	je     801234 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  8011bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011c3:	b8 03 00 00 00       	mov    $0x3,%eax
+  8011c8:	89 cb                	mov    %ecx,%ebx
+  8011ca:	89 cf                	mov    %ecx,%edi
+  8011cc:	89 ce                	mov    %ecx,%esi
+  8011ce:	55                   	push   %ebp
+  8011cf:	68 d8 11 80 00       	push   $0x8011d8
+  8011d4:	89 e5                	mov    %esp,%ebp
+  8011d6:	0f 34                	sysenter
+  8011d8:	83 c4 04             	add    $0x4,%esp
+  8011db:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8011dc:	85 c0                	test   %eax,%eax
+  8011de:	7f 6b                	jg     80124b <sys_env_destroy+0xab>
+}
+  8011e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e3:	5b                   	pop    %ebx
+  8011e4:	5e                   	pop    %esi
+  8011e5:	5f                   	pop    %edi
+  8011e6:	5d                   	pop    %ebp
+  8011e7:	c3                   	ret
+  8011e8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011ed:	0f a2                	cpuid
+		return 0;
+  8011ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8011f4:	f6 c6 08             	test   $0x8,%dh
+  8011f7:	74 15                	je     80120e <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011f9:	89 c2                	mov    %eax,%edx
+  8011fb:	c1 ea 08             	shr    $0x8,%edx
+  8011fe:	83 e2 0f             	and    $0xf,%edx
+  801201:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801206:	83 fa 06             	cmp    $0x6,%edx
+  801209:	74 0e                	je     801219 <sys_env_destroy+0x79>
+  80120b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80120e:	0f b6 c9             	movzbl %cl,%ecx
+  801211:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801217:	eb 99                	jmp    8011b2 <sys_env_destroy+0x12>
+  801219:	89 c2                	mov    %eax,%edx
+  80121b:	c1 ea 04             	shr    $0x4,%edx
+  80121e:	83 e2 0f             	and    $0xf,%edx
+  801221:	83 fa 02             	cmp    $0x2,%edx
+  801224:	77 e5                	ja     80120b <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  801226:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801229:	83 f8 02             	cmp    $0x2,%eax
+  80122c:	0f 97 c1             	seta   %cl
+  80122f:	0f b6 c9             	movzbl %cl,%ecx
+  801232:	eb d7                	jmp    80120b <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  801234:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801239:	b8 03 00 00 00       	mov    $0x3,%eax
+  80123e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801241:	89 cb                	mov    %ecx,%ebx
+  801243:	89 cf                	mov    %ecx,%edi
+  801245:	89 ce                	mov    %ecx,%esi
+  801247:	cd 30                	int    $0x30
+  801249:	eb 91                	jmp    8011dc <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80124b:	83 ec 0c             	sub    $0xc,%esp
+  80124e:	50                   	push   %eax
+  80124f:	6a 03                	push   $0x3
+  801251:	68 f9 35 80 00       	push   $0x8035f9
+  801256:	6a 4a                	push   $0x4a
+  801258:	68 16 36 80 00       	push   $0x803616
+  80125d:	e8 68 f1 ff ff       	call   8003ca <_panic>
+
+00801262 <sys_getenvid>:
+{
+  801262:	55                   	push   %ebp
+  801263:	89 e5                	mov    %esp,%ebp
+  801265:	57                   	push   %edi
+  801266:	56                   	push   %esi
+  801267:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801268:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80126f:	78 2e                	js     80129f <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  801271:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801278:	74 71                	je     8012eb <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  80127a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80127f:	b8 02 00 00 00       	mov    $0x2,%eax
+  801284:	89 d1                	mov    %edx,%ecx
+  801286:	89 d3                	mov    %edx,%ebx
+  801288:	89 d7                	mov    %edx,%edi
+  80128a:	89 d6                	mov    %edx,%esi
+  80128c:	55                   	push   %ebp
+  80128d:	68 96 12 80 00       	push   $0x801296
+  801292:	89 e5                	mov    %esp,%ebp
+  801294:	0f 34                	sysenter
+  801296:	83 c4 04             	add    $0x4,%esp
+  801299:	5d                   	pop    %ebp
+}
+  80129a:	5b                   	pop    %ebx
+  80129b:	5e                   	pop    %esi
+  80129c:	5f                   	pop    %edi
+  80129d:	5d                   	pop    %ebp
+  80129e:	c3                   	ret
+  80129f:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012a4:	0f a2                	cpuid
+		return 0;
+  8012a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8012ab:	f6 c6 08             	test   $0x8,%dh
+  8012ae:	74 15                	je     8012c5 <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012b0:	89 c2                	mov    %eax,%edx
+  8012b2:	c1 ea 08             	shr    $0x8,%edx
+  8012b5:	83 e2 0f             	and    $0xf,%edx
+  8012b8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012bd:	83 fa 06             	cmp    $0x6,%edx
+  8012c0:	74 0e                	je     8012d0 <sys_getenvid+0x6e>
+  8012c2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8012c5:	0f b6 c9             	movzbl %cl,%ecx
+  8012c8:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8012ce:	eb a1                	jmp    801271 <sys_getenvid+0xf>
+  8012d0:	89 c2                	mov    %eax,%edx
+  8012d2:	c1 ea 04             	shr    $0x4,%edx
+  8012d5:	83 e2 0f             	and    $0xf,%edx
+  8012d8:	83 fa 02             	cmp    $0x2,%edx
+  8012db:	77 e5                	ja     8012c2 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  8012dd:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012e0:	83 f8 02             	cmp    $0x2,%eax
+  8012e3:	0f 97 c1             	seta   %cl
+  8012e6:	0f b6 c9             	movzbl %cl,%ecx
+  8012e9:	eb d7                	jmp    8012c2 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  8012eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012f0:	b8 02 00 00 00       	mov    $0x2,%eax
+  8012f5:	89 d1                	mov    %edx,%ecx
+  8012f7:	89 d3                	mov    %edx,%ebx
+  8012f9:	89 d7                	mov    %edx,%edi
+  8012fb:	89 d6                	mov    %edx,%esi
+  8012fd:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  8012ff:	eb 99                	jmp    80129a <sys_getenvid+0x38>
+
+00801301 <sys_page_alloc>:
+{
+  801301:	55                   	push   %ebp
+  801302:	89 e5                	mov    %esp,%ebp
+  801304:	57                   	push   %edi
+  801305:	56                   	push   %esi
+  801306:	53                   	push   %ebx
+  801307:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80130a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801311:	78 38                	js     80134b <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  801313:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80131a:	74 7b                	je     801397 <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  80131c:	be 00 00 00 00       	mov    $0x0,%esi
+  801321:	8b 55 08             	mov    0x8(%ebp),%edx
+  801324:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801327:	b8 04 00 00 00       	mov    $0x4,%eax
+  80132c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80132f:	89 f7                	mov    %esi,%edi
+  801331:	55                   	push   %ebp
+  801332:	68 3b 13 80 00       	push   $0x80133b
+  801337:	89 e5                	mov    %esp,%ebp
+  801339:	0f 34                	sysenter
+  80133b:	83 c4 04             	add    $0x4,%esp
+  80133e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80133f:	85 c0                	test   %eax,%eax
+  801341:	7f 6d                	jg     8013b0 <sys_page_alloc+0xaf>
+}
+  801343:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801346:	5b                   	pop    %ebx
+  801347:	5e                   	pop    %esi
+  801348:	5f                   	pop    %edi
+  801349:	5d                   	pop    %ebp
+  80134a:	c3                   	ret
+  80134b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801350:	0f a2                	cpuid
+		return 0;
+  801352:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801357:	f6 c6 08             	test   $0x8,%dh
+  80135a:	74 15                	je     801371 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80135c:	89 c2                	mov    %eax,%edx
+  80135e:	c1 ea 08             	shr    $0x8,%edx
+  801361:	83 e2 0f             	and    $0xf,%edx
+  801364:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801369:	83 fa 06             	cmp    $0x6,%edx
+  80136c:	74 0e                	je     80137c <sys_page_alloc+0x7b>
+  80136e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801371:	0f b6 c9             	movzbl %cl,%ecx
+  801374:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80137a:	eb 97                	jmp    801313 <sys_page_alloc+0x12>
+  80137c:	89 c2                	mov    %eax,%edx
+  80137e:	c1 ea 04             	shr    $0x4,%edx
+  801381:	83 e2 0f             	and    $0xf,%edx
+  801384:	83 fa 02             	cmp    $0x2,%edx
+  801387:	77 e5                	ja     80136e <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  801389:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80138c:	83 f8 02             	cmp    $0x2,%eax
+  80138f:	0f 97 c1             	seta   %cl
+  801392:	0f b6 c9             	movzbl %cl,%ecx
+  801395:	eb d7                	jmp    80136e <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  801397:	be 00 00 00 00       	mov    $0x0,%esi
+  80139c:	b8 04 00 00 00       	mov    $0x4,%eax
+  8013a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013aa:	89 f7                	mov    %esi,%edi
+  8013ac:	cd 30                	int    $0x30
+  8013ae:	eb 8f                	jmp    80133f <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013b0:	83 ec 0c             	sub    $0xc,%esp
+  8013b3:	50                   	push   %eax
+  8013b4:	6a 04                	push   $0x4
+  8013b6:	68 f9 35 80 00       	push   $0x8035f9
+  8013bb:	6a 4a                	push   $0x4a
+  8013bd:	68 16 36 80 00       	push   $0x803616
+  8013c2:	e8 03 f0 ff ff       	call   8003ca <_panic>
+
+008013c7 <sys_page_map>:
+{
+  8013c7:	55                   	push   %ebp
+  8013c8:	89 e5                	mov    %esp,%ebp
+  8013ca:	57                   	push   %edi
+  8013cb:	56                   	push   %esi
+  8013cc:	53                   	push   %ebx
+  8013cd:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8013d0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8013d7:	78 37                	js     801410 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  8013d9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8013e0:	74 7a                	je     80145c <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  8013e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e8:	b8 05 00 00 00       	mov    $0x5,%eax
+  8013ed:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013f0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013f3:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013f6:	55                   	push   %ebp
+  8013f7:	68 00 14 80 00       	push   $0x801400
+  8013fc:	89 e5                	mov    %esp,%ebp
+  8013fe:	0f 34                	sysenter
+  801400:	83 c4 04             	add    $0x4,%esp
+  801403:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801404:	85 c0                	test   %eax,%eax
+  801406:	7f 6c                	jg     801474 <sys_page_map+0xad>
+}
+  801408:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80140b:	5b                   	pop    %ebx
+  80140c:	5e                   	pop    %esi
+  80140d:	5f                   	pop    %edi
+  80140e:	5d                   	pop    %ebp
+  80140f:	c3                   	ret
+  801410:	b8 01 00 00 00       	mov    $0x1,%eax
+  801415:	0f a2                	cpuid
+		return 0;
+  801417:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80141c:	f6 c6 08             	test   $0x8,%dh
+  80141f:	74 15                	je     801436 <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801421:	89 c2                	mov    %eax,%edx
+  801423:	c1 ea 08             	shr    $0x8,%edx
+  801426:	83 e2 0f             	and    $0xf,%edx
+  801429:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80142e:	83 fa 06             	cmp    $0x6,%edx
+  801431:	74 0e                	je     801441 <sys_page_map+0x7a>
+  801433:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801436:	0f b6 c9             	movzbl %cl,%ecx
+  801439:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80143f:	eb 98                	jmp    8013d9 <sys_page_map+0x12>
+  801441:	89 c2                	mov    %eax,%edx
+  801443:	c1 ea 04             	shr    $0x4,%edx
+  801446:	83 e2 0f             	and    $0xf,%edx
+  801449:	83 fa 02             	cmp    $0x2,%edx
+  80144c:	77 e5                	ja     801433 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  80144e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801451:	83 f8 02             	cmp    $0x2,%eax
+  801454:	0f 97 c1             	seta   %cl
+  801457:	0f b6 c9             	movzbl %cl,%ecx
+  80145a:	eb d7                	jmp    801433 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  80145c:	b8 05 00 00 00       	mov    $0x5,%eax
+  801461:	8b 55 08             	mov    0x8(%ebp),%edx
+  801464:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801467:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80146a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80146d:	8b 75 18             	mov    0x18(%ebp),%esi
+  801470:	cd 30                	int    $0x30
+  801472:	eb 90                	jmp    801404 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801474:	83 ec 0c             	sub    $0xc,%esp
+  801477:	50                   	push   %eax
+  801478:	6a 05                	push   $0x5
+  80147a:	68 f9 35 80 00       	push   $0x8035f9
+  80147f:	6a 4a                	push   $0x4a
+  801481:	68 16 36 80 00       	push   $0x803616
+  801486:	e8 3f ef ff ff       	call   8003ca <_panic>
+
+0080148b <sys_page_unmap>:
+{
+  80148b:	55                   	push   %ebp
+  80148c:	89 e5                	mov    %esp,%ebp
+  80148e:	57                   	push   %edi
+  80148f:	56                   	push   %esi
+  801490:	53                   	push   %ebx
+  801491:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801494:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80149b:	78 37                	js     8014d4 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  80149d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8014a4:	74 7a                	je     801520 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  8014a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b1:	b8 06 00 00 00       	mov    $0x6,%eax
+  8014b6:	89 df                	mov    %ebx,%edi
+  8014b8:	89 de                	mov    %ebx,%esi
+  8014ba:	55                   	push   %ebp
+  8014bb:	68 c4 14 80 00       	push   $0x8014c4
+  8014c0:	89 e5                	mov    %esp,%ebp
+  8014c2:	0f 34                	sysenter
+  8014c4:	83 c4 04             	add    $0x4,%esp
+  8014c7:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8014c8:	85 c0                	test   %eax,%eax
+  8014ca:	7f 6c                	jg     801538 <sys_page_unmap+0xad>
+}
+  8014cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014cf:	5b                   	pop    %ebx
+  8014d0:	5e                   	pop    %esi
+  8014d1:	5f                   	pop    %edi
+  8014d2:	5d                   	pop    %ebp
+  8014d3:	c3                   	ret
+  8014d4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014d9:	0f a2                	cpuid
+		return 0;
+  8014db:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8014e0:	f6 c6 08             	test   $0x8,%dh
+  8014e3:	74 15                	je     8014fa <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014e5:	89 c2                	mov    %eax,%edx
+  8014e7:	c1 ea 08             	shr    $0x8,%edx
+  8014ea:	83 e2 0f             	and    $0xf,%edx
+  8014ed:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8014f2:	83 fa 06             	cmp    $0x6,%edx
+  8014f5:	74 0e                	je     801505 <sys_page_unmap+0x7a>
+  8014f7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8014fa:	0f b6 c9             	movzbl %cl,%ecx
+  8014fd:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801503:	eb 98                	jmp    80149d <sys_page_unmap+0x12>
+  801505:	89 c2                	mov    %eax,%edx
+  801507:	c1 ea 04             	shr    $0x4,%edx
+  80150a:	83 e2 0f             	and    $0xf,%edx
+  80150d:	83 fa 02             	cmp    $0x2,%edx
+  801510:	77 e5                	ja     8014f7 <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  801512:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801515:	83 f8 02             	cmp    $0x2,%eax
+  801518:	0f 97 c1             	seta   %cl
+  80151b:	0f b6 c9             	movzbl %cl,%ecx
+  80151e:	eb d7                	jmp    8014f7 <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  801520:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801525:	b8 06 00 00 00       	mov    $0x6,%eax
+  80152a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80152d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801530:	89 df                	mov    %ebx,%edi
+  801532:	89 de                	mov    %ebx,%esi
+  801534:	cd 30                	int    $0x30
+  801536:	eb 90                	jmp    8014c8 <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801538:	83 ec 0c             	sub    $0xc,%esp
+  80153b:	50                   	push   %eax
+  80153c:	6a 06                	push   $0x6
+  80153e:	68 f9 35 80 00       	push   $0x8035f9
+  801543:	6a 4a                	push   $0x4a
+  801545:	68 16 36 80 00       	push   $0x803616
+  80154a:	e8 7b ee ff ff       	call   8003ca <_panic>
+
+0080154f <sys_page_copy>:
+{
+  80154f:	55                   	push   %ebp
+  801550:	89 e5                	mov    %esp,%ebp
+  801552:	57                   	push   %edi
+  801553:	56                   	push   %esi
+  801554:	53                   	push   %ebx
+  801555:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801558:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80155f:	78 37                	js     801598 <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  801561:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801568:	74 7a                	je     8015e4 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  80156a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80156d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801570:	b8 29 00 00 00       	mov    $0x29,%eax
+  801575:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801578:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80157b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80157e:	55                   	push   %ebp
+  80157f:	68 88 15 80 00       	push   $0x801588
+  801584:	89 e5                	mov    %esp,%ebp
+  801586:	0f 34                	sysenter
+  801588:	83 c4 04             	add    $0x4,%esp
+  80158b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80158c:	85 c0                	test   %eax,%eax
+  80158e:	7f 6c                	jg     8015fc <sys_page_copy+0xad>
+}
+  801590:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801593:	5b                   	pop    %ebx
+  801594:	5e                   	pop    %esi
+  801595:	5f                   	pop    %edi
+  801596:	5d                   	pop    %ebp
+  801597:	c3                   	ret
+  801598:	b8 01 00 00 00       	mov    $0x1,%eax
+  80159d:	0f a2                	cpuid
+		return 0;
+  80159f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8015a4:	f6 c6 08             	test   $0x8,%dh
+  8015a7:	74 15                	je     8015be <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015a9:	89 c2                	mov    %eax,%edx
+  8015ab:	c1 ea 08             	shr    $0x8,%edx
+  8015ae:	83 e2 0f             	and    $0xf,%edx
+  8015b1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8015b6:	83 fa 06             	cmp    $0x6,%edx
+  8015b9:	74 0e                	je     8015c9 <sys_page_copy+0x7a>
+  8015bb:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8015be:	0f b6 c9             	movzbl %cl,%ecx
+  8015c1:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8015c7:	eb 98                	jmp    801561 <sys_page_copy+0x12>
+  8015c9:	89 c2                	mov    %eax,%edx
+  8015cb:	c1 ea 04             	shr    $0x4,%edx
+  8015ce:	83 e2 0f             	and    $0xf,%edx
+  8015d1:	83 fa 02             	cmp    $0x2,%edx
+  8015d4:	77 e5                	ja     8015bb <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  8015d6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015d9:	83 f8 02             	cmp    $0x2,%eax
+  8015dc:	0f 97 c1             	seta   %cl
+  8015df:	0f b6 c9             	movzbl %cl,%ecx
+  8015e2:	eb d7                	jmp    8015bb <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  8015e4:	b8 29 00 00 00       	mov    $0x29,%eax
+  8015e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015ef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015f2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8015f5:	8b 75 18             	mov    0x18(%ebp),%esi
+  8015f8:	cd 30                	int    $0x30
+  8015fa:	eb 90                	jmp    80158c <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015fc:	83 ec 0c             	sub    $0xc,%esp
+  8015ff:	50                   	push   %eax
+  801600:	6a 29                	push   $0x29
+  801602:	68 f9 35 80 00       	push   $0x8035f9
+  801607:	6a 4a                	push   $0x4a
+  801609:	68 16 36 80 00       	push   $0x803616
+  80160e:	e8 b7 ed ff ff       	call   8003ca <_panic>
+
+00801613 <sys_yield>:
+{
+  801613:	55                   	push   %ebp
+  801614:	89 e5                	mov    %esp,%ebp
+  801616:	57                   	push   %edi
+  801617:	56                   	push   %esi
+  801618:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801619:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801620:	78 2e                	js     801650 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  801622:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801629:	74 71                	je     80169c <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  80162b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801630:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801635:	89 d1                	mov    %edx,%ecx
+  801637:	89 d3                	mov    %edx,%ebx
+  801639:	89 d7                	mov    %edx,%edi
+  80163b:	89 d6                	mov    %edx,%esi
+  80163d:	55                   	push   %ebp
+  80163e:	68 47 16 80 00       	push   $0x801647
+  801643:	89 e5                	mov    %esp,%ebp
+  801645:	0f 34                	sysenter
+  801647:	83 c4 04             	add    $0x4,%esp
+  80164a:	5d                   	pop    %ebp
+}
+  80164b:	5b                   	pop    %ebx
+  80164c:	5e                   	pop    %esi
+  80164d:	5f                   	pop    %edi
+  80164e:	5d                   	pop    %ebp
+  80164f:	c3                   	ret
+  801650:	b8 01 00 00 00       	mov    $0x1,%eax
+  801655:	0f a2                	cpuid
+		return 0;
+  801657:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80165c:	f6 c6 08             	test   $0x8,%dh
+  80165f:	74 15                	je     801676 <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801661:	89 c2                	mov    %eax,%edx
+  801663:	c1 ea 08             	shr    $0x8,%edx
+  801666:	83 e2 0f             	and    $0xf,%edx
+  801669:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80166e:	83 fa 06             	cmp    $0x6,%edx
+  801671:	74 0e                	je     801681 <sys_yield+0x6e>
+  801673:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801676:	0f b6 c9             	movzbl %cl,%ecx
+  801679:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80167f:	eb a1                	jmp    801622 <sys_yield+0xf>
+  801681:	89 c2                	mov    %eax,%edx
+  801683:	c1 ea 04             	shr    $0x4,%edx
+  801686:	83 e2 0f             	and    $0xf,%edx
+  801689:	83 fa 02             	cmp    $0x2,%edx
+  80168c:	77 e5                	ja     801673 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  80168e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801691:	83 f8 02             	cmp    $0x2,%eax
+  801694:	0f 97 c1             	seta   %cl
+  801697:	0f b6 c9             	movzbl %cl,%ecx
+  80169a:	eb d7                	jmp    801673 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  80169c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016a1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8016a6:	89 d1                	mov    %edx,%ecx
+  8016a8:	89 d3                	mov    %edx,%ebx
+  8016aa:	89 d7                	mov    %edx,%edi
+  8016ac:	89 d6                	mov    %edx,%esi
+  8016ae:	cd 30                	int    $0x30
+}
+  8016b0:	eb 99                	jmp    80164b <sys_yield+0x38>
+
+008016b2 <sys_env_set_status>:
+{
+  8016b2:	55                   	push   %ebp
+  8016b3:	89 e5                	mov    %esp,%ebp
+  8016b5:	57                   	push   %edi
+  8016b6:	56                   	push   %esi
+  8016b7:	53                   	push   %ebx
+  8016b8:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8016bb:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8016c2:	78 37                	js     8016fb <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  8016c4:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8016cb:	74 7a                	je     801747 <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  8016cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016d8:	b8 08 00 00 00       	mov    $0x8,%eax
+  8016dd:	89 df                	mov    %ebx,%edi
+  8016df:	89 de                	mov    %ebx,%esi
+  8016e1:	55                   	push   %ebp
+  8016e2:	68 eb 16 80 00       	push   $0x8016eb
+  8016e7:	89 e5                	mov    %esp,%ebp
+  8016e9:	0f 34                	sysenter
+  8016eb:	83 c4 04             	add    $0x4,%esp
+  8016ee:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8016ef:	85 c0                	test   %eax,%eax
+  8016f1:	7f 6c                	jg     80175f <sys_env_set_status+0xad>
+}
+  8016f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016f6:	5b                   	pop    %ebx
+  8016f7:	5e                   	pop    %esi
+  8016f8:	5f                   	pop    %edi
+  8016f9:	5d                   	pop    %ebp
+  8016fa:	c3                   	ret
+  8016fb:	b8 01 00 00 00       	mov    $0x1,%eax
+  801700:	0f a2                	cpuid
+		return 0;
+  801702:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801707:	f6 c6 08             	test   $0x8,%dh
+  80170a:	74 15                	je     801721 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80170c:	89 c2                	mov    %eax,%edx
+  80170e:	c1 ea 08             	shr    $0x8,%edx
+  801711:	83 e2 0f             	and    $0xf,%edx
+  801714:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801719:	83 fa 06             	cmp    $0x6,%edx
+  80171c:	74 0e                	je     80172c <sys_env_set_status+0x7a>
+  80171e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801721:	0f b6 c9             	movzbl %cl,%ecx
+  801724:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80172a:	eb 98                	jmp    8016c4 <sys_env_set_status+0x12>
+  80172c:	89 c2                	mov    %eax,%edx
+  80172e:	c1 ea 04             	shr    $0x4,%edx
+  801731:	83 e2 0f             	and    $0xf,%edx
+  801734:	83 fa 02             	cmp    $0x2,%edx
+  801737:	77 e5                	ja     80171e <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  801739:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80173c:	83 f8 02             	cmp    $0x2,%eax
+  80173f:	0f 97 c1             	seta   %cl
+  801742:	0f b6 c9             	movzbl %cl,%ecx
+  801745:	eb d7                	jmp    80171e <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  801747:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80174c:	b8 08 00 00 00       	mov    $0x8,%eax
+  801751:	8b 55 08             	mov    0x8(%ebp),%edx
+  801754:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801757:	89 df                	mov    %ebx,%edi
+  801759:	89 de                	mov    %ebx,%esi
+  80175b:	cd 30                	int    $0x30
+  80175d:	eb 90                	jmp    8016ef <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80175f:	83 ec 0c             	sub    $0xc,%esp
+  801762:	50                   	push   %eax
+  801763:	6a 08                	push   $0x8
+  801765:	68 f9 35 80 00       	push   $0x8035f9
+  80176a:	6a 4a                	push   $0x4a
+  80176c:	68 16 36 80 00       	push   $0x803616
+  801771:	e8 54 ec ff ff       	call   8003ca <_panic>
+
+00801776 <sys_sysinfo>:
+{
+  801776:	55                   	push   %ebp
+  801777:	89 e5                	mov    %esp,%ebp
+  801779:	57                   	push   %edi
+  80177a:	56                   	push   %esi
+  80177b:	53                   	push   %ebx
+  80177c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80177f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801786:	78 36                	js     8017be <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  801788:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80178f:	74 79                	je     80180a <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  801791:	8b 55 08             	mov    0x8(%ebp),%edx
+  801794:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801799:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80179e:	89 cb                	mov    %ecx,%ebx
+  8017a0:	89 cf                	mov    %ecx,%edi
+  8017a2:	89 ce                	mov    %ecx,%esi
+  8017a4:	55                   	push   %ebp
+  8017a5:	68 ae 17 80 00       	push   $0x8017ae
+  8017aa:	89 e5                	mov    %esp,%ebp
+  8017ac:	0f 34                	sysenter
+  8017ae:	83 c4 04             	add    $0x4,%esp
+  8017b1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8017b2:	85 c0                	test   %eax,%eax
+  8017b4:	7f 6b                	jg     801821 <sys_sysinfo+0xab>
+}
+  8017b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017b9:	5b                   	pop    %ebx
+  8017ba:	5e                   	pop    %esi
+  8017bb:	5f                   	pop    %edi
+  8017bc:	5d                   	pop    %ebp
+  8017bd:	c3                   	ret
+  8017be:	b8 01 00 00 00       	mov    $0x1,%eax
+  8017c3:	0f a2                	cpuid
+		return 0;
+  8017c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8017ca:	f6 c6 08             	test   $0x8,%dh
+  8017cd:	74 15                	je     8017e4 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017cf:	89 c2                	mov    %eax,%edx
+  8017d1:	c1 ea 08             	shr    $0x8,%edx
+  8017d4:	83 e2 0f             	and    $0xf,%edx
+  8017d7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017dc:	83 fa 06             	cmp    $0x6,%edx
+  8017df:	74 0e                	je     8017ef <sys_sysinfo+0x79>
+  8017e1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8017e4:	0f b6 c9             	movzbl %cl,%ecx
+  8017e7:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8017ed:	eb 99                	jmp    801788 <sys_sysinfo+0x12>
+  8017ef:	89 c2                	mov    %eax,%edx
+  8017f1:	c1 ea 04             	shr    $0x4,%edx
+  8017f4:	83 e2 0f             	and    $0xf,%edx
+  8017f7:	83 fa 02             	cmp    $0x2,%edx
+  8017fa:	77 e5                	ja     8017e1 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  8017fc:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017ff:	83 f8 02             	cmp    $0x2,%eax
+  801802:	0f 97 c1             	seta   %cl
+  801805:	0f b6 c9             	movzbl %cl,%ecx
+  801808:	eb d7                	jmp    8017e1 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  80180a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80180f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801814:	8b 55 08             	mov    0x8(%ebp),%edx
+  801817:	89 cb                	mov    %ecx,%ebx
+  801819:	89 cf                	mov    %ecx,%edi
+  80181b:	89 ce                	mov    %ecx,%esi
+  80181d:	cd 30                	int    $0x30
+  80181f:	eb 91                	jmp    8017b2 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801821:	83 ec 0c             	sub    $0xc,%esp
+  801824:	50                   	push   %eax
+  801825:	6a 0b                	push   $0xb
+  801827:	68 f9 35 80 00       	push   $0x8035f9
+  80182c:	6a 4a                	push   $0x4a
+  80182e:	68 16 36 80 00       	push   $0x803616
+  801833:	e8 92 eb ff ff       	call   8003ca <_panic>
+
+00801838 <sys_env_set_trapframe>:
+{
+  801838:	55                   	push   %ebp
+  801839:	89 e5                	mov    %esp,%ebp
+  80183b:	57                   	push   %edi
+  80183c:	56                   	push   %esi
+  80183d:	53                   	push   %ebx
+  80183e:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801841:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801848:	78 37                	js     801881 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  80184a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801851:	74 7a                	je     8018cd <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  801853:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801858:	8b 55 08             	mov    0x8(%ebp),%edx
+  80185b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80185e:	b8 13 00 00 00       	mov    $0x13,%eax
+  801863:	89 df                	mov    %ebx,%edi
+  801865:	89 de                	mov    %ebx,%esi
+  801867:	55                   	push   %ebp
+  801868:	68 71 18 80 00       	push   $0x801871
+  80186d:	89 e5                	mov    %esp,%ebp
+  80186f:	0f 34                	sysenter
+  801871:	83 c4 04             	add    $0x4,%esp
+  801874:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801875:	85 c0                	test   %eax,%eax
+  801877:	7f 6c                	jg     8018e5 <sys_env_set_trapframe+0xad>
+}
+  801879:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80187c:	5b                   	pop    %ebx
+  80187d:	5e                   	pop    %esi
+  80187e:	5f                   	pop    %edi
+  80187f:	5d                   	pop    %ebp
+  801880:	c3                   	ret
+  801881:	b8 01 00 00 00       	mov    $0x1,%eax
+  801886:	0f a2                	cpuid
+		return 0;
+  801888:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80188d:	f6 c6 08             	test   $0x8,%dh
+  801890:	74 15                	je     8018a7 <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801892:	89 c2                	mov    %eax,%edx
+  801894:	c1 ea 08             	shr    $0x8,%edx
+  801897:	83 e2 0f             	and    $0xf,%edx
+  80189a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80189f:	83 fa 06             	cmp    $0x6,%edx
+  8018a2:	74 0e                	je     8018b2 <sys_env_set_trapframe+0x7a>
+  8018a4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8018a7:	0f b6 c9             	movzbl %cl,%ecx
+  8018aa:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8018b0:	eb 98                	jmp    80184a <sys_env_set_trapframe+0x12>
+  8018b2:	89 c2                	mov    %eax,%edx
+  8018b4:	c1 ea 04             	shr    $0x4,%edx
+  8018b7:	83 e2 0f             	and    $0xf,%edx
+  8018ba:	83 fa 02             	cmp    $0x2,%edx
+  8018bd:	77 e5                	ja     8018a4 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  8018bf:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018c2:	83 f8 02             	cmp    $0x2,%eax
+  8018c5:	0f 97 c1             	seta   %cl
+  8018c8:	0f b6 c9             	movzbl %cl,%ecx
+  8018cb:	eb d7                	jmp    8018a4 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  8018cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018d2:	b8 13 00 00 00       	mov    $0x13,%eax
+  8018d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018dd:	89 df                	mov    %ebx,%edi
+  8018df:	89 de                	mov    %ebx,%esi
+  8018e1:	cd 30                	int    $0x30
+  8018e3:	eb 90                	jmp    801875 <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8018e5:	83 ec 0c             	sub    $0xc,%esp
+  8018e8:	50                   	push   %eax
+  8018e9:	6a 13                	push   $0x13
+  8018eb:	68 f9 35 80 00       	push   $0x8035f9
+  8018f0:	6a 4a                	push   $0x4a
+  8018f2:	68 16 36 80 00       	push   $0x803616
+  8018f7:	e8 ce ea ff ff       	call   8003ca <_panic>
+
+008018fc <sys_env_set_stack_limit>:
+{
+  8018fc:	55                   	push   %ebp
+  8018fd:	89 e5                	mov    %esp,%ebp
+  8018ff:	57                   	push   %edi
+  801900:	56                   	push   %esi
+  801901:	53                   	push   %ebx
+  801902:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801905:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80190c:	78 37                	js     801945 <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  80190e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801915:	74 7a                	je     801991 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  801917:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80191c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80191f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801922:	b8 19 00 00 00       	mov    $0x19,%eax
+  801927:	89 df                	mov    %ebx,%edi
+  801929:	89 de                	mov    %ebx,%esi
+  80192b:	55                   	push   %ebp
+  80192c:	68 35 19 80 00       	push   $0x801935
+  801931:	89 e5                	mov    %esp,%ebp
+  801933:	0f 34                	sysenter
+  801935:	83 c4 04             	add    $0x4,%esp
+  801938:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801939:	85 c0                	test   %eax,%eax
+  80193b:	7f 6c                	jg     8019a9 <sys_env_set_stack_limit+0xad>
+}
+  80193d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801940:	5b                   	pop    %ebx
+  801941:	5e                   	pop    %esi
+  801942:	5f                   	pop    %edi
+  801943:	5d                   	pop    %ebp
+  801944:	c3                   	ret
+  801945:	b8 01 00 00 00       	mov    $0x1,%eax
+  80194a:	0f a2                	cpuid
+		return 0;
+  80194c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801951:	f6 c6 08             	test   $0x8,%dh
+  801954:	74 15                	je     80196b <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801956:	89 c2                	mov    %eax,%edx
+  801958:	c1 ea 08             	shr    $0x8,%edx
+  80195b:	83 e2 0f             	and    $0xf,%edx
+  80195e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801963:	83 fa 06             	cmp    $0x6,%edx
+  801966:	74 0e                	je     801976 <sys_env_set_stack_limit+0x7a>
+  801968:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80196b:	0f b6 c9             	movzbl %cl,%ecx
+  80196e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801974:	eb 98                	jmp    80190e <sys_env_set_stack_limit+0x12>
+  801976:	89 c2                	mov    %eax,%edx
+  801978:	c1 ea 04             	shr    $0x4,%edx
+  80197b:	83 e2 0f             	and    $0xf,%edx
+  80197e:	83 fa 02             	cmp    $0x2,%edx
+  801981:	77 e5                	ja     801968 <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  801983:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801986:	83 f8 02             	cmp    $0x2,%eax
+  801989:	0f 97 c1             	seta   %cl
+  80198c:	0f b6 c9             	movzbl %cl,%ecx
+  80198f:	eb d7                	jmp    801968 <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  801991:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801996:	b8 19 00 00 00       	mov    $0x19,%eax
+  80199b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80199e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019a1:	89 df                	mov    %ebx,%edi
+  8019a3:	89 de                	mov    %ebx,%esi
+  8019a5:	cd 30                	int    $0x30
+  8019a7:	eb 90                	jmp    801939 <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8019a9:	83 ec 0c             	sub    $0xc,%esp
+  8019ac:	50                   	push   %eax
+  8019ad:	6a 19                	push   $0x19
+  8019af:	68 f9 35 80 00       	push   $0x8035f9
+  8019b4:	6a 4a                	push   $0x4a
+  8019b6:	68 16 36 80 00       	push   $0x803616
+  8019bb:	e8 0a ea ff ff       	call   8003ca <_panic>
+
+008019c0 <sys_env_set_pgfault_upcall>:
+{
+  8019c0:	55                   	push   %ebp
+  8019c1:	89 e5                	mov    %esp,%ebp
+  8019c3:	57                   	push   %edi
+  8019c4:	56                   	push   %esi
+  8019c5:	53                   	push   %ebx
+  8019c6:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8019c9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8019d0:	78 37                	js     801a09 <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  8019d2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8019d9:	74 7a                	je     801a55 <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  8019db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019e6:	b8 09 00 00 00       	mov    $0x9,%eax
+  8019eb:	89 df                	mov    %ebx,%edi
+  8019ed:	89 de                	mov    %ebx,%esi
+  8019ef:	55                   	push   %ebp
+  8019f0:	68 f9 19 80 00       	push   $0x8019f9
+  8019f5:	89 e5                	mov    %esp,%ebp
+  8019f7:	0f 34                	sysenter
+  8019f9:	83 c4 04             	add    $0x4,%esp
+  8019fc:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8019fd:	85 c0                	test   %eax,%eax
+  8019ff:	7f 6c                	jg     801a6d <sys_env_set_pgfault_upcall+0xad>
+}
+  801a01:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a04:	5b                   	pop    %ebx
+  801a05:	5e                   	pop    %esi
+  801a06:	5f                   	pop    %edi
+  801a07:	5d                   	pop    %ebp
+  801a08:	c3                   	ret
+  801a09:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a0e:	0f a2                	cpuid
+		return 0;
+  801a10:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801a15:	f6 c6 08             	test   $0x8,%dh
+  801a18:	74 15                	je     801a2f <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a1a:	89 c2                	mov    %eax,%edx
+  801a1c:	c1 ea 08             	shr    $0x8,%edx
+  801a1f:	83 e2 0f             	and    $0xf,%edx
+  801a22:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a27:	83 fa 06             	cmp    $0x6,%edx
+  801a2a:	74 0e                	je     801a3a <sys_env_set_pgfault_upcall+0x7a>
+  801a2c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a2f:	0f b6 c9             	movzbl %cl,%ecx
+  801a32:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801a38:	eb 98                	jmp    8019d2 <sys_env_set_pgfault_upcall+0x12>
+  801a3a:	89 c2                	mov    %eax,%edx
+  801a3c:	c1 ea 04             	shr    $0x4,%edx
+  801a3f:	83 e2 0f             	and    $0xf,%edx
+  801a42:	83 fa 02             	cmp    $0x2,%edx
+  801a45:	77 e5                	ja     801a2c <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  801a47:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a4a:	83 f8 02             	cmp    $0x2,%eax
+  801a4d:	0f 97 c1             	seta   %cl
+  801a50:	0f b6 c9             	movzbl %cl,%ecx
+  801a53:	eb d7                	jmp    801a2c <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  801a55:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a5a:	b8 09 00 00 00       	mov    $0x9,%eax
+  801a5f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a62:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a65:	89 df                	mov    %ebx,%edi
+  801a67:	89 de                	mov    %ebx,%esi
+  801a69:	cd 30                	int    $0x30
+  801a6b:	eb 90                	jmp    8019fd <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a6d:	83 ec 0c             	sub    $0xc,%esp
+  801a70:	50                   	push   %eax
+  801a71:	6a 09                	push   $0x9
+  801a73:	68 f9 35 80 00       	push   $0x8035f9
+  801a78:	6a 4a                	push   $0x4a
+  801a7a:	68 16 36 80 00       	push   $0x803616
+  801a7f:	e8 46 e9 ff ff       	call   8003ca <_panic>
+
+00801a84 <sys_ipc_try_send>:
+{
+  801a84:	55                   	push   %ebp
+  801a85:	89 e5                	mov    %esp,%ebp
+  801a87:	57                   	push   %edi
+  801a88:	56                   	push   %esi
+  801a89:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801a8a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a91:	78 32                	js     801ac5 <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  801a93:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a9a:	74 75                	je     801b11 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801a9c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a9f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801aa2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801aa7:	be 00 00 00 00       	mov    $0x0,%esi
+  801aac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801aaf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ab2:	55                   	push   %ebp
+  801ab3:	68 bc 1a 80 00       	push   $0x801abc
+  801ab8:	89 e5                	mov    %esp,%ebp
+  801aba:	0f 34                	sysenter
+  801abc:	83 c4 04             	add    $0x4,%esp
+  801abf:	5d                   	pop    %ebp
+}
+  801ac0:	5b                   	pop    %ebx
+  801ac1:	5e                   	pop    %esi
+  801ac2:	5f                   	pop    %edi
+  801ac3:	5d                   	pop    %ebp
+  801ac4:	c3                   	ret
+  801ac5:	b8 01 00 00 00       	mov    $0x1,%eax
+  801aca:	0f a2                	cpuid
+		return 0;
+  801acc:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801ad1:	f6 c6 08             	test   $0x8,%dh
+  801ad4:	74 15                	je     801aeb <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ad6:	89 c2                	mov    %eax,%edx
+  801ad8:	c1 ea 08             	shr    $0x8,%edx
+  801adb:	83 e2 0f             	and    $0xf,%edx
+  801ade:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ae3:	83 fa 06             	cmp    $0x6,%edx
+  801ae6:	74 0e                	je     801af6 <sys_ipc_try_send+0x72>
+  801ae8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801aeb:	0f b6 c9             	movzbl %cl,%ecx
+  801aee:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801af4:	eb 9d                	jmp    801a93 <sys_ipc_try_send+0xf>
+  801af6:	89 c2                	mov    %eax,%edx
+  801af8:	c1 ea 04             	shr    $0x4,%edx
+  801afb:	83 e2 0f             	and    $0xf,%edx
+  801afe:	83 fa 02             	cmp    $0x2,%edx
+  801b01:	77 e5                	ja     801ae8 <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  801b03:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b06:	83 f8 02             	cmp    $0x2,%eax
+  801b09:	0f 97 c1             	seta   %cl
+  801b0c:	0f b6 c9             	movzbl %cl,%ecx
+  801b0f:	eb d7                	jmp    801ae8 <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  801b11:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801b16:	be 00 00 00 00       	mov    $0x0,%esi
+  801b1b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b1e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b21:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b24:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801b27:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801b29:	eb 95                	jmp    801ac0 <sys_ipc_try_send+0x3c>
+
+00801b2b <sys_ipc_send>:
+{
+  801b2b:	55                   	push   %ebp
+  801b2c:	89 e5                	mov    %esp,%ebp
+  801b2e:	57                   	push   %edi
+  801b2f:	56                   	push   %esi
+  801b30:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801b31:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b38:	78 32                	js     801b6c <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  801b3a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b41:	74 75                	je     801bb8 <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801b43:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b46:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b49:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801b4e:	be 00 00 00 00       	mov    $0x0,%esi
+  801b53:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b56:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801b59:	55                   	push   %ebp
+  801b5a:	68 63 1b 80 00       	push   $0x801b63
+  801b5f:	89 e5                	mov    %esp,%ebp
+  801b61:	0f 34                	sysenter
+  801b63:	83 c4 04             	add    $0x4,%esp
+  801b66:	5d                   	pop    %ebp
+}
+  801b67:	5b                   	pop    %ebx
+  801b68:	5e                   	pop    %esi
+  801b69:	5f                   	pop    %edi
+  801b6a:	5d                   	pop    %ebp
+  801b6b:	c3                   	ret
+  801b6c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b71:	0f a2                	cpuid
+		return 0;
+  801b73:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b78:	f6 c6 08             	test   $0x8,%dh
+  801b7b:	74 15                	je     801b92 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b7d:	89 c2                	mov    %eax,%edx
+  801b7f:	c1 ea 08             	shr    $0x8,%edx
+  801b82:	83 e2 0f             	and    $0xf,%edx
+  801b85:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b8a:	83 fa 06             	cmp    $0x6,%edx
+  801b8d:	74 0e                	je     801b9d <sys_ipc_send+0x72>
+  801b8f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b92:	0f b6 c9             	movzbl %cl,%ecx
+  801b95:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801b9b:	eb 9d                	jmp    801b3a <sys_ipc_send+0xf>
+  801b9d:	89 c2                	mov    %eax,%edx
+  801b9f:	c1 ea 04             	shr    $0x4,%edx
+  801ba2:	83 e2 0f             	and    $0xf,%edx
+  801ba5:	83 fa 02             	cmp    $0x2,%edx
+  801ba8:	77 e5                	ja     801b8f <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  801baa:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bad:	83 f8 02             	cmp    $0x2,%eax
+  801bb0:	0f 97 c1             	seta   %cl
+  801bb3:	0f b6 c9             	movzbl %cl,%ecx
+  801bb6:	eb d7                	jmp    801b8f <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  801bb8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801bbd:	be 00 00 00 00       	mov    $0x0,%esi
+  801bc2:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bc5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bc8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801bcb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801bce:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801bd0:	eb 95                	jmp    801b67 <sys_ipc_send+0x3c>
+
+00801bd2 <sys_ipc_recv>:
+{
+  801bd2:	55                   	push   %ebp
+  801bd3:	89 e5                	mov    %esp,%ebp
+  801bd5:	57                   	push   %edi
+  801bd6:	56                   	push   %esi
+  801bd7:	53                   	push   %ebx
+  801bd8:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801bdb:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801be2:	78 36                	js     801c1a <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  801be4:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801beb:	74 79                	je     801c66 <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  801bed:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bf0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bf5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801bfa:	89 cb                	mov    %ecx,%ebx
+  801bfc:	89 cf                	mov    %ecx,%edi
+  801bfe:	89 ce                	mov    %ecx,%esi
+  801c00:	55                   	push   %ebp
+  801c01:	68 0a 1c 80 00       	push   $0x801c0a
+  801c06:	89 e5                	mov    %esp,%ebp
+  801c08:	0f 34                	sysenter
+  801c0a:	83 c4 04             	add    $0x4,%esp
+  801c0d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801c0e:	85 c0                	test   %eax,%eax
+  801c10:	7f 6b                	jg     801c7d <sys_ipc_recv+0xab>
+}
+  801c12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c15:	5b                   	pop    %ebx
+  801c16:	5e                   	pop    %esi
+  801c17:	5f                   	pop    %edi
+  801c18:	5d                   	pop    %ebp
+  801c19:	c3                   	ret
+  801c1a:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c1f:	0f a2                	cpuid
+		return 0;
+  801c21:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801c26:	f6 c6 08             	test   $0x8,%dh
+  801c29:	74 15                	je     801c40 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c2b:	89 c2                	mov    %eax,%edx
+  801c2d:	c1 ea 08             	shr    $0x8,%edx
+  801c30:	83 e2 0f             	and    $0xf,%edx
+  801c33:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801c38:	83 fa 06             	cmp    $0x6,%edx
+  801c3b:	74 0e                	je     801c4b <sys_ipc_recv+0x79>
+  801c3d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801c40:	0f b6 c9             	movzbl %cl,%ecx
+  801c43:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801c49:	eb 99                	jmp    801be4 <sys_ipc_recv+0x12>
+  801c4b:	89 c2                	mov    %eax,%edx
+  801c4d:	c1 ea 04             	shr    $0x4,%edx
+  801c50:	83 e2 0f             	and    $0xf,%edx
+  801c53:	83 fa 02             	cmp    $0x2,%edx
+  801c56:	77 e5                	ja     801c3d <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  801c58:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c5b:	83 f8 02             	cmp    $0x2,%eax
+  801c5e:	0f 97 c1             	seta   %cl
+  801c61:	0f b6 c9             	movzbl %cl,%ecx
+  801c64:	eb d7                	jmp    801c3d <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  801c66:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c6b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801c70:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c73:	89 cb                	mov    %ecx,%ebx
+  801c75:	89 cf                	mov    %ecx,%edi
+  801c77:	89 ce                	mov    %ecx,%esi
+  801c79:	cd 30                	int    $0x30
+  801c7b:	eb 91                	jmp    801c0e <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801c7d:	83 ec 0c             	sub    $0xc,%esp
+  801c80:	50                   	push   %eax
+  801c81:	6a 0d                	push   $0xd
+  801c83:	68 f9 35 80 00       	push   $0x8035f9
+  801c88:	6a 4a                	push   $0x4a
+  801c8a:	68 16 36 80 00       	push   $0x803616
+  801c8f:	e8 36 e7 ff ff       	call   8003ca <_panic>
+
+00801c94 <sys_ipc_send_range>:
+{
+  801c94:	55                   	push   %ebp
+  801c95:	89 e5                	mov    %esp,%ebp
+  801c97:	57                   	push   %edi
+  801c98:	56                   	push   %esi
+  801c99:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801c9a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ca1:	78 30                	js     801cd3 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  801ca3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801caa:	74 73                	je     801d1f <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801cac:	8b 55 08             	mov    0x8(%ebp),%edx
+  801caf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cb2:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801cb7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801cba:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801cbd:	8b 75 18             	mov    0x18(%ebp),%esi
+  801cc0:	55                   	push   %ebp
+  801cc1:	68 ca 1c 80 00       	push   $0x801cca
+  801cc6:	89 e5                	mov    %esp,%ebp
+  801cc8:	0f 34                	sysenter
+  801cca:	83 c4 04             	add    $0x4,%esp
+  801ccd:	5d                   	pop    %ebp
+}
+  801cce:	5b                   	pop    %ebx
+  801ccf:	5e                   	pop    %esi
+  801cd0:	5f                   	pop    %edi
+  801cd1:	5d                   	pop    %ebp
+  801cd2:	c3                   	ret
+  801cd3:	b8 01 00 00 00       	mov    $0x1,%eax
+  801cd8:	0f a2                	cpuid
+		return 0;
+  801cda:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801cdf:	f6 c6 08             	test   $0x8,%dh
+  801ce2:	74 15                	je     801cf9 <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ce4:	89 c2                	mov    %eax,%edx
+  801ce6:	c1 ea 08             	shr    $0x8,%edx
+  801ce9:	83 e2 0f             	and    $0xf,%edx
+  801cec:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801cf1:	83 fa 06             	cmp    $0x6,%edx
+  801cf4:	74 0e                	je     801d04 <sys_ipc_send_range+0x70>
+  801cf6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801cf9:	0f b6 c9             	movzbl %cl,%ecx
+  801cfc:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801d02:	eb 9f                	jmp    801ca3 <sys_ipc_send_range+0xf>
+  801d04:	89 c2                	mov    %eax,%edx
+  801d06:	c1 ea 04             	shr    $0x4,%edx
+  801d09:	83 e2 0f             	and    $0xf,%edx
+  801d0c:	83 fa 02             	cmp    $0x2,%edx
+  801d0f:	77 e5                	ja     801cf6 <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  801d11:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d14:	83 f8 02             	cmp    $0x2,%eax
+  801d17:	0f 97 c1             	seta   %cl
+  801d1a:	0f b6 c9             	movzbl %cl,%ecx
+  801d1d:	eb d7                	jmp    801cf6 <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  801d1f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801d24:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d27:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d2a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d2d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801d30:	8b 75 18             	mov    0x18(%ebp),%esi
+  801d33:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  801d35:	eb 97                	jmp    801cce <sys_ipc_send_range+0x3a>
+
+00801d37 <sys_ipc_recv_range>:
+{
+  801d37:	55                   	push   %ebp
+  801d38:	89 e5                	mov    %esp,%ebp
+  801d3a:	57                   	push   %edi
+  801d3b:	56                   	push   %esi
+  801d3c:	53                   	push   %ebx
+  801d3d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801d40:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801d47:	78 37                	js     801d80 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  801d49:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801d50:	74 7a                	je     801dcc <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  801d52:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d57:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d5d:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801d62:	89 df                	mov    %ebx,%edi
+  801d64:	89 de                	mov    %ebx,%esi
+  801d66:	55                   	push   %ebp
+  801d67:	68 70 1d 80 00       	push   $0x801d70
+  801d6c:	89 e5                	mov    %esp,%ebp
+  801d6e:	0f 34                	sysenter
+  801d70:	83 c4 04             	add    $0x4,%esp
+  801d73:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801d74:	85 c0                	test   %eax,%eax
+  801d76:	7f 6c                	jg     801de4 <sys_ipc_recv_range+0xad>
+}
+  801d78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d7b:	5b                   	pop    %ebx
+  801d7c:	5e                   	pop    %esi
+  801d7d:	5f                   	pop    %edi
+  801d7e:	5d                   	pop    %ebp
+  801d7f:	c3                   	ret
+  801d80:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d85:	0f a2                	cpuid
+		return 0;
+  801d87:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801d8c:	f6 c6 08             	test   $0x8,%dh
+  801d8f:	74 15                	je     801da6 <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d91:	89 c2                	mov    %eax,%edx
+  801d93:	c1 ea 08             	shr    $0x8,%edx
+  801d96:	83 e2 0f             	and    $0xf,%edx
+  801d99:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d9e:	83 fa 06             	cmp    $0x6,%edx
+  801da1:	74 0e                	je     801db1 <sys_ipc_recv_range+0x7a>
+  801da3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801da6:	0f b6 c9             	movzbl %cl,%ecx
+  801da9:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801daf:	eb 98                	jmp    801d49 <sys_ipc_recv_range+0x12>
+  801db1:	89 c2                	mov    %eax,%edx
+  801db3:	c1 ea 04             	shr    $0x4,%edx
+  801db6:	83 e2 0f             	and    $0xf,%edx
+  801db9:	83 fa 02             	cmp    $0x2,%edx
+  801dbc:	77 e5                	ja     801da3 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801dbe:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801dc1:	83 f8 02             	cmp    $0x2,%eax
+  801dc4:	0f 97 c1             	seta   %cl
+  801dc7:	0f b6 c9             	movzbl %cl,%ecx
+  801dca:	eb d7                	jmp    801da3 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801dcc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dd1:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801dd6:	8b 55 08             	mov    0x8(%ebp),%edx
+  801dd9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ddc:	89 df                	mov    %ebx,%edi
+  801dde:	89 de                	mov    %ebx,%esi
+  801de0:	cd 30                	int    $0x30
+  801de2:	eb 90                	jmp    801d74 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801de4:	83 ec 0c             	sub    $0xc,%esp
+  801de7:	50                   	push   %eax
+  801de8:	6a 1f                	push   $0x1f
+  801dea:	68 f9 35 80 00       	push   $0x8035f9
+  801def:	6a 4a                	push   $0x4a
+  801df1:	68 16 36 80 00       	push   $0x803616
+  801df6:	e8 cf e5 ff ff       	call   8003ca <_panic>
+
+00801dfb <sys_ipc_call>:
+{
+  801dfb:	55                   	push   %ebp
+  801dfc:	89 e5                	mov    %esp,%ebp
+  801dfe:	57                   	push   %edi
+  801dff:	56                   	push   %esi
+  801e00:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801e01:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e04:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801e09:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801e0c:	55                   	push   %ebp
+  801e0d:	56                   	push   %esi
+  801e0e:	8b 0e                	mov    (%esi),%ecx
+  801e10:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801e13:	8b 7e 08             	mov    0x8(%esi),%edi
+  801e16:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801e19:	8b 76 0c             	mov    0xc(%esi),%esi
+  801e1c:	cd 30                	int    $0x30
+  801e1e:	87 34 24             	xchg   %esi,(%esp)
+  801e21:	89 0e                	mov    %ecx,(%esi)
+  801e23:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801e26:	89 7e 08             	mov    %edi,0x8(%esi)
+  801e29:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801e2c:	8f 46 0c             	pop    0xc(%esi)
+  801e2f:	5d                   	pop    %ebp
+}
+  801e30:	5b                   	pop    %ebx
+  801e31:	5e                   	pop    %esi
+  801e32:	5f                   	pop    %edi
+  801e33:	5d                   	pop    %ebp
+  801e34:	c3                   	ret
+
+00801e35 <sys_ipc_reply_wait>:
+{
+  801e35:	55                   	push   %ebp
+  801e36:	89 e5                	mov    %esp,%ebp
+  801e38:	57                   	push   %edi
+  801e39:	56                   	push   %esi
+  801e3a:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801e3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e3e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801e43:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801e46:	55                   	push   %ebp
+  801e47:	56                   	push   %esi
+  801e48:	8b 0e                	mov    (%esi),%ecx
+  801e4a:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801e4d:	8b 7e 08             	mov    0x8(%esi),%edi
+  801e50:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801e53:	8b 76 0c             	mov    0xc(%esi),%esi
+  801e56:	cd 30                	int    $0x30
+  801e58:	87 34 24             	xchg   %esi,(%esp)
+  801e5b:	89 0e                	mov    %ecx,(%esi)
+  801e5d:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801e60:	89 7e 08             	mov    %edi,0x8(%esi)
+  801e63:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801e66:	8f 46 0c             	pop    0xc(%esi)
+  801e69:	5d                   	pop    %ebp
+}
+  801e6a:	5b                   	pop    %ebx
+  801e6b:	5e                   	pop    %esi
+  801e6c:	5f                   	pop    %edi
+  801e6d:	5d                   	pop    %ebp
+  801e6e:	c3                   	ret
+
+00801e6f <sys_ipc_send_msg>:
+{
+  801e6f:	55                   	push   %ebp
+  801e70:	89 e5                	mov    %esp,%ebp
+  801e72:	57                   	push   %edi
+  801e73:	56                   	push   %esi
+  801e74:	53                   	push   %ebx
+  801e75:	83 ec 20             	sub    $0x20,%esp
+  801e78:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801e7b:	8b 10                	mov    (%eax),%edx
+  801e7d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801e80:	8b 50 04             	mov    0x4(%eax),%edx
+  801e83:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801e86:	8b 50 08             	mov    0x8(%eax),%edx
+  801e89:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801e8c:	8b 50 0c             	mov    0xc(%eax),%edx
+  801e8f:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801e92:	8b 40 10             	mov    0x10(%eax),%eax
+  801e95:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801e98:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801e9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e9e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801ea3:	55                   	push   %ebp
+  801ea4:	56                   	push   %esi
+  801ea5:	8b 0e                	mov    (%esi),%ecx
+  801ea7:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801eaa:	8b 7e 08             	mov    0x8(%esi),%edi
+  801ead:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801eb0:	8b 76 0c             	mov    0xc(%esi),%esi
+  801eb3:	cd 30                	int    $0x30
+  801eb5:	87 34 24             	xchg   %esi,(%esp)
+  801eb8:	89 0e                	mov    %ecx,(%esi)
+  801eba:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801ebd:	89 7e 08             	mov    %edi,0x8(%esi)
+  801ec0:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801ec3:	8f 46 0c             	pop    0xc(%esi)
+  801ec6:	5d                   	pop    %ebp
+}
+  801ec7:	83 c4 20             	add    $0x20,%esp
+  801eca:	5b                   	pop    %ebx
+  801ecb:	5e                   	pop    %esi
+  801ecc:	5f                   	pop    %edi
+  801ecd:	5d                   	pop    %ebp
+  801ece:	c3                   	ret
+
+00801ecf <sys_fork>:
+{
+  801ecf:	55                   	push   %ebp
+  801ed0:	89 e5                	mov    %esp,%ebp
+  801ed2:	57                   	push   %edi
+  801ed3:	56                   	push   %esi
+  801ed4:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801ed5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801edc:	78 2e                	js     801f0c <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801ede:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ee5:	74 71                	je     801f58 <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801ee7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eec:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801ef1:	89 d1                	mov    %edx,%ecx
+  801ef3:	89 d3                	mov    %edx,%ebx
+  801ef5:	89 d7                	mov    %edx,%edi
+  801ef7:	89 d6                	mov    %edx,%esi
+  801ef9:	55                   	push   %ebp
+  801efa:	68 03 1f 80 00       	push   $0x801f03
+  801eff:	89 e5                	mov    %esp,%ebp
+  801f01:	0f 34                	sysenter
+  801f03:	83 c4 04             	add    $0x4,%esp
+  801f06:	5d                   	pop    %ebp
+}
+  801f07:	5b                   	pop    %ebx
+  801f08:	5e                   	pop    %esi
+  801f09:	5f                   	pop    %edi
+  801f0a:	5d                   	pop    %ebp
+  801f0b:	c3                   	ret
+  801f0c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f11:	0f a2                	cpuid
+		return 0;
+  801f13:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801f18:	f6 c6 08             	test   $0x8,%dh
+  801f1b:	74 15                	je     801f32 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f1d:	89 c2                	mov    %eax,%edx
+  801f1f:	c1 ea 08             	shr    $0x8,%edx
+  801f22:	83 e2 0f             	and    $0xf,%edx
+  801f25:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f2a:	83 fa 06             	cmp    $0x6,%edx
+  801f2d:	74 0e                	je     801f3d <sys_fork+0x6e>
+  801f2f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801f32:	0f b6 c9             	movzbl %cl,%ecx
+  801f35:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801f3b:	eb a1                	jmp    801ede <sys_fork+0xf>
+  801f3d:	89 c2                	mov    %eax,%edx
+  801f3f:	c1 ea 04             	shr    $0x4,%edx
+  801f42:	83 e2 0f             	and    $0xf,%edx
+  801f45:	83 fa 02             	cmp    $0x2,%edx
+  801f48:	77 e5                	ja     801f2f <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801f4a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f4d:	83 f8 02             	cmp    $0x2,%eax
+  801f50:	0f 97 c1             	seta   %cl
+  801f53:	0f b6 c9             	movzbl %cl,%ecx
+  801f56:	eb d7                	jmp    801f2f <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801f58:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f5d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801f62:	89 d1                	mov    %edx,%ecx
+  801f64:	89 d3                	mov    %edx,%ebx
+  801f66:	89 d7                	mov    %edx,%edi
+  801f68:	89 d6                	mov    %edx,%esi
+  801f6a:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801f6c:	eb 99                	jmp    801f07 <sys_fork+0x38>
+
+00801f6e <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801f6e:	55                   	push   %ebp
+  801f6f:	89 e5                	mov    %esp,%ebp
+  801f71:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801f74:	ff 75 14             	push   0x14(%ebp)
+  801f77:	ff 75 10             	push   0x10(%ebp)
+  801f7a:	ff 75 0c             	push   0xc(%ebp)
+  801f7d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f82:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f85:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801f8a:	e8 81 ee ff ff       	call   800e10 <page_vec_call>
+}
+  801f8f:	c9                   	leave
+  801f90:	c3                   	ret
+
+00801f91 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801f91:	55                   	push   %ebp
+  801f92:	89 e5                	mov    %esp,%ebp
+  801f94:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801f97:	ff 75 18             	push   0x18(%ebp)
+  801f9a:	ff 75 14             	push   0x14(%ebp)
+  801f9d:	ff 75 10             	push   0x10(%ebp)
+  801fa0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fa3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fa6:	b8 10 00 00 00       	mov    $0x10,%eax
+  801fab:	e8 60 ee ff ff       	call   800e10 <page_vec_call>
+}
+  801fb0:	c9                   	leave
+  801fb1:	c3                   	ret
+
+00801fb2 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801fb2:	55                   	push   %ebp
+  801fb3:	89 e5                	mov    %esp,%ebp
+  801fb5:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801fb8:	ff 75 14             	push   0x14(%ebp)
+  801fbb:	ff 75 10             	push   0x10(%ebp)
+  801fbe:	ff 75 0c             	push   0xc(%ebp)
+  801fc1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fc6:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fc9:	b8 11 00 00 00       	mov    $0x11,%eax
+  801fce:	e8 3d ee ff ff       	call   800e10 <page_vec_call>
+}
+  801fd3:	c9                   	leave
+  801fd4:	c3                   	ret
+
+00801fd5 <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801fd5:	55                   	push   %ebp
+  801fd6:	89 e5                	mov    %esp,%ebp
+  801fd8:	57                   	push   %edi
+  801fd9:	56                   	push   %esi
+  801fda:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801fdb:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801fe2:	78 32                	js     802016 <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801fe4:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801feb:	74 75                	je     802062 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801fed:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ff0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ff3:	b8 12 00 00 00       	mov    $0x12,%eax
+  801ff8:	be 00 00 00 00       	mov    $0x0,%esi
+  801ffd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802000:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802003:	55                   	push   %ebp
+  802004:	68 0d 20 80 00       	push   $0x80200d
+  802009:	89 e5                	mov    %esp,%ebp
+  80200b:	0f 34                	sysenter
+  80200d:	83 c4 04             	add    $0x4,%esp
+  802010:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  802011:	5b                   	pop    %ebx
+  802012:	5e                   	pop    %esi
+  802013:	5f                   	pop    %edi
+  802014:	5d                   	pop    %ebp
+  802015:	c3                   	ret
+  802016:	b8 01 00 00 00       	mov    $0x1,%eax
+  80201b:	0f a2                	cpuid
+		return 0;
+  80201d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802022:	f6 c6 08             	test   $0x8,%dh
+  802025:	74 15                	je     80203c <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802027:	89 c2                	mov    %eax,%edx
+  802029:	c1 ea 08             	shr    $0x8,%edx
+  80202c:	83 e2 0f             	and    $0xf,%edx
+  80202f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802034:	83 fa 06             	cmp    $0x6,%edx
+  802037:	74 0e                	je     802047 <sys_vm_ranges+0x72>
+  802039:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80203c:	0f b6 c9             	movzbl %cl,%ecx
+  80203f:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802045:	eb 9d                	jmp    801fe4 <sys_vm_ranges+0xf>
+  802047:	89 c2                	mov    %eax,%edx
+  802049:	c1 ea 04             	shr    $0x4,%edx
+  80204c:	83 e2 0f             	and    $0xf,%edx
+  80204f:	83 fa 02             	cmp    $0x2,%edx
+  802052:	77 e5                	ja     802039 <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  802054:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802057:	83 f8 02             	cmp    $0x2,%eax
+  80205a:	0f 97 c1             	seta   %cl
+  80205d:	0f b6 c9             	movzbl %cl,%ecx
+  802060:	eb d7                	jmp    802039 <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  802062:	b8 12 00 00 00       	mov    $0x12,%eax
+  802067:	be 00 00 00 00       	mov    $0x0,%esi
+  80206c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80206f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802072:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802075:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802078:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  80207a:	eb 95                	jmp    802011 <sys_vm_ranges+0x3c>
+
+0080207c <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  80207c:	55                   	push   %ebp
+  80207d:	89 e5                	mov    %esp,%ebp
+  80207f:	57                   	push   %edi
+  802080:	56                   	push   %esi
+  802081:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802082:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802089:	78 31                	js     8020bc <sys_spawn+0x40>
+	if (syscall_sysenter)
+  80208b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802092:	74 74                	je     802108 <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  802094:	be 00 00 00 00       	mov    $0x0,%esi
+  802099:	8b 55 08             	mov    0x8(%ebp),%edx
+  80209c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80209f:	b8 14 00 00 00       	mov    $0x14,%eax
+  8020a4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8020a7:	89 f7                	mov    %esi,%edi
+  8020a9:	55                   	push   %ebp
+  8020aa:	68 b3 20 80 00       	push   $0x8020b3
+  8020af:	89 e5                	mov    %esp,%ebp
+  8020b1:	0f 34                	sysenter
+  8020b3:	83 c4 04             	add    $0x4,%esp
+  8020b6:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  8020b7:	5b                   	pop    %ebx
+  8020b8:	5e                   	pop    %esi
+  8020b9:	5f                   	pop    %edi
+  8020ba:	5d                   	pop    %ebp
+  8020bb:	c3                   	ret
+  8020bc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020c1:	0f a2                	cpuid
+		return 0;
+  8020c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8020c8:	f6 c6 08             	test   $0x8,%dh
+  8020cb:	74 15                	je     8020e2 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020cd:	89 c2                	mov    %eax,%edx
+  8020cf:	c1 ea 08             	shr    $0x8,%edx
+  8020d2:	83 e2 0f             	and    $0xf,%edx
+  8020d5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8020da:	83 fa 06             	cmp    $0x6,%edx
+  8020dd:	74 0e                	je     8020ed <sys_spawn+0x71>
+  8020df:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8020e2:	0f b6 c9             	movzbl %cl,%ecx
+  8020e5:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8020eb:	eb 9e                	jmp    80208b <sys_spawn+0xf>
+  8020ed:	89 c2                	mov    %eax,%edx
+  8020ef:	c1 ea 04             	shr    $0x4,%edx
+  8020f2:	83 e2 0f             	and    $0xf,%edx
+  8020f5:	83 fa 02             	cmp    $0x2,%edx
+  8020f8:	77 e5                	ja     8020df <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  8020fa:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020fd:	83 f8 02             	cmp    $0x2,%eax
+  802100:	0f 97 c1             	seta   %cl
+  802103:	0f b6 c9             	movzbl %cl,%ecx
+  802106:	eb d7                	jmp    8020df <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  802108:	be 00 00 00 00       	mov    $0x0,%esi
+  80210d:	b8 14 00 00 00       	mov    $0x14,%eax
+  802112:	8b 55 08             	mov    0x8(%ebp),%edx
+  802115:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802118:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80211b:	89 f7                	mov    %esi,%edi
+  80211d:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  80211f:	eb 96                	jmp    8020b7 <sys_spawn+0x3b>
+
+00802121 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  802121:	55                   	push   %ebp
+  802122:	89 e5                	mov    %esp,%ebp
+  802124:	57                   	push   %edi
+  802125:	56                   	push   %esi
+  802126:	53                   	push   %ebx
+  802127:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80212a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802131:	78 37                	js     80216a <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  802133:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80213a:	74 7a                	je     8021b6 <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  80213c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802141:	8b 55 08             	mov    0x8(%ebp),%edx
+  802144:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802147:	b8 15 00 00 00       	mov    $0x15,%eax
+  80214c:	89 df                	mov    %ebx,%edi
+  80214e:	89 de                	mov    %ebx,%esi
+  802150:	55                   	push   %ebp
+  802151:	68 5a 21 80 00       	push   $0x80215a
+  802156:	89 e5                	mov    %esp,%ebp
+  802158:	0f 34                	sysenter
+  80215a:	83 c4 04             	add    $0x4,%esp
+  80215d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80215e:	85 c0                	test   %eax,%eax
+  802160:	7f 6c                	jg     8021ce <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  802162:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802165:	5b                   	pop    %ebx
+  802166:	5e                   	pop    %esi
+  802167:	5f                   	pop    %edi
+  802168:	5d                   	pop    %ebp
+  802169:	c3                   	ret
+  80216a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80216f:	0f a2                	cpuid
+		return 0;
+  802171:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802176:	f6 c6 08             	test   $0x8,%dh
+  802179:	74 15                	je     802190 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80217b:	89 c2                	mov    %eax,%edx
+  80217d:	c1 ea 08             	shr    $0x8,%edx
+  802180:	83 e2 0f             	and    $0xf,%edx
+  802183:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802188:	83 fa 06             	cmp    $0x6,%edx
+  80218b:	74 0e                	je     80219b <sys_shm_create+0x7a>
+  80218d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802190:	0f b6 c9             	movzbl %cl,%ecx
+  802193:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802199:	eb 98                	jmp    802133 <sys_shm_create+0x12>
+  80219b:	89 c2                	mov    %eax,%edx
+  80219d:	c1 ea 04             	shr    $0x4,%edx
+  8021a0:	83 e2 0f             	and    $0xf,%edx
+  8021a3:	83 fa 02             	cmp    $0x2,%edx
+  8021a6:	77 e5                	ja     80218d <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  8021a8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021ab:	83 f8 02             	cmp    $0x2,%eax
+  8021ae:	0f 97 c1             	seta   %cl
+  8021b1:	0f b6 c9             	movzbl %cl,%ecx
+  8021b4:	eb d7                	jmp    80218d <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  8021b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021bb:	b8 15 00 00 00       	mov    $0x15,%eax
+  8021c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021c6:	89 df                	mov    %ebx,%edi
+  8021c8:	89 de                	mov    %ebx,%esi
+  8021ca:	cd 30                	int    $0x30
+  8021cc:	eb 90                	jmp    80215e <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8021ce:	83 ec 0c             	sub    $0xc,%esp
+  8021d1:	50                   	push   %eax
+  8021d2:	6a 15                	push   $0x15
+  8021d4:	68 f9 35 80 00       	push   $0x8035f9
+  8021d9:	6a 4a                	push   $0x4a
+  8021db:	68 16 36 80 00       	push   $0x803616
+  8021e0:	e8 e5 e1 ff ff       	call   8003ca <_panic>
+
+008021e5 <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  8021e5:	55                   	push   %ebp
+  8021e6:	89 e5                	mov    %esp,%ebp
+  8021e8:	57                   	push   %edi
+  8021e9:	56                   	push   %esi
+  8021ea:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8021eb:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8021f2:	78 32                	js     802226 <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  8021f4:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8021fb:	74 75                	je     802272 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  8021fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  802200:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802203:	b8 16 00 00 00       	mov    $0x16,%eax
+  802208:	be 00 00 00 00       	mov    $0x0,%esi
+  80220d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802210:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802213:	55                   	push   %ebp
+  802214:	68 1d 22 80 00       	push   $0x80221d
+  802219:	89 e5                	mov    %esp,%ebp
+  80221b:	0f 34                	sysenter
+  80221d:	83 c4 04             	add    $0x4,%esp
+  802220:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  802221:	5b                   	pop    %ebx
+  802222:	5e                   	pop    %esi
+  802223:	5f                   	pop    %edi
+  802224:	5d                   	pop    %ebp
+  802225:	c3                   	ret
+  802226:	b8 01 00 00 00       	mov    $0x1,%eax
+  80222b:	0f a2                	cpuid
+		return 0;
+  80222d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802232:	f6 c6 08             	test   $0x8,%dh
+  802235:	74 15                	je     80224c <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802237:	89 c2                	mov    %eax,%edx
+  802239:	c1 ea 08             	shr    $0x8,%edx
+  80223c:	83 e2 0f             	and    $0xf,%edx
+  80223f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802244:	83 fa 06             	cmp    $0x6,%edx
+  802247:	74 0e                	je     802257 <sys_shm_attach+0x72>
+  802249:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80224c:	0f b6 c9             	movzbl %cl,%ecx
+  80224f:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802255:	eb 9d                	jmp    8021f4 <sys_shm_attach+0xf>
+  802257:	89 c2                	mov    %eax,%edx
+  802259:	c1 ea 04             	shr    $0x4,%edx
+  80225c:	83 e2 0f             	and    $0xf,%edx
+  80225f:	83 fa 02             	cmp    $0x2,%edx
+  802262:	77 e5                	ja     802249 <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  802264:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802267:	83 f8 02             	cmp    $0x2,%eax
+  80226a:	0f 97 c1             	seta   %cl
+  80226d:	0f b6 c9             	movzbl %cl,%ecx
+  802270:	eb d7                	jmp    802249 <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  802272:	b8 16 00 00 00       	mov    $0x16,%eax
+  802277:	be 00 00 00 00       	mov    $0x0,%esi
+  80227c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80227f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802282:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802285:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802288:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  80228a:	eb 95                	jmp    802221 <sys_shm_attach+0x3c>
+
+0080228c <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  80228c:	55                   	push   %ebp
+  80228d:	89 e5                	mov    %esp,%ebp
+  80228f:	57                   	push   %edi
+  802290:	56                   	push   %esi
+  802291:	53                   	push   %ebx
+  802292:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802295:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80229c:	78 38                	js     8022d6 <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  80229e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8022a5:	74 7b                	je     802322 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  8022a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8022ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022b2:	b8 17 00 00 00       	mov    $0x17,%eax
+  8022b7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8022ba:	89 f7                	mov    %esi,%edi
+  8022bc:	55                   	push   %ebp
+  8022bd:	68 c6 22 80 00       	push   $0x8022c6
+  8022c2:	89 e5                	mov    %esp,%ebp
+  8022c4:	0f 34                	sysenter
+  8022c6:	83 c4 04             	add    $0x4,%esp
+  8022c9:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8022ca:	85 c0                	test   %eax,%eax
+  8022cc:	7f 6d                	jg     80233b <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  8022ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022d1:	5b                   	pop    %ebx
+  8022d2:	5e                   	pop    %esi
+  8022d3:	5f                   	pop    %edi
+  8022d4:	5d                   	pop    %ebp
+  8022d5:	c3                   	ret
+  8022d6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022db:	0f a2                	cpuid
+		return 0;
+  8022dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8022e2:	f6 c6 08             	test   $0x8,%dh
+  8022e5:	74 15                	je     8022fc <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022e7:	89 c2                	mov    %eax,%edx
+  8022e9:	c1 ea 08             	shr    $0x8,%edx
+  8022ec:	83 e2 0f             	and    $0xf,%edx
+  8022ef:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8022f4:	83 fa 06             	cmp    $0x6,%edx
+  8022f7:	74 0e                	je     802307 <sys_shm_detach+0x7b>
+  8022f9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8022fc:	0f b6 c9             	movzbl %cl,%ecx
+  8022ff:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802305:	eb 97                	jmp    80229e <sys_shm_detach+0x12>
+  802307:	89 c2                	mov    %eax,%edx
+  802309:	c1 ea 04             	shr    $0x4,%edx
+  80230c:	83 e2 0f             	and    $0xf,%edx
+  80230f:	83 fa 02             	cmp    $0x2,%edx
+  802312:	77 e5                	ja     8022f9 <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  802314:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802317:	83 f8 02             	cmp    $0x2,%eax
+  80231a:	0f 97 c1             	seta   %cl
+  80231d:	0f b6 c9             	movzbl %cl,%ecx
+  802320:	eb d7                	jmp    8022f9 <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  802322:	be 00 00 00 00       	mov    $0x0,%esi
+  802327:	b8 17 00 00 00       	mov    $0x17,%eax
+  80232c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80232f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802332:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802335:	89 f7                	mov    %esi,%edi
+  802337:	cd 30                	int    $0x30
+  802339:	eb 8f                	jmp    8022ca <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80233b:	83 ec 0c             	sub    $0xc,%esp
+  80233e:	50                   	push   %eax
+  80233f:	6a 17                	push   $0x17
+  802341:	68 f9 35 80 00       	push   $0x8035f9
+  802346:	6a 4a                	push   $0x4a
+  802348:	68 16 36 80 00       	push   $0x803616
+  80234d:	e8 78 e0 ff ff       	call   8003ca <_panic>
+
+00802352 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  802352:	55                   	push   %ebp
+  802353:	89 e5                	mov    %esp,%ebp
+  802355:	57                   	push   %edi
+  802356:	56                   	push   %esi
+  802357:	53                   	push   %ebx
+  802358:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80235b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802362:	78 36                	js     80239a <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  802364:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80236b:	74 79                	je     8023e6 <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  80236d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802370:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802375:	b8 18 00 00 00       	mov    $0x18,%eax
+  80237a:	89 cb                	mov    %ecx,%ebx
+  80237c:	89 cf                	mov    %ecx,%edi
+  80237e:	89 ce                	mov    %ecx,%esi
+  802380:	55                   	push   %ebp
+  802381:	68 8a 23 80 00       	push   $0x80238a
+  802386:	89 e5                	mov    %esp,%ebp
+  802388:	0f 34                	sysenter
+  80238a:	83 c4 04             	add    $0x4,%esp
+  80238d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80238e:	85 c0                	test   %eax,%eax
+  802390:	7f 6b                	jg     8023fd <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  802392:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802395:	5b                   	pop    %ebx
+  802396:	5e                   	pop    %esi
+  802397:	5f                   	pop    %edi
+  802398:	5d                   	pop    %ebp
+  802399:	c3                   	ret
+  80239a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80239f:	0f a2                	cpuid
+		return 0;
+  8023a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8023a6:	f6 c6 08             	test   $0x8,%dh
+  8023a9:	74 15                	je     8023c0 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023ab:	89 c2                	mov    %eax,%edx
+  8023ad:	c1 ea 08             	shr    $0x8,%edx
+  8023b0:	83 e2 0f             	and    $0xf,%edx
+  8023b3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8023b8:	83 fa 06             	cmp    $0x6,%edx
+  8023bb:	74 0e                	je     8023cb <sys_shm_remove+0x79>
+  8023bd:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8023c0:	0f b6 c9             	movzbl %cl,%ecx
+  8023c3:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8023c9:	eb 99                	jmp    802364 <sys_shm_remove+0x12>
+  8023cb:	89 c2                	mov    %eax,%edx
+  8023cd:	c1 ea 04             	shr    $0x4,%edx
+  8023d0:	83 e2 0f             	and    $0xf,%edx
+  8023d3:	83 fa 02             	cmp    $0x2,%edx
+  8023d6:	77 e5                	ja     8023bd <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  8023d8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023db:	83 f8 02             	cmp    $0x2,%eax
+  8023de:	0f 97 c1             	seta   %cl
+  8023e1:	0f b6 c9             	movzbl %cl,%ecx
+  8023e4:	eb d7                	jmp    8023bd <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  8023e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023eb:	b8 18 00 00 00       	mov    $0x18,%eax
+  8023f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023f3:	89 cb                	mov    %ecx,%ebx
+  8023f5:	89 cf                	mov    %ecx,%edi
+  8023f7:	89 ce                	mov    %ecx,%esi
+  8023f9:	cd 30                	int    $0x30
+  8023fb:	eb 91                	jmp    80238e <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8023fd:	83 ec 0c             	sub    $0xc,%esp
+  802400:	50                   	push   %eax
+  802401:	6a 18                	push   $0x18
+  802403:	68 f9 35 80 00       	push   $0x8035f9
+  802408:	6a 4a                	push   $0x4a
+  80240a:	68 16 36 80 00       	push   $0x803616
+  80240f:	e8 b6 df ff ff       	call   8003ca <_panic>
+
+00802414 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  802414:	55                   	push   %ebp
+  802415:	89 e5                	mov    %esp,%ebp
+  802417:	57                   	push   %edi
+  802418:	56                   	push   %esi
+  802419:	53                   	push   %ebx
+  80241a:	83 ec 0c             	sub    $0xc,%esp
+  80241d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802420:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802423:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  802426:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80242d:	78 32                	js     802461 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  80242f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802436:	74 75                	je     8024ad <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  802438:	8b 55 08             	mov    0x8(%ebp),%edx
+  80243b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80243e:	b8 20 00 00 00       	mov    $0x20,%eax
+  802443:	be 00 00 00 00       	mov    $0x0,%esi
+  802448:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  80244b:	55                   	push   %ebp
+  80244c:	68 55 24 80 00       	push   $0x802455
+  802451:	89 e5                	mov    %esp,%ebp
+  802453:	0f 34                	sysenter
+  802455:	83 c4 04             	add    $0x4,%esp
+  802458:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  802459:	83 c4 0c             	add    $0xc,%esp
+  80245c:	5b                   	pop    %ebx
+  80245d:	5e                   	pop    %esi
+  80245e:	5f                   	pop    %edi
+  80245f:	5d                   	pop    %ebp
+  802460:	c3                   	ret
+  802461:	b8 01 00 00 00       	mov    $0x1,%eax
+  802466:	0f a2                	cpuid
+		return 0;
+  802468:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80246d:	f6 c6 08             	test   $0x8,%dh
+  802470:	74 15                	je     802487 <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802472:	89 c2                	mov    %eax,%edx
+  802474:	c1 ea 08             	shr    $0x8,%edx
+  802477:	83 e2 0f             	and    $0xf,%edx
+  80247a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80247f:	83 fa 06             	cmp    $0x6,%edx
+  802482:	74 0e                	je     802492 <sys_futex_wait+0x7e>
+  802484:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802487:	0f b6 c9             	movzbl %cl,%ecx
+  80248a:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802490:	eb 9d                	jmp    80242f <sys_futex_wait+0x1b>
+  802492:	89 c2                	mov    %eax,%edx
+  802494:	c1 ea 04             	shr    $0x4,%edx
+  802497:	83 e2 0f             	and    $0xf,%edx
+  80249a:	83 fa 02             	cmp    $0x2,%edx
+  80249d:	77 e5                	ja     802484 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  80249f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8024a2:	83 f8 02             	cmp    $0x2,%eax
+  8024a5:	0f 97 c1             	seta   %cl
+  8024a8:	0f b6 c9             	movzbl %cl,%ecx
+  8024ab:	eb d7                	jmp    802484 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  8024ad:	b8 20 00 00 00       	mov    $0x20,%eax
+  8024b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8024b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024bd:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8024c0:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  8024c2:	eb 95                	jmp    802459 <sys_futex_wait+0x45>
+
+008024c4 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8024c4:	55                   	push   %ebp
+  8024c5:	89 e5                	mov    %esp,%ebp
+  8024c7:	57                   	push   %edi
+  8024c8:	56                   	push   %esi
+  8024c9:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8024ca:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8024d1:	78 30                	js     802503 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  8024d3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8024da:	74 73                	je     80254f <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  8024dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024e7:	b8 21 00 00 00       	mov    $0x21,%eax
+  8024ec:	89 df                	mov    %ebx,%edi
+  8024ee:	89 de                	mov    %ebx,%esi
+  8024f0:	55                   	push   %ebp
+  8024f1:	68 fa 24 80 00       	push   $0x8024fa
+  8024f6:	89 e5                	mov    %esp,%ebp
+  8024f8:	0f 34                	sysenter
+  8024fa:	83 c4 04             	add    $0x4,%esp
+  8024fd:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8024fe:	5b                   	pop    %ebx
+  8024ff:	5e                   	pop    %esi
+  802500:	5f                   	pop    %edi
+  802501:	5d                   	pop    %ebp
+  802502:	c3                   	ret
+  802503:	b8 01 00 00 00       	mov    $0x1,%eax
+  802508:	0f a2                	cpuid
+		return 0;
+  80250a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80250f:	f6 c6 08             	test   $0x8,%dh
+  802512:	74 15                	je     802529 <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802514:	89 c2                	mov    %eax,%edx
+  802516:	c1 ea 08             	shr    $0x8,%edx
+  802519:	83 e2 0f             	and    $0xf,%edx
+  80251c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802521:	83 fa 06             	cmp    $0x6,%edx
+  802524:	74 0e                	je     802534 <sys_futex_wake+0x70>
+  802526:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802529:	0f b6 c9             	movzbl %cl,%ecx
+  80252c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802532:	eb 9f                	jmp    8024d3 <sys_futex_wake+0xf>
+  802534:	89 c2                	mov    %eax,%edx
+  802536:	c1 ea 04             	shr    $0x4,%edx
+  802539:	83 e2 0f             	and    $0xf,%edx
+  80253c:	83 fa 02             	cmp    $0x2,%edx
+  80253f:	77 e5                	ja     802526 <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  802541:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802544:	83 f8 02             	cmp    $0x2,%eax
+  802547:	0f 97 c1             	seta   %cl
+  80254a:	0f b6 c9             	movzbl %cl,%ecx
+  80254d:	eb d7                	jmp    802526 <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  80254f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802554:	b8 21 00 00 00       	mov    $0x21,%eax
+  802559:	8b 55 08             	mov    0x8(%ebp),%edx
+  80255c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80255f:	89 df                	mov    %ebx,%edi
+  802561:	89 de                	mov    %ebx,%esi
+  802563:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  802565:	eb 97                	jmp    8024fe <sys_futex_wake+0x3a>
+
+00802567 <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  802567:	55                   	push   %ebp
+  802568:	89 e5                	mov    %esp,%ebp
+  80256a:	57                   	push   %edi
+  80256b:	56                   	push   %esi
+  80256c:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80256d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802574:	78 2e                	js     8025a4 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  802576:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80257d:	74 71                	je     8025f0 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  80257f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802584:	b8 22 00 00 00       	mov    $0x22,%eax
+  802589:	89 d1                	mov    %edx,%ecx
+  80258b:	89 d3                	mov    %edx,%ebx
+  80258d:	89 d7                	mov    %edx,%edi
+  80258f:	89 d6                	mov    %edx,%esi
+  802591:	55                   	push   %ebp
+  802592:	68 9b 25 80 00       	push   $0x80259b
+  802597:	89 e5                	mov    %esp,%ebp
+  802599:	0f 34                	sysenter
+  80259b:	83 c4 04             	add    $0x4,%esp
+  80259e:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  80259f:	5b                   	pop    %ebx
+  8025a0:	5e                   	pop    %esi
+  8025a1:	5f                   	pop    %edi
+  8025a2:	5d                   	pop    %ebp
+  8025a3:	c3                   	ret
+  8025a4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025a9:	0f a2                	cpuid
+		return 0;
+  8025ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8025b0:	f6 c6 08             	test   $0x8,%dh
+  8025b3:	74 15                	je     8025ca <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025b5:	89 c2                	mov    %eax,%edx
+  8025b7:	c1 ea 08             	shr    $0x8,%edx
+  8025ba:	83 e2 0f             	and    $0xf,%edx
+  8025bd:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8025c2:	83 fa 06             	cmp    $0x6,%edx
+  8025c5:	74 0e                	je     8025d5 <sys_ep_create+0x6e>
+  8025c7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8025ca:	0f b6 c9             	movzbl %cl,%ecx
+  8025cd:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8025d3:	eb a1                	jmp    802576 <sys_ep_create+0xf>
+  8025d5:	89 c2                	mov    %eax,%edx
+  8025d7:	c1 ea 04             	shr    $0x4,%edx
+  8025da:	83 e2 0f             	and    $0xf,%edx
+  8025dd:	83 fa 02             	cmp    $0x2,%edx
+  8025e0:	77 e5                	ja     8025c7 <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  8025e2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025e5:	83 f8 02             	cmp    $0x2,%eax
+  8025e8:	0f 97 c1             	seta   %cl
+  8025eb:	0f b6 c9             	movzbl %cl,%ecx
+  8025ee:	eb d7                	jmp    8025c7 <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  8025f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025f5:	b8 22 00 00 00       	mov    $0x22,%eax
+  8025fa:	89 d1                	mov    %edx,%ecx
+  8025fc:	89 d3                	mov    %edx,%ebx
+  8025fe:	89 d7                	mov    %edx,%edi
+  802600:	89 d6                	mov    %edx,%esi
+  802602:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  802604:	eb 99                	jmp    80259f <sys_ep_create+0x38>
+
+00802606 <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  802606:	55                   	push   %ebp
+  802607:	89 e5                	mov    %esp,%ebp
+  802609:	57                   	push   %edi
+  80260a:	56                   	push   %esi
+  80260b:	53                   	push   %ebx
+  80260c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80260f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802616:	78 36                	js     80264e <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  802618:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80261f:	74 79                	je     80269a <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  802621:	8b 55 08             	mov    0x8(%ebp),%edx
+  802624:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802629:	b8 23 00 00 00       	mov    $0x23,%eax
+  80262e:	89 cb                	mov    %ecx,%ebx
+  802630:	89 cf                	mov    %ecx,%edi
+  802632:	89 ce                	mov    %ecx,%esi
+  802634:	55                   	push   %ebp
+  802635:	68 3e 26 80 00       	push   $0x80263e
+  80263a:	89 e5                	mov    %esp,%ebp
+  80263c:	0f 34                	sysenter
+  80263e:	83 c4 04             	add    $0x4,%esp
+  802641:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802642:	85 c0                	test   %eax,%eax
+  802644:	7f 6b                	jg     8026b1 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  802646:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802649:	5b                   	pop    %ebx
+  80264a:	5e                   	pop    %esi
+  80264b:	5f                   	pop    %edi
+  80264c:	5d                   	pop    %ebp
+  80264d:	c3                   	ret
+  80264e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802653:	0f a2                	cpuid
+		return 0;
+  802655:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80265a:	f6 c6 08             	test   $0x8,%dh
+  80265d:	74 15                	je     802674 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80265f:	89 c2                	mov    %eax,%edx
+  802661:	c1 ea 08             	shr    $0x8,%edx
+  802664:	83 e2 0f             	and    $0xf,%edx
+  802667:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80266c:	83 fa 06             	cmp    $0x6,%edx
+  80266f:	74 0e                	je     80267f <sys_ep_destroy+0x79>
+  802671:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802674:	0f b6 c9             	movzbl %cl,%ecx
+  802677:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80267d:	eb 99                	jmp    802618 <sys_ep_destroy+0x12>
+  80267f:	89 c2                	mov    %eax,%edx
+  802681:	c1 ea 04             	shr    $0x4,%edx
+  802684:	83 e2 0f             	and    $0xf,%edx
+  802687:	83 fa 02             	cmp    $0x2,%edx
+  80268a:	77 e5                	ja     802671 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  80268c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80268f:	83 f8 02             	cmp    $0x2,%eax
+  802692:	0f 97 c1             	seta   %cl
+  802695:	0f b6 c9             	movzbl %cl,%ecx
+  802698:	eb d7                	jmp    802671 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  80269a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80269f:	b8 23 00 00 00       	mov    $0x23,%eax
+  8026a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8026a7:	89 cb                	mov    %ecx,%ebx
+  8026a9:	89 cf                	mov    %ecx,%edi
+  8026ab:	89 ce                	mov    %ecx,%esi
+  8026ad:	cd 30                	int    $0x30
+  8026af:	eb 91                	jmp    802642 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8026b1:	83 ec 0c             	sub    $0xc,%esp
+  8026b4:	50                   	push   %eax
+  8026b5:	6a 23                	push   $0x23
+  8026b7:	68 f9 35 80 00       	push   $0x8035f9
+  8026bc:	6a 4a                	push   $0x4a
+  8026be:	68 16 36 80 00       	push   $0x803616
+  8026c3:	e8 02 dd ff ff       	call   8003ca <_panic>
+
+008026c8 <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  8026c8:	55                   	push   %ebp
+  8026c9:	89 e5                	mov    %esp,%ebp
+  8026cb:	57                   	push   %edi
+  8026cc:	56                   	push   %esi
+  8026cd:	53                   	push   %ebx
+  8026ce:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8026d1:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8026d8:	78 37                	js     802711 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  8026da:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8026e1:	74 7a                	je     80275d <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  8026e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8026eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026ee:	b8 24 00 00 00       	mov    $0x24,%eax
+  8026f3:	89 df                	mov    %ebx,%edi
+  8026f5:	89 de                	mov    %ebx,%esi
+  8026f7:	55                   	push   %ebp
+  8026f8:	68 01 27 80 00       	push   $0x802701
+  8026fd:	89 e5                	mov    %esp,%ebp
+  8026ff:	0f 34                	sysenter
+  802701:	83 c4 04             	add    $0x4,%esp
+  802704:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802705:	85 c0                	test   %eax,%eax
+  802707:	7f 6c                	jg     802775 <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  802709:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80270c:	5b                   	pop    %ebx
+  80270d:	5e                   	pop    %esi
+  80270e:	5f                   	pop    %edi
+  80270f:	5d                   	pop    %ebp
+  802710:	c3                   	ret
+  802711:	b8 01 00 00 00       	mov    $0x1,%eax
+  802716:	0f a2                	cpuid
+		return 0;
+  802718:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80271d:	f6 c6 08             	test   $0x8,%dh
+  802720:	74 15                	je     802737 <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802722:	89 c2                	mov    %eax,%edx
+  802724:	c1 ea 08             	shr    $0x8,%edx
+  802727:	83 e2 0f             	and    $0xf,%edx
+  80272a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80272f:	83 fa 06             	cmp    $0x6,%edx
+  802732:	74 0e                	je     802742 <sys_ep_grant+0x7a>
+  802734:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802737:	0f b6 c9             	movzbl %cl,%ecx
+  80273a:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802740:	eb 98                	jmp    8026da <sys_ep_grant+0x12>
+  802742:	89 c2                	mov    %eax,%edx
+  802744:	c1 ea 04             	shr    $0x4,%edx
+  802747:	83 e2 0f             	and    $0xf,%edx
+  80274a:	83 fa 02             	cmp    $0x2,%edx
+  80274d:	77 e5                	ja     802734 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  80274f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802752:	83 f8 02             	cmp    $0x2,%eax
+  802755:	0f 97 c1             	seta   %cl
+  802758:	0f b6 c9             	movzbl %cl,%ecx
+  80275b:	eb d7                	jmp    802734 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  80275d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802762:	b8 24 00 00 00       	mov    $0x24,%eax
+  802767:	8b 55 08             	mov    0x8(%ebp),%edx
+  80276a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80276d:	89 df                	mov    %ebx,%edi
+  80276f:	89 de                	mov    %ebx,%esi
+  802771:	cd 30                	int    $0x30
+  802773:	eb 90                	jmp    802705 <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802775:	83 ec 0c             	sub    $0xc,%esp
+  802778:	50                   	push   %eax
+  802779:	6a 24                	push   $0x24
+  80277b:	68 f9 35 80 00       	push   $0x8035f9
+  802780:	6a 4a                	push   $0x4a
+  802782:	68 16 36 80 00       	push   $0x803616
+  802787:	e8 3e dc ff ff       	call   8003ca <_panic>
+
+0080278c <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  80278c:	55                   	push   %ebp
+  80278d:	89 e5                	mov    %esp,%ebp
+  80278f:	57                   	push   %edi
+  802790:	56                   	push   %esi
+  802791:	53                   	push   %ebx
+  802792:	83 ec 20             	sub    $0x20,%esp
+  802795:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  802798:	8b 10                	mov    (%eax),%edx
+  80279a:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  80279d:	8b 50 04             	mov    0x4(%eax),%edx
+  8027a0:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8027a3:	8b 50 08             	mov    0x8(%eax),%edx
+  8027a6:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  8027a9:	8b 50 0c             	mov    0xc(%eax),%edx
+  8027ac:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  8027af:	8b 40 10             	mov    0x10(%eax),%eax
+  8027b2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  8027b5:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  8027b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8027bb:	b8 25 00 00 00       	mov    $0x25,%eax
+  8027c0:	55                   	push   %ebp
+  8027c1:	56                   	push   %esi
+  8027c2:	8b 0e                	mov    (%esi),%ecx
+  8027c4:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8027c7:	8b 7e 08             	mov    0x8(%esi),%edi
+  8027ca:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8027cd:	8b 76 0c             	mov    0xc(%esi),%esi
+  8027d0:	cd 30                	int    $0x30
+  8027d2:	87 34 24             	xchg   %esi,(%esp)
+  8027d5:	89 0e                	mov    %ecx,(%esi)
+  8027d7:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8027da:	89 7e 08             	mov    %edi,0x8(%esi)
+  8027dd:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8027e0:	8f 46 0c             	pop    0xc(%esi)
+  8027e3:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  8027e4:	83 c4 20             	add    $0x20,%esp
+  8027e7:	5b                   	pop    %ebx
+  8027e8:	5e                   	pop    %esi
+  8027e9:	5f                   	pop    %edi
+  8027ea:	5d                   	pop    %ebp
+  8027eb:	c3                   	ret
+
+008027ec <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  8027ec:	55                   	push   %ebp
+  8027ed:	89 e5                	mov    %esp,%ebp
+  8027ef:	57                   	push   %edi
+  8027f0:	56                   	push   %esi
+  8027f1:	53                   	push   %ebx
+  8027f2:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  8027f5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8027f8:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  8027fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8027fd:	b8 26 00 00 00       	mov    $0x26,%eax
+  802802:	55                   	push   %ebp
+  802803:	56                   	push   %esi
+  802804:	8b 0e                	mov    (%esi),%ecx
+  802806:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802809:	8b 7e 08             	mov    0x8(%esi),%edi
+  80280c:	8b 6e 10             	mov    0x10(%esi),%ebp
+  80280f:	8b 76 0c             	mov    0xc(%esi),%esi
+  802812:	cd 30                	int    $0x30
+  802814:	87 34 24             	xchg   %esi,(%esp)
+  802817:	89 0e                	mov    %ecx,(%esi)
+  802819:	89 5e 04             	mov    %ebx,0x4(%esi)
+  80281c:	89 7e 08             	mov    %edi,0x8(%esi)
+  80281f:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802822:	8f 46 0c             	pop    0xc(%esi)
+  802825:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  802826:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  80282a:	74 0f                	je     80283b <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  80282c:	85 c0                	test   %eax,%eax
+  80282e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802833:	0f 48 d1             	cmovs  %ecx,%edx
+  802836:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  802839:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  80283b:	5b                   	pop    %ebx
+  80283c:	5e                   	pop    %esi
+  80283d:	5f                   	pop    %edi
+  80283e:	5d                   	pop    %ebp
+  80283f:	c3                   	ret
+
+00802840 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  802840:	55                   	push   %ebp
+  802841:	89 e5                	mov    %esp,%ebp
+  802843:	57                   	push   %edi
+  802844:	56                   	push   %esi
+  802845:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802846:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80284d:	78 2f                	js     80287e <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  80284f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802856:	74 72                	je     8028ca <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  802858:	8b 55 08             	mov    0x8(%ebp),%edx
+  80285b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802860:	b8 27 00 00 00       	mov    $0x27,%eax
+  802865:	89 cb                	mov    %ecx,%ebx
+  802867:	89 cf                	mov    %ecx,%edi
+  802869:	89 ce                	mov    %ecx,%esi
+  80286b:	55                   	push   %ebp
+  80286c:	68 75 28 80 00       	push   $0x802875
+  802871:	89 e5                	mov    %esp,%ebp
+  802873:	0f 34                	sysenter
+  802875:	83 c4 04             	add    $0x4,%esp
+  802878:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  802879:	5b                   	pop    %ebx
+  80287a:	5e                   	pop    %esi
+  80287b:	5f                   	pop    %edi
+  80287c:	5d                   	pop    %ebp
+  80287d:	c3                   	ret
+  80287e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802883:	0f a2                	cpuid
+		return 0;
+  802885:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80288a:	f6 c6 08             	test   $0x8,%dh
+  80288d:	74 15                	je     8028a4 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80288f:	89 c2                	mov    %eax,%edx
+  802891:	c1 ea 08             	shr    $0x8,%edx
+  802894:	83 e2 0f             	and    $0xf,%edx
+  802897:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80289c:	83 fa 06             	cmp    $0x6,%edx
+  80289f:	74 0e                	je     8028af <sys_sysring_setup+0x6f>
+  8028a1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8028a4:	0f b6 c9             	movzbl %cl,%ecx
+  8028a7:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8028ad:	eb a0                	jmp    80284f <sys_sysring_setup+0xf>
+  8028af:	89 c2                	mov    %eax,%edx
+  8028b1:	c1 ea 04             	shr    $0x4,%edx
+  8028b4:	83 e2 0f             	and    $0xf,%edx
+  8028b7:	83 fa 02             	cmp    $0x2,%edx
+  8028ba:	77 e5                	ja     8028a1 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  8028bc:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8028bf:	83 f8 02             	cmp    $0x2,%eax
+  8028c2:	0f 97 c1             	seta   %cl
+  8028c5:	0f b6 c9             	movzbl %cl,%ecx
+  8028c8:	eb d7                	jmp    8028a1 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  8028ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028cf:	b8 27 00 00 00       	mov    $0x27,%eax
+  8028d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8028d7:	89 cb                	mov    %ecx,%ebx
+  8028d9:	89 cf                	mov    %ecx,%edi
+  8028db:	89 ce                	mov    %ecx,%esi
+  8028dd:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  8028df:	eb 98                	jmp    802879 <sys_sysring_setup+0x39>
+
+008028e1 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  8028e1:	55                   	push   %ebp
+  8028e2:	89 e5                	mov    %esp,%ebp
+  8028e4:	57                   	push   %edi
+  8028e5:	56                   	push   %esi
+  8028e6:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8028e7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8028ee:	78 2e                	js     80291e <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  8028f0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8028f7:	74 71                	je     80296a <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  8028f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028fe:	b8 28 00 00 00       	mov    $0x28,%eax
+  802903:	89 d1                	mov    %edx,%ecx
+  802905:	89 d3                	mov    %edx,%ebx
+  802907:	89 d7                	mov    %edx,%edi
+  802909:	89 d6                	mov    %edx,%esi
+  80290b:	55                   	push   %ebp
+  80290c:	68 15 29 80 00       	push   $0x802915
+  802911:	89 e5                	mov    %esp,%ebp
+  802913:	0f 34                	sysenter
+  802915:	83 c4 04             	add    $0x4,%esp
+  802918:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  802919:	5b                   	pop    %ebx
+  80291a:	5e                   	pop    %esi
+  80291b:	5f                   	pop    %edi
+  80291c:	5d                   	pop    %ebp
+  80291d:	c3                   	ret
+  80291e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802923:	0f a2                	cpuid
+		return 0;
+  802925:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80292a:	f6 c6 08             	test   $0x8,%dh
+  80292d:	74 15                	je     802944 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80292f:	89 c2                	mov    %eax,%edx
+  802931:	c1 ea 08             	shr    $0x8,%edx
+  802934:	83 e2 0f             	and    $0xf,%edx
+  802937:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80293c:	83 fa 06             	cmp    $0x6,%edx
+  80293f:	74 0e                	je     80294f <sys_sysring_enter+0x6e>
+  802941:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802944:	0f b6 c9             	movzbl %cl,%ecx
+  802947:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80294d:	eb a1                	jmp    8028f0 <sys_sysring_enter+0xf>
+  80294f:	89 c2                	mov    %eax,%edx
+  802951:	c1 ea 04             	shr    $0x4,%edx
+  802954:	83 e2 0f             	and    $0xf,%edx
+  802957:	83 fa 02             	cmp    $0x2,%edx
+  80295a:	77 e5                	ja     802941 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  80295c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80295f:	83 f8 02             	cmp    $0x2,%eax
+  802962:	0f 97 c1             	seta   %cl
+  802965:	0f b6 c9             	movzbl %cl,%ecx
+  802968:	eb d7                	jmp    802941 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  80296a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80296f:	b8 28 00 00 00       	mov    $0x28,%eax
+  802974:	89 d1                	mov    %edx,%ecx
+  802976:	89 d3                	mov    %edx,%ebx
+  802978:	89 d7                	mov    %edx,%edi
+  80297a:	89 d6                	mov    %edx,%esi
+  80297c:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  80297e:	eb 99                	jmp    802919 <sys_sysring_enter+0x38>
+
+00802980 <pgfault>:
+// The kernel normally resolves these faults itself (page_fault_cow in
+// kern/trap.c); we only get here if it ran out of memory doing so.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802980:	55                   	push   %ebp
+  802981:	89 e5                	mov    %esp,%ebp
+  802983:	83 ec 08             	sub    $0x8,%esp
+  802986:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  802989:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  80298b:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  80298e:	f6 c2 02             	test   $0x2,%dl
+  802991:	74 40                	je     8029d3 <pgfault+0x53>
+  802993:	89 c1                	mov    %eax,%ecx
+  802995:	c1 e9 16             	shr    $0x16,%ecx
+  802998:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  80299f:	f6 c1 01             	test   $0x1,%cl
+  8029a2:	74 2f                	je     8029d3 <pgfault+0x53>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW))
+  8029a4:	89 c1                	mov    %eax,%ecx
+  8029a6:	c1 e9 0c             	shr    $0xc,%ecx
+  8029a9:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  8029b0:	f6 c5 08             	test   $0x8,%ch
+  8029b3:	74 1e                	je     8029d3 <pgfault+0x53>
+	// Replace the page with a private writable copy of itself.  The
+	// kernel allocates, copies and maps it in one system call, so no
+	// temporary mapping at PFTEMP is needed.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8029b5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r = sys_page_copy(0, addr, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  8029ba:	83 ec 0c             	sub    $0xc,%esp
+  8029bd:	6a 07                	push   $0x7
+  8029bf:	50                   	push   %eax
+  8029c0:	6a 00                	push   $0x0
+  8029c2:	50                   	push   %eax
+  8029c3:	6a 00                	push   $0x0
+  8029c5:	e8 85 eb ff ff       	call   80154f <sys_page_copy>
+  8029ca:	83 c4 20             	add    $0x20,%esp
+  8029cd:	85 c0                	test   %eax,%eax
+  8029cf:	78 18                	js     8029e9 <pgfault+0x69>
+		panic("pgfault: sys_page_copy: %e", r);
+}
+  8029d1:	c9                   	leave
+  8029d2:	c3                   	ret
+		panic("pgfault: va %08x err %x is not a copy-on-write write",
+  8029d3:	83 ec 0c             	sub    $0xc,%esp
+  8029d6:	52                   	push   %edx
+  8029d7:	50                   	push   %eax
+  8029d8:	68 24 36 80 00       	push   $0x803624
+  8029dd:	6a 1c                	push   $0x1c
+  8029df:	68 59 36 80 00       	push   $0x803659
+  8029e4:	e8 e1 d9 ff ff       	call   8003ca <_panic>
+		panic("pgfault: sys_page_copy: %e", r);
+  8029e9:	50                   	push   %eax
+  8029ea:	68 64 36 80 00       	push   $0x803664
+  8029ef:	6a 26                	push   $0x26
+  8029f1:	68 59 36 80 00       	push   $0x803659
+  8029f6:	e8 cf d9 ff ff       	call   8003ca <_panic>
+
+008029fb <ufork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+ufork(void)
+{
+  8029fb:	55                   	push   %ebp
+  8029fc:	89 e5                	mov    %esp,%ebp
+  8029fe:	57                   	push   %edi
+  8029ff:	56                   	push   %esi
+  802a00:	53                   	push   %ebx
+  802a01:	81 ec 38 04 00 00    	sub    $0x438,%esp
+	struct page_range vec[PAGE_VEC_MAX], *last;
+	uintptr_t va;
+	size_t n;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  802a07:	68 80 29 80 00       	push   $0x802980
+  802a0c:	e8 03 05 00 00       	call   802f14 <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  802a11:	b8 07 00 00 00       	mov    $0x7,%eax
+  802a16:	cd 30                	int    $0x30
+  802a18:	89 85 d4 fb ff ff    	mov    %eax,-0x42c(%ebp)
+
+	envid = sys_exofork();
+	if (envid < 0)
+  802a1e:	83 c4 10             	add    $0x10,%esp
+  802a21:	85 c0                	test   %eax,%eax
+  802a23:	0f 88 f2 01 00 00    	js     802c1b <ufork+0x220>
+		return 0;
+	}
+
+	// Copy every run of mapped pages below the exception stack, which
+	// must not be shared.
+	va = 0;
+  802a29:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  802a2e:	74 0b                	je     802a3b <ufork+0x40>
+  802a30:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  802a36:	e9 07 01 00 00       	jmp    802b42 <ufork+0x147>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  802a3b:	e8 22 e8 ff ff       	call   801262 <sys_getenvid>
+  802a40:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802a45:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802a4b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802a50:	a3 08 40 80 00       	mov    %eax,0x804008
+		return 0;
+  802a55:	e9 c1 01 00 00       	jmp    802c1b <ufork+0x220>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+		n = r;
+		last = &vec[n - 1];
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  802a5a:	83 ea 01             	sub    $0x1,%edx
+  802a5d:	89 c1                	mov    %eax,%ecx
+  802a5f:	c1 e1 04             	shl    $0x4,%ecx
+  802a62:	89 94 0d ec fd ff ff 	mov    %edx,-0x214(%ebp,%ecx,1)
+			n--;
+  802a69:	85 d2                	test   %edx,%edx
+  802a6b:	0f 44 f0             	cmove  %eax,%esi
+  802a6e:	e9 12 01 00 00       	jmp    802b85 <ufork+0x18a>
+	for (i = 0; i < n; i++) {
+  802a73:	83 c1 01             	add    $0x1,%ecx
+  802a76:	83 c0 10             	add    $0x10,%eax
+  802a79:	39 8d e4 fb ff ff    	cmp    %ecx,-0x41c(%ebp)
+  802a7f:	74 6a                	je     802aeb <ufork+0xf0>
+		vec[i].pr_dstva = vec[i].pr_va;
+  802a81:	89 c3                	mov    %eax,%ebx
+  802a83:	8b 10                	mov    (%eax),%edx
+  802a85:	89 50 0c             	mov    %edx,0xc(%eax)
+		if (vec[i].pr_perm & PTE_SHARE)
+  802a88:	8b 50 08             	mov    0x8(%eax),%edx
+  802a8b:	f6 c6 04             	test   $0x4,%dh
+  802a8e:	75 e3                	jne    802a73 <ufork+0x78>
+		if (vec[i].pr_perm & (PTE_W | PTE_COW)) {
+  802a90:	f7 c2 02 08 00 00    	test   $0x802,%edx
+  802a96:	74 db                	je     802a73 <ufork+0x78>
+			vec[i].pr_perm = (vec[i].pr_perm & ~PTE_W) | PTE_COW;
+  802a98:	81 e2 fd f7 ff ff    	and    $0xfffff7fd,%edx
+  802a9e:	80 ce 08             	or     $0x8,%dh
+  802aa1:	89 95 dc fb ff ff    	mov    %edx,-0x424(%ebp)
+  802aa7:	89 53 08             	mov    %edx,0x8(%ebx)
+			cow[ncow++] = vec[i];
+  802aaa:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  802ab0:	c1 e6 04             	shl    $0x4,%esi
+  802ab3:	89 f2                	mov    %esi,%edx
+  802ab5:	8d b4 35 e8 fb ff ff 	lea    -0x418(%ebp,%esi,1),%esi
+  802abc:	8b 38                	mov    (%eax),%edi
+  802abe:	89 bc 15 e8 fb ff ff 	mov    %edi,-0x418(%ebp,%edx,1)
+  802ac5:	8b 78 04             	mov    0x4(%eax),%edi
+  802ac8:	89 7e 04             	mov    %edi,0x4(%esi)
+  802acb:	8b bd dc fb ff ff    	mov    -0x424(%ebp),%edi
+  802ad1:	89 7e 08             	mov    %edi,0x8(%esi)
+  802ad4:	8b 50 0c             	mov    0xc(%eax),%edx
+  802ad7:	89 56 0c             	mov    %edx,0xc(%esi)
+  802ada:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  802ae0:	8d 7e 01             	lea    0x1(%esi),%edi
+  802ae3:	89 bd e0 fb ff ff    	mov    %edi,-0x420(%ebp)
+  802ae9:	eb 88                	jmp    802a73 <ufork+0x78>
+	if ((r = sys_page_map_vec(0, envid, vec, n, 0)) < 0)
+  802aeb:	8b b5 e4 fb ff ff    	mov    -0x41c(%ebp),%esi
+  802af1:	8b bd d8 fb ff ff    	mov    -0x428(%ebp),%edi
+  802af7:	83 ec 0c             	sub    $0xc,%esp
+  802afa:	6a 00                	push   $0x0
+  802afc:	56                   	push   %esi
+  802afd:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802b03:	50                   	push   %eax
+  802b04:	ff b5 d4 fb ff ff    	push   -0x42c(%ebp)
+  802b0a:	6a 00                	push   $0x0
+  802b0c:	e8 80 f4 ff ff       	call   801f91 <sys_page_map_vec>
+  802b11:	83 c4 20             	add    $0x20,%esp
+  802b14:	85 c0                	test   %eax,%eax
+  802b16:	0f 88 e5 00 00 00    	js     802c01 <ufork+0x206>
+	return sys_page_map_vec(0, 0, cow, ncow, 0);
+  802b1c:	83 ec 0c             	sub    $0xc,%esp
+  802b1f:	6a 00                	push   $0x0
+  802b21:	ff b5 e0 fb ff ff    	push   -0x420(%ebp)
+  802b27:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  802b2d:	50                   	push   %eax
+  802b2e:	6a 00                	push   $0x0
+  802b30:	6a 00                	push   $0x0
+  802b32:	e8 5a f4 ff ff       	call   801f91 <sys_page_map_vec>
+		if ((r = duppages(envid, vec, n)) < 0)
+  802b37:	83 c4 20             	add    $0x20,%esp
+  802b3a:	85 c0                	test   %eax,%eax
+  802b3c:	0f 88 e7 00 00 00    	js     802c29 <ufork+0x22e>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+  802b42:	6a 20                	push   $0x20
+  802b44:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802b4a:	50                   	push   %eax
+  802b4b:	57                   	push   %edi
+  802b4c:	6a 00                	push   $0x0
+  802b4e:	e8 82 f4 ff ff       	call   801fd5 <sys_vm_ranges>
+  802b53:	83 c4 10             	add    $0x10,%esp
+  802b56:	85 c0                	test   %eax,%eax
+  802b58:	7e 51                	jle    802bab <ufork+0x1b0>
+		n = r;
+  802b5a:	89 c6                	mov    %eax,%esi
+		last = &vec[n - 1];
+  802b5c:	83 e8 01             	sub    $0x1,%eax
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+  802b5f:	89 c1                	mov    %eax,%ecx
+  802b61:	c1 e1 04             	shl    $0x4,%ecx
+  802b64:	8b 94 0d ec fd ff ff 	mov    -0x214(%ebp,%ecx,1),%edx
+  802b6b:	89 d3                	mov    %edx,%ebx
+  802b6d:	c1 e3 0c             	shl    $0xc,%ebx
+  802b70:	89 df                	mov    %ebx,%edi
+  802b72:	03 bc 0d e8 fd ff ff 	add    -0x218(%ebp,%ecx,1),%edi
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  802b79:	81 ff 00 00 c0 ee    	cmp    $0xeec00000,%edi
+  802b7f:	0f 84 d5 fe ff ff    	je     802a5a <ufork+0x5f>
+	for (i = 0; i < n; i++) {
+  802b85:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+	size_t i, ncow = 0;
+  802b8b:	c7 85 e0 fb ff ff 00 	movl   $0x0,-0x420(%ebp)
+  802b92:	00 00 00 
+	for (i = 0; i < n; i++) {
+  802b95:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b9a:	89 bd d8 fb ff ff    	mov    %edi,-0x428(%ebp)
+  802ba0:	89 b5 e4 fb ff ff    	mov    %esi,-0x41c(%ebp)
+  802ba6:	e9 ce fe ff ff       	jmp    802a79 <ufork+0x7e>
+			goto fail;
+	}
+	if (r < 0)
+  802bab:	89 c6                	mov    %eax,%esi
+  802bad:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  802bb3:	85 c0                	test   %eax,%eax
+  802bb5:	78 52                	js     802c09 <ufork+0x20e>
+		goto fail;
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE),
+  802bb7:	83 ec 04             	sub    $0x4,%esp
+  802bba:	6a 07                	push   $0x7
+  802bbc:	68 00 f0 bf ee       	push   $0xeebff000
+  802bc1:	53                   	push   %ebx
+  802bc2:	e8 3a e7 ff ff       	call   801301 <sys_page_alloc>
+  802bc7:	89 c6                	mov    %eax,%esi
+  802bc9:	83 c4 10             	add    $0x10,%esp
+  802bcc:	85 c0                	test   %eax,%eax
+  802bce:	78 39                	js     802c09 <ufork+0x20e>
+				PTE_P | PTE_U | PTE_W)) < 0
+	    || (r = sys_env_set_pgfault_upcall(envid,
+			thisenv->env_pgfault_upcall)) < 0
+  802bd0:	a1 08 40 80 00       	mov    0x804008,%eax
+  802bd5:	8b 40 74             	mov    0x74(%eax),%eax
+	    || (r = sys_env_set_pgfault_upcall(envid,
+  802bd8:	83 ec 08             	sub    $0x8,%esp
+  802bdb:	50                   	push   %eax
+  802bdc:	53                   	push   %ebx
+  802bdd:	e8 de ed ff ff       	call   8019c0 <sys_env_set_pgfault_upcall>
+  802be2:	89 c6                	mov    %eax,%esi
+  802be4:	83 c4 10             	add    $0x10,%esp
+  802be7:	85 c0                	test   %eax,%eax
+  802be9:	78 1e                	js     802c09 <ufork+0x20e>
+	    || (r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  802beb:	83 ec 08             	sub    $0x8,%esp
+  802bee:	6a 02                	push   $0x2
+  802bf0:	53                   	push   %ebx
+  802bf1:	e8 bc ea ff ff       	call   8016b2 <sys_env_set_status>
+  802bf6:	89 c6                	mov    %eax,%esi
+  802bf8:	83 c4 10             	add    $0x10,%esp
+  802bfb:	85 c0                	test   %eax,%eax
+  802bfd:	79 1c                	jns    802c1b <ufork+0x220>
+  802bff:	eb 08                	jmp    802c09 <ufork+0x20e>
+  802c01:	89 c6                	mov    %eax,%esi
+  802c03:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+		goto fail;
+	return envid;
+
+fail:
+	sys_env_destroy(envid);
+  802c09:	83 ec 0c             	sub    $0xc,%esp
+  802c0c:	53                   	push   %ebx
+  802c0d:	e8 8e e5 ff ff       	call   8011a0 <sys_env_destroy>
+	return r;
+  802c12:	83 c4 10             	add    $0x10,%esp
+  802c15:	89 b5 d4 fb ff ff    	mov    %esi,-0x42c(%ebp)
+}
+  802c1b:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+  802c21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c24:	5b                   	pop    %ebx
+  802c25:	5e                   	pop    %esi
+  802c26:	5f                   	pop    %edi
+  802c27:	5d                   	pop    %ebp
+  802c28:	c3                   	ret
+  802c29:	89 c6                	mov    %eax,%esi
+  802c2b:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  802c31:	eb d6                	jmp    802c09 <ufork+0x20e>
+
+00802c33 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  802c33:	55                   	push   %ebp
+  802c34:	89 e5                	mov    %esp,%ebp
+  802c36:	53                   	push   %ebx
+  802c37:	83 ec 04             	sub    $0x4,%esp
+	envid_t envid;
+
+	envid = sys_fork();
+  802c3a:	e8 90 f2 ff ff       	call   801ecf <sys_fork>
+  802c3f:	89 c3                	mov    %eax,%ebx
+	if (envid == 0)
+  802c41:	85 c0                	test   %eax,%eax
+  802c43:	74 07                	je     802c4c <fork+0x19>
+		thisenv = &envs[ENVX(sys_getenvid())];
+	return envid;
+}
+  802c45:	89 d8                	mov    %ebx,%eax
+  802c47:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c4a:	c9                   	leave
+  802c4b:	c3                   	ret
+		thisenv = &envs[ENVX(sys_getenvid())];
+  802c4c:	e8 11 e6 ff ff       	call   801262 <sys_getenvid>
+  802c51:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802c56:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802c5c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802c61:	a3 08 40 80 00       	mov    %eax,0x804008
+	return envid;
+  802c66:	eb dd                	jmp    802c45 <fork+0x12>
+
+00802c68 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  802c68:	55                   	push   %ebp
+  802c69:	89 e5                	mov    %esp,%ebp
+  802c6b:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  802c6e:	68 7f 36 80 00       	push   $0x80367f
+  802c73:	68 a1 00 00 00       	push   $0xa1
+  802c78:	68 59 36 80 00       	push   $0x803659
+  802c7d:	e8 48 d7 ff ff       	call   8003ca <_panic>
+
+00802c82 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802c82:	55                   	push   %ebp
+  802c83:	89 e5                	mov    %esp,%ebp
+  802c85:	56                   	push   %esi
+  802c86:	53                   	push   %ebx
+  802c87:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c8a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c8d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if ((r = sys_ipc_recv(pg ? pg : (void *) UTOP)) < 0) {
+  802c90:	85 c0                	test   %eax,%eax
+  802c92:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802c97:	0f 44 c2             	cmove  %edx,%eax
+  802c9a:	83 ec 0c             	sub    $0xc,%esp
+  802c9d:	50                   	push   %eax
+  802c9e:	e8 2f ef ff ff       	call   801bd2 <sys_ipc_recv>
+  802ca3:	83 c4 10             	add    $0x10,%esp
+  802ca6:	85 c0                	test   %eax,%eax
+  802ca8:	78 34                	js     802cde <ipc_recv+0x5c>
+			*from_env_store = 0;
+		if (perm_store)
+			*perm_store = 0;
+		return r;
+	}
+	if (from_env_store)
+  802caa:	85 f6                	test   %esi,%esi
+  802cac:	74 0d                	je     802cbb <ipc_recv+0x39>
+		*from_env_store = thisenv->env_ipc_from;
+  802cae:	a1 08 40 80 00       	mov    0x804008,%eax
+  802cb3:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  802cb9:	89 06                	mov    %eax,(%esi)
+	if (perm_store)
+  802cbb:	85 db                	test   %ebx,%ebx
+  802cbd:	74 0d                	je     802ccc <ipc_recv+0x4a>
+		*perm_store = thisenv->env_ipc_perm;
+  802cbf:	a1 08 40 80 00       	mov    0x804008,%eax
+  802cc4:	8b 80 9c 00 00 00    	mov    0x9c(%eax),%eax
+  802cca:	89 03                	mov    %eax,(%ebx)
+	return thisenv->env_ipc_msg.m_w[0];
+  802ccc:	a1 08 40 80 00       	mov    0x804008,%eax
+  802cd1:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802cd7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cda:	5b                   	pop    %ebx
+  802cdb:	5e                   	pop    %esi
+  802cdc:	5d                   	pop    %ebp
+  802cdd:	c3                   	ret
+		if (from_env_store)
+  802cde:	85 f6                	test   %esi,%esi
+  802ce0:	74 06                	je     802ce8 <ipc_recv+0x66>
+			*from_env_store = 0;
+  802ce2:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802ce8:	85 db                	test   %ebx,%ebx
+  802cea:	74 eb                	je     802cd7 <ipc_recv+0x55>
+			*perm_store = 0;
+  802cec:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802cf2:	eb e3                	jmp    802cd7 <ipc_recv+0x55>
+
+00802cf4 <ipc_send>:
+//
+// The kernel queues us behind any other senders until 'toenv'
+// receives, so we only come back to retry if its queue was full.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802cf4:	55                   	push   %ebp
+  802cf5:	89 e5                	mov    %esp,%ebp
+  802cf7:	57                   	push   %edi
+  802cf8:	56                   	push   %esi
+  802cf9:	53                   	push   %ebx
+  802cfa:	83 ec 0c             	sub    $0xc,%esp
+  802cfd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d00:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802d03:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_send(to_env, val, pg ? pg : (void *) UTOP, perm))
+  802d06:	85 db                	test   %ebx,%ebx
+  802d08:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802d0d:	0f 44 d8             	cmove  %eax,%ebx
+  802d10:	eb 05                	jmp    802d17 <ipc_send+0x23>
+	       == -E_AGAIN)
+		sys_yield();
+  802d12:	e8 fc e8 ff ff       	call   801613 <sys_yield>
+	while ((r = sys_ipc_send(to_env, val, pg ? pg : (void *) UTOP, perm))
+  802d17:	ff 75 14             	push   0x14(%ebp)
+  802d1a:	53                   	push   %ebx
+  802d1b:	56                   	push   %esi
+  802d1c:	57                   	push   %edi
+  802d1d:	e8 09 ee ff ff       	call   801b2b <sys_ipc_send>
+	       == -E_AGAIN)
+  802d22:	83 c4 10             	add    $0x10,%esp
+  802d25:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802d28:	74 e8                	je     802d12 <ipc_send+0x1e>
+	if (r < 0)
+  802d2a:	85 c0                	test   %eax,%eax
+  802d2c:	78 08                	js     802d36 <ipc_send+0x42>
+		panic("ipc_send: %e", r);
+}
+  802d2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d31:	5b                   	pop    %ebx
+  802d32:	5e                   	pop    %esi
+  802d33:	5f                   	pop    %edi
+  802d34:	5d                   	pop    %ebp
+  802d35:	c3                   	ret
+		panic("ipc_send: %e", r);
+  802d36:	50                   	push   %eax
+  802d37:	68 95 36 80 00       	push   $0x803695
+  802d3c:	6a 3a                	push   $0x3a
+  802d3e:	68 a2 36 80 00       	push   $0x8036a2
+  802d43:	e8 82 d6 ff ff       	call   8003ca <_panic>
+
+00802d48 <ipc_send_range>:
+
+// Like ipc_send, but send the 'npages' contiguous pages at 'pg' in one
+// message.  The receiver maps as many as fit in its window.
+void
+ipc_send_range(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  802d48:	55                   	push   %ebp
+  802d49:	89 e5                	mov    %esp,%ebp
+  802d4b:	57                   	push   %edi
+  802d4c:	56                   	push   %esi
+  802d4d:	53                   	push   %ebx
+  802d4e:	83 ec 0c             	sub    $0xc,%esp
+  802d51:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d54:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802d57:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_send_range(to_env, val, pg, npages, perm))
+  802d5a:	eb 05                	jmp    802d61 <ipc_send_range+0x19>
+	       == -E_AGAIN)
+		sys_yield();
+  802d5c:	e8 b2 e8 ff ff       	call   801613 <sys_yield>
+	while ((r = sys_ipc_send_range(to_env, val, pg, npages, perm))
+  802d61:	83 ec 0c             	sub    $0xc,%esp
+  802d64:	ff 75 18             	push   0x18(%ebp)
+  802d67:	ff 75 14             	push   0x14(%ebp)
+  802d6a:	53                   	push   %ebx
+  802d6b:	56                   	push   %esi
+  802d6c:	57                   	push   %edi
+  802d6d:	e8 22 ef ff ff       	call   801c94 <sys_ipc_send_range>
+	       == -E_AGAIN)
+  802d72:	83 c4 20             	add    $0x20,%esp
+  802d75:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802d78:	74 e2                	je     802d5c <ipc_send_range+0x14>
+	if (r < 0)
+  802d7a:	85 c0                	test   %eax,%eax
+  802d7c:	78 08                	js     802d86 <ipc_send_range+0x3e>
+		panic("ipc_send_range: %e", r);
+}
+  802d7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d81:	5b                   	pop    %ebx
+  802d82:	5e                   	pop    %esi
+  802d83:	5f                   	pop    %edi
+  802d84:	5d                   	pop    %ebp
+  802d85:	c3                   	ret
+		panic("ipc_send_range: %e", r);
+  802d86:	50                   	push   %eax
+  802d87:	68 ac 36 80 00       	push   $0x8036ac
+  802d8c:	6a 48                	push   $0x48
+  802d8e:	68 a2 36 80 00       	push   $0x8036a2
+  802d93:	e8 32 d6 ff ff       	call   8003ca <_panic>
+
+00802d98 <ipc_recv_range>:
+// (which must not be null).  On return *npages holds the number of
+// pages received, which is 0 on error or if the sender sent none.
+int32_t
+ipc_recv_range(envid_t *from_env_store, void *pg, size_t *npages,
+	       int *perm_store)
+{
+  802d98:	55                   	push   %ebp
+  802d99:	89 e5                	mov    %esp,%ebp
+  802d9b:	57                   	push   %edi
+  802d9c:	56                   	push   %esi
+  802d9d:	53                   	push   %ebx
+  802d9e:	83 ec 14             	sub    $0x14,%esp
+  802da1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802da4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802da7:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if ((r = sys_ipc_recv_range(pg, *npages)) < 0) {
+  802daa:	ff 33                	push   (%ebx)
+  802dac:	ff 75 0c             	push   0xc(%ebp)
+  802daf:	e8 83 ef ff ff       	call   801d37 <sys_ipc_recv_range>
+  802db4:	83 c4 10             	add    $0x10,%esp
+  802db7:	85 c0                	test   %eax,%eax
+  802db9:	78 42                	js     802dfd <ipc_recv_range+0x65>
+		if (perm_store)
+			*perm_store = 0;
+		*npages = 0;
+		return r;
+	}
+	if (from_env_store)
+  802dbb:	85 ff                	test   %edi,%edi
+  802dbd:	74 0d                	je     802dcc <ipc_recv_range+0x34>
+		*from_env_store = thisenv->env_ipc_from;
+  802dbf:	a1 08 40 80 00       	mov    0x804008,%eax
+  802dc4:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  802dca:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  802dcc:	85 f6                	test   %esi,%esi
+  802dce:	74 0d                	je     802ddd <ipc_recv_range+0x45>
+		*perm_store = thisenv->env_ipc_perm;
+  802dd0:	a1 08 40 80 00       	mov    0x804008,%eax
+  802dd5:	8b 80 9c 00 00 00    	mov    0x9c(%eax),%eax
+  802ddb:	89 06                	mov    %eax,(%esi)
+	*npages = thisenv->env_ipc_npages;
+  802ddd:	a1 08 40 80 00       	mov    0x804008,%eax
+  802de2:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802de8:	89 03                	mov    %eax,(%ebx)
+	return thisenv->env_ipc_msg.m_w[0];
+  802dea:	a1 08 40 80 00       	mov    0x804008,%eax
+  802def:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802df5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802df8:	5b                   	pop    %ebx
+  802df9:	5e                   	pop    %esi
+  802dfa:	5f                   	pop    %edi
+  802dfb:	5d                   	pop    %ebp
+  802dfc:	c3                   	ret
+		if (from_env_store)
+  802dfd:	85 ff                	test   %edi,%edi
+  802dff:	74 06                	je     802e07 <ipc_recv_range+0x6f>
+			*from_env_store = 0;
+  802e01:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  802e07:	85 f6                	test   %esi,%esi
+  802e09:	74 06                	je     802e11 <ipc_recv_range+0x79>
+			*perm_store = 0;
+  802e0b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		*npages = 0;
+  802e11:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		return r;
+  802e17:	eb dc                	jmp    802df5 <ipc_recv_range+0x5d>
+
+00802e19 <ipc_send_msg>:
+// Send the IPC_MSG_WORDS words of 'msg' to 'to_env', in registers and
+// without a page.  Waits like ipc_send until 'to_env' takes them, and
+// panics on any error other than -E_AGAIN.
+void
+ipc_send_msg(envid_t to_env, const struct ipc_msg *msg)
+{
+  802e19:	55                   	push   %ebp
+  802e1a:	89 e5                	mov    %esp,%ebp
+  802e1c:	56                   	push   %esi
+  802e1d:	53                   	push   %ebx
+  802e1e:	8b 75 08             	mov    0x8(%ebp),%esi
+  802e21:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_send_msg(to_env, msg)) == -E_AGAIN)
+  802e24:	eb 05                	jmp    802e2b <ipc_send_msg+0x12>
+		sys_yield();
+  802e26:	e8 e8 e7 ff ff       	call   801613 <sys_yield>
+	while ((r = sys_ipc_send_msg(to_env, msg)) == -E_AGAIN)
+  802e2b:	83 ec 08             	sub    $0x8,%esp
+  802e2e:	53                   	push   %ebx
+  802e2f:	56                   	push   %esi
+  802e30:	e8 3a f0 ff ff       	call   801e6f <sys_ipc_send_msg>
+  802e35:	83 c4 10             	add    $0x10,%esp
+  802e38:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802e3b:	74 e9                	je     802e26 <ipc_send_msg+0xd>
+	if (r < 0)
+  802e3d:	85 c0                	test   %eax,%eax
+  802e3f:	78 07                	js     802e48 <ipc_send_msg+0x2f>
+		panic("ipc_send_msg: %e", r);
+}
+  802e41:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e44:	5b                   	pop    %ebx
+  802e45:	5e                   	pop    %esi
+  802e46:	5d                   	pop    %ebp
+  802e47:	c3                   	ret
+		panic("ipc_send_msg: %e", r);
+  802e48:	50                   	push   %eax
+  802e49:	68 bf 36 80 00       	push   $0x8036bf
+  802e4e:	6a 6f                	push   $0x6f
+  802e50:	68 a2 36 80 00       	push   $0x8036a2
+  802e55:	e8 70 d5 ff ff       	call   8003ca <_panic>
+
+00802e5a <ipc_recv_msg>:
+// ipc_call or plain ipc_send (whose value is word 0, and whose page is
+// not taken), it arrives in registers and needs no page.
+// Returns the sender's envid, < 0 on error.
+envid_t
+ipc_recv_msg(struct ipc_msg *msg)
+{
+  802e5a:	55                   	push   %ebp
+  802e5b:	89 e5                	mov    %esp,%ebp
+  802e5d:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_reply_wait(0, msg);
+  802e60:	ff 75 08             	push   0x8(%ebp)
+  802e63:	6a 00                	push   $0x0
+  802e65:	e8 cb ef ff ff       	call   801e35 <sys_ipc_reply_wait>
+}
+  802e6a:	c9                   	leave
+  802e6b:	c3                   	ret
+
+00802e6c <ipc_call>:
+// ipc_reply_wait (or ipc_recv), and straight back when it replies.
+// Retries while to_env's queue is full.
+// Returns 0 on success, < 0 on error.
+int
+ipc_call(envid_t to_env, struct ipc_msg *msg)
+{
+  802e6c:	55                   	push   %ebp
+  802e6d:	89 e5                	mov    %esp,%ebp
+  802e6f:	56                   	push   %esi
+  802e70:	53                   	push   %ebx
+  802e71:	8b 75 08             	mov    0x8(%ebp),%esi
+  802e74:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_call(to_env, msg)) == -E_AGAIN)
+  802e77:	eb 05                	jmp    802e7e <ipc_call+0x12>
+		sys_yield();
+  802e79:	e8 95 e7 ff ff       	call   801613 <sys_yield>
+	while ((r = sys_ipc_call(to_env, msg)) == -E_AGAIN)
+  802e7e:	83 ec 08             	sub    $0x8,%esp
+  802e81:	53                   	push   %ebx
+  802e82:	56                   	push   %esi
+  802e83:	e8 73 ef ff ff       	call   801dfb <sys_ipc_call>
+  802e88:	83 c4 10             	add    $0x10,%esp
+  802e8b:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802e8e:	74 e9                	je     802e79 <ipc_call+0xd>
+	return r;
+}
+  802e90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e93:	5b                   	pop    %ebx
+  802e94:	5e                   	pop    %esi
+  802e95:	5d                   	pop    %ebp
+  802e96:	c3                   	ret
+
+00802e97 <ipc_reply_wait>:
+//	}
+//
+// Returns the envid of the sender, < 0 on error.
+envid_t
+ipc_reply_wait(envid_t to_env, struct ipc_msg *msg)
+{
+  802e97:	55                   	push   %ebp
+  802e98:	89 e5                	mov    %esp,%ebp
+  802e9a:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_reply_wait(to_env, msg);
+  802e9d:	ff 75 0c             	push   0xc(%ebp)
+  802ea0:	ff 75 08             	push   0x8(%ebp)
+  802ea3:	e8 8d ef ff ff       	call   801e35 <sys_ipc_reply_wait>
+}
+  802ea8:	c9                   	leave
+  802ea9:	c3                   	ret
+
+00802eaa <ep_send>:
+
+// Send 'msg' to endpoint 'epid', waiting while its queue is full.
+// Returns 0 on success, < 0 if the endpoint is gone or not ours to use.
+int
+ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  802eaa:	55                   	push   %ebp
+  802eab:	89 e5                	mov    %esp,%ebp
+  802ead:	56                   	push   %esi
+  802eae:	53                   	push   %ebx
+  802eaf:	8b 75 08             	mov    0x8(%ebp),%esi
+  802eb2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ep_send(epid, msg)) == -E_AGAIN)
+  802eb5:	eb 05                	jmp    802ebc <ep_send+0x12>
+		sys_yield();
+  802eb7:	e8 57 e7 ff ff       	call   801613 <sys_yield>
+	while ((r = sys_ep_send(epid, msg)) == -E_AGAIN)
+  802ebc:	83 ec 08             	sub    $0x8,%esp
+  802ebf:	53                   	push   %ebx
+  802ec0:	56                   	push   %esi
+  802ec1:	e8 c6 f8 ff ff       	call   80278c <sys_ep_send>
+  802ec6:	83 c4 10             	add    $0x10,%esp
+  802ec9:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802ecc:	74 e9                	je     802eb7 <ep_send+0xd>
+	return r;
+}
+  802ece:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ed1:	5b                   	pop    %ebx
+  802ed2:	5e                   	pop    %esi
+  802ed3:	5d                   	pop    %ebp
+  802ed4:	c3                   	ret
+
+00802ed5 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802ed5:	55                   	push   %ebp
+  802ed6:	89 e5                	mov    %esp,%ebp
+  802ed8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802edb:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802ee0:	69 d0 68 01 00 00    	imul   $0x168,%eax,%edx
+  802ee6:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802eec:	8b 52 50             	mov    0x50(%edx),%edx
+  802eef:	39 ca                	cmp    %ecx,%edx
+  802ef1:	74 11                	je     802f04 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802ef3:	83 c0 01             	add    $0x1,%eax
+  802ef6:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802efb:	75 e3                	jne    802ee0 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802efd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f02:	eb 0e                	jmp    802f12 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802f04:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802f0a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802f0f:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802f12:	5d                   	pop    %ebp
+  802f13:	c3                   	ret
+
+00802f14 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802f14:	55                   	push   %ebp
+  802f15:	89 e5                	mov    %esp,%ebp
+  802f17:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  802f1a:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  802f21:	74 0a                	je     802f2d <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  802f23:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f26:	a3 0c 40 80 00       	mov    %eax,0x80400c
+}
+  802f2b:	c9                   	leave
+  802f2c:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE),
+  802f2d:	83 ec 04             	sub    $0x4,%esp
+  802f30:	6a 07                	push   $0x7
+  802f32:	68 00 f0 bf ee       	push   $0xeebff000
+  802f37:	6a 00                	push   $0x0
+  802f39:	e8 c3 e3 ff ff       	call   801301 <sys_page_alloc>
+  802f3e:	83 c4 10             	add    $0x10,%esp
+  802f41:	85 c0                	test   %eax,%eax
+  802f43:	78 28                	js     802f6d <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  802f45:	83 ec 08             	sub    $0x8,%esp
+  802f48:	68 7f 2f 80 00       	push   $0x802f7f
+  802f4d:	6a 00                	push   $0x0
+  802f4f:	e8 6c ea ff ff       	call   8019c0 <sys_env_set_pgfault_upcall>
+  802f54:	83 c4 10             	add    $0x10,%esp
+  802f57:	85 c0                	test   %eax,%eax
+  802f59:	79 c8                	jns    802f23 <set_pgfault_handler+0xf>
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+  802f5b:	50                   	push   %eax
+  802f5c:	68 f8 36 80 00       	push   $0x8036f8
+  802f61:	6a 24                	push   $0x24
+  802f63:	68 2c 37 80 00       	push   $0x80372c
+  802f68:	e8 5d d4 ff ff       	call   8003ca <_panic>
+			panic("set_pgfault_handler: sys_page_alloc: %e", r);
+  802f6d:	50                   	push   %eax
+  802f6e:	68 d0 36 80 00       	push   $0x8036d0
+  802f73:	6a 22                	push   $0x22
+  802f75:	68 2c 37 80 00       	push   $0x80372c
+  802f7a:	e8 4b d4 ff ff       	call   8003ca <_panic>
+
+00802f7f <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802f7f:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802f80:	a1 0c 40 80 00       	mov    0x80400c,%eax
+	call *%eax
+  802f85:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802f87:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 0x28(%esp), %ebx		// trap-time eip
+  802f8a:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl 0x30(%esp), %eax		// trap-time esp
+  802f8e:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  802f92:	83 e8 04             	sub    $0x4,%eax
+	movl %ebx, (%eax)
+  802f95:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 0x30(%esp)
+  802f97:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp			// skip fault_va and err
+  802f9b:	83 c4 08             	add    $0x8,%esp
+	popal
+  802f9e:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp			// skip eip
+  802f9f:	83 c4 04             	add    $0x4,%esp
+	popfl
+  802fa2:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802fa3:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802fa4:	c3                   	ret
+
+00802fa5 <dm>:
+  802fa5:	55                   	push   %ebp
+  802fa6:	57                   	push   %edi
+  802fa7:	56                   	push   %esi
+  802fa8:	53                   	push   %ebx
+  802fa9:	83 ec 24             	sub    $0x24,%esp
+  802fac:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802fb0:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802fb4:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802fb8:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802fbc:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802fc0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802fc4:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802fc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fcd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fd2:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802fd7:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802fde:	00 
+  802fdf:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802fe6:	00 
+  802fe7:	89 fb                	mov    %edi,%ebx
+  802fe9:	eb 08                	jmp    802ff3 <dm+0x4e>
+  802feb:	83 e9 01             	sub    $0x1,%ecx
+  802fee:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802ff1:	74 68                	je     80305b <dm+0xb6>
+  802ff3:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802ff7:	01 c0                	add    %eax,%eax
+  802ff9:	89 c6                	mov    %eax,%esi
+  802ffb:	89 d7                	mov    %edx,%edi
+  802ffd:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803001:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803005:	0f ad d0             	shrd   %cl,%edx,%eax
+  803008:	d3 ea                	shr    %cl,%edx
+  80300a:	f6 c1 20             	test   $0x20,%cl
+  80300d:	74 04                	je     803013 <dm+0x6e>
+  80300f:	89 d0                	mov    %edx,%eax
+  803011:	31 d2                	xor    %edx,%edx
+  803013:	83 e0 01             	and    $0x1,%eax
+  803016:	89 04 24             	mov    %eax,(%esp)
+  803019:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803020:	00 
+  803021:	8b 04 24             	mov    (%esp),%eax
+  803024:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803028:	09 f0                	or     %esi,%eax
+  80302a:	09 fa                	or     %edi,%edx
+  80302c:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803030:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803034:	39 f0                	cmp    %esi,%eax
+  803036:	89 d5                	mov    %edx,%ebp
+  803038:	19 fd                	sbb    %edi,%ebp
+  80303a:	72 af                	jb     802feb <dm+0x46>
+  80303c:	29 f0                	sub    %esi,%eax
+  80303e:	19 fa                	sbb    %edi,%edx
+  803040:	89 cf                	mov    %ecx,%edi
+  803042:	c1 ef 05             	shr    $0x5,%edi
+  803045:	83 e7 01             	and    $0x1,%edi
+  803048:	89 fe                	mov    %edi,%esi
+  80304a:	83 f6 01             	xor    $0x1,%esi
+  80304d:	d3 e6                	shl    %cl,%esi
+  80304f:	d3 e7                	shl    %cl,%edi
+  803051:	09 74 24 18          	or     %esi,0x18(%esp)
+  803055:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803059:	eb 90                	jmp    802feb <dm+0x46>
+  80305b:	85 db                	test   %ebx,%ebx
+  80305d:	74 05                	je     803064 <dm+0xbf>
+  80305f:	89 03                	mov    %eax,(%ebx)
+  803061:	89 53 04             	mov    %edx,0x4(%ebx)
+  803064:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803068:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80306c:	83 c4 24             	add    $0x24,%esp
+  80306f:	5b                   	pop    %ebx
+  803070:	5e                   	pop    %esi
+  803071:	5f                   	pop    %edi
+  803072:	5d                   	pop    %ebp
+  803073:	c3                   	ret
+
+00803074 <__udivdi3>:
+  803074:	83 ec 08             	sub    $0x8,%esp
+  803077:	6a 00                	push   $0x0
+  803079:	ff 74 24 1c          	push   0x1c(%esp)
+  80307d:	ff 74 24 1c          	push   0x1c(%esp)
+  803081:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803085:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803089:	e8 17 ff ff ff       	call   802fa5 <dm>
+  80308e:	83 c4 14             	add    $0x14,%esp
+  803091:	c3                   	ret
+
+00803092 <__umoddi3>:
+  803092:	83 ec 18             	sub    $0x18,%esp
+  803095:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803099:	50                   	push   %eax
+  80309a:	ff 74 24 2c          	push   0x2c(%esp)
+  80309e:	ff 74 24 2c          	push   0x2c(%esp)
+  8030a2:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8030a6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8030aa:	e8 f6 fe ff ff       	call   802fa5 <dm>
+  8030af:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8030b3:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8030b7:	83 c4 24             	add    $0x24,%esp
+  8030ba:	c3                   	ret
+
+008030bb <__divdi3>:
+  8030bb:	53                   	push   %ebx
+  8030bc:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8030c0:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8030c4:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8030c8:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8030cc:	85 d2                	test   %edx,%edx
+  8030ce:	78 15                	js     8030e5 <__divdi3+0x2a>
+  8030d0:	85 db                	test   %ebx,%ebx
+  8030d2:	78 34                	js     803108 <__divdi3+0x4d>
+  8030d4:	83 ec 04             	sub    $0x4,%esp
+  8030d7:	6a 00                	push   $0x0
+  8030d9:	53                   	push   %ebx
+  8030da:	51                   	push   %ecx
+  8030db:	e8 c5 fe ff ff       	call   802fa5 <dm>
+  8030e0:	83 c4 10             	add    $0x10,%esp
+  8030e3:	eb 21                	jmp    803106 <__divdi3+0x4b>
+  8030e5:	f7 d8                	neg    %eax
+  8030e7:	83 d2 00             	adc    $0x0,%edx
+  8030ea:	f7 da                	neg    %edx
+  8030ec:	85 db                	test   %ebx,%ebx
+  8030ee:	78 30                	js     803120 <__divdi3+0x65>
+  8030f0:	83 ec 04             	sub    $0x4,%esp
+  8030f3:	6a 00                	push   $0x0
+  8030f5:	53                   	push   %ebx
+  8030f6:	51                   	push   %ecx
+  8030f7:	e8 a9 fe ff ff       	call   802fa5 <dm>
+  8030fc:	83 c4 10             	add    $0x10,%esp
+  8030ff:	f7 d8                	neg    %eax
+  803101:	83 d2 00             	adc    $0x0,%edx
+  803104:	f7 da                	neg    %edx
+  803106:	5b                   	pop    %ebx
+  803107:	c3                   	ret
+  803108:	83 ec 04             	sub    $0x4,%esp
+  80310b:	6a 00                	push   $0x0
+  80310d:	f7 d9                	neg    %ecx
+  80310f:	83 d3 00             	adc    $0x0,%ebx
+  803112:	f7 db                	neg    %ebx
+  803114:	53                   	push   %ebx
+  803115:	51                   	push   %ecx
+  803116:	e8 8a fe ff ff       	call   802fa5 <dm>
+  80311b:	83 c4 10             	add    $0x10,%esp
+  80311e:	eb df                	jmp    8030ff <__divdi3+0x44>
+  803120:	83 ec 04             	sub    $0x4,%esp
+  803123:	6a 00                	push   $0x0
+  803125:	f7 d9                	neg    %ecx
+  803127:	83 d3 00             	adc    $0x0,%ebx
+  80312a:	f7 db                	neg    %ebx
+  80312c:	53                   	push   %ebx
+  80312d:	51                   	push   %ecx
+  80312e:	e8 72 fe ff ff       	call   802fa5 <dm>
+  803133:	83 c4 10             	add    $0x10,%esp
+  803136:	eb ce                	jmp    803106 <__divdi3+0x4b>
+
+00803138 <__moddi3>:
+  803138:	55                   	push   %ebp
+  803139:	57                   	push   %edi
+  80313a:	56                   	push   %esi
+  80313b:	53                   	push   %ebx
+  80313c:	83 ec 18             	sub    $0x18,%esp
+  80313f:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  803143:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  803147:	89 f1                	mov    %esi,%ecx
+  803149:	f7 d9                	neg    %ecx
+  80314b:	89 da                	mov    %ebx,%edx
+  80314d:	83 d2 00             	adc    $0x0,%edx
+  803150:	f7 da                	neg    %edx
+  803152:	0f 48 ce             	cmovs  %esi,%ecx
+  803155:	0f 48 d3             	cmovs  %ebx,%edx
+  803158:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80315c:	50                   	push   %eax
+  80315d:	8b 74 24 38          	mov    0x38(%esp),%esi
+  803161:	f7 de                	neg    %esi
+  803163:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  803167:	83 d0 00             	adc    $0x0,%eax
+  80316a:	f7 d8                	neg    %eax
+  80316c:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  803171:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  803176:	50                   	push   %eax
+  803177:	56                   	push   %esi
+  803178:	89 c8                	mov    %ecx,%eax
+  80317a:	e8 26 fe ff ff       	call   802fa5 <dm>
+  80317f:	83 c4 10             	add    $0x10,%esp
+  803182:	85 db                	test   %ebx,%ebx
+  803184:	78 10                	js     803196 <__moddi3+0x5e>
+  803186:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80318a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80318e:	83 c4 14             	add    $0x14,%esp
+  803191:	5b                   	pop    %ebx
+  803192:	5e                   	pop    %esi
+  803193:	5f                   	pop    %edi
+  803194:	5d                   	pop    %ebp
+  803195:	c3                   	ret
+  803196:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80319a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80319e:	f7 d8                	neg    %eax
+  8031a0:	83 d2 00             	adc    $0x0,%edx
+  8031a3:	f7 da                	neg    %edx
+  8031a5:	eb e7                	jmp    80318e <__moddi3+0x56>
@@ -0,0 +1,6127 @@
+
+obj/user/pingpongs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 d2 00 00 00       	call   800103 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+uint32_t val;
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 2c             	sub    $0x2c,%esp
+	envid_t who;
+	uint32_t i;
+
+	i = 0;
+	if ((who = sfork()) != 0) {
+  80003c:	e8 3c 29 00 00       	call   80297d <sfork>
+  800041:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800044:	85 c0                	test   %eax,%eax
+  800046:	75 74                	jne    8000bc <umain+0x89>
+		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+		ipc_send(who, 0, 0, 0);
+	}
+
+	while (1) {
+		ipc_recv(&who, 0, 0);
+  800048:	83 ec 04             	sub    $0x4,%esp
+  80004b:	6a 00                	push   $0x0
+  80004d:	6a 00                	push   $0x0
+  80004f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800052:	50                   	push   %eax
+  800053:	e8 3f 29 00 00       	call   802997 <ipc_recv>
+		cprintf("%x got %d from %x (thisenv is %p %x)\n", sys_getenvid(), val, who, thisenv, thisenv->env_id);
+  800058:	8b 1d 0c 40 80 00    	mov    0x80400c,%ebx
+  80005e:	8b 7b 48             	mov    0x48(%ebx),%edi
+  800061:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800064:	a1 08 40 80 00       	mov    0x804008,%eax
+  800069:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80006c:	e8 06 0f 00 00       	call   800f77 <sys_getenvid>
+  800071:	83 c4 08             	add    $0x8,%esp
+  800074:	57                   	push   %edi
+  800075:	53                   	push   %ebx
+  800076:	56                   	push   %esi
+  800077:	ff 75 d4             	push   -0x2c(%ebp)
+  80007a:	50                   	push   %eax
+  80007b:	68 70 2f 80 00       	push   $0x802f70
+  800080:	e8 6e 01 00 00       	call   8001f3 <cprintf>
+		if (val == 10)
+  800085:	a1 08 40 80 00       	mov    0x804008,%eax
+  80008a:	83 c4 20             	add    $0x20,%esp
+  80008d:	83 f8 0a             	cmp    $0xa,%eax
+  800090:	74 22                	je     8000b4 <umain+0x81>
+			return;
+		++val;
+  800092:	83 c0 01             	add    $0x1,%eax
+  800095:	a3 08 40 80 00       	mov    %eax,0x804008
+		ipc_send(who, 0, 0, 0);
+  80009a:	6a 00                	push   $0x0
+  80009c:	6a 00                	push   $0x0
+  80009e:	6a 00                	push   $0x0
+  8000a0:	ff 75 e4             	push   -0x1c(%ebp)
+  8000a3:	e8 61 29 00 00       	call   802a09 <ipc_send>
+		if (val == 10)
+  8000a8:	83 c4 10             	add    $0x10,%esp
+  8000ab:	83 3d 08 40 80 00 0a 	cmpl   $0xa,0x804008
+  8000b2:	75 94                	jne    800048 <umain+0x15>
+			return;
+	}
+
+}
+  8000b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000b7:	5b                   	pop    %ebx
+  8000b8:	5e                   	pop    %esi
+  8000b9:	5f                   	pop    %edi
+  8000ba:	5d                   	pop    %ebp
+  8000bb:	c3                   	ret
+		cprintf("i am %08x; thisenv is %p\n", sys_getenvid(), thisenv);
+  8000bc:	8b 1d 0c 40 80 00    	mov    0x80400c,%ebx
+  8000c2:	e8 b0 0e 00 00       	call   800f77 <sys_getenvid>
+  8000c7:	83 ec 04             	sub    $0x4,%esp
+  8000ca:	53                   	push   %ebx
+  8000cb:	50                   	push   %eax
+  8000cc:	68 40 2f 80 00       	push   $0x802f40
+  8000d1:	e8 1d 01 00 00       	call   8001f3 <cprintf>
+		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  8000d6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8000d9:	e8 99 0e 00 00       	call   800f77 <sys_getenvid>
+  8000de:	83 c4 0c             	add    $0xc,%esp
+  8000e1:	53                   	push   %ebx
+  8000e2:	50                   	push   %eax
+  8000e3:	68 5a 2f 80 00       	push   $0x802f5a
+  8000e8:	e8 06 01 00 00       	call   8001f3 <cprintf>
+		ipc_send(who, 0, 0, 0);
+  8000ed:	6a 00                	push   $0x0
+  8000ef:	6a 00                	push   $0x0
+  8000f1:	6a 00                	push   $0x0
+  8000f3:	ff 75 e4             	push   -0x1c(%ebp)
+  8000f6:	e8 0e 29 00 00       	call   802a09 <ipc_send>
+  8000fb:	83 c4 20             	add    $0x20,%esp
+  8000fe:	e9 45 ff ff ff       	jmp    800048 <umain+0x15>
+
+00800103 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800103:	55                   	push   %ebp
+  800104:	89 e5                	mov    %esp,%ebp
+  800106:	56                   	push   %esi
+  800107:	53                   	push   %ebx
+  800108:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80010b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  80010e:	e8 64 0e 00 00       	call   800f77 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  800113:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800118:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  80011e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800123:	a3 0c 40 80 00       	mov    %eax,0x80400c
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800128:	85 db                	test   %ebx,%ebx
+  80012a:	7e 07                	jle    800133 <libmain+0x30>
+		binaryname = argv[0];
+  80012c:	8b 06                	mov    (%esi),%eax
+  80012e:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800133:	83 ec 08             	sub    $0x8,%esp
+  800136:	56                   	push   %esi
+  800137:	53                   	push   %ebx
+  800138:	e8 f6 fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80013d:	e8 0a 00 00 00       	call   80014c <exit>
+}
+  800142:	83 c4 10             	add    $0x10,%esp
+  800145:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800148:	5b                   	pop    %ebx
+  800149:	5e                   	pop    %esi
+  80014a:	5d                   	pop    %ebp
+  80014b:	c3                   	ret
+
+0080014c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80014c:	55                   	push   %ebp
+  80014d:	89 e5                	mov    %esp,%ebp
+  80014f:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  800152:	6a 00                	push   $0x0
+  800154:	e8 5c 0d 00 00       	call   800eb5 <sys_env_destroy>
+}
+  800159:	83 c4 10             	add    $0x10,%esp
+  80015c:	c9                   	leave
+  80015d:	c3                   	ret
+
+0080015e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80015e:	55                   	push   %ebp
+  80015f:	89 e5                	mov    %esp,%ebp
+  800161:	53                   	push   %ebx
+  800162:	83 ec 04             	sub    $0x4,%esp
+  800165:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800168:	8b 13                	mov    (%ebx),%edx
+  80016a:	8d 42 01             	lea    0x1(%edx),%eax
+  80016d:	89 03                	mov    %eax,(%ebx)
+  80016f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800172:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800176:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80017b:	74 09                	je     800186 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80017d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800181:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800184:	c9                   	leave
+  800185:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800186:	83 ec 08             	sub    $0x8,%esp
+  800189:	68 ff 00 00 00       	push   $0xff
+  80018e:	8d 43 08             	lea    0x8(%ebx),%eax
+  800191:	50                   	push   %eax
+  800192:	e8 e2 0b 00 00       	call   800d79 <sys_cputs>
+		b->idx = 0;
+  800197:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80019d:	83 c4 10             	add    $0x10,%esp
+  8001a0:	eb db                	jmp    80017d <putch+0x1f>
+
+008001a2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001a2:	55                   	push   %ebp
+  8001a3:	89 e5                	mov    %esp,%ebp
+  8001a5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001ab:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001b2:	00 00 00 
+	b.cnt = 0;
+  8001b5:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001bc:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001bf:	ff 75 0c             	push   0xc(%ebp)
+  8001c2:	ff 75 08             	push   0x8(%ebp)
+  8001c5:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001cb:	50                   	push   %eax
+  8001cc:	68 5e 01 80 00       	push   $0x80015e
+  8001d1:	e8 14 01 00 00       	call   8002ea <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001d6:	83 c4 08             	add    $0x8,%esp
+  8001d9:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001df:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001e5:	50                   	push   %eax
+  8001e6:	e8 8e 0b 00 00       	call   800d79 <sys_cputs>
+
+	return b.cnt;
+}
+  8001eb:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001f1:	c9                   	leave
+  8001f2:	c3                   	ret
+
+008001f3 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001f3:	55                   	push   %ebp
+  8001f4:	89 e5                	mov    %esp,%ebp
+  8001f6:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001f9:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001fc:	50                   	push   %eax
+  8001fd:	ff 75 08             	push   0x8(%ebp)
+  800200:	e8 9d ff ff ff       	call   8001a2 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800205:	c9                   	leave
+  800206:	c3                   	ret
+
+00800207 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800207:	55                   	push   %ebp
+  800208:	89 e5                	mov    %esp,%ebp
+  80020a:	57                   	push   %edi
+  80020b:	56                   	push   %esi
+  80020c:	53                   	push   %ebx
+  80020d:	83 ec 1c             	sub    $0x1c,%esp
+  800210:	89 c7                	mov    %eax,%edi
+  800212:	89 d6                	mov    %edx,%esi
+  800214:	8b 45 08             	mov    0x8(%ebp),%eax
+  800217:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80021a:	89 d1                	mov    %edx,%ecx
+  80021c:	89 c2                	mov    %eax,%edx
+  80021e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800221:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800224:	8b 45 10             	mov    0x10(%ebp),%eax
+  800227:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80022a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80022d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800234:	39 c2                	cmp    %eax,%edx
+  800236:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800239:	72 3e                	jb     800279 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80023b:	83 ec 0c             	sub    $0xc,%esp
+  80023e:	ff 75 18             	push   0x18(%ebp)
+  800241:	83 eb 01             	sub    $0x1,%ebx
+  800244:	53                   	push   %ebx
+  800245:	50                   	push   %eax
+  800246:	83 ec 08             	sub    $0x8,%esp
+  800249:	ff 75 e4             	push   -0x1c(%ebp)
+  80024c:	ff 75 e0             	push   -0x20(%ebp)
+  80024f:	ff 75 dc             	push   -0x24(%ebp)
+  800252:	ff 75 d8             	push   -0x28(%ebp)
+  800255:	e8 ae 2b 00 00       	call   802e08 <__udivdi3>
+  80025a:	83 c4 18             	add    $0x18,%esp
+  80025d:	52                   	push   %edx
+  80025e:	50                   	push   %eax
+  80025f:	89 f2                	mov    %esi,%edx
+  800261:	89 f8                	mov    %edi,%eax
+  800263:	e8 9f ff ff ff       	call   800207 <printnum>
+  800268:	83 c4 20             	add    $0x20,%esp
+  80026b:	eb 13                	jmp    800280 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80026d:	83 ec 08             	sub    $0x8,%esp
+  800270:	56                   	push   %esi
+  800271:	ff 75 18             	push   0x18(%ebp)
+  800274:	ff d7                	call   *%edi
+  800276:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800279:	83 eb 01             	sub    $0x1,%ebx
+  80027c:	85 db                	test   %ebx,%ebx
+  80027e:	7f ed                	jg     80026d <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800280:	83 ec 08             	sub    $0x8,%esp
+  800283:	56                   	push   %esi
+  800284:	83 ec 04             	sub    $0x4,%esp
+  800287:	ff 75 e4             	push   -0x1c(%ebp)
+  80028a:	ff 75 e0             	push   -0x20(%ebp)
+  80028d:	ff 75 dc             	push   -0x24(%ebp)
+  800290:	ff 75 d8             	push   -0x28(%ebp)
+  800293:	e8 8e 2b 00 00       	call   802e26 <__umoddi3>
+  800298:	83 c4 14             	add    $0x14,%esp
+  80029b:	0f be 80 a0 2f 80 00 	movsbl 0x802fa0(%eax),%eax
+  8002a2:	50                   	push   %eax
+  8002a3:	ff d7                	call   *%edi
+}
+  8002a5:	83 c4 10             	add    $0x10,%esp
+  8002a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ab:	5b                   	pop    %ebx
+  8002ac:	5e                   	pop    %esi
+  8002ad:	5f                   	pop    %edi
+  8002ae:	5d                   	pop    %ebp
+  8002af:	c3                   	ret
+
+008002b0 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002b0:	55                   	push   %ebp
+  8002b1:	89 e5                	mov    %esp,%ebp
+  8002b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002b6:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002ba:	8b 10                	mov    (%eax),%edx
+  8002bc:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002bf:	73 0a                	jae    8002cb <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002c1:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002c4:	89 08                	mov    %ecx,(%eax)
+  8002c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002c9:	88 02                	mov    %al,(%edx)
+}
+  8002cb:	5d                   	pop    %ebp
+  8002cc:	c3                   	ret
+
+008002cd <printfmt>:
+{
+  8002cd:	55                   	push   %ebp
+  8002ce:	89 e5                	mov    %esp,%ebp
+  8002d0:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002d3:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002d6:	50                   	push   %eax
+  8002d7:	ff 75 10             	push   0x10(%ebp)
+  8002da:	ff 75 0c             	push   0xc(%ebp)
+  8002dd:	ff 75 08             	push   0x8(%ebp)
+  8002e0:	e8 05 00 00 00       	call   8002ea <vprintfmt>
+}
+  8002e5:	83 c4 10             	add    $0x10,%esp
+  8002e8:	c9                   	leave
+  8002e9:	c3                   	ret
+
+008002ea <vprintfmt>:
+{
+  8002ea:	55                   	push   %ebp
+  8002eb:	89 e5                	mov    %esp,%ebp
+  8002ed:	57                   	push   %edi
+  8002ee:	56                   	push   %esi
+  8002ef:	53                   	push   %ebx
+  8002f0:	83 ec 2c             	sub    $0x2c,%esp
+  8002f3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002f6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002f9:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002fc:	eb 0a                	jmp    800308 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002fe:	83 ec 08             	sub    $0x8,%esp
+  800301:	53                   	push   %ebx
+  800302:	50                   	push   %eax
+  800303:	ff d6                	call   *%esi
+  800305:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800308:	83 c7 01             	add    $0x1,%edi
+  80030b:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80030f:	83 f8 25             	cmp    $0x25,%eax
+  800312:	74 0c                	je     800320 <vprintfmt+0x36>
+			if (ch == '\0')
+  800314:	85 c0                	test   %eax,%eax
+  800316:	75 e6                	jne    8002fe <vprintfmt+0x14>
+}
+  800318:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80031b:	5b                   	pop    %ebx
+  80031c:	5e                   	pop    %esi
+  80031d:	5f                   	pop    %edi
+  80031e:	5d                   	pop    %ebp
+  80031f:	c3                   	ret
+		padc = ' ';
+  800320:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800324:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80032b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800332:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800339:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80033e:	8d 47 01             	lea    0x1(%edi),%eax
+  800341:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800344:	0f b6 17             	movzbl (%edi),%edx
+  800347:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80034a:	3c 55                	cmp    $0x55,%al
+  80034c:	0f 87 cf 03 00 00    	ja     800721 <vprintfmt+0x437>
+  800352:	0f b6 c0             	movzbl %al,%eax
+  800355:	ff 24 85 80 30 80 00 	jmp    *0x803080(,%eax,4)
+  80035c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80035f:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800363:	eb d9                	jmp    80033e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800365:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800368:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80036c:	eb d0                	jmp    80033e <vprintfmt+0x54>
+  80036e:	0f b6 d2             	movzbl %dl,%edx
+  800371:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800374:	b8 00 00 00 00       	mov    $0x0,%eax
+  800379:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80037c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80037f:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800383:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800386:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800389:	83 f9 09             	cmp    $0x9,%ecx
+  80038c:	77 55                	ja     8003e3 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80038e:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800391:	eb e9                	jmp    80037c <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800393:	8b 45 14             	mov    0x14(%ebp),%eax
+  800396:	8b 00                	mov    (%eax),%eax
+  800398:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80039b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80039e:	8d 40 04             	lea    0x4(%eax),%eax
+  8003a1:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003a7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003ab:	79 91                	jns    80033e <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003ad:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003b0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003b3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003ba:	eb 82                	jmp    80033e <vprintfmt+0x54>
+			if (width < 0)
+  8003bc:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003bf:	85 d2                	test   %edx,%edx
+  8003c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c6:	0f 49 c2             	cmovns %edx,%eax
+  8003c9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003cc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003cf:	e9 6a ff ff ff       	jmp    80033e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003d4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003d7:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003de:	e9 5b ff ff ff       	jmp    80033e <vprintfmt+0x54>
+  8003e3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003e6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003e9:	eb bc                	jmp    8003a7 <vprintfmt+0xbd>
+			lflag++;
+  8003eb:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ee:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003f1:	e9 48 ff ff ff       	jmp    80033e <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f9:	8d 78 04             	lea    0x4(%eax),%edi
+  8003fc:	83 ec 08             	sub    $0x8,%esp
+  8003ff:	53                   	push   %ebx
+  800400:	ff 30                	push   (%eax)
+  800402:	ff d6                	call   *%esi
+			break;
+  800404:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800407:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80040a:	e9 b1 02 00 00       	jmp    8006c0 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  80040f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800412:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800415:	8b 10                	mov    (%eax),%edx
+  800417:	89 d0                	mov    %edx,%eax
+  800419:	f7 d8                	neg    %eax
+  80041b:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80041e:	83 f8 0d             	cmp    $0xd,%eax
+  800421:	7f 23                	jg     800446 <vprintfmt+0x15c>
+  800423:	8b 14 85 e0 31 80 00 	mov    0x8031e0(,%eax,4),%edx
+  80042a:	85 d2                	test   %edx,%edx
+  80042c:	74 18                	je     800446 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80042e:	52                   	push   %edx
+  80042f:	68 c1 2f 80 00       	push   $0x802fc1
+  800434:	53                   	push   %ebx
+  800435:	56                   	push   %esi
+  800436:	e8 92 fe ff ff       	call   8002cd <printfmt>
+  80043b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80043e:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800441:	e9 7a 02 00 00       	jmp    8006c0 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800446:	50                   	push   %eax
+  800447:	68 b8 2f 80 00       	push   $0x802fb8
+  80044c:	53                   	push   %ebx
+  80044d:	56                   	push   %esi
+  80044e:	e8 7a fe ff ff       	call   8002cd <printfmt>
+  800453:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800456:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800459:	e9 62 02 00 00       	jmp    8006c0 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80045e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800461:	83 c0 04             	add    $0x4,%eax
+  800464:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800467:	8b 45 14             	mov    0x14(%ebp),%eax
+  80046a:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80046c:	85 c9                	test   %ecx,%ecx
+  80046e:	b8 b1 2f 80 00       	mov    $0x802fb1,%eax
+  800473:	0f 45 c1             	cmovne %ecx,%eax
+  800476:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800479:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80047d:	7e 06                	jle    800485 <vprintfmt+0x19b>
+  80047f:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800483:	75 0b                	jne    800490 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800485:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800488:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80048b:	89 75 08             	mov    %esi,0x8(%ebp)
+  80048e:	eb 5c                	jmp    8004ec <vprintfmt+0x202>
+  800490:	83 ec 08             	sub    $0x8,%esp
+  800493:	ff 75 d0             	push   -0x30(%ebp)
+  800496:	ff 75 cc             	push   -0x34(%ebp)
+  800499:	e8 20 03 00 00       	call   8007be <strnlen>
+  80049e:	89 c2                	mov    %eax,%edx
+  8004a0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004a3:	29 d0                	sub    %edx,%eax
+  8004a5:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004a8:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004ac:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004af:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004b2:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004b4:	eb 0e                	jmp    8004c4 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004b6:	83 ec 08             	sub    $0x8,%esp
+  8004b9:	53                   	push   %ebx
+  8004ba:	57                   	push   %edi
+  8004bb:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004be:	83 ee 01             	sub    $0x1,%esi
+  8004c1:	83 c4 10             	add    $0x10,%esp
+  8004c4:	85 f6                	test   %esi,%esi
+  8004c6:	7f ee                	jg     8004b6 <vprintfmt+0x1cc>
+  8004c8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004cb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004ce:	85 c0                	test   %eax,%eax
+  8004d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004d5:	0f 49 d0             	cmovns %eax,%edx
+  8004d8:	29 d0                	sub    %edx,%eax
+  8004da:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004dd:	eb a6                	jmp    800485 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004df:	83 ec 08             	sub    $0x8,%esp
+  8004e2:	53                   	push   %ebx
+  8004e3:	52                   	push   %edx
+  8004e4:	ff 55 08             	call   *0x8(%ebp)
+  8004e7:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004ea:	89 f1                	mov    %esi,%ecx
+  8004ec:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004ef:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004f3:	0f be d0             	movsbl %al,%edx
+  8004f6:	85 d2                	test   %edx,%edx
+  8004f8:	74 28                	je     800522 <vprintfmt+0x238>
+  8004fa:	85 ff                	test   %edi,%edi
+  8004fc:	78 05                	js     800503 <vprintfmt+0x219>
+  8004fe:	83 ef 01             	sub    $0x1,%edi
+  800501:	78 30                	js     800533 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800503:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800507:	74 d6                	je     8004df <vprintfmt+0x1f5>
+  800509:	0f be c0             	movsbl %al,%eax
+  80050c:	83 e8 20             	sub    $0x20,%eax
+  80050f:	83 f8 5e             	cmp    $0x5e,%eax
+  800512:	76 cb                	jbe    8004df <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800514:	83 ec 08             	sub    $0x8,%esp
+  800517:	53                   	push   %ebx
+  800518:	6a 3f                	push   $0x3f
+  80051a:	ff 55 08             	call   *0x8(%ebp)
+  80051d:	83 c4 10             	add    $0x10,%esp
+  800520:	eb c8                	jmp    8004ea <vprintfmt+0x200>
+  800522:	8b 75 08             	mov    0x8(%ebp),%esi
+  800525:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800528:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80052b:	01 d0                	add    %edx,%eax
+  80052d:	29 c8                	sub    %ecx,%eax
+  80052f:	89 c7                	mov    %eax,%edi
+  800531:	eb 13                	jmp    800546 <vprintfmt+0x25c>
+  800533:	8b 75 08             	mov    0x8(%ebp),%esi
+  800536:	eb ed                	jmp    800525 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800538:	83 ec 08             	sub    $0x8,%esp
+  80053b:	53                   	push   %ebx
+  80053c:	6a 20                	push   $0x20
+  80053e:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800540:	83 ef 01             	sub    $0x1,%edi
+  800543:	83 c4 10             	add    $0x10,%esp
+  800546:	85 ff                	test   %edi,%edi
+  800548:	7f ee                	jg     800538 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80054a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80054d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800550:	e9 6b 01 00 00       	jmp    8006c0 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800555:	83 f9 01             	cmp    $0x1,%ecx
+  800558:	7f 1f                	jg     800579 <vprintfmt+0x28f>
+	else if (lflag)
+  80055a:	85 c9                	test   %ecx,%ecx
+  80055c:	74 67                	je     8005c5 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80055e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800561:	8b 00                	mov    (%eax),%eax
+  800563:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800566:	89 c1                	mov    %eax,%ecx
+  800568:	c1 f9 1f             	sar    $0x1f,%ecx
+  80056b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80056e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800571:	8d 40 04             	lea    0x4(%eax),%eax
+  800574:	89 45 14             	mov    %eax,0x14(%ebp)
+  800577:	eb 17                	jmp    800590 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800579:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057c:	8b 50 04             	mov    0x4(%eax),%edx
+  80057f:	8b 00                	mov    (%eax),%eax
+  800581:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800584:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800587:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058a:	8d 40 08             	lea    0x8(%eax),%eax
+  80058d:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800590:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800593:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800596:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80059b:	85 c9                	test   %ecx,%ecx
+  80059d:	0f 89 03 01 00 00    	jns    8006a6 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8005a3:	83 ec 08             	sub    $0x8,%esp
+  8005a6:	53                   	push   %ebx
+  8005a7:	6a 2d                	push   $0x2d
+  8005a9:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005ab:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005ae:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005b1:	f7 da                	neg    %edx
+  8005b3:	83 d1 00             	adc    $0x0,%ecx
+  8005b6:	f7 d9                	neg    %ecx
+  8005b8:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005bb:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005c0:	e9 e1 00 00 00       	jmp    8006a6 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8005c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c8:	8b 00                	mov    (%eax),%eax
+  8005ca:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005cd:	89 c1                	mov    %eax,%ecx
+  8005cf:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005d2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d8:	8d 40 04             	lea    0x4(%eax),%eax
+  8005db:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005de:	eb b0                	jmp    800590 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8005e0:	83 f9 01             	cmp    $0x1,%ecx
+  8005e3:	7f 1e                	jg     800603 <vprintfmt+0x319>
+	else if (lflag)
+  8005e5:	85 c9                	test   %ecx,%ecx
+  8005e7:	74 32                	je     80061b <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8005e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ec:	8b 10                	mov    (%eax),%edx
+  8005ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005f3:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005f9:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005fe:	e9 a3 00 00 00       	jmp    8006a6 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800603:	8b 45 14             	mov    0x14(%ebp),%eax
+  800606:	8b 10                	mov    (%eax),%edx
+  800608:	8b 48 04             	mov    0x4(%eax),%ecx
+  80060b:	8d 40 08             	lea    0x8(%eax),%eax
+  80060e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800611:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800616:	e9 8b 00 00 00       	jmp    8006a6 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80061b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061e:	8b 10                	mov    (%eax),%edx
+  800620:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800625:	8d 40 04             	lea    0x4(%eax),%eax
+  800628:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80062b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800630:	eb 74                	jmp    8006a6 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800632:	83 f9 01             	cmp    $0x1,%ecx
+  800635:	7f 1b                	jg     800652 <vprintfmt+0x368>
+	else if (lflag)
+  800637:	85 c9                	test   %ecx,%ecx
+  800639:	74 2c                	je     800667 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  80063b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063e:	8b 10                	mov    (%eax),%edx
+  800640:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800645:	8d 40 04             	lea    0x4(%eax),%eax
+  800648:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80064b:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800650:	eb 54                	jmp    8006a6 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800652:	8b 45 14             	mov    0x14(%ebp),%eax
+  800655:	8b 10                	mov    (%eax),%edx
+  800657:	8b 48 04             	mov    0x4(%eax),%ecx
+  80065a:	8d 40 08             	lea    0x8(%eax),%eax
+  80065d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800660:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800665:	eb 3f                	jmp    8006a6 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800667:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066a:	8b 10                	mov    (%eax),%edx
+  80066c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800671:	8d 40 04             	lea    0x4(%eax),%eax
+  800674:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800677:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80067c:	eb 28                	jmp    8006a6 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  80067e:	83 ec 08             	sub    $0x8,%esp
+  800681:	53                   	push   %ebx
+  800682:	6a 30                	push   $0x30
+  800684:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800686:	83 c4 08             	add    $0x8,%esp
+  800689:	53                   	push   %ebx
+  80068a:	6a 78                	push   $0x78
+  80068c:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80068e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800691:	8b 10                	mov    (%eax),%edx
+  800693:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800698:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80069b:	8d 40 04             	lea    0x4(%eax),%eax
+  80069e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006a1:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006a6:	83 ec 0c             	sub    $0xc,%esp
+  8006a9:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006ad:	50                   	push   %eax
+  8006ae:	ff 75 e0             	push   -0x20(%ebp)
+  8006b1:	57                   	push   %edi
+  8006b2:	51                   	push   %ecx
+  8006b3:	52                   	push   %edx
+  8006b4:	89 da                	mov    %ebx,%edx
+  8006b6:	89 f0                	mov    %esi,%eax
+  8006b8:	e8 4a fb ff ff       	call   800207 <printnum>
+			break;
+  8006bd:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006c0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006c3:	e9 40 fc ff ff       	jmp    800308 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006c8:	83 f9 01             	cmp    $0x1,%ecx
+  8006cb:	7f 1b                	jg     8006e8 <vprintfmt+0x3fe>
+	else if (lflag)
+  8006cd:	85 c9                	test   %ecx,%ecx
+  8006cf:	74 2c                	je     8006fd <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8006d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d4:	8b 10                	mov    (%eax),%edx
+  8006d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006db:	8d 40 04             	lea    0x4(%eax),%eax
+  8006de:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006e1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006e6:	eb be                	jmp    8006a6 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006eb:	8b 10                	mov    (%eax),%edx
+  8006ed:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006f0:	8d 40 08             	lea    0x8(%eax),%eax
+  8006f3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006f6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006fb:	eb a9                	jmp    8006a6 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800700:	8b 10                	mov    (%eax),%edx
+  800702:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800707:	8d 40 04             	lea    0x4(%eax),%eax
+  80070a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80070d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800712:	eb 92                	jmp    8006a6 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800714:	83 ec 08             	sub    $0x8,%esp
+  800717:	53                   	push   %ebx
+  800718:	6a 25                	push   $0x25
+  80071a:	ff d6                	call   *%esi
+			break;
+  80071c:	83 c4 10             	add    $0x10,%esp
+  80071f:	eb 9f                	jmp    8006c0 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800721:	83 ec 08             	sub    $0x8,%esp
+  800724:	53                   	push   %ebx
+  800725:	6a 25                	push   $0x25
+  800727:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800729:	83 c4 10             	add    $0x10,%esp
+  80072c:	89 f8                	mov    %edi,%eax
+  80072e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800732:	74 05                	je     800739 <vprintfmt+0x44f>
+  800734:	83 e8 01             	sub    $0x1,%eax
+  800737:	eb f5                	jmp    80072e <vprintfmt+0x444>
+  800739:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80073c:	eb 82                	jmp    8006c0 <vprintfmt+0x3d6>
+
+0080073e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80073e:	55                   	push   %ebp
+  80073f:	89 e5                	mov    %esp,%ebp
+  800741:	83 ec 18             	sub    $0x18,%esp
+  800744:	8b 45 08             	mov    0x8(%ebp),%eax
+  800747:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80074a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80074d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800751:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800754:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80075b:	85 c0                	test   %eax,%eax
+  80075d:	74 26                	je     800785 <vsnprintf+0x47>
+  80075f:	85 d2                	test   %edx,%edx
+  800761:	7e 22                	jle    800785 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800763:	ff 75 14             	push   0x14(%ebp)
+  800766:	ff 75 10             	push   0x10(%ebp)
+  800769:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80076c:	50                   	push   %eax
+  80076d:	68 b0 02 80 00       	push   $0x8002b0
+  800772:	e8 73 fb ff ff       	call   8002ea <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800777:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80077a:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80077d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800780:	83 c4 10             	add    $0x10,%esp
+}
+  800783:	c9                   	leave
+  800784:	c3                   	ret
+		return -E_INVAL;
+  800785:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80078a:	eb f7                	jmp    800783 <vsnprintf+0x45>
+
+0080078c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80078c:	55                   	push   %ebp
+  80078d:	89 e5                	mov    %esp,%ebp
+  80078f:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800792:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800795:	50                   	push   %eax
+  800796:	ff 75 10             	push   0x10(%ebp)
+  800799:	ff 75 0c             	push   0xc(%ebp)
+  80079c:	ff 75 08             	push   0x8(%ebp)
+  80079f:	e8 9a ff ff ff       	call   80073e <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007a4:	c9                   	leave
+  8007a5:	c3                   	ret
+
+008007a6 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007a6:	55                   	push   %ebp
+  8007a7:	89 e5                	mov    %esp,%ebp
+  8007a9:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b1:	eb 03                	jmp    8007b6 <strlen+0x10>
+		n++;
+  8007b3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007b6:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007ba:	75 f7                	jne    8007b3 <strlen+0xd>
+	return n;
+}
+  8007bc:	5d                   	pop    %ebp
+  8007bd:	c3                   	ret
+
+008007be <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007be:	55                   	push   %ebp
+  8007bf:	89 e5                	mov    %esp,%ebp
+  8007c1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007c4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007cc:	eb 03                	jmp    8007d1 <strnlen+0x13>
+		n++;
+  8007ce:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007d1:	39 d0                	cmp    %edx,%eax
+  8007d3:	74 08                	je     8007dd <strnlen+0x1f>
+  8007d5:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007d9:	75 f3                	jne    8007ce <strnlen+0x10>
+  8007db:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007dd:	89 d0                	mov    %edx,%eax
+  8007df:	5d                   	pop    %ebp
+  8007e0:	c3                   	ret
+
+008007e1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007e1:	55                   	push   %ebp
+  8007e2:	89 e5                	mov    %esp,%ebp
+  8007e4:	53                   	push   %ebx
+  8007e5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007e8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007f7:	83 c0 01             	add    $0x1,%eax
+  8007fa:	84 d2                	test   %dl,%dl
+  8007fc:	75 f2                	jne    8007f0 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007fe:	89 c8                	mov    %ecx,%eax
+  800800:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800803:	c9                   	leave
+  800804:	c3                   	ret
+
+00800805 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800805:	55                   	push   %ebp
+  800806:	89 e5                	mov    %esp,%ebp
+  800808:	53                   	push   %ebx
+  800809:	83 ec 10             	sub    $0x10,%esp
+  80080c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80080f:	53                   	push   %ebx
+  800810:	e8 91 ff ff ff       	call   8007a6 <strlen>
+  800815:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800818:	ff 75 0c             	push   0xc(%ebp)
+  80081b:	01 d8                	add    %ebx,%eax
+  80081d:	50                   	push   %eax
+  80081e:	e8 be ff ff ff       	call   8007e1 <strcpy>
+	return dst;
+}
+  800823:	89 d8                	mov    %ebx,%eax
+  800825:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800828:	c9                   	leave
+  800829:	c3                   	ret
+
+0080082a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80082a:	55                   	push   %ebp
+  80082b:	89 e5                	mov    %esp,%ebp
+  80082d:	56                   	push   %esi
+  80082e:	53                   	push   %ebx
+  80082f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800832:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800835:	89 f3                	mov    %esi,%ebx
+  800837:	03 5d 10             	add    0x10(%ebp),%ebx
+  80083a:	89 f0                	mov    %esi,%eax
+  80083c:	eb 0f                	jmp    80084d <strncpy+0x23>
+		*dst++ = *src;
+  80083e:	83 c0 01             	add    $0x1,%eax
+  800841:	0f b6 0a             	movzbl (%edx),%ecx
+  800844:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800847:	80 f9 01             	cmp    $0x1,%cl
+  80084a:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80084d:	39 d8                	cmp    %ebx,%eax
+  80084f:	75 ed                	jne    80083e <strncpy+0x14>
+	}
+	return ret;
+}
+  800851:	89 f0                	mov    %esi,%eax
+  800853:	5b                   	pop    %ebx
+  800854:	5e                   	pop    %esi
+  800855:	5d                   	pop    %ebp
+  800856:	c3                   	ret
+
+00800857 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800857:	55                   	push   %ebp
+  800858:	89 e5                	mov    %esp,%ebp
+  80085a:	56                   	push   %esi
+  80085b:	53                   	push   %ebx
+  80085c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80085f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800862:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800865:	89 f0                	mov    %esi,%eax
+  800867:	85 d2                	test   %edx,%edx
+  800869:	74 21                	je     80088c <strlcpy+0x35>
+  80086b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80086f:	89 f2                	mov    %esi,%edx
+  800871:	eb 09                	jmp    80087c <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800873:	83 c1 01             	add    $0x1,%ecx
+  800876:	83 c2 01             	add    $0x1,%edx
+  800879:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80087c:	39 c2                	cmp    %eax,%edx
+  80087e:	74 09                	je     800889 <strlcpy+0x32>
+  800880:	0f b6 19             	movzbl (%ecx),%ebx
+  800883:	84 db                	test   %bl,%bl
+  800885:	75 ec                	jne    800873 <strlcpy+0x1c>
+  800887:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800889:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80088c:	29 f0                	sub    %esi,%eax
+}
+  80088e:	5b                   	pop    %ebx
+  80088f:	5e                   	pop    %esi
+  800890:	5d                   	pop    %ebp
+  800891:	c3                   	ret
+
+00800892 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800892:	55                   	push   %ebp
+  800893:	89 e5                	mov    %esp,%ebp
+  800895:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800898:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80089b:	eb 06                	jmp    8008a3 <strcmp+0x11>
+		p++, q++;
+  80089d:	83 c1 01             	add    $0x1,%ecx
+  8008a0:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008a3:	0f b6 01             	movzbl (%ecx),%eax
+  8008a6:	84 c0                	test   %al,%al
+  8008a8:	74 04                	je     8008ae <strcmp+0x1c>
+  8008aa:	3a 02                	cmp    (%edx),%al
+  8008ac:	74 ef                	je     80089d <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008ae:	0f b6 c0             	movzbl %al,%eax
+  8008b1:	0f b6 12             	movzbl (%edx),%edx
+  8008b4:	29 d0                	sub    %edx,%eax
+}
+  8008b6:	5d                   	pop    %ebp
+  8008b7:	c3                   	ret
+
+008008b8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008b8:	55                   	push   %ebp
+  8008b9:	89 e5                	mov    %esp,%ebp
+  8008bb:	53                   	push   %ebx
+  8008bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008c2:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008c5:	eb 09                	jmp    8008d0 <strncmp+0x18>
+		n--, p++, q++;
+  8008c7:	83 ea 01             	sub    $0x1,%edx
+  8008ca:	83 c0 01             	add    $0x1,%eax
+  8008cd:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008d0:	85 d2                	test   %edx,%edx
+  8008d2:	74 18                	je     8008ec <strncmp+0x34>
+  8008d4:	0f b6 18             	movzbl (%eax),%ebx
+  8008d7:	84 db                	test   %bl,%bl
+  8008d9:	74 04                	je     8008df <strncmp+0x27>
+  8008db:	3a 19                	cmp    (%ecx),%bl
+  8008dd:	74 e8                	je     8008c7 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008df:	0f b6 00             	movzbl (%eax),%eax
+  8008e2:	0f b6 11             	movzbl (%ecx),%edx
+  8008e5:	29 d0                	sub    %edx,%eax
+}
+  8008e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008ea:	c9                   	leave
+  8008eb:	c3                   	ret
+		return 0;
+  8008ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f1:	eb f4                	jmp    8008e7 <strncmp+0x2f>
+
+008008f3 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008f3:	55                   	push   %ebp
+  8008f4:	89 e5                	mov    %esp,%ebp
+  8008f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008f9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008fd:	eb 03                	jmp    800902 <strchr+0xf>
+  8008ff:	83 c0 01             	add    $0x1,%eax
+  800902:	0f b6 10             	movzbl (%eax),%edx
+  800905:	84 d2                	test   %dl,%dl
+  800907:	74 06                	je     80090f <strchr+0x1c>
+		if (*s == c)
+  800909:	38 ca                	cmp    %cl,%dl
+  80090b:	75 f2                	jne    8008ff <strchr+0xc>
+  80090d:	eb 05                	jmp    800914 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80090f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800914:	5d                   	pop    %ebp
+  800915:	c3                   	ret
+
+00800916 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800916:	55                   	push   %ebp
+  800917:	89 e5                	mov    %esp,%ebp
+  800919:	8b 45 08             	mov    0x8(%ebp),%eax
+  80091c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800920:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800923:	38 ca                	cmp    %cl,%dl
+  800925:	74 09                	je     800930 <strfind+0x1a>
+  800927:	84 d2                	test   %dl,%dl
+  800929:	74 05                	je     800930 <strfind+0x1a>
+	for (; *s; s++)
+  80092b:	83 c0 01             	add    $0x1,%eax
+  80092e:	eb f0                	jmp    800920 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800930:	5d                   	pop    %ebp
+  800931:	c3                   	ret
+
+00800932 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800932:	55                   	push   %ebp
+  800933:	89 e5                	mov    %esp,%ebp
+  800935:	57                   	push   %edi
+  800936:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800939:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80093c:	85 c9                	test   %ecx,%ecx
+  80093e:	74 20                	je     800960 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800940:	89 f8                	mov    %edi,%eax
+  800942:	09 c8                	or     %ecx,%eax
+  800944:	a8 03                	test   $0x3,%al
+  800946:	75 12                	jne    80095a <memset+0x28>
+		c &= 0xFF;
+  800948:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80094c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800952:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800955:	fc                   	cld
+  800956:	f3 ab                	rep stos %eax,%es:(%edi)
+  800958:	eb 06                	jmp    800960 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80095a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80095d:	fc                   	cld
+  80095e:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800960:	89 f8                	mov    %edi,%eax
+  800962:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800965:	c9                   	leave
+  800966:	c3                   	ret
+
+00800967 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800967:	55                   	push   %ebp
+  800968:	89 e5                	mov    %esp,%ebp
+  80096a:	57                   	push   %edi
+  80096b:	56                   	push   %esi
+  80096c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80096f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800972:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800975:	39 c6                	cmp    %eax,%esi
+  800977:	73 32                	jae    8009ab <memmove+0x44>
+  800979:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80097c:	39 d0                	cmp    %edx,%eax
+  80097e:	73 2b                	jae    8009ab <memmove+0x44>
+		s += n;
+		d += n;
+  800980:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800983:	89 d6                	mov    %edx,%esi
+  800985:	09 fe                	or     %edi,%esi
+  800987:	09 ce                	or     %ecx,%esi
+  800989:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80098f:	75 0e                	jne    80099f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800991:	83 ef 04             	sub    $0x4,%edi
+  800994:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800997:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80099a:	fd                   	std
+  80099b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80099d:	eb 09                	jmp    8009a8 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80099f:	83 ef 01             	sub    $0x1,%edi
+  8009a2:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009a5:	fd                   	std
+  8009a6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009a8:	fc                   	cld
+  8009a9:	eb 1a                	jmp    8009c5 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009ab:	89 f2                	mov    %esi,%edx
+  8009ad:	09 c2                	or     %eax,%edx
+  8009af:	09 ca                	or     %ecx,%edx
+  8009b1:	f6 c2 03             	test   $0x3,%dl
+  8009b4:	75 0a                	jne    8009c0 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009b6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009b9:	89 c7                	mov    %eax,%edi
+  8009bb:	fc                   	cld
+  8009bc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009be:	eb 05                	jmp    8009c5 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009c0:	89 c7                	mov    %eax,%edi
+  8009c2:	fc                   	cld
+  8009c3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009c5:	5e                   	pop    %esi
+  8009c6:	5f                   	pop    %edi
+  8009c7:	5d                   	pop    %ebp
+  8009c8:	c3                   	ret
+
+008009c9 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009c9:	55                   	push   %ebp
+  8009ca:	89 e5                	mov    %esp,%ebp
+  8009cc:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009cf:	ff 75 10             	push   0x10(%ebp)
+  8009d2:	ff 75 0c             	push   0xc(%ebp)
+  8009d5:	ff 75 08             	push   0x8(%ebp)
+  8009d8:	e8 8a ff ff ff       	call   800967 <memmove>
+}
+  8009dd:	c9                   	leave
+  8009de:	c3                   	ret
+
+008009df <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009df:	55                   	push   %ebp
+  8009e0:	89 e5                	mov    %esp,%ebp
+  8009e2:	56                   	push   %esi
+  8009e3:	53                   	push   %ebx
+  8009e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009ea:	89 c6                	mov    %eax,%esi
+  8009ec:	03 75 10             	add    0x10(%ebp),%esi
+  8009ef:	eb 06                	jmp    8009f7 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009f1:	83 c0 01             	add    $0x1,%eax
+  8009f4:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009f7:	39 f0                	cmp    %esi,%eax
+  8009f9:	74 14                	je     800a0f <memcmp+0x30>
+		if (*s1 != *s2)
+  8009fb:	0f b6 08             	movzbl (%eax),%ecx
+  8009fe:	0f b6 1a             	movzbl (%edx),%ebx
+  800a01:	38 d9                	cmp    %bl,%cl
+  800a03:	74 ec                	je     8009f1 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a05:	0f b6 c1             	movzbl %cl,%eax
+  800a08:	0f b6 db             	movzbl %bl,%ebx
+  800a0b:	29 d8                	sub    %ebx,%eax
+  800a0d:	eb 05                	jmp    800a14 <memcmp+0x35>
+	}
+
+	return 0;
+  800a0f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a14:	5b                   	pop    %ebx
+  800a15:	5e                   	pop    %esi
+  800a16:	5d                   	pop    %ebp
+  800a17:	c3                   	ret
+
+00800a18 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a18:	55                   	push   %ebp
+  800a19:	89 e5                	mov    %esp,%ebp
+  800a1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a1e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a21:	89 c2                	mov    %eax,%edx
+  800a23:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a26:	eb 03                	jmp    800a2b <memfind+0x13>
+  800a28:	83 c0 01             	add    $0x1,%eax
+  800a2b:	39 d0                	cmp    %edx,%eax
+  800a2d:	73 04                	jae    800a33 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a2f:	38 08                	cmp    %cl,(%eax)
+  800a31:	75 f5                	jne    800a28 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a33:	5d                   	pop    %ebp
+  800a34:	c3                   	ret
+
+00800a35 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a35:	55                   	push   %ebp
+  800a36:	89 e5                	mov    %esp,%ebp
+  800a38:	57                   	push   %edi
+  800a39:	56                   	push   %esi
+  800a3a:	53                   	push   %ebx
+  800a3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a3e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a41:	eb 03                	jmp    800a46 <strtol+0x11>
+		s++;
+  800a43:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a46:	0f b6 02             	movzbl (%edx),%eax
+  800a49:	3c 20                	cmp    $0x20,%al
+  800a4b:	74 f6                	je     800a43 <strtol+0xe>
+  800a4d:	3c 09                	cmp    $0x9,%al
+  800a4f:	74 f2                	je     800a43 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a51:	3c 2b                	cmp    $0x2b,%al
+  800a53:	74 2a                	je     800a7f <strtol+0x4a>
+	int neg = 0;
+  800a55:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a5a:	3c 2d                	cmp    $0x2d,%al
+  800a5c:	74 2b                	je     800a89 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a5e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a64:	75 0f                	jne    800a75 <strtol+0x40>
+  800a66:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a69:	74 28                	je     800a93 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a6b:	85 db                	test   %ebx,%ebx
+  800a6d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a72:	0f 44 d8             	cmove  %eax,%ebx
+  800a75:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a7a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a7d:	eb 46                	jmp    800ac5 <strtol+0x90>
+		s++;
+  800a7f:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a82:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a87:	eb d5                	jmp    800a5e <strtol+0x29>
+		s++, neg = 1;
+  800a89:	83 c2 01             	add    $0x1,%edx
+  800a8c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a91:	eb cb                	jmp    800a5e <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a93:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a97:	74 0e                	je     800aa7 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a99:	85 db                	test   %ebx,%ebx
+  800a9b:	75 d8                	jne    800a75 <strtol+0x40>
+		s++, base = 8;
+  800a9d:	83 c2 01             	add    $0x1,%edx
+  800aa0:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800aa5:	eb ce                	jmp    800a75 <strtol+0x40>
+		s += 2, base = 16;
+  800aa7:	83 c2 02             	add    $0x2,%edx
+  800aaa:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800aaf:	eb c4                	jmp    800a75 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ab1:	0f be c0             	movsbl %al,%eax
+  800ab4:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ab7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800aba:	7d 3a                	jge    800af6 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800abc:	83 c2 01             	add    $0x1,%edx
+  800abf:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ac3:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ac5:	0f b6 02             	movzbl (%edx),%eax
+  800ac8:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800acb:	89 f3                	mov    %esi,%ebx
+  800acd:	80 fb 09             	cmp    $0x9,%bl
+  800ad0:	76 df                	jbe    800ab1 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ad2:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ad5:	89 f3                	mov    %esi,%ebx
+  800ad7:	80 fb 19             	cmp    $0x19,%bl
+  800ada:	77 08                	ja     800ae4 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800adc:	0f be c0             	movsbl %al,%eax
+  800adf:	83 e8 57             	sub    $0x57,%eax
+  800ae2:	eb d3                	jmp    800ab7 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ae4:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ae7:	89 f3                	mov    %esi,%ebx
+  800ae9:	80 fb 19             	cmp    $0x19,%bl
+  800aec:	77 08                	ja     800af6 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800aee:	0f be c0             	movsbl %al,%eax
+  800af1:	83 e8 37             	sub    $0x37,%eax
+  800af4:	eb c1                	jmp    800ab7 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800af6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800afa:	74 05                	je     800b01 <strtol+0xcc>
+		*endptr = (char *) s;
+  800afc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800aff:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b01:	89 c8                	mov    %ecx,%eax
+  800b03:	f7 d8                	neg    %eax
+  800b05:	85 ff                	test   %edi,%edi
+  800b07:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b0a:	89 c8                	mov    %ecx,%eax
+  800b0c:	5b                   	pop    %ebx
+  800b0d:	5e                   	pop    %esi
+  800b0e:	5f                   	pop    %edi
+  800b0f:	5d                   	pop    %ebp
+  800b10:	c3                   	ret
+
+00800b11 <atoi>:
+
+int
+atoi(const char *s)
+{
+  800b11:	55                   	push   %ebp
+  800b12:	89 e5                	mov    %esp,%ebp
+  800b14:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800b17:	6a 0a                	push   $0xa
+  800b19:	6a 00                	push   $0x0
+  800b1b:	ff 75 08             	push   0x8(%ebp)
+  800b1e:	e8 12 ff ff ff       	call   800a35 <strtol>
+}
+  800b23:	c9                   	leave
+  800b24:	c3                   	ret
+
+00800b25 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800b25:	55                   	push   %ebp
+  800b26:	89 e5                	mov    %esp,%ebp
+  800b28:	57                   	push   %edi
+  800b29:	56                   	push   %esi
+  800b2a:	53                   	push   %ebx
+  800b2b:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800b31:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800b37:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800b3d:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800b43:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800b4a:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800b4d:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800b54:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800b57:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800b5e:	74 76                	je     800bd6 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800b60:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800b66:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b69:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800b6f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800b76:	0f 88 06 01 00 00    	js     800c82 <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800b7c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800b83:	0f 84 48 01 00 00    	je     800cd1 <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800b89:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800b8f:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800b95:	be 00 00 00 00       	mov    $0x0,%esi
+  800b9a:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800ba0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ba3:	55                   	push   %ebp
+  800ba4:	68 ad 0b 80 00       	push   $0x800bad
+  800ba9:	89 e5                	mov    %esp,%ebp
+  800bab:	0f 34                	sysenter
+  800bad:	83 c4 04             	add    $0x4,%esp
+  800bb0:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800bb1:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800bb7:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800bbd:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800bc0:	0f 85 9a 01 00 00    	jne    800d60 <page_vec_call+0x23b>
+  800bc6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bcb:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bd1:	e9 29 01 00 00       	jmp    800cff <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800bd6:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800bdc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bdf:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800be1:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800be8:	78 2f                	js     800c19 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800bea:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800bf1:	74 72                	je     800c65 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800bf3:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800bf9:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800bff:	b8 10 00 00 00       	mov    $0x10,%eax
+  800c04:	89 fb                	mov    %edi,%ebx
+  800c06:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c09:	55                   	push   %ebp
+  800c0a:	68 13 0c 80 00       	push   $0x800c13
+  800c0f:	89 e5                	mov    %esp,%ebp
+  800c11:	0f 34                	sysenter
+  800c13:	83 c4 04             	add    $0x4,%esp
+  800c16:	5d                   	pop    %ebp
+	return ret;
+  800c17:	eb 98                	jmp    800bb1 <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800c19:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c1e:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800c20:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800c25:	f6 c6 08             	test   $0x8,%dh
+  800c28:	74 15                	je     800c3f <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c2a:	89 c2                	mov    %eax,%edx
+  800c2c:	c1 ea 08             	shr    $0x8,%edx
+  800c2f:	83 e2 0f             	and    $0xf,%edx
+  800c32:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800c37:	83 fa 06             	cmp    $0x6,%edx
+  800c3a:	74 0e                	je     800c4a <page_vec_call+0x125>
+  800c3c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800c3f:	0f b6 c9             	movzbl %cl,%ecx
+  800c42:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800c48:	eb a0                	jmp    800bea <page_vec_call+0xc5>
+  800c4a:	89 c2                	mov    %eax,%edx
+  800c4c:	c1 ea 04             	shr    $0x4,%edx
+  800c4f:	83 e2 0f             	and    $0xf,%edx
+  800c52:	83 fa 02             	cmp    $0x2,%edx
+  800c55:	77 e5                	ja     800c3c <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800c57:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c5a:	83 f8 02             	cmp    $0x2,%eax
+  800c5d:	0f 97 c1             	seta   %cl
+  800c60:	0f b6 c9             	movzbl %cl,%ecx
+  800c63:	eb d7                	jmp    800c3c <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800c65:	b8 10 00 00 00       	mov    $0x10,%eax
+  800c6a:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800c70:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800c76:	89 fb                	mov    %edi,%ebx
+  800c78:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c7b:	cd 30                	int    $0x30
+  800c7d:	e9 2f ff ff ff       	jmp    800bb1 <page_vec_call+0x8c>
+  800c82:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c87:	0f a2                	cpuid
+		return 0;
+  800c89:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800c8e:	f6 c6 08             	test   $0x8,%dh
+  800c91:	74 15                	je     800ca8 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c93:	89 c2                	mov    %eax,%edx
+  800c95:	c1 ea 08             	shr    $0x8,%edx
+  800c98:	83 e2 0f             	and    $0xf,%edx
+  800c9b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ca0:	83 fa 06             	cmp    $0x6,%edx
+  800ca3:	74 11                	je     800cb6 <page_vec_call+0x191>
+  800ca5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800ca8:	0f b6 c9             	movzbl %cl,%ecx
+  800cab:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800cb1:	e9 c6 fe ff ff       	jmp    800b7c <page_vec_call+0x57>
+  800cb6:	89 c2                	mov    %eax,%edx
+  800cb8:	c1 ea 04             	shr    $0x4,%edx
+  800cbb:	83 e2 0f             	and    $0xf,%edx
+  800cbe:	83 fa 02             	cmp    $0x2,%edx
+  800cc1:	77 e2                	ja     800ca5 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800cc3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800cc6:	83 f8 02             	cmp    $0x2,%eax
+  800cc9:	0f 97 c1             	seta   %cl
+  800ccc:	0f b6 c9             	movzbl %cl,%ecx
+  800ccf:	eb d4                	jmp    800ca5 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800cd1:	be 00 00 00 00       	mov    $0x0,%esi
+  800cd6:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800cdc:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800ce2:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800ce8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ceb:	cd 30                	int    $0x30
+  800ced:	e9 bf fe ff ff       	jmp    800bb1 <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800cf2:	29 da                	sub    %ebx,%edx
+			vec++;
+  800cf4:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800cf7:	83 e8 01             	sub    $0x1,%eax
+  800cfa:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800cff:	85 c0                	test   %eax,%eax
+  800d01:	74 58                	je     800d5b <page_vec_call+0x236>
+  800d03:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800d06:	39 da                	cmp    %ebx,%edx
+  800d08:	73 e8                	jae    800cf2 <page_vec_call+0x1cd>
+  800d0a:	89 75 08             	mov    %esi,0x8(%ebp)
+  800d0d:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800d10:	84 c9                	test   %cl,%cl
+  800d12:	74 06                	je     800d1a <page_vec_call+0x1f5>
+  800d14:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800d1a:	83 ec 04             	sub    $0x4,%esp
+  800d1d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d20:	c1 e0 04             	shl    $0x4,%eax
+  800d23:	50                   	push   %eax
+  800d24:	ff 75 08             	push   0x8(%ebp)
+  800d27:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800d2d:	53                   	push   %ebx
+  800d2e:	e8 34 fc ff ff       	call   800967 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800d33:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800d39:	89 c2                	mov    %eax,%edx
+  800d3b:	c1 e2 0c             	shl    $0xc,%edx
+  800d3e:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  800d44:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  800d4a:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  800d50:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  800d53:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  800d56:	e9 f2 fd ff ff       	jmp    800b4d <page_vec_call+0x28>
+			r = 0;
+  800d5b:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  800d60:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800d64:	74 0b                	je     800d71 <page_vec_call+0x24c>
+		*done = total;
+  800d66:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800d69:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  800d6f:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  800d71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d74:	5b                   	pop    %ebx
+  800d75:	5e                   	pop    %esi
+  800d76:	5f                   	pop    %edi
+  800d77:	5d                   	pop    %ebp
+  800d78:	c3                   	ret
+
+00800d79 <sys_cputs>:
+{
+  800d79:	55                   	push   %ebp
+  800d7a:	89 e5                	mov    %esp,%ebp
+  800d7c:	57                   	push   %edi
+  800d7d:	56                   	push   %esi
+  800d7e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800d7f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800d86:	78 2d                	js     800db5 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800d88:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800d8f:	74 70                	je     800e01 <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800d91:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d96:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d99:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d9c:	89 c3                	mov    %eax,%ebx
+  800d9e:	89 c7                	mov    %eax,%edi
+  800da0:	89 c6                	mov    %eax,%esi
+  800da2:	55                   	push   %ebp
+  800da3:	68 ac 0d 80 00       	push   $0x800dac
+  800da8:	89 e5                	mov    %esp,%ebp
+  800daa:	0f 34                	sysenter
+  800dac:	83 c4 04             	add    $0x4,%esp
+  800daf:	5d                   	pop    %ebp
+}
+  800db0:	5b                   	pop    %ebx
+  800db1:	5e                   	pop    %esi
+  800db2:	5f                   	pop    %edi
+  800db3:	5d                   	pop    %ebp
+  800db4:	c3                   	ret
+  800db5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dba:	0f a2                	cpuid
+		return 0;
+  800dbc:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800dc1:	f6 c6 08             	test   $0x8,%dh
+  800dc4:	74 15                	je     800ddb <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800dc6:	89 c2                	mov    %eax,%edx
+  800dc8:	c1 ea 08             	shr    $0x8,%edx
+  800dcb:	83 e2 0f             	and    $0xf,%edx
+  800dce:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800dd3:	83 fa 06             	cmp    $0x6,%edx
+  800dd6:	74 0e                	je     800de6 <sys_cputs+0x6d>
+  800dd8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800ddb:	0f b6 c9             	movzbl %cl,%ecx
+  800dde:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800de4:	eb a2                	jmp    800d88 <sys_cputs+0xf>
+  800de6:	89 c2                	mov    %eax,%edx
+  800de8:	c1 ea 04             	shr    $0x4,%edx
+  800deb:	83 e2 0f             	and    $0xf,%edx
+  800dee:	83 fa 02             	cmp    $0x2,%edx
+  800df1:	77 e5                	ja     800dd8 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800df3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800df6:	83 f8 02             	cmp    $0x2,%eax
+  800df9:	0f 97 c1             	seta   %cl
+  800dfc:	0f b6 c9             	movzbl %cl,%ecx
+  800dff:	eb d7                	jmp    800dd8 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800e01:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e06:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e09:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e0c:	89 c3                	mov    %eax,%ebx
+  800e0e:	89 c7                	mov    %eax,%edi
+  800e10:	89 c6                	mov    %eax,%esi
+  800e12:	cd 30                	int    $0x30
+}
+  800e14:	eb 9a                	jmp    800db0 <sys_cputs+0x37>
+
+00800e16 <sys_cgetc>:
+{
+  800e16:	55                   	push   %ebp
+  800e17:	89 e5                	mov    %esp,%ebp
+  800e19:	57                   	push   %edi
+  800e1a:	56                   	push   %esi
+  800e1b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800e1c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e23:	78 2e                	js     800e53 <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  800e25:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e2c:	74 71                	je     800e9f <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  800e2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e33:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e38:	89 d1                	mov    %edx,%ecx
+  800e3a:	89 d3                	mov    %edx,%ebx
+  800e3c:	89 d7                	mov    %edx,%edi
+  800e3e:	89 d6                	mov    %edx,%esi
+  800e40:	55                   	push   %ebp
+  800e41:	68 4a 0e 80 00       	push   $0x800e4a
+  800e46:	89 e5                	mov    %esp,%ebp
+  800e48:	0f 34                	sysenter
+  800e4a:	83 c4 04             	add    $0x4,%esp
+  800e4d:	5d                   	pop    %ebp
+}
+  800e4e:	5b                   	pop    %ebx
+  800e4f:	5e                   	pop    %esi
+  800e50:	5f                   	pop    %edi
+  800e51:	5d                   	pop    %ebp
+  800e52:	c3                   	ret
+  800e53:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e58:	0f a2                	cpuid
+		return 0;
+  800e5a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800e5f:	f6 c6 08             	test   $0x8,%dh
+  800e62:	74 15                	je     800e79 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e64:	89 c2                	mov    %eax,%edx
+  800e66:	c1 ea 08             	shr    $0x8,%edx
+  800e69:	83 e2 0f             	and    $0xf,%edx
+  800e6c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e71:	83 fa 06             	cmp    $0x6,%edx
+  800e74:	74 0e                	je     800e84 <sys_cgetc+0x6e>
+  800e76:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e79:	0f b6 c9             	movzbl %cl,%ecx
+  800e7c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800e82:	eb a1                	jmp    800e25 <sys_cgetc+0xf>
+  800e84:	89 c2                	mov    %eax,%edx
+  800e86:	c1 ea 04             	shr    $0x4,%edx
+  800e89:	83 e2 0f             	and    $0xf,%edx
+  800e8c:	83 fa 02             	cmp    $0x2,%edx
+  800e8f:	77 e5                	ja     800e76 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  800e91:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e94:	83 f8 02             	cmp    $0x2,%eax
+  800e97:	0f 97 c1             	seta   %cl
+  800e9a:	0f b6 c9             	movzbl %cl,%ecx
+  800e9d:	eb d7                	jmp    800e76 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  800e9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ea4:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ea9:	89 d1                	mov    %edx,%ecx
+  800eab:	89 d3                	mov    %edx,%ebx
+  800ead:	89 d7                	mov    %edx,%edi
+  800eaf:	89 d6                	mov    %edx,%esi
+  800eb1:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800eb3:	eb 99                	jmp    800e4e <sys_cgetc+0x38>
+
+00800eb5 <sys_env_destroy>:
+{
+  800eb5:	55                   	push   %ebp
+  800eb6:	89 e5                	mov    %esp,%ebp
+  800eb8:	57                   	push   %edi
+  800eb9:	56                   	push   %esi
+  800eba:	53                   	push   %ebx
+  800ebb:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800ebe:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800ec5:	78 36                	js     800efd <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  800ec7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800ece:	74 79                	je     800f49 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  800ed0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ed8:	b8 03 00 00 00       	mov    $0x3,%eax
+  800edd:	89 cb                	mov    %ecx,%ebx
+  800edf:	89 cf                	mov    %ecx,%edi
+  800ee1:	89 ce                	mov    %ecx,%esi
+  800ee3:	55                   	push   %ebp
+  800ee4:	68 ed 0e 80 00       	push   $0x800eed
+  800ee9:	89 e5                	mov    %esp,%ebp
+  800eeb:	0f 34                	sysenter
+  800eed:	83 c4 04             	add    $0x4,%esp
+  800ef0:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ef1:	85 c0                	test   %eax,%eax
+  800ef3:	7f 6b                	jg     800f60 <sys_env_destroy+0xab>
+}
+  800ef5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef8:	5b                   	pop    %ebx
+  800ef9:	5e                   	pop    %esi
+  800efa:	5f                   	pop    %edi
+  800efb:	5d                   	pop    %ebp
+  800efc:	c3                   	ret
+  800efd:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f02:	0f a2                	cpuid
+		return 0;
+  800f04:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f09:	f6 c6 08             	test   $0x8,%dh
+  800f0c:	74 15                	je     800f23 <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f0e:	89 c2                	mov    %eax,%edx
+  800f10:	c1 ea 08             	shr    $0x8,%edx
+  800f13:	83 e2 0f             	and    $0xf,%edx
+  800f16:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f1b:	83 fa 06             	cmp    $0x6,%edx
+  800f1e:	74 0e                	je     800f2e <sys_env_destroy+0x79>
+  800f20:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f23:	0f b6 c9             	movzbl %cl,%ecx
+  800f26:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800f2c:	eb 99                	jmp    800ec7 <sys_env_destroy+0x12>
+  800f2e:	89 c2                	mov    %eax,%edx
+  800f30:	c1 ea 04             	shr    $0x4,%edx
+  800f33:	83 e2 0f             	and    $0xf,%edx
+  800f36:	83 fa 02             	cmp    $0x2,%edx
+  800f39:	77 e5                	ja     800f20 <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  800f3b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f3e:	83 f8 02             	cmp    $0x2,%eax
+  800f41:	0f 97 c1             	seta   %cl
+  800f44:	0f b6 c9             	movzbl %cl,%ecx
+  800f47:	eb d7                	jmp    800f20 <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  800f49:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f4e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f53:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f56:	89 cb                	mov    %ecx,%ebx
+  800f58:	89 cf                	mov    %ecx,%edi
+  800f5a:	89 ce                	mov    %ecx,%esi
+  800f5c:	cd 30                	int    $0x30
+  800f5e:	eb 91                	jmp    800ef1 <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f60:	83 ec 0c             	sub    $0xc,%esp
+  800f63:	50                   	push   %eax
+  800f64:	6a 03                	push   $0x3
+  800f66:	68 59 32 80 00       	push   $0x803259
+  800f6b:	6a 4a                	push   $0x4a
+  800f6d:	68 76 32 80 00       	push   $0x803276
+  800f72:	e8 b2 1c 00 00       	call   802c29 <_panic>
+
+00800f77 <sys_getenvid>:
+{
+  800f77:	55                   	push   %ebp
+  800f78:	89 e5                	mov    %esp,%ebp
+  800f7a:	57                   	push   %edi
+  800f7b:	56                   	push   %esi
+  800f7c:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800f7d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800f84:	78 2e                	js     800fb4 <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  800f86:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800f8d:	74 71                	je     801000 <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  800f8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f94:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f99:	89 d1                	mov    %edx,%ecx
+  800f9b:	89 d3                	mov    %edx,%ebx
+  800f9d:	89 d7                	mov    %edx,%edi
+  800f9f:	89 d6                	mov    %edx,%esi
+  800fa1:	55                   	push   %ebp
+  800fa2:	68 ab 0f 80 00       	push   $0x800fab
+  800fa7:	89 e5                	mov    %esp,%ebp
+  800fa9:	0f 34                	sysenter
+  800fab:	83 c4 04             	add    $0x4,%esp
+  800fae:	5d                   	pop    %ebp
+}
+  800faf:	5b                   	pop    %ebx
+  800fb0:	5e                   	pop    %esi
+  800fb1:	5f                   	pop    %edi
+  800fb2:	5d                   	pop    %ebp
+  800fb3:	c3                   	ret
+  800fb4:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fb9:	0f a2                	cpuid
+		return 0;
+  800fbb:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800fc0:	f6 c6 08             	test   $0x8,%dh
+  800fc3:	74 15                	je     800fda <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800fc5:	89 c2                	mov    %eax,%edx
+  800fc7:	c1 ea 08             	shr    $0x8,%edx
+  800fca:	83 e2 0f             	and    $0xf,%edx
+  800fcd:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800fd2:	83 fa 06             	cmp    $0x6,%edx
+  800fd5:	74 0e                	je     800fe5 <sys_getenvid+0x6e>
+  800fd7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800fda:	0f b6 c9             	movzbl %cl,%ecx
+  800fdd:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800fe3:	eb a1                	jmp    800f86 <sys_getenvid+0xf>
+  800fe5:	89 c2                	mov    %eax,%edx
+  800fe7:	c1 ea 04             	shr    $0x4,%edx
+  800fea:	83 e2 0f             	and    $0xf,%edx
+  800fed:	83 fa 02             	cmp    $0x2,%edx
+  800ff0:	77 e5                	ja     800fd7 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  800ff2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ff5:	83 f8 02             	cmp    $0x2,%eax
+  800ff8:	0f 97 c1             	seta   %cl
+  800ffb:	0f b6 c9             	movzbl %cl,%ecx
+  800ffe:	eb d7                	jmp    800fd7 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  801000:	ba 00 00 00 00       	mov    $0x0,%edx
+  801005:	b8 02 00 00 00       	mov    $0x2,%eax
+  80100a:	89 d1                	mov    %edx,%ecx
+  80100c:	89 d3                	mov    %edx,%ebx
+  80100e:	89 d7                	mov    %edx,%edi
+  801010:	89 d6                	mov    %edx,%esi
+  801012:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801014:	eb 99                	jmp    800faf <sys_getenvid+0x38>
+
+00801016 <sys_page_alloc>:
+{
+  801016:	55                   	push   %ebp
+  801017:	89 e5                	mov    %esp,%ebp
+  801019:	57                   	push   %edi
+  80101a:	56                   	push   %esi
+  80101b:	53                   	push   %ebx
+  80101c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80101f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801026:	78 38                	js     801060 <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  801028:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80102f:	74 7b                	je     8010ac <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  801031:	be 00 00 00 00       	mov    $0x0,%esi
+  801036:	8b 55 08             	mov    0x8(%ebp),%edx
+  801039:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103c:	b8 04 00 00 00       	mov    $0x4,%eax
+  801041:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801044:	89 f7                	mov    %esi,%edi
+  801046:	55                   	push   %ebp
+  801047:	68 50 10 80 00       	push   $0x801050
+  80104c:	89 e5                	mov    %esp,%ebp
+  80104e:	0f 34                	sysenter
+  801050:	83 c4 04             	add    $0x4,%esp
+  801053:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801054:	85 c0                	test   %eax,%eax
+  801056:	7f 6d                	jg     8010c5 <sys_page_alloc+0xaf>
+}
+  801058:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80105b:	5b                   	pop    %ebx
+  80105c:	5e                   	pop    %esi
+  80105d:	5f                   	pop    %edi
+  80105e:	5d                   	pop    %ebp
+  80105f:	c3                   	ret
+  801060:	b8 01 00 00 00       	mov    $0x1,%eax
+  801065:	0f a2                	cpuid
+		return 0;
+  801067:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80106c:	f6 c6 08             	test   $0x8,%dh
+  80106f:	74 15                	je     801086 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801071:	89 c2                	mov    %eax,%edx
+  801073:	c1 ea 08             	shr    $0x8,%edx
+  801076:	83 e2 0f             	and    $0xf,%edx
+  801079:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80107e:	83 fa 06             	cmp    $0x6,%edx
+  801081:	74 0e                	je     801091 <sys_page_alloc+0x7b>
+  801083:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801086:	0f b6 c9             	movzbl %cl,%ecx
+  801089:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80108f:	eb 97                	jmp    801028 <sys_page_alloc+0x12>
+  801091:	89 c2                	mov    %eax,%edx
+  801093:	c1 ea 04             	shr    $0x4,%edx
+  801096:	83 e2 0f             	and    $0xf,%edx
+  801099:	83 fa 02             	cmp    $0x2,%edx
+  80109c:	77 e5                	ja     801083 <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  80109e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010a1:	83 f8 02             	cmp    $0x2,%eax
+  8010a4:	0f 97 c1             	seta   %cl
+  8010a7:	0f b6 c9             	movzbl %cl,%ecx
+  8010aa:	eb d7                	jmp    801083 <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  8010ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8010b1:	b8 04 00 00 00       	mov    $0x4,%eax
+  8010b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010bc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010bf:	89 f7                	mov    %esi,%edi
+  8010c1:	cd 30                	int    $0x30
+  8010c3:	eb 8f                	jmp    801054 <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010c5:	83 ec 0c             	sub    $0xc,%esp
+  8010c8:	50                   	push   %eax
+  8010c9:	6a 04                	push   $0x4
+  8010cb:	68 59 32 80 00       	push   $0x803259
+  8010d0:	6a 4a                	push   $0x4a
+  8010d2:	68 76 32 80 00       	push   $0x803276
+  8010d7:	e8 4d 1b 00 00       	call   802c29 <_panic>
+
+008010dc <sys_page_map>:
+{
+  8010dc:	55                   	push   %ebp
+  8010dd:	89 e5                	mov    %esp,%ebp
+  8010df:	57                   	push   %edi
+  8010e0:	56                   	push   %esi
+  8010e1:	53                   	push   %ebx
+  8010e2:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8010e5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8010ec:	78 37                	js     801125 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  8010ee:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8010f5:	74 7a                	je     801171 <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  8010f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010fd:	b8 05 00 00 00       	mov    $0x5,%eax
+  801102:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801105:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801108:	8b 75 18             	mov    0x18(%ebp),%esi
+  80110b:	55                   	push   %ebp
+  80110c:	68 15 11 80 00       	push   $0x801115
+  801111:	89 e5                	mov    %esp,%ebp
+  801113:	0f 34                	sysenter
+  801115:	83 c4 04             	add    $0x4,%esp
+  801118:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801119:	85 c0                	test   %eax,%eax
+  80111b:	7f 6c                	jg     801189 <sys_page_map+0xad>
+}
+  80111d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801120:	5b                   	pop    %ebx
+  801121:	5e                   	pop    %esi
+  801122:	5f                   	pop    %edi
+  801123:	5d                   	pop    %ebp
+  801124:	c3                   	ret
+  801125:	b8 01 00 00 00       	mov    $0x1,%eax
+  80112a:	0f a2                	cpuid
+		return 0;
+  80112c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801131:	f6 c6 08             	test   $0x8,%dh
+  801134:	74 15                	je     80114b <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801136:	89 c2                	mov    %eax,%edx
+  801138:	c1 ea 08             	shr    $0x8,%edx
+  80113b:	83 e2 0f             	and    $0xf,%edx
+  80113e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801143:	83 fa 06             	cmp    $0x6,%edx
+  801146:	74 0e                	je     801156 <sys_page_map+0x7a>
+  801148:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80114b:	0f b6 c9             	movzbl %cl,%ecx
+  80114e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801154:	eb 98                	jmp    8010ee <sys_page_map+0x12>
+  801156:	89 c2                	mov    %eax,%edx
+  801158:	c1 ea 04             	shr    $0x4,%edx
+  80115b:	83 e2 0f             	and    $0xf,%edx
+  80115e:	83 fa 02             	cmp    $0x2,%edx
+  801161:	77 e5                	ja     801148 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  801163:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801166:	83 f8 02             	cmp    $0x2,%eax
+  801169:	0f 97 c1             	seta   %cl
+  80116c:	0f b6 c9             	movzbl %cl,%ecx
+  80116f:	eb d7                	jmp    801148 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  801171:	b8 05 00 00 00       	mov    $0x5,%eax
+  801176:	8b 55 08             	mov    0x8(%ebp),%edx
+  801179:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80117c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80117f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801182:	8b 75 18             	mov    0x18(%ebp),%esi
+  801185:	cd 30                	int    $0x30
+  801187:	eb 90                	jmp    801119 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801189:	83 ec 0c             	sub    $0xc,%esp
+  80118c:	50                   	push   %eax
+  80118d:	6a 05                	push   $0x5
+  80118f:	68 59 32 80 00       	push   $0x803259
+  801194:	6a 4a                	push   $0x4a
+  801196:	68 76 32 80 00       	push   $0x803276
+  80119b:	e8 89 1a 00 00       	call   802c29 <_panic>
+
+008011a0 <sys_page_unmap>:
+{
+  8011a0:	55                   	push   %ebp
+  8011a1:	89 e5                	mov    %esp,%ebp
+  8011a3:	57                   	push   %edi
+  8011a4:	56                   	push   %esi
+  8011a5:	53                   	push   %ebx
+  8011a6:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8011a9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8011b0:	78 37                	js     8011e9 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  8011b2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8011b9:	74 7a                	je     801235 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  8011bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c6:	b8 06 00 00 00       	mov    $0x6,%eax
+  8011cb:	89 df                	mov    %ebx,%edi
+  8011cd:	89 de                	mov    %ebx,%esi
+  8011cf:	55                   	push   %ebp
+  8011d0:	68 d9 11 80 00       	push   $0x8011d9
+  8011d5:	89 e5                	mov    %esp,%ebp
+  8011d7:	0f 34                	sysenter
+  8011d9:	83 c4 04             	add    $0x4,%esp
+  8011dc:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8011dd:	85 c0                	test   %eax,%eax
+  8011df:	7f 6c                	jg     80124d <sys_page_unmap+0xad>
+}
+  8011e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e4:	5b                   	pop    %ebx
+  8011e5:	5e                   	pop    %esi
+  8011e6:	5f                   	pop    %edi
+  8011e7:	5d                   	pop    %ebp
+  8011e8:	c3                   	ret
+  8011e9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011ee:	0f a2                	cpuid
+		return 0;
+  8011f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8011f5:	f6 c6 08             	test   $0x8,%dh
+  8011f8:	74 15                	je     80120f <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011fa:	89 c2                	mov    %eax,%edx
+  8011fc:	c1 ea 08             	shr    $0x8,%edx
+  8011ff:	83 e2 0f             	and    $0xf,%edx
+  801202:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801207:	83 fa 06             	cmp    $0x6,%edx
+  80120a:	74 0e                	je     80121a <sys_page_unmap+0x7a>
+  80120c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80120f:	0f b6 c9             	movzbl %cl,%ecx
+  801212:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801218:	eb 98                	jmp    8011b2 <sys_page_unmap+0x12>
+  80121a:	89 c2                	mov    %eax,%edx
+  80121c:	c1 ea 04             	shr    $0x4,%edx
+  80121f:	83 e2 0f             	and    $0xf,%edx
+  801222:	83 fa 02             	cmp    $0x2,%edx
+  801225:	77 e5                	ja     80120c <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  801227:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80122a:	83 f8 02             	cmp    $0x2,%eax
+  80122d:	0f 97 c1             	seta   %cl
+  801230:	0f b6 c9             	movzbl %cl,%ecx
+  801233:	eb d7                	jmp    80120c <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  801235:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80123a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80123f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801242:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801245:	89 df                	mov    %ebx,%edi
+  801247:	89 de                	mov    %ebx,%esi
+  801249:	cd 30                	int    $0x30
+  80124b:	eb 90                	jmp    8011dd <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80124d:	83 ec 0c             	sub    $0xc,%esp
+  801250:	50                   	push   %eax
+  801251:	6a 06                	push   $0x6
+  801253:	68 59 32 80 00       	push   $0x803259
+  801258:	6a 4a                	push   $0x4a
+  80125a:	68 76 32 80 00       	push   $0x803276
+  80125f:	e8 c5 19 00 00       	call   802c29 <_panic>
+
+00801264 <sys_page_copy>:
+{
+  801264:	55                   	push   %ebp
+  801265:	89 e5                	mov    %esp,%ebp
+  801267:	57                   	push   %edi
+  801268:	56                   	push   %esi
+  801269:	53                   	push   %ebx
+  80126a:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80126d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801274:	78 37                	js     8012ad <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  801276:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80127d:	74 7a                	je     8012f9 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  80127f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801282:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801285:	b8 29 00 00 00       	mov    $0x29,%eax
+  80128a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80128d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801290:	8b 75 18             	mov    0x18(%ebp),%esi
+  801293:	55                   	push   %ebp
+  801294:	68 9d 12 80 00       	push   $0x80129d
+  801299:	89 e5                	mov    %esp,%ebp
+  80129b:	0f 34                	sysenter
+  80129d:	83 c4 04             	add    $0x4,%esp
+  8012a0:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8012a1:	85 c0                	test   %eax,%eax
+  8012a3:	7f 6c                	jg     801311 <sys_page_copy+0xad>
+}
+  8012a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012a8:	5b                   	pop    %ebx
+  8012a9:	5e                   	pop    %esi
+  8012aa:	5f                   	pop    %edi
+  8012ab:	5d                   	pop    %ebp
+  8012ac:	c3                   	ret
+  8012ad:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012b2:	0f a2                	cpuid
+		return 0;
+  8012b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8012b9:	f6 c6 08             	test   $0x8,%dh
+  8012bc:	74 15                	je     8012d3 <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012be:	89 c2                	mov    %eax,%edx
+  8012c0:	c1 ea 08             	shr    $0x8,%edx
+  8012c3:	83 e2 0f             	and    $0xf,%edx
+  8012c6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012cb:	83 fa 06             	cmp    $0x6,%edx
+  8012ce:	74 0e                	je     8012de <sys_page_copy+0x7a>
+  8012d0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8012d3:	0f b6 c9             	movzbl %cl,%ecx
+  8012d6:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8012dc:	eb 98                	jmp    801276 <sys_page_copy+0x12>
+  8012de:	89 c2                	mov    %eax,%edx
+  8012e0:	c1 ea 04             	shr    $0x4,%edx
+  8012e3:	83 e2 0f             	and    $0xf,%edx
+  8012e6:	83 fa 02             	cmp    $0x2,%edx
+  8012e9:	77 e5                	ja     8012d0 <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  8012eb:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012ee:	83 f8 02             	cmp    $0x2,%eax
+  8012f1:	0f 97 c1             	seta   %cl
+  8012f4:	0f b6 c9             	movzbl %cl,%ecx
+  8012f7:	eb d7                	jmp    8012d0 <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  8012f9:	b8 29 00 00 00       	mov    $0x29,%eax
+  8012fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801301:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801304:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801307:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80130a:	8b 75 18             	mov    0x18(%ebp),%esi
+  80130d:	cd 30                	int    $0x30
+  80130f:	eb 90                	jmp    8012a1 <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801311:	83 ec 0c             	sub    $0xc,%esp
+  801314:	50                   	push   %eax
+  801315:	6a 29                	push   $0x29
+  801317:	68 59 32 80 00       	push   $0x803259
+  80131c:	6a 4a                	push   $0x4a
+  80131e:	68 76 32 80 00       	push   $0x803276
+  801323:	e8 01 19 00 00       	call   802c29 <_panic>
+
+00801328 <sys_yield>:
+{
+  801328:	55                   	push   %ebp
+  801329:	89 e5                	mov    %esp,%ebp
+  80132b:	57                   	push   %edi
+  80132c:	56                   	push   %esi
+  80132d:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80132e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801335:	78 2e                	js     801365 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  801337:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80133e:	74 71                	je     8013b1 <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  801340:	ba 00 00 00 00       	mov    $0x0,%edx
+  801345:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80134a:	89 d1                	mov    %edx,%ecx
+  80134c:	89 d3                	mov    %edx,%ebx
+  80134e:	89 d7                	mov    %edx,%edi
+  801350:	89 d6                	mov    %edx,%esi
+  801352:	55                   	push   %ebp
+  801353:	68 5c 13 80 00       	push   $0x80135c
+  801358:	89 e5                	mov    %esp,%ebp
+  80135a:	0f 34                	sysenter
+  80135c:	83 c4 04             	add    $0x4,%esp
+  80135f:	5d                   	pop    %ebp
+}
+  801360:	5b                   	pop    %ebx
+  801361:	5e                   	pop    %esi
+  801362:	5f                   	pop    %edi
+  801363:	5d                   	pop    %ebp
+  801364:	c3                   	ret
+  801365:	b8 01 00 00 00       	mov    $0x1,%eax
+  80136a:	0f a2                	cpuid
+		return 0;
+  80136c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801371:	f6 c6 08             	test   $0x8,%dh
+  801374:	74 15                	je     80138b <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801376:	89 c2                	mov    %eax,%edx
+  801378:	c1 ea 08             	shr    $0x8,%edx
+  80137b:	83 e2 0f             	and    $0xf,%edx
+  80137e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801383:	83 fa 06             	cmp    $0x6,%edx
+  801386:	74 0e                	je     801396 <sys_yield+0x6e>
+  801388:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80138b:	0f b6 c9             	movzbl %cl,%ecx
+  80138e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801394:	eb a1                	jmp    801337 <sys_yield+0xf>
+  801396:	89 c2                	mov    %eax,%edx
+  801398:	c1 ea 04             	shr    $0x4,%edx
+  80139b:	83 e2 0f             	and    $0xf,%edx
+  80139e:	83 fa 02             	cmp    $0x2,%edx
+  8013a1:	77 e5                	ja     801388 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  8013a3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013a6:	83 f8 02             	cmp    $0x2,%eax
+  8013a9:	0f 97 c1             	seta   %cl
+  8013ac:	0f b6 c9             	movzbl %cl,%ecx
+  8013af:	eb d7                	jmp    801388 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  8013b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013b6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8013bb:	89 d1                	mov    %edx,%ecx
+  8013bd:	89 d3                	mov    %edx,%ebx
+  8013bf:	89 d7                	mov    %edx,%edi
+  8013c1:	89 d6                	mov    %edx,%esi
+  8013c3:	cd 30                	int    $0x30
+}
+  8013c5:	eb 99                	jmp    801360 <sys_yield+0x38>
+
+008013c7 <sys_env_set_status>:
+{
+  8013c7:	55                   	push   %ebp
+  8013c8:	89 e5                	mov    %esp,%ebp
+  8013ca:	57                   	push   %edi
+  8013cb:	56                   	push   %esi
+  8013cc:	53                   	push   %ebx
+  8013cd:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8013d0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8013d7:	78 37                	js     801410 <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  8013d9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8013e0:	74 7a                	je     80145c <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  8013e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013ed:	b8 08 00 00 00       	mov    $0x8,%eax
+  8013f2:	89 df                	mov    %ebx,%edi
+  8013f4:	89 de                	mov    %ebx,%esi
+  8013f6:	55                   	push   %ebp
+  8013f7:	68 00 14 80 00       	push   $0x801400
+  8013fc:	89 e5                	mov    %esp,%ebp
+  8013fe:	0f 34                	sysenter
+  801400:	83 c4 04             	add    $0x4,%esp
+  801403:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801404:	85 c0                	test   %eax,%eax
+  801406:	7f 6c                	jg     801474 <sys_env_set_status+0xad>
+}
+  801408:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80140b:	5b                   	pop    %ebx
+  80140c:	5e                   	pop    %esi
+  80140d:	5f                   	pop    %edi
+  80140e:	5d                   	pop    %ebp
+  80140f:	c3                   	ret
+  801410:	b8 01 00 00 00       	mov    $0x1,%eax
+  801415:	0f a2                	cpuid
+		return 0;
+  801417:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80141c:	f6 c6 08             	test   $0x8,%dh
+  80141f:	74 15                	je     801436 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801421:	89 c2                	mov    %eax,%edx
+  801423:	c1 ea 08             	shr    $0x8,%edx
+  801426:	83 e2 0f             	and    $0xf,%edx
+  801429:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80142e:	83 fa 06             	cmp    $0x6,%edx
+  801431:	74 0e                	je     801441 <sys_env_set_status+0x7a>
+  801433:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801436:	0f b6 c9             	movzbl %cl,%ecx
+  801439:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80143f:	eb 98                	jmp    8013d9 <sys_env_set_status+0x12>
+  801441:	89 c2                	mov    %eax,%edx
+  801443:	c1 ea 04             	shr    $0x4,%edx
+  801446:	83 e2 0f             	and    $0xf,%edx
+  801449:	83 fa 02             	cmp    $0x2,%edx
+  80144c:	77 e5                	ja     801433 <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  80144e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801451:	83 f8 02             	cmp    $0x2,%eax
+  801454:	0f 97 c1             	seta   %cl
+  801457:	0f b6 c9             	movzbl %cl,%ecx
+  80145a:	eb d7                	jmp    801433 <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  80145c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801461:	b8 08 00 00 00       	mov    $0x8,%eax
+  801466:	8b 55 08             	mov    0x8(%ebp),%edx
+  801469:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80146c:	89 df                	mov    %ebx,%edi
+  80146e:	89 de                	mov    %ebx,%esi
+  801470:	cd 30                	int    $0x30
+  801472:	eb 90                	jmp    801404 <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801474:	83 ec 0c             	sub    $0xc,%esp
+  801477:	50                   	push   %eax
+  801478:	6a 08                	push   $0x8
+  80147a:	68 59 32 80 00       	push   $0x803259
+  80147f:	6a 4a                	push   $0x4a
+  801481:	68 76 32 80 00       	push   $0x803276
+  801486:	e8 9e 17 00 00       	call   802c29 <_panic>
+
+0080148b <sys_sysinfo>:
+{
+  80148b:	55                   	push   %ebp
+  80148c:	89 e5                	mov    %esp,%ebp
+  80148e:	57                   	push   %edi
+  80148f:	56                   	push   %esi
+  801490:	53                   	push   %ebx
+  801491:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801494:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80149b:	78 36                	js     8014d3 <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  80149d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8014a4:	74 79                	je     80151f <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  8014a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014ae:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8014b3:	89 cb                	mov    %ecx,%ebx
+  8014b5:	89 cf                	mov    %ecx,%edi
+  8014b7:	89 ce                	mov    %ecx,%esi
+  8014b9:	55                   	push   %ebp
+  8014ba:	68 c3 14 80 00       	push   $0x8014c3
+  8014bf:	89 e5                	mov    %esp,%ebp
+  8014c1:	0f 34                	sysenter
+  8014c3:	83 c4 04             	add    $0x4,%esp
+  8014c6:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8014c7:	85 c0                	test   %eax,%eax
+  8014c9:	7f 6b                	jg     801536 <sys_sysinfo+0xab>
+}
+  8014cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ce:	5b                   	pop    %ebx
+  8014cf:	5e                   	pop    %esi
+  8014d0:	5f                   	pop    %edi
+  8014d1:	5d                   	pop    %ebp
+  8014d2:	c3                   	ret
+  8014d3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014d8:	0f a2                	cpuid
+		return 0;
+  8014da:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8014df:	f6 c6 08             	test   $0x8,%dh
+  8014e2:	74 15                	je     8014f9 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014e4:	89 c2                	mov    %eax,%edx
+  8014e6:	c1 ea 08             	shr    $0x8,%edx
+  8014e9:	83 e2 0f             	and    $0xf,%edx
+  8014ec:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8014f1:	83 fa 06             	cmp    $0x6,%edx
+  8014f4:	74 0e                	je     801504 <sys_sysinfo+0x79>
+  8014f6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8014f9:	0f b6 c9             	movzbl %cl,%ecx
+  8014fc:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801502:	eb 99                	jmp    80149d <sys_sysinfo+0x12>
+  801504:	89 c2                	mov    %eax,%edx
+  801506:	c1 ea 04             	shr    $0x4,%edx
+  801509:	83 e2 0f             	and    $0xf,%edx
+  80150c:	83 fa 02             	cmp    $0x2,%edx
+  80150f:	77 e5                	ja     8014f6 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  801511:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801514:	83 f8 02             	cmp    $0x2,%eax
+  801517:	0f 97 c1             	seta   %cl
+  80151a:	0f b6 c9             	movzbl %cl,%ecx
+  80151d:	eb d7                	jmp    8014f6 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  80151f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801524:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801529:	8b 55 08             	mov    0x8(%ebp),%edx
+  80152c:	89 cb                	mov    %ecx,%ebx
+  80152e:	89 cf                	mov    %ecx,%edi
+  801530:	89 ce                	mov    %ecx,%esi
+  801532:	cd 30                	int    $0x30
+  801534:	eb 91                	jmp    8014c7 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801536:	83 ec 0c             	sub    $0xc,%esp
+  801539:	50                   	push   %eax
+  80153a:	6a 0b                	push   $0xb
+  80153c:	68 59 32 80 00       	push   $0x803259
+  801541:	6a 4a                	push   $0x4a
+  801543:	68 76 32 80 00       	push   $0x803276
+  801548:	e8 dc 16 00 00       	call   802c29 <_panic>
+
+0080154d <sys_env_set_trapframe>:
+{
+  80154d:	55                   	push   %ebp
+  80154e:	89 e5                	mov    %esp,%ebp
+  801550:	57                   	push   %edi
+  801551:	56                   	push   %esi
+  801552:	53                   	push   %ebx
+  801553:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801556:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80155d:	78 37                	js     801596 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  80155f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801566:	74 7a                	je     8015e2 <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  801568:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80156d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801570:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801573:	b8 13 00 00 00       	mov    $0x13,%eax
+  801578:	89 df                	mov    %ebx,%edi
+  80157a:	89 de                	mov    %ebx,%esi
+  80157c:	55                   	push   %ebp
+  80157d:	68 86 15 80 00       	push   $0x801586
+  801582:	89 e5                	mov    %esp,%ebp
+  801584:	0f 34                	sysenter
+  801586:	83 c4 04             	add    $0x4,%esp
+  801589:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80158a:	85 c0                	test   %eax,%eax
+  80158c:	7f 6c                	jg     8015fa <sys_env_set_trapframe+0xad>
+}
+  80158e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801591:	5b                   	pop    %ebx
+  801592:	5e                   	pop    %esi
+  801593:	5f                   	pop    %edi
+  801594:	5d                   	pop    %ebp
+  801595:	c3                   	ret
+  801596:	b8 01 00 00 00       	mov    $0x1,%eax
+  80159b:	0f a2                	cpuid
+		return 0;
+  80159d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8015a2:	f6 c6 08             	test   $0x8,%dh
+  8015a5:	74 15                	je     8015bc <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015a7:	89 c2                	mov    %eax,%edx
+  8015a9:	c1 ea 08             	shr    $0x8,%edx
+  8015ac:	83 e2 0f             	and    $0xf,%edx
+  8015af:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8015b4:	83 fa 06             	cmp    $0x6,%edx
+  8015b7:	74 0e                	je     8015c7 <sys_env_set_trapframe+0x7a>
+  8015b9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8015bc:	0f b6 c9             	movzbl %cl,%ecx
+  8015bf:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8015c5:	eb 98                	jmp    80155f <sys_env_set_trapframe+0x12>
+  8015c7:	89 c2                	mov    %eax,%edx
+  8015c9:	c1 ea 04             	shr    $0x4,%edx
+  8015cc:	83 e2 0f             	and    $0xf,%edx
+  8015cf:	83 fa 02             	cmp    $0x2,%edx
+  8015d2:	77 e5                	ja     8015b9 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  8015d4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015d7:	83 f8 02             	cmp    $0x2,%eax
+  8015da:	0f 97 c1             	seta   %cl
+  8015dd:	0f b6 c9             	movzbl %cl,%ecx
+  8015e0:	eb d7                	jmp    8015b9 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  8015e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015e7:	b8 13 00 00 00       	mov    $0x13,%eax
+  8015ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015f2:	89 df                	mov    %ebx,%edi
+  8015f4:	89 de                	mov    %ebx,%esi
+  8015f6:	cd 30                	int    $0x30
+  8015f8:	eb 90                	jmp    80158a <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015fa:	83 ec 0c             	sub    $0xc,%esp
+  8015fd:	50                   	push   %eax
+  8015fe:	6a 13                	push   $0x13
+  801600:	68 59 32 80 00       	push   $0x803259
+  801605:	6a 4a                	push   $0x4a
+  801607:	68 76 32 80 00       	push   $0x803276
+  80160c:	e8 18 16 00 00       	call   802c29 <_panic>
+
+00801611 <sys_env_set_stack_limit>:
+{
+  801611:	55                   	push   %ebp
+  801612:	89 e5                	mov    %esp,%ebp
+  801614:	57                   	push   %edi
+  801615:	56                   	push   %esi
+  801616:	53                   	push   %ebx
+  801617:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80161a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801621:	78 37                	js     80165a <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  801623:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80162a:	74 7a                	je     8016a6 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  80162c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801631:	8b 55 08             	mov    0x8(%ebp),%edx
+  801634:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801637:	b8 19 00 00 00       	mov    $0x19,%eax
+  80163c:	89 df                	mov    %ebx,%edi
+  80163e:	89 de                	mov    %ebx,%esi
+  801640:	55                   	push   %ebp
+  801641:	68 4a 16 80 00       	push   $0x80164a
+  801646:	89 e5                	mov    %esp,%ebp
+  801648:	0f 34                	sysenter
+  80164a:	83 c4 04             	add    $0x4,%esp
+  80164d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80164e:	85 c0                	test   %eax,%eax
+  801650:	7f 6c                	jg     8016be <sys_env_set_stack_limit+0xad>
+}
+  801652:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801655:	5b                   	pop    %ebx
+  801656:	5e                   	pop    %esi
+  801657:	5f                   	pop    %edi
+  801658:	5d                   	pop    %ebp
+  801659:	c3                   	ret
+  80165a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80165f:	0f a2                	cpuid
+		return 0;
+  801661:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801666:	f6 c6 08             	test   $0x8,%dh
+  801669:	74 15                	je     801680 <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80166b:	89 c2                	mov    %eax,%edx
+  80166d:	c1 ea 08             	shr    $0x8,%edx
+  801670:	83 e2 0f             	and    $0xf,%edx
+  801673:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801678:	83 fa 06             	cmp    $0x6,%edx
+  80167b:	74 0e                	je     80168b <sys_env_set_stack_limit+0x7a>
+  80167d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801680:	0f b6 c9             	movzbl %cl,%ecx
+  801683:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801689:	eb 98                	jmp    801623 <sys_env_set_stack_limit+0x12>
+  80168b:	89 c2                	mov    %eax,%edx
+  80168d:	c1 ea 04             	shr    $0x4,%edx
+  801690:	83 e2 0f             	and    $0xf,%edx
+  801693:	83 fa 02             	cmp    $0x2,%edx
+  801696:	77 e5                	ja     80167d <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  801698:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80169b:	83 f8 02             	cmp    $0x2,%eax
+  80169e:	0f 97 c1             	seta   %cl
+  8016a1:	0f b6 c9             	movzbl %cl,%ecx
+  8016a4:	eb d7                	jmp    80167d <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  8016a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016ab:	b8 19 00 00 00       	mov    $0x19,%eax
+  8016b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016b6:	89 df                	mov    %ebx,%edi
+  8016b8:	89 de                	mov    %ebx,%esi
+  8016ba:	cd 30                	int    $0x30
+  8016bc:	eb 90                	jmp    80164e <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016be:	83 ec 0c             	sub    $0xc,%esp
+  8016c1:	50                   	push   %eax
+  8016c2:	6a 19                	push   $0x19
+  8016c4:	68 59 32 80 00       	push   $0x803259
+  8016c9:	6a 4a                	push   $0x4a
+  8016cb:	68 76 32 80 00       	push   $0x803276
+  8016d0:	e8 54 15 00 00       	call   802c29 <_panic>
+
+008016d5 <sys_env_set_pgfault_upcall>:
+{
+  8016d5:	55                   	push   %ebp
+  8016d6:	89 e5                	mov    %esp,%ebp
+  8016d8:	57                   	push   %edi
+  8016d9:	56                   	push   %esi
+  8016da:	53                   	push   %ebx
+  8016db:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8016de:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8016e5:	78 37                	js     80171e <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  8016e7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8016ee:	74 7a                	je     80176a <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  8016f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016fb:	b8 09 00 00 00       	mov    $0x9,%eax
+  801700:	89 df                	mov    %ebx,%edi
+  801702:	89 de                	mov    %ebx,%esi
+  801704:	55                   	push   %ebp
+  801705:	68 0e 17 80 00       	push   $0x80170e
+  80170a:	89 e5                	mov    %esp,%ebp
+  80170c:	0f 34                	sysenter
+  80170e:	83 c4 04             	add    $0x4,%esp
+  801711:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801712:	85 c0                	test   %eax,%eax
+  801714:	7f 6c                	jg     801782 <sys_env_set_pgfault_upcall+0xad>
+}
+  801716:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801719:	5b                   	pop    %ebx
+  80171a:	5e                   	pop    %esi
+  80171b:	5f                   	pop    %edi
+  80171c:	5d                   	pop    %ebp
+  80171d:	c3                   	ret
+  80171e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801723:	0f a2                	cpuid
+		return 0;
+  801725:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80172a:	f6 c6 08             	test   $0x8,%dh
+  80172d:	74 15                	je     801744 <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80172f:	89 c2                	mov    %eax,%edx
+  801731:	c1 ea 08             	shr    $0x8,%edx
+  801734:	83 e2 0f             	and    $0xf,%edx
+  801737:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80173c:	83 fa 06             	cmp    $0x6,%edx
+  80173f:	74 0e                	je     80174f <sys_env_set_pgfault_upcall+0x7a>
+  801741:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801744:	0f b6 c9             	movzbl %cl,%ecx
+  801747:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80174d:	eb 98                	jmp    8016e7 <sys_env_set_pgfault_upcall+0x12>
+  80174f:	89 c2                	mov    %eax,%edx
+  801751:	c1 ea 04             	shr    $0x4,%edx
+  801754:	83 e2 0f             	and    $0xf,%edx
+  801757:	83 fa 02             	cmp    $0x2,%edx
+  80175a:	77 e5                	ja     801741 <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  80175c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80175f:	83 f8 02             	cmp    $0x2,%eax
+  801762:	0f 97 c1             	seta   %cl
+  801765:	0f b6 c9             	movzbl %cl,%ecx
+  801768:	eb d7                	jmp    801741 <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  80176a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80176f:	b8 09 00 00 00       	mov    $0x9,%eax
+  801774:	8b 55 08             	mov    0x8(%ebp),%edx
+  801777:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80177a:	89 df                	mov    %ebx,%edi
+  80177c:	89 de                	mov    %ebx,%esi
+  80177e:	cd 30                	int    $0x30
+  801780:	eb 90                	jmp    801712 <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801782:	83 ec 0c             	sub    $0xc,%esp
+  801785:	50                   	push   %eax
+  801786:	6a 09                	push   $0x9
+  801788:	68 59 32 80 00       	push   $0x803259
+  80178d:	6a 4a                	push   $0x4a
+  80178f:	68 76 32 80 00       	push   $0x803276
+  801794:	e8 90 14 00 00       	call   802c29 <_panic>
+
+00801799 <sys_ipc_try_send>:
+{
+  801799:	55                   	push   %ebp
+  80179a:	89 e5                	mov    %esp,%ebp
+  80179c:	57                   	push   %edi
+  80179d:	56                   	push   %esi
+  80179e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80179f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8017a6:	78 32                	js     8017da <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  8017a8:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8017af:	74 75                	je     801826 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  8017b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017b7:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8017bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8017c1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017c4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8017c7:	55                   	push   %ebp
+  8017c8:	68 d1 17 80 00       	push   $0x8017d1
+  8017cd:	89 e5                	mov    %esp,%ebp
+  8017cf:	0f 34                	sysenter
+  8017d1:	83 c4 04             	add    $0x4,%esp
+  8017d4:	5d                   	pop    %ebp
+}
+  8017d5:	5b                   	pop    %ebx
+  8017d6:	5e                   	pop    %esi
+  8017d7:	5f                   	pop    %edi
+  8017d8:	5d                   	pop    %ebp
+  8017d9:	c3                   	ret
+  8017da:	b8 01 00 00 00       	mov    $0x1,%eax
+  8017df:	0f a2                	cpuid
+		return 0;
+  8017e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8017e6:	f6 c6 08             	test   $0x8,%dh
+  8017e9:	74 15                	je     801800 <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017eb:	89 c2                	mov    %eax,%edx
+  8017ed:	c1 ea 08             	shr    $0x8,%edx
+  8017f0:	83 e2 0f             	and    $0xf,%edx
+  8017f3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017f8:	83 fa 06             	cmp    $0x6,%edx
+  8017fb:	74 0e                	je     80180b <sys_ipc_try_send+0x72>
+  8017fd:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801800:	0f b6 c9             	movzbl %cl,%ecx
+  801803:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801809:	eb 9d                	jmp    8017a8 <sys_ipc_try_send+0xf>
+  80180b:	89 c2                	mov    %eax,%edx
+  80180d:	c1 ea 04             	shr    $0x4,%edx
+  801810:	83 e2 0f             	and    $0xf,%edx
+  801813:	83 fa 02             	cmp    $0x2,%edx
+  801816:	77 e5                	ja     8017fd <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  801818:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80181b:	83 f8 02             	cmp    $0x2,%eax
+  80181e:	0f 97 c1             	seta   %cl
+  801821:	0f b6 c9             	movzbl %cl,%ecx
+  801824:	eb d7                	jmp    8017fd <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  801826:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80182b:	be 00 00 00 00       	mov    $0x0,%esi
+  801830:	8b 55 08             	mov    0x8(%ebp),%edx
+  801833:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801836:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801839:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80183c:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  80183e:	eb 95                	jmp    8017d5 <sys_ipc_try_send+0x3c>
+
+00801840 <sys_ipc_send>:
+{
+  801840:	55                   	push   %ebp
+  801841:	89 e5                	mov    %esp,%ebp
+  801843:	57                   	push   %edi
+  801844:	56                   	push   %esi
+  801845:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801846:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80184d:	78 32                	js     801881 <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  80184f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801856:	74 75                	je     8018cd <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801858:	8b 55 08             	mov    0x8(%ebp),%edx
+  80185b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80185e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801863:	be 00 00 00 00       	mov    $0x0,%esi
+  801868:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80186b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80186e:	55                   	push   %ebp
+  80186f:	68 78 18 80 00       	push   $0x801878
+  801874:	89 e5                	mov    %esp,%ebp
+  801876:	0f 34                	sysenter
+  801878:	83 c4 04             	add    $0x4,%esp
+  80187b:	5d                   	pop    %ebp
+}
+  80187c:	5b                   	pop    %ebx
+  80187d:	5e                   	pop    %esi
+  80187e:	5f                   	pop    %edi
+  80187f:	5d                   	pop    %ebp
+  801880:	c3                   	ret
+  801881:	b8 01 00 00 00       	mov    $0x1,%eax
+  801886:	0f a2                	cpuid
+		return 0;
+  801888:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80188d:	f6 c6 08             	test   $0x8,%dh
+  801890:	74 15                	je     8018a7 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801892:	89 c2                	mov    %eax,%edx
+  801894:	c1 ea 08             	shr    $0x8,%edx
+  801897:	83 e2 0f             	and    $0xf,%edx
+  80189a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80189f:	83 fa 06             	cmp    $0x6,%edx
+  8018a2:	74 0e                	je     8018b2 <sys_ipc_send+0x72>
+  8018a4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8018a7:	0f b6 c9             	movzbl %cl,%ecx
+  8018aa:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8018b0:	eb 9d                	jmp    80184f <sys_ipc_send+0xf>
+  8018b2:	89 c2                	mov    %eax,%edx
+  8018b4:	c1 ea 04             	shr    $0x4,%edx
+  8018b7:	83 e2 0f             	and    $0xf,%edx
+  8018ba:	83 fa 02             	cmp    $0x2,%edx
+  8018bd:	77 e5                	ja     8018a4 <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  8018bf:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018c2:	83 f8 02             	cmp    $0x2,%eax
+  8018c5:	0f 97 c1             	seta   %cl
+  8018c8:	0f b6 c9             	movzbl %cl,%ecx
+  8018cb:	eb d7                	jmp    8018a4 <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  8018cd:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8018d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8018d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018dd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018e0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8018e3:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  8018e5:	eb 95                	jmp    80187c <sys_ipc_send+0x3c>
+
+008018e7 <sys_ipc_recv>:
+{
+  8018e7:	55                   	push   %ebp
+  8018e8:	89 e5                	mov    %esp,%ebp
+  8018ea:	57                   	push   %edi
+  8018eb:	56                   	push   %esi
+  8018ec:	53                   	push   %ebx
+  8018ed:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8018f0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8018f7:	78 36                	js     80192f <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  8018f9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801900:	74 79                	je     80197b <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  801902:	8b 55 08             	mov    0x8(%ebp),%edx
+  801905:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80190a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80190f:	89 cb                	mov    %ecx,%ebx
+  801911:	89 cf                	mov    %ecx,%edi
+  801913:	89 ce                	mov    %ecx,%esi
+  801915:	55                   	push   %ebp
+  801916:	68 1f 19 80 00       	push   $0x80191f
+  80191b:	89 e5                	mov    %esp,%ebp
+  80191d:	0f 34                	sysenter
+  80191f:	83 c4 04             	add    $0x4,%esp
+  801922:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801923:	85 c0                	test   %eax,%eax
+  801925:	7f 6b                	jg     801992 <sys_ipc_recv+0xab>
+}
+  801927:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80192a:	5b                   	pop    %ebx
+  80192b:	5e                   	pop    %esi
+  80192c:	5f                   	pop    %edi
+  80192d:	5d                   	pop    %ebp
+  80192e:	c3                   	ret
+  80192f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801934:	0f a2                	cpuid
+		return 0;
+  801936:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80193b:	f6 c6 08             	test   $0x8,%dh
+  80193e:	74 15                	je     801955 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801940:	89 c2                	mov    %eax,%edx
+  801942:	c1 ea 08             	shr    $0x8,%edx
+  801945:	83 e2 0f             	and    $0xf,%edx
+  801948:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80194d:	83 fa 06             	cmp    $0x6,%edx
+  801950:	74 0e                	je     801960 <sys_ipc_recv+0x79>
+  801952:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801955:	0f b6 c9             	movzbl %cl,%ecx
+  801958:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80195e:	eb 99                	jmp    8018f9 <sys_ipc_recv+0x12>
+  801960:	89 c2                	mov    %eax,%edx
+  801962:	c1 ea 04             	shr    $0x4,%edx
+  801965:	83 e2 0f             	and    $0xf,%edx
+  801968:	83 fa 02             	cmp    $0x2,%edx
+  80196b:	77 e5                	ja     801952 <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  80196d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801970:	83 f8 02             	cmp    $0x2,%eax
+  801973:	0f 97 c1             	seta   %cl
+  801976:	0f b6 c9             	movzbl %cl,%ecx
+  801979:	eb d7                	jmp    801952 <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  80197b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801980:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801985:	8b 55 08             	mov    0x8(%ebp),%edx
+  801988:	89 cb                	mov    %ecx,%ebx
+  80198a:	89 cf                	mov    %ecx,%edi
+  80198c:	89 ce                	mov    %ecx,%esi
+  80198e:	cd 30                	int    $0x30
+  801990:	eb 91                	jmp    801923 <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801992:	83 ec 0c             	sub    $0xc,%esp
+  801995:	50                   	push   %eax
+  801996:	6a 0d                	push   $0xd
+  801998:	68 59 32 80 00       	push   $0x803259
+  80199d:	6a 4a                	push   $0x4a
+  80199f:	68 76 32 80 00       	push   $0x803276
+  8019a4:	e8 80 12 00 00       	call   802c29 <_panic>
+
+008019a9 <sys_ipc_send_range>:
+{
+  8019a9:	55                   	push   %ebp
+  8019aa:	89 e5                	mov    %esp,%ebp
+  8019ac:	57                   	push   %edi
+  8019ad:	56                   	push   %esi
+  8019ae:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8019af:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8019b6:	78 30                	js     8019e8 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  8019b8:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8019bf:	74 73                	je     801a34 <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  8019c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019c7:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8019cc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019cf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8019d2:	8b 75 18             	mov    0x18(%ebp),%esi
+  8019d5:	55                   	push   %ebp
+  8019d6:	68 df 19 80 00       	push   $0x8019df
+  8019db:	89 e5                	mov    %esp,%ebp
+  8019dd:	0f 34                	sysenter
+  8019df:	83 c4 04             	add    $0x4,%esp
+  8019e2:	5d                   	pop    %ebp
+}
+  8019e3:	5b                   	pop    %ebx
+  8019e4:	5e                   	pop    %esi
+  8019e5:	5f                   	pop    %edi
+  8019e6:	5d                   	pop    %ebp
+  8019e7:	c3                   	ret
+  8019e8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019ed:	0f a2                	cpuid
+		return 0;
+  8019ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8019f4:	f6 c6 08             	test   $0x8,%dh
+  8019f7:	74 15                	je     801a0e <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019f9:	89 c2                	mov    %eax,%edx
+  8019fb:	c1 ea 08             	shr    $0x8,%edx
+  8019fe:	83 e2 0f             	and    $0xf,%edx
+  801a01:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a06:	83 fa 06             	cmp    $0x6,%edx
+  801a09:	74 0e                	je     801a19 <sys_ipc_send_range+0x70>
+  801a0b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a0e:	0f b6 c9             	movzbl %cl,%ecx
+  801a11:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801a17:	eb 9f                	jmp    8019b8 <sys_ipc_send_range+0xf>
+  801a19:	89 c2                	mov    %eax,%edx
+  801a1b:	c1 ea 04             	shr    $0x4,%edx
+  801a1e:	83 e2 0f             	and    $0xf,%edx
+  801a21:	83 fa 02             	cmp    $0x2,%edx
+  801a24:	77 e5                	ja     801a0b <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  801a26:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a29:	83 f8 02             	cmp    $0x2,%eax
+  801a2c:	0f 97 c1             	seta   %cl
+  801a2f:	0f b6 c9             	movzbl %cl,%ecx
+  801a32:	eb d7                	jmp    801a0b <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  801a34:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801a39:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a3f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a42:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a45:	8b 75 18             	mov    0x18(%ebp),%esi
+  801a48:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  801a4a:	eb 97                	jmp    8019e3 <sys_ipc_send_range+0x3a>
+
+00801a4c <sys_ipc_recv_range>:
+{
+  801a4c:	55                   	push   %ebp
+  801a4d:	89 e5                	mov    %esp,%ebp
+  801a4f:	57                   	push   %edi
+  801a50:	56                   	push   %esi
+  801a51:	53                   	push   %ebx
+  801a52:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801a55:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a5c:	78 37                	js     801a95 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  801a5e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a65:	74 7a                	je     801ae1 <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  801a67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a72:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801a77:	89 df                	mov    %ebx,%edi
+  801a79:	89 de                	mov    %ebx,%esi
+  801a7b:	55                   	push   %ebp
+  801a7c:	68 85 1a 80 00       	push   $0x801a85
+  801a81:	89 e5                	mov    %esp,%ebp
+  801a83:	0f 34                	sysenter
+  801a85:	83 c4 04             	add    $0x4,%esp
+  801a88:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801a89:	85 c0                	test   %eax,%eax
+  801a8b:	7f 6c                	jg     801af9 <sys_ipc_recv_range+0xad>
+}
+  801a8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a90:	5b                   	pop    %ebx
+  801a91:	5e                   	pop    %esi
+  801a92:	5f                   	pop    %edi
+  801a93:	5d                   	pop    %ebp
+  801a94:	c3                   	ret
+  801a95:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a9a:	0f a2                	cpuid
+		return 0;
+  801a9c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801aa1:	f6 c6 08             	test   $0x8,%dh
+  801aa4:	74 15                	je     801abb <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801aa6:	89 c2                	mov    %eax,%edx
+  801aa8:	c1 ea 08             	shr    $0x8,%edx
+  801aab:	83 e2 0f             	and    $0xf,%edx
+  801aae:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ab3:	83 fa 06             	cmp    $0x6,%edx
+  801ab6:	74 0e                	je     801ac6 <sys_ipc_recv_range+0x7a>
+  801ab8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801abb:	0f b6 c9             	movzbl %cl,%ecx
+  801abe:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801ac4:	eb 98                	jmp    801a5e <sys_ipc_recv_range+0x12>
+  801ac6:	89 c2                	mov    %eax,%edx
+  801ac8:	c1 ea 04             	shr    $0x4,%edx
+  801acb:	83 e2 0f             	and    $0xf,%edx
+  801ace:	83 fa 02             	cmp    $0x2,%edx
+  801ad1:	77 e5                	ja     801ab8 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801ad3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ad6:	83 f8 02             	cmp    $0x2,%eax
+  801ad9:	0f 97 c1             	seta   %cl
+  801adc:	0f b6 c9             	movzbl %cl,%ecx
+  801adf:	eb d7                	jmp    801ab8 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801ae1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ae6:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801aeb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801af1:	89 df                	mov    %ebx,%edi
+  801af3:	89 de                	mov    %ebx,%esi
+  801af5:	cd 30                	int    $0x30
+  801af7:	eb 90                	jmp    801a89 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801af9:	83 ec 0c             	sub    $0xc,%esp
+  801afc:	50                   	push   %eax
+  801afd:	6a 1f                	push   $0x1f
+  801aff:	68 59 32 80 00       	push   $0x803259
+  801b04:	6a 4a                	push   $0x4a
+  801b06:	68 76 32 80 00       	push   $0x803276
+  801b0b:	e8 19 11 00 00       	call   802c29 <_panic>
+
+00801b10 <sys_ipc_call>:
+{
+  801b10:	55                   	push   %ebp
+  801b11:	89 e5                	mov    %esp,%ebp
+  801b13:	57                   	push   %edi
+  801b14:	56                   	push   %esi
+  801b15:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801b16:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b19:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801b1e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b21:	55                   	push   %ebp
+  801b22:	56                   	push   %esi
+  801b23:	8b 0e                	mov    (%esi),%ecx
+  801b25:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801b28:	8b 7e 08             	mov    0x8(%esi),%edi
+  801b2b:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801b2e:	8b 76 0c             	mov    0xc(%esi),%esi
+  801b31:	cd 30                	int    $0x30
+  801b33:	87 34 24             	xchg   %esi,(%esp)
+  801b36:	89 0e                	mov    %ecx,(%esi)
+  801b38:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801b3b:	89 7e 08             	mov    %edi,0x8(%esi)
+  801b3e:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801b41:	8f 46 0c             	pop    0xc(%esi)
+  801b44:	5d                   	pop    %ebp
+}
+  801b45:	5b                   	pop    %ebx
+  801b46:	5e                   	pop    %esi
+  801b47:	5f                   	pop    %edi
+  801b48:	5d                   	pop    %ebp
+  801b49:	c3                   	ret
+
+00801b4a <sys_ipc_reply_wait>:
+{
+  801b4a:	55                   	push   %ebp
+  801b4b:	89 e5                	mov    %esp,%ebp
+  801b4d:	57                   	push   %edi
+  801b4e:	56                   	push   %esi
+  801b4f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801b50:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b53:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801b58:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b5b:	55                   	push   %ebp
+  801b5c:	56                   	push   %esi
+  801b5d:	8b 0e                	mov    (%esi),%ecx
+  801b5f:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801b62:	8b 7e 08             	mov    0x8(%esi),%edi
+  801b65:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801b68:	8b 76 0c             	mov    0xc(%esi),%esi
+  801b6b:	cd 30                	int    $0x30
+  801b6d:	87 34 24             	xchg   %esi,(%esp)
+  801b70:	89 0e                	mov    %ecx,(%esi)
+  801b72:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801b75:	89 7e 08             	mov    %edi,0x8(%esi)
+  801b78:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801b7b:	8f 46 0c             	pop    0xc(%esi)
+  801b7e:	5d                   	pop    %ebp
+}
+  801b7f:	5b                   	pop    %ebx
+  801b80:	5e                   	pop    %esi
+  801b81:	5f                   	pop    %edi
+  801b82:	5d                   	pop    %ebp
+  801b83:	c3                   	ret
+
+00801b84 <sys_ipc_send_msg>:
+{
+  801b84:	55                   	push   %ebp
+  801b85:	89 e5                	mov    %esp,%ebp
+  801b87:	57                   	push   %edi
+  801b88:	56                   	push   %esi
+  801b89:	53                   	push   %ebx
+  801b8a:	83 ec 20             	sub    $0x20,%esp
+  801b8d:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801b90:	8b 10                	mov    (%eax),%edx
+  801b92:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801b95:	8b 50 04             	mov    0x4(%eax),%edx
+  801b98:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801b9b:	8b 50 08             	mov    0x8(%eax),%edx
+  801b9e:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801ba1:	8b 50 0c             	mov    0xc(%eax),%edx
+  801ba4:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801ba7:	8b 40 10             	mov    0x10(%eax),%eax
+  801baa:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801bad:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801bb0:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bb3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801bb8:	55                   	push   %ebp
+  801bb9:	56                   	push   %esi
+  801bba:	8b 0e                	mov    (%esi),%ecx
+  801bbc:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801bbf:	8b 7e 08             	mov    0x8(%esi),%edi
+  801bc2:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801bc5:	8b 76 0c             	mov    0xc(%esi),%esi
+  801bc8:	cd 30                	int    $0x30
+  801bca:	87 34 24             	xchg   %esi,(%esp)
+  801bcd:	89 0e                	mov    %ecx,(%esi)
+  801bcf:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801bd2:	89 7e 08             	mov    %edi,0x8(%esi)
+  801bd5:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801bd8:	8f 46 0c             	pop    0xc(%esi)
+  801bdb:	5d                   	pop    %ebp
+}
+  801bdc:	83 c4 20             	add    $0x20,%esp
+  801bdf:	5b                   	pop    %ebx
+  801be0:	5e                   	pop    %esi
+  801be1:	5f                   	pop    %edi
+  801be2:	5d                   	pop    %ebp
+  801be3:	c3                   	ret
+
+00801be4 <sys_fork>:
+{
+  801be4:	55                   	push   %ebp
+  801be5:	89 e5                	mov    %esp,%ebp
+  801be7:	57                   	push   %edi
+  801be8:	56                   	push   %esi
+  801be9:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801bea:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801bf1:	78 2e                	js     801c21 <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801bf3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801bfa:	74 71                	je     801c6d <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801bfc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c01:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801c06:	89 d1                	mov    %edx,%ecx
+  801c08:	89 d3                	mov    %edx,%ebx
+  801c0a:	89 d7                	mov    %edx,%edi
+  801c0c:	89 d6                	mov    %edx,%esi
+  801c0e:	55                   	push   %ebp
+  801c0f:	68 18 1c 80 00       	push   $0x801c18
+  801c14:	89 e5                	mov    %esp,%ebp
+  801c16:	0f 34                	sysenter
+  801c18:	83 c4 04             	add    $0x4,%esp
+  801c1b:	5d                   	pop    %ebp
+}
+  801c1c:	5b                   	pop    %ebx
+  801c1d:	5e                   	pop    %esi
+  801c1e:	5f                   	pop    %edi
+  801c1f:	5d                   	pop    %ebp
+  801c20:	c3                   	ret
+  801c21:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c26:	0f a2                	cpuid
+		return 0;
+  801c28:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801c2d:	f6 c6 08             	test   $0x8,%dh
+  801c30:	74 15                	je     801c47 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c32:	89 c2                	mov    %eax,%edx
+  801c34:	c1 ea 08             	shr    $0x8,%edx
+  801c37:	83 e2 0f             	and    $0xf,%edx
+  801c3a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801c3f:	83 fa 06             	cmp    $0x6,%edx
+  801c42:	74 0e                	je     801c52 <sys_fork+0x6e>
+  801c44:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801c47:	0f b6 c9             	movzbl %cl,%ecx
+  801c4a:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801c50:	eb a1                	jmp    801bf3 <sys_fork+0xf>
+  801c52:	89 c2                	mov    %eax,%edx
+  801c54:	c1 ea 04             	shr    $0x4,%edx
+  801c57:	83 e2 0f             	and    $0xf,%edx
+  801c5a:	83 fa 02             	cmp    $0x2,%edx
+  801c5d:	77 e5                	ja     801c44 <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801c5f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c62:	83 f8 02             	cmp    $0x2,%eax
+  801c65:	0f 97 c1             	seta   %cl
+  801c68:	0f b6 c9             	movzbl %cl,%ecx
+  801c6b:	eb d7                	jmp    801c44 <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801c6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c72:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801c77:	89 d1                	mov    %edx,%ecx
+  801c79:	89 d3                	mov    %edx,%ebx
+  801c7b:	89 d7                	mov    %edx,%edi
+  801c7d:	89 d6                	mov    %edx,%esi
+  801c7f:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801c81:	eb 99                	jmp    801c1c <sys_fork+0x38>
+
+00801c83 <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801c83:	55                   	push   %ebp
+  801c84:	89 e5                	mov    %esp,%ebp
+  801c86:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801c89:	ff 75 14             	push   0x14(%ebp)
+  801c8c:	ff 75 10             	push   0x10(%ebp)
+  801c8f:	ff 75 0c             	push   0xc(%ebp)
+  801c92:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c97:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c9a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801c9f:	e8 81 ee ff ff       	call   800b25 <page_vec_call>
+}
+  801ca4:	c9                   	leave
+  801ca5:	c3                   	ret
+
+00801ca6 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801ca6:	55                   	push   %ebp
+  801ca7:	89 e5                	mov    %esp,%ebp
+  801ca9:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801cac:	ff 75 18             	push   0x18(%ebp)
+  801caf:	ff 75 14             	push   0x14(%ebp)
+  801cb2:	ff 75 10             	push   0x10(%ebp)
+  801cb5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cbb:	b8 10 00 00 00       	mov    $0x10,%eax
+  801cc0:	e8 60 ee ff ff       	call   800b25 <page_vec_call>
+}
+  801cc5:	c9                   	leave
+  801cc6:	c3                   	ret
+
+00801cc7 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801cc7:	55                   	push   %ebp
+  801cc8:	89 e5                	mov    %esp,%ebp
+  801cca:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801ccd:	ff 75 14             	push   0x14(%ebp)
+  801cd0:	ff 75 10             	push   0x10(%ebp)
+  801cd3:	ff 75 0c             	push   0xc(%ebp)
+  801cd6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cdb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cde:	b8 11 00 00 00       	mov    $0x11,%eax
+  801ce3:	e8 3d ee ff ff       	call   800b25 <page_vec_call>
+}
+  801ce8:	c9                   	leave
+  801ce9:	c3                   	ret
+
+00801cea <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801cea:	55                   	push   %ebp
+  801ceb:	89 e5                	mov    %esp,%ebp
+  801ced:	57                   	push   %edi
+  801cee:	56                   	push   %esi
+  801cef:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801cf0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801cf7:	78 32                	js     801d2b <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801cf9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801d00:	74 75                	je     801d77 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801d02:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d05:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d08:	b8 12 00 00 00       	mov    $0x12,%eax
+  801d0d:	be 00 00 00 00       	mov    $0x0,%esi
+  801d12:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d15:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801d18:	55                   	push   %ebp
+  801d19:	68 22 1d 80 00       	push   $0x801d22
+  801d1e:	89 e5                	mov    %esp,%ebp
+  801d20:	0f 34                	sysenter
+  801d22:	83 c4 04             	add    $0x4,%esp
+  801d25:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801d26:	5b                   	pop    %ebx
+  801d27:	5e                   	pop    %esi
+  801d28:	5f                   	pop    %edi
+  801d29:	5d                   	pop    %ebp
+  801d2a:	c3                   	ret
+  801d2b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d30:	0f a2                	cpuid
+		return 0;
+  801d32:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801d37:	f6 c6 08             	test   $0x8,%dh
+  801d3a:	74 15                	je     801d51 <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d3c:	89 c2                	mov    %eax,%edx
+  801d3e:	c1 ea 08             	shr    $0x8,%edx
+  801d41:	83 e2 0f             	and    $0xf,%edx
+  801d44:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d49:	83 fa 06             	cmp    $0x6,%edx
+  801d4c:	74 0e                	je     801d5c <sys_vm_ranges+0x72>
+  801d4e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801d51:	0f b6 c9             	movzbl %cl,%ecx
+  801d54:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801d5a:	eb 9d                	jmp    801cf9 <sys_vm_ranges+0xf>
+  801d5c:	89 c2                	mov    %eax,%edx
+  801d5e:	c1 ea 04             	shr    $0x4,%edx
+  801d61:	83 e2 0f             	and    $0xf,%edx
+  801d64:	83 fa 02             	cmp    $0x2,%edx
+  801d67:	77 e5                	ja     801d4e <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  801d69:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d6c:	83 f8 02             	cmp    $0x2,%eax
+  801d6f:	0f 97 c1             	seta   %cl
+  801d72:	0f b6 c9             	movzbl %cl,%ecx
+  801d75:	eb d7                	jmp    801d4e <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801d77:	b8 12 00 00 00       	mov    $0x12,%eax
+  801d7c:	be 00 00 00 00       	mov    $0x0,%esi
+  801d81:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d84:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d87:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d8a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801d8d:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801d8f:	eb 95                	jmp    801d26 <sys_vm_ranges+0x3c>
+
+00801d91 <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801d91:	55                   	push   %ebp
+  801d92:	89 e5                	mov    %esp,%ebp
+  801d94:	57                   	push   %edi
+  801d95:	56                   	push   %esi
+  801d96:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801d97:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801d9e:	78 31                	js     801dd1 <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801da0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801da7:	74 74                	je     801e1d <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801da9:	be 00 00 00 00       	mov    $0x0,%esi
+  801dae:	8b 55 08             	mov    0x8(%ebp),%edx
+  801db1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801db4:	b8 14 00 00 00       	mov    $0x14,%eax
+  801db9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801dbc:	89 f7                	mov    %esi,%edi
+  801dbe:	55                   	push   %ebp
+  801dbf:	68 c8 1d 80 00       	push   $0x801dc8
+  801dc4:	89 e5                	mov    %esp,%ebp
+  801dc6:	0f 34                	sysenter
+  801dc8:	83 c4 04             	add    $0x4,%esp
+  801dcb:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801dcc:	5b                   	pop    %ebx
+  801dcd:	5e                   	pop    %esi
+  801dce:	5f                   	pop    %edi
+  801dcf:	5d                   	pop    %ebp
+  801dd0:	c3                   	ret
+  801dd1:	b8 01 00 00 00       	mov    $0x1,%eax
+  801dd6:	0f a2                	cpuid
+		return 0;
+  801dd8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801ddd:	f6 c6 08             	test   $0x8,%dh
+  801de0:	74 15                	je     801df7 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801de2:	89 c2                	mov    %eax,%edx
+  801de4:	c1 ea 08             	shr    $0x8,%edx
+  801de7:	83 e2 0f             	and    $0xf,%edx
+  801dea:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801def:	83 fa 06             	cmp    $0x6,%edx
+  801df2:	74 0e                	je     801e02 <sys_spawn+0x71>
+  801df4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801df7:	0f b6 c9             	movzbl %cl,%ecx
+  801dfa:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801e00:	eb 9e                	jmp    801da0 <sys_spawn+0xf>
+  801e02:	89 c2                	mov    %eax,%edx
+  801e04:	c1 ea 04             	shr    $0x4,%edx
+  801e07:	83 e2 0f             	and    $0xf,%edx
+  801e0a:	83 fa 02             	cmp    $0x2,%edx
+  801e0d:	77 e5                	ja     801df4 <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  801e0f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e12:	83 f8 02             	cmp    $0x2,%eax
+  801e15:	0f 97 c1             	seta   %cl
+  801e18:	0f b6 c9             	movzbl %cl,%ecx
+  801e1b:	eb d7                	jmp    801df4 <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  801e1d:	be 00 00 00 00       	mov    $0x0,%esi
+  801e22:	b8 14 00 00 00       	mov    $0x14,%eax
+  801e27:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e2a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e2d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e30:	89 f7                	mov    %esi,%edi
+  801e32:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  801e34:	eb 96                	jmp    801dcc <sys_spawn+0x3b>
+
+00801e36 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  801e36:	55                   	push   %ebp
+  801e37:	89 e5                	mov    %esp,%ebp
+  801e39:	57                   	push   %edi
+  801e3a:	56                   	push   %esi
+  801e3b:	53                   	push   %ebx
+  801e3c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801e3f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e46:	78 37                	js     801e7f <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  801e48:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e4f:	74 7a                	je     801ecb <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  801e51:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e56:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e59:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e5c:	b8 15 00 00 00       	mov    $0x15,%eax
+  801e61:	89 df                	mov    %ebx,%edi
+  801e63:	89 de                	mov    %ebx,%esi
+  801e65:	55                   	push   %ebp
+  801e66:	68 6f 1e 80 00       	push   $0x801e6f
+  801e6b:	89 e5                	mov    %esp,%ebp
+  801e6d:	0f 34                	sysenter
+  801e6f:	83 c4 04             	add    $0x4,%esp
+  801e72:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801e73:	85 c0                	test   %eax,%eax
+  801e75:	7f 6c                	jg     801ee3 <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  801e77:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e7a:	5b                   	pop    %ebx
+  801e7b:	5e                   	pop    %esi
+  801e7c:	5f                   	pop    %edi
+  801e7d:	5d                   	pop    %ebp
+  801e7e:	c3                   	ret
+  801e7f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e84:	0f a2                	cpuid
+		return 0;
+  801e86:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801e8b:	f6 c6 08             	test   $0x8,%dh
+  801e8e:	74 15                	je     801ea5 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e90:	89 c2                	mov    %eax,%edx
+  801e92:	c1 ea 08             	shr    $0x8,%edx
+  801e95:	83 e2 0f             	and    $0xf,%edx
+  801e98:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e9d:	83 fa 06             	cmp    $0x6,%edx
+  801ea0:	74 0e                	je     801eb0 <sys_shm_create+0x7a>
+  801ea2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801ea5:	0f b6 c9             	movzbl %cl,%ecx
+  801ea8:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801eae:	eb 98                	jmp    801e48 <sys_shm_create+0x12>
+  801eb0:	89 c2                	mov    %eax,%edx
+  801eb2:	c1 ea 04             	shr    $0x4,%edx
+  801eb5:	83 e2 0f             	and    $0xf,%edx
+  801eb8:	83 fa 02             	cmp    $0x2,%edx
+  801ebb:	77 e5                	ja     801ea2 <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  801ebd:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ec0:	83 f8 02             	cmp    $0x2,%eax
+  801ec3:	0f 97 c1             	seta   %cl
+  801ec6:	0f b6 c9             	movzbl %cl,%ecx
+  801ec9:	eb d7                	jmp    801ea2 <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  801ecb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ed0:	b8 15 00 00 00       	mov    $0x15,%eax
+  801ed5:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ed8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801edb:	89 df                	mov    %ebx,%edi
+  801edd:	89 de                	mov    %ebx,%esi
+  801edf:	cd 30                	int    $0x30
+  801ee1:	eb 90                	jmp    801e73 <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801ee3:	83 ec 0c             	sub    $0xc,%esp
+  801ee6:	50                   	push   %eax
+  801ee7:	6a 15                	push   $0x15
+  801ee9:	68 59 32 80 00       	push   $0x803259
+  801eee:	6a 4a                	push   $0x4a
+  801ef0:	68 76 32 80 00       	push   $0x803276
+  801ef5:	e8 2f 0d 00 00       	call   802c29 <_panic>
+
+00801efa <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  801efa:	55                   	push   %ebp
+  801efb:	89 e5                	mov    %esp,%ebp
+  801efd:	57                   	push   %edi
+  801efe:	56                   	push   %esi
+  801eff:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801f00:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f07:	78 32                	js     801f3b <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  801f09:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f10:	74 75                	je     801f87 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801f12:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f15:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f18:	b8 16 00 00 00       	mov    $0x16,%eax
+  801f1d:	be 00 00 00 00       	mov    $0x0,%esi
+  801f22:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f25:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801f28:	55                   	push   %ebp
+  801f29:	68 32 1f 80 00       	push   $0x801f32
+  801f2e:	89 e5                	mov    %esp,%ebp
+  801f30:	0f 34                	sysenter
+  801f32:	83 c4 04             	add    $0x4,%esp
+  801f35:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  801f36:	5b                   	pop    %ebx
+  801f37:	5e                   	pop    %esi
+  801f38:	5f                   	pop    %edi
+  801f39:	5d                   	pop    %ebp
+  801f3a:	c3                   	ret
+  801f3b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f40:	0f a2                	cpuid
+		return 0;
+  801f42:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801f47:	f6 c6 08             	test   $0x8,%dh
+  801f4a:	74 15                	je     801f61 <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f4c:	89 c2                	mov    %eax,%edx
+  801f4e:	c1 ea 08             	shr    $0x8,%edx
+  801f51:	83 e2 0f             	and    $0xf,%edx
+  801f54:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f59:	83 fa 06             	cmp    $0x6,%edx
+  801f5c:	74 0e                	je     801f6c <sys_shm_attach+0x72>
+  801f5e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801f61:	0f b6 c9             	movzbl %cl,%ecx
+  801f64:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801f6a:	eb 9d                	jmp    801f09 <sys_shm_attach+0xf>
+  801f6c:	89 c2                	mov    %eax,%edx
+  801f6e:	c1 ea 04             	shr    $0x4,%edx
+  801f71:	83 e2 0f             	and    $0xf,%edx
+  801f74:	83 fa 02             	cmp    $0x2,%edx
+  801f77:	77 e5                	ja     801f5e <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  801f79:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f7c:	83 f8 02             	cmp    $0x2,%eax
+  801f7f:	0f 97 c1             	seta   %cl
+  801f82:	0f b6 c9             	movzbl %cl,%ecx
+  801f85:	eb d7                	jmp    801f5e <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  801f87:	b8 16 00 00 00       	mov    $0x16,%eax
+  801f8c:	be 00 00 00 00       	mov    $0x0,%esi
+  801f91:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f94:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f97:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f9a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801f9d:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  801f9f:	eb 95                	jmp    801f36 <sys_shm_attach+0x3c>
+
+00801fa1 <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  801fa1:	55                   	push   %ebp
+  801fa2:	89 e5                	mov    %esp,%ebp
+  801fa4:	57                   	push   %edi
+  801fa5:	56                   	push   %esi
+  801fa6:	53                   	push   %ebx
+  801fa7:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801faa:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801fb1:	78 38                	js     801feb <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  801fb3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801fba:	74 7b                	je     802037 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  801fbc:	be 00 00 00 00       	mov    $0x0,%esi
+  801fc1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fc4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fc7:	b8 17 00 00 00       	mov    $0x17,%eax
+  801fcc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801fcf:	89 f7                	mov    %esi,%edi
+  801fd1:	55                   	push   %ebp
+  801fd2:	68 db 1f 80 00       	push   $0x801fdb
+  801fd7:	89 e5                	mov    %esp,%ebp
+  801fd9:	0f 34                	sysenter
+  801fdb:	83 c4 04             	add    $0x4,%esp
+  801fde:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801fdf:	85 c0                	test   %eax,%eax
+  801fe1:	7f 6d                	jg     802050 <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  801fe3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fe6:	5b                   	pop    %ebx
+  801fe7:	5e                   	pop    %esi
+  801fe8:	5f                   	pop    %edi
+  801fe9:	5d                   	pop    %ebp
+  801fea:	c3                   	ret
+  801feb:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ff0:	0f a2                	cpuid
+		return 0;
+  801ff2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801ff7:	f6 c6 08             	test   $0x8,%dh
+  801ffa:	74 15                	je     802011 <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ffc:	89 c2                	mov    %eax,%edx
+  801ffe:	c1 ea 08             	shr    $0x8,%edx
+  802001:	83 e2 0f             	and    $0xf,%edx
+  802004:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802009:	83 fa 06             	cmp    $0x6,%edx
+  80200c:	74 0e                	je     80201c <sys_shm_detach+0x7b>
+  80200e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802011:	0f b6 c9             	movzbl %cl,%ecx
+  802014:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80201a:	eb 97                	jmp    801fb3 <sys_shm_detach+0x12>
+  80201c:	89 c2                	mov    %eax,%edx
+  80201e:	c1 ea 04             	shr    $0x4,%edx
+  802021:	83 e2 0f             	and    $0xf,%edx
+  802024:	83 fa 02             	cmp    $0x2,%edx
+  802027:	77 e5                	ja     80200e <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  802029:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80202c:	83 f8 02             	cmp    $0x2,%eax
+  80202f:	0f 97 c1             	seta   %cl
+  802032:	0f b6 c9             	movzbl %cl,%ecx
+  802035:	eb d7                	jmp    80200e <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  802037:	be 00 00 00 00       	mov    $0x0,%esi
+  80203c:	b8 17 00 00 00       	mov    $0x17,%eax
+  802041:	8b 55 08             	mov    0x8(%ebp),%edx
+  802044:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802047:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80204a:	89 f7                	mov    %esi,%edi
+  80204c:	cd 30                	int    $0x30
+  80204e:	eb 8f                	jmp    801fdf <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802050:	83 ec 0c             	sub    $0xc,%esp
+  802053:	50                   	push   %eax
+  802054:	6a 17                	push   $0x17
+  802056:	68 59 32 80 00       	push   $0x803259
+  80205b:	6a 4a                	push   $0x4a
+  80205d:	68 76 32 80 00       	push   $0x803276
+  802062:	e8 c2 0b 00 00       	call   802c29 <_panic>
+
+00802067 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  802067:	55                   	push   %ebp
+  802068:	89 e5                	mov    %esp,%ebp
+  80206a:	57                   	push   %edi
+  80206b:	56                   	push   %esi
+  80206c:	53                   	push   %ebx
+  80206d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802070:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802077:	78 36                	js     8020af <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  802079:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802080:	74 79                	je     8020fb <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  802082:	8b 55 08             	mov    0x8(%ebp),%edx
+  802085:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80208a:	b8 18 00 00 00       	mov    $0x18,%eax
+  80208f:	89 cb                	mov    %ecx,%ebx
+  802091:	89 cf                	mov    %ecx,%edi
+  802093:	89 ce                	mov    %ecx,%esi
+  802095:	55                   	push   %ebp
+  802096:	68 9f 20 80 00       	push   $0x80209f
+  80209b:	89 e5                	mov    %esp,%ebp
+  80209d:	0f 34                	sysenter
+  80209f:	83 c4 04             	add    $0x4,%esp
+  8020a2:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8020a3:	85 c0                	test   %eax,%eax
+  8020a5:	7f 6b                	jg     802112 <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  8020a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020aa:	5b                   	pop    %ebx
+  8020ab:	5e                   	pop    %esi
+  8020ac:	5f                   	pop    %edi
+  8020ad:	5d                   	pop    %ebp
+  8020ae:	c3                   	ret
+  8020af:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020b4:	0f a2                	cpuid
+		return 0;
+  8020b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8020bb:	f6 c6 08             	test   $0x8,%dh
+  8020be:	74 15                	je     8020d5 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020c0:	89 c2                	mov    %eax,%edx
+  8020c2:	c1 ea 08             	shr    $0x8,%edx
+  8020c5:	83 e2 0f             	and    $0xf,%edx
+  8020c8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8020cd:	83 fa 06             	cmp    $0x6,%edx
+  8020d0:	74 0e                	je     8020e0 <sys_shm_remove+0x79>
+  8020d2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8020d5:	0f b6 c9             	movzbl %cl,%ecx
+  8020d8:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8020de:	eb 99                	jmp    802079 <sys_shm_remove+0x12>
+  8020e0:	89 c2                	mov    %eax,%edx
+  8020e2:	c1 ea 04             	shr    $0x4,%edx
+  8020e5:	83 e2 0f             	and    $0xf,%edx
+  8020e8:	83 fa 02             	cmp    $0x2,%edx
+  8020eb:	77 e5                	ja     8020d2 <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  8020ed:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020f0:	83 f8 02             	cmp    $0x2,%eax
+  8020f3:	0f 97 c1             	seta   %cl
+  8020f6:	0f b6 c9             	movzbl %cl,%ecx
+  8020f9:	eb d7                	jmp    8020d2 <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  8020fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802100:	b8 18 00 00 00       	mov    $0x18,%eax
+  802105:	8b 55 08             	mov    0x8(%ebp),%edx
+  802108:	89 cb                	mov    %ecx,%ebx
+  80210a:	89 cf                	mov    %ecx,%edi
+  80210c:	89 ce                	mov    %ecx,%esi
+  80210e:	cd 30                	int    $0x30
+  802110:	eb 91                	jmp    8020a3 <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802112:	83 ec 0c             	sub    $0xc,%esp
+  802115:	50                   	push   %eax
+  802116:	6a 18                	push   $0x18
+  802118:	68 59 32 80 00       	push   $0x803259
+  80211d:	6a 4a                	push   $0x4a
+  80211f:	68 76 32 80 00       	push   $0x803276
+  802124:	e8 00 0b 00 00       	call   802c29 <_panic>
+
+00802129 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  802129:	55                   	push   %ebp
+  80212a:	89 e5                	mov    %esp,%ebp
+  80212c:	57                   	push   %edi
+  80212d:	56                   	push   %esi
+  80212e:	53                   	push   %ebx
+  80212f:	83 ec 0c             	sub    $0xc,%esp
+  802132:	8b 45 10             	mov    0x10(%ebp),%eax
+  802135:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802138:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  80213b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802142:	78 32                	js     802176 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  802144:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80214b:	74 75                	je     8021c2 <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  80214d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802150:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802153:	b8 20 00 00 00       	mov    $0x20,%eax
+  802158:	be 00 00 00 00       	mov    $0x0,%esi
+  80215d:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802160:	55                   	push   %ebp
+  802161:	68 6a 21 80 00       	push   $0x80216a
+  802166:	89 e5                	mov    %esp,%ebp
+  802168:	0f 34                	sysenter
+  80216a:	83 c4 04             	add    $0x4,%esp
+  80216d:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  80216e:	83 c4 0c             	add    $0xc,%esp
+  802171:	5b                   	pop    %ebx
+  802172:	5e                   	pop    %esi
+  802173:	5f                   	pop    %edi
+  802174:	5d                   	pop    %ebp
+  802175:	c3                   	ret
+  802176:	b8 01 00 00 00       	mov    $0x1,%eax
+  80217b:	0f a2                	cpuid
+		return 0;
+  80217d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802182:	f6 c6 08             	test   $0x8,%dh
+  802185:	74 15                	je     80219c <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802187:	89 c2                	mov    %eax,%edx
+  802189:	c1 ea 08             	shr    $0x8,%edx
+  80218c:	83 e2 0f             	and    $0xf,%edx
+  80218f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802194:	83 fa 06             	cmp    $0x6,%edx
+  802197:	74 0e                	je     8021a7 <sys_futex_wait+0x7e>
+  802199:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80219c:	0f b6 c9             	movzbl %cl,%ecx
+  80219f:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8021a5:	eb 9d                	jmp    802144 <sys_futex_wait+0x1b>
+  8021a7:	89 c2                	mov    %eax,%edx
+  8021a9:	c1 ea 04             	shr    $0x4,%edx
+  8021ac:	83 e2 0f             	and    $0xf,%edx
+  8021af:	83 fa 02             	cmp    $0x2,%edx
+  8021b2:	77 e5                	ja     802199 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  8021b4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021b7:	83 f8 02             	cmp    $0x2,%eax
+  8021ba:	0f 97 c1             	seta   %cl
+  8021bd:	0f b6 c9             	movzbl %cl,%ecx
+  8021c0:	eb d7                	jmp    802199 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  8021c2:	b8 20 00 00 00       	mov    $0x20,%eax
+  8021c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8021cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021d2:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8021d5:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  8021d7:	eb 95                	jmp    80216e <sys_futex_wait+0x45>
+
+008021d9 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8021d9:	55                   	push   %ebp
+  8021da:	89 e5                	mov    %esp,%ebp
+  8021dc:	57                   	push   %edi
+  8021dd:	56                   	push   %esi
+  8021de:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8021df:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8021e6:	78 30                	js     802218 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  8021e8:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8021ef:	74 73                	je     802264 <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  8021f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021fc:	b8 21 00 00 00       	mov    $0x21,%eax
+  802201:	89 df                	mov    %ebx,%edi
+  802203:	89 de                	mov    %ebx,%esi
+  802205:	55                   	push   %ebp
+  802206:	68 0f 22 80 00       	push   $0x80220f
+  80220b:	89 e5                	mov    %esp,%ebp
+  80220d:	0f 34                	sysenter
+  80220f:	83 c4 04             	add    $0x4,%esp
+  802212:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  802213:	5b                   	pop    %ebx
+  802214:	5e                   	pop    %esi
+  802215:	5f                   	pop    %edi
+  802216:	5d                   	pop    %ebp
+  802217:	c3                   	ret
+  802218:	b8 01 00 00 00       	mov    $0x1,%eax
+  80221d:	0f a2                	cpuid
+		return 0;
+  80221f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802224:	f6 c6 08             	test   $0x8,%dh
+  802227:	74 15                	je     80223e <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802229:	89 c2                	mov    %eax,%edx
+  80222b:	c1 ea 08             	shr    $0x8,%edx
+  80222e:	83 e2 0f             	and    $0xf,%edx
+  802231:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802236:	83 fa 06             	cmp    $0x6,%edx
+  802239:	74 0e                	je     802249 <sys_futex_wake+0x70>
+  80223b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80223e:	0f b6 c9             	movzbl %cl,%ecx
+  802241:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802247:	eb 9f                	jmp    8021e8 <sys_futex_wake+0xf>
+  802249:	89 c2                	mov    %eax,%edx
+  80224b:	c1 ea 04             	shr    $0x4,%edx
+  80224e:	83 e2 0f             	and    $0xf,%edx
+  802251:	83 fa 02             	cmp    $0x2,%edx
+  802254:	77 e5                	ja     80223b <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  802256:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802259:	83 f8 02             	cmp    $0x2,%eax
+  80225c:	0f 97 c1             	seta   %cl
+  80225f:	0f b6 c9             	movzbl %cl,%ecx
+  802262:	eb d7                	jmp    80223b <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  802264:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802269:	b8 21 00 00 00       	mov    $0x21,%eax
+  80226e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802271:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802274:	89 df                	mov    %ebx,%edi
+  802276:	89 de                	mov    %ebx,%esi
+  802278:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  80227a:	eb 97                	jmp    802213 <sys_futex_wake+0x3a>
+
+0080227c <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  80227c:	55                   	push   %ebp
+  80227d:	89 e5                	mov    %esp,%ebp
+  80227f:	57                   	push   %edi
+  802280:	56                   	push   %esi
+  802281:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802282:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802289:	78 2e                	js     8022b9 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  80228b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802292:	74 71                	je     802305 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  802294:	ba 00 00 00 00       	mov    $0x0,%edx
+  802299:	b8 22 00 00 00       	mov    $0x22,%eax
+  80229e:	89 d1                	mov    %edx,%ecx
+  8022a0:	89 d3                	mov    %edx,%ebx
+  8022a2:	89 d7                	mov    %edx,%edi
+  8022a4:	89 d6                	mov    %edx,%esi
+  8022a6:	55                   	push   %ebp
+  8022a7:	68 b0 22 80 00       	push   $0x8022b0
+  8022ac:	89 e5                	mov    %esp,%ebp
+  8022ae:	0f 34                	sysenter
+  8022b0:	83 c4 04             	add    $0x4,%esp
+  8022b3:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  8022b4:	5b                   	pop    %ebx
+  8022b5:	5e                   	pop    %esi
+  8022b6:	5f                   	pop    %edi
+  8022b7:	5d                   	pop    %ebp
+  8022b8:	c3                   	ret
+  8022b9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022be:	0f a2                	cpuid
+		return 0;
+  8022c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8022c5:	f6 c6 08             	test   $0x8,%dh
+  8022c8:	74 15                	je     8022df <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022ca:	89 c2                	mov    %eax,%edx
+  8022cc:	c1 ea 08             	shr    $0x8,%edx
+  8022cf:	83 e2 0f             	and    $0xf,%edx
+  8022d2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8022d7:	83 fa 06             	cmp    $0x6,%edx
+  8022da:	74 0e                	je     8022ea <sys_ep_create+0x6e>
+  8022dc:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8022df:	0f b6 c9             	movzbl %cl,%ecx
+  8022e2:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8022e8:	eb a1                	jmp    80228b <sys_ep_create+0xf>
+  8022ea:	89 c2                	mov    %eax,%edx
+  8022ec:	c1 ea 04             	shr    $0x4,%edx
+  8022ef:	83 e2 0f             	and    $0xf,%edx
+  8022f2:	83 fa 02             	cmp    $0x2,%edx
+  8022f5:	77 e5                	ja     8022dc <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  8022f7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022fa:	83 f8 02             	cmp    $0x2,%eax
+  8022fd:	0f 97 c1             	seta   %cl
+  802300:	0f b6 c9             	movzbl %cl,%ecx
+  802303:	eb d7                	jmp    8022dc <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  802305:	ba 00 00 00 00       	mov    $0x0,%edx
+  80230a:	b8 22 00 00 00       	mov    $0x22,%eax
+  80230f:	89 d1                	mov    %edx,%ecx
+  802311:	89 d3                	mov    %edx,%ebx
+  802313:	89 d7                	mov    %edx,%edi
+  802315:	89 d6                	mov    %edx,%esi
+  802317:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  802319:	eb 99                	jmp    8022b4 <sys_ep_create+0x38>
+
+0080231b <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  80231b:	55                   	push   %ebp
+  80231c:	89 e5                	mov    %esp,%ebp
+  80231e:	57                   	push   %edi
+  80231f:	56                   	push   %esi
+  802320:	53                   	push   %ebx
+  802321:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802324:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80232b:	78 36                	js     802363 <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  80232d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802334:	74 79                	je     8023af <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  802336:	8b 55 08             	mov    0x8(%ebp),%edx
+  802339:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80233e:	b8 23 00 00 00       	mov    $0x23,%eax
+  802343:	89 cb                	mov    %ecx,%ebx
+  802345:	89 cf                	mov    %ecx,%edi
+  802347:	89 ce                	mov    %ecx,%esi
+  802349:	55                   	push   %ebp
+  80234a:	68 53 23 80 00       	push   $0x802353
+  80234f:	89 e5                	mov    %esp,%ebp
+  802351:	0f 34                	sysenter
+  802353:	83 c4 04             	add    $0x4,%esp
+  802356:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802357:	85 c0                	test   %eax,%eax
+  802359:	7f 6b                	jg     8023c6 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  80235b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80235e:	5b                   	pop    %ebx
+  80235f:	5e                   	pop    %esi
+  802360:	5f                   	pop    %edi
+  802361:	5d                   	pop    %ebp
+  802362:	c3                   	ret
+  802363:	b8 01 00 00 00       	mov    $0x1,%eax
+  802368:	0f a2                	cpuid
+		return 0;
+  80236a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80236f:	f6 c6 08             	test   $0x8,%dh
+  802372:	74 15                	je     802389 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802374:	89 c2                	mov    %eax,%edx
+  802376:	c1 ea 08             	shr    $0x8,%edx
+  802379:	83 e2 0f             	and    $0xf,%edx
+  80237c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802381:	83 fa 06             	cmp    $0x6,%edx
+  802384:	74 0e                	je     802394 <sys_ep_destroy+0x79>
+  802386:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802389:	0f b6 c9             	movzbl %cl,%ecx
+  80238c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802392:	eb 99                	jmp    80232d <sys_ep_destroy+0x12>
+  802394:	89 c2                	mov    %eax,%edx
+  802396:	c1 ea 04             	shr    $0x4,%edx
+  802399:	83 e2 0f             	and    $0xf,%edx
+  80239c:	83 fa 02             	cmp    $0x2,%edx
+  80239f:	77 e5                	ja     802386 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  8023a1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023a4:	83 f8 02             	cmp    $0x2,%eax
+  8023a7:	0f 97 c1             	seta   %cl
+  8023aa:	0f b6 c9             	movzbl %cl,%ecx
+  8023ad:	eb d7                	jmp    802386 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  8023af:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023b4:	b8 23 00 00 00       	mov    $0x23,%eax
+  8023b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023bc:	89 cb                	mov    %ecx,%ebx
+  8023be:	89 cf                	mov    %ecx,%edi
+  8023c0:	89 ce                	mov    %ecx,%esi
+  8023c2:	cd 30                	int    $0x30
+  8023c4:	eb 91                	jmp    802357 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8023c6:	83 ec 0c             	sub    $0xc,%esp
+  8023c9:	50                   	push   %eax
+  8023ca:	6a 23                	push   $0x23
+  8023cc:	68 59 32 80 00       	push   $0x803259
+  8023d1:	6a 4a                	push   $0x4a
+  8023d3:	68 76 32 80 00       	push   $0x803276
+  8023d8:	e8 4c 08 00 00       	call   802c29 <_panic>
+
+008023dd <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  8023dd:	55                   	push   %ebp
+  8023de:	89 e5                	mov    %esp,%ebp
+  8023e0:	57                   	push   %edi
+  8023e1:	56                   	push   %esi
+  8023e2:	53                   	push   %ebx
+  8023e3:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8023e6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8023ed:	78 37                	js     802426 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  8023ef:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8023f6:	74 7a                	je     802472 <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  8023f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  802400:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802403:	b8 24 00 00 00       	mov    $0x24,%eax
+  802408:	89 df                	mov    %ebx,%edi
+  80240a:	89 de                	mov    %ebx,%esi
+  80240c:	55                   	push   %ebp
+  80240d:	68 16 24 80 00       	push   $0x802416
+  802412:	89 e5                	mov    %esp,%ebp
+  802414:	0f 34                	sysenter
+  802416:	83 c4 04             	add    $0x4,%esp
+  802419:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80241a:	85 c0                	test   %eax,%eax
+  80241c:	7f 6c                	jg     80248a <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  80241e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802421:	5b                   	pop    %ebx
+  802422:	5e                   	pop    %esi
+  802423:	5f                   	pop    %edi
+  802424:	5d                   	pop    %ebp
+  802425:	c3                   	ret
+  802426:	b8 01 00 00 00       	mov    $0x1,%eax
+  80242b:	0f a2                	cpuid
+		return 0;
+  80242d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802432:	f6 c6 08             	test   $0x8,%dh
+  802435:	74 15                	je     80244c <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802437:	89 c2                	mov    %eax,%edx
+  802439:	c1 ea 08             	shr    $0x8,%edx
+  80243c:	83 e2 0f             	and    $0xf,%edx
+  80243f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802444:	83 fa 06             	cmp    $0x6,%edx
+  802447:	74 0e                	je     802457 <sys_ep_grant+0x7a>
+  802449:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80244c:	0f b6 c9             	movzbl %cl,%ecx
+  80244f:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802455:	eb 98                	jmp    8023ef <sys_ep_grant+0x12>
+  802457:	89 c2                	mov    %eax,%edx
+  802459:	c1 ea 04             	shr    $0x4,%edx
+  80245c:	83 e2 0f             	and    $0xf,%edx
+  80245f:	83 fa 02             	cmp    $0x2,%edx
+  802462:	77 e5                	ja     802449 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  802464:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802467:	83 f8 02             	cmp    $0x2,%eax
+  80246a:	0f 97 c1             	seta   %cl
+  80246d:	0f b6 c9             	movzbl %cl,%ecx
+  802470:	eb d7                	jmp    802449 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  802472:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802477:	b8 24 00 00 00       	mov    $0x24,%eax
+  80247c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80247f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802482:	89 df                	mov    %ebx,%edi
+  802484:	89 de                	mov    %ebx,%esi
+  802486:	cd 30                	int    $0x30
+  802488:	eb 90                	jmp    80241a <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80248a:	83 ec 0c             	sub    $0xc,%esp
+  80248d:	50                   	push   %eax
+  80248e:	6a 24                	push   $0x24
+  802490:	68 59 32 80 00       	push   $0x803259
+  802495:	6a 4a                	push   $0x4a
+  802497:	68 76 32 80 00       	push   $0x803276
+  80249c:	e8 88 07 00 00       	call   802c29 <_panic>
+
+008024a1 <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  8024a1:	55                   	push   %ebp
+  8024a2:	89 e5                	mov    %esp,%ebp
+  8024a4:	57                   	push   %edi
+  8024a5:	56                   	push   %esi
+  8024a6:	53                   	push   %ebx
+  8024a7:	83 ec 20             	sub    $0x20,%esp
+  8024aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  8024ad:	8b 10                	mov    (%eax),%edx
+  8024af:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8024b2:	8b 50 04             	mov    0x4(%eax),%edx
+  8024b5:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8024b8:	8b 50 08             	mov    0x8(%eax),%edx
+  8024bb:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  8024be:	8b 50 0c             	mov    0xc(%eax),%edx
+  8024c1:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  8024c4:	8b 40 10             	mov    0x10(%eax),%eax
+  8024c7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  8024ca:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  8024cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024d0:	b8 25 00 00 00       	mov    $0x25,%eax
+  8024d5:	55                   	push   %ebp
+  8024d6:	56                   	push   %esi
+  8024d7:	8b 0e                	mov    (%esi),%ecx
+  8024d9:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8024dc:	8b 7e 08             	mov    0x8(%esi),%edi
+  8024df:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8024e2:	8b 76 0c             	mov    0xc(%esi),%esi
+  8024e5:	cd 30                	int    $0x30
+  8024e7:	87 34 24             	xchg   %esi,(%esp)
+  8024ea:	89 0e                	mov    %ecx,(%esi)
+  8024ec:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8024ef:	89 7e 08             	mov    %edi,0x8(%esi)
+  8024f2:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8024f5:	8f 46 0c             	pop    0xc(%esi)
+  8024f8:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  8024f9:	83 c4 20             	add    $0x20,%esp
+  8024fc:	5b                   	pop    %ebx
+  8024fd:	5e                   	pop    %esi
+  8024fe:	5f                   	pop    %edi
+  8024ff:	5d                   	pop    %ebp
+  802500:	c3                   	ret
+
+00802501 <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  802501:	55                   	push   %ebp
+  802502:	89 e5                	mov    %esp,%ebp
+  802504:	57                   	push   %edi
+  802505:	56                   	push   %esi
+  802506:	53                   	push   %ebx
+  802507:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  80250a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80250d:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  80250f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802512:	b8 26 00 00 00       	mov    $0x26,%eax
+  802517:	55                   	push   %ebp
+  802518:	56                   	push   %esi
+  802519:	8b 0e                	mov    (%esi),%ecx
+  80251b:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80251e:	8b 7e 08             	mov    0x8(%esi),%edi
+  802521:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802524:	8b 76 0c             	mov    0xc(%esi),%esi
+  802527:	cd 30                	int    $0x30
+  802529:	87 34 24             	xchg   %esi,(%esp)
+  80252c:	89 0e                	mov    %ecx,(%esi)
+  80252e:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802531:	89 7e 08             	mov    %edi,0x8(%esi)
+  802534:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802537:	8f 46 0c             	pop    0xc(%esi)
+  80253a:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  80253b:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  80253f:	74 0f                	je     802550 <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  802541:	85 c0                	test   %eax,%eax
+  802543:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802548:	0f 48 d1             	cmovs  %ecx,%edx
+  80254b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  80254e:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  802550:	5b                   	pop    %ebx
+  802551:	5e                   	pop    %esi
+  802552:	5f                   	pop    %edi
+  802553:	5d                   	pop    %ebp
+  802554:	c3                   	ret
+
+00802555 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  802555:	55                   	push   %ebp
+  802556:	89 e5                	mov    %esp,%ebp
+  802558:	57                   	push   %edi
+  802559:	56                   	push   %esi
+  80255a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80255b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802562:	78 2f                	js     802593 <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  802564:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80256b:	74 72                	je     8025df <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  80256d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802570:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802575:	b8 27 00 00 00       	mov    $0x27,%eax
+  80257a:	89 cb                	mov    %ecx,%ebx
+  80257c:	89 cf                	mov    %ecx,%edi
+  80257e:	89 ce                	mov    %ecx,%esi
+  802580:	55                   	push   %ebp
+  802581:	68 8a 25 80 00       	push   $0x80258a
+  802586:	89 e5                	mov    %esp,%ebp
+  802588:	0f 34                	sysenter
+  80258a:	83 c4 04             	add    $0x4,%esp
+  80258d:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  80258e:	5b                   	pop    %ebx
+  80258f:	5e                   	pop    %esi
+  802590:	5f                   	pop    %edi
+  802591:	5d                   	pop    %ebp
+  802592:	c3                   	ret
+  802593:	b8 01 00 00 00       	mov    $0x1,%eax
+  802598:	0f a2                	cpuid
+		return 0;
+  80259a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80259f:	f6 c6 08             	test   $0x8,%dh
+  8025a2:	74 15                	je     8025b9 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025a4:	89 c2                	mov    %eax,%edx
+  8025a6:	c1 ea 08             	shr    $0x8,%edx
+  8025a9:	83 e2 0f             	and    $0xf,%edx
+  8025ac:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8025b1:	83 fa 06             	cmp    $0x6,%edx
+  8025b4:	74 0e                	je     8025c4 <sys_sysring_setup+0x6f>
+  8025b6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8025b9:	0f b6 c9             	movzbl %cl,%ecx
+  8025bc:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8025c2:	eb a0                	jmp    802564 <sys_sysring_setup+0xf>
+  8025c4:	89 c2                	mov    %eax,%edx
+  8025c6:	c1 ea 04             	shr    $0x4,%edx
+  8025c9:	83 e2 0f             	and    $0xf,%edx
+  8025cc:	83 fa 02             	cmp    $0x2,%edx
+  8025cf:	77 e5                	ja     8025b6 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  8025d1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025d4:	83 f8 02             	cmp    $0x2,%eax
+  8025d7:	0f 97 c1             	seta   %cl
+  8025da:	0f b6 c9             	movzbl %cl,%ecx
+  8025dd:	eb d7                	jmp    8025b6 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  8025df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025e4:	b8 27 00 00 00       	mov    $0x27,%eax
+  8025e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025ec:	89 cb                	mov    %ecx,%ebx
+  8025ee:	89 cf                	mov    %ecx,%edi
+  8025f0:	89 ce                	mov    %ecx,%esi
+  8025f2:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  8025f4:	eb 98                	jmp    80258e <sys_sysring_setup+0x39>
+
+008025f6 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  8025f6:	55                   	push   %ebp
+  8025f7:	89 e5                	mov    %esp,%ebp
+  8025f9:	57                   	push   %edi
+  8025fa:	56                   	push   %esi
+  8025fb:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8025fc:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802603:	78 2e                	js     802633 <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  802605:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80260c:	74 71                	je     80267f <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  80260e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802613:	b8 28 00 00 00       	mov    $0x28,%eax
+  802618:	89 d1                	mov    %edx,%ecx
+  80261a:	89 d3                	mov    %edx,%ebx
+  80261c:	89 d7                	mov    %edx,%edi
+  80261e:	89 d6                	mov    %edx,%esi
+  802620:	55                   	push   %ebp
+  802621:	68 2a 26 80 00       	push   $0x80262a
+  802626:	89 e5                	mov    %esp,%ebp
+  802628:	0f 34                	sysenter
+  80262a:	83 c4 04             	add    $0x4,%esp
+  80262d:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  80262e:	5b                   	pop    %ebx
+  80262f:	5e                   	pop    %esi
+  802630:	5f                   	pop    %edi
+  802631:	5d                   	pop    %ebp
+  802632:	c3                   	ret
+  802633:	b8 01 00 00 00       	mov    $0x1,%eax
+  802638:	0f a2                	cpuid
+		return 0;
+  80263a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80263f:	f6 c6 08             	test   $0x8,%dh
+  802642:	74 15                	je     802659 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802644:	89 c2                	mov    %eax,%edx
+  802646:	c1 ea 08             	shr    $0x8,%edx
+  802649:	83 e2 0f             	and    $0xf,%edx
+  80264c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802651:	83 fa 06             	cmp    $0x6,%edx
+  802654:	74 0e                	je     802664 <sys_sysring_enter+0x6e>
+  802656:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802659:	0f b6 c9             	movzbl %cl,%ecx
+  80265c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802662:	eb a1                	jmp    802605 <sys_sysring_enter+0xf>
+  802664:	89 c2                	mov    %eax,%edx
+  802666:	c1 ea 04             	shr    $0x4,%edx
+  802669:	83 e2 0f             	and    $0xf,%edx
+  80266c:	83 fa 02             	cmp    $0x2,%edx
+  80266f:	77 e5                	ja     802656 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  802671:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802674:	83 f8 02             	cmp    $0x2,%eax
+  802677:	0f 97 c1             	seta   %cl
+  80267a:	0f b6 c9             	movzbl %cl,%ecx
+  80267d:	eb d7                	jmp    802656 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  80267f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802684:	b8 28 00 00 00       	mov    $0x28,%eax
+  802689:	89 d1                	mov    %edx,%ecx
+  80268b:	89 d3                	mov    %edx,%ebx
+  80268d:	89 d7                	mov    %edx,%edi
+  80268f:	89 d6                	mov    %edx,%esi
+  802691:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  802693:	eb 99                	jmp    80262e <sys_sysring_enter+0x38>
+
+00802695 <pgfault>:
+// The kernel normally resolves these faults itself (page_fault_cow in
+// kern/trap.c); we only get here if it ran out of memory doing so.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802695:	55                   	push   %ebp
+  802696:	89 e5                	mov    %esp,%ebp
+  802698:	83 ec 08             	sub    $0x8,%esp
+  80269b:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  80269e:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  8026a0:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  8026a3:	f6 c2 02             	test   $0x2,%dl
+  8026a6:	74 40                	je     8026e8 <pgfault+0x53>
+  8026a8:	89 c1                	mov    %eax,%ecx
+  8026aa:	c1 e9 16             	shr    $0x16,%ecx
+  8026ad:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  8026b4:	f6 c1 01             	test   $0x1,%cl
+  8026b7:	74 2f                	je     8026e8 <pgfault+0x53>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW))
+  8026b9:	89 c1                	mov    %eax,%ecx
+  8026bb:	c1 e9 0c             	shr    $0xc,%ecx
+  8026be:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  8026c5:	f6 c5 08             	test   $0x8,%ch
+  8026c8:	74 1e                	je     8026e8 <pgfault+0x53>
+	// Replace the page with a private writable copy of itself.  The
+	// kernel allocates, copies and maps it in one system call, so no
+	// temporary mapping at PFTEMP is needed.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8026ca:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r = sys_page_copy(0, addr, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  8026cf:	83 ec 0c             	sub    $0xc,%esp
+  8026d2:	6a 07                	push   $0x7
+  8026d4:	50                   	push   %eax
+  8026d5:	6a 00                	push   $0x0
+  8026d7:	50                   	push   %eax
+  8026d8:	6a 00                	push   $0x0
+  8026da:	e8 85 eb ff ff       	call   801264 <sys_page_copy>
+  8026df:	83 c4 20             	add    $0x20,%esp
+  8026e2:	85 c0                	test   %eax,%eax
+  8026e4:	78 18                	js     8026fe <pgfault+0x69>
+		panic("pgfault: sys_page_copy: %e", r);
+}
+  8026e6:	c9                   	leave
+  8026e7:	c3                   	ret
+		panic("pgfault: va %08x err %x is not a copy-on-write write",
+  8026e8:	83 ec 0c             	sub    $0xc,%esp
+  8026eb:	52                   	push   %edx
+  8026ec:	50                   	push   %eax
+  8026ed:	68 84 32 80 00       	push   $0x803284
+  8026f2:	6a 1c                	push   $0x1c
+  8026f4:	68 b9 32 80 00       	push   $0x8032b9
+  8026f9:	e8 2b 05 00 00       	call   802c29 <_panic>
+		panic("pgfault: sys_page_copy: %e", r);
+  8026fe:	50                   	push   %eax
+  8026ff:	68 c4 32 80 00       	push   $0x8032c4
+  802704:	6a 26                	push   $0x26
+  802706:	68 b9 32 80 00       	push   $0x8032b9
+  80270b:	e8 19 05 00 00       	call   802c29 <_panic>
+
+00802710 <ufork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+ufork(void)
+{
+  802710:	55                   	push   %ebp
+  802711:	89 e5                	mov    %esp,%ebp
+  802713:	57                   	push   %edi
+  802714:	56                   	push   %esi
+  802715:	53                   	push   %ebx
+  802716:	81 ec 38 04 00 00    	sub    $0x438,%esp
+	struct page_range vec[PAGE_VEC_MAX], *last;
+	uintptr_t va;
+	size_t n;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  80271c:	68 95 26 80 00       	push   $0x802695
+  802721:	e8 82 05 00 00       	call   802ca8 <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  802726:	b8 07 00 00 00       	mov    $0x7,%eax
+  80272b:	cd 30                	int    $0x30
+  80272d:	89 85 d4 fb ff ff    	mov    %eax,-0x42c(%ebp)
+
+	envid = sys_exofork();
+	if (envid < 0)
+  802733:	83 c4 10             	add    $0x10,%esp
+  802736:	85 c0                	test   %eax,%eax
+  802738:	0f 88 f2 01 00 00    	js     802930 <ufork+0x220>
+		return 0;
+	}
+
+	// Copy every run of mapped pages below the exception stack, which
+	// must not be shared.
+	va = 0;
+  80273e:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  802743:	74 0b                	je     802750 <ufork+0x40>
+  802745:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  80274b:	e9 07 01 00 00       	jmp    802857 <ufork+0x147>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  802750:	e8 22 e8 ff ff       	call   800f77 <sys_getenvid>
+  802755:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80275a:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802760:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802765:	a3 0c 40 80 00       	mov    %eax,0x80400c
+		return 0;
+  80276a:	e9 c1 01 00 00       	jmp    802930 <ufork+0x220>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+		n = r;
+		last = &vec[n - 1];
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  80276f:	83 ea 01             	sub    $0x1,%edx
+  802772:	89 c1                	mov    %eax,%ecx
+  802774:	c1 e1 04             	shl    $0x4,%ecx
+  802777:	89 94 0d ec fd ff ff 	mov    %edx,-0x214(%ebp,%ecx,1)
+			n--;
+  80277e:	85 d2                	test   %edx,%edx
+  802780:	0f 44 f0             	cmove  %eax,%esi
+  802783:	e9 12 01 00 00       	jmp    80289a <ufork+0x18a>
+	for (i = 0; i < n; i++) {
+  802788:	83 c1 01             	add    $0x1,%ecx
+  80278b:	83 c0 10             	add    $0x10,%eax
+  80278e:	39 8d e4 fb ff ff    	cmp    %ecx,-0x41c(%ebp)
+  802794:	74 6a                	je     802800 <ufork+0xf0>
+		vec[i].pr_dstva = vec[i].pr_va;
+  802796:	89 c3                	mov    %eax,%ebx
+  802798:	8b 10                	mov    (%eax),%edx
+  80279a:	89 50 0c             	mov    %edx,0xc(%eax)
+		if (vec[i].pr_perm & PTE_SHARE)
+  80279d:	8b 50 08             	mov    0x8(%eax),%edx
+  8027a0:	f6 c6 04             	test   $0x4,%dh
+  8027a3:	75 e3                	jne    802788 <ufork+0x78>
+		if (vec[i].pr_perm & (PTE_W | PTE_COW)) {
+  8027a5:	f7 c2 02 08 00 00    	test   $0x802,%edx
+  8027ab:	74 db                	je     802788 <ufork+0x78>
+			vec[i].pr_perm = (vec[i].pr_perm & ~PTE_W) | PTE_COW;
+  8027ad:	81 e2 fd f7 ff ff    	and    $0xfffff7fd,%edx
+  8027b3:	80 ce 08             	or     $0x8,%dh
+  8027b6:	89 95 dc fb ff ff    	mov    %edx,-0x424(%ebp)
+  8027bc:	89 53 08             	mov    %edx,0x8(%ebx)
+			cow[ncow++] = vec[i];
+  8027bf:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  8027c5:	c1 e6 04             	shl    $0x4,%esi
+  8027c8:	89 f2                	mov    %esi,%edx
+  8027ca:	8d b4 35 e8 fb ff ff 	lea    -0x418(%ebp,%esi,1),%esi
+  8027d1:	8b 38                	mov    (%eax),%edi
+  8027d3:	89 bc 15 e8 fb ff ff 	mov    %edi,-0x418(%ebp,%edx,1)
+  8027da:	8b 78 04             	mov    0x4(%eax),%edi
+  8027dd:	89 7e 04             	mov    %edi,0x4(%esi)
+  8027e0:	8b bd dc fb ff ff    	mov    -0x424(%ebp),%edi
+  8027e6:	89 7e 08             	mov    %edi,0x8(%esi)
+  8027e9:	8b 50 0c             	mov    0xc(%eax),%edx
+  8027ec:	89 56 0c             	mov    %edx,0xc(%esi)
+  8027ef:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  8027f5:	8d 7e 01             	lea    0x1(%esi),%edi
+  8027f8:	89 bd e0 fb ff ff    	mov    %edi,-0x420(%ebp)
+  8027fe:	eb 88                	jmp    802788 <ufork+0x78>
+	if ((r = sys_page_map_vec(0, envid, vec, n, 0)) < 0)
+  802800:	8b b5 e4 fb ff ff    	mov    -0x41c(%ebp),%esi
+  802806:	8b bd d8 fb ff ff    	mov    -0x428(%ebp),%edi
+  80280c:	83 ec 0c             	sub    $0xc,%esp
+  80280f:	6a 00                	push   $0x0
+  802811:	56                   	push   %esi
+  802812:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802818:	50                   	push   %eax
+  802819:	ff b5 d4 fb ff ff    	push   -0x42c(%ebp)
+  80281f:	6a 00                	push   $0x0
+  802821:	e8 80 f4 ff ff       	call   801ca6 <sys_page_map_vec>
+  802826:	83 c4 20             	add    $0x20,%esp
+  802829:	85 c0                	test   %eax,%eax
+  80282b:	0f 88 e5 00 00 00    	js     802916 <ufork+0x206>
+	return sys_page_map_vec(0, 0, cow, ncow, 0);
+  802831:	83 ec 0c             	sub    $0xc,%esp
+  802834:	6a 00                	push   $0x0
+  802836:	ff b5 e0 fb ff ff    	push   -0x420(%ebp)
+  80283c:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  802842:	50                   	push   %eax
+  802843:	6a 00                	push   $0x0
+  802845:	6a 00                	push   $0x0
+  802847:	e8 5a f4 ff ff       	call   801ca6 <sys_page_map_vec>
+		if ((r = duppages(envid, vec, n)) < 0)
+  80284c:	83 c4 20             	add    $0x20,%esp
+  80284f:	85 c0                	test   %eax,%eax
+  802851:	0f 88 e7 00 00 00    	js     80293e <ufork+0x22e>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+  802857:	6a 20                	push   $0x20
+  802859:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  80285f:	50                   	push   %eax
+  802860:	57                   	push   %edi
+  802861:	6a 00                	push   $0x0
+  802863:	e8 82 f4 ff ff       	call   801cea <sys_vm_ranges>
+  802868:	83 c4 10             	add    $0x10,%esp
+  80286b:	85 c0                	test   %eax,%eax
+  80286d:	7e 51                	jle    8028c0 <ufork+0x1b0>
+		n = r;
+  80286f:	89 c6                	mov    %eax,%esi
+		last = &vec[n - 1];
+  802871:	83 e8 01             	sub    $0x1,%eax
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+  802874:	89 c1                	mov    %eax,%ecx
+  802876:	c1 e1 04             	shl    $0x4,%ecx
+  802879:	8b 94 0d ec fd ff ff 	mov    -0x214(%ebp,%ecx,1),%edx
+  802880:	89 d3                	mov    %edx,%ebx
+  802882:	c1 e3 0c             	shl    $0xc,%ebx
+  802885:	89 df                	mov    %ebx,%edi
+  802887:	03 bc 0d e8 fd ff ff 	add    -0x218(%ebp,%ecx,1),%edi
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  80288e:	81 ff 00 00 c0 ee    	cmp    $0xeec00000,%edi
+  802894:	0f 84 d5 fe ff ff    	je     80276f <ufork+0x5f>
+	for (i = 0; i < n; i++) {
+  80289a:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+	size_t i, ncow = 0;
+  8028a0:	c7 85 e0 fb ff ff 00 	movl   $0x0,-0x420(%ebp)
+  8028a7:	00 00 00 
+	for (i = 0; i < n; i++) {
+  8028aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028af:	89 bd d8 fb ff ff    	mov    %edi,-0x428(%ebp)
+  8028b5:	89 b5 e4 fb ff ff    	mov    %esi,-0x41c(%ebp)
+  8028bb:	e9 ce fe ff ff       	jmp    80278e <ufork+0x7e>
+			goto fail;
+	}
+	if (r < 0)
+  8028c0:	89 c6                	mov    %eax,%esi
+  8028c2:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  8028c8:	85 c0                	test   %eax,%eax
+  8028ca:	78 52                	js     80291e <ufork+0x20e>
+		goto fail;
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE),
+  8028cc:	83 ec 04             	sub    $0x4,%esp
+  8028cf:	6a 07                	push   $0x7
+  8028d1:	68 00 f0 bf ee       	push   $0xeebff000
+  8028d6:	53                   	push   %ebx
+  8028d7:	e8 3a e7 ff ff       	call   801016 <sys_page_alloc>
+  8028dc:	89 c6                	mov    %eax,%esi
+  8028de:	83 c4 10             	add    $0x10,%esp
+  8028e1:	85 c0                	test   %eax,%eax
+  8028e3:	78 39                	js     80291e <ufork+0x20e>
+				PTE_P | PTE_U | PTE_W)) < 0
+	    || (r = sys_env_set_pgfault_upcall(envid,
+			thisenv->env_pgfault_upcall)) < 0
+  8028e5:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8028ea:	8b 40 74             	mov    0x74(%eax),%eax
+	    || (r = sys_env_set_pgfault_upcall(envid,
+  8028ed:	83 ec 08             	sub    $0x8,%esp
+  8028f0:	50                   	push   %eax
+  8028f1:	53                   	push   %ebx
+  8028f2:	e8 de ed ff ff       	call   8016d5 <sys_env_set_pgfault_upcall>
+  8028f7:	89 c6                	mov    %eax,%esi
+  8028f9:	83 c4 10             	add    $0x10,%esp
+  8028fc:	85 c0                	test   %eax,%eax
+  8028fe:	78 1e                	js     80291e <ufork+0x20e>
+	    || (r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  802900:	83 ec 08             	sub    $0x8,%esp
+  802903:	6a 02                	push   $0x2
+  802905:	53                   	push   %ebx
+  802906:	e8 bc ea ff ff       	call   8013c7 <sys_env_set_status>
+  80290b:	89 c6                	mov    %eax,%esi
+  80290d:	83 c4 10             	add    $0x10,%esp
+  802910:	85 c0                	test   %eax,%eax
+  802912:	79 1c                	jns    802930 <ufork+0x220>
+  802914:	eb 08                	jmp    80291e <ufork+0x20e>
+  802916:	89 c6                	mov    %eax,%esi
+  802918:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+		goto fail;
+	return envid;
+
+fail:
+	sys_env_destroy(envid);
+  80291e:	83 ec 0c             	sub    $0xc,%esp
+  802921:	53                   	push   %ebx
+  802922:	e8 8e e5 ff ff       	call   800eb5 <sys_env_destroy>
+	return r;
+  802927:	83 c4 10             	add    $0x10,%esp
+  80292a:	89 b5 d4 fb ff ff    	mov    %esi,-0x42c(%ebp)
+}
+  802930:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+  802936:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802939:	5b                   	pop    %ebx
+  80293a:	5e                   	pop    %esi
+  80293b:	5f                   	pop    %edi
+  80293c:	5d                   	pop    %ebp
+  80293d:	c3                   	ret
+  80293e:	89 c6                	mov    %eax,%esi
+  802940:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  802946:	eb d6                	jmp    80291e <ufork+0x20e>
+
+00802948 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  802948:	55                   	push   %ebp
+  802949:	89 e5                	mov    %esp,%ebp
+  80294b:	53                   	push   %ebx
+  80294c:	83 ec 04             	sub    $0x4,%esp
+	envid_t envid;
+
+	envid = sys_fork();
+  80294f:	e8 90 f2 ff ff       	call   801be4 <sys_fork>
+  802954:	89 c3                	mov    %eax,%ebx
+	if (envid == 0)
+  802956:	85 c0                	test   %eax,%eax
+  802958:	74 07                	je     802961 <fork+0x19>
+		thisenv = &envs[ENVX(sys_getenvid())];
+	return envid;
+}
+  80295a:	89 d8                	mov    %ebx,%eax
+  80295c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80295f:	c9                   	leave
+  802960:	c3                   	ret
+		thisenv = &envs[ENVX(sys_getenvid())];
+  802961:	e8 11 e6 ff ff       	call   800f77 <sys_getenvid>
+  802966:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80296b:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802971:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802976:	a3 0c 40 80 00       	mov    %eax,0x80400c
+	return envid;
+  80297b:	eb dd                	jmp    80295a <fork+0x12>
+
+0080297d <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  80297d:	55                   	push   %ebp
+  80297e:	89 e5                	mov    %esp,%ebp
+  802980:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  802983:	68 df 32 80 00       	push   $0x8032df
+  802988:	68 a1 00 00 00       	push   $0xa1
+  80298d:	68 b9 32 80 00       	push   $0x8032b9
+  802992:	e8 92 02 00 00       	call   802c29 <_panic>
+
+00802997 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802997:	55                   	push   %ebp
+  802998:	89 e5                	mov    %esp,%ebp
+  80299a:	56                   	push   %esi
+  80299b:	53                   	push   %ebx
+  80299c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80299f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if ((r = sys_ipc_recv(pg ? pg : (void *) UTOP)) < 0) {
+  8029a5:	85 c0                	test   %eax,%eax
+  8029a7:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8029ac:	0f 44 c2             	cmove  %edx,%eax
+  8029af:	83 ec 0c             	sub    $0xc,%esp
+  8029b2:	50                   	push   %eax
+  8029b3:	e8 2f ef ff ff       	call   8018e7 <sys_ipc_recv>
+  8029b8:	83 c4 10             	add    $0x10,%esp
+  8029bb:	85 c0                	test   %eax,%eax
+  8029bd:	78 34                	js     8029f3 <ipc_recv+0x5c>
+			*from_env_store = 0;
+		if (perm_store)
+			*perm_store = 0;
+		return r;
+	}
+	if (from_env_store)
+  8029bf:	85 f6                	test   %esi,%esi
+  8029c1:	74 0d                	je     8029d0 <ipc_recv+0x39>
+		*from_env_store = thisenv->env_ipc_from;
+  8029c3:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8029c8:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  8029ce:	89 06                	mov    %eax,(%esi)
+	if (perm_store)
+  8029d0:	85 db                	test   %ebx,%ebx
+  8029d2:	74 0d                	je     8029e1 <ipc_recv+0x4a>
+		*perm_store = thisenv->env_ipc_perm;
+  8029d4:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8029d9:	8b 80 9c 00 00 00    	mov    0x9c(%eax),%eax
+  8029df:	89 03                	mov    %eax,(%ebx)
+	return thisenv->env_ipc_msg.m_w[0];
+  8029e1:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8029e6:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8029ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029ef:	5b                   	pop    %ebx
+  8029f0:	5e                   	pop    %esi
+  8029f1:	5d                   	pop    %ebp
+  8029f2:	c3                   	ret
+		if (from_env_store)
+  8029f3:	85 f6                	test   %esi,%esi
+  8029f5:	74 06                	je     8029fd <ipc_recv+0x66>
+			*from_env_store = 0;
+  8029f7:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  8029fd:	85 db                	test   %ebx,%ebx
+  8029ff:	74 eb                	je     8029ec <ipc_recv+0x55>
+			*perm_store = 0;
+  802a01:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802a07:	eb e3                	jmp    8029ec <ipc_recv+0x55>
+
+00802a09 <ipc_send>:
+//
+// The kernel queues us behind any other senders until 'toenv'
+// receives, so we only come back to retry if its queue was full.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802a09:	55                   	push   %ebp
+  802a0a:	89 e5                	mov    %esp,%ebp
+  802a0c:	57                   	push   %edi
+  802a0d:	56                   	push   %esi
+  802a0e:	53                   	push   %ebx
+  802a0f:	83 ec 0c             	sub    $0xc,%esp
+  802a12:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a15:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802a18:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_send(to_env, val, pg ? pg : (void *) UTOP, perm))
+  802a1b:	85 db                	test   %ebx,%ebx
+  802a1d:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802a22:	0f 44 d8             	cmove  %eax,%ebx
+  802a25:	eb 05                	jmp    802a2c <ipc_send+0x23>
+	       == -E_AGAIN)
+		sys_yield();
+  802a27:	e8 fc e8 ff ff       	call   801328 <sys_yield>
+	while ((r = sys_ipc_send(to_env, val, pg ? pg : (void *) UTOP, perm))
+  802a2c:	ff 75 14             	push   0x14(%ebp)
+  802a2f:	53                   	push   %ebx
+  802a30:	56                   	push   %esi
+  802a31:	57                   	push   %edi
+  802a32:	e8 09 ee ff ff       	call   801840 <sys_ipc_send>
+	       == -E_AGAIN)
+  802a37:	83 c4 10             	add    $0x10,%esp
+  802a3a:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802a3d:	74 e8                	je     802a27 <ipc_send+0x1e>
+	if (r < 0)
+  802a3f:	85 c0                	test   %eax,%eax
+  802a41:	78 08                	js     802a4b <ipc_send+0x42>
+		panic("ipc_send: %e", r);
+}
+  802a43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a46:	5b                   	pop    %ebx
+  802a47:	5e                   	pop    %esi
+  802a48:	5f                   	pop    %edi
+  802a49:	5d                   	pop    %ebp
+  802a4a:	c3                   	ret
+		panic("ipc_send: %e", r);
+  802a4b:	50                   	push   %eax
+  802a4c:	68 f5 32 80 00       	push   $0x8032f5
+  802a51:	6a 3a                	push   $0x3a
+  802a53:	68 02 33 80 00       	push   $0x803302
+  802a58:	e8 cc 01 00 00       	call   802c29 <_panic>
+
+00802a5d <ipc_send_range>:
+
+// Like ipc_send, but send the 'npages' contiguous pages at 'pg' in one
+// message.  The receiver maps as many as fit in its window.
+void
+ipc_send_range(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  802a5d:	55                   	push   %ebp
+  802a5e:	89 e5                	mov    %esp,%ebp
+  802a60:	57                   	push   %edi
+  802a61:	56                   	push   %esi
+  802a62:	53                   	push   %ebx
+  802a63:	83 ec 0c             	sub    $0xc,%esp
+  802a66:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a69:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802a6c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_send_range(to_env, val, pg, npages, perm))
+  802a6f:	eb 05                	jmp    802a76 <ipc_send_range+0x19>
+	       == -E_AGAIN)
+		sys_yield();
+  802a71:	e8 b2 e8 ff ff       	call   801328 <sys_yield>
+	while ((r = sys_ipc_send_range(to_env, val, pg, npages, perm))
+  802a76:	83 ec 0c             	sub    $0xc,%esp
+  802a79:	ff 75 18             	push   0x18(%ebp)
+  802a7c:	ff 75 14             	push   0x14(%ebp)
+  802a7f:	53                   	push   %ebx
+  802a80:	56                   	push   %esi
+  802a81:	57                   	push   %edi
+  802a82:	e8 22 ef ff ff       	call   8019a9 <sys_ipc_send_range>
+	       == -E_AGAIN)
+  802a87:	83 c4 20             	add    $0x20,%esp
+  802a8a:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802a8d:	74 e2                	je     802a71 <ipc_send_range+0x14>
+	if (r < 0)
+  802a8f:	85 c0                	test   %eax,%eax
+  802a91:	78 08                	js     802a9b <ipc_send_range+0x3e>
+		panic("ipc_send_range: %e", r);
+}
+  802a93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a96:	5b                   	pop    %ebx
+  802a97:	5e                   	pop    %esi
+  802a98:	5f                   	pop    %edi
+  802a99:	5d                   	pop    %ebp
+  802a9a:	c3                   	ret
+		panic("ipc_send_range: %e", r);
+  802a9b:	50                   	push   %eax
+  802a9c:	68 0c 33 80 00       	push   $0x80330c
+  802aa1:	6a 48                	push   $0x48
+  802aa3:	68 02 33 80 00       	push   $0x803302
+  802aa8:	e8 7c 01 00 00       	call   802c29 <_panic>
+
+00802aad <ipc_recv_range>:
+// (which must not be null).  On return *npages holds the number of
+// pages received, which is 0 on error or if the sender sent none.
+int32_t
+ipc_recv_range(envid_t *from_env_store, void *pg, size_t *npages,
+	       int *perm_store)
+{
+  802aad:	55                   	push   %ebp
+  802aae:	89 e5                	mov    %esp,%ebp
+  802ab0:	57                   	push   %edi
+  802ab1:	56                   	push   %esi
+  802ab2:	53                   	push   %ebx
+  802ab3:	83 ec 14             	sub    $0x14,%esp
+  802ab6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802ab9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802abc:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if ((r = sys_ipc_recv_range(pg, *npages)) < 0) {
+  802abf:	ff 33                	push   (%ebx)
+  802ac1:	ff 75 0c             	push   0xc(%ebp)
+  802ac4:	e8 83 ef ff ff       	call   801a4c <sys_ipc_recv_range>
+  802ac9:	83 c4 10             	add    $0x10,%esp
+  802acc:	85 c0                	test   %eax,%eax
+  802ace:	78 42                	js     802b12 <ipc_recv_range+0x65>
+		if (perm_store)
+			*perm_store = 0;
+		*npages = 0;
+		return r;
+	}
+	if (from_env_store)
+  802ad0:	85 ff                	test   %edi,%edi
+  802ad2:	74 0d                	je     802ae1 <ipc_recv_range+0x34>
+		*from_env_store = thisenv->env_ipc_from;
+  802ad4:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  802ad9:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  802adf:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  802ae1:	85 f6                	test   %esi,%esi
+  802ae3:	74 0d                	je     802af2 <ipc_recv_range+0x45>
+		*perm_store = thisenv->env_ipc_perm;
+  802ae5:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  802aea:	8b 80 9c 00 00 00    	mov    0x9c(%eax),%eax
+  802af0:	89 06                	mov    %eax,(%esi)
+	*npages = thisenv->env_ipc_npages;
+  802af2:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  802af7:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802afd:	89 03                	mov    %eax,(%ebx)
+	return thisenv->env_ipc_msg.m_w[0];
+  802aff:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  802b04:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802b0a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b0d:	5b                   	pop    %ebx
+  802b0e:	5e                   	pop    %esi
+  802b0f:	5f                   	pop    %edi
+  802b10:	5d                   	pop    %ebp
+  802b11:	c3                   	ret
+		if (from_env_store)
+  802b12:	85 ff                	test   %edi,%edi
+  802b14:	74 06                	je     802b1c <ipc_recv_range+0x6f>
+			*from_env_store = 0;
+  802b16:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  802b1c:	85 f6                	test   %esi,%esi
+  802b1e:	74 06                	je     802b26 <ipc_recv_range+0x79>
+			*perm_store = 0;
+  802b20:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		*npages = 0;
+  802b26:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		return r;
+  802b2c:	eb dc                	jmp    802b0a <ipc_recv_range+0x5d>
+
+00802b2e <ipc_send_msg>:
+// Send the IPC_MSG_WORDS words of 'msg' to 'to_env', in registers and
+// without a page.  Waits like ipc_send until 'to_env' takes them, and
+// panics on any error other than -E_AGAIN.
+void
+ipc_send_msg(envid_t to_env, const struct ipc_msg *msg)
+{
+  802b2e:	55                   	push   %ebp
+  802b2f:	89 e5                	mov    %esp,%ebp
+  802b31:	56                   	push   %esi
+  802b32:	53                   	push   %ebx
+  802b33:	8b 75 08             	mov    0x8(%ebp),%esi
+  802b36:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_send_msg(to_env, msg)) == -E_AGAIN)
+  802b39:	eb 05                	jmp    802b40 <ipc_send_msg+0x12>
+		sys_yield();
+  802b3b:	e8 e8 e7 ff ff       	call   801328 <sys_yield>
+	while ((r = sys_ipc_send_msg(to_env, msg)) == -E_AGAIN)
+  802b40:	83 ec 08             	sub    $0x8,%esp
+  802b43:	53                   	push   %ebx
+  802b44:	56                   	push   %esi
+  802b45:	e8 3a f0 ff ff       	call   801b84 <sys_ipc_send_msg>
+  802b4a:	83 c4 10             	add    $0x10,%esp
+  802b4d:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802b50:	74 e9                	je     802b3b <ipc_send_msg+0xd>
+	if (r < 0)
+  802b52:	85 c0                	test   %eax,%eax
+  802b54:	78 07                	js     802b5d <ipc_send_msg+0x2f>
+		panic("ipc_send_msg: %e", r);
+}
+  802b56:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b59:	5b                   	pop    %ebx
+  802b5a:	5e                   	pop    %esi
+  802b5b:	5d                   	pop    %ebp
+  802b5c:	c3                   	ret
+		panic("ipc_send_msg: %e", r);
+  802b5d:	50                   	push   %eax
+  802b5e:	68 1f 33 80 00       	push   $0x80331f
+  802b63:	6a 6f                	push   $0x6f
+  802b65:	68 02 33 80 00       	push   $0x803302
+  802b6a:	e8 ba 00 00 00       	call   802c29 <_panic>
+
+00802b6f <ipc_recv_msg>:
+// ipc_call or plain ipc_send (whose value is word 0, and whose page is
+// not taken), it arrives in registers and needs no page.
+// Returns the sender's envid, < 0 on error.
+envid_t
+ipc_recv_msg(struct ipc_msg *msg)
+{
+  802b6f:	55                   	push   %ebp
+  802b70:	89 e5                	mov    %esp,%ebp
+  802b72:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_reply_wait(0, msg);
+  802b75:	ff 75 08             	push   0x8(%ebp)
+  802b78:	6a 00                	push   $0x0
+  802b7a:	e8 cb ef ff ff       	call   801b4a <sys_ipc_reply_wait>
+}
+  802b7f:	c9                   	leave
+  802b80:	c3                   	ret
+
+00802b81 <ipc_call>:
+// ipc_reply_wait (or ipc_recv), and straight back when it replies.
+// Retries while to_env's queue is full.
+// Returns 0 on success, < 0 on error.
+int
+ipc_call(envid_t to_env, struct ipc_msg *msg)
+{
+  802b81:	55                   	push   %ebp
+  802b82:	89 e5                	mov    %esp,%ebp
+  802b84:	56                   	push   %esi
+  802b85:	53                   	push   %ebx
+  802b86:	8b 75 08             	mov    0x8(%ebp),%esi
+  802b89:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_call(to_env, msg)) == -E_AGAIN)
+  802b8c:	eb 05                	jmp    802b93 <ipc_call+0x12>
+		sys_yield();
+  802b8e:	e8 95 e7 ff ff       	call   801328 <sys_yield>
+	while ((r = sys_ipc_call(to_env, msg)) == -E_AGAIN)
+  802b93:	83 ec 08             	sub    $0x8,%esp
+  802b96:	53                   	push   %ebx
+  802b97:	56                   	push   %esi
+  802b98:	e8 73 ef ff ff       	call   801b10 <sys_ipc_call>
+  802b9d:	83 c4 10             	add    $0x10,%esp
+  802ba0:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802ba3:	74 e9                	je     802b8e <ipc_call+0xd>
+	return r;
+}
+  802ba5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ba8:	5b                   	pop    %ebx
+  802ba9:	5e                   	pop    %esi
+  802baa:	5d                   	pop    %ebp
+  802bab:	c3                   	ret
+
+00802bac <ipc_reply_wait>:
+//	}
+//
+// Returns the envid of the sender, < 0 on error.
+envid_t
+ipc_reply_wait(envid_t to_env, struct ipc_msg *msg)
+{
+  802bac:	55                   	push   %ebp
+  802bad:	89 e5                	mov    %esp,%ebp
+  802baf:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_reply_wait(to_env, msg);
+  802bb2:	ff 75 0c             	push   0xc(%ebp)
+  802bb5:	ff 75 08             	push   0x8(%ebp)
+  802bb8:	e8 8d ef ff ff       	call   801b4a <sys_ipc_reply_wait>
+}
+  802bbd:	c9                   	leave
+  802bbe:	c3                   	ret
+
+00802bbf <ep_send>:
+
+// Send 'msg' to endpoint 'epid', waiting while its queue is full.
+// Returns 0 on success, < 0 if the endpoint is gone or not ours to use.
+int
+ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  802bbf:	55                   	push   %ebp
+  802bc0:	89 e5                	mov    %esp,%ebp
+  802bc2:	56                   	push   %esi
+  802bc3:	53                   	push   %ebx
+  802bc4:	8b 75 08             	mov    0x8(%ebp),%esi
+  802bc7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ep_send(epid, msg)) == -E_AGAIN)
+  802bca:	eb 05                	jmp    802bd1 <ep_send+0x12>
+		sys_yield();
+  802bcc:	e8 57 e7 ff ff       	call   801328 <sys_yield>
+	while ((r = sys_ep_send(epid, msg)) == -E_AGAIN)
+  802bd1:	83 ec 08             	sub    $0x8,%esp
+  802bd4:	53                   	push   %ebx
+  802bd5:	56                   	push   %esi
+  802bd6:	e8 c6 f8 ff ff       	call   8024a1 <sys_ep_send>
+  802bdb:	83 c4 10             	add    $0x10,%esp
+  802bde:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802be1:	74 e9                	je     802bcc <ep_send+0xd>
+	return r;
+}
+  802be3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802be6:	5b                   	pop    %ebx
+  802be7:	5e                   	pop    %esi
+  802be8:	5d                   	pop    %ebp
+  802be9:	c3                   	ret
+
+00802bea <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802bea:	55                   	push   %ebp
+  802beb:	89 e5                	mov    %esp,%ebp
+  802bed:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802bf0:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802bf5:	69 d0 68 01 00 00    	imul   $0x168,%eax,%edx
+  802bfb:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802c01:	8b 52 50             	mov    0x50(%edx),%edx
+  802c04:	39 ca                	cmp    %ecx,%edx
+  802c06:	74 11                	je     802c19 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802c08:	83 c0 01             	add    $0x1,%eax
+  802c0b:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802c10:	75 e3                	jne    802bf5 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802c12:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c17:	eb 0e                	jmp    802c27 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802c19:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802c1f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802c24:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802c27:	5d                   	pop    %ebp
+  802c28:	c3                   	ret
+
+00802c29 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802c29:	55                   	push   %ebp
+  802c2a:	89 e5                	mov    %esp,%ebp
+  802c2c:	57                   	push   %edi
+  802c2d:	56                   	push   %esi
+  802c2e:	53                   	push   %ebx
+  802c2f:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  802c35:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  802c38:	8b 1d 00 40 80 00    	mov    0x804000,%ebx
+  802c3e:	e8 34 e3 ff ff       	call   800f77 <sys_getenvid>
+  802c43:	83 ec 04             	sub    $0x4,%esp
+  802c46:	ff 75 0c             	push   0xc(%ebp)
+  802c49:	ff 75 08             	push   0x8(%ebp)
+  802c4c:	53                   	push   %ebx
+  802c4d:	50                   	push   %eax
+  802c4e:	68 30 33 80 00       	push   $0x803330
+  802c53:	68 00 01 00 00       	push   $0x100
+  802c58:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  802c5e:	56                   	push   %esi
+  802c5f:	e8 28 db ff ff       	call   80078c <snprintf>
+  802c64:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  802c66:	83 c4 20             	add    $0x20,%esp
+  802c69:	57                   	push   %edi
+  802c6a:	ff 75 10             	push   0x10(%ebp)
+  802c6d:	bf 00 01 00 00       	mov    $0x100,%edi
+  802c72:	89 f8                	mov    %edi,%eax
+  802c74:	29 d8                	sub    %ebx,%eax
+  802c76:	50                   	push   %eax
+  802c77:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  802c7a:	50                   	push   %eax
+  802c7b:	e8 be da ff ff       	call   80073e <vsnprintf>
+  802c80:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  802c82:	83 c4 0c             	add    $0xc,%esp
+  802c85:	68 58 2f 80 00       	push   $0x802f58
+  802c8a:	29 df                	sub    %ebx,%edi
+  802c8c:	57                   	push   %edi
+  802c8d:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  802c90:	50                   	push   %eax
+  802c91:	e8 f6 da ff ff       	call   80078c <snprintf>
+	sys_cputs(buf, r);
+  802c96:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  802c99:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  802c9b:	53                   	push   %ebx
+  802c9c:	56                   	push   %esi
+  802c9d:	e8 d7 e0 ff ff       	call   800d79 <sys_cputs>
+  802ca2:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802ca5:	cc                   	int3
+	while (1)
+  802ca6:	eb fd                	jmp    802ca5 <_panic+0x7c>
+
+00802ca8 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802ca8:	55                   	push   %ebp
+  802ca9:	89 e5                	mov    %esp,%ebp
+  802cab:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  802cae:	83 3d 10 40 80 00 00 	cmpl   $0x0,0x804010
+  802cb5:	74 0a                	je     802cc1 <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  802cb7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cba:	a3 10 40 80 00       	mov    %eax,0x804010
+}
+  802cbf:	c9                   	leave
+  802cc0:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE),
+  802cc1:	83 ec 04             	sub    $0x4,%esp
+  802cc4:	6a 07                	push   $0x7
+  802cc6:	68 00 f0 bf ee       	push   $0xeebff000
+  802ccb:	6a 00                	push   $0x0
+  802ccd:	e8 44 e3 ff ff       	call   801016 <sys_page_alloc>
+  802cd2:	83 c4 10             	add    $0x10,%esp
+  802cd5:	85 c0                	test   %eax,%eax
+  802cd7:	78 28                	js     802d01 <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  802cd9:	83 ec 08             	sub    $0x8,%esp
+  802cdc:	68 13 2d 80 00       	push   $0x802d13
+  802ce1:	6a 00                	push   $0x0
+  802ce3:	e8 ed e9 ff ff       	call   8016d5 <sys_env_set_pgfault_upcall>
+  802ce8:	83 c4 10             	add    $0x10,%esp
+  802ceb:	85 c0                	test   %eax,%eax
+  802ced:	79 c8                	jns    802cb7 <set_pgfault_handler+0xf>
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+  802cef:	50                   	push   %eax
+  802cf0:	68 7c 33 80 00       	push   $0x80337c
+  802cf5:	6a 24                	push   $0x24
+  802cf7:	68 b0 33 80 00       	push   $0x8033b0
+  802cfc:	e8 28 ff ff ff       	call   802c29 <_panic>
+			panic("set_pgfault_handler: sys_page_alloc: %e", r);
+  802d01:	50                   	push   %eax
+  802d02:	68 54 33 80 00       	push   $0x803354
+  802d07:	6a 22                	push   $0x22
+  802d09:	68 b0 33 80 00       	push   $0x8033b0
+  802d0e:	e8 16 ff ff ff       	call   802c29 <_panic>
+
+00802d13 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802d13:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802d14:	a1 10 40 80 00       	mov    0x804010,%eax
+	call *%eax
+  802d19:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802d1b:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 0x28(%esp), %ebx		// trap-time eip
+  802d1e:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl 0x30(%esp), %eax		// trap-time esp
+  802d22:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  802d26:	83 e8 04             	sub    $0x4,%eax
+	movl %ebx, (%eax)
+  802d29:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 0x30(%esp)
+  802d2b:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp			// skip fault_va and err
+  802d2f:	83 c4 08             	add    $0x8,%esp
+	popal
+  802d32:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp			// skip eip
+  802d33:	83 c4 04             	add    $0x4,%esp
+	popfl
+  802d36:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802d37:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802d38:	c3                   	ret
+
+00802d39 <dm>:
+  802d39:	55                   	push   %ebp
+  802d3a:	57                   	push   %edi
+  802d3b:	56                   	push   %esi
+  802d3c:	53                   	push   %ebx
+  802d3d:	83 ec 24             	sub    $0x24,%esp
+  802d40:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802d44:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802d48:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802d4c:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802d50:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802d54:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802d58:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802d5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d61:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d66:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802d6b:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802d72:	00 
+  802d73:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802d7a:	00 
+  802d7b:	89 fb                	mov    %edi,%ebx
+  802d7d:	eb 08                	jmp    802d87 <dm+0x4e>
+  802d7f:	83 e9 01             	sub    $0x1,%ecx
+  802d82:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802d85:	74 68                	je     802def <dm+0xb6>
+  802d87:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802d8b:	01 c0                	add    %eax,%eax
+  802d8d:	89 c6                	mov    %eax,%esi
+  802d8f:	89 d7                	mov    %edx,%edi
+  802d91:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802d95:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802d99:	0f ad d0             	shrd   %cl,%edx,%eax
+  802d9c:	d3 ea                	shr    %cl,%edx
+  802d9e:	f6 c1 20             	test   $0x20,%cl
+  802da1:	74 04                	je     802da7 <dm+0x6e>
+  802da3:	89 d0                	mov    %edx,%eax
+  802da5:	31 d2                	xor    %edx,%edx
+  802da7:	83 e0 01             	and    $0x1,%eax
+  802daa:	89 04 24             	mov    %eax,(%esp)
+  802dad:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802db4:	00 
+  802db5:	8b 04 24             	mov    (%esp),%eax
+  802db8:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802dbc:	09 f0                	or     %esi,%eax
+  802dbe:	09 fa                	or     %edi,%edx
+  802dc0:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802dc4:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802dc8:	39 f0                	cmp    %esi,%eax
+  802dca:	89 d5                	mov    %edx,%ebp
+  802dcc:	19 fd                	sbb    %edi,%ebp
+  802dce:	72 af                	jb     802d7f <dm+0x46>
+  802dd0:	29 f0                	sub    %esi,%eax
+  802dd2:	19 fa                	sbb    %edi,%edx
+  802dd4:	89 cf                	mov    %ecx,%edi
+  802dd6:	c1 ef 05             	shr    $0x5,%edi
+  802dd9:	83 e7 01             	and    $0x1,%edi
+  802ddc:	89 fe                	mov    %edi,%esi
+  802dde:	83 f6 01             	xor    $0x1,%esi
+  802de1:	d3 e6                	shl    %cl,%esi
+  802de3:	d3 e7                	shl    %cl,%edi
+  802de5:	09 74 24 18          	or     %esi,0x18(%esp)
+  802de9:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802ded:	eb 90                	jmp    802d7f <dm+0x46>
+  802def:	85 db                	test   %ebx,%ebx
+  802df1:	74 05                	je     802df8 <dm+0xbf>
+  802df3:	89 03                	mov    %eax,(%ebx)
+  802df5:	89 53 04             	mov    %edx,0x4(%ebx)
+  802df8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802dfc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802e00:	83 c4 24             	add    $0x24,%esp
+  802e03:	5b                   	pop    %ebx
+  802e04:	5e                   	pop    %esi
+  802e05:	5f                   	pop    %edi
+  802e06:	5d                   	pop    %ebp
+  802e07:	c3                   	ret
+
+00802e08 <__udivdi3>:
+  802e08:	83 ec 08             	sub    $0x8,%esp
+  802e0b:	6a 00                	push   $0x0
+  802e0d:	ff 74 24 1c          	push   0x1c(%esp)
+  802e11:	ff 74 24 1c          	push   0x1c(%esp)
+  802e15:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802e19:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802e1d:	e8 17 ff ff ff       	call   802d39 <dm>
+  802e22:	83 c4 14             	add    $0x14,%esp
+  802e25:	c3                   	ret
+
+00802e26 <__umoddi3>:
+  802e26:	83 ec 18             	sub    $0x18,%esp
+  802e29:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802e2d:	50                   	push   %eax
+  802e2e:	ff 74 24 2c          	push   0x2c(%esp)
+  802e32:	ff 74 24 2c          	push   0x2c(%esp)
+  802e36:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e3a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e3e:	e8 f6 fe ff ff       	call   802d39 <dm>
+  802e43:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802e47:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802e4b:	83 c4 24             	add    $0x24,%esp
+  802e4e:	c3                   	ret
+
+00802e4f <__divdi3>:
+  802e4f:	53                   	push   %ebx
+  802e50:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802e54:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802e58:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  802e5c:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  802e60:	85 d2                	test   %edx,%edx
+  802e62:	78 15                	js     802e79 <__divdi3+0x2a>
+  802e64:	85 db                	test   %ebx,%ebx
+  802e66:	78 34                	js     802e9c <__divdi3+0x4d>
+  802e68:	83 ec 04             	sub    $0x4,%esp
+  802e6b:	6a 00                	push   $0x0
+  802e6d:	53                   	push   %ebx
+  802e6e:	51                   	push   %ecx
+  802e6f:	e8 c5 fe ff ff       	call   802d39 <dm>
+  802e74:	83 c4 10             	add    $0x10,%esp
+  802e77:	eb 21                	jmp    802e9a <__divdi3+0x4b>
+  802e79:	f7 d8                	neg    %eax
+  802e7b:	83 d2 00             	adc    $0x0,%edx
+  802e7e:	f7 da                	neg    %edx
+  802e80:	85 db                	test   %ebx,%ebx
+  802e82:	78 30                	js     802eb4 <__divdi3+0x65>
+  802e84:	83 ec 04             	sub    $0x4,%esp
+  802e87:	6a 00                	push   $0x0
+  802e89:	53                   	push   %ebx
+  802e8a:	51                   	push   %ecx
+  802e8b:	e8 a9 fe ff ff       	call   802d39 <dm>
+  802e90:	83 c4 10             	add    $0x10,%esp
+  802e93:	f7 d8                	neg    %eax
+  802e95:	83 d2 00             	adc    $0x0,%edx
+  802e98:	f7 da                	neg    %edx
+  802e9a:	5b                   	pop    %ebx
+  802e9b:	c3                   	ret
+  802e9c:	83 ec 04             	sub    $0x4,%esp
+  802e9f:	6a 00                	push   $0x0
+  802ea1:	f7 d9                	neg    %ecx
+  802ea3:	83 d3 00             	adc    $0x0,%ebx
+  802ea6:	f7 db                	neg    %ebx
+  802ea8:	53                   	push   %ebx
+  802ea9:	51                   	push   %ecx
+  802eaa:	e8 8a fe ff ff       	call   802d39 <dm>
+  802eaf:	83 c4 10             	add    $0x10,%esp
+  802eb2:	eb df                	jmp    802e93 <__divdi3+0x44>
+  802eb4:	83 ec 04             	sub    $0x4,%esp
+  802eb7:	6a 00                	push   $0x0
+  802eb9:	f7 d9                	neg    %ecx
+  802ebb:	83 d3 00             	adc    $0x0,%ebx
+  802ebe:	f7 db                	neg    %ebx
+  802ec0:	53                   	push   %ebx
+  802ec1:	51                   	push   %ecx
+  802ec2:	e8 72 fe ff ff       	call   802d39 <dm>
+  802ec7:	83 c4 10             	add    $0x10,%esp
+  802eca:	eb ce                	jmp    802e9a <__divdi3+0x4b>
+
+00802ecc <__moddi3>:
+  802ecc:	55                   	push   %ebp
+  802ecd:	57                   	push   %edi
+  802ece:	56                   	push   %esi
+  802ecf:	53                   	push   %ebx
+  802ed0:	83 ec 18             	sub    $0x18,%esp
+  802ed3:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802ed7:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802edb:	89 f1                	mov    %esi,%ecx
+  802edd:	f7 d9                	neg    %ecx
+  802edf:	89 da                	mov    %ebx,%edx
+  802ee1:	83 d2 00             	adc    $0x0,%edx
+  802ee4:	f7 da                	neg    %edx
+  802ee6:	0f 48 ce             	cmovs  %esi,%ecx
+  802ee9:	0f 48 d3             	cmovs  %ebx,%edx
+  802eec:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802ef0:	50                   	push   %eax
+  802ef1:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802ef5:	f7 de                	neg    %esi
+  802ef7:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802efb:	83 d0 00             	adc    $0x0,%eax
+  802efe:	f7 d8                	neg    %eax
+  802f00:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802f05:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802f0a:	50                   	push   %eax
+  802f0b:	56                   	push   %esi
+  802f0c:	89 c8                	mov    %ecx,%eax
+  802f0e:	e8 26 fe ff ff       	call   802d39 <dm>
+  802f13:	83 c4 10             	add    $0x10,%esp
+  802f16:	85 db                	test   %ebx,%ebx
+  802f18:	78 10                	js     802f2a <__moddi3+0x5e>
+  802f1a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802f1e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802f22:	83 c4 14             	add    $0x14,%esp
+  802f25:	5b                   	pop    %ebx
+  802f26:	5e                   	pop    %esi
+  802f27:	5f                   	pop    %edi
+  802f28:	5d                   	pop    %ebp
+  802f29:	c3                   	ret
+  802f2a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802f2e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802f32:	f7 d8                	neg    %eax
+  802f34:	83 d2 00             	adc    $0x0,%edx
+  802f37:	f7 da                	neg    %edx
+  802f39:	eb e7                	jmp    802f22 <__moddi3+0x56>
@@ -0,0 +1,6149 @@
+
+obj/user/primes:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 c3 00 00 00       	call   8000f4 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <primeproc>:
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(void)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+	int i, id, p;
+	envid_t envid;
+
+	// fetch a prime from our left neighbor
+top:
+	p = ipc_recv(&envid, 0, 0);
+  80003c:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  80003f:	83 ec 04             	sub    $0x4,%esp
+  800042:	6a 00                	push   $0x0
+  800044:	6a 00                	push   $0x0
+  800046:	56                   	push   %esi
+  800047:	e8 bb 29 00 00       	call   802a07 <ipc_recv>
+  80004c:	89 c3                	mov    %eax,%ebx
+	cprintf("CPU %d: %d ", thisenv->env_cpunum, p);
+  80004e:	a1 08 40 80 00       	mov    0x804008,%eax
+  800053:	8b 40 5c             	mov    0x5c(%eax),%eax
+  800056:	83 c4 0c             	add    $0xc,%esp
+  800059:	53                   	push   %ebx
+  80005a:	50                   	push   %eax
+  80005b:	68 40 2f 80 00       	push   $0x802f40
+  800060:	e8 fe 01 00 00       	call   800263 <cprintf>
+
+	// fork a right neighbor to continue the chain
+	if ((id = fork()) < 0)
+  800065:	e8 4e 29 00 00       	call   8029b8 <fork>
+  80006a:	89 c7                	mov    %eax,%edi
+  80006c:	83 c4 10             	add    $0x10,%esp
+  80006f:	85 c0                	test   %eax,%eax
+  800071:	78 2e                	js     8000a1 <primeproc+0x6e>
+		panic("fork: %e", id);
+	if (id == 0)
+  800073:	74 ca                	je     80003f <primeproc+0xc>
+		goto top;
+
+	// filter out multiples of our prime
+	while (1) {
+		i = ipc_recv(&envid, 0, 0);
+  800075:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  800078:	83 ec 04             	sub    $0x4,%esp
+  80007b:	6a 00                	push   $0x0
+  80007d:	6a 00                	push   $0x0
+  80007f:	56                   	push   %esi
+  800080:	e8 82 29 00 00       	call   802a07 <ipc_recv>
+  800085:	89 c1                	mov    %eax,%ecx
+		if (i % p)
+  800087:	99                   	cltd
+  800088:	f7 fb                	idiv   %ebx
+  80008a:	83 c4 10             	add    $0x10,%esp
+  80008d:	85 d2                	test   %edx,%edx
+  80008f:	74 e7                	je     800078 <primeproc+0x45>
+			ipc_send(id, i, 0, 0);
+  800091:	6a 00                	push   $0x0
+  800093:	6a 00                	push   $0x0
+  800095:	51                   	push   %ecx
+  800096:	57                   	push   %edi
+  800097:	e8 dd 29 00 00       	call   802a79 <ipc_send>
+  80009c:	83 c4 10             	add    $0x10,%esp
+  80009f:	eb d7                	jmp    800078 <primeproc+0x45>
+		panic("fork: %e", id);
+  8000a1:	50                   	push   %eax
+  8000a2:	68 4c 2f 80 00       	push   $0x802f4c
+  8000a7:	6a 1a                	push   $0x1a
+  8000a9:	68 55 2f 80 00       	push   $0x802f55
+  8000ae:	e8 9c 00 00 00       	call   80014f <_panic>
+
+008000b3 <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  8000b3:	55                   	push   %ebp
+  8000b4:	89 e5                	mov    %esp,%ebp
+  8000b6:	56                   	push   %esi
+  8000b7:	53                   	push   %ebx
+	int i, id;
+
+	// fork the first prime process in the chain
+	if ((id = fork()) < 0)
+  8000b8:	e8 fb 28 00 00       	call   8029b8 <fork>
+  8000bd:	89 c6                	mov    %eax,%esi
+  8000bf:	85 c0                	test   %eax,%eax
+  8000c1:	78 1a                	js     8000dd <umain+0x2a>
+		panic("fork: %e", id);
+	if (id == 0)
+		primeproc();
+
+	// feed all the integers through
+	for (i = 2; ; i++)
+  8000c3:	bb 02 00 00 00       	mov    $0x2,%ebx
+	if (id == 0)
+  8000c8:	74 25                	je     8000ef <umain+0x3c>
+		ipc_send(id, i, 0, 0);
+  8000ca:	6a 00                	push   $0x0
+  8000cc:	6a 00                	push   $0x0
+  8000ce:	53                   	push   %ebx
+  8000cf:	56                   	push   %esi
+  8000d0:	e8 a4 29 00 00       	call   802a79 <ipc_send>
+	for (i = 2; ; i++)
+  8000d5:	83 c3 01             	add    $0x1,%ebx
+  8000d8:	83 c4 10             	add    $0x10,%esp
+  8000db:	eb ed                	jmp    8000ca <umain+0x17>
+		panic("fork: %e", id);
+  8000dd:	50                   	push   %eax
+  8000de:	68 4c 2f 80 00       	push   $0x802f4c
+  8000e3:	6a 2d                	push   $0x2d
+  8000e5:	68 55 2f 80 00       	push   $0x802f55
+  8000ea:	e8 60 00 00 00       	call   80014f <_panic>
+		primeproc();
+  8000ef:	e8 3f ff ff ff       	call   800033 <primeproc>
+
+008000f4 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000f4:	55                   	push   %ebp
+  8000f5:	89 e5                	mov    %esp,%ebp
+  8000f7:	56                   	push   %esi
+  8000f8:	53                   	push   %ebx
+  8000f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000fc:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  8000ff:	e8 e3 0e 00 00       	call   800fe7 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  800104:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800109:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  80010f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800114:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800119:	85 db                	test   %ebx,%ebx
+  80011b:	7e 07                	jle    800124 <libmain+0x30>
+		binaryname = argv[0];
+  80011d:	8b 06                	mov    (%esi),%eax
+  80011f:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800124:	83 ec 08             	sub    $0x8,%esp
+  800127:	56                   	push   %esi
+  800128:	53                   	push   %ebx
+  800129:	e8 85 ff ff ff       	call   8000b3 <umain>
+
+	// exit gracefully
+	exit();
+  80012e:	e8 0a 00 00 00       	call   80013d <exit>
+}
+  800133:	83 c4 10             	add    $0x10,%esp
+  800136:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800139:	5b                   	pop    %ebx
+  80013a:	5e                   	pop    %esi
+  80013b:	5d                   	pop    %ebp
+  80013c:	c3                   	ret
+
+0080013d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80013d:	55                   	push   %ebp
+  80013e:	89 e5                	mov    %esp,%ebp
+  800140:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  800143:	6a 00                	push   $0x0
+  800145:	e8 db 0d 00 00       	call   800f25 <sys_env_destroy>
+}
+  80014a:	83 c4 10             	add    $0x10,%esp
+  80014d:	c9                   	leave
+  80014e:	c3                   	ret
+
+0080014f <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80014f:	55                   	push   %ebp
+  800150:	89 e5                	mov    %esp,%ebp
+  800152:	57                   	push   %edi
+  800153:	56                   	push   %esi
+  800154:	53                   	push   %ebx
+  800155:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  80015b:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  80015e:	8b 1d 00 40 80 00    	mov    0x804000,%ebx
+  800164:	e8 7e 0e 00 00       	call   800fe7 <sys_getenvid>
+  800169:	83 ec 04             	sub    $0x4,%esp
+  80016c:	ff 75 0c             	push   0xc(%ebp)
+  80016f:	ff 75 08             	push   0x8(%ebp)
+  800172:	53                   	push   %ebx
+  800173:	50                   	push   %eax
+  800174:	68 70 2f 80 00       	push   $0x802f70
+  800179:	68 00 01 00 00       	push   $0x100
+  80017e:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  800184:	56                   	push   %esi
+  800185:	e8 72 06 00 00       	call   8007fc <snprintf>
+  80018a:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  80018c:	83 c4 20             	add    $0x20,%esp
+  80018f:	57                   	push   %edi
+  800190:	ff 75 10             	push   0x10(%ebp)
+  800193:	bf 00 01 00 00       	mov    $0x100,%edi
+  800198:	89 f8                	mov    %edi,%eax
+  80019a:	29 d8                	sub    %ebx,%eax
+  80019c:	50                   	push   %eax
+  80019d:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8001a0:	50                   	push   %eax
+  8001a1:	e8 08 06 00 00       	call   8007ae <vsnprintf>
+  8001a6:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  8001a8:	83 c4 0c             	add    $0xc,%esp
+  8001ab:	68 93 2f 80 00       	push   $0x802f93
+  8001b0:	29 df                	sub    %ebx,%edi
+  8001b2:	57                   	push   %edi
+  8001b3:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8001b6:	50                   	push   %eax
+  8001b7:	e8 40 06 00 00       	call   8007fc <snprintf>
+	sys_cputs(buf, r);
+  8001bc:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  8001bf:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  8001c1:	53                   	push   %ebx
+  8001c2:	56                   	push   %esi
+  8001c3:	e8 21 0c 00 00       	call   800de9 <sys_cputs>
+  8001c8:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001cb:	cc                   	int3
+	while (1)
+  8001cc:	eb fd                	jmp    8001cb <_panic+0x7c>
+
+008001ce <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001ce:	55                   	push   %ebp
+  8001cf:	89 e5                	mov    %esp,%ebp
+  8001d1:	53                   	push   %ebx
+  8001d2:	83 ec 04             	sub    $0x4,%esp
+  8001d5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001d8:	8b 13                	mov    (%ebx),%edx
+  8001da:	8d 42 01             	lea    0x1(%edx),%eax
+  8001dd:	89 03                	mov    %eax,(%ebx)
+  8001df:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001e2:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001e6:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001eb:	74 09                	je     8001f6 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001ed:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001f4:	c9                   	leave
+  8001f5:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001f6:	83 ec 08             	sub    $0x8,%esp
+  8001f9:	68 ff 00 00 00       	push   $0xff
+  8001fe:	8d 43 08             	lea    0x8(%ebx),%eax
+  800201:	50                   	push   %eax
+  800202:	e8 e2 0b 00 00       	call   800de9 <sys_cputs>
+		b->idx = 0;
+  800207:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80020d:	83 c4 10             	add    $0x10,%esp
+  800210:	eb db                	jmp    8001ed <putch+0x1f>
+
+00800212 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800212:	55                   	push   %ebp
+  800213:	89 e5                	mov    %esp,%ebp
+  800215:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80021b:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800222:	00 00 00 
+	b.cnt = 0;
+  800225:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80022c:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80022f:	ff 75 0c             	push   0xc(%ebp)
+  800232:	ff 75 08             	push   0x8(%ebp)
+  800235:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80023b:	50                   	push   %eax
+  80023c:	68 ce 01 80 00       	push   $0x8001ce
+  800241:	e8 14 01 00 00       	call   80035a <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800246:	83 c4 08             	add    $0x8,%esp
+  800249:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80024f:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800255:	50                   	push   %eax
+  800256:	e8 8e 0b 00 00       	call   800de9 <sys_cputs>
+
+	return b.cnt;
+}
+  80025b:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800261:	c9                   	leave
+  800262:	c3                   	ret
+
+00800263 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800263:	55                   	push   %ebp
+  800264:	89 e5                	mov    %esp,%ebp
+  800266:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800269:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80026c:	50                   	push   %eax
+  80026d:	ff 75 08             	push   0x8(%ebp)
+  800270:	e8 9d ff ff ff       	call   800212 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800275:	c9                   	leave
+  800276:	c3                   	ret
+
+00800277 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800277:	55                   	push   %ebp
+  800278:	89 e5                	mov    %esp,%ebp
+  80027a:	57                   	push   %edi
+  80027b:	56                   	push   %esi
+  80027c:	53                   	push   %ebx
+  80027d:	83 ec 1c             	sub    $0x1c,%esp
+  800280:	89 c7                	mov    %eax,%edi
+  800282:	89 d6                	mov    %edx,%esi
+  800284:	8b 45 08             	mov    0x8(%ebp),%eax
+  800287:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80028a:	89 d1                	mov    %edx,%ecx
+  80028c:	89 c2                	mov    %eax,%edx
+  80028e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800291:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800294:	8b 45 10             	mov    0x10(%ebp),%eax
+  800297:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80029a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80029d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002a4:	39 c2                	cmp    %eax,%edx
+  8002a6:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002a9:	72 3e                	jb     8002e9 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002ab:	83 ec 0c             	sub    $0xc,%esp
+  8002ae:	ff 75 18             	push   0x18(%ebp)
+  8002b1:	83 eb 01             	sub    $0x1,%ebx
+  8002b4:	53                   	push   %ebx
+  8002b5:	50                   	push   %eax
+  8002b6:	83 ec 08             	sub    $0x8,%esp
+  8002b9:	ff 75 e4             	push   -0x1c(%ebp)
+  8002bc:	ff 75 e0             	push   -0x20(%ebp)
+  8002bf:	ff 75 dc             	push   -0x24(%ebp)
+  8002c2:	ff 75 d8             	push   -0x28(%ebp)
+  8002c5:	e8 2f 2b 00 00       	call   802df9 <__udivdi3>
+  8002ca:	83 c4 18             	add    $0x18,%esp
+  8002cd:	52                   	push   %edx
+  8002ce:	50                   	push   %eax
+  8002cf:	89 f2                	mov    %esi,%edx
+  8002d1:	89 f8                	mov    %edi,%eax
+  8002d3:	e8 9f ff ff ff       	call   800277 <printnum>
+  8002d8:	83 c4 20             	add    $0x20,%esp
+  8002db:	eb 13                	jmp    8002f0 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002dd:	83 ec 08             	sub    $0x8,%esp
+  8002e0:	56                   	push   %esi
+  8002e1:	ff 75 18             	push   0x18(%ebp)
+  8002e4:	ff d7                	call   *%edi
+  8002e6:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002e9:	83 eb 01             	sub    $0x1,%ebx
+  8002ec:	85 db                	test   %ebx,%ebx
+  8002ee:	7f ed                	jg     8002dd <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002f0:	83 ec 08             	sub    $0x8,%esp
+  8002f3:	56                   	push   %esi
+  8002f4:	83 ec 04             	sub    $0x4,%esp
+  8002f7:	ff 75 e4             	push   -0x1c(%ebp)
+  8002fa:	ff 75 e0             	push   -0x20(%ebp)
+  8002fd:	ff 75 dc             	push   -0x24(%ebp)
+  800300:	ff 75 d8             	push   -0x28(%ebp)
+  800303:	e8 0f 2b 00 00       	call   802e17 <__umoddi3>
+  800308:	83 c4 14             	add    $0x14,%esp
+  80030b:	0f be 80 95 2f 80 00 	movsbl 0x802f95(%eax),%eax
+  800312:	50                   	push   %eax
+  800313:	ff d7                	call   *%edi
+}
+  800315:	83 c4 10             	add    $0x10,%esp
+  800318:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80031b:	5b                   	pop    %ebx
+  80031c:	5e                   	pop    %esi
+  80031d:	5f                   	pop    %edi
+  80031e:	5d                   	pop    %ebp
+  80031f:	c3                   	ret
+
+00800320 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800320:	55                   	push   %ebp
+  800321:	89 e5                	mov    %esp,%ebp
+  800323:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800326:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80032a:	8b 10                	mov    (%eax),%edx
+  80032c:	3b 50 04             	cmp    0x4(%eax),%edx
+  80032f:	73 0a                	jae    80033b <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800331:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800334:	89 08                	mov    %ecx,(%eax)
+  800336:	8b 45 08             	mov    0x8(%ebp),%eax
+  800339:	88 02                	mov    %al,(%edx)
+}
+  80033b:	5d                   	pop    %ebp
+  80033c:	c3                   	ret
+
+0080033d <printfmt>:
+{
+  80033d:	55                   	push   %ebp
+  80033e:	89 e5                	mov    %esp,%ebp
+  800340:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800343:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800346:	50                   	push   %eax
+  800347:	ff 75 10             	push   0x10(%ebp)
+  80034a:	ff 75 0c             	push   0xc(%ebp)
+  80034d:	ff 75 08             	push   0x8(%ebp)
+  800350:	e8 05 00 00 00       	call   80035a <vprintfmt>
+}
+  800355:	83 c4 10             	add    $0x10,%esp
+  800358:	c9                   	leave
+  800359:	c3                   	ret
+
+0080035a <vprintfmt>:
+{
+  80035a:	55                   	push   %ebp
+  80035b:	89 e5                	mov    %esp,%ebp
+  80035d:	57                   	push   %edi
+  80035e:	56                   	push   %esi
+  80035f:	53                   	push   %ebx
+  800360:	83 ec 2c             	sub    $0x2c,%esp
+  800363:	8b 75 08             	mov    0x8(%ebp),%esi
+  800366:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800369:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80036c:	eb 0a                	jmp    800378 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80036e:	83 ec 08             	sub    $0x8,%esp
+  800371:	53                   	push   %ebx
+  800372:	50                   	push   %eax
+  800373:	ff d6                	call   *%esi
+  800375:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800378:	83 c7 01             	add    $0x1,%edi
+  80037b:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80037f:	83 f8 25             	cmp    $0x25,%eax
+  800382:	74 0c                	je     800390 <vprintfmt+0x36>
+			if (ch == '\0')
+  800384:	85 c0                	test   %eax,%eax
+  800386:	75 e6                	jne    80036e <vprintfmt+0x14>
+}
+  800388:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80038b:	5b                   	pop    %ebx
+  80038c:	5e                   	pop    %esi
+  80038d:	5f                   	pop    %edi
+  80038e:	5d                   	pop    %ebp
+  80038f:	c3                   	ret
+		padc = ' ';
+  800390:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800394:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80039b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8003a2:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ae:	8d 47 01             	lea    0x1(%edi),%eax
+  8003b1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003b4:	0f b6 17             	movzbl (%edi),%edx
+  8003b7:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003ba:	3c 55                	cmp    $0x55,%al
+  8003bc:	0f 87 cf 03 00 00    	ja     800791 <vprintfmt+0x437>
+  8003c2:	0f b6 c0             	movzbl %al,%eax
+  8003c5:	ff 24 85 80 30 80 00 	jmp    *0x803080(,%eax,4)
+  8003cc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8003cf:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8003d3:	eb d9                	jmp    8003ae <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003d5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003d8:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003dc:	eb d0                	jmp    8003ae <vprintfmt+0x54>
+  8003de:	0f b6 d2             	movzbl %dl,%edx
+  8003e1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003ec:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003ef:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003f3:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003f6:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003f9:	83 f9 09             	cmp    $0x9,%ecx
+  8003fc:	77 55                	ja     800453 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8003fe:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800401:	eb e9                	jmp    8003ec <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800403:	8b 45 14             	mov    0x14(%ebp),%eax
+  800406:	8b 00                	mov    (%eax),%eax
+  800408:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80040b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80040e:	8d 40 04             	lea    0x4(%eax),%eax
+  800411:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800414:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800417:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80041b:	79 91                	jns    8003ae <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80041d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800420:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800423:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80042a:	eb 82                	jmp    8003ae <vprintfmt+0x54>
+			if (width < 0)
+  80042c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80042f:	85 d2                	test   %edx,%edx
+  800431:	b8 00 00 00 00       	mov    $0x0,%eax
+  800436:	0f 49 c2             	cmovns %edx,%eax
+  800439:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80043c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80043f:	e9 6a ff ff ff       	jmp    8003ae <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800444:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800447:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80044e:	e9 5b ff ff ff       	jmp    8003ae <vprintfmt+0x54>
+  800453:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800456:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800459:	eb bc                	jmp    800417 <vprintfmt+0xbd>
+			lflag++;
+  80045b:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80045e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800461:	e9 48 ff ff ff       	jmp    8003ae <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800466:	8b 45 14             	mov    0x14(%ebp),%eax
+  800469:	8d 78 04             	lea    0x4(%eax),%edi
+  80046c:	83 ec 08             	sub    $0x8,%esp
+  80046f:	53                   	push   %ebx
+  800470:	ff 30                	push   (%eax)
+  800472:	ff d6                	call   *%esi
+			break;
+  800474:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800477:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80047a:	e9 b1 02 00 00       	jmp    800730 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  80047f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800482:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800485:	8b 10                	mov    (%eax),%edx
+  800487:	89 d0                	mov    %edx,%eax
+  800489:	f7 d8                	neg    %eax
+  80048b:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80048e:	83 f8 0d             	cmp    $0xd,%eax
+  800491:	7f 23                	jg     8004b6 <vprintfmt+0x15c>
+  800493:	8b 14 85 e0 31 80 00 	mov    0x8031e0(,%eax,4),%edx
+  80049a:	85 d2                	test   %edx,%edx
+  80049c:	74 18                	je     8004b6 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80049e:	52                   	push   %edx
+  80049f:	68 b6 2f 80 00       	push   $0x802fb6
+  8004a4:	53                   	push   %ebx
+  8004a5:	56                   	push   %esi
+  8004a6:	e8 92 fe ff ff       	call   80033d <printfmt>
+  8004ab:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004ae:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8004b1:	e9 7a 02 00 00       	jmp    800730 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8004b6:	50                   	push   %eax
+  8004b7:	68 ad 2f 80 00       	push   $0x802fad
+  8004bc:	53                   	push   %ebx
+  8004bd:	56                   	push   %esi
+  8004be:	e8 7a fe ff ff       	call   80033d <printfmt>
+  8004c3:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004c6:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004c9:	e9 62 02 00 00       	jmp    800730 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d1:	83 c0 04             	add    $0x4,%eax
+  8004d4:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004da:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004dc:	85 c9                	test   %ecx,%ecx
+  8004de:	b8 a6 2f 80 00       	mov    $0x802fa6,%eax
+  8004e3:	0f 45 c1             	cmovne %ecx,%eax
+  8004e6:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004e9:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004ed:	7e 06                	jle    8004f5 <vprintfmt+0x19b>
+  8004ef:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004f3:	75 0b                	jne    800500 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004f5:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004f8:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004fb:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004fe:	eb 5c                	jmp    80055c <vprintfmt+0x202>
+  800500:	83 ec 08             	sub    $0x8,%esp
+  800503:	ff 75 d0             	push   -0x30(%ebp)
+  800506:	ff 75 cc             	push   -0x34(%ebp)
+  800509:	e8 20 03 00 00       	call   80082e <strnlen>
+  80050e:	89 c2                	mov    %eax,%edx
+  800510:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800513:	29 d0                	sub    %edx,%eax
+  800515:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800518:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80051c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80051f:	89 75 08             	mov    %esi,0x8(%ebp)
+  800522:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800524:	eb 0e                	jmp    800534 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800526:	83 ec 08             	sub    $0x8,%esp
+  800529:	53                   	push   %ebx
+  80052a:	57                   	push   %edi
+  80052b:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80052e:	83 ee 01             	sub    $0x1,%esi
+  800531:	83 c4 10             	add    $0x10,%esp
+  800534:	85 f6                	test   %esi,%esi
+  800536:	7f ee                	jg     800526 <vprintfmt+0x1cc>
+  800538:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80053b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80053e:	85 c0                	test   %eax,%eax
+  800540:	ba 00 00 00 00       	mov    $0x0,%edx
+  800545:	0f 49 d0             	cmovns %eax,%edx
+  800548:	29 d0                	sub    %edx,%eax
+  80054a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80054d:	eb a6                	jmp    8004f5 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80054f:	83 ec 08             	sub    $0x8,%esp
+  800552:	53                   	push   %ebx
+  800553:	52                   	push   %edx
+  800554:	ff 55 08             	call   *0x8(%ebp)
+  800557:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80055a:	89 f1                	mov    %esi,%ecx
+  80055c:	8d 71 01             	lea    0x1(%ecx),%esi
+  80055f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800563:	0f be d0             	movsbl %al,%edx
+  800566:	85 d2                	test   %edx,%edx
+  800568:	74 28                	je     800592 <vprintfmt+0x238>
+  80056a:	85 ff                	test   %edi,%edi
+  80056c:	78 05                	js     800573 <vprintfmt+0x219>
+  80056e:	83 ef 01             	sub    $0x1,%edi
+  800571:	78 30                	js     8005a3 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800573:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800577:	74 d6                	je     80054f <vprintfmt+0x1f5>
+  800579:	0f be c0             	movsbl %al,%eax
+  80057c:	83 e8 20             	sub    $0x20,%eax
+  80057f:	83 f8 5e             	cmp    $0x5e,%eax
+  800582:	76 cb                	jbe    80054f <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800584:	83 ec 08             	sub    $0x8,%esp
+  800587:	53                   	push   %ebx
+  800588:	6a 3f                	push   $0x3f
+  80058a:	ff 55 08             	call   *0x8(%ebp)
+  80058d:	83 c4 10             	add    $0x10,%esp
+  800590:	eb c8                	jmp    80055a <vprintfmt+0x200>
+  800592:	8b 75 08             	mov    0x8(%ebp),%esi
+  800595:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800598:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80059b:	01 d0                	add    %edx,%eax
+  80059d:	29 c8                	sub    %ecx,%eax
+  80059f:	89 c7                	mov    %eax,%edi
+  8005a1:	eb 13                	jmp    8005b6 <vprintfmt+0x25c>
+  8005a3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005a6:	eb ed                	jmp    800595 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8005a8:	83 ec 08             	sub    $0x8,%esp
+  8005ab:	53                   	push   %ebx
+  8005ac:	6a 20                	push   $0x20
+  8005ae:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8005b0:	83 ef 01             	sub    $0x1,%edi
+  8005b3:	83 c4 10             	add    $0x10,%esp
+  8005b6:	85 ff                	test   %edi,%edi
+  8005b8:	7f ee                	jg     8005a8 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005ba:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8005bd:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005c0:	e9 6b 01 00 00       	jmp    800730 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8005c5:	83 f9 01             	cmp    $0x1,%ecx
+  8005c8:	7f 1f                	jg     8005e9 <vprintfmt+0x28f>
+	else if (lflag)
+  8005ca:	85 c9                	test   %ecx,%ecx
+  8005cc:	74 67                	je     800635 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8005ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d1:	8b 00                	mov    (%eax),%eax
+  8005d3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005d6:	89 c1                	mov    %eax,%ecx
+  8005d8:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005db:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e1:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005e7:	eb 17                	jmp    800600 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8005e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ec:	8b 50 04             	mov    0x4(%eax),%edx
+  8005ef:	8b 00                	mov    (%eax),%eax
+  8005f1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005f4:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fa:	8d 40 08             	lea    0x8(%eax),%eax
+  8005fd:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800600:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800603:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800606:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80060b:	85 c9                	test   %ecx,%ecx
+  80060d:	0f 89 03 01 00 00    	jns    800716 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800613:	83 ec 08             	sub    $0x8,%esp
+  800616:	53                   	push   %ebx
+  800617:	6a 2d                	push   $0x2d
+  800619:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80061b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80061e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800621:	f7 da                	neg    %edx
+  800623:	83 d1 00             	adc    $0x0,%ecx
+  800626:	f7 d9                	neg    %ecx
+  800628:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80062b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800630:	e9 e1 00 00 00       	jmp    800716 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800635:	8b 45 14             	mov    0x14(%ebp),%eax
+  800638:	8b 00                	mov    (%eax),%eax
+  80063a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80063d:	89 c1                	mov    %eax,%ecx
+  80063f:	c1 f9 1f             	sar    $0x1f,%ecx
+  800642:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800645:	8b 45 14             	mov    0x14(%ebp),%eax
+  800648:	8d 40 04             	lea    0x4(%eax),%eax
+  80064b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80064e:	eb b0                	jmp    800600 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800650:	83 f9 01             	cmp    $0x1,%ecx
+  800653:	7f 1e                	jg     800673 <vprintfmt+0x319>
+	else if (lflag)
+  800655:	85 c9                	test   %ecx,%ecx
+  800657:	74 32                	je     80068b <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800659:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065c:	8b 10                	mov    (%eax),%edx
+  80065e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800663:	8d 40 04             	lea    0x4(%eax),%eax
+  800666:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800669:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80066e:	e9 a3 00 00 00       	jmp    800716 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800673:	8b 45 14             	mov    0x14(%ebp),%eax
+  800676:	8b 10                	mov    (%eax),%edx
+  800678:	8b 48 04             	mov    0x4(%eax),%ecx
+  80067b:	8d 40 08             	lea    0x8(%eax),%eax
+  80067e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800681:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800686:	e9 8b 00 00 00       	jmp    800716 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80068b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068e:	8b 10                	mov    (%eax),%edx
+  800690:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800695:	8d 40 04             	lea    0x4(%eax),%eax
+  800698:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80069b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8006a0:	eb 74                	jmp    800716 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8006a2:	83 f9 01             	cmp    $0x1,%ecx
+  8006a5:	7f 1b                	jg     8006c2 <vprintfmt+0x368>
+	else if (lflag)
+  8006a7:	85 c9                	test   %ecx,%ecx
+  8006a9:	74 2c                	je     8006d7 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8006ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ae:	8b 10                	mov    (%eax),%edx
+  8006b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006b5:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006bb:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8006c0:	eb 54                	jmp    800716 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c5:	8b 10                	mov    (%eax),%edx
+  8006c7:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006ca:	8d 40 08             	lea    0x8(%eax),%eax
+  8006cd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006d0:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8006d5:	eb 3f                	jmp    800716 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006da:	8b 10                	mov    (%eax),%edx
+  8006dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006e7:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8006ec:	eb 28                	jmp    800716 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8006ee:	83 ec 08             	sub    $0x8,%esp
+  8006f1:	53                   	push   %ebx
+  8006f2:	6a 30                	push   $0x30
+  8006f4:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006f6:	83 c4 08             	add    $0x8,%esp
+  8006f9:	53                   	push   %ebx
+  8006fa:	6a 78                	push   $0x78
+  8006fc:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800701:	8b 10                	mov    (%eax),%edx
+  800703:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800708:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80070b:	8d 40 04             	lea    0x4(%eax),%eax
+  80070e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800711:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800716:	83 ec 0c             	sub    $0xc,%esp
+  800719:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80071d:	50                   	push   %eax
+  80071e:	ff 75 e0             	push   -0x20(%ebp)
+  800721:	57                   	push   %edi
+  800722:	51                   	push   %ecx
+  800723:	52                   	push   %edx
+  800724:	89 da                	mov    %ebx,%edx
+  800726:	89 f0                	mov    %esi,%eax
+  800728:	e8 4a fb ff ff       	call   800277 <printnum>
+			break;
+  80072d:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800730:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800733:	e9 40 fc ff ff       	jmp    800378 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800738:	83 f9 01             	cmp    $0x1,%ecx
+  80073b:	7f 1b                	jg     800758 <vprintfmt+0x3fe>
+	else if (lflag)
+  80073d:	85 c9                	test   %ecx,%ecx
+  80073f:	74 2c                	je     80076d <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800741:	8b 45 14             	mov    0x14(%ebp),%eax
+  800744:	8b 10                	mov    (%eax),%edx
+  800746:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80074b:	8d 40 04             	lea    0x4(%eax),%eax
+  80074e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800751:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800756:	eb be                	jmp    800716 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800758:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075b:	8b 10                	mov    (%eax),%edx
+  80075d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800760:	8d 40 08             	lea    0x8(%eax),%eax
+  800763:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800766:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80076b:	eb a9                	jmp    800716 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80076d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800770:	8b 10                	mov    (%eax),%edx
+  800772:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800777:	8d 40 04             	lea    0x4(%eax),%eax
+  80077a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80077d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800782:	eb 92                	jmp    800716 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800784:	83 ec 08             	sub    $0x8,%esp
+  800787:	53                   	push   %ebx
+  800788:	6a 25                	push   $0x25
+  80078a:	ff d6                	call   *%esi
+			break;
+  80078c:	83 c4 10             	add    $0x10,%esp
+  80078f:	eb 9f                	jmp    800730 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800791:	83 ec 08             	sub    $0x8,%esp
+  800794:	53                   	push   %ebx
+  800795:	6a 25                	push   $0x25
+  800797:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800799:	83 c4 10             	add    $0x10,%esp
+  80079c:	89 f8                	mov    %edi,%eax
+  80079e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007a2:	74 05                	je     8007a9 <vprintfmt+0x44f>
+  8007a4:	83 e8 01             	sub    $0x1,%eax
+  8007a7:	eb f5                	jmp    80079e <vprintfmt+0x444>
+  8007a9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007ac:	eb 82                	jmp    800730 <vprintfmt+0x3d6>
+
+008007ae <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007ae:	55                   	push   %ebp
+  8007af:	89 e5                	mov    %esp,%ebp
+  8007b1:	83 ec 18             	sub    $0x18,%esp
+  8007b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007b7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007ba:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007bd:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007c1:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007c4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007cb:	85 c0                	test   %eax,%eax
+  8007cd:	74 26                	je     8007f5 <vsnprintf+0x47>
+  8007cf:	85 d2                	test   %edx,%edx
+  8007d1:	7e 22                	jle    8007f5 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007d3:	ff 75 14             	push   0x14(%ebp)
+  8007d6:	ff 75 10             	push   0x10(%ebp)
+  8007d9:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007dc:	50                   	push   %eax
+  8007dd:	68 20 03 80 00       	push   $0x800320
+  8007e2:	e8 73 fb ff ff       	call   80035a <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007e7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007ea:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007f0:	83 c4 10             	add    $0x10,%esp
+}
+  8007f3:	c9                   	leave
+  8007f4:	c3                   	ret
+		return -E_INVAL;
+  8007f5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007fa:	eb f7                	jmp    8007f3 <vsnprintf+0x45>
+
+008007fc <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007fc:	55                   	push   %ebp
+  8007fd:	89 e5                	mov    %esp,%ebp
+  8007ff:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800802:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800805:	50                   	push   %eax
+  800806:	ff 75 10             	push   0x10(%ebp)
+  800809:	ff 75 0c             	push   0xc(%ebp)
+  80080c:	ff 75 08             	push   0x8(%ebp)
+  80080f:	e8 9a ff ff ff       	call   8007ae <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800814:	c9                   	leave
+  800815:	c3                   	ret
+
+00800816 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800816:	55                   	push   %ebp
+  800817:	89 e5                	mov    %esp,%ebp
+  800819:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80081c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800821:	eb 03                	jmp    800826 <strlen+0x10>
+		n++;
+  800823:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800826:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80082a:	75 f7                	jne    800823 <strlen+0xd>
+	return n;
+}
+  80082c:	5d                   	pop    %ebp
+  80082d:	c3                   	ret
+
+0080082e <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80082e:	55                   	push   %ebp
+  80082f:	89 e5                	mov    %esp,%ebp
+  800831:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800834:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800837:	b8 00 00 00 00       	mov    $0x0,%eax
+  80083c:	eb 03                	jmp    800841 <strnlen+0x13>
+		n++;
+  80083e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800841:	39 d0                	cmp    %edx,%eax
+  800843:	74 08                	je     80084d <strnlen+0x1f>
+  800845:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800849:	75 f3                	jne    80083e <strnlen+0x10>
+  80084b:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80084d:	89 d0                	mov    %edx,%eax
+  80084f:	5d                   	pop    %ebp
+  800850:	c3                   	ret
+
+00800851 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800851:	55                   	push   %ebp
+  800852:	89 e5                	mov    %esp,%ebp
+  800854:	53                   	push   %ebx
+  800855:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800858:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80085b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800860:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800864:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800867:	83 c0 01             	add    $0x1,%eax
+  80086a:	84 d2                	test   %dl,%dl
+  80086c:	75 f2                	jne    800860 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80086e:	89 c8                	mov    %ecx,%eax
+  800870:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800873:	c9                   	leave
+  800874:	c3                   	ret
+
+00800875 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800875:	55                   	push   %ebp
+  800876:	89 e5                	mov    %esp,%ebp
+  800878:	53                   	push   %ebx
+  800879:	83 ec 10             	sub    $0x10,%esp
+  80087c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80087f:	53                   	push   %ebx
+  800880:	e8 91 ff ff ff       	call   800816 <strlen>
+  800885:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800888:	ff 75 0c             	push   0xc(%ebp)
+  80088b:	01 d8                	add    %ebx,%eax
+  80088d:	50                   	push   %eax
+  80088e:	e8 be ff ff ff       	call   800851 <strcpy>
+	return dst;
+}
+  800893:	89 d8                	mov    %ebx,%eax
+  800895:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800898:	c9                   	leave
+  800899:	c3                   	ret
+
+0080089a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80089a:	55                   	push   %ebp
+  80089b:	89 e5                	mov    %esp,%ebp
+  80089d:	56                   	push   %esi
+  80089e:	53                   	push   %ebx
+  80089f:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008a2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008a5:	89 f3                	mov    %esi,%ebx
+  8008a7:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008aa:	89 f0                	mov    %esi,%eax
+  8008ac:	eb 0f                	jmp    8008bd <strncpy+0x23>
+		*dst++ = *src;
+  8008ae:	83 c0 01             	add    $0x1,%eax
+  8008b1:	0f b6 0a             	movzbl (%edx),%ecx
+  8008b4:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8008b7:	80 f9 01             	cmp    $0x1,%cl
+  8008ba:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008bd:	39 d8                	cmp    %ebx,%eax
+  8008bf:	75 ed                	jne    8008ae <strncpy+0x14>
+	}
+	return ret;
+}
+  8008c1:	89 f0                	mov    %esi,%eax
+  8008c3:	5b                   	pop    %ebx
+  8008c4:	5e                   	pop    %esi
+  8008c5:	5d                   	pop    %ebp
+  8008c6:	c3                   	ret
+
+008008c7 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008c7:	55                   	push   %ebp
+  8008c8:	89 e5                	mov    %esp,%ebp
+  8008ca:	56                   	push   %esi
+  8008cb:	53                   	push   %ebx
+  8008cc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008d2:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008d5:	89 f0                	mov    %esi,%eax
+  8008d7:	85 d2                	test   %edx,%edx
+  8008d9:	74 21                	je     8008fc <strlcpy+0x35>
+  8008db:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008df:	89 f2                	mov    %esi,%edx
+  8008e1:	eb 09                	jmp    8008ec <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008e3:	83 c1 01             	add    $0x1,%ecx
+  8008e6:	83 c2 01             	add    $0x1,%edx
+  8008e9:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008ec:	39 c2                	cmp    %eax,%edx
+  8008ee:	74 09                	je     8008f9 <strlcpy+0x32>
+  8008f0:	0f b6 19             	movzbl (%ecx),%ebx
+  8008f3:	84 db                	test   %bl,%bl
+  8008f5:	75 ec                	jne    8008e3 <strlcpy+0x1c>
+  8008f7:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008f9:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008fc:	29 f0                	sub    %esi,%eax
+}
+  8008fe:	5b                   	pop    %ebx
+  8008ff:	5e                   	pop    %esi
+  800900:	5d                   	pop    %ebp
+  800901:	c3                   	ret
+
+00800902 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800902:	55                   	push   %ebp
+  800903:	89 e5                	mov    %esp,%ebp
+  800905:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800908:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80090b:	eb 06                	jmp    800913 <strcmp+0x11>
+		p++, q++;
+  80090d:	83 c1 01             	add    $0x1,%ecx
+  800910:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800913:	0f b6 01             	movzbl (%ecx),%eax
+  800916:	84 c0                	test   %al,%al
+  800918:	74 04                	je     80091e <strcmp+0x1c>
+  80091a:	3a 02                	cmp    (%edx),%al
+  80091c:	74 ef                	je     80090d <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80091e:	0f b6 c0             	movzbl %al,%eax
+  800921:	0f b6 12             	movzbl (%edx),%edx
+  800924:	29 d0                	sub    %edx,%eax
+}
+  800926:	5d                   	pop    %ebp
+  800927:	c3                   	ret
+
+00800928 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800928:	55                   	push   %ebp
+  800929:	89 e5                	mov    %esp,%ebp
+  80092b:	53                   	push   %ebx
+  80092c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80092f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800932:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800935:	eb 09                	jmp    800940 <strncmp+0x18>
+		n--, p++, q++;
+  800937:	83 ea 01             	sub    $0x1,%edx
+  80093a:	83 c0 01             	add    $0x1,%eax
+  80093d:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800940:	85 d2                	test   %edx,%edx
+  800942:	74 18                	je     80095c <strncmp+0x34>
+  800944:	0f b6 18             	movzbl (%eax),%ebx
+  800947:	84 db                	test   %bl,%bl
+  800949:	74 04                	je     80094f <strncmp+0x27>
+  80094b:	3a 19                	cmp    (%ecx),%bl
+  80094d:	74 e8                	je     800937 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80094f:	0f b6 00             	movzbl (%eax),%eax
+  800952:	0f b6 11             	movzbl (%ecx),%edx
+  800955:	29 d0                	sub    %edx,%eax
+}
+  800957:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80095a:	c9                   	leave
+  80095b:	c3                   	ret
+		return 0;
+  80095c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800961:	eb f4                	jmp    800957 <strncmp+0x2f>
+
+00800963 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800963:	55                   	push   %ebp
+  800964:	89 e5                	mov    %esp,%ebp
+  800966:	8b 45 08             	mov    0x8(%ebp),%eax
+  800969:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80096d:	eb 03                	jmp    800972 <strchr+0xf>
+  80096f:	83 c0 01             	add    $0x1,%eax
+  800972:	0f b6 10             	movzbl (%eax),%edx
+  800975:	84 d2                	test   %dl,%dl
+  800977:	74 06                	je     80097f <strchr+0x1c>
+		if (*s == c)
+  800979:	38 ca                	cmp    %cl,%dl
+  80097b:	75 f2                	jne    80096f <strchr+0xc>
+  80097d:	eb 05                	jmp    800984 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80097f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800984:	5d                   	pop    %ebp
+  800985:	c3                   	ret
+
+00800986 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800986:	55                   	push   %ebp
+  800987:	89 e5                	mov    %esp,%ebp
+  800989:	8b 45 08             	mov    0x8(%ebp),%eax
+  80098c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800990:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800993:	38 ca                	cmp    %cl,%dl
+  800995:	74 09                	je     8009a0 <strfind+0x1a>
+  800997:	84 d2                	test   %dl,%dl
+  800999:	74 05                	je     8009a0 <strfind+0x1a>
+	for (; *s; s++)
+  80099b:	83 c0 01             	add    $0x1,%eax
+  80099e:	eb f0                	jmp    800990 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009a0:	5d                   	pop    %ebp
+  8009a1:	c3                   	ret
+
+008009a2 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009a2:	55                   	push   %ebp
+  8009a3:	89 e5                	mov    %esp,%ebp
+  8009a5:	57                   	push   %edi
+  8009a6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009a9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8009ac:	85 c9                	test   %ecx,%ecx
+  8009ae:	74 20                	je     8009d0 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8009b0:	89 f8                	mov    %edi,%eax
+  8009b2:	09 c8                	or     %ecx,%eax
+  8009b4:	a8 03                	test   $0x3,%al
+  8009b6:	75 12                	jne    8009ca <memset+0x28>
+		c &= 0xFF;
+  8009b8:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009bc:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8009c2:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009c5:	fc                   	cld
+  8009c6:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009c8:	eb 06                	jmp    8009d0 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009cd:	fc                   	cld
+  8009ce:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009d0:	89 f8                	mov    %edi,%eax
+  8009d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009d5:	c9                   	leave
+  8009d6:	c3                   	ret
+
+008009d7 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009d7:	55                   	push   %ebp
+  8009d8:	89 e5                	mov    %esp,%ebp
+  8009da:	57                   	push   %edi
+  8009db:	56                   	push   %esi
+  8009dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009df:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009e2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009e5:	39 c6                	cmp    %eax,%esi
+  8009e7:	73 32                	jae    800a1b <memmove+0x44>
+  8009e9:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009ec:	39 d0                	cmp    %edx,%eax
+  8009ee:	73 2b                	jae    800a1b <memmove+0x44>
+		s += n;
+		d += n;
+  8009f0:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009f3:	89 d6                	mov    %edx,%esi
+  8009f5:	09 fe                	or     %edi,%esi
+  8009f7:	09 ce                	or     %ecx,%esi
+  8009f9:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009ff:	75 0e                	jne    800a0f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a01:	83 ef 04             	sub    $0x4,%edi
+  800a04:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a07:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a0a:	fd                   	std
+  800a0b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a0d:	eb 09                	jmp    800a18 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a0f:	83 ef 01             	sub    $0x1,%edi
+  800a12:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a15:	fd                   	std
+  800a16:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a18:	fc                   	cld
+  800a19:	eb 1a                	jmp    800a35 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a1b:	89 f2                	mov    %esi,%edx
+  800a1d:	09 c2                	or     %eax,%edx
+  800a1f:	09 ca                	or     %ecx,%edx
+  800a21:	f6 c2 03             	test   $0x3,%dl
+  800a24:	75 0a                	jne    800a30 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a26:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a29:	89 c7                	mov    %eax,%edi
+  800a2b:	fc                   	cld
+  800a2c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a2e:	eb 05                	jmp    800a35 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a30:	89 c7                	mov    %eax,%edi
+  800a32:	fc                   	cld
+  800a33:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a35:	5e                   	pop    %esi
+  800a36:	5f                   	pop    %edi
+  800a37:	5d                   	pop    %ebp
+  800a38:	c3                   	ret
+
+00800a39 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a39:	55                   	push   %ebp
+  800a3a:	89 e5                	mov    %esp,%ebp
+  800a3c:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a3f:	ff 75 10             	push   0x10(%ebp)
+  800a42:	ff 75 0c             	push   0xc(%ebp)
+  800a45:	ff 75 08             	push   0x8(%ebp)
+  800a48:	e8 8a ff ff ff       	call   8009d7 <memmove>
+}
+  800a4d:	c9                   	leave
+  800a4e:	c3                   	ret
+
+00800a4f <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a4f:	55                   	push   %ebp
+  800a50:	89 e5                	mov    %esp,%ebp
+  800a52:	56                   	push   %esi
+  800a53:	53                   	push   %ebx
+  800a54:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a57:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a5a:	89 c6                	mov    %eax,%esi
+  800a5c:	03 75 10             	add    0x10(%ebp),%esi
+  800a5f:	eb 06                	jmp    800a67 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a61:	83 c0 01             	add    $0x1,%eax
+  800a64:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a67:	39 f0                	cmp    %esi,%eax
+  800a69:	74 14                	je     800a7f <memcmp+0x30>
+		if (*s1 != *s2)
+  800a6b:	0f b6 08             	movzbl (%eax),%ecx
+  800a6e:	0f b6 1a             	movzbl (%edx),%ebx
+  800a71:	38 d9                	cmp    %bl,%cl
+  800a73:	74 ec                	je     800a61 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a75:	0f b6 c1             	movzbl %cl,%eax
+  800a78:	0f b6 db             	movzbl %bl,%ebx
+  800a7b:	29 d8                	sub    %ebx,%eax
+  800a7d:	eb 05                	jmp    800a84 <memcmp+0x35>
+	}
+
+	return 0;
+  800a7f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a84:	5b                   	pop    %ebx
+  800a85:	5e                   	pop    %esi
+  800a86:	5d                   	pop    %ebp
+  800a87:	c3                   	ret
+
+00800a88 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a88:	55                   	push   %ebp
+  800a89:	89 e5                	mov    %esp,%ebp
+  800a8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a8e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a91:	89 c2                	mov    %eax,%edx
+  800a93:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a96:	eb 03                	jmp    800a9b <memfind+0x13>
+  800a98:	83 c0 01             	add    $0x1,%eax
+  800a9b:	39 d0                	cmp    %edx,%eax
+  800a9d:	73 04                	jae    800aa3 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a9f:	38 08                	cmp    %cl,(%eax)
+  800aa1:	75 f5                	jne    800a98 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800aa3:	5d                   	pop    %ebp
+  800aa4:	c3                   	ret
+
+00800aa5 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800aa5:	55                   	push   %ebp
+  800aa6:	89 e5                	mov    %esp,%ebp
+  800aa8:	57                   	push   %edi
+  800aa9:	56                   	push   %esi
+  800aaa:	53                   	push   %ebx
+  800aab:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800ab1:	eb 03                	jmp    800ab6 <strtol+0x11>
+		s++;
+  800ab3:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800ab6:	0f b6 02             	movzbl (%edx),%eax
+  800ab9:	3c 20                	cmp    $0x20,%al
+  800abb:	74 f6                	je     800ab3 <strtol+0xe>
+  800abd:	3c 09                	cmp    $0x9,%al
+  800abf:	74 f2                	je     800ab3 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800ac1:	3c 2b                	cmp    $0x2b,%al
+  800ac3:	74 2a                	je     800aef <strtol+0x4a>
+	int neg = 0;
+  800ac5:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800aca:	3c 2d                	cmp    $0x2d,%al
+  800acc:	74 2b                	je     800af9 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ace:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800ad4:	75 0f                	jne    800ae5 <strtol+0x40>
+  800ad6:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ad9:	74 28                	je     800b03 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800adb:	85 db                	test   %ebx,%ebx
+  800add:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ae2:	0f 44 d8             	cmove  %eax,%ebx
+  800ae5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aea:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800aed:	eb 46                	jmp    800b35 <strtol+0x90>
+		s++;
+  800aef:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800af2:	bf 00 00 00 00       	mov    $0x0,%edi
+  800af7:	eb d5                	jmp    800ace <strtol+0x29>
+		s++, neg = 1;
+  800af9:	83 c2 01             	add    $0x1,%edx
+  800afc:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b01:	eb cb                	jmp    800ace <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b03:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b07:	74 0e                	je     800b17 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b09:	85 db                	test   %ebx,%ebx
+  800b0b:	75 d8                	jne    800ae5 <strtol+0x40>
+		s++, base = 8;
+  800b0d:	83 c2 01             	add    $0x1,%edx
+  800b10:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b15:	eb ce                	jmp    800ae5 <strtol+0x40>
+		s += 2, base = 16;
+  800b17:	83 c2 02             	add    $0x2,%edx
+  800b1a:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b1f:	eb c4                	jmp    800ae5 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b21:	0f be c0             	movsbl %al,%eax
+  800b24:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b27:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b2a:	7d 3a                	jge    800b66 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b2c:	83 c2 01             	add    $0x1,%edx
+  800b2f:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b33:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b35:	0f b6 02             	movzbl (%edx),%eax
+  800b38:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b3b:	89 f3                	mov    %esi,%ebx
+  800b3d:	80 fb 09             	cmp    $0x9,%bl
+  800b40:	76 df                	jbe    800b21 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b42:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b45:	89 f3                	mov    %esi,%ebx
+  800b47:	80 fb 19             	cmp    $0x19,%bl
+  800b4a:	77 08                	ja     800b54 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b4c:	0f be c0             	movsbl %al,%eax
+  800b4f:	83 e8 57             	sub    $0x57,%eax
+  800b52:	eb d3                	jmp    800b27 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b54:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b57:	89 f3                	mov    %esi,%ebx
+  800b59:	80 fb 19             	cmp    $0x19,%bl
+  800b5c:	77 08                	ja     800b66 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b5e:	0f be c0             	movsbl %al,%eax
+  800b61:	83 e8 37             	sub    $0x37,%eax
+  800b64:	eb c1                	jmp    800b27 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b66:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b6a:	74 05                	je     800b71 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b6c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b6f:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b71:	89 c8                	mov    %ecx,%eax
+  800b73:	f7 d8                	neg    %eax
+  800b75:	85 ff                	test   %edi,%edi
+  800b77:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b7a:	89 c8                	mov    %ecx,%eax
+  800b7c:	5b                   	pop    %ebx
+  800b7d:	5e                   	pop    %esi
+  800b7e:	5f                   	pop    %edi
+  800b7f:	5d                   	pop    %ebp
+  800b80:	c3                   	ret
+
+00800b81 <atoi>:
+
+int
+atoi(const char *s)
+{
+  800b81:	55                   	push   %ebp
+  800b82:	89 e5                	mov    %esp,%ebp
+  800b84:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800b87:	6a 0a                	push   $0xa
+  800b89:	6a 00                	push   $0x0
+  800b8b:	ff 75 08             	push   0x8(%ebp)
+  800b8e:	e8 12 ff ff ff       	call   800aa5 <strtol>
+}
+  800b93:	c9                   	leave
+  800b94:	c3                   	ret
+
+00800b95 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800b95:	55                   	push   %ebp
+  800b96:	89 e5                	mov    %esp,%ebp
+  800b98:	57                   	push   %edi
+  800b99:	56                   	push   %esi
+  800b9a:	53                   	push   %ebx
+  800b9b:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800ba1:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800ba7:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800bad:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800bb3:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800bba:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800bbd:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800bc4:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800bc7:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800bce:	74 76                	je     800c46 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800bd0:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800bd6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bd9:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800bdf:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800be6:	0f 88 06 01 00 00    	js     800cf2 <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800bec:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800bf3:	0f 84 48 01 00 00    	je     800d41 <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800bf9:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800bff:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800c05:	be 00 00 00 00       	mov    $0x0,%esi
+  800c0a:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800c10:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c13:	55                   	push   %ebp
+  800c14:	68 1d 0c 80 00       	push   $0x800c1d
+  800c19:	89 e5                	mov    %esp,%ebp
+  800c1b:	0f 34                	sysenter
+  800c1d:	83 c4 04             	add    $0x4,%esp
+  800c20:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800c21:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800c27:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800c2d:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800c30:	0f 85 9a 01 00 00    	jne    800dd0 <page_vec_call+0x23b>
+  800c36:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c3b:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c3e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c41:	e9 29 01 00 00       	jmp    800d6f <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800c46:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800c4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c4f:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800c51:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800c58:	78 2f                	js     800c89 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800c5a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800c61:	74 72                	je     800cd5 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800c63:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800c69:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800c6f:	b8 10 00 00 00       	mov    $0x10,%eax
+  800c74:	89 fb                	mov    %edi,%ebx
+  800c76:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c79:	55                   	push   %ebp
+  800c7a:	68 83 0c 80 00       	push   $0x800c83
+  800c7f:	89 e5                	mov    %esp,%ebp
+  800c81:	0f 34                	sysenter
+  800c83:	83 c4 04             	add    $0x4,%esp
+  800c86:	5d                   	pop    %ebp
+	return ret;
+  800c87:	eb 98                	jmp    800c21 <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800c89:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c8e:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800c90:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800c95:	f6 c6 08             	test   $0x8,%dh
+  800c98:	74 15                	je     800caf <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c9a:	89 c2                	mov    %eax,%edx
+  800c9c:	c1 ea 08             	shr    $0x8,%edx
+  800c9f:	83 e2 0f             	and    $0xf,%edx
+  800ca2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ca7:	83 fa 06             	cmp    $0x6,%edx
+  800caa:	74 0e                	je     800cba <page_vec_call+0x125>
+  800cac:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800caf:	0f b6 c9             	movzbl %cl,%ecx
+  800cb2:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800cb8:	eb a0                	jmp    800c5a <page_vec_call+0xc5>
+  800cba:	89 c2                	mov    %eax,%edx
+  800cbc:	c1 ea 04             	shr    $0x4,%edx
+  800cbf:	83 e2 0f             	and    $0xf,%edx
+  800cc2:	83 fa 02             	cmp    $0x2,%edx
+  800cc5:	77 e5                	ja     800cac <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800cc7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800cca:	83 f8 02             	cmp    $0x2,%eax
+  800ccd:	0f 97 c1             	seta   %cl
+  800cd0:	0f b6 c9             	movzbl %cl,%ecx
+  800cd3:	eb d7                	jmp    800cac <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800cd5:	b8 10 00 00 00       	mov    $0x10,%eax
+  800cda:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800ce0:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800ce6:	89 fb                	mov    %edi,%ebx
+  800ce8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800ceb:	cd 30                	int    $0x30
+  800ced:	e9 2f ff ff ff       	jmp    800c21 <page_vec_call+0x8c>
+  800cf2:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cf7:	0f a2                	cpuid
+		return 0;
+  800cf9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800cfe:	f6 c6 08             	test   $0x8,%dh
+  800d01:	74 15                	je     800d18 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d03:	89 c2                	mov    %eax,%edx
+  800d05:	c1 ea 08             	shr    $0x8,%edx
+  800d08:	83 e2 0f             	and    $0xf,%edx
+  800d0b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d10:	83 fa 06             	cmp    $0x6,%edx
+  800d13:	74 11                	je     800d26 <page_vec_call+0x191>
+  800d15:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800d18:	0f b6 c9             	movzbl %cl,%ecx
+  800d1b:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800d21:	e9 c6 fe ff ff       	jmp    800bec <page_vec_call+0x57>
+  800d26:	89 c2                	mov    %eax,%edx
+  800d28:	c1 ea 04             	shr    $0x4,%edx
+  800d2b:	83 e2 0f             	and    $0xf,%edx
+  800d2e:	83 fa 02             	cmp    $0x2,%edx
+  800d31:	77 e2                	ja     800d15 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800d33:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d36:	83 f8 02             	cmp    $0x2,%eax
+  800d39:	0f 97 c1             	seta   %cl
+  800d3c:	0f b6 c9             	movzbl %cl,%ecx
+  800d3f:	eb d4                	jmp    800d15 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800d41:	be 00 00 00 00       	mov    $0x0,%esi
+  800d46:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800d4c:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800d52:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800d58:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800d5b:	cd 30                	int    $0x30
+  800d5d:	e9 bf fe ff ff       	jmp    800c21 <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800d62:	29 da                	sub    %ebx,%edx
+			vec++;
+  800d64:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800d67:	83 e8 01             	sub    $0x1,%eax
+  800d6a:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800d6f:	85 c0                	test   %eax,%eax
+  800d71:	74 58                	je     800dcb <page_vec_call+0x236>
+  800d73:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800d76:	39 da                	cmp    %ebx,%edx
+  800d78:	73 e8                	jae    800d62 <page_vec_call+0x1cd>
+  800d7a:	89 75 08             	mov    %esi,0x8(%ebp)
+  800d7d:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800d80:	84 c9                	test   %cl,%cl
+  800d82:	74 06                	je     800d8a <page_vec_call+0x1f5>
+  800d84:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800d8a:	83 ec 04             	sub    $0x4,%esp
+  800d8d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d90:	c1 e0 04             	shl    $0x4,%eax
+  800d93:	50                   	push   %eax
+  800d94:	ff 75 08             	push   0x8(%ebp)
+  800d97:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800d9d:	53                   	push   %ebx
+  800d9e:	e8 34 fc ff ff       	call   8009d7 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800da3:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800da9:	89 c2                	mov    %eax,%edx
+  800dab:	c1 e2 0c             	shl    $0xc,%edx
+  800dae:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  800db4:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  800dba:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  800dc0:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  800dc3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  800dc6:	e9 f2 fd ff ff       	jmp    800bbd <page_vec_call+0x28>
+			r = 0;
+  800dcb:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  800dd0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800dd4:	74 0b                	je     800de1 <page_vec_call+0x24c>
+		*done = total;
+  800dd6:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800dd9:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  800ddf:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  800de1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de4:	5b                   	pop    %ebx
+  800de5:	5e                   	pop    %esi
+  800de6:	5f                   	pop    %edi
+  800de7:	5d                   	pop    %ebp
+  800de8:	c3                   	ret
+
+00800de9 <sys_cputs>:
+{
+  800de9:	55                   	push   %ebp
+  800dea:	89 e5                	mov    %esp,%ebp
+  800dec:	57                   	push   %edi
+  800ded:	56                   	push   %esi
+  800dee:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800def:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800df6:	78 2d                	js     800e25 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800df8:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800dff:	74 70                	je     800e71 <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800e01:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e06:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e09:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e0c:	89 c3                	mov    %eax,%ebx
+  800e0e:	89 c7                	mov    %eax,%edi
+  800e10:	89 c6                	mov    %eax,%esi
+  800e12:	55                   	push   %ebp
+  800e13:	68 1c 0e 80 00       	push   $0x800e1c
+  800e18:	89 e5                	mov    %esp,%ebp
+  800e1a:	0f 34                	sysenter
+  800e1c:	83 c4 04             	add    $0x4,%esp
+  800e1f:	5d                   	pop    %ebp
+}
+  800e20:	5b                   	pop    %ebx
+  800e21:	5e                   	pop    %esi
+  800e22:	5f                   	pop    %edi
+  800e23:	5d                   	pop    %ebp
+  800e24:	c3                   	ret
+  800e25:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e2a:	0f a2                	cpuid
+		return 0;
+  800e2c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800e31:	f6 c6 08             	test   $0x8,%dh
+  800e34:	74 15                	je     800e4b <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e36:	89 c2                	mov    %eax,%edx
+  800e38:	c1 ea 08             	shr    $0x8,%edx
+  800e3b:	83 e2 0f             	and    $0xf,%edx
+  800e3e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e43:	83 fa 06             	cmp    $0x6,%edx
+  800e46:	74 0e                	je     800e56 <sys_cputs+0x6d>
+  800e48:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e4b:	0f b6 c9             	movzbl %cl,%ecx
+  800e4e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800e54:	eb a2                	jmp    800df8 <sys_cputs+0xf>
+  800e56:	89 c2                	mov    %eax,%edx
+  800e58:	c1 ea 04             	shr    $0x4,%edx
+  800e5b:	83 e2 0f             	and    $0xf,%edx
+  800e5e:	83 fa 02             	cmp    $0x2,%edx
+  800e61:	77 e5                	ja     800e48 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800e63:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e66:	83 f8 02             	cmp    $0x2,%eax
+  800e69:	0f 97 c1             	seta   %cl
+  800e6c:	0f b6 c9             	movzbl %cl,%ecx
+  800e6f:	eb d7                	jmp    800e48 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800e71:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7c:	89 c3                	mov    %eax,%ebx
+  800e7e:	89 c7                	mov    %eax,%edi
+  800e80:	89 c6                	mov    %eax,%esi
+  800e82:	cd 30                	int    $0x30
+}
+  800e84:	eb 9a                	jmp    800e20 <sys_cputs+0x37>
+
+00800e86 <sys_cgetc>:
+{
+  800e86:	55                   	push   %ebp
+  800e87:	89 e5                	mov    %esp,%ebp
+  800e89:	57                   	push   %edi
+  800e8a:	56                   	push   %esi
+  800e8b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800e8c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e93:	78 2e                	js     800ec3 <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  800e95:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e9c:	74 71                	je     800f0f <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  800e9e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ea3:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ea8:	89 d1                	mov    %edx,%ecx
+  800eaa:	89 d3                	mov    %edx,%ebx
+  800eac:	89 d7                	mov    %edx,%edi
+  800eae:	89 d6                	mov    %edx,%esi
+  800eb0:	55                   	push   %ebp
+  800eb1:	68 ba 0e 80 00       	push   $0x800eba
+  800eb6:	89 e5                	mov    %esp,%ebp
+  800eb8:	0f 34                	sysenter
+  800eba:	83 c4 04             	add    $0x4,%esp
+  800ebd:	5d                   	pop    %ebp
+}
+  800ebe:	5b                   	pop    %ebx
+  800ebf:	5e                   	pop    %esi
+  800ec0:	5f                   	pop    %edi
+  800ec1:	5d                   	pop    %ebp
+  800ec2:	c3                   	ret
+  800ec3:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ec8:	0f a2                	cpuid
+		return 0;
+  800eca:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800ecf:	f6 c6 08             	test   $0x8,%dh
+  800ed2:	74 15                	je     800ee9 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ed4:	89 c2                	mov    %eax,%edx
+  800ed6:	c1 ea 08             	shr    $0x8,%edx
+  800ed9:	83 e2 0f             	and    $0xf,%edx
+  800edc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ee1:	83 fa 06             	cmp    $0x6,%edx
+  800ee4:	74 0e                	je     800ef4 <sys_cgetc+0x6e>
+  800ee6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800ee9:	0f b6 c9             	movzbl %cl,%ecx
+  800eec:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800ef2:	eb a1                	jmp    800e95 <sys_cgetc+0xf>
+  800ef4:	89 c2                	mov    %eax,%edx
+  800ef6:	c1 ea 04             	shr    $0x4,%edx
+  800ef9:	83 e2 0f             	and    $0xf,%edx
+  800efc:	83 fa 02             	cmp    $0x2,%edx
+  800eff:	77 e5                	ja     800ee6 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  800f01:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f04:	83 f8 02             	cmp    $0x2,%eax
+  800f07:	0f 97 c1             	seta   %cl
+  800f0a:	0f b6 c9             	movzbl %cl,%ecx
+  800f0d:	eb d7                	jmp    800ee6 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  800f0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f14:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f19:	89 d1                	mov    %edx,%ecx
+  800f1b:	89 d3                	mov    %edx,%ebx
+  800f1d:	89 d7                	mov    %edx,%edi
+  800f1f:	89 d6                	mov    %edx,%esi
+  800f21:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800f23:	eb 99                	jmp    800ebe <sys_cgetc+0x38>
+
+00800f25 <sys_env_destroy>:
+{
+  800f25:	55                   	push   %ebp
+  800f26:	89 e5                	mov    %esp,%ebp
+  800f28:	57                   	push   %edi
+  800f29:	56                   	push   %esi
+  800f2a:	53                   	push   %ebx
+  800f2b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800f2e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800f35:	78 36                	js     800f6d <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  800f37:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800f3e:	74 79                	je     800fb9 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  800f40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f43:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f48:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f4d:	89 cb                	mov    %ecx,%ebx
+  800f4f:	89 cf                	mov    %ecx,%edi
+  800f51:	89 ce                	mov    %ecx,%esi
+  800f53:	55                   	push   %ebp
+  800f54:	68 5d 0f 80 00       	push   $0x800f5d
+  800f59:	89 e5                	mov    %esp,%ebp
+  800f5b:	0f 34                	sysenter
+  800f5d:	83 c4 04             	add    $0x4,%esp
+  800f60:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800f61:	85 c0                	test   %eax,%eax
+  800f63:	7f 6b                	jg     800fd0 <sys_env_destroy+0xab>
+}
+  800f65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f68:	5b                   	pop    %ebx
+  800f69:	5e                   	pop    %esi
+  800f6a:	5f                   	pop    %edi
+  800f6b:	5d                   	pop    %ebp
+  800f6c:	c3                   	ret
+  800f6d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f72:	0f a2                	cpuid
+		return 0;
+  800f74:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f79:	f6 c6 08             	test   $0x8,%dh
+  800f7c:	74 15                	je     800f93 <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f7e:	89 c2                	mov    %eax,%edx
+  800f80:	c1 ea 08             	shr    $0x8,%edx
+  800f83:	83 e2 0f             	and    $0xf,%edx
+  800f86:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f8b:	83 fa 06             	cmp    $0x6,%edx
+  800f8e:	74 0e                	je     800f9e <sys_env_destroy+0x79>
+  800f90:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f93:	0f b6 c9             	movzbl %cl,%ecx
+  800f96:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800f9c:	eb 99                	jmp    800f37 <sys_env_destroy+0x12>
+  800f9e:	89 c2                	mov    %eax,%edx
+  800fa0:	c1 ea 04             	shr    $0x4,%edx
+  800fa3:	83 e2 0f             	and    $0xf,%edx
+  800fa6:	83 fa 02             	cmp    $0x2,%edx
+  800fa9:	77 e5                	ja     800f90 <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  800fab:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800fae:	83 f8 02             	cmp    $0x2,%eax
+  800fb1:	0f 97 c1             	seta   %cl
+  800fb4:	0f b6 c9             	movzbl %cl,%ecx
+  800fb7:	eb d7                	jmp    800f90 <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  800fb9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fbe:	b8 03 00 00 00       	mov    $0x3,%eax
+  800fc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc6:	89 cb                	mov    %ecx,%ebx
+  800fc8:	89 cf                	mov    %ecx,%edi
+  800fca:	89 ce                	mov    %ecx,%esi
+  800fcc:	cd 30                	int    $0x30
+  800fce:	eb 91                	jmp    800f61 <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fd0:	83 ec 0c             	sub    $0xc,%esp
+  800fd3:	50                   	push   %eax
+  800fd4:	6a 03                	push   $0x3
+  800fd6:	68 59 32 80 00       	push   $0x803259
+  800fdb:	6a 4a                	push   $0x4a
+  800fdd:	68 76 32 80 00       	push   $0x803276
+  800fe2:	e8 68 f1 ff ff       	call   80014f <_panic>
+
+00800fe7 <sys_getenvid>:
+{
+  800fe7:	55                   	push   %ebp
+  800fe8:	89 e5                	mov    %esp,%ebp
+  800fea:	57                   	push   %edi
+  800feb:	56                   	push   %esi
+  800fec:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800fed:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800ff4:	78 2e                	js     801024 <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  800ff6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800ffd:	74 71                	je     801070 <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  800fff:	ba 00 00 00 00       	mov    $0x0,%edx
+  801004:	b8 02 00 00 00       	mov    $0x2,%eax
+  801009:	89 d1                	mov    %edx,%ecx
+  80100b:	89 d3                	mov    %edx,%ebx
+  80100d:	89 d7                	mov    %edx,%edi
+  80100f:	89 d6                	mov    %edx,%esi
+  801011:	55                   	push   %ebp
+  801012:	68 1b 10 80 00       	push   $0x80101b
+  801017:	89 e5                	mov    %esp,%ebp
+  801019:	0f 34                	sysenter
+  80101b:	83 c4 04             	add    $0x4,%esp
+  80101e:	5d                   	pop    %ebp
+}
+  80101f:	5b                   	pop    %ebx
+  801020:	5e                   	pop    %esi
+  801021:	5f                   	pop    %edi
+  801022:	5d                   	pop    %ebp
+  801023:	c3                   	ret
+  801024:	b8 01 00 00 00       	mov    $0x1,%eax
+  801029:	0f a2                	cpuid
+		return 0;
+  80102b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801030:	f6 c6 08             	test   $0x8,%dh
+  801033:	74 15                	je     80104a <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801035:	89 c2                	mov    %eax,%edx
+  801037:	c1 ea 08             	shr    $0x8,%edx
+  80103a:	83 e2 0f             	and    $0xf,%edx
+  80103d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801042:	83 fa 06             	cmp    $0x6,%edx
+  801045:	74 0e                	je     801055 <sys_getenvid+0x6e>
+  801047:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80104a:	0f b6 c9             	movzbl %cl,%ecx
+  80104d:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801053:	eb a1                	jmp    800ff6 <sys_getenvid+0xf>
+  801055:	89 c2                	mov    %eax,%edx
+  801057:	c1 ea 04             	shr    $0x4,%edx
+  80105a:	83 e2 0f             	and    $0xf,%edx
+  80105d:	83 fa 02             	cmp    $0x2,%edx
+  801060:	77 e5                	ja     801047 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  801062:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801065:	83 f8 02             	cmp    $0x2,%eax
+  801068:	0f 97 c1             	seta   %cl
+  80106b:	0f b6 c9             	movzbl %cl,%ecx
+  80106e:	eb d7                	jmp    801047 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  801070:	ba 00 00 00 00       	mov    $0x0,%edx
+  801075:	b8 02 00 00 00       	mov    $0x2,%eax
+  80107a:	89 d1                	mov    %edx,%ecx
+  80107c:	89 d3                	mov    %edx,%ebx
+  80107e:	89 d7                	mov    %edx,%edi
+  801080:	89 d6                	mov    %edx,%esi
+  801082:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801084:	eb 99                	jmp    80101f <sys_getenvid+0x38>
+
+00801086 <sys_page_alloc>:
+{
+  801086:	55                   	push   %ebp
+  801087:	89 e5                	mov    %esp,%ebp
+  801089:	57                   	push   %edi
+  80108a:	56                   	push   %esi
+  80108b:	53                   	push   %ebx
+  80108c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80108f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801096:	78 38                	js     8010d0 <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  801098:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80109f:	74 7b                	je     80111c <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  8010a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8010a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ac:	b8 04 00 00 00       	mov    $0x4,%eax
+  8010b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010b4:	89 f7                	mov    %esi,%edi
+  8010b6:	55                   	push   %ebp
+  8010b7:	68 c0 10 80 00       	push   $0x8010c0
+  8010bc:	89 e5                	mov    %esp,%ebp
+  8010be:	0f 34                	sysenter
+  8010c0:	83 c4 04             	add    $0x4,%esp
+  8010c3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8010c4:	85 c0                	test   %eax,%eax
+  8010c6:	7f 6d                	jg     801135 <sys_page_alloc+0xaf>
+}
+  8010c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010cb:	5b                   	pop    %ebx
+  8010cc:	5e                   	pop    %esi
+  8010cd:	5f                   	pop    %edi
+  8010ce:	5d                   	pop    %ebp
+  8010cf:	c3                   	ret
+  8010d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010d5:	0f a2                	cpuid
+		return 0;
+  8010d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8010dc:	f6 c6 08             	test   $0x8,%dh
+  8010df:	74 15                	je     8010f6 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010e1:	89 c2                	mov    %eax,%edx
+  8010e3:	c1 ea 08             	shr    $0x8,%edx
+  8010e6:	83 e2 0f             	and    $0xf,%edx
+  8010e9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8010ee:	83 fa 06             	cmp    $0x6,%edx
+  8010f1:	74 0e                	je     801101 <sys_page_alloc+0x7b>
+  8010f3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8010f6:	0f b6 c9             	movzbl %cl,%ecx
+  8010f9:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8010ff:	eb 97                	jmp    801098 <sys_page_alloc+0x12>
+  801101:	89 c2                	mov    %eax,%edx
+  801103:	c1 ea 04             	shr    $0x4,%edx
+  801106:	83 e2 0f             	and    $0xf,%edx
+  801109:	83 fa 02             	cmp    $0x2,%edx
+  80110c:	77 e5                	ja     8010f3 <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  80110e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801111:	83 f8 02             	cmp    $0x2,%eax
+  801114:	0f 97 c1             	seta   %cl
+  801117:	0f b6 c9             	movzbl %cl,%ecx
+  80111a:	eb d7                	jmp    8010f3 <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  80111c:	be 00 00 00 00       	mov    $0x0,%esi
+  801121:	b8 04 00 00 00       	mov    $0x4,%eax
+  801126:	8b 55 08             	mov    0x8(%ebp),%edx
+  801129:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80112f:	89 f7                	mov    %esi,%edi
+  801131:	cd 30                	int    $0x30
+  801133:	eb 8f                	jmp    8010c4 <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801135:	83 ec 0c             	sub    $0xc,%esp
+  801138:	50                   	push   %eax
+  801139:	6a 04                	push   $0x4
+  80113b:	68 59 32 80 00       	push   $0x803259
+  801140:	6a 4a                	push   $0x4a
+  801142:	68 76 32 80 00       	push   $0x803276
+  801147:	e8 03 f0 ff ff       	call   80014f <_panic>
+
+0080114c <sys_page_map>:
+{
+  80114c:	55                   	push   %ebp
+  80114d:	89 e5                	mov    %esp,%ebp
+  80114f:	57                   	push   %edi
+  801150:	56                   	push   %esi
+  801151:	53                   	push   %ebx
+  801152:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801155:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80115c:	78 37                	js     801195 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  80115e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801165:	74 7a                	je     8011e1 <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  801167:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116d:	b8 05 00 00 00       	mov    $0x5,%eax
+  801172:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801175:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801178:	8b 75 18             	mov    0x18(%ebp),%esi
+  80117b:	55                   	push   %ebp
+  80117c:	68 85 11 80 00       	push   $0x801185
+  801181:	89 e5                	mov    %esp,%ebp
+  801183:	0f 34                	sysenter
+  801185:	83 c4 04             	add    $0x4,%esp
+  801188:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801189:	85 c0                	test   %eax,%eax
+  80118b:	7f 6c                	jg     8011f9 <sys_page_map+0xad>
+}
+  80118d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801190:	5b                   	pop    %ebx
+  801191:	5e                   	pop    %esi
+  801192:	5f                   	pop    %edi
+  801193:	5d                   	pop    %ebp
+  801194:	c3                   	ret
+  801195:	b8 01 00 00 00       	mov    $0x1,%eax
+  80119a:	0f a2                	cpuid
+		return 0;
+  80119c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8011a1:	f6 c6 08             	test   $0x8,%dh
+  8011a4:	74 15                	je     8011bb <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011a6:	89 c2                	mov    %eax,%edx
+  8011a8:	c1 ea 08             	shr    $0x8,%edx
+  8011ab:	83 e2 0f             	and    $0xf,%edx
+  8011ae:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011b3:	83 fa 06             	cmp    $0x6,%edx
+  8011b6:	74 0e                	je     8011c6 <sys_page_map+0x7a>
+  8011b8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8011bb:	0f b6 c9             	movzbl %cl,%ecx
+  8011be:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8011c4:	eb 98                	jmp    80115e <sys_page_map+0x12>
+  8011c6:	89 c2                	mov    %eax,%edx
+  8011c8:	c1 ea 04             	shr    $0x4,%edx
+  8011cb:	83 e2 0f             	and    $0xf,%edx
+  8011ce:	83 fa 02             	cmp    $0x2,%edx
+  8011d1:	77 e5                	ja     8011b8 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  8011d3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011d6:	83 f8 02             	cmp    $0x2,%eax
+  8011d9:	0f 97 c1             	seta   %cl
+  8011dc:	0f b6 c9             	movzbl %cl,%ecx
+  8011df:	eb d7                	jmp    8011b8 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  8011e1:	b8 05 00 00 00       	mov    $0x5,%eax
+  8011e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011ef:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011f2:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011f5:	cd 30                	int    $0x30
+  8011f7:	eb 90                	jmp    801189 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011f9:	83 ec 0c             	sub    $0xc,%esp
+  8011fc:	50                   	push   %eax
+  8011fd:	6a 05                	push   $0x5
+  8011ff:	68 59 32 80 00       	push   $0x803259
+  801204:	6a 4a                	push   $0x4a
+  801206:	68 76 32 80 00       	push   $0x803276
+  80120b:	e8 3f ef ff ff       	call   80014f <_panic>
+
+00801210 <sys_page_unmap>:
+{
+  801210:	55                   	push   %ebp
+  801211:	89 e5                	mov    %esp,%ebp
+  801213:	57                   	push   %edi
+  801214:	56                   	push   %esi
+  801215:	53                   	push   %ebx
+  801216:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801219:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801220:	78 37                	js     801259 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  801222:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801229:	74 7a                	je     8012a5 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  80122b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801230:	8b 55 08             	mov    0x8(%ebp),%edx
+  801233:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801236:	b8 06 00 00 00       	mov    $0x6,%eax
+  80123b:	89 df                	mov    %ebx,%edi
+  80123d:	89 de                	mov    %ebx,%esi
+  80123f:	55                   	push   %ebp
+  801240:	68 49 12 80 00       	push   $0x801249
+  801245:	89 e5                	mov    %esp,%ebp
+  801247:	0f 34                	sysenter
+  801249:	83 c4 04             	add    $0x4,%esp
+  80124c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80124d:	85 c0                	test   %eax,%eax
+  80124f:	7f 6c                	jg     8012bd <sys_page_unmap+0xad>
+}
+  801251:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801254:	5b                   	pop    %ebx
+  801255:	5e                   	pop    %esi
+  801256:	5f                   	pop    %edi
+  801257:	5d                   	pop    %ebp
+  801258:	c3                   	ret
+  801259:	b8 01 00 00 00       	mov    $0x1,%eax
+  80125e:	0f a2                	cpuid
+		return 0;
+  801260:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801265:	f6 c6 08             	test   $0x8,%dh
+  801268:	74 15                	je     80127f <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80126a:	89 c2                	mov    %eax,%edx
+  80126c:	c1 ea 08             	shr    $0x8,%edx
+  80126f:	83 e2 0f             	and    $0xf,%edx
+  801272:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801277:	83 fa 06             	cmp    $0x6,%edx
+  80127a:	74 0e                	je     80128a <sys_page_unmap+0x7a>
+  80127c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80127f:	0f b6 c9             	movzbl %cl,%ecx
+  801282:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801288:	eb 98                	jmp    801222 <sys_page_unmap+0x12>
+  80128a:	89 c2                	mov    %eax,%edx
+  80128c:	c1 ea 04             	shr    $0x4,%edx
+  80128f:	83 e2 0f             	and    $0xf,%edx
+  801292:	83 fa 02             	cmp    $0x2,%edx
+  801295:	77 e5                	ja     80127c <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  801297:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80129a:	83 f8 02             	cmp    $0x2,%eax
+  80129d:	0f 97 c1             	seta   %cl
+  8012a0:	0f b6 c9             	movzbl %cl,%ecx
+  8012a3:	eb d7                	jmp    80127c <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  8012a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012aa:	b8 06 00 00 00       	mov    $0x6,%eax
+  8012af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b5:	89 df                	mov    %ebx,%edi
+  8012b7:	89 de                	mov    %ebx,%esi
+  8012b9:	cd 30                	int    $0x30
+  8012bb:	eb 90                	jmp    80124d <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012bd:	83 ec 0c             	sub    $0xc,%esp
+  8012c0:	50                   	push   %eax
+  8012c1:	6a 06                	push   $0x6
+  8012c3:	68 59 32 80 00       	push   $0x803259
+  8012c8:	6a 4a                	push   $0x4a
+  8012ca:	68 76 32 80 00       	push   $0x803276
+  8012cf:	e8 7b ee ff ff       	call   80014f <_panic>
+
+008012d4 <sys_page_copy>:
+{
+  8012d4:	55                   	push   %ebp
+  8012d5:	89 e5                	mov    %esp,%ebp
+  8012d7:	57                   	push   %edi
+  8012d8:	56                   	push   %esi
+  8012d9:	53                   	push   %ebx
+  8012da:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8012dd:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8012e4:	78 37                	js     80131d <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  8012e6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8012ed:	74 7a                	je     801369 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  8012ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f5:	b8 29 00 00 00       	mov    $0x29,%eax
+  8012fa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012fd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801300:	8b 75 18             	mov    0x18(%ebp),%esi
+  801303:	55                   	push   %ebp
+  801304:	68 0d 13 80 00       	push   $0x80130d
+  801309:	89 e5                	mov    %esp,%ebp
+  80130b:	0f 34                	sysenter
+  80130d:	83 c4 04             	add    $0x4,%esp
+  801310:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801311:	85 c0                	test   %eax,%eax
+  801313:	7f 6c                	jg     801381 <sys_page_copy+0xad>
+}
+  801315:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801318:	5b                   	pop    %ebx
+  801319:	5e                   	pop    %esi
+  80131a:	5f                   	pop    %edi
+  80131b:	5d                   	pop    %ebp
+  80131c:	c3                   	ret
+  80131d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801322:	0f a2                	cpuid
+		return 0;
+  801324:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801329:	f6 c6 08             	test   $0x8,%dh
+  80132c:	74 15                	je     801343 <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80132e:	89 c2                	mov    %eax,%edx
+  801330:	c1 ea 08             	shr    $0x8,%edx
+  801333:	83 e2 0f             	and    $0xf,%edx
+  801336:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80133b:	83 fa 06             	cmp    $0x6,%edx
+  80133e:	74 0e                	je     80134e <sys_page_copy+0x7a>
+  801340:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801343:	0f b6 c9             	movzbl %cl,%ecx
+  801346:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80134c:	eb 98                	jmp    8012e6 <sys_page_copy+0x12>
+  80134e:	89 c2                	mov    %eax,%edx
+  801350:	c1 ea 04             	shr    $0x4,%edx
+  801353:	83 e2 0f             	and    $0xf,%edx
+  801356:	83 fa 02             	cmp    $0x2,%edx
+  801359:	77 e5                	ja     801340 <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  80135b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80135e:	83 f8 02             	cmp    $0x2,%eax
+  801361:	0f 97 c1             	seta   %cl
+  801364:	0f b6 c9             	movzbl %cl,%ecx
+  801367:	eb d7                	jmp    801340 <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  801369:	b8 29 00 00 00       	mov    $0x29,%eax
+  80136e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801371:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801374:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801377:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80137a:	8b 75 18             	mov    0x18(%ebp),%esi
+  80137d:	cd 30                	int    $0x30
+  80137f:	eb 90                	jmp    801311 <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801381:	83 ec 0c             	sub    $0xc,%esp
+  801384:	50                   	push   %eax
+  801385:	6a 29                	push   $0x29
+  801387:	68 59 32 80 00       	push   $0x803259
+  80138c:	6a 4a                	push   $0x4a
+  80138e:	68 76 32 80 00       	push   $0x803276
+  801393:	e8 b7 ed ff ff       	call   80014f <_panic>
+
+00801398 <sys_yield>:
+{
+  801398:	55                   	push   %ebp
+  801399:	89 e5                	mov    %esp,%ebp
+  80139b:	57                   	push   %edi
+  80139c:	56                   	push   %esi
+  80139d:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80139e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8013a5:	78 2e                	js     8013d5 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  8013a7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8013ae:	74 71                	je     801421 <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  8013b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013b5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8013ba:	89 d1                	mov    %edx,%ecx
+  8013bc:	89 d3                	mov    %edx,%ebx
+  8013be:	89 d7                	mov    %edx,%edi
+  8013c0:	89 d6                	mov    %edx,%esi
+  8013c2:	55                   	push   %ebp
+  8013c3:	68 cc 13 80 00       	push   $0x8013cc
+  8013c8:	89 e5                	mov    %esp,%ebp
+  8013ca:	0f 34                	sysenter
+  8013cc:	83 c4 04             	add    $0x4,%esp
+  8013cf:	5d                   	pop    %ebp
+}
+  8013d0:	5b                   	pop    %ebx
+  8013d1:	5e                   	pop    %esi
+  8013d2:	5f                   	pop    %edi
+  8013d3:	5d                   	pop    %ebp
+  8013d4:	c3                   	ret
+  8013d5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013da:	0f a2                	cpuid
+		return 0;
+  8013dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8013e1:	f6 c6 08             	test   $0x8,%dh
+  8013e4:	74 15                	je     8013fb <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013e6:	89 c2                	mov    %eax,%edx
+  8013e8:	c1 ea 08             	shr    $0x8,%edx
+  8013eb:	83 e2 0f             	and    $0xf,%edx
+  8013ee:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8013f3:	83 fa 06             	cmp    $0x6,%edx
+  8013f6:	74 0e                	je     801406 <sys_yield+0x6e>
+  8013f8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8013fb:	0f b6 c9             	movzbl %cl,%ecx
+  8013fe:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801404:	eb a1                	jmp    8013a7 <sys_yield+0xf>
+  801406:	89 c2                	mov    %eax,%edx
+  801408:	c1 ea 04             	shr    $0x4,%edx
+  80140b:	83 e2 0f             	and    $0xf,%edx
+  80140e:	83 fa 02             	cmp    $0x2,%edx
+  801411:	77 e5                	ja     8013f8 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  801413:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801416:	83 f8 02             	cmp    $0x2,%eax
+  801419:	0f 97 c1             	seta   %cl
+  80141c:	0f b6 c9             	movzbl %cl,%ecx
+  80141f:	eb d7                	jmp    8013f8 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  801421:	ba 00 00 00 00       	mov    $0x0,%edx
+  801426:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80142b:	89 d1                	mov    %edx,%ecx
+  80142d:	89 d3                	mov    %edx,%ebx
+  80142f:	89 d7                	mov    %edx,%edi
+  801431:	89 d6                	mov    %edx,%esi
+  801433:	cd 30                	int    $0x30
+}
+  801435:	eb 99                	jmp    8013d0 <sys_yield+0x38>
+
+00801437 <sys_env_set_status>:
+{
+  801437:	55                   	push   %ebp
+  801438:	89 e5                	mov    %esp,%ebp
+  80143a:	57                   	push   %edi
+  80143b:	56                   	push   %esi
+  80143c:	53                   	push   %ebx
+  80143d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801440:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801447:	78 37                	js     801480 <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  801449:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801450:	74 7a                	je     8014cc <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  801452:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801457:	8b 55 08             	mov    0x8(%ebp),%edx
+  80145a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80145d:	b8 08 00 00 00       	mov    $0x8,%eax
+  801462:	89 df                	mov    %ebx,%edi
+  801464:	89 de                	mov    %ebx,%esi
+  801466:	55                   	push   %ebp
+  801467:	68 70 14 80 00       	push   $0x801470
+  80146c:	89 e5                	mov    %esp,%ebp
+  80146e:	0f 34                	sysenter
+  801470:	83 c4 04             	add    $0x4,%esp
+  801473:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801474:	85 c0                	test   %eax,%eax
+  801476:	7f 6c                	jg     8014e4 <sys_env_set_status+0xad>
+}
+  801478:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80147b:	5b                   	pop    %ebx
+  80147c:	5e                   	pop    %esi
+  80147d:	5f                   	pop    %edi
+  80147e:	5d                   	pop    %ebp
+  80147f:	c3                   	ret
+  801480:	b8 01 00 00 00       	mov    $0x1,%eax
+  801485:	0f a2                	cpuid
+		return 0;
+  801487:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80148c:	f6 c6 08             	test   $0x8,%dh
+  80148f:	74 15                	je     8014a6 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801491:	89 c2                	mov    %eax,%edx
+  801493:	c1 ea 08             	shr    $0x8,%edx
+  801496:	83 e2 0f             	and    $0xf,%edx
+  801499:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80149e:	83 fa 06             	cmp    $0x6,%edx
+  8014a1:	74 0e                	je     8014b1 <sys_env_set_status+0x7a>
+  8014a3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8014a6:	0f b6 c9             	movzbl %cl,%ecx
+  8014a9:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8014af:	eb 98                	jmp    801449 <sys_env_set_status+0x12>
+  8014b1:	89 c2                	mov    %eax,%edx
+  8014b3:	c1 ea 04             	shr    $0x4,%edx
+  8014b6:	83 e2 0f             	and    $0xf,%edx
+  8014b9:	83 fa 02             	cmp    $0x2,%edx
+  8014bc:	77 e5                	ja     8014a3 <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  8014be:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014c1:	83 f8 02             	cmp    $0x2,%eax
+  8014c4:	0f 97 c1             	seta   %cl
+  8014c7:	0f b6 c9             	movzbl %cl,%ecx
+  8014ca:	eb d7                	jmp    8014a3 <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  8014cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014d1:	b8 08 00 00 00       	mov    $0x8,%eax
+  8014d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014dc:	89 df                	mov    %ebx,%edi
+  8014de:	89 de                	mov    %ebx,%esi
+  8014e0:	cd 30                	int    $0x30
+  8014e2:	eb 90                	jmp    801474 <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014e4:	83 ec 0c             	sub    $0xc,%esp
+  8014e7:	50                   	push   %eax
+  8014e8:	6a 08                	push   $0x8
+  8014ea:	68 59 32 80 00       	push   $0x803259
+  8014ef:	6a 4a                	push   $0x4a
+  8014f1:	68 76 32 80 00       	push   $0x803276
+  8014f6:	e8 54 ec ff ff       	call   80014f <_panic>
+
+008014fb <sys_sysinfo>:
+{
+  8014fb:	55                   	push   %ebp
+  8014fc:	89 e5                	mov    %esp,%ebp
+  8014fe:	57                   	push   %edi
+  8014ff:	56                   	push   %esi
+  801500:	53                   	push   %ebx
+  801501:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801504:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80150b:	78 36                	js     801543 <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  80150d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801514:	74 79                	je     80158f <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  801516:	8b 55 08             	mov    0x8(%ebp),%edx
+  801519:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80151e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801523:	89 cb                	mov    %ecx,%ebx
+  801525:	89 cf                	mov    %ecx,%edi
+  801527:	89 ce                	mov    %ecx,%esi
+  801529:	55                   	push   %ebp
+  80152a:	68 33 15 80 00       	push   $0x801533
+  80152f:	89 e5                	mov    %esp,%ebp
+  801531:	0f 34                	sysenter
+  801533:	83 c4 04             	add    $0x4,%esp
+  801536:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801537:	85 c0                	test   %eax,%eax
+  801539:	7f 6b                	jg     8015a6 <sys_sysinfo+0xab>
+}
+  80153b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80153e:	5b                   	pop    %ebx
+  80153f:	5e                   	pop    %esi
+  801540:	5f                   	pop    %edi
+  801541:	5d                   	pop    %ebp
+  801542:	c3                   	ret
+  801543:	b8 01 00 00 00       	mov    $0x1,%eax
+  801548:	0f a2                	cpuid
+		return 0;
+  80154a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80154f:	f6 c6 08             	test   $0x8,%dh
+  801552:	74 15                	je     801569 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801554:	89 c2                	mov    %eax,%edx
+  801556:	c1 ea 08             	shr    $0x8,%edx
+  801559:	83 e2 0f             	and    $0xf,%edx
+  80155c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801561:	83 fa 06             	cmp    $0x6,%edx
+  801564:	74 0e                	je     801574 <sys_sysinfo+0x79>
+  801566:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801569:	0f b6 c9             	movzbl %cl,%ecx
+  80156c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801572:	eb 99                	jmp    80150d <sys_sysinfo+0x12>
+  801574:	89 c2                	mov    %eax,%edx
+  801576:	c1 ea 04             	shr    $0x4,%edx
+  801579:	83 e2 0f             	and    $0xf,%edx
+  80157c:	83 fa 02             	cmp    $0x2,%edx
+  80157f:	77 e5                	ja     801566 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  801581:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801584:	83 f8 02             	cmp    $0x2,%eax
+  801587:	0f 97 c1             	seta   %cl
+  80158a:	0f b6 c9             	movzbl %cl,%ecx
+  80158d:	eb d7                	jmp    801566 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  80158f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801594:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801599:	8b 55 08             	mov    0x8(%ebp),%edx
+  80159c:	89 cb                	mov    %ecx,%ebx
+  80159e:	89 cf                	mov    %ecx,%edi
+  8015a0:	89 ce                	mov    %ecx,%esi
+  8015a2:	cd 30                	int    $0x30
+  8015a4:	eb 91                	jmp    801537 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015a6:	83 ec 0c             	sub    $0xc,%esp
+  8015a9:	50                   	push   %eax
+  8015aa:	6a 0b                	push   $0xb
+  8015ac:	68 59 32 80 00       	push   $0x803259
+  8015b1:	6a 4a                	push   $0x4a
+  8015b3:	68 76 32 80 00       	push   $0x803276
+  8015b8:	e8 92 eb ff ff       	call   80014f <_panic>
+
+008015bd <sys_env_set_trapframe>:
+{
+  8015bd:	55                   	push   %ebp
+  8015be:	89 e5                	mov    %esp,%ebp
+  8015c0:	57                   	push   %edi
+  8015c1:	56                   	push   %esi
+  8015c2:	53                   	push   %ebx
+  8015c3:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8015c6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8015cd:	78 37                	js     801606 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  8015cf:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8015d6:	74 7a                	je     801652 <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  8015d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015e3:	b8 13 00 00 00       	mov    $0x13,%eax
+  8015e8:	89 df                	mov    %ebx,%edi
+  8015ea:	89 de                	mov    %ebx,%esi
+  8015ec:	55                   	push   %ebp
+  8015ed:	68 f6 15 80 00       	push   $0x8015f6
+  8015f2:	89 e5                	mov    %esp,%ebp
+  8015f4:	0f 34                	sysenter
+  8015f6:	83 c4 04             	add    $0x4,%esp
+  8015f9:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8015fa:	85 c0                	test   %eax,%eax
+  8015fc:	7f 6c                	jg     80166a <sys_env_set_trapframe+0xad>
+}
+  8015fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801601:	5b                   	pop    %ebx
+  801602:	5e                   	pop    %esi
+  801603:	5f                   	pop    %edi
+  801604:	5d                   	pop    %ebp
+  801605:	c3                   	ret
+  801606:	b8 01 00 00 00       	mov    $0x1,%eax
+  80160b:	0f a2                	cpuid
+		return 0;
+  80160d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801612:	f6 c6 08             	test   $0x8,%dh
+  801615:	74 15                	je     80162c <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801617:	89 c2                	mov    %eax,%edx
+  801619:	c1 ea 08             	shr    $0x8,%edx
+  80161c:	83 e2 0f             	and    $0xf,%edx
+  80161f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801624:	83 fa 06             	cmp    $0x6,%edx
+  801627:	74 0e                	je     801637 <sys_env_set_trapframe+0x7a>
+  801629:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80162c:	0f b6 c9             	movzbl %cl,%ecx
+  80162f:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801635:	eb 98                	jmp    8015cf <sys_env_set_trapframe+0x12>
+  801637:	89 c2                	mov    %eax,%edx
+  801639:	c1 ea 04             	shr    $0x4,%edx
+  80163c:	83 e2 0f             	and    $0xf,%edx
+  80163f:	83 fa 02             	cmp    $0x2,%edx
+  801642:	77 e5                	ja     801629 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  801644:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801647:	83 f8 02             	cmp    $0x2,%eax
+  80164a:	0f 97 c1             	seta   %cl
+  80164d:	0f b6 c9             	movzbl %cl,%ecx
+  801650:	eb d7                	jmp    801629 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  801652:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801657:	b8 13 00 00 00       	mov    $0x13,%eax
+  80165c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80165f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801662:	89 df                	mov    %ebx,%edi
+  801664:	89 de                	mov    %ebx,%esi
+  801666:	cd 30                	int    $0x30
+  801668:	eb 90                	jmp    8015fa <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80166a:	83 ec 0c             	sub    $0xc,%esp
+  80166d:	50                   	push   %eax
+  80166e:	6a 13                	push   $0x13
+  801670:	68 59 32 80 00       	push   $0x803259
+  801675:	6a 4a                	push   $0x4a
+  801677:	68 76 32 80 00       	push   $0x803276
+  80167c:	e8 ce ea ff ff       	call   80014f <_panic>
+
+00801681 <sys_env_set_stack_limit>:
+{
+  801681:	55                   	push   %ebp
+  801682:	89 e5                	mov    %esp,%ebp
+  801684:	57                   	push   %edi
+  801685:	56                   	push   %esi
+  801686:	53                   	push   %ebx
+  801687:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80168a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801691:	78 37                	js     8016ca <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  801693:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80169a:	74 7a                	je     801716 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  80169c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016a7:	b8 19 00 00 00       	mov    $0x19,%eax
+  8016ac:	89 df                	mov    %ebx,%edi
+  8016ae:	89 de                	mov    %ebx,%esi
+  8016b0:	55                   	push   %ebp
+  8016b1:	68 ba 16 80 00       	push   $0x8016ba
+  8016b6:	89 e5                	mov    %esp,%ebp
+  8016b8:	0f 34                	sysenter
+  8016ba:	83 c4 04             	add    $0x4,%esp
+  8016bd:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8016be:	85 c0                	test   %eax,%eax
+  8016c0:	7f 6c                	jg     80172e <sys_env_set_stack_limit+0xad>
+}
+  8016c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016c5:	5b                   	pop    %ebx
+  8016c6:	5e                   	pop    %esi
+  8016c7:	5f                   	pop    %edi
+  8016c8:	5d                   	pop    %ebp
+  8016c9:	c3                   	ret
+  8016ca:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016cf:	0f a2                	cpuid
+		return 0;
+  8016d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8016d6:	f6 c6 08             	test   $0x8,%dh
+  8016d9:	74 15                	je     8016f0 <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016db:	89 c2                	mov    %eax,%edx
+  8016dd:	c1 ea 08             	shr    $0x8,%edx
+  8016e0:	83 e2 0f             	and    $0xf,%edx
+  8016e3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8016e8:	83 fa 06             	cmp    $0x6,%edx
+  8016eb:	74 0e                	je     8016fb <sys_env_set_stack_limit+0x7a>
+  8016ed:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8016f0:	0f b6 c9             	movzbl %cl,%ecx
+  8016f3:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8016f9:	eb 98                	jmp    801693 <sys_env_set_stack_limit+0x12>
+  8016fb:	89 c2                	mov    %eax,%edx
+  8016fd:	c1 ea 04             	shr    $0x4,%edx
+  801700:	83 e2 0f             	and    $0xf,%edx
+  801703:	83 fa 02             	cmp    $0x2,%edx
+  801706:	77 e5                	ja     8016ed <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  801708:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80170b:	83 f8 02             	cmp    $0x2,%eax
+  80170e:	0f 97 c1             	seta   %cl
+  801711:	0f b6 c9             	movzbl %cl,%ecx
+  801714:	eb d7                	jmp    8016ed <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  801716:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80171b:	b8 19 00 00 00       	mov    $0x19,%eax
+  801720:	8b 55 08             	mov    0x8(%ebp),%edx
+  801723:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801726:	89 df                	mov    %ebx,%edi
+  801728:	89 de                	mov    %ebx,%esi
+  80172a:	cd 30                	int    $0x30
+  80172c:	eb 90                	jmp    8016be <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80172e:	83 ec 0c             	sub    $0xc,%esp
+  801731:	50                   	push   %eax
+  801732:	6a 19                	push   $0x19
+  801734:	68 59 32 80 00       	push   $0x803259
+  801739:	6a 4a                	push   $0x4a
+  80173b:	68 76 32 80 00       	push   $0x803276
+  801740:	e8 0a ea ff ff       	call   80014f <_panic>
+
+00801745 <sys_env_set_pgfault_upcall>:
+{
+  801745:	55                   	push   %ebp
+  801746:	89 e5                	mov    %esp,%ebp
+  801748:	57                   	push   %edi
+  801749:	56                   	push   %esi
+  80174a:	53                   	push   %ebx
+  80174b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80174e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801755:	78 37                	js     80178e <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  801757:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80175e:	74 7a                	je     8017da <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  801760:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801765:	8b 55 08             	mov    0x8(%ebp),%edx
+  801768:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80176b:	b8 09 00 00 00       	mov    $0x9,%eax
+  801770:	89 df                	mov    %ebx,%edi
+  801772:	89 de                	mov    %ebx,%esi
+  801774:	55                   	push   %ebp
+  801775:	68 7e 17 80 00       	push   $0x80177e
+  80177a:	89 e5                	mov    %esp,%ebp
+  80177c:	0f 34                	sysenter
+  80177e:	83 c4 04             	add    $0x4,%esp
+  801781:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801782:	85 c0                	test   %eax,%eax
+  801784:	7f 6c                	jg     8017f2 <sys_env_set_pgfault_upcall+0xad>
+}
+  801786:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801789:	5b                   	pop    %ebx
+  80178a:	5e                   	pop    %esi
+  80178b:	5f                   	pop    %edi
+  80178c:	5d                   	pop    %ebp
+  80178d:	c3                   	ret
+  80178e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801793:	0f a2                	cpuid
+		return 0;
+  801795:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80179a:	f6 c6 08             	test   $0x8,%dh
+  80179d:	74 15                	je     8017b4 <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80179f:	89 c2                	mov    %eax,%edx
+  8017a1:	c1 ea 08             	shr    $0x8,%edx
+  8017a4:	83 e2 0f             	and    $0xf,%edx
+  8017a7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017ac:	83 fa 06             	cmp    $0x6,%edx
+  8017af:	74 0e                	je     8017bf <sys_env_set_pgfault_upcall+0x7a>
+  8017b1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8017b4:	0f b6 c9             	movzbl %cl,%ecx
+  8017b7:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8017bd:	eb 98                	jmp    801757 <sys_env_set_pgfault_upcall+0x12>
+  8017bf:	89 c2                	mov    %eax,%edx
+  8017c1:	c1 ea 04             	shr    $0x4,%edx
+  8017c4:	83 e2 0f             	and    $0xf,%edx
+  8017c7:	83 fa 02             	cmp    $0x2,%edx
+  8017ca:	77 e5                	ja     8017b1 <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  8017cc:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017cf:	83 f8 02             	cmp    $0x2,%eax
+  8017d2:	0f 97 c1             	seta   %cl
+  8017d5:	0f b6 c9             	movzbl %cl,%ecx
+  8017d8:	eb d7                	jmp    8017b1 <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  8017da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017df:	b8 09 00 00 00       	mov    $0x9,%eax
+  8017e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017ea:	89 df                	mov    %ebx,%edi
+  8017ec:	89 de                	mov    %ebx,%esi
+  8017ee:	cd 30                	int    $0x30
+  8017f0:	eb 90                	jmp    801782 <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017f2:	83 ec 0c             	sub    $0xc,%esp
+  8017f5:	50                   	push   %eax
+  8017f6:	6a 09                	push   $0x9
+  8017f8:	68 59 32 80 00       	push   $0x803259
+  8017fd:	6a 4a                	push   $0x4a
+  8017ff:	68 76 32 80 00       	push   $0x803276
+  801804:	e8 46 e9 ff ff       	call   80014f <_panic>
+
+00801809 <sys_ipc_try_send>:
+{
+  801809:	55                   	push   %ebp
+  80180a:	89 e5                	mov    %esp,%ebp
+  80180c:	57                   	push   %edi
+  80180d:	56                   	push   %esi
+  80180e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80180f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801816:	78 32                	js     80184a <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  801818:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80181f:	74 75                	je     801896 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801821:	8b 55 08             	mov    0x8(%ebp),%edx
+  801824:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801827:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80182c:	be 00 00 00 00       	mov    $0x0,%esi
+  801831:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801834:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801837:	55                   	push   %ebp
+  801838:	68 41 18 80 00       	push   $0x801841
+  80183d:	89 e5                	mov    %esp,%ebp
+  80183f:	0f 34                	sysenter
+  801841:	83 c4 04             	add    $0x4,%esp
+  801844:	5d                   	pop    %ebp
+}
+  801845:	5b                   	pop    %ebx
+  801846:	5e                   	pop    %esi
+  801847:	5f                   	pop    %edi
+  801848:	5d                   	pop    %ebp
+  801849:	c3                   	ret
+  80184a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80184f:	0f a2                	cpuid
+		return 0;
+  801851:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801856:	f6 c6 08             	test   $0x8,%dh
+  801859:	74 15                	je     801870 <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80185b:	89 c2                	mov    %eax,%edx
+  80185d:	c1 ea 08             	shr    $0x8,%edx
+  801860:	83 e2 0f             	and    $0xf,%edx
+  801863:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801868:	83 fa 06             	cmp    $0x6,%edx
+  80186b:	74 0e                	je     80187b <sys_ipc_try_send+0x72>
+  80186d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801870:	0f b6 c9             	movzbl %cl,%ecx
+  801873:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801879:	eb 9d                	jmp    801818 <sys_ipc_try_send+0xf>
+  80187b:	89 c2                	mov    %eax,%edx
+  80187d:	c1 ea 04             	shr    $0x4,%edx
+  801880:	83 e2 0f             	and    $0xf,%edx
+  801883:	83 fa 02             	cmp    $0x2,%edx
+  801886:	77 e5                	ja     80186d <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  801888:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80188b:	83 f8 02             	cmp    $0x2,%eax
+  80188e:	0f 97 c1             	seta   %cl
+  801891:	0f b6 c9             	movzbl %cl,%ecx
+  801894:	eb d7                	jmp    80186d <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  801896:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80189b:	be 00 00 00 00       	mov    $0x0,%esi
+  8018a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018a9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8018ac:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  8018ae:	eb 95                	jmp    801845 <sys_ipc_try_send+0x3c>
+
+008018b0 <sys_ipc_send>:
+{
+  8018b0:	55                   	push   %ebp
+  8018b1:	89 e5                	mov    %esp,%ebp
+  8018b3:	57                   	push   %edi
+  8018b4:	56                   	push   %esi
+  8018b5:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8018b6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8018bd:	78 32                	js     8018f1 <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  8018bf:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8018c6:	74 75                	je     80193d <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  8018c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018ce:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8018d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8018d8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018db:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8018de:	55                   	push   %ebp
+  8018df:	68 e8 18 80 00       	push   $0x8018e8
+  8018e4:	89 e5                	mov    %esp,%ebp
+  8018e6:	0f 34                	sysenter
+  8018e8:	83 c4 04             	add    $0x4,%esp
+  8018eb:	5d                   	pop    %ebp
+}
+  8018ec:	5b                   	pop    %ebx
+  8018ed:	5e                   	pop    %esi
+  8018ee:	5f                   	pop    %edi
+  8018ef:	5d                   	pop    %ebp
+  8018f0:	c3                   	ret
+  8018f1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018f6:	0f a2                	cpuid
+		return 0;
+  8018f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018fd:	f6 c6 08             	test   $0x8,%dh
+  801900:	74 15                	je     801917 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801902:	89 c2                	mov    %eax,%edx
+  801904:	c1 ea 08             	shr    $0x8,%edx
+  801907:	83 e2 0f             	and    $0xf,%edx
+  80190a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80190f:	83 fa 06             	cmp    $0x6,%edx
+  801912:	74 0e                	je     801922 <sys_ipc_send+0x72>
+  801914:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801917:	0f b6 c9             	movzbl %cl,%ecx
+  80191a:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801920:	eb 9d                	jmp    8018bf <sys_ipc_send+0xf>
+  801922:	89 c2                	mov    %eax,%edx
+  801924:	c1 ea 04             	shr    $0x4,%edx
+  801927:	83 e2 0f             	and    $0xf,%edx
+  80192a:	83 fa 02             	cmp    $0x2,%edx
+  80192d:	77 e5                	ja     801914 <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  80192f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801932:	83 f8 02             	cmp    $0x2,%eax
+  801935:	0f 97 c1             	seta   %cl
+  801938:	0f b6 c9             	movzbl %cl,%ecx
+  80193b:	eb d7                	jmp    801914 <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  80193d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801942:	be 00 00 00 00       	mov    $0x0,%esi
+  801947:	8b 55 08             	mov    0x8(%ebp),%edx
+  80194a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80194d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801950:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801953:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801955:	eb 95                	jmp    8018ec <sys_ipc_send+0x3c>
+
+00801957 <sys_ipc_recv>:
+{
+  801957:	55                   	push   %ebp
+  801958:	89 e5                	mov    %esp,%ebp
+  80195a:	57                   	push   %edi
+  80195b:	56                   	push   %esi
+  80195c:	53                   	push   %ebx
+  80195d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801960:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801967:	78 36                	js     80199f <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  801969:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801970:	74 79                	je     8019eb <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  801972:	8b 55 08             	mov    0x8(%ebp),%edx
+  801975:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80197a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80197f:	89 cb                	mov    %ecx,%ebx
+  801981:	89 cf                	mov    %ecx,%edi
+  801983:	89 ce                	mov    %ecx,%esi
+  801985:	55                   	push   %ebp
+  801986:	68 8f 19 80 00       	push   $0x80198f
+  80198b:	89 e5                	mov    %esp,%ebp
+  80198d:	0f 34                	sysenter
+  80198f:	83 c4 04             	add    $0x4,%esp
+  801992:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801993:	85 c0                	test   %eax,%eax
+  801995:	7f 6b                	jg     801a02 <sys_ipc_recv+0xab>
+}
+  801997:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80199a:	5b                   	pop    %ebx
+  80199b:	5e                   	pop    %esi
+  80199c:	5f                   	pop    %edi
+  80199d:	5d                   	pop    %ebp
+  80199e:	c3                   	ret
+  80199f:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019a4:	0f a2                	cpuid
+		return 0;
+  8019a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8019ab:	f6 c6 08             	test   $0x8,%dh
+  8019ae:	74 15                	je     8019c5 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019b0:	89 c2                	mov    %eax,%edx
+  8019b2:	c1 ea 08             	shr    $0x8,%edx
+  8019b5:	83 e2 0f             	and    $0xf,%edx
+  8019b8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019bd:	83 fa 06             	cmp    $0x6,%edx
+  8019c0:	74 0e                	je     8019d0 <sys_ipc_recv+0x79>
+  8019c2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8019c5:	0f b6 c9             	movzbl %cl,%ecx
+  8019c8:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8019ce:	eb 99                	jmp    801969 <sys_ipc_recv+0x12>
+  8019d0:	89 c2                	mov    %eax,%edx
+  8019d2:	c1 ea 04             	shr    $0x4,%edx
+  8019d5:	83 e2 0f             	and    $0xf,%edx
+  8019d8:	83 fa 02             	cmp    $0x2,%edx
+  8019db:	77 e5                	ja     8019c2 <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  8019dd:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019e0:	83 f8 02             	cmp    $0x2,%eax
+  8019e3:	0f 97 c1             	seta   %cl
+  8019e6:	0f b6 c9             	movzbl %cl,%ecx
+  8019e9:	eb d7                	jmp    8019c2 <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  8019eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019f0:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8019f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019f8:	89 cb                	mov    %ecx,%ebx
+  8019fa:	89 cf                	mov    %ecx,%edi
+  8019fc:	89 ce                	mov    %ecx,%esi
+  8019fe:	cd 30                	int    $0x30
+  801a00:	eb 91                	jmp    801993 <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a02:	83 ec 0c             	sub    $0xc,%esp
+  801a05:	50                   	push   %eax
+  801a06:	6a 0d                	push   $0xd
+  801a08:	68 59 32 80 00       	push   $0x803259
+  801a0d:	6a 4a                	push   $0x4a
+  801a0f:	68 76 32 80 00       	push   $0x803276
+  801a14:	e8 36 e7 ff ff       	call   80014f <_panic>
+
+00801a19 <sys_ipc_send_range>:
+{
+  801a19:	55                   	push   %ebp
+  801a1a:	89 e5                	mov    %esp,%ebp
+  801a1c:	57                   	push   %edi
+  801a1d:	56                   	push   %esi
+  801a1e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801a1f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a26:	78 30                	js     801a58 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  801a28:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a2f:	74 73                	je     801aa4 <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801a31:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a34:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a37:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801a3c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a3f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a42:	8b 75 18             	mov    0x18(%ebp),%esi
+  801a45:	55                   	push   %ebp
+  801a46:	68 4f 1a 80 00       	push   $0x801a4f
+  801a4b:	89 e5                	mov    %esp,%ebp
+  801a4d:	0f 34                	sysenter
+  801a4f:	83 c4 04             	add    $0x4,%esp
+  801a52:	5d                   	pop    %ebp
+}
+  801a53:	5b                   	pop    %ebx
+  801a54:	5e                   	pop    %esi
+  801a55:	5f                   	pop    %edi
+  801a56:	5d                   	pop    %ebp
+  801a57:	c3                   	ret
+  801a58:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a5d:	0f a2                	cpuid
+		return 0;
+  801a5f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801a64:	f6 c6 08             	test   $0x8,%dh
+  801a67:	74 15                	je     801a7e <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a69:	89 c2                	mov    %eax,%edx
+  801a6b:	c1 ea 08             	shr    $0x8,%edx
+  801a6e:	83 e2 0f             	and    $0xf,%edx
+  801a71:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a76:	83 fa 06             	cmp    $0x6,%edx
+  801a79:	74 0e                	je     801a89 <sys_ipc_send_range+0x70>
+  801a7b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a7e:	0f b6 c9             	movzbl %cl,%ecx
+  801a81:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801a87:	eb 9f                	jmp    801a28 <sys_ipc_send_range+0xf>
+  801a89:	89 c2                	mov    %eax,%edx
+  801a8b:	c1 ea 04             	shr    $0x4,%edx
+  801a8e:	83 e2 0f             	and    $0xf,%edx
+  801a91:	83 fa 02             	cmp    $0x2,%edx
+  801a94:	77 e5                	ja     801a7b <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  801a96:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a99:	83 f8 02             	cmp    $0x2,%eax
+  801a9c:	0f 97 c1             	seta   %cl
+  801a9f:	0f b6 c9             	movzbl %cl,%ecx
+  801aa2:	eb d7                	jmp    801a7b <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  801aa4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801aa9:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801aaf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ab2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ab5:	8b 75 18             	mov    0x18(%ebp),%esi
+  801ab8:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  801aba:	eb 97                	jmp    801a53 <sys_ipc_send_range+0x3a>
+
+00801abc <sys_ipc_recv_range>:
+{
+  801abc:	55                   	push   %ebp
+  801abd:	89 e5                	mov    %esp,%ebp
+  801abf:	57                   	push   %edi
+  801ac0:	56                   	push   %esi
+  801ac1:	53                   	push   %ebx
+  801ac2:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801ac5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801acc:	78 37                	js     801b05 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  801ace:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ad5:	74 7a                	je     801b51 <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  801ad7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801adc:	8b 55 08             	mov    0x8(%ebp),%edx
+  801adf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ae2:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801ae7:	89 df                	mov    %ebx,%edi
+  801ae9:	89 de                	mov    %ebx,%esi
+  801aeb:	55                   	push   %ebp
+  801aec:	68 f5 1a 80 00       	push   $0x801af5
+  801af1:	89 e5                	mov    %esp,%ebp
+  801af3:	0f 34                	sysenter
+  801af5:	83 c4 04             	add    $0x4,%esp
+  801af8:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801af9:	85 c0                	test   %eax,%eax
+  801afb:	7f 6c                	jg     801b69 <sys_ipc_recv_range+0xad>
+}
+  801afd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b00:	5b                   	pop    %ebx
+  801b01:	5e                   	pop    %esi
+  801b02:	5f                   	pop    %edi
+  801b03:	5d                   	pop    %ebp
+  801b04:	c3                   	ret
+  801b05:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b0a:	0f a2                	cpuid
+		return 0;
+  801b0c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b11:	f6 c6 08             	test   $0x8,%dh
+  801b14:	74 15                	je     801b2b <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b16:	89 c2                	mov    %eax,%edx
+  801b18:	c1 ea 08             	shr    $0x8,%edx
+  801b1b:	83 e2 0f             	and    $0xf,%edx
+  801b1e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b23:	83 fa 06             	cmp    $0x6,%edx
+  801b26:	74 0e                	je     801b36 <sys_ipc_recv_range+0x7a>
+  801b28:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b2b:	0f b6 c9             	movzbl %cl,%ecx
+  801b2e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801b34:	eb 98                	jmp    801ace <sys_ipc_recv_range+0x12>
+  801b36:	89 c2                	mov    %eax,%edx
+  801b38:	c1 ea 04             	shr    $0x4,%edx
+  801b3b:	83 e2 0f             	and    $0xf,%edx
+  801b3e:	83 fa 02             	cmp    $0x2,%edx
+  801b41:	77 e5                	ja     801b28 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801b43:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b46:	83 f8 02             	cmp    $0x2,%eax
+  801b49:	0f 97 c1             	seta   %cl
+  801b4c:	0f b6 c9             	movzbl %cl,%ecx
+  801b4f:	eb d7                	jmp    801b28 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801b51:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b56:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801b5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b5e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b61:	89 df                	mov    %ebx,%edi
+  801b63:	89 de                	mov    %ebx,%esi
+  801b65:	cd 30                	int    $0x30
+  801b67:	eb 90                	jmp    801af9 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801b69:	83 ec 0c             	sub    $0xc,%esp
+  801b6c:	50                   	push   %eax
+  801b6d:	6a 1f                	push   $0x1f
+  801b6f:	68 59 32 80 00       	push   $0x803259
+  801b74:	6a 4a                	push   $0x4a
+  801b76:	68 76 32 80 00       	push   $0x803276
+  801b7b:	e8 cf e5 ff ff       	call   80014f <_panic>
+
+00801b80 <sys_ipc_call>:
+{
+  801b80:	55                   	push   %ebp
+  801b81:	89 e5                	mov    %esp,%ebp
+  801b83:	57                   	push   %edi
+  801b84:	56                   	push   %esi
+  801b85:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801b86:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b89:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801b8e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b91:	55                   	push   %ebp
+  801b92:	56                   	push   %esi
+  801b93:	8b 0e                	mov    (%esi),%ecx
+  801b95:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801b98:	8b 7e 08             	mov    0x8(%esi),%edi
+  801b9b:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801b9e:	8b 76 0c             	mov    0xc(%esi),%esi
+  801ba1:	cd 30                	int    $0x30
+  801ba3:	87 34 24             	xchg   %esi,(%esp)
+  801ba6:	89 0e                	mov    %ecx,(%esi)
+  801ba8:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801bab:	89 7e 08             	mov    %edi,0x8(%esi)
+  801bae:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801bb1:	8f 46 0c             	pop    0xc(%esi)
+  801bb4:	5d                   	pop    %ebp
+}
+  801bb5:	5b                   	pop    %ebx
+  801bb6:	5e                   	pop    %esi
+  801bb7:	5f                   	pop    %edi
+  801bb8:	5d                   	pop    %ebp
+  801bb9:	c3                   	ret
+
+00801bba <sys_ipc_reply_wait>:
+{
+  801bba:	55                   	push   %ebp
+  801bbb:	89 e5                	mov    %esp,%ebp
+  801bbd:	57                   	push   %edi
+  801bbe:	56                   	push   %esi
+  801bbf:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801bc0:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bc3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801bc8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801bcb:	55                   	push   %ebp
+  801bcc:	56                   	push   %esi
+  801bcd:	8b 0e                	mov    (%esi),%ecx
+  801bcf:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801bd2:	8b 7e 08             	mov    0x8(%esi),%edi
+  801bd5:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801bd8:	8b 76 0c             	mov    0xc(%esi),%esi
+  801bdb:	cd 30                	int    $0x30
+  801bdd:	87 34 24             	xchg   %esi,(%esp)
+  801be0:	89 0e                	mov    %ecx,(%esi)
+  801be2:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801be5:	89 7e 08             	mov    %edi,0x8(%esi)
+  801be8:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801beb:	8f 46 0c             	pop    0xc(%esi)
+  801bee:	5d                   	pop    %ebp
+}
+  801bef:	5b                   	pop    %ebx
+  801bf0:	5e                   	pop    %esi
+  801bf1:	5f                   	pop    %edi
+  801bf2:	5d                   	pop    %ebp
+  801bf3:	c3                   	ret
+
+00801bf4 <sys_ipc_send_msg>:
+{
+  801bf4:	55                   	push   %ebp
+  801bf5:	89 e5                	mov    %esp,%ebp
+  801bf7:	57                   	push   %edi
+  801bf8:	56                   	push   %esi
+  801bf9:	53                   	push   %ebx
+  801bfa:	83 ec 20             	sub    $0x20,%esp
+  801bfd:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801c00:	8b 10                	mov    (%eax),%edx
+  801c02:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801c05:	8b 50 04             	mov    0x4(%eax),%edx
+  801c08:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801c0b:	8b 50 08             	mov    0x8(%eax),%edx
+  801c0e:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801c11:	8b 50 0c             	mov    0xc(%eax),%edx
+  801c14:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801c17:	8b 40 10             	mov    0x10(%eax),%eax
+  801c1a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801c1d:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801c20:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c23:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801c28:	55                   	push   %ebp
+  801c29:	56                   	push   %esi
+  801c2a:	8b 0e                	mov    (%esi),%ecx
+  801c2c:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801c2f:	8b 7e 08             	mov    0x8(%esi),%edi
+  801c32:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801c35:	8b 76 0c             	mov    0xc(%esi),%esi
+  801c38:	cd 30                	int    $0x30
+  801c3a:	87 34 24             	xchg   %esi,(%esp)
+  801c3d:	89 0e                	mov    %ecx,(%esi)
+  801c3f:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801c42:	89 7e 08             	mov    %edi,0x8(%esi)
+  801c45:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801c48:	8f 46 0c             	pop    0xc(%esi)
+  801c4b:	5d                   	pop    %ebp
+}
+  801c4c:	83 c4 20             	add    $0x20,%esp
+  801c4f:	5b                   	pop    %ebx
+  801c50:	5e                   	pop    %esi
+  801c51:	5f                   	pop    %edi
+  801c52:	5d                   	pop    %ebp
+  801c53:	c3                   	ret
+
+00801c54 <sys_fork>:
+{
+  801c54:	55                   	push   %ebp
+  801c55:	89 e5                	mov    %esp,%ebp
+  801c57:	57                   	push   %edi
+  801c58:	56                   	push   %esi
+  801c59:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801c5a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801c61:	78 2e                	js     801c91 <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801c63:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801c6a:	74 71                	je     801cdd <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801c6c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c71:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801c76:	89 d1                	mov    %edx,%ecx
+  801c78:	89 d3                	mov    %edx,%ebx
+  801c7a:	89 d7                	mov    %edx,%edi
+  801c7c:	89 d6                	mov    %edx,%esi
+  801c7e:	55                   	push   %ebp
+  801c7f:	68 88 1c 80 00       	push   $0x801c88
+  801c84:	89 e5                	mov    %esp,%ebp
+  801c86:	0f 34                	sysenter
+  801c88:	83 c4 04             	add    $0x4,%esp
+  801c8b:	5d                   	pop    %ebp
+}
+  801c8c:	5b                   	pop    %ebx
+  801c8d:	5e                   	pop    %esi
+  801c8e:	5f                   	pop    %edi
+  801c8f:	5d                   	pop    %ebp
+  801c90:	c3                   	ret
+  801c91:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c96:	0f a2                	cpuid
+		return 0;
+  801c98:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801c9d:	f6 c6 08             	test   $0x8,%dh
+  801ca0:	74 15                	je     801cb7 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ca2:	89 c2                	mov    %eax,%edx
+  801ca4:	c1 ea 08             	shr    $0x8,%edx
+  801ca7:	83 e2 0f             	and    $0xf,%edx
+  801caa:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801caf:	83 fa 06             	cmp    $0x6,%edx
+  801cb2:	74 0e                	je     801cc2 <sys_fork+0x6e>
+  801cb4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801cb7:	0f b6 c9             	movzbl %cl,%ecx
+  801cba:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801cc0:	eb a1                	jmp    801c63 <sys_fork+0xf>
+  801cc2:	89 c2                	mov    %eax,%edx
+  801cc4:	c1 ea 04             	shr    $0x4,%edx
+  801cc7:	83 e2 0f             	and    $0xf,%edx
+  801cca:	83 fa 02             	cmp    $0x2,%edx
+  801ccd:	77 e5                	ja     801cb4 <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801ccf:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801cd2:	83 f8 02             	cmp    $0x2,%eax
+  801cd5:	0f 97 c1             	seta   %cl
+  801cd8:	0f b6 c9             	movzbl %cl,%ecx
+  801cdb:	eb d7                	jmp    801cb4 <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801cdd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ce2:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801ce7:	89 d1                	mov    %edx,%ecx
+  801ce9:	89 d3                	mov    %edx,%ebx
+  801ceb:	89 d7                	mov    %edx,%edi
+  801ced:	89 d6                	mov    %edx,%esi
+  801cef:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801cf1:	eb 99                	jmp    801c8c <sys_fork+0x38>
+
+00801cf3 <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801cf3:	55                   	push   %ebp
+  801cf4:	89 e5                	mov    %esp,%ebp
+  801cf6:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801cf9:	ff 75 14             	push   0x14(%ebp)
+  801cfc:	ff 75 10             	push   0x10(%ebp)
+  801cff:	ff 75 0c             	push   0xc(%ebp)
+  801d02:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d07:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d0a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801d0f:	e8 81 ee ff ff       	call   800b95 <page_vec_call>
+}
+  801d14:	c9                   	leave
+  801d15:	c3                   	ret
+
+00801d16 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801d16:	55                   	push   %ebp
+  801d17:	89 e5                	mov    %esp,%ebp
+  801d19:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801d1c:	ff 75 18             	push   0x18(%ebp)
+  801d1f:	ff 75 14             	push   0x14(%ebp)
+  801d22:	ff 75 10             	push   0x10(%ebp)
+  801d25:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d28:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d2b:	b8 10 00 00 00       	mov    $0x10,%eax
+  801d30:	e8 60 ee ff ff       	call   800b95 <page_vec_call>
+}
+  801d35:	c9                   	leave
+  801d36:	c3                   	ret
+
+00801d37 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801d37:	55                   	push   %ebp
+  801d38:	89 e5                	mov    %esp,%ebp
+  801d3a:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801d3d:	ff 75 14             	push   0x14(%ebp)
+  801d40:	ff 75 10             	push   0x10(%ebp)
+  801d43:	ff 75 0c             	push   0xc(%ebp)
+  801d46:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d4b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d4e:	b8 11 00 00 00       	mov    $0x11,%eax
+  801d53:	e8 3d ee ff ff       	call   800b95 <page_vec_call>
+}
+  801d58:	c9                   	leave
+  801d59:	c3                   	ret
+
+00801d5a <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801d5a:	55                   	push   %ebp
+  801d5b:	89 e5                	mov    %esp,%ebp
+  801d5d:	57                   	push   %edi
+  801d5e:	56                   	push   %esi
+  801d5f:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801d60:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801d67:	78 32                	js     801d9b <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801d69:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801d70:	74 75                	je     801de7 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801d72:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d75:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d78:	b8 12 00 00 00       	mov    $0x12,%eax
+  801d7d:	be 00 00 00 00       	mov    $0x0,%esi
+  801d82:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d85:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801d88:	55                   	push   %ebp
+  801d89:	68 92 1d 80 00       	push   $0x801d92
+  801d8e:	89 e5                	mov    %esp,%ebp
+  801d90:	0f 34                	sysenter
+  801d92:	83 c4 04             	add    $0x4,%esp
+  801d95:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801d96:	5b                   	pop    %ebx
+  801d97:	5e                   	pop    %esi
+  801d98:	5f                   	pop    %edi
+  801d99:	5d                   	pop    %ebp
+  801d9a:	c3                   	ret
+  801d9b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801da0:	0f a2                	cpuid
+		return 0;
+  801da2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801da7:	f6 c6 08             	test   $0x8,%dh
+  801daa:	74 15                	je     801dc1 <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801dac:	89 c2                	mov    %eax,%edx
+  801dae:	c1 ea 08             	shr    $0x8,%edx
+  801db1:	83 e2 0f             	and    $0xf,%edx
+  801db4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801db9:	83 fa 06             	cmp    $0x6,%edx
+  801dbc:	74 0e                	je     801dcc <sys_vm_ranges+0x72>
+  801dbe:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801dc1:	0f b6 c9             	movzbl %cl,%ecx
+  801dc4:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801dca:	eb 9d                	jmp    801d69 <sys_vm_ranges+0xf>
+  801dcc:	89 c2                	mov    %eax,%edx
+  801dce:	c1 ea 04             	shr    $0x4,%edx
+  801dd1:	83 e2 0f             	and    $0xf,%edx
+  801dd4:	83 fa 02             	cmp    $0x2,%edx
+  801dd7:	77 e5                	ja     801dbe <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  801dd9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ddc:	83 f8 02             	cmp    $0x2,%eax
+  801ddf:	0f 97 c1             	seta   %cl
+  801de2:	0f b6 c9             	movzbl %cl,%ecx
+  801de5:	eb d7                	jmp    801dbe <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801de7:	b8 12 00 00 00       	mov    $0x12,%eax
+  801dec:	be 00 00 00 00       	mov    $0x0,%esi
+  801df1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801df4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801df7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801dfa:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801dfd:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801dff:	eb 95                	jmp    801d96 <sys_vm_ranges+0x3c>
+
+00801e01 <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801e01:	55                   	push   %ebp
+  801e02:	89 e5                	mov    %esp,%ebp
+  801e04:	57                   	push   %edi
+  801e05:	56                   	push   %esi
+  801e06:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801e07:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e0e:	78 31                	js     801e41 <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801e10:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e17:	74 74                	je     801e8d <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801e19:	be 00 00 00 00       	mov    $0x0,%esi
+  801e1e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e21:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e24:	b8 14 00 00 00       	mov    $0x14,%eax
+  801e29:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e2c:	89 f7                	mov    %esi,%edi
+  801e2e:	55                   	push   %ebp
+  801e2f:	68 38 1e 80 00       	push   $0x801e38
+  801e34:	89 e5                	mov    %esp,%ebp
+  801e36:	0f 34                	sysenter
+  801e38:	83 c4 04             	add    $0x4,%esp
+  801e3b:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801e3c:	5b                   	pop    %ebx
+  801e3d:	5e                   	pop    %esi
+  801e3e:	5f                   	pop    %edi
+  801e3f:	5d                   	pop    %ebp
+  801e40:	c3                   	ret
+  801e41:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e46:	0f a2                	cpuid
+		return 0;
+  801e48:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801e4d:	f6 c6 08             	test   $0x8,%dh
+  801e50:	74 15                	je     801e67 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e52:	89 c2                	mov    %eax,%edx
+  801e54:	c1 ea 08             	shr    $0x8,%edx
+  801e57:	83 e2 0f             	and    $0xf,%edx
+  801e5a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e5f:	83 fa 06             	cmp    $0x6,%edx
+  801e62:	74 0e                	je     801e72 <sys_spawn+0x71>
+  801e64:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801e67:	0f b6 c9             	movzbl %cl,%ecx
+  801e6a:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801e70:	eb 9e                	jmp    801e10 <sys_spawn+0xf>
+  801e72:	89 c2                	mov    %eax,%edx
+  801e74:	c1 ea 04             	shr    $0x4,%edx
+  801e77:	83 e2 0f             	and    $0xf,%edx
+  801e7a:	83 fa 02             	cmp    $0x2,%edx
+  801e7d:	77 e5                	ja     801e64 <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  801e7f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e82:	83 f8 02             	cmp    $0x2,%eax
+  801e85:	0f 97 c1             	seta   %cl
+  801e88:	0f b6 c9             	movzbl %cl,%ecx
+  801e8b:	eb d7                	jmp    801e64 <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  801e8d:	be 00 00 00 00       	mov    $0x0,%esi
+  801e92:	b8 14 00 00 00       	mov    $0x14,%eax
+  801e97:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e9a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e9d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ea0:	89 f7                	mov    %esi,%edi
+  801ea2:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  801ea4:	eb 96                	jmp    801e3c <sys_spawn+0x3b>
+
+00801ea6 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  801ea6:	55                   	push   %ebp
+  801ea7:	89 e5                	mov    %esp,%ebp
+  801ea9:	57                   	push   %edi
+  801eaa:	56                   	push   %esi
+  801eab:	53                   	push   %ebx
+  801eac:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801eaf:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801eb6:	78 37                	js     801eef <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  801eb8:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ebf:	74 7a                	je     801f3b <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  801ec1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ec6:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ec9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ecc:	b8 15 00 00 00       	mov    $0x15,%eax
+  801ed1:	89 df                	mov    %ebx,%edi
+  801ed3:	89 de                	mov    %ebx,%esi
+  801ed5:	55                   	push   %ebp
+  801ed6:	68 df 1e 80 00       	push   $0x801edf
+  801edb:	89 e5                	mov    %esp,%ebp
+  801edd:	0f 34                	sysenter
+  801edf:	83 c4 04             	add    $0x4,%esp
+  801ee2:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801ee3:	85 c0                	test   %eax,%eax
+  801ee5:	7f 6c                	jg     801f53 <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  801ee7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801eea:	5b                   	pop    %ebx
+  801eeb:	5e                   	pop    %esi
+  801eec:	5f                   	pop    %edi
+  801eed:	5d                   	pop    %ebp
+  801eee:	c3                   	ret
+  801eef:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ef4:	0f a2                	cpuid
+		return 0;
+  801ef6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801efb:	f6 c6 08             	test   $0x8,%dh
+  801efe:	74 15                	je     801f15 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f00:	89 c2                	mov    %eax,%edx
+  801f02:	c1 ea 08             	shr    $0x8,%edx
+  801f05:	83 e2 0f             	and    $0xf,%edx
+  801f08:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f0d:	83 fa 06             	cmp    $0x6,%edx
+  801f10:	74 0e                	je     801f20 <sys_shm_create+0x7a>
+  801f12:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801f15:	0f b6 c9             	movzbl %cl,%ecx
+  801f18:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801f1e:	eb 98                	jmp    801eb8 <sys_shm_create+0x12>
+  801f20:	89 c2                	mov    %eax,%edx
+  801f22:	c1 ea 04             	shr    $0x4,%edx
+  801f25:	83 e2 0f             	and    $0xf,%edx
+  801f28:	83 fa 02             	cmp    $0x2,%edx
+  801f2b:	77 e5                	ja     801f12 <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  801f2d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f30:	83 f8 02             	cmp    $0x2,%eax
+  801f33:	0f 97 c1             	seta   %cl
+  801f36:	0f b6 c9             	movzbl %cl,%ecx
+  801f39:	eb d7                	jmp    801f12 <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  801f3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f40:	b8 15 00 00 00       	mov    $0x15,%eax
+  801f45:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f48:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f4b:	89 df                	mov    %ebx,%edi
+  801f4d:	89 de                	mov    %ebx,%esi
+  801f4f:	cd 30                	int    $0x30
+  801f51:	eb 90                	jmp    801ee3 <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801f53:	83 ec 0c             	sub    $0xc,%esp
+  801f56:	50                   	push   %eax
+  801f57:	6a 15                	push   $0x15
+  801f59:	68 59 32 80 00       	push   $0x803259
+  801f5e:	6a 4a                	push   $0x4a
+  801f60:	68 76 32 80 00       	push   $0x803276
+  801f65:	e8 e5 e1 ff ff       	call   80014f <_panic>
+
+00801f6a <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  801f6a:	55                   	push   %ebp
+  801f6b:	89 e5                	mov    %esp,%ebp
+  801f6d:	57                   	push   %edi
+  801f6e:	56                   	push   %esi
+  801f6f:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801f70:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f77:	78 32                	js     801fab <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  801f79:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f80:	74 75                	je     801ff7 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801f82:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f85:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f88:	b8 16 00 00 00       	mov    $0x16,%eax
+  801f8d:	be 00 00 00 00       	mov    $0x0,%esi
+  801f92:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f95:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801f98:	55                   	push   %ebp
+  801f99:	68 a2 1f 80 00       	push   $0x801fa2
+  801f9e:	89 e5                	mov    %esp,%ebp
+  801fa0:	0f 34                	sysenter
+  801fa2:	83 c4 04             	add    $0x4,%esp
+  801fa5:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  801fa6:	5b                   	pop    %ebx
+  801fa7:	5e                   	pop    %esi
+  801fa8:	5f                   	pop    %edi
+  801fa9:	5d                   	pop    %ebp
+  801faa:	c3                   	ret
+  801fab:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fb0:	0f a2                	cpuid
+		return 0;
+  801fb2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801fb7:	f6 c6 08             	test   $0x8,%dh
+  801fba:	74 15                	je     801fd1 <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fbc:	89 c2                	mov    %eax,%edx
+  801fbe:	c1 ea 08             	shr    $0x8,%edx
+  801fc1:	83 e2 0f             	and    $0xf,%edx
+  801fc4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801fc9:	83 fa 06             	cmp    $0x6,%edx
+  801fcc:	74 0e                	je     801fdc <sys_shm_attach+0x72>
+  801fce:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801fd1:	0f b6 c9             	movzbl %cl,%ecx
+  801fd4:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801fda:	eb 9d                	jmp    801f79 <sys_shm_attach+0xf>
+  801fdc:	89 c2                	mov    %eax,%edx
+  801fde:	c1 ea 04             	shr    $0x4,%edx
+  801fe1:	83 e2 0f             	and    $0xf,%edx
+  801fe4:	83 fa 02             	cmp    $0x2,%edx
+  801fe7:	77 e5                	ja     801fce <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  801fe9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fec:	83 f8 02             	cmp    $0x2,%eax
+  801fef:	0f 97 c1             	seta   %cl
+  801ff2:	0f b6 c9             	movzbl %cl,%ecx
+  801ff5:	eb d7                	jmp    801fce <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  801ff7:	b8 16 00 00 00       	mov    $0x16,%eax
+  801ffc:	be 00 00 00 00       	mov    $0x0,%esi
+  802001:	8b 55 08             	mov    0x8(%ebp),%edx
+  802004:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802007:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80200a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80200d:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  80200f:	eb 95                	jmp    801fa6 <sys_shm_attach+0x3c>
+
+00802011 <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  802011:	55                   	push   %ebp
+  802012:	89 e5                	mov    %esp,%ebp
+  802014:	57                   	push   %edi
+  802015:	56                   	push   %esi
+  802016:	53                   	push   %ebx
+  802017:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80201a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802021:	78 38                	js     80205b <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  802023:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80202a:	74 7b                	je     8020a7 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  80202c:	be 00 00 00 00       	mov    $0x0,%esi
+  802031:	8b 55 08             	mov    0x8(%ebp),%edx
+  802034:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802037:	b8 17 00 00 00       	mov    $0x17,%eax
+  80203c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80203f:	89 f7                	mov    %esi,%edi
+  802041:	55                   	push   %ebp
+  802042:	68 4b 20 80 00       	push   $0x80204b
+  802047:	89 e5                	mov    %esp,%ebp
+  802049:	0f 34                	sysenter
+  80204b:	83 c4 04             	add    $0x4,%esp
+  80204e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80204f:	85 c0                	test   %eax,%eax
+  802051:	7f 6d                	jg     8020c0 <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  802053:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802056:	5b                   	pop    %ebx
+  802057:	5e                   	pop    %esi
+  802058:	5f                   	pop    %edi
+  802059:	5d                   	pop    %ebp
+  80205a:	c3                   	ret
+  80205b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802060:	0f a2                	cpuid
+		return 0;
+  802062:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802067:	f6 c6 08             	test   $0x8,%dh
+  80206a:	74 15                	je     802081 <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80206c:	89 c2                	mov    %eax,%edx
+  80206e:	c1 ea 08             	shr    $0x8,%edx
+  802071:	83 e2 0f             	and    $0xf,%edx
+  802074:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802079:	83 fa 06             	cmp    $0x6,%edx
+  80207c:	74 0e                	je     80208c <sys_shm_detach+0x7b>
+  80207e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802081:	0f b6 c9             	movzbl %cl,%ecx
+  802084:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80208a:	eb 97                	jmp    802023 <sys_shm_detach+0x12>
+  80208c:	89 c2                	mov    %eax,%edx
+  80208e:	c1 ea 04             	shr    $0x4,%edx
+  802091:	83 e2 0f             	and    $0xf,%edx
+  802094:	83 fa 02             	cmp    $0x2,%edx
+  802097:	77 e5                	ja     80207e <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  802099:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80209c:	83 f8 02             	cmp    $0x2,%eax
+  80209f:	0f 97 c1             	seta   %cl
+  8020a2:	0f b6 c9             	movzbl %cl,%ecx
+  8020a5:	eb d7                	jmp    80207e <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  8020a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8020ac:	b8 17 00 00 00       	mov    $0x17,%eax
+  8020b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020b7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8020ba:	89 f7                	mov    %esi,%edi
+  8020bc:	cd 30                	int    $0x30
+  8020be:	eb 8f                	jmp    80204f <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8020c0:	83 ec 0c             	sub    $0xc,%esp
+  8020c3:	50                   	push   %eax
+  8020c4:	6a 17                	push   $0x17
+  8020c6:	68 59 32 80 00       	push   $0x803259
+  8020cb:	6a 4a                	push   $0x4a
+  8020cd:	68 76 32 80 00       	push   $0x803276
+  8020d2:	e8 78 e0 ff ff       	call   80014f <_panic>
+
+008020d7 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  8020d7:	55                   	push   %ebp
+  8020d8:	89 e5                	mov    %esp,%ebp
+  8020da:	57                   	push   %edi
+  8020db:	56                   	push   %esi
+  8020dc:	53                   	push   %ebx
+  8020dd:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8020e0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8020e7:	78 36                	js     80211f <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  8020e9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8020f0:	74 79                	je     80216b <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  8020f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020fa:	b8 18 00 00 00       	mov    $0x18,%eax
+  8020ff:	89 cb                	mov    %ecx,%ebx
+  802101:	89 cf                	mov    %ecx,%edi
+  802103:	89 ce                	mov    %ecx,%esi
+  802105:	55                   	push   %ebp
+  802106:	68 0f 21 80 00       	push   $0x80210f
+  80210b:	89 e5                	mov    %esp,%ebp
+  80210d:	0f 34                	sysenter
+  80210f:	83 c4 04             	add    $0x4,%esp
+  802112:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802113:	85 c0                	test   %eax,%eax
+  802115:	7f 6b                	jg     802182 <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  802117:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80211a:	5b                   	pop    %ebx
+  80211b:	5e                   	pop    %esi
+  80211c:	5f                   	pop    %edi
+  80211d:	5d                   	pop    %ebp
+  80211e:	c3                   	ret
+  80211f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802124:	0f a2                	cpuid
+		return 0;
+  802126:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80212b:	f6 c6 08             	test   $0x8,%dh
+  80212e:	74 15                	je     802145 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802130:	89 c2                	mov    %eax,%edx
+  802132:	c1 ea 08             	shr    $0x8,%edx
+  802135:	83 e2 0f             	and    $0xf,%edx
+  802138:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80213d:	83 fa 06             	cmp    $0x6,%edx
+  802140:	74 0e                	je     802150 <sys_shm_remove+0x79>
+  802142:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802145:	0f b6 c9             	movzbl %cl,%ecx
+  802148:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80214e:	eb 99                	jmp    8020e9 <sys_shm_remove+0x12>
+  802150:	89 c2                	mov    %eax,%edx
+  802152:	c1 ea 04             	shr    $0x4,%edx
+  802155:	83 e2 0f             	and    $0xf,%edx
+  802158:	83 fa 02             	cmp    $0x2,%edx
+  80215b:	77 e5                	ja     802142 <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  80215d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802160:	83 f8 02             	cmp    $0x2,%eax
+  802163:	0f 97 c1             	seta   %cl
+  802166:	0f b6 c9             	movzbl %cl,%ecx
+  802169:	eb d7                	jmp    802142 <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  80216b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802170:	b8 18 00 00 00       	mov    $0x18,%eax
+  802175:	8b 55 08             	mov    0x8(%ebp),%edx
+  802178:	89 cb                	mov    %ecx,%ebx
+  80217a:	89 cf                	mov    %ecx,%edi
+  80217c:	89 ce                	mov    %ecx,%esi
+  80217e:	cd 30                	int    $0x30
+  802180:	eb 91                	jmp    802113 <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802182:	83 ec 0c             	sub    $0xc,%esp
+  802185:	50                   	push   %eax
+  802186:	6a 18                	push   $0x18
+  802188:	68 59 32 80 00       	push   $0x803259
+  80218d:	6a 4a                	push   $0x4a
+  80218f:	68 76 32 80 00       	push   $0x803276
+  802194:	e8 b6 df ff ff       	call   80014f <_panic>
+
+00802199 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  802199:	55                   	push   %ebp
+  80219a:	89 e5                	mov    %esp,%ebp
+  80219c:	57                   	push   %edi
+  80219d:	56                   	push   %esi
+  80219e:	53                   	push   %ebx
+  80219f:	83 ec 0c             	sub    $0xc,%esp
+  8021a2:	8b 45 10             	mov    0x10(%ebp),%eax
+  8021a5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8021a8:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  8021ab:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8021b2:	78 32                	js     8021e6 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  8021b4:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8021bb:	74 75                	je     802232 <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  8021bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021c3:	b8 20 00 00 00       	mov    $0x20,%eax
+  8021c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8021cd:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8021d0:	55                   	push   %ebp
+  8021d1:	68 da 21 80 00       	push   $0x8021da
+  8021d6:	89 e5                	mov    %esp,%ebp
+  8021d8:	0f 34                	sysenter
+  8021da:	83 c4 04             	add    $0x4,%esp
+  8021dd:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  8021de:	83 c4 0c             	add    $0xc,%esp
+  8021e1:	5b                   	pop    %ebx
+  8021e2:	5e                   	pop    %esi
+  8021e3:	5f                   	pop    %edi
+  8021e4:	5d                   	pop    %ebp
+  8021e5:	c3                   	ret
+  8021e6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021eb:	0f a2                	cpuid
+		return 0;
+  8021ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8021f2:	f6 c6 08             	test   $0x8,%dh
+  8021f5:	74 15                	je     80220c <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021f7:	89 c2                	mov    %eax,%edx
+  8021f9:	c1 ea 08             	shr    $0x8,%edx
+  8021fc:	83 e2 0f             	and    $0xf,%edx
+  8021ff:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802204:	83 fa 06             	cmp    $0x6,%edx
+  802207:	74 0e                	je     802217 <sys_futex_wait+0x7e>
+  802209:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80220c:	0f b6 c9             	movzbl %cl,%ecx
+  80220f:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802215:	eb 9d                	jmp    8021b4 <sys_futex_wait+0x1b>
+  802217:	89 c2                	mov    %eax,%edx
+  802219:	c1 ea 04             	shr    $0x4,%edx
+  80221c:	83 e2 0f             	and    $0xf,%edx
+  80221f:	83 fa 02             	cmp    $0x2,%edx
+  802222:	77 e5                	ja     802209 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  802224:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802227:	83 f8 02             	cmp    $0x2,%eax
+  80222a:	0f 97 c1             	seta   %cl
+  80222d:	0f b6 c9             	movzbl %cl,%ecx
+  802230:	eb d7                	jmp    802209 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  802232:	b8 20 00 00 00       	mov    $0x20,%eax
+  802237:	be 00 00 00 00       	mov    $0x0,%esi
+  80223c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80223f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802242:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802245:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  802247:	eb 95                	jmp    8021de <sys_futex_wait+0x45>
+
+00802249 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  802249:	55                   	push   %ebp
+  80224a:	89 e5                	mov    %esp,%ebp
+  80224c:	57                   	push   %edi
+  80224d:	56                   	push   %esi
+  80224e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80224f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802256:	78 30                	js     802288 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  802258:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80225f:	74 73                	je     8022d4 <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  802261:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802266:	8b 55 08             	mov    0x8(%ebp),%edx
+  802269:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80226c:	b8 21 00 00 00       	mov    $0x21,%eax
+  802271:	89 df                	mov    %ebx,%edi
+  802273:	89 de                	mov    %ebx,%esi
+  802275:	55                   	push   %ebp
+  802276:	68 7f 22 80 00       	push   $0x80227f
+  80227b:	89 e5                	mov    %esp,%ebp
+  80227d:	0f 34                	sysenter
+  80227f:	83 c4 04             	add    $0x4,%esp
+  802282:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  802283:	5b                   	pop    %ebx
+  802284:	5e                   	pop    %esi
+  802285:	5f                   	pop    %edi
+  802286:	5d                   	pop    %ebp
+  802287:	c3                   	ret
+  802288:	b8 01 00 00 00       	mov    $0x1,%eax
+  80228d:	0f a2                	cpuid
+		return 0;
+  80228f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802294:	f6 c6 08             	test   $0x8,%dh
+  802297:	74 15                	je     8022ae <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802299:	89 c2                	mov    %eax,%edx
+  80229b:	c1 ea 08             	shr    $0x8,%edx
+  80229e:	83 e2 0f             	and    $0xf,%edx
+  8022a1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8022a6:	83 fa 06             	cmp    $0x6,%edx
+  8022a9:	74 0e                	je     8022b9 <sys_futex_wake+0x70>
+  8022ab:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8022ae:	0f b6 c9             	movzbl %cl,%ecx
+  8022b1:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8022b7:	eb 9f                	jmp    802258 <sys_futex_wake+0xf>
+  8022b9:	89 c2                	mov    %eax,%edx
+  8022bb:	c1 ea 04             	shr    $0x4,%edx
+  8022be:	83 e2 0f             	and    $0xf,%edx
+  8022c1:	83 fa 02             	cmp    $0x2,%edx
+  8022c4:	77 e5                	ja     8022ab <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  8022c6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022c9:	83 f8 02             	cmp    $0x2,%eax
+  8022cc:	0f 97 c1             	seta   %cl
+  8022cf:	0f b6 c9             	movzbl %cl,%ecx
+  8022d2:	eb d7                	jmp    8022ab <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  8022d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022d9:	b8 21 00 00 00       	mov    $0x21,%eax
+  8022de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022e4:	89 df                	mov    %ebx,%edi
+  8022e6:	89 de                	mov    %ebx,%esi
+  8022e8:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  8022ea:	eb 97                	jmp    802283 <sys_futex_wake+0x3a>
+
+008022ec <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  8022ec:	55                   	push   %ebp
+  8022ed:	89 e5                	mov    %esp,%ebp
+  8022ef:	57                   	push   %edi
+  8022f0:	56                   	push   %esi
+  8022f1:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8022f2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8022f9:	78 2e                	js     802329 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  8022fb:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802302:	74 71                	je     802375 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  802304:	ba 00 00 00 00       	mov    $0x0,%edx
+  802309:	b8 22 00 00 00       	mov    $0x22,%eax
+  80230e:	89 d1                	mov    %edx,%ecx
+  802310:	89 d3                	mov    %edx,%ebx
+  802312:	89 d7                	mov    %edx,%edi
+  802314:	89 d6                	mov    %edx,%esi
+  802316:	55                   	push   %ebp
+  802317:	68 20 23 80 00       	push   $0x802320
+  80231c:	89 e5                	mov    %esp,%ebp
+  80231e:	0f 34                	sysenter
+  802320:	83 c4 04             	add    $0x4,%esp
+  802323:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  802324:	5b                   	pop    %ebx
+  802325:	5e                   	pop    %esi
+  802326:	5f                   	pop    %edi
+  802327:	5d                   	pop    %ebp
+  802328:	c3                   	ret
+  802329:	b8 01 00 00 00       	mov    $0x1,%eax
+  80232e:	0f a2                	cpuid
+		return 0;
+  802330:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802335:	f6 c6 08             	test   $0x8,%dh
+  802338:	74 15                	je     80234f <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80233a:	89 c2                	mov    %eax,%edx
+  80233c:	c1 ea 08             	shr    $0x8,%edx
+  80233f:	83 e2 0f             	and    $0xf,%edx
+  802342:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802347:	83 fa 06             	cmp    $0x6,%edx
+  80234a:	74 0e                	je     80235a <sys_ep_create+0x6e>
+  80234c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80234f:	0f b6 c9             	movzbl %cl,%ecx
+  802352:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802358:	eb a1                	jmp    8022fb <sys_ep_create+0xf>
+  80235a:	89 c2                	mov    %eax,%edx
+  80235c:	c1 ea 04             	shr    $0x4,%edx
+  80235f:	83 e2 0f             	and    $0xf,%edx
+  802362:	83 fa 02             	cmp    $0x2,%edx
+  802365:	77 e5                	ja     80234c <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  802367:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80236a:	83 f8 02             	cmp    $0x2,%eax
+  80236d:	0f 97 c1             	seta   %cl
+  802370:	0f b6 c9             	movzbl %cl,%ecx
+  802373:	eb d7                	jmp    80234c <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  802375:	ba 00 00 00 00       	mov    $0x0,%edx
+  80237a:	b8 22 00 00 00       	mov    $0x22,%eax
+  80237f:	89 d1                	mov    %edx,%ecx
+  802381:	89 d3                	mov    %edx,%ebx
+  802383:	89 d7                	mov    %edx,%edi
+  802385:	89 d6                	mov    %edx,%esi
+  802387:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  802389:	eb 99                	jmp    802324 <sys_ep_create+0x38>
+
+0080238b <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  80238b:	55                   	push   %ebp
+  80238c:	89 e5                	mov    %esp,%ebp
+  80238e:	57                   	push   %edi
+  80238f:	56                   	push   %esi
+  802390:	53                   	push   %ebx
+  802391:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802394:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80239b:	78 36                	js     8023d3 <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  80239d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8023a4:	74 79                	je     80241f <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  8023a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023ae:	b8 23 00 00 00       	mov    $0x23,%eax
+  8023b3:	89 cb                	mov    %ecx,%ebx
+  8023b5:	89 cf                	mov    %ecx,%edi
+  8023b7:	89 ce                	mov    %ecx,%esi
+  8023b9:	55                   	push   %ebp
+  8023ba:	68 c3 23 80 00       	push   $0x8023c3
+  8023bf:	89 e5                	mov    %esp,%ebp
+  8023c1:	0f 34                	sysenter
+  8023c3:	83 c4 04             	add    $0x4,%esp
+  8023c6:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8023c7:	85 c0                	test   %eax,%eax
+  8023c9:	7f 6b                	jg     802436 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  8023cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023ce:	5b                   	pop    %ebx
+  8023cf:	5e                   	pop    %esi
+  8023d0:	5f                   	pop    %edi
+  8023d1:	5d                   	pop    %ebp
+  8023d2:	c3                   	ret
+  8023d3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023d8:	0f a2                	cpuid
+		return 0;
+  8023da:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8023df:	f6 c6 08             	test   $0x8,%dh
+  8023e2:	74 15                	je     8023f9 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023e4:	89 c2                	mov    %eax,%edx
+  8023e6:	c1 ea 08             	shr    $0x8,%edx
+  8023e9:	83 e2 0f             	and    $0xf,%edx
+  8023ec:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8023f1:	83 fa 06             	cmp    $0x6,%edx
+  8023f4:	74 0e                	je     802404 <sys_ep_destroy+0x79>
+  8023f6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8023f9:	0f b6 c9             	movzbl %cl,%ecx
+  8023fc:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802402:	eb 99                	jmp    80239d <sys_ep_destroy+0x12>
+  802404:	89 c2                	mov    %eax,%edx
+  802406:	c1 ea 04             	shr    $0x4,%edx
+  802409:	83 e2 0f             	and    $0xf,%edx
+  80240c:	83 fa 02             	cmp    $0x2,%edx
+  80240f:	77 e5                	ja     8023f6 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  802411:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802414:	83 f8 02             	cmp    $0x2,%eax
+  802417:	0f 97 c1             	seta   %cl
+  80241a:	0f b6 c9             	movzbl %cl,%ecx
+  80241d:	eb d7                	jmp    8023f6 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  80241f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802424:	b8 23 00 00 00       	mov    $0x23,%eax
+  802429:	8b 55 08             	mov    0x8(%ebp),%edx
+  80242c:	89 cb                	mov    %ecx,%ebx
+  80242e:	89 cf                	mov    %ecx,%edi
+  802430:	89 ce                	mov    %ecx,%esi
+  802432:	cd 30                	int    $0x30
+  802434:	eb 91                	jmp    8023c7 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802436:	83 ec 0c             	sub    $0xc,%esp
+  802439:	50                   	push   %eax
+  80243a:	6a 23                	push   $0x23
+  80243c:	68 59 32 80 00       	push   $0x803259
+  802441:	6a 4a                	push   $0x4a
+  802443:	68 76 32 80 00       	push   $0x803276
+  802448:	e8 02 dd ff ff       	call   80014f <_panic>
+
+0080244d <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  80244d:	55                   	push   %ebp
+  80244e:	89 e5                	mov    %esp,%ebp
+  802450:	57                   	push   %edi
+  802451:	56                   	push   %esi
+  802452:	53                   	push   %ebx
+  802453:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802456:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80245d:	78 37                	js     802496 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  80245f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802466:	74 7a                	je     8024e2 <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  802468:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80246d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802470:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802473:	b8 24 00 00 00       	mov    $0x24,%eax
+  802478:	89 df                	mov    %ebx,%edi
+  80247a:	89 de                	mov    %ebx,%esi
+  80247c:	55                   	push   %ebp
+  80247d:	68 86 24 80 00       	push   $0x802486
+  802482:	89 e5                	mov    %esp,%ebp
+  802484:	0f 34                	sysenter
+  802486:	83 c4 04             	add    $0x4,%esp
+  802489:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80248a:	85 c0                	test   %eax,%eax
+  80248c:	7f 6c                	jg     8024fa <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  80248e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802491:	5b                   	pop    %ebx
+  802492:	5e                   	pop    %esi
+  802493:	5f                   	pop    %edi
+  802494:	5d                   	pop    %ebp
+  802495:	c3                   	ret
+  802496:	b8 01 00 00 00       	mov    $0x1,%eax
+  80249b:	0f a2                	cpuid
+		return 0;
+  80249d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8024a2:	f6 c6 08             	test   $0x8,%dh
+  8024a5:	74 15                	je     8024bc <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8024a7:	89 c2                	mov    %eax,%edx
+  8024a9:	c1 ea 08             	shr    $0x8,%edx
+  8024ac:	83 e2 0f             	and    $0xf,%edx
+  8024af:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8024b4:	83 fa 06             	cmp    $0x6,%edx
+  8024b7:	74 0e                	je     8024c7 <sys_ep_grant+0x7a>
+  8024b9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8024bc:	0f b6 c9             	movzbl %cl,%ecx
+  8024bf:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8024c5:	eb 98                	jmp    80245f <sys_ep_grant+0x12>
+  8024c7:	89 c2                	mov    %eax,%edx
+  8024c9:	c1 ea 04             	shr    $0x4,%edx
+  8024cc:	83 e2 0f             	and    $0xf,%edx
+  8024cf:	83 fa 02             	cmp    $0x2,%edx
+  8024d2:	77 e5                	ja     8024b9 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  8024d4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8024d7:	83 f8 02             	cmp    $0x2,%eax
+  8024da:	0f 97 c1             	seta   %cl
+  8024dd:	0f b6 c9             	movzbl %cl,%ecx
+  8024e0:	eb d7                	jmp    8024b9 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  8024e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024e7:	b8 24 00 00 00       	mov    $0x24,%eax
+  8024ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024f2:	89 df                	mov    %ebx,%edi
+  8024f4:	89 de                	mov    %ebx,%esi
+  8024f6:	cd 30                	int    $0x30
+  8024f8:	eb 90                	jmp    80248a <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8024fa:	83 ec 0c             	sub    $0xc,%esp
+  8024fd:	50                   	push   %eax
+  8024fe:	6a 24                	push   $0x24
+  802500:	68 59 32 80 00       	push   $0x803259
+  802505:	6a 4a                	push   $0x4a
+  802507:	68 76 32 80 00       	push   $0x803276
+  80250c:	e8 3e dc ff ff       	call   80014f <_panic>
+
+00802511 <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  802511:	55                   	push   %ebp
+  802512:	89 e5                	mov    %esp,%ebp
+  802514:	57                   	push   %edi
+  802515:	56                   	push   %esi
+  802516:	53                   	push   %ebx
+  802517:	83 ec 20             	sub    $0x20,%esp
+  80251a:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  80251d:	8b 10                	mov    (%eax),%edx
+  80251f:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802522:	8b 50 04             	mov    0x4(%eax),%edx
+  802525:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802528:	8b 50 08             	mov    0x8(%eax),%edx
+  80252b:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  80252e:	8b 50 0c             	mov    0xc(%eax),%edx
+  802531:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  802534:	8b 40 10             	mov    0x10(%eax),%eax
+  802537:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  80253a:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  80253d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802540:	b8 25 00 00 00       	mov    $0x25,%eax
+  802545:	55                   	push   %ebp
+  802546:	56                   	push   %esi
+  802547:	8b 0e                	mov    (%esi),%ecx
+  802549:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80254c:	8b 7e 08             	mov    0x8(%esi),%edi
+  80254f:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802552:	8b 76 0c             	mov    0xc(%esi),%esi
+  802555:	cd 30                	int    $0x30
+  802557:	87 34 24             	xchg   %esi,(%esp)
+  80255a:	89 0e                	mov    %ecx,(%esi)
+  80255c:	89 5e 04             	mov    %ebx,0x4(%esi)
+  80255f:	89 7e 08             	mov    %edi,0x8(%esi)
+  802562:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802565:	8f 46 0c             	pop    0xc(%esi)
+  802568:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  802569:	83 c4 20             	add    $0x20,%esp
+  80256c:	5b                   	pop    %ebx
+  80256d:	5e                   	pop    %esi
+  80256e:	5f                   	pop    %edi
+  80256f:	5d                   	pop    %ebp
+  802570:	c3                   	ret
+
+00802571 <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  802571:	55                   	push   %ebp
+  802572:	89 e5                	mov    %esp,%ebp
+  802574:	57                   	push   %edi
+  802575:	56                   	push   %esi
+  802576:	53                   	push   %ebx
+  802577:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  80257a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80257d:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  80257f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802582:	b8 26 00 00 00       	mov    $0x26,%eax
+  802587:	55                   	push   %ebp
+  802588:	56                   	push   %esi
+  802589:	8b 0e                	mov    (%esi),%ecx
+  80258b:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80258e:	8b 7e 08             	mov    0x8(%esi),%edi
+  802591:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802594:	8b 76 0c             	mov    0xc(%esi),%esi
+  802597:	cd 30                	int    $0x30
+  802599:	87 34 24             	xchg   %esi,(%esp)
+  80259c:	89 0e                	mov    %ecx,(%esi)
+  80259e:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8025a1:	89 7e 08             	mov    %edi,0x8(%esi)
+  8025a4:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8025a7:	8f 46 0c             	pop    0xc(%esi)
+  8025aa:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  8025ab:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  8025af:	74 0f                	je     8025c0 <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  8025b1:	85 c0                	test   %eax,%eax
+  8025b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025b8:	0f 48 d1             	cmovs  %ecx,%edx
+  8025bb:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8025be:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  8025c0:	5b                   	pop    %ebx
+  8025c1:	5e                   	pop    %esi
+  8025c2:	5f                   	pop    %edi
+  8025c3:	5d                   	pop    %ebp
+  8025c4:	c3                   	ret
+
+008025c5 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  8025c5:	55                   	push   %ebp
+  8025c6:	89 e5                	mov    %esp,%ebp
+  8025c8:	57                   	push   %edi
+  8025c9:	56                   	push   %esi
+  8025ca:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8025cb:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8025d2:	78 2f                	js     802603 <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  8025d4:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8025db:	74 72                	je     80264f <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  8025dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025e5:	b8 27 00 00 00       	mov    $0x27,%eax
+  8025ea:	89 cb                	mov    %ecx,%ebx
+  8025ec:	89 cf                	mov    %ecx,%edi
+  8025ee:	89 ce                	mov    %ecx,%esi
+  8025f0:	55                   	push   %ebp
+  8025f1:	68 fa 25 80 00       	push   $0x8025fa
+  8025f6:	89 e5                	mov    %esp,%ebp
+  8025f8:	0f 34                	sysenter
+  8025fa:	83 c4 04             	add    $0x4,%esp
+  8025fd:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  8025fe:	5b                   	pop    %ebx
+  8025ff:	5e                   	pop    %esi
+  802600:	5f                   	pop    %edi
+  802601:	5d                   	pop    %ebp
+  802602:	c3                   	ret
+  802603:	b8 01 00 00 00       	mov    $0x1,%eax
+  802608:	0f a2                	cpuid
+		return 0;
+  80260a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80260f:	f6 c6 08             	test   $0x8,%dh
+  802612:	74 15                	je     802629 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802614:	89 c2                	mov    %eax,%edx
+  802616:	c1 ea 08             	shr    $0x8,%edx
+  802619:	83 e2 0f             	and    $0xf,%edx
+  80261c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802621:	83 fa 06             	cmp    $0x6,%edx
+  802624:	74 0e                	je     802634 <sys_sysring_setup+0x6f>
+  802626:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802629:	0f b6 c9             	movzbl %cl,%ecx
+  80262c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802632:	eb a0                	jmp    8025d4 <sys_sysring_setup+0xf>
+  802634:	89 c2                	mov    %eax,%edx
+  802636:	c1 ea 04             	shr    $0x4,%edx
+  802639:	83 e2 0f             	and    $0xf,%edx
+  80263c:	83 fa 02             	cmp    $0x2,%edx
+  80263f:	77 e5                	ja     802626 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  802641:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802644:	83 f8 02             	cmp    $0x2,%eax
+  802647:	0f 97 c1             	seta   %cl
+  80264a:	0f b6 c9             	movzbl %cl,%ecx
+  80264d:	eb d7                	jmp    802626 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  80264f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802654:	b8 27 00 00 00       	mov    $0x27,%eax
+  802659:	8b 55 08             	mov    0x8(%ebp),%edx
+  80265c:	89 cb                	mov    %ecx,%ebx
+  80265e:	89 cf                	mov    %ecx,%edi
+  802660:	89 ce                	mov    %ecx,%esi
+  802662:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  802664:	eb 98                	jmp    8025fe <sys_sysring_setup+0x39>
+
+00802666 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  802666:	55                   	push   %ebp
+  802667:	89 e5                	mov    %esp,%ebp
+  802669:	57                   	push   %edi
+  80266a:	56                   	push   %esi
+  80266b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80266c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802673:	78 2e                	js     8026a3 <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  802675:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80267c:	74 71                	je     8026ef <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  80267e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802683:	b8 28 00 00 00       	mov    $0x28,%eax
+  802688:	89 d1                	mov    %edx,%ecx
+  80268a:	89 d3                	mov    %edx,%ebx
+  80268c:	89 d7                	mov    %edx,%edi
+  80268e:	89 d6                	mov    %edx,%esi
+  802690:	55                   	push   %ebp
+  802691:	68 9a 26 80 00       	push   $0x80269a
+  802696:	89 e5                	mov    %esp,%ebp
+  802698:	0f 34                	sysenter
+  80269a:	83 c4 04             	add    $0x4,%esp
+  80269d:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  80269e:	5b                   	pop    %ebx
+  80269f:	5e                   	pop    %esi
+  8026a0:	5f                   	pop    %edi
+  8026a1:	5d                   	pop    %ebp
+  8026a2:	c3                   	ret
+  8026a3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026a8:	0f a2                	cpuid
+		return 0;
+  8026aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8026af:	f6 c6 08             	test   $0x8,%dh
+  8026b2:	74 15                	je     8026c9 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8026b4:	89 c2                	mov    %eax,%edx
+  8026b6:	c1 ea 08             	shr    $0x8,%edx
+  8026b9:	83 e2 0f             	and    $0xf,%edx
+  8026bc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8026c1:	83 fa 06             	cmp    $0x6,%edx
+  8026c4:	74 0e                	je     8026d4 <sys_sysring_enter+0x6e>
+  8026c6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8026c9:	0f b6 c9             	movzbl %cl,%ecx
+  8026cc:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8026d2:	eb a1                	jmp    802675 <sys_sysring_enter+0xf>
+  8026d4:	89 c2                	mov    %eax,%edx
+  8026d6:	c1 ea 04             	shr    $0x4,%edx
+  8026d9:	83 e2 0f             	and    $0xf,%edx
+  8026dc:	83 fa 02             	cmp    $0x2,%edx
+  8026df:	77 e5                	ja     8026c6 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  8026e1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8026e4:	83 f8 02             	cmp    $0x2,%eax
+  8026e7:	0f 97 c1             	seta   %cl
+  8026ea:	0f b6 c9             	movzbl %cl,%ecx
+  8026ed:	eb d7                	jmp    8026c6 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  8026ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026f4:	b8 28 00 00 00       	mov    $0x28,%eax
+  8026f9:	89 d1                	mov    %edx,%ecx
+  8026fb:	89 d3                	mov    %edx,%ebx
+  8026fd:	89 d7                	mov    %edx,%edi
+  8026ff:	89 d6                	mov    %edx,%esi
+  802701:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  802703:	eb 99                	jmp    80269e <sys_sysring_enter+0x38>
+
+00802705 <pgfault>:
+// The kernel normally resolves these faults itself (page_fault_cow in
+// kern/trap.c); we only get here if it ran out of memory doing so.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802705:	55                   	push   %ebp
+  802706:	89 e5                	mov    %esp,%ebp
+  802708:	83 ec 08             	sub    $0x8,%esp
+  80270b:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  80270e:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  802710:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  802713:	f6 c2 02             	test   $0x2,%dl
+  802716:	74 40                	je     802758 <pgfault+0x53>
+  802718:	89 c1                	mov    %eax,%ecx
+  80271a:	c1 e9 16             	shr    $0x16,%ecx
+  80271d:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802724:	f6 c1 01             	test   $0x1,%cl
+  802727:	74 2f                	je     802758 <pgfault+0x53>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW))
+  802729:	89 c1                	mov    %eax,%ecx
+  80272b:	c1 e9 0c             	shr    $0xc,%ecx
+  80272e:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  802735:	f6 c5 08             	test   $0x8,%ch
+  802738:	74 1e                	je     802758 <pgfault+0x53>
+	// Replace the page with a private writable copy of itself.  The
+	// kernel allocates, copies and maps it in one system call, so no
+	// temporary mapping at PFTEMP is needed.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  80273a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r = sys_page_copy(0, addr, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  80273f:	83 ec 0c             	sub    $0xc,%esp
+  802742:	6a 07                	push   $0x7
+  802744:	50                   	push   %eax
+  802745:	6a 00                	push   $0x0
+  802747:	50                   	push   %eax
+  802748:	6a 00                	push   $0x0
+  80274a:	e8 85 eb ff ff       	call   8012d4 <sys_page_copy>
+  80274f:	83 c4 20             	add    $0x20,%esp
+  802752:	85 c0                	test   %eax,%eax
+  802754:	78 18                	js     80276e <pgfault+0x69>
+		panic("pgfault: sys_page_copy: %e", r);
+}
+  802756:	c9                   	leave
+  802757:	c3                   	ret
+		panic("pgfault: va %08x err %x is not a copy-on-write write",
+  802758:	83 ec 0c             	sub    $0xc,%esp
+  80275b:	52                   	push   %edx
+  80275c:	50                   	push   %eax
+  80275d:	68 84 32 80 00       	push   $0x803284
+  802762:	6a 1c                	push   $0x1c
+  802764:	68 b9 32 80 00       	push   $0x8032b9
+  802769:	e8 e1 d9 ff ff       	call   80014f <_panic>
+		panic("pgfault: sys_page_copy: %e", r);
+  80276e:	50                   	push   %eax
+  80276f:	68 c4 32 80 00       	push   $0x8032c4
+  802774:	6a 26                	push   $0x26
+  802776:	68 b9 32 80 00       	push   $0x8032b9
+  80277b:	e8 cf d9 ff ff       	call   80014f <_panic>
+
+00802780 <ufork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+ufork(void)
+{
+  802780:	55                   	push   %ebp
+  802781:	89 e5                	mov    %esp,%ebp
+  802783:	57                   	push   %edi
+  802784:	56                   	push   %esi
+  802785:	53                   	push   %ebx
+  802786:	81 ec 38 04 00 00    	sub    $0x438,%esp
+	struct page_range vec[PAGE_VEC_MAX], *last;
+	uintptr_t va;
+	size_t n;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  80278c:	68 05 27 80 00       	push   $0x802705
+  802791:	e8 03 05 00 00       	call   802c99 <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  802796:	b8 07 00 00 00       	mov    $0x7,%eax
+  80279b:	cd 30                	int    $0x30
+  80279d:	89 85 d4 fb ff ff    	mov    %eax,-0x42c(%ebp)
+
+	envid = sys_exofork();
+	if (envid < 0)
+  8027a3:	83 c4 10             	add    $0x10,%esp
+  8027a6:	85 c0                	test   %eax,%eax
+  8027a8:	0f 88 f2 01 00 00    	js     8029a0 <ufork+0x220>
+		return 0;
+	}
+
+	// Copy every run of mapped pages below the exception stack, which
+	// must not be shared.
+	va = 0;
+  8027ae:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  8027b3:	74 0b                	je     8027c0 <ufork+0x40>
+  8027b5:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  8027bb:	e9 07 01 00 00       	jmp    8028c7 <ufork+0x147>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8027c0:	e8 22 e8 ff ff       	call   800fe7 <sys_getenvid>
+  8027c5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8027ca:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  8027d0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8027d5:	a3 08 40 80 00       	mov    %eax,0x804008
+		return 0;
+  8027da:	e9 c1 01 00 00       	jmp    8029a0 <ufork+0x220>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+		n = r;
+		last = &vec[n - 1];
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  8027df:	83 ea 01             	sub    $0x1,%edx
+  8027e2:	89 c1                	mov    %eax,%ecx
+  8027e4:	c1 e1 04             	shl    $0x4,%ecx
+  8027e7:	89 94 0d ec fd ff ff 	mov    %edx,-0x214(%ebp,%ecx,1)
+			n--;
+  8027ee:	85 d2                	test   %edx,%edx
+  8027f0:	0f 44 f0             	cmove  %eax,%esi
+  8027f3:	e9 12 01 00 00       	jmp    80290a <ufork+0x18a>
+	for (i = 0; i < n; i++) {
+  8027f8:	83 c1 01             	add    $0x1,%ecx
+  8027fb:	83 c0 10             	add    $0x10,%eax
+  8027fe:	39 8d e4 fb ff ff    	cmp    %ecx,-0x41c(%ebp)
+  802804:	74 6a                	je     802870 <ufork+0xf0>
+		vec[i].pr_dstva = vec[i].pr_va;
+  802806:	89 c3                	mov    %eax,%ebx
+  802808:	8b 10                	mov    (%eax),%edx
+  80280a:	89 50 0c             	mov    %edx,0xc(%eax)
+		if (vec[i].pr_perm & PTE_SHARE)
+  80280d:	8b 50 08             	mov    0x8(%eax),%edx
+  802810:	f6 c6 04             	test   $0x4,%dh
+  802813:	75 e3                	jne    8027f8 <ufork+0x78>
+		if (vec[i].pr_perm & (PTE_W | PTE_COW)) {
+  802815:	f7 c2 02 08 00 00    	test   $0x802,%edx
+  80281b:	74 db                	je     8027f8 <ufork+0x78>
+			vec[i].pr_perm = (vec[i].pr_perm & ~PTE_W) | PTE_COW;
+  80281d:	81 e2 fd f7 ff ff    	and    $0xfffff7fd,%edx
+  802823:	80 ce 08             	or     $0x8,%dh
+  802826:	89 95 dc fb ff ff    	mov    %edx,-0x424(%ebp)
+  80282c:	89 53 08             	mov    %edx,0x8(%ebx)
+			cow[ncow++] = vec[i];
+  80282f:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  802835:	c1 e6 04             	shl    $0x4,%esi
+  802838:	89 f2                	mov    %esi,%edx
+  80283a:	8d b4 35 e8 fb ff ff 	lea    -0x418(%ebp,%esi,1),%esi
+  802841:	8b 38                	mov    (%eax),%edi
+  802843:	89 bc 15 e8 fb ff ff 	mov    %edi,-0x418(%ebp,%edx,1)
+  80284a:	8b 78 04             	mov    0x4(%eax),%edi
+  80284d:	89 7e 04             	mov    %edi,0x4(%esi)
+  802850:	8b bd dc fb ff ff    	mov    -0x424(%ebp),%edi
+  802856:	89 7e 08             	mov    %edi,0x8(%esi)
+  802859:	8b 50 0c             	mov    0xc(%eax),%edx
+  80285c:	89 56 0c             	mov    %edx,0xc(%esi)
+  80285f:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  802865:	8d 7e 01             	lea    0x1(%esi),%edi
+  802868:	89 bd e0 fb ff ff    	mov    %edi,-0x420(%ebp)
+  80286e:	eb 88                	jmp    8027f8 <ufork+0x78>
+	if ((r = sys_page_map_vec(0, envid, vec, n, 0)) < 0)
+  802870:	8b b5 e4 fb ff ff    	mov    -0x41c(%ebp),%esi
+  802876:	8b bd d8 fb ff ff    	mov    -0x428(%ebp),%edi
+  80287c:	83 ec 0c             	sub    $0xc,%esp
+  80287f:	6a 00                	push   $0x0
+  802881:	56                   	push   %esi
+  802882:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802888:	50                   	push   %eax
+  802889:	ff b5 d4 fb ff ff    	push   -0x42c(%ebp)
+  80288f:	6a 00                	push   $0x0
+  802891:	e8 80 f4 ff ff       	call   801d16 <sys_page_map_vec>
+  802896:	83 c4 20             	add    $0x20,%esp
+  802899:	85 c0                	test   %eax,%eax
+  80289b:	0f 88 e5 00 00 00    	js     802986 <ufork+0x206>
+	return sys_page_map_vec(0, 0, cow, ncow, 0);
+  8028a1:	83 ec 0c             	sub    $0xc,%esp
+  8028a4:	6a 00                	push   $0x0
+  8028a6:	ff b5 e0 fb ff ff    	push   -0x420(%ebp)
+  8028ac:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  8028b2:	50                   	push   %eax
+  8028b3:	6a 00                	push   $0x0
+  8028b5:	6a 00                	push   $0x0
+  8028b7:	e8 5a f4 ff ff       	call   801d16 <sys_page_map_vec>
+		if ((r = duppages(envid, vec, n)) < 0)
+  8028bc:	83 c4 20             	add    $0x20,%esp
+  8028bf:	85 c0                	test   %eax,%eax
+  8028c1:	0f 88 e7 00 00 00    	js     8029ae <ufork+0x22e>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+  8028c7:	6a 20                	push   $0x20
+  8028c9:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  8028cf:	50                   	push   %eax
+  8028d0:	57                   	push   %edi
+  8028d1:	6a 00                	push   $0x0
+  8028d3:	e8 82 f4 ff ff       	call   801d5a <sys_vm_ranges>
+  8028d8:	83 c4 10             	add    $0x10,%esp
+  8028db:	85 c0                	test   %eax,%eax
+  8028dd:	7e 51                	jle    802930 <ufork+0x1b0>
+		n = r;
+  8028df:	89 c6                	mov    %eax,%esi
+		last = &vec[n - 1];
+  8028e1:	83 e8 01             	sub    $0x1,%eax
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+  8028e4:	89 c1                	mov    %eax,%ecx
+  8028e6:	c1 e1 04             	shl    $0x4,%ecx
+  8028e9:	8b 94 0d ec fd ff ff 	mov    -0x214(%ebp,%ecx,1),%edx
+  8028f0:	89 d3                	mov    %edx,%ebx
+  8028f2:	c1 e3 0c             	shl    $0xc,%ebx
+  8028f5:	89 df                	mov    %ebx,%edi
+  8028f7:	03 bc 0d e8 fd ff ff 	add    -0x218(%ebp,%ecx,1),%edi
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  8028fe:	81 ff 00 00 c0 ee    	cmp    $0xeec00000,%edi
+  802904:	0f 84 d5 fe ff ff    	je     8027df <ufork+0x5f>
+	for (i = 0; i < n; i++) {
+  80290a:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+	size_t i, ncow = 0;
+  802910:	c7 85 e0 fb ff ff 00 	movl   $0x0,-0x420(%ebp)
+  802917:	00 00 00 
+	for (i = 0; i < n; i++) {
+  80291a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80291f:	89 bd d8 fb ff ff    	mov    %edi,-0x428(%ebp)
+  802925:	89 b5 e4 fb ff ff    	mov    %esi,-0x41c(%ebp)
+  80292b:	e9 ce fe ff ff       	jmp    8027fe <ufork+0x7e>
+			goto fail;
+	}
+	if (r < 0)
+  802930:	89 c6                	mov    %eax,%esi
+  802932:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  802938:	85 c0                	test   %eax,%eax
+  80293a:	78 52                	js     80298e <ufork+0x20e>
+		goto fail;
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE),
+  80293c:	83 ec 04             	sub    $0x4,%esp
+  80293f:	6a 07                	push   $0x7
+  802941:	68 00 f0 bf ee       	push   $0xeebff000
+  802946:	53                   	push   %ebx
+  802947:	e8 3a e7 ff ff       	call   801086 <sys_page_alloc>
+  80294c:	89 c6                	mov    %eax,%esi
+  80294e:	83 c4 10             	add    $0x10,%esp
+  802951:	85 c0                	test   %eax,%eax
+  802953:	78 39                	js     80298e <ufork+0x20e>
+				PTE_P | PTE_U | PTE_W)) < 0
+	    || (r = sys_env_set_pgfault_upcall(envid,
+			thisenv->env_pgfault_upcall)) < 0
+  802955:	a1 08 40 80 00       	mov    0x804008,%eax
+  80295a:	8b 40 74             	mov    0x74(%eax),%eax
+	    || (r = sys_env_set_pgfault_upcall(envid,
+  80295d:	83 ec 08             	sub    $0x8,%esp
+  802960:	50                   	push   %eax
+  802961:	53                   	push   %ebx
+  802962:	e8 de ed ff ff       	call   801745 <sys_env_set_pgfault_upcall>
+  802967:	89 c6                	mov    %eax,%esi
+  802969:	83 c4 10             	add    $0x10,%esp
+  80296c:	85 c0                	test   %eax,%eax
+  80296e:	78 1e                	js     80298e <ufork+0x20e>
+	    || (r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  802970:	83 ec 08             	sub    $0x8,%esp
+  802973:	6a 02                	push   $0x2
+  802975:	53                   	push   %ebx
+  802976:	e8 bc ea ff ff       	call   801437 <sys_env_set_status>
+  80297b:	89 c6                	mov    %eax,%esi
+  80297d:	83 c4 10             	add    $0x10,%esp
+  802980:	85 c0                	test   %eax,%eax
+  802982:	79 1c                	jns    8029a0 <ufork+0x220>
+  802984:	eb 08                	jmp    80298e <ufork+0x20e>
+  802986:	89 c6                	mov    %eax,%esi
+  802988:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+		goto fail;
+	return envid;
+
+fail:
+	sys_env_destroy(envid);
+  80298e:	83 ec 0c             	sub    $0xc,%esp
+  802991:	53                   	push   %ebx
+  802992:	e8 8e e5 ff ff       	call   800f25 <sys_env_destroy>
+	return r;
+  802997:	83 c4 10             	add    $0x10,%esp
+  80299a:	89 b5 d4 fb ff ff    	mov    %esi,-0x42c(%ebp)
+}
+  8029a0:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+  8029a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029a9:	5b                   	pop    %ebx
+  8029aa:	5e                   	pop    %esi
+  8029ab:	5f                   	pop    %edi
+  8029ac:	5d                   	pop    %ebp
+  8029ad:	c3                   	ret
+  8029ae:	89 c6                	mov    %eax,%esi
+  8029b0:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  8029b6:	eb d6                	jmp    80298e <ufork+0x20e>
+
+008029b8 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  8029b8:	55                   	push   %ebp
+  8029b9:	89 e5                	mov    %esp,%ebp
+  8029bb:	53                   	push   %ebx
+  8029bc:	83 ec 04             	sub    $0x4,%esp
+	envid_t envid;
+
+	envid = sys_fork();
+  8029bf:	e8 90 f2 ff ff       	call   801c54 <sys_fork>
+  8029c4:	89 c3                	mov    %eax,%ebx
+	if (envid == 0)
+  8029c6:	85 c0                	test   %eax,%eax
+  8029c8:	74 07                	je     8029d1 <fork+0x19>
+		thisenv = &envs[ENVX(sys_getenvid())];
+	return envid;
+}
+  8029ca:	89 d8                	mov    %ebx,%eax
+  8029cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029cf:	c9                   	leave
+  8029d0:	c3                   	ret
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8029d1:	e8 11 e6 ff ff       	call   800fe7 <sys_getenvid>
+  8029d6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8029db:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  8029e1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8029e6:	a3 08 40 80 00       	mov    %eax,0x804008
+	return envid;
+  8029eb:	eb dd                	jmp    8029ca <fork+0x12>
+
+008029ed <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8029ed:	55                   	push   %ebp
+  8029ee:	89 e5                	mov    %esp,%ebp
+  8029f0:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  8029f3:	68 df 32 80 00       	push   $0x8032df
+  8029f8:	68 a1 00 00 00       	push   $0xa1
+  8029fd:	68 b9 32 80 00       	push   $0x8032b9
+  802a02:	e8 48 d7 ff ff       	call   80014f <_panic>
+
+00802a07 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802a07:	55                   	push   %ebp
+  802a08:	89 e5                	mov    %esp,%ebp
+  802a0a:	56                   	push   %esi
+  802a0b:	53                   	push   %ebx
+  802a0c:	8b 75 08             	mov    0x8(%ebp),%esi
+  802a0f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a12:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if ((r = sys_ipc_recv(pg ? pg : (void *) UTOP)) < 0) {
+  802a15:	85 c0                	test   %eax,%eax
+  802a17:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802a1c:	0f 44 c2             	cmove  %edx,%eax
+  802a1f:	83 ec 0c             	sub    $0xc,%esp
+  802a22:	50                   	push   %eax
+  802a23:	e8 2f ef ff ff       	call   801957 <sys_ipc_recv>
+  802a28:	83 c4 10             	add    $0x10,%esp
+  802a2b:	85 c0                	test   %eax,%eax
+  802a2d:	78 34                	js     802a63 <ipc_recv+0x5c>
+			*from_env_store = 0;
+		if (perm_store)
+			*perm_store = 0;
+		return r;
+	}
+	if (from_env_store)
+  802a2f:	85 f6                	test   %esi,%esi
+  802a31:	74 0d                	je     802a40 <ipc_recv+0x39>
+		*from_env_store = thisenv->env_ipc_from;
+  802a33:	a1 08 40 80 00       	mov    0x804008,%eax
+  802a38:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  802a3e:	89 06                	mov    %eax,(%esi)
+	if (perm_store)
+  802a40:	85 db                	test   %ebx,%ebx
+  802a42:	74 0d                	je     802a51 <ipc_recv+0x4a>
+		*perm_store = thisenv->env_ipc_perm;
+  802a44:	a1 08 40 80 00       	mov    0x804008,%eax
+  802a49:	8b 80 9c 00 00 00    	mov    0x9c(%eax),%eax
+  802a4f:	89 03                	mov    %eax,(%ebx)
+	return thisenv->env_ipc_msg.m_w[0];
+  802a51:	a1 08 40 80 00       	mov    0x804008,%eax
+  802a56:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802a5c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a5f:	5b                   	pop    %ebx
+  802a60:	5e                   	pop    %esi
+  802a61:	5d                   	pop    %ebp
+  802a62:	c3                   	ret
+		if (from_env_store)
+  802a63:	85 f6                	test   %esi,%esi
+  802a65:	74 06                	je     802a6d <ipc_recv+0x66>
+			*from_env_store = 0;
+  802a67:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802a6d:	85 db                	test   %ebx,%ebx
+  802a6f:	74 eb                	je     802a5c <ipc_recv+0x55>
+			*perm_store = 0;
+  802a71:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802a77:	eb e3                	jmp    802a5c <ipc_recv+0x55>
+
+00802a79 <ipc_send>:
+//
+// The kernel queues us behind any other senders until 'toenv'
+// receives, so we only come back to retry if its queue was full.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802a79:	55                   	push   %ebp
+  802a7a:	89 e5                	mov    %esp,%ebp
+  802a7c:	57                   	push   %edi
+  802a7d:	56                   	push   %esi
+  802a7e:	53                   	push   %ebx
+  802a7f:	83 ec 0c             	sub    $0xc,%esp
+  802a82:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a85:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802a88:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_send(to_env, val, pg ? pg : (void *) UTOP, perm))
+  802a8b:	85 db                	test   %ebx,%ebx
+  802a8d:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802a92:	0f 44 d8             	cmove  %eax,%ebx
+  802a95:	eb 05                	jmp    802a9c <ipc_send+0x23>
+	       == -E_AGAIN)
+		sys_yield();
+  802a97:	e8 fc e8 ff ff       	call   801398 <sys_yield>
+	while ((r = sys_ipc_send(to_env, val, pg ? pg : (void *) UTOP, perm))
+  802a9c:	ff 75 14             	push   0x14(%ebp)
+  802a9f:	53                   	push   %ebx
+  802aa0:	56                   	push   %esi
+  802aa1:	57                   	push   %edi
+  802aa2:	e8 09 ee ff ff       	call   8018b0 <sys_ipc_send>
+	       == -E_AGAIN)
+  802aa7:	83 c4 10             	add    $0x10,%esp
+  802aaa:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802aad:	74 e8                	je     802a97 <ipc_send+0x1e>
+	if (r < 0)
+  802aaf:	85 c0                	test   %eax,%eax
+  802ab1:	78 08                	js     802abb <ipc_send+0x42>
+		panic("ipc_send: %e", r);
+}
+  802ab3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ab6:	5b                   	pop    %ebx
+  802ab7:	5e                   	pop    %esi
+  802ab8:	5f                   	pop    %edi
+  802ab9:	5d                   	pop    %ebp
+  802aba:	c3                   	ret
+		panic("ipc_send: %e", r);
+  802abb:	50                   	push   %eax
+  802abc:	68 f5 32 80 00       	push   $0x8032f5
+  802ac1:	6a 3a                	push   $0x3a
+  802ac3:	68 02 33 80 00       	push   $0x803302
+  802ac8:	e8 82 d6 ff ff       	call   80014f <_panic>
+
+00802acd <ipc_send_range>:
+
+// Like ipc_send, but send the 'npages' contiguous pages at 'pg' in one
+// message.  The receiver maps as many as fit in its window.
+void
+ipc_send_range(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  802acd:	55                   	push   %ebp
+  802ace:	89 e5                	mov    %esp,%ebp
+  802ad0:	57                   	push   %edi
+  802ad1:	56                   	push   %esi
+  802ad2:	53                   	push   %ebx
+  802ad3:	83 ec 0c             	sub    $0xc,%esp
+  802ad6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802ad9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802adc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_send_range(to_env, val, pg, npages, perm))
+  802adf:	eb 05                	jmp    802ae6 <ipc_send_range+0x19>
+	       == -E_AGAIN)
+		sys_yield();
+  802ae1:	e8 b2 e8 ff ff       	call   801398 <sys_yield>
+	while ((r = sys_ipc_send_range(to_env, val, pg, npages, perm))
+  802ae6:	83 ec 0c             	sub    $0xc,%esp
+  802ae9:	ff 75 18             	push   0x18(%ebp)
+  802aec:	ff 75 14             	push   0x14(%ebp)
+  802aef:	53                   	push   %ebx
+  802af0:	56                   	push   %esi
+  802af1:	57                   	push   %edi
+  802af2:	e8 22 ef ff ff       	call   801a19 <sys_ipc_send_range>
+	       == -E_AGAIN)
+  802af7:	83 c4 20             	add    $0x20,%esp
+  802afa:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802afd:	74 e2                	je     802ae1 <ipc_send_range+0x14>
+	if (r < 0)
+  802aff:	85 c0                	test   %eax,%eax
+  802b01:	78 08                	js     802b0b <ipc_send_range+0x3e>
+		panic("ipc_send_range: %e", r);
+}
+  802b03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b06:	5b                   	pop    %ebx
+  802b07:	5e                   	pop    %esi
+  802b08:	5f                   	pop    %edi
+  802b09:	5d                   	pop    %ebp
+  802b0a:	c3                   	ret
+		panic("ipc_send_range: %e", r);
+  802b0b:	50                   	push   %eax
+  802b0c:	68 0c 33 80 00       	push   $0x80330c
+  802b11:	6a 48                	push   $0x48
+  802b13:	68 02 33 80 00       	push   $0x803302
+  802b18:	e8 32 d6 ff ff       	call   80014f <_panic>
+
+00802b1d <ipc_recv_range>:
+// (which must not be null).  On return *npages holds the number of
+// pages received, which is 0 on error or if the sender sent none.
+int32_t
+ipc_recv_range(envid_t *from_env_store, void *pg, size_t *npages,
+	       int *perm_store)
+{
+  802b1d:	55                   	push   %ebp
+  802b1e:	89 e5                	mov    %esp,%ebp
+  802b20:	57                   	push   %edi
+  802b21:	56                   	push   %esi
+  802b22:	53                   	push   %ebx
+  802b23:	83 ec 14             	sub    $0x14,%esp
+  802b26:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b29:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802b2c:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if ((r = sys_ipc_recv_range(pg, *npages)) < 0) {
+  802b2f:	ff 33                	push   (%ebx)
+  802b31:	ff 75 0c             	push   0xc(%ebp)
+  802b34:	e8 83 ef ff ff       	call   801abc <sys_ipc_recv_range>
+  802b39:	83 c4 10             	add    $0x10,%esp
+  802b3c:	85 c0                	test   %eax,%eax
+  802b3e:	78 42                	js     802b82 <ipc_recv_range+0x65>
+		if (perm_store)
+			*perm_store = 0;
+		*npages = 0;
+		return r;
+	}
+	if (from_env_store)
+  802b40:	85 ff                	test   %edi,%edi
+  802b42:	74 0d                	je     802b51 <ipc_recv_range+0x34>
+		*from_env_store = thisenv->env_ipc_from;
+  802b44:	a1 08 40 80 00       	mov    0x804008,%eax
+  802b49:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  802b4f:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  802b51:	85 f6                	test   %esi,%esi
+  802b53:	74 0d                	je     802b62 <ipc_recv_range+0x45>
+		*perm_store = thisenv->env_ipc_perm;
+  802b55:	a1 08 40 80 00       	mov    0x804008,%eax
+  802b5a:	8b 80 9c 00 00 00    	mov    0x9c(%eax),%eax
+  802b60:	89 06                	mov    %eax,(%esi)
+	*npages = thisenv->env_ipc_npages;
+  802b62:	a1 08 40 80 00       	mov    0x804008,%eax
+  802b67:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802b6d:	89 03                	mov    %eax,(%ebx)
+	return thisenv->env_ipc_msg.m_w[0];
+  802b6f:	a1 08 40 80 00       	mov    0x804008,%eax
+  802b74:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802b7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b7d:	5b                   	pop    %ebx
+  802b7e:	5e                   	pop    %esi
+  802b7f:	5f                   	pop    %edi
+  802b80:	5d                   	pop    %ebp
+  802b81:	c3                   	ret
+		if (from_env_store)
+  802b82:	85 ff                	test   %edi,%edi
+  802b84:	74 06                	je     802b8c <ipc_recv_range+0x6f>
+			*from_env_store = 0;
+  802b86:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  802b8c:	85 f6                	test   %esi,%esi
+  802b8e:	74 06                	je     802b96 <ipc_recv_range+0x79>
+			*perm_store = 0;
+  802b90:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		*npages = 0;
+  802b96:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		return r;
+  802b9c:	eb dc                	jmp    802b7a <ipc_recv_range+0x5d>
+
+00802b9e <ipc_send_msg>:
+// Send the IPC_MSG_WORDS words of 'msg' to 'to_env', in registers and
+// without a page.  Waits like ipc_send until 'to_env' takes them, and
+// panics on any error other than -E_AGAIN.
+void
+ipc_send_msg(envid_t to_env, const struct ipc_msg *msg)
+{
+  802b9e:	55                   	push   %ebp
+  802b9f:	89 e5                	mov    %esp,%ebp
+  802ba1:	56                   	push   %esi
+  802ba2:	53                   	push   %ebx
+  802ba3:	8b 75 08             	mov    0x8(%ebp),%esi
+  802ba6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_send_msg(to_env, msg)) == -E_AGAIN)
+  802ba9:	eb 05                	jmp    802bb0 <ipc_send_msg+0x12>
+		sys_yield();
+  802bab:	e8 e8 e7 ff ff       	call   801398 <sys_yield>
+	while ((r = sys_ipc_send_msg(to_env, msg)) == -E_AGAIN)
+  802bb0:	83 ec 08             	sub    $0x8,%esp
+  802bb3:	53                   	push   %ebx
+  802bb4:	56                   	push   %esi
+  802bb5:	e8 3a f0 ff ff       	call   801bf4 <sys_ipc_send_msg>
+  802bba:	83 c4 10             	add    $0x10,%esp
+  802bbd:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802bc0:	74 e9                	je     802bab <ipc_send_msg+0xd>
+	if (r < 0)
+  802bc2:	85 c0                	test   %eax,%eax
+  802bc4:	78 07                	js     802bcd <ipc_send_msg+0x2f>
+		panic("ipc_send_msg: %e", r);
+}
+  802bc6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802bc9:	5b                   	pop    %ebx
+  802bca:	5e                   	pop    %esi
+  802bcb:	5d                   	pop    %ebp
+  802bcc:	c3                   	ret
+		panic("ipc_send_msg: %e", r);
+  802bcd:	50                   	push   %eax
+  802bce:	68 1f 33 80 00       	push   $0x80331f
+  802bd3:	6a 6f                	push   $0x6f
+  802bd5:	68 02 33 80 00       	push   $0x803302
+  802bda:	e8 70 d5 ff ff       	call   80014f <_panic>
+
+00802bdf <ipc_recv_msg>:
+// ipc_call or plain ipc_send (whose value is word 0, and whose page is
+// not taken), it arrives in registers and needs no page.
+// Returns the sender's envid, < 0 on error.
+envid_t
+ipc_recv_msg(struct ipc_msg *msg)
+{
+  802bdf:	55                   	push   %ebp
+  802be0:	89 e5                	mov    %esp,%ebp
+  802be2:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_reply_wait(0, msg);
+  802be5:	ff 75 08             	push   0x8(%ebp)
+  802be8:	6a 00                	push   $0x0
+  802bea:	e8 cb ef ff ff       	call   801bba <sys_ipc_reply_wait>
+}
+  802bef:	c9                   	leave
+  802bf0:	c3                   	ret
+
+00802bf1 <ipc_call>:
+// ipc_reply_wait (or ipc_recv), and straight back when it replies.
+// Retries while to_env's queue is full.
+// Returns 0 on success, < 0 on error.
+int
+ipc_call(envid_t to_env, struct ipc_msg *msg)
+{
+  802bf1:	55                   	push   %ebp
+  802bf2:	89 e5                	mov    %esp,%ebp
+  802bf4:	56                   	push   %esi
+  802bf5:	53                   	push   %ebx
+  802bf6:	8b 75 08             	mov    0x8(%ebp),%esi
+  802bf9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_call(to_env, msg)) == -E_AGAIN)
+  802bfc:	eb 05                	jmp    802c03 <ipc_call+0x12>
+		sys_yield();
+  802bfe:	e8 95 e7 ff ff       	call   801398 <sys_yield>
+	while ((r = sys_ipc_call(to_env, msg)) == -E_AGAIN)
+  802c03:	83 ec 08             	sub    $0x8,%esp
+  802c06:	53                   	push   %ebx
+  802c07:	56                   	push   %esi
+  802c08:	e8 73 ef ff ff       	call   801b80 <sys_ipc_call>
+  802c0d:	83 c4 10             	add    $0x10,%esp
+  802c10:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802c13:	74 e9                	je     802bfe <ipc_call+0xd>
+	return r;
+}
+  802c15:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c18:	5b                   	pop    %ebx
+  802c19:	5e                   	pop    %esi
+  802c1a:	5d                   	pop    %ebp
+  802c1b:	c3                   	ret
+
+00802c1c <ipc_reply_wait>:
+//	}
+//
+// Returns the envid of the sender, < 0 on error.
+envid_t
+ipc_reply_wait(envid_t to_env, struct ipc_msg *msg)
+{
+  802c1c:	55                   	push   %ebp
+  802c1d:	89 e5                	mov    %esp,%ebp
+  802c1f:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_reply_wait(to_env, msg);
+  802c22:	ff 75 0c             	push   0xc(%ebp)
+  802c25:	ff 75 08             	push   0x8(%ebp)
+  802c28:	e8 8d ef ff ff       	call   801bba <sys_ipc_reply_wait>
+}
+  802c2d:	c9                   	leave
+  802c2e:	c3                   	ret
+
+00802c2f <ep_send>:
+
+// Send 'msg' to endpoint 'epid', waiting while its queue is full.
+// Returns 0 on success, < 0 if the endpoint is gone or not ours to use.
+int
+ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  802c2f:	55                   	push   %ebp
+  802c30:	89 e5                	mov    %esp,%ebp
+  802c32:	56                   	push   %esi
+  802c33:	53                   	push   %ebx
+  802c34:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c37:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ep_send(epid, msg)) == -E_AGAIN)
+  802c3a:	eb 05                	jmp    802c41 <ep_send+0x12>
+		sys_yield();
+  802c3c:	e8 57 e7 ff ff       	call   801398 <sys_yield>
+	while ((r = sys_ep_send(epid, msg)) == -E_AGAIN)
+  802c41:	83 ec 08             	sub    $0x8,%esp
+  802c44:	53                   	push   %ebx
+  802c45:	56                   	push   %esi
+  802c46:	e8 c6 f8 ff ff       	call   802511 <sys_ep_send>
+  802c4b:	83 c4 10             	add    $0x10,%esp
+  802c4e:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802c51:	74 e9                	je     802c3c <ep_send+0xd>
+	return r;
+}
+  802c53:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c56:	5b                   	pop    %ebx
+  802c57:	5e                   	pop    %esi
+  802c58:	5d                   	pop    %ebp
+  802c59:	c3                   	ret
+
+00802c5a <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802c5a:	55                   	push   %ebp
+  802c5b:	89 e5                	mov    %esp,%ebp
+  802c5d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802c60:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802c65:	69 d0 68 01 00 00    	imul   $0x168,%eax,%edx
+  802c6b:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802c71:	8b 52 50             	mov    0x50(%edx),%edx
+  802c74:	39 ca                	cmp    %ecx,%edx
+  802c76:	74 11                	je     802c89 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802c78:	83 c0 01             	add    $0x1,%eax
+  802c7b:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802c80:	75 e3                	jne    802c65 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802c82:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c87:	eb 0e                	jmp    802c97 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802c89:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802c8f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802c94:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802c97:	5d                   	pop    %ebp
+  802c98:	c3                   	ret
+
+00802c99 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802c99:	55                   	push   %ebp
+  802c9a:	89 e5                	mov    %esp,%ebp
+  802c9c:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  802c9f:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  802ca6:	74 0a                	je     802cb2 <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  802ca8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cab:	a3 0c 40 80 00       	mov    %eax,0x80400c
+}
+  802cb0:	c9                   	leave
+  802cb1:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE),
+  802cb2:	83 ec 04             	sub    $0x4,%esp
+  802cb5:	6a 07                	push   $0x7
+  802cb7:	68 00 f0 bf ee       	push   $0xeebff000
+  802cbc:	6a 00                	push   $0x0
+  802cbe:	e8 c3 e3 ff ff       	call   801086 <sys_page_alloc>
+  802cc3:	83 c4 10             	add    $0x10,%esp
+  802cc6:	85 c0                	test   %eax,%eax
+  802cc8:	78 28                	js     802cf2 <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  802cca:	83 ec 08             	sub    $0x8,%esp
+  802ccd:	68 04 2d 80 00       	push   $0x802d04
+  802cd2:	6a 00                	push   $0x0
+  802cd4:	e8 6c ea ff ff       	call   801745 <sys_env_set_pgfault_upcall>
+  802cd9:	83 c4 10             	add    $0x10,%esp
+  802cdc:	85 c0                	test   %eax,%eax
+  802cde:	79 c8                	jns    802ca8 <set_pgfault_handler+0xf>
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+  802ce0:	50                   	push   %eax
+  802ce1:	68 58 33 80 00       	push   $0x803358
+  802ce6:	6a 24                	push   $0x24
+  802ce8:	68 8c 33 80 00       	push   $0x80338c
+  802ced:	e8 5d d4 ff ff       	call   80014f <_panic>
+			panic("set_pgfault_handler: sys_page_alloc: %e", r);
+  802cf2:	50                   	push   %eax
+  802cf3:	68 30 33 80 00       	push   $0x803330
+  802cf8:	6a 22                	push   $0x22
+  802cfa:	68 8c 33 80 00       	push   $0x80338c
+  802cff:	e8 4b d4 ff ff       	call   80014f <_panic>
+
+00802d04 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802d04:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802d05:	a1 0c 40 80 00       	mov    0x80400c,%eax
+	call *%eax
+  802d0a:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802d0c:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 0x28(%esp), %ebx		// trap-time eip
+  802d0f:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl 0x30(%esp), %eax		// trap-time esp
+  802d13:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  802d17:	83 e8 04             	sub    $0x4,%eax
+	movl %ebx, (%eax)
+  802d1a:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 0x30(%esp)
+  802d1c:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp			// skip fault_va and err
+  802d20:	83 c4 08             	add    $0x8,%esp
+	popal
+  802d23:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp			// skip eip
+  802d24:	83 c4 04             	add    $0x4,%esp
+	popfl
+  802d27:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802d28:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802d29:	c3                   	ret
+
+00802d2a <dm>:
+  802d2a:	55                   	push   %ebp
+  802d2b:	57                   	push   %edi
+  802d2c:	56                   	push   %esi
+  802d2d:	53                   	push   %ebx
+  802d2e:	83 ec 24             	sub    $0x24,%esp
+  802d31:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802d35:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802d39:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802d3d:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802d41:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802d45:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802d49:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802d4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d52:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d57:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802d5c:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802d63:	00 
+  802d64:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802d6b:	00 
+  802d6c:	89 fb                	mov    %edi,%ebx
+  802d6e:	eb 08                	jmp    802d78 <dm+0x4e>
+  802d70:	83 e9 01             	sub    $0x1,%ecx
+  802d73:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802d76:	74 68                	je     802de0 <dm+0xb6>
+  802d78:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802d7c:	01 c0                	add    %eax,%eax
+  802d7e:	89 c6                	mov    %eax,%esi
+  802d80:	89 d7                	mov    %edx,%edi
+  802d82:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802d86:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802d8a:	0f ad d0             	shrd   %cl,%edx,%eax
+  802d8d:	d3 ea                	shr    %cl,%edx
+  802d8f:	f6 c1 20             	test   $0x20,%cl
+  802d92:	74 04                	je     802d98 <dm+0x6e>
+  802d94:	89 d0                	mov    %edx,%eax
+  802d96:	31 d2                	xor    %edx,%edx
+  802d98:	83 e0 01             	and    $0x1,%eax
+  802d9b:	89 04 24             	mov    %eax,(%esp)
+  802d9e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802da5:	00 
+  802da6:	8b 04 24             	mov    (%esp),%eax
+  802da9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802dad:	09 f0                	or     %esi,%eax
+  802daf:	09 fa                	or     %edi,%edx
+  802db1:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802db5:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802db9:	39 f0                	cmp    %esi,%eax
+  802dbb:	89 d5                	mov    %edx,%ebp
+  802dbd:	19 fd                	sbb    %edi,%ebp
+  802dbf:	72 af                	jb     802d70 <dm+0x46>
+  802dc1:	29 f0                	sub    %esi,%eax
+  802dc3:	19 fa                	sbb    %edi,%edx
+  802dc5:	89 cf                	mov    %ecx,%edi
+  802dc7:	c1 ef 05             	shr    $0x5,%edi
+  802dca:	83 e7 01             	and    $0x1,%edi
+  802dcd:	89 fe                	mov    %edi,%esi
+  802dcf:	83 f6 01             	xor    $0x1,%esi
+  802dd2:	d3 e6                	shl    %cl,%esi
+  802dd4:	d3 e7                	shl    %cl,%edi
+  802dd6:	09 74 24 18          	or     %esi,0x18(%esp)
+  802dda:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802dde:	eb 90                	jmp    802d70 <dm+0x46>
+  802de0:	85 db                	test   %ebx,%ebx
+  802de2:	74 05                	je     802de9 <dm+0xbf>
+  802de4:	89 03                	mov    %eax,(%ebx)
+  802de6:	89 53 04             	mov    %edx,0x4(%ebx)
+  802de9:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802ded:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802df1:	83 c4 24             	add    $0x24,%esp
+  802df4:	5b                   	pop    %ebx
+  802df5:	5e                   	pop    %esi
+  802df6:	5f                   	pop    %edi
+  802df7:	5d                   	pop    %ebp
+  802df8:	c3                   	ret
+
+00802df9 <__udivdi3>:
+  802df9:	83 ec 08             	sub    $0x8,%esp
+  802dfc:	6a 00                	push   $0x0
+  802dfe:	ff 74 24 1c          	push   0x1c(%esp)
+  802e02:	ff 74 24 1c          	push   0x1c(%esp)
+  802e06:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802e0a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802e0e:	e8 17 ff ff ff       	call   802d2a <dm>
+  802e13:	83 c4 14             	add    $0x14,%esp
+  802e16:	c3                   	ret
+
+00802e17 <__umoddi3>:
+  802e17:	83 ec 18             	sub    $0x18,%esp
+  802e1a:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802e1e:	50                   	push   %eax
+  802e1f:	ff 74 24 2c          	push   0x2c(%esp)
+  802e23:	ff 74 24 2c          	push   0x2c(%esp)
+  802e27:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e2b:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e2f:	e8 f6 fe ff ff       	call   802d2a <dm>
+  802e34:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802e38:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802e3c:	83 c4 24             	add    $0x24,%esp
+  802e3f:	c3                   	ret
+
+00802e40 <__divdi3>:
+  802e40:	53                   	push   %ebx
+  802e41:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802e45:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802e49:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  802e4d:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  802e51:	85 d2                	test   %edx,%edx
+  802e53:	78 15                	js     802e6a <__divdi3+0x2a>
+  802e55:	85 db                	test   %ebx,%ebx
+  802e57:	78 34                	js     802e8d <__divdi3+0x4d>
+  802e59:	83 ec 04             	sub    $0x4,%esp
+  802e5c:	6a 00                	push   $0x0
+  802e5e:	53                   	push   %ebx
+  802e5f:	51                   	push   %ecx
+  802e60:	e8 c5 fe ff ff       	call   802d2a <dm>
+  802e65:	83 c4 10             	add    $0x10,%esp
+  802e68:	eb 21                	jmp    802e8b <__divdi3+0x4b>
+  802e6a:	f7 d8                	neg    %eax
+  802e6c:	83 d2 00             	adc    $0x0,%edx
+  802e6f:	f7 da                	neg    %edx
+  802e71:	85 db                	test   %ebx,%ebx
+  802e73:	78 30                	js     802ea5 <__divdi3+0x65>
+  802e75:	83 ec 04             	sub    $0x4,%esp
+  802e78:	6a 00                	push   $0x0
+  802e7a:	53                   	push   %ebx
+  802e7b:	51                   	push   %ecx
+  802e7c:	e8 a9 fe ff ff       	call   802d2a <dm>
+  802e81:	83 c4 10             	add    $0x10,%esp
+  802e84:	f7 d8                	neg    %eax
+  802e86:	83 d2 00             	adc    $0x0,%edx
+  802e89:	f7 da                	neg    %edx
+  802e8b:	5b                   	pop    %ebx
+  802e8c:	c3                   	ret
+  802e8d:	83 ec 04             	sub    $0x4,%esp
+  802e90:	6a 00                	push   $0x0
+  802e92:	f7 d9                	neg    %ecx
+  802e94:	83 d3 00             	adc    $0x0,%ebx
+  802e97:	f7 db                	neg    %ebx
+  802e99:	53                   	push   %ebx
+  802e9a:	51                   	push   %ecx
+  802e9b:	e8 8a fe ff ff       	call   802d2a <dm>
+  802ea0:	83 c4 10             	add    $0x10,%esp
+  802ea3:	eb df                	jmp    802e84 <__divdi3+0x44>
+  802ea5:	83 ec 04             	sub    $0x4,%esp
+  802ea8:	6a 00                	push   $0x0
+  802eaa:	f7 d9                	neg    %ecx
+  802eac:	83 d3 00             	adc    $0x0,%ebx
+  802eaf:	f7 db                	neg    %ebx
+  802eb1:	53                   	push   %ebx
+  802eb2:	51                   	push   %ecx
+  802eb3:	e8 72 fe ff ff       	call   802d2a <dm>
+  802eb8:	83 c4 10             	add    $0x10,%esp
+  802ebb:	eb ce                	jmp    802e8b <__divdi3+0x4b>
+
+00802ebd <__moddi3>:
+  802ebd:	55                   	push   %ebp
+  802ebe:	57                   	push   %edi
+  802ebf:	56                   	push   %esi
+  802ec0:	53                   	push   %ebx
+  802ec1:	83 ec 18             	sub    $0x18,%esp
+  802ec4:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802ec8:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802ecc:	89 f1                	mov    %esi,%ecx
+  802ece:	f7 d9                	neg    %ecx
+  802ed0:	89 da                	mov    %ebx,%edx
+  802ed2:	83 d2 00             	adc    $0x0,%edx
+  802ed5:	f7 da                	neg    %edx
+  802ed7:	0f 48 ce             	cmovs  %esi,%ecx
+  802eda:	0f 48 d3             	cmovs  %ebx,%edx
+  802edd:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802ee1:	50                   	push   %eax
+  802ee2:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802ee6:	f7 de                	neg    %esi
+  802ee8:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802eec:	83 d0 00             	adc    $0x0,%eax
+  802eef:	f7 d8                	neg    %eax
+  802ef1:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802ef6:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802efb:	50                   	push   %eax
+  802efc:	56                   	push   %esi
+  802efd:	89 c8                	mov    %ecx,%eax
+  802eff:	e8 26 fe ff ff       	call   802d2a <dm>
+  802f04:	83 c4 10             	add    $0x10,%esp
+  802f07:	85 db                	test   %ebx,%ebx
+  802f09:	78 10                	js     802f1b <__moddi3+0x5e>
+  802f0b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802f0f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802f13:	83 c4 14             	add    $0x14,%esp
+  802f16:	5b                   	pop    %ebx
+  802f17:	5e                   	pop    %esi
+  802f18:	5f                   	pop    %edi
+  802f19:	5d                   	pop    %ebp
+  802f1a:	c3                   	ret
+  802f1b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802f1f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802f23:	f7 d8                	neg    %eax
+  802f25:	83 d2 00             	adc    $0x0,%edx
+  802f28:	f7 da                	neg    %edx
+  802f2a:	eb e7                	jmp    802f13 <__moddi3+0x56>
@@ -0,0 +1,6158 @@
+
+obj/user/sendpage:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 73 01 00 00       	call   8001a4 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#define TEMP_ADDR	((char*)0xa00000)
+#define TEMP_ADDR_CHILD	((char*)0xb00000)
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 18             	sub    $0x18,%esp
+	envid_t who;
+
+	if ((who = fork()) == 0) {
+  800039:	e8 ab 29 00 00       	call   8029e9 <fork>
+  80003e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  800041:	85 c0                	test   %eax,%eax
+  800043:	0f 84 a5 00 00 00    	je     8000ee <umain+0xbb>
+		ipc_send(who, 0, TEMP_ADDR_CHILD, PTE_P | PTE_W | PTE_U);
+		return;
+	}
+
+	// Parent
+	sys_page_alloc(thisenv->env_id, TEMP_ADDR, PTE_P | PTE_W | PTE_U);
+  800049:	a1 10 40 80 00       	mov    0x804010,%eax
+  80004e:	8b 40 48             	mov    0x48(%eax),%eax
+  800051:	83 ec 04             	sub    $0x4,%esp
+  800054:	6a 07                	push   $0x7
+  800056:	68 00 00 a0 00       	push   $0xa00000
+  80005b:	50                   	push   %eax
+  80005c:	e8 56 10 00 00       	call   8010b7 <sys_page_alloc>
+	memcpy(TEMP_ADDR, str1, strlen(str1) + 1);
+  800061:	83 c4 04             	add    $0x4,%esp
+  800064:	ff 35 04 40 80 00    	push   0x804004
+  80006a:	e8 d8 07 00 00       	call   800847 <strlen>
+  80006f:	83 c4 0c             	add    $0xc,%esp
+  800072:	83 c0 01             	add    $0x1,%eax
+  800075:	50                   	push   %eax
+  800076:	ff 35 04 40 80 00    	push   0x804004
+  80007c:	68 00 00 a0 00       	push   $0xa00000
+  800081:	e8 e4 09 00 00       	call   800a6a <memcpy>
+	ipc_send(who, 0, TEMP_ADDR, PTE_P | PTE_W | PTE_U);
+  800086:	6a 07                	push   $0x7
+  800088:	68 00 00 a0 00       	push   $0xa00000
+  80008d:	6a 00                	push   $0x0
+  80008f:	ff 75 f4             	push   -0xc(%ebp)
+  800092:	e8 13 2a 00 00       	call   802aaa <ipc_send>
+
+	ipc_recv(&who, TEMP_ADDR, 0);
+  800097:	83 c4 1c             	add    $0x1c,%esp
+  80009a:	6a 00                	push   $0x0
+  80009c:	68 00 00 a0 00       	push   $0xa00000
+  8000a1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000a4:	50                   	push   %eax
+  8000a5:	e8 8e 29 00 00       	call   802a38 <ipc_recv>
+	cprintf("%x got message: %s\n", who, TEMP_ADDR);
+  8000aa:	83 c4 0c             	add    $0xc,%esp
+  8000ad:	68 00 00 a0 00       	push   $0xa00000
+  8000b2:	ff 75 f4             	push   -0xc(%ebp)
+  8000b5:	68 e0 2f 80 00       	push   $0x802fe0
+  8000ba:	e8 d5 01 00 00       	call   800294 <cprintf>
+	if (strncmp(TEMP_ADDR, str2, strlen(str2)) == 0)
+  8000bf:	83 c4 04             	add    $0x4,%esp
+  8000c2:	ff 35 00 40 80 00    	push   0x804000
+  8000c8:	e8 7a 07 00 00       	call   800847 <strlen>
+  8000cd:	83 c4 0c             	add    $0xc,%esp
+  8000d0:	50                   	push   %eax
+  8000d1:	ff 35 00 40 80 00    	push   0x804000
+  8000d7:	68 00 00 a0 00       	push   $0xa00000
+  8000dc:	e8 78 08 00 00       	call   800959 <strncmp>
+  8000e1:	83 c4 10             	add    $0x10,%esp
+  8000e4:	85 c0                	test   %eax,%eax
+  8000e6:	0f 84 a3 00 00 00    	je     80018f <umain+0x15c>
+		cprintf("parent received correct message\n");
+	return;
+}
+  8000ec:	c9                   	leave
+  8000ed:	c3                   	ret
+		ipc_recv(&who, TEMP_ADDR_CHILD, 0);
+  8000ee:	83 ec 04             	sub    $0x4,%esp
+  8000f1:	6a 00                	push   $0x0
+  8000f3:	68 00 00 b0 00       	push   $0xb00000
+  8000f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000fb:	50                   	push   %eax
+  8000fc:	e8 37 29 00 00       	call   802a38 <ipc_recv>
+		cprintf("%x got message: %s\n", who, TEMP_ADDR_CHILD);
+  800101:	83 c4 0c             	add    $0xc,%esp
+  800104:	68 00 00 b0 00       	push   $0xb00000
+  800109:	ff 75 f4             	push   -0xc(%ebp)
+  80010c:	68 e0 2f 80 00       	push   $0x802fe0
+  800111:	e8 7e 01 00 00       	call   800294 <cprintf>
+		if (strncmp(TEMP_ADDR_CHILD, str1, strlen(str1)) == 0)
+  800116:	83 c4 04             	add    $0x4,%esp
+  800119:	ff 35 04 40 80 00    	push   0x804004
+  80011f:	e8 23 07 00 00       	call   800847 <strlen>
+  800124:	83 c4 0c             	add    $0xc,%esp
+  800127:	50                   	push   %eax
+  800128:	ff 35 04 40 80 00    	push   0x804004
+  80012e:	68 00 00 b0 00       	push   $0xb00000
+  800133:	e8 21 08 00 00       	call   800959 <strncmp>
+  800138:	83 c4 10             	add    $0x10,%esp
+  80013b:	85 c0                	test   %eax,%eax
+  80013d:	74 3e                	je     80017d <umain+0x14a>
+		memcpy(TEMP_ADDR_CHILD, str2, strlen(str2) + 1);
+  80013f:	83 ec 0c             	sub    $0xc,%esp
+  800142:	ff 35 00 40 80 00    	push   0x804000
+  800148:	e8 fa 06 00 00       	call   800847 <strlen>
+  80014d:	83 c4 0c             	add    $0xc,%esp
+  800150:	83 c0 01             	add    $0x1,%eax
+  800153:	50                   	push   %eax
+  800154:	ff 35 00 40 80 00    	push   0x804000
+  80015a:	68 00 00 b0 00       	push   $0xb00000
+  80015f:	e8 06 09 00 00       	call   800a6a <memcpy>
+		ipc_send(who, 0, TEMP_ADDR_CHILD, PTE_P | PTE_W | PTE_U);
+  800164:	6a 07                	push   $0x7
+  800166:	68 00 00 b0 00       	push   $0xb00000
+  80016b:	6a 00                	push   $0x0
+  80016d:	ff 75 f4             	push   -0xc(%ebp)
+  800170:	e8 35 29 00 00       	call   802aaa <ipc_send>
+		return;
+  800175:	83 c4 20             	add    $0x20,%esp
+  800178:	e9 6f ff ff ff       	jmp    8000ec <umain+0xb9>
+			cprintf("child received correct message\n");
+  80017d:	83 ec 0c             	sub    $0xc,%esp
+  800180:	68 f4 2f 80 00       	push   $0x802ff4
+  800185:	e8 0a 01 00 00       	call   800294 <cprintf>
+  80018a:	83 c4 10             	add    $0x10,%esp
+  80018d:	eb b0                	jmp    80013f <umain+0x10c>
+		cprintf("parent received correct message\n");
+  80018f:	83 ec 0c             	sub    $0xc,%esp
+  800192:	68 14 30 80 00       	push   $0x803014
+  800197:	e8 f8 00 00 00       	call   800294 <cprintf>
+  80019c:	83 c4 10             	add    $0x10,%esp
+  80019f:	e9 48 ff ff ff       	jmp    8000ec <umain+0xb9>
+
+008001a4 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001a4:	55                   	push   %ebp
+  8001a5:	89 e5                	mov    %esp,%ebp
+  8001a7:	56                   	push   %esi
+  8001a8:	53                   	push   %ebx
+  8001a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001ac:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  8001af:	e8 64 0e 00 00       	call   801018 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  8001b4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001b9:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  8001bf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001c4:	a3 10 40 80 00       	mov    %eax,0x804010
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001c9:	85 db                	test   %ebx,%ebx
+  8001cb:	7e 07                	jle    8001d4 <libmain+0x30>
+		binaryname = argv[0];
+  8001cd:	8b 06                	mov    (%esi),%eax
+  8001cf:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// call user main routine
+	umain(argc, argv);
+  8001d4:	83 ec 08             	sub    $0x8,%esp
+  8001d7:	56                   	push   %esi
+  8001d8:	53                   	push   %ebx
+  8001d9:	e8 55 fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8001de:	e8 0a 00 00 00       	call   8001ed <exit>
+}
+  8001e3:	83 c4 10             	add    $0x10,%esp
+  8001e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001e9:	5b                   	pop    %ebx
+  8001ea:	5e                   	pop    %esi
+  8001eb:	5d                   	pop    %ebp
+  8001ec:	c3                   	ret
+
+008001ed <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001ed:	55                   	push   %ebp
+  8001ee:	89 e5                	mov    %esp,%ebp
+  8001f0:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  8001f3:	6a 00                	push   $0x0
+  8001f5:	e8 5c 0d 00 00       	call   800f56 <sys_env_destroy>
+}
+  8001fa:	83 c4 10             	add    $0x10,%esp
+  8001fd:	c9                   	leave
+  8001fe:	c3                   	ret
+
+008001ff <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001ff:	55                   	push   %ebp
+  800200:	89 e5                	mov    %esp,%ebp
+  800202:	53                   	push   %ebx
+  800203:	83 ec 04             	sub    $0x4,%esp
+  800206:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800209:	8b 13                	mov    (%ebx),%edx
+  80020b:	8d 42 01             	lea    0x1(%edx),%eax
+  80020e:	89 03                	mov    %eax,(%ebx)
+  800210:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800213:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800217:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80021c:	74 09                	je     800227 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80021e:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800222:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800225:	c9                   	leave
+  800226:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800227:	83 ec 08             	sub    $0x8,%esp
+  80022a:	68 ff 00 00 00       	push   $0xff
+  80022f:	8d 43 08             	lea    0x8(%ebx),%eax
+  800232:	50                   	push   %eax
+  800233:	e8 e2 0b 00 00       	call   800e1a <sys_cputs>
+		b->idx = 0;
+  800238:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80023e:	83 c4 10             	add    $0x10,%esp
+  800241:	eb db                	jmp    80021e <putch+0x1f>
+
+00800243 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800243:	55                   	push   %ebp
+  800244:	89 e5                	mov    %esp,%ebp
+  800246:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80024c:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800253:	00 00 00 
+	b.cnt = 0;
+  800256:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80025d:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800260:	ff 75 0c             	push   0xc(%ebp)
+  800263:	ff 75 08             	push   0x8(%ebp)
+  800266:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80026c:	50                   	push   %eax
+  80026d:	68 ff 01 80 00       	push   $0x8001ff
+  800272:	e8 14 01 00 00       	call   80038b <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800277:	83 c4 08             	add    $0x8,%esp
+  80027a:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800280:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800286:	50                   	push   %eax
+  800287:	e8 8e 0b 00 00       	call   800e1a <sys_cputs>
+
+	return b.cnt;
+}
+  80028c:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800292:	c9                   	leave
+  800293:	c3                   	ret
+
+00800294 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800294:	55                   	push   %ebp
+  800295:	89 e5                	mov    %esp,%ebp
+  800297:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80029a:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80029d:	50                   	push   %eax
+  80029e:	ff 75 08             	push   0x8(%ebp)
+  8002a1:	e8 9d ff ff ff       	call   800243 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002a6:	c9                   	leave
+  8002a7:	c3                   	ret
+
+008002a8 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8002a8:	55                   	push   %ebp
+  8002a9:	89 e5                	mov    %esp,%ebp
+  8002ab:	57                   	push   %edi
+  8002ac:	56                   	push   %esi
+  8002ad:	53                   	push   %ebx
+  8002ae:	83 ec 1c             	sub    $0x1c,%esp
+  8002b1:	89 c7                	mov    %eax,%edi
+  8002b3:	89 d6                	mov    %edx,%esi
+  8002b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002b8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002bb:	89 d1                	mov    %edx,%ecx
+  8002bd:	89 c2                	mov    %eax,%edx
+  8002bf:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002c2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002c5:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002c8:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002cb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002ce:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002d5:	39 c2                	cmp    %eax,%edx
+  8002d7:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002da:	72 3e                	jb     80031a <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002dc:	83 ec 0c             	sub    $0xc,%esp
+  8002df:	ff 75 18             	push   0x18(%ebp)
+  8002e2:	83 eb 01             	sub    $0x1,%ebx
+  8002e5:	53                   	push   %ebx
+  8002e6:	50                   	push   %eax
+  8002e7:	83 ec 08             	sub    $0x8,%esp
+  8002ea:	ff 75 e4             	push   -0x1c(%ebp)
+  8002ed:	ff 75 e0             	push   -0x20(%ebp)
+  8002f0:	ff 75 dc             	push   -0x24(%ebp)
+  8002f3:	ff 75 d8             	push   -0x28(%ebp)
+  8002f6:	e8 ae 2b 00 00       	call   802ea9 <__udivdi3>
+  8002fb:	83 c4 18             	add    $0x18,%esp
+  8002fe:	52                   	push   %edx
+  8002ff:	50                   	push   %eax
+  800300:	89 f2                	mov    %esi,%edx
+  800302:	89 f8                	mov    %edi,%eax
+  800304:	e8 9f ff ff ff       	call   8002a8 <printnum>
+  800309:	83 c4 20             	add    $0x20,%esp
+  80030c:	eb 13                	jmp    800321 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80030e:	83 ec 08             	sub    $0x8,%esp
+  800311:	56                   	push   %esi
+  800312:	ff 75 18             	push   0x18(%ebp)
+  800315:	ff d7                	call   *%edi
+  800317:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80031a:	83 eb 01             	sub    $0x1,%ebx
+  80031d:	85 db                	test   %ebx,%ebx
+  80031f:	7f ed                	jg     80030e <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800321:	83 ec 08             	sub    $0x8,%esp
+  800324:	56                   	push   %esi
+  800325:	83 ec 04             	sub    $0x4,%esp
+  800328:	ff 75 e4             	push   -0x1c(%ebp)
+  80032b:	ff 75 e0             	push   -0x20(%ebp)
+  80032e:	ff 75 dc             	push   -0x24(%ebp)
+  800331:	ff 75 d8             	push   -0x28(%ebp)
+  800334:	e8 8e 2b 00 00       	call   802ec7 <__umoddi3>
+  800339:	83 c4 14             	add    $0x14,%esp
+  80033c:	0f be 80 8c 30 80 00 	movsbl 0x80308c(%eax),%eax
+  800343:	50                   	push   %eax
+  800344:	ff d7                	call   *%edi
+}
+  800346:	83 c4 10             	add    $0x10,%esp
+  800349:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80034c:	5b                   	pop    %ebx
+  80034d:	5e                   	pop    %esi
+  80034e:	5f                   	pop    %edi
+  80034f:	5d                   	pop    %ebp
+  800350:	c3                   	ret
+
+00800351 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800351:	55                   	push   %ebp
+  800352:	89 e5                	mov    %esp,%ebp
+  800354:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800357:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80035b:	8b 10                	mov    (%eax),%edx
+  80035d:	3b 50 04             	cmp    0x4(%eax),%edx
+  800360:	73 0a                	jae    80036c <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800362:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800365:	89 08                	mov    %ecx,(%eax)
+  800367:	8b 45 08             	mov    0x8(%ebp),%eax
+  80036a:	88 02                	mov    %al,(%edx)
+}
+  80036c:	5d                   	pop    %ebp
+  80036d:	c3                   	ret
+
+0080036e <printfmt>:
+{
+  80036e:	55                   	push   %ebp
+  80036f:	89 e5                	mov    %esp,%ebp
+  800371:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800374:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800377:	50                   	push   %eax
+  800378:	ff 75 10             	push   0x10(%ebp)
+  80037b:	ff 75 0c             	push   0xc(%ebp)
+  80037e:	ff 75 08             	push   0x8(%ebp)
+  800381:	e8 05 00 00 00       	call   80038b <vprintfmt>
+}
+  800386:	83 c4 10             	add    $0x10,%esp
+  800389:	c9                   	leave
+  80038a:	c3                   	ret
+
+0080038b <vprintfmt>:
+{
+  80038b:	55                   	push   %ebp
+  80038c:	89 e5                	mov    %esp,%ebp
+  80038e:	57                   	push   %edi
+  80038f:	56                   	push   %esi
+  800390:	53                   	push   %ebx
+  800391:	83 ec 2c             	sub    $0x2c,%esp
+  800394:	8b 75 08             	mov    0x8(%ebp),%esi
+  800397:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80039a:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80039d:	eb 0a                	jmp    8003a9 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80039f:	83 ec 08             	sub    $0x8,%esp
+  8003a2:	53                   	push   %ebx
+  8003a3:	50                   	push   %eax
+  8003a4:	ff d6                	call   *%esi
+  8003a6:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003a9:	83 c7 01             	add    $0x1,%edi
+  8003ac:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8003b0:	83 f8 25             	cmp    $0x25,%eax
+  8003b3:	74 0c                	je     8003c1 <vprintfmt+0x36>
+			if (ch == '\0')
+  8003b5:	85 c0                	test   %eax,%eax
+  8003b7:	75 e6                	jne    80039f <vprintfmt+0x14>
+}
+  8003b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003bc:	5b                   	pop    %ebx
+  8003bd:	5e                   	pop    %esi
+  8003be:	5f                   	pop    %edi
+  8003bf:	5d                   	pop    %ebp
+  8003c0:	c3                   	ret
+		padc = ' ';
+  8003c1:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8003c5:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003cc:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8003d3:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003da:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003df:	8d 47 01             	lea    0x1(%edi),%eax
+  8003e2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003e5:	0f b6 17             	movzbl (%edi),%edx
+  8003e8:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003eb:	3c 55                	cmp    $0x55,%al
+  8003ed:	0f 87 cf 03 00 00    	ja     8007c2 <vprintfmt+0x437>
+  8003f3:	0f b6 c0             	movzbl %al,%eax
+  8003f6:	ff 24 85 80 31 80 00 	jmp    *0x803180(,%eax,4)
+  8003fd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800400:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800404:	eb d9                	jmp    8003df <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800406:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800409:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80040d:	eb d0                	jmp    8003df <vprintfmt+0x54>
+  80040f:	0f b6 d2             	movzbl %dl,%edx
+  800412:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800415:	b8 00 00 00 00       	mov    $0x0,%eax
+  80041a:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80041d:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800420:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800424:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800427:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80042a:	83 f9 09             	cmp    $0x9,%ecx
+  80042d:	77 55                	ja     800484 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80042f:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800432:	eb e9                	jmp    80041d <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800434:	8b 45 14             	mov    0x14(%ebp),%eax
+  800437:	8b 00                	mov    (%eax),%eax
+  800439:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80043c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80043f:	8d 40 04             	lea    0x4(%eax),%eax
+  800442:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800445:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800448:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80044c:	79 91                	jns    8003df <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80044e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800451:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800454:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80045b:	eb 82                	jmp    8003df <vprintfmt+0x54>
+			if (width < 0)
+  80045d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800460:	85 d2                	test   %edx,%edx
+  800462:	b8 00 00 00 00       	mov    $0x0,%eax
+  800467:	0f 49 c2             	cmovns %edx,%eax
+  80046a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80046d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800470:	e9 6a ff ff ff       	jmp    8003df <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800475:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800478:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80047f:	e9 5b ff ff ff       	jmp    8003df <vprintfmt+0x54>
+  800484:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800487:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80048a:	eb bc                	jmp    800448 <vprintfmt+0xbd>
+			lflag++;
+  80048c:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80048f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800492:	e9 48 ff ff ff       	jmp    8003df <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800497:	8b 45 14             	mov    0x14(%ebp),%eax
+  80049a:	8d 78 04             	lea    0x4(%eax),%edi
+  80049d:	83 ec 08             	sub    $0x8,%esp
+  8004a0:	53                   	push   %ebx
+  8004a1:	ff 30                	push   (%eax)
+  8004a3:	ff d6                	call   *%esi
+			break;
+  8004a5:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8004a8:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8004ab:	e9 b1 02 00 00       	jmp    800761 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8004b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b3:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8004b6:	8b 10                	mov    (%eax),%edx
+  8004b8:	89 d0                	mov    %edx,%eax
+  8004ba:	f7 d8                	neg    %eax
+  8004bc:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004bf:	83 f8 0d             	cmp    $0xd,%eax
+  8004c2:	7f 23                	jg     8004e7 <vprintfmt+0x15c>
+  8004c4:	8b 14 85 e0 32 80 00 	mov    0x8032e0(,%eax,4),%edx
+  8004cb:	85 d2                	test   %edx,%edx
+  8004cd:	74 18                	je     8004e7 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8004cf:	52                   	push   %edx
+  8004d0:	68 ad 30 80 00       	push   $0x8030ad
+  8004d5:	53                   	push   %ebx
+  8004d6:	56                   	push   %esi
+  8004d7:	e8 92 fe ff ff       	call   80036e <printfmt>
+  8004dc:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004df:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8004e2:	e9 7a 02 00 00       	jmp    800761 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8004e7:	50                   	push   %eax
+  8004e8:	68 a4 30 80 00       	push   $0x8030a4
+  8004ed:	53                   	push   %ebx
+  8004ee:	56                   	push   %esi
+  8004ef:	e8 7a fe ff ff       	call   80036e <printfmt>
+  8004f4:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004f7:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004fa:	e9 62 02 00 00       	jmp    800761 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800502:	83 c0 04             	add    $0x4,%eax
+  800505:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800508:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050b:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80050d:	85 c9                	test   %ecx,%ecx
+  80050f:	b8 9d 30 80 00       	mov    $0x80309d,%eax
+  800514:	0f 45 c1             	cmovne %ecx,%eax
+  800517:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80051a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80051e:	7e 06                	jle    800526 <vprintfmt+0x19b>
+  800520:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800524:	75 0b                	jne    800531 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800526:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800529:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80052c:	89 75 08             	mov    %esi,0x8(%ebp)
+  80052f:	eb 5c                	jmp    80058d <vprintfmt+0x202>
+  800531:	83 ec 08             	sub    $0x8,%esp
+  800534:	ff 75 d0             	push   -0x30(%ebp)
+  800537:	ff 75 cc             	push   -0x34(%ebp)
+  80053a:	e8 20 03 00 00       	call   80085f <strnlen>
+  80053f:	89 c2                	mov    %eax,%edx
+  800541:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800544:	29 d0                	sub    %edx,%eax
+  800546:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800549:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80054d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800550:	89 75 08             	mov    %esi,0x8(%ebp)
+  800553:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800555:	eb 0e                	jmp    800565 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800557:	83 ec 08             	sub    $0x8,%esp
+  80055a:	53                   	push   %ebx
+  80055b:	57                   	push   %edi
+  80055c:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80055f:	83 ee 01             	sub    $0x1,%esi
+  800562:	83 c4 10             	add    $0x10,%esp
+  800565:	85 f6                	test   %esi,%esi
+  800567:	7f ee                	jg     800557 <vprintfmt+0x1cc>
+  800569:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80056c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80056f:	85 c0                	test   %eax,%eax
+  800571:	ba 00 00 00 00       	mov    $0x0,%edx
+  800576:	0f 49 d0             	cmovns %eax,%edx
+  800579:	29 d0                	sub    %edx,%eax
+  80057b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80057e:	eb a6                	jmp    800526 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800580:	83 ec 08             	sub    $0x8,%esp
+  800583:	53                   	push   %ebx
+  800584:	52                   	push   %edx
+  800585:	ff 55 08             	call   *0x8(%ebp)
+  800588:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80058b:	89 f1                	mov    %esi,%ecx
+  80058d:	8d 71 01             	lea    0x1(%ecx),%esi
+  800590:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800594:	0f be d0             	movsbl %al,%edx
+  800597:	85 d2                	test   %edx,%edx
+  800599:	74 28                	je     8005c3 <vprintfmt+0x238>
+  80059b:	85 ff                	test   %edi,%edi
+  80059d:	78 05                	js     8005a4 <vprintfmt+0x219>
+  80059f:	83 ef 01             	sub    $0x1,%edi
+  8005a2:	78 30                	js     8005d4 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005a4:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005a8:	74 d6                	je     800580 <vprintfmt+0x1f5>
+  8005aa:	0f be c0             	movsbl %al,%eax
+  8005ad:	83 e8 20             	sub    $0x20,%eax
+  8005b0:	83 f8 5e             	cmp    $0x5e,%eax
+  8005b3:	76 cb                	jbe    800580 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8005b5:	83 ec 08             	sub    $0x8,%esp
+  8005b8:	53                   	push   %ebx
+  8005b9:	6a 3f                	push   $0x3f
+  8005bb:	ff 55 08             	call   *0x8(%ebp)
+  8005be:	83 c4 10             	add    $0x10,%esp
+  8005c1:	eb c8                	jmp    80058b <vprintfmt+0x200>
+  8005c3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005c6:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005c9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005cc:	01 d0                	add    %edx,%eax
+  8005ce:	29 c8                	sub    %ecx,%eax
+  8005d0:	89 c7                	mov    %eax,%edi
+  8005d2:	eb 13                	jmp    8005e7 <vprintfmt+0x25c>
+  8005d4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005d7:	eb ed                	jmp    8005c6 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8005d9:	83 ec 08             	sub    $0x8,%esp
+  8005dc:	53                   	push   %ebx
+  8005dd:	6a 20                	push   $0x20
+  8005df:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8005e1:	83 ef 01             	sub    $0x1,%edi
+  8005e4:	83 c4 10             	add    $0x10,%esp
+  8005e7:	85 ff                	test   %edi,%edi
+  8005e9:	7f ee                	jg     8005d9 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005eb:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8005ee:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f1:	e9 6b 01 00 00       	jmp    800761 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8005f6:	83 f9 01             	cmp    $0x1,%ecx
+  8005f9:	7f 1f                	jg     80061a <vprintfmt+0x28f>
+	else if (lflag)
+  8005fb:	85 c9                	test   %ecx,%ecx
+  8005fd:	74 67                	je     800666 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8005ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800602:	8b 00                	mov    (%eax),%eax
+  800604:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800607:	89 c1                	mov    %eax,%ecx
+  800609:	c1 f9 1f             	sar    $0x1f,%ecx
+  80060c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80060f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800612:	8d 40 04             	lea    0x4(%eax),%eax
+  800615:	89 45 14             	mov    %eax,0x14(%ebp)
+  800618:	eb 17                	jmp    800631 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80061a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061d:	8b 50 04             	mov    0x4(%eax),%edx
+  800620:	8b 00                	mov    (%eax),%eax
+  800622:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800625:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800628:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062b:	8d 40 08             	lea    0x8(%eax),%eax
+  80062e:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800631:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800634:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800637:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80063c:	85 c9                	test   %ecx,%ecx
+  80063e:	0f 89 03 01 00 00    	jns    800747 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800644:	83 ec 08             	sub    $0x8,%esp
+  800647:	53                   	push   %ebx
+  800648:	6a 2d                	push   $0x2d
+  80064a:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80064c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80064f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800652:	f7 da                	neg    %edx
+  800654:	83 d1 00             	adc    $0x0,%ecx
+  800657:	f7 d9                	neg    %ecx
+  800659:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80065c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800661:	e9 e1 00 00 00       	jmp    800747 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800666:	8b 45 14             	mov    0x14(%ebp),%eax
+  800669:	8b 00                	mov    (%eax),%eax
+  80066b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80066e:	89 c1                	mov    %eax,%ecx
+  800670:	c1 f9 1f             	sar    $0x1f,%ecx
+  800673:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800676:	8b 45 14             	mov    0x14(%ebp),%eax
+  800679:	8d 40 04             	lea    0x4(%eax),%eax
+  80067c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80067f:	eb b0                	jmp    800631 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800681:	83 f9 01             	cmp    $0x1,%ecx
+  800684:	7f 1e                	jg     8006a4 <vprintfmt+0x319>
+	else if (lflag)
+  800686:	85 c9                	test   %ecx,%ecx
+  800688:	74 32                	je     8006bc <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  80068a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068d:	8b 10                	mov    (%eax),%edx
+  80068f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800694:	8d 40 04             	lea    0x4(%eax),%eax
+  800697:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80069a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80069f:	e9 a3 00 00 00       	jmp    800747 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a7:	8b 10                	mov    (%eax),%edx
+  8006a9:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006ac:	8d 40 08             	lea    0x8(%eax),%eax
+  8006af:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006b2:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8006b7:	e9 8b 00 00 00       	jmp    800747 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bf:	8b 10                	mov    (%eax),%edx
+  8006c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006c6:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006cc:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8006d1:	eb 74                	jmp    800747 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8006d3:	83 f9 01             	cmp    $0x1,%ecx
+  8006d6:	7f 1b                	jg     8006f3 <vprintfmt+0x368>
+	else if (lflag)
+  8006d8:	85 c9                	test   %ecx,%ecx
+  8006da:	74 2c                	je     800708 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8006dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006df:	8b 10                	mov    (%eax),%edx
+  8006e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e6:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006ec:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8006f1:	eb 54                	jmp    800747 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f6:	8b 10                	mov    (%eax),%edx
+  8006f8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006fb:	8d 40 08             	lea    0x8(%eax),%eax
+  8006fe:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800701:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800706:	eb 3f                	jmp    800747 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800708:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070b:	8b 10                	mov    (%eax),%edx
+  80070d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800712:	8d 40 04             	lea    0x4(%eax),%eax
+  800715:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800718:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80071d:	eb 28                	jmp    800747 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  80071f:	83 ec 08             	sub    $0x8,%esp
+  800722:	53                   	push   %ebx
+  800723:	6a 30                	push   $0x30
+  800725:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800727:	83 c4 08             	add    $0x8,%esp
+  80072a:	53                   	push   %ebx
+  80072b:	6a 78                	push   $0x78
+  80072d:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80072f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800732:	8b 10                	mov    (%eax),%edx
+  800734:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800739:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80073c:	8d 40 04             	lea    0x4(%eax),%eax
+  80073f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800742:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800747:	83 ec 0c             	sub    $0xc,%esp
+  80074a:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80074e:	50                   	push   %eax
+  80074f:	ff 75 e0             	push   -0x20(%ebp)
+  800752:	57                   	push   %edi
+  800753:	51                   	push   %ecx
+  800754:	52                   	push   %edx
+  800755:	89 da                	mov    %ebx,%edx
+  800757:	89 f0                	mov    %esi,%eax
+  800759:	e8 4a fb ff ff       	call   8002a8 <printnum>
+			break;
+  80075e:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800761:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800764:	e9 40 fc ff ff       	jmp    8003a9 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800769:	83 f9 01             	cmp    $0x1,%ecx
+  80076c:	7f 1b                	jg     800789 <vprintfmt+0x3fe>
+	else if (lflag)
+  80076e:	85 c9                	test   %ecx,%ecx
+  800770:	74 2c                	je     80079e <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800772:	8b 45 14             	mov    0x14(%ebp),%eax
+  800775:	8b 10                	mov    (%eax),%edx
+  800777:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80077c:	8d 40 04             	lea    0x4(%eax),%eax
+  80077f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800782:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800787:	eb be                	jmp    800747 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800789:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078c:	8b 10                	mov    (%eax),%edx
+  80078e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800791:	8d 40 08             	lea    0x8(%eax),%eax
+  800794:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800797:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80079c:	eb a9                	jmp    800747 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80079e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a1:	8b 10                	mov    (%eax),%edx
+  8007a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007a8:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ab:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007ae:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8007b3:	eb 92                	jmp    800747 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8007b5:	83 ec 08             	sub    $0x8,%esp
+  8007b8:	53                   	push   %ebx
+  8007b9:	6a 25                	push   $0x25
+  8007bb:	ff d6                	call   *%esi
+			break;
+  8007bd:	83 c4 10             	add    $0x10,%esp
+  8007c0:	eb 9f                	jmp    800761 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8007c2:	83 ec 08             	sub    $0x8,%esp
+  8007c5:	53                   	push   %ebx
+  8007c6:	6a 25                	push   $0x25
+  8007c8:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007ca:	83 c4 10             	add    $0x10,%esp
+  8007cd:	89 f8                	mov    %edi,%eax
+  8007cf:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007d3:	74 05                	je     8007da <vprintfmt+0x44f>
+  8007d5:	83 e8 01             	sub    $0x1,%eax
+  8007d8:	eb f5                	jmp    8007cf <vprintfmt+0x444>
+  8007da:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007dd:	eb 82                	jmp    800761 <vprintfmt+0x3d6>
+
+008007df <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007df:	55                   	push   %ebp
+  8007e0:	89 e5                	mov    %esp,%ebp
+  8007e2:	83 ec 18             	sub    $0x18,%esp
+  8007e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007eb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007ee:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007f2:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007f5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007fc:	85 c0                	test   %eax,%eax
+  8007fe:	74 26                	je     800826 <vsnprintf+0x47>
+  800800:	85 d2                	test   %edx,%edx
+  800802:	7e 22                	jle    800826 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800804:	ff 75 14             	push   0x14(%ebp)
+  800807:	ff 75 10             	push   0x10(%ebp)
+  80080a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80080d:	50                   	push   %eax
+  80080e:	68 51 03 80 00       	push   $0x800351
+  800813:	e8 73 fb ff ff       	call   80038b <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800818:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80081b:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80081e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800821:	83 c4 10             	add    $0x10,%esp
+}
+  800824:	c9                   	leave
+  800825:	c3                   	ret
+		return -E_INVAL;
+  800826:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80082b:	eb f7                	jmp    800824 <vsnprintf+0x45>
+
+0080082d <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80082d:	55                   	push   %ebp
+  80082e:	89 e5                	mov    %esp,%ebp
+  800830:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800833:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800836:	50                   	push   %eax
+  800837:	ff 75 10             	push   0x10(%ebp)
+  80083a:	ff 75 0c             	push   0xc(%ebp)
+  80083d:	ff 75 08             	push   0x8(%ebp)
+  800840:	e8 9a ff ff ff       	call   8007df <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800845:	c9                   	leave
+  800846:	c3                   	ret
+
+00800847 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800847:	55                   	push   %ebp
+  800848:	89 e5                	mov    %esp,%ebp
+  80084a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80084d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800852:	eb 03                	jmp    800857 <strlen+0x10>
+		n++;
+  800854:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800857:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80085b:	75 f7                	jne    800854 <strlen+0xd>
+	return n;
+}
+  80085d:	5d                   	pop    %ebp
+  80085e:	c3                   	ret
+
+0080085f <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80085f:	55                   	push   %ebp
+  800860:	89 e5                	mov    %esp,%ebp
+  800862:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800865:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800868:	b8 00 00 00 00       	mov    $0x0,%eax
+  80086d:	eb 03                	jmp    800872 <strnlen+0x13>
+		n++;
+  80086f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800872:	39 d0                	cmp    %edx,%eax
+  800874:	74 08                	je     80087e <strnlen+0x1f>
+  800876:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80087a:	75 f3                	jne    80086f <strnlen+0x10>
+  80087c:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80087e:	89 d0                	mov    %edx,%eax
+  800880:	5d                   	pop    %ebp
+  800881:	c3                   	ret
+
+00800882 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800882:	55                   	push   %ebp
+  800883:	89 e5                	mov    %esp,%ebp
+  800885:	53                   	push   %ebx
+  800886:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800889:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80088c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800891:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800895:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800898:	83 c0 01             	add    $0x1,%eax
+  80089b:	84 d2                	test   %dl,%dl
+  80089d:	75 f2                	jne    800891 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80089f:	89 c8                	mov    %ecx,%eax
+  8008a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008a4:	c9                   	leave
+  8008a5:	c3                   	ret
+
+008008a6 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008a6:	55                   	push   %ebp
+  8008a7:	89 e5                	mov    %esp,%ebp
+  8008a9:	53                   	push   %ebx
+  8008aa:	83 ec 10             	sub    $0x10,%esp
+  8008ad:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008b0:	53                   	push   %ebx
+  8008b1:	e8 91 ff ff ff       	call   800847 <strlen>
+  8008b6:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008b9:	ff 75 0c             	push   0xc(%ebp)
+  8008bc:	01 d8                	add    %ebx,%eax
+  8008be:	50                   	push   %eax
+  8008bf:	e8 be ff ff ff       	call   800882 <strcpy>
+	return dst;
+}
+  8008c4:	89 d8                	mov    %ebx,%eax
+  8008c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008c9:	c9                   	leave
+  8008ca:	c3                   	ret
+
+008008cb <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008cb:	55                   	push   %ebp
+  8008cc:	89 e5                	mov    %esp,%ebp
+  8008ce:	56                   	push   %esi
+  8008cf:	53                   	push   %ebx
+  8008d0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008d6:	89 f3                	mov    %esi,%ebx
+  8008d8:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008db:	89 f0                	mov    %esi,%eax
+  8008dd:	eb 0f                	jmp    8008ee <strncpy+0x23>
+		*dst++ = *src;
+  8008df:	83 c0 01             	add    $0x1,%eax
+  8008e2:	0f b6 0a             	movzbl (%edx),%ecx
+  8008e5:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8008e8:	80 f9 01             	cmp    $0x1,%cl
+  8008eb:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008ee:	39 d8                	cmp    %ebx,%eax
+  8008f0:	75 ed                	jne    8008df <strncpy+0x14>
+	}
+	return ret;
+}
+  8008f2:	89 f0                	mov    %esi,%eax
+  8008f4:	5b                   	pop    %ebx
+  8008f5:	5e                   	pop    %esi
+  8008f6:	5d                   	pop    %ebp
+  8008f7:	c3                   	ret
+
+008008f8 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008f8:	55                   	push   %ebp
+  8008f9:	89 e5                	mov    %esp,%ebp
+  8008fb:	56                   	push   %esi
+  8008fc:	53                   	push   %ebx
+  8008fd:	8b 75 08             	mov    0x8(%ebp),%esi
+  800900:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800903:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800906:	89 f0                	mov    %esi,%eax
+  800908:	85 d2                	test   %edx,%edx
+  80090a:	74 21                	je     80092d <strlcpy+0x35>
+  80090c:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800910:	89 f2                	mov    %esi,%edx
+  800912:	eb 09                	jmp    80091d <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800914:	83 c1 01             	add    $0x1,%ecx
+  800917:	83 c2 01             	add    $0x1,%edx
+  80091a:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80091d:	39 c2                	cmp    %eax,%edx
+  80091f:	74 09                	je     80092a <strlcpy+0x32>
+  800921:	0f b6 19             	movzbl (%ecx),%ebx
+  800924:	84 db                	test   %bl,%bl
+  800926:	75 ec                	jne    800914 <strlcpy+0x1c>
+  800928:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80092a:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80092d:	29 f0                	sub    %esi,%eax
+}
+  80092f:	5b                   	pop    %ebx
+  800930:	5e                   	pop    %esi
+  800931:	5d                   	pop    %ebp
+  800932:	c3                   	ret
+
+00800933 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800933:	55                   	push   %ebp
+  800934:	89 e5                	mov    %esp,%ebp
+  800936:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800939:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80093c:	eb 06                	jmp    800944 <strcmp+0x11>
+		p++, q++;
+  80093e:	83 c1 01             	add    $0x1,%ecx
+  800941:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800944:	0f b6 01             	movzbl (%ecx),%eax
+  800947:	84 c0                	test   %al,%al
+  800949:	74 04                	je     80094f <strcmp+0x1c>
+  80094b:	3a 02                	cmp    (%edx),%al
+  80094d:	74 ef                	je     80093e <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80094f:	0f b6 c0             	movzbl %al,%eax
+  800952:	0f b6 12             	movzbl (%edx),%edx
+  800955:	29 d0                	sub    %edx,%eax
+}
+  800957:	5d                   	pop    %ebp
+  800958:	c3                   	ret
+
+00800959 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800959:	55                   	push   %ebp
+  80095a:	89 e5                	mov    %esp,%ebp
+  80095c:	53                   	push   %ebx
+  80095d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800960:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800963:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800966:	eb 09                	jmp    800971 <strncmp+0x18>
+		n--, p++, q++;
+  800968:	83 ea 01             	sub    $0x1,%edx
+  80096b:	83 c0 01             	add    $0x1,%eax
+  80096e:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800971:	85 d2                	test   %edx,%edx
+  800973:	74 18                	je     80098d <strncmp+0x34>
+  800975:	0f b6 18             	movzbl (%eax),%ebx
+  800978:	84 db                	test   %bl,%bl
+  80097a:	74 04                	je     800980 <strncmp+0x27>
+  80097c:	3a 19                	cmp    (%ecx),%bl
+  80097e:	74 e8                	je     800968 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800980:	0f b6 00             	movzbl (%eax),%eax
+  800983:	0f b6 11             	movzbl (%ecx),%edx
+  800986:	29 d0                	sub    %edx,%eax
+}
+  800988:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80098b:	c9                   	leave
+  80098c:	c3                   	ret
+		return 0;
+  80098d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800992:	eb f4                	jmp    800988 <strncmp+0x2f>
+
+00800994 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800994:	55                   	push   %ebp
+  800995:	89 e5                	mov    %esp,%ebp
+  800997:	8b 45 08             	mov    0x8(%ebp),%eax
+  80099a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80099e:	eb 03                	jmp    8009a3 <strchr+0xf>
+  8009a0:	83 c0 01             	add    $0x1,%eax
+  8009a3:	0f b6 10             	movzbl (%eax),%edx
+  8009a6:	84 d2                	test   %dl,%dl
+  8009a8:	74 06                	je     8009b0 <strchr+0x1c>
+		if (*s == c)
+  8009aa:	38 ca                	cmp    %cl,%dl
+  8009ac:	75 f2                	jne    8009a0 <strchr+0xc>
+  8009ae:	eb 05                	jmp    8009b5 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009b0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009b5:	5d                   	pop    %ebp
+  8009b6:	c3                   	ret
+
+008009b7 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009b7:	55                   	push   %ebp
+  8009b8:	89 e5                	mov    %esp,%ebp
+  8009ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009bd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009c1:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8009c4:	38 ca                	cmp    %cl,%dl
+  8009c6:	74 09                	je     8009d1 <strfind+0x1a>
+  8009c8:	84 d2                	test   %dl,%dl
+  8009ca:	74 05                	je     8009d1 <strfind+0x1a>
+	for (; *s; s++)
+  8009cc:	83 c0 01             	add    $0x1,%eax
+  8009cf:	eb f0                	jmp    8009c1 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009d1:	5d                   	pop    %ebp
+  8009d2:	c3                   	ret
+
+008009d3 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009d3:	55                   	push   %ebp
+  8009d4:	89 e5                	mov    %esp,%ebp
+  8009d6:	57                   	push   %edi
+  8009d7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009da:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8009dd:	85 c9                	test   %ecx,%ecx
+  8009df:	74 20                	je     800a01 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8009e1:	89 f8                	mov    %edi,%eax
+  8009e3:	09 c8                	or     %ecx,%eax
+  8009e5:	a8 03                	test   $0x3,%al
+  8009e7:	75 12                	jne    8009fb <memset+0x28>
+		c &= 0xFF;
+  8009e9:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009ed:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8009f3:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009f6:	fc                   	cld
+  8009f7:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009f9:	eb 06                	jmp    800a01 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009fe:	fc                   	cld
+  8009ff:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a01:	89 f8                	mov    %edi,%eax
+  800a03:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a06:	c9                   	leave
+  800a07:	c3                   	ret
+
+00800a08 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a08:	55                   	push   %ebp
+  800a09:	89 e5                	mov    %esp,%ebp
+  800a0b:	57                   	push   %edi
+  800a0c:	56                   	push   %esi
+  800a0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a10:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a13:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a16:	39 c6                	cmp    %eax,%esi
+  800a18:	73 32                	jae    800a4c <memmove+0x44>
+  800a1a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a1d:	39 d0                	cmp    %edx,%eax
+  800a1f:	73 2b                	jae    800a4c <memmove+0x44>
+		s += n;
+		d += n;
+  800a21:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a24:	89 d6                	mov    %edx,%esi
+  800a26:	09 fe                	or     %edi,%esi
+  800a28:	09 ce                	or     %ecx,%esi
+  800a2a:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a30:	75 0e                	jne    800a40 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a32:	83 ef 04             	sub    $0x4,%edi
+  800a35:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a38:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a3b:	fd                   	std
+  800a3c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a3e:	eb 09                	jmp    800a49 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a40:	83 ef 01             	sub    $0x1,%edi
+  800a43:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a46:	fd                   	std
+  800a47:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a49:	fc                   	cld
+  800a4a:	eb 1a                	jmp    800a66 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a4c:	89 f2                	mov    %esi,%edx
+  800a4e:	09 c2                	or     %eax,%edx
+  800a50:	09 ca                	or     %ecx,%edx
+  800a52:	f6 c2 03             	test   $0x3,%dl
+  800a55:	75 0a                	jne    800a61 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a57:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a5a:	89 c7                	mov    %eax,%edi
+  800a5c:	fc                   	cld
+  800a5d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a5f:	eb 05                	jmp    800a66 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a61:	89 c7                	mov    %eax,%edi
+  800a63:	fc                   	cld
+  800a64:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a66:	5e                   	pop    %esi
+  800a67:	5f                   	pop    %edi
+  800a68:	5d                   	pop    %ebp
+  800a69:	c3                   	ret
+
+00800a6a <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a6a:	55                   	push   %ebp
+  800a6b:	89 e5                	mov    %esp,%ebp
+  800a6d:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a70:	ff 75 10             	push   0x10(%ebp)
+  800a73:	ff 75 0c             	push   0xc(%ebp)
+  800a76:	ff 75 08             	push   0x8(%ebp)
+  800a79:	e8 8a ff ff ff       	call   800a08 <memmove>
+}
+  800a7e:	c9                   	leave
+  800a7f:	c3                   	ret
+
+00800a80 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a80:	55                   	push   %ebp
+  800a81:	89 e5                	mov    %esp,%ebp
+  800a83:	56                   	push   %esi
+  800a84:	53                   	push   %ebx
+  800a85:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a88:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a8b:	89 c6                	mov    %eax,%esi
+  800a8d:	03 75 10             	add    0x10(%ebp),%esi
+  800a90:	eb 06                	jmp    800a98 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a92:	83 c0 01             	add    $0x1,%eax
+  800a95:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a98:	39 f0                	cmp    %esi,%eax
+  800a9a:	74 14                	je     800ab0 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a9c:	0f b6 08             	movzbl (%eax),%ecx
+  800a9f:	0f b6 1a             	movzbl (%edx),%ebx
+  800aa2:	38 d9                	cmp    %bl,%cl
+  800aa4:	74 ec                	je     800a92 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800aa6:	0f b6 c1             	movzbl %cl,%eax
+  800aa9:	0f b6 db             	movzbl %bl,%ebx
+  800aac:	29 d8                	sub    %ebx,%eax
+  800aae:	eb 05                	jmp    800ab5 <memcmp+0x35>
+	}
+
+	return 0;
+  800ab0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ab5:	5b                   	pop    %ebx
+  800ab6:	5e                   	pop    %esi
+  800ab7:	5d                   	pop    %ebp
+  800ab8:	c3                   	ret
+
+00800ab9 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ab9:	55                   	push   %ebp
+  800aba:	89 e5                	mov    %esp,%ebp
+  800abc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800abf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800ac2:	89 c2                	mov    %eax,%edx
+  800ac4:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800ac7:	eb 03                	jmp    800acc <memfind+0x13>
+  800ac9:	83 c0 01             	add    $0x1,%eax
+  800acc:	39 d0                	cmp    %edx,%eax
+  800ace:	73 04                	jae    800ad4 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800ad0:	38 08                	cmp    %cl,(%eax)
+  800ad2:	75 f5                	jne    800ac9 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800ad4:	5d                   	pop    %ebp
+  800ad5:	c3                   	ret
+
+00800ad6 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800ad6:	55                   	push   %ebp
+  800ad7:	89 e5                	mov    %esp,%ebp
+  800ad9:	57                   	push   %edi
+  800ada:	56                   	push   %esi
+  800adb:	53                   	push   %ebx
+  800adc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800adf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800ae2:	eb 03                	jmp    800ae7 <strtol+0x11>
+		s++;
+  800ae4:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800ae7:	0f b6 02             	movzbl (%edx),%eax
+  800aea:	3c 20                	cmp    $0x20,%al
+  800aec:	74 f6                	je     800ae4 <strtol+0xe>
+  800aee:	3c 09                	cmp    $0x9,%al
+  800af0:	74 f2                	je     800ae4 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800af2:	3c 2b                	cmp    $0x2b,%al
+  800af4:	74 2a                	je     800b20 <strtol+0x4a>
+	int neg = 0;
+  800af6:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800afb:	3c 2d                	cmp    $0x2d,%al
+  800afd:	74 2b                	je     800b2a <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800aff:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b05:	75 0f                	jne    800b16 <strtol+0x40>
+  800b07:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b0a:	74 28                	je     800b34 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b0c:	85 db                	test   %ebx,%ebx
+  800b0e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b13:	0f 44 d8             	cmove  %eax,%ebx
+  800b16:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b1b:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b1e:	eb 46                	jmp    800b66 <strtol+0x90>
+		s++;
+  800b20:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b23:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b28:	eb d5                	jmp    800aff <strtol+0x29>
+		s++, neg = 1;
+  800b2a:	83 c2 01             	add    $0x1,%edx
+  800b2d:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b32:	eb cb                	jmp    800aff <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b34:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b38:	74 0e                	je     800b48 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b3a:	85 db                	test   %ebx,%ebx
+  800b3c:	75 d8                	jne    800b16 <strtol+0x40>
+		s++, base = 8;
+  800b3e:	83 c2 01             	add    $0x1,%edx
+  800b41:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b46:	eb ce                	jmp    800b16 <strtol+0x40>
+		s += 2, base = 16;
+  800b48:	83 c2 02             	add    $0x2,%edx
+  800b4b:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b50:	eb c4                	jmp    800b16 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b52:	0f be c0             	movsbl %al,%eax
+  800b55:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b58:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b5b:	7d 3a                	jge    800b97 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b5d:	83 c2 01             	add    $0x1,%edx
+  800b60:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b64:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b66:	0f b6 02             	movzbl (%edx),%eax
+  800b69:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b6c:	89 f3                	mov    %esi,%ebx
+  800b6e:	80 fb 09             	cmp    $0x9,%bl
+  800b71:	76 df                	jbe    800b52 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b73:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b76:	89 f3                	mov    %esi,%ebx
+  800b78:	80 fb 19             	cmp    $0x19,%bl
+  800b7b:	77 08                	ja     800b85 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b7d:	0f be c0             	movsbl %al,%eax
+  800b80:	83 e8 57             	sub    $0x57,%eax
+  800b83:	eb d3                	jmp    800b58 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b85:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b88:	89 f3                	mov    %esi,%ebx
+  800b8a:	80 fb 19             	cmp    $0x19,%bl
+  800b8d:	77 08                	ja     800b97 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b8f:	0f be c0             	movsbl %al,%eax
+  800b92:	83 e8 37             	sub    $0x37,%eax
+  800b95:	eb c1                	jmp    800b58 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b97:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b9b:	74 05                	je     800ba2 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b9d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ba0:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ba2:	89 c8                	mov    %ecx,%eax
+  800ba4:	f7 d8                	neg    %eax
+  800ba6:	85 ff                	test   %edi,%edi
+  800ba8:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800bab:	89 c8                	mov    %ecx,%eax
+  800bad:	5b                   	pop    %ebx
+  800bae:	5e                   	pop    %esi
+  800baf:	5f                   	pop    %edi
+  800bb0:	5d                   	pop    %ebp
+  800bb1:	c3                   	ret
+
+00800bb2 <atoi>:
+
+int
+atoi(const char *s)
+{
+  800bb2:	55                   	push   %ebp
+  800bb3:	89 e5                	mov    %esp,%ebp
+  800bb5:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800bb8:	6a 0a                	push   $0xa
+  800bba:	6a 00                	push   $0x0
+  800bbc:	ff 75 08             	push   0x8(%ebp)
+  800bbf:	e8 12 ff ff ff       	call   800ad6 <strtol>
+}
+  800bc4:	c9                   	leave
+  800bc5:	c3                   	ret
+
+00800bc6 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800bc6:	55                   	push   %ebp
+  800bc7:	89 e5                	mov    %esp,%ebp
+  800bc9:	57                   	push   %edi
+  800bca:	56                   	push   %esi
+  800bcb:	53                   	push   %ebx
+  800bcc:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800bd2:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800bd8:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800bde:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800be4:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800beb:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800bee:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800bf5:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800bf8:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800bff:	74 76                	je     800c77 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800c01:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800c07:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c0a:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800c10:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  800c17:	0f 88 06 01 00 00    	js     800d23 <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800c1d:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  800c24:	0f 84 48 01 00 00    	je     800d72 <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800c2a:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800c30:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800c36:	be 00 00 00 00       	mov    $0x0,%esi
+  800c3b:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800c41:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c44:	55                   	push   %ebp
+  800c45:	68 4e 0c 80 00       	push   $0x800c4e
+  800c4a:	89 e5                	mov    %esp,%ebp
+  800c4c:	0f 34                	sysenter
+  800c4e:	83 c4 04             	add    $0x4,%esp
+  800c51:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800c52:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800c58:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800c5e:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800c61:	0f 85 9a 01 00 00    	jne    800e01 <page_vec_call+0x23b>
+  800c67:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c6c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c6f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c72:	e9 29 01 00 00       	jmp    800da0 <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800c77:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800c7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c80:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800c82:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  800c89:	78 2f                	js     800cba <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800c8b:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  800c92:	74 72                	je     800d06 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800c94:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800c9a:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800ca0:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ca5:	89 fb                	mov    %edi,%ebx
+  800ca7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800caa:	55                   	push   %ebp
+  800cab:	68 b4 0c 80 00       	push   $0x800cb4
+  800cb0:	89 e5                	mov    %esp,%ebp
+  800cb2:	0f 34                	sysenter
+  800cb4:	83 c4 04             	add    $0x4,%esp
+  800cb7:	5d                   	pop    %ebp
+	return ret;
+  800cb8:	eb 98                	jmp    800c52 <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800cba:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cbf:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800cc1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800cc6:	f6 c6 08             	test   $0x8,%dh
+  800cc9:	74 15                	je     800ce0 <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ccb:	89 c2                	mov    %eax,%edx
+  800ccd:	c1 ea 08             	shr    $0x8,%edx
+  800cd0:	83 e2 0f             	and    $0xf,%edx
+  800cd3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800cd8:	83 fa 06             	cmp    $0x6,%edx
+  800cdb:	74 0e                	je     800ceb <page_vec_call+0x125>
+  800cdd:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800ce0:	0f b6 c9             	movzbl %cl,%ecx
+  800ce3:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  800ce9:	eb a0                	jmp    800c8b <page_vec_call+0xc5>
+  800ceb:	89 c2                	mov    %eax,%edx
+  800ced:	c1 ea 04             	shr    $0x4,%edx
+  800cf0:	83 e2 0f             	and    $0xf,%edx
+  800cf3:	83 fa 02             	cmp    $0x2,%edx
+  800cf6:	77 e5                	ja     800cdd <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800cf8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800cfb:	83 f8 02             	cmp    $0x2,%eax
+  800cfe:	0f 97 c1             	seta   %cl
+  800d01:	0f b6 c9             	movzbl %cl,%ecx
+  800d04:	eb d7                	jmp    800cdd <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800d06:	b8 10 00 00 00       	mov    $0x10,%eax
+  800d0b:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800d11:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800d17:	89 fb                	mov    %edi,%ebx
+  800d19:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800d1c:	cd 30                	int    $0x30
+  800d1e:	e9 2f ff ff ff       	jmp    800c52 <page_vec_call+0x8c>
+  800d23:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d28:	0f a2                	cpuid
+		return 0;
+  800d2a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800d2f:	f6 c6 08             	test   $0x8,%dh
+  800d32:	74 15                	je     800d49 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d34:	89 c2                	mov    %eax,%edx
+  800d36:	c1 ea 08             	shr    $0x8,%edx
+  800d39:	83 e2 0f             	and    $0xf,%edx
+  800d3c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d41:	83 fa 06             	cmp    $0x6,%edx
+  800d44:	74 11                	je     800d57 <page_vec_call+0x191>
+  800d46:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800d49:	0f b6 c9             	movzbl %cl,%ecx
+  800d4c:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  800d52:	e9 c6 fe ff ff       	jmp    800c1d <page_vec_call+0x57>
+  800d57:	89 c2                	mov    %eax,%edx
+  800d59:	c1 ea 04             	shr    $0x4,%edx
+  800d5c:	83 e2 0f             	and    $0xf,%edx
+  800d5f:	83 fa 02             	cmp    $0x2,%edx
+  800d62:	77 e2                	ja     800d46 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800d64:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d67:	83 f8 02             	cmp    $0x2,%eax
+  800d6a:	0f 97 c1             	seta   %cl
+  800d6d:	0f b6 c9             	movzbl %cl,%ecx
+  800d70:	eb d4                	jmp    800d46 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800d72:	be 00 00 00 00       	mov    $0x0,%esi
+  800d77:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800d7d:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800d83:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800d89:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800d8c:	cd 30                	int    $0x30
+  800d8e:	e9 bf fe ff ff       	jmp    800c52 <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800d93:	29 da                	sub    %ebx,%edx
+			vec++;
+  800d95:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800d98:	83 e8 01             	sub    $0x1,%eax
+  800d9b:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800da0:	85 c0                	test   %eax,%eax
+  800da2:	74 58                	je     800dfc <page_vec_call+0x236>
+  800da4:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800da7:	39 da                	cmp    %ebx,%edx
+  800da9:	73 e8                	jae    800d93 <page_vec_call+0x1cd>
+  800dab:	89 75 08             	mov    %esi,0x8(%ebp)
+  800dae:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800db1:	84 c9                	test   %cl,%cl
+  800db3:	74 06                	je     800dbb <page_vec_call+0x1f5>
+  800db5:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800dbb:	83 ec 04             	sub    $0x4,%esp
+  800dbe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800dc1:	c1 e0 04             	shl    $0x4,%eax
+  800dc4:	50                   	push   %eax
+  800dc5:	ff 75 08             	push   0x8(%ebp)
+  800dc8:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800dce:	53                   	push   %ebx
+  800dcf:	e8 34 fc ff ff       	call   800a08 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800dd4:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800dda:	89 c2                	mov    %eax,%edx
+  800ddc:	c1 e2 0c             	shl    $0xc,%edx
+  800ddf:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  800de5:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  800deb:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  800df1:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  800df4:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  800df7:	e9 f2 fd ff ff       	jmp    800bee <page_vec_call+0x28>
+			r = 0;
+  800dfc:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  800e01:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800e05:	74 0b                	je     800e12 <page_vec_call+0x24c>
+		*done = total;
+  800e07:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800e0a:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  800e10:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  800e12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e15:	5b                   	pop    %ebx
+  800e16:	5e                   	pop    %esi
+  800e17:	5f                   	pop    %edi
+  800e18:	5d                   	pop    %ebp
+  800e19:	c3                   	ret
+
+00800e1a <sys_cputs>:
+{
+  800e1a:	55                   	push   %ebp
+  800e1b:	89 e5                	mov    %esp,%ebp
+  800e1d:	57                   	push   %edi
+  800e1e:	56                   	push   %esi
+  800e1f:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800e20:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  800e27:	78 2d                	js     800e56 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800e29:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  800e30:	74 70                	je     800ea2 <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800e32:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e37:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3d:	89 c3                	mov    %eax,%ebx
+  800e3f:	89 c7                	mov    %eax,%edi
+  800e41:	89 c6                	mov    %eax,%esi
+  800e43:	55                   	push   %ebp
+  800e44:	68 4d 0e 80 00       	push   $0x800e4d
+  800e49:	89 e5                	mov    %esp,%ebp
+  800e4b:	0f 34                	sysenter
+  800e4d:	83 c4 04             	add    $0x4,%esp
+  800e50:	5d                   	pop    %ebp
+}
+  800e51:	5b                   	pop    %ebx
+  800e52:	5e                   	pop    %esi
+  800e53:	5f                   	pop    %edi
+  800e54:	5d                   	pop    %ebp
+  800e55:	c3                   	ret
+  800e56:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e5b:	0f a2                	cpuid
+		return 0;
+  800e5d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800e62:	f6 c6 08             	test   $0x8,%dh
+  800e65:	74 15                	je     800e7c <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e67:	89 c2                	mov    %eax,%edx
+  800e69:	c1 ea 08             	shr    $0x8,%edx
+  800e6c:	83 e2 0f             	and    $0xf,%edx
+  800e6f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e74:	83 fa 06             	cmp    $0x6,%edx
+  800e77:	74 0e                	je     800e87 <sys_cputs+0x6d>
+  800e79:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e7c:	0f b6 c9             	movzbl %cl,%ecx
+  800e7f:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  800e85:	eb a2                	jmp    800e29 <sys_cputs+0xf>
+  800e87:	89 c2                	mov    %eax,%edx
+  800e89:	c1 ea 04             	shr    $0x4,%edx
+  800e8c:	83 e2 0f             	and    $0xf,%edx
+  800e8f:	83 fa 02             	cmp    $0x2,%edx
+  800e92:	77 e5                	ja     800e79 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800e94:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e97:	83 f8 02             	cmp    $0x2,%eax
+  800e9a:	0f 97 c1             	seta   %cl
+  800e9d:	0f b6 c9             	movzbl %cl,%ecx
+  800ea0:	eb d7                	jmp    800e79 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800ea2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ea7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eaa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ead:	89 c3                	mov    %eax,%ebx
+  800eaf:	89 c7                	mov    %eax,%edi
+  800eb1:	89 c6                	mov    %eax,%esi
+  800eb3:	cd 30                	int    $0x30
+}
+  800eb5:	eb 9a                	jmp    800e51 <sys_cputs+0x37>
+
+00800eb7 <sys_cgetc>:
+{
+  800eb7:	55                   	push   %ebp
+  800eb8:	89 e5                	mov    %esp,%ebp
+  800eba:	57                   	push   %edi
+  800ebb:	56                   	push   %esi
+  800ebc:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800ebd:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  800ec4:	78 2e                	js     800ef4 <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  800ec6:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  800ecd:	74 71                	je     800f40 <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  800ecf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ed4:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ed9:	89 d1                	mov    %edx,%ecx
+  800edb:	89 d3                	mov    %edx,%ebx
+  800edd:	89 d7                	mov    %edx,%edi
+  800edf:	89 d6                	mov    %edx,%esi
+  800ee1:	55                   	push   %ebp
+  800ee2:	68 eb 0e 80 00       	push   $0x800eeb
+  800ee7:	89 e5                	mov    %esp,%ebp
+  800ee9:	0f 34                	sysenter
+  800eeb:	83 c4 04             	add    $0x4,%esp
+  800eee:	5d                   	pop    %ebp
+}
+  800eef:	5b                   	pop    %ebx
+  800ef0:	5e                   	pop    %esi
+  800ef1:	5f                   	pop    %edi
+  800ef2:	5d                   	pop    %ebp
+  800ef3:	c3                   	ret
+  800ef4:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ef9:	0f a2                	cpuid
+		return 0;
+  800efb:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f00:	f6 c6 08             	test   $0x8,%dh
+  800f03:	74 15                	je     800f1a <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f05:	89 c2                	mov    %eax,%edx
+  800f07:	c1 ea 08             	shr    $0x8,%edx
+  800f0a:	83 e2 0f             	and    $0xf,%edx
+  800f0d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f12:	83 fa 06             	cmp    $0x6,%edx
+  800f15:	74 0e                	je     800f25 <sys_cgetc+0x6e>
+  800f17:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f1a:	0f b6 c9             	movzbl %cl,%ecx
+  800f1d:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  800f23:	eb a1                	jmp    800ec6 <sys_cgetc+0xf>
+  800f25:	89 c2                	mov    %eax,%edx
+  800f27:	c1 ea 04             	shr    $0x4,%edx
+  800f2a:	83 e2 0f             	and    $0xf,%edx
+  800f2d:	83 fa 02             	cmp    $0x2,%edx
+  800f30:	77 e5                	ja     800f17 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  800f32:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f35:	83 f8 02             	cmp    $0x2,%eax
+  800f38:	0f 97 c1             	seta   %cl
+  800f3b:	0f b6 c9             	movzbl %cl,%ecx
+  800f3e:	eb d7                	jmp    800f17 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  800f40:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f45:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f4a:	89 d1                	mov    %edx,%ecx
+  800f4c:	89 d3                	mov    %edx,%ebx
+  800f4e:	89 d7                	mov    %edx,%edi
+  800f50:	89 d6                	mov    %edx,%esi
+  800f52:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800f54:	eb 99                	jmp    800eef <sys_cgetc+0x38>
+
+00800f56 <sys_env_destroy>:
+{
+  800f56:	55                   	push   %ebp
+  800f57:	89 e5                	mov    %esp,%ebp
+  800f59:	57                   	push   %edi
+  800f5a:	56                   	push   %esi
+  800f5b:	53                   	push   %ebx
+  800f5c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800f5f:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  800f66:	78 36                	js     800f9e <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  800f68:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  800f6f:	74 79                	je     800fea <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  800f71:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f74:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f79:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f7e:	89 cb                	mov    %ecx,%ebx
+  800f80:	89 cf                	mov    %ecx,%edi
+  800f82:	89 ce                	mov    %ecx,%esi
+  800f84:	55                   	push   %ebp
+  800f85:	68 8e 0f 80 00       	push   $0x800f8e
+  800f8a:	89 e5                	mov    %esp,%ebp
+  800f8c:	0f 34                	sysenter
+  800f8e:	83 c4 04             	add    $0x4,%esp
+  800f91:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800f92:	85 c0                	test   %eax,%eax
+  800f94:	7f 6b                	jg     801001 <sys_env_destroy+0xab>
+}
+  800f96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f99:	5b                   	pop    %ebx
+  800f9a:	5e                   	pop    %esi
+  800f9b:	5f                   	pop    %edi
+  800f9c:	5d                   	pop    %ebp
+  800f9d:	c3                   	ret
+  800f9e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fa3:	0f a2                	cpuid
+		return 0;
+  800fa5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800faa:	f6 c6 08             	test   $0x8,%dh
+  800fad:	74 15                	je     800fc4 <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800faf:	89 c2                	mov    %eax,%edx
+  800fb1:	c1 ea 08             	shr    $0x8,%edx
+  800fb4:	83 e2 0f             	and    $0xf,%edx
+  800fb7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800fbc:	83 fa 06             	cmp    $0x6,%edx
+  800fbf:	74 0e                	je     800fcf <sys_env_destroy+0x79>
+  800fc1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800fc4:	0f b6 c9             	movzbl %cl,%ecx
+  800fc7:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  800fcd:	eb 99                	jmp    800f68 <sys_env_destroy+0x12>
+  800fcf:	89 c2                	mov    %eax,%edx
+  800fd1:	c1 ea 04             	shr    $0x4,%edx
+  800fd4:	83 e2 0f             	and    $0xf,%edx
+  800fd7:	83 fa 02             	cmp    $0x2,%edx
+  800fda:	77 e5                	ja     800fc1 <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  800fdc:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800fdf:	83 f8 02             	cmp    $0x2,%eax
+  800fe2:	0f 97 c1             	seta   %cl
+  800fe5:	0f b6 c9             	movzbl %cl,%ecx
+  800fe8:	eb d7                	jmp    800fc1 <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  800fea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fef:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ff4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff7:	89 cb                	mov    %ecx,%ebx
+  800ff9:	89 cf                	mov    %ecx,%edi
+  800ffb:	89 ce                	mov    %ecx,%esi
+  800ffd:	cd 30                	int    $0x30
+  800fff:	eb 91                	jmp    800f92 <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801001:	83 ec 0c             	sub    $0xc,%esp
+  801004:	50                   	push   %eax
+  801005:	6a 03                	push   $0x3
+  801007:	68 59 33 80 00       	push   $0x803359
+  80100c:	6a 4a                	push   $0x4a
+  80100e:	68 76 33 80 00       	push   $0x803376
+  801013:	e8 b2 1c 00 00       	call   802cca <_panic>
+
+00801018 <sys_getenvid>:
+{
+  801018:	55                   	push   %ebp
+  801019:	89 e5                	mov    %esp,%ebp
+  80101b:	57                   	push   %edi
+  80101c:	56                   	push   %esi
+  80101d:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80101e:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  801025:	78 2e                	js     801055 <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  801027:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  80102e:	74 71                	je     8010a1 <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  801030:	ba 00 00 00 00       	mov    $0x0,%edx
+  801035:	b8 02 00 00 00       	mov    $0x2,%eax
+  80103a:	89 d1                	mov    %edx,%ecx
+  80103c:	89 d3                	mov    %edx,%ebx
+  80103e:	89 d7                	mov    %edx,%edi
+  801040:	89 d6                	mov    %edx,%esi
+  801042:	55                   	push   %ebp
+  801043:	68 4c 10 80 00       	push   $0x80104c
+  801048:	89 e5                	mov    %esp,%ebp
+  80104a:	0f 34                	sysenter
+  80104c:	83 c4 04             	add    $0x4,%esp
+  80104f:	5d                   	pop    %ebp
+}
+  801050:	5b                   	pop    %ebx
+  801051:	5e                   	pop    %esi
+  801052:	5f                   	pop    %edi
+  801053:	5d                   	pop    %ebp
+  801054:	c3                   	ret
+  801055:	b8 01 00 00 00       	mov    $0x1,%eax
+  80105a:	0f a2                	cpuid
+		return 0;
+  80105c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801061:	f6 c6 08             	test   $0x8,%dh
+  801064:	74 15                	je     80107b <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801066:	89 c2                	mov    %eax,%edx
+  801068:	c1 ea 08             	shr    $0x8,%edx
+  80106b:	83 e2 0f             	and    $0xf,%edx
+  80106e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801073:	83 fa 06             	cmp    $0x6,%edx
+  801076:	74 0e                	je     801086 <sys_getenvid+0x6e>
+  801078:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80107b:	0f b6 c9             	movzbl %cl,%ecx
+  80107e:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  801084:	eb a1                	jmp    801027 <sys_getenvid+0xf>
+  801086:	89 c2                	mov    %eax,%edx
+  801088:	c1 ea 04             	shr    $0x4,%edx
+  80108b:	83 e2 0f             	and    $0xf,%edx
+  80108e:	83 fa 02             	cmp    $0x2,%edx
+  801091:	77 e5                	ja     801078 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  801093:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801096:	83 f8 02             	cmp    $0x2,%eax
+  801099:	0f 97 c1             	seta   %cl
+  80109c:	0f b6 c9             	movzbl %cl,%ecx
+  80109f:	eb d7                	jmp    801078 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  8010a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010a6:	b8 02 00 00 00       	mov    $0x2,%eax
+  8010ab:	89 d1                	mov    %edx,%ecx
+  8010ad:	89 d3                	mov    %edx,%ebx
+  8010af:	89 d7                	mov    %edx,%edi
+  8010b1:	89 d6                	mov    %edx,%esi
+  8010b3:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  8010b5:	eb 99                	jmp    801050 <sys_getenvid+0x38>
+
+008010b7 <sys_page_alloc>:
+{
+  8010b7:	55                   	push   %ebp
+  8010b8:	89 e5                	mov    %esp,%ebp
+  8010ba:	57                   	push   %edi
+  8010bb:	56                   	push   %esi
+  8010bc:	53                   	push   %ebx
+  8010bd:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8010c0:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  8010c7:	78 38                	js     801101 <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  8010c9:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  8010d0:	74 7b                	je     80114d <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  8010d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8010d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010dd:	b8 04 00 00 00       	mov    $0x4,%eax
+  8010e2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010e5:	89 f7                	mov    %esi,%edi
+  8010e7:	55                   	push   %ebp
+  8010e8:	68 f1 10 80 00       	push   $0x8010f1
+  8010ed:	89 e5                	mov    %esp,%ebp
+  8010ef:	0f 34                	sysenter
+  8010f1:	83 c4 04             	add    $0x4,%esp
+  8010f4:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8010f5:	85 c0                	test   %eax,%eax
+  8010f7:	7f 6d                	jg     801166 <sys_page_alloc+0xaf>
+}
+  8010f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010fc:	5b                   	pop    %ebx
+  8010fd:	5e                   	pop    %esi
+  8010fe:	5f                   	pop    %edi
+  8010ff:	5d                   	pop    %ebp
+  801100:	c3                   	ret
+  801101:	b8 01 00 00 00       	mov    $0x1,%eax
+  801106:	0f a2                	cpuid
+		return 0;
+  801108:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80110d:	f6 c6 08             	test   $0x8,%dh
+  801110:	74 15                	je     801127 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801112:	89 c2                	mov    %eax,%edx
+  801114:	c1 ea 08             	shr    $0x8,%edx
+  801117:	83 e2 0f             	and    $0xf,%edx
+  80111a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80111f:	83 fa 06             	cmp    $0x6,%edx
+  801122:	74 0e                	je     801132 <sys_page_alloc+0x7b>
+  801124:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801127:	0f b6 c9             	movzbl %cl,%ecx
+  80112a:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  801130:	eb 97                	jmp    8010c9 <sys_page_alloc+0x12>
+  801132:	89 c2                	mov    %eax,%edx
+  801134:	c1 ea 04             	shr    $0x4,%edx
+  801137:	83 e2 0f             	and    $0xf,%edx
+  80113a:	83 fa 02             	cmp    $0x2,%edx
+  80113d:	77 e5                	ja     801124 <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  80113f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801142:	83 f8 02             	cmp    $0x2,%eax
+  801145:	0f 97 c1             	seta   %cl
+  801148:	0f b6 c9             	movzbl %cl,%ecx
+  80114b:	eb d7                	jmp    801124 <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  80114d:	be 00 00 00 00       	mov    $0x0,%esi
+  801152:	b8 04 00 00 00       	mov    $0x4,%eax
+  801157:	8b 55 08             	mov    0x8(%ebp),%edx
+  80115a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801160:	89 f7                	mov    %esi,%edi
+  801162:	cd 30                	int    $0x30
+  801164:	eb 8f                	jmp    8010f5 <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801166:	83 ec 0c             	sub    $0xc,%esp
+  801169:	50                   	push   %eax
+  80116a:	6a 04                	push   $0x4
+  80116c:	68 59 33 80 00       	push   $0x803359
+  801171:	6a 4a                	push   $0x4a
+  801173:	68 76 33 80 00       	push   $0x803376
+  801178:	e8 4d 1b 00 00       	call   802cca <_panic>
+
+0080117d <sys_page_map>:
+{
+  80117d:	55                   	push   %ebp
+  80117e:	89 e5                	mov    %esp,%ebp
+  801180:	57                   	push   %edi
+  801181:	56                   	push   %esi
+  801182:	53                   	push   %ebx
+  801183:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801186:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  80118d:	78 37                	js     8011c6 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  80118f:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  801196:	74 7a                	je     801212 <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  801198:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80119e:	b8 05 00 00 00       	mov    $0x5,%eax
+  8011a3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011a6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011a9:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011ac:	55                   	push   %ebp
+  8011ad:	68 b6 11 80 00       	push   $0x8011b6
+  8011b2:	89 e5                	mov    %esp,%ebp
+  8011b4:	0f 34                	sysenter
+  8011b6:	83 c4 04             	add    $0x4,%esp
+  8011b9:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8011ba:	85 c0                	test   %eax,%eax
+  8011bc:	7f 6c                	jg     80122a <sys_page_map+0xad>
+}
+  8011be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011c1:	5b                   	pop    %ebx
+  8011c2:	5e                   	pop    %esi
+  8011c3:	5f                   	pop    %edi
+  8011c4:	5d                   	pop    %ebp
+  8011c5:	c3                   	ret
+  8011c6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011cb:	0f a2                	cpuid
+		return 0;
+  8011cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8011d2:	f6 c6 08             	test   $0x8,%dh
+  8011d5:	74 15                	je     8011ec <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011d7:	89 c2                	mov    %eax,%edx
+  8011d9:	c1 ea 08             	shr    $0x8,%edx
+  8011dc:	83 e2 0f             	and    $0xf,%edx
+  8011df:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011e4:	83 fa 06             	cmp    $0x6,%edx
+  8011e7:	74 0e                	je     8011f7 <sys_page_map+0x7a>
+  8011e9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8011ec:	0f b6 c9             	movzbl %cl,%ecx
+  8011ef:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  8011f5:	eb 98                	jmp    80118f <sys_page_map+0x12>
+  8011f7:	89 c2                	mov    %eax,%edx
+  8011f9:	c1 ea 04             	shr    $0x4,%edx
+  8011fc:	83 e2 0f             	and    $0xf,%edx
+  8011ff:	83 fa 02             	cmp    $0x2,%edx
+  801202:	77 e5                	ja     8011e9 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  801204:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801207:	83 f8 02             	cmp    $0x2,%eax
+  80120a:	0f 97 c1             	seta   %cl
+  80120d:	0f b6 c9             	movzbl %cl,%ecx
+  801210:	eb d7                	jmp    8011e9 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  801212:	b8 05 00 00 00       	mov    $0x5,%eax
+  801217:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80121d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801220:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801223:	8b 75 18             	mov    0x18(%ebp),%esi
+  801226:	cd 30                	int    $0x30
+  801228:	eb 90                	jmp    8011ba <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80122a:	83 ec 0c             	sub    $0xc,%esp
+  80122d:	50                   	push   %eax
+  80122e:	6a 05                	push   $0x5
+  801230:	68 59 33 80 00       	push   $0x803359
+  801235:	6a 4a                	push   $0x4a
+  801237:	68 76 33 80 00       	push   $0x803376
+  80123c:	e8 89 1a 00 00       	call   802cca <_panic>
+
+00801241 <sys_page_unmap>:
+{
+  801241:	55                   	push   %ebp
+  801242:	89 e5                	mov    %esp,%ebp
+  801244:	57                   	push   %edi
+  801245:	56                   	push   %esi
+  801246:	53                   	push   %ebx
+  801247:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80124a:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  801251:	78 37                	js     80128a <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  801253:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  80125a:	74 7a                	je     8012d6 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  80125c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801261:	8b 55 08             	mov    0x8(%ebp),%edx
+  801264:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801267:	b8 06 00 00 00       	mov    $0x6,%eax
+  80126c:	89 df                	mov    %ebx,%edi
+  80126e:	89 de                	mov    %ebx,%esi
+  801270:	55                   	push   %ebp
+  801271:	68 7a 12 80 00       	push   $0x80127a
+  801276:	89 e5                	mov    %esp,%ebp
+  801278:	0f 34                	sysenter
+  80127a:	83 c4 04             	add    $0x4,%esp
+  80127d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80127e:	85 c0                	test   %eax,%eax
+  801280:	7f 6c                	jg     8012ee <sys_page_unmap+0xad>
+}
+  801282:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801285:	5b                   	pop    %ebx
+  801286:	5e                   	pop    %esi
+  801287:	5f                   	pop    %edi
+  801288:	5d                   	pop    %ebp
+  801289:	c3                   	ret
+  80128a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80128f:	0f a2                	cpuid
+		return 0;
+  801291:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801296:	f6 c6 08             	test   $0x8,%dh
+  801299:	74 15                	je     8012b0 <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80129b:	89 c2                	mov    %eax,%edx
+  80129d:	c1 ea 08             	shr    $0x8,%edx
+  8012a0:	83 e2 0f             	and    $0xf,%edx
+  8012a3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012a8:	83 fa 06             	cmp    $0x6,%edx
+  8012ab:	74 0e                	je     8012bb <sys_page_unmap+0x7a>
+  8012ad:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8012b0:	0f b6 c9             	movzbl %cl,%ecx
+  8012b3:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  8012b9:	eb 98                	jmp    801253 <sys_page_unmap+0x12>
+  8012bb:	89 c2                	mov    %eax,%edx
+  8012bd:	c1 ea 04             	shr    $0x4,%edx
+  8012c0:	83 e2 0f             	and    $0xf,%edx
+  8012c3:	83 fa 02             	cmp    $0x2,%edx
+  8012c6:	77 e5                	ja     8012ad <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  8012c8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012cb:	83 f8 02             	cmp    $0x2,%eax
+  8012ce:	0f 97 c1             	seta   %cl
+  8012d1:	0f b6 c9             	movzbl %cl,%ecx
+  8012d4:	eb d7                	jmp    8012ad <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  8012d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012db:	b8 06 00 00 00       	mov    $0x6,%eax
+  8012e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e6:	89 df                	mov    %ebx,%edi
+  8012e8:	89 de                	mov    %ebx,%esi
+  8012ea:	cd 30                	int    $0x30
+  8012ec:	eb 90                	jmp    80127e <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012ee:	83 ec 0c             	sub    $0xc,%esp
+  8012f1:	50                   	push   %eax
+  8012f2:	6a 06                	push   $0x6
+  8012f4:	68 59 33 80 00       	push   $0x803359
+  8012f9:	6a 4a                	push   $0x4a
+  8012fb:	68 76 33 80 00       	push   $0x803376
+  801300:	e8 c5 19 00 00       	call   802cca <_panic>
+
+00801305 <sys_page_copy>:
+{
+  801305:	55                   	push   %ebp
+  801306:	89 e5                	mov    %esp,%ebp
+  801308:	57                   	push   %edi
+  801309:	56                   	push   %esi
+  80130a:	53                   	push   %ebx
+  80130b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80130e:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  801315:	78 37                	js     80134e <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  801317:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  80131e:	74 7a                	je     80139a <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  801320:	8b 55 08             	mov    0x8(%ebp),%edx
+  801323:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801326:	b8 29 00 00 00       	mov    $0x29,%eax
+  80132b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80132e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801331:	8b 75 18             	mov    0x18(%ebp),%esi
+  801334:	55                   	push   %ebp
+  801335:	68 3e 13 80 00       	push   $0x80133e
+  80133a:	89 e5                	mov    %esp,%ebp
+  80133c:	0f 34                	sysenter
+  80133e:	83 c4 04             	add    $0x4,%esp
+  801341:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801342:	85 c0                	test   %eax,%eax
+  801344:	7f 6c                	jg     8013b2 <sys_page_copy+0xad>
+}
+  801346:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801349:	5b                   	pop    %ebx
+  80134a:	5e                   	pop    %esi
+  80134b:	5f                   	pop    %edi
+  80134c:	5d                   	pop    %ebp
+  80134d:	c3                   	ret
+  80134e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801353:	0f a2                	cpuid
+		return 0;
+  801355:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80135a:	f6 c6 08             	test   $0x8,%dh
+  80135d:	74 15                	je     801374 <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80135f:	89 c2                	mov    %eax,%edx
+  801361:	c1 ea 08             	shr    $0x8,%edx
+  801364:	83 e2 0f             	and    $0xf,%edx
+  801367:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80136c:	83 fa 06             	cmp    $0x6,%edx
+  80136f:	74 0e                	je     80137f <sys_page_copy+0x7a>
+  801371:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801374:	0f b6 c9             	movzbl %cl,%ecx
+  801377:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  80137d:	eb 98                	jmp    801317 <sys_page_copy+0x12>
+  80137f:	89 c2                	mov    %eax,%edx
+  801381:	c1 ea 04             	shr    $0x4,%edx
+  801384:	83 e2 0f             	and    $0xf,%edx
+  801387:	83 fa 02             	cmp    $0x2,%edx
+  80138a:	77 e5                	ja     801371 <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  80138c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80138f:	83 f8 02             	cmp    $0x2,%eax
+  801392:	0f 97 c1             	seta   %cl
+  801395:	0f b6 c9             	movzbl %cl,%ecx
+  801398:	eb d7                	jmp    801371 <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  80139a:	b8 29 00 00 00       	mov    $0x29,%eax
+  80139f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013a8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013ab:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013ae:	cd 30                	int    $0x30
+  8013b0:	eb 90                	jmp    801342 <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013b2:	83 ec 0c             	sub    $0xc,%esp
+  8013b5:	50                   	push   %eax
+  8013b6:	6a 29                	push   $0x29
+  8013b8:	68 59 33 80 00       	push   $0x803359
+  8013bd:	6a 4a                	push   $0x4a
+  8013bf:	68 76 33 80 00       	push   $0x803376
+  8013c4:	e8 01 19 00 00       	call   802cca <_panic>
+
+008013c9 <sys_yield>:
+{
+  8013c9:	55                   	push   %ebp
+  8013ca:	89 e5                	mov    %esp,%ebp
+  8013cc:	57                   	push   %edi
+  8013cd:	56                   	push   %esi
+  8013ce:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8013cf:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  8013d6:	78 2e                	js     801406 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  8013d8:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  8013df:	74 71                	je     801452 <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  8013e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013e6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8013eb:	89 d1                	mov    %edx,%ecx
+  8013ed:	89 d3                	mov    %edx,%ebx
+  8013ef:	89 d7                	mov    %edx,%edi
+  8013f1:	89 d6                	mov    %edx,%esi
+  8013f3:	55                   	push   %ebp
+  8013f4:	68 fd 13 80 00       	push   $0x8013fd
+  8013f9:	89 e5                	mov    %esp,%ebp
+  8013fb:	0f 34                	sysenter
+  8013fd:	83 c4 04             	add    $0x4,%esp
+  801400:	5d                   	pop    %ebp
+}
+  801401:	5b                   	pop    %ebx
+  801402:	5e                   	pop    %esi
+  801403:	5f                   	pop    %edi
+  801404:	5d                   	pop    %ebp
+  801405:	c3                   	ret
+  801406:	b8 01 00 00 00       	mov    $0x1,%eax
+  80140b:	0f a2                	cpuid
+		return 0;
+  80140d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801412:	f6 c6 08             	test   $0x8,%dh
+  801415:	74 15                	je     80142c <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801417:	89 c2                	mov    %eax,%edx
+  801419:	c1 ea 08             	shr    $0x8,%edx
+  80141c:	83 e2 0f             	and    $0xf,%edx
+  80141f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801424:	83 fa 06             	cmp    $0x6,%edx
+  801427:	74 0e                	je     801437 <sys_yield+0x6e>
+  801429:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80142c:	0f b6 c9             	movzbl %cl,%ecx
+  80142f:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  801435:	eb a1                	jmp    8013d8 <sys_yield+0xf>
+  801437:	89 c2                	mov    %eax,%edx
+  801439:	c1 ea 04             	shr    $0x4,%edx
+  80143c:	83 e2 0f             	and    $0xf,%edx
+  80143f:	83 fa 02             	cmp    $0x2,%edx
+  801442:	77 e5                	ja     801429 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  801444:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801447:	83 f8 02             	cmp    $0x2,%eax
+  80144a:	0f 97 c1             	seta   %cl
+  80144d:	0f b6 c9             	movzbl %cl,%ecx
+  801450:	eb d7                	jmp    801429 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  801452:	ba 00 00 00 00       	mov    $0x0,%edx
+  801457:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80145c:	89 d1                	mov    %edx,%ecx
+  80145e:	89 d3                	mov    %edx,%ebx
+  801460:	89 d7                	mov    %edx,%edi
+  801462:	89 d6                	mov    %edx,%esi
+  801464:	cd 30                	int    $0x30
+}
+  801466:	eb 99                	jmp    801401 <sys_yield+0x38>
+
+00801468 <sys_env_set_status>:
+{
+  801468:	55                   	push   %ebp
+  801469:	89 e5                	mov    %esp,%ebp
+  80146b:	57                   	push   %edi
+  80146c:	56                   	push   %esi
+  80146d:	53                   	push   %ebx
+  80146e:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801471:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  801478:	78 37                	js     8014b1 <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  80147a:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  801481:	74 7a                	je     8014fd <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  801483:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801488:	8b 55 08             	mov    0x8(%ebp),%edx
+  80148b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80148e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801493:	89 df                	mov    %ebx,%edi
+  801495:	89 de                	mov    %ebx,%esi
+  801497:	55                   	push   %ebp
+  801498:	68 a1 14 80 00       	push   $0x8014a1
+  80149d:	89 e5                	mov    %esp,%ebp
+  80149f:	0f 34                	sysenter
+  8014a1:	83 c4 04             	add    $0x4,%esp
+  8014a4:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8014a5:	85 c0                	test   %eax,%eax
+  8014a7:	7f 6c                	jg     801515 <sys_env_set_status+0xad>
+}
+  8014a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ac:	5b                   	pop    %ebx
+  8014ad:	5e                   	pop    %esi
+  8014ae:	5f                   	pop    %edi
+  8014af:	5d                   	pop    %ebp
+  8014b0:	c3                   	ret
+  8014b1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014b6:	0f a2                	cpuid
+		return 0;
+  8014b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8014bd:	f6 c6 08             	test   $0x8,%dh
+  8014c0:	74 15                	je     8014d7 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014c2:	89 c2                	mov    %eax,%edx
+  8014c4:	c1 ea 08             	shr    $0x8,%edx
+  8014c7:	83 e2 0f             	and    $0xf,%edx
+  8014ca:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8014cf:	83 fa 06             	cmp    $0x6,%edx
+  8014d2:	74 0e                	je     8014e2 <sys_env_set_status+0x7a>
+  8014d4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8014d7:	0f b6 c9             	movzbl %cl,%ecx
+  8014da:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  8014e0:	eb 98                	jmp    80147a <sys_env_set_status+0x12>
+  8014e2:	89 c2                	mov    %eax,%edx
+  8014e4:	c1 ea 04             	shr    $0x4,%edx
+  8014e7:	83 e2 0f             	and    $0xf,%edx
+  8014ea:	83 fa 02             	cmp    $0x2,%edx
+  8014ed:	77 e5                	ja     8014d4 <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  8014ef:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014f2:	83 f8 02             	cmp    $0x2,%eax
+  8014f5:	0f 97 c1             	seta   %cl
+  8014f8:	0f b6 c9             	movzbl %cl,%ecx
+  8014fb:	eb d7                	jmp    8014d4 <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  8014fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801502:	b8 08 00 00 00       	mov    $0x8,%eax
+  801507:	8b 55 08             	mov    0x8(%ebp),%edx
+  80150a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80150d:	89 df                	mov    %ebx,%edi
+  80150f:	89 de                	mov    %ebx,%esi
+  801511:	cd 30                	int    $0x30
+  801513:	eb 90                	jmp    8014a5 <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801515:	83 ec 0c             	sub    $0xc,%esp
+  801518:	50                   	push   %eax
+  801519:	6a 08                	push   $0x8
+  80151b:	68 59 33 80 00       	push   $0x803359
+  801520:	6a 4a                	push   $0x4a
+  801522:	68 76 33 80 00       	push   $0x803376
+  801527:	e8 9e 17 00 00       	call   802cca <_panic>
+
+0080152c <sys_sysinfo>:
+{
+  80152c:	55                   	push   %ebp
+  80152d:	89 e5                	mov    %esp,%ebp
+  80152f:	57                   	push   %edi
+  801530:	56                   	push   %esi
+  801531:	53                   	push   %ebx
+  801532:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801535:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  80153c:	78 36                	js     801574 <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  80153e:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  801545:	74 79                	je     8015c0 <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  801547:	8b 55 08             	mov    0x8(%ebp),%edx
+  80154a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80154f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801554:	89 cb                	mov    %ecx,%ebx
+  801556:	89 cf                	mov    %ecx,%edi
+  801558:	89 ce                	mov    %ecx,%esi
+  80155a:	55                   	push   %ebp
+  80155b:	68 64 15 80 00       	push   $0x801564
+  801560:	89 e5                	mov    %esp,%ebp
+  801562:	0f 34                	sysenter
+  801564:	83 c4 04             	add    $0x4,%esp
+  801567:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801568:	85 c0                	test   %eax,%eax
+  80156a:	7f 6b                	jg     8015d7 <sys_sysinfo+0xab>
+}
+  80156c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80156f:	5b                   	pop    %ebx
+  801570:	5e                   	pop    %esi
+  801571:	5f                   	pop    %edi
+  801572:	5d                   	pop    %ebp
+  801573:	c3                   	ret
+  801574:	b8 01 00 00 00       	mov    $0x1,%eax
+  801579:	0f a2                	cpuid
+		return 0;
+  80157b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801580:	f6 c6 08             	test   $0x8,%dh
+  801583:	74 15                	je     80159a <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801585:	89 c2                	mov    %eax,%edx
+  801587:	c1 ea 08             	shr    $0x8,%edx
+  80158a:	83 e2 0f             	and    $0xf,%edx
+  80158d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801592:	83 fa 06             	cmp    $0x6,%edx
+  801595:	74 0e                	je     8015a5 <sys_sysinfo+0x79>
+  801597:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80159a:	0f b6 c9             	movzbl %cl,%ecx
+  80159d:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  8015a3:	eb 99                	jmp    80153e <sys_sysinfo+0x12>
+  8015a5:	89 c2                	mov    %eax,%edx
+  8015a7:	c1 ea 04             	shr    $0x4,%edx
+  8015aa:	83 e2 0f             	and    $0xf,%edx
+  8015ad:	83 fa 02             	cmp    $0x2,%edx
+  8015b0:	77 e5                	ja     801597 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  8015b2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015b5:	83 f8 02             	cmp    $0x2,%eax
+  8015b8:	0f 97 c1             	seta   %cl
+  8015bb:	0f b6 c9             	movzbl %cl,%ecx
+  8015be:	eb d7                	jmp    801597 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  8015c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015c5:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8015ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015cd:	89 cb                	mov    %ecx,%ebx
+  8015cf:	89 cf                	mov    %ecx,%edi
+  8015d1:	89 ce                	mov    %ecx,%esi
+  8015d3:	cd 30                	int    $0x30
+  8015d5:	eb 91                	jmp    801568 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015d7:	83 ec 0c             	sub    $0xc,%esp
+  8015da:	50                   	push   %eax
+  8015db:	6a 0b                	push   $0xb
+  8015dd:	68 59 33 80 00       	push   $0x803359
+  8015e2:	6a 4a                	push   $0x4a
+  8015e4:	68 76 33 80 00       	push   $0x803376
+  8015e9:	e8 dc 16 00 00       	call   802cca <_panic>
+
+008015ee <sys_env_set_trapframe>:
+{
+  8015ee:	55                   	push   %ebp
+  8015ef:	89 e5                	mov    %esp,%ebp
+  8015f1:	57                   	push   %edi
+  8015f2:	56                   	push   %esi
+  8015f3:	53                   	push   %ebx
+  8015f4:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8015f7:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  8015fe:	78 37                	js     801637 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  801600:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  801607:	74 7a                	je     801683 <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  801609:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80160e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801611:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801614:	b8 13 00 00 00       	mov    $0x13,%eax
+  801619:	89 df                	mov    %ebx,%edi
+  80161b:	89 de                	mov    %ebx,%esi
+  80161d:	55                   	push   %ebp
+  80161e:	68 27 16 80 00       	push   $0x801627
+  801623:	89 e5                	mov    %esp,%ebp
+  801625:	0f 34                	sysenter
+  801627:	83 c4 04             	add    $0x4,%esp
+  80162a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80162b:	85 c0                	test   %eax,%eax
+  80162d:	7f 6c                	jg     80169b <sys_env_set_trapframe+0xad>
+}
+  80162f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801632:	5b                   	pop    %ebx
+  801633:	5e                   	pop    %esi
+  801634:	5f                   	pop    %edi
+  801635:	5d                   	pop    %ebp
+  801636:	c3                   	ret
+  801637:	b8 01 00 00 00       	mov    $0x1,%eax
+  80163c:	0f a2                	cpuid
+		return 0;
+  80163e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801643:	f6 c6 08             	test   $0x8,%dh
+  801646:	74 15                	je     80165d <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801648:	89 c2                	mov    %eax,%edx
+  80164a:	c1 ea 08             	shr    $0x8,%edx
+  80164d:	83 e2 0f             	and    $0xf,%edx
+  801650:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801655:	83 fa 06             	cmp    $0x6,%edx
+  801658:	74 0e                	je     801668 <sys_env_set_trapframe+0x7a>
+  80165a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80165d:	0f b6 c9             	movzbl %cl,%ecx
+  801660:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  801666:	eb 98                	jmp    801600 <sys_env_set_trapframe+0x12>
+  801668:	89 c2                	mov    %eax,%edx
+  80166a:	c1 ea 04             	shr    $0x4,%edx
+  80166d:	83 e2 0f             	and    $0xf,%edx
+  801670:	83 fa 02             	cmp    $0x2,%edx
+  801673:	77 e5                	ja     80165a <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  801675:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801678:	83 f8 02             	cmp    $0x2,%eax
+  80167b:	0f 97 c1             	seta   %cl
+  80167e:	0f b6 c9             	movzbl %cl,%ecx
+  801681:	eb d7                	jmp    80165a <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  801683:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801688:	b8 13 00 00 00       	mov    $0x13,%eax
+  80168d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801690:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801693:	89 df                	mov    %ebx,%edi
+  801695:	89 de                	mov    %ebx,%esi
+  801697:	cd 30                	int    $0x30
+  801699:	eb 90                	jmp    80162b <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80169b:	83 ec 0c             	sub    $0xc,%esp
+  80169e:	50                   	push   %eax
+  80169f:	6a 13                	push   $0x13
+  8016a1:	68 59 33 80 00       	push   $0x803359
+  8016a6:	6a 4a                	push   $0x4a
+  8016a8:	68 76 33 80 00       	push   $0x803376
+  8016ad:	e8 18 16 00 00       	call   802cca <_panic>
+
+008016b2 <sys_env_set_stack_limit>:
+{
+  8016b2:	55                   	push   %ebp
+  8016b3:	89 e5                	mov    %esp,%ebp
+  8016b5:	57                   	push   %edi
+  8016b6:	56                   	push   %esi
+  8016b7:	53                   	push   %ebx
+  8016b8:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8016bb:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  8016c2:	78 37                	js     8016fb <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  8016c4:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  8016cb:	74 7a                	je     801747 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  8016cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016d8:	b8 19 00 00 00       	mov    $0x19,%eax
+  8016dd:	89 df                	mov    %ebx,%edi
+  8016df:	89 de                	mov    %ebx,%esi
+  8016e1:	55                   	push   %ebp
+  8016e2:	68 eb 16 80 00       	push   $0x8016eb
+  8016e7:	89 e5                	mov    %esp,%ebp
+  8016e9:	0f 34                	sysenter
+  8016eb:	83 c4 04             	add    $0x4,%esp
+  8016ee:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8016ef:	85 c0                	test   %eax,%eax
+  8016f1:	7f 6c                	jg     80175f <sys_env_set_stack_limit+0xad>
+}
+  8016f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016f6:	5b                   	pop    %ebx
+  8016f7:	5e                   	pop    %esi
+  8016f8:	5f                   	pop    %edi
+  8016f9:	5d                   	pop    %ebp
+  8016fa:	c3                   	ret
+  8016fb:	b8 01 00 00 00       	mov    $0x1,%eax
+  801700:	0f a2                	cpuid
+		return 0;
+  801702:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801707:	f6 c6 08             	test   $0x8,%dh
+  80170a:	74 15                	je     801721 <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80170c:	89 c2                	mov    %eax,%edx
+  80170e:	c1 ea 08             	shr    $0x8,%edx
+  801711:	83 e2 0f             	and    $0xf,%edx
+  801714:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801719:	83 fa 06             	cmp    $0x6,%edx
+  80171c:	74 0e                	je     80172c <sys_env_set_stack_limit+0x7a>
+  80171e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801721:	0f b6 c9             	movzbl %cl,%ecx
+  801724:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  80172a:	eb 98                	jmp    8016c4 <sys_env_set_stack_limit+0x12>
+  80172c:	89 c2                	mov    %eax,%edx
+  80172e:	c1 ea 04             	shr    $0x4,%edx
+  801731:	83 e2 0f             	and    $0xf,%edx
+  801734:	83 fa 02             	cmp    $0x2,%edx
+  801737:	77 e5                	ja     80171e <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  801739:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80173c:	83 f8 02             	cmp    $0x2,%eax
+  80173f:	0f 97 c1             	seta   %cl
+  801742:	0f b6 c9             	movzbl %cl,%ecx
+  801745:	eb d7                	jmp    80171e <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  801747:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80174c:	b8 19 00 00 00       	mov    $0x19,%eax
+  801751:	8b 55 08             	mov    0x8(%ebp),%edx
+  801754:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801757:	89 df                	mov    %ebx,%edi
+  801759:	89 de                	mov    %ebx,%esi
+  80175b:	cd 30                	int    $0x30
+  80175d:	eb 90                	jmp    8016ef <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80175f:	83 ec 0c             	sub    $0xc,%esp
+  801762:	50                   	push   %eax
+  801763:	6a 19                	push   $0x19
+  801765:	68 59 33 80 00       	push   $0x803359
+  80176a:	6a 4a                	push   $0x4a
+  80176c:	68 76 33 80 00       	push   $0x803376
+  801771:	e8 54 15 00 00       	call   802cca <_panic>
+
+00801776 <sys_env_set_pgfault_upcall>:
+{
+  801776:	55                   	push   %ebp
+  801777:	89 e5                	mov    %esp,%ebp
+  801779:	57                   	push   %edi
+  80177a:	56                   	push   %esi
+  80177b:	53                   	push   %ebx
+  80177c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80177f:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  801786:	78 37                	js     8017bf <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  801788:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  80178f:	74 7a                	je     80180b <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  801791:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801796:	8b 55 08             	mov    0x8(%ebp),%edx
+  801799:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80179c:	b8 09 00 00 00       	mov    $0x9,%eax
+  8017a1:	89 df                	mov    %ebx,%edi
+  8017a3:	89 de                	mov    %ebx,%esi
+  8017a5:	55                   	push   %ebp
+  8017a6:	68 af 17 80 00       	push   $0x8017af
+  8017ab:	89 e5                	mov    %esp,%ebp
+  8017ad:	0f 34                	sysenter
+  8017af:	83 c4 04             	add    $0x4,%esp
+  8017b2:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8017b3:	85 c0                	test   %eax,%eax
+  8017b5:	7f 6c                	jg     801823 <sys_env_set_pgfault_upcall+0xad>
+}
+  8017b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017ba:	5b                   	pop    %ebx
+  8017bb:	5e                   	pop    %esi
+  8017bc:	5f                   	pop    %edi
+  8017bd:	5d                   	pop    %ebp
+  8017be:	c3                   	ret
+  8017bf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8017c4:	0f a2                	cpuid
+		return 0;
+  8017c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8017cb:	f6 c6 08             	test   $0x8,%dh
+  8017ce:	74 15                	je     8017e5 <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017d0:	89 c2                	mov    %eax,%edx
+  8017d2:	c1 ea 08             	shr    $0x8,%edx
+  8017d5:	83 e2 0f             	and    $0xf,%edx
+  8017d8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017dd:	83 fa 06             	cmp    $0x6,%edx
+  8017e0:	74 0e                	je     8017f0 <sys_env_set_pgfault_upcall+0x7a>
+  8017e2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8017e5:	0f b6 c9             	movzbl %cl,%ecx
+  8017e8:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  8017ee:	eb 98                	jmp    801788 <sys_env_set_pgfault_upcall+0x12>
+  8017f0:	89 c2                	mov    %eax,%edx
+  8017f2:	c1 ea 04             	shr    $0x4,%edx
+  8017f5:	83 e2 0f             	and    $0xf,%edx
+  8017f8:	83 fa 02             	cmp    $0x2,%edx
+  8017fb:	77 e5                	ja     8017e2 <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  8017fd:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801800:	83 f8 02             	cmp    $0x2,%eax
+  801803:	0f 97 c1             	seta   %cl
+  801806:	0f b6 c9             	movzbl %cl,%ecx
+  801809:	eb d7                	jmp    8017e2 <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  80180b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801810:	b8 09 00 00 00       	mov    $0x9,%eax
+  801815:	8b 55 08             	mov    0x8(%ebp),%edx
+  801818:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80181b:	89 df                	mov    %ebx,%edi
+  80181d:	89 de                	mov    %ebx,%esi
+  80181f:	cd 30                	int    $0x30
+  801821:	eb 90                	jmp    8017b3 <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801823:	83 ec 0c             	sub    $0xc,%esp
+  801826:	50                   	push   %eax
+  801827:	6a 09                	push   $0x9
+  801829:	68 59 33 80 00       	push   $0x803359
+  80182e:	6a 4a                	push   $0x4a
+  801830:	68 76 33 80 00       	push   $0x803376
+  801835:	e8 90 14 00 00       	call   802cca <_panic>
+
+0080183a <sys_ipc_try_send>:
+{
+  80183a:	55                   	push   %ebp
+  80183b:	89 e5                	mov    %esp,%ebp
+  80183d:	57                   	push   %edi
+  80183e:	56                   	push   %esi
+  80183f:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801840:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  801847:	78 32                	js     80187b <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  801849:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  801850:	74 75                	je     8018c7 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801852:	8b 55 08             	mov    0x8(%ebp),%edx
+  801855:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801858:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80185d:	be 00 00 00 00       	mov    $0x0,%esi
+  801862:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801865:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801868:	55                   	push   %ebp
+  801869:	68 72 18 80 00       	push   $0x801872
+  80186e:	89 e5                	mov    %esp,%ebp
+  801870:	0f 34                	sysenter
+  801872:	83 c4 04             	add    $0x4,%esp
+  801875:	5d                   	pop    %ebp
+}
+  801876:	5b                   	pop    %ebx
+  801877:	5e                   	pop    %esi
+  801878:	5f                   	pop    %edi
+  801879:	5d                   	pop    %ebp
+  80187a:	c3                   	ret
+  80187b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801880:	0f a2                	cpuid
+		return 0;
+  801882:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801887:	f6 c6 08             	test   $0x8,%dh
+  80188a:	74 15                	je     8018a1 <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80188c:	89 c2                	mov    %eax,%edx
+  80188e:	c1 ea 08             	shr    $0x8,%edx
+  801891:	83 e2 0f             	and    $0xf,%edx
+  801894:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801899:	83 fa 06             	cmp    $0x6,%edx
+  80189c:	74 0e                	je     8018ac <sys_ipc_try_send+0x72>
+  80189e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8018a1:	0f b6 c9             	movzbl %cl,%ecx
+  8018a4:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  8018aa:	eb 9d                	jmp    801849 <sys_ipc_try_send+0xf>
+  8018ac:	89 c2                	mov    %eax,%edx
+  8018ae:	c1 ea 04             	shr    $0x4,%edx
+  8018b1:	83 e2 0f             	and    $0xf,%edx
+  8018b4:	83 fa 02             	cmp    $0x2,%edx
+  8018b7:	77 e5                	ja     80189e <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  8018b9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018bc:	83 f8 02             	cmp    $0x2,%eax
+  8018bf:	0f 97 c1             	seta   %cl
+  8018c2:	0f b6 c9             	movzbl %cl,%ecx
+  8018c5:	eb d7                	jmp    80189e <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  8018c7:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8018cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8018d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018d7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018da:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8018dd:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  8018df:	eb 95                	jmp    801876 <sys_ipc_try_send+0x3c>
+
+008018e1 <sys_ipc_send>:
+{
+  8018e1:	55                   	push   %ebp
+  8018e2:	89 e5                	mov    %esp,%ebp
+  8018e4:	57                   	push   %edi
+  8018e5:	56                   	push   %esi
+  8018e6:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8018e7:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  8018ee:	78 32                	js     801922 <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  8018f0:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  8018f7:	74 75                	je     80196e <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  8018f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018ff:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801904:	be 00 00 00 00       	mov    $0x0,%esi
+  801909:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80190c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80190f:	55                   	push   %ebp
+  801910:	68 19 19 80 00       	push   $0x801919
+  801915:	89 e5                	mov    %esp,%ebp
+  801917:	0f 34                	sysenter
+  801919:	83 c4 04             	add    $0x4,%esp
+  80191c:	5d                   	pop    %ebp
+}
+  80191d:	5b                   	pop    %ebx
+  80191e:	5e                   	pop    %esi
+  80191f:	5f                   	pop    %edi
+  801920:	5d                   	pop    %ebp
+  801921:	c3                   	ret
+  801922:	b8 01 00 00 00       	mov    $0x1,%eax
+  801927:	0f a2                	cpuid
+		return 0;
+  801929:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80192e:	f6 c6 08             	test   $0x8,%dh
+  801931:	74 15                	je     801948 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801933:	89 c2                	mov    %eax,%edx
+  801935:	c1 ea 08             	shr    $0x8,%edx
+  801938:	83 e2 0f             	and    $0xf,%edx
+  80193b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801940:	83 fa 06             	cmp    $0x6,%edx
+  801943:	74 0e                	je     801953 <sys_ipc_send+0x72>
+  801945:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801948:	0f b6 c9             	movzbl %cl,%ecx
+  80194b:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  801951:	eb 9d                	jmp    8018f0 <sys_ipc_send+0xf>
+  801953:	89 c2                	mov    %eax,%edx
+  801955:	c1 ea 04             	shr    $0x4,%edx
+  801958:	83 e2 0f             	and    $0xf,%edx
+  80195b:	83 fa 02             	cmp    $0x2,%edx
+  80195e:	77 e5                	ja     801945 <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  801960:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801963:	83 f8 02             	cmp    $0x2,%eax
+  801966:	0f 97 c1             	seta   %cl
+  801969:	0f b6 c9             	movzbl %cl,%ecx
+  80196c:	eb d7                	jmp    801945 <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  80196e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801973:	be 00 00 00 00       	mov    $0x0,%esi
+  801978:	8b 55 08             	mov    0x8(%ebp),%edx
+  80197b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80197e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801981:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801984:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801986:	eb 95                	jmp    80191d <sys_ipc_send+0x3c>
+
+00801988 <sys_ipc_recv>:
+{
+  801988:	55                   	push   %ebp
+  801989:	89 e5                	mov    %esp,%ebp
+  80198b:	57                   	push   %edi
+  80198c:	56                   	push   %esi
+  80198d:	53                   	push   %ebx
+  80198e:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801991:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  801998:	78 36                	js     8019d0 <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  80199a:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  8019a1:	74 79                	je     801a1c <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  8019a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019ab:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8019b0:	89 cb                	mov    %ecx,%ebx
+  8019b2:	89 cf                	mov    %ecx,%edi
+  8019b4:	89 ce                	mov    %ecx,%esi
+  8019b6:	55                   	push   %ebp
+  8019b7:	68 c0 19 80 00       	push   $0x8019c0
+  8019bc:	89 e5                	mov    %esp,%ebp
+  8019be:	0f 34                	sysenter
+  8019c0:	83 c4 04             	add    $0x4,%esp
+  8019c3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8019c4:	85 c0                	test   %eax,%eax
+  8019c6:	7f 6b                	jg     801a33 <sys_ipc_recv+0xab>
+}
+  8019c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019cb:	5b                   	pop    %ebx
+  8019cc:	5e                   	pop    %esi
+  8019cd:	5f                   	pop    %edi
+  8019ce:	5d                   	pop    %ebp
+  8019cf:	c3                   	ret
+  8019d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019d5:	0f a2                	cpuid
+		return 0;
+  8019d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8019dc:	f6 c6 08             	test   $0x8,%dh
+  8019df:	74 15                	je     8019f6 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019e1:	89 c2                	mov    %eax,%edx
+  8019e3:	c1 ea 08             	shr    $0x8,%edx
+  8019e6:	83 e2 0f             	and    $0xf,%edx
+  8019e9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019ee:	83 fa 06             	cmp    $0x6,%edx
+  8019f1:	74 0e                	je     801a01 <sys_ipc_recv+0x79>
+  8019f3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8019f6:	0f b6 c9             	movzbl %cl,%ecx
+  8019f9:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  8019ff:	eb 99                	jmp    80199a <sys_ipc_recv+0x12>
+  801a01:	89 c2                	mov    %eax,%edx
+  801a03:	c1 ea 04             	shr    $0x4,%edx
+  801a06:	83 e2 0f             	and    $0xf,%edx
+  801a09:	83 fa 02             	cmp    $0x2,%edx
+  801a0c:	77 e5                	ja     8019f3 <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  801a0e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a11:	83 f8 02             	cmp    $0x2,%eax
+  801a14:	0f 97 c1             	seta   %cl
+  801a17:	0f b6 c9             	movzbl %cl,%ecx
+  801a1a:	eb d7                	jmp    8019f3 <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  801a1c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a21:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801a26:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a29:	89 cb                	mov    %ecx,%ebx
+  801a2b:	89 cf                	mov    %ecx,%edi
+  801a2d:	89 ce                	mov    %ecx,%esi
+  801a2f:	cd 30                	int    $0x30
+  801a31:	eb 91                	jmp    8019c4 <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a33:	83 ec 0c             	sub    $0xc,%esp
+  801a36:	50                   	push   %eax
+  801a37:	6a 0d                	push   $0xd
+  801a39:	68 59 33 80 00       	push   $0x803359
+  801a3e:	6a 4a                	push   $0x4a
+  801a40:	68 76 33 80 00       	push   $0x803376
+  801a45:	e8 80 12 00 00       	call   802cca <_panic>
+
+00801a4a <sys_ipc_send_range>:
+{
+  801a4a:	55                   	push   %ebp
+  801a4b:	89 e5                	mov    %esp,%ebp
+  801a4d:	57                   	push   %edi
+  801a4e:	56                   	push   %esi
+  801a4f:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801a50:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  801a57:	78 30                	js     801a89 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  801a59:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  801a60:	74 73                	je     801ad5 <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801a62:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a65:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a68:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801a6d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a70:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a73:	8b 75 18             	mov    0x18(%ebp),%esi
+  801a76:	55                   	push   %ebp
+  801a77:	68 80 1a 80 00       	push   $0x801a80
+  801a7c:	89 e5                	mov    %esp,%ebp
+  801a7e:	0f 34                	sysenter
+  801a80:	83 c4 04             	add    $0x4,%esp
+  801a83:	5d                   	pop    %ebp
+}
+  801a84:	5b                   	pop    %ebx
+  801a85:	5e                   	pop    %esi
+  801a86:	5f                   	pop    %edi
+  801a87:	5d                   	pop    %ebp
+  801a88:	c3                   	ret
+  801a89:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a8e:	0f a2                	cpuid
+		return 0;
+  801a90:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801a95:	f6 c6 08             	test   $0x8,%dh
+  801a98:	74 15                	je     801aaf <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a9a:	89 c2                	mov    %eax,%edx
+  801a9c:	c1 ea 08             	shr    $0x8,%edx
+  801a9f:	83 e2 0f             	and    $0xf,%edx
+  801aa2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801aa7:	83 fa 06             	cmp    $0x6,%edx
+  801aaa:	74 0e                	je     801aba <sys_ipc_send_range+0x70>
+  801aac:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801aaf:	0f b6 c9             	movzbl %cl,%ecx
+  801ab2:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  801ab8:	eb 9f                	jmp    801a59 <sys_ipc_send_range+0xf>
+  801aba:	89 c2                	mov    %eax,%edx
+  801abc:	c1 ea 04             	shr    $0x4,%edx
+  801abf:	83 e2 0f             	and    $0xf,%edx
+  801ac2:	83 fa 02             	cmp    $0x2,%edx
+  801ac5:	77 e5                	ja     801aac <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  801ac7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801aca:	83 f8 02             	cmp    $0x2,%eax
+  801acd:	0f 97 c1             	seta   %cl
+  801ad0:	0f b6 c9             	movzbl %cl,%ecx
+  801ad3:	eb d7                	jmp    801aac <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  801ad5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801ada:	8b 55 08             	mov    0x8(%ebp),%edx
+  801add:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ae0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ae3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ae6:	8b 75 18             	mov    0x18(%ebp),%esi
+  801ae9:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  801aeb:	eb 97                	jmp    801a84 <sys_ipc_send_range+0x3a>
+
+00801aed <sys_ipc_recv_range>:
+{
+  801aed:	55                   	push   %ebp
+  801aee:	89 e5                	mov    %esp,%ebp
+  801af0:	57                   	push   %edi
+  801af1:	56                   	push   %esi
+  801af2:	53                   	push   %ebx
+  801af3:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801af6:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  801afd:	78 37                	js     801b36 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  801aff:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  801b06:	74 7a                	je     801b82 <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  801b08:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b10:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b13:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801b18:	89 df                	mov    %ebx,%edi
+  801b1a:	89 de                	mov    %ebx,%esi
+  801b1c:	55                   	push   %ebp
+  801b1d:	68 26 1b 80 00       	push   $0x801b26
+  801b22:	89 e5                	mov    %esp,%ebp
+  801b24:	0f 34                	sysenter
+  801b26:	83 c4 04             	add    $0x4,%esp
+  801b29:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801b2a:	85 c0                	test   %eax,%eax
+  801b2c:	7f 6c                	jg     801b9a <sys_ipc_recv_range+0xad>
+}
+  801b2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b31:	5b                   	pop    %ebx
+  801b32:	5e                   	pop    %esi
+  801b33:	5f                   	pop    %edi
+  801b34:	5d                   	pop    %ebp
+  801b35:	c3                   	ret
+  801b36:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b3b:	0f a2                	cpuid
+		return 0;
+  801b3d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b42:	f6 c6 08             	test   $0x8,%dh
+  801b45:	74 15                	je     801b5c <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b47:	89 c2                	mov    %eax,%edx
+  801b49:	c1 ea 08             	shr    $0x8,%edx
+  801b4c:	83 e2 0f             	and    $0xf,%edx
+  801b4f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b54:	83 fa 06             	cmp    $0x6,%edx
+  801b57:	74 0e                	je     801b67 <sys_ipc_recv_range+0x7a>
+  801b59:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b5c:	0f b6 c9             	movzbl %cl,%ecx
+  801b5f:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  801b65:	eb 98                	jmp    801aff <sys_ipc_recv_range+0x12>
+  801b67:	89 c2                	mov    %eax,%edx
+  801b69:	c1 ea 04             	shr    $0x4,%edx
+  801b6c:	83 e2 0f             	and    $0xf,%edx
+  801b6f:	83 fa 02             	cmp    $0x2,%edx
+  801b72:	77 e5                	ja     801b59 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801b74:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b77:	83 f8 02             	cmp    $0x2,%eax
+  801b7a:	0f 97 c1             	seta   %cl
+  801b7d:	0f b6 c9             	movzbl %cl,%ecx
+  801b80:	eb d7                	jmp    801b59 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801b82:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b87:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801b8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b92:	89 df                	mov    %ebx,%edi
+  801b94:	89 de                	mov    %ebx,%esi
+  801b96:	cd 30                	int    $0x30
+  801b98:	eb 90                	jmp    801b2a <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801b9a:	83 ec 0c             	sub    $0xc,%esp
+  801b9d:	50                   	push   %eax
+  801b9e:	6a 1f                	push   $0x1f
+  801ba0:	68 59 33 80 00       	push   $0x803359
+  801ba5:	6a 4a                	push   $0x4a
+  801ba7:	68 76 33 80 00       	push   $0x803376
+  801bac:	e8 19 11 00 00       	call   802cca <_panic>
+
+00801bb1 <sys_ipc_call>:
+{
+  801bb1:	55                   	push   %ebp
+  801bb2:	89 e5                	mov    %esp,%ebp
+  801bb4:	57                   	push   %edi
+  801bb5:	56                   	push   %esi
+  801bb6:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801bb7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bba:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801bbf:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801bc2:	55                   	push   %ebp
+  801bc3:	56                   	push   %esi
+  801bc4:	8b 0e                	mov    (%esi),%ecx
+  801bc6:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801bc9:	8b 7e 08             	mov    0x8(%esi),%edi
+  801bcc:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801bcf:	8b 76 0c             	mov    0xc(%esi),%esi
+  801bd2:	cd 30                	int    $0x30
+  801bd4:	87 34 24             	xchg   %esi,(%esp)
+  801bd7:	89 0e                	mov    %ecx,(%esi)
+  801bd9:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801bdc:	89 7e 08             	mov    %edi,0x8(%esi)
+  801bdf:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801be2:	8f 46 0c             	pop    0xc(%esi)
+  801be5:	5d                   	pop    %ebp
+}
+  801be6:	5b                   	pop    %ebx
+  801be7:	5e                   	pop    %esi
+  801be8:	5f                   	pop    %edi
+  801be9:	5d                   	pop    %ebp
+  801bea:	c3                   	ret
+
+00801beb <sys_ipc_reply_wait>:
+{
+  801beb:	55                   	push   %ebp
+  801bec:	89 e5                	mov    %esp,%ebp
+  801bee:	57                   	push   %edi
+  801bef:	56                   	push   %esi
+  801bf0:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801bf1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bf4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801bf9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801bfc:	55                   	push   %ebp
+  801bfd:	56                   	push   %esi
+  801bfe:	8b 0e                	mov    (%esi),%ecx
+  801c00:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801c03:	8b 7e 08             	mov    0x8(%esi),%edi
+  801c06:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801c09:	8b 76 0c             	mov    0xc(%esi),%esi
+  801c0c:	cd 30                	int    $0x30
+  801c0e:	87 34 24             	xchg   %esi,(%esp)
+  801c11:	89 0e                	mov    %ecx,(%esi)
+  801c13:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801c16:	89 7e 08             	mov    %edi,0x8(%esi)
+  801c19:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801c1c:	8f 46 0c             	pop    0xc(%esi)
+  801c1f:	5d                   	pop    %ebp
+}
+  801c20:	5b                   	pop    %ebx
+  801c21:	5e                   	pop    %esi
+  801c22:	5f                   	pop    %edi
+  801c23:	5d                   	pop    %ebp
+  801c24:	c3                   	ret
+
+00801c25 <sys_ipc_send_msg>:
+{
+  801c25:	55                   	push   %ebp
+  801c26:	89 e5                	mov    %esp,%ebp
+  801c28:	57                   	push   %edi
+  801c29:	56                   	push   %esi
+  801c2a:	53                   	push   %ebx
+  801c2b:	83 ec 20             	sub    $0x20,%esp
+  801c2e:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801c31:	8b 10                	mov    (%eax),%edx
+  801c33:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801c36:	8b 50 04             	mov    0x4(%eax),%edx
+  801c39:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801c3c:	8b 50 08             	mov    0x8(%eax),%edx
+  801c3f:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801c42:	8b 50 0c             	mov    0xc(%eax),%edx
+  801c45:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801c48:	8b 40 10             	mov    0x10(%eax),%eax
+  801c4b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801c4e:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801c51:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c54:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801c59:	55                   	push   %ebp
+  801c5a:	56                   	push   %esi
+  801c5b:	8b 0e                	mov    (%esi),%ecx
+  801c5d:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801c60:	8b 7e 08             	mov    0x8(%esi),%edi
+  801c63:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801c66:	8b 76 0c             	mov    0xc(%esi),%esi
+  801c69:	cd 30                	int    $0x30
+  801c6b:	87 34 24             	xchg   %esi,(%esp)
+  801c6e:	89 0e                	mov    %ecx,(%esi)
+  801c70:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801c73:	89 7e 08             	mov    %edi,0x8(%esi)
+  801c76:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801c79:	8f 46 0c             	pop    0xc(%esi)
+  801c7c:	5d                   	pop    %ebp
+}
+  801c7d:	83 c4 20             	add    $0x20,%esp
+  801c80:	5b                   	pop    %ebx
+  801c81:	5e                   	pop    %esi
+  801c82:	5f                   	pop    %edi
+  801c83:	5d                   	pop    %ebp
+  801c84:	c3                   	ret
+
+00801c85 <sys_fork>:
+{
+  801c85:	55                   	push   %ebp
+  801c86:	89 e5                	mov    %esp,%ebp
+  801c88:	57                   	push   %edi
+  801c89:	56                   	push   %esi
+  801c8a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801c8b:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  801c92:	78 2e                	js     801cc2 <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801c94:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  801c9b:	74 71                	je     801d0e <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801c9d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ca2:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801ca7:	89 d1                	mov    %edx,%ecx
+  801ca9:	89 d3                	mov    %edx,%ebx
+  801cab:	89 d7                	mov    %edx,%edi
+  801cad:	89 d6                	mov    %edx,%esi
+  801caf:	55                   	push   %ebp
+  801cb0:	68 b9 1c 80 00       	push   $0x801cb9
+  801cb5:	89 e5                	mov    %esp,%ebp
+  801cb7:	0f 34                	sysenter
+  801cb9:	83 c4 04             	add    $0x4,%esp
+  801cbc:	5d                   	pop    %ebp
+}
+  801cbd:	5b                   	pop    %ebx
+  801cbe:	5e                   	pop    %esi
+  801cbf:	5f                   	pop    %edi
+  801cc0:	5d                   	pop    %ebp
+  801cc1:	c3                   	ret
+  801cc2:	b8 01 00 00 00       	mov    $0x1,%eax
+  801cc7:	0f a2                	cpuid
+		return 0;
+  801cc9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801cce:	f6 c6 08             	test   $0x8,%dh
+  801cd1:	74 15                	je     801ce8 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801cd3:	89 c2                	mov    %eax,%edx
+  801cd5:	c1 ea 08             	shr    $0x8,%edx
+  801cd8:	83 e2 0f             	and    $0xf,%edx
+  801cdb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ce0:	83 fa 06             	cmp    $0x6,%edx
+  801ce3:	74 0e                	je     801cf3 <sys_fork+0x6e>
+  801ce5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801ce8:	0f b6 c9             	movzbl %cl,%ecx
+  801ceb:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  801cf1:	eb a1                	jmp    801c94 <sys_fork+0xf>
+  801cf3:	89 c2                	mov    %eax,%edx
+  801cf5:	c1 ea 04             	shr    $0x4,%edx
+  801cf8:	83 e2 0f             	and    $0xf,%edx
+  801cfb:	83 fa 02             	cmp    $0x2,%edx
+  801cfe:	77 e5                	ja     801ce5 <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801d00:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d03:	83 f8 02             	cmp    $0x2,%eax
+  801d06:	0f 97 c1             	seta   %cl
+  801d09:	0f b6 c9             	movzbl %cl,%ecx
+  801d0c:	eb d7                	jmp    801ce5 <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801d0e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d13:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801d18:	89 d1                	mov    %edx,%ecx
+  801d1a:	89 d3                	mov    %edx,%ebx
+  801d1c:	89 d7                	mov    %edx,%edi
+  801d1e:	89 d6                	mov    %edx,%esi
+  801d20:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801d22:	eb 99                	jmp    801cbd <sys_fork+0x38>
+
+00801d24 <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801d24:	55                   	push   %ebp
+  801d25:	89 e5                	mov    %esp,%ebp
+  801d27:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801d2a:	ff 75 14             	push   0x14(%ebp)
+  801d2d:	ff 75 10             	push   0x10(%ebp)
+  801d30:	ff 75 0c             	push   0xc(%ebp)
+  801d33:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d38:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d3b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801d40:	e8 81 ee ff ff       	call   800bc6 <page_vec_call>
+}
+  801d45:	c9                   	leave
+  801d46:	c3                   	ret
+
+00801d47 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801d47:	55                   	push   %ebp
+  801d48:	89 e5                	mov    %esp,%ebp
+  801d4a:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801d4d:	ff 75 18             	push   0x18(%ebp)
+  801d50:	ff 75 14             	push   0x14(%ebp)
+  801d53:	ff 75 10             	push   0x10(%ebp)
+  801d56:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d59:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d5c:	b8 10 00 00 00       	mov    $0x10,%eax
+  801d61:	e8 60 ee ff ff       	call   800bc6 <page_vec_call>
+}
+  801d66:	c9                   	leave
+  801d67:	c3                   	ret
+
+00801d68 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801d68:	55                   	push   %ebp
+  801d69:	89 e5                	mov    %esp,%ebp
+  801d6b:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801d6e:	ff 75 14             	push   0x14(%ebp)
+  801d71:	ff 75 10             	push   0x10(%ebp)
+  801d74:	ff 75 0c             	push   0xc(%ebp)
+  801d77:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d7f:	b8 11 00 00 00       	mov    $0x11,%eax
+  801d84:	e8 3d ee ff ff       	call   800bc6 <page_vec_call>
+}
+  801d89:	c9                   	leave
+  801d8a:	c3                   	ret
+
+00801d8b <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801d8b:	55                   	push   %ebp
+  801d8c:	89 e5                	mov    %esp,%ebp
+  801d8e:	57                   	push   %edi
+  801d8f:	56                   	push   %esi
+  801d90:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801d91:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  801d98:	78 32                	js     801dcc <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801d9a:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  801da1:	74 75                	je     801e18 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801da3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801da6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801da9:	b8 12 00 00 00       	mov    $0x12,%eax
+  801dae:	be 00 00 00 00       	mov    $0x0,%esi
+  801db3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801db6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801db9:	55                   	push   %ebp
+  801dba:	68 c3 1d 80 00       	push   $0x801dc3
+  801dbf:	89 e5                	mov    %esp,%ebp
+  801dc1:	0f 34                	sysenter
+  801dc3:	83 c4 04             	add    $0x4,%esp
+  801dc6:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801dc7:	5b                   	pop    %ebx
+  801dc8:	5e                   	pop    %esi
+  801dc9:	5f                   	pop    %edi
+  801dca:	5d                   	pop    %ebp
+  801dcb:	c3                   	ret
+  801dcc:	b8 01 00 00 00       	mov    $0x1,%eax
+  801dd1:	0f a2                	cpuid
+		return 0;
+  801dd3:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801dd8:	f6 c6 08             	test   $0x8,%dh
+  801ddb:	74 15                	je     801df2 <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ddd:	89 c2                	mov    %eax,%edx
+  801ddf:	c1 ea 08             	shr    $0x8,%edx
+  801de2:	83 e2 0f             	and    $0xf,%edx
+  801de5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801dea:	83 fa 06             	cmp    $0x6,%edx
+  801ded:	74 0e                	je     801dfd <sys_vm_ranges+0x72>
+  801def:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801df2:	0f b6 c9             	movzbl %cl,%ecx
+  801df5:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  801dfb:	eb 9d                	jmp    801d9a <sys_vm_ranges+0xf>
+  801dfd:	89 c2                	mov    %eax,%edx
+  801dff:	c1 ea 04             	shr    $0x4,%edx
+  801e02:	83 e2 0f             	and    $0xf,%edx
+  801e05:	83 fa 02             	cmp    $0x2,%edx
+  801e08:	77 e5                	ja     801def <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  801e0a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e0d:	83 f8 02             	cmp    $0x2,%eax
+  801e10:	0f 97 c1             	seta   %cl
+  801e13:	0f b6 c9             	movzbl %cl,%ecx
+  801e16:	eb d7                	jmp    801def <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801e18:	b8 12 00 00 00       	mov    $0x12,%eax
+  801e1d:	be 00 00 00 00       	mov    $0x0,%esi
+  801e22:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e25:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e28:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e2b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801e2e:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801e30:	eb 95                	jmp    801dc7 <sys_vm_ranges+0x3c>
+
+00801e32 <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801e32:	55                   	push   %ebp
+  801e33:	89 e5                	mov    %esp,%ebp
+  801e35:	57                   	push   %edi
+  801e36:	56                   	push   %esi
+  801e37:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801e38:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  801e3f:	78 31                	js     801e72 <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801e41:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  801e48:	74 74                	je     801ebe <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801e4a:	be 00 00 00 00       	mov    $0x0,%esi
+  801e4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e52:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e55:	b8 14 00 00 00       	mov    $0x14,%eax
+  801e5a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e5d:	89 f7                	mov    %esi,%edi
+  801e5f:	55                   	push   %ebp
+  801e60:	68 69 1e 80 00       	push   $0x801e69
+  801e65:	89 e5                	mov    %esp,%ebp
+  801e67:	0f 34                	sysenter
+  801e69:	83 c4 04             	add    $0x4,%esp
+  801e6c:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801e6d:	5b                   	pop    %ebx
+  801e6e:	5e                   	pop    %esi
+  801e6f:	5f                   	pop    %edi
+  801e70:	5d                   	pop    %ebp
+  801e71:	c3                   	ret
+  801e72:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e77:	0f a2                	cpuid
+		return 0;
+  801e79:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801e7e:	f6 c6 08             	test   $0x8,%dh
+  801e81:	74 15                	je     801e98 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e83:	89 c2                	mov    %eax,%edx
+  801e85:	c1 ea 08             	shr    $0x8,%edx
+  801e88:	83 e2 0f             	and    $0xf,%edx
+  801e8b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e90:	83 fa 06             	cmp    $0x6,%edx
+  801e93:	74 0e                	je     801ea3 <sys_spawn+0x71>
+  801e95:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801e98:	0f b6 c9             	movzbl %cl,%ecx
+  801e9b:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  801ea1:	eb 9e                	jmp    801e41 <sys_spawn+0xf>
+  801ea3:	89 c2                	mov    %eax,%edx
+  801ea5:	c1 ea 04             	shr    $0x4,%edx
+  801ea8:	83 e2 0f             	and    $0xf,%edx
+  801eab:	83 fa 02             	cmp    $0x2,%edx
+  801eae:	77 e5                	ja     801e95 <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  801eb0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801eb3:	83 f8 02             	cmp    $0x2,%eax
+  801eb6:	0f 97 c1             	seta   %cl
+  801eb9:	0f b6 c9             	movzbl %cl,%ecx
+  801ebc:	eb d7                	jmp    801e95 <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  801ebe:	be 00 00 00 00       	mov    $0x0,%esi
+  801ec3:	b8 14 00 00 00       	mov    $0x14,%eax
+  801ec8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ecb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ece:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ed1:	89 f7                	mov    %esi,%edi
+  801ed3:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  801ed5:	eb 96                	jmp    801e6d <sys_spawn+0x3b>
+
+00801ed7 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  801ed7:	55                   	push   %ebp
+  801ed8:	89 e5                	mov    %esp,%ebp
+  801eda:	57                   	push   %edi
+  801edb:	56                   	push   %esi
+  801edc:	53                   	push   %ebx
+  801edd:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801ee0:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  801ee7:	78 37                	js     801f20 <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  801ee9:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  801ef0:	74 7a                	je     801f6c <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  801ef2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ef7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801efa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801efd:	b8 15 00 00 00       	mov    $0x15,%eax
+  801f02:	89 df                	mov    %ebx,%edi
+  801f04:	89 de                	mov    %ebx,%esi
+  801f06:	55                   	push   %ebp
+  801f07:	68 10 1f 80 00       	push   $0x801f10
+  801f0c:	89 e5                	mov    %esp,%ebp
+  801f0e:	0f 34                	sysenter
+  801f10:	83 c4 04             	add    $0x4,%esp
+  801f13:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801f14:	85 c0                	test   %eax,%eax
+  801f16:	7f 6c                	jg     801f84 <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  801f18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f1b:	5b                   	pop    %ebx
+  801f1c:	5e                   	pop    %esi
+  801f1d:	5f                   	pop    %edi
+  801f1e:	5d                   	pop    %ebp
+  801f1f:	c3                   	ret
+  801f20:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f25:	0f a2                	cpuid
+		return 0;
+  801f27:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801f2c:	f6 c6 08             	test   $0x8,%dh
+  801f2f:	74 15                	je     801f46 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f31:	89 c2                	mov    %eax,%edx
+  801f33:	c1 ea 08             	shr    $0x8,%edx
+  801f36:	83 e2 0f             	and    $0xf,%edx
+  801f39:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f3e:	83 fa 06             	cmp    $0x6,%edx
+  801f41:	74 0e                	je     801f51 <sys_shm_create+0x7a>
+  801f43:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801f46:	0f b6 c9             	movzbl %cl,%ecx
+  801f49:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  801f4f:	eb 98                	jmp    801ee9 <sys_shm_create+0x12>
+  801f51:	89 c2                	mov    %eax,%edx
+  801f53:	c1 ea 04             	shr    $0x4,%edx
+  801f56:	83 e2 0f             	and    $0xf,%edx
+  801f59:	83 fa 02             	cmp    $0x2,%edx
+  801f5c:	77 e5                	ja     801f43 <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  801f5e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f61:	83 f8 02             	cmp    $0x2,%eax
+  801f64:	0f 97 c1             	seta   %cl
+  801f67:	0f b6 c9             	movzbl %cl,%ecx
+  801f6a:	eb d7                	jmp    801f43 <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  801f6c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f71:	b8 15 00 00 00       	mov    $0x15,%eax
+  801f76:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f7c:	89 df                	mov    %ebx,%edi
+  801f7e:	89 de                	mov    %ebx,%esi
+  801f80:	cd 30                	int    $0x30
+  801f82:	eb 90                	jmp    801f14 <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801f84:	83 ec 0c             	sub    $0xc,%esp
+  801f87:	50                   	push   %eax
+  801f88:	6a 15                	push   $0x15
+  801f8a:	68 59 33 80 00       	push   $0x803359
+  801f8f:	6a 4a                	push   $0x4a
+  801f91:	68 76 33 80 00       	push   $0x803376
+  801f96:	e8 2f 0d 00 00       	call   802cca <_panic>
+
+00801f9b <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  801f9b:	55                   	push   %ebp
+  801f9c:	89 e5                	mov    %esp,%ebp
+  801f9e:	57                   	push   %edi
+  801f9f:	56                   	push   %esi
+  801fa0:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801fa1:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  801fa8:	78 32                	js     801fdc <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  801faa:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  801fb1:	74 75                	je     802028 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801fb3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fb6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fb9:	b8 16 00 00 00       	mov    $0x16,%eax
+  801fbe:	be 00 00 00 00       	mov    $0x0,%esi
+  801fc3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801fc6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801fc9:	55                   	push   %ebp
+  801fca:	68 d3 1f 80 00       	push   $0x801fd3
+  801fcf:	89 e5                	mov    %esp,%ebp
+  801fd1:	0f 34                	sysenter
+  801fd3:	83 c4 04             	add    $0x4,%esp
+  801fd6:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  801fd7:	5b                   	pop    %ebx
+  801fd8:	5e                   	pop    %esi
+  801fd9:	5f                   	pop    %edi
+  801fda:	5d                   	pop    %ebp
+  801fdb:	c3                   	ret
+  801fdc:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fe1:	0f a2                	cpuid
+		return 0;
+  801fe3:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801fe8:	f6 c6 08             	test   $0x8,%dh
+  801feb:	74 15                	je     802002 <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fed:	89 c2                	mov    %eax,%edx
+  801fef:	c1 ea 08             	shr    $0x8,%edx
+  801ff2:	83 e2 0f             	and    $0xf,%edx
+  801ff5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ffa:	83 fa 06             	cmp    $0x6,%edx
+  801ffd:	74 0e                	je     80200d <sys_shm_attach+0x72>
+  801fff:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802002:	0f b6 c9             	movzbl %cl,%ecx
+  802005:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  80200b:	eb 9d                	jmp    801faa <sys_shm_attach+0xf>
+  80200d:	89 c2                	mov    %eax,%edx
+  80200f:	c1 ea 04             	shr    $0x4,%edx
+  802012:	83 e2 0f             	and    $0xf,%edx
+  802015:	83 fa 02             	cmp    $0x2,%edx
+  802018:	77 e5                	ja     801fff <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  80201a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80201d:	83 f8 02             	cmp    $0x2,%eax
+  802020:	0f 97 c1             	seta   %cl
+  802023:	0f b6 c9             	movzbl %cl,%ecx
+  802026:	eb d7                	jmp    801fff <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  802028:	b8 16 00 00 00       	mov    $0x16,%eax
+  80202d:	be 00 00 00 00       	mov    $0x0,%esi
+  802032:	8b 55 08             	mov    0x8(%ebp),%edx
+  802035:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802038:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80203b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80203e:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  802040:	eb 95                	jmp    801fd7 <sys_shm_attach+0x3c>
+
+00802042 <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  802042:	55                   	push   %ebp
+  802043:	89 e5                	mov    %esp,%ebp
+  802045:	57                   	push   %edi
+  802046:	56                   	push   %esi
+  802047:	53                   	push   %ebx
+  802048:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80204b:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  802052:	78 38                	js     80208c <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  802054:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  80205b:	74 7b                	je     8020d8 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  80205d:	be 00 00 00 00       	mov    $0x0,%esi
+  802062:	8b 55 08             	mov    0x8(%ebp),%edx
+  802065:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802068:	b8 17 00 00 00       	mov    $0x17,%eax
+  80206d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802070:	89 f7                	mov    %esi,%edi
+  802072:	55                   	push   %ebp
+  802073:	68 7c 20 80 00       	push   $0x80207c
+  802078:	89 e5                	mov    %esp,%ebp
+  80207a:	0f 34                	sysenter
+  80207c:	83 c4 04             	add    $0x4,%esp
+  80207f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802080:	85 c0                	test   %eax,%eax
+  802082:	7f 6d                	jg     8020f1 <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  802084:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802087:	5b                   	pop    %ebx
+  802088:	5e                   	pop    %esi
+  802089:	5f                   	pop    %edi
+  80208a:	5d                   	pop    %ebp
+  80208b:	c3                   	ret
+  80208c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802091:	0f a2                	cpuid
+		return 0;
+  802093:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802098:	f6 c6 08             	test   $0x8,%dh
+  80209b:	74 15                	je     8020b2 <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80209d:	89 c2                	mov    %eax,%edx
+  80209f:	c1 ea 08             	shr    $0x8,%edx
+  8020a2:	83 e2 0f             	and    $0xf,%edx
+  8020a5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8020aa:	83 fa 06             	cmp    $0x6,%edx
+  8020ad:	74 0e                	je     8020bd <sys_shm_detach+0x7b>
+  8020af:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8020b2:	0f b6 c9             	movzbl %cl,%ecx
+  8020b5:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  8020bb:	eb 97                	jmp    802054 <sys_shm_detach+0x12>
+  8020bd:	89 c2                	mov    %eax,%edx
+  8020bf:	c1 ea 04             	shr    $0x4,%edx
+  8020c2:	83 e2 0f             	and    $0xf,%edx
+  8020c5:	83 fa 02             	cmp    $0x2,%edx
+  8020c8:	77 e5                	ja     8020af <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  8020ca:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020cd:	83 f8 02             	cmp    $0x2,%eax
+  8020d0:	0f 97 c1             	seta   %cl
+  8020d3:	0f b6 c9             	movzbl %cl,%ecx
+  8020d6:	eb d7                	jmp    8020af <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  8020d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8020dd:	b8 17 00 00 00       	mov    $0x17,%eax
+  8020e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8020eb:	89 f7                	mov    %esi,%edi
+  8020ed:	cd 30                	int    $0x30
+  8020ef:	eb 8f                	jmp    802080 <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8020f1:	83 ec 0c             	sub    $0xc,%esp
+  8020f4:	50                   	push   %eax
+  8020f5:	6a 17                	push   $0x17
+  8020f7:	68 59 33 80 00       	push   $0x803359
+  8020fc:	6a 4a                	push   $0x4a
+  8020fe:	68 76 33 80 00       	push   $0x803376
+  802103:	e8 c2 0b 00 00       	call   802cca <_panic>
+
+00802108 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  802108:	55                   	push   %ebp
+  802109:	89 e5                	mov    %esp,%ebp
+  80210b:	57                   	push   %edi
+  80210c:	56                   	push   %esi
+  80210d:	53                   	push   %ebx
+  80210e:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802111:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  802118:	78 36                	js     802150 <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  80211a:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  802121:	74 79                	je     80219c <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  802123:	8b 55 08             	mov    0x8(%ebp),%edx
+  802126:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80212b:	b8 18 00 00 00       	mov    $0x18,%eax
+  802130:	89 cb                	mov    %ecx,%ebx
+  802132:	89 cf                	mov    %ecx,%edi
+  802134:	89 ce                	mov    %ecx,%esi
+  802136:	55                   	push   %ebp
+  802137:	68 40 21 80 00       	push   $0x802140
+  80213c:	89 e5                	mov    %esp,%ebp
+  80213e:	0f 34                	sysenter
+  802140:	83 c4 04             	add    $0x4,%esp
+  802143:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802144:	85 c0                	test   %eax,%eax
+  802146:	7f 6b                	jg     8021b3 <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  802148:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80214b:	5b                   	pop    %ebx
+  80214c:	5e                   	pop    %esi
+  80214d:	5f                   	pop    %edi
+  80214e:	5d                   	pop    %ebp
+  80214f:	c3                   	ret
+  802150:	b8 01 00 00 00       	mov    $0x1,%eax
+  802155:	0f a2                	cpuid
+		return 0;
+  802157:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80215c:	f6 c6 08             	test   $0x8,%dh
+  80215f:	74 15                	je     802176 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802161:	89 c2                	mov    %eax,%edx
+  802163:	c1 ea 08             	shr    $0x8,%edx
+  802166:	83 e2 0f             	and    $0xf,%edx
+  802169:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80216e:	83 fa 06             	cmp    $0x6,%edx
+  802171:	74 0e                	je     802181 <sys_shm_remove+0x79>
+  802173:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802176:	0f b6 c9             	movzbl %cl,%ecx
+  802179:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  80217f:	eb 99                	jmp    80211a <sys_shm_remove+0x12>
+  802181:	89 c2                	mov    %eax,%edx
+  802183:	c1 ea 04             	shr    $0x4,%edx
+  802186:	83 e2 0f             	and    $0xf,%edx
+  802189:	83 fa 02             	cmp    $0x2,%edx
+  80218c:	77 e5                	ja     802173 <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  80218e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802191:	83 f8 02             	cmp    $0x2,%eax
+  802194:	0f 97 c1             	seta   %cl
+  802197:	0f b6 c9             	movzbl %cl,%ecx
+  80219a:	eb d7                	jmp    802173 <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  80219c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021a1:	b8 18 00 00 00       	mov    $0x18,%eax
+  8021a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021a9:	89 cb                	mov    %ecx,%ebx
+  8021ab:	89 cf                	mov    %ecx,%edi
+  8021ad:	89 ce                	mov    %ecx,%esi
+  8021af:	cd 30                	int    $0x30
+  8021b1:	eb 91                	jmp    802144 <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8021b3:	83 ec 0c             	sub    $0xc,%esp
+  8021b6:	50                   	push   %eax
+  8021b7:	6a 18                	push   $0x18
+  8021b9:	68 59 33 80 00       	push   $0x803359
+  8021be:	6a 4a                	push   $0x4a
+  8021c0:	68 76 33 80 00       	push   $0x803376
+  8021c5:	e8 00 0b 00 00       	call   802cca <_panic>
+
+008021ca <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  8021ca:	55                   	push   %ebp
+  8021cb:	89 e5                	mov    %esp,%ebp
+  8021cd:	57                   	push   %edi
+  8021ce:	56                   	push   %esi
+  8021cf:	53                   	push   %ebx
+  8021d0:	83 ec 0c             	sub    $0xc,%esp
+  8021d3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8021d6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8021d9:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  8021dc:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  8021e3:	78 32                	js     802217 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  8021e5:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  8021ec:	74 75                	je     802263 <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  8021ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021f4:	b8 20 00 00 00       	mov    $0x20,%eax
+  8021f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8021fe:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802201:	55                   	push   %ebp
+  802202:	68 0b 22 80 00       	push   $0x80220b
+  802207:	89 e5                	mov    %esp,%ebp
+  802209:	0f 34                	sysenter
+  80220b:	83 c4 04             	add    $0x4,%esp
+  80220e:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  80220f:	83 c4 0c             	add    $0xc,%esp
+  802212:	5b                   	pop    %ebx
+  802213:	5e                   	pop    %esi
+  802214:	5f                   	pop    %edi
+  802215:	5d                   	pop    %ebp
+  802216:	c3                   	ret
+  802217:	b8 01 00 00 00       	mov    $0x1,%eax
+  80221c:	0f a2                	cpuid
+		return 0;
+  80221e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802223:	f6 c6 08             	test   $0x8,%dh
+  802226:	74 15                	je     80223d <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802228:	89 c2                	mov    %eax,%edx
+  80222a:	c1 ea 08             	shr    $0x8,%edx
+  80222d:	83 e2 0f             	and    $0xf,%edx
+  802230:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802235:	83 fa 06             	cmp    $0x6,%edx
+  802238:	74 0e                	je     802248 <sys_futex_wait+0x7e>
+  80223a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80223d:	0f b6 c9             	movzbl %cl,%ecx
+  802240:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  802246:	eb 9d                	jmp    8021e5 <sys_futex_wait+0x1b>
+  802248:	89 c2                	mov    %eax,%edx
+  80224a:	c1 ea 04             	shr    $0x4,%edx
+  80224d:	83 e2 0f             	and    $0xf,%edx
+  802250:	83 fa 02             	cmp    $0x2,%edx
+  802253:	77 e5                	ja     80223a <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  802255:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802258:	83 f8 02             	cmp    $0x2,%eax
+  80225b:	0f 97 c1             	seta   %cl
+  80225e:	0f b6 c9             	movzbl %cl,%ecx
+  802261:	eb d7                	jmp    80223a <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  802263:	b8 20 00 00 00       	mov    $0x20,%eax
+  802268:	be 00 00 00 00       	mov    $0x0,%esi
+  80226d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802270:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802273:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802276:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  802278:	eb 95                	jmp    80220f <sys_futex_wait+0x45>
+
+0080227a <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80227a:	55                   	push   %ebp
+  80227b:	89 e5                	mov    %esp,%ebp
+  80227d:	57                   	push   %edi
+  80227e:	56                   	push   %esi
+  80227f:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802280:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  802287:	78 30                	js     8022b9 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  802289:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  802290:	74 73                	je     802305 <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  802292:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802297:	8b 55 08             	mov    0x8(%ebp),%edx
+  80229a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80229d:	b8 21 00 00 00       	mov    $0x21,%eax
+  8022a2:	89 df                	mov    %ebx,%edi
+  8022a4:	89 de                	mov    %ebx,%esi
+  8022a6:	55                   	push   %ebp
+  8022a7:	68 b0 22 80 00       	push   $0x8022b0
+  8022ac:	89 e5                	mov    %esp,%ebp
+  8022ae:	0f 34                	sysenter
+  8022b0:	83 c4 04             	add    $0x4,%esp
+  8022b3:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8022b4:	5b                   	pop    %ebx
+  8022b5:	5e                   	pop    %esi
+  8022b6:	5f                   	pop    %edi
+  8022b7:	5d                   	pop    %ebp
+  8022b8:	c3                   	ret
+  8022b9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022be:	0f a2                	cpuid
+		return 0;
+  8022c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8022c5:	f6 c6 08             	test   $0x8,%dh
+  8022c8:	74 15                	je     8022df <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022ca:	89 c2                	mov    %eax,%edx
+  8022cc:	c1 ea 08             	shr    $0x8,%edx
+  8022cf:	83 e2 0f             	and    $0xf,%edx
+  8022d2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8022d7:	83 fa 06             	cmp    $0x6,%edx
+  8022da:	74 0e                	je     8022ea <sys_futex_wake+0x70>
+  8022dc:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8022df:	0f b6 c9             	movzbl %cl,%ecx
+  8022e2:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  8022e8:	eb 9f                	jmp    802289 <sys_futex_wake+0xf>
+  8022ea:	89 c2                	mov    %eax,%edx
+  8022ec:	c1 ea 04             	shr    $0x4,%edx
+  8022ef:	83 e2 0f             	and    $0xf,%edx
+  8022f2:	83 fa 02             	cmp    $0x2,%edx
+  8022f5:	77 e5                	ja     8022dc <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  8022f7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022fa:	83 f8 02             	cmp    $0x2,%eax
+  8022fd:	0f 97 c1             	seta   %cl
+  802300:	0f b6 c9             	movzbl %cl,%ecx
+  802303:	eb d7                	jmp    8022dc <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  802305:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80230a:	b8 21 00 00 00       	mov    $0x21,%eax
+  80230f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802312:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802315:	89 df                	mov    %ebx,%edi
+  802317:	89 de                	mov    %ebx,%esi
+  802319:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  80231b:	eb 97                	jmp    8022b4 <sys_futex_wake+0x3a>
+
+0080231d <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  80231d:	55                   	push   %ebp
+  80231e:	89 e5                	mov    %esp,%ebp
+  802320:	57                   	push   %edi
+  802321:	56                   	push   %esi
+  802322:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802323:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  80232a:	78 2e                	js     80235a <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  80232c:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  802333:	74 71                	je     8023a6 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  802335:	ba 00 00 00 00       	mov    $0x0,%edx
+  80233a:	b8 22 00 00 00       	mov    $0x22,%eax
+  80233f:	89 d1                	mov    %edx,%ecx
+  802341:	89 d3                	mov    %edx,%ebx
+  802343:	89 d7                	mov    %edx,%edi
+  802345:	89 d6                	mov    %edx,%esi
+  802347:	55                   	push   %ebp
+  802348:	68 51 23 80 00       	push   $0x802351
+  80234d:	89 e5                	mov    %esp,%ebp
+  80234f:	0f 34                	sysenter
+  802351:	83 c4 04             	add    $0x4,%esp
+  802354:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  802355:	5b                   	pop    %ebx
+  802356:	5e                   	pop    %esi
+  802357:	5f                   	pop    %edi
+  802358:	5d                   	pop    %ebp
+  802359:	c3                   	ret
+  80235a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80235f:	0f a2                	cpuid
+		return 0;
+  802361:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802366:	f6 c6 08             	test   $0x8,%dh
+  802369:	74 15                	je     802380 <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80236b:	89 c2                	mov    %eax,%edx
+  80236d:	c1 ea 08             	shr    $0x8,%edx
+  802370:	83 e2 0f             	and    $0xf,%edx
+  802373:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802378:	83 fa 06             	cmp    $0x6,%edx
+  80237b:	74 0e                	je     80238b <sys_ep_create+0x6e>
+  80237d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802380:	0f b6 c9             	movzbl %cl,%ecx
+  802383:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  802389:	eb a1                	jmp    80232c <sys_ep_create+0xf>
+  80238b:	89 c2                	mov    %eax,%edx
+  80238d:	c1 ea 04             	shr    $0x4,%edx
+  802390:	83 e2 0f             	and    $0xf,%edx
+  802393:	83 fa 02             	cmp    $0x2,%edx
+  802396:	77 e5                	ja     80237d <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  802398:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80239b:	83 f8 02             	cmp    $0x2,%eax
+  80239e:	0f 97 c1             	seta   %cl
+  8023a1:	0f b6 c9             	movzbl %cl,%ecx
+  8023a4:	eb d7                	jmp    80237d <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  8023a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023ab:	b8 22 00 00 00       	mov    $0x22,%eax
+  8023b0:	89 d1                	mov    %edx,%ecx
+  8023b2:	89 d3                	mov    %edx,%ebx
+  8023b4:	89 d7                	mov    %edx,%edi
+  8023b6:	89 d6                	mov    %edx,%esi
+  8023b8:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  8023ba:	eb 99                	jmp    802355 <sys_ep_create+0x38>
+
+008023bc <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  8023bc:	55                   	push   %ebp
+  8023bd:	89 e5                	mov    %esp,%ebp
+  8023bf:	57                   	push   %edi
+  8023c0:	56                   	push   %esi
+  8023c1:	53                   	push   %ebx
+  8023c2:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8023c5:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  8023cc:	78 36                	js     802404 <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  8023ce:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  8023d5:	74 79                	je     802450 <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  8023d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023df:	b8 23 00 00 00       	mov    $0x23,%eax
+  8023e4:	89 cb                	mov    %ecx,%ebx
+  8023e6:	89 cf                	mov    %ecx,%edi
+  8023e8:	89 ce                	mov    %ecx,%esi
+  8023ea:	55                   	push   %ebp
+  8023eb:	68 f4 23 80 00       	push   $0x8023f4
+  8023f0:	89 e5                	mov    %esp,%ebp
+  8023f2:	0f 34                	sysenter
+  8023f4:	83 c4 04             	add    $0x4,%esp
+  8023f7:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8023f8:	85 c0                	test   %eax,%eax
+  8023fa:	7f 6b                	jg     802467 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  8023fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023ff:	5b                   	pop    %ebx
+  802400:	5e                   	pop    %esi
+  802401:	5f                   	pop    %edi
+  802402:	5d                   	pop    %ebp
+  802403:	c3                   	ret
+  802404:	b8 01 00 00 00       	mov    $0x1,%eax
+  802409:	0f a2                	cpuid
+		return 0;
+  80240b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802410:	f6 c6 08             	test   $0x8,%dh
+  802413:	74 15                	je     80242a <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802415:	89 c2                	mov    %eax,%edx
+  802417:	c1 ea 08             	shr    $0x8,%edx
+  80241a:	83 e2 0f             	and    $0xf,%edx
+  80241d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802422:	83 fa 06             	cmp    $0x6,%edx
+  802425:	74 0e                	je     802435 <sys_ep_destroy+0x79>
+  802427:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80242a:	0f b6 c9             	movzbl %cl,%ecx
+  80242d:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  802433:	eb 99                	jmp    8023ce <sys_ep_destroy+0x12>
+  802435:	89 c2                	mov    %eax,%edx
+  802437:	c1 ea 04             	shr    $0x4,%edx
+  80243a:	83 e2 0f             	and    $0xf,%edx
+  80243d:	83 fa 02             	cmp    $0x2,%edx
+  802440:	77 e5                	ja     802427 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  802442:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802445:	83 f8 02             	cmp    $0x2,%eax
+  802448:	0f 97 c1             	seta   %cl
+  80244b:	0f b6 c9             	movzbl %cl,%ecx
+  80244e:	eb d7                	jmp    802427 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  802450:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802455:	b8 23 00 00 00       	mov    $0x23,%eax
+  80245a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80245d:	89 cb                	mov    %ecx,%ebx
+  80245f:	89 cf                	mov    %ecx,%edi
+  802461:	89 ce                	mov    %ecx,%esi
+  802463:	cd 30                	int    $0x30
+  802465:	eb 91                	jmp    8023f8 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802467:	83 ec 0c             	sub    $0xc,%esp
+  80246a:	50                   	push   %eax
+  80246b:	6a 23                	push   $0x23
+  80246d:	68 59 33 80 00       	push   $0x803359
+  802472:	6a 4a                	push   $0x4a
+  802474:	68 76 33 80 00       	push   $0x803376
+  802479:	e8 4c 08 00 00       	call   802cca <_panic>
+
+0080247e <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  80247e:	55                   	push   %ebp
+  80247f:	89 e5                	mov    %esp,%ebp
+  802481:	57                   	push   %edi
+  802482:	56                   	push   %esi
+  802483:	53                   	push   %ebx
+  802484:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802487:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  80248e:	78 37                	js     8024c7 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  802490:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  802497:	74 7a                	je     802513 <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  802499:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80249e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024a4:	b8 24 00 00 00       	mov    $0x24,%eax
+  8024a9:	89 df                	mov    %ebx,%edi
+  8024ab:	89 de                	mov    %ebx,%esi
+  8024ad:	55                   	push   %ebp
+  8024ae:	68 b7 24 80 00       	push   $0x8024b7
+  8024b3:	89 e5                	mov    %esp,%ebp
+  8024b5:	0f 34                	sysenter
+  8024b7:	83 c4 04             	add    $0x4,%esp
+  8024ba:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8024bb:	85 c0                	test   %eax,%eax
+  8024bd:	7f 6c                	jg     80252b <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  8024bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024c2:	5b                   	pop    %ebx
+  8024c3:	5e                   	pop    %esi
+  8024c4:	5f                   	pop    %edi
+  8024c5:	5d                   	pop    %ebp
+  8024c6:	c3                   	ret
+  8024c7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024cc:	0f a2                	cpuid
+		return 0;
+  8024ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8024d3:	f6 c6 08             	test   $0x8,%dh
+  8024d6:	74 15                	je     8024ed <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8024d8:	89 c2                	mov    %eax,%edx
+  8024da:	c1 ea 08             	shr    $0x8,%edx
+  8024dd:	83 e2 0f             	and    $0xf,%edx
+  8024e0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8024e5:	83 fa 06             	cmp    $0x6,%edx
+  8024e8:	74 0e                	je     8024f8 <sys_ep_grant+0x7a>
+  8024ea:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8024ed:	0f b6 c9             	movzbl %cl,%ecx
+  8024f0:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  8024f6:	eb 98                	jmp    802490 <sys_ep_grant+0x12>
+  8024f8:	89 c2                	mov    %eax,%edx
+  8024fa:	c1 ea 04             	shr    $0x4,%edx
+  8024fd:	83 e2 0f             	and    $0xf,%edx
+  802500:	83 fa 02             	cmp    $0x2,%edx
+  802503:	77 e5                	ja     8024ea <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  802505:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802508:	83 f8 02             	cmp    $0x2,%eax
+  80250b:	0f 97 c1             	seta   %cl
+  80250e:	0f b6 c9             	movzbl %cl,%ecx
+  802511:	eb d7                	jmp    8024ea <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  802513:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802518:	b8 24 00 00 00       	mov    $0x24,%eax
+  80251d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802520:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802523:	89 df                	mov    %ebx,%edi
+  802525:	89 de                	mov    %ebx,%esi
+  802527:	cd 30                	int    $0x30
+  802529:	eb 90                	jmp    8024bb <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80252b:	83 ec 0c             	sub    $0xc,%esp
+  80252e:	50                   	push   %eax
+  80252f:	6a 24                	push   $0x24
+  802531:	68 59 33 80 00       	push   $0x803359
+  802536:	6a 4a                	push   $0x4a
+  802538:	68 76 33 80 00       	push   $0x803376
+  80253d:	e8 88 07 00 00       	call   802cca <_panic>
+
+00802542 <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  802542:	55                   	push   %ebp
+  802543:	89 e5                	mov    %esp,%ebp
+  802545:	57                   	push   %edi
+  802546:	56                   	push   %esi
+  802547:	53                   	push   %ebx
+  802548:	83 ec 20             	sub    $0x20,%esp
+  80254b:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  80254e:	8b 10                	mov    (%eax),%edx
+  802550:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802553:	8b 50 04             	mov    0x4(%eax),%edx
+  802556:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802559:	8b 50 08             	mov    0x8(%eax),%edx
+  80255c:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  80255f:	8b 50 0c             	mov    0xc(%eax),%edx
+  802562:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  802565:	8b 40 10             	mov    0x10(%eax),%eax
+  802568:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  80256b:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  80256e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802571:	b8 25 00 00 00       	mov    $0x25,%eax
+  802576:	55                   	push   %ebp
+  802577:	56                   	push   %esi
+  802578:	8b 0e                	mov    (%esi),%ecx
+  80257a:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80257d:	8b 7e 08             	mov    0x8(%esi),%edi
+  802580:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802583:	8b 76 0c             	mov    0xc(%esi),%esi
+  802586:	cd 30                	int    $0x30
+  802588:	87 34 24             	xchg   %esi,(%esp)
+  80258b:	89 0e                	mov    %ecx,(%esi)
+  80258d:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802590:	89 7e 08             	mov    %edi,0x8(%esi)
+  802593:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802596:	8f 46 0c             	pop    0xc(%esi)
+  802599:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  80259a:	83 c4 20             	add    $0x20,%esp
+  80259d:	5b                   	pop    %ebx
+  80259e:	5e                   	pop    %esi
+  80259f:	5f                   	pop    %edi
+  8025a0:	5d                   	pop    %ebp
+  8025a1:	c3                   	ret
+
+008025a2 <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  8025a2:	55                   	push   %ebp
+  8025a3:	89 e5                	mov    %esp,%ebp
+  8025a5:	57                   	push   %edi
+  8025a6:	56                   	push   %esi
+  8025a7:	53                   	push   %ebx
+  8025a8:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  8025ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025ae:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  8025b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025b3:	b8 26 00 00 00       	mov    $0x26,%eax
+  8025b8:	55                   	push   %ebp
+  8025b9:	56                   	push   %esi
+  8025ba:	8b 0e                	mov    (%esi),%ecx
+  8025bc:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8025bf:	8b 7e 08             	mov    0x8(%esi),%edi
+  8025c2:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8025c5:	8b 76 0c             	mov    0xc(%esi),%esi
+  8025c8:	cd 30                	int    $0x30
+  8025ca:	87 34 24             	xchg   %esi,(%esp)
+  8025cd:	89 0e                	mov    %ecx,(%esi)
+  8025cf:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8025d2:	89 7e 08             	mov    %edi,0x8(%esi)
+  8025d5:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8025d8:	8f 46 0c             	pop    0xc(%esi)
+  8025db:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  8025dc:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  8025e0:	74 0f                	je     8025f1 <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  8025e2:	85 c0                	test   %eax,%eax
+  8025e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025e9:	0f 48 d1             	cmovs  %ecx,%edx
+  8025ec:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8025ef:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  8025f1:	5b                   	pop    %ebx
+  8025f2:	5e                   	pop    %esi
+  8025f3:	5f                   	pop    %edi
+  8025f4:	5d                   	pop    %ebp
+  8025f5:	c3                   	ret
+
+008025f6 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  8025f6:	55                   	push   %ebp
+  8025f7:	89 e5                	mov    %esp,%ebp
+  8025f9:	57                   	push   %edi
+  8025fa:	56                   	push   %esi
+  8025fb:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8025fc:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  802603:	78 2f                	js     802634 <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  802605:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  80260c:	74 72                	je     802680 <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  80260e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802611:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802616:	b8 27 00 00 00       	mov    $0x27,%eax
+  80261b:	89 cb                	mov    %ecx,%ebx
+  80261d:	89 cf                	mov    %ecx,%edi
+  80261f:	89 ce                	mov    %ecx,%esi
+  802621:	55                   	push   %ebp
+  802622:	68 2b 26 80 00       	push   $0x80262b
+  802627:	89 e5                	mov    %esp,%ebp
+  802629:	0f 34                	sysenter
+  80262b:	83 c4 04             	add    $0x4,%esp
+  80262e:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  80262f:	5b                   	pop    %ebx
+  802630:	5e                   	pop    %esi
+  802631:	5f                   	pop    %edi
+  802632:	5d                   	pop    %ebp
+  802633:	c3                   	ret
+  802634:	b8 01 00 00 00       	mov    $0x1,%eax
+  802639:	0f a2                	cpuid
+		return 0;
+  80263b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802640:	f6 c6 08             	test   $0x8,%dh
+  802643:	74 15                	je     80265a <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802645:	89 c2                	mov    %eax,%edx
+  802647:	c1 ea 08             	shr    $0x8,%edx
+  80264a:	83 e2 0f             	and    $0xf,%edx
+  80264d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802652:	83 fa 06             	cmp    $0x6,%edx
+  802655:	74 0e                	je     802665 <sys_sysring_setup+0x6f>
+  802657:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80265a:	0f b6 c9             	movzbl %cl,%ecx
+  80265d:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  802663:	eb a0                	jmp    802605 <sys_sysring_setup+0xf>
+  802665:	89 c2                	mov    %eax,%edx
+  802667:	c1 ea 04             	shr    $0x4,%edx
+  80266a:	83 e2 0f             	and    $0xf,%edx
+  80266d:	83 fa 02             	cmp    $0x2,%edx
+  802670:	77 e5                	ja     802657 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  802672:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802675:	83 f8 02             	cmp    $0x2,%eax
+  802678:	0f 97 c1             	seta   %cl
+  80267b:	0f b6 c9             	movzbl %cl,%ecx
+  80267e:	eb d7                	jmp    802657 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  802680:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802685:	b8 27 00 00 00       	mov    $0x27,%eax
+  80268a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80268d:	89 cb                	mov    %ecx,%ebx
+  80268f:	89 cf                	mov    %ecx,%edi
+  802691:	89 ce                	mov    %ecx,%esi
+  802693:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  802695:	eb 98                	jmp    80262f <sys_sysring_setup+0x39>
+
+00802697 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  802697:	55                   	push   %ebp
+  802698:	89 e5                	mov    %esp,%ebp
+  80269a:	57                   	push   %edi
+  80269b:	56                   	push   %esi
+  80269c:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80269d:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  8026a4:	78 2e                	js     8026d4 <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  8026a6:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  8026ad:	74 71                	je     802720 <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  8026af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026b4:	b8 28 00 00 00       	mov    $0x28,%eax
+  8026b9:	89 d1                	mov    %edx,%ecx
+  8026bb:	89 d3                	mov    %edx,%ebx
+  8026bd:	89 d7                	mov    %edx,%edi
+  8026bf:	89 d6                	mov    %edx,%esi
+  8026c1:	55                   	push   %ebp
+  8026c2:	68 cb 26 80 00       	push   $0x8026cb
+  8026c7:	89 e5                	mov    %esp,%ebp
+  8026c9:	0f 34                	sysenter
+  8026cb:	83 c4 04             	add    $0x4,%esp
+  8026ce:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8026cf:	5b                   	pop    %ebx
+  8026d0:	5e                   	pop    %esi
+  8026d1:	5f                   	pop    %edi
+  8026d2:	5d                   	pop    %ebp
+  8026d3:	c3                   	ret
+  8026d4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026d9:	0f a2                	cpuid
+		return 0;
+  8026db:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8026e0:	f6 c6 08             	test   $0x8,%dh
+  8026e3:	74 15                	je     8026fa <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8026e5:	89 c2                	mov    %eax,%edx
+  8026e7:	c1 ea 08             	shr    $0x8,%edx
+  8026ea:	83 e2 0f             	and    $0xf,%edx
+  8026ed:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8026f2:	83 fa 06             	cmp    $0x6,%edx
+  8026f5:	74 0e                	je     802705 <sys_sysring_enter+0x6e>
+  8026f7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8026fa:	0f b6 c9             	movzbl %cl,%ecx
+  8026fd:	89 0d 0c 40 80 00    	mov    %ecx,0x80400c
+  802703:	eb a1                	jmp    8026a6 <sys_sysring_enter+0xf>
+  802705:	89 c2                	mov    %eax,%edx
+  802707:	c1 ea 04             	shr    $0x4,%edx
+  80270a:	83 e2 0f             	and    $0xf,%edx
+  80270d:	83 fa 02             	cmp    $0x2,%edx
+  802710:	77 e5                	ja     8026f7 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  802712:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802715:	83 f8 02             	cmp    $0x2,%eax
+  802718:	0f 97 c1             	seta   %cl
+  80271b:	0f b6 c9             	movzbl %cl,%ecx
+  80271e:	eb d7                	jmp    8026f7 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  802720:	ba 00 00 00 00       	mov    $0x0,%edx
+  802725:	b8 28 00 00 00       	mov    $0x28,%eax
+  80272a:	89 d1                	mov    %edx,%ecx
+  80272c:	89 d3                	mov    %edx,%ebx
+  80272e:	89 d7                	mov    %edx,%edi
+  802730:	89 d6                	mov    %edx,%esi
+  802732:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  802734:	eb 99                	jmp    8026cf <sys_sysring_enter+0x38>
+
+00802736 <pgfault>:
+// The kernel normally resolves these faults itself (page_fault_cow in
+// kern/trap.c); we only get here if it ran out of memory doing so.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802736:	55                   	push   %ebp
+  802737:	89 e5                	mov    %esp,%ebp
+  802739:	83 ec 08             	sub    $0x8,%esp
+  80273c:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  80273f:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  802741:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  802744:	f6 c2 02             	test   $0x2,%dl
+  802747:	74 40                	je     802789 <pgfault+0x53>
+  802749:	89 c1                	mov    %eax,%ecx
+  80274b:	c1 e9 16             	shr    $0x16,%ecx
+  80274e:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802755:	f6 c1 01             	test   $0x1,%cl
+  802758:	74 2f                	je     802789 <pgfault+0x53>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW))
+  80275a:	89 c1                	mov    %eax,%ecx
+  80275c:	c1 e9 0c             	shr    $0xc,%ecx
+  80275f:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  802766:	f6 c5 08             	test   $0x8,%ch
+  802769:	74 1e                	je     802789 <pgfault+0x53>
+	// Replace the page with a private writable copy of itself.  The
+	// kernel allocates, copies and maps it in one system call, so no
+	// temporary mapping at PFTEMP is needed.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  80276b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r = sys_page_copy(0, addr, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  802770:	83 ec 0c             	sub    $0xc,%esp
+  802773:	6a 07                	push   $0x7
+  802775:	50                   	push   %eax
+  802776:	6a 00                	push   $0x0
+  802778:	50                   	push   %eax
+  802779:	6a 00                	push   $0x0
+  80277b:	e8 85 eb ff ff       	call   801305 <sys_page_copy>
+  802780:	83 c4 20             	add    $0x20,%esp
+  802783:	85 c0                	test   %eax,%eax
+  802785:	78 18                	js     80279f <pgfault+0x69>
+		panic("pgfault: sys_page_copy: %e", r);
+}
+  802787:	c9                   	leave
+  802788:	c3                   	ret
+		panic("pgfault: va %08x err %x is not a copy-on-write write",
+  802789:	83 ec 0c             	sub    $0xc,%esp
+  80278c:	52                   	push   %edx
+  80278d:	50                   	push   %eax
+  80278e:	68 84 33 80 00       	push   $0x803384
+  802793:	6a 1c                	push   $0x1c
+  802795:	68 b9 33 80 00       	push   $0x8033b9
+  80279a:	e8 2b 05 00 00       	call   802cca <_panic>
+		panic("pgfault: sys_page_copy: %e", r);
+  80279f:	50                   	push   %eax
+  8027a0:	68 c4 33 80 00       	push   $0x8033c4
+  8027a5:	6a 26                	push   $0x26
+  8027a7:	68 b9 33 80 00       	push   $0x8033b9
+  8027ac:	e8 19 05 00 00       	call   802cca <_panic>
+
+008027b1 <ufork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+ufork(void)
+{
+  8027b1:	55                   	push   %ebp
+  8027b2:	89 e5                	mov    %esp,%ebp
+  8027b4:	57                   	push   %edi
+  8027b5:	56                   	push   %esi
+  8027b6:	53                   	push   %ebx
+  8027b7:	81 ec 38 04 00 00    	sub    $0x438,%esp
+	struct page_range vec[PAGE_VEC_MAX], *last;
+	uintptr_t va;
+	size_t n;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8027bd:	68 36 27 80 00       	push   $0x802736
+  8027c2:	e8 82 05 00 00       	call   802d49 <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8027c7:	b8 07 00 00 00       	mov    $0x7,%eax
+  8027cc:	cd 30                	int    $0x30
+  8027ce:	89 85 d4 fb ff ff    	mov    %eax,-0x42c(%ebp)
+
+	envid = sys_exofork();
+	if (envid < 0)
+  8027d4:	83 c4 10             	add    $0x10,%esp
+  8027d7:	85 c0                	test   %eax,%eax
+  8027d9:	0f 88 f2 01 00 00    	js     8029d1 <ufork+0x220>
+		return 0;
+	}
+
+	// Copy every run of mapped pages below the exception stack, which
+	// must not be shared.
+	va = 0;
+  8027df:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  8027e4:	74 0b                	je     8027f1 <ufork+0x40>
+  8027e6:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  8027ec:	e9 07 01 00 00       	jmp    8028f8 <ufork+0x147>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8027f1:	e8 22 e8 ff ff       	call   801018 <sys_getenvid>
+  8027f6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8027fb:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802801:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802806:	a3 10 40 80 00       	mov    %eax,0x804010
+		return 0;
+  80280b:	e9 c1 01 00 00       	jmp    8029d1 <ufork+0x220>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+		n = r;
+		last = &vec[n - 1];
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  802810:	83 ea 01             	sub    $0x1,%edx
+  802813:	89 c1                	mov    %eax,%ecx
+  802815:	c1 e1 04             	shl    $0x4,%ecx
+  802818:	89 94 0d ec fd ff ff 	mov    %edx,-0x214(%ebp,%ecx,1)
+			n--;
+  80281f:	85 d2                	test   %edx,%edx
+  802821:	0f 44 f0             	cmove  %eax,%esi
+  802824:	e9 12 01 00 00       	jmp    80293b <ufork+0x18a>
+	for (i = 0; i < n; i++) {
+  802829:	83 c1 01             	add    $0x1,%ecx
+  80282c:	83 c0 10             	add    $0x10,%eax
+  80282f:	39 8d e4 fb ff ff    	cmp    %ecx,-0x41c(%ebp)
+  802835:	74 6a                	je     8028a1 <ufork+0xf0>
+		vec[i].pr_dstva = vec[i].pr_va;
+  802837:	89 c3                	mov    %eax,%ebx
+  802839:	8b 10                	mov    (%eax),%edx
+  80283b:	89 50 0c             	mov    %edx,0xc(%eax)
+		if (vec[i].pr_perm & PTE_SHARE)
+  80283e:	8b 50 08             	mov    0x8(%eax),%edx
+  802841:	f6 c6 04             	test   $0x4,%dh
+  802844:	75 e3                	jne    802829 <ufork+0x78>
+		if (vec[i].pr_perm & (PTE_W | PTE_COW)) {
+  802846:	f7 c2 02 08 00 00    	test   $0x802,%edx
+  80284c:	74 db                	je     802829 <ufork+0x78>
+			vec[i].pr_perm = (vec[i].pr_perm & ~PTE_W) | PTE_COW;
+  80284e:	81 e2 fd f7 ff ff    	and    $0xfffff7fd,%edx
+  802854:	80 ce 08             	or     $0x8,%dh
+  802857:	89 95 dc fb ff ff    	mov    %edx,-0x424(%ebp)
+  80285d:	89 53 08             	mov    %edx,0x8(%ebx)
+			cow[ncow++] = vec[i];
+  802860:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  802866:	c1 e6 04             	shl    $0x4,%esi
+  802869:	89 f2                	mov    %esi,%edx
+  80286b:	8d b4 35 e8 fb ff ff 	lea    -0x418(%ebp,%esi,1),%esi
+  802872:	8b 38                	mov    (%eax),%edi
+  802874:	89 bc 15 e8 fb ff ff 	mov    %edi,-0x418(%ebp,%edx,1)
+  80287b:	8b 78 04             	mov    0x4(%eax),%edi
+  80287e:	89 7e 04             	mov    %edi,0x4(%esi)
+  802881:	8b bd dc fb ff ff    	mov    -0x424(%ebp),%edi
+  802887:	89 7e 08             	mov    %edi,0x8(%esi)
+  80288a:	8b 50 0c             	mov    0xc(%eax),%edx
+  80288d:	89 56 0c             	mov    %edx,0xc(%esi)
+  802890:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  802896:	8d 7e 01             	lea    0x1(%esi),%edi
+  802899:	89 bd e0 fb ff ff    	mov    %edi,-0x420(%ebp)
+  80289f:	eb 88                	jmp    802829 <ufork+0x78>
+	if ((r = sys_page_map_vec(0, envid, vec, n, 0)) < 0)
+  8028a1:	8b b5 e4 fb ff ff    	mov    -0x41c(%ebp),%esi
+  8028a7:	8b bd d8 fb ff ff    	mov    -0x428(%ebp),%edi
+  8028ad:	83 ec 0c             	sub    $0xc,%esp
+  8028b0:	6a 00                	push   $0x0
+  8028b2:	56                   	push   %esi
+  8028b3:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  8028b9:	50                   	push   %eax
+  8028ba:	ff b5 d4 fb ff ff    	push   -0x42c(%ebp)
+  8028c0:	6a 00                	push   $0x0
+  8028c2:	e8 80 f4 ff ff       	call   801d47 <sys_page_map_vec>
+  8028c7:	83 c4 20             	add    $0x20,%esp
+  8028ca:	85 c0                	test   %eax,%eax
+  8028cc:	0f 88 e5 00 00 00    	js     8029b7 <ufork+0x206>
+	return sys_page_map_vec(0, 0, cow, ncow, 0);
+  8028d2:	83 ec 0c             	sub    $0xc,%esp
+  8028d5:	6a 00                	push   $0x0
+  8028d7:	ff b5 e0 fb ff ff    	push   -0x420(%ebp)
+  8028dd:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  8028e3:	50                   	push   %eax
+  8028e4:	6a 00                	push   $0x0
+  8028e6:	6a 00                	push   $0x0
+  8028e8:	e8 5a f4 ff ff       	call   801d47 <sys_page_map_vec>
+		if ((r = duppages(envid, vec, n)) < 0)
+  8028ed:	83 c4 20             	add    $0x20,%esp
+  8028f0:	85 c0                	test   %eax,%eax
+  8028f2:	0f 88 e7 00 00 00    	js     8029df <ufork+0x22e>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+  8028f8:	6a 20                	push   $0x20
+  8028fa:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802900:	50                   	push   %eax
+  802901:	57                   	push   %edi
+  802902:	6a 00                	push   $0x0
+  802904:	e8 82 f4 ff ff       	call   801d8b <sys_vm_ranges>
+  802909:	83 c4 10             	add    $0x10,%esp
+  80290c:	85 c0                	test   %eax,%eax
+  80290e:	7e 51                	jle    802961 <ufork+0x1b0>
+		n = r;
+  802910:	89 c6                	mov    %eax,%esi
+		last = &vec[n - 1];
+  802912:	83 e8 01             	sub    $0x1,%eax
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+  802915:	89 c1                	mov    %eax,%ecx
+  802917:	c1 e1 04             	shl    $0x4,%ecx
+  80291a:	8b 94 0d ec fd ff ff 	mov    -0x214(%ebp,%ecx,1),%edx
+  802921:	89 d3                	mov    %edx,%ebx
+  802923:	c1 e3 0c             	shl    $0xc,%ebx
+  802926:	89 df                	mov    %ebx,%edi
+  802928:	03 bc 0d e8 fd ff ff 	add    -0x218(%ebp,%ecx,1),%edi
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  80292f:	81 ff 00 00 c0 ee    	cmp    $0xeec00000,%edi
+  802935:	0f 84 d5 fe ff ff    	je     802810 <ufork+0x5f>
+	for (i = 0; i < n; i++) {
+  80293b:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+	size_t i, ncow = 0;
+  802941:	c7 85 e0 fb ff ff 00 	movl   $0x0,-0x420(%ebp)
+  802948:	00 00 00 
+	for (i = 0; i < n; i++) {
+  80294b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802950:	89 bd d8 fb ff ff    	mov    %edi,-0x428(%ebp)
+  802956:	89 b5 e4 fb ff ff    	mov    %esi,-0x41c(%ebp)
+  80295c:	e9 ce fe ff ff       	jmp    80282f <ufork+0x7e>
+			goto fail;
+	}
+	if (r < 0)
+  802961:	89 c6                	mov    %eax,%esi
+  802963:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  802969:	85 c0                	test   %eax,%eax
+  80296b:	78 52                	js     8029bf <ufork+0x20e>
+		goto fail;
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE),
+  80296d:	83 ec 04             	sub    $0x4,%esp
+  802970:	6a 07                	push   $0x7
+  802972:	68 00 f0 bf ee       	push   $0xeebff000
+  802977:	53                   	push   %ebx
+  802978:	e8 3a e7 ff ff       	call   8010b7 <sys_page_alloc>
+  80297d:	89 c6                	mov    %eax,%esi
+  80297f:	83 c4 10             	add    $0x10,%esp
+  802982:	85 c0                	test   %eax,%eax
+  802984:	78 39                	js     8029bf <ufork+0x20e>
+				PTE_P | PTE_U | PTE_W)) < 0
+	    || (r = sys_env_set_pgfault_upcall(envid,
+			thisenv->env_pgfault_upcall)) < 0
+  802986:	a1 10 40 80 00       	mov    0x804010,%eax
+  80298b:	8b 40 74             	mov    0x74(%eax),%eax
+	    || (r = sys_env_set_pgfault_upcall(envid,
+  80298e:	83 ec 08             	sub    $0x8,%esp
+  802991:	50                   	push   %eax
+  802992:	53                   	push   %ebx
+  802993:	e8 de ed ff ff       	call   801776 <sys_env_set_pgfault_upcall>
+  802998:	89 c6                	mov    %eax,%esi
+  80299a:	83 c4 10             	add    $0x10,%esp
+  80299d:	85 c0                	test   %eax,%eax
+  80299f:	78 1e                	js     8029bf <ufork+0x20e>
+	    || (r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  8029a1:	83 ec 08             	sub    $0x8,%esp
+  8029a4:	6a 02                	push   $0x2
+  8029a6:	53                   	push   %ebx
+  8029a7:	e8 bc ea ff ff       	call   801468 <sys_env_set_status>
+  8029ac:	89 c6                	mov    %eax,%esi
+  8029ae:	83 c4 10             	add    $0x10,%esp
+  8029b1:	85 c0                	test   %eax,%eax
+  8029b3:	79 1c                	jns    8029d1 <ufork+0x220>
+  8029b5:	eb 08                	jmp    8029bf <ufork+0x20e>
+  8029b7:	89 c6                	mov    %eax,%esi
+  8029b9:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+		goto fail;
+	return envid;
+
+fail:
+	sys_env_destroy(envid);
+  8029bf:	83 ec 0c             	sub    $0xc,%esp
+  8029c2:	53                   	push   %ebx
+  8029c3:	e8 8e e5 ff ff       	call   800f56 <sys_env_destroy>
+	return r;
+  8029c8:	83 c4 10             	add    $0x10,%esp
+  8029cb:	89 b5 d4 fb ff ff    	mov    %esi,-0x42c(%ebp)
+}
+  8029d1:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+  8029d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029da:	5b                   	pop    %ebx
+  8029db:	5e                   	pop    %esi
+  8029dc:	5f                   	pop    %edi
+  8029dd:	5d                   	pop    %ebp
+  8029de:	c3                   	ret
+  8029df:	89 c6                	mov    %eax,%esi
+  8029e1:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  8029e7:	eb d6                	jmp    8029bf <ufork+0x20e>
+
+008029e9 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  8029e9:	55                   	push   %ebp
+  8029ea:	89 e5                	mov    %esp,%ebp
+  8029ec:	53                   	push   %ebx
+  8029ed:	83 ec 04             	sub    $0x4,%esp
+	envid_t envid;
+
+	envid = sys_fork();
+  8029f0:	e8 90 f2 ff ff       	call   801c85 <sys_fork>
+  8029f5:	89 c3                	mov    %eax,%ebx
+	if (envid == 0)
+  8029f7:	85 c0                	test   %eax,%eax
+  8029f9:	74 07                	je     802a02 <fork+0x19>
+		thisenv = &envs[ENVX(sys_getenvid())];
+	return envid;
+}
+  8029fb:	89 d8                	mov    %ebx,%eax
+  8029fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a00:	c9                   	leave
+  802a01:	c3                   	ret
+		thisenv = &envs[ENVX(sys_getenvid())];
+  802a02:	e8 11 e6 ff ff       	call   801018 <sys_getenvid>
+  802a07:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802a0c:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802a12:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802a17:	a3 10 40 80 00       	mov    %eax,0x804010
+	return envid;
+  802a1c:	eb dd                	jmp    8029fb <fork+0x12>
+
+00802a1e <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  802a1e:	55                   	push   %ebp
+  802a1f:	89 e5                	mov    %esp,%ebp
+  802a21:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  802a24:	68 df 33 80 00       	push   $0x8033df
+  802a29:	68 a1 00 00 00       	push   $0xa1
+  802a2e:	68 b9 33 80 00       	push   $0x8033b9
+  802a33:	e8 92 02 00 00       	call   802cca <_panic>
+
+00802a38 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802a38:	55                   	push   %ebp
+  802a39:	89 e5                	mov    %esp,%ebp
+  802a3b:	56                   	push   %esi
+  802a3c:	53                   	push   %ebx
+  802a3d:	8b 75 08             	mov    0x8(%ebp),%esi
+  802a40:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a43:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if ((r = sys_ipc_recv(pg ? pg : (void *) UTOP)) < 0) {
+  802a46:	85 c0                	test   %eax,%eax
+  802a48:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802a4d:	0f 44 c2             	cmove  %edx,%eax
+  802a50:	83 ec 0c             	sub    $0xc,%esp
+  802a53:	50                   	push   %eax
+  802a54:	e8 2f ef ff ff       	call   801988 <sys_ipc_recv>
+  802a59:	83 c4 10             	add    $0x10,%esp
+  802a5c:	85 c0                	test   %eax,%eax
+  802a5e:	78 34                	js     802a94 <ipc_recv+0x5c>
+			*from_env_store = 0;
+		if (perm_store)
+			*perm_store = 0;
+		return r;
+	}
+	if (from_env_store)
+  802a60:	85 f6                	test   %esi,%esi
+  802a62:	74 0d                	je     802a71 <ipc_recv+0x39>
+		*from_env_store = thisenv->env_ipc_from;
+  802a64:	a1 10 40 80 00       	mov    0x804010,%eax
+  802a69:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  802a6f:	89 06                	mov    %eax,(%esi)
+	if (perm_store)
+  802a71:	85 db                	test   %ebx,%ebx
+  802a73:	74 0d                	je     802a82 <ipc_recv+0x4a>
+		*perm_store = thisenv->env_ipc_perm;
+  802a75:	a1 10 40 80 00       	mov    0x804010,%eax
+  802a7a:	8b 80 9c 00 00 00    	mov    0x9c(%eax),%eax
+  802a80:	89 03                	mov    %eax,(%ebx)
+	return thisenv->env_ipc_msg.m_w[0];
+  802a82:	a1 10 40 80 00       	mov    0x804010,%eax
+  802a87:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802a8d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a90:	5b                   	pop    %ebx
+  802a91:	5e                   	pop    %esi
+  802a92:	5d                   	pop    %ebp
+  802a93:	c3                   	ret
+		if (from_env_store)
+  802a94:	85 f6                	test   %esi,%esi
+  802a96:	74 06                	je     802a9e <ipc_recv+0x66>
+			*from_env_store = 0;
+  802a98:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802a9e:	85 db                	test   %ebx,%ebx
+  802aa0:	74 eb                	je     802a8d <ipc_recv+0x55>
+			*perm_store = 0;
+  802aa2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802aa8:	eb e3                	jmp    802a8d <ipc_recv+0x55>
+
+00802aaa <ipc_send>:
+//
+// The kernel queues us behind any other senders until 'toenv'
+// receives, so we only come back to retry if its queue was full.
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802aaa:	55                   	push   %ebp
+  802aab:	89 e5                	mov    %esp,%ebp
+  802aad:	57                   	push   %edi
+  802aae:	56                   	push   %esi
+  802aaf:	53                   	push   %ebx
+  802ab0:	83 ec 0c             	sub    $0xc,%esp
+  802ab3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802ab6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802ab9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	while ((r = sys_ipc_send(to_env, val, pg ? pg : (void *) UTOP, perm))
+  802abc:	85 db                	test   %ebx,%ebx
+  802abe:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802ac3:	0f 44 d8             	cmove  %eax,%ebx
+  802ac6:	eb 05                	jmp    802acd <ipc_send+0x23>
+	       == -E_AGAIN)
+		sys_yield();
+  802ac8:	e8 fc e8 ff ff       	call   8013c9 <sys_yield>
+	while ((r = sys_ipc_send(to_env, val, pg ? pg : (void *) UTOP, perm))
+  802acd:	ff 75 14             	push   0x14(%ebp)
+  802ad0:	53                   	push   %ebx
+  802ad1:	56                   	push   %esi
+  802ad2:	57                   	push   %edi
+  802ad3:	e8 09 ee ff ff       	call   8018e1 <sys_ipc_send>
+	       == -E_AGAIN)
+  802ad8:	83 c4 10             	add    $0x10,%esp
+  802adb:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802ade:	74 e8                	je     802ac8 <ipc_send+0x1e>
+	if (r < 0)
+  802ae0:	85 c0                	test   %eax,%eax
+  802ae2:	78 08                	js     802aec <ipc_send+0x42>
+		panic("ipc_send: %e", r);
+}
+  802ae4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ae7:	5b                   	pop    %ebx
+  802ae8:	5e                   	pop    %esi
+  802ae9:	5f                   	pop    %edi
+  802aea:	5d                   	pop    %ebp
+  802aeb:	c3                   	ret
+		panic("ipc_send: %e", r);
+  802aec:	50                   	push   %eax
+  802aed:	68 f5 33 80 00       	push   $0x8033f5
+  802af2:	6a 3a                	push   $0x3a
+  802af4:	68 02 34 80 00       	push   $0x803402
+  802af9:	e8 cc 01 00 00       	call   802cca <_panic>
+
+00802afe <ipc_send_range>:
+
+// Like ipc_send, but send the 'npages' contiguous pages at 'pg' in one
+// message.  The receiver maps as many as fit in its window.
+void
+ipc_send_range(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  802afe:	55                   	push   %ebp
+  802aff:	89 e5                	mov    %esp,%ebp
+  802b01:	57                   	push   %edi
+  802b02:	56                   	push   %esi
+  802b03:	53                   	push   %ebx
+  802b04:	83 ec 0c             	sub    $0xc,%esp
+  802b07:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b0a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b0d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_send_range(to_env, val, pg, npages, perm))
+  802b10:	eb 05                	jmp    802b17 <ipc_send_range+0x19>
+	       == -E_AGAIN)
+		sys_yield();
+  802b12:	e8 b2 e8 ff ff       	call   8013c9 <sys_yield>
+	while ((r = sys_ipc_send_range(to_env, val, pg, npages, perm))
+  802b17:	83 ec 0c             	sub    $0xc,%esp
+  802b1a:	ff 75 18             	push   0x18(%ebp)
+  802b1d:	ff 75 14             	push   0x14(%ebp)
+  802b20:	53                   	push   %ebx
+  802b21:	56                   	push   %esi
+  802b22:	57                   	push   %edi
+  802b23:	e8 22 ef ff ff       	call   801a4a <sys_ipc_send_range>
+	       == -E_AGAIN)
+  802b28:	83 c4 20             	add    $0x20,%esp
+  802b2b:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802b2e:	74 e2                	je     802b12 <ipc_send_range+0x14>
+	if (r < 0)
+  802b30:	85 c0                	test   %eax,%eax
+  802b32:	78 08                	js     802b3c <ipc_send_range+0x3e>
+		panic("ipc_send_range: %e", r);
+}
+  802b34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b37:	5b                   	pop    %ebx
+  802b38:	5e                   	pop    %esi
+  802b39:	5f                   	pop    %edi
+  802b3a:	5d                   	pop    %ebp
+  802b3b:	c3                   	ret
+		panic("ipc_send_range: %e", r);
+  802b3c:	50                   	push   %eax
+  802b3d:	68 0c 34 80 00       	push   $0x80340c
+  802b42:	6a 48                	push   $0x48
+  802b44:	68 02 34 80 00       	push   $0x803402
+  802b49:	e8 7c 01 00 00       	call   802cca <_panic>
+
+00802b4e <ipc_recv_range>:
+// (which must not be null).  On return *npages holds the number of
+// pages received, which is 0 on error or if the sender sent none.
+int32_t
+ipc_recv_range(envid_t *from_env_store, void *pg, size_t *npages,
+	       int *perm_store)
+{
+  802b4e:	55                   	push   %ebp
+  802b4f:	89 e5                	mov    %esp,%ebp
+  802b51:	57                   	push   %edi
+  802b52:	56                   	push   %esi
+  802b53:	53                   	push   %ebx
+  802b54:	83 ec 14             	sub    $0x14,%esp
+  802b57:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b5a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802b5d:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if ((r = sys_ipc_recv_range(pg, *npages)) < 0) {
+  802b60:	ff 33                	push   (%ebx)
+  802b62:	ff 75 0c             	push   0xc(%ebp)
+  802b65:	e8 83 ef ff ff       	call   801aed <sys_ipc_recv_range>
+  802b6a:	83 c4 10             	add    $0x10,%esp
+  802b6d:	85 c0                	test   %eax,%eax
+  802b6f:	78 42                	js     802bb3 <ipc_recv_range+0x65>
+		if (perm_store)
+			*perm_store = 0;
+		*npages = 0;
+		return r;
+	}
+	if (from_env_store)
+  802b71:	85 ff                	test   %edi,%edi
+  802b73:	74 0d                	je     802b82 <ipc_recv_range+0x34>
+		*from_env_store = thisenv->env_ipc_from;
+  802b75:	a1 10 40 80 00       	mov    0x804010,%eax
+  802b7a:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  802b80:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  802b82:	85 f6                	test   %esi,%esi
+  802b84:	74 0d                	je     802b93 <ipc_recv_range+0x45>
+		*perm_store = thisenv->env_ipc_perm;
+  802b86:	a1 10 40 80 00       	mov    0x804010,%eax
+  802b8b:	8b 80 9c 00 00 00    	mov    0x9c(%eax),%eax
+  802b91:	89 06                	mov    %eax,(%esi)
+	*npages = thisenv->env_ipc_npages;
+  802b93:	a1 10 40 80 00       	mov    0x804010,%eax
+  802b98:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802b9e:	89 03                	mov    %eax,(%ebx)
+	return thisenv->env_ipc_msg.m_w[0];
+  802ba0:	a1 10 40 80 00       	mov    0x804010,%eax
+  802ba5:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802bab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bae:	5b                   	pop    %ebx
+  802baf:	5e                   	pop    %esi
+  802bb0:	5f                   	pop    %edi
+  802bb1:	5d                   	pop    %ebp
+  802bb2:	c3                   	ret
+		if (from_env_store)
+  802bb3:	85 ff                	test   %edi,%edi
+  802bb5:	74 06                	je     802bbd <ipc_recv_range+0x6f>
+			*from_env_store = 0;
+  802bb7:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  802bbd:	85 f6                	test   %esi,%esi
+  802bbf:	74 06                	je     802bc7 <ipc_recv_range+0x79>
+			*perm_store = 0;
+  802bc1:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		*npages = 0;
+  802bc7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		return r;
+  802bcd:	eb dc                	jmp    802bab <ipc_recv_range+0x5d>
+
+00802bcf <ipc_send_msg>:
+// Send the IPC_MSG_WORDS words of 'msg' to 'to_env', in registers and
+// without a page.  Waits like ipc_send until 'to_env' takes them, and
+// panics on any error other than -E_AGAIN.
+void
+ipc_send_msg(envid_t to_env, const struct ipc_msg *msg)
+{
+  802bcf:	55                   	push   %ebp
+  802bd0:	89 e5                	mov    %esp,%ebp
+  802bd2:	56                   	push   %esi
+  802bd3:	53                   	push   %ebx
+  802bd4:	8b 75 08             	mov    0x8(%ebp),%esi
+  802bd7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_send_msg(to_env, msg)) == -E_AGAIN)
+  802bda:	eb 05                	jmp    802be1 <ipc_send_msg+0x12>
+		sys_yield();
+  802bdc:	e8 e8 e7 ff ff       	call   8013c9 <sys_yield>
+	while ((r = sys_ipc_send_msg(to_env, msg)) == -E_AGAIN)
+  802be1:	83 ec 08             	sub    $0x8,%esp
+  802be4:	53                   	push   %ebx
+  802be5:	56                   	push   %esi
+  802be6:	e8 3a f0 ff ff       	call   801c25 <sys_ipc_send_msg>
+  802beb:	83 c4 10             	add    $0x10,%esp
+  802bee:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802bf1:	74 e9                	je     802bdc <ipc_send_msg+0xd>
+	if (r < 0)
+  802bf3:	85 c0                	test   %eax,%eax
+  802bf5:	78 07                	js     802bfe <ipc_send_msg+0x2f>
+		panic("ipc_send_msg: %e", r);
+}
+  802bf7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802bfa:	5b                   	pop    %ebx
+  802bfb:	5e                   	pop    %esi
+  802bfc:	5d                   	pop    %ebp
+  802bfd:	c3                   	ret
+		panic("ipc_send_msg: %e", r);
+  802bfe:	50                   	push   %eax
+  802bff:	68 1f 34 80 00       	push   $0x80341f
+  802c04:	6a 6f                	push   $0x6f
+  802c06:	68 02 34 80 00       	push   $0x803402
+  802c0b:	e8 ba 00 00 00       	call   802cca <_panic>
+
+00802c10 <ipc_recv_msg>:
+// ipc_call or plain ipc_send (whose value is word 0, and whose page is
+// not taken), it arrives in registers and needs no page.
+// Returns the sender's envid, < 0 on error.
+envid_t
+ipc_recv_msg(struct ipc_msg *msg)
+{
+  802c10:	55                   	push   %ebp
+  802c11:	89 e5                	mov    %esp,%ebp
+  802c13:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_reply_wait(0, msg);
+  802c16:	ff 75 08             	push   0x8(%ebp)
+  802c19:	6a 00                	push   $0x0
+  802c1b:	e8 cb ef ff ff       	call   801beb <sys_ipc_reply_wait>
+}
+  802c20:	c9                   	leave
+  802c21:	c3                   	ret
+
+00802c22 <ipc_call>:
+// ipc_reply_wait (or ipc_recv), and straight back when it replies.
+// Retries while to_env's queue is full.
+// Returns 0 on success, < 0 on error.
+int
+ipc_call(envid_t to_env, struct ipc_msg *msg)
+{
+  802c22:	55                   	push   %ebp
+  802c23:	89 e5                	mov    %esp,%ebp
+  802c25:	56                   	push   %esi
+  802c26:	53                   	push   %ebx
+  802c27:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c2a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_call(to_env, msg)) == -E_AGAIN)
+  802c2d:	eb 05                	jmp    802c34 <ipc_call+0x12>
+		sys_yield();
+  802c2f:	e8 95 e7 ff ff       	call   8013c9 <sys_yield>
+	while ((r = sys_ipc_call(to_env, msg)) == -E_AGAIN)
+  802c34:	83 ec 08             	sub    $0x8,%esp
+  802c37:	53                   	push   %ebx
+  802c38:	56                   	push   %esi
+  802c39:	e8 73 ef ff ff       	call   801bb1 <sys_ipc_call>
+  802c3e:	83 c4 10             	add    $0x10,%esp
+  802c41:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802c44:	74 e9                	je     802c2f <ipc_call+0xd>
+	return r;
+}
+  802c46:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c49:	5b                   	pop    %ebx
+  802c4a:	5e                   	pop    %esi
+  802c4b:	5d                   	pop    %ebp
+  802c4c:	c3                   	ret
+
+00802c4d <ipc_reply_wait>:
+//	}
+//
+// Returns the envid of the sender, < 0 on error.
+envid_t
+ipc_reply_wait(envid_t to_env, struct ipc_msg *msg)
+{
+  802c4d:	55                   	push   %ebp
+  802c4e:	89 e5                	mov    %esp,%ebp
+  802c50:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_reply_wait(to_env, msg);
+  802c53:	ff 75 0c             	push   0xc(%ebp)
+  802c56:	ff 75 08             	push   0x8(%ebp)
+  802c59:	e8 8d ef ff ff       	call   801beb <sys_ipc_reply_wait>
+}
+  802c5e:	c9                   	leave
+  802c5f:	c3                   	ret
+
+00802c60 <ep_send>:
+
+// Send 'msg' to endpoint 'epid', waiting while its queue is full.
+// Returns 0 on success, < 0 if the endpoint is gone or not ours to use.
+int
+ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  802c60:	55                   	push   %ebp
+  802c61:	89 e5                	mov    %esp,%ebp
+  802c63:	56                   	push   %esi
+  802c64:	53                   	push   %ebx
+  802c65:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c68:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ep_send(epid, msg)) == -E_AGAIN)
+  802c6b:	eb 05                	jmp    802c72 <ep_send+0x12>
+		sys_yield();
+  802c6d:	e8 57 e7 ff ff       	call   8013c9 <sys_yield>
+	while ((r = sys_ep_send(epid, msg)) == -E_AGAIN)
+  802c72:	83 ec 08             	sub    $0x8,%esp
+  802c75:	53                   	push   %ebx
+  802c76:	56                   	push   %esi
+  802c77:	e8 c6 f8 ff ff       	call   802542 <sys_ep_send>
+  802c7c:	83 c4 10             	add    $0x10,%esp
+  802c7f:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  802c82:	74 e9                	je     802c6d <ep_send+0xd>
+	return r;
+}
+  802c84:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c87:	5b                   	pop    %ebx
+  802c88:	5e                   	pop    %esi
+  802c89:	5d                   	pop    %ebp
+  802c8a:	c3                   	ret
+
+00802c8b <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802c8b:	55                   	push   %ebp
+  802c8c:	89 e5                	mov    %esp,%ebp
+  802c8e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802c91:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802c96:	69 d0 68 01 00 00    	imul   $0x168,%eax,%edx
+  802c9c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802ca2:	8b 52 50             	mov    0x50(%edx),%edx
+  802ca5:	39 ca                	cmp    %ecx,%edx
+  802ca7:	74 11                	je     802cba <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802ca9:	83 c0 01             	add    $0x1,%eax
+  802cac:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802cb1:	75 e3                	jne    802c96 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802cb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cb8:	eb 0e                	jmp    802cc8 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802cba:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802cc0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802cc5:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802cc8:	5d                   	pop    %ebp
+  802cc9:	c3                   	ret
+
+00802cca <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802cca:	55                   	push   %ebp
+  802ccb:	89 e5                	mov    %esp,%ebp
+  802ccd:	57                   	push   %edi
+  802cce:	56                   	push   %esi
+  802ccf:	53                   	push   %ebx
+  802cd0:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  802cd6:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  802cd9:	8b 1d 08 40 80 00    	mov    0x804008,%ebx
+  802cdf:	e8 34 e3 ff ff       	call   801018 <sys_getenvid>
+  802ce4:	83 ec 04             	sub    $0x4,%esp
+  802ce7:	ff 75 0c             	push   0xc(%ebp)
+  802cea:	ff 75 08             	push   0x8(%ebp)
+  802ced:	53                   	push   %ebx
+  802cee:	50                   	push   %eax
+  802cef:	68 30 34 80 00       	push   $0x803430
+  802cf4:	68 00 01 00 00       	push   $0x100
+  802cf9:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  802cff:	56                   	push   %esi
+  802d00:	e8 28 db ff ff       	call   80082d <snprintf>
+  802d05:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  802d07:	83 c4 20             	add    $0x20,%esp
+  802d0a:	57                   	push   %edi
+  802d0b:	ff 75 10             	push   0x10(%ebp)
+  802d0e:	bf 00 01 00 00       	mov    $0x100,%edi
+  802d13:	89 f8                	mov    %edi,%eax
+  802d15:	29 d8                	sub    %ebx,%eax
+  802d17:	50                   	push   %eax
+  802d18:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  802d1b:	50                   	push   %eax
+  802d1c:	e8 be da ff ff       	call   8007df <vsnprintf>
+  802d21:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  802d23:	83 c4 0c             	add    $0xc,%esp
+  802d26:	68 f2 2f 80 00       	push   $0x802ff2
+  802d2b:	29 df                	sub    %ebx,%edi
+  802d2d:	57                   	push   %edi
+  802d2e:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  802d31:	50                   	push   %eax
+  802d32:	e8 f6 da ff ff       	call   80082d <snprintf>
+	sys_cputs(buf, r);
+  802d37:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  802d3a:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  802d3c:	53                   	push   %ebx
+  802d3d:	56                   	push   %esi
+  802d3e:	e8 d7 e0 ff ff       	call   800e1a <sys_cputs>
+  802d43:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802d46:	cc                   	int3
+	while (1)
+  802d47:	eb fd                	jmp    802d46 <_panic+0x7c>
+
+00802d49 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802d49:	55                   	push   %ebp
+  802d4a:	89 e5                	mov    %esp,%ebp
+  802d4c:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  802d4f:	83 3d 14 40 80 00 00 	cmpl   $0x0,0x804014
+  802d56:	74 0a                	je     802d62 <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  802d58:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d5b:	a3 14 40 80 00       	mov    %eax,0x804014
+}
+  802d60:	c9                   	leave
+  802d61:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE),
+  802d62:	83 ec 04             	sub    $0x4,%esp
+  802d65:	6a 07                	push   $0x7
+  802d67:	68 00 f0 bf ee       	push   $0xeebff000
+  802d6c:	6a 00                	push   $0x0
+  802d6e:	e8 44 e3 ff ff       	call   8010b7 <sys_page_alloc>
+  802d73:	83 c4 10             	add    $0x10,%esp
+  802d76:	85 c0                	test   %eax,%eax
+  802d78:	78 28                	js     802da2 <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  802d7a:	83 ec 08             	sub    $0x8,%esp
+  802d7d:	68 b4 2d 80 00       	push   $0x802db4
+  802d82:	6a 00                	push   $0x0
+  802d84:	e8 ed e9 ff ff       	call   801776 <sys_env_set_pgfault_upcall>
+  802d89:	83 c4 10             	add    $0x10,%esp
+  802d8c:	85 c0                	test   %eax,%eax
+  802d8e:	79 c8                	jns    802d58 <set_pgfault_handler+0xf>
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+  802d90:	50                   	push   %eax
+  802d91:	68 7c 34 80 00       	push   $0x80347c
+  802d96:	6a 24                	push   $0x24
+  802d98:	68 b0 34 80 00       	push   $0x8034b0
+  802d9d:	e8 28 ff ff ff       	call   802cca <_panic>
+			panic("set_pgfault_handler: sys_page_alloc: %e", r);
+  802da2:	50                   	push   %eax
+  802da3:	68 54 34 80 00       	push   $0x803454
+  802da8:	6a 22                	push   $0x22
+  802daa:	68 b0 34 80 00       	push   $0x8034b0
+  802daf:	e8 16 ff ff ff       	call   802cca <_panic>
+
+00802db4 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802db4:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802db5:	a1 14 40 80 00       	mov    0x804014,%eax
+	call *%eax
+  802dba:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802dbc:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 0x28(%esp), %ebx		// trap-time eip
+  802dbf:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl 0x30(%esp), %eax		// trap-time esp
+  802dc3:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  802dc7:	83 e8 04             	sub    $0x4,%eax
+	movl %ebx, (%eax)
+  802dca:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 0x30(%esp)
+  802dcc:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp			// skip fault_va and err
+  802dd0:	83 c4 08             	add    $0x8,%esp
+	popal
+  802dd3:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp			// skip eip
+  802dd4:	83 c4 04             	add    $0x4,%esp
+	popfl
+  802dd7:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802dd8:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802dd9:	c3                   	ret
+
+00802dda <dm>:
+  802dda:	55                   	push   %ebp
+  802ddb:	57                   	push   %edi
+  802ddc:	56                   	push   %esi
+  802ddd:	53                   	push   %ebx
+  802dde:	83 ec 24             	sub    $0x24,%esp
+  802de1:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802de5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802de9:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802ded:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802df1:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802df5:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802df9:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802dfd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e02:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e07:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802e0c:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802e13:	00 
+  802e14:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802e1b:	00 
+  802e1c:	89 fb                	mov    %edi,%ebx
+  802e1e:	eb 08                	jmp    802e28 <dm+0x4e>
+  802e20:	83 e9 01             	sub    $0x1,%ecx
+  802e23:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802e26:	74 68                	je     802e90 <dm+0xb6>
+  802e28:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802e2c:	01 c0                	add    %eax,%eax
+  802e2e:	89 c6                	mov    %eax,%esi
+  802e30:	89 d7                	mov    %edx,%edi
+  802e32:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802e36:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802e3a:	0f ad d0             	shrd   %cl,%edx,%eax
+  802e3d:	d3 ea                	shr    %cl,%edx
+  802e3f:	f6 c1 20             	test   $0x20,%cl
+  802e42:	74 04                	je     802e48 <dm+0x6e>
+  802e44:	89 d0                	mov    %edx,%eax
+  802e46:	31 d2                	xor    %edx,%edx
+  802e48:	83 e0 01             	and    $0x1,%eax
+  802e4b:	89 04 24             	mov    %eax,(%esp)
+  802e4e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802e55:	00 
+  802e56:	8b 04 24             	mov    (%esp),%eax
+  802e59:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802e5d:	09 f0                	or     %esi,%eax
+  802e5f:	09 fa                	or     %edi,%edx
+  802e61:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802e65:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802e69:	39 f0                	cmp    %esi,%eax
+  802e6b:	89 d5                	mov    %edx,%ebp
+  802e6d:	19 fd                	sbb    %edi,%ebp
+  802e6f:	72 af                	jb     802e20 <dm+0x46>
+  802e71:	29 f0                	sub    %esi,%eax
+  802e73:	19 fa                	sbb    %edi,%edx
+  802e75:	89 cf                	mov    %ecx,%edi
+  802e77:	c1 ef 05             	shr    $0x5,%edi
+  802e7a:	83 e7 01             	and    $0x1,%edi
+  802e7d:	89 fe                	mov    %edi,%esi
+  802e7f:	83 f6 01             	xor    $0x1,%esi
+  802e82:	d3 e6                	shl    %cl,%esi
+  802e84:	d3 e7                	shl    %cl,%edi
+  802e86:	09 74 24 18          	or     %esi,0x18(%esp)
+  802e8a:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802e8e:	eb 90                	jmp    802e20 <dm+0x46>
+  802e90:	85 db                	test   %ebx,%ebx
+  802e92:	74 05                	je     802e99 <dm+0xbf>
+  802e94:	89 03                	mov    %eax,(%ebx)
+  802e96:	89 53 04             	mov    %edx,0x4(%ebx)
+  802e99:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802e9d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802ea1:	83 c4 24             	add    $0x24,%esp
+  802ea4:	5b                   	pop    %ebx
+  802ea5:	5e                   	pop    %esi
+  802ea6:	5f                   	pop    %edi
+  802ea7:	5d                   	pop    %ebp
+  802ea8:	c3                   	ret
+
+00802ea9 <__udivdi3>:
+  802ea9:	83 ec 08             	sub    $0x8,%esp
+  802eac:	6a 00                	push   $0x0
+  802eae:	ff 74 24 1c          	push   0x1c(%esp)
+  802eb2:	ff 74 24 1c          	push   0x1c(%esp)
+  802eb6:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802eba:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802ebe:	e8 17 ff ff ff       	call   802dda <dm>
+  802ec3:	83 c4 14             	add    $0x14,%esp
+  802ec6:	c3                   	ret
+
+00802ec7 <__umoddi3>:
+  802ec7:	83 ec 18             	sub    $0x18,%esp
+  802eca:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802ece:	50                   	push   %eax
+  802ecf:	ff 74 24 2c          	push   0x2c(%esp)
+  802ed3:	ff 74 24 2c          	push   0x2c(%esp)
+  802ed7:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802edb:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802edf:	e8 f6 fe ff ff       	call   802dda <dm>
+  802ee4:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802ee8:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802eec:	83 c4 24             	add    $0x24,%esp
+  802eef:	c3                   	ret
+
+00802ef0 <__divdi3>:
+  802ef0:	53                   	push   %ebx
+  802ef1:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802ef5:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802ef9:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  802efd:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  802f01:	85 d2                	test   %edx,%edx
+  802f03:	78 15                	js     802f1a <__divdi3+0x2a>
+  802f05:	85 db                	test   %ebx,%ebx
+  802f07:	78 34                	js     802f3d <__divdi3+0x4d>
+  802f09:	83 ec 04             	sub    $0x4,%esp
+  802f0c:	6a 00                	push   $0x0
+  802f0e:	53                   	push   %ebx
+  802f0f:	51                   	push   %ecx
+  802f10:	e8 c5 fe ff ff       	call   802dda <dm>
+  802f15:	83 c4 10             	add    $0x10,%esp
+  802f18:	eb 21                	jmp    802f3b <__divdi3+0x4b>
+  802f1a:	f7 d8                	neg    %eax
+  802f1c:	83 d2 00             	adc    $0x0,%edx
+  802f1f:	f7 da                	neg    %edx
+  802f21:	85 db                	test   %ebx,%ebx
+  802f23:	78 30                	js     802f55 <__divdi3+0x65>
+  802f25:	83 ec 04             	sub    $0x4,%esp
+  802f28:	6a 00                	push   $0x0
+  802f2a:	53                   	push   %ebx
+  802f2b:	51                   	push   %ecx
+  802f2c:	e8 a9 fe ff ff       	call   802dda <dm>
+  802f31:	83 c4 10             	add    $0x10,%esp
+  802f34:	f7 d8                	neg    %eax
+  802f36:	83 d2 00             	adc    $0x0,%edx
+  802f39:	f7 da                	neg    %edx
+  802f3b:	5b                   	pop    %ebx
+  802f3c:	c3                   	ret
+  802f3d:	83 ec 04             	sub    $0x4,%esp
+  802f40:	6a 00                	push   $0x0
+  802f42:	f7 d9                	neg    %ecx
+  802f44:	83 d3 00             	adc    $0x0,%ebx
+  802f47:	f7 db                	neg    %ebx
+  802f49:	53                   	push   %ebx
+  802f4a:	51                   	push   %ecx
+  802f4b:	e8 8a fe ff ff       	call   802dda <dm>
+  802f50:	83 c4 10             	add    $0x10,%esp
+  802f53:	eb df                	jmp    802f34 <__divdi3+0x44>
+  802f55:	83 ec 04             	sub    $0x4,%esp
+  802f58:	6a 00                	push   $0x0
+  802f5a:	f7 d9                	neg    %ecx
+  802f5c:	83 d3 00             	adc    $0x0,%ebx
+  802f5f:	f7 db                	neg    %ebx
+  802f61:	53                   	push   %ebx
+  802f62:	51                   	push   %ecx
+  802f63:	e8 72 fe ff ff       	call   802dda <dm>
+  802f68:	83 c4 10             	add    $0x10,%esp
+  802f6b:	eb ce                	jmp    802f3b <__divdi3+0x4b>
+
+00802f6d <__moddi3>:
+  802f6d:	55                   	push   %ebp
+  802f6e:	57                   	push   %edi
+  802f6f:	56                   	push   %esi
+  802f70:	53                   	push   %ebx
+  802f71:	83 ec 18             	sub    $0x18,%esp
+  802f74:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802f78:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802f7c:	89 f1                	mov    %esi,%ecx
+  802f7e:	f7 d9                	neg    %ecx
+  802f80:	89 da                	mov    %ebx,%edx
+  802f82:	83 d2 00             	adc    $0x0,%edx
+  802f85:	f7 da                	neg    %edx
+  802f87:	0f 48 ce             	cmovs  %esi,%ecx
+  802f8a:	0f 48 d3             	cmovs  %ebx,%edx
+  802f8d:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802f91:	50                   	push   %eax
+  802f92:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802f96:	f7 de                	neg    %esi
+  802f98:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802f9c:	83 d0 00             	adc    $0x0,%eax
+  802f9f:	f7 d8                	neg    %eax
+  802fa1:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802fa6:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802fab:	50                   	push   %eax
+  802fac:	56                   	push   %esi
+  802fad:	89 c8                	mov    %ecx,%eax
+  802faf:	e8 26 fe ff ff       	call   802dda <dm>
+  802fb4:	83 c4 10             	add    $0x10,%esp
+  802fb7:	85 db                	test   %ebx,%ebx
+  802fb9:	78 10                	js     802fcb <__moddi3+0x5e>
+  802fbb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802fbf:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802fc3:	83 c4 14             	add    $0x14,%esp
+  802fc6:	5b                   	pop    %ebx
+  802fc7:	5e                   	pop    %esi
+  802fc8:	5f                   	pop    %edi
+  802fc9:	5d                   	pop    %ebp
+  802fca:	c3                   	ret
+  802fcb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802fcf:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802fd3:	f7 d8                	neg    %eax
+  802fd5:	83 d2 00             	adc    $0x0,%edx
+  802fd8:	f7 da                	neg    %edx
+  802fda:	eb e7                	jmp    802fc3 <__moddi3+0x56>
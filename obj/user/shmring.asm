@@ -0,0 +1,6046 @@
+
+obj/user/shmring:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 38 02 00 00       	call   800269 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+	sys_shm_detach(0, SEGNAME, cons);
+}
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 34             	sub    $0x34,%esp
+	uint64_t start;
+	envid_t envid;
+	uint32_t i;
+	int r;
+
+	if ((r = sys_shm_create(SEGNAME, SEGPAGES)) < 0)
+  80003c:	6a 10                	push   $0x10
+  80003e:	68 80 2f 80 00       	push   $0x802f80
+  800043:	e8 d3 1f 00 00       	call   80201b <sys_shm_create>
+  800048:	83 c4 10             	add    $0x10,%esp
+  80004b:	85 c0                	test   %eax,%eax
+  80004d:	0f 88 b6 00 00 00    	js     800109 <umain+0xd6>
+		panic("sys_shm_create: %e", r);
+	// The child inherits this mapping too (PTE_SHARE), but uses its
+	// own attachment.
+	if ((r = sys_shm_attach(0, SEGNAME, prod, PTE_P | PTE_U | PTE_W)) < 0)
+  800053:	6a 07                	push   $0x7
+  800055:	68 00 00 00 10       	push   $0x10000000
+  80005a:	68 80 2f 80 00       	push   $0x802f80
+  80005f:	6a 00                	push   $0x0
+  800061:	e8 79 20 00 00       	call   8020df <sys_shm_attach>
+  800066:	83 c4 10             	add    $0x10,%esp
+  800069:	85 c0                	test   %eax,%eax
+  80006b:	0f 88 aa 00 00 00    	js     80011b <umain+0xe8>
+		panic("sys_shm_attach: %e", r);
+	if ((r = ring_init(prod, r * PGSIZE, sizeof(struct msg))) < 0)
+  800071:	c1 e0 0c             	shl    $0xc,%eax
+  800074:	83 ec 04             	sub    $0x4,%esp
+  800077:	6a 08                	push   $0x8
+  800079:	50                   	push   %eax
+  80007a:	68 00 00 00 10       	push   $0x10000000
+  80007f:	e8 f8 2a 00 00       	call   802b7c <ring_init>
+  800084:	83 c4 10             	add    $0x10,%esp
+  800087:	85 c0                	test   %eax,%eax
+  800089:	0f 88 9e 00 00 00    	js     80012d <umain+0xfa>
+		panic("ring_init: %e", r);
+	cprintf("ring of %d slots\n", r);
+  80008f:	83 ec 08             	sub    $0x8,%esp
+  800092:	50                   	push   %eax
+  800093:	68 cb 2f 80 00       	push   $0x802fcb
+  800098:	e8 3b 03 00 00       	call   8003d8 <cprintf>
+
+	if ((envid = fork()) < 0)
+  80009d:	e8 8b 2a 00 00       	call   802b2d <fork>
+  8000a2:	89 c7                	mov    %eax,%edi
+  8000a4:	83 c4 10             	add    $0x10,%esp
+  8000a7:	85 c0                	test   %eax,%eax
+  8000a9:	0f 88 90 00 00 00    	js     80013f <umain+0x10c>
+		panic("fork: %e", envid);
+	if (envid == 0) {
+  8000af:	0f 84 9c 00 00 00    	je     800151 <umain+0x11e>
+
+static inline uint64_t
+read_tsc(void)
+{
+	uint64_t tsc;
+	asm volatile("rdtsc" : "=A" (tsc));
+  8000b5:	0f 31                	rdtsc
+  8000b7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8000ba:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+		consumer();
+		return;
+	}
+
+	start = read_tsc();
+	for (i = 0; i < NMSGS; i++) {
+  8000bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+		m.m_seq = i;
+		m.m_value = i * 7;
+		ring_send(prod, &m);
+  8000c2:	8d 75 e0             	lea    -0x20(%ebp),%esi
+		m.m_seq = i;
+  8000c5:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+		m.m_value = i * 7;
+  8000c8:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  8000cf:	29 d8                	sub    %ebx,%eax
+  8000d1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		ring_send(prod, &m);
+  8000d4:	83 ec 08             	sub    $0x8,%esp
+  8000d7:	56                   	push   %esi
+  8000d8:	68 00 00 00 10       	push   $0x10000000
+  8000dd:	e8 a8 2b 00 00       	call   802c8a <ring_send>
+	for (i = 0; i < NMSGS; i++) {
+  8000e2:	83 c3 01             	add    $0x1,%ebx
+  8000e5:	83 c4 10             	add    $0x10,%esp
+  8000e8:	81 fb a0 86 01 00    	cmp    $0x186a0,%ebx
+  8000ee:	75 d5                	jne    8000c5 <umain+0x92>
+	}
+	while (envs[ENVX(envid)].env_id == envid
+  8000f0:	89 fb                	mov    %edi,%ebx
+  8000f2:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8000f8:	69 db 68 01 00 00    	imul   $0x168,%ebx,%ebx
+  8000fe:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  800104:	e9 fd 00 00 00       	jmp    800206 <umain+0x1d3>
+		panic("sys_shm_create: %e", r);
+  800109:	50                   	push   %eax
+  80010a:	68 88 2f 80 00       	push   $0x802f88
+  80010f:	6a 35                	push   $0x35
+  800111:	68 9b 2f 80 00       	push   $0x802f9b
+  800116:	e8 a9 01 00 00       	call   8002c4 <_panic>
+		panic("sys_shm_attach: %e", r);
+  80011b:	50                   	push   %eax
+  80011c:	68 aa 2f 80 00       	push   $0x802faa
+  800121:	6a 39                	push   $0x39
+  800123:	68 9b 2f 80 00       	push   $0x802f9b
+  800128:	e8 97 01 00 00       	call   8002c4 <_panic>
+		panic("ring_init: %e", r);
+  80012d:	50                   	push   %eax
+  80012e:	68 bd 2f 80 00       	push   $0x802fbd
+  800133:	6a 3b                	push   $0x3b
+  800135:	68 9b 2f 80 00       	push   $0x802f9b
+  80013a:	e8 85 01 00 00       	call   8002c4 <_panic>
+		panic("fork: %e", envid);
+  80013f:	50                   	push   %eax
+  800140:	68 dd 2f 80 00       	push   $0x802fdd
+  800145:	6a 3f                	push   $0x3f
+  800147:	68 9b 2f 80 00       	push   $0x802f9b
+  80014c:	e8 73 01 00 00       	call   8002c4 <_panic>
+	if ((r = sys_shm_attach(0, SEGNAME, cons, PTE_P | PTE_U | PTE_W)) < 0)
+  800151:	6a 07                	push   $0x7
+  800153:	68 00 00 00 20       	push   $0x20000000
+  800158:	68 80 2f 80 00       	push   $0x802f80
+  80015d:	6a 00                	push   $0x0
+  80015f:	e8 7b 1f 00 00       	call   8020df <sys_shm_attach>
+  800164:	83 c4 10             	add    $0x10,%esp
+  800167:	85 c0                	test   %eax,%eax
+  800169:	78 6e                	js     8001d9 <umain+0x1a6>
+	uint64_t sum = 0;
+  80016b:	be 00 00 00 00       	mov    $0x0,%esi
+  800170:	bf 00 00 00 00       	mov    $0x0,%edi
+	for (i = 0; i < NMSGS; i++) {
+  800175:	bb 00 00 00 00       	mov    $0x0,%ebx
+		ring_recv(cons, &m);
+  80017a:	83 ec 08             	sub    $0x8,%esp
+  80017d:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  800180:	50                   	push   %eax
+  800181:	68 00 00 00 20       	push   $0x20000000
+  800186:	e8 29 2b 00 00       	call   802cb4 <ring_recv>
+		if (m.m_seq != i)
+  80018b:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80018e:	83 c4 10             	add    $0x10,%esp
+  800191:	39 c3                	cmp    %eax,%ebx
+  800193:	75 56                	jne    8001eb <umain+0x1b8>
+		sum += m.m_value;
+  800195:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  800198:	ba 00 00 00 00       	mov    $0x0,%edx
+  80019d:	01 c6                	add    %eax,%esi
+  80019f:	11 d7                	adc    %edx,%edi
+	for (i = 0; i < NMSGS; i++) {
+  8001a1:	83 c3 01             	add    $0x1,%ebx
+  8001a4:	81 fb a0 86 01 00    	cmp    $0x186a0,%ebx
+  8001aa:	75 ce                	jne    80017a <umain+0x147>
+	cprintf("consumer: %d messages, sum %llu\n", NMSGS, sum);
+  8001ac:	57                   	push   %edi
+  8001ad:	56                   	push   %esi
+  8001ae:	68 a0 86 01 00       	push   $0x186a0
+  8001b3:	68 00 30 80 00       	push   $0x803000
+  8001b8:	e8 1b 02 00 00       	call   8003d8 <cprintf>
+	sys_shm_detach(0, SEGNAME, cons);
+  8001bd:	83 c4 0c             	add    $0xc,%esp
+  8001c0:	68 00 00 00 20       	push   $0x20000000
+  8001c5:	68 80 2f 80 00       	push   $0x802f80
+  8001ca:	6a 00                	push   $0x0
+  8001cc:	e8 b5 1f 00 00       	call   802186 <sys_shm_detach>
+		return;
+  8001d1:	83 c4 10             	add    $0x10,%esp
+  8001d4:	e9 88 00 00 00       	jmp    800261 <umain+0x22e>
+		panic("sys_shm_attach: %e", r);
+  8001d9:	50                   	push   %eax
+  8001da:	68 aa 2f 80 00       	push   $0x802faa
+  8001df:	6a 20                	push   $0x20
+  8001e1:	68 9b 2f 80 00       	push   $0x802f9b
+  8001e6:	e8 d9 00 00 00       	call   8002c4 <_panic>
+			panic("message %d arrived as %d", i, m.m_seq);
+  8001eb:	83 ec 0c             	sub    $0xc,%esp
+  8001ee:	50                   	push   %eax
+  8001ef:	53                   	push   %ebx
+  8001f0:	68 e6 2f 80 00       	push   $0x802fe6
+  8001f5:	6a 24                	push   $0x24
+  8001f7:	68 9b 2f 80 00       	push   $0x802f9b
+  8001fc:	e8 c3 00 00 00       	call   8002c4 <_panic>
+	       && envs[ENVX(envid)].env_status != ENV_FREE)
+		sys_yield();
+  800201:	e8 07 13 00 00       	call   80150d <sys_yield>
+	while (envs[ENVX(envid)].env_id == envid
+  800206:	8b 43 48             	mov    0x48(%ebx),%eax
+	       && envs[ENVX(envid)].env_status != ENV_FREE)
+  800209:	39 f8                	cmp    %edi,%eax
+  80020b:	75 07                	jne    800214 <umain+0x1e1>
+  80020d:	8b 43 54             	mov    0x54(%ebx),%eax
+  800210:	85 c0                	test   %eax,%eax
+  800212:	75 ed                	jne    800201 <umain+0x1ce>
+  800214:	0f 31                	rdtsc
+	cprintf("producer: %d messages, %llu cycles/message\n", NMSGS,
+		(read_tsc() - start) / NMSGS);
+  800216:	2b 45 d0             	sub    -0x30(%ebp),%eax
+  800219:	1b 55 d4             	sbb    -0x2c(%ebp),%edx
+	cprintf("producer: %d messages, %llu cycles/message\n", NMSGS,
+  80021c:	6a 00                	push   $0x0
+  80021e:	68 a0 86 01 00       	push   $0x186a0
+  800223:	52                   	push   %edx
+  800224:	50                   	push   %eax
+  800225:	e8 14 2c 00 00       	call   802e3e <__udivdi3>
+  80022a:	83 c4 10             	add    $0x10,%esp
+  80022d:	52                   	push   %edx
+  80022e:	50                   	push   %eax
+  80022f:	68 a0 86 01 00       	push   $0x186a0
+  800234:	68 24 30 80 00       	push   $0x803024
+  800239:	e8 9a 01 00 00       	call   8003d8 <cprintf>
+
+	sys_shm_detach(0, SEGNAME, prod);
+  80023e:	83 c4 0c             	add    $0xc,%esp
+  800241:	68 00 00 00 10       	push   $0x10000000
+  800246:	68 80 2f 80 00       	push   $0x802f80
+  80024b:	6a 00                	push   $0x0
+  80024d:	e8 34 1f 00 00       	call   802186 <sys_shm_detach>
+	sys_shm_remove(SEGNAME);
+  800252:	c7 04 24 80 2f 80 00 	movl   $0x802f80,(%esp)
+  800259:	e8 ee 1f 00 00       	call   80224c <sys_shm_remove>
+  80025e:	83 c4 10             	add    $0x10,%esp
+}
+  800261:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800264:	5b                   	pop    %ebx
+  800265:	5e                   	pop    %esi
+  800266:	5f                   	pop    %edi
+  800267:	5d                   	pop    %ebp
+  800268:	c3                   	ret
+
+00800269 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800269:	55                   	push   %ebp
+  80026a:	89 e5                	mov    %esp,%ebp
+  80026c:	56                   	push   %esi
+  80026d:	53                   	push   %ebx
+  80026e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800271:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  800274:	e8 e3 0e 00 00       	call   80115c <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  800279:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80027e:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  800284:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800289:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80028e:	85 db                	test   %ebx,%ebx
+  800290:	7e 07                	jle    800299 <libmain+0x30>
+		binaryname = argv[0];
+  800292:	8b 06                	mov    (%esi),%eax
+  800294:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800299:	83 ec 08             	sub    $0x8,%esp
+  80029c:	56                   	push   %esi
+  80029d:	53                   	push   %ebx
+  80029e:	e8 90 fd ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8002a3:	e8 0a 00 00 00       	call   8002b2 <exit>
+}
+  8002a8:	83 c4 10             	add    $0x10,%esp
+  8002ab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002ae:	5b                   	pop    %ebx
+  8002af:	5e                   	pop    %esi
+  8002b0:	5d                   	pop    %ebp
+  8002b1:	c3                   	ret
+
+008002b2 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8002b2:	55                   	push   %ebp
+  8002b3:	89 e5                	mov    %esp,%ebp
+  8002b5:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  8002b8:	6a 00                	push   $0x0
+  8002ba:	e8 db 0d 00 00       	call   80109a <sys_env_destroy>
+}
+  8002bf:	83 c4 10             	add    $0x10,%esp
+  8002c2:	c9                   	leave
+  8002c3:	c3                   	ret
+
+008002c4 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8002c4:	55                   	push   %ebp
+  8002c5:	89 e5                	mov    %esp,%ebp
+  8002c7:	57                   	push   %edi
+  8002c8:	56                   	push   %esi
+  8002c9:	53                   	push   %ebx
+  8002ca:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  8002d0:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  8002d3:	8b 1d 00 40 80 00    	mov    0x804000,%ebx
+  8002d9:	e8 7e 0e 00 00       	call   80115c <sys_getenvid>
+  8002de:	83 ec 04             	sub    $0x4,%esp
+  8002e1:	ff 75 0c             	push   0xc(%ebp)
+  8002e4:	ff 75 08             	push   0x8(%ebp)
+  8002e7:	53                   	push   %ebx
+  8002e8:	50                   	push   %eax
+  8002e9:	68 5c 30 80 00       	push   $0x80305c
+  8002ee:	68 00 01 00 00       	push   $0x100
+  8002f3:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  8002f9:	56                   	push   %esi
+  8002fa:	e8 72 06 00 00       	call   800971 <snprintf>
+  8002ff:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  800301:	83 c4 20             	add    $0x20,%esp
+  800304:	57                   	push   %edi
+  800305:	ff 75 10             	push   0x10(%ebp)
+  800308:	bf 00 01 00 00       	mov    $0x100,%edi
+  80030d:	89 f8                	mov    %edi,%eax
+  80030f:	29 d8                	sub    %ebx,%eax
+  800311:	50                   	push   %eax
+  800312:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  800315:	50                   	push   %eax
+  800316:	e8 08 06 00 00       	call   800923 <vsnprintf>
+  80031b:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  80031d:	83 c4 0c             	add    $0xc,%esp
+  800320:	68 db 2f 80 00       	push   $0x802fdb
+  800325:	29 df                	sub    %ebx,%edi
+  800327:	57                   	push   %edi
+  800328:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  80032b:	50                   	push   %eax
+  80032c:	e8 40 06 00 00       	call   800971 <snprintf>
+	sys_cputs(buf, r);
+  800331:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  800334:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  800336:	53                   	push   %ebx
+  800337:	56                   	push   %esi
+  800338:	e8 21 0c 00 00       	call   800f5e <sys_cputs>
+  80033d:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800340:	cc                   	int3
+	while (1)
+  800341:	eb fd                	jmp    800340 <_panic+0x7c>
+
+00800343 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800343:	55                   	push   %ebp
+  800344:	89 e5                	mov    %esp,%ebp
+  800346:	53                   	push   %ebx
+  800347:	83 ec 04             	sub    $0x4,%esp
+  80034a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80034d:	8b 13                	mov    (%ebx),%edx
+  80034f:	8d 42 01             	lea    0x1(%edx),%eax
+  800352:	89 03                	mov    %eax,(%ebx)
+  800354:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800357:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80035b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800360:	74 09                	je     80036b <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800362:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800366:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800369:	c9                   	leave
+  80036a:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80036b:	83 ec 08             	sub    $0x8,%esp
+  80036e:	68 ff 00 00 00       	push   $0xff
+  800373:	8d 43 08             	lea    0x8(%ebx),%eax
+  800376:	50                   	push   %eax
+  800377:	e8 e2 0b 00 00       	call   800f5e <sys_cputs>
+		b->idx = 0;
+  80037c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800382:	83 c4 10             	add    $0x10,%esp
+  800385:	eb db                	jmp    800362 <putch+0x1f>
+
+00800387 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800387:	55                   	push   %ebp
+  800388:	89 e5                	mov    %esp,%ebp
+  80038a:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800390:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800397:	00 00 00 
+	b.cnt = 0;
+  80039a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8003a1:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8003a4:	ff 75 0c             	push   0xc(%ebp)
+  8003a7:	ff 75 08             	push   0x8(%ebp)
+  8003aa:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8003b0:	50                   	push   %eax
+  8003b1:	68 43 03 80 00       	push   $0x800343
+  8003b6:	e8 14 01 00 00       	call   8004cf <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8003bb:	83 c4 08             	add    $0x8,%esp
+  8003be:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8003c4:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8003ca:	50                   	push   %eax
+  8003cb:	e8 8e 0b 00 00       	call   800f5e <sys_cputs>
+
+	return b.cnt;
+}
+  8003d0:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8003d6:	c9                   	leave
+  8003d7:	c3                   	ret
+
+008003d8 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8003d8:	55                   	push   %ebp
+  8003d9:	89 e5                	mov    %esp,%ebp
+  8003db:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8003de:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8003e1:	50                   	push   %eax
+  8003e2:	ff 75 08             	push   0x8(%ebp)
+  8003e5:	e8 9d ff ff ff       	call   800387 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8003ea:	c9                   	leave
+  8003eb:	c3                   	ret
+
+008003ec <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8003ec:	55                   	push   %ebp
+  8003ed:	89 e5                	mov    %esp,%ebp
+  8003ef:	57                   	push   %edi
+  8003f0:	56                   	push   %esi
+  8003f1:	53                   	push   %ebx
+  8003f2:	83 ec 1c             	sub    $0x1c,%esp
+  8003f5:	89 c7                	mov    %eax,%edi
+  8003f7:	89 d6                	mov    %edx,%esi
+  8003f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8003ff:	89 d1                	mov    %edx,%ecx
+  800401:	89 c2                	mov    %eax,%edx
+  800403:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800406:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800409:	8b 45 10             	mov    0x10(%ebp),%eax
+  80040c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80040f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800412:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800419:	39 c2                	cmp    %eax,%edx
+  80041b:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80041e:	72 3e                	jb     80045e <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800420:	83 ec 0c             	sub    $0xc,%esp
+  800423:	ff 75 18             	push   0x18(%ebp)
+  800426:	83 eb 01             	sub    $0x1,%ebx
+  800429:	53                   	push   %ebx
+  80042a:	50                   	push   %eax
+  80042b:	83 ec 08             	sub    $0x8,%esp
+  80042e:	ff 75 e4             	push   -0x1c(%ebp)
+  800431:	ff 75 e0             	push   -0x20(%ebp)
+  800434:	ff 75 dc             	push   -0x24(%ebp)
+  800437:	ff 75 d8             	push   -0x28(%ebp)
+  80043a:	e8 ff 29 00 00       	call   802e3e <__udivdi3>
+  80043f:	83 c4 18             	add    $0x18,%esp
+  800442:	52                   	push   %edx
+  800443:	50                   	push   %eax
+  800444:	89 f2                	mov    %esi,%edx
+  800446:	89 f8                	mov    %edi,%eax
+  800448:	e8 9f ff ff ff       	call   8003ec <printnum>
+  80044d:	83 c4 20             	add    $0x20,%esp
+  800450:	eb 13                	jmp    800465 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800452:	83 ec 08             	sub    $0x8,%esp
+  800455:	56                   	push   %esi
+  800456:	ff 75 18             	push   0x18(%ebp)
+  800459:	ff d7                	call   *%edi
+  80045b:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80045e:	83 eb 01             	sub    $0x1,%ebx
+  800461:	85 db                	test   %ebx,%ebx
+  800463:	7f ed                	jg     800452 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800465:	83 ec 08             	sub    $0x8,%esp
+  800468:	56                   	push   %esi
+  800469:	83 ec 04             	sub    $0x4,%esp
+  80046c:	ff 75 e4             	push   -0x1c(%ebp)
+  80046f:	ff 75 e0             	push   -0x20(%ebp)
+  800472:	ff 75 dc             	push   -0x24(%ebp)
+  800475:	ff 75 d8             	push   -0x28(%ebp)
+  800478:	e8 df 29 00 00       	call   802e5c <__umoddi3>
+  80047d:	83 c4 14             	add    $0x14,%esp
+  800480:	0f be 80 7f 30 80 00 	movsbl 0x80307f(%eax),%eax
+  800487:	50                   	push   %eax
+  800488:	ff d7                	call   *%edi
+}
+  80048a:	83 c4 10             	add    $0x10,%esp
+  80048d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800490:	5b                   	pop    %ebx
+  800491:	5e                   	pop    %esi
+  800492:	5f                   	pop    %edi
+  800493:	5d                   	pop    %ebp
+  800494:	c3                   	ret
+
+00800495 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800495:	55                   	push   %ebp
+  800496:	89 e5                	mov    %esp,%ebp
+  800498:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80049b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80049f:	8b 10                	mov    (%eax),%edx
+  8004a1:	3b 50 04             	cmp    0x4(%eax),%edx
+  8004a4:	73 0a                	jae    8004b0 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8004a6:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8004a9:	89 08                	mov    %ecx,(%eax)
+  8004ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004ae:	88 02                	mov    %al,(%edx)
+}
+  8004b0:	5d                   	pop    %ebp
+  8004b1:	c3                   	ret
+
+008004b2 <printfmt>:
+{
+  8004b2:	55                   	push   %ebp
+  8004b3:	89 e5                	mov    %esp,%ebp
+  8004b5:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8004b8:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8004bb:	50                   	push   %eax
+  8004bc:	ff 75 10             	push   0x10(%ebp)
+  8004bf:	ff 75 0c             	push   0xc(%ebp)
+  8004c2:	ff 75 08             	push   0x8(%ebp)
+  8004c5:	e8 05 00 00 00       	call   8004cf <vprintfmt>
+}
+  8004ca:	83 c4 10             	add    $0x10,%esp
+  8004cd:	c9                   	leave
+  8004ce:	c3                   	ret
+
+008004cf <vprintfmt>:
+{
+  8004cf:	55                   	push   %ebp
+  8004d0:	89 e5                	mov    %esp,%ebp
+  8004d2:	57                   	push   %edi
+  8004d3:	56                   	push   %esi
+  8004d4:	53                   	push   %ebx
+  8004d5:	83 ec 2c             	sub    $0x2c,%esp
+  8004d8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004db:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8004de:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8004e1:	eb 0a                	jmp    8004ed <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8004e3:	83 ec 08             	sub    $0x8,%esp
+  8004e6:	53                   	push   %ebx
+  8004e7:	50                   	push   %eax
+  8004e8:	ff d6                	call   *%esi
+  8004ea:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8004ed:	83 c7 01             	add    $0x1,%edi
+  8004f0:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8004f4:	83 f8 25             	cmp    $0x25,%eax
+  8004f7:	74 0c                	je     800505 <vprintfmt+0x36>
+			if (ch == '\0')
+  8004f9:	85 c0                	test   %eax,%eax
+  8004fb:	75 e6                	jne    8004e3 <vprintfmt+0x14>
+}
+  8004fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800500:	5b                   	pop    %ebx
+  800501:	5e                   	pop    %esi
+  800502:	5f                   	pop    %edi
+  800503:	5d                   	pop    %ebp
+  800504:	c3                   	ret
+		padc = ' ';
+  800505:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800509:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800510:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800517:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80051e:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800523:	8d 47 01             	lea    0x1(%edi),%eax
+  800526:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800529:	0f b6 17             	movzbl (%edi),%edx
+  80052c:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80052f:	3c 55                	cmp    $0x55,%al
+  800531:	0f 87 cf 03 00 00    	ja     800906 <vprintfmt+0x437>
+  800537:	0f b6 c0             	movzbl %al,%eax
+  80053a:	ff 24 85 60 31 80 00 	jmp    *0x803160(,%eax,4)
+  800541:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800544:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800548:	eb d9                	jmp    800523 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80054a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80054d:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800551:	eb d0                	jmp    800523 <vprintfmt+0x54>
+  800553:	0f b6 d2             	movzbl %dl,%edx
+  800556:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800559:	b8 00 00 00 00       	mov    $0x0,%eax
+  80055e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800561:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800564:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800568:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80056b:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80056e:	83 f9 09             	cmp    $0x9,%ecx
+  800571:	77 55                	ja     8005c8 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800573:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800576:	eb e9                	jmp    800561 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800578:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057b:	8b 00                	mov    (%eax),%eax
+  80057d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800580:	8b 45 14             	mov    0x14(%ebp),%eax
+  800583:	8d 40 04             	lea    0x4(%eax),%eax
+  800586:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800589:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80058c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800590:	79 91                	jns    800523 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800592:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800595:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800598:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80059f:	eb 82                	jmp    800523 <vprintfmt+0x54>
+			if (width < 0)
+  8005a1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005a4:	85 d2                	test   %edx,%edx
+  8005a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005ab:	0f 49 c2             	cmovns %edx,%eax
+  8005ae:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005b1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8005b4:	e9 6a ff ff ff       	jmp    800523 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005b9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8005bc:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8005c3:	e9 5b ff ff ff       	jmp    800523 <vprintfmt+0x54>
+  8005c8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8005cb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005ce:	eb bc                	jmp    80058c <vprintfmt+0xbd>
+			lflag++;
+  8005d0:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8005d3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8005d6:	e9 48 ff ff ff       	jmp    800523 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8005db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005de:	8d 78 04             	lea    0x4(%eax),%edi
+  8005e1:	83 ec 08             	sub    $0x8,%esp
+  8005e4:	53                   	push   %ebx
+  8005e5:	ff 30                	push   (%eax)
+  8005e7:	ff d6                	call   *%esi
+			break;
+  8005e9:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8005ec:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8005ef:	e9 b1 02 00 00       	jmp    8008a5 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8005f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f7:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8005fa:	8b 10                	mov    (%eax),%edx
+  8005fc:	89 d0                	mov    %edx,%eax
+  8005fe:	f7 d8                	neg    %eax
+  800600:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800603:	83 f8 0d             	cmp    $0xd,%eax
+  800606:	7f 23                	jg     80062b <vprintfmt+0x15c>
+  800608:	8b 14 85 c0 32 80 00 	mov    0x8032c0(,%eax,4),%edx
+  80060f:	85 d2                	test   %edx,%edx
+  800611:	74 18                	je     80062b <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800613:	52                   	push   %edx
+  800614:	68 a0 30 80 00       	push   $0x8030a0
+  800619:	53                   	push   %ebx
+  80061a:	56                   	push   %esi
+  80061b:	e8 92 fe ff ff       	call   8004b2 <printfmt>
+  800620:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800623:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800626:	e9 7a 02 00 00       	jmp    8008a5 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80062b:	50                   	push   %eax
+  80062c:	68 97 30 80 00       	push   $0x803097
+  800631:	53                   	push   %ebx
+  800632:	56                   	push   %esi
+  800633:	e8 7a fe ff ff       	call   8004b2 <printfmt>
+  800638:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80063b:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80063e:	e9 62 02 00 00       	jmp    8008a5 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800643:	8b 45 14             	mov    0x14(%ebp),%eax
+  800646:	83 c0 04             	add    $0x4,%eax
+  800649:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80064c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064f:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800651:	85 c9                	test   %ecx,%ecx
+  800653:	b8 90 30 80 00       	mov    $0x803090,%eax
+  800658:	0f 45 c1             	cmovne %ecx,%eax
+  80065b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80065e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800662:	7e 06                	jle    80066a <vprintfmt+0x19b>
+  800664:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800668:	75 0b                	jne    800675 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80066a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80066d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800670:	89 75 08             	mov    %esi,0x8(%ebp)
+  800673:	eb 5c                	jmp    8006d1 <vprintfmt+0x202>
+  800675:	83 ec 08             	sub    $0x8,%esp
+  800678:	ff 75 d0             	push   -0x30(%ebp)
+  80067b:	ff 75 cc             	push   -0x34(%ebp)
+  80067e:	e8 20 03 00 00       	call   8009a3 <strnlen>
+  800683:	89 c2                	mov    %eax,%edx
+  800685:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800688:	29 d0                	sub    %edx,%eax
+  80068a:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80068d:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800691:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800694:	89 75 08             	mov    %esi,0x8(%ebp)
+  800697:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800699:	eb 0e                	jmp    8006a9 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80069b:	83 ec 08             	sub    $0x8,%esp
+  80069e:	53                   	push   %ebx
+  80069f:	57                   	push   %edi
+  8006a0:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006a3:	83 ee 01             	sub    $0x1,%esi
+  8006a6:	83 c4 10             	add    $0x10,%esp
+  8006a9:	85 f6                	test   %esi,%esi
+  8006ab:	7f ee                	jg     80069b <vprintfmt+0x1cc>
+  8006ad:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006b0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006b3:	85 c0                	test   %eax,%eax
+  8006b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006ba:	0f 49 d0             	cmovns %eax,%edx
+  8006bd:	29 d0                	sub    %edx,%eax
+  8006bf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006c2:	eb a6                	jmp    80066a <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8006c4:	83 ec 08             	sub    $0x8,%esp
+  8006c7:	53                   	push   %ebx
+  8006c8:	52                   	push   %edx
+  8006c9:	ff 55 08             	call   *0x8(%ebp)
+  8006cc:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8006cf:	89 f1                	mov    %esi,%ecx
+  8006d1:	8d 71 01             	lea    0x1(%ecx),%esi
+  8006d4:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8006d8:	0f be d0             	movsbl %al,%edx
+  8006db:	85 d2                	test   %edx,%edx
+  8006dd:	74 28                	je     800707 <vprintfmt+0x238>
+  8006df:	85 ff                	test   %edi,%edi
+  8006e1:	78 05                	js     8006e8 <vprintfmt+0x219>
+  8006e3:	83 ef 01             	sub    $0x1,%edi
+  8006e6:	78 30                	js     800718 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8006e8:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8006ec:	74 d6                	je     8006c4 <vprintfmt+0x1f5>
+  8006ee:	0f be c0             	movsbl %al,%eax
+  8006f1:	83 e8 20             	sub    $0x20,%eax
+  8006f4:	83 f8 5e             	cmp    $0x5e,%eax
+  8006f7:	76 cb                	jbe    8006c4 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8006f9:	83 ec 08             	sub    $0x8,%esp
+  8006fc:	53                   	push   %ebx
+  8006fd:	6a 3f                	push   $0x3f
+  8006ff:	ff 55 08             	call   *0x8(%ebp)
+  800702:	83 c4 10             	add    $0x10,%esp
+  800705:	eb c8                	jmp    8006cf <vprintfmt+0x200>
+  800707:	8b 75 08             	mov    0x8(%ebp),%esi
+  80070a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80070d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800710:	01 d0                	add    %edx,%eax
+  800712:	29 c8                	sub    %ecx,%eax
+  800714:	89 c7                	mov    %eax,%edi
+  800716:	eb 13                	jmp    80072b <vprintfmt+0x25c>
+  800718:	8b 75 08             	mov    0x8(%ebp),%esi
+  80071b:	eb ed                	jmp    80070a <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80071d:	83 ec 08             	sub    $0x8,%esp
+  800720:	53                   	push   %ebx
+  800721:	6a 20                	push   $0x20
+  800723:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800725:	83 ef 01             	sub    $0x1,%edi
+  800728:	83 c4 10             	add    $0x10,%esp
+  80072b:	85 ff                	test   %edi,%edi
+  80072d:	7f ee                	jg     80071d <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80072f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800732:	89 45 14             	mov    %eax,0x14(%ebp)
+  800735:	e9 6b 01 00 00       	jmp    8008a5 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80073a:	83 f9 01             	cmp    $0x1,%ecx
+  80073d:	7f 1f                	jg     80075e <vprintfmt+0x28f>
+	else if (lflag)
+  80073f:	85 c9                	test   %ecx,%ecx
+  800741:	74 67                	je     8007aa <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800743:	8b 45 14             	mov    0x14(%ebp),%eax
+  800746:	8b 00                	mov    (%eax),%eax
+  800748:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80074b:	89 c1                	mov    %eax,%ecx
+  80074d:	c1 f9 1f             	sar    $0x1f,%ecx
+  800750:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800753:	8b 45 14             	mov    0x14(%ebp),%eax
+  800756:	8d 40 04             	lea    0x4(%eax),%eax
+  800759:	89 45 14             	mov    %eax,0x14(%ebp)
+  80075c:	eb 17                	jmp    800775 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80075e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800761:	8b 50 04             	mov    0x4(%eax),%edx
+  800764:	8b 00                	mov    (%eax),%eax
+  800766:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800769:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80076c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076f:	8d 40 08             	lea    0x8(%eax),%eax
+  800772:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800775:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800778:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80077b:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800780:	85 c9                	test   %ecx,%ecx
+  800782:	0f 89 03 01 00 00    	jns    80088b <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800788:	83 ec 08             	sub    $0x8,%esp
+  80078b:	53                   	push   %ebx
+  80078c:	6a 2d                	push   $0x2d
+  80078e:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800790:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800793:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800796:	f7 da                	neg    %edx
+  800798:	83 d1 00             	adc    $0x0,%ecx
+  80079b:	f7 d9                	neg    %ecx
+  80079d:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8007a0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8007a5:	e9 e1 00 00 00       	jmp    80088b <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8007aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ad:	8b 00                	mov    (%eax),%eax
+  8007af:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007b2:	89 c1                	mov    %eax,%ecx
+  8007b4:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007b7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007bd:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007c3:	eb b0                	jmp    800775 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8007c5:	83 f9 01             	cmp    $0x1,%ecx
+  8007c8:	7f 1e                	jg     8007e8 <vprintfmt+0x319>
+	else if (lflag)
+  8007ca:	85 c9                	test   %ecx,%ecx
+  8007cc:	74 32                	je     800800 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8007ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d1:	8b 10                	mov    (%eax),%edx
+  8007d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007d8:	8d 40 04             	lea    0x4(%eax),%eax
+  8007db:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007de:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8007e3:	e9 a3 00 00 00       	jmp    80088b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8007e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007eb:	8b 10                	mov    (%eax),%edx
+  8007ed:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007f0:	8d 40 08             	lea    0x8(%eax),%eax
+  8007f3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007f6:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8007fb:	e9 8b 00 00 00       	jmp    80088b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800800:	8b 45 14             	mov    0x14(%ebp),%eax
+  800803:	8b 10                	mov    (%eax),%edx
+  800805:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80080a:	8d 40 04             	lea    0x4(%eax),%eax
+  80080d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800810:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800815:	eb 74                	jmp    80088b <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800817:	83 f9 01             	cmp    $0x1,%ecx
+  80081a:	7f 1b                	jg     800837 <vprintfmt+0x368>
+	else if (lflag)
+  80081c:	85 c9                	test   %ecx,%ecx
+  80081e:	74 2c                	je     80084c <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800820:	8b 45 14             	mov    0x14(%ebp),%eax
+  800823:	8b 10                	mov    (%eax),%edx
+  800825:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80082a:	8d 40 04             	lea    0x4(%eax),%eax
+  80082d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800830:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800835:	eb 54                	jmp    80088b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800837:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083a:	8b 10                	mov    (%eax),%edx
+  80083c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80083f:	8d 40 08             	lea    0x8(%eax),%eax
+  800842:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800845:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80084a:	eb 3f                	jmp    80088b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80084c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80084f:	8b 10                	mov    (%eax),%edx
+  800851:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800856:	8d 40 04             	lea    0x4(%eax),%eax
+  800859:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80085c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800861:	eb 28                	jmp    80088b <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800863:	83 ec 08             	sub    $0x8,%esp
+  800866:	53                   	push   %ebx
+  800867:	6a 30                	push   $0x30
+  800869:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80086b:	83 c4 08             	add    $0x8,%esp
+  80086e:	53                   	push   %ebx
+  80086f:	6a 78                	push   $0x78
+  800871:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800873:	8b 45 14             	mov    0x14(%ebp),%eax
+  800876:	8b 10                	mov    (%eax),%edx
+  800878:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80087d:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800880:	8d 40 04             	lea    0x4(%eax),%eax
+  800883:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800886:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80088b:	83 ec 0c             	sub    $0xc,%esp
+  80088e:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800892:	50                   	push   %eax
+  800893:	ff 75 e0             	push   -0x20(%ebp)
+  800896:	57                   	push   %edi
+  800897:	51                   	push   %ecx
+  800898:	52                   	push   %edx
+  800899:	89 da                	mov    %ebx,%edx
+  80089b:	89 f0                	mov    %esi,%eax
+  80089d:	e8 4a fb ff ff       	call   8003ec <printnum>
+			break;
+  8008a2:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8008a5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8008a8:	e9 40 fc ff ff       	jmp    8004ed <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8008ad:	83 f9 01             	cmp    $0x1,%ecx
+  8008b0:	7f 1b                	jg     8008cd <vprintfmt+0x3fe>
+	else if (lflag)
+  8008b2:	85 c9                	test   %ecx,%ecx
+  8008b4:	74 2c                	je     8008e2 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8008b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b9:	8b 10                	mov    (%eax),%edx
+  8008bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008c0:	8d 40 04             	lea    0x4(%eax),%eax
+  8008c3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008c6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8008cb:	eb be                	jmp    80088b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8008cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d0:	8b 10                	mov    (%eax),%edx
+  8008d2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008d5:	8d 40 08             	lea    0x8(%eax),%eax
+  8008d8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008db:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8008e0:	eb a9                	jmp    80088b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8008e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e5:	8b 10                	mov    (%eax),%edx
+  8008e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008ec:	8d 40 04             	lea    0x4(%eax),%eax
+  8008ef:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008f2:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8008f7:	eb 92                	jmp    80088b <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8008f9:	83 ec 08             	sub    $0x8,%esp
+  8008fc:	53                   	push   %ebx
+  8008fd:	6a 25                	push   $0x25
+  8008ff:	ff d6                	call   *%esi
+			break;
+  800901:	83 c4 10             	add    $0x10,%esp
+  800904:	eb 9f                	jmp    8008a5 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800906:	83 ec 08             	sub    $0x8,%esp
+  800909:	53                   	push   %ebx
+  80090a:	6a 25                	push   $0x25
+  80090c:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80090e:	83 c4 10             	add    $0x10,%esp
+  800911:	89 f8                	mov    %edi,%eax
+  800913:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800917:	74 05                	je     80091e <vprintfmt+0x44f>
+  800919:	83 e8 01             	sub    $0x1,%eax
+  80091c:	eb f5                	jmp    800913 <vprintfmt+0x444>
+  80091e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800921:	eb 82                	jmp    8008a5 <vprintfmt+0x3d6>
+
+00800923 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800923:	55                   	push   %ebp
+  800924:	89 e5                	mov    %esp,%ebp
+  800926:	83 ec 18             	sub    $0x18,%esp
+  800929:	8b 45 08             	mov    0x8(%ebp),%eax
+  80092c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80092f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800932:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800936:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800939:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800940:	85 c0                	test   %eax,%eax
+  800942:	74 26                	je     80096a <vsnprintf+0x47>
+  800944:	85 d2                	test   %edx,%edx
+  800946:	7e 22                	jle    80096a <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800948:	ff 75 14             	push   0x14(%ebp)
+  80094b:	ff 75 10             	push   0x10(%ebp)
+  80094e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800951:	50                   	push   %eax
+  800952:	68 95 04 80 00       	push   $0x800495
+  800957:	e8 73 fb ff ff       	call   8004cf <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80095c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80095f:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800962:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800965:	83 c4 10             	add    $0x10,%esp
+}
+  800968:	c9                   	leave
+  800969:	c3                   	ret
+		return -E_INVAL;
+  80096a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80096f:	eb f7                	jmp    800968 <vsnprintf+0x45>
+
+00800971 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800971:	55                   	push   %ebp
+  800972:	89 e5                	mov    %esp,%ebp
+  800974:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800977:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80097a:	50                   	push   %eax
+  80097b:	ff 75 10             	push   0x10(%ebp)
+  80097e:	ff 75 0c             	push   0xc(%ebp)
+  800981:	ff 75 08             	push   0x8(%ebp)
+  800984:	e8 9a ff ff ff       	call   800923 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800989:	c9                   	leave
+  80098a:	c3                   	ret
+
+0080098b <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80098b:	55                   	push   %ebp
+  80098c:	89 e5                	mov    %esp,%ebp
+  80098e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800991:	b8 00 00 00 00       	mov    $0x0,%eax
+  800996:	eb 03                	jmp    80099b <strlen+0x10>
+		n++;
+  800998:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80099b:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80099f:	75 f7                	jne    800998 <strlen+0xd>
+	return n;
+}
+  8009a1:	5d                   	pop    %ebp
+  8009a2:	c3                   	ret
+
+008009a3 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8009a3:	55                   	push   %ebp
+  8009a4:	89 e5                	mov    %esp,%ebp
+  8009a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009a9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b1:	eb 03                	jmp    8009b6 <strnlen+0x13>
+		n++;
+  8009b3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009b6:	39 d0                	cmp    %edx,%eax
+  8009b8:	74 08                	je     8009c2 <strnlen+0x1f>
+  8009ba:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009be:	75 f3                	jne    8009b3 <strnlen+0x10>
+  8009c0:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8009c2:	89 d0                	mov    %edx,%eax
+  8009c4:	5d                   	pop    %ebp
+  8009c5:	c3                   	ret
+
+008009c6 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8009c6:	55                   	push   %ebp
+  8009c7:	89 e5                	mov    %esp,%ebp
+  8009c9:	53                   	push   %ebx
+  8009ca:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009cd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8009d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d5:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8009d9:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8009dc:	83 c0 01             	add    $0x1,%eax
+  8009df:	84 d2                	test   %dl,%dl
+  8009e1:	75 f2                	jne    8009d5 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8009e3:	89 c8                	mov    %ecx,%eax
+  8009e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009e8:	c9                   	leave
+  8009e9:	c3                   	ret
+
+008009ea <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8009ea:	55                   	push   %ebp
+  8009eb:	89 e5                	mov    %esp,%ebp
+  8009ed:	53                   	push   %ebx
+  8009ee:	83 ec 10             	sub    $0x10,%esp
+  8009f1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8009f4:	53                   	push   %ebx
+  8009f5:	e8 91 ff ff ff       	call   80098b <strlen>
+  8009fa:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8009fd:	ff 75 0c             	push   0xc(%ebp)
+  800a00:	01 d8                	add    %ebx,%eax
+  800a02:	50                   	push   %eax
+  800a03:	e8 be ff ff ff       	call   8009c6 <strcpy>
+	return dst;
+}
+  800a08:	89 d8                	mov    %ebx,%eax
+  800a0a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a0d:	c9                   	leave
+  800a0e:	c3                   	ret
+
+00800a0f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a0f:	55                   	push   %ebp
+  800a10:	89 e5                	mov    %esp,%ebp
+  800a12:	56                   	push   %esi
+  800a13:	53                   	push   %ebx
+  800a14:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a17:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a1a:	89 f3                	mov    %esi,%ebx
+  800a1c:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a1f:	89 f0                	mov    %esi,%eax
+  800a21:	eb 0f                	jmp    800a32 <strncpy+0x23>
+		*dst++ = *src;
+  800a23:	83 c0 01             	add    $0x1,%eax
+  800a26:	0f b6 0a             	movzbl (%edx),%ecx
+  800a29:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a2c:	80 f9 01             	cmp    $0x1,%cl
+  800a2f:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a32:	39 d8                	cmp    %ebx,%eax
+  800a34:	75 ed                	jne    800a23 <strncpy+0x14>
+	}
+	return ret;
+}
+  800a36:	89 f0                	mov    %esi,%eax
+  800a38:	5b                   	pop    %ebx
+  800a39:	5e                   	pop    %esi
+  800a3a:	5d                   	pop    %ebp
+  800a3b:	c3                   	ret
+
+00800a3c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a3c:	55                   	push   %ebp
+  800a3d:	89 e5                	mov    %esp,%ebp
+  800a3f:	56                   	push   %esi
+  800a40:	53                   	push   %ebx
+  800a41:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a47:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a4a:	89 f0                	mov    %esi,%eax
+  800a4c:	85 d2                	test   %edx,%edx
+  800a4e:	74 21                	je     800a71 <strlcpy+0x35>
+  800a50:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800a54:	89 f2                	mov    %esi,%edx
+  800a56:	eb 09                	jmp    800a61 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800a58:	83 c1 01             	add    $0x1,%ecx
+  800a5b:	83 c2 01             	add    $0x1,%edx
+  800a5e:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800a61:	39 c2                	cmp    %eax,%edx
+  800a63:	74 09                	je     800a6e <strlcpy+0x32>
+  800a65:	0f b6 19             	movzbl (%ecx),%ebx
+  800a68:	84 db                	test   %bl,%bl
+  800a6a:	75 ec                	jne    800a58 <strlcpy+0x1c>
+  800a6c:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800a6e:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a71:	29 f0                	sub    %esi,%eax
+}
+  800a73:	5b                   	pop    %ebx
+  800a74:	5e                   	pop    %esi
+  800a75:	5d                   	pop    %ebp
+  800a76:	c3                   	ret
+
+00800a77 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a77:	55                   	push   %ebp
+  800a78:	89 e5                	mov    %esp,%ebp
+  800a7a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a7d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a80:	eb 06                	jmp    800a88 <strcmp+0x11>
+		p++, q++;
+  800a82:	83 c1 01             	add    $0x1,%ecx
+  800a85:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a88:	0f b6 01             	movzbl (%ecx),%eax
+  800a8b:	84 c0                	test   %al,%al
+  800a8d:	74 04                	je     800a93 <strcmp+0x1c>
+  800a8f:	3a 02                	cmp    (%edx),%al
+  800a91:	74 ef                	je     800a82 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a93:	0f b6 c0             	movzbl %al,%eax
+  800a96:	0f b6 12             	movzbl (%edx),%edx
+  800a99:	29 d0                	sub    %edx,%eax
+}
+  800a9b:	5d                   	pop    %ebp
+  800a9c:	c3                   	ret
+
+00800a9d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a9d:	55                   	push   %ebp
+  800a9e:	89 e5                	mov    %esp,%ebp
+  800aa0:	53                   	push   %ebx
+  800aa1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aa4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800aa7:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800aaa:	eb 09                	jmp    800ab5 <strncmp+0x18>
+		n--, p++, q++;
+  800aac:	83 ea 01             	sub    $0x1,%edx
+  800aaf:	83 c0 01             	add    $0x1,%eax
+  800ab2:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800ab5:	85 d2                	test   %edx,%edx
+  800ab7:	74 18                	je     800ad1 <strncmp+0x34>
+  800ab9:	0f b6 18             	movzbl (%eax),%ebx
+  800abc:	84 db                	test   %bl,%bl
+  800abe:	74 04                	je     800ac4 <strncmp+0x27>
+  800ac0:	3a 19                	cmp    (%ecx),%bl
+  800ac2:	74 e8                	je     800aac <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ac4:	0f b6 00             	movzbl (%eax),%eax
+  800ac7:	0f b6 11             	movzbl (%ecx),%edx
+  800aca:	29 d0                	sub    %edx,%eax
+}
+  800acc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800acf:	c9                   	leave
+  800ad0:	c3                   	ret
+		return 0;
+  800ad1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ad6:	eb f4                	jmp    800acc <strncmp+0x2f>
+
+00800ad8 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800ad8:	55                   	push   %ebp
+  800ad9:	89 e5                	mov    %esp,%ebp
+  800adb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ade:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800ae2:	eb 03                	jmp    800ae7 <strchr+0xf>
+  800ae4:	83 c0 01             	add    $0x1,%eax
+  800ae7:	0f b6 10             	movzbl (%eax),%edx
+  800aea:	84 d2                	test   %dl,%dl
+  800aec:	74 06                	je     800af4 <strchr+0x1c>
+		if (*s == c)
+  800aee:	38 ca                	cmp    %cl,%dl
+  800af0:	75 f2                	jne    800ae4 <strchr+0xc>
+  800af2:	eb 05                	jmp    800af9 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800af4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800af9:	5d                   	pop    %ebp
+  800afa:	c3                   	ret
+
+00800afb <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800afb:	55                   	push   %ebp
+  800afc:	89 e5                	mov    %esp,%ebp
+  800afe:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b01:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b05:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800b08:	38 ca                	cmp    %cl,%dl
+  800b0a:	74 09                	je     800b15 <strfind+0x1a>
+  800b0c:	84 d2                	test   %dl,%dl
+  800b0e:	74 05                	je     800b15 <strfind+0x1a>
+	for (; *s; s++)
+  800b10:	83 c0 01             	add    $0x1,%eax
+  800b13:	eb f0                	jmp    800b05 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800b15:	5d                   	pop    %ebp
+  800b16:	c3                   	ret
+
+00800b17 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b17:	55                   	push   %ebp
+  800b18:	89 e5                	mov    %esp,%ebp
+  800b1a:	57                   	push   %edi
+  800b1b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b1e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b21:	85 c9                	test   %ecx,%ecx
+  800b23:	74 20                	je     800b45 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b25:	89 f8                	mov    %edi,%eax
+  800b27:	09 c8                	or     %ecx,%eax
+  800b29:	a8 03                	test   $0x3,%al
+  800b2b:	75 12                	jne    800b3f <memset+0x28>
+		c &= 0xFF;
+  800b2d:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b31:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b37:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800b3a:	fc                   	cld
+  800b3b:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b3d:	eb 06                	jmp    800b45 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b3f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b42:	fc                   	cld
+  800b43:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b45:	89 f8                	mov    %edi,%eax
+  800b47:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b4a:	c9                   	leave
+  800b4b:	c3                   	ret
+
+00800b4c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b4c:	55                   	push   %ebp
+  800b4d:	89 e5                	mov    %esp,%ebp
+  800b4f:	57                   	push   %edi
+  800b50:	56                   	push   %esi
+  800b51:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b54:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b57:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b5a:	39 c6                	cmp    %eax,%esi
+  800b5c:	73 32                	jae    800b90 <memmove+0x44>
+  800b5e:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b61:	39 d0                	cmp    %edx,%eax
+  800b63:	73 2b                	jae    800b90 <memmove+0x44>
+		s += n;
+		d += n;
+  800b65:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b68:	89 d6                	mov    %edx,%esi
+  800b6a:	09 fe                	or     %edi,%esi
+  800b6c:	09 ce                	or     %ecx,%esi
+  800b6e:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b74:	75 0e                	jne    800b84 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b76:	83 ef 04             	sub    $0x4,%edi
+  800b79:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b7c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b7f:	fd                   	std
+  800b80:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b82:	eb 09                	jmp    800b8d <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b84:	83 ef 01             	sub    $0x1,%edi
+  800b87:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b8a:	fd                   	std
+  800b8b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b8d:	fc                   	cld
+  800b8e:	eb 1a                	jmp    800baa <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b90:	89 f2                	mov    %esi,%edx
+  800b92:	09 c2                	or     %eax,%edx
+  800b94:	09 ca                	or     %ecx,%edx
+  800b96:	f6 c2 03             	test   $0x3,%dl
+  800b99:	75 0a                	jne    800ba5 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b9b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b9e:	89 c7                	mov    %eax,%edi
+  800ba0:	fc                   	cld
+  800ba1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ba3:	eb 05                	jmp    800baa <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800ba5:	89 c7                	mov    %eax,%edi
+  800ba7:	fc                   	cld
+  800ba8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800baa:	5e                   	pop    %esi
+  800bab:	5f                   	pop    %edi
+  800bac:	5d                   	pop    %ebp
+  800bad:	c3                   	ret
+
+00800bae <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800bae:	55                   	push   %ebp
+  800baf:	89 e5                	mov    %esp,%ebp
+  800bb1:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800bb4:	ff 75 10             	push   0x10(%ebp)
+  800bb7:	ff 75 0c             	push   0xc(%ebp)
+  800bba:	ff 75 08             	push   0x8(%ebp)
+  800bbd:	e8 8a ff ff ff       	call   800b4c <memmove>
+}
+  800bc2:	c9                   	leave
+  800bc3:	c3                   	ret
+
+00800bc4 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800bc4:	55                   	push   %ebp
+  800bc5:	89 e5                	mov    %esp,%ebp
+  800bc7:	56                   	push   %esi
+  800bc8:	53                   	push   %ebx
+  800bc9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bcc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800bcf:	89 c6                	mov    %eax,%esi
+  800bd1:	03 75 10             	add    0x10(%ebp),%esi
+  800bd4:	eb 06                	jmp    800bdc <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800bd6:	83 c0 01             	add    $0x1,%eax
+  800bd9:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800bdc:	39 f0                	cmp    %esi,%eax
+  800bde:	74 14                	je     800bf4 <memcmp+0x30>
+		if (*s1 != *s2)
+  800be0:	0f b6 08             	movzbl (%eax),%ecx
+  800be3:	0f b6 1a             	movzbl (%edx),%ebx
+  800be6:	38 d9                	cmp    %bl,%cl
+  800be8:	74 ec                	je     800bd6 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800bea:	0f b6 c1             	movzbl %cl,%eax
+  800bed:	0f b6 db             	movzbl %bl,%ebx
+  800bf0:	29 d8                	sub    %ebx,%eax
+  800bf2:	eb 05                	jmp    800bf9 <memcmp+0x35>
+	}
+
+	return 0;
+  800bf4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bf9:	5b                   	pop    %ebx
+  800bfa:	5e                   	pop    %esi
+  800bfb:	5d                   	pop    %ebp
+  800bfc:	c3                   	ret
+
+00800bfd <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800bfd:	55                   	push   %ebp
+  800bfe:	89 e5                	mov    %esp,%ebp
+  800c00:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c03:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c06:	89 c2                	mov    %eax,%edx
+  800c08:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c0b:	eb 03                	jmp    800c10 <memfind+0x13>
+  800c0d:	83 c0 01             	add    $0x1,%eax
+  800c10:	39 d0                	cmp    %edx,%eax
+  800c12:	73 04                	jae    800c18 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c14:	38 08                	cmp    %cl,(%eax)
+  800c16:	75 f5                	jne    800c0d <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800c18:	5d                   	pop    %ebp
+  800c19:	c3                   	ret
+
+00800c1a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c1a:	55                   	push   %ebp
+  800c1b:	89 e5                	mov    %esp,%ebp
+  800c1d:	57                   	push   %edi
+  800c1e:	56                   	push   %esi
+  800c1f:	53                   	push   %ebx
+  800c20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c23:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c26:	eb 03                	jmp    800c2b <strtol+0x11>
+		s++;
+  800c28:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800c2b:	0f b6 02             	movzbl (%edx),%eax
+  800c2e:	3c 20                	cmp    $0x20,%al
+  800c30:	74 f6                	je     800c28 <strtol+0xe>
+  800c32:	3c 09                	cmp    $0x9,%al
+  800c34:	74 f2                	je     800c28 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c36:	3c 2b                	cmp    $0x2b,%al
+  800c38:	74 2a                	je     800c64 <strtol+0x4a>
+	int neg = 0;
+  800c3a:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800c3f:	3c 2d                	cmp    $0x2d,%al
+  800c41:	74 2b                	je     800c6e <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c43:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c49:	75 0f                	jne    800c5a <strtol+0x40>
+  800c4b:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c4e:	74 28                	je     800c78 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c50:	85 db                	test   %ebx,%ebx
+  800c52:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c57:	0f 44 d8             	cmove  %eax,%ebx
+  800c5a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c5f:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c62:	eb 46                	jmp    800caa <strtol+0x90>
+		s++;
+  800c64:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800c67:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c6c:	eb d5                	jmp    800c43 <strtol+0x29>
+		s++, neg = 1;
+  800c6e:	83 c2 01             	add    $0x1,%edx
+  800c71:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c76:	eb cb                	jmp    800c43 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c78:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c7c:	74 0e                	je     800c8c <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800c7e:	85 db                	test   %ebx,%ebx
+  800c80:	75 d8                	jne    800c5a <strtol+0x40>
+		s++, base = 8;
+  800c82:	83 c2 01             	add    $0x1,%edx
+  800c85:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c8a:	eb ce                	jmp    800c5a <strtol+0x40>
+		s += 2, base = 16;
+  800c8c:	83 c2 02             	add    $0x2,%edx
+  800c8f:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c94:	eb c4                	jmp    800c5a <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c96:	0f be c0             	movsbl %al,%eax
+  800c99:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800c9c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c9f:	7d 3a                	jge    800cdb <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800ca1:	83 c2 01             	add    $0x1,%edx
+  800ca4:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ca8:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800caa:	0f b6 02             	movzbl (%edx),%eax
+  800cad:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800cb0:	89 f3                	mov    %esi,%ebx
+  800cb2:	80 fb 09             	cmp    $0x9,%bl
+  800cb5:	76 df                	jbe    800c96 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800cb7:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800cba:	89 f3                	mov    %esi,%ebx
+  800cbc:	80 fb 19             	cmp    $0x19,%bl
+  800cbf:	77 08                	ja     800cc9 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800cc1:	0f be c0             	movsbl %al,%eax
+  800cc4:	83 e8 57             	sub    $0x57,%eax
+  800cc7:	eb d3                	jmp    800c9c <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800cc9:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ccc:	89 f3                	mov    %esi,%ebx
+  800cce:	80 fb 19             	cmp    $0x19,%bl
+  800cd1:	77 08                	ja     800cdb <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800cd3:	0f be c0             	movsbl %al,%eax
+  800cd6:	83 e8 37             	sub    $0x37,%eax
+  800cd9:	eb c1                	jmp    800c9c <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800cdb:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800cdf:	74 05                	je     800ce6 <strtol+0xcc>
+		*endptr = (char *) s;
+  800ce1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ce4:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ce6:	89 c8                	mov    %ecx,%eax
+  800ce8:	f7 d8                	neg    %eax
+  800cea:	85 ff                	test   %edi,%edi
+  800cec:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800cef:	89 c8                	mov    %ecx,%eax
+  800cf1:	5b                   	pop    %ebx
+  800cf2:	5e                   	pop    %esi
+  800cf3:	5f                   	pop    %edi
+  800cf4:	5d                   	pop    %ebp
+  800cf5:	c3                   	ret
+
+00800cf6 <atoi>:
+
+int
+atoi(const char *s)
+{
+  800cf6:	55                   	push   %ebp
+  800cf7:	89 e5                	mov    %esp,%ebp
+  800cf9:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800cfc:	6a 0a                	push   $0xa
+  800cfe:	6a 00                	push   $0x0
+  800d00:	ff 75 08             	push   0x8(%ebp)
+  800d03:	e8 12 ff ff ff       	call   800c1a <strtol>
+}
+  800d08:	c9                   	leave
+  800d09:	c3                   	ret
+
+00800d0a <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800d0a:	55                   	push   %ebp
+  800d0b:	89 e5                	mov    %esp,%ebp
+  800d0d:	57                   	push   %edi
+  800d0e:	56                   	push   %esi
+  800d0f:	53                   	push   %ebx
+  800d10:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800d16:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800d1c:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800d22:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800d28:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800d2f:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800d32:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800d39:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800d3c:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800d43:	74 76                	je     800dbb <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800d45:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800d4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d4e:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800d54:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800d5b:	0f 88 06 01 00 00    	js     800e67 <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800d61:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800d68:	0f 84 48 01 00 00    	je     800eb6 <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800d6e:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800d74:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800d7a:	be 00 00 00 00       	mov    $0x0,%esi
+  800d7f:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800d85:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800d88:	55                   	push   %ebp
+  800d89:	68 92 0d 80 00       	push   $0x800d92
+  800d8e:	89 e5                	mov    %esp,%ebp
+  800d90:	0f 34                	sysenter
+  800d92:	83 c4 04             	add    $0x4,%esp
+  800d95:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800d96:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800d9c:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800da2:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800da5:	0f 85 9a 01 00 00    	jne    800f45 <page_vec_call+0x23b>
+  800dab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800db0:	8b 75 08             	mov    0x8(%ebp),%esi
+  800db3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800db6:	e9 29 01 00 00       	jmp    800ee4 <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800dbb:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800dc1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dc4:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800dc6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800dcd:	78 2f                	js     800dfe <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800dcf:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800dd6:	74 72                	je     800e4a <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800dd8:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800dde:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800de4:	b8 10 00 00 00       	mov    $0x10,%eax
+  800de9:	89 fb                	mov    %edi,%ebx
+  800deb:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800dee:	55                   	push   %ebp
+  800def:	68 f8 0d 80 00       	push   $0x800df8
+  800df4:	89 e5                	mov    %esp,%ebp
+  800df6:	0f 34                	sysenter
+  800df8:	83 c4 04             	add    $0x4,%esp
+  800dfb:	5d                   	pop    %ebp
+	return ret;
+  800dfc:	eb 98                	jmp    800d96 <page_vec_call+0x8c>
+	asm volatile("cpuid"
+  800dfe:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e03:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800e05:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800e0a:	f6 c6 08             	test   $0x8,%dh
+  800e0d:	74 15                	je     800e24 <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e0f:	89 c2                	mov    %eax,%edx
+  800e11:	c1 ea 08             	shr    $0x8,%edx
+  800e14:	83 e2 0f             	and    $0xf,%edx
+  800e17:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e1c:	83 fa 06             	cmp    $0x6,%edx
+  800e1f:	74 0e                	je     800e2f <page_vec_call+0x125>
+  800e21:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e24:	0f b6 c9             	movzbl %cl,%ecx
+  800e27:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800e2d:	eb a0                	jmp    800dcf <page_vec_call+0xc5>
+  800e2f:	89 c2                	mov    %eax,%edx
+  800e31:	c1 ea 04             	shr    $0x4,%edx
+  800e34:	83 e2 0f             	and    $0xf,%edx
+  800e37:	83 fa 02             	cmp    $0x2,%edx
+  800e3a:	77 e5                	ja     800e21 <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800e3c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e3f:	83 f8 02             	cmp    $0x2,%eax
+  800e42:	0f 97 c1             	seta   %cl
+  800e45:	0f b6 c9             	movzbl %cl,%ecx
+  800e48:	eb d7                	jmp    800e21 <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800e4a:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e4f:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800e55:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800e5b:	89 fb                	mov    %edi,%ebx
+  800e5d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800e60:	cd 30                	int    $0x30
+  800e62:	e9 2f ff ff ff       	jmp    800d96 <page_vec_call+0x8c>
+  800e67:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e6c:	0f a2                	cpuid
+		return 0;
+  800e6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800e73:	f6 c6 08             	test   $0x8,%dh
+  800e76:	74 15                	je     800e8d <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e78:	89 c2                	mov    %eax,%edx
+  800e7a:	c1 ea 08             	shr    $0x8,%edx
+  800e7d:	83 e2 0f             	and    $0xf,%edx
+  800e80:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e85:	83 fa 06             	cmp    $0x6,%edx
+  800e88:	74 11                	je     800e9b <page_vec_call+0x191>
+  800e8a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e8d:	0f b6 c9             	movzbl %cl,%ecx
+  800e90:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800e96:	e9 c6 fe ff ff       	jmp    800d61 <page_vec_call+0x57>
+  800e9b:	89 c2                	mov    %eax,%edx
+  800e9d:	c1 ea 04             	shr    $0x4,%edx
+  800ea0:	83 e2 0f             	and    $0xf,%edx
+  800ea3:	83 fa 02             	cmp    $0x2,%edx
+  800ea6:	77 e2                	ja     800e8a <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800ea8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800eab:	83 f8 02             	cmp    $0x2,%eax
+  800eae:	0f 97 c1             	seta   %cl
+  800eb1:	0f b6 c9             	movzbl %cl,%ecx
+  800eb4:	eb d4                	jmp    800e8a <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800eb6:	be 00 00 00 00       	mov    $0x0,%esi
+  800ebb:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800ec1:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800ec7:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800ecd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ed0:	cd 30                	int    $0x30
+  800ed2:	e9 bf fe ff ff       	jmp    800d96 <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800ed7:	29 da                	sub    %ebx,%edx
+			vec++;
+  800ed9:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800edc:	83 e8 01             	sub    $0x1,%eax
+  800edf:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800ee4:	85 c0                	test   %eax,%eax
+  800ee6:	74 58                	je     800f40 <page_vec_call+0x236>
+  800ee8:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800eeb:	39 da                	cmp    %ebx,%edx
+  800eed:	73 e8                	jae    800ed7 <page_vec_call+0x1cd>
+  800eef:	89 75 08             	mov    %esi,0x8(%ebp)
+  800ef2:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800ef5:	84 c9                	test   %cl,%cl
+  800ef7:	74 06                	je     800eff <page_vec_call+0x1f5>
+  800ef9:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800eff:	83 ec 04             	sub    $0x4,%esp
+  800f02:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f05:	c1 e0 04             	shl    $0x4,%eax
+  800f08:	50                   	push   %eax
+  800f09:	ff 75 08             	push   0x8(%ebp)
+  800f0c:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800f12:	53                   	push   %ebx
+  800f13:	e8 34 fc ff ff       	call   800b4c <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800f18:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800f1e:	89 c2                	mov    %eax,%edx
+  800f20:	c1 e2 0c             	shl    $0xc,%edx
+  800f23:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  800f29:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  800f2f:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  800f35:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  800f38:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  800f3b:	e9 f2 fd ff ff       	jmp    800d32 <page_vec_call+0x28>
+			r = 0;
+  800f40:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  800f45:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800f49:	74 0b                	je     800f56 <page_vec_call+0x24c>
+		*done = total;
+  800f4b:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800f4e:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  800f54:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  800f56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f59:	5b                   	pop    %ebx
+  800f5a:	5e                   	pop    %esi
+  800f5b:	5f                   	pop    %edi
+  800f5c:	5d                   	pop    %ebp
+  800f5d:	c3                   	ret
+
+00800f5e <sys_cputs>:
+{
+  800f5e:	55                   	push   %ebp
+  800f5f:	89 e5                	mov    %esp,%ebp
+  800f61:	57                   	push   %edi
+  800f62:	56                   	push   %esi
+  800f63:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800f64:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800f6b:	78 2d                	js     800f9a <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800f6d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800f74:	74 70                	je     800fe6 <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800f76:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f81:	89 c3                	mov    %eax,%ebx
+  800f83:	89 c7                	mov    %eax,%edi
+  800f85:	89 c6                	mov    %eax,%esi
+  800f87:	55                   	push   %ebp
+  800f88:	68 91 0f 80 00       	push   $0x800f91
+  800f8d:	89 e5                	mov    %esp,%ebp
+  800f8f:	0f 34                	sysenter
+  800f91:	83 c4 04             	add    $0x4,%esp
+  800f94:	5d                   	pop    %ebp
+}
+  800f95:	5b                   	pop    %ebx
+  800f96:	5e                   	pop    %esi
+  800f97:	5f                   	pop    %edi
+  800f98:	5d                   	pop    %ebp
+  800f99:	c3                   	ret
+  800f9a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f9f:	0f a2                	cpuid
+		return 0;
+  800fa1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800fa6:	f6 c6 08             	test   $0x8,%dh
+  800fa9:	74 15                	je     800fc0 <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800fab:	89 c2                	mov    %eax,%edx
+  800fad:	c1 ea 08             	shr    $0x8,%edx
+  800fb0:	83 e2 0f             	and    $0xf,%edx
+  800fb3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800fb8:	83 fa 06             	cmp    $0x6,%edx
+  800fbb:	74 0e                	je     800fcb <sys_cputs+0x6d>
+  800fbd:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800fc0:	0f b6 c9             	movzbl %cl,%ecx
+  800fc3:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800fc9:	eb a2                	jmp    800f6d <sys_cputs+0xf>
+  800fcb:	89 c2                	mov    %eax,%edx
+  800fcd:	c1 ea 04             	shr    $0x4,%edx
+  800fd0:	83 e2 0f             	and    $0xf,%edx
+  800fd3:	83 fa 02             	cmp    $0x2,%edx
+  800fd6:	77 e5                	ja     800fbd <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800fd8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800fdb:	83 f8 02             	cmp    $0x2,%eax
+  800fde:	0f 97 c1             	seta   %cl
+  800fe1:	0f b6 c9             	movzbl %cl,%ecx
+  800fe4:	eb d7                	jmp    800fbd <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800fe6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800feb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff1:	89 c3                	mov    %eax,%ebx
+  800ff3:	89 c7                	mov    %eax,%edi
+  800ff5:	89 c6                	mov    %eax,%esi
+  800ff7:	cd 30                	int    $0x30
+}
+  800ff9:	eb 9a                	jmp    800f95 <sys_cputs+0x37>
+
+00800ffb <sys_cgetc>:
+{
+  800ffb:	55                   	push   %ebp
+  800ffc:	89 e5                	mov    %esp,%ebp
+  800ffe:	57                   	push   %edi
+  800fff:	56                   	push   %esi
+  801000:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801001:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801008:	78 2e                	js     801038 <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  80100a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801011:	74 71                	je     801084 <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  801013:	ba 00 00 00 00       	mov    $0x0,%edx
+  801018:	b8 01 00 00 00       	mov    $0x1,%eax
+  80101d:	89 d1                	mov    %edx,%ecx
+  80101f:	89 d3                	mov    %edx,%ebx
+  801021:	89 d7                	mov    %edx,%edi
+  801023:	89 d6                	mov    %edx,%esi
+  801025:	55                   	push   %ebp
+  801026:	68 2f 10 80 00       	push   $0x80102f
+  80102b:	89 e5                	mov    %esp,%ebp
+  80102d:	0f 34                	sysenter
+  80102f:	83 c4 04             	add    $0x4,%esp
+  801032:	5d                   	pop    %ebp
+}
+  801033:	5b                   	pop    %ebx
+  801034:	5e                   	pop    %esi
+  801035:	5f                   	pop    %edi
+  801036:	5d                   	pop    %ebp
+  801037:	c3                   	ret
+  801038:	b8 01 00 00 00       	mov    $0x1,%eax
+  80103d:	0f a2                	cpuid
+		return 0;
+  80103f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801044:	f6 c6 08             	test   $0x8,%dh
+  801047:	74 15                	je     80105e <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801049:	89 c2                	mov    %eax,%edx
+  80104b:	c1 ea 08             	shr    $0x8,%edx
+  80104e:	83 e2 0f             	and    $0xf,%edx
+  801051:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801056:	83 fa 06             	cmp    $0x6,%edx
+  801059:	74 0e                	je     801069 <sys_cgetc+0x6e>
+  80105b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80105e:	0f b6 c9             	movzbl %cl,%ecx
+  801061:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801067:	eb a1                	jmp    80100a <sys_cgetc+0xf>
+  801069:	89 c2                	mov    %eax,%edx
+  80106b:	c1 ea 04             	shr    $0x4,%edx
+  80106e:	83 e2 0f             	and    $0xf,%edx
+  801071:	83 fa 02             	cmp    $0x2,%edx
+  801074:	77 e5                	ja     80105b <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  801076:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801079:	83 f8 02             	cmp    $0x2,%eax
+  80107c:	0f 97 c1             	seta   %cl
+  80107f:	0f b6 c9             	movzbl %cl,%ecx
+  801082:	eb d7                	jmp    80105b <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  801084:	ba 00 00 00 00       	mov    $0x0,%edx
+  801089:	b8 01 00 00 00       	mov    $0x1,%eax
+  80108e:	89 d1                	mov    %edx,%ecx
+  801090:	89 d3                	mov    %edx,%ebx
+  801092:	89 d7                	mov    %edx,%edi
+  801094:	89 d6                	mov    %edx,%esi
+  801096:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801098:	eb 99                	jmp    801033 <sys_cgetc+0x38>
+
+0080109a <sys_env_destroy>:
+{
+  80109a:	55                   	push   %ebp
+  80109b:	89 e5                	mov    %esp,%ebp
+  80109d:	57                   	push   %edi
+  80109e:	56                   	push   %esi
+  80109f:	53                   	push   %ebx
+  8010a0:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8010a3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8010aa:	78 36                	js     8010e2 <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  8010ac:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8010b3:	74 79                	je     80112e <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  8010b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010bd:	b8 03 00 00 00       	mov    $0x3,%eax
+  8010c2:	89 cb                	mov    %ecx,%ebx
+  8010c4:	89 cf                	mov    %ecx,%edi
+  8010c6:	89 ce                	mov    %ecx,%esi
+  8010c8:	55                   	push   %ebp
+  8010c9:	68 d2 10 80 00       	push   $0x8010d2
+  8010ce:	89 e5                	mov    %esp,%ebp
+  8010d0:	0f 34                	sysenter
+  8010d2:	83 c4 04             	add    $0x4,%esp
+  8010d5:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8010d6:	85 c0                	test   %eax,%eax
+  8010d8:	7f 6b                	jg     801145 <sys_env_destroy+0xab>
+}
+  8010da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010dd:	5b                   	pop    %ebx
+  8010de:	5e                   	pop    %esi
+  8010df:	5f                   	pop    %edi
+  8010e0:	5d                   	pop    %ebp
+  8010e1:	c3                   	ret
+  8010e2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010e7:	0f a2                	cpuid
+		return 0;
+  8010e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8010ee:	f6 c6 08             	test   $0x8,%dh
+  8010f1:	74 15                	je     801108 <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010f3:	89 c2                	mov    %eax,%edx
+  8010f5:	c1 ea 08             	shr    $0x8,%edx
+  8010f8:	83 e2 0f             	and    $0xf,%edx
+  8010fb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801100:	83 fa 06             	cmp    $0x6,%edx
+  801103:	74 0e                	je     801113 <sys_env_destroy+0x79>
+  801105:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801108:	0f b6 c9             	movzbl %cl,%ecx
+  80110b:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801111:	eb 99                	jmp    8010ac <sys_env_destroy+0x12>
+  801113:	89 c2                	mov    %eax,%edx
+  801115:	c1 ea 04             	shr    $0x4,%edx
+  801118:	83 e2 0f             	and    $0xf,%edx
+  80111b:	83 fa 02             	cmp    $0x2,%edx
+  80111e:	77 e5                	ja     801105 <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  801120:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801123:	83 f8 02             	cmp    $0x2,%eax
+  801126:	0f 97 c1             	seta   %cl
+  801129:	0f b6 c9             	movzbl %cl,%ecx
+  80112c:	eb d7                	jmp    801105 <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  80112e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801133:	b8 03 00 00 00       	mov    $0x3,%eax
+  801138:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113b:	89 cb                	mov    %ecx,%ebx
+  80113d:	89 cf                	mov    %ecx,%edi
+  80113f:	89 ce                	mov    %ecx,%esi
+  801141:	cd 30                	int    $0x30
+  801143:	eb 91                	jmp    8010d6 <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801145:	83 ec 0c             	sub    $0xc,%esp
+  801148:	50                   	push   %eax
+  801149:	6a 03                	push   $0x3
+  80114b:	68 39 33 80 00       	push   $0x803339
+  801150:	6a 4a                	push   $0x4a
+  801152:	68 56 33 80 00       	push   $0x803356
+  801157:	e8 68 f1 ff ff       	call   8002c4 <_panic>
+
+0080115c <sys_getenvid>:
+{
+  80115c:	55                   	push   %ebp
+  80115d:	89 e5                	mov    %esp,%ebp
+  80115f:	57                   	push   %edi
+  801160:	56                   	push   %esi
+  801161:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801162:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801169:	78 2e                	js     801199 <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  80116b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801172:	74 71                	je     8011e5 <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  801174:	ba 00 00 00 00       	mov    $0x0,%edx
+  801179:	b8 02 00 00 00       	mov    $0x2,%eax
+  80117e:	89 d1                	mov    %edx,%ecx
+  801180:	89 d3                	mov    %edx,%ebx
+  801182:	89 d7                	mov    %edx,%edi
+  801184:	89 d6                	mov    %edx,%esi
+  801186:	55                   	push   %ebp
+  801187:	68 90 11 80 00       	push   $0x801190
+  80118c:	89 e5                	mov    %esp,%ebp
+  80118e:	0f 34                	sysenter
+  801190:	83 c4 04             	add    $0x4,%esp
+  801193:	5d                   	pop    %ebp
+}
+  801194:	5b                   	pop    %ebx
+  801195:	5e                   	pop    %esi
+  801196:	5f                   	pop    %edi
+  801197:	5d                   	pop    %ebp
+  801198:	c3                   	ret
+  801199:	b8 01 00 00 00       	mov    $0x1,%eax
+  80119e:	0f a2                	cpuid
+		return 0;
+  8011a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8011a5:	f6 c6 08             	test   $0x8,%dh
+  8011a8:	74 15                	je     8011bf <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011aa:	89 c2                	mov    %eax,%edx
+  8011ac:	c1 ea 08             	shr    $0x8,%edx
+  8011af:	83 e2 0f             	and    $0xf,%edx
+  8011b2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011b7:	83 fa 06             	cmp    $0x6,%edx
+  8011ba:	74 0e                	je     8011ca <sys_getenvid+0x6e>
+  8011bc:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8011bf:	0f b6 c9             	movzbl %cl,%ecx
+  8011c2:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8011c8:	eb a1                	jmp    80116b <sys_getenvid+0xf>
+  8011ca:	89 c2                	mov    %eax,%edx
+  8011cc:	c1 ea 04             	shr    $0x4,%edx
+  8011cf:	83 e2 0f             	and    $0xf,%edx
+  8011d2:	83 fa 02             	cmp    $0x2,%edx
+  8011d5:	77 e5                	ja     8011bc <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  8011d7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011da:	83 f8 02             	cmp    $0x2,%eax
+  8011dd:	0f 97 c1             	seta   %cl
+  8011e0:	0f b6 c9             	movzbl %cl,%ecx
+  8011e3:	eb d7                	jmp    8011bc <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  8011e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011ea:	b8 02 00 00 00       	mov    $0x2,%eax
+  8011ef:	89 d1                	mov    %edx,%ecx
+  8011f1:	89 d3                	mov    %edx,%ebx
+  8011f3:	89 d7                	mov    %edx,%edi
+  8011f5:	89 d6                	mov    %edx,%esi
+  8011f7:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  8011f9:	eb 99                	jmp    801194 <sys_getenvid+0x38>
+
+008011fb <sys_page_alloc>:
+{
+  8011fb:	55                   	push   %ebp
+  8011fc:	89 e5                	mov    %esp,%ebp
+  8011fe:	57                   	push   %edi
+  8011ff:	56                   	push   %esi
+  801200:	53                   	push   %ebx
+  801201:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801204:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80120b:	78 38                	js     801245 <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  80120d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801214:	74 7b                	je     801291 <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  801216:	be 00 00 00 00       	mov    $0x0,%esi
+  80121b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801221:	b8 04 00 00 00       	mov    $0x4,%eax
+  801226:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801229:	89 f7                	mov    %esi,%edi
+  80122b:	55                   	push   %ebp
+  80122c:	68 35 12 80 00       	push   $0x801235
+  801231:	89 e5                	mov    %esp,%ebp
+  801233:	0f 34                	sysenter
+  801235:	83 c4 04             	add    $0x4,%esp
+  801238:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801239:	85 c0                	test   %eax,%eax
+  80123b:	7f 6d                	jg     8012aa <sys_page_alloc+0xaf>
+}
+  80123d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801240:	5b                   	pop    %ebx
+  801241:	5e                   	pop    %esi
+  801242:	5f                   	pop    %edi
+  801243:	5d                   	pop    %ebp
+  801244:	c3                   	ret
+  801245:	b8 01 00 00 00       	mov    $0x1,%eax
+  80124a:	0f a2                	cpuid
+		return 0;
+  80124c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801251:	f6 c6 08             	test   $0x8,%dh
+  801254:	74 15                	je     80126b <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801256:	89 c2                	mov    %eax,%edx
+  801258:	c1 ea 08             	shr    $0x8,%edx
+  80125b:	83 e2 0f             	and    $0xf,%edx
+  80125e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801263:	83 fa 06             	cmp    $0x6,%edx
+  801266:	74 0e                	je     801276 <sys_page_alloc+0x7b>
+  801268:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80126b:	0f b6 c9             	movzbl %cl,%ecx
+  80126e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801274:	eb 97                	jmp    80120d <sys_page_alloc+0x12>
+  801276:	89 c2                	mov    %eax,%edx
+  801278:	c1 ea 04             	shr    $0x4,%edx
+  80127b:	83 e2 0f             	and    $0xf,%edx
+  80127e:	83 fa 02             	cmp    $0x2,%edx
+  801281:	77 e5                	ja     801268 <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  801283:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801286:	83 f8 02             	cmp    $0x2,%eax
+  801289:	0f 97 c1             	seta   %cl
+  80128c:	0f b6 c9             	movzbl %cl,%ecx
+  80128f:	eb d7                	jmp    801268 <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  801291:	be 00 00 00 00       	mov    $0x0,%esi
+  801296:	b8 04 00 00 00       	mov    $0x4,%eax
+  80129b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80129e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012a4:	89 f7                	mov    %esi,%edi
+  8012a6:	cd 30                	int    $0x30
+  8012a8:	eb 8f                	jmp    801239 <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012aa:	83 ec 0c             	sub    $0xc,%esp
+  8012ad:	50                   	push   %eax
+  8012ae:	6a 04                	push   $0x4
+  8012b0:	68 39 33 80 00       	push   $0x803339
+  8012b5:	6a 4a                	push   $0x4a
+  8012b7:	68 56 33 80 00       	push   $0x803356
+  8012bc:	e8 03 f0 ff ff       	call   8002c4 <_panic>
+
+008012c1 <sys_page_map>:
+{
+  8012c1:	55                   	push   %ebp
+  8012c2:	89 e5                	mov    %esp,%ebp
+  8012c4:	57                   	push   %edi
+  8012c5:	56                   	push   %esi
+  8012c6:	53                   	push   %ebx
+  8012c7:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8012ca:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8012d1:	78 37                	js     80130a <sys_page_map+0x49>
+	if (syscall_sysenter)
+  8012d3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8012da:	74 7a                	je     801356 <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  8012dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e2:	b8 05 00 00 00       	mov    $0x5,%eax
+  8012e7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012ea:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012ed:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012f0:	55                   	push   %ebp
+  8012f1:	68 fa 12 80 00       	push   $0x8012fa
+  8012f6:	89 e5                	mov    %esp,%ebp
+  8012f8:	0f 34                	sysenter
+  8012fa:	83 c4 04             	add    $0x4,%esp
+  8012fd:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8012fe:	85 c0                	test   %eax,%eax
+  801300:	7f 6c                	jg     80136e <sys_page_map+0xad>
+}
+  801302:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801305:	5b                   	pop    %ebx
+  801306:	5e                   	pop    %esi
+  801307:	5f                   	pop    %edi
+  801308:	5d                   	pop    %ebp
+  801309:	c3                   	ret
+  80130a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80130f:	0f a2                	cpuid
+		return 0;
+  801311:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801316:	f6 c6 08             	test   $0x8,%dh
+  801319:	74 15                	je     801330 <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80131b:	89 c2                	mov    %eax,%edx
+  80131d:	c1 ea 08             	shr    $0x8,%edx
+  801320:	83 e2 0f             	and    $0xf,%edx
+  801323:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801328:	83 fa 06             	cmp    $0x6,%edx
+  80132b:	74 0e                	je     80133b <sys_page_map+0x7a>
+  80132d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801330:	0f b6 c9             	movzbl %cl,%ecx
+  801333:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801339:	eb 98                	jmp    8012d3 <sys_page_map+0x12>
+  80133b:	89 c2                	mov    %eax,%edx
+  80133d:	c1 ea 04             	shr    $0x4,%edx
+  801340:	83 e2 0f             	and    $0xf,%edx
+  801343:	83 fa 02             	cmp    $0x2,%edx
+  801346:	77 e5                	ja     80132d <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  801348:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80134b:	83 f8 02             	cmp    $0x2,%eax
+  80134e:	0f 97 c1             	seta   %cl
+  801351:	0f b6 c9             	movzbl %cl,%ecx
+  801354:	eb d7                	jmp    80132d <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  801356:	b8 05 00 00 00       	mov    $0x5,%eax
+  80135b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80135e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801361:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801364:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801367:	8b 75 18             	mov    0x18(%ebp),%esi
+  80136a:	cd 30                	int    $0x30
+  80136c:	eb 90                	jmp    8012fe <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80136e:	83 ec 0c             	sub    $0xc,%esp
+  801371:	50                   	push   %eax
+  801372:	6a 05                	push   $0x5
+  801374:	68 39 33 80 00       	push   $0x803339
+  801379:	6a 4a                	push   $0x4a
+  80137b:	68 56 33 80 00       	push   $0x803356
+  801380:	e8 3f ef ff ff       	call   8002c4 <_panic>
+
+00801385 <sys_page_unmap>:
+{
+  801385:	55                   	push   %ebp
+  801386:	89 e5                	mov    %esp,%ebp
+  801388:	57                   	push   %edi
+  801389:	56                   	push   %esi
+  80138a:	53                   	push   %ebx
+  80138b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80138e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801395:	78 37                	js     8013ce <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  801397:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80139e:	74 7a                	je     80141a <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  8013a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013ab:	b8 06 00 00 00       	mov    $0x6,%eax
+  8013b0:	89 df                	mov    %ebx,%edi
+  8013b2:	89 de                	mov    %ebx,%esi
+  8013b4:	55                   	push   %ebp
+  8013b5:	68 be 13 80 00       	push   $0x8013be
+  8013ba:	89 e5                	mov    %esp,%ebp
+  8013bc:	0f 34                	sysenter
+  8013be:	83 c4 04             	add    $0x4,%esp
+  8013c1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8013c2:	85 c0                	test   %eax,%eax
+  8013c4:	7f 6c                	jg     801432 <sys_page_unmap+0xad>
+}
+  8013c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013c9:	5b                   	pop    %ebx
+  8013ca:	5e                   	pop    %esi
+  8013cb:	5f                   	pop    %edi
+  8013cc:	5d                   	pop    %ebp
+  8013cd:	c3                   	ret
+  8013ce:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013d3:	0f a2                	cpuid
+		return 0;
+  8013d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8013da:	f6 c6 08             	test   $0x8,%dh
+  8013dd:	74 15                	je     8013f4 <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013df:	89 c2                	mov    %eax,%edx
+  8013e1:	c1 ea 08             	shr    $0x8,%edx
+  8013e4:	83 e2 0f             	and    $0xf,%edx
+  8013e7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8013ec:	83 fa 06             	cmp    $0x6,%edx
+  8013ef:	74 0e                	je     8013ff <sys_page_unmap+0x7a>
+  8013f1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8013f4:	0f b6 c9             	movzbl %cl,%ecx
+  8013f7:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8013fd:	eb 98                	jmp    801397 <sys_page_unmap+0x12>
+  8013ff:	89 c2                	mov    %eax,%edx
+  801401:	c1 ea 04             	shr    $0x4,%edx
+  801404:	83 e2 0f             	and    $0xf,%edx
+  801407:	83 fa 02             	cmp    $0x2,%edx
+  80140a:	77 e5                	ja     8013f1 <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  80140c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80140f:	83 f8 02             	cmp    $0x2,%eax
+  801412:	0f 97 c1             	seta   %cl
+  801415:	0f b6 c9             	movzbl %cl,%ecx
+  801418:	eb d7                	jmp    8013f1 <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  80141a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80141f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801424:	8b 55 08             	mov    0x8(%ebp),%edx
+  801427:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80142a:	89 df                	mov    %ebx,%edi
+  80142c:	89 de                	mov    %ebx,%esi
+  80142e:	cd 30                	int    $0x30
+  801430:	eb 90                	jmp    8013c2 <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801432:	83 ec 0c             	sub    $0xc,%esp
+  801435:	50                   	push   %eax
+  801436:	6a 06                	push   $0x6
+  801438:	68 39 33 80 00       	push   $0x803339
+  80143d:	6a 4a                	push   $0x4a
+  80143f:	68 56 33 80 00       	push   $0x803356
+  801444:	e8 7b ee ff ff       	call   8002c4 <_panic>
+
+00801449 <sys_page_copy>:
+{
+  801449:	55                   	push   %ebp
+  80144a:	89 e5                	mov    %esp,%ebp
+  80144c:	57                   	push   %edi
+  80144d:	56                   	push   %esi
+  80144e:	53                   	push   %ebx
+  80144f:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801452:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801459:	78 37                	js     801492 <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  80145b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801462:	74 7a                	je     8014de <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  801464:	8b 55 08             	mov    0x8(%ebp),%edx
+  801467:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80146a:	b8 29 00 00 00       	mov    $0x29,%eax
+  80146f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801472:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801475:	8b 75 18             	mov    0x18(%ebp),%esi
+  801478:	55                   	push   %ebp
+  801479:	68 82 14 80 00       	push   $0x801482
+  80147e:	89 e5                	mov    %esp,%ebp
+  801480:	0f 34                	sysenter
+  801482:	83 c4 04             	add    $0x4,%esp
+  801485:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801486:	85 c0                	test   %eax,%eax
+  801488:	7f 6c                	jg     8014f6 <sys_page_copy+0xad>
+}
+  80148a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80148d:	5b                   	pop    %ebx
+  80148e:	5e                   	pop    %esi
+  80148f:	5f                   	pop    %edi
+  801490:	5d                   	pop    %ebp
+  801491:	c3                   	ret
+  801492:	b8 01 00 00 00       	mov    $0x1,%eax
+  801497:	0f a2                	cpuid
+		return 0;
+  801499:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80149e:	f6 c6 08             	test   $0x8,%dh
+  8014a1:	74 15                	je     8014b8 <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014a3:	89 c2                	mov    %eax,%edx
+  8014a5:	c1 ea 08             	shr    $0x8,%edx
+  8014a8:	83 e2 0f             	and    $0xf,%edx
+  8014ab:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8014b0:	83 fa 06             	cmp    $0x6,%edx
+  8014b3:	74 0e                	je     8014c3 <sys_page_copy+0x7a>
+  8014b5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8014b8:	0f b6 c9             	movzbl %cl,%ecx
+  8014bb:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8014c1:	eb 98                	jmp    80145b <sys_page_copy+0x12>
+  8014c3:	89 c2                	mov    %eax,%edx
+  8014c5:	c1 ea 04             	shr    $0x4,%edx
+  8014c8:	83 e2 0f             	and    $0xf,%edx
+  8014cb:	83 fa 02             	cmp    $0x2,%edx
+  8014ce:	77 e5                	ja     8014b5 <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  8014d0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014d3:	83 f8 02             	cmp    $0x2,%eax
+  8014d6:	0f 97 c1             	seta   %cl
+  8014d9:	0f b6 c9             	movzbl %cl,%ecx
+  8014dc:	eb d7                	jmp    8014b5 <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  8014de:	b8 29 00 00 00       	mov    $0x29,%eax
+  8014e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014e9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014ec:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014ef:	8b 75 18             	mov    0x18(%ebp),%esi
+  8014f2:	cd 30                	int    $0x30
+  8014f4:	eb 90                	jmp    801486 <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014f6:	83 ec 0c             	sub    $0xc,%esp
+  8014f9:	50                   	push   %eax
+  8014fa:	6a 29                	push   $0x29
+  8014fc:	68 39 33 80 00       	push   $0x803339
+  801501:	6a 4a                	push   $0x4a
+  801503:	68 56 33 80 00       	push   $0x803356
+  801508:	e8 b7 ed ff ff       	call   8002c4 <_panic>
+
+0080150d <sys_yield>:
+{
+  80150d:	55                   	push   %ebp
+  80150e:	89 e5                	mov    %esp,%ebp
+  801510:	57                   	push   %edi
+  801511:	56                   	push   %esi
+  801512:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801513:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80151a:	78 2e                	js     80154a <sys_yield+0x3d>
+	if (syscall_sysenter)
+  80151c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801523:	74 71                	je     801596 <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  801525:	ba 00 00 00 00       	mov    $0x0,%edx
+  80152a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80152f:	89 d1                	mov    %edx,%ecx
+  801531:	89 d3                	mov    %edx,%ebx
+  801533:	89 d7                	mov    %edx,%edi
+  801535:	89 d6                	mov    %edx,%esi
+  801537:	55                   	push   %ebp
+  801538:	68 41 15 80 00       	push   $0x801541
+  80153d:	89 e5                	mov    %esp,%ebp
+  80153f:	0f 34                	sysenter
+  801541:	83 c4 04             	add    $0x4,%esp
+  801544:	5d                   	pop    %ebp
+}
+  801545:	5b                   	pop    %ebx
+  801546:	5e                   	pop    %esi
+  801547:	5f                   	pop    %edi
+  801548:	5d                   	pop    %ebp
+  801549:	c3                   	ret
+  80154a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80154f:	0f a2                	cpuid
+		return 0;
+  801551:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801556:	f6 c6 08             	test   $0x8,%dh
+  801559:	74 15                	je     801570 <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80155b:	89 c2                	mov    %eax,%edx
+  80155d:	c1 ea 08             	shr    $0x8,%edx
+  801560:	83 e2 0f             	and    $0xf,%edx
+  801563:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801568:	83 fa 06             	cmp    $0x6,%edx
+  80156b:	74 0e                	je     80157b <sys_yield+0x6e>
+  80156d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801570:	0f b6 c9             	movzbl %cl,%ecx
+  801573:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801579:	eb a1                	jmp    80151c <sys_yield+0xf>
+  80157b:	89 c2                	mov    %eax,%edx
+  80157d:	c1 ea 04             	shr    $0x4,%edx
+  801580:	83 e2 0f             	and    $0xf,%edx
+  801583:	83 fa 02             	cmp    $0x2,%edx
+  801586:	77 e5                	ja     80156d <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  801588:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80158b:	83 f8 02             	cmp    $0x2,%eax
+  80158e:	0f 97 c1             	seta   %cl
+  801591:	0f b6 c9             	movzbl %cl,%ecx
+  801594:	eb d7                	jmp    80156d <sys_yield+0x60>
+		asm volatile("int %1\n"
+  801596:	ba 00 00 00 00       	mov    $0x0,%edx
+  80159b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8015a0:	89 d1                	mov    %edx,%ecx
+  8015a2:	89 d3                	mov    %edx,%ebx
+  8015a4:	89 d7                	mov    %edx,%edi
+  8015a6:	89 d6                	mov    %edx,%esi
+  8015a8:	cd 30                	int    $0x30
+}
+  8015aa:	eb 99                	jmp    801545 <sys_yield+0x38>
+
+008015ac <sys_env_set_status>:
+{
+  8015ac:	55                   	push   %ebp
+  8015ad:	89 e5                	mov    %esp,%ebp
+  8015af:	57                   	push   %edi
+  8015b0:	56                   	push   %esi
+  8015b1:	53                   	push   %ebx
+  8015b2:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8015b5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8015bc:	78 37                	js     8015f5 <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  8015be:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8015c5:	74 7a                	je     801641 <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  8015c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015d2:	b8 08 00 00 00       	mov    $0x8,%eax
+  8015d7:	89 df                	mov    %ebx,%edi
+  8015d9:	89 de                	mov    %ebx,%esi
+  8015db:	55                   	push   %ebp
+  8015dc:	68 e5 15 80 00       	push   $0x8015e5
+  8015e1:	89 e5                	mov    %esp,%ebp
+  8015e3:	0f 34                	sysenter
+  8015e5:	83 c4 04             	add    $0x4,%esp
+  8015e8:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8015e9:	85 c0                	test   %eax,%eax
+  8015eb:	7f 6c                	jg     801659 <sys_env_set_status+0xad>
+}
+  8015ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015f0:	5b                   	pop    %ebx
+  8015f1:	5e                   	pop    %esi
+  8015f2:	5f                   	pop    %edi
+  8015f3:	5d                   	pop    %ebp
+  8015f4:	c3                   	ret
+  8015f5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015fa:	0f a2                	cpuid
+		return 0;
+  8015fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801601:	f6 c6 08             	test   $0x8,%dh
+  801604:	74 15                	je     80161b <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801606:	89 c2                	mov    %eax,%edx
+  801608:	c1 ea 08             	shr    $0x8,%edx
+  80160b:	83 e2 0f             	and    $0xf,%edx
+  80160e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801613:	83 fa 06             	cmp    $0x6,%edx
+  801616:	74 0e                	je     801626 <sys_env_set_status+0x7a>
+  801618:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80161b:	0f b6 c9             	movzbl %cl,%ecx
+  80161e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801624:	eb 98                	jmp    8015be <sys_env_set_status+0x12>
+  801626:	89 c2                	mov    %eax,%edx
+  801628:	c1 ea 04             	shr    $0x4,%edx
+  80162b:	83 e2 0f             	and    $0xf,%edx
+  80162e:	83 fa 02             	cmp    $0x2,%edx
+  801631:	77 e5                	ja     801618 <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  801633:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801636:	83 f8 02             	cmp    $0x2,%eax
+  801639:	0f 97 c1             	seta   %cl
+  80163c:	0f b6 c9             	movzbl %cl,%ecx
+  80163f:	eb d7                	jmp    801618 <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  801641:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801646:	b8 08 00 00 00       	mov    $0x8,%eax
+  80164b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80164e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801651:	89 df                	mov    %ebx,%edi
+  801653:	89 de                	mov    %ebx,%esi
+  801655:	cd 30                	int    $0x30
+  801657:	eb 90                	jmp    8015e9 <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801659:	83 ec 0c             	sub    $0xc,%esp
+  80165c:	50                   	push   %eax
+  80165d:	6a 08                	push   $0x8
+  80165f:	68 39 33 80 00       	push   $0x803339
+  801664:	6a 4a                	push   $0x4a
+  801666:	68 56 33 80 00       	push   $0x803356
+  80166b:	e8 54 ec ff ff       	call   8002c4 <_panic>
+
+00801670 <sys_sysinfo>:
+{
+  801670:	55                   	push   %ebp
+  801671:	89 e5                	mov    %esp,%ebp
+  801673:	57                   	push   %edi
+  801674:	56                   	push   %esi
+  801675:	53                   	push   %ebx
+  801676:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801679:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801680:	78 36                	js     8016b8 <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  801682:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801689:	74 79                	je     801704 <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  80168b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80168e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801693:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801698:	89 cb                	mov    %ecx,%ebx
+  80169a:	89 cf                	mov    %ecx,%edi
+  80169c:	89 ce                	mov    %ecx,%esi
+  80169e:	55                   	push   %ebp
+  80169f:	68 a8 16 80 00       	push   $0x8016a8
+  8016a4:	89 e5                	mov    %esp,%ebp
+  8016a6:	0f 34                	sysenter
+  8016a8:	83 c4 04             	add    $0x4,%esp
+  8016ab:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8016ac:	85 c0                	test   %eax,%eax
+  8016ae:	7f 6b                	jg     80171b <sys_sysinfo+0xab>
+}
+  8016b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016b3:	5b                   	pop    %ebx
+  8016b4:	5e                   	pop    %esi
+  8016b5:	5f                   	pop    %edi
+  8016b6:	5d                   	pop    %ebp
+  8016b7:	c3                   	ret
+  8016b8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016bd:	0f a2                	cpuid
+		return 0;
+  8016bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8016c4:	f6 c6 08             	test   $0x8,%dh
+  8016c7:	74 15                	je     8016de <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016c9:	89 c2                	mov    %eax,%edx
+  8016cb:	c1 ea 08             	shr    $0x8,%edx
+  8016ce:	83 e2 0f             	and    $0xf,%edx
+  8016d1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8016d6:	83 fa 06             	cmp    $0x6,%edx
+  8016d9:	74 0e                	je     8016e9 <sys_sysinfo+0x79>
+  8016db:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8016de:	0f b6 c9             	movzbl %cl,%ecx
+  8016e1:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8016e7:	eb 99                	jmp    801682 <sys_sysinfo+0x12>
+  8016e9:	89 c2                	mov    %eax,%edx
+  8016eb:	c1 ea 04             	shr    $0x4,%edx
+  8016ee:	83 e2 0f             	and    $0xf,%edx
+  8016f1:	83 fa 02             	cmp    $0x2,%edx
+  8016f4:	77 e5                	ja     8016db <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  8016f6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016f9:	83 f8 02             	cmp    $0x2,%eax
+  8016fc:	0f 97 c1             	seta   %cl
+  8016ff:	0f b6 c9             	movzbl %cl,%ecx
+  801702:	eb d7                	jmp    8016db <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  801704:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801709:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80170e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801711:	89 cb                	mov    %ecx,%ebx
+  801713:	89 cf                	mov    %ecx,%edi
+  801715:	89 ce                	mov    %ecx,%esi
+  801717:	cd 30                	int    $0x30
+  801719:	eb 91                	jmp    8016ac <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80171b:	83 ec 0c             	sub    $0xc,%esp
+  80171e:	50                   	push   %eax
+  80171f:	6a 0b                	push   $0xb
+  801721:	68 39 33 80 00       	push   $0x803339
+  801726:	6a 4a                	push   $0x4a
+  801728:	68 56 33 80 00       	push   $0x803356
+  80172d:	e8 92 eb ff ff       	call   8002c4 <_panic>
+
+00801732 <sys_env_set_trapframe>:
+{
+  801732:	55                   	push   %ebp
+  801733:	89 e5                	mov    %esp,%ebp
+  801735:	57                   	push   %edi
+  801736:	56                   	push   %esi
+  801737:	53                   	push   %ebx
+  801738:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80173b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801742:	78 37                	js     80177b <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  801744:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80174b:	74 7a                	je     8017c7 <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  80174d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801752:	8b 55 08             	mov    0x8(%ebp),%edx
+  801755:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801758:	b8 13 00 00 00       	mov    $0x13,%eax
+  80175d:	89 df                	mov    %ebx,%edi
+  80175f:	89 de                	mov    %ebx,%esi
+  801761:	55                   	push   %ebp
+  801762:	68 6b 17 80 00       	push   $0x80176b
+  801767:	89 e5                	mov    %esp,%ebp
+  801769:	0f 34                	sysenter
+  80176b:	83 c4 04             	add    $0x4,%esp
+  80176e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80176f:	85 c0                	test   %eax,%eax
+  801771:	7f 6c                	jg     8017df <sys_env_set_trapframe+0xad>
+}
+  801773:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801776:	5b                   	pop    %ebx
+  801777:	5e                   	pop    %esi
+  801778:	5f                   	pop    %edi
+  801779:	5d                   	pop    %ebp
+  80177a:	c3                   	ret
+  80177b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801780:	0f a2                	cpuid
+		return 0;
+  801782:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801787:	f6 c6 08             	test   $0x8,%dh
+  80178a:	74 15                	je     8017a1 <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80178c:	89 c2                	mov    %eax,%edx
+  80178e:	c1 ea 08             	shr    $0x8,%edx
+  801791:	83 e2 0f             	and    $0xf,%edx
+  801794:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801799:	83 fa 06             	cmp    $0x6,%edx
+  80179c:	74 0e                	je     8017ac <sys_env_set_trapframe+0x7a>
+  80179e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8017a1:	0f b6 c9             	movzbl %cl,%ecx
+  8017a4:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8017aa:	eb 98                	jmp    801744 <sys_env_set_trapframe+0x12>
+  8017ac:	89 c2                	mov    %eax,%edx
+  8017ae:	c1 ea 04             	shr    $0x4,%edx
+  8017b1:	83 e2 0f             	and    $0xf,%edx
+  8017b4:	83 fa 02             	cmp    $0x2,%edx
+  8017b7:	77 e5                	ja     80179e <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  8017b9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017bc:	83 f8 02             	cmp    $0x2,%eax
+  8017bf:	0f 97 c1             	seta   %cl
+  8017c2:	0f b6 c9             	movzbl %cl,%ecx
+  8017c5:	eb d7                	jmp    80179e <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  8017c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017cc:	b8 13 00 00 00       	mov    $0x13,%eax
+  8017d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017d7:	89 df                	mov    %ebx,%edi
+  8017d9:	89 de                	mov    %ebx,%esi
+  8017db:	cd 30                	int    $0x30
+  8017dd:	eb 90                	jmp    80176f <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017df:	83 ec 0c             	sub    $0xc,%esp
+  8017e2:	50                   	push   %eax
+  8017e3:	6a 13                	push   $0x13
+  8017e5:	68 39 33 80 00       	push   $0x803339
+  8017ea:	6a 4a                	push   $0x4a
+  8017ec:	68 56 33 80 00       	push   $0x803356
+  8017f1:	e8 ce ea ff ff       	call   8002c4 <_panic>
+
+008017f6 <sys_env_set_stack_limit>:
+{
+  8017f6:	55                   	push   %ebp
+  8017f7:	89 e5                	mov    %esp,%ebp
+  8017f9:	57                   	push   %edi
+  8017fa:	56                   	push   %esi
+  8017fb:	53                   	push   %ebx
+  8017fc:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8017ff:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801806:	78 37                	js     80183f <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  801808:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80180f:	74 7a                	je     80188b <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  801811:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801816:	8b 55 08             	mov    0x8(%ebp),%edx
+  801819:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80181c:	b8 19 00 00 00       	mov    $0x19,%eax
+  801821:	89 df                	mov    %ebx,%edi
+  801823:	89 de                	mov    %ebx,%esi
+  801825:	55                   	push   %ebp
+  801826:	68 2f 18 80 00       	push   $0x80182f
+  80182b:	89 e5                	mov    %esp,%ebp
+  80182d:	0f 34                	sysenter
+  80182f:	83 c4 04             	add    $0x4,%esp
+  801832:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801833:	85 c0                	test   %eax,%eax
+  801835:	7f 6c                	jg     8018a3 <sys_env_set_stack_limit+0xad>
+}
+  801837:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80183a:	5b                   	pop    %ebx
+  80183b:	5e                   	pop    %esi
+  80183c:	5f                   	pop    %edi
+  80183d:	5d                   	pop    %ebp
+  80183e:	c3                   	ret
+  80183f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801844:	0f a2                	cpuid
+		return 0;
+  801846:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80184b:	f6 c6 08             	test   $0x8,%dh
+  80184e:	74 15                	je     801865 <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801850:	89 c2                	mov    %eax,%edx
+  801852:	c1 ea 08             	shr    $0x8,%edx
+  801855:	83 e2 0f             	and    $0xf,%edx
+  801858:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80185d:	83 fa 06             	cmp    $0x6,%edx
+  801860:	74 0e                	je     801870 <sys_env_set_stack_limit+0x7a>
+  801862:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801865:	0f b6 c9             	movzbl %cl,%ecx
+  801868:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80186e:	eb 98                	jmp    801808 <sys_env_set_stack_limit+0x12>
+  801870:	89 c2                	mov    %eax,%edx
+  801872:	c1 ea 04             	shr    $0x4,%edx
+  801875:	83 e2 0f             	and    $0xf,%edx
+  801878:	83 fa 02             	cmp    $0x2,%edx
+  80187b:	77 e5                	ja     801862 <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  80187d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801880:	83 f8 02             	cmp    $0x2,%eax
+  801883:	0f 97 c1             	seta   %cl
+  801886:	0f b6 c9             	movzbl %cl,%ecx
+  801889:	eb d7                	jmp    801862 <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  80188b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801890:	b8 19 00 00 00       	mov    $0x19,%eax
+  801895:	8b 55 08             	mov    0x8(%ebp),%edx
+  801898:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80189b:	89 df                	mov    %ebx,%edi
+  80189d:	89 de                	mov    %ebx,%esi
+  80189f:	cd 30                	int    $0x30
+  8018a1:	eb 90                	jmp    801833 <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8018a3:	83 ec 0c             	sub    $0xc,%esp
+  8018a6:	50                   	push   %eax
+  8018a7:	6a 19                	push   $0x19
+  8018a9:	68 39 33 80 00       	push   $0x803339
+  8018ae:	6a 4a                	push   $0x4a
+  8018b0:	68 56 33 80 00       	push   $0x803356
+  8018b5:	e8 0a ea ff ff       	call   8002c4 <_panic>
+
+008018ba <sys_env_set_pgfault_upcall>:
+{
+  8018ba:	55                   	push   %ebp
+  8018bb:	89 e5                	mov    %esp,%ebp
+  8018bd:	57                   	push   %edi
+  8018be:	56                   	push   %esi
+  8018bf:	53                   	push   %ebx
+  8018c0:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8018c3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8018ca:	78 37                	js     801903 <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  8018cc:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8018d3:	74 7a                	je     80194f <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  8018d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018e0:	b8 09 00 00 00       	mov    $0x9,%eax
+  8018e5:	89 df                	mov    %ebx,%edi
+  8018e7:	89 de                	mov    %ebx,%esi
+  8018e9:	55                   	push   %ebp
+  8018ea:	68 f3 18 80 00       	push   $0x8018f3
+  8018ef:	89 e5                	mov    %esp,%ebp
+  8018f1:	0f 34                	sysenter
+  8018f3:	83 c4 04             	add    $0x4,%esp
+  8018f6:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8018f7:	85 c0                	test   %eax,%eax
+  8018f9:	7f 6c                	jg     801967 <sys_env_set_pgfault_upcall+0xad>
+}
+  8018fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018fe:	5b                   	pop    %ebx
+  8018ff:	5e                   	pop    %esi
+  801900:	5f                   	pop    %edi
+  801901:	5d                   	pop    %ebp
+  801902:	c3                   	ret
+  801903:	b8 01 00 00 00       	mov    $0x1,%eax
+  801908:	0f a2                	cpuid
+		return 0;
+  80190a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80190f:	f6 c6 08             	test   $0x8,%dh
+  801912:	74 15                	je     801929 <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801914:	89 c2                	mov    %eax,%edx
+  801916:	c1 ea 08             	shr    $0x8,%edx
+  801919:	83 e2 0f             	and    $0xf,%edx
+  80191c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801921:	83 fa 06             	cmp    $0x6,%edx
+  801924:	74 0e                	je     801934 <sys_env_set_pgfault_upcall+0x7a>
+  801926:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801929:	0f b6 c9             	movzbl %cl,%ecx
+  80192c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801932:	eb 98                	jmp    8018cc <sys_env_set_pgfault_upcall+0x12>
+  801934:	89 c2                	mov    %eax,%edx
+  801936:	c1 ea 04             	shr    $0x4,%edx
+  801939:	83 e2 0f             	and    $0xf,%edx
+  80193c:	83 fa 02             	cmp    $0x2,%edx
+  80193f:	77 e5                	ja     801926 <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  801941:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801944:	83 f8 02             	cmp    $0x2,%eax
+  801947:	0f 97 c1             	seta   %cl
+  80194a:	0f b6 c9             	movzbl %cl,%ecx
+  80194d:	eb d7                	jmp    801926 <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  80194f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801954:	b8 09 00 00 00       	mov    $0x9,%eax
+  801959:	8b 55 08             	mov    0x8(%ebp),%edx
+  80195c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80195f:	89 df                	mov    %ebx,%edi
+  801961:	89 de                	mov    %ebx,%esi
+  801963:	cd 30                	int    $0x30
+  801965:	eb 90                	jmp    8018f7 <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801967:	83 ec 0c             	sub    $0xc,%esp
+  80196a:	50                   	push   %eax
+  80196b:	6a 09                	push   $0x9
+  80196d:	68 39 33 80 00       	push   $0x803339
+  801972:	6a 4a                	push   $0x4a
+  801974:	68 56 33 80 00       	push   $0x803356
+  801979:	e8 46 e9 ff ff       	call   8002c4 <_panic>
+
+0080197e <sys_ipc_try_send>:
+{
+  80197e:	55                   	push   %ebp
+  80197f:	89 e5                	mov    %esp,%ebp
+  801981:	57                   	push   %edi
+  801982:	56                   	push   %esi
+  801983:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801984:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80198b:	78 32                	js     8019bf <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  80198d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801994:	74 75                	je     801a0b <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801996:	8b 55 08             	mov    0x8(%ebp),%edx
+  801999:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80199c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8019a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8019a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019a9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8019ac:	55                   	push   %ebp
+  8019ad:	68 b6 19 80 00       	push   $0x8019b6
+  8019b2:	89 e5                	mov    %esp,%ebp
+  8019b4:	0f 34                	sysenter
+  8019b6:	83 c4 04             	add    $0x4,%esp
+  8019b9:	5d                   	pop    %ebp
+}
+  8019ba:	5b                   	pop    %ebx
+  8019bb:	5e                   	pop    %esi
+  8019bc:	5f                   	pop    %edi
+  8019bd:	5d                   	pop    %ebp
+  8019be:	c3                   	ret
+  8019bf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019c4:	0f a2                	cpuid
+		return 0;
+  8019c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8019cb:	f6 c6 08             	test   $0x8,%dh
+  8019ce:	74 15                	je     8019e5 <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019d0:	89 c2                	mov    %eax,%edx
+  8019d2:	c1 ea 08             	shr    $0x8,%edx
+  8019d5:	83 e2 0f             	and    $0xf,%edx
+  8019d8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019dd:	83 fa 06             	cmp    $0x6,%edx
+  8019e0:	74 0e                	je     8019f0 <sys_ipc_try_send+0x72>
+  8019e2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8019e5:	0f b6 c9             	movzbl %cl,%ecx
+  8019e8:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8019ee:	eb 9d                	jmp    80198d <sys_ipc_try_send+0xf>
+  8019f0:	89 c2                	mov    %eax,%edx
+  8019f2:	c1 ea 04             	shr    $0x4,%edx
+  8019f5:	83 e2 0f             	and    $0xf,%edx
+  8019f8:	83 fa 02             	cmp    $0x2,%edx
+  8019fb:	77 e5                	ja     8019e2 <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  8019fd:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a00:	83 f8 02             	cmp    $0x2,%eax
+  801a03:	0f 97 c1             	seta   %cl
+  801a06:	0f b6 c9             	movzbl %cl,%ecx
+  801a09:	eb d7                	jmp    8019e2 <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  801a0b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801a10:	be 00 00 00 00       	mov    $0x0,%esi
+  801a15:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a18:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a1b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a1e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a21:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801a23:	eb 95                	jmp    8019ba <sys_ipc_try_send+0x3c>
+
+00801a25 <sys_ipc_send>:
+{
+  801a25:	55                   	push   %ebp
+  801a26:	89 e5                	mov    %esp,%ebp
+  801a28:	57                   	push   %edi
+  801a29:	56                   	push   %esi
+  801a2a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801a2b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a32:	78 32                	js     801a66 <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  801a34:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a3b:	74 75                	je     801ab2 <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801a3d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a40:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a43:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801a48:	be 00 00 00 00       	mov    $0x0,%esi
+  801a4d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a50:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a53:	55                   	push   %ebp
+  801a54:	68 5d 1a 80 00       	push   $0x801a5d
+  801a59:	89 e5                	mov    %esp,%ebp
+  801a5b:	0f 34                	sysenter
+  801a5d:	83 c4 04             	add    $0x4,%esp
+  801a60:	5d                   	pop    %ebp
+}
+  801a61:	5b                   	pop    %ebx
+  801a62:	5e                   	pop    %esi
+  801a63:	5f                   	pop    %edi
+  801a64:	5d                   	pop    %ebp
+  801a65:	c3                   	ret
+  801a66:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a6b:	0f a2                	cpuid
+		return 0;
+  801a6d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801a72:	f6 c6 08             	test   $0x8,%dh
+  801a75:	74 15                	je     801a8c <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a77:	89 c2                	mov    %eax,%edx
+  801a79:	c1 ea 08             	shr    $0x8,%edx
+  801a7c:	83 e2 0f             	and    $0xf,%edx
+  801a7f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a84:	83 fa 06             	cmp    $0x6,%edx
+  801a87:	74 0e                	je     801a97 <sys_ipc_send+0x72>
+  801a89:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a8c:	0f b6 c9             	movzbl %cl,%ecx
+  801a8f:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801a95:	eb 9d                	jmp    801a34 <sys_ipc_send+0xf>
+  801a97:	89 c2                	mov    %eax,%edx
+  801a99:	c1 ea 04             	shr    $0x4,%edx
+  801a9c:	83 e2 0f             	and    $0xf,%edx
+  801a9f:	83 fa 02             	cmp    $0x2,%edx
+  801aa2:	77 e5                	ja     801a89 <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  801aa4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801aa7:	83 f8 02             	cmp    $0x2,%eax
+  801aaa:	0f 97 c1             	seta   %cl
+  801aad:	0f b6 c9             	movzbl %cl,%ecx
+  801ab0:	eb d7                	jmp    801a89 <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  801ab2:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801ab7:	be 00 00 00 00       	mov    $0x0,%esi
+  801abc:	8b 55 08             	mov    0x8(%ebp),%edx
+  801abf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ac2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ac5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ac8:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801aca:	eb 95                	jmp    801a61 <sys_ipc_send+0x3c>
+
+00801acc <sys_ipc_recv>:
+{
+  801acc:	55                   	push   %ebp
+  801acd:	89 e5                	mov    %esp,%ebp
+  801acf:	57                   	push   %edi
+  801ad0:	56                   	push   %esi
+  801ad1:	53                   	push   %ebx
+  801ad2:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801ad5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801adc:	78 36                	js     801b14 <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  801ade:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ae5:	74 79                	je     801b60 <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  801ae7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801aef:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801af4:	89 cb                	mov    %ecx,%ebx
+  801af6:	89 cf                	mov    %ecx,%edi
+  801af8:	89 ce                	mov    %ecx,%esi
+  801afa:	55                   	push   %ebp
+  801afb:	68 04 1b 80 00       	push   $0x801b04
+  801b00:	89 e5                	mov    %esp,%ebp
+  801b02:	0f 34                	sysenter
+  801b04:	83 c4 04             	add    $0x4,%esp
+  801b07:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801b08:	85 c0                	test   %eax,%eax
+  801b0a:	7f 6b                	jg     801b77 <sys_ipc_recv+0xab>
+}
+  801b0c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b0f:	5b                   	pop    %ebx
+  801b10:	5e                   	pop    %esi
+  801b11:	5f                   	pop    %edi
+  801b12:	5d                   	pop    %ebp
+  801b13:	c3                   	ret
+  801b14:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b19:	0f a2                	cpuid
+		return 0;
+  801b1b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b20:	f6 c6 08             	test   $0x8,%dh
+  801b23:	74 15                	je     801b3a <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b25:	89 c2                	mov    %eax,%edx
+  801b27:	c1 ea 08             	shr    $0x8,%edx
+  801b2a:	83 e2 0f             	and    $0xf,%edx
+  801b2d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b32:	83 fa 06             	cmp    $0x6,%edx
+  801b35:	74 0e                	je     801b45 <sys_ipc_recv+0x79>
+  801b37:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b3a:	0f b6 c9             	movzbl %cl,%ecx
+  801b3d:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801b43:	eb 99                	jmp    801ade <sys_ipc_recv+0x12>
+  801b45:	89 c2                	mov    %eax,%edx
+  801b47:	c1 ea 04             	shr    $0x4,%edx
+  801b4a:	83 e2 0f             	and    $0xf,%edx
+  801b4d:	83 fa 02             	cmp    $0x2,%edx
+  801b50:	77 e5                	ja     801b37 <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  801b52:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b55:	83 f8 02             	cmp    $0x2,%eax
+  801b58:	0f 97 c1             	seta   %cl
+  801b5b:	0f b6 c9             	movzbl %cl,%ecx
+  801b5e:	eb d7                	jmp    801b37 <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  801b60:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b65:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801b6a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b6d:	89 cb                	mov    %ecx,%ebx
+  801b6f:	89 cf                	mov    %ecx,%edi
+  801b71:	89 ce                	mov    %ecx,%esi
+  801b73:	cd 30                	int    $0x30
+  801b75:	eb 91                	jmp    801b08 <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801b77:	83 ec 0c             	sub    $0xc,%esp
+  801b7a:	50                   	push   %eax
+  801b7b:	6a 0d                	push   $0xd
+  801b7d:	68 39 33 80 00       	push   $0x803339
+  801b82:	6a 4a                	push   $0x4a
+  801b84:	68 56 33 80 00       	push   $0x803356
+  801b89:	e8 36 e7 ff ff       	call   8002c4 <_panic>
+
+00801b8e <sys_ipc_send_range>:
+{
+  801b8e:	55                   	push   %ebp
+  801b8f:	89 e5                	mov    %esp,%ebp
+  801b91:	57                   	push   %edi
+  801b92:	56                   	push   %esi
+  801b93:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801b94:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b9b:	78 30                	js     801bcd <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  801b9d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ba4:	74 73                	je     801c19 <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801ba6:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ba9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bac:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801bb1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801bb4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801bb7:	8b 75 18             	mov    0x18(%ebp),%esi
+  801bba:	55                   	push   %ebp
+  801bbb:	68 c4 1b 80 00       	push   $0x801bc4
+  801bc0:	89 e5                	mov    %esp,%ebp
+  801bc2:	0f 34                	sysenter
+  801bc4:	83 c4 04             	add    $0x4,%esp
+  801bc7:	5d                   	pop    %ebp
+}
+  801bc8:	5b                   	pop    %ebx
+  801bc9:	5e                   	pop    %esi
+  801bca:	5f                   	pop    %edi
+  801bcb:	5d                   	pop    %ebp
+  801bcc:	c3                   	ret
+  801bcd:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bd2:	0f a2                	cpuid
+		return 0;
+  801bd4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801bd9:	f6 c6 08             	test   $0x8,%dh
+  801bdc:	74 15                	je     801bf3 <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bde:	89 c2                	mov    %eax,%edx
+  801be0:	c1 ea 08             	shr    $0x8,%edx
+  801be3:	83 e2 0f             	and    $0xf,%edx
+  801be6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801beb:	83 fa 06             	cmp    $0x6,%edx
+  801bee:	74 0e                	je     801bfe <sys_ipc_send_range+0x70>
+  801bf0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801bf3:	0f b6 c9             	movzbl %cl,%ecx
+  801bf6:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801bfc:	eb 9f                	jmp    801b9d <sys_ipc_send_range+0xf>
+  801bfe:	89 c2                	mov    %eax,%edx
+  801c00:	c1 ea 04             	shr    $0x4,%edx
+  801c03:	83 e2 0f             	and    $0xf,%edx
+  801c06:	83 fa 02             	cmp    $0x2,%edx
+  801c09:	77 e5                	ja     801bf0 <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  801c0b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c0e:	83 f8 02             	cmp    $0x2,%eax
+  801c11:	0f 97 c1             	seta   %cl
+  801c14:	0f b6 c9             	movzbl %cl,%ecx
+  801c17:	eb d7                	jmp    801bf0 <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  801c19:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801c1e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c21:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c24:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801c27:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801c2a:	8b 75 18             	mov    0x18(%ebp),%esi
+  801c2d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  801c2f:	eb 97                	jmp    801bc8 <sys_ipc_send_range+0x3a>
+
+00801c31 <sys_ipc_recv_range>:
+{
+  801c31:	55                   	push   %ebp
+  801c32:	89 e5                	mov    %esp,%ebp
+  801c34:	57                   	push   %edi
+  801c35:	56                   	push   %esi
+  801c36:	53                   	push   %ebx
+  801c37:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801c3a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801c41:	78 37                	js     801c7a <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  801c43:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801c4a:	74 7a                	je     801cc6 <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  801c4c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c51:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c54:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c57:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801c5c:	89 df                	mov    %ebx,%edi
+  801c5e:	89 de                	mov    %ebx,%esi
+  801c60:	55                   	push   %ebp
+  801c61:	68 6a 1c 80 00       	push   $0x801c6a
+  801c66:	89 e5                	mov    %esp,%ebp
+  801c68:	0f 34                	sysenter
+  801c6a:	83 c4 04             	add    $0x4,%esp
+  801c6d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801c6e:	85 c0                	test   %eax,%eax
+  801c70:	7f 6c                	jg     801cde <sys_ipc_recv_range+0xad>
+}
+  801c72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c75:	5b                   	pop    %ebx
+  801c76:	5e                   	pop    %esi
+  801c77:	5f                   	pop    %edi
+  801c78:	5d                   	pop    %ebp
+  801c79:	c3                   	ret
+  801c7a:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c7f:	0f a2                	cpuid
+		return 0;
+  801c81:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801c86:	f6 c6 08             	test   $0x8,%dh
+  801c89:	74 15                	je     801ca0 <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c8b:	89 c2                	mov    %eax,%edx
+  801c8d:	c1 ea 08             	shr    $0x8,%edx
+  801c90:	83 e2 0f             	and    $0xf,%edx
+  801c93:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801c98:	83 fa 06             	cmp    $0x6,%edx
+  801c9b:	74 0e                	je     801cab <sys_ipc_recv_range+0x7a>
+  801c9d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801ca0:	0f b6 c9             	movzbl %cl,%ecx
+  801ca3:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801ca9:	eb 98                	jmp    801c43 <sys_ipc_recv_range+0x12>
+  801cab:	89 c2                	mov    %eax,%edx
+  801cad:	c1 ea 04             	shr    $0x4,%edx
+  801cb0:	83 e2 0f             	and    $0xf,%edx
+  801cb3:	83 fa 02             	cmp    $0x2,%edx
+  801cb6:	77 e5                	ja     801c9d <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801cb8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801cbb:	83 f8 02             	cmp    $0x2,%eax
+  801cbe:	0f 97 c1             	seta   %cl
+  801cc1:	0f b6 c9             	movzbl %cl,%ecx
+  801cc4:	eb d7                	jmp    801c9d <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801cc6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ccb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801cd0:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cd3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cd6:	89 df                	mov    %ebx,%edi
+  801cd8:	89 de                	mov    %ebx,%esi
+  801cda:	cd 30                	int    $0x30
+  801cdc:	eb 90                	jmp    801c6e <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801cde:	83 ec 0c             	sub    $0xc,%esp
+  801ce1:	50                   	push   %eax
+  801ce2:	6a 1f                	push   $0x1f
+  801ce4:	68 39 33 80 00       	push   $0x803339
+  801ce9:	6a 4a                	push   $0x4a
+  801ceb:	68 56 33 80 00       	push   $0x803356
+  801cf0:	e8 cf e5 ff ff       	call   8002c4 <_panic>
+
+00801cf5 <sys_ipc_call>:
+{
+  801cf5:	55                   	push   %ebp
+  801cf6:	89 e5                	mov    %esp,%ebp
+  801cf8:	57                   	push   %edi
+  801cf9:	56                   	push   %esi
+  801cfa:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801cfb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cfe:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801d03:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801d06:	55                   	push   %ebp
+  801d07:	56                   	push   %esi
+  801d08:	8b 0e                	mov    (%esi),%ecx
+  801d0a:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801d0d:	8b 7e 08             	mov    0x8(%esi),%edi
+  801d10:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801d13:	8b 76 0c             	mov    0xc(%esi),%esi
+  801d16:	cd 30                	int    $0x30
+  801d18:	87 34 24             	xchg   %esi,(%esp)
+  801d1b:	89 0e                	mov    %ecx,(%esi)
+  801d1d:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801d20:	89 7e 08             	mov    %edi,0x8(%esi)
+  801d23:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801d26:	8f 46 0c             	pop    0xc(%esi)
+  801d29:	5d                   	pop    %ebp
+}
+  801d2a:	5b                   	pop    %ebx
+  801d2b:	5e                   	pop    %esi
+  801d2c:	5f                   	pop    %edi
+  801d2d:	5d                   	pop    %ebp
+  801d2e:	c3                   	ret
+
+00801d2f <sys_ipc_reply_wait>:
+{
+  801d2f:	55                   	push   %ebp
+  801d30:	89 e5                	mov    %esp,%ebp
+  801d32:	57                   	push   %edi
+  801d33:	56                   	push   %esi
+  801d34:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801d35:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d38:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801d3d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801d40:	55                   	push   %ebp
+  801d41:	56                   	push   %esi
+  801d42:	8b 0e                	mov    (%esi),%ecx
+  801d44:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801d47:	8b 7e 08             	mov    0x8(%esi),%edi
+  801d4a:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801d4d:	8b 76 0c             	mov    0xc(%esi),%esi
+  801d50:	cd 30                	int    $0x30
+  801d52:	87 34 24             	xchg   %esi,(%esp)
+  801d55:	89 0e                	mov    %ecx,(%esi)
+  801d57:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801d5a:	89 7e 08             	mov    %edi,0x8(%esi)
+  801d5d:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801d60:	8f 46 0c             	pop    0xc(%esi)
+  801d63:	5d                   	pop    %ebp
+}
+  801d64:	5b                   	pop    %ebx
+  801d65:	5e                   	pop    %esi
+  801d66:	5f                   	pop    %edi
+  801d67:	5d                   	pop    %ebp
+  801d68:	c3                   	ret
+
+00801d69 <sys_ipc_send_msg>:
+{
+  801d69:	55                   	push   %ebp
+  801d6a:	89 e5                	mov    %esp,%ebp
+  801d6c:	57                   	push   %edi
+  801d6d:	56                   	push   %esi
+  801d6e:	53                   	push   %ebx
+  801d6f:	83 ec 20             	sub    $0x20,%esp
+  801d72:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801d75:	8b 10                	mov    (%eax),%edx
+  801d77:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801d7a:	8b 50 04             	mov    0x4(%eax),%edx
+  801d7d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801d80:	8b 50 08             	mov    0x8(%eax),%edx
+  801d83:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801d86:	8b 50 0c             	mov    0xc(%eax),%edx
+  801d89:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801d8c:	8b 40 10             	mov    0x10(%eax),%eax
+  801d8f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801d92:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801d95:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d98:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801d9d:	55                   	push   %ebp
+  801d9e:	56                   	push   %esi
+  801d9f:	8b 0e                	mov    (%esi),%ecx
+  801da1:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801da4:	8b 7e 08             	mov    0x8(%esi),%edi
+  801da7:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801daa:	8b 76 0c             	mov    0xc(%esi),%esi
+  801dad:	cd 30                	int    $0x30
+  801daf:	87 34 24             	xchg   %esi,(%esp)
+  801db2:	89 0e                	mov    %ecx,(%esi)
+  801db4:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801db7:	89 7e 08             	mov    %edi,0x8(%esi)
+  801dba:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801dbd:	8f 46 0c             	pop    0xc(%esi)
+  801dc0:	5d                   	pop    %ebp
+}
+  801dc1:	83 c4 20             	add    $0x20,%esp
+  801dc4:	5b                   	pop    %ebx
+  801dc5:	5e                   	pop    %esi
+  801dc6:	5f                   	pop    %edi
+  801dc7:	5d                   	pop    %ebp
+  801dc8:	c3                   	ret
+
+00801dc9 <sys_fork>:
+{
+  801dc9:	55                   	push   %ebp
+  801dca:	89 e5                	mov    %esp,%ebp
+  801dcc:	57                   	push   %edi
+  801dcd:	56                   	push   %esi
+  801dce:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801dcf:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801dd6:	78 2e                	js     801e06 <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801dd8:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ddf:	74 71                	je     801e52 <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801de1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801de6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801deb:	89 d1                	mov    %edx,%ecx
+  801ded:	89 d3                	mov    %edx,%ebx
+  801def:	89 d7                	mov    %edx,%edi
+  801df1:	89 d6                	mov    %edx,%esi
+  801df3:	55                   	push   %ebp
+  801df4:	68 fd 1d 80 00       	push   $0x801dfd
+  801df9:	89 e5                	mov    %esp,%ebp
+  801dfb:	0f 34                	sysenter
+  801dfd:	83 c4 04             	add    $0x4,%esp
+  801e00:	5d                   	pop    %ebp
+}
+  801e01:	5b                   	pop    %ebx
+  801e02:	5e                   	pop    %esi
+  801e03:	5f                   	pop    %edi
+  801e04:	5d                   	pop    %ebp
+  801e05:	c3                   	ret
+  801e06:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e0b:	0f a2                	cpuid
+		return 0;
+  801e0d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801e12:	f6 c6 08             	test   $0x8,%dh
+  801e15:	74 15                	je     801e2c <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e17:	89 c2                	mov    %eax,%edx
+  801e19:	c1 ea 08             	shr    $0x8,%edx
+  801e1c:	83 e2 0f             	and    $0xf,%edx
+  801e1f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e24:	83 fa 06             	cmp    $0x6,%edx
+  801e27:	74 0e                	je     801e37 <sys_fork+0x6e>
+  801e29:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801e2c:	0f b6 c9             	movzbl %cl,%ecx
+  801e2f:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801e35:	eb a1                	jmp    801dd8 <sys_fork+0xf>
+  801e37:	89 c2                	mov    %eax,%edx
+  801e39:	c1 ea 04             	shr    $0x4,%edx
+  801e3c:	83 e2 0f             	and    $0xf,%edx
+  801e3f:	83 fa 02             	cmp    $0x2,%edx
+  801e42:	77 e5                	ja     801e29 <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801e44:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e47:	83 f8 02             	cmp    $0x2,%eax
+  801e4a:	0f 97 c1             	seta   %cl
+  801e4d:	0f b6 c9             	movzbl %cl,%ecx
+  801e50:	eb d7                	jmp    801e29 <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801e52:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e57:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801e5c:	89 d1                	mov    %edx,%ecx
+  801e5e:	89 d3                	mov    %edx,%ebx
+  801e60:	89 d7                	mov    %edx,%edi
+  801e62:	89 d6                	mov    %edx,%esi
+  801e64:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801e66:	eb 99                	jmp    801e01 <sys_fork+0x38>
+
+00801e68 <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801e68:	55                   	push   %ebp
+  801e69:	89 e5                	mov    %esp,%ebp
+  801e6b:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801e6e:	ff 75 14             	push   0x14(%ebp)
+  801e71:	ff 75 10             	push   0x10(%ebp)
+  801e74:	ff 75 0c             	push   0xc(%ebp)
+  801e77:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e7f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801e84:	e8 81 ee ff ff       	call   800d0a <page_vec_call>
+}
+  801e89:	c9                   	leave
+  801e8a:	c3                   	ret
+
+00801e8b <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801e8b:	55                   	push   %ebp
+  801e8c:	89 e5                	mov    %esp,%ebp
+  801e8e:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801e91:	ff 75 18             	push   0x18(%ebp)
+  801e94:	ff 75 14             	push   0x14(%ebp)
+  801e97:	ff 75 10             	push   0x10(%ebp)
+  801e9a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ea0:	b8 10 00 00 00       	mov    $0x10,%eax
+  801ea5:	e8 60 ee ff ff       	call   800d0a <page_vec_call>
+}
+  801eaa:	c9                   	leave
+  801eab:	c3                   	ret
+
+00801eac <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801eac:	55                   	push   %ebp
+  801ead:	89 e5                	mov    %esp,%ebp
+  801eaf:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801eb2:	ff 75 14             	push   0x14(%ebp)
+  801eb5:	ff 75 10             	push   0x10(%ebp)
+  801eb8:	ff 75 0c             	push   0xc(%ebp)
+  801ebb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ec0:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ec3:	b8 11 00 00 00       	mov    $0x11,%eax
+  801ec8:	e8 3d ee ff ff       	call   800d0a <page_vec_call>
+}
+  801ecd:	c9                   	leave
+  801ece:	c3                   	ret
+
+00801ecf <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801ecf:	55                   	push   %ebp
+  801ed0:	89 e5                	mov    %esp,%ebp
+  801ed2:	57                   	push   %edi
+  801ed3:	56                   	push   %esi
+  801ed4:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801ed5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801edc:	78 32                	js     801f10 <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801ede:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ee5:	74 75                	je     801f5c <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801ee7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801eea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801eed:	b8 12 00 00 00       	mov    $0x12,%eax
+  801ef2:	be 00 00 00 00       	mov    $0x0,%esi
+  801ef7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801efa:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801efd:	55                   	push   %ebp
+  801efe:	68 07 1f 80 00       	push   $0x801f07
+  801f03:	89 e5                	mov    %esp,%ebp
+  801f05:	0f 34                	sysenter
+  801f07:	83 c4 04             	add    $0x4,%esp
+  801f0a:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801f0b:	5b                   	pop    %ebx
+  801f0c:	5e                   	pop    %esi
+  801f0d:	5f                   	pop    %edi
+  801f0e:	5d                   	pop    %ebp
+  801f0f:	c3                   	ret
+  801f10:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f15:	0f a2                	cpuid
+		return 0;
+  801f17:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801f1c:	f6 c6 08             	test   $0x8,%dh
+  801f1f:	74 15                	je     801f36 <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f21:	89 c2                	mov    %eax,%edx
+  801f23:	c1 ea 08             	shr    $0x8,%edx
+  801f26:	83 e2 0f             	and    $0xf,%edx
+  801f29:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f2e:	83 fa 06             	cmp    $0x6,%edx
+  801f31:	74 0e                	je     801f41 <sys_vm_ranges+0x72>
+  801f33:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801f36:	0f b6 c9             	movzbl %cl,%ecx
+  801f39:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801f3f:	eb 9d                	jmp    801ede <sys_vm_ranges+0xf>
+  801f41:	89 c2                	mov    %eax,%edx
+  801f43:	c1 ea 04             	shr    $0x4,%edx
+  801f46:	83 e2 0f             	and    $0xf,%edx
+  801f49:	83 fa 02             	cmp    $0x2,%edx
+  801f4c:	77 e5                	ja     801f33 <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  801f4e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f51:	83 f8 02             	cmp    $0x2,%eax
+  801f54:	0f 97 c1             	seta   %cl
+  801f57:	0f b6 c9             	movzbl %cl,%ecx
+  801f5a:	eb d7                	jmp    801f33 <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801f5c:	b8 12 00 00 00       	mov    $0x12,%eax
+  801f61:	be 00 00 00 00       	mov    $0x0,%esi
+  801f66:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f69:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f6c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f6f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801f72:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801f74:	eb 95                	jmp    801f0b <sys_vm_ranges+0x3c>
+
+00801f76 <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801f76:	55                   	push   %ebp
+  801f77:	89 e5                	mov    %esp,%ebp
+  801f79:	57                   	push   %edi
+  801f7a:	56                   	push   %esi
+  801f7b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801f7c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f83:	78 31                	js     801fb6 <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801f85:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f8c:	74 74                	je     802002 <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801f8e:	be 00 00 00 00       	mov    $0x0,%esi
+  801f93:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f96:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f99:	b8 14 00 00 00       	mov    $0x14,%eax
+  801f9e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801fa1:	89 f7                	mov    %esi,%edi
+  801fa3:	55                   	push   %ebp
+  801fa4:	68 ad 1f 80 00       	push   $0x801fad
+  801fa9:	89 e5                	mov    %esp,%ebp
+  801fab:	0f 34                	sysenter
+  801fad:	83 c4 04             	add    $0x4,%esp
+  801fb0:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801fb1:	5b                   	pop    %ebx
+  801fb2:	5e                   	pop    %esi
+  801fb3:	5f                   	pop    %edi
+  801fb4:	5d                   	pop    %ebp
+  801fb5:	c3                   	ret
+  801fb6:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fbb:	0f a2                	cpuid
+		return 0;
+  801fbd:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801fc2:	f6 c6 08             	test   $0x8,%dh
+  801fc5:	74 15                	je     801fdc <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fc7:	89 c2                	mov    %eax,%edx
+  801fc9:	c1 ea 08             	shr    $0x8,%edx
+  801fcc:	83 e2 0f             	and    $0xf,%edx
+  801fcf:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801fd4:	83 fa 06             	cmp    $0x6,%edx
+  801fd7:	74 0e                	je     801fe7 <sys_spawn+0x71>
+  801fd9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801fdc:	0f b6 c9             	movzbl %cl,%ecx
+  801fdf:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801fe5:	eb 9e                	jmp    801f85 <sys_spawn+0xf>
+  801fe7:	89 c2                	mov    %eax,%edx
+  801fe9:	c1 ea 04             	shr    $0x4,%edx
+  801fec:	83 e2 0f             	and    $0xf,%edx
+  801fef:	83 fa 02             	cmp    $0x2,%edx
+  801ff2:	77 e5                	ja     801fd9 <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  801ff4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ff7:	83 f8 02             	cmp    $0x2,%eax
+  801ffa:	0f 97 c1             	seta   %cl
+  801ffd:	0f b6 c9             	movzbl %cl,%ecx
+  802000:	eb d7                	jmp    801fd9 <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  802002:	be 00 00 00 00       	mov    $0x0,%esi
+  802007:	b8 14 00 00 00       	mov    $0x14,%eax
+  80200c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80200f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802012:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802015:	89 f7                	mov    %esi,%edi
+  802017:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  802019:	eb 96                	jmp    801fb1 <sys_spawn+0x3b>
+
+0080201b <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  80201b:	55                   	push   %ebp
+  80201c:	89 e5                	mov    %esp,%ebp
+  80201e:	57                   	push   %edi
+  80201f:	56                   	push   %esi
+  802020:	53                   	push   %ebx
+  802021:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802024:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80202b:	78 37                	js     802064 <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  80202d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802034:	74 7a                	je     8020b0 <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  802036:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80203b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80203e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802041:	b8 15 00 00 00       	mov    $0x15,%eax
+  802046:	89 df                	mov    %ebx,%edi
+  802048:	89 de                	mov    %ebx,%esi
+  80204a:	55                   	push   %ebp
+  80204b:	68 54 20 80 00       	push   $0x802054
+  802050:	89 e5                	mov    %esp,%ebp
+  802052:	0f 34                	sysenter
+  802054:	83 c4 04             	add    $0x4,%esp
+  802057:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802058:	85 c0                	test   %eax,%eax
+  80205a:	7f 6c                	jg     8020c8 <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  80205c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80205f:	5b                   	pop    %ebx
+  802060:	5e                   	pop    %esi
+  802061:	5f                   	pop    %edi
+  802062:	5d                   	pop    %ebp
+  802063:	c3                   	ret
+  802064:	b8 01 00 00 00       	mov    $0x1,%eax
+  802069:	0f a2                	cpuid
+		return 0;
+  80206b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802070:	f6 c6 08             	test   $0x8,%dh
+  802073:	74 15                	je     80208a <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802075:	89 c2                	mov    %eax,%edx
+  802077:	c1 ea 08             	shr    $0x8,%edx
+  80207a:	83 e2 0f             	and    $0xf,%edx
+  80207d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802082:	83 fa 06             	cmp    $0x6,%edx
+  802085:	74 0e                	je     802095 <sys_shm_create+0x7a>
+  802087:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80208a:	0f b6 c9             	movzbl %cl,%ecx
+  80208d:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802093:	eb 98                	jmp    80202d <sys_shm_create+0x12>
+  802095:	89 c2                	mov    %eax,%edx
+  802097:	c1 ea 04             	shr    $0x4,%edx
+  80209a:	83 e2 0f             	and    $0xf,%edx
+  80209d:	83 fa 02             	cmp    $0x2,%edx
+  8020a0:	77 e5                	ja     802087 <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  8020a2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020a5:	83 f8 02             	cmp    $0x2,%eax
+  8020a8:	0f 97 c1             	seta   %cl
+  8020ab:	0f b6 c9             	movzbl %cl,%ecx
+  8020ae:	eb d7                	jmp    802087 <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  8020b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020b5:	b8 15 00 00 00       	mov    $0x15,%eax
+  8020ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020c0:	89 df                	mov    %ebx,%edi
+  8020c2:	89 de                	mov    %ebx,%esi
+  8020c4:	cd 30                	int    $0x30
+  8020c6:	eb 90                	jmp    802058 <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8020c8:	83 ec 0c             	sub    $0xc,%esp
+  8020cb:	50                   	push   %eax
+  8020cc:	6a 15                	push   $0x15
+  8020ce:	68 39 33 80 00       	push   $0x803339
+  8020d3:	6a 4a                	push   $0x4a
+  8020d5:	68 56 33 80 00       	push   $0x803356
+  8020da:	e8 e5 e1 ff ff       	call   8002c4 <_panic>
+
+008020df <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  8020df:	55                   	push   %ebp
+  8020e0:	89 e5                	mov    %esp,%ebp
+  8020e2:	57                   	push   %edi
+  8020e3:	56                   	push   %esi
+  8020e4:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8020e5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8020ec:	78 32                	js     802120 <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  8020ee:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8020f5:	74 75                	je     80216c <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  8020f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020fd:	b8 16 00 00 00       	mov    $0x16,%eax
+  802102:	be 00 00 00 00       	mov    $0x0,%esi
+  802107:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80210a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80210d:	55                   	push   %ebp
+  80210e:	68 17 21 80 00       	push   $0x802117
+  802113:	89 e5                	mov    %esp,%ebp
+  802115:	0f 34                	sysenter
+  802117:	83 c4 04             	add    $0x4,%esp
+  80211a:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  80211b:	5b                   	pop    %ebx
+  80211c:	5e                   	pop    %esi
+  80211d:	5f                   	pop    %edi
+  80211e:	5d                   	pop    %ebp
+  80211f:	c3                   	ret
+  802120:	b8 01 00 00 00       	mov    $0x1,%eax
+  802125:	0f a2                	cpuid
+		return 0;
+  802127:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80212c:	f6 c6 08             	test   $0x8,%dh
+  80212f:	74 15                	je     802146 <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802131:	89 c2                	mov    %eax,%edx
+  802133:	c1 ea 08             	shr    $0x8,%edx
+  802136:	83 e2 0f             	and    $0xf,%edx
+  802139:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80213e:	83 fa 06             	cmp    $0x6,%edx
+  802141:	74 0e                	je     802151 <sys_shm_attach+0x72>
+  802143:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802146:	0f b6 c9             	movzbl %cl,%ecx
+  802149:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80214f:	eb 9d                	jmp    8020ee <sys_shm_attach+0xf>
+  802151:	89 c2                	mov    %eax,%edx
+  802153:	c1 ea 04             	shr    $0x4,%edx
+  802156:	83 e2 0f             	and    $0xf,%edx
+  802159:	83 fa 02             	cmp    $0x2,%edx
+  80215c:	77 e5                	ja     802143 <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  80215e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802161:	83 f8 02             	cmp    $0x2,%eax
+  802164:	0f 97 c1             	seta   %cl
+  802167:	0f b6 c9             	movzbl %cl,%ecx
+  80216a:	eb d7                	jmp    802143 <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  80216c:	b8 16 00 00 00       	mov    $0x16,%eax
+  802171:	be 00 00 00 00       	mov    $0x0,%esi
+  802176:	8b 55 08             	mov    0x8(%ebp),%edx
+  802179:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80217c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80217f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802182:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  802184:	eb 95                	jmp    80211b <sys_shm_attach+0x3c>
+
+00802186 <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  802186:	55                   	push   %ebp
+  802187:	89 e5                	mov    %esp,%ebp
+  802189:	57                   	push   %edi
+  80218a:	56                   	push   %esi
+  80218b:	53                   	push   %ebx
+  80218c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80218f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802196:	78 38                	js     8021d0 <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  802198:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80219f:	74 7b                	je     80221c <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  8021a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8021a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021ac:	b8 17 00 00 00       	mov    $0x17,%eax
+  8021b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8021b4:	89 f7                	mov    %esi,%edi
+  8021b6:	55                   	push   %ebp
+  8021b7:	68 c0 21 80 00       	push   $0x8021c0
+  8021bc:	89 e5                	mov    %esp,%ebp
+  8021be:	0f 34                	sysenter
+  8021c0:	83 c4 04             	add    $0x4,%esp
+  8021c3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8021c4:	85 c0                	test   %eax,%eax
+  8021c6:	7f 6d                	jg     802235 <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  8021c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021cb:	5b                   	pop    %ebx
+  8021cc:	5e                   	pop    %esi
+  8021cd:	5f                   	pop    %edi
+  8021ce:	5d                   	pop    %ebp
+  8021cf:	c3                   	ret
+  8021d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021d5:	0f a2                	cpuid
+		return 0;
+  8021d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8021dc:	f6 c6 08             	test   $0x8,%dh
+  8021df:	74 15                	je     8021f6 <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021e1:	89 c2                	mov    %eax,%edx
+  8021e3:	c1 ea 08             	shr    $0x8,%edx
+  8021e6:	83 e2 0f             	and    $0xf,%edx
+  8021e9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8021ee:	83 fa 06             	cmp    $0x6,%edx
+  8021f1:	74 0e                	je     802201 <sys_shm_detach+0x7b>
+  8021f3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8021f6:	0f b6 c9             	movzbl %cl,%ecx
+  8021f9:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8021ff:	eb 97                	jmp    802198 <sys_shm_detach+0x12>
+  802201:	89 c2                	mov    %eax,%edx
+  802203:	c1 ea 04             	shr    $0x4,%edx
+  802206:	83 e2 0f             	and    $0xf,%edx
+  802209:	83 fa 02             	cmp    $0x2,%edx
+  80220c:	77 e5                	ja     8021f3 <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  80220e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802211:	83 f8 02             	cmp    $0x2,%eax
+  802214:	0f 97 c1             	seta   %cl
+  802217:	0f b6 c9             	movzbl %cl,%ecx
+  80221a:	eb d7                	jmp    8021f3 <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  80221c:	be 00 00 00 00       	mov    $0x0,%esi
+  802221:	b8 17 00 00 00       	mov    $0x17,%eax
+  802226:	8b 55 08             	mov    0x8(%ebp),%edx
+  802229:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80222c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80222f:	89 f7                	mov    %esi,%edi
+  802231:	cd 30                	int    $0x30
+  802233:	eb 8f                	jmp    8021c4 <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802235:	83 ec 0c             	sub    $0xc,%esp
+  802238:	50                   	push   %eax
+  802239:	6a 17                	push   $0x17
+  80223b:	68 39 33 80 00       	push   $0x803339
+  802240:	6a 4a                	push   $0x4a
+  802242:	68 56 33 80 00       	push   $0x803356
+  802247:	e8 78 e0 ff ff       	call   8002c4 <_panic>
+
+0080224c <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  80224c:	55                   	push   %ebp
+  80224d:	89 e5                	mov    %esp,%ebp
+  80224f:	57                   	push   %edi
+  802250:	56                   	push   %esi
+  802251:	53                   	push   %ebx
+  802252:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802255:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80225c:	78 36                	js     802294 <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  80225e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802265:	74 79                	je     8022e0 <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  802267:	8b 55 08             	mov    0x8(%ebp),%edx
+  80226a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80226f:	b8 18 00 00 00       	mov    $0x18,%eax
+  802274:	89 cb                	mov    %ecx,%ebx
+  802276:	89 cf                	mov    %ecx,%edi
+  802278:	89 ce                	mov    %ecx,%esi
+  80227a:	55                   	push   %ebp
+  80227b:	68 84 22 80 00       	push   $0x802284
+  802280:	89 e5                	mov    %esp,%ebp
+  802282:	0f 34                	sysenter
+  802284:	83 c4 04             	add    $0x4,%esp
+  802287:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802288:	85 c0                	test   %eax,%eax
+  80228a:	7f 6b                	jg     8022f7 <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  80228c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80228f:	5b                   	pop    %ebx
+  802290:	5e                   	pop    %esi
+  802291:	5f                   	pop    %edi
+  802292:	5d                   	pop    %ebp
+  802293:	c3                   	ret
+  802294:	b8 01 00 00 00       	mov    $0x1,%eax
+  802299:	0f a2                	cpuid
+		return 0;
+  80229b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8022a0:	f6 c6 08             	test   $0x8,%dh
+  8022a3:	74 15                	je     8022ba <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022a5:	89 c2                	mov    %eax,%edx
+  8022a7:	c1 ea 08             	shr    $0x8,%edx
+  8022aa:	83 e2 0f             	and    $0xf,%edx
+  8022ad:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8022b2:	83 fa 06             	cmp    $0x6,%edx
+  8022b5:	74 0e                	je     8022c5 <sys_shm_remove+0x79>
+  8022b7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8022ba:	0f b6 c9             	movzbl %cl,%ecx
+  8022bd:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8022c3:	eb 99                	jmp    80225e <sys_shm_remove+0x12>
+  8022c5:	89 c2                	mov    %eax,%edx
+  8022c7:	c1 ea 04             	shr    $0x4,%edx
+  8022ca:	83 e2 0f             	and    $0xf,%edx
+  8022cd:	83 fa 02             	cmp    $0x2,%edx
+  8022d0:	77 e5                	ja     8022b7 <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  8022d2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022d5:	83 f8 02             	cmp    $0x2,%eax
+  8022d8:	0f 97 c1             	seta   %cl
+  8022db:	0f b6 c9             	movzbl %cl,%ecx
+  8022de:	eb d7                	jmp    8022b7 <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  8022e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022e5:	b8 18 00 00 00       	mov    $0x18,%eax
+  8022ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022ed:	89 cb                	mov    %ecx,%ebx
+  8022ef:	89 cf                	mov    %ecx,%edi
+  8022f1:	89 ce                	mov    %ecx,%esi
+  8022f3:	cd 30                	int    $0x30
+  8022f5:	eb 91                	jmp    802288 <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8022f7:	83 ec 0c             	sub    $0xc,%esp
+  8022fa:	50                   	push   %eax
+  8022fb:	6a 18                	push   $0x18
+  8022fd:	68 39 33 80 00       	push   $0x803339
+  802302:	6a 4a                	push   $0x4a
+  802304:	68 56 33 80 00       	push   $0x803356
+  802309:	e8 b6 df ff ff       	call   8002c4 <_panic>
+
+0080230e <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  80230e:	55                   	push   %ebp
+  80230f:	89 e5                	mov    %esp,%ebp
+  802311:	57                   	push   %edi
+  802312:	56                   	push   %esi
+  802313:	53                   	push   %ebx
+  802314:	83 ec 0c             	sub    $0xc,%esp
+  802317:	8b 45 10             	mov    0x10(%ebp),%eax
+  80231a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80231d:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  802320:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802327:	78 32                	js     80235b <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  802329:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802330:	74 75                	je     8023a7 <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  802332:	8b 55 08             	mov    0x8(%ebp),%edx
+  802335:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802338:	b8 20 00 00 00       	mov    $0x20,%eax
+  80233d:	be 00 00 00 00       	mov    $0x0,%esi
+  802342:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802345:	55                   	push   %ebp
+  802346:	68 4f 23 80 00       	push   $0x80234f
+  80234b:	89 e5                	mov    %esp,%ebp
+  80234d:	0f 34                	sysenter
+  80234f:	83 c4 04             	add    $0x4,%esp
+  802352:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  802353:	83 c4 0c             	add    $0xc,%esp
+  802356:	5b                   	pop    %ebx
+  802357:	5e                   	pop    %esi
+  802358:	5f                   	pop    %edi
+  802359:	5d                   	pop    %ebp
+  80235a:	c3                   	ret
+  80235b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802360:	0f a2                	cpuid
+		return 0;
+  802362:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802367:	f6 c6 08             	test   $0x8,%dh
+  80236a:	74 15                	je     802381 <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80236c:	89 c2                	mov    %eax,%edx
+  80236e:	c1 ea 08             	shr    $0x8,%edx
+  802371:	83 e2 0f             	and    $0xf,%edx
+  802374:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802379:	83 fa 06             	cmp    $0x6,%edx
+  80237c:	74 0e                	je     80238c <sys_futex_wait+0x7e>
+  80237e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802381:	0f b6 c9             	movzbl %cl,%ecx
+  802384:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80238a:	eb 9d                	jmp    802329 <sys_futex_wait+0x1b>
+  80238c:	89 c2                	mov    %eax,%edx
+  80238e:	c1 ea 04             	shr    $0x4,%edx
+  802391:	83 e2 0f             	and    $0xf,%edx
+  802394:	83 fa 02             	cmp    $0x2,%edx
+  802397:	77 e5                	ja     80237e <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  802399:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80239c:	83 f8 02             	cmp    $0x2,%eax
+  80239f:	0f 97 c1             	seta   %cl
+  8023a2:	0f b6 c9             	movzbl %cl,%ecx
+  8023a5:	eb d7                	jmp    80237e <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  8023a7:	b8 20 00 00 00       	mov    $0x20,%eax
+  8023ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8023b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023b7:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8023ba:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  8023bc:	eb 95                	jmp    802353 <sys_futex_wait+0x45>
+
+008023be <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8023be:	55                   	push   %ebp
+  8023bf:	89 e5                	mov    %esp,%ebp
+  8023c1:	57                   	push   %edi
+  8023c2:	56                   	push   %esi
+  8023c3:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8023c4:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8023cb:	78 30                	js     8023fd <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  8023cd:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8023d4:	74 73                	je     802449 <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  8023d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023e1:	b8 21 00 00 00       	mov    $0x21,%eax
+  8023e6:	89 df                	mov    %ebx,%edi
+  8023e8:	89 de                	mov    %ebx,%esi
+  8023ea:	55                   	push   %ebp
+  8023eb:	68 f4 23 80 00       	push   $0x8023f4
+  8023f0:	89 e5                	mov    %esp,%ebp
+  8023f2:	0f 34                	sysenter
+  8023f4:	83 c4 04             	add    $0x4,%esp
+  8023f7:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8023f8:	5b                   	pop    %ebx
+  8023f9:	5e                   	pop    %esi
+  8023fa:	5f                   	pop    %edi
+  8023fb:	5d                   	pop    %ebp
+  8023fc:	c3                   	ret
+  8023fd:	b8 01 00 00 00       	mov    $0x1,%eax
+  802402:	0f a2                	cpuid
+		return 0;
+  802404:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802409:	f6 c6 08             	test   $0x8,%dh
+  80240c:	74 15                	je     802423 <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80240e:	89 c2                	mov    %eax,%edx
+  802410:	c1 ea 08             	shr    $0x8,%edx
+  802413:	83 e2 0f             	and    $0xf,%edx
+  802416:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80241b:	83 fa 06             	cmp    $0x6,%edx
+  80241e:	74 0e                	je     80242e <sys_futex_wake+0x70>
+  802420:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802423:	0f b6 c9             	movzbl %cl,%ecx
+  802426:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80242c:	eb 9f                	jmp    8023cd <sys_futex_wake+0xf>
+  80242e:	89 c2                	mov    %eax,%edx
+  802430:	c1 ea 04             	shr    $0x4,%edx
+  802433:	83 e2 0f             	and    $0xf,%edx
+  802436:	83 fa 02             	cmp    $0x2,%edx
+  802439:	77 e5                	ja     802420 <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  80243b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80243e:	83 f8 02             	cmp    $0x2,%eax
+  802441:	0f 97 c1             	seta   %cl
+  802444:	0f b6 c9             	movzbl %cl,%ecx
+  802447:	eb d7                	jmp    802420 <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  802449:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80244e:	b8 21 00 00 00       	mov    $0x21,%eax
+  802453:	8b 55 08             	mov    0x8(%ebp),%edx
+  802456:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802459:	89 df                	mov    %ebx,%edi
+  80245b:	89 de                	mov    %ebx,%esi
+  80245d:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  80245f:	eb 97                	jmp    8023f8 <sys_futex_wake+0x3a>
+
+00802461 <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  802461:	55                   	push   %ebp
+  802462:	89 e5                	mov    %esp,%ebp
+  802464:	57                   	push   %edi
+  802465:	56                   	push   %esi
+  802466:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802467:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80246e:	78 2e                	js     80249e <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  802470:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802477:	74 71                	je     8024ea <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  802479:	ba 00 00 00 00       	mov    $0x0,%edx
+  80247e:	b8 22 00 00 00       	mov    $0x22,%eax
+  802483:	89 d1                	mov    %edx,%ecx
+  802485:	89 d3                	mov    %edx,%ebx
+  802487:	89 d7                	mov    %edx,%edi
+  802489:	89 d6                	mov    %edx,%esi
+  80248b:	55                   	push   %ebp
+  80248c:	68 95 24 80 00       	push   $0x802495
+  802491:	89 e5                	mov    %esp,%ebp
+  802493:	0f 34                	sysenter
+  802495:	83 c4 04             	add    $0x4,%esp
+  802498:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  802499:	5b                   	pop    %ebx
+  80249a:	5e                   	pop    %esi
+  80249b:	5f                   	pop    %edi
+  80249c:	5d                   	pop    %ebp
+  80249d:	c3                   	ret
+  80249e:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024a3:	0f a2                	cpuid
+		return 0;
+  8024a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8024aa:	f6 c6 08             	test   $0x8,%dh
+  8024ad:	74 15                	je     8024c4 <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8024af:	89 c2                	mov    %eax,%edx
+  8024b1:	c1 ea 08             	shr    $0x8,%edx
+  8024b4:	83 e2 0f             	and    $0xf,%edx
+  8024b7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8024bc:	83 fa 06             	cmp    $0x6,%edx
+  8024bf:	74 0e                	je     8024cf <sys_ep_create+0x6e>
+  8024c1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8024c4:	0f b6 c9             	movzbl %cl,%ecx
+  8024c7:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8024cd:	eb a1                	jmp    802470 <sys_ep_create+0xf>
+  8024cf:	89 c2                	mov    %eax,%edx
+  8024d1:	c1 ea 04             	shr    $0x4,%edx
+  8024d4:	83 e2 0f             	and    $0xf,%edx
+  8024d7:	83 fa 02             	cmp    $0x2,%edx
+  8024da:	77 e5                	ja     8024c1 <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  8024dc:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8024df:	83 f8 02             	cmp    $0x2,%eax
+  8024e2:	0f 97 c1             	seta   %cl
+  8024e5:	0f b6 c9             	movzbl %cl,%ecx
+  8024e8:	eb d7                	jmp    8024c1 <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  8024ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024ef:	b8 22 00 00 00       	mov    $0x22,%eax
+  8024f4:	89 d1                	mov    %edx,%ecx
+  8024f6:	89 d3                	mov    %edx,%ebx
+  8024f8:	89 d7                	mov    %edx,%edi
+  8024fa:	89 d6                	mov    %edx,%esi
+  8024fc:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  8024fe:	eb 99                	jmp    802499 <sys_ep_create+0x38>
+
+00802500 <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  802500:	55                   	push   %ebp
+  802501:	89 e5                	mov    %esp,%ebp
+  802503:	57                   	push   %edi
+  802504:	56                   	push   %esi
+  802505:	53                   	push   %ebx
+  802506:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802509:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802510:	78 36                	js     802548 <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  802512:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802519:	74 79                	je     802594 <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  80251b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80251e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802523:	b8 23 00 00 00       	mov    $0x23,%eax
+  802528:	89 cb                	mov    %ecx,%ebx
+  80252a:	89 cf                	mov    %ecx,%edi
+  80252c:	89 ce                	mov    %ecx,%esi
+  80252e:	55                   	push   %ebp
+  80252f:	68 38 25 80 00       	push   $0x802538
+  802534:	89 e5                	mov    %esp,%ebp
+  802536:	0f 34                	sysenter
+  802538:	83 c4 04             	add    $0x4,%esp
+  80253b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80253c:	85 c0                	test   %eax,%eax
+  80253e:	7f 6b                	jg     8025ab <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  802540:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802543:	5b                   	pop    %ebx
+  802544:	5e                   	pop    %esi
+  802545:	5f                   	pop    %edi
+  802546:	5d                   	pop    %ebp
+  802547:	c3                   	ret
+  802548:	b8 01 00 00 00       	mov    $0x1,%eax
+  80254d:	0f a2                	cpuid
+		return 0;
+  80254f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802554:	f6 c6 08             	test   $0x8,%dh
+  802557:	74 15                	je     80256e <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802559:	89 c2                	mov    %eax,%edx
+  80255b:	c1 ea 08             	shr    $0x8,%edx
+  80255e:	83 e2 0f             	and    $0xf,%edx
+  802561:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802566:	83 fa 06             	cmp    $0x6,%edx
+  802569:	74 0e                	je     802579 <sys_ep_destroy+0x79>
+  80256b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80256e:	0f b6 c9             	movzbl %cl,%ecx
+  802571:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802577:	eb 99                	jmp    802512 <sys_ep_destroy+0x12>
+  802579:	89 c2                	mov    %eax,%edx
+  80257b:	c1 ea 04             	shr    $0x4,%edx
+  80257e:	83 e2 0f             	and    $0xf,%edx
+  802581:	83 fa 02             	cmp    $0x2,%edx
+  802584:	77 e5                	ja     80256b <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  802586:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802589:	83 f8 02             	cmp    $0x2,%eax
+  80258c:	0f 97 c1             	seta   %cl
+  80258f:	0f b6 c9             	movzbl %cl,%ecx
+  802592:	eb d7                	jmp    80256b <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  802594:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802599:	b8 23 00 00 00       	mov    $0x23,%eax
+  80259e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025a1:	89 cb                	mov    %ecx,%ebx
+  8025a3:	89 cf                	mov    %ecx,%edi
+  8025a5:	89 ce                	mov    %ecx,%esi
+  8025a7:	cd 30                	int    $0x30
+  8025a9:	eb 91                	jmp    80253c <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8025ab:	83 ec 0c             	sub    $0xc,%esp
+  8025ae:	50                   	push   %eax
+  8025af:	6a 23                	push   $0x23
+  8025b1:	68 39 33 80 00       	push   $0x803339
+  8025b6:	6a 4a                	push   $0x4a
+  8025b8:	68 56 33 80 00       	push   $0x803356
+  8025bd:	e8 02 dd ff ff       	call   8002c4 <_panic>
+
+008025c2 <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  8025c2:	55                   	push   %ebp
+  8025c3:	89 e5                	mov    %esp,%ebp
+  8025c5:	57                   	push   %edi
+  8025c6:	56                   	push   %esi
+  8025c7:	53                   	push   %ebx
+  8025c8:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8025cb:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8025d2:	78 37                	js     80260b <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  8025d4:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8025db:	74 7a                	je     802657 <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  8025dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025e8:	b8 24 00 00 00       	mov    $0x24,%eax
+  8025ed:	89 df                	mov    %ebx,%edi
+  8025ef:	89 de                	mov    %ebx,%esi
+  8025f1:	55                   	push   %ebp
+  8025f2:	68 fb 25 80 00       	push   $0x8025fb
+  8025f7:	89 e5                	mov    %esp,%ebp
+  8025f9:	0f 34                	sysenter
+  8025fb:	83 c4 04             	add    $0x4,%esp
+  8025fe:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8025ff:	85 c0                	test   %eax,%eax
+  802601:	7f 6c                	jg     80266f <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  802603:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802606:	5b                   	pop    %ebx
+  802607:	5e                   	pop    %esi
+  802608:	5f                   	pop    %edi
+  802609:	5d                   	pop    %ebp
+  80260a:	c3                   	ret
+  80260b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802610:	0f a2                	cpuid
+		return 0;
+  802612:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802617:	f6 c6 08             	test   $0x8,%dh
+  80261a:	74 15                	je     802631 <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80261c:	89 c2                	mov    %eax,%edx
+  80261e:	c1 ea 08             	shr    $0x8,%edx
+  802621:	83 e2 0f             	and    $0xf,%edx
+  802624:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802629:	83 fa 06             	cmp    $0x6,%edx
+  80262c:	74 0e                	je     80263c <sys_ep_grant+0x7a>
+  80262e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802631:	0f b6 c9             	movzbl %cl,%ecx
+  802634:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80263a:	eb 98                	jmp    8025d4 <sys_ep_grant+0x12>
+  80263c:	89 c2                	mov    %eax,%edx
+  80263e:	c1 ea 04             	shr    $0x4,%edx
+  802641:	83 e2 0f             	and    $0xf,%edx
+  802644:	83 fa 02             	cmp    $0x2,%edx
+  802647:	77 e5                	ja     80262e <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  802649:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80264c:	83 f8 02             	cmp    $0x2,%eax
+  80264f:	0f 97 c1             	seta   %cl
+  802652:	0f b6 c9             	movzbl %cl,%ecx
+  802655:	eb d7                	jmp    80262e <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  802657:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80265c:	b8 24 00 00 00       	mov    $0x24,%eax
+  802661:	8b 55 08             	mov    0x8(%ebp),%edx
+  802664:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802667:	89 df                	mov    %ebx,%edi
+  802669:	89 de                	mov    %ebx,%esi
+  80266b:	cd 30                	int    $0x30
+  80266d:	eb 90                	jmp    8025ff <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80266f:	83 ec 0c             	sub    $0xc,%esp
+  802672:	50                   	push   %eax
+  802673:	6a 24                	push   $0x24
+  802675:	68 39 33 80 00       	push   $0x803339
+  80267a:	6a 4a                	push   $0x4a
+  80267c:	68 56 33 80 00       	push   $0x803356
+  802681:	e8 3e dc ff ff       	call   8002c4 <_panic>
+
+00802686 <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  802686:	55                   	push   %ebp
+  802687:	89 e5                	mov    %esp,%ebp
+  802689:	57                   	push   %edi
+  80268a:	56                   	push   %esi
+  80268b:	53                   	push   %ebx
+  80268c:	83 ec 20             	sub    $0x20,%esp
+  80268f:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  802692:	8b 10                	mov    (%eax),%edx
+  802694:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802697:	8b 50 04             	mov    0x4(%eax),%edx
+  80269a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80269d:	8b 50 08             	mov    0x8(%eax),%edx
+  8026a0:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  8026a3:	8b 50 0c             	mov    0xc(%eax),%edx
+  8026a6:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  8026a9:	8b 40 10             	mov    0x10(%eax),%eax
+  8026ac:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  8026af:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  8026b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8026b5:	b8 25 00 00 00       	mov    $0x25,%eax
+  8026ba:	55                   	push   %ebp
+  8026bb:	56                   	push   %esi
+  8026bc:	8b 0e                	mov    (%esi),%ecx
+  8026be:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8026c1:	8b 7e 08             	mov    0x8(%esi),%edi
+  8026c4:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8026c7:	8b 76 0c             	mov    0xc(%esi),%esi
+  8026ca:	cd 30                	int    $0x30
+  8026cc:	87 34 24             	xchg   %esi,(%esp)
+  8026cf:	89 0e                	mov    %ecx,(%esi)
+  8026d1:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8026d4:	89 7e 08             	mov    %edi,0x8(%esi)
+  8026d7:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8026da:	8f 46 0c             	pop    0xc(%esi)
+  8026dd:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  8026de:	83 c4 20             	add    $0x20,%esp
+  8026e1:	5b                   	pop    %ebx
+  8026e2:	5e                   	pop    %esi
+  8026e3:	5f                   	pop    %edi
+  8026e4:	5d                   	pop    %ebp
+  8026e5:	c3                   	ret
+
+008026e6 <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  8026e6:	55                   	push   %ebp
+  8026e7:	89 e5                	mov    %esp,%ebp
+  8026e9:	57                   	push   %edi
+  8026ea:	56                   	push   %esi
+  8026eb:	53                   	push   %ebx
+  8026ec:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  8026ef:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026f2:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  8026f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8026f7:	b8 26 00 00 00       	mov    $0x26,%eax
+  8026fc:	55                   	push   %ebp
+  8026fd:	56                   	push   %esi
+  8026fe:	8b 0e                	mov    (%esi),%ecx
+  802700:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802703:	8b 7e 08             	mov    0x8(%esi),%edi
+  802706:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802709:	8b 76 0c             	mov    0xc(%esi),%esi
+  80270c:	cd 30                	int    $0x30
+  80270e:	87 34 24             	xchg   %esi,(%esp)
+  802711:	89 0e                	mov    %ecx,(%esi)
+  802713:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802716:	89 7e 08             	mov    %edi,0x8(%esi)
+  802719:	89 6e 10             	mov    %ebp,0x10(%esi)
+  80271c:	8f 46 0c             	pop    0xc(%esi)
+  80271f:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  802720:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  802724:	74 0f                	je     802735 <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  802726:	85 c0                	test   %eax,%eax
+  802728:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80272d:	0f 48 d1             	cmovs  %ecx,%edx
+  802730:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  802733:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  802735:	5b                   	pop    %ebx
+  802736:	5e                   	pop    %esi
+  802737:	5f                   	pop    %edi
+  802738:	5d                   	pop    %ebp
+  802739:	c3                   	ret
+
+0080273a <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  80273a:	55                   	push   %ebp
+  80273b:	89 e5                	mov    %esp,%ebp
+  80273d:	57                   	push   %edi
+  80273e:	56                   	push   %esi
+  80273f:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802740:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802747:	78 2f                	js     802778 <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  802749:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802750:	74 72                	je     8027c4 <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  802752:	8b 55 08             	mov    0x8(%ebp),%edx
+  802755:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80275a:	b8 27 00 00 00       	mov    $0x27,%eax
+  80275f:	89 cb                	mov    %ecx,%ebx
+  802761:	89 cf                	mov    %ecx,%edi
+  802763:	89 ce                	mov    %ecx,%esi
+  802765:	55                   	push   %ebp
+  802766:	68 6f 27 80 00       	push   $0x80276f
+  80276b:	89 e5                	mov    %esp,%ebp
+  80276d:	0f 34                	sysenter
+  80276f:	83 c4 04             	add    $0x4,%esp
+  802772:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  802773:	5b                   	pop    %ebx
+  802774:	5e                   	pop    %esi
+  802775:	5f                   	pop    %edi
+  802776:	5d                   	pop    %ebp
+  802777:	c3                   	ret
+  802778:	b8 01 00 00 00       	mov    $0x1,%eax
+  80277d:	0f a2                	cpuid
+		return 0;
+  80277f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802784:	f6 c6 08             	test   $0x8,%dh
+  802787:	74 15                	je     80279e <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802789:	89 c2                	mov    %eax,%edx
+  80278b:	c1 ea 08             	shr    $0x8,%edx
+  80278e:	83 e2 0f             	and    $0xf,%edx
+  802791:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802796:	83 fa 06             	cmp    $0x6,%edx
+  802799:	74 0e                	je     8027a9 <sys_sysring_setup+0x6f>
+  80279b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80279e:	0f b6 c9             	movzbl %cl,%ecx
+  8027a1:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8027a7:	eb a0                	jmp    802749 <sys_sysring_setup+0xf>
+  8027a9:	89 c2                	mov    %eax,%edx
+  8027ab:	c1 ea 04             	shr    $0x4,%edx
+  8027ae:	83 e2 0f             	and    $0xf,%edx
+  8027b1:	83 fa 02             	cmp    $0x2,%edx
+  8027b4:	77 e5                	ja     80279b <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  8027b6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8027b9:	83 f8 02             	cmp    $0x2,%eax
+  8027bc:	0f 97 c1             	seta   %cl
+  8027bf:	0f b6 c9             	movzbl %cl,%ecx
+  8027c2:	eb d7                	jmp    80279b <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  8027c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027c9:	b8 27 00 00 00       	mov    $0x27,%eax
+  8027ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8027d1:	89 cb                	mov    %ecx,%ebx
+  8027d3:	89 cf                	mov    %ecx,%edi
+  8027d5:	89 ce                	mov    %ecx,%esi
+  8027d7:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  8027d9:	eb 98                	jmp    802773 <sys_sysring_setup+0x39>
+
+008027db <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  8027db:	55                   	push   %ebp
+  8027dc:	89 e5                	mov    %esp,%ebp
+  8027de:	57                   	push   %edi
+  8027df:	56                   	push   %esi
+  8027e0:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8027e1:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8027e8:	78 2e                	js     802818 <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  8027ea:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8027f1:	74 71                	je     802864 <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  8027f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027f8:	b8 28 00 00 00       	mov    $0x28,%eax
+  8027fd:	89 d1                	mov    %edx,%ecx
+  8027ff:	89 d3                	mov    %edx,%ebx
+  802801:	89 d7                	mov    %edx,%edi
+  802803:	89 d6                	mov    %edx,%esi
+  802805:	55                   	push   %ebp
+  802806:	68 0f 28 80 00       	push   $0x80280f
+  80280b:	89 e5                	mov    %esp,%ebp
+  80280d:	0f 34                	sysenter
+  80280f:	83 c4 04             	add    $0x4,%esp
+  802812:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  802813:	5b                   	pop    %ebx
+  802814:	5e                   	pop    %esi
+  802815:	5f                   	pop    %edi
+  802816:	5d                   	pop    %ebp
+  802817:	c3                   	ret
+  802818:	b8 01 00 00 00       	mov    $0x1,%eax
+  80281d:	0f a2                	cpuid
+		return 0;
+  80281f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802824:	f6 c6 08             	test   $0x8,%dh
+  802827:	74 15                	je     80283e <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802829:	89 c2                	mov    %eax,%edx
+  80282b:	c1 ea 08             	shr    $0x8,%edx
+  80282e:	83 e2 0f             	and    $0xf,%edx
+  802831:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802836:	83 fa 06             	cmp    $0x6,%edx
+  802839:	74 0e                	je     802849 <sys_sysring_enter+0x6e>
+  80283b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80283e:	0f b6 c9             	movzbl %cl,%ecx
+  802841:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802847:	eb a1                	jmp    8027ea <sys_sysring_enter+0xf>
+  802849:	89 c2                	mov    %eax,%edx
+  80284b:	c1 ea 04             	shr    $0x4,%edx
+  80284e:	83 e2 0f             	and    $0xf,%edx
+  802851:	83 fa 02             	cmp    $0x2,%edx
+  802854:	77 e5                	ja     80283b <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  802856:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802859:	83 f8 02             	cmp    $0x2,%eax
+  80285c:	0f 97 c1             	seta   %cl
+  80285f:	0f b6 c9             	movzbl %cl,%ecx
+  802862:	eb d7                	jmp    80283b <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  802864:	ba 00 00 00 00       	mov    $0x0,%edx
+  802869:	b8 28 00 00 00       	mov    $0x28,%eax
+  80286e:	89 d1                	mov    %edx,%ecx
+  802870:	89 d3                	mov    %edx,%ebx
+  802872:	89 d7                	mov    %edx,%edi
+  802874:	89 d6                	mov    %edx,%esi
+  802876:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  802878:	eb 99                	jmp    802813 <sys_sysring_enter+0x38>
+
+0080287a <pgfault>:
+// The kernel normally resolves these faults itself (page_fault_cow in
+// kern/trap.c); we only get here if it ran out of memory doing so.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  80287a:	55                   	push   %ebp
+  80287b:	89 e5                	mov    %esp,%ebp
+  80287d:	83 ec 08             	sub    $0x8,%esp
+  802880:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  802883:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  802885:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  802888:	f6 c2 02             	test   $0x2,%dl
+  80288b:	74 40                	je     8028cd <pgfault+0x53>
+  80288d:	89 c1                	mov    %eax,%ecx
+  80288f:	c1 e9 16             	shr    $0x16,%ecx
+  802892:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802899:	f6 c1 01             	test   $0x1,%cl
+  80289c:	74 2f                	je     8028cd <pgfault+0x53>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW))
+  80289e:	89 c1                	mov    %eax,%ecx
+  8028a0:	c1 e9 0c             	shr    $0xc,%ecx
+  8028a3:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  8028aa:	f6 c5 08             	test   $0x8,%ch
+  8028ad:	74 1e                	je     8028cd <pgfault+0x53>
+	// Replace the page with a private writable copy of itself.  The
+	// kernel allocates, copies and maps it in one system call, so no
+	// temporary mapping at PFTEMP is needed.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8028af:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r = sys_page_copy(0, addr, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  8028b4:	83 ec 0c             	sub    $0xc,%esp
+  8028b7:	6a 07                	push   $0x7
+  8028b9:	50                   	push   %eax
+  8028ba:	6a 00                	push   $0x0
+  8028bc:	50                   	push   %eax
+  8028bd:	6a 00                	push   $0x0
+  8028bf:	e8 85 eb ff ff       	call   801449 <sys_page_copy>
+  8028c4:	83 c4 20             	add    $0x20,%esp
+  8028c7:	85 c0                	test   %eax,%eax
+  8028c9:	78 18                	js     8028e3 <pgfault+0x69>
+		panic("pgfault: sys_page_copy: %e", r);
+}
+  8028cb:	c9                   	leave
+  8028cc:	c3                   	ret
+		panic("pgfault: va %08x err %x is not a copy-on-write write",
+  8028cd:	83 ec 0c             	sub    $0xc,%esp
+  8028d0:	52                   	push   %edx
+  8028d1:	50                   	push   %eax
+  8028d2:	68 64 33 80 00       	push   $0x803364
+  8028d7:	6a 1c                	push   $0x1c
+  8028d9:	68 99 33 80 00       	push   $0x803399
+  8028de:	e8 e1 d9 ff ff       	call   8002c4 <_panic>
+		panic("pgfault: sys_page_copy: %e", r);
+  8028e3:	50                   	push   %eax
+  8028e4:	68 a4 33 80 00       	push   $0x8033a4
+  8028e9:	6a 26                	push   $0x26
+  8028eb:	68 99 33 80 00       	push   $0x803399
+  8028f0:	e8 cf d9 ff ff       	call   8002c4 <_panic>
+
+008028f5 <ufork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+ufork(void)
+{
+  8028f5:	55                   	push   %ebp
+  8028f6:	89 e5                	mov    %esp,%ebp
+  8028f8:	57                   	push   %edi
+  8028f9:	56                   	push   %esi
+  8028fa:	53                   	push   %ebx
+  8028fb:	81 ec 38 04 00 00    	sub    $0x438,%esp
+	struct page_range vec[PAGE_VEC_MAX], *last;
+	uintptr_t va;
+	size_t n;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  802901:	68 7a 28 80 00       	push   $0x80287a
+  802906:	e8 d3 03 00 00       	call   802cde <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  80290b:	b8 07 00 00 00       	mov    $0x7,%eax
+  802910:	cd 30                	int    $0x30
+  802912:	89 85 d4 fb ff ff    	mov    %eax,-0x42c(%ebp)
+
+	envid = sys_exofork();
+	if (envid < 0)
+  802918:	83 c4 10             	add    $0x10,%esp
+  80291b:	85 c0                	test   %eax,%eax
+  80291d:	0f 88 f2 01 00 00    	js     802b15 <ufork+0x220>
+		return 0;
+	}
+
+	// Copy every run of mapped pages below the exception stack, which
+	// must not be shared.
+	va = 0;
+  802923:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  802928:	74 0b                	je     802935 <ufork+0x40>
+  80292a:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  802930:	e9 07 01 00 00       	jmp    802a3c <ufork+0x147>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  802935:	e8 22 e8 ff ff       	call   80115c <sys_getenvid>
+  80293a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80293f:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802945:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80294a:	a3 08 40 80 00       	mov    %eax,0x804008
+		return 0;
+  80294f:	e9 c1 01 00 00       	jmp    802b15 <ufork+0x220>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+		n = r;
+		last = &vec[n - 1];
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  802954:	83 ea 01             	sub    $0x1,%edx
+  802957:	89 c1                	mov    %eax,%ecx
+  802959:	c1 e1 04             	shl    $0x4,%ecx
+  80295c:	89 94 0d ec fd ff ff 	mov    %edx,-0x214(%ebp,%ecx,1)
+			n--;
+  802963:	85 d2                	test   %edx,%edx
+  802965:	0f 44 f0             	cmove  %eax,%esi
+  802968:	e9 12 01 00 00       	jmp    802a7f <ufork+0x18a>
+	for (i = 0; i < n; i++) {
+  80296d:	83 c1 01             	add    $0x1,%ecx
+  802970:	83 c0 10             	add    $0x10,%eax
+  802973:	39 8d e4 fb ff ff    	cmp    %ecx,-0x41c(%ebp)
+  802979:	74 6a                	je     8029e5 <ufork+0xf0>
+		vec[i].pr_dstva = vec[i].pr_va;
+  80297b:	89 c3                	mov    %eax,%ebx
+  80297d:	8b 10                	mov    (%eax),%edx
+  80297f:	89 50 0c             	mov    %edx,0xc(%eax)
+		if (vec[i].pr_perm & PTE_SHARE)
+  802982:	8b 50 08             	mov    0x8(%eax),%edx
+  802985:	f6 c6 04             	test   $0x4,%dh
+  802988:	75 e3                	jne    80296d <ufork+0x78>
+		if (vec[i].pr_perm & (PTE_W | PTE_COW)) {
+  80298a:	f7 c2 02 08 00 00    	test   $0x802,%edx
+  802990:	74 db                	je     80296d <ufork+0x78>
+			vec[i].pr_perm = (vec[i].pr_perm & ~PTE_W) | PTE_COW;
+  802992:	81 e2 fd f7 ff ff    	and    $0xfffff7fd,%edx
+  802998:	80 ce 08             	or     $0x8,%dh
+  80299b:	89 95 dc fb ff ff    	mov    %edx,-0x424(%ebp)
+  8029a1:	89 53 08             	mov    %edx,0x8(%ebx)
+			cow[ncow++] = vec[i];
+  8029a4:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  8029aa:	c1 e6 04             	shl    $0x4,%esi
+  8029ad:	89 f2                	mov    %esi,%edx
+  8029af:	8d b4 35 e8 fb ff ff 	lea    -0x418(%ebp,%esi,1),%esi
+  8029b6:	8b 38                	mov    (%eax),%edi
+  8029b8:	89 bc 15 e8 fb ff ff 	mov    %edi,-0x418(%ebp,%edx,1)
+  8029bf:	8b 78 04             	mov    0x4(%eax),%edi
+  8029c2:	89 7e 04             	mov    %edi,0x4(%esi)
+  8029c5:	8b bd dc fb ff ff    	mov    -0x424(%ebp),%edi
+  8029cb:	89 7e 08             	mov    %edi,0x8(%esi)
+  8029ce:	8b 50 0c             	mov    0xc(%eax),%edx
+  8029d1:	89 56 0c             	mov    %edx,0xc(%esi)
+  8029d4:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  8029da:	8d 7e 01             	lea    0x1(%esi),%edi
+  8029dd:	89 bd e0 fb ff ff    	mov    %edi,-0x420(%ebp)
+  8029e3:	eb 88                	jmp    80296d <ufork+0x78>
+	if ((r = sys_page_map_vec(0, envid, vec, n, 0)) < 0)
+  8029e5:	8b b5 e4 fb ff ff    	mov    -0x41c(%ebp),%esi
+  8029eb:	8b bd d8 fb ff ff    	mov    -0x428(%ebp),%edi
+  8029f1:	83 ec 0c             	sub    $0xc,%esp
+  8029f4:	6a 00                	push   $0x0
+  8029f6:	56                   	push   %esi
+  8029f7:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  8029fd:	50                   	push   %eax
+  8029fe:	ff b5 d4 fb ff ff    	push   -0x42c(%ebp)
+  802a04:	6a 00                	push   $0x0
+  802a06:	e8 80 f4 ff ff       	call   801e8b <sys_page_map_vec>
+  802a0b:	83 c4 20             	add    $0x20,%esp
+  802a0e:	85 c0                	test   %eax,%eax
+  802a10:	0f 88 e5 00 00 00    	js     802afb <ufork+0x206>
+	return sys_page_map_vec(0, 0, cow, ncow, 0);
+  802a16:	83 ec 0c             	sub    $0xc,%esp
+  802a19:	6a 00                	push   $0x0
+  802a1b:	ff b5 e0 fb ff ff    	push   -0x420(%ebp)
+  802a21:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  802a27:	50                   	push   %eax
+  802a28:	6a 00                	push   $0x0
+  802a2a:	6a 00                	push   $0x0
+  802a2c:	e8 5a f4 ff ff       	call   801e8b <sys_page_map_vec>
+		if ((r = duppages(envid, vec, n)) < 0)
+  802a31:	83 c4 20             	add    $0x20,%esp
+  802a34:	85 c0                	test   %eax,%eax
+  802a36:	0f 88 e7 00 00 00    	js     802b23 <ufork+0x22e>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+  802a3c:	6a 20                	push   $0x20
+  802a3e:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802a44:	50                   	push   %eax
+  802a45:	57                   	push   %edi
+  802a46:	6a 00                	push   $0x0
+  802a48:	e8 82 f4 ff ff       	call   801ecf <sys_vm_ranges>
+  802a4d:	83 c4 10             	add    $0x10,%esp
+  802a50:	85 c0                	test   %eax,%eax
+  802a52:	7e 51                	jle    802aa5 <ufork+0x1b0>
+		n = r;
+  802a54:	89 c6                	mov    %eax,%esi
+		last = &vec[n - 1];
+  802a56:	83 e8 01             	sub    $0x1,%eax
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+  802a59:	89 c1                	mov    %eax,%ecx
+  802a5b:	c1 e1 04             	shl    $0x4,%ecx
+  802a5e:	8b 94 0d ec fd ff ff 	mov    -0x214(%ebp,%ecx,1),%edx
+  802a65:	89 d3                	mov    %edx,%ebx
+  802a67:	c1 e3 0c             	shl    $0xc,%ebx
+  802a6a:	89 df                	mov    %ebx,%edi
+  802a6c:	03 bc 0d e8 fd ff ff 	add    -0x218(%ebp,%ecx,1),%edi
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  802a73:	81 ff 00 00 c0 ee    	cmp    $0xeec00000,%edi
+  802a79:	0f 84 d5 fe ff ff    	je     802954 <ufork+0x5f>
+	for (i = 0; i < n; i++) {
+  802a7f:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+	size_t i, ncow = 0;
+  802a85:	c7 85 e0 fb ff ff 00 	movl   $0x0,-0x420(%ebp)
+  802a8c:	00 00 00 
+	for (i = 0; i < n; i++) {
+  802a8f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a94:	89 bd d8 fb ff ff    	mov    %edi,-0x428(%ebp)
+  802a9a:	89 b5 e4 fb ff ff    	mov    %esi,-0x41c(%ebp)
+  802aa0:	e9 ce fe ff ff       	jmp    802973 <ufork+0x7e>
+			goto fail;
+	}
+	if (r < 0)
+  802aa5:	89 c6                	mov    %eax,%esi
+  802aa7:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  802aad:	85 c0                	test   %eax,%eax
+  802aaf:	78 52                	js     802b03 <ufork+0x20e>
+		goto fail;
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE),
+  802ab1:	83 ec 04             	sub    $0x4,%esp
+  802ab4:	6a 07                	push   $0x7
+  802ab6:	68 00 f0 bf ee       	push   $0xeebff000
+  802abb:	53                   	push   %ebx
+  802abc:	e8 3a e7 ff ff       	call   8011fb <sys_page_alloc>
+  802ac1:	89 c6                	mov    %eax,%esi
+  802ac3:	83 c4 10             	add    $0x10,%esp
+  802ac6:	85 c0                	test   %eax,%eax
+  802ac8:	78 39                	js     802b03 <ufork+0x20e>
+				PTE_P | PTE_U | PTE_W)) < 0
+	    || (r = sys_env_set_pgfault_upcall(envid,
+			thisenv->env_pgfault_upcall)) < 0
+  802aca:	a1 08 40 80 00       	mov    0x804008,%eax
+  802acf:	8b 40 74             	mov    0x74(%eax),%eax
+	    || (r = sys_env_set_pgfault_upcall(envid,
+  802ad2:	83 ec 08             	sub    $0x8,%esp
+  802ad5:	50                   	push   %eax
+  802ad6:	53                   	push   %ebx
+  802ad7:	e8 de ed ff ff       	call   8018ba <sys_env_set_pgfault_upcall>
+  802adc:	89 c6                	mov    %eax,%esi
+  802ade:	83 c4 10             	add    $0x10,%esp
+  802ae1:	85 c0                	test   %eax,%eax
+  802ae3:	78 1e                	js     802b03 <ufork+0x20e>
+	    || (r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  802ae5:	83 ec 08             	sub    $0x8,%esp
+  802ae8:	6a 02                	push   $0x2
+  802aea:	53                   	push   %ebx
+  802aeb:	e8 bc ea ff ff       	call   8015ac <sys_env_set_status>
+  802af0:	89 c6                	mov    %eax,%esi
+  802af2:	83 c4 10             	add    $0x10,%esp
+  802af5:	85 c0                	test   %eax,%eax
+  802af7:	79 1c                	jns    802b15 <ufork+0x220>
+  802af9:	eb 08                	jmp    802b03 <ufork+0x20e>
+  802afb:	89 c6                	mov    %eax,%esi
+  802afd:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+		goto fail;
+	return envid;
+
+fail:
+	sys_env_destroy(envid);
+  802b03:	83 ec 0c             	sub    $0xc,%esp
+  802b06:	53                   	push   %ebx
+  802b07:	e8 8e e5 ff ff       	call   80109a <sys_env_destroy>
+	return r;
+  802b0c:	83 c4 10             	add    $0x10,%esp
+  802b0f:	89 b5 d4 fb ff ff    	mov    %esi,-0x42c(%ebp)
+}
+  802b15:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+  802b1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b1e:	5b                   	pop    %ebx
+  802b1f:	5e                   	pop    %esi
+  802b20:	5f                   	pop    %edi
+  802b21:	5d                   	pop    %ebp
+  802b22:	c3                   	ret
+  802b23:	89 c6                	mov    %eax,%esi
+  802b25:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  802b2b:	eb d6                	jmp    802b03 <ufork+0x20e>
+
+00802b2d <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  802b2d:	55                   	push   %ebp
+  802b2e:	89 e5                	mov    %esp,%ebp
+  802b30:	53                   	push   %ebx
+  802b31:	83 ec 04             	sub    $0x4,%esp
+	envid_t envid;
+
+	envid = sys_fork();
+  802b34:	e8 90 f2 ff ff       	call   801dc9 <sys_fork>
+  802b39:	89 c3                	mov    %eax,%ebx
+	if (envid == 0)
+  802b3b:	85 c0                	test   %eax,%eax
+  802b3d:	74 07                	je     802b46 <fork+0x19>
+		thisenv = &envs[ENVX(sys_getenvid())];
+	return envid;
+}
+  802b3f:	89 d8                	mov    %ebx,%eax
+  802b41:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b44:	c9                   	leave
+  802b45:	c3                   	ret
+		thisenv = &envs[ENVX(sys_getenvid())];
+  802b46:	e8 11 e6 ff ff       	call   80115c <sys_getenvid>
+  802b4b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802b50:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802b56:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802b5b:	a3 08 40 80 00       	mov    %eax,0x804008
+	return envid;
+  802b60:	eb dd                	jmp    802b3f <fork+0x12>
+
+00802b62 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  802b62:	55                   	push   %ebp
+  802b63:	89 e5                	mov    %esp,%ebp
+  802b65:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  802b68:	68 bf 33 80 00       	push   $0x8033bf
+  802b6d:	68 a1 00 00 00       	push   $0xa1
+  802b72:	68 99 33 80 00       	push   $0x803399
+  802b77:	e8 48 d7 ff ff       	call   8002c4 <_panic>
+
+00802b7c <ring_init>:
+// bytes.  Only one side should do this, before the other uses it.
+// Returns the number of slots, or -E_INVAL if not even one fits.
+//
+int
+ring_init(struct ring *r, size_t size, size_t msgsize)
+{
+  802b7c:	55                   	push   %ebp
+  802b7d:	89 e5                	mov    %esp,%ebp
+  802b7f:	56                   	push   %esi
+  802b80:	53                   	push   %ebx
+  802b81:	8b 75 08             	mov    0x8(%ebp),%esi
+  802b84:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802b87:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	uint32_t nslots = 1;
+
+	if (msgsize == 0 || size < sizeof(*r) + msgsize)
+  802b8a:	85 c9                	test   %ecx,%ecx
+  802b8c:	74 41                	je     802bcf <ring_init+0x53>
+  802b8e:	8d 81 c0 00 00 00    	lea    0xc0(%ecx),%eax
+  802b94:	39 c3                	cmp    %eax,%ebx
+  802b96:	72 3e                	jb     802bd6 <ring_init+0x5a>
+	uint32_t nslots = 1;
+  802b98:	b8 01 00 00 00       	mov    $0x1,%eax
+		return -E_INVAL;
+	while (2 * nslots * msgsize <= size - sizeof(*r))
+  802b9d:	81 eb c0 00 00 00    	sub    $0xc0,%ebx
+  802ba3:	eb 02                	jmp    802ba7 <ring_init+0x2b>
+		nslots *= 2;
+  802ba5:	01 c0                	add    %eax,%eax
+	while (2 * nslots * msgsize <= size - sizeof(*r))
+  802ba7:	89 c2                	mov    %eax,%edx
+  802ba9:	0f af d1             	imul   %ecx,%edx
+  802bac:	01 d2                	add    %edx,%edx
+  802bae:	39 d3                	cmp    %edx,%ebx
+  802bb0:	73 f3                	jae    802ba5 <ring_init+0x29>
+	r->r_head = r->r_tail = 0;
+  802bb2:	c7 46 40 00 00 00 00 	movl   $0x0,0x40(%esi)
+  802bb9:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	r->r_nslots = nslots;
+  802bbf:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	r->r_msgsize = msgsize;
+  802bc5:	89 8e 84 00 00 00    	mov    %ecx,0x84(%esi)
+	return nslots;
+}
+  802bcb:	5b                   	pop    %ebx
+  802bcc:	5e                   	pop    %esi
+  802bcd:	5d                   	pop    %ebp
+  802bce:	c3                   	ret
+		return -E_INVAL;
+  802bcf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bd4:	eb f5                	jmp    802bcb <ring_init+0x4f>
+  802bd6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bdb:	eb ee                	jmp    802bcb <ring_init+0x4f>
+
+00802bdd <ring_put>:
+// Add a copy of the message at 'msg' to the ring.
+// Returns 1 on success, 0 if the ring is full.
+//
+bool
+ring_put(struct ring *r, const void *msg)
+{
+  802bdd:	55                   	push   %ebp
+  802bde:	89 e5                	mov    %esp,%ebp
+  802be0:	56                   	push   %esi
+  802be1:	53                   	push   %ebx
+  802be2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t head = r->r_head;
+  802be5:	8b 33                	mov    (%ebx),%esi
+
+	if (head - r->r_tail == r->r_nslots)
+  802be7:	8b 43 40             	mov    0x40(%ebx),%eax
+  802bea:	89 f2                	mov    %esi,%edx
+  802bec:	29 c2                	sub    %eax,%edx
+		return 0;
+  802bee:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (head - r->r_tail == r->r_nslots)
+  802bf3:	3b 93 80 00 00 00    	cmp    0x80(%ebx),%edx
+  802bf9:	74 35                	je     802c30 <ring_put+0x53>
+	barrier();
+	memcpy(r->r_data + (head & (r->r_nslots - 1)) * r->r_msgsize, msg,
+  802bfb:	8b 93 84 00 00 00    	mov    0x84(%ebx),%edx
+  802c01:	83 ec 04             	sub    $0x4,%esp
+  802c04:	52                   	push   %edx
+  802c05:	ff 75 0c             	push   0xc(%ebp)
+  802c08:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  802c0e:	83 e8 01             	sub    $0x1,%eax
+  802c11:	21 f0                	and    %esi,%eax
+  802c13:	0f af c2             	imul   %edx,%eax
+  802c16:	8d 84 03 c0 00 00 00 	lea    0xc0(%ebx,%eax,1),%eax
+  802c1d:	50                   	push   %eax
+  802c1e:	e8 8b df ff ff       	call   800bae <memcpy>
+	       r->r_msgsize);
+	barrier();
+	r->r_head = head + 1;
+  802c23:	83 c6 01             	add    $0x1,%esi
+  802c26:	89 33                	mov    %esi,(%ebx)
+	return 1;
+  802c28:	83 c4 10             	add    $0x10,%esp
+  802c2b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802c30:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c33:	5b                   	pop    %ebx
+  802c34:	5e                   	pop    %esi
+  802c35:	5d                   	pop    %ebp
+  802c36:	c3                   	ret
+
+00802c37 <ring_get>:
+// Take the oldest message off the ring, copying it to 'msg'.
+// Returns 1 on success, 0 if the ring is empty.
+//
+bool
+ring_get(struct ring *r, void *msg)
+{
+  802c37:	55                   	push   %ebp
+  802c38:	89 e5                	mov    %esp,%ebp
+  802c3a:	56                   	push   %esi
+  802c3b:	53                   	push   %ebx
+  802c3c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t tail = r->r_tail;
+  802c3f:	8b 73 40             	mov    0x40(%ebx),%esi
+
+	if (r->r_head == tail)
+  802c42:	8b 13                	mov    (%ebx),%edx
+		return 0;
+  802c44:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (r->r_head == tail)
+  802c49:	39 f2                	cmp    %esi,%edx
+  802c4b:	74 36                	je     802c83 <ring_get+0x4c>
+	barrier();
+	memcpy(msg, r->r_data + (tail & (r->r_nslots - 1)) * r->r_msgsize,
+  802c4d:	8b 93 84 00 00 00    	mov    0x84(%ebx),%edx
+  802c53:	83 ec 04             	sub    $0x4,%esp
+  802c56:	52                   	push   %edx
+  802c57:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  802c5d:	83 e8 01             	sub    $0x1,%eax
+  802c60:	21 f0                	and    %esi,%eax
+  802c62:	0f af c2             	imul   %edx,%eax
+  802c65:	8d 84 03 c0 00 00 00 	lea    0xc0(%ebx,%eax,1),%eax
+  802c6c:	50                   	push   %eax
+  802c6d:	ff 75 0c             	push   0xc(%ebp)
+  802c70:	e8 39 df ff ff       	call   800bae <memcpy>
+	       r->r_msgsize);
+	barrier();
+	r->r_tail = tail + 1;
+  802c75:	83 c6 01             	add    $0x1,%esi
+  802c78:	89 73 40             	mov    %esi,0x40(%ebx)
+	return 1;
+  802c7b:	83 c4 10             	add    $0x10,%esp
+  802c7e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802c83:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c86:	5b                   	pop    %ebx
+  802c87:	5e                   	pop    %esi
+  802c88:	5d                   	pop    %ebp
+  802c89:	c3                   	ret
+
+00802c8a <ring_send>:
+
+// Blocking forms: yield the CPU until there is room or a message.
+
+void
+ring_send(struct ring *r, const void *msg)
+{
+  802c8a:	55                   	push   %ebp
+  802c8b:	89 e5                	mov    %esp,%ebp
+  802c8d:	56                   	push   %esi
+  802c8e:	53                   	push   %ebx
+  802c8f:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c92:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	while (!ring_put(r, msg))
+  802c95:	eb 05                	jmp    802c9c <ring_send+0x12>
+		sys_yield();
+  802c97:	e8 71 e8 ff ff       	call   80150d <sys_yield>
+	while (!ring_put(r, msg))
+  802c9c:	83 ec 08             	sub    $0x8,%esp
+  802c9f:	53                   	push   %ebx
+  802ca0:	56                   	push   %esi
+  802ca1:	e8 37 ff ff ff       	call   802bdd <ring_put>
+  802ca6:	83 c4 10             	add    $0x10,%esp
+  802ca9:	84 c0                	test   %al,%al
+  802cab:	74 ea                	je     802c97 <ring_send+0xd>
+}
+  802cad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cb0:	5b                   	pop    %ebx
+  802cb1:	5e                   	pop    %esi
+  802cb2:	5d                   	pop    %ebp
+  802cb3:	c3                   	ret
+
+00802cb4 <ring_recv>:
+
+void
+ring_recv(struct ring *r, void *msg)
+{
+  802cb4:	55                   	push   %ebp
+  802cb5:	89 e5                	mov    %esp,%ebp
+  802cb7:	56                   	push   %esi
+  802cb8:	53                   	push   %ebx
+  802cb9:	8b 75 08             	mov    0x8(%ebp),%esi
+  802cbc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	while (!ring_get(r, msg))
+  802cbf:	eb 05                	jmp    802cc6 <ring_recv+0x12>
+		sys_yield();
+  802cc1:	e8 47 e8 ff ff       	call   80150d <sys_yield>
+	while (!ring_get(r, msg))
+  802cc6:	83 ec 08             	sub    $0x8,%esp
+  802cc9:	53                   	push   %ebx
+  802cca:	56                   	push   %esi
+  802ccb:	e8 67 ff ff ff       	call   802c37 <ring_get>
+  802cd0:	83 c4 10             	add    $0x10,%esp
+  802cd3:	84 c0                	test   %al,%al
+  802cd5:	74 ea                	je     802cc1 <ring_recv+0xd>
+}
+  802cd7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cda:	5b                   	pop    %ebx
+  802cdb:	5e                   	pop    %esi
+  802cdc:	5d                   	pop    %ebp
+  802cdd:	c3                   	ret
+
+00802cde <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802cde:	55                   	push   %ebp
+  802cdf:	89 e5                	mov    %esp,%ebp
+  802ce1:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  802ce4:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  802ceb:	74 0a                	je     802cf7 <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  802ced:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cf0:	a3 0c 40 80 00       	mov    %eax,0x80400c
+}
+  802cf5:	c9                   	leave
+  802cf6:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE),
+  802cf7:	83 ec 04             	sub    $0x4,%esp
+  802cfa:	6a 07                	push   $0x7
+  802cfc:	68 00 f0 bf ee       	push   $0xeebff000
+  802d01:	6a 00                	push   $0x0
+  802d03:	e8 f3 e4 ff ff       	call   8011fb <sys_page_alloc>
+  802d08:	83 c4 10             	add    $0x10,%esp
+  802d0b:	85 c0                	test   %eax,%eax
+  802d0d:	78 28                	js     802d37 <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  802d0f:	83 ec 08             	sub    $0x8,%esp
+  802d12:	68 49 2d 80 00       	push   $0x802d49
+  802d17:	6a 00                	push   $0x0
+  802d19:	e8 9c eb ff ff       	call   8018ba <sys_env_set_pgfault_upcall>
+  802d1e:	83 c4 10             	add    $0x10,%esp
+  802d21:	85 c0                	test   %eax,%eax
+  802d23:	79 c8                	jns    802ced <set_pgfault_handler+0xf>
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+  802d25:	50                   	push   %eax
+  802d26:	68 00 34 80 00       	push   $0x803400
+  802d2b:	6a 24                	push   $0x24
+  802d2d:	68 34 34 80 00       	push   $0x803434
+  802d32:	e8 8d d5 ff ff       	call   8002c4 <_panic>
+			panic("set_pgfault_handler: sys_page_alloc: %e", r);
+  802d37:	50                   	push   %eax
+  802d38:	68 d8 33 80 00       	push   $0x8033d8
+  802d3d:	6a 22                	push   $0x22
+  802d3f:	68 34 34 80 00       	push   $0x803434
+  802d44:	e8 7b d5 ff ff       	call   8002c4 <_panic>
+
+00802d49 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802d49:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802d4a:	a1 0c 40 80 00       	mov    0x80400c,%eax
+	call *%eax
+  802d4f:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802d51:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 0x28(%esp), %ebx		// trap-time eip
+  802d54:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl 0x30(%esp), %eax		// trap-time esp
+  802d58:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  802d5c:	83 e8 04             	sub    $0x4,%eax
+	movl %ebx, (%eax)
+  802d5f:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 0x30(%esp)
+  802d61:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp			// skip fault_va and err
+  802d65:	83 c4 08             	add    $0x8,%esp
+	popal
+  802d68:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp			// skip eip
+  802d69:	83 c4 04             	add    $0x4,%esp
+	popfl
+  802d6c:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802d6d:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802d6e:	c3                   	ret
+
+00802d6f <dm>:
+  802d6f:	55                   	push   %ebp
+  802d70:	57                   	push   %edi
+  802d71:	56                   	push   %esi
+  802d72:	53                   	push   %ebx
+  802d73:	83 ec 24             	sub    $0x24,%esp
+  802d76:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802d7a:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802d7e:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802d82:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802d86:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802d8a:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802d8e:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802d92:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d97:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d9c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802da1:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802da8:	00 
+  802da9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802db0:	00 
+  802db1:	89 fb                	mov    %edi,%ebx
+  802db3:	eb 08                	jmp    802dbd <dm+0x4e>
+  802db5:	83 e9 01             	sub    $0x1,%ecx
+  802db8:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802dbb:	74 68                	je     802e25 <dm+0xb6>
+  802dbd:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802dc1:	01 c0                	add    %eax,%eax
+  802dc3:	89 c6                	mov    %eax,%esi
+  802dc5:	89 d7                	mov    %edx,%edi
+  802dc7:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802dcb:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802dcf:	0f ad d0             	shrd   %cl,%edx,%eax
+  802dd2:	d3 ea                	shr    %cl,%edx
+  802dd4:	f6 c1 20             	test   $0x20,%cl
+  802dd7:	74 04                	je     802ddd <dm+0x6e>
+  802dd9:	89 d0                	mov    %edx,%eax
+  802ddb:	31 d2                	xor    %edx,%edx
+  802ddd:	83 e0 01             	and    $0x1,%eax
+  802de0:	89 04 24             	mov    %eax,(%esp)
+  802de3:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802dea:	00 
+  802deb:	8b 04 24             	mov    (%esp),%eax
+  802dee:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802df2:	09 f0                	or     %esi,%eax
+  802df4:	09 fa                	or     %edi,%edx
+  802df6:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802dfa:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802dfe:	39 f0                	cmp    %esi,%eax
+  802e00:	89 d5                	mov    %edx,%ebp
+  802e02:	19 fd                	sbb    %edi,%ebp
+  802e04:	72 af                	jb     802db5 <dm+0x46>
+  802e06:	29 f0                	sub    %esi,%eax
+  802e08:	19 fa                	sbb    %edi,%edx
+  802e0a:	89 cf                	mov    %ecx,%edi
+  802e0c:	c1 ef 05             	shr    $0x5,%edi
+  802e0f:	83 e7 01             	and    $0x1,%edi
+  802e12:	89 fe                	mov    %edi,%esi
+  802e14:	83 f6 01             	xor    $0x1,%esi
+  802e17:	d3 e6                	shl    %cl,%esi
+  802e19:	d3 e7                	shl    %cl,%edi
+  802e1b:	09 74 24 18          	or     %esi,0x18(%esp)
+  802e1f:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802e23:	eb 90                	jmp    802db5 <dm+0x46>
+  802e25:	85 db                	test   %ebx,%ebx
+  802e27:	74 05                	je     802e2e <dm+0xbf>
+  802e29:	89 03                	mov    %eax,(%ebx)
+  802e2b:	89 53 04             	mov    %edx,0x4(%ebx)
+  802e2e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802e32:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802e36:	83 c4 24             	add    $0x24,%esp
+  802e39:	5b                   	pop    %ebx
+  802e3a:	5e                   	pop    %esi
+  802e3b:	5f                   	pop    %edi
+  802e3c:	5d                   	pop    %ebp
+  802e3d:	c3                   	ret
+
+00802e3e <__udivdi3>:
+  802e3e:	83 ec 08             	sub    $0x8,%esp
+  802e41:	6a 00                	push   $0x0
+  802e43:	ff 74 24 1c          	push   0x1c(%esp)
+  802e47:	ff 74 24 1c          	push   0x1c(%esp)
+  802e4b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802e4f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802e53:	e8 17 ff ff ff       	call   802d6f <dm>
+  802e58:	83 c4 14             	add    $0x14,%esp
+  802e5b:	c3                   	ret
+
+00802e5c <__umoddi3>:
+  802e5c:	83 ec 18             	sub    $0x18,%esp
+  802e5f:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802e63:	50                   	push   %eax
+  802e64:	ff 74 24 2c          	push   0x2c(%esp)
+  802e68:	ff 74 24 2c          	push   0x2c(%esp)
+  802e6c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e70:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e74:	e8 f6 fe ff ff       	call   802d6f <dm>
+  802e79:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802e7d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802e81:	83 c4 24             	add    $0x24,%esp
+  802e84:	c3                   	ret
+
+00802e85 <__divdi3>:
+  802e85:	53                   	push   %ebx
+  802e86:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802e8a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802e8e:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  802e92:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  802e96:	85 d2                	test   %edx,%edx
+  802e98:	78 15                	js     802eaf <__divdi3+0x2a>
+  802e9a:	85 db                	test   %ebx,%ebx
+  802e9c:	78 34                	js     802ed2 <__divdi3+0x4d>
+  802e9e:	83 ec 04             	sub    $0x4,%esp
+  802ea1:	6a 00                	push   $0x0
+  802ea3:	53                   	push   %ebx
+  802ea4:	51                   	push   %ecx
+  802ea5:	e8 c5 fe ff ff       	call   802d6f <dm>
+  802eaa:	83 c4 10             	add    $0x10,%esp
+  802ead:	eb 21                	jmp    802ed0 <__divdi3+0x4b>
+  802eaf:	f7 d8                	neg    %eax
+  802eb1:	83 d2 00             	adc    $0x0,%edx
+  802eb4:	f7 da                	neg    %edx
+  802eb6:	85 db                	test   %ebx,%ebx
+  802eb8:	78 30                	js     802eea <__divdi3+0x65>
+  802eba:	83 ec 04             	sub    $0x4,%esp
+  802ebd:	6a 00                	push   $0x0
+  802ebf:	53                   	push   %ebx
+  802ec0:	51                   	push   %ecx
+  802ec1:	e8 a9 fe ff ff       	call   802d6f <dm>
+  802ec6:	83 c4 10             	add    $0x10,%esp
+  802ec9:	f7 d8                	neg    %eax
+  802ecb:	83 d2 00             	adc    $0x0,%edx
+  802ece:	f7 da                	neg    %edx
+  802ed0:	5b                   	pop    %ebx
+  802ed1:	c3                   	ret
+  802ed2:	83 ec 04             	sub    $0x4,%esp
+  802ed5:	6a 00                	push   $0x0
+  802ed7:	f7 d9                	neg    %ecx
+  802ed9:	83 d3 00             	adc    $0x0,%ebx
+  802edc:	f7 db                	neg    %ebx
+  802ede:	53                   	push   %ebx
+  802edf:	51                   	push   %ecx
+  802ee0:	e8 8a fe ff ff       	call   802d6f <dm>
+  802ee5:	83 c4 10             	add    $0x10,%esp
+  802ee8:	eb df                	jmp    802ec9 <__divdi3+0x44>
+  802eea:	83 ec 04             	sub    $0x4,%esp
+  802eed:	6a 00                	push   $0x0
+  802eef:	f7 d9                	neg    %ecx
+  802ef1:	83 d3 00             	adc    $0x0,%ebx
+  802ef4:	f7 db                	neg    %ebx
+  802ef6:	53                   	push   %ebx
+  802ef7:	51                   	push   %ecx
+  802ef8:	e8 72 fe ff ff       	call   802d6f <dm>
+  802efd:	83 c4 10             	add    $0x10,%esp
+  802f00:	eb ce                	jmp    802ed0 <__divdi3+0x4b>
+
+00802f02 <__moddi3>:
+  802f02:	55                   	push   %ebp
+  802f03:	57                   	push   %edi
+  802f04:	56                   	push   %esi
+  802f05:	53                   	push   %ebx
+  802f06:	83 ec 18             	sub    $0x18,%esp
+  802f09:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802f0d:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802f11:	89 f1                	mov    %esi,%ecx
+  802f13:	f7 d9                	neg    %ecx
+  802f15:	89 da                	mov    %ebx,%edx
+  802f17:	83 d2 00             	adc    $0x0,%edx
+  802f1a:	f7 da                	neg    %edx
+  802f1c:	0f 48 ce             	cmovs  %esi,%ecx
+  802f1f:	0f 48 d3             	cmovs  %ebx,%edx
+  802f22:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802f26:	50                   	push   %eax
+  802f27:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802f2b:	f7 de                	neg    %esi
+  802f2d:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802f31:	83 d0 00             	adc    $0x0,%eax
+  802f34:	f7 d8                	neg    %eax
+  802f36:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802f3b:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802f40:	50                   	push   %eax
+  802f41:	56                   	push   %esi
+  802f42:	89 c8                	mov    %ecx,%eax
+  802f44:	e8 26 fe ff ff       	call   802d6f <dm>
+  802f49:	83 c4 10             	add    $0x10,%esp
+  802f4c:	85 db                	test   %ebx,%ebx
+  802f4e:	78 10                	js     802f60 <__moddi3+0x5e>
+  802f50:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802f54:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802f58:	83 c4 14             	add    $0x14,%esp
+  802f5b:	5b                   	pop    %ebx
+  802f5c:	5e                   	pop    %esi
+  802f5d:	5f                   	pop    %edi
+  802f5e:	5d                   	pop    %ebp
+  802f5f:	c3                   	ret
+  802f60:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802f64:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802f68:	f7 d8                	neg    %eax
+  802f6a:	83 d2 00             	adc    $0x0,%edx
+  802f6d:	f7 da                	neg    %edx
+  802f6f:	eb e7                	jmp    802f58 <__moddi3+0x56>
@@ -0,0 +1,5031 @@
+
+obj/user/softint:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 05 00 00 00       	call   800036 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	asm volatile("int $14");	// page fault
+  800033:	cd 0e                	int    $0xe
+}
+  800035:	c3                   	ret
+
+00800036 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800036:	55                   	push   %ebp
+  800037:	89 e5                	mov    %esp,%ebp
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  800041:	e8 9d 04 00 00       	call   8004e3 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  800046:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80004b:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  800051:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800056:	a3 08 30 80 00       	mov    %eax,0x803008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80005b:	85 db                	test   %ebx,%ebx
+  80005d:	7e 07                	jle    800066 <libmain+0x30>
+		binaryname = argv[0];
+  80005f:	8b 06                	mov    (%esi),%eax
+  800061:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  800066:	83 ec 08             	sub    $0x8,%esp
+  800069:	56                   	push   %esi
+  80006a:	53                   	push   %ebx
+  80006b:	e8 c3 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800070:	e8 0a 00 00 00       	call   80007f <exit>
+}
+  800075:	83 c4 10             	add    $0x10,%esp
+  800078:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80007b:	5b                   	pop    %ebx
+  80007c:	5e                   	pop    %esi
+  80007d:	5d                   	pop    %ebp
+  80007e:	c3                   	ret
+
+0080007f <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80007f:	55                   	push   %ebp
+  800080:	89 e5                	mov    %esp,%ebp
+  800082:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  800085:	6a 00                	push   $0x0
+  800087:	e8 95 03 00 00       	call   800421 <sys_env_destroy>
+}
+  80008c:	83 c4 10             	add    $0x10,%esp
+  80008f:	c9                   	leave
+  800090:	c3                   	ret
+
+00800091 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800091:	55                   	push   %ebp
+  800092:	89 e5                	mov    %esp,%ebp
+  800094:	57                   	push   %edi
+  800095:	56                   	push   %esi
+  800096:	53                   	push   %ebx
+  800097:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  80009d:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  8000a3:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  8000a9:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  8000af:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  8000b6:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  8000b9:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  8000c0:	00 00 00 
+		if (num == SYS_page_map_vec)
+  8000c3:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  8000ca:	74 76                	je     800142 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  8000cc:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  8000d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8000d5:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  8000db:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8000e2:	0f 88 06 01 00 00    	js     8001ee <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  8000e8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8000ef:	0f 84 48 01 00 00    	je     80023d <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  8000f5:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  8000fb:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800101:	be 00 00 00 00       	mov    $0x0,%esi
+  800106:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  80010c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80010f:	55                   	push   %ebp
+  800110:	68 19 01 80 00       	push   $0x800119
+  800115:	89 e5                	mov    %esp,%ebp
+  800117:	0f 34                	sysenter
+  800119:	83 c4 04             	add    $0x4,%esp
+  80011c:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  80011d:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800123:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800129:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  80012c:	0f 85 9a 01 00 00    	jne    8002cc <page_vec_call+0x23b>
+  800132:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800137:	8b 75 08             	mov    0x8(%ebp),%esi
+  80013a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80013d:	e9 29 01 00 00       	jmp    80026b <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800142:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800148:	8b 45 08             	mov    0x8(%ebp),%eax
+  80014b:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  80014d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800154:	78 2f                	js     800185 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800156:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80015d:	74 72                	je     8001d1 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  80015f:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800165:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  80016b:	b8 10 00 00 00       	mov    $0x10,%eax
+  800170:	89 fb                	mov    %edi,%ebx
+  800172:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800175:	55                   	push   %ebp
+  800176:	68 7f 01 80 00       	push   $0x80017f
+  80017b:	89 e5                	mov    %esp,%ebp
+  80017d:	0f 34                	sysenter
+  80017f:	83 c4 04             	add    $0x4,%esp
+  800182:	5d                   	pop    %ebp
+	return ret;
+  800183:	eb 98                	jmp    80011d <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800185:	b8 01 00 00 00       	mov    $0x1,%eax
+  80018a:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  80018c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800191:	f6 c6 08             	test   $0x8,%dh
+  800194:	74 15                	je     8001ab <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800196:	89 c2                	mov    %eax,%edx
+  800198:	c1 ea 08             	shr    $0x8,%edx
+  80019b:	83 e2 0f             	and    $0xf,%edx
+  80019e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8001a3:	83 fa 06             	cmp    $0x6,%edx
+  8001a6:	74 0e                	je     8001b6 <page_vec_call+0x125>
+  8001a8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8001ab:	0f b6 c9             	movzbl %cl,%ecx
+  8001ae:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8001b4:	eb a0                	jmp    800156 <page_vec_call+0xc5>
+  8001b6:	89 c2                	mov    %eax,%edx
+  8001b8:	c1 ea 04             	shr    $0x4,%edx
+  8001bb:	83 e2 0f             	and    $0xf,%edx
+  8001be:	83 fa 02             	cmp    $0x2,%edx
+  8001c1:	77 e5                	ja     8001a8 <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  8001c3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8001c6:	83 f8 02             	cmp    $0x2,%eax
+  8001c9:	0f 97 c1             	seta   %cl
+  8001cc:	0f b6 c9             	movzbl %cl,%ecx
+  8001cf:	eb d7                	jmp    8001a8 <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  8001d1:	b8 10 00 00 00       	mov    $0x10,%eax
+  8001d6:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  8001dc:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  8001e2:	89 fb                	mov    %edi,%ebx
+  8001e4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8001e7:	cd 30                	int    $0x30
+  8001e9:	e9 2f ff ff ff       	jmp    80011d <page_vec_call+0x8c>
+  8001ee:	b8 01 00 00 00       	mov    $0x1,%eax
+  8001f3:	0f a2                	cpuid
+		return 0;
+  8001f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8001fa:	f6 c6 08             	test   $0x8,%dh
+  8001fd:	74 15                	je     800214 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8001ff:	89 c2                	mov    %eax,%edx
+  800201:	c1 ea 08             	shr    $0x8,%edx
+  800204:	83 e2 0f             	and    $0xf,%edx
+  800207:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80020c:	83 fa 06             	cmp    $0x6,%edx
+  80020f:	74 11                	je     800222 <page_vec_call+0x191>
+  800211:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800214:	0f b6 c9             	movzbl %cl,%ecx
+  800217:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80021d:	e9 c6 fe ff ff       	jmp    8000e8 <page_vec_call+0x57>
+  800222:	89 c2                	mov    %eax,%edx
+  800224:	c1 ea 04             	shr    $0x4,%edx
+  800227:	83 e2 0f             	and    $0xf,%edx
+  80022a:	83 fa 02             	cmp    $0x2,%edx
+  80022d:	77 e2                	ja     800211 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  80022f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800232:	83 f8 02             	cmp    $0x2,%eax
+  800235:	0f 97 c1             	seta   %cl
+  800238:	0f b6 c9             	movzbl %cl,%ecx
+  80023b:	eb d4                	jmp    800211 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  80023d:	be 00 00 00 00       	mov    $0x0,%esi
+  800242:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800248:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  80024e:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800254:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800257:	cd 30                	int    $0x30
+  800259:	e9 bf fe ff ff       	jmp    80011d <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  80025e:	29 da                	sub    %ebx,%edx
+			vec++;
+  800260:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800263:	83 e8 01             	sub    $0x1,%eax
+  800266:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  80026b:	85 c0                	test   %eax,%eax
+  80026d:	74 58                	je     8002c7 <page_vec_call+0x236>
+  80026f:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800272:	39 da                	cmp    %ebx,%edx
+  800274:	73 e8                	jae    80025e <page_vec_call+0x1cd>
+  800276:	89 75 08             	mov    %esi,0x8(%ebp)
+  800279:	89 45 0c             	mov    %eax,0xc(%ebp)
+  80027c:	84 c9                	test   %cl,%cl
+  80027e:	74 06                	je     800286 <page_vec_call+0x1f5>
+  800280:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800286:	83 ec 04             	sub    $0x4,%esp
+  800289:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80028c:	c1 e0 04             	shl    $0x4,%eax
+  80028f:	50                   	push   %eax
+  800290:	ff 75 08             	push   0x8(%ebp)
+  800293:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800299:	53                   	push   %ebx
+  80029a:	e8 41 21 00 00       	call   8023e0 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  80029f:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  8002a5:	89 c2                	mov    %eax,%edx
+  8002a7:	c1 e2 0c             	shl    $0xc,%edx
+  8002aa:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  8002b0:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  8002b6:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  8002bc:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  8002bf:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  8002c2:	e9 f2 fd ff ff       	jmp    8000b9 <page_vec_call+0x28>
+			r = 0;
+  8002c7:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  8002cc:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8002d0:	74 0b                	je     8002dd <page_vec_call+0x24c>
+		*done = total;
+  8002d2:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002d5:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  8002db:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  8002dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002e0:	5b                   	pop    %ebx
+  8002e1:	5e                   	pop    %esi
+  8002e2:	5f                   	pop    %edi
+  8002e3:	5d                   	pop    %ebp
+  8002e4:	c3                   	ret
+
+008002e5 <sys_cputs>:
+{
+  8002e5:	55                   	push   %ebp
+  8002e6:	89 e5                	mov    %esp,%ebp
+  8002e8:	57                   	push   %edi
+  8002e9:	56                   	push   %esi
+  8002ea:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8002eb:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8002f2:	78 2d                	js     800321 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  8002f4:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8002fb:	74 70                	je     80036d <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  8002fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800302:	8b 55 08             	mov    0x8(%ebp),%edx
+  800305:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800308:	89 c3                	mov    %eax,%ebx
+  80030a:	89 c7                	mov    %eax,%edi
+  80030c:	89 c6                	mov    %eax,%esi
+  80030e:	55                   	push   %ebp
+  80030f:	68 18 03 80 00       	push   $0x800318
+  800314:	89 e5                	mov    %esp,%ebp
+  800316:	0f 34                	sysenter
+  800318:	83 c4 04             	add    $0x4,%esp
+  80031b:	5d                   	pop    %ebp
+}
+  80031c:	5b                   	pop    %ebx
+  80031d:	5e                   	pop    %esi
+  80031e:	5f                   	pop    %edi
+  80031f:	5d                   	pop    %ebp
+  800320:	c3                   	ret
+  800321:	b8 01 00 00 00       	mov    $0x1,%eax
+  800326:	0f a2                	cpuid
+		return 0;
+  800328:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80032d:	f6 c6 08             	test   $0x8,%dh
+  800330:	74 15                	je     800347 <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800332:	89 c2                	mov    %eax,%edx
+  800334:	c1 ea 08             	shr    $0x8,%edx
+  800337:	83 e2 0f             	and    $0xf,%edx
+  80033a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80033f:	83 fa 06             	cmp    $0x6,%edx
+  800342:	74 0e                	je     800352 <sys_cputs+0x6d>
+  800344:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800347:	0f b6 c9             	movzbl %cl,%ecx
+  80034a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800350:	eb a2                	jmp    8002f4 <sys_cputs+0xf>
+  800352:	89 c2                	mov    %eax,%edx
+  800354:	c1 ea 04             	shr    $0x4,%edx
+  800357:	83 e2 0f             	and    $0xf,%edx
+  80035a:	83 fa 02             	cmp    $0x2,%edx
+  80035d:	77 e5                	ja     800344 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  80035f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800362:	83 f8 02             	cmp    $0x2,%eax
+  800365:	0f 97 c1             	seta   %cl
+  800368:	0f b6 c9             	movzbl %cl,%ecx
+  80036b:	eb d7                	jmp    800344 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  80036d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800372:	8b 55 08             	mov    0x8(%ebp),%edx
+  800375:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800378:	89 c3                	mov    %eax,%ebx
+  80037a:	89 c7                	mov    %eax,%edi
+  80037c:	89 c6                	mov    %eax,%esi
+  80037e:	cd 30                	int    $0x30
+}
+  800380:	eb 9a                	jmp    80031c <sys_cputs+0x37>
+
+00800382 <sys_cgetc>:
+{
+  800382:	55                   	push   %ebp
+  800383:	89 e5                	mov    %esp,%ebp
+  800385:	57                   	push   %edi
+  800386:	56                   	push   %esi
+  800387:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800388:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80038f:	78 2e                	js     8003bf <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  800391:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800398:	74 71                	je     80040b <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  80039a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80039f:	b8 01 00 00 00       	mov    $0x1,%eax
+  8003a4:	89 d1                	mov    %edx,%ecx
+  8003a6:	89 d3                	mov    %edx,%ebx
+  8003a8:	89 d7                	mov    %edx,%edi
+  8003aa:	89 d6                	mov    %edx,%esi
+  8003ac:	55                   	push   %ebp
+  8003ad:	68 b6 03 80 00       	push   $0x8003b6
+  8003b2:	89 e5                	mov    %esp,%ebp
+  8003b4:	0f 34                	sysenter
+  8003b6:	83 c4 04             	add    $0x4,%esp
+  8003b9:	5d                   	pop    %ebp
+}
+  8003ba:	5b                   	pop    %ebx
+  8003bb:	5e                   	pop    %esi
+  8003bc:	5f                   	pop    %edi
+  8003bd:	5d                   	pop    %ebp
+  8003be:	c3                   	ret
+  8003bf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8003c4:	0f a2                	cpuid
+		return 0;
+  8003c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8003cb:	f6 c6 08             	test   $0x8,%dh
+  8003ce:	74 15                	je     8003e5 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8003d0:	89 c2                	mov    %eax,%edx
+  8003d2:	c1 ea 08             	shr    $0x8,%edx
+  8003d5:	83 e2 0f             	and    $0xf,%edx
+  8003d8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8003dd:	83 fa 06             	cmp    $0x6,%edx
+  8003e0:	74 0e                	je     8003f0 <sys_cgetc+0x6e>
+  8003e2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8003e5:	0f b6 c9             	movzbl %cl,%ecx
+  8003e8:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8003ee:	eb a1                	jmp    800391 <sys_cgetc+0xf>
+  8003f0:	89 c2                	mov    %eax,%edx
+  8003f2:	c1 ea 04             	shr    $0x4,%edx
+  8003f5:	83 e2 0f             	and    $0xf,%edx
+  8003f8:	83 fa 02             	cmp    $0x2,%edx
+  8003fb:	77 e5                	ja     8003e2 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  8003fd:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800400:	83 f8 02             	cmp    $0x2,%eax
+  800403:	0f 97 c1             	seta   %cl
+  800406:	0f b6 c9             	movzbl %cl,%ecx
+  800409:	eb d7                	jmp    8003e2 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  80040b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800410:	b8 01 00 00 00       	mov    $0x1,%eax
+  800415:	89 d1                	mov    %edx,%ecx
+  800417:	89 d3                	mov    %edx,%ebx
+  800419:	89 d7                	mov    %edx,%edi
+  80041b:	89 d6                	mov    %edx,%esi
+  80041d:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  80041f:	eb 99                	jmp    8003ba <sys_cgetc+0x38>
+
+00800421 <sys_env_destroy>:
+{
+  800421:	55                   	push   %ebp
+  800422:	89 e5                	mov    %esp,%ebp
+  800424:	57                   	push   %edi
+  800425:	56                   	push   %esi
+  800426:	53                   	push   %ebx
+  800427:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80042a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800431:	78 36                	js     800469 <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  800433:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80043a:	74 79                	je     8004b5 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  80043c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80043f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800444:	b8 03 00 00 00       	mov    $0x3,%eax
+  800449:	89 cb                	mov    %ecx,%ebx
+  80044b:	89 cf                	mov    %ecx,%edi
+  80044d:	89 ce                	mov    %ecx,%esi
+  80044f:	55                   	push   %ebp
+  800450:	68 59 04 80 00       	push   $0x800459
+  800455:	89 e5                	mov    %esp,%ebp
+  800457:	0f 34                	sysenter
+  800459:	83 c4 04             	add    $0x4,%esp
+  80045c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80045d:	85 c0                	test   %eax,%eax
+  80045f:	7f 6b                	jg     8004cc <sys_env_destroy+0xab>
+}
+  800461:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800464:	5b                   	pop    %ebx
+  800465:	5e                   	pop    %esi
+  800466:	5f                   	pop    %edi
+  800467:	5d                   	pop    %ebp
+  800468:	c3                   	ret
+  800469:	b8 01 00 00 00       	mov    $0x1,%eax
+  80046e:	0f a2                	cpuid
+		return 0;
+  800470:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800475:	f6 c6 08             	test   $0x8,%dh
+  800478:	74 15                	je     80048f <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80047a:	89 c2                	mov    %eax,%edx
+  80047c:	c1 ea 08             	shr    $0x8,%edx
+  80047f:	83 e2 0f             	and    $0xf,%edx
+  800482:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800487:	83 fa 06             	cmp    $0x6,%edx
+  80048a:	74 0e                	je     80049a <sys_env_destroy+0x79>
+  80048c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80048f:	0f b6 c9             	movzbl %cl,%ecx
+  800492:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800498:	eb 99                	jmp    800433 <sys_env_destroy+0x12>
+  80049a:	89 c2                	mov    %eax,%edx
+  80049c:	c1 ea 04             	shr    $0x4,%edx
+  80049f:	83 e2 0f             	and    $0xf,%edx
+  8004a2:	83 fa 02             	cmp    $0x2,%edx
+  8004a5:	77 e5                	ja     80048c <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  8004a7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8004aa:	83 f8 02             	cmp    $0x2,%eax
+  8004ad:	0f 97 c1             	seta   %cl
+  8004b0:	0f b6 c9             	movzbl %cl,%ecx
+  8004b3:	eb d7                	jmp    80048c <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  8004b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004ba:	b8 03 00 00 00       	mov    $0x3,%eax
+  8004bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004c2:	89 cb                	mov    %ecx,%ebx
+  8004c4:	89 cf                	mov    %ecx,%edi
+  8004c6:	89 ce                	mov    %ecx,%esi
+  8004c8:	cd 30                	int    $0x30
+  8004ca:	eb 91                	jmp    80045d <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004cc:	83 ec 0c             	sub    $0xc,%esp
+  8004cf:	50                   	push   %eax
+  8004d0:	6a 03                	push   $0x3
+  8004d2:	68 aa 27 80 00       	push   $0x8027aa
+  8004d7:	6a 4a                	push   $0x4a
+  8004d9:	68 c7 27 80 00       	push   $0x8027c7
+  8004de:	e8 1e 17 00 00       	call   801c01 <_panic>
+
+008004e3 <sys_getenvid>:
+{
+  8004e3:	55                   	push   %ebp
+  8004e4:	89 e5                	mov    %esp,%ebp
+  8004e6:	57                   	push   %edi
+  8004e7:	56                   	push   %esi
+  8004e8:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8004e9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8004f0:	78 2e                	js     800520 <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  8004f2:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8004f9:	74 71                	je     80056c <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  8004fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800500:	b8 02 00 00 00       	mov    $0x2,%eax
+  800505:	89 d1                	mov    %edx,%ecx
+  800507:	89 d3                	mov    %edx,%ebx
+  800509:	89 d7                	mov    %edx,%edi
+  80050b:	89 d6                	mov    %edx,%esi
+  80050d:	55                   	push   %ebp
+  80050e:	68 17 05 80 00       	push   $0x800517
+  800513:	89 e5                	mov    %esp,%ebp
+  800515:	0f 34                	sysenter
+  800517:	83 c4 04             	add    $0x4,%esp
+  80051a:	5d                   	pop    %ebp
+}
+  80051b:	5b                   	pop    %ebx
+  80051c:	5e                   	pop    %esi
+  80051d:	5f                   	pop    %edi
+  80051e:	5d                   	pop    %ebp
+  80051f:	c3                   	ret
+  800520:	b8 01 00 00 00       	mov    $0x1,%eax
+  800525:	0f a2                	cpuid
+		return 0;
+  800527:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80052c:	f6 c6 08             	test   $0x8,%dh
+  80052f:	74 15                	je     800546 <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800531:	89 c2                	mov    %eax,%edx
+  800533:	c1 ea 08             	shr    $0x8,%edx
+  800536:	83 e2 0f             	and    $0xf,%edx
+  800539:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80053e:	83 fa 06             	cmp    $0x6,%edx
+  800541:	74 0e                	je     800551 <sys_getenvid+0x6e>
+  800543:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800546:	0f b6 c9             	movzbl %cl,%ecx
+  800549:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80054f:	eb a1                	jmp    8004f2 <sys_getenvid+0xf>
+  800551:	89 c2                	mov    %eax,%edx
+  800553:	c1 ea 04             	shr    $0x4,%edx
+  800556:	83 e2 0f             	and    $0xf,%edx
+  800559:	83 fa 02             	cmp    $0x2,%edx
+  80055c:	77 e5                	ja     800543 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  80055e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800561:	83 f8 02             	cmp    $0x2,%eax
+  800564:	0f 97 c1             	seta   %cl
+  800567:	0f b6 c9             	movzbl %cl,%ecx
+  80056a:	eb d7                	jmp    800543 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  80056c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800571:	b8 02 00 00 00       	mov    $0x2,%eax
+  800576:	89 d1                	mov    %edx,%ecx
+  800578:	89 d3                	mov    %edx,%ebx
+  80057a:	89 d7                	mov    %edx,%edi
+  80057c:	89 d6                	mov    %edx,%esi
+  80057e:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  800580:	eb 99                	jmp    80051b <sys_getenvid+0x38>
+
+00800582 <sys_page_alloc>:
+{
+  800582:	55                   	push   %ebp
+  800583:	89 e5                	mov    %esp,%ebp
+  800585:	57                   	push   %edi
+  800586:	56                   	push   %esi
+  800587:	53                   	push   %ebx
+  800588:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80058b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800592:	78 38                	js     8005cc <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  800594:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80059b:	74 7b                	je     800618 <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  80059d:	be 00 00 00 00       	mov    $0x0,%esi
+  8005a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005a8:	b8 04 00 00 00       	mov    $0x4,%eax
+  8005ad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005b0:	89 f7                	mov    %esi,%edi
+  8005b2:	55                   	push   %ebp
+  8005b3:	68 bc 05 80 00       	push   $0x8005bc
+  8005b8:	89 e5                	mov    %esp,%ebp
+  8005ba:	0f 34                	sysenter
+  8005bc:	83 c4 04             	add    $0x4,%esp
+  8005bf:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8005c0:	85 c0                	test   %eax,%eax
+  8005c2:	7f 6d                	jg     800631 <sys_page_alloc+0xaf>
+}
+  8005c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005c7:	5b                   	pop    %ebx
+  8005c8:	5e                   	pop    %esi
+  8005c9:	5f                   	pop    %edi
+  8005ca:	5d                   	pop    %ebp
+  8005cb:	c3                   	ret
+  8005cc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8005d1:	0f a2                	cpuid
+		return 0;
+  8005d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8005d8:	f6 c6 08             	test   $0x8,%dh
+  8005db:	74 15                	je     8005f2 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8005dd:	89 c2                	mov    %eax,%edx
+  8005df:	c1 ea 08             	shr    $0x8,%edx
+  8005e2:	83 e2 0f             	and    $0xf,%edx
+  8005e5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8005ea:	83 fa 06             	cmp    $0x6,%edx
+  8005ed:	74 0e                	je     8005fd <sys_page_alloc+0x7b>
+  8005ef:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8005f2:	0f b6 c9             	movzbl %cl,%ecx
+  8005f5:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8005fb:	eb 97                	jmp    800594 <sys_page_alloc+0x12>
+  8005fd:	89 c2                	mov    %eax,%edx
+  8005ff:	c1 ea 04             	shr    $0x4,%edx
+  800602:	83 e2 0f             	and    $0xf,%edx
+  800605:	83 fa 02             	cmp    $0x2,%edx
+  800608:	77 e5                	ja     8005ef <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  80060a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80060d:	83 f8 02             	cmp    $0x2,%eax
+  800610:	0f 97 c1             	seta   %cl
+  800613:	0f b6 c9             	movzbl %cl,%ecx
+  800616:	eb d7                	jmp    8005ef <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  800618:	be 00 00 00 00       	mov    $0x0,%esi
+  80061d:	b8 04 00 00 00       	mov    $0x4,%eax
+  800622:	8b 55 08             	mov    0x8(%ebp),%edx
+  800625:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800628:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80062b:	89 f7                	mov    %esi,%edi
+  80062d:	cd 30                	int    $0x30
+  80062f:	eb 8f                	jmp    8005c0 <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800631:	83 ec 0c             	sub    $0xc,%esp
+  800634:	50                   	push   %eax
+  800635:	6a 04                	push   $0x4
+  800637:	68 aa 27 80 00       	push   $0x8027aa
+  80063c:	6a 4a                	push   $0x4a
+  80063e:	68 c7 27 80 00       	push   $0x8027c7
+  800643:	e8 b9 15 00 00       	call   801c01 <_panic>
+
+00800648 <sys_page_map>:
+{
+  800648:	55                   	push   %ebp
+  800649:	89 e5                	mov    %esp,%ebp
+  80064b:	57                   	push   %edi
+  80064c:	56                   	push   %esi
+  80064d:	53                   	push   %ebx
+  80064e:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800651:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800658:	78 37                	js     800691 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  80065a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800661:	74 7a                	je     8006dd <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  800663:	8b 55 08             	mov    0x8(%ebp),%edx
+  800666:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800669:	b8 05 00 00 00       	mov    $0x5,%eax
+  80066e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800671:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800674:	8b 75 18             	mov    0x18(%ebp),%esi
+  800677:	55                   	push   %ebp
+  800678:	68 81 06 80 00       	push   $0x800681
+  80067d:	89 e5                	mov    %esp,%ebp
+  80067f:	0f 34                	sysenter
+  800681:	83 c4 04             	add    $0x4,%esp
+  800684:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800685:	85 c0                	test   %eax,%eax
+  800687:	7f 6c                	jg     8006f5 <sys_page_map+0xad>
+}
+  800689:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80068c:	5b                   	pop    %ebx
+  80068d:	5e                   	pop    %esi
+  80068e:	5f                   	pop    %edi
+  80068f:	5d                   	pop    %ebp
+  800690:	c3                   	ret
+  800691:	b8 01 00 00 00       	mov    $0x1,%eax
+  800696:	0f a2                	cpuid
+		return 0;
+  800698:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80069d:	f6 c6 08             	test   $0x8,%dh
+  8006a0:	74 15                	je     8006b7 <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8006a2:	89 c2                	mov    %eax,%edx
+  8006a4:	c1 ea 08             	shr    $0x8,%edx
+  8006a7:	83 e2 0f             	and    $0xf,%edx
+  8006aa:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8006af:	83 fa 06             	cmp    $0x6,%edx
+  8006b2:	74 0e                	je     8006c2 <sys_page_map+0x7a>
+  8006b4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8006b7:	0f b6 c9             	movzbl %cl,%ecx
+  8006ba:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8006c0:	eb 98                	jmp    80065a <sys_page_map+0x12>
+  8006c2:	89 c2                	mov    %eax,%edx
+  8006c4:	c1 ea 04             	shr    $0x4,%edx
+  8006c7:	83 e2 0f             	and    $0xf,%edx
+  8006ca:	83 fa 02             	cmp    $0x2,%edx
+  8006cd:	77 e5                	ja     8006b4 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  8006cf:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8006d2:	83 f8 02             	cmp    $0x2,%eax
+  8006d5:	0f 97 c1             	seta   %cl
+  8006d8:	0f b6 c9             	movzbl %cl,%ecx
+  8006db:	eb d7                	jmp    8006b4 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  8006dd:	b8 05 00 00 00       	mov    $0x5,%eax
+  8006e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8006eb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8006ee:	8b 75 18             	mov    0x18(%ebp),%esi
+  8006f1:	cd 30                	int    $0x30
+  8006f3:	eb 90                	jmp    800685 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8006f5:	83 ec 0c             	sub    $0xc,%esp
+  8006f8:	50                   	push   %eax
+  8006f9:	6a 05                	push   $0x5
+  8006fb:	68 aa 27 80 00       	push   $0x8027aa
+  800700:	6a 4a                	push   $0x4a
+  800702:	68 c7 27 80 00       	push   $0x8027c7
+  800707:	e8 f5 14 00 00       	call   801c01 <_panic>
+
+0080070c <sys_page_unmap>:
+{
+  80070c:	55                   	push   %ebp
+  80070d:	89 e5                	mov    %esp,%ebp
+  80070f:	57                   	push   %edi
+  800710:	56                   	push   %esi
+  800711:	53                   	push   %ebx
+  800712:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800715:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80071c:	78 37                	js     800755 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  80071e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800725:	74 7a                	je     8007a1 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  800727:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80072c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80072f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800732:	b8 06 00 00 00       	mov    $0x6,%eax
+  800737:	89 df                	mov    %ebx,%edi
+  800739:	89 de                	mov    %ebx,%esi
+  80073b:	55                   	push   %ebp
+  80073c:	68 45 07 80 00       	push   $0x800745
+  800741:	89 e5                	mov    %esp,%ebp
+  800743:	0f 34                	sysenter
+  800745:	83 c4 04             	add    $0x4,%esp
+  800748:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800749:	85 c0                	test   %eax,%eax
+  80074b:	7f 6c                	jg     8007b9 <sys_page_unmap+0xad>
+}
+  80074d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800750:	5b                   	pop    %ebx
+  800751:	5e                   	pop    %esi
+  800752:	5f                   	pop    %edi
+  800753:	5d                   	pop    %ebp
+  800754:	c3                   	ret
+  800755:	b8 01 00 00 00       	mov    $0x1,%eax
+  80075a:	0f a2                	cpuid
+		return 0;
+  80075c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800761:	f6 c6 08             	test   $0x8,%dh
+  800764:	74 15                	je     80077b <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800766:	89 c2                	mov    %eax,%edx
+  800768:	c1 ea 08             	shr    $0x8,%edx
+  80076b:	83 e2 0f             	and    $0xf,%edx
+  80076e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800773:	83 fa 06             	cmp    $0x6,%edx
+  800776:	74 0e                	je     800786 <sys_page_unmap+0x7a>
+  800778:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80077b:	0f b6 c9             	movzbl %cl,%ecx
+  80077e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800784:	eb 98                	jmp    80071e <sys_page_unmap+0x12>
+  800786:	89 c2                	mov    %eax,%edx
+  800788:	c1 ea 04             	shr    $0x4,%edx
+  80078b:	83 e2 0f             	and    $0xf,%edx
+  80078e:	83 fa 02             	cmp    $0x2,%edx
+  800791:	77 e5                	ja     800778 <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  800793:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800796:	83 f8 02             	cmp    $0x2,%eax
+  800799:	0f 97 c1             	seta   %cl
+  80079c:	0f b6 c9             	movzbl %cl,%ecx
+  80079f:	eb d7                	jmp    800778 <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  8007a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007a6:	b8 06 00 00 00       	mov    $0x6,%eax
+  8007ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007b1:	89 df                	mov    %ebx,%edi
+  8007b3:	89 de                	mov    %ebx,%esi
+  8007b5:	cd 30                	int    $0x30
+  8007b7:	eb 90                	jmp    800749 <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8007b9:	83 ec 0c             	sub    $0xc,%esp
+  8007bc:	50                   	push   %eax
+  8007bd:	6a 06                	push   $0x6
+  8007bf:	68 aa 27 80 00       	push   $0x8027aa
+  8007c4:	6a 4a                	push   $0x4a
+  8007c6:	68 c7 27 80 00       	push   $0x8027c7
+  8007cb:	e8 31 14 00 00       	call   801c01 <_panic>
+
+008007d0 <sys_page_copy>:
+{
+  8007d0:	55                   	push   %ebp
+  8007d1:	89 e5                	mov    %esp,%ebp
+  8007d3:	57                   	push   %edi
+  8007d4:	56                   	push   %esi
+  8007d5:	53                   	push   %ebx
+  8007d6:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8007d9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8007e0:	78 37                	js     800819 <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  8007e2:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8007e9:	74 7a                	je     800865 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  8007eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007f1:	b8 29 00 00 00       	mov    $0x29,%eax
+  8007f6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8007f9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8007fc:	8b 75 18             	mov    0x18(%ebp),%esi
+  8007ff:	55                   	push   %ebp
+  800800:	68 09 08 80 00       	push   $0x800809
+  800805:	89 e5                	mov    %esp,%ebp
+  800807:	0f 34                	sysenter
+  800809:	83 c4 04             	add    $0x4,%esp
+  80080c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80080d:	85 c0                	test   %eax,%eax
+  80080f:	7f 6c                	jg     80087d <sys_page_copy+0xad>
+}
+  800811:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800814:	5b                   	pop    %ebx
+  800815:	5e                   	pop    %esi
+  800816:	5f                   	pop    %edi
+  800817:	5d                   	pop    %ebp
+  800818:	c3                   	ret
+  800819:	b8 01 00 00 00       	mov    $0x1,%eax
+  80081e:	0f a2                	cpuid
+		return 0;
+  800820:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800825:	f6 c6 08             	test   $0x8,%dh
+  800828:	74 15                	je     80083f <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80082a:	89 c2                	mov    %eax,%edx
+  80082c:	c1 ea 08             	shr    $0x8,%edx
+  80082f:	83 e2 0f             	and    $0xf,%edx
+  800832:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800837:	83 fa 06             	cmp    $0x6,%edx
+  80083a:	74 0e                	je     80084a <sys_page_copy+0x7a>
+  80083c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80083f:	0f b6 c9             	movzbl %cl,%ecx
+  800842:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800848:	eb 98                	jmp    8007e2 <sys_page_copy+0x12>
+  80084a:	89 c2                	mov    %eax,%edx
+  80084c:	c1 ea 04             	shr    $0x4,%edx
+  80084f:	83 e2 0f             	and    $0xf,%edx
+  800852:	83 fa 02             	cmp    $0x2,%edx
+  800855:	77 e5                	ja     80083c <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  800857:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80085a:	83 f8 02             	cmp    $0x2,%eax
+  80085d:	0f 97 c1             	seta   %cl
+  800860:	0f b6 c9             	movzbl %cl,%ecx
+  800863:	eb d7                	jmp    80083c <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  800865:	b8 29 00 00 00       	mov    $0x29,%eax
+  80086a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80086d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800870:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800873:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800876:	8b 75 18             	mov    0x18(%ebp),%esi
+  800879:	cd 30                	int    $0x30
+  80087b:	eb 90                	jmp    80080d <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80087d:	83 ec 0c             	sub    $0xc,%esp
+  800880:	50                   	push   %eax
+  800881:	6a 29                	push   $0x29
+  800883:	68 aa 27 80 00       	push   $0x8027aa
+  800888:	6a 4a                	push   $0x4a
+  80088a:	68 c7 27 80 00       	push   $0x8027c7
+  80088f:	e8 6d 13 00 00       	call   801c01 <_panic>
+
+00800894 <sys_yield>:
+{
+  800894:	55                   	push   %ebp
+  800895:	89 e5                	mov    %esp,%ebp
+  800897:	57                   	push   %edi
+  800898:	56                   	push   %esi
+  800899:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80089a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8008a1:	78 2e                	js     8008d1 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  8008a3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8008aa:	74 71                	je     80091d <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  8008ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008b1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8008b6:	89 d1                	mov    %edx,%ecx
+  8008b8:	89 d3                	mov    %edx,%ebx
+  8008ba:	89 d7                	mov    %edx,%edi
+  8008bc:	89 d6                	mov    %edx,%esi
+  8008be:	55                   	push   %ebp
+  8008bf:	68 c8 08 80 00       	push   $0x8008c8
+  8008c4:	89 e5                	mov    %esp,%ebp
+  8008c6:	0f 34                	sysenter
+  8008c8:	83 c4 04             	add    $0x4,%esp
+  8008cb:	5d                   	pop    %ebp
+}
+  8008cc:	5b                   	pop    %ebx
+  8008cd:	5e                   	pop    %esi
+  8008ce:	5f                   	pop    %edi
+  8008cf:	5d                   	pop    %ebp
+  8008d0:	c3                   	ret
+  8008d1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8008d6:	0f a2                	cpuid
+		return 0;
+  8008d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8008dd:	f6 c6 08             	test   $0x8,%dh
+  8008e0:	74 15                	je     8008f7 <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8008e2:	89 c2                	mov    %eax,%edx
+  8008e4:	c1 ea 08             	shr    $0x8,%edx
+  8008e7:	83 e2 0f             	and    $0xf,%edx
+  8008ea:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8008ef:	83 fa 06             	cmp    $0x6,%edx
+  8008f2:	74 0e                	je     800902 <sys_yield+0x6e>
+  8008f4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8008f7:	0f b6 c9             	movzbl %cl,%ecx
+  8008fa:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800900:	eb a1                	jmp    8008a3 <sys_yield+0xf>
+  800902:	89 c2                	mov    %eax,%edx
+  800904:	c1 ea 04             	shr    $0x4,%edx
+  800907:	83 e2 0f             	and    $0xf,%edx
+  80090a:	83 fa 02             	cmp    $0x2,%edx
+  80090d:	77 e5                	ja     8008f4 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  80090f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800912:	83 f8 02             	cmp    $0x2,%eax
+  800915:	0f 97 c1             	seta   %cl
+  800918:	0f b6 c9             	movzbl %cl,%ecx
+  80091b:	eb d7                	jmp    8008f4 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  80091d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800922:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800927:	89 d1                	mov    %edx,%ecx
+  800929:	89 d3                	mov    %edx,%ebx
+  80092b:	89 d7                	mov    %edx,%edi
+  80092d:	89 d6                	mov    %edx,%esi
+  80092f:	cd 30                	int    $0x30
+}
+  800931:	eb 99                	jmp    8008cc <sys_yield+0x38>
+
+00800933 <sys_env_set_status>:
+{
+  800933:	55                   	push   %ebp
+  800934:	89 e5                	mov    %esp,%ebp
+  800936:	57                   	push   %edi
+  800937:	56                   	push   %esi
+  800938:	53                   	push   %ebx
+  800939:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80093c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800943:	78 37                	js     80097c <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  800945:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80094c:	74 7a                	je     8009c8 <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  80094e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800953:	8b 55 08             	mov    0x8(%ebp),%edx
+  800956:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800959:	b8 08 00 00 00       	mov    $0x8,%eax
+  80095e:	89 df                	mov    %ebx,%edi
+  800960:	89 de                	mov    %ebx,%esi
+  800962:	55                   	push   %ebp
+  800963:	68 6c 09 80 00       	push   $0x80096c
+  800968:	89 e5                	mov    %esp,%ebp
+  80096a:	0f 34                	sysenter
+  80096c:	83 c4 04             	add    $0x4,%esp
+  80096f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800970:	85 c0                	test   %eax,%eax
+  800972:	7f 6c                	jg     8009e0 <sys_env_set_status+0xad>
+}
+  800974:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800977:	5b                   	pop    %ebx
+  800978:	5e                   	pop    %esi
+  800979:	5f                   	pop    %edi
+  80097a:	5d                   	pop    %ebp
+  80097b:	c3                   	ret
+  80097c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800981:	0f a2                	cpuid
+		return 0;
+  800983:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800988:	f6 c6 08             	test   $0x8,%dh
+  80098b:	74 15                	je     8009a2 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80098d:	89 c2                	mov    %eax,%edx
+  80098f:	c1 ea 08             	shr    $0x8,%edx
+  800992:	83 e2 0f             	and    $0xf,%edx
+  800995:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80099a:	83 fa 06             	cmp    $0x6,%edx
+  80099d:	74 0e                	je     8009ad <sys_env_set_status+0x7a>
+  80099f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8009a2:	0f b6 c9             	movzbl %cl,%ecx
+  8009a5:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8009ab:	eb 98                	jmp    800945 <sys_env_set_status+0x12>
+  8009ad:	89 c2                	mov    %eax,%edx
+  8009af:	c1 ea 04             	shr    $0x4,%edx
+  8009b2:	83 e2 0f             	and    $0xf,%edx
+  8009b5:	83 fa 02             	cmp    $0x2,%edx
+  8009b8:	77 e5                	ja     80099f <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  8009ba:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8009bd:	83 f8 02             	cmp    $0x2,%eax
+  8009c0:	0f 97 c1             	seta   %cl
+  8009c3:	0f b6 c9             	movzbl %cl,%ecx
+  8009c6:	eb d7                	jmp    80099f <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  8009c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009cd:	b8 08 00 00 00       	mov    $0x8,%eax
+  8009d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009d8:	89 df                	mov    %ebx,%edi
+  8009da:	89 de                	mov    %ebx,%esi
+  8009dc:	cd 30                	int    $0x30
+  8009de:	eb 90                	jmp    800970 <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8009e0:	83 ec 0c             	sub    $0xc,%esp
+  8009e3:	50                   	push   %eax
+  8009e4:	6a 08                	push   $0x8
+  8009e6:	68 aa 27 80 00       	push   $0x8027aa
+  8009eb:	6a 4a                	push   $0x4a
+  8009ed:	68 c7 27 80 00       	push   $0x8027c7
+  8009f2:	e8 0a 12 00 00       	call   801c01 <_panic>
+
+008009f7 <sys_sysinfo>:
+{
+  8009f7:	55                   	push   %ebp
+  8009f8:	89 e5                	mov    %esp,%ebp
+  8009fa:	57                   	push   %edi
+  8009fb:	56                   	push   %esi
+  8009fc:	53                   	push   %ebx
+  8009fd:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800a00:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800a07:	78 36                	js     800a3f <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  800a09:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800a10:	74 79                	je     800a8b <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  800a12:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a15:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a1a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800a1f:	89 cb                	mov    %ecx,%ebx
+  800a21:	89 cf                	mov    %ecx,%edi
+  800a23:	89 ce                	mov    %ecx,%esi
+  800a25:	55                   	push   %ebp
+  800a26:	68 2f 0a 80 00       	push   $0x800a2f
+  800a2b:	89 e5                	mov    %esp,%ebp
+  800a2d:	0f 34                	sysenter
+  800a2f:	83 c4 04             	add    $0x4,%esp
+  800a32:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800a33:	85 c0                	test   %eax,%eax
+  800a35:	7f 6b                	jg     800aa2 <sys_sysinfo+0xab>
+}
+  800a37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a3a:	5b                   	pop    %ebx
+  800a3b:	5e                   	pop    %esi
+  800a3c:	5f                   	pop    %edi
+  800a3d:	5d                   	pop    %ebp
+  800a3e:	c3                   	ret
+  800a3f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800a44:	0f a2                	cpuid
+		return 0;
+  800a46:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800a4b:	f6 c6 08             	test   $0x8,%dh
+  800a4e:	74 15                	je     800a65 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800a50:	89 c2                	mov    %eax,%edx
+  800a52:	c1 ea 08             	shr    $0x8,%edx
+  800a55:	83 e2 0f             	and    $0xf,%edx
+  800a58:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800a5d:	83 fa 06             	cmp    $0x6,%edx
+  800a60:	74 0e                	je     800a70 <sys_sysinfo+0x79>
+  800a62:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800a65:	0f b6 c9             	movzbl %cl,%ecx
+  800a68:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800a6e:	eb 99                	jmp    800a09 <sys_sysinfo+0x12>
+  800a70:	89 c2                	mov    %eax,%edx
+  800a72:	c1 ea 04             	shr    $0x4,%edx
+  800a75:	83 e2 0f             	and    $0xf,%edx
+  800a78:	83 fa 02             	cmp    $0x2,%edx
+  800a7b:	77 e5                	ja     800a62 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  800a7d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800a80:	83 f8 02             	cmp    $0x2,%eax
+  800a83:	0f 97 c1             	seta   %cl
+  800a86:	0f b6 c9             	movzbl %cl,%ecx
+  800a89:	eb d7                	jmp    800a62 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  800a8b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a90:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800a95:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a98:	89 cb                	mov    %ecx,%ebx
+  800a9a:	89 cf                	mov    %ecx,%edi
+  800a9c:	89 ce                	mov    %ecx,%esi
+  800a9e:	cd 30                	int    $0x30
+  800aa0:	eb 91                	jmp    800a33 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800aa2:	83 ec 0c             	sub    $0xc,%esp
+  800aa5:	50                   	push   %eax
+  800aa6:	6a 0b                	push   $0xb
+  800aa8:	68 aa 27 80 00       	push   $0x8027aa
+  800aad:	6a 4a                	push   $0x4a
+  800aaf:	68 c7 27 80 00       	push   $0x8027c7
+  800ab4:	e8 48 11 00 00       	call   801c01 <_panic>
+
+00800ab9 <sys_env_set_trapframe>:
+{
+  800ab9:	55                   	push   %ebp
+  800aba:	89 e5                	mov    %esp,%ebp
+  800abc:	57                   	push   %edi
+  800abd:	56                   	push   %esi
+  800abe:	53                   	push   %ebx
+  800abf:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800ac2:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ac9:	78 37                	js     800b02 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  800acb:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ad2:	74 7a                	je     800b4e <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  800ad4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ad9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800adc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800adf:	b8 13 00 00 00       	mov    $0x13,%eax
+  800ae4:	89 df                	mov    %ebx,%edi
+  800ae6:	89 de                	mov    %ebx,%esi
+  800ae8:	55                   	push   %ebp
+  800ae9:	68 f2 0a 80 00       	push   $0x800af2
+  800aee:	89 e5                	mov    %esp,%ebp
+  800af0:	0f 34                	sysenter
+  800af2:	83 c4 04             	add    $0x4,%esp
+  800af5:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800af6:	85 c0                	test   %eax,%eax
+  800af8:	7f 6c                	jg     800b66 <sys_env_set_trapframe+0xad>
+}
+  800afa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800afd:	5b                   	pop    %ebx
+  800afe:	5e                   	pop    %esi
+  800aff:	5f                   	pop    %edi
+  800b00:	5d                   	pop    %ebp
+  800b01:	c3                   	ret
+  800b02:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b07:	0f a2                	cpuid
+		return 0;
+  800b09:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800b0e:	f6 c6 08             	test   $0x8,%dh
+  800b11:	74 15                	je     800b28 <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800b13:	89 c2                	mov    %eax,%edx
+  800b15:	c1 ea 08             	shr    $0x8,%edx
+  800b18:	83 e2 0f             	and    $0xf,%edx
+  800b1b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800b20:	83 fa 06             	cmp    $0x6,%edx
+  800b23:	74 0e                	je     800b33 <sys_env_set_trapframe+0x7a>
+  800b25:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800b28:	0f b6 c9             	movzbl %cl,%ecx
+  800b2b:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800b31:	eb 98                	jmp    800acb <sys_env_set_trapframe+0x12>
+  800b33:	89 c2                	mov    %eax,%edx
+  800b35:	c1 ea 04             	shr    $0x4,%edx
+  800b38:	83 e2 0f             	and    $0xf,%edx
+  800b3b:	83 fa 02             	cmp    $0x2,%edx
+  800b3e:	77 e5                	ja     800b25 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  800b40:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800b43:	83 f8 02             	cmp    $0x2,%eax
+  800b46:	0f 97 c1             	seta   %cl
+  800b49:	0f b6 c9             	movzbl %cl,%ecx
+  800b4c:	eb d7                	jmp    800b25 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  800b4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b53:	b8 13 00 00 00       	mov    $0x13,%eax
+  800b58:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b5b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b5e:	89 df                	mov    %ebx,%edi
+  800b60:	89 de                	mov    %ebx,%esi
+  800b62:	cd 30                	int    $0x30
+  800b64:	eb 90                	jmp    800af6 <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b66:	83 ec 0c             	sub    $0xc,%esp
+  800b69:	50                   	push   %eax
+  800b6a:	6a 13                	push   $0x13
+  800b6c:	68 aa 27 80 00       	push   $0x8027aa
+  800b71:	6a 4a                	push   $0x4a
+  800b73:	68 c7 27 80 00       	push   $0x8027c7
+  800b78:	e8 84 10 00 00       	call   801c01 <_panic>
+
+00800b7d <sys_env_set_stack_limit>:
+{
+  800b7d:	55                   	push   %ebp
+  800b7e:	89 e5                	mov    %esp,%ebp
+  800b80:	57                   	push   %edi
+  800b81:	56                   	push   %esi
+  800b82:	53                   	push   %ebx
+  800b83:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800b86:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b8d:	78 37                	js     800bc6 <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  800b8f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b96:	74 7a                	je     800c12 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  800b98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ba0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ba3:	b8 19 00 00 00       	mov    $0x19,%eax
+  800ba8:	89 df                	mov    %ebx,%edi
+  800baa:	89 de                	mov    %ebx,%esi
+  800bac:	55                   	push   %ebp
+  800bad:	68 b6 0b 80 00       	push   $0x800bb6
+  800bb2:	89 e5                	mov    %esp,%ebp
+  800bb4:	0f 34                	sysenter
+  800bb6:	83 c4 04             	add    $0x4,%esp
+  800bb9:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800bba:	85 c0                	test   %eax,%eax
+  800bbc:	7f 6c                	jg     800c2a <sys_env_set_stack_limit+0xad>
+}
+  800bbe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bc1:	5b                   	pop    %ebx
+  800bc2:	5e                   	pop    %esi
+  800bc3:	5f                   	pop    %edi
+  800bc4:	5d                   	pop    %ebp
+  800bc5:	c3                   	ret
+  800bc6:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bcb:	0f a2                	cpuid
+		return 0;
+  800bcd:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800bd2:	f6 c6 08             	test   $0x8,%dh
+  800bd5:	74 15                	je     800bec <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800bd7:	89 c2                	mov    %eax,%edx
+  800bd9:	c1 ea 08             	shr    $0x8,%edx
+  800bdc:	83 e2 0f             	and    $0xf,%edx
+  800bdf:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800be4:	83 fa 06             	cmp    $0x6,%edx
+  800be7:	74 0e                	je     800bf7 <sys_env_set_stack_limit+0x7a>
+  800be9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800bec:	0f b6 c9             	movzbl %cl,%ecx
+  800bef:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800bf5:	eb 98                	jmp    800b8f <sys_env_set_stack_limit+0x12>
+  800bf7:	89 c2                	mov    %eax,%edx
+  800bf9:	c1 ea 04             	shr    $0x4,%edx
+  800bfc:	83 e2 0f             	and    $0xf,%edx
+  800bff:	83 fa 02             	cmp    $0x2,%edx
+  800c02:	77 e5                	ja     800be9 <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  800c04:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c07:	83 f8 02             	cmp    $0x2,%eax
+  800c0a:	0f 97 c1             	seta   %cl
+  800c0d:	0f b6 c9             	movzbl %cl,%ecx
+  800c10:	eb d7                	jmp    800be9 <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  800c12:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c17:	b8 19 00 00 00       	mov    $0x19,%eax
+  800c1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c1f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c22:	89 df                	mov    %ebx,%edi
+  800c24:	89 de                	mov    %ebx,%esi
+  800c26:	cd 30                	int    $0x30
+  800c28:	eb 90                	jmp    800bba <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c2a:	83 ec 0c             	sub    $0xc,%esp
+  800c2d:	50                   	push   %eax
+  800c2e:	6a 19                	push   $0x19
+  800c30:	68 aa 27 80 00       	push   $0x8027aa
+  800c35:	6a 4a                	push   $0x4a
+  800c37:	68 c7 27 80 00       	push   $0x8027c7
+  800c3c:	e8 c0 0f 00 00       	call   801c01 <_panic>
+
+00800c41 <sys_env_set_pgfault_upcall>:
+{
+  800c41:	55                   	push   %ebp
+  800c42:	89 e5                	mov    %esp,%ebp
+  800c44:	57                   	push   %edi
+  800c45:	56                   	push   %esi
+  800c46:	53                   	push   %ebx
+  800c47:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800c4a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800c51:	78 37                	js     800c8a <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  800c53:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800c5a:	74 7a                	je     800cd6 <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  800c5c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c67:	b8 09 00 00 00       	mov    $0x9,%eax
+  800c6c:	89 df                	mov    %ebx,%edi
+  800c6e:	89 de                	mov    %ebx,%esi
+  800c70:	55                   	push   %ebp
+  800c71:	68 7a 0c 80 00       	push   $0x800c7a
+  800c76:	89 e5                	mov    %esp,%ebp
+  800c78:	0f 34                	sysenter
+  800c7a:	83 c4 04             	add    $0x4,%esp
+  800c7d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c7e:	85 c0                	test   %eax,%eax
+  800c80:	7f 6c                	jg     800cee <sys_env_set_pgfault_upcall+0xad>
+}
+  800c82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c85:	5b                   	pop    %ebx
+  800c86:	5e                   	pop    %esi
+  800c87:	5f                   	pop    %edi
+  800c88:	5d                   	pop    %ebp
+  800c89:	c3                   	ret
+  800c8a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c8f:	0f a2                	cpuid
+		return 0;
+  800c91:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800c96:	f6 c6 08             	test   $0x8,%dh
+  800c99:	74 15                	je     800cb0 <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c9b:	89 c2                	mov    %eax,%edx
+  800c9d:	c1 ea 08             	shr    $0x8,%edx
+  800ca0:	83 e2 0f             	and    $0xf,%edx
+  800ca3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ca8:	83 fa 06             	cmp    $0x6,%edx
+  800cab:	74 0e                	je     800cbb <sys_env_set_pgfault_upcall+0x7a>
+  800cad:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800cb0:	0f b6 c9             	movzbl %cl,%ecx
+  800cb3:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800cb9:	eb 98                	jmp    800c53 <sys_env_set_pgfault_upcall+0x12>
+  800cbb:	89 c2                	mov    %eax,%edx
+  800cbd:	c1 ea 04             	shr    $0x4,%edx
+  800cc0:	83 e2 0f             	and    $0xf,%edx
+  800cc3:	83 fa 02             	cmp    $0x2,%edx
+  800cc6:	77 e5                	ja     800cad <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  800cc8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ccb:	83 f8 02             	cmp    $0x2,%eax
+  800cce:	0f 97 c1             	seta   %cl
+  800cd1:	0f b6 c9             	movzbl %cl,%ecx
+  800cd4:	eb d7                	jmp    800cad <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  800cd6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cdb:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ce0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce6:	89 df                	mov    %ebx,%edi
+  800ce8:	89 de                	mov    %ebx,%esi
+  800cea:	cd 30                	int    $0x30
+  800cec:	eb 90                	jmp    800c7e <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cee:	83 ec 0c             	sub    $0xc,%esp
+  800cf1:	50                   	push   %eax
+  800cf2:	6a 09                	push   $0x9
+  800cf4:	68 aa 27 80 00       	push   $0x8027aa
+  800cf9:	6a 4a                	push   $0x4a
+  800cfb:	68 c7 27 80 00       	push   $0x8027c7
+  800d00:	e8 fc 0e 00 00       	call   801c01 <_panic>
+
+00800d05 <sys_ipc_try_send>:
+{
+  800d05:	55                   	push   %ebp
+  800d06:	89 e5                	mov    %esp,%ebp
+  800d08:	57                   	push   %edi
+  800d09:	56                   	push   %esi
+  800d0a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800d0b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d12:	78 32                	js     800d46 <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  800d14:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d1b:	74 75                	je     800d92 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  800d1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d23:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d28:	be 00 00 00 00       	mov    $0x0,%esi
+  800d2d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d30:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d33:	55                   	push   %ebp
+  800d34:	68 3d 0d 80 00       	push   $0x800d3d
+  800d39:	89 e5                	mov    %esp,%ebp
+  800d3b:	0f 34                	sysenter
+  800d3d:	83 c4 04             	add    $0x4,%esp
+  800d40:	5d                   	pop    %ebp
+}
+  800d41:	5b                   	pop    %ebx
+  800d42:	5e                   	pop    %esi
+  800d43:	5f                   	pop    %edi
+  800d44:	5d                   	pop    %ebp
+  800d45:	c3                   	ret
+  800d46:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d4b:	0f a2                	cpuid
+		return 0;
+  800d4d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800d52:	f6 c6 08             	test   $0x8,%dh
+  800d55:	74 15                	je     800d6c <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d57:	89 c2                	mov    %eax,%edx
+  800d59:	c1 ea 08             	shr    $0x8,%edx
+  800d5c:	83 e2 0f             	and    $0xf,%edx
+  800d5f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d64:	83 fa 06             	cmp    $0x6,%edx
+  800d67:	74 0e                	je     800d77 <sys_ipc_try_send+0x72>
+  800d69:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800d6c:	0f b6 c9             	movzbl %cl,%ecx
+  800d6f:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800d75:	eb 9d                	jmp    800d14 <sys_ipc_try_send+0xf>
+  800d77:	89 c2                	mov    %eax,%edx
+  800d79:	c1 ea 04             	shr    $0x4,%edx
+  800d7c:	83 e2 0f             	and    $0xf,%edx
+  800d7f:	83 fa 02             	cmp    $0x2,%edx
+  800d82:	77 e5                	ja     800d69 <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  800d84:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d87:	83 f8 02             	cmp    $0x2,%eax
+  800d8a:	0f 97 c1             	seta   %cl
+  800d8d:	0f b6 c9             	movzbl %cl,%ecx
+  800d90:	eb d7                	jmp    800d69 <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  800d92:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d97:	be 00 00 00 00       	mov    $0x0,%esi
+  800d9c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800da5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800da8:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  800daa:	eb 95                	jmp    800d41 <sys_ipc_try_send+0x3c>
+
+00800dac <sys_ipc_send>:
+{
+  800dac:	55                   	push   %ebp
+  800dad:	89 e5                	mov    %esp,%ebp
+  800daf:	57                   	push   %edi
+  800db0:	56                   	push   %esi
+  800db1:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800db2:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800db9:	78 32                	js     800ded <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  800dbb:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800dc2:	74 75                	je     800e39 <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  800dc4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dca:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800dcf:	be 00 00 00 00       	mov    $0x0,%esi
+  800dd4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dd7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dda:	55                   	push   %ebp
+  800ddb:	68 e4 0d 80 00       	push   $0x800de4
+  800de0:	89 e5                	mov    %esp,%ebp
+  800de2:	0f 34                	sysenter
+  800de4:	83 c4 04             	add    $0x4,%esp
+  800de7:	5d                   	pop    %ebp
+}
+  800de8:	5b                   	pop    %ebx
+  800de9:	5e                   	pop    %esi
+  800dea:	5f                   	pop    %edi
+  800deb:	5d                   	pop    %ebp
+  800dec:	c3                   	ret
+  800ded:	b8 01 00 00 00       	mov    $0x1,%eax
+  800df2:	0f a2                	cpuid
+		return 0;
+  800df4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800df9:	f6 c6 08             	test   $0x8,%dh
+  800dfc:	74 15                	je     800e13 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800dfe:	89 c2                	mov    %eax,%edx
+  800e00:	c1 ea 08             	shr    $0x8,%edx
+  800e03:	83 e2 0f             	and    $0xf,%edx
+  800e06:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e0b:	83 fa 06             	cmp    $0x6,%edx
+  800e0e:	74 0e                	je     800e1e <sys_ipc_send+0x72>
+  800e10:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e13:	0f b6 c9             	movzbl %cl,%ecx
+  800e16:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800e1c:	eb 9d                	jmp    800dbb <sys_ipc_send+0xf>
+  800e1e:	89 c2                	mov    %eax,%edx
+  800e20:	c1 ea 04             	shr    $0x4,%edx
+  800e23:	83 e2 0f             	and    $0xf,%edx
+  800e26:	83 fa 02             	cmp    $0x2,%edx
+  800e29:	77 e5                	ja     800e10 <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  800e2b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e2e:	83 f8 02             	cmp    $0x2,%eax
+  800e31:	0f 97 c1             	seta   %cl
+  800e34:	0f b6 c9             	movzbl %cl,%ecx
+  800e37:	eb d7                	jmp    800e10 <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  800e39:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800e3e:	be 00 00 00 00       	mov    $0x0,%esi
+  800e43:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e46:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e49:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e4c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e4f:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  800e51:	eb 95                	jmp    800de8 <sys_ipc_send+0x3c>
+
+00800e53 <sys_ipc_recv>:
+{
+  800e53:	55                   	push   %ebp
+  800e54:	89 e5                	mov    %esp,%ebp
+  800e56:	57                   	push   %edi
+  800e57:	56                   	push   %esi
+  800e58:	53                   	push   %ebx
+  800e59:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800e5c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e63:	78 36                	js     800e9b <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  800e65:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e6c:	74 79                	je     800ee7 <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  800e6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e71:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e76:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e7b:	89 cb                	mov    %ecx,%ebx
+  800e7d:	89 cf                	mov    %ecx,%edi
+  800e7f:	89 ce                	mov    %ecx,%esi
+  800e81:	55                   	push   %ebp
+  800e82:	68 8b 0e 80 00       	push   $0x800e8b
+  800e87:	89 e5                	mov    %esp,%ebp
+  800e89:	0f 34                	sysenter
+  800e8b:	83 c4 04             	add    $0x4,%esp
+  800e8e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e8f:	85 c0                	test   %eax,%eax
+  800e91:	7f 6b                	jg     800efe <sys_ipc_recv+0xab>
+}
+  800e93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e96:	5b                   	pop    %ebx
+  800e97:	5e                   	pop    %esi
+  800e98:	5f                   	pop    %edi
+  800e99:	5d                   	pop    %ebp
+  800e9a:	c3                   	ret
+  800e9b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ea0:	0f a2                	cpuid
+		return 0;
+  800ea2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800ea7:	f6 c6 08             	test   $0x8,%dh
+  800eaa:	74 15                	je     800ec1 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800eac:	89 c2                	mov    %eax,%edx
+  800eae:	c1 ea 08             	shr    $0x8,%edx
+  800eb1:	83 e2 0f             	and    $0xf,%edx
+  800eb4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800eb9:	83 fa 06             	cmp    $0x6,%edx
+  800ebc:	74 0e                	je     800ecc <sys_ipc_recv+0x79>
+  800ebe:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800ec1:	0f b6 c9             	movzbl %cl,%ecx
+  800ec4:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800eca:	eb 99                	jmp    800e65 <sys_ipc_recv+0x12>
+  800ecc:	89 c2                	mov    %eax,%edx
+  800ece:	c1 ea 04             	shr    $0x4,%edx
+  800ed1:	83 e2 0f             	and    $0xf,%edx
+  800ed4:	83 fa 02             	cmp    $0x2,%edx
+  800ed7:	77 e5                	ja     800ebe <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  800ed9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800edc:	83 f8 02             	cmp    $0x2,%eax
+  800edf:	0f 97 c1             	seta   %cl
+  800ee2:	0f b6 c9             	movzbl %cl,%ecx
+  800ee5:	eb d7                	jmp    800ebe <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  800ee7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800eec:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ef1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef4:	89 cb                	mov    %ecx,%ebx
+  800ef6:	89 cf                	mov    %ecx,%edi
+  800ef8:	89 ce                	mov    %ecx,%esi
+  800efa:	cd 30                	int    $0x30
+  800efc:	eb 91                	jmp    800e8f <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800efe:	83 ec 0c             	sub    $0xc,%esp
+  800f01:	50                   	push   %eax
+  800f02:	6a 0d                	push   $0xd
+  800f04:	68 aa 27 80 00       	push   $0x8027aa
+  800f09:	6a 4a                	push   $0x4a
+  800f0b:	68 c7 27 80 00       	push   $0x8027c7
+  800f10:	e8 ec 0c 00 00       	call   801c01 <_panic>
+
+00800f15 <sys_ipc_send_range>:
+{
+  800f15:	55                   	push   %ebp
+  800f16:	89 e5                	mov    %esp,%ebp
+  800f18:	57                   	push   %edi
+  800f19:	56                   	push   %esi
+  800f1a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800f1b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f22:	78 30                	js     800f54 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  800f24:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f2b:	74 73                	je     800fa0 <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  800f2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f33:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  800f38:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f3b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f3e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f41:	55                   	push   %ebp
+  800f42:	68 4b 0f 80 00       	push   $0x800f4b
+  800f47:	89 e5                	mov    %esp,%ebp
+  800f49:	0f 34                	sysenter
+  800f4b:	83 c4 04             	add    $0x4,%esp
+  800f4e:	5d                   	pop    %ebp
+}
+  800f4f:	5b                   	pop    %ebx
+  800f50:	5e                   	pop    %esi
+  800f51:	5f                   	pop    %edi
+  800f52:	5d                   	pop    %ebp
+  800f53:	c3                   	ret
+  800f54:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f59:	0f a2                	cpuid
+		return 0;
+  800f5b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f60:	f6 c6 08             	test   $0x8,%dh
+  800f63:	74 15                	je     800f7a <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f65:	89 c2                	mov    %eax,%edx
+  800f67:	c1 ea 08             	shr    $0x8,%edx
+  800f6a:	83 e2 0f             	and    $0xf,%edx
+  800f6d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f72:	83 fa 06             	cmp    $0x6,%edx
+  800f75:	74 0e                	je     800f85 <sys_ipc_send_range+0x70>
+  800f77:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f7a:	0f b6 c9             	movzbl %cl,%ecx
+  800f7d:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800f83:	eb 9f                	jmp    800f24 <sys_ipc_send_range+0xf>
+  800f85:	89 c2                	mov    %eax,%edx
+  800f87:	c1 ea 04             	shr    $0x4,%edx
+  800f8a:	83 e2 0f             	and    $0xf,%edx
+  800f8d:	83 fa 02             	cmp    $0x2,%edx
+  800f90:	77 e5                	ja     800f77 <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  800f92:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f95:	83 f8 02             	cmp    $0x2,%eax
+  800f98:	0f 97 c1             	seta   %cl
+  800f9b:	0f b6 c9             	movzbl %cl,%ecx
+  800f9e:	eb d7                	jmp    800f77 <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  800fa0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  800fa5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fae:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fb1:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fb4:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  800fb6:	eb 97                	jmp    800f4f <sys_ipc_send_range+0x3a>
+
+00800fb8 <sys_ipc_recv_range>:
+{
+  800fb8:	55                   	push   %ebp
+  800fb9:	89 e5                	mov    %esp,%ebp
+  800fbb:	57                   	push   %edi
+  800fbc:	56                   	push   %esi
+  800fbd:	53                   	push   %ebx
+  800fbe:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800fc1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fc8:	78 37                	js     801001 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  800fca:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fd1:	74 7a                	je     80104d <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  800fd3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fde:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800fe3:	89 df                	mov    %ebx,%edi
+  800fe5:	89 de                	mov    %ebx,%esi
+  800fe7:	55                   	push   %ebp
+  800fe8:	68 f1 0f 80 00       	push   $0x800ff1
+  800fed:	89 e5                	mov    %esp,%ebp
+  800fef:	0f 34                	sysenter
+  800ff1:	83 c4 04             	add    $0x4,%esp
+  800ff4:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ff5:	85 c0                	test   %eax,%eax
+  800ff7:	7f 6c                	jg     801065 <sys_ipc_recv_range+0xad>
+}
+  800ff9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ffc:	5b                   	pop    %ebx
+  800ffd:	5e                   	pop    %esi
+  800ffe:	5f                   	pop    %edi
+  800fff:	5d                   	pop    %ebp
+  801000:	c3                   	ret
+  801001:	b8 01 00 00 00       	mov    $0x1,%eax
+  801006:	0f a2                	cpuid
+		return 0;
+  801008:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80100d:	f6 c6 08             	test   $0x8,%dh
+  801010:	74 15                	je     801027 <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801012:	89 c2                	mov    %eax,%edx
+  801014:	c1 ea 08             	shr    $0x8,%edx
+  801017:	83 e2 0f             	and    $0xf,%edx
+  80101a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80101f:	83 fa 06             	cmp    $0x6,%edx
+  801022:	74 0e                	je     801032 <sys_ipc_recv_range+0x7a>
+  801024:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801027:	0f b6 c9             	movzbl %cl,%ecx
+  80102a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801030:	eb 98                	jmp    800fca <sys_ipc_recv_range+0x12>
+  801032:	89 c2                	mov    %eax,%edx
+  801034:	c1 ea 04             	shr    $0x4,%edx
+  801037:	83 e2 0f             	and    $0xf,%edx
+  80103a:	83 fa 02             	cmp    $0x2,%edx
+  80103d:	77 e5                	ja     801024 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  80103f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801042:	83 f8 02             	cmp    $0x2,%eax
+  801045:	0f 97 c1             	seta   %cl
+  801048:	0f b6 c9             	movzbl %cl,%ecx
+  80104b:	eb d7                	jmp    801024 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  80104d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801052:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801057:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80105d:	89 df                	mov    %ebx,%edi
+  80105f:	89 de                	mov    %ebx,%esi
+  801061:	cd 30                	int    $0x30
+  801063:	eb 90                	jmp    800ff5 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801065:	83 ec 0c             	sub    $0xc,%esp
+  801068:	50                   	push   %eax
+  801069:	6a 1f                	push   $0x1f
+  80106b:	68 aa 27 80 00       	push   $0x8027aa
+  801070:	6a 4a                	push   $0x4a
+  801072:	68 c7 27 80 00       	push   $0x8027c7
+  801077:	e8 85 0b 00 00       	call   801c01 <_panic>
+
+0080107c <sys_ipc_call>:
+{
+  80107c:	55                   	push   %ebp
+  80107d:	89 e5                	mov    %esp,%ebp
+  80107f:	57                   	push   %edi
+  801080:	56                   	push   %esi
+  801081:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801082:	8b 55 08             	mov    0x8(%ebp),%edx
+  801085:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80108a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80108d:	55                   	push   %ebp
+  80108e:	56                   	push   %esi
+  80108f:	8b 0e                	mov    (%esi),%ecx
+  801091:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801094:	8b 7e 08             	mov    0x8(%esi),%edi
+  801097:	8b 6e 10             	mov    0x10(%esi),%ebp
+  80109a:	8b 76 0c             	mov    0xc(%esi),%esi
+  80109d:	cd 30                	int    $0x30
+  80109f:	87 34 24             	xchg   %esi,(%esp)
+  8010a2:	89 0e                	mov    %ecx,(%esi)
+  8010a4:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8010a7:	89 7e 08             	mov    %edi,0x8(%esi)
+  8010aa:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8010ad:	8f 46 0c             	pop    0xc(%esi)
+  8010b0:	5d                   	pop    %ebp
+}
+  8010b1:	5b                   	pop    %ebx
+  8010b2:	5e                   	pop    %esi
+  8010b3:	5f                   	pop    %edi
+  8010b4:	5d                   	pop    %ebp
+  8010b5:	c3                   	ret
+
+008010b6 <sys_ipc_reply_wait>:
+{
+  8010b6:	55                   	push   %ebp
+  8010b7:	89 e5                	mov    %esp,%ebp
+  8010b9:	57                   	push   %edi
+  8010ba:	56                   	push   %esi
+  8010bb:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010bf:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8010c4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8010c7:	55                   	push   %ebp
+  8010c8:	56                   	push   %esi
+  8010c9:	8b 0e                	mov    (%esi),%ecx
+  8010cb:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8010ce:	8b 7e 08             	mov    0x8(%esi),%edi
+  8010d1:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8010d4:	8b 76 0c             	mov    0xc(%esi),%esi
+  8010d7:	cd 30                	int    $0x30
+  8010d9:	87 34 24             	xchg   %esi,(%esp)
+  8010dc:	89 0e                	mov    %ecx,(%esi)
+  8010de:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8010e1:	89 7e 08             	mov    %edi,0x8(%esi)
+  8010e4:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8010e7:	8f 46 0c             	pop    0xc(%esi)
+  8010ea:	5d                   	pop    %ebp
+}
+  8010eb:	5b                   	pop    %ebx
+  8010ec:	5e                   	pop    %esi
+  8010ed:	5f                   	pop    %edi
+  8010ee:	5d                   	pop    %ebp
+  8010ef:	c3                   	ret
+
+008010f0 <sys_ipc_send_msg>:
+{
+  8010f0:	55                   	push   %ebp
+  8010f1:	89 e5                	mov    %esp,%ebp
+  8010f3:	57                   	push   %edi
+  8010f4:	56                   	push   %esi
+  8010f5:	53                   	push   %ebx
+  8010f6:	83 ec 20             	sub    $0x20,%esp
+  8010f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  8010fc:	8b 10                	mov    (%eax),%edx
+  8010fe:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801101:	8b 50 04             	mov    0x4(%eax),%edx
+  801104:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801107:	8b 50 08             	mov    0x8(%eax),%edx
+  80110a:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  80110d:	8b 50 0c             	mov    0xc(%eax),%edx
+  801110:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801113:	8b 40 10             	mov    0x10(%eax),%eax
+  801116:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801119:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  80111c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80111f:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801124:	55                   	push   %ebp
+  801125:	56                   	push   %esi
+  801126:	8b 0e                	mov    (%esi),%ecx
+  801128:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80112b:	8b 7e 08             	mov    0x8(%esi),%edi
+  80112e:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801131:	8b 76 0c             	mov    0xc(%esi),%esi
+  801134:	cd 30                	int    $0x30
+  801136:	87 34 24             	xchg   %esi,(%esp)
+  801139:	89 0e                	mov    %ecx,(%esi)
+  80113b:	89 5e 04             	mov    %ebx,0x4(%esi)
+  80113e:	89 7e 08             	mov    %edi,0x8(%esi)
+  801141:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801144:	8f 46 0c             	pop    0xc(%esi)
+  801147:	5d                   	pop    %ebp
+}
+  801148:	83 c4 20             	add    $0x20,%esp
+  80114b:	5b                   	pop    %ebx
+  80114c:	5e                   	pop    %esi
+  80114d:	5f                   	pop    %edi
+  80114e:	5d                   	pop    %ebp
+  80114f:	c3                   	ret
+
+00801150 <sys_fork>:
+{
+  801150:	55                   	push   %ebp
+  801151:	89 e5                	mov    %esp,%ebp
+  801153:	57                   	push   %edi
+  801154:	56                   	push   %esi
+  801155:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801156:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80115d:	78 2e                	js     80118d <sys_fork+0x3d>
+	if (syscall_sysenter)
+  80115f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801166:	74 71                	je     8011d9 <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801168:	ba 00 00 00 00       	mov    $0x0,%edx
+  80116d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801172:	89 d1                	mov    %edx,%ecx
+  801174:	89 d3                	mov    %edx,%ebx
+  801176:	89 d7                	mov    %edx,%edi
+  801178:	89 d6                	mov    %edx,%esi
+  80117a:	55                   	push   %ebp
+  80117b:	68 84 11 80 00       	push   $0x801184
+  801180:	89 e5                	mov    %esp,%ebp
+  801182:	0f 34                	sysenter
+  801184:	83 c4 04             	add    $0x4,%esp
+  801187:	5d                   	pop    %ebp
+}
+  801188:	5b                   	pop    %ebx
+  801189:	5e                   	pop    %esi
+  80118a:	5f                   	pop    %edi
+  80118b:	5d                   	pop    %ebp
+  80118c:	c3                   	ret
+  80118d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801192:	0f a2                	cpuid
+		return 0;
+  801194:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801199:	f6 c6 08             	test   $0x8,%dh
+  80119c:	74 15                	je     8011b3 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80119e:	89 c2                	mov    %eax,%edx
+  8011a0:	c1 ea 08             	shr    $0x8,%edx
+  8011a3:	83 e2 0f             	and    $0xf,%edx
+  8011a6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011ab:	83 fa 06             	cmp    $0x6,%edx
+  8011ae:	74 0e                	je     8011be <sys_fork+0x6e>
+  8011b0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8011b3:	0f b6 c9             	movzbl %cl,%ecx
+  8011b6:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8011bc:	eb a1                	jmp    80115f <sys_fork+0xf>
+  8011be:	89 c2                	mov    %eax,%edx
+  8011c0:	c1 ea 04             	shr    $0x4,%edx
+  8011c3:	83 e2 0f             	and    $0xf,%edx
+  8011c6:	83 fa 02             	cmp    $0x2,%edx
+  8011c9:	77 e5                	ja     8011b0 <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  8011cb:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011ce:	83 f8 02             	cmp    $0x2,%eax
+  8011d1:	0f 97 c1             	seta   %cl
+  8011d4:	0f b6 c9             	movzbl %cl,%ecx
+  8011d7:	eb d7                	jmp    8011b0 <sys_fork+0x60>
+		asm volatile("int %1\n"
+  8011d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011de:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011e3:	89 d1                	mov    %edx,%ecx
+  8011e5:	89 d3                	mov    %edx,%ebx
+  8011e7:	89 d7                	mov    %edx,%edi
+  8011e9:	89 d6                	mov    %edx,%esi
+  8011eb:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  8011ed:	eb 99                	jmp    801188 <sys_fork+0x38>
+
+008011ef <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  8011ef:	55                   	push   %ebp
+  8011f0:	89 e5                	mov    %esp,%ebp
+  8011f2:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  8011f5:	ff 75 14             	push   0x14(%ebp)
+  8011f8:	ff 75 10             	push   0x10(%ebp)
+  8011fb:	ff 75 0c             	push   0xc(%ebp)
+  8011fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801203:	8b 55 08             	mov    0x8(%ebp),%edx
+  801206:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80120b:	e8 81 ee ff ff       	call   800091 <page_vec_call>
+}
+  801210:	c9                   	leave
+  801211:	c3                   	ret
+
+00801212 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801212:	55                   	push   %ebp
+  801213:	89 e5                	mov    %esp,%ebp
+  801215:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801218:	ff 75 18             	push   0x18(%ebp)
+  80121b:	ff 75 14             	push   0x14(%ebp)
+  80121e:	ff 75 10             	push   0x10(%ebp)
+  801221:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801224:	8b 55 08             	mov    0x8(%ebp),%edx
+  801227:	b8 10 00 00 00       	mov    $0x10,%eax
+  80122c:	e8 60 ee ff ff       	call   800091 <page_vec_call>
+}
+  801231:	c9                   	leave
+  801232:	c3                   	ret
+
+00801233 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801233:	55                   	push   %ebp
+  801234:	89 e5                	mov    %esp,%ebp
+  801236:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801239:	ff 75 14             	push   0x14(%ebp)
+  80123c:	ff 75 10             	push   0x10(%ebp)
+  80123f:	ff 75 0c             	push   0xc(%ebp)
+  801242:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801247:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124a:	b8 11 00 00 00       	mov    $0x11,%eax
+  80124f:	e8 3d ee ff ff       	call   800091 <page_vec_call>
+}
+  801254:	c9                   	leave
+  801255:	c3                   	ret
+
+00801256 <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801256:	55                   	push   %ebp
+  801257:	89 e5                	mov    %esp,%ebp
+  801259:	57                   	push   %edi
+  80125a:	56                   	push   %esi
+  80125b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80125c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801263:	78 32                	js     801297 <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801265:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80126c:	74 75                	je     8012e3 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  80126e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801271:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801274:	b8 12 00 00 00       	mov    $0x12,%eax
+  801279:	be 00 00 00 00       	mov    $0x0,%esi
+  80127e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801281:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801284:	55                   	push   %ebp
+  801285:	68 8e 12 80 00       	push   $0x80128e
+  80128a:	89 e5                	mov    %esp,%ebp
+  80128c:	0f 34                	sysenter
+  80128e:	83 c4 04             	add    $0x4,%esp
+  801291:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801292:	5b                   	pop    %ebx
+  801293:	5e                   	pop    %esi
+  801294:	5f                   	pop    %edi
+  801295:	5d                   	pop    %ebp
+  801296:	c3                   	ret
+  801297:	b8 01 00 00 00       	mov    $0x1,%eax
+  80129c:	0f a2                	cpuid
+		return 0;
+  80129e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8012a3:	f6 c6 08             	test   $0x8,%dh
+  8012a6:	74 15                	je     8012bd <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012a8:	89 c2                	mov    %eax,%edx
+  8012aa:	c1 ea 08             	shr    $0x8,%edx
+  8012ad:	83 e2 0f             	and    $0xf,%edx
+  8012b0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012b5:	83 fa 06             	cmp    $0x6,%edx
+  8012b8:	74 0e                	je     8012c8 <sys_vm_ranges+0x72>
+  8012ba:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8012bd:	0f b6 c9             	movzbl %cl,%ecx
+  8012c0:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8012c6:	eb 9d                	jmp    801265 <sys_vm_ranges+0xf>
+  8012c8:	89 c2                	mov    %eax,%edx
+  8012ca:	c1 ea 04             	shr    $0x4,%edx
+  8012cd:	83 e2 0f             	and    $0xf,%edx
+  8012d0:	83 fa 02             	cmp    $0x2,%edx
+  8012d3:	77 e5                	ja     8012ba <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  8012d5:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012d8:	83 f8 02             	cmp    $0x2,%eax
+  8012db:	0f 97 c1             	seta   %cl
+  8012de:	0f b6 c9             	movzbl %cl,%ecx
+  8012e1:	eb d7                	jmp    8012ba <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  8012e3:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012f6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012f9:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  8012fb:	eb 95                	jmp    801292 <sys_vm_ranges+0x3c>
+
+008012fd <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  8012fd:	55                   	push   %ebp
+  8012fe:	89 e5                	mov    %esp,%ebp
+  801300:	57                   	push   %edi
+  801301:	56                   	push   %esi
+  801302:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801303:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80130a:	78 31                	js     80133d <sys_spawn+0x40>
+	if (syscall_sysenter)
+  80130c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801313:	74 74                	je     801389 <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801315:	be 00 00 00 00       	mov    $0x0,%esi
+  80131a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80131d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801320:	b8 14 00 00 00       	mov    $0x14,%eax
+  801325:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801328:	89 f7                	mov    %esi,%edi
+  80132a:	55                   	push   %ebp
+  80132b:	68 34 13 80 00       	push   $0x801334
+  801330:	89 e5                	mov    %esp,%ebp
+  801332:	0f 34                	sysenter
+  801334:	83 c4 04             	add    $0x4,%esp
+  801337:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801338:	5b                   	pop    %ebx
+  801339:	5e                   	pop    %esi
+  80133a:	5f                   	pop    %edi
+  80133b:	5d                   	pop    %ebp
+  80133c:	c3                   	ret
+  80133d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801342:	0f a2                	cpuid
+		return 0;
+  801344:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801349:	f6 c6 08             	test   $0x8,%dh
+  80134c:	74 15                	je     801363 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80134e:	89 c2                	mov    %eax,%edx
+  801350:	c1 ea 08             	shr    $0x8,%edx
+  801353:	83 e2 0f             	and    $0xf,%edx
+  801356:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80135b:	83 fa 06             	cmp    $0x6,%edx
+  80135e:	74 0e                	je     80136e <sys_spawn+0x71>
+  801360:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801363:	0f b6 c9             	movzbl %cl,%ecx
+  801366:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80136c:	eb 9e                	jmp    80130c <sys_spawn+0xf>
+  80136e:	89 c2                	mov    %eax,%edx
+  801370:	c1 ea 04             	shr    $0x4,%edx
+  801373:	83 e2 0f             	and    $0xf,%edx
+  801376:	83 fa 02             	cmp    $0x2,%edx
+  801379:	77 e5                	ja     801360 <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  80137b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80137e:	83 f8 02             	cmp    $0x2,%eax
+  801381:	0f 97 c1             	seta   %cl
+  801384:	0f b6 c9             	movzbl %cl,%ecx
+  801387:	eb d7                	jmp    801360 <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  801389:	be 00 00 00 00       	mov    $0x0,%esi
+  80138e:	b8 14 00 00 00       	mov    $0x14,%eax
+  801393:	8b 55 08             	mov    0x8(%ebp),%edx
+  801396:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801399:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80139c:	89 f7                	mov    %esi,%edi
+  80139e:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  8013a0:	eb 96                	jmp    801338 <sys_spawn+0x3b>
+
+008013a2 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  8013a2:	55                   	push   %ebp
+  8013a3:	89 e5                	mov    %esp,%ebp
+  8013a5:	57                   	push   %edi
+  8013a6:	56                   	push   %esi
+  8013a7:	53                   	push   %ebx
+  8013a8:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8013ab:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8013b2:	78 37                	js     8013eb <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  8013b4:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8013bb:	74 7a                	je     801437 <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  8013bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c8:	b8 15 00 00 00       	mov    $0x15,%eax
+  8013cd:	89 df                	mov    %ebx,%edi
+  8013cf:	89 de                	mov    %ebx,%esi
+  8013d1:	55                   	push   %ebp
+  8013d2:	68 db 13 80 00       	push   $0x8013db
+  8013d7:	89 e5                	mov    %esp,%ebp
+  8013d9:	0f 34                	sysenter
+  8013db:	83 c4 04             	add    $0x4,%esp
+  8013de:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8013df:	85 c0                	test   %eax,%eax
+  8013e1:	7f 6c                	jg     80144f <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  8013e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e6:	5b                   	pop    %ebx
+  8013e7:	5e                   	pop    %esi
+  8013e8:	5f                   	pop    %edi
+  8013e9:	5d                   	pop    %ebp
+  8013ea:	c3                   	ret
+  8013eb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013f0:	0f a2                	cpuid
+		return 0;
+  8013f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8013f7:	f6 c6 08             	test   $0x8,%dh
+  8013fa:	74 15                	je     801411 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013fc:	89 c2                	mov    %eax,%edx
+  8013fe:	c1 ea 08             	shr    $0x8,%edx
+  801401:	83 e2 0f             	and    $0xf,%edx
+  801404:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801409:	83 fa 06             	cmp    $0x6,%edx
+  80140c:	74 0e                	je     80141c <sys_shm_create+0x7a>
+  80140e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801411:	0f b6 c9             	movzbl %cl,%ecx
+  801414:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80141a:	eb 98                	jmp    8013b4 <sys_shm_create+0x12>
+  80141c:	89 c2                	mov    %eax,%edx
+  80141e:	c1 ea 04             	shr    $0x4,%edx
+  801421:	83 e2 0f             	and    $0xf,%edx
+  801424:	83 fa 02             	cmp    $0x2,%edx
+  801427:	77 e5                	ja     80140e <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  801429:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80142c:	83 f8 02             	cmp    $0x2,%eax
+  80142f:	0f 97 c1             	seta   %cl
+  801432:	0f b6 c9             	movzbl %cl,%ecx
+  801435:	eb d7                	jmp    80140e <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  801437:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80143c:	b8 15 00 00 00       	mov    $0x15,%eax
+  801441:	8b 55 08             	mov    0x8(%ebp),%edx
+  801444:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801447:	89 df                	mov    %ebx,%edi
+  801449:	89 de                	mov    %ebx,%esi
+  80144b:	cd 30                	int    $0x30
+  80144d:	eb 90                	jmp    8013df <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80144f:	83 ec 0c             	sub    $0xc,%esp
+  801452:	50                   	push   %eax
+  801453:	6a 15                	push   $0x15
+  801455:	68 aa 27 80 00       	push   $0x8027aa
+  80145a:	6a 4a                	push   $0x4a
+  80145c:	68 c7 27 80 00       	push   $0x8027c7
+  801461:	e8 9b 07 00 00       	call   801c01 <_panic>
+
+00801466 <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  801466:	55                   	push   %ebp
+  801467:	89 e5                	mov    %esp,%ebp
+  801469:	57                   	push   %edi
+  80146a:	56                   	push   %esi
+  80146b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80146c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801473:	78 32                	js     8014a7 <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  801475:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80147c:	74 75                	je     8014f3 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  80147e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801481:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801484:	b8 16 00 00 00       	mov    $0x16,%eax
+  801489:	be 00 00 00 00       	mov    $0x0,%esi
+  80148e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801491:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801494:	55                   	push   %ebp
+  801495:	68 9e 14 80 00       	push   $0x80149e
+  80149a:	89 e5                	mov    %esp,%ebp
+  80149c:	0f 34                	sysenter
+  80149e:	83 c4 04             	add    $0x4,%esp
+  8014a1:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  8014a2:	5b                   	pop    %ebx
+  8014a3:	5e                   	pop    %esi
+  8014a4:	5f                   	pop    %edi
+  8014a5:	5d                   	pop    %ebp
+  8014a6:	c3                   	ret
+  8014a7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014ac:	0f a2                	cpuid
+		return 0;
+  8014ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8014b3:	f6 c6 08             	test   $0x8,%dh
+  8014b6:	74 15                	je     8014cd <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014b8:	89 c2                	mov    %eax,%edx
+  8014ba:	c1 ea 08             	shr    $0x8,%edx
+  8014bd:	83 e2 0f             	and    $0xf,%edx
+  8014c0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8014c5:	83 fa 06             	cmp    $0x6,%edx
+  8014c8:	74 0e                	je     8014d8 <sys_shm_attach+0x72>
+  8014ca:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8014cd:	0f b6 c9             	movzbl %cl,%ecx
+  8014d0:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8014d6:	eb 9d                	jmp    801475 <sys_shm_attach+0xf>
+  8014d8:	89 c2                	mov    %eax,%edx
+  8014da:	c1 ea 04             	shr    $0x4,%edx
+  8014dd:	83 e2 0f             	and    $0xf,%edx
+  8014e0:	83 fa 02             	cmp    $0x2,%edx
+  8014e3:	77 e5                	ja     8014ca <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  8014e5:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014e8:	83 f8 02             	cmp    $0x2,%eax
+  8014eb:	0f 97 c1             	seta   %cl
+  8014ee:	0f b6 c9             	movzbl %cl,%ecx
+  8014f1:	eb d7                	jmp    8014ca <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  8014f3:	b8 16 00 00 00       	mov    $0x16,%eax
+  8014f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8014fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801500:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801503:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801506:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801509:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  80150b:	eb 95                	jmp    8014a2 <sys_shm_attach+0x3c>
+
+0080150d <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  80150d:	55                   	push   %ebp
+  80150e:	89 e5                	mov    %esp,%ebp
+  801510:	57                   	push   %edi
+  801511:	56                   	push   %esi
+  801512:	53                   	push   %ebx
+  801513:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801516:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80151d:	78 38                	js     801557 <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  80151f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801526:	74 7b                	je     8015a3 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  801528:	be 00 00 00 00       	mov    $0x0,%esi
+  80152d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801530:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801533:	b8 17 00 00 00       	mov    $0x17,%eax
+  801538:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80153b:	89 f7                	mov    %esi,%edi
+  80153d:	55                   	push   %ebp
+  80153e:	68 47 15 80 00       	push   $0x801547
+  801543:	89 e5                	mov    %esp,%ebp
+  801545:	0f 34                	sysenter
+  801547:	83 c4 04             	add    $0x4,%esp
+  80154a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80154b:	85 c0                	test   %eax,%eax
+  80154d:	7f 6d                	jg     8015bc <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  80154f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801552:	5b                   	pop    %ebx
+  801553:	5e                   	pop    %esi
+  801554:	5f                   	pop    %edi
+  801555:	5d                   	pop    %ebp
+  801556:	c3                   	ret
+  801557:	b8 01 00 00 00       	mov    $0x1,%eax
+  80155c:	0f a2                	cpuid
+		return 0;
+  80155e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801563:	f6 c6 08             	test   $0x8,%dh
+  801566:	74 15                	je     80157d <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801568:	89 c2                	mov    %eax,%edx
+  80156a:	c1 ea 08             	shr    $0x8,%edx
+  80156d:	83 e2 0f             	and    $0xf,%edx
+  801570:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801575:	83 fa 06             	cmp    $0x6,%edx
+  801578:	74 0e                	je     801588 <sys_shm_detach+0x7b>
+  80157a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80157d:	0f b6 c9             	movzbl %cl,%ecx
+  801580:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801586:	eb 97                	jmp    80151f <sys_shm_detach+0x12>
+  801588:	89 c2                	mov    %eax,%edx
+  80158a:	c1 ea 04             	shr    $0x4,%edx
+  80158d:	83 e2 0f             	and    $0xf,%edx
+  801590:	83 fa 02             	cmp    $0x2,%edx
+  801593:	77 e5                	ja     80157a <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  801595:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801598:	83 f8 02             	cmp    $0x2,%eax
+  80159b:	0f 97 c1             	seta   %cl
+  80159e:	0f b6 c9             	movzbl %cl,%ecx
+  8015a1:	eb d7                	jmp    80157a <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  8015a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8015a8:	b8 17 00 00 00       	mov    $0x17,%eax
+  8015ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015b6:	89 f7                	mov    %esi,%edi
+  8015b8:	cd 30                	int    $0x30
+  8015ba:	eb 8f                	jmp    80154b <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015bc:	83 ec 0c             	sub    $0xc,%esp
+  8015bf:	50                   	push   %eax
+  8015c0:	6a 17                	push   $0x17
+  8015c2:	68 aa 27 80 00       	push   $0x8027aa
+  8015c7:	6a 4a                	push   $0x4a
+  8015c9:	68 c7 27 80 00       	push   $0x8027c7
+  8015ce:	e8 2e 06 00 00       	call   801c01 <_panic>
+
+008015d3 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  8015d3:	55                   	push   %ebp
+  8015d4:	89 e5                	mov    %esp,%ebp
+  8015d6:	57                   	push   %edi
+  8015d7:	56                   	push   %esi
+  8015d8:	53                   	push   %ebx
+  8015d9:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8015dc:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8015e3:	78 36                	js     80161b <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  8015e5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8015ec:	74 79                	je     801667 <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  8015ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015f6:	b8 18 00 00 00       	mov    $0x18,%eax
+  8015fb:	89 cb                	mov    %ecx,%ebx
+  8015fd:	89 cf                	mov    %ecx,%edi
+  8015ff:	89 ce                	mov    %ecx,%esi
+  801601:	55                   	push   %ebp
+  801602:	68 0b 16 80 00       	push   $0x80160b
+  801607:	89 e5                	mov    %esp,%ebp
+  801609:	0f 34                	sysenter
+  80160b:	83 c4 04             	add    $0x4,%esp
+  80160e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80160f:	85 c0                	test   %eax,%eax
+  801611:	7f 6b                	jg     80167e <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  801613:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801616:	5b                   	pop    %ebx
+  801617:	5e                   	pop    %esi
+  801618:	5f                   	pop    %edi
+  801619:	5d                   	pop    %ebp
+  80161a:	c3                   	ret
+  80161b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801620:	0f a2                	cpuid
+		return 0;
+  801622:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801627:	f6 c6 08             	test   $0x8,%dh
+  80162a:	74 15                	je     801641 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80162c:	89 c2                	mov    %eax,%edx
+  80162e:	c1 ea 08             	shr    $0x8,%edx
+  801631:	83 e2 0f             	and    $0xf,%edx
+  801634:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801639:	83 fa 06             	cmp    $0x6,%edx
+  80163c:	74 0e                	je     80164c <sys_shm_remove+0x79>
+  80163e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801641:	0f b6 c9             	movzbl %cl,%ecx
+  801644:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80164a:	eb 99                	jmp    8015e5 <sys_shm_remove+0x12>
+  80164c:	89 c2                	mov    %eax,%edx
+  80164e:	c1 ea 04             	shr    $0x4,%edx
+  801651:	83 e2 0f             	and    $0xf,%edx
+  801654:	83 fa 02             	cmp    $0x2,%edx
+  801657:	77 e5                	ja     80163e <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  801659:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80165c:	83 f8 02             	cmp    $0x2,%eax
+  80165f:	0f 97 c1             	seta   %cl
+  801662:	0f b6 c9             	movzbl %cl,%ecx
+  801665:	eb d7                	jmp    80163e <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  801667:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80166c:	b8 18 00 00 00       	mov    $0x18,%eax
+  801671:	8b 55 08             	mov    0x8(%ebp),%edx
+  801674:	89 cb                	mov    %ecx,%ebx
+  801676:	89 cf                	mov    %ecx,%edi
+  801678:	89 ce                	mov    %ecx,%esi
+  80167a:	cd 30                	int    $0x30
+  80167c:	eb 91                	jmp    80160f <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80167e:	83 ec 0c             	sub    $0xc,%esp
+  801681:	50                   	push   %eax
+  801682:	6a 18                	push   $0x18
+  801684:	68 aa 27 80 00       	push   $0x8027aa
+  801689:	6a 4a                	push   $0x4a
+  80168b:	68 c7 27 80 00       	push   $0x8027c7
+  801690:	e8 6c 05 00 00       	call   801c01 <_panic>
+
+00801695 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  801695:	55                   	push   %ebp
+  801696:	89 e5                	mov    %esp,%ebp
+  801698:	57                   	push   %edi
+  801699:	56                   	push   %esi
+  80169a:	53                   	push   %ebx
+  80169b:	83 ec 0c             	sub    $0xc,%esp
+  80169e:	8b 45 10             	mov    0x10(%ebp),%eax
+  8016a1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8016a4:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  8016a7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8016ae:	78 32                	js     8016e2 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  8016b0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8016b7:	74 75                	je     80172e <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  8016b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016bf:	b8 20 00 00 00       	mov    $0x20,%eax
+  8016c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8016c9:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8016cc:	55                   	push   %ebp
+  8016cd:	68 d6 16 80 00       	push   $0x8016d6
+  8016d2:	89 e5                	mov    %esp,%ebp
+  8016d4:	0f 34                	sysenter
+  8016d6:	83 c4 04             	add    $0x4,%esp
+  8016d9:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  8016da:	83 c4 0c             	add    $0xc,%esp
+  8016dd:	5b                   	pop    %ebx
+  8016de:	5e                   	pop    %esi
+  8016df:	5f                   	pop    %edi
+  8016e0:	5d                   	pop    %ebp
+  8016e1:	c3                   	ret
+  8016e2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016e7:	0f a2                	cpuid
+		return 0;
+  8016e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8016ee:	f6 c6 08             	test   $0x8,%dh
+  8016f1:	74 15                	je     801708 <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016f3:	89 c2                	mov    %eax,%edx
+  8016f5:	c1 ea 08             	shr    $0x8,%edx
+  8016f8:	83 e2 0f             	and    $0xf,%edx
+  8016fb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801700:	83 fa 06             	cmp    $0x6,%edx
+  801703:	74 0e                	je     801713 <sys_futex_wait+0x7e>
+  801705:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801708:	0f b6 c9             	movzbl %cl,%ecx
+  80170b:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801711:	eb 9d                	jmp    8016b0 <sys_futex_wait+0x1b>
+  801713:	89 c2                	mov    %eax,%edx
+  801715:	c1 ea 04             	shr    $0x4,%edx
+  801718:	83 e2 0f             	and    $0xf,%edx
+  80171b:	83 fa 02             	cmp    $0x2,%edx
+  80171e:	77 e5                	ja     801705 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  801720:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801723:	83 f8 02             	cmp    $0x2,%eax
+  801726:	0f 97 c1             	seta   %cl
+  801729:	0f b6 c9             	movzbl %cl,%ecx
+  80172c:	eb d7                	jmp    801705 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  80172e:	b8 20 00 00 00       	mov    $0x20,%eax
+  801733:	be 00 00 00 00       	mov    $0x0,%esi
+  801738:	8b 55 08             	mov    0x8(%ebp),%edx
+  80173b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80173e:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  801741:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  801743:	eb 95                	jmp    8016da <sys_futex_wait+0x45>
+
+00801745 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801745:	55                   	push   %ebp
+  801746:	89 e5                	mov    %esp,%ebp
+  801748:	57                   	push   %edi
+  801749:	56                   	push   %esi
+  80174a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80174b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801752:	78 30                	js     801784 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  801754:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80175b:	74 73                	je     8017d0 <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  80175d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801762:	8b 55 08             	mov    0x8(%ebp),%edx
+  801765:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801768:	b8 21 00 00 00       	mov    $0x21,%eax
+  80176d:	89 df                	mov    %ebx,%edi
+  80176f:	89 de                	mov    %ebx,%esi
+  801771:	55                   	push   %ebp
+  801772:	68 7b 17 80 00       	push   $0x80177b
+  801777:	89 e5                	mov    %esp,%ebp
+  801779:	0f 34                	sysenter
+  80177b:	83 c4 04             	add    $0x4,%esp
+  80177e:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80177f:	5b                   	pop    %ebx
+  801780:	5e                   	pop    %esi
+  801781:	5f                   	pop    %edi
+  801782:	5d                   	pop    %ebp
+  801783:	c3                   	ret
+  801784:	b8 01 00 00 00       	mov    $0x1,%eax
+  801789:	0f a2                	cpuid
+		return 0;
+  80178b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801790:	f6 c6 08             	test   $0x8,%dh
+  801793:	74 15                	je     8017aa <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801795:	89 c2                	mov    %eax,%edx
+  801797:	c1 ea 08             	shr    $0x8,%edx
+  80179a:	83 e2 0f             	and    $0xf,%edx
+  80179d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017a2:	83 fa 06             	cmp    $0x6,%edx
+  8017a5:	74 0e                	je     8017b5 <sys_futex_wake+0x70>
+  8017a7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8017aa:	0f b6 c9             	movzbl %cl,%ecx
+  8017ad:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8017b3:	eb 9f                	jmp    801754 <sys_futex_wake+0xf>
+  8017b5:	89 c2                	mov    %eax,%edx
+  8017b7:	c1 ea 04             	shr    $0x4,%edx
+  8017ba:	83 e2 0f             	and    $0xf,%edx
+  8017bd:	83 fa 02             	cmp    $0x2,%edx
+  8017c0:	77 e5                	ja     8017a7 <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  8017c2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017c5:	83 f8 02             	cmp    $0x2,%eax
+  8017c8:	0f 97 c1             	seta   %cl
+  8017cb:	0f b6 c9             	movzbl %cl,%ecx
+  8017ce:	eb d7                	jmp    8017a7 <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  8017d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d5:	b8 21 00 00 00       	mov    $0x21,%eax
+  8017da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017e0:	89 df                	mov    %ebx,%edi
+  8017e2:	89 de                	mov    %ebx,%esi
+  8017e4:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  8017e6:	eb 97                	jmp    80177f <sys_futex_wake+0x3a>
+
+008017e8 <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  8017e8:	55                   	push   %ebp
+  8017e9:	89 e5                	mov    %esp,%ebp
+  8017eb:	57                   	push   %edi
+  8017ec:	56                   	push   %esi
+  8017ed:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8017ee:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8017f5:	78 2e                	js     801825 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  8017f7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8017fe:	74 71                	je     801871 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  801800:	ba 00 00 00 00       	mov    $0x0,%edx
+  801805:	b8 22 00 00 00       	mov    $0x22,%eax
+  80180a:	89 d1                	mov    %edx,%ecx
+  80180c:	89 d3                	mov    %edx,%ebx
+  80180e:	89 d7                	mov    %edx,%edi
+  801810:	89 d6                	mov    %edx,%esi
+  801812:	55                   	push   %ebp
+  801813:	68 1c 18 80 00       	push   $0x80181c
+  801818:	89 e5                	mov    %esp,%ebp
+  80181a:	0f 34                	sysenter
+  80181c:	83 c4 04             	add    $0x4,%esp
+  80181f:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  801820:	5b                   	pop    %ebx
+  801821:	5e                   	pop    %esi
+  801822:	5f                   	pop    %edi
+  801823:	5d                   	pop    %ebp
+  801824:	c3                   	ret
+  801825:	b8 01 00 00 00       	mov    $0x1,%eax
+  80182a:	0f a2                	cpuid
+		return 0;
+  80182c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801831:	f6 c6 08             	test   $0x8,%dh
+  801834:	74 15                	je     80184b <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801836:	89 c2                	mov    %eax,%edx
+  801838:	c1 ea 08             	shr    $0x8,%edx
+  80183b:	83 e2 0f             	and    $0xf,%edx
+  80183e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801843:	83 fa 06             	cmp    $0x6,%edx
+  801846:	74 0e                	je     801856 <sys_ep_create+0x6e>
+  801848:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80184b:	0f b6 c9             	movzbl %cl,%ecx
+  80184e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801854:	eb a1                	jmp    8017f7 <sys_ep_create+0xf>
+  801856:	89 c2                	mov    %eax,%edx
+  801858:	c1 ea 04             	shr    $0x4,%edx
+  80185b:	83 e2 0f             	and    $0xf,%edx
+  80185e:	83 fa 02             	cmp    $0x2,%edx
+  801861:	77 e5                	ja     801848 <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  801863:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801866:	83 f8 02             	cmp    $0x2,%eax
+  801869:	0f 97 c1             	seta   %cl
+  80186c:	0f b6 c9             	movzbl %cl,%ecx
+  80186f:	eb d7                	jmp    801848 <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  801871:	ba 00 00 00 00       	mov    $0x0,%edx
+  801876:	b8 22 00 00 00       	mov    $0x22,%eax
+  80187b:	89 d1                	mov    %edx,%ecx
+  80187d:	89 d3                	mov    %edx,%ebx
+  80187f:	89 d7                	mov    %edx,%edi
+  801881:	89 d6                	mov    %edx,%esi
+  801883:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  801885:	eb 99                	jmp    801820 <sys_ep_create+0x38>
+
+00801887 <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  801887:	55                   	push   %ebp
+  801888:	89 e5                	mov    %esp,%ebp
+  80188a:	57                   	push   %edi
+  80188b:	56                   	push   %esi
+  80188c:	53                   	push   %ebx
+  80188d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801890:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801897:	78 36                	js     8018cf <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  801899:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8018a0:	74 79                	je     80191b <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  8018a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018aa:	b8 23 00 00 00       	mov    $0x23,%eax
+  8018af:	89 cb                	mov    %ecx,%ebx
+  8018b1:	89 cf                	mov    %ecx,%edi
+  8018b3:	89 ce                	mov    %ecx,%esi
+  8018b5:	55                   	push   %ebp
+  8018b6:	68 bf 18 80 00       	push   $0x8018bf
+  8018bb:	89 e5                	mov    %esp,%ebp
+  8018bd:	0f 34                	sysenter
+  8018bf:	83 c4 04             	add    $0x4,%esp
+  8018c2:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8018c3:	85 c0                	test   %eax,%eax
+  8018c5:	7f 6b                	jg     801932 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  8018c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018ca:	5b                   	pop    %ebx
+  8018cb:	5e                   	pop    %esi
+  8018cc:	5f                   	pop    %edi
+  8018cd:	5d                   	pop    %ebp
+  8018ce:	c3                   	ret
+  8018cf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018d4:	0f a2                	cpuid
+		return 0;
+  8018d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018db:	f6 c6 08             	test   $0x8,%dh
+  8018de:	74 15                	je     8018f5 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018e0:	89 c2                	mov    %eax,%edx
+  8018e2:	c1 ea 08             	shr    $0x8,%edx
+  8018e5:	83 e2 0f             	and    $0xf,%edx
+  8018e8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018ed:	83 fa 06             	cmp    $0x6,%edx
+  8018f0:	74 0e                	je     801900 <sys_ep_destroy+0x79>
+  8018f2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8018f5:	0f b6 c9             	movzbl %cl,%ecx
+  8018f8:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8018fe:	eb 99                	jmp    801899 <sys_ep_destroy+0x12>
+  801900:	89 c2                	mov    %eax,%edx
+  801902:	c1 ea 04             	shr    $0x4,%edx
+  801905:	83 e2 0f             	and    $0xf,%edx
+  801908:	83 fa 02             	cmp    $0x2,%edx
+  80190b:	77 e5                	ja     8018f2 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  80190d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801910:	83 f8 02             	cmp    $0x2,%eax
+  801913:	0f 97 c1             	seta   %cl
+  801916:	0f b6 c9             	movzbl %cl,%ecx
+  801919:	eb d7                	jmp    8018f2 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  80191b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801920:	b8 23 00 00 00       	mov    $0x23,%eax
+  801925:	8b 55 08             	mov    0x8(%ebp),%edx
+  801928:	89 cb                	mov    %ecx,%ebx
+  80192a:	89 cf                	mov    %ecx,%edi
+  80192c:	89 ce                	mov    %ecx,%esi
+  80192e:	cd 30                	int    $0x30
+  801930:	eb 91                	jmp    8018c3 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801932:	83 ec 0c             	sub    $0xc,%esp
+  801935:	50                   	push   %eax
+  801936:	6a 23                	push   $0x23
+  801938:	68 aa 27 80 00       	push   $0x8027aa
+  80193d:	6a 4a                	push   $0x4a
+  80193f:	68 c7 27 80 00       	push   $0x8027c7
+  801944:	e8 b8 02 00 00       	call   801c01 <_panic>
+
+00801949 <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  801949:	55                   	push   %ebp
+  80194a:	89 e5                	mov    %esp,%ebp
+  80194c:	57                   	push   %edi
+  80194d:	56                   	push   %esi
+  80194e:	53                   	push   %ebx
+  80194f:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801952:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801959:	78 37                	js     801992 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  80195b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801962:	74 7a                	je     8019de <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  801964:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801969:	8b 55 08             	mov    0x8(%ebp),%edx
+  80196c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80196f:	b8 24 00 00 00       	mov    $0x24,%eax
+  801974:	89 df                	mov    %ebx,%edi
+  801976:	89 de                	mov    %ebx,%esi
+  801978:	55                   	push   %ebp
+  801979:	68 82 19 80 00       	push   $0x801982
+  80197e:	89 e5                	mov    %esp,%ebp
+  801980:	0f 34                	sysenter
+  801982:	83 c4 04             	add    $0x4,%esp
+  801985:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801986:	85 c0                	test   %eax,%eax
+  801988:	7f 6c                	jg     8019f6 <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  80198a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80198d:	5b                   	pop    %ebx
+  80198e:	5e                   	pop    %esi
+  80198f:	5f                   	pop    %edi
+  801990:	5d                   	pop    %ebp
+  801991:	c3                   	ret
+  801992:	b8 01 00 00 00       	mov    $0x1,%eax
+  801997:	0f a2                	cpuid
+		return 0;
+  801999:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80199e:	f6 c6 08             	test   $0x8,%dh
+  8019a1:	74 15                	je     8019b8 <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019a3:	89 c2                	mov    %eax,%edx
+  8019a5:	c1 ea 08             	shr    $0x8,%edx
+  8019a8:	83 e2 0f             	and    $0xf,%edx
+  8019ab:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019b0:	83 fa 06             	cmp    $0x6,%edx
+  8019b3:	74 0e                	je     8019c3 <sys_ep_grant+0x7a>
+  8019b5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8019b8:	0f b6 c9             	movzbl %cl,%ecx
+  8019bb:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8019c1:	eb 98                	jmp    80195b <sys_ep_grant+0x12>
+  8019c3:	89 c2                	mov    %eax,%edx
+  8019c5:	c1 ea 04             	shr    $0x4,%edx
+  8019c8:	83 e2 0f             	and    $0xf,%edx
+  8019cb:	83 fa 02             	cmp    $0x2,%edx
+  8019ce:	77 e5                	ja     8019b5 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  8019d0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019d3:	83 f8 02             	cmp    $0x2,%eax
+  8019d6:	0f 97 c1             	seta   %cl
+  8019d9:	0f b6 c9             	movzbl %cl,%ecx
+  8019dc:	eb d7                	jmp    8019b5 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  8019de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019e3:	b8 24 00 00 00       	mov    $0x24,%eax
+  8019e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019ee:	89 df                	mov    %ebx,%edi
+  8019f0:	89 de                	mov    %ebx,%esi
+  8019f2:	cd 30                	int    $0x30
+  8019f4:	eb 90                	jmp    801986 <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8019f6:	83 ec 0c             	sub    $0xc,%esp
+  8019f9:	50                   	push   %eax
+  8019fa:	6a 24                	push   $0x24
+  8019fc:	68 aa 27 80 00       	push   $0x8027aa
+  801a01:	6a 4a                	push   $0x4a
+  801a03:	68 c7 27 80 00       	push   $0x8027c7
+  801a08:	e8 f4 01 00 00       	call   801c01 <_panic>
+
+00801a0d <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  801a0d:	55                   	push   %ebp
+  801a0e:	89 e5                	mov    %esp,%ebp
+  801a10:	57                   	push   %edi
+  801a11:	56                   	push   %esi
+  801a12:	53                   	push   %ebx
+  801a13:	83 ec 20             	sub    $0x20,%esp
+  801a16:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801a19:	8b 10                	mov    (%eax),%edx
+  801a1b:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801a1e:	8b 50 04             	mov    0x4(%eax),%edx
+  801a21:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801a24:	8b 50 08             	mov    0x8(%eax),%edx
+  801a27:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801a2a:	8b 50 0c             	mov    0xc(%eax),%edx
+  801a2d:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801a30:	8b 40 10             	mov    0x10(%eax),%eax
+  801a33:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801a36:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801a39:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a3c:	b8 25 00 00 00       	mov    $0x25,%eax
+  801a41:	55                   	push   %ebp
+  801a42:	56                   	push   %esi
+  801a43:	8b 0e                	mov    (%esi),%ecx
+  801a45:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801a48:	8b 7e 08             	mov    0x8(%esi),%edi
+  801a4b:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801a4e:	8b 76 0c             	mov    0xc(%esi),%esi
+  801a51:	cd 30                	int    $0x30
+  801a53:	87 34 24             	xchg   %esi,(%esp)
+  801a56:	89 0e                	mov    %ecx,(%esi)
+  801a58:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801a5b:	89 7e 08             	mov    %edi,0x8(%esi)
+  801a5e:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801a61:	8f 46 0c             	pop    0xc(%esi)
+  801a64:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  801a65:	83 c4 20             	add    $0x20,%esp
+  801a68:	5b                   	pop    %ebx
+  801a69:	5e                   	pop    %esi
+  801a6a:	5f                   	pop    %edi
+  801a6b:	5d                   	pop    %ebp
+  801a6c:	c3                   	ret
+
+00801a6d <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  801a6d:	55                   	push   %ebp
+  801a6e:	89 e5                	mov    %esp,%ebp
+  801a70:	57                   	push   %edi
+  801a71:	56                   	push   %esi
+  801a72:	53                   	push   %ebx
+  801a73:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  801a76:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a79:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  801a7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a7e:	b8 26 00 00 00       	mov    $0x26,%eax
+  801a83:	55                   	push   %ebp
+  801a84:	56                   	push   %esi
+  801a85:	8b 0e                	mov    (%esi),%ecx
+  801a87:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801a8a:	8b 7e 08             	mov    0x8(%esi),%edi
+  801a8d:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801a90:	8b 76 0c             	mov    0xc(%esi),%esi
+  801a93:	cd 30                	int    $0x30
+  801a95:	87 34 24             	xchg   %esi,(%esp)
+  801a98:	89 0e                	mov    %ecx,(%esi)
+  801a9a:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801a9d:	89 7e 08             	mov    %edi,0x8(%esi)
+  801aa0:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801aa3:	8f 46 0c             	pop    0xc(%esi)
+  801aa6:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  801aa7:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  801aab:	74 0f                	je     801abc <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  801aad:	85 c0                	test   %eax,%eax
+  801aaf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ab4:	0f 48 d1             	cmovs  %ecx,%edx
+  801ab7:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  801aba:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  801abc:	5b                   	pop    %ebx
+  801abd:	5e                   	pop    %esi
+  801abe:	5f                   	pop    %edi
+  801abf:	5d                   	pop    %ebp
+  801ac0:	c3                   	ret
+
+00801ac1 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  801ac1:	55                   	push   %ebp
+  801ac2:	89 e5                	mov    %esp,%ebp
+  801ac4:	57                   	push   %edi
+  801ac5:	56                   	push   %esi
+  801ac6:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801ac7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801ace:	78 2f                	js     801aff <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  801ad0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801ad7:	74 72                	je     801b4b <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  801ad9:	8b 55 08             	mov    0x8(%ebp),%edx
+  801adc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ae1:	b8 27 00 00 00       	mov    $0x27,%eax
+  801ae6:	89 cb                	mov    %ecx,%ebx
+  801ae8:	89 cf                	mov    %ecx,%edi
+  801aea:	89 ce                	mov    %ecx,%esi
+  801aec:	55                   	push   %ebp
+  801aed:	68 f6 1a 80 00       	push   $0x801af6
+  801af2:	89 e5                	mov    %esp,%ebp
+  801af4:	0f 34                	sysenter
+  801af6:	83 c4 04             	add    $0x4,%esp
+  801af9:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  801afa:	5b                   	pop    %ebx
+  801afb:	5e                   	pop    %esi
+  801afc:	5f                   	pop    %edi
+  801afd:	5d                   	pop    %ebp
+  801afe:	c3                   	ret
+  801aff:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b04:	0f a2                	cpuid
+		return 0;
+  801b06:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b0b:	f6 c6 08             	test   $0x8,%dh
+  801b0e:	74 15                	je     801b25 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b10:	89 c2                	mov    %eax,%edx
+  801b12:	c1 ea 08             	shr    $0x8,%edx
+  801b15:	83 e2 0f             	and    $0xf,%edx
+  801b18:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b1d:	83 fa 06             	cmp    $0x6,%edx
+  801b20:	74 0e                	je     801b30 <sys_sysring_setup+0x6f>
+  801b22:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b25:	0f b6 c9             	movzbl %cl,%ecx
+  801b28:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801b2e:	eb a0                	jmp    801ad0 <sys_sysring_setup+0xf>
+  801b30:	89 c2                	mov    %eax,%edx
+  801b32:	c1 ea 04             	shr    $0x4,%edx
+  801b35:	83 e2 0f             	and    $0xf,%edx
+  801b38:	83 fa 02             	cmp    $0x2,%edx
+  801b3b:	77 e5                	ja     801b22 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  801b3d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b40:	83 f8 02             	cmp    $0x2,%eax
+  801b43:	0f 97 c1             	seta   %cl
+  801b46:	0f b6 c9             	movzbl %cl,%ecx
+  801b49:	eb d7                	jmp    801b22 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  801b4b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b50:	b8 27 00 00 00       	mov    $0x27,%eax
+  801b55:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b58:	89 cb                	mov    %ecx,%ebx
+  801b5a:	89 cf                	mov    %ecx,%edi
+  801b5c:	89 ce                	mov    %ecx,%esi
+  801b5e:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  801b60:	eb 98                	jmp    801afa <sys_sysring_setup+0x39>
+
+00801b62 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  801b62:	55                   	push   %ebp
+  801b63:	89 e5                	mov    %esp,%ebp
+  801b65:	57                   	push   %edi
+  801b66:	56                   	push   %esi
+  801b67:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801b68:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b6f:	78 2e                	js     801b9f <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  801b71:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b78:	74 71                	je     801beb <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  801b7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b7f:	b8 28 00 00 00       	mov    $0x28,%eax
+  801b84:	89 d1                	mov    %edx,%ecx
+  801b86:	89 d3                	mov    %edx,%ebx
+  801b88:	89 d7                	mov    %edx,%edi
+  801b8a:	89 d6                	mov    %edx,%esi
+  801b8c:	55                   	push   %ebp
+  801b8d:	68 96 1b 80 00       	push   $0x801b96
+  801b92:	89 e5                	mov    %esp,%ebp
+  801b94:	0f 34                	sysenter
+  801b96:	83 c4 04             	add    $0x4,%esp
+  801b99:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801b9a:	5b                   	pop    %ebx
+  801b9b:	5e                   	pop    %esi
+  801b9c:	5f                   	pop    %edi
+  801b9d:	5d                   	pop    %ebp
+  801b9e:	c3                   	ret
+  801b9f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ba4:	0f a2                	cpuid
+		return 0;
+  801ba6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801bab:	f6 c6 08             	test   $0x8,%dh
+  801bae:	74 15                	je     801bc5 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bb0:	89 c2                	mov    %eax,%edx
+  801bb2:	c1 ea 08             	shr    $0x8,%edx
+  801bb5:	83 e2 0f             	and    $0xf,%edx
+  801bb8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801bbd:	83 fa 06             	cmp    $0x6,%edx
+  801bc0:	74 0e                	je     801bd0 <sys_sysring_enter+0x6e>
+  801bc2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801bc5:	0f b6 c9             	movzbl %cl,%ecx
+  801bc8:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801bce:	eb a1                	jmp    801b71 <sys_sysring_enter+0xf>
+  801bd0:	89 c2                	mov    %eax,%edx
+  801bd2:	c1 ea 04             	shr    $0x4,%edx
+  801bd5:	83 e2 0f             	and    $0xf,%edx
+  801bd8:	83 fa 02             	cmp    $0x2,%edx
+  801bdb:	77 e5                	ja     801bc2 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  801bdd:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801be0:	83 f8 02             	cmp    $0x2,%eax
+  801be3:	0f 97 c1             	seta   %cl
+  801be6:	0f b6 c9             	movzbl %cl,%ecx
+  801be9:	eb d7                	jmp    801bc2 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  801beb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bf0:	b8 28 00 00 00       	mov    $0x28,%eax
+  801bf5:	89 d1                	mov    %edx,%ecx
+  801bf7:	89 d3                	mov    %edx,%ebx
+  801bf9:	89 d7                	mov    %edx,%edi
+  801bfb:	89 d6                	mov    %edx,%esi
+  801bfd:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  801bff:	eb 99                	jmp    801b9a <sys_sysring_enter+0x38>
+
+00801c01 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801c01:	55                   	push   %ebp
+  801c02:	89 e5                	mov    %esp,%ebp
+  801c04:	57                   	push   %edi
+  801c05:	56                   	push   %esi
+  801c06:	53                   	push   %ebx
+  801c07:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  801c0d:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  801c10:	8b 1d 00 30 80 00    	mov    0x803000,%ebx
+  801c16:	e8 c8 e8 ff ff       	call   8004e3 <sys_getenvid>
+  801c1b:	83 ec 04             	sub    $0x4,%esp
+  801c1e:	ff 75 0c             	push   0xc(%ebp)
+  801c21:	ff 75 08             	push   0x8(%ebp)
+  801c24:	53                   	push   %ebx
+  801c25:	50                   	push   %eax
+  801c26:	68 d8 27 80 00       	push   $0x8027d8
+  801c2b:	68 00 01 00 00       	push   $0x100
+  801c30:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  801c36:	56                   	push   %esi
+  801c37:	e8 c9 05 00 00       	call   802205 <snprintf>
+  801c3c:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  801c3e:	83 c4 20             	add    $0x20,%esp
+  801c41:	57                   	push   %edi
+  801c42:	ff 75 10             	push   0x10(%ebp)
+  801c45:	bf 00 01 00 00       	mov    $0x100,%edi
+  801c4a:	89 f8                	mov    %edi,%eax
+  801c4c:	29 d8                	sub    %ebx,%eax
+  801c4e:	50                   	push   %eax
+  801c4f:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801c52:	50                   	push   %eax
+  801c53:	e8 5f 05 00 00       	call   8021b7 <vsnprintf>
+  801c58:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  801c5a:	83 c4 0c             	add    $0xc,%esp
+  801c5d:	68 fb 27 80 00       	push   $0x8027fb
+  801c62:	29 df                	sub    %ebx,%edi
+  801c64:	57                   	push   %edi
+  801c65:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801c68:	50                   	push   %eax
+  801c69:	e8 97 05 00 00       	call   802205 <snprintf>
+	sys_cputs(buf, r);
+  801c6e:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  801c71:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  801c73:	53                   	push   %ebx
+  801c74:	56                   	push   %esi
+  801c75:	e8 6b e6 ff ff       	call   8002e5 <sys_cputs>
+  801c7a:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801c7d:	cc                   	int3
+	while (1)
+  801c7e:	eb fd                	jmp    801c7d <_panic+0x7c>
+
+00801c80 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801c80:	55                   	push   %ebp
+  801c81:	89 e5                	mov    %esp,%ebp
+  801c83:	57                   	push   %edi
+  801c84:	56                   	push   %esi
+  801c85:	53                   	push   %ebx
+  801c86:	83 ec 1c             	sub    $0x1c,%esp
+  801c89:	89 c7                	mov    %eax,%edi
+  801c8b:	89 d6                	mov    %edx,%esi
+  801c8d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c90:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c93:	89 d1                	mov    %edx,%ecx
+  801c95:	89 c2                	mov    %eax,%edx
+  801c97:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801c9a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801c9d:	8b 45 10             	mov    0x10(%ebp),%eax
+  801ca0:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  801ca3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801ca6:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801cad:	39 c2                	cmp    %eax,%edx
+  801caf:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  801cb2:	72 3e                	jb     801cf2 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801cb4:	83 ec 0c             	sub    $0xc,%esp
+  801cb7:	ff 75 18             	push   0x18(%ebp)
+  801cba:	83 eb 01             	sub    $0x1,%ebx
+  801cbd:	53                   	push   %ebx
+  801cbe:	50                   	push   %eax
+  801cbf:	83 ec 08             	sub    $0x8,%esp
+  801cc2:	ff 75 e4             	push   -0x1c(%ebp)
+  801cc5:	ff 75 e0             	push   -0x20(%ebp)
+  801cc8:	ff 75 dc             	push   -0x24(%ebp)
+  801ccb:	ff 75 d8             	push   -0x28(%ebp)
+  801cce:	e8 9a 09 00 00       	call   80266d <__udivdi3>
+  801cd3:	83 c4 18             	add    $0x18,%esp
+  801cd6:	52                   	push   %edx
+  801cd7:	50                   	push   %eax
+  801cd8:	89 f2                	mov    %esi,%edx
+  801cda:	89 f8                	mov    %edi,%eax
+  801cdc:	e8 9f ff ff ff       	call   801c80 <printnum>
+  801ce1:	83 c4 20             	add    $0x20,%esp
+  801ce4:	eb 13                	jmp    801cf9 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  801ce6:	83 ec 08             	sub    $0x8,%esp
+  801ce9:	56                   	push   %esi
+  801cea:	ff 75 18             	push   0x18(%ebp)
+  801ced:	ff d7                	call   *%edi
+  801cef:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  801cf2:	83 eb 01             	sub    $0x1,%ebx
+  801cf5:	85 db                	test   %ebx,%ebx
+  801cf7:	7f ed                	jg     801ce6 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  801cf9:	83 ec 08             	sub    $0x8,%esp
+  801cfc:	56                   	push   %esi
+  801cfd:	83 ec 04             	sub    $0x4,%esp
+  801d00:	ff 75 e4             	push   -0x1c(%ebp)
+  801d03:	ff 75 e0             	push   -0x20(%ebp)
+  801d06:	ff 75 dc             	push   -0x24(%ebp)
+  801d09:	ff 75 d8             	push   -0x28(%ebp)
+  801d0c:	e8 7a 09 00 00       	call   80268b <__umoddi3>
+  801d11:	83 c4 14             	add    $0x14,%esp
+  801d14:	0f be 80 fd 27 80 00 	movsbl 0x8027fd(%eax),%eax
+  801d1b:	50                   	push   %eax
+  801d1c:	ff d7                	call   *%edi
+}
+  801d1e:	83 c4 10             	add    $0x10,%esp
+  801d21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d24:	5b                   	pop    %ebx
+  801d25:	5e                   	pop    %esi
+  801d26:	5f                   	pop    %edi
+  801d27:	5d                   	pop    %ebp
+  801d28:	c3                   	ret
+
+00801d29 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801d29:	55                   	push   %ebp
+  801d2a:	89 e5                	mov    %esp,%ebp
+  801d2c:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  801d2f:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  801d33:	8b 10                	mov    (%eax),%edx
+  801d35:	3b 50 04             	cmp    0x4(%eax),%edx
+  801d38:	73 0a                	jae    801d44 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  801d3a:	8d 4a 01             	lea    0x1(%edx),%ecx
+  801d3d:	89 08                	mov    %ecx,(%eax)
+  801d3f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d42:	88 02                	mov    %al,(%edx)
+}
+  801d44:	5d                   	pop    %ebp
+  801d45:	c3                   	ret
+
+00801d46 <printfmt>:
+{
+  801d46:	55                   	push   %ebp
+  801d47:	89 e5                	mov    %esp,%ebp
+  801d49:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  801d4c:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  801d4f:	50                   	push   %eax
+  801d50:	ff 75 10             	push   0x10(%ebp)
+  801d53:	ff 75 0c             	push   0xc(%ebp)
+  801d56:	ff 75 08             	push   0x8(%ebp)
+  801d59:	e8 05 00 00 00       	call   801d63 <vprintfmt>
+}
+  801d5e:	83 c4 10             	add    $0x10,%esp
+  801d61:	c9                   	leave
+  801d62:	c3                   	ret
+
+00801d63 <vprintfmt>:
+{
+  801d63:	55                   	push   %ebp
+  801d64:	89 e5                	mov    %esp,%ebp
+  801d66:	57                   	push   %edi
+  801d67:	56                   	push   %esi
+  801d68:	53                   	push   %ebx
+  801d69:	83 ec 2c             	sub    $0x2c,%esp
+  801d6c:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d6f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801d72:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801d75:	eb 0a                	jmp    801d81 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  801d77:	83 ec 08             	sub    $0x8,%esp
+  801d7a:	53                   	push   %ebx
+  801d7b:	50                   	push   %eax
+  801d7c:	ff d6                	call   *%esi
+  801d7e:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801d81:	83 c7 01             	add    $0x1,%edi
+  801d84:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801d88:	83 f8 25             	cmp    $0x25,%eax
+  801d8b:	74 0c                	je     801d99 <vprintfmt+0x36>
+			if (ch == '\0')
+  801d8d:	85 c0                	test   %eax,%eax
+  801d8f:	75 e6                	jne    801d77 <vprintfmt+0x14>
+}
+  801d91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d94:	5b                   	pop    %ebx
+  801d95:	5e                   	pop    %esi
+  801d96:	5f                   	pop    %edi
+  801d97:	5d                   	pop    %ebp
+  801d98:	c3                   	ret
+		padc = ' ';
+  801d99:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801d9d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  801da4:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801dab:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  801db2:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801db7:	8d 47 01             	lea    0x1(%edi),%eax
+  801dba:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801dbd:	0f b6 17             	movzbl (%edi),%edx
+  801dc0:	8d 42 dd             	lea    -0x23(%edx),%eax
+  801dc3:	3c 55                	cmp    $0x55,%al
+  801dc5:	0f 87 cf 03 00 00    	ja     80219a <vprintfmt+0x437>
+  801dcb:	0f b6 c0             	movzbl %al,%eax
+  801dce:	ff 24 85 e0 28 80 00 	jmp    *0x8028e0(,%eax,4)
+  801dd5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801dd8:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801ddc:	eb d9                	jmp    801db7 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801dde:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801de1:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  801de5:	eb d0                	jmp    801db7 <vprintfmt+0x54>
+  801de7:	0f b6 d2             	movzbl %dl,%edx
+  801dea:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  801ded:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  801df5:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801df8:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  801dfc:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  801dff:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  801e02:	83 f9 09             	cmp    $0x9,%ecx
+  801e05:	77 55                	ja     801e5c <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  801e07:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  801e0a:	eb e9                	jmp    801df5 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  801e0c:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e0f:	8b 00                	mov    (%eax),%eax
+  801e11:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801e14:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e17:	8d 40 04             	lea    0x4(%eax),%eax
+  801e1a:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801e1d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  801e20:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801e24:	79 91                	jns    801db7 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  801e26:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801e29:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801e2c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  801e33:	eb 82                	jmp    801db7 <vprintfmt+0x54>
+			if (width < 0)
+  801e35:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801e38:	85 d2                	test   %edx,%edx
+  801e3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e3f:	0f 49 c2             	cmovns %edx,%eax
+  801e42:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801e45:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801e48:	e9 6a ff ff ff       	jmp    801db7 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801e4d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  801e50:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  801e57:	e9 5b ff ff ff       	jmp    801db7 <vprintfmt+0x54>
+  801e5c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801e5f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801e62:	eb bc                	jmp    801e20 <vprintfmt+0xbd>
+			lflag++;
+  801e64:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801e67:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801e6a:	e9 48 ff ff ff       	jmp    801db7 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  801e6f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e72:	8d 78 04             	lea    0x4(%eax),%edi
+  801e75:	83 ec 08             	sub    $0x8,%esp
+  801e78:	53                   	push   %ebx
+  801e79:	ff 30                	push   (%eax)
+  801e7b:	ff d6                	call   *%esi
+			break;
+  801e7d:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801e80:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  801e83:	e9 b1 02 00 00       	jmp    802139 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  801e88:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e8b:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801e8e:	8b 10                	mov    (%eax),%edx
+  801e90:	89 d0                	mov    %edx,%eax
+  801e92:	f7 d8                	neg    %eax
+  801e94:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801e97:	83 f8 0d             	cmp    $0xd,%eax
+  801e9a:	7f 23                	jg     801ebf <vprintfmt+0x15c>
+  801e9c:	8b 14 85 40 2a 80 00 	mov    0x802a40(,%eax,4),%edx
+  801ea3:	85 d2                	test   %edx,%edx
+  801ea5:	74 18                	je     801ebf <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801ea7:	52                   	push   %edx
+  801ea8:	68 1e 28 80 00       	push   $0x80281e
+  801ead:	53                   	push   %ebx
+  801eae:	56                   	push   %esi
+  801eaf:	e8 92 fe ff ff       	call   801d46 <printfmt>
+  801eb4:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801eb7:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801eba:	e9 7a 02 00 00       	jmp    802139 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  801ebf:	50                   	push   %eax
+  801ec0:	68 15 28 80 00       	push   $0x802815
+  801ec5:	53                   	push   %ebx
+  801ec6:	56                   	push   %esi
+  801ec7:	e8 7a fe ff ff       	call   801d46 <printfmt>
+  801ecc:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801ecf:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801ed2:	e9 62 02 00 00       	jmp    802139 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801ed7:	8b 45 14             	mov    0x14(%ebp),%eax
+  801eda:	83 c0 04             	add    $0x4,%eax
+  801edd:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801ee0:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ee3:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801ee5:	85 c9                	test   %ecx,%ecx
+  801ee7:	b8 0e 28 80 00       	mov    $0x80280e,%eax
+  801eec:	0f 45 c1             	cmovne %ecx,%eax
+  801eef:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801ef2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801ef6:	7e 06                	jle    801efe <vprintfmt+0x19b>
+  801ef8:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801efc:	75 0b                	jne    801f09 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801efe:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801f01:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801f04:	89 75 08             	mov    %esi,0x8(%ebp)
+  801f07:	eb 5c                	jmp    801f65 <vprintfmt+0x202>
+  801f09:	83 ec 08             	sub    $0x8,%esp
+  801f0c:	ff 75 d0             	push   -0x30(%ebp)
+  801f0f:	ff 75 cc             	push   -0x34(%ebp)
+  801f12:	e8 20 03 00 00       	call   802237 <strnlen>
+  801f17:	89 c2                	mov    %eax,%edx
+  801f19:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f1c:	29 d0                	sub    %edx,%eax
+  801f1e:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801f21:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  801f25:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801f28:	89 75 08             	mov    %esi,0x8(%ebp)
+  801f2b:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f2d:	eb 0e                	jmp    801f3d <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801f2f:	83 ec 08             	sub    $0x8,%esp
+  801f32:	53                   	push   %ebx
+  801f33:	57                   	push   %edi
+  801f34:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f37:	83 ee 01             	sub    $0x1,%esi
+  801f3a:	83 c4 10             	add    $0x10,%esp
+  801f3d:	85 f6                	test   %esi,%esi
+  801f3f:	7f ee                	jg     801f2f <vprintfmt+0x1cc>
+  801f41:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f44:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f47:	85 c0                	test   %eax,%eax
+  801f49:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f4e:	0f 49 d0             	cmovns %eax,%edx
+  801f51:	29 d0                	sub    %edx,%eax
+  801f53:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801f56:	eb a6                	jmp    801efe <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801f58:	83 ec 08             	sub    $0x8,%esp
+  801f5b:	53                   	push   %ebx
+  801f5c:	52                   	push   %edx
+  801f5d:	ff 55 08             	call   *0x8(%ebp)
+  801f60:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801f63:	89 f1                	mov    %esi,%ecx
+  801f65:	8d 71 01             	lea    0x1(%ecx),%esi
+  801f68:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801f6c:	0f be d0             	movsbl %al,%edx
+  801f6f:	85 d2                	test   %edx,%edx
+  801f71:	74 28                	je     801f9b <vprintfmt+0x238>
+  801f73:	85 ff                	test   %edi,%edi
+  801f75:	78 05                	js     801f7c <vprintfmt+0x219>
+  801f77:	83 ef 01             	sub    $0x1,%edi
+  801f7a:	78 30                	js     801fac <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801f7c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801f80:	74 d6                	je     801f58 <vprintfmt+0x1f5>
+  801f82:	0f be c0             	movsbl %al,%eax
+  801f85:	83 e8 20             	sub    $0x20,%eax
+  801f88:	83 f8 5e             	cmp    $0x5e,%eax
+  801f8b:	76 cb                	jbe    801f58 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801f8d:	83 ec 08             	sub    $0x8,%esp
+  801f90:	53                   	push   %ebx
+  801f91:	6a 3f                	push   $0x3f
+  801f93:	ff 55 08             	call   *0x8(%ebp)
+  801f96:	83 c4 10             	add    $0x10,%esp
+  801f99:	eb c8                	jmp    801f63 <vprintfmt+0x200>
+  801f9b:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f9e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801fa1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801fa4:	01 d0                	add    %edx,%eax
+  801fa6:	29 c8                	sub    %ecx,%eax
+  801fa8:	89 c7                	mov    %eax,%edi
+  801faa:	eb 13                	jmp    801fbf <vprintfmt+0x25c>
+  801fac:	8b 75 08             	mov    0x8(%ebp),%esi
+  801faf:	eb ed                	jmp    801f9e <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801fb1:	83 ec 08             	sub    $0x8,%esp
+  801fb4:	53                   	push   %ebx
+  801fb5:	6a 20                	push   $0x20
+  801fb7:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801fb9:	83 ef 01             	sub    $0x1,%edi
+  801fbc:	83 c4 10             	add    $0x10,%esp
+  801fbf:	85 ff                	test   %edi,%edi
+  801fc1:	7f ee                	jg     801fb1 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801fc3:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801fc6:	89 45 14             	mov    %eax,0x14(%ebp)
+  801fc9:	e9 6b 01 00 00       	jmp    802139 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  801fce:	83 f9 01             	cmp    $0x1,%ecx
+  801fd1:	7f 1f                	jg     801ff2 <vprintfmt+0x28f>
+	else if (lflag)
+  801fd3:	85 c9                	test   %ecx,%ecx
+  801fd5:	74 67                	je     80203e <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  801fd7:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fda:	8b 00                	mov    (%eax),%eax
+  801fdc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801fdf:	89 c1                	mov    %eax,%ecx
+  801fe1:	c1 f9 1f             	sar    $0x1f,%ecx
+  801fe4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801fe7:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fea:	8d 40 04             	lea    0x4(%eax),%eax
+  801fed:	89 45 14             	mov    %eax,0x14(%ebp)
+  801ff0:	eb 17                	jmp    802009 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  801ff2:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ff5:	8b 50 04             	mov    0x4(%eax),%edx
+  801ff8:	8b 00                	mov    (%eax),%eax
+  801ffa:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801ffd:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802000:	8b 45 14             	mov    0x14(%ebp),%eax
+  802003:	8d 40 08             	lea    0x8(%eax),%eax
+  802006:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  802009:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80200c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80200f:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  802014:	85 c9                	test   %ecx,%ecx
+  802016:	0f 89 03 01 00 00    	jns    80211f <vprintfmt+0x3bc>
+				putch('-', putdat);
+  80201c:	83 ec 08             	sub    $0x8,%esp
+  80201f:	53                   	push   %ebx
+  802020:	6a 2d                	push   $0x2d
+  802022:	ff d6                	call   *%esi
+				num = -(long long) num;
+  802024:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802027:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80202a:	f7 da                	neg    %edx
+  80202c:	83 d1 00             	adc    $0x0,%ecx
+  80202f:	f7 d9                	neg    %ecx
+  802031:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  802034:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802039:	e9 e1 00 00 00       	jmp    80211f <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80203e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802041:	8b 00                	mov    (%eax),%eax
+  802043:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802046:	89 c1                	mov    %eax,%ecx
+  802048:	c1 f9 1f             	sar    $0x1f,%ecx
+  80204b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80204e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802051:	8d 40 04             	lea    0x4(%eax),%eax
+  802054:	89 45 14             	mov    %eax,0x14(%ebp)
+  802057:	eb b0                	jmp    802009 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  802059:	83 f9 01             	cmp    $0x1,%ecx
+  80205c:	7f 1e                	jg     80207c <vprintfmt+0x319>
+	else if (lflag)
+  80205e:	85 c9                	test   %ecx,%ecx
+  802060:	74 32                	je     802094 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  802062:	8b 45 14             	mov    0x14(%ebp),%eax
+  802065:	8b 10                	mov    (%eax),%edx
+  802067:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80206c:	8d 40 04             	lea    0x4(%eax),%eax
+  80206f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802072:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  802077:	e9 a3 00 00 00       	jmp    80211f <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80207c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80207f:	8b 10                	mov    (%eax),%edx
+  802081:	8b 48 04             	mov    0x4(%eax),%ecx
+  802084:	8d 40 08             	lea    0x8(%eax),%eax
+  802087:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80208a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80208f:	e9 8b 00 00 00       	jmp    80211f <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802094:	8b 45 14             	mov    0x14(%ebp),%eax
+  802097:	8b 10                	mov    (%eax),%edx
+  802099:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80209e:	8d 40 04             	lea    0x4(%eax),%eax
+  8020a1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8020a4:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8020a9:	eb 74                	jmp    80211f <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8020ab:	83 f9 01             	cmp    $0x1,%ecx
+  8020ae:	7f 1b                	jg     8020cb <vprintfmt+0x368>
+	else if (lflag)
+  8020b0:	85 c9                	test   %ecx,%ecx
+  8020b2:	74 2c                	je     8020e0 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8020b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020b7:	8b 10                	mov    (%eax),%edx
+  8020b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020be:	8d 40 04             	lea    0x4(%eax),%eax
+  8020c1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8020c4:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8020c9:	eb 54                	jmp    80211f <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8020cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020ce:	8b 10                	mov    (%eax),%edx
+  8020d0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8020d3:	8d 40 08             	lea    0x8(%eax),%eax
+  8020d6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8020d9:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8020de:	eb 3f                	jmp    80211f <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8020e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020e3:	8b 10                	mov    (%eax),%edx
+  8020e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020ea:	8d 40 04             	lea    0x4(%eax),%eax
+  8020ed:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8020f0:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8020f5:	eb 28                	jmp    80211f <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8020f7:	83 ec 08             	sub    $0x8,%esp
+  8020fa:	53                   	push   %ebx
+  8020fb:	6a 30                	push   $0x30
+  8020fd:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8020ff:	83 c4 08             	add    $0x8,%esp
+  802102:	53                   	push   %ebx
+  802103:	6a 78                	push   $0x78
+  802105:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  802107:	8b 45 14             	mov    0x14(%ebp),%eax
+  80210a:	8b 10                	mov    (%eax),%edx
+  80210c:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  802111:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  802114:	8d 40 04             	lea    0x4(%eax),%eax
+  802117:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80211a:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80211f:	83 ec 0c             	sub    $0xc,%esp
+  802122:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  802126:	50                   	push   %eax
+  802127:	ff 75 e0             	push   -0x20(%ebp)
+  80212a:	57                   	push   %edi
+  80212b:	51                   	push   %ecx
+  80212c:	52                   	push   %edx
+  80212d:	89 da                	mov    %ebx,%edx
+  80212f:	89 f0                	mov    %esi,%eax
+  802131:	e8 4a fb ff ff       	call   801c80 <printnum>
+			break;
+  802136:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  802139:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80213c:	e9 40 fc ff ff       	jmp    801d81 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  802141:	83 f9 01             	cmp    $0x1,%ecx
+  802144:	7f 1b                	jg     802161 <vprintfmt+0x3fe>
+	else if (lflag)
+  802146:	85 c9                	test   %ecx,%ecx
+  802148:	74 2c                	je     802176 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  80214a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80214d:	8b 10                	mov    (%eax),%edx
+  80214f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802154:	8d 40 04             	lea    0x4(%eax),%eax
+  802157:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80215a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80215f:	eb be                	jmp    80211f <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802161:	8b 45 14             	mov    0x14(%ebp),%eax
+  802164:	8b 10                	mov    (%eax),%edx
+  802166:	8b 48 04             	mov    0x4(%eax),%ecx
+  802169:	8d 40 08             	lea    0x8(%eax),%eax
+  80216c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80216f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  802174:	eb a9                	jmp    80211f <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802176:	8b 45 14             	mov    0x14(%ebp),%eax
+  802179:	8b 10                	mov    (%eax),%edx
+  80217b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802180:	8d 40 04             	lea    0x4(%eax),%eax
+  802183:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802186:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80218b:	eb 92                	jmp    80211f <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  80218d:	83 ec 08             	sub    $0x8,%esp
+  802190:	53                   	push   %ebx
+  802191:	6a 25                	push   $0x25
+  802193:	ff d6                	call   *%esi
+			break;
+  802195:	83 c4 10             	add    $0x10,%esp
+  802198:	eb 9f                	jmp    802139 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  80219a:	83 ec 08             	sub    $0x8,%esp
+  80219d:	53                   	push   %ebx
+  80219e:	6a 25                	push   $0x25
+  8021a0:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8021a2:	83 c4 10             	add    $0x10,%esp
+  8021a5:	89 f8                	mov    %edi,%eax
+  8021a7:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8021ab:	74 05                	je     8021b2 <vprintfmt+0x44f>
+  8021ad:	83 e8 01             	sub    $0x1,%eax
+  8021b0:	eb f5                	jmp    8021a7 <vprintfmt+0x444>
+  8021b2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8021b5:	eb 82                	jmp    802139 <vprintfmt+0x3d6>
+
+008021b7 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8021b7:	55                   	push   %ebp
+  8021b8:	89 e5                	mov    %esp,%ebp
+  8021ba:	83 ec 18             	sub    $0x18,%esp
+  8021bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021c0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8021c3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8021c6:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8021ca:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8021cd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8021d4:	85 c0                	test   %eax,%eax
+  8021d6:	74 26                	je     8021fe <vsnprintf+0x47>
+  8021d8:	85 d2                	test   %edx,%edx
+  8021da:	7e 22                	jle    8021fe <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8021dc:	ff 75 14             	push   0x14(%ebp)
+  8021df:	ff 75 10             	push   0x10(%ebp)
+  8021e2:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8021e5:	50                   	push   %eax
+  8021e6:	68 29 1d 80 00       	push   $0x801d29
+  8021eb:	e8 73 fb ff ff       	call   801d63 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8021f0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8021f3:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8021f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021f9:	83 c4 10             	add    $0x10,%esp
+}
+  8021fc:	c9                   	leave
+  8021fd:	c3                   	ret
+		return -E_INVAL;
+  8021fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802203:	eb f7                	jmp    8021fc <vsnprintf+0x45>
+
+00802205 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  802205:	55                   	push   %ebp
+  802206:	89 e5                	mov    %esp,%ebp
+  802208:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80220b:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80220e:	50                   	push   %eax
+  80220f:	ff 75 10             	push   0x10(%ebp)
+  802212:	ff 75 0c             	push   0xc(%ebp)
+  802215:	ff 75 08             	push   0x8(%ebp)
+  802218:	e8 9a ff ff ff       	call   8021b7 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80221d:	c9                   	leave
+  80221e:	c3                   	ret
+
+0080221f <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80221f:	55                   	push   %ebp
+  802220:	89 e5                	mov    %esp,%ebp
+  802222:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  802225:	b8 00 00 00 00       	mov    $0x0,%eax
+  80222a:	eb 03                	jmp    80222f <strlen+0x10>
+		n++;
+  80222c:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80222f:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802233:	75 f7                	jne    80222c <strlen+0xd>
+	return n;
+}
+  802235:	5d                   	pop    %ebp
+  802236:	c3                   	ret
+
+00802237 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  802237:	55                   	push   %ebp
+  802238:	89 e5                	mov    %esp,%ebp
+  80223a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80223d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802240:	b8 00 00 00 00       	mov    $0x0,%eax
+  802245:	eb 03                	jmp    80224a <strnlen+0x13>
+		n++;
+  802247:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80224a:	39 d0                	cmp    %edx,%eax
+  80224c:	74 08                	je     802256 <strnlen+0x1f>
+  80224e:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802252:	75 f3                	jne    802247 <strnlen+0x10>
+  802254:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  802256:	89 d0                	mov    %edx,%eax
+  802258:	5d                   	pop    %ebp
+  802259:	c3                   	ret
+
+0080225a <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80225a:	55                   	push   %ebp
+  80225b:	89 e5                	mov    %esp,%ebp
+  80225d:	53                   	push   %ebx
+  80225e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802261:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  802264:	b8 00 00 00 00       	mov    $0x0,%eax
+  802269:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80226d:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  802270:	83 c0 01             	add    $0x1,%eax
+  802273:	84 d2                	test   %dl,%dl
+  802275:	75 f2                	jne    802269 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  802277:	89 c8                	mov    %ecx,%eax
+  802279:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80227c:	c9                   	leave
+  80227d:	c3                   	ret
+
+0080227e <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80227e:	55                   	push   %ebp
+  80227f:	89 e5                	mov    %esp,%ebp
+  802281:	53                   	push   %ebx
+  802282:	83 ec 10             	sub    $0x10,%esp
+  802285:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  802288:	53                   	push   %ebx
+  802289:	e8 91 ff ff ff       	call   80221f <strlen>
+  80228e:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  802291:	ff 75 0c             	push   0xc(%ebp)
+  802294:	01 d8                	add    %ebx,%eax
+  802296:	50                   	push   %eax
+  802297:	e8 be ff ff ff       	call   80225a <strcpy>
+	return dst;
+}
+  80229c:	89 d8                	mov    %ebx,%eax
+  80229e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022a1:	c9                   	leave
+  8022a2:	c3                   	ret
+
+008022a3 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8022a3:	55                   	push   %ebp
+  8022a4:	89 e5                	mov    %esp,%ebp
+  8022a6:	56                   	push   %esi
+  8022a7:	53                   	push   %ebx
+  8022a8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8022ab:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8022ae:	89 f3                	mov    %esi,%ebx
+  8022b0:	03 5d 10             	add    0x10(%ebp),%ebx
+  8022b3:	89 f0                	mov    %esi,%eax
+  8022b5:	eb 0f                	jmp    8022c6 <strncpy+0x23>
+		*dst++ = *src;
+  8022b7:	83 c0 01             	add    $0x1,%eax
+  8022ba:	0f b6 0a             	movzbl (%edx),%ecx
+  8022bd:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8022c0:	80 f9 01             	cmp    $0x1,%cl
+  8022c3:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8022c6:	39 d8                	cmp    %ebx,%eax
+  8022c8:	75 ed                	jne    8022b7 <strncpy+0x14>
+	}
+	return ret;
+}
+  8022ca:	89 f0                	mov    %esi,%eax
+  8022cc:	5b                   	pop    %ebx
+  8022cd:	5e                   	pop    %esi
+  8022ce:	5d                   	pop    %ebp
+  8022cf:	c3                   	ret
+
+008022d0 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8022d0:	55                   	push   %ebp
+  8022d1:	89 e5                	mov    %esp,%ebp
+  8022d3:	56                   	push   %esi
+  8022d4:	53                   	push   %ebx
+  8022d5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8022d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022db:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8022de:	89 f0                	mov    %esi,%eax
+  8022e0:	85 d2                	test   %edx,%edx
+  8022e2:	74 21                	je     802305 <strlcpy+0x35>
+  8022e4:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8022e8:	89 f2                	mov    %esi,%edx
+  8022ea:	eb 09                	jmp    8022f5 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8022ec:	83 c1 01             	add    $0x1,%ecx
+  8022ef:	83 c2 01             	add    $0x1,%edx
+  8022f2:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8022f5:	39 c2                	cmp    %eax,%edx
+  8022f7:	74 09                	je     802302 <strlcpy+0x32>
+  8022f9:	0f b6 19             	movzbl (%ecx),%ebx
+  8022fc:	84 db                	test   %bl,%bl
+  8022fe:	75 ec                	jne    8022ec <strlcpy+0x1c>
+  802300:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  802302:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  802305:	29 f0                	sub    %esi,%eax
+}
+  802307:	5b                   	pop    %ebx
+  802308:	5e                   	pop    %esi
+  802309:	5d                   	pop    %ebp
+  80230a:	c3                   	ret
+
+0080230b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80230b:	55                   	push   %ebp
+  80230c:	89 e5                	mov    %esp,%ebp
+  80230e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802311:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  802314:	eb 06                	jmp    80231c <strcmp+0x11>
+		p++, q++;
+  802316:	83 c1 01             	add    $0x1,%ecx
+  802319:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80231c:	0f b6 01             	movzbl (%ecx),%eax
+  80231f:	84 c0                	test   %al,%al
+  802321:	74 04                	je     802327 <strcmp+0x1c>
+  802323:	3a 02                	cmp    (%edx),%al
+  802325:	74 ef                	je     802316 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  802327:	0f b6 c0             	movzbl %al,%eax
+  80232a:	0f b6 12             	movzbl (%edx),%edx
+  80232d:	29 d0                	sub    %edx,%eax
+}
+  80232f:	5d                   	pop    %ebp
+  802330:	c3                   	ret
+
+00802331 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  802331:	55                   	push   %ebp
+  802332:	89 e5                	mov    %esp,%ebp
+  802334:	53                   	push   %ebx
+  802335:	8b 45 08             	mov    0x8(%ebp),%eax
+  802338:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80233b:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80233e:	eb 09                	jmp    802349 <strncmp+0x18>
+		n--, p++, q++;
+  802340:	83 ea 01             	sub    $0x1,%edx
+  802343:	83 c0 01             	add    $0x1,%eax
+  802346:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  802349:	85 d2                	test   %edx,%edx
+  80234b:	74 18                	je     802365 <strncmp+0x34>
+  80234d:	0f b6 18             	movzbl (%eax),%ebx
+  802350:	84 db                	test   %bl,%bl
+  802352:	74 04                	je     802358 <strncmp+0x27>
+  802354:	3a 19                	cmp    (%ecx),%bl
+  802356:	74 e8                	je     802340 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  802358:	0f b6 00             	movzbl (%eax),%eax
+  80235b:	0f b6 11             	movzbl (%ecx),%edx
+  80235e:	29 d0                	sub    %edx,%eax
+}
+  802360:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802363:	c9                   	leave
+  802364:	c3                   	ret
+		return 0;
+  802365:	b8 00 00 00 00       	mov    $0x0,%eax
+  80236a:	eb f4                	jmp    802360 <strncmp+0x2f>
+
+0080236c <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80236c:	55                   	push   %ebp
+  80236d:	89 e5                	mov    %esp,%ebp
+  80236f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802372:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  802376:	eb 03                	jmp    80237b <strchr+0xf>
+  802378:	83 c0 01             	add    $0x1,%eax
+  80237b:	0f b6 10             	movzbl (%eax),%edx
+  80237e:	84 d2                	test   %dl,%dl
+  802380:	74 06                	je     802388 <strchr+0x1c>
+		if (*s == c)
+  802382:	38 ca                	cmp    %cl,%dl
+  802384:	75 f2                	jne    802378 <strchr+0xc>
+  802386:	eb 05                	jmp    80238d <strchr+0x21>
+			return (char *) s;
+	return 0;
+  802388:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80238d:	5d                   	pop    %ebp
+  80238e:	c3                   	ret
+
+0080238f <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80238f:	55                   	push   %ebp
+  802390:	89 e5                	mov    %esp,%ebp
+  802392:	8b 45 08             	mov    0x8(%ebp),%eax
+  802395:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  802399:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80239c:	38 ca                	cmp    %cl,%dl
+  80239e:	74 09                	je     8023a9 <strfind+0x1a>
+  8023a0:	84 d2                	test   %dl,%dl
+  8023a2:	74 05                	je     8023a9 <strfind+0x1a>
+	for (; *s; s++)
+  8023a4:	83 c0 01             	add    $0x1,%eax
+  8023a7:	eb f0                	jmp    802399 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8023a9:	5d                   	pop    %ebp
+  8023aa:	c3                   	ret
+
+008023ab <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8023ab:	55                   	push   %ebp
+  8023ac:	89 e5                	mov    %esp,%ebp
+  8023ae:	57                   	push   %edi
+  8023af:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8023b2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8023b5:	85 c9                	test   %ecx,%ecx
+  8023b7:	74 20                	je     8023d9 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8023b9:	89 f8                	mov    %edi,%eax
+  8023bb:	09 c8                	or     %ecx,%eax
+  8023bd:	a8 03                	test   $0x3,%al
+  8023bf:	75 12                	jne    8023d3 <memset+0x28>
+		c &= 0xFF;
+  8023c1:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8023c5:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8023cb:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8023ce:	fc                   	cld
+  8023cf:	f3 ab                	rep stos %eax,%es:(%edi)
+  8023d1:	eb 06                	jmp    8023d9 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8023d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023d6:	fc                   	cld
+  8023d7:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8023d9:	89 f8                	mov    %edi,%eax
+  8023db:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8023de:	c9                   	leave
+  8023df:	c3                   	ret
+
+008023e0 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8023e0:	55                   	push   %ebp
+  8023e1:	89 e5                	mov    %esp,%ebp
+  8023e3:	57                   	push   %edi
+  8023e4:	56                   	push   %esi
+  8023e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023e8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8023eb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8023ee:	39 c6                	cmp    %eax,%esi
+  8023f0:	73 32                	jae    802424 <memmove+0x44>
+  8023f2:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8023f5:	39 d0                	cmp    %edx,%eax
+  8023f7:	73 2b                	jae    802424 <memmove+0x44>
+		s += n;
+		d += n;
+  8023f9:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8023fc:	89 d6                	mov    %edx,%esi
+  8023fe:	09 fe                	or     %edi,%esi
+  802400:	09 ce                	or     %ecx,%esi
+  802402:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  802408:	75 0e                	jne    802418 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80240a:	83 ef 04             	sub    $0x4,%edi
+  80240d:	8d 72 fc             	lea    -0x4(%edx),%esi
+  802410:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  802413:	fd                   	std
+  802414:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802416:	eb 09                	jmp    802421 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  802418:	83 ef 01             	sub    $0x1,%edi
+  80241b:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80241e:	fd                   	std
+  80241f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  802421:	fc                   	cld
+  802422:	eb 1a                	jmp    80243e <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802424:	89 f2                	mov    %esi,%edx
+  802426:	09 c2                	or     %eax,%edx
+  802428:	09 ca                	or     %ecx,%edx
+  80242a:	f6 c2 03             	test   $0x3,%dl
+  80242d:	75 0a                	jne    802439 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80242f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  802432:	89 c7                	mov    %eax,%edi
+  802434:	fc                   	cld
+  802435:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802437:	eb 05                	jmp    80243e <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  802439:	89 c7                	mov    %eax,%edi
+  80243b:	fc                   	cld
+  80243c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80243e:	5e                   	pop    %esi
+  80243f:	5f                   	pop    %edi
+  802440:	5d                   	pop    %ebp
+  802441:	c3                   	ret
+
+00802442 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  802442:	55                   	push   %ebp
+  802443:	89 e5                	mov    %esp,%ebp
+  802445:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  802448:	ff 75 10             	push   0x10(%ebp)
+  80244b:	ff 75 0c             	push   0xc(%ebp)
+  80244e:	ff 75 08             	push   0x8(%ebp)
+  802451:	e8 8a ff ff ff       	call   8023e0 <memmove>
+}
+  802456:	c9                   	leave
+  802457:	c3                   	ret
+
+00802458 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  802458:	55                   	push   %ebp
+  802459:	89 e5                	mov    %esp,%ebp
+  80245b:	56                   	push   %esi
+  80245c:	53                   	push   %ebx
+  80245d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802460:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  802463:	89 c6                	mov    %eax,%esi
+  802465:	03 75 10             	add    0x10(%ebp),%esi
+  802468:	eb 06                	jmp    802470 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  80246a:	83 c0 01             	add    $0x1,%eax
+  80246d:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  802470:	39 f0                	cmp    %esi,%eax
+  802472:	74 14                	je     802488 <memcmp+0x30>
+		if (*s1 != *s2)
+  802474:	0f b6 08             	movzbl (%eax),%ecx
+  802477:	0f b6 1a             	movzbl (%edx),%ebx
+  80247a:	38 d9                	cmp    %bl,%cl
+  80247c:	74 ec                	je     80246a <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  80247e:	0f b6 c1             	movzbl %cl,%eax
+  802481:	0f b6 db             	movzbl %bl,%ebx
+  802484:	29 d8                	sub    %ebx,%eax
+  802486:	eb 05                	jmp    80248d <memcmp+0x35>
+	}
+
+	return 0;
+  802488:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80248d:	5b                   	pop    %ebx
+  80248e:	5e                   	pop    %esi
+  80248f:	5d                   	pop    %ebp
+  802490:	c3                   	ret
+
+00802491 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802491:	55                   	push   %ebp
+  802492:	89 e5                	mov    %esp,%ebp
+  802494:	8b 45 08             	mov    0x8(%ebp),%eax
+  802497:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80249a:	89 c2                	mov    %eax,%edx
+  80249c:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  80249f:	eb 03                	jmp    8024a4 <memfind+0x13>
+  8024a1:	83 c0 01             	add    $0x1,%eax
+  8024a4:	39 d0                	cmp    %edx,%eax
+  8024a6:	73 04                	jae    8024ac <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8024a8:	38 08                	cmp    %cl,(%eax)
+  8024aa:	75 f5                	jne    8024a1 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8024ac:	5d                   	pop    %ebp
+  8024ad:	c3                   	ret
+
+008024ae <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8024ae:	55                   	push   %ebp
+  8024af:	89 e5                	mov    %esp,%ebp
+  8024b1:	57                   	push   %edi
+  8024b2:	56                   	push   %esi
+  8024b3:	53                   	push   %ebx
+  8024b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024b7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8024ba:	eb 03                	jmp    8024bf <strtol+0x11>
+		s++;
+  8024bc:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8024bf:	0f b6 02             	movzbl (%edx),%eax
+  8024c2:	3c 20                	cmp    $0x20,%al
+  8024c4:	74 f6                	je     8024bc <strtol+0xe>
+  8024c6:	3c 09                	cmp    $0x9,%al
+  8024c8:	74 f2                	je     8024bc <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8024ca:	3c 2b                	cmp    $0x2b,%al
+  8024cc:	74 2a                	je     8024f8 <strtol+0x4a>
+	int neg = 0;
+  8024ce:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8024d3:	3c 2d                	cmp    $0x2d,%al
+  8024d5:	74 2b                	je     802502 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8024d7:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8024dd:	75 0f                	jne    8024ee <strtol+0x40>
+  8024df:	80 3a 30             	cmpb   $0x30,(%edx)
+  8024e2:	74 28                	je     80250c <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8024e4:	85 db                	test   %ebx,%ebx
+  8024e6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8024eb:	0f 44 d8             	cmove  %eax,%ebx
+  8024ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024f3:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8024f6:	eb 46                	jmp    80253e <strtol+0x90>
+		s++;
+  8024f8:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8024fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802500:	eb d5                	jmp    8024d7 <strtol+0x29>
+		s++, neg = 1;
+  802502:	83 c2 01             	add    $0x1,%edx
+  802505:	bf 01 00 00 00       	mov    $0x1,%edi
+  80250a:	eb cb                	jmp    8024d7 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80250c:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802510:	74 0e                	je     802520 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  802512:	85 db                	test   %ebx,%ebx
+  802514:	75 d8                	jne    8024ee <strtol+0x40>
+		s++, base = 8;
+  802516:	83 c2 01             	add    $0x1,%edx
+  802519:	bb 08 00 00 00       	mov    $0x8,%ebx
+  80251e:	eb ce                	jmp    8024ee <strtol+0x40>
+		s += 2, base = 16;
+  802520:	83 c2 02             	add    $0x2,%edx
+  802523:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802528:	eb c4                	jmp    8024ee <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  80252a:	0f be c0             	movsbl %al,%eax
+  80252d:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  802530:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802533:	7d 3a                	jge    80256f <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  802535:	83 c2 01             	add    $0x1,%edx
+  802538:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  80253c:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  80253e:	0f b6 02             	movzbl (%edx),%eax
+  802541:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802544:	89 f3                	mov    %esi,%ebx
+  802546:	80 fb 09             	cmp    $0x9,%bl
+  802549:	76 df                	jbe    80252a <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  80254b:	8d 70 9f             	lea    -0x61(%eax),%esi
+  80254e:	89 f3                	mov    %esi,%ebx
+  802550:	80 fb 19             	cmp    $0x19,%bl
+  802553:	77 08                	ja     80255d <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  802555:	0f be c0             	movsbl %al,%eax
+  802558:	83 e8 57             	sub    $0x57,%eax
+  80255b:	eb d3                	jmp    802530 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  80255d:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802560:	89 f3                	mov    %esi,%ebx
+  802562:	80 fb 19             	cmp    $0x19,%bl
+  802565:	77 08                	ja     80256f <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  802567:	0f be c0             	movsbl %al,%eax
+  80256a:	83 e8 37             	sub    $0x37,%eax
+  80256d:	eb c1                	jmp    802530 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  80256f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802573:	74 05                	je     80257a <strtol+0xcc>
+		*endptr = (char *) s;
+  802575:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802578:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  80257a:	89 c8                	mov    %ecx,%eax
+  80257c:	f7 d8                	neg    %eax
+  80257e:	85 ff                	test   %edi,%edi
+  802580:	0f 45 c8             	cmovne %eax,%ecx
+}
+  802583:	89 c8                	mov    %ecx,%eax
+  802585:	5b                   	pop    %ebx
+  802586:	5e                   	pop    %esi
+  802587:	5f                   	pop    %edi
+  802588:	5d                   	pop    %ebp
+  802589:	c3                   	ret
+
+0080258a <atoi>:
+
+int
+atoi(const char *s)
+{
+  80258a:	55                   	push   %ebp
+  80258b:	89 e5                	mov    %esp,%ebp
+  80258d:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  802590:	6a 0a                	push   $0xa
+  802592:	6a 00                	push   $0x0
+  802594:	ff 75 08             	push   0x8(%ebp)
+  802597:	e8 12 ff ff ff       	call   8024ae <strtol>
+}
+  80259c:	c9                   	leave
+  80259d:	c3                   	ret
+
+0080259e <dm>:
+  80259e:	55                   	push   %ebp
+  80259f:	57                   	push   %edi
+  8025a0:	56                   	push   %esi
+  8025a1:	53                   	push   %ebx
+  8025a2:	83 ec 24             	sub    $0x24,%esp
+  8025a5:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8025a9:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8025ad:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8025b1:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8025b5:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8025b9:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8025bd:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8025c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025cb:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025d0:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8025d7:	00 
+  8025d8:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8025df:	00 
+  8025e0:	89 fb                	mov    %edi,%ebx
+  8025e2:	eb 08                	jmp    8025ec <dm+0x4e>
+  8025e4:	83 e9 01             	sub    $0x1,%ecx
+  8025e7:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8025ea:	74 68                	je     802654 <dm+0xb6>
+  8025ec:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8025f0:	01 c0                	add    %eax,%eax
+  8025f2:	89 c6                	mov    %eax,%esi
+  8025f4:	89 d7                	mov    %edx,%edi
+  8025f6:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8025fa:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8025fe:	0f ad d0             	shrd   %cl,%edx,%eax
+  802601:	d3 ea                	shr    %cl,%edx
+  802603:	f6 c1 20             	test   $0x20,%cl
+  802606:	74 04                	je     80260c <dm+0x6e>
+  802608:	89 d0                	mov    %edx,%eax
+  80260a:	31 d2                	xor    %edx,%edx
+  80260c:	83 e0 01             	and    $0x1,%eax
+  80260f:	89 04 24             	mov    %eax,(%esp)
+  802612:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802619:	00 
+  80261a:	8b 04 24             	mov    (%esp),%eax
+  80261d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802621:	09 f0                	or     %esi,%eax
+  802623:	09 fa                	or     %edi,%edx
+  802625:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802629:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80262d:	39 f0                	cmp    %esi,%eax
+  80262f:	89 d5                	mov    %edx,%ebp
+  802631:	19 fd                	sbb    %edi,%ebp
+  802633:	72 af                	jb     8025e4 <dm+0x46>
+  802635:	29 f0                	sub    %esi,%eax
+  802637:	19 fa                	sbb    %edi,%edx
+  802639:	89 cf                	mov    %ecx,%edi
+  80263b:	c1 ef 05             	shr    $0x5,%edi
+  80263e:	83 e7 01             	and    $0x1,%edi
+  802641:	89 fe                	mov    %edi,%esi
+  802643:	83 f6 01             	xor    $0x1,%esi
+  802646:	d3 e6                	shl    %cl,%esi
+  802648:	d3 e7                	shl    %cl,%edi
+  80264a:	09 74 24 18          	or     %esi,0x18(%esp)
+  80264e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802652:	eb 90                	jmp    8025e4 <dm+0x46>
+  802654:	85 db                	test   %ebx,%ebx
+  802656:	74 05                	je     80265d <dm+0xbf>
+  802658:	89 03                	mov    %eax,(%ebx)
+  80265a:	89 53 04             	mov    %edx,0x4(%ebx)
+  80265d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802661:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802665:	83 c4 24             	add    $0x24,%esp
+  802668:	5b                   	pop    %ebx
+  802669:	5e                   	pop    %esi
+  80266a:	5f                   	pop    %edi
+  80266b:	5d                   	pop    %ebp
+  80266c:	c3                   	ret
+
+0080266d <__udivdi3>:
+  80266d:	83 ec 08             	sub    $0x8,%esp
+  802670:	6a 00                	push   $0x0
+  802672:	ff 74 24 1c          	push   0x1c(%esp)
+  802676:	ff 74 24 1c          	push   0x1c(%esp)
+  80267a:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80267e:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802682:	e8 17 ff ff ff       	call   80259e <dm>
+  802687:	83 c4 14             	add    $0x14,%esp
+  80268a:	c3                   	ret
+
+0080268b <__umoddi3>:
+  80268b:	83 ec 18             	sub    $0x18,%esp
+  80268e:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802692:	50                   	push   %eax
+  802693:	ff 74 24 2c          	push   0x2c(%esp)
+  802697:	ff 74 24 2c          	push   0x2c(%esp)
+  80269b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80269f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8026a3:	e8 f6 fe ff ff       	call   80259e <dm>
+  8026a8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8026ac:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8026b0:	83 c4 24             	add    $0x24,%esp
+  8026b3:	c3                   	ret
+
+008026b4 <__divdi3>:
+  8026b4:	53                   	push   %ebx
+  8026b5:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8026b9:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026bd:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8026c1:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8026c5:	85 d2                	test   %edx,%edx
+  8026c7:	78 15                	js     8026de <__divdi3+0x2a>
+  8026c9:	85 db                	test   %ebx,%ebx
+  8026cb:	78 34                	js     802701 <__divdi3+0x4d>
+  8026cd:	83 ec 04             	sub    $0x4,%esp
+  8026d0:	6a 00                	push   $0x0
+  8026d2:	53                   	push   %ebx
+  8026d3:	51                   	push   %ecx
+  8026d4:	e8 c5 fe ff ff       	call   80259e <dm>
+  8026d9:	83 c4 10             	add    $0x10,%esp
+  8026dc:	eb 21                	jmp    8026ff <__divdi3+0x4b>
+  8026de:	f7 d8                	neg    %eax
+  8026e0:	83 d2 00             	adc    $0x0,%edx
+  8026e3:	f7 da                	neg    %edx
+  8026e5:	85 db                	test   %ebx,%ebx
+  8026e7:	78 30                	js     802719 <__divdi3+0x65>
+  8026e9:	83 ec 04             	sub    $0x4,%esp
+  8026ec:	6a 00                	push   $0x0
+  8026ee:	53                   	push   %ebx
+  8026ef:	51                   	push   %ecx
+  8026f0:	e8 a9 fe ff ff       	call   80259e <dm>
+  8026f5:	83 c4 10             	add    $0x10,%esp
+  8026f8:	f7 d8                	neg    %eax
+  8026fa:	83 d2 00             	adc    $0x0,%edx
+  8026fd:	f7 da                	neg    %edx
+  8026ff:	5b                   	pop    %ebx
+  802700:	c3                   	ret
+  802701:	83 ec 04             	sub    $0x4,%esp
+  802704:	6a 00                	push   $0x0
+  802706:	f7 d9                	neg    %ecx
+  802708:	83 d3 00             	adc    $0x0,%ebx
+  80270b:	f7 db                	neg    %ebx
+  80270d:	53                   	push   %ebx
+  80270e:	51                   	push   %ecx
+  80270f:	e8 8a fe ff ff       	call   80259e <dm>
+  802714:	83 c4 10             	add    $0x10,%esp
+  802717:	eb df                	jmp    8026f8 <__divdi3+0x44>
+  802719:	83 ec 04             	sub    $0x4,%esp
+  80271c:	6a 00                	push   $0x0
+  80271e:	f7 d9                	neg    %ecx
+  802720:	83 d3 00             	adc    $0x0,%ebx
+  802723:	f7 db                	neg    %ebx
+  802725:	53                   	push   %ebx
+  802726:	51                   	push   %ecx
+  802727:	e8 72 fe ff ff       	call   80259e <dm>
+  80272c:	83 c4 10             	add    $0x10,%esp
+  80272f:	eb ce                	jmp    8026ff <__divdi3+0x4b>
+
+00802731 <__moddi3>:
+  802731:	55                   	push   %ebp
+  802732:	57                   	push   %edi
+  802733:	56                   	push   %esi
+  802734:	53                   	push   %ebx
+  802735:	83 ec 18             	sub    $0x18,%esp
+  802738:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  80273c:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802740:	89 f1                	mov    %esi,%ecx
+  802742:	f7 d9                	neg    %ecx
+  802744:	89 da                	mov    %ebx,%edx
+  802746:	83 d2 00             	adc    $0x0,%edx
+  802749:	f7 da                	neg    %edx
+  80274b:	0f 48 ce             	cmovs  %esi,%ecx
+  80274e:	0f 48 d3             	cmovs  %ebx,%edx
+  802751:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802755:	50                   	push   %eax
+  802756:	8b 74 24 38          	mov    0x38(%esp),%esi
+  80275a:	f7 de                	neg    %esi
+  80275c:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802760:	83 d0 00             	adc    $0x0,%eax
+  802763:	f7 d8                	neg    %eax
+  802765:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  80276a:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  80276f:	50                   	push   %eax
+  802770:	56                   	push   %esi
+  802771:	89 c8                	mov    %ecx,%eax
+  802773:	e8 26 fe ff ff       	call   80259e <dm>
+  802778:	83 c4 10             	add    $0x10,%esp
+  80277b:	85 db                	test   %ebx,%ebx
+  80277d:	78 10                	js     80278f <__moddi3+0x5e>
+  80277f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802783:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802787:	83 c4 14             	add    $0x14,%esp
+  80278a:	5b                   	pop    %ebx
+  80278b:	5e                   	pop    %esi
+  80278c:	5f                   	pop    %edi
+  80278d:	5d                   	pop    %ebp
+  80278e:	c3                   	ret
+  80278f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802793:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802797:	f7 d8                	neg    %eax
+  802799:	83 d2 00             	adc    $0x0,%edx
+  80279c:	f7 da                	neg    %edx
+  80279e:	eb e7                	jmp    802787 <__moddi3+0x56>
@@ -0,0 +1,5759 @@
+
+obj/user/spawnbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 a4 02 00 00       	call   8002d5 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+		sys_yield();
+}
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 6c             	sub    $0x6c,%esp
+		envid_t (*fn)(const void *, size_t, const char **);
+	} impls[] = {
+		{ "uspawn", uspawn },
+		{ "spawn", spawn },
+	};
+	const char *args[] = { "hello", "from", "spawnbench", NULL };
+  80003c:	c7 45 d8 80 2e 80 00 	movl   $0x802e80,-0x28(%ebp)
+  800043:	c7 45 dc 86 2e 80 00 	movl   $0x802e86,-0x24(%ebp)
+  80004a:	c7 45 e0 8b 2e 80 00 	movl   $0x802e8b,-0x20(%ebp)
+  800051:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	const uint8_t *binary = _binary_obj_user_hello_start;
+	size_t size = _binary_obj_user_hello_end - _binary_obj_user_hello_start;
+  800058:	b8 5c 85 81 00       	mov    $0x81855c,%eax
+  80005d:	2d 08 40 80 00       	sub    $0x804008,%eax
+  800062:	89 45 90             	mov    %eax,-0x70(%ebp)
+	uint64_t start, spawned, total;
+	uint64_t spawn_cycles[ARRAY_SIZE(impls)], total_cycles[ARRAY_SIZE(impls)];
+	envid_t envid;
+	int i, j;
+
+	for (i = 0; i < ARRAY_SIZE(impls); i++) {
+  800065:	8d 45 b8             	lea    -0x48(%ebp),%eax
+  800068:	8d 55 c8             	lea    -0x38(%ebp),%edx
+  80006b:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%ebp)
+		spawn_cycles[i] = total_cycles[i] = 0;
+  800072:	89 c7                	mov    %eax,%edi
+  800074:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  80007a:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  800081:	89 55 94             	mov    %edx,-0x6c(%ebp)
+  800084:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+  80008a:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+		for (j = 0; j < NSPAWN; j++) {
+  800091:	c7 45 98 0b 00 00 00 	movl   $0xb,-0x68(%ebp)
+  800098:	89 45 8c             	mov    %eax,-0x74(%ebp)
+  80009b:	89 55 88             	mov    %edx,-0x78(%ebp)
+  80009e:	eb 6b                	jmp    80010b <umain+0xd8>
+			start = read_tsc();
+			if ((envid = impls[i].fn(binary, size, args)) < 0)
+				panic("%s: %e", impls[i].name, envid);
+  8000a0:	83 ec 0c             	sub    $0xc,%esp
+  8000a3:	50                   	push   %eax
+  8000a4:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  8000a7:	ff 34 c5 f0 2e 80 00 	push   0x802ef0(,%eax,8)
+  8000ae:	68 96 2e 80 00       	push   $0x802e96
+  8000b3:	6a 31                	push   $0x31
+  8000b5:	68 9d 2e 80 00       	push   $0x802e9d
+  8000ba:	e8 71 02 00 00       	call   800330 <_panic>
+		sys_yield();
+  8000bf:	e8 b5 14 00 00       	call   801579 <sys_yield>
+	while (envs[ENVX(envid)].env_id == envid
+  8000c4:	8b 43 48             	mov    0x48(%ebx),%eax
+	       && envs[ENVX(envid)].env_status != ENV_FREE)
+  8000c7:	39 c6                	cmp    %eax,%esi
+  8000c9:	75 07                	jne    8000d2 <umain+0x9f>
+  8000cb:	8b 43 54             	mov    0x54(%ebx),%eax
+  8000ce:	85 c0                	test   %eax,%eax
+  8000d0:	75 ed                	jne    8000bf <umain+0x8c>
+
+static inline uint64_t
+read_tsc(void)
+{
+	uint64_t tsc;
+	asm volatile("rdtsc" : "=A" (tsc));
+  8000d2:	0f 31                	rdtsc
+  8000d4:	89 c1                	mov    %eax,%ecx
+  8000d6:	89 d3                	mov    %edx,%ebx
+			spawned = read_tsc();
+			wait_env(envid);
+			total = read_tsc();
+			spawn_cycles[i] += spawned - start;
+  8000d8:	8b 75 94             	mov    -0x6c(%ebp),%esi
+  8000db:	8b 06                	mov    (%esi),%eax
+  8000dd:	8b 56 04             	mov    0x4(%esi),%edx
+  8000e0:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  8000e3:	89 55 a4             	mov    %edx,-0x5c(%ebp)
+  8000e6:	2b 45 b0             	sub    -0x50(%ebp),%eax
+  8000e9:	1b 55 b4             	sbb    -0x4c(%ebp),%edx
+  8000ec:	03 45 a8             	add    -0x58(%ebp),%eax
+  8000ef:	13 55 ac             	adc    -0x54(%ebp),%edx
+  8000f2:	89 06                	mov    %eax,(%esi)
+  8000f4:	89 56 04             	mov    %edx,0x4(%esi)
+			total_cycles[i] += total - start;
+  8000f7:	8b 07                	mov    (%edi),%eax
+  8000f9:	8b 57 04             	mov    0x4(%edi),%edx
+  8000fc:	2b 45 b0             	sub    -0x50(%ebp),%eax
+  8000ff:	1b 55 b4             	sbb    -0x4c(%ebp),%edx
+  800102:	01 c8                	add    %ecx,%eax
+  800104:	11 da                	adc    %ebx,%edx
+  800106:	89 07                	mov    %eax,(%edi)
+  800108:	89 57 04             	mov    %edx,0x4(%edi)
+		for (j = 0; j < NSPAWN; j++) {
+  80010b:	83 6d 98 01          	subl   $0x1,-0x68(%ebp)
+  80010f:	74 4f                	je     800160 <umain+0x12d>
+  800111:	0f 31                	rdtsc
+  800113:	89 45 b0             	mov    %eax,-0x50(%ebp)
+  800116:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+			if ((envid = impls[i].fn(binary, size, args)) < 0)
+  800119:	83 ec 04             	sub    $0x4,%esp
+  80011c:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  80011f:	50                   	push   %eax
+  800120:	ff 75 90             	push   -0x70(%ebp)
+  800123:	68 08 40 80 00       	push   $0x804008
+  800128:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  80012b:	ff 14 c5 f4 2e 80 00 	call   *0x802ef4(,%eax,8)
+  800132:	89 c6                	mov    %eax,%esi
+  800134:	83 c4 10             	add    $0x10,%esp
+  800137:	85 c0                	test   %eax,%eax
+  800139:	0f 88 61 ff ff ff    	js     8000a0 <umain+0x6d>
+  80013f:	0f 31                	rdtsc
+  800141:	89 45 a8             	mov    %eax,-0x58(%ebp)
+  800144:	89 55 ac             	mov    %edx,-0x54(%ebp)
+	while (envs[ENVX(envid)].env_id == envid
+  800147:	89 f3                	mov    %esi,%ebx
+  800149:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  80014f:	69 db 68 01 00 00    	imul   $0x168,%ebx,%ebx
+  800155:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  80015b:	e9 64 ff ff ff       	jmp    8000c4 <umain+0x91>
+	for (i = 0; i < ARRAY_SIZE(impls); i++) {
+  800160:	8b 45 8c             	mov    -0x74(%ebp),%eax
+  800163:	8b 55 88             	mov    -0x78(%ebp),%edx
+  800166:	83 45 9c 01          	addl   $0x1,-0x64(%ebp)
+  80016a:	8b 4d 9c             	mov    -0x64(%ebp),%ecx
+  80016d:	83 c0 08             	add    $0x8,%eax
+  800170:	83 c2 08             	add    $0x8,%edx
+  800173:	83 f9 02             	cmp    $0x2,%ecx
+  800176:	0f 85 f6 fe ff ff    	jne    800072 <umain+0x3f>
+		}
+	}
+
+	// Print after the children are done, so their output stays apart.
+	for (i = 0; i < ARRAY_SIZE(impls); i++)
+		cprintf("%-6s %3d spawns %10llu cycles/spawn %10llu cycles/run\n",
+  80017c:	83 ec 04             	sub    $0x4,%esp
+  80017f:	8b 4d b8             	mov    -0x48(%ebp),%ecx
+  800182:	8b 5d bc             	mov    -0x44(%ebp),%ebx
+  800185:	89 cf                	mov    %ecx,%edi
+  800187:	01 df                	add    %ebx,%edi
+  800189:	83 d7 00             	adc    $0x0,%edi
+  80018c:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+  800191:	89 f8                	mov    %edi,%eax
+  800193:	f7 e6                	mul    %esi
+  800195:	89 d0                	mov    %edx,%eax
+  800197:	c1 e8 02             	shr    $0x2,%eax
+  80019a:	83 e2 fc             	and    $0xfffffffc,%edx
+  80019d:	01 d0                	add    %edx,%eax
+  80019f:	29 c7                	sub    %eax,%edi
+  8001a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001a6:	29 f9                	sub    %edi,%ecx
+  8001a8:	19 d3                	sbb    %edx,%ebx
+  8001aa:	69 db cd cc cc cc    	imul   $0xcccccccd,%ebx,%ebx
+  8001b0:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+  8001b3:	69 45 b0 cc cc cc cc 	imul   $0xcccccccc,-0x50(%ebp),%eax
+  8001ba:	01 c3                	add    %eax,%ebx
+  8001bc:	8b 45 b0             	mov    -0x50(%ebp),%eax
+  8001bf:	f7 e6                	mul    %esi
+  8001c1:	01 da                	add    %ebx,%edx
+  8001c3:	0f ac d0 01          	shrd   $0x1,%edx,%eax
+  8001c7:	d1 ea                	shr    %edx
+  8001c9:	52                   	push   %edx
+  8001ca:	50                   	push   %eax
+  8001cb:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8001ce:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+  8001d1:	89 cf                	mov    %ecx,%edi
+  8001d3:	01 df                	add    %ebx,%edi
+  8001d5:	83 d7 00             	adc    $0x0,%edi
+  8001d8:	89 f8                	mov    %edi,%eax
+  8001da:	f7 e6                	mul    %esi
+  8001dc:	89 d0                	mov    %edx,%eax
+  8001de:	c1 e8 02             	shr    $0x2,%eax
+  8001e1:	83 e2 fc             	and    $0xfffffffc,%edx
+  8001e4:	01 d0                	add    %edx,%eax
+  8001e6:	29 c7                	sub    %eax,%edi
+  8001e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001ed:	29 f9                	sub    %edi,%ecx
+  8001ef:	19 d3                	sbb    %edx,%ebx
+  8001f1:	69 db cd cc cc cc    	imul   $0xcccccccd,%ebx,%ebx
+  8001f7:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+  8001fa:	69 45 b0 cc cc cc cc 	imul   $0xcccccccc,-0x50(%ebp),%eax
+  800201:	01 c3                	add    %eax,%ebx
+  800203:	8b 45 b0             	mov    -0x50(%ebp),%eax
+  800206:	f7 e6                	mul    %esi
+  800208:	01 da                	add    %ebx,%edx
+  80020a:	0f ac d0 01          	shrd   $0x1,%edx,%eax
+  80020e:	d1 ea                	shr    %edx
+  800210:	52                   	push   %edx
+  800211:	50                   	push   %eax
+  800212:	6a 0a                	push   $0xa
+  800214:	68 af 2e 80 00       	push   $0x802eaf
+  800219:	68 b8 2e 80 00       	push   $0x802eb8
+  80021e:	e8 21 02 00 00       	call   800444 <cprintf>
+  800223:	83 c4 1c             	add    $0x1c,%esp
+  800226:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+  800229:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+  80022c:	89 cf                	mov    %ecx,%edi
+  80022e:	01 df                	add    %ebx,%edi
+  800230:	83 d7 00             	adc    $0x0,%edi
+  800233:	89 f8                	mov    %edi,%eax
+  800235:	f7 e6                	mul    %esi
+  800237:	89 d0                	mov    %edx,%eax
+  800239:	c1 e8 02             	shr    $0x2,%eax
+  80023c:	83 e2 fc             	and    $0xfffffffc,%edx
+  80023f:	01 d0                	add    %edx,%eax
+  800241:	29 c7                	sub    %eax,%edi
+  800243:	ba 00 00 00 00       	mov    $0x0,%edx
+  800248:	29 f9                	sub    %edi,%ecx
+  80024a:	19 d3                	sbb    %edx,%ebx
+  80024c:	69 db cd cc cc cc    	imul   $0xcccccccd,%ebx,%ebx
+  800252:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+  800255:	69 45 b0 cc cc cc cc 	imul   $0xcccccccc,-0x50(%ebp),%eax
+  80025c:	01 c3                	add    %eax,%ebx
+  80025e:	8b 45 b0             	mov    -0x50(%ebp),%eax
+  800261:	f7 e6                	mul    %esi
+  800263:	01 da                	add    %ebx,%edx
+  800265:	0f ac d0 01          	shrd   $0x1,%edx,%eax
+  800269:	d1 ea                	shr    %edx
+  80026b:	52                   	push   %edx
+  80026c:	50                   	push   %eax
+  80026d:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800270:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  800273:	89 cf                	mov    %ecx,%edi
+  800275:	01 df                	add    %ebx,%edi
+  800277:	83 d7 00             	adc    $0x0,%edi
+  80027a:	89 f8                	mov    %edi,%eax
+  80027c:	f7 e6                	mul    %esi
+  80027e:	89 d0                	mov    %edx,%eax
+  800280:	c1 e8 02             	shr    $0x2,%eax
+  800283:	83 e2 fc             	and    $0xfffffffc,%edx
+  800286:	01 d0                	add    %edx,%eax
+  800288:	29 c7                	sub    %eax,%edi
+  80028a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80028f:	29 f9                	sub    %edi,%ecx
+  800291:	19 d3                	sbb    %edx,%ebx
+  800293:	89 da                	mov    %ebx,%edx
+  800295:	69 db cd cc cc cc    	imul   $0xcccccccd,%ebx,%ebx
+  80029b:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+  80029e:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+  8002a1:	69 45 b0 cc cc cc cc 	imul   $0xcccccccc,-0x50(%ebp),%eax
+  8002a8:	01 c3                	add    %eax,%ebx
+  8002aa:	8b 45 b0             	mov    -0x50(%ebp),%eax
+  8002ad:	f7 e6                	mul    %esi
+  8002af:	01 da                	add    %ebx,%edx
+  8002b1:	0f ac d0 01          	shrd   $0x1,%edx,%eax
+  8002b5:	d1 ea                	shr    %edx
+  8002b7:	52                   	push   %edx
+  8002b8:	50                   	push   %eax
+  8002b9:	6a 0a                	push   $0xa
+  8002bb:	68 b0 2e 80 00       	push   $0x802eb0
+  8002c0:	68 b8 2e 80 00       	push   $0x802eb8
+  8002c5:	e8 7a 01 00 00       	call   800444 <cprintf>
+			impls[i].name, NSPAWN, spawn_cycles[i] / NSPAWN,
+			total_cycles[i] / NSPAWN);
+}
+  8002ca:	83 c4 20             	add    $0x20,%esp
+  8002cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002d0:	5b                   	pop    %ebx
+  8002d1:	5e                   	pop    %esi
+  8002d2:	5f                   	pop    %edi
+  8002d3:	5d                   	pop    %ebp
+  8002d4:	c3                   	ret
+
+008002d5 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8002d5:	55                   	push   %ebp
+  8002d6:	89 e5                	mov    %esp,%ebp
+  8002d8:	56                   	push   %esi
+  8002d9:	53                   	push   %ebx
+  8002da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002dd:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  8002e0:	e8 e3 0e 00 00       	call   8011c8 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  8002e5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002ea:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  8002f0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8002f5:	a3 5c 85 81 00       	mov    %eax,0x81855c
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8002fa:	85 db                	test   %ebx,%ebx
+  8002fc:	7e 07                	jle    800305 <libmain+0x30>
+		binaryname = argv[0];
+  8002fe:	8b 06                	mov    (%esi),%eax
+  800300:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800305:	83 ec 08             	sub    $0x8,%esp
+  800308:	56                   	push   %esi
+  800309:	53                   	push   %ebx
+  80030a:	e8 24 fd ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80030f:	e8 0a 00 00 00       	call   80031e <exit>
+}
+  800314:	83 c4 10             	add    $0x10,%esp
+  800317:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80031a:	5b                   	pop    %ebx
+  80031b:	5e                   	pop    %esi
+  80031c:	5d                   	pop    %ebp
+  80031d:	c3                   	ret
+
+0080031e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80031e:	55                   	push   %ebp
+  80031f:	89 e5                	mov    %esp,%ebp
+  800321:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  800324:	6a 00                	push   $0x0
+  800326:	e8 db 0d 00 00       	call   801106 <sys_env_destroy>
+}
+  80032b:	83 c4 10             	add    $0x10,%esp
+  80032e:	c9                   	leave
+  80032f:	c3                   	ret
+
+00800330 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800330:	55                   	push   %ebp
+  800331:	89 e5                	mov    %esp,%ebp
+  800333:	57                   	push   %edi
+  800334:	56                   	push   %esi
+  800335:	53                   	push   %ebx
+  800336:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  80033c:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  80033f:	8b 1d 00 40 80 00    	mov    0x804000,%ebx
+  800345:	e8 7e 0e 00 00       	call   8011c8 <sys_getenvid>
+  80034a:	83 ec 04             	sub    $0x4,%esp
+  80034d:	ff 75 0c             	push   0xc(%ebp)
+  800350:	ff 75 08             	push   0x8(%ebp)
+  800353:	53                   	push   %ebx
+  800354:	50                   	push   %eax
+  800355:	68 0c 2f 80 00       	push   $0x802f0c
+  80035a:	68 00 01 00 00       	push   $0x100
+  80035f:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  800365:	56                   	push   %esi
+  800366:	e8 72 06 00 00       	call   8009dd <snprintf>
+  80036b:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  80036d:	83 c4 20             	add    $0x20,%esp
+  800370:	57                   	push   %edi
+  800371:	ff 75 10             	push   0x10(%ebp)
+  800374:	bf 00 01 00 00       	mov    $0x100,%edi
+  800379:	89 f8                	mov    %edi,%eax
+  80037b:	29 d8                	sub    %ebx,%eax
+  80037d:	50                   	push   %eax
+  80037e:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  800381:	50                   	push   %eax
+  800382:	e8 08 06 00 00       	call   80098f <vsnprintf>
+  800387:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  800389:	83 c4 0c             	add    $0xc,%esp
+  80038c:	68 2f 2f 80 00       	push   $0x802f2f
+  800391:	29 df                	sub    %ebx,%edi
+  800393:	57                   	push   %edi
+  800394:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  800397:	50                   	push   %eax
+  800398:	e8 40 06 00 00       	call   8009dd <snprintf>
+	sys_cputs(buf, r);
+  80039d:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  8003a0:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  8003a2:	53                   	push   %ebx
+  8003a3:	56                   	push   %esi
+  8003a4:	e8 21 0c 00 00       	call   800fca <sys_cputs>
+  8003a9:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8003ac:	cc                   	int3
+	while (1)
+  8003ad:	eb fd                	jmp    8003ac <_panic+0x7c>
+
+008003af <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8003af:	55                   	push   %ebp
+  8003b0:	89 e5                	mov    %esp,%ebp
+  8003b2:	53                   	push   %ebx
+  8003b3:	83 ec 04             	sub    $0x4,%esp
+  8003b6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8003b9:	8b 13                	mov    (%ebx),%edx
+  8003bb:	8d 42 01             	lea    0x1(%edx),%eax
+  8003be:	89 03                	mov    %eax,(%ebx)
+  8003c0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8003c3:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8003c7:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8003cc:	74 09                	je     8003d7 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8003ce:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8003d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003d5:	c9                   	leave
+  8003d6:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8003d7:	83 ec 08             	sub    $0x8,%esp
+  8003da:	68 ff 00 00 00       	push   $0xff
+  8003df:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003e2:	50                   	push   %eax
+  8003e3:	e8 e2 0b 00 00       	call   800fca <sys_cputs>
+		b->idx = 0;
+  8003e8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8003ee:	83 c4 10             	add    $0x10,%esp
+  8003f1:	eb db                	jmp    8003ce <putch+0x1f>
+
+008003f3 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003f3:	55                   	push   %ebp
+  8003f4:	89 e5                	mov    %esp,%ebp
+  8003f6:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8003fc:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800403:	00 00 00 
+	b.cnt = 0;
+  800406:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80040d:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800410:	ff 75 0c             	push   0xc(%ebp)
+  800413:	ff 75 08             	push   0x8(%ebp)
+  800416:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80041c:	50                   	push   %eax
+  80041d:	68 af 03 80 00       	push   $0x8003af
+  800422:	e8 14 01 00 00       	call   80053b <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800427:	83 c4 08             	add    $0x8,%esp
+  80042a:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800430:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800436:	50                   	push   %eax
+  800437:	e8 8e 0b 00 00       	call   800fca <sys_cputs>
+
+	return b.cnt;
+}
+  80043c:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800442:	c9                   	leave
+  800443:	c3                   	ret
+
+00800444 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800444:	55                   	push   %ebp
+  800445:	89 e5                	mov    %esp,%ebp
+  800447:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80044a:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80044d:	50                   	push   %eax
+  80044e:	ff 75 08             	push   0x8(%ebp)
+  800451:	e8 9d ff ff ff       	call   8003f3 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800456:	c9                   	leave
+  800457:	c3                   	ret
+
+00800458 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800458:	55                   	push   %ebp
+  800459:	89 e5                	mov    %esp,%ebp
+  80045b:	57                   	push   %edi
+  80045c:	56                   	push   %esi
+  80045d:	53                   	push   %ebx
+  80045e:	83 ec 1c             	sub    $0x1c,%esp
+  800461:	89 c7                	mov    %eax,%edi
+  800463:	89 d6                	mov    %edx,%esi
+  800465:	8b 45 08             	mov    0x8(%ebp),%eax
+  800468:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80046b:	89 d1                	mov    %edx,%ecx
+  80046d:	89 c2                	mov    %eax,%edx
+  80046f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800472:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800475:	8b 45 10             	mov    0x10(%ebp),%eax
+  800478:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80047b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80047e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800485:	39 c2                	cmp    %eax,%edx
+  800487:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80048a:	72 3e                	jb     8004ca <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80048c:	83 ec 0c             	sub    $0xc,%esp
+  80048f:	ff 75 18             	push   0x18(%ebp)
+  800492:	83 eb 01             	sub    $0x1,%ebx
+  800495:	53                   	push   %ebx
+  800496:	50                   	push   %eax
+  800497:	83 ec 08             	sub    $0x8,%esp
+  80049a:	ff 75 e4             	push   -0x1c(%ebp)
+  80049d:	ff 75 e0             	push   -0x20(%ebp)
+  8004a0:	ff 75 dc             	push   -0x24(%ebp)
+  8004a3:	ff 75 d8             	push   -0x28(%ebp)
+  8004a6:	e8 88 28 00 00       	call   802d33 <__udivdi3>
+  8004ab:	83 c4 18             	add    $0x18,%esp
+  8004ae:	52                   	push   %edx
+  8004af:	50                   	push   %eax
+  8004b0:	89 f2                	mov    %esi,%edx
+  8004b2:	89 f8                	mov    %edi,%eax
+  8004b4:	e8 9f ff ff ff       	call   800458 <printnum>
+  8004b9:	83 c4 20             	add    $0x20,%esp
+  8004bc:	eb 13                	jmp    8004d1 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8004be:	83 ec 08             	sub    $0x8,%esp
+  8004c1:	56                   	push   %esi
+  8004c2:	ff 75 18             	push   0x18(%ebp)
+  8004c5:	ff d7                	call   *%edi
+  8004c7:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8004ca:	83 eb 01             	sub    $0x1,%ebx
+  8004cd:	85 db                	test   %ebx,%ebx
+  8004cf:	7f ed                	jg     8004be <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8004d1:	83 ec 08             	sub    $0x8,%esp
+  8004d4:	56                   	push   %esi
+  8004d5:	83 ec 04             	sub    $0x4,%esp
+  8004d8:	ff 75 e4             	push   -0x1c(%ebp)
+  8004db:	ff 75 e0             	push   -0x20(%ebp)
+  8004de:	ff 75 dc             	push   -0x24(%ebp)
+  8004e1:	ff 75 d8             	push   -0x28(%ebp)
+  8004e4:	e8 68 28 00 00       	call   802d51 <__umoddi3>
+  8004e9:	83 c4 14             	add    $0x14,%esp
+  8004ec:	0f be 80 31 2f 80 00 	movsbl 0x802f31(%eax),%eax
+  8004f3:	50                   	push   %eax
+  8004f4:	ff d7                	call   *%edi
+}
+  8004f6:	83 c4 10             	add    $0x10,%esp
+  8004f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004fc:	5b                   	pop    %ebx
+  8004fd:	5e                   	pop    %esi
+  8004fe:	5f                   	pop    %edi
+  8004ff:	5d                   	pop    %ebp
+  800500:	c3                   	ret
+
+00800501 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800501:	55                   	push   %ebp
+  800502:	89 e5                	mov    %esp,%ebp
+  800504:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800507:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80050b:	8b 10                	mov    (%eax),%edx
+  80050d:	3b 50 04             	cmp    0x4(%eax),%edx
+  800510:	73 0a                	jae    80051c <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800512:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800515:	89 08                	mov    %ecx,(%eax)
+  800517:	8b 45 08             	mov    0x8(%ebp),%eax
+  80051a:	88 02                	mov    %al,(%edx)
+}
+  80051c:	5d                   	pop    %ebp
+  80051d:	c3                   	ret
+
+0080051e <printfmt>:
+{
+  80051e:	55                   	push   %ebp
+  80051f:	89 e5                	mov    %esp,%ebp
+  800521:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800524:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800527:	50                   	push   %eax
+  800528:	ff 75 10             	push   0x10(%ebp)
+  80052b:	ff 75 0c             	push   0xc(%ebp)
+  80052e:	ff 75 08             	push   0x8(%ebp)
+  800531:	e8 05 00 00 00       	call   80053b <vprintfmt>
+}
+  800536:	83 c4 10             	add    $0x10,%esp
+  800539:	c9                   	leave
+  80053a:	c3                   	ret
+
+0080053b <vprintfmt>:
+{
+  80053b:	55                   	push   %ebp
+  80053c:	89 e5                	mov    %esp,%ebp
+  80053e:	57                   	push   %edi
+  80053f:	56                   	push   %esi
+  800540:	53                   	push   %ebx
+  800541:	83 ec 2c             	sub    $0x2c,%esp
+  800544:	8b 75 08             	mov    0x8(%ebp),%esi
+  800547:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80054a:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80054d:	eb 0a                	jmp    800559 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80054f:	83 ec 08             	sub    $0x8,%esp
+  800552:	53                   	push   %ebx
+  800553:	50                   	push   %eax
+  800554:	ff d6                	call   *%esi
+  800556:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800559:	83 c7 01             	add    $0x1,%edi
+  80055c:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800560:	83 f8 25             	cmp    $0x25,%eax
+  800563:	74 0c                	je     800571 <vprintfmt+0x36>
+			if (ch == '\0')
+  800565:	85 c0                	test   %eax,%eax
+  800567:	75 e6                	jne    80054f <vprintfmt+0x14>
+}
+  800569:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80056c:	5b                   	pop    %ebx
+  80056d:	5e                   	pop    %esi
+  80056e:	5f                   	pop    %edi
+  80056f:	5d                   	pop    %ebp
+  800570:	c3                   	ret
+		padc = ' ';
+  800571:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800575:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80057c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800583:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80058a:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80058f:	8d 47 01             	lea    0x1(%edi),%eax
+  800592:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800595:	0f b6 17             	movzbl (%edi),%edx
+  800598:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80059b:	3c 55                	cmp    $0x55,%al
+  80059d:	0f 87 cf 03 00 00    	ja     800972 <vprintfmt+0x437>
+  8005a3:	0f b6 c0             	movzbl %al,%eax
+  8005a6:	ff 24 85 20 30 80 00 	jmp    *0x803020(,%eax,4)
+  8005ad:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8005b0:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8005b4:	eb d9                	jmp    80058f <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005b6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8005b9:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8005bd:	eb d0                	jmp    80058f <vprintfmt+0x54>
+  8005bf:	0f b6 d2             	movzbl %dl,%edx
+  8005c2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8005c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005ca:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8005cd:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8005d0:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8005d4:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8005d7:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8005da:	83 f9 09             	cmp    $0x9,%ecx
+  8005dd:	77 55                	ja     800634 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8005df:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8005e2:	eb e9                	jmp    8005cd <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8005e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e7:	8b 00                	mov    (%eax),%eax
+  8005e9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ef:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f2:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005f5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8005f8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005fc:	79 91                	jns    80058f <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8005fe:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800601:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800604:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80060b:	eb 82                	jmp    80058f <vprintfmt+0x54>
+			if (width < 0)
+  80060d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800610:	85 d2                	test   %edx,%edx
+  800612:	b8 00 00 00 00       	mov    $0x0,%eax
+  800617:	0f 49 c2             	cmovns %edx,%eax
+  80061a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80061d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800620:	e9 6a ff ff ff       	jmp    80058f <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800625:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800628:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80062f:	e9 5b ff ff ff       	jmp    80058f <vprintfmt+0x54>
+  800634:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800637:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80063a:	eb bc                	jmp    8005f8 <vprintfmt+0xbd>
+			lflag++;
+  80063c:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80063f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800642:	e9 48 ff ff ff       	jmp    80058f <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800647:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064a:	8d 78 04             	lea    0x4(%eax),%edi
+  80064d:	83 ec 08             	sub    $0x8,%esp
+  800650:	53                   	push   %ebx
+  800651:	ff 30                	push   (%eax)
+  800653:	ff d6                	call   *%esi
+			break;
+  800655:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800658:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80065b:	e9 b1 02 00 00       	jmp    800911 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800660:	8b 45 14             	mov    0x14(%ebp),%eax
+  800663:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800666:	8b 10                	mov    (%eax),%edx
+  800668:	89 d0                	mov    %edx,%eax
+  80066a:	f7 d8                	neg    %eax
+  80066c:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80066f:	83 f8 0d             	cmp    $0xd,%eax
+  800672:	7f 23                	jg     800697 <vprintfmt+0x15c>
+  800674:	8b 14 85 80 31 80 00 	mov    0x803180(,%eax,4),%edx
+  80067b:	85 d2                	test   %edx,%edx
+  80067d:	74 18                	je     800697 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80067f:	52                   	push   %edx
+  800680:	68 52 2f 80 00       	push   $0x802f52
+  800685:	53                   	push   %ebx
+  800686:	56                   	push   %esi
+  800687:	e8 92 fe ff ff       	call   80051e <printfmt>
+  80068c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80068f:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800692:	e9 7a 02 00 00       	jmp    800911 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800697:	50                   	push   %eax
+  800698:	68 49 2f 80 00       	push   $0x802f49
+  80069d:	53                   	push   %ebx
+  80069e:	56                   	push   %esi
+  80069f:	e8 7a fe ff ff       	call   80051e <printfmt>
+  8006a4:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006a7:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8006aa:	e9 62 02 00 00       	jmp    800911 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b2:	83 c0 04             	add    $0x4,%eax
+  8006b5:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8006b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bb:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8006bd:	85 c9                	test   %ecx,%ecx
+  8006bf:	b8 42 2f 80 00       	mov    $0x802f42,%eax
+  8006c4:	0f 45 c1             	cmovne %ecx,%eax
+  8006c7:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8006ca:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8006ce:	7e 06                	jle    8006d6 <vprintfmt+0x19b>
+  8006d0:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8006d4:	75 0b                	jne    8006e1 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006d6:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8006d9:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8006dc:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006df:	eb 5c                	jmp    80073d <vprintfmt+0x202>
+  8006e1:	83 ec 08             	sub    $0x8,%esp
+  8006e4:	ff 75 d0             	push   -0x30(%ebp)
+  8006e7:	ff 75 cc             	push   -0x34(%ebp)
+  8006ea:	e8 20 03 00 00       	call   800a0f <strnlen>
+  8006ef:	89 c2                	mov    %eax,%edx
+  8006f1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006f4:	29 d0                	sub    %edx,%eax
+  8006f6:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8006f9:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8006fd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800700:	89 75 08             	mov    %esi,0x8(%ebp)
+  800703:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800705:	eb 0e                	jmp    800715 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800707:	83 ec 08             	sub    $0x8,%esp
+  80070a:	53                   	push   %ebx
+  80070b:	57                   	push   %edi
+  80070c:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80070f:	83 ee 01             	sub    $0x1,%esi
+  800712:	83 c4 10             	add    $0x10,%esp
+  800715:	85 f6                	test   %esi,%esi
+  800717:	7f ee                	jg     800707 <vprintfmt+0x1cc>
+  800719:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80071c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80071f:	85 c0                	test   %eax,%eax
+  800721:	ba 00 00 00 00       	mov    $0x0,%edx
+  800726:	0f 49 d0             	cmovns %eax,%edx
+  800729:	29 d0                	sub    %edx,%eax
+  80072b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80072e:	eb a6                	jmp    8006d6 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800730:	83 ec 08             	sub    $0x8,%esp
+  800733:	53                   	push   %ebx
+  800734:	52                   	push   %edx
+  800735:	ff 55 08             	call   *0x8(%ebp)
+  800738:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80073b:	89 f1                	mov    %esi,%ecx
+  80073d:	8d 71 01             	lea    0x1(%ecx),%esi
+  800740:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800744:	0f be d0             	movsbl %al,%edx
+  800747:	85 d2                	test   %edx,%edx
+  800749:	74 28                	je     800773 <vprintfmt+0x238>
+  80074b:	85 ff                	test   %edi,%edi
+  80074d:	78 05                	js     800754 <vprintfmt+0x219>
+  80074f:	83 ef 01             	sub    $0x1,%edi
+  800752:	78 30                	js     800784 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800754:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800758:	74 d6                	je     800730 <vprintfmt+0x1f5>
+  80075a:	0f be c0             	movsbl %al,%eax
+  80075d:	83 e8 20             	sub    $0x20,%eax
+  800760:	83 f8 5e             	cmp    $0x5e,%eax
+  800763:	76 cb                	jbe    800730 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800765:	83 ec 08             	sub    $0x8,%esp
+  800768:	53                   	push   %ebx
+  800769:	6a 3f                	push   $0x3f
+  80076b:	ff 55 08             	call   *0x8(%ebp)
+  80076e:	83 c4 10             	add    $0x10,%esp
+  800771:	eb c8                	jmp    80073b <vprintfmt+0x200>
+  800773:	8b 75 08             	mov    0x8(%ebp),%esi
+  800776:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800779:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80077c:	01 d0                	add    %edx,%eax
+  80077e:	29 c8                	sub    %ecx,%eax
+  800780:	89 c7                	mov    %eax,%edi
+  800782:	eb 13                	jmp    800797 <vprintfmt+0x25c>
+  800784:	8b 75 08             	mov    0x8(%ebp),%esi
+  800787:	eb ed                	jmp    800776 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800789:	83 ec 08             	sub    $0x8,%esp
+  80078c:	53                   	push   %ebx
+  80078d:	6a 20                	push   $0x20
+  80078f:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800791:	83 ef 01             	sub    $0x1,%edi
+  800794:	83 c4 10             	add    $0x10,%esp
+  800797:	85 ff                	test   %edi,%edi
+  800799:	7f ee                	jg     800789 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80079b:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80079e:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007a1:	e9 6b 01 00 00       	jmp    800911 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8007a6:	83 f9 01             	cmp    $0x1,%ecx
+  8007a9:	7f 1f                	jg     8007ca <vprintfmt+0x28f>
+	else if (lflag)
+  8007ab:	85 c9                	test   %ecx,%ecx
+  8007ad:	74 67                	je     800816 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8007af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b2:	8b 00                	mov    (%eax),%eax
+  8007b4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007b7:	89 c1                	mov    %eax,%ecx
+  8007b9:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007bc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c2:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007c8:	eb 17                	jmp    8007e1 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8007ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007cd:	8b 50 04             	mov    0x4(%eax),%edx
+  8007d0:	8b 00                	mov    (%eax),%eax
+  8007d2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007d5:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8007d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007db:	8d 40 08             	lea    0x8(%eax),%eax
+  8007de:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8007e1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007e4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8007e7:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8007ec:	85 c9                	test   %ecx,%ecx
+  8007ee:	0f 89 03 01 00 00    	jns    8008f7 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8007f4:	83 ec 08             	sub    $0x8,%esp
+  8007f7:	53                   	push   %ebx
+  8007f8:	6a 2d                	push   $0x2d
+  8007fa:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8007fc:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007ff:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800802:	f7 da                	neg    %edx
+  800804:	83 d1 00             	adc    $0x0,%ecx
+  800807:	f7 d9                	neg    %ecx
+  800809:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80080c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800811:	e9 e1 00 00 00       	jmp    8008f7 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800816:	8b 45 14             	mov    0x14(%ebp),%eax
+  800819:	8b 00                	mov    (%eax),%eax
+  80081b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80081e:	89 c1                	mov    %eax,%ecx
+  800820:	c1 f9 1f             	sar    $0x1f,%ecx
+  800823:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800826:	8b 45 14             	mov    0x14(%ebp),%eax
+  800829:	8d 40 04             	lea    0x4(%eax),%eax
+  80082c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80082f:	eb b0                	jmp    8007e1 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800831:	83 f9 01             	cmp    $0x1,%ecx
+  800834:	7f 1e                	jg     800854 <vprintfmt+0x319>
+	else if (lflag)
+  800836:	85 c9                	test   %ecx,%ecx
+  800838:	74 32                	je     80086c <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  80083a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083d:	8b 10                	mov    (%eax),%edx
+  80083f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800844:	8d 40 04             	lea    0x4(%eax),%eax
+  800847:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80084a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80084f:	e9 a3 00 00 00       	jmp    8008f7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800854:	8b 45 14             	mov    0x14(%ebp),%eax
+  800857:	8b 10                	mov    (%eax),%edx
+  800859:	8b 48 04             	mov    0x4(%eax),%ecx
+  80085c:	8d 40 08             	lea    0x8(%eax),%eax
+  80085f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800862:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800867:	e9 8b 00 00 00       	jmp    8008f7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80086c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80086f:	8b 10                	mov    (%eax),%edx
+  800871:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800876:	8d 40 04             	lea    0x4(%eax),%eax
+  800879:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80087c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800881:	eb 74                	jmp    8008f7 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800883:	83 f9 01             	cmp    $0x1,%ecx
+  800886:	7f 1b                	jg     8008a3 <vprintfmt+0x368>
+	else if (lflag)
+  800888:	85 c9                	test   %ecx,%ecx
+  80088a:	74 2c                	je     8008b8 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  80088c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80088f:	8b 10                	mov    (%eax),%edx
+  800891:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800896:	8d 40 04             	lea    0x4(%eax),%eax
+  800899:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80089c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8008a1:	eb 54                	jmp    8008f7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8008a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a6:	8b 10                	mov    (%eax),%edx
+  8008a8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008ab:	8d 40 08             	lea    0x8(%eax),%eax
+  8008ae:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8008b1:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8008b6:	eb 3f                	jmp    8008f7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8008b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008bb:	8b 10                	mov    (%eax),%edx
+  8008bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008c2:	8d 40 04             	lea    0x4(%eax),%eax
+  8008c5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8008c8:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8008cd:	eb 28                	jmp    8008f7 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8008cf:	83 ec 08             	sub    $0x8,%esp
+  8008d2:	53                   	push   %ebx
+  8008d3:	6a 30                	push   $0x30
+  8008d5:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8008d7:	83 c4 08             	add    $0x8,%esp
+  8008da:	53                   	push   %ebx
+  8008db:	6a 78                	push   $0x78
+  8008dd:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8008df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e2:	8b 10                	mov    (%eax),%edx
+  8008e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8008e9:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8008ec:	8d 40 04             	lea    0x4(%eax),%eax
+  8008ef:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008f2:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8008f7:	83 ec 0c             	sub    $0xc,%esp
+  8008fa:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8008fe:	50                   	push   %eax
+  8008ff:	ff 75 e0             	push   -0x20(%ebp)
+  800902:	57                   	push   %edi
+  800903:	51                   	push   %ecx
+  800904:	52                   	push   %edx
+  800905:	89 da                	mov    %ebx,%edx
+  800907:	89 f0                	mov    %esi,%eax
+  800909:	e8 4a fb ff ff       	call   800458 <printnum>
+			break;
+  80090e:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800911:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800914:	e9 40 fc ff ff       	jmp    800559 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800919:	83 f9 01             	cmp    $0x1,%ecx
+  80091c:	7f 1b                	jg     800939 <vprintfmt+0x3fe>
+	else if (lflag)
+  80091e:	85 c9                	test   %ecx,%ecx
+  800920:	74 2c                	je     80094e <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800922:	8b 45 14             	mov    0x14(%ebp),%eax
+  800925:	8b 10                	mov    (%eax),%edx
+  800927:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80092c:	8d 40 04             	lea    0x4(%eax),%eax
+  80092f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800932:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800937:	eb be                	jmp    8008f7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800939:	8b 45 14             	mov    0x14(%ebp),%eax
+  80093c:	8b 10                	mov    (%eax),%edx
+  80093e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800941:	8d 40 08             	lea    0x8(%eax),%eax
+  800944:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800947:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80094c:	eb a9                	jmp    8008f7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80094e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800951:	8b 10                	mov    (%eax),%edx
+  800953:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800958:	8d 40 04             	lea    0x4(%eax),%eax
+  80095b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80095e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800963:	eb 92                	jmp    8008f7 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800965:	83 ec 08             	sub    $0x8,%esp
+  800968:	53                   	push   %ebx
+  800969:	6a 25                	push   $0x25
+  80096b:	ff d6                	call   *%esi
+			break;
+  80096d:	83 c4 10             	add    $0x10,%esp
+  800970:	eb 9f                	jmp    800911 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800972:	83 ec 08             	sub    $0x8,%esp
+  800975:	53                   	push   %ebx
+  800976:	6a 25                	push   $0x25
+  800978:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80097a:	83 c4 10             	add    $0x10,%esp
+  80097d:	89 f8                	mov    %edi,%eax
+  80097f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800983:	74 05                	je     80098a <vprintfmt+0x44f>
+  800985:	83 e8 01             	sub    $0x1,%eax
+  800988:	eb f5                	jmp    80097f <vprintfmt+0x444>
+  80098a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80098d:	eb 82                	jmp    800911 <vprintfmt+0x3d6>
+
+0080098f <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80098f:	55                   	push   %ebp
+  800990:	89 e5                	mov    %esp,%ebp
+  800992:	83 ec 18             	sub    $0x18,%esp
+  800995:	8b 45 08             	mov    0x8(%ebp),%eax
+  800998:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80099b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80099e:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8009a2:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8009a5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8009ac:	85 c0                	test   %eax,%eax
+  8009ae:	74 26                	je     8009d6 <vsnprintf+0x47>
+  8009b0:	85 d2                	test   %edx,%edx
+  8009b2:	7e 22                	jle    8009d6 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8009b4:	ff 75 14             	push   0x14(%ebp)
+  8009b7:	ff 75 10             	push   0x10(%ebp)
+  8009ba:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8009bd:	50                   	push   %eax
+  8009be:	68 01 05 80 00       	push   $0x800501
+  8009c3:	e8 73 fb ff ff       	call   80053b <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8009c8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8009cb:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8009ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009d1:	83 c4 10             	add    $0x10,%esp
+}
+  8009d4:	c9                   	leave
+  8009d5:	c3                   	ret
+		return -E_INVAL;
+  8009d6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009db:	eb f7                	jmp    8009d4 <vsnprintf+0x45>
+
+008009dd <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8009dd:	55                   	push   %ebp
+  8009de:	89 e5                	mov    %esp,%ebp
+  8009e0:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8009e3:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8009e6:	50                   	push   %eax
+  8009e7:	ff 75 10             	push   0x10(%ebp)
+  8009ea:	ff 75 0c             	push   0xc(%ebp)
+  8009ed:	ff 75 08             	push   0x8(%ebp)
+  8009f0:	e8 9a ff ff ff       	call   80098f <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8009f5:	c9                   	leave
+  8009f6:	c3                   	ret
+
+008009f7 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8009f7:	55                   	push   %ebp
+  8009f8:	89 e5                	mov    %esp,%ebp
+  8009fa:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8009fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a02:	eb 03                	jmp    800a07 <strlen+0x10>
+		n++;
+  800a04:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800a07:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a0b:	75 f7                	jne    800a04 <strlen+0xd>
+	return n;
+}
+  800a0d:	5d                   	pop    %ebp
+  800a0e:	c3                   	ret
+
+00800a0f <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a0f:	55                   	push   %ebp
+  800a10:	89 e5                	mov    %esp,%ebp
+  800a12:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a15:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a18:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a1d:	eb 03                	jmp    800a22 <strnlen+0x13>
+		n++;
+  800a1f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a22:	39 d0                	cmp    %edx,%eax
+  800a24:	74 08                	je     800a2e <strnlen+0x1f>
+  800a26:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a2a:	75 f3                	jne    800a1f <strnlen+0x10>
+  800a2c:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800a2e:	89 d0                	mov    %edx,%eax
+  800a30:	5d                   	pop    %ebp
+  800a31:	c3                   	ret
+
+00800a32 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a32:	55                   	push   %ebp
+  800a33:	89 e5                	mov    %esp,%ebp
+  800a35:	53                   	push   %ebx
+  800a36:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a39:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a41:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a45:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a48:	83 c0 01             	add    $0x1,%eax
+  800a4b:	84 d2                	test   %dl,%dl
+  800a4d:	75 f2                	jne    800a41 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a4f:	89 c8                	mov    %ecx,%eax
+  800a51:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a54:	c9                   	leave
+  800a55:	c3                   	ret
+
+00800a56 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a56:	55                   	push   %ebp
+  800a57:	89 e5                	mov    %esp,%ebp
+  800a59:	53                   	push   %ebx
+  800a5a:	83 ec 10             	sub    $0x10,%esp
+  800a5d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a60:	53                   	push   %ebx
+  800a61:	e8 91 ff ff ff       	call   8009f7 <strlen>
+  800a66:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800a69:	ff 75 0c             	push   0xc(%ebp)
+  800a6c:	01 d8                	add    %ebx,%eax
+  800a6e:	50                   	push   %eax
+  800a6f:	e8 be ff ff ff       	call   800a32 <strcpy>
+	return dst;
+}
+  800a74:	89 d8                	mov    %ebx,%eax
+  800a76:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a79:	c9                   	leave
+  800a7a:	c3                   	ret
+
+00800a7b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a7b:	55                   	push   %ebp
+  800a7c:	89 e5                	mov    %esp,%ebp
+  800a7e:	56                   	push   %esi
+  800a7f:	53                   	push   %ebx
+  800a80:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a83:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a86:	89 f3                	mov    %esi,%ebx
+  800a88:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a8b:	89 f0                	mov    %esi,%eax
+  800a8d:	eb 0f                	jmp    800a9e <strncpy+0x23>
+		*dst++ = *src;
+  800a8f:	83 c0 01             	add    $0x1,%eax
+  800a92:	0f b6 0a             	movzbl (%edx),%ecx
+  800a95:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a98:	80 f9 01             	cmp    $0x1,%cl
+  800a9b:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a9e:	39 d8                	cmp    %ebx,%eax
+  800aa0:	75 ed                	jne    800a8f <strncpy+0x14>
+	}
+	return ret;
+}
+  800aa2:	89 f0                	mov    %esi,%eax
+  800aa4:	5b                   	pop    %ebx
+  800aa5:	5e                   	pop    %esi
+  800aa6:	5d                   	pop    %ebp
+  800aa7:	c3                   	ret
+
+00800aa8 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800aa8:	55                   	push   %ebp
+  800aa9:	89 e5                	mov    %esp,%ebp
+  800aab:	56                   	push   %esi
+  800aac:	53                   	push   %ebx
+  800aad:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ab0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ab3:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800ab6:	89 f0                	mov    %esi,%eax
+  800ab8:	85 d2                	test   %edx,%edx
+  800aba:	74 21                	je     800add <strlcpy+0x35>
+  800abc:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800ac0:	89 f2                	mov    %esi,%edx
+  800ac2:	eb 09                	jmp    800acd <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800ac4:	83 c1 01             	add    $0x1,%ecx
+  800ac7:	83 c2 01             	add    $0x1,%edx
+  800aca:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800acd:	39 c2                	cmp    %eax,%edx
+  800acf:	74 09                	je     800ada <strlcpy+0x32>
+  800ad1:	0f b6 19             	movzbl (%ecx),%ebx
+  800ad4:	84 db                	test   %bl,%bl
+  800ad6:	75 ec                	jne    800ac4 <strlcpy+0x1c>
+  800ad8:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800ada:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800add:	29 f0                	sub    %esi,%eax
+}
+  800adf:	5b                   	pop    %ebx
+  800ae0:	5e                   	pop    %esi
+  800ae1:	5d                   	pop    %ebp
+  800ae2:	c3                   	ret
+
+00800ae3 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800ae3:	55                   	push   %ebp
+  800ae4:	89 e5                	mov    %esp,%ebp
+  800ae6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ae9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800aec:	eb 06                	jmp    800af4 <strcmp+0x11>
+		p++, q++;
+  800aee:	83 c1 01             	add    $0x1,%ecx
+  800af1:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800af4:	0f b6 01             	movzbl (%ecx),%eax
+  800af7:	84 c0                	test   %al,%al
+  800af9:	74 04                	je     800aff <strcmp+0x1c>
+  800afb:	3a 02                	cmp    (%edx),%al
+  800afd:	74 ef                	je     800aee <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800aff:	0f b6 c0             	movzbl %al,%eax
+  800b02:	0f b6 12             	movzbl (%edx),%edx
+  800b05:	29 d0                	sub    %edx,%eax
+}
+  800b07:	5d                   	pop    %ebp
+  800b08:	c3                   	ret
+
+00800b09 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b09:	55                   	push   %ebp
+  800b0a:	89 e5                	mov    %esp,%ebp
+  800b0c:	53                   	push   %ebx
+  800b0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b10:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b13:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800b16:	eb 09                	jmp    800b21 <strncmp+0x18>
+		n--, p++, q++;
+  800b18:	83 ea 01             	sub    $0x1,%edx
+  800b1b:	83 c0 01             	add    $0x1,%eax
+  800b1e:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800b21:	85 d2                	test   %edx,%edx
+  800b23:	74 18                	je     800b3d <strncmp+0x34>
+  800b25:	0f b6 18             	movzbl (%eax),%ebx
+  800b28:	84 db                	test   %bl,%bl
+  800b2a:	74 04                	je     800b30 <strncmp+0x27>
+  800b2c:	3a 19                	cmp    (%ecx),%bl
+  800b2e:	74 e8                	je     800b18 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b30:	0f b6 00             	movzbl (%eax),%eax
+  800b33:	0f b6 11             	movzbl (%ecx),%edx
+  800b36:	29 d0                	sub    %edx,%eax
+}
+  800b38:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b3b:	c9                   	leave
+  800b3c:	c3                   	ret
+		return 0;
+  800b3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b42:	eb f4                	jmp    800b38 <strncmp+0x2f>
+
+00800b44 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b44:	55                   	push   %ebp
+  800b45:	89 e5                	mov    %esp,%ebp
+  800b47:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b4a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b4e:	eb 03                	jmp    800b53 <strchr+0xf>
+  800b50:	83 c0 01             	add    $0x1,%eax
+  800b53:	0f b6 10             	movzbl (%eax),%edx
+  800b56:	84 d2                	test   %dl,%dl
+  800b58:	74 06                	je     800b60 <strchr+0x1c>
+		if (*s == c)
+  800b5a:	38 ca                	cmp    %cl,%dl
+  800b5c:	75 f2                	jne    800b50 <strchr+0xc>
+  800b5e:	eb 05                	jmp    800b65 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800b60:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b65:	5d                   	pop    %ebp
+  800b66:	c3                   	ret
+
+00800b67 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b67:	55                   	push   %ebp
+  800b68:	89 e5                	mov    %esp,%ebp
+  800b6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b6d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b71:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800b74:	38 ca                	cmp    %cl,%dl
+  800b76:	74 09                	je     800b81 <strfind+0x1a>
+  800b78:	84 d2                	test   %dl,%dl
+  800b7a:	74 05                	je     800b81 <strfind+0x1a>
+	for (; *s; s++)
+  800b7c:	83 c0 01             	add    $0x1,%eax
+  800b7f:	eb f0                	jmp    800b71 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800b81:	5d                   	pop    %ebp
+  800b82:	c3                   	ret
+
+00800b83 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b83:	55                   	push   %ebp
+  800b84:	89 e5                	mov    %esp,%ebp
+  800b86:	57                   	push   %edi
+  800b87:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b8a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b8d:	85 c9                	test   %ecx,%ecx
+  800b8f:	74 20                	je     800bb1 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b91:	89 f8                	mov    %edi,%eax
+  800b93:	09 c8                	or     %ecx,%eax
+  800b95:	a8 03                	test   $0x3,%al
+  800b97:	75 12                	jne    800bab <memset+0x28>
+		c &= 0xFF;
+  800b99:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b9d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800ba3:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800ba6:	fc                   	cld
+  800ba7:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ba9:	eb 06                	jmp    800bb1 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800bab:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bae:	fc                   	cld
+  800baf:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800bb1:	89 f8                	mov    %edi,%eax
+  800bb3:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800bb6:	c9                   	leave
+  800bb7:	c3                   	ret
+
+00800bb8 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800bb8:	55                   	push   %ebp
+  800bb9:	89 e5                	mov    %esp,%ebp
+  800bbb:	57                   	push   %edi
+  800bbc:	56                   	push   %esi
+  800bbd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bc0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800bc3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800bc6:	39 c6                	cmp    %eax,%esi
+  800bc8:	73 32                	jae    800bfc <memmove+0x44>
+  800bca:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800bcd:	39 d0                	cmp    %edx,%eax
+  800bcf:	73 2b                	jae    800bfc <memmove+0x44>
+		s += n;
+		d += n;
+  800bd1:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bd4:	89 d6                	mov    %edx,%esi
+  800bd6:	09 fe                	or     %edi,%esi
+  800bd8:	09 ce                	or     %ecx,%esi
+  800bda:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800be0:	75 0e                	jne    800bf0 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800be2:	83 ef 04             	sub    $0x4,%edi
+  800be5:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800be8:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800beb:	fd                   	std
+  800bec:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bee:	eb 09                	jmp    800bf9 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800bf0:	83 ef 01             	sub    $0x1,%edi
+  800bf3:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800bf6:	fd                   	std
+  800bf7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800bf9:	fc                   	cld
+  800bfa:	eb 1a                	jmp    800c16 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bfc:	89 f2                	mov    %esi,%edx
+  800bfe:	09 c2                	or     %eax,%edx
+  800c00:	09 ca                	or     %ecx,%edx
+  800c02:	f6 c2 03             	test   $0x3,%dl
+  800c05:	75 0a                	jne    800c11 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c07:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c0a:	89 c7                	mov    %eax,%edi
+  800c0c:	fc                   	cld
+  800c0d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c0f:	eb 05                	jmp    800c16 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c11:	89 c7                	mov    %eax,%edi
+  800c13:	fc                   	cld
+  800c14:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c16:	5e                   	pop    %esi
+  800c17:	5f                   	pop    %edi
+  800c18:	5d                   	pop    %ebp
+  800c19:	c3                   	ret
+
+00800c1a <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c1a:	55                   	push   %ebp
+  800c1b:	89 e5                	mov    %esp,%ebp
+  800c1d:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c20:	ff 75 10             	push   0x10(%ebp)
+  800c23:	ff 75 0c             	push   0xc(%ebp)
+  800c26:	ff 75 08             	push   0x8(%ebp)
+  800c29:	e8 8a ff ff ff       	call   800bb8 <memmove>
+}
+  800c2e:	c9                   	leave
+  800c2f:	c3                   	ret
+
+00800c30 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c30:	55                   	push   %ebp
+  800c31:	89 e5                	mov    %esp,%ebp
+  800c33:	56                   	push   %esi
+  800c34:	53                   	push   %ebx
+  800c35:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c38:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c3b:	89 c6                	mov    %eax,%esi
+  800c3d:	03 75 10             	add    0x10(%ebp),%esi
+  800c40:	eb 06                	jmp    800c48 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800c42:	83 c0 01             	add    $0x1,%eax
+  800c45:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800c48:	39 f0                	cmp    %esi,%eax
+  800c4a:	74 14                	je     800c60 <memcmp+0x30>
+		if (*s1 != *s2)
+  800c4c:	0f b6 08             	movzbl (%eax),%ecx
+  800c4f:	0f b6 1a             	movzbl (%edx),%ebx
+  800c52:	38 d9                	cmp    %bl,%cl
+  800c54:	74 ec                	je     800c42 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800c56:	0f b6 c1             	movzbl %cl,%eax
+  800c59:	0f b6 db             	movzbl %bl,%ebx
+  800c5c:	29 d8                	sub    %ebx,%eax
+  800c5e:	eb 05                	jmp    800c65 <memcmp+0x35>
+	}
+
+	return 0;
+  800c60:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c65:	5b                   	pop    %ebx
+  800c66:	5e                   	pop    %esi
+  800c67:	5d                   	pop    %ebp
+  800c68:	c3                   	ret
+
+00800c69 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c69:	55                   	push   %ebp
+  800c6a:	89 e5                	mov    %esp,%ebp
+  800c6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c72:	89 c2                	mov    %eax,%edx
+  800c74:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c77:	eb 03                	jmp    800c7c <memfind+0x13>
+  800c79:	83 c0 01             	add    $0x1,%eax
+  800c7c:	39 d0                	cmp    %edx,%eax
+  800c7e:	73 04                	jae    800c84 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c80:	38 08                	cmp    %cl,(%eax)
+  800c82:	75 f5                	jne    800c79 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800c84:	5d                   	pop    %ebp
+  800c85:	c3                   	ret
+
+00800c86 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c86:	55                   	push   %ebp
+  800c87:	89 e5                	mov    %esp,%ebp
+  800c89:	57                   	push   %edi
+  800c8a:	56                   	push   %esi
+  800c8b:	53                   	push   %ebx
+  800c8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c8f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c92:	eb 03                	jmp    800c97 <strtol+0x11>
+		s++;
+  800c94:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800c97:	0f b6 02             	movzbl (%edx),%eax
+  800c9a:	3c 20                	cmp    $0x20,%al
+  800c9c:	74 f6                	je     800c94 <strtol+0xe>
+  800c9e:	3c 09                	cmp    $0x9,%al
+  800ca0:	74 f2                	je     800c94 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800ca2:	3c 2b                	cmp    $0x2b,%al
+  800ca4:	74 2a                	je     800cd0 <strtol+0x4a>
+	int neg = 0;
+  800ca6:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800cab:	3c 2d                	cmp    $0x2d,%al
+  800cad:	74 2b                	je     800cda <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800caf:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800cb5:	75 0f                	jne    800cc6 <strtol+0x40>
+  800cb7:	80 3a 30             	cmpb   $0x30,(%edx)
+  800cba:	74 28                	je     800ce4 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800cbc:	85 db                	test   %ebx,%ebx
+  800cbe:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cc3:	0f 44 d8             	cmove  %eax,%ebx
+  800cc6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ccb:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800cce:	eb 46                	jmp    800d16 <strtol+0x90>
+		s++;
+  800cd0:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800cd3:	bf 00 00 00 00       	mov    $0x0,%edi
+  800cd8:	eb d5                	jmp    800caf <strtol+0x29>
+		s++, neg = 1;
+  800cda:	83 c2 01             	add    $0x1,%edx
+  800cdd:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ce2:	eb cb                	jmp    800caf <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ce4:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ce8:	74 0e                	je     800cf8 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800cea:	85 db                	test   %ebx,%ebx
+  800cec:	75 d8                	jne    800cc6 <strtol+0x40>
+		s++, base = 8;
+  800cee:	83 c2 01             	add    $0x1,%edx
+  800cf1:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800cf6:	eb ce                	jmp    800cc6 <strtol+0x40>
+		s += 2, base = 16;
+  800cf8:	83 c2 02             	add    $0x2,%edx
+  800cfb:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d00:	eb c4                	jmp    800cc6 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800d02:	0f be c0             	movsbl %al,%eax
+  800d05:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800d08:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d0b:	7d 3a                	jge    800d47 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800d0d:	83 c2 01             	add    $0x1,%edx
+  800d10:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d14:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800d16:	0f b6 02             	movzbl (%edx),%eax
+  800d19:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d1c:	89 f3                	mov    %esi,%ebx
+  800d1e:	80 fb 09             	cmp    $0x9,%bl
+  800d21:	76 df                	jbe    800d02 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800d23:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d26:	89 f3                	mov    %esi,%ebx
+  800d28:	80 fb 19             	cmp    $0x19,%bl
+  800d2b:	77 08                	ja     800d35 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800d2d:	0f be c0             	movsbl %al,%eax
+  800d30:	83 e8 57             	sub    $0x57,%eax
+  800d33:	eb d3                	jmp    800d08 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d35:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d38:	89 f3                	mov    %esi,%ebx
+  800d3a:	80 fb 19             	cmp    $0x19,%bl
+  800d3d:	77 08                	ja     800d47 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800d3f:	0f be c0             	movsbl %al,%eax
+  800d42:	83 e8 37             	sub    $0x37,%eax
+  800d45:	eb c1                	jmp    800d08 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d47:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d4b:	74 05                	je     800d52 <strtol+0xcc>
+		*endptr = (char *) s;
+  800d4d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d50:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800d52:	89 c8                	mov    %ecx,%eax
+  800d54:	f7 d8                	neg    %eax
+  800d56:	85 ff                	test   %edi,%edi
+  800d58:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d5b:	89 c8                	mov    %ecx,%eax
+  800d5d:	5b                   	pop    %ebx
+  800d5e:	5e                   	pop    %esi
+  800d5f:	5f                   	pop    %edi
+  800d60:	5d                   	pop    %ebp
+  800d61:	c3                   	ret
+
+00800d62 <atoi>:
+
+int
+atoi(const char *s)
+{
+  800d62:	55                   	push   %ebp
+  800d63:	89 e5                	mov    %esp,%ebp
+  800d65:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800d68:	6a 0a                	push   $0xa
+  800d6a:	6a 00                	push   $0x0
+  800d6c:	ff 75 08             	push   0x8(%ebp)
+  800d6f:	e8 12 ff ff ff       	call   800c86 <strtol>
+}
+  800d74:	c9                   	leave
+  800d75:	c3                   	ret
+
+00800d76 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800d76:	55                   	push   %ebp
+  800d77:	89 e5                	mov    %esp,%ebp
+  800d79:	57                   	push   %edi
+  800d7a:	56                   	push   %esi
+  800d7b:	53                   	push   %ebx
+  800d7c:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800d82:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800d88:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800d8e:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800d94:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800d9b:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800d9e:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800da5:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800da8:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800daf:	74 76                	je     800e27 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800db1:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800db7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dba:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800dc0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800dc7:	0f 88 06 01 00 00    	js     800ed3 <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800dcd:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800dd4:	0f 84 48 01 00 00    	je     800f22 <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800dda:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800de0:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800de6:	be 00 00 00 00       	mov    $0x0,%esi
+  800deb:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800df1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800df4:	55                   	push   %ebp
+  800df5:	68 fe 0d 80 00       	push   $0x800dfe
+  800dfa:	89 e5                	mov    %esp,%ebp
+  800dfc:	0f 34                	sysenter
+  800dfe:	83 c4 04             	add    $0x4,%esp
+  800e01:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800e02:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800e08:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800e0e:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800e11:	0f 85 9a 01 00 00    	jne    800fb1 <page_vec_call+0x23b>
+  800e17:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e1c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e1f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e22:	e9 29 01 00 00       	jmp    800f50 <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800e27:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800e2d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e30:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800e32:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e39:	78 2f                	js     800e6a <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800e3b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e42:	74 72                	je     800eb6 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800e44:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800e4a:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800e50:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e55:	89 fb                	mov    %edi,%ebx
+  800e57:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800e5a:	55                   	push   %ebp
+  800e5b:	68 64 0e 80 00       	push   $0x800e64
+  800e60:	89 e5                	mov    %esp,%ebp
+  800e62:	0f 34                	sysenter
+  800e64:	83 c4 04             	add    $0x4,%esp
+  800e67:	5d                   	pop    %ebp
+	return ret;
+  800e68:	eb 98                	jmp    800e02 <page_vec_call+0x8c>
+	asm volatile("cpuid"
+  800e6a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e6f:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800e71:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800e76:	f6 c6 08             	test   $0x8,%dh
+  800e79:	74 15                	je     800e90 <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e7b:	89 c2                	mov    %eax,%edx
+  800e7d:	c1 ea 08             	shr    $0x8,%edx
+  800e80:	83 e2 0f             	and    $0xf,%edx
+  800e83:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e88:	83 fa 06             	cmp    $0x6,%edx
+  800e8b:	74 0e                	je     800e9b <page_vec_call+0x125>
+  800e8d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e90:	0f b6 c9             	movzbl %cl,%ecx
+  800e93:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800e99:	eb a0                	jmp    800e3b <page_vec_call+0xc5>
+  800e9b:	89 c2                	mov    %eax,%edx
+  800e9d:	c1 ea 04             	shr    $0x4,%edx
+  800ea0:	83 e2 0f             	and    $0xf,%edx
+  800ea3:	83 fa 02             	cmp    $0x2,%edx
+  800ea6:	77 e5                	ja     800e8d <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800ea8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800eab:	83 f8 02             	cmp    $0x2,%eax
+  800eae:	0f 97 c1             	seta   %cl
+  800eb1:	0f b6 c9             	movzbl %cl,%ecx
+  800eb4:	eb d7                	jmp    800e8d <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800eb6:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ebb:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800ec1:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800ec7:	89 fb                	mov    %edi,%ebx
+  800ec9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800ecc:	cd 30                	int    $0x30
+  800ece:	e9 2f ff ff ff       	jmp    800e02 <page_vec_call+0x8c>
+  800ed3:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ed8:	0f a2                	cpuid
+		return 0;
+  800eda:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800edf:	f6 c6 08             	test   $0x8,%dh
+  800ee2:	74 15                	je     800ef9 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ee4:	89 c2                	mov    %eax,%edx
+  800ee6:	c1 ea 08             	shr    $0x8,%edx
+  800ee9:	83 e2 0f             	and    $0xf,%edx
+  800eec:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ef1:	83 fa 06             	cmp    $0x6,%edx
+  800ef4:	74 11                	je     800f07 <page_vec_call+0x191>
+  800ef6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800ef9:	0f b6 c9             	movzbl %cl,%ecx
+  800efc:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800f02:	e9 c6 fe ff ff       	jmp    800dcd <page_vec_call+0x57>
+  800f07:	89 c2                	mov    %eax,%edx
+  800f09:	c1 ea 04             	shr    $0x4,%edx
+  800f0c:	83 e2 0f             	and    $0xf,%edx
+  800f0f:	83 fa 02             	cmp    $0x2,%edx
+  800f12:	77 e2                	ja     800ef6 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800f14:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f17:	83 f8 02             	cmp    $0x2,%eax
+  800f1a:	0f 97 c1             	seta   %cl
+  800f1d:	0f b6 c9             	movzbl %cl,%ecx
+  800f20:	eb d4                	jmp    800ef6 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800f22:	be 00 00 00 00       	mov    $0x0,%esi
+  800f27:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800f2d:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800f33:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800f39:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800f3c:	cd 30                	int    $0x30
+  800f3e:	e9 bf fe ff ff       	jmp    800e02 <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800f43:	29 da                	sub    %ebx,%edx
+			vec++;
+  800f45:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800f48:	83 e8 01             	sub    $0x1,%eax
+  800f4b:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800f50:	85 c0                	test   %eax,%eax
+  800f52:	74 58                	je     800fac <page_vec_call+0x236>
+  800f54:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800f57:	39 da                	cmp    %ebx,%edx
+  800f59:	73 e8                	jae    800f43 <page_vec_call+0x1cd>
+  800f5b:	89 75 08             	mov    %esi,0x8(%ebp)
+  800f5e:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800f61:	84 c9                	test   %cl,%cl
+  800f63:	74 06                	je     800f6b <page_vec_call+0x1f5>
+  800f65:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800f6b:	83 ec 04             	sub    $0x4,%esp
+  800f6e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f71:	c1 e0 04             	shl    $0x4,%eax
+  800f74:	50                   	push   %eax
+  800f75:	ff 75 08             	push   0x8(%ebp)
+  800f78:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800f7e:	53                   	push   %ebx
+  800f7f:	e8 34 fc ff ff       	call   800bb8 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800f84:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800f8a:	89 c2                	mov    %eax,%edx
+  800f8c:	c1 e2 0c             	shl    $0xc,%edx
+  800f8f:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  800f95:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  800f9b:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  800fa1:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  800fa4:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  800fa7:	e9 f2 fd ff ff       	jmp    800d9e <page_vec_call+0x28>
+			r = 0;
+  800fac:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  800fb1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800fb5:	74 0b                	je     800fc2 <page_vec_call+0x24c>
+		*done = total;
+  800fb7:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800fba:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  800fc0:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  800fc2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fc5:	5b                   	pop    %ebx
+  800fc6:	5e                   	pop    %esi
+  800fc7:	5f                   	pop    %edi
+  800fc8:	5d                   	pop    %ebp
+  800fc9:	c3                   	ret
+
+00800fca <sys_cputs>:
+{
+  800fca:	55                   	push   %ebp
+  800fcb:	89 e5                	mov    %esp,%ebp
+  800fcd:	57                   	push   %edi
+  800fce:	56                   	push   %esi
+  800fcf:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800fd0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800fd7:	78 2d                	js     801006 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800fd9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800fe0:	74 70                	je     801052 <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800fe2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fe7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fed:	89 c3                	mov    %eax,%ebx
+  800fef:	89 c7                	mov    %eax,%edi
+  800ff1:	89 c6                	mov    %eax,%esi
+  800ff3:	55                   	push   %ebp
+  800ff4:	68 fd 0f 80 00       	push   $0x800ffd
+  800ff9:	89 e5                	mov    %esp,%ebp
+  800ffb:	0f 34                	sysenter
+  800ffd:	83 c4 04             	add    $0x4,%esp
+  801000:	5d                   	pop    %ebp
+}
+  801001:	5b                   	pop    %ebx
+  801002:	5e                   	pop    %esi
+  801003:	5f                   	pop    %edi
+  801004:	5d                   	pop    %ebp
+  801005:	c3                   	ret
+  801006:	b8 01 00 00 00       	mov    $0x1,%eax
+  80100b:	0f a2                	cpuid
+		return 0;
+  80100d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801012:	f6 c6 08             	test   $0x8,%dh
+  801015:	74 15                	je     80102c <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801017:	89 c2                	mov    %eax,%edx
+  801019:	c1 ea 08             	shr    $0x8,%edx
+  80101c:	83 e2 0f             	and    $0xf,%edx
+  80101f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801024:	83 fa 06             	cmp    $0x6,%edx
+  801027:	74 0e                	je     801037 <sys_cputs+0x6d>
+  801029:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80102c:	0f b6 c9             	movzbl %cl,%ecx
+  80102f:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801035:	eb a2                	jmp    800fd9 <sys_cputs+0xf>
+  801037:	89 c2                	mov    %eax,%edx
+  801039:	c1 ea 04             	shr    $0x4,%edx
+  80103c:	83 e2 0f             	and    $0xf,%edx
+  80103f:	83 fa 02             	cmp    $0x2,%edx
+  801042:	77 e5                	ja     801029 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  801044:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801047:	83 f8 02             	cmp    $0x2,%eax
+  80104a:	0f 97 c1             	seta   %cl
+  80104d:	0f b6 c9             	movzbl %cl,%ecx
+  801050:	eb d7                	jmp    801029 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  801052:	b8 00 00 00 00       	mov    $0x0,%eax
+  801057:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80105d:	89 c3                	mov    %eax,%ebx
+  80105f:	89 c7                	mov    %eax,%edi
+  801061:	89 c6                	mov    %eax,%esi
+  801063:	cd 30                	int    $0x30
+}
+  801065:	eb 9a                	jmp    801001 <sys_cputs+0x37>
+
+00801067 <sys_cgetc>:
+{
+  801067:	55                   	push   %ebp
+  801068:	89 e5                	mov    %esp,%ebp
+  80106a:	57                   	push   %edi
+  80106b:	56                   	push   %esi
+  80106c:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80106d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801074:	78 2e                	js     8010a4 <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  801076:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80107d:	74 71                	je     8010f0 <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  80107f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801084:	b8 01 00 00 00       	mov    $0x1,%eax
+  801089:	89 d1                	mov    %edx,%ecx
+  80108b:	89 d3                	mov    %edx,%ebx
+  80108d:	89 d7                	mov    %edx,%edi
+  80108f:	89 d6                	mov    %edx,%esi
+  801091:	55                   	push   %ebp
+  801092:	68 9b 10 80 00       	push   $0x80109b
+  801097:	89 e5                	mov    %esp,%ebp
+  801099:	0f 34                	sysenter
+  80109b:	83 c4 04             	add    $0x4,%esp
+  80109e:	5d                   	pop    %ebp
+}
+  80109f:	5b                   	pop    %ebx
+  8010a0:	5e                   	pop    %esi
+  8010a1:	5f                   	pop    %edi
+  8010a2:	5d                   	pop    %ebp
+  8010a3:	c3                   	ret
+  8010a4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010a9:	0f a2                	cpuid
+		return 0;
+  8010ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8010b0:	f6 c6 08             	test   $0x8,%dh
+  8010b3:	74 15                	je     8010ca <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010b5:	89 c2                	mov    %eax,%edx
+  8010b7:	c1 ea 08             	shr    $0x8,%edx
+  8010ba:	83 e2 0f             	and    $0xf,%edx
+  8010bd:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8010c2:	83 fa 06             	cmp    $0x6,%edx
+  8010c5:	74 0e                	je     8010d5 <sys_cgetc+0x6e>
+  8010c7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8010ca:	0f b6 c9             	movzbl %cl,%ecx
+  8010cd:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8010d3:	eb a1                	jmp    801076 <sys_cgetc+0xf>
+  8010d5:	89 c2                	mov    %eax,%edx
+  8010d7:	c1 ea 04             	shr    $0x4,%edx
+  8010da:	83 e2 0f             	and    $0xf,%edx
+  8010dd:	83 fa 02             	cmp    $0x2,%edx
+  8010e0:	77 e5                	ja     8010c7 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  8010e2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010e5:	83 f8 02             	cmp    $0x2,%eax
+  8010e8:	0f 97 c1             	seta   %cl
+  8010eb:	0f b6 c9             	movzbl %cl,%ecx
+  8010ee:	eb d7                	jmp    8010c7 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  8010f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010f5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010fa:	89 d1                	mov    %edx,%ecx
+  8010fc:	89 d3                	mov    %edx,%ebx
+  8010fe:	89 d7                	mov    %edx,%edi
+  801100:	89 d6                	mov    %edx,%esi
+  801102:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801104:	eb 99                	jmp    80109f <sys_cgetc+0x38>
+
+00801106 <sys_env_destroy>:
+{
+  801106:	55                   	push   %ebp
+  801107:	89 e5                	mov    %esp,%ebp
+  801109:	57                   	push   %edi
+  80110a:	56                   	push   %esi
+  80110b:	53                   	push   %ebx
+  80110c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80110f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801116:	78 36                	js     80114e <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  801118:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80111f:	74 79                	je     80119a <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  801121:	8b 55 08             	mov    0x8(%ebp),%edx
+  801124:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801129:	b8 03 00 00 00       	mov    $0x3,%eax
+  80112e:	89 cb                	mov    %ecx,%ebx
+  801130:	89 cf                	mov    %ecx,%edi
+  801132:	89 ce                	mov    %ecx,%esi
+  801134:	55                   	push   %ebp
+  801135:	68 3e 11 80 00       	push   $0x80113e
+  80113a:	89 e5                	mov    %esp,%ebp
+  80113c:	0f 34                	sysenter
+  80113e:	83 c4 04             	add    $0x4,%esp
+  801141:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801142:	85 c0                	test   %eax,%eax
+  801144:	7f 6b                	jg     8011b1 <sys_env_destroy+0xab>
+}
+  801146:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801149:	5b                   	pop    %ebx
+  80114a:	5e                   	pop    %esi
+  80114b:	5f                   	pop    %edi
+  80114c:	5d                   	pop    %ebp
+  80114d:	c3                   	ret
+  80114e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801153:	0f a2                	cpuid
+		return 0;
+  801155:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80115a:	f6 c6 08             	test   $0x8,%dh
+  80115d:	74 15                	je     801174 <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80115f:	89 c2                	mov    %eax,%edx
+  801161:	c1 ea 08             	shr    $0x8,%edx
+  801164:	83 e2 0f             	and    $0xf,%edx
+  801167:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80116c:	83 fa 06             	cmp    $0x6,%edx
+  80116f:	74 0e                	je     80117f <sys_env_destroy+0x79>
+  801171:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801174:	0f b6 c9             	movzbl %cl,%ecx
+  801177:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80117d:	eb 99                	jmp    801118 <sys_env_destroy+0x12>
+  80117f:	89 c2                	mov    %eax,%edx
+  801181:	c1 ea 04             	shr    $0x4,%edx
+  801184:	83 e2 0f             	and    $0xf,%edx
+  801187:	83 fa 02             	cmp    $0x2,%edx
+  80118a:	77 e5                	ja     801171 <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  80118c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80118f:	83 f8 02             	cmp    $0x2,%eax
+  801192:	0f 97 c1             	seta   %cl
+  801195:	0f b6 c9             	movzbl %cl,%ecx
+  801198:	eb d7                	jmp    801171 <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  80119a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80119f:	b8 03 00 00 00       	mov    $0x3,%eax
+  8011a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a7:	89 cb                	mov    %ecx,%ebx
+  8011a9:	89 cf                	mov    %ecx,%edi
+  8011ab:	89 ce                	mov    %ecx,%esi
+  8011ad:	cd 30                	int    $0x30
+  8011af:	eb 91                	jmp    801142 <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011b1:	83 ec 0c             	sub    $0xc,%esp
+  8011b4:	50                   	push   %eax
+  8011b5:	6a 03                	push   $0x3
+  8011b7:	68 f9 31 80 00       	push   $0x8031f9
+  8011bc:	6a 4a                	push   $0x4a
+  8011be:	68 16 32 80 00       	push   $0x803216
+  8011c3:	e8 68 f1 ff ff       	call   800330 <_panic>
+
+008011c8 <sys_getenvid>:
+{
+  8011c8:	55                   	push   %ebp
+  8011c9:	89 e5                	mov    %esp,%ebp
+  8011cb:	57                   	push   %edi
+  8011cc:	56                   	push   %esi
+  8011cd:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8011ce:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8011d5:	78 2e                	js     801205 <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  8011d7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8011de:	74 71                	je     801251 <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  8011e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011e5:	b8 02 00 00 00       	mov    $0x2,%eax
+  8011ea:	89 d1                	mov    %edx,%ecx
+  8011ec:	89 d3                	mov    %edx,%ebx
+  8011ee:	89 d7                	mov    %edx,%edi
+  8011f0:	89 d6                	mov    %edx,%esi
+  8011f2:	55                   	push   %ebp
+  8011f3:	68 fc 11 80 00       	push   $0x8011fc
+  8011f8:	89 e5                	mov    %esp,%ebp
+  8011fa:	0f 34                	sysenter
+  8011fc:	83 c4 04             	add    $0x4,%esp
+  8011ff:	5d                   	pop    %ebp
+}
+  801200:	5b                   	pop    %ebx
+  801201:	5e                   	pop    %esi
+  801202:	5f                   	pop    %edi
+  801203:	5d                   	pop    %ebp
+  801204:	c3                   	ret
+  801205:	b8 01 00 00 00       	mov    $0x1,%eax
+  80120a:	0f a2                	cpuid
+		return 0;
+  80120c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801211:	f6 c6 08             	test   $0x8,%dh
+  801214:	74 15                	je     80122b <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801216:	89 c2                	mov    %eax,%edx
+  801218:	c1 ea 08             	shr    $0x8,%edx
+  80121b:	83 e2 0f             	and    $0xf,%edx
+  80121e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801223:	83 fa 06             	cmp    $0x6,%edx
+  801226:	74 0e                	je     801236 <sys_getenvid+0x6e>
+  801228:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80122b:	0f b6 c9             	movzbl %cl,%ecx
+  80122e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801234:	eb a1                	jmp    8011d7 <sys_getenvid+0xf>
+  801236:	89 c2                	mov    %eax,%edx
+  801238:	c1 ea 04             	shr    $0x4,%edx
+  80123b:	83 e2 0f             	and    $0xf,%edx
+  80123e:	83 fa 02             	cmp    $0x2,%edx
+  801241:	77 e5                	ja     801228 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  801243:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801246:	83 f8 02             	cmp    $0x2,%eax
+  801249:	0f 97 c1             	seta   %cl
+  80124c:	0f b6 c9             	movzbl %cl,%ecx
+  80124f:	eb d7                	jmp    801228 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  801251:	ba 00 00 00 00       	mov    $0x0,%edx
+  801256:	b8 02 00 00 00       	mov    $0x2,%eax
+  80125b:	89 d1                	mov    %edx,%ecx
+  80125d:	89 d3                	mov    %edx,%ebx
+  80125f:	89 d7                	mov    %edx,%edi
+  801261:	89 d6                	mov    %edx,%esi
+  801263:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801265:	eb 99                	jmp    801200 <sys_getenvid+0x38>
+
+00801267 <sys_page_alloc>:
+{
+  801267:	55                   	push   %ebp
+  801268:	89 e5                	mov    %esp,%ebp
+  80126a:	57                   	push   %edi
+  80126b:	56                   	push   %esi
+  80126c:	53                   	push   %ebx
+  80126d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801270:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801277:	78 38                	js     8012b1 <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  801279:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801280:	74 7b                	je     8012fd <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  801282:	be 00 00 00 00       	mov    $0x0,%esi
+  801287:	8b 55 08             	mov    0x8(%ebp),%edx
+  80128a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80128d:	b8 04 00 00 00       	mov    $0x4,%eax
+  801292:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801295:	89 f7                	mov    %esi,%edi
+  801297:	55                   	push   %ebp
+  801298:	68 a1 12 80 00       	push   $0x8012a1
+  80129d:	89 e5                	mov    %esp,%ebp
+  80129f:	0f 34                	sysenter
+  8012a1:	83 c4 04             	add    $0x4,%esp
+  8012a4:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8012a5:	85 c0                	test   %eax,%eax
+  8012a7:	7f 6d                	jg     801316 <sys_page_alloc+0xaf>
+}
+  8012a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ac:	5b                   	pop    %ebx
+  8012ad:	5e                   	pop    %esi
+  8012ae:	5f                   	pop    %edi
+  8012af:	5d                   	pop    %ebp
+  8012b0:	c3                   	ret
+  8012b1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012b6:	0f a2                	cpuid
+		return 0;
+  8012b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8012bd:	f6 c6 08             	test   $0x8,%dh
+  8012c0:	74 15                	je     8012d7 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012c2:	89 c2                	mov    %eax,%edx
+  8012c4:	c1 ea 08             	shr    $0x8,%edx
+  8012c7:	83 e2 0f             	and    $0xf,%edx
+  8012ca:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012cf:	83 fa 06             	cmp    $0x6,%edx
+  8012d2:	74 0e                	je     8012e2 <sys_page_alloc+0x7b>
+  8012d4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8012d7:	0f b6 c9             	movzbl %cl,%ecx
+  8012da:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8012e0:	eb 97                	jmp    801279 <sys_page_alloc+0x12>
+  8012e2:	89 c2                	mov    %eax,%edx
+  8012e4:	c1 ea 04             	shr    $0x4,%edx
+  8012e7:	83 e2 0f             	and    $0xf,%edx
+  8012ea:	83 fa 02             	cmp    $0x2,%edx
+  8012ed:	77 e5                	ja     8012d4 <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  8012ef:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012f2:	83 f8 02             	cmp    $0x2,%eax
+  8012f5:	0f 97 c1             	seta   %cl
+  8012f8:	0f b6 c9             	movzbl %cl,%ecx
+  8012fb:	eb d7                	jmp    8012d4 <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  8012fd:	be 00 00 00 00       	mov    $0x0,%esi
+  801302:	b8 04 00 00 00       	mov    $0x4,%eax
+  801307:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80130d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801310:	89 f7                	mov    %esi,%edi
+  801312:	cd 30                	int    $0x30
+  801314:	eb 8f                	jmp    8012a5 <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801316:	83 ec 0c             	sub    $0xc,%esp
+  801319:	50                   	push   %eax
+  80131a:	6a 04                	push   $0x4
+  80131c:	68 f9 31 80 00       	push   $0x8031f9
+  801321:	6a 4a                	push   $0x4a
+  801323:	68 16 32 80 00       	push   $0x803216
+  801328:	e8 03 f0 ff ff       	call   800330 <_panic>
+
+0080132d <sys_page_map>:
+{
+  80132d:	55                   	push   %ebp
+  80132e:	89 e5                	mov    %esp,%ebp
+  801330:	57                   	push   %edi
+  801331:	56                   	push   %esi
+  801332:	53                   	push   %ebx
+  801333:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801336:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80133d:	78 37                	js     801376 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  80133f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801346:	74 7a                	je     8013c2 <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  801348:	8b 55 08             	mov    0x8(%ebp),%edx
+  80134b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80134e:	b8 05 00 00 00       	mov    $0x5,%eax
+  801353:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801356:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801359:	8b 75 18             	mov    0x18(%ebp),%esi
+  80135c:	55                   	push   %ebp
+  80135d:	68 66 13 80 00       	push   $0x801366
+  801362:	89 e5                	mov    %esp,%ebp
+  801364:	0f 34                	sysenter
+  801366:	83 c4 04             	add    $0x4,%esp
+  801369:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80136a:	85 c0                	test   %eax,%eax
+  80136c:	7f 6c                	jg     8013da <sys_page_map+0xad>
+}
+  80136e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801371:	5b                   	pop    %ebx
+  801372:	5e                   	pop    %esi
+  801373:	5f                   	pop    %edi
+  801374:	5d                   	pop    %ebp
+  801375:	c3                   	ret
+  801376:	b8 01 00 00 00       	mov    $0x1,%eax
+  80137b:	0f a2                	cpuid
+		return 0;
+  80137d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801382:	f6 c6 08             	test   $0x8,%dh
+  801385:	74 15                	je     80139c <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801387:	89 c2                	mov    %eax,%edx
+  801389:	c1 ea 08             	shr    $0x8,%edx
+  80138c:	83 e2 0f             	and    $0xf,%edx
+  80138f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801394:	83 fa 06             	cmp    $0x6,%edx
+  801397:	74 0e                	je     8013a7 <sys_page_map+0x7a>
+  801399:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80139c:	0f b6 c9             	movzbl %cl,%ecx
+  80139f:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8013a5:	eb 98                	jmp    80133f <sys_page_map+0x12>
+  8013a7:	89 c2                	mov    %eax,%edx
+  8013a9:	c1 ea 04             	shr    $0x4,%edx
+  8013ac:	83 e2 0f             	and    $0xf,%edx
+  8013af:	83 fa 02             	cmp    $0x2,%edx
+  8013b2:	77 e5                	ja     801399 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  8013b4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013b7:	83 f8 02             	cmp    $0x2,%eax
+  8013ba:	0f 97 c1             	seta   %cl
+  8013bd:	0f b6 c9             	movzbl %cl,%ecx
+  8013c0:	eb d7                	jmp    801399 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  8013c2:	b8 05 00 00 00       	mov    $0x5,%eax
+  8013c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013cd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013d0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013d3:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013d6:	cd 30                	int    $0x30
+  8013d8:	eb 90                	jmp    80136a <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013da:	83 ec 0c             	sub    $0xc,%esp
+  8013dd:	50                   	push   %eax
+  8013de:	6a 05                	push   $0x5
+  8013e0:	68 f9 31 80 00       	push   $0x8031f9
+  8013e5:	6a 4a                	push   $0x4a
+  8013e7:	68 16 32 80 00       	push   $0x803216
+  8013ec:	e8 3f ef ff ff       	call   800330 <_panic>
+
+008013f1 <sys_page_unmap>:
+{
+  8013f1:	55                   	push   %ebp
+  8013f2:	89 e5                	mov    %esp,%ebp
+  8013f4:	57                   	push   %edi
+  8013f5:	56                   	push   %esi
+  8013f6:	53                   	push   %ebx
+  8013f7:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8013fa:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801401:	78 37                	js     80143a <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  801403:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80140a:	74 7a                	je     801486 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  80140c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801411:	8b 55 08             	mov    0x8(%ebp),%edx
+  801414:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801417:	b8 06 00 00 00       	mov    $0x6,%eax
+  80141c:	89 df                	mov    %ebx,%edi
+  80141e:	89 de                	mov    %ebx,%esi
+  801420:	55                   	push   %ebp
+  801421:	68 2a 14 80 00       	push   $0x80142a
+  801426:	89 e5                	mov    %esp,%ebp
+  801428:	0f 34                	sysenter
+  80142a:	83 c4 04             	add    $0x4,%esp
+  80142d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80142e:	85 c0                	test   %eax,%eax
+  801430:	7f 6c                	jg     80149e <sys_page_unmap+0xad>
+}
+  801432:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801435:	5b                   	pop    %ebx
+  801436:	5e                   	pop    %esi
+  801437:	5f                   	pop    %edi
+  801438:	5d                   	pop    %ebp
+  801439:	c3                   	ret
+  80143a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80143f:	0f a2                	cpuid
+		return 0;
+  801441:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801446:	f6 c6 08             	test   $0x8,%dh
+  801449:	74 15                	je     801460 <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80144b:	89 c2                	mov    %eax,%edx
+  80144d:	c1 ea 08             	shr    $0x8,%edx
+  801450:	83 e2 0f             	and    $0xf,%edx
+  801453:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801458:	83 fa 06             	cmp    $0x6,%edx
+  80145b:	74 0e                	je     80146b <sys_page_unmap+0x7a>
+  80145d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801460:	0f b6 c9             	movzbl %cl,%ecx
+  801463:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801469:	eb 98                	jmp    801403 <sys_page_unmap+0x12>
+  80146b:	89 c2                	mov    %eax,%edx
+  80146d:	c1 ea 04             	shr    $0x4,%edx
+  801470:	83 e2 0f             	and    $0xf,%edx
+  801473:	83 fa 02             	cmp    $0x2,%edx
+  801476:	77 e5                	ja     80145d <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  801478:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80147b:	83 f8 02             	cmp    $0x2,%eax
+  80147e:	0f 97 c1             	seta   %cl
+  801481:	0f b6 c9             	movzbl %cl,%ecx
+  801484:	eb d7                	jmp    80145d <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  801486:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80148b:	b8 06 00 00 00       	mov    $0x6,%eax
+  801490:	8b 55 08             	mov    0x8(%ebp),%edx
+  801493:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801496:	89 df                	mov    %ebx,%edi
+  801498:	89 de                	mov    %ebx,%esi
+  80149a:	cd 30                	int    $0x30
+  80149c:	eb 90                	jmp    80142e <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80149e:	83 ec 0c             	sub    $0xc,%esp
+  8014a1:	50                   	push   %eax
+  8014a2:	6a 06                	push   $0x6
+  8014a4:	68 f9 31 80 00       	push   $0x8031f9
+  8014a9:	6a 4a                	push   $0x4a
+  8014ab:	68 16 32 80 00       	push   $0x803216
+  8014b0:	e8 7b ee ff ff       	call   800330 <_panic>
+
+008014b5 <sys_page_copy>:
+{
+  8014b5:	55                   	push   %ebp
+  8014b6:	89 e5                	mov    %esp,%ebp
+  8014b8:	57                   	push   %edi
+  8014b9:	56                   	push   %esi
+  8014ba:	53                   	push   %ebx
+  8014bb:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8014be:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8014c5:	78 37                	js     8014fe <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  8014c7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8014ce:	74 7a                	je     80154a <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  8014d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014d6:	b8 29 00 00 00       	mov    $0x29,%eax
+  8014db:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014de:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014e1:	8b 75 18             	mov    0x18(%ebp),%esi
+  8014e4:	55                   	push   %ebp
+  8014e5:	68 ee 14 80 00       	push   $0x8014ee
+  8014ea:	89 e5                	mov    %esp,%ebp
+  8014ec:	0f 34                	sysenter
+  8014ee:	83 c4 04             	add    $0x4,%esp
+  8014f1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8014f2:	85 c0                	test   %eax,%eax
+  8014f4:	7f 6c                	jg     801562 <sys_page_copy+0xad>
+}
+  8014f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014f9:	5b                   	pop    %ebx
+  8014fa:	5e                   	pop    %esi
+  8014fb:	5f                   	pop    %edi
+  8014fc:	5d                   	pop    %ebp
+  8014fd:	c3                   	ret
+  8014fe:	b8 01 00 00 00       	mov    $0x1,%eax
+  801503:	0f a2                	cpuid
+		return 0;
+  801505:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80150a:	f6 c6 08             	test   $0x8,%dh
+  80150d:	74 15                	je     801524 <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80150f:	89 c2                	mov    %eax,%edx
+  801511:	c1 ea 08             	shr    $0x8,%edx
+  801514:	83 e2 0f             	and    $0xf,%edx
+  801517:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80151c:	83 fa 06             	cmp    $0x6,%edx
+  80151f:	74 0e                	je     80152f <sys_page_copy+0x7a>
+  801521:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801524:	0f b6 c9             	movzbl %cl,%ecx
+  801527:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80152d:	eb 98                	jmp    8014c7 <sys_page_copy+0x12>
+  80152f:	89 c2                	mov    %eax,%edx
+  801531:	c1 ea 04             	shr    $0x4,%edx
+  801534:	83 e2 0f             	and    $0xf,%edx
+  801537:	83 fa 02             	cmp    $0x2,%edx
+  80153a:	77 e5                	ja     801521 <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  80153c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80153f:	83 f8 02             	cmp    $0x2,%eax
+  801542:	0f 97 c1             	seta   %cl
+  801545:	0f b6 c9             	movzbl %cl,%ecx
+  801548:	eb d7                	jmp    801521 <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  80154a:	b8 29 00 00 00       	mov    $0x29,%eax
+  80154f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801552:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801555:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801558:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80155b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80155e:	cd 30                	int    $0x30
+  801560:	eb 90                	jmp    8014f2 <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801562:	83 ec 0c             	sub    $0xc,%esp
+  801565:	50                   	push   %eax
+  801566:	6a 29                	push   $0x29
+  801568:	68 f9 31 80 00       	push   $0x8031f9
+  80156d:	6a 4a                	push   $0x4a
+  80156f:	68 16 32 80 00       	push   $0x803216
+  801574:	e8 b7 ed ff ff       	call   800330 <_panic>
+
+00801579 <sys_yield>:
+{
+  801579:	55                   	push   %ebp
+  80157a:	89 e5                	mov    %esp,%ebp
+  80157c:	57                   	push   %edi
+  80157d:	56                   	push   %esi
+  80157e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80157f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801586:	78 2e                	js     8015b6 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  801588:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80158f:	74 71                	je     801602 <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  801591:	ba 00 00 00 00       	mov    $0x0,%edx
+  801596:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80159b:	89 d1                	mov    %edx,%ecx
+  80159d:	89 d3                	mov    %edx,%ebx
+  80159f:	89 d7                	mov    %edx,%edi
+  8015a1:	89 d6                	mov    %edx,%esi
+  8015a3:	55                   	push   %ebp
+  8015a4:	68 ad 15 80 00       	push   $0x8015ad
+  8015a9:	89 e5                	mov    %esp,%ebp
+  8015ab:	0f 34                	sysenter
+  8015ad:	83 c4 04             	add    $0x4,%esp
+  8015b0:	5d                   	pop    %ebp
+}
+  8015b1:	5b                   	pop    %ebx
+  8015b2:	5e                   	pop    %esi
+  8015b3:	5f                   	pop    %edi
+  8015b4:	5d                   	pop    %ebp
+  8015b5:	c3                   	ret
+  8015b6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015bb:	0f a2                	cpuid
+		return 0;
+  8015bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8015c2:	f6 c6 08             	test   $0x8,%dh
+  8015c5:	74 15                	je     8015dc <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015c7:	89 c2                	mov    %eax,%edx
+  8015c9:	c1 ea 08             	shr    $0x8,%edx
+  8015cc:	83 e2 0f             	and    $0xf,%edx
+  8015cf:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8015d4:	83 fa 06             	cmp    $0x6,%edx
+  8015d7:	74 0e                	je     8015e7 <sys_yield+0x6e>
+  8015d9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8015dc:	0f b6 c9             	movzbl %cl,%ecx
+  8015df:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8015e5:	eb a1                	jmp    801588 <sys_yield+0xf>
+  8015e7:	89 c2                	mov    %eax,%edx
+  8015e9:	c1 ea 04             	shr    $0x4,%edx
+  8015ec:	83 e2 0f             	and    $0xf,%edx
+  8015ef:	83 fa 02             	cmp    $0x2,%edx
+  8015f2:	77 e5                	ja     8015d9 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  8015f4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015f7:	83 f8 02             	cmp    $0x2,%eax
+  8015fa:	0f 97 c1             	seta   %cl
+  8015fd:	0f b6 c9             	movzbl %cl,%ecx
+  801600:	eb d7                	jmp    8015d9 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  801602:	ba 00 00 00 00       	mov    $0x0,%edx
+  801607:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80160c:	89 d1                	mov    %edx,%ecx
+  80160e:	89 d3                	mov    %edx,%ebx
+  801610:	89 d7                	mov    %edx,%edi
+  801612:	89 d6                	mov    %edx,%esi
+  801614:	cd 30                	int    $0x30
+}
+  801616:	eb 99                	jmp    8015b1 <sys_yield+0x38>
+
+00801618 <sys_env_set_status>:
+{
+  801618:	55                   	push   %ebp
+  801619:	89 e5                	mov    %esp,%ebp
+  80161b:	57                   	push   %edi
+  80161c:	56                   	push   %esi
+  80161d:	53                   	push   %ebx
+  80161e:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801621:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801628:	78 37                	js     801661 <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  80162a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801631:	74 7a                	je     8016ad <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  801633:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801638:	8b 55 08             	mov    0x8(%ebp),%edx
+  80163b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80163e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801643:	89 df                	mov    %ebx,%edi
+  801645:	89 de                	mov    %ebx,%esi
+  801647:	55                   	push   %ebp
+  801648:	68 51 16 80 00       	push   $0x801651
+  80164d:	89 e5                	mov    %esp,%ebp
+  80164f:	0f 34                	sysenter
+  801651:	83 c4 04             	add    $0x4,%esp
+  801654:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801655:	85 c0                	test   %eax,%eax
+  801657:	7f 6c                	jg     8016c5 <sys_env_set_status+0xad>
+}
+  801659:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80165c:	5b                   	pop    %ebx
+  80165d:	5e                   	pop    %esi
+  80165e:	5f                   	pop    %edi
+  80165f:	5d                   	pop    %ebp
+  801660:	c3                   	ret
+  801661:	b8 01 00 00 00       	mov    $0x1,%eax
+  801666:	0f a2                	cpuid
+		return 0;
+  801668:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80166d:	f6 c6 08             	test   $0x8,%dh
+  801670:	74 15                	je     801687 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801672:	89 c2                	mov    %eax,%edx
+  801674:	c1 ea 08             	shr    $0x8,%edx
+  801677:	83 e2 0f             	and    $0xf,%edx
+  80167a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80167f:	83 fa 06             	cmp    $0x6,%edx
+  801682:	74 0e                	je     801692 <sys_env_set_status+0x7a>
+  801684:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801687:	0f b6 c9             	movzbl %cl,%ecx
+  80168a:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801690:	eb 98                	jmp    80162a <sys_env_set_status+0x12>
+  801692:	89 c2                	mov    %eax,%edx
+  801694:	c1 ea 04             	shr    $0x4,%edx
+  801697:	83 e2 0f             	and    $0xf,%edx
+  80169a:	83 fa 02             	cmp    $0x2,%edx
+  80169d:	77 e5                	ja     801684 <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  80169f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016a2:	83 f8 02             	cmp    $0x2,%eax
+  8016a5:	0f 97 c1             	seta   %cl
+  8016a8:	0f b6 c9             	movzbl %cl,%ecx
+  8016ab:	eb d7                	jmp    801684 <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  8016ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016b2:	b8 08 00 00 00       	mov    $0x8,%eax
+  8016b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016bd:	89 df                	mov    %ebx,%edi
+  8016bf:	89 de                	mov    %ebx,%esi
+  8016c1:	cd 30                	int    $0x30
+  8016c3:	eb 90                	jmp    801655 <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016c5:	83 ec 0c             	sub    $0xc,%esp
+  8016c8:	50                   	push   %eax
+  8016c9:	6a 08                	push   $0x8
+  8016cb:	68 f9 31 80 00       	push   $0x8031f9
+  8016d0:	6a 4a                	push   $0x4a
+  8016d2:	68 16 32 80 00       	push   $0x803216
+  8016d7:	e8 54 ec ff ff       	call   800330 <_panic>
+
+008016dc <sys_sysinfo>:
+{
+  8016dc:	55                   	push   %ebp
+  8016dd:	89 e5                	mov    %esp,%ebp
+  8016df:	57                   	push   %edi
+  8016e0:	56                   	push   %esi
+  8016e1:	53                   	push   %ebx
+  8016e2:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8016e5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8016ec:	78 36                	js     801724 <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  8016ee:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8016f5:	74 79                	je     801770 <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  8016f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016ff:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801704:	89 cb                	mov    %ecx,%ebx
+  801706:	89 cf                	mov    %ecx,%edi
+  801708:	89 ce                	mov    %ecx,%esi
+  80170a:	55                   	push   %ebp
+  80170b:	68 14 17 80 00       	push   $0x801714
+  801710:	89 e5                	mov    %esp,%ebp
+  801712:	0f 34                	sysenter
+  801714:	83 c4 04             	add    $0x4,%esp
+  801717:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801718:	85 c0                	test   %eax,%eax
+  80171a:	7f 6b                	jg     801787 <sys_sysinfo+0xab>
+}
+  80171c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80171f:	5b                   	pop    %ebx
+  801720:	5e                   	pop    %esi
+  801721:	5f                   	pop    %edi
+  801722:	5d                   	pop    %ebp
+  801723:	c3                   	ret
+  801724:	b8 01 00 00 00       	mov    $0x1,%eax
+  801729:	0f a2                	cpuid
+		return 0;
+  80172b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801730:	f6 c6 08             	test   $0x8,%dh
+  801733:	74 15                	je     80174a <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801735:	89 c2                	mov    %eax,%edx
+  801737:	c1 ea 08             	shr    $0x8,%edx
+  80173a:	83 e2 0f             	and    $0xf,%edx
+  80173d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801742:	83 fa 06             	cmp    $0x6,%edx
+  801745:	74 0e                	je     801755 <sys_sysinfo+0x79>
+  801747:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80174a:	0f b6 c9             	movzbl %cl,%ecx
+  80174d:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801753:	eb 99                	jmp    8016ee <sys_sysinfo+0x12>
+  801755:	89 c2                	mov    %eax,%edx
+  801757:	c1 ea 04             	shr    $0x4,%edx
+  80175a:	83 e2 0f             	and    $0xf,%edx
+  80175d:	83 fa 02             	cmp    $0x2,%edx
+  801760:	77 e5                	ja     801747 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  801762:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801765:	83 f8 02             	cmp    $0x2,%eax
+  801768:	0f 97 c1             	seta   %cl
+  80176b:	0f b6 c9             	movzbl %cl,%ecx
+  80176e:	eb d7                	jmp    801747 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  801770:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801775:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80177a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80177d:	89 cb                	mov    %ecx,%ebx
+  80177f:	89 cf                	mov    %ecx,%edi
+  801781:	89 ce                	mov    %ecx,%esi
+  801783:	cd 30                	int    $0x30
+  801785:	eb 91                	jmp    801718 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801787:	83 ec 0c             	sub    $0xc,%esp
+  80178a:	50                   	push   %eax
+  80178b:	6a 0b                	push   $0xb
+  80178d:	68 f9 31 80 00       	push   $0x8031f9
+  801792:	6a 4a                	push   $0x4a
+  801794:	68 16 32 80 00       	push   $0x803216
+  801799:	e8 92 eb ff ff       	call   800330 <_panic>
+
+0080179e <sys_env_set_trapframe>:
+{
+  80179e:	55                   	push   %ebp
+  80179f:	89 e5                	mov    %esp,%ebp
+  8017a1:	57                   	push   %edi
+  8017a2:	56                   	push   %esi
+  8017a3:	53                   	push   %ebx
+  8017a4:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8017a7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8017ae:	78 37                	js     8017e7 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  8017b0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8017b7:	74 7a                	je     801833 <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  8017b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017c4:	b8 13 00 00 00       	mov    $0x13,%eax
+  8017c9:	89 df                	mov    %ebx,%edi
+  8017cb:	89 de                	mov    %ebx,%esi
+  8017cd:	55                   	push   %ebp
+  8017ce:	68 d7 17 80 00       	push   $0x8017d7
+  8017d3:	89 e5                	mov    %esp,%ebp
+  8017d5:	0f 34                	sysenter
+  8017d7:	83 c4 04             	add    $0x4,%esp
+  8017da:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8017db:	85 c0                	test   %eax,%eax
+  8017dd:	7f 6c                	jg     80184b <sys_env_set_trapframe+0xad>
+}
+  8017df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017e2:	5b                   	pop    %ebx
+  8017e3:	5e                   	pop    %esi
+  8017e4:	5f                   	pop    %edi
+  8017e5:	5d                   	pop    %ebp
+  8017e6:	c3                   	ret
+  8017e7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8017ec:	0f a2                	cpuid
+		return 0;
+  8017ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8017f3:	f6 c6 08             	test   $0x8,%dh
+  8017f6:	74 15                	je     80180d <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017f8:	89 c2                	mov    %eax,%edx
+  8017fa:	c1 ea 08             	shr    $0x8,%edx
+  8017fd:	83 e2 0f             	and    $0xf,%edx
+  801800:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801805:	83 fa 06             	cmp    $0x6,%edx
+  801808:	74 0e                	je     801818 <sys_env_set_trapframe+0x7a>
+  80180a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80180d:	0f b6 c9             	movzbl %cl,%ecx
+  801810:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801816:	eb 98                	jmp    8017b0 <sys_env_set_trapframe+0x12>
+  801818:	89 c2                	mov    %eax,%edx
+  80181a:	c1 ea 04             	shr    $0x4,%edx
+  80181d:	83 e2 0f             	and    $0xf,%edx
+  801820:	83 fa 02             	cmp    $0x2,%edx
+  801823:	77 e5                	ja     80180a <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  801825:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801828:	83 f8 02             	cmp    $0x2,%eax
+  80182b:	0f 97 c1             	seta   %cl
+  80182e:	0f b6 c9             	movzbl %cl,%ecx
+  801831:	eb d7                	jmp    80180a <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  801833:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801838:	b8 13 00 00 00       	mov    $0x13,%eax
+  80183d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801840:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801843:	89 df                	mov    %ebx,%edi
+  801845:	89 de                	mov    %ebx,%esi
+  801847:	cd 30                	int    $0x30
+  801849:	eb 90                	jmp    8017db <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80184b:	83 ec 0c             	sub    $0xc,%esp
+  80184e:	50                   	push   %eax
+  80184f:	6a 13                	push   $0x13
+  801851:	68 f9 31 80 00       	push   $0x8031f9
+  801856:	6a 4a                	push   $0x4a
+  801858:	68 16 32 80 00       	push   $0x803216
+  80185d:	e8 ce ea ff ff       	call   800330 <_panic>
+
+00801862 <sys_env_set_stack_limit>:
+{
+  801862:	55                   	push   %ebp
+  801863:	89 e5                	mov    %esp,%ebp
+  801865:	57                   	push   %edi
+  801866:	56                   	push   %esi
+  801867:	53                   	push   %ebx
+  801868:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80186b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801872:	78 37                	js     8018ab <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  801874:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80187b:	74 7a                	je     8018f7 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  80187d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801882:	8b 55 08             	mov    0x8(%ebp),%edx
+  801885:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801888:	b8 19 00 00 00       	mov    $0x19,%eax
+  80188d:	89 df                	mov    %ebx,%edi
+  80188f:	89 de                	mov    %ebx,%esi
+  801891:	55                   	push   %ebp
+  801892:	68 9b 18 80 00       	push   $0x80189b
+  801897:	89 e5                	mov    %esp,%ebp
+  801899:	0f 34                	sysenter
+  80189b:	83 c4 04             	add    $0x4,%esp
+  80189e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80189f:	85 c0                	test   %eax,%eax
+  8018a1:	7f 6c                	jg     80190f <sys_env_set_stack_limit+0xad>
+}
+  8018a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018a6:	5b                   	pop    %ebx
+  8018a7:	5e                   	pop    %esi
+  8018a8:	5f                   	pop    %edi
+  8018a9:	5d                   	pop    %ebp
+  8018aa:	c3                   	ret
+  8018ab:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018b0:	0f a2                	cpuid
+		return 0;
+  8018b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018b7:	f6 c6 08             	test   $0x8,%dh
+  8018ba:	74 15                	je     8018d1 <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018bc:	89 c2                	mov    %eax,%edx
+  8018be:	c1 ea 08             	shr    $0x8,%edx
+  8018c1:	83 e2 0f             	and    $0xf,%edx
+  8018c4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018c9:	83 fa 06             	cmp    $0x6,%edx
+  8018cc:	74 0e                	je     8018dc <sys_env_set_stack_limit+0x7a>
+  8018ce:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8018d1:	0f b6 c9             	movzbl %cl,%ecx
+  8018d4:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8018da:	eb 98                	jmp    801874 <sys_env_set_stack_limit+0x12>
+  8018dc:	89 c2                	mov    %eax,%edx
+  8018de:	c1 ea 04             	shr    $0x4,%edx
+  8018e1:	83 e2 0f             	and    $0xf,%edx
+  8018e4:	83 fa 02             	cmp    $0x2,%edx
+  8018e7:	77 e5                	ja     8018ce <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  8018e9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018ec:	83 f8 02             	cmp    $0x2,%eax
+  8018ef:	0f 97 c1             	seta   %cl
+  8018f2:	0f b6 c9             	movzbl %cl,%ecx
+  8018f5:	eb d7                	jmp    8018ce <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  8018f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018fc:	b8 19 00 00 00       	mov    $0x19,%eax
+  801901:	8b 55 08             	mov    0x8(%ebp),%edx
+  801904:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801907:	89 df                	mov    %ebx,%edi
+  801909:	89 de                	mov    %ebx,%esi
+  80190b:	cd 30                	int    $0x30
+  80190d:	eb 90                	jmp    80189f <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80190f:	83 ec 0c             	sub    $0xc,%esp
+  801912:	50                   	push   %eax
+  801913:	6a 19                	push   $0x19
+  801915:	68 f9 31 80 00       	push   $0x8031f9
+  80191a:	6a 4a                	push   $0x4a
+  80191c:	68 16 32 80 00       	push   $0x803216
+  801921:	e8 0a ea ff ff       	call   800330 <_panic>
+
+00801926 <sys_env_set_pgfault_upcall>:
+{
+  801926:	55                   	push   %ebp
+  801927:	89 e5                	mov    %esp,%ebp
+  801929:	57                   	push   %edi
+  80192a:	56                   	push   %esi
+  80192b:	53                   	push   %ebx
+  80192c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80192f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801936:	78 37                	js     80196f <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  801938:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80193f:	74 7a                	je     8019bb <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  801941:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801946:	8b 55 08             	mov    0x8(%ebp),%edx
+  801949:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80194c:	b8 09 00 00 00       	mov    $0x9,%eax
+  801951:	89 df                	mov    %ebx,%edi
+  801953:	89 de                	mov    %ebx,%esi
+  801955:	55                   	push   %ebp
+  801956:	68 5f 19 80 00       	push   $0x80195f
+  80195b:	89 e5                	mov    %esp,%ebp
+  80195d:	0f 34                	sysenter
+  80195f:	83 c4 04             	add    $0x4,%esp
+  801962:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801963:	85 c0                	test   %eax,%eax
+  801965:	7f 6c                	jg     8019d3 <sys_env_set_pgfault_upcall+0xad>
+}
+  801967:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80196a:	5b                   	pop    %ebx
+  80196b:	5e                   	pop    %esi
+  80196c:	5f                   	pop    %edi
+  80196d:	5d                   	pop    %ebp
+  80196e:	c3                   	ret
+  80196f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801974:	0f a2                	cpuid
+		return 0;
+  801976:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80197b:	f6 c6 08             	test   $0x8,%dh
+  80197e:	74 15                	je     801995 <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801980:	89 c2                	mov    %eax,%edx
+  801982:	c1 ea 08             	shr    $0x8,%edx
+  801985:	83 e2 0f             	and    $0xf,%edx
+  801988:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80198d:	83 fa 06             	cmp    $0x6,%edx
+  801990:	74 0e                	je     8019a0 <sys_env_set_pgfault_upcall+0x7a>
+  801992:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801995:	0f b6 c9             	movzbl %cl,%ecx
+  801998:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80199e:	eb 98                	jmp    801938 <sys_env_set_pgfault_upcall+0x12>
+  8019a0:	89 c2                	mov    %eax,%edx
+  8019a2:	c1 ea 04             	shr    $0x4,%edx
+  8019a5:	83 e2 0f             	and    $0xf,%edx
+  8019a8:	83 fa 02             	cmp    $0x2,%edx
+  8019ab:	77 e5                	ja     801992 <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  8019ad:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019b0:	83 f8 02             	cmp    $0x2,%eax
+  8019b3:	0f 97 c1             	seta   %cl
+  8019b6:	0f b6 c9             	movzbl %cl,%ecx
+  8019b9:	eb d7                	jmp    801992 <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  8019bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019c0:	b8 09 00 00 00       	mov    $0x9,%eax
+  8019c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019cb:	89 df                	mov    %ebx,%edi
+  8019cd:	89 de                	mov    %ebx,%esi
+  8019cf:	cd 30                	int    $0x30
+  8019d1:	eb 90                	jmp    801963 <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8019d3:	83 ec 0c             	sub    $0xc,%esp
+  8019d6:	50                   	push   %eax
+  8019d7:	6a 09                	push   $0x9
+  8019d9:	68 f9 31 80 00       	push   $0x8031f9
+  8019de:	6a 4a                	push   $0x4a
+  8019e0:	68 16 32 80 00       	push   $0x803216
+  8019e5:	e8 46 e9 ff ff       	call   800330 <_panic>
+
+008019ea <sys_ipc_try_send>:
+{
+  8019ea:	55                   	push   %ebp
+  8019eb:	89 e5                	mov    %esp,%ebp
+  8019ed:	57                   	push   %edi
+  8019ee:	56                   	push   %esi
+  8019ef:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8019f0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8019f7:	78 32                	js     801a2b <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  8019f9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a00:	74 75                	je     801a77 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801a02:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a05:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a08:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801a0d:	be 00 00 00 00       	mov    $0x0,%esi
+  801a12:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a15:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a18:	55                   	push   %ebp
+  801a19:	68 22 1a 80 00       	push   $0x801a22
+  801a1e:	89 e5                	mov    %esp,%ebp
+  801a20:	0f 34                	sysenter
+  801a22:	83 c4 04             	add    $0x4,%esp
+  801a25:	5d                   	pop    %ebp
+}
+  801a26:	5b                   	pop    %ebx
+  801a27:	5e                   	pop    %esi
+  801a28:	5f                   	pop    %edi
+  801a29:	5d                   	pop    %ebp
+  801a2a:	c3                   	ret
+  801a2b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a30:	0f a2                	cpuid
+		return 0;
+  801a32:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801a37:	f6 c6 08             	test   $0x8,%dh
+  801a3a:	74 15                	je     801a51 <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a3c:	89 c2                	mov    %eax,%edx
+  801a3e:	c1 ea 08             	shr    $0x8,%edx
+  801a41:	83 e2 0f             	and    $0xf,%edx
+  801a44:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a49:	83 fa 06             	cmp    $0x6,%edx
+  801a4c:	74 0e                	je     801a5c <sys_ipc_try_send+0x72>
+  801a4e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a51:	0f b6 c9             	movzbl %cl,%ecx
+  801a54:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801a5a:	eb 9d                	jmp    8019f9 <sys_ipc_try_send+0xf>
+  801a5c:	89 c2                	mov    %eax,%edx
+  801a5e:	c1 ea 04             	shr    $0x4,%edx
+  801a61:	83 e2 0f             	and    $0xf,%edx
+  801a64:	83 fa 02             	cmp    $0x2,%edx
+  801a67:	77 e5                	ja     801a4e <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  801a69:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a6c:	83 f8 02             	cmp    $0x2,%eax
+  801a6f:	0f 97 c1             	seta   %cl
+  801a72:	0f b6 c9             	movzbl %cl,%ecx
+  801a75:	eb d7                	jmp    801a4e <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  801a77:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801a7c:	be 00 00 00 00       	mov    $0x0,%esi
+  801a81:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a84:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a87:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a8a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a8d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801a8f:	eb 95                	jmp    801a26 <sys_ipc_try_send+0x3c>
+
+00801a91 <sys_ipc_send>:
+{
+  801a91:	55                   	push   %ebp
+  801a92:	89 e5                	mov    %esp,%ebp
+  801a94:	57                   	push   %edi
+  801a95:	56                   	push   %esi
+  801a96:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801a97:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a9e:	78 32                	js     801ad2 <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  801aa0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801aa7:	74 75                	je     801b1e <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801aa9:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801aaf:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801ab4:	be 00 00 00 00       	mov    $0x0,%esi
+  801ab9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801abc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801abf:	55                   	push   %ebp
+  801ac0:	68 c9 1a 80 00       	push   $0x801ac9
+  801ac5:	89 e5                	mov    %esp,%ebp
+  801ac7:	0f 34                	sysenter
+  801ac9:	83 c4 04             	add    $0x4,%esp
+  801acc:	5d                   	pop    %ebp
+}
+  801acd:	5b                   	pop    %ebx
+  801ace:	5e                   	pop    %esi
+  801acf:	5f                   	pop    %edi
+  801ad0:	5d                   	pop    %ebp
+  801ad1:	c3                   	ret
+  801ad2:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ad7:	0f a2                	cpuid
+		return 0;
+  801ad9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801ade:	f6 c6 08             	test   $0x8,%dh
+  801ae1:	74 15                	je     801af8 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ae3:	89 c2                	mov    %eax,%edx
+  801ae5:	c1 ea 08             	shr    $0x8,%edx
+  801ae8:	83 e2 0f             	and    $0xf,%edx
+  801aeb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801af0:	83 fa 06             	cmp    $0x6,%edx
+  801af3:	74 0e                	je     801b03 <sys_ipc_send+0x72>
+  801af5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801af8:	0f b6 c9             	movzbl %cl,%ecx
+  801afb:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801b01:	eb 9d                	jmp    801aa0 <sys_ipc_send+0xf>
+  801b03:	89 c2                	mov    %eax,%edx
+  801b05:	c1 ea 04             	shr    $0x4,%edx
+  801b08:	83 e2 0f             	and    $0xf,%edx
+  801b0b:	83 fa 02             	cmp    $0x2,%edx
+  801b0e:	77 e5                	ja     801af5 <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  801b10:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b13:	83 f8 02             	cmp    $0x2,%eax
+  801b16:	0f 97 c1             	seta   %cl
+  801b19:	0f b6 c9             	movzbl %cl,%ecx
+  801b1c:	eb d7                	jmp    801af5 <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  801b1e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801b23:	be 00 00 00 00       	mov    $0x0,%esi
+  801b28:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b2b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b2e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b31:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801b34:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801b36:	eb 95                	jmp    801acd <sys_ipc_send+0x3c>
+
+00801b38 <sys_ipc_recv>:
+{
+  801b38:	55                   	push   %ebp
+  801b39:	89 e5                	mov    %esp,%ebp
+  801b3b:	57                   	push   %edi
+  801b3c:	56                   	push   %esi
+  801b3d:	53                   	push   %ebx
+  801b3e:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801b41:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b48:	78 36                	js     801b80 <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  801b4a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b51:	74 79                	je     801bcc <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  801b53:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b56:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b5b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801b60:	89 cb                	mov    %ecx,%ebx
+  801b62:	89 cf                	mov    %ecx,%edi
+  801b64:	89 ce                	mov    %ecx,%esi
+  801b66:	55                   	push   %ebp
+  801b67:	68 70 1b 80 00       	push   $0x801b70
+  801b6c:	89 e5                	mov    %esp,%ebp
+  801b6e:	0f 34                	sysenter
+  801b70:	83 c4 04             	add    $0x4,%esp
+  801b73:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801b74:	85 c0                	test   %eax,%eax
+  801b76:	7f 6b                	jg     801be3 <sys_ipc_recv+0xab>
+}
+  801b78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b7b:	5b                   	pop    %ebx
+  801b7c:	5e                   	pop    %esi
+  801b7d:	5f                   	pop    %edi
+  801b7e:	5d                   	pop    %ebp
+  801b7f:	c3                   	ret
+  801b80:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b85:	0f a2                	cpuid
+		return 0;
+  801b87:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b8c:	f6 c6 08             	test   $0x8,%dh
+  801b8f:	74 15                	je     801ba6 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b91:	89 c2                	mov    %eax,%edx
+  801b93:	c1 ea 08             	shr    $0x8,%edx
+  801b96:	83 e2 0f             	and    $0xf,%edx
+  801b99:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b9e:	83 fa 06             	cmp    $0x6,%edx
+  801ba1:	74 0e                	je     801bb1 <sys_ipc_recv+0x79>
+  801ba3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801ba6:	0f b6 c9             	movzbl %cl,%ecx
+  801ba9:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801baf:	eb 99                	jmp    801b4a <sys_ipc_recv+0x12>
+  801bb1:	89 c2                	mov    %eax,%edx
+  801bb3:	c1 ea 04             	shr    $0x4,%edx
+  801bb6:	83 e2 0f             	and    $0xf,%edx
+  801bb9:	83 fa 02             	cmp    $0x2,%edx
+  801bbc:	77 e5                	ja     801ba3 <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  801bbe:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bc1:	83 f8 02             	cmp    $0x2,%eax
+  801bc4:	0f 97 c1             	seta   %cl
+  801bc7:	0f b6 c9             	movzbl %cl,%ecx
+  801bca:	eb d7                	jmp    801ba3 <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  801bcc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bd1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801bd6:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bd9:	89 cb                	mov    %ecx,%ebx
+  801bdb:	89 cf                	mov    %ecx,%edi
+  801bdd:	89 ce                	mov    %ecx,%esi
+  801bdf:	cd 30                	int    $0x30
+  801be1:	eb 91                	jmp    801b74 <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801be3:	83 ec 0c             	sub    $0xc,%esp
+  801be6:	50                   	push   %eax
+  801be7:	6a 0d                	push   $0xd
+  801be9:	68 f9 31 80 00       	push   $0x8031f9
+  801bee:	6a 4a                	push   $0x4a
+  801bf0:	68 16 32 80 00       	push   $0x803216
+  801bf5:	e8 36 e7 ff ff       	call   800330 <_panic>
+
+00801bfa <sys_ipc_send_range>:
+{
+  801bfa:	55                   	push   %ebp
+  801bfb:	89 e5                	mov    %esp,%ebp
+  801bfd:	57                   	push   %edi
+  801bfe:	56                   	push   %esi
+  801bff:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801c00:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801c07:	78 30                	js     801c39 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  801c09:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801c10:	74 73                	je     801c85 <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801c12:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c15:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c18:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801c1d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801c20:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801c23:	8b 75 18             	mov    0x18(%ebp),%esi
+  801c26:	55                   	push   %ebp
+  801c27:	68 30 1c 80 00       	push   $0x801c30
+  801c2c:	89 e5                	mov    %esp,%ebp
+  801c2e:	0f 34                	sysenter
+  801c30:	83 c4 04             	add    $0x4,%esp
+  801c33:	5d                   	pop    %ebp
+}
+  801c34:	5b                   	pop    %ebx
+  801c35:	5e                   	pop    %esi
+  801c36:	5f                   	pop    %edi
+  801c37:	5d                   	pop    %ebp
+  801c38:	c3                   	ret
+  801c39:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c3e:	0f a2                	cpuid
+		return 0;
+  801c40:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801c45:	f6 c6 08             	test   $0x8,%dh
+  801c48:	74 15                	je     801c5f <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c4a:	89 c2                	mov    %eax,%edx
+  801c4c:	c1 ea 08             	shr    $0x8,%edx
+  801c4f:	83 e2 0f             	and    $0xf,%edx
+  801c52:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801c57:	83 fa 06             	cmp    $0x6,%edx
+  801c5a:	74 0e                	je     801c6a <sys_ipc_send_range+0x70>
+  801c5c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801c5f:	0f b6 c9             	movzbl %cl,%ecx
+  801c62:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801c68:	eb 9f                	jmp    801c09 <sys_ipc_send_range+0xf>
+  801c6a:	89 c2                	mov    %eax,%edx
+  801c6c:	c1 ea 04             	shr    $0x4,%edx
+  801c6f:	83 e2 0f             	and    $0xf,%edx
+  801c72:	83 fa 02             	cmp    $0x2,%edx
+  801c75:	77 e5                	ja     801c5c <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  801c77:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c7a:	83 f8 02             	cmp    $0x2,%eax
+  801c7d:	0f 97 c1             	seta   %cl
+  801c80:	0f b6 c9             	movzbl %cl,%ecx
+  801c83:	eb d7                	jmp    801c5c <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  801c85:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801c8a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c8d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c90:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801c93:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801c96:	8b 75 18             	mov    0x18(%ebp),%esi
+  801c99:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  801c9b:	eb 97                	jmp    801c34 <sys_ipc_send_range+0x3a>
+
+00801c9d <sys_ipc_recv_range>:
+{
+  801c9d:	55                   	push   %ebp
+  801c9e:	89 e5                	mov    %esp,%ebp
+  801ca0:	57                   	push   %edi
+  801ca1:	56                   	push   %esi
+  801ca2:	53                   	push   %ebx
+  801ca3:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801ca6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801cad:	78 37                	js     801ce6 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  801caf:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801cb6:	74 7a                	je     801d32 <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  801cb8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cbd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cc0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cc3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801cc8:	89 df                	mov    %ebx,%edi
+  801cca:	89 de                	mov    %ebx,%esi
+  801ccc:	55                   	push   %ebp
+  801ccd:	68 d6 1c 80 00       	push   $0x801cd6
+  801cd2:	89 e5                	mov    %esp,%ebp
+  801cd4:	0f 34                	sysenter
+  801cd6:	83 c4 04             	add    $0x4,%esp
+  801cd9:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801cda:	85 c0                	test   %eax,%eax
+  801cdc:	7f 6c                	jg     801d4a <sys_ipc_recv_range+0xad>
+}
+  801cde:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ce1:	5b                   	pop    %ebx
+  801ce2:	5e                   	pop    %esi
+  801ce3:	5f                   	pop    %edi
+  801ce4:	5d                   	pop    %ebp
+  801ce5:	c3                   	ret
+  801ce6:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ceb:	0f a2                	cpuid
+		return 0;
+  801ced:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801cf2:	f6 c6 08             	test   $0x8,%dh
+  801cf5:	74 15                	je     801d0c <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801cf7:	89 c2                	mov    %eax,%edx
+  801cf9:	c1 ea 08             	shr    $0x8,%edx
+  801cfc:	83 e2 0f             	and    $0xf,%edx
+  801cff:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d04:	83 fa 06             	cmp    $0x6,%edx
+  801d07:	74 0e                	je     801d17 <sys_ipc_recv_range+0x7a>
+  801d09:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801d0c:	0f b6 c9             	movzbl %cl,%ecx
+  801d0f:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801d15:	eb 98                	jmp    801caf <sys_ipc_recv_range+0x12>
+  801d17:	89 c2                	mov    %eax,%edx
+  801d19:	c1 ea 04             	shr    $0x4,%edx
+  801d1c:	83 e2 0f             	and    $0xf,%edx
+  801d1f:	83 fa 02             	cmp    $0x2,%edx
+  801d22:	77 e5                	ja     801d09 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801d24:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d27:	83 f8 02             	cmp    $0x2,%eax
+  801d2a:	0f 97 c1             	seta   %cl
+  801d2d:	0f b6 c9             	movzbl %cl,%ecx
+  801d30:	eb d7                	jmp    801d09 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801d32:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d37:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801d3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d3f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d42:	89 df                	mov    %ebx,%edi
+  801d44:	89 de                	mov    %ebx,%esi
+  801d46:	cd 30                	int    $0x30
+  801d48:	eb 90                	jmp    801cda <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801d4a:	83 ec 0c             	sub    $0xc,%esp
+  801d4d:	50                   	push   %eax
+  801d4e:	6a 1f                	push   $0x1f
+  801d50:	68 f9 31 80 00       	push   $0x8031f9
+  801d55:	6a 4a                	push   $0x4a
+  801d57:	68 16 32 80 00       	push   $0x803216
+  801d5c:	e8 cf e5 ff ff       	call   800330 <_panic>
+
+00801d61 <sys_ipc_call>:
+{
+  801d61:	55                   	push   %ebp
+  801d62:	89 e5                	mov    %esp,%ebp
+  801d64:	57                   	push   %edi
+  801d65:	56                   	push   %esi
+  801d66:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801d67:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d6a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801d6f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801d72:	55                   	push   %ebp
+  801d73:	56                   	push   %esi
+  801d74:	8b 0e                	mov    (%esi),%ecx
+  801d76:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801d79:	8b 7e 08             	mov    0x8(%esi),%edi
+  801d7c:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801d7f:	8b 76 0c             	mov    0xc(%esi),%esi
+  801d82:	cd 30                	int    $0x30
+  801d84:	87 34 24             	xchg   %esi,(%esp)
+  801d87:	89 0e                	mov    %ecx,(%esi)
+  801d89:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801d8c:	89 7e 08             	mov    %edi,0x8(%esi)
+  801d8f:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801d92:	8f 46 0c             	pop    0xc(%esi)
+  801d95:	5d                   	pop    %ebp
+}
+  801d96:	5b                   	pop    %ebx
+  801d97:	5e                   	pop    %esi
+  801d98:	5f                   	pop    %edi
+  801d99:	5d                   	pop    %ebp
+  801d9a:	c3                   	ret
+
+00801d9b <sys_ipc_reply_wait>:
+{
+  801d9b:	55                   	push   %ebp
+  801d9c:	89 e5                	mov    %esp,%ebp
+  801d9e:	57                   	push   %edi
+  801d9f:	56                   	push   %esi
+  801da0:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801da1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801da4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801da9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801dac:	55                   	push   %ebp
+  801dad:	56                   	push   %esi
+  801dae:	8b 0e                	mov    (%esi),%ecx
+  801db0:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801db3:	8b 7e 08             	mov    0x8(%esi),%edi
+  801db6:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801db9:	8b 76 0c             	mov    0xc(%esi),%esi
+  801dbc:	cd 30                	int    $0x30
+  801dbe:	87 34 24             	xchg   %esi,(%esp)
+  801dc1:	89 0e                	mov    %ecx,(%esi)
+  801dc3:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801dc6:	89 7e 08             	mov    %edi,0x8(%esi)
+  801dc9:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801dcc:	8f 46 0c             	pop    0xc(%esi)
+  801dcf:	5d                   	pop    %ebp
+}
+  801dd0:	5b                   	pop    %ebx
+  801dd1:	5e                   	pop    %esi
+  801dd2:	5f                   	pop    %edi
+  801dd3:	5d                   	pop    %ebp
+  801dd4:	c3                   	ret
+
+00801dd5 <sys_ipc_send_msg>:
+{
+  801dd5:	55                   	push   %ebp
+  801dd6:	89 e5                	mov    %esp,%ebp
+  801dd8:	57                   	push   %edi
+  801dd9:	56                   	push   %esi
+  801dda:	53                   	push   %ebx
+  801ddb:	83 ec 20             	sub    $0x20,%esp
+  801dde:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801de1:	8b 10                	mov    (%eax),%edx
+  801de3:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801de6:	8b 50 04             	mov    0x4(%eax),%edx
+  801de9:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801dec:	8b 50 08             	mov    0x8(%eax),%edx
+  801def:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801df2:	8b 50 0c             	mov    0xc(%eax),%edx
+  801df5:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801df8:	8b 40 10             	mov    0x10(%eax),%eax
+  801dfb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801dfe:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801e01:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e04:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801e09:	55                   	push   %ebp
+  801e0a:	56                   	push   %esi
+  801e0b:	8b 0e                	mov    (%esi),%ecx
+  801e0d:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801e10:	8b 7e 08             	mov    0x8(%esi),%edi
+  801e13:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801e16:	8b 76 0c             	mov    0xc(%esi),%esi
+  801e19:	cd 30                	int    $0x30
+  801e1b:	87 34 24             	xchg   %esi,(%esp)
+  801e1e:	89 0e                	mov    %ecx,(%esi)
+  801e20:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801e23:	89 7e 08             	mov    %edi,0x8(%esi)
+  801e26:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801e29:	8f 46 0c             	pop    0xc(%esi)
+  801e2c:	5d                   	pop    %ebp
+}
+  801e2d:	83 c4 20             	add    $0x20,%esp
+  801e30:	5b                   	pop    %ebx
+  801e31:	5e                   	pop    %esi
+  801e32:	5f                   	pop    %edi
+  801e33:	5d                   	pop    %ebp
+  801e34:	c3                   	ret
+
+00801e35 <sys_fork>:
+{
+  801e35:	55                   	push   %ebp
+  801e36:	89 e5                	mov    %esp,%ebp
+  801e38:	57                   	push   %edi
+  801e39:	56                   	push   %esi
+  801e3a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801e3b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e42:	78 2e                	js     801e72 <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801e44:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e4b:	74 71                	je     801ebe <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801e4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e52:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801e57:	89 d1                	mov    %edx,%ecx
+  801e59:	89 d3                	mov    %edx,%ebx
+  801e5b:	89 d7                	mov    %edx,%edi
+  801e5d:	89 d6                	mov    %edx,%esi
+  801e5f:	55                   	push   %ebp
+  801e60:	68 69 1e 80 00       	push   $0x801e69
+  801e65:	89 e5                	mov    %esp,%ebp
+  801e67:	0f 34                	sysenter
+  801e69:	83 c4 04             	add    $0x4,%esp
+  801e6c:	5d                   	pop    %ebp
+}
+  801e6d:	5b                   	pop    %ebx
+  801e6e:	5e                   	pop    %esi
+  801e6f:	5f                   	pop    %edi
+  801e70:	5d                   	pop    %ebp
+  801e71:	c3                   	ret
+  801e72:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e77:	0f a2                	cpuid
+		return 0;
+  801e79:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801e7e:	f6 c6 08             	test   $0x8,%dh
+  801e81:	74 15                	je     801e98 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e83:	89 c2                	mov    %eax,%edx
+  801e85:	c1 ea 08             	shr    $0x8,%edx
+  801e88:	83 e2 0f             	and    $0xf,%edx
+  801e8b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e90:	83 fa 06             	cmp    $0x6,%edx
+  801e93:	74 0e                	je     801ea3 <sys_fork+0x6e>
+  801e95:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801e98:	0f b6 c9             	movzbl %cl,%ecx
+  801e9b:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801ea1:	eb a1                	jmp    801e44 <sys_fork+0xf>
+  801ea3:	89 c2                	mov    %eax,%edx
+  801ea5:	c1 ea 04             	shr    $0x4,%edx
+  801ea8:	83 e2 0f             	and    $0xf,%edx
+  801eab:	83 fa 02             	cmp    $0x2,%edx
+  801eae:	77 e5                	ja     801e95 <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801eb0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801eb3:	83 f8 02             	cmp    $0x2,%eax
+  801eb6:	0f 97 c1             	seta   %cl
+  801eb9:	0f b6 c9             	movzbl %cl,%ecx
+  801ebc:	eb d7                	jmp    801e95 <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801ebe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ec3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801ec8:	89 d1                	mov    %edx,%ecx
+  801eca:	89 d3                	mov    %edx,%ebx
+  801ecc:	89 d7                	mov    %edx,%edi
+  801ece:	89 d6                	mov    %edx,%esi
+  801ed0:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801ed2:	eb 99                	jmp    801e6d <sys_fork+0x38>
+
+00801ed4 <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801ed4:	55                   	push   %ebp
+  801ed5:	89 e5                	mov    %esp,%ebp
+  801ed7:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801eda:	ff 75 14             	push   0x14(%ebp)
+  801edd:	ff 75 10             	push   0x10(%ebp)
+  801ee0:	ff 75 0c             	push   0xc(%ebp)
+  801ee3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ee8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801eeb:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801ef0:	e8 81 ee ff ff       	call   800d76 <page_vec_call>
+}
+  801ef5:	c9                   	leave
+  801ef6:	c3                   	ret
+
+00801ef7 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801ef7:	55                   	push   %ebp
+  801ef8:	89 e5                	mov    %esp,%ebp
+  801efa:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801efd:	ff 75 18             	push   0x18(%ebp)
+  801f00:	ff 75 14             	push   0x14(%ebp)
+  801f03:	ff 75 10             	push   0x10(%ebp)
+  801f06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f09:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f0c:	b8 10 00 00 00       	mov    $0x10,%eax
+  801f11:	e8 60 ee ff ff       	call   800d76 <page_vec_call>
+}
+  801f16:	c9                   	leave
+  801f17:	c3                   	ret
+
+00801f18 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801f18:	55                   	push   %ebp
+  801f19:	89 e5                	mov    %esp,%ebp
+  801f1b:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801f1e:	ff 75 14             	push   0x14(%ebp)
+  801f21:	ff 75 10             	push   0x10(%ebp)
+  801f24:	ff 75 0c             	push   0xc(%ebp)
+  801f27:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f2f:	b8 11 00 00 00       	mov    $0x11,%eax
+  801f34:	e8 3d ee ff ff       	call   800d76 <page_vec_call>
+}
+  801f39:	c9                   	leave
+  801f3a:	c3                   	ret
+
+00801f3b <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801f3b:	55                   	push   %ebp
+  801f3c:	89 e5                	mov    %esp,%ebp
+  801f3e:	57                   	push   %edi
+  801f3f:	56                   	push   %esi
+  801f40:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801f41:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f48:	78 32                	js     801f7c <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801f4a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f51:	74 75                	je     801fc8 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801f53:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f56:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f59:	b8 12 00 00 00       	mov    $0x12,%eax
+  801f5e:	be 00 00 00 00       	mov    $0x0,%esi
+  801f63:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f66:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801f69:	55                   	push   %ebp
+  801f6a:	68 73 1f 80 00       	push   $0x801f73
+  801f6f:	89 e5                	mov    %esp,%ebp
+  801f71:	0f 34                	sysenter
+  801f73:	83 c4 04             	add    $0x4,%esp
+  801f76:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801f77:	5b                   	pop    %ebx
+  801f78:	5e                   	pop    %esi
+  801f79:	5f                   	pop    %edi
+  801f7a:	5d                   	pop    %ebp
+  801f7b:	c3                   	ret
+  801f7c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f81:	0f a2                	cpuid
+		return 0;
+  801f83:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801f88:	f6 c6 08             	test   $0x8,%dh
+  801f8b:	74 15                	je     801fa2 <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f8d:	89 c2                	mov    %eax,%edx
+  801f8f:	c1 ea 08             	shr    $0x8,%edx
+  801f92:	83 e2 0f             	and    $0xf,%edx
+  801f95:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f9a:	83 fa 06             	cmp    $0x6,%edx
+  801f9d:	74 0e                	je     801fad <sys_vm_ranges+0x72>
+  801f9f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801fa2:	0f b6 c9             	movzbl %cl,%ecx
+  801fa5:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801fab:	eb 9d                	jmp    801f4a <sys_vm_ranges+0xf>
+  801fad:	89 c2                	mov    %eax,%edx
+  801faf:	c1 ea 04             	shr    $0x4,%edx
+  801fb2:	83 e2 0f             	and    $0xf,%edx
+  801fb5:	83 fa 02             	cmp    $0x2,%edx
+  801fb8:	77 e5                	ja     801f9f <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  801fba:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fbd:	83 f8 02             	cmp    $0x2,%eax
+  801fc0:	0f 97 c1             	seta   %cl
+  801fc3:	0f b6 c9             	movzbl %cl,%ecx
+  801fc6:	eb d7                	jmp    801f9f <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801fc8:	b8 12 00 00 00       	mov    $0x12,%eax
+  801fcd:	be 00 00 00 00       	mov    $0x0,%esi
+  801fd2:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fd5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fd8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801fdb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801fde:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801fe0:	eb 95                	jmp    801f77 <sys_vm_ranges+0x3c>
+
+00801fe2 <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801fe2:	55                   	push   %ebp
+  801fe3:	89 e5                	mov    %esp,%ebp
+  801fe5:	57                   	push   %edi
+  801fe6:	56                   	push   %esi
+  801fe7:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801fe8:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801fef:	78 31                	js     802022 <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801ff1:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ff8:	74 74                	je     80206e <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801ffa:	be 00 00 00 00       	mov    $0x0,%esi
+  801fff:	8b 55 08             	mov    0x8(%ebp),%edx
+  802002:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802005:	b8 14 00 00 00       	mov    $0x14,%eax
+  80200a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80200d:	89 f7                	mov    %esi,%edi
+  80200f:	55                   	push   %ebp
+  802010:	68 19 20 80 00       	push   $0x802019
+  802015:	89 e5                	mov    %esp,%ebp
+  802017:	0f 34                	sysenter
+  802019:	83 c4 04             	add    $0x4,%esp
+  80201c:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  80201d:	5b                   	pop    %ebx
+  80201e:	5e                   	pop    %esi
+  80201f:	5f                   	pop    %edi
+  802020:	5d                   	pop    %ebp
+  802021:	c3                   	ret
+  802022:	b8 01 00 00 00       	mov    $0x1,%eax
+  802027:	0f a2                	cpuid
+		return 0;
+  802029:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80202e:	f6 c6 08             	test   $0x8,%dh
+  802031:	74 15                	je     802048 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802033:	89 c2                	mov    %eax,%edx
+  802035:	c1 ea 08             	shr    $0x8,%edx
+  802038:	83 e2 0f             	and    $0xf,%edx
+  80203b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802040:	83 fa 06             	cmp    $0x6,%edx
+  802043:	74 0e                	je     802053 <sys_spawn+0x71>
+  802045:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802048:	0f b6 c9             	movzbl %cl,%ecx
+  80204b:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802051:	eb 9e                	jmp    801ff1 <sys_spawn+0xf>
+  802053:	89 c2                	mov    %eax,%edx
+  802055:	c1 ea 04             	shr    $0x4,%edx
+  802058:	83 e2 0f             	and    $0xf,%edx
+  80205b:	83 fa 02             	cmp    $0x2,%edx
+  80205e:	77 e5                	ja     802045 <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  802060:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802063:	83 f8 02             	cmp    $0x2,%eax
+  802066:	0f 97 c1             	seta   %cl
+  802069:	0f b6 c9             	movzbl %cl,%ecx
+  80206c:	eb d7                	jmp    802045 <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  80206e:	be 00 00 00 00       	mov    $0x0,%esi
+  802073:	b8 14 00 00 00       	mov    $0x14,%eax
+  802078:	8b 55 08             	mov    0x8(%ebp),%edx
+  80207b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80207e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802081:	89 f7                	mov    %esi,%edi
+  802083:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  802085:	eb 96                	jmp    80201d <sys_spawn+0x3b>
+
+00802087 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  802087:	55                   	push   %ebp
+  802088:	89 e5                	mov    %esp,%ebp
+  80208a:	57                   	push   %edi
+  80208b:	56                   	push   %esi
+  80208c:	53                   	push   %ebx
+  80208d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802090:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802097:	78 37                	js     8020d0 <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  802099:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8020a0:	74 7a                	je     80211c <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  8020a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020ad:	b8 15 00 00 00       	mov    $0x15,%eax
+  8020b2:	89 df                	mov    %ebx,%edi
+  8020b4:	89 de                	mov    %ebx,%esi
+  8020b6:	55                   	push   %ebp
+  8020b7:	68 c0 20 80 00       	push   $0x8020c0
+  8020bc:	89 e5                	mov    %esp,%ebp
+  8020be:	0f 34                	sysenter
+  8020c0:	83 c4 04             	add    $0x4,%esp
+  8020c3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8020c4:	85 c0                	test   %eax,%eax
+  8020c6:	7f 6c                	jg     802134 <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  8020c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020cb:	5b                   	pop    %ebx
+  8020cc:	5e                   	pop    %esi
+  8020cd:	5f                   	pop    %edi
+  8020ce:	5d                   	pop    %ebp
+  8020cf:	c3                   	ret
+  8020d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020d5:	0f a2                	cpuid
+		return 0;
+  8020d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8020dc:	f6 c6 08             	test   $0x8,%dh
+  8020df:	74 15                	je     8020f6 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020e1:	89 c2                	mov    %eax,%edx
+  8020e3:	c1 ea 08             	shr    $0x8,%edx
+  8020e6:	83 e2 0f             	and    $0xf,%edx
+  8020e9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8020ee:	83 fa 06             	cmp    $0x6,%edx
+  8020f1:	74 0e                	je     802101 <sys_shm_create+0x7a>
+  8020f3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8020f6:	0f b6 c9             	movzbl %cl,%ecx
+  8020f9:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8020ff:	eb 98                	jmp    802099 <sys_shm_create+0x12>
+  802101:	89 c2                	mov    %eax,%edx
+  802103:	c1 ea 04             	shr    $0x4,%edx
+  802106:	83 e2 0f             	and    $0xf,%edx
+  802109:	83 fa 02             	cmp    $0x2,%edx
+  80210c:	77 e5                	ja     8020f3 <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  80210e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802111:	83 f8 02             	cmp    $0x2,%eax
+  802114:	0f 97 c1             	seta   %cl
+  802117:	0f b6 c9             	movzbl %cl,%ecx
+  80211a:	eb d7                	jmp    8020f3 <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  80211c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802121:	b8 15 00 00 00       	mov    $0x15,%eax
+  802126:	8b 55 08             	mov    0x8(%ebp),%edx
+  802129:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80212c:	89 df                	mov    %ebx,%edi
+  80212e:	89 de                	mov    %ebx,%esi
+  802130:	cd 30                	int    $0x30
+  802132:	eb 90                	jmp    8020c4 <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802134:	83 ec 0c             	sub    $0xc,%esp
+  802137:	50                   	push   %eax
+  802138:	6a 15                	push   $0x15
+  80213a:	68 f9 31 80 00       	push   $0x8031f9
+  80213f:	6a 4a                	push   $0x4a
+  802141:	68 16 32 80 00       	push   $0x803216
+  802146:	e8 e5 e1 ff ff       	call   800330 <_panic>
+
+0080214b <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  80214b:	55                   	push   %ebp
+  80214c:	89 e5                	mov    %esp,%ebp
+  80214e:	57                   	push   %edi
+  80214f:	56                   	push   %esi
+  802150:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802151:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802158:	78 32                	js     80218c <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  80215a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802161:	74 75                	je     8021d8 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  802163:	8b 55 08             	mov    0x8(%ebp),%edx
+  802166:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802169:	b8 16 00 00 00       	mov    $0x16,%eax
+  80216e:	be 00 00 00 00       	mov    $0x0,%esi
+  802173:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802176:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802179:	55                   	push   %ebp
+  80217a:	68 83 21 80 00       	push   $0x802183
+  80217f:	89 e5                	mov    %esp,%ebp
+  802181:	0f 34                	sysenter
+  802183:	83 c4 04             	add    $0x4,%esp
+  802186:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  802187:	5b                   	pop    %ebx
+  802188:	5e                   	pop    %esi
+  802189:	5f                   	pop    %edi
+  80218a:	5d                   	pop    %ebp
+  80218b:	c3                   	ret
+  80218c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802191:	0f a2                	cpuid
+		return 0;
+  802193:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802198:	f6 c6 08             	test   $0x8,%dh
+  80219b:	74 15                	je     8021b2 <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80219d:	89 c2                	mov    %eax,%edx
+  80219f:	c1 ea 08             	shr    $0x8,%edx
+  8021a2:	83 e2 0f             	and    $0xf,%edx
+  8021a5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8021aa:	83 fa 06             	cmp    $0x6,%edx
+  8021ad:	74 0e                	je     8021bd <sys_shm_attach+0x72>
+  8021af:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8021b2:	0f b6 c9             	movzbl %cl,%ecx
+  8021b5:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8021bb:	eb 9d                	jmp    80215a <sys_shm_attach+0xf>
+  8021bd:	89 c2                	mov    %eax,%edx
+  8021bf:	c1 ea 04             	shr    $0x4,%edx
+  8021c2:	83 e2 0f             	and    $0xf,%edx
+  8021c5:	83 fa 02             	cmp    $0x2,%edx
+  8021c8:	77 e5                	ja     8021af <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  8021ca:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021cd:	83 f8 02             	cmp    $0x2,%eax
+  8021d0:	0f 97 c1             	seta   %cl
+  8021d3:	0f b6 c9             	movzbl %cl,%ecx
+  8021d6:	eb d7                	jmp    8021af <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  8021d8:	b8 16 00 00 00       	mov    $0x16,%eax
+  8021dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8021e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8021eb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8021ee:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  8021f0:	eb 95                	jmp    802187 <sys_shm_attach+0x3c>
+
+008021f2 <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  8021f2:	55                   	push   %ebp
+  8021f3:	89 e5                	mov    %esp,%ebp
+  8021f5:	57                   	push   %edi
+  8021f6:	56                   	push   %esi
+  8021f7:	53                   	push   %ebx
+  8021f8:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8021fb:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802202:	78 38                	js     80223c <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  802204:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80220b:	74 7b                	je     802288 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  80220d:	be 00 00 00 00       	mov    $0x0,%esi
+  802212:	8b 55 08             	mov    0x8(%ebp),%edx
+  802215:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802218:	b8 17 00 00 00       	mov    $0x17,%eax
+  80221d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802220:	89 f7                	mov    %esi,%edi
+  802222:	55                   	push   %ebp
+  802223:	68 2c 22 80 00       	push   $0x80222c
+  802228:	89 e5                	mov    %esp,%ebp
+  80222a:	0f 34                	sysenter
+  80222c:	83 c4 04             	add    $0x4,%esp
+  80222f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802230:	85 c0                	test   %eax,%eax
+  802232:	7f 6d                	jg     8022a1 <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  802234:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802237:	5b                   	pop    %ebx
+  802238:	5e                   	pop    %esi
+  802239:	5f                   	pop    %edi
+  80223a:	5d                   	pop    %ebp
+  80223b:	c3                   	ret
+  80223c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802241:	0f a2                	cpuid
+		return 0;
+  802243:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802248:	f6 c6 08             	test   $0x8,%dh
+  80224b:	74 15                	je     802262 <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80224d:	89 c2                	mov    %eax,%edx
+  80224f:	c1 ea 08             	shr    $0x8,%edx
+  802252:	83 e2 0f             	and    $0xf,%edx
+  802255:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80225a:	83 fa 06             	cmp    $0x6,%edx
+  80225d:	74 0e                	je     80226d <sys_shm_detach+0x7b>
+  80225f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802262:	0f b6 c9             	movzbl %cl,%ecx
+  802265:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80226b:	eb 97                	jmp    802204 <sys_shm_detach+0x12>
+  80226d:	89 c2                	mov    %eax,%edx
+  80226f:	c1 ea 04             	shr    $0x4,%edx
+  802272:	83 e2 0f             	and    $0xf,%edx
+  802275:	83 fa 02             	cmp    $0x2,%edx
+  802278:	77 e5                	ja     80225f <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  80227a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80227d:	83 f8 02             	cmp    $0x2,%eax
+  802280:	0f 97 c1             	seta   %cl
+  802283:	0f b6 c9             	movzbl %cl,%ecx
+  802286:	eb d7                	jmp    80225f <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  802288:	be 00 00 00 00       	mov    $0x0,%esi
+  80228d:	b8 17 00 00 00       	mov    $0x17,%eax
+  802292:	8b 55 08             	mov    0x8(%ebp),%edx
+  802295:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802298:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80229b:	89 f7                	mov    %esi,%edi
+  80229d:	cd 30                	int    $0x30
+  80229f:	eb 8f                	jmp    802230 <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8022a1:	83 ec 0c             	sub    $0xc,%esp
+  8022a4:	50                   	push   %eax
+  8022a5:	6a 17                	push   $0x17
+  8022a7:	68 f9 31 80 00       	push   $0x8031f9
+  8022ac:	6a 4a                	push   $0x4a
+  8022ae:	68 16 32 80 00       	push   $0x803216
+  8022b3:	e8 78 e0 ff ff       	call   800330 <_panic>
+
+008022b8 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  8022b8:	55                   	push   %ebp
+  8022b9:	89 e5                	mov    %esp,%ebp
+  8022bb:	57                   	push   %edi
+  8022bc:	56                   	push   %esi
+  8022bd:	53                   	push   %ebx
+  8022be:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8022c1:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8022c8:	78 36                	js     802300 <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  8022ca:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8022d1:	74 79                	je     80234c <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  8022d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022db:	b8 18 00 00 00       	mov    $0x18,%eax
+  8022e0:	89 cb                	mov    %ecx,%ebx
+  8022e2:	89 cf                	mov    %ecx,%edi
+  8022e4:	89 ce                	mov    %ecx,%esi
+  8022e6:	55                   	push   %ebp
+  8022e7:	68 f0 22 80 00       	push   $0x8022f0
+  8022ec:	89 e5                	mov    %esp,%ebp
+  8022ee:	0f 34                	sysenter
+  8022f0:	83 c4 04             	add    $0x4,%esp
+  8022f3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8022f4:	85 c0                	test   %eax,%eax
+  8022f6:	7f 6b                	jg     802363 <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  8022f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022fb:	5b                   	pop    %ebx
+  8022fc:	5e                   	pop    %esi
+  8022fd:	5f                   	pop    %edi
+  8022fe:	5d                   	pop    %ebp
+  8022ff:	c3                   	ret
+  802300:	b8 01 00 00 00       	mov    $0x1,%eax
+  802305:	0f a2                	cpuid
+		return 0;
+  802307:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80230c:	f6 c6 08             	test   $0x8,%dh
+  80230f:	74 15                	je     802326 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802311:	89 c2                	mov    %eax,%edx
+  802313:	c1 ea 08             	shr    $0x8,%edx
+  802316:	83 e2 0f             	and    $0xf,%edx
+  802319:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80231e:	83 fa 06             	cmp    $0x6,%edx
+  802321:	74 0e                	je     802331 <sys_shm_remove+0x79>
+  802323:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802326:	0f b6 c9             	movzbl %cl,%ecx
+  802329:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80232f:	eb 99                	jmp    8022ca <sys_shm_remove+0x12>
+  802331:	89 c2                	mov    %eax,%edx
+  802333:	c1 ea 04             	shr    $0x4,%edx
+  802336:	83 e2 0f             	and    $0xf,%edx
+  802339:	83 fa 02             	cmp    $0x2,%edx
+  80233c:	77 e5                	ja     802323 <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  80233e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802341:	83 f8 02             	cmp    $0x2,%eax
+  802344:	0f 97 c1             	seta   %cl
+  802347:	0f b6 c9             	movzbl %cl,%ecx
+  80234a:	eb d7                	jmp    802323 <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  80234c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802351:	b8 18 00 00 00       	mov    $0x18,%eax
+  802356:	8b 55 08             	mov    0x8(%ebp),%edx
+  802359:	89 cb                	mov    %ecx,%ebx
+  80235b:	89 cf                	mov    %ecx,%edi
+  80235d:	89 ce                	mov    %ecx,%esi
+  80235f:	cd 30                	int    $0x30
+  802361:	eb 91                	jmp    8022f4 <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802363:	83 ec 0c             	sub    $0xc,%esp
+  802366:	50                   	push   %eax
+  802367:	6a 18                	push   $0x18
+  802369:	68 f9 31 80 00       	push   $0x8031f9
+  80236e:	6a 4a                	push   $0x4a
+  802370:	68 16 32 80 00       	push   $0x803216
+  802375:	e8 b6 df ff ff       	call   800330 <_panic>
+
+0080237a <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  80237a:	55                   	push   %ebp
+  80237b:	89 e5                	mov    %esp,%ebp
+  80237d:	57                   	push   %edi
+  80237e:	56                   	push   %esi
+  80237f:	53                   	push   %ebx
+  802380:	83 ec 0c             	sub    $0xc,%esp
+  802383:	8b 45 10             	mov    0x10(%ebp),%eax
+  802386:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802389:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  80238c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802393:	78 32                	js     8023c7 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  802395:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80239c:	74 75                	je     802413 <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  80239e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023a4:	b8 20 00 00 00       	mov    $0x20,%eax
+  8023a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8023ae:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8023b1:	55                   	push   %ebp
+  8023b2:	68 bb 23 80 00       	push   $0x8023bb
+  8023b7:	89 e5                	mov    %esp,%ebp
+  8023b9:	0f 34                	sysenter
+  8023bb:	83 c4 04             	add    $0x4,%esp
+  8023be:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  8023bf:	83 c4 0c             	add    $0xc,%esp
+  8023c2:	5b                   	pop    %ebx
+  8023c3:	5e                   	pop    %esi
+  8023c4:	5f                   	pop    %edi
+  8023c5:	5d                   	pop    %ebp
+  8023c6:	c3                   	ret
+  8023c7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023cc:	0f a2                	cpuid
+		return 0;
+  8023ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8023d3:	f6 c6 08             	test   $0x8,%dh
+  8023d6:	74 15                	je     8023ed <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023d8:	89 c2                	mov    %eax,%edx
+  8023da:	c1 ea 08             	shr    $0x8,%edx
+  8023dd:	83 e2 0f             	and    $0xf,%edx
+  8023e0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8023e5:	83 fa 06             	cmp    $0x6,%edx
+  8023e8:	74 0e                	je     8023f8 <sys_futex_wait+0x7e>
+  8023ea:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8023ed:	0f b6 c9             	movzbl %cl,%ecx
+  8023f0:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8023f6:	eb 9d                	jmp    802395 <sys_futex_wait+0x1b>
+  8023f8:	89 c2                	mov    %eax,%edx
+  8023fa:	c1 ea 04             	shr    $0x4,%edx
+  8023fd:	83 e2 0f             	and    $0xf,%edx
+  802400:	83 fa 02             	cmp    $0x2,%edx
+  802403:	77 e5                	ja     8023ea <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  802405:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802408:	83 f8 02             	cmp    $0x2,%eax
+  80240b:	0f 97 c1             	seta   %cl
+  80240e:	0f b6 c9             	movzbl %cl,%ecx
+  802411:	eb d7                	jmp    8023ea <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  802413:	b8 20 00 00 00       	mov    $0x20,%eax
+  802418:	be 00 00 00 00       	mov    $0x0,%esi
+  80241d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802420:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802423:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802426:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  802428:	eb 95                	jmp    8023bf <sys_futex_wait+0x45>
+
+0080242a <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80242a:	55                   	push   %ebp
+  80242b:	89 e5                	mov    %esp,%ebp
+  80242d:	57                   	push   %edi
+  80242e:	56                   	push   %esi
+  80242f:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802430:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802437:	78 30                	js     802469 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  802439:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802440:	74 73                	je     8024b5 <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  802442:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802447:	8b 55 08             	mov    0x8(%ebp),%edx
+  80244a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80244d:	b8 21 00 00 00       	mov    $0x21,%eax
+  802452:	89 df                	mov    %ebx,%edi
+  802454:	89 de                	mov    %ebx,%esi
+  802456:	55                   	push   %ebp
+  802457:	68 60 24 80 00       	push   $0x802460
+  80245c:	89 e5                	mov    %esp,%ebp
+  80245e:	0f 34                	sysenter
+  802460:	83 c4 04             	add    $0x4,%esp
+  802463:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  802464:	5b                   	pop    %ebx
+  802465:	5e                   	pop    %esi
+  802466:	5f                   	pop    %edi
+  802467:	5d                   	pop    %ebp
+  802468:	c3                   	ret
+  802469:	b8 01 00 00 00       	mov    $0x1,%eax
+  80246e:	0f a2                	cpuid
+		return 0;
+  802470:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802475:	f6 c6 08             	test   $0x8,%dh
+  802478:	74 15                	je     80248f <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80247a:	89 c2                	mov    %eax,%edx
+  80247c:	c1 ea 08             	shr    $0x8,%edx
+  80247f:	83 e2 0f             	and    $0xf,%edx
+  802482:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802487:	83 fa 06             	cmp    $0x6,%edx
+  80248a:	74 0e                	je     80249a <sys_futex_wake+0x70>
+  80248c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80248f:	0f b6 c9             	movzbl %cl,%ecx
+  802492:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802498:	eb 9f                	jmp    802439 <sys_futex_wake+0xf>
+  80249a:	89 c2                	mov    %eax,%edx
+  80249c:	c1 ea 04             	shr    $0x4,%edx
+  80249f:	83 e2 0f             	and    $0xf,%edx
+  8024a2:	83 fa 02             	cmp    $0x2,%edx
+  8024a5:	77 e5                	ja     80248c <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  8024a7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8024aa:	83 f8 02             	cmp    $0x2,%eax
+  8024ad:	0f 97 c1             	seta   %cl
+  8024b0:	0f b6 c9             	movzbl %cl,%ecx
+  8024b3:	eb d7                	jmp    80248c <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  8024b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024ba:	b8 21 00 00 00       	mov    $0x21,%eax
+  8024bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024c5:	89 df                	mov    %ebx,%edi
+  8024c7:	89 de                	mov    %ebx,%esi
+  8024c9:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  8024cb:	eb 97                	jmp    802464 <sys_futex_wake+0x3a>
+
+008024cd <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  8024cd:	55                   	push   %ebp
+  8024ce:	89 e5                	mov    %esp,%ebp
+  8024d0:	57                   	push   %edi
+  8024d1:	56                   	push   %esi
+  8024d2:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8024d3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8024da:	78 2e                	js     80250a <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  8024dc:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8024e3:	74 71                	je     802556 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  8024e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024ea:	b8 22 00 00 00       	mov    $0x22,%eax
+  8024ef:	89 d1                	mov    %edx,%ecx
+  8024f1:	89 d3                	mov    %edx,%ebx
+  8024f3:	89 d7                	mov    %edx,%edi
+  8024f5:	89 d6                	mov    %edx,%esi
+  8024f7:	55                   	push   %ebp
+  8024f8:	68 01 25 80 00       	push   $0x802501
+  8024fd:	89 e5                	mov    %esp,%ebp
+  8024ff:	0f 34                	sysenter
+  802501:	83 c4 04             	add    $0x4,%esp
+  802504:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  802505:	5b                   	pop    %ebx
+  802506:	5e                   	pop    %esi
+  802507:	5f                   	pop    %edi
+  802508:	5d                   	pop    %ebp
+  802509:	c3                   	ret
+  80250a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80250f:	0f a2                	cpuid
+		return 0;
+  802511:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802516:	f6 c6 08             	test   $0x8,%dh
+  802519:	74 15                	je     802530 <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80251b:	89 c2                	mov    %eax,%edx
+  80251d:	c1 ea 08             	shr    $0x8,%edx
+  802520:	83 e2 0f             	and    $0xf,%edx
+  802523:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802528:	83 fa 06             	cmp    $0x6,%edx
+  80252b:	74 0e                	je     80253b <sys_ep_create+0x6e>
+  80252d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802530:	0f b6 c9             	movzbl %cl,%ecx
+  802533:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802539:	eb a1                	jmp    8024dc <sys_ep_create+0xf>
+  80253b:	89 c2                	mov    %eax,%edx
+  80253d:	c1 ea 04             	shr    $0x4,%edx
+  802540:	83 e2 0f             	and    $0xf,%edx
+  802543:	83 fa 02             	cmp    $0x2,%edx
+  802546:	77 e5                	ja     80252d <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  802548:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80254b:	83 f8 02             	cmp    $0x2,%eax
+  80254e:	0f 97 c1             	seta   %cl
+  802551:	0f b6 c9             	movzbl %cl,%ecx
+  802554:	eb d7                	jmp    80252d <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  802556:	ba 00 00 00 00       	mov    $0x0,%edx
+  80255b:	b8 22 00 00 00       	mov    $0x22,%eax
+  802560:	89 d1                	mov    %edx,%ecx
+  802562:	89 d3                	mov    %edx,%ebx
+  802564:	89 d7                	mov    %edx,%edi
+  802566:	89 d6                	mov    %edx,%esi
+  802568:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  80256a:	eb 99                	jmp    802505 <sys_ep_create+0x38>
+
+0080256c <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  80256c:	55                   	push   %ebp
+  80256d:	89 e5                	mov    %esp,%ebp
+  80256f:	57                   	push   %edi
+  802570:	56                   	push   %esi
+  802571:	53                   	push   %ebx
+  802572:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802575:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80257c:	78 36                	js     8025b4 <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  80257e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802585:	74 79                	je     802600 <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  802587:	8b 55 08             	mov    0x8(%ebp),%edx
+  80258a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80258f:	b8 23 00 00 00       	mov    $0x23,%eax
+  802594:	89 cb                	mov    %ecx,%ebx
+  802596:	89 cf                	mov    %ecx,%edi
+  802598:	89 ce                	mov    %ecx,%esi
+  80259a:	55                   	push   %ebp
+  80259b:	68 a4 25 80 00       	push   $0x8025a4
+  8025a0:	89 e5                	mov    %esp,%ebp
+  8025a2:	0f 34                	sysenter
+  8025a4:	83 c4 04             	add    $0x4,%esp
+  8025a7:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8025a8:	85 c0                	test   %eax,%eax
+  8025aa:	7f 6b                	jg     802617 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  8025ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025af:	5b                   	pop    %ebx
+  8025b0:	5e                   	pop    %esi
+  8025b1:	5f                   	pop    %edi
+  8025b2:	5d                   	pop    %ebp
+  8025b3:	c3                   	ret
+  8025b4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025b9:	0f a2                	cpuid
+		return 0;
+  8025bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8025c0:	f6 c6 08             	test   $0x8,%dh
+  8025c3:	74 15                	je     8025da <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025c5:	89 c2                	mov    %eax,%edx
+  8025c7:	c1 ea 08             	shr    $0x8,%edx
+  8025ca:	83 e2 0f             	and    $0xf,%edx
+  8025cd:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8025d2:	83 fa 06             	cmp    $0x6,%edx
+  8025d5:	74 0e                	je     8025e5 <sys_ep_destroy+0x79>
+  8025d7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8025da:	0f b6 c9             	movzbl %cl,%ecx
+  8025dd:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8025e3:	eb 99                	jmp    80257e <sys_ep_destroy+0x12>
+  8025e5:	89 c2                	mov    %eax,%edx
+  8025e7:	c1 ea 04             	shr    $0x4,%edx
+  8025ea:	83 e2 0f             	and    $0xf,%edx
+  8025ed:	83 fa 02             	cmp    $0x2,%edx
+  8025f0:	77 e5                	ja     8025d7 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  8025f2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025f5:	83 f8 02             	cmp    $0x2,%eax
+  8025f8:	0f 97 c1             	seta   %cl
+  8025fb:	0f b6 c9             	movzbl %cl,%ecx
+  8025fe:	eb d7                	jmp    8025d7 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  802600:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802605:	b8 23 00 00 00       	mov    $0x23,%eax
+  80260a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80260d:	89 cb                	mov    %ecx,%ebx
+  80260f:	89 cf                	mov    %ecx,%edi
+  802611:	89 ce                	mov    %ecx,%esi
+  802613:	cd 30                	int    $0x30
+  802615:	eb 91                	jmp    8025a8 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802617:	83 ec 0c             	sub    $0xc,%esp
+  80261a:	50                   	push   %eax
+  80261b:	6a 23                	push   $0x23
+  80261d:	68 f9 31 80 00       	push   $0x8031f9
+  802622:	6a 4a                	push   $0x4a
+  802624:	68 16 32 80 00       	push   $0x803216
+  802629:	e8 02 dd ff ff       	call   800330 <_panic>
+
+0080262e <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  80262e:	55                   	push   %ebp
+  80262f:	89 e5                	mov    %esp,%ebp
+  802631:	57                   	push   %edi
+  802632:	56                   	push   %esi
+  802633:	53                   	push   %ebx
+  802634:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802637:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80263e:	78 37                	js     802677 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  802640:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802647:	74 7a                	je     8026c3 <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  802649:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80264e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802651:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802654:	b8 24 00 00 00       	mov    $0x24,%eax
+  802659:	89 df                	mov    %ebx,%edi
+  80265b:	89 de                	mov    %ebx,%esi
+  80265d:	55                   	push   %ebp
+  80265e:	68 67 26 80 00       	push   $0x802667
+  802663:	89 e5                	mov    %esp,%ebp
+  802665:	0f 34                	sysenter
+  802667:	83 c4 04             	add    $0x4,%esp
+  80266a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80266b:	85 c0                	test   %eax,%eax
+  80266d:	7f 6c                	jg     8026db <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  80266f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802672:	5b                   	pop    %ebx
+  802673:	5e                   	pop    %esi
+  802674:	5f                   	pop    %edi
+  802675:	5d                   	pop    %ebp
+  802676:	c3                   	ret
+  802677:	b8 01 00 00 00       	mov    $0x1,%eax
+  80267c:	0f a2                	cpuid
+		return 0;
+  80267e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802683:	f6 c6 08             	test   $0x8,%dh
+  802686:	74 15                	je     80269d <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802688:	89 c2                	mov    %eax,%edx
+  80268a:	c1 ea 08             	shr    $0x8,%edx
+  80268d:	83 e2 0f             	and    $0xf,%edx
+  802690:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802695:	83 fa 06             	cmp    $0x6,%edx
+  802698:	74 0e                	je     8026a8 <sys_ep_grant+0x7a>
+  80269a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80269d:	0f b6 c9             	movzbl %cl,%ecx
+  8026a0:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8026a6:	eb 98                	jmp    802640 <sys_ep_grant+0x12>
+  8026a8:	89 c2                	mov    %eax,%edx
+  8026aa:	c1 ea 04             	shr    $0x4,%edx
+  8026ad:	83 e2 0f             	and    $0xf,%edx
+  8026b0:	83 fa 02             	cmp    $0x2,%edx
+  8026b3:	77 e5                	ja     80269a <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  8026b5:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8026b8:	83 f8 02             	cmp    $0x2,%eax
+  8026bb:	0f 97 c1             	seta   %cl
+  8026be:	0f b6 c9             	movzbl %cl,%ecx
+  8026c1:	eb d7                	jmp    80269a <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  8026c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026c8:	b8 24 00 00 00       	mov    $0x24,%eax
+  8026cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8026d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026d3:	89 df                	mov    %ebx,%edi
+  8026d5:	89 de                	mov    %ebx,%esi
+  8026d7:	cd 30                	int    $0x30
+  8026d9:	eb 90                	jmp    80266b <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8026db:	83 ec 0c             	sub    $0xc,%esp
+  8026de:	50                   	push   %eax
+  8026df:	6a 24                	push   $0x24
+  8026e1:	68 f9 31 80 00       	push   $0x8031f9
+  8026e6:	6a 4a                	push   $0x4a
+  8026e8:	68 16 32 80 00       	push   $0x803216
+  8026ed:	e8 3e dc ff ff       	call   800330 <_panic>
+
+008026f2 <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  8026f2:	55                   	push   %ebp
+  8026f3:	89 e5                	mov    %esp,%ebp
+  8026f5:	57                   	push   %edi
+  8026f6:	56                   	push   %esi
+  8026f7:	53                   	push   %ebx
+  8026f8:	83 ec 20             	sub    $0x20,%esp
+  8026fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  8026fe:	8b 10                	mov    (%eax),%edx
+  802700:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802703:	8b 50 04             	mov    0x4(%eax),%edx
+  802706:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802709:	8b 50 08             	mov    0x8(%eax),%edx
+  80270c:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  80270f:	8b 50 0c             	mov    0xc(%eax),%edx
+  802712:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  802715:	8b 40 10             	mov    0x10(%eax),%eax
+  802718:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  80271b:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  80271e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802721:	b8 25 00 00 00       	mov    $0x25,%eax
+  802726:	55                   	push   %ebp
+  802727:	56                   	push   %esi
+  802728:	8b 0e                	mov    (%esi),%ecx
+  80272a:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80272d:	8b 7e 08             	mov    0x8(%esi),%edi
+  802730:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802733:	8b 76 0c             	mov    0xc(%esi),%esi
+  802736:	cd 30                	int    $0x30
+  802738:	87 34 24             	xchg   %esi,(%esp)
+  80273b:	89 0e                	mov    %ecx,(%esi)
+  80273d:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802740:	89 7e 08             	mov    %edi,0x8(%esi)
+  802743:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802746:	8f 46 0c             	pop    0xc(%esi)
+  802749:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  80274a:	83 c4 20             	add    $0x20,%esp
+  80274d:	5b                   	pop    %ebx
+  80274e:	5e                   	pop    %esi
+  80274f:	5f                   	pop    %edi
+  802750:	5d                   	pop    %ebp
+  802751:	c3                   	ret
+
+00802752 <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  802752:	55                   	push   %ebp
+  802753:	89 e5                	mov    %esp,%ebp
+  802755:	57                   	push   %edi
+  802756:	56                   	push   %esi
+  802757:	53                   	push   %ebx
+  802758:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  80275b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80275e:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  802760:	8b 55 08             	mov    0x8(%ebp),%edx
+  802763:	b8 26 00 00 00       	mov    $0x26,%eax
+  802768:	55                   	push   %ebp
+  802769:	56                   	push   %esi
+  80276a:	8b 0e                	mov    (%esi),%ecx
+  80276c:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80276f:	8b 7e 08             	mov    0x8(%esi),%edi
+  802772:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802775:	8b 76 0c             	mov    0xc(%esi),%esi
+  802778:	cd 30                	int    $0x30
+  80277a:	87 34 24             	xchg   %esi,(%esp)
+  80277d:	89 0e                	mov    %ecx,(%esi)
+  80277f:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802782:	89 7e 08             	mov    %edi,0x8(%esi)
+  802785:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802788:	8f 46 0c             	pop    0xc(%esi)
+  80278b:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  80278c:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  802790:	74 0f                	je     8027a1 <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  802792:	85 c0                	test   %eax,%eax
+  802794:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802799:	0f 48 d1             	cmovs  %ecx,%edx
+  80279c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  80279f:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  8027a1:	5b                   	pop    %ebx
+  8027a2:	5e                   	pop    %esi
+  8027a3:	5f                   	pop    %edi
+  8027a4:	5d                   	pop    %ebp
+  8027a5:	c3                   	ret
+
+008027a6 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  8027a6:	55                   	push   %ebp
+  8027a7:	89 e5                	mov    %esp,%ebp
+  8027a9:	57                   	push   %edi
+  8027aa:	56                   	push   %esi
+  8027ab:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8027ac:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8027b3:	78 2f                	js     8027e4 <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  8027b5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8027bc:	74 72                	je     802830 <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  8027be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8027c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027c6:	b8 27 00 00 00       	mov    $0x27,%eax
+  8027cb:	89 cb                	mov    %ecx,%ebx
+  8027cd:	89 cf                	mov    %ecx,%edi
+  8027cf:	89 ce                	mov    %ecx,%esi
+  8027d1:	55                   	push   %ebp
+  8027d2:	68 db 27 80 00       	push   $0x8027db
+  8027d7:	89 e5                	mov    %esp,%ebp
+  8027d9:	0f 34                	sysenter
+  8027db:	83 c4 04             	add    $0x4,%esp
+  8027de:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  8027df:	5b                   	pop    %ebx
+  8027e0:	5e                   	pop    %esi
+  8027e1:	5f                   	pop    %edi
+  8027e2:	5d                   	pop    %ebp
+  8027e3:	c3                   	ret
+  8027e4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8027e9:	0f a2                	cpuid
+		return 0;
+  8027eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8027f0:	f6 c6 08             	test   $0x8,%dh
+  8027f3:	74 15                	je     80280a <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8027f5:	89 c2                	mov    %eax,%edx
+  8027f7:	c1 ea 08             	shr    $0x8,%edx
+  8027fa:	83 e2 0f             	and    $0xf,%edx
+  8027fd:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802802:	83 fa 06             	cmp    $0x6,%edx
+  802805:	74 0e                	je     802815 <sys_sysring_setup+0x6f>
+  802807:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80280a:	0f b6 c9             	movzbl %cl,%ecx
+  80280d:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802813:	eb a0                	jmp    8027b5 <sys_sysring_setup+0xf>
+  802815:	89 c2                	mov    %eax,%edx
+  802817:	c1 ea 04             	shr    $0x4,%edx
+  80281a:	83 e2 0f             	and    $0xf,%edx
+  80281d:	83 fa 02             	cmp    $0x2,%edx
+  802820:	77 e5                	ja     802807 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  802822:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802825:	83 f8 02             	cmp    $0x2,%eax
+  802828:	0f 97 c1             	seta   %cl
+  80282b:	0f b6 c9             	movzbl %cl,%ecx
+  80282e:	eb d7                	jmp    802807 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  802830:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802835:	b8 27 00 00 00       	mov    $0x27,%eax
+  80283a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80283d:	89 cb                	mov    %ecx,%ebx
+  80283f:	89 cf                	mov    %ecx,%edi
+  802841:	89 ce                	mov    %ecx,%esi
+  802843:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  802845:	eb 98                	jmp    8027df <sys_sysring_setup+0x39>
+
+00802847 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  802847:	55                   	push   %ebp
+  802848:	89 e5                	mov    %esp,%ebp
+  80284a:	57                   	push   %edi
+  80284b:	56                   	push   %esi
+  80284c:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80284d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802854:	78 2e                	js     802884 <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  802856:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80285d:	74 71                	je     8028d0 <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  80285f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802864:	b8 28 00 00 00       	mov    $0x28,%eax
+  802869:	89 d1                	mov    %edx,%ecx
+  80286b:	89 d3                	mov    %edx,%ebx
+  80286d:	89 d7                	mov    %edx,%edi
+  80286f:	89 d6                	mov    %edx,%esi
+  802871:	55                   	push   %ebp
+  802872:	68 7b 28 80 00       	push   $0x80287b
+  802877:	89 e5                	mov    %esp,%ebp
+  802879:	0f 34                	sysenter
+  80287b:	83 c4 04             	add    $0x4,%esp
+  80287e:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  80287f:	5b                   	pop    %ebx
+  802880:	5e                   	pop    %esi
+  802881:	5f                   	pop    %edi
+  802882:	5d                   	pop    %ebp
+  802883:	c3                   	ret
+  802884:	b8 01 00 00 00       	mov    $0x1,%eax
+  802889:	0f a2                	cpuid
+		return 0;
+  80288b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802890:	f6 c6 08             	test   $0x8,%dh
+  802893:	74 15                	je     8028aa <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802895:	89 c2                	mov    %eax,%edx
+  802897:	c1 ea 08             	shr    $0x8,%edx
+  80289a:	83 e2 0f             	and    $0xf,%edx
+  80289d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8028a2:	83 fa 06             	cmp    $0x6,%edx
+  8028a5:	74 0e                	je     8028b5 <sys_sysring_enter+0x6e>
+  8028a7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8028aa:	0f b6 c9             	movzbl %cl,%ecx
+  8028ad:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8028b3:	eb a1                	jmp    802856 <sys_sysring_enter+0xf>
+  8028b5:	89 c2                	mov    %eax,%edx
+  8028b7:	c1 ea 04             	shr    $0x4,%edx
+  8028ba:	83 e2 0f             	and    $0xf,%edx
+  8028bd:	83 fa 02             	cmp    $0x2,%edx
+  8028c0:	77 e5                	ja     8028a7 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  8028c2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8028c5:	83 f8 02             	cmp    $0x2,%eax
+  8028c8:	0f 97 c1             	seta   %cl
+  8028cb:	0f b6 c9             	movzbl %cl,%ecx
+  8028ce:	eb d7                	jmp    8028a7 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  8028d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028d5:	b8 28 00 00 00       	mov    $0x28,%eax
+  8028da:	89 d1                	mov    %edx,%ecx
+  8028dc:	89 d3                	mov    %edx,%ebx
+  8028de:	89 d7                	mov    %edx,%edi
+  8028e0:	89 d6                	mov    %edx,%esi
+  8028e2:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  8028e4:	eb 99                	jmp    80287f <sys_sysring_enter+0x38>
+
+008028e6 <spawn>:
+//
+// Returns the child's envid on success, < 0 on failure.
+//
+envid_t
+spawn(const void *binary, size_t size, const char **argv)
+{
+  8028e6:	55                   	push   %ebp
+  8028e7:	89 e5                	mov    %esp,%ebp
+  8028e9:	83 ec 0c             	sub    $0xc,%esp
+	return sys_spawn(binary, size, argv);
+  8028ec:	ff 75 10             	push   0x10(%ebp)
+  8028ef:	ff 75 0c             	push   0xc(%ebp)
+  8028f2:	ff 75 08             	push   0x8(%ebp)
+  8028f5:	e8 e8 f6 ff ff       	call   801fe2 <sys_spawn>
+}
+  8028fa:	c9                   	leave
+  8028fb:	c3                   	ret
+
+008028fc <uspawn>:
+// Same interface as spawn(); kept to compare the two (user/spawnbench).
+// Segments must not share a page with each other.
+//
+envid_t
+uspawn(const void *binary, size_t size, const char **argv)
+{
+  8028fc:	55                   	push   %ebp
+  8028fd:	89 e5                	mov    %esp,%ebp
+  8028ff:	57                   	push   %edi
+  802900:	56                   	push   %esi
+  802901:	53                   	push   %ebx
+  802902:	83 ec 7c             	sub    $0x7c,%esp
+	struct Trapframe child_tf;
+	uintptr_t esp;
+	envid_t child;
+	int i, r;
+
+	if (size < sizeof(*elf) || elf->e_magic != ELF_MAGIC
+  802905:	83 7d 0c 33          	cmpl   $0x33,0xc(%ebp)
+  802909:	0f 86 10 03 00 00    	jbe    802c1f <uspawn+0x323>
+  80290f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802912:	81 38 7f 45 4c 46    	cmpl   $0x464c457f,(%eax)
+  802918:	0f 85 0d 03 00 00    	jne    802c2b <uspawn+0x32f>
+	    || elf->e_phoff + elf->e_phnum * sizeof(*ph) > size)
+  80291e:	0f b7 40 2c          	movzwl 0x2c(%eax),%eax
+  802922:	c1 e0 05             	shl    $0x5,%eax
+  802925:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802928:	03 41 1c             	add    0x1c(%ecx),%eax
+  80292b:	39 45 0c             	cmp    %eax,0xc(%ebp)
+  80292e:	0f 82 03 03 00 00    	jb     802c37 <uspawn+0x33b>
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  802934:	b8 07 00 00 00       	mov    $0x7,%eax
+  802939:	cd 30                	int    $0x30
+  80293b:	89 45 88             	mov    %eax,-0x78(%ebp)
+  80293e:	89 45 94             	mov    %eax,-0x6c(%ebp)
+		return -E_NOT_EXEC;
+
+	if ((r = sys_exofork()) < 0)
+  802941:	85 c0                	test   %eax,%eax
+  802943:	0f 88 32 02 00 00    	js     802b7b <uspawn+0x27f>
+		return r;
+	child = r;
+
+	child_tf = envs[ENVX(child)].env_tf;
+  802949:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80294e:	69 f0 68 01 00 00    	imul   $0x168,%eax,%esi
+  802954:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  80295a:	8d 7d a4             	lea    -0x5c(%ebp),%edi
+  80295d:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802962:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  802964:	8b 45 08             	mov    0x8(%ebp),%eax
+  802967:	8b 40 18             	mov    0x18(%eax),%eax
+  80296a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	for (argc = 0; argv && argv[argc]; argc++)
+  80296d:	bb 00 00 00 00       	mov    $0x0,%ebx
+	size_t string_size = 0;
+  802972:	be 00 00 00 00       	mov    $0x0,%esi
+  802977:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (argc = 0; argv && argv[argc]; argc++)
+  80297a:	eb 13                	jmp    80298f <uspawn+0x93>
+		string_size += strlen(argv[argc]) + 1;
+  80297c:	83 ec 0c             	sub    $0xc,%esp
+  80297f:	50                   	push   %eax
+  802980:	e8 72 e0 ff ff       	call   8009f7 <strlen>
+  802985:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv && argv[argc]; argc++)
+  802989:	83 c3 01             	add    $0x1,%ebx
+  80298c:	83 c4 10             	add    $0x10,%esp
+  80298f:	85 ff                	test   %edi,%edi
+  802991:	74 07                	je     80299a <uspawn+0x9e>
+  802993:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  802996:	85 c0                	test   %eax,%eax
+  802998:	75 e2                	jne    80297c <uspawn+0x80>
+	string_store = (char *) UTEMP + PGSIZE - string_size;
+  80299a:	bf 00 10 40 00       	mov    $0x401000,%edi
+  80299f:	29 f7                	sub    %esi,%edi
+				    - 4 * (argc + 1));
+  8029a1:	8d 0c 9d 04 00 00 00 	lea    0x4(,%ebx,4),%ecx
+  8029a8:	89 4d 84             	mov    %ecx,-0x7c(%ebp)
+	argv_store = (uintptr_t *) (ROUNDDOWN((uintptr_t) string_store, 4)
+  8029ab:	89 f8                	mov    %edi,%eax
+  8029ad:	83 e0 fc             	and    $0xfffffffc,%eax
+				    - 4 * (argc + 1));
+  8029b0:	29 c8                	sub    %ecx,%eax
+	argv_store = (uintptr_t *) (ROUNDDOWN((uintptr_t) string_store, 4)
+  8029b2:	89 45 80             	mov    %eax,-0x80(%ebp)
+	if ((void *) (argv_store - 2) < (void *) UTEMP)
+  8029b5:	89 45 8c             	mov    %eax,-0x74(%ebp)
+  8029b8:	83 e8 08             	sub    $0x8,%eax
+  8029bb:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  8029c0:	0f 86 7d 02 00 00    	jbe    802c43 <uspawn+0x347>
+	if ((r = sys_page_alloc(0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  8029c6:	83 ec 04             	sub    $0x4,%esp
+  8029c9:	6a 07                	push   $0x7
+  8029cb:	68 00 00 40 00       	push   $0x400000
+  8029d0:	6a 00                	push   $0x0
+  8029d2:	e8 90 e8 ff ff       	call   801267 <sys_page_alloc>
+  8029d7:	89 c6                	mov    %eax,%esi
+  8029d9:	83 c4 10             	add    $0x10,%esp
+  8029dc:	85 c0                	test   %eax,%eax
+  8029de:	0f 88 77 01 00 00    	js     802b5b <uspawn+0x25f>
+	for (i = 0; i < argc; i++) {
+  8029e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8029e9:	89 5d 90             	mov    %ebx,-0x70(%ebp)
+  8029ec:	8b 5d 8c             	mov    -0x74(%ebp),%ebx
+  8029ef:	eb 32                	jmp    802a23 <uspawn+0x127>
+		argv_store[i] = (uintptr_t) UTEMP2USTACK(string_store);
+  8029f1:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  8029f7:	89 03                	mov    %eax,(%ebx)
+		strcpy(string_store, argv[i]);
+  8029f9:	83 ec 08             	sub    $0x8,%esp
+  8029fc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8029ff:	ff 34 b0             	push   (%eax,%esi,4)
+  802a02:	57                   	push   %edi
+  802a03:	e8 2a e0 ff ff       	call   800a32 <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  802a08:	83 c4 04             	add    $0x4,%esp
+  802a0b:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a0e:	ff 34 b0             	push   (%eax,%esi,4)
+  802a11:	e8 e1 df ff ff       	call   8009f7 <strlen>
+  802a16:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  802a1a:	83 c6 01             	add    $0x1,%esi
+  802a1d:	83 c3 04             	add    $0x4,%ebx
+  802a20:	83 c4 10             	add    $0x10,%esp
+  802a23:	39 75 90             	cmp    %esi,-0x70(%ebp)
+  802a26:	7f c9                	jg     8029f1 <uspawn+0xf5>
+	argv_store[argc] = 0;
+  802a28:	8b 5d 90             	mov    -0x70(%ebp),%ebx
+  802a2b:	8b 45 80             	mov    -0x80(%ebp),%eax
+  802a2e:	8b 4d 84             	mov    -0x7c(%ebp),%ecx
+  802a31:	c7 44 08 fc 00 00 00 	movl   $0x0,-0x4(%eax,%ecx,1)
+  802a38:	00 
+	argv_store[-1] = (uintptr_t) UTEMP2USTACK(argv_store);
+  802a39:	89 c1                	mov    %eax,%ecx
+  802a3b:	8d 80 00 d0 7f ee    	lea    -0x11803000(%eax),%eax
+  802a41:	89 41 fc             	mov    %eax,-0x4(%ecx)
+	argv_store[-2] = argc;
+  802a44:	89 59 f8             	mov    %ebx,-0x8(%ecx)
+	*esp = (uintptr_t) UTEMP2USTACK(&argv_store[-2]);
+  802a47:	8d 99 f8 cf 7f ee    	lea    -0x11803008(%ecx),%ebx
+	if ((r = sys_page_map(0, UTEMP, child, (void *) (USTACKTOP - PGSIZE),
+  802a4d:	83 ec 0c             	sub    $0xc,%esp
+  802a50:	6a 07                	push   $0x7
+  802a52:	68 00 d0 bf ee       	push   $0xeebfd000
+  802a57:	ff 75 88             	push   -0x78(%ebp)
+  802a5a:	68 00 00 40 00       	push   $0x400000
+  802a5f:	6a 00                	push   $0x0
+  802a61:	e8 c7 e8 ff ff       	call   80132d <sys_page_map>
+  802a66:	89 c6                	mov    %eax,%esi
+  802a68:	83 c4 20             	add    $0x20,%esp
+  802a6b:	85 c0                	test   %eax,%eax
+  802a6d:	0f 88 da 01 00 00    	js     802c4d <uspawn+0x351>
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  802a73:	83 ec 08             	sub    $0x8,%esp
+  802a76:	68 00 00 40 00       	push   $0x400000
+  802a7b:	6a 00                	push   $0x0
+  802a7d:	e8 6f e9 ff ff       	call   8013f1 <sys_page_unmap>
+  802a82:	89 c6                	mov    %eax,%esi
+  802a84:	83 c4 10             	add    $0x10,%esp
+  802a87:	85 c0                	test   %eax,%eax
+  802a89:	0f 88 be 01 00 00    	js     802c4d <uspawn+0x351>
+	if ((r = init_stack(child, argv, &esp)) < 0)
+		goto error;
+	child_tf.tf_esp = esp;
+  802a8f:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+
+	ph = (const struct Proghdr *) ((const uint8_t *) binary + elf->e_phoff);
+  802a92:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a95:	89 c7                	mov    %eax,%edi
+  802a97:	03 78 1c             	add    0x1c(%eax),%edi
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802a9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a9f:	89 c1                	mov    %eax,%ecx
+  802aa1:	e9 e9 00 00 00       	jmp    802b8f <uspawn+0x293>
+		if ((r = sys_page_alloc(0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  802aa6:	83 ec 04             	sub    $0x4,%esp
+  802aa9:	6a 07                	push   $0x7
+  802aab:	68 00 00 40 00       	push   $0x400000
+  802ab0:	6a 00                	push   $0x0
+  802ab2:	e8 b0 e7 ff ff       	call   801267 <sys_page_alloc>
+  802ab7:	83 c4 10             	add    $0x10,%esp
+  802aba:	85 c0                	test   %eax,%eax
+  802abc:	0f 88 4f 01 00 00    	js     802c11 <uspawn+0x315>
+		start = MAX(va, ph->p_va);
+  802ac2:	8b 4f 08             	mov    0x8(%edi),%ecx
+  802ac5:	39 cb                	cmp    %ecx,%ebx
+  802ac7:	89 c8                	mov    %ecx,%eax
+  802ac9:	0f 43 c3             	cmovae %ebx,%eax
+		memmove(UTEMP + PGOFF(start), data + (start - ph->p_va),
+  802acc:	83 ec 04             	sub    $0x4,%esp
+		end = MIN(va + PGSIZE, data_end);
+  802acf:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+  802ad5:	39 f2                	cmp    %esi,%edx
+  802ad7:	0f 47 d6             	cmova  %esi,%edx
+		memmove(UTEMP + PGOFF(start), data + (start - ph->p_va),
+  802ada:	29 c2                	sub    %eax,%edx
+  802adc:	52                   	push   %edx
+  802add:	8b 55 90             	mov    -0x70(%ebp),%edx
+  802ae0:	29 ca                	sub    %ecx,%edx
+  802ae2:	01 c2                	add    %eax,%edx
+  802ae4:	03 55 08             	add    0x8(%ebp),%edx
+  802ae7:	52                   	push   %edx
+  802ae8:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802aed:	05 00 00 40 00       	add    $0x400000,%eax
+  802af2:	50                   	push   %eax
+  802af3:	e8 c0 e0 ff ff       	call   800bb8 <memmove>
+		if ((r = sys_page_map(0, UTEMP, child, (void *) va,
+  802af8:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  802aff:	53                   	push   %ebx
+  802b00:	ff 75 94             	push   -0x6c(%ebp)
+  802b03:	68 00 00 40 00       	push   $0x400000
+  802b08:	6a 00                	push   $0x0
+  802b0a:	e8 1e e8 ff ff       	call   80132d <sys_page_map>
+  802b0f:	83 c4 20             	add    $0x20,%esp
+  802b12:	85 c0                	test   %eax,%eax
+  802b14:	0f 88 fe 00 00 00    	js     802c18 <uspawn+0x31c>
+		sys_page_unmap(0, UTEMP);
+  802b1a:	83 ec 08             	sub    $0x8,%esp
+  802b1d:	68 00 00 40 00       	push   $0x400000
+  802b22:	6a 00                	push   $0x0
+  802b24:	e8 c8 e8 ff ff       	call   8013f1 <sys_page_unmap>
+  802b29:	83 c4 10             	add    $0x10,%esp
+	     va += PGSIZE) {
+  802b2c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+	for (va = ROUNDDOWN(ph->p_va, PGSIZE); va < ph->p_va + ph->p_memsz;
+  802b32:	8b 47 14             	mov    0x14(%edi),%eax
+  802b35:	03 47 08             	add    0x8(%edi),%eax
+  802b38:	39 c3                	cmp    %eax,%ebx
+  802b3a:	73 4a                	jae    802b86 <uspawn+0x28a>
+		if (va >= data_end) {
+  802b3c:	39 f3                	cmp    %esi,%ebx
+  802b3e:	0f 82 62 ff ff ff    	jb     802aa6 <uspawn+0x1aa>
+			if ((r = sys_page_alloc(child, (void *) va,
+  802b44:	83 ec 04             	sub    $0x4,%esp
+  802b47:	6a 07                	push   $0x7
+  802b49:	53                   	push   %ebx
+  802b4a:	ff 75 94             	push   -0x6c(%ebp)
+  802b4d:	e8 15 e7 ff ff       	call   801267 <sys_page_alloc>
+  802b52:	83 c4 10             	add    $0x10,%esp
+  802b55:	85 c0                	test   %eax,%eax
+  802b57:	79 d3                	jns    802b2c <uspawn+0x230>
+  802b59:	89 c6                	mov    %eax,%esi
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+		goto error;
+	return child;
+
+error:
+	sys_page_unmap(0, UTEMP);
+  802b5b:	83 ec 08             	sub    $0x8,%esp
+  802b5e:	68 00 00 40 00       	push   $0x400000
+  802b63:	6a 00                	push   $0x0
+  802b65:	e8 87 e8 ff ff       	call   8013f1 <sys_page_unmap>
+	sys_env_destroy(child);
+  802b6a:	83 c4 04             	add    $0x4,%esp
+  802b6d:	ff 75 88             	push   -0x78(%ebp)
+  802b70:	e8 91 e5 ff ff       	call   801106 <sys_env_destroy>
+	return r;
+  802b75:	83 c4 10             	add    $0x10,%esp
+  802b78:	89 75 94             	mov    %esi,-0x6c(%ebp)
+}
+  802b7b:	8b 45 94             	mov    -0x6c(%ebp),%eax
+  802b7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b81:	5b                   	pop    %ebx
+  802b82:	5e                   	pop    %esi
+  802b83:	5f                   	pop    %edi
+  802b84:	5d                   	pop    %ebp
+  802b85:	c3                   	ret
+  802b86:	8b 4d 8c             	mov    -0x74(%ebp),%ecx
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802b89:	83 c1 01             	add    $0x1,%ecx
+  802b8c:	83 c7 20             	add    $0x20,%edi
+  802b8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b92:	0f b7 40 2c          	movzwl 0x2c(%eax),%eax
+  802b96:	39 c8                	cmp    %ecx,%eax
+  802b98:	7e 2d                	jle    802bc7 <uspawn+0x2cb>
+		if (ph->p_type != ELF_PROG_LOAD)
+  802b9a:	83 3f 01             	cmpl   $0x1,(%edi)
+  802b9d:	75 ea                	jne    802b89 <uspawn+0x28d>
+		if (ph->p_filesz > ph->p_memsz
+  802b9f:	8b 77 10             	mov    0x10(%edi),%esi
+  802ba2:	39 77 14             	cmp    %esi,0x14(%edi)
+  802ba5:	72 56                	jb     802bfd <uspawn+0x301>
+		    || ph->p_offset + ph->p_filesz > size) {
+  802ba7:	8b 47 04             	mov    0x4(%edi),%eax
+  802baa:	89 45 90             	mov    %eax,-0x70(%ebp)
+  802bad:	01 f0                	add    %esi,%eax
+  802baf:	39 45 0c             	cmp    %eax,0xc(%ebp)
+  802bb2:	72 53                	jb     802c07 <uspawn+0x30b>
+	uintptr_t data_end = ph->p_va + ph->p_filesz;
+  802bb4:	8b 5f 08             	mov    0x8(%edi),%ebx
+  802bb7:	01 de                	add    %ebx,%esi
+	for (va = ROUNDDOWN(ph->p_va, PGSIZE); va < ph->p_va + ph->p_memsz;
+  802bb9:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802bbf:	89 4d 8c             	mov    %ecx,-0x74(%ebp)
+  802bc2:	e9 6b ff ff ff       	jmp    802b32 <uspawn+0x236>
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  802bc7:	83 ec 08             	sub    $0x8,%esp
+  802bca:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+  802bcd:	50                   	push   %eax
+  802bce:	8b 7d 88             	mov    -0x78(%ebp),%edi
+  802bd1:	57                   	push   %edi
+  802bd2:	e8 c7 eb ff ff       	call   80179e <sys_env_set_trapframe>
+  802bd7:	89 c6                	mov    %eax,%esi
+  802bd9:	83 c4 10             	add    $0x10,%esp
+  802bdc:	85 c0                	test   %eax,%eax
+  802bde:	0f 88 77 ff ff ff    	js     802b5b <uspawn+0x25f>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  802be4:	83 ec 08             	sub    $0x8,%esp
+  802be7:	6a 02                	push   $0x2
+  802be9:	57                   	push   %edi
+  802bea:	e8 29 ea ff ff       	call   801618 <sys_env_set_status>
+  802bef:	89 c6                	mov    %eax,%esi
+  802bf1:	83 c4 10             	add    $0x10,%esp
+  802bf4:	85 c0                	test   %eax,%eax
+  802bf6:	79 83                	jns    802b7b <uspawn+0x27f>
+  802bf8:	e9 5e ff ff ff       	jmp    802b5b <uspawn+0x25f>
+			r = -E_NOT_EXEC;
+  802bfd:	be f7 ff ff ff       	mov    $0xfffffff7,%esi
+  802c02:	e9 54 ff ff ff       	jmp    802b5b <uspawn+0x25f>
+  802c07:	be f7 ff ff ff       	mov    $0xfffffff7,%esi
+  802c0c:	e9 4a ff ff ff       	jmp    802b5b <uspawn+0x25f>
+  802c11:	89 c6                	mov    %eax,%esi
+  802c13:	e9 43 ff ff ff       	jmp    802b5b <uspawn+0x25f>
+  802c18:	89 c6                	mov    %eax,%esi
+  802c1a:	e9 3c ff ff ff       	jmp    802b5b <uspawn+0x25f>
+		return -E_NOT_EXEC;
+  802c1f:	c7 45 94 f7 ff ff ff 	movl   $0xfffffff7,-0x6c(%ebp)
+  802c26:	e9 50 ff ff ff       	jmp    802b7b <uspawn+0x27f>
+  802c2b:	c7 45 94 f7 ff ff ff 	movl   $0xfffffff7,-0x6c(%ebp)
+  802c32:	e9 44 ff ff ff       	jmp    802b7b <uspawn+0x27f>
+  802c37:	c7 45 94 f7 ff ff ff 	movl   $0xfffffff7,-0x6c(%ebp)
+  802c3e:	e9 38 ff ff ff       	jmp    802b7b <uspawn+0x27f>
+		return -E_INVAL;
+  802c43:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+  802c48:	e9 0e ff ff ff       	jmp    802b5b <uspawn+0x25f>
+	sys_page_unmap(0, UTEMP);
+  802c4d:	83 ec 08             	sub    $0x8,%esp
+  802c50:	68 00 00 40 00       	push   $0x400000
+  802c55:	6a 00                	push   $0x0
+  802c57:	e8 95 e7 ff ff       	call   8013f1 <sys_page_unmap>
+  802c5c:	83 c4 10             	add    $0x10,%esp
+  802c5f:	e9 f7 fe ff ff       	jmp    802b5b <uspawn+0x25f>
+
+00802c64 <dm>:
+  802c64:	55                   	push   %ebp
+  802c65:	57                   	push   %edi
+  802c66:	56                   	push   %esi
+  802c67:	53                   	push   %ebx
+  802c68:	83 ec 24             	sub    $0x24,%esp
+  802c6b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802c6f:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802c73:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802c77:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802c7b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802c7f:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802c83:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802c87:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c8c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c91:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802c96:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802c9d:	00 
+  802c9e:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802ca5:	00 
+  802ca6:	89 fb                	mov    %edi,%ebx
+  802ca8:	eb 08                	jmp    802cb2 <dm+0x4e>
+  802caa:	83 e9 01             	sub    $0x1,%ecx
+  802cad:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802cb0:	74 68                	je     802d1a <dm+0xb6>
+  802cb2:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802cb6:	01 c0                	add    %eax,%eax
+  802cb8:	89 c6                	mov    %eax,%esi
+  802cba:	89 d7                	mov    %edx,%edi
+  802cbc:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802cc0:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802cc4:	0f ad d0             	shrd   %cl,%edx,%eax
+  802cc7:	d3 ea                	shr    %cl,%edx
+  802cc9:	f6 c1 20             	test   $0x20,%cl
+  802ccc:	74 04                	je     802cd2 <dm+0x6e>
+  802cce:	89 d0                	mov    %edx,%eax
+  802cd0:	31 d2                	xor    %edx,%edx
+  802cd2:	83 e0 01             	and    $0x1,%eax
+  802cd5:	89 04 24             	mov    %eax,(%esp)
+  802cd8:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802cdf:	00 
+  802ce0:	8b 04 24             	mov    (%esp),%eax
+  802ce3:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802ce7:	09 f0                	or     %esi,%eax
+  802ce9:	09 fa                	or     %edi,%edx
+  802ceb:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802cef:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802cf3:	39 f0                	cmp    %esi,%eax
+  802cf5:	89 d5                	mov    %edx,%ebp
+  802cf7:	19 fd                	sbb    %edi,%ebp
+  802cf9:	72 af                	jb     802caa <dm+0x46>
+  802cfb:	29 f0                	sub    %esi,%eax
+  802cfd:	19 fa                	sbb    %edi,%edx
+  802cff:	89 cf                	mov    %ecx,%edi
+  802d01:	c1 ef 05             	shr    $0x5,%edi
+  802d04:	83 e7 01             	and    $0x1,%edi
+  802d07:	89 fe                	mov    %edi,%esi
+  802d09:	83 f6 01             	xor    $0x1,%esi
+  802d0c:	d3 e6                	shl    %cl,%esi
+  802d0e:	d3 e7                	shl    %cl,%edi
+  802d10:	09 74 24 18          	or     %esi,0x18(%esp)
+  802d14:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802d18:	eb 90                	jmp    802caa <dm+0x46>
+  802d1a:	85 db                	test   %ebx,%ebx
+  802d1c:	74 05                	je     802d23 <dm+0xbf>
+  802d1e:	89 03                	mov    %eax,(%ebx)
+  802d20:	89 53 04             	mov    %edx,0x4(%ebx)
+  802d23:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802d27:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802d2b:	83 c4 24             	add    $0x24,%esp
+  802d2e:	5b                   	pop    %ebx
+  802d2f:	5e                   	pop    %esi
+  802d30:	5f                   	pop    %edi
+  802d31:	5d                   	pop    %ebp
+  802d32:	c3                   	ret
+
+00802d33 <__udivdi3>:
+  802d33:	83 ec 08             	sub    $0x8,%esp
+  802d36:	6a 00                	push   $0x0
+  802d38:	ff 74 24 1c          	push   0x1c(%esp)
+  802d3c:	ff 74 24 1c          	push   0x1c(%esp)
+  802d40:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802d44:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802d48:	e8 17 ff ff ff       	call   802c64 <dm>
+  802d4d:	83 c4 14             	add    $0x14,%esp
+  802d50:	c3                   	ret
+
+00802d51 <__umoddi3>:
+  802d51:	83 ec 18             	sub    $0x18,%esp
+  802d54:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802d58:	50                   	push   %eax
+  802d59:	ff 74 24 2c          	push   0x2c(%esp)
+  802d5d:	ff 74 24 2c          	push   0x2c(%esp)
+  802d61:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802d65:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802d69:	e8 f6 fe ff ff       	call   802c64 <dm>
+  802d6e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802d72:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802d76:	83 c4 24             	add    $0x24,%esp
+  802d79:	c3                   	ret
+
+00802d7a <__divdi3>:
+  802d7a:	53                   	push   %ebx
+  802d7b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802d7f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802d83:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  802d87:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  802d8b:	85 d2                	test   %edx,%edx
+  802d8d:	78 15                	js     802da4 <__divdi3+0x2a>
+  802d8f:	85 db                	test   %ebx,%ebx
+  802d91:	78 34                	js     802dc7 <__divdi3+0x4d>
+  802d93:	83 ec 04             	sub    $0x4,%esp
+  802d96:	6a 00                	push   $0x0
+  802d98:	53                   	push   %ebx
+  802d99:	51                   	push   %ecx
+  802d9a:	e8 c5 fe ff ff       	call   802c64 <dm>
+  802d9f:	83 c4 10             	add    $0x10,%esp
+  802da2:	eb 21                	jmp    802dc5 <__divdi3+0x4b>
+  802da4:	f7 d8                	neg    %eax
+  802da6:	83 d2 00             	adc    $0x0,%edx
+  802da9:	f7 da                	neg    %edx
+  802dab:	85 db                	test   %ebx,%ebx
+  802dad:	78 30                	js     802ddf <__divdi3+0x65>
+  802daf:	83 ec 04             	sub    $0x4,%esp
+  802db2:	6a 00                	push   $0x0
+  802db4:	53                   	push   %ebx
+  802db5:	51                   	push   %ecx
+  802db6:	e8 a9 fe ff ff       	call   802c64 <dm>
+  802dbb:	83 c4 10             	add    $0x10,%esp
+  802dbe:	f7 d8                	neg    %eax
+  802dc0:	83 d2 00             	adc    $0x0,%edx
+  802dc3:	f7 da                	neg    %edx
+  802dc5:	5b                   	pop    %ebx
+  802dc6:	c3                   	ret
+  802dc7:	83 ec 04             	sub    $0x4,%esp
+  802dca:	6a 00                	push   $0x0
+  802dcc:	f7 d9                	neg    %ecx
+  802dce:	83 d3 00             	adc    $0x0,%ebx
+  802dd1:	f7 db                	neg    %ebx
+  802dd3:	53                   	push   %ebx
+  802dd4:	51                   	push   %ecx
+  802dd5:	e8 8a fe ff ff       	call   802c64 <dm>
+  802dda:	83 c4 10             	add    $0x10,%esp
+  802ddd:	eb df                	jmp    802dbe <__divdi3+0x44>
+  802ddf:	83 ec 04             	sub    $0x4,%esp
+  802de2:	6a 00                	push   $0x0
+  802de4:	f7 d9                	neg    %ecx
+  802de6:	83 d3 00             	adc    $0x0,%ebx
+  802de9:	f7 db                	neg    %ebx
+  802deb:	53                   	push   %ebx
+  802dec:	51                   	push   %ecx
+  802ded:	e8 72 fe ff ff       	call   802c64 <dm>
+  802df2:	83 c4 10             	add    $0x10,%esp
+  802df5:	eb ce                	jmp    802dc5 <__divdi3+0x4b>
+
+00802df7 <__moddi3>:
+  802df7:	55                   	push   %ebp
+  802df8:	57                   	push   %edi
+  802df9:	56                   	push   %esi
+  802dfa:	53                   	push   %ebx
+  802dfb:	83 ec 18             	sub    $0x18,%esp
+  802dfe:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802e02:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802e06:	89 f1                	mov    %esi,%ecx
+  802e08:	f7 d9                	neg    %ecx
+  802e0a:	89 da                	mov    %ebx,%edx
+  802e0c:	83 d2 00             	adc    $0x0,%edx
+  802e0f:	f7 da                	neg    %edx
+  802e11:	0f 48 ce             	cmovs  %esi,%ecx
+  802e14:	0f 48 d3             	cmovs  %ebx,%edx
+  802e17:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802e1b:	50                   	push   %eax
+  802e1c:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802e20:	f7 de                	neg    %esi
+  802e22:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802e26:	83 d0 00             	adc    $0x0,%eax
+  802e29:	f7 d8                	neg    %eax
+  802e2b:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802e30:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802e35:	50                   	push   %eax
+  802e36:	56                   	push   %esi
+  802e37:	89 c8                	mov    %ecx,%eax
+  802e39:	e8 26 fe ff ff       	call   802c64 <dm>
+  802e3e:	83 c4 10             	add    $0x10,%esp
+  802e41:	85 db                	test   %ebx,%ebx
+  802e43:	78 10                	js     802e55 <__moddi3+0x5e>
+  802e45:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802e49:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802e4d:	83 c4 14             	add    $0x14,%esp
+  802e50:	5b                   	pop    %ebx
+  802e51:	5e                   	pop    %esi
+  802e52:	5f                   	pop    %edi
+  802e53:	5d                   	pop    %ebp
+  802e54:	c3                   	ret
+  802e55:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802e59:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802e5d:	f7 d8                	neg    %eax
+  802e5f:	83 d2 00             	adc    $0x0,%edx
+  802e62:	f7 da                	neg    %edx
+  802e64:	eb e7                	jmp    802e4d <__moddi3+0x56>
@@ -0,0 +1,5656 @@
+
+obj/user/spin:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 84 00 00 00       	call   8000b5 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 10             	sub    $0x10,%esp
+	envid_t env;
+
+	cprintf("I am the parent.  Forking the child...\n");
+  80003a:	68 60 2c 80 00       	push   $0x802c60
+  80003f:	e8 61 01 00 00       	call   8001a5 <cprintf>
+	if ((env = fork()) == 0) {
+  800044:	e8 b1 28 00 00       	call   8028fa <fork>
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	85 c0                	test   %eax,%eax
+  80004e:	75 12                	jne    800062 <umain+0x2f>
+		cprintf("I am the child.  Spinning...\n");
+  800050:	83 ec 0c             	sub    $0xc,%esp
+  800053:	68 d8 2c 80 00       	push   $0x802cd8
+  800058:	e8 48 01 00 00       	call   8001a5 <cprintf>
+  80005d:	83 c4 10             	add    $0x10,%esp
+		while (1)
+  800060:	eb fe                	jmp    800060 <umain+0x2d>
+  800062:	89 c3                	mov    %eax,%ebx
+			/* do nothing */;
+	}
+
+	cprintf("I am the parent.  Running the child...\n");
+  800064:	83 ec 0c             	sub    $0xc,%esp
+  800067:	68 88 2c 80 00       	push   $0x802c88
+  80006c:	e8 34 01 00 00       	call   8001a5 <cprintf>
+	sys_yield();
+  800071:	e8 64 12 00 00       	call   8012da <sys_yield>
+	sys_yield();
+  800076:	e8 5f 12 00 00       	call   8012da <sys_yield>
+	sys_yield();
+  80007b:	e8 5a 12 00 00       	call   8012da <sys_yield>
+	sys_yield();
+  800080:	e8 55 12 00 00       	call   8012da <sys_yield>
+	sys_yield();
+  800085:	e8 50 12 00 00       	call   8012da <sys_yield>
+	sys_yield();
+  80008a:	e8 4b 12 00 00       	call   8012da <sys_yield>
+	sys_yield();
+  80008f:	e8 46 12 00 00       	call   8012da <sys_yield>
+	sys_yield();
+  800094:	e8 41 12 00 00       	call   8012da <sys_yield>
+
+	cprintf("I am the parent.  Killing the child...\n");
+  800099:	c7 04 24 b0 2c 80 00 	movl   $0x802cb0,(%esp)
+  8000a0:	e8 00 01 00 00       	call   8001a5 <cprintf>
+	sys_env_destroy(env);
+  8000a5:	89 1c 24             	mov    %ebx,(%esp)
+  8000a8:	e8 ba 0d 00 00       	call   800e67 <sys_env_destroy>
+}
+  8000ad:	83 c4 10             	add    $0x10,%esp
+  8000b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000b3:	c9                   	leave
+  8000b4:	c3                   	ret
+
+008000b5 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000b5:	55                   	push   %ebp
+  8000b6:	89 e5                	mov    %esp,%ebp
+  8000b8:	56                   	push   %esi
+  8000b9:	53                   	push   %ebx
+  8000ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000bd:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  8000c0:	e8 64 0e 00 00       	call   800f29 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  8000c5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000ca:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  8000d0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000d5:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000da:	85 db                	test   %ebx,%ebx
+  8000dc:	7e 07                	jle    8000e5 <libmain+0x30>
+		binaryname = argv[0];
+  8000de:	8b 06                	mov    (%esi),%eax
+  8000e0:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000e5:	83 ec 08             	sub    $0x8,%esp
+  8000e8:	56                   	push   %esi
+  8000e9:	53                   	push   %ebx
+  8000ea:	e8 44 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000ef:	e8 0a 00 00 00       	call   8000fe <exit>
+}
+  8000f4:	83 c4 10             	add    $0x10,%esp
+  8000f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000fa:	5b                   	pop    %ebx
+  8000fb:	5e                   	pop    %esi
+  8000fc:	5d                   	pop    %ebp
+  8000fd:	c3                   	ret
+
+008000fe <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000fe:	55                   	push   %ebp
+  8000ff:	89 e5                	mov    %esp,%ebp
+  800101:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  800104:	6a 00                	push   $0x0
+  800106:	e8 5c 0d 00 00       	call   800e67 <sys_env_destroy>
+}
+  80010b:	83 c4 10             	add    $0x10,%esp
+  80010e:	c9                   	leave
+  80010f:	c3                   	ret
+
+00800110 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800110:	55                   	push   %ebp
+  800111:	89 e5                	mov    %esp,%ebp
+  800113:	53                   	push   %ebx
+  800114:	83 ec 04             	sub    $0x4,%esp
+  800117:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80011a:	8b 13                	mov    (%ebx),%edx
+  80011c:	8d 42 01             	lea    0x1(%edx),%eax
+  80011f:	89 03                	mov    %eax,(%ebx)
+  800121:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800124:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800128:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80012d:	74 09                	je     800138 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80012f:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800133:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800136:	c9                   	leave
+  800137:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800138:	83 ec 08             	sub    $0x8,%esp
+  80013b:	68 ff 00 00 00       	push   $0xff
+  800140:	8d 43 08             	lea    0x8(%ebx),%eax
+  800143:	50                   	push   %eax
+  800144:	e8 e2 0b 00 00       	call   800d2b <sys_cputs>
+		b->idx = 0;
+  800149:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80014f:	83 c4 10             	add    $0x10,%esp
+  800152:	eb db                	jmp    80012f <putch+0x1f>
+
+00800154 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800154:	55                   	push   %ebp
+  800155:	89 e5                	mov    %esp,%ebp
+  800157:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80015d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800164:	00 00 00 
+	b.cnt = 0;
+  800167:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80016e:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800171:	ff 75 0c             	push   0xc(%ebp)
+  800174:	ff 75 08             	push   0x8(%ebp)
+  800177:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80017d:	50                   	push   %eax
+  80017e:	68 10 01 80 00       	push   $0x800110
+  800183:	e8 14 01 00 00       	call   80029c <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800188:	83 c4 08             	add    $0x8,%esp
+  80018b:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800191:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800197:	50                   	push   %eax
+  800198:	e8 8e 0b 00 00       	call   800d2b <sys_cputs>
+
+	return b.cnt;
+}
+  80019d:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001a3:	c9                   	leave
+  8001a4:	c3                   	ret
+
+008001a5 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001a5:	55                   	push   %ebp
+  8001a6:	89 e5                	mov    %esp,%ebp
+  8001a8:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001ab:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001ae:	50                   	push   %eax
+  8001af:	ff 75 08             	push   0x8(%ebp)
+  8001b2:	e8 9d ff ff ff       	call   800154 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001b7:	c9                   	leave
+  8001b8:	c3                   	ret
+
+008001b9 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001b9:	55                   	push   %ebp
+  8001ba:	89 e5                	mov    %esp,%ebp
+  8001bc:	57                   	push   %edi
+  8001bd:	56                   	push   %esi
+  8001be:	53                   	push   %ebx
+  8001bf:	83 ec 1c             	sub    $0x1c,%esp
+  8001c2:	89 c7                	mov    %eax,%edi
+  8001c4:	89 d6                	mov    %edx,%esi
+  8001c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001c9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001cc:	89 d1                	mov    %edx,%ecx
+  8001ce:	89 c2                	mov    %eax,%edx
+  8001d0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001d3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001d6:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001d9:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001dc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001df:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001e6:	39 c2                	cmp    %eax,%edx
+  8001e8:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001eb:	72 3e                	jb     80022b <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001ed:	83 ec 0c             	sub    $0xc,%esp
+  8001f0:	ff 75 18             	push   0x18(%ebp)
+  8001f3:	83 eb 01             	sub    $0x1,%ebx
+  8001f6:	53                   	push   %ebx
+  8001f7:	50                   	push   %eax
+  8001f8:	83 ec 08             	sub    $0x8,%esp
+  8001fb:	ff 75 e4             	push   -0x1c(%ebp)
+  8001fe:	ff 75 e0             	push   -0x20(%ebp)
+  800201:	ff 75 dc             	push   -0x24(%ebp)
+  800204:	ff 75 d8             	push   -0x28(%ebp)
+  800207:	e8 1c 29 00 00       	call   802b28 <__udivdi3>
+  80020c:	83 c4 18             	add    $0x18,%esp
+  80020f:	52                   	push   %edx
+  800210:	50                   	push   %eax
+  800211:	89 f2                	mov    %esi,%edx
+  800213:	89 f8                	mov    %edi,%eax
+  800215:	e8 9f ff ff ff       	call   8001b9 <printnum>
+  80021a:	83 c4 20             	add    $0x20,%esp
+  80021d:	eb 13                	jmp    800232 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80021f:	83 ec 08             	sub    $0x8,%esp
+  800222:	56                   	push   %esi
+  800223:	ff 75 18             	push   0x18(%ebp)
+  800226:	ff d7                	call   *%edi
+  800228:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80022b:	83 eb 01             	sub    $0x1,%ebx
+  80022e:	85 db                	test   %ebx,%ebx
+  800230:	7f ed                	jg     80021f <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800232:	83 ec 08             	sub    $0x8,%esp
+  800235:	56                   	push   %esi
+  800236:	83 ec 04             	sub    $0x4,%esp
+  800239:	ff 75 e4             	push   -0x1c(%ebp)
+  80023c:	ff 75 e0             	push   -0x20(%ebp)
+  80023f:	ff 75 dc             	push   -0x24(%ebp)
+  800242:	ff 75 d8             	push   -0x28(%ebp)
+  800245:	e8 fc 28 00 00       	call   802b46 <__umoddi3>
+  80024a:	83 c4 14             	add    $0x14,%esp
+  80024d:	0f be 80 00 2d 80 00 	movsbl 0x802d00(%eax),%eax
+  800254:	50                   	push   %eax
+  800255:	ff d7                	call   *%edi
+}
+  800257:	83 c4 10             	add    $0x10,%esp
+  80025a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80025d:	5b                   	pop    %ebx
+  80025e:	5e                   	pop    %esi
+  80025f:	5f                   	pop    %edi
+  800260:	5d                   	pop    %ebp
+  800261:	c3                   	ret
+
+00800262 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800262:	55                   	push   %ebp
+  800263:	89 e5                	mov    %esp,%ebp
+  800265:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800268:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80026c:	8b 10                	mov    (%eax),%edx
+  80026e:	3b 50 04             	cmp    0x4(%eax),%edx
+  800271:	73 0a                	jae    80027d <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800273:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800276:	89 08                	mov    %ecx,(%eax)
+  800278:	8b 45 08             	mov    0x8(%ebp),%eax
+  80027b:	88 02                	mov    %al,(%edx)
+}
+  80027d:	5d                   	pop    %ebp
+  80027e:	c3                   	ret
+
+0080027f <printfmt>:
+{
+  80027f:	55                   	push   %ebp
+  800280:	89 e5                	mov    %esp,%ebp
+  800282:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800285:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800288:	50                   	push   %eax
+  800289:	ff 75 10             	push   0x10(%ebp)
+  80028c:	ff 75 0c             	push   0xc(%ebp)
+  80028f:	ff 75 08             	push   0x8(%ebp)
+  800292:	e8 05 00 00 00       	call   80029c <vprintfmt>
+}
+  800297:	83 c4 10             	add    $0x10,%esp
+  80029a:	c9                   	leave
+  80029b:	c3                   	ret
+
+0080029c <vprintfmt>:
+{
+  80029c:	55                   	push   %ebp
+  80029d:	89 e5                	mov    %esp,%ebp
+  80029f:	57                   	push   %edi
+  8002a0:	56                   	push   %esi
+  8002a1:	53                   	push   %ebx
+  8002a2:	83 ec 2c             	sub    $0x2c,%esp
+  8002a5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002a8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002ab:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002ae:	eb 0a                	jmp    8002ba <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002b0:	83 ec 08             	sub    $0x8,%esp
+  8002b3:	53                   	push   %ebx
+  8002b4:	50                   	push   %eax
+  8002b5:	ff d6                	call   *%esi
+  8002b7:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002ba:	83 c7 01             	add    $0x1,%edi
+  8002bd:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002c1:	83 f8 25             	cmp    $0x25,%eax
+  8002c4:	74 0c                	je     8002d2 <vprintfmt+0x36>
+			if (ch == '\0')
+  8002c6:	85 c0                	test   %eax,%eax
+  8002c8:	75 e6                	jne    8002b0 <vprintfmt+0x14>
+}
+  8002ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002cd:	5b                   	pop    %ebx
+  8002ce:	5e                   	pop    %esi
+  8002cf:	5f                   	pop    %edi
+  8002d0:	5d                   	pop    %ebp
+  8002d1:	c3                   	ret
+		padc = ' ';
+  8002d2:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002d6:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002dd:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002e4:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8002f0:	8d 47 01             	lea    0x1(%edi),%eax
+  8002f3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002f6:	0f b6 17             	movzbl (%edi),%edx
+  8002f9:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002fc:	3c 55                	cmp    $0x55,%al
+  8002fe:	0f 87 cf 03 00 00    	ja     8006d3 <vprintfmt+0x437>
+  800304:	0f b6 c0             	movzbl %al,%eax
+  800307:	ff 24 85 e0 2d 80 00 	jmp    *0x802de0(,%eax,4)
+  80030e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800311:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800315:	eb d9                	jmp    8002f0 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800317:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80031a:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80031e:	eb d0                	jmp    8002f0 <vprintfmt+0x54>
+  800320:	0f b6 d2             	movzbl %dl,%edx
+  800323:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800326:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80032e:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800331:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800335:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800338:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80033b:	83 f9 09             	cmp    $0x9,%ecx
+  80033e:	77 55                	ja     800395 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800340:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800343:	eb e9                	jmp    80032e <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800345:	8b 45 14             	mov    0x14(%ebp),%eax
+  800348:	8b 00                	mov    (%eax),%eax
+  80034a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80034d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800350:	8d 40 04             	lea    0x4(%eax),%eax
+  800353:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800356:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800359:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80035d:	79 91                	jns    8002f0 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80035f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800362:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800365:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80036c:	eb 82                	jmp    8002f0 <vprintfmt+0x54>
+			if (width < 0)
+  80036e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800371:	85 d2                	test   %edx,%edx
+  800373:	b8 00 00 00 00       	mov    $0x0,%eax
+  800378:	0f 49 c2             	cmovns %edx,%eax
+  80037b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80037e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800381:	e9 6a ff ff ff       	jmp    8002f0 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800386:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800389:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800390:	e9 5b ff ff ff       	jmp    8002f0 <vprintfmt+0x54>
+  800395:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800398:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80039b:	eb bc                	jmp    800359 <vprintfmt+0xbd>
+			lflag++;
+  80039d:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003a3:	e9 48 ff ff ff       	jmp    8002f0 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ab:	8d 78 04             	lea    0x4(%eax),%edi
+  8003ae:	83 ec 08             	sub    $0x8,%esp
+  8003b1:	53                   	push   %ebx
+  8003b2:	ff 30                	push   (%eax)
+  8003b4:	ff d6                	call   *%esi
+			break;
+  8003b6:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003b9:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003bc:	e9 b1 02 00 00       	jmp    800672 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8003c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c4:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003c7:	8b 10                	mov    (%eax),%edx
+  8003c9:	89 d0                	mov    %edx,%eax
+  8003cb:	f7 d8                	neg    %eax
+  8003cd:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003d0:	83 f8 0d             	cmp    $0xd,%eax
+  8003d3:	7f 23                	jg     8003f8 <vprintfmt+0x15c>
+  8003d5:	8b 14 85 40 2f 80 00 	mov    0x802f40(,%eax,4),%edx
+  8003dc:	85 d2                	test   %edx,%edx
+  8003de:	74 18                	je     8003f8 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003e0:	52                   	push   %edx
+  8003e1:	68 21 2d 80 00       	push   $0x802d21
+  8003e6:	53                   	push   %ebx
+  8003e7:	56                   	push   %esi
+  8003e8:	e8 92 fe ff ff       	call   80027f <printfmt>
+  8003ed:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003f0:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003f3:	e9 7a 02 00 00       	jmp    800672 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8003f8:	50                   	push   %eax
+  8003f9:	68 18 2d 80 00       	push   $0x802d18
+  8003fe:	53                   	push   %ebx
+  8003ff:	56                   	push   %esi
+  800400:	e8 7a fe ff ff       	call   80027f <printfmt>
+  800405:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800408:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80040b:	e9 62 02 00 00       	jmp    800672 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800410:	8b 45 14             	mov    0x14(%ebp),%eax
+  800413:	83 c0 04             	add    $0x4,%eax
+  800416:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800419:	8b 45 14             	mov    0x14(%ebp),%eax
+  80041c:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80041e:	85 c9                	test   %ecx,%ecx
+  800420:	b8 11 2d 80 00       	mov    $0x802d11,%eax
+  800425:	0f 45 c1             	cmovne %ecx,%eax
+  800428:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80042b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80042f:	7e 06                	jle    800437 <vprintfmt+0x19b>
+  800431:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800435:	75 0b                	jne    800442 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800437:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80043a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80043d:	89 75 08             	mov    %esi,0x8(%ebp)
+  800440:	eb 5c                	jmp    80049e <vprintfmt+0x202>
+  800442:	83 ec 08             	sub    $0x8,%esp
+  800445:	ff 75 d0             	push   -0x30(%ebp)
+  800448:	ff 75 cc             	push   -0x34(%ebp)
+  80044b:	e8 20 03 00 00       	call   800770 <strnlen>
+  800450:	89 c2                	mov    %eax,%edx
+  800452:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800455:	29 d0                	sub    %edx,%eax
+  800457:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80045a:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80045e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800461:	89 75 08             	mov    %esi,0x8(%ebp)
+  800464:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800466:	eb 0e                	jmp    800476 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800468:	83 ec 08             	sub    $0x8,%esp
+  80046b:	53                   	push   %ebx
+  80046c:	57                   	push   %edi
+  80046d:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800470:	83 ee 01             	sub    $0x1,%esi
+  800473:	83 c4 10             	add    $0x10,%esp
+  800476:	85 f6                	test   %esi,%esi
+  800478:	7f ee                	jg     800468 <vprintfmt+0x1cc>
+  80047a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80047d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800480:	85 c0                	test   %eax,%eax
+  800482:	ba 00 00 00 00       	mov    $0x0,%edx
+  800487:	0f 49 d0             	cmovns %eax,%edx
+  80048a:	29 d0                	sub    %edx,%eax
+  80048c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80048f:	eb a6                	jmp    800437 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800491:	83 ec 08             	sub    $0x8,%esp
+  800494:	53                   	push   %ebx
+  800495:	52                   	push   %edx
+  800496:	ff 55 08             	call   *0x8(%ebp)
+  800499:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80049c:	89 f1                	mov    %esi,%ecx
+  80049e:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004a1:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004a5:	0f be d0             	movsbl %al,%edx
+  8004a8:	85 d2                	test   %edx,%edx
+  8004aa:	74 28                	je     8004d4 <vprintfmt+0x238>
+  8004ac:	85 ff                	test   %edi,%edi
+  8004ae:	78 05                	js     8004b5 <vprintfmt+0x219>
+  8004b0:	83 ef 01             	sub    $0x1,%edi
+  8004b3:	78 30                	js     8004e5 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004b5:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004b9:	74 d6                	je     800491 <vprintfmt+0x1f5>
+  8004bb:	0f be c0             	movsbl %al,%eax
+  8004be:	83 e8 20             	sub    $0x20,%eax
+  8004c1:	83 f8 5e             	cmp    $0x5e,%eax
+  8004c4:	76 cb                	jbe    800491 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004c6:	83 ec 08             	sub    $0x8,%esp
+  8004c9:	53                   	push   %ebx
+  8004ca:	6a 3f                	push   $0x3f
+  8004cc:	ff 55 08             	call   *0x8(%ebp)
+  8004cf:	83 c4 10             	add    $0x10,%esp
+  8004d2:	eb c8                	jmp    80049c <vprintfmt+0x200>
+  8004d4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004d7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004da:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004dd:	01 d0                	add    %edx,%eax
+  8004df:	29 c8                	sub    %ecx,%eax
+  8004e1:	89 c7                	mov    %eax,%edi
+  8004e3:	eb 13                	jmp    8004f8 <vprintfmt+0x25c>
+  8004e5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004e8:	eb ed                	jmp    8004d7 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004ea:	83 ec 08             	sub    $0x8,%esp
+  8004ed:	53                   	push   %ebx
+  8004ee:	6a 20                	push   $0x20
+  8004f0:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004f2:	83 ef 01             	sub    $0x1,%edi
+  8004f5:	83 c4 10             	add    $0x10,%esp
+  8004f8:	85 ff                	test   %edi,%edi
+  8004fa:	7f ee                	jg     8004ea <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004fc:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004ff:	89 45 14             	mov    %eax,0x14(%ebp)
+  800502:	e9 6b 01 00 00       	jmp    800672 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800507:	83 f9 01             	cmp    $0x1,%ecx
+  80050a:	7f 1f                	jg     80052b <vprintfmt+0x28f>
+	else if (lflag)
+  80050c:	85 c9                	test   %ecx,%ecx
+  80050e:	74 67                	je     800577 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800510:	8b 45 14             	mov    0x14(%ebp),%eax
+  800513:	8b 00                	mov    (%eax),%eax
+  800515:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800518:	89 c1                	mov    %eax,%ecx
+  80051a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80051d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800520:	8b 45 14             	mov    0x14(%ebp),%eax
+  800523:	8d 40 04             	lea    0x4(%eax),%eax
+  800526:	89 45 14             	mov    %eax,0x14(%ebp)
+  800529:	eb 17                	jmp    800542 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80052b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052e:	8b 50 04             	mov    0x4(%eax),%edx
+  800531:	8b 00                	mov    (%eax),%eax
+  800533:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800536:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800539:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053c:	8d 40 08             	lea    0x8(%eax),%eax
+  80053f:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800542:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800545:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800548:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80054d:	85 c9                	test   %ecx,%ecx
+  80054f:	0f 89 03 01 00 00    	jns    800658 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800555:	83 ec 08             	sub    $0x8,%esp
+  800558:	53                   	push   %ebx
+  800559:	6a 2d                	push   $0x2d
+  80055b:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80055d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800560:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800563:	f7 da                	neg    %edx
+  800565:	83 d1 00             	adc    $0x0,%ecx
+  800568:	f7 d9                	neg    %ecx
+  80056a:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80056d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800572:	e9 e1 00 00 00       	jmp    800658 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800577:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057a:	8b 00                	mov    (%eax),%eax
+  80057c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80057f:	89 c1                	mov    %eax,%ecx
+  800581:	c1 f9 1f             	sar    $0x1f,%ecx
+  800584:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800587:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058a:	8d 40 04             	lea    0x4(%eax),%eax
+  80058d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800590:	eb b0                	jmp    800542 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800592:	83 f9 01             	cmp    $0x1,%ecx
+  800595:	7f 1e                	jg     8005b5 <vprintfmt+0x319>
+	else if (lflag)
+  800597:	85 c9                	test   %ecx,%ecx
+  800599:	74 32                	je     8005cd <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  80059b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059e:	8b 10                	mov    (%eax),%edx
+  8005a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005a5:	8d 40 04             	lea    0x4(%eax),%eax
+  8005a8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005ab:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005b0:	e9 a3 00 00 00       	jmp    800658 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b8:	8b 10                	mov    (%eax),%edx
+  8005ba:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005bd:	8d 40 08             	lea    0x8(%eax),%eax
+  8005c0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005c3:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005c8:	e9 8b 00 00 00       	jmp    800658 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d0:	8b 10                	mov    (%eax),%edx
+  8005d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005d7:	8d 40 04             	lea    0x4(%eax),%eax
+  8005da:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005dd:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005e2:	eb 74                	jmp    800658 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8005e4:	83 f9 01             	cmp    $0x1,%ecx
+  8005e7:	7f 1b                	jg     800604 <vprintfmt+0x368>
+	else if (lflag)
+  8005e9:	85 c9                	test   %ecx,%ecx
+  8005eb:	74 2c                	je     800619 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8005ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f0:	8b 10                	mov    (%eax),%edx
+  8005f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005f7:	8d 40 04             	lea    0x4(%eax),%eax
+  8005fa:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005fd:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800602:	eb 54                	jmp    800658 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800604:	8b 45 14             	mov    0x14(%ebp),%eax
+  800607:	8b 10                	mov    (%eax),%edx
+  800609:	8b 48 04             	mov    0x4(%eax),%ecx
+  80060c:	8d 40 08             	lea    0x8(%eax),%eax
+  80060f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800612:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800617:	eb 3f                	jmp    800658 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800619:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061c:	8b 10                	mov    (%eax),%edx
+  80061e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800623:	8d 40 04             	lea    0x4(%eax),%eax
+  800626:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800629:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80062e:	eb 28                	jmp    800658 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800630:	83 ec 08             	sub    $0x8,%esp
+  800633:	53                   	push   %ebx
+  800634:	6a 30                	push   $0x30
+  800636:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800638:	83 c4 08             	add    $0x8,%esp
+  80063b:	53                   	push   %ebx
+  80063c:	6a 78                	push   $0x78
+  80063e:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800640:	8b 45 14             	mov    0x14(%ebp),%eax
+  800643:	8b 10                	mov    (%eax),%edx
+  800645:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80064a:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80064d:	8d 40 04             	lea    0x4(%eax),%eax
+  800650:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800653:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800658:	83 ec 0c             	sub    $0xc,%esp
+  80065b:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80065f:	50                   	push   %eax
+  800660:	ff 75 e0             	push   -0x20(%ebp)
+  800663:	57                   	push   %edi
+  800664:	51                   	push   %ecx
+  800665:	52                   	push   %edx
+  800666:	89 da                	mov    %ebx,%edx
+  800668:	89 f0                	mov    %esi,%eax
+  80066a:	e8 4a fb ff ff       	call   8001b9 <printnum>
+			break;
+  80066f:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800672:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800675:	e9 40 fc ff ff       	jmp    8002ba <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80067a:	83 f9 01             	cmp    $0x1,%ecx
+  80067d:	7f 1b                	jg     80069a <vprintfmt+0x3fe>
+	else if (lflag)
+  80067f:	85 c9                	test   %ecx,%ecx
+  800681:	74 2c                	je     8006af <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800683:	8b 45 14             	mov    0x14(%ebp),%eax
+  800686:	8b 10                	mov    (%eax),%edx
+  800688:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80068d:	8d 40 04             	lea    0x4(%eax),%eax
+  800690:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800693:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800698:	eb be                	jmp    800658 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80069a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069d:	8b 10                	mov    (%eax),%edx
+  80069f:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006a2:	8d 40 08             	lea    0x8(%eax),%eax
+  8006a5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006a8:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006ad:	eb a9                	jmp    800658 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b2:	8b 10                	mov    (%eax),%edx
+  8006b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006b9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006bc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006bf:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006c4:	eb 92                	jmp    800658 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8006c6:	83 ec 08             	sub    $0x8,%esp
+  8006c9:	53                   	push   %ebx
+  8006ca:	6a 25                	push   $0x25
+  8006cc:	ff d6                	call   *%esi
+			break;
+  8006ce:	83 c4 10             	add    $0x10,%esp
+  8006d1:	eb 9f                	jmp    800672 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8006d3:	83 ec 08             	sub    $0x8,%esp
+  8006d6:	53                   	push   %ebx
+  8006d7:	6a 25                	push   $0x25
+  8006d9:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006db:	83 c4 10             	add    $0x10,%esp
+  8006de:	89 f8                	mov    %edi,%eax
+  8006e0:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006e4:	74 05                	je     8006eb <vprintfmt+0x44f>
+  8006e6:	83 e8 01             	sub    $0x1,%eax
+  8006e9:	eb f5                	jmp    8006e0 <vprintfmt+0x444>
+  8006eb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006ee:	eb 82                	jmp    800672 <vprintfmt+0x3d6>
+
+008006f0 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006f0:	55                   	push   %ebp
+  8006f1:	89 e5                	mov    %esp,%ebp
+  8006f3:	83 ec 18             	sub    $0x18,%esp
+  8006f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006f9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006fc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006ff:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800703:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800706:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80070d:	85 c0                	test   %eax,%eax
+  80070f:	74 26                	je     800737 <vsnprintf+0x47>
+  800711:	85 d2                	test   %edx,%edx
+  800713:	7e 22                	jle    800737 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800715:	ff 75 14             	push   0x14(%ebp)
+  800718:	ff 75 10             	push   0x10(%ebp)
+  80071b:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80071e:	50                   	push   %eax
+  80071f:	68 62 02 80 00       	push   $0x800262
+  800724:	e8 73 fb ff ff       	call   80029c <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800729:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80072c:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80072f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800732:	83 c4 10             	add    $0x10,%esp
+}
+  800735:	c9                   	leave
+  800736:	c3                   	ret
+		return -E_INVAL;
+  800737:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80073c:	eb f7                	jmp    800735 <vsnprintf+0x45>
+
+0080073e <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80073e:	55                   	push   %ebp
+  80073f:	89 e5                	mov    %esp,%ebp
+  800741:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800744:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800747:	50                   	push   %eax
+  800748:	ff 75 10             	push   0x10(%ebp)
+  80074b:	ff 75 0c             	push   0xc(%ebp)
+  80074e:	ff 75 08             	push   0x8(%ebp)
+  800751:	e8 9a ff ff ff       	call   8006f0 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800756:	c9                   	leave
+  800757:	c3                   	ret
+
+00800758 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800758:	55                   	push   %ebp
+  800759:	89 e5                	mov    %esp,%ebp
+  80075b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80075e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800763:	eb 03                	jmp    800768 <strlen+0x10>
+		n++;
+  800765:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800768:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80076c:	75 f7                	jne    800765 <strlen+0xd>
+	return n;
+}
+  80076e:	5d                   	pop    %ebp
+  80076f:	c3                   	ret
+
+00800770 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800770:	55                   	push   %ebp
+  800771:	89 e5                	mov    %esp,%ebp
+  800773:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800776:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800779:	b8 00 00 00 00       	mov    $0x0,%eax
+  80077e:	eb 03                	jmp    800783 <strnlen+0x13>
+		n++;
+  800780:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800783:	39 d0                	cmp    %edx,%eax
+  800785:	74 08                	je     80078f <strnlen+0x1f>
+  800787:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80078b:	75 f3                	jne    800780 <strnlen+0x10>
+  80078d:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80078f:	89 d0                	mov    %edx,%eax
+  800791:	5d                   	pop    %ebp
+  800792:	c3                   	ret
+
+00800793 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800793:	55                   	push   %ebp
+  800794:	89 e5                	mov    %esp,%ebp
+  800796:	53                   	push   %ebx
+  800797:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80079a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80079d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a2:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007a6:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007a9:	83 c0 01             	add    $0x1,%eax
+  8007ac:	84 d2                	test   %dl,%dl
+  8007ae:	75 f2                	jne    8007a2 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007b0:	89 c8                	mov    %ecx,%eax
+  8007b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007b5:	c9                   	leave
+  8007b6:	c3                   	ret
+
+008007b7 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007b7:	55                   	push   %ebp
+  8007b8:	89 e5                	mov    %esp,%ebp
+  8007ba:	53                   	push   %ebx
+  8007bb:	83 ec 10             	sub    $0x10,%esp
+  8007be:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007c1:	53                   	push   %ebx
+  8007c2:	e8 91 ff ff ff       	call   800758 <strlen>
+  8007c7:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007ca:	ff 75 0c             	push   0xc(%ebp)
+  8007cd:	01 d8                	add    %ebx,%eax
+  8007cf:	50                   	push   %eax
+  8007d0:	e8 be ff ff ff       	call   800793 <strcpy>
+	return dst;
+}
+  8007d5:	89 d8                	mov    %ebx,%eax
+  8007d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007da:	c9                   	leave
+  8007db:	c3                   	ret
+
+008007dc <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007dc:	55                   	push   %ebp
+  8007dd:	89 e5                	mov    %esp,%ebp
+  8007df:	56                   	push   %esi
+  8007e0:	53                   	push   %ebx
+  8007e1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007e4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007e7:	89 f3                	mov    %esi,%ebx
+  8007e9:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007ec:	89 f0                	mov    %esi,%eax
+  8007ee:	eb 0f                	jmp    8007ff <strncpy+0x23>
+		*dst++ = *src;
+  8007f0:	83 c0 01             	add    $0x1,%eax
+  8007f3:	0f b6 0a             	movzbl (%edx),%ecx
+  8007f6:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007f9:	80 f9 01             	cmp    $0x1,%cl
+  8007fc:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007ff:	39 d8                	cmp    %ebx,%eax
+  800801:	75 ed                	jne    8007f0 <strncpy+0x14>
+	}
+	return ret;
+}
+  800803:	89 f0                	mov    %esi,%eax
+  800805:	5b                   	pop    %ebx
+  800806:	5e                   	pop    %esi
+  800807:	5d                   	pop    %ebp
+  800808:	c3                   	ret
+
+00800809 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800809:	55                   	push   %ebp
+  80080a:	89 e5                	mov    %esp,%ebp
+  80080c:	56                   	push   %esi
+  80080d:	53                   	push   %ebx
+  80080e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800811:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800814:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800817:	89 f0                	mov    %esi,%eax
+  800819:	85 d2                	test   %edx,%edx
+  80081b:	74 21                	je     80083e <strlcpy+0x35>
+  80081d:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800821:	89 f2                	mov    %esi,%edx
+  800823:	eb 09                	jmp    80082e <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800825:	83 c1 01             	add    $0x1,%ecx
+  800828:	83 c2 01             	add    $0x1,%edx
+  80082b:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80082e:	39 c2                	cmp    %eax,%edx
+  800830:	74 09                	je     80083b <strlcpy+0x32>
+  800832:	0f b6 19             	movzbl (%ecx),%ebx
+  800835:	84 db                	test   %bl,%bl
+  800837:	75 ec                	jne    800825 <strlcpy+0x1c>
+  800839:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80083b:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80083e:	29 f0                	sub    %esi,%eax
+}
+  800840:	5b                   	pop    %ebx
+  800841:	5e                   	pop    %esi
+  800842:	5d                   	pop    %ebp
+  800843:	c3                   	ret
+
+00800844 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800844:	55                   	push   %ebp
+  800845:	89 e5                	mov    %esp,%ebp
+  800847:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80084a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80084d:	eb 06                	jmp    800855 <strcmp+0x11>
+		p++, q++;
+  80084f:	83 c1 01             	add    $0x1,%ecx
+  800852:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800855:	0f b6 01             	movzbl (%ecx),%eax
+  800858:	84 c0                	test   %al,%al
+  80085a:	74 04                	je     800860 <strcmp+0x1c>
+  80085c:	3a 02                	cmp    (%edx),%al
+  80085e:	74 ef                	je     80084f <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800860:	0f b6 c0             	movzbl %al,%eax
+  800863:	0f b6 12             	movzbl (%edx),%edx
+  800866:	29 d0                	sub    %edx,%eax
+}
+  800868:	5d                   	pop    %ebp
+  800869:	c3                   	ret
+
+0080086a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80086a:	55                   	push   %ebp
+  80086b:	89 e5                	mov    %esp,%ebp
+  80086d:	53                   	push   %ebx
+  80086e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800871:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800874:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800877:	eb 09                	jmp    800882 <strncmp+0x18>
+		n--, p++, q++;
+  800879:	83 ea 01             	sub    $0x1,%edx
+  80087c:	83 c0 01             	add    $0x1,%eax
+  80087f:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800882:	85 d2                	test   %edx,%edx
+  800884:	74 18                	je     80089e <strncmp+0x34>
+  800886:	0f b6 18             	movzbl (%eax),%ebx
+  800889:	84 db                	test   %bl,%bl
+  80088b:	74 04                	je     800891 <strncmp+0x27>
+  80088d:	3a 19                	cmp    (%ecx),%bl
+  80088f:	74 e8                	je     800879 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800891:	0f b6 00             	movzbl (%eax),%eax
+  800894:	0f b6 11             	movzbl (%ecx),%edx
+  800897:	29 d0                	sub    %edx,%eax
+}
+  800899:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80089c:	c9                   	leave
+  80089d:	c3                   	ret
+		return 0;
+  80089e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008a3:	eb f4                	jmp    800899 <strncmp+0x2f>
+
+008008a5 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008a5:	55                   	push   %ebp
+  8008a6:	89 e5                	mov    %esp,%ebp
+  8008a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008ab:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008af:	eb 03                	jmp    8008b4 <strchr+0xf>
+  8008b1:	83 c0 01             	add    $0x1,%eax
+  8008b4:	0f b6 10             	movzbl (%eax),%edx
+  8008b7:	84 d2                	test   %dl,%dl
+  8008b9:	74 06                	je     8008c1 <strchr+0x1c>
+		if (*s == c)
+  8008bb:	38 ca                	cmp    %cl,%dl
+  8008bd:	75 f2                	jne    8008b1 <strchr+0xc>
+  8008bf:	eb 05                	jmp    8008c6 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008c1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008c6:	5d                   	pop    %ebp
+  8008c7:	c3                   	ret
+
+008008c8 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008c8:	55                   	push   %ebp
+  8008c9:	89 e5                	mov    %esp,%ebp
+  8008cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008ce:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008d2:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008d5:	38 ca                	cmp    %cl,%dl
+  8008d7:	74 09                	je     8008e2 <strfind+0x1a>
+  8008d9:	84 d2                	test   %dl,%dl
+  8008db:	74 05                	je     8008e2 <strfind+0x1a>
+	for (; *s; s++)
+  8008dd:	83 c0 01             	add    $0x1,%eax
+  8008e0:	eb f0                	jmp    8008d2 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008e2:	5d                   	pop    %ebp
+  8008e3:	c3                   	ret
+
+008008e4 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008e4:	55                   	push   %ebp
+  8008e5:	89 e5                	mov    %esp,%ebp
+  8008e7:	57                   	push   %edi
+  8008e8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008eb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008ee:	85 c9                	test   %ecx,%ecx
+  8008f0:	74 20                	je     800912 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008f2:	89 f8                	mov    %edi,%eax
+  8008f4:	09 c8                	or     %ecx,%eax
+  8008f6:	a8 03                	test   $0x3,%al
+  8008f8:	75 12                	jne    80090c <memset+0x28>
+		c &= 0xFF;
+  8008fa:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008fe:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800904:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800907:	fc                   	cld
+  800908:	f3 ab                	rep stos %eax,%es:(%edi)
+  80090a:	eb 06                	jmp    800912 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80090c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80090f:	fc                   	cld
+  800910:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800912:	89 f8                	mov    %edi,%eax
+  800914:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800917:	c9                   	leave
+  800918:	c3                   	ret
+
+00800919 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800919:	55                   	push   %ebp
+  80091a:	89 e5                	mov    %esp,%ebp
+  80091c:	57                   	push   %edi
+  80091d:	56                   	push   %esi
+  80091e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800921:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800924:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800927:	39 c6                	cmp    %eax,%esi
+  800929:	73 32                	jae    80095d <memmove+0x44>
+  80092b:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80092e:	39 d0                	cmp    %edx,%eax
+  800930:	73 2b                	jae    80095d <memmove+0x44>
+		s += n;
+		d += n;
+  800932:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800935:	89 d6                	mov    %edx,%esi
+  800937:	09 fe                	or     %edi,%esi
+  800939:	09 ce                	or     %ecx,%esi
+  80093b:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800941:	75 0e                	jne    800951 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800943:	83 ef 04             	sub    $0x4,%edi
+  800946:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800949:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80094c:	fd                   	std
+  80094d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80094f:	eb 09                	jmp    80095a <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800951:	83 ef 01             	sub    $0x1,%edi
+  800954:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800957:	fd                   	std
+  800958:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80095a:	fc                   	cld
+  80095b:	eb 1a                	jmp    800977 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80095d:	89 f2                	mov    %esi,%edx
+  80095f:	09 c2                	or     %eax,%edx
+  800961:	09 ca                	or     %ecx,%edx
+  800963:	f6 c2 03             	test   $0x3,%dl
+  800966:	75 0a                	jne    800972 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800968:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80096b:	89 c7                	mov    %eax,%edi
+  80096d:	fc                   	cld
+  80096e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800970:	eb 05                	jmp    800977 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800972:	89 c7                	mov    %eax,%edi
+  800974:	fc                   	cld
+  800975:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800977:	5e                   	pop    %esi
+  800978:	5f                   	pop    %edi
+  800979:	5d                   	pop    %ebp
+  80097a:	c3                   	ret
+
+0080097b <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80097b:	55                   	push   %ebp
+  80097c:	89 e5                	mov    %esp,%ebp
+  80097e:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800981:	ff 75 10             	push   0x10(%ebp)
+  800984:	ff 75 0c             	push   0xc(%ebp)
+  800987:	ff 75 08             	push   0x8(%ebp)
+  80098a:	e8 8a ff ff ff       	call   800919 <memmove>
+}
+  80098f:	c9                   	leave
+  800990:	c3                   	ret
+
+00800991 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800991:	55                   	push   %ebp
+  800992:	89 e5                	mov    %esp,%ebp
+  800994:	56                   	push   %esi
+  800995:	53                   	push   %ebx
+  800996:	8b 45 08             	mov    0x8(%ebp),%eax
+  800999:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80099c:	89 c6                	mov    %eax,%esi
+  80099e:	03 75 10             	add    0x10(%ebp),%esi
+  8009a1:	eb 06                	jmp    8009a9 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009a3:	83 c0 01             	add    $0x1,%eax
+  8009a6:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009a9:	39 f0                	cmp    %esi,%eax
+  8009ab:	74 14                	je     8009c1 <memcmp+0x30>
+		if (*s1 != *s2)
+  8009ad:	0f b6 08             	movzbl (%eax),%ecx
+  8009b0:	0f b6 1a             	movzbl (%edx),%ebx
+  8009b3:	38 d9                	cmp    %bl,%cl
+  8009b5:	74 ec                	je     8009a3 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009b7:	0f b6 c1             	movzbl %cl,%eax
+  8009ba:	0f b6 db             	movzbl %bl,%ebx
+  8009bd:	29 d8                	sub    %ebx,%eax
+  8009bf:	eb 05                	jmp    8009c6 <memcmp+0x35>
+	}
+
+	return 0;
+  8009c1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009c6:	5b                   	pop    %ebx
+  8009c7:	5e                   	pop    %esi
+  8009c8:	5d                   	pop    %ebp
+  8009c9:	c3                   	ret
+
+008009ca <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009ca:	55                   	push   %ebp
+  8009cb:	89 e5                	mov    %esp,%ebp
+  8009cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009d3:	89 c2                	mov    %eax,%edx
+  8009d5:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009d8:	eb 03                	jmp    8009dd <memfind+0x13>
+  8009da:	83 c0 01             	add    $0x1,%eax
+  8009dd:	39 d0                	cmp    %edx,%eax
+  8009df:	73 04                	jae    8009e5 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009e1:	38 08                	cmp    %cl,(%eax)
+  8009e3:	75 f5                	jne    8009da <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009e5:	5d                   	pop    %ebp
+  8009e6:	c3                   	ret
+
+008009e7 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009e7:	55                   	push   %ebp
+  8009e8:	89 e5                	mov    %esp,%ebp
+  8009ea:	57                   	push   %edi
+  8009eb:	56                   	push   %esi
+  8009ec:	53                   	push   %ebx
+  8009ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009f0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009f3:	eb 03                	jmp    8009f8 <strtol+0x11>
+		s++;
+  8009f5:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8009f8:	0f b6 02             	movzbl (%edx),%eax
+  8009fb:	3c 20                	cmp    $0x20,%al
+  8009fd:	74 f6                	je     8009f5 <strtol+0xe>
+  8009ff:	3c 09                	cmp    $0x9,%al
+  800a01:	74 f2                	je     8009f5 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a03:	3c 2b                	cmp    $0x2b,%al
+  800a05:	74 2a                	je     800a31 <strtol+0x4a>
+	int neg = 0;
+  800a07:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a0c:	3c 2d                	cmp    $0x2d,%al
+  800a0e:	74 2b                	je     800a3b <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a10:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a16:	75 0f                	jne    800a27 <strtol+0x40>
+  800a18:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a1b:	74 28                	je     800a45 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a1d:	85 db                	test   %ebx,%ebx
+  800a1f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a24:	0f 44 d8             	cmove  %eax,%ebx
+  800a27:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a2c:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a2f:	eb 46                	jmp    800a77 <strtol+0x90>
+		s++;
+  800a31:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a34:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a39:	eb d5                	jmp    800a10 <strtol+0x29>
+		s++, neg = 1;
+  800a3b:	83 c2 01             	add    $0x1,%edx
+  800a3e:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a43:	eb cb                	jmp    800a10 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a45:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a49:	74 0e                	je     800a59 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a4b:	85 db                	test   %ebx,%ebx
+  800a4d:	75 d8                	jne    800a27 <strtol+0x40>
+		s++, base = 8;
+  800a4f:	83 c2 01             	add    $0x1,%edx
+  800a52:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a57:	eb ce                	jmp    800a27 <strtol+0x40>
+		s += 2, base = 16;
+  800a59:	83 c2 02             	add    $0x2,%edx
+  800a5c:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a61:	eb c4                	jmp    800a27 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a63:	0f be c0             	movsbl %al,%eax
+  800a66:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a69:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a6c:	7d 3a                	jge    800aa8 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a6e:	83 c2 01             	add    $0x1,%edx
+  800a71:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a75:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a77:	0f b6 02             	movzbl (%edx),%eax
+  800a7a:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a7d:	89 f3                	mov    %esi,%ebx
+  800a7f:	80 fb 09             	cmp    $0x9,%bl
+  800a82:	76 df                	jbe    800a63 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a84:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a87:	89 f3                	mov    %esi,%ebx
+  800a89:	80 fb 19             	cmp    $0x19,%bl
+  800a8c:	77 08                	ja     800a96 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a8e:	0f be c0             	movsbl %al,%eax
+  800a91:	83 e8 57             	sub    $0x57,%eax
+  800a94:	eb d3                	jmp    800a69 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a96:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a99:	89 f3                	mov    %esi,%ebx
+  800a9b:	80 fb 19             	cmp    $0x19,%bl
+  800a9e:	77 08                	ja     800aa8 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800aa0:	0f be c0             	movsbl %al,%eax
+  800aa3:	83 e8 37             	sub    $0x37,%eax
+  800aa6:	eb c1                	jmp    800a69 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800aa8:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800aac:	74 05                	je     800ab3 <strtol+0xcc>
+		*endptr = (char *) s;
+  800aae:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ab1:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ab3:	89 c8                	mov    %ecx,%eax
+  800ab5:	f7 d8                	neg    %eax
+  800ab7:	85 ff                	test   %edi,%edi
+  800ab9:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800abc:	89 c8                	mov    %ecx,%eax
+  800abe:	5b                   	pop    %ebx
+  800abf:	5e                   	pop    %esi
+  800ac0:	5f                   	pop    %edi
+  800ac1:	5d                   	pop    %ebp
+  800ac2:	c3                   	ret
+
+00800ac3 <atoi>:
+
+int
+atoi(const char *s)
+{
+  800ac3:	55                   	push   %ebp
+  800ac4:	89 e5                	mov    %esp,%ebp
+  800ac6:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800ac9:	6a 0a                	push   $0xa
+  800acb:	6a 00                	push   $0x0
+  800acd:	ff 75 08             	push   0x8(%ebp)
+  800ad0:	e8 12 ff ff ff       	call   8009e7 <strtol>
+}
+  800ad5:	c9                   	leave
+  800ad6:	c3                   	ret
+
+00800ad7 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800ad7:	55                   	push   %ebp
+  800ad8:	89 e5                	mov    %esp,%ebp
+  800ada:	57                   	push   %edi
+  800adb:	56                   	push   %esi
+  800adc:	53                   	push   %ebx
+  800add:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800ae3:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800ae9:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800aef:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800af5:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800afc:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800aff:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800b06:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800b09:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800b10:	74 76                	je     800b88 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800b12:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800b18:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b1b:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800b21:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800b28:	0f 88 06 01 00 00    	js     800c34 <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800b2e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800b35:	0f 84 48 01 00 00    	je     800c83 <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800b3b:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800b41:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800b47:	be 00 00 00 00       	mov    $0x0,%esi
+  800b4c:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800b52:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b55:	55                   	push   %ebp
+  800b56:	68 5f 0b 80 00       	push   $0x800b5f
+  800b5b:	89 e5                	mov    %esp,%ebp
+  800b5d:	0f 34                	sysenter
+  800b5f:	83 c4 04             	add    $0x4,%esp
+  800b62:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800b63:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800b69:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800b6f:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800b72:	0f 85 9a 01 00 00    	jne    800d12 <page_vec_call+0x23b>
+  800b78:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b7d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b80:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b83:	e9 29 01 00 00       	jmp    800cb1 <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800b88:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800b8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b91:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800b93:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800b9a:	78 2f                	js     800bcb <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800b9c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800ba3:	74 72                	je     800c17 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800ba5:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800bab:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800bb1:	b8 10 00 00 00       	mov    $0x10,%eax
+  800bb6:	89 fb                	mov    %edi,%ebx
+  800bb8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800bbb:	55                   	push   %ebp
+  800bbc:	68 c5 0b 80 00       	push   $0x800bc5
+  800bc1:	89 e5                	mov    %esp,%ebp
+  800bc3:	0f 34                	sysenter
+  800bc5:	83 c4 04             	add    $0x4,%esp
+  800bc8:	5d                   	pop    %ebp
+	return ret;
+  800bc9:	eb 98                	jmp    800b63 <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800bcb:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bd0:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800bd2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800bd7:	f6 c6 08             	test   $0x8,%dh
+  800bda:	74 15                	je     800bf1 <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800bdc:	89 c2                	mov    %eax,%edx
+  800bde:	c1 ea 08             	shr    $0x8,%edx
+  800be1:	83 e2 0f             	and    $0xf,%edx
+  800be4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800be9:	83 fa 06             	cmp    $0x6,%edx
+  800bec:	74 0e                	je     800bfc <page_vec_call+0x125>
+  800bee:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800bf1:	0f b6 c9             	movzbl %cl,%ecx
+  800bf4:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800bfa:	eb a0                	jmp    800b9c <page_vec_call+0xc5>
+  800bfc:	89 c2                	mov    %eax,%edx
+  800bfe:	c1 ea 04             	shr    $0x4,%edx
+  800c01:	83 e2 0f             	and    $0xf,%edx
+  800c04:	83 fa 02             	cmp    $0x2,%edx
+  800c07:	77 e5                	ja     800bee <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800c09:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c0c:	83 f8 02             	cmp    $0x2,%eax
+  800c0f:	0f 97 c1             	seta   %cl
+  800c12:	0f b6 c9             	movzbl %cl,%ecx
+  800c15:	eb d7                	jmp    800bee <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800c17:	b8 10 00 00 00       	mov    $0x10,%eax
+  800c1c:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800c22:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800c28:	89 fb                	mov    %edi,%ebx
+  800c2a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c2d:	cd 30                	int    $0x30
+  800c2f:	e9 2f ff ff ff       	jmp    800b63 <page_vec_call+0x8c>
+  800c34:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c39:	0f a2                	cpuid
+		return 0;
+  800c3b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800c40:	f6 c6 08             	test   $0x8,%dh
+  800c43:	74 15                	je     800c5a <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c45:	89 c2                	mov    %eax,%edx
+  800c47:	c1 ea 08             	shr    $0x8,%edx
+  800c4a:	83 e2 0f             	and    $0xf,%edx
+  800c4d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800c52:	83 fa 06             	cmp    $0x6,%edx
+  800c55:	74 11                	je     800c68 <page_vec_call+0x191>
+  800c57:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800c5a:	0f b6 c9             	movzbl %cl,%ecx
+  800c5d:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800c63:	e9 c6 fe ff ff       	jmp    800b2e <page_vec_call+0x57>
+  800c68:	89 c2                	mov    %eax,%edx
+  800c6a:	c1 ea 04             	shr    $0x4,%edx
+  800c6d:	83 e2 0f             	and    $0xf,%edx
+  800c70:	83 fa 02             	cmp    $0x2,%edx
+  800c73:	77 e2                	ja     800c57 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800c75:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c78:	83 f8 02             	cmp    $0x2,%eax
+  800c7b:	0f 97 c1             	seta   %cl
+  800c7e:	0f b6 c9             	movzbl %cl,%ecx
+  800c81:	eb d4                	jmp    800c57 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800c83:	be 00 00 00 00       	mov    $0x0,%esi
+  800c88:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800c8e:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800c94:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800c9a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c9d:	cd 30                	int    $0x30
+  800c9f:	e9 bf fe ff ff       	jmp    800b63 <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800ca4:	29 da                	sub    %ebx,%edx
+			vec++;
+  800ca6:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800ca9:	83 e8 01             	sub    $0x1,%eax
+  800cac:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800cb1:	85 c0                	test   %eax,%eax
+  800cb3:	74 58                	je     800d0d <page_vec_call+0x236>
+  800cb5:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800cb8:	39 da                	cmp    %ebx,%edx
+  800cba:	73 e8                	jae    800ca4 <page_vec_call+0x1cd>
+  800cbc:	89 75 08             	mov    %esi,0x8(%ebp)
+  800cbf:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800cc2:	84 c9                	test   %cl,%cl
+  800cc4:	74 06                	je     800ccc <page_vec_call+0x1f5>
+  800cc6:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800ccc:	83 ec 04             	sub    $0x4,%esp
+  800ccf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cd2:	c1 e0 04             	shl    $0x4,%eax
+  800cd5:	50                   	push   %eax
+  800cd6:	ff 75 08             	push   0x8(%ebp)
+  800cd9:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800cdf:	53                   	push   %ebx
+  800ce0:	e8 34 fc ff ff       	call   800919 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800ce5:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800ceb:	89 c2                	mov    %eax,%edx
+  800ced:	c1 e2 0c             	shl    $0xc,%edx
+  800cf0:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  800cf6:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  800cfc:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  800d02:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  800d05:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  800d08:	e9 f2 fd ff ff       	jmp    800aff <page_vec_call+0x28>
+			r = 0;
+  800d0d:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  800d12:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800d16:	74 0b                	je     800d23 <page_vec_call+0x24c>
+		*done = total;
+  800d18:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800d1b:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  800d21:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  800d23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d26:	5b                   	pop    %ebx
+  800d27:	5e                   	pop    %esi
+  800d28:	5f                   	pop    %edi
+  800d29:	5d                   	pop    %ebp
+  800d2a:	c3                   	ret
+
+00800d2b <sys_cputs>:
+{
+  800d2b:	55                   	push   %ebp
+  800d2c:	89 e5                	mov    %esp,%ebp
+  800d2e:	57                   	push   %edi
+  800d2f:	56                   	push   %esi
+  800d30:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800d31:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800d38:	78 2d                	js     800d67 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800d3a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800d41:	74 70                	je     800db3 <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800d43:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d48:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d4e:	89 c3                	mov    %eax,%ebx
+  800d50:	89 c7                	mov    %eax,%edi
+  800d52:	89 c6                	mov    %eax,%esi
+  800d54:	55                   	push   %ebp
+  800d55:	68 5e 0d 80 00       	push   $0x800d5e
+  800d5a:	89 e5                	mov    %esp,%ebp
+  800d5c:	0f 34                	sysenter
+  800d5e:	83 c4 04             	add    $0x4,%esp
+  800d61:	5d                   	pop    %ebp
+}
+  800d62:	5b                   	pop    %ebx
+  800d63:	5e                   	pop    %esi
+  800d64:	5f                   	pop    %edi
+  800d65:	5d                   	pop    %ebp
+  800d66:	c3                   	ret
+  800d67:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d6c:	0f a2                	cpuid
+		return 0;
+  800d6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800d73:	f6 c6 08             	test   $0x8,%dh
+  800d76:	74 15                	je     800d8d <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d78:	89 c2                	mov    %eax,%edx
+  800d7a:	c1 ea 08             	shr    $0x8,%edx
+  800d7d:	83 e2 0f             	and    $0xf,%edx
+  800d80:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d85:	83 fa 06             	cmp    $0x6,%edx
+  800d88:	74 0e                	je     800d98 <sys_cputs+0x6d>
+  800d8a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800d8d:	0f b6 c9             	movzbl %cl,%ecx
+  800d90:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800d96:	eb a2                	jmp    800d3a <sys_cputs+0xf>
+  800d98:	89 c2                	mov    %eax,%edx
+  800d9a:	c1 ea 04             	shr    $0x4,%edx
+  800d9d:	83 e2 0f             	and    $0xf,%edx
+  800da0:	83 fa 02             	cmp    $0x2,%edx
+  800da3:	77 e5                	ja     800d8a <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800da5:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800da8:	83 f8 02             	cmp    $0x2,%eax
+  800dab:	0f 97 c1             	seta   %cl
+  800dae:	0f b6 c9             	movzbl %cl,%ecx
+  800db1:	eb d7                	jmp    800d8a <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800db3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800db8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dbe:	89 c3                	mov    %eax,%ebx
+  800dc0:	89 c7                	mov    %eax,%edi
+  800dc2:	89 c6                	mov    %eax,%esi
+  800dc4:	cd 30                	int    $0x30
+}
+  800dc6:	eb 9a                	jmp    800d62 <sys_cputs+0x37>
+
+00800dc8 <sys_cgetc>:
+{
+  800dc8:	55                   	push   %ebp
+  800dc9:	89 e5                	mov    %esp,%ebp
+  800dcb:	57                   	push   %edi
+  800dcc:	56                   	push   %esi
+  800dcd:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800dce:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800dd5:	78 2e                	js     800e05 <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  800dd7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800dde:	74 71                	je     800e51 <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  800de0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800de5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dea:	89 d1                	mov    %edx,%ecx
+  800dec:	89 d3                	mov    %edx,%ebx
+  800dee:	89 d7                	mov    %edx,%edi
+  800df0:	89 d6                	mov    %edx,%esi
+  800df2:	55                   	push   %ebp
+  800df3:	68 fc 0d 80 00       	push   $0x800dfc
+  800df8:	89 e5                	mov    %esp,%ebp
+  800dfa:	0f 34                	sysenter
+  800dfc:	83 c4 04             	add    $0x4,%esp
+  800dff:	5d                   	pop    %ebp
+}
+  800e00:	5b                   	pop    %ebx
+  800e01:	5e                   	pop    %esi
+  800e02:	5f                   	pop    %edi
+  800e03:	5d                   	pop    %ebp
+  800e04:	c3                   	ret
+  800e05:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e0a:	0f a2                	cpuid
+		return 0;
+  800e0c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800e11:	f6 c6 08             	test   $0x8,%dh
+  800e14:	74 15                	je     800e2b <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e16:	89 c2                	mov    %eax,%edx
+  800e18:	c1 ea 08             	shr    $0x8,%edx
+  800e1b:	83 e2 0f             	and    $0xf,%edx
+  800e1e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e23:	83 fa 06             	cmp    $0x6,%edx
+  800e26:	74 0e                	je     800e36 <sys_cgetc+0x6e>
+  800e28:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e2b:	0f b6 c9             	movzbl %cl,%ecx
+  800e2e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800e34:	eb a1                	jmp    800dd7 <sys_cgetc+0xf>
+  800e36:	89 c2                	mov    %eax,%edx
+  800e38:	c1 ea 04             	shr    $0x4,%edx
+  800e3b:	83 e2 0f             	and    $0xf,%edx
+  800e3e:	83 fa 02             	cmp    $0x2,%edx
+  800e41:	77 e5                	ja     800e28 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  800e43:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e46:	83 f8 02             	cmp    $0x2,%eax
+  800e49:	0f 97 c1             	seta   %cl
+  800e4c:	0f b6 c9             	movzbl %cl,%ecx
+  800e4f:	eb d7                	jmp    800e28 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  800e51:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e56:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e5b:	89 d1                	mov    %edx,%ecx
+  800e5d:	89 d3                	mov    %edx,%ebx
+  800e5f:	89 d7                	mov    %edx,%edi
+  800e61:	89 d6                	mov    %edx,%esi
+  800e63:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800e65:	eb 99                	jmp    800e00 <sys_cgetc+0x38>
+
+00800e67 <sys_env_destroy>:
+{
+  800e67:	55                   	push   %ebp
+  800e68:	89 e5                	mov    %esp,%ebp
+  800e6a:	57                   	push   %edi
+  800e6b:	56                   	push   %esi
+  800e6c:	53                   	push   %ebx
+  800e6d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800e70:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e77:	78 36                	js     800eaf <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  800e79:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e80:	74 79                	je     800efb <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  800e82:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e85:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e8a:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e8f:	89 cb                	mov    %ecx,%ebx
+  800e91:	89 cf                	mov    %ecx,%edi
+  800e93:	89 ce                	mov    %ecx,%esi
+  800e95:	55                   	push   %ebp
+  800e96:	68 9f 0e 80 00       	push   $0x800e9f
+  800e9b:	89 e5                	mov    %esp,%ebp
+  800e9d:	0f 34                	sysenter
+  800e9f:	83 c4 04             	add    $0x4,%esp
+  800ea2:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ea3:	85 c0                	test   %eax,%eax
+  800ea5:	7f 6b                	jg     800f12 <sys_env_destroy+0xab>
+}
+  800ea7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eaa:	5b                   	pop    %ebx
+  800eab:	5e                   	pop    %esi
+  800eac:	5f                   	pop    %edi
+  800ead:	5d                   	pop    %ebp
+  800eae:	c3                   	ret
+  800eaf:	b8 01 00 00 00       	mov    $0x1,%eax
+  800eb4:	0f a2                	cpuid
+		return 0;
+  800eb6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800ebb:	f6 c6 08             	test   $0x8,%dh
+  800ebe:	74 15                	je     800ed5 <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ec0:	89 c2                	mov    %eax,%edx
+  800ec2:	c1 ea 08             	shr    $0x8,%edx
+  800ec5:	83 e2 0f             	and    $0xf,%edx
+  800ec8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ecd:	83 fa 06             	cmp    $0x6,%edx
+  800ed0:	74 0e                	je     800ee0 <sys_env_destroy+0x79>
+  800ed2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800ed5:	0f b6 c9             	movzbl %cl,%ecx
+  800ed8:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800ede:	eb 99                	jmp    800e79 <sys_env_destroy+0x12>
+  800ee0:	89 c2                	mov    %eax,%edx
+  800ee2:	c1 ea 04             	shr    $0x4,%edx
+  800ee5:	83 e2 0f             	and    $0xf,%edx
+  800ee8:	83 fa 02             	cmp    $0x2,%edx
+  800eeb:	77 e5                	ja     800ed2 <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  800eed:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ef0:	83 f8 02             	cmp    $0x2,%eax
+  800ef3:	0f 97 c1             	seta   %cl
+  800ef6:	0f b6 c9             	movzbl %cl,%ecx
+  800ef9:	eb d7                	jmp    800ed2 <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  800efb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f00:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f05:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f08:	89 cb                	mov    %ecx,%ebx
+  800f0a:	89 cf                	mov    %ecx,%edi
+  800f0c:	89 ce                	mov    %ecx,%esi
+  800f0e:	cd 30                	int    $0x30
+  800f10:	eb 91                	jmp    800ea3 <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f12:	83 ec 0c             	sub    $0xc,%esp
+  800f15:	50                   	push   %eax
+  800f16:	6a 03                	push   $0x3
+  800f18:	68 b9 2f 80 00       	push   $0x802fb9
+  800f1d:	6a 4a                	push   $0x4a
+  800f1f:	68 d6 2f 80 00       	push   $0x802fd6
+  800f24:	e8 20 1a 00 00       	call   802949 <_panic>
+
+00800f29 <sys_getenvid>:
+{
+  800f29:	55                   	push   %ebp
+  800f2a:	89 e5                	mov    %esp,%ebp
+  800f2c:	57                   	push   %edi
+  800f2d:	56                   	push   %esi
+  800f2e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800f2f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800f36:	78 2e                	js     800f66 <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  800f38:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800f3f:	74 71                	je     800fb2 <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  800f41:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f46:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f4b:	89 d1                	mov    %edx,%ecx
+  800f4d:	89 d3                	mov    %edx,%ebx
+  800f4f:	89 d7                	mov    %edx,%edi
+  800f51:	89 d6                	mov    %edx,%esi
+  800f53:	55                   	push   %ebp
+  800f54:	68 5d 0f 80 00       	push   $0x800f5d
+  800f59:	89 e5                	mov    %esp,%ebp
+  800f5b:	0f 34                	sysenter
+  800f5d:	83 c4 04             	add    $0x4,%esp
+  800f60:	5d                   	pop    %ebp
+}
+  800f61:	5b                   	pop    %ebx
+  800f62:	5e                   	pop    %esi
+  800f63:	5f                   	pop    %edi
+  800f64:	5d                   	pop    %ebp
+  800f65:	c3                   	ret
+  800f66:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f6b:	0f a2                	cpuid
+		return 0;
+  800f6d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f72:	f6 c6 08             	test   $0x8,%dh
+  800f75:	74 15                	je     800f8c <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f77:	89 c2                	mov    %eax,%edx
+  800f79:	c1 ea 08             	shr    $0x8,%edx
+  800f7c:	83 e2 0f             	and    $0xf,%edx
+  800f7f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f84:	83 fa 06             	cmp    $0x6,%edx
+  800f87:	74 0e                	je     800f97 <sys_getenvid+0x6e>
+  800f89:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f8c:	0f b6 c9             	movzbl %cl,%ecx
+  800f8f:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800f95:	eb a1                	jmp    800f38 <sys_getenvid+0xf>
+  800f97:	89 c2                	mov    %eax,%edx
+  800f99:	c1 ea 04             	shr    $0x4,%edx
+  800f9c:	83 e2 0f             	and    $0xf,%edx
+  800f9f:	83 fa 02             	cmp    $0x2,%edx
+  800fa2:	77 e5                	ja     800f89 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  800fa4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800fa7:	83 f8 02             	cmp    $0x2,%eax
+  800faa:	0f 97 c1             	seta   %cl
+  800fad:	0f b6 c9             	movzbl %cl,%ecx
+  800fb0:	eb d7                	jmp    800f89 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  800fb2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fb7:	b8 02 00 00 00       	mov    $0x2,%eax
+  800fbc:	89 d1                	mov    %edx,%ecx
+  800fbe:	89 d3                	mov    %edx,%ebx
+  800fc0:	89 d7                	mov    %edx,%edi
+  800fc2:	89 d6                	mov    %edx,%esi
+  800fc4:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  800fc6:	eb 99                	jmp    800f61 <sys_getenvid+0x38>
+
+00800fc8 <sys_page_alloc>:
+{
+  800fc8:	55                   	push   %ebp
+  800fc9:	89 e5                	mov    %esp,%ebp
+  800fcb:	57                   	push   %edi
+  800fcc:	56                   	push   %esi
+  800fcd:	53                   	push   %ebx
+  800fce:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800fd1:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800fd8:	78 38                	js     801012 <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  800fda:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800fe1:	74 7b                	je     80105e <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  800fe3:	be 00 00 00 00       	mov    $0x0,%esi
+  800fe8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800feb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fee:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ff3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ff6:	89 f7                	mov    %esi,%edi
+  800ff8:	55                   	push   %ebp
+  800ff9:	68 02 10 80 00       	push   $0x801002
+  800ffe:	89 e5                	mov    %esp,%ebp
+  801000:	0f 34                	sysenter
+  801002:	83 c4 04             	add    $0x4,%esp
+  801005:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801006:	85 c0                	test   %eax,%eax
+  801008:	7f 6d                	jg     801077 <sys_page_alloc+0xaf>
+}
+  80100a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80100d:	5b                   	pop    %ebx
+  80100e:	5e                   	pop    %esi
+  80100f:	5f                   	pop    %edi
+  801010:	5d                   	pop    %ebp
+  801011:	c3                   	ret
+  801012:	b8 01 00 00 00       	mov    $0x1,%eax
+  801017:	0f a2                	cpuid
+		return 0;
+  801019:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80101e:	f6 c6 08             	test   $0x8,%dh
+  801021:	74 15                	je     801038 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801023:	89 c2                	mov    %eax,%edx
+  801025:	c1 ea 08             	shr    $0x8,%edx
+  801028:	83 e2 0f             	and    $0xf,%edx
+  80102b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801030:	83 fa 06             	cmp    $0x6,%edx
+  801033:	74 0e                	je     801043 <sys_page_alloc+0x7b>
+  801035:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801038:	0f b6 c9             	movzbl %cl,%ecx
+  80103b:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801041:	eb 97                	jmp    800fda <sys_page_alloc+0x12>
+  801043:	89 c2                	mov    %eax,%edx
+  801045:	c1 ea 04             	shr    $0x4,%edx
+  801048:	83 e2 0f             	and    $0xf,%edx
+  80104b:	83 fa 02             	cmp    $0x2,%edx
+  80104e:	77 e5                	ja     801035 <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  801050:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801053:	83 f8 02             	cmp    $0x2,%eax
+  801056:	0f 97 c1             	seta   %cl
+  801059:	0f b6 c9             	movzbl %cl,%ecx
+  80105c:	eb d7                	jmp    801035 <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  80105e:	be 00 00 00 00       	mov    $0x0,%esi
+  801063:	b8 04 00 00 00       	mov    $0x4,%eax
+  801068:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80106e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801071:	89 f7                	mov    %esi,%edi
+  801073:	cd 30                	int    $0x30
+  801075:	eb 8f                	jmp    801006 <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801077:	83 ec 0c             	sub    $0xc,%esp
+  80107a:	50                   	push   %eax
+  80107b:	6a 04                	push   $0x4
+  80107d:	68 b9 2f 80 00       	push   $0x802fb9
+  801082:	6a 4a                	push   $0x4a
+  801084:	68 d6 2f 80 00       	push   $0x802fd6
+  801089:	e8 bb 18 00 00       	call   802949 <_panic>
+
+0080108e <sys_page_map>:
+{
+  80108e:	55                   	push   %ebp
+  80108f:	89 e5                	mov    %esp,%ebp
+  801091:	57                   	push   %edi
+  801092:	56                   	push   %esi
+  801093:	53                   	push   %ebx
+  801094:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801097:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80109e:	78 37                	js     8010d7 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  8010a0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8010a7:	74 7a                	je     801123 <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  8010a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010af:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010b4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010b7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010ba:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010bd:	55                   	push   %ebp
+  8010be:	68 c7 10 80 00       	push   $0x8010c7
+  8010c3:	89 e5                	mov    %esp,%ebp
+  8010c5:	0f 34                	sysenter
+  8010c7:	83 c4 04             	add    $0x4,%esp
+  8010ca:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8010cb:	85 c0                	test   %eax,%eax
+  8010cd:	7f 6c                	jg     80113b <sys_page_map+0xad>
+}
+  8010cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010d2:	5b                   	pop    %ebx
+  8010d3:	5e                   	pop    %esi
+  8010d4:	5f                   	pop    %edi
+  8010d5:	5d                   	pop    %ebp
+  8010d6:	c3                   	ret
+  8010d7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010dc:	0f a2                	cpuid
+		return 0;
+  8010de:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8010e3:	f6 c6 08             	test   $0x8,%dh
+  8010e6:	74 15                	je     8010fd <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010e8:	89 c2                	mov    %eax,%edx
+  8010ea:	c1 ea 08             	shr    $0x8,%edx
+  8010ed:	83 e2 0f             	and    $0xf,%edx
+  8010f0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8010f5:	83 fa 06             	cmp    $0x6,%edx
+  8010f8:	74 0e                	je     801108 <sys_page_map+0x7a>
+  8010fa:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8010fd:	0f b6 c9             	movzbl %cl,%ecx
+  801100:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801106:	eb 98                	jmp    8010a0 <sys_page_map+0x12>
+  801108:	89 c2                	mov    %eax,%edx
+  80110a:	c1 ea 04             	shr    $0x4,%edx
+  80110d:	83 e2 0f             	and    $0xf,%edx
+  801110:	83 fa 02             	cmp    $0x2,%edx
+  801113:	77 e5                	ja     8010fa <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  801115:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801118:	83 f8 02             	cmp    $0x2,%eax
+  80111b:	0f 97 c1             	seta   %cl
+  80111e:	0f b6 c9             	movzbl %cl,%ecx
+  801121:	eb d7                	jmp    8010fa <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  801123:	b8 05 00 00 00       	mov    $0x5,%eax
+  801128:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801131:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801134:	8b 75 18             	mov    0x18(%ebp),%esi
+  801137:	cd 30                	int    $0x30
+  801139:	eb 90                	jmp    8010cb <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80113b:	83 ec 0c             	sub    $0xc,%esp
+  80113e:	50                   	push   %eax
+  80113f:	6a 05                	push   $0x5
+  801141:	68 b9 2f 80 00       	push   $0x802fb9
+  801146:	6a 4a                	push   $0x4a
+  801148:	68 d6 2f 80 00       	push   $0x802fd6
+  80114d:	e8 f7 17 00 00       	call   802949 <_panic>
+
+00801152 <sys_page_unmap>:
+{
+  801152:	55                   	push   %ebp
+  801153:	89 e5                	mov    %esp,%ebp
+  801155:	57                   	push   %edi
+  801156:	56                   	push   %esi
+  801157:	53                   	push   %ebx
+  801158:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80115b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801162:	78 37                	js     80119b <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  801164:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80116b:	74 7a                	je     8011e7 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  80116d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801172:	8b 55 08             	mov    0x8(%ebp),%edx
+  801175:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801178:	b8 06 00 00 00       	mov    $0x6,%eax
+  80117d:	89 df                	mov    %ebx,%edi
+  80117f:	89 de                	mov    %ebx,%esi
+  801181:	55                   	push   %ebp
+  801182:	68 8b 11 80 00       	push   $0x80118b
+  801187:	89 e5                	mov    %esp,%ebp
+  801189:	0f 34                	sysenter
+  80118b:	83 c4 04             	add    $0x4,%esp
+  80118e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80118f:	85 c0                	test   %eax,%eax
+  801191:	7f 6c                	jg     8011ff <sys_page_unmap+0xad>
+}
+  801193:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801196:	5b                   	pop    %ebx
+  801197:	5e                   	pop    %esi
+  801198:	5f                   	pop    %edi
+  801199:	5d                   	pop    %ebp
+  80119a:	c3                   	ret
+  80119b:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011a0:	0f a2                	cpuid
+		return 0;
+  8011a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8011a7:	f6 c6 08             	test   $0x8,%dh
+  8011aa:	74 15                	je     8011c1 <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011ac:	89 c2                	mov    %eax,%edx
+  8011ae:	c1 ea 08             	shr    $0x8,%edx
+  8011b1:	83 e2 0f             	and    $0xf,%edx
+  8011b4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011b9:	83 fa 06             	cmp    $0x6,%edx
+  8011bc:	74 0e                	je     8011cc <sys_page_unmap+0x7a>
+  8011be:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8011c1:	0f b6 c9             	movzbl %cl,%ecx
+  8011c4:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8011ca:	eb 98                	jmp    801164 <sys_page_unmap+0x12>
+  8011cc:	89 c2                	mov    %eax,%edx
+  8011ce:	c1 ea 04             	shr    $0x4,%edx
+  8011d1:	83 e2 0f             	and    $0xf,%edx
+  8011d4:	83 fa 02             	cmp    $0x2,%edx
+  8011d7:	77 e5                	ja     8011be <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  8011d9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011dc:	83 f8 02             	cmp    $0x2,%eax
+  8011df:	0f 97 c1             	seta   %cl
+  8011e2:	0f b6 c9             	movzbl %cl,%ecx
+  8011e5:	eb d7                	jmp    8011be <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  8011e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ec:	b8 06 00 00 00       	mov    $0x6,%eax
+  8011f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f7:	89 df                	mov    %ebx,%edi
+  8011f9:	89 de                	mov    %ebx,%esi
+  8011fb:	cd 30                	int    $0x30
+  8011fd:	eb 90                	jmp    80118f <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011ff:	83 ec 0c             	sub    $0xc,%esp
+  801202:	50                   	push   %eax
+  801203:	6a 06                	push   $0x6
+  801205:	68 b9 2f 80 00       	push   $0x802fb9
+  80120a:	6a 4a                	push   $0x4a
+  80120c:	68 d6 2f 80 00       	push   $0x802fd6
+  801211:	e8 33 17 00 00       	call   802949 <_panic>
+
+00801216 <sys_page_copy>:
+{
+  801216:	55                   	push   %ebp
+  801217:	89 e5                	mov    %esp,%ebp
+  801219:	57                   	push   %edi
+  80121a:	56                   	push   %esi
+  80121b:	53                   	push   %ebx
+  80121c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80121f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801226:	78 37                	js     80125f <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  801228:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80122f:	74 7a                	je     8012ab <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  801231:	8b 55 08             	mov    0x8(%ebp),%edx
+  801234:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801237:	b8 29 00 00 00       	mov    $0x29,%eax
+  80123c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80123f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801242:	8b 75 18             	mov    0x18(%ebp),%esi
+  801245:	55                   	push   %ebp
+  801246:	68 4f 12 80 00       	push   $0x80124f
+  80124b:	89 e5                	mov    %esp,%ebp
+  80124d:	0f 34                	sysenter
+  80124f:	83 c4 04             	add    $0x4,%esp
+  801252:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801253:	85 c0                	test   %eax,%eax
+  801255:	7f 6c                	jg     8012c3 <sys_page_copy+0xad>
+}
+  801257:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80125a:	5b                   	pop    %ebx
+  80125b:	5e                   	pop    %esi
+  80125c:	5f                   	pop    %edi
+  80125d:	5d                   	pop    %ebp
+  80125e:	c3                   	ret
+  80125f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801264:	0f a2                	cpuid
+		return 0;
+  801266:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80126b:	f6 c6 08             	test   $0x8,%dh
+  80126e:	74 15                	je     801285 <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801270:	89 c2                	mov    %eax,%edx
+  801272:	c1 ea 08             	shr    $0x8,%edx
+  801275:	83 e2 0f             	and    $0xf,%edx
+  801278:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80127d:	83 fa 06             	cmp    $0x6,%edx
+  801280:	74 0e                	je     801290 <sys_page_copy+0x7a>
+  801282:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801285:	0f b6 c9             	movzbl %cl,%ecx
+  801288:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80128e:	eb 98                	jmp    801228 <sys_page_copy+0x12>
+  801290:	89 c2                	mov    %eax,%edx
+  801292:	c1 ea 04             	shr    $0x4,%edx
+  801295:	83 e2 0f             	and    $0xf,%edx
+  801298:	83 fa 02             	cmp    $0x2,%edx
+  80129b:	77 e5                	ja     801282 <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  80129d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012a0:	83 f8 02             	cmp    $0x2,%eax
+  8012a3:	0f 97 c1             	seta   %cl
+  8012a6:	0f b6 c9             	movzbl %cl,%ecx
+  8012a9:	eb d7                	jmp    801282 <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  8012ab:	b8 29 00 00 00       	mov    $0x29,%eax
+  8012b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012b9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012bc:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012bf:	cd 30                	int    $0x30
+  8012c1:	eb 90                	jmp    801253 <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012c3:	83 ec 0c             	sub    $0xc,%esp
+  8012c6:	50                   	push   %eax
+  8012c7:	6a 29                	push   $0x29
+  8012c9:	68 b9 2f 80 00       	push   $0x802fb9
+  8012ce:	6a 4a                	push   $0x4a
+  8012d0:	68 d6 2f 80 00       	push   $0x802fd6
+  8012d5:	e8 6f 16 00 00       	call   802949 <_panic>
+
+008012da <sys_yield>:
+{
+  8012da:	55                   	push   %ebp
+  8012db:	89 e5                	mov    %esp,%ebp
+  8012dd:	57                   	push   %edi
+  8012de:	56                   	push   %esi
+  8012df:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8012e0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8012e7:	78 2e                	js     801317 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  8012e9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8012f0:	74 71                	je     801363 <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  8012f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012f7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8012fc:	89 d1                	mov    %edx,%ecx
+  8012fe:	89 d3                	mov    %edx,%ebx
+  801300:	89 d7                	mov    %edx,%edi
+  801302:	89 d6                	mov    %edx,%esi
+  801304:	55                   	push   %ebp
+  801305:	68 0e 13 80 00       	push   $0x80130e
+  80130a:	89 e5                	mov    %esp,%ebp
+  80130c:	0f 34                	sysenter
+  80130e:	83 c4 04             	add    $0x4,%esp
+  801311:	5d                   	pop    %ebp
+}
+  801312:	5b                   	pop    %ebx
+  801313:	5e                   	pop    %esi
+  801314:	5f                   	pop    %edi
+  801315:	5d                   	pop    %ebp
+  801316:	c3                   	ret
+  801317:	b8 01 00 00 00       	mov    $0x1,%eax
+  80131c:	0f a2                	cpuid
+		return 0;
+  80131e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801323:	f6 c6 08             	test   $0x8,%dh
+  801326:	74 15                	je     80133d <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801328:	89 c2                	mov    %eax,%edx
+  80132a:	c1 ea 08             	shr    $0x8,%edx
+  80132d:	83 e2 0f             	and    $0xf,%edx
+  801330:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801335:	83 fa 06             	cmp    $0x6,%edx
+  801338:	74 0e                	je     801348 <sys_yield+0x6e>
+  80133a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80133d:	0f b6 c9             	movzbl %cl,%ecx
+  801340:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801346:	eb a1                	jmp    8012e9 <sys_yield+0xf>
+  801348:	89 c2                	mov    %eax,%edx
+  80134a:	c1 ea 04             	shr    $0x4,%edx
+  80134d:	83 e2 0f             	and    $0xf,%edx
+  801350:	83 fa 02             	cmp    $0x2,%edx
+  801353:	77 e5                	ja     80133a <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  801355:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801358:	83 f8 02             	cmp    $0x2,%eax
+  80135b:	0f 97 c1             	seta   %cl
+  80135e:	0f b6 c9             	movzbl %cl,%ecx
+  801361:	eb d7                	jmp    80133a <sys_yield+0x60>
+		asm volatile("int %1\n"
+  801363:	ba 00 00 00 00       	mov    $0x0,%edx
+  801368:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	89 d3                	mov    %edx,%ebx
+  801371:	89 d7                	mov    %edx,%edi
+  801373:	89 d6                	mov    %edx,%esi
+  801375:	cd 30                	int    $0x30
+}
+  801377:	eb 99                	jmp    801312 <sys_yield+0x38>
+
+00801379 <sys_env_set_status>:
+{
+  801379:	55                   	push   %ebp
+  80137a:	89 e5                	mov    %esp,%ebp
+  80137c:	57                   	push   %edi
+  80137d:	56                   	push   %esi
+  80137e:	53                   	push   %ebx
+  80137f:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801382:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801389:	78 37                	js     8013c2 <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  80138b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801392:	74 7a                	je     80140e <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  801394:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801399:	8b 55 08             	mov    0x8(%ebp),%edx
+  80139c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80139f:	b8 08 00 00 00       	mov    $0x8,%eax
+  8013a4:	89 df                	mov    %ebx,%edi
+  8013a6:	89 de                	mov    %ebx,%esi
+  8013a8:	55                   	push   %ebp
+  8013a9:	68 b2 13 80 00       	push   $0x8013b2
+  8013ae:	89 e5                	mov    %esp,%ebp
+  8013b0:	0f 34                	sysenter
+  8013b2:	83 c4 04             	add    $0x4,%esp
+  8013b5:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8013b6:	85 c0                	test   %eax,%eax
+  8013b8:	7f 6c                	jg     801426 <sys_env_set_status+0xad>
+}
+  8013ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013bd:	5b                   	pop    %ebx
+  8013be:	5e                   	pop    %esi
+  8013bf:	5f                   	pop    %edi
+  8013c0:	5d                   	pop    %ebp
+  8013c1:	c3                   	ret
+  8013c2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013c7:	0f a2                	cpuid
+		return 0;
+  8013c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8013ce:	f6 c6 08             	test   $0x8,%dh
+  8013d1:	74 15                	je     8013e8 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013d3:	89 c2                	mov    %eax,%edx
+  8013d5:	c1 ea 08             	shr    $0x8,%edx
+  8013d8:	83 e2 0f             	and    $0xf,%edx
+  8013db:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8013e0:	83 fa 06             	cmp    $0x6,%edx
+  8013e3:	74 0e                	je     8013f3 <sys_env_set_status+0x7a>
+  8013e5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8013e8:	0f b6 c9             	movzbl %cl,%ecx
+  8013eb:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8013f1:	eb 98                	jmp    80138b <sys_env_set_status+0x12>
+  8013f3:	89 c2                	mov    %eax,%edx
+  8013f5:	c1 ea 04             	shr    $0x4,%edx
+  8013f8:	83 e2 0f             	and    $0xf,%edx
+  8013fb:	83 fa 02             	cmp    $0x2,%edx
+  8013fe:	77 e5                	ja     8013e5 <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  801400:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801403:	83 f8 02             	cmp    $0x2,%eax
+  801406:	0f 97 c1             	seta   %cl
+  801409:	0f b6 c9             	movzbl %cl,%ecx
+  80140c:	eb d7                	jmp    8013e5 <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  80140e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801413:	b8 08 00 00 00       	mov    $0x8,%eax
+  801418:	8b 55 08             	mov    0x8(%ebp),%edx
+  80141b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80141e:	89 df                	mov    %ebx,%edi
+  801420:	89 de                	mov    %ebx,%esi
+  801422:	cd 30                	int    $0x30
+  801424:	eb 90                	jmp    8013b6 <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801426:	83 ec 0c             	sub    $0xc,%esp
+  801429:	50                   	push   %eax
+  80142a:	6a 08                	push   $0x8
+  80142c:	68 b9 2f 80 00       	push   $0x802fb9
+  801431:	6a 4a                	push   $0x4a
+  801433:	68 d6 2f 80 00       	push   $0x802fd6
+  801438:	e8 0c 15 00 00       	call   802949 <_panic>
+
+0080143d <sys_sysinfo>:
+{
+  80143d:	55                   	push   %ebp
+  80143e:	89 e5                	mov    %esp,%ebp
+  801440:	57                   	push   %edi
+  801441:	56                   	push   %esi
+  801442:	53                   	push   %ebx
+  801443:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801446:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80144d:	78 36                	js     801485 <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  80144f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801456:	74 79                	je     8014d1 <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  801458:	8b 55 08             	mov    0x8(%ebp),%edx
+  80145b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801460:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801465:	89 cb                	mov    %ecx,%ebx
+  801467:	89 cf                	mov    %ecx,%edi
+  801469:	89 ce                	mov    %ecx,%esi
+  80146b:	55                   	push   %ebp
+  80146c:	68 75 14 80 00       	push   $0x801475
+  801471:	89 e5                	mov    %esp,%ebp
+  801473:	0f 34                	sysenter
+  801475:	83 c4 04             	add    $0x4,%esp
+  801478:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801479:	85 c0                	test   %eax,%eax
+  80147b:	7f 6b                	jg     8014e8 <sys_sysinfo+0xab>
+}
+  80147d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801480:	5b                   	pop    %ebx
+  801481:	5e                   	pop    %esi
+  801482:	5f                   	pop    %edi
+  801483:	5d                   	pop    %ebp
+  801484:	c3                   	ret
+  801485:	b8 01 00 00 00       	mov    $0x1,%eax
+  80148a:	0f a2                	cpuid
+		return 0;
+  80148c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801491:	f6 c6 08             	test   $0x8,%dh
+  801494:	74 15                	je     8014ab <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801496:	89 c2                	mov    %eax,%edx
+  801498:	c1 ea 08             	shr    $0x8,%edx
+  80149b:	83 e2 0f             	and    $0xf,%edx
+  80149e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8014a3:	83 fa 06             	cmp    $0x6,%edx
+  8014a6:	74 0e                	je     8014b6 <sys_sysinfo+0x79>
+  8014a8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8014ab:	0f b6 c9             	movzbl %cl,%ecx
+  8014ae:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8014b4:	eb 99                	jmp    80144f <sys_sysinfo+0x12>
+  8014b6:	89 c2                	mov    %eax,%edx
+  8014b8:	c1 ea 04             	shr    $0x4,%edx
+  8014bb:	83 e2 0f             	and    $0xf,%edx
+  8014be:	83 fa 02             	cmp    $0x2,%edx
+  8014c1:	77 e5                	ja     8014a8 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  8014c3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014c6:	83 f8 02             	cmp    $0x2,%eax
+  8014c9:	0f 97 c1             	seta   %cl
+  8014cc:	0f b6 c9             	movzbl %cl,%ecx
+  8014cf:	eb d7                	jmp    8014a8 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  8014d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014d6:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8014db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014de:	89 cb                	mov    %ecx,%ebx
+  8014e0:	89 cf                	mov    %ecx,%edi
+  8014e2:	89 ce                	mov    %ecx,%esi
+  8014e4:	cd 30                	int    $0x30
+  8014e6:	eb 91                	jmp    801479 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014e8:	83 ec 0c             	sub    $0xc,%esp
+  8014eb:	50                   	push   %eax
+  8014ec:	6a 0b                	push   $0xb
+  8014ee:	68 b9 2f 80 00       	push   $0x802fb9
+  8014f3:	6a 4a                	push   $0x4a
+  8014f5:	68 d6 2f 80 00       	push   $0x802fd6
+  8014fa:	e8 4a 14 00 00       	call   802949 <_panic>
+
+008014ff <sys_env_set_trapframe>:
+{
+  8014ff:	55                   	push   %ebp
+  801500:	89 e5                	mov    %esp,%ebp
+  801502:	57                   	push   %edi
+  801503:	56                   	push   %esi
+  801504:	53                   	push   %ebx
+  801505:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801508:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80150f:	78 37                	js     801548 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  801511:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801518:	74 7a                	je     801594 <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  80151a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80151f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801522:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801525:	b8 13 00 00 00       	mov    $0x13,%eax
+  80152a:	89 df                	mov    %ebx,%edi
+  80152c:	89 de                	mov    %ebx,%esi
+  80152e:	55                   	push   %ebp
+  80152f:	68 38 15 80 00       	push   $0x801538
+  801534:	89 e5                	mov    %esp,%ebp
+  801536:	0f 34                	sysenter
+  801538:	83 c4 04             	add    $0x4,%esp
+  80153b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80153c:	85 c0                	test   %eax,%eax
+  80153e:	7f 6c                	jg     8015ac <sys_env_set_trapframe+0xad>
+}
+  801540:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801543:	5b                   	pop    %ebx
+  801544:	5e                   	pop    %esi
+  801545:	5f                   	pop    %edi
+  801546:	5d                   	pop    %ebp
+  801547:	c3                   	ret
+  801548:	b8 01 00 00 00       	mov    $0x1,%eax
+  80154d:	0f a2                	cpuid
+		return 0;
+  80154f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801554:	f6 c6 08             	test   $0x8,%dh
+  801557:	74 15                	je     80156e <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801559:	89 c2                	mov    %eax,%edx
+  80155b:	c1 ea 08             	shr    $0x8,%edx
+  80155e:	83 e2 0f             	and    $0xf,%edx
+  801561:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801566:	83 fa 06             	cmp    $0x6,%edx
+  801569:	74 0e                	je     801579 <sys_env_set_trapframe+0x7a>
+  80156b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80156e:	0f b6 c9             	movzbl %cl,%ecx
+  801571:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801577:	eb 98                	jmp    801511 <sys_env_set_trapframe+0x12>
+  801579:	89 c2                	mov    %eax,%edx
+  80157b:	c1 ea 04             	shr    $0x4,%edx
+  80157e:	83 e2 0f             	and    $0xf,%edx
+  801581:	83 fa 02             	cmp    $0x2,%edx
+  801584:	77 e5                	ja     80156b <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  801586:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801589:	83 f8 02             	cmp    $0x2,%eax
+  80158c:	0f 97 c1             	seta   %cl
+  80158f:	0f b6 c9             	movzbl %cl,%ecx
+  801592:	eb d7                	jmp    80156b <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  801594:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801599:	b8 13 00 00 00       	mov    $0x13,%eax
+  80159e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015a4:	89 df                	mov    %ebx,%edi
+  8015a6:	89 de                	mov    %ebx,%esi
+  8015a8:	cd 30                	int    $0x30
+  8015aa:	eb 90                	jmp    80153c <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015ac:	83 ec 0c             	sub    $0xc,%esp
+  8015af:	50                   	push   %eax
+  8015b0:	6a 13                	push   $0x13
+  8015b2:	68 b9 2f 80 00       	push   $0x802fb9
+  8015b7:	6a 4a                	push   $0x4a
+  8015b9:	68 d6 2f 80 00       	push   $0x802fd6
+  8015be:	e8 86 13 00 00       	call   802949 <_panic>
+
+008015c3 <sys_env_set_stack_limit>:
+{
+  8015c3:	55                   	push   %ebp
+  8015c4:	89 e5                	mov    %esp,%ebp
+  8015c6:	57                   	push   %edi
+  8015c7:	56                   	push   %esi
+  8015c8:	53                   	push   %ebx
+  8015c9:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8015cc:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8015d3:	78 37                	js     80160c <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  8015d5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8015dc:	74 7a                	je     801658 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  8015de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015e9:	b8 19 00 00 00       	mov    $0x19,%eax
+  8015ee:	89 df                	mov    %ebx,%edi
+  8015f0:	89 de                	mov    %ebx,%esi
+  8015f2:	55                   	push   %ebp
+  8015f3:	68 fc 15 80 00       	push   $0x8015fc
+  8015f8:	89 e5                	mov    %esp,%ebp
+  8015fa:	0f 34                	sysenter
+  8015fc:	83 c4 04             	add    $0x4,%esp
+  8015ff:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801600:	85 c0                	test   %eax,%eax
+  801602:	7f 6c                	jg     801670 <sys_env_set_stack_limit+0xad>
+}
+  801604:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801607:	5b                   	pop    %ebx
+  801608:	5e                   	pop    %esi
+  801609:	5f                   	pop    %edi
+  80160a:	5d                   	pop    %ebp
+  80160b:	c3                   	ret
+  80160c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801611:	0f a2                	cpuid
+		return 0;
+  801613:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801618:	f6 c6 08             	test   $0x8,%dh
+  80161b:	74 15                	je     801632 <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80161d:	89 c2                	mov    %eax,%edx
+  80161f:	c1 ea 08             	shr    $0x8,%edx
+  801622:	83 e2 0f             	and    $0xf,%edx
+  801625:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80162a:	83 fa 06             	cmp    $0x6,%edx
+  80162d:	74 0e                	je     80163d <sys_env_set_stack_limit+0x7a>
+  80162f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801632:	0f b6 c9             	movzbl %cl,%ecx
+  801635:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80163b:	eb 98                	jmp    8015d5 <sys_env_set_stack_limit+0x12>
+  80163d:	89 c2                	mov    %eax,%edx
+  80163f:	c1 ea 04             	shr    $0x4,%edx
+  801642:	83 e2 0f             	and    $0xf,%edx
+  801645:	83 fa 02             	cmp    $0x2,%edx
+  801648:	77 e5                	ja     80162f <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  80164a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80164d:	83 f8 02             	cmp    $0x2,%eax
+  801650:	0f 97 c1             	seta   %cl
+  801653:	0f b6 c9             	movzbl %cl,%ecx
+  801656:	eb d7                	jmp    80162f <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  801658:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80165d:	b8 19 00 00 00       	mov    $0x19,%eax
+  801662:	8b 55 08             	mov    0x8(%ebp),%edx
+  801665:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801668:	89 df                	mov    %ebx,%edi
+  80166a:	89 de                	mov    %ebx,%esi
+  80166c:	cd 30                	int    $0x30
+  80166e:	eb 90                	jmp    801600 <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801670:	83 ec 0c             	sub    $0xc,%esp
+  801673:	50                   	push   %eax
+  801674:	6a 19                	push   $0x19
+  801676:	68 b9 2f 80 00       	push   $0x802fb9
+  80167b:	6a 4a                	push   $0x4a
+  80167d:	68 d6 2f 80 00       	push   $0x802fd6
+  801682:	e8 c2 12 00 00       	call   802949 <_panic>
+
+00801687 <sys_env_set_pgfault_upcall>:
+{
+  801687:	55                   	push   %ebp
+  801688:	89 e5                	mov    %esp,%ebp
+  80168a:	57                   	push   %edi
+  80168b:	56                   	push   %esi
+  80168c:	53                   	push   %ebx
+  80168d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801690:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801697:	78 37                	js     8016d0 <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  801699:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8016a0:	74 7a                	je     80171c <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  8016a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016ad:	b8 09 00 00 00       	mov    $0x9,%eax
+  8016b2:	89 df                	mov    %ebx,%edi
+  8016b4:	89 de                	mov    %ebx,%esi
+  8016b6:	55                   	push   %ebp
+  8016b7:	68 c0 16 80 00       	push   $0x8016c0
+  8016bc:	89 e5                	mov    %esp,%ebp
+  8016be:	0f 34                	sysenter
+  8016c0:	83 c4 04             	add    $0x4,%esp
+  8016c3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8016c4:	85 c0                	test   %eax,%eax
+  8016c6:	7f 6c                	jg     801734 <sys_env_set_pgfault_upcall+0xad>
+}
+  8016c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016cb:	5b                   	pop    %ebx
+  8016cc:	5e                   	pop    %esi
+  8016cd:	5f                   	pop    %edi
+  8016ce:	5d                   	pop    %ebp
+  8016cf:	c3                   	ret
+  8016d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016d5:	0f a2                	cpuid
+		return 0;
+  8016d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8016dc:	f6 c6 08             	test   $0x8,%dh
+  8016df:	74 15                	je     8016f6 <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016e1:	89 c2                	mov    %eax,%edx
+  8016e3:	c1 ea 08             	shr    $0x8,%edx
+  8016e6:	83 e2 0f             	and    $0xf,%edx
+  8016e9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8016ee:	83 fa 06             	cmp    $0x6,%edx
+  8016f1:	74 0e                	je     801701 <sys_env_set_pgfault_upcall+0x7a>
+  8016f3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8016f6:	0f b6 c9             	movzbl %cl,%ecx
+  8016f9:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8016ff:	eb 98                	jmp    801699 <sys_env_set_pgfault_upcall+0x12>
+  801701:	89 c2                	mov    %eax,%edx
+  801703:	c1 ea 04             	shr    $0x4,%edx
+  801706:	83 e2 0f             	and    $0xf,%edx
+  801709:	83 fa 02             	cmp    $0x2,%edx
+  80170c:	77 e5                	ja     8016f3 <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  80170e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801711:	83 f8 02             	cmp    $0x2,%eax
+  801714:	0f 97 c1             	seta   %cl
+  801717:	0f b6 c9             	movzbl %cl,%ecx
+  80171a:	eb d7                	jmp    8016f3 <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  80171c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801721:	b8 09 00 00 00       	mov    $0x9,%eax
+  801726:	8b 55 08             	mov    0x8(%ebp),%edx
+  801729:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80172c:	89 df                	mov    %ebx,%edi
+  80172e:	89 de                	mov    %ebx,%esi
+  801730:	cd 30                	int    $0x30
+  801732:	eb 90                	jmp    8016c4 <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801734:	83 ec 0c             	sub    $0xc,%esp
+  801737:	50                   	push   %eax
+  801738:	6a 09                	push   $0x9
+  80173a:	68 b9 2f 80 00       	push   $0x802fb9
+  80173f:	6a 4a                	push   $0x4a
+  801741:	68 d6 2f 80 00       	push   $0x802fd6
+  801746:	e8 fe 11 00 00       	call   802949 <_panic>
+
+0080174b <sys_ipc_try_send>:
+{
+  80174b:	55                   	push   %ebp
+  80174c:	89 e5                	mov    %esp,%ebp
+  80174e:	57                   	push   %edi
+  80174f:	56                   	push   %esi
+  801750:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801751:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801758:	78 32                	js     80178c <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  80175a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801761:	74 75                	je     8017d8 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801763:	8b 55 08             	mov    0x8(%ebp),%edx
+  801766:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801769:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80176e:	be 00 00 00 00       	mov    $0x0,%esi
+  801773:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801776:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801779:	55                   	push   %ebp
+  80177a:	68 83 17 80 00       	push   $0x801783
+  80177f:	89 e5                	mov    %esp,%ebp
+  801781:	0f 34                	sysenter
+  801783:	83 c4 04             	add    $0x4,%esp
+  801786:	5d                   	pop    %ebp
+}
+  801787:	5b                   	pop    %ebx
+  801788:	5e                   	pop    %esi
+  801789:	5f                   	pop    %edi
+  80178a:	5d                   	pop    %ebp
+  80178b:	c3                   	ret
+  80178c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801791:	0f a2                	cpuid
+		return 0;
+  801793:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801798:	f6 c6 08             	test   $0x8,%dh
+  80179b:	74 15                	je     8017b2 <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80179d:	89 c2                	mov    %eax,%edx
+  80179f:	c1 ea 08             	shr    $0x8,%edx
+  8017a2:	83 e2 0f             	and    $0xf,%edx
+  8017a5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017aa:	83 fa 06             	cmp    $0x6,%edx
+  8017ad:	74 0e                	je     8017bd <sys_ipc_try_send+0x72>
+  8017af:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8017b2:	0f b6 c9             	movzbl %cl,%ecx
+  8017b5:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8017bb:	eb 9d                	jmp    80175a <sys_ipc_try_send+0xf>
+  8017bd:	89 c2                	mov    %eax,%edx
+  8017bf:	c1 ea 04             	shr    $0x4,%edx
+  8017c2:	83 e2 0f             	and    $0xf,%edx
+  8017c5:	83 fa 02             	cmp    $0x2,%edx
+  8017c8:	77 e5                	ja     8017af <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  8017ca:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017cd:	83 f8 02             	cmp    $0x2,%eax
+  8017d0:	0f 97 c1             	seta   %cl
+  8017d3:	0f b6 c9             	movzbl %cl,%ecx
+  8017d6:	eb d7                	jmp    8017af <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  8017d8:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8017dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8017e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017eb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8017ee:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  8017f0:	eb 95                	jmp    801787 <sys_ipc_try_send+0x3c>
+
+008017f2 <sys_ipc_send>:
+{
+  8017f2:	55                   	push   %ebp
+  8017f3:	89 e5                	mov    %esp,%ebp
+  8017f5:	57                   	push   %edi
+  8017f6:	56                   	push   %esi
+  8017f7:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8017f8:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8017ff:	78 32                	js     801833 <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  801801:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801808:	74 75                	je     80187f <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  80180a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80180d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801810:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801815:	be 00 00 00 00       	mov    $0x0,%esi
+  80181a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80181d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801820:	55                   	push   %ebp
+  801821:	68 2a 18 80 00       	push   $0x80182a
+  801826:	89 e5                	mov    %esp,%ebp
+  801828:	0f 34                	sysenter
+  80182a:	83 c4 04             	add    $0x4,%esp
+  80182d:	5d                   	pop    %ebp
+}
+  80182e:	5b                   	pop    %ebx
+  80182f:	5e                   	pop    %esi
+  801830:	5f                   	pop    %edi
+  801831:	5d                   	pop    %ebp
+  801832:	c3                   	ret
+  801833:	b8 01 00 00 00       	mov    $0x1,%eax
+  801838:	0f a2                	cpuid
+		return 0;
+  80183a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80183f:	f6 c6 08             	test   $0x8,%dh
+  801842:	74 15                	je     801859 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801844:	89 c2                	mov    %eax,%edx
+  801846:	c1 ea 08             	shr    $0x8,%edx
+  801849:	83 e2 0f             	and    $0xf,%edx
+  80184c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801851:	83 fa 06             	cmp    $0x6,%edx
+  801854:	74 0e                	je     801864 <sys_ipc_send+0x72>
+  801856:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801859:	0f b6 c9             	movzbl %cl,%ecx
+  80185c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801862:	eb 9d                	jmp    801801 <sys_ipc_send+0xf>
+  801864:	89 c2                	mov    %eax,%edx
+  801866:	c1 ea 04             	shr    $0x4,%edx
+  801869:	83 e2 0f             	and    $0xf,%edx
+  80186c:	83 fa 02             	cmp    $0x2,%edx
+  80186f:	77 e5                	ja     801856 <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  801871:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801874:	83 f8 02             	cmp    $0x2,%eax
+  801877:	0f 97 c1             	seta   %cl
+  80187a:	0f b6 c9             	movzbl %cl,%ecx
+  80187d:	eb d7                	jmp    801856 <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  80187f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801884:	be 00 00 00 00       	mov    $0x0,%esi
+  801889:	8b 55 08             	mov    0x8(%ebp),%edx
+  80188c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80188f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801892:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801895:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801897:	eb 95                	jmp    80182e <sys_ipc_send+0x3c>
+
+00801899 <sys_ipc_recv>:
+{
+  801899:	55                   	push   %ebp
+  80189a:	89 e5                	mov    %esp,%ebp
+  80189c:	57                   	push   %edi
+  80189d:	56                   	push   %esi
+  80189e:	53                   	push   %ebx
+  80189f:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8018a2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8018a9:	78 36                	js     8018e1 <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  8018ab:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8018b2:	74 79                	je     80192d <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  8018b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018bc:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8018c1:	89 cb                	mov    %ecx,%ebx
+  8018c3:	89 cf                	mov    %ecx,%edi
+  8018c5:	89 ce                	mov    %ecx,%esi
+  8018c7:	55                   	push   %ebp
+  8018c8:	68 d1 18 80 00       	push   $0x8018d1
+  8018cd:	89 e5                	mov    %esp,%ebp
+  8018cf:	0f 34                	sysenter
+  8018d1:	83 c4 04             	add    $0x4,%esp
+  8018d4:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8018d5:	85 c0                	test   %eax,%eax
+  8018d7:	7f 6b                	jg     801944 <sys_ipc_recv+0xab>
+}
+  8018d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018dc:	5b                   	pop    %ebx
+  8018dd:	5e                   	pop    %esi
+  8018de:	5f                   	pop    %edi
+  8018df:	5d                   	pop    %ebp
+  8018e0:	c3                   	ret
+  8018e1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018e6:	0f a2                	cpuid
+		return 0;
+  8018e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018ed:	f6 c6 08             	test   $0x8,%dh
+  8018f0:	74 15                	je     801907 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018f2:	89 c2                	mov    %eax,%edx
+  8018f4:	c1 ea 08             	shr    $0x8,%edx
+  8018f7:	83 e2 0f             	and    $0xf,%edx
+  8018fa:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018ff:	83 fa 06             	cmp    $0x6,%edx
+  801902:	74 0e                	je     801912 <sys_ipc_recv+0x79>
+  801904:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801907:	0f b6 c9             	movzbl %cl,%ecx
+  80190a:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801910:	eb 99                	jmp    8018ab <sys_ipc_recv+0x12>
+  801912:	89 c2                	mov    %eax,%edx
+  801914:	c1 ea 04             	shr    $0x4,%edx
+  801917:	83 e2 0f             	and    $0xf,%edx
+  80191a:	83 fa 02             	cmp    $0x2,%edx
+  80191d:	77 e5                	ja     801904 <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  80191f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801922:	83 f8 02             	cmp    $0x2,%eax
+  801925:	0f 97 c1             	seta   %cl
+  801928:	0f b6 c9             	movzbl %cl,%ecx
+  80192b:	eb d7                	jmp    801904 <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  80192d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801932:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801937:	8b 55 08             	mov    0x8(%ebp),%edx
+  80193a:	89 cb                	mov    %ecx,%ebx
+  80193c:	89 cf                	mov    %ecx,%edi
+  80193e:	89 ce                	mov    %ecx,%esi
+  801940:	cd 30                	int    $0x30
+  801942:	eb 91                	jmp    8018d5 <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801944:	83 ec 0c             	sub    $0xc,%esp
+  801947:	50                   	push   %eax
+  801948:	6a 0d                	push   $0xd
+  80194a:	68 b9 2f 80 00       	push   $0x802fb9
+  80194f:	6a 4a                	push   $0x4a
+  801951:	68 d6 2f 80 00       	push   $0x802fd6
+  801956:	e8 ee 0f 00 00       	call   802949 <_panic>
+
+0080195b <sys_ipc_send_range>:
+{
+  80195b:	55                   	push   %ebp
+  80195c:	89 e5                	mov    %esp,%ebp
+  80195e:	57                   	push   %edi
+  80195f:	56                   	push   %esi
+  801960:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801961:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801968:	78 30                	js     80199a <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  80196a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801971:	74 73                	je     8019e6 <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801973:	8b 55 08             	mov    0x8(%ebp),%edx
+  801976:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801979:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80197e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801981:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801984:	8b 75 18             	mov    0x18(%ebp),%esi
+  801987:	55                   	push   %ebp
+  801988:	68 91 19 80 00       	push   $0x801991
+  80198d:	89 e5                	mov    %esp,%ebp
+  80198f:	0f 34                	sysenter
+  801991:	83 c4 04             	add    $0x4,%esp
+  801994:	5d                   	pop    %ebp
+}
+  801995:	5b                   	pop    %ebx
+  801996:	5e                   	pop    %esi
+  801997:	5f                   	pop    %edi
+  801998:	5d                   	pop    %ebp
+  801999:	c3                   	ret
+  80199a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80199f:	0f a2                	cpuid
+		return 0;
+  8019a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8019a6:	f6 c6 08             	test   $0x8,%dh
+  8019a9:	74 15                	je     8019c0 <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019ab:	89 c2                	mov    %eax,%edx
+  8019ad:	c1 ea 08             	shr    $0x8,%edx
+  8019b0:	83 e2 0f             	and    $0xf,%edx
+  8019b3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019b8:	83 fa 06             	cmp    $0x6,%edx
+  8019bb:	74 0e                	je     8019cb <sys_ipc_send_range+0x70>
+  8019bd:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8019c0:	0f b6 c9             	movzbl %cl,%ecx
+  8019c3:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8019c9:	eb 9f                	jmp    80196a <sys_ipc_send_range+0xf>
+  8019cb:	89 c2                	mov    %eax,%edx
+  8019cd:	c1 ea 04             	shr    $0x4,%edx
+  8019d0:	83 e2 0f             	and    $0xf,%edx
+  8019d3:	83 fa 02             	cmp    $0x2,%edx
+  8019d6:	77 e5                	ja     8019bd <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  8019d8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019db:	83 f8 02             	cmp    $0x2,%eax
+  8019de:	0f 97 c1             	seta   %cl
+  8019e1:	0f b6 c9             	movzbl %cl,%ecx
+  8019e4:	eb d7                	jmp    8019bd <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  8019e6:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8019eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019f1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019f4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8019f7:	8b 75 18             	mov    0x18(%ebp),%esi
+  8019fa:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  8019fc:	eb 97                	jmp    801995 <sys_ipc_send_range+0x3a>
+
+008019fe <sys_ipc_recv_range>:
+{
+  8019fe:	55                   	push   %ebp
+  8019ff:	89 e5                	mov    %esp,%ebp
+  801a01:	57                   	push   %edi
+  801a02:	56                   	push   %esi
+  801a03:	53                   	push   %ebx
+  801a04:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801a07:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a0e:	78 37                	js     801a47 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  801a10:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a17:	74 7a                	je     801a93 <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  801a19:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a1e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a21:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a24:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801a29:	89 df                	mov    %ebx,%edi
+  801a2b:	89 de                	mov    %ebx,%esi
+  801a2d:	55                   	push   %ebp
+  801a2e:	68 37 1a 80 00       	push   $0x801a37
+  801a33:	89 e5                	mov    %esp,%ebp
+  801a35:	0f 34                	sysenter
+  801a37:	83 c4 04             	add    $0x4,%esp
+  801a3a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801a3b:	85 c0                	test   %eax,%eax
+  801a3d:	7f 6c                	jg     801aab <sys_ipc_recv_range+0xad>
+}
+  801a3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a42:	5b                   	pop    %ebx
+  801a43:	5e                   	pop    %esi
+  801a44:	5f                   	pop    %edi
+  801a45:	5d                   	pop    %ebp
+  801a46:	c3                   	ret
+  801a47:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a4c:	0f a2                	cpuid
+		return 0;
+  801a4e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801a53:	f6 c6 08             	test   $0x8,%dh
+  801a56:	74 15                	je     801a6d <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a58:	89 c2                	mov    %eax,%edx
+  801a5a:	c1 ea 08             	shr    $0x8,%edx
+  801a5d:	83 e2 0f             	and    $0xf,%edx
+  801a60:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a65:	83 fa 06             	cmp    $0x6,%edx
+  801a68:	74 0e                	je     801a78 <sys_ipc_recv_range+0x7a>
+  801a6a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a6d:	0f b6 c9             	movzbl %cl,%ecx
+  801a70:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801a76:	eb 98                	jmp    801a10 <sys_ipc_recv_range+0x12>
+  801a78:	89 c2                	mov    %eax,%edx
+  801a7a:	c1 ea 04             	shr    $0x4,%edx
+  801a7d:	83 e2 0f             	and    $0xf,%edx
+  801a80:	83 fa 02             	cmp    $0x2,%edx
+  801a83:	77 e5                	ja     801a6a <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801a85:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a88:	83 f8 02             	cmp    $0x2,%eax
+  801a8b:	0f 97 c1             	seta   %cl
+  801a8e:	0f b6 c9             	movzbl %cl,%ecx
+  801a91:	eb d7                	jmp    801a6a <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801a93:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a98:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801a9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aa0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801aa3:	89 df                	mov    %ebx,%edi
+  801aa5:	89 de                	mov    %ebx,%esi
+  801aa7:	cd 30                	int    $0x30
+  801aa9:	eb 90                	jmp    801a3b <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801aab:	83 ec 0c             	sub    $0xc,%esp
+  801aae:	50                   	push   %eax
+  801aaf:	6a 1f                	push   $0x1f
+  801ab1:	68 b9 2f 80 00       	push   $0x802fb9
+  801ab6:	6a 4a                	push   $0x4a
+  801ab8:	68 d6 2f 80 00       	push   $0x802fd6
+  801abd:	e8 87 0e 00 00       	call   802949 <_panic>
+
+00801ac2 <sys_ipc_call>:
+{
+  801ac2:	55                   	push   %ebp
+  801ac3:	89 e5                	mov    %esp,%ebp
+  801ac5:	57                   	push   %edi
+  801ac6:	56                   	push   %esi
+  801ac7:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801ac8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801acb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801ad0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801ad3:	55                   	push   %ebp
+  801ad4:	56                   	push   %esi
+  801ad5:	8b 0e                	mov    (%esi),%ecx
+  801ad7:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801ada:	8b 7e 08             	mov    0x8(%esi),%edi
+  801add:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801ae0:	8b 76 0c             	mov    0xc(%esi),%esi
+  801ae3:	cd 30                	int    $0x30
+  801ae5:	87 34 24             	xchg   %esi,(%esp)
+  801ae8:	89 0e                	mov    %ecx,(%esi)
+  801aea:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801aed:	89 7e 08             	mov    %edi,0x8(%esi)
+  801af0:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801af3:	8f 46 0c             	pop    0xc(%esi)
+  801af6:	5d                   	pop    %ebp
+}
+  801af7:	5b                   	pop    %ebx
+  801af8:	5e                   	pop    %esi
+  801af9:	5f                   	pop    %edi
+  801afa:	5d                   	pop    %ebp
+  801afb:	c3                   	ret
+
+00801afc <sys_ipc_reply_wait>:
+{
+  801afc:	55                   	push   %ebp
+  801afd:	89 e5                	mov    %esp,%ebp
+  801aff:	57                   	push   %edi
+  801b00:	56                   	push   %esi
+  801b01:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801b02:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b05:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801b0a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b0d:	55                   	push   %ebp
+  801b0e:	56                   	push   %esi
+  801b0f:	8b 0e                	mov    (%esi),%ecx
+  801b11:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801b14:	8b 7e 08             	mov    0x8(%esi),%edi
+  801b17:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801b1a:	8b 76 0c             	mov    0xc(%esi),%esi
+  801b1d:	cd 30                	int    $0x30
+  801b1f:	87 34 24             	xchg   %esi,(%esp)
+  801b22:	89 0e                	mov    %ecx,(%esi)
+  801b24:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801b27:	89 7e 08             	mov    %edi,0x8(%esi)
+  801b2a:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801b2d:	8f 46 0c             	pop    0xc(%esi)
+  801b30:	5d                   	pop    %ebp
+}
+  801b31:	5b                   	pop    %ebx
+  801b32:	5e                   	pop    %esi
+  801b33:	5f                   	pop    %edi
+  801b34:	5d                   	pop    %ebp
+  801b35:	c3                   	ret
+
+00801b36 <sys_ipc_send_msg>:
+{
+  801b36:	55                   	push   %ebp
+  801b37:	89 e5                	mov    %esp,%ebp
+  801b39:	57                   	push   %edi
+  801b3a:	56                   	push   %esi
+  801b3b:	53                   	push   %ebx
+  801b3c:	83 ec 20             	sub    $0x20,%esp
+  801b3f:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801b42:	8b 10                	mov    (%eax),%edx
+  801b44:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801b47:	8b 50 04             	mov    0x4(%eax),%edx
+  801b4a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801b4d:	8b 50 08             	mov    0x8(%eax),%edx
+  801b50:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801b53:	8b 50 0c             	mov    0xc(%eax),%edx
+  801b56:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801b59:	8b 40 10             	mov    0x10(%eax),%eax
+  801b5c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801b5f:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801b62:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b65:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801b6a:	55                   	push   %ebp
+  801b6b:	56                   	push   %esi
+  801b6c:	8b 0e                	mov    (%esi),%ecx
+  801b6e:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801b71:	8b 7e 08             	mov    0x8(%esi),%edi
+  801b74:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801b77:	8b 76 0c             	mov    0xc(%esi),%esi
+  801b7a:	cd 30                	int    $0x30
+  801b7c:	87 34 24             	xchg   %esi,(%esp)
+  801b7f:	89 0e                	mov    %ecx,(%esi)
+  801b81:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801b84:	89 7e 08             	mov    %edi,0x8(%esi)
+  801b87:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801b8a:	8f 46 0c             	pop    0xc(%esi)
+  801b8d:	5d                   	pop    %ebp
+}
+  801b8e:	83 c4 20             	add    $0x20,%esp
+  801b91:	5b                   	pop    %ebx
+  801b92:	5e                   	pop    %esi
+  801b93:	5f                   	pop    %edi
+  801b94:	5d                   	pop    %ebp
+  801b95:	c3                   	ret
+
+00801b96 <sys_fork>:
+{
+  801b96:	55                   	push   %ebp
+  801b97:	89 e5                	mov    %esp,%ebp
+  801b99:	57                   	push   %edi
+  801b9a:	56                   	push   %esi
+  801b9b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801b9c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ba3:	78 2e                	js     801bd3 <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801ba5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801bac:	74 71                	je     801c1f <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801bae:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bb3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801bb8:	89 d1                	mov    %edx,%ecx
+  801bba:	89 d3                	mov    %edx,%ebx
+  801bbc:	89 d7                	mov    %edx,%edi
+  801bbe:	89 d6                	mov    %edx,%esi
+  801bc0:	55                   	push   %ebp
+  801bc1:	68 ca 1b 80 00       	push   $0x801bca
+  801bc6:	89 e5                	mov    %esp,%ebp
+  801bc8:	0f 34                	sysenter
+  801bca:	83 c4 04             	add    $0x4,%esp
+  801bcd:	5d                   	pop    %ebp
+}
+  801bce:	5b                   	pop    %ebx
+  801bcf:	5e                   	pop    %esi
+  801bd0:	5f                   	pop    %edi
+  801bd1:	5d                   	pop    %ebp
+  801bd2:	c3                   	ret
+  801bd3:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bd8:	0f a2                	cpuid
+		return 0;
+  801bda:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801bdf:	f6 c6 08             	test   $0x8,%dh
+  801be2:	74 15                	je     801bf9 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801be4:	89 c2                	mov    %eax,%edx
+  801be6:	c1 ea 08             	shr    $0x8,%edx
+  801be9:	83 e2 0f             	and    $0xf,%edx
+  801bec:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801bf1:	83 fa 06             	cmp    $0x6,%edx
+  801bf4:	74 0e                	je     801c04 <sys_fork+0x6e>
+  801bf6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801bf9:	0f b6 c9             	movzbl %cl,%ecx
+  801bfc:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801c02:	eb a1                	jmp    801ba5 <sys_fork+0xf>
+  801c04:	89 c2                	mov    %eax,%edx
+  801c06:	c1 ea 04             	shr    $0x4,%edx
+  801c09:	83 e2 0f             	and    $0xf,%edx
+  801c0c:	83 fa 02             	cmp    $0x2,%edx
+  801c0f:	77 e5                	ja     801bf6 <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801c11:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c14:	83 f8 02             	cmp    $0x2,%eax
+  801c17:	0f 97 c1             	seta   %cl
+  801c1a:	0f b6 c9             	movzbl %cl,%ecx
+  801c1d:	eb d7                	jmp    801bf6 <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801c1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c24:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801c29:	89 d1                	mov    %edx,%ecx
+  801c2b:	89 d3                	mov    %edx,%ebx
+  801c2d:	89 d7                	mov    %edx,%edi
+  801c2f:	89 d6                	mov    %edx,%esi
+  801c31:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801c33:	eb 99                	jmp    801bce <sys_fork+0x38>
+
+00801c35 <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801c35:	55                   	push   %ebp
+  801c36:	89 e5                	mov    %esp,%ebp
+  801c38:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801c3b:	ff 75 14             	push   0x14(%ebp)
+  801c3e:	ff 75 10             	push   0x10(%ebp)
+  801c41:	ff 75 0c             	push   0xc(%ebp)
+  801c44:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c49:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c4c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801c51:	e8 81 ee ff ff       	call   800ad7 <page_vec_call>
+}
+  801c56:	c9                   	leave
+  801c57:	c3                   	ret
+
+00801c58 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801c58:	55                   	push   %ebp
+  801c59:	89 e5                	mov    %esp,%ebp
+  801c5b:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801c5e:	ff 75 18             	push   0x18(%ebp)
+  801c61:	ff 75 14             	push   0x14(%ebp)
+  801c64:	ff 75 10             	push   0x10(%ebp)
+  801c67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c6a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c6d:	b8 10 00 00 00       	mov    $0x10,%eax
+  801c72:	e8 60 ee ff ff       	call   800ad7 <page_vec_call>
+}
+  801c77:	c9                   	leave
+  801c78:	c3                   	ret
+
+00801c79 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801c79:	55                   	push   %ebp
+  801c7a:	89 e5                	mov    %esp,%ebp
+  801c7c:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801c7f:	ff 75 14             	push   0x14(%ebp)
+  801c82:	ff 75 10             	push   0x10(%ebp)
+  801c85:	ff 75 0c             	push   0xc(%ebp)
+  801c88:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c8d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c90:	b8 11 00 00 00       	mov    $0x11,%eax
+  801c95:	e8 3d ee ff ff       	call   800ad7 <page_vec_call>
+}
+  801c9a:	c9                   	leave
+  801c9b:	c3                   	ret
+
+00801c9c <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801c9c:	55                   	push   %ebp
+  801c9d:	89 e5                	mov    %esp,%ebp
+  801c9f:	57                   	push   %edi
+  801ca0:	56                   	push   %esi
+  801ca1:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801ca2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ca9:	78 32                	js     801cdd <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801cab:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801cb2:	74 75                	je     801d29 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801cb4:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cb7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cba:	b8 12 00 00 00       	mov    $0x12,%eax
+  801cbf:	be 00 00 00 00       	mov    $0x0,%esi
+  801cc4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801cc7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801cca:	55                   	push   %ebp
+  801ccb:	68 d4 1c 80 00       	push   $0x801cd4
+  801cd0:	89 e5                	mov    %esp,%ebp
+  801cd2:	0f 34                	sysenter
+  801cd4:	83 c4 04             	add    $0x4,%esp
+  801cd7:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801cd8:	5b                   	pop    %ebx
+  801cd9:	5e                   	pop    %esi
+  801cda:	5f                   	pop    %edi
+  801cdb:	5d                   	pop    %ebp
+  801cdc:	c3                   	ret
+  801cdd:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ce2:	0f a2                	cpuid
+		return 0;
+  801ce4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801ce9:	f6 c6 08             	test   $0x8,%dh
+  801cec:	74 15                	je     801d03 <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801cee:	89 c2                	mov    %eax,%edx
+  801cf0:	c1 ea 08             	shr    $0x8,%edx
+  801cf3:	83 e2 0f             	and    $0xf,%edx
+  801cf6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801cfb:	83 fa 06             	cmp    $0x6,%edx
+  801cfe:	74 0e                	je     801d0e <sys_vm_ranges+0x72>
+  801d00:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801d03:	0f b6 c9             	movzbl %cl,%ecx
+  801d06:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801d0c:	eb 9d                	jmp    801cab <sys_vm_ranges+0xf>
+  801d0e:	89 c2                	mov    %eax,%edx
+  801d10:	c1 ea 04             	shr    $0x4,%edx
+  801d13:	83 e2 0f             	and    $0xf,%edx
+  801d16:	83 fa 02             	cmp    $0x2,%edx
+  801d19:	77 e5                	ja     801d00 <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  801d1b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d1e:	83 f8 02             	cmp    $0x2,%eax
+  801d21:	0f 97 c1             	seta   %cl
+  801d24:	0f b6 c9             	movzbl %cl,%ecx
+  801d27:	eb d7                	jmp    801d00 <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801d29:	b8 12 00 00 00       	mov    $0x12,%eax
+  801d2e:	be 00 00 00 00       	mov    $0x0,%esi
+  801d33:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d36:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d39:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d3c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801d3f:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801d41:	eb 95                	jmp    801cd8 <sys_vm_ranges+0x3c>
+
+00801d43 <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801d43:	55                   	push   %ebp
+  801d44:	89 e5                	mov    %esp,%ebp
+  801d46:	57                   	push   %edi
+  801d47:	56                   	push   %esi
+  801d48:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801d49:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801d50:	78 31                	js     801d83 <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801d52:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801d59:	74 74                	je     801dcf <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801d5b:	be 00 00 00 00       	mov    $0x0,%esi
+  801d60:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d63:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d66:	b8 14 00 00 00       	mov    $0x14,%eax
+  801d6b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d6e:	89 f7                	mov    %esi,%edi
+  801d70:	55                   	push   %ebp
+  801d71:	68 7a 1d 80 00       	push   $0x801d7a
+  801d76:	89 e5                	mov    %esp,%ebp
+  801d78:	0f 34                	sysenter
+  801d7a:	83 c4 04             	add    $0x4,%esp
+  801d7d:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801d7e:	5b                   	pop    %ebx
+  801d7f:	5e                   	pop    %esi
+  801d80:	5f                   	pop    %edi
+  801d81:	5d                   	pop    %ebp
+  801d82:	c3                   	ret
+  801d83:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d88:	0f a2                	cpuid
+		return 0;
+  801d8a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801d8f:	f6 c6 08             	test   $0x8,%dh
+  801d92:	74 15                	je     801da9 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d94:	89 c2                	mov    %eax,%edx
+  801d96:	c1 ea 08             	shr    $0x8,%edx
+  801d99:	83 e2 0f             	and    $0xf,%edx
+  801d9c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801da1:	83 fa 06             	cmp    $0x6,%edx
+  801da4:	74 0e                	je     801db4 <sys_spawn+0x71>
+  801da6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801da9:	0f b6 c9             	movzbl %cl,%ecx
+  801dac:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801db2:	eb 9e                	jmp    801d52 <sys_spawn+0xf>
+  801db4:	89 c2                	mov    %eax,%edx
+  801db6:	c1 ea 04             	shr    $0x4,%edx
+  801db9:	83 e2 0f             	and    $0xf,%edx
+  801dbc:	83 fa 02             	cmp    $0x2,%edx
+  801dbf:	77 e5                	ja     801da6 <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  801dc1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801dc4:	83 f8 02             	cmp    $0x2,%eax
+  801dc7:	0f 97 c1             	seta   %cl
+  801dca:	0f b6 c9             	movzbl %cl,%ecx
+  801dcd:	eb d7                	jmp    801da6 <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  801dcf:	be 00 00 00 00       	mov    $0x0,%esi
+  801dd4:	b8 14 00 00 00       	mov    $0x14,%eax
+  801dd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ddc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ddf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801de2:	89 f7                	mov    %esi,%edi
+  801de4:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  801de6:	eb 96                	jmp    801d7e <sys_spawn+0x3b>
+
+00801de8 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  801de8:	55                   	push   %ebp
+  801de9:	89 e5                	mov    %esp,%ebp
+  801deb:	57                   	push   %edi
+  801dec:	56                   	push   %esi
+  801ded:	53                   	push   %ebx
+  801dee:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801df1:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801df8:	78 37                	js     801e31 <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  801dfa:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e01:	74 7a                	je     801e7d <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  801e03:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e08:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e0b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e0e:	b8 15 00 00 00       	mov    $0x15,%eax
+  801e13:	89 df                	mov    %ebx,%edi
+  801e15:	89 de                	mov    %ebx,%esi
+  801e17:	55                   	push   %ebp
+  801e18:	68 21 1e 80 00       	push   $0x801e21
+  801e1d:	89 e5                	mov    %esp,%ebp
+  801e1f:	0f 34                	sysenter
+  801e21:	83 c4 04             	add    $0x4,%esp
+  801e24:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801e25:	85 c0                	test   %eax,%eax
+  801e27:	7f 6c                	jg     801e95 <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  801e29:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e2c:	5b                   	pop    %ebx
+  801e2d:	5e                   	pop    %esi
+  801e2e:	5f                   	pop    %edi
+  801e2f:	5d                   	pop    %ebp
+  801e30:	c3                   	ret
+  801e31:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e36:	0f a2                	cpuid
+		return 0;
+  801e38:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801e3d:	f6 c6 08             	test   $0x8,%dh
+  801e40:	74 15                	je     801e57 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e42:	89 c2                	mov    %eax,%edx
+  801e44:	c1 ea 08             	shr    $0x8,%edx
+  801e47:	83 e2 0f             	and    $0xf,%edx
+  801e4a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e4f:	83 fa 06             	cmp    $0x6,%edx
+  801e52:	74 0e                	je     801e62 <sys_shm_create+0x7a>
+  801e54:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801e57:	0f b6 c9             	movzbl %cl,%ecx
+  801e5a:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801e60:	eb 98                	jmp    801dfa <sys_shm_create+0x12>
+  801e62:	89 c2                	mov    %eax,%edx
+  801e64:	c1 ea 04             	shr    $0x4,%edx
+  801e67:	83 e2 0f             	and    $0xf,%edx
+  801e6a:	83 fa 02             	cmp    $0x2,%edx
+  801e6d:	77 e5                	ja     801e54 <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  801e6f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e72:	83 f8 02             	cmp    $0x2,%eax
+  801e75:	0f 97 c1             	seta   %cl
+  801e78:	0f b6 c9             	movzbl %cl,%ecx
+  801e7b:	eb d7                	jmp    801e54 <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  801e7d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e82:	b8 15 00 00 00       	mov    $0x15,%eax
+  801e87:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e8a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e8d:	89 df                	mov    %ebx,%edi
+  801e8f:	89 de                	mov    %ebx,%esi
+  801e91:	cd 30                	int    $0x30
+  801e93:	eb 90                	jmp    801e25 <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801e95:	83 ec 0c             	sub    $0xc,%esp
+  801e98:	50                   	push   %eax
+  801e99:	6a 15                	push   $0x15
+  801e9b:	68 b9 2f 80 00       	push   $0x802fb9
+  801ea0:	6a 4a                	push   $0x4a
+  801ea2:	68 d6 2f 80 00       	push   $0x802fd6
+  801ea7:	e8 9d 0a 00 00       	call   802949 <_panic>
+
+00801eac <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  801eac:	55                   	push   %ebp
+  801ead:	89 e5                	mov    %esp,%ebp
+  801eaf:	57                   	push   %edi
+  801eb0:	56                   	push   %esi
+  801eb1:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801eb2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801eb9:	78 32                	js     801eed <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  801ebb:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ec2:	74 75                	je     801f39 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801ec4:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ec7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801eca:	b8 16 00 00 00       	mov    $0x16,%eax
+  801ecf:	be 00 00 00 00       	mov    $0x0,%esi
+  801ed4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ed7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801eda:	55                   	push   %ebp
+  801edb:	68 e4 1e 80 00       	push   $0x801ee4
+  801ee0:	89 e5                	mov    %esp,%ebp
+  801ee2:	0f 34                	sysenter
+  801ee4:	83 c4 04             	add    $0x4,%esp
+  801ee7:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  801ee8:	5b                   	pop    %ebx
+  801ee9:	5e                   	pop    %esi
+  801eea:	5f                   	pop    %edi
+  801eeb:	5d                   	pop    %ebp
+  801eec:	c3                   	ret
+  801eed:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ef2:	0f a2                	cpuid
+		return 0;
+  801ef4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801ef9:	f6 c6 08             	test   $0x8,%dh
+  801efc:	74 15                	je     801f13 <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801efe:	89 c2                	mov    %eax,%edx
+  801f00:	c1 ea 08             	shr    $0x8,%edx
+  801f03:	83 e2 0f             	and    $0xf,%edx
+  801f06:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f0b:	83 fa 06             	cmp    $0x6,%edx
+  801f0e:	74 0e                	je     801f1e <sys_shm_attach+0x72>
+  801f10:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801f13:	0f b6 c9             	movzbl %cl,%ecx
+  801f16:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801f1c:	eb 9d                	jmp    801ebb <sys_shm_attach+0xf>
+  801f1e:	89 c2                	mov    %eax,%edx
+  801f20:	c1 ea 04             	shr    $0x4,%edx
+  801f23:	83 e2 0f             	and    $0xf,%edx
+  801f26:	83 fa 02             	cmp    $0x2,%edx
+  801f29:	77 e5                	ja     801f10 <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  801f2b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f2e:	83 f8 02             	cmp    $0x2,%eax
+  801f31:	0f 97 c1             	seta   %cl
+  801f34:	0f b6 c9             	movzbl %cl,%ecx
+  801f37:	eb d7                	jmp    801f10 <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  801f39:	b8 16 00 00 00       	mov    $0x16,%eax
+  801f3e:	be 00 00 00 00       	mov    $0x0,%esi
+  801f43:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f46:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f49:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f4c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801f4f:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  801f51:	eb 95                	jmp    801ee8 <sys_shm_attach+0x3c>
+
+00801f53 <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  801f53:	55                   	push   %ebp
+  801f54:	89 e5                	mov    %esp,%ebp
+  801f56:	57                   	push   %edi
+  801f57:	56                   	push   %esi
+  801f58:	53                   	push   %ebx
+  801f59:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801f5c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f63:	78 38                	js     801f9d <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  801f65:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f6c:	74 7b                	je     801fe9 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  801f6e:	be 00 00 00 00       	mov    $0x0,%esi
+  801f73:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f76:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f79:	b8 17 00 00 00       	mov    $0x17,%eax
+  801f7e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f81:	89 f7                	mov    %esi,%edi
+  801f83:	55                   	push   %ebp
+  801f84:	68 8d 1f 80 00       	push   $0x801f8d
+  801f89:	89 e5                	mov    %esp,%ebp
+  801f8b:	0f 34                	sysenter
+  801f8d:	83 c4 04             	add    $0x4,%esp
+  801f90:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801f91:	85 c0                	test   %eax,%eax
+  801f93:	7f 6d                	jg     802002 <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  801f95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f98:	5b                   	pop    %ebx
+  801f99:	5e                   	pop    %esi
+  801f9a:	5f                   	pop    %edi
+  801f9b:	5d                   	pop    %ebp
+  801f9c:	c3                   	ret
+  801f9d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fa2:	0f a2                	cpuid
+		return 0;
+  801fa4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801fa9:	f6 c6 08             	test   $0x8,%dh
+  801fac:	74 15                	je     801fc3 <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fae:	89 c2                	mov    %eax,%edx
+  801fb0:	c1 ea 08             	shr    $0x8,%edx
+  801fb3:	83 e2 0f             	and    $0xf,%edx
+  801fb6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801fbb:	83 fa 06             	cmp    $0x6,%edx
+  801fbe:	74 0e                	je     801fce <sys_shm_detach+0x7b>
+  801fc0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801fc3:	0f b6 c9             	movzbl %cl,%ecx
+  801fc6:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801fcc:	eb 97                	jmp    801f65 <sys_shm_detach+0x12>
+  801fce:	89 c2                	mov    %eax,%edx
+  801fd0:	c1 ea 04             	shr    $0x4,%edx
+  801fd3:	83 e2 0f             	and    $0xf,%edx
+  801fd6:	83 fa 02             	cmp    $0x2,%edx
+  801fd9:	77 e5                	ja     801fc0 <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  801fdb:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fde:	83 f8 02             	cmp    $0x2,%eax
+  801fe1:	0f 97 c1             	seta   %cl
+  801fe4:	0f b6 c9             	movzbl %cl,%ecx
+  801fe7:	eb d7                	jmp    801fc0 <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  801fe9:	be 00 00 00 00       	mov    $0x0,%esi
+  801fee:	b8 17 00 00 00       	mov    $0x17,%eax
+  801ff3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ff6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ff9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ffc:	89 f7                	mov    %esi,%edi
+  801ffe:	cd 30                	int    $0x30
+  802000:	eb 8f                	jmp    801f91 <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802002:	83 ec 0c             	sub    $0xc,%esp
+  802005:	50                   	push   %eax
+  802006:	6a 17                	push   $0x17
+  802008:	68 b9 2f 80 00       	push   $0x802fb9
+  80200d:	6a 4a                	push   $0x4a
+  80200f:	68 d6 2f 80 00       	push   $0x802fd6
+  802014:	e8 30 09 00 00       	call   802949 <_panic>
+
+00802019 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  802019:	55                   	push   %ebp
+  80201a:	89 e5                	mov    %esp,%ebp
+  80201c:	57                   	push   %edi
+  80201d:	56                   	push   %esi
+  80201e:	53                   	push   %ebx
+  80201f:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802022:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802029:	78 36                	js     802061 <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  80202b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802032:	74 79                	je     8020ad <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  802034:	8b 55 08             	mov    0x8(%ebp),%edx
+  802037:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80203c:	b8 18 00 00 00       	mov    $0x18,%eax
+  802041:	89 cb                	mov    %ecx,%ebx
+  802043:	89 cf                	mov    %ecx,%edi
+  802045:	89 ce                	mov    %ecx,%esi
+  802047:	55                   	push   %ebp
+  802048:	68 51 20 80 00       	push   $0x802051
+  80204d:	89 e5                	mov    %esp,%ebp
+  80204f:	0f 34                	sysenter
+  802051:	83 c4 04             	add    $0x4,%esp
+  802054:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802055:	85 c0                	test   %eax,%eax
+  802057:	7f 6b                	jg     8020c4 <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  802059:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80205c:	5b                   	pop    %ebx
+  80205d:	5e                   	pop    %esi
+  80205e:	5f                   	pop    %edi
+  80205f:	5d                   	pop    %ebp
+  802060:	c3                   	ret
+  802061:	b8 01 00 00 00       	mov    $0x1,%eax
+  802066:	0f a2                	cpuid
+		return 0;
+  802068:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80206d:	f6 c6 08             	test   $0x8,%dh
+  802070:	74 15                	je     802087 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802072:	89 c2                	mov    %eax,%edx
+  802074:	c1 ea 08             	shr    $0x8,%edx
+  802077:	83 e2 0f             	and    $0xf,%edx
+  80207a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80207f:	83 fa 06             	cmp    $0x6,%edx
+  802082:	74 0e                	je     802092 <sys_shm_remove+0x79>
+  802084:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802087:	0f b6 c9             	movzbl %cl,%ecx
+  80208a:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802090:	eb 99                	jmp    80202b <sys_shm_remove+0x12>
+  802092:	89 c2                	mov    %eax,%edx
+  802094:	c1 ea 04             	shr    $0x4,%edx
+  802097:	83 e2 0f             	and    $0xf,%edx
+  80209a:	83 fa 02             	cmp    $0x2,%edx
+  80209d:	77 e5                	ja     802084 <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  80209f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020a2:	83 f8 02             	cmp    $0x2,%eax
+  8020a5:	0f 97 c1             	seta   %cl
+  8020a8:	0f b6 c9             	movzbl %cl,%ecx
+  8020ab:	eb d7                	jmp    802084 <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  8020ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020b2:	b8 18 00 00 00       	mov    $0x18,%eax
+  8020b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020ba:	89 cb                	mov    %ecx,%ebx
+  8020bc:	89 cf                	mov    %ecx,%edi
+  8020be:	89 ce                	mov    %ecx,%esi
+  8020c0:	cd 30                	int    $0x30
+  8020c2:	eb 91                	jmp    802055 <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8020c4:	83 ec 0c             	sub    $0xc,%esp
+  8020c7:	50                   	push   %eax
+  8020c8:	6a 18                	push   $0x18
+  8020ca:	68 b9 2f 80 00       	push   $0x802fb9
+  8020cf:	6a 4a                	push   $0x4a
+  8020d1:	68 d6 2f 80 00       	push   $0x802fd6
+  8020d6:	e8 6e 08 00 00       	call   802949 <_panic>
+
+008020db <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  8020db:	55                   	push   %ebp
+  8020dc:	89 e5                	mov    %esp,%ebp
+  8020de:	57                   	push   %edi
+  8020df:	56                   	push   %esi
+  8020e0:	53                   	push   %ebx
+  8020e1:	83 ec 0c             	sub    $0xc,%esp
+  8020e4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020e7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8020ea:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  8020ed:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8020f4:	78 32                	js     802128 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  8020f6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8020fd:	74 75                	je     802174 <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  8020ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  802102:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802105:	b8 20 00 00 00       	mov    $0x20,%eax
+  80210a:	be 00 00 00 00       	mov    $0x0,%esi
+  80210f:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802112:	55                   	push   %ebp
+  802113:	68 1c 21 80 00       	push   $0x80211c
+  802118:	89 e5                	mov    %esp,%ebp
+  80211a:	0f 34                	sysenter
+  80211c:	83 c4 04             	add    $0x4,%esp
+  80211f:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  802120:	83 c4 0c             	add    $0xc,%esp
+  802123:	5b                   	pop    %ebx
+  802124:	5e                   	pop    %esi
+  802125:	5f                   	pop    %edi
+  802126:	5d                   	pop    %ebp
+  802127:	c3                   	ret
+  802128:	b8 01 00 00 00       	mov    $0x1,%eax
+  80212d:	0f a2                	cpuid
+		return 0;
+  80212f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802134:	f6 c6 08             	test   $0x8,%dh
+  802137:	74 15                	je     80214e <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802139:	89 c2                	mov    %eax,%edx
+  80213b:	c1 ea 08             	shr    $0x8,%edx
+  80213e:	83 e2 0f             	and    $0xf,%edx
+  802141:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802146:	83 fa 06             	cmp    $0x6,%edx
+  802149:	74 0e                	je     802159 <sys_futex_wait+0x7e>
+  80214b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80214e:	0f b6 c9             	movzbl %cl,%ecx
+  802151:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802157:	eb 9d                	jmp    8020f6 <sys_futex_wait+0x1b>
+  802159:	89 c2                	mov    %eax,%edx
+  80215b:	c1 ea 04             	shr    $0x4,%edx
+  80215e:	83 e2 0f             	and    $0xf,%edx
+  802161:	83 fa 02             	cmp    $0x2,%edx
+  802164:	77 e5                	ja     80214b <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  802166:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802169:	83 f8 02             	cmp    $0x2,%eax
+  80216c:	0f 97 c1             	seta   %cl
+  80216f:	0f b6 c9             	movzbl %cl,%ecx
+  802172:	eb d7                	jmp    80214b <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  802174:	b8 20 00 00 00       	mov    $0x20,%eax
+  802179:	be 00 00 00 00       	mov    $0x0,%esi
+  80217e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802181:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802184:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802187:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  802189:	eb 95                	jmp    802120 <sys_futex_wait+0x45>
+
+0080218b <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80218b:	55                   	push   %ebp
+  80218c:	89 e5                	mov    %esp,%ebp
+  80218e:	57                   	push   %edi
+  80218f:	56                   	push   %esi
+  802190:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802191:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802198:	78 30                	js     8021ca <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  80219a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8021a1:	74 73                	je     802216 <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  8021a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021ae:	b8 21 00 00 00       	mov    $0x21,%eax
+  8021b3:	89 df                	mov    %ebx,%edi
+  8021b5:	89 de                	mov    %ebx,%esi
+  8021b7:	55                   	push   %ebp
+  8021b8:	68 c1 21 80 00       	push   $0x8021c1
+  8021bd:	89 e5                	mov    %esp,%ebp
+  8021bf:	0f 34                	sysenter
+  8021c1:	83 c4 04             	add    $0x4,%esp
+  8021c4:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8021c5:	5b                   	pop    %ebx
+  8021c6:	5e                   	pop    %esi
+  8021c7:	5f                   	pop    %edi
+  8021c8:	5d                   	pop    %ebp
+  8021c9:	c3                   	ret
+  8021ca:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021cf:	0f a2                	cpuid
+		return 0;
+  8021d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8021d6:	f6 c6 08             	test   $0x8,%dh
+  8021d9:	74 15                	je     8021f0 <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021db:	89 c2                	mov    %eax,%edx
+  8021dd:	c1 ea 08             	shr    $0x8,%edx
+  8021e0:	83 e2 0f             	and    $0xf,%edx
+  8021e3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8021e8:	83 fa 06             	cmp    $0x6,%edx
+  8021eb:	74 0e                	je     8021fb <sys_futex_wake+0x70>
+  8021ed:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8021f0:	0f b6 c9             	movzbl %cl,%ecx
+  8021f3:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8021f9:	eb 9f                	jmp    80219a <sys_futex_wake+0xf>
+  8021fb:	89 c2                	mov    %eax,%edx
+  8021fd:	c1 ea 04             	shr    $0x4,%edx
+  802200:	83 e2 0f             	and    $0xf,%edx
+  802203:	83 fa 02             	cmp    $0x2,%edx
+  802206:	77 e5                	ja     8021ed <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  802208:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80220b:	83 f8 02             	cmp    $0x2,%eax
+  80220e:	0f 97 c1             	seta   %cl
+  802211:	0f b6 c9             	movzbl %cl,%ecx
+  802214:	eb d7                	jmp    8021ed <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  802216:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80221b:	b8 21 00 00 00       	mov    $0x21,%eax
+  802220:	8b 55 08             	mov    0x8(%ebp),%edx
+  802223:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802226:	89 df                	mov    %ebx,%edi
+  802228:	89 de                	mov    %ebx,%esi
+  80222a:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  80222c:	eb 97                	jmp    8021c5 <sys_futex_wake+0x3a>
+
+0080222e <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  80222e:	55                   	push   %ebp
+  80222f:	89 e5                	mov    %esp,%ebp
+  802231:	57                   	push   %edi
+  802232:	56                   	push   %esi
+  802233:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802234:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80223b:	78 2e                	js     80226b <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  80223d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802244:	74 71                	je     8022b7 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  802246:	ba 00 00 00 00       	mov    $0x0,%edx
+  80224b:	b8 22 00 00 00       	mov    $0x22,%eax
+  802250:	89 d1                	mov    %edx,%ecx
+  802252:	89 d3                	mov    %edx,%ebx
+  802254:	89 d7                	mov    %edx,%edi
+  802256:	89 d6                	mov    %edx,%esi
+  802258:	55                   	push   %ebp
+  802259:	68 62 22 80 00       	push   $0x802262
+  80225e:	89 e5                	mov    %esp,%ebp
+  802260:	0f 34                	sysenter
+  802262:	83 c4 04             	add    $0x4,%esp
+  802265:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  802266:	5b                   	pop    %ebx
+  802267:	5e                   	pop    %esi
+  802268:	5f                   	pop    %edi
+  802269:	5d                   	pop    %ebp
+  80226a:	c3                   	ret
+  80226b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802270:	0f a2                	cpuid
+		return 0;
+  802272:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802277:	f6 c6 08             	test   $0x8,%dh
+  80227a:	74 15                	je     802291 <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80227c:	89 c2                	mov    %eax,%edx
+  80227e:	c1 ea 08             	shr    $0x8,%edx
+  802281:	83 e2 0f             	and    $0xf,%edx
+  802284:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802289:	83 fa 06             	cmp    $0x6,%edx
+  80228c:	74 0e                	je     80229c <sys_ep_create+0x6e>
+  80228e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802291:	0f b6 c9             	movzbl %cl,%ecx
+  802294:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80229a:	eb a1                	jmp    80223d <sys_ep_create+0xf>
+  80229c:	89 c2                	mov    %eax,%edx
+  80229e:	c1 ea 04             	shr    $0x4,%edx
+  8022a1:	83 e2 0f             	and    $0xf,%edx
+  8022a4:	83 fa 02             	cmp    $0x2,%edx
+  8022a7:	77 e5                	ja     80228e <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  8022a9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022ac:	83 f8 02             	cmp    $0x2,%eax
+  8022af:	0f 97 c1             	seta   %cl
+  8022b2:	0f b6 c9             	movzbl %cl,%ecx
+  8022b5:	eb d7                	jmp    80228e <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  8022b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022bc:	b8 22 00 00 00       	mov    $0x22,%eax
+  8022c1:	89 d1                	mov    %edx,%ecx
+  8022c3:	89 d3                	mov    %edx,%ebx
+  8022c5:	89 d7                	mov    %edx,%edi
+  8022c7:	89 d6                	mov    %edx,%esi
+  8022c9:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  8022cb:	eb 99                	jmp    802266 <sys_ep_create+0x38>
+
+008022cd <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  8022cd:	55                   	push   %ebp
+  8022ce:	89 e5                	mov    %esp,%ebp
+  8022d0:	57                   	push   %edi
+  8022d1:	56                   	push   %esi
+  8022d2:	53                   	push   %ebx
+  8022d3:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8022d6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8022dd:	78 36                	js     802315 <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  8022df:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8022e6:	74 79                	je     802361 <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  8022e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022f0:	b8 23 00 00 00       	mov    $0x23,%eax
+  8022f5:	89 cb                	mov    %ecx,%ebx
+  8022f7:	89 cf                	mov    %ecx,%edi
+  8022f9:	89 ce                	mov    %ecx,%esi
+  8022fb:	55                   	push   %ebp
+  8022fc:	68 05 23 80 00       	push   $0x802305
+  802301:	89 e5                	mov    %esp,%ebp
+  802303:	0f 34                	sysenter
+  802305:	83 c4 04             	add    $0x4,%esp
+  802308:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802309:	85 c0                	test   %eax,%eax
+  80230b:	7f 6b                	jg     802378 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  80230d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802310:	5b                   	pop    %ebx
+  802311:	5e                   	pop    %esi
+  802312:	5f                   	pop    %edi
+  802313:	5d                   	pop    %ebp
+  802314:	c3                   	ret
+  802315:	b8 01 00 00 00       	mov    $0x1,%eax
+  80231a:	0f a2                	cpuid
+		return 0;
+  80231c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802321:	f6 c6 08             	test   $0x8,%dh
+  802324:	74 15                	je     80233b <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802326:	89 c2                	mov    %eax,%edx
+  802328:	c1 ea 08             	shr    $0x8,%edx
+  80232b:	83 e2 0f             	and    $0xf,%edx
+  80232e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802333:	83 fa 06             	cmp    $0x6,%edx
+  802336:	74 0e                	je     802346 <sys_ep_destroy+0x79>
+  802338:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80233b:	0f b6 c9             	movzbl %cl,%ecx
+  80233e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802344:	eb 99                	jmp    8022df <sys_ep_destroy+0x12>
+  802346:	89 c2                	mov    %eax,%edx
+  802348:	c1 ea 04             	shr    $0x4,%edx
+  80234b:	83 e2 0f             	and    $0xf,%edx
+  80234e:	83 fa 02             	cmp    $0x2,%edx
+  802351:	77 e5                	ja     802338 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  802353:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802356:	83 f8 02             	cmp    $0x2,%eax
+  802359:	0f 97 c1             	seta   %cl
+  80235c:	0f b6 c9             	movzbl %cl,%ecx
+  80235f:	eb d7                	jmp    802338 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  802361:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802366:	b8 23 00 00 00       	mov    $0x23,%eax
+  80236b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80236e:	89 cb                	mov    %ecx,%ebx
+  802370:	89 cf                	mov    %ecx,%edi
+  802372:	89 ce                	mov    %ecx,%esi
+  802374:	cd 30                	int    $0x30
+  802376:	eb 91                	jmp    802309 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802378:	83 ec 0c             	sub    $0xc,%esp
+  80237b:	50                   	push   %eax
+  80237c:	6a 23                	push   $0x23
+  80237e:	68 b9 2f 80 00       	push   $0x802fb9
+  802383:	6a 4a                	push   $0x4a
+  802385:	68 d6 2f 80 00       	push   $0x802fd6
+  80238a:	e8 ba 05 00 00       	call   802949 <_panic>
+
+0080238f <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  80238f:	55                   	push   %ebp
+  802390:	89 e5                	mov    %esp,%ebp
+  802392:	57                   	push   %edi
+  802393:	56                   	push   %esi
+  802394:	53                   	push   %ebx
+  802395:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802398:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80239f:	78 37                	js     8023d8 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  8023a1:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8023a8:	74 7a                	je     802424 <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  8023aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023b5:	b8 24 00 00 00       	mov    $0x24,%eax
+  8023ba:	89 df                	mov    %ebx,%edi
+  8023bc:	89 de                	mov    %ebx,%esi
+  8023be:	55                   	push   %ebp
+  8023bf:	68 c8 23 80 00       	push   $0x8023c8
+  8023c4:	89 e5                	mov    %esp,%ebp
+  8023c6:	0f 34                	sysenter
+  8023c8:	83 c4 04             	add    $0x4,%esp
+  8023cb:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8023cc:	85 c0                	test   %eax,%eax
+  8023ce:	7f 6c                	jg     80243c <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  8023d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023d3:	5b                   	pop    %ebx
+  8023d4:	5e                   	pop    %esi
+  8023d5:	5f                   	pop    %edi
+  8023d6:	5d                   	pop    %ebp
+  8023d7:	c3                   	ret
+  8023d8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023dd:	0f a2                	cpuid
+		return 0;
+  8023df:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8023e4:	f6 c6 08             	test   $0x8,%dh
+  8023e7:	74 15                	je     8023fe <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023e9:	89 c2                	mov    %eax,%edx
+  8023eb:	c1 ea 08             	shr    $0x8,%edx
+  8023ee:	83 e2 0f             	and    $0xf,%edx
+  8023f1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8023f6:	83 fa 06             	cmp    $0x6,%edx
+  8023f9:	74 0e                	je     802409 <sys_ep_grant+0x7a>
+  8023fb:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8023fe:	0f b6 c9             	movzbl %cl,%ecx
+  802401:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802407:	eb 98                	jmp    8023a1 <sys_ep_grant+0x12>
+  802409:	89 c2                	mov    %eax,%edx
+  80240b:	c1 ea 04             	shr    $0x4,%edx
+  80240e:	83 e2 0f             	and    $0xf,%edx
+  802411:	83 fa 02             	cmp    $0x2,%edx
+  802414:	77 e5                	ja     8023fb <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  802416:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802419:	83 f8 02             	cmp    $0x2,%eax
+  80241c:	0f 97 c1             	seta   %cl
+  80241f:	0f b6 c9             	movzbl %cl,%ecx
+  802422:	eb d7                	jmp    8023fb <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  802424:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802429:	b8 24 00 00 00       	mov    $0x24,%eax
+  80242e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802431:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802434:	89 df                	mov    %ebx,%edi
+  802436:	89 de                	mov    %ebx,%esi
+  802438:	cd 30                	int    $0x30
+  80243a:	eb 90                	jmp    8023cc <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80243c:	83 ec 0c             	sub    $0xc,%esp
+  80243f:	50                   	push   %eax
+  802440:	6a 24                	push   $0x24
+  802442:	68 b9 2f 80 00       	push   $0x802fb9
+  802447:	6a 4a                	push   $0x4a
+  802449:	68 d6 2f 80 00       	push   $0x802fd6
+  80244e:	e8 f6 04 00 00       	call   802949 <_panic>
+
+00802453 <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  802453:	55                   	push   %ebp
+  802454:	89 e5                	mov    %esp,%ebp
+  802456:	57                   	push   %edi
+  802457:	56                   	push   %esi
+  802458:	53                   	push   %ebx
+  802459:	83 ec 20             	sub    $0x20,%esp
+  80245c:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  80245f:	8b 10                	mov    (%eax),%edx
+  802461:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802464:	8b 50 04             	mov    0x4(%eax),%edx
+  802467:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80246a:	8b 50 08             	mov    0x8(%eax),%edx
+  80246d:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  802470:	8b 50 0c             	mov    0xc(%eax),%edx
+  802473:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  802476:	8b 40 10             	mov    0x10(%eax),%eax
+  802479:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  80247c:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  80247f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802482:	b8 25 00 00 00       	mov    $0x25,%eax
+  802487:	55                   	push   %ebp
+  802488:	56                   	push   %esi
+  802489:	8b 0e                	mov    (%esi),%ecx
+  80248b:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80248e:	8b 7e 08             	mov    0x8(%esi),%edi
+  802491:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802494:	8b 76 0c             	mov    0xc(%esi),%esi
+  802497:	cd 30                	int    $0x30
+  802499:	87 34 24             	xchg   %esi,(%esp)
+  80249c:	89 0e                	mov    %ecx,(%esi)
+  80249e:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8024a1:	89 7e 08             	mov    %edi,0x8(%esi)
+  8024a4:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8024a7:	8f 46 0c             	pop    0xc(%esi)
+  8024aa:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  8024ab:	83 c4 20             	add    $0x20,%esp
+  8024ae:	5b                   	pop    %ebx
+  8024af:	5e                   	pop    %esi
+  8024b0:	5f                   	pop    %edi
+  8024b1:	5d                   	pop    %ebp
+  8024b2:	c3                   	ret
+
+008024b3 <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  8024b3:	55                   	push   %ebp
+  8024b4:	89 e5                	mov    %esp,%ebp
+  8024b6:	57                   	push   %edi
+  8024b7:	56                   	push   %esi
+  8024b8:	53                   	push   %ebx
+  8024b9:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  8024bc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024bf:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  8024c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024c4:	b8 26 00 00 00       	mov    $0x26,%eax
+  8024c9:	55                   	push   %ebp
+  8024ca:	56                   	push   %esi
+  8024cb:	8b 0e                	mov    (%esi),%ecx
+  8024cd:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8024d0:	8b 7e 08             	mov    0x8(%esi),%edi
+  8024d3:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8024d6:	8b 76 0c             	mov    0xc(%esi),%esi
+  8024d9:	cd 30                	int    $0x30
+  8024db:	87 34 24             	xchg   %esi,(%esp)
+  8024de:	89 0e                	mov    %ecx,(%esi)
+  8024e0:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8024e3:	89 7e 08             	mov    %edi,0x8(%esi)
+  8024e6:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8024e9:	8f 46 0c             	pop    0xc(%esi)
+  8024ec:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  8024ed:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  8024f1:	74 0f                	je     802502 <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  8024f3:	85 c0                	test   %eax,%eax
+  8024f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024fa:	0f 48 d1             	cmovs  %ecx,%edx
+  8024fd:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  802500:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  802502:	5b                   	pop    %ebx
+  802503:	5e                   	pop    %esi
+  802504:	5f                   	pop    %edi
+  802505:	5d                   	pop    %ebp
+  802506:	c3                   	ret
+
+00802507 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  802507:	55                   	push   %ebp
+  802508:	89 e5                	mov    %esp,%ebp
+  80250a:	57                   	push   %edi
+  80250b:	56                   	push   %esi
+  80250c:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80250d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802514:	78 2f                	js     802545 <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  802516:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80251d:	74 72                	je     802591 <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  80251f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802522:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802527:	b8 27 00 00 00       	mov    $0x27,%eax
+  80252c:	89 cb                	mov    %ecx,%ebx
+  80252e:	89 cf                	mov    %ecx,%edi
+  802530:	89 ce                	mov    %ecx,%esi
+  802532:	55                   	push   %ebp
+  802533:	68 3c 25 80 00       	push   $0x80253c
+  802538:	89 e5                	mov    %esp,%ebp
+  80253a:	0f 34                	sysenter
+  80253c:	83 c4 04             	add    $0x4,%esp
+  80253f:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  802540:	5b                   	pop    %ebx
+  802541:	5e                   	pop    %esi
+  802542:	5f                   	pop    %edi
+  802543:	5d                   	pop    %ebp
+  802544:	c3                   	ret
+  802545:	b8 01 00 00 00       	mov    $0x1,%eax
+  80254a:	0f a2                	cpuid
+		return 0;
+  80254c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802551:	f6 c6 08             	test   $0x8,%dh
+  802554:	74 15                	je     80256b <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802556:	89 c2                	mov    %eax,%edx
+  802558:	c1 ea 08             	shr    $0x8,%edx
+  80255b:	83 e2 0f             	and    $0xf,%edx
+  80255e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802563:	83 fa 06             	cmp    $0x6,%edx
+  802566:	74 0e                	je     802576 <sys_sysring_setup+0x6f>
+  802568:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80256b:	0f b6 c9             	movzbl %cl,%ecx
+  80256e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802574:	eb a0                	jmp    802516 <sys_sysring_setup+0xf>
+  802576:	89 c2                	mov    %eax,%edx
+  802578:	c1 ea 04             	shr    $0x4,%edx
+  80257b:	83 e2 0f             	and    $0xf,%edx
+  80257e:	83 fa 02             	cmp    $0x2,%edx
+  802581:	77 e5                	ja     802568 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  802583:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802586:	83 f8 02             	cmp    $0x2,%eax
+  802589:	0f 97 c1             	seta   %cl
+  80258c:	0f b6 c9             	movzbl %cl,%ecx
+  80258f:	eb d7                	jmp    802568 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  802591:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802596:	b8 27 00 00 00       	mov    $0x27,%eax
+  80259b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80259e:	89 cb                	mov    %ecx,%ebx
+  8025a0:	89 cf                	mov    %ecx,%edi
+  8025a2:	89 ce                	mov    %ecx,%esi
+  8025a4:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  8025a6:	eb 98                	jmp    802540 <sys_sysring_setup+0x39>
+
+008025a8 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  8025a8:	55                   	push   %ebp
+  8025a9:	89 e5                	mov    %esp,%ebp
+  8025ab:	57                   	push   %edi
+  8025ac:	56                   	push   %esi
+  8025ad:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8025ae:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8025b5:	78 2e                	js     8025e5 <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  8025b7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8025be:	74 71                	je     802631 <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  8025c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025c5:	b8 28 00 00 00       	mov    $0x28,%eax
+  8025ca:	89 d1                	mov    %edx,%ecx
+  8025cc:	89 d3                	mov    %edx,%ebx
+  8025ce:	89 d7                	mov    %edx,%edi
+  8025d0:	89 d6                	mov    %edx,%esi
+  8025d2:	55                   	push   %ebp
+  8025d3:	68 dc 25 80 00       	push   $0x8025dc
+  8025d8:	89 e5                	mov    %esp,%ebp
+  8025da:	0f 34                	sysenter
+  8025dc:	83 c4 04             	add    $0x4,%esp
+  8025df:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8025e0:	5b                   	pop    %ebx
+  8025e1:	5e                   	pop    %esi
+  8025e2:	5f                   	pop    %edi
+  8025e3:	5d                   	pop    %ebp
+  8025e4:	c3                   	ret
+  8025e5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025ea:	0f a2                	cpuid
+		return 0;
+  8025ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8025f1:	f6 c6 08             	test   $0x8,%dh
+  8025f4:	74 15                	je     80260b <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025f6:	89 c2                	mov    %eax,%edx
+  8025f8:	c1 ea 08             	shr    $0x8,%edx
+  8025fb:	83 e2 0f             	and    $0xf,%edx
+  8025fe:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802603:	83 fa 06             	cmp    $0x6,%edx
+  802606:	74 0e                	je     802616 <sys_sysring_enter+0x6e>
+  802608:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80260b:	0f b6 c9             	movzbl %cl,%ecx
+  80260e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802614:	eb a1                	jmp    8025b7 <sys_sysring_enter+0xf>
+  802616:	89 c2                	mov    %eax,%edx
+  802618:	c1 ea 04             	shr    $0x4,%edx
+  80261b:	83 e2 0f             	and    $0xf,%edx
+  80261e:	83 fa 02             	cmp    $0x2,%edx
+  802621:	77 e5                	ja     802608 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  802623:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802626:	83 f8 02             	cmp    $0x2,%eax
+  802629:	0f 97 c1             	seta   %cl
+  80262c:	0f b6 c9             	movzbl %cl,%ecx
+  80262f:	eb d7                	jmp    802608 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  802631:	ba 00 00 00 00       	mov    $0x0,%edx
+  802636:	b8 28 00 00 00       	mov    $0x28,%eax
+  80263b:	89 d1                	mov    %edx,%ecx
+  80263d:	89 d3                	mov    %edx,%ebx
+  80263f:	89 d7                	mov    %edx,%edi
+  802641:	89 d6                	mov    %edx,%esi
+  802643:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  802645:	eb 99                	jmp    8025e0 <sys_sysring_enter+0x38>
+
+00802647 <pgfault>:
+// The kernel normally resolves these faults itself (page_fault_cow in
+// kern/trap.c); we only get here if it ran out of memory doing so.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802647:	55                   	push   %ebp
+  802648:	89 e5                	mov    %esp,%ebp
+  80264a:	83 ec 08             	sub    $0x8,%esp
+  80264d:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  802650:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  802652:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  802655:	f6 c2 02             	test   $0x2,%dl
+  802658:	74 40                	je     80269a <pgfault+0x53>
+  80265a:	89 c1                	mov    %eax,%ecx
+  80265c:	c1 e9 16             	shr    $0x16,%ecx
+  80265f:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802666:	f6 c1 01             	test   $0x1,%cl
+  802669:	74 2f                	je     80269a <pgfault+0x53>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW))
+  80266b:	89 c1                	mov    %eax,%ecx
+  80266d:	c1 e9 0c             	shr    $0xc,%ecx
+  802670:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  802677:	f6 c5 08             	test   $0x8,%ch
+  80267a:	74 1e                	je     80269a <pgfault+0x53>
+	// Replace the page with a private writable copy of itself.  The
+	// kernel allocates, copies and maps it in one system call, so no
+	// temporary mapping at PFTEMP is needed.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  80267c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r = sys_page_copy(0, addr, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  802681:	83 ec 0c             	sub    $0xc,%esp
+  802684:	6a 07                	push   $0x7
+  802686:	50                   	push   %eax
+  802687:	6a 00                	push   $0x0
+  802689:	50                   	push   %eax
+  80268a:	6a 00                	push   $0x0
+  80268c:	e8 85 eb ff ff       	call   801216 <sys_page_copy>
+  802691:	83 c4 20             	add    $0x20,%esp
+  802694:	85 c0                	test   %eax,%eax
+  802696:	78 18                	js     8026b0 <pgfault+0x69>
+		panic("pgfault: sys_page_copy: %e", r);
+}
+  802698:	c9                   	leave
+  802699:	c3                   	ret
+		panic("pgfault: va %08x err %x is not a copy-on-write write",
+  80269a:	83 ec 0c             	sub    $0xc,%esp
+  80269d:	52                   	push   %edx
+  80269e:	50                   	push   %eax
+  80269f:	68 e4 2f 80 00       	push   $0x802fe4
+  8026a4:	6a 1c                	push   $0x1c
+  8026a6:	68 19 30 80 00       	push   $0x803019
+  8026ab:	e8 99 02 00 00       	call   802949 <_panic>
+		panic("pgfault: sys_page_copy: %e", r);
+  8026b0:	50                   	push   %eax
+  8026b1:	68 24 30 80 00       	push   $0x803024
+  8026b6:	6a 26                	push   $0x26
+  8026b8:	68 19 30 80 00       	push   $0x803019
+  8026bd:	e8 87 02 00 00       	call   802949 <_panic>
+
+008026c2 <ufork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+ufork(void)
+{
+  8026c2:	55                   	push   %ebp
+  8026c3:	89 e5                	mov    %esp,%ebp
+  8026c5:	57                   	push   %edi
+  8026c6:	56                   	push   %esi
+  8026c7:	53                   	push   %ebx
+  8026c8:	81 ec 38 04 00 00    	sub    $0x438,%esp
+	struct page_range vec[PAGE_VEC_MAX], *last;
+	uintptr_t va;
+	size_t n;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8026ce:	68 47 26 80 00       	push   $0x802647
+  8026d3:	e8 f0 02 00 00       	call   8029c8 <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8026d8:	b8 07 00 00 00       	mov    $0x7,%eax
+  8026dd:	cd 30                	int    $0x30
+  8026df:	89 85 d4 fb ff ff    	mov    %eax,-0x42c(%ebp)
+
+	envid = sys_exofork();
+	if (envid < 0)
+  8026e5:	83 c4 10             	add    $0x10,%esp
+  8026e8:	85 c0                	test   %eax,%eax
+  8026ea:	0f 88 f2 01 00 00    	js     8028e2 <ufork+0x220>
+		return 0;
+	}
+
+	// Copy every run of mapped pages below the exception stack, which
+	// must not be shared.
+	va = 0;
+  8026f0:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  8026f5:	74 0b                	je     802702 <ufork+0x40>
+  8026f7:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  8026fd:	e9 07 01 00 00       	jmp    802809 <ufork+0x147>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  802702:	e8 22 e8 ff ff       	call   800f29 <sys_getenvid>
+  802707:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80270c:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802712:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802717:	a3 08 40 80 00       	mov    %eax,0x804008
+		return 0;
+  80271c:	e9 c1 01 00 00       	jmp    8028e2 <ufork+0x220>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+		n = r;
+		last = &vec[n - 1];
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  802721:	83 ea 01             	sub    $0x1,%edx
+  802724:	89 c1                	mov    %eax,%ecx
+  802726:	c1 e1 04             	shl    $0x4,%ecx
+  802729:	89 94 0d ec fd ff ff 	mov    %edx,-0x214(%ebp,%ecx,1)
+			n--;
+  802730:	85 d2                	test   %edx,%edx
+  802732:	0f 44 f0             	cmove  %eax,%esi
+  802735:	e9 12 01 00 00       	jmp    80284c <ufork+0x18a>
+	for (i = 0; i < n; i++) {
+  80273a:	83 c1 01             	add    $0x1,%ecx
+  80273d:	83 c0 10             	add    $0x10,%eax
+  802740:	39 8d e4 fb ff ff    	cmp    %ecx,-0x41c(%ebp)
+  802746:	74 6a                	je     8027b2 <ufork+0xf0>
+		vec[i].pr_dstva = vec[i].pr_va;
+  802748:	89 c3                	mov    %eax,%ebx
+  80274a:	8b 10                	mov    (%eax),%edx
+  80274c:	89 50 0c             	mov    %edx,0xc(%eax)
+		if (vec[i].pr_perm & PTE_SHARE)
+  80274f:	8b 50 08             	mov    0x8(%eax),%edx
+  802752:	f6 c6 04             	test   $0x4,%dh
+  802755:	75 e3                	jne    80273a <ufork+0x78>
+		if (vec[i].pr_perm & (PTE_W | PTE_COW)) {
+  802757:	f7 c2 02 08 00 00    	test   $0x802,%edx
+  80275d:	74 db                	je     80273a <ufork+0x78>
+			vec[i].pr_perm = (vec[i].pr_perm & ~PTE_W) | PTE_COW;
+  80275f:	81 e2 fd f7 ff ff    	and    $0xfffff7fd,%edx
+  802765:	80 ce 08             	or     $0x8,%dh
+  802768:	89 95 dc fb ff ff    	mov    %edx,-0x424(%ebp)
+  80276e:	89 53 08             	mov    %edx,0x8(%ebx)
+			cow[ncow++] = vec[i];
+  802771:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  802777:	c1 e6 04             	shl    $0x4,%esi
+  80277a:	89 f2                	mov    %esi,%edx
+  80277c:	8d b4 35 e8 fb ff ff 	lea    -0x418(%ebp,%esi,1),%esi
+  802783:	8b 38                	mov    (%eax),%edi
+  802785:	89 bc 15 e8 fb ff ff 	mov    %edi,-0x418(%ebp,%edx,1)
+  80278c:	8b 78 04             	mov    0x4(%eax),%edi
+  80278f:	89 7e 04             	mov    %edi,0x4(%esi)
+  802792:	8b bd dc fb ff ff    	mov    -0x424(%ebp),%edi
+  802798:	89 7e 08             	mov    %edi,0x8(%esi)
+  80279b:	8b 50 0c             	mov    0xc(%eax),%edx
+  80279e:	89 56 0c             	mov    %edx,0xc(%esi)
+  8027a1:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  8027a7:	8d 7e 01             	lea    0x1(%esi),%edi
+  8027aa:	89 bd e0 fb ff ff    	mov    %edi,-0x420(%ebp)
+  8027b0:	eb 88                	jmp    80273a <ufork+0x78>
+	if ((r = sys_page_map_vec(0, envid, vec, n, 0)) < 0)
+  8027b2:	8b b5 e4 fb ff ff    	mov    -0x41c(%ebp),%esi
+  8027b8:	8b bd d8 fb ff ff    	mov    -0x428(%ebp),%edi
+  8027be:	83 ec 0c             	sub    $0xc,%esp
+  8027c1:	6a 00                	push   $0x0
+  8027c3:	56                   	push   %esi
+  8027c4:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  8027ca:	50                   	push   %eax
+  8027cb:	ff b5 d4 fb ff ff    	push   -0x42c(%ebp)
+  8027d1:	6a 00                	push   $0x0
+  8027d3:	e8 80 f4 ff ff       	call   801c58 <sys_page_map_vec>
+  8027d8:	83 c4 20             	add    $0x20,%esp
+  8027db:	85 c0                	test   %eax,%eax
+  8027dd:	0f 88 e5 00 00 00    	js     8028c8 <ufork+0x206>
+	return sys_page_map_vec(0, 0, cow, ncow, 0);
+  8027e3:	83 ec 0c             	sub    $0xc,%esp
+  8027e6:	6a 00                	push   $0x0
+  8027e8:	ff b5 e0 fb ff ff    	push   -0x420(%ebp)
+  8027ee:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  8027f4:	50                   	push   %eax
+  8027f5:	6a 00                	push   $0x0
+  8027f7:	6a 00                	push   $0x0
+  8027f9:	e8 5a f4 ff ff       	call   801c58 <sys_page_map_vec>
+		if ((r = duppages(envid, vec, n)) < 0)
+  8027fe:	83 c4 20             	add    $0x20,%esp
+  802801:	85 c0                	test   %eax,%eax
+  802803:	0f 88 e7 00 00 00    	js     8028f0 <ufork+0x22e>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+  802809:	6a 20                	push   $0x20
+  80280b:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802811:	50                   	push   %eax
+  802812:	57                   	push   %edi
+  802813:	6a 00                	push   $0x0
+  802815:	e8 82 f4 ff ff       	call   801c9c <sys_vm_ranges>
+  80281a:	83 c4 10             	add    $0x10,%esp
+  80281d:	85 c0                	test   %eax,%eax
+  80281f:	7e 51                	jle    802872 <ufork+0x1b0>
+		n = r;
+  802821:	89 c6                	mov    %eax,%esi
+		last = &vec[n - 1];
+  802823:	83 e8 01             	sub    $0x1,%eax
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+  802826:	89 c1                	mov    %eax,%ecx
+  802828:	c1 e1 04             	shl    $0x4,%ecx
+  80282b:	8b 94 0d ec fd ff ff 	mov    -0x214(%ebp,%ecx,1),%edx
+  802832:	89 d3                	mov    %edx,%ebx
+  802834:	c1 e3 0c             	shl    $0xc,%ebx
+  802837:	89 df                	mov    %ebx,%edi
+  802839:	03 bc 0d e8 fd ff ff 	add    -0x218(%ebp,%ecx,1),%edi
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  802840:	81 ff 00 00 c0 ee    	cmp    $0xeec00000,%edi
+  802846:	0f 84 d5 fe ff ff    	je     802721 <ufork+0x5f>
+	for (i = 0; i < n; i++) {
+  80284c:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+	size_t i, ncow = 0;
+  802852:	c7 85 e0 fb ff ff 00 	movl   $0x0,-0x420(%ebp)
+  802859:	00 00 00 
+	for (i = 0; i < n; i++) {
+  80285c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802861:	89 bd d8 fb ff ff    	mov    %edi,-0x428(%ebp)
+  802867:	89 b5 e4 fb ff ff    	mov    %esi,-0x41c(%ebp)
+  80286d:	e9 ce fe ff ff       	jmp    802740 <ufork+0x7e>
+			goto fail;
+	}
+	if (r < 0)
+  802872:	89 c6                	mov    %eax,%esi
+  802874:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  80287a:	85 c0                	test   %eax,%eax
+  80287c:	78 52                	js     8028d0 <ufork+0x20e>
+		goto fail;
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE),
+  80287e:	83 ec 04             	sub    $0x4,%esp
+  802881:	6a 07                	push   $0x7
+  802883:	68 00 f0 bf ee       	push   $0xeebff000
+  802888:	53                   	push   %ebx
+  802889:	e8 3a e7 ff ff       	call   800fc8 <sys_page_alloc>
+  80288e:	89 c6                	mov    %eax,%esi
+  802890:	83 c4 10             	add    $0x10,%esp
+  802893:	85 c0                	test   %eax,%eax
+  802895:	78 39                	js     8028d0 <ufork+0x20e>
+				PTE_P | PTE_U | PTE_W)) < 0
+	    || (r = sys_env_set_pgfault_upcall(envid,
+			thisenv->env_pgfault_upcall)) < 0
+  802897:	a1 08 40 80 00       	mov    0x804008,%eax
+  80289c:	8b 40 74             	mov    0x74(%eax),%eax
+	    || (r = sys_env_set_pgfault_upcall(envid,
+  80289f:	83 ec 08             	sub    $0x8,%esp
+  8028a2:	50                   	push   %eax
+  8028a3:	53                   	push   %ebx
+  8028a4:	e8 de ed ff ff       	call   801687 <sys_env_set_pgfault_upcall>
+  8028a9:	89 c6                	mov    %eax,%esi
+  8028ab:	83 c4 10             	add    $0x10,%esp
+  8028ae:	85 c0                	test   %eax,%eax
+  8028b0:	78 1e                	js     8028d0 <ufork+0x20e>
+	    || (r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  8028b2:	83 ec 08             	sub    $0x8,%esp
+  8028b5:	6a 02                	push   $0x2
+  8028b7:	53                   	push   %ebx
+  8028b8:	e8 bc ea ff ff       	call   801379 <sys_env_set_status>
+  8028bd:	89 c6                	mov    %eax,%esi
+  8028bf:	83 c4 10             	add    $0x10,%esp
+  8028c2:	85 c0                	test   %eax,%eax
+  8028c4:	79 1c                	jns    8028e2 <ufork+0x220>
+  8028c6:	eb 08                	jmp    8028d0 <ufork+0x20e>
+  8028c8:	89 c6                	mov    %eax,%esi
+  8028ca:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+		goto fail;
+	return envid;
+
+fail:
+	sys_env_destroy(envid);
+  8028d0:	83 ec 0c             	sub    $0xc,%esp
+  8028d3:	53                   	push   %ebx
+  8028d4:	e8 8e e5 ff ff       	call   800e67 <sys_env_destroy>
+	return r;
+  8028d9:	83 c4 10             	add    $0x10,%esp
+  8028dc:	89 b5 d4 fb ff ff    	mov    %esi,-0x42c(%ebp)
+}
+  8028e2:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+  8028e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028eb:	5b                   	pop    %ebx
+  8028ec:	5e                   	pop    %esi
+  8028ed:	5f                   	pop    %edi
+  8028ee:	5d                   	pop    %ebp
+  8028ef:	c3                   	ret
+  8028f0:	89 c6                	mov    %eax,%esi
+  8028f2:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  8028f8:	eb d6                	jmp    8028d0 <ufork+0x20e>
+
+008028fa <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  8028fa:	55                   	push   %ebp
+  8028fb:	89 e5                	mov    %esp,%ebp
+  8028fd:	53                   	push   %ebx
+  8028fe:	83 ec 04             	sub    $0x4,%esp
+	envid_t envid;
+
+	envid = sys_fork();
+  802901:	e8 90 f2 ff ff       	call   801b96 <sys_fork>
+  802906:	89 c3                	mov    %eax,%ebx
+	if (envid == 0)
+  802908:	85 c0                	test   %eax,%eax
+  80290a:	74 07                	je     802913 <fork+0x19>
+		thisenv = &envs[ENVX(sys_getenvid())];
+	return envid;
+}
+  80290c:	89 d8                	mov    %ebx,%eax
+  80290e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802911:	c9                   	leave
+  802912:	c3                   	ret
+		thisenv = &envs[ENVX(sys_getenvid())];
+  802913:	e8 11 e6 ff ff       	call   800f29 <sys_getenvid>
+  802918:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80291d:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  802923:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802928:	a3 08 40 80 00       	mov    %eax,0x804008
+	return envid;
+  80292d:	eb dd                	jmp    80290c <fork+0x12>
+
+0080292f <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  80292f:	55                   	push   %ebp
+  802930:	89 e5                	mov    %esp,%ebp
+  802932:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  802935:	68 3f 30 80 00       	push   $0x80303f
+  80293a:	68 a1 00 00 00       	push   $0xa1
+  80293f:	68 19 30 80 00       	push   $0x803019
+  802944:	e8 00 00 00 00       	call   802949 <_panic>
+
+00802949 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802949:	55                   	push   %ebp
+  80294a:	89 e5                	mov    %esp,%ebp
+  80294c:	57                   	push   %edi
+  80294d:	56                   	push   %esi
+  80294e:	53                   	push   %ebx
+  80294f:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  802955:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  802958:	8b 1d 00 40 80 00    	mov    0x804000,%ebx
+  80295e:	e8 c6 e5 ff ff       	call   800f29 <sys_getenvid>
+  802963:	83 ec 04             	sub    $0x4,%esp
+  802966:	ff 75 0c             	push   0xc(%ebp)
+  802969:	ff 75 08             	push   0x8(%ebp)
+  80296c:	53                   	push   %ebx
+  80296d:	50                   	push   %eax
+  80296e:	68 58 30 80 00       	push   $0x803058
+  802973:	68 00 01 00 00       	push   $0x100
+  802978:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  80297e:	56                   	push   %esi
+  80297f:	e8 ba dd ff ff       	call   80073e <snprintf>
+  802984:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  802986:	83 c4 20             	add    $0x20,%esp
+  802989:	57                   	push   %edi
+  80298a:	ff 75 10             	push   0x10(%ebp)
+  80298d:	bf 00 01 00 00       	mov    $0x100,%edi
+  802992:	89 f8                	mov    %edi,%eax
+  802994:	29 d8                	sub    %ebx,%eax
+  802996:	50                   	push   %eax
+  802997:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  80299a:	50                   	push   %eax
+  80299b:	e8 50 dd ff ff       	call   8006f0 <vsnprintf>
+  8029a0:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  8029a2:	83 c4 0c             	add    $0xc,%esp
+  8029a5:	68 f4 2c 80 00       	push   $0x802cf4
+  8029aa:	29 df                	sub    %ebx,%edi
+  8029ac:	57                   	push   %edi
+  8029ad:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8029b0:	50                   	push   %eax
+  8029b1:	e8 88 dd ff ff       	call   80073e <snprintf>
+	sys_cputs(buf, r);
+  8029b6:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  8029b9:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  8029bb:	53                   	push   %ebx
+  8029bc:	56                   	push   %esi
+  8029bd:	e8 69 e3 ff ff       	call   800d2b <sys_cputs>
+  8029c2:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8029c5:	cc                   	int3
+	while (1)
+  8029c6:	eb fd                	jmp    8029c5 <_panic+0x7c>
+
+008029c8 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8029c8:	55                   	push   %ebp
+  8029c9:	89 e5                	mov    %esp,%ebp
+  8029cb:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8029ce:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  8029d5:	74 0a                	je     8029e1 <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8029d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029da:	a3 0c 40 80 00       	mov    %eax,0x80400c
+}
+  8029df:	c9                   	leave
+  8029e0:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE),
+  8029e1:	83 ec 04             	sub    $0x4,%esp
+  8029e4:	6a 07                	push   $0x7
+  8029e6:	68 00 f0 bf ee       	push   $0xeebff000
+  8029eb:	6a 00                	push   $0x0
+  8029ed:	e8 d6 e5 ff ff       	call   800fc8 <sys_page_alloc>
+  8029f2:	83 c4 10             	add    $0x10,%esp
+  8029f5:	85 c0                	test   %eax,%eax
+  8029f7:	78 28                	js     802a21 <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  8029f9:	83 ec 08             	sub    $0x8,%esp
+  8029fc:	68 33 2a 80 00       	push   $0x802a33
+  802a01:	6a 00                	push   $0x0
+  802a03:	e8 7f ec ff ff       	call   801687 <sys_env_set_pgfault_upcall>
+  802a08:	83 c4 10             	add    $0x10,%esp
+  802a0b:	85 c0                	test   %eax,%eax
+  802a0d:	79 c8                	jns    8029d7 <set_pgfault_handler+0xf>
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+  802a0f:	50                   	push   %eax
+  802a10:	68 a4 30 80 00       	push   $0x8030a4
+  802a15:	6a 24                	push   $0x24
+  802a17:	68 d8 30 80 00       	push   $0x8030d8
+  802a1c:	e8 28 ff ff ff       	call   802949 <_panic>
+			panic("set_pgfault_handler: sys_page_alloc: %e", r);
+  802a21:	50                   	push   %eax
+  802a22:	68 7c 30 80 00       	push   $0x80307c
+  802a27:	6a 22                	push   $0x22
+  802a29:	68 d8 30 80 00       	push   $0x8030d8
+  802a2e:	e8 16 ff ff ff       	call   802949 <_panic>
+
+00802a33 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802a33:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802a34:	a1 0c 40 80 00       	mov    0x80400c,%eax
+	call *%eax
+  802a39:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802a3b:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 0x28(%esp), %ebx		// trap-time eip
+  802a3e:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl 0x30(%esp), %eax		// trap-time esp
+  802a42:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  802a46:	83 e8 04             	sub    $0x4,%eax
+	movl %ebx, (%eax)
+  802a49:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 0x30(%esp)
+  802a4b:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp			// skip fault_va and err
+  802a4f:	83 c4 08             	add    $0x8,%esp
+	popal
+  802a52:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp			// skip eip
+  802a53:	83 c4 04             	add    $0x4,%esp
+	popfl
+  802a56:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802a57:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802a58:	c3                   	ret
+
+00802a59 <dm>:
+  802a59:	55                   	push   %ebp
+  802a5a:	57                   	push   %edi
+  802a5b:	56                   	push   %esi
+  802a5c:	53                   	push   %ebx
+  802a5d:	83 ec 24             	sub    $0x24,%esp
+  802a60:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802a64:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802a68:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802a6c:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802a70:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802a74:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802a78:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802a7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a81:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a86:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802a8b:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802a92:	00 
+  802a93:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802a9a:	00 
+  802a9b:	89 fb                	mov    %edi,%ebx
+  802a9d:	eb 08                	jmp    802aa7 <dm+0x4e>
+  802a9f:	83 e9 01             	sub    $0x1,%ecx
+  802aa2:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802aa5:	74 68                	je     802b0f <dm+0xb6>
+  802aa7:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802aab:	01 c0                	add    %eax,%eax
+  802aad:	89 c6                	mov    %eax,%esi
+  802aaf:	89 d7                	mov    %edx,%edi
+  802ab1:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802ab5:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802ab9:	0f ad d0             	shrd   %cl,%edx,%eax
+  802abc:	d3 ea                	shr    %cl,%edx
+  802abe:	f6 c1 20             	test   $0x20,%cl
+  802ac1:	74 04                	je     802ac7 <dm+0x6e>
+  802ac3:	89 d0                	mov    %edx,%eax
+  802ac5:	31 d2                	xor    %edx,%edx
+  802ac7:	83 e0 01             	and    $0x1,%eax
+  802aca:	89 04 24             	mov    %eax,(%esp)
+  802acd:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802ad4:	00 
+  802ad5:	8b 04 24             	mov    (%esp),%eax
+  802ad8:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802adc:	09 f0                	or     %esi,%eax
+  802ade:	09 fa                	or     %edi,%edx
+  802ae0:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802ae4:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802ae8:	39 f0                	cmp    %esi,%eax
+  802aea:	89 d5                	mov    %edx,%ebp
+  802aec:	19 fd                	sbb    %edi,%ebp
+  802aee:	72 af                	jb     802a9f <dm+0x46>
+  802af0:	29 f0                	sub    %esi,%eax
+  802af2:	19 fa                	sbb    %edi,%edx
+  802af4:	89 cf                	mov    %ecx,%edi
+  802af6:	c1 ef 05             	shr    $0x5,%edi
+  802af9:	83 e7 01             	and    $0x1,%edi
+  802afc:	89 fe                	mov    %edi,%esi
+  802afe:	83 f6 01             	xor    $0x1,%esi
+  802b01:	d3 e6                	shl    %cl,%esi
+  802b03:	d3 e7                	shl    %cl,%edi
+  802b05:	09 74 24 18          	or     %esi,0x18(%esp)
+  802b09:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802b0d:	eb 90                	jmp    802a9f <dm+0x46>
+  802b0f:	85 db                	test   %ebx,%ebx
+  802b11:	74 05                	je     802b18 <dm+0xbf>
+  802b13:	89 03                	mov    %eax,(%ebx)
+  802b15:	89 53 04             	mov    %edx,0x4(%ebx)
+  802b18:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802b1c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802b20:	83 c4 24             	add    $0x24,%esp
+  802b23:	5b                   	pop    %ebx
+  802b24:	5e                   	pop    %esi
+  802b25:	5f                   	pop    %edi
+  802b26:	5d                   	pop    %ebp
+  802b27:	c3                   	ret
+
+00802b28 <__udivdi3>:
+  802b28:	83 ec 08             	sub    $0x8,%esp
+  802b2b:	6a 00                	push   $0x0
+  802b2d:	ff 74 24 1c          	push   0x1c(%esp)
+  802b31:	ff 74 24 1c          	push   0x1c(%esp)
+  802b35:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802b39:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802b3d:	e8 17 ff ff ff       	call   802a59 <dm>
+  802b42:	83 c4 14             	add    $0x14,%esp
+  802b45:	c3                   	ret
+
+00802b46 <__umoddi3>:
+  802b46:	83 ec 18             	sub    $0x18,%esp
+  802b49:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802b4d:	50                   	push   %eax
+  802b4e:	ff 74 24 2c          	push   0x2c(%esp)
+  802b52:	ff 74 24 2c          	push   0x2c(%esp)
+  802b56:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802b5a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802b5e:	e8 f6 fe ff ff       	call   802a59 <dm>
+  802b63:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802b67:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802b6b:	83 c4 24             	add    $0x24,%esp
+  802b6e:	c3                   	ret
+
+00802b6f <__divdi3>:
+  802b6f:	53                   	push   %ebx
+  802b70:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802b74:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802b78:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  802b7c:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  802b80:	85 d2                	test   %edx,%edx
+  802b82:	78 15                	js     802b99 <__divdi3+0x2a>
+  802b84:	85 db                	test   %ebx,%ebx
+  802b86:	78 34                	js     802bbc <__divdi3+0x4d>
+  802b88:	83 ec 04             	sub    $0x4,%esp
+  802b8b:	6a 00                	push   $0x0
+  802b8d:	53                   	push   %ebx
+  802b8e:	51                   	push   %ecx
+  802b8f:	e8 c5 fe ff ff       	call   802a59 <dm>
+  802b94:	83 c4 10             	add    $0x10,%esp
+  802b97:	eb 21                	jmp    802bba <__divdi3+0x4b>
+  802b99:	f7 d8                	neg    %eax
+  802b9b:	83 d2 00             	adc    $0x0,%edx
+  802b9e:	f7 da                	neg    %edx
+  802ba0:	85 db                	test   %ebx,%ebx
+  802ba2:	78 30                	js     802bd4 <__divdi3+0x65>
+  802ba4:	83 ec 04             	sub    $0x4,%esp
+  802ba7:	6a 00                	push   $0x0
+  802ba9:	53                   	push   %ebx
+  802baa:	51                   	push   %ecx
+  802bab:	e8 a9 fe ff ff       	call   802a59 <dm>
+  802bb0:	83 c4 10             	add    $0x10,%esp
+  802bb3:	f7 d8                	neg    %eax
+  802bb5:	83 d2 00             	adc    $0x0,%edx
+  802bb8:	f7 da                	neg    %edx
+  802bba:	5b                   	pop    %ebx
+  802bbb:	c3                   	ret
+  802bbc:	83 ec 04             	sub    $0x4,%esp
+  802bbf:	6a 00                	push   $0x0
+  802bc1:	f7 d9                	neg    %ecx
+  802bc3:	83 d3 00             	adc    $0x0,%ebx
+  802bc6:	f7 db                	neg    %ebx
+  802bc8:	53                   	push   %ebx
+  802bc9:	51                   	push   %ecx
+  802bca:	e8 8a fe ff ff       	call   802a59 <dm>
+  802bcf:	83 c4 10             	add    $0x10,%esp
+  802bd2:	eb df                	jmp    802bb3 <__divdi3+0x44>
+  802bd4:	83 ec 04             	sub    $0x4,%esp
+  802bd7:	6a 00                	push   $0x0
+  802bd9:	f7 d9                	neg    %ecx
+  802bdb:	83 d3 00             	adc    $0x0,%ebx
+  802bde:	f7 db                	neg    %ebx
+  802be0:	53                   	push   %ebx
+  802be1:	51                   	push   %ecx
+  802be2:	e8 72 fe ff ff       	call   802a59 <dm>
+  802be7:	83 c4 10             	add    $0x10,%esp
+  802bea:	eb ce                	jmp    802bba <__divdi3+0x4b>
+
+00802bec <__moddi3>:
+  802bec:	55                   	push   %ebp
+  802bed:	57                   	push   %edi
+  802bee:	56                   	push   %esi
+  802bef:	53                   	push   %ebx
+  802bf0:	83 ec 18             	sub    $0x18,%esp
+  802bf3:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802bf7:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802bfb:	89 f1                	mov    %esi,%ecx
+  802bfd:	f7 d9                	neg    %ecx
+  802bff:	89 da                	mov    %ebx,%edx
+  802c01:	83 d2 00             	adc    $0x0,%edx
+  802c04:	f7 da                	neg    %edx
+  802c06:	0f 48 ce             	cmovs  %esi,%ecx
+  802c09:	0f 48 d3             	cmovs  %ebx,%edx
+  802c0c:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802c10:	50                   	push   %eax
+  802c11:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802c15:	f7 de                	neg    %esi
+  802c17:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802c1b:	83 d0 00             	adc    $0x0,%eax
+  802c1e:	f7 d8                	neg    %eax
+  802c20:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802c25:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802c2a:	50                   	push   %eax
+  802c2b:	56                   	push   %esi
+  802c2c:	89 c8                	mov    %ecx,%eax
+  802c2e:	e8 26 fe ff ff       	call   802a59 <dm>
+  802c33:	83 c4 10             	add    $0x10,%esp
+  802c36:	85 db                	test   %ebx,%ebx
+  802c38:	78 10                	js     802c4a <__moddi3+0x5e>
+  802c3a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802c3e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802c42:	83 c4 14             	add    $0x14,%esp
+  802c45:	5b                   	pop    %ebx
+  802c46:	5e                   	pop    %esi
+  802c47:	5f                   	pop    %edi
+  802c48:	5d                   	pop    %ebp
+  802c49:	c3                   	ret
+  802c4a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802c4e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802c52:	f7 d8                	neg    %eax
+  802c54:	83 d2 00             	adc    $0x0,%edx
+  802c57:	f7 da                	neg    %edx
+  802c59:	eb e7                	jmp    802c42 <__moddi3+0x56>
@@ -0,0 +1,5696 @@
+
+obj/user/stresssched:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 b9 00 00 00       	call   8000ea <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+volatile int counter;
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+	int i, j;
+	int seen;
+	envid_t parent = sys_getenvid();
+  800038:	e8 a0 0f 00 00       	call   800fdd <sys_getenvid>
+  80003d:	89 c6                	mov    %eax,%esi
+
+	// Fork several environments
+	for (i = 0; i < 20; i++)
+  80003f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (fork() == 0)
+  800044:	e8 65 29 00 00       	call   8029ae <fork>
+  800049:	85 c0                	test   %eax,%eax
+  80004b:	74 0f                	je     80005c <umain+0x29>
+	for (i = 0; i < 20; i++)
+  80004d:	83 c3 01             	add    $0x1,%ebx
+  800050:	83 fb 14             	cmp    $0x14,%ebx
+  800053:	75 ef                	jne    800044 <umain+0x11>
+			break;
+	if (i == 20) {
+		sys_yield();
+  800055:	e8 34 13 00 00       	call   80138e <sys_yield>
+		return;
+  80005a:	eb 70                	jmp    8000cc <umain+0x99>
+	}
+
+	// Wait for the parent to finish forking
+	while (envs[ENVX(parent)].env_status != ENV_FREE)
+  80005c:	89 f0                	mov    %esi,%eax
+  80005e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800063:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  800069:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80006e:	eb 02                	jmp    800072 <umain+0x3f>
+		asm volatile("pause");
+  800070:	f3 90                	pause
+	while (envs[ENVX(parent)].env_status != ENV_FREE)
+  800072:	8b 50 54             	mov    0x54(%eax),%edx
+  800075:	85 d2                	test   %edx,%edx
+  800077:	75 f7                	jne    800070 <umain+0x3d>
+  800079:	bb 0b 00 00 00       	mov    $0xb,%ebx
+  80007e:	eb 12                	jmp    800092 <umain+0x5f>
+
+	// Check that one environment doesn't run on two CPUs at once
+	for (i = 0; i < 10; i++) {
+		sys_yield();
+		for (j = 0; j < 10000; j++)
+			counter++;
+  800080:	a1 08 40 80 00       	mov    0x804008,%eax
+  800085:	83 c0 01             	add    $0x1,%eax
+  800088:	a3 08 40 80 00       	mov    %eax,0x804008
+		for (j = 0; j < 10000; j++)
+  80008d:	83 ea 01             	sub    $0x1,%edx
+  800090:	75 ee                	jne    800080 <umain+0x4d>
+	for (i = 0; i < 10; i++) {
+  800092:	83 eb 01             	sub    $0x1,%ebx
+  800095:	74 0c                	je     8000a3 <umain+0x70>
+		sys_yield();
+  800097:	e8 f2 12 00 00       	call   80138e <sys_yield>
+		for (j = 0; j < 10000; j++)
+  80009c:	ba 11 27 00 00       	mov    $0x2711,%edx
+  8000a1:	eb ea                	jmp    80008d <umain+0x5a>
+	}
+
+	if (counter != 10*10000)
+  8000a3:	a1 08 40 80 00       	mov    0x804008,%eax
+  8000a8:	3d a0 86 01 00       	cmp    $0x186a0,%eax
+  8000ad:	75 24                	jne    8000d3 <umain+0xa0>
+		panic("ran on two CPUs at once (counter is %d)", counter);
+
+	// Check that we see environments running on different CPUs
+	cprintf("[%08x] stresssched on CPU %d\n", thisenv->env_id, thisenv->env_cpunum);
+  8000af:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8000b4:	8b 50 5c             	mov    0x5c(%eax),%edx
+  8000b7:	8b 40 48             	mov    0x48(%eax),%eax
+  8000ba:	83 ec 04             	sub    $0x4,%esp
+  8000bd:	52                   	push   %edx
+  8000be:	50                   	push   %eax
+  8000bf:	68 db 2c 80 00       	push   $0x802cdb
+  8000c4:	e8 90 01 00 00       	call   800259 <cprintf>
+  8000c9:	83 c4 10             	add    $0x10,%esp
+
+}
+  8000cc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000cf:	5b                   	pop    %ebx
+  8000d0:	5e                   	pop    %esi
+  8000d1:	5d                   	pop    %ebp
+  8000d2:	c3                   	ret
+		panic("ran on two CPUs at once (counter is %d)", counter);
+  8000d3:	a1 08 40 80 00       	mov    0x804008,%eax
+  8000d8:	50                   	push   %eax
+  8000d9:	68 a0 2c 80 00       	push   $0x802ca0
+  8000de:	6a 21                	push   $0x21
+  8000e0:	68 c8 2c 80 00       	push   $0x802cc8
+  8000e5:	e8 5b 00 00 00       	call   800145 <_panic>
+
+008000ea <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000ea:	55                   	push   %ebp
+  8000eb:	89 e5                	mov    %esp,%ebp
+  8000ed:	56                   	push   %esi
+  8000ee:	53                   	push   %ebx
+  8000ef:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000f2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  8000f5:	e8 e3 0e 00 00       	call   800fdd <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  8000fa:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000ff:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  800105:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80010a:	a3 0c 40 80 00       	mov    %eax,0x80400c
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80010f:	85 db                	test   %ebx,%ebx
+  800111:	7e 07                	jle    80011a <libmain+0x30>
+		binaryname = argv[0];
+  800113:	8b 06                	mov    (%esi),%eax
+  800115:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  80011a:	83 ec 08             	sub    $0x8,%esp
+  80011d:	56                   	push   %esi
+  80011e:	53                   	push   %ebx
+  80011f:	e8 0f ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800124:	e8 0a 00 00 00       	call   800133 <exit>
+}
+  800129:	83 c4 10             	add    $0x10,%esp
+  80012c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80012f:	5b                   	pop    %ebx
+  800130:	5e                   	pop    %esi
+  800131:	5d                   	pop    %ebp
+  800132:	c3                   	ret
+
+00800133 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800133:	55                   	push   %ebp
+  800134:	89 e5                	mov    %esp,%ebp
+  800136:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  800139:	6a 00                	push   $0x0
+  80013b:	e8 db 0d 00 00       	call   800f1b <sys_env_destroy>
+}
+  800140:	83 c4 10             	add    $0x10,%esp
+  800143:	c9                   	leave
+  800144:	c3                   	ret
+
+00800145 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800145:	55                   	push   %ebp
+  800146:	89 e5                	mov    %esp,%ebp
+  800148:	57                   	push   %edi
+  800149:	56                   	push   %esi
+  80014a:	53                   	push   %ebx
+  80014b:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  800151:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  800154:	8b 1d 00 40 80 00    	mov    0x804000,%ebx
+  80015a:	e8 7e 0e 00 00       	call   800fdd <sys_getenvid>
+  80015f:	83 ec 04             	sub    $0x4,%esp
+  800162:	ff 75 0c             	push   0xc(%ebp)
+  800165:	ff 75 08             	push   0x8(%ebp)
+  800168:	53                   	push   %ebx
+  800169:	50                   	push   %eax
+  80016a:	68 04 2d 80 00       	push   $0x802d04
+  80016f:	68 00 01 00 00       	push   $0x100
+  800174:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  80017a:	56                   	push   %esi
+  80017b:	e8 72 06 00 00       	call   8007f2 <snprintf>
+  800180:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  800182:	83 c4 20             	add    $0x20,%esp
+  800185:	57                   	push   %edi
+  800186:	ff 75 10             	push   0x10(%ebp)
+  800189:	bf 00 01 00 00       	mov    $0x100,%edi
+  80018e:	89 f8                	mov    %edi,%eax
+  800190:	29 d8                	sub    %ebx,%eax
+  800192:	50                   	push   %eax
+  800193:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  800196:	50                   	push   %eax
+  800197:	e8 08 06 00 00       	call   8007a4 <vsnprintf>
+  80019c:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  80019e:	83 c4 0c             	add    $0xc,%esp
+  8001a1:	68 f7 2c 80 00       	push   $0x802cf7
+  8001a6:	29 df                	sub    %ebx,%edi
+  8001a8:	57                   	push   %edi
+  8001a9:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8001ac:	50                   	push   %eax
+  8001ad:	e8 40 06 00 00       	call   8007f2 <snprintf>
+	sys_cputs(buf, r);
+  8001b2:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  8001b5:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  8001b7:	53                   	push   %ebx
+  8001b8:	56                   	push   %esi
+  8001b9:	e8 21 0c 00 00       	call   800ddf <sys_cputs>
+  8001be:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001c1:	cc                   	int3
+	while (1)
+  8001c2:	eb fd                	jmp    8001c1 <_panic+0x7c>
+
+008001c4 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001c4:	55                   	push   %ebp
+  8001c5:	89 e5                	mov    %esp,%ebp
+  8001c7:	53                   	push   %ebx
+  8001c8:	83 ec 04             	sub    $0x4,%esp
+  8001cb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001ce:	8b 13                	mov    (%ebx),%edx
+  8001d0:	8d 42 01             	lea    0x1(%edx),%eax
+  8001d3:	89 03                	mov    %eax,(%ebx)
+  8001d5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001d8:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001dc:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001e1:	74 09                	je     8001ec <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001e3:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001ea:	c9                   	leave
+  8001eb:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001ec:	83 ec 08             	sub    $0x8,%esp
+  8001ef:	68 ff 00 00 00       	push   $0xff
+  8001f4:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001f7:	50                   	push   %eax
+  8001f8:	e8 e2 0b 00 00       	call   800ddf <sys_cputs>
+		b->idx = 0;
+  8001fd:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800203:	83 c4 10             	add    $0x10,%esp
+  800206:	eb db                	jmp    8001e3 <putch+0x1f>
+
+00800208 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800208:	55                   	push   %ebp
+  800209:	89 e5                	mov    %esp,%ebp
+  80020b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800211:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800218:	00 00 00 
+	b.cnt = 0;
+  80021b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800222:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800225:	ff 75 0c             	push   0xc(%ebp)
+  800228:	ff 75 08             	push   0x8(%ebp)
+  80022b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800231:	50                   	push   %eax
+  800232:	68 c4 01 80 00       	push   $0x8001c4
+  800237:	e8 14 01 00 00       	call   800350 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80023c:	83 c4 08             	add    $0x8,%esp
+  80023f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800245:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80024b:	50                   	push   %eax
+  80024c:	e8 8e 0b 00 00       	call   800ddf <sys_cputs>
+
+	return b.cnt;
+}
+  800251:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800257:	c9                   	leave
+  800258:	c3                   	ret
+
+00800259 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800259:	55                   	push   %ebp
+  80025a:	89 e5                	mov    %esp,%ebp
+  80025c:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80025f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800262:	50                   	push   %eax
+  800263:	ff 75 08             	push   0x8(%ebp)
+  800266:	e8 9d ff ff ff       	call   800208 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80026b:	c9                   	leave
+  80026c:	c3                   	ret
+
+0080026d <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80026d:	55                   	push   %ebp
+  80026e:	89 e5                	mov    %esp,%ebp
+  800270:	57                   	push   %edi
+  800271:	56                   	push   %esi
+  800272:	53                   	push   %ebx
+  800273:	83 ec 1c             	sub    $0x1c,%esp
+  800276:	89 c7                	mov    %eax,%edi
+  800278:	89 d6                	mov    %edx,%esi
+  80027a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80027d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800280:	89 d1                	mov    %edx,%ecx
+  800282:	89 c2                	mov    %eax,%edx
+  800284:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800287:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80028a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80028d:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800290:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800293:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80029a:	39 c2                	cmp    %eax,%edx
+  80029c:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80029f:	72 3e                	jb     8002df <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002a1:	83 ec 0c             	sub    $0xc,%esp
+  8002a4:	ff 75 18             	push   0x18(%ebp)
+  8002a7:	83 eb 01             	sub    $0x1,%ebx
+  8002aa:	53                   	push   %ebx
+  8002ab:	50                   	push   %eax
+  8002ac:	83 ec 08             	sub    $0x8,%esp
+  8002af:	ff 75 e4             	push   -0x1c(%ebp)
+  8002b2:	ff 75 e0             	push   -0x20(%ebp)
+  8002b5:	ff 75 dc             	push   -0x24(%ebp)
+  8002b8:	ff 75 d8             	push   -0x28(%ebp)
+  8002bb:	e8 9d 28 00 00       	call   802b5d <__udivdi3>
+  8002c0:	83 c4 18             	add    $0x18,%esp
+  8002c3:	52                   	push   %edx
+  8002c4:	50                   	push   %eax
+  8002c5:	89 f2                	mov    %esi,%edx
+  8002c7:	89 f8                	mov    %edi,%eax
+  8002c9:	e8 9f ff ff ff       	call   80026d <printnum>
+  8002ce:	83 c4 20             	add    $0x20,%esp
+  8002d1:	eb 13                	jmp    8002e6 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002d3:	83 ec 08             	sub    $0x8,%esp
+  8002d6:	56                   	push   %esi
+  8002d7:	ff 75 18             	push   0x18(%ebp)
+  8002da:	ff d7                	call   *%edi
+  8002dc:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002df:	83 eb 01             	sub    $0x1,%ebx
+  8002e2:	85 db                	test   %ebx,%ebx
+  8002e4:	7f ed                	jg     8002d3 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002e6:	83 ec 08             	sub    $0x8,%esp
+  8002e9:	56                   	push   %esi
+  8002ea:	83 ec 04             	sub    $0x4,%esp
+  8002ed:	ff 75 e4             	push   -0x1c(%ebp)
+  8002f0:	ff 75 e0             	push   -0x20(%ebp)
+  8002f3:	ff 75 dc             	push   -0x24(%ebp)
+  8002f6:	ff 75 d8             	push   -0x28(%ebp)
+  8002f9:	e8 7d 28 00 00       	call   802b7b <__umoddi3>
+  8002fe:	83 c4 14             	add    $0x14,%esp
+  800301:	0f be 80 27 2d 80 00 	movsbl 0x802d27(%eax),%eax
+  800308:	50                   	push   %eax
+  800309:	ff d7                	call   *%edi
+}
+  80030b:	83 c4 10             	add    $0x10,%esp
+  80030e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800311:	5b                   	pop    %ebx
+  800312:	5e                   	pop    %esi
+  800313:	5f                   	pop    %edi
+  800314:	5d                   	pop    %ebp
+  800315:	c3                   	ret
+
+00800316 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800316:	55                   	push   %ebp
+  800317:	89 e5                	mov    %esp,%ebp
+  800319:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80031c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800320:	8b 10                	mov    (%eax),%edx
+  800322:	3b 50 04             	cmp    0x4(%eax),%edx
+  800325:	73 0a                	jae    800331 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800327:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80032a:	89 08                	mov    %ecx,(%eax)
+  80032c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80032f:	88 02                	mov    %al,(%edx)
+}
+  800331:	5d                   	pop    %ebp
+  800332:	c3                   	ret
+
+00800333 <printfmt>:
+{
+  800333:	55                   	push   %ebp
+  800334:	89 e5                	mov    %esp,%ebp
+  800336:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800339:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80033c:	50                   	push   %eax
+  80033d:	ff 75 10             	push   0x10(%ebp)
+  800340:	ff 75 0c             	push   0xc(%ebp)
+  800343:	ff 75 08             	push   0x8(%ebp)
+  800346:	e8 05 00 00 00       	call   800350 <vprintfmt>
+}
+  80034b:	83 c4 10             	add    $0x10,%esp
+  80034e:	c9                   	leave
+  80034f:	c3                   	ret
+
+00800350 <vprintfmt>:
+{
+  800350:	55                   	push   %ebp
+  800351:	89 e5                	mov    %esp,%ebp
+  800353:	57                   	push   %edi
+  800354:	56                   	push   %esi
+  800355:	53                   	push   %ebx
+  800356:	83 ec 2c             	sub    $0x2c,%esp
+  800359:	8b 75 08             	mov    0x8(%ebp),%esi
+  80035c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80035f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800362:	eb 0a                	jmp    80036e <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800364:	83 ec 08             	sub    $0x8,%esp
+  800367:	53                   	push   %ebx
+  800368:	50                   	push   %eax
+  800369:	ff d6                	call   *%esi
+  80036b:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80036e:	83 c7 01             	add    $0x1,%edi
+  800371:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800375:	83 f8 25             	cmp    $0x25,%eax
+  800378:	74 0c                	je     800386 <vprintfmt+0x36>
+			if (ch == '\0')
+  80037a:	85 c0                	test   %eax,%eax
+  80037c:	75 e6                	jne    800364 <vprintfmt+0x14>
+}
+  80037e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800381:	5b                   	pop    %ebx
+  800382:	5e                   	pop    %esi
+  800383:	5f                   	pop    %edi
+  800384:	5d                   	pop    %ebp
+  800385:	c3                   	ret
+		padc = ' ';
+  800386:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80038a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800391:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800398:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80039f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a4:	8d 47 01             	lea    0x1(%edi),%eax
+  8003a7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003aa:	0f b6 17             	movzbl (%edi),%edx
+  8003ad:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003b0:	3c 55                	cmp    $0x55,%al
+  8003b2:	0f 87 cf 03 00 00    	ja     800787 <vprintfmt+0x437>
+  8003b8:	0f b6 c0             	movzbl %al,%eax
+  8003bb:	ff 24 85 20 2e 80 00 	jmp    *0x802e20(,%eax,4)
+  8003c2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8003c5:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8003c9:	eb d9                	jmp    8003a4 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003cb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003ce:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003d2:	eb d0                	jmp    8003a4 <vprintfmt+0x54>
+  8003d4:	0f b6 d2             	movzbl %dl,%edx
+  8003d7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003df:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003e2:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003e5:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003e9:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003ec:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003ef:	83 f9 09             	cmp    $0x9,%ecx
+  8003f2:	77 55                	ja     800449 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8003f4:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003f7:	eb e9                	jmp    8003e2 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8003f9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003fc:	8b 00                	mov    (%eax),%eax
+  8003fe:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800401:	8b 45 14             	mov    0x14(%ebp),%eax
+  800404:	8d 40 04             	lea    0x4(%eax),%eax
+  800407:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80040a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80040d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800411:	79 91                	jns    8003a4 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800413:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800416:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800419:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800420:	eb 82                	jmp    8003a4 <vprintfmt+0x54>
+			if (width < 0)
+  800422:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800425:	85 d2                	test   %edx,%edx
+  800427:	b8 00 00 00 00       	mov    $0x0,%eax
+  80042c:	0f 49 c2             	cmovns %edx,%eax
+  80042f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800432:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800435:	e9 6a ff ff ff       	jmp    8003a4 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80043a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80043d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800444:	e9 5b ff ff ff       	jmp    8003a4 <vprintfmt+0x54>
+  800449:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80044c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80044f:	eb bc                	jmp    80040d <vprintfmt+0xbd>
+			lflag++;
+  800451:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800454:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800457:	e9 48 ff ff ff       	jmp    8003a4 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80045c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80045f:	8d 78 04             	lea    0x4(%eax),%edi
+  800462:	83 ec 08             	sub    $0x8,%esp
+  800465:	53                   	push   %ebx
+  800466:	ff 30                	push   (%eax)
+  800468:	ff d6                	call   *%esi
+			break;
+  80046a:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80046d:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800470:	e9 b1 02 00 00       	jmp    800726 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800475:	8b 45 14             	mov    0x14(%ebp),%eax
+  800478:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80047b:	8b 10                	mov    (%eax),%edx
+  80047d:	89 d0                	mov    %edx,%eax
+  80047f:	f7 d8                	neg    %eax
+  800481:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800484:	83 f8 0d             	cmp    $0xd,%eax
+  800487:	7f 23                	jg     8004ac <vprintfmt+0x15c>
+  800489:	8b 14 85 80 2f 80 00 	mov    0x802f80(,%eax,4),%edx
+  800490:	85 d2                	test   %edx,%edx
+  800492:	74 18                	je     8004ac <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800494:	52                   	push   %edx
+  800495:	68 48 2d 80 00       	push   $0x802d48
+  80049a:	53                   	push   %ebx
+  80049b:	56                   	push   %esi
+  80049c:	e8 92 fe ff ff       	call   800333 <printfmt>
+  8004a1:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004a4:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8004a7:	e9 7a 02 00 00       	jmp    800726 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8004ac:	50                   	push   %eax
+  8004ad:	68 3f 2d 80 00       	push   $0x802d3f
+  8004b2:	53                   	push   %ebx
+  8004b3:	56                   	push   %esi
+  8004b4:	e8 7a fe ff ff       	call   800333 <printfmt>
+  8004b9:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004bc:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004bf:	e9 62 02 00 00       	jmp    800726 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c7:	83 c0 04             	add    $0x4,%eax
+  8004ca:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d0:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004d2:	85 c9                	test   %ecx,%ecx
+  8004d4:	b8 38 2d 80 00       	mov    $0x802d38,%eax
+  8004d9:	0f 45 c1             	cmovne %ecx,%eax
+  8004dc:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004df:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004e3:	7e 06                	jle    8004eb <vprintfmt+0x19b>
+  8004e5:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004e9:	75 0b                	jne    8004f6 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004eb:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004ee:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004f1:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004f4:	eb 5c                	jmp    800552 <vprintfmt+0x202>
+  8004f6:	83 ec 08             	sub    $0x8,%esp
+  8004f9:	ff 75 d0             	push   -0x30(%ebp)
+  8004fc:	ff 75 cc             	push   -0x34(%ebp)
+  8004ff:	e8 20 03 00 00       	call   800824 <strnlen>
+  800504:	89 c2                	mov    %eax,%edx
+  800506:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800509:	29 d0                	sub    %edx,%eax
+  80050b:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80050e:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800512:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800515:	89 75 08             	mov    %esi,0x8(%ebp)
+  800518:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80051a:	eb 0e                	jmp    80052a <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80051c:	83 ec 08             	sub    $0x8,%esp
+  80051f:	53                   	push   %ebx
+  800520:	57                   	push   %edi
+  800521:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800524:	83 ee 01             	sub    $0x1,%esi
+  800527:	83 c4 10             	add    $0x10,%esp
+  80052a:	85 f6                	test   %esi,%esi
+  80052c:	7f ee                	jg     80051c <vprintfmt+0x1cc>
+  80052e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800531:	8b 75 08             	mov    0x8(%ebp),%esi
+  800534:	85 c0                	test   %eax,%eax
+  800536:	ba 00 00 00 00       	mov    $0x0,%edx
+  80053b:	0f 49 d0             	cmovns %eax,%edx
+  80053e:	29 d0                	sub    %edx,%eax
+  800540:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800543:	eb a6                	jmp    8004eb <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800545:	83 ec 08             	sub    $0x8,%esp
+  800548:	53                   	push   %ebx
+  800549:	52                   	push   %edx
+  80054a:	ff 55 08             	call   *0x8(%ebp)
+  80054d:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800550:	89 f1                	mov    %esi,%ecx
+  800552:	8d 71 01             	lea    0x1(%ecx),%esi
+  800555:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800559:	0f be d0             	movsbl %al,%edx
+  80055c:	85 d2                	test   %edx,%edx
+  80055e:	74 28                	je     800588 <vprintfmt+0x238>
+  800560:	85 ff                	test   %edi,%edi
+  800562:	78 05                	js     800569 <vprintfmt+0x219>
+  800564:	83 ef 01             	sub    $0x1,%edi
+  800567:	78 30                	js     800599 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800569:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80056d:	74 d6                	je     800545 <vprintfmt+0x1f5>
+  80056f:	0f be c0             	movsbl %al,%eax
+  800572:	83 e8 20             	sub    $0x20,%eax
+  800575:	83 f8 5e             	cmp    $0x5e,%eax
+  800578:	76 cb                	jbe    800545 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80057a:	83 ec 08             	sub    $0x8,%esp
+  80057d:	53                   	push   %ebx
+  80057e:	6a 3f                	push   $0x3f
+  800580:	ff 55 08             	call   *0x8(%ebp)
+  800583:	83 c4 10             	add    $0x10,%esp
+  800586:	eb c8                	jmp    800550 <vprintfmt+0x200>
+  800588:	8b 75 08             	mov    0x8(%ebp),%esi
+  80058b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80058e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800591:	01 d0                	add    %edx,%eax
+  800593:	29 c8                	sub    %ecx,%eax
+  800595:	89 c7                	mov    %eax,%edi
+  800597:	eb 13                	jmp    8005ac <vprintfmt+0x25c>
+  800599:	8b 75 08             	mov    0x8(%ebp),%esi
+  80059c:	eb ed                	jmp    80058b <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80059e:	83 ec 08             	sub    $0x8,%esp
+  8005a1:	53                   	push   %ebx
+  8005a2:	6a 20                	push   $0x20
+  8005a4:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8005a6:	83 ef 01             	sub    $0x1,%edi
+  8005a9:	83 c4 10             	add    $0x10,%esp
+  8005ac:	85 ff                	test   %edi,%edi
+  8005ae:	7f ee                	jg     80059e <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005b0:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8005b3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005b6:	e9 6b 01 00 00       	jmp    800726 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8005bb:	83 f9 01             	cmp    $0x1,%ecx
+  8005be:	7f 1f                	jg     8005df <vprintfmt+0x28f>
+	else if (lflag)
+  8005c0:	85 c9                	test   %ecx,%ecx
+  8005c2:	74 67                	je     80062b <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8005c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c7:	8b 00                	mov    (%eax),%eax
+  8005c9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005cc:	89 c1                	mov    %eax,%ecx
+  8005ce:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005d1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d7:	8d 40 04             	lea    0x4(%eax),%eax
+  8005da:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005dd:	eb 17                	jmp    8005f6 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8005df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e2:	8b 50 04             	mov    0x4(%eax),%edx
+  8005e5:	8b 00                	mov    (%eax),%eax
+  8005e7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005ea:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f0:	8d 40 08             	lea    0x8(%eax),%eax
+  8005f3:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005f6:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005f9:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005fc:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800601:	85 c9                	test   %ecx,%ecx
+  800603:	0f 89 03 01 00 00    	jns    80070c <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800609:	83 ec 08             	sub    $0x8,%esp
+  80060c:	53                   	push   %ebx
+  80060d:	6a 2d                	push   $0x2d
+  80060f:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800611:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800614:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800617:	f7 da                	neg    %edx
+  800619:	83 d1 00             	adc    $0x0,%ecx
+  80061c:	f7 d9                	neg    %ecx
+  80061e:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800621:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800626:	e9 e1 00 00 00       	jmp    80070c <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80062b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062e:	8b 00                	mov    (%eax),%eax
+  800630:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800633:	89 c1                	mov    %eax,%ecx
+  800635:	c1 f9 1f             	sar    $0x1f,%ecx
+  800638:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80063b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063e:	8d 40 04             	lea    0x4(%eax),%eax
+  800641:	89 45 14             	mov    %eax,0x14(%ebp)
+  800644:	eb b0                	jmp    8005f6 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800646:	83 f9 01             	cmp    $0x1,%ecx
+  800649:	7f 1e                	jg     800669 <vprintfmt+0x319>
+	else if (lflag)
+  80064b:	85 c9                	test   %ecx,%ecx
+  80064d:	74 32                	je     800681 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  80064f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800652:	8b 10                	mov    (%eax),%edx
+  800654:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800659:	8d 40 04             	lea    0x4(%eax),%eax
+  80065c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80065f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800664:	e9 a3 00 00 00       	jmp    80070c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800669:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066c:	8b 10                	mov    (%eax),%edx
+  80066e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800671:	8d 40 08             	lea    0x8(%eax),%eax
+  800674:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800677:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80067c:	e9 8b 00 00 00       	jmp    80070c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800681:	8b 45 14             	mov    0x14(%ebp),%eax
+  800684:	8b 10                	mov    (%eax),%edx
+  800686:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80068b:	8d 40 04             	lea    0x4(%eax),%eax
+  80068e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800691:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800696:	eb 74                	jmp    80070c <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800698:	83 f9 01             	cmp    $0x1,%ecx
+  80069b:	7f 1b                	jg     8006b8 <vprintfmt+0x368>
+	else if (lflag)
+  80069d:	85 c9                	test   %ecx,%ecx
+  80069f:	74 2c                	je     8006cd <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8006a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a4:	8b 10                	mov    (%eax),%edx
+  8006a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ab:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ae:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006b1:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8006b6:	eb 54                	jmp    80070c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bb:	8b 10                	mov    (%eax),%edx
+  8006bd:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006c0:	8d 40 08             	lea    0x8(%eax),%eax
+  8006c3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006c6:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8006cb:	eb 3f                	jmp    80070c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d0:	8b 10                	mov    (%eax),%edx
+  8006d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006d7:	8d 40 04             	lea    0x4(%eax),%eax
+  8006da:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006dd:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8006e2:	eb 28                	jmp    80070c <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8006e4:	83 ec 08             	sub    $0x8,%esp
+  8006e7:	53                   	push   %ebx
+  8006e8:	6a 30                	push   $0x30
+  8006ea:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006ec:	83 c4 08             	add    $0x8,%esp
+  8006ef:	53                   	push   %ebx
+  8006f0:	6a 78                	push   $0x78
+  8006f2:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f7:	8b 10                	mov    (%eax),%edx
+  8006f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006fe:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800701:	8d 40 04             	lea    0x4(%eax),%eax
+  800704:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800707:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80070c:	83 ec 0c             	sub    $0xc,%esp
+  80070f:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800713:	50                   	push   %eax
+  800714:	ff 75 e0             	push   -0x20(%ebp)
+  800717:	57                   	push   %edi
+  800718:	51                   	push   %ecx
+  800719:	52                   	push   %edx
+  80071a:	89 da                	mov    %ebx,%edx
+  80071c:	89 f0                	mov    %esi,%eax
+  80071e:	e8 4a fb ff ff       	call   80026d <printnum>
+			break;
+  800723:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800726:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800729:	e9 40 fc ff ff       	jmp    80036e <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80072e:	83 f9 01             	cmp    $0x1,%ecx
+  800731:	7f 1b                	jg     80074e <vprintfmt+0x3fe>
+	else if (lflag)
+  800733:	85 c9                	test   %ecx,%ecx
+  800735:	74 2c                	je     800763 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800737:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073a:	8b 10                	mov    (%eax),%edx
+  80073c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800741:	8d 40 04             	lea    0x4(%eax),%eax
+  800744:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800747:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80074c:	eb be                	jmp    80070c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80074e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800751:	8b 10                	mov    (%eax),%edx
+  800753:	8b 48 04             	mov    0x4(%eax),%ecx
+  800756:	8d 40 08             	lea    0x8(%eax),%eax
+  800759:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80075c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800761:	eb a9                	jmp    80070c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800763:	8b 45 14             	mov    0x14(%ebp),%eax
+  800766:	8b 10                	mov    (%eax),%edx
+  800768:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80076d:	8d 40 04             	lea    0x4(%eax),%eax
+  800770:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800773:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800778:	eb 92                	jmp    80070c <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  80077a:	83 ec 08             	sub    $0x8,%esp
+  80077d:	53                   	push   %ebx
+  80077e:	6a 25                	push   $0x25
+  800780:	ff d6                	call   *%esi
+			break;
+  800782:	83 c4 10             	add    $0x10,%esp
+  800785:	eb 9f                	jmp    800726 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800787:	83 ec 08             	sub    $0x8,%esp
+  80078a:	53                   	push   %ebx
+  80078b:	6a 25                	push   $0x25
+  80078d:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80078f:	83 c4 10             	add    $0x10,%esp
+  800792:	89 f8                	mov    %edi,%eax
+  800794:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800798:	74 05                	je     80079f <vprintfmt+0x44f>
+  80079a:	83 e8 01             	sub    $0x1,%eax
+  80079d:	eb f5                	jmp    800794 <vprintfmt+0x444>
+  80079f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007a2:	eb 82                	jmp    800726 <vprintfmt+0x3d6>
+
+008007a4 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007a4:	55                   	push   %ebp
+  8007a5:	89 e5                	mov    %esp,%ebp
+  8007a7:	83 ec 18             	sub    $0x18,%esp
+  8007aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007ad:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007b0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007b3:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007b7:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007ba:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007c1:	85 c0                	test   %eax,%eax
+  8007c3:	74 26                	je     8007eb <vsnprintf+0x47>
+  8007c5:	85 d2                	test   %edx,%edx
+  8007c7:	7e 22                	jle    8007eb <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007c9:	ff 75 14             	push   0x14(%ebp)
+  8007cc:	ff 75 10             	push   0x10(%ebp)
+  8007cf:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007d2:	50                   	push   %eax
+  8007d3:	68 16 03 80 00       	push   $0x800316
+  8007d8:	e8 73 fb ff ff       	call   800350 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007dd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007e0:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007e3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007e6:	83 c4 10             	add    $0x10,%esp
+}
+  8007e9:	c9                   	leave
+  8007ea:	c3                   	ret
+		return -E_INVAL;
+  8007eb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007f0:	eb f7                	jmp    8007e9 <vsnprintf+0x45>
+
+008007f2 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007f2:	55                   	push   %ebp
+  8007f3:	89 e5                	mov    %esp,%ebp
+  8007f5:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007f8:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007fb:	50                   	push   %eax
+  8007fc:	ff 75 10             	push   0x10(%ebp)
+  8007ff:	ff 75 0c             	push   0xc(%ebp)
+  800802:	ff 75 08             	push   0x8(%ebp)
+  800805:	e8 9a ff ff ff       	call   8007a4 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80080a:	c9                   	leave
+  80080b:	c3                   	ret
+
+0080080c <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80080c:	55                   	push   %ebp
+  80080d:	89 e5                	mov    %esp,%ebp
+  80080f:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800812:	b8 00 00 00 00       	mov    $0x0,%eax
+  800817:	eb 03                	jmp    80081c <strlen+0x10>
+		n++;
+  800819:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80081c:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800820:	75 f7                	jne    800819 <strlen+0xd>
+	return n;
+}
+  800822:	5d                   	pop    %ebp
+  800823:	c3                   	ret
+
+00800824 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800824:	55                   	push   %ebp
+  800825:	89 e5                	mov    %esp,%ebp
+  800827:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80082a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80082d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800832:	eb 03                	jmp    800837 <strnlen+0x13>
+		n++;
+  800834:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800837:	39 d0                	cmp    %edx,%eax
+  800839:	74 08                	je     800843 <strnlen+0x1f>
+  80083b:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80083f:	75 f3                	jne    800834 <strnlen+0x10>
+  800841:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800843:	89 d0                	mov    %edx,%eax
+  800845:	5d                   	pop    %ebp
+  800846:	c3                   	ret
+
+00800847 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800847:	55                   	push   %ebp
+  800848:	89 e5                	mov    %esp,%ebp
+  80084a:	53                   	push   %ebx
+  80084b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80084e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800851:	b8 00 00 00 00       	mov    $0x0,%eax
+  800856:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80085a:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80085d:	83 c0 01             	add    $0x1,%eax
+  800860:	84 d2                	test   %dl,%dl
+  800862:	75 f2                	jne    800856 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800864:	89 c8                	mov    %ecx,%eax
+  800866:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800869:	c9                   	leave
+  80086a:	c3                   	ret
+
+0080086b <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80086b:	55                   	push   %ebp
+  80086c:	89 e5                	mov    %esp,%ebp
+  80086e:	53                   	push   %ebx
+  80086f:	83 ec 10             	sub    $0x10,%esp
+  800872:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800875:	53                   	push   %ebx
+  800876:	e8 91 ff ff ff       	call   80080c <strlen>
+  80087b:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80087e:	ff 75 0c             	push   0xc(%ebp)
+  800881:	01 d8                	add    %ebx,%eax
+  800883:	50                   	push   %eax
+  800884:	e8 be ff ff ff       	call   800847 <strcpy>
+	return dst;
+}
+  800889:	89 d8                	mov    %ebx,%eax
+  80088b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80088e:	c9                   	leave
+  80088f:	c3                   	ret
+
+00800890 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800890:	55                   	push   %ebp
+  800891:	89 e5                	mov    %esp,%ebp
+  800893:	56                   	push   %esi
+  800894:	53                   	push   %ebx
+  800895:	8b 75 08             	mov    0x8(%ebp),%esi
+  800898:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80089b:	89 f3                	mov    %esi,%ebx
+  80089d:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008a0:	89 f0                	mov    %esi,%eax
+  8008a2:	eb 0f                	jmp    8008b3 <strncpy+0x23>
+		*dst++ = *src;
+  8008a4:	83 c0 01             	add    $0x1,%eax
+  8008a7:	0f b6 0a             	movzbl (%edx),%ecx
+  8008aa:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8008ad:	80 f9 01             	cmp    $0x1,%cl
+  8008b0:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008b3:	39 d8                	cmp    %ebx,%eax
+  8008b5:	75 ed                	jne    8008a4 <strncpy+0x14>
+	}
+	return ret;
+}
+  8008b7:	89 f0                	mov    %esi,%eax
+  8008b9:	5b                   	pop    %ebx
+  8008ba:	5e                   	pop    %esi
+  8008bb:	5d                   	pop    %ebp
+  8008bc:	c3                   	ret
+
+008008bd <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008bd:	55                   	push   %ebp
+  8008be:	89 e5                	mov    %esp,%ebp
+  8008c0:	56                   	push   %esi
+  8008c1:	53                   	push   %ebx
+  8008c2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008c8:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008cb:	89 f0                	mov    %esi,%eax
+  8008cd:	85 d2                	test   %edx,%edx
+  8008cf:	74 21                	je     8008f2 <strlcpy+0x35>
+  8008d1:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008d5:	89 f2                	mov    %esi,%edx
+  8008d7:	eb 09                	jmp    8008e2 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008d9:	83 c1 01             	add    $0x1,%ecx
+  8008dc:	83 c2 01             	add    $0x1,%edx
+  8008df:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008e2:	39 c2                	cmp    %eax,%edx
+  8008e4:	74 09                	je     8008ef <strlcpy+0x32>
+  8008e6:	0f b6 19             	movzbl (%ecx),%ebx
+  8008e9:	84 db                	test   %bl,%bl
+  8008eb:	75 ec                	jne    8008d9 <strlcpy+0x1c>
+  8008ed:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008ef:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008f2:	29 f0                	sub    %esi,%eax
+}
+  8008f4:	5b                   	pop    %ebx
+  8008f5:	5e                   	pop    %esi
+  8008f6:	5d                   	pop    %ebp
+  8008f7:	c3                   	ret
+
+008008f8 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008f8:	55                   	push   %ebp
+  8008f9:	89 e5                	mov    %esp,%ebp
+  8008fb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008fe:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800901:	eb 06                	jmp    800909 <strcmp+0x11>
+		p++, q++;
+  800903:	83 c1 01             	add    $0x1,%ecx
+  800906:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800909:	0f b6 01             	movzbl (%ecx),%eax
+  80090c:	84 c0                	test   %al,%al
+  80090e:	74 04                	je     800914 <strcmp+0x1c>
+  800910:	3a 02                	cmp    (%edx),%al
+  800912:	74 ef                	je     800903 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800914:	0f b6 c0             	movzbl %al,%eax
+  800917:	0f b6 12             	movzbl (%edx),%edx
+  80091a:	29 d0                	sub    %edx,%eax
+}
+  80091c:	5d                   	pop    %ebp
+  80091d:	c3                   	ret
+
+0080091e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80091e:	55                   	push   %ebp
+  80091f:	89 e5                	mov    %esp,%ebp
+  800921:	53                   	push   %ebx
+  800922:	8b 45 08             	mov    0x8(%ebp),%eax
+  800925:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800928:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80092b:	eb 09                	jmp    800936 <strncmp+0x18>
+		n--, p++, q++;
+  80092d:	83 ea 01             	sub    $0x1,%edx
+  800930:	83 c0 01             	add    $0x1,%eax
+  800933:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800936:	85 d2                	test   %edx,%edx
+  800938:	74 18                	je     800952 <strncmp+0x34>
+  80093a:	0f b6 18             	movzbl (%eax),%ebx
+  80093d:	84 db                	test   %bl,%bl
+  80093f:	74 04                	je     800945 <strncmp+0x27>
+  800941:	3a 19                	cmp    (%ecx),%bl
+  800943:	74 e8                	je     80092d <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800945:	0f b6 00             	movzbl (%eax),%eax
+  800948:	0f b6 11             	movzbl (%ecx),%edx
+  80094b:	29 d0                	sub    %edx,%eax
+}
+  80094d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800950:	c9                   	leave
+  800951:	c3                   	ret
+		return 0;
+  800952:	b8 00 00 00 00       	mov    $0x0,%eax
+  800957:	eb f4                	jmp    80094d <strncmp+0x2f>
+
+00800959 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800959:	55                   	push   %ebp
+  80095a:	89 e5                	mov    %esp,%ebp
+  80095c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80095f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800963:	eb 03                	jmp    800968 <strchr+0xf>
+  800965:	83 c0 01             	add    $0x1,%eax
+  800968:	0f b6 10             	movzbl (%eax),%edx
+  80096b:	84 d2                	test   %dl,%dl
+  80096d:	74 06                	je     800975 <strchr+0x1c>
+		if (*s == c)
+  80096f:	38 ca                	cmp    %cl,%dl
+  800971:	75 f2                	jne    800965 <strchr+0xc>
+  800973:	eb 05                	jmp    80097a <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800975:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80097a:	5d                   	pop    %ebp
+  80097b:	c3                   	ret
+
+0080097c <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80097c:	55                   	push   %ebp
+  80097d:	89 e5                	mov    %esp,%ebp
+  80097f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800982:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800986:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800989:	38 ca                	cmp    %cl,%dl
+  80098b:	74 09                	je     800996 <strfind+0x1a>
+  80098d:	84 d2                	test   %dl,%dl
+  80098f:	74 05                	je     800996 <strfind+0x1a>
+	for (; *s; s++)
+  800991:	83 c0 01             	add    $0x1,%eax
+  800994:	eb f0                	jmp    800986 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800996:	5d                   	pop    %ebp
+  800997:	c3                   	ret
+
+00800998 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800998:	55                   	push   %ebp
+  800999:	89 e5                	mov    %esp,%ebp
+  80099b:	57                   	push   %edi
+  80099c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80099f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8009a2:	85 c9                	test   %ecx,%ecx
+  8009a4:	74 20                	je     8009c6 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8009a6:	89 f8                	mov    %edi,%eax
+  8009a8:	09 c8                	or     %ecx,%eax
+  8009aa:	a8 03                	test   $0x3,%al
+  8009ac:	75 12                	jne    8009c0 <memset+0x28>
+		c &= 0xFF;
+  8009ae:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009b2:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8009b8:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009bb:	fc                   	cld
+  8009bc:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009be:	eb 06                	jmp    8009c6 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009c0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009c3:	fc                   	cld
+  8009c4:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009c6:	89 f8                	mov    %edi,%eax
+  8009c8:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009cb:	c9                   	leave
+  8009cc:	c3                   	ret
+
+008009cd <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009cd:	55                   	push   %ebp
+  8009ce:	89 e5                	mov    %esp,%ebp
+  8009d0:	57                   	push   %edi
+  8009d1:	56                   	push   %esi
+  8009d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009d8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009db:	39 c6                	cmp    %eax,%esi
+  8009dd:	73 32                	jae    800a11 <memmove+0x44>
+  8009df:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009e2:	39 d0                	cmp    %edx,%eax
+  8009e4:	73 2b                	jae    800a11 <memmove+0x44>
+		s += n;
+		d += n;
+  8009e6:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009e9:	89 d6                	mov    %edx,%esi
+  8009eb:	09 fe                	or     %edi,%esi
+  8009ed:	09 ce                	or     %ecx,%esi
+  8009ef:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009f5:	75 0e                	jne    800a05 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009f7:	83 ef 04             	sub    $0x4,%edi
+  8009fa:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009fd:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a00:	fd                   	std
+  800a01:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a03:	eb 09                	jmp    800a0e <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a05:	83 ef 01             	sub    $0x1,%edi
+  800a08:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a0b:	fd                   	std
+  800a0c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a0e:	fc                   	cld
+  800a0f:	eb 1a                	jmp    800a2b <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a11:	89 f2                	mov    %esi,%edx
+  800a13:	09 c2                	or     %eax,%edx
+  800a15:	09 ca                	or     %ecx,%edx
+  800a17:	f6 c2 03             	test   $0x3,%dl
+  800a1a:	75 0a                	jne    800a26 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a1c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a1f:	89 c7                	mov    %eax,%edi
+  800a21:	fc                   	cld
+  800a22:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a24:	eb 05                	jmp    800a2b <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a26:	89 c7                	mov    %eax,%edi
+  800a28:	fc                   	cld
+  800a29:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a2b:	5e                   	pop    %esi
+  800a2c:	5f                   	pop    %edi
+  800a2d:	5d                   	pop    %ebp
+  800a2e:	c3                   	ret
+
+00800a2f <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a2f:	55                   	push   %ebp
+  800a30:	89 e5                	mov    %esp,%ebp
+  800a32:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a35:	ff 75 10             	push   0x10(%ebp)
+  800a38:	ff 75 0c             	push   0xc(%ebp)
+  800a3b:	ff 75 08             	push   0x8(%ebp)
+  800a3e:	e8 8a ff ff ff       	call   8009cd <memmove>
+}
+  800a43:	c9                   	leave
+  800a44:	c3                   	ret
+
+00800a45 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a45:	55                   	push   %ebp
+  800a46:	89 e5                	mov    %esp,%ebp
+  800a48:	56                   	push   %esi
+  800a49:	53                   	push   %ebx
+  800a4a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a4d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a50:	89 c6                	mov    %eax,%esi
+  800a52:	03 75 10             	add    0x10(%ebp),%esi
+  800a55:	eb 06                	jmp    800a5d <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a57:	83 c0 01             	add    $0x1,%eax
+  800a5a:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a5d:	39 f0                	cmp    %esi,%eax
+  800a5f:	74 14                	je     800a75 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a61:	0f b6 08             	movzbl (%eax),%ecx
+  800a64:	0f b6 1a             	movzbl (%edx),%ebx
+  800a67:	38 d9                	cmp    %bl,%cl
+  800a69:	74 ec                	je     800a57 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a6b:	0f b6 c1             	movzbl %cl,%eax
+  800a6e:	0f b6 db             	movzbl %bl,%ebx
+  800a71:	29 d8                	sub    %ebx,%eax
+  800a73:	eb 05                	jmp    800a7a <memcmp+0x35>
+	}
+
+	return 0;
+  800a75:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a7a:	5b                   	pop    %ebx
+  800a7b:	5e                   	pop    %esi
+  800a7c:	5d                   	pop    %ebp
+  800a7d:	c3                   	ret
+
+00800a7e <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a7e:	55                   	push   %ebp
+  800a7f:	89 e5                	mov    %esp,%ebp
+  800a81:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a84:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a87:	89 c2                	mov    %eax,%edx
+  800a89:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a8c:	eb 03                	jmp    800a91 <memfind+0x13>
+  800a8e:	83 c0 01             	add    $0x1,%eax
+  800a91:	39 d0                	cmp    %edx,%eax
+  800a93:	73 04                	jae    800a99 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a95:	38 08                	cmp    %cl,(%eax)
+  800a97:	75 f5                	jne    800a8e <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a99:	5d                   	pop    %ebp
+  800a9a:	c3                   	ret
+
+00800a9b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a9b:	55                   	push   %ebp
+  800a9c:	89 e5                	mov    %esp,%ebp
+  800a9e:	57                   	push   %edi
+  800a9f:	56                   	push   %esi
+  800aa0:	53                   	push   %ebx
+  800aa1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aa4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800aa7:	eb 03                	jmp    800aac <strtol+0x11>
+		s++;
+  800aa9:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800aac:	0f b6 02             	movzbl (%edx),%eax
+  800aaf:	3c 20                	cmp    $0x20,%al
+  800ab1:	74 f6                	je     800aa9 <strtol+0xe>
+  800ab3:	3c 09                	cmp    $0x9,%al
+  800ab5:	74 f2                	je     800aa9 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800ab7:	3c 2b                	cmp    $0x2b,%al
+  800ab9:	74 2a                	je     800ae5 <strtol+0x4a>
+	int neg = 0;
+  800abb:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800ac0:	3c 2d                	cmp    $0x2d,%al
+  800ac2:	74 2b                	je     800aef <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ac4:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800aca:	75 0f                	jne    800adb <strtol+0x40>
+  800acc:	80 3a 30             	cmpb   $0x30,(%edx)
+  800acf:	74 28                	je     800af9 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ad1:	85 db                	test   %ebx,%ebx
+  800ad3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ad8:	0f 44 d8             	cmove  %eax,%ebx
+  800adb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ae0:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ae3:	eb 46                	jmp    800b2b <strtol+0x90>
+		s++;
+  800ae5:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800ae8:	bf 00 00 00 00       	mov    $0x0,%edi
+  800aed:	eb d5                	jmp    800ac4 <strtol+0x29>
+		s++, neg = 1;
+  800aef:	83 c2 01             	add    $0x1,%edx
+  800af2:	bf 01 00 00 00       	mov    $0x1,%edi
+  800af7:	eb cb                	jmp    800ac4 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800af9:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800afd:	74 0e                	je     800b0d <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800aff:	85 db                	test   %ebx,%ebx
+  800b01:	75 d8                	jne    800adb <strtol+0x40>
+		s++, base = 8;
+  800b03:	83 c2 01             	add    $0x1,%edx
+  800b06:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b0b:	eb ce                	jmp    800adb <strtol+0x40>
+		s += 2, base = 16;
+  800b0d:	83 c2 02             	add    $0x2,%edx
+  800b10:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b15:	eb c4                	jmp    800adb <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b17:	0f be c0             	movsbl %al,%eax
+  800b1a:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b1d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b20:	7d 3a                	jge    800b5c <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b22:	83 c2 01             	add    $0x1,%edx
+  800b25:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b29:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b2b:	0f b6 02             	movzbl (%edx),%eax
+  800b2e:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b31:	89 f3                	mov    %esi,%ebx
+  800b33:	80 fb 09             	cmp    $0x9,%bl
+  800b36:	76 df                	jbe    800b17 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b38:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b3b:	89 f3                	mov    %esi,%ebx
+  800b3d:	80 fb 19             	cmp    $0x19,%bl
+  800b40:	77 08                	ja     800b4a <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b42:	0f be c0             	movsbl %al,%eax
+  800b45:	83 e8 57             	sub    $0x57,%eax
+  800b48:	eb d3                	jmp    800b1d <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b4a:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b4d:	89 f3                	mov    %esi,%ebx
+  800b4f:	80 fb 19             	cmp    $0x19,%bl
+  800b52:	77 08                	ja     800b5c <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b54:	0f be c0             	movsbl %al,%eax
+  800b57:	83 e8 37             	sub    $0x37,%eax
+  800b5a:	eb c1                	jmp    800b1d <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b5c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b60:	74 05                	je     800b67 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b62:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b65:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b67:	89 c8                	mov    %ecx,%eax
+  800b69:	f7 d8                	neg    %eax
+  800b6b:	85 ff                	test   %edi,%edi
+  800b6d:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b70:	89 c8                	mov    %ecx,%eax
+  800b72:	5b                   	pop    %ebx
+  800b73:	5e                   	pop    %esi
+  800b74:	5f                   	pop    %edi
+  800b75:	5d                   	pop    %ebp
+  800b76:	c3                   	ret
+
+00800b77 <atoi>:
+
+int
+atoi(const char *s)
+{
+  800b77:	55                   	push   %ebp
+  800b78:	89 e5                	mov    %esp,%ebp
+  800b7a:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800b7d:	6a 0a                	push   $0xa
+  800b7f:	6a 00                	push   $0x0
+  800b81:	ff 75 08             	push   0x8(%ebp)
+  800b84:	e8 12 ff ff ff       	call   800a9b <strtol>
+}
+  800b89:	c9                   	leave
+  800b8a:	c3                   	ret
+
+00800b8b <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800b8b:	55                   	push   %ebp
+  800b8c:	89 e5                	mov    %esp,%ebp
+  800b8e:	57                   	push   %edi
+  800b8f:	56                   	push   %esi
+  800b90:	53                   	push   %ebx
+  800b91:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800b97:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800b9d:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800ba3:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800ba9:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800bb0:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800bb3:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800bba:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800bbd:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800bc4:	74 76                	je     800c3c <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800bc6:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800bcc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bcf:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800bd5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800bdc:	0f 88 06 01 00 00    	js     800ce8 <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800be2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800be9:	0f 84 48 01 00 00    	je     800d37 <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800bef:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800bf5:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800bfb:	be 00 00 00 00       	mov    $0x0,%esi
+  800c00:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800c06:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c09:	55                   	push   %ebp
+  800c0a:	68 13 0c 80 00       	push   $0x800c13
+  800c0f:	89 e5                	mov    %esp,%ebp
+  800c11:	0f 34                	sysenter
+  800c13:	83 c4 04             	add    $0x4,%esp
+  800c16:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800c17:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800c1d:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800c23:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800c26:	0f 85 9a 01 00 00    	jne    800dc6 <page_vec_call+0x23b>
+  800c2c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c31:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c34:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c37:	e9 29 01 00 00       	jmp    800d65 <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800c3c:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800c42:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c45:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800c47:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800c4e:	78 2f                	js     800c7f <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800c50:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800c57:	74 72                	je     800ccb <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800c59:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800c5f:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800c65:	b8 10 00 00 00       	mov    $0x10,%eax
+  800c6a:	89 fb                	mov    %edi,%ebx
+  800c6c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c6f:	55                   	push   %ebp
+  800c70:	68 79 0c 80 00       	push   $0x800c79
+  800c75:	89 e5                	mov    %esp,%ebp
+  800c77:	0f 34                	sysenter
+  800c79:	83 c4 04             	add    $0x4,%esp
+  800c7c:	5d                   	pop    %ebp
+	return ret;
+  800c7d:	eb 98                	jmp    800c17 <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800c7f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c84:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800c86:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800c8b:	f6 c6 08             	test   $0x8,%dh
+  800c8e:	74 15                	je     800ca5 <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c90:	89 c2                	mov    %eax,%edx
+  800c92:	c1 ea 08             	shr    $0x8,%edx
+  800c95:	83 e2 0f             	and    $0xf,%edx
+  800c98:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800c9d:	83 fa 06             	cmp    $0x6,%edx
+  800ca0:	74 0e                	je     800cb0 <page_vec_call+0x125>
+  800ca2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800ca5:	0f b6 c9             	movzbl %cl,%ecx
+  800ca8:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800cae:	eb a0                	jmp    800c50 <page_vec_call+0xc5>
+  800cb0:	89 c2                	mov    %eax,%edx
+  800cb2:	c1 ea 04             	shr    $0x4,%edx
+  800cb5:	83 e2 0f             	and    $0xf,%edx
+  800cb8:	83 fa 02             	cmp    $0x2,%edx
+  800cbb:	77 e5                	ja     800ca2 <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800cbd:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800cc0:	83 f8 02             	cmp    $0x2,%eax
+  800cc3:	0f 97 c1             	seta   %cl
+  800cc6:	0f b6 c9             	movzbl %cl,%ecx
+  800cc9:	eb d7                	jmp    800ca2 <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800ccb:	b8 10 00 00 00       	mov    $0x10,%eax
+  800cd0:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800cd6:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800cdc:	89 fb                	mov    %edi,%ebx
+  800cde:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800ce1:	cd 30                	int    $0x30
+  800ce3:	e9 2f ff ff ff       	jmp    800c17 <page_vec_call+0x8c>
+  800ce8:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ced:	0f a2                	cpuid
+		return 0;
+  800cef:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800cf4:	f6 c6 08             	test   $0x8,%dh
+  800cf7:	74 15                	je     800d0e <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800cf9:	89 c2                	mov    %eax,%edx
+  800cfb:	c1 ea 08             	shr    $0x8,%edx
+  800cfe:	83 e2 0f             	and    $0xf,%edx
+  800d01:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d06:	83 fa 06             	cmp    $0x6,%edx
+  800d09:	74 11                	je     800d1c <page_vec_call+0x191>
+  800d0b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800d0e:	0f b6 c9             	movzbl %cl,%ecx
+  800d11:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800d17:	e9 c6 fe ff ff       	jmp    800be2 <page_vec_call+0x57>
+  800d1c:	89 c2                	mov    %eax,%edx
+  800d1e:	c1 ea 04             	shr    $0x4,%edx
+  800d21:	83 e2 0f             	and    $0xf,%edx
+  800d24:	83 fa 02             	cmp    $0x2,%edx
+  800d27:	77 e2                	ja     800d0b <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800d29:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d2c:	83 f8 02             	cmp    $0x2,%eax
+  800d2f:	0f 97 c1             	seta   %cl
+  800d32:	0f b6 c9             	movzbl %cl,%ecx
+  800d35:	eb d4                	jmp    800d0b <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800d37:	be 00 00 00 00       	mov    $0x0,%esi
+  800d3c:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800d42:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800d48:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800d4e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800d51:	cd 30                	int    $0x30
+  800d53:	e9 bf fe ff ff       	jmp    800c17 <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800d58:	29 da                	sub    %ebx,%edx
+			vec++;
+  800d5a:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800d5d:	83 e8 01             	sub    $0x1,%eax
+  800d60:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800d65:	85 c0                	test   %eax,%eax
+  800d67:	74 58                	je     800dc1 <page_vec_call+0x236>
+  800d69:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800d6c:	39 da                	cmp    %ebx,%edx
+  800d6e:	73 e8                	jae    800d58 <page_vec_call+0x1cd>
+  800d70:	89 75 08             	mov    %esi,0x8(%ebp)
+  800d73:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800d76:	84 c9                	test   %cl,%cl
+  800d78:	74 06                	je     800d80 <page_vec_call+0x1f5>
+  800d7a:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800d80:	83 ec 04             	sub    $0x4,%esp
+  800d83:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d86:	c1 e0 04             	shl    $0x4,%eax
+  800d89:	50                   	push   %eax
+  800d8a:	ff 75 08             	push   0x8(%ebp)
+  800d8d:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800d93:	53                   	push   %ebx
+  800d94:	e8 34 fc ff ff       	call   8009cd <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800d99:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800d9f:	89 c2                	mov    %eax,%edx
+  800da1:	c1 e2 0c             	shl    $0xc,%edx
+  800da4:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  800daa:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  800db0:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  800db6:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  800db9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  800dbc:	e9 f2 fd ff ff       	jmp    800bb3 <page_vec_call+0x28>
+			r = 0;
+  800dc1:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  800dc6:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800dca:	74 0b                	je     800dd7 <page_vec_call+0x24c>
+		*done = total;
+  800dcc:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800dcf:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  800dd5:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  800dd7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dda:	5b                   	pop    %ebx
+  800ddb:	5e                   	pop    %esi
+  800ddc:	5f                   	pop    %edi
+  800ddd:	5d                   	pop    %ebp
+  800dde:	c3                   	ret
+
+00800ddf <sys_cputs>:
+{
+  800ddf:	55                   	push   %ebp
+  800de0:	89 e5                	mov    %esp,%ebp
+  800de2:	57                   	push   %edi
+  800de3:	56                   	push   %esi
+  800de4:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800de5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800dec:	78 2d                	js     800e1b <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800dee:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800df5:	74 70                	je     800e67 <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800df7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dfc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e02:	89 c3                	mov    %eax,%ebx
+  800e04:	89 c7                	mov    %eax,%edi
+  800e06:	89 c6                	mov    %eax,%esi
+  800e08:	55                   	push   %ebp
+  800e09:	68 12 0e 80 00       	push   $0x800e12
+  800e0e:	89 e5                	mov    %esp,%ebp
+  800e10:	0f 34                	sysenter
+  800e12:	83 c4 04             	add    $0x4,%esp
+  800e15:	5d                   	pop    %ebp
+}
+  800e16:	5b                   	pop    %ebx
+  800e17:	5e                   	pop    %esi
+  800e18:	5f                   	pop    %edi
+  800e19:	5d                   	pop    %ebp
+  800e1a:	c3                   	ret
+  800e1b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e20:	0f a2                	cpuid
+		return 0;
+  800e22:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800e27:	f6 c6 08             	test   $0x8,%dh
+  800e2a:	74 15                	je     800e41 <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e2c:	89 c2                	mov    %eax,%edx
+  800e2e:	c1 ea 08             	shr    $0x8,%edx
+  800e31:	83 e2 0f             	and    $0xf,%edx
+  800e34:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e39:	83 fa 06             	cmp    $0x6,%edx
+  800e3c:	74 0e                	je     800e4c <sys_cputs+0x6d>
+  800e3e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e41:	0f b6 c9             	movzbl %cl,%ecx
+  800e44:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800e4a:	eb a2                	jmp    800dee <sys_cputs+0xf>
+  800e4c:	89 c2                	mov    %eax,%edx
+  800e4e:	c1 ea 04             	shr    $0x4,%edx
+  800e51:	83 e2 0f             	and    $0xf,%edx
+  800e54:	83 fa 02             	cmp    $0x2,%edx
+  800e57:	77 e5                	ja     800e3e <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800e59:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e5c:	83 f8 02             	cmp    $0x2,%eax
+  800e5f:	0f 97 c1             	seta   %cl
+  800e62:	0f b6 c9             	movzbl %cl,%ecx
+  800e65:	eb d7                	jmp    800e3e <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800e67:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e72:	89 c3                	mov    %eax,%ebx
+  800e74:	89 c7                	mov    %eax,%edi
+  800e76:	89 c6                	mov    %eax,%esi
+  800e78:	cd 30                	int    $0x30
+}
+  800e7a:	eb 9a                	jmp    800e16 <sys_cputs+0x37>
+
+00800e7c <sys_cgetc>:
+{
+  800e7c:	55                   	push   %ebp
+  800e7d:	89 e5                	mov    %esp,%ebp
+  800e7f:	57                   	push   %edi
+  800e80:	56                   	push   %esi
+  800e81:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800e82:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e89:	78 2e                	js     800eb9 <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  800e8b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e92:	74 71                	je     800f05 <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  800e94:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e99:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e9e:	89 d1                	mov    %edx,%ecx
+  800ea0:	89 d3                	mov    %edx,%ebx
+  800ea2:	89 d7                	mov    %edx,%edi
+  800ea4:	89 d6                	mov    %edx,%esi
+  800ea6:	55                   	push   %ebp
+  800ea7:	68 b0 0e 80 00       	push   $0x800eb0
+  800eac:	89 e5                	mov    %esp,%ebp
+  800eae:	0f 34                	sysenter
+  800eb0:	83 c4 04             	add    $0x4,%esp
+  800eb3:	5d                   	pop    %ebp
+}
+  800eb4:	5b                   	pop    %ebx
+  800eb5:	5e                   	pop    %esi
+  800eb6:	5f                   	pop    %edi
+  800eb7:	5d                   	pop    %ebp
+  800eb8:	c3                   	ret
+  800eb9:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ebe:	0f a2                	cpuid
+		return 0;
+  800ec0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800ec5:	f6 c6 08             	test   $0x8,%dh
+  800ec8:	74 15                	je     800edf <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800eca:	89 c2                	mov    %eax,%edx
+  800ecc:	c1 ea 08             	shr    $0x8,%edx
+  800ecf:	83 e2 0f             	and    $0xf,%edx
+  800ed2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ed7:	83 fa 06             	cmp    $0x6,%edx
+  800eda:	74 0e                	je     800eea <sys_cgetc+0x6e>
+  800edc:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800edf:	0f b6 c9             	movzbl %cl,%ecx
+  800ee2:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800ee8:	eb a1                	jmp    800e8b <sys_cgetc+0xf>
+  800eea:	89 c2                	mov    %eax,%edx
+  800eec:	c1 ea 04             	shr    $0x4,%edx
+  800eef:	83 e2 0f             	and    $0xf,%edx
+  800ef2:	83 fa 02             	cmp    $0x2,%edx
+  800ef5:	77 e5                	ja     800edc <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  800ef7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800efa:	83 f8 02             	cmp    $0x2,%eax
+  800efd:	0f 97 c1             	seta   %cl
+  800f00:	0f b6 c9             	movzbl %cl,%ecx
+  800f03:	eb d7                	jmp    800edc <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  800f05:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f0a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f0f:	89 d1                	mov    %edx,%ecx
+  800f11:	89 d3                	mov    %edx,%ebx
+  800f13:	89 d7                	mov    %edx,%edi
+  800f15:	89 d6                	mov    %edx,%esi
+  800f17:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800f19:	eb 99                	jmp    800eb4 <sys_cgetc+0x38>
+
+00800f1b <sys_env_destroy>:
+{
+  800f1b:	55                   	push   %ebp
+  800f1c:	89 e5                	mov    %esp,%ebp
+  800f1e:	57                   	push   %edi
+  800f1f:	56                   	push   %esi
+  800f20:	53                   	push   %ebx
+  800f21:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800f24:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800f2b:	78 36                	js     800f63 <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  800f2d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800f34:	74 79                	je     800faf <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  800f36:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f39:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f3e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f43:	89 cb                	mov    %ecx,%ebx
+  800f45:	89 cf                	mov    %ecx,%edi
+  800f47:	89 ce                	mov    %ecx,%esi
+  800f49:	55                   	push   %ebp
+  800f4a:	68 53 0f 80 00       	push   $0x800f53
+  800f4f:	89 e5                	mov    %esp,%ebp
+  800f51:	0f 34                	sysenter
+  800f53:	83 c4 04             	add    $0x4,%esp
+  800f56:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800f57:	85 c0                	test   %eax,%eax
+  800f59:	7f 6b                	jg     800fc6 <sys_env_destroy+0xab>
+}
+  800f5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f5e:	5b                   	pop    %ebx
+  800f5f:	5e                   	pop    %esi
+  800f60:	5f                   	pop    %edi
+  800f61:	5d                   	pop    %ebp
+  800f62:	c3                   	ret
+  800f63:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f68:	0f a2                	cpuid
+		return 0;
+  800f6a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f6f:	f6 c6 08             	test   $0x8,%dh
+  800f72:	74 15                	je     800f89 <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f74:	89 c2                	mov    %eax,%edx
+  800f76:	c1 ea 08             	shr    $0x8,%edx
+  800f79:	83 e2 0f             	and    $0xf,%edx
+  800f7c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f81:	83 fa 06             	cmp    $0x6,%edx
+  800f84:	74 0e                	je     800f94 <sys_env_destroy+0x79>
+  800f86:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f89:	0f b6 c9             	movzbl %cl,%ecx
+  800f8c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  800f92:	eb 99                	jmp    800f2d <sys_env_destroy+0x12>
+  800f94:	89 c2                	mov    %eax,%edx
+  800f96:	c1 ea 04             	shr    $0x4,%edx
+  800f99:	83 e2 0f             	and    $0xf,%edx
+  800f9c:	83 fa 02             	cmp    $0x2,%edx
+  800f9f:	77 e5                	ja     800f86 <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  800fa1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800fa4:	83 f8 02             	cmp    $0x2,%eax
+  800fa7:	0f 97 c1             	seta   %cl
+  800faa:	0f b6 c9             	movzbl %cl,%ecx
+  800fad:	eb d7                	jmp    800f86 <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  800faf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fb4:	b8 03 00 00 00       	mov    $0x3,%eax
+  800fb9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fbc:	89 cb                	mov    %ecx,%ebx
+  800fbe:	89 cf                	mov    %ecx,%edi
+  800fc0:	89 ce                	mov    %ecx,%esi
+  800fc2:	cd 30                	int    $0x30
+  800fc4:	eb 91                	jmp    800f57 <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fc6:	83 ec 0c             	sub    $0xc,%esp
+  800fc9:	50                   	push   %eax
+  800fca:	6a 03                	push   $0x3
+  800fcc:	68 f9 2f 80 00       	push   $0x802ff9
+  800fd1:	6a 4a                	push   $0x4a
+  800fd3:	68 16 30 80 00       	push   $0x803016
+  800fd8:	e8 68 f1 ff ff       	call   800145 <_panic>
+
+00800fdd <sys_getenvid>:
+{
+  800fdd:	55                   	push   %ebp
+  800fde:	89 e5                	mov    %esp,%ebp
+  800fe0:	57                   	push   %edi
+  800fe1:	56                   	push   %esi
+  800fe2:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800fe3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800fea:	78 2e                	js     80101a <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  800fec:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800ff3:	74 71                	je     801066 <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  800ff5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ffa:	b8 02 00 00 00       	mov    $0x2,%eax
+  800fff:	89 d1                	mov    %edx,%ecx
+  801001:	89 d3                	mov    %edx,%ebx
+  801003:	89 d7                	mov    %edx,%edi
+  801005:	89 d6                	mov    %edx,%esi
+  801007:	55                   	push   %ebp
+  801008:	68 11 10 80 00       	push   $0x801011
+  80100d:	89 e5                	mov    %esp,%ebp
+  80100f:	0f 34                	sysenter
+  801011:	83 c4 04             	add    $0x4,%esp
+  801014:	5d                   	pop    %ebp
+}
+  801015:	5b                   	pop    %ebx
+  801016:	5e                   	pop    %esi
+  801017:	5f                   	pop    %edi
+  801018:	5d                   	pop    %ebp
+  801019:	c3                   	ret
+  80101a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80101f:	0f a2                	cpuid
+		return 0;
+  801021:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801026:	f6 c6 08             	test   $0x8,%dh
+  801029:	74 15                	je     801040 <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80102b:	89 c2                	mov    %eax,%edx
+  80102d:	c1 ea 08             	shr    $0x8,%edx
+  801030:	83 e2 0f             	and    $0xf,%edx
+  801033:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801038:	83 fa 06             	cmp    $0x6,%edx
+  80103b:	74 0e                	je     80104b <sys_getenvid+0x6e>
+  80103d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801040:	0f b6 c9             	movzbl %cl,%ecx
+  801043:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801049:	eb a1                	jmp    800fec <sys_getenvid+0xf>
+  80104b:	89 c2                	mov    %eax,%edx
+  80104d:	c1 ea 04             	shr    $0x4,%edx
+  801050:	83 e2 0f             	and    $0xf,%edx
+  801053:	83 fa 02             	cmp    $0x2,%edx
+  801056:	77 e5                	ja     80103d <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  801058:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80105b:	83 f8 02             	cmp    $0x2,%eax
+  80105e:	0f 97 c1             	seta   %cl
+  801061:	0f b6 c9             	movzbl %cl,%ecx
+  801064:	eb d7                	jmp    80103d <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  801066:	ba 00 00 00 00       	mov    $0x0,%edx
+  80106b:	b8 02 00 00 00       	mov    $0x2,%eax
+  801070:	89 d1                	mov    %edx,%ecx
+  801072:	89 d3                	mov    %edx,%ebx
+  801074:	89 d7                	mov    %edx,%edi
+  801076:	89 d6                	mov    %edx,%esi
+  801078:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80107a:	eb 99                	jmp    801015 <sys_getenvid+0x38>
+
+0080107c <sys_page_alloc>:
+{
+  80107c:	55                   	push   %ebp
+  80107d:	89 e5                	mov    %esp,%ebp
+  80107f:	57                   	push   %edi
+  801080:	56                   	push   %esi
+  801081:	53                   	push   %ebx
+  801082:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801085:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80108c:	78 38                	js     8010c6 <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  80108e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801095:	74 7b                	je     801112 <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  801097:	be 00 00 00 00       	mov    $0x0,%esi
+  80109c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a2:	b8 04 00 00 00       	mov    $0x4,%eax
+  8010a7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010aa:	89 f7                	mov    %esi,%edi
+  8010ac:	55                   	push   %ebp
+  8010ad:	68 b6 10 80 00       	push   $0x8010b6
+  8010b2:	89 e5                	mov    %esp,%ebp
+  8010b4:	0f 34                	sysenter
+  8010b6:	83 c4 04             	add    $0x4,%esp
+  8010b9:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8010ba:	85 c0                	test   %eax,%eax
+  8010bc:	7f 6d                	jg     80112b <sys_page_alloc+0xaf>
+}
+  8010be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c1:	5b                   	pop    %ebx
+  8010c2:	5e                   	pop    %esi
+  8010c3:	5f                   	pop    %edi
+  8010c4:	5d                   	pop    %ebp
+  8010c5:	c3                   	ret
+  8010c6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010cb:	0f a2                	cpuid
+		return 0;
+  8010cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8010d2:	f6 c6 08             	test   $0x8,%dh
+  8010d5:	74 15                	je     8010ec <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010d7:	89 c2                	mov    %eax,%edx
+  8010d9:	c1 ea 08             	shr    $0x8,%edx
+  8010dc:	83 e2 0f             	and    $0xf,%edx
+  8010df:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8010e4:	83 fa 06             	cmp    $0x6,%edx
+  8010e7:	74 0e                	je     8010f7 <sys_page_alloc+0x7b>
+  8010e9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8010ec:	0f b6 c9             	movzbl %cl,%ecx
+  8010ef:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8010f5:	eb 97                	jmp    80108e <sys_page_alloc+0x12>
+  8010f7:	89 c2                	mov    %eax,%edx
+  8010f9:	c1 ea 04             	shr    $0x4,%edx
+  8010fc:	83 e2 0f             	and    $0xf,%edx
+  8010ff:	83 fa 02             	cmp    $0x2,%edx
+  801102:	77 e5                	ja     8010e9 <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  801104:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801107:	83 f8 02             	cmp    $0x2,%eax
+  80110a:	0f 97 c1             	seta   %cl
+  80110d:	0f b6 c9             	movzbl %cl,%ecx
+  801110:	eb d7                	jmp    8010e9 <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  801112:	be 00 00 00 00       	mov    $0x0,%esi
+  801117:	b8 04 00 00 00       	mov    $0x4,%eax
+  80111c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80111f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801122:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801125:	89 f7                	mov    %esi,%edi
+  801127:	cd 30                	int    $0x30
+  801129:	eb 8f                	jmp    8010ba <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80112b:	83 ec 0c             	sub    $0xc,%esp
+  80112e:	50                   	push   %eax
+  80112f:	6a 04                	push   $0x4
+  801131:	68 f9 2f 80 00       	push   $0x802ff9
+  801136:	6a 4a                	push   $0x4a
+  801138:	68 16 30 80 00       	push   $0x803016
+  80113d:	e8 03 f0 ff ff       	call   800145 <_panic>
+
+00801142 <sys_page_map>:
+{
+  801142:	55                   	push   %ebp
+  801143:	89 e5                	mov    %esp,%ebp
+  801145:	57                   	push   %edi
+  801146:	56                   	push   %esi
+  801147:	53                   	push   %ebx
+  801148:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80114b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801152:	78 37                	js     80118b <sys_page_map+0x49>
+	if (syscall_sysenter)
+  801154:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80115b:	74 7a                	je     8011d7 <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  80115d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801160:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801163:	b8 05 00 00 00       	mov    $0x5,%eax
+  801168:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80116b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80116e:	8b 75 18             	mov    0x18(%ebp),%esi
+  801171:	55                   	push   %ebp
+  801172:	68 7b 11 80 00       	push   $0x80117b
+  801177:	89 e5                	mov    %esp,%ebp
+  801179:	0f 34                	sysenter
+  80117b:	83 c4 04             	add    $0x4,%esp
+  80117e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80117f:	85 c0                	test   %eax,%eax
+  801181:	7f 6c                	jg     8011ef <sys_page_map+0xad>
+}
+  801183:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801186:	5b                   	pop    %ebx
+  801187:	5e                   	pop    %esi
+  801188:	5f                   	pop    %edi
+  801189:	5d                   	pop    %ebp
+  80118a:	c3                   	ret
+  80118b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801190:	0f a2                	cpuid
+		return 0;
+  801192:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801197:	f6 c6 08             	test   $0x8,%dh
+  80119a:	74 15                	je     8011b1 <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80119c:	89 c2                	mov    %eax,%edx
+  80119e:	c1 ea 08             	shr    $0x8,%edx
+  8011a1:	83 e2 0f             	and    $0xf,%edx
+  8011a4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011a9:	83 fa 06             	cmp    $0x6,%edx
+  8011ac:	74 0e                	je     8011bc <sys_page_map+0x7a>
+  8011ae:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8011b1:	0f b6 c9             	movzbl %cl,%ecx
+  8011b4:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8011ba:	eb 98                	jmp    801154 <sys_page_map+0x12>
+  8011bc:	89 c2                	mov    %eax,%edx
+  8011be:	c1 ea 04             	shr    $0x4,%edx
+  8011c1:	83 e2 0f             	and    $0xf,%edx
+  8011c4:	83 fa 02             	cmp    $0x2,%edx
+  8011c7:	77 e5                	ja     8011ae <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  8011c9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011cc:	83 f8 02             	cmp    $0x2,%eax
+  8011cf:	0f 97 c1             	seta   %cl
+  8011d2:	0f b6 c9             	movzbl %cl,%ecx
+  8011d5:	eb d7                	jmp    8011ae <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  8011d7:	b8 05 00 00 00       	mov    $0x5,%eax
+  8011dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011e5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011e8:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011eb:	cd 30                	int    $0x30
+  8011ed:	eb 90                	jmp    80117f <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011ef:	83 ec 0c             	sub    $0xc,%esp
+  8011f2:	50                   	push   %eax
+  8011f3:	6a 05                	push   $0x5
+  8011f5:	68 f9 2f 80 00       	push   $0x802ff9
+  8011fa:	6a 4a                	push   $0x4a
+  8011fc:	68 16 30 80 00       	push   $0x803016
+  801201:	e8 3f ef ff ff       	call   800145 <_panic>
+
+00801206 <sys_page_unmap>:
+{
+  801206:	55                   	push   %ebp
+  801207:	89 e5                	mov    %esp,%ebp
+  801209:	57                   	push   %edi
+  80120a:	56                   	push   %esi
+  80120b:	53                   	push   %ebx
+  80120c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80120f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801216:	78 37                	js     80124f <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  801218:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80121f:	74 7a                	je     80129b <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  801221:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801226:	8b 55 08             	mov    0x8(%ebp),%edx
+  801229:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80122c:	b8 06 00 00 00       	mov    $0x6,%eax
+  801231:	89 df                	mov    %ebx,%edi
+  801233:	89 de                	mov    %ebx,%esi
+  801235:	55                   	push   %ebp
+  801236:	68 3f 12 80 00       	push   $0x80123f
+  80123b:	89 e5                	mov    %esp,%ebp
+  80123d:	0f 34                	sysenter
+  80123f:	83 c4 04             	add    $0x4,%esp
+  801242:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801243:	85 c0                	test   %eax,%eax
+  801245:	7f 6c                	jg     8012b3 <sys_page_unmap+0xad>
+}
+  801247:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80124a:	5b                   	pop    %ebx
+  80124b:	5e                   	pop    %esi
+  80124c:	5f                   	pop    %edi
+  80124d:	5d                   	pop    %ebp
+  80124e:	c3                   	ret
+  80124f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801254:	0f a2                	cpuid
+		return 0;
+  801256:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80125b:	f6 c6 08             	test   $0x8,%dh
+  80125e:	74 15                	je     801275 <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801260:	89 c2                	mov    %eax,%edx
+  801262:	c1 ea 08             	shr    $0x8,%edx
+  801265:	83 e2 0f             	and    $0xf,%edx
+  801268:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80126d:	83 fa 06             	cmp    $0x6,%edx
+  801270:	74 0e                	je     801280 <sys_page_unmap+0x7a>
+  801272:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801275:	0f b6 c9             	movzbl %cl,%ecx
+  801278:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80127e:	eb 98                	jmp    801218 <sys_page_unmap+0x12>
+  801280:	89 c2                	mov    %eax,%edx
+  801282:	c1 ea 04             	shr    $0x4,%edx
+  801285:	83 e2 0f             	and    $0xf,%edx
+  801288:	83 fa 02             	cmp    $0x2,%edx
+  80128b:	77 e5                	ja     801272 <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  80128d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801290:	83 f8 02             	cmp    $0x2,%eax
+  801293:	0f 97 c1             	seta   %cl
+  801296:	0f b6 c9             	movzbl %cl,%ecx
+  801299:	eb d7                	jmp    801272 <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  80129b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012a0:	b8 06 00 00 00       	mov    $0x6,%eax
+  8012a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ab:	89 df                	mov    %ebx,%edi
+  8012ad:	89 de                	mov    %ebx,%esi
+  8012af:	cd 30                	int    $0x30
+  8012b1:	eb 90                	jmp    801243 <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012b3:	83 ec 0c             	sub    $0xc,%esp
+  8012b6:	50                   	push   %eax
+  8012b7:	6a 06                	push   $0x6
+  8012b9:	68 f9 2f 80 00       	push   $0x802ff9
+  8012be:	6a 4a                	push   $0x4a
+  8012c0:	68 16 30 80 00       	push   $0x803016
+  8012c5:	e8 7b ee ff ff       	call   800145 <_panic>
+
+008012ca <sys_page_copy>:
+{
+  8012ca:	55                   	push   %ebp
+  8012cb:	89 e5                	mov    %esp,%ebp
+  8012cd:	57                   	push   %edi
+  8012ce:	56                   	push   %esi
+  8012cf:	53                   	push   %ebx
+  8012d0:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8012d3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8012da:	78 37                	js     801313 <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  8012dc:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8012e3:	74 7a                	je     80135f <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  8012e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012eb:	b8 29 00 00 00       	mov    $0x29,%eax
+  8012f0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012f3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012f6:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012f9:	55                   	push   %ebp
+  8012fa:	68 03 13 80 00       	push   $0x801303
+  8012ff:	89 e5                	mov    %esp,%ebp
+  801301:	0f 34                	sysenter
+  801303:	83 c4 04             	add    $0x4,%esp
+  801306:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801307:	85 c0                	test   %eax,%eax
+  801309:	7f 6c                	jg     801377 <sys_page_copy+0xad>
+}
+  80130b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80130e:	5b                   	pop    %ebx
+  80130f:	5e                   	pop    %esi
+  801310:	5f                   	pop    %edi
+  801311:	5d                   	pop    %ebp
+  801312:	c3                   	ret
+  801313:	b8 01 00 00 00       	mov    $0x1,%eax
+  801318:	0f a2                	cpuid
+		return 0;
+  80131a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80131f:	f6 c6 08             	test   $0x8,%dh
+  801322:	74 15                	je     801339 <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801324:	89 c2                	mov    %eax,%edx
+  801326:	c1 ea 08             	shr    $0x8,%edx
+  801329:	83 e2 0f             	and    $0xf,%edx
+  80132c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801331:	83 fa 06             	cmp    $0x6,%edx
+  801334:	74 0e                	je     801344 <sys_page_copy+0x7a>
+  801336:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801339:	0f b6 c9             	movzbl %cl,%ecx
+  80133c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801342:	eb 98                	jmp    8012dc <sys_page_copy+0x12>
+  801344:	89 c2                	mov    %eax,%edx
+  801346:	c1 ea 04             	shr    $0x4,%edx
+  801349:	83 e2 0f             	and    $0xf,%edx
+  80134c:	83 fa 02             	cmp    $0x2,%edx
+  80134f:	77 e5                	ja     801336 <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  801351:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801354:	83 f8 02             	cmp    $0x2,%eax
+  801357:	0f 97 c1             	seta   %cl
+  80135a:	0f b6 c9             	movzbl %cl,%ecx
+  80135d:	eb d7                	jmp    801336 <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  80135f:	b8 29 00 00 00       	mov    $0x29,%eax
+  801364:	8b 55 08             	mov    0x8(%ebp),%edx
+  801367:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80136a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80136d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801370:	8b 75 18             	mov    0x18(%ebp),%esi
+  801373:	cd 30                	int    $0x30
+  801375:	eb 90                	jmp    801307 <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801377:	83 ec 0c             	sub    $0xc,%esp
+  80137a:	50                   	push   %eax
+  80137b:	6a 29                	push   $0x29
+  80137d:	68 f9 2f 80 00       	push   $0x802ff9
+  801382:	6a 4a                	push   $0x4a
+  801384:	68 16 30 80 00       	push   $0x803016
+  801389:	e8 b7 ed ff ff       	call   800145 <_panic>
+
+0080138e <sys_yield>:
+{
+  80138e:	55                   	push   %ebp
+  80138f:	89 e5                	mov    %esp,%ebp
+  801391:	57                   	push   %edi
+  801392:	56                   	push   %esi
+  801393:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801394:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80139b:	78 2e                	js     8013cb <sys_yield+0x3d>
+	if (syscall_sysenter)
+  80139d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8013a4:	74 71                	je     801417 <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  8013a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013ab:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8013b0:	89 d1                	mov    %edx,%ecx
+  8013b2:	89 d3                	mov    %edx,%ebx
+  8013b4:	89 d7                	mov    %edx,%edi
+  8013b6:	89 d6                	mov    %edx,%esi
+  8013b8:	55                   	push   %ebp
+  8013b9:	68 c2 13 80 00       	push   $0x8013c2
+  8013be:	89 e5                	mov    %esp,%ebp
+  8013c0:	0f 34                	sysenter
+  8013c2:	83 c4 04             	add    $0x4,%esp
+  8013c5:	5d                   	pop    %ebp
+}
+  8013c6:	5b                   	pop    %ebx
+  8013c7:	5e                   	pop    %esi
+  8013c8:	5f                   	pop    %edi
+  8013c9:	5d                   	pop    %ebp
+  8013ca:	c3                   	ret
+  8013cb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013d0:	0f a2                	cpuid
+		return 0;
+  8013d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8013d7:	f6 c6 08             	test   $0x8,%dh
+  8013da:	74 15                	je     8013f1 <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013dc:	89 c2                	mov    %eax,%edx
+  8013de:	c1 ea 08             	shr    $0x8,%edx
+  8013e1:	83 e2 0f             	and    $0xf,%edx
+  8013e4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8013e9:	83 fa 06             	cmp    $0x6,%edx
+  8013ec:	74 0e                	je     8013fc <sys_yield+0x6e>
+  8013ee:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8013f1:	0f b6 c9             	movzbl %cl,%ecx
+  8013f4:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8013fa:	eb a1                	jmp    80139d <sys_yield+0xf>
+  8013fc:	89 c2                	mov    %eax,%edx
+  8013fe:	c1 ea 04             	shr    $0x4,%edx
+  801401:	83 e2 0f             	and    $0xf,%edx
+  801404:	83 fa 02             	cmp    $0x2,%edx
+  801407:	77 e5                	ja     8013ee <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  801409:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80140c:	83 f8 02             	cmp    $0x2,%eax
+  80140f:	0f 97 c1             	seta   %cl
+  801412:	0f b6 c9             	movzbl %cl,%ecx
+  801415:	eb d7                	jmp    8013ee <sys_yield+0x60>
+		asm volatile("int %1\n"
+  801417:	ba 00 00 00 00       	mov    $0x0,%edx
+  80141c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801421:	89 d1                	mov    %edx,%ecx
+  801423:	89 d3                	mov    %edx,%ebx
+  801425:	89 d7                	mov    %edx,%edi
+  801427:	89 d6                	mov    %edx,%esi
+  801429:	cd 30                	int    $0x30
+}
+  80142b:	eb 99                	jmp    8013c6 <sys_yield+0x38>
+
+0080142d <sys_env_set_status>:
+{
+  80142d:	55                   	push   %ebp
+  80142e:	89 e5                	mov    %esp,%ebp
+  801430:	57                   	push   %edi
+  801431:	56                   	push   %esi
+  801432:	53                   	push   %ebx
+  801433:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801436:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80143d:	78 37                	js     801476 <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  80143f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801446:	74 7a                	je     8014c2 <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  801448:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80144d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801450:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801453:	b8 08 00 00 00       	mov    $0x8,%eax
+  801458:	89 df                	mov    %ebx,%edi
+  80145a:	89 de                	mov    %ebx,%esi
+  80145c:	55                   	push   %ebp
+  80145d:	68 66 14 80 00       	push   $0x801466
+  801462:	89 e5                	mov    %esp,%ebp
+  801464:	0f 34                	sysenter
+  801466:	83 c4 04             	add    $0x4,%esp
+  801469:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80146a:	85 c0                	test   %eax,%eax
+  80146c:	7f 6c                	jg     8014da <sys_env_set_status+0xad>
+}
+  80146e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801471:	5b                   	pop    %ebx
+  801472:	5e                   	pop    %esi
+  801473:	5f                   	pop    %edi
+  801474:	5d                   	pop    %ebp
+  801475:	c3                   	ret
+  801476:	b8 01 00 00 00       	mov    $0x1,%eax
+  80147b:	0f a2                	cpuid
+		return 0;
+  80147d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801482:	f6 c6 08             	test   $0x8,%dh
+  801485:	74 15                	je     80149c <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801487:	89 c2                	mov    %eax,%edx
+  801489:	c1 ea 08             	shr    $0x8,%edx
+  80148c:	83 e2 0f             	and    $0xf,%edx
+  80148f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801494:	83 fa 06             	cmp    $0x6,%edx
+  801497:	74 0e                	je     8014a7 <sys_env_set_status+0x7a>
+  801499:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80149c:	0f b6 c9             	movzbl %cl,%ecx
+  80149f:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8014a5:	eb 98                	jmp    80143f <sys_env_set_status+0x12>
+  8014a7:	89 c2                	mov    %eax,%edx
+  8014a9:	c1 ea 04             	shr    $0x4,%edx
+  8014ac:	83 e2 0f             	and    $0xf,%edx
+  8014af:	83 fa 02             	cmp    $0x2,%edx
+  8014b2:	77 e5                	ja     801499 <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  8014b4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014b7:	83 f8 02             	cmp    $0x2,%eax
+  8014ba:	0f 97 c1             	seta   %cl
+  8014bd:	0f b6 c9             	movzbl %cl,%ecx
+  8014c0:	eb d7                	jmp    801499 <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  8014c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014c7:	b8 08 00 00 00       	mov    $0x8,%eax
+  8014cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014d2:	89 df                	mov    %ebx,%edi
+  8014d4:	89 de                	mov    %ebx,%esi
+  8014d6:	cd 30                	int    $0x30
+  8014d8:	eb 90                	jmp    80146a <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014da:	83 ec 0c             	sub    $0xc,%esp
+  8014dd:	50                   	push   %eax
+  8014de:	6a 08                	push   $0x8
+  8014e0:	68 f9 2f 80 00       	push   $0x802ff9
+  8014e5:	6a 4a                	push   $0x4a
+  8014e7:	68 16 30 80 00       	push   $0x803016
+  8014ec:	e8 54 ec ff ff       	call   800145 <_panic>
+
+008014f1 <sys_sysinfo>:
+{
+  8014f1:	55                   	push   %ebp
+  8014f2:	89 e5                	mov    %esp,%ebp
+  8014f4:	57                   	push   %edi
+  8014f5:	56                   	push   %esi
+  8014f6:	53                   	push   %ebx
+  8014f7:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8014fa:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801501:	78 36                	js     801539 <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  801503:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80150a:	74 79                	je     801585 <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  80150c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80150f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801514:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801519:	89 cb                	mov    %ecx,%ebx
+  80151b:	89 cf                	mov    %ecx,%edi
+  80151d:	89 ce                	mov    %ecx,%esi
+  80151f:	55                   	push   %ebp
+  801520:	68 29 15 80 00       	push   $0x801529
+  801525:	89 e5                	mov    %esp,%ebp
+  801527:	0f 34                	sysenter
+  801529:	83 c4 04             	add    $0x4,%esp
+  80152c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80152d:	85 c0                	test   %eax,%eax
+  80152f:	7f 6b                	jg     80159c <sys_sysinfo+0xab>
+}
+  801531:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801534:	5b                   	pop    %ebx
+  801535:	5e                   	pop    %esi
+  801536:	5f                   	pop    %edi
+  801537:	5d                   	pop    %ebp
+  801538:	c3                   	ret
+  801539:	b8 01 00 00 00       	mov    $0x1,%eax
+  80153e:	0f a2                	cpuid
+		return 0;
+  801540:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801545:	f6 c6 08             	test   $0x8,%dh
+  801548:	74 15                	je     80155f <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80154a:	89 c2                	mov    %eax,%edx
+  80154c:	c1 ea 08             	shr    $0x8,%edx
+  80154f:	83 e2 0f             	and    $0xf,%edx
+  801552:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801557:	83 fa 06             	cmp    $0x6,%edx
+  80155a:	74 0e                	je     80156a <sys_sysinfo+0x79>
+  80155c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80155f:	0f b6 c9             	movzbl %cl,%ecx
+  801562:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801568:	eb 99                	jmp    801503 <sys_sysinfo+0x12>
+  80156a:	89 c2                	mov    %eax,%edx
+  80156c:	c1 ea 04             	shr    $0x4,%edx
+  80156f:	83 e2 0f             	and    $0xf,%edx
+  801572:	83 fa 02             	cmp    $0x2,%edx
+  801575:	77 e5                	ja     80155c <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  801577:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80157a:	83 f8 02             	cmp    $0x2,%eax
+  80157d:	0f 97 c1             	seta   %cl
+  801580:	0f b6 c9             	movzbl %cl,%ecx
+  801583:	eb d7                	jmp    80155c <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  801585:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80158a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80158f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801592:	89 cb                	mov    %ecx,%ebx
+  801594:	89 cf                	mov    %ecx,%edi
+  801596:	89 ce                	mov    %ecx,%esi
+  801598:	cd 30                	int    $0x30
+  80159a:	eb 91                	jmp    80152d <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80159c:	83 ec 0c             	sub    $0xc,%esp
+  80159f:	50                   	push   %eax
+  8015a0:	6a 0b                	push   $0xb
+  8015a2:	68 f9 2f 80 00       	push   $0x802ff9
+  8015a7:	6a 4a                	push   $0x4a
+  8015a9:	68 16 30 80 00       	push   $0x803016
+  8015ae:	e8 92 eb ff ff       	call   800145 <_panic>
+
+008015b3 <sys_env_set_trapframe>:
+{
+  8015b3:	55                   	push   %ebp
+  8015b4:	89 e5                	mov    %esp,%ebp
+  8015b6:	57                   	push   %edi
+  8015b7:	56                   	push   %esi
+  8015b8:	53                   	push   %ebx
+  8015b9:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8015bc:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8015c3:	78 37                	js     8015fc <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  8015c5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8015cc:	74 7a                	je     801648 <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  8015ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015d9:	b8 13 00 00 00       	mov    $0x13,%eax
+  8015de:	89 df                	mov    %ebx,%edi
+  8015e0:	89 de                	mov    %ebx,%esi
+  8015e2:	55                   	push   %ebp
+  8015e3:	68 ec 15 80 00       	push   $0x8015ec
+  8015e8:	89 e5                	mov    %esp,%ebp
+  8015ea:	0f 34                	sysenter
+  8015ec:	83 c4 04             	add    $0x4,%esp
+  8015ef:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8015f0:	85 c0                	test   %eax,%eax
+  8015f2:	7f 6c                	jg     801660 <sys_env_set_trapframe+0xad>
+}
+  8015f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015f7:	5b                   	pop    %ebx
+  8015f8:	5e                   	pop    %esi
+  8015f9:	5f                   	pop    %edi
+  8015fa:	5d                   	pop    %ebp
+  8015fb:	c3                   	ret
+  8015fc:	b8 01 00 00 00       	mov    $0x1,%eax
+  801601:	0f a2                	cpuid
+		return 0;
+  801603:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801608:	f6 c6 08             	test   $0x8,%dh
+  80160b:	74 15                	je     801622 <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80160d:	89 c2                	mov    %eax,%edx
+  80160f:	c1 ea 08             	shr    $0x8,%edx
+  801612:	83 e2 0f             	and    $0xf,%edx
+  801615:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80161a:	83 fa 06             	cmp    $0x6,%edx
+  80161d:	74 0e                	je     80162d <sys_env_set_trapframe+0x7a>
+  80161f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801622:	0f b6 c9             	movzbl %cl,%ecx
+  801625:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80162b:	eb 98                	jmp    8015c5 <sys_env_set_trapframe+0x12>
+  80162d:	89 c2                	mov    %eax,%edx
+  80162f:	c1 ea 04             	shr    $0x4,%edx
+  801632:	83 e2 0f             	and    $0xf,%edx
+  801635:	83 fa 02             	cmp    $0x2,%edx
+  801638:	77 e5                	ja     80161f <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  80163a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80163d:	83 f8 02             	cmp    $0x2,%eax
+  801640:	0f 97 c1             	seta   %cl
+  801643:	0f b6 c9             	movzbl %cl,%ecx
+  801646:	eb d7                	jmp    80161f <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  801648:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80164d:	b8 13 00 00 00       	mov    $0x13,%eax
+  801652:	8b 55 08             	mov    0x8(%ebp),%edx
+  801655:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801658:	89 df                	mov    %ebx,%edi
+  80165a:	89 de                	mov    %ebx,%esi
+  80165c:	cd 30                	int    $0x30
+  80165e:	eb 90                	jmp    8015f0 <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801660:	83 ec 0c             	sub    $0xc,%esp
+  801663:	50                   	push   %eax
+  801664:	6a 13                	push   $0x13
+  801666:	68 f9 2f 80 00       	push   $0x802ff9
+  80166b:	6a 4a                	push   $0x4a
+  80166d:	68 16 30 80 00       	push   $0x803016
+  801672:	e8 ce ea ff ff       	call   800145 <_panic>
+
+00801677 <sys_env_set_stack_limit>:
+{
+  801677:	55                   	push   %ebp
+  801678:	89 e5                	mov    %esp,%ebp
+  80167a:	57                   	push   %edi
+  80167b:	56                   	push   %esi
+  80167c:	53                   	push   %ebx
+  80167d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801680:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801687:	78 37                	js     8016c0 <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  801689:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801690:	74 7a                	je     80170c <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  801692:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801697:	8b 55 08             	mov    0x8(%ebp),%edx
+  80169a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80169d:	b8 19 00 00 00       	mov    $0x19,%eax
+  8016a2:	89 df                	mov    %ebx,%edi
+  8016a4:	89 de                	mov    %ebx,%esi
+  8016a6:	55                   	push   %ebp
+  8016a7:	68 b0 16 80 00       	push   $0x8016b0
+  8016ac:	89 e5                	mov    %esp,%ebp
+  8016ae:	0f 34                	sysenter
+  8016b0:	83 c4 04             	add    $0x4,%esp
+  8016b3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8016b4:	85 c0                	test   %eax,%eax
+  8016b6:	7f 6c                	jg     801724 <sys_env_set_stack_limit+0xad>
+}
+  8016b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016bb:	5b                   	pop    %ebx
+  8016bc:	5e                   	pop    %esi
+  8016bd:	5f                   	pop    %edi
+  8016be:	5d                   	pop    %ebp
+  8016bf:	c3                   	ret
+  8016c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016c5:	0f a2                	cpuid
+		return 0;
+  8016c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8016cc:	f6 c6 08             	test   $0x8,%dh
+  8016cf:	74 15                	je     8016e6 <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016d1:	89 c2                	mov    %eax,%edx
+  8016d3:	c1 ea 08             	shr    $0x8,%edx
+  8016d6:	83 e2 0f             	and    $0xf,%edx
+  8016d9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8016de:	83 fa 06             	cmp    $0x6,%edx
+  8016e1:	74 0e                	je     8016f1 <sys_env_set_stack_limit+0x7a>
+  8016e3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8016e6:	0f b6 c9             	movzbl %cl,%ecx
+  8016e9:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8016ef:	eb 98                	jmp    801689 <sys_env_set_stack_limit+0x12>
+  8016f1:	89 c2                	mov    %eax,%edx
+  8016f3:	c1 ea 04             	shr    $0x4,%edx
+  8016f6:	83 e2 0f             	and    $0xf,%edx
+  8016f9:	83 fa 02             	cmp    $0x2,%edx
+  8016fc:	77 e5                	ja     8016e3 <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  8016fe:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801701:	83 f8 02             	cmp    $0x2,%eax
+  801704:	0f 97 c1             	seta   %cl
+  801707:	0f b6 c9             	movzbl %cl,%ecx
+  80170a:	eb d7                	jmp    8016e3 <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  80170c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801711:	b8 19 00 00 00       	mov    $0x19,%eax
+  801716:	8b 55 08             	mov    0x8(%ebp),%edx
+  801719:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80171c:	89 df                	mov    %ebx,%edi
+  80171e:	89 de                	mov    %ebx,%esi
+  801720:	cd 30                	int    $0x30
+  801722:	eb 90                	jmp    8016b4 <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801724:	83 ec 0c             	sub    $0xc,%esp
+  801727:	50                   	push   %eax
+  801728:	6a 19                	push   $0x19
+  80172a:	68 f9 2f 80 00       	push   $0x802ff9
+  80172f:	6a 4a                	push   $0x4a
+  801731:	68 16 30 80 00       	push   $0x803016
+  801736:	e8 0a ea ff ff       	call   800145 <_panic>
+
+0080173b <sys_env_set_pgfault_upcall>:
+{
+  80173b:	55                   	push   %ebp
+  80173c:	89 e5                	mov    %esp,%ebp
+  80173e:	57                   	push   %edi
+  80173f:	56                   	push   %esi
+  801740:	53                   	push   %ebx
+  801741:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801744:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80174b:	78 37                	js     801784 <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  80174d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801754:	74 7a                	je     8017d0 <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  801756:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80175b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80175e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801761:	b8 09 00 00 00       	mov    $0x9,%eax
+  801766:	89 df                	mov    %ebx,%edi
+  801768:	89 de                	mov    %ebx,%esi
+  80176a:	55                   	push   %ebp
+  80176b:	68 74 17 80 00       	push   $0x801774
+  801770:	89 e5                	mov    %esp,%ebp
+  801772:	0f 34                	sysenter
+  801774:	83 c4 04             	add    $0x4,%esp
+  801777:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801778:	85 c0                	test   %eax,%eax
+  80177a:	7f 6c                	jg     8017e8 <sys_env_set_pgfault_upcall+0xad>
+}
+  80177c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80177f:	5b                   	pop    %ebx
+  801780:	5e                   	pop    %esi
+  801781:	5f                   	pop    %edi
+  801782:	5d                   	pop    %ebp
+  801783:	c3                   	ret
+  801784:	b8 01 00 00 00       	mov    $0x1,%eax
+  801789:	0f a2                	cpuid
+		return 0;
+  80178b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801790:	f6 c6 08             	test   $0x8,%dh
+  801793:	74 15                	je     8017aa <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801795:	89 c2                	mov    %eax,%edx
+  801797:	c1 ea 08             	shr    $0x8,%edx
+  80179a:	83 e2 0f             	and    $0xf,%edx
+  80179d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017a2:	83 fa 06             	cmp    $0x6,%edx
+  8017a5:	74 0e                	je     8017b5 <sys_env_set_pgfault_upcall+0x7a>
+  8017a7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8017aa:	0f b6 c9             	movzbl %cl,%ecx
+  8017ad:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8017b3:	eb 98                	jmp    80174d <sys_env_set_pgfault_upcall+0x12>
+  8017b5:	89 c2                	mov    %eax,%edx
+  8017b7:	c1 ea 04             	shr    $0x4,%edx
+  8017ba:	83 e2 0f             	and    $0xf,%edx
+  8017bd:	83 fa 02             	cmp    $0x2,%edx
+  8017c0:	77 e5                	ja     8017a7 <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  8017c2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017c5:	83 f8 02             	cmp    $0x2,%eax
+  8017c8:	0f 97 c1             	seta   %cl
+  8017cb:	0f b6 c9             	movzbl %cl,%ecx
+  8017ce:	eb d7                	jmp    8017a7 <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  8017d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d5:	b8 09 00 00 00       	mov    $0x9,%eax
+  8017da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017e0:	89 df                	mov    %ebx,%edi
+  8017e2:	89 de                	mov    %ebx,%esi
+  8017e4:	cd 30                	int    $0x30
+  8017e6:	eb 90                	jmp    801778 <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017e8:	83 ec 0c             	sub    $0xc,%esp
+  8017eb:	50                   	push   %eax
+  8017ec:	6a 09                	push   $0x9
+  8017ee:	68 f9 2f 80 00       	push   $0x802ff9
+  8017f3:	6a 4a                	push   $0x4a
+  8017f5:	68 16 30 80 00       	push   $0x803016
+  8017fa:	e8 46 e9 ff ff       	call   800145 <_panic>
+
+008017ff <sys_ipc_try_send>:
+{
+  8017ff:	55                   	push   %ebp
+  801800:	89 e5                	mov    %esp,%ebp
+  801802:	57                   	push   %edi
+  801803:	56                   	push   %esi
+  801804:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801805:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80180c:	78 32                	js     801840 <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  80180e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801815:	74 75                	je     80188c <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801817:	8b 55 08             	mov    0x8(%ebp),%edx
+  80181a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80181d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801822:	be 00 00 00 00       	mov    $0x0,%esi
+  801827:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80182a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80182d:	55                   	push   %ebp
+  80182e:	68 37 18 80 00       	push   $0x801837
+  801833:	89 e5                	mov    %esp,%ebp
+  801835:	0f 34                	sysenter
+  801837:	83 c4 04             	add    $0x4,%esp
+  80183a:	5d                   	pop    %ebp
+}
+  80183b:	5b                   	pop    %ebx
+  80183c:	5e                   	pop    %esi
+  80183d:	5f                   	pop    %edi
+  80183e:	5d                   	pop    %ebp
+  80183f:	c3                   	ret
+  801840:	b8 01 00 00 00       	mov    $0x1,%eax
+  801845:	0f a2                	cpuid
+		return 0;
+  801847:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80184c:	f6 c6 08             	test   $0x8,%dh
+  80184f:	74 15                	je     801866 <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801851:	89 c2                	mov    %eax,%edx
+  801853:	c1 ea 08             	shr    $0x8,%edx
+  801856:	83 e2 0f             	and    $0xf,%edx
+  801859:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80185e:	83 fa 06             	cmp    $0x6,%edx
+  801861:	74 0e                	je     801871 <sys_ipc_try_send+0x72>
+  801863:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801866:	0f b6 c9             	movzbl %cl,%ecx
+  801869:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80186f:	eb 9d                	jmp    80180e <sys_ipc_try_send+0xf>
+  801871:	89 c2                	mov    %eax,%edx
+  801873:	c1 ea 04             	shr    $0x4,%edx
+  801876:	83 e2 0f             	and    $0xf,%edx
+  801879:	83 fa 02             	cmp    $0x2,%edx
+  80187c:	77 e5                	ja     801863 <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  80187e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801881:	83 f8 02             	cmp    $0x2,%eax
+  801884:	0f 97 c1             	seta   %cl
+  801887:	0f b6 c9             	movzbl %cl,%ecx
+  80188a:	eb d7                	jmp    801863 <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  80188c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801891:	be 00 00 00 00       	mov    $0x0,%esi
+  801896:	8b 55 08             	mov    0x8(%ebp),%edx
+  801899:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80189c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80189f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8018a2:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  8018a4:	eb 95                	jmp    80183b <sys_ipc_try_send+0x3c>
+
+008018a6 <sys_ipc_send>:
+{
+  8018a6:	55                   	push   %ebp
+  8018a7:	89 e5                	mov    %esp,%ebp
+  8018a9:	57                   	push   %edi
+  8018aa:	56                   	push   %esi
+  8018ab:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8018ac:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8018b3:	78 32                	js     8018e7 <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  8018b5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8018bc:	74 75                	je     801933 <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  8018be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018c4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8018c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8018ce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018d1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8018d4:	55                   	push   %ebp
+  8018d5:	68 de 18 80 00       	push   $0x8018de
+  8018da:	89 e5                	mov    %esp,%ebp
+  8018dc:	0f 34                	sysenter
+  8018de:	83 c4 04             	add    $0x4,%esp
+  8018e1:	5d                   	pop    %ebp
+}
+  8018e2:	5b                   	pop    %ebx
+  8018e3:	5e                   	pop    %esi
+  8018e4:	5f                   	pop    %edi
+  8018e5:	5d                   	pop    %ebp
+  8018e6:	c3                   	ret
+  8018e7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018ec:	0f a2                	cpuid
+		return 0;
+  8018ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018f3:	f6 c6 08             	test   $0x8,%dh
+  8018f6:	74 15                	je     80190d <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018f8:	89 c2                	mov    %eax,%edx
+  8018fa:	c1 ea 08             	shr    $0x8,%edx
+  8018fd:	83 e2 0f             	and    $0xf,%edx
+  801900:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801905:	83 fa 06             	cmp    $0x6,%edx
+  801908:	74 0e                	je     801918 <sys_ipc_send+0x72>
+  80190a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80190d:	0f b6 c9             	movzbl %cl,%ecx
+  801910:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801916:	eb 9d                	jmp    8018b5 <sys_ipc_send+0xf>
+  801918:	89 c2                	mov    %eax,%edx
+  80191a:	c1 ea 04             	shr    $0x4,%edx
+  80191d:	83 e2 0f             	and    $0xf,%edx
+  801920:	83 fa 02             	cmp    $0x2,%edx
+  801923:	77 e5                	ja     80190a <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  801925:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801928:	83 f8 02             	cmp    $0x2,%eax
+  80192b:	0f 97 c1             	seta   %cl
+  80192e:	0f b6 c9             	movzbl %cl,%ecx
+  801931:	eb d7                	jmp    80190a <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  801933:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801938:	be 00 00 00 00       	mov    $0x0,%esi
+  80193d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801940:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801943:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801946:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801949:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  80194b:	eb 95                	jmp    8018e2 <sys_ipc_send+0x3c>
+
+0080194d <sys_ipc_recv>:
+{
+  80194d:	55                   	push   %ebp
+  80194e:	89 e5                	mov    %esp,%ebp
+  801950:	57                   	push   %edi
+  801951:	56                   	push   %esi
+  801952:	53                   	push   %ebx
+  801953:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801956:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80195d:	78 36                	js     801995 <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  80195f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801966:	74 79                	je     8019e1 <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  801968:	8b 55 08             	mov    0x8(%ebp),%edx
+  80196b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801970:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801975:	89 cb                	mov    %ecx,%ebx
+  801977:	89 cf                	mov    %ecx,%edi
+  801979:	89 ce                	mov    %ecx,%esi
+  80197b:	55                   	push   %ebp
+  80197c:	68 85 19 80 00       	push   $0x801985
+  801981:	89 e5                	mov    %esp,%ebp
+  801983:	0f 34                	sysenter
+  801985:	83 c4 04             	add    $0x4,%esp
+  801988:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801989:	85 c0                	test   %eax,%eax
+  80198b:	7f 6b                	jg     8019f8 <sys_ipc_recv+0xab>
+}
+  80198d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801990:	5b                   	pop    %ebx
+  801991:	5e                   	pop    %esi
+  801992:	5f                   	pop    %edi
+  801993:	5d                   	pop    %ebp
+  801994:	c3                   	ret
+  801995:	b8 01 00 00 00       	mov    $0x1,%eax
+  80199a:	0f a2                	cpuid
+		return 0;
+  80199c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8019a1:	f6 c6 08             	test   $0x8,%dh
+  8019a4:	74 15                	je     8019bb <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019a6:	89 c2                	mov    %eax,%edx
+  8019a8:	c1 ea 08             	shr    $0x8,%edx
+  8019ab:	83 e2 0f             	and    $0xf,%edx
+  8019ae:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019b3:	83 fa 06             	cmp    $0x6,%edx
+  8019b6:	74 0e                	je     8019c6 <sys_ipc_recv+0x79>
+  8019b8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8019bb:	0f b6 c9             	movzbl %cl,%ecx
+  8019be:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8019c4:	eb 99                	jmp    80195f <sys_ipc_recv+0x12>
+  8019c6:	89 c2                	mov    %eax,%edx
+  8019c8:	c1 ea 04             	shr    $0x4,%edx
+  8019cb:	83 e2 0f             	and    $0xf,%edx
+  8019ce:	83 fa 02             	cmp    $0x2,%edx
+  8019d1:	77 e5                	ja     8019b8 <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  8019d3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019d6:	83 f8 02             	cmp    $0x2,%eax
+  8019d9:	0f 97 c1             	seta   %cl
+  8019dc:	0f b6 c9             	movzbl %cl,%ecx
+  8019df:	eb d7                	jmp    8019b8 <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  8019e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019e6:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8019eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019ee:	89 cb                	mov    %ecx,%ebx
+  8019f0:	89 cf                	mov    %ecx,%edi
+  8019f2:	89 ce                	mov    %ecx,%esi
+  8019f4:	cd 30                	int    $0x30
+  8019f6:	eb 91                	jmp    801989 <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8019f8:	83 ec 0c             	sub    $0xc,%esp
+  8019fb:	50                   	push   %eax
+  8019fc:	6a 0d                	push   $0xd
+  8019fe:	68 f9 2f 80 00       	push   $0x802ff9
+  801a03:	6a 4a                	push   $0x4a
+  801a05:	68 16 30 80 00       	push   $0x803016
+  801a0a:	e8 36 e7 ff ff       	call   800145 <_panic>
+
+00801a0f <sys_ipc_send_range>:
+{
+  801a0f:	55                   	push   %ebp
+  801a10:	89 e5                	mov    %esp,%ebp
+  801a12:	57                   	push   %edi
+  801a13:	56                   	push   %esi
+  801a14:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801a15:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a1c:	78 30                	js     801a4e <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  801a1e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a25:	74 73                	je     801a9a <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801a27:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a2a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a2d:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801a32:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a35:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a38:	8b 75 18             	mov    0x18(%ebp),%esi
+  801a3b:	55                   	push   %ebp
+  801a3c:	68 45 1a 80 00       	push   $0x801a45
+  801a41:	89 e5                	mov    %esp,%ebp
+  801a43:	0f 34                	sysenter
+  801a45:	83 c4 04             	add    $0x4,%esp
+  801a48:	5d                   	pop    %ebp
+}
+  801a49:	5b                   	pop    %ebx
+  801a4a:	5e                   	pop    %esi
+  801a4b:	5f                   	pop    %edi
+  801a4c:	5d                   	pop    %ebp
+  801a4d:	c3                   	ret
+  801a4e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a53:	0f a2                	cpuid
+		return 0;
+  801a55:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801a5a:	f6 c6 08             	test   $0x8,%dh
+  801a5d:	74 15                	je     801a74 <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a5f:	89 c2                	mov    %eax,%edx
+  801a61:	c1 ea 08             	shr    $0x8,%edx
+  801a64:	83 e2 0f             	and    $0xf,%edx
+  801a67:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a6c:	83 fa 06             	cmp    $0x6,%edx
+  801a6f:	74 0e                	je     801a7f <sys_ipc_send_range+0x70>
+  801a71:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a74:	0f b6 c9             	movzbl %cl,%ecx
+  801a77:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801a7d:	eb 9f                	jmp    801a1e <sys_ipc_send_range+0xf>
+  801a7f:	89 c2                	mov    %eax,%edx
+  801a81:	c1 ea 04             	shr    $0x4,%edx
+  801a84:	83 e2 0f             	and    $0xf,%edx
+  801a87:	83 fa 02             	cmp    $0x2,%edx
+  801a8a:	77 e5                	ja     801a71 <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  801a8c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a8f:	83 f8 02             	cmp    $0x2,%eax
+  801a92:	0f 97 c1             	seta   %cl
+  801a95:	0f b6 c9             	movzbl %cl,%ecx
+  801a98:	eb d7                	jmp    801a71 <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  801a9a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801a9f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aa2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801aa5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801aa8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801aab:	8b 75 18             	mov    0x18(%ebp),%esi
+  801aae:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  801ab0:	eb 97                	jmp    801a49 <sys_ipc_send_range+0x3a>
+
+00801ab2 <sys_ipc_recv_range>:
+{
+  801ab2:	55                   	push   %ebp
+  801ab3:	89 e5                	mov    %esp,%ebp
+  801ab5:	57                   	push   %edi
+  801ab6:	56                   	push   %esi
+  801ab7:	53                   	push   %ebx
+  801ab8:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801abb:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ac2:	78 37                	js     801afb <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  801ac4:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801acb:	74 7a                	je     801b47 <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  801acd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ad2:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ad5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ad8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801add:	89 df                	mov    %ebx,%edi
+  801adf:	89 de                	mov    %ebx,%esi
+  801ae1:	55                   	push   %ebp
+  801ae2:	68 eb 1a 80 00       	push   $0x801aeb
+  801ae7:	89 e5                	mov    %esp,%ebp
+  801ae9:	0f 34                	sysenter
+  801aeb:	83 c4 04             	add    $0x4,%esp
+  801aee:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801aef:	85 c0                	test   %eax,%eax
+  801af1:	7f 6c                	jg     801b5f <sys_ipc_recv_range+0xad>
+}
+  801af3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801af6:	5b                   	pop    %ebx
+  801af7:	5e                   	pop    %esi
+  801af8:	5f                   	pop    %edi
+  801af9:	5d                   	pop    %ebp
+  801afa:	c3                   	ret
+  801afb:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b00:	0f a2                	cpuid
+		return 0;
+  801b02:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b07:	f6 c6 08             	test   $0x8,%dh
+  801b0a:	74 15                	je     801b21 <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b0c:	89 c2                	mov    %eax,%edx
+  801b0e:	c1 ea 08             	shr    $0x8,%edx
+  801b11:	83 e2 0f             	and    $0xf,%edx
+  801b14:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b19:	83 fa 06             	cmp    $0x6,%edx
+  801b1c:	74 0e                	je     801b2c <sys_ipc_recv_range+0x7a>
+  801b1e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b21:	0f b6 c9             	movzbl %cl,%ecx
+  801b24:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801b2a:	eb 98                	jmp    801ac4 <sys_ipc_recv_range+0x12>
+  801b2c:	89 c2                	mov    %eax,%edx
+  801b2e:	c1 ea 04             	shr    $0x4,%edx
+  801b31:	83 e2 0f             	and    $0xf,%edx
+  801b34:	83 fa 02             	cmp    $0x2,%edx
+  801b37:	77 e5                	ja     801b1e <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801b39:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b3c:	83 f8 02             	cmp    $0x2,%eax
+  801b3f:	0f 97 c1             	seta   %cl
+  801b42:	0f b6 c9             	movzbl %cl,%ecx
+  801b45:	eb d7                	jmp    801b1e <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801b47:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b4c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801b51:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b54:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b57:	89 df                	mov    %ebx,%edi
+  801b59:	89 de                	mov    %ebx,%esi
+  801b5b:	cd 30                	int    $0x30
+  801b5d:	eb 90                	jmp    801aef <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801b5f:	83 ec 0c             	sub    $0xc,%esp
+  801b62:	50                   	push   %eax
+  801b63:	6a 1f                	push   $0x1f
+  801b65:	68 f9 2f 80 00       	push   $0x802ff9
+  801b6a:	6a 4a                	push   $0x4a
+  801b6c:	68 16 30 80 00       	push   $0x803016
+  801b71:	e8 cf e5 ff ff       	call   800145 <_panic>
+
+00801b76 <sys_ipc_call>:
+{
+  801b76:	55                   	push   %ebp
+  801b77:	89 e5                	mov    %esp,%ebp
+  801b79:	57                   	push   %edi
+  801b7a:	56                   	push   %esi
+  801b7b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801b7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b7f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801b84:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b87:	55                   	push   %ebp
+  801b88:	56                   	push   %esi
+  801b89:	8b 0e                	mov    (%esi),%ecx
+  801b8b:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801b8e:	8b 7e 08             	mov    0x8(%esi),%edi
+  801b91:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801b94:	8b 76 0c             	mov    0xc(%esi),%esi
+  801b97:	cd 30                	int    $0x30
+  801b99:	87 34 24             	xchg   %esi,(%esp)
+  801b9c:	89 0e                	mov    %ecx,(%esi)
+  801b9e:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801ba1:	89 7e 08             	mov    %edi,0x8(%esi)
+  801ba4:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801ba7:	8f 46 0c             	pop    0xc(%esi)
+  801baa:	5d                   	pop    %ebp
+}
+  801bab:	5b                   	pop    %ebx
+  801bac:	5e                   	pop    %esi
+  801bad:	5f                   	pop    %edi
+  801bae:	5d                   	pop    %ebp
+  801baf:	c3                   	ret
+
+00801bb0 <sys_ipc_reply_wait>:
+{
+  801bb0:	55                   	push   %ebp
+  801bb1:	89 e5                	mov    %esp,%ebp
+  801bb3:	57                   	push   %edi
+  801bb4:	56                   	push   %esi
+  801bb5:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801bb6:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bb9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801bbe:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801bc1:	55                   	push   %ebp
+  801bc2:	56                   	push   %esi
+  801bc3:	8b 0e                	mov    (%esi),%ecx
+  801bc5:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801bc8:	8b 7e 08             	mov    0x8(%esi),%edi
+  801bcb:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801bce:	8b 76 0c             	mov    0xc(%esi),%esi
+  801bd1:	cd 30                	int    $0x30
+  801bd3:	87 34 24             	xchg   %esi,(%esp)
+  801bd6:	89 0e                	mov    %ecx,(%esi)
+  801bd8:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801bdb:	89 7e 08             	mov    %edi,0x8(%esi)
+  801bde:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801be1:	8f 46 0c             	pop    0xc(%esi)
+  801be4:	5d                   	pop    %ebp
+}
+  801be5:	5b                   	pop    %ebx
+  801be6:	5e                   	pop    %esi
+  801be7:	5f                   	pop    %edi
+  801be8:	5d                   	pop    %ebp
+  801be9:	c3                   	ret
+
+00801bea <sys_ipc_send_msg>:
+{
+  801bea:	55                   	push   %ebp
+  801beb:	89 e5                	mov    %esp,%ebp
+  801bed:	57                   	push   %edi
+  801bee:	56                   	push   %esi
+  801bef:	53                   	push   %ebx
+  801bf0:	83 ec 20             	sub    $0x20,%esp
+  801bf3:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801bf6:	8b 10                	mov    (%eax),%edx
+  801bf8:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801bfb:	8b 50 04             	mov    0x4(%eax),%edx
+  801bfe:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801c01:	8b 50 08             	mov    0x8(%eax),%edx
+  801c04:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801c07:	8b 50 0c             	mov    0xc(%eax),%edx
+  801c0a:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801c0d:	8b 40 10             	mov    0x10(%eax),%eax
+  801c10:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801c13:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801c16:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c19:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801c1e:	55                   	push   %ebp
+  801c1f:	56                   	push   %esi
+  801c20:	8b 0e                	mov    (%esi),%ecx
+  801c22:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801c25:	8b 7e 08             	mov    0x8(%esi),%edi
+  801c28:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801c2b:	8b 76 0c             	mov    0xc(%esi),%esi
+  801c2e:	cd 30                	int    $0x30
+  801c30:	87 34 24             	xchg   %esi,(%esp)
+  801c33:	89 0e                	mov    %ecx,(%esi)
+  801c35:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801c38:	89 7e 08             	mov    %edi,0x8(%esi)
+  801c3b:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801c3e:	8f 46 0c             	pop    0xc(%esi)
+  801c41:	5d                   	pop    %ebp
+}
+  801c42:	83 c4 20             	add    $0x20,%esp
+  801c45:	5b                   	pop    %ebx
+  801c46:	5e                   	pop    %esi
+  801c47:	5f                   	pop    %edi
+  801c48:	5d                   	pop    %ebp
+  801c49:	c3                   	ret
+
+00801c4a <sys_fork>:
+{
+  801c4a:	55                   	push   %ebp
+  801c4b:	89 e5                	mov    %esp,%ebp
+  801c4d:	57                   	push   %edi
+  801c4e:	56                   	push   %esi
+  801c4f:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801c50:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801c57:	78 2e                	js     801c87 <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801c59:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801c60:	74 71                	je     801cd3 <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801c62:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c67:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801c6c:	89 d1                	mov    %edx,%ecx
+  801c6e:	89 d3                	mov    %edx,%ebx
+  801c70:	89 d7                	mov    %edx,%edi
+  801c72:	89 d6                	mov    %edx,%esi
+  801c74:	55                   	push   %ebp
+  801c75:	68 7e 1c 80 00       	push   $0x801c7e
+  801c7a:	89 e5                	mov    %esp,%ebp
+  801c7c:	0f 34                	sysenter
+  801c7e:	83 c4 04             	add    $0x4,%esp
+  801c81:	5d                   	pop    %ebp
+}
+  801c82:	5b                   	pop    %ebx
+  801c83:	5e                   	pop    %esi
+  801c84:	5f                   	pop    %edi
+  801c85:	5d                   	pop    %ebp
+  801c86:	c3                   	ret
+  801c87:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c8c:	0f a2                	cpuid
+		return 0;
+  801c8e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801c93:	f6 c6 08             	test   $0x8,%dh
+  801c96:	74 15                	je     801cad <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c98:	89 c2                	mov    %eax,%edx
+  801c9a:	c1 ea 08             	shr    $0x8,%edx
+  801c9d:	83 e2 0f             	and    $0xf,%edx
+  801ca0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ca5:	83 fa 06             	cmp    $0x6,%edx
+  801ca8:	74 0e                	je     801cb8 <sys_fork+0x6e>
+  801caa:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801cad:	0f b6 c9             	movzbl %cl,%ecx
+  801cb0:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801cb6:	eb a1                	jmp    801c59 <sys_fork+0xf>
+  801cb8:	89 c2                	mov    %eax,%edx
+  801cba:	c1 ea 04             	shr    $0x4,%edx
+  801cbd:	83 e2 0f             	and    $0xf,%edx
+  801cc0:	83 fa 02             	cmp    $0x2,%edx
+  801cc3:	77 e5                	ja     801caa <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801cc5:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801cc8:	83 f8 02             	cmp    $0x2,%eax
+  801ccb:	0f 97 c1             	seta   %cl
+  801cce:	0f b6 c9             	movzbl %cl,%ecx
+  801cd1:	eb d7                	jmp    801caa <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801cd3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cd8:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801cdd:	89 d1                	mov    %edx,%ecx
+  801cdf:	89 d3                	mov    %edx,%ebx
+  801ce1:	89 d7                	mov    %edx,%edi
+  801ce3:	89 d6                	mov    %edx,%esi
+  801ce5:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801ce7:	eb 99                	jmp    801c82 <sys_fork+0x38>
+
+00801ce9 <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801ce9:	55                   	push   %ebp
+  801cea:	89 e5                	mov    %esp,%ebp
+  801cec:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801cef:	ff 75 14             	push   0x14(%ebp)
+  801cf2:	ff 75 10             	push   0x10(%ebp)
+  801cf5:	ff 75 0c             	push   0xc(%ebp)
+  801cf8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cfd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d00:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801d05:	e8 81 ee ff ff       	call   800b8b <page_vec_call>
+}
+  801d0a:	c9                   	leave
+  801d0b:	c3                   	ret
+
+00801d0c <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801d0c:	55                   	push   %ebp
+  801d0d:	89 e5                	mov    %esp,%ebp
+  801d0f:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801d12:	ff 75 18             	push   0x18(%ebp)
+  801d15:	ff 75 14             	push   0x14(%ebp)
+  801d18:	ff 75 10             	push   0x10(%ebp)
+  801d1b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d1e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d21:	b8 10 00 00 00       	mov    $0x10,%eax
+  801d26:	e8 60 ee ff ff       	call   800b8b <page_vec_call>
+}
+  801d2b:	c9                   	leave
+  801d2c:	c3                   	ret
+
+00801d2d <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801d2d:	55                   	push   %ebp
+  801d2e:	89 e5                	mov    %esp,%ebp
+  801d30:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801d33:	ff 75 14             	push   0x14(%ebp)
+  801d36:	ff 75 10             	push   0x10(%ebp)
+  801d39:	ff 75 0c             	push   0xc(%ebp)
+  801d3c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d41:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d44:	b8 11 00 00 00       	mov    $0x11,%eax
+  801d49:	e8 3d ee ff ff       	call   800b8b <page_vec_call>
+}
+  801d4e:	c9                   	leave
+  801d4f:	c3                   	ret
+
+00801d50 <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801d50:	55                   	push   %ebp
+  801d51:	89 e5                	mov    %esp,%ebp
+  801d53:	57                   	push   %edi
+  801d54:	56                   	push   %esi
+  801d55:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801d56:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801d5d:	78 32                	js     801d91 <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801d5f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801d66:	74 75                	je     801ddd <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801d68:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d6b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d6e:	b8 12 00 00 00       	mov    $0x12,%eax
+  801d73:	be 00 00 00 00       	mov    $0x0,%esi
+  801d78:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d7b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801d7e:	55                   	push   %ebp
+  801d7f:	68 88 1d 80 00       	push   $0x801d88
+  801d84:	89 e5                	mov    %esp,%ebp
+  801d86:	0f 34                	sysenter
+  801d88:	83 c4 04             	add    $0x4,%esp
+  801d8b:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801d8c:	5b                   	pop    %ebx
+  801d8d:	5e                   	pop    %esi
+  801d8e:	5f                   	pop    %edi
+  801d8f:	5d                   	pop    %ebp
+  801d90:	c3                   	ret
+  801d91:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d96:	0f a2                	cpuid
+		return 0;
+  801d98:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801d9d:	f6 c6 08             	test   $0x8,%dh
+  801da0:	74 15                	je     801db7 <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801da2:	89 c2                	mov    %eax,%edx
+  801da4:	c1 ea 08             	shr    $0x8,%edx
+  801da7:	83 e2 0f             	and    $0xf,%edx
+  801daa:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801daf:	83 fa 06             	cmp    $0x6,%edx
+  801db2:	74 0e                	je     801dc2 <sys_vm_ranges+0x72>
+  801db4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801db7:	0f b6 c9             	movzbl %cl,%ecx
+  801dba:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801dc0:	eb 9d                	jmp    801d5f <sys_vm_ranges+0xf>
+  801dc2:	89 c2                	mov    %eax,%edx
+  801dc4:	c1 ea 04             	shr    $0x4,%edx
+  801dc7:	83 e2 0f             	and    $0xf,%edx
+  801dca:	83 fa 02             	cmp    $0x2,%edx
+  801dcd:	77 e5                	ja     801db4 <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  801dcf:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801dd2:	83 f8 02             	cmp    $0x2,%eax
+  801dd5:	0f 97 c1             	seta   %cl
+  801dd8:	0f b6 c9             	movzbl %cl,%ecx
+  801ddb:	eb d7                	jmp    801db4 <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801ddd:	b8 12 00 00 00       	mov    $0x12,%eax
+  801de2:	be 00 00 00 00       	mov    $0x0,%esi
+  801de7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801dea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ded:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801df0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801df3:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801df5:	eb 95                	jmp    801d8c <sys_vm_ranges+0x3c>
+
+00801df7 <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801df7:	55                   	push   %ebp
+  801df8:	89 e5                	mov    %esp,%ebp
+  801dfa:	57                   	push   %edi
+  801dfb:	56                   	push   %esi
+  801dfc:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801dfd:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e04:	78 31                	js     801e37 <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801e06:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e0d:	74 74                	je     801e83 <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801e0f:	be 00 00 00 00       	mov    $0x0,%esi
+  801e14:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e1a:	b8 14 00 00 00       	mov    $0x14,%eax
+  801e1f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e22:	89 f7                	mov    %esi,%edi
+  801e24:	55                   	push   %ebp
+  801e25:	68 2e 1e 80 00       	push   $0x801e2e
+  801e2a:	89 e5                	mov    %esp,%ebp
+  801e2c:	0f 34                	sysenter
+  801e2e:	83 c4 04             	add    $0x4,%esp
+  801e31:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801e32:	5b                   	pop    %ebx
+  801e33:	5e                   	pop    %esi
+  801e34:	5f                   	pop    %edi
+  801e35:	5d                   	pop    %ebp
+  801e36:	c3                   	ret
+  801e37:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e3c:	0f a2                	cpuid
+		return 0;
+  801e3e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801e43:	f6 c6 08             	test   $0x8,%dh
+  801e46:	74 15                	je     801e5d <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e48:	89 c2                	mov    %eax,%edx
+  801e4a:	c1 ea 08             	shr    $0x8,%edx
+  801e4d:	83 e2 0f             	and    $0xf,%edx
+  801e50:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e55:	83 fa 06             	cmp    $0x6,%edx
+  801e58:	74 0e                	je     801e68 <sys_spawn+0x71>
+  801e5a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801e5d:	0f b6 c9             	movzbl %cl,%ecx
+  801e60:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801e66:	eb 9e                	jmp    801e06 <sys_spawn+0xf>
+  801e68:	89 c2                	mov    %eax,%edx
+  801e6a:	c1 ea 04             	shr    $0x4,%edx
+  801e6d:	83 e2 0f             	and    $0xf,%edx
+  801e70:	83 fa 02             	cmp    $0x2,%edx
+  801e73:	77 e5                	ja     801e5a <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  801e75:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e78:	83 f8 02             	cmp    $0x2,%eax
+  801e7b:	0f 97 c1             	seta   %cl
+  801e7e:	0f b6 c9             	movzbl %cl,%ecx
+  801e81:	eb d7                	jmp    801e5a <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  801e83:	be 00 00 00 00       	mov    $0x0,%esi
+  801e88:	b8 14 00 00 00       	mov    $0x14,%eax
+  801e8d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e90:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e93:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e96:	89 f7                	mov    %esi,%edi
+  801e98:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  801e9a:	eb 96                	jmp    801e32 <sys_spawn+0x3b>
+
+00801e9c <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  801e9c:	55                   	push   %ebp
+  801e9d:	89 e5                	mov    %esp,%ebp
+  801e9f:	57                   	push   %edi
+  801ea0:	56                   	push   %esi
+  801ea1:	53                   	push   %ebx
+  801ea2:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801ea5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801eac:	78 37                	js     801ee5 <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  801eae:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801eb5:	74 7a                	je     801f31 <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  801eb7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ebc:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ebf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ec2:	b8 15 00 00 00       	mov    $0x15,%eax
+  801ec7:	89 df                	mov    %ebx,%edi
+  801ec9:	89 de                	mov    %ebx,%esi
+  801ecb:	55                   	push   %ebp
+  801ecc:	68 d5 1e 80 00       	push   $0x801ed5
+  801ed1:	89 e5                	mov    %esp,%ebp
+  801ed3:	0f 34                	sysenter
+  801ed5:	83 c4 04             	add    $0x4,%esp
+  801ed8:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801ed9:	85 c0                	test   %eax,%eax
+  801edb:	7f 6c                	jg     801f49 <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  801edd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ee0:	5b                   	pop    %ebx
+  801ee1:	5e                   	pop    %esi
+  801ee2:	5f                   	pop    %edi
+  801ee3:	5d                   	pop    %ebp
+  801ee4:	c3                   	ret
+  801ee5:	b8 01 00 00 00       	mov    $0x1,%eax
+  801eea:	0f a2                	cpuid
+		return 0;
+  801eec:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801ef1:	f6 c6 08             	test   $0x8,%dh
+  801ef4:	74 15                	je     801f0b <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ef6:	89 c2                	mov    %eax,%edx
+  801ef8:	c1 ea 08             	shr    $0x8,%edx
+  801efb:	83 e2 0f             	and    $0xf,%edx
+  801efe:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f03:	83 fa 06             	cmp    $0x6,%edx
+  801f06:	74 0e                	je     801f16 <sys_shm_create+0x7a>
+  801f08:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801f0b:	0f b6 c9             	movzbl %cl,%ecx
+  801f0e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801f14:	eb 98                	jmp    801eae <sys_shm_create+0x12>
+  801f16:	89 c2                	mov    %eax,%edx
+  801f18:	c1 ea 04             	shr    $0x4,%edx
+  801f1b:	83 e2 0f             	and    $0xf,%edx
+  801f1e:	83 fa 02             	cmp    $0x2,%edx
+  801f21:	77 e5                	ja     801f08 <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  801f23:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f26:	83 f8 02             	cmp    $0x2,%eax
+  801f29:	0f 97 c1             	seta   %cl
+  801f2c:	0f b6 c9             	movzbl %cl,%ecx
+  801f2f:	eb d7                	jmp    801f08 <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  801f31:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f36:	b8 15 00 00 00       	mov    $0x15,%eax
+  801f3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f3e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f41:	89 df                	mov    %ebx,%edi
+  801f43:	89 de                	mov    %ebx,%esi
+  801f45:	cd 30                	int    $0x30
+  801f47:	eb 90                	jmp    801ed9 <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801f49:	83 ec 0c             	sub    $0xc,%esp
+  801f4c:	50                   	push   %eax
+  801f4d:	6a 15                	push   $0x15
+  801f4f:	68 f9 2f 80 00       	push   $0x802ff9
+  801f54:	6a 4a                	push   $0x4a
+  801f56:	68 16 30 80 00       	push   $0x803016
+  801f5b:	e8 e5 e1 ff ff       	call   800145 <_panic>
+
+00801f60 <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  801f60:	55                   	push   %ebp
+  801f61:	89 e5                	mov    %esp,%ebp
+  801f63:	57                   	push   %edi
+  801f64:	56                   	push   %esi
+  801f65:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801f66:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f6d:	78 32                	js     801fa1 <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  801f6f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f76:	74 75                	je     801fed <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801f78:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f7b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f7e:	b8 16 00 00 00       	mov    $0x16,%eax
+  801f83:	be 00 00 00 00       	mov    $0x0,%esi
+  801f88:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f8b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801f8e:	55                   	push   %ebp
+  801f8f:	68 98 1f 80 00       	push   $0x801f98
+  801f94:	89 e5                	mov    %esp,%ebp
+  801f96:	0f 34                	sysenter
+  801f98:	83 c4 04             	add    $0x4,%esp
+  801f9b:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  801f9c:	5b                   	pop    %ebx
+  801f9d:	5e                   	pop    %esi
+  801f9e:	5f                   	pop    %edi
+  801f9f:	5d                   	pop    %ebp
+  801fa0:	c3                   	ret
+  801fa1:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fa6:	0f a2                	cpuid
+		return 0;
+  801fa8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801fad:	f6 c6 08             	test   $0x8,%dh
+  801fb0:	74 15                	je     801fc7 <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fb2:	89 c2                	mov    %eax,%edx
+  801fb4:	c1 ea 08             	shr    $0x8,%edx
+  801fb7:	83 e2 0f             	and    $0xf,%edx
+  801fba:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801fbf:	83 fa 06             	cmp    $0x6,%edx
+  801fc2:	74 0e                	je     801fd2 <sys_shm_attach+0x72>
+  801fc4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801fc7:	0f b6 c9             	movzbl %cl,%ecx
+  801fca:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801fd0:	eb 9d                	jmp    801f6f <sys_shm_attach+0xf>
+  801fd2:	89 c2                	mov    %eax,%edx
+  801fd4:	c1 ea 04             	shr    $0x4,%edx
+  801fd7:	83 e2 0f             	and    $0xf,%edx
+  801fda:	83 fa 02             	cmp    $0x2,%edx
+  801fdd:	77 e5                	ja     801fc4 <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  801fdf:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fe2:	83 f8 02             	cmp    $0x2,%eax
+  801fe5:	0f 97 c1             	seta   %cl
+  801fe8:	0f b6 c9             	movzbl %cl,%ecx
+  801feb:	eb d7                	jmp    801fc4 <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  801fed:	b8 16 00 00 00       	mov    $0x16,%eax
+  801ff2:	be 00 00 00 00       	mov    $0x0,%esi
+  801ff7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ffa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ffd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802000:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802003:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  802005:	eb 95                	jmp    801f9c <sys_shm_attach+0x3c>
+
+00802007 <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  802007:	55                   	push   %ebp
+  802008:	89 e5                	mov    %esp,%ebp
+  80200a:	57                   	push   %edi
+  80200b:	56                   	push   %esi
+  80200c:	53                   	push   %ebx
+  80200d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802010:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802017:	78 38                	js     802051 <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  802019:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802020:	74 7b                	je     80209d <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  802022:	be 00 00 00 00       	mov    $0x0,%esi
+  802027:	8b 55 08             	mov    0x8(%ebp),%edx
+  80202a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80202d:	b8 17 00 00 00       	mov    $0x17,%eax
+  802032:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802035:	89 f7                	mov    %esi,%edi
+  802037:	55                   	push   %ebp
+  802038:	68 41 20 80 00       	push   $0x802041
+  80203d:	89 e5                	mov    %esp,%ebp
+  80203f:	0f 34                	sysenter
+  802041:	83 c4 04             	add    $0x4,%esp
+  802044:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802045:	85 c0                	test   %eax,%eax
+  802047:	7f 6d                	jg     8020b6 <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  802049:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80204c:	5b                   	pop    %ebx
+  80204d:	5e                   	pop    %esi
+  80204e:	5f                   	pop    %edi
+  80204f:	5d                   	pop    %ebp
+  802050:	c3                   	ret
+  802051:	b8 01 00 00 00       	mov    $0x1,%eax
+  802056:	0f a2                	cpuid
+		return 0;
+  802058:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80205d:	f6 c6 08             	test   $0x8,%dh
+  802060:	74 15                	je     802077 <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802062:	89 c2                	mov    %eax,%edx
+  802064:	c1 ea 08             	shr    $0x8,%edx
+  802067:	83 e2 0f             	and    $0xf,%edx
+  80206a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80206f:	83 fa 06             	cmp    $0x6,%edx
+  802072:	74 0e                	je     802082 <sys_shm_detach+0x7b>
+  802074:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802077:	0f b6 c9             	movzbl %cl,%ecx
+  80207a:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802080:	eb 97                	jmp    802019 <sys_shm_detach+0x12>
+  802082:	89 c2                	mov    %eax,%edx
+  802084:	c1 ea 04             	shr    $0x4,%edx
+  802087:	83 e2 0f             	and    $0xf,%edx
+  80208a:	83 fa 02             	cmp    $0x2,%edx
+  80208d:	77 e5                	ja     802074 <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  80208f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802092:	83 f8 02             	cmp    $0x2,%eax
+  802095:	0f 97 c1             	seta   %cl
+  802098:	0f b6 c9             	movzbl %cl,%ecx
+  80209b:	eb d7                	jmp    802074 <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  80209d:	be 00 00 00 00       	mov    $0x0,%esi
+  8020a2:	b8 17 00 00 00       	mov    $0x17,%eax
+  8020a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020ad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8020b0:	89 f7                	mov    %esi,%edi
+  8020b2:	cd 30                	int    $0x30
+  8020b4:	eb 8f                	jmp    802045 <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8020b6:	83 ec 0c             	sub    $0xc,%esp
+  8020b9:	50                   	push   %eax
+  8020ba:	6a 17                	push   $0x17
+  8020bc:	68 f9 2f 80 00       	push   $0x802ff9
+  8020c1:	6a 4a                	push   $0x4a
+  8020c3:	68 16 30 80 00       	push   $0x803016
+  8020c8:	e8 78 e0 ff ff       	call   800145 <_panic>
+
+008020cd <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  8020cd:	55                   	push   %ebp
+  8020ce:	89 e5                	mov    %esp,%ebp
+  8020d0:	57                   	push   %edi
+  8020d1:	56                   	push   %esi
+  8020d2:	53                   	push   %ebx
+  8020d3:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8020d6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8020dd:	78 36                	js     802115 <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  8020df:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8020e6:	74 79                	je     802161 <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  8020e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020f0:	b8 18 00 00 00       	mov    $0x18,%eax
+  8020f5:	89 cb                	mov    %ecx,%ebx
+  8020f7:	89 cf                	mov    %ecx,%edi
+  8020f9:	89 ce                	mov    %ecx,%esi
+  8020fb:	55                   	push   %ebp
+  8020fc:	68 05 21 80 00       	push   $0x802105
+  802101:	89 e5                	mov    %esp,%ebp
+  802103:	0f 34                	sysenter
+  802105:	83 c4 04             	add    $0x4,%esp
+  802108:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802109:	85 c0                	test   %eax,%eax
+  80210b:	7f 6b                	jg     802178 <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  80210d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802110:	5b                   	pop    %ebx
+  802111:	5e                   	pop    %esi
+  802112:	5f                   	pop    %edi
+  802113:	5d                   	pop    %ebp
+  802114:	c3                   	ret
+  802115:	b8 01 00 00 00       	mov    $0x1,%eax
+  80211a:	0f a2                	cpuid
+		return 0;
+  80211c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802121:	f6 c6 08             	test   $0x8,%dh
+  802124:	74 15                	je     80213b <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802126:	89 c2                	mov    %eax,%edx
+  802128:	c1 ea 08             	shr    $0x8,%edx
+  80212b:	83 e2 0f             	and    $0xf,%edx
+  80212e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802133:	83 fa 06             	cmp    $0x6,%edx
+  802136:	74 0e                	je     802146 <sys_shm_remove+0x79>
+  802138:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80213b:	0f b6 c9             	movzbl %cl,%ecx
+  80213e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802144:	eb 99                	jmp    8020df <sys_shm_remove+0x12>
+  802146:	89 c2                	mov    %eax,%edx
+  802148:	c1 ea 04             	shr    $0x4,%edx
+  80214b:	83 e2 0f             	and    $0xf,%edx
+  80214e:	83 fa 02             	cmp    $0x2,%edx
+  802151:	77 e5                	ja     802138 <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  802153:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802156:	83 f8 02             	cmp    $0x2,%eax
+  802159:	0f 97 c1             	seta   %cl
+  80215c:	0f b6 c9             	movzbl %cl,%ecx
+  80215f:	eb d7                	jmp    802138 <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  802161:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802166:	b8 18 00 00 00       	mov    $0x18,%eax
+  80216b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80216e:	89 cb                	mov    %ecx,%ebx
+  802170:	89 cf                	mov    %ecx,%edi
+  802172:	89 ce                	mov    %ecx,%esi
+  802174:	cd 30                	int    $0x30
+  802176:	eb 91                	jmp    802109 <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802178:	83 ec 0c             	sub    $0xc,%esp
+  80217b:	50                   	push   %eax
+  80217c:	6a 18                	push   $0x18
+  80217e:	68 f9 2f 80 00       	push   $0x802ff9
+  802183:	6a 4a                	push   $0x4a
+  802185:	68 16 30 80 00       	push   $0x803016
+  80218a:	e8 b6 df ff ff       	call   800145 <_panic>
+
+0080218f <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  80218f:	55                   	push   %ebp
+  802190:	89 e5                	mov    %esp,%ebp
+  802192:	57                   	push   %edi
+  802193:	56                   	push   %esi
+  802194:	53                   	push   %ebx
+  802195:	83 ec 0c             	sub    $0xc,%esp
+  802198:	8b 45 10             	mov    0x10(%ebp),%eax
+  80219b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80219e:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  8021a1:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8021a8:	78 32                	js     8021dc <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  8021aa:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8021b1:	74 75                	je     802228 <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  8021b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021b9:	b8 20 00 00 00       	mov    $0x20,%eax
+  8021be:	be 00 00 00 00       	mov    $0x0,%esi
+  8021c3:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8021c6:	55                   	push   %ebp
+  8021c7:	68 d0 21 80 00       	push   $0x8021d0
+  8021cc:	89 e5                	mov    %esp,%ebp
+  8021ce:	0f 34                	sysenter
+  8021d0:	83 c4 04             	add    $0x4,%esp
+  8021d3:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  8021d4:	83 c4 0c             	add    $0xc,%esp
+  8021d7:	5b                   	pop    %ebx
+  8021d8:	5e                   	pop    %esi
+  8021d9:	5f                   	pop    %edi
+  8021da:	5d                   	pop    %ebp
+  8021db:	c3                   	ret
+  8021dc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021e1:	0f a2                	cpuid
+		return 0;
+  8021e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8021e8:	f6 c6 08             	test   $0x8,%dh
+  8021eb:	74 15                	je     802202 <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021ed:	89 c2                	mov    %eax,%edx
+  8021ef:	c1 ea 08             	shr    $0x8,%edx
+  8021f2:	83 e2 0f             	and    $0xf,%edx
+  8021f5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8021fa:	83 fa 06             	cmp    $0x6,%edx
+  8021fd:	74 0e                	je     80220d <sys_futex_wait+0x7e>
+  8021ff:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802202:	0f b6 c9             	movzbl %cl,%ecx
+  802205:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80220b:	eb 9d                	jmp    8021aa <sys_futex_wait+0x1b>
+  80220d:	89 c2                	mov    %eax,%edx
+  80220f:	c1 ea 04             	shr    $0x4,%edx
+  802212:	83 e2 0f             	and    $0xf,%edx
+  802215:	83 fa 02             	cmp    $0x2,%edx
+  802218:	77 e5                	ja     8021ff <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  80221a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80221d:	83 f8 02             	cmp    $0x2,%eax
+  802220:	0f 97 c1             	seta   %cl
+  802223:	0f b6 c9             	movzbl %cl,%ecx
+  802226:	eb d7                	jmp    8021ff <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  802228:	b8 20 00 00 00       	mov    $0x20,%eax
+  80222d:	be 00 00 00 00       	mov    $0x0,%esi
+  802232:	8b 55 08             	mov    0x8(%ebp),%edx
+  802235:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802238:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  80223b:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  80223d:	eb 95                	jmp    8021d4 <sys_futex_wait+0x45>
+
+0080223f <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80223f:	55                   	push   %ebp
+  802240:	89 e5                	mov    %esp,%ebp
+  802242:	57                   	push   %edi
+  802243:	56                   	push   %esi
+  802244:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802245:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80224c:	78 30                	js     80227e <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  80224e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802255:	74 73                	je     8022ca <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  802257:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80225c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80225f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802262:	b8 21 00 00 00       	mov    $0x21,%eax
+  802267:	89 df                	mov    %ebx,%edi
+  802269:	89 de                	mov    %ebx,%esi
+  80226b:	55                   	push   %ebp
+  80226c:	68 75 22 80 00       	push   $0x802275
+  802271:	89 e5                	mov    %esp,%ebp
+  802273:	0f 34                	sysenter
+  802275:	83 c4 04             	add    $0x4,%esp
+  802278:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  802279:	5b                   	pop    %ebx
+  80227a:	5e                   	pop    %esi
+  80227b:	5f                   	pop    %edi
+  80227c:	5d                   	pop    %ebp
+  80227d:	c3                   	ret
+  80227e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802283:	0f a2                	cpuid
+		return 0;
+  802285:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80228a:	f6 c6 08             	test   $0x8,%dh
+  80228d:	74 15                	je     8022a4 <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80228f:	89 c2                	mov    %eax,%edx
+  802291:	c1 ea 08             	shr    $0x8,%edx
+  802294:	83 e2 0f             	and    $0xf,%edx
+  802297:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80229c:	83 fa 06             	cmp    $0x6,%edx
+  80229f:	74 0e                	je     8022af <sys_futex_wake+0x70>
+  8022a1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8022a4:	0f b6 c9             	movzbl %cl,%ecx
+  8022a7:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8022ad:	eb 9f                	jmp    80224e <sys_futex_wake+0xf>
+  8022af:	89 c2                	mov    %eax,%edx
+  8022b1:	c1 ea 04             	shr    $0x4,%edx
+  8022b4:	83 e2 0f             	and    $0xf,%edx
+  8022b7:	83 fa 02             	cmp    $0x2,%edx
+  8022ba:	77 e5                	ja     8022a1 <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  8022bc:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022bf:	83 f8 02             	cmp    $0x2,%eax
+  8022c2:	0f 97 c1             	seta   %cl
+  8022c5:	0f b6 c9             	movzbl %cl,%ecx
+  8022c8:	eb d7                	jmp    8022a1 <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  8022ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022cf:	b8 21 00 00 00       	mov    $0x21,%eax
+  8022d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022da:	89 df                	mov    %ebx,%edi
+  8022dc:	89 de                	mov    %ebx,%esi
+  8022de:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  8022e0:	eb 97                	jmp    802279 <sys_futex_wake+0x3a>
+
+008022e2 <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  8022e2:	55                   	push   %ebp
+  8022e3:	89 e5                	mov    %esp,%ebp
+  8022e5:	57                   	push   %edi
+  8022e6:	56                   	push   %esi
+  8022e7:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8022e8:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8022ef:	78 2e                	js     80231f <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  8022f1:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8022f8:	74 71                	je     80236b <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  8022fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022ff:	b8 22 00 00 00       	mov    $0x22,%eax
+  802304:	89 d1                	mov    %edx,%ecx
+  802306:	89 d3                	mov    %edx,%ebx
+  802308:	89 d7                	mov    %edx,%edi
+  80230a:	89 d6                	mov    %edx,%esi
+  80230c:	55                   	push   %ebp
+  80230d:	68 16 23 80 00       	push   $0x802316
+  802312:	89 e5                	mov    %esp,%ebp
+  802314:	0f 34                	sysenter
+  802316:	83 c4 04             	add    $0x4,%esp
+  802319:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  80231a:	5b                   	pop    %ebx
+  80231b:	5e                   	pop    %esi
+  80231c:	5f                   	pop    %edi
+  80231d:	5d                   	pop    %ebp
+  80231e:	c3                   	ret
+  80231f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802324:	0f a2                	cpuid
+		return 0;
+  802326:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80232b:	f6 c6 08             	test   $0x8,%dh
+  80232e:	74 15                	je     802345 <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802330:	89 c2                	mov    %eax,%edx
+  802332:	c1 ea 08             	shr    $0x8,%edx
+  802335:	83 e2 0f             	and    $0xf,%edx
+  802338:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80233d:	83 fa 06             	cmp    $0x6,%edx
+  802340:	74 0e                	je     802350 <sys_ep_create+0x6e>
+  802342:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802345:	0f b6 c9             	movzbl %cl,%ecx
+  802348:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80234e:	eb a1                	jmp    8022f1 <sys_ep_create+0xf>
+  802350:	89 c2                	mov    %eax,%edx
+  802352:	c1 ea 04             	shr    $0x4,%edx
+  802355:	83 e2 0f             	and    $0xf,%edx
+  802358:	83 fa 02             	cmp    $0x2,%edx
+  80235b:	77 e5                	ja     802342 <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  80235d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802360:	83 f8 02             	cmp    $0x2,%eax
+  802363:	0f 97 c1             	seta   %cl
+  802366:	0f b6 c9             	movzbl %cl,%ecx
+  802369:	eb d7                	jmp    802342 <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  80236b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802370:	b8 22 00 00 00       	mov    $0x22,%eax
+  802375:	89 d1                	mov    %edx,%ecx
+  802377:	89 d3                	mov    %edx,%ebx
+  802379:	89 d7                	mov    %edx,%edi
+  80237b:	89 d6                	mov    %edx,%esi
+  80237d:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  80237f:	eb 99                	jmp    80231a <sys_ep_create+0x38>
+
+00802381 <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  802381:	55                   	push   %ebp
+  802382:	89 e5                	mov    %esp,%ebp
+  802384:	57                   	push   %edi
+  802385:	56                   	push   %esi
+  802386:	53                   	push   %ebx
+  802387:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80238a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802391:	78 36                	js     8023c9 <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  802393:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80239a:	74 79                	je     802415 <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  80239c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80239f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023a4:	b8 23 00 00 00       	mov    $0x23,%eax
+  8023a9:	89 cb                	mov    %ecx,%ebx
+  8023ab:	89 cf                	mov    %ecx,%edi
+  8023ad:	89 ce                	mov    %ecx,%esi
+  8023af:	55                   	push   %ebp
+  8023b0:	68 b9 23 80 00       	push   $0x8023b9
+  8023b5:	89 e5                	mov    %esp,%ebp
+  8023b7:	0f 34                	sysenter
+  8023b9:	83 c4 04             	add    $0x4,%esp
+  8023bc:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8023bd:	85 c0                	test   %eax,%eax
+  8023bf:	7f 6b                	jg     80242c <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  8023c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023c4:	5b                   	pop    %ebx
+  8023c5:	5e                   	pop    %esi
+  8023c6:	5f                   	pop    %edi
+  8023c7:	5d                   	pop    %ebp
+  8023c8:	c3                   	ret
+  8023c9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023ce:	0f a2                	cpuid
+		return 0;
+  8023d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8023d5:	f6 c6 08             	test   $0x8,%dh
+  8023d8:	74 15                	je     8023ef <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023da:	89 c2                	mov    %eax,%edx
+  8023dc:	c1 ea 08             	shr    $0x8,%edx
+  8023df:	83 e2 0f             	and    $0xf,%edx
+  8023e2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8023e7:	83 fa 06             	cmp    $0x6,%edx
+  8023ea:	74 0e                	je     8023fa <sys_ep_destroy+0x79>
+  8023ec:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8023ef:	0f b6 c9             	movzbl %cl,%ecx
+  8023f2:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8023f8:	eb 99                	jmp    802393 <sys_ep_destroy+0x12>
+  8023fa:	89 c2                	mov    %eax,%edx
+  8023fc:	c1 ea 04             	shr    $0x4,%edx
+  8023ff:	83 e2 0f             	and    $0xf,%edx
+  802402:	83 fa 02             	cmp    $0x2,%edx
+  802405:	77 e5                	ja     8023ec <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  802407:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80240a:	83 f8 02             	cmp    $0x2,%eax
+  80240d:	0f 97 c1             	seta   %cl
+  802410:	0f b6 c9             	movzbl %cl,%ecx
+  802413:	eb d7                	jmp    8023ec <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  802415:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80241a:	b8 23 00 00 00       	mov    $0x23,%eax
+  80241f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802422:	89 cb                	mov    %ecx,%ebx
+  802424:	89 cf                	mov    %ecx,%edi
+  802426:	89 ce                	mov    %ecx,%esi
+  802428:	cd 30                	int    $0x30
+  80242a:	eb 91                	jmp    8023bd <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80242c:	83 ec 0c             	sub    $0xc,%esp
+  80242f:	50                   	push   %eax
+  802430:	6a 23                	push   $0x23
+  802432:	68 f9 2f 80 00       	push   $0x802ff9
+  802437:	6a 4a                	push   $0x4a
+  802439:	68 16 30 80 00       	push   $0x803016
+  80243e:	e8 02 dd ff ff       	call   800145 <_panic>
+
+00802443 <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  802443:	55                   	push   %ebp
+  802444:	89 e5                	mov    %esp,%ebp
+  802446:	57                   	push   %edi
+  802447:	56                   	push   %esi
+  802448:	53                   	push   %ebx
+  802449:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80244c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802453:	78 37                	js     80248c <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  802455:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80245c:	74 7a                	je     8024d8 <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  80245e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802463:	8b 55 08             	mov    0x8(%ebp),%edx
+  802466:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802469:	b8 24 00 00 00       	mov    $0x24,%eax
+  80246e:	89 df                	mov    %ebx,%edi
+  802470:	89 de                	mov    %ebx,%esi
+  802472:	55                   	push   %ebp
+  802473:	68 7c 24 80 00       	push   $0x80247c
+  802478:	89 e5                	mov    %esp,%ebp
+  80247a:	0f 34                	sysenter
+  80247c:	83 c4 04             	add    $0x4,%esp
+  80247f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802480:	85 c0                	test   %eax,%eax
+  802482:	7f 6c                	jg     8024f0 <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  802484:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802487:	5b                   	pop    %ebx
+  802488:	5e                   	pop    %esi
+  802489:	5f                   	pop    %edi
+  80248a:	5d                   	pop    %ebp
+  80248b:	c3                   	ret
+  80248c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802491:	0f a2                	cpuid
+		return 0;
+  802493:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802498:	f6 c6 08             	test   $0x8,%dh
+  80249b:	74 15                	je     8024b2 <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80249d:	89 c2                	mov    %eax,%edx
+  80249f:	c1 ea 08             	shr    $0x8,%edx
+  8024a2:	83 e2 0f             	and    $0xf,%edx
+  8024a5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8024aa:	83 fa 06             	cmp    $0x6,%edx
+  8024ad:	74 0e                	je     8024bd <sys_ep_grant+0x7a>
+  8024af:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8024b2:	0f b6 c9             	movzbl %cl,%ecx
+  8024b5:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8024bb:	eb 98                	jmp    802455 <sys_ep_grant+0x12>
+  8024bd:	89 c2                	mov    %eax,%edx
+  8024bf:	c1 ea 04             	shr    $0x4,%edx
+  8024c2:	83 e2 0f             	and    $0xf,%edx
+  8024c5:	83 fa 02             	cmp    $0x2,%edx
+  8024c8:	77 e5                	ja     8024af <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  8024ca:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8024cd:	83 f8 02             	cmp    $0x2,%eax
+  8024d0:	0f 97 c1             	seta   %cl
+  8024d3:	0f b6 c9             	movzbl %cl,%ecx
+  8024d6:	eb d7                	jmp    8024af <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  8024d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024dd:	b8 24 00 00 00       	mov    $0x24,%eax
+  8024e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024e8:	89 df                	mov    %ebx,%edi
+  8024ea:	89 de                	mov    %ebx,%esi
+  8024ec:	cd 30                	int    $0x30
+  8024ee:	eb 90                	jmp    802480 <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8024f0:	83 ec 0c             	sub    $0xc,%esp
+  8024f3:	50                   	push   %eax
+  8024f4:	6a 24                	push   $0x24
+  8024f6:	68 f9 2f 80 00       	push   $0x802ff9
+  8024fb:	6a 4a                	push   $0x4a
+  8024fd:	68 16 30 80 00       	push   $0x803016
+  802502:	e8 3e dc ff ff       	call   800145 <_panic>
+
+00802507 <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  802507:	55                   	push   %ebp
+  802508:	89 e5                	mov    %esp,%ebp
+  80250a:	57                   	push   %edi
+  80250b:	56                   	push   %esi
+  80250c:	53                   	push   %ebx
+  80250d:	83 ec 20             	sub    $0x20,%esp
+  802510:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  802513:	8b 10                	mov    (%eax),%edx
+  802515:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802518:	8b 50 04             	mov    0x4(%eax),%edx
+  80251b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80251e:	8b 50 08             	mov    0x8(%eax),%edx
+  802521:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  802524:	8b 50 0c             	mov    0xc(%eax),%edx
+  802527:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  80252a:	8b 40 10             	mov    0x10(%eax),%eax
+  80252d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  802530:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  802533:	8b 55 08             	mov    0x8(%ebp),%edx
+  802536:	b8 25 00 00 00       	mov    $0x25,%eax
+  80253b:	55                   	push   %ebp
+  80253c:	56                   	push   %esi
+  80253d:	8b 0e                	mov    (%esi),%ecx
+  80253f:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802542:	8b 7e 08             	mov    0x8(%esi),%edi
+  802545:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802548:	8b 76 0c             	mov    0xc(%esi),%esi
+  80254b:	cd 30                	int    $0x30
+  80254d:	87 34 24             	xchg   %esi,(%esp)
+  802550:	89 0e                	mov    %ecx,(%esi)
+  802552:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802555:	89 7e 08             	mov    %edi,0x8(%esi)
+  802558:	89 6e 10             	mov    %ebp,0x10(%esi)
+  80255b:	8f 46 0c             	pop    0xc(%esi)
+  80255e:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  80255f:	83 c4 20             	add    $0x20,%esp
+  802562:	5b                   	pop    %ebx
+  802563:	5e                   	pop    %esi
+  802564:	5f                   	pop    %edi
+  802565:	5d                   	pop    %ebp
+  802566:	c3                   	ret
+
+00802567 <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  802567:	55                   	push   %ebp
+  802568:	89 e5                	mov    %esp,%ebp
+  80256a:	57                   	push   %edi
+  80256b:	56                   	push   %esi
+  80256c:	53                   	push   %ebx
+  80256d:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  802570:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802573:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  802575:	8b 55 08             	mov    0x8(%ebp),%edx
+  802578:	b8 26 00 00 00       	mov    $0x26,%eax
+  80257d:	55                   	push   %ebp
+  80257e:	56                   	push   %esi
+  80257f:	8b 0e                	mov    (%esi),%ecx
+  802581:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802584:	8b 7e 08             	mov    0x8(%esi),%edi
+  802587:	8b 6e 10             	mov    0x10(%esi),%ebp
+  80258a:	8b 76 0c             	mov    0xc(%esi),%esi
+  80258d:	cd 30                	int    $0x30
+  80258f:	87 34 24             	xchg   %esi,(%esp)
+  802592:	89 0e                	mov    %ecx,(%esi)
+  802594:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802597:	89 7e 08             	mov    %edi,0x8(%esi)
+  80259a:	89 6e 10             	mov    %ebp,0x10(%esi)
+  80259d:	8f 46 0c             	pop    0xc(%esi)
+  8025a0:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  8025a1:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  8025a5:	74 0f                	je     8025b6 <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  8025a7:	85 c0                	test   %eax,%eax
+  8025a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025ae:	0f 48 d1             	cmovs  %ecx,%edx
+  8025b1:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8025b4:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  8025b6:	5b                   	pop    %ebx
+  8025b7:	5e                   	pop    %esi
+  8025b8:	5f                   	pop    %edi
+  8025b9:	5d                   	pop    %ebp
+  8025ba:	c3                   	ret
+
+008025bb <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  8025bb:	55                   	push   %ebp
+  8025bc:	89 e5                	mov    %esp,%ebp
+  8025be:	57                   	push   %edi
+  8025bf:	56                   	push   %esi
+  8025c0:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8025c1:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8025c8:	78 2f                	js     8025f9 <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  8025ca:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8025d1:	74 72                	je     802645 <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  8025d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025db:	b8 27 00 00 00       	mov    $0x27,%eax
+  8025e0:	89 cb                	mov    %ecx,%ebx
+  8025e2:	89 cf                	mov    %ecx,%edi
+  8025e4:	89 ce                	mov    %ecx,%esi
+  8025e6:	55                   	push   %ebp
+  8025e7:	68 f0 25 80 00       	push   $0x8025f0
+  8025ec:	89 e5                	mov    %esp,%ebp
+  8025ee:	0f 34                	sysenter
+  8025f0:	83 c4 04             	add    $0x4,%esp
+  8025f3:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  8025f4:	5b                   	pop    %ebx
+  8025f5:	5e                   	pop    %esi
+  8025f6:	5f                   	pop    %edi
+  8025f7:	5d                   	pop    %ebp
+  8025f8:	c3                   	ret
+  8025f9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025fe:	0f a2                	cpuid
+		return 0;
+  802600:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802605:	f6 c6 08             	test   $0x8,%dh
+  802608:	74 15                	je     80261f <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80260a:	89 c2                	mov    %eax,%edx
+  80260c:	c1 ea 08             	shr    $0x8,%edx
+  80260f:	83 e2 0f             	and    $0xf,%edx
+  802612:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802617:	83 fa 06             	cmp    $0x6,%edx
+  80261a:	74 0e                	je     80262a <sys_sysring_setup+0x6f>
+  80261c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80261f:	0f b6 c9             	movzbl %cl,%ecx
+  802622:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802628:	eb a0                	jmp    8025ca <sys_sysring_setup+0xf>
+  80262a:	89 c2                	mov    %eax,%edx
+  80262c:	c1 ea 04             	shr    $0x4,%edx
+  80262f:	83 e2 0f             	and    $0xf,%edx
+  802632:	83 fa 02             	cmp    $0x2,%edx
+  802635:	77 e5                	ja     80261c <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  802637:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80263a:	83 f8 02             	cmp    $0x2,%eax
+  80263d:	0f 97 c1             	seta   %cl
+  802640:	0f b6 c9             	movzbl %cl,%ecx
+  802643:	eb d7                	jmp    80261c <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  802645:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80264a:	b8 27 00 00 00       	mov    $0x27,%eax
+  80264f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802652:	89 cb                	mov    %ecx,%ebx
+  802654:	89 cf                	mov    %ecx,%edi
+  802656:	89 ce                	mov    %ecx,%esi
+  802658:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  80265a:	eb 98                	jmp    8025f4 <sys_sysring_setup+0x39>
+
+0080265c <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  80265c:	55                   	push   %ebp
+  80265d:	89 e5                	mov    %esp,%ebp
+  80265f:	57                   	push   %edi
+  802660:	56                   	push   %esi
+  802661:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802662:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802669:	78 2e                	js     802699 <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  80266b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802672:	74 71                	je     8026e5 <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  802674:	ba 00 00 00 00       	mov    $0x0,%edx
+  802679:	b8 28 00 00 00       	mov    $0x28,%eax
+  80267e:	89 d1                	mov    %edx,%ecx
+  802680:	89 d3                	mov    %edx,%ebx
+  802682:	89 d7                	mov    %edx,%edi
+  802684:	89 d6                	mov    %edx,%esi
+  802686:	55                   	push   %ebp
+  802687:	68 90 26 80 00       	push   $0x802690
+  80268c:	89 e5                	mov    %esp,%ebp
+  80268e:	0f 34                	sysenter
+  802690:	83 c4 04             	add    $0x4,%esp
+  802693:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  802694:	5b                   	pop    %ebx
+  802695:	5e                   	pop    %esi
+  802696:	5f                   	pop    %edi
+  802697:	5d                   	pop    %ebp
+  802698:	c3                   	ret
+  802699:	b8 01 00 00 00       	mov    $0x1,%eax
+  80269e:	0f a2                	cpuid
+		return 0;
+  8026a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8026a5:	f6 c6 08             	test   $0x8,%dh
+  8026a8:	74 15                	je     8026bf <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8026aa:	89 c2                	mov    %eax,%edx
+  8026ac:	c1 ea 08             	shr    $0x8,%edx
+  8026af:	83 e2 0f             	and    $0xf,%edx
+  8026b2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8026b7:	83 fa 06             	cmp    $0x6,%edx
+  8026ba:	74 0e                	je     8026ca <sys_sysring_enter+0x6e>
+  8026bc:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8026bf:	0f b6 c9             	movzbl %cl,%ecx
+  8026c2:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8026c8:	eb a1                	jmp    80266b <sys_sysring_enter+0xf>
+  8026ca:	89 c2                	mov    %eax,%edx
+  8026cc:	c1 ea 04             	shr    $0x4,%edx
+  8026cf:	83 e2 0f             	and    $0xf,%edx
+  8026d2:	83 fa 02             	cmp    $0x2,%edx
+  8026d5:	77 e5                	ja     8026bc <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  8026d7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8026da:	83 f8 02             	cmp    $0x2,%eax
+  8026dd:	0f 97 c1             	seta   %cl
+  8026e0:	0f b6 c9             	movzbl %cl,%ecx
+  8026e3:	eb d7                	jmp    8026bc <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  8026e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026ea:	b8 28 00 00 00       	mov    $0x28,%eax
+  8026ef:	89 d1                	mov    %edx,%ecx
+  8026f1:	89 d3                	mov    %edx,%ebx
+  8026f3:	89 d7                	mov    %edx,%edi
+  8026f5:	89 d6                	mov    %edx,%esi
+  8026f7:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  8026f9:	eb 99                	jmp    802694 <sys_sysring_enter+0x38>
+
+008026fb <pgfault>:
+// The kernel normally resolves these faults itself (page_fault_cow in
+// kern/trap.c); we only get here if it ran out of memory doing so.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8026fb:	55                   	push   %ebp
+  8026fc:	89 e5                	mov    %esp,%ebp
+  8026fe:	83 ec 08             	sub    $0x8,%esp
+  802701:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  802704:	8b 02                	mov    (%edx),%eax
+	uint32_t err = utf->utf_err;
+  802706:	8b 52 04             	mov    0x4(%edx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  802709:	f6 c2 02             	test   $0x2,%dl
+  80270c:	74 40                	je     80274e <pgfault+0x53>
+  80270e:	89 c1                	mov    %eax,%ecx
+  802710:	c1 e9 16             	shr    $0x16,%ecx
+  802713:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  80271a:	f6 c1 01             	test   $0x1,%cl
+  80271d:	74 2f                	je     80274e <pgfault+0x53>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW))
+  80271f:	89 c1                	mov    %eax,%ecx
+  802721:	c1 e9 0c             	shr    $0xc,%ecx
+  802724:	8b 0c 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%ecx
+  80272b:	f6 c5 08             	test   $0x8,%ch
+  80272e:	74 1e                	je     80274e <pgfault+0x53>
+	// Replace the page with a private writable copy of itself.  The
+	// kernel allocates, copies and maps it in one system call, so no
+	// temporary mapping at PFTEMP is needed.
+
+	// LAB 4: Your code here.
+	addr = ROUNDDOWN(addr, PGSIZE);
+  802730:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r = sys_page_copy(0, addr, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  802735:	83 ec 0c             	sub    $0xc,%esp
+  802738:	6a 07                	push   $0x7
+  80273a:	50                   	push   %eax
+  80273b:	6a 00                	push   $0x0
+  80273d:	50                   	push   %eax
+  80273e:	6a 00                	push   $0x0
+  802740:	e8 85 eb ff ff       	call   8012ca <sys_page_copy>
+  802745:	83 c4 20             	add    $0x20,%esp
+  802748:	85 c0                	test   %eax,%eax
+  80274a:	78 18                	js     802764 <pgfault+0x69>
+		panic("pgfault: sys_page_copy: %e", r);
+}
+  80274c:	c9                   	leave
+  80274d:	c3                   	ret
+		panic("pgfault: va %08x err %x is not a copy-on-write write",
+  80274e:	83 ec 0c             	sub    $0xc,%esp
+  802751:	52                   	push   %edx
+  802752:	50                   	push   %eax
+  802753:	68 24 30 80 00       	push   $0x803024
+  802758:	6a 1c                	push   $0x1c
+  80275a:	68 59 30 80 00       	push   $0x803059
+  80275f:	e8 e1 d9 ff ff       	call   800145 <_panic>
+		panic("pgfault: sys_page_copy: %e", r);
+  802764:	50                   	push   %eax
+  802765:	68 64 30 80 00       	push   $0x803064
+  80276a:	6a 26                	push   $0x26
+  80276c:	68 59 30 80 00       	push   $0x803059
+  802771:	e8 cf d9 ff ff       	call   800145 <_panic>
+
+00802776 <ufork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+ufork(void)
+{
+  802776:	55                   	push   %ebp
+  802777:	89 e5                	mov    %esp,%ebp
+  802779:	57                   	push   %edi
+  80277a:	56                   	push   %esi
+  80277b:	53                   	push   %ebx
+  80277c:	81 ec 38 04 00 00    	sub    $0x438,%esp
+	struct page_range vec[PAGE_VEC_MAX], *last;
+	uintptr_t va;
+	size_t n;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  802782:	68 fb 26 80 00       	push   $0x8026fb
+  802787:	e8 71 02 00 00       	call   8029fd <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  80278c:	b8 07 00 00 00       	mov    $0x7,%eax
+  802791:	cd 30                	int    $0x30
+  802793:	89 85 d4 fb ff ff    	mov    %eax,-0x42c(%ebp)
+
+	envid = sys_exofork();
+	if (envid < 0)
+  802799:	83 c4 10             	add    $0x10,%esp
+  80279c:	85 c0                	test   %eax,%eax
+  80279e:	0f 88 f2 01 00 00    	js     802996 <ufork+0x220>
+		return 0;
+	}
+
+	// Copy every run of mapped pages below the exception stack, which
+	// must not be shared.
+	va = 0;
+  8027a4:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid == 0) {
+  8027a9:	74 0b                	je     8027b6 <ufork+0x40>
+  8027ab:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  8027b1:	e9 07 01 00 00       	jmp    8028bd <ufork+0x147>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8027b6:	e8 22 e8 ff ff       	call   800fdd <sys_getenvid>
+  8027bb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8027c0:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  8027c6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8027cb:	a3 0c 40 80 00       	mov    %eax,0x80400c
+		return 0;
+  8027d0:	e9 c1 01 00 00       	jmp    802996 <ufork+0x220>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+		n = r;
+		last = &vec[n - 1];
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  8027d5:	83 ea 01             	sub    $0x1,%edx
+  8027d8:	89 c1                	mov    %eax,%ecx
+  8027da:	c1 e1 04             	shl    $0x4,%ecx
+  8027dd:	89 94 0d ec fd ff ff 	mov    %edx,-0x214(%ebp,%ecx,1)
+			n--;
+  8027e4:	85 d2                	test   %edx,%edx
+  8027e6:	0f 44 f0             	cmove  %eax,%esi
+  8027e9:	e9 12 01 00 00       	jmp    802900 <ufork+0x18a>
+	for (i = 0; i < n; i++) {
+  8027ee:	83 c1 01             	add    $0x1,%ecx
+  8027f1:	83 c0 10             	add    $0x10,%eax
+  8027f4:	39 8d e4 fb ff ff    	cmp    %ecx,-0x41c(%ebp)
+  8027fa:	74 6a                	je     802866 <ufork+0xf0>
+		vec[i].pr_dstva = vec[i].pr_va;
+  8027fc:	89 c3                	mov    %eax,%ebx
+  8027fe:	8b 10                	mov    (%eax),%edx
+  802800:	89 50 0c             	mov    %edx,0xc(%eax)
+		if (vec[i].pr_perm & PTE_SHARE)
+  802803:	8b 50 08             	mov    0x8(%eax),%edx
+  802806:	f6 c6 04             	test   $0x4,%dh
+  802809:	75 e3                	jne    8027ee <ufork+0x78>
+		if (vec[i].pr_perm & (PTE_W | PTE_COW)) {
+  80280b:	f7 c2 02 08 00 00    	test   $0x802,%edx
+  802811:	74 db                	je     8027ee <ufork+0x78>
+			vec[i].pr_perm = (vec[i].pr_perm & ~PTE_W) | PTE_COW;
+  802813:	81 e2 fd f7 ff ff    	and    $0xfffff7fd,%edx
+  802819:	80 ce 08             	or     $0x8,%dh
+  80281c:	89 95 dc fb ff ff    	mov    %edx,-0x424(%ebp)
+  802822:	89 53 08             	mov    %edx,0x8(%ebx)
+			cow[ncow++] = vec[i];
+  802825:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  80282b:	c1 e6 04             	shl    $0x4,%esi
+  80282e:	89 f2                	mov    %esi,%edx
+  802830:	8d b4 35 e8 fb ff ff 	lea    -0x418(%ebp,%esi,1),%esi
+  802837:	8b 38                	mov    (%eax),%edi
+  802839:	89 bc 15 e8 fb ff ff 	mov    %edi,-0x418(%ebp,%edx,1)
+  802840:	8b 78 04             	mov    0x4(%eax),%edi
+  802843:	89 7e 04             	mov    %edi,0x4(%esi)
+  802846:	8b bd dc fb ff ff    	mov    -0x424(%ebp),%edi
+  80284c:	89 7e 08             	mov    %edi,0x8(%esi)
+  80284f:	8b 50 0c             	mov    0xc(%eax),%edx
+  802852:	89 56 0c             	mov    %edx,0xc(%esi)
+  802855:	8b b5 e0 fb ff ff    	mov    -0x420(%ebp),%esi
+  80285b:	8d 7e 01             	lea    0x1(%esi),%edi
+  80285e:	89 bd e0 fb ff ff    	mov    %edi,-0x420(%ebp)
+  802864:	eb 88                	jmp    8027ee <ufork+0x78>
+	if ((r = sys_page_map_vec(0, envid, vec, n, 0)) < 0)
+  802866:	8b b5 e4 fb ff ff    	mov    -0x41c(%ebp),%esi
+  80286c:	8b bd d8 fb ff ff    	mov    -0x428(%ebp),%edi
+  802872:	83 ec 0c             	sub    $0xc,%esp
+  802875:	6a 00                	push   $0x0
+  802877:	56                   	push   %esi
+  802878:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  80287e:	50                   	push   %eax
+  80287f:	ff b5 d4 fb ff ff    	push   -0x42c(%ebp)
+  802885:	6a 00                	push   $0x0
+  802887:	e8 80 f4 ff ff       	call   801d0c <sys_page_map_vec>
+  80288c:	83 c4 20             	add    $0x20,%esp
+  80288f:	85 c0                	test   %eax,%eax
+  802891:	0f 88 e5 00 00 00    	js     80297c <ufork+0x206>
+	return sys_page_map_vec(0, 0, cow, ncow, 0);
+  802897:	83 ec 0c             	sub    $0xc,%esp
+  80289a:	6a 00                	push   $0x0
+  80289c:	ff b5 e0 fb ff ff    	push   -0x420(%ebp)
+  8028a2:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  8028a8:	50                   	push   %eax
+  8028a9:	6a 00                	push   $0x0
+  8028ab:	6a 00                	push   $0x0
+  8028ad:	e8 5a f4 ff ff       	call   801d0c <sys_page_map_vec>
+		if ((r = duppages(envid, vec, n)) < 0)
+  8028b2:	83 c4 20             	add    $0x20,%esp
+  8028b5:	85 c0                	test   %eax,%eax
+  8028b7:	0f 88 e7 00 00 00    	js     8029a4 <ufork+0x22e>
+	while ((r = sys_vm_ranges(0, (void *) va, vec, PAGE_VEC_MAX)) > 0) {
+  8028bd:	6a 20                	push   $0x20
+  8028bf:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  8028c5:	50                   	push   %eax
+  8028c6:	57                   	push   %edi
+  8028c7:	6a 00                	push   $0x0
+  8028c9:	e8 82 f4 ff ff       	call   801d50 <sys_vm_ranges>
+  8028ce:	83 c4 10             	add    $0x10,%esp
+  8028d1:	85 c0                	test   %eax,%eax
+  8028d3:	7e 51                	jle    802926 <ufork+0x1b0>
+		n = r;
+  8028d5:	89 c6                	mov    %eax,%esi
+		last = &vec[n - 1];
+  8028d7:	83 e8 01             	sub    $0x1,%eax
+		va = (uintptr_t) last->pr_va + last->pr_npages * PGSIZE;
+  8028da:	89 c1                	mov    %eax,%ecx
+  8028dc:	c1 e1 04             	shl    $0x4,%ecx
+  8028df:	8b 94 0d ec fd ff ff 	mov    -0x214(%ebp,%ecx,1),%edx
+  8028e6:	89 d3                	mov    %edx,%ebx
+  8028e8:	c1 e3 0c             	shl    $0xc,%ebx
+  8028eb:	89 df                	mov    %ebx,%edi
+  8028ed:	03 bc 0d e8 fd ff ff 	add    -0x218(%ebp,%ecx,1),%edi
+		if (va == UXSTACKTOP && --last->pr_npages == 0)
+  8028f4:	81 ff 00 00 c0 ee    	cmp    $0xeec00000,%edi
+  8028fa:	0f 84 d5 fe ff ff    	je     8027d5 <ufork+0x5f>
+	for (i = 0; i < n; i++) {
+  802900:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+	size_t i, ncow = 0;
+  802906:	c7 85 e0 fb ff ff 00 	movl   $0x0,-0x420(%ebp)
+  80290d:	00 00 00 
+	for (i = 0; i < n; i++) {
+  802910:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802915:	89 bd d8 fb ff ff    	mov    %edi,-0x428(%ebp)
+  80291b:	89 b5 e4 fb ff ff    	mov    %esi,-0x41c(%ebp)
+  802921:	e9 ce fe ff ff       	jmp    8027f4 <ufork+0x7e>
+			goto fail;
+	}
+	if (r < 0)
+  802926:	89 c6                	mov    %eax,%esi
+  802928:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  80292e:	85 c0                	test   %eax,%eax
+  802930:	78 52                	js     802984 <ufork+0x20e>
+		goto fail;
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE),
+  802932:	83 ec 04             	sub    $0x4,%esp
+  802935:	6a 07                	push   $0x7
+  802937:	68 00 f0 bf ee       	push   $0xeebff000
+  80293c:	53                   	push   %ebx
+  80293d:	e8 3a e7 ff ff       	call   80107c <sys_page_alloc>
+  802942:	89 c6                	mov    %eax,%esi
+  802944:	83 c4 10             	add    $0x10,%esp
+  802947:	85 c0                	test   %eax,%eax
+  802949:	78 39                	js     802984 <ufork+0x20e>
+				PTE_P | PTE_U | PTE_W)) < 0
+	    || (r = sys_env_set_pgfault_upcall(envid,
+			thisenv->env_pgfault_upcall)) < 0
+  80294b:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  802950:	8b 40 74             	mov    0x74(%eax),%eax
+	    || (r = sys_env_set_pgfault_upcall(envid,
+  802953:	83 ec 08             	sub    $0x8,%esp
+  802956:	50                   	push   %eax
+  802957:	53                   	push   %ebx
+  802958:	e8 de ed ff ff       	call   80173b <sys_env_set_pgfault_upcall>
+  80295d:	89 c6                	mov    %eax,%esi
+  80295f:	83 c4 10             	add    $0x10,%esp
+  802962:	85 c0                	test   %eax,%eax
+  802964:	78 1e                	js     802984 <ufork+0x20e>
+	    || (r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  802966:	83 ec 08             	sub    $0x8,%esp
+  802969:	6a 02                	push   $0x2
+  80296b:	53                   	push   %ebx
+  80296c:	e8 bc ea ff ff       	call   80142d <sys_env_set_status>
+  802971:	89 c6                	mov    %eax,%esi
+  802973:	83 c4 10             	add    $0x10,%esp
+  802976:	85 c0                	test   %eax,%eax
+  802978:	79 1c                	jns    802996 <ufork+0x220>
+  80297a:	eb 08                	jmp    802984 <ufork+0x20e>
+  80297c:	89 c6                	mov    %eax,%esi
+  80297e:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+		goto fail;
+	return envid;
+
+fail:
+	sys_env_destroy(envid);
+  802984:	83 ec 0c             	sub    $0xc,%esp
+  802987:	53                   	push   %ebx
+  802988:	e8 8e e5 ff ff       	call   800f1b <sys_env_destroy>
+	return r;
+  80298d:	83 c4 10             	add    $0x10,%esp
+  802990:	89 b5 d4 fb ff ff    	mov    %esi,-0x42c(%ebp)
+}
+  802996:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+  80299c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80299f:	5b                   	pop    %ebx
+  8029a0:	5e                   	pop    %esi
+  8029a1:	5f                   	pop    %edi
+  8029a2:	5d                   	pop    %ebp
+  8029a3:	c3                   	ret
+  8029a4:	89 c6                	mov    %eax,%esi
+  8029a6:	8b 9d d0 fb ff ff    	mov    -0x430(%ebp),%ebx
+  8029ac:	eb d6                	jmp    802984 <ufork+0x20e>
+
+008029ae <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  8029ae:	55                   	push   %ebp
+  8029af:	89 e5                	mov    %esp,%ebp
+  8029b1:	53                   	push   %ebx
+  8029b2:	83 ec 04             	sub    $0x4,%esp
+	envid_t envid;
+
+	envid = sys_fork();
+  8029b5:	e8 90 f2 ff ff       	call   801c4a <sys_fork>
+  8029ba:	89 c3                	mov    %eax,%ebx
+	if (envid == 0)
+  8029bc:	85 c0                	test   %eax,%eax
+  8029be:	74 07                	je     8029c7 <fork+0x19>
+		thisenv = &envs[ENVX(sys_getenvid())];
+	return envid;
+}
+  8029c0:	89 d8                	mov    %ebx,%eax
+  8029c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029c5:	c9                   	leave
+  8029c6:	c3                   	ret
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8029c7:	e8 11 e6 ff ff       	call   800fdd <sys_getenvid>
+  8029cc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8029d1:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  8029d7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8029dc:	a3 0c 40 80 00       	mov    %eax,0x80400c
+	return envid;
+  8029e1:	eb dd                	jmp    8029c0 <fork+0x12>
+
+008029e3 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8029e3:	55                   	push   %ebp
+  8029e4:	89 e5                	mov    %esp,%ebp
+  8029e6:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  8029e9:	68 7f 30 80 00       	push   $0x80307f
+  8029ee:	68 a1 00 00 00       	push   $0xa1
+  8029f3:	68 59 30 80 00       	push   $0x803059
+  8029f8:	e8 48 d7 ff ff       	call   800145 <_panic>
+
+008029fd <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8029fd:	55                   	push   %ebp
+  8029fe:	89 e5                	mov    %esp,%ebp
+  802a00:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  802a03:	83 3d 10 40 80 00 00 	cmpl   $0x0,0x804010
+  802a0a:	74 0a                	je     802a16 <set_pgfault_handler+0x19>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  802a0c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a0f:	a3 10 40 80 00       	mov    %eax,0x804010
+}
+  802a14:	c9                   	leave
+  802a15:	c3                   	ret
+		if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE),
+  802a16:	83 ec 04             	sub    $0x4,%esp
+  802a19:	6a 07                	push   $0x7
+  802a1b:	68 00 f0 bf ee       	push   $0xeebff000
+  802a20:	6a 00                	push   $0x0
+  802a22:	e8 55 e6 ff ff       	call   80107c <sys_page_alloc>
+  802a27:	83 c4 10             	add    $0x10,%esp
+  802a2a:	85 c0                	test   %eax,%eax
+  802a2c:	78 28                	js     802a56 <set_pgfault_handler+0x59>
+		if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)) < 0)
+  802a2e:	83 ec 08             	sub    $0x8,%esp
+  802a31:	68 68 2a 80 00       	push   $0x802a68
+  802a36:	6a 00                	push   $0x0
+  802a38:	e8 fe ec ff ff       	call   80173b <sys_env_set_pgfault_upcall>
+  802a3d:	83 c4 10             	add    $0x10,%esp
+  802a40:	85 c0                	test   %eax,%eax
+  802a42:	79 c8                	jns    802a0c <set_pgfault_handler+0xf>
+			panic("set_pgfault_handler: sys_env_set_pgfault_upcall: %e", r);
+  802a44:	50                   	push   %eax
+  802a45:	68 c0 30 80 00       	push   $0x8030c0
+  802a4a:	6a 24                	push   $0x24
+  802a4c:	68 f4 30 80 00       	push   $0x8030f4
+  802a51:	e8 ef d6 ff ff       	call   800145 <_panic>
+			panic("set_pgfault_handler: sys_page_alloc: %e", r);
+  802a56:	50                   	push   %eax
+  802a57:	68 98 30 80 00       	push   $0x803098
+  802a5c:	6a 22                	push   $0x22
+  802a5e:	68 f4 30 80 00       	push   $0x8030f4
+  802a63:	e8 dd d6 ff ff       	call   800145 <_panic>
+
+00802a68 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802a68:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802a69:	a1 10 40 80 00       	mov    0x804010,%eax
+	call *%eax
+  802a6e:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802a70:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 0x28(%esp), %ebx		// trap-time eip
+  802a73:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl 0x30(%esp), %eax		// trap-time esp
+  802a77:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  802a7b:	83 e8 04             	sub    $0x4,%eax
+	movl %ebx, (%eax)
+  802a7e:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 0x30(%esp)
+  802a80:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp			// skip fault_va and err
+  802a84:	83 c4 08             	add    $0x8,%esp
+	popal
+  802a87:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp			// skip eip
+  802a88:	83 c4 04             	add    $0x4,%esp
+	popfl
+  802a8b:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802a8c:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802a8d:	c3                   	ret
+
+00802a8e <dm>:
+  802a8e:	55                   	push   %ebp
+  802a8f:	57                   	push   %edi
+  802a90:	56                   	push   %esi
+  802a91:	53                   	push   %ebx
+  802a92:	83 ec 24             	sub    $0x24,%esp
+  802a95:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802a99:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802a9d:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802aa1:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802aa5:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802aa9:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802aad:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802ab1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ab6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802abb:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802ac0:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802ac7:	00 
+  802ac8:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802acf:	00 
+  802ad0:	89 fb                	mov    %edi,%ebx
+  802ad2:	eb 08                	jmp    802adc <dm+0x4e>
+  802ad4:	83 e9 01             	sub    $0x1,%ecx
+  802ad7:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802ada:	74 68                	je     802b44 <dm+0xb6>
+  802adc:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802ae0:	01 c0                	add    %eax,%eax
+  802ae2:	89 c6                	mov    %eax,%esi
+  802ae4:	89 d7                	mov    %edx,%edi
+  802ae6:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802aea:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802aee:	0f ad d0             	shrd   %cl,%edx,%eax
+  802af1:	d3 ea                	shr    %cl,%edx
+  802af3:	f6 c1 20             	test   $0x20,%cl
+  802af6:	74 04                	je     802afc <dm+0x6e>
+  802af8:	89 d0                	mov    %edx,%eax
+  802afa:	31 d2                	xor    %edx,%edx
+  802afc:	83 e0 01             	and    $0x1,%eax
+  802aff:	89 04 24             	mov    %eax,(%esp)
+  802b02:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802b09:	00 
+  802b0a:	8b 04 24             	mov    (%esp),%eax
+  802b0d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802b11:	09 f0                	or     %esi,%eax
+  802b13:	09 fa                	or     %edi,%edx
+  802b15:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802b19:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802b1d:	39 f0                	cmp    %esi,%eax
+  802b1f:	89 d5                	mov    %edx,%ebp
+  802b21:	19 fd                	sbb    %edi,%ebp
+  802b23:	72 af                	jb     802ad4 <dm+0x46>
+  802b25:	29 f0                	sub    %esi,%eax
+  802b27:	19 fa                	sbb    %edi,%edx
+  802b29:	89 cf                	mov    %ecx,%edi
+  802b2b:	c1 ef 05             	shr    $0x5,%edi
+  802b2e:	83 e7 01             	and    $0x1,%edi
+  802b31:	89 fe                	mov    %edi,%esi
+  802b33:	83 f6 01             	xor    $0x1,%esi
+  802b36:	d3 e6                	shl    %cl,%esi
+  802b38:	d3 e7                	shl    %cl,%edi
+  802b3a:	09 74 24 18          	or     %esi,0x18(%esp)
+  802b3e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802b42:	eb 90                	jmp    802ad4 <dm+0x46>
+  802b44:	85 db                	test   %ebx,%ebx
+  802b46:	74 05                	je     802b4d <dm+0xbf>
+  802b48:	89 03                	mov    %eax,(%ebx)
+  802b4a:	89 53 04             	mov    %edx,0x4(%ebx)
+  802b4d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802b51:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802b55:	83 c4 24             	add    $0x24,%esp
+  802b58:	5b                   	pop    %ebx
+  802b59:	5e                   	pop    %esi
+  802b5a:	5f                   	pop    %edi
+  802b5b:	5d                   	pop    %ebp
+  802b5c:	c3                   	ret
+
+00802b5d <__udivdi3>:
+  802b5d:	83 ec 08             	sub    $0x8,%esp
+  802b60:	6a 00                	push   $0x0
+  802b62:	ff 74 24 1c          	push   0x1c(%esp)
+  802b66:	ff 74 24 1c          	push   0x1c(%esp)
+  802b6a:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802b6e:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802b72:	e8 17 ff ff ff       	call   802a8e <dm>
+  802b77:	83 c4 14             	add    $0x14,%esp
+  802b7a:	c3                   	ret
+
+00802b7b <__umoddi3>:
+  802b7b:	83 ec 18             	sub    $0x18,%esp
+  802b7e:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802b82:	50                   	push   %eax
+  802b83:	ff 74 24 2c          	push   0x2c(%esp)
+  802b87:	ff 74 24 2c          	push   0x2c(%esp)
+  802b8b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802b8f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802b93:	e8 f6 fe ff ff       	call   802a8e <dm>
+  802b98:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802b9c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802ba0:	83 c4 24             	add    $0x24,%esp
+  802ba3:	c3                   	ret
+
+00802ba4 <__divdi3>:
+  802ba4:	53                   	push   %ebx
+  802ba5:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802ba9:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802bad:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  802bb1:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  802bb5:	85 d2                	test   %edx,%edx
+  802bb7:	78 15                	js     802bce <__divdi3+0x2a>
+  802bb9:	85 db                	test   %ebx,%ebx
+  802bbb:	78 34                	js     802bf1 <__divdi3+0x4d>
+  802bbd:	83 ec 04             	sub    $0x4,%esp
+  802bc0:	6a 00                	push   $0x0
+  802bc2:	53                   	push   %ebx
+  802bc3:	51                   	push   %ecx
+  802bc4:	e8 c5 fe ff ff       	call   802a8e <dm>
+  802bc9:	83 c4 10             	add    $0x10,%esp
+  802bcc:	eb 21                	jmp    802bef <__divdi3+0x4b>
+  802bce:	f7 d8                	neg    %eax
+  802bd0:	83 d2 00             	adc    $0x0,%edx
+  802bd3:	f7 da                	neg    %edx
+  802bd5:	85 db                	test   %ebx,%ebx
+  802bd7:	78 30                	js     802c09 <__divdi3+0x65>
+  802bd9:	83 ec 04             	sub    $0x4,%esp
+  802bdc:	6a 00                	push   $0x0
+  802bde:	53                   	push   %ebx
+  802bdf:	51                   	push   %ecx
+  802be0:	e8 a9 fe ff ff       	call   802a8e <dm>
+  802be5:	83 c4 10             	add    $0x10,%esp
+  802be8:	f7 d8                	neg    %eax
+  802bea:	83 d2 00             	adc    $0x0,%edx
+  802bed:	f7 da                	neg    %edx
+  802bef:	5b                   	pop    %ebx
+  802bf0:	c3                   	ret
+  802bf1:	83 ec 04             	sub    $0x4,%esp
+  802bf4:	6a 00                	push   $0x0
+  802bf6:	f7 d9                	neg    %ecx
+  802bf8:	83 d3 00             	adc    $0x0,%ebx
+  802bfb:	f7 db                	neg    %ebx
+  802bfd:	53                   	push   %ebx
+  802bfe:	51                   	push   %ecx
+  802bff:	e8 8a fe ff ff       	call   802a8e <dm>
+  802c04:	83 c4 10             	add    $0x10,%esp
+  802c07:	eb df                	jmp    802be8 <__divdi3+0x44>
+  802c09:	83 ec 04             	sub    $0x4,%esp
+  802c0c:	6a 00                	push   $0x0
+  802c0e:	f7 d9                	neg    %ecx
+  802c10:	83 d3 00             	adc    $0x0,%ebx
+  802c13:	f7 db                	neg    %ebx
+  802c15:	53                   	push   %ebx
+  802c16:	51                   	push   %ecx
+  802c17:	e8 72 fe ff ff       	call   802a8e <dm>
+  802c1c:	83 c4 10             	add    $0x10,%esp
+  802c1f:	eb ce                	jmp    802bef <__divdi3+0x4b>
+
+00802c21 <__moddi3>:
+  802c21:	55                   	push   %ebp
+  802c22:	57                   	push   %edi
+  802c23:	56                   	push   %esi
+  802c24:	53                   	push   %ebx
+  802c25:	83 ec 18             	sub    $0x18,%esp
+  802c28:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802c2c:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802c30:	89 f1                	mov    %esi,%ecx
+  802c32:	f7 d9                	neg    %ecx
+  802c34:	89 da                	mov    %ebx,%edx
+  802c36:	83 d2 00             	adc    $0x0,%edx
+  802c39:	f7 da                	neg    %edx
+  802c3b:	0f 48 ce             	cmovs  %esi,%ecx
+  802c3e:	0f 48 d3             	cmovs  %ebx,%edx
+  802c41:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802c45:	50                   	push   %eax
+  802c46:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802c4a:	f7 de                	neg    %esi
+  802c4c:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802c50:	83 d0 00             	adc    $0x0,%eax
+  802c53:	f7 d8                	neg    %eax
+  802c55:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802c5a:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802c5f:	50                   	push   %eax
+  802c60:	56                   	push   %esi
+  802c61:	89 c8                	mov    %ecx,%eax
+  802c63:	e8 26 fe ff ff       	call   802a8e <dm>
+  802c68:	83 c4 10             	add    $0x10,%esp
+  802c6b:	85 db                	test   %ebx,%ebx
+  802c6d:	78 10                	js     802c7f <__moddi3+0x5e>
+  802c6f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802c73:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802c77:	83 c4 14             	add    $0x14,%esp
+  802c7a:	5b                   	pop    %ebx
+  802c7b:	5e                   	pop    %esi
+  802c7c:	5f                   	pop    %edi
+  802c7d:	5d                   	pop    %ebp
+  802c7e:	c3                   	ret
+  802c7f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802c83:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802c87:	f7 d8                	neg    %eax
+  802c89:	83 d2 00             	adc    $0x0,%edx
+  802c8c:	f7 da                	neg    %edx
+  802c8e:	eb e7                	jmp    802c77 <__moddi3+0x56>
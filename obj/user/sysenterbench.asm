@@ -0,0 +1,5247 @@
+
+obj/user/sysenterbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 f1 00 00 00       	call   800122 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+	return (read_tsc() - start) / NCALLS;
+}
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 0c             	sub    $0xc,%esp
+	syscall_sysenter = 0;
+  80003c:	c7 05 04 30 80 00 00 	movl   $0x0,0x803004
+  800043:	00 00 00 
+	sys_getenvid();
+  800046:	e8 4b 0f 00 00       	call   800f96 <sys_getenvid>
+
+static inline uint64_t
+read_tsc(void)
+{
+	uint64_t tsc;
+	asm volatile("rdtsc" : "=A" (tsc));
+  80004b:	0f 31                	rdtsc
+  80004d:	89 c6                	mov    %eax,%esi
+  80004f:	89 d7                	mov    %edx,%edi
+	for (i = 0; i < NCALLS; i++)
+  800051:	bb a1 86 01 00       	mov    $0x186a1,%ebx
+  800056:	eb 05                	jmp    80005d <umain+0x2a>
+		sys_getenvid();
+  800058:	e8 39 0f 00 00       	call   800f96 <sys_getenvid>
+	for (i = 0; i < NCALLS; i++)
+  80005d:	83 eb 01             	sub    $0x1,%ebx
+  800060:	75 f6                	jne    800058 <umain+0x25>
+  800062:	0f 31                	rdtsc
+	cprintf("int       %6llu cycles/call\n", measure());
+  800064:	83 ec 10             	sub    $0x10,%esp
+	return (read_tsc() - start) / NCALLS;
+  800067:	29 f0                	sub    %esi,%eax
+  800069:	19 fa                	sbb    %edi,%edx
+  80006b:	6a 00                	push   $0x0
+  80006d:	68 a0 86 01 00       	push   $0x186a0
+  800072:	52                   	push   %edx
+  800073:	50                   	push   %eax
+  800074:	e8 89 27 00 00       	call   802802 <__udivdi3>
+  800079:	83 c4 1c             	add    $0x1c,%esp
+	cprintf("int       %6llu cycles/call\n", measure());
+  80007c:	52                   	push   %edx
+  80007d:	50                   	push   %eax
+  80007e:	68 40 29 80 00       	push   $0x802940
+  800083:	e8 8a 01 00 00       	call   800212 <cprintf>
+	asm volatile("cpuid"
+  800088:	b8 01 00 00 00       	mov    $0x1,%eax
+  80008d:	0f a2                	cpuid
+cpuid_sysenter(void)
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80008f:	83 c4 10             	add    $0x10,%esp
+  800092:	f6 c6 08             	test   $0x8,%dh
+  800095:	74 48                	je     8000df <umain+0xac>
+		return 0;
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800097:	89 c2                	mov    %eax,%edx
+  800099:	c1 ea 08             	shr    $0x8,%edx
+  80009c:	83 e2 0f             	and    $0xf,%edx
+  80009f:	83 fa 06             	cmp    $0x6,%edx
+  8000a2:	74 26                	je     8000ca <umain+0x97>
+
+	if (!cpuid_sysenter()) {
+		cprintf("sysenter  not supported by this CPU\n");
+		return;
+	}
+	syscall_sysenter = 1;
+  8000a4:	c7 05 04 30 80 00 01 	movl   $0x1,0x803004
+  8000ab:	00 00 00 
+	sys_getenvid();
+  8000ae:	e8 e3 0e 00 00       	call   800f96 <sys_getenvid>
+	asm volatile("rdtsc" : "=A" (tsc));
+  8000b3:	0f 31                	rdtsc
+  8000b5:	89 c6                	mov    %eax,%esi
+  8000b7:	89 d7                	mov    %edx,%edi
+	for (i = 0; i < NCALLS; i++)
+  8000b9:	bb a1 86 01 00       	mov    $0x186a1,%ebx
+  8000be:	83 eb 01             	sub    $0x1,%ebx
+  8000c1:	74 2e                	je     8000f1 <umain+0xbe>
+		sys_getenvid();
+  8000c3:	e8 ce 0e 00 00       	call   800f96 <sys_getenvid>
+	for (i = 0; i < NCALLS; i++)
+  8000c8:	eb f4                	jmp    8000be <umain+0x8b>
+  8000ca:	89 c2                	mov    %eax,%edx
+  8000cc:	c1 ea 04             	shr    $0x4,%edx
+  8000cf:	83 e2 0f             	and    $0xf,%edx
+  8000d2:	83 fa 02             	cmp    $0x2,%edx
+  8000d5:	77 cd                	ja     8000a4 <umain+0x71>
+		 && (eax & 0xf) < 3);
+  8000d7:	83 e0 0f             	and    $0xf,%eax
+	if (!cpuid_sysenter()) {
+  8000da:	83 f8 02             	cmp    $0x2,%eax
+  8000dd:	77 c5                	ja     8000a4 <umain+0x71>
+		cprintf("sysenter  not supported by this CPU\n");
+  8000df:	83 ec 0c             	sub    $0xc,%esp
+  8000e2:	68 7c 29 80 00       	push   $0x80297c
+  8000e7:	e8 26 01 00 00       	call   800212 <cprintf>
+		return;
+  8000ec:	83 c4 10             	add    $0x10,%esp
+  8000ef:	eb 29                	jmp    80011a <umain+0xe7>
+  8000f1:	0f 31                	rdtsc
+	cprintf("sysenter  %6llu cycles/call\n", measure());
+  8000f3:	83 ec 10             	sub    $0x10,%esp
+	return (read_tsc() - start) / NCALLS;
+  8000f6:	29 f0                	sub    %esi,%eax
+  8000f8:	19 fa                	sbb    %edi,%edx
+  8000fa:	6a 00                	push   $0x0
+  8000fc:	68 a0 86 01 00       	push   $0x186a0
+  800101:	52                   	push   %edx
+  800102:	50                   	push   %eax
+  800103:	e8 fa 26 00 00       	call   802802 <__udivdi3>
+  800108:	83 c4 1c             	add    $0x1c,%esp
+	cprintf("sysenter  %6llu cycles/call\n", measure());
+  80010b:	52                   	push   %edx
+  80010c:	50                   	push   %eax
+  80010d:	68 5d 29 80 00       	push   $0x80295d
+  800112:	e8 fb 00 00 00       	call   800212 <cprintf>
+  800117:	83 c4 10             	add    $0x10,%esp
+}
+  80011a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80011d:	5b                   	pop    %ebx
+  80011e:	5e                   	pop    %esi
+  80011f:	5f                   	pop    %edi
+  800120:	5d                   	pop    %ebp
+  800121:	c3                   	ret
+
+00800122 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800122:	55                   	push   %ebp
+  800123:	89 e5                	mov    %esp,%ebp
+  800125:	56                   	push   %esi
+  800126:	53                   	push   %ebx
+  800127:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80012a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  80012d:	e8 64 0e 00 00       	call   800f96 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  800132:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800137:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  80013d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800142:	a3 08 30 80 00       	mov    %eax,0x803008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800147:	85 db                	test   %ebx,%ebx
+  800149:	7e 07                	jle    800152 <libmain+0x30>
+		binaryname = argv[0];
+  80014b:	8b 06                	mov    (%esi),%eax
+  80014d:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  800152:	83 ec 08             	sub    $0x8,%esp
+  800155:	56                   	push   %esi
+  800156:	53                   	push   %ebx
+  800157:	e8 d7 fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80015c:	e8 0a 00 00 00       	call   80016b <exit>
+}
+  800161:	83 c4 10             	add    $0x10,%esp
+  800164:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800167:	5b                   	pop    %ebx
+  800168:	5e                   	pop    %esi
+  800169:	5d                   	pop    %ebp
+  80016a:	c3                   	ret
+
+0080016b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80016b:	55                   	push   %ebp
+  80016c:	89 e5                	mov    %esp,%ebp
+  80016e:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  800171:	6a 00                	push   $0x0
+  800173:	e8 5c 0d 00 00       	call   800ed4 <sys_env_destroy>
+}
+  800178:	83 c4 10             	add    $0x10,%esp
+  80017b:	c9                   	leave
+  80017c:	c3                   	ret
+
+0080017d <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80017d:	55                   	push   %ebp
+  80017e:	89 e5                	mov    %esp,%ebp
+  800180:	53                   	push   %ebx
+  800181:	83 ec 04             	sub    $0x4,%esp
+  800184:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800187:	8b 13                	mov    (%ebx),%edx
+  800189:	8d 42 01             	lea    0x1(%edx),%eax
+  80018c:	89 03                	mov    %eax,(%ebx)
+  80018e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800191:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800195:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80019a:	74 09                	je     8001a5 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80019c:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001a3:	c9                   	leave
+  8001a4:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001a5:	83 ec 08             	sub    $0x8,%esp
+  8001a8:	68 ff 00 00 00       	push   $0xff
+  8001ad:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001b0:	50                   	push   %eax
+  8001b1:	e8 e2 0b 00 00       	call   800d98 <sys_cputs>
+		b->idx = 0;
+  8001b6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001bc:	83 c4 10             	add    $0x10,%esp
+  8001bf:	eb db                	jmp    80019c <putch+0x1f>
+
+008001c1 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001c1:	55                   	push   %ebp
+  8001c2:	89 e5                	mov    %esp,%ebp
+  8001c4:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001ca:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001d1:	00 00 00 
+	b.cnt = 0;
+  8001d4:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001db:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001de:	ff 75 0c             	push   0xc(%ebp)
+  8001e1:	ff 75 08             	push   0x8(%ebp)
+  8001e4:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001ea:	50                   	push   %eax
+  8001eb:	68 7d 01 80 00       	push   $0x80017d
+  8001f0:	e8 14 01 00 00       	call   800309 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001f5:	83 c4 08             	add    $0x8,%esp
+  8001f8:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001fe:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800204:	50                   	push   %eax
+  800205:	e8 8e 0b 00 00       	call   800d98 <sys_cputs>
+
+	return b.cnt;
+}
+  80020a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800210:	c9                   	leave
+  800211:	c3                   	ret
+
+00800212 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800212:	55                   	push   %ebp
+  800213:	89 e5                	mov    %esp,%ebp
+  800215:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800218:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80021b:	50                   	push   %eax
+  80021c:	ff 75 08             	push   0x8(%ebp)
+  80021f:	e8 9d ff ff ff       	call   8001c1 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800224:	c9                   	leave
+  800225:	c3                   	ret
+
+00800226 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800226:	55                   	push   %ebp
+  800227:	89 e5                	mov    %esp,%ebp
+  800229:	57                   	push   %edi
+  80022a:	56                   	push   %esi
+  80022b:	53                   	push   %ebx
+  80022c:	83 ec 1c             	sub    $0x1c,%esp
+  80022f:	89 c7                	mov    %eax,%edi
+  800231:	89 d6                	mov    %edx,%esi
+  800233:	8b 45 08             	mov    0x8(%ebp),%eax
+  800236:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800239:	89 d1                	mov    %edx,%ecx
+  80023b:	89 c2                	mov    %eax,%edx
+  80023d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800240:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800243:	8b 45 10             	mov    0x10(%ebp),%eax
+  800246:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800249:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80024c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800253:	39 c2                	cmp    %eax,%edx
+  800255:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800258:	72 3e                	jb     800298 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80025a:	83 ec 0c             	sub    $0xc,%esp
+  80025d:	ff 75 18             	push   0x18(%ebp)
+  800260:	83 eb 01             	sub    $0x1,%ebx
+  800263:	53                   	push   %ebx
+  800264:	50                   	push   %eax
+  800265:	83 ec 08             	sub    $0x8,%esp
+  800268:	ff 75 e4             	push   -0x1c(%ebp)
+  80026b:	ff 75 e0             	push   -0x20(%ebp)
+  80026e:	ff 75 dc             	push   -0x24(%ebp)
+  800271:	ff 75 d8             	push   -0x28(%ebp)
+  800274:	e8 89 25 00 00       	call   802802 <__udivdi3>
+  800279:	83 c4 18             	add    $0x18,%esp
+  80027c:	52                   	push   %edx
+  80027d:	50                   	push   %eax
+  80027e:	89 f2                	mov    %esi,%edx
+  800280:	89 f8                	mov    %edi,%eax
+  800282:	e8 9f ff ff ff       	call   800226 <printnum>
+  800287:	83 c4 20             	add    $0x20,%esp
+  80028a:	eb 13                	jmp    80029f <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80028c:	83 ec 08             	sub    $0x8,%esp
+  80028f:	56                   	push   %esi
+  800290:	ff 75 18             	push   0x18(%ebp)
+  800293:	ff d7                	call   *%edi
+  800295:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800298:	83 eb 01             	sub    $0x1,%ebx
+  80029b:	85 db                	test   %ebx,%ebx
+  80029d:	7f ed                	jg     80028c <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80029f:	83 ec 08             	sub    $0x8,%esp
+  8002a2:	56                   	push   %esi
+  8002a3:	83 ec 04             	sub    $0x4,%esp
+  8002a6:	ff 75 e4             	push   -0x1c(%ebp)
+  8002a9:	ff 75 e0             	push   -0x20(%ebp)
+  8002ac:	ff 75 dc             	push   -0x24(%ebp)
+  8002af:	ff 75 d8             	push   -0x28(%ebp)
+  8002b2:	e8 69 25 00 00       	call   802820 <__umoddi3>
+  8002b7:	83 c4 14             	add    $0x14,%esp
+  8002ba:	0f be 80 ab 29 80 00 	movsbl 0x8029ab(%eax),%eax
+  8002c1:	50                   	push   %eax
+  8002c2:	ff d7                	call   *%edi
+}
+  8002c4:	83 c4 10             	add    $0x10,%esp
+  8002c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ca:	5b                   	pop    %ebx
+  8002cb:	5e                   	pop    %esi
+  8002cc:	5f                   	pop    %edi
+  8002cd:	5d                   	pop    %ebp
+  8002ce:	c3                   	ret
+
+008002cf <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002cf:	55                   	push   %ebp
+  8002d0:	89 e5                	mov    %esp,%ebp
+  8002d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002d5:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002d9:	8b 10                	mov    (%eax),%edx
+  8002db:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002de:	73 0a                	jae    8002ea <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002e0:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002e3:	89 08                	mov    %ecx,(%eax)
+  8002e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002e8:	88 02                	mov    %al,(%edx)
+}
+  8002ea:	5d                   	pop    %ebp
+  8002eb:	c3                   	ret
+
+008002ec <printfmt>:
+{
+  8002ec:	55                   	push   %ebp
+  8002ed:	89 e5                	mov    %esp,%ebp
+  8002ef:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002f2:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002f5:	50                   	push   %eax
+  8002f6:	ff 75 10             	push   0x10(%ebp)
+  8002f9:	ff 75 0c             	push   0xc(%ebp)
+  8002fc:	ff 75 08             	push   0x8(%ebp)
+  8002ff:	e8 05 00 00 00       	call   800309 <vprintfmt>
+}
+  800304:	83 c4 10             	add    $0x10,%esp
+  800307:	c9                   	leave
+  800308:	c3                   	ret
+
+00800309 <vprintfmt>:
+{
+  800309:	55                   	push   %ebp
+  80030a:	89 e5                	mov    %esp,%ebp
+  80030c:	57                   	push   %edi
+  80030d:	56                   	push   %esi
+  80030e:	53                   	push   %ebx
+  80030f:	83 ec 2c             	sub    $0x2c,%esp
+  800312:	8b 75 08             	mov    0x8(%ebp),%esi
+  800315:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800318:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80031b:	eb 0a                	jmp    800327 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80031d:	83 ec 08             	sub    $0x8,%esp
+  800320:	53                   	push   %ebx
+  800321:	50                   	push   %eax
+  800322:	ff d6                	call   *%esi
+  800324:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800327:	83 c7 01             	add    $0x1,%edi
+  80032a:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80032e:	83 f8 25             	cmp    $0x25,%eax
+  800331:	74 0c                	je     80033f <vprintfmt+0x36>
+			if (ch == '\0')
+  800333:	85 c0                	test   %eax,%eax
+  800335:	75 e6                	jne    80031d <vprintfmt+0x14>
+}
+  800337:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80033a:	5b                   	pop    %ebx
+  80033b:	5e                   	pop    %esi
+  80033c:	5f                   	pop    %edi
+  80033d:	5d                   	pop    %ebp
+  80033e:	c3                   	ret
+		padc = ' ';
+  80033f:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800343:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80034a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800351:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800358:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80035d:	8d 47 01             	lea    0x1(%edi),%eax
+  800360:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800363:	0f b6 17             	movzbl (%edi),%edx
+  800366:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800369:	3c 55                	cmp    $0x55,%al
+  80036b:	0f 87 cf 03 00 00    	ja     800740 <vprintfmt+0x437>
+  800371:	0f b6 c0             	movzbl %al,%eax
+  800374:	ff 24 85 a0 2a 80 00 	jmp    *0x802aa0(,%eax,4)
+  80037b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80037e:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800382:	eb d9                	jmp    80035d <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800384:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800387:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80038b:	eb d0                	jmp    80035d <vprintfmt+0x54>
+  80038d:	0f b6 d2             	movzbl %dl,%edx
+  800390:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800393:	b8 00 00 00 00       	mov    $0x0,%eax
+  800398:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80039b:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80039e:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003a2:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003a5:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003a8:	83 f9 09             	cmp    $0x9,%ecx
+  8003ab:	77 55                	ja     800402 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8003ad:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003b0:	eb e9                	jmp    80039b <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8003b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b5:	8b 00                	mov    (%eax),%eax
+  8003b7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003bd:	8d 40 04             	lea    0x4(%eax),%eax
+  8003c0:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003c3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003c6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003ca:	79 91                	jns    80035d <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003cc:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003cf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003d2:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003d9:	eb 82                	jmp    80035d <vprintfmt+0x54>
+			if (width < 0)
+  8003db:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003de:	85 d2                	test   %edx,%edx
+  8003e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e5:	0f 49 c2             	cmovns %edx,%eax
+  8003e8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003eb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003ee:	e9 6a ff ff ff       	jmp    80035d <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003f3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003f6:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003fd:	e9 5b ff ff ff       	jmp    80035d <vprintfmt+0x54>
+  800402:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800405:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800408:	eb bc                	jmp    8003c6 <vprintfmt+0xbd>
+			lflag++;
+  80040a:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80040d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800410:	e9 48 ff ff ff       	jmp    80035d <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800415:	8b 45 14             	mov    0x14(%ebp),%eax
+  800418:	8d 78 04             	lea    0x4(%eax),%edi
+  80041b:	83 ec 08             	sub    $0x8,%esp
+  80041e:	53                   	push   %ebx
+  80041f:	ff 30                	push   (%eax)
+  800421:	ff d6                	call   *%esi
+			break;
+  800423:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800426:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800429:	e9 b1 02 00 00       	jmp    8006df <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  80042e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800431:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800434:	8b 10                	mov    (%eax),%edx
+  800436:	89 d0                	mov    %edx,%eax
+  800438:	f7 d8                	neg    %eax
+  80043a:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80043d:	83 f8 0d             	cmp    $0xd,%eax
+  800440:	7f 23                	jg     800465 <vprintfmt+0x15c>
+  800442:	8b 14 85 00 2c 80 00 	mov    0x802c00(,%eax,4),%edx
+  800449:	85 d2                	test   %edx,%edx
+  80044b:	74 18                	je     800465 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80044d:	52                   	push   %edx
+  80044e:	68 cc 29 80 00       	push   $0x8029cc
+  800453:	53                   	push   %ebx
+  800454:	56                   	push   %esi
+  800455:	e8 92 fe ff ff       	call   8002ec <printfmt>
+  80045a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80045d:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800460:	e9 7a 02 00 00       	jmp    8006df <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800465:	50                   	push   %eax
+  800466:	68 c3 29 80 00       	push   $0x8029c3
+  80046b:	53                   	push   %ebx
+  80046c:	56                   	push   %esi
+  80046d:	e8 7a fe ff ff       	call   8002ec <printfmt>
+  800472:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800475:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800478:	e9 62 02 00 00       	jmp    8006df <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80047d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800480:	83 c0 04             	add    $0x4,%eax
+  800483:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800486:	8b 45 14             	mov    0x14(%ebp),%eax
+  800489:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80048b:	85 c9                	test   %ecx,%ecx
+  80048d:	b8 bc 29 80 00       	mov    $0x8029bc,%eax
+  800492:	0f 45 c1             	cmovne %ecx,%eax
+  800495:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800498:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80049c:	7e 06                	jle    8004a4 <vprintfmt+0x19b>
+  80049e:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004a2:	75 0b                	jne    8004af <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004a4:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004a7:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004aa:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004ad:	eb 5c                	jmp    80050b <vprintfmt+0x202>
+  8004af:	83 ec 08             	sub    $0x8,%esp
+  8004b2:	ff 75 d0             	push   -0x30(%ebp)
+  8004b5:	ff 75 cc             	push   -0x34(%ebp)
+  8004b8:	e8 20 03 00 00       	call   8007dd <strnlen>
+  8004bd:	89 c2                	mov    %eax,%edx
+  8004bf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004c2:	29 d0                	sub    %edx,%eax
+  8004c4:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004c7:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004cb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004ce:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004d1:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004d3:	eb 0e                	jmp    8004e3 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004d5:	83 ec 08             	sub    $0x8,%esp
+  8004d8:	53                   	push   %ebx
+  8004d9:	57                   	push   %edi
+  8004da:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004dd:	83 ee 01             	sub    $0x1,%esi
+  8004e0:	83 c4 10             	add    $0x10,%esp
+  8004e3:	85 f6                	test   %esi,%esi
+  8004e5:	7f ee                	jg     8004d5 <vprintfmt+0x1cc>
+  8004e7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004ea:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004ed:	85 c0                	test   %eax,%eax
+  8004ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004f4:	0f 49 d0             	cmovns %eax,%edx
+  8004f7:	29 d0                	sub    %edx,%eax
+  8004f9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004fc:	eb a6                	jmp    8004a4 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004fe:	83 ec 08             	sub    $0x8,%esp
+  800501:	53                   	push   %ebx
+  800502:	52                   	push   %edx
+  800503:	ff 55 08             	call   *0x8(%ebp)
+  800506:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800509:	89 f1                	mov    %esi,%ecx
+  80050b:	8d 71 01             	lea    0x1(%ecx),%esi
+  80050e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800512:	0f be d0             	movsbl %al,%edx
+  800515:	85 d2                	test   %edx,%edx
+  800517:	74 28                	je     800541 <vprintfmt+0x238>
+  800519:	85 ff                	test   %edi,%edi
+  80051b:	78 05                	js     800522 <vprintfmt+0x219>
+  80051d:	83 ef 01             	sub    $0x1,%edi
+  800520:	78 30                	js     800552 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800522:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800526:	74 d6                	je     8004fe <vprintfmt+0x1f5>
+  800528:	0f be c0             	movsbl %al,%eax
+  80052b:	83 e8 20             	sub    $0x20,%eax
+  80052e:	83 f8 5e             	cmp    $0x5e,%eax
+  800531:	76 cb                	jbe    8004fe <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800533:	83 ec 08             	sub    $0x8,%esp
+  800536:	53                   	push   %ebx
+  800537:	6a 3f                	push   $0x3f
+  800539:	ff 55 08             	call   *0x8(%ebp)
+  80053c:	83 c4 10             	add    $0x10,%esp
+  80053f:	eb c8                	jmp    800509 <vprintfmt+0x200>
+  800541:	8b 75 08             	mov    0x8(%ebp),%esi
+  800544:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800547:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80054a:	01 d0                	add    %edx,%eax
+  80054c:	29 c8                	sub    %ecx,%eax
+  80054e:	89 c7                	mov    %eax,%edi
+  800550:	eb 13                	jmp    800565 <vprintfmt+0x25c>
+  800552:	8b 75 08             	mov    0x8(%ebp),%esi
+  800555:	eb ed                	jmp    800544 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800557:	83 ec 08             	sub    $0x8,%esp
+  80055a:	53                   	push   %ebx
+  80055b:	6a 20                	push   $0x20
+  80055d:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80055f:	83 ef 01             	sub    $0x1,%edi
+  800562:	83 c4 10             	add    $0x10,%esp
+  800565:	85 ff                	test   %edi,%edi
+  800567:	7f ee                	jg     800557 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800569:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80056c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80056f:	e9 6b 01 00 00       	jmp    8006df <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800574:	83 f9 01             	cmp    $0x1,%ecx
+  800577:	7f 1f                	jg     800598 <vprintfmt+0x28f>
+	else if (lflag)
+  800579:	85 c9                	test   %ecx,%ecx
+  80057b:	74 67                	je     8005e4 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80057d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800580:	8b 00                	mov    (%eax),%eax
+  800582:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800585:	89 c1                	mov    %eax,%ecx
+  800587:	c1 f9 1f             	sar    $0x1f,%ecx
+  80058a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80058d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800590:	8d 40 04             	lea    0x4(%eax),%eax
+  800593:	89 45 14             	mov    %eax,0x14(%ebp)
+  800596:	eb 17                	jmp    8005af <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800598:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059b:	8b 50 04             	mov    0x4(%eax),%edx
+  80059e:	8b 00                	mov    (%eax),%eax
+  8005a0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005a3:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a9:	8d 40 08             	lea    0x8(%eax),%eax
+  8005ac:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005af:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005b2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005b5:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005ba:	85 c9                	test   %ecx,%ecx
+  8005bc:	0f 89 03 01 00 00    	jns    8006c5 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8005c2:	83 ec 08             	sub    $0x8,%esp
+  8005c5:	53                   	push   %ebx
+  8005c6:	6a 2d                	push   $0x2d
+  8005c8:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005ca:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005cd:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005d0:	f7 da                	neg    %edx
+  8005d2:	83 d1 00             	adc    $0x0,%ecx
+  8005d5:	f7 d9                	neg    %ecx
+  8005d7:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005da:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005df:	e9 e1 00 00 00       	jmp    8006c5 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8005e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e7:	8b 00                	mov    (%eax),%eax
+  8005e9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005ec:	89 c1                	mov    %eax,%ecx
+  8005ee:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005f1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f7:	8d 40 04             	lea    0x4(%eax),%eax
+  8005fa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005fd:	eb b0                	jmp    8005af <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8005ff:	83 f9 01             	cmp    $0x1,%ecx
+  800602:	7f 1e                	jg     800622 <vprintfmt+0x319>
+	else if (lflag)
+  800604:	85 c9                	test   %ecx,%ecx
+  800606:	74 32                	je     80063a <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800608:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060b:	8b 10                	mov    (%eax),%edx
+  80060d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800612:	8d 40 04             	lea    0x4(%eax),%eax
+  800615:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800618:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80061d:	e9 a3 00 00 00       	jmp    8006c5 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800622:	8b 45 14             	mov    0x14(%ebp),%eax
+  800625:	8b 10                	mov    (%eax),%edx
+  800627:	8b 48 04             	mov    0x4(%eax),%ecx
+  80062a:	8d 40 08             	lea    0x8(%eax),%eax
+  80062d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800630:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800635:	e9 8b 00 00 00       	jmp    8006c5 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80063a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063d:	8b 10                	mov    (%eax),%edx
+  80063f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800644:	8d 40 04             	lea    0x4(%eax),%eax
+  800647:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80064a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80064f:	eb 74                	jmp    8006c5 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800651:	83 f9 01             	cmp    $0x1,%ecx
+  800654:	7f 1b                	jg     800671 <vprintfmt+0x368>
+	else if (lflag)
+  800656:	85 c9                	test   %ecx,%ecx
+  800658:	74 2c                	je     800686 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  80065a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065d:	8b 10                	mov    (%eax),%edx
+  80065f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800664:	8d 40 04             	lea    0x4(%eax),%eax
+  800667:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80066a:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80066f:	eb 54                	jmp    8006c5 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800671:	8b 45 14             	mov    0x14(%ebp),%eax
+  800674:	8b 10                	mov    (%eax),%edx
+  800676:	8b 48 04             	mov    0x4(%eax),%ecx
+  800679:	8d 40 08             	lea    0x8(%eax),%eax
+  80067c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80067f:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800684:	eb 3f                	jmp    8006c5 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800686:	8b 45 14             	mov    0x14(%ebp),%eax
+  800689:	8b 10                	mov    (%eax),%edx
+  80068b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800690:	8d 40 04             	lea    0x4(%eax),%eax
+  800693:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800696:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80069b:	eb 28                	jmp    8006c5 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  80069d:	83 ec 08             	sub    $0x8,%esp
+  8006a0:	53                   	push   %ebx
+  8006a1:	6a 30                	push   $0x30
+  8006a3:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006a5:	83 c4 08             	add    $0x8,%esp
+  8006a8:	53                   	push   %ebx
+  8006a9:	6a 78                	push   $0x78
+  8006ab:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b0:	8b 10                	mov    (%eax),%edx
+  8006b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006b7:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006ba:	8d 40 04             	lea    0x4(%eax),%eax
+  8006bd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006c0:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006c5:	83 ec 0c             	sub    $0xc,%esp
+  8006c8:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006cc:	50                   	push   %eax
+  8006cd:	ff 75 e0             	push   -0x20(%ebp)
+  8006d0:	57                   	push   %edi
+  8006d1:	51                   	push   %ecx
+  8006d2:	52                   	push   %edx
+  8006d3:	89 da                	mov    %ebx,%edx
+  8006d5:	89 f0                	mov    %esi,%eax
+  8006d7:	e8 4a fb ff ff       	call   800226 <printnum>
+			break;
+  8006dc:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006df:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006e2:	e9 40 fc ff ff       	jmp    800327 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006e7:	83 f9 01             	cmp    $0x1,%ecx
+  8006ea:	7f 1b                	jg     800707 <vprintfmt+0x3fe>
+	else if (lflag)
+  8006ec:	85 c9                	test   %ecx,%ecx
+  8006ee:	74 2c                	je     80071c <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8006f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f3:	8b 10                	mov    (%eax),%edx
+  8006f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006fa:	8d 40 04             	lea    0x4(%eax),%eax
+  8006fd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800700:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800705:	eb be                	jmp    8006c5 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800707:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070a:	8b 10                	mov    (%eax),%edx
+  80070c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80070f:	8d 40 08             	lea    0x8(%eax),%eax
+  800712:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800715:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80071a:	eb a9                	jmp    8006c5 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80071c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071f:	8b 10                	mov    (%eax),%edx
+  800721:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800726:	8d 40 04             	lea    0x4(%eax),%eax
+  800729:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80072c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800731:	eb 92                	jmp    8006c5 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800733:	83 ec 08             	sub    $0x8,%esp
+  800736:	53                   	push   %ebx
+  800737:	6a 25                	push   $0x25
+  800739:	ff d6                	call   *%esi
+			break;
+  80073b:	83 c4 10             	add    $0x10,%esp
+  80073e:	eb 9f                	jmp    8006df <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800740:	83 ec 08             	sub    $0x8,%esp
+  800743:	53                   	push   %ebx
+  800744:	6a 25                	push   $0x25
+  800746:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800748:	83 c4 10             	add    $0x10,%esp
+  80074b:	89 f8                	mov    %edi,%eax
+  80074d:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800751:	74 05                	je     800758 <vprintfmt+0x44f>
+  800753:	83 e8 01             	sub    $0x1,%eax
+  800756:	eb f5                	jmp    80074d <vprintfmt+0x444>
+  800758:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80075b:	eb 82                	jmp    8006df <vprintfmt+0x3d6>
+
+0080075d <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80075d:	55                   	push   %ebp
+  80075e:	89 e5                	mov    %esp,%ebp
+  800760:	83 ec 18             	sub    $0x18,%esp
+  800763:	8b 45 08             	mov    0x8(%ebp),%eax
+  800766:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800769:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80076c:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800770:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800773:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80077a:	85 c0                	test   %eax,%eax
+  80077c:	74 26                	je     8007a4 <vsnprintf+0x47>
+  80077e:	85 d2                	test   %edx,%edx
+  800780:	7e 22                	jle    8007a4 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800782:	ff 75 14             	push   0x14(%ebp)
+  800785:	ff 75 10             	push   0x10(%ebp)
+  800788:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80078b:	50                   	push   %eax
+  80078c:	68 cf 02 80 00       	push   $0x8002cf
+  800791:	e8 73 fb ff ff       	call   800309 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800796:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800799:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80079c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80079f:	83 c4 10             	add    $0x10,%esp
+}
+  8007a2:	c9                   	leave
+  8007a3:	c3                   	ret
+		return -E_INVAL;
+  8007a4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007a9:	eb f7                	jmp    8007a2 <vsnprintf+0x45>
+
+008007ab <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007ab:	55                   	push   %ebp
+  8007ac:	89 e5                	mov    %esp,%ebp
+  8007ae:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007b1:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007b4:	50                   	push   %eax
+  8007b5:	ff 75 10             	push   0x10(%ebp)
+  8007b8:	ff 75 0c             	push   0xc(%ebp)
+  8007bb:	ff 75 08             	push   0x8(%ebp)
+  8007be:	e8 9a ff ff ff       	call   80075d <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007c3:	c9                   	leave
+  8007c4:	c3                   	ret
+
+008007c5 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007c5:	55                   	push   %ebp
+  8007c6:	89 e5                	mov    %esp,%ebp
+  8007c8:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d0:	eb 03                	jmp    8007d5 <strlen+0x10>
+		n++;
+  8007d2:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007d5:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007d9:	75 f7                	jne    8007d2 <strlen+0xd>
+	return n;
+}
+  8007db:	5d                   	pop    %ebp
+  8007dc:	c3                   	ret
+
+008007dd <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007dd:	55                   	push   %ebp
+  8007de:	89 e5                	mov    %esp,%ebp
+  8007e0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007e3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007eb:	eb 03                	jmp    8007f0 <strnlen+0x13>
+		n++;
+  8007ed:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007f0:	39 d0                	cmp    %edx,%eax
+  8007f2:	74 08                	je     8007fc <strnlen+0x1f>
+  8007f4:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007f8:	75 f3                	jne    8007ed <strnlen+0x10>
+  8007fa:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007fc:	89 d0                	mov    %edx,%eax
+  8007fe:	5d                   	pop    %ebp
+  8007ff:	c3                   	ret
+
+00800800 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800800:	55                   	push   %ebp
+  800801:	89 e5                	mov    %esp,%ebp
+  800803:	53                   	push   %ebx
+  800804:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800807:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80080a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80080f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800813:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800816:	83 c0 01             	add    $0x1,%eax
+  800819:	84 d2                	test   %dl,%dl
+  80081b:	75 f2                	jne    80080f <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80081d:	89 c8                	mov    %ecx,%eax
+  80081f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800822:	c9                   	leave
+  800823:	c3                   	ret
+
+00800824 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800824:	55                   	push   %ebp
+  800825:	89 e5                	mov    %esp,%ebp
+  800827:	53                   	push   %ebx
+  800828:	83 ec 10             	sub    $0x10,%esp
+  80082b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80082e:	53                   	push   %ebx
+  80082f:	e8 91 ff ff ff       	call   8007c5 <strlen>
+  800834:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800837:	ff 75 0c             	push   0xc(%ebp)
+  80083a:	01 d8                	add    %ebx,%eax
+  80083c:	50                   	push   %eax
+  80083d:	e8 be ff ff ff       	call   800800 <strcpy>
+	return dst;
+}
+  800842:	89 d8                	mov    %ebx,%eax
+  800844:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800847:	c9                   	leave
+  800848:	c3                   	ret
+
+00800849 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800849:	55                   	push   %ebp
+  80084a:	89 e5                	mov    %esp,%ebp
+  80084c:	56                   	push   %esi
+  80084d:	53                   	push   %ebx
+  80084e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800851:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800854:	89 f3                	mov    %esi,%ebx
+  800856:	03 5d 10             	add    0x10(%ebp),%ebx
+  800859:	89 f0                	mov    %esi,%eax
+  80085b:	eb 0f                	jmp    80086c <strncpy+0x23>
+		*dst++ = *src;
+  80085d:	83 c0 01             	add    $0x1,%eax
+  800860:	0f b6 0a             	movzbl (%edx),%ecx
+  800863:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800866:	80 f9 01             	cmp    $0x1,%cl
+  800869:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80086c:	39 d8                	cmp    %ebx,%eax
+  80086e:	75 ed                	jne    80085d <strncpy+0x14>
+	}
+	return ret;
+}
+  800870:	89 f0                	mov    %esi,%eax
+  800872:	5b                   	pop    %ebx
+  800873:	5e                   	pop    %esi
+  800874:	5d                   	pop    %ebp
+  800875:	c3                   	ret
+
+00800876 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800876:	55                   	push   %ebp
+  800877:	89 e5                	mov    %esp,%ebp
+  800879:	56                   	push   %esi
+  80087a:	53                   	push   %ebx
+  80087b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80087e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800881:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800884:	89 f0                	mov    %esi,%eax
+  800886:	85 d2                	test   %edx,%edx
+  800888:	74 21                	je     8008ab <strlcpy+0x35>
+  80088a:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80088e:	89 f2                	mov    %esi,%edx
+  800890:	eb 09                	jmp    80089b <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800892:	83 c1 01             	add    $0x1,%ecx
+  800895:	83 c2 01             	add    $0x1,%edx
+  800898:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80089b:	39 c2                	cmp    %eax,%edx
+  80089d:	74 09                	je     8008a8 <strlcpy+0x32>
+  80089f:	0f b6 19             	movzbl (%ecx),%ebx
+  8008a2:	84 db                	test   %bl,%bl
+  8008a4:	75 ec                	jne    800892 <strlcpy+0x1c>
+  8008a6:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008a8:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008ab:	29 f0                	sub    %esi,%eax
+}
+  8008ad:	5b                   	pop    %ebx
+  8008ae:	5e                   	pop    %esi
+  8008af:	5d                   	pop    %ebp
+  8008b0:	c3                   	ret
+
+008008b1 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008b1:	55                   	push   %ebp
+  8008b2:	89 e5                	mov    %esp,%ebp
+  8008b4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008b7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008ba:	eb 06                	jmp    8008c2 <strcmp+0x11>
+		p++, q++;
+  8008bc:	83 c1 01             	add    $0x1,%ecx
+  8008bf:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008c2:	0f b6 01             	movzbl (%ecx),%eax
+  8008c5:	84 c0                	test   %al,%al
+  8008c7:	74 04                	je     8008cd <strcmp+0x1c>
+  8008c9:	3a 02                	cmp    (%edx),%al
+  8008cb:	74 ef                	je     8008bc <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008cd:	0f b6 c0             	movzbl %al,%eax
+  8008d0:	0f b6 12             	movzbl (%edx),%edx
+  8008d3:	29 d0                	sub    %edx,%eax
+}
+  8008d5:	5d                   	pop    %ebp
+  8008d6:	c3                   	ret
+
+008008d7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008d7:	55                   	push   %ebp
+  8008d8:	89 e5                	mov    %esp,%ebp
+  8008da:	53                   	push   %ebx
+  8008db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008e1:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008e4:	eb 09                	jmp    8008ef <strncmp+0x18>
+		n--, p++, q++;
+  8008e6:	83 ea 01             	sub    $0x1,%edx
+  8008e9:	83 c0 01             	add    $0x1,%eax
+  8008ec:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008ef:	85 d2                	test   %edx,%edx
+  8008f1:	74 18                	je     80090b <strncmp+0x34>
+  8008f3:	0f b6 18             	movzbl (%eax),%ebx
+  8008f6:	84 db                	test   %bl,%bl
+  8008f8:	74 04                	je     8008fe <strncmp+0x27>
+  8008fa:	3a 19                	cmp    (%ecx),%bl
+  8008fc:	74 e8                	je     8008e6 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008fe:	0f b6 00             	movzbl (%eax),%eax
+  800901:	0f b6 11             	movzbl (%ecx),%edx
+  800904:	29 d0                	sub    %edx,%eax
+}
+  800906:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800909:	c9                   	leave
+  80090a:	c3                   	ret
+		return 0;
+  80090b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800910:	eb f4                	jmp    800906 <strncmp+0x2f>
+
+00800912 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800912:	55                   	push   %ebp
+  800913:	89 e5                	mov    %esp,%ebp
+  800915:	8b 45 08             	mov    0x8(%ebp),%eax
+  800918:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80091c:	eb 03                	jmp    800921 <strchr+0xf>
+  80091e:	83 c0 01             	add    $0x1,%eax
+  800921:	0f b6 10             	movzbl (%eax),%edx
+  800924:	84 d2                	test   %dl,%dl
+  800926:	74 06                	je     80092e <strchr+0x1c>
+		if (*s == c)
+  800928:	38 ca                	cmp    %cl,%dl
+  80092a:	75 f2                	jne    80091e <strchr+0xc>
+  80092c:	eb 05                	jmp    800933 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80092e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800933:	5d                   	pop    %ebp
+  800934:	c3                   	ret
+
+00800935 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800935:	55                   	push   %ebp
+  800936:	89 e5                	mov    %esp,%ebp
+  800938:	8b 45 08             	mov    0x8(%ebp),%eax
+  80093b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80093f:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800942:	38 ca                	cmp    %cl,%dl
+  800944:	74 09                	je     80094f <strfind+0x1a>
+  800946:	84 d2                	test   %dl,%dl
+  800948:	74 05                	je     80094f <strfind+0x1a>
+	for (; *s; s++)
+  80094a:	83 c0 01             	add    $0x1,%eax
+  80094d:	eb f0                	jmp    80093f <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80094f:	5d                   	pop    %ebp
+  800950:	c3                   	ret
+
+00800951 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800951:	55                   	push   %ebp
+  800952:	89 e5                	mov    %esp,%ebp
+  800954:	57                   	push   %edi
+  800955:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800958:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80095b:	85 c9                	test   %ecx,%ecx
+  80095d:	74 20                	je     80097f <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80095f:	89 f8                	mov    %edi,%eax
+  800961:	09 c8                	or     %ecx,%eax
+  800963:	a8 03                	test   $0x3,%al
+  800965:	75 12                	jne    800979 <memset+0x28>
+		c &= 0xFF;
+  800967:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80096b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800971:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800974:	fc                   	cld
+  800975:	f3 ab                	rep stos %eax,%es:(%edi)
+  800977:	eb 06                	jmp    80097f <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800979:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80097c:	fc                   	cld
+  80097d:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80097f:	89 f8                	mov    %edi,%eax
+  800981:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800984:	c9                   	leave
+  800985:	c3                   	ret
+
+00800986 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800986:	55                   	push   %ebp
+  800987:	89 e5                	mov    %esp,%ebp
+  800989:	57                   	push   %edi
+  80098a:	56                   	push   %esi
+  80098b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80098e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800991:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800994:	39 c6                	cmp    %eax,%esi
+  800996:	73 32                	jae    8009ca <memmove+0x44>
+  800998:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80099b:	39 d0                	cmp    %edx,%eax
+  80099d:	73 2b                	jae    8009ca <memmove+0x44>
+		s += n;
+		d += n;
+  80099f:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009a2:	89 d6                	mov    %edx,%esi
+  8009a4:	09 fe                	or     %edi,%esi
+  8009a6:	09 ce                	or     %ecx,%esi
+  8009a8:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009ae:	75 0e                	jne    8009be <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009b0:	83 ef 04             	sub    $0x4,%edi
+  8009b3:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009b6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009b9:	fd                   	std
+  8009ba:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009bc:	eb 09                	jmp    8009c7 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009be:	83 ef 01             	sub    $0x1,%edi
+  8009c1:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009c4:	fd                   	std
+  8009c5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009c7:	fc                   	cld
+  8009c8:	eb 1a                	jmp    8009e4 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009ca:	89 f2                	mov    %esi,%edx
+  8009cc:	09 c2                	or     %eax,%edx
+  8009ce:	09 ca                	or     %ecx,%edx
+  8009d0:	f6 c2 03             	test   $0x3,%dl
+  8009d3:	75 0a                	jne    8009df <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009d5:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009d8:	89 c7                	mov    %eax,%edi
+  8009da:	fc                   	cld
+  8009db:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009dd:	eb 05                	jmp    8009e4 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009df:	89 c7                	mov    %eax,%edi
+  8009e1:	fc                   	cld
+  8009e2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009e4:	5e                   	pop    %esi
+  8009e5:	5f                   	pop    %edi
+  8009e6:	5d                   	pop    %ebp
+  8009e7:	c3                   	ret
+
+008009e8 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009e8:	55                   	push   %ebp
+  8009e9:	89 e5                	mov    %esp,%ebp
+  8009eb:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009ee:	ff 75 10             	push   0x10(%ebp)
+  8009f1:	ff 75 0c             	push   0xc(%ebp)
+  8009f4:	ff 75 08             	push   0x8(%ebp)
+  8009f7:	e8 8a ff ff ff       	call   800986 <memmove>
+}
+  8009fc:	c9                   	leave
+  8009fd:	c3                   	ret
+
+008009fe <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009fe:	55                   	push   %ebp
+  8009ff:	89 e5                	mov    %esp,%ebp
+  800a01:	56                   	push   %esi
+  800a02:	53                   	push   %ebx
+  800a03:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a06:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a09:	89 c6                	mov    %eax,%esi
+  800a0b:	03 75 10             	add    0x10(%ebp),%esi
+  800a0e:	eb 06                	jmp    800a16 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a10:	83 c0 01             	add    $0x1,%eax
+  800a13:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a16:	39 f0                	cmp    %esi,%eax
+  800a18:	74 14                	je     800a2e <memcmp+0x30>
+		if (*s1 != *s2)
+  800a1a:	0f b6 08             	movzbl (%eax),%ecx
+  800a1d:	0f b6 1a             	movzbl (%edx),%ebx
+  800a20:	38 d9                	cmp    %bl,%cl
+  800a22:	74 ec                	je     800a10 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a24:	0f b6 c1             	movzbl %cl,%eax
+  800a27:	0f b6 db             	movzbl %bl,%ebx
+  800a2a:	29 d8                	sub    %ebx,%eax
+  800a2c:	eb 05                	jmp    800a33 <memcmp+0x35>
+	}
+
+	return 0;
+  800a2e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a33:	5b                   	pop    %ebx
+  800a34:	5e                   	pop    %esi
+  800a35:	5d                   	pop    %ebp
+  800a36:	c3                   	ret
+
+00800a37 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a37:	55                   	push   %ebp
+  800a38:	89 e5                	mov    %esp,%ebp
+  800a3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a40:	89 c2                	mov    %eax,%edx
+  800a42:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a45:	eb 03                	jmp    800a4a <memfind+0x13>
+  800a47:	83 c0 01             	add    $0x1,%eax
+  800a4a:	39 d0                	cmp    %edx,%eax
+  800a4c:	73 04                	jae    800a52 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a4e:	38 08                	cmp    %cl,(%eax)
+  800a50:	75 f5                	jne    800a47 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a52:	5d                   	pop    %ebp
+  800a53:	c3                   	ret
+
+00800a54 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a54:	55                   	push   %ebp
+  800a55:	89 e5                	mov    %esp,%ebp
+  800a57:	57                   	push   %edi
+  800a58:	56                   	push   %esi
+  800a59:	53                   	push   %ebx
+  800a5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a5d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a60:	eb 03                	jmp    800a65 <strtol+0x11>
+		s++;
+  800a62:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a65:	0f b6 02             	movzbl (%edx),%eax
+  800a68:	3c 20                	cmp    $0x20,%al
+  800a6a:	74 f6                	je     800a62 <strtol+0xe>
+  800a6c:	3c 09                	cmp    $0x9,%al
+  800a6e:	74 f2                	je     800a62 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a70:	3c 2b                	cmp    $0x2b,%al
+  800a72:	74 2a                	je     800a9e <strtol+0x4a>
+	int neg = 0;
+  800a74:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a79:	3c 2d                	cmp    $0x2d,%al
+  800a7b:	74 2b                	je     800aa8 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a7d:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a83:	75 0f                	jne    800a94 <strtol+0x40>
+  800a85:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a88:	74 28                	je     800ab2 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a8a:	85 db                	test   %ebx,%ebx
+  800a8c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a91:	0f 44 d8             	cmove  %eax,%ebx
+  800a94:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a99:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a9c:	eb 46                	jmp    800ae4 <strtol+0x90>
+		s++;
+  800a9e:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800aa1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800aa6:	eb d5                	jmp    800a7d <strtol+0x29>
+		s++, neg = 1;
+  800aa8:	83 c2 01             	add    $0x1,%edx
+  800aab:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ab0:	eb cb                	jmp    800a7d <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ab2:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ab6:	74 0e                	je     800ac6 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800ab8:	85 db                	test   %ebx,%ebx
+  800aba:	75 d8                	jne    800a94 <strtol+0x40>
+		s++, base = 8;
+  800abc:	83 c2 01             	add    $0x1,%edx
+  800abf:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ac4:	eb ce                	jmp    800a94 <strtol+0x40>
+		s += 2, base = 16;
+  800ac6:	83 c2 02             	add    $0x2,%edx
+  800ac9:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ace:	eb c4                	jmp    800a94 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ad0:	0f be c0             	movsbl %al,%eax
+  800ad3:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ad6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ad9:	7d 3a                	jge    800b15 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800adb:	83 c2 01             	add    $0x1,%edx
+  800ade:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ae2:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ae4:	0f b6 02             	movzbl (%edx),%eax
+  800ae7:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800aea:	89 f3                	mov    %esi,%ebx
+  800aec:	80 fb 09             	cmp    $0x9,%bl
+  800aef:	76 df                	jbe    800ad0 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800af1:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800af4:	89 f3                	mov    %esi,%ebx
+  800af6:	80 fb 19             	cmp    $0x19,%bl
+  800af9:	77 08                	ja     800b03 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800afb:	0f be c0             	movsbl %al,%eax
+  800afe:	83 e8 57             	sub    $0x57,%eax
+  800b01:	eb d3                	jmp    800ad6 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b03:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b06:	89 f3                	mov    %esi,%ebx
+  800b08:	80 fb 19             	cmp    $0x19,%bl
+  800b0b:	77 08                	ja     800b15 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b0d:	0f be c0             	movsbl %al,%eax
+  800b10:	83 e8 37             	sub    $0x37,%eax
+  800b13:	eb c1                	jmp    800ad6 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b15:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b19:	74 05                	je     800b20 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b1b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b1e:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b20:	89 c8                	mov    %ecx,%eax
+  800b22:	f7 d8                	neg    %eax
+  800b24:	85 ff                	test   %edi,%edi
+  800b26:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b29:	89 c8                	mov    %ecx,%eax
+  800b2b:	5b                   	pop    %ebx
+  800b2c:	5e                   	pop    %esi
+  800b2d:	5f                   	pop    %edi
+  800b2e:	5d                   	pop    %ebp
+  800b2f:	c3                   	ret
+
+00800b30 <atoi>:
+
+int
+atoi(const char *s)
+{
+  800b30:	55                   	push   %ebp
+  800b31:	89 e5                	mov    %esp,%ebp
+  800b33:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800b36:	6a 0a                	push   $0xa
+  800b38:	6a 00                	push   $0x0
+  800b3a:	ff 75 08             	push   0x8(%ebp)
+  800b3d:	e8 12 ff ff ff       	call   800a54 <strtol>
+}
+  800b42:	c9                   	leave
+  800b43:	c3                   	ret
+
+00800b44 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800b44:	55                   	push   %ebp
+  800b45:	89 e5                	mov    %esp,%ebp
+  800b47:	57                   	push   %edi
+  800b48:	56                   	push   %esi
+  800b49:	53                   	push   %ebx
+  800b4a:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800b50:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800b56:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800b5c:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800b62:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800b69:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800b6c:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800b73:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800b76:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800b7d:	74 76                	je     800bf5 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800b7f:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800b85:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b88:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800b8e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b95:	0f 88 06 01 00 00    	js     800ca1 <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800b9b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ba2:	0f 84 48 01 00 00    	je     800cf0 <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800ba8:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800bae:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800bb4:	be 00 00 00 00       	mov    $0x0,%esi
+  800bb9:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800bbf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800bc2:	55                   	push   %ebp
+  800bc3:	68 cc 0b 80 00       	push   $0x800bcc
+  800bc8:	89 e5                	mov    %esp,%ebp
+  800bca:	0f 34                	sysenter
+  800bcc:	83 c4 04             	add    $0x4,%esp
+  800bcf:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800bd0:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800bd6:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800bdc:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800bdf:	0f 85 9a 01 00 00    	jne    800d7f <page_vec_call+0x23b>
+  800be5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bea:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bed:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bf0:	e9 29 01 00 00       	jmp    800d1e <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800bf5:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800bfb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bfe:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800c00:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800c07:	78 2f                	js     800c38 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800c09:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800c10:	74 72                	je     800c84 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800c12:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800c18:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800c1e:	b8 10 00 00 00       	mov    $0x10,%eax
+  800c23:	89 fb                	mov    %edi,%ebx
+  800c25:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c28:	55                   	push   %ebp
+  800c29:	68 32 0c 80 00       	push   $0x800c32
+  800c2e:	89 e5                	mov    %esp,%ebp
+  800c30:	0f 34                	sysenter
+  800c32:	83 c4 04             	add    $0x4,%esp
+  800c35:	5d                   	pop    %ebp
+	return ret;
+  800c36:	eb 98                	jmp    800bd0 <page_vec_call+0x8c>
+	asm volatile("cpuid"
+  800c38:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c3d:	0f a2                	cpuid
+		return 0;
+  800c3f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800c44:	f6 c6 08             	test   $0x8,%dh
+  800c47:	74 15                	je     800c5e <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c49:	89 c2                	mov    %eax,%edx
+  800c4b:	c1 ea 08             	shr    $0x8,%edx
+  800c4e:	83 e2 0f             	and    $0xf,%edx
+  800c51:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800c56:	83 fa 06             	cmp    $0x6,%edx
+  800c59:	74 0e                	je     800c69 <page_vec_call+0x125>
+  800c5b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800c5e:	0f b6 c9             	movzbl %cl,%ecx
+  800c61:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800c67:	eb a0                	jmp    800c09 <page_vec_call+0xc5>
+  800c69:	89 c2                	mov    %eax,%edx
+  800c6b:	c1 ea 04             	shr    $0x4,%edx
+  800c6e:	83 e2 0f             	and    $0xf,%edx
+  800c71:	83 fa 02             	cmp    $0x2,%edx
+  800c74:	77 e5                	ja     800c5b <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800c76:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c79:	83 f8 02             	cmp    $0x2,%eax
+  800c7c:	0f 97 c1             	seta   %cl
+  800c7f:	0f b6 c9             	movzbl %cl,%ecx
+  800c82:	eb d7                	jmp    800c5b <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800c84:	b8 10 00 00 00       	mov    $0x10,%eax
+  800c89:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800c8f:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800c95:	89 fb                	mov    %edi,%ebx
+  800c97:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c9a:	cd 30                	int    $0x30
+  800c9c:	e9 2f ff ff ff       	jmp    800bd0 <page_vec_call+0x8c>
+  800ca1:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ca6:	0f a2                	cpuid
+		return 0;
+  800ca8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800cad:	f6 c6 08             	test   $0x8,%dh
+  800cb0:	74 15                	je     800cc7 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800cb2:	89 c2                	mov    %eax,%edx
+  800cb4:	c1 ea 08             	shr    $0x8,%edx
+  800cb7:	83 e2 0f             	and    $0xf,%edx
+  800cba:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800cbf:	83 fa 06             	cmp    $0x6,%edx
+  800cc2:	74 11                	je     800cd5 <page_vec_call+0x191>
+  800cc4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800cc7:	0f b6 c9             	movzbl %cl,%ecx
+  800cca:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800cd0:	e9 c6 fe ff ff       	jmp    800b9b <page_vec_call+0x57>
+  800cd5:	89 c2                	mov    %eax,%edx
+  800cd7:	c1 ea 04             	shr    $0x4,%edx
+  800cda:	83 e2 0f             	and    $0xf,%edx
+  800cdd:	83 fa 02             	cmp    $0x2,%edx
+  800ce0:	77 e2                	ja     800cc4 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800ce2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ce5:	83 f8 02             	cmp    $0x2,%eax
+  800ce8:	0f 97 c1             	seta   %cl
+  800ceb:	0f b6 c9             	movzbl %cl,%ecx
+  800cee:	eb d4                	jmp    800cc4 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800cf0:	be 00 00 00 00       	mov    $0x0,%esi
+  800cf5:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800cfb:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800d01:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800d07:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800d0a:	cd 30                	int    $0x30
+  800d0c:	e9 bf fe ff ff       	jmp    800bd0 <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800d11:	29 da                	sub    %ebx,%edx
+			vec++;
+  800d13:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800d16:	83 e8 01             	sub    $0x1,%eax
+  800d19:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800d1e:	85 c0                	test   %eax,%eax
+  800d20:	74 58                	je     800d7a <page_vec_call+0x236>
+  800d22:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800d25:	39 da                	cmp    %ebx,%edx
+  800d27:	73 e8                	jae    800d11 <page_vec_call+0x1cd>
+  800d29:	89 75 08             	mov    %esi,0x8(%ebp)
+  800d2c:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800d2f:	84 c9                	test   %cl,%cl
+  800d31:	74 06                	je     800d39 <page_vec_call+0x1f5>
+  800d33:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800d39:	83 ec 04             	sub    $0x4,%esp
+  800d3c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d3f:	c1 e0 04             	shl    $0x4,%eax
+  800d42:	50                   	push   %eax
+  800d43:	ff 75 08             	push   0x8(%ebp)
+  800d46:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800d4c:	53                   	push   %ebx
+  800d4d:	e8 34 fc ff ff       	call   800986 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800d52:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800d58:	89 c2                	mov    %eax,%edx
+  800d5a:	c1 e2 0c             	shl    $0xc,%edx
+  800d5d:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  800d63:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  800d69:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  800d6f:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  800d72:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  800d75:	e9 f2 fd ff ff       	jmp    800b6c <page_vec_call+0x28>
+			r = 0;
+  800d7a:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  800d7f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800d83:	74 0b                	je     800d90 <page_vec_call+0x24c>
+		*done = total;
+  800d85:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800d88:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  800d8e:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  800d90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d93:	5b                   	pop    %ebx
+  800d94:	5e                   	pop    %esi
+  800d95:	5f                   	pop    %edi
+  800d96:	5d                   	pop    %ebp
+  800d97:	c3                   	ret
+
+00800d98 <sys_cputs>:
+{
+  800d98:	55                   	push   %ebp
+  800d99:	89 e5                	mov    %esp,%ebp
+  800d9b:	57                   	push   %edi
+  800d9c:	56                   	push   %esi
+  800d9d:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800d9e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800da5:	78 2d                	js     800dd4 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800da7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800dae:	74 70                	je     800e20 <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800db0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800db5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dbb:	89 c3                	mov    %eax,%ebx
+  800dbd:	89 c7                	mov    %eax,%edi
+  800dbf:	89 c6                	mov    %eax,%esi
+  800dc1:	55                   	push   %ebp
+  800dc2:	68 cb 0d 80 00       	push   $0x800dcb
+  800dc7:	89 e5                	mov    %esp,%ebp
+  800dc9:	0f 34                	sysenter
+  800dcb:	83 c4 04             	add    $0x4,%esp
+  800dce:	5d                   	pop    %ebp
+}
+  800dcf:	5b                   	pop    %ebx
+  800dd0:	5e                   	pop    %esi
+  800dd1:	5f                   	pop    %edi
+  800dd2:	5d                   	pop    %ebp
+  800dd3:	c3                   	ret
+  800dd4:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dd9:	0f a2                	cpuid
+		return 0;
+  800ddb:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800de0:	f6 c6 08             	test   $0x8,%dh
+  800de3:	74 15                	je     800dfa <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800de5:	89 c2                	mov    %eax,%edx
+  800de7:	c1 ea 08             	shr    $0x8,%edx
+  800dea:	83 e2 0f             	and    $0xf,%edx
+  800ded:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800df2:	83 fa 06             	cmp    $0x6,%edx
+  800df5:	74 0e                	je     800e05 <sys_cputs+0x6d>
+  800df7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800dfa:	0f b6 c9             	movzbl %cl,%ecx
+  800dfd:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800e03:	eb a2                	jmp    800da7 <sys_cputs+0xf>
+  800e05:	89 c2                	mov    %eax,%edx
+  800e07:	c1 ea 04             	shr    $0x4,%edx
+  800e0a:	83 e2 0f             	and    $0xf,%edx
+  800e0d:	83 fa 02             	cmp    $0x2,%edx
+  800e10:	77 e5                	ja     800df7 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800e12:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e15:	83 f8 02             	cmp    $0x2,%eax
+  800e18:	0f 97 c1             	seta   %cl
+  800e1b:	0f b6 c9             	movzbl %cl,%ecx
+  800e1e:	eb d7                	jmp    800df7 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800e20:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e25:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e2b:	89 c3                	mov    %eax,%ebx
+  800e2d:	89 c7                	mov    %eax,%edi
+  800e2f:	89 c6                	mov    %eax,%esi
+  800e31:	cd 30                	int    $0x30
+}
+  800e33:	eb 9a                	jmp    800dcf <sys_cputs+0x37>
+
+00800e35 <sys_cgetc>:
+{
+  800e35:	55                   	push   %ebp
+  800e36:	89 e5                	mov    %esp,%ebp
+  800e38:	57                   	push   %edi
+  800e39:	56                   	push   %esi
+  800e3a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800e3b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e42:	78 2e                	js     800e72 <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  800e44:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e4b:	74 71                	je     800ebe <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  800e4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e52:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e57:	89 d1                	mov    %edx,%ecx
+  800e59:	89 d3                	mov    %edx,%ebx
+  800e5b:	89 d7                	mov    %edx,%edi
+  800e5d:	89 d6                	mov    %edx,%esi
+  800e5f:	55                   	push   %ebp
+  800e60:	68 69 0e 80 00       	push   $0x800e69
+  800e65:	89 e5                	mov    %esp,%ebp
+  800e67:	0f 34                	sysenter
+  800e69:	83 c4 04             	add    $0x4,%esp
+  800e6c:	5d                   	pop    %ebp
+}
+  800e6d:	5b                   	pop    %ebx
+  800e6e:	5e                   	pop    %esi
+  800e6f:	5f                   	pop    %edi
+  800e70:	5d                   	pop    %ebp
+  800e71:	c3                   	ret
+  800e72:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e77:	0f a2                	cpuid
+		return 0;
+  800e79:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800e7e:	f6 c6 08             	test   $0x8,%dh
+  800e81:	74 15                	je     800e98 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e83:	89 c2                	mov    %eax,%edx
+  800e85:	c1 ea 08             	shr    $0x8,%edx
+  800e88:	83 e2 0f             	and    $0xf,%edx
+  800e8b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e90:	83 fa 06             	cmp    $0x6,%edx
+  800e93:	74 0e                	je     800ea3 <sys_cgetc+0x6e>
+  800e95:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e98:	0f b6 c9             	movzbl %cl,%ecx
+  800e9b:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800ea1:	eb a1                	jmp    800e44 <sys_cgetc+0xf>
+  800ea3:	89 c2                	mov    %eax,%edx
+  800ea5:	c1 ea 04             	shr    $0x4,%edx
+  800ea8:	83 e2 0f             	and    $0xf,%edx
+  800eab:	83 fa 02             	cmp    $0x2,%edx
+  800eae:	77 e5                	ja     800e95 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  800eb0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800eb3:	83 f8 02             	cmp    $0x2,%eax
+  800eb6:	0f 97 c1             	seta   %cl
+  800eb9:	0f b6 c9             	movzbl %cl,%ecx
+  800ebc:	eb d7                	jmp    800e95 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  800ebe:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ec3:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ec8:	89 d1                	mov    %edx,%ecx
+  800eca:	89 d3                	mov    %edx,%ebx
+  800ecc:	89 d7                	mov    %edx,%edi
+  800ece:	89 d6                	mov    %edx,%esi
+  800ed0:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800ed2:	eb 99                	jmp    800e6d <sys_cgetc+0x38>
+
+00800ed4 <sys_env_destroy>:
+{
+  800ed4:	55                   	push   %ebp
+  800ed5:	89 e5                	mov    %esp,%ebp
+  800ed7:	57                   	push   %edi
+  800ed8:	56                   	push   %esi
+  800ed9:	53                   	push   %ebx
+  800eda:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800edd:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ee4:	78 36                	js     800f1c <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  800ee6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800eed:	74 79                	je     800f68 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  800eef:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ef7:	b8 03 00 00 00       	mov    $0x3,%eax
+  800efc:	89 cb                	mov    %ecx,%ebx
+  800efe:	89 cf                	mov    %ecx,%edi
+  800f00:	89 ce                	mov    %ecx,%esi
+  800f02:	55                   	push   %ebp
+  800f03:	68 0c 0f 80 00       	push   $0x800f0c
+  800f08:	89 e5                	mov    %esp,%ebp
+  800f0a:	0f 34                	sysenter
+  800f0c:	83 c4 04             	add    $0x4,%esp
+  800f0f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800f10:	85 c0                	test   %eax,%eax
+  800f12:	7f 6b                	jg     800f7f <sys_env_destroy+0xab>
+}
+  800f14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f17:	5b                   	pop    %ebx
+  800f18:	5e                   	pop    %esi
+  800f19:	5f                   	pop    %edi
+  800f1a:	5d                   	pop    %ebp
+  800f1b:	c3                   	ret
+  800f1c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f21:	0f a2                	cpuid
+		return 0;
+  800f23:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f28:	f6 c6 08             	test   $0x8,%dh
+  800f2b:	74 15                	je     800f42 <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f2d:	89 c2                	mov    %eax,%edx
+  800f2f:	c1 ea 08             	shr    $0x8,%edx
+  800f32:	83 e2 0f             	and    $0xf,%edx
+  800f35:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f3a:	83 fa 06             	cmp    $0x6,%edx
+  800f3d:	74 0e                	je     800f4d <sys_env_destroy+0x79>
+  800f3f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f42:	0f b6 c9             	movzbl %cl,%ecx
+  800f45:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800f4b:	eb 99                	jmp    800ee6 <sys_env_destroy+0x12>
+  800f4d:	89 c2                	mov    %eax,%edx
+  800f4f:	c1 ea 04             	shr    $0x4,%edx
+  800f52:	83 e2 0f             	and    $0xf,%edx
+  800f55:	83 fa 02             	cmp    $0x2,%edx
+  800f58:	77 e5                	ja     800f3f <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  800f5a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f5d:	83 f8 02             	cmp    $0x2,%eax
+  800f60:	0f 97 c1             	seta   %cl
+  800f63:	0f b6 c9             	movzbl %cl,%ecx
+  800f66:	eb d7                	jmp    800f3f <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  800f68:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f6d:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f72:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f75:	89 cb                	mov    %ecx,%ebx
+  800f77:	89 cf                	mov    %ecx,%edi
+  800f79:	89 ce                	mov    %ecx,%esi
+  800f7b:	cd 30                	int    $0x30
+  800f7d:	eb 91                	jmp    800f10 <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f7f:	83 ec 0c             	sub    $0xc,%esp
+  800f82:	50                   	push   %eax
+  800f83:	6a 03                	push   $0x3
+  800f85:	68 79 2c 80 00       	push   $0x802c79
+  800f8a:	6a 4a                	push   $0x4a
+  800f8c:	68 96 2c 80 00       	push   $0x802c96
+  800f91:	e8 1e 17 00 00       	call   8026b4 <_panic>
+
+00800f96 <sys_getenvid>:
+{
+  800f96:	55                   	push   %ebp
+  800f97:	89 e5                	mov    %esp,%ebp
+  800f99:	57                   	push   %edi
+  800f9a:	56                   	push   %esi
+  800f9b:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800f9c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fa3:	78 2e                	js     800fd3 <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  800fa5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fac:	74 71                	je     80101f <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  800fae:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fb3:	b8 02 00 00 00       	mov    $0x2,%eax
+  800fb8:	89 d1                	mov    %edx,%ecx
+  800fba:	89 d3                	mov    %edx,%ebx
+  800fbc:	89 d7                	mov    %edx,%edi
+  800fbe:	89 d6                	mov    %edx,%esi
+  800fc0:	55                   	push   %ebp
+  800fc1:	68 ca 0f 80 00       	push   $0x800fca
+  800fc6:	89 e5                	mov    %esp,%ebp
+  800fc8:	0f 34                	sysenter
+  800fca:	83 c4 04             	add    $0x4,%esp
+  800fcd:	5d                   	pop    %ebp
+}
+  800fce:	5b                   	pop    %ebx
+  800fcf:	5e                   	pop    %esi
+  800fd0:	5f                   	pop    %edi
+  800fd1:	5d                   	pop    %ebp
+  800fd2:	c3                   	ret
+  800fd3:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fd8:	0f a2                	cpuid
+		return 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800fdf:	f6 c6 08             	test   $0x8,%dh
+  800fe2:	74 15                	je     800ff9 <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800fe4:	89 c2                	mov    %eax,%edx
+  800fe6:	c1 ea 08             	shr    $0x8,%edx
+  800fe9:	83 e2 0f             	and    $0xf,%edx
+  800fec:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ff1:	83 fa 06             	cmp    $0x6,%edx
+  800ff4:	74 0e                	je     801004 <sys_getenvid+0x6e>
+  800ff6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800ff9:	0f b6 c9             	movzbl %cl,%ecx
+  800ffc:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801002:	eb a1                	jmp    800fa5 <sys_getenvid+0xf>
+  801004:	89 c2                	mov    %eax,%edx
+  801006:	c1 ea 04             	shr    $0x4,%edx
+  801009:	83 e2 0f             	and    $0xf,%edx
+  80100c:	83 fa 02             	cmp    $0x2,%edx
+  80100f:	77 e5                	ja     800ff6 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  801011:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801014:	83 f8 02             	cmp    $0x2,%eax
+  801017:	0f 97 c1             	seta   %cl
+  80101a:	0f b6 c9             	movzbl %cl,%ecx
+  80101d:	eb d7                	jmp    800ff6 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  80101f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801024:	b8 02 00 00 00       	mov    $0x2,%eax
+  801029:	89 d1                	mov    %edx,%ecx
+  80102b:	89 d3                	mov    %edx,%ebx
+  80102d:	89 d7                	mov    %edx,%edi
+  80102f:	89 d6                	mov    %edx,%esi
+  801031:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801033:	eb 99                	jmp    800fce <sys_getenvid+0x38>
+
+00801035 <sys_page_alloc>:
+{
+  801035:	55                   	push   %ebp
+  801036:	89 e5                	mov    %esp,%ebp
+  801038:	57                   	push   %edi
+  801039:	56                   	push   %esi
+  80103a:	53                   	push   %ebx
+  80103b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80103e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801045:	78 38                	js     80107f <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  801047:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80104e:	74 7b                	je     8010cb <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  801050:	be 00 00 00 00       	mov    $0x0,%esi
+  801055:	8b 55 08             	mov    0x8(%ebp),%edx
+  801058:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80105b:	b8 04 00 00 00       	mov    $0x4,%eax
+  801060:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801063:	89 f7                	mov    %esi,%edi
+  801065:	55                   	push   %ebp
+  801066:	68 6f 10 80 00       	push   $0x80106f
+  80106b:	89 e5                	mov    %esp,%ebp
+  80106d:	0f 34                	sysenter
+  80106f:	83 c4 04             	add    $0x4,%esp
+  801072:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801073:	85 c0                	test   %eax,%eax
+  801075:	7f 6d                	jg     8010e4 <sys_page_alloc+0xaf>
+}
+  801077:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80107a:	5b                   	pop    %ebx
+  80107b:	5e                   	pop    %esi
+  80107c:	5f                   	pop    %edi
+  80107d:	5d                   	pop    %ebp
+  80107e:	c3                   	ret
+  80107f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801084:	0f a2                	cpuid
+		return 0;
+  801086:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80108b:	f6 c6 08             	test   $0x8,%dh
+  80108e:	74 15                	je     8010a5 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801090:	89 c2                	mov    %eax,%edx
+  801092:	c1 ea 08             	shr    $0x8,%edx
+  801095:	83 e2 0f             	and    $0xf,%edx
+  801098:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80109d:	83 fa 06             	cmp    $0x6,%edx
+  8010a0:	74 0e                	je     8010b0 <sys_page_alloc+0x7b>
+  8010a2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8010a5:	0f b6 c9             	movzbl %cl,%ecx
+  8010a8:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8010ae:	eb 97                	jmp    801047 <sys_page_alloc+0x12>
+  8010b0:	89 c2                	mov    %eax,%edx
+  8010b2:	c1 ea 04             	shr    $0x4,%edx
+  8010b5:	83 e2 0f             	and    $0xf,%edx
+  8010b8:	83 fa 02             	cmp    $0x2,%edx
+  8010bb:	77 e5                	ja     8010a2 <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  8010bd:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010c0:	83 f8 02             	cmp    $0x2,%eax
+  8010c3:	0f 97 c1             	seta   %cl
+  8010c6:	0f b6 c9             	movzbl %cl,%ecx
+  8010c9:	eb d7                	jmp    8010a2 <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  8010cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8010d0:	b8 04 00 00 00       	mov    $0x4,%eax
+  8010d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010db:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010de:	89 f7                	mov    %esi,%edi
+  8010e0:	cd 30                	int    $0x30
+  8010e2:	eb 8f                	jmp    801073 <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010e4:	83 ec 0c             	sub    $0xc,%esp
+  8010e7:	50                   	push   %eax
+  8010e8:	6a 04                	push   $0x4
+  8010ea:	68 79 2c 80 00       	push   $0x802c79
+  8010ef:	6a 4a                	push   $0x4a
+  8010f1:	68 96 2c 80 00       	push   $0x802c96
+  8010f6:	e8 b9 15 00 00       	call   8026b4 <_panic>
+
+008010fb <sys_page_map>:
+{
+  8010fb:	55                   	push   %ebp
+  8010fc:	89 e5                	mov    %esp,%ebp
+  8010fe:	57                   	push   %edi
+  8010ff:	56                   	push   %esi
+  801100:	53                   	push   %ebx
+  801101:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801104:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80110b:	78 37                	js     801144 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  80110d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801114:	74 7a                	je     801190 <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  801116:	8b 55 08             	mov    0x8(%ebp),%edx
+  801119:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111c:	b8 05 00 00 00       	mov    $0x5,%eax
+  801121:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801124:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801127:	8b 75 18             	mov    0x18(%ebp),%esi
+  80112a:	55                   	push   %ebp
+  80112b:	68 34 11 80 00       	push   $0x801134
+  801130:	89 e5                	mov    %esp,%ebp
+  801132:	0f 34                	sysenter
+  801134:	83 c4 04             	add    $0x4,%esp
+  801137:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801138:	85 c0                	test   %eax,%eax
+  80113a:	7f 6c                	jg     8011a8 <sys_page_map+0xad>
+}
+  80113c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80113f:	5b                   	pop    %ebx
+  801140:	5e                   	pop    %esi
+  801141:	5f                   	pop    %edi
+  801142:	5d                   	pop    %ebp
+  801143:	c3                   	ret
+  801144:	b8 01 00 00 00       	mov    $0x1,%eax
+  801149:	0f a2                	cpuid
+		return 0;
+  80114b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801150:	f6 c6 08             	test   $0x8,%dh
+  801153:	74 15                	je     80116a <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801155:	89 c2                	mov    %eax,%edx
+  801157:	c1 ea 08             	shr    $0x8,%edx
+  80115a:	83 e2 0f             	and    $0xf,%edx
+  80115d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801162:	83 fa 06             	cmp    $0x6,%edx
+  801165:	74 0e                	je     801175 <sys_page_map+0x7a>
+  801167:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80116a:	0f b6 c9             	movzbl %cl,%ecx
+  80116d:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801173:	eb 98                	jmp    80110d <sys_page_map+0x12>
+  801175:	89 c2                	mov    %eax,%edx
+  801177:	c1 ea 04             	shr    $0x4,%edx
+  80117a:	83 e2 0f             	and    $0xf,%edx
+  80117d:	83 fa 02             	cmp    $0x2,%edx
+  801180:	77 e5                	ja     801167 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  801182:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801185:	83 f8 02             	cmp    $0x2,%eax
+  801188:	0f 97 c1             	seta   %cl
+  80118b:	0f b6 c9             	movzbl %cl,%ecx
+  80118e:	eb d7                	jmp    801167 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  801190:	b8 05 00 00 00       	mov    $0x5,%eax
+  801195:	8b 55 08             	mov    0x8(%ebp),%edx
+  801198:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80119b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80119e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011a1:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011a4:	cd 30                	int    $0x30
+  8011a6:	eb 90                	jmp    801138 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011a8:	83 ec 0c             	sub    $0xc,%esp
+  8011ab:	50                   	push   %eax
+  8011ac:	6a 05                	push   $0x5
+  8011ae:	68 79 2c 80 00       	push   $0x802c79
+  8011b3:	6a 4a                	push   $0x4a
+  8011b5:	68 96 2c 80 00       	push   $0x802c96
+  8011ba:	e8 f5 14 00 00       	call   8026b4 <_panic>
+
+008011bf <sys_page_unmap>:
+{
+  8011bf:	55                   	push   %ebp
+  8011c0:	89 e5                	mov    %esp,%ebp
+  8011c2:	57                   	push   %edi
+  8011c3:	56                   	push   %esi
+  8011c4:	53                   	push   %ebx
+  8011c5:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8011c8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8011cf:	78 37                	js     801208 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  8011d1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8011d8:	74 7a                	je     801254 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  8011da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e5:	b8 06 00 00 00       	mov    $0x6,%eax
+  8011ea:	89 df                	mov    %ebx,%edi
+  8011ec:	89 de                	mov    %ebx,%esi
+  8011ee:	55                   	push   %ebp
+  8011ef:	68 f8 11 80 00       	push   $0x8011f8
+  8011f4:	89 e5                	mov    %esp,%ebp
+  8011f6:	0f 34                	sysenter
+  8011f8:	83 c4 04             	add    $0x4,%esp
+  8011fb:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8011fc:	85 c0                	test   %eax,%eax
+  8011fe:	7f 6c                	jg     80126c <sys_page_unmap+0xad>
+}
+  801200:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801203:	5b                   	pop    %ebx
+  801204:	5e                   	pop    %esi
+  801205:	5f                   	pop    %edi
+  801206:	5d                   	pop    %ebp
+  801207:	c3                   	ret
+  801208:	b8 01 00 00 00       	mov    $0x1,%eax
+  80120d:	0f a2                	cpuid
+		return 0;
+  80120f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801214:	f6 c6 08             	test   $0x8,%dh
+  801217:	74 15                	je     80122e <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801219:	89 c2                	mov    %eax,%edx
+  80121b:	c1 ea 08             	shr    $0x8,%edx
+  80121e:	83 e2 0f             	and    $0xf,%edx
+  801221:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801226:	83 fa 06             	cmp    $0x6,%edx
+  801229:	74 0e                	je     801239 <sys_page_unmap+0x7a>
+  80122b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80122e:	0f b6 c9             	movzbl %cl,%ecx
+  801231:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801237:	eb 98                	jmp    8011d1 <sys_page_unmap+0x12>
+  801239:	89 c2                	mov    %eax,%edx
+  80123b:	c1 ea 04             	shr    $0x4,%edx
+  80123e:	83 e2 0f             	and    $0xf,%edx
+  801241:	83 fa 02             	cmp    $0x2,%edx
+  801244:	77 e5                	ja     80122b <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  801246:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801249:	83 f8 02             	cmp    $0x2,%eax
+  80124c:	0f 97 c1             	seta   %cl
+  80124f:	0f b6 c9             	movzbl %cl,%ecx
+  801252:	eb d7                	jmp    80122b <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  801254:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801259:	b8 06 00 00 00       	mov    $0x6,%eax
+  80125e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801261:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801264:	89 df                	mov    %ebx,%edi
+  801266:	89 de                	mov    %ebx,%esi
+  801268:	cd 30                	int    $0x30
+  80126a:	eb 90                	jmp    8011fc <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80126c:	83 ec 0c             	sub    $0xc,%esp
+  80126f:	50                   	push   %eax
+  801270:	6a 06                	push   $0x6
+  801272:	68 79 2c 80 00       	push   $0x802c79
+  801277:	6a 4a                	push   $0x4a
+  801279:	68 96 2c 80 00       	push   $0x802c96
+  80127e:	e8 31 14 00 00       	call   8026b4 <_panic>
+
+00801283 <sys_page_copy>:
+{
+  801283:	55                   	push   %ebp
+  801284:	89 e5                	mov    %esp,%ebp
+  801286:	57                   	push   %edi
+  801287:	56                   	push   %esi
+  801288:	53                   	push   %ebx
+  801289:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80128c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801293:	78 37                	js     8012cc <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  801295:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80129c:	74 7a                	je     801318 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  80129e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a4:	b8 29 00 00 00       	mov    $0x29,%eax
+  8012a9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012ac:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012af:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012b2:	55                   	push   %ebp
+  8012b3:	68 bc 12 80 00       	push   $0x8012bc
+  8012b8:	89 e5                	mov    %esp,%ebp
+  8012ba:	0f 34                	sysenter
+  8012bc:	83 c4 04             	add    $0x4,%esp
+  8012bf:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8012c0:	85 c0                	test   %eax,%eax
+  8012c2:	7f 6c                	jg     801330 <sys_page_copy+0xad>
+}
+  8012c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012c7:	5b                   	pop    %ebx
+  8012c8:	5e                   	pop    %esi
+  8012c9:	5f                   	pop    %edi
+  8012ca:	5d                   	pop    %ebp
+  8012cb:	c3                   	ret
+  8012cc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012d1:	0f a2                	cpuid
+		return 0;
+  8012d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8012d8:	f6 c6 08             	test   $0x8,%dh
+  8012db:	74 15                	je     8012f2 <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012dd:	89 c2                	mov    %eax,%edx
+  8012df:	c1 ea 08             	shr    $0x8,%edx
+  8012e2:	83 e2 0f             	and    $0xf,%edx
+  8012e5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012ea:	83 fa 06             	cmp    $0x6,%edx
+  8012ed:	74 0e                	je     8012fd <sys_page_copy+0x7a>
+  8012ef:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8012f2:	0f b6 c9             	movzbl %cl,%ecx
+  8012f5:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8012fb:	eb 98                	jmp    801295 <sys_page_copy+0x12>
+  8012fd:	89 c2                	mov    %eax,%edx
+  8012ff:	c1 ea 04             	shr    $0x4,%edx
+  801302:	83 e2 0f             	and    $0xf,%edx
+  801305:	83 fa 02             	cmp    $0x2,%edx
+  801308:	77 e5                	ja     8012ef <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  80130a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80130d:	83 f8 02             	cmp    $0x2,%eax
+  801310:	0f 97 c1             	seta   %cl
+  801313:	0f b6 c9             	movzbl %cl,%ecx
+  801316:	eb d7                	jmp    8012ef <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  801318:	b8 29 00 00 00       	mov    $0x29,%eax
+  80131d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801320:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801323:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801326:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801329:	8b 75 18             	mov    0x18(%ebp),%esi
+  80132c:	cd 30                	int    $0x30
+  80132e:	eb 90                	jmp    8012c0 <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801330:	83 ec 0c             	sub    $0xc,%esp
+  801333:	50                   	push   %eax
+  801334:	6a 29                	push   $0x29
+  801336:	68 79 2c 80 00       	push   $0x802c79
+  80133b:	6a 4a                	push   $0x4a
+  80133d:	68 96 2c 80 00       	push   $0x802c96
+  801342:	e8 6d 13 00 00       	call   8026b4 <_panic>
+
+00801347 <sys_yield>:
+{
+  801347:	55                   	push   %ebp
+  801348:	89 e5                	mov    %esp,%ebp
+  80134a:	57                   	push   %edi
+  80134b:	56                   	push   %esi
+  80134c:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80134d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801354:	78 2e                	js     801384 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  801356:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80135d:	74 71                	je     8013d0 <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  80135f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801364:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801369:	89 d1                	mov    %edx,%ecx
+  80136b:	89 d3                	mov    %edx,%ebx
+  80136d:	89 d7                	mov    %edx,%edi
+  80136f:	89 d6                	mov    %edx,%esi
+  801371:	55                   	push   %ebp
+  801372:	68 7b 13 80 00       	push   $0x80137b
+  801377:	89 e5                	mov    %esp,%ebp
+  801379:	0f 34                	sysenter
+  80137b:	83 c4 04             	add    $0x4,%esp
+  80137e:	5d                   	pop    %ebp
+}
+  80137f:	5b                   	pop    %ebx
+  801380:	5e                   	pop    %esi
+  801381:	5f                   	pop    %edi
+  801382:	5d                   	pop    %ebp
+  801383:	c3                   	ret
+  801384:	b8 01 00 00 00       	mov    $0x1,%eax
+  801389:	0f a2                	cpuid
+		return 0;
+  80138b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801390:	f6 c6 08             	test   $0x8,%dh
+  801393:	74 15                	je     8013aa <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801395:	89 c2                	mov    %eax,%edx
+  801397:	c1 ea 08             	shr    $0x8,%edx
+  80139a:	83 e2 0f             	and    $0xf,%edx
+  80139d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8013a2:	83 fa 06             	cmp    $0x6,%edx
+  8013a5:	74 0e                	je     8013b5 <sys_yield+0x6e>
+  8013a7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8013aa:	0f b6 c9             	movzbl %cl,%ecx
+  8013ad:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8013b3:	eb a1                	jmp    801356 <sys_yield+0xf>
+  8013b5:	89 c2                	mov    %eax,%edx
+  8013b7:	c1 ea 04             	shr    $0x4,%edx
+  8013ba:	83 e2 0f             	and    $0xf,%edx
+  8013bd:	83 fa 02             	cmp    $0x2,%edx
+  8013c0:	77 e5                	ja     8013a7 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  8013c2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013c5:	83 f8 02             	cmp    $0x2,%eax
+  8013c8:	0f 97 c1             	seta   %cl
+  8013cb:	0f b6 c9             	movzbl %cl,%ecx
+  8013ce:	eb d7                	jmp    8013a7 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  8013d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013d5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8013da:	89 d1                	mov    %edx,%ecx
+  8013dc:	89 d3                	mov    %edx,%ebx
+  8013de:	89 d7                	mov    %edx,%edi
+  8013e0:	89 d6                	mov    %edx,%esi
+  8013e2:	cd 30                	int    $0x30
+}
+  8013e4:	eb 99                	jmp    80137f <sys_yield+0x38>
+
+008013e6 <sys_env_set_status>:
+{
+  8013e6:	55                   	push   %ebp
+  8013e7:	89 e5                	mov    %esp,%ebp
+  8013e9:	57                   	push   %edi
+  8013ea:	56                   	push   %esi
+  8013eb:	53                   	push   %ebx
+  8013ec:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8013ef:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8013f6:	78 37                	js     80142f <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  8013f8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8013ff:	74 7a                	je     80147b <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  801401:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801406:	8b 55 08             	mov    0x8(%ebp),%edx
+  801409:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80140c:	b8 08 00 00 00       	mov    $0x8,%eax
+  801411:	89 df                	mov    %ebx,%edi
+  801413:	89 de                	mov    %ebx,%esi
+  801415:	55                   	push   %ebp
+  801416:	68 1f 14 80 00       	push   $0x80141f
+  80141b:	89 e5                	mov    %esp,%ebp
+  80141d:	0f 34                	sysenter
+  80141f:	83 c4 04             	add    $0x4,%esp
+  801422:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801423:	85 c0                	test   %eax,%eax
+  801425:	7f 6c                	jg     801493 <sys_env_set_status+0xad>
+}
+  801427:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80142a:	5b                   	pop    %ebx
+  80142b:	5e                   	pop    %esi
+  80142c:	5f                   	pop    %edi
+  80142d:	5d                   	pop    %ebp
+  80142e:	c3                   	ret
+  80142f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801434:	0f a2                	cpuid
+		return 0;
+  801436:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80143b:	f6 c6 08             	test   $0x8,%dh
+  80143e:	74 15                	je     801455 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801440:	89 c2                	mov    %eax,%edx
+  801442:	c1 ea 08             	shr    $0x8,%edx
+  801445:	83 e2 0f             	and    $0xf,%edx
+  801448:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80144d:	83 fa 06             	cmp    $0x6,%edx
+  801450:	74 0e                	je     801460 <sys_env_set_status+0x7a>
+  801452:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801455:	0f b6 c9             	movzbl %cl,%ecx
+  801458:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80145e:	eb 98                	jmp    8013f8 <sys_env_set_status+0x12>
+  801460:	89 c2                	mov    %eax,%edx
+  801462:	c1 ea 04             	shr    $0x4,%edx
+  801465:	83 e2 0f             	and    $0xf,%edx
+  801468:	83 fa 02             	cmp    $0x2,%edx
+  80146b:	77 e5                	ja     801452 <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  80146d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801470:	83 f8 02             	cmp    $0x2,%eax
+  801473:	0f 97 c1             	seta   %cl
+  801476:	0f b6 c9             	movzbl %cl,%ecx
+  801479:	eb d7                	jmp    801452 <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  80147b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801480:	b8 08 00 00 00       	mov    $0x8,%eax
+  801485:	8b 55 08             	mov    0x8(%ebp),%edx
+  801488:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80148b:	89 df                	mov    %ebx,%edi
+  80148d:	89 de                	mov    %ebx,%esi
+  80148f:	cd 30                	int    $0x30
+  801491:	eb 90                	jmp    801423 <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801493:	83 ec 0c             	sub    $0xc,%esp
+  801496:	50                   	push   %eax
+  801497:	6a 08                	push   $0x8
+  801499:	68 79 2c 80 00       	push   $0x802c79
+  80149e:	6a 4a                	push   $0x4a
+  8014a0:	68 96 2c 80 00       	push   $0x802c96
+  8014a5:	e8 0a 12 00 00       	call   8026b4 <_panic>
+
+008014aa <sys_sysinfo>:
+{
+  8014aa:	55                   	push   %ebp
+  8014ab:	89 e5                	mov    %esp,%ebp
+  8014ad:	57                   	push   %edi
+  8014ae:	56                   	push   %esi
+  8014af:	53                   	push   %ebx
+  8014b0:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8014b3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8014ba:	78 36                	js     8014f2 <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  8014bc:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8014c3:	74 79                	je     80153e <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  8014c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014cd:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8014d2:	89 cb                	mov    %ecx,%ebx
+  8014d4:	89 cf                	mov    %ecx,%edi
+  8014d6:	89 ce                	mov    %ecx,%esi
+  8014d8:	55                   	push   %ebp
+  8014d9:	68 e2 14 80 00       	push   $0x8014e2
+  8014de:	89 e5                	mov    %esp,%ebp
+  8014e0:	0f 34                	sysenter
+  8014e2:	83 c4 04             	add    $0x4,%esp
+  8014e5:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8014e6:	85 c0                	test   %eax,%eax
+  8014e8:	7f 6b                	jg     801555 <sys_sysinfo+0xab>
+}
+  8014ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ed:	5b                   	pop    %ebx
+  8014ee:	5e                   	pop    %esi
+  8014ef:	5f                   	pop    %edi
+  8014f0:	5d                   	pop    %ebp
+  8014f1:	c3                   	ret
+  8014f2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014f7:	0f a2                	cpuid
+		return 0;
+  8014f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8014fe:	f6 c6 08             	test   $0x8,%dh
+  801501:	74 15                	je     801518 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801503:	89 c2                	mov    %eax,%edx
+  801505:	c1 ea 08             	shr    $0x8,%edx
+  801508:	83 e2 0f             	and    $0xf,%edx
+  80150b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801510:	83 fa 06             	cmp    $0x6,%edx
+  801513:	74 0e                	je     801523 <sys_sysinfo+0x79>
+  801515:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801518:	0f b6 c9             	movzbl %cl,%ecx
+  80151b:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801521:	eb 99                	jmp    8014bc <sys_sysinfo+0x12>
+  801523:	89 c2                	mov    %eax,%edx
+  801525:	c1 ea 04             	shr    $0x4,%edx
+  801528:	83 e2 0f             	and    $0xf,%edx
+  80152b:	83 fa 02             	cmp    $0x2,%edx
+  80152e:	77 e5                	ja     801515 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  801530:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801533:	83 f8 02             	cmp    $0x2,%eax
+  801536:	0f 97 c1             	seta   %cl
+  801539:	0f b6 c9             	movzbl %cl,%ecx
+  80153c:	eb d7                	jmp    801515 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  80153e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801543:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801548:	8b 55 08             	mov    0x8(%ebp),%edx
+  80154b:	89 cb                	mov    %ecx,%ebx
+  80154d:	89 cf                	mov    %ecx,%edi
+  80154f:	89 ce                	mov    %ecx,%esi
+  801551:	cd 30                	int    $0x30
+  801553:	eb 91                	jmp    8014e6 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801555:	83 ec 0c             	sub    $0xc,%esp
+  801558:	50                   	push   %eax
+  801559:	6a 0b                	push   $0xb
+  80155b:	68 79 2c 80 00       	push   $0x802c79
+  801560:	6a 4a                	push   $0x4a
+  801562:	68 96 2c 80 00       	push   $0x802c96
+  801567:	e8 48 11 00 00       	call   8026b4 <_panic>
+
+0080156c <sys_env_set_trapframe>:
+{
+  80156c:	55                   	push   %ebp
+  80156d:	89 e5                	mov    %esp,%ebp
+  80156f:	57                   	push   %edi
+  801570:	56                   	push   %esi
+  801571:	53                   	push   %ebx
+  801572:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801575:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80157c:	78 37                	js     8015b5 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  80157e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801585:	74 7a                	je     801601 <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  801587:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80158c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80158f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801592:	b8 13 00 00 00       	mov    $0x13,%eax
+  801597:	89 df                	mov    %ebx,%edi
+  801599:	89 de                	mov    %ebx,%esi
+  80159b:	55                   	push   %ebp
+  80159c:	68 a5 15 80 00       	push   $0x8015a5
+  8015a1:	89 e5                	mov    %esp,%ebp
+  8015a3:	0f 34                	sysenter
+  8015a5:	83 c4 04             	add    $0x4,%esp
+  8015a8:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8015a9:	85 c0                	test   %eax,%eax
+  8015ab:	7f 6c                	jg     801619 <sys_env_set_trapframe+0xad>
+}
+  8015ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015b0:	5b                   	pop    %ebx
+  8015b1:	5e                   	pop    %esi
+  8015b2:	5f                   	pop    %edi
+  8015b3:	5d                   	pop    %ebp
+  8015b4:	c3                   	ret
+  8015b5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015ba:	0f a2                	cpuid
+		return 0;
+  8015bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8015c1:	f6 c6 08             	test   $0x8,%dh
+  8015c4:	74 15                	je     8015db <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015c6:	89 c2                	mov    %eax,%edx
+  8015c8:	c1 ea 08             	shr    $0x8,%edx
+  8015cb:	83 e2 0f             	and    $0xf,%edx
+  8015ce:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8015d3:	83 fa 06             	cmp    $0x6,%edx
+  8015d6:	74 0e                	je     8015e6 <sys_env_set_trapframe+0x7a>
+  8015d8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8015db:	0f b6 c9             	movzbl %cl,%ecx
+  8015de:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8015e4:	eb 98                	jmp    80157e <sys_env_set_trapframe+0x12>
+  8015e6:	89 c2                	mov    %eax,%edx
+  8015e8:	c1 ea 04             	shr    $0x4,%edx
+  8015eb:	83 e2 0f             	and    $0xf,%edx
+  8015ee:	83 fa 02             	cmp    $0x2,%edx
+  8015f1:	77 e5                	ja     8015d8 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  8015f3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015f6:	83 f8 02             	cmp    $0x2,%eax
+  8015f9:	0f 97 c1             	seta   %cl
+  8015fc:	0f b6 c9             	movzbl %cl,%ecx
+  8015ff:	eb d7                	jmp    8015d8 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  801601:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801606:	b8 13 00 00 00       	mov    $0x13,%eax
+  80160b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80160e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801611:	89 df                	mov    %ebx,%edi
+  801613:	89 de                	mov    %ebx,%esi
+  801615:	cd 30                	int    $0x30
+  801617:	eb 90                	jmp    8015a9 <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801619:	83 ec 0c             	sub    $0xc,%esp
+  80161c:	50                   	push   %eax
+  80161d:	6a 13                	push   $0x13
+  80161f:	68 79 2c 80 00       	push   $0x802c79
+  801624:	6a 4a                	push   $0x4a
+  801626:	68 96 2c 80 00       	push   $0x802c96
+  80162b:	e8 84 10 00 00       	call   8026b4 <_panic>
+
+00801630 <sys_env_set_stack_limit>:
+{
+  801630:	55                   	push   %ebp
+  801631:	89 e5                	mov    %esp,%ebp
+  801633:	57                   	push   %edi
+  801634:	56                   	push   %esi
+  801635:	53                   	push   %ebx
+  801636:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801639:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801640:	78 37                	js     801679 <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  801642:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801649:	74 7a                	je     8016c5 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  80164b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801650:	8b 55 08             	mov    0x8(%ebp),%edx
+  801653:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801656:	b8 19 00 00 00       	mov    $0x19,%eax
+  80165b:	89 df                	mov    %ebx,%edi
+  80165d:	89 de                	mov    %ebx,%esi
+  80165f:	55                   	push   %ebp
+  801660:	68 69 16 80 00       	push   $0x801669
+  801665:	89 e5                	mov    %esp,%ebp
+  801667:	0f 34                	sysenter
+  801669:	83 c4 04             	add    $0x4,%esp
+  80166c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80166d:	85 c0                	test   %eax,%eax
+  80166f:	7f 6c                	jg     8016dd <sys_env_set_stack_limit+0xad>
+}
+  801671:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801674:	5b                   	pop    %ebx
+  801675:	5e                   	pop    %esi
+  801676:	5f                   	pop    %edi
+  801677:	5d                   	pop    %ebp
+  801678:	c3                   	ret
+  801679:	b8 01 00 00 00       	mov    $0x1,%eax
+  80167e:	0f a2                	cpuid
+		return 0;
+  801680:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801685:	f6 c6 08             	test   $0x8,%dh
+  801688:	74 15                	je     80169f <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80168a:	89 c2                	mov    %eax,%edx
+  80168c:	c1 ea 08             	shr    $0x8,%edx
+  80168f:	83 e2 0f             	and    $0xf,%edx
+  801692:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801697:	83 fa 06             	cmp    $0x6,%edx
+  80169a:	74 0e                	je     8016aa <sys_env_set_stack_limit+0x7a>
+  80169c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80169f:	0f b6 c9             	movzbl %cl,%ecx
+  8016a2:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8016a8:	eb 98                	jmp    801642 <sys_env_set_stack_limit+0x12>
+  8016aa:	89 c2                	mov    %eax,%edx
+  8016ac:	c1 ea 04             	shr    $0x4,%edx
+  8016af:	83 e2 0f             	and    $0xf,%edx
+  8016b2:	83 fa 02             	cmp    $0x2,%edx
+  8016b5:	77 e5                	ja     80169c <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  8016b7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016ba:	83 f8 02             	cmp    $0x2,%eax
+  8016bd:	0f 97 c1             	seta   %cl
+  8016c0:	0f b6 c9             	movzbl %cl,%ecx
+  8016c3:	eb d7                	jmp    80169c <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  8016c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016ca:	b8 19 00 00 00       	mov    $0x19,%eax
+  8016cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016d5:	89 df                	mov    %ebx,%edi
+  8016d7:	89 de                	mov    %ebx,%esi
+  8016d9:	cd 30                	int    $0x30
+  8016db:	eb 90                	jmp    80166d <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016dd:	83 ec 0c             	sub    $0xc,%esp
+  8016e0:	50                   	push   %eax
+  8016e1:	6a 19                	push   $0x19
+  8016e3:	68 79 2c 80 00       	push   $0x802c79
+  8016e8:	6a 4a                	push   $0x4a
+  8016ea:	68 96 2c 80 00       	push   $0x802c96
+  8016ef:	e8 c0 0f 00 00       	call   8026b4 <_panic>
+
+008016f4 <sys_env_set_pgfault_upcall>:
+{
+  8016f4:	55                   	push   %ebp
+  8016f5:	89 e5                	mov    %esp,%ebp
+  8016f7:	57                   	push   %edi
+  8016f8:	56                   	push   %esi
+  8016f9:	53                   	push   %ebx
+  8016fa:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8016fd:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801704:	78 37                	js     80173d <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  801706:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80170d:	74 7a                	je     801789 <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  80170f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801714:	8b 55 08             	mov    0x8(%ebp),%edx
+  801717:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80171a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80171f:	89 df                	mov    %ebx,%edi
+  801721:	89 de                	mov    %ebx,%esi
+  801723:	55                   	push   %ebp
+  801724:	68 2d 17 80 00       	push   $0x80172d
+  801729:	89 e5                	mov    %esp,%ebp
+  80172b:	0f 34                	sysenter
+  80172d:	83 c4 04             	add    $0x4,%esp
+  801730:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801731:	85 c0                	test   %eax,%eax
+  801733:	7f 6c                	jg     8017a1 <sys_env_set_pgfault_upcall+0xad>
+}
+  801735:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801738:	5b                   	pop    %ebx
+  801739:	5e                   	pop    %esi
+  80173a:	5f                   	pop    %edi
+  80173b:	5d                   	pop    %ebp
+  80173c:	c3                   	ret
+  80173d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801742:	0f a2                	cpuid
+		return 0;
+  801744:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801749:	f6 c6 08             	test   $0x8,%dh
+  80174c:	74 15                	je     801763 <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80174e:	89 c2                	mov    %eax,%edx
+  801750:	c1 ea 08             	shr    $0x8,%edx
+  801753:	83 e2 0f             	and    $0xf,%edx
+  801756:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80175b:	83 fa 06             	cmp    $0x6,%edx
+  80175e:	74 0e                	je     80176e <sys_env_set_pgfault_upcall+0x7a>
+  801760:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801763:	0f b6 c9             	movzbl %cl,%ecx
+  801766:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80176c:	eb 98                	jmp    801706 <sys_env_set_pgfault_upcall+0x12>
+  80176e:	89 c2                	mov    %eax,%edx
+  801770:	c1 ea 04             	shr    $0x4,%edx
+  801773:	83 e2 0f             	and    $0xf,%edx
+  801776:	83 fa 02             	cmp    $0x2,%edx
+  801779:	77 e5                	ja     801760 <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  80177b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80177e:	83 f8 02             	cmp    $0x2,%eax
+  801781:	0f 97 c1             	seta   %cl
+  801784:	0f b6 c9             	movzbl %cl,%ecx
+  801787:	eb d7                	jmp    801760 <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  801789:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80178e:	b8 09 00 00 00       	mov    $0x9,%eax
+  801793:	8b 55 08             	mov    0x8(%ebp),%edx
+  801796:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801799:	89 df                	mov    %ebx,%edi
+  80179b:	89 de                	mov    %ebx,%esi
+  80179d:	cd 30                	int    $0x30
+  80179f:	eb 90                	jmp    801731 <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017a1:	83 ec 0c             	sub    $0xc,%esp
+  8017a4:	50                   	push   %eax
+  8017a5:	6a 09                	push   $0x9
+  8017a7:	68 79 2c 80 00       	push   $0x802c79
+  8017ac:	6a 4a                	push   $0x4a
+  8017ae:	68 96 2c 80 00       	push   $0x802c96
+  8017b3:	e8 fc 0e 00 00       	call   8026b4 <_panic>
+
+008017b8 <sys_ipc_try_send>:
+{
+  8017b8:	55                   	push   %ebp
+  8017b9:	89 e5                	mov    %esp,%ebp
+  8017bb:	57                   	push   %edi
+  8017bc:	56                   	push   %esi
+  8017bd:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8017be:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8017c5:	78 32                	js     8017f9 <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  8017c7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8017ce:	74 75                	je     801845 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  8017d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017d6:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8017db:	be 00 00 00 00       	mov    $0x0,%esi
+  8017e0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017e3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8017e6:	55                   	push   %ebp
+  8017e7:	68 f0 17 80 00       	push   $0x8017f0
+  8017ec:	89 e5                	mov    %esp,%ebp
+  8017ee:	0f 34                	sysenter
+  8017f0:	83 c4 04             	add    $0x4,%esp
+  8017f3:	5d                   	pop    %ebp
+}
+  8017f4:	5b                   	pop    %ebx
+  8017f5:	5e                   	pop    %esi
+  8017f6:	5f                   	pop    %edi
+  8017f7:	5d                   	pop    %ebp
+  8017f8:	c3                   	ret
+  8017f9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8017fe:	0f a2                	cpuid
+		return 0;
+  801800:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801805:	f6 c6 08             	test   $0x8,%dh
+  801808:	74 15                	je     80181f <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80180a:	89 c2                	mov    %eax,%edx
+  80180c:	c1 ea 08             	shr    $0x8,%edx
+  80180f:	83 e2 0f             	and    $0xf,%edx
+  801812:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801817:	83 fa 06             	cmp    $0x6,%edx
+  80181a:	74 0e                	je     80182a <sys_ipc_try_send+0x72>
+  80181c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80181f:	0f b6 c9             	movzbl %cl,%ecx
+  801822:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801828:	eb 9d                	jmp    8017c7 <sys_ipc_try_send+0xf>
+  80182a:	89 c2                	mov    %eax,%edx
+  80182c:	c1 ea 04             	shr    $0x4,%edx
+  80182f:	83 e2 0f             	and    $0xf,%edx
+  801832:	83 fa 02             	cmp    $0x2,%edx
+  801835:	77 e5                	ja     80181c <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  801837:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80183a:	83 f8 02             	cmp    $0x2,%eax
+  80183d:	0f 97 c1             	seta   %cl
+  801840:	0f b6 c9             	movzbl %cl,%ecx
+  801843:	eb d7                	jmp    80181c <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  801845:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80184a:	be 00 00 00 00       	mov    $0x0,%esi
+  80184f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801852:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801855:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801858:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80185b:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  80185d:	eb 95                	jmp    8017f4 <sys_ipc_try_send+0x3c>
+
+0080185f <sys_ipc_send>:
+{
+  80185f:	55                   	push   %ebp
+  801860:	89 e5                	mov    %esp,%ebp
+  801862:	57                   	push   %edi
+  801863:	56                   	push   %esi
+  801864:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801865:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80186c:	78 32                	js     8018a0 <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  80186e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801875:	74 75                	je     8018ec <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801877:	8b 55 08             	mov    0x8(%ebp),%edx
+  80187a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80187d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801882:	be 00 00 00 00       	mov    $0x0,%esi
+  801887:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80188a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80188d:	55                   	push   %ebp
+  80188e:	68 97 18 80 00       	push   $0x801897
+  801893:	89 e5                	mov    %esp,%ebp
+  801895:	0f 34                	sysenter
+  801897:	83 c4 04             	add    $0x4,%esp
+  80189a:	5d                   	pop    %ebp
+}
+  80189b:	5b                   	pop    %ebx
+  80189c:	5e                   	pop    %esi
+  80189d:	5f                   	pop    %edi
+  80189e:	5d                   	pop    %ebp
+  80189f:	c3                   	ret
+  8018a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018a5:	0f a2                	cpuid
+		return 0;
+  8018a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018ac:	f6 c6 08             	test   $0x8,%dh
+  8018af:	74 15                	je     8018c6 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018b1:	89 c2                	mov    %eax,%edx
+  8018b3:	c1 ea 08             	shr    $0x8,%edx
+  8018b6:	83 e2 0f             	and    $0xf,%edx
+  8018b9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018be:	83 fa 06             	cmp    $0x6,%edx
+  8018c1:	74 0e                	je     8018d1 <sys_ipc_send+0x72>
+  8018c3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8018c6:	0f b6 c9             	movzbl %cl,%ecx
+  8018c9:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8018cf:	eb 9d                	jmp    80186e <sys_ipc_send+0xf>
+  8018d1:	89 c2                	mov    %eax,%edx
+  8018d3:	c1 ea 04             	shr    $0x4,%edx
+  8018d6:	83 e2 0f             	and    $0xf,%edx
+  8018d9:	83 fa 02             	cmp    $0x2,%edx
+  8018dc:	77 e5                	ja     8018c3 <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  8018de:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018e1:	83 f8 02             	cmp    $0x2,%eax
+  8018e4:	0f 97 c1             	seta   %cl
+  8018e7:	0f b6 c9             	movzbl %cl,%ecx
+  8018ea:	eb d7                	jmp    8018c3 <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  8018ec:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8018f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8018f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018ff:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801902:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801904:	eb 95                	jmp    80189b <sys_ipc_send+0x3c>
+
+00801906 <sys_ipc_recv>:
+{
+  801906:	55                   	push   %ebp
+  801907:	89 e5                	mov    %esp,%ebp
+  801909:	57                   	push   %edi
+  80190a:	56                   	push   %esi
+  80190b:	53                   	push   %ebx
+  80190c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80190f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801916:	78 36                	js     80194e <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  801918:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80191f:	74 79                	je     80199a <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  801921:	8b 55 08             	mov    0x8(%ebp),%edx
+  801924:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801929:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80192e:	89 cb                	mov    %ecx,%ebx
+  801930:	89 cf                	mov    %ecx,%edi
+  801932:	89 ce                	mov    %ecx,%esi
+  801934:	55                   	push   %ebp
+  801935:	68 3e 19 80 00       	push   $0x80193e
+  80193a:	89 e5                	mov    %esp,%ebp
+  80193c:	0f 34                	sysenter
+  80193e:	83 c4 04             	add    $0x4,%esp
+  801941:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801942:	85 c0                	test   %eax,%eax
+  801944:	7f 6b                	jg     8019b1 <sys_ipc_recv+0xab>
+}
+  801946:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801949:	5b                   	pop    %ebx
+  80194a:	5e                   	pop    %esi
+  80194b:	5f                   	pop    %edi
+  80194c:	5d                   	pop    %ebp
+  80194d:	c3                   	ret
+  80194e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801953:	0f a2                	cpuid
+		return 0;
+  801955:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80195a:	f6 c6 08             	test   $0x8,%dh
+  80195d:	74 15                	je     801974 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80195f:	89 c2                	mov    %eax,%edx
+  801961:	c1 ea 08             	shr    $0x8,%edx
+  801964:	83 e2 0f             	and    $0xf,%edx
+  801967:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80196c:	83 fa 06             	cmp    $0x6,%edx
+  80196f:	74 0e                	je     80197f <sys_ipc_recv+0x79>
+  801971:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801974:	0f b6 c9             	movzbl %cl,%ecx
+  801977:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80197d:	eb 99                	jmp    801918 <sys_ipc_recv+0x12>
+  80197f:	89 c2                	mov    %eax,%edx
+  801981:	c1 ea 04             	shr    $0x4,%edx
+  801984:	83 e2 0f             	and    $0xf,%edx
+  801987:	83 fa 02             	cmp    $0x2,%edx
+  80198a:	77 e5                	ja     801971 <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  80198c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80198f:	83 f8 02             	cmp    $0x2,%eax
+  801992:	0f 97 c1             	seta   %cl
+  801995:	0f b6 c9             	movzbl %cl,%ecx
+  801998:	eb d7                	jmp    801971 <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  80199a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80199f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8019a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019a7:	89 cb                	mov    %ecx,%ebx
+  8019a9:	89 cf                	mov    %ecx,%edi
+  8019ab:	89 ce                	mov    %ecx,%esi
+  8019ad:	cd 30                	int    $0x30
+  8019af:	eb 91                	jmp    801942 <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8019b1:	83 ec 0c             	sub    $0xc,%esp
+  8019b4:	50                   	push   %eax
+  8019b5:	6a 0d                	push   $0xd
+  8019b7:	68 79 2c 80 00       	push   $0x802c79
+  8019bc:	6a 4a                	push   $0x4a
+  8019be:	68 96 2c 80 00       	push   $0x802c96
+  8019c3:	e8 ec 0c 00 00       	call   8026b4 <_panic>
+
+008019c8 <sys_ipc_send_range>:
+{
+  8019c8:	55                   	push   %ebp
+  8019c9:	89 e5                	mov    %esp,%ebp
+  8019cb:	57                   	push   %edi
+  8019cc:	56                   	push   %esi
+  8019cd:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8019ce:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8019d5:	78 30                	js     801a07 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  8019d7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8019de:	74 73                	je     801a53 <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  8019e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019e6:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8019eb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019ee:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8019f1:	8b 75 18             	mov    0x18(%ebp),%esi
+  8019f4:	55                   	push   %ebp
+  8019f5:	68 fe 19 80 00       	push   $0x8019fe
+  8019fa:	89 e5                	mov    %esp,%ebp
+  8019fc:	0f 34                	sysenter
+  8019fe:	83 c4 04             	add    $0x4,%esp
+  801a01:	5d                   	pop    %ebp
+}
+  801a02:	5b                   	pop    %ebx
+  801a03:	5e                   	pop    %esi
+  801a04:	5f                   	pop    %edi
+  801a05:	5d                   	pop    %ebp
+  801a06:	c3                   	ret
+  801a07:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a0c:	0f a2                	cpuid
+		return 0;
+  801a0e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801a13:	f6 c6 08             	test   $0x8,%dh
+  801a16:	74 15                	je     801a2d <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a18:	89 c2                	mov    %eax,%edx
+  801a1a:	c1 ea 08             	shr    $0x8,%edx
+  801a1d:	83 e2 0f             	and    $0xf,%edx
+  801a20:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a25:	83 fa 06             	cmp    $0x6,%edx
+  801a28:	74 0e                	je     801a38 <sys_ipc_send_range+0x70>
+  801a2a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a2d:	0f b6 c9             	movzbl %cl,%ecx
+  801a30:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801a36:	eb 9f                	jmp    8019d7 <sys_ipc_send_range+0xf>
+  801a38:	89 c2                	mov    %eax,%edx
+  801a3a:	c1 ea 04             	shr    $0x4,%edx
+  801a3d:	83 e2 0f             	and    $0xf,%edx
+  801a40:	83 fa 02             	cmp    $0x2,%edx
+  801a43:	77 e5                	ja     801a2a <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  801a45:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a48:	83 f8 02             	cmp    $0x2,%eax
+  801a4b:	0f 97 c1             	seta   %cl
+  801a4e:	0f b6 c9             	movzbl %cl,%ecx
+  801a51:	eb d7                	jmp    801a2a <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  801a53:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801a58:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a5b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a5e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a61:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a64:	8b 75 18             	mov    0x18(%ebp),%esi
+  801a67:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  801a69:	eb 97                	jmp    801a02 <sys_ipc_send_range+0x3a>
+
+00801a6b <sys_ipc_recv_range>:
+{
+  801a6b:	55                   	push   %ebp
+  801a6c:	89 e5                	mov    %esp,%ebp
+  801a6e:	57                   	push   %edi
+  801a6f:	56                   	push   %esi
+  801a70:	53                   	push   %ebx
+  801a71:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801a74:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801a7b:	78 37                	js     801ab4 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  801a7d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801a84:	74 7a                	je     801b00 <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  801a86:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a8b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a8e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a91:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801a96:	89 df                	mov    %ebx,%edi
+  801a98:	89 de                	mov    %ebx,%esi
+  801a9a:	55                   	push   %ebp
+  801a9b:	68 a4 1a 80 00       	push   $0x801aa4
+  801aa0:	89 e5                	mov    %esp,%ebp
+  801aa2:	0f 34                	sysenter
+  801aa4:	83 c4 04             	add    $0x4,%esp
+  801aa7:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801aa8:	85 c0                	test   %eax,%eax
+  801aaa:	7f 6c                	jg     801b18 <sys_ipc_recv_range+0xad>
+}
+  801aac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aaf:	5b                   	pop    %ebx
+  801ab0:	5e                   	pop    %esi
+  801ab1:	5f                   	pop    %edi
+  801ab2:	5d                   	pop    %ebp
+  801ab3:	c3                   	ret
+  801ab4:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ab9:	0f a2                	cpuid
+		return 0;
+  801abb:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801ac0:	f6 c6 08             	test   $0x8,%dh
+  801ac3:	74 15                	je     801ada <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ac5:	89 c2                	mov    %eax,%edx
+  801ac7:	c1 ea 08             	shr    $0x8,%edx
+  801aca:	83 e2 0f             	and    $0xf,%edx
+  801acd:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ad2:	83 fa 06             	cmp    $0x6,%edx
+  801ad5:	74 0e                	je     801ae5 <sys_ipc_recv_range+0x7a>
+  801ad7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801ada:	0f b6 c9             	movzbl %cl,%ecx
+  801add:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801ae3:	eb 98                	jmp    801a7d <sys_ipc_recv_range+0x12>
+  801ae5:	89 c2                	mov    %eax,%edx
+  801ae7:	c1 ea 04             	shr    $0x4,%edx
+  801aea:	83 e2 0f             	and    $0xf,%edx
+  801aed:	83 fa 02             	cmp    $0x2,%edx
+  801af0:	77 e5                	ja     801ad7 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801af2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801af5:	83 f8 02             	cmp    $0x2,%eax
+  801af8:	0f 97 c1             	seta   %cl
+  801afb:	0f b6 c9             	movzbl %cl,%ecx
+  801afe:	eb d7                	jmp    801ad7 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801b00:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b05:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801b0a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b0d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b10:	89 df                	mov    %ebx,%edi
+  801b12:	89 de                	mov    %ebx,%esi
+  801b14:	cd 30                	int    $0x30
+  801b16:	eb 90                	jmp    801aa8 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801b18:	83 ec 0c             	sub    $0xc,%esp
+  801b1b:	50                   	push   %eax
+  801b1c:	6a 1f                	push   $0x1f
+  801b1e:	68 79 2c 80 00       	push   $0x802c79
+  801b23:	6a 4a                	push   $0x4a
+  801b25:	68 96 2c 80 00       	push   $0x802c96
+  801b2a:	e8 85 0b 00 00       	call   8026b4 <_panic>
+
+00801b2f <sys_ipc_call>:
+{
+  801b2f:	55                   	push   %ebp
+  801b30:	89 e5                	mov    %esp,%ebp
+  801b32:	57                   	push   %edi
+  801b33:	56                   	push   %esi
+  801b34:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801b35:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b38:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801b3d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b40:	55                   	push   %ebp
+  801b41:	56                   	push   %esi
+  801b42:	8b 0e                	mov    (%esi),%ecx
+  801b44:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801b47:	8b 7e 08             	mov    0x8(%esi),%edi
+  801b4a:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801b4d:	8b 76 0c             	mov    0xc(%esi),%esi
+  801b50:	cd 30                	int    $0x30
+  801b52:	87 34 24             	xchg   %esi,(%esp)
+  801b55:	89 0e                	mov    %ecx,(%esi)
+  801b57:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801b5a:	89 7e 08             	mov    %edi,0x8(%esi)
+  801b5d:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801b60:	8f 46 0c             	pop    0xc(%esi)
+  801b63:	5d                   	pop    %ebp
+}
+  801b64:	5b                   	pop    %ebx
+  801b65:	5e                   	pop    %esi
+  801b66:	5f                   	pop    %edi
+  801b67:	5d                   	pop    %ebp
+  801b68:	c3                   	ret
+
+00801b69 <sys_ipc_reply_wait>:
+{
+  801b69:	55                   	push   %ebp
+  801b6a:	89 e5                	mov    %esp,%ebp
+  801b6c:	57                   	push   %edi
+  801b6d:	56                   	push   %esi
+  801b6e:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801b6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b72:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801b77:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b7a:	55                   	push   %ebp
+  801b7b:	56                   	push   %esi
+  801b7c:	8b 0e                	mov    (%esi),%ecx
+  801b7e:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801b81:	8b 7e 08             	mov    0x8(%esi),%edi
+  801b84:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801b87:	8b 76 0c             	mov    0xc(%esi),%esi
+  801b8a:	cd 30                	int    $0x30
+  801b8c:	87 34 24             	xchg   %esi,(%esp)
+  801b8f:	89 0e                	mov    %ecx,(%esi)
+  801b91:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801b94:	89 7e 08             	mov    %edi,0x8(%esi)
+  801b97:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801b9a:	8f 46 0c             	pop    0xc(%esi)
+  801b9d:	5d                   	pop    %ebp
+}
+  801b9e:	5b                   	pop    %ebx
+  801b9f:	5e                   	pop    %esi
+  801ba0:	5f                   	pop    %edi
+  801ba1:	5d                   	pop    %ebp
+  801ba2:	c3                   	ret
+
+00801ba3 <sys_ipc_send_msg>:
+{
+  801ba3:	55                   	push   %ebp
+  801ba4:	89 e5                	mov    %esp,%ebp
+  801ba6:	57                   	push   %edi
+  801ba7:	56                   	push   %esi
+  801ba8:	53                   	push   %ebx
+  801ba9:	83 ec 20             	sub    $0x20,%esp
+  801bac:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801baf:	8b 10                	mov    (%eax),%edx
+  801bb1:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801bb4:	8b 50 04             	mov    0x4(%eax),%edx
+  801bb7:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801bba:	8b 50 08             	mov    0x8(%eax),%edx
+  801bbd:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801bc0:	8b 50 0c             	mov    0xc(%eax),%edx
+  801bc3:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801bc6:	8b 40 10             	mov    0x10(%eax),%eax
+  801bc9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801bcc:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801bcf:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bd2:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801bd7:	55                   	push   %ebp
+  801bd8:	56                   	push   %esi
+  801bd9:	8b 0e                	mov    (%esi),%ecx
+  801bdb:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801bde:	8b 7e 08             	mov    0x8(%esi),%edi
+  801be1:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801be4:	8b 76 0c             	mov    0xc(%esi),%esi
+  801be7:	cd 30                	int    $0x30
+  801be9:	87 34 24             	xchg   %esi,(%esp)
+  801bec:	89 0e                	mov    %ecx,(%esi)
+  801bee:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801bf1:	89 7e 08             	mov    %edi,0x8(%esi)
+  801bf4:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801bf7:	8f 46 0c             	pop    0xc(%esi)
+  801bfa:	5d                   	pop    %ebp
+}
+  801bfb:	83 c4 20             	add    $0x20,%esp
+  801bfe:	5b                   	pop    %ebx
+  801bff:	5e                   	pop    %esi
+  801c00:	5f                   	pop    %edi
+  801c01:	5d                   	pop    %ebp
+  801c02:	c3                   	ret
+
+00801c03 <sys_fork>:
+{
+  801c03:	55                   	push   %ebp
+  801c04:	89 e5                	mov    %esp,%ebp
+  801c06:	57                   	push   %edi
+  801c07:	56                   	push   %esi
+  801c08:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801c09:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801c10:	78 2e                	js     801c40 <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801c12:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801c19:	74 71                	je     801c8c <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801c1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c20:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801c25:	89 d1                	mov    %edx,%ecx
+  801c27:	89 d3                	mov    %edx,%ebx
+  801c29:	89 d7                	mov    %edx,%edi
+  801c2b:	89 d6                	mov    %edx,%esi
+  801c2d:	55                   	push   %ebp
+  801c2e:	68 37 1c 80 00       	push   $0x801c37
+  801c33:	89 e5                	mov    %esp,%ebp
+  801c35:	0f 34                	sysenter
+  801c37:	83 c4 04             	add    $0x4,%esp
+  801c3a:	5d                   	pop    %ebp
+}
+  801c3b:	5b                   	pop    %ebx
+  801c3c:	5e                   	pop    %esi
+  801c3d:	5f                   	pop    %edi
+  801c3e:	5d                   	pop    %ebp
+  801c3f:	c3                   	ret
+  801c40:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c45:	0f a2                	cpuid
+		return 0;
+  801c47:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801c4c:	f6 c6 08             	test   $0x8,%dh
+  801c4f:	74 15                	je     801c66 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c51:	89 c2                	mov    %eax,%edx
+  801c53:	c1 ea 08             	shr    $0x8,%edx
+  801c56:	83 e2 0f             	and    $0xf,%edx
+  801c59:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801c5e:	83 fa 06             	cmp    $0x6,%edx
+  801c61:	74 0e                	je     801c71 <sys_fork+0x6e>
+  801c63:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801c66:	0f b6 c9             	movzbl %cl,%ecx
+  801c69:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801c6f:	eb a1                	jmp    801c12 <sys_fork+0xf>
+  801c71:	89 c2                	mov    %eax,%edx
+  801c73:	c1 ea 04             	shr    $0x4,%edx
+  801c76:	83 e2 0f             	and    $0xf,%edx
+  801c79:	83 fa 02             	cmp    $0x2,%edx
+  801c7c:	77 e5                	ja     801c63 <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801c7e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c81:	83 f8 02             	cmp    $0x2,%eax
+  801c84:	0f 97 c1             	seta   %cl
+  801c87:	0f b6 c9             	movzbl %cl,%ecx
+  801c8a:	eb d7                	jmp    801c63 <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801c8c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c91:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801c96:	89 d1                	mov    %edx,%ecx
+  801c98:	89 d3                	mov    %edx,%ebx
+  801c9a:	89 d7                	mov    %edx,%edi
+  801c9c:	89 d6                	mov    %edx,%esi
+  801c9e:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801ca0:	eb 99                	jmp    801c3b <sys_fork+0x38>
+
+00801ca2 <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801ca2:	55                   	push   %ebp
+  801ca3:	89 e5                	mov    %esp,%ebp
+  801ca5:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801ca8:	ff 75 14             	push   0x14(%ebp)
+  801cab:	ff 75 10             	push   0x10(%ebp)
+  801cae:	ff 75 0c             	push   0xc(%ebp)
+  801cb1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cb6:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cb9:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801cbe:	e8 81 ee ff ff       	call   800b44 <page_vec_call>
+}
+  801cc3:	c9                   	leave
+  801cc4:	c3                   	ret
+
+00801cc5 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801cc5:	55                   	push   %ebp
+  801cc6:	89 e5                	mov    %esp,%ebp
+  801cc8:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801ccb:	ff 75 18             	push   0x18(%ebp)
+  801cce:	ff 75 14             	push   0x14(%ebp)
+  801cd1:	ff 75 10             	push   0x10(%ebp)
+  801cd4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cd7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cda:	b8 10 00 00 00       	mov    $0x10,%eax
+  801cdf:	e8 60 ee ff ff       	call   800b44 <page_vec_call>
+}
+  801ce4:	c9                   	leave
+  801ce5:	c3                   	ret
+
+00801ce6 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801ce6:	55                   	push   %ebp
+  801ce7:	89 e5                	mov    %esp,%ebp
+  801ce9:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801cec:	ff 75 14             	push   0x14(%ebp)
+  801cef:	ff 75 10             	push   0x10(%ebp)
+  801cf2:	ff 75 0c             	push   0xc(%ebp)
+  801cf5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cfa:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cfd:	b8 11 00 00 00       	mov    $0x11,%eax
+  801d02:	e8 3d ee ff ff       	call   800b44 <page_vec_call>
+}
+  801d07:	c9                   	leave
+  801d08:	c3                   	ret
+
+00801d09 <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801d09:	55                   	push   %ebp
+  801d0a:	89 e5                	mov    %esp,%ebp
+  801d0c:	57                   	push   %edi
+  801d0d:	56                   	push   %esi
+  801d0e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801d0f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801d16:	78 32                	js     801d4a <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801d18:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801d1f:	74 75                	je     801d96 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801d21:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d27:	b8 12 00 00 00       	mov    $0x12,%eax
+  801d2c:	be 00 00 00 00       	mov    $0x0,%esi
+  801d31:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d34:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801d37:	55                   	push   %ebp
+  801d38:	68 41 1d 80 00       	push   $0x801d41
+  801d3d:	89 e5                	mov    %esp,%ebp
+  801d3f:	0f 34                	sysenter
+  801d41:	83 c4 04             	add    $0x4,%esp
+  801d44:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801d45:	5b                   	pop    %ebx
+  801d46:	5e                   	pop    %esi
+  801d47:	5f                   	pop    %edi
+  801d48:	5d                   	pop    %ebp
+  801d49:	c3                   	ret
+  801d4a:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d4f:	0f a2                	cpuid
+		return 0;
+  801d51:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801d56:	f6 c6 08             	test   $0x8,%dh
+  801d59:	74 15                	je     801d70 <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d5b:	89 c2                	mov    %eax,%edx
+  801d5d:	c1 ea 08             	shr    $0x8,%edx
+  801d60:	83 e2 0f             	and    $0xf,%edx
+  801d63:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d68:	83 fa 06             	cmp    $0x6,%edx
+  801d6b:	74 0e                	je     801d7b <sys_vm_ranges+0x72>
+  801d6d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801d70:	0f b6 c9             	movzbl %cl,%ecx
+  801d73:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801d79:	eb 9d                	jmp    801d18 <sys_vm_ranges+0xf>
+  801d7b:	89 c2                	mov    %eax,%edx
+  801d7d:	c1 ea 04             	shr    $0x4,%edx
+  801d80:	83 e2 0f             	and    $0xf,%edx
+  801d83:	83 fa 02             	cmp    $0x2,%edx
+  801d86:	77 e5                	ja     801d6d <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  801d88:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d8b:	83 f8 02             	cmp    $0x2,%eax
+  801d8e:	0f 97 c1             	seta   %cl
+  801d91:	0f b6 c9             	movzbl %cl,%ecx
+  801d94:	eb d7                	jmp    801d6d <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801d96:	b8 12 00 00 00       	mov    $0x12,%eax
+  801d9b:	be 00 00 00 00       	mov    $0x0,%esi
+  801da0:	8b 55 08             	mov    0x8(%ebp),%edx
+  801da3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801da6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801da9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801dac:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801dae:	eb 95                	jmp    801d45 <sys_vm_ranges+0x3c>
+
+00801db0 <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801db0:	55                   	push   %ebp
+  801db1:	89 e5                	mov    %esp,%ebp
+  801db3:	57                   	push   %edi
+  801db4:	56                   	push   %esi
+  801db5:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801db6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801dbd:	78 31                	js     801df0 <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801dbf:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801dc6:	74 74                	je     801e3c <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801dc8:	be 00 00 00 00       	mov    $0x0,%esi
+  801dcd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801dd0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801dd3:	b8 14 00 00 00       	mov    $0x14,%eax
+  801dd8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ddb:	89 f7                	mov    %esi,%edi
+  801ddd:	55                   	push   %ebp
+  801dde:	68 e7 1d 80 00       	push   $0x801de7
+  801de3:	89 e5                	mov    %esp,%ebp
+  801de5:	0f 34                	sysenter
+  801de7:	83 c4 04             	add    $0x4,%esp
+  801dea:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801deb:	5b                   	pop    %ebx
+  801dec:	5e                   	pop    %esi
+  801ded:	5f                   	pop    %edi
+  801dee:	5d                   	pop    %ebp
+  801def:	c3                   	ret
+  801df0:	b8 01 00 00 00       	mov    $0x1,%eax
+  801df5:	0f a2                	cpuid
+		return 0;
+  801df7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801dfc:	f6 c6 08             	test   $0x8,%dh
+  801dff:	74 15                	je     801e16 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e01:	89 c2                	mov    %eax,%edx
+  801e03:	c1 ea 08             	shr    $0x8,%edx
+  801e06:	83 e2 0f             	and    $0xf,%edx
+  801e09:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e0e:	83 fa 06             	cmp    $0x6,%edx
+  801e11:	74 0e                	je     801e21 <sys_spawn+0x71>
+  801e13:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801e16:	0f b6 c9             	movzbl %cl,%ecx
+  801e19:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801e1f:	eb 9e                	jmp    801dbf <sys_spawn+0xf>
+  801e21:	89 c2                	mov    %eax,%edx
+  801e23:	c1 ea 04             	shr    $0x4,%edx
+  801e26:	83 e2 0f             	and    $0xf,%edx
+  801e29:	83 fa 02             	cmp    $0x2,%edx
+  801e2c:	77 e5                	ja     801e13 <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  801e2e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e31:	83 f8 02             	cmp    $0x2,%eax
+  801e34:	0f 97 c1             	seta   %cl
+  801e37:	0f b6 c9             	movzbl %cl,%ecx
+  801e3a:	eb d7                	jmp    801e13 <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  801e3c:	be 00 00 00 00       	mov    $0x0,%esi
+  801e41:	b8 14 00 00 00       	mov    $0x14,%eax
+  801e46:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e49:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e4c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e4f:	89 f7                	mov    %esi,%edi
+  801e51:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  801e53:	eb 96                	jmp    801deb <sys_spawn+0x3b>
+
+00801e55 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  801e55:	55                   	push   %ebp
+  801e56:	89 e5                	mov    %esp,%ebp
+  801e58:	57                   	push   %edi
+  801e59:	56                   	push   %esi
+  801e5a:	53                   	push   %ebx
+  801e5b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801e5e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801e65:	78 37                	js     801e9e <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  801e67:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801e6e:	74 7a                	je     801eea <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  801e70:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e75:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e78:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e7b:	b8 15 00 00 00       	mov    $0x15,%eax
+  801e80:	89 df                	mov    %ebx,%edi
+  801e82:	89 de                	mov    %ebx,%esi
+  801e84:	55                   	push   %ebp
+  801e85:	68 8e 1e 80 00       	push   $0x801e8e
+  801e8a:	89 e5                	mov    %esp,%ebp
+  801e8c:	0f 34                	sysenter
+  801e8e:	83 c4 04             	add    $0x4,%esp
+  801e91:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801e92:	85 c0                	test   %eax,%eax
+  801e94:	7f 6c                	jg     801f02 <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  801e96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e99:	5b                   	pop    %ebx
+  801e9a:	5e                   	pop    %esi
+  801e9b:	5f                   	pop    %edi
+  801e9c:	5d                   	pop    %ebp
+  801e9d:	c3                   	ret
+  801e9e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ea3:	0f a2                	cpuid
+		return 0;
+  801ea5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801eaa:	f6 c6 08             	test   $0x8,%dh
+  801ead:	74 15                	je     801ec4 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801eaf:	89 c2                	mov    %eax,%edx
+  801eb1:	c1 ea 08             	shr    $0x8,%edx
+  801eb4:	83 e2 0f             	and    $0xf,%edx
+  801eb7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ebc:	83 fa 06             	cmp    $0x6,%edx
+  801ebf:	74 0e                	je     801ecf <sys_shm_create+0x7a>
+  801ec1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801ec4:	0f b6 c9             	movzbl %cl,%ecx
+  801ec7:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801ecd:	eb 98                	jmp    801e67 <sys_shm_create+0x12>
+  801ecf:	89 c2                	mov    %eax,%edx
+  801ed1:	c1 ea 04             	shr    $0x4,%edx
+  801ed4:	83 e2 0f             	and    $0xf,%edx
+  801ed7:	83 fa 02             	cmp    $0x2,%edx
+  801eda:	77 e5                	ja     801ec1 <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  801edc:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801edf:	83 f8 02             	cmp    $0x2,%eax
+  801ee2:	0f 97 c1             	seta   %cl
+  801ee5:	0f b6 c9             	movzbl %cl,%ecx
+  801ee8:	eb d7                	jmp    801ec1 <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  801eea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801eef:	b8 15 00 00 00       	mov    $0x15,%eax
+  801ef4:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ef7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801efa:	89 df                	mov    %ebx,%edi
+  801efc:	89 de                	mov    %ebx,%esi
+  801efe:	cd 30                	int    $0x30
+  801f00:	eb 90                	jmp    801e92 <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801f02:	83 ec 0c             	sub    $0xc,%esp
+  801f05:	50                   	push   %eax
+  801f06:	6a 15                	push   $0x15
+  801f08:	68 79 2c 80 00       	push   $0x802c79
+  801f0d:	6a 4a                	push   $0x4a
+  801f0f:	68 96 2c 80 00       	push   $0x802c96
+  801f14:	e8 9b 07 00 00       	call   8026b4 <_panic>
+
+00801f19 <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  801f19:	55                   	push   %ebp
+  801f1a:	89 e5                	mov    %esp,%ebp
+  801f1c:	57                   	push   %edi
+  801f1d:	56                   	push   %esi
+  801f1e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801f1f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801f26:	78 32                	js     801f5a <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  801f28:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801f2f:	74 75                	je     801fa6 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801f31:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f34:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f37:	b8 16 00 00 00       	mov    $0x16,%eax
+  801f3c:	be 00 00 00 00       	mov    $0x0,%esi
+  801f41:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f44:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801f47:	55                   	push   %ebp
+  801f48:	68 51 1f 80 00       	push   $0x801f51
+  801f4d:	89 e5                	mov    %esp,%ebp
+  801f4f:	0f 34                	sysenter
+  801f51:	83 c4 04             	add    $0x4,%esp
+  801f54:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  801f55:	5b                   	pop    %ebx
+  801f56:	5e                   	pop    %esi
+  801f57:	5f                   	pop    %edi
+  801f58:	5d                   	pop    %ebp
+  801f59:	c3                   	ret
+  801f5a:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f5f:	0f a2                	cpuid
+		return 0;
+  801f61:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801f66:	f6 c6 08             	test   $0x8,%dh
+  801f69:	74 15                	je     801f80 <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f6b:	89 c2                	mov    %eax,%edx
+  801f6d:	c1 ea 08             	shr    $0x8,%edx
+  801f70:	83 e2 0f             	and    $0xf,%edx
+  801f73:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f78:	83 fa 06             	cmp    $0x6,%edx
+  801f7b:	74 0e                	je     801f8b <sys_shm_attach+0x72>
+  801f7d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801f80:	0f b6 c9             	movzbl %cl,%ecx
+  801f83:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801f89:	eb 9d                	jmp    801f28 <sys_shm_attach+0xf>
+  801f8b:	89 c2                	mov    %eax,%edx
+  801f8d:	c1 ea 04             	shr    $0x4,%edx
+  801f90:	83 e2 0f             	and    $0xf,%edx
+  801f93:	83 fa 02             	cmp    $0x2,%edx
+  801f96:	77 e5                	ja     801f7d <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  801f98:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f9b:	83 f8 02             	cmp    $0x2,%eax
+  801f9e:	0f 97 c1             	seta   %cl
+  801fa1:	0f b6 c9             	movzbl %cl,%ecx
+  801fa4:	eb d7                	jmp    801f7d <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  801fa6:	b8 16 00 00 00       	mov    $0x16,%eax
+  801fab:	be 00 00 00 00       	mov    $0x0,%esi
+  801fb0:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fb3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fb6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801fb9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801fbc:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  801fbe:	eb 95                	jmp    801f55 <sys_shm_attach+0x3c>
+
+00801fc0 <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  801fc0:	55                   	push   %ebp
+  801fc1:	89 e5                	mov    %esp,%ebp
+  801fc3:	57                   	push   %edi
+  801fc4:	56                   	push   %esi
+  801fc5:	53                   	push   %ebx
+  801fc6:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801fc9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801fd0:	78 38                	js     80200a <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  801fd2:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801fd9:	74 7b                	je     802056 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  801fdb:	be 00 00 00 00       	mov    $0x0,%esi
+  801fe0:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fe3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fe6:	b8 17 00 00 00       	mov    $0x17,%eax
+  801feb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801fee:	89 f7                	mov    %esi,%edi
+  801ff0:	55                   	push   %ebp
+  801ff1:	68 fa 1f 80 00       	push   $0x801ffa
+  801ff6:	89 e5                	mov    %esp,%ebp
+  801ff8:	0f 34                	sysenter
+  801ffa:	83 c4 04             	add    $0x4,%esp
+  801ffd:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801ffe:	85 c0                	test   %eax,%eax
+  802000:	7f 6d                	jg     80206f <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  802002:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802005:	5b                   	pop    %ebx
+  802006:	5e                   	pop    %esi
+  802007:	5f                   	pop    %edi
+  802008:	5d                   	pop    %ebp
+  802009:	c3                   	ret
+  80200a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80200f:	0f a2                	cpuid
+		return 0;
+  802011:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802016:	f6 c6 08             	test   $0x8,%dh
+  802019:	74 15                	je     802030 <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80201b:	89 c2                	mov    %eax,%edx
+  80201d:	c1 ea 08             	shr    $0x8,%edx
+  802020:	83 e2 0f             	and    $0xf,%edx
+  802023:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802028:	83 fa 06             	cmp    $0x6,%edx
+  80202b:	74 0e                	je     80203b <sys_shm_detach+0x7b>
+  80202d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802030:	0f b6 c9             	movzbl %cl,%ecx
+  802033:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802039:	eb 97                	jmp    801fd2 <sys_shm_detach+0x12>
+  80203b:	89 c2                	mov    %eax,%edx
+  80203d:	c1 ea 04             	shr    $0x4,%edx
+  802040:	83 e2 0f             	and    $0xf,%edx
+  802043:	83 fa 02             	cmp    $0x2,%edx
+  802046:	77 e5                	ja     80202d <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  802048:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80204b:	83 f8 02             	cmp    $0x2,%eax
+  80204e:	0f 97 c1             	seta   %cl
+  802051:	0f b6 c9             	movzbl %cl,%ecx
+  802054:	eb d7                	jmp    80202d <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  802056:	be 00 00 00 00       	mov    $0x0,%esi
+  80205b:	b8 17 00 00 00       	mov    $0x17,%eax
+  802060:	8b 55 08             	mov    0x8(%ebp),%edx
+  802063:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802066:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802069:	89 f7                	mov    %esi,%edi
+  80206b:	cd 30                	int    $0x30
+  80206d:	eb 8f                	jmp    801ffe <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80206f:	83 ec 0c             	sub    $0xc,%esp
+  802072:	50                   	push   %eax
+  802073:	6a 17                	push   $0x17
+  802075:	68 79 2c 80 00       	push   $0x802c79
+  80207a:	6a 4a                	push   $0x4a
+  80207c:	68 96 2c 80 00       	push   $0x802c96
+  802081:	e8 2e 06 00 00       	call   8026b4 <_panic>
+
+00802086 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  802086:	55                   	push   %ebp
+  802087:	89 e5                	mov    %esp,%ebp
+  802089:	57                   	push   %edi
+  80208a:	56                   	push   %esi
+  80208b:	53                   	push   %ebx
+  80208c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80208f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802096:	78 36                	js     8020ce <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  802098:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80209f:	74 79                	je     80211a <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  8020a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020a9:	b8 18 00 00 00       	mov    $0x18,%eax
+  8020ae:	89 cb                	mov    %ecx,%ebx
+  8020b0:	89 cf                	mov    %ecx,%edi
+  8020b2:	89 ce                	mov    %ecx,%esi
+  8020b4:	55                   	push   %ebp
+  8020b5:	68 be 20 80 00       	push   $0x8020be
+  8020ba:	89 e5                	mov    %esp,%ebp
+  8020bc:	0f 34                	sysenter
+  8020be:	83 c4 04             	add    $0x4,%esp
+  8020c1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8020c2:	85 c0                	test   %eax,%eax
+  8020c4:	7f 6b                	jg     802131 <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  8020c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020c9:	5b                   	pop    %ebx
+  8020ca:	5e                   	pop    %esi
+  8020cb:	5f                   	pop    %edi
+  8020cc:	5d                   	pop    %ebp
+  8020cd:	c3                   	ret
+  8020ce:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020d3:	0f a2                	cpuid
+		return 0;
+  8020d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8020da:	f6 c6 08             	test   $0x8,%dh
+  8020dd:	74 15                	je     8020f4 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020df:	89 c2                	mov    %eax,%edx
+  8020e1:	c1 ea 08             	shr    $0x8,%edx
+  8020e4:	83 e2 0f             	and    $0xf,%edx
+  8020e7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8020ec:	83 fa 06             	cmp    $0x6,%edx
+  8020ef:	74 0e                	je     8020ff <sys_shm_remove+0x79>
+  8020f1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8020f4:	0f b6 c9             	movzbl %cl,%ecx
+  8020f7:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8020fd:	eb 99                	jmp    802098 <sys_shm_remove+0x12>
+  8020ff:	89 c2                	mov    %eax,%edx
+  802101:	c1 ea 04             	shr    $0x4,%edx
+  802104:	83 e2 0f             	and    $0xf,%edx
+  802107:	83 fa 02             	cmp    $0x2,%edx
+  80210a:	77 e5                	ja     8020f1 <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  80210c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80210f:	83 f8 02             	cmp    $0x2,%eax
+  802112:	0f 97 c1             	seta   %cl
+  802115:	0f b6 c9             	movzbl %cl,%ecx
+  802118:	eb d7                	jmp    8020f1 <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  80211a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80211f:	b8 18 00 00 00       	mov    $0x18,%eax
+  802124:	8b 55 08             	mov    0x8(%ebp),%edx
+  802127:	89 cb                	mov    %ecx,%ebx
+  802129:	89 cf                	mov    %ecx,%edi
+  80212b:	89 ce                	mov    %ecx,%esi
+  80212d:	cd 30                	int    $0x30
+  80212f:	eb 91                	jmp    8020c2 <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802131:	83 ec 0c             	sub    $0xc,%esp
+  802134:	50                   	push   %eax
+  802135:	6a 18                	push   $0x18
+  802137:	68 79 2c 80 00       	push   $0x802c79
+  80213c:	6a 4a                	push   $0x4a
+  80213e:	68 96 2c 80 00       	push   $0x802c96
+  802143:	e8 6c 05 00 00       	call   8026b4 <_panic>
+
+00802148 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  802148:	55                   	push   %ebp
+  802149:	89 e5                	mov    %esp,%ebp
+  80214b:	57                   	push   %edi
+  80214c:	56                   	push   %esi
+  80214d:	53                   	push   %ebx
+  80214e:	83 ec 0c             	sub    $0xc,%esp
+  802151:	8b 45 10             	mov    0x10(%ebp),%eax
+  802154:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802157:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  80215a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802161:	78 32                	js     802195 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  802163:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80216a:	74 75                	je     8021e1 <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  80216c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80216f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802172:	b8 20 00 00 00       	mov    $0x20,%eax
+  802177:	be 00 00 00 00       	mov    $0x0,%esi
+  80217c:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  80217f:	55                   	push   %ebp
+  802180:	68 89 21 80 00       	push   $0x802189
+  802185:	89 e5                	mov    %esp,%ebp
+  802187:	0f 34                	sysenter
+  802189:	83 c4 04             	add    $0x4,%esp
+  80218c:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  80218d:	83 c4 0c             	add    $0xc,%esp
+  802190:	5b                   	pop    %ebx
+  802191:	5e                   	pop    %esi
+  802192:	5f                   	pop    %edi
+  802193:	5d                   	pop    %ebp
+  802194:	c3                   	ret
+  802195:	b8 01 00 00 00       	mov    $0x1,%eax
+  80219a:	0f a2                	cpuid
+		return 0;
+  80219c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8021a1:	f6 c6 08             	test   $0x8,%dh
+  8021a4:	74 15                	je     8021bb <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021a6:	89 c2                	mov    %eax,%edx
+  8021a8:	c1 ea 08             	shr    $0x8,%edx
+  8021ab:	83 e2 0f             	and    $0xf,%edx
+  8021ae:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8021b3:	83 fa 06             	cmp    $0x6,%edx
+  8021b6:	74 0e                	je     8021c6 <sys_futex_wait+0x7e>
+  8021b8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8021bb:	0f b6 c9             	movzbl %cl,%ecx
+  8021be:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8021c4:	eb 9d                	jmp    802163 <sys_futex_wait+0x1b>
+  8021c6:	89 c2                	mov    %eax,%edx
+  8021c8:	c1 ea 04             	shr    $0x4,%edx
+  8021cb:	83 e2 0f             	and    $0xf,%edx
+  8021ce:	83 fa 02             	cmp    $0x2,%edx
+  8021d1:	77 e5                	ja     8021b8 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  8021d3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021d6:	83 f8 02             	cmp    $0x2,%eax
+  8021d9:	0f 97 c1             	seta   %cl
+  8021dc:	0f b6 c9             	movzbl %cl,%ecx
+  8021df:	eb d7                	jmp    8021b8 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  8021e1:	b8 20 00 00 00       	mov    $0x20,%eax
+  8021e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8021eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021f1:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8021f4:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  8021f6:	eb 95                	jmp    80218d <sys_futex_wait+0x45>
+
+008021f8 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8021f8:	55                   	push   %ebp
+  8021f9:	89 e5                	mov    %esp,%ebp
+  8021fb:	57                   	push   %edi
+  8021fc:	56                   	push   %esi
+  8021fd:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8021fe:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802205:	78 30                	js     802237 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  802207:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80220e:	74 73                	je     802283 <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  802210:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802215:	8b 55 08             	mov    0x8(%ebp),%edx
+  802218:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80221b:	b8 21 00 00 00       	mov    $0x21,%eax
+  802220:	89 df                	mov    %ebx,%edi
+  802222:	89 de                	mov    %ebx,%esi
+  802224:	55                   	push   %ebp
+  802225:	68 2e 22 80 00       	push   $0x80222e
+  80222a:	89 e5                	mov    %esp,%ebp
+  80222c:	0f 34                	sysenter
+  80222e:	83 c4 04             	add    $0x4,%esp
+  802231:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  802232:	5b                   	pop    %ebx
+  802233:	5e                   	pop    %esi
+  802234:	5f                   	pop    %edi
+  802235:	5d                   	pop    %ebp
+  802236:	c3                   	ret
+  802237:	b8 01 00 00 00       	mov    $0x1,%eax
+  80223c:	0f a2                	cpuid
+		return 0;
+  80223e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802243:	f6 c6 08             	test   $0x8,%dh
+  802246:	74 15                	je     80225d <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802248:	89 c2                	mov    %eax,%edx
+  80224a:	c1 ea 08             	shr    $0x8,%edx
+  80224d:	83 e2 0f             	and    $0xf,%edx
+  802250:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802255:	83 fa 06             	cmp    $0x6,%edx
+  802258:	74 0e                	je     802268 <sys_futex_wake+0x70>
+  80225a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80225d:	0f b6 c9             	movzbl %cl,%ecx
+  802260:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802266:	eb 9f                	jmp    802207 <sys_futex_wake+0xf>
+  802268:	89 c2                	mov    %eax,%edx
+  80226a:	c1 ea 04             	shr    $0x4,%edx
+  80226d:	83 e2 0f             	and    $0xf,%edx
+  802270:	83 fa 02             	cmp    $0x2,%edx
+  802273:	77 e5                	ja     80225a <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  802275:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802278:	83 f8 02             	cmp    $0x2,%eax
+  80227b:	0f 97 c1             	seta   %cl
+  80227e:	0f b6 c9             	movzbl %cl,%ecx
+  802281:	eb d7                	jmp    80225a <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  802283:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802288:	b8 21 00 00 00       	mov    $0x21,%eax
+  80228d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802290:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802293:	89 df                	mov    %ebx,%edi
+  802295:	89 de                	mov    %ebx,%esi
+  802297:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  802299:	eb 97                	jmp    802232 <sys_futex_wake+0x3a>
+
+0080229b <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  80229b:	55                   	push   %ebp
+  80229c:	89 e5                	mov    %esp,%ebp
+  80229e:	57                   	push   %edi
+  80229f:	56                   	push   %esi
+  8022a0:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8022a1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8022a8:	78 2e                	js     8022d8 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  8022aa:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8022b1:	74 71                	je     802324 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  8022b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022b8:	b8 22 00 00 00       	mov    $0x22,%eax
+  8022bd:	89 d1                	mov    %edx,%ecx
+  8022bf:	89 d3                	mov    %edx,%ebx
+  8022c1:	89 d7                	mov    %edx,%edi
+  8022c3:	89 d6                	mov    %edx,%esi
+  8022c5:	55                   	push   %ebp
+  8022c6:	68 cf 22 80 00       	push   $0x8022cf
+  8022cb:	89 e5                	mov    %esp,%ebp
+  8022cd:	0f 34                	sysenter
+  8022cf:	83 c4 04             	add    $0x4,%esp
+  8022d2:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  8022d3:	5b                   	pop    %ebx
+  8022d4:	5e                   	pop    %esi
+  8022d5:	5f                   	pop    %edi
+  8022d6:	5d                   	pop    %ebp
+  8022d7:	c3                   	ret
+  8022d8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022dd:	0f a2                	cpuid
+		return 0;
+  8022df:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8022e4:	f6 c6 08             	test   $0x8,%dh
+  8022e7:	74 15                	je     8022fe <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022e9:	89 c2                	mov    %eax,%edx
+  8022eb:	c1 ea 08             	shr    $0x8,%edx
+  8022ee:	83 e2 0f             	and    $0xf,%edx
+  8022f1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8022f6:	83 fa 06             	cmp    $0x6,%edx
+  8022f9:	74 0e                	je     802309 <sys_ep_create+0x6e>
+  8022fb:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8022fe:	0f b6 c9             	movzbl %cl,%ecx
+  802301:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802307:	eb a1                	jmp    8022aa <sys_ep_create+0xf>
+  802309:	89 c2                	mov    %eax,%edx
+  80230b:	c1 ea 04             	shr    $0x4,%edx
+  80230e:	83 e2 0f             	and    $0xf,%edx
+  802311:	83 fa 02             	cmp    $0x2,%edx
+  802314:	77 e5                	ja     8022fb <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  802316:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802319:	83 f8 02             	cmp    $0x2,%eax
+  80231c:	0f 97 c1             	seta   %cl
+  80231f:	0f b6 c9             	movzbl %cl,%ecx
+  802322:	eb d7                	jmp    8022fb <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  802324:	ba 00 00 00 00       	mov    $0x0,%edx
+  802329:	b8 22 00 00 00       	mov    $0x22,%eax
+  80232e:	89 d1                	mov    %edx,%ecx
+  802330:	89 d3                	mov    %edx,%ebx
+  802332:	89 d7                	mov    %edx,%edi
+  802334:	89 d6                	mov    %edx,%esi
+  802336:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  802338:	eb 99                	jmp    8022d3 <sys_ep_create+0x38>
+
+0080233a <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  80233a:	55                   	push   %ebp
+  80233b:	89 e5                	mov    %esp,%ebp
+  80233d:	57                   	push   %edi
+  80233e:	56                   	push   %esi
+  80233f:	53                   	push   %ebx
+  802340:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802343:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80234a:	78 36                	js     802382 <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  80234c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802353:	74 79                	je     8023ce <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  802355:	8b 55 08             	mov    0x8(%ebp),%edx
+  802358:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80235d:	b8 23 00 00 00       	mov    $0x23,%eax
+  802362:	89 cb                	mov    %ecx,%ebx
+  802364:	89 cf                	mov    %ecx,%edi
+  802366:	89 ce                	mov    %ecx,%esi
+  802368:	55                   	push   %ebp
+  802369:	68 72 23 80 00       	push   $0x802372
+  80236e:	89 e5                	mov    %esp,%ebp
+  802370:	0f 34                	sysenter
+  802372:	83 c4 04             	add    $0x4,%esp
+  802375:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802376:	85 c0                	test   %eax,%eax
+  802378:	7f 6b                	jg     8023e5 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  80237a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80237d:	5b                   	pop    %ebx
+  80237e:	5e                   	pop    %esi
+  80237f:	5f                   	pop    %edi
+  802380:	5d                   	pop    %ebp
+  802381:	c3                   	ret
+  802382:	b8 01 00 00 00       	mov    $0x1,%eax
+  802387:	0f a2                	cpuid
+		return 0;
+  802389:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80238e:	f6 c6 08             	test   $0x8,%dh
+  802391:	74 15                	je     8023a8 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802393:	89 c2                	mov    %eax,%edx
+  802395:	c1 ea 08             	shr    $0x8,%edx
+  802398:	83 e2 0f             	and    $0xf,%edx
+  80239b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8023a0:	83 fa 06             	cmp    $0x6,%edx
+  8023a3:	74 0e                	je     8023b3 <sys_ep_destroy+0x79>
+  8023a5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8023a8:	0f b6 c9             	movzbl %cl,%ecx
+  8023ab:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8023b1:	eb 99                	jmp    80234c <sys_ep_destroy+0x12>
+  8023b3:	89 c2                	mov    %eax,%edx
+  8023b5:	c1 ea 04             	shr    $0x4,%edx
+  8023b8:	83 e2 0f             	and    $0xf,%edx
+  8023bb:	83 fa 02             	cmp    $0x2,%edx
+  8023be:	77 e5                	ja     8023a5 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  8023c0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023c3:	83 f8 02             	cmp    $0x2,%eax
+  8023c6:	0f 97 c1             	seta   %cl
+  8023c9:	0f b6 c9             	movzbl %cl,%ecx
+  8023cc:	eb d7                	jmp    8023a5 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  8023ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023d3:	b8 23 00 00 00       	mov    $0x23,%eax
+  8023d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023db:	89 cb                	mov    %ecx,%ebx
+  8023dd:	89 cf                	mov    %ecx,%edi
+  8023df:	89 ce                	mov    %ecx,%esi
+  8023e1:	cd 30                	int    $0x30
+  8023e3:	eb 91                	jmp    802376 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8023e5:	83 ec 0c             	sub    $0xc,%esp
+  8023e8:	50                   	push   %eax
+  8023e9:	6a 23                	push   $0x23
+  8023eb:	68 79 2c 80 00       	push   $0x802c79
+  8023f0:	6a 4a                	push   $0x4a
+  8023f2:	68 96 2c 80 00       	push   $0x802c96
+  8023f7:	e8 b8 02 00 00       	call   8026b4 <_panic>
+
+008023fc <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  8023fc:	55                   	push   %ebp
+  8023fd:	89 e5                	mov    %esp,%ebp
+  8023ff:	57                   	push   %edi
+  802400:	56                   	push   %esi
+  802401:	53                   	push   %ebx
+  802402:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802405:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80240c:	78 37                	js     802445 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  80240e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802415:	74 7a                	je     802491 <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  802417:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80241c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80241f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802422:	b8 24 00 00 00       	mov    $0x24,%eax
+  802427:	89 df                	mov    %ebx,%edi
+  802429:	89 de                	mov    %ebx,%esi
+  80242b:	55                   	push   %ebp
+  80242c:	68 35 24 80 00       	push   $0x802435
+  802431:	89 e5                	mov    %esp,%ebp
+  802433:	0f 34                	sysenter
+  802435:	83 c4 04             	add    $0x4,%esp
+  802438:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802439:	85 c0                	test   %eax,%eax
+  80243b:	7f 6c                	jg     8024a9 <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  80243d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802440:	5b                   	pop    %ebx
+  802441:	5e                   	pop    %esi
+  802442:	5f                   	pop    %edi
+  802443:	5d                   	pop    %ebp
+  802444:	c3                   	ret
+  802445:	b8 01 00 00 00       	mov    $0x1,%eax
+  80244a:	0f a2                	cpuid
+		return 0;
+  80244c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802451:	f6 c6 08             	test   $0x8,%dh
+  802454:	74 15                	je     80246b <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802456:	89 c2                	mov    %eax,%edx
+  802458:	c1 ea 08             	shr    $0x8,%edx
+  80245b:	83 e2 0f             	and    $0xf,%edx
+  80245e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802463:	83 fa 06             	cmp    $0x6,%edx
+  802466:	74 0e                	je     802476 <sys_ep_grant+0x7a>
+  802468:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80246b:	0f b6 c9             	movzbl %cl,%ecx
+  80246e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802474:	eb 98                	jmp    80240e <sys_ep_grant+0x12>
+  802476:	89 c2                	mov    %eax,%edx
+  802478:	c1 ea 04             	shr    $0x4,%edx
+  80247b:	83 e2 0f             	and    $0xf,%edx
+  80247e:	83 fa 02             	cmp    $0x2,%edx
+  802481:	77 e5                	ja     802468 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  802483:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802486:	83 f8 02             	cmp    $0x2,%eax
+  802489:	0f 97 c1             	seta   %cl
+  80248c:	0f b6 c9             	movzbl %cl,%ecx
+  80248f:	eb d7                	jmp    802468 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  802491:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802496:	b8 24 00 00 00       	mov    $0x24,%eax
+  80249b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80249e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024a1:	89 df                	mov    %ebx,%edi
+  8024a3:	89 de                	mov    %ebx,%esi
+  8024a5:	cd 30                	int    $0x30
+  8024a7:	eb 90                	jmp    802439 <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8024a9:	83 ec 0c             	sub    $0xc,%esp
+  8024ac:	50                   	push   %eax
+  8024ad:	6a 24                	push   $0x24
+  8024af:	68 79 2c 80 00       	push   $0x802c79
+  8024b4:	6a 4a                	push   $0x4a
+  8024b6:	68 96 2c 80 00       	push   $0x802c96
+  8024bb:	e8 f4 01 00 00       	call   8026b4 <_panic>
+
+008024c0 <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  8024c0:	55                   	push   %ebp
+  8024c1:	89 e5                	mov    %esp,%ebp
+  8024c3:	57                   	push   %edi
+  8024c4:	56                   	push   %esi
+  8024c5:	53                   	push   %ebx
+  8024c6:	83 ec 20             	sub    $0x20,%esp
+  8024c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  8024cc:	8b 10                	mov    (%eax),%edx
+  8024ce:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8024d1:	8b 50 04             	mov    0x4(%eax),%edx
+  8024d4:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8024d7:	8b 50 08             	mov    0x8(%eax),%edx
+  8024da:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  8024dd:	8b 50 0c             	mov    0xc(%eax),%edx
+  8024e0:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  8024e3:	8b 40 10             	mov    0x10(%eax),%eax
+  8024e6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  8024e9:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  8024ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024ef:	b8 25 00 00 00       	mov    $0x25,%eax
+  8024f4:	55                   	push   %ebp
+  8024f5:	56                   	push   %esi
+  8024f6:	8b 0e                	mov    (%esi),%ecx
+  8024f8:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8024fb:	8b 7e 08             	mov    0x8(%esi),%edi
+  8024fe:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802501:	8b 76 0c             	mov    0xc(%esi),%esi
+  802504:	cd 30                	int    $0x30
+  802506:	87 34 24             	xchg   %esi,(%esp)
+  802509:	89 0e                	mov    %ecx,(%esi)
+  80250b:	89 5e 04             	mov    %ebx,0x4(%esi)
+  80250e:	89 7e 08             	mov    %edi,0x8(%esi)
+  802511:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802514:	8f 46 0c             	pop    0xc(%esi)
+  802517:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  802518:	83 c4 20             	add    $0x20,%esp
+  80251b:	5b                   	pop    %ebx
+  80251c:	5e                   	pop    %esi
+  80251d:	5f                   	pop    %edi
+  80251e:	5d                   	pop    %ebp
+  80251f:	c3                   	ret
+
+00802520 <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  802520:	55                   	push   %ebp
+  802521:	89 e5                	mov    %esp,%ebp
+  802523:	57                   	push   %edi
+  802524:	56                   	push   %esi
+  802525:	53                   	push   %ebx
+  802526:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  802529:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80252c:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  80252e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802531:	b8 26 00 00 00       	mov    $0x26,%eax
+  802536:	55                   	push   %ebp
+  802537:	56                   	push   %esi
+  802538:	8b 0e                	mov    (%esi),%ecx
+  80253a:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80253d:	8b 7e 08             	mov    0x8(%esi),%edi
+  802540:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802543:	8b 76 0c             	mov    0xc(%esi),%esi
+  802546:	cd 30                	int    $0x30
+  802548:	87 34 24             	xchg   %esi,(%esp)
+  80254b:	89 0e                	mov    %ecx,(%esi)
+  80254d:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802550:	89 7e 08             	mov    %edi,0x8(%esi)
+  802553:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802556:	8f 46 0c             	pop    0xc(%esi)
+  802559:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  80255a:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  80255e:	74 0f                	je     80256f <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  802560:	85 c0                	test   %eax,%eax
+  802562:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802567:	0f 48 d1             	cmovs  %ecx,%edx
+  80256a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  80256d:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  80256f:	5b                   	pop    %ebx
+  802570:	5e                   	pop    %esi
+  802571:	5f                   	pop    %edi
+  802572:	5d                   	pop    %ebp
+  802573:	c3                   	ret
+
+00802574 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  802574:	55                   	push   %ebp
+  802575:	89 e5                	mov    %esp,%ebp
+  802577:	57                   	push   %edi
+  802578:	56                   	push   %esi
+  802579:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80257a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802581:	78 2f                	js     8025b2 <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  802583:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80258a:	74 72                	je     8025fe <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  80258c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80258f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802594:	b8 27 00 00 00       	mov    $0x27,%eax
+  802599:	89 cb                	mov    %ecx,%ebx
+  80259b:	89 cf                	mov    %ecx,%edi
+  80259d:	89 ce                	mov    %ecx,%esi
+  80259f:	55                   	push   %ebp
+  8025a0:	68 a9 25 80 00       	push   $0x8025a9
+  8025a5:	89 e5                	mov    %esp,%ebp
+  8025a7:	0f 34                	sysenter
+  8025a9:	83 c4 04             	add    $0x4,%esp
+  8025ac:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  8025ad:	5b                   	pop    %ebx
+  8025ae:	5e                   	pop    %esi
+  8025af:	5f                   	pop    %edi
+  8025b0:	5d                   	pop    %ebp
+  8025b1:	c3                   	ret
+  8025b2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025b7:	0f a2                	cpuid
+		return 0;
+  8025b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8025be:	f6 c6 08             	test   $0x8,%dh
+  8025c1:	74 15                	je     8025d8 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025c3:	89 c2                	mov    %eax,%edx
+  8025c5:	c1 ea 08             	shr    $0x8,%edx
+  8025c8:	83 e2 0f             	and    $0xf,%edx
+  8025cb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8025d0:	83 fa 06             	cmp    $0x6,%edx
+  8025d3:	74 0e                	je     8025e3 <sys_sysring_setup+0x6f>
+  8025d5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8025d8:	0f b6 c9             	movzbl %cl,%ecx
+  8025db:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8025e1:	eb a0                	jmp    802583 <sys_sysring_setup+0xf>
+  8025e3:	89 c2                	mov    %eax,%edx
+  8025e5:	c1 ea 04             	shr    $0x4,%edx
+  8025e8:	83 e2 0f             	and    $0xf,%edx
+  8025eb:	83 fa 02             	cmp    $0x2,%edx
+  8025ee:	77 e5                	ja     8025d5 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  8025f0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025f3:	83 f8 02             	cmp    $0x2,%eax
+  8025f6:	0f 97 c1             	seta   %cl
+  8025f9:	0f b6 c9             	movzbl %cl,%ecx
+  8025fc:	eb d7                	jmp    8025d5 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  8025fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802603:	b8 27 00 00 00       	mov    $0x27,%eax
+  802608:	8b 55 08             	mov    0x8(%ebp),%edx
+  80260b:	89 cb                	mov    %ecx,%ebx
+  80260d:	89 cf                	mov    %ecx,%edi
+  80260f:	89 ce                	mov    %ecx,%esi
+  802611:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  802613:	eb 98                	jmp    8025ad <sys_sysring_setup+0x39>
+
+00802615 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  802615:	55                   	push   %ebp
+  802616:	89 e5                	mov    %esp,%ebp
+  802618:	57                   	push   %edi
+  802619:	56                   	push   %esi
+  80261a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80261b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802622:	78 2e                	js     802652 <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  802624:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80262b:	74 71                	je     80269e <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  80262d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802632:	b8 28 00 00 00       	mov    $0x28,%eax
+  802637:	89 d1                	mov    %edx,%ecx
+  802639:	89 d3                	mov    %edx,%ebx
+  80263b:	89 d7                	mov    %edx,%edi
+  80263d:	89 d6                	mov    %edx,%esi
+  80263f:	55                   	push   %ebp
+  802640:	68 49 26 80 00       	push   $0x802649
+  802645:	89 e5                	mov    %esp,%ebp
+  802647:	0f 34                	sysenter
+  802649:	83 c4 04             	add    $0x4,%esp
+  80264c:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  80264d:	5b                   	pop    %ebx
+  80264e:	5e                   	pop    %esi
+  80264f:	5f                   	pop    %edi
+  802650:	5d                   	pop    %ebp
+  802651:	c3                   	ret
+  802652:	b8 01 00 00 00       	mov    $0x1,%eax
+  802657:	0f a2                	cpuid
+		return 0;
+  802659:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80265e:	f6 c6 08             	test   $0x8,%dh
+  802661:	74 15                	je     802678 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802663:	89 c2                	mov    %eax,%edx
+  802665:	c1 ea 08             	shr    $0x8,%edx
+  802668:	83 e2 0f             	and    $0xf,%edx
+  80266b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802670:	83 fa 06             	cmp    $0x6,%edx
+  802673:	74 0e                	je     802683 <sys_sysring_enter+0x6e>
+  802675:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802678:	0f b6 c9             	movzbl %cl,%ecx
+  80267b:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802681:	eb a1                	jmp    802624 <sys_sysring_enter+0xf>
+  802683:	89 c2                	mov    %eax,%edx
+  802685:	c1 ea 04             	shr    $0x4,%edx
+  802688:	83 e2 0f             	and    $0xf,%edx
+  80268b:	83 fa 02             	cmp    $0x2,%edx
+  80268e:	77 e5                	ja     802675 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  802690:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802693:	83 f8 02             	cmp    $0x2,%eax
+  802696:	0f 97 c1             	seta   %cl
+  802699:	0f b6 c9             	movzbl %cl,%ecx
+  80269c:	eb d7                	jmp    802675 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  80269e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026a3:	b8 28 00 00 00       	mov    $0x28,%eax
+  8026a8:	89 d1                	mov    %edx,%ecx
+  8026aa:	89 d3                	mov    %edx,%ebx
+  8026ac:	89 d7                	mov    %edx,%edi
+  8026ae:	89 d6                	mov    %edx,%esi
+  8026b0:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  8026b2:	eb 99                	jmp    80264d <sys_sysring_enter+0x38>
+
+008026b4 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8026b4:	55                   	push   %ebp
+  8026b5:	89 e5                	mov    %esp,%ebp
+  8026b7:	57                   	push   %edi
+  8026b8:	56                   	push   %esi
+  8026b9:	53                   	push   %ebx
+  8026ba:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  8026c0:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  8026c3:	8b 1d 00 30 80 00    	mov    0x803000,%ebx
+  8026c9:	e8 c8 e8 ff ff       	call   800f96 <sys_getenvid>
+  8026ce:	83 ec 04             	sub    $0x4,%esp
+  8026d1:	ff 75 0c             	push   0xc(%ebp)
+  8026d4:	ff 75 08             	push   0x8(%ebp)
+  8026d7:	53                   	push   %ebx
+  8026d8:	50                   	push   %eax
+  8026d9:	68 a4 2c 80 00       	push   $0x802ca4
+  8026de:	68 00 01 00 00       	push   $0x100
+  8026e3:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  8026e9:	56                   	push   %esi
+  8026ea:	e8 bc e0 ff ff       	call   8007ab <snprintf>
+  8026ef:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  8026f1:	83 c4 20             	add    $0x20,%esp
+  8026f4:	57                   	push   %edi
+  8026f5:	ff 75 10             	push   0x10(%ebp)
+  8026f8:	bf 00 01 00 00       	mov    $0x100,%edi
+  8026fd:	89 f8                	mov    %edi,%eax
+  8026ff:	29 d8                	sub    %ebx,%eax
+  802701:	50                   	push   %eax
+  802702:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  802705:	50                   	push   %eax
+  802706:	e8 52 e0 ff ff       	call   80075d <vsnprintf>
+  80270b:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  80270d:	83 c4 0c             	add    $0xc,%esp
+  802710:	68 5b 29 80 00       	push   $0x80295b
+  802715:	29 df                	sub    %ebx,%edi
+  802717:	57                   	push   %edi
+  802718:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  80271b:	50                   	push   %eax
+  80271c:	e8 8a e0 ff ff       	call   8007ab <snprintf>
+	sys_cputs(buf, r);
+  802721:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  802724:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  802726:	53                   	push   %ebx
+  802727:	56                   	push   %esi
+  802728:	e8 6b e6 ff ff       	call   800d98 <sys_cputs>
+  80272d:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802730:	cc                   	int3
+	while (1)
+  802731:	eb fd                	jmp    802730 <_panic+0x7c>
+
+00802733 <dm>:
+  802733:	55                   	push   %ebp
+  802734:	57                   	push   %edi
+  802735:	56                   	push   %esi
+  802736:	53                   	push   %ebx
+  802737:	83 ec 24             	sub    $0x24,%esp
+  80273a:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80273e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802742:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802746:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80274a:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80274e:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802752:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802756:	b8 00 00 00 00       	mov    $0x0,%eax
+  80275b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802760:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802765:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80276c:	00 
+  80276d:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802774:	00 
+  802775:	89 fb                	mov    %edi,%ebx
+  802777:	eb 08                	jmp    802781 <dm+0x4e>
+  802779:	83 e9 01             	sub    $0x1,%ecx
+  80277c:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80277f:	74 68                	je     8027e9 <dm+0xb6>
+  802781:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802785:	01 c0                	add    %eax,%eax
+  802787:	89 c6                	mov    %eax,%esi
+  802789:	89 d7                	mov    %edx,%edi
+  80278b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80278f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802793:	0f ad d0             	shrd   %cl,%edx,%eax
+  802796:	d3 ea                	shr    %cl,%edx
+  802798:	f6 c1 20             	test   $0x20,%cl
+  80279b:	74 04                	je     8027a1 <dm+0x6e>
+  80279d:	89 d0                	mov    %edx,%eax
+  80279f:	31 d2                	xor    %edx,%edx
+  8027a1:	83 e0 01             	and    $0x1,%eax
+  8027a4:	89 04 24             	mov    %eax,(%esp)
+  8027a7:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8027ae:	00 
+  8027af:	8b 04 24             	mov    (%esp),%eax
+  8027b2:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8027b6:	09 f0                	or     %esi,%eax
+  8027b8:	09 fa                	or     %edi,%edx
+  8027ba:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8027be:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8027c2:	39 f0                	cmp    %esi,%eax
+  8027c4:	89 d5                	mov    %edx,%ebp
+  8027c6:	19 fd                	sbb    %edi,%ebp
+  8027c8:	72 af                	jb     802779 <dm+0x46>
+  8027ca:	29 f0                	sub    %esi,%eax
+  8027cc:	19 fa                	sbb    %edi,%edx
+  8027ce:	89 cf                	mov    %ecx,%edi
+  8027d0:	c1 ef 05             	shr    $0x5,%edi
+  8027d3:	83 e7 01             	and    $0x1,%edi
+  8027d6:	89 fe                	mov    %edi,%esi
+  8027d8:	83 f6 01             	xor    $0x1,%esi
+  8027db:	d3 e6                	shl    %cl,%esi
+  8027dd:	d3 e7                	shl    %cl,%edi
+  8027df:	09 74 24 18          	or     %esi,0x18(%esp)
+  8027e3:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8027e7:	eb 90                	jmp    802779 <dm+0x46>
+  8027e9:	85 db                	test   %ebx,%ebx
+  8027eb:	74 05                	je     8027f2 <dm+0xbf>
+  8027ed:	89 03                	mov    %eax,(%ebx)
+  8027ef:	89 53 04             	mov    %edx,0x4(%ebx)
+  8027f2:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8027f6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8027fa:	83 c4 24             	add    $0x24,%esp
+  8027fd:	5b                   	pop    %ebx
+  8027fe:	5e                   	pop    %esi
+  8027ff:	5f                   	pop    %edi
+  802800:	5d                   	pop    %ebp
+  802801:	c3                   	ret
+
+00802802 <__udivdi3>:
+  802802:	83 ec 08             	sub    $0x8,%esp
+  802805:	6a 00                	push   $0x0
+  802807:	ff 74 24 1c          	push   0x1c(%esp)
+  80280b:	ff 74 24 1c          	push   0x1c(%esp)
+  80280f:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802813:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802817:	e8 17 ff ff ff       	call   802733 <dm>
+  80281c:	83 c4 14             	add    $0x14,%esp
+  80281f:	c3                   	ret
+
+00802820 <__umoddi3>:
+  802820:	83 ec 18             	sub    $0x18,%esp
+  802823:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802827:	50                   	push   %eax
+  802828:	ff 74 24 2c          	push   0x2c(%esp)
+  80282c:	ff 74 24 2c          	push   0x2c(%esp)
+  802830:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802834:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802838:	e8 f6 fe ff ff       	call   802733 <dm>
+  80283d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802841:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802845:	83 c4 24             	add    $0x24,%esp
+  802848:	c3                   	ret
+
+00802849 <__divdi3>:
+  802849:	53                   	push   %ebx
+  80284a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80284e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802852:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  802856:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80285a:	85 d2                	test   %edx,%edx
+  80285c:	78 15                	js     802873 <__divdi3+0x2a>
+  80285e:	85 db                	test   %ebx,%ebx
+  802860:	78 34                	js     802896 <__divdi3+0x4d>
+  802862:	83 ec 04             	sub    $0x4,%esp
+  802865:	6a 00                	push   $0x0
+  802867:	53                   	push   %ebx
+  802868:	51                   	push   %ecx
+  802869:	e8 c5 fe ff ff       	call   802733 <dm>
+  80286e:	83 c4 10             	add    $0x10,%esp
+  802871:	eb 21                	jmp    802894 <__divdi3+0x4b>
+  802873:	f7 d8                	neg    %eax
+  802875:	83 d2 00             	adc    $0x0,%edx
+  802878:	f7 da                	neg    %edx
+  80287a:	85 db                	test   %ebx,%ebx
+  80287c:	78 30                	js     8028ae <__divdi3+0x65>
+  80287e:	83 ec 04             	sub    $0x4,%esp
+  802881:	6a 00                	push   $0x0
+  802883:	53                   	push   %ebx
+  802884:	51                   	push   %ecx
+  802885:	e8 a9 fe ff ff       	call   802733 <dm>
+  80288a:	83 c4 10             	add    $0x10,%esp
+  80288d:	f7 d8                	neg    %eax
+  80288f:	83 d2 00             	adc    $0x0,%edx
+  802892:	f7 da                	neg    %edx
+  802894:	5b                   	pop    %ebx
+  802895:	c3                   	ret
+  802896:	83 ec 04             	sub    $0x4,%esp
+  802899:	6a 00                	push   $0x0
+  80289b:	f7 d9                	neg    %ecx
+  80289d:	83 d3 00             	adc    $0x0,%ebx
+  8028a0:	f7 db                	neg    %ebx
+  8028a2:	53                   	push   %ebx
+  8028a3:	51                   	push   %ecx
+  8028a4:	e8 8a fe ff ff       	call   802733 <dm>
+  8028a9:	83 c4 10             	add    $0x10,%esp
+  8028ac:	eb df                	jmp    80288d <__divdi3+0x44>
+  8028ae:	83 ec 04             	sub    $0x4,%esp
+  8028b1:	6a 00                	push   $0x0
+  8028b3:	f7 d9                	neg    %ecx
+  8028b5:	83 d3 00             	adc    $0x0,%ebx
+  8028b8:	f7 db                	neg    %ebx
+  8028ba:	53                   	push   %ebx
+  8028bb:	51                   	push   %ecx
+  8028bc:	e8 72 fe ff ff       	call   802733 <dm>
+  8028c1:	83 c4 10             	add    $0x10,%esp
+  8028c4:	eb ce                	jmp    802894 <__divdi3+0x4b>
+
+008028c6 <__moddi3>:
+  8028c6:	55                   	push   %ebp
+  8028c7:	57                   	push   %edi
+  8028c8:	56                   	push   %esi
+  8028c9:	53                   	push   %ebx
+  8028ca:	83 ec 18             	sub    $0x18,%esp
+  8028cd:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  8028d1:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8028d5:	89 f1                	mov    %esi,%ecx
+  8028d7:	f7 d9                	neg    %ecx
+  8028d9:	89 da                	mov    %ebx,%edx
+  8028db:	83 d2 00             	adc    $0x0,%edx
+  8028de:	f7 da                	neg    %edx
+  8028e0:	0f 48 ce             	cmovs  %esi,%ecx
+  8028e3:	0f 48 d3             	cmovs  %ebx,%edx
+  8028e6:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8028ea:	50                   	push   %eax
+  8028eb:	8b 74 24 38          	mov    0x38(%esp),%esi
+  8028ef:	f7 de                	neg    %esi
+  8028f1:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  8028f5:	83 d0 00             	adc    $0x0,%eax
+  8028f8:	f7 d8                	neg    %eax
+  8028fa:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  8028ff:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802904:	50                   	push   %eax
+  802905:	56                   	push   %esi
+  802906:	89 c8                	mov    %ecx,%eax
+  802908:	e8 26 fe ff ff       	call   802733 <dm>
+  80290d:	83 c4 10             	add    $0x10,%esp
+  802910:	85 db                	test   %ebx,%ebx
+  802912:	78 10                	js     802924 <__moddi3+0x5e>
+  802914:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802918:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80291c:	83 c4 14             	add    $0x14,%esp
+  80291f:	5b                   	pop    %ebx
+  802920:	5e                   	pop    %esi
+  802921:	5f                   	pop    %edi
+  802922:	5d                   	pop    %ebp
+  802923:	c3                   	ret
+  802924:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802928:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80292c:	f7 d8                	neg    %eax
+  80292e:	83 d2 00             	adc    $0x0,%edx
+  802931:	f7 da                	neg    %edx
+  802933:	eb e7                	jmp    80291c <__moddi3+0x56>
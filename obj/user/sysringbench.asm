@@ -0,0 +1,5609 @@
+
+obj/user/sysringbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 b7 02 00 00       	call   8002e8 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <ring_pass>:
+
+// Run 'num' on each of the NPAGES pages through the ring, a full ring
+// per trap.
+static void
+ring_pass(uint32_t num)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 40             	sub    $0x40,%esp
+  80003c:	89 c3                	mov    %eax,%ebx
+	struct sysring_sqe sqe;
+	struct sysring_cqe cqe;
+	int i = 0, r;
+
+	memset(&sqe, 0, sizeof(sqe));
+  80003e:	6a 1c                	push   $0x1c
+  800040:	6a 00                	push   $0x0
+  800042:	8d 45 cc             	lea    -0x34(%ebp),%eax
+  800045:	50                   	push   %eax
+  800046:	e8 4b 0b 00 00       	call   800b96 <memset>
+	sqe.se_num = num;
+  80004b:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+	sqe.se_args[2] = PTE_P | PTE_U | PTE_W;
+  80004e:	c7 45 d8 07 00 00 00 	movl   $0x7,-0x28(%ebp)
+  800055:	83 c4 10             	add    $0x10,%esp
+	int i = 0, r;
+  800058:	bb 00 00 00 00       	mov    $0x0,%ebx
+	while (i < NPAGES) {
+		for (; i < NPAGES; i++) {
+			sqe.se_args[1] = (uint32_t) (BUF + i * PGSIZE);
+			sqe.se_data = i;
+			if (!sysring_push(ring, &sqe))
+  80005d:	8d 7d cc             	lea    -0x34(%ebp),%edi
+				break;
+		}
+		if ((r = sysring_submit(ring)) < 0)
+			panic("sysring_submit: %e", r);
+		while (sysring_reap(ring, &cqe))
+  800060:	8d 75 c4             	lea    -0x3c(%ebp),%esi
+  800063:	eb 1a                	jmp    80007f <ring_pass+0x4c>
+			panic("sysring_submit: %e", r);
+  800065:	50                   	push   %eax
+  800066:	68 00 2c 80 00       	push   $0x802c00
+  80006b:	6a 33                	push   $0x33
+  80006d:	68 13 2c 80 00       	push   $0x802c13
+  800072:	e8 cc 02 00 00       	call   800343 <_panic>
+	while (i < NPAGES) {
+  800077:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+  80007d:	7f 78                	jg     8000f7 <ring_pass+0xc4>
+			sqe.se_args[1] = (uint32_t) (BUF + i * PGSIZE);
+  80007f:	89 d8                	mov    %ebx,%eax
+  800081:	c1 e0 0c             	shl    $0xc,%eax
+  800084:	05 00 00 00 20       	add    $0x20000000,%eax
+  800089:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+			sqe.se_data = i;
+  80008c:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+			if (!sysring_push(ring, &sqe))
+  80008f:	83 ec 08             	sub    $0x8,%esp
+  800092:	57                   	push   %edi
+  800093:	68 00 00 40 00       	push   $0x400000
+  800098:	e8 80 28 00 00       	call   80291d <sysring_push>
+  80009d:	83 c4 10             	add    $0x10,%esp
+  8000a0:	84 c0                	test   %al,%al
+  8000a2:	74 0b                	je     8000af <ring_pass+0x7c>
+		for (; i < NPAGES; i++) {
+  8000a4:	83 c3 01             	add    $0x1,%ebx
+  8000a7:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  8000ad:	75 d0                	jne    80007f <ring_pass+0x4c>
+		if ((r = sysring_submit(ring)) < 0)
+  8000af:	83 ec 0c             	sub    $0xc,%esp
+  8000b2:	68 00 00 40 00       	push   $0x400000
+  8000b7:	e8 cd 28 00 00       	call   802989 <sysring_submit>
+  8000bc:	83 c4 10             	add    $0x10,%esp
+  8000bf:	85 c0                	test   %eax,%eax
+  8000c1:	78 a2                	js     800065 <ring_pass+0x32>
+		while (sysring_reap(ring, &cqe))
+  8000c3:	83 ec 08             	sub    $0x8,%esp
+  8000c6:	56                   	push   %esi
+  8000c7:	68 00 00 40 00       	push   $0x400000
+  8000cc:	e8 c5 28 00 00       	call   802996 <sysring_reap>
+  8000d1:	83 c4 10             	add    $0x10,%esp
+  8000d4:	84 c0                	test   %al,%al
+  8000d6:	74 9f                	je     800077 <ring_pass+0x44>
+			if (cqe.ce_result < 0)
+  8000d8:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8000db:	85 c0                	test   %eax,%eax
+  8000dd:	79 e4                	jns    8000c3 <ring_pass+0x90>
+				panic("page %d: %e", cqe.ce_data, cqe.ce_result);
+  8000df:	83 ec 0c             	sub    $0xc,%esp
+  8000e2:	50                   	push   %eax
+  8000e3:	ff 75 c4             	push   -0x3c(%ebp)
+  8000e6:	68 27 2c 80 00       	push   $0x802c27
+  8000eb:	6a 36                	push   $0x36
+  8000ed:	68 13 2c 80 00       	push   $0x802c13
+  8000f2:	e8 4c 02 00 00       	call   800343 <_panic>
+	}
+}
+  8000f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000fa:	5b                   	pop    %ebx
+  8000fb:	5e                   	pop    %esi
+  8000fc:	5f                   	pop    %edi
+  8000fd:	5d                   	pop    %ebp
+  8000fe:	c3                   	ret
+
+008000ff <ring_round>:
+
+static void
+ring_round(void)
+{
+  8000ff:	55                   	push   %ebp
+  800100:	89 e5                	mov    %esp,%ebp
+  800102:	83 ec 08             	sub    $0x8,%esp
+	ring_pass(SYS_page_alloc);
+  800105:	b8 04 00 00 00       	mov    $0x4,%eax
+  80010a:	e8 24 ff ff ff       	call   800033 <ring_pass>
+	ring_pass(SYS_page_unmap);
+  80010f:	b8 06 00 00 00       	mov    $0x6,%eax
+  800114:	e8 1a ff ff ff       	call   800033 <ring_pass>
+}
+  800119:	c9                   	leave
+  80011a:	c3                   	ret
+
+0080011b <direct_round>:
+{
+  80011b:	55                   	push   %ebp
+  80011c:	89 e5                	mov    %esp,%ebp
+  80011e:	53                   	push   %ebx
+  80011f:	83 ec 04             	sub    $0x4,%esp
+  800122:	bb 00 00 00 20       	mov    $0x20000000,%ebx
+		if ((r = sys_page_alloc(0, BUF + i * PGSIZE,
+  800127:	83 ec 04             	sub    $0x4,%esp
+  80012a:	6a 07                	push   $0x7
+  80012c:	53                   	push   %ebx
+  80012d:	6a 00                	push   $0x0
+  80012f:	e8 46 11 00 00       	call   80127a <sys_page_alloc>
+  800134:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80013a:	83 c4 10             	add    $0x10,%esp
+  80013d:	85 c0                	test   %eax,%eax
+  80013f:	78 32                	js     800173 <direct_round+0x58>
+	for (i = 0; i < NPAGES; i++)
+  800141:	81 fb 00 00 20 20    	cmp    $0x20200000,%ebx
+  800147:	75 de                	jne    800127 <direct_round+0xc>
+  800149:	bb 00 00 00 20       	mov    $0x20000000,%ebx
+		if ((r = sys_page_unmap(0, BUF + i * PGSIZE)) < 0)
+  80014e:	83 ec 08             	sub    $0x8,%esp
+  800151:	53                   	push   %ebx
+  800152:	6a 00                	push   $0x0
+  800154:	e8 ab 12 00 00       	call   801404 <sys_page_unmap>
+  800159:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80015f:	83 c4 10             	add    $0x10,%esp
+  800162:	85 c0                	test   %eax,%eax
+  800164:	78 1f                	js     800185 <direct_round+0x6a>
+	for (i = 0; i < NPAGES; i++)
+  800166:	81 fb 00 00 20 20    	cmp    $0x20200000,%ebx
+  80016c:	75 e0                	jne    80014e <direct_round+0x33>
+}
+  80016e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800171:	c9                   	leave
+  800172:	c3                   	ret
+			panic("sys_page_alloc: %e", r);
+  800173:	50                   	push   %eax
+  800174:	68 33 2c 80 00       	push   $0x802c33
+  800179:	6a 19                	push   $0x19
+  80017b:	68 13 2c 80 00       	push   $0x802c13
+  800180:	e8 be 01 00 00       	call   800343 <_panic>
+			panic("sys_page_unmap: %e", r);
+  800185:	50                   	push   %eax
+  800186:	68 46 2c 80 00       	push   $0x802c46
+  80018b:	6a 1c                	push   $0x1c
+  80018d:	68 13 2c 80 00       	push   $0x802c13
+  800192:	e8 ac 01 00 00       	call   800343 <_panic>
+
+00800197 <run>:
+
+static void
+run(const char *name, void (*round)(void))
+{
+  800197:	55                   	push   %ebp
+  800198:	89 e5                	mov    %esp,%ebp
+  80019a:	57                   	push   %edi
+  80019b:	56                   	push   %esi
+  80019c:	53                   	push   %ebx
+  80019d:	83 ec 1c             	sub    $0x1c,%esp
+  8001a0:	89 c7                	mov    %eax,%edi
+  8001a2:	89 d6                	mov    %edx,%esi
+
+static inline uint64_t
+read_tsc(void)
+{
+	uint64_t tsc;
+	asm volatile("rdtsc" : "=A" (tsc));
+  8001a4:	0f 31                	rdtsc
+  8001a6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001a9:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	uint64_t start, cycles, tsc_per_tick, ns_per_tick;
+	uint32_t ncalls = 2 * NPAGES * NROUNDS;
+	int i;
+
+	start = read_tsc();
+	for (i = 0; i < NROUNDS; i++)
+  8001ac:	bb 09 00 00 00       	mov    $0x9,%ebx
+  8001b1:	eb 02                	jmp    8001b5 <run+0x1e>
+		round();
+  8001b3:	ff d6                	call   *%esi
+	for (i = 0; i < NROUNDS; i++)
+  8001b5:	83 eb 01             	sub    $0x1,%ebx
+  8001b8:	75 f9                	jne    8001b3 <run+0x1c>
+  8001ba:	0f 31                	rdtsc
+	cycles = read_tsc() - start;
+  8001bc:	2b 45 e0             	sub    -0x20(%ebp),%eax
+  8001bf:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+
+	cprintf("%-8s %6d calls %8llu cycles/call", name, ncalls,
+  8001c2:	83 ec 0c             	sub    $0xc,%esp
+  8001c5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001c8:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8001cb:	0f ac d0 0d          	shrd   $0xd,%edx,%eax
+  8001cf:	c1 ea 0d             	shr    $0xd,%edx
+  8001d2:	52                   	push   %edx
+  8001d3:	50                   	push   %eax
+  8001d4:	68 00 20 00 00       	push   $0x2000
+  8001d9:	57                   	push   %edi
+  8001da:	68 8c 2c 80 00       	push   $0x802c8c
+  8001df:	e8 73 02 00 00       	call   800457 <cprintf>
+		cycles / ncalls);
+	tsc_per_tick = vdso.vd_tsc_per_tick;
+  8001e4:	8b 35 1c f0 ff ee    	mov    0xeefff01c,%esi
+  8001ea:	8b 3d 20 f0 ff ee    	mov    0xeefff020,%edi
+	ns_per_tick = vdso.vd_ns_per_tick;
+  8001f0:	a1 0c f0 ff ee       	mov    0xeefff00c,%eax
+  8001f5:	8b 15 10 f0 ff ee    	mov    0xeefff010,%edx
+	if (tsc_per_tick && ns_per_tick)
+  8001fb:	83 c4 20             	add    $0x20,%esp
+  8001fe:	89 f1                	mov    %esi,%ecx
+  800200:	09 f9                	or     %edi,%ecx
+  800202:	74 06                	je     80020a <run+0x73>
+  800204:	89 c1                	mov    %eax,%ecx
+  800206:	09 d1                	or     %edx,%ecx
+  800208:	75 18                	jne    800222 <run+0x8b>
+		cprintf(" %10llu calls/s",
+			(uint64_t) ncalls * tsc_per_tick
+			* (NANOSECONDS_PER_SECOND / ns_per_tick) / cycles);
+	cprintf("\n");
+  80020a:	83 ec 0c             	sub    $0xc,%esp
+  80020d:	68 69 2c 80 00       	push   $0x802c69
+  800212:	e8 40 02 00 00       	call   800457 <cprintf>
+}
+  800217:	83 c4 10             	add    $0x10,%esp
+  80021a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80021d:	5b                   	pop    %ebx
+  80021e:	5e                   	pop    %esi
+  80021f:	5f                   	pop    %edi
+  800220:	5d                   	pop    %ebp
+  800221:	c3                   	ret
+		cprintf(" %10llu calls/s",
+  800222:	83 ec 10             	sub    $0x10,%esp
+			* (NANOSECONDS_PER_SECOND / ns_per_tick) / cycles);
+  800225:	52                   	push   %edx
+  800226:	50                   	push   %eax
+  800227:	6a 00                	push   $0x0
+  800229:	68 00 ca 9a 3b       	push   $0x3b9aca00
+  80022e:	e8 7e 28 00 00       	call   802ab1 <__udivdi3>
+  800233:	83 c4 10             	add    $0x10,%esp
+  800236:	0f af d6             	imul   %esi,%edx
+  800239:	89 f9                	mov    %edi,%ecx
+  80023b:	0f af c8             	imul   %eax,%ecx
+  80023e:	01 d1                	add    %edx,%ecx
+  800240:	f7 e6                	mul    %esi
+  800242:	01 ca                	add    %ecx,%edx
+  800244:	89 c1                	mov    %eax,%ecx
+  800246:	89 d3                	mov    %edx,%ebx
+  800248:	0f a4 cb 0d          	shld   $0xd,%ecx,%ebx
+  80024c:	c1 e1 0d             	shl    $0xd,%ecx
+		cprintf(" %10llu calls/s",
+  80024f:	ff 75 e4             	push   -0x1c(%ebp)
+  800252:	ff 75 e0             	push   -0x20(%ebp)
+  800255:	53                   	push   %ebx
+  800256:	51                   	push   %ecx
+  800257:	e8 55 28 00 00       	call   802ab1 <__udivdi3>
+  80025c:	83 c4 1c             	add    $0x1c,%esp
+  80025f:	52                   	push   %edx
+  800260:	50                   	push   %eax
+  800261:	68 59 2c 80 00       	push   $0x802c59
+  800266:	e8 ec 01 00 00       	call   800457 <cprintf>
+  80026b:	83 c4 10             	add    $0x10,%esp
+  80026e:	eb 9a                	jmp    80020a <run+0x73>
+
+00800270 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800270:	55                   	push   %ebp
+  800271:	89 e5                	mov    %esp,%ebp
+  800273:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+
+	if ((r = sys_page_alloc(0, ring, PTE_P | PTE_U | PTE_W)) < 0)
+  800276:	6a 07                	push   $0x7
+  800278:	68 00 00 40 00       	push   $0x400000
+  80027d:	6a 00                	push   $0x0
+  80027f:	e8 f6 0f 00 00       	call   80127a <sys_page_alloc>
+  800284:	83 c4 10             	add    $0x10,%esp
+  800287:	85 c0                	test   %eax,%eax
+  800289:	78 39                	js     8002c4 <umain+0x54>
+		panic("sys_page_alloc: %e", r);
+	if ((r = sysring_init(ring)) < 0)
+  80028b:	83 ec 0c             	sub    $0xc,%esp
+  80028e:	68 00 00 40 00       	push   $0x400000
+  800293:	e8 61 26 00 00       	call   8028f9 <sysring_init>
+  800298:	83 c4 10             	add    $0x10,%esp
+  80029b:	85 c0                	test   %eax,%eax
+  80029d:	78 37                	js     8002d6 <umain+0x66>
+		panic("sysring_init: %e", r);
+
+	// Once untimed, so both runs find the page tables in place.
+	direct_round();
+  80029f:	e8 77 fe ff ff       	call   80011b <direct_round>
+
+	run("direct", direct_round);
+  8002a4:	ba 1b 01 80 00       	mov    $0x80011b,%edx
+  8002a9:	b8 7c 2c 80 00       	mov    $0x802c7c,%eax
+  8002ae:	e8 e4 fe ff ff       	call   800197 <run>
+	run("sysring", ring_round);
+  8002b3:	ba ff 00 80 00       	mov    $0x8000ff,%edx
+  8002b8:	b8 83 2c 80 00       	mov    $0x802c83,%eax
+  8002bd:	e8 d5 fe ff ff       	call   800197 <run>
+}
+  8002c2:	c9                   	leave
+  8002c3:	c3                   	ret
+		panic("sys_page_alloc: %e", r);
+  8002c4:	50                   	push   %eax
+  8002c5:	68 33 2c 80 00       	push   $0x802c33
+  8002ca:	6a 5e                	push   $0x5e
+  8002cc:	68 13 2c 80 00       	push   $0x802c13
+  8002d1:	e8 6d 00 00 00       	call   800343 <_panic>
+		panic("sysring_init: %e", r);
+  8002d6:	50                   	push   %eax
+  8002d7:	68 6b 2c 80 00       	push   $0x802c6b
+  8002dc:	6a 60                	push   $0x60
+  8002de:	68 13 2c 80 00       	push   $0x802c13
+  8002e3:	e8 5b 00 00 00       	call   800343 <_panic>
+
+008002e8 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8002e8:	55                   	push   %ebp
+  8002e9:	89 e5                	mov    %esp,%ebp
+  8002eb:	56                   	push   %esi
+  8002ec:	53                   	push   %ebx
+  8002ed:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002f0:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  8002f3:	e8 e3 0e 00 00       	call   8011db <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  8002f8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002fd:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  800303:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800308:	a3 08 30 80 00       	mov    %eax,0x803008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80030d:	85 db                	test   %ebx,%ebx
+  80030f:	7e 07                	jle    800318 <libmain+0x30>
+		binaryname = argv[0];
+  800311:	8b 06                	mov    (%esi),%eax
+  800313:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  800318:	83 ec 08             	sub    $0x8,%esp
+  80031b:	56                   	push   %esi
+  80031c:	53                   	push   %ebx
+  80031d:	e8 4e ff ff ff       	call   800270 <umain>
+
+	// exit gracefully
+	exit();
+  800322:	e8 0a 00 00 00       	call   800331 <exit>
+}
+  800327:	83 c4 10             	add    $0x10,%esp
+  80032a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80032d:	5b                   	pop    %ebx
+  80032e:	5e                   	pop    %esi
+  80032f:	5d                   	pop    %ebp
+  800330:	c3                   	ret
+
+00800331 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800331:	55                   	push   %ebp
+  800332:	89 e5                	mov    %esp,%ebp
+  800334:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  800337:	6a 00                	push   $0x0
+  800339:	e8 db 0d 00 00       	call   801119 <sys_env_destroy>
+}
+  80033e:	83 c4 10             	add    $0x10,%esp
+  800341:	c9                   	leave
+  800342:	c3                   	ret
+
+00800343 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800343:	55                   	push   %ebp
+  800344:	89 e5                	mov    %esp,%ebp
+  800346:	57                   	push   %edi
+  800347:	56                   	push   %esi
+  800348:	53                   	push   %ebx
+  800349:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  80034f:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  800352:	8b 1d 00 30 80 00    	mov    0x803000,%ebx
+  800358:	e8 7e 0e 00 00       	call   8011db <sys_getenvid>
+  80035d:	83 ec 04             	sub    $0x4,%esp
+  800360:	ff 75 0c             	push   0xc(%ebp)
+  800363:	ff 75 08             	push   0x8(%ebp)
+  800366:	53                   	push   %ebx
+  800367:	50                   	push   %eax
+  800368:	68 b8 2c 80 00       	push   $0x802cb8
+  80036d:	68 00 01 00 00       	push   $0x100
+  800372:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  800378:	56                   	push   %esi
+  800379:	e8 72 06 00 00       	call   8009f0 <snprintf>
+  80037e:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  800380:	83 c4 20             	add    $0x20,%esp
+  800383:	57                   	push   %edi
+  800384:	ff 75 10             	push   0x10(%ebp)
+  800387:	bf 00 01 00 00       	mov    $0x100,%edi
+  80038c:	89 f8                	mov    %edi,%eax
+  80038e:	29 d8                	sub    %ebx,%eax
+  800390:	50                   	push   %eax
+  800391:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  800394:	50                   	push   %eax
+  800395:	e8 08 06 00 00       	call   8009a2 <vsnprintf>
+  80039a:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  80039c:	83 c4 0c             	add    $0xc,%esp
+  80039f:	68 69 2c 80 00       	push   $0x802c69
+  8003a4:	29 df                	sub    %ebx,%edi
+  8003a6:	57                   	push   %edi
+  8003a7:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8003aa:	50                   	push   %eax
+  8003ab:	e8 40 06 00 00       	call   8009f0 <snprintf>
+	sys_cputs(buf, r);
+  8003b0:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  8003b3:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  8003b5:	53                   	push   %ebx
+  8003b6:	56                   	push   %esi
+  8003b7:	e8 21 0c 00 00       	call   800fdd <sys_cputs>
+  8003bc:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8003bf:	cc                   	int3
+	while (1)
+  8003c0:	eb fd                	jmp    8003bf <_panic+0x7c>
+
+008003c2 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8003c2:	55                   	push   %ebp
+  8003c3:	89 e5                	mov    %esp,%ebp
+  8003c5:	53                   	push   %ebx
+  8003c6:	83 ec 04             	sub    $0x4,%esp
+  8003c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8003cc:	8b 13                	mov    (%ebx),%edx
+  8003ce:	8d 42 01             	lea    0x1(%edx),%eax
+  8003d1:	89 03                	mov    %eax,(%ebx)
+  8003d3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8003d6:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8003da:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8003df:	74 09                	je     8003ea <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8003e1:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8003e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003e8:	c9                   	leave
+  8003e9:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8003ea:	83 ec 08             	sub    $0x8,%esp
+  8003ed:	68 ff 00 00 00       	push   $0xff
+  8003f2:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003f5:	50                   	push   %eax
+  8003f6:	e8 e2 0b 00 00       	call   800fdd <sys_cputs>
+		b->idx = 0;
+  8003fb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800401:	83 c4 10             	add    $0x10,%esp
+  800404:	eb db                	jmp    8003e1 <putch+0x1f>
+
+00800406 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800406:	55                   	push   %ebp
+  800407:	89 e5                	mov    %esp,%ebp
+  800409:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80040f:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800416:	00 00 00 
+	b.cnt = 0;
+  800419:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800420:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800423:	ff 75 0c             	push   0xc(%ebp)
+  800426:	ff 75 08             	push   0x8(%ebp)
+  800429:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80042f:	50                   	push   %eax
+  800430:	68 c2 03 80 00       	push   $0x8003c2
+  800435:	e8 14 01 00 00       	call   80054e <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80043a:	83 c4 08             	add    $0x8,%esp
+  80043d:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800443:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800449:	50                   	push   %eax
+  80044a:	e8 8e 0b 00 00       	call   800fdd <sys_cputs>
+
+	return b.cnt;
+}
+  80044f:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800455:	c9                   	leave
+  800456:	c3                   	ret
+
+00800457 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800457:	55                   	push   %ebp
+  800458:	89 e5                	mov    %esp,%ebp
+  80045a:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80045d:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800460:	50                   	push   %eax
+  800461:	ff 75 08             	push   0x8(%ebp)
+  800464:	e8 9d ff ff ff       	call   800406 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800469:	c9                   	leave
+  80046a:	c3                   	ret
+
+0080046b <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80046b:	55                   	push   %ebp
+  80046c:	89 e5                	mov    %esp,%ebp
+  80046e:	57                   	push   %edi
+  80046f:	56                   	push   %esi
+  800470:	53                   	push   %ebx
+  800471:	83 ec 1c             	sub    $0x1c,%esp
+  800474:	89 c7                	mov    %eax,%edi
+  800476:	89 d6                	mov    %edx,%esi
+  800478:	8b 45 08             	mov    0x8(%ebp),%eax
+  80047b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80047e:	89 d1                	mov    %edx,%ecx
+  800480:	89 c2                	mov    %eax,%edx
+  800482:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800485:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800488:	8b 45 10             	mov    0x10(%ebp),%eax
+  80048b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80048e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800491:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800498:	39 c2                	cmp    %eax,%edx
+  80049a:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80049d:	72 3e                	jb     8004dd <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80049f:	83 ec 0c             	sub    $0xc,%esp
+  8004a2:	ff 75 18             	push   0x18(%ebp)
+  8004a5:	83 eb 01             	sub    $0x1,%ebx
+  8004a8:	53                   	push   %ebx
+  8004a9:	50                   	push   %eax
+  8004aa:	83 ec 08             	sub    $0x8,%esp
+  8004ad:	ff 75 e4             	push   -0x1c(%ebp)
+  8004b0:	ff 75 e0             	push   -0x20(%ebp)
+  8004b3:	ff 75 dc             	push   -0x24(%ebp)
+  8004b6:	ff 75 d8             	push   -0x28(%ebp)
+  8004b9:	e8 f3 25 00 00       	call   802ab1 <__udivdi3>
+  8004be:	83 c4 18             	add    $0x18,%esp
+  8004c1:	52                   	push   %edx
+  8004c2:	50                   	push   %eax
+  8004c3:	89 f2                	mov    %esi,%edx
+  8004c5:	89 f8                	mov    %edi,%eax
+  8004c7:	e8 9f ff ff ff       	call   80046b <printnum>
+  8004cc:	83 c4 20             	add    $0x20,%esp
+  8004cf:	eb 13                	jmp    8004e4 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8004d1:	83 ec 08             	sub    $0x8,%esp
+  8004d4:	56                   	push   %esi
+  8004d5:	ff 75 18             	push   0x18(%ebp)
+  8004d8:	ff d7                	call   *%edi
+  8004da:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8004dd:	83 eb 01             	sub    $0x1,%ebx
+  8004e0:	85 db                	test   %ebx,%ebx
+  8004e2:	7f ed                	jg     8004d1 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8004e4:	83 ec 08             	sub    $0x8,%esp
+  8004e7:	56                   	push   %esi
+  8004e8:	83 ec 04             	sub    $0x4,%esp
+  8004eb:	ff 75 e4             	push   -0x1c(%ebp)
+  8004ee:	ff 75 e0             	push   -0x20(%ebp)
+  8004f1:	ff 75 dc             	push   -0x24(%ebp)
+  8004f4:	ff 75 d8             	push   -0x28(%ebp)
+  8004f7:	e8 d3 25 00 00       	call   802acf <__umoddi3>
+  8004fc:	83 c4 14             	add    $0x14,%esp
+  8004ff:	0f be 80 db 2c 80 00 	movsbl 0x802cdb(%eax),%eax
+  800506:	50                   	push   %eax
+  800507:	ff d7                	call   *%edi
+}
+  800509:	83 c4 10             	add    $0x10,%esp
+  80050c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80050f:	5b                   	pop    %ebx
+  800510:	5e                   	pop    %esi
+  800511:	5f                   	pop    %edi
+  800512:	5d                   	pop    %ebp
+  800513:	c3                   	ret
+
+00800514 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800514:	55                   	push   %ebp
+  800515:	89 e5                	mov    %esp,%ebp
+  800517:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80051a:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80051e:	8b 10                	mov    (%eax),%edx
+  800520:	3b 50 04             	cmp    0x4(%eax),%edx
+  800523:	73 0a                	jae    80052f <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800525:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800528:	89 08                	mov    %ecx,(%eax)
+  80052a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80052d:	88 02                	mov    %al,(%edx)
+}
+  80052f:	5d                   	pop    %ebp
+  800530:	c3                   	ret
+
+00800531 <printfmt>:
+{
+  800531:	55                   	push   %ebp
+  800532:	89 e5                	mov    %esp,%ebp
+  800534:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800537:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80053a:	50                   	push   %eax
+  80053b:	ff 75 10             	push   0x10(%ebp)
+  80053e:	ff 75 0c             	push   0xc(%ebp)
+  800541:	ff 75 08             	push   0x8(%ebp)
+  800544:	e8 05 00 00 00       	call   80054e <vprintfmt>
+}
+  800549:	83 c4 10             	add    $0x10,%esp
+  80054c:	c9                   	leave
+  80054d:	c3                   	ret
+
+0080054e <vprintfmt>:
+{
+  80054e:	55                   	push   %ebp
+  80054f:	89 e5                	mov    %esp,%ebp
+  800551:	57                   	push   %edi
+  800552:	56                   	push   %esi
+  800553:	53                   	push   %ebx
+  800554:	83 ec 2c             	sub    $0x2c,%esp
+  800557:	8b 75 08             	mov    0x8(%ebp),%esi
+  80055a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80055d:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800560:	eb 0a                	jmp    80056c <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800562:	83 ec 08             	sub    $0x8,%esp
+  800565:	53                   	push   %ebx
+  800566:	50                   	push   %eax
+  800567:	ff d6                	call   *%esi
+  800569:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80056c:	83 c7 01             	add    $0x1,%edi
+  80056f:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800573:	83 f8 25             	cmp    $0x25,%eax
+  800576:	74 0c                	je     800584 <vprintfmt+0x36>
+			if (ch == '\0')
+  800578:	85 c0                	test   %eax,%eax
+  80057a:	75 e6                	jne    800562 <vprintfmt+0x14>
+}
+  80057c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80057f:	5b                   	pop    %ebx
+  800580:	5e                   	pop    %esi
+  800581:	5f                   	pop    %edi
+  800582:	5d                   	pop    %ebp
+  800583:	c3                   	ret
+		padc = ' ';
+  800584:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800588:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80058f:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800596:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80059d:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8005a2:	8d 47 01             	lea    0x1(%edi),%eax
+  8005a5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8005a8:	0f b6 17             	movzbl (%edi),%edx
+  8005ab:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8005ae:	3c 55                	cmp    $0x55,%al
+  8005b0:	0f 87 cf 03 00 00    	ja     800985 <vprintfmt+0x437>
+  8005b6:	0f b6 c0             	movzbl %al,%eax
+  8005b9:	ff 24 85 c0 2d 80 00 	jmp    *0x802dc0(,%eax,4)
+  8005c0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8005c3:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8005c7:	eb d9                	jmp    8005a2 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005c9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8005cc:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8005d0:	eb d0                	jmp    8005a2 <vprintfmt+0x54>
+  8005d2:	0f b6 d2             	movzbl %dl,%edx
+  8005d5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8005d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005dd:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8005e0:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8005e3:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8005e7:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8005ea:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8005ed:	83 f9 09             	cmp    $0x9,%ecx
+  8005f0:	77 55                	ja     800647 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8005f2:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8005f5:	eb e9                	jmp    8005e0 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8005f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fa:	8b 00                	mov    (%eax),%eax
+  8005fc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800602:	8d 40 04             	lea    0x4(%eax),%eax
+  800605:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800608:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80060b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80060f:	79 91                	jns    8005a2 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800611:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800614:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800617:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80061e:	eb 82                	jmp    8005a2 <vprintfmt+0x54>
+			if (width < 0)
+  800620:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800623:	85 d2                	test   %edx,%edx
+  800625:	b8 00 00 00 00       	mov    $0x0,%eax
+  80062a:	0f 49 c2             	cmovns %edx,%eax
+  80062d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800630:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800633:	e9 6a ff ff ff       	jmp    8005a2 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800638:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80063b:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800642:	e9 5b ff ff ff       	jmp    8005a2 <vprintfmt+0x54>
+  800647:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80064a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80064d:	eb bc                	jmp    80060b <vprintfmt+0xbd>
+			lflag++;
+  80064f:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800652:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800655:	e9 48 ff ff ff       	jmp    8005a2 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80065a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065d:	8d 78 04             	lea    0x4(%eax),%edi
+  800660:	83 ec 08             	sub    $0x8,%esp
+  800663:	53                   	push   %ebx
+  800664:	ff 30                	push   (%eax)
+  800666:	ff d6                	call   *%esi
+			break;
+  800668:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80066b:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80066e:	e9 b1 02 00 00       	jmp    800924 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800673:	8b 45 14             	mov    0x14(%ebp),%eax
+  800676:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800679:	8b 10                	mov    (%eax),%edx
+  80067b:	89 d0                	mov    %edx,%eax
+  80067d:	f7 d8                	neg    %eax
+  80067f:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800682:	83 f8 0d             	cmp    $0xd,%eax
+  800685:	7f 23                	jg     8006aa <vprintfmt+0x15c>
+  800687:	8b 14 85 20 2f 80 00 	mov    0x802f20(,%eax,4),%edx
+  80068e:	85 d2                	test   %edx,%edx
+  800690:	74 18                	je     8006aa <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800692:	52                   	push   %edx
+  800693:	68 fc 2c 80 00       	push   $0x802cfc
+  800698:	53                   	push   %ebx
+  800699:	56                   	push   %esi
+  80069a:	e8 92 fe ff ff       	call   800531 <printfmt>
+  80069f:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006a2:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8006a5:	e9 7a 02 00 00       	jmp    800924 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8006aa:	50                   	push   %eax
+  8006ab:	68 f3 2c 80 00       	push   $0x802cf3
+  8006b0:	53                   	push   %ebx
+  8006b1:	56                   	push   %esi
+  8006b2:	e8 7a fe ff ff       	call   800531 <printfmt>
+  8006b7:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006ba:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8006bd:	e9 62 02 00 00       	jmp    800924 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c5:	83 c0 04             	add    $0x4,%eax
+  8006c8:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8006cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ce:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8006d0:	85 c9                	test   %ecx,%ecx
+  8006d2:	b8 ec 2c 80 00       	mov    $0x802cec,%eax
+  8006d7:	0f 45 c1             	cmovne %ecx,%eax
+  8006da:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8006dd:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8006e1:	7e 06                	jle    8006e9 <vprintfmt+0x19b>
+  8006e3:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8006e7:	75 0b                	jne    8006f4 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006e9:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8006ec:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8006ef:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006f2:	eb 5c                	jmp    800750 <vprintfmt+0x202>
+  8006f4:	83 ec 08             	sub    $0x8,%esp
+  8006f7:	ff 75 d0             	push   -0x30(%ebp)
+  8006fa:	ff 75 cc             	push   -0x34(%ebp)
+  8006fd:	e8 20 03 00 00       	call   800a22 <strnlen>
+  800702:	89 c2                	mov    %eax,%edx
+  800704:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800707:	29 d0                	sub    %edx,%eax
+  800709:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80070c:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800710:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800713:	89 75 08             	mov    %esi,0x8(%ebp)
+  800716:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800718:	eb 0e                	jmp    800728 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80071a:	83 ec 08             	sub    $0x8,%esp
+  80071d:	53                   	push   %ebx
+  80071e:	57                   	push   %edi
+  80071f:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800722:	83 ee 01             	sub    $0x1,%esi
+  800725:	83 c4 10             	add    $0x10,%esp
+  800728:	85 f6                	test   %esi,%esi
+  80072a:	7f ee                	jg     80071a <vprintfmt+0x1cc>
+  80072c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80072f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800732:	85 c0                	test   %eax,%eax
+  800734:	ba 00 00 00 00       	mov    $0x0,%edx
+  800739:	0f 49 d0             	cmovns %eax,%edx
+  80073c:	29 d0                	sub    %edx,%eax
+  80073e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800741:	eb a6                	jmp    8006e9 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800743:	83 ec 08             	sub    $0x8,%esp
+  800746:	53                   	push   %ebx
+  800747:	52                   	push   %edx
+  800748:	ff 55 08             	call   *0x8(%ebp)
+  80074b:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80074e:	89 f1                	mov    %esi,%ecx
+  800750:	8d 71 01             	lea    0x1(%ecx),%esi
+  800753:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800757:	0f be d0             	movsbl %al,%edx
+  80075a:	85 d2                	test   %edx,%edx
+  80075c:	74 28                	je     800786 <vprintfmt+0x238>
+  80075e:	85 ff                	test   %edi,%edi
+  800760:	78 05                	js     800767 <vprintfmt+0x219>
+  800762:	83 ef 01             	sub    $0x1,%edi
+  800765:	78 30                	js     800797 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800767:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80076b:	74 d6                	je     800743 <vprintfmt+0x1f5>
+  80076d:	0f be c0             	movsbl %al,%eax
+  800770:	83 e8 20             	sub    $0x20,%eax
+  800773:	83 f8 5e             	cmp    $0x5e,%eax
+  800776:	76 cb                	jbe    800743 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800778:	83 ec 08             	sub    $0x8,%esp
+  80077b:	53                   	push   %ebx
+  80077c:	6a 3f                	push   $0x3f
+  80077e:	ff 55 08             	call   *0x8(%ebp)
+  800781:	83 c4 10             	add    $0x10,%esp
+  800784:	eb c8                	jmp    80074e <vprintfmt+0x200>
+  800786:	8b 75 08             	mov    0x8(%ebp),%esi
+  800789:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80078c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80078f:	01 d0                	add    %edx,%eax
+  800791:	29 c8                	sub    %ecx,%eax
+  800793:	89 c7                	mov    %eax,%edi
+  800795:	eb 13                	jmp    8007aa <vprintfmt+0x25c>
+  800797:	8b 75 08             	mov    0x8(%ebp),%esi
+  80079a:	eb ed                	jmp    800789 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80079c:	83 ec 08             	sub    $0x8,%esp
+  80079f:	53                   	push   %ebx
+  8007a0:	6a 20                	push   $0x20
+  8007a2:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8007a4:	83 ef 01             	sub    $0x1,%edi
+  8007a7:	83 c4 10             	add    $0x10,%esp
+  8007aa:	85 ff                	test   %edi,%edi
+  8007ac:	7f ee                	jg     80079c <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8007ae:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8007b1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007b4:	e9 6b 01 00 00       	jmp    800924 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8007b9:	83 f9 01             	cmp    $0x1,%ecx
+  8007bc:	7f 1f                	jg     8007dd <vprintfmt+0x28f>
+	else if (lflag)
+  8007be:	85 c9                	test   %ecx,%ecx
+  8007c0:	74 67                	je     800829 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8007c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c5:	8b 00                	mov    (%eax),%eax
+  8007c7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007ca:	89 c1                	mov    %eax,%ecx
+  8007cc:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007cf:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d5:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007db:	eb 17                	jmp    8007f4 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8007dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e0:	8b 50 04             	mov    0x4(%eax),%edx
+  8007e3:	8b 00                	mov    (%eax),%eax
+  8007e5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007e8:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8007eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ee:	8d 40 08             	lea    0x8(%eax),%eax
+  8007f1:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8007f4:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007f7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8007fa:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8007ff:	85 c9                	test   %ecx,%ecx
+  800801:	0f 89 03 01 00 00    	jns    80090a <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800807:	83 ec 08             	sub    $0x8,%esp
+  80080a:	53                   	push   %ebx
+  80080b:	6a 2d                	push   $0x2d
+  80080d:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80080f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800812:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800815:	f7 da                	neg    %edx
+  800817:	83 d1 00             	adc    $0x0,%ecx
+  80081a:	f7 d9                	neg    %ecx
+  80081c:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80081f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800824:	e9 e1 00 00 00       	jmp    80090a <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800829:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082c:	8b 00                	mov    (%eax),%eax
+  80082e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800831:	89 c1                	mov    %eax,%ecx
+  800833:	c1 f9 1f             	sar    $0x1f,%ecx
+  800836:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800839:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083c:	8d 40 04             	lea    0x4(%eax),%eax
+  80083f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800842:	eb b0                	jmp    8007f4 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800844:	83 f9 01             	cmp    $0x1,%ecx
+  800847:	7f 1e                	jg     800867 <vprintfmt+0x319>
+	else if (lflag)
+  800849:	85 c9                	test   %ecx,%ecx
+  80084b:	74 32                	je     80087f <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  80084d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800850:	8b 10                	mov    (%eax),%edx
+  800852:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800857:	8d 40 04             	lea    0x4(%eax),%eax
+  80085a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80085d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800862:	e9 a3 00 00 00       	jmp    80090a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800867:	8b 45 14             	mov    0x14(%ebp),%eax
+  80086a:	8b 10                	mov    (%eax),%edx
+  80086c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80086f:	8d 40 08             	lea    0x8(%eax),%eax
+  800872:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800875:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80087a:	e9 8b 00 00 00       	jmp    80090a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80087f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800882:	8b 10                	mov    (%eax),%edx
+  800884:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800889:	8d 40 04             	lea    0x4(%eax),%eax
+  80088c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80088f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800894:	eb 74                	jmp    80090a <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800896:	83 f9 01             	cmp    $0x1,%ecx
+  800899:	7f 1b                	jg     8008b6 <vprintfmt+0x368>
+	else if (lflag)
+  80089b:	85 c9                	test   %ecx,%ecx
+  80089d:	74 2c                	je     8008cb <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  80089f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a2:	8b 10                	mov    (%eax),%edx
+  8008a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008a9:	8d 40 04             	lea    0x4(%eax),%eax
+  8008ac:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8008af:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8008b4:	eb 54                	jmp    80090a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8008b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b9:	8b 10                	mov    (%eax),%edx
+  8008bb:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008be:	8d 40 08             	lea    0x8(%eax),%eax
+  8008c1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8008c4:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8008c9:	eb 3f                	jmp    80090a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8008cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ce:	8b 10                	mov    (%eax),%edx
+  8008d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008d5:	8d 40 04             	lea    0x4(%eax),%eax
+  8008d8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8008db:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8008e0:	eb 28                	jmp    80090a <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8008e2:	83 ec 08             	sub    $0x8,%esp
+  8008e5:	53                   	push   %ebx
+  8008e6:	6a 30                	push   $0x30
+  8008e8:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8008ea:	83 c4 08             	add    $0x8,%esp
+  8008ed:	53                   	push   %ebx
+  8008ee:	6a 78                	push   $0x78
+  8008f0:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8008f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f5:	8b 10                	mov    (%eax),%edx
+  8008f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8008fc:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8008ff:	8d 40 04             	lea    0x4(%eax),%eax
+  800902:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800905:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80090a:	83 ec 0c             	sub    $0xc,%esp
+  80090d:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800911:	50                   	push   %eax
+  800912:	ff 75 e0             	push   -0x20(%ebp)
+  800915:	57                   	push   %edi
+  800916:	51                   	push   %ecx
+  800917:	52                   	push   %edx
+  800918:	89 da                	mov    %ebx,%edx
+  80091a:	89 f0                	mov    %esi,%eax
+  80091c:	e8 4a fb ff ff       	call   80046b <printnum>
+			break;
+  800921:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800924:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800927:	e9 40 fc ff ff       	jmp    80056c <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80092c:	83 f9 01             	cmp    $0x1,%ecx
+  80092f:	7f 1b                	jg     80094c <vprintfmt+0x3fe>
+	else if (lflag)
+  800931:	85 c9                	test   %ecx,%ecx
+  800933:	74 2c                	je     800961 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800935:	8b 45 14             	mov    0x14(%ebp),%eax
+  800938:	8b 10                	mov    (%eax),%edx
+  80093a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80093f:	8d 40 04             	lea    0x4(%eax),%eax
+  800942:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800945:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80094a:	eb be                	jmp    80090a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80094c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80094f:	8b 10                	mov    (%eax),%edx
+  800951:	8b 48 04             	mov    0x4(%eax),%ecx
+  800954:	8d 40 08             	lea    0x8(%eax),%eax
+  800957:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80095a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80095f:	eb a9                	jmp    80090a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800961:	8b 45 14             	mov    0x14(%ebp),%eax
+  800964:	8b 10                	mov    (%eax),%edx
+  800966:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80096b:	8d 40 04             	lea    0x4(%eax),%eax
+  80096e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800971:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800976:	eb 92                	jmp    80090a <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800978:	83 ec 08             	sub    $0x8,%esp
+  80097b:	53                   	push   %ebx
+  80097c:	6a 25                	push   $0x25
+  80097e:	ff d6                	call   *%esi
+			break;
+  800980:	83 c4 10             	add    $0x10,%esp
+  800983:	eb 9f                	jmp    800924 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800985:	83 ec 08             	sub    $0x8,%esp
+  800988:	53                   	push   %ebx
+  800989:	6a 25                	push   $0x25
+  80098b:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80098d:	83 c4 10             	add    $0x10,%esp
+  800990:	89 f8                	mov    %edi,%eax
+  800992:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800996:	74 05                	je     80099d <vprintfmt+0x44f>
+  800998:	83 e8 01             	sub    $0x1,%eax
+  80099b:	eb f5                	jmp    800992 <vprintfmt+0x444>
+  80099d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8009a0:	eb 82                	jmp    800924 <vprintfmt+0x3d6>
+
+008009a2 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8009a2:	55                   	push   %ebp
+  8009a3:	89 e5                	mov    %esp,%ebp
+  8009a5:	83 ec 18             	sub    $0x18,%esp
+  8009a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ab:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8009ae:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8009b1:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8009b5:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8009b8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8009bf:	85 c0                	test   %eax,%eax
+  8009c1:	74 26                	je     8009e9 <vsnprintf+0x47>
+  8009c3:	85 d2                	test   %edx,%edx
+  8009c5:	7e 22                	jle    8009e9 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8009c7:	ff 75 14             	push   0x14(%ebp)
+  8009ca:	ff 75 10             	push   0x10(%ebp)
+  8009cd:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8009d0:	50                   	push   %eax
+  8009d1:	68 14 05 80 00       	push   $0x800514
+  8009d6:	e8 73 fb ff ff       	call   80054e <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8009db:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8009de:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8009e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009e4:	83 c4 10             	add    $0x10,%esp
+}
+  8009e7:	c9                   	leave
+  8009e8:	c3                   	ret
+		return -E_INVAL;
+  8009e9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009ee:	eb f7                	jmp    8009e7 <vsnprintf+0x45>
+
+008009f0 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8009f0:	55                   	push   %ebp
+  8009f1:	89 e5                	mov    %esp,%ebp
+  8009f3:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8009f6:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8009f9:	50                   	push   %eax
+  8009fa:	ff 75 10             	push   0x10(%ebp)
+  8009fd:	ff 75 0c             	push   0xc(%ebp)
+  800a00:	ff 75 08             	push   0x8(%ebp)
+  800a03:	e8 9a ff ff ff       	call   8009a2 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800a08:	c9                   	leave
+  800a09:	c3                   	ret
+
+00800a0a <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a0a:	55                   	push   %ebp
+  800a0b:	89 e5                	mov    %esp,%ebp
+  800a0d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800a10:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a15:	eb 03                	jmp    800a1a <strlen+0x10>
+		n++;
+  800a17:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800a1a:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a1e:	75 f7                	jne    800a17 <strlen+0xd>
+	return n;
+}
+  800a20:	5d                   	pop    %ebp
+  800a21:	c3                   	ret
+
+00800a22 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a22:	55                   	push   %ebp
+  800a23:	89 e5                	mov    %esp,%ebp
+  800a25:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a28:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a30:	eb 03                	jmp    800a35 <strnlen+0x13>
+		n++;
+  800a32:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a35:	39 d0                	cmp    %edx,%eax
+  800a37:	74 08                	je     800a41 <strnlen+0x1f>
+  800a39:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a3d:	75 f3                	jne    800a32 <strnlen+0x10>
+  800a3f:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800a41:	89 d0                	mov    %edx,%eax
+  800a43:	5d                   	pop    %ebp
+  800a44:	c3                   	ret
+
+00800a45 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a45:	55                   	push   %ebp
+  800a46:	89 e5                	mov    %esp,%ebp
+  800a48:	53                   	push   %ebx
+  800a49:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a4c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a54:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a58:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a5b:	83 c0 01             	add    $0x1,%eax
+  800a5e:	84 d2                	test   %dl,%dl
+  800a60:	75 f2                	jne    800a54 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a62:	89 c8                	mov    %ecx,%eax
+  800a64:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a67:	c9                   	leave
+  800a68:	c3                   	ret
+
+00800a69 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a69:	55                   	push   %ebp
+  800a6a:	89 e5                	mov    %esp,%ebp
+  800a6c:	53                   	push   %ebx
+  800a6d:	83 ec 10             	sub    $0x10,%esp
+  800a70:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a73:	53                   	push   %ebx
+  800a74:	e8 91 ff ff ff       	call   800a0a <strlen>
+  800a79:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800a7c:	ff 75 0c             	push   0xc(%ebp)
+  800a7f:	01 d8                	add    %ebx,%eax
+  800a81:	50                   	push   %eax
+  800a82:	e8 be ff ff ff       	call   800a45 <strcpy>
+	return dst;
+}
+  800a87:	89 d8                	mov    %ebx,%eax
+  800a89:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a8c:	c9                   	leave
+  800a8d:	c3                   	ret
+
+00800a8e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a8e:	55                   	push   %ebp
+  800a8f:	89 e5                	mov    %esp,%ebp
+  800a91:	56                   	push   %esi
+  800a92:	53                   	push   %ebx
+  800a93:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a96:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a99:	89 f3                	mov    %esi,%ebx
+  800a9b:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a9e:	89 f0                	mov    %esi,%eax
+  800aa0:	eb 0f                	jmp    800ab1 <strncpy+0x23>
+		*dst++ = *src;
+  800aa2:	83 c0 01             	add    $0x1,%eax
+  800aa5:	0f b6 0a             	movzbl (%edx),%ecx
+  800aa8:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800aab:	80 f9 01             	cmp    $0x1,%cl
+  800aae:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800ab1:	39 d8                	cmp    %ebx,%eax
+  800ab3:	75 ed                	jne    800aa2 <strncpy+0x14>
+	}
+	return ret;
+}
+  800ab5:	89 f0                	mov    %esi,%eax
+  800ab7:	5b                   	pop    %ebx
+  800ab8:	5e                   	pop    %esi
+  800ab9:	5d                   	pop    %ebp
+  800aba:	c3                   	ret
+
+00800abb <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800abb:	55                   	push   %ebp
+  800abc:	89 e5                	mov    %esp,%ebp
+  800abe:	56                   	push   %esi
+  800abf:	53                   	push   %ebx
+  800ac0:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ac3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ac6:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800ac9:	89 f0                	mov    %esi,%eax
+  800acb:	85 d2                	test   %edx,%edx
+  800acd:	74 21                	je     800af0 <strlcpy+0x35>
+  800acf:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800ad3:	89 f2                	mov    %esi,%edx
+  800ad5:	eb 09                	jmp    800ae0 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800ad7:	83 c1 01             	add    $0x1,%ecx
+  800ada:	83 c2 01             	add    $0x1,%edx
+  800add:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800ae0:	39 c2                	cmp    %eax,%edx
+  800ae2:	74 09                	je     800aed <strlcpy+0x32>
+  800ae4:	0f b6 19             	movzbl (%ecx),%ebx
+  800ae7:	84 db                	test   %bl,%bl
+  800ae9:	75 ec                	jne    800ad7 <strlcpy+0x1c>
+  800aeb:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800aed:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800af0:	29 f0                	sub    %esi,%eax
+}
+  800af2:	5b                   	pop    %ebx
+  800af3:	5e                   	pop    %esi
+  800af4:	5d                   	pop    %ebp
+  800af5:	c3                   	ret
+
+00800af6 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800af6:	55                   	push   %ebp
+  800af7:	89 e5                	mov    %esp,%ebp
+  800af9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800afc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800aff:	eb 06                	jmp    800b07 <strcmp+0x11>
+		p++, q++;
+  800b01:	83 c1 01             	add    $0x1,%ecx
+  800b04:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800b07:	0f b6 01             	movzbl (%ecx),%eax
+  800b0a:	84 c0                	test   %al,%al
+  800b0c:	74 04                	je     800b12 <strcmp+0x1c>
+  800b0e:	3a 02                	cmp    (%edx),%al
+  800b10:	74 ef                	je     800b01 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b12:	0f b6 c0             	movzbl %al,%eax
+  800b15:	0f b6 12             	movzbl (%edx),%edx
+  800b18:	29 d0                	sub    %edx,%eax
+}
+  800b1a:	5d                   	pop    %ebp
+  800b1b:	c3                   	ret
+
+00800b1c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b1c:	55                   	push   %ebp
+  800b1d:	89 e5                	mov    %esp,%ebp
+  800b1f:	53                   	push   %ebx
+  800b20:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b26:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800b29:	eb 09                	jmp    800b34 <strncmp+0x18>
+		n--, p++, q++;
+  800b2b:	83 ea 01             	sub    $0x1,%edx
+  800b2e:	83 c0 01             	add    $0x1,%eax
+  800b31:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800b34:	85 d2                	test   %edx,%edx
+  800b36:	74 18                	je     800b50 <strncmp+0x34>
+  800b38:	0f b6 18             	movzbl (%eax),%ebx
+  800b3b:	84 db                	test   %bl,%bl
+  800b3d:	74 04                	je     800b43 <strncmp+0x27>
+  800b3f:	3a 19                	cmp    (%ecx),%bl
+  800b41:	74 e8                	je     800b2b <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b43:	0f b6 00             	movzbl (%eax),%eax
+  800b46:	0f b6 11             	movzbl (%ecx),%edx
+  800b49:	29 d0                	sub    %edx,%eax
+}
+  800b4b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b4e:	c9                   	leave
+  800b4f:	c3                   	ret
+		return 0;
+  800b50:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b55:	eb f4                	jmp    800b4b <strncmp+0x2f>
+
+00800b57 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b57:	55                   	push   %ebp
+  800b58:	89 e5                	mov    %esp,%ebp
+  800b5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b5d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b61:	eb 03                	jmp    800b66 <strchr+0xf>
+  800b63:	83 c0 01             	add    $0x1,%eax
+  800b66:	0f b6 10             	movzbl (%eax),%edx
+  800b69:	84 d2                	test   %dl,%dl
+  800b6b:	74 06                	je     800b73 <strchr+0x1c>
+		if (*s == c)
+  800b6d:	38 ca                	cmp    %cl,%dl
+  800b6f:	75 f2                	jne    800b63 <strchr+0xc>
+  800b71:	eb 05                	jmp    800b78 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800b73:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b78:	5d                   	pop    %ebp
+  800b79:	c3                   	ret
+
+00800b7a <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b7a:	55                   	push   %ebp
+  800b7b:	89 e5                	mov    %esp,%ebp
+  800b7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b80:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b84:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800b87:	38 ca                	cmp    %cl,%dl
+  800b89:	74 09                	je     800b94 <strfind+0x1a>
+  800b8b:	84 d2                	test   %dl,%dl
+  800b8d:	74 05                	je     800b94 <strfind+0x1a>
+	for (; *s; s++)
+  800b8f:	83 c0 01             	add    $0x1,%eax
+  800b92:	eb f0                	jmp    800b84 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800b94:	5d                   	pop    %ebp
+  800b95:	c3                   	ret
+
+00800b96 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b96:	55                   	push   %ebp
+  800b97:	89 e5                	mov    %esp,%ebp
+  800b99:	57                   	push   %edi
+  800b9a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b9d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800ba0:	85 c9                	test   %ecx,%ecx
+  800ba2:	74 20                	je     800bc4 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800ba4:	89 f8                	mov    %edi,%eax
+  800ba6:	09 c8                	or     %ecx,%eax
+  800ba8:	a8 03                	test   $0x3,%al
+  800baa:	75 12                	jne    800bbe <memset+0x28>
+		c &= 0xFF;
+  800bac:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800bb0:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800bb6:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800bb9:	fc                   	cld
+  800bba:	f3 ab                	rep stos %eax,%es:(%edi)
+  800bbc:	eb 06                	jmp    800bc4 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800bbe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bc1:	fc                   	cld
+  800bc2:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800bc4:	89 f8                	mov    %edi,%eax
+  800bc6:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800bc9:	c9                   	leave
+  800bca:	c3                   	ret
+
+00800bcb <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800bcb:	55                   	push   %ebp
+  800bcc:	89 e5                	mov    %esp,%ebp
+  800bce:	57                   	push   %edi
+  800bcf:	56                   	push   %esi
+  800bd0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bd3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800bd6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800bd9:	39 c6                	cmp    %eax,%esi
+  800bdb:	73 32                	jae    800c0f <memmove+0x44>
+  800bdd:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800be0:	39 d0                	cmp    %edx,%eax
+  800be2:	73 2b                	jae    800c0f <memmove+0x44>
+		s += n;
+		d += n;
+  800be4:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800be7:	89 d6                	mov    %edx,%esi
+  800be9:	09 fe                	or     %edi,%esi
+  800beb:	09 ce                	or     %ecx,%esi
+  800bed:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800bf3:	75 0e                	jne    800c03 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800bf5:	83 ef 04             	sub    $0x4,%edi
+  800bf8:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800bfb:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800bfe:	fd                   	std
+  800bff:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c01:	eb 09                	jmp    800c0c <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c03:	83 ef 01             	sub    $0x1,%edi
+  800c06:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800c09:	fd                   	std
+  800c0a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c0c:	fc                   	cld
+  800c0d:	eb 1a                	jmp    800c29 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c0f:	89 f2                	mov    %esi,%edx
+  800c11:	09 c2                	or     %eax,%edx
+  800c13:	09 ca                	or     %ecx,%edx
+  800c15:	f6 c2 03             	test   $0x3,%dl
+  800c18:	75 0a                	jne    800c24 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c1a:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c1d:	89 c7                	mov    %eax,%edi
+  800c1f:	fc                   	cld
+  800c20:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c22:	eb 05                	jmp    800c29 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c24:	89 c7                	mov    %eax,%edi
+  800c26:	fc                   	cld
+  800c27:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c29:	5e                   	pop    %esi
+  800c2a:	5f                   	pop    %edi
+  800c2b:	5d                   	pop    %ebp
+  800c2c:	c3                   	ret
+
+00800c2d <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c2d:	55                   	push   %ebp
+  800c2e:	89 e5                	mov    %esp,%ebp
+  800c30:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c33:	ff 75 10             	push   0x10(%ebp)
+  800c36:	ff 75 0c             	push   0xc(%ebp)
+  800c39:	ff 75 08             	push   0x8(%ebp)
+  800c3c:	e8 8a ff ff ff       	call   800bcb <memmove>
+}
+  800c41:	c9                   	leave
+  800c42:	c3                   	ret
+
+00800c43 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c43:	55                   	push   %ebp
+  800c44:	89 e5                	mov    %esp,%ebp
+  800c46:	56                   	push   %esi
+  800c47:	53                   	push   %ebx
+  800c48:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c4b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c4e:	89 c6                	mov    %eax,%esi
+  800c50:	03 75 10             	add    0x10(%ebp),%esi
+  800c53:	eb 06                	jmp    800c5b <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800c55:	83 c0 01             	add    $0x1,%eax
+  800c58:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800c5b:	39 f0                	cmp    %esi,%eax
+  800c5d:	74 14                	je     800c73 <memcmp+0x30>
+		if (*s1 != *s2)
+  800c5f:	0f b6 08             	movzbl (%eax),%ecx
+  800c62:	0f b6 1a             	movzbl (%edx),%ebx
+  800c65:	38 d9                	cmp    %bl,%cl
+  800c67:	74 ec                	je     800c55 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800c69:	0f b6 c1             	movzbl %cl,%eax
+  800c6c:	0f b6 db             	movzbl %bl,%ebx
+  800c6f:	29 d8                	sub    %ebx,%eax
+  800c71:	eb 05                	jmp    800c78 <memcmp+0x35>
+	}
+
+	return 0;
+  800c73:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c78:	5b                   	pop    %ebx
+  800c79:	5e                   	pop    %esi
+  800c7a:	5d                   	pop    %ebp
+  800c7b:	c3                   	ret
+
+00800c7c <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c7c:	55                   	push   %ebp
+  800c7d:	89 e5                	mov    %esp,%ebp
+  800c7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c85:	89 c2                	mov    %eax,%edx
+  800c87:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c8a:	eb 03                	jmp    800c8f <memfind+0x13>
+  800c8c:	83 c0 01             	add    $0x1,%eax
+  800c8f:	39 d0                	cmp    %edx,%eax
+  800c91:	73 04                	jae    800c97 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c93:	38 08                	cmp    %cl,(%eax)
+  800c95:	75 f5                	jne    800c8c <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800c97:	5d                   	pop    %ebp
+  800c98:	c3                   	ret
+
+00800c99 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c99:	55                   	push   %ebp
+  800c9a:	89 e5                	mov    %esp,%ebp
+  800c9c:	57                   	push   %edi
+  800c9d:	56                   	push   %esi
+  800c9e:	53                   	push   %ebx
+  800c9f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800ca5:	eb 03                	jmp    800caa <strtol+0x11>
+		s++;
+  800ca7:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800caa:	0f b6 02             	movzbl (%edx),%eax
+  800cad:	3c 20                	cmp    $0x20,%al
+  800caf:	74 f6                	je     800ca7 <strtol+0xe>
+  800cb1:	3c 09                	cmp    $0x9,%al
+  800cb3:	74 f2                	je     800ca7 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800cb5:	3c 2b                	cmp    $0x2b,%al
+  800cb7:	74 2a                	je     800ce3 <strtol+0x4a>
+	int neg = 0;
+  800cb9:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800cbe:	3c 2d                	cmp    $0x2d,%al
+  800cc0:	74 2b                	je     800ced <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cc2:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800cc8:	75 0f                	jne    800cd9 <strtol+0x40>
+  800cca:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ccd:	74 28                	je     800cf7 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ccf:	85 db                	test   %ebx,%ebx
+  800cd1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cd6:	0f 44 d8             	cmove  %eax,%ebx
+  800cd9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cde:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ce1:	eb 46                	jmp    800d29 <strtol+0x90>
+		s++;
+  800ce3:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800ce6:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ceb:	eb d5                	jmp    800cc2 <strtol+0x29>
+		s++, neg = 1;
+  800ced:	83 c2 01             	add    $0x1,%edx
+  800cf0:	bf 01 00 00 00       	mov    $0x1,%edi
+  800cf5:	eb cb                	jmp    800cc2 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cf7:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800cfb:	74 0e                	je     800d0b <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800cfd:	85 db                	test   %ebx,%ebx
+  800cff:	75 d8                	jne    800cd9 <strtol+0x40>
+		s++, base = 8;
+  800d01:	83 c2 01             	add    $0x1,%edx
+  800d04:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d09:	eb ce                	jmp    800cd9 <strtol+0x40>
+		s += 2, base = 16;
+  800d0b:	83 c2 02             	add    $0x2,%edx
+  800d0e:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d13:	eb c4                	jmp    800cd9 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800d15:	0f be c0             	movsbl %al,%eax
+  800d18:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800d1b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d1e:	7d 3a                	jge    800d5a <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800d20:	83 c2 01             	add    $0x1,%edx
+  800d23:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d27:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800d29:	0f b6 02             	movzbl (%edx),%eax
+  800d2c:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d2f:	89 f3                	mov    %esi,%ebx
+  800d31:	80 fb 09             	cmp    $0x9,%bl
+  800d34:	76 df                	jbe    800d15 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800d36:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d39:	89 f3                	mov    %esi,%ebx
+  800d3b:	80 fb 19             	cmp    $0x19,%bl
+  800d3e:	77 08                	ja     800d48 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800d40:	0f be c0             	movsbl %al,%eax
+  800d43:	83 e8 57             	sub    $0x57,%eax
+  800d46:	eb d3                	jmp    800d1b <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d48:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d4b:	89 f3                	mov    %esi,%ebx
+  800d4d:	80 fb 19             	cmp    $0x19,%bl
+  800d50:	77 08                	ja     800d5a <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800d52:	0f be c0             	movsbl %al,%eax
+  800d55:	83 e8 37             	sub    $0x37,%eax
+  800d58:	eb c1                	jmp    800d1b <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d5a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d5e:	74 05                	je     800d65 <strtol+0xcc>
+		*endptr = (char *) s;
+  800d60:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d63:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800d65:	89 c8                	mov    %ecx,%eax
+  800d67:	f7 d8                	neg    %eax
+  800d69:	85 ff                	test   %edi,%edi
+  800d6b:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d6e:	89 c8                	mov    %ecx,%eax
+  800d70:	5b                   	pop    %ebx
+  800d71:	5e                   	pop    %esi
+  800d72:	5f                   	pop    %edi
+  800d73:	5d                   	pop    %ebp
+  800d74:	c3                   	ret
+
+00800d75 <atoi>:
+
+int
+atoi(const char *s)
+{
+  800d75:	55                   	push   %ebp
+  800d76:	89 e5                	mov    %esp,%ebp
+  800d78:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800d7b:	6a 0a                	push   $0xa
+  800d7d:	6a 00                	push   $0x0
+  800d7f:	ff 75 08             	push   0x8(%ebp)
+  800d82:	e8 12 ff ff ff       	call   800c99 <strtol>
+}
+  800d87:	c9                   	leave
+  800d88:	c3                   	ret
+
+00800d89 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800d89:	55                   	push   %ebp
+  800d8a:	89 e5                	mov    %esp,%ebp
+  800d8c:	57                   	push   %edi
+  800d8d:	56                   	push   %esi
+  800d8e:	53                   	push   %ebx
+  800d8f:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800d95:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800d9b:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800da1:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800da7:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800dae:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800db1:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800db8:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800dbb:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800dc2:	74 76                	je     800e3a <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800dc4:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800dca:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dcd:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800dd3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800dda:	0f 88 06 01 00 00    	js     800ee6 <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800de0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800de7:	0f 84 48 01 00 00    	je     800f35 <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800ded:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800df3:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800df9:	be 00 00 00 00       	mov    $0x0,%esi
+  800dfe:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800e04:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800e07:	55                   	push   %ebp
+  800e08:	68 11 0e 80 00       	push   $0x800e11
+  800e0d:	89 e5                	mov    %esp,%ebp
+  800e0f:	0f 34                	sysenter
+  800e11:	83 c4 04             	add    $0x4,%esp
+  800e14:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800e15:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800e1b:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800e21:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800e24:	0f 85 9a 01 00 00    	jne    800fc4 <page_vec_call+0x23b>
+  800e2a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e2f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e32:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e35:	e9 29 01 00 00       	jmp    800f63 <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800e3a:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800e40:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e43:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800e45:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e4c:	78 2f                	js     800e7d <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800e4e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e55:	74 72                	je     800ec9 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800e57:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800e5d:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800e63:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e68:	89 fb                	mov    %edi,%ebx
+  800e6a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800e6d:	55                   	push   %ebp
+  800e6e:	68 77 0e 80 00       	push   $0x800e77
+  800e73:	89 e5                	mov    %esp,%ebp
+  800e75:	0f 34                	sysenter
+  800e77:	83 c4 04             	add    $0x4,%esp
+  800e7a:	5d                   	pop    %ebp
+	return ret;
+  800e7b:	eb 98                	jmp    800e15 <page_vec_call+0x8c>
+	asm volatile("cpuid"
+  800e7d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e82:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800e84:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800e89:	f6 c6 08             	test   $0x8,%dh
+  800e8c:	74 15                	je     800ea3 <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e8e:	89 c2                	mov    %eax,%edx
+  800e90:	c1 ea 08             	shr    $0x8,%edx
+  800e93:	83 e2 0f             	and    $0xf,%edx
+  800e96:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e9b:	83 fa 06             	cmp    $0x6,%edx
+  800e9e:	74 0e                	je     800eae <page_vec_call+0x125>
+  800ea0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800ea3:	0f b6 c9             	movzbl %cl,%ecx
+  800ea6:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800eac:	eb a0                	jmp    800e4e <page_vec_call+0xc5>
+  800eae:	89 c2                	mov    %eax,%edx
+  800eb0:	c1 ea 04             	shr    $0x4,%edx
+  800eb3:	83 e2 0f             	and    $0xf,%edx
+  800eb6:	83 fa 02             	cmp    $0x2,%edx
+  800eb9:	77 e5                	ja     800ea0 <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800ebb:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ebe:	83 f8 02             	cmp    $0x2,%eax
+  800ec1:	0f 97 c1             	seta   %cl
+  800ec4:	0f b6 c9             	movzbl %cl,%ecx
+  800ec7:	eb d7                	jmp    800ea0 <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800ec9:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ece:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800ed4:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800eda:	89 fb                	mov    %edi,%ebx
+  800edc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800edf:	cd 30                	int    $0x30
+  800ee1:	e9 2f ff ff ff       	jmp    800e15 <page_vec_call+0x8c>
+  800ee6:	b8 01 00 00 00       	mov    $0x1,%eax
+  800eeb:	0f a2                	cpuid
+		return 0;
+  800eed:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800ef2:	f6 c6 08             	test   $0x8,%dh
+  800ef5:	74 15                	je     800f0c <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ef7:	89 c2                	mov    %eax,%edx
+  800ef9:	c1 ea 08             	shr    $0x8,%edx
+  800efc:	83 e2 0f             	and    $0xf,%edx
+  800eff:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f04:	83 fa 06             	cmp    $0x6,%edx
+  800f07:	74 11                	je     800f1a <page_vec_call+0x191>
+  800f09:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f0c:	0f b6 c9             	movzbl %cl,%ecx
+  800f0f:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800f15:	e9 c6 fe ff ff       	jmp    800de0 <page_vec_call+0x57>
+  800f1a:	89 c2                	mov    %eax,%edx
+  800f1c:	c1 ea 04             	shr    $0x4,%edx
+  800f1f:	83 e2 0f             	and    $0xf,%edx
+  800f22:	83 fa 02             	cmp    $0x2,%edx
+  800f25:	77 e2                	ja     800f09 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800f27:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f2a:	83 f8 02             	cmp    $0x2,%eax
+  800f2d:	0f 97 c1             	seta   %cl
+  800f30:	0f b6 c9             	movzbl %cl,%ecx
+  800f33:	eb d4                	jmp    800f09 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800f35:	be 00 00 00 00       	mov    $0x0,%esi
+  800f3a:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800f40:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800f46:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800f4c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800f4f:	cd 30                	int    $0x30
+  800f51:	e9 bf fe ff ff       	jmp    800e15 <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800f56:	29 da                	sub    %ebx,%edx
+			vec++;
+  800f58:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800f5b:	83 e8 01             	sub    $0x1,%eax
+  800f5e:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800f63:	85 c0                	test   %eax,%eax
+  800f65:	74 58                	je     800fbf <page_vec_call+0x236>
+  800f67:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800f6a:	39 da                	cmp    %ebx,%edx
+  800f6c:	73 e8                	jae    800f56 <page_vec_call+0x1cd>
+  800f6e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800f71:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800f74:	84 c9                	test   %cl,%cl
+  800f76:	74 06                	je     800f7e <page_vec_call+0x1f5>
+  800f78:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800f7e:	83 ec 04             	sub    $0x4,%esp
+  800f81:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f84:	c1 e0 04             	shl    $0x4,%eax
+  800f87:	50                   	push   %eax
+  800f88:	ff 75 08             	push   0x8(%ebp)
+  800f8b:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800f91:	53                   	push   %ebx
+  800f92:	e8 34 fc ff ff       	call   800bcb <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800f97:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800f9d:	89 c2                	mov    %eax,%edx
+  800f9f:	c1 e2 0c             	shl    $0xc,%edx
+  800fa2:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  800fa8:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  800fae:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  800fb4:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  800fb7:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  800fba:	e9 f2 fd ff ff       	jmp    800db1 <page_vec_call+0x28>
+			r = 0;
+  800fbf:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  800fc4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800fc8:	74 0b                	je     800fd5 <page_vec_call+0x24c>
+		*done = total;
+  800fca:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800fcd:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  800fd3:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  800fd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fd8:	5b                   	pop    %ebx
+  800fd9:	5e                   	pop    %esi
+  800fda:	5f                   	pop    %edi
+  800fdb:	5d                   	pop    %ebp
+  800fdc:	c3                   	ret
+
+00800fdd <sys_cputs>:
+{
+  800fdd:	55                   	push   %ebp
+  800fde:	89 e5                	mov    %esp,%ebp
+  800fe0:	57                   	push   %edi
+  800fe1:	56                   	push   %esi
+  800fe2:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800fe3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fea:	78 2d                	js     801019 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800fec:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ff3:	74 70                	je     801065 <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800ff5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ffa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801000:	89 c3                	mov    %eax,%ebx
+  801002:	89 c7                	mov    %eax,%edi
+  801004:	89 c6                	mov    %eax,%esi
+  801006:	55                   	push   %ebp
+  801007:	68 10 10 80 00       	push   $0x801010
+  80100c:	89 e5                	mov    %esp,%ebp
+  80100e:	0f 34                	sysenter
+  801010:	83 c4 04             	add    $0x4,%esp
+  801013:	5d                   	pop    %ebp
+}
+  801014:	5b                   	pop    %ebx
+  801015:	5e                   	pop    %esi
+  801016:	5f                   	pop    %edi
+  801017:	5d                   	pop    %ebp
+  801018:	c3                   	ret
+  801019:	b8 01 00 00 00       	mov    $0x1,%eax
+  80101e:	0f a2                	cpuid
+		return 0;
+  801020:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801025:	f6 c6 08             	test   $0x8,%dh
+  801028:	74 15                	je     80103f <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80102a:	89 c2                	mov    %eax,%edx
+  80102c:	c1 ea 08             	shr    $0x8,%edx
+  80102f:	83 e2 0f             	and    $0xf,%edx
+  801032:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801037:	83 fa 06             	cmp    $0x6,%edx
+  80103a:	74 0e                	je     80104a <sys_cputs+0x6d>
+  80103c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80103f:	0f b6 c9             	movzbl %cl,%ecx
+  801042:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801048:	eb a2                	jmp    800fec <sys_cputs+0xf>
+  80104a:	89 c2                	mov    %eax,%edx
+  80104c:	c1 ea 04             	shr    $0x4,%edx
+  80104f:	83 e2 0f             	and    $0xf,%edx
+  801052:	83 fa 02             	cmp    $0x2,%edx
+  801055:	77 e5                	ja     80103c <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  801057:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80105a:	83 f8 02             	cmp    $0x2,%eax
+  80105d:	0f 97 c1             	seta   %cl
+  801060:	0f b6 c9             	movzbl %cl,%ecx
+  801063:	eb d7                	jmp    80103c <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  801065:	b8 00 00 00 00       	mov    $0x0,%eax
+  80106a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801070:	89 c3                	mov    %eax,%ebx
+  801072:	89 c7                	mov    %eax,%edi
+  801074:	89 c6                	mov    %eax,%esi
+  801076:	cd 30                	int    $0x30
+}
+  801078:	eb 9a                	jmp    801014 <sys_cputs+0x37>
+
+0080107a <sys_cgetc>:
+{
+  80107a:	55                   	push   %ebp
+  80107b:	89 e5                	mov    %esp,%ebp
+  80107d:	57                   	push   %edi
+  80107e:	56                   	push   %esi
+  80107f:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801080:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801087:	78 2e                	js     8010b7 <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  801089:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801090:	74 71                	je     801103 <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  801092:	ba 00 00 00 00       	mov    $0x0,%edx
+  801097:	b8 01 00 00 00       	mov    $0x1,%eax
+  80109c:	89 d1                	mov    %edx,%ecx
+  80109e:	89 d3                	mov    %edx,%ebx
+  8010a0:	89 d7                	mov    %edx,%edi
+  8010a2:	89 d6                	mov    %edx,%esi
+  8010a4:	55                   	push   %ebp
+  8010a5:	68 ae 10 80 00       	push   $0x8010ae
+  8010aa:	89 e5                	mov    %esp,%ebp
+  8010ac:	0f 34                	sysenter
+  8010ae:	83 c4 04             	add    $0x4,%esp
+  8010b1:	5d                   	pop    %ebp
+}
+  8010b2:	5b                   	pop    %ebx
+  8010b3:	5e                   	pop    %esi
+  8010b4:	5f                   	pop    %edi
+  8010b5:	5d                   	pop    %ebp
+  8010b6:	c3                   	ret
+  8010b7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010bc:	0f a2                	cpuid
+		return 0;
+  8010be:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8010c3:	f6 c6 08             	test   $0x8,%dh
+  8010c6:	74 15                	je     8010dd <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010c8:	89 c2                	mov    %eax,%edx
+  8010ca:	c1 ea 08             	shr    $0x8,%edx
+  8010cd:	83 e2 0f             	and    $0xf,%edx
+  8010d0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8010d5:	83 fa 06             	cmp    $0x6,%edx
+  8010d8:	74 0e                	je     8010e8 <sys_cgetc+0x6e>
+  8010da:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8010dd:	0f b6 c9             	movzbl %cl,%ecx
+  8010e0:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8010e6:	eb a1                	jmp    801089 <sys_cgetc+0xf>
+  8010e8:	89 c2                	mov    %eax,%edx
+  8010ea:	c1 ea 04             	shr    $0x4,%edx
+  8010ed:	83 e2 0f             	and    $0xf,%edx
+  8010f0:	83 fa 02             	cmp    $0x2,%edx
+  8010f3:	77 e5                	ja     8010da <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  8010f5:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010f8:	83 f8 02             	cmp    $0x2,%eax
+  8010fb:	0f 97 c1             	seta   %cl
+  8010fe:	0f b6 c9             	movzbl %cl,%ecx
+  801101:	eb d7                	jmp    8010da <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  801103:	ba 00 00 00 00       	mov    $0x0,%edx
+  801108:	b8 01 00 00 00       	mov    $0x1,%eax
+  80110d:	89 d1                	mov    %edx,%ecx
+  80110f:	89 d3                	mov    %edx,%ebx
+  801111:	89 d7                	mov    %edx,%edi
+  801113:	89 d6                	mov    %edx,%esi
+  801115:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801117:	eb 99                	jmp    8010b2 <sys_cgetc+0x38>
+
+00801119 <sys_env_destroy>:
+{
+  801119:	55                   	push   %ebp
+  80111a:	89 e5                	mov    %esp,%ebp
+  80111c:	57                   	push   %edi
+  80111d:	56                   	push   %esi
+  80111e:	53                   	push   %ebx
+  80111f:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801122:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801129:	78 36                	js     801161 <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  80112b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801132:	74 79                	je     8011ad <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  801134:	8b 55 08             	mov    0x8(%ebp),%edx
+  801137:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80113c:	b8 03 00 00 00       	mov    $0x3,%eax
+  801141:	89 cb                	mov    %ecx,%ebx
+  801143:	89 cf                	mov    %ecx,%edi
+  801145:	89 ce                	mov    %ecx,%esi
+  801147:	55                   	push   %ebp
+  801148:	68 51 11 80 00       	push   $0x801151
+  80114d:	89 e5                	mov    %esp,%ebp
+  80114f:	0f 34                	sysenter
+  801151:	83 c4 04             	add    $0x4,%esp
+  801154:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801155:	85 c0                	test   %eax,%eax
+  801157:	7f 6b                	jg     8011c4 <sys_env_destroy+0xab>
+}
+  801159:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80115c:	5b                   	pop    %ebx
+  80115d:	5e                   	pop    %esi
+  80115e:	5f                   	pop    %edi
+  80115f:	5d                   	pop    %ebp
+  801160:	c3                   	ret
+  801161:	b8 01 00 00 00       	mov    $0x1,%eax
+  801166:	0f a2                	cpuid
+		return 0;
+  801168:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80116d:	f6 c6 08             	test   $0x8,%dh
+  801170:	74 15                	je     801187 <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801172:	89 c2                	mov    %eax,%edx
+  801174:	c1 ea 08             	shr    $0x8,%edx
+  801177:	83 e2 0f             	and    $0xf,%edx
+  80117a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80117f:	83 fa 06             	cmp    $0x6,%edx
+  801182:	74 0e                	je     801192 <sys_env_destroy+0x79>
+  801184:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801187:	0f b6 c9             	movzbl %cl,%ecx
+  80118a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801190:	eb 99                	jmp    80112b <sys_env_destroy+0x12>
+  801192:	89 c2                	mov    %eax,%edx
+  801194:	c1 ea 04             	shr    $0x4,%edx
+  801197:	83 e2 0f             	and    $0xf,%edx
+  80119a:	83 fa 02             	cmp    $0x2,%edx
+  80119d:	77 e5                	ja     801184 <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  80119f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011a2:	83 f8 02             	cmp    $0x2,%eax
+  8011a5:	0f 97 c1             	seta   %cl
+  8011a8:	0f b6 c9             	movzbl %cl,%ecx
+  8011ab:	eb d7                	jmp    801184 <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  8011ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011b2:	b8 03 00 00 00       	mov    $0x3,%eax
+  8011b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ba:	89 cb                	mov    %ecx,%ebx
+  8011bc:	89 cf                	mov    %ecx,%edi
+  8011be:	89 ce                	mov    %ecx,%esi
+  8011c0:	cd 30                	int    $0x30
+  8011c2:	eb 91                	jmp    801155 <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011c4:	83 ec 0c             	sub    $0xc,%esp
+  8011c7:	50                   	push   %eax
+  8011c8:	6a 03                	push   $0x3
+  8011ca:	68 99 2f 80 00       	push   $0x802f99
+  8011cf:	6a 4a                	push   $0x4a
+  8011d1:	68 b6 2f 80 00       	push   $0x802fb6
+  8011d6:	e8 68 f1 ff ff       	call   800343 <_panic>
+
+008011db <sys_getenvid>:
+{
+  8011db:	55                   	push   %ebp
+  8011dc:	89 e5                	mov    %esp,%ebp
+  8011de:	57                   	push   %edi
+  8011df:	56                   	push   %esi
+  8011e0:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8011e1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8011e8:	78 2e                	js     801218 <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  8011ea:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8011f1:	74 71                	je     801264 <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  8011f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011f8:	b8 02 00 00 00       	mov    $0x2,%eax
+  8011fd:	89 d1                	mov    %edx,%ecx
+  8011ff:	89 d3                	mov    %edx,%ebx
+  801201:	89 d7                	mov    %edx,%edi
+  801203:	89 d6                	mov    %edx,%esi
+  801205:	55                   	push   %ebp
+  801206:	68 0f 12 80 00       	push   $0x80120f
+  80120b:	89 e5                	mov    %esp,%ebp
+  80120d:	0f 34                	sysenter
+  80120f:	83 c4 04             	add    $0x4,%esp
+  801212:	5d                   	pop    %ebp
+}
+  801213:	5b                   	pop    %ebx
+  801214:	5e                   	pop    %esi
+  801215:	5f                   	pop    %edi
+  801216:	5d                   	pop    %ebp
+  801217:	c3                   	ret
+  801218:	b8 01 00 00 00       	mov    $0x1,%eax
+  80121d:	0f a2                	cpuid
+		return 0;
+  80121f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801224:	f6 c6 08             	test   $0x8,%dh
+  801227:	74 15                	je     80123e <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801229:	89 c2                	mov    %eax,%edx
+  80122b:	c1 ea 08             	shr    $0x8,%edx
+  80122e:	83 e2 0f             	and    $0xf,%edx
+  801231:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801236:	83 fa 06             	cmp    $0x6,%edx
+  801239:	74 0e                	je     801249 <sys_getenvid+0x6e>
+  80123b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80123e:	0f b6 c9             	movzbl %cl,%ecx
+  801241:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801247:	eb a1                	jmp    8011ea <sys_getenvid+0xf>
+  801249:	89 c2                	mov    %eax,%edx
+  80124b:	c1 ea 04             	shr    $0x4,%edx
+  80124e:	83 e2 0f             	and    $0xf,%edx
+  801251:	83 fa 02             	cmp    $0x2,%edx
+  801254:	77 e5                	ja     80123b <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  801256:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801259:	83 f8 02             	cmp    $0x2,%eax
+  80125c:	0f 97 c1             	seta   %cl
+  80125f:	0f b6 c9             	movzbl %cl,%ecx
+  801262:	eb d7                	jmp    80123b <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  801264:	ba 00 00 00 00       	mov    $0x0,%edx
+  801269:	b8 02 00 00 00       	mov    $0x2,%eax
+  80126e:	89 d1                	mov    %edx,%ecx
+  801270:	89 d3                	mov    %edx,%ebx
+  801272:	89 d7                	mov    %edx,%edi
+  801274:	89 d6                	mov    %edx,%esi
+  801276:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801278:	eb 99                	jmp    801213 <sys_getenvid+0x38>
+
+0080127a <sys_page_alloc>:
+{
+  80127a:	55                   	push   %ebp
+  80127b:	89 e5                	mov    %esp,%ebp
+  80127d:	57                   	push   %edi
+  80127e:	56                   	push   %esi
+  80127f:	53                   	push   %ebx
+  801280:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801283:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80128a:	78 38                	js     8012c4 <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  80128c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801293:	74 7b                	je     801310 <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  801295:	be 00 00 00 00       	mov    $0x0,%esi
+  80129a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80129d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a0:	b8 04 00 00 00       	mov    $0x4,%eax
+  8012a5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012a8:	89 f7                	mov    %esi,%edi
+  8012aa:	55                   	push   %ebp
+  8012ab:	68 b4 12 80 00       	push   $0x8012b4
+  8012b0:	89 e5                	mov    %esp,%ebp
+  8012b2:	0f 34                	sysenter
+  8012b4:	83 c4 04             	add    $0x4,%esp
+  8012b7:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8012b8:	85 c0                	test   %eax,%eax
+  8012ba:	7f 6d                	jg     801329 <sys_page_alloc+0xaf>
+}
+  8012bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012bf:	5b                   	pop    %ebx
+  8012c0:	5e                   	pop    %esi
+  8012c1:	5f                   	pop    %edi
+  8012c2:	5d                   	pop    %ebp
+  8012c3:	c3                   	ret
+  8012c4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012c9:	0f a2                	cpuid
+		return 0;
+  8012cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8012d0:	f6 c6 08             	test   $0x8,%dh
+  8012d3:	74 15                	je     8012ea <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012d5:	89 c2                	mov    %eax,%edx
+  8012d7:	c1 ea 08             	shr    $0x8,%edx
+  8012da:	83 e2 0f             	and    $0xf,%edx
+  8012dd:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012e2:	83 fa 06             	cmp    $0x6,%edx
+  8012e5:	74 0e                	je     8012f5 <sys_page_alloc+0x7b>
+  8012e7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8012ea:	0f b6 c9             	movzbl %cl,%ecx
+  8012ed:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8012f3:	eb 97                	jmp    80128c <sys_page_alloc+0x12>
+  8012f5:	89 c2                	mov    %eax,%edx
+  8012f7:	c1 ea 04             	shr    $0x4,%edx
+  8012fa:	83 e2 0f             	and    $0xf,%edx
+  8012fd:	83 fa 02             	cmp    $0x2,%edx
+  801300:	77 e5                	ja     8012e7 <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  801302:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801305:	83 f8 02             	cmp    $0x2,%eax
+  801308:	0f 97 c1             	seta   %cl
+  80130b:	0f b6 c9             	movzbl %cl,%ecx
+  80130e:	eb d7                	jmp    8012e7 <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  801310:	be 00 00 00 00       	mov    $0x0,%esi
+  801315:	b8 04 00 00 00       	mov    $0x4,%eax
+  80131a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80131d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801320:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801323:	89 f7                	mov    %esi,%edi
+  801325:	cd 30                	int    $0x30
+  801327:	eb 8f                	jmp    8012b8 <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801329:	83 ec 0c             	sub    $0xc,%esp
+  80132c:	50                   	push   %eax
+  80132d:	6a 04                	push   $0x4
+  80132f:	68 99 2f 80 00       	push   $0x802f99
+  801334:	6a 4a                	push   $0x4a
+  801336:	68 b6 2f 80 00       	push   $0x802fb6
+  80133b:	e8 03 f0 ff ff       	call   800343 <_panic>
+
+00801340 <sys_page_map>:
+{
+  801340:	55                   	push   %ebp
+  801341:	89 e5                	mov    %esp,%ebp
+  801343:	57                   	push   %edi
+  801344:	56                   	push   %esi
+  801345:	53                   	push   %ebx
+  801346:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801349:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801350:	78 37                	js     801389 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  801352:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801359:	74 7a                	je     8013d5 <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  80135b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80135e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801361:	b8 05 00 00 00       	mov    $0x5,%eax
+  801366:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801369:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80136c:	8b 75 18             	mov    0x18(%ebp),%esi
+  80136f:	55                   	push   %ebp
+  801370:	68 79 13 80 00       	push   $0x801379
+  801375:	89 e5                	mov    %esp,%ebp
+  801377:	0f 34                	sysenter
+  801379:	83 c4 04             	add    $0x4,%esp
+  80137c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80137d:	85 c0                	test   %eax,%eax
+  80137f:	7f 6c                	jg     8013ed <sys_page_map+0xad>
+}
+  801381:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801384:	5b                   	pop    %ebx
+  801385:	5e                   	pop    %esi
+  801386:	5f                   	pop    %edi
+  801387:	5d                   	pop    %ebp
+  801388:	c3                   	ret
+  801389:	b8 01 00 00 00       	mov    $0x1,%eax
+  80138e:	0f a2                	cpuid
+		return 0;
+  801390:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801395:	f6 c6 08             	test   $0x8,%dh
+  801398:	74 15                	je     8013af <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80139a:	89 c2                	mov    %eax,%edx
+  80139c:	c1 ea 08             	shr    $0x8,%edx
+  80139f:	83 e2 0f             	and    $0xf,%edx
+  8013a2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8013a7:	83 fa 06             	cmp    $0x6,%edx
+  8013aa:	74 0e                	je     8013ba <sys_page_map+0x7a>
+  8013ac:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8013af:	0f b6 c9             	movzbl %cl,%ecx
+  8013b2:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8013b8:	eb 98                	jmp    801352 <sys_page_map+0x12>
+  8013ba:	89 c2                	mov    %eax,%edx
+  8013bc:	c1 ea 04             	shr    $0x4,%edx
+  8013bf:	83 e2 0f             	and    $0xf,%edx
+  8013c2:	83 fa 02             	cmp    $0x2,%edx
+  8013c5:	77 e5                	ja     8013ac <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  8013c7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013ca:	83 f8 02             	cmp    $0x2,%eax
+  8013cd:	0f 97 c1             	seta   %cl
+  8013d0:	0f b6 c9             	movzbl %cl,%ecx
+  8013d3:	eb d7                	jmp    8013ac <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  8013d5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8013da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013e3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013e6:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013e9:	cd 30                	int    $0x30
+  8013eb:	eb 90                	jmp    80137d <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013ed:	83 ec 0c             	sub    $0xc,%esp
+  8013f0:	50                   	push   %eax
+  8013f1:	6a 05                	push   $0x5
+  8013f3:	68 99 2f 80 00       	push   $0x802f99
+  8013f8:	6a 4a                	push   $0x4a
+  8013fa:	68 b6 2f 80 00       	push   $0x802fb6
+  8013ff:	e8 3f ef ff ff       	call   800343 <_panic>
+
+00801404 <sys_page_unmap>:
+{
+  801404:	55                   	push   %ebp
+  801405:	89 e5                	mov    %esp,%ebp
+  801407:	57                   	push   %edi
+  801408:	56                   	push   %esi
+  801409:	53                   	push   %ebx
+  80140a:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80140d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801414:	78 37                	js     80144d <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  801416:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80141d:	74 7a                	je     801499 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  80141f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801424:	8b 55 08             	mov    0x8(%ebp),%edx
+  801427:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80142a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80142f:	89 df                	mov    %ebx,%edi
+  801431:	89 de                	mov    %ebx,%esi
+  801433:	55                   	push   %ebp
+  801434:	68 3d 14 80 00       	push   $0x80143d
+  801439:	89 e5                	mov    %esp,%ebp
+  80143b:	0f 34                	sysenter
+  80143d:	83 c4 04             	add    $0x4,%esp
+  801440:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801441:	85 c0                	test   %eax,%eax
+  801443:	7f 6c                	jg     8014b1 <sys_page_unmap+0xad>
+}
+  801445:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801448:	5b                   	pop    %ebx
+  801449:	5e                   	pop    %esi
+  80144a:	5f                   	pop    %edi
+  80144b:	5d                   	pop    %ebp
+  80144c:	c3                   	ret
+  80144d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801452:	0f a2                	cpuid
+		return 0;
+  801454:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801459:	f6 c6 08             	test   $0x8,%dh
+  80145c:	74 15                	je     801473 <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80145e:	89 c2                	mov    %eax,%edx
+  801460:	c1 ea 08             	shr    $0x8,%edx
+  801463:	83 e2 0f             	and    $0xf,%edx
+  801466:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80146b:	83 fa 06             	cmp    $0x6,%edx
+  80146e:	74 0e                	je     80147e <sys_page_unmap+0x7a>
+  801470:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801473:	0f b6 c9             	movzbl %cl,%ecx
+  801476:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80147c:	eb 98                	jmp    801416 <sys_page_unmap+0x12>
+  80147e:	89 c2                	mov    %eax,%edx
+  801480:	c1 ea 04             	shr    $0x4,%edx
+  801483:	83 e2 0f             	and    $0xf,%edx
+  801486:	83 fa 02             	cmp    $0x2,%edx
+  801489:	77 e5                	ja     801470 <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  80148b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80148e:	83 f8 02             	cmp    $0x2,%eax
+  801491:	0f 97 c1             	seta   %cl
+  801494:	0f b6 c9             	movzbl %cl,%ecx
+  801497:	eb d7                	jmp    801470 <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  801499:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80149e:	b8 06 00 00 00       	mov    $0x6,%eax
+  8014a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014a9:	89 df                	mov    %ebx,%edi
+  8014ab:	89 de                	mov    %ebx,%esi
+  8014ad:	cd 30                	int    $0x30
+  8014af:	eb 90                	jmp    801441 <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014b1:	83 ec 0c             	sub    $0xc,%esp
+  8014b4:	50                   	push   %eax
+  8014b5:	6a 06                	push   $0x6
+  8014b7:	68 99 2f 80 00       	push   $0x802f99
+  8014bc:	6a 4a                	push   $0x4a
+  8014be:	68 b6 2f 80 00       	push   $0x802fb6
+  8014c3:	e8 7b ee ff ff       	call   800343 <_panic>
+
+008014c8 <sys_page_copy>:
+{
+  8014c8:	55                   	push   %ebp
+  8014c9:	89 e5                	mov    %esp,%ebp
+  8014cb:	57                   	push   %edi
+  8014cc:	56                   	push   %esi
+  8014cd:	53                   	push   %ebx
+  8014ce:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8014d1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8014d8:	78 37                	js     801511 <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  8014da:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8014e1:	74 7a                	je     80155d <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  8014e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014e9:	b8 29 00 00 00       	mov    $0x29,%eax
+  8014ee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014f1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014f4:	8b 75 18             	mov    0x18(%ebp),%esi
+  8014f7:	55                   	push   %ebp
+  8014f8:	68 01 15 80 00       	push   $0x801501
+  8014fd:	89 e5                	mov    %esp,%ebp
+  8014ff:	0f 34                	sysenter
+  801501:	83 c4 04             	add    $0x4,%esp
+  801504:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801505:	85 c0                	test   %eax,%eax
+  801507:	7f 6c                	jg     801575 <sys_page_copy+0xad>
+}
+  801509:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80150c:	5b                   	pop    %ebx
+  80150d:	5e                   	pop    %esi
+  80150e:	5f                   	pop    %edi
+  80150f:	5d                   	pop    %ebp
+  801510:	c3                   	ret
+  801511:	b8 01 00 00 00       	mov    $0x1,%eax
+  801516:	0f a2                	cpuid
+		return 0;
+  801518:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80151d:	f6 c6 08             	test   $0x8,%dh
+  801520:	74 15                	je     801537 <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801522:	89 c2                	mov    %eax,%edx
+  801524:	c1 ea 08             	shr    $0x8,%edx
+  801527:	83 e2 0f             	and    $0xf,%edx
+  80152a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80152f:	83 fa 06             	cmp    $0x6,%edx
+  801532:	74 0e                	je     801542 <sys_page_copy+0x7a>
+  801534:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801537:	0f b6 c9             	movzbl %cl,%ecx
+  80153a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801540:	eb 98                	jmp    8014da <sys_page_copy+0x12>
+  801542:	89 c2                	mov    %eax,%edx
+  801544:	c1 ea 04             	shr    $0x4,%edx
+  801547:	83 e2 0f             	and    $0xf,%edx
+  80154a:	83 fa 02             	cmp    $0x2,%edx
+  80154d:	77 e5                	ja     801534 <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  80154f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801552:	83 f8 02             	cmp    $0x2,%eax
+  801555:	0f 97 c1             	seta   %cl
+  801558:	0f b6 c9             	movzbl %cl,%ecx
+  80155b:	eb d7                	jmp    801534 <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  80155d:	b8 29 00 00 00       	mov    $0x29,%eax
+  801562:	8b 55 08             	mov    0x8(%ebp),%edx
+  801565:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801568:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80156b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80156e:	8b 75 18             	mov    0x18(%ebp),%esi
+  801571:	cd 30                	int    $0x30
+  801573:	eb 90                	jmp    801505 <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801575:	83 ec 0c             	sub    $0xc,%esp
+  801578:	50                   	push   %eax
+  801579:	6a 29                	push   $0x29
+  80157b:	68 99 2f 80 00       	push   $0x802f99
+  801580:	6a 4a                	push   $0x4a
+  801582:	68 b6 2f 80 00       	push   $0x802fb6
+  801587:	e8 b7 ed ff ff       	call   800343 <_panic>
+
+0080158c <sys_yield>:
+{
+  80158c:	55                   	push   %ebp
+  80158d:	89 e5                	mov    %esp,%ebp
+  80158f:	57                   	push   %edi
+  801590:	56                   	push   %esi
+  801591:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801592:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801599:	78 2e                	js     8015c9 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  80159b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8015a2:	74 71                	je     801615 <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  8015a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015a9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8015ae:	89 d1                	mov    %edx,%ecx
+  8015b0:	89 d3                	mov    %edx,%ebx
+  8015b2:	89 d7                	mov    %edx,%edi
+  8015b4:	89 d6                	mov    %edx,%esi
+  8015b6:	55                   	push   %ebp
+  8015b7:	68 c0 15 80 00       	push   $0x8015c0
+  8015bc:	89 e5                	mov    %esp,%ebp
+  8015be:	0f 34                	sysenter
+  8015c0:	83 c4 04             	add    $0x4,%esp
+  8015c3:	5d                   	pop    %ebp
+}
+  8015c4:	5b                   	pop    %ebx
+  8015c5:	5e                   	pop    %esi
+  8015c6:	5f                   	pop    %edi
+  8015c7:	5d                   	pop    %ebp
+  8015c8:	c3                   	ret
+  8015c9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015ce:	0f a2                	cpuid
+		return 0;
+  8015d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8015d5:	f6 c6 08             	test   $0x8,%dh
+  8015d8:	74 15                	je     8015ef <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015da:	89 c2                	mov    %eax,%edx
+  8015dc:	c1 ea 08             	shr    $0x8,%edx
+  8015df:	83 e2 0f             	and    $0xf,%edx
+  8015e2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8015e7:	83 fa 06             	cmp    $0x6,%edx
+  8015ea:	74 0e                	je     8015fa <sys_yield+0x6e>
+  8015ec:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8015ef:	0f b6 c9             	movzbl %cl,%ecx
+  8015f2:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8015f8:	eb a1                	jmp    80159b <sys_yield+0xf>
+  8015fa:	89 c2                	mov    %eax,%edx
+  8015fc:	c1 ea 04             	shr    $0x4,%edx
+  8015ff:	83 e2 0f             	and    $0xf,%edx
+  801602:	83 fa 02             	cmp    $0x2,%edx
+  801605:	77 e5                	ja     8015ec <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  801607:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80160a:	83 f8 02             	cmp    $0x2,%eax
+  80160d:	0f 97 c1             	seta   %cl
+  801610:	0f b6 c9             	movzbl %cl,%ecx
+  801613:	eb d7                	jmp    8015ec <sys_yield+0x60>
+		asm volatile("int %1\n"
+  801615:	ba 00 00 00 00       	mov    $0x0,%edx
+  80161a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80161f:	89 d1                	mov    %edx,%ecx
+  801621:	89 d3                	mov    %edx,%ebx
+  801623:	89 d7                	mov    %edx,%edi
+  801625:	89 d6                	mov    %edx,%esi
+  801627:	cd 30                	int    $0x30
+}
+  801629:	eb 99                	jmp    8015c4 <sys_yield+0x38>
+
+0080162b <sys_env_set_status>:
+{
+  80162b:	55                   	push   %ebp
+  80162c:	89 e5                	mov    %esp,%ebp
+  80162e:	57                   	push   %edi
+  80162f:	56                   	push   %esi
+  801630:	53                   	push   %ebx
+  801631:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801634:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80163b:	78 37                	js     801674 <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  80163d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801644:	74 7a                	je     8016c0 <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  801646:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80164b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80164e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801651:	b8 08 00 00 00       	mov    $0x8,%eax
+  801656:	89 df                	mov    %ebx,%edi
+  801658:	89 de                	mov    %ebx,%esi
+  80165a:	55                   	push   %ebp
+  80165b:	68 64 16 80 00       	push   $0x801664
+  801660:	89 e5                	mov    %esp,%ebp
+  801662:	0f 34                	sysenter
+  801664:	83 c4 04             	add    $0x4,%esp
+  801667:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801668:	85 c0                	test   %eax,%eax
+  80166a:	7f 6c                	jg     8016d8 <sys_env_set_status+0xad>
+}
+  80166c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80166f:	5b                   	pop    %ebx
+  801670:	5e                   	pop    %esi
+  801671:	5f                   	pop    %edi
+  801672:	5d                   	pop    %ebp
+  801673:	c3                   	ret
+  801674:	b8 01 00 00 00       	mov    $0x1,%eax
+  801679:	0f a2                	cpuid
+		return 0;
+  80167b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801680:	f6 c6 08             	test   $0x8,%dh
+  801683:	74 15                	je     80169a <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801685:	89 c2                	mov    %eax,%edx
+  801687:	c1 ea 08             	shr    $0x8,%edx
+  80168a:	83 e2 0f             	and    $0xf,%edx
+  80168d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801692:	83 fa 06             	cmp    $0x6,%edx
+  801695:	74 0e                	je     8016a5 <sys_env_set_status+0x7a>
+  801697:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80169a:	0f b6 c9             	movzbl %cl,%ecx
+  80169d:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8016a3:	eb 98                	jmp    80163d <sys_env_set_status+0x12>
+  8016a5:	89 c2                	mov    %eax,%edx
+  8016a7:	c1 ea 04             	shr    $0x4,%edx
+  8016aa:	83 e2 0f             	and    $0xf,%edx
+  8016ad:	83 fa 02             	cmp    $0x2,%edx
+  8016b0:	77 e5                	ja     801697 <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  8016b2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016b5:	83 f8 02             	cmp    $0x2,%eax
+  8016b8:	0f 97 c1             	seta   %cl
+  8016bb:	0f b6 c9             	movzbl %cl,%ecx
+  8016be:	eb d7                	jmp    801697 <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  8016c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016c5:	b8 08 00 00 00       	mov    $0x8,%eax
+  8016ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016d0:	89 df                	mov    %ebx,%edi
+  8016d2:	89 de                	mov    %ebx,%esi
+  8016d4:	cd 30                	int    $0x30
+  8016d6:	eb 90                	jmp    801668 <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016d8:	83 ec 0c             	sub    $0xc,%esp
+  8016db:	50                   	push   %eax
+  8016dc:	6a 08                	push   $0x8
+  8016de:	68 99 2f 80 00       	push   $0x802f99
+  8016e3:	6a 4a                	push   $0x4a
+  8016e5:	68 b6 2f 80 00       	push   $0x802fb6
+  8016ea:	e8 54 ec ff ff       	call   800343 <_panic>
+
+008016ef <sys_sysinfo>:
+{
+  8016ef:	55                   	push   %ebp
+  8016f0:	89 e5                	mov    %esp,%ebp
+  8016f2:	57                   	push   %edi
+  8016f3:	56                   	push   %esi
+  8016f4:	53                   	push   %ebx
+  8016f5:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8016f8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8016ff:	78 36                	js     801737 <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  801701:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801708:	74 79                	je     801783 <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  80170a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80170d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801712:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801717:	89 cb                	mov    %ecx,%ebx
+  801719:	89 cf                	mov    %ecx,%edi
+  80171b:	89 ce                	mov    %ecx,%esi
+  80171d:	55                   	push   %ebp
+  80171e:	68 27 17 80 00       	push   $0x801727
+  801723:	89 e5                	mov    %esp,%ebp
+  801725:	0f 34                	sysenter
+  801727:	83 c4 04             	add    $0x4,%esp
+  80172a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80172b:	85 c0                	test   %eax,%eax
+  80172d:	7f 6b                	jg     80179a <sys_sysinfo+0xab>
+}
+  80172f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801732:	5b                   	pop    %ebx
+  801733:	5e                   	pop    %esi
+  801734:	5f                   	pop    %edi
+  801735:	5d                   	pop    %ebp
+  801736:	c3                   	ret
+  801737:	b8 01 00 00 00       	mov    $0x1,%eax
+  80173c:	0f a2                	cpuid
+		return 0;
+  80173e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801743:	f6 c6 08             	test   $0x8,%dh
+  801746:	74 15                	je     80175d <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801748:	89 c2                	mov    %eax,%edx
+  80174a:	c1 ea 08             	shr    $0x8,%edx
+  80174d:	83 e2 0f             	and    $0xf,%edx
+  801750:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801755:	83 fa 06             	cmp    $0x6,%edx
+  801758:	74 0e                	je     801768 <sys_sysinfo+0x79>
+  80175a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80175d:	0f b6 c9             	movzbl %cl,%ecx
+  801760:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801766:	eb 99                	jmp    801701 <sys_sysinfo+0x12>
+  801768:	89 c2                	mov    %eax,%edx
+  80176a:	c1 ea 04             	shr    $0x4,%edx
+  80176d:	83 e2 0f             	and    $0xf,%edx
+  801770:	83 fa 02             	cmp    $0x2,%edx
+  801773:	77 e5                	ja     80175a <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  801775:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801778:	83 f8 02             	cmp    $0x2,%eax
+  80177b:	0f 97 c1             	seta   %cl
+  80177e:	0f b6 c9             	movzbl %cl,%ecx
+  801781:	eb d7                	jmp    80175a <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  801783:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801788:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80178d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801790:	89 cb                	mov    %ecx,%ebx
+  801792:	89 cf                	mov    %ecx,%edi
+  801794:	89 ce                	mov    %ecx,%esi
+  801796:	cd 30                	int    $0x30
+  801798:	eb 91                	jmp    80172b <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80179a:	83 ec 0c             	sub    $0xc,%esp
+  80179d:	50                   	push   %eax
+  80179e:	6a 0b                	push   $0xb
+  8017a0:	68 99 2f 80 00       	push   $0x802f99
+  8017a5:	6a 4a                	push   $0x4a
+  8017a7:	68 b6 2f 80 00       	push   $0x802fb6
+  8017ac:	e8 92 eb ff ff       	call   800343 <_panic>
+
+008017b1 <sys_env_set_trapframe>:
+{
+  8017b1:	55                   	push   %ebp
+  8017b2:	89 e5                	mov    %esp,%ebp
+  8017b4:	57                   	push   %edi
+  8017b5:	56                   	push   %esi
+  8017b6:	53                   	push   %ebx
+  8017b7:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8017ba:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8017c1:	78 37                	js     8017fa <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  8017c3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8017ca:	74 7a                	je     801846 <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  8017cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017d7:	b8 13 00 00 00       	mov    $0x13,%eax
+  8017dc:	89 df                	mov    %ebx,%edi
+  8017de:	89 de                	mov    %ebx,%esi
+  8017e0:	55                   	push   %ebp
+  8017e1:	68 ea 17 80 00       	push   $0x8017ea
+  8017e6:	89 e5                	mov    %esp,%ebp
+  8017e8:	0f 34                	sysenter
+  8017ea:	83 c4 04             	add    $0x4,%esp
+  8017ed:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8017ee:	85 c0                	test   %eax,%eax
+  8017f0:	7f 6c                	jg     80185e <sys_env_set_trapframe+0xad>
+}
+  8017f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017f5:	5b                   	pop    %ebx
+  8017f6:	5e                   	pop    %esi
+  8017f7:	5f                   	pop    %edi
+  8017f8:	5d                   	pop    %ebp
+  8017f9:	c3                   	ret
+  8017fa:	b8 01 00 00 00       	mov    $0x1,%eax
+  8017ff:	0f a2                	cpuid
+		return 0;
+  801801:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801806:	f6 c6 08             	test   $0x8,%dh
+  801809:	74 15                	je     801820 <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80180b:	89 c2                	mov    %eax,%edx
+  80180d:	c1 ea 08             	shr    $0x8,%edx
+  801810:	83 e2 0f             	and    $0xf,%edx
+  801813:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801818:	83 fa 06             	cmp    $0x6,%edx
+  80181b:	74 0e                	je     80182b <sys_env_set_trapframe+0x7a>
+  80181d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801820:	0f b6 c9             	movzbl %cl,%ecx
+  801823:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801829:	eb 98                	jmp    8017c3 <sys_env_set_trapframe+0x12>
+  80182b:	89 c2                	mov    %eax,%edx
+  80182d:	c1 ea 04             	shr    $0x4,%edx
+  801830:	83 e2 0f             	and    $0xf,%edx
+  801833:	83 fa 02             	cmp    $0x2,%edx
+  801836:	77 e5                	ja     80181d <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  801838:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80183b:	83 f8 02             	cmp    $0x2,%eax
+  80183e:	0f 97 c1             	seta   %cl
+  801841:	0f b6 c9             	movzbl %cl,%ecx
+  801844:	eb d7                	jmp    80181d <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  801846:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80184b:	b8 13 00 00 00       	mov    $0x13,%eax
+  801850:	8b 55 08             	mov    0x8(%ebp),%edx
+  801853:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801856:	89 df                	mov    %ebx,%edi
+  801858:	89 de                	mov    %ebx,%esi
+  80185a:	cd 30                	int    $0x30
+  80185c:	eb 90                	jmp    8017ee <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80185e:	83 ec 0c             	sub    $0xc,%esp
+  801861:	50                   	push   %eax
+  801862:	6a 13                	push   $0x13
+  801864:	68 99 2f 80 00       	push   $0x802f99
+  801869:	6a 4a                	push   $0x4a
+  80186b:	68 b6 2f 80 00       	push   $0x802fb6
+  801870:	e8 ce ea ff ff       	call   800343 <_panic>
+
+00801875 <sys_env_set_stack_limit>:
+{
+  801875:	55                   	push   %ebp
+  801876:	89 e5                	mov    %esp,%ebp
+  801878:	57                   	push   %edi
+  801879:	56                   	push   %esi
+  80187a:	53                   	push   %ebx
+  80187b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80187e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801885:	78 37                	js     8018be <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  801887:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80188e:	74 7a                	je     80190a <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  801890:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801895:	8b 55 08             	mov    0x8(%ebp),%edx
+  801898:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80189b:	b8 19 00 00 00       	mov    $0x19,%eax
+  8018a0:	89 df                	mov    %ebx,%edi
+  8018a2:	89 de                	mov    %ebx,%esi
+  8018a4:	55                   	push   %ebp
+  8018a5:	68 ae 18 80 00       	push   $0x8018ae
+  8018aa:	89 e5                	mov    %esp,%ebp
+  8018ac:	0f 34                	sysenter
+  8018ae:	83 c4 04             	add    $0x4,%esp
+  8018b1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8018b2:	85 c0                	test   %eax,%eax
+  8018b4:	7f 6c                	jg     801922 <sys_env_set_stack_limit+0xad>
+}
+  8018b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018b9:	5b                   	pop    %ebx
+  8018ba:	5e                   	pop    %esi
+  8018bb:	5f                   	pop    %edi
+  8018bc:	5d                   	pop    %ebp
+  8018bd:	c3                   	ret
+  8018be:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018c3:	0f a2                	cpuid
+		return 0;
+  8018c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018ca:	f6 c6 08             	test   $0x8,%dh
+  8018cd:	74 15                	je     8018e4 <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018cf:	89 c2                	mov    %eax,%edx
+  8018d1:	c1 ea 08             	shr    $0x8,%edx
+  8018d4:	83 e2 0f             	and    $0xf,%edx
+  8018d7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018dc:	83 fa 06             	cmp    $0x6,%edx
+  8018df:	74 0e                	je     8018ef <sys_env_set_stack_limit+0x7a>
+  8018e1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8018e4:	0f b6 c9             	movzbl %cl,%ecx
+  8018e7:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8018ed:	eb 98                	jmp    801887 <sys_env_set_stack_limit+0x12>
+  8018ef:	89 c2                	mov    %eax,%edx
+  8018f1:	c1 ea 04             	shr    $0x4,%edx
+  8018f4:	83 e2 0f             	and    $0xf,%edx
+  8018f7:	83 fa 02             	cmp    $0x2,%edx
+  8018fa:	77 e5                	ja     8018e1 <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  8018fc:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018ff:	83 f8 02             	cmp    $0x2,%eax
+  801902:	0f 97 c1             	seta   %cl
+  801905:	0f b6 c9             	movzbl %cl,%ecx
+  801908:	eb d7                	jmp    8018e1 <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  80190a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80190f:	b8 19 00 00 00       	mov    $0x19,%eax
+  801914:	8b 55 08             	mov    0x8(%ebp),%edx
+  801917:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80191a:	89 df                	mov    %ebx,%edi
+  80191c:	89 de                	mov    %ebx,%esi
+  80191e:	cd 30                	int    $0x30
+  801920:	eb 90                	jmp    8018b2 <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801922:	83 ec 0c             	sub    $0xc,%esp
+  801925:	50                   	push   %eax
+  801926:	6a 19                	push   $0x19
+  801928:	68 99 2f 80 00       	push   $0x802f99
+  80192d:	6a 4a                	push   $0x4a
+  80192f:	68 b6 2f 80 00       	push   $0x802fb6
+  801934:	e8 0a ea ff ff       	call   800343 <_panic>
+
+00801939 <sys_env_set_pgfault_upcall>:
+{
+  801939:	55                   	push   %ebp
+  80193a:	89 e5                	mov    %esp,%ebp
+  80193c:	57                   	push   %edi
+  80193d:	56                   	push   %esi
+  80193e:	53                   	push   %ebx
+  80193f:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801942:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801949:	78 37                	js     801982 <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  80194b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801952:	74 7a                	je     8019ce <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  801954:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801959:	8b 55 08             	mov    0x8(%ebp),%edx
+  80195c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80195f:	b8 09 00 00 00       	mov    $0x9,%eax
+  801964:	89 df                	mov    %ebx,%edi
+  801966:	89 de                	mov    %ebx,%esi
+  801968:	55                   	push   %ebp
+  801969:	68 72 19 80 00       	push   $0x801972
+  80196e:	89 e5                	mov    %esp,%ebp
+  801970:	0f 34                	sysenter
+  801972:	83 c4 04             	add    $0x4,%esp
+  801975:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801976:	85 c0                	test   %eax,%eax
+  801978:	7f 6c                	jg     8019e6 <sys_env_set_pgfault_upcall+0xad>
+}
+  80197a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80197d:	5b                   	pop    %ebx
+  80197e:	5e                   	pop    %esi
+  80197f:	5f                   	pop    %edi
+  801980:	5d                   	pop    %ebp
+  801981:	c3                   	ret
+  801982:	b8 01 00 00 00       	mov    $0x1,%eax
+  801987:	0f a2                	cpuid
+		return 0;
+  801989:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80198e:	f6 c6 08             	test   $0x8,%dh
+  801991:	74 15                	je     8019a8 <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801993:	89 c2                	mov    %eax,%edx
+  801995:	c1 ea 08             	shr    $0x8,%edx
+  801998:	83 e2 0f             	and    $0xf,%edx
+  80199b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019a0:	83 fa 06             	cmp    $0x6,%edx
+  8019a3:	74 0e                	je     8019b3 <sys_env_set_pgfault_upcall+0x7a>
+  8019a5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8019a8:	0f b6 c9             	movzbl %cl,%ecx
+  8019ab:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8019b1:	eb 98                	jmp    80194b <sys_env_set_pgfault_upcall+0x12>
+  8019b3:	89 c2                	mov    %eax,%edx
+  8019b5:	c1 ea 04             	shr    $0x4,%edx
+  8019b8:	83 e2 0f             	and    $0xf,%edx
+  8019bb:	83 fa 02             	cmp    $0x2,%edx
+  8019be:	77 e5                	ja     8019a5 <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  8019c0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019c3:	83 f8 02             	cmp    $0x2,%eax
+  8019c6:	0f 97 c1             	seta   %cl
+  8019c9:	0f b6 c9             	movzbl %cl,%ecx
+  8019cc:	eb d7                	jmp    8019a5 <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  8019ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019d3:	b8 09 00 00 00       	mov    $0x9,%eax
+  8019d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019de:	89 df                	mov    %ebx,%edi
+  8019e0:	89 de                	mov    %ebx,%esi
+  8019e2:	cd 30                	int    $0x30
+  8019e4:	eb 90                	jmp    801976 <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8019e6:	83 ec 0c             	sub    $0xc,%esp
+  8019e9:	50                   	push   %eax
+  8019ea:	6a 09                	push   $0x9
+  8019ec:	68 99 2f 80 00       	push   $0x802f99
+  8019f1:	6a 4a                	push   $0x4a
+  8019f3:	68 b6 2f 80 00       	push   $0x802fb6
+  8019f8:	e8 46 e9 ff ff       	call   800343 <_panic>
+
+008019fd <sys_ipc_try_send>:
+{
+  8019fd:	55                   	push   %ebp
+  8019fe:	89 e5                	mov    %esp,%ebp
+  801a00:	57                   	push   %edi
+  801a01:	56                   	push   %esi
+  801a02:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801a03:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801a0a:	78 32                	js     801a3e <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  801a0c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801a13:	74 75                	je     801a8a <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801a15:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a18:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a1b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801a20:	be 00 00 00 00       	mov    $0x0,%esi
+  801a25:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a28:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a2b:	55                   	push   %ebp
+  801a2c:	68 35 1a 80 00       	push   $0x801a35
+  801a31:	89 e5                	mov    %esp,%ebp
+  801a33:	0f 34                	sysenter
+  801a35:	83 c4 04             	add    $0x4,%esp
+  801a38:	5d                   	pop    %ebp
+}
+  801a39:	5b                   	pop    %ebx
+  801a3a:	5e                   	pop    %esi
+  801a3b:	5f                   	pop    %edi
+  801a3c:	5d                   	pop    %ebp
+  801a3d:	c3                   	ret
+  801a3e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a43:	0f a2                	cpuid
+		return 0;
+  801a45:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801a4a:	f6 c6 08             	test   $0x8,%dh
+  801a4d:	74 15                	je     801a64 <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a4f:	89 c2                	mov    %eax,%edx
+  801a51:	c1 ea 08             	shr    $0x8,%edx
+  801a54:	83 e2 0f             	and    $0xf,%edx
+  801a57:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a5c:	83 fa 06             	cmp    $0x6,%edx
+  801a5f:	74 0e                	je     801a6f <sys_ipc_try_send+0x72>
+  801a61:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a64:	0f b6 c9             	movzbl %cl,%ecx
+  801a67:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801a6d:	eb 9d                	jmp    801a0c <sys_ipc_try_send+0xf>
+  801a6f:	89 c2                	mov    %eax,%edx
+  801a71:	c1 ea 04             	shr    $0x4,%edx
+  801a74:	83 e2 0f             	and    $0xf,%edx
+  801a77:	83 fa 02             	cmp    $0x2,%edx
+  801a7a:	77 e5                	ja     801a61 <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  801a7c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a7f:	83 f8 02             	cmp    $0x2,%eax
+  801a82:	0f 97 c1             	seta   %cl
+  801a85:	0f b6 c9             	movzbl %cl,%ecx
+  801a88:	eb d7                	jmp    801a61 <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  801a8a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801a8f:	be 00 00 00 00       	mov    $0x0,%esi
+  801a94:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a9a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a9d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801aa0:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801aa2:	eb 95                	jmp    801a39 <sys_ipc_try_send+0x3c>
+
+00801aa4 <sys_ipc_send>:
+{
+  801aa4:	55                   	push   %ebp
+  801aa5:	89 e5                	mov    %esp,%ebp
+  801aa7:	57                   	push   %edi
+  801aa8:	56                   	push   %esi
+  801aa9:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801aaa:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801ab1:	78 32                	js     801ae5 <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  801ab3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801aba:	74 75                	je     801b31 <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801abc:	8b 55 08             	mov    0x8(%ebp),%edx
+  801abf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ac2:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801ac7:	be 00 00 00 00       	mov    $0x0,%esi
+  801acc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801acf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ad2:	55                   	push   %ebp
+  801ad3:	68 dc 1a 80 00       	push   $0x801adc
+  801ad8:	89 e5                	mov    %esp,%ebp
+  801ada:	0f 34                	sysenter
+  801adc:	83 c4 04             	add    $0x4,%esp
+  801adf:	5d                   	pop    %ebp
+}
+  801ae0:	5b                   	pop    %ebx
+  801ae1:	5e                   	pop    %esi
+  801ae2:	5f                   	pop    %edi
+  801ae3:	5d                   	pop    %ebp
+  801ae4:	c3                   	ret
+  801ae5:	b8 01 00 00 00       	mov    $0x1,%eax
+  801aea:	0f a2                	cpuid
+		return 0;
+  801aec:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801af1:	f6 c6 08             	test   $0x8,%dh
+  801af4:	74 15                	je     801b0b <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801af6:	89 c2                	mov    %eax,%edx
+  801af8:	c1 ea 08             	shr    $0x8,%edx
+  801afb:	83 e2 0f             	and    $0xf,%edx
+  801afe:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b03:	83 fa 06             	cmp    $0x6,%edx
+  801b06:	74 0e                	je     801b16 <sys_ipc_send+0x72>
+  801b08:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b0b:	0f b6 c9             	movzbl %cl,%ecx
+  801b0e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801b14:	eb 9d                	jmp    801ab3 <sys_ipc_send+0xf>
+  801b16:	89 c2                	mov    %eax,%edx
+  801b18:	c1 ea 04             	shr    $0x4,%edx
+  801b1b:	83 e2 0f             	and    $0xf,%edx
+  801b1e:	83 fa 02             	cmp    $0x2,%edx
+  801b21:	77 e5                	ja     801b08 <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  801b23:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b26:	83 f8 02             	cmp    $0x2,%eax
+  801b29:	0f 97 c1             	seta   %cl
+  801b2c:	0f b6 c9             	movzbl %cl,%ecx
+  801b2f:	eb d7                	jmp    801b08 <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  801b31:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801b36:	be 00 00 00 00       	mov    $0x0,%esi
+  801b3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b3e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b41:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b44:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801b47:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801b49:	eb 95                	jmp    801ae0 <sys_ipc_send+0x3c>
+
+00801b4b <sys_ipc_recv>:
+{
+  801b4b:	55                   	push   %ebp
+  801b4c:	89 e5                	mov    %esp,%ebp
+  801b4e:	57                   	push   %edi
+  801b4f:	56                   	push   %esi
+  801b50:	53                   	push   %ebx
+  801b51:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801b54:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b5b:	78 36                	js     801b93 <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  801b5d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b64:	74 79                	je     801bdf <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  801b66:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b69:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b6e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801b73:	89 cb                	mov    %ecx,%ebx
+  801b75:	89 cf                	mov    %ecx,%edi
+  801b77:	89 ce                	mov    %ecx,%esi
+  801b79:	55                   	push   %ebp
+  801b7a:	68 83 1b 80 00       	push   $0x801b83
+  801b7f:	89 e5                	mov    %esp,%ebp
+  801b81:	0f 34                	sysenter
+  801b83:	83 c4 04             	add    $0x4,%esp
+  801b86:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801b87:	85 c0                	test   %eax,%eax
+  801b89:	7f 6b                	jg     801bf6 <sys_ipc_recv+0xab>
+}
+  801b8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b8e:	5b                   	pop    %ebx
+  801b8f:	5e                   	pop    %esi
+  801b90:	5f                   	pop    %edi
+  801b91:	5d                   	pop    %ebp
+  801b92:	c3                   	ret
+  801b93:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b98:	0f a2                	cpuid
+		return 0;
+  801b9a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b9f:	f6 c6 08             	test   $0x8,%dh
+  801ba2:	74 15                	je     801bb9 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ba4:	89 c2                	mov    %eax,%edx
+  801ba6:	c1 ea 08             	shr    $0x8,%edx
+  801ba9:	83 e2 0f             	and    $0xf,%edx
+  801bac:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801bb1:	83 fa 06             	cmp    $0x6,%edx
+  801bb4:	74 0e                	je     801bc4 <sys_ipc_recv+0x79>
+  801bb6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801bb9:	0f b6 c9             	movzbl %cl,%ecx
+  801bbc:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801bc2:	eb 99                	jmp    801b5d <sys_ipc_recv+0x12>
+  801bc4:	89 c2                	mov    %eax,%edx
+  801bc6:	c1 ea 04             	shr    $0x4,%edx
+  801bc9:	83 e2 0f             	and    $0xf,%edx
+  801bcc:	83 fa 02             	cmp    $0x2,%edx
+  801bcf:	77 e5                	ja     801bb6 <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  801bd1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bd4:	83 f8 02             	cmp    $0x2,%eax
+  801bd7:	0f 97 c1             	seta   %cl
+  801bda:	0f b6 c9             	movzbl %cl,%ecx
+  801bdd:	eb d7                	jmp    801bb6 <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  801bdf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801be4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801be9:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bec:	89 cb                	mov    %ecx,%ebx
+  801bee:	89 cf                	mov    %ecx,%edi
+  801bf0:	89 ce                	mov    %ecx,%esi
+  801bf2:	cd 30                	int    $0x30
+  801bf4:	eb 91                	jmp    801b87 <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801bf6:	83 ec 0c             	sub    $0xc,%esp
+  801bf9:	50                   	push   %eax
+  801bfa:	6a 0d                	push   $0xd
+  801bfc:	68 99 2f 80 00       	push   $0x802f99
+  801c01:	6a 4a                	push   $0x4a
+  801c03:	68 b6 2f 80 00       	push   $0x802fb6
+  801c08:	e8 36 e7 ff ff       	call   800343 <_panic>
+
+00801c0d <sys_ipc_send_range>:
+{
+  801c0d:	55                   	push   %ebp
+  801c0e:	89 e5                	mov    %esp,%ebp
+  801c10:	57                   	push   %edi
+  801c11:	56                   	push   %esi
+  801c12:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801c13:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801c1a:	78 30                	js     801c4c <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  801c1c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801c23:	74 73                	je     801c98 <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801c25:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c2b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801c30:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801c33:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801c36:	8b 75 18             	mov    0x18(%ebp),%esi
+  801c39:	55                   	push   %ebp
+  801c3a:	68 43 1c 80 00       	push   $0x801c43
+  801c3f:	89 e5                	mov    %esp,%ebp
+  801c41:	0f 34                	sysenter
+  801c43:	83 c4 04             	add    $0x4,%esp
+  801c46:	5d                   	pop    %ebp
+}
+  801c47:	5b                   	pop    %ebx
+  801c48:	5e                   	pop    %esi
+  801c49:	5f                   	pop    %edi
+  801c4a:	5d                   	pop    %ebp
+  801c4b:	c3                   	ret
+  801c4c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c51:	0f a2                	cpuid
+		return 0;
+  801c53:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801c58:	f6 c6 08             	test   $0x8,%dh
+  801c5b:	74 15                	je     801c72 <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c5d:	89 c2                	mov    %eax,%edx
+  801c5f:	c1 ea 08             	shr    $0x8,%edx
+  801c62:	83 e2 0f             	and    $0xf,%edx
+  801c65:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801c6a:	83 fa 06             	cmp    $0x6,%edx
+  801c6d:	74 0e                	je     801c7d <sys_ipc_send_range+0x70>
+  801c6f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801c72:	0f b6 c9             	movzbl %cl,%ecx
+  801c75:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801c7b:	eb 9f                	jmp    801c1c <sys_ipc_send_range+0xf>
+  801c7d:	89 c2                	mov    %eax,%edx
+  801c7f:	c1 ea 04             	shr    $0x4,%edx
+  801c82:	83 e2 0f             	and    $0xf,%edx
+  801c85:	83 fa 02             	cmp    $0x2,%edx
+  801c88:	77 e5                	ja     801c6f <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  801c8a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c8d:	83 f8 02             	cmp    $0x2,%eax
+  801c90:	0f 97 c1             	seta   %cl
+  801c93:	0f b6 c9             	movzbl %cl,%ecx
+  801c96:	eb d7                	jmp    801c6f <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  801c98:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801c9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ca0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ca3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ca6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ca9:	8b 75 18             	mov    0x18(%ebp),%esi
+  801cac:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  801cae:	eb 97                	jmp    801c47 <sys_ipc_send_range+0x3a>
+
+00801cb0 <sys_ipc_recv_range>:
+{
+  801cb0:	55                   	push   %ebp
+  801cb1:	89 e5                	mov    %esp,%ebp
+  801cb3:	57                   	push   %edi
+  801cb4:	56                   	push   %esi
+  801cb5:	53                   	push   %ebx
+  801cb6:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801cb9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801cc0:	78 37                	js     801cf9 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  801cc2:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801cc9:	74 7a                	je     801d45 <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  801ccb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cd0:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cd3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cd6:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801cdb:	89 df                	mov    %ebx,%edi
+  801cdd:	89 de                	mov    %ebx,%esi
+  801cdf:	55                   	push   %ebp
+  801ce0:	68 e9 1c 80 00       	push   $0x801ce9
+  801ce5:	89 e5                	mov    %esp,%ebp
+  801ce7:	0f 34                	sysenter
+  801ce9:	83 c4 04             	add    $0x4,%esp
+  801cec:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801ced:	85 c0                	test   %eax,%eax
+  801cef:	7f 6c                	jg     801d5d <sys_ipc_recv_range+0xad>
+}
+  801cf1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cf4:	5b                   	pop    %ebx
+  801cf5:	5e                   	pop    %esi
+  801cf6:	5f                   	pop    %edi
+  801cf7:	5d                   	pop    %ebp
+  801cf8:	c3                   	ret
+  801cf9:	b8 01 00 00 00       	mov    $0x1,%eax
+  801cfe:	0f a2                	cpuid
+		return 0;
+  801d00:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801d05:	f6 c6 08             	test   $0x8,%dh
+  801d08:	74 15                	je     801d1f <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d0a:	89 c2                	mov    %eax,%edx
+  801d0c:	c1 ea 08             	shr    $0x8,%edx
+  801d0f:	83 e2 0f             	and    $0xf,%edx
+  801d12:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d17:	83 fa 06             	cmp    $0x6,%edx
+  801d1a:	74 0e                	je     801d2a <sys_ipc_recv_range+0x7a>
+  801d1c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801d1f:	0f b6 c9             	movzbl %cl,%ecx
+  801d22:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801d28:	eb 98                	jmp    801cc2 <sys_ipc_recv_range+0x12>
+  801d2a:	89 c2                	mov    %eax,%edx
+  801d2c:	c1 ea 04             	shr    $0x4,%edx
+  801d2f:	83 e2 0f             	and    $0xf,%edx
+  801d32:	83 fa 02             	cmp    $0x2,%edx
+  801d35:	77 e5                	ja     801d1c <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801d37:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d3a:	83 f8 02             	cmp    $0x2,%eax
+  801d3d:	0f 97 c1             	seta   %cl
+  801d40:	0f b6 c9             	movzbl %cl,%ecx
+  801d43:	eb d7                	jmp    801d1c <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801d45:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d4a:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801d4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d52:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d55:	89 df                	mov    %ebx,%edi
+  801d57:	89 de                	mov    %ebx,%esi
+  801d59:	cd 30                	int    $0x30
+  801d5b:	eb 90                	jmp    801ced <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801d5d:	83 ec 0c             	sub    $0xc,%esp
+  801d60:	50                   	push   %eax
+  801d61:	6a 1f                	push   $0x1f
+  801d63:	68 99 2f 80 00       	push   $0x802f99
+  801d68:	6a 4a                	push   $0x4a
+  801d6a:	68 b6 2f 80 00       	push   $0x802fb6
+  801d6f:	e8 cf e5 ff ff       	call   800343 <_panic>
+
+00801d74 <sys_ipc_call>:
+{
+  801d74:	55                   	push   %ebp
+  801d75:	89 e5                	mov    %esp,%ebp
+  801d77:	57                   	push   %edi
+  801d78:	56                   	push   %esi
+  801d79:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801d7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d7d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801d82:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801d85:	55                   	push   %ebp
+  801d86:	56                   	push   %esi
+  801d87:	8b 0e                	mov    (%esi),%ecx
+  801d89:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801d8c:	8b 7e 08             	mov    0x8(%esi),%edi
+  801d8f:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801d92:	8b 76 0c             	mov    0xc(%esi),%esi
+  801d95:	cd 30                	int    $0x30
+  801d97:	87 34 24             	xchg   %esi,(%esp)
+  801d9a:	89 0e                	mov    %ecx,(%esi)
+  801d9c:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801d9f:	89 7e 08             	mov    %edi,0x8(%esi)
+  801da2:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801da5:	8f 46 0c             	pop    0xc(%esi)
+  801da8:	5d                   	pop    %ebp
+}
+  801da9:	5b                   	pop    %ebx
+  801daa:	5e                   	pop    %esi
+  801dab:	5f                   	pop    %edi
+  801dac:	5d                   	pop    %ebp
+  801dad:	c3                   	ret
+
+00801dae <sys_ipc_reply_wait>:
+{
+  801dae:	55                   	push   %ebp
+  801daf:	89 e5                	mov    %esp,%ebp
+  801db1:	57                   	push   %edi
+  801db2:	56                   	push   %esi
+  801db3:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801db4:	8b 55 08             	mov    0x8(%ebp),%edx
+  801db7:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801dbc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801dbf:	55                   	push   %ebp
+  801dc0:	56                   	push   %esi
+  801dc1:	8b 0e                	mov    (%esi),%ecx
+  801dc3:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801dc6:	8b 7e 08             	mov    0x8(%esi),%edi
+  801dc9:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801dcc:	8b 76 0c             	mov    0xc(%esi),%esi
+  801dcf:	cd 30                	int    $0x30
+  801dd1:	87 34 24             	xchg   %esi,(%esp)
+  801dd4:	89 0e                	mov    %ecx,(%esi)
+  801dd6:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801dd9:	89 7e 08             	mov    %edi,0x8(%esi)
+  801ddc:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801ddf:	8f 46 0c             	pop    0xc(%esi)
+  801de2:	5d                   	pop    %ebp
+}
+  801de3:	5b                   	pop    %ebx
+  801de4:	5e                   	pop    %esi
+  801de5:	5f                   	pop    %edi
+  801de6:	5d                   	pop    %ebp
+  801de7:	c3                   	ret
+
+00801de8 <sys_ipc_send_msg>:
+{
+  801de8:	55                   	push   %ebp
+  801de9:	89 e5                	mov    %esp,%ebp
+  801deb:	57                   	push   %edi
+  801dec:	56                   	push   %esi
+  801ded:	53                   	push   %ebx
+  801dee:	83 ec 20             	sub    $0x20,%esp
+  801df1:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801df4:	8b 10                	mov    (%eax),%edx
+  801df6:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801df9:	8b 50 04             	mov    0x4(%eax),%edx
+  801dfc:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801dff:	8b 50 08             	mov    0x8(%eax),%edx
+  801e02:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801e05:	8b 50 0c             	mov    0xc(%eax),%edx
+  801e08:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801e0b:	8b 40 10             	mov    0x10(%eax),%eax
+  801e0e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801e11:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801e14:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e17:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801e1c:	55                   	push   %ebp
+  801e1d:	56                   	push   %esi
+  801e1e:	8b 0e                	mov    (%esi),%ecx
+  801e20:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801e23:	8b 7e 08             	mov    0x8(%esi),%edi
+  801e26:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801e29:	8b 76 0c             	mov    0xc(%esi),%esi
+  801e2c:	cd 30                	int    $0x30
+  801e2e:	87 34 24             	xchg   %esi,(%esp)
+  801e31:	89 0e                	mov    %ecx,(%esi)
+  801e33:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801e36:	89 7e 08             	mov    %edi,0x8(%esi)
+  801e39:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801e3c:	8f 46 0c             	pop    0xc(%esi)
+  801e3f:	5d                   	pop    %ebp
+}
+  801e40:	83 c4 20             	add    $0x20,%esp
+  801e43:	5b                   	pop    %ebx
+  801e44:	5e                   	pop    %esi
+  801e45:	5f                   	pop    %edi
+  801e46:	5d                   	pop    %ebp
+  801e47:	c3                   	ret
+
+00801e48 <sys_fork>:
+{
+  801e48:	55                   	push   %ebp
+  801e49:	89 e5                	mov    %esp,%ebp
+  801e4b:	57                   	push   %edi
+  801e4c:	56                   	push   %esi
+  801e4d:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801e4e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801e55:	78 2e                	js     801e85 <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801e57:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801e5e:	74 71                	je     801ed1 <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801e60:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e65:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801e6a:	89 d1                	mov    %edx,%ecx
+  801e6c:	89 d3                	mov    %edx,%ebx
+  801e6e:	89 d7                	mov    %edx,%edi
+  801e70:	89 d6                	mov    %edx,%esi
+  801e72:	55                   	push   %ebp
+  801e73:	68 7c 1e 80 00       	push   $0x801e7c
+  801e78:	89 e5                	mov    %esp,%ebp
+  801e7a:	0f 34                	sysenter
+  801e7c:	83 c4 04             	add    $0x4,%esp
+  801e7f:	5d                   	pop    %ebp
+}
+  801e80:	5b                   	pop    %ebx
+  801e81:	5e                   	pop    %esi
+  801e82:	5f                   	pop    %edi
+  801e83:	5d                   	pop    %ebp
+  801e84:	c3                   	ret
+  801e85:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e8a:	0f a2                	cpuid
+		return 0;
+  801e8c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801e91:	f6 c6 08             	test   $0x8,%dh
+  801e94:	74 15                	je     801eab <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e96:	89 c2                	mov    %eax,%edx
+  801e98:	c1 ea 08             	shr    $0x8,%edx
+  801e9b:	83 e2 0f             	and    $0xf,%edx
+  801e9e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ea3:	83 fa 06             	cmp    $0x6,%edx
+  801ea6:	74 0e                	je     801eb6 <sys_fork+0x6e>
+  801ea8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801eab:	0f b6 c9             	movzbl %cl,%ecx
+  801eae:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801eb4:	eb a1                	jmp    801e57 <sys_fork+0xf>
+  801eb6:	89 c2                	mov    %eax,%edx
+  801eb8:	c1 ea 04             	shr    $0x4,%edx
+  801ebb:	83 e2 0f             	and    $0xf,%edx
+  801ebe:	83 fa 02             	cmp    $0x2,%edx
+  801ec1:	77 e5                	ja     801ea8 <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801ec3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ec6:	83 f8 02             	cmp    $0x2,%eax
+  801ec9:	0f 97 c1             	seta   %cl
+  801ecc:	0f b6 c9             	movzbl %cl,%ecx
+  801ecf:	eb d7                	jmp    801ea8 <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801ed1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ed6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801edb:	89 d1                	mov    %edx,%ecx
+  801edd:	89 d3                	mov    %edx,%ebx
+  801edf:	89 d7                	mov    %edx,%edi
+  801ee1:	89 d6                	mov    %edx,%esi
+  801ee3:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801ee5:	eb 99                	jmp    801e80 <sys_fork+0x38>
+
+00801ee7 <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801ee7:	55                   	push   %ebp
+  801ee8:	89 e5                	mov    %esp,%ebp
+  801eea:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801eed:	ff 75 14             	push   0x14(%ebp)
+  801ef0:	ff 75 10             	push   0x10(%ebp)
+  801ef3:	ff 75 0c             	push   0xc(%ebp)
+  801ef6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801efb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801efe:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801f03:	e8 81 ee ff ff       	call   800d89 <page_vec_call>
+}
+  801f08:	c9                   	leave
+  801f09:	c3                   	ret
+
+00801f0a <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801f0a:	55                   	push   %ebp
+  801f0b:	89 e5                	mov    %esp,%ebp
+  801f0d:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801f10:	ff 75 18             	push   0x18(%ebp)
+  801f13:	ff 75 14             	push   0x14(%ebp)
+  801f16:	ff 75 10             	push   0x10(%ebp)
+  801f19:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f1f:	b8 10 00 00 00       	mov    $0x10,%eax
+  801f24:	e8 60 ee ff ff       	call   800d89 <page_vec_call>
+}
+  801f29:	c9                   	leave
+  801f2a:	c3                   	ret
+
+00801f2b <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801f2b:	55                   	push   %ebp
+  801f2c:	89 e5                	mov    %esp,%ebp
+  801f2e:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801f31:	ff 75 14             	push   0x14(%ebp)
+  801f34:	ff 75 10             	push   0x10(%ebp)
+  801f37:	ff 75 0c             	push   0xc(%ebp)
+  801f3a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f3f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f42:	b8 11 00 00 00       	mov    $0x11,%eax
+  801f47:	e8 3d ee ff ff       	call   800d89 <page_vec_call>
+}
+  801f4c:	c9                   	leave
+  801f4d:	c3                   	ret
+
+00801f4e <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801f4e:	55                   	push   %ebp
+  801f4f:	89 e5                	mov    %esp,%ebp
+  801f51:	57                   	push   %edi
+  801f52:	56                   	push   %esi
+  801f53:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801f54:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801f5b:	78 32                	js     801f8f <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801f5d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801f64:	74 75                	je     801fdb <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801f66:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f69:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f6c:	b8 12 00 00 00       	mov    $0x12,%eax
+  801f71:	be 00 00 00 00       	mov    $0x0,%esi
+  801f76:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f79:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801f7c:	55                   	push   %ebp
+  801f7d:	68 86 1f 80 00       	push   $0x801f86
+  801f82:	89 e5                	mov    %esp,%ebp
+  801f84:	0f 34                	sysenter
+  801f86:	83 c4 04             	add    $0x4,%esp
+  801f89:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801f8a:	5b                   	pop    %ebx
+  801f8b:	5e                   	pop    %esi
+  801f8c:	5f                   	pop    %edi
+  801f8d:	5d                   	pop    %ebp
+  801f8e:	c3                   	ret
+  801f8f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f94:	0f a2                	cpuid
+		return 0;
+  801f96:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801f9b:	f6 c6 08             	test   $0x8,%dh
+  801f9e:	74 15                	je     801fb5 <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fa0:	89 c2                	mov    %eax,%edx
+  801fa2:	c1 ea 08             	shr    $0x8,%edx
+  801fa5:	83 e2 0f             	and    $0xf,%edx
+  801fa8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801fad:	83 fa 06             	cmp    $0x6,%edx
+  801fb0:	74 0e                	je     801fc0 <sys_vm_ranges+0x72>
+  801fb2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801fb5:	0f b6 c9             	movzbl %cl,%ecx
+  801fb8:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801fbe:	eb 9d                	jmp    801f5d <sys_vm_ranges+0xf>
+  801fc0:	89 c2                	mov    %eax,%edx
+  801fc2:	c1 ea 04             	shr    $0x4,%edx
+  801fc5:	83 e2 0f             	and    $0xf,%edx
+  801fc8:	83 fa 02             	cmp    $0x2,%edx
+  801fcb:	77 e5                	ja     801fb2 <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  801fcd:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fd0:	83 f8 02             	cmp    $0x2,%eax
+  801fd3:	0f 97 c1             	seta   %cl
+  801fd6:	0f b6 c9             	movzbl %cl,%ecx
+  801fd9:	eb d7                	jmp    801fb2 <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801fdb:	b8 12 00 00 00       	mov    $0x12,%eax
+  801fe0:	be 00 00 00 00       	mov    $0x0,%esi
+  801fe5:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fe8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801feb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801fee:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ff1:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801ff3:	eb 95                	jmp    801f8a <sys_vm_ranges+0x3c>
+
+00801ff5 <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801ff5:	55                   	push   %ebp
+  801ff6:	89 e5                	mov    %esp,%ebp
+  801ff8:	57                   	push   %edi
+  801ff9:	56                   	push   %esi
+  801ffa:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801ffb:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802002:	78 31                	js     802035 <sys_spawn+0x40>
+	if (syscall_sysenter)
+  802004:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80200b:	74 74                	je     802081 <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  80200d:	be 00 00 00 00       	mov    $0x0,%esi
+  802012:	8b 55 08             	mov    0x8(%ebp),%edx
+  802015:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802018:	b8 14 00 00 00       	mov    $0x14,%eax
+  80201d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802020:	89 f7                	mov    %esi,%edi
+  802022:	55                   	push   %ebp
+  802023:	68 2c 20 80 00       	push   $0x80202c
+  802028:	89 e5                	mov    %esp,%ebp
+  80202a:	0f 34                	sysenter
+  80202c:	83 c4 04             	add    $0x4,%esp
+  80202f:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  802030:	5b                   	pop    %ebx
+  802031:	5e                   	pop    %esi
+  802032:	5f                   	pop    %edi
+  802033:	5d                   	pop    %ebp
+  802034:	c3                   	ret
+  802035:	b8 01 00 00 00       	mov    $0x1,%eax
+  80203a:	0f a2                	cpuid
+		return 0;
+  80203c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802041:	f6 c6 08             	test   $0x8,%dh
+  802044:	74 15                	je     80205b <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802046:	89 c2                	mov    %eax,%edx
+  802048:	c1 ea 08             	shr    $0x8,%edx
+  80204b:	83 e2 0f             	and    $0xf,%edx
+  80204e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802053:	83 fa 06             	cmp    $0x6,%edx
+  802056:	74 0e                	je     802066 <sys_spawn+0x71>
+  802058:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80205b:	0f b6 c9             	movzbl %cl,%ecx
+  80205e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802064:	eb 9e                	jmp    802004 <sys_spawn+0xf>
+  802066:	89 c2                	mov    %eax,%edx
+  802068:	c1 ea 04             	shr    $0x4,%edx
+  80206b:	83 e2 0f             	and    $0xf,%edx
+  80206e:	83 fa 02             	cmp    $0x2,%edx
+  802071:	77 e5                	ja     802058 <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  802073:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802076:	83 f8 02             	cmp    $0x2,%eax
+  802079:	0f 97 c1             	seta   %cl
+  80207c:	0f b6 c9             	movzbl %cl,%ecx
+  80207f:	eb d7                	jmp    802058 <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  802081:	be 00 00 00 00       	mov    $0x0,%esi
+  802086:	b8 14 00 00 00       	mov    $0x14,%eax
+  80208b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80208e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802091:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802094:	89 f7                	mov    %esi,%edi
+  802096:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  802098:	eb 96                	jmp    802030 <sys_spawn+0x3b>
+
+0080209a <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  80209a:	55                   	push   %ebp
+  80209b:	89 e5                	mov    %esp,%ebp
+  80209d:	57                   	push   %edi
+  80209e:	56                   	push   %esi
+  80209f:	53                   	push   %ebx
+  8020a0:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8020a3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8020aa:	78 37                	js     8020e3 <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  8020ac:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8020b3:	74 7a                	je     80212f <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  8020b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020c0:	b8 15 00 00 00       	mov    $0x15,%eax
+  8020c5:	89 df                	mov    %ebx,%edi
+  8020c7:	89 de                	mov    %ebx,%esi
+  8020c9:	55                   	push   %ebp
+  8020ca:	68 d3 20 80 00       	push   $0x8020d3
+  8020cf:	89 e5                	mov    %esp,%ebp
+  8020d1:	0f 34                	sysenter
+  8020d3:	83 c4 04             	add    $0x4,%esp
+  8020d6:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8020d7:	85 c0                	test   %eax,%eax
+  8020d9:	7f 6c                	jg     802147 <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  8020db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020de:	5b                   	pop    %ebx
+  8020df:	5e                   	pop    %esi
+  8020e0:	5f                   	pop    %edi
+  8020e1:	5d                   	pop    %ebp
+  8020e2:	c3                   	ret
+  8020e3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020e8:	0f a2                	cpuid
+		return 0;
+  8020ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8020ef:	f6 c6 08             	test   $0x8,%dh
+  8020f2:	74 15                	je     802109 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020f4:	89 c2                	mov    %eax,%edx
+  8020f6:	c1 ea 08             	shr    $0x8,%edx
+  8020f9:	83 e2 0f             	and    $0xf,%edx
+  8020fc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802101:	83 fa 06             	cmp    $0x6,%edx
+  802104:	74 0e                	je     802114 <sys_shm_create+0x7a>
+  802106:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802109:	0f b6 c9             	movzbl %cl,%ecx
+  80210c:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802112:	eb 98                	jmp    8020ac <sys_shm_create+0x12>
+  802114:	89 c2                	mov    %eax,%edx
+  802116:	c1 ea 04             	shr    $0x4,%edx
+  802119:	83 e2 0f             	and    $0xf,%edx
+  80211c:	83 fa 02             	cmp    $0x2,%edx
+  80211f:	77 e5                	ja     802106 <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  802121:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802124:	83 f8 02             	cmp    $0x2,%eax
+  802127:	0f 97 c1             	seta   %cl
+  80212a:	0f b6 c9             	movzbl %cl,%ecx
+  80212d:	eb d7                	jmp    802106 <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  80212f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802134:	b8 15 00 00 00       	mov    $0x15,%eax
+  802139:	8b 55 08             	mov    0x8(%ebp),%edx
+  80213c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80213f:	89 df                	mov    %ebx,%edi
+  802141:	89 de                	mov    %ebx,%esi
+  802143:	cd 30                	int    $0x30
+  802145:	eb 90                	jmp    8020d7 <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802147:	83 ec 0c             	sub    $0xc,%esp
+  80214a:	50                   	push   %eax
+  80214b:	6a 15                	push   $0x15
+  80214d:	68 99 2f 80 00       	push   $0x802f99
+  802152:	6a 4a                	push   $0x4a
+  802154:	68 b6 2f 80 00       	push   $0x802fb6
+  802159:	e8 e5 e1 ff ff       	call   800343 <_panic>
+
+0080215e <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  80215e:	55                   	push   %ebp
+  80215f:	89 e5                	mov    %esp,%ebp
+  802161:	57                   	push   %edi
+  802162:	56                   	push   %esi
+  802163:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802164:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80216b:	78 32                	js     80219f <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  80216d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802174:	74 75                	je     8021eb <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  802176:	8b 55 08             	mov    0x8(%ebp),%edx
+  802179:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80217c:	b8 16 00 00 00       	mov    $0x16,%eax
+  802181:	be 00 00 00 00       	mov    $0x0,%esi
+  802186:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802189:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80218c:	55                   	push   %ebp
+  80218d:	68 96 21 80 00       	push   $0x802196
+  802192:	89 e5                	mov    %esp,%ebp
+  802194:	0f 34                	sysenter
+  802196:	83 c4 04             	add    $0x4,%esp
+  802199:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  80219a:	5b                   	pop    %ebx
+  80219b:	5e                   	pop    %esi
+  80219c:	5f                   	pop    %edi
+  80219d:	5d                   	pop    %ebp
+  80219e:	c3                   	ret
+  80219f:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021a4:	0f a2                	cpuid
+		return 0;
+  8021a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8021ab:	f6 c6 08             	test   $0x8,%dh
+  8021ae:	74 15                	je     8021c5 <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021b0:	89 c2                	mov    %eax,%edx
+  8021b2:	c1 ea 08             	shr    $0x8,%edx
+  8021b5:	83 e2 0f             	and    $0xf,%edx
+  8021b8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8021bd:	83 fa 06             	cmp    $0x6,%edx
+  8021c0:	74 0e                	je     8021d0 <sys_shm_attach+0x72>
+  8021c2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8021c5:	0f b6 c9             	movzbl %cl,%ecx
+  8021c8:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8021ce:	eb 9d                	jmp    80216d <sys_shm_attach+0xf>
+  8021d0:	89 c2                	mov    %eax,%edx
+  8021d2:	c1 ea 04             	shr    $0x4,%edx
+  8021d5:	83 e2 0f             	and    $0xf,%edx
+  8021d8:	83 fa 02             	cmp    $0x2,%edx
+  8021db:	77 e5                	ja     8021c2 <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  8021dd:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021e0:	83 f8 02             	cmp    $0x2,%eax
+  8021e3:	0f 97 c1             	seta   %cl
+  8021e6:	0f b6 c9             	movzbl %cl,%ecx
+  8021e9:	eb d7                	jmp    8021c2 <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  8021eb:	b8 16 00 00 00       	mov    $0x16,%eax
+  8021f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8021f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021fb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8021fe:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802201:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  802203:	eb 95                	jmp    80219a <sys_shm_attach+0x3c>
+
+00802205 <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  802205:	55                   	push   %ebp
+  802206:	89 e5                	mov    %esp,%ebp
+  802208:	57                   	push   %edi
+  802209:	56                   	push   %esi
+  80220a:	53                   	push   %ebx
+  80220b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80220e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802215:	78 38                	js     80224f <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  802217:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80221e:	74 7b                	je     80229b <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  802220:	be 00 00 00 00       	mov    $0x0,%esi
+  802225:	8b 55 08             	mov    0x8(%ebp),%edx
+  802228:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80222b:	b8 17 00 00 00       	mov    $0x17,%eax
+  802230:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802233:	89 f7                	mov    %esi,%edi
+  802235:	55                   	push   %ebp
+  802236:	68 3f 22 80 00       	push   $0x80223f
+  80223b:	89 e5                	mov    %esp,%ebp
+  80223d:	0f 34                	sysenter
+  80223f:	83 c4 04             	add    $0x4,%esp
+  802242:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802243:	85 c0                	test   %eax,%eax
+  802245:	7f 6d                	jg     8022b4 <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  802247:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80224a:	5b                   	pop    %ebx
+  80224b:	5e                   	pop    %esi
+  80224c:	5f                   	pop    %edi
+  80224d:	5d                   	pop    %ebp
+  80224e:	c3                   	ret
+  80224f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802254:	0f a2                	cpuid
+		return 0;
+  802256:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80225b:	f6 c6 08             	test   $0x8,%dh
+  80225e:	74 15                	je     802275 <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802260:	89 c2                	mov    %eax,%edx
+  802262:	c1 ea 08             	shr    $0x8,%edx
+  802265:	83 e2 0f             	and    $0xf,%edx
+  802268:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80226d:	83 fa 06             	cmp    $0x6,%edx
+  802270:	74 0e                	je     802280 <sys_shm_detach+0x7b>
+  802272:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802275:	0f b6 c9             	movzbl %cl,%ecx
+  802278:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80227e:	eb 97                	jmp    802217 <sys_shm_detach+0x12>
+  802280:	89 c2                	mov    %eax,%edx
+  802282:	c1 ea 04             	shr    $0x4,%edx
+  802285:	83 e2 0f             	and    $0xf,%edx
+  802288:	83 fa 02             	cmp    $0x2,%edx
+  80228b:	77 e5                	ja     802272 <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  80228d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802290:	83 f8 02             	cmp    $0x2,%eax
+  802293:	0f 97 c1             	seta   %cl
+  802296:	0f b6 c9             	movzbl %cl,%ecx
+  802299:	eb d7                	jmp    802272 <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  80229b:	be 00 00 00 00       	mov    $0x0,%esi
+  8022a0:	b8 17 00 00 00       	mov    $0x17,%eax
+  8022a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022ab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8022ae:	89 f7                	mov    %esi,%edi
+  8022b0:	cd 30                	int    $0x30
+  8022b2:	eb 8f                	jmp    802243 <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8022b4:	83 ec 0c             	sub    $0xc,%esp
+  8022b7:	50                   	push   %eax
+  8022b8:	6a 17                	push   $0x17
+  8022ba:	68 99 2f 80 00       	push   $0x802f99
+  8022bf:	6a 4a                	push   $0x4a
+  8022c1:	68 b6 2f 80 00       	push   $0x802fb6
+  8022c6:	e8 78 e0 ff ff       	call   800343 <_panic>
+
+008022cb <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  8022cb:	55                   	push   %ebp
+  8022cc:	89 e5                	mov    %esp,%ebp
+  8022ce:	57                   	push   %edi
+  8022cf:	56                   	push   %esi
+  8022d0:	53                   	push   %ebx
+  8022d1:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8022d4:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8022db:	78 36                	js     802313 <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  8022dd:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8022e4:	74 79                	je     80235f <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  8022e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022ee:	b8 18 00 00 00       	mov    $0x18,%eax
+  8022f3:	89 cb                	mov    %ecx,%ebx
+  8022f5:	89 cf                	mov    %ecx,%edi
+  8022f7:	89 ce                	mov    %ecx,%esi
+  8022f9:	55                   	push   %ebp
+  8022fa:	68 03 23 80 00       	push   $0x802303
+  8022ff:	89 e5                	mov    %esp,%ebp
+  802301:	0f 34                	sysenter
+  802303:	83 c4 04             	add    $0x4,%esp
+  802306:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802307:	85 c0                	test   %eax,%eax
+  802309:	7f 6b                	jg     802376 <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  80230b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80230e:	5b                   	pop    %ebx
+  80230f:	5e                   	pop    %esi
+  802310:	5f                   	pop    %edi
+  802311:	5d                   	pop    %ebp
+  802312:	c3                   	ret
+  802313:	b8 01 00 00 00       	mov    $0x1,%eax
+  802318:	0f a2                	cpuid
+		return 0;
+  80231a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80231f:	f6 c6 08             	test   $0x8,%dh
+  802322:	74 15                	je     802339 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802324:	89 c2                	mov    %eax,%edx
+  802326:	c1 ea 08             	shr    $0x8,%edx
+  802329:	83 e2 0f             	and    $0xf,%edx
+  80232c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802331:	83 fa 06             	cmp    $0x6,%edx
+  802334:	74 0e                	je     802344 <sys_shm_remove+0x79>
+  802336:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802339:	0f b6 c9             	movzbl %cl,%ecx
+  80233c:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802342:	eb 99                	jmp    8022dd <sys_shm_remove+0x12>
+  802344:	89 c2                	mov    %eax,%edx
+  802346:	c1 ea 04             	shr    $0x4,%edx
+  802349:	83 e2 0f             	and    $0xf,%edx
+  80234c:	83 fa 02             	cmp    $0x2,%edx
+  80234f:	77 e5                	ja     802336 <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  802351:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802354:	83 f8 02             	cmp    $0x2,%eax
+  802357:	0f 97 c1             	seta   %cl
+  80235a:	0f b6 c9             	movzbl %cl,%ecx
+  80235d:	eb d7                	jmp    802336 <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  80235f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802364:	b8 18 00 00 00       	mov    $0x18,%eax
+  802369:	8b 55 08             	mov    0x8(%ebp),%edx
+  80236c:	89 cb                	mov    %ecx,%ebx
+  80236e:	89 cf                	mov    %ecx,%edi
+  802370:	89 ce                	mov    %ecx,%esi
+  802372:	cd 30                	int    $0x30
+  802374:	eb 91                	jmp    802307 <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802376:	83 ec 0c             	sub    $0xc,%esp
+  802379:	50                   	push   %eax
+  80237a:	6a 18                	push   $0x18
+  80237c:	68 99 2f 80 00       	push   $0x802f99
+  802381:	6a 4a                	push   $0x4a
+  802383:	68 b6 2f 80 00       	push   $0x802fb6
+  802388:	e8 b6 df ff ff       	call   800343 <_panic>
+
+0080238d <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  80238d:	55                   	push   %ebp
+  80238e:	89 e5                	mov    %esp,%ebp
+  802390:	57                   	push   %edi
+  802391:	56                   	push   %esi
+  802392:	53                   	push   %ebx
+  802393:	83 ec 0c             	sub    $0xc,%esp
+  802396:	8b 45 10             	mov    0x10(%ebp),%eax
+  802399:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80239c:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  80239f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8023a6:	78 32                	js     8023da <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  8023a8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8023af:	74 75                	je     802426 <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  8023b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023b7:	b8 20 00 00 00       	mov    $0x20,%eax
+  8023bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8023c1:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8023c4:	55                   	push   %ebp
+  8023c5:	68 ce 23 80 00       	push   $0x8023ce
+  8023ca:	89 e5                	mov    %esp,%ebp
+  8023cc:	0f 34                	sysenter
+  8023ce:	83 c4 04             	add    $0x4,%esp
+  8023d1:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  8023d2:	83 c4 0c             	add    $0xc,%esp
+  8023d5:	5b                   	pop    %ebx
+  8023d6:	5e                   	pop    %esi
+  8023d7:	5f                   	pop    %edi
+  8023d8:	5d                   	pop    %ebp
+  8023d9:	c3                   	ret
+  8023da:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023df:	0f a2                	cpuid
+		return 0;
+  8023e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8023e6:	f6 c6 08             	test   $0x8,%dh
+  8023e9:	74 15                	je     802400 <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023eb:	89 c2                	mov    %eax,%edx
+  8023ed:	c1 ea 08             	shr    $0x8,%edx
+  8023f0:	83 e2 0f             	and    $0xf,%edx
+  8023f3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8023f8:	83 fa 06             	cmp    $0x6,%edx
+  8023fb:	74 0e                	je     80240b <sys_futex_wait+0x7e>
+  8023fd:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802400:	0f b6 c9             	movzbl %cl,%ecx
+  802403:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802409:	eb 9d                	jmp    8023a8 <sys_futex_wait+0x1b>
+  80240b:	89 c2                	mov    %eax,%edx
+  80240d:	c1 ea 04             	shr    $0x4,%edx
+  802410:	83 e2 0f             	and    $0xf,%edx
+  802413:	83 fa 02             	cmp    $0x2,%edx
+  802416:	77 e5                	ja     8023fd <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  802418:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80241b:	83 f8 02             	cmp    $0x2,%eax
+  80241e:	0f 97 c1             	seta   %cl
+  802421:	0f b6 c9             	movzbl %cl,%ecx
+  802424:	eb d7                	jmp    8023fd <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  802426:	b8 20 00 00 00       	mov    $0x20,%eax
+  80242b:	be 00 00 00 00       	mov    $0x0,%esi
+  802430:	8b 55 08             	mov    0x8(%ebp),%edx
+  802433:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802436:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802439:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  80243b:	eb 95                	jmp    8023d2 <sys_futex_wait+0x45>
+
+0080243d <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80243d:	55                   	push   %ebp
+  80243e:	89 e5                	mov    %esp,%ebp
+  802440:	57                   	push   %edi
+  802441:	56                   	push   %esi
+  802442:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802443:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80244a:	78 30                	js     80247c <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  80244c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802453:	74 73                	je     8024c8 <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  802455:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80245a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80245d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802460:	b8 21 00 00 00       	mov    $0x21,%eax
+  802465:	89 df                	mov    %ebx,%edi
+  802467:	89 de                	mov    %ebx,%esi
+  802469:	55                   	push   %ebp
+  80246a:	68 73 24 80 00       	push   $0x802473
+  80246f:	89 e5                	mov    %esp,%ebp
+  802471:	0f 34                	sysenter
+  802473:	83 c4 04             	add    $0x4,%esp
+  802476:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  802477:	5b                   	pop    %ebx
+  802478:	5e                   	pop    %esi
+  802479:	5f                   	pop    %edi
+  80247a:	5d                   	pop    %ebp
+  80247b:	c3                   	ret
+  80247c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802481:	0f a2                	cpuid
+		return 0;
+  802483:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802488:	f6 c6 08             	test   $0x8,%dh
+  80248b:	74 15                	je     8024a2 <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80248d:	89 c2                	mov    %eax,%edx
+  80248f:	c1 ea 08             	shr    $0x8,%edx
+  802492:	83 e2 0f             	and    $0xf,%edx
+  802495:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80249a:	83 fa 06             	cmp    $0x6,%edx
+  80249d:	74 0e                	je     8024ad <sys_futex_wake+0x70>
+  80249f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8024a2:	0f b6 c9             	movzbl %cl,%ecx
+  8024a5:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8024ab:	eb 9f                	jmp    80244c <sys_futex_wake+0xf>
+  8024ad:	89 c2                	mov    %eax,%edx
+  8024af:	c1 ea 04             	shr    $0x4,%edx
+  8024b2:	83 e2 0f             	and    $0xf,%edx
+  8024b5:	83 fa 02             	cmp    $0x2,%edx
+  8024b8:	77 e5                	ja     80249f <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  8024ba:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8024bd:	83 f8 02             	cmp    $0x2,%eax
+  8024c0:	0f 97 c1             	seta   %cl
+  8024c3:	0f b6 c9             	movzbl %cl,%ecx
+  8024c6:	eb d7                	jmp    80249f <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  8024c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024cd:	b8 21 00 00 00       	mov    $0x21,%eax
+  8024d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024d8:	89 df                	mov    %ebx,%edi
+  8024da:	89 de                	mov    %ebx,%esi
+  8024dc:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  8024de:	eb 97                	jmp    802477 <sys_futex_wake+0x3a>
+
+008024e0 <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  8024e0:	55                   	push   %ebp
+  8024e1:	89 e5                	mov    %esp,%ebp
+  8024e3:	57                   	push   %edi
+  8024e4:	56                   	push   %esi
+  8024e5:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8024e6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8024ed:	78 2e                	js     80251d <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  8024ef:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8024f6:	74 71                	je     802569 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  8024f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024fd:	b8 22 00 00 00       	mov    $0x22,%eax
+  802502:	89 d1                	mov    %edx,%ecx
+  802504:	89 d3                	mov    %edx,%ebx
+  802506:	89 d7                	mov    %edx,%edi
+  802508:	89 d6                	mov    %edx,%esi
+  80250a:	55                   	push   %ebp
+  80250b:	68 14 25 80 00       	push   $0x802514
+  802510:	89 e5                	mov    %esp,%ebp
+  802512:	0f 34                	sysenter
+  802514:	83 c4 04             	add    $0x4,%esp
+  802517:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  802518:	5b                   	pop    %ebx
+  802519:	5e                   	pop    %esi
+  80251a:	5f                   	pop    %edi
+  80251b:	5d                   	pop    %ebp
+  80251c:	c3                   	ret
+  80251d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802522:	0f a2                	cpuid
+		return 0;
+  802524:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802529:	f6 c6 08             	test   $0x8,%dh
+  80252c:	74 15                	je     802543 <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80252e:	89 c2                	mov    %eax,%edx
+  802530:	c1 ea 08             	shr    $0x8,%edx
+  802533:	83 e2 0f             	and    $0xf,%edx
+  802536:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80253b:	83 fa 06             	cmp    $0x6,%edx
+  80253e:	74 0e                	je     80254e <sys_ep_create+0x6e>
+  802540:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802543:	0f b6 c9             	movzbl %cl,%ecx
+  802546:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80254c:	eb a1                	jmp    8024ef <sys_ep_create+0xf>
+  80254e:	89 c2                	mov    %eax,%edx
+  802550:	c1 ea 04             	shr    $0x4,%edx
+  802553:	83 e2 0f             	and    $0xf,%edx
+  802556:	83 fa 02             	cmp    $0x2,%edx
+  802559:	77 e5                	ja     802540 <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  80255b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80255e:	83 f8 02             	cmp    $0x2,%eax
+  802561:	0f 97 c1             	seta   %cl
+  802564:	0f b6 c9             	movzbl %cl,%ecx
+  802567:	eb d7                	jmp    802540 <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  802569:	ba 00 00 00 00       	mov    $0x0,%edx
+  80256e:	b8 22 00 00 00       	mov    $0x22,%eax
+  802573:	89 d1                	mov    %edx,%ecx
+  802575:	89 d3                	mov    %edx,%ebx
+  802577:	89 d7                	mov    %edx,%edi
+  802579:	89 d6                	mov    %edx,%esi
+  80257b:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  80257d:	eb 99                	jmp    802518 <sys_ep_create+0x38>
+
+0080257f <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  80257f:	55                   	push   %ebp
+  802580:	89 e5                	mov    %esp,%ebp
+  802582:	57                   	push   %edi
+  802583:	56                   	push   %esi
+  802584:	53                   	push   %ebx
+  802585:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802588:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80258f:	78 36                	js     8025c7 <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  802591:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802598:	74 79                	je     802613 <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  80259a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80259d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025a2:	b8 23 00 00 00       	mov    $0x23,%eax
+  8025a7:	89 cb                	mov    %ecx,%ebx
+  8025a9:	89 cf                	mov    %ecx,%edi
+  8025ab:	89 ce                	mov    %ecx,%esi
+  8025ad:	55                   	push   %ebp
+  8025ae:	68 b7 25 80 00       	push   $0x8025b7
+  8025b3:	89 e5                	mov    %esp,%ebp
+  8025b5:	0f 34                	sysenter
+  8025b7:	83 c4 04             	add    $0x4,%esp
+  8025ba:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8025bb:	85 c0                	test   %eax,%eax
+  8025bd:	7f 6b                	jg     80262a <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  8025bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025c2:	5b                   	pop    %ebx
+  8025c3:	5e                   	pop    %esi
+  8025c4:	5f                   	pop    %edi
+  8025c5:	5d                   	pop    %ebp
+  8025c6:	c3                   	ret
+  8025c7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025cc:	0f a2                	cpuid
+		return 0;
+  8025ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8025d3:	f6 c6 08             	test   $0x8,%dh
+  8025d6:	74 15                	je     8025ed <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025d8:	89 c2                	mov    %eax,%edx
+  8025da:	c1 ea 08             	shr    $0x8,%edx
+  8025dd:	83 e2 0f             	and    $0xf,%edx
+  8025e0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8025e5:	83 fa 06             	cmp    $0x6,%edx
+  8025e8:	74 0e                	je     8025f8 <sys_ep_destroy+0x79>
+  8025ea:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8025ed:	0f b6 c9             	movzbl %cl,%ecx
+  8025f0:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8025f6:	eb 99                	jmp    802591 <sys_ep_destroy+0x12>
+  8025f8:	89 c2                	mov    %eax,%edx
+  8025fa:	c1 ea 04             	shr    $0x4,%edx
+  8025fd:	83 e2 0f             	and    $0xf,%edx
+  802600:	83 fa 02             	cmp    $0x2,%edx
+  802603:	77 e5                	ja     8025ea <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  802605:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802608:	83 f8 02             	cmp    $0x2,%eax
+  80260b:	0f 97 c1             	seta   %cl
+  80260e:	0f b6 c9             	movzbl %cl,%ecx
+  802611:	eb d7                	jmp    8025ea <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  802613:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802618:	b8 23 00 00 00       	mov    $0x23,%eax
+  80261d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802620:	89 cb                	mov    %ecx,%ebx
+  802622:	89 cf                	mov    %ecx,%edi
+  802624:	89 ce                	mov    %ecx,%esi
+  802626:	cd 30                	int    $0x30
+  802628:	eb 91                	jmp    8025bb <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80262a:	83 ec 0c             	sub    $0xc,%esp
+  80262d:	50                   	push   %eax
+  80262e:	6a 23                	push   $0x23
+  802630:	68 99 2f 80 00       	push   $0x802f99
+  802635:	6a 4a                	push   $0x4a
+  802637:	68 b6 2f 80 00       	push   $0x802fb6
+  80263c:	e8 02 dd ff ff       	call   800343 <_panic>
+
+00802641 <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  802641:	55                   	push   %ebp
+  802642:	89 e5                	mov    %esp,%ebp
+  802644:	57                   	push   %edi
+  802645:	56                   	push   %esi
+  802646:	53                   	push   %ebx
+  802647:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80264a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802651:	78 37                	js     80268a <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  802653:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80265a:	74 7a                	je     8026d6 <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  80265c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802661:	8b 55 08             	mov    0x8(%ebp),%edx
+  802664:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802667:	b8 24 00 00 00       	mov    $0x24,%eax
+  80266c:	89 df                	mov    %ebx,%edi
+  80266e:	89 de                	mov    %ebx,%esi
+  802670:	55                   	push   %ebp
+  802671:	68 7a 26 80 00       	push   $0x80267a
+  802676:	89 e5                	mov    %esp,%ebp
+  802678:	0f 34                	sysenter
+  80267a:	83 c4 04             	add    $0x4,%esp
+  80267d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80267e:	85 c0                	test   %eax,%eax
+  802680:	7f 6c                	jg     8026ee <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  802682:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802685:	5b                   	pop    %ebx
+  802686:	5e                   	pop    %esi
+  802687:	5f                   	pop    %edi
+  802688:	5d                   	pop    %ebp
+  802689:	c3                   	ret
+  80268a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80268f:	0f a2                	cpuid
+		return 0;
+  802691:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802696:	f6 c6 08             	test   $0x8,%dh
+  802699:	74 15                	je     8026b0 <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80269b:	89 c2                	mov    %eax,%edx
+  80269d:	c1 ea 08             	shr    $0x8,%edx
+  8026a0:	83 e2 0f             	and    $0xf,%edx
+  8026a3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8026a8:	83 fa 06             	cmp    $0x6,%edx
+  8026ab:	74 0e                	je     8026bb <sys_ep_grant+0x7a>
+  8026ad:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8026b0:	0f b6 c9             	movzbl %cl,%ecx
+  8026b3:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8026b9:	eb 98                	jmp    802653 <sys_ep_grant+0x12>
+  8026bb:	89 c2                	mov    %eax,%edx
+  8026bd:	c1 ea 04             	shr    $0x4,%edx
+  8026c0:	83 e2 0f             	and    $0xf,%edx
+  8026c3:	83 fa 02             	cmp    $0x2,%edx
+  8026c6:	77 e5                	ja     8026ad <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  8026c8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8026cb:	83 f8 02             	cmp    $0x2,%eax
+  8026ce:	0f 97 c1             	seta   %cl
+  8026d1:	0f b6 c9             	movzbl %cl,%ecx
+  8026d4:	eb d7                	jmp    8026ad <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  8026d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026db:	b8 24 00 00 00       	mov    $0x24,%eax
+  8026e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8026e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026e6:	89 df                	mov    %ebx,%edi
+  8026e8:	89 de                	mov    %ebx,%esi
+  8026ea:	cd 30                	int    $0x30
+  8026ec:	eb 90                	jmp    80267e <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8026ee:	83 ec 0c             	sub    $0xc,%esp
+  8026f1:	50                   	push   %eax
+  8026f2:	6a 24                	push   $0x24
+  8026f4:	68 99 2f 80 00       	push   $0x802f99
+  8026f9:	6a 4a                	push   $0x4a
+  8026fb:	68 b6 2f 80 00       	push   $0x802fb6
+  802700:	e8 3e dc ff ff       	call   800343 <_panic>
+
+00802705 <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  802705:	55                   	push   %ebp
+  802706:	89 e5                	mov    %esp,%ebp
+  802708:	57                   	push   %edi
+  802709:	56                   	push   %esi
+  80270a:	53                   	push   %ebx
+  80270b:	83 ec 20             	sub    $0x20,%esp
+  80270e:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  802711:	8b 10                	mov    (%eax),%edx
+  802713:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802716:	8b 50 04             	mov    0x4(%eax),%edx
+  802719:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80271c:	8b 50 08             	mov    0x8(%eax),%edx
+  80271f:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  802722:	8b 50 0c             	mov    0xc(%eax),%edx
+  802725:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  802728:	8b 40 10             	mov    0x10(%eax),%eax
+  80272b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  80272e:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  802731:	8b 55 08             	mov    0x8(%ebp),%edx
+  802734:	b8 25 00 00 00       	mov    $0x25,%eax
+  802739:	55                   	push   %ebp
+  80273a:	56                   	push   %esi
+  80273b:	8b 0e                	mov    (%esi),%ecx
+  80273d:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802740:	8b 7e 08             	mov    0x8(%esi),%edi
+  802743:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802746:	8b 76 0c             	mov    0xc(%esi),%esi
+  802749:	cd 30                	int    $0x30
+  80274b:	87 34 24             	xchg   %esi,(%esp)
+  80274e:	89 0e                	mov    %ecx,(%esi)
+  802750:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802753:	89 7e 08             	mov    %edi,0x8(%esi)
+  802756:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802759:	8f 46 0c             	pop    0xc(%esi)
+  80275c:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  80275d:	83 c4 20             	add    $0x20,%esp
+  802760:	5b                   	pop    %ebx
+  802761:	5e                   	pop    %esi
+  802762:	5f                   	pop    %edi
+  802763:	5d                   	pop    %ebp
+  802764:	c3                   	ret
+
+00802765 <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  802765:	55                   	push   %ebp
+  802766:	89 e5                	mov    %esp,%ebp
+  802768:	57                   	push   %edi
+  802769:	56                   	push   %esi
+  80276a:	53                   	push   %ebx
+  80276b:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  80276e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802771:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  802773:	8b 55 08             	mov    0x8(%ebp),%edx
+  802776:	b8 26 00 00 00       	mov    $0x26,%eax
+  80277b:	55                   	push   %ebp
+  80277c:	56                   	push   %esi
+  80277d:	8b 0e                	mov    (%esi),%ecx
+  80277f:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802782:	8b 7e 08             	mov    0x8(%esi),%edi
+  802785:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802788:	8b 76 0c             	mov    0xc(%esi),%esi
+  80278b:	cd 30                	int    $0x30
+  80278d:	87 34 24             	xchg   %esi,(%esp)
+  802790:	89 0e                	mov    %ecx,(%esi)
+  802792:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802795:	89 7e 08             	mov    %edi,0x8(%esi)
+  802798:	89 6e 10             	mov    %ebp,0x10(%esi)
+  80279b:	8f 46 0c             	pop    0xc(%esi)
+  80279e:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  80279f:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  8027a3:	74 0f                	je     8027b4 <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  8027a5:	85 c0                	test   %eax,%eax
+  8027a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027ac:	0f 48 d1             	cmovs  %ecx,%edx
+  8027af:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8027b2:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  8027b4:	5b                   	pop    %ebx
+  8027b5:	5e                   	pop    %esi
+  8027b6:	5f                   	pop    %edi
+  8027b7:	5d                   	pop    %ebp
+  8027b8:	c3                   	ret
+
+008027b9 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  8027b9:	55                   	push   %ebp
+  8027ba:	89 e5                	mov    %esp,%ebp
+  8027bc:	57                   	push   %edi
+  8027bd:	56                   	push   %esi
+  8027be:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8027bf:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8027c6:	78 2f                	js     8027f7 <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  8027c8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8027cf:	74 72                	je     802843 <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  8027d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8027d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027d9:	b8 27 00 00 00       	mov    $0x27,%eax
+  8027de:	89 cb                	mov    %ecx,%ebx
+  8027e0:	89 cf                	mov    %ecx,%edi
+  8027e2:	89 ce                	mov    %ecx,%esi
+  8027e4:	55                   	push   %ebp
+  8027e5:	68 ee 27 80 00       	push   $0x8027ee
+  8027ea:	89 e5                	mov    %esp,%ebp
+  8027ec:	0f 34                	sysenter
+  8027ee:	83 c4 04             	add    $0x4,%esp
+  8027f1:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  8027f2:	5b                   	pop    %ebx
+  8027f3:	5e                   	pop    %esi
+  8027f4:	5f                   	pop    %edi
+  8027f5:	5d                   	pop    %ebp
+  8027f6:	c3                   	ret
+  8027f7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8027fc:	0f a2                	cpuid
+		return 0;
+  8027fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802803:	f6 c6 08             	test   $0x8,%dh
+  802806:	74 15                	je     80281d <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802808:	89 c2                	mov    %eax,%edx
+  80280a:	c1 ea 08             	shr    $0x8,%edx
+  80280d:	83 e2 0f             	and    $0xf,%edx
+  802810:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802815:	83 fa 06             	cmp    $0x6,%edx
+  802818:	74 0e                	je     802828 <sys_sysring_setup+0x6f>
+  80281a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80281d:	0f b6 c9             	movzbl %cl,%ecx
+  802820:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802826:	eb a0                	jmp    8027c8 <sys_sysring_setup+0xf>
+  802828:	89 c2                	mov    %eax,%edx
+  80282a:	c1 ea 04             	shr    $0x4,%edx
+  80282d:	83 e2 0f             	and    $0xf,%edx
+  802830:	83 fa 02             	cmp    $0x2,%edx
+  802833:	77 e5                	ja     80281a <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  802835:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802838:	83 f8 02             	cmp    $0x2,%eax
+  80283b:	0f 97 c1             	seta   %cl
+  80283e:	0f b6 c9             	movzbl %cl,%ecx
+  802841:	eb d7                	jmp    80281a <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  802843:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802848:	b8 27 00 00 00       	mov    $0x27,%eax
+  80284d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802850:	89 cb                	mov    %ecx,%ebx
+  802852:	89 cf                	mov    %ecx,%edi
+  802854:	89 ce                	mov    %ecx,%esi
+  802856:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  802858:	eb 98                	jmp    8027f2 <sys_sysring_setup+0x39>
+
+0080285a <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  80285a:	55                   	push   %ebp
+  80285b:	89 e5                	mov    %esp,%ebp
+  80285d:	57                   	push   %edi
+  80285e:	56                   	push   %esi
+  80285f:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802860:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802867:	78 2e                	js     802897 <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  802869:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802870:	74 71                	je     8028e3 <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  802872:	ba 00 00 00 00       	mov    $0x0,%edx
+  802877:	b8 28 00 00 00       	mov    $0x28,%eax
+  80287c:	89 d1                	mov    %edx,%ecx
+  80287e:	89 d3                	mov    %edx,%ebx
+  802880:	89 d7                	mov    %edx,%edi
+  802882:	89 d6                	mov    %edx,%esi
+  802884:	55                   	push   %ebp
+  802885:	68 8e 28 80 00       	push   $0x80288e
+  80288a:	89 e5                	mov    %esp,%ebp
+  80288c:	0f 34                	sysenter
+  80288e:	83 c4 04             	add    $0x4,%esp
+  802891:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  802892:	5b                   	pop    %ebx
+  802893:	5e                   	pop    %esi
+  802894:	5f                   	pop    %edi
+  802895:	5d                   	pop    %ebp
+  802896:	c3                   	ret
+  802897:	b8 01 00 00 00       	mov    $0x1,%eax
+  80289c:	0f a2                	cpuid
+		return 0;
+  80289e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8028a3:	f6 c6 08             	test   $0x8,%dh
+  8028a6:	74 15                	je     8028bd <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8028a8:	89 c2                	mov    %eax,%edx
+  8028aa:	c1 ea 08             	shr    $0x8,%edx
+  8028ad:	83 e2 0f             	and    $0xf,%edx
+  8028b0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8028b5:	83 fa 06             	cmp    $0x6,%edx
+  8028b8:	74 0e                	je     8028c8 <sys_sysring_enter+0x6e>
+  8028ba:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8028bd:	0f b6 c9             	movzbl %cl,%ecx
+  8028c0:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8028c6:	eb a1                	jmp    802869 <sys_sysring_enter+0xf>
+  8028c8:	89 c2                	mov    %eax,%edx
+  8028ca:	c1 ea 04             	shr    $0x4,%edx
+  8028cd:	83 e2 0f             	and    $0xf,%edx
+  8028d0:	83 fa 02             	cmp    $0x2,%edx
+  8028d3:	77 e5                	ja     8028ba <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  8028d5:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8028d8:	83 f8 02             	cmp    $0x2,%eax
+  8028db:	0f 97 c1             	seta   %cl
+  8028de:	0f b6 c9             	movzbl %cl,%ecx
+  8028e1:	eb d7                	jmp    8028ba <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  8028e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028e8:	b8 28 00 00 00       	mov    $0x28,%eax
+  8028ed:	89 d1                	mov    %edx,%ecx
+  8028ef:	89 d3                	mov    %edx,%ebx
+  8028f1:	89 d7                	mov    %edx,%edi
+  8028f3:	89 d6                	mov    %edx,%esi
+  8028f5:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  8028f7:	eb 99                	jmp    802892 <sys_sysring_enter+0x38>
+
+008028f9 <sysring_init>:
+// The page must already be mapped writable.
+// Returns 0 on success, < 0 on error.
+//
+int
+sysring_init(struct sysring *sr)
+{
+  8028f9:	55                   	push   %ebp
+  8028fa:	89 e5                	mov    %esp,%ebp
+  8028fc:	53                   	push   %ebx
+  8028fd:	83 ec 08             	sub    $0x8,%esp
+  802900:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	memset(sr, 0, sizeof(*sr));
+  802903:	68 00 0a 00 00       	push   $0xa00
+  802908:	6a 00                	push   $0x0
+  80290a:	53                   	push   %ebx
+  80290b:	e8 86 e2 ff ff       	call   800b96 <memset>
+	return sys_sysring_setup(sr);
+  802910:	89 1c 24             	mov    %ebx,(%esp)
+  802913:	e8 a1 fe ff ff       	call   8027b9 <sys_sysring_setup>
+}
+  802918:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80291b:	c9                   	leave
+  80291c:	c3                   	ret
+
+0080291d <sysring_push>:
+// Queue a copy of the call in 'sqe'.  Nothing runs until
+// sysring_submit.  Returns 1 on success, 0 if the ring is full.
+//
+bool
+sysring_push(struct sysring *sr, const struct sysring_sqe *sqe)
+{
+  80291d:	55                   	push   %ebp
+  80291e:	89 e5                	mov    %esp,%ebp
+  802920:	57                   	push   %edi
+  802921:	56                   	push   %esi
+  802922:	53                   	push   %ebx
+  802923:	8b 75 08             	mov    0x8(%ebp),%esi
+  802926:	8b 45 0c             	mov    0xc(%ebp),%eax
+	uint32_t tail = sr->sr_sq_tail;
+  802929:	8b 1e                	mov    (%esi),%ebx
+
+	if (tail - sr->sr_sq_head == SYSRING_NENTRIES)
+  80292b:	8b 56 40             	mov    0x40(%esi),%edx
+  80292e:	89 d9                	mov    %ebx,%ecx
+  802930:	29 d1                	sub    %edx,%ecx
+		return 0;
+  802932:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (tail - sr->sr_sq_head == SYSRING_NENTRIES)
+  802937:	83 f9 40             	cmp    $0x40,%ecx
+  80293a:	74 46                	je     802982 <sysring_push+0x65>
+	sr->sr_sq[tail % SYSRING_NENTRIES] = *sqe;
+  80293c:	89 d9                	mov    %ebx,%ecx
+  80293e:	83 e1 3f             	and    $0x3f,%ecx
+  802941:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802944:	01 f1                	add    %esi,%ecx
+  802946:	8d 91 00 01 00 00    	lea    0x100(%ecx),%edx
+  80294c:	8b 38                	mov    (%eax),%edi
+  80294e:	89 b9 00 01 00 00    	mov    %edi,0x100(%ecx)
+  802954:	8b 48 04             	mov    0x4(%eax),%ecx
+  802957:	89 4a 04             	mov    %ecx,0x4(%edx)
+  80295a:	8b 48 08             	mov    0x8(%eax),%ecx
+  80295d:	89 4a 08             	mov    %ecx,0x8(%edx)
+  802960:	8b 48 0c             	mov    0xc(%eax),%ecx
+  802963:	89 4a 0c             	mov    %ecx,0xc(%edx)
+  802966:	8b 48 10             	mov    0x10(%eax),%ecx
+  802969:	89 4a 10             	mov    %ecx,0x10(%edx)
+  80296c:	8b 48 14             	mov    0x14(%eax),%ecx
+  80296f:	89 4a 14             	mov    %ecx,0x14(%edx)
+  802972:	8b 40 18             	mov    0x18(%eax),%eax
+  802975:	89 42 18             	mov    %eax,0x18(%edx)
+	barrier();
+	sr->sr_sq_tail = tail + 1;
+  802978:	83 c3 01             	add    $0x1,%ebx
+  80297b:	89 1e                	mov    %ebx,(%esi)
+	return 1;
+  80297d:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802982:	89 d0                	mov    %edx,%eax
+  802984:	5b                   	pop    %ebx
+  802985:	5e                   	pop    %esi
+  802986:	5f                   	pop    %edi
+  802987:	5d                   	pop    %ebp
+  802988:	c3                   	ret
+
+00802989 <sysring_submit>:
+// completion ring fills up; reap the results and submit again.
+// Returns the number of calls run, < 0 on error.
+//
+int
+sysring_submit(struct sysring *sr)
+{
+  802989:	55                   	push   %ebp
+  80298a:	89 e5                	mov    %esp,%ebp
+  80298c:	83 ec 08             	sub    $0x8,%esp
+	USED(sr);
+	return sys_sysring_enter();
+  80298f:	e8 c6 fe ff ff       	call   80285a <sys_sysring_enter>
+}
+  802994:	c9                   	leave
+  802995:	c3                   	ret
+
+00802996 <sysring_reap>:
+// Take the oldest result off the completion ring, copying it to 'cqe'.
+// Returns 1 on success, 0 if there is none.
+//
+bool
+sysring_reap(struct sysring *sr, struct sysring_cqe *cqe)
+{
+  802996:	55                   	push   %ebp
+  802997:	89 e5                	mov    %esp,%ebp
+  802999:	56                   	push   %esi
+  80299a:	53                   	push   %ebx
+  80299b:	8b 55 08             	mov    0x8(%ebp),%edx
+	uint32_t head = sr->sr_cq_head;
+  80299e:	8b 82 c0 00 00 00    	mov    0xc0(%edx),%eax
+
+	if (sr->sr_cq_tail == head)
+  8029a4:	8b 9a 80 00 00 00    	mov    0x80(%edx),%ebx
+		return 0;
+  8029aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (sr->sr_cq_tail == head)
+  8029af:	39 c3                	cmp    %eax,%ebx
+  8029b1:	74 29                	je     8029dc <sysring_reap+0x46>
+	barrier();
+	*cqe = sr->sr_cq[head % SYSRING_NENTRIES];
+  8029b3:	89 c1                	mov    %eax,%ecx
+  8029b5:	83 e1 3f             	and    $0x3f,%ecx
+  8029b8:	8b 9c ca 04 08 00 00 	mov    0x804(%edx,%ecx,8),%ebx
+  8029bf:	8b 8c ca 00 08 00 00 	mov    0x800(%edx,%ecx,8),%ecx
+  8029c6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8029c9:	89 0e                	mov    %ecx,(%esi)
+  8029cb:	89 5e 04             	mov    %ebx,0x4(%esi)
+	barrier();
+	sr->sr_cq_head = head + 1;
+  8029ce:	83 c0 01             	add    $0x1,%eax
+  8029d1:	89 82 c0 00 00 00    	mov    %eax,0xc0(%edx)
+	return 1;
+  8029d7:	b9 01 00 00 00       	mov    $0x1,%ecx
+}
+  8029dc:	89 c8                	mov    %ecx,%eax
+  8029de:	5b                   	pop    %ebx
+  8029df:	5e                   	pop    %esi
+  8029e0:	5d                   	pop    %ebp
+  8029e1:	c3                   	ret
+
+008029e2 <dm>:
+  8029e2:	55                   	push   %ebp
+  8029e3:	57                   	push   %edi
+  8029e4:	56                   	push   %esi
+  8029e5:	53                   	push   %ebx
+  8029e6:	83 ec 24             	sub    $0x24,%esp
+  8029e9:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8029ed:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8029f1:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8029f5:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8029f9:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8029fd:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802a01:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802a05:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a0a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a0f:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802a14:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802a1b:	00 
+  802a1c:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802a23:	00 
+  802a24:	89 fb                	mov    %edi,%ebx
+  802a26:	eb 08                	jmp    802a30 <dm+0x4e>
+  802a28:	83 e9 01             	sub    $0x1,%ecx
+  802a2b:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802a2e:	74 68                	je     802a98 <dm+0xb6>
+  802a30:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802a34:	01 c0                	add    %eax,%eax
+  802a36:	89 c6                	mov    %eax,%esi
+  802a38:	89 d7                	mov    %edx,%edi
+  802a3a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802a3e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802a42:	0f ad d0             	shrd   %cl,%edx,%eax
+  802a45:	d3 ea                	shr    %cl,%edx
+  802a47:	f6 c1 20             	test   $0x20,%cl
+  802a4a:	74 04                	je     802a50 <dm+0x6e>
+  802a4c:	89 d0                	mov    %edx,%eax
+  802a4e:	31 d2                	xor    %edx,%edx
+  802a50:	83 e0 01             	and    $0x1,%eax
+  802a53:	89 04 24             	mov    %eax,(%esp)
+  802a56:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802a5d:	00 
+  802a5e:	8b 04 24             	mov    (%esp),%eax
+  802a61:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802a65:	09 f0                	or     %esi,%eax
+  802a67:	09 fa                	or     %edi,%edx
+  802a69:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802a6d:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802a71:	39 f0                	cmp    %esi,%eax
+  802a73:	89 d5                	mov    %edx,%ebp
+  802a75:	19 fd                	sbb    %edi,%ebp
+  802a77:	72 af                	jb     802a28 <dm+0x46>
+  802a79:	29 f0                	sub    %esi,%eax
+  802a7b:	19 fa                	sbb    %edi,%edx
+  802a7d:	89 cf                	mov    %ecx,%edi
+  802a7f:	c1 ef 05             	shr    $0x5,%edi
+  802a82:	83 e7 01             	and    $0x1,%edi
+  802a85:	89 fe                	mov    %edi,%esi
+  802a87:	83 f6 01             	xor    $0x1,%esi
+  802a8a:	d3 e6                	shl    %cl,%esi
+  802a8c:	d3 e7                	shl    %cl,%edi
+  802a8e:	09 74 24 18          	or     %esi,0x18(%esp)
+  802a92:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802a96:	eb 90                	jmp    802a28 <dm+0x46>
+  802a98:	85 db                	test   %ebx,%ebx
+  802a9a:	74 05                	je     802aa1 <dm+0xbf>
+  802a9c:	89 03                	mov    %eax,(%ebx)
+  802a9e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802aa1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802aa5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802aa9:	83 c4 24             	add    $0x24,%esp
+  802aac:	5b                   	pop    %ebx
+  802aad:	5e                   	pop    %esi
+  802aae:	5f                   	pop    %edi
+  802aaf:	5d                   	pop    %ebp
+  802ab0:	c3                   	ret
+
+00802ab1 <__udivdi3>:
+  802ab1:	83 ec 08             	sub    $0x8,%esp
+  802ab4:	6a 00                	push   $0x0
+  802ab6:	ff 74 24 1c          	push   0x1c(%esp)
+  802aba:	ff 74 24 1c          	push   0x1c(%esp)
+  802abe:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802ac2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802ac6:	e8 17 ff ff ff       	call   8029e2 <dm>
+  802acb:	83 c4 14             	add    $0x14,%esp
+  802ace:	c3                   	ret
+
+00802acf <__umoddi3>:
+  802acf:	83 ec 18             	sub    $0x18,%esp
+  802ad2:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802ad6:	50                   	push   %eax
+  802ad7:	ff 74 24 2c          	push   0x2c(%esp)
+  802adb:	ff 74 24 2c          	push   0x2c(%esp)
+  802adf:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802ae3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802ae7:	e8 f6 fe ff ff       	call   8029e2 <dm>
+  802aec:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802af0:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802af4:	83 c4 24             	add    $0x24,%esp
+  802af7:	c3                   	ret
+
+00802af8 <__divdi3>:
+  802af8:	53                   	push   %ebx
+  802af9:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802afd:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802b01:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  802b05:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  802b09:	85 d2                	test   %edx,%edx
+  802b0b:	78 15                	js     802b22 <__divdi3+0x2a>
+  802b0d:	85 db                	test   %ebx,%ebx
+  802b0f:	78 34                	js     802b45 <__divdi3+0x4d>
+  802b11:	83 ec 04             	sub    $0x4,%esp
+  802b14:	6a 00                	push   $0x0
+  802b16:	53                   	push   %ebx
+  802b17:	51                   	push   %ecx
+  802b18:	e8 c5 fe ff ff       	call   8029e2 <dm>
+  802b1d:	83 c4 10             	add    $0x10,%esp
+  802b20:	eb 21                	jmp    802b43 <__divdi3+0x4b>
+  802b22:	f7 d8                	neg    %eax
+  802b24:	83 d2 00             	adc    $0x0,%edx
+  802b27:	f7 da                	neg    %edx
+  802b29:	85 db                	test   %ebx,%ebx
+  802b2b:	78 30                	js     802b5d <__divdi3+0x65>
+  802b2d:	83 ec 04             	sub    $0x4,%esp
+  802b30:	6a 00                	push   $0x0
+  802b32:	53                   	push   %ebx
+  802b33:	51                   	push   %ecx
+  802b34:	e8 a9 fe ff ff       	call   8029e2 <dm>
+  802b39:	83 c4 10             	add    $0x10,%esp
+  802b3c:	f7 d8                	neg    %eax
+  802b3e:	83 d2 00             	adc    $0x0,%edx
+  802b41:	f7 da                	neg    %edx
+  802b43:	5b                   	pop    %ebx
+  802b44:	c3                   	ret
+  802b45:	83 ec 04             	sub    $0x4,%esp
+  802b48:	6a 00                	push   $0x0
+  802b4a:	f7 d9                	neg    %ecx
+  802b4c:	83 d3 00             	adc    $0x0,%ebx
+  802b4f:	f7 db                	neg    %ebx
+  802b51:	53                   	push   %ebx
+  802b52:	51                   	push   %ecx
+  802b53:	e8 8a fe ff ff       	call   8029e2 <dm>
+  802b58:	83 c4 10             	add    $0x10,%esp
+  802b5b:	eb df                	jmp    802b3c <__divdi3+0x44>
+  802b5d:	83 ec 04             	sub    $0x4,%esp
+  802b60:	6a 00                	push   $0x0
+  802b62:	f7 d9                	neg    %ecx
+  802b64:	83 d3 00             	adc    $0x0,%ebx
+  802b67:	f7 db                	neg    %ebx
+  802b69:	53                   	push   %ebx
+  802b6a:	51                   	push   %ecx
+  802b6b:	e8 72 fe ff ff       	call   8029e2 <dm>
+  802b70:	83 c4 10             	add    $0x10,%esp
+  802b73:	eb ce                	jmp    802b43 <__divdi3+0x4b>
+
+00802b75 <__moddi3>:
+  802b75:	55                   	push   %ebp
+  802b76:	57                   	push   %edi
+  802b77:	56                   	push   %esi
+  802b78:	53                   	push   %ebx
+  802b79:	83 ec 18             	sub    $0x18,%esp
+  802b7c:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802b80:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802b84:	89 f1                	mov    %esi,%ecx
+  802b86:	f7 d9                	neg    %ecx
+  802b88:	89 da                	mov    %ebx,%edx
+  802b8a:	83 d2 00             	adc    $0x0,%edx
+  802b8d:	f7 da                	neg    %edx
+  802b8f:	0f 48 ce             	cmovs  %esi,%ecx
+  802b92:	0f 48 d3             	cmovs  %ebx,%edx
+  802b95:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802b99:	50                   	push   %eax
+  802b9a:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802b9e:	f7 de                	neg    %esi
+  802ba0:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802ba4:	83 d0 00             	adc    $0x0,%eax
+  802ba7:	f7 d8                	neg    %eax
+  802ba9:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802bae:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802bb3:	50                   	push   %eax
+  802bb4:	56                   	push   %esi
+  802bb5:	89 c8                	mov    %ecx,%eax
+  802bb7:	e8 26 fe ff ff       	call   8029e2 <dm>
+  802bbc:	83 c4 10             	add    $0x10,%esp
+  802bbf:	85 db                	test   %ebx,%ebx
+  802bc1:	78 10                	js     802bd3 <__moddi3+0x5e>
+  802bc3:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802bc7:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802bcb:	83 c4 14             	add    $0x14,%esp
+  802bce:	5b                   	pop    %ebx
+  802bcf:	5e                   	pop    %esi
+  802bd0:	5f                   	pop    %edi
+  802bd1:	5d                   	pop    %ebp
+  802bd2:	c3                   	ret
+  802bd3:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802bd7:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802bdb:	f7 d8                	neg    %eax
+  802bdd:	83 d2 00             	adc    $0x0,%edx
+  802be0:	f7 da                	neg    %edx
+  802be2:	eb e7                	jmp    802bcb <__moddi3+0x56>
@@ -0,0 +1,5193 @@
+
+obj/user/testbss:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 ab 00 00 00       	call   8000dc <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+uint32_t bigarray[ARRAYSIZE];
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 14             	sub    $0x14,%esp
+	int i;
+
+	cprintf("Making sure bss works right...\n");
+  800039:	68 00 29 80 00       	push   $0x802900
+  80003e:	e8 08 02 00 00       	call   80024b <cprintf>
+  800043:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < ARRAYSIZE; i++)
+  800046:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (bigarray[i] != 0)
+  80004b:	83 3c 85 20 30 80 00 	cmpl   $0x0,0x803020(,%eax,4)
+  800052:	00 
+  800053:	75 63                	jne    8000b8 <umain+0x85>
+	for (i = 0; i < ARRAYSIZE; i++)
+  800055:	83 c0 01             	add    $0x1,%eax
+  800058:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80005d:	75 ec                	jne    80004b <umain+0x18>
+			panic("bigarray[%d] isn't cleared!\n", i);
+	for (i = 0; i < ARRAYSIZE; i++)
+  80005f:	b8 00 00 00 00       	mov    $0x0,%eax
+		bigarray[i] = i;
+  800064:	89 04 85 20 30 80 00 	mov    %eax,0x803020(,%eax,4)
+	for (i = 0; i < ARRAYSIZE; i++)
+  80006b:	83 c0 01             	add    $0x1,%eax
+  80006e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800073:	75 ef                	jne    800064 <umain+0x31>
+	for (i = 0; i < ARRAYSIZE; i++)
+  800075:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (bigarray[i] != i)
+  80007a:	39 04 85 20 30 80 00 	cmp    %eax,0x803020(,%eax,4)
+  800081:	75 47                	jne    8000ca <umain+0x97>
+	for (i = 0; i < ARRAYSIZE; i++)
+  800083:	83 c0 01             	add    $0x1,%eax
+  800086:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80008b:	75 ed                	jne    80007a <umain+0x47>
+			panic("bigarray[%d] didn't hold its value!\n", i);
+
+	cprintf("Yes, good.  Now doing a wild write off the end...\n");
+  80008d:	83 ec 0c             	sub    $0xc,%esp
+  800090:	68 48 29 80 00       	push   $0x802948
+  800095:	e8 b1 01 00 00       	call   80024b <cprintf>
+	bigarray[ARRAYSIZE+1024] = 0;
+  80009a:	c7 05 20 40 c0 00 00 	movl   $0x0,0xc04020
+  8000a1:	00 00 00 
+	panic("SHOULD HAVE TRAPPED!!!");
+  8000a4:	83 c4 0c             	add    $0xc,%esp
+  8000a7:	68 a7 29 80 00       	push   $0x8029a7
+  8000ac:	6a 1a                	push   $0x1a
+  8000ae:	68 98 29 80 00       	push   $0x802998
+  8000b3:	e8 7f 00 00 00       	call   800137 <_panic>
+			panic("bigarray[%d] isn't cleared!\n", i);
+  8000b8:	50                   	push   %eax
+  8000b9:	68 7b 29 80 00       	push   $0x80297b
+  8000be:	6a 11                	push   $0x11
+  8000c0:	68 98 29 80 00       	push   $0x802998
+  8000c5:	e8 6d 00 00 00       	call   800137 <_panic>
+			panic("bigarray[%d] didn't hold its value!\n", i);
+  8000ca:	50                   	push   %eax
+  8000cb:	68 20 29 80 00       	push   $0x802920
+  8000d0:	6a 16                	push   $0x16
+  8000d2:	68 98 29 80 00       	push   $0x802998
+  8000d7:	e8 5b 00 00 00       	call   800137 <_panic>
+
+008000dc <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000dc:	55                   	push   %ebp
+  8000dd:	89 e5                	mov    %esp,%ebp
+  8000df:	56                   	push   %esi
+  8000e0:	53                   	push   %ebx
+  8000e1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000e4:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  8000e7:	e8 e3 0e 00 00       	call   800fcf <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  8000ec:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000f1:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  8000f7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000fc:	a3 20 30 c0 00       	mov    %eax,0xc03020
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800101:	85 db                	test   %ebx,%ebx
+  800103:	7e 07                	jle    80010c <libmain+0x30>
+		binaryname = argv[0];
+  800105:	8b 06                	mov    (%esi),%eax
+  800107:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  80010c:	83 ec 08             	sub    $0x8,%esp
+  80010f:	56                   	push   %esi
+  800110:	53                   	push   %ebx
+  800111:	e8 1d ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800116:	e8 0a 00 00 00       	call   800125 <exit>
+}
+  80011b:	83 c4 10             	add    $0x10,%esp
+  80011e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800121:	5b                   	pop    %ebx
+  800122:	5e                   	pop    %esi
+  800123:	5d                   	pop    %ebp
+  800124:	c3                   	ret
+
+00800125 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800125:	55                   	push   %ebp
+  800126:	89 e5                	mov    %esp,%ebp
+  800128:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  80012b:	6a 00                	push   $0x0
+  80012d:	e8 db 0d 00 00       	call   800f0d <sys_env_destroy>
+}
+  800132:	83 c4 10             	add    $0x10,%esp
+  800135:	c9                   	leave
+  800136:	c3                   	ret
+
+00800137 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800137:	55                   	push   %ebp
+  800138:	89 e5                	mov    %esp,%ebp
+  80013a:	57                   	push   %edi
+  80013b:	56                   	push   %esi
+  80013c:	53                   	push   %ebx
+  80013d:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  800143:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  800146:	8b 1d 00 30 80 00    	mov    0x803000,%ebx
+  80014c:	e8 7e 0e 00 00       	call   800fcf <sys_getenvid>
+  800151:	83 ec 04             	sub    $0x4,%esp
+  800154:	ff 75 0c             	push   0xc(%ebp)
+  800157:	ff 75 08             	push   0x8(%ebp)
+  80015a:	53                   	push   %ebx
+  80015b:	50                   	push   %eax
+  80015c:	68 c8 29 80 00       	push   $0x8029c8
+  800161:	68 00 01 00 00       	push   $0x100
+  800166:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  80016c:	56                   	push   %esi
+  80016d:	e8 72 06 00 00       	call   8007e4 <snprintf>
+  800172:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  800174:	83 c4 20             	add    $0x20,%esp
+  800177:	57                   	push   %edi
+  800178:	ff 75 10             	push   0x10(%ebp)
+  80017b:	bf 00 01 00 00       	mov    $0x100,%edi
+  800180:	89 f8                	mov    %edi,%eax
+  800182:	29 d8                	sub    %ebx,%eax
+  800184:	50                   	push   %eax
+  800185:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  800188:	50                   	push   %eax
+  800189:	e8 08 06 00 00       	call   800796 <vsnprintf>
+  80018e:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  800190:	83 c4 0c             	add    $0xc,%esp
+  800193:	68 96 29 80 00       	push   $0x802996
+  800198:	29 df                	sub    %ebx,%edi
+  80019a:	57                   	push   %edi
+  80019b:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  80019e:	50                   	push   %eax
+  80019f:	e8 40 06 00 00       	call   8007e4 <snprintf>
+	sys_cputs(buf, r);
+  8001a4:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  8001a7:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  8001a9:	53                   	push   %ebx
+  8001aa:	56                   	push   %esi
+  8001ab:	e8 21 0c 00 00       	call   800dd1 <sys_cputs>
+  8001b0:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001b3:	cc                   	int3
+	while (1)
+  8001b4:	eb fd                	jmp    8001b3 <_panic+0x7c>
+
+008001b6 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001b6:	55                   	push   %ebp
+  8001b7:	89 e5                	mov    %esp,%ebp
+  8001b9:	53                   	push   %ebx
+  8001ba:	83 ec 04             	sub    $0x4,%esp
+  8001bd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001c0:	8b 13                	mov    (%ebx),%edx
+  8001c2:	8d 42 01             	lea    0x1(%edx),%eax
+  8001c5:	89 03                	mov    %eax,(%ebx)
+  8001c7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001ca:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001ce:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001d3:	74 09                	je     8001de <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001d5:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001d9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001dc:	c9                   	leave
+  8001dd:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001de:	83 ec 08             	sub    $0x8,%esp
+  8001e1:	68 ff 00 00 00       	push   $0xff
+  8001e6:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001e9:	50                   	push   %eax
+  8001ea:	e8 e2 0b 00 00       	call   800dd1 <sys_cputs>
+		b->idx = 0;
+  8001ef:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001f5:	83 c4 10             	add    $0x10,%esp
+  8001f8:	eb db                	jmp    8001d5 <putch+0x1f>
+
+008001fa <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001fa:	55                   	push   %ebp
+  8001fb:	89 e5                	mov    %esp,%ebp
+  8001fd:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800203:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80020a:	00 00 00 
+	b.cnt = 0;
+  80020d:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800214:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800217:	ff 75 0c             	push   0xc(%ebp)
+  80021a:	ff 75 08             	push   0x8(%ebp)
+  80021d:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800223:	50                   	push   %eax
+  800224:	68 b6 01 80 00       	push   $0x8001b6
+  800229:	e8 14 01 00 00       	call   800342 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80022e:	83 c4 08             	add    $0x8,%esp
+  800231:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800237:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80023d:	50                   	push   %eax
+  80023e:	e8 8e 0b 00 00       	call   800dd1 <sys_cputs>
+
+	return b.cnt;
+}
+  800243:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800249:	c9                   	leave
+  80024a:	c3                   	ret
+
+0080024b <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80024b:	55                   	push   %ebp
+  80024c:	89 e5                	mov    %esp,%ebp
+  80024e:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800251:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800254:	50                   	push   %eax
+  800255:	ff 75 08             	push   0x8(%ebp)
+  800258:	e8 9d ff ff ff       	call   8001fa <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80025d:	c9                   	leave
+  80025e:	c3                   	ret
+
+0080025f <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80025f:	55                   	push   %ebp
+  800260:	89 e5                	mov    %esp,%ebp
+  800262:	57                   	push   %edi
+  800263:	56                   	push   %esi
+  800264:	53                   	push   %ebx
+  800265:	83 ec 1c             	sub    $0x1c,%esp
+  800268:	89 c7                	mov    %eax,%edi
+  80026a:	89 d6                	mov    %edx,%esi
+  80026c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80026f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800272:	89 d1                	mov    %edx,%ecx
+  800274:	89 c2                	mov    %eax,%edx
+  800276:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800279:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80027c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80027f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800282:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800285:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80028c:	39 c2                	cmp    %eax,%edx
+  80028e:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800291:	72 3e                	jb     8002d1 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800293:	83 ec 0c             	sub    $0xc,%esp
+  800296:	ff 75 18             	push   0x18(%ebp)
+  800299:	83 eb 01             	sub    $0x1,%ebx
+  80029c:	53                   	push   %ebx
+  80029d:	50                   	push   %eax
+  80029e:	83 ec 08             	sub    $0x8,%esp
+  8002a1:	ff 75 e4             	push   -0x1c(%ebp)
+  8002a4:	ff 75 e0             	push   -0x20(%ebp)
+  8002a7:	ff 75 dc             	push   -0x24(%ebp)
+  8002aa:	ff 75 d8             	push   -0x28(%ebp)
+  8002ad:	e8 0a 25 00 00       	call   8027bc <__udivdi3>
+  8002b2:	83 c4 18             	add    $0x18,%esp
+  8002b5:	52                   	push   %edx
+  8002b6:	50                   	push   %eax
+  8002b7:	89 f2                	mov    %esi,%edx
+  8002b9:	89 f8                	mov    %edi,%eax
+  8002bb:	e8 9f ff ff ff       	call   80025f <printnum>
+  8002c0:	83 c4 20             	add    $0x20,%esp
+  8002c3:	eb 13                	jmp    8002d8 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002c5:	83 ec 08             	sub    $0x8,%esp
+  8002c8:	56                   	push   %esi
+  8002c9:	ff 75 18             	push   0x18(%ebp)
+  8002cc:	ff d7                	call   *%edi
+  8002ce:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002d1:	83 eb 01             	sub    $0x1,%ebx
+  8002d4:	85 db                	test   %ebx,%ebx
+  8002d6:	7f ed                	jg     8002c5 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002d8:	83 ec 08             	sub    $0x8,%esp
+  8002db:	56                   	push   %esi
+  8002dc:	83 ec 04             	sub    $0x4,%esp
+  8002df:	ff 75 e4             	push   -0x1c(%ebp)
+  8002e2:	ff 75 e0             	push   -0x20(%ebp)
+  8002e5:	ff 75 dc             	push   -0x24(%ebp)
+  8002e8:	ff 75 d8             	push   -0x28(%ebp)
+  8002eb:	e8 ea 24 00 00       	call   8027da <__umoddi3>
+  8002f0:	83 c4 14             	add    $0x14,%esp
+  8002f3:	0f be 80 eb 29 80 00 	movsbl 0x8029eb(%eax),%eax
+  8002fa:	50                   	push   %eax
+  8002fb:	ff d7                	call   *%edi
+}
+  8002fd:	83 c4 10             	add    $0x10,%esp
+  800300:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800303:	5b                   	pop    %ebx
+  800304:	5e                   	pop    %esi
+  800305:	5f                   	pop    %edi
+  800306:	5d                   	pop    %ebp
+  800307:	c3                   	ret
+
+00800308 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800308:	55                   	push   %ebp
+  800309:	89 e5                	mov    %esp,%ebp
+  80030b:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80030e:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800312:	8b 10                	mov    (%eax),%edx
+  800314:	3b 50 04             	cmp    0x4(%eax),%edx
+  800317:	73 0a                	jae    800323 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800319:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80031c:	89 08                	mov    %ecx,(%eax)
+  80031e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800321:	88 02                	mov    %al,(%edx)
+}
+  800323:	5d                   	pop    %ebp
+  800324:	c3                   	ret
+
+00800325 <printfmt>:
+{
+  800325:	55                   	push   %ebp
+  800326:	89 e5                	mov    %esp,%ebp
+  800328:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80032b:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80032e:	50                   	push   %eax
+  80032f:	ff 75 10             	push   0x10(%ebp)
+  800332:	ff 75 0c             	push   0xc(%ebp)
+  800335:	ff 75 08             	push   0x8(%ebp)
+  800338:	e8 05 00 00 00       	call   800342 <vprintfmt>
+}
+  80033d:	83 c4 10             	add    $0x10,%esp
+  800340:	c9                   	leave
+  800341:	c3                   	ret
+
+00800342 <vprintfmt>:
+{
+  800342:	55                   	push   %ebp
+  800343:	89 e5                	mov    %esp,%ebp
+  800345:	57                   	push   %edi
+  800346:	56                   	push   %esi
+  800347:	53                   	push   %ebx
+  800348:	83 ec 2c             	sub    $0x2c,%esp
+  80034b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80034e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800351:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800354:	eb 0a                	jmp    800360 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800356:	83 ec 08             	sub    $0x8,%esp
+  800359:	53                   	push   %ebx
+  80035a:	50                   	push   %eax
+  80035b:	ff d6                	call   *%esi
+  80035d:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800360:	83 c7 01             	add    $0x1,%edi
+  800363:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800367:	83 f8 25             	cmp    $0x25,%eax
+  80036a:	74 0c                	je     800378 <vprintfmt+0x36>
+			if (ch == '\0')
+  80036c:	85 c0                	test   %eax,%eax
+  80036e:	75 e6                	jne    800356 <vprintfmt+0x14>
+}
+  800370:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800373:	5b                   	pop    %ebx
+  800374:	5e                   	pop    %esi
+  800375:	5f                   	pop    %edi
+  800376:	5d                   	pop    %ebp
+  800377:	c3                   	ret
+		padc = ' ';
+  800378:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80037c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800383:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80038a:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800391:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800396:	8d 47 01             	lea    0x1(%edi),%eax
+  800399:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80039c:	0f b6 17             	movzbl (%edi),%edx
+  80039f:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003a2:	3c 55                	cmp    $0x55,%al
+  8003a4:	0f 87 cf 03 00 00    	ja     800779 <vprintfmt+0x437>
+  8003aa:	0f b6 c0             	movzbl %al,%eax
+  8003ad:	ff 24 85 e0 2a 80 00 	jmp    *0x802ae0(,%eax,4)
+  8003b4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8003b7:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8003bb:	eb d9                	jmp    800396 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003bd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003c0:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003c4:	eb d0                	jmp    800396 <vprintfmt+0x54>
+  8003c6:	0f b6 d2             	movzbl %dl,%edx
+  8003c9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003d1:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003d4:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003d7:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003db:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003de:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003e1:	83 f9 09             	cmp    $0x9,%ecx
+  8003e4:	77 55                	ja     80043b <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8003e6:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003e9:	eb e9                	jmp    8003d4 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8003eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ee:	8b 00                	mov    (%eax),%eax
+  8003f0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f6:	8d 40 04             	lea    0x4(%eax),%eax
+  8003f9:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003fc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003ff:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800403:	79 91                	jns    800396 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800405:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800408:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80040b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800412:	eb 82                	jmp    800396 <vprintfmt+0x54>
+			if (width < 0)
+  800414:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800417:	85 d2                	test   %edx,%edx
+  800419:	b8 00 00 00 00       	mov    $0x0,%eax
+  80041e:	0f 49 c2             	cmovns %edx,%eax
+  800421:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800424:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800427:	e9 6a ff ff ff       	jmp    800396 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80042c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80042f:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800436:	e9 5b ff ff ff       	jmp    800396 <vprintfmt+0x54>
+  80043b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80043e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800441:	eb bc                	jmp    8003ff <vprintfmt+0xbd>
+			lflag++;
+  800443:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800446:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800449:	e9 48 ff ff ff       	jmp    800396 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80044e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800451:	8d 78 04             	lea    0x4(%eax),%edi
+  800454:	83 ec 08             	sub    $0x8,%esp
+  800457:	53                   	push   %ebx
+  800458:	ff 30                	push   (%eax)
+  80045a:	ff d6                	call   *%esi
+			break;
+  80045c:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80045f:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800462:	e9 b1 02 00 00       	jmp    800718 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800467:	8b 45 14             	mov    0x14(%ebp),%eax
+  80046a:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80046d:	8b 10                	mov    (%eax),%edx
+  80046f:	89 d0                	mov    %edx,%eax
+  800471:	f7 d8                	neg    %eax
+  800473:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800476:	83 f8 0d             	cmp    $0xd,%eax
+  800479:	7f 23                	jg     80049e <vprintfmt+0x15c>
+  80047b:	8b 14 85 40 2c 80 00 	mov    0x802c40(,%eax,4),%edx
+  800482:	85 d2                	test   %edx,%edx
+  800484:	74 18                	je     80049e <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800486:	52                   	push   %edx
+  800487:	68 0c 2a 80 00       	push   $0x802a0c
+  80048c:	53                   	push   %ebx
+  80048d:	56                   	push   %esi
+  80048e:	e8 92 fe ff ff       	call   800325 <printfmt>
+  800493:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800496:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800499:	e9 7a 02 00 00       	jmp    800718 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80049e:	50                   	push   %eax
+  80049f:	68 03 2a 80 00       	push   $0x802a03
+  8004a4:	53                   	push   %ebx
+  8004a5:	56                   	push   %esi
+  8004a6:	e8 7a fe ff ff       	call   800325 <printfmt>
+  8004ab:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004ae:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004b1:	e9 62 02 00 00       	jmp    800718 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b9:	83 c0 04             	add    $0x4,%eax
+  8004bc:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c2:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004c4:	85 c9                	test   %ecx,%ecx
+  8004c6:	b8 fc 29 80 00       	mov    $0x8029fc,%eax
+  8004cb:	0f 45 c1             	cmovne %ecx,%eax
+  8004ce:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004d1:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004d5:	7e 06                	jle    8004dd <vprintfmt+0x19b>
+  8004d7:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004db:	75 0b                	jne    8004e8 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004dd:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004e0:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004e3:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004e6:	eb 5c                	jmp    800544 <vprintfmt+0x202>
+  8004e8:	83 ec 08             	sub    $0x8,%esp
+  8004eb:	ff 75 d0             	push   -0x30(%ebp)
+  8004ee:	ff 75 cc             	push   -0x34(%ebp)
+  8004f1:	e8 20 03 00 00       	call   800816 <strnlen>
+  8004f6:	89 c2                	mov    %eax,%edx
+  8004f8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004fb:	29 d0                	sub    %edx,%eax
+  8004fd:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800500:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800504:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800507:	89 75 08             	mov    %esi,0x8(%ebp)
+  80050a:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80050c:	eb 0e                	jmp    80051c <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80050e:	83 ec 08             	sub    $0x8,%esp
+  800511:	53                   	push   %ebx
+  800512:	57                   	push   %edi
+  800513:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800516:	83 ee 01             	sub    $0x1,%esi
+  800519:	83 c4 10             	add    $0x10,%esp
+  80051c:	85 f6                	test   %esi,%esi
+  80051e:	7f ee                	jg     80050e <vprintfmt+0x1cc>
+  800520:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800523:	8b 75 08             	mov    0x8(%ebp),%esi
+  800526:	85 c0                	test   %eax,%eax
+  800528:	ba 00 00 00 00       	mov    $0x0,%edx
+  80052d:	0f 49 d0             	cmovns %eax,%edx
+  800530:	29 d0                	sub    %edx,%eax
+  800532:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800535:	eb a6                	jmp    8004dd <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800537:	83 ec 08             	sub    $0x8,%esp
+  80053a:	53                   	push   %ebx
+  80053b:	52                   	push   %edx
+  80053c:	ff 55 08             	call   *0x8(%ebp)
+  80053f:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800542:	89 f1                	mov    %esi,%ecx
+  800544:	8d 71 01             	lea    0x1(%ecx),%esi
+  800547:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80054b:	0f be d0             	movsbl %al,%edx
+  80054e:	85 d2                	test   %edx,%edx
+  800550:	74 28                	je     80057a <vprintfmt+0x238>
+  800552:	85 ff                	test   %edi,%edi
+  800554:	78 05                	js     80055b <vprintfmt+0x219>
+  800556:	83 ef 01             	sub    $0x1,%edi
+  800559:	78 30                	js     80058b <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80055b:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80055f:	74 d6                	je     800537 <vprintfmt+0x1f5>
+  800561:	0f be c0             	movsbl %al,%eax
+  800564:	83 e8 20             	sub    $0x20,%eax
+  800567:	83 f8 5e             	cmp    $0x5e,%eax
+  80056a:	76 cb                	jbe    800537 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80056c:	83 ec 08             	sub    $0x8,%esp
+  80056f:	53                   	push   %ebx
+  800570:	6a 3f                	push   $0x3f
+  800572:	ff 55 08             	call   *0x8(%ebp)
+  800575:	83 c4 10             	add    $0x10,%esp
+  800578:	eb c8                	jmp    800542 <vprintfmt+0x200>
+  80057a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80057d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800580:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800583:	01 d0                	add    %edx,%eax
+  800585:	29 c8                	sub    %ecx,%eax
+  800587:	89 c7                	mov    %eax,%edi
+  800589:	eb 13                	jmp    80059e <vprintfmt+0x25c>
+  80058b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80058e:	eb ed                	jmp    80057d <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800590:	83 ec 08             	sub    $0x8,%esp
+  800593:	53                   	push   %ebx
+  800594:	6a 20                	push   $0x20
+  800596:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800598:	83 ef 01             	sub    $0x1,%edi
+  80059b:	83 c4 10             	add    $0x10,%esp
+  80059e:	85 ff                	test   %edi,%edi
+  8005a0:	7f ee                	jg     800590 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005a2:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8005a5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005a8:	e9 6b 01 00 00       	jmp    800718 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8005ad:	83 f9 01             	cmp    $0x1,%ecx
+  8005b0:	7f 1f                	jg     8005d1 <vprintfmt+0x28f>
+	else if (lflag)
+  8005b2:	85 c9                	test   %ecx,%ecx
+  8005b4:	74 67                	je     80061d <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8005b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b9:	8b 00                	mov    (%eax),%eax
+  8005bb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005be:	89 c1                	mov    %eax,%ecx
+  8005c0:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005c3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c9:	8d 40 04             	lea    0x4(%eax),%eax
+  8005cc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005cf:	eb 17                	jmp    8005e8 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8005d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d4:	8b 50 04             	mov    0x4(%eax),%edx
+  8005d7:	8b 00                	mov    (%eax),%eax
+  8005d9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005dc:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e2:	8d 40 08             	lea    0x8(%eax),%eax
+  8005e5:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005e8:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005eb:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005ee:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005f3:	85 c9                	test   %ecx,%ecx
+  8005f5:	0f 89 03 01 00 00    	jns    8006fe <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8005fb:	83 ec 08             	sub    $0x8,%esp
+  8005fe:	53                   	push   %ebx
+  8005ff:	6a 2d                	push   $0x2d
+  800601:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800603:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800606:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800609:	f7 da                	neg    %edx
+  80060b:	83 d1 00             	adc    $0x0,%ecx
+  80060e:	f7 d9                	neg    %ecx
+  800610:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800613:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800618:	e9 e1 00 00 00       	jmp    8006fe <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80061d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800620:	8b 00                	mov    (%eax),%eax
+  800622:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800625:	89 c1                	mov    %eax,%ecx
+  800627:	c1 f9 1f             	sar    $0x1f,%ecx
+  80062a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80062d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800630:	8d 40 04             	lea    0x4(%eax),%eax
+  800633:	89 45 14             	mov    %eax,0x14(%ebp)
+  800636:	eb b0                	jmp    8005e8 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800638:	83 f9 01             	cmp    $0x1,%ecx
+  80063b:	7f 1e                	jg     80065b <vprintfmt+0x319>
+	else if (lflag)
+  80063d:	85 c9                	test   %ecx,%ecx
+  80063f:	74 32                	je     800673 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800641:	8b 45 14             	mov    0x14(%ebp),%eax
+  800644:	8b 10                	mov    (%eax),%edx
+  800646:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80064b:	8d 40 04             	lea    0x4(%eax),%eax
+  80064e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800651:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800656:	e9 a3 00 00 00       	jmp    8006fe <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80065b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065e:	8b 10                	mov    (%eax),%edx
+  800660:	8b 48 04             	mov    0x4(%eax),%ecx
+  800663:	8d 40 08             	lea    0x8(%eax),%eax
+  800666:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800669:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80066e:	e9 8b 00 00 00       	jmp    8006fe <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800673:	8b 45 14             	mov    0x14(%ebp),%eax
+  800676:	8b 10                	mov    (%eax),%edx
+  800678:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80067d:	8d 40 04             	lea    0x4(%eax),%eax
+  800680:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800683:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800688:	eb 74                	jmp    8006fe <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  80068a:	83 f9 01             	cmp    $0x1,%ecx
+  80068d:	7f 1b                	jg     8006aa <vprintfmt+0x368>
+	else if (lflag)
+  80068f:	85 c9                	test   %ecx,%ecx
+  800691:	74 2c                	je     8006bf <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800693:	8b 45 14             	mov    0x14(%ebp),%eax
+  800696:	8b 10                	mov    (%eax),%edx
+  800698:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80069d:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006a3:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8006a8:	eb 54                	jmp    8006fe <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ad:	8b 10                	mov    (%eax),%edx
+  8006af:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006b2:	8d 40 08             	lea    0x8(%eax),%eax
+  8006b5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006b8:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8006bd:	eb 3f                	jmp    8006fe <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c2:	8b 10                	mov    (%eax),%edx
+  8006c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006c9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006cc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006cf:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8006d4:	eb 28                	jmp    8006fe <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8006d6:	83 ec 08             	sub    $0x8,%esp
+  8006d9:	53                   	push   %ebx
+  8006da:	6a 30                	push   $0x30
+  8006dc:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006de:	83 c4 08             	add    $0x8,%esp
+  8006e1:	53                   	push   %ebx
+  8006e2:	6a 78                	push   $0x78
+  8006e4:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e9:	8b 10                	mov    (%eax),%edx
+  8006eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006f0:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006f3:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006f9:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006fe:	83 ec 0c             	sub    $0xc,%esp
+  800701:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800705:	50                   	push   %eax
+  800706:	ff 75 e0             	push   -0x20(%ebp)
+  800709:	57                   	push   %edi
+  80070a:	51                   	push   %ecx
+  80070b:	52                   	push   %edx
+  80070c:	89 da                	mov    %ebx,%edx
+  80070e:	89 f0                	mov    %esi,%eax
+  800710:	e8 4a fb ff ff       	call   80025f <printnum>
+			break;
+  800715:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800718:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80071b:	e9 40 fc ff ff       	jmp    800360 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800720:	83 f9 01             	cmp    $0x1,%ecx
+  800723:	7f 1b                	jg     800740 <vprintfmt+0x3fe>
+	else if (lflag)
+  800725:	85 c9                	test   %ecx,%ecx
+  800727:	74 2c                	je     800755 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800729:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072c:	8b 10                	mov    (%eax),%edx
+  80072e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800733:	8d 40 04             	lea    0x4(%eax),%eax
+  800736:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800739:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80073e:	eb be                	jmp    8006fe <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800740:	8b 45 14             	mov    0x14(%ebp),%eax
+  800743:	8b 10                	mov    (%eax),%edx
+  800745:	8b 48 04             	mov    0x4(%eax),%ecx
+  800748:	8d 40 08             	lea    0x8(%eax),%eax
+  80074b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80074e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800753:	eb a9                	jmp    8006fe <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800755:	8b 45 14             	mov    0x14(%ebp),%eax
+  800758:	8b 10                	mov    (%eax),%edx
+  80075a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80075f:	8d 40 04             	lea    0x4(%eax),%eax
+  800762:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800765:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80076a:	eb 92                	jmp    8006fe <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  80076c:	83 ec 08             	sub    $0x8,%esp
+  80076f:	53                   	push   %ebx
+  800770:	6a 25                	push   $0x25
+  800772:	ff d6                	call   *%esi
+			break;
+  800774:	83 c4 10             	add    $0x10,%esp
+  800777:	eb 9f                	jmp    800718 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800779:	83 ec 08             	sub    $0x8,%esp
+  80077c:	53                   	push   %ebx
+  80077d:	6a 25                	push   $0x25
+  80077f:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800781:	83 c4 10             	add    $0x10,%esp
+  800784:	89 f8                	mov    %edi,%eax
+  800786:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80078a:	74 05                	je     800791 <vprintfmt+0x44f>
+  80078c:	83 e8 01             	sub    $0x1,%eax
+  80078f:	eb f5                	jmp    800786 <vprintfmt+0x444>
+  800791:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800794:	eb 82                	jmp    800718 <vprintfmt+0x3d6>
+
+00800796 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800796:	55                   	push   %ebp
+  800797:	89 e5                	mov    %esp,%ebp
+  800799:	83 ec 18             	sub    $0x18,%esp
+  80079c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80079f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007a2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007a5:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007a9:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007ac:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007b3:	85 c0                	test   %eax,%eax
+  8007b5:	74 26                	je     8007dd <vsnprintf+0x47>
+  8007b7:	85 d2                	test   %edx,%edx
+  8007b9:	7e 22                	jle    8007dd <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007bb:	ff 75 14             	push   0x14(%ebp)
+  8007be:	ff 75 10             	push   0x10(%ebp)
+  8007c1:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007c4:	50                   	push   %eax
+  8007c5:	68 08 03 80 00       	push   $0x800308
+  8007ca:	e8 73 fb ff ff       	call   800342 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007cf:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007d2:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007d5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007d8:	83 c4 10             	add    $0x10,%esp
+}
+  8007db:	c9                   	leave
+  8007dc:	c3                   	ret
+		return -E_INVAL;
+  8007dd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007e2:	eb f7                	jmp    8007db <vsnprintf+0x45>
+
+008007e4 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007e4:	55                   	push   %ebp
+  8007e5:	89 e5                	mov    %esp,%ebp
+  8007e7:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007ea:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007ed:	50                   	push   %eax
+  8007ee:	ff 75 10             	push   0x10(%ebp)
+  8007f1:	ff 75 0c             	push   0xc(%ebp)
+  8007f4:	ff 75 08             	push   0x8(%ebp)
+  8007f7:	e8 9a ff ff ff       	call   800796 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007fc:	c9                   	leave
+  8007fd:	c3                   	ret
+
+008007fe <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007fe:	55                   	push   %ebp
+  8007ff:	89 e5                	mov    %esp,%ebp
+  800801:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800804:	b8 00 00 00 00       	mov    $0x0,%eax
+  800809:	eb 03                	jmp    80080e <strlen+0x10>
+		n++;
+  80080b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80080e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800812:	75 f7                	jne    80080b <strlen+0xd>
+	return n;
+}
+  800814:	5d                   	pop    %ebp
+  800815:	c3                   	ret
+
+00800816 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800816:	55                   	push   %ebp
+  800817:	89 e5                	mov    %esp,%ebp
+  800819:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80081c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80081f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800824:	eb 03                	jmp    800829 <strnlen+0x13>
+		n++;
+  800826:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800829:	39 d0                	cmp    %edx,%eax
+  80082b:	74 08                	je     800835 <strnlen+0x1f>
+  80082d:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800831:	75 f3                	jne    800826 <strnlen+0x10>
+  800833:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800835:	89 d0                	mov    %edx,%eax
+  800837:	5d                   	pop    %ebp
+  800838:	c3                   	ret
+
+00800839 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800839:	55                   	push   %ebp
+  80083a:	89 e5                	mov    %esp,%ebp
+  80083c:	53                   	push   %ebx
+  80083d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800840:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800843:	b8 00 00 00 00       	mov    $0x0,%eax
+  800848:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80084c:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80084f:	83 c0 01             	add    $0x1,%eax
+  800852:	84 d2                	test   %dl,%dl
+  800854:	75 f2                	jne    800848 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800856:	89 c8                	mov    %ecx,%eax
+  800858:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80085b:	c9                   	leave
+  80085c:	c3                   	ret
+
+0080085d <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80085d:	55                   	push   %ebp
+  80085e:	89 e5                	mov    %esp,%ebp
+  800860:	53                   	push   %ebx
+  800861:	83 ec 10             	sub    $0x10,%esp
+  800864:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800867:	53                   	push   %ebx
+  800868:	e8 91 ff ff ff       	call   8007fe <strlen>
+  80086d:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800870:	ff 75 0c             	push   0xc(%ebp)
+  800873:	01 d8                	add    %ebx,%eax
+  800875:	50                   	push   %eax
+  800876:	e8 be ff ff ff       	call   800839 <strcpy>
+	return dst;
+}
+  80087b:	89 d8                	mov    %ebx,%eax
+  80087d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800880:	c9                   	leave
+  800881:	c3                   	ret
+
+00800882 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800882:	55                   	push   %ebp
+  800883:	89 e5                	mov    %esp,%ebp
+  800885:	56                   	push   %esi
+  800886:	53                   	push   %ebx
+  800887:	8b 75 08             	mov    0x8(%ebp),%esi
+  80088a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80088d:	89 f3                	mov    %esi,%ebx
+  80088f:	03 5d 10             	add    0x10(%ebp),%ebx
+  800892:	89 f0                	mov    %esi,%eax
+  800894:	eb 0f                	jmp    8008a5 <strncpy+0x23>
+		*dst++ = *src;
+  800896:	83 c0 01             	add    $0x1,%eax
+  800899:	0f b6 0a             	movzbl (%edx),%ecx
+  80089c:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80089f:	80 f9 01             	cmp    $0x1,%cl
+  8008a2:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008a5:	39 d8                	cmp    %ebx,%eax
+  8008a7:	75 ed                	jne    800896 <strncpy+0x14>
+	}
+	return ret;
+}
+  8008a9:	89 f0                	mov    %esi,%eax
+  8008ab:	5b                   	pop    %ebx
+  8008ac:	5e                   	pop    %esi
+  8008ad:	5d                   	pop    %ebp
+  8008ae:	c3                   	ret
+
+008008af <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008af:	55                   	push   %ebp
+  8008b0:	89 e5                	mov    %esp,%ebp
+  8008b2:	56                   	push   %esi
+  8008b3:	53                   	push   %ebx
+  8008b4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008ba:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008bd:	89 f0                	mov    %esi,%eax
+  8008bf:	85 d2                	test   %edx,%edx
+  8008c1:	74 21                	je     8008e4 <strlcpy+0x35>
+  8008c3:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008c7:	89 f2                	mov    %esi,%edx
+  8008c9:	eb 09                	jmp    8008d4 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008cb:	83 c1 01             	add    $0x1,%ecx
+  8008ce:	83 c2 01             	add    $0x1,%edx
+  8008d1:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008d4:	39 c2                	cmp    %eax,%edx
+  8008d6:	74 09                	je     8008e1 <strlcpy+0x32>
+  8008d8:	0f b6 19             	movzbl (%ecx),%ebx
+  8008db:	84 db                	test   %bl,%bl
+  8008dd:	75 ec                	jne    8008cb <strlcpy+0x1c>
+  8008df:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008e1:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008e4:	29 f0                	sub    %esi,%eax
+}
+  8008e6:	5b                   	pop    %ebx
+  8008e7:	5e                   	pop    %esi
+  8008e8:	5d                   	pop    %ebp
+  8008e9:	c3                   	ret
+
+008008ea <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008ea:	55                   	push   %ebp
+  8008eb:	89 e5                	mov    %esp,%ebp
+  8008ed:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008f3:	eb 06                	jmp    8008fb <strcmp+0x11>
+		p++, q++;
+  8008f5:	83 c1 01             	add    $0x1,%ecx
+  8008f8:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008fb:	0f b6 01             	movzbl (%ecx),%eax
+  8008fe:	84 c0                	test   %al,%al
+  800900:	74 04                	je     800906 <strcmp+0x1c>
+  800902:	3a 02                	cmp    (%edx),%al
+  800904:	74 ef                	je     8008f5 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800906:	0f b6 c0             	movzbl %al,%eax
+  800909:	0f b6 12             	movzbl (%edx),%edx
+  80090c:	29 d0                	sub    %edx,%eax
+}
+  80090e:	5d                   	pop    %ebp
+  80090f:	c3                   	ret
+
+00800910 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800910:	55                   	push   %ebp
+  800911:	89 e5                	mov    %esp,%ebp
+  800913:	53                   	push   %ebx
+  800914:	8b 45 08             	mov    0x8(%ebp),%eax
+  800917:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80091a:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80091d:	eb 09                	jmp    800928 <strncmp+0x18>
+		n--, p++, q++;
+  80091f:	83 ea 01             	sub    $0x1,%edx
+  800922:	83 c0 01             	add    $0x1,%eax
+  800925:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800928:	85 d2                	test   %edx,%edx
+  80092a:	74 18                	je     800944 <strncmp+0x34>
+  80092c:	0f b6 18             	movzbl (%eax),%ebx
+  80092f:	84 db                	test   %bl,%bl
+  800931:	74 04                	je     800937 <strncmp+0x27>
+  800933:	3a 19                	cmp    (%ecx),%bl
+  800935:	74 e8                	je     80091f <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800937:	0f b6 00             	movzbl (%eax),%eax
+  80093a:	0f b6 11             	movzbl (%ecx),%edx
+  80093d:	29 d0                	sub    %edx,%eax
+}
+  80093f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800942:	c9                   	leave
+  800943:	c3                   	ret
+		return 0;
+  800944:	b8 00 00 00 00       	mov    $0x0,%eax
+  800949:	eb f4                	jmp    80093f <strncmp+0x2f>
+
+0080094b <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80094b:	55                   	push   %ebp
+  80094c:	89 e5                	mov    %esp,%ebp
+  80094e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800951:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800955:	eb 03                	jmp    80095a <strchr+0xf>
+  800957:	83 c0 01             	add    $0x1,%eax
+  80095a:	0f b6 10             	movzbl (%eax),%edx
+  80095d:	84 d2                	test   %dl,%dl
+  80095f:	74 06                	je     800967 <strchr+0x1c>
+		if (*s == c)
+  800961:	38 ca                	cmp    %cl,%dl
+  800963:	75 f2                	jne    800957 <strchr+0xc>
+  800965:	eb 05                	jmp    80096c <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800967:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80096c:	5d                   	pop    %ebp
+  80096d:	c3                   	ret
+
+0080096e <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80096e:	55                   	push   %ebp
+  80096f:	89 e5                	mov    %esp,%ebp
+  800971:	8b 45 08             	mov    0x8(%ebp),%eax
+  800974:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800978:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80097b:	38 ca                	cmp    %cl,%dl
+  80097d:	74 09                	je     800988 <strfind+0x1a>
+  80097f:	84 d2                	test   %dl,%dl
+  800981:	74 05                	je     800988 <strfind+0x1a>
+	for (; *s; s++)
+  800983:	83 c0 01             	add    $0x1,%eax
+  800986:	eb f0                	jmp    800978 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800988:	5d                   	pop    %ebp
+  800989:	c3                   	ret
+
+0080098a <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80098a:	55                   	push   %ebp
+  80098b:	89 e5                	mov    %esp,%ebp
+  80098d:	57                   	push   %edi
+  80098e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800991:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800994:	85 c9                	test   %ecx,%ecx
+  800996:	74 20                	je     8009b8 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800998:	89 f8                	mov    %edi,%eax
+  80099a:	09 c8                	or     %ecx,%eax
+  80099c:	a8 03                	test   $0x3,%al
+  80099e:	75 12                	jne    8009b2 <memset+0x28>
+		c &= 0xFF;
+  8009a0:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009a4:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8009aa:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009ad:	fc                   	cld
+  8009ae:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009b0:	eb 06                	jmp    8009b8 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009b5:	fc                   	cld
+  8009b6:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009b8:	89 f8                	mov    %edi,%eax
+  8009ba:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009bd:	c9                   	leave
+  8009be:	c3                   	ret
+
+008009bf <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009bf:	55                   	push   %ebp
+  8009c0:	89 e5                	mov    %esp,%ebp
+  8009c2:	57                   	push   %edi
+  8009c3:	56                   	push   %esi
+  8009c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009ca:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009cd:	39 c6                	cmp    %eax,%esi
+  8009cf:	73 32                	jae    800a03 <memmove+0x44>
+  8009d1:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009d4:	39 d0                	cmp    %edx,%eax
+  8009d6:	73 2b                	jae    800a03 <memmove+0x44>
+		s += n;
+		d += n;
+  8009d8:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009db:	89 d6                	mov    %edx,%esi
+  8009dd:	09 fe                	or     %edi,%esi
+  8009df:	09 ce                	or     %ecx,%esi
+  8009e1:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009e7:	75 0e                	jne    8009f7 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009e9:	83 ef 04             	sub    $0x4,%edi
+  8009ec:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009ef:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009f2:	fd                   	std
+  8009f3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009f5:	eb 09                	jmp    800a00 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009f7:	83 ef 01             	sub    $0x1,%edi
+  8009fa:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009fd:	fd                   	std
+  8009fe:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a00:	fc                   	cld
+  800a01:	eb 1a                	jmp    800a1d <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a03:	89 f2                	mov    %esi,%edx
+  800a05:	09 c2                	or     %eax,%edx
+  800a07:	09 ca                	or     %ecx,%edx
+  800a09:	f6 c2 03             	test   $0x3,%dl
+  800a0c:	75 0a                	jne    800a18 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a0e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a11:	89 c7                	mov    %eax,%edi
+  800a13:	fc                   	cld
+  800a14:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a16:	eb 05                	jmp    800a1d <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a18:	89 c7                	mov    %eax,%edi
+  800a1a:	fc                   	cld
+  800a1b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a1d:	5e                   	pop    %esi
+  800a1e:	5f                   	pop    %edi
+  800a1f:	5d                   	pop    %ebp
+  800a20:	c3                   	ret
+
+00800a21 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a21:	55                   	push   %ebp
+  800a22:	89 e5                	mov    %esp,%ebp
+  800a24:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a27:	ff 75 10             	push   0x10(%ebp)
+  800a2a:	ff 75 0c             	push   0xc(%ebp)
+  800a2d:	ff 75 08             	push   0x8(%ebp)
+  800a30:	e8 8a ff ff ff       	call   8009bf <memmove>
+}
+  800a35:	c9                   	leave
+  800a36:	c3                   	ret
+
+00800a37 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a37:	55                   	push   %ebp
+  800a38:	89 e5                	mov    %esp,%ebp
+  800a3a:	56                   	push   %esi
+  800a3b:	53                   	push   %ebx
+  800a3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a3f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a42:	89 c6                	mov    %eax,%esi
+  800a44:	03 75 10             	add    0x10(%ebp),%esi
+  800a47:	eb 06                	jmp    800a4f <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a49:	83 c0 01             	add    $0x1,%eax
+  800a4c:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a4f:	39 f0                	cmp    %esi,%eax
+  800a51:	74 14                	je     800a67 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a53:	0f b6 08             	movzbl (%eax),%ecx
+  800a56:	0f b6 1a             	movzbl (%edx),%ebx
+  800a59:	38 d9                	cmp    %bl,%cl
+  800a5b:	74 ec                	je     800a49 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a5d:	0f b6 c1             	movzbl %cl,%eax
+  800a60:	0f b6 db             	movzbl %bl,%ebx
+  800a63:	29 d8                	sub    %ebx,%eax
+  800a65:	eb 05                	jmp    800a6c <memcmp+0x35>
+	}
+
+	return 0;
+  800a67:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a6c:	5b                   	pop    %ebx
+  800a6d:	5e                   	pop    %esi
+  800a6e:	5d                   	pop    %ebp
+  800a6f:	c3                   	ret
+
+00800a70 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a70:	55                   	push   %ebp
+  800a71:	89 e5                	mov    %esp,%ebp
+  800a73:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a76:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a79:	89 c2                	mov    %eax,%edx
+  800a7b:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a7e:	eb 03                	jmp    800a83 <memfind+0x13>
+  800a80:	83 c0 01             	add    $0x1,%eax
+  800a83:	39 d0                	cmp    %edx,%eax
+  800a85:	73 04                	jae    800a8b <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a87:	38 08                	cmp    %cl,(%eax)
+  800a89:	75 f5                	jne    800a80 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a8b:	5d                   	pop    %ebp
+  800a8c:	c3                   	ret
+
+00800a8d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a8d:	55                   	push   %ebp
+  800a8e:	89 e5                	mov    %esp,%ebp
+  800a90:	57                   	push   %edi
+  800a91:	56                   	push   %esi
+  800a92:	53                   	push   %ebx
+  800a93:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a96:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a99:	eb 03                	jmp    800a9e <strtol+0x11>
+		s++;
+  800a9b:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a9e:	0f b6 02             	movzbl (%edx),%eax
+  800aa1:	3c 20                	cmp    $0x20,%al
+  800aa3:	74 f6                	je     800a9b <strtol+0xe>
+  800aa5:	3c 09                	cmp    $0x9,%al
+  800aa7:	74 f2                	je     800a9b <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800aa9:	3c 2b                	cmp    $0x2b,%al
+  800aab:	74 2a                	je     800ad7 <strtol+0x4a>
+	int neg = 0;
+  800aad:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800ab2:	3c 2d                	cmp    $0x2d,%al
+  800ab4:	74 2b                	je     800ae1 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ab6:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800abc:	75 0f                	jne    800acd <strtol+0x40>
+  800abe:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ac1:	74 28                	je     800aeb <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ac3:	85 db                	test   %ebx,%ebx
+  800ac5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800aca:	0f 44 d8             	cmove  %eax,%ebx
+  800acd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ad2:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ad5:	eb 46                	jmp    800b1d <strtol+0x90>
+		s++;
+  800ad7:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800ada:	bf 00 00 00 00       	mov    $0x0,%edi
+  800adf:	eb d5                	jmp    800ab6 <strtol+0x29>
+		s++, neg = 1;
+  800ae1:	83 c2 01             	add    $0x1,%edx
+  800ae4:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ae9:	eb cb                	jmp    800ab6 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800aeb:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800aef:	74 0e                	je     800aff <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800af1:	85 db                	test   %ebx,%ebx
+  800af3:	75 d8                	jne    800acd <strtol+0x40>
+		s++, base = 8;
+  800af5:	83 c2 01             	add    $0x1,%edx
+  800af8:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800afd:	eb ce                	jmp    800acd <strtol+0x40>
+		s += 2, base = 16;
+  800aff:	83 c2 02             	add    $0x2,%edx
+  800b02:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b07:	eb c4                	jmp    800acd <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b09:	0f be c0             	movsbl %al,%eax
+  800b0c:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b0f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b12:	7d 3a                	jge    800b4e <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b14:	83 c2 01             	add    $0x1,%edx
+  800b17:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b1b:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b1d:	0f b6 02             	movzbl (%edx),%eax
+  800b20:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b23:	89 f3                	mov    %esi,%ebx
+  800b25:	80 fb 09             	cmp    $0x9,%bl
+  800b28:	76 df                	jbe    800b09 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b2a:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b2d:	89 f3                	mov    %esi,%ebx
+  800b2f:	80 fb 19             	cmp    $0x19,%bl
+  800b32:	77 08                	ja     800b3c <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b34:	0f be c0             	movsbl %al,%eax
+  800b37:	83 e8 57             	sub    $0x57,%eax
+  800b3a:	eb d3                	jmp    800b0f <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b3c:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b3f:	89 f3                	mov    %esi,%ebx
+  800b41:	80 fb 19             	cmp    $0x19,%bl
+  800b44:	77 08                	ja     800b4e <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b46:	0f be c0             	movsbl %al,%eax
+  800b49:	83 e8 37             	sub    $0x37,%eax
+  800b4c:	eb c1                	jmp    800b0f <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b4e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b52:	74 05                	je     800b59 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b54:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b57:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b59:	89 c8                	mov    %ecx,%eax
+  800b5b:	f7 d8                	neg    %eax
+  800b5d:	85 ff                	test   %edi,%edi
+  800b5f:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b62:	89 c8                	mov    %ecx,%eax
+  800b64:	5b                   	pop    %ebx
+  800b65:	5e                   	pop    %esi
+  800b66:	5f                   	pop    %edi
+  800b67:	5d                   	pop    %ebp
+  800b68:	c3                   	ret
+
+00800b69 <atoi>:
+
+int
+atoi(const char *s)
+{
+  800b69:	55                   	push   %ebp
+  800b6a:	89 e5                	mov    %esp,%ebp
+  800b6c:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800b6f:	6a 0a                	push   $0xa
+  800b71:	6a 00                	push   $0x0
+  800b73:	ff 75 08             	push   0x8(%ebp)
+  800b76:	e8 12 ff ff ff       	call   800a8d <strtol>
+}
+  800b7b:	c9                   	leave
+  800b7c:	c3                   	ret
+
+00800b7d <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800b7d:	55                   	push   %ebp
+  800b7e:	89 e5                	mov    %esp,%ebp
+  800b80:	57                   	push   %edi
+  800b81:	56                   	push   %esi
+  800b82:	53                   	push   %ebx
+  800b83:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800b89:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800b8f:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800b95:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800b9b:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800ba2:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800ba5:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800bac:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800baf:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800bb6:	74 76                	je     800c2e <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800bb8:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800bbe:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bc1:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800bc7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800bce:	0f 88 06 01 00 00    	js     800cda <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800bd4:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800bdb:	0f 84 48 01 00 00    	je     800d29 <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800be1:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800be7:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800bed:	be 00 00 00 00       	mov    $0x0,%esi
+  800bf2:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800bf8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800bfb:	55                   	push   %ebp
+  800bfc:	68 05 0c 80 00       	push   $0x800c05
+  800c01:	89 e5                	mov    %esp,%ebp
+  800c03:	0f 34                	sysenter
+  800c05:	83 c4 04             	add    $0x4,%esp
+  800c08:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800c09:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800c0f:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800c15:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800c18:	0f 85 9a 01 00 00    	jne    800db8 <page_vec_call+0x23b>
+  800c1e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c23:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c26:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c29:	e9 29 01 00 00       	jmp    800d57 <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800c2e:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800c34:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c37:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800c39:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800c40:	78 2f                	js     800c71 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800c42:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800c49:	74 72                	je     800cbd <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800c4b:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800c51:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800c57:	b8 10 00 00 00       	mov    $0x10,%eax
+  800c5c:	89 fb                	mov    %edi,%ebx
+  800c5e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c61:	55                   	push   %ebp
+  800c62:	68 6b 0c 80 00       	push   $0x800c6b
+  800c67:	89 e5                	mov    %esp,%ebp
+  800c69:	0f 34                	sysenter
+  800c6b:	83 c4 04             	add    $0x4,%esp
+  800c6e:	5d                   	pop    %ebp
+	return ret;
+  800c6f:	eb 98                	jmp    800c09 <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800c71:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c76:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800c78:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800c7d:	f6 c6 08             	test   $0x8,%dh
+  800c80:	74 15                	je     800c97 <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c82:	89 c2                	mov    %eax,%edx
+  800c84:	c1 ea 08             	shr    $0x8,%edx
+  800c87:	83 e2 0f             	and    $0xf,%edx
+  800c8a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800c8f:	83 fa 06             	cmp    $0x6,%edx
+  800c92:	74 0e                	je     800ca2 <page_vec_call+0x125>
+  800c94:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800c97:	0f b6 c9             	movzbl %cl,%ecx
+  800c9a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800ca0:	eb a0                	jmp    800c42 <page_vec_call+0xc5>
+  800ca2:	89 c2                	mov    %eax,%edx
+  800ca4:	c1 ea 04             	shr    $0x4,%edx
+  800ca7:	83 e2 0f             	and    $0xf,%edx
+  800caa:	83 fa 02             	cmp    $0x2,%edx
+  800cad:	77 e5                	ja     800c94 <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800caf:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800cb2:	83 f8 02             	cmp    $0x2,%eax
+  800cb5:	0f 97 c1             	seta   %cl
+  800cb8:	0f b6 c9             	movzbl %cl,%ecx
+  800cbb:	eb d7                	jmp    800c94 <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800cbd:	b8 10 00 00 00       	mov    $0x10,%eax
+  800cc2:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800cc8:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800cce:	89 fb                	mov    %edi,%ebx
+  800cd0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800cd3:	cd 30                	int    $0x30
+  800cd5:	e9 2f ff ff ff       	jmp    800c09 <page_vec_call+0x8c>
+  800cda:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cdf:	0f a2                	cpuid
+		return 0;
+  800ce1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800ce6:	f6 c6 08             	test   $0x8,%dh
+  800ce9:	74 15                	je     800d00 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ceb:	89 c2                	mov    %eax,%edx
+  800ced:	c1 ea 08             	shr    $0x8,%edx
+  800cf0:	83 e2 0f             	and    $0xf,%edx
+  800cf3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800cf8:	83 fa 06             	cmp    $0x6,%edx
+  800cfb:	74 11                	je     800d0e <page_vec_call+0x191>
+  800cfd:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800d00:	0f b6 c9             	movzbl %cl,%ecx
+  800d03:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800d09:	e9 c6 fe ff ff       	jmp    800bd4 <page_vec_call+0x57>
+  800d0e:	89 c2                	mov    %eax,%edx
+  800d10:	c1 ea 04             	shr    $0x4,%edx
+  800d13:	83 e2 0f             	and    $0xf,%edx
+  800d16:	83 fa 02             	cmp    $0x2,%edx
+  800d19:	77 e2                	ja     800cfd <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800d1b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d1e:	83 f8 02             	cmp    $0x2,%eax
+  800d21:	0f 97 c1             	seta   %cl
+  800d24:	0f b6 c9             	movzbl %cl,%ecx
+  800d27:	eb d4                	jmp    800cfd <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800d29:	be 00 00 00 00       	mov    $0x0,%esi
+  800d2e:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800d34:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800d3a:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800d40:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800d43:	cd 30                	int    $0x30
+  800d45:	e9 bf fe ff ff       	jmp    800c09 <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800d4a:	29 da                	sub    %ebx,%edx
+			vec++;
+  800d4c:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800d4f:	83 e8 01             	sub    $0x1,%eax
+  800d52:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800d57:	85 c0                	test   %eax,%eax
+  800d59:	74 58                	je     800db3 <page_vec_call+0x236>
+  800d5b:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800d5e:	39 da                	cmp    %ebx,%edx
+  800d60:	73 e8                	jae    800d4a <page_vec_call+0x1cd>
+  800d62:	89 75 08             	mov    %esi,0x8(%ebp)
+  800d65:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800d68:	84 c9                	test   %cl,%cl
+  800d6a:	74 06                	je     800d72 <page_vec_call+0x1f5>
+  800d6c:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800d72:	83 ec 04             	sub    $0x4,%esp
+  800d75:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d78:	c1 e0 04             	shl    $0x4,%eax
+  800d7b:	50                   	push   %eax
+  800d7c:	ff 75 08             	push   0x8(%ebp)
+  800d7f:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800d85:	53                   	push   %ebx
+  800d86:	e8 34 fc ff ff       	call   8009bf <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800d8b:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800d91:	89 c2                	mov    %eax,%edx
+  800d93:	c1 e2 0c             	shl    $0xc,%edx
+  800d96:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  800d9c:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  800da2:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  800da8:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  800dab:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  800dae:	e9 f2 fd ff ff       	jmp    800ba5 <page_vec_call+0x28>
+			r = 0;
+  800db3:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  800db8:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800dbc:	74 0b                	je     800dc9 <page_vec_call+0x24c>
+		*done = total;
+  800dbe:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800dc1:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  800dc7:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  800dc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dcc:	5b                   	pop    %ebx
+  800dcd:	5e                   	pop    %esi
+  800dce:	5f                   	pop    %edi
+  800dcf:	5d                   	pop    %ebp
+  800dd0:	c3                   	ret
+
+00800dd1 <sys_cputs>:
+{
+  800dd1:	55                   	push   %ebp
+  800dd2:	89 e5                	mov    %esp,%ebp
+  800dd4:	57                   	push   %edi
+  800dd5:	56                   	push   %esi
+  800dd6:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800dd7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800dde:	78 2d                	js     800e0d <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800de0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800de7:	74 70                	je     800e59 <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800de9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dee:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df4:	89 c3                	mov    %eax,%ebx
+  800df6:	89 c7                	mov    %eax,%edi
+  800df8:	89 c6                	mov    %eax,%esi
+  800dfa:	55                   	push   %ebp
+  800dfb:	68 04 0e 80 00       	push   $0x800e04
+  800e00:	89 e5                	mov    %esp,%ebp
+  800e02:	0f 34                	sysenter
+  800e04:	83 c4 04             	add    $0x4,%esp
+  800e07:	5d                   	pop    %ebp
+}
+  800e08:	5b                   	pop    %ebx
+  800e09:	5e                   	pop    %esi
+  800e0a:	5f                   	pop    %edi
+  800e0b:	5d                   	pop    %ebp
+  800e0c:	c3                   	ret
+  800e0d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e12:	0f a2                	cpuid
+		return 0;
+  800e14:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800e19:	f6 c6 08             	test   $0x8,%dh
+  800e1c:	74 15                	je     800e33 <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e1e:	89 c2                	mov    %eax,%edx
+  800e20:	c1 ea 08             	shr    $0x8,%edx
+  800e23:	83 e2 0f             	and    $0xf,%edx
+  800e26:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e2b:	83 fa 06             	cmp    $0x6,%edx
+  800e2e:	74 0e                	je     800e3e <sys_cputs+0x6d>
+  800e30:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e33:	0f b6 c9             	movzbl %cl,%ecx
+  800e36:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800e3c:	eb a2                	jmp    800de0 <sys_cputs+0xf>
+  800e3e:	89 c2                	mov    %eax,%edx
+  800e40:	c1 ea 04             	shr    $0x4,%edx
+  800e43:	83 e2 0f             	and    $0xf,%edx
+  800e46:	83 fa 02             	cmp    $0x2,%edx
+  800e49:	77 e5                	ja     800e30 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800e4b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e4e:	83 f8 02             	cmp    $0x2,%eax
+  800e51:	0f 97 c1             	seta   %cl
+  800e54:	0f b6 c9             	movzbl %cl,%ecx
+  800e57:	eb d7                	jmp    800e30 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800e59:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e5e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e61:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e64:	89 c3                	mov    %eax,%ebx
+  800e66:	89 c7                	mov    %eax,%edi
+  800e68:	89 c6                	mov    %eax,%esi
+  800e6a:	cd 30                	int    $0x30
+}
+  800e6c:	eb 9a                	jmp    800e08 <sys_cputs+0x37>
+
+00800e6e <sys_cgetc>:
+{
+  800e6e:	55                   	push   %ebp
+  800e6f:	89 e5                	mov    %esp,%ebp
+  800e71:	57                   	push   %edi
+  800e72:	56                   	push   %esi
+  800e73:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800e74:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e7b:	78 2e                	js     800eab <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  800e7d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e84:	74 71                	je     800ef7 <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  800e86:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e8b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e90:	89 d1                	mov    %edx,%ecx
+  800e92:	89 d3                	mov    %edx,%ebx
+  800e94:	89 d7                	mov    %edx,%edi
+  800e96:	89 d6                	mov    %edx,%esi
+  800e98:	55                   	push   %ebp
+  800e99:	68 a2 0e 80 00       	push   $0x800ea2
+  800e9e:	89 e5                	mov    %esp,%ebp
+  800ea0:	0f 34                	sysenter
+  800ea2:	83 c4 04             	add    $0x4,%esp
+  800ea5:	5d                   	pop    %ebp
+}
+  800ea6:	5b                   	pop    %ebx
+  800ea7:	5e                   	pop    %esi
+  800ea8:	5f                   	pop    %edi
+  800ea9:	5d                   	pop    %ebp
+  800eaa:	c3                   	ret
+  800eab:	b8 01 00 00 00       	mov    $0x1,%eax
+  800eb0:	0f a2                	cpuid
+		return 0;
+  800eb2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800eb7:	f6 c6 08             	test   $0x8,%dh
+  800eba:	74 15                	je     800ed1 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ebc:	89 c2                	mov    %eax,%edx
+  800ebe:	c1 ea 08             	shr    $0x8,%edx
+  800ec1:	83 e2 0f             	and    $0xf,%edx
+  800ec4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ec9:	83 fa 06             	cmp    $0x6,%edx
+  800ecc:	74 0e                	je     800edc <sys_cgetc+0x6e>
+  800ece:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800ed1:	0f b6 c9             	movzbl %cl,%ecx
+  800ed4:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800eda:	eb a1                	jmp    800e7d <sys_cgetc+0xf>
+  800edc:	89 c2                	mov    %eax,%edx
+  800ede:	c1 ea 04             	shr    $0x4,%edx
+  800ee1:	83 e2 0f             	and    $0xf,%edx
+  800ee4:	83 fa 02             	cmp    $0x2,%edx
+  800ee7:	77 e5                	ja     800ece <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  800ee9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800eec:	83 f8 02             	cmp    $0x2,%eax
+  800eef:	0f 97 c1             	seta   %cl
+  800ef2:	0f b6 c9             	movzbl %cl,%ecx
+  800ef5:	eb d7                	jmp    800ece <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  800ef7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800efc:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f01:	89 d1                	mov    %edx,%ecx
+  800f03:	89 d3                	mov    %edx,%ebx
+  800f05:	89 d7                	mov    %edx,%edi
+  800f07:	89 d6                	mov    %edx,%esi
+  800f09:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800f0b:	eb 99                	jmp    800ea6 <sys_cgetc+0x38>
+
+00800f0d <sys_env_destroy>:
+{
+  800f0d:	55                   	push   %ebp
+  800f0e:	89 e5                	mov    %esp,%ebp
+  800f10:	57                   	push   %edi
+  800f11:	56                   	push   %esi
+  800f12:	53                   	push   %ebx
+  800f13:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800f16:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f1d:	78 36                	js     800f55 <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  800f1f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f26:	74 79                	je     800fa1 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  800f28:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f30:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f35:	89 cb                	mov    %ecx,%ebx
+  800f37:	89 cf                	mov    %ecx,%edi
+  800f39:	89 ce                	mov    %ecx,%esi
+  800f3b:	55                   	push   %ebp
+  800f3c:	68 45 0f 80 00       	push   $0x800f45
+  800f41:	89 e5                	mov    %esp,%ebp
+  800f43:	0f 34                	sysenter
+  800f45:	83 c4 04             	add    $0x4,%esp
+  800f48:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800f49:	85 c0                	test   %eax,%eax
+  800f4b:	7f 6b                	jg     800fb8 <sys_env_destroy+0xab>
+}
+  800f4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f50:	5b                   	pop    %ebx
+  800f51:	5e                   	pop    %esi
+  800f52:	5f                   	pop    %edi
+  800f53:	5d                   	pop    %ebp
+  800f54:	c3                   	ret
+  800f55:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f5a:	0f a2                	cpuid
+		return 0;
+  800f5c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f61:	f6 c6 08             	test   $0x8,%dh
+  800f64:	74 15                	je     800f7b <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f66:	89 c2                	mov    %eax,%edx
+  800f68:	c1 ea 08             	shr    $0x8,%edx
+  800f6b:	83 e2 0f             	and    $0xf,%edx
+  800f6e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f73:	83 fa 06             	cmp    $0x6,%edx
+  800f76:	74 0e                	je     800f86 <sys_env_destroy+0x79>
+  800f78:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f7b:	0f b6 c9             	movzbl %cl,%ecx
+  800f7e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800f84:	eb 99                	jmp    800f1f <sys_env_destroy+0x12>
+  800f86:	89 c2                	mov    %eax,%edx
+  800f88:	c1 ea 04             	shr    $0x4,%edx
+  800f8b:	83 e2 0f             	and    $0xf,%edx
+  800f8e:	83 fa 02             	cmp    $0x2,%edx
+  800f91:	77 e5                	ja     800f78 <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  800f93:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f96:	83 f8 02             	cmp    $0x2,%eax
+  800f99:	0f 97 c1             	seta   %cl
+  800f9c:	0f b6 c9             	movzbl %cl,%ecx
+  800f9f:	eb d7                	jmp    800f78 <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  800fa1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fa6:	b8 03 00 00 00       	mov    $0x3,%eax
+  800fab:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fae:	89 cb                	mov    %ecx,%ebx
+  800fb0:	89 cf                	mov    %ecx,%edi
+  800fb2:	89 ce                	mov    %ecx,%esi
+  800fb4:	cd 30                	int    $0x30
+  800fb6:	eb 91                	jmp    800f49 <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb8:	83 ec 0c             	sub    $0xc,%esp
+  800fbb:	50                   	push   %eax
+  800fbc:	6a 03                	push   $0x3
+  800fbe:	68 b9 2c 80 00       	push   $0x802cb9
+  800fc3:	6a 4a                	push   $0x4a
+  800fc5:	68 d6 2c 80 00       	push   $0x802cd6
+  800fca:	e8 68 f1 ff ff       	call   800137 <_panic>
+
+00800fcf <sys_getenvid>:
+{
+  800fcf:	55                   	push   %ebp
+  800fd0:	89 e5                	mov    %esp,%ebp
+  800fd2:	57                   	push   %edi
+  800fd3:	56                   	push   %esi
+  800fd4:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800fd5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fdc:	78 2e                	js     80100c <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  800fde:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fe5:	74 71                	je     801058 <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  800fe7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fec:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ff1:	89 d1                	mov    %edx,%ecx
+  800ff3:	89 d3                	mov    %edx,%ebx
+  800ff5:	89 d7                	mov    %edx,%edi
+  800ff7:	89 d6                	mov    %edx,%esi
+  800ff9:	55                   	push   %ebp
+  800ffa:	68 03 10 80 00       	push   $0x801003
+  800fff:	89 e5                	mov    %esp,%ebp
+  801001:	0f 34                	sysenter
+  801003:	83 c4 04             	add    $0x4,%esp
+  801006:	5d                   	pop    %ebp
+}
+  801007:	5b                   	pop    %ebx
+  801008:	5e                   	pop    %esi
+  801009:	5f                   	pop    %edi
+  80100a:	5d                   	pop    %ebp
+  80100b:	c3                   	ret
+  80100c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801011:	0f a2                	cpuid
+		return 0;
+  801013:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801018:	f6 c6 08             	test   $0x8,%dh
+  80101b:	74 15                	je     801032 <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80101d:	89 c2                	mov    %eax,%edx
+  80101f:	c1 ea 08             	shr    $0x8,%edx
+  801022:	83 e2 0f             	and    $0xf,%edx
+  801025:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80102a:	83 fa 06             	cmp    $0x6,%edx
+  80102d:	74 0e                	je     80103d <sys_getenvid+0x6e>
+  80102f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801032:	0f b6 c9             	movzbl %cl,%ecx
+  801035:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80103b:	eb a1                	jmp    800fde <sys_getenvid+0xf>
+  80103d:	89 c2                	mov    %eax,%edx
+  80103f:	c1 ea 04             	shr    $0x4,%edx
+  801042:	83 e2 0f             	and    $0xf,%edx
+  801045:	83 fa 02             	cmp    $0x2,%edx
+  801048:	77 e5                	ja     80102f <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  80104a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80104d:	83 f8 02             	cmp    $0x2,%eax
+  801050:	0f 97 c1             	seta   %cl
+  801053:	0f b6 c9             	movzbl %cl,%ecx
+  801056:	eb d7                	jmp    80102f <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  801058:	ba 00 00 00 00       	mov    $0x0,%edx
+  80105d:	b8 02 00 00 00       	mov    $0x2,%eax
+  801062:	89 d1                	mov    %edx,%ecx
+  801064:	89 d3                	mov    %edx,%ebx
+  801066:	89 d7                	mov    %edx,%edi
+  801068:	89 d6                	mov    %edx,%esi
+  80106a:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80106c:	eb 99                	jmp    801007 <sys_getenvid+0x38>
+
+0080106e <sys_page_alloc>:
+{
+  80106e:	55                   	push   %ebp
+  80106f:	89 e5                	mov    %esp,%ebp
+  801071:	57                   	push   %edi
+  801072:	56                   	push   %esi
+  801073:	53                   	push   %ebx
+  801074:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801077:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80107e:	78 38                	js     8010b8 <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  801080:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801087:	74 7b                	je     801104 <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  801089:	be 00 00 00 00       	mov    $0x0,%esi
+  80108e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801091:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801094:	b8 04 00 00 00       	mov    $0x4,%eax
+  801099:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80109c:	89 f7                	mov    %esi,%edi
+  80109e:	55                   	push   %ebp
+  80109f:	68 a8 10 80 00       	push   $0x8010a8
+  8010a4:	89 e5                	mov    %esp,%ebp
+  8010a6:	0f 34                	sysenter
+  8010a8:	83 c4 04             	add    $0x4,%esp
+  8010ab:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8010ac:	85 c0                	test   %eax,%eax
+  8010ae:	7f 6d                	jg     80111d <sys_page_alloc+0xaf>
+}
+  8010b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010b3:	5b                   	pop    %ebx
+  8010b4:	5e                   	pop    %esi
+  8010b5:	5f                   	pop    %edi
+  8010b6:	5d                   	pop    %ebp
+  8010b7:	c3                   	ret
+  8010b8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010bd:	0f a2                	cpuid
+		return 0;
+  8010bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8010c4:	f6 c6 08             	test   $0x8,%dh
+  8010c7:	74 15                	je     8010de <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010c9:	89 c2                	mov    %eax,%edx
+  8010cb:	c1 ea 08             	shr    $0x8,%edx
+  8010ce:	83 e2 0f             	and    $0xf,%edx
+  8010d1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8010d6:	83 fa 06             	cmp    $0x6,%edx
+  8010d9:	74 0e                	je     8010e9 <sys_page_alloc+0x7b>
+  8010db:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8010de:	0f b6 c9             	movzbl %cl,%ecx
+  8010e1:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8010e7:	eb 97                	jmp    801080 <sys_page_alloc+0x12>
+  8010e9:	89 c2                	mov    %eax,%edx
+  8010eb:	c1 ea 04             	shr    $0x4,%edx
+  8010ee:	83 e2 0f             	and    $0xf,%edx
+  8010f1:	83 fa 02             	cmp    $0x2,%edx
+  8010f4:	77 e5                	ja     8010db <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  8010f6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010f9:	83 f8 02             	cmp    $0x2,%eax
+  8010fc:	0f 97 c1             	seta   %cl
+  8010ff:	0f b6 c9             	movzbl %cl,%ecx
+  801102:	eb d7                	jmp    8010db <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  801104:	be 00 00 00 00       	mov    $0x0,%esi
+  801109:	b8 04 00 00 00       	mov    $0x4,%eax
+  80110e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801111:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801114:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801117:	89 f7                	mov    %esi,%edi
+  801119:	cd 30                	int    $0x30
+  80111b:	eb 8f                	jmp    8010ac <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80111d:	83 ec 0c             	sub    $0xc,%esp
+  801120:	50                   	push   %eax
+  801121:	6a 04                	push   $0x4
+  801123:	68 b9 2c 80 00       	push   $0x802cb9
+  801128:	6a 4a                	push   $0x4a
+  80112a:	68 d6 2c 80 00       	push   $0x802cd6
+  80112f:	e8 03 f0 ff ff       	call   800137 <_panic>
+
+00801134 <sys_page_map>:
+{
+  801134:	55                   	push   %ebp
+  801135:	89 e5                	mov    %esp,%ebp
+  801137:	57                   	push   %edi
+  801138:	56                   	push   %esi
+  801139:	53                   	push   %ebx
+  80113a:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80113d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801144:	78 37                	js     80117d <sys_page_map+0x49>
+	if (syscall_sysenter)
+  801146:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80114d:	74 7a                	je     8011c9 <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  80114f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801152:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801155:	b8 05 00 00 00       	mov    $0x5,%eax
+  80115a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80115d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801160:	8b 75 18             	mov    0x18(%ebp),%esi
+  801163:	55                   	push   %ebp
+  801164:	68 6d 11 80 00       	push   $0x80116d
+  801169:	89 e5                	mov    %esp,%ebp
+  80116b:	0f 34                	sysenter
+  80116d:	83 c4 04             	add    $0x4,%esp
+  801170:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801171:	85 c0                	test   %eax,%eax
+  801173:	7f 6c                	jg     8011e1 <sys_page_map+0xad>
+}
+  801175:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801178:	5b                   	pop    %ebx
+  801179:	5e                   	pop    %esi
+  80117a:	5f                   	pop    %edi
+  80117b:	5d                   	pop    %ebp
+  80117c:	c3                   	ret
+  80117d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801182:	0f a2                	cpuid
+		return 0;
+  801184:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801189:	f6 c6 08             	test   $0x8,%dh
+  80118c:	74 15                	je     8011a3 <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80118e:	89 c2                	mov    %eax,%edx
+  801190:	c1 ea 08             	shr    $0x8,%edx
+  801193:	83 e2 0f             	and    $0xf,%edx
+  801196:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80119b:	83 fa 06             	cmp    $0x6,%edx
+  80119e:	74 0e                	je     8011ae <sys_page_map+0x7a>
+  8011a0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8011a3:	0f b6 c9             	movzbl %cl,%ecx
+  8011a6:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8011ac:	eb 98                	jmp    801146 <sys_page_map+0x12>
+  8011ae:	89 c2                	mov    %eax,%edx
+  8011b0:	c1 ea 04             	shr    $0x4,%edx
+  8011b3:	83 e2 0f             	and    $0xf,%edx
+  8011b6:	83 fa 02             	cmp    $0x2,%edx
+  8011b9:	77 e5                	ja     8011a0 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  8011bb:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011be:	83 f8 02             	cmp    $0x2,%eax
+  8011c1:	0f 97 c1             	seta   %cl
+  8011c4:	0f b6 c9             	movzbl %cl,%ecx
+  8011c7:	eb d7                	jmp    8011a0 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  8011c9:	b8 05 00 00 00       	mov    $0x5,%eax
+  8011ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011d7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011da:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011dd:	cd 30                	int    $0x30
+  8011df:	eb 90                	jmp    801171 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011e1:	83 ec 0c             	sub    $0xc,%esp
+  8011e4:	50                   	push   %eax
+  8011e5:	6a 05                	push   $0x5
+  8011e7:	68 b9 2c 80 00       	push   $0x802cb9
+  8011ec:	6a 4a                	push   $0x4a
+  8011ee:	68 d6 2c 80 00       	push   $0x802cd6
+  8011f3:	e8 3f ef ff ff       	call   800137 <_panic>
+
+008011f8 <sys_page_unmap>:
+{
+  8011f8:	55                   	push   %ebp
+  8011f9:	89 e5                	mov    %esp,%ebp
+  8011fb:	57                   	push   %edi
+  8011fc:	56                   	push   %esi
+  8011fd:	53                   	push   %ebx
+  8011fe:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801201:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801208:	78 37                	js     801241 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  80120a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801211:	74 7a                	je     80128d <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  801213:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801218:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80121e:	b8 06 00 00 00       	mov    $0x6,%eax
+  801223:	89 df                	mov    %ebx,%edi
+  801225:	89 de                	mov    %ebx,%esi
+  801227:	55                   	push   %ebp
+  801228:	68 31 12 80 00       	push   $0x801231
+  80122d:	89 e5                	mov    %esp,%ebp
+  80122f:	0f 34                	sysenter
+  801231:	83 c4 04             	add    $0x4,%esp
+  801234:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801235:	85 c0                	test   %eax,%eax
+  801237:	7f 6c                	jg     8012a5 <sys_page_unmap+0xad>
+}
+  801239:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80123c:	5b                   	pop    %ebx
+  80123d:	5e                   	pop    %esi
+  80123e:	5f                   	pop    %edi
+  80123f:	5d                   	pop    %ebp
+  801240:	c3                   	ret
+  801241:	b8 01 00 00 00       	mov    $0x1,%eax
+  801246:	0f a2                	cpuid
+		return 0;
+  801248:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80124d:	f6 c6 08             	test   $0x8,%dh
+  801250:	74 15                	je     801267 <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801252:	89 c2                	mov    %eax,%edx
+  801254:	c1 ea 08             	shr    $0x8,%edx
+  801257:	83 e2 0f             	and    $0xf,%edx
+  80125a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80125f:	83 fa 06             	cmp    $0x6,%edx
+  801262:	74 0e                	je     801272 <sys_page_unmap+0x7a>
+  801264:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801267:	0f b6 c9             	movzbl %cl,%ecx
+  80126a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801270:	eb 98                	jmp    80120a <sys_page_unmap+0x12>
+  801272:	89 c2                	mov    %eax,%edx
+  801274:	c1 ea 04             	shr    $0x4,%edx
+  801277:	83 e2 0f             	and    $0xf,%edx
+  80127a:	83 fa 02             	cmp    $0x2,%edx
+  80127d:	77 e5                	ja     801264 <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  80127f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801282:	83 f8 02             	cmp    $0x2,%eax
+  801285:	0f 97 c1             	seta   %cl
+  801288:	0f b6 c9             	movzbl %cl,%ecx
+  80128b:	eb d7                	jmp    801264 <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  80128d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801292:	b8 06 00 00 00       	mov    $0x6,%eax
+  801297:	8b 55 08             	mov    0x8(%ebp),%edx
+  80129a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80129d:	89 df                	mov    %ebx,%edi
+  80129f:	89 de                	mov    %ebx,%esi
+  8012a1:	cd 30                	int    $0x30
+  8012a3:	eb 90                	jmp    801235 <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012a5:	83 ec 0c             	sub    $0xc,%esp
+  8012a8:	50                   	push   %eax
+  8012a9:	6a 06                	push   $0x6
+  8012ab:	68 b9 2c 80 00       	push   $0x802cb9
+  8012b0:	6a 4a                	push   $0x4a
+  8012b2:	68 d6 2c 80 00       	push   $0x802cd6
+  8012b7:	e8 7b ee ff ff       	call   800137 <_panic>
+
+008012bc <sys_page_copy>:
+{
+  8012bc:	55                   	push   %ebp
+  8012bd:	89 e5                	mov    %esp,%ebp
+  8012bf:	57                   	push   %edi
+  8012c0:	56                   	push   %esi
+  8012c1:	53                   	push   %ebx
+  8012c2:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8012c5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8012cc:	78 37                	js     801305 <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  8012ce:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8012d5:	74 7a                	je     801351 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  8012d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012dd:	b8 29 00 00 00       	mov    $0x29,%eax
+  8012e2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012e5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012e8:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012eb:	55                   	push   %ebp
+  8012ec:	68 f5 12 80 00       	push   $0x8012f5
+  8012f1:	89 e5                	mov    %esp,%ebp
+  8012f3:	0f 34                	sysenter
+  8012f5:	83 c4 04             	add    $0x4,%esp
+  8012f8:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8012f9:	85 c0                	test   %eax,%eax
+  8012fb:	7f 6c                	jg     801369 <sys_page_copy+0xad>
+}
+  8012fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801300:	5b                   	pop    %ebx
+  801301:	5e                   	pop    %esi
+  801302:	5f                   	pop    %edi
+  801303:	5d                   	pop    %ebp
+  801304:	c3                   	ret
+  801305:	b8 01 00 00 00       	mov    $0x1,%eax
+  80130a:	0f a2                	cpuid
+		return 0;
+  80130c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801311:	f6 c6 08             	test   $0x8,%dh
+  801314:	74 15                	je     80132b <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801316:	89 c2                	mov    %eax,%edx
+  801318:	c1 ea 08             	shr    $0x8,%edx
+  80131b:	83 e2 0f             	and    $0xf,%edx
+  80131e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801323:	83 fa 06             	cmp    $0x6,%edx
+  801326:	74 0e                	je     801336 <sys_page_copy+0x7a>
+  801328:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80132b:	0f b6 c9             	movzbl %cl,%ecx
+  80132e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801334:	eb 98                	jmp    8012ce <sys_page_copy+0x12>
+  801336:	89 c2                	mov    %eax,%edx
+  801338:	c1 ea 04             	shr    $0x4,%edx
+  80133b:	83 e2 0f             	and    $0xf,%edx
+  80133e:	83 fa 02             	cmp    $0x2,%edx
+  801341:	77 e5                	ja     801328 <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  801343:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801346:	83 f8 02             	cmp    $0x2,%eax
+  801349:	0f 97 c1             	seta   %cl
+  80134c:	0f b6 c9             	movzbl %cl,%ecx
+  80134f:	eb d7                	jmp    801328 <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  801351:	b8 29 00 00 00       	mov    $0x29,%eax
+  801356:	8b 55 08             	mov    0x8(%ebp),%edx
+  801359:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80135c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80135f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801362:	8b 75 18             	mov    0x18(%ebp),%esi
+  801365:	cd 30                	int    $0x30
+  801367:	eb 90                	jmp    8012f9 <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801369:	83 ec 0c             	sub    $0xc,%esp
+  80136c:	50                   	push   %eax
+  80136d:	6a 29                	push   $0x29
+  80136f:	68 b9 2c 80 00       	push   $0x802cb9
+  801374:	6a 4a                	push   $0x4a
+  801376:	68 d6 2c 80 00       	push   $0x802cd6
+  80137b:	e8 b7 ed ff ff       	call   800137 <_panic>
+
+00801380 <sys_yield>:
+{
+  801380:	55                   	push   %ebp
+  801381:	89 e5                	mov    %esp,%ebp
+  801383:	57                   	push   %edi
+  801384:	56                   	push   %esi
+  801385:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801386:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80138d:	78 2e                	js     8013bd <sys_yield+0x3d>
+	if (syscall_sysenter)
+  80138f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801396:	74 71                	je     801409 <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  801398:	ba 00 00 00 00       	mov    $0x0,%edx
+  80139d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8013a2:	89 d1                	mov    %edx,%ecx
+  8013a4:	89 d3                	mov    %edx,%ebx
+  8013a6:	89 d7                	mov    %edx,%edi
+  8013a8:	89 d6                	mov    %edx,%esi
+  8013aa:	55                   	push   %ebp
+  8013ab:	68 b4 13 80 00       	push   $0x8013b4
+  8013b0:	89 e5                	mov    %esp,%ebp
+  8013b2:	0f 34                	sysenter
+  8013b4:	83 c4 04             	add    $0x4,%esp
+  8013b7:	5d                   	pop    %ebp
+}
+  8013b8:	5b                   	pop    %ebx
+  8013b9:	5e                   	pop    %esi
+  8013ba:	5f                   	pop    %edi
+  8013bb:	5d                   	pop    %ebp
+  8013bc:	c3                   	ret
+  8013bd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013c2:	0f a2                	cpuid
+		return 0;
+  8013c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8013c9:	f6 c6 08             	test   $0x8,%dh
+  8013cc:	74 15                	je     8013e3 <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013ce:	89 c2                	mov    %eax,%edx
+  8013d0:	c1 ea 08             	shr    $0x8,%edx
+  8013d3:	83 e2 0f             	and    $0xf,%edx
+  8013d6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8013db:	83 fa 06             	cmp    $0x6,%edx
+  8013de:	74 0e                	je     8013ee <sys_yield+0x6e>
+  8013e0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8013e3:	0f b6 c9             	movzbl %cl,%ecx
+  8013e6:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8013ec:	eb a1                	jmp    80138f <sys_yield+0xf>
+  8013ee:	89 c2                	mov    %eax,%edx
+  8013f0:	c1 ea 04             	shr    $0x4,%edx
+  8013f3:	83 e2 0f             	and    $0xf,%edx
+  8013f6:	83 fa 02             	cmp    $0x2,%edx
+  8013f9:	77 e5                	ja     8013e0 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  8013fb:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013fe:	83 f8 02             	cmp    $0x2,%eax
+  801401:	0f 97 c1             	seta   %cl
+  801404:	0f b6 c9             	movzbl %cl,%ecx
+  801407:	eb d7                	jmp    8013e0 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  801409:	ba 00 00 00 00       	mov    $0x0,%edx
+  80140e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801413:	89 d1                	mov    %edx,%ecx
+  801415:	89 d3                	mov    %edx,%ebx
+  801417:	89 d7                	mov    %edx,%edi
+  801419:	89 d6                	mov    %edx,%esi
+  80141b:	cd 30                	int    $0x30
+}
+  80141d:	eb 99                	jmp    8013b8 <sys_yield+0x38>
+
+0080141f <sys_env_set_status>:
+{
+  80141f:	55                   	push   %ebp
+  801420:	89 e5                	mov    %esp,%ebp
+  801422:	57                   	push   %edi
+  801423:	56                   	push   %esi
+  801424:	53                   	push   %ebx
+  801425:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801428:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80142f:	78 37                	js     801468 <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  801431:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801438:	74 7a                	je     8014b4 <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  80143a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80143f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801442:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801445:	b8 08 00 00 00       	mov    $0x8,%eax
+  80144a:	89 df                	mov    %ebx,%edi
+  80144c:	89 de                	mov    %ebx,%esi
+  80144e:	55                   	push   %ebp
+  80144f:	68 58 14 80 00       	push   $0x801458
+  801454:	89 e5                	mov    %esp,%ebp
+  801456:	0f 34                	sysenter
+  801458:	83 c4 04             	add    $0x4,%esp
+  80145b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80145c:	85 c0                	test   %eax,%eax
+  80145e:	7f 6c                	jg     8014cc <sys_env_set_status+0xad>
+}
+  801460:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801463:	5b                   	pop    %ebx
+  801464:	5e                   	pop    %esi
+  801465:	5f                   	pop    %edi
+  801466:	5d                   	pop    %ebp
+  801467:	c3                   	ret
+  801468:	b8 01 00 00 00       	mov    $0x1,%eax
+  80146d:	0f a2                	cpuid
+		return 0;
+  80146f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801474:	f6 c6 08             	test   $0x8,%dh
+  801477:	74 15                	je     80148e <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801479:	89 c2                	mov    %eax,%edx
+  80147b:	c1 ea 08             	shr    $0x8,%edx
+  80147e:	83 e2 0f             	and    $0xf,%edx
+  801481:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801486:	83 fa 06             	cmp    $0x6,%edx
+  801489:	74 0e                	je     801499 <sys_env_set_status+0x7a>
+  80148b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80148e:	0f b6 c9             	movzbl %cl,%ecx
+  801491:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801497:	eb 98                	jmp    801431 <sys_env_set_status+0x12>
+  801499:	89 c2                	mov    %eax,%edx
+  80149b:	c1 ea 04             	shr    $0x4,%edx
+  80149e:	83 e2 0f             	and    $0xf,%edx
+  8014a1:	83 fa 02             	cmp    $0x2,%edx
+  8014a4:	77 e5                	ja     80148b <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  8014a6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014a9:	83 f8 02             	cmp    $0x2,%eax
+  8014ac:	0f 97 c1             	seta   %cl
+  8014af:	0f b6 c9             	movzbl %cl,%ecx
+  8014b2:	eb d7                	jmp    80148b <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  8014b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014b9:	b8 08 00 00 00       	mov    $0x8,%eax
+  8014be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c4:	89 df                	mov    %ebx,%edi
+  8014c6:	89 de                	mov    %ebx,%esi
+  8014c8:	cd 30                	int    $0x30
+  8014ca:	eb 90                	jmp    80145c <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014cc:	83 ec 0c             	sub    $0xc,%esp
+  8014cf:	50                   	push   %eax
+  8014d0:	6a 08                	push   $0x8
+  8014d2:	68 b9 2c 80 00       	push   $0x802cb9
+  8014d7:	6a 4a                	push   $0x4a
+  8014d9:	68 d6 2c 80 00       	push   $0x802cd6
+  8014de:	e8 54 ec ff ff       	call   800137 <_panic>
+
+008014e3 <sys_sysinfo>:
+{
+  8014e3:	55                   	push   %ebp
+  8014e4:	89 e5                	mov    %esp,%ebp
+  8014e6:	57                   	push   %edi
+  8014e7:	56                   	push   %esi
+  8014e8:	53                   	push   %ebx
+  8014e9:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8014ec:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8014f3:	78 36                	js     80152b <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  8014f5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8014fc:	74 79                	je     801577 <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  8014fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801501:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801506:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80150b:	89 cb                	mov    %ecx,%ebx
+  80150d:	89 cf                	mov    %ecx,%edi
+  80150f:	89 ce                	mov    %ecx,%esi
+  801511:	55                   	push   %ebp
+  801512:	68 1b 15 80 00       	push   $0x80151b
+  801517:	89 e5                	mov    %esp,%ebp
+  801519:	0f 34                	sysenter
+  80151b:	83 c4 04             	add    $0x4,%esp
+  80151e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80151f:	85 c0                	test   %eax,%eax
+  801521:	7f 6b                	jg     80158e <sys_sysinfo+0xab>
+}
+  801523:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801526:	5b                   	pop    %ebx
+  801527:	5e                   	pop    %esi
+  801528:	5f                   	pop    %edi
+  801529:	5d                   	pop    %ebp
+  80152a:	c3                   	ret
+  80152b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801530:	0f a2                	cpuid
+		return 0;
+  801532:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801537:	f6 c6 08             	test   $0x8,%dh
+  80153a:	74 15                	je     801551 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80153c:	89 c2                	mov    %eax,%edx
+  80153e:	c1 ea 08             	shr    $0x8,%edx
+  801541:	83 e2 0f             	and    $0xf,%edx
+  801544:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801549:	83 fa 06             	cmp    $0x6,%edx
+  80154c:	74 0e                	je     80155c <sys_sysinfo+0x79>
+  80154e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801551:	0f b6 c9             	movzbl %cl,%ecx
+  801554:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80155a:	eb 99                	jmp    8014f5 <sys_sysinfo+0x12>
+  80155c:	89 c2                	mov    %eax,%edx
+  80155e:	c1 ea 04             	shr    $0x4,%edx
+  801561:	83 e2 0f             	and    $0xf,%edx
+  801564:	83 fa 02             	cmp    $0x2,%edx
+  801567:	77 e5                	ja     80154e <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  801569:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80156c:	83 f8 02             	cmp    $0x2,%eax
+  80156f:	0f 97 c1             	seta   %cl
+  801572:	0f b6 c9             	movzbl %cl,%ecx
+  801575:	eb d7                	jmp    80154e <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  801577:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80157c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801581:	8b 55 08             	mov    0x8(%ebp),%edx
+  801584:	89 cb                	mov    %ecx,%ebx
+  801586:	89 cf                	mov    %ecx,%edi
+  801588:	89 ce                	mov    %ecx,%esi
+  80158a:	cd 30                	int    $0x30
+  80158c:	eb 91                	jmp    80151f <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80158e:	83 ec 0c             	sub    $0xc,%esp
+  801591:	50                   	push   %eax
+  801592:	6a 0b                	push   $0xb
+  801594:	68 b9 2c 80 00       	push   $0x802cb9
+  801599:	6a 4a                	push   $0x4a
+  80159b:	68 d6 2c 80 00       	push   $0x802cd6
+  8015a0:	e8 92 eb ff ff       	call   800137 <_panic>
+
+008015a5 <sys_env_set_trapframe>:
+{
+  8015a5:	55                   	push   %ebp
+  8015a6:	89 e5                	mov    %esp,%ebp
+  8015a8:	57                   	push   %edi
+  8015a9:	56                   	push   %esi
+  8015aa:	53                   	push   %ebx
+  8015ab:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8015ae:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8015b5:	78 37                	js     8015ee <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  8015b7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8015be:	74 7a                	je     80163a <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  8015c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015cb:	b8 13 00 00 00       	mov    $0x13,%eax
+  8015d0:	89 df                	mov    %ebx,%edi
+  8015d2:	89 de                	mov    %ebx,%esi
+  8015d4:	55                   	push   %ebp
+  8015d5:	68 de 15 80 00       	push   $0x8015de
+  8015da:	89 e5                	mov    %esp,%ebp
+  8015dc:	0f 34                	sysenter
+  8015de:	83 c4 04             	add    $0x4,%esp
+  8015e1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8015e2:	85 c0                	test   %eax,%eax
+  8015e4:	7f 6c                	jg     801652 <sys_env_set_trapframe+0xad>
+}
+  8015e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015e9:	5b                   	pop    %ebx
+  8015ea:	5e                   	pop    %esi
+  8015eb:	5f                   	pop    %edi
+  8015ec:	5d                   	pop    %ebp
+  8015ed:	c3                   	ret
+  8015ee:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015f3:	0f a2                	cpuid
+		return 0;
+  8015f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8015fa:	f6 c6 08             	test   $0x8,%dh
+  8015fd:	74 15                	je     801614 <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015ff:	89 c2                	mov    %eax,%edx
+  801601:	c1 ea 08             	shr    $0x8,%edx
+  801604:	83 e2 0f             	and    $0xf,%edx
+  801607:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80160c:	83 fa 06             	cmp    $0x6,%edx
+  80160f:	74 0e                	je     80161f <sys_env_set_trapframe+0x7a>
+  801611:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801614:	0f b6 c9             	movzbl %cl,%ecx
+  801617:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80161d:	eb 98                	jmp    8015b7 <sys_env_set_trapframe+0x12>
+  80161f:	89 c2                	mov    %eax,%edx
+  801621:	c1 ea 04             	shr    $0x4,%edx
+  801624:	83 e2 0f             	and    $0xf,%edx
+  801627:	83 fa 02             	cmp    $0x2,%edx
+  80162a:	77 e5                	ja     801611 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  80162c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80162f:	83 f8 02             	cmp    $0x2,%eax
+  801632:	0f 97 c1             	seta   %cl
+  801635:	0f b6 c9             	movzbl %cl,%ecx
+  801638:	eb d7                	jmp    801611 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  80163a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80163f:	b8 13 00 00 00       	mov    $0x13,%eax
+  801644:	8b 55 08             	mov    0x8(%ebp),%edx
+  801647:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80164a:	89 df                	mov    %ebx,%edi
+  80164c:	89 de                	mov    %ebx,%esi
+  80164e:	cd 30                	int    $0x30
+  801650:	eb 90                	jmp    8015e2 <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801652:	83 ec 0c             	sub    $0xc,%esp
+  801655:	50                   	push   %eax
+  801656:	6a 13                	push   $0x13
+  801658:	68 b9 2c 80 00       	push   $0x802cb9
+  80165d:	6a 4a                	push   $0x4a
+  80165f:	68 d6 2c 80 00       	push   $0x802cd6
+  801664:	e8 ce ea ff ff       	call   800137 <_panic>
+
+00801669 <sys_env_set_stack_limit>:
+{
+  801669:	55                   	push   %ebp
+  80166a:	89 e5                	mov    %esp,%ebp
+  80166c:	57                   	push   %edi
+  80166d:	56                   	push   %esi
+  80166e:	53                   	push   %ebx
+  80166f:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801672:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801679:	78 37                	js     8016b2 <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  80167b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801682:	74 7a                	je     8016fe <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  801684:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801689:	8b 55 08             	mov    0x8(%ebp),%edx
+  80168c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80168f:	b8 19 00 00 00       	mov    $0x19,%eax
+  801694:	89 df                	mov    %ebx,%edi
+  801696:	89 de                	mov    %ebx,%esi
+  801698:	55                   	push   %ebp
+  801699:	68 a2 16 80 00       	push   $0x8016a2
+  80169e:	89 e5                	mov    %esp,%ebp
+  8016a0:	0f 34                	sysenter
+  8016a2:	83 c4 04             	add    $0x4,%esp
+  8016a5:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8016a6:	85 c0                	test   %eax,%eax
+  8016a8:	7f 6c                	jg     801716 <sys_env_set_stack_limit+0xad>
+}
+  8016aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016ad:	5b                   	pop    %ebx
+  8016ae:	5e                   	pop    %esi
+  8016af:	5f                   	pop    %edi
+  8016b0:	5d                   	pop    %ebp
+  8016b1:	c3                   	ret
+  8016b2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016b7:	0f a2                	cpuid
+		return 0;
+  8016b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8016be:	f6 c6 08             	test   $0x8,%dh
+  8016c1:	74 15                	je     8016d8 <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016c3:	89 c2                	mov    %eax,%edx
+  8016c5:	c1 ea 08             	shr    $0x8,%edx
+  8016c8:	83 e2 0f             	and    $0xf,%edx
+  8016cb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8016d0:	83 fa 06             	cmp    $0x6,%edx
+  8016d3:	74 0e                	je     8016e3 <sys_env_set_stack_limit+0x7a>
+  8016d5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8016d8:	0f b6 c9             	movzbl %cl,%ecx
+  8016db:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8016e1:	eb 98                	jmp    80167b <sys_env_set_stack_limit+0x12>
+  8016e3:	89 c2                	mov    %eax,%edx
+  8016e5:	c1 ea 04             	shr    $0x4,%edx
+  8016e8:	83 e2 0f             	and    $0xf,%edx
+  8016eb:	83 fa 02             	cmp    $0x2,%edx
+  8016ee:	77 e5                	ja     8016d5 <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  8016f0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016f3:	83 f8 02             	cmp    $0x2,%eax
+  8016f6:	0f 97 c1             	seta   %cl
+  8016f9:	0f b6 c9             	movzbl %cl,%ecx
+  8016fc:	eb d7                	jmp    8016d5 <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  8016fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801703:	b8 19 00 00 00       	mov    $0x19,%eax
+  801708:	8b 55 08             	mov    0x8(%ebp),%edx
+  80170b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80170e:	89 df                	mov    %ebx,%edi
+  801710:	89 de                	mov    %ebx,%esi
+  801712:	cd 30                	int    $0x30
+  801714:	eb 90                	jmp    8016a6 <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801716:	83 ec 0c             	sub    $0xc,%esp
+  801719:	50                   	push   %eax
+  80171a:	6a 19                	push   $0x19
+  80171c:	68 b9 2c 80 00       	push   $0x802cb9
+  801721:	6a 4a                	push   $0x4a
+  801723:	68 d6 2c 80 00       	push   $0x802cd6
+  801728:	e8 0a ea ff ff       	call   800137 <_panic>
+
+0080172d <sys_env_set_pgfault_upcall>:
+{
+  80172d:	55                   	push   %ebp
+  80172e:	89 e5                	mov    %esp,%ebp
+  801730:	57                   	push   %edi
+  801731:	56                   	push   %esi
+  801732:	53                   	push   %ebx
+  801733:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801736:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80173d:	78 37                	js     801776 <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  80173f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801746:	74 7a                	je     8017c2 <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  801748:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80174d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801750:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801753:	b8 09 00 00 00       	mov    $0x9,%eax
+  801758:	89 df                	mov    %ebx,%edi
+  80175a:	89 de                	mov    %ebx,%esi
+  80175c:	55                   	push   %ebp
+  80175d:	68 66 17 80 00       	push   $0x801766
+  801762:	89 e5                	mov    %esp,%ebp
+  801764:	0f 34                	sysenter
+  801766:	83 c4 04             	add    $0x4,%esp
+  801769:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80176a:	85 c0                	test   %eax,%eax
+  80176c:	7f 6c                	jg     8017da <sys_env_set_pgfault_upcall+0xad>
+}
+  80176e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801771:	5b                   	pop    %ebx
+  801772:	5e                   	pop    %esi
+  801773:	5f                   	pop    %edi
+  801774:	5d                   	pop    %ebp
+  801775:	c3                   	ret
+  801776:	b8 01 00 00 00       	mov    $0x1,%eax
+  80177b:	0f a2                	cpuid
+		return 0;
+  80177d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801782:	f6 c6 08             	test   $0x8,%dh
+  801785:	74 15                	je     80179c <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801787:	89 c2                	mov    %eax,%edx
+  801789:	c1 ea 08             	shr    $0x8,%edx
+  80178c:	83 e2 0f             	and    $0xf,%edx
+  80178f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801794:	83 fa 06             	cmp    $0x6,%edx
+  801797:	74 0e                	je     8017a7 <sys_env_set_pgfault_upcall+0x7a>
+  801799:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80179c:	0f b6 c9             	movzbl %cl,%ecx
+  80179f:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8017a5:	eb 98                	jmp    80173f <sys_env_set_pgfault_upcall+0x12>
+  8017a7:	89 c2                	mov    %eax,%edx
+  8017a9:	c1 ea 04             	shr    $0x4,%edx
+  8017ac:	83 e2 0f             	and    $0xf,%edx
+  8017af:	83 fa 02             	cmp    $0x2,%edx
+  8017b2:	77 e5                	ja     801799 <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  8017b4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017b7:	83 f8 02             	cmp    $0x2,%eax
+  8017ba:	0f 97 c1             	seta   %cl
+  8017bd:	0f b6 c9             	movzbl %cl,%ecx
+  8017c0:	eb d7                	jmp    801799 <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  8017c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017c7:	b8 09 00 00 00       	mov    $0x9,%eax
+  8017cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017d2:	89 df                	mov    %ebx,%edi
+  8017d4:	89 de                	mov    %ebx,%esi
+  8017d6:	cd 30                	int    $0x30
+  8017d8:	eb 90                	jmp    80176a <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017da:	83 ec 0c             	sub    $0xc,%esp
+  8017dd:	50                   	push   %eax
+  8017de:	6a 09                	push   $0x9
+  8017e0:	68 b9 2c 80 00       	push   $0x802cb9
+  8017e5:	6a 4a                	push   $0x4a
+  8017e7:	68 d6 2c 80 00       	push   $0x802cd6
+  8017ec:	e8 46 e9 ff ff       	call   800137 <_panic>
+
+008017f1 <sys_ipc_try_send>:
+{
+  8017f1:	55                   	push   %ebp
+  8017f2:	89 e5                	mov    %esp,%ebp
+  8017f4:	57                   	push   %edi
+  8017f5:	56                   	push   %esi
+  8017f6:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8017f7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8017fe:	78 32                	js     801832 <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  801800:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801807:	74 75                	je     80187e <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801809:	8b 55 08             	mov    0x8(%ebp),%edx
+  80180c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80180f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801814:	be 00 00 00 00       	mov    $0x0,%esi
+  801819:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80181c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80181f:	55                   	push   %ebp
+  801820:	68 29 18 80 00       	push   $0x801829
+  801825:	89 e5                	mov    %esp,%ebp
+  801827:	0f 34                	sysenter
+  801829:	83 c4 04             	add    $0x4,%esp
+  80182c:	5d                   	pop    %ebp
+}
+  80182d:	5b                   	pop    %ebx
+  80182e:	5e                   	pop    %esi
+  80182f:	5f                   	pop    %edi
+  801830:	5d                   	pop    %ebp
+  801831:	c3                   	ret
+  801832:	b8 01 00 00 00       	mov    $0x1,%eax
+  801837:	0f a2                	cpuid
+		return 0;
+  801839:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80183e:	f6 c6 08             	test   $0x8,%dh
+  801841:	74 15                	je     801858 <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801843:	89 c2                	mov    %eax,%edx
+  801845:	c1 ea 08             	shr    $0x8,%edx
+  801848:	83 e2 0f             	and    $0xf,%edx
+  80184b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801850:	83 fa 06             	cmp    $0x6,%edx
+  801853:	74 0e                	je     801863 <sys_ipc_try_send+0x72>
+  801855:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801858:	0f b6 c9             	movzbl %cl,%ecx
+  80185b:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801861:	eb 9d                	jmp    801800 <sys_ipc_try_send+0xf>
+  801863:	89 c2                	mov    %eax,%edx
+  801865:	c1 ea 04             	shr    $0x4,%edx
+  801868:	83 e2 0f             	and    $0xf,%edx
+  80186b:	83 fa 02             	cmp    $0x2,%edx
+  80186e:	77 e5                	ja     801855 <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  801870:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801873:	83 f8 02             	cmp    $0x2,%eax
+  801876:	0f 97 c1             	seta   %cl
+  801879:	0f b6 c9             	movzbl %cl,%ecx
+  80187c:	eb d7                	jmp    801855 <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  80187e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801883:	be 00 00 00 00       	mov    $0x0,%esi
+  801888:	8b 55 08             	mov    0x8(%ebp),%edx
+  80188b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80188e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801891:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801894:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801896:	eb 95                	jmp    80182d <sys_ipc_try_send+0x3c>
+
+00801898 <sys_ipc_send>:
+{
+  801898:	55                   	push   %ebp
+  801899:	89 e5                	mov    %esp,%ebp
+  80189b:	57                   	push   %edi
+  80189c:	56                   	push   %esi
+  80189d:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80189e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8018a5:	78 32                	js     8018d9 <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  8018a7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8018ae:	74 75                	je     801925 <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  8018b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018b6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8018bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8018c0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018c3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8018c6:	55                   	push   %ebp
+  8018c7:	68 d0 18 80 00       	push   $0x8018d0
+  8018cc:	89 e5                	mov    %esp,%ebp
+  8018ce:	0f 34                	sysenter
+  8018d0:	83 c4 04             	add    $0x4,%esp
+  8018d3:	5d                   	pop    %ebp
+}
+  8018d4:	5b                   	pop    %ebx
+  8018d5:	5e                   	pop    %esi
+  8018d6:	5f                   	pop    %edi
+  8018d7:	5d                   	pop    %ebp
+  8018d8:	c3                   	ret
+  8018d9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018de:	0f a2                	cpuid
+		return 0;
+  8018e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018e5:	f6 c6 08             	test   $0x8,%dh
+  8018e8:	74 15                	je     8018ff <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018ea:	89 c2                	mov    %eax,%edx
+  8018ec:	c1 ea 08             	shr    $0x8,%edx
+  8018ef:	83 e2 0f             	and    $0xf,%edx
+  8018f2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018f7:	83 fa 06             	cmp    $0x6,%edx
+  8018fa:	74 0e                	je     80190a <sys_ipc_send+0x72>
+  8018fc:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8018ff:	0f b6 c9             	movzbl %cl,%ecx
+  801902:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801908:	eb 9d                	jmp    8018a7 <sys_ipc_send+0xf>
+  80190a:	89 c2                	mov    %eax,%edx
+  80190c:	c1 ea 04             	shr    $0x4,%edx
+  80190f:	83 e2 0f             	and    $0xf,%edx
+  801912:	83 fa 02             	cmp    $0x2,%edx
+  801915:	77 e5                	ja     8018fc <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  801917:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80191a:	83 f8 02             	cmp    $0x2,%eax
+  80191d:	0f 97 c1             	seta   %cl
+  801920:	0f b6 c9             	movzbl %cl,%ecx
+  801923:	eb d7                	jmp    8018fc <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  801925:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80192a:	be 00 00 00 00       	mov    $0x0,%esi
+  80192f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801932:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801935:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801938:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80193b:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  80193d:	eb 95                	jmp    8018d4 <sys_ipc_send+0x3c>
+
+0080193f <sys_ipc_recv>:
+{
+  80193f:	55                   	push   %ebp
+  801940:	89 e5                	mov    %esp,%ebp
+  801942:	57                   	push   %edi
+  801943:	56                   	push   %esi
+  801944:	53                   	push   %ebx
+  801945:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801948:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80194f:	78 36                	js     801987 <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  801951:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801958:	74 79                	je     8019d3 <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  80195a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80195d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801962:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801967:	89 cb                	mov    %ecx,%ebx
+  801969:	89 cf                	mov    %ecx,%edi
+  80196b:	89 ce                	mov    %ecx,%esi
+  80196d:	55                   	push   %ebp
+  80196e:	68 77 19 80 00       	push   $0x801977
+  801973:	89 e5                	mov    %esp,%ebp
+  801975:	0f 34                	sysenter
+  801977:	83 c4 04             	add    $0x4,%esp
+  80197a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80197b:	85 c0                	test   %eax,%eax
+  80197d:	7f 6b                	jg     8019ea <sys_ipc_recv+0xab>
+}
+  80197f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801982:	5b                   	pop    %ebx
+  801983:	5e                   	pop    %esi
+  801984:	5f                   	pop    %edi
+  801985:	5d                   	pop    %ebp
+  801986:	c3                   	ret
+  801987:	b8 01 00 00 00       	mov    $0x1,%eax
+  80198c:	0f a2                	cpuid
+		return 0;
+  80198e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801993:	f6 c6 08             	test   $0x8,%dh
+  801996:	74 15                	je     8019ad <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801998:	89 c2                	mov    %eax,%edx
+  80199a:	c1 ea 08             	shr    $0x8,%edx
+  80199d:	83 e2 0f             	and    $0xf,%edx
+  8019a0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019a5:	83 fa 06             	cmp    $0x6,%edx
+  8019a8:	74 0e                	je     8019b8 <sys_ipc_recv+0x79>
+  8019aa:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8019ad:	0f b6 c9             	movzbl %cl,%ecx
+  8019b0:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8019b6:	eb 99                	jmp    801951 <sys_ipc_recv+0x12>
+  8019b8:	89 c2                	mov    %eax,%edx
+  8019ba:	c1 ea 04             	shr    $0x4,%edx
+  8019bd:	83 e2 0f             	and    $0xf,%edx
+  8019c0:	83 fa 02             	cmp    $0x2,%edx
+  8019c3:	77 e5                	ja     8019aa <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  8019c5:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019c8:	83 f8 02             	cmp    $0x2,%eax
+  8019cb:	0f 97 c1             	seta   %cl
+  8019ce:	0f b6 c9             	movzbl %cl,%ecx
+  8019d1:	eb d7                	jmp    8019aa <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  8019d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019d8:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8019dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019e0:	89 cb                	mov    %ecx,%ebx
+  8019e2:	89 cf                	mov    %ecx,%edi
+  8019e4:	89 ce                	mov    %ecx,%esi
+  8019e6:	cd 30                	int    $0x30
+  8019e8:	eb 91                	jmp    80197b <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8019ea:	83 ec 0c             	sub    $0xc,%esp
+  8019ed:	50                   	push   %eax
+  8019ee:	6a 0d                	push   $0xd
+  8019f0:	68 b9 2c 80 00       	push   $0x802cb9
+  8019f5:	6a 4a                	push   $0x4a
+  8019f7:	68 d6 2c 80 00       	push   $0x802cd6
+  8019fc:	e8 36 e7 ff ff       	call   800137 <_panic>
+
+00801a01 <sys_ipc_send_range>:
+{
+  801a01:	55                   	push   %ebp
+  801a02:	89 e5                	mov    %esp,%ebp
+  801a04:	57                   	push   %edi
+  801a05:	56                   	push   %esi
+  801a06:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801a07:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801a0e:	78 30                	js     801a40 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  801a10:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801a17:	74 73                	je     801a8c <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801a19:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a1c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a1f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801a24:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a27:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a2a:	8b 75 18             	mov    0x18(%ebp),%esi
+  801a2d:	55                   	push   %ebp
+  801a2e:	68 37 1a 80 00       	push   $0x801a37
+  801a33:	89 e5                	mov    %esp,%ebp
+  801a35:	0f 34                	sysenter
+  801a37:	83 c4 04             	add    $0x4,%esp
+  801a3a:	5d                   	pop    %ebp
+}
+  801a3b:	5b                   	pop    %ebx
+  801a3c:	5e                   	pop    %esi
+  801a3d:	5f                   	pop    %edi
+  801a3e:	5d                   	pop    %ebp
+  801a3f:	c3                   	ret
+  801a40:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a45:	0f a2                	cpuid
+		return 0;
+  801a47:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801a4c:	f6 c6 08             	test   $0x8,%dh
+  801a4f:	74 15                	je     801a66 <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a51:	89 c2                	mov    %eax,%edx
+  801a53:	c1 ea 08             	shr    $0x8,%edx
+  801a56:	83 e2 0f             	and    $0xf,%edx
+  801a59:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a5e:	83 fa 06             	cmp    $0x6,%edx
+  801a61:	74 0e                	je     801a71 <sys_ipc_send_range+0x70>
+  801a63:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a66:	0f b6 c9             	movzbl %cl,%ecx
+  801a69:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801a6f:	eb 9f                	jmp    801a10 <sys_ipc_send_range+0xf>
+  801a71:	89 c2                	mov    %eax,%edx
+  801a73:	c1 ea 04             	shr    $0x4,%edx
+  801a76:	83 e2 0f             	and    $0xf,%edx
+  801a79:	83 fa 02             	cmp    $0x2,%edx
+  801a7c:	77 e5                	ja     801a63 <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  801a7e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a81:	83 f8 02             	cmp    $0x2,%eax
+  801a84:	0f 97 c1             	seta   %cl
+  801a87:	0f b6 c9             	movzbl %cl,%ecx
+  801a8a:	eb d7                	jmp    801a63 <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  801a8c:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801a91:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a94:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a97:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a9a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a9d:	8b 75 18             	mov    0x18(%ebp),%esi
+  801aa0:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  801aa2:	eb 97                	jmp    801a3b <sys_ipc_send_range+0x3a>
+
+00801aa4 <sys_ipc_recv_range>:
+{
+  801aa4:	55                   	push   %ebp
+  801aa5:	89 e5                	mov    %esp,%ebp
+  801aa7:	57                   	push   %edi
+  801aa8:	56                   	push   %esi
+  801aa9:	53                   	push   %ebx
+  801aaa:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801aad:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801ab4:	78 37                	js     801aed <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  801ab6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801abd:	74 7a                	je     801b39 <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  801abf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ac4:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ac7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801aca:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801acf:	89 df                	mov    %ebx,%edi
+  801ad1:	89 de                	mov    %ebx,%esi
+  801ad3:	55                   	push   %ebp
+  801ad4:	68 dd 1a 80 00       	push   $0x801add
+  801ad9:	89 e5                	mov    %esp,%ebp
+  801adb:	0f 34                	sysenter
+  801add:	83 c4 04             	add    $0x4,%esp
+  801ae0:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801ae1:	85 c0                	test   %eax,%eax
+  801ae3:	7f 6c                	jg     801b51 <sys_ipc_recv_range+0xad>
+}
+  801ae5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ae8:	5b                   	pop    %ebx
+  801ae9:	5e                   	pop    %esi
+  801aea:	5f                   	pop    %edi
+  801aeb:	5d                   	pop    %ebp
+  801aec:	c3                   	ret
+  801aed:	b8 01 00 00 00       	mov    $0x1,%eax
+  801af2:	0f a2                	cpuid
+		return 0;
+  801af4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801af9:	f6 c6 08             	test   $0x8,%dh
+  801afc:	74 15                	je     801b13 <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801afe:	89 c2                	mov    %eax,%edx
+  801b00:	c1 ea 08             	shr    $0x8,%edx
+  801b03:	83 e2 0f             	and    $0xf,%edx
+  801b06:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b0b:	83 fa 06             	cmp    $0x6,%edx
+  801b0e:	74 0e                	je     801b1e <sys_ipc_recv_range+0x7a>
+  801b10:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b13:	0f b6 c9             	movzbl %cl,%ecx
+  801b16:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801b1c:	eb 98                	jmp    801ab6 <sys_ipc_recv_range+0x12>
+  801b1e:	89 c2                	mov    %eax,%edx
+  801b20:	c1 ea 04             	shr    $0x4,%edx
+  801b23:	83 e2 0f             	and    $0xf,%edx
+  801b26:	83 fa 02             	cmp    $0x2,%edx
+  801b29:	77 e5                	ja     801b10 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801b2b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b2e:	83 f8 02             	cmp    $0x2,%eax
+  801b31:	0f 97 c1             	seta   %cl
+  801b34:	0f b6 c9             	movzbl %cl,%ecx
+  801b37:	eb d7                	jmp    801b10 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801b39:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b3e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801b43:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b46:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b49:	89 df                	mov    %ebx,%edi
+  801b4b:	89 de                	mov    %ebx,%esi
+  801b4d:	cd 30                	int    $0x30
+  801b4f:	eb 90                	jmp    801ae1 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801b51:	83 ec 0c             	sub    $0xc,%esp
+  801b54:	50                   	push   %eax
+  801b55:	6a 1f                	push   $0x1f
+  801b57:	68 b9 2c 80 00       	push   $0x802cb9
+  801b5c:	6a 4a                	push   $0x4a
+  801b5e:	68 d6 2c 80 00       	push   $0x802cd6
+  801b63:	e8 cf e5 ff ff       	call   800137 <_panic>
+
+00801b68 <sys_ipc_call>:
+{
+  801b68:	55                   	push   %ebp
+  801b69:	89 e5                	mov    %esp,%ebp
+  801b6b:	57                   	push   %edi
+  801b6c:	56                   	push   %esi
+  801b6d:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801b6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b71:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801b76:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b79:	55                   	push   %ebp
+  801b7a:	56                   	push   %esi
+  801b7b:	8b 0e                	mov    (%esi),%ecx
+  801b7d:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801b80:	8b 7e 08             	mov    0x8(%esi),%edi
+  801b83:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801b86:	8b 76 0c             	mov    0xc(%esi),%esi
+  801b89:	cd 30                	int    $0x30
+  801b8b:	87 34 24             	xchg   %esi,(%esp)
+  801b8e:	89 0e                	mov    %ecx,(%esi)
+  801b90:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801b93:	89 7e 08             	mov    %edi,0x8(%esi)
+  801b96:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801b99:	8f 46 0c             	pop    0xc(%esi)
+  801b9c:	5d                   	pop    %ebp
+}
+  801b9d:	5b                   	pop    %ebx
+  801b9e:	5e                   	pop    %esi
+  801b9f:	5f                   	pop    %edi
+  801ba0:	5d                   	pop    %ebp
+  801ba1:	c3                   	ret
+
+00801ba2 <sys_ipc_reply_wait>:
+{
+  801ba2:	55                   	push   %ebp
+  801ba3:	89 e5                	mov    %esp,%ebp
+  801ba5:	57                   	push   %edi
+  801ba6:	56                   	push   %esi
+  801ba7:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801ba8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bab:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801bb0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801bb3:	55                   	push   %ebp
+  801bb4:	56                   	push   %esi
+  801bb5:	8b 0e                	mov    (%esi),%ecx
+  801bb7:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801bba:	8b 7e 08             	mov    0x8(%esi),%edi
+  801bbd:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801bc0:	8b 76 0c             	mov    0xc(%esi),%esi
+  801bc3:	cd 30                	int    $0x30
+  801bc5:	87 34 24             	xchg   %esi,(%esp)
+  801bc8:	89 0e                	mov    %ecx,(%esi)
+  801bca:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801bcd:	89 7e 08             	mov    %edi,0x8(%esi)
+  801bd0:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801bd3:	8f 46 0c             	pop    0xc(%esi)
+  801bd6:	5d                   	pop    %ebp
+}
+  801bd7:	5b                   	pop    %ebx
+  801bd8:	5e                   	pop    %esi
+  801bd9:	5f                   	pop    %edi
+  801bda:	5d                   	pop    %ebp
+  801bdb:	c3                   	ret
+
+00801bdc <sys_ipc_send_msg>:
+{
+  801bdc:	55                   	push   %ebp
+  801bdd:	89 e5                	mov    %esp,%ebp
+  801bdf:	57                   	push   %edi
+  801be0:	56                   	push   %esi
+  801be1:	53                   	push   %ebx
+  801be2:	83 ec 20             	sub    $0x20,%esp
+  801be5:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801be8:	8b 10                	mov    (%eax),%edx
+  801bea:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801bed:	8b 50 04             	mov    0x4(%eax),%edx
+  801bf0:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801bf3:	8b 50 08             	mov    0x8(%eax),%edx
+  801bf6:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801bf9:	8b 50 0c             	mov    0xc(%eax),%edx
+  801bfc:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801bff:	8b 40 10             	mov    0x10(%eax),%eax
+  801c02:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801c05:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801c08:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c0b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801c10:	55                   	push   %ebp
+  801c11:	56                   	push   %esi
+  801c12:	8b 0e                	mov    (%esi),%ecx
+  801c14:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801c17:	8b 7e 08             	mov    0x8(%esi),%edi
+  801c1a:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801c1d:	8b 76 0c             	mov    0xc(%esi),%esi
+  801c20:	cd 30                	int    $0x30
+  801c22:	87 34 24             	xchg   %esi,(%esp)
+  801c25:	89 0e                	mov    %ecx,(%esi)
+  801c27:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801c2a:	89 7e 08             	mov    %edi,0x8(%esi)
+  801c2d:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801c30:	8f 46 0c             	pop    0xc(%esi)
+  801c33:	5d                   	pop    %ebp
+}
+  801c34:	83 c4 20             	add    $0x20,%esp
+  801c37:	5b                   	pop    %ebx
+  801c38:	5e                   	pop    %esi
+  801c39:	5f                   	pop    %edi
+  801c3a:	5d                   	pop    %ebp
+  801c3b:	c3                   	ret
+
+00801c3c <sys_fork>:
+{
+  801c3c:	55                   	push   %ebp
+  801c3d:	89 e5                	mov    %esp,%ebp
+  801c3f:	57                   	push   %edi
+  801c40:	56                   	push   %esi
+  801c41:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801c42:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801c49:	78 2e                	js     801c79 <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801c4b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801c52:	74 71                	je     801cc5 <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801c54:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c59:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801c5e:	89 d1                	mov    %edx,%ecx
+  801c60:	89 d3                	mov    %edx,%ebx
+  801c62:	89 d7                	mov    %edx,%edi
+  801c64:	89 d6                	mov    %edx,%esi
+  801c66:	55                   	push   %ebp
+  801c67:	68 70 1c 80 00       	push   $0x801c70
+  801c6c:	89 e5                	mov    %esp,%ebp
+  801c6e:	0f 34                	sysenter
+  801c70:	83 c4 04             	add    $0x4,%esp
+  801c73:	5d                   	pop    %ebp
+}
+  801c74:	5b                   	pop    %ebx
+  801c75:	5e                   	pop    %esi
+  801c76:	5f                   	pop    %edi
+  801c77:	5d                   	pop    %ebp
+  801c78:	c3                   	ret
+  801c79:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c7e:	0f a2                	cpuid
+		return 0;
+  801c80:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801c85:	f6 c6 08             	test   $0x8,%dh
+  801c88:	74 15                	je     801c9f <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c8a:	89 c2                	mov    %eax,%edx
+  801c8c:	c1 ea 08             	shr    $0x8,%edx
+  801c8f:	83 e2 0f             	and    $0xf,%edx
+  801c92:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801c97:	83 fa 06             	cmp    $0x6,%edx
+  801c9a:	74 0e                	je     801caa <sys_fork+0x6e>
+  801c9c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801c9f:	0f b6 c9             	movzbl %cl,%ecx
+  801ca2:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801ca8:	eb a1                	jmp    801c4b <sys_fork+0xf>
+  801caa:	89 c2                	mov    %eax,%edx
+  801cac:	c1 ea 04             	shr    $0x4,%edx
+  801caf:	83 e2 0f             	and    $0xf,%edx
+  801cb2:	83 fa 02             	cmp    $0x2,%edx
+  801cb5:	77 e5                	ja     801c9c <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801cb7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801cba:	83 f8 02             	cmp    $0x2,%eax
+  801cbd:	0f 97 c1             	seta   %cl
+  801cc0:	0f b6 c9             	movzbl %cl,%ecx
+  801cc3:	eb d7                	jmp    801c9c <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801cc5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cca:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801ccf:	89 d1                	mov    %edx,%ecx
+  801cd1:	89 d3                	mov    %edx,%ebx
+  801cd3:	89 d7                	mov    %edx,%edi
+  801cd5:	89 d6                	mov    %edx,%esi
+  801cd7:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801cd9:	eb 99                	jmp    801c74 <sys_fork+0x38>
+
+00801cdb <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801cdb:	55                   	push   %ebp
+  801cdc:	89 e5                	mov    %esp,%ebp
+  801cde:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801ce1:	ff 75 14             	push   0x14(%ebp)
+  801ce4:	ff 75 10             	push   0x10(%ebp)
+  801ce7:	ff 75 0c             	push   0xc(%ebp)
+  801cea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cef:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cf2:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801cf7:	e8 81 ee ff ff       	call   800b7d <page_vec_call>
+}
+  801cfc:	c9                   	leave
+  801cfd:	c3                   	ret
+
+00801cfe <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801cfe:	55                   	push   %ebp
+  801cff:	89 e5                	mov    %esp,%ebp
+  801d01:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801d04:	ff 75 18             	push   0x18(%ebp)
+  801d07:	ff 75 14             	push   0x14(%ebp)
+  801d0a:	ff 75 10             	push   0x10(%ebp)
+  801d0d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d10:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d13:	b8 10 00 00 00       	mov    $0x10,%eax
+  801d18:	e8 60 ee ff ff       	call   800b7d <page_vec_call>
+}
+  801d1d:	c9                   	leave
+  801d1e:	c3                   	ret
+
+00801d1f <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801d1f:	55                   	push   %ebp
+  801d20:	89 e5                	mov    %esp,%ebp
+  801d22:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801d25:	ff 75 14             	push   0x14(%ebp)
+  801d28:	ff 75 10             	push   0x10(%ebp)
+  801d2b:	ff 75 0c             	push   0xc(%ebp)
+  801d2e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d33:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d36:	b8 11 00 00 00       	mov    $0x11,%eax
+  801d3b:	e8 3d ee ff ff       	call   800b7d <page_vec_call>
+}
+  801d40:	c9                   	leave
+  801d41:	c3                   	ret
+
+00801d42 <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801d42:	55                   	push   %ebp
+  801d43:	89 e5                	mov    %esp,%ebp
+  801d45:	57                   	push   %edi
+  801d46:	56                   	push   %esi
+  801d47:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801d48:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801d4f:	78 32                	js     801d83 <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801d51:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801d58:	74 75                	je     801dcf <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801d5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d5d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d60:	b8 12 00 00 00       	mov    $0x12,%eax
+  801d65:	be 00 00 00 00       	mov    $0x0,%esi
+  801d6a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d6d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801d70:	55                   	push   %ebp
+  801d71:	68 7a 1d 80 00       	push   $0x801d7a
+  801d76:	89 e5                	mov    %esp,%ebp
+  801d78:	0f 34                	sysenter
+  801d7a:	83 c4 04             	add    $0x4,%esp
+  801d7d:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801d7e:	5b                   	pop    %ebx
+  801d7f:	5e                   	pop    %esi
+  801d80:	5f                   	pop    %edi
+  801d81:	5d                   	pop    %ebp
+  801d82:	c3                   	ret
+  801d83:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d88:	0f a2                	cpuid
+		return 0;
+  801d8a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801d8f:	f6 c6 08             	test   $0x8,%dh
+  801d92:	74 15                	je     801da9 <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d94:	89 c2                	mov    %eax,%edx
+  801d96:	c1 ea 08             	shr    $0x8,%edx
+  801d99:	83 e2 0f             	and    $0xf,%edx
+  801d9c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801da1:	83 fa 06             	cmp    $0x6,%edx
+  801da4:	74 0e                	je     801db4 <sys_vm_ranges+0x72>
+  801da6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801da9:	0f b6 c9             	movzbl %cl,%ecx
+  801dac:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801db2:	eb 9d                	jmp    801d51 <sys_vm_ranges+0xf>
+  801db4:	89 c2                	mov    %eax,%edx
+  801db6:	c1 ea 04             	shr    $0x4,%edx
+  801db9:	83 e2 0f             	and    $0xf,%edx
+  801dbc:	83 fa 02             	cmp    $0x2,%edx
+  801dbf:	77 e5                	ja     801da6 <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  801dc1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801dc4:	83 f8 02             	cmp    $0x2,%eax
+  801dc7:	0f 97 c1             	seta   %cl
+  801dca:	0f b6 c9             	movzbl %cl,%ecx
+  801dcd:	eb d7                	jmp    801da6 <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801dcf:	b8 12 00 00 00       	mov    $0x12,%eax
+  801dd4:	be 00 00 00 00       	mov    $0x0,%esi
+  801dd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ddc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ddf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801de2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801de5:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801de7:	eb 95                	jmp    801d7e <sys_vm_ranges+0x3c>
+
+00801de9 <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801de9:	55                   	push   %ebp
+  801dea:	89 e5                	mov    %esp,%ebp
+  801dec:	57                   	push   %edi
+  801ded:	56                   	push   %esi
+  801dee:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801def:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801df6:	78 31                	js     801e29 <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801df8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801dff:	74 74                	je     801e75 <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801e01:	be 00 00 00 00       	mov    $0x0,%esi
+  801e06:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e09:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e0c:	b8 14 00 00 00       	mov    $0x14,%eax
+  801e11:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e14:	89 f7                	mov    %esi,%edi
+  801e16:	55                   	push   %ebp
+  801e17:	68 20 1e 80 00       	push   $0x801e20
+  801e1c:	89 e5                	mov    %esp,%ebp
+  801e1e:	0f 34                	sysenter
+  801e20:	83 c4 04             	add    $0x4,%esp
+  801e23:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801e24:	5b                   	pop    %ebx
+  801e25:	5e                   	pop    %esi
+  801e26:	5f                   	pop    %edi
+  801e27:	5d                   	pop    %ebp
+  801e28:	c3                   	ret
+  801e29:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e2e:	0f a2                	cpuid
+		return 0;
+  801e30:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801e35:	f6 c6 08             	test   $0x8,%dh
+  801e38:	74 15                	je     801e4f <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e3a:	89 c2                	mov    %eax,%edx
+  801e3c:	c1 ea 08             	shr    $0x8,%edx
+  801e3f:	83 e2 0f             	and    $0xf,%edx
+  801e42:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e47:	83 fa 06             	cmp    $0x6,%edx
+  801e4a:	74 0e                	je     801e5a <sys_spawn+0x71>
+  801e4c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801e4f:	0f b6 c9             	movzbl %cl,%ecx
+  801e52:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801e58:	eb 9e                	jmp    801df8 <sys_spawn+0xf>
+  801e5a:	89 c2                	mov    %eax,%edx
+  801e5c:	c1 ea 04             	shr    $0x4,%edx
+  801e5f:	83 e2 0f             	and    $0xf,%edx
+  801e62:	83 fa 02             	cmp    $0x2,%edx
+  801e65:	77 e5                	ja     801e4c <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  801e67:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e6a:	83 f8 02             	cmp    $0x2,%eax
+  801e6d:	0f 97 c1             	seta   %cl
+  801e70:	0f b6 c9             	movzbl %cl,%ecx
+  801e73:	eb d7                	jmp    801e4c <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  801e75:	be 00 00 00 00       	mov    $0x0,%esi
+  801e7a:	b8 14 00 00 00       	mov    $0x14,%eax
+  801e7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e85:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e88:	89 f7                	mov    %esi,%edi
+  801e8a:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  801e8c:	eb 96                	jmp    801e24 <sys_spawn+0x3b>
+
+00801e8e <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  801e8e:	55                   	push   %ebp
+  801e8f:	89 e5                	mov    %esp,%ebp
+  801e91:	57                   	push   %edi
+  801e92:	56                   	push   %esi
+  801e93:	53                   	push   %ebx
+  801e94:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801e97:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801e9e:	78 37                	js     801ed7 <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  801ea0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801ea7:	74 7a                	je     801f23 <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  801ea9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801eae:	8b 55 08             	mov    0x8(%ebp),%edx
+  801eb1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801eb4:	b8 15 00 00 00       	mov    $0x15,%eax
+  801eb9:	89 df                	mov    %ebx,%edi
+  801ebb:	89 de                	mov    %ebx,%esi
+  801ebd:	55                   	push   %ebp
+  801ebe:	68 c7 1e 80 00       	push   $0x801ec7
+  801ec3:	89 e5                	mov    %esp,%ebp
+  801ec5:	0f 34                	sysenter
+  801ec7:	83 c4 04             	add    $0x4,%esp
+  801eca:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801ecb:	85 c0                	test   %eax,%eax
+  801ecd:	7f 6c                	jg     801f3b <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  801ecf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ed2:	5b                   	pop    %ebx
+  801ed3:	5e                   	pop    %esi
+  801ed4:	5f                   	pop    %edi
+  801ed5:	5d                   	pop    %ebp
+  801ed6:	c3                   	ret
+  801ed7:	b8 01 00 00 00       	mov    $0x1,%eax
+  801edc:	0f a2                	cpuid
+		return 0;
+  801ede:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801ee3:	f6 c6 08             	test   $0x8,%dh
+  801ee6:	74 15                	je     801efd <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ee8:	89 c2                	mov    %eax,%edx
+  801eea:	c1 ea 08             	shr    $0x8,%edx
+  801eed:	83 e2 0f             	and    $0xf,%edx
+  801ef0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ef5:	83 fa 06             	cmp    $0x6,%edx
+  801ef8:	74 0e                	je     801f08 <sys_shm_create+0x7a>
+  801efa:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801efd:	0f b6 c9             	movzbl %cl,%ecx
+  801f00:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801f06:	eb 98                	jmp    801ea0 <sys_shm_create+0x12>
+  801f08:	89 c2                	mov    %eax,%edx
+  801f0a:	c1 ea 04             	shr    $0x4,%edx
+  801f0d:	83 e2 0f             	and    $0xf,%edx
+  801f10:	83 fa 02             	cmp    $0x2,%edx
+  801f13:	77 e5                	ja     801efa <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  801f15:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f18:	83 f8 02             	cmp    $0x2,%eax
+  801f1b:	0f 97 c1             	seta   %cl
+  801f1e:	0f b6 c9             	movzbl %cl,%ecx
+  801f21:	eb d7                	jmp    801efa <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  801f23:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f28:	b8 15 00 00 00       	mov    $0x15,%eax
+  801f2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f33:	89 df                	mov    %ebx,%edi
+  801f35:	89 de                	mov    %ebx,%esi
+  801f37:	cd 30                	int    $0x30
+  801f39:	eb 90                	jmp    801ecb <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801f3b:	83 ec 0c             	sub    $0xc,%esp
+  801f3e:	50                   	push   %eax
+  801f3f:	6a 15                	push   $0x15
+  801f41:	68 b9 2c 80 00       	push   $0x802cb9
+  801f46:	6a 4a                	push   $0x4a
+  801f48:	68 d6 2c 80 00       	push   $0x802cd6
+  801f4d:	e8 e5 e1 ff ff       	call   800137 <_panic>
+
+00801f52 <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  801f52:	55                   	push   %ebp
+  801f53:	89 e5                	mov    %esp,%ebp
+  801f55:	57                   	push   %edi
+  801f56:	56                   	push   %esi
+  801f57:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801f58:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801f5f:	78 32                	js     801f93 <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  801f61:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801f68:	74 75                	je     801fdf <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801f6a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f6d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f70:	b8 16 00 00 00       	mov    $0x16,%eax
+  801f75:	be 00 00 00 00       	mov    $0x0,%esi
+  801f7a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f7d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801f80:	55                   	push   %ebp
+  801f81:	68 8a 1f 80 00       	push   $0x801f8a
+  801f86:	89 e5                	mov    %esp,%ebp
+  801f88:	0f 34                	sysenter
+  801f8a:	83 c4 04             	add    $0x4,%esp
+  801f8d:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  801f8e:	5b                   	pop    %ebx
+  801f8f:	5e                   	pop    %esi
+  801f90:	5f                   	pop    %edi
+  801f91:	5d                   	pop    %ebp
+  801f92:	c3                   	ret
+  801f93:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f98:	0f a2                	cpuid
+		return 0;
+  801f9a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801f9f:	f6 c6 08             	test   $0x8,%dh
+  801fa2:	74 15                	je     801fb9 <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fa4:	89 c2                	mov    %eax,%edx
+  801fa6:	c1 ea 08             	shr    $0x8,%edx
+  801fa9:	83 e2 0f             	and    $0xf,%edx
+  801fac:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801fb1:	83 fa 06             	cmp    $0x6,%edx
+  801fb4:	74 0e                	je     801fc4 <sys_shm_attach+0x72>
+  801fb6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801fb9:	0f b6 c9             	movzbl %cl,%ecx
+  801fbc:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801fc2:	eb 9d                	jmp    801f61 <sys_shm_attach+0xf>
+  801fc4:	89 c2                	mov    %eax,%edx
+  801fc6:	c1 ea 04             	shr    $0x4,%edx
+  801fc9:	83 e2 0f             	and    $0xf,%edx
+  801fcc:	83 fa 02             	cmp    $0x2,%edx
+  801fcf:	77 e5                	ja     801fb6 <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  801fd1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fd4:	83 f8 02             	cmp    $0x2,%eax
+  801fd7:	0f 97 c1             	seta   %cl
+  801fda:	0f b6 c9             	movzbl %cl,%ecx
+  801fdd:	eb d7                	jmp    801fb6 <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  801fdf:	b8 16 00 00 00       	mov    $0x16,%eax
+  801fe4:	be 00 00 00 00       	mov    $0x0,%esi
+  801fe9:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ff2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ff5:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  801ff7:	eb 95                	jmp    801f8e <sys_shm_attach+0x3c>
+
+00801ff9 <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  801ff9:	55                   	push   %ebp
+  801ffa:	89 e5                	mov    %esp,%ebp
+  801ffc:	57                   	push   %edi
+  801ffd:	56                   	push   %esi
+  801ffe:	53                   	push   %ebx
+  801fff:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802002:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802009:	78 38                	js     802043 <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  80200b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802012:	74 7b                	je     80208f <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  802014:	be 00 00 00 00       	mov    $0x0,%esi
+  802019:	8b 55 08             	mov    0x8(%ebp),%edx
+  80201c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80201f:	b8 17 00 00 00       	mov    $0x17,%eax
+  802024:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802027:	89 f7                	mov    %esi,%edi
+  802029:	55                   	push   %ebp
+  80202a:	68 33 20 80 00       	push   $0x802033
+  80202f:	89 e5                	mov    %esp,%ebp
+  802031:	0f 34                	sysenter
+  802033:	83 c4 04             	add    $0x4,%esp
+  802036:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802037:	85 c0                	test   %eax,%eax
+  802039:	7f 6d                	jg     8020a8 <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  80203b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80203e:	5b                   	pop    %ebx
+  80203f:	5e                   	pop    %esi
+  802040:	5f                   	pop    %edi
+  802041:	5d                   	pop    %ebp
+  802042:	c3                   	ret
+  802043:	b8 01 00 00 00       	mov    $0x1,%eax
+  802048:	0f a2                	cpuid
+		return 0;
+  80204a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80204f:	f6 c6 08             	test   $0x8,%dh
+  802052:	74 15                	je     802069 <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802054:	89 c2                	mov    %eax,%edx
+  802056:	c1 ea 08             	shr    $0x8,%edx
+  802059:	83 e2 0f             	and    $0xf,%edx
+  80205c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802061:	83 fa 06             	cmp    $0x6,%edx
+  802064:	74 0e                	je     802074 <sys_shm_detach+0x7b>
+  802066:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802069:	0f b6 c9             	movzbl %cl,%ecx
+  80206c:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802072:	eb 97                	jmp    80200b <sys_shm_detach+0x12>
+  802074:	89 c2                	mov    %eax,%edx
+  802076:	c1 ea 04             	shr    $0x4,%edx
+  802079:	83 e2 0f             	and    $0xf,%edx
+  80207c:	83 fa 02             	cmp    $0x2,%edx
+  80207f:	77 e5                	ja     802066 <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  802081:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802084:	83 f8 02             	cmp    $0x2,%eax
+  802087:	0f 97 c1             	seta   %cl
+  80208a:	0f b6 c9             	movzbl %cl,%ecx
+  80208d:	eb d7                	jmp    802066 <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  80208f:	be 00 00 00 00       	mov    $0x0,%esi
+  802094:	b8 17 00 00 00       	mov    $0x17,%eax
+  802099:	8b 55 08             	mov    0x8(%ebp),%edx
+  80209c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80209f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8020a2:	89 f7                	mov    %esi,%edi
+  8020a4:	cd 30                	int    $0x30
+  8020a6:	eb 8f                	jmp    802037 <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8020a8:	83 ec 0c             	sub    $0xc,%esp
+  8020ab:	50                   	push   %eax
+  8020ac:	6a 17                	push   $0x17
+  8020ae:	68 b9 2c 80 00       	push   $0x802cb9
+  8020b3:	6a 4a                	push   $0x4a
+  8020b5:	68 d6 2c 80 00       	push   $0x802cd6
+  8020ba:	e8 78 e0 ff ff       	call   800137 <_panic>
+
+008020bf <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  8020bf:	55                   	push   %ebp
+  8020c0:	89 e5                	mov    %esp,%ebp
+  8020c2:	57                   	push   %edi
+  8020c3:	56                   	push   %esi
+  8020c4:	53                   	push   %ebx
+  8020c5:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8020c8:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8020cf:	78 36                	js     802107 <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  8020d1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8020d8:	74 79                	je     802153 <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  8020da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020e2:	b8 18 00 00 00       	mov    $0x18,%eax
+  8020e7:	89 cb                	mov    %ecx,%ebx
+  8020e9:	89 cf                	mov    %ecx,%edi
+  8020eb:	89 ce                	mov    %ecx,%esi
+  8020ed:	55                   	push   %ebp
+  8020ee:	68 f7 20 80 00       	push   $0x8020f7
+  8020f3:	89 e5                	mov    %esp,%ebp
+  8020f5:	0f 34                	sysenter
+  8020f7:	83 c4 04             	add    $0x4,%esp
+  8020fa:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8020fb:	85 c0                	test   %eax,%eax
+  8020fd:	7f 6b                	jg     80216a <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  8020ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802102:	5b                   	pop    %ebx
+  802103:	5e                   	pop    %esi
+  802104:	5f                   	pop    %edi
+  802105:	5d                   	pop    %ebp
+  802106:	c3                   	ret
+  802107:	b8 01 00 00 00       	mov    $0x1,%eax
+  80210c:	0f a2                	cpuid
+		return 0;
+  80210e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802113:	f6 c6 08             	test   $0x8,%dh
+  802116:	74 15                	je     80212d <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802118:	89 c2                	mov    %eax,%edx
+  80211a:	c1 ea 08             	shr    $0x8,%edx
+  80211d:	83 e2 0f             	and    $0xf,%edx
+  802120:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802125:	83 fa 06             	cmp    $0x6,%edx
+  802128:	74 0e                	je     802138 <sys_shm_remove+0x79>
+  80212a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80212d:	0f b6 c9             	movzbl %cl,%ecx
+  802130:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802136:	eb 99                	jmp    8020d1 <sys_shm_remove+0x12>
+  802138:	89 c2                	mov    %eax,%edx
+  80213a:	c1 ea 04             	shr    $0x4,%edx
+  80213d:	83 e2 0f             	and    $0xf,%edx
+  802140:	83 fa 02             	cmp    $0x2,%edx
+  802143:	77 e5                	ja     80212a <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  802145:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802148:	83 f8 02             	cmp    $0x2,%eax
+  80214b:	0f 97 c1             	seta   %cl
+  80214e:	0f b6 c9             	movzbl %cl,%ecx
+  802151:	eb d7                	jmp    80212a <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  802153:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802158:	b8 18 00 00 00       	mov    $0x18,%eax
+  80215d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802160:	89 cb                	mov    %ecx,%ebx
+  802162:	89 cf                	mov    %ecx,%edi
+  802164:	89 ce                	mov    %ecx,%esi
+  802166:	cd 30                	int    $0x30
+  802168:	eb 91                	jmp    8020fb <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80216a:	83 ec 0c             	sub    $0xc,%esp
+  80216d:	50                   	push   %eax
+  80216e:	6a 18                	push   $0x18
+  802170:	68 b9 2c 80 00       	push   $0x802cb9
+  802175:	6a 4a                	push   $0x4a
+  802177:	68 d6 2c 80 00       	push   $0x802cd6
+  80217c:	e8 b6 df ff ff       	call   800137 <_panic>
+
+00802181 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  802181:	55                   	push   %ebp
+  802182:	89 e5                	mov    %esp,%ebp
+  802184:	57                   	push   %edi
+  802185:	56                   	push   %esi
+  802186:	53                   	push   %ebx
+  802187:	83 ec 0c             	sub    $0xc,%esp
+  80218a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80218d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802190:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  802193:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80219a:	78 32                	js     8021ce <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  80219c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8021a3:	74 75                	je     80221a <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  8021a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021ab:	b8 20 00 00 00       	mov    $0x20,%eax
+  8021b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8021b5:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8021b8:	55                   	push   %ebp
+  8021b9:	68 c2 21 80 00       	push   $0x8021c2
+  8021be:	89 e5                	mov    %esp,%ebp
+  8021c0:	0f 34                	sysenter
+  8021c2:	83 c4 04             	add    $0x4,%esp
+  8021c5:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  8021c6:	83 c4 0c             	add    $0xc,%esp
+  8021c9:	5b                   	pop    %ebx
+  8021ca:	5e                   	pop    %esi
+  8021cb:	5f                   	pop    %edi
+  8021cc:	5d                   	pop    %ebp
+  8021cd:	c3                   	ret
+  8021ce:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021d3:	0f a2                	cpuid
+		return 0;
+  8021d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8021da:	f6 c6 08             	test   $0x8,%dh
+  8021dd:	74 15                	je     8021f4 <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021df:	89 c2                	mov    %eax,%edx
+  8021e1:	c1 ea 08             	shr    $0x8,%edx
+  8021e4:	83 e2 0f             	and    $0xf,%edx
+  8021e7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8021ec:	83 fa 06             	cmp    $0x6,%edx
+  8021ef:	74 0e                	je     8021ff <sys_futex_wait+0x7e>
+  8021f1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8021f4:	0f b6 c9             	movzbl %cl,%ecx
+  8021f7:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8021fd:	eb 9d                	jmp    80219c <sys_futex_wait+0x1b>
+  8021ff:	89 c2                	mov    %eax,%edx
+  802201:	c1 ea 04             	shr    $0x4,%edx
+  802204:	83 e2 0f             	and    $0xf,%edx
+  802207:	83 fa 02             	cmp    $0x2,%edx
+  80220a:	77 e5                	ja     8021f1 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  80220c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80220f:	83 f8 02             	cmp    $0x2,%eax
+  802212:	0f 97 c1             	seta   %cl
+  802215:	0f b6 c9             	movzbl %cl,%ecx
+  802218:	eb d7                	jmp    8021f1 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  80221a:	b8 20 00 00 00       	mov    $0x20,%eax
+  80221f:	be 00 00 00 00       	mov    $0x0,%esi
+  802224:	8b 55 08             	mov    0x8(%ebp),%edx
+  802227:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80222a:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  80222d:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  80222f:	eb 95                	jmp    8021c6 <sys_futex_wait+0x45>
+
+00802231 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  802231:	55                   	push   %ebp
+  802232:	89 e5                	mov    %esp,%ebp
+  802234:	57                   	push   %edi
+  802235:	56                   	push   %esi
+  802236:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802237:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80223e:	78 30                	js     802270 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  802240:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802247:	74 73                	je     8022bc <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  802249:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80224e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802251:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802254:	b8 21 00 00 00       	mov    $0x21,%eax
+  802259:	89 df                	mov    %ebx,%edi
+  80225b:	89 de                	mov    %ebx,%esi
+  80225d:	55                   	push   %ebp
+  80225e:	68 67 22 80 00       	push   $0x802267
+  802263:	89 e5                	mov    %esp,%ebp
+  802265:	0f 34                	sysenter
+  802267:	83 c4 04             	add    $0x4,%esp
+  80226a:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80226b:	5b                   	pop    %ebx
+  80226c:	5e                   	pop    %esi
+  80226d:	5f                   	pop    %edi
+  80226e:	5d                   	pop    %ebp
+  80226f:	c3                   	ret
+  802270:	b8 01 00 00 00       	mov    $0x1,%eax
+  802275:	0f a2                	cpuid
+		return 0;
+  802277:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80227c:	f6 c6 08             	test   $0x8,%dh
+  80227f:	74 15                	je     802296 <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802281:	89 c2                	mov    %eax,%edx
+  802283:	c1 ea 08             	shr    $0x8,%edx
+  802286:	83 e2 0f             	and    $0xf,%edx
+  802289:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80228e:	83 fa 06             	cmp    $0x6,%edx
+  802291:	74 0e                	je     8022a1 <sys_futex_wake+0x70>
+  802293:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802296:	0f b6 c9             	movzbl %cl,%ecx
+  802299:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80229f:	eb 9f                	jmp    802240 <sys_futex_wake+0xf>
+  8022a1:	89 c2                	mov    %eax,%edx
+  8022a3:	c1 ea 04             	shr    $0x4,%edx
+  8022a6:	83 e2 0f             	and    $0xf,%edx
+  8022a9:	83 fa 02             	cmp    $0x2,%edx
+  8022ac:	77 e5                	ja     802293 <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  8022ae:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022b1:	83 f8 02             	cmp    $0x2,%eax
+  8022b4:	0f 97 c1             	seta   %cl
+  8022b7:	0f b6 c9             	movzbl %cl,%ecx
+  8022ba:	eb d7                	jmp    802293 <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  8022bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022c1:	b8 21 00 00 00       	mov    $0x21,%eax
+  8022c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022cc:	89 df                	mov    %ebx,%edi
+  8022ce:	89 de                	mov    %ebx,%esi
+  8022d0:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  8022d2:	eb 97                	jmp    80226b <sys_futex_wake+0x3a>
+
+008022d4 <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  8022d4:	55                   	push   %ebp
+  8022d5:	89 e5                	mov    %esp,%ebp
+  8022d7:	57                   	push   %edi
+  8022d8:	56                   	push   %esi
+  8022d9:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8022da:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8022e1:	78 2e                	js     802311 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  8022e3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8022ea:	74 71                	je     80235d <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  8022ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022f1:	b8 22 00 00 00       	mov    $0x22,%eax
+  8022f6:	89 d1                	mov    %edx,%ecx
+  8022f8:	89 d3                	mov    %edx,%ebx
+  8022fa:	89 d7                	mov    %edx,%edi
+  8022fc:	89 d6                	mov    %edx,%esi
+  8022fe:	55                   	push   %ebp
+  8022ff:	68 08 23 80 00       	push   $0x802308
+  802304:	89 e5                	mov    %esp,%ebp
+  802306:	0f 34                	sysenter
+  802308:	83 c4 04             	add    $0x4,%esp
+  80230b:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  80230c:	5b                   	pop    %ebx
+  80230d:	5e                   	pop    %esi
+  80230e:	5f                   	pop    %edi
+  80230f:	5d                   	pop    %ebp
+  802310:	c3                   	ret
+  802311:	b8 01 00 00 00       	mov    $0x1,%eax
+  802316:	0f a2                	cpuid
+		return 0;
+  802318:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80231d:	f6 c6 08             	test   $0x8,%dh
+  802320:	74 15                	je     802337 <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802322:	89 c2                	mov    %eax,%edx
+  802324:	c1 ea 08             	shr    $0x8,%edx
+  802327:	83 e2 0f             	and    $0xf,%edx
+  80232a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80232f:	83 fa 06             	cmp    $0x6,%edx
+  802332:	74 0e                	je     802342 <sys_ep_create+0x6e>
+  802334:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802337:	0f b6 c9             	movzbl %cl,%ecx
+  80233a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802340:	eb a1                	jmp    8022e3 <sys_ep_create+0xf>
+  802342:	89 c2                	mov    %eax,%edx
+  802344:	c1 ea 04             	shr    $0x4,%edx
+  802347:	83 e2 0f             	and    $0xf,%edx
+  80234a:	83 fa 02             	cmp    $0x2,%edx
+  80234d:	77 e5                	ja     802334 <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  80234f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802352:	83 f8 02             	cmp    $0x2,%eax
+  802355:	0f 97 c1             	seta   %cl
+  802358:	0f b6 c9             	movzbl %cl,%ecx
+  80235b:	eb d7                	jmp    802334 <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  80235d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802362:	b8 22 00 00 00       	mov    $0x22,%eax
+  802367:	89 d1                	mov    %edx,%ecx
+  802369:	89 d3                	mov    %edx,%ebx
+  80236b:	89 d7                	mov    %edx,%edi
+  80236d:	89 d6                	mov    %edx,%esi
+  80236f:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  802371:	eb 99                	jmp    80230c <sys_ep_create+0x38>
+
+00802373 <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  802373:	55                   	push   %ebp
+  802374:	89 e5                	mov    %esp,%ebp
+  802376:	57                   	push   %edi
+  802377:	56                   	push   %esi
+  802378:	53                   	push   %ebx
+  802379:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80237c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802383:	78 36                	js     8023bb <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  802385:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80238c:	74 79                	je     802407 <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  80238e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802391:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802396:	b8 23 00 00 00       	mov    $0x23,%eax
+  80239b:	89 cb                	mov    %ecx,%ebx
+  80239d:	89 cf                	mov    %ecx,%edi
+  80239f:	89 ce                	mov    %ecx,%esi
+  8023a1:	55                   	push   %ebp
+  8023a2:	68 ab 23 80 00       	push   $0x8023ab
+  8023a7:	89 e5                	mov    %esp,%ebp
+  8023a9:	0f 34                	sysenter
+  8023ab:	83 c4 04             	add    $0x4,%esp
+  8023ae:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8023af:	85 c0                	test   %eax,%eax
+  8023b1:	7f 6b                	jg     80241e <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  8023b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023b6:	5b                   	pop    %ebx
+  8023b7:	5e                   	pop    %esi
+  8023b8:	5f                   	pop    %edi
+  8023b9:	5d                   	pop    %ebp
+  8023ba:	c3                   	ret
+  8023bb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023c0:	0f a2                	cpuid
+		return 0;
+  8023c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8023c7:	f6 c6 08             	test   $0x8,%dh
+  8023ca:	74 15                	je     8023e1 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023cc:	89 c2                	mov    %eax,%edx
+  8023ce:	c1 ea 08             	shr    $0x8,%edx
+  8023d1:	83 e2 0f             	and    $0xf,%edx
+  8023d4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8023d9:	83 fa 06             	cmp    $0x6,%edx
+  8023dc:	74 0e                	je     8023ec <sys_ep_destroy+0x79>
+  8023de:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8023e1:	0f b6 c9             	movzbl %cl,%ecx
+  8023e4:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8023ea:	eb 99                	jmp    802385 <sys_ep_destroy+0x12>
+  8023ec:	89 c2                	mov    %eax,%edx
+  8023ee:	c1 ea 04             	shr    $0x4,%edx
+  8023f1:	83 e2 0f             	and    $0xf,%edx
+  8023f4:	83 fa 02             	cmp    $0x2,%edx
+  8023f7:	77 e5                	ja     8023de <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  8023f9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023fc:	83 f8 02             	cmp    $0x2,%eax
+  8023ff:	0f 97 c1             	seta   %cl
+  802402:	0f b6 c9             	movzbl %cl,%ecx
+  802405:	eb d7                	jmp    8023de <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  802407:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80240c:	b8 23 00 00 00       	mov    $0x23,%eax
+  802411:	8b 55 08             	mov    0x8(%ebp),%edx
+  802414:	89 cb                	mov    %ecx,%ebx
+  802416:	89 cf                	mov    %ecx,%edi
+  802418:	89 ce                	mov    %ecx,%esi
+  80241a:	cd 30                	int    $0x30
+  80241c:	eb 91                	jmp    8023af <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80241e:	83 ec 0c             	sub    $0xc,%esp
+  802421:	50                   	push   %eax
+  802422:	6a 23                	push   $0x23
+  802424:	68 b9 2c 80 00       	push   $0x802cb9
+  802429:	6a 4a                	push   $0x4a
+  80242b:	68 d6 2c 80 00       	push   $0x802cd6
+  802430:	e8 02 dd ff ff       	call   800137 <_panic>
+
+00802435 <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  802435:	55                   	push   %ebp
+  802436:	89 e5                	mov    %esp,%ebp
+  802438:	57                   	push   %edi
+  802439:	56                   	push   %esi
+  80243a:	53                   	push   %ebx
+  80243b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80243e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802445:	78 37                	js     80247e <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  802447:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80244e:	74 7a                	je     8024ca <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  802450:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802455:	8b 55 08             	mov    0x8(%ebp),%edx
+  802458:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80245b:	b8 24 00 00 00       	mov    $0x24,%eax
+  802460:	89 df                	mov    %ebx,%edi
+  802462:	89 de                	mov    %ebx,%esi
+  802464:	55                   	push   %ebp
+  802465:	68 6e 24 80 00       	push   $0x80246e
+  80246a:	89 e5                	mov    %esp,%ebp
+  80246c:	0f 34                	sysenter
+  80246e:	83 c4 04             	add    $0x4,%esp
+  802471:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802472:	85 c0                	test   %eax,%eax
+  802474:	7f 6c                	jg     8024e2 <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  802476:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802479:	5b                   	pop    %ebx
+  80247a:	5e                   	pop    %esi
+  80247b:	5f                   	pop    %edi
+  80247c:	5d                   	pop    %ebp
+  80247d:	c3                   	ret
+  80247e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802483:	0f a2                	cpuid
+		return 0;
+  802485:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80248a:	f6 c6 08             	test   $0x8,%dh
+  80248d:	74 15                	je     8024a4 <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80248f:	89 c2                	mov    %eax,%edx
+  802491:	c1 ea 08             	shr    $0x8,%edx
+  802494:	83 e2 0f             	and    $0xf,%edx
+  802497:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80249c:	83 fa 06             	cmp    $0x6,%edx
+  80249f:	74 0e                	je     8024af <sys_ep_grant+0x7a>
+  8024a1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8024a4:	0f b6 c9             	movzbl %cl,%ecx
+  8024a7:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8024ad:	eb 98                	jmp    802447 <sys_ep_grant+0x12>
+  8024af:	89 c2                	mov    %eax,%edx
+  8024b1:	c1 ea 04             	shr    $0x4,%edx
+  8024b4:	83 e2 0f             	and    $0xf,%edx
+  8024b7:	83 fa 02             	cmp    $0x2,%edx
+  8024ba:	77 e5                	ja     8024a1 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  8024bc:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8024bf:	83 f8 02             	cmp    $0x2,%eax
+  8024c2:	0f 97 c1             	seta   %cl
+  8024c5:	0f b6 c9             	movzbl %cl,%ecx
+  8024c8:	eb d7                	jmp    8024a1 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  8024ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024cf:	b8 24 00 00 00       	mov    $0x24,%eax
+  8024d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024da:	89 df                	mov    %ebx,%edi
+  8024dc:	89 de                	mov    %ebx,%esi
+  8024de:	cd 30                	int    $0x30
+  8024e0:	eb 90                	jmp    802472 <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8024e2:	83 ec 0c             	sub    $0xc,%esp
+  8024e5:	50                   	push   %eax
+  8024e6:	6a 24                	push   $0x24
+  8024e8:	68 b9 2c 80 00       	push   $0x802cb9
+  8024ed:	6a 4a                	push   $0x4a
+  8024ef:	68 d6 2c 80 00       	push   $0x802cd6
+  8024f4:	e8 3e dc ff ff       	call   800137 <_panic>
+
+008024f9 <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  8024f9:	55                   	push   %ebp
+  8024fa:	89 e5                	mov    %esp,%ebp
+  8024fc:	57                   	push   %edi
+  8024fd:	56                   	push   %esi
+  8024fe:	53                   	push   %ebx
+  8024ff:	83 ec 20             	sub    $0x20,%esp
+  802502:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  802505:	8b 10                	mov    (%eax),%edx
+  802507:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  80250a:	8b 50 04             	mov    0x4(%eax),%edx
+  80250d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802510:	8b 50 08             	mov    0x8(%eax),%edx
+  802513:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  802516:	8b 50 0c             	mov    0xc(%eax),%edx
+  802519:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  80251c:	8b 40 10             	mov    0x10(%eax),%eax
+  80251f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  802522:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  802525:	8b 55 08             	mov    0x8(%ebp),%edx
+  802528:	b8 25 00 00 00       	mov    $0x25,%eax
+  80252d:	55                   	push   %ebp
+  80252e:	56                   	push   %esi
+  80252f:	8b 0e                	mov    (%esi),%ecx
+  802531:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802534:	8b 7e 08             	mov    0x8(%esi),%edi
+  802537:	8b 6e 10             	mov    0x10(%esi),%ebp
+  80253a:	8b 76 0c             	mov    0xc(%esi),%esi
+  80253d:	cd 30                	int    $0x30
+  80253f:	87 34 24             	xchg   %esi,(%esp)
+  802542:	89 0e                	mov    %ecx,(%esi)
+  802544:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802547:	89 7e 08             	mov    %edi,0x8(%esi)
+  80254a:	89 6e 10             	mov    %ebp,0x10(%esi)
+  80254d:	8f 46 0c             	pop    0xc(%esi)
+  802550:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  802551:	83 c4 20             	add    $0x20,%esp
+  802554:	5b                   	pop    %ebx
+  802555:	5e                   	pop    %esi
+  802556:	5f                   	pop    %edi
+  802557:	5d                   	pop    %ebp
+  802558:	c3                   	ret
+
+00802559 <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  802559:	55                   	push   %ebp
+  80255a:	89 e5                	mov    %esp,%ebp
+  80255c:	57                   	push   %edi
+  80255d:	56                   	push   %esi
+  80255e:	53                   	push   %ebx
+  80255f:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  802562:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802565:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  802567:	8b 55 08             	mov    0x8(%ebp),%edx
+  80256a:	b8 26 00 00 00       	mov    $0x26,%eax
+  80256f:	55                   	push   %ebp
+  802570:	56                   	push   %esi
+  802571:	8b 0e                	mov    (%esi),%ecx
+  802573:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802576:	8b 7e 08             	mov    0x8(%esi),%edi
+  802579:	8b 6e 10             	mov    0x10(%esi),%ebp
+  80257c:	8b 76 0c             	mov    0xc(%esi),%esi
+  80257f:	cd 30                	int    $0x30
+  802581:	87 34 24             	xchg   %esi,(%esp)
+  802584:	89 0e                	mov    %ecx,(%esi)
+  802586:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802589:	89 7e 08             	mov    %edi,0x8(%esi)
+  80258c:	89 6e 10             	mov    %ebp,0x10(%esi)
+  80258f:	8f 46 0c             	pop    0xc(%esi)
+  802592:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  802593:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  802597:	74 0f                	je     8025a8 <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  802599:	85 c0                	test   %eax,%eax
+  80259b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025a0:	0f 48 d1             	cmovs  %ecx,%edx
+  8025a3:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8025a6:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  8025a8:	5b                   	pop    %ebx
+  8025a9:	5e                   	pop    %esi
+  8025aa:	5f                   	pop    %edi
+  8025ab:	5d                   	pop    %ebp
+  8025ac:	c3                   	ret
+
+008025ad <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  8025ad:	55                   	push   %ebp
+  8025ae:	89 e5                	mov    %esp,%ebp
+  8025b0:	57                   	push   %edi
+  8025b1:	56                   	push   %esi
+  8025b2:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8025b3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8025ba:	78 2f                	js     8025eb <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  8025bc:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8025c3:	74 72                	je     802637 <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  8025c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025cd:	b8 27 00 00 00       	mov    $0x27,%eax
+  8025d2:	89 cb                	mov    %ecx,%ebx
+  8025d4:	89 cf                	mov    %ecx,%edi
+  8025d6:	89 ce                	mov    %ecx,%esi
+  8025d8:	55                   	push   %ebp
+  8025d9:	68 e2 25 80 00       	push   $0x8025e2
+  8025de:	89 e5                	mov    %esp,%ebp
+  8025e0:	0f 34                	sysenter
+  8025e2:	83 c4 04             	add    $0x4,%esp
+  8025e5:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  8025e6:	5b                   	pop    %ebx
+  8025e7:	5e                   	pop    %esi
+  8025e8:	5f                   	pop    %edi
+  8025e9:	5d                   	pop    %ebp
+  8025ea:	c3                   	ret
+  8025eb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025f0:	0f a2                	cpuid
+		return 0;
+  8025f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8025f7:	f6 c6 08             	test   $0x8,%dh
+  8025fa:	74 15                	je     802611 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025fc:	89 c2                	mov    %eax,%edx
+  8025fe:	c1 ea 08             	shr    $0x8,%edx
+  802601:	83 e2 0f             	and    $0xf,%edx
+  802604:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802609:	83 fa 06             	cmp    $0x6,%edx
+  80260c:	74 0e                	je     80261c <sys_sysring_setup+0x6f>
+  80260e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802611:	0f b6 c9             	movzbl %cl,%ecx
+  802614:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80261a:	eb a0                	jmp    8025bc <sys_sysring_setup+0xf>
+  80261c:	89 c2                	mov    %eax,%edx
+  80261e:	c1 ea 04             	shr    $0x4,%edx
+  802621:	83 e2 0f             	and    $0xf,%edx
+  802624:	83 fa 02             	cmp    $0x2,%edx
+  802627:	77 e5                	ja     80260e <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  802629:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80262c:	83 f8 02             	cmp    $0x2,%eax
+  80262f:	0f 97 c1             	seta   %cl
+  802632:	0f b6 c9             	movzbl %cl,%ecx
+  802635:	eb d7                	jmp    80260e <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  802637:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80263c:	b8 27 00 00 00       	mov    $0x27,%eax
+  802641:	8b 55 08             	mov    0x8(%ebp),%edx
+  802644:	89 cb                	mov    %ecx,%ebx
+  802646:	89 cf                	mov    %ecx,%edi
+  802648:	89 ce                	mov    %ecx,%esi
+  80264a:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  80264c:	eb 98                	jmp    8025e6 <sys_sysring_setup+0x39>
+
+0080264e <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  80264e:	55                   	push   %ebp
+  80264f:	89 e5                	mov    %esp,%ebp
+  802651:	57                   	push   %edi
+  802652:	56                   	push   %esi
+  802653:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802654:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80265b:	78 2e                	js     80268b <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  80265d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802664:	74 71                	je     8026d7 <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  802666:	ba 00 00 00 00       	mov    $0x0,%edx
+  80266b:	b8 28 00 00 00       	mov    $0x28,%eax
+  802670:	89 d1                	mov    %edx,%ecx
+  802672:	89 d3                	mov    %edx,%ebx
+  802674:	89 d7                	mov    %edx,%edi
+  802676:	89 d6                	mov    %edx,%esi
+  802678:	55                   	push   %ebp
+  802679:	68 82 26 80 00       	push   $0x802682
+  80267e:	89 e5                	mov    %esp,%ebp
+  802680:	0f 34                	sysenter
+  802682:	83 c4 04             	add    $0x4,%esp
+  802685:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  802686:	5b                   	pop    %ebx
+  802687:	5e                   	pop    %esi
+  802688:	5f                   	pop    %edi
+  802689:	5d                   	pop    %ebp
+  80268a:	c3                   	ret
+  80268b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802690:	0f a2                	cpuid
+		return 0;
+  802692:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802697:	f6 c6 08             	test   $0x8,%dh
+  80269a:	74 15                	je     8026b1 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80269c:	89 c2                	mov    %eax,%edx
+  80269e:	c1 ea 08             	shr    $0x8,%edx
+  8026a1:	83 e2 0f             	and    $0xf,%edx
+  8026a4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8026a9:	83 fa 06             	cmp    $0x6,%edx
+  8026ac:	74 0e                	je     8026bc <sys_sysring_enter+0x6e>
+  8026ae:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8026b1:	0f b6 c9             	movzbl %cl,%ecx
+  8026b4:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8026ba:	eb a1                	jmp    80265d <sys_sysring_enter+0xf>
+  8026bc:	89 c2                	mov    %eax,%edx
+  8026be:	c1 ea 04             	shr    $0x4,%edx
+  8026c1:	83 e2 0f             	and    $0xf,%edx
+  8026c4:	83 fa 02             	cmp    $0x2,%edx
+  8026c7:	77 e5                	ja     8026ae <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  8026c9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8026cc:	83 f8 02             	cmp    $0x2,%eax
+  8026cf:	0f 97 c1             	seta   %cl
+  8026d2:	0f b6 c9             	movzbl %cl,%ecx
+  8026d5:	eb d7                	jmp    8026ae <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  8026d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026dc:	b8 28 00 00 00       	mov    $0x28,%eax
+  8026e1:	89 d1                	mov    %edx,%ecx
+  8026e3:	89 d3                	mov    %edx,%ebx
+  8026e5:	89 d7                	mov    %edx,%edi
+  8026e7:	89 d6                	mov    %edx,%esi
+  8026e9:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  8026eb:	eb 99                	jmp    802686 <sys_sysring_enter+0x38>
+
+008026ed <dm>:
+  8026ed:	55                   	push   %ebp
+  8026ee:	57                   	push   %edi
+  8026ef:	56                   	push   %esi
+  8026f0:	53                   	push   %ebx
+  8026f1:	83 ec 24             	sub    $0x24,%esp
+  8026f4:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8026f8:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8026fc:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802700:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802704:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802708:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80270c:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802710:	b8 00 00 00 00       	mov    $0x0,%eax
+  802715:	ba 00 00 00 00       	mov    $0x0,%edx
+  80271a:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80271f:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802726:	00 
+  802727:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80272e:	00 
+  80272f:	89 fb                	mov    %edi,%ebx
+  802731:	eb 08                	jmp    80273b <dm+0x4e>
+  802733:	83 e9 01             	sub    $0x1,%ecx
+  802736:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802739:	74 68                	je     8027a3 <dm+0xb6>
+  80273b:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80273f:	01 c0                	add    %eax,%eax
+  802741:	89 c6                	mov    %eax,%esi
+  802743:	89 d7                	mov    %edx,%edi
+  802745:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802749:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80274d:	0f ad d0             	shrd   %cl,%edx,%eax
+  802750:	d3 ea                	shr    %cl,%edx
+  802752:	f6 c1 20             	test   $0x20,%cl
+  802755:	74 04                	je     80275b <dm+0x6e>
+  802757:	89 d0                	mov    %edx,%eax
+  802759:	31 d2                	xor    %edx,%edx
+  80275b:	83 e0 01             	and    $0x1,%eax
+  80275e:	89 04 24             	mov    %eax,(%esp)
+  802761:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802768:	00 
+  802769:	8b 04 24             	mov    (%esp),%eax
+  80276c:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802770:	09 f0                	or     %esi,%eax
+  802772:	09 fa                	or     %edi,%edx
+  802774:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802778:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80277c:	39 f0                	cmp    %esi,%eax
+  80277e:	89 d5                	mov    %edx,%ebp
+  802780:	19 fd                	sbb    %edi,%ebp
+  802782:	72 af                	jb     802733 <dm+0x46>
+  802784:	29 f0                	sub    %esi,%eax
+  802786:	19 fa                	sbb    %edi,%edx
+  802788:	89 cf                	mov    %ecx,%edi
+  80278a:	c1 ef 05             	shr    $0x5,%edi
+  80278d:	83 e7 01             	and    $0x1,%edi
+  802790:	89 fe                	mov    %edi,%esi
+  802792:	83 f6 01             	xor    $0x1,%esi
+  802795:	d3 e6                	shl    %cl,%esi
+  802797:	d3 e7                	shl    %cl,%edi
+  802799:	09 74 24 18          	or     %esi,0x18(%esp)
+  80279d:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8027a1:	eb 90                	jmp    802733 <dm+0x46>
+  8027a3:	85 db                	test   %ebx,%ebx
+  8027a5:	74 05                	je     8027ac <dm+0xbf>
+  8027a7:	89 03                	mov    %eax,(%ebx)
+  8027a9:	89 53 04             	mov    %edx,0x4(%ebx)
+  8027ac:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8027b0:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8027b4:	83 c4 24             	add    $0x24,%esp
+  8027b7:	5b                   	pop    %ebx
+  8027b8:	5e                   	pop    %esi
+  8027b9:	5f                   	pop    %edi
+  8027ba:	5d                   	pop    %ebp
+  8027bb:	c3                   	ret
+
+008027bc <__udivdi3>:
+  8027bc:	83 ec 08             	sub    $0x8,%esp
+  8027bf:	6a 00                	push   $0x0
+  8027c1:	ff 74 24 1c          	push   0x1c(%esp)
+  8027c5:	ff 74 24 1c          	push   0x1c(%esp)
+  8027c9:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8027cd:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8027d1:	e8 17 ff ff ff       	call   8026ed <dm>
+  8027d6:	83 c4 14             	add    $0x14,%esp
+  8027d9:	c3                   	ret
+
+008027da <__umoddi3>:
+  8027da:	83 ec 18             	sub    $0x18,%esp
+  8027dd:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8027e1:	50                   	push   %eax
+  8027e2:	ff 74 24 2c          	push   0x2c(%esp)
+  8027e6:	ff 74 24 2c          	push   0x2c(%esp)
+  8027ea:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8027ee:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8027f2:	e8 f6 fe ff ff       	call   8026ed <dm>
+  8027f7:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8027fb:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8027ff:	83 c4 24             	add    $0x24,%esp
+  802802:	c3                   	ret
+
+00802803 <__divdi3>:
+  802803:	53                   	push   %ebx
+  802804:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802808:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80280c:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  802810:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  802814:	85 d2                	test   %edx,%edx
+  802816:	78 15                	js     80282d <__divdi3+0x2a>
+  802818:	85 db                	test   %ebx,%ebx
+  80281a:	78 34                	js     802850 <__divdi3+0x4d>
+  80281c:	83 ec 04             	sub    $0x4,%esp
+  80281f:	6a 00                	push   $0x0
+  802821:	53                   	push   %ebx
+  802822:	51                   	push   %ecx
+  802823:	e8 c5 fe ff ff       	call   8026ed <dm>
+  802828:	83 c4 10             	add    $0x10,%esp
+  80282b:	eb 21                	jmp    80284e <__divdi3+0x4b>
+  80282d:	f7 d8                	neg    %eax
+  80282f:	83 d2 00             	adc    $0x0,%edx
+  802832:	f7 da                	neg    %edx
+  802834:	85 db                	test   %ebx,%ebx
+  802836:	78 30                	js     802868 <__divdi3+0x65>
+  802838:	83 ec 04             	sub    $0x4,%esp
+  80283b:	6a 00                	push   $0x0
+  80283d:	53                   	push   %ebx
+  80283e:	51                   	push   %ecx
+  80283f:	e8 a9 fe ff ff       	call   8026ed <dm>
+  802844:	83 c4 10             	add    $0x10,%esp
+  802847:	f7 d8                	neg    %eax
+  802849:	83 d2 00             	adc    $0x0,%edx
+  80284c:	f7 da                	neg    %edx
+  80284e:	5b                   	pop    %ebx
+  80284f:	c3                   	ret
+  802850:	83 ec 04             	sub    $0x4,%esp
+  802853:	6a 00                	push   $0x0
+  802855:	f7 d9                	neg    %ecx
+  802857:	83 d3 00             	adc    $0x0,%ebx
+  80285a:	f7 db                	neg    %ebx
+  80285c:	53                   	push   %ebx
+  80285d:	51                   	push   %ecx
+  80285e:	e8 8a fe ff ff       	call   8026ed <dm>
+  802863:	83 c4 10             	add    $0x10,%esp
+  802866:	eb df                	jmp    802847 <__divdi3+0x44>
+  802868:	83 ec 04             	sub    $0x4,%esp
+  80286b:	6a 00                	push   $0x0
+  80286d:	f7 d9                	neg    %ecx
+  80286f:	83 d3 00             	adc    $0x0,%ebx
+  802872:	f7 db                	neg    %ebx
+  802874:	53                   	push   %ebx
+  802875:	51                   	push   %ecx
+  802876:	e8 72 fe ff ff       	call   8026ed <dm>
+  80287b:	83 c4 10             	add    $0x10,%esp
+  80287e:	eb ce                	jmp    80284e <__divdi3+0x4b>
+
+00802880 <__moddi3>:
+  802880:	55                   	push   %ebp
+  802881:	57                   	push   %edi
+  802882:	56                   	push   %esi
+  802883:	53                   	push   %ebx
+  802884:	83 ec 18             	sub    $0x18,%esp
+  802887:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  80288b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80288f:	89 f1                	mov    %esi,%ecx
+  802891:	f7 d9                	neg    %ecx
+  802893:	89 da                	mov    %ebx,%edx
+  802895:	83 d2 00             	adc    $0x0,%edx
+  802898:	f7 da                	neg    %edx
+  80289a:	0f 48 ce             	cmovs  %esi,%ecx
+  80289d:	0f 48 d3             	cmovs  %ebx,%edx
+  8028a0:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8028a4:	50                   	push   %eax
+  8028a5:	8b 74 24 38          	mov    0x38(%esp),%esi
+  8028a9:	f7 de                	neg    %esi
+  8028ab:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  8028af:	83 d0 00             	adc    $0x0,%eax
+  8028b2:	f7 d8                	neg    %eax
+  8028b4:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  8028b9:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  8028be:	50                   	push   %eax
+  8028bf:	56                   	push   %esi
+  8028c0:	89 c8                	mov    %ecx,%eax
+  8028c2:	e8 26 fe ff ff       	call   8026ed <dm>
+  8028c7:	83 c4 10             	add    $0x10,%esp
+  8028ca:	85 db                	test   %ebx,%ebx
+  8028cc:	78 10                	js     8028de <__moddi3+0x5e>
+  8028ce:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8028d2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8028d6:	83 c4 14             	add    $0x14,%esp
+  8028d9:	5b                   	pop    %ebx
+  8028da:	5e                   	pop    %esi
+  8028db:	5f                   	pop    %edi
+  8028dc:	5d                   	pop    %ebp
+  8028dd:	c3                   	ret
+  8028de:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8028e2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8028e6:	f7 d8                	neg    %eax
+  8028e8:	83 d2 00             	adc    $0x0,%edx
+  8028eb:	f7 da                	neg    %edx
+  8028ed:	eb e7                	jmp    8028d6 <__moddi3+0x56>
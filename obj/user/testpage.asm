@@ -0,0 +1,5649 @@
+
+obj/user/testpage:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 de 06 00 00       	call   80070f <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+static char buf[PGSIZE] __attribute__((aligned(PGSIZE)));
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 0c             	sub    $0xc,%esp
+	binaryname = "testpage";
+  800039:	c7 05 00 40 80 00 40 	movl   $0x802f40,0x804000
+  800040:	2f 80 00 
+
+	// sys_page_alloc error cases
+	assert(sys_page_alloc(-1, VA, PTE_U|PTE_P) == -E_BAD_ENV);
+  800043:	6a 05                	push   $0x5
+  800045:	68 00 00 00 a0       	push   $0xa0000000
+  80004a:	6a ff                	push   $0xffffffff
+  80004c:	e8 50 16 00 00       	call   8016a1 <sys_page_alloc>
+  800051:	83 c4 10             	add    $0x10,%esp
+  800054:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  800057:	0f 85 f2 03 00 00    	jne    80044f <umain+0x41c>
+	assert(sys_page_alloc(0, (void *)UTOP + PGSIZE, PTE_U|PTE_P) == -E_INVAL);
+  80005d:	83 ec 04             	sub    $0x4,%esp
+  800060:	6a 05                	push   $0x5
+  800062:	68 00 10 c0 ee       	push   $0xeec01000
+  800067:	6a 00                	push   $0x0
+  800069:	e8 33 16 00 00       	call   8016a1 <sys_page_alloc>
+  80006e:	83 c4 10             	add    $0x10,%esp
+  800071:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800074:	0f 85 eb 03 00 00    	jne    800465 <umain+0x432>
+	assert(sys_page_alloc(0, VA + 1, PTE_U|PTE_P) == -E_INVAL);
+  80007a:	83 ec 04             	sub    $0x4,%esp
+  80007d:	6a 05                	push   $0x5
+  80007f:	68 01 00 00 a0       	push   $0xa0000001
+  800084:	6a 00                	push   $0x0
+  800086:	e8 16 16 00 00       	call   8016a1 <sys_page_alloc>
+  80008b:	83 c4 10             	add    $0x10,%esp
+  80008e:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800091:	0f 85 e4 03 00 00    	jne    80047b <umain+0x448>
+	assert(sys_page_alloc(0, VA, PTE_U|PTE_P|PTE_G) == -E_INVAL);
+  800097:	83 ec 04             	sub    $0x4,%esp
+  80009a:	68 05 01 00 00       	push   $0x105
+  80009f:	68 00 00 00 a0       	push   $0xa0000000
+  8000a4:	6a 00                	push   $0x0
+  8000a6:	e8 f6 15 00 00       	call   8016a1 <sys_page_alloc>
+  8000ab:	83 c4 10             	add    $0x10,%esp
+  8000ae:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  8000b1:	0f 85 da 03 00 00    	jne    800491 <umain+0x45e>
+	assert(sys_page_alloc(0, VA, 0) == -E_INVAL);
+  8000b7:	83 ec 04             	sub    $0x4,%esp
+  8000ba:	6a 00                	push   $0x0
+  8000bc:	68 00 00 00 a0       	push   $0xa0000000
+  8000c1:	6a 00                	push   $0x0
+  8000c3:	e8 d9 15 00 00       	call   8016a1 <sys_page_alloc>
+  8000c8:	83 c4 10             	add    $0x10,%esp
+  8000cb:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  8000ce:	0f 85 d3 03 00 00    	jne    8004a7 <umain+0x474>
+
+	// sys_page_map error cases
+	assert(sys_page_map(-1, buf, 0, buf, PTE_U|PTE_P) == -E_BAD_ENV);
+  8000d4:	83 ec 0c             	sub    $0xc,%esp
+  8000d7:	6a 05                	push   $0x5
+  8000d9:	68 00 50 80 00       	push   $0x805000
+  8000de:	6a 00                	push   $0x0
+  8000e0:	68 00 50 80 00       	push   $0x805000
+  8000e5:	6a ff                	push   $0xffffffff
+  8000e7:	e8 7b 16 00 00       	call   801767 <sys_page_map>
+  8000ec:	83 c4 20             	add    $0x20,%esp
+  8000ef:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8000f2:	0f 85 c5 03 00 00    	jne    8004bd <umain+0x48a>
+	assert(sys_page_map(0, buf, -1, buf, PTE_U|PTE_P) == -E_BAD_ENV);
+  8000f8:	83 ec 0c             	sub    $0xc,%esp
+  8000fb:	6a 05                	push   $0x5
+  8000fd:	68 00 50 80 00       	push   $0x805000
+  800102:	6a ff                	push   $0xffffffff
+  800104:	68 00 50 80 00       	push   $0x805000
+  800109:	6a 00                	push   $0x0
+  80010b:	e8 57 16 00 00       	call   801767 <sys_page_map>
+  800110:	83 c4 20             	add    $0x20,%esp
+  800113:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  800116:	0f 85 b7 03 00 00    	jne    8004d3 <umain+0x4a0>
+	assert(sys_page_map(0, buf + 1, 0, VA, PTE_U|PTE_P) == -E_INVAL);
+  80011c:	83 ec 0c             	sub    $0xc,%esp
+  80011f:	6a 05                	push   $0x5
+  800121:	68 00 00 00 a0       	push   $0xa0000000
+  800126:	6a 00                	push   $0x0
+  800128:	68 01 50 80 00       	push   $0x805001
+  80012d:	6a 00                	push   $0x0
+  80012f:	e8 33 16 00 00       	call   801767 <sys_page_map>
+  800134:	83 c4 20             	add    $0x20,%esp
+  800137:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  80013a:	0f 85 a9 03 00 00    	jne    8004e9 <umain+0x4b6>
+	assert(sys_page_map(0, (void *)UTOP + PGSIZE, 0, VA, PTE_U|PTE_P) == -E_INVAL);
+  800140:	83 ec 0c             	sub    $0xc,%esp
+  800143:	6a 05                	push   $0x5
+  800145:	68 00 00 00 a0       	push   $0xa0000000
+  80014a:	6a 00                	push   $0x0
+  80014c:	68 00 10 c0 ee       	push   $0xeec01000
+  800151:	6a 00                	push   $0x0
+  800153:	e8 0f 16 00 00       	call   801767 <sys_page_map>
+  800158:	83 c4 20             	add    $0x20,%esp
+  80015b:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  80015e:	0f 85 9b 03 00 00    	jne    8004ff <umain+0x4cc>
+	assert(sys_page_map(0, buf, 0, (void *)UTOP + PGSIZE, PTE_U|PTE_P) == -E_INVAL);
+  800164:	83 ec 0c             	sub    $0xc,%esp
+  800167:	6a 05                	push   $0x5
+  800169:	68 00 10 c0 ee       	push   $0xeec01000
+  80016e:	6a 00                	push   $0x0
+  800170:	68 00 50 80 00       	push   $0x805000
+  800175:	6a 00                	push   $0x0
+  800177:	e8 eb 15 00 00       	call   801767 <sys_page_map>
+  80017c:	83 c4 20             	add    $0x20,%esp
+  80017f:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800182:	0f 85 8d 03 00 00    	jne    800515 <umain+0x4e2>
+	assert(sys_page_map(0, buf, 0, buf - 1, PTE_U|PTE_P) == -E_INVAL);
+  800188:	83 ec 0c             	sub    $0xc,%esp
+  80018b:	6a 05                	push   $0x5
+  80018d:	68 ff 4f 80 00       	push   $0x804fff
+  800192:	6a 00                	push   $0x0
+  800194:	68 00 50 80 00       	push   $0x805000
+  800199:	6a 00                	push   $0x0
+  80019b:	e8 c7 15 00 00       	call   801767 <sys_page_map>
+  8001a0:	83 c4 20             	add    $0x20,%esp
+  8001a3:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  8001a6:	0f 85 7f 03 00 00    	jne    80052b <umain+0x4f8>
+	assert(sys_page_map(0, VA, 0, VA, PTE_U|PTE_P) == -E_INVAL);
+  8001ac:	83 ec 0c             	sub    $0xc,%esp
+  8001af:	6a 05                	push   $0x5
+  8001b1:	68 00 00 00 a0       	push   $0xa0000000
+  8001b6:	6a 00                	push   $0x0
+  8001b8:	68 00 00 00 a0       	push   $0xa0000000
+  8001bd:	6a 00                	push   $0x0
+  8001bf:	e8 a3 15 00 00       	call   801767 <sys_page_map>
+  8001c4:	83 c4 20             	add    $0x20,%esp
+  8001c7:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  8001ca:	0f 85 71 03 00 00    	jne    800541 <umain+0x50e>
+	assert(sys_page_map(0, buf, 0, buf, PTE_U|PTE_P|PTE_G) == -E_INVAL);
+  8001d0:	83 ec 0c             	sub    $0xc,%esp
+  8001d3:	68 05 01 00 00       	push   $0x105
+  8001d8:	68 00 50 80 00       	push   $0x805000
+  8001dd:	6a 00                	push   $0x0
+  8001df:	68 00 50 80 00       	push   $0x805000
+  8001e4:	6a 00                	push   $0x0
+  8001e6:	e8 7c 15 00 00       	call   801767 <sys_page_map>
+  8001eb:	83 c4 20             	add    $0x20,%esp
+  8001ee:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  8001f1:	0f 85 60 03 00 00    	jne    800557 <umain+0x524>
+	assert(sys_page_map(0, buf, 0, buf, 0) == -E_INVAL);
+  8001f7:	83 ec 0c             	sub    $0xc,%esp
+  8001fa:	6a 00                	push   $0x0
+  8001fc:	68 00 50 80 00       	push   $0x805000
+  800201:	6a 00                	push   $0x0
+  800203:	68 00 50 80 00       	push   $0x805000
+  800208:	6a 00                	push   $0x0
+  80020a:	e8 58 15 00 00       	call   801767 <sys_page_map>
+  80020f:	83 c4 20             	add    $0x20,%esp
+  800212:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800215:	0f 85 52 03 00 00    	jne    80056d <umain+0x53a>
+
+	// sys_page_unmap error cases
+	assert(sys_page_unmap(-1, VA) == -E_BAD_ENV);
+  80021b:	83 ec 08             	sub    $0x8,%esp
+  80021e:	68 00 00 00 a0       	push   $0xa0000000
+  800223:	6a ff                	push   $0xffffffff
+  800225:	e8 01 16 00 00       	call   80182b <sys_page_unmap>
+  80022a:	83 c4 10             	add    $0x10,%esp
+  80022d:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  800230:	0f 85 4d 03 00 00    	jne    800583 <umain+0x550>
+	assert(sys_page_unmap(0, (void *)UTOP + PGSIZE) == -E_INVAL);
+  800236:	83 ec 08             	sub    $0x8,%esp
+  800239:	68 00 10 c0 ee       	push   $0xeec01000
+  80023e:	6a 00                	push   $0x0
+  800240:	e8 e6 15 00 00       	call   80182b <sys_page_unmap>
+  800245:	83 c4 10             	add    $0x10,%esp
+  800248:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  80024b:	0f 85 48 03 00 00    	jne    800599 <umain+0x566>
+	assert(sys_page_unmap(0, VA + 1) == -E_INVAL);
+  800251:	83 ec 08             	sub    $0x8,%esp
+  800254:	68 01 00 00 a0       	push   $0xa0000001
+  800259:	6a 00                	push   $0x0
+  80025b:	e8 cb 15 00 00       	call   80182b <sys_page_unmap>
+  800260:	83 c4 10             	add    $0x10,%esp
+  800263:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800266:	0f 85 43 03 00 00    	jne    8005af <umain+0x57c>
+	assert(sys_page_unmap(0, VA) == 0);
+  80026c:	83 ec 08             	sub    $0x8,%esp
+  80026f:	68 00 00 00 a0       	push   $0xa0000000
+  800274:	6a 00                	push   $0x0
+  800276:	e8 b0 15 00 00       	call   80182b <sys_page_unmap>
+  80027b:	83 c4 10             	add    $0x10,%esp
+  80027e:	85 c0                	test   %eax,%eax
+  800280:	0f 85 3f 03 00 00    	jne    8005c5 <umain+0x592>
+
+	// map buf at VA & write to VA
+	assert(!(uvpd[PDX(VA)] & PTE_P) || !(uvpt[PGNUM(VA)] & PTE_P));
+  800286:	a1 00 da 7b ef       	mov    0xef7bda00,%eax
+  80028b:	a8 01                	test   $0x1,%al
+  80028d:	74 0d                	je     80029c <umain+0x269>
+  80028f:	a1 00 00 68 ef       	mov    0xef680000,%eax
+  800294:	a8 01                	test   $0x1,%al
+  800296:	0f 85 3f 03 00 00    	jne    8005db <umain+0x5a8>
+	assert(sys_page_map(0, buf, 0, VA, PTE_U|PTE_P|PTE_W) == 0);
+  80029c:	83 ec 0c             	sub    $0xc,%esp
+  80029f:	6a 07                	push   $0x7
+  8002a1:	68 00 00 00 a0       	push   $0xa0000000
+  8002a6:	6a 00                	push   $0x0
+  8002a8:	68 00 50 80 00       	push   $0x805000
+  8002ad:	6a 00                	push   $0x0
+  8002af:	e8 b3 14 00 00       	call   801767 <sys_page_map>
+  8002b4:	83 c4 20             	add    $0x20,%esp
+  8002b7:	85 c0                	test   %eax,%eax
+  8002b9:	0f 85 32 03 00 00    	jne    8005f1 <umain+0x5be>
+	assert((uvpd[PDX(VA)] & PTE_P) && (uvpt[PGNUM(VA)] & PTE_P));
+  8002bf:	a1 00 da 7b ef       	mov    0xef7bda00,%eax
+  8002c4:	a8 01                	test   $0x1,%al
+  8002c6:	0f 84 3b 03 00 00    	je     800607 <umain+0x5d4>
+  8002cc:	a1 00 00 68 ef       	mov    0xef680000,%eax
+  8002d1:	a8 01                	test   $0x1,%al
+  8002d3:	0f 84 2e 03 00 00    	je     800607 <umain+0x5d4>
+	strcpy(VA, "hello");
+  8002d9:	83 ec 08             	sub    $0x8,%esp
+  8002dc:	68 89 2f 80 00       	push   $0x802f89
+  8002e1:	68 00 00 00 a0       	push   $0xa0000000
+  8002e6:	e8 81 0b 00 00       	call   800e6c <strcpy>
+	assert(strcmp(VA, "hello") == 0);
+  8002eb:	83 c4 08             	add    $0x8,%esp
+  8002ee:	68 89 2f 80 00       	push   $0x802f89
+  8002f3:	68 00 00 00 a0       	push   $0xa0000000
+  8002f8:	e8 20 0c 00 00       	call   800f1d <strcmp>
+  8002fd:	83 c4 10             	add    $0x10,%esp
+  800300:	85 c0                	test   %eax,%eax
+  800302:	0f 85 15 03 00 00    	jne    80061d <umain+0x5ea>
+	assert(strcmp(buf, "hello") == 0);
+  800308:	83 ec 08             	sub    $0x8,%esp
+  80030b:	68 89 2f 80 00       	push   $0x802f89
+  800310:	68 00 50 80 00       	push   $0x805000
+  800315:	e8 03 0c 00 00       	call   800f1d <strcmp>
+  80031a:	83 c4 10             	add    $0x10,%esp
+  80031d:	85 c0                	test   %eax,%eax
+  80031f:	0f 85 0e 03 00 00    	jne    800633 <umain+0x600>
+
+	// swap the pages at buf & VA
+	assert(sys_page_alloc(0, VA, PTE_U|PTE_P|PTE_W) == 0);
+  800325:	83 ec 04             	sub    $0x4,%esp
+  800328:	6a 07                	push   $0x7
+  80032a:	68 00 00 00 a0       	push   $0xa0000000
+  80032f:	6a 00                	push   $0x0
+  800331:	e8 6b 13 00 00       	call   8016a1 <sys_page_alloc>
+  800336:	83 c4 10             	add    $0x10,%esp
+  800339:	85 c0                	test   %eax,%eax
+  80033b:	0f 85 08 03 00 00    	jne    800649 <umain+0x616>
+	assert(*(char *)VA == 0); // new page mapped
+  800341:	80 3d 00 00 00 a0 00 	cmpb   $0x0,0xa0000000
+  800348:	0f 85 11 03 00 00    	jne    80065f <umain+0x62c>
+	strcpy(VA, "world");
+  80034e:	83 ec 08             	sub    $0x8,%esp
+  800351:	68 d3 2f 80 00       	push   $0x802fd3
+  800356:	68 00 00 00 a0       	push   $0xa0000000
+  80035b:	e8 0c 0b 00 00       	call   800e6c <strcpy>
+	assert(strcmp(buf, "hello") == 0);
+  800360:	83 c4 08             	add    $0x8,%esp
+  800363:	68 89 2f 80 00       	push   $0x802f89
+  800368:	68 00 50 80 00       	push   $0x805000
+  80036d:	e8 ab 0b 00 00       	call   800f1d <strcmp>
+  800372:	83 c4 10             	add    $0x10,%esp
+  800375:	85 c0                	test   %eax,%eax
+  800377:	0f 85 f8 02 00 00    	jne    800675 <umain+0x642>
+	assert(strcmp(VA, "world") == 0);
+  80037d:	83 ec 08             	sub    $0x8,%esp
+  800380:	68 d3 2f 80 00       	push   $0x802fd3
+  800385:	68 00 00 00 a0       	push   $0xa0000000
+  80038a:	e8 8e 0b 00 00       	call   800f1d <strcmp>
+  80038f:	83 c4 10             	add    $0x10,%esp
+  800392:	85 c0                	test   %eax,%eax
+  800394:	0f 85 f1 02 00 00    	jne    80068b <umain+0x658>
+	assert(sys_page_map(0, buf, 0, UTEMP, PTE_U|PTE_P|PTE_W) == 0);
+  80039a:	83 ec 0c             	sub    $0xc,%esp
+  80039d:	6a 07                	push   $0x7
+  80039f:	68 00 00 40 00       	push   $0x400000
+  8003a4:	6a 00                	push   $0x0
+  8003a6:	68 00 50 80 00       	push   $0x805000
+  8003ab:	6a 00                	push   $0x0
+  8003ad:	e8 b5 13 00 00       	call   801767 <sys_page_map>
+  8003b2:	83 c4 20             	add    $0x20,%esp
+  8003b5:	85 c0                	test   %eax,%eax
+  8003b7:	0f 85 e4 02 00 00    	jne    8006a1 <umain+0x66e>
+	assert(sys_page_map(0, VA, 0, buf, PTE_U|PTE_P|PTE_W) == 0);
+  8003bd:	83 ec 0c             	sub    $0xc,%esp
+  8003c0:	6a 07                	push   $0x7
+  8003c2:	68 00 50 80 00       	push   $0x805000
+  8003c7:	6a 00                	push   $0x0
+  8003c9:	68 00 00 00 a0       	push   $0xa0000000
+  8003ce:	6a 00                	push   $0x0
+  8003d0:	e8 92 13 00 00       	call   801767 <sys_page_map>
+  8003d5:	83 c4 20             	add    $0x20,%esp
+  8003d8:	85 c0                	test   %eax,%eax
+  8003da:	0f 85 d7 02 00 00    	jne    8006b7 <umain+0x684>
+	assert(sys_page_map(0, UTEMP, 0, VA, PTE_U|PTE_P|PTE_W) == 0);
+  8003e0:	83 ec 0c             	sub    $0xc,%esp
+  8003e3:	6a 07                	push   $0x7
+  8003e5:	68 00 00 00 a0       	push   $0xa0000000
+  8003ea:	6a 00                	push   $0x0
+  8003ec:	68 00 00 40 00       	push   $0x400000
+  8003f1:	6a 00                	push   $0x0
+  8003f3:	e8 6f 13 00 00       	call   801767 <sys_page_map>
+  8003f8:	83 c4 20             	add    $0x20,%esp
+  8003fb:	85 c0                	test   %eax,%eax
+  8003fd:	0f 85 ca 02 00 00    	jne    8006cd <umain+0x69a>
+	assert(strcmp(buf, "world") == 0);
+  800403:	83 ec 08             	sub    $0x8,%esp
+  800406:	68 d3 2f 80 00       	push   $0x802fd3
+  80040b:	68 00 50 80 00       	push   $0x805000
+  800410:	e8 08 0b 00 00       	call   800f1d <strcmp>
+  800415:	83 c4 10             	add    $0x10,%esp
+  800418:	85 c0                	test   %eax,%eax
+  80041a:	0f 85 c3 02 00 00    	jne    8006e3 <umain+0x6b0>
+	assert(strcmp(VA, "hello") == 0);
+  800420:	83 ec 08             	sub    $0x8,%esp
+  800423:	68 89 2f 80 00       	push   $0x802f89
+  800428:	68 00 00 00 a0       	push   $0xa0000000
+  80042d:	e8 eb 0a 00 00       	call   800f1d <strcmp>
+  800432:	83 c4 10             	add    $0x10,%esp
+  800435:	85 c0                	test   %eax,%eax
+  800437:	0f 85 bc 02 00 00    	jne    8006f9 <umain+0x6c6>
+
+	cprintf("page tests passed\n");
+  80043d:	83 ec 0c             	sub    $0xc,%esp
+  800440:	68 0c 30 80 00       	push   $0x80300c
+  800445:	e8 34 04 00 00       	call   80087e <cprintf>
+}
+  80044a:	83 c4 10             	add    $0x10,%esp
+  80044d:	c9                   	leave
+  80044e:	c3                   	ret
+	assert(sys_page_alloc(-1, VA, PTE_U|PTE_P) == -E_BAD_ENV);
+  80044f:	68 20 30 80 00       	push   $0x803020
+  800454:	68 49 2f 80 00       	push   $0x802f49
+  800459:	6a 0d                	push   $0xd
+  80045b:	68 5e 2f 80 00       	push   $0x802f5e
+  800460:	e8 05 03 00 00       	call   80076a <_panic>
+	assert(sys_page_alloc(0, (void *)UTOP + PGSIZE, PTE_U|PTE_P) == -E_INVAL);
+  800465:	68 54 30 80 00       	push   $0x803054
+  80046a:	68 49 2f 80 00       	push   $0x802f49
+  80046f:	6a 0e                	push   $0xe
+  800471:	68 5e 2f 80 00       	push   $0x802f5e
+  800476:	e8 ef 02 00 00       	call   80076a <_panic>
+	assert(sys_page_alloc(0, VA + 1, PTE_U|PTE_P) == -E_INVAL);
+  80047b:	68 98 30 80 00       	push   $0x803098
+  800480:	68 49 2f 80 00       	push   $0x802f49
+  800485:	6a 0f                	push   $0xf
+  800487:	68 5e 2f 80 00       	push   $0x802f5e
+  80048c:	e8 d9 02 00 00       	call   80076a <_panic>
+	assert(sys_page_alloc(0, VA, PTE_U|PTE_P|PTE_G) == -E_INVAL);
+  800491:	68 cc 30 80 00       	push   $0x8030cc
+  800496:	68 49 2f 80 00       	push   $0x802f49
+  80049b:	6a 10                	push   $0x10
+  80049d:	68 5e 2f 80 00       	push   $0x802f5e
+  8004a2:	e8 c3 02 00 00       	call   80076a <_panic>
+	assert(sys_page_alloc(0, VA, 0) == -E_INVAL);
+  8004a7:	68 04 31 80 00       	push   $0x803104
+  8004ac:	68 49 2f 80 00       	push   $0x802f49
+  8004b1:	6a 11                	push   $0x11
+  8004b3:	68 5e 2f 80 00       	push   $0x802f5e
+  8004b8:	e8 ad 02 00 00       	call   80076a <_panic>
+	assert(sys_page_map(-1, buf, 0, buf, PTE_U|PTE_P) == -E_BAD_ENV);
+  8004bd:	68 2c 31 80 00       	push   $0x80312c
+  8004c2:	68 49 2f 80 00       	push   $0x802f49
+  8004c7:	6a 14                	push   $0x14
+  8004c9:	68 5e 2f 80 00       	push   $0x802f5e
+  8004ce:	e8 97 02 00 00       	call   80076a <_panic>
+	assert(sys_page_map(0, buf, -1, buf, PTE_U|PTE_P) == -E_BAD_ENV);
+  8004d3:	68 68 31 80 00       	push   $0x803168
+  8004d8:	68 49 2f 80 00       	push   $0x802f49
+  8004dd:	6a 15                	push   $0x15
+  8004df:	68 5e 2f 80 00       	push   $0x802f5e
+  8004e4:	e8 81 02 00 00       	call   80076a <_panic>
+	assert(sys_page_map(0, buf + 1, 0, VA, PTE_U|PTE_P) == -E_INVAL);
+  8004e9:	68 a4 31 80 00       	push   $0x8031a4
+  8004ee:	68 49 2f 80 00       	push   $0x802f49
+  8004f3:	6a 16                	push   $0x16
+  8004f5:	68 5e 2f 80 00       	push   $0x802f5e
+  8004fa:	e8 6b 02 00 00       	call   80076a <_panic>
+	assert(sys_page_map(0, (void *)UTOP + PGSIZE, 0, VA, PTE_U|PTE_P) == -E_INVAL);
+  8004ff:	68 e0 31 80 00       	push   $0x8031e0
+  800504:	68 49 2f 80 00       	push   $0x802f49
+  800509:	6a 17                	push   $0x17
+  80050b:	68 5e 2f 80 00       	push   $0x802f5e
+  800510:	e8 55 02 00 00       	call   80076a <_panic>
+	assert(sys_page_map(0, buf, 0, (void *)UTOP + PGSIZE, PTE_U|PTE_P) == -E_INVAL);
+  800515:	68 28 32 80 00       	push   $0x803228
+  80051a:	68 49 2f 80 00       	push   $0x802f49
+  80051f:	6a 18                	push   $0x18
+  800521:	68 5e 2f 80 00       	push   $0x802f5e
+  800526:	e8 3f 02 00 00       	call   80076a <_panic>
+	assert(sys_page_map(0, buf, 0, buf - 1, PTE_U|PTE_P) == -E_INVAL);
+  80052b:	68 70 32 80 00       	push   $0x803270
+  800530:	68 49 2f 80 00       	push   $0x802f49
+  800535:	6a 19                	push   $0x19
+  800537:	68 5e 2f 80 00       	push   $0x802f5e
+  80053c:	e8 29 02 00 00       	call   80076a <_panic>
+	assert(sys_page_map(0, VA, 0, VA, PTE_U|PTE_P) == -E_INVAL);
+  800541:	68 ac 32 80 00       	push   $0x8032ac
+  800546:	68 49 2f 80 00       	push   $0x802f49
+  80054b:	6a 1a                	push   $0x1a
+  80054d:	68 5e 2f 80 00       	push   $0x802f5e
+  800552:	e8 13 02 00 00       	call   80076a <_panic>
+	assert(sys_page_map(0, buf, 0, buf, PTE_U|PTE_P|PTE_G) == -E_INVAL);
+  800557:	68 e0 32 80 00       	push   $0x8032e0
+  80055c:	68 49 2f 80 00       	push   $0x802f49
+  800561:	6a 1b                	push   $0x1b
+  800563:	68 5e 2f 80 00       	push   $0x802f5e
+  800568:	e8 fd 01 00 00       	call   80076a <_panic>
+	assert(sys_page_map(0, buf, 0, buf, 0) == -E_INVAL);
+  80056d:	68 1c 33 80 00       	push   $0x80331c
+  800572:	68 49 2f 80 00       	push   $0x802f49
+  800577:	6a 1c                	push   $0x1c
+  800579:	68 5e 2f 80 00       	push   $0x802f5e
+  80057e:	e8 e7 01 00 00       	call   80076a <_panic>
+	assert(sys_page_unmap(-1, VA) == -E_BAD_ENV);
+  800583:	68 48 33 80 00       	push   $0x803348
+  800588:	68 49 2f 80 00       	push   $0x802f49
+  80058d:	6a 1f                	push   $0x1f
+  80058f:	68 5e 2f 80 00       	push   $0x802f5e
+  800594:	e8 d1 01 00 00       	call   80076a <_panic>
+	assert(sys_page_unmap(0, (void *)UTOP + PGSIZE) == -E_INVAL);
+  800599:	68 70 33 80 00       	push   $0x803370
+  80059e:	68 49 2f 80 00       	push   $0x802f49
+  8005a3:	6a 20                	push   $0x20
+  8005a5:	68 5e 2f 80 00       	push   $0x802f5e
+  8005aa:	e8 bb 01 00 00       	call   80076a <_panic>
+	assert(sys_page_unmap(0, VA + 1) == -E_INVAL);
+  8005af:	68 a8 33 80 00       	push   $0x8033a8
+  8005b4:	68 49 2f 80 00       	push   $0x802f49
+  8005b9:	6a 21                	push   $0x21
+  8005bb:	68 5e 2f 80 00       	push   $0x802f5e
+  8005c0:	e8 a5 01 00 00       	call   80076a <_panic>
+	assert(sys_page_unmap(0, VA) == 0);
+  8005c5:	68 6e 2f 80 00       	push   $0x802f6e
+  8005ca:	68 49 2f 80 00       	push   $0x802f49
+  8005cf:	6a 22                	push   $0x22
+  8005d1:	68 5e 2f 80 00       	push   $0x802f5e
+  8005d6:	e8 8f 01 00 00       	call   80076a <_panic>
+	assert(!(uvpd[PDX(VA)] & PTE_P) || !(uvpt[PGNUM(VA)] & PTE_P));
+  8005db:	68 d0 33 80 00       	push   $0x8033d0
+  8005e0:	68 49 2f 80 00       	push   $0x802f49
+  8005e5:	6a 25                	push   $0x25
+  8005e7:	68 5e 2f 80 00       	push   $0x802f5e
+  8005ec:	e8 79 01 00 00       	call   80076a <_panic>
+	assert(sys_page_map(0, buf, 0, VA, PTE_U|PTE_P|PTE_W) == 0);
+  8005f1:	68 08 34 80 00       	push   $0x803408
+  8005f6:	68 49 2f 80 00       	push   $0x802f49
+  8005fb:	6a 26                	push   $0x26
+  8005fd:	68 5e 2f 80 00       	push   $0x802f5e
+  800602:	e8 63 01 00 00       	call   80076a <_panic>
+	assert((uvpd[PDX(VA)] & PTE_P) && (uvpt[PGNUM(VA)] & PTE_P));
+  800607:	68 3c 34 80 00       	push   $0x80343c
+  80060c:	68 49 2f 80 00       	push   $0x802f49
+  800611:	6a 27                	push   $0x27
+  800613:	68 5e 2f 80 00       	push   $0x802f5e
+  800618:	e8 4d 01 00 00       	call   80076a <_panic>
+	assert(strcmp(VA, "hello") == 0);
+  80061d:	68 8f 2f 80 00       	push   $0x802f8f
+  800622:	68 49 2f 80 00       	push   $0x802f49
+  800627:	6a 29                	push   $0x29
+  800629:	68 5e 2f 80 00       	push   $0x802f5e
+  80062e:	e8 37 01 00 00       	call   80076a <_panic>
+	assert(strcmp(buf, "hello") == 0);
+  800633:	68 a8 2f 80 00       	push   $0x802fa8
+  800638:	68 49 2f 80 00       	push   $0x802f49
+  80063d:	6a 2a                	push   $0x2a
+  80063f:	68 5e 2f 80 00       	push   $0x802f5e
+  800644:	e8 21 01 00 00       	call   80076a <_panic>
+	assert(sys_page_alloc(0, VA, PTE_U|PTE_P|PTE_W) == 0);
+  800649:	68 74 34 80 00       	push   $0x803474
+  80064e:	68 49 2f 80 00       	push   $0x802f49
+  800653:	6a 2d                	push   $0x2d
+  800655:	68 5e 2f 80 00       	push   $0x802f5e
+  80065a:	e8 0b 01 00 00       	call   80076a <_panic>
+	assert(*(char *)VA == 0); // new page mapped
+  80065f:	68 c2 2f 80 00       	push   $0x802fc2
+  800664:	68 49 2f 80 00       	push   $0x802f49
+  800669:	6a 2e                	push   $0x2e
+  80066b:	68 5e 2f 80 00       	push   $0x802f5e
+  800670:	e8 f5 00 00 00       	call   80076a <_panic>
+	assert(strcmp(buf, "hello") == 0);
+  800675:	68 a8 2f 80 00       	push   $0x802fa8
+  80067a:	68 49 2f 80 00       	push   $0x802f49
+  80067f:	6a 30                	push   $0x30
+  800681:	68 5e 2f 80 00       	push   $0x802f5e
+  800686:	e8 df 00 00 00       	call   80076a <_panic>
+	assert(strcmp(VA, "world") == 0);
+  80068b:	68 d9 2f 80 00       	push   $0x802fd9
+  800690:	68 49 2f 80 00       	push   $0x802f49
+  800695:	6a 31                	push   $0x31
+  800697:	68 5e 2f 80 00       	push   $0x802f5e
+  80069c:	e8 c9 00 00 00       	call   80076a <_panic>
+	assert(sys_page_map(0, buf, 0, UTEMP, PTE_U|PTE_P|PTE_W) == 0);
+  8006a1:	68 a4 34 80 00       	push   $0x8034a4
+  8006a6:	68 49 2f 80 00       	push   $0x802f49
+  8006ab:	6a 32                	push   $0x32
+  8006ad:	68 5e 2f 80 00       	push   $0x802f5e
+  8006b2:	e8 b3 00 00 00       	call   80076a <_panic>
+	assert(sys_page_map(0, VA, 0, buf, PTE_U|PTE_P|PTE_W) == 0);
+  8006b7:	68 dc 34 80 00       	push   $0x8034dc
+  8006bc:	68 49 2f 80 00       	push   $0x802f49
+  8006c1:	6a 33                	push   $0x33
+  8006c3:	68 5e 2f 80 00       	push   $0x802f5e
+  8006c8:	e8 9d 00 00 00       	call   80076a <_panic>
+	assert(sys_page_map(0, UTEMP, 0, VA, PTE_U|PTE_P|PTE_W) == 0);
+  8006cd:	68 10 35 80 00       	push   $0x803510
+  8006d2:	68 49 2f 80 00       	push   $0x802f49
+  8006d7:	6a 34                	push   $0x34
+  8006d9:	68 5e 2f 80 00       	push   $0x802f5e
+  8006de:	e8 87 00 00 00       	call   80076a <_panic>
+	assert(strcmp(buf, "world") == 0);
+  8006e3:	68 f2 2f 80 00       	push   $0x802ff2
+  8006e8:	68 49 2f 80 00       	push   $0x802f49
+  8006ed:	6a 35                	push   $0x35
+  8006ef:	68 5e 2f 80 00       	push   $0x802f5e
+  8006f4:	e8 71 00 00 00       	call   80076a <_panic>
+	assert(strcmp(VA, "hello") == 0);
+  8006f9:	68 8f 2f 80 00       	push   $0x802f8f
+  8006fe:	68 49 2f 80 00       	push   $0x802f49
+  800703:	6a 36                	push   $0x36
+  800705:	68 5e 2f 80 00       	push   $0x802f5e
+  80070a:	e8 5b 00 00 00       	call   80076a <_panic>
+
+0080070f <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80070f:	55                   	push   %ebp
+  800710:	89 e5                	mov    %esp,%ebp
+  800712:	56                   	push   %esi
+  800713:	53                   	push   %ebx
+  800714:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800717:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  80071a:	e8 e3 0e 00 00       	call   801602 <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  80071f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800724:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  80072a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80072f:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800734:	85 db                	test   %ebx,%ebx
+  800736:	7e 07                	jle    80073f <libmain+0x30>
+		binaryname = argv[0];
+  800738:	8b 06                	mov    (%esi),%eax
+  80073a:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  80073f:	83 ec 08             	sub    $0x8,%esp
+  800742:	56                   	push   %esi
+  800743:	53                   	push   %ebx
+  800744:	e8 ea f8 ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800749:	e8 0a 00 00 00       	call   800758 <exit>
+}
+  80074e:	83 c4 10             	add    $0x10,%esp
+  800751:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800754:	5b                   	pop    %ebx
+  800755:	5e                   	pop    %esi
+  800756:	5d                   	pop    %ebp
+  800757:	c3                   	ret
+
+00800758 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800758:	55                   	push   %ebp
+  800759:	89 e5                	mov    %esp,%ebp
+  80075b:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  80075e:	6a 00                	push   $0x0
+  800760:	e8 db 0d 00 00       	call   801540 <sys_env_destroy>
+}
+  800765:	83 c4 10             	add    $0x10,%esp
+  800768:	c9                   	leave
+  800769:	c3                   	ret
+
+0080076a <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80076a:	55                   	push   %ebp
+  80076b:	89 e5                	mov    %esp,%ebp
+  80076d:	57                   	push   %edi
+  80076e:	56                   	push   %esi
+  80076f:	53                   	push   %ebx
+  800770:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  800776:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  800779:	8b 1d 00 40 80 00    	mov    0x804000,%ebx
+  80077f:	e8 7e 0e 00 00       	call   801602 <sys_getenvid>
+  800784:	83 ec 04             	sub    $0x4,%esp
+  800787:	ff 75 0c             	push   0xc(%ebp)
+  80078a:	ff 75 08             	push   0x8(%ebp)
+  80078d:	53                   	push   %ebx
+  80078e:	50                   	push   %eax
+  80078f:	68 50 35 80 00       	push   $0x803550
+  800794:	68 00 01 00 00       	push   $0x100
+  800799:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  80079f:	56                   	push   %esi
+  8007a0:	e8 72 06 00 00       	call   800e17 <snprintf>
+  8007a5:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  8007a7:	83 c4 20             	add    $0x20,%esp
+  8007aa:	57                   	push   %edi
+  8007ab:	ff 75 10             	push   0x10(%ebp)
+  8007ae:	bf 00 01 00 00       	mov    $0x100,%edi
+  8007b3:	89 f8                	mov    %edi,%eax
+  8007b5:	29 d8                	sub    %ebx,%eax
+  8007b7:	50                   	push   %eax
+  8007b8:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8007bb:	50                   	push   %eax
+  8007bc:	e8 08 06 00 00       	call   800dc9 <vsnprintf>
+  8007c1:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  8007c3:	83 c4 0c             	add    $0xc,%esp
+  8007c6:	68 1d 30 80 00       	push   $0x80301d
+  8007cb:	29 df                	sub    %ebx,%edi
+  8007cd:	57                   	push   %edi
+  8007ce:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8007d1:	50                   	push   %eax
+  8007d2:	e8 40 06 00 00       	call   800e17 <snprintf>
+	sys_cputs(buf, r);
+  8007d7:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  8007da:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  8007dc:	53                   	push   %ebx
+  8007dd:	56                   	push   %esi
+  8007de:	e8 21 0c 00 00       	call   801404 <sys_cputs>
+  8007e3:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8007e6:	cc                   	int3
+	while (1)
+  8007e7:	eb fd                	jmp    8007e6 <_panic+0x7c>
+
+008007e9 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8007e9:	55                   	push   %ebp
+  8007ea:	89 e5                	mov    %esp,%ebp
+  8007ec:	53                   	push   %ebx
+  8007ed:	83 ec 04             	sub    $0x4,%esp
+  8007f0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8007f3:	8b 13                	mov    (%ebx),%edx
+  8007f5:	8d 42 01             	lea    0x1(%edx),%eax
+  8007f8:	89 03                	mov    %eax,(%ebx)
+  8007fa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007fd:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800801:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800806:	74 09                	je     800811 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800808:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80080c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80080f:	c9                   	leave
+  800810:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800811:	83 ec 08             	sub    $0x8,%esp
+  800814:	68 ff 00 00 00       	push   $0xff
+  800819:	8d 43 08             	lea    0x8(%ebx),%eax
+  80081c:	50                   	push   %eax
+  80081d:	e8 e2 0b 00 00       	call   801404 <sys_cputs>
+		b->idx = 0;
+  800822:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800828:	83 c4 10             	add    $0x10,%esp
+  80082b:	eb db                	jmp    800808 <putch+0x1f>
+
+0080082d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80082d:	55                   	push   %ebp
+  80082e:	89 e5                	mov    %esp,%ebp
+  800830:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800836:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80083d:	00 00 00 
+	b.cnt = 0;
+  800840:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800847:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80084a:	ff 75 0c             	push   0xc(%ebp)
+  80084d:	ff 75 08             	push   0x8(%ebp)
+  800850:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800856:	50                   	push   %eax
+  800857:	68 e9 07 80 00       	push   $0x8007e9
+  80085c:	e8 14 01 00 00       	call   800975 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800861:	83 c4 08             	add    $0x8,%esp
+  800864:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80086a:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800870:	50                   	push   %eax
+  800871:	e8 8e 0b 00 00       	call   801404 <sys_cputs>
+
+	return b.cnt;
+}
+  800876:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80087c:	c9                   	leave
+  80087d:	c3                   	ret
+
+0080087e <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80087e:	55                   	push   %ebp
+  80087f:	89 e5                	mov    %esp,%ebp
+  800881:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800884:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800887:	50                   	push   %eax
+  800888:	ff 75 08             	push   0x8(%ebp)
+  80088b:	e8 9d ff ff ff       	call   80082d <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800890:	c9                   	leave
+  800891:	c3                   	ret
+
+00800892 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800892:	55                   	push   %ebp
+  800893:	89 e5                	mov    %esp,%ebp
+  800895:	57                   	push   %edi
+  800896:	56                   	push   %esi
+  800897:	53                   	push   %ebx
+  800898:	83 ec 1c             	sub    $0x1c,%esp
+  80089b:	89 c7                	mov    %eax,%edi
+  80089d:	89 d6                	mov    %edx,%esi
+  80089f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008a2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008a5:	89 d1                	mov    %edx,%ecx
+  8008a7:	89 c2                	mov    %eax,%edx
+  8008a9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008ac:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8008af:	8b 45 10             	mov    0x10(%ebp),%eax
+  8008b2:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8008b5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008b8:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8008bf:	39 c2                	cmp    %eax,%edx
+  8008c1:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8008c4:	72 3e                	jb     800904 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8008c6:	83 ec 0c             	sub    $0xc,%esp
+  8008c9:	ff 75 18             	push   0x18(%ebp)
+  8008cc:	83 eb 01             	sub    $0x1,%ebx
+  8008cf:	53                   	push   %ebx
+  8008d0:	50                   	push   %eax
+  8008d1:	83 ec 08             	sub    $0x8,%esp
+  8008d4:	ff 75 e4             	push   -0x1c(%ebp)
+  8008d7:	ff 75 e0             	push   -0x20(%ebp)
+  8008da:	ff 75 dc             	push   -0x24(%ebp)
+  8008dd:	ff 75 d8             	push   -0x28(%ebp)
+  8008e0:	e8 0a 25 00 00       	call   802def <__udivdi3>
+  8008e5:	83 c4 18             	add    $0x18,%esp
+  8008e8:	52                   	push   %edx
+  8008e9:	50                   	push   %eax
+  8008ea:	89 f2                	mov    %esi,%edx
+  8008ec:	89 f8                	mov    %edi,%eax
+  8008ee:	e8 9f ff ff ff       	call   800892 <printnum>
+  8008f3:	83 c4 20             	add    $0x20,%esp
+  8008f6:	eb 13                	jmp    80090b <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8008f8:	83 ec 08             	sub    $0x8,%esp
+  8008fb:	56                   	push   %esi
+  8008fc:	ff 75 18             	push   0x18(%ebp)
+  8008ff:	ff d7                	call   *%edi
+  800901:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800904:	83 eb 01             	sub    $0x1,%ebx
+  800907:	85 db                	test   %ebx,%ebx
+  800909:	7f ed                	jg     8008f8 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80090b:	83 ec 08             	sub    $0x8,%esp
+  80090e:	56                   	push   %esi
+  80090f:	83 ec 04             	sub    $0x4,%esp
+  800912:	ff 75 e4             	push   -0x1c(%ebp)
+  800915:	ff 75 e0             	push   -0x20(%ebp)
+  800918:	ff 75 dc             	push   -0x24(%ebp)
+  80091b:	ff 75 d8             	push   -0x28(%ebp)
+  80091e:	e8 ea 24 00 00       	call   802e0d <__umoddi3>
+  800923:	83 c4 14             	add    $0x14,%esp
+  800926:	0f be 80 73 35 80 00 	movsbl 0x803573(%eax),%eax
+  80092d:	50                   	push   %eax
+  80092e:	ff d7                	call   *%edi
+}
+  800930:	83 c4 10             	add    $0x10,%esp
+  800933:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800936:	5b                   	pop    %ebx
+  800937:	5e                   	pop    %esi
+  800938:	5f                   	pop    %edi
+  800939:	5d                   	pop    %ebp
+  80093a:	c3                   	ret
+
+0080093b <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80093b:	55                   	push   %ebp
+  80093c:	89 e5                	mov    %esp,%ebp
+  80093e:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800941:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800945:	8b 10                	mov    (%eax),%edx
+  800947:	3b 50 04             	cmp    0x4(%eax),%edx
+  80094a:	73 0a                	jae    800956 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80094c:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80094f:	89 08                	mov    %ecx,(%eax)
+  800951:	8b 45 08             	mov    0x8(%ebp),%eax
+  800954:	88 02                	mov    %al,(%edx)
+}
+  800956:	5d                   	pop    %ebp
+  800957:	c3                   	ret
+
+00800958 <printfmt>:
+{
+  800958:	55                   	push   %ebp
+  800959:	89 e5                	mov    %esp,%ebp
+  80095b:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80095e:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800961:	50                   	push   %eax
+  800962:	ff 75 10             	push   0x10(%ebp)
+  800965:	ff 75 0c             	push   0xc(%ebp)
+  800968:	ff 75 08             	push   0x8(%ebp)
+  80096b:	e8 05 00 00 00       	call   800975 <vprintfmt>
+}
+  800970:	83 c4 10             	add    $0x10,%esp
+  800973:	c9                   	leave
+  800974:	c3                   	ret
+
+00800975 <vprintfmt>:
+{
+  800975:	55                   	push   %ebp
+  800976:	89 e5                	mov    %esp,%ebp
+  800978:	57                   	push   %edi
+  800979:	56                   	push   %esi
+  80097a:	53                   	push   %ebx
+  80097b:	83 ec 2c             	sub    $0x2c,%esp
+  80097e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800981:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800984:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800987:	eb 0a                	jmp    800993 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800989:	83 ec 08             	sub    $0x8,%esp
+  80098c:	53                   	push   %ebx
+  80098d:	50                   	push   %eax
+  80098e:	ff d6                	call   *%esi
+  800990:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800993:	83 c7 01             	add    $0x1,%edi
+  800996:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80099a:	83 f8 25             	cmp    $0x25,%eax
+  80099d:	74 0c                	je     8009ab <vprintfmt+0x36>
+			if (ch == '\0')
+  80099f:	85 c0                	test   %eax,%eax
+  8009a1:	75 e6                	jne    800989 <vprintfmt+0x14>
+}
+  8009a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009a6:	5b                   	pop    %ebx
+  8009a7:	5e                   	pop    %esi
+  8009a8:	5f                   	pop    %edi
+  8009a9:	5d                   	pop    %ebp
+  8009aa:	c3                   	ret
+		padc = ' ';
+  8009ab:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8009af:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8009b6:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8009bd:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8009c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8009c9:	8d 47 01             	lea    0x1(%edi),%eax
+  8009cc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8009cf:	0f b6 17             	movzbl (%edi),%edx
+  8009d2:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8009d5:	3c 55                	cmp    $0x55,%al
+  8009d7:	0f 87 cf 03 00 00    	ja     800dac <vprintfmt+0x437>
+  8009dd:	0f b6 c0             	movzbl %al,%eax
+  8009e0:	ff 24 85 60 36 80 00 	jmp    *0x803660(,%eax,4)
+  8009e7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8009ea:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8009ee:	eb d9                	jmp    8009c9 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8009f0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8009f3:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8009f7:	eb d0                	jmp    8009c9 <vprintfmt+0x54>
+  8009f9:	0f b6 d2             	movzbl %dl,%edx
+  8009fc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8009ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a04:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800a07:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800a0a:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800a0e:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800a11:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800a14:	83 f9 09             	cmp    $0x9,%ecx
+  800a17:	77 55                	ja     800a6e <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800a19:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800a1c:	eb e9                	jmp    800a07 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800a1e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a21:	8b 00                	mov    (%eax),%eax
+  800a23:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800a26:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a29:	8d 40 04             	lea    0x4(%eax),%eax
+  800a2c:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800a2f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800a32:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800a36:	79 91                	jns    8009c9 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800a38:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800a3b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800a3e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800a45:	eb 82                	jmp    8009c9 <vprintfmt+0x54>
+			if (width < 0)
+  800a47:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800a4a:	85 d2                	test   %edx,%edx
+  800a4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a51:	0f 49 c2             	cmovns %edx,%eax
+  800a54:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800a57:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800a5a:	e9 6a ff ff ff       	jmp    8009c9 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800a5f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800a62:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800a69:	e9 5b ff ff ff       	jmp    8009c9 <vprintfmt+0x54>
+  800a6e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800a71:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800a74:	eb bc                	jmp    800a32 <vprintfmt+0xbd>
+			lflag++;
+  800a76:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800a79:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800a7c:	e9 48 ff ff ff       	jmp    8009c9 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800a81:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a84:	8d 78 04             	lea    0x4(%eax),%edi
+  800a87:	83 ec 08             	sub    $0x8,%esp
+  800a8a:	53                   	push   %ebx
+  800a8b:	ff 30                	push   (%eax)
+  800a8d:	ff d6                	call   *%esi
+			break;
+  800a8f:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800a92:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800a95:	e9 b1 02 00 00       	jmp    800d4b <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800a9a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a9d:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800aa0:	8b 10                	mov    (%eax),%edx
+  800aa2:	89 d0                	mov    %edx,%eax
+  800aa4:	f7 d8                	neg    %eax
+  800aa6:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800aa9:	83 f8 0d             	cmp    $0xd,%eax
+  800aac:	7f 23                	jg     800ad1 <vprintfmt+0x15c>
+  800aae:	8b 14 85 c0 37 80 00 	mov    0x8037c0(,%eax,4),%edx
+  800ab5:	85 d2                	test   %edx,%edx
+  800ab7:	74 18                	je     800ad1 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800ab9:	52                   	push   %edx
+  800aba:	68 5b 2f 80 00       	push   $0x802f5b
+  800abf:	53                   	push   %ebx
+  800ac0:	56                   	push   %esi
+  800ac1:	e8 92 fe ff ff       	call   800958 <printfmt>
+  800ac6:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800ac9:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800acc:	e9 7a 02 00 00       	jmp    800d4b <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800ad1:	50                   	push   %eax
+  800ad2:	68 8b 35 80 00       	push   $0x80358b
+  800ad7:	53                   	push   %ebx
+  800ad8:	56                   	push   %esi
+  800ad9:	e8 7a fe ff ff       	call   800958 <printfmt>
+  800ade:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800ae1:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800ae4:	e9 62 02 00 00       	jmp    800d4b <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800ae9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aec:	83 c0 04             	add    $0x4,%eax
+  800aef:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800af2:	8b 45 14             	mov    0x14(%ebp),%eax
+  800af5:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800af7:	85 c9                	test   %ecx,%ecx
+  800af9:	b8 84 35 80 00       	mov    $0x803584,%eax
+  800afe:	0f 45 c1             	cmovne %ecx,%eax
+  800b01:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800b04:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800b08:	7e 06                	jle    800b10 <vprintfmt+0x19b>
+  800b0a:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800b0e:	75 0b                	jne    800b1b <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b10:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800b13:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800b16:	89 75 08             	mov    %esi,0x8(%ebp)
+  800b19:	eb 5c                	jmp    800b77 <vprintfmt+0x202>
+  800b1b:	83 ec 08             	sub    $0x8,%esp
+  800b1e:	ff 75 d0             	push   -0x30(%ebp)
+  800b21:	ff 75 cc             	push   -0x34(%ebp)
+  800b24:	e8 20 03 00 00       	call   800e49 <strnlen>
+  800b29:	89 c2                	mov    %eax,%edx
+  800b2b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800b2e:	29 d0                	sub    %edx,%eax
+  800b30:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800b33:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800b37:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800b3a:	89 75 08             	mov    %esi,0x8(%ebp)
+  800b3d:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b3f:	eb 0e                	jmp    800b4f <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800b41:	83 ec 08             	sub    $0x8,%esp
+  800b44:	53                   	push   %ebx
+  800b45:	57                   	push   %edi
+  800b46:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b49:	83 ee 01             	sub    $0x1,%esi
+  800b4c:	83 c4 10             	add    $0x10,%esp
+  800b4f:	85 f6                	test   %esi,%esi
+  800b51:	7f ee                	jg     800b41 <vprintfmt+0x1cc>
+  800b53:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800b56:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b59:	85 c0                	test   %eax,%eax
+  800b5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b60:	0f 49 d0             	cmovns %eax,%edx
+  800b63:	29 d0                	sub    %edx,%eax
+  800b65:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800b68:	eb a6                	jmp    800b10 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800b6a:	83 ec 08             	sub    $0x8,%esp
+  800b6d:	53                   	push   %ebx
+  800b6e:	52                   	push   %edx
+  800b6f:	ff 55 08             	call   *0x8(%ebp)
+  800b72:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b75:	89 f1                	mov    %esi,%ecx
+  800b77:	8d 71 01             	lea    0x1(%ecx),%esi
+  800b7a:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800b7e:	0f be d0             	movsbl %al,%edx
+  800b81:	85 d2                	test   %edx,%edx
+  800b83:	74 28                	je     800bad <vprintfmt+0x238>
+  800b85:	85 ff                	test   %edi,%edi
+  800b87:	78 05                	js     800b8e <vprintfmt+0x219>
+  800b89:	83 ef 01             	sub    $0x1,%edi
+  800b8c:	78 30                	js     800bbe <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800b8e:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800b92:	74 d6                	je     800b6a <vprintfmt+0x1f5>
+  800b94:	0f be c0             	movsbl %al,%eax
+  800b97:	83 e8 20             	sub    $0x20,%eax
+  800b9a:	83 f8 5e             	cmp    $0x5e,%eax
+  800b9d:	76 cb                	jbe    800b6a <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800b9f:	83 ec 08             	sub    $0x8,%esp
+  800ba2:	53                   	push   %ebx
+  800ba3:	6a 3f                	push   $0x3f
+  800ba5:	ff 55 08             	call   *0x8(%ebp)
+  800ba8:	83 c4 10             	add    $0x10,%esp
+  800bab:	eb c8                	jmp    800b75 <vprintfmt+0x200>
+  800bad:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bb0:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800bb3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800bb6:	01 d0                	add    %edx,%eax
+  800bb8:	29 c8                	sub    %ecx,%eax
+  800bba:	89 c7                	mov    %eax,%edi
+  800bbc:	eb 13                	jmp    800bd1 <vprintfmt+0x25c>
+  800bbe:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bc1:	eb ed                	jmp    800bb0 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800bc3:	83 ec 08             	sub    $0x8,%esp
+  800bc6:	53                   	push   %ebx
+  800bc7:	6a 20                	push   $0x20
+  800bc9:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800bcb:	83 ef 01             	sub    $0x1,%edi
+  800bce:	83 c4 10             	add    $0x10,%esp
+  800bd1:	85 ff                	test   %edi,%edi
+  800bd3:	7f ee                	jg     800bc3 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800bd5:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800bd8:	89 45 14             	mov    %eax,0x14(%ebp)
+  800bdb:	e9 6b 01 00 00       	jmp    800d4b <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800be0:	83 f9 01             	cmp    $0x1,%ecx
+  800be3:	7f 1f                	jg     800c04 <vprintfmt+0x28f>
+	else if (lflag)
+  800be5:	85 c9                	test   %ecx,%ecx
+  800be7:	74 67                	je     800c50 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800be9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bec:	8b 00                	mov    (%eax),%eax
+  800bee:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800bf1:	89 c1                	mov    %eax,%ecx
+  800bf3:	c1 f9 1f             	sar    $0x1f,%ecx
+  800bf6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800bf9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bfc:	8d 40 04             	lea    0x4(%eax),%eax
+  800bff:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c02:	eb 17                	jmp    800c1b <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800c04:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c07:	8b 50 04             	mov    0x4(%eax),%edx
+  800c0a:	8b 00                	mov    (%eax),%eax
+  800c0c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800c0f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800c12:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c15:	8d 40 08             	lea    0x8(%eax),%eax
+  800c18:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800c1b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800c1e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800c21:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800c26:	85 c9                	test   %ecx,%ecx
+  800c28:	0f 89 03 01 00 00    	jns    800d31 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800c2e:	83 ec 08             	sub    $0x8,%esp
+  800c31:	53                   	push   %ebx
+  800c32:	6a 2d                	push   $0x2d
+  800c34:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800c36:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800c39:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800c3c:	f7 da                	neg    %edx
+  800c3e:	83 d1 00             	adc    $0x0,%ecx
+  800c41:	f7 d9                	neg    %ecx
+  800c43:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800c46:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800c4b:	e9 e1 00 00 00       	jmp    800d31 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800c50:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c53:	8b 00                	mov    (%eax),%eax
+  800c55:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800c58:	89 c1                	mov    %eax,%ecx
+  800c5a:	c1 f9 1f             	sar    $0x1f,%ecx
+  800c5d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800c60:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c63:	8d 40 04             	lea    0x4(%eax),%eax
+  800c66:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c69:	eb b0                	jmp    800c1b <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800c6b:	83 f9 01             	cmp    $0x1,%ecx
+  800c6e:	7f 1e                	jg     800c8e <vprintfmt+0x319>
+	else if (lflag)
+  800c70:	85 c9                	test   %ecx,%ecx
+  800c72:	74 32                	je     800ca6 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800c74:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c77:	8b 10                	mov    (%eax),%edx
+  800c79:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c7e:	8d 40 04             	lea    0x4(%eax),%eax
+  800c81:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800c84:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800c89:	e9 a3 00 00 00       	jmp    800d31 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800c8e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c91:	8b 10                	mov    (%eax),%edx
+  800c93:	8b 48 04             	mov    0x4(%eax),%ecx
+  800c96:	8d 40 08             	lea    0x8(%eax),%eax
+  800c99:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800c9c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800ca1:	e9 8b 00 00 00       	jmp    800d31 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800ca6:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ca9:	8b 10                	mov    (%eax),%edx
+  800cab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cb0:	8d 40 04             	lea    0x4(%eax),%eax
+  800cb3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800cb6:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800cbb:	eb 74                	jmp    800d31 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800cbd:	83 f9 01             	cmp    $0x1,%ecx
+  800cc0:	7f 1b                	jg     800cdd <vprintfmt+0x368>
+	else if (lflag)
+  800cc2:	85 c9                	test   %ecx,%ecx
+  800cc4:	74 2c                	je     800cf2 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800cc6:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cc9:	8b 10                	mov    (%eax),%edx
+  800ccb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cd0:	8d 40 04             	lea    0x4(%eax),%eax
+  800cd3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800cd6:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800cdb:	eb 54                	jmp    800d31 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800cdd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ce0:	8b 10                	mov    (%eax),%edx
+  800ce2:	8b 48 04             	mov    0x4(%eax),%ecx
+  800ce5:	8d 40 08             	lea    0x8(%eax),%eax
+  800ce8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800ceb:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800cf0:	eb 3f                	jmp    800d31 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800cf2:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cf5:	8b 10                	mov    (%eax),%edx
+  800cf7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cfc:	8d 40 04             	lea    0x4(%eax),%eax
+  800cff:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800d02:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800d07:	eb 28                	jmp    800d31 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800d09:	83 ec 08             	sub    $0x8,%esp
+  800d0c:	53                   	push   %ebx
+  800d0d:	6a 30                	push   $0x30
+  800d0f:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800d11:	83 c4 08             	add    $0x8,%esp
+  800d14:	53                   	push   %ebx
+  800d15:	6a 78                	push   $0x78
+  800d17:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800d19:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d1c:	8b 10                	mov    (%eax),%edx
+  800d1e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800d23:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800d26:	8d 40 04             	lea    0x4(%eax),%eax
+  800d29:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800d2c:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800d31:	83 ec 0c             	sub    $0xc,%esp
+  800d34:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800d38:	50                   	push   %eax
+  800d39:	ff 75 e0             	push   -0x20(%ebp)
+  800d3c:	57                   	push   %edi
+  800d3d:	51                   	push   %ecx
+  800d3e:	52                   	push   %edx
+  800d3f:	89 da                	mov    %ebx,%edx
+  800d41:	89 f0                	mov    %esi,%eax
+  800d43:	e8 4a fb ff ff       	call   800892 <printnum>
+			break;
+  800d48:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800d4b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800d4e:	e9 40 fc ff ff       	jmp    800993 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800d53:	83 f9 01             	cmp    $0x1,%ecx
+  800d56:	7f 1b                	jg     800d73 <vprintfmt+0x3fe>
+	else if (lflag)
+  800d58:	85 c9                	test   %ecx,%ecx
+  800d5a:	74 2c                	je     800d88 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800d5c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d5f:	8b 10                	mov    (%eax),%edx
+  800d61:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d66:	8d 40 04             	lea    0x4(%eax),%eax
+  800d69:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800d6c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800d71:	eb be                	jmp    800d31 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800d73:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d76:	8b 10                	mov    (%eax),%edx
+  800d78:	8b 48 04             	mov    0x4(%eax),%ecx
+  800d7b:	8d 40 08             	lea    0x8(%eax),%eax
+  800d7e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800d81:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800d86:	eb a9                	jmp    800d31 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800d88:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d8b:	8b 10                	mov    (%eax),%edx
+  800d8d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d92:	8d 40 04             	lea    0x4(%eax),%eax
+  800d95:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800d98:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800d9d:	eb 92                	jmp    800d31 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800d9f:	83 ec 08             	sub    $0x8,%esp
+  800da2:	53                   	push   %ebx
+  800da3:	6a 25                	push   $0x25
+  800da5:	ff d6                	call   *%esi
+			break;
+  800da7:	83 c4 10             	add    $0x10,%esp
+  800daa:	eb 9f                	jmp    800d4b <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800dac:	83 ec 08             	sub    $0x8,%esp
+  800daf:	53                   	push   %ebx
+  800db0:	6a 25                	push   $0x25
+  800db2:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800db4:	83 c4 10             	add    $0x10,%esp
+  800db7:	89 f8                	mov    %edi,%eax
+  800db9:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800dbd:	74 05                	je     800dc4 <vprintfmt+0x44f>
+  800dbf:	83 e8 01             	sub    $0x1,%eax
+  800dc2:	eb f5                	jmp    800db9 <vprintfmt+0x444>
+  800dc4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800dc7:	eb 82                	jmp    800d4b <vprintfmt+0x3d6>
+
+00800dc9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800dc9:	55                   	push   %ebp
+  800dca:	89 e5                	mov    %esp,%ebp
+  800dcc:	83 ec 18             	sub    $0x18,%esp
+  800dcf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dd2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800dd5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800dd8:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800ddc:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800ddf:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800de6:	85 c0                	test   %eax,%eax
+  800de8:	74 26                	je     800e10 <vsnprintf+0x47>
+  800dea:	85 d2                	test   %edx,%edx
+  800dec:	7e 22                	jle    800e10 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800dee:	ff 75 14             	push   0x14(%ebp)
+  800df1:	ff 75 10             	push   0x10(%ebp)
+  800df4:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800df7:	50                   	push   %eax
+  800df8:	68 3b 09 80 00       	push   $0x80093b
+  800dfd:	e8 73 fb ff ff       	call   800975 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800e02:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800e05:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800e08:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800e0b:	83 c4 10             	add    $0x10,%esp
+}
+  800e0e:	c9                   	leave
+  800e0f:	c3                   	ret
+		return -E_INVAL;
+  800e10:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e15:	eb f7                	jmp    800e0e <vsnprintf+0x45>
+
+00800e17 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800e17:	55                   	push   %ebp
+  800e18:	89 e5                	mov    %esp,%ebp
+  800e1a:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800e1d:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800e20:	50                   	push   %eax
+  800e21:	ff 75 10             	push   0x10(%ebp)
+  800e24:	ff 75 0c             	push   0xc(%ebp)
+  800e27:	ff 75 08             	push   0x8(%ebp)
+  800e2a:	e8 9a ff ff ff       	call   800dc9 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800e2f:	c9                   	leave
+  800e30:	c3                   	ret
+
+00800e31 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800e31:	55                   	push   %ebp
+  800e32:	89 e5                	mov    %esp,%ebp
+  800e34:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800e37:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e3c:	eb 03                	jmp    800e41 <strlen+0x10>
+		n++;
+  800e3e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800e41:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800e45:	75 f7                	jne    800e3e <strlen+0xd>
+	return n;
+}
+  800e47:	5d                   	pop    %ebp
+  800e48:	c3                   	ret
+
+00800e49 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800e49:	55                   	push   %ebp
+  800e4a:	89 e5                	mov    %esp,%ebp
+  800e4c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800e4f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e52:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e57:	eb 03                	jmp    800e5c <strnlen+0x13>
+		n++;
+  800e59:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800e5c:	39 d0                	cmp    %edx,%eax
+  800e5e:	74 08                	je     800e68 <strnlen+0x1f>
+  800e60:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800e64:	75 f3                	jne    800e59 <strnlen+0x10>
+  800e66:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800e68:	89 d0                	mov    %edx,%eax
+  800e6a:	5d                   	pop    %ebp
+  800e6b:	c3                   	ret
+
+00800e6c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800e6c:	55                   	push   %ebp
+  800e6d:	89 e5                	mov    %esp,%ebp
+  800e6f:	53                   	push   %ebx
+  800e70:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800e73:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800e76:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e7b:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800e7f:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800e82:	83 c0 01             	add    $0x1,%eax
+  800e85:	84 d2                	test   %dl,%dl
+  800e87:	75 f2                	jne    800e7b <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800e89:	89 c8                	mov    %ecx,%eax
+  800e8b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e8e:	c9                   	leave
+  800e8f:	c3                   	ret
+
+00800e90 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800e90:	55                   	push   %ebp
+  800e91:	89 e5                	mov    %esp,%ebp
+  800e93:	53                   	push   %ebx
+  800e94:	83 ec 10             	sub    $0x10,%esp
+  800e97:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800e9a:	53                   	push   %ebx
+  800e9b:	e8 91 ff ff ff       	call   800e31 <strlen>
+  800ea0:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800ea3:	ff 75 0c             	push   0xc(%ebp)
+  800ea6:	01 d8                	add    %ebx,%eax
+  800ea8:	50                   	push   %eax
+  800ea9:	e8 be ff ff ff       	call   800e6c <strcpy>
+	return dst;
+}
+  800eae:	89 d8                	mov    %ebx,%eax
+  800eb0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800eb3:	c9                   	leave
+  800eb4:	c3                   	ret
+
+00800eb5 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800eb5:	55                   	push   %ebp
+  800eb6:	89 e5                	mov    %esp,%ebp
+  800eb8:	56                   	push   %esi
+  800eb9:	53                   	push   %ebx
+  800eba:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ebd:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800ec0:	89 f3                	mov    %esi,%ebx
+  800ec2:	03 5d 10             	add    0x10(%ebp),%ebx
+  800ec5:	89 f0                	mov    %esi,%eax
+  800ec7:	eb 0f                	jmp    800ed8 <strncpy+0x23>
+		*dst++ = *src;
+  800ec9:	83 c0 01             	add    $0x1,%eax
+  800ecc:	0f b6 0a             	movzbl (%edx),%ecx
+  800ecf:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800ed2:	80 f9 01             	cmp    $0x1,%cl
+  800ed5:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800ed8:	39 d8                	cmp    %ebx,%eax
+  800eda:	75 ed                	jne    800ec9 <strncpy+0x14>
+	}
+	return ret;
+}
+  800edc:	89 f0                	mov    %esi,%eax
+  800ede:	5b                   	pop    %ebx
+  800edf:	5e                   	pop    %esi
+  800ee0:	5d                   	pop    %ebp
+  800ee1:	c3                   	ret
+
+00800ee2 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800ee2:	55                   	push   %ebp
+  800ee3:	89 e5                	mov    %esp,%ebp
+  800ee5:	56                   	push   %esi
+  800ee6:	53                   	push   %ebx
+  800ee7:	8b 75 08             	mov    0x8(%ebp),%esi
+  800eea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eed:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800ef0:	89 f0                	mov    %esi,%eax
+  800ef2:	85 d2                	test   %edx,%edx
+  800ef4:	74 21                	je     800f17 <strlcpy+0x35>
+  800ef6:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800efa:	89 f2                	mov    %esi,%edx
+  800efc:	eb 09                	jmp    800f07 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800efe:	83 c1 01             	add    $0x1,%ecx
+  800f01:	83 c2 01             	add    $0x1,%edx
+  800f04:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800f07:	39 c2                	cmp    %eax,%edx
+  800f09:	74 09                	je     800f14 <strlcpy+0x32>
+  800f0b:	0f b6 19             	movzbl (%ecx),%ebx
+  800f0e:	84 db                	test   %bl,%bl
+  800f10:	75 ec                	jne    800efe <strlcpy+0x1c>
+  800f12:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800f14:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800f17:	29 f0                	sub    %esi,%eax
+}
+  800f19:	5b                   	pop    %ebx
+  800f1a:	5e                   	pop    %esi
+  800f1b:	5d                   	pop    %ebp
+  800f1c:	c3                   	ret
+
+00800f1d <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800f1d:	55                   	push   %ebp
+  800f1e:	89 e5                	mov    %esp,%ebp
+  800f20:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800f23:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800f26:	eb 06                	jmp    800f2e <strcmp+0x11>
+		p++, q++;
+  800f28:	83 c1 01             	add    $0x1,%ecx
+  800f2b:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800f2e:	0f b6 01             	movzbl (%ecx),%eax
+  800f31:	84 c0                	test   %al,%al
+  800f33:	74 04                	je     800f39 <strcmp+0x1c>
+  800f35:	3a 02                	cmp    (%edx),%al
+  800f37:	74 ef                	je     800f28 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800f39:	0f b6 c0             	movzbl %al,%eax
+  800f3c:	0f b6 12             	movzbl (%edx),%edx
+  800f3f:	29 d0                	sub    %edx,%eax
+}
+  800f41:	5d                   	pop    %ebp
+  800f42:	c3                   	ret
+
+00800f43 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800f43:	55                   	push   %ebp
+  800f44:	89 e5                	mov    %esp,%ebp
+  800f46:	53                   	push   %ebx
+  800f47:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f4a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4d:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800f50:	eb 09                	jmp    800f5b <strncmp+0x18>
+		n--, p++, q++;
+  800f52:	83 ea 01             	sub    $0x1,%edx
+  800f55:	83 c0 01             	add    $0x1,%eax
+  800f58:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800f5b:	85 d2                	test   %edx,%edx
+  800f5d:	74 18                	je     800f77 <strncmp+0x34>
+  800f5f:	0f b6 18             	movzbl (%eax),%ebx
+  800f62:	84 db                	test   %bl,%bl
+  800f64:	74 04                	je     800f6a <strncmp+0x27>
+  800f66:	3a 19                	cmp    (%ecx),%bl
+  800f68:	74 e8                	je     800f52 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800f6a:	0f b6 00             	movzbl (%eax),%eax
+  800f6d:	0f b6 11             	movzbl (%ecx),%edx
+  800f70:	29 d0                	sub    %edx,%eax
+}
+  800f72:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f75:	c9                   	leave
+  800f76:	c3                   	ret
+		return 0;
+  800f77:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f7c:	eb f4                	jmp    800f72 <strncmp+0x2f>
+
+00800f7e <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800f7e:	55                   	push   %ebp
+  800f7f:	89 e5                	mov    %esp,%ebp
+  800f81:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f84:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800f88:	eb 03                	jmp    800f8d <strchr+0xf>
+  800f8a:	83 c0 01             	add    $0x1,%eax
+  800f8d:	0f b6 10             	movzbl (%eax),%edx
+  800f90:	84 d2                	test   %dl,%dl
+  800f92:	74 06                	je     800f9a <strchr+0x1c>
+		if (*s == c)
+  800f94:	38 ca                	cmp    %cl,%dl
+  800f96:	75 f2                	jne    800f8a <strchr+0xc>
+  800f98:	eb 05                	jmp    800f9f <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800f9a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f9f:	5d                   	pop    %ebp
+  800fa0:	c3                   	ret
+
+00800fa1 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800fa1:	55                   	push   %ebp
+  800fa2:	89 e5                	mov    %esp,%ebp
+  800fa4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fa7:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800fab:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800fae:	38 ca                	cmp    %cl,%dl
+  800fb0:	74 09                	je     800fbb <strfind+0x1a>
+  800fb2:	84 d2                	test   %dl,%dl
+  800fb4:	74 05                	je     800fbb <strfind+0x1a>
+	for (; *s; s++)
+  800fb6:	83 c0 01             	add    $0x1,%eax
+  800fb9:	eb f0                	jmp    800fab <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800fbb:	5d                   	pop    %ebp
+  800fbc:	c3                   	ret
+
+00800fbd <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800fbd:	55                   	push   %ebp
+  800fbe:	89 e5                	mov    %esp,%ebp
+  800fc0:	57                   	push   %edi
+  800fc1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800fc4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800fc7:	85 c9                	test   %ecx,%ecx
+  800fc9:	74 20                	je     800feb <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800fcb:	89 f8                	mov    %edi,%eax
+  800fcd:	09 c8                	or     %ecx,%eax
+  800fcf:	a8 03                	test   $0x3,%al
+  800fd1:	75 12                	jne    800fe5 <memset+0x28>
+		c &= 0xFF;
+  800fd3:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800fd7:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800fdd:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800fe0:	fc                   	cld
+  800fe1:	f3 ab                	rep stos %eax,%es:(%edi)
+  800fe3:	eb 06                	jmp    800feb <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800fe5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800fe8:	fc                   	cld
+  800fe9:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800feb:	89 f8                	mov    %edi,%eax
+  800fed:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ff0:	c9                   	leave
+  800ff1:	c3                   	ret
+
+00800ff2 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800ff2:	55                   	push   %ebp
+  800ff3:	89 e5                	mov    %esp,%ebp
+  800ff5:	57                   	push   %edi
+  800ff6:	56                   	push   %esi
+  800ff7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ffa:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ffd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801000:	39 c6                	cmp    %eax,%esi
+  801002:	73 32                	jae    801036 <memmove+0x44>
+  801004:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801007:	39 d0                	cmp    %edx,%eax
+  801009:	73 2b                	jae    801036 <memmove+0x44>
+		s += n;
+		d += n;
+  80100b:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80100e:	89 d6                	mov    %edx,%esi
+  801010:	09 fe                	or     %edi,%esi
+  801012:	09 ce                	or     %ecx,%esi
+  801014:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80101a:	75 0e                	jne    80102a <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80101c:	83 ef 04             	sub    $0x4,%edi
+  80101f:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801022:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801025:	fd                   	std
+  801026:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801028:	eb 09                	jmp    801033 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80102a:	83 ef 01             	sub    $0x1,%edi
+  80102d:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801030:	fd                   	std
+  801031:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801033:	fc                   	cld
+  801034:	eb 1a                	jmp    801050 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801036:	89 f2                	mov    %esi,%edx
+  801038:	09 c2                	or     %eax,%edx
+  80103a:	09 ca                	or     %ecx,%edx
+  80103c:	f6 c2 03             	test   $0x3,%dl
+  80103f:	75 0a                	jne    80104b <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801041:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801044:	89 c7                	mov    %eax,%edi
+  801046:	fc                   	cld
+  801047:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801049:	eb 05                	jmp    801050 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80104b:	89 c7                	mov    %eax,%edi
+  80104d:	fc                   	cld
+  80104e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801050:	5e                   	pop    %esi
+  801051:	5f                   	pop    %edi
+  801052:	5d                   	pop    %ebp
+  801053:	c3                   	ret
+
+00801054 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801054:	55                   	push   %ebp
+  801055:	89 e5                	mov    %esp,%ebp
+  801057:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80105a:	ff 75 10             	push   0x10(%ebp)
+  80105d:	ff 75 0c             	push   0xc(%ebp)
+  801060:	ff 75 08             	push   0x8(%ebp)
+  801063:	e8 8a ff ff ff       	call   800ff2 <memmove>
+}
+  801068:	c9                   	leave
+  801069:	c3                   	ret
+
+0080106a <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80106a:	55                   	push   %ebp
+  80106b:	89 e5                	mov    %esp,%ebp
+  80106d:	56                   	push   %esi
+  80106e:	53                   	push   %ebx
+  80106f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801072:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801075:	89 c6                	mov    %eax,%esi
+  801077:	03 75 10             	add    0x10(%ebp),%esi
+  80107a:	eb 06                	jmp    801082 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  80107c:	83 c0 01             	add    $0x1,%eax
+  80107f:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801082:	39 f0                	cmp    %esi,%eax
+  801084:	74 14                	je     80109a <memcmp+0x30>
+		if (*s1 != *s2)
+  801086:	0f b6 08             	movzbl (%eax),%ecx
+  801089:	0f b6 1a             	movzbl (%edx),%ebx
+  80108c:	38 d9                	cmp    %bl,%cl
+  80108e:	74 ec                	je     80107c <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  801090:	0f b6 c1             	movzbl %cl,%eax
+  801093:	0f b6 db             	movzbl %bl,%ebx
+  801096:	29 d8                	sub    %ebx,%eax
+  801098:	eb 05                	jmp    80109f <memcmp+0x35>
+	}
+
+	return 0;
+  80109a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80109f:	5b                   	pop    %ebx
+  8010a0:	5e                   	pop    %esi
+  8010a1:	5d                   	pop    %ebp
+  8010a2:	c3                   	ret
+
+008010a3 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8010a3:	55                   	push   %ebp
+  8010a4:	89 e5                	mov    %esp,%ebp
+  8010a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8010ac:	89 c2                	mov    %eax,%edx
+  8010ae:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8010b1:	eb 03                	jmp    8010b6 <memfind+0x13>
+  8010b3:	83 c0 01             	add    $0x1,%eax
+  8010b6:	39 d0                	cmp    %edx,%eax
+  8010b8:	73 04                	jae    8010be <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8010ba:	38 08                	cmp    %cl,(%eax)
+  8010bc:	75 f5                	jne    8010b3 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8010be:	5d                   	pop    %ebp
+  8010bf:	c3                   	ret
+
+008010c0 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8010c0:	55                   	push   %ebp
+  8010c1:	89 e5                	mov    %esp,%ebp
+  8010c3:	57                   	push   %edi
+  8010c4:	56                   	push   %esi
+  8010c5:	53                   	push   %ebx
+  8010c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8010cc:	eb 03                	jmp    8010d1 <strtol+0x11>
+		s++;
+  8010ce:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8010d1:	0f b6 02             	movzbl (%edx),%eax
+  8010d4:	3c 20                	cmp    $0x20,%al
+  8010d6:	74 f6                	je     8010ce <strtol+0xe>
+  8010d8:	3c 09                	cmp    $0x9,%al
+  8010da:	74 f2                	je     8010ce <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8010dc:	3c 2b                	cmp    $0x2b,%al
+  8010de:	74 2a                	je     80110a <strtol+0x4a>
+	int neg = 0;
+  8010e0:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8010e5:	3c 2d                	cmp    $0x2d,%al
+  8010e7:	74 2b                	je     801114 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8010e9:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8010ef:	75 0f                	jne    801100 <strtol+0x40>
+  8010f1:	80 3a 30             	cmpb   $0x30,(%edx)
+  8010f4:	74 28                	je     80111e <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8010f6:	85 db                	test   %ebx,%ebx
+  8010f8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010fd:	0f 44 d8             	cmove  %eax,%ebx
+  801100:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801105:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801108:	eb 46                	jmp    801150 <strtol+0x90>
+		s++;
+  80110a:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  80110d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801112:	eb d5                	jmp    8010e9 <strtol+0x29>
+		s++, neg = 1;
+  801114:	83 c2 01             	add    $0x1,%edx
+  801117:	bf 01 00 00 00       	mov    $0x1,%edi
+  80111c:	eb cb                	jmp    8010e9 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80111e:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  801122:	74 0e                	je     801132 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  801124:	85 db                	test   %ebx,%ebx
+  801126:	75 d8                	jne    801100 <strtol+0x40>
+		s++, base = 8;
+  801128:	83 c2 01             	add    $0x1,%edx
+  80112b:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801130:	eb ce                	jmp    801100 <strtol+0x40>
+		s += 2, base = 16;
+  801132:	83 c2 02             	add    $0x2,%edx
+  801135:	bb 10 00 00 00       	mov    $0x10,%ebx
+  80113a:	eb c4                	jmp    801100 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  80113c:	0f be c0             	movsbl %al,%eax
+  80113f:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  801142:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801145:	7d 3a                	jge    801181 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  801147:	83 c2 01             	add    $0x1,%edx
+  80114a:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  80114e:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  801150:	0f b6 02             	movzbl (%edx),%eax
+  801153:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801156:	89 f3                	mov    %esi,%ebx
+  801158:	80 fb 09             	cmp    $0x9,%bl
+  80115b:	76 df                	jbe    80113c <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  80115d:	8d 70 9f             	lea    -0x61(%eax),%esi
+  801160:	89 f3                	mov    %esi,%ebx
+  801162:	80 fb 19             	cmp    $0x19,%bl
+  801165:	77 08                	ja     80116f <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  801167:	0f be c0             	movsbl %al,%eax
+  80116a:	83 e8 57             	sub    $0x57,%eax
+  80116d:	eb d3                	jmp    801142 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  80116f:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801172:	89 f3                	mov    %esi,%ebx
+  801174:	80 fb 19             	cmp    $0x19,%bl
+  801177:	77 08                	ja     801181 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  801179:	0f be c0             	movsbl %al,%eax
+  80117c:	83 e8 37             	sub    $0x37,%eax
+  80117f:	eb c1                	jmp    801142 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801181:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801185:	74 05                	je     80118c <strtol+0xcc>
+		*endptr = (char *) s;
+  801187:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80118a:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  80118c:	89 c8                	mov    %ecx,%eax
+  80118e:	f7 d8                	neg    %eax
+  801190:	85 ff                	test   %edi,%edi
+  801192:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801195:	89 c8                	mov    %ecx,%eax
+  801197:	5b                   	pop    %ebx
+  801198:	5e                   	pop    %esi
+  801199:	5f                   	pop    %edi
+  80119a:	5d                   	pop    %ebp
+  80119b:	c3                   	ret
+
+0080119c <atoi>:
+
+int
+atoi(const char *s)
+{
+  80119c:	55                   	push   %ebp
+  80119d:	89 e5                	mov    %esp,%ebp
+  80119f:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  8011a2:	6a 0a                	push   $0xa
+  8011a4:	6a 00                	push   $0x0
+  8011a6:	ff 75 08             	push   0x8(%ebp)
+  8011a9:	e8 12 ff ff ff       	call   8010c0 <strtol>
+}
+  8011ae:	c9                   	leave
+  8011af:	c3                   	ret
+
+008011b0 <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  8011b0:	55                   	push   %ebp
+  8011b1:	89 e5                	mov    %esp,%ebp
+  8011b3:	57                   	push   %edi
+  8011b4:	56                   	push   %esi
+  8011b5:	53                   	push   %ebx
+  8011b6:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  8011bc:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  8011c2:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  8011c8:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  8011ce:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  8011d5:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  8011d8:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  8011df:	00 00 00 
+		if (num == SYS_page_map_vec)
+  8011e2:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  8011e9:	74 76                	je     801261 <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  8011eb:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  8011f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011f4:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  8011fa:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801201:	0f 88 06 01 00 00    	js     80130d <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  801207:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80120e:	0f 84 48 01 00 00    	je     80135c <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  801214:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  80121a:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  801220:	be 00 00 00 00       	mov    $0x0,%esi
+  801225:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  80122b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80122e:	55                   	push   %ebp
+  80122f:	68 38 12 80 00       	push   $0x801238
+  801234:	89 e5                	mov    %esp,%ebp
+  801236:	0f 34                	sysenter
+  801238:	83 c4 04             	add    $0x4,%esp
+  80123b:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  80123c:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  801242:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  801248:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  80124b:	0f 85 9a 01 00 00    	jne    8013eb <page_vec_call+0x23b>
+  801251:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801256:	8b 75 08             	mov    0x8(%ebp),%esi
+  801259:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80125c:	e9 29 01 00 00       	jmp    80138a <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  801261:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  801267:	8b 45 08             	mov    0x8(%ebp),%eax
+  80126a:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  80126c:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801273:	78 2f                	js     8012a4 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  801275:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80127c:	74 72                	je     8012f0 <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  80127e:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  801284:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  80128a:	b8 10 00 00 00       	mov    $0x10,%eax
+  80128f:	89 fb                	mov    %edi,%ebx
+  801291:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801294:	55                   	push   %ebp
+  801295:	68 9e 12 80 00       	push   $0x80129e
+  80129a:	89 e5                	mov    %esp,%ebp
+  80129c:	0f 34                	sysenter
+  80129e:	83 c4 04             	add    $0x4,%esp
+  8012a1:	5d                   	pop    %ebp
+	return ret;
+  8012a2:	eb 98                	jmp    80123c <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  8012a4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012a9:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  8012ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8012b0:	f6 c6 08             	test   $0x8,%dh
+  8012b3:	74 15                	je     8012ca <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012b5:	89 c2                	mov    %eax,%edx
+  8012b7:	c1 ea 08             	shr    $0x8,%edx
+  8012ba:	83 e2 0f             	and    $0xf,%edx
+  8012bd:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012c2:	83 fa 06             	cmp    $0x6,%edx
+  8012c5:	74 0e                	je     8012d5 <page_vec_call+0x125>
+  8012c7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8012ca:	0f b6 c9             	movzbl %cl,%ecx
+  8012cd:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8012d3:	eb a0                	jmp    801275 <page_vec_call+0xc5>
+  8012d5:	89 c2                	mov    %eax,%edx
+  8012d7:	c1 ea 04             	shr    $0x4,%edx
+  8012da:	83 e2 0f             	and    $0xf,%edx
+  8012dd:	83 fa 02             	cmp    $0x2,%edx
+  8012e0:	77 e5                	ja     8012c7 <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  8012e2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012e5:	83 f8 02             	cmp    $0x2,%eax
+  8012e8:	0f 97 c1             	seta   %cl
+  8012eb:	0f b6 c9             	movzbl %cl,%ecx
+  8012ee:	eb d7                	jmp    8012c7 <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  8012f0:	b8 10 00 00 00       	mov    $0x10,%eax
+  8012f5:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  8012fb:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  801301:	89 fb                	mov    %edi,%ebx
+  801303:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801306:	cd 30                	int    $0x30
+  801308:	e9 2f ff ff ff       	jmp    80123c <page_vec_call+0x8c>
+  80130d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801312:	0f a2                	cpuid
+		return 0;
+  801314:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801319:	f6 c6 08             	test   $0x8,%dh
+  80131c:	74 15                	je     801333 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80131e:	89 c2                	mov    %eax,%edx
+  801320:	c1 ea 08             	shr    $0x8,%edx
+  801323:	83 e2 0f             	and    $0xf,%edx
+  801326:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80132b:	83 fa 06             	cmp    $0x6,%edx
+  80132e:	74 11                	je     801341 <page_vec_call+0x191>
+  801330:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801333:	0f b6 c9             	movzbl %cl,%ecx
+  801336:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80133c:	e9 c6 fe ff ff       	jmp    801207 <page_vec_call+0x57>
+  801341:	89 c2                	mov    %eax,%edx
+  801343:	c1 ea 04             	shr    $0x4,%edx
+  801346:	83 e2 0f             	and    $0xf,%edx
+  801349:	83 fa 02             	cmp    $0x2,%edx
+  80134c:	77 e2                	ja     801330 <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  80134e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801351:	83 f8 02             	cmp    $0x2,%eax
+  801354:	0f 97 c1             	seta   %cl
+  801357:	0f b6 c9             	movzbl %cl,%ecx
+  80135a:	eb d4                	jmp    801330 <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  80135c:	be 00 00 00 00       	mov    $0x0,%esi
+  801361:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  801367:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  80136d:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  801373:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801376:	cd 30                	int    $0x30
+  801378:	e9 bf fe ff ff       	jmp    80123c <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  80137d:	29 da                	sub    %ebx,%edx
+			vec++;
+  80137f:	83 c6 10             	add    $0x10,%esi
+			n--;
+  801382:	83 e8 01             	sub    $0x1,%eax
+  801385:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  80138a:	85 c0                	test   %eax,%eax
+  80138c:	74 58                	je     8013e6 <page_vec_call+0x236>
+  80138e:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801391:	39 da                	cmp    %ebx,%edx
+  801393:	73 e8                	jae    80137d <page_vec_call+0x1cd>
+  801395:	89 75 08             	mov    %esi,0x8(%ebp)
+  801398:	89 45 0c             	mov    %eax,0xc(%ebp)
+  80139b:	84 c9                	test   %cl,%cl
+  80139d:	74 06                	je     8013a5 <page_vec_call+0x1f5>
+  80139f:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  8013a5:	83 ec 04             	sub    $0x4,%esp
+  8013a8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8013ab:	c1 e0 04             	shl    $0x4,%eax
+  8013ae:	50                   	push   %eax
+  8013af:	ff 75 08             	push   0x8(%ebp)
+  8013b2:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  8013b8:	53                   	push   %ebx
+  8013b9:	e8 34 fc ff ff       	call   800ff2 <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  8013be:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  8013c4:	89 c2                	mov    %eax,%edx
+  8013c6:	c1 e2 0c             	shl    $0xc,%edx
+  8013c9:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  8013cf:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  8013d5:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  8013db:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  8013de:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  8013e1:	e9 f2 fd ff ff       	jmp    8011d8 <page_vec_call+0x28>
+			r = 0;
+  8013e6:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  8013eb:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8013ef:	74 0b                	je     8013fc <page_vec_call+0x24c>
+		*done = total;
+  8013f1:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8013f4:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  8013fa:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  8013fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013ff:	5b                   	pop    %ebx
+  801400:	5e                   	pop    %esi
+  801401:	5f                   	pop    %edi
+  801402:	5d                   	pop    %ebp
+  801403:	c3                   	ret
+
+00801404 <sys_cputs>:
+{
+  801404:	55                   	push   %ebp
+  801405:	89 e5                	mov    %esp,%ebp
+  801407:	57                   	push   %edi
+  801408:	56                   	push   %esi
+  801409:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80140a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801411:	78 2d                	js     801440 <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  801413:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80141a:	74 70                	je     80148c <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  80141c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801421:	8b 55 08             	mov    0x8(%ebp),%edx
+  801424:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801427:	89 c3                	mov    %eax,%ebx
+  801429:	89 c7                	mov    %eax,%edi
+  80142b:	89 c6                	mov    %eax,%esi
+  80142d:	55                   	push   %ebp
+  80142e:	68 37 14 80 00       	push   $0x801437
+  801433:	89 e5                	mov    %esp,%ebp
+  801435:	0f 34                	sysenter
+  801437:	83 c4 04             	add    $0x4,%esp
+  80143a:	5d                   	pop    %ebp
+}
+  80143b:	5b                   	pop    %ebx
+  80143c:	5e                   	pop    %esi
+  80143d:	5f                   	pop    %edi
+  80143e:	5d                   	pop    %ebp
+  80143f:	c3                   	ret
+  801440:	b8 01 00 00 00       	mov    $0x1,%eax
+  801445:	0f a2                	cpuid
+		return 0;
+  801447:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80144c:	f6 c6 08             	test   $0x8,%dh
+  80144f:	74 15                	je     801466 <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801451:	89 c2                	mov    %eax,%edx
+  801453:	c1 ea 08             	shr    $0x8,%edx
+  801456:	83 e2 0f             	and    $0xf,%edx
+  801459:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80145e:	83 fa 06             	cmp    $0x6,%edx
+  801461:	74 0e                	je     801471 <sys_cputs+0x6d>
+  801463:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801466:	0f b6 c9             	movzbl %cl,%ecx
+  801469:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80146f:	eb a2                	jmp    801413 <sys_cputs+0xf>
+  801471:	89 c2                	mov    %eax,%edx
+  801473:	c1 ea 04             	shr    $0x4,%edx
+  801476:	83 e2 0f             	and    $0xf,%edx
+  801479:	83 fa 02             	cmp    $0x2,%edx
+  80147c:	77 e5                	ja     801463 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  80147e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801481:	83 f8 02             	cmp    $0x2,%eax
+  801484:	0f 97 c1             	seta   %cl
+  801487:	0f b6 c9             	movzbl %cl,%ecx
+  80148a:	eb d7                	jmp    801463 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  80148c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801491:	8b 55 08             	mov    0x8(%ebp),%edx
+  801494:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801497:	89 c3                	mov    %eax,%ebx
+  801499:	89 c7                	mov    %eax,%edi
+  80149b:	89 c6                	mov    %eax,%esi
+  80149d:	cd 30                	int    $0x30
+}
+  80149f:	eb 9a                	jmp    80143b <sys_cputs+0x37>
+
+008014a1 <sys_cgetc>:
+{
+  8014a1:	55                   	push   %ebp
+  8014a2:	89 e5                	mov    %esp,%ebp
+  8014a4:	57                   	push   %edi
+  8014a5:	56                   	push   %esi
+  8014a6:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8014a7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8014ae:	78 2e                	js     8014de <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  8014b0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8014b7:	74 71                	je     80152a <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  8014b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014be:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014c3:	89 d1                	mov    %edx,%ecx
+  8014c5:	89 d3                	mov    %edx,%ebx
+  8014c7:	89 d7                	mov    %edx,%edi
+  8014c9:	89 d6                	mov    %edx,%esi
+  8014cb:	55                   	push   %ebp
+  8014cc:	68 d5 14 80 00       	push   $0x8014d5
+  8014d1:	89 e5                	mov    %esp,%ebp
+  8014d3:	0f 34                	sysenter
+  8014d5:	83 c4 04             	add    $0x4,%esp
+  8014d8:	5d                   	pop    %ebp
+}
+  8014d9:	5b                   	pop    %ebx
+  8014da:	5e                   	pop    %esi
+  8014db:	5f                   	pop    %edi
+  8014dc:	5d                   	pop    %ebp
+  8014dd:	c3                   	ret
+  8014de:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014e3:	0f a2                	cpuid
+		return 0;
+  8014e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8014ea:	f6 c6 08             	test   $0x8,%dh
+  8014ed:	74 15                	je     801504 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014ef:	89 c2                	mov    %eax,%edx
+  8014f1:	c1 ea 08             	shr    $0x8,%edx
+  8014f4:	83 e2 0f             	and    $0xf,%edx
+  8014f7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8014fc:	83 fa 06             	cmp    $0x6,%edx
+  8014ff:	74 0e                	je     80150f <sys_cgetc+0x6e>
+  801501:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801504:	0f b6 c9             	movzbl %cl,%ecx
+  801507:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80150d:	eb a1                	jmp    8014b0 <sys_cgetc+0xf>
+  80150f:	89 c2                	mov    %eax,%edx
+  801511:	c1 ea 04             	shr    $0x4,%edx
+  801514:	83 e2 0f             	and    $0xf,%edx
+  801517:	83 fa 02             	cmp    $0x2,%edx
+  80151a:	77 e5                	ja     801501 <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  80151c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80151f:	83 f8 02             	cmp    $0x2,%eax
+  801522:	0f 97 c1             	seta   %cl
+  801525:	0f b6 c9             	movzbl %cl,%ecx
+  801528:	eb d7                	jmp    801501 <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  80152a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80152f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801534:	89 d1                	mov    %edx,%ecx
+  801536:	89 d3                	mov    %edx,%ebx
+  801538:	89 d7                	mov    %edx,%edi
+  80153a:	89 d6                	mov    %edx,%esi
+  80153c:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  80153e:	eb 99                	jmp    8014d9 <sys_cgetc+0x38>
+
+00801540 <sys_env_destroy>:
+{
+  801540:	55                   	push   %ebp
+  801541:	89 e5                	mov    %esp,%ebp
+  801543:	57                   	push   %edi
+  801544:	56                   	push   %esi
+  801545:	53                   	push   %ebx
+  801546:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801549:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801550:	78 36                	js     801588 <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  801552:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801559:	74 79                	je     8015d4 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  80155b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80155e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801563:	b8 03 00 00 00       	mov    $0x3,%eax
+  801568:	89 cb                	mov    %ecx,%ebx
+  80156a:	89 cf                	mov    %ecx,%edi
+  80156c:	89 ce                	mov    %ecx,%esi
+  80156e:	55                   	push   %ebp
+  80156f:	68 78 15 80 00       	push   $0x801578
+  801574:	89 e5                	mov    %esp,%ebp
+  801576:	0f 34                	sysenter
+  801578:	83 c4 04             	add    $0x4,%esp
+  80157b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80157c:	85 c0                	test   %eax,%eax
+  80157e:	7f 6b                	jg     8015eb <sys_env_destroy+0xab>
+}
+  801580:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801583:	5b                   	pop    %ebx
+  801584:	5e                   	pop    %esi
+  801585:	5f                   	pop    %edi
+  801586:	5d                   	pop    %ebp
+  801587:	c3                   	ret
+  801588:	b8 01 00 00 00       	mov    $0x1,%eax
+  80158d:	0f a2                	cpuid
+		return 0;
+  80158f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801594:	f6 c6 08             	test   $0x8,%dh
+  801597:	74 15                	je     8015ae <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801599:	89 c2                	mov    %eax,%edx
+  80159b:	c1 ea 08             	shr    $0x8,%edx
+  80159e:	83 e2 0f             	and    $0xf,%edx
+  8015a1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8015a6:	83 fa 06             	cmp    $0x6,%edx
+  8015a9:	74 0e                	je     8015b9 <sys_env_destroy+0x79>
+  8015ab:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8015ae:	0f b6 c9             	movzbl %cl,%ecx
+  8015b1:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8015b7:	eb 99                	jmp    801552 <sys_env_destroy+0x12>
+  8015b9:	89 c2                	mov    %eax,%edx
+  8015bb:	c1 ea 04             	shr    $0x4,%edx
+  8015be:	83 e2 0f             	and    $0xf,%edx
+  8015c1:	83 fa 02             	cmp    $0x2,%edx
+  8015c4:	77 e5                	ja     8015ab <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  8015c6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8015c9:	83 f8 02             	cmp    $0x2,%eax
+  8015cc:	0f 97 c1             	seta   %cl
+  8015cf:	0f b6 c9             	movzbl %cl,%ecx
+  8015d2:	eb d7                	jmp    8015ab <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  8015d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015d9:	b8 03 00 00 00       	mov    $0x3,%eax
+  8015de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015e1:	89 cb                	mov    %ecx,%ebx
+  8015e3:	89 cf                	mov    %ecx,%edi
+  8015e5:	89 ce                	mov    %ecx,%esi
+  8015e7:	cd 30                	int    $0x30
+  8015e9:	eb 91                	jmp    80157c <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015eb:	83 ec 0c             	sub    $0xc,%esp
+  8015ee:	50                   	push   %eax
+  8015ef:	6a 03                	push   $0x3
+  8015f1:	68 39 38 80 00       	push   $0x803839
+  8015f6:	6a 4a                	push   $0x4a
+  8015f8:	68 56 38 80 00       	push   $0x803856
+  8015fd:	e8 68 f1 ff ff       	call   80076a <_panic>
+
+00801602 <sys_getenvid>:
+{
+  801602:	55                   	push   %ebp
+  801603:	89 e5                	mov    %esp,%ebp
+  801605:	57                   	push   %edi
+  801606:	56                   	push   %esi
+  801607:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801608:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80160f:	78 2e                	js     80163f <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  801611:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801618:	74 71                	je     80168b <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  80161a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80161f:	b8 02 00 00 00       	mov    $0x2,%eax
+  801624:	89 d1                	mov    %edx,%ecx
+  801626:	89 d3                	mov    %edx,%ebx
+  801628:	89 d7                	mov    %edx,%edi
+  80162a:	89 d6                	mov    %edx,%esi
+  80162c:	55                   	push   %ebp
+  80162d:	68 36 16 80 00       	push   $0x801636
+  801632:	89 e5                	mov    %esp,%ebp
+  801634:	0f 34                	sysenter
+  801636:	83 c4 04             	add    $0x4,%esp
+  801639:	5d                   	pop    %ebp
+}
+  80163a:	5b                   	pop    %ebx
+  80163b:	5e                   	pop    %esi
+  80163c:	5f                   	pop    %edi
+  80163d:	5d                   	pop    %ebp
+  80163e:	c3                   	ret
+  80163f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801644:	0f a2                	cpuid
+		return 0;
+  801646:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80164b:	f6 c6 08             	test   $0x8,%dh
+  80164e:	74 15                	je     801665 <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801650:	89 c2                	mov    %eax,%edx
+  801652:	c1 ea 08             	shr    $0x8,%edx
+  801655:	83 e2 0f             	and    $0xf,%edx
+  801658:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80165d:	83 fa 06             	cmp    $0x6,%edx
+  801660:	74 0e                	je     801670 <sys_getenvid+0x6e>
+  801662:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801665:	0f b6 c9             	movzbl %cl,%ecx
+  801668:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80166e:	eb a1                	jmp    801611 <sys_getenvid+0xf>
+  801670:	89 c2                	mov    %eax,%edx
+  801672:	c1 ea 04             	shr    $0x4,%edx
+  801675:	83 e2 0f             	and    $0xf,%edx
+  801678:	83 fa 02             	cmp    $0x2,%edx
+  80167b:	77 e5                	ja     801662 <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  80167d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801680:	83 f8 02             	cmp    $0x2,%eax
+  801683:	0f 97 c1             	seta   %cl
+  801686:	0f b6 c9             	movzbl %cl,%ecx
+  801689:	eb d7                	jmp    801662 <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  80168b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801690:	b8 02 00 00 00       	mov    $0x2,%eax
+  801695:	89 d1                	mov    %edx,%ecx
+  801697:	89 d3                	mov    %edx,%ebx
+  801699:	89 d7                	mov    %edx,%edi
+  80169b:	89 d6                	mov    %edx,%esi
+  80169d:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80169f:	eb 99                	jmp    80163a <sys_getenvid+0x38>
+
+008016a1 <sys_page_alloc>:
+{
+  8016a1:	55                   	push   %ebp
+  8016a2:	89 e5                	mov    %esp,%ebp
+  8016a4:	57                   	push   %edi
+  8016a5:	56                   	push   %esi
+  8016a6:	53                   	push   %ebx
+  8016a7:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8016aa:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8016b1:	78 38                	js     8016eb <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  8016b3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8016ba:	74 7b                	je     801737 <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  8016bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8016c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016c7:	b8 04 00 00 00       	mov    $0x4,%eax
+  8016cc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016cf:	89 f7                	mov    %esi,%edi
+  8016d1:	55                   	push   %ebp
+  8016d2:	68 db 16 80 00       	push   $0x8016db
+  8016d7:	89 e5                	mov    %esp,%ebp
+  8016d9:	0f 34                	sysenter
+  8016db:	83 c4 04             	add    $0x4,%esp
+  8016de:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8016df:	85 c0                	test   %eax,%eax
+  8016e1:	7f 6d                	jg     801750 <sys_page_alloc+0xaf>
+}
+  8016e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016e6:	5b                   	pop    %ebx
+  8016e7:	5e                   	pop    %esi
+  8016e8:	5f                   	pop    %edi
+  8016e9:	5d                   	pop    %ebp
+  8016ea:	c3                   	ret
+  8016eb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016f0:	0f a2                	cpuid
+		return 0;
+  8016f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8016f7:	f6 c6 08             	test   $0x8,%dh
+  8016fa:	74 15                	je     801711 <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016fc:	89 c2                	mov    %eax,%edx
+  8016fe:	c1 ea 08             	shr    $0x8,%edx
+  801701:	83 e2 0f             	and    $0xf,%edx
+  801704:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801709:	83 fa 06             	cmp    $0x6,%edx
+  80170c:	74 0e                	je     80171c <sys_page_alloc+0x7b>
+  80170e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801711:	0f b6 c9             	movzbl %cl,%ecx
+  801714:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80171a:	eb 97                	jmp    8016b3 <sys_page_alloc+0x12>
+  80171c:	89 c2                	mov    %eax,%edx
+  80171e:	c1 ea 04             	shr    $0x4,%edx
+  801721:	83 e2 0f             	and    $0xf,%edx
+  801724:	83 fa 02             	cmp    $0x2,%edx
+  801727:	77 e5                	ja     80170e <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  801729:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80172c:	83 f8 02             	cmp    $0x2,%eax
+  80172f:	0f 97 c1             	seta   %cl
+  801732:	0f b6 c9             	movzbl %cl,%ecx
+  801735:	eb d7                	jmp    80170e <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  801737:	be 00 00 00 00       	mov    $0x0,%esi
+  80173c:	b8 04 00 00 00       	mov    $0x4,%eax
+  801741:	8b 55 08             	mov    0x8(%ebp),%edx
+  801744:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801747:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80174a:	89 f7                	mov    %esi,%edi
+  80174c:	cd 30                	int    $0x30
+  80174e:	eb 8f                	jmp    8016df <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801750:	83 ec 0c             	sub    $0xc,%esp
+  801753:	50                   	push   %eax
+  801754:	6a 04                	push   $0x4
+  801756:	68 39 38 80 00       	push   $0x803839
+  80175b:	6a 4a                	push   $0x4a
+  80175d:	68 56 38 80 00       	push   $0x803856
+  801762:	e8 03 f0 ff ff       	call   80076a <_panic>
+
+00801767 <sys_page_map>:
+{
+  801767:	55                   	push   %ebp
+  801768:	89 e5                	mov    %esp,%ebp
+  80176a:	57                   	push   %edi
+  80176b:	56                   	push   %esi
+  80176c:	53                   	push   %ebx
+  80176d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801770:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801777:	78 37                	js     8017b0 <sys_page_map+0x49>
+	if (syscall_sysenter)
+  801779:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801780:	74 7a                	je     8017fc <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  801782:	8b 55 08             	mov    0x8(%ebp),%edx
+  801785:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801788:	b8 05 00 00 00       	mov    $0x5,%eax
+  80178d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801790:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801793:	8b 75 18             	mov    0x18(%ebp),%esi
+  801796:	55                   	push   %ebp
+  801797:	68 a0 17 80 00       	push   $0x8017a0
+  80179c:	89 e5                	mov    %esp,%ebp
+  80179e:	0f 34                	sysenter
+  8017a0:	83 c4 04             	add    $0x4,%esp
+  8017a3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8017a4:	85 c0                	test   %eax,%eax
+  8017a6:	7f 6c                	jg     801814 <sys_page_map+0xad>
+}
+  8017a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017ab:	5b                   	pop    %ebx
+  8017ac:	5e                   	pop    %esi
+  8017ad:	5f                   	pop    %edi
+  8017ae:	5d                   	pop    %ebp
+  8017af:	c3                   	ret
+  8017b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8017b5:	0f a2                	cpuid
+		return 0;
+  8017b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8017bc:	f6 c6 08             	test   $0x8,%dh
+  8017bf:	74 15                	je     8017d6 <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017c1:	89 c2                	mov    %eax,%edx
+  8017c3:	c1 ea 08             	shr    $0x8,%edx
+  8017c6:	83 e2 0f             	and    $0xf,%edx
+  8017c9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017ce:	83 fa 06             	cmp    $0x6,%edx
+  8017d1:	74 0e                	je     8017e1 <sys_page_map+0x7a>
+  8017d3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8017d6:	0f b6 c9             	movzbl %cl,%ecx
+  8017d9:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8017df:	eb 98                	jmp    801779 <sys_page_map+0x12>
+  8017e1:	89 c2                	mov    %eax,%edx
+  8017e3:	c1 ea 04             	shr    $0x4,%edx
+  8017e6:	83 e2 0f             	and    $0xf,%edx
+  8017e9:	83 fa 02             	cmp    $0x2,%edx
+  8017ec:	77 e5                	ja     8017d3 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  8017ee:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017f1:	83 f8 02             	cmp    $0x2,%eax
+  8017f4:	0f 97 c1             	seta   %cl
+  8017f7:	0f b6 c9             	movzbl %cl,%ecx
+  8017fa:	eb d7                	jmp    8017d3 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  8017fc:	b8 05 00 00 00       	mov    $0x5,%eax
+  801801:	8b 55 08             	mov    0x8(%ebp),%edx
+  801804:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801807:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80180a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80180d:	8b 75 18             	mov    0x18(%ebp),%esi
+  801810:	cd 30                	int    $0x30
+  801812:	eb 90                	jmp    8017a4 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801814:	83 ec 0c             	sub    $0xc,%esp
+  801817:	50                   	push   %eax
+  801818:	6a 05                	push   $0x5
+  80181a:	68 39 38 80 00       	push   $0x803839
+  80181f:	6a 4a                	push   $0x4a
+  801821:	68 56 38 80 00       	push   $0x803856
+  801826:	e8 3f ef ff ff       	call   80076a <_panic>
+
+0080182b <sys_page_unmap>:
+{
+  80182b:	55                   	push   %ebp
+  80182c:	89 e5                	mov    %esp,%ebp
+  80182e:	57                   	push   %edi
+  80182f:	56                   	push   %esi
+  801830:	53                   	push   %ebx
+  801831:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801834:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80183b:	78 37                	js     801874 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  80183d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801844:	74 7a                	je     8018c0 <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  801846:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80184b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80184e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801851:	b8 06 00 00 00       	mov    $0x6,%eax
+  801856:	89 df                	mov    %ebx,%edi
+  801858:	89 de                	mov    %ebx,%esi
+  80185a:	55                   	push   %ebp
+  80185b:	68 64 18 80 00       	push   $0x801864
+  801860:	89 e5                	mov    %esp,%ebp
+  801862:	0f 34                	sysenter
+  801864:	83 c4 04             	add    $0x4,%esp
+  801867:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801868:	85 c0                	test   %eax,%eax
+  80186a:	7f 6c                	jg     8018d8 <sys_page_unmap+0xad>
+}
+  80186c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80186f:	5b                   	pop    %ebx
+  801870:	5e                   	pop    %esi
+  801871:	5f                   	pop    %edi
+  801872:	5d                   	pop    %ebp
+  801873:	c3                   	ret
+  801874:	b8 01 00 00 00       	mov    $0x1,%eax
+  801879:	0f a2                	cpuid
+		return 0;
+  80187b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801880:	f6 c6 08             	test   $0x8,%dh
+  801883:	74 15                	je     80189a <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801885:	89 c2                	mov    %eax,%edx
+  801887:	c1 ea 08             	shr    $0x8,%edx
+  80188a:	83 e2 0f             	and    $0xf,%edx
+  80188d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801892:	83 fa 06             	cmp    $0x6,%edx
+  801895:	74 0e                	je     8018a5 <sys_page_unmap+0x7a>
+  801897:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80189a:	0f b6 c9             	movzbl %cl,%ecx
+  80189d:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8018a3:	eb 98                	jmp    80183d <sys_page_unmap+0x12>
+  8018a5:	89 c2                	mov    %eax,%edx
+  8018a7:	c1 ea 04             	shr    $0x4,%edx
+  8018aa:	83 e2 0f             	and    $0xf,%edx
+  8018ad:	83 fa 02             	cmp    $0x2,%edx
+  8018b0:	77 e5                	ja     801897 <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  8018b2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018b5:	83 f8 02             	cmp    $0x2,%eax
+  8018b8:	0f 97 c1             	seta   %cl
+  8018bb:	0f b6 c9             	movzbl %cl,%ecx
+  8018be:	eb d7                	jmp    801897 <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  8018c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018c5:	b8 06 00 00 00       	mov    $0x6,%eax
+  8018ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018d0:	89 df                	mov    %ebx,%edi
+  8018d2:	89 de                	mov    %ebx,%esi
+  8018d4:	cd 30                	int    $0x30
+  8018d6:	eb 90                	jmp    801868 <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8018d8:	83 ec 0c             	sub    $0xc,%esp
+  8018db:	50                   	push   %eax
+  8018dc:	6a 06                	push   $0x6
+  8018de:	68 39 38 80 00       	push   $0x803839
+  8018e3:	6a 4a                	push   $0x4a
+  8018e5:	68 56 38 80 00       	push   $0x803856
+  8018ea:	e8 7b ee ff ff       	call   80076a <_panic>
+
+008018ef <sys_page_copy>:
+{
+  8018ef:	55                   	push   %ebp
+  8018f0:	89 e5                	mov    %esp,%ebp
+  8018f2:	57                   	push   %edi
+  8018f3:	56                   	push   %esi
+  8018f4:	53                   	push   %ebx
+  8018f5:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8018f8:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8018ff:	78 37                	js     801938 <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  801901:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801908:	74 7a                	je     801984 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  80190a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80190d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801910:	b8 29 00 00 00       	mov    $0x29,%eax
+  801915:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801918:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80191b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80191e:	55                   	push   %ebp
+  80191f:	68 28 19 80 00       	push   $0x801928
+  801924:	89 e5                	mov    %esp,%ebp
+  801926:	0f 34                	sysenter
+  801928:	83 c4 04             	add    $0x4,%esp
+  80192b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80192c:	85 c0                	test   %eax,%eax
+  80192e:	7f 6c                	jg     80199c <sys_page_copy+0xad>
+}
+  801930:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801933:	5b                   	pop    %ebx
+  801934:	5e                   	pop    %esi
+  801935:	5f                   	pop    %edi
+  801936:	5d                   	pop    %ebp
+  801937:	c3                   	ret
+  801938:	b8 01 00 00 00       	mov    $0x1,%eax
+  80193d:	0f a2                	cpuid
+		return 0;
+  80193f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801944:	f6 c6 08             	test   $0x8,%dh
+  801947:	74 15                	je     80195e <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801949:	89 c2                	mov    %eax,%edx
+  80194b:	c1 ea 08             	shr    $0x8,%edx
+  80194e:	83 e2 0f             	and    $0xf,%edx
+  801951:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801956:	83 fa 06             	cmp    $0x6,%edx
+  801959:	74 0e                	je     801969 <sys_page_copy+0x7a>
+  80195b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80195e:	0f b6 c9             	movzbl %cl,%ecx
+  801961:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801967:	eb 98                	jmp    801901 <sys_page_copy+0x12>
+  801969:	89 c2                	mov    %eax,%edx
+  80196b:	c1 ea 04             	shr    $0x4,%edx
+  80196e:	83 e2 0f             	and    $0xf,%edx
+  801971:	83 fa 02             	cmp    $0x2,%edx
+  801974:	77 e5                	ja     80195b <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  801976:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801979:	83 f8 02             	cmp    $0x2,%eax
+  80197c:	0f 97 c1             	seta   %cl
+  80197f:	0f b6 c9             	movzbl %cl,%ecx
+  801982:	eb d7                	jmp    80195b <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  801984:	b8 29 00 00 00       	mov    $0x29,%eax
+  801989:	8b 55 08             	mov    0x8(%ebp),%edx
+  80198c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80198f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801992:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801995:	8b 75 18             	mov    0x18(%ebp),%esi
+  801998:	cd 30                	int    $0x30
+  80199a:	eb 90                	jmp    80192c <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80199c:	83 ec 0c             	sub    $0xc,%esp
+  80199f:	50                   	push   %eax
+  8019a0:	6a 29                	push   $0x29
+  8019a2:	68 39 38 80 00       	push   $0x803839
+  8019a7:	6a 4a                	push   $0x4a
+  8019a9:	68 56 38 80 00       	push   $0x803856
+  8019ae:	e8 b7 ed ff ff       	call   80076a <_panic>
+
+008019b3 <sys_yield>:
+{
+  8019b3:	55                   	push   %ebp
+  8019b4:	89 e5                	mov    %esp,%ebp
+  8019b6:	57                   	push   %edi
+  8019b7:	56                   	push   %esi
+  8019b8:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8019b9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8019c0:	78 2e                	js     8019f0 <sys_yield+0x3d>
+	if (syscall_sysenter)
+  8019c2:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8019c9:	74 71                	je     801a3c <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  8019cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019d0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8019d5:	89 d1                	mov    %edx,%ecx
+  8019d7:	89 d3                	mov    %edx,%ebx
+  8019d9:	89 d7                	mov    %edx,%edi
+  8019db:	89 d6                	mov    %edx,%esi
+  8019dd:	55                   	push   %ebp
+  8019de:	68 e7 19 80 00       	push   $0x8019e7
+  8019e3:	89 e5                	mov    %esp,%ebp
+  8019e5:	0f 34                	sysenter
+  8019e7:	83 c4 04             	add    $0x4,%esp
+  8019ea:	5d                   	pop    %ebp
+}
+  8019eb:	5b                   	pop    %ebx
+  8019ec:	5e                   	pop    %esi
+  8019ed:	5f                   	pop    %edi
+  8019ee:	5d                   	pop    %ebp
+  8019ef:	c3                   	ret
+  8019f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019f5:	0f a2                	cpuid
+		return 0;
+  8019f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8019fc:	f6 c6 08             	test   $0x8,%dh
+  8019ff:	74 15                	je     801a16 <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a01:	89 c2                	mov    %eax,%edx
+  801a03:	c1 ea 08             	shr    $0x8,%edx
+  801a06:	83 e2 0f             	and    $0xf,%edx
+  801a09:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a0e:	83 fa 06             	cmp    $0x6,%edx
+  801a11:	74 0e                	je     801a21 <sys_yield+0x6e>
+  801a13:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a16:	0f b6 c9             	movzbl %cl,%ecx
+  801a19:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801a1f:	eb a1                	jmp    8019c2 <sys_yield+0xf>
+  801a21:	89 c2                	mov    %eax,%edx
+  801a23:	c1 ea 04             	shr    $0x4,%edx
+  801a26:	83 e2 0f             	and    $0xf,%edx
+  801a29:	83 fa 02             	cmp    $0x2,%edx
+  801a2c:	77 e5                	ja     801a13 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  801a2e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a31:	83 f8 02             	cmp    $0x2,%eax
+  801a34:	0f 97 c1             	seta   %cl
+  801a37:	0f b6 c9             	movzbl %cl,%ecx
+  801a3a:	eb d7                	jmp    801a13 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  801a3c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a41:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801a46:	89 d1                	mov    %edx,%ecx
+  801a48:	89 d3                	mov    %edx,%ebx
+  801a4a:	89 d7                	mov    %edx,%edi
+  801a4c:	89 d6                	mov    %edx,%esi
+  801a4e:	cd 30                	int    $0x30
+}
+  801a50:	eb 99                	jmp    8019eb <sys_yield+0x38>
+
+00801a52 <sys_env_set_status>:
+{
+  801a52:	55                   	push   %ebp
+  801a53:	89 e5                	mov    %esp,%ebp
+  801a55:	57                   	push   %edi
+  801a56:	56                   	push   %esi
+  801a57:	53                   	push   %ebx
+  801a58:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801a5b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a62:	78 37                	js     801a9b <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  801a64:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801a6b:	74 7a                	je     801ae7 <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  801a6d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a72:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a75:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a78:	b8 08 00 00 00       	mov    $0x8,%eax
+  801a7d:	89 df                	mov    %ebx,%edi
+  801a7f:	89 de                	mov    %ebx,%esi
+  801a81:	55                   	push   %ebp
+  801a82:	68 8b 1a 80 00       	push   $0x801a8b
+  801a87:	89 e5                	mov    %esp,%ebp
+  801a89:	0f 34                	sysenter
+  801a8b:	83 c4 04             	add    $0x4,%esp
+  801a8e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801a8f:	85 c0                	test   %eax,%eax
+  801a91:	7f 6c                	jg     801aff <sys_env_set_status+0xad>
+}
+  801a93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a96:	5b                   	pop    %ebx
+  801a97:	5e                   	pop    %esi
+  801a98:	5f                   	pop    %edi
+  801a99:	5d                   	pop    %ebp
+  801a9a:	c3                   	ret
+  801a9b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801aa0:	0f a2                	cpuid
+		return 0;
+  801aa2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801aa7:	f6 c6 08             	test   $0x8,%dh
+  801aaa:	74 15                	je     801ac1 <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801aac:	89 c2                	mov    %eax,%edx
+  801aae:	c1 ea 08             	shr    $0x8,%edx
+  801ab1:	83 e2 0f             	and    $0xf,%edx
+  801ab4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ab9:	83 fa 06             	cmp    $0x6,%edx
+  801abc:	74 0e                	je     801acc <sys_env_set_status+0x7a>
+  801abe:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801ac1:	0f b6 c9             	movzbl %cl,%ecx
+  801ac4:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801aca:	eb 98                	jmp    801a64 <sys_env_set_status+0x12>
+  801acc:	89 c2                	mov    %eax,%edx
+  801ace:	c1 ea 04             	shr    $0x4,%edx
+  801ad1:	83 e2 0f             	and    $0xf,%edx
+  801ad4:	83 fa 02             	cmp    $0x2,%edx
+  801ad7:	77 e5                	ja     801abe <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  801ad9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801adc:	83 f8 02             	cmp    $0x2,%eax
+  801adf:	0f 97 c1             	seta   %cl
+  801ae2:	0f b6 c9             	movzbl %cl,%ecx
+  801ae5:	eb d7                	jmp    801abe <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  801ae7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aec:	b8 08 00 00 00       	mov    $0x8,%eax
+  801af1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801af4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801af7:	89 df                	mov    %ebx,%edi
+  801af9:	89 de                	mov    %ebx,%esi
+  801afb:	cd 30                	int    $0x30
+  801afd:	eb 90                	jmp    801a8f <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801aff:	83 ec 0c             	sub    $0xc,%esp
+  801b02:	50                   	push   %eax
+  801b03:	6a 08                	push   $0x8
+  801b05:	68 39 38 80 00       	push   $0x803839
+  801b0a:	6a 4a                	push   $0x4a
+  801b0c:	68 56 38 80 00       	push   $0x803856
+  801b11:	e8 54 ec ff ff       	call   80076a <_panic>
+
+00801b16 <sys_sysinfo>:
+{
+  801b16:	55                   	push   %ebp
+  801b17:	89 e5                	mov    %esp,%ebp
+  801b19:	57                   	push   %edi
+  801b1a:	56                   	push   %esi
+  801b1b:	53                   	push   %ebx
+  801b1c:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801b1f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b26:	78 36                	js     801b5e <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  801b28:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b2f:	74 79                	je     801baa <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  801b31:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b34:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b39:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801b3e:	89 cb                	mov    %ecx,%ebx
+  801b40:	89 cf                	mov    %ecx,%edi
+  801b42:	89 ce                	mov    %ecx,%esi
+  801b44:	55                   	push   %ebp
+  801b45:	68 4e 1b 80 00       	push   $0x801b4e
+  801b4a:	89 e5                	mov    %esp,%ebp
+  801b4c:	0f 34                	sysenter
+  801b4e:	83 c4 04             	add    $0x4,%esp
+  801b51:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801b52:	85 c0                	test   %eax,%eax
+  801b54:	7f 6b                	jg     801bc1 <sys_sysinfo+0xab>
+}
+  801b56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b59:	5b                   	pop    %ebx
+  801b5a:	5e                   	pop    %esi
+  801b5b:	5f                   	pop    %edi
+  801b5c:	5d                   	pop    %ebp
+  801b5d:	c3                   	ret
+  801b5e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b63:	0f a2                	cpuid
+		return 0;
+  801b65:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b6a:	f6 c6 08             	test   $0x8,%dh
+  801b6d:	74 15                	je     801b84 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b6f:	89 c2                	mov    %eax,%edx
+  801b71:	c1 ea 08             	shr    $0x8,%edx
+  801b74:	83 e2 0f             	and    $0xf,%edx
+  801b77:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b7c:	83 fa 06             	cmp    $0x6,%edx
+  801b7f:	74 0e                	je     801b8f <sys_sysinfo+0x79>
+  801b81:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b84:	0f b6 c9             	movzbl %cl,%ecx
+  801b87:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801b8d:	eb 99                	jmp    801b28 <sys_sysinfo+0x12>
+  801b8f:	89 c2                	mov    %eax,%edx
+  801b91:	c1 ea 04             	shr    $0x4,%edx
+  801b94:	83 e2 0f             	and    $0xf,%edx
+  801b97:	83 fa 02             	cmp    $0x2,%edx
+  801b9a:	77 e5                	ja     801b81 <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  801b9c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b9f:	83 f8 02             	cmp    $0x2,%eax
+  801ba2:	0f 97 c1             	seta   %cl
+  801ba5:	0f b6 c9             	movzbl %cl,%ecx
+  801ba8:	eb d7                	jmp    801b81 <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  801baa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801baf:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801bb4:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bb7:	89 cb                	mov    %ecx,%ebx
+  801bb9:	89 cf                	mov    %ecx,%edi
+  801bbb:	89 ce                	mov    %ecx,%esi
+  801bbd:	cd 30                	int    $0x30
+  801bbf:	eb 91                	jmp    801b52 <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801bc1:	83 ec 0c             	sub    $0xc,%esp
+  801bc4:	50                   	push   %eax
+  801bc5:	6a 0b                	push   $0xb
+  801bc7:	68 39 38 80 00       	push   $0x803839
+  801bcc:	6a 4a                	push   $0x4a
+  801bce:	68 56 38 80 00       	push   $0x803856
+  801bd3:	e8 92 eb ff ff       	call   80076a <_panic>
+
+00801bd8 <sys_env_set_trapframe>:
+{
+  801bd8:	55                   	push   %ebp
+  801bd9:	89 e5                	mov    %esp,%ebp
+  801bdb:	57                   	push   %edi
+  801bdc:	56                   	push   %esi
+  801bdd:	53                   	push   %ebx
+  801bde:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801be1:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801be8:	78 37                	js     801c21 <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  801bea:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801bf1:	74 7a                	je     801c6d <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  801bf3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bf8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bfb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bfe:	b8 13 00 00 00       	mov    $0x13,%eax
+  801c03:	89 df                	mov    %ebx,%edi
+  801c05:	89 de                	mov    %ebx,%esi
+  801c07:	55                   	push   %ebp
+  801c08:	68 11 1c 80 00       	push   $0x801c11
+  801c0d:	89 e5                	mov    %esp,%ebp
+  801c0f:	0f 34                	sysenter
+  801c11:	83 c4 04             	add    $0x4,%esp
+  801c14:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801c15:	85 c0                	test   %eax,%eax
+  801c17:	7f 6c                	jg     801c85 <sys_env_set_trapframe+0xad>
+}
+  801c19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c1c:	5b                   	pop    %ebx
+  801c1d:	5e                   	pop    %esi
+  801c1e:	5f                   	pop    %edi
+  801c1f:	5d                   	pop    %ebp
+  801c20:	c3                   	ret
+  801c21:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c26:	0f a2                	cpuid
+		return 0;
+  801c28:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801c2d:	f6 c6 08             	test   $0x8,%dh
+  801c30:	74 15                	je     801c47 <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c32:	89 c2                	mov    %eax,%edx
+  801c34:	c1 ea 08             	shr    $0x8,%edx
+  801c37:	83 e2 0f             	and    $0xf,%edx
+  801c3a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801c3f:	83 fa 06             	cmp    $0x6,%edx
+  801c42:	74 0e                	je     801c52 <sys_env_set_trapframe+0x7a>
+  801c44:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801c47:	0f b6 c9             	movzbl %cl,%ecx
+  801c4a:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801c50:	eb 98                	jmp    801bea <sys_env_set_trapframe+0x12>
+  801c52:	89 c2                	mov    %eax,%edx
+  801c54:	c1 ea 04             	shr    $0x4,%edx
+  801c57:	83 e2 0f             	and    $0xf,%edx
+  801c5a:	83 fa 02             	cmp    $0x2,%edx
+  801c5d:	77 e5                	ja     801c44 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  801c5f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c62:	83 f8 02             	cmp    $0x2,%eax
+  801c65:	0f 97 c1             	seta   %cl
+  801c68:	0f b6 c9             	movzbl %cl,%ecx
+  801c6b:	eb d7                	jmp    801c44 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  801c6d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c72:	b8 13 00 00 00       	mov    $0x13,%eax
+  801c77:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c7a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c7d:	89 df                	mov    %ebx,%edi
+  801c7f:	89 de                	mov    %ebx,%esi
+  801c81:	cd 30                	int    $0x30
+  801c83:	eb 90                	jmp    801c15 <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801c85:	83 ec 0c             	sub    $0xc,%esp
+  801c88:	50                   	push   %eax
+  801c89:	6a 13                	push   $0x13
+  801c8b:	68 39 38 80 00       	push   $0x803839
+  801c90:	6a 4a                	push   $0x4a
+  801c92:	68 56 38 80 00       	push   $0x803856
+  801c97:	e8 ce ea ff ff       	call   80076a <_panic>
+
+00801c9c <sys_env_set_stack_limit>:
+{
+  801c9c:	55                   	push   %ebp
+  801c9d:	89 e5                	mov    %esp,%ebp
+  801c9f:	57                   	push   %edi
+  801ca0:	56                   	push   %esi
+  801ca1:	53                   	push   %ebx
+  801ca2:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801ca5:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801cac:	78 37                	js     801ce5 <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  801cae:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801cb5:	74 7a                	je     801d31 <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  801cb7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cbc:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cbf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cc2:	b8 19 00 00 00       	mov    $0x19,%eax
+  801cc7:	89 df                	mov    %ebx,%edi
+  801cc9:	89 de                	mov    %ebx,%esi
+  801ccb:	55                   	push   %ebp
+  801ccc:	68 d5 1c 80 00       	push   $0x801cd5
+  801cd1:	89 e5                	mov    %esp,%ebp
+  801cd3:	0f 34                	sysenter
+  801cd5:	83 c4 04             	add    $0x4,%esp
+  801cd8:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801cd9:	85 c0                	test   %eax,%eax
+  801cdb:	7f 6c                	jg     801d49 <sys_env_set_stack_limit+0xad>
+}
+  801cdd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ce0:	5b                   	pop    %ebx
+  801ce1:	5e                   	pop    %esi
+  801ce2:	5f                   	pop    %edi
+  801ce3:	5d                   	pop    %ebp
+  801ce4:	c3                   	ret
+  801ce5:	b8 01 00 00 00       	mov    $0x1,%eax
+  801cea:	0f a2                	cpuid
+		return 0;
+  801cec:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801cf1:	f6 c6 08             	test   $0x8,%dh
+  801cf4:	74 15                	je     801d0b <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801cf6:	89 c2                	mov    %eax,%edx
+  801cf8:	c1 ea 08             	shr    $0x8,%edx
+  801cfb:	83 e2 0f             	and    $0xf,%edx
+  801cfe:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d03:	83 fa 06             	cmp    $0x6,%edx
+  801d06:	74 0e                	je     801d16 <sys_env_set_stack_limit+0x7a>
+  801d08:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801d0b:	0f b6 c9             	movzbl %cl,%ecx
+  801d0e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801d14:	eb 98                	jmp    801cae <sys_env_set_stack_limit+0x12>
+  801d16:	89 c2                	mov    %eax,%edx
+  801d18:	c1 ea 04             	shr    $0x4,%edx
+  801d1b:	83 e2 0f             	and    $0xf,%edx
+  801d1e:	83 fa 02             	cmp    $0x2,%edx
+  801d21:	77 e5                	ja     801d08 <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  801d23:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d26:	83 f8 02             	cmp    $0x2,%eax
+  801d29:	0f 97 c1             	seta   %cl
+  801d2c:	0f b6 c9             	movzbl %cl,%ecx
+  801d2f:	eb d7                	jmp    801d08 <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  801d31:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d36:	b8 19 00 00 00       	mov    $0x19,%eax
+  801d3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d3e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d41:	89 df                	mov    %ebx,%edi
+  801d43:	89 de                	mov    %ebx,%esi
+  801d45:	cd 30                	int    $0x30
+  801d47:	eb 90                	jmp    801cd9 <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801d49:	83 ec 0c             	sub    $0xc,%esp
+  801d4c:	50                   	push   %eax
+  801d4d:	6a 19                	push   $0x19
+  801d4f:	68 39 38 80 00       	push   $0x803839
+  801d54:	6a 4a                	push   $0x4a
+  801d56:	68 56 38 80 00       	push   $0x803856
+  801d5b:	e8 0a ea ff ff       	call   80076a <_panic>
+
+00801d60 <sys_env_set_pgfault_upcall>:
+{
+  801d60:	55                   	push   %ebp
+  801d61:	89 e5                	mov    %esp,%ebp
+  801d63:	57                   	push   %edi
+  801d64:	56                   	push   %esi
+  801d65:	53                   	push   %ebx
+  801d66:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801d69:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801d70:	78 37                	js     801da9 <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  801d72:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801d79:	74 7a                	je     801df5 <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  801d7b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d80:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d83:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d86:	b8 09 00 00 00       	mov    $0x9,%eax
+  801d8b:	89 df                	mov    %ebx,%edi
+  801d8d:	89 de                	mov    %ebx,%esi
+  801d8f:	55                   	push   %ebp
+  801d90:	68 99 1d 80 00       	push   $0x801d99
+  801d95:	89 e5                	mov    %esp,%ebp
+  801d97:	0f 34                	sysenter
+  801d99:	83 c4 04             	add    $0x4,%esp
+  801d9c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801d9d:	85 c0                	test   %eax,%eax
+  801d9f:	7f 6c                	jg     801e0d <sys_env_set_pgfault_upcall+0xad>
+}
+  801da1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801da4:	5b                   	pop    %ebx
+  801da5:	5e                   	pop    %esi
+  801da6:	5f                   	pop    %edi
+  801da7:	5d                   	pop    %ebp
+  801da8:	c3                   	ret
+  801da9:	b8 01 00 00 00       	mov    $0x1,%eax
+  801dae:	0f a2                	cpuid
+		return 0;
+  801db0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801db5:	f6 c6 08             	test   $0x8,%dh
+  801db8:	74 15                	je     801dcf <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801dba:	89 c2                	mov    %eax,%edx
+  801dbc:	c1 ea 08             	shr    $0x8,%edx
+  801dbf:	83 e2 0f             	and    $0xf,%edx
+  801dc2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801dc7:	83 fa 06             	cmp    $0x6,%edx
+  801dca:	74 0e                	je     801dda <sys_env_set_pgfault_upcall+0x7a>
+  801dcc:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801dcf:	0f b6 c9             	movzbl %cl,%ecx
+  801dd2:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801dd8:	eb 98                	jmp    801d72 <sys_env_set_pgfault_upcall+0x12>
+  801dda:	89 c2                	mov    %eax,%edx
+  801ddc:	c1 ea 04             	shr    $0x4,%edx
+  801ddf:	83 e2 0f             	and    $0xf,%edx
+  801de2:	83 fa 02             	cmp    $0x2,%edx
+  801de5:	77 e5                	ja     801dcc <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  801de7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801dea:	83 f8 02             	cmp    $0x2,%eax
+  801ded:	0f 97 c1             	seta   %cl
+  801df0:	0f b6 c9             	movzbl %cl,%ecx
+  801df3:	eb d7                	jmp    801dcc <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  801df5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dfa:	b8 09 00 00 00       	mov    $0x9,%eax
+  801dff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e02:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e05:	89 df                	mov    %ebx,%edi
+  801e07:	89 de                	mov    %ebx,%esi
+  801e09:	cd 30                	int    $0x30
+  801e0b:	eb 90                	jmp    801d9d <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801e0d:	83 ec 0c             	sub    $0xc,%esp
+  801e10:	50                   	push   %eax
+  801e11:	6a 09                	push   $0x9
+  801e13:	68 39 38 80 00       	push   $0x803839
+  801e18:	6a 4a                	push   $0x4a
+  801e1a:	68 56 38 80 00       	push   $0x803856
+  801e1f:	e8 46 e9 ff ff       	call   80076a <_panic>
+
+00801e24 <sys_ipc_try_send>:
+{
+  801e24:	55                   	push   %ebp
+  801e25:	89 e5                	mov    %esp,%ebp
+  801e27:	57                   	push   %edi
+  801e28:	56                   	push   %esi
+  801e29:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801e2a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e31:	78 32                	js     801e65 <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  801e33:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801e3a:	74 75                	je     801eb1 <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801e3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e3f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e42:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801e47:	be 00 00 00 00       	mov    $0x0,%esi
+  801e4c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e4f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801e52:	55                   	push   %ebp
+  801e53:	68 5c 1e 80 00       	push   $0x801e5c
+  801e58:	89 e5                	mov    %esp,%ebp
+  801e5a:	0f 34                	sysenter
+  801e5c:	83 c4 04             	add    $0x4,%esp
+  801e5f:	5d                   	pop    %ebp
+}
+  801e60:	5b                   	pop    %ebx
+  801e61:	5e                   	pop    %esi
+  801e62:	5f                   	pop    %edi
+  801e63:	5d                   	pop    %ebp
+  801e64:	c3                   	ret
+  801e65:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e6a:	0f a2                	cpuid
+		return 0;
+  801e6c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801e71:	f6 c6 08             	test   $0x8,%dh
+  801e74:	74 15                	je     801e8b <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e76:	89 c2                	mov    %eax,%edx
+  801e78:	c1 ea 08             	shr    $0x8,%edx
+  801e7b:	83 e2 0f             	and    $0xf,%edx
+  801e7e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e83:	83 fa 06             	cmp    $0x6,%edx
+  801e86:	74 0e                	je     801e96 <sys_ipc_try_send+0x72>
+  801e88:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801e8b:	0f b6 c9             	movzbl %cl,%ecx
+  801e8e:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801e94:	eb 9d                	jmp    801e33 <sys_ipc_try_send+0xf>
+  801e96:	89 c2                	mov    %eax,%edx
+  801e98:	c1 ea 04             	shr    $0x4,%edx
+  801e9b:	83 e2 0f             	and    $0xf,%edx
+  801e9e:	83 fa 02             	cmp    $0x2,%edx
+  801ea1:	77 e5                	ja     801e88 <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  801ea3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ea6:	83 f8 02             	cmp    $0x2,%eax
+  801ea9:	0f 97 c1             	seta   %cl
+  801eac:	0f b6 c9             	movzbl %cl,%ecx
+  801eaf:	eb d7                	jmp    801e88 <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  801eb1:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801eb6:	be 00 00 00 00       	mov    $0x0,%esi
+  801ebb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ebe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ec1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ec4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ec7:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801ec9:	eb 95                	jmp    801e60 <sys_ipc_try_send+0x3c>
+
+00801ecb <sys_ipc_send>:
+{
+  801ecb:	55                   	push   %ebp
+  801ecc:	89 e5                	mov    %esp,%ebp
+  801ece:	57                   	push   %edi
+  801ecf:	56                   	push   %esi
+  801ed0:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801ed1:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ed8:	78 32                	js     801f0c <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  801eda:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ee1:	74 75                	je     801f58 <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801ee3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ee6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ee9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801eee:	be 00 00 00 00       	mov    $0x0,%esi
+  801ef3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ef6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ef9:	55                   	push   %ebp
+  801efa:	68 03 1f 80 00       	push   $0x801f03
+  801eff:	89 e5                	mov    %esp,%ebp
+  801f01:	0f 34                	sysenter
+  801f03:	83 c4 04             	add    $0x4,%esp
+  801f06:	5d                   	pop    %ebp
+}
+  801f07:	5b                   	pop    %ebx
+  801f08:	5e                   	pop    %esi
+  801f09:	5f                   	pop    %edi
+  801f0a:	5d                   	pop    %ebp
+  801f0b:	c3                   	ret
+  801f0c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f11:	0f a2                	cpuid
+		return 0;
+  801f13:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801f18:	f6 c6 08             	test   $0x8,%dh
+  801f1b:	74 15                	je     801f32 <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f1d:	89 c2                	mov    %eax,%edx
+  801f1f:	c1 ea 08             	shr    $0x8,%edx
+  801f22:	83 e2 0f             	and    $0xf,%edx
+  801f25:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f2a:	83 fa 06             	cmp    $0x6,%edx
+  801f2d:	74 0e                	je     801f3d <sys_ipc_send+0x72>
+  801f2f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801f32:	0f b6 c9             	movzbl %cl,%ecx
+  801f35:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801f3b:	eb 9d                	jmp    801eda <sys_ipc_send+0xf>
+  801f3d:	89 c2                	mov    %eax,%edx
+  801f3f:	c1 ea 04             	shr    $0x4,%edx
+  801f42:	83 e2 0f             	and    $0xf,%edx
+  801f45:	83 fa 02             	cmp    $0x2,%edx
+  801f48:	77 e5                	ja     801f2f <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  801f4a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f4d:	83 f8 02             	cmp    $0x2,%eax
+  801f50:	0f 97 c1             	seta   %cl
+  801f53:	0f b6 c9             	movzbl %cl,%ecx
+  801f56:	eb d7                	jmp    801f2f <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  801f58:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801f5d:	be 00 00 00 00       	mov    $0x0,%esi
+  801f62:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f65:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f68:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f6b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801f6e:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801f70:	eb 95                	jmp    801f07 <sys_ipc_send+0x3c>
+
+00801f72 <sys_ipc_recv>:
+{
+  801f72:	55                   	push   %ebp
+  801f73:	89 e5                	mov    %esp,%ebp
+  801f75:	57                   	push   %edi
+  801f76:	56                   	push   %esi
+  801f77:	53                   	push   %ebx
+  801f78:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801f7b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f82:	78 36                	js     801fba <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  801f84:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801f8b:	74 79                	je     802006 <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  801f8d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f90:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f95:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801f9a:	89 cb                	mov    %ecx,%ebx
+  801f9c:	89 cf                	mov    %ecx,%edi
+  801f9e:	89 ce                	mov    %ecx,%esi
+  801fa0:	55                   	push   %ebp
+  801fa1:	68 aa 1f 80 00       	push   $0x801faa
+  801fa6:	89 e5                	mov    %esp,%ebp
+  801fa8:	0f 34                	sysenter
+  801faa:	83 c4 04             	add    $0x4,%esp
+  801fad:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801fae:	85 c0                	test   %eax,%eax
+  801fb0:	7f 6b                	jg     80201d <sys_ipc_recv+0xab>
+}
+  801fb2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fb5:	5b                   	pop    %ebx
+  801fb6:	5e                   	pop    %esi
+  801fb7:	5f                   	pop    %edi
+  801fb8:	5d                   	pop    %ebp
+  801fb9:	c3                   	ret
+  801fba:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fbf:	0f a2                	cpuid
+		return 0;
+  801fc1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801fc6:	f6 c6 08             	test   $0x8,%dh
+  801fc9:	74 15                	je     801fe0 <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fcb:	89 c2                	mov    %eax,%edx
+  801fcd:	c1 ea 08             	shr    $0x8,%edx
+  801fd0:	83 e2 0f             	and    $0xf,%edx
+  801fd3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801fd8:	83 fa 06             	cmp    $0x6,%edx
+  801fdb:	74 0e                	je     801feb <sys_ipc_recv+0x79>
+  801fdd:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801fe0:	0f b6 c9             	movzbl %cl,%ecx
+  801fe3:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  801fe9:	eb 99                	jmp    801f84 <sys_ipc_recv+0x12>
+  801feb:	89 c2                	mov    %eax,%edx
+  801fed:	c1 ea 04             	shr    $0x4,%edx
+  801ff0:	83 e2 0f             	and    $0xf,%edx
+  801ff3:	83 fa 02             	cmp    $0x2,%edx
+  801ff6:	77 e5                	ja     801fdd <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  801ff8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ffb:	83 f8 02             	cmp    $0x2,%eax
+  801ffe:	0f 97 c1             	seta   %cl
+  802001:	0f b6 c9             	movzbl %cl,%ecx
+  802004:	eb d7                	jmp    801fdd <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  802006:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80200b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802010:	8b 55 08             	mov    0x8(%ebp),%edx
+  802013:	89 cb                	mov    %ecx,%ebx
+  802015:	89 cf                	mov    %ecx,%edi
+  802017:	89 ce                	mov    %ecx,%esi
+  802019:	cd 30                	int    $0x30
+  80201b:	eb 91                	jmp    801fae <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80201d:	83 ec 0c             	sub    $0xc,%esp
+  802020:	50                   	push   %eax
+  802021:	6a 0d                	push   $0xd
+  802023:	68 39 38 80 00       	push   $0x803839
+  802028:	6a 4a                	push   $0x4a
+  80202a:	68 56 38 80 00       	push   $0x803856
+  80202f:	e8 36 e7 ff ff       	call   80076a <_panic>
+
+00802034 <sys_ipc_send_range>:
+{
+  802034:	55                   	push   %ebp
+  802035:	89 e5                	mov    %esp,%ebp
+  802037:	57                   	push   %edi
+  802038:	56                   	push   %esi
+  802039:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80203a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802041:	78 30                	js     802073 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  802043:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80204a:	74 73                	je     8020bf <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  80204c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80204f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802052:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  802057:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80205a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80205d:	8b 75 18             	mov    0x18(%ebp),%esi
+  802060:	55                   	push   %ebp
+  802061:	68 6a 20 80 00       	push   $0x80206a
+  802066:	89 e5                	mov    %esp,%ebp
+  802068:	0f 34                	sysenter
+  80206a:	83 c4 04             	add    $0x4,%esp
+  80206d:	5d                   	pop    %ebp
+}
+  80206e:	5b                   	pop    %ebx
+  80206f:	5e                   	pop    %esi
+  802070:	5f                   	pop    %edi
+  802071:	5d                   	pop    %ebp
+  802072:	c3                   	ret
+  802073:	b8 01 00 00 00       	mov    $0x1,%eax
+  802078:	0f a2                	cpuid
+		return 0;
+  80207a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80207f:	f6 c6 08             	test   $0x8,%dh
+  802082:	74 15                	je     802099 <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802084:	89 c2                	mov    %eax,%edx
+  802086:	c1 ea 08             	shr    $0x8,%edx
+  802089:	83 e2 0f             	and    $0xf,%edx
+  80208c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802091:	83 fa 06             	cmp    $0x6,%edx
+  802094:	74 0e                	je     8020a4 <sys_ipc_send_range+0x70>
+  802096:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802099:	0f b6 c9             	movzbl %cl,%ecx
+  80209c:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8020a2:	eb 9f                	jmp    802043 <sys_ipc_send_range+0xf>
+  8020a4:	89 c2                	mov    %eax,%edx
+  8020a6:	c1 ea 04             	shr    $0x4,%edx
+  8020a9:	83 e2 0f             	and    $0xf,%edx
+  8020ac:	83 fa 02             	cmp    $0x2,%edx
+  8020af:	77 e5                	ja     802096 <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  8020b1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020b4:	83 f8 02             	cmp    $0x2,%eax
+  8020b7:	0f 97 c1             	seta   %cl
+  8020ba:	0f b6 c9             	movzbl %cl,%ecx
+  8020bd:	eb d7                	jmp    802096 <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  8020bf:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8020c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020ca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8020cd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8020d0:	8b 75 18             	mov    0x18(%ebp),%esi
+  8020d3:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  8020d5:	eb 97                	jmp    80206e <sys_ipc_send_range+0x3a>
+
+008020d7 <sys_ipc_recv_range>:
+{
+  8020d7:	55                   	push   %ebp
+  8020d8:	89 e5                	mov    %esp,%ebp
+  8020da:	57                   	push   %edi
+  8020db:	56                   	push   %esi
+  8020dc:	53                   	push   %ebx
+  8020dd:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8020e0:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8020e7:	78 37                	js     802120 <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  8020e9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8020f0:	74 7a                	je     80216c <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  8020f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020fd:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  802102:	89 df                	mov    %ebx,%edi
+  802104:	89 de                	mov    %ebx,%esi
+  802106:	55                   	push   %ebp
+  802107:	68 10 21 80 00       	push   $0x802110
+  80210c:	89 e5                	mov    %esp,%ebp
+  80210e:	0f 34                	sysenter
+  802110:	83 c4 04             	add    $0x4,%esp
+  802113:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802114:	85 c0                	test   %eax,%eax
+  802116:	7f 6c                	jg     802184 <sys_ipc_recv_range+0xad>
+}
+  802118:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80211b:	5b                   	pop    %ebx
+  80211c:	5e                   	pop    %esi
+  80211d:	5f                   	pop    %edi
+  80211e:	5d                   	pop    %ebp
+  80211f:	c3                   	ret
+  802120:	b8 01 00 00 00       	mov    $0x1,%eax
+  802125:	0f a2                	cpuid
+		return 0;
+  802127:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80212c:	f6 c6 08             	test   $0x8,%dh
+  80212f:	74 15                	je     802146 <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802131:	89 c2                	mov    %eax,%edx
+  802133:	c1 ea 08             	shr    $0x8,%edx
+  802136:	83 e2 0f             	and    $0xf,%edx
+  802139:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80213e:	83 fa 06             	cmp    $0x6,%edx
+  802141:	74 0e                	je     802151 <sys_ipc_recv_range+0x7a>
+  802143:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802146:	0f b6 c9             	movzbl %cl,%ecx
+  802149:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80214f:	eb 98                	jmp    8020e9 <sys_ipc_recv_range+0x12>
+  802151:	89 c2                	mov    %eax,%edx
+  802153:	c1 ea 04             	shr    $0x4,%edx
+  802156:	83 e2 0f             	and    $0xf,%edx
+  802159:	83 fa 02             	cmp    $0x2,%edx
+  80215c:	77 e5                	ja     802143 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  80215e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802161:	83 f8 02             	cmp    $0x2,%eax
+  802164:	0f 97 c1             	seta   %cl
+  802167:	0f b6 c9             	movzbl %cl,%ecx
+  80216a:	eb d7                	jmp    802143 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  80216c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802171:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  802176:	8b 55 08             	mov    0x8(%ebp),%edx
+  802179:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80217c:	89 df                	mov    %ebx,%edi
+  80217e:	89 de                	mov    %ebx,%esi
+  802180:	cd 30                	int    $0x30
+  802182:	eb 90                	jmp    802114 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802184:	83 ec 0c             	sub    $0xc,%esp
+  802187:	50                   	push   %eax
+  802188:	6a 1f                	push   $0x1f
+  80218a:	68 39 38 80 00       	push   $0x803839
+  80218f:	6a 4a                	push   $0x4a
+  802191:	68 56 38 80 00       	push   $0x803856
+  802196:	e8 cf e5 ff ff       	call   80076a <_panic>
+
+0080219b <sys_ipc_call>:
+{
+  80219b:	55                   	push   %ebp
+  80219c:	89 e5                	mov    %esp,%ebp
+  80219e:	57                   	push   %edi
+  80219f:	56                   	push   %esi
+  8021a0:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8021a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021a4:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8021a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8021ac:	55                   	push   %ebp
+  8021ad:	56                   	push   %esi
+  8021ae:	8b 0e                	mov    (%esi),%ecx
+  8021b0:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8021b3:	8b 7e 08             	mov    0x8(%esi),%edi
+  8021b6:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8021b9:	8b 76 0c             	mov    0xc(%esi),%esi
+  8021bc:	cd 30                	int    $0x30
+  8021be:	87 34 24             	xchg   %esi,(%esp)
+  8021c1:	89 0e                	mov    %ecx,(%esi)
+  8021c3:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8021c6:	89 7e 08             	mov    %edi,0x8(%esi)
+  8021c9:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8021cc:	8f 46 0c             	pop    0xc(%esi)
+  8021cf:	5d                   	pop    %ebp
+}
+  8021d0:	5b                   	pop    %ebx
+  8021d1:	5e                   	pop    %esi
+  8021d2:	5f                   	pop    %edi
+  8021d3:	5d                   	pop    %ebp
+  8021d4:	c3                   	ret
+
+008021d5 <sys_ipc_reply_wait>:
+{
+  8021d5:	55                   	push   %ebp
+  8021d6:	89 e5                	mov    %esp,%ebp
+  8021d8:	57                   	push   %edi
+  8021d9:	56                   	push   %esi
+  8021da:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8021db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021de:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8021e3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8021e6:	55                   	push   %ebp
+  8021e7:	56                   	push   %esi
+  8021e8:	8b 0e                	mov    (%esi),%ecx
+  8021ea:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8021ed:	8b 7e 08             	mov    0x8(%esi),%edi
+  8021f0:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8021f3:	8b 76 0c             	mov    0xc(%esi),%esi
+  8021f6:	cd 30                	int    $0x30
+  8021f8:	87 34 24             	xchg   %esi,(%esp)
+  8021fb:	89 0e                	mov    %ecx,(%esi)
+  8021fd:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802200:	89 7e 08             	mov    %edi,0x8(%esi)
+  802203:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802206:	8f 46 0c             	pop    0xc(%esi)
+  802209:	5d                   	pop    %ebp
+}
+  80220a:	5b                   	pop    %ebx
+  80220b:	5e                   	pop    %esi
+  80220c:	5f                   	pop    %edi
+  80220d:	5d                   	pop    %ebp
+  80220e:	c3                   	ret
+
+0080220f <sys_ipc_send_msg>:
+{
+  80220f:	55                   	push   %ebp
+  802210:	89 e5                	mov    %esp,%ebp
+  802212:	57                   	push   %edi
+  802213:	56                   	push   %esi
+  802214:	53                   	push   %ebx
+  802215:	83 ec 20             	sub    $0x20,%esp
+  802218:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  80221b:	8b 10                	mov    (%eax),%edx
+  80221d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802220:	8b 50 04             	mov    0x4(%eax),%edx
+  802223:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802226:	8b 50 08             	mov    0x8(%eax),%edx
+  802229:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  80222c:	8b 50 0c             	mov    0xc(%eax),%edx
+  80222f:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  802232:	8b 40 10             	mov    0x10(%eax),%eax
+  802235:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  802238:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  80223b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80223e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  802243:	55                   	push   %ebp
+  802244:	56                   	push   %esi
+  802245:	8b 0e                	mov    (%esi),%ecx
+  802247:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80224a:	8b 7e 08             	mov    0x8(%esi),%edi
+  80224d:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802250:	8b 76 0c             	mov    0xc(%esi),%esi
+  802253:	cd 30                	int    $0x30
+  802255:	87 34 24             	xchg   %esi,(%esp)
+  802258:	89 0e                	mov    %ecx,(%esi)
+  80225a:	89 5e 04             	mov    %ebx,0x4(%esi)
+  80225d:	89 7e 08             	mov    %edi,0x8(%esi)
+  802260:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802263:	8f 46 0c             	pop    0xc(%esi)
+  802266:	5d                   	pop    %ebp
+}
+  802267:	83 c4 20             	add    $0x20,%esp
+  80226a:	5b                   	pop    %ebx
+  80226b:	5e                   	pop    %esi
+  80226c:	5f                   	pop    %edi
+  80226d:	5d                   	pop    %ebp
+  80226e:	c3                   	ret
+
+0080226f <sys_fork>:
+{
+  80226f:	55                   	push   %ebp
+  802270:	89 e5                	mov    %esp,%ebp
+  802272:	57                   	push   %edi
+  802273:	56                   	push   %esi
+  802274:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802275:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80227c:	78 2e                	js     8022ac <sys_fork+0x3d>
+	if (syscall_sysenter)
+  80227e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802285:	74 71                	je     8022f8 <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  802287:	ba 00 00 00 00       	mov    $0x0,%edx
+  80228c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802291:	89 d1                	mov    %edx,%ecx
+  802293:	89 d3                	mov    %edx,%ebx
+  802295:	89 d7                	mov    %edx,%edi
+  802297:	89 d6                	mov    %edx,%esi
+  802299:	55                   	push   %ebp
+  80229a:	68 a3 22 80 00       	push   $0x8022a3
+  80229f:	89 e5                	mov    %esp,%ebp
+  8022a1:	0f 34                	sysenter
+  8022a3:	83 c4 04             	add    $0x4,%esp
+  8022a6:	5d                   	pop    %ebp
+}
+  8022a7:	5b                   	pop    %ebx
+  8022a8:	5e                   	pop    %esi
+  8022a9:	5f                   	pop    %edi
+  8022aa:	5d                   	pop    %ebp
+  8022ab:	c3                   	ret
+  8022ac:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022b1:	0f a2                	cpuid
+		return 0;
+  8022b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8022b8:	f6 c6 08             	test   $0x8,%dh
+  8022bb:	74 15                	je     8022d2 <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022bd:	89 c2                	mov    %eax,%edx
+  8022bf:	c1 ea 08             	shr    $0x8,%edx
+  8022c2:	83 e2 0f             	and    $0xf,%edx
+  8022c5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8022ca:	83 fa 06             	cmp    $0x6,%edx
+  8022cd:	74 0e                	je     8022dd <sys_fork+0x6e>
+  8022cf:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8022d2:	0f b6 c9             	movzbl %cl,%ecx
+  8022d5:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8022db:	eb a1                	jmp    80227e <sys_fork+0xf>
+  8022dd:	89 c2                	mov    %eax,%edx
+  8022df:	c1 ea 04             	shr    $0x4,%edx
+  8022e2:	83 e2 0f             	and    $0xf,%edx
+  8022e5:	83 fa 02             	cmp    $0x2,%edx
+  8022e8:	77 e5                	ja     8022cf <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  8022ea:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022ed:	83 f8 02             	cmp    $0x2,%eax
+  8022f0:	0f 97 c1             	seta   %cl
+  8022f3:	0f b6 c9             	movzbl %cl,%ecx
+  8022f6:	eb d7                	jmp    8022cf <sys_fork+0x60>
+		asm volatile("int %1\n"
+  8022f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022fd:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802302:	89 d1                	mov    %edx,%ecx
+  802304:	89 d3                	mov    %edx,%ebx
+  802306:	89 d7                	mov    %edx,%edi
+  802308:	89 d6                	mov    %edx,%esi
+  80230a:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  80230c:	eb 99                	jmp    8022a7 <sys_fork+0x38>
+
+0080230e <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  80230e:	55                   	push   %ebp
+  80230f:	89 e5                	mov    %esp,%ebp
+  802311:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  802314:	ff 75 14             	push   0x14(%ebp)
+  802317:	ff 75 10             	push   0x10(%ebp)
+  80231a:	ff 75 0c             	push   0xc(%ebp)
+  80231d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802322:	8b 55 08             	mov    0x8(%ebp),%edx
+  802325:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80232a:	e8 81 ee ff ff       	call   8011b0 <page_vec_call>
+}
+  80232f:	c9                   	leave
+  802330:	c3                   	ret
+
+00802331 <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  802331:	55                   	push   %ebp
+  802332:	89 e5                	mov    %esp,%ebp
+  802334:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  802337:	ff 75 18             	push   0x18(%ebp)
+  80233a:	ff 75 14             	push   0x14(%ebp)
+  80233d:	ff 75 10             	push   0x10(%ebp)
+  802340:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802343:	8b 55 08             	mov    0x8(%ebp),%edx
+  802346:	b8 10 00 00 00       	mov    $0x10,%eax
+  80234b:	e8 60 ee ff ff       	call   8011b0 <page_vec_call>
+}
+  802350:	c9                   	leave
+  802351:	c3                   	ret
+
+00802352 <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  802352:	55                   	push   %ebp
+  802353:	89 e5                	mov    %esp,%ebp
+  802355:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  802358:	ff 75 14             	push   0x14(%ebp)
+  80235b:	ff 75 10             	push   0x10(%ebp)
+  80235e:	ff 75 0c             	push   0xc(%ebp)
+  802361:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802366:	8b 55 08             	mov    0x8(%ebp),%edx
+  802369:	b8 11 00 00 00       	mov    $0x11,%eax
+  80236e:	e8 3d ee ff ff       	call   8011b0 <page_vec_call>
+}
+  802373:	c9                   	leave
+  802374:	c3                   	ret
+
+00802375 <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  802375:	55                   	push   %ebp
+  802376:	89 e5                	mov    %esp,%ebp
+  802378:	57                   	push   %edi
+  802379:	56                   	push   %esi
+  80237a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80237b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802382:	78 32                	js     8023b6 <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  802384:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80238b:	74 75                	je     802402 <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  80238d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802390:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802393:	b8 12 00 00 00       	mov    $0x12,%eax
+  802398:	be 00 00 00 00       	mov    $0x0,%esi
+  80239d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8023a0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8023a3:	55                   	push   %ebp
+  8023a4:	68 ad 23 80 00       	push   $0x8023ad
+  8023a9:	89 e5                	mov    %esp,%ebp
+  8023ab:	0f 34                	sysenter
+  8023ad:	83 c4 04             	add    $0x4,%esp
+  8023b0:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  8023b1:	5b                   	pop    %ebx
+  8023b2:	5e                   	pop    %esi
+  8023b3:	5f                   	pop    %edi
+  8023b4:	5d                   	pop    %ebp
+  8023b5:	c3                   	ret
+  8023b6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023bb:	0f a2                	cpuid
+		return 0;
+  8023bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8023c2:	f6 c6 08             	test   $0x8,%dh
+  8023c5:	74 15                	je     8023dc <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023c7:	89 c2                	mov    %eax,%edx
+  8023c9:	c1 ea 08             	shr    $0x8,%edx
+  8023cc:	83 e2 0f             	and    $0xf,%edx
+  8023cf:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8023d4:	83 fa 06             	cmp    $0x6,%edx
+  8023d7:	74 0e                	je     8023e7 <sys_vm_ranges+0x72>
+  8023d9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8023dc:	0f b6 c9             	movzbl %cl,%ecx
+  8023df:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8023e5:	eb 9d                	jmp    802384 <sys_vm_ranges+0xf>
+  8023e7:	89 c2                	mov    %eax,%edx
+  8023e9:	c1 ea 04             	shr    $0x4,%edx
+  8023ec:	83 e2 0f             	and    $0xf,%edx
+  8023ef:	83 fa 02             	cmp    $0x2,%edx
+  8023f2:	77 e5                	ja     8023d9 <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  8023f4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023f7:	83 f8 02             	cmp    $0x2,%eax
+  8023fa:	0f 97 c1             	seta   %cl
+  8023fd:	0f b6 c9             	movzbl %cl,%ecx
+  802400:	eb d7                	jmp    8023d9 <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  802402:	b8 12 00 00 00       	mov    $0x12,%eax
+  802407:	be 00 00 00 00       	mov    $0x0,%esi
+  80240c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80240f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802412:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802415:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802418:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  80241a:	eb 95                	jmp    8023b1 <sys_vm_ranges+0x3c>
+
+0080241c <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  80241c:	55                   	push   %ebp
+  80241d:	89 e5                	mov    %esp,%ebp
+  80241f:	57                   	push   %edi
+  802420:	56                   	push   %esi
+  802421:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802422:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802429:	78 31                	js     80245c <sys_spawn+0x40>
+	if (syscall_sysenter)
+  80242b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802432:	74 74                	je     8024a8 <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  802434:	be 00 00 00 00       	mov    $0x0,%esi
+  802439:	8b 55 08             	mov    0x8(%ebp),%edx
+  80243c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80243f:	b8 14 00 00 00       	mov    $0x14,%eax
+  802444:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802447:	89 f7                	mov    %esi,%edi
+  802449:	55                   	push   %ebp
+  80244a:	68 53 24 80 00       	push   $0x802453
+  80244f:	89 e5                	mov    %esp,%ebp
+  802451:	0f 34                	sysenter
+  802453:	83 c4 04             	add    $0x4,%esp
+  802456:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  802457:	5b                   	pop    %ebx
+  802458:	5e                   	pop    %esi
+  802459:	5f                   	pop    %edi
+  80245a:	5d                   	pop    %ebp
+  80245b:	c3                   	ret
+  80245c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802461:	0f a2                	cpuid
+		return 0;
+  802463:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802468:	f6 c6 08             	test   $0x8,%dh
+  80246b:	74 15                	je     802482 <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80246d:	89 c2                	mov    %eax,%edx
+  80246f:	c1 ea 08             	shr    $0x8,%edx
+  802472:	83 e2 0f             	and    $0xf,%edx
+  802475:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80247a:	83 fa 06             	cmp    $0x6,%edx
+  80247d:	74 0e                	je     80248d <sys_spawn+0x71>
+  80247f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802482:	0f b6 c9             	movzbl %cl,%ecx
+  802485:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  80248b:	eb 9e                	jmp    80242b <sys_spawn+0xf>
+  80248d:	89 c2                	mov    %eax,%edx
+  80248f:	c1 ea 04             	shr    $0x4,%edx
+  802492:	83 e2 0f             	and    $0xf,%edx
+  802495:	83 fa 02             	cmp    $0x2,%edx
+  802498:	77 e5                	ja     80247f <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  80249a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80249d:	83 f8 02             	cmp    $0x2,%eax
+  8024a0:	0f 97 c1             	seta   %cl
+  8024a3:	0f b6 c9             	movzbl %cl,%ecx
+  8024a6:	eb d7                	jmp    80247f <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  8024a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8024ad:	b8 14 00 00 00       	mov    $0x14,%eax
+  8024b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024b8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8024bb:	89 f7                	mov    %esi,%edi
+  8024bd:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  8024bf:	eb 96                	jmp    802457 <sys_spawn+0x3b>
+
+008024c1 <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  8024c1:	55                   	push   %ebp
+  8024c2:	89 e5                	mov    %esp,%ebp
+  8024c4:	57                   	push   %edi
+  8024c5:	56                   	push   %esi
+  8024c6:	53                   	push   %ebx
+  8024c7:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8024ca:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8024d1:	78 37                	js     80250a <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  8024d3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8024da:	74 7a                	je     802556 <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  8024dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024e7:	b8 15 00 00 00       	mov    $0x15,%eax
+  8024ec:	89 df                	mov    %ebx,%edi
+  8024ee:	89 de                	mov    %ebx,%esi
+  8024f0:	55                   	push   %ebp
+  8024f1:	68 fa 24 80 00       	push   $0x8024fa
+  8024f6:	89 e5                	mov    %esp,%ebp
+  8024f8:	0f 34                	sysenter
+  8024fa:	83 c4 04             	add    $0x4,%esp
+  8024fd:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8024fe:	85 c0                	test   %eax,%eax
+  802500:	7f 6c                	jg     80256e <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  802502:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802505:	5b                   	pop    %ebx
+  802506:	5e                   	pop    %esi
+  802507:	5f                   	pop    %edi
+  802508:	5d                   	pop    %ebp
+  802509:	c3                   	ret
+  80250a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80250f:	0f a2                	cpuid
+		return 0;
+  802511:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802516:	f6 c6 08             	test   $0x8,%dh
+  802519:	74 15                	je     802530 <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80251b:	89 c2                	mov    %eax,%edx
+  80251d:	c1 ea 08             	shr    $0x8,%edx
+  802520:	83 e2 0f             	and    $0xf,%edx
+  802523:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802528:	83 fa 06             	cmp    $0x6,%edx
+  80252b:	74 0e                	je     80253b <sys_shm_create+0x7a>
+  80252d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802530:	0f b6 c9             	movzbl %cl,%ecx
+  802533:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802539:	eb 98                	jmp    8024d3 <sys_shm_create+0x12>
+  80253b:	89 c2                	mov    %eax,%edx
+  80253d:	c1 ea 04             	shr    $0x4,%edx
+  802540:	83 e2 0f             	and    $0xf,%edx
+  802543:	83 fa 02             	cmp    $0x2,%edx
+  802546:	77 e5                	ja     80252d <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  802548:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80254b:	83 f8 02             	cmp    $0x2,%eax
+  80254e:	0f 97 c1             	seta   %cl
+  802551:	0f b6 c9             	movzbl %cl,%ecx
+  802554:	eb d7                	jmp    80252d <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  802556:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80255b:	b8 15 00 00 00       	mov    $0x15,%eax
+  802560:	8b 55 08             	mov    0x8(%ebp),%edx
+  802563:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802566:	89 df                	mov    %ebx,%edi
+  802568:	89 de                	mov    %ebx,%esi
+  80256a:	cd 30                	int    $0x30
+  80256c:	eb 90                	jmp    8024fe <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80256e:	83 ec 0c             	sub    $0xc,%esp
+  802571:	50                   	push   %eax
+  802572:	6a 15                	push   $0x15
+  802574:	68 39 38 80 00       	push   $0x803839
+  802579:	6a 4a                	push   $0x4a
+  80257b:	68 56 38 80 00       	push   $0x803856
+  802580:	e8 e5 e1 ff ff       	call   80076a <_panic>
+
+00802585 <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  802585:	55                   	push   %ebp
+  802586:	89 e5                	mov    %esp,%ebp
+  802588:	57                   	push   %edi
+  802589:	56                   	push   %esi
+  80258a:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80258b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802592:	78 32                	js     8025c6 <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  802594:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80259b:	74 75                	je     802612 <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  80259d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025a3:	b8 16 00 00 00       	mov    $0x16,%eax
+  8025a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8025ad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8025b0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8025b3:	55                   	push   %ebp
+  8025b4:	68 bd 25 80 00       	push   $0x8025bd
+  8025b9:	89 e5                	mov    %esp,%ebp
+  8025bb:	0f 34                	sysenter
+  8025bd:	83 c4 04             	add    $0x4,%esp
+  8025c0:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  8025c1:	5b                   	pop    %ebx
+  8025c2:	5e                   	pop    %esi
+  8025c3:	5f                   	pop    %edi
+  8025c4:	5d                   	pop    %ebp
+  8025c5:	c3                   	ret
+  8025c6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025cb:	0f a2                	cpuid
+		return 0;
+  8025cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8025d2:	f6 c6 08             	test   $0x8,%dh
+  8025d5:	74 15                	je     8025ec <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025d7:	89 c2                	mov    %eax,%edx
+  8025d9:	c1 ea 08             	shr    $0x8,%edx
+  8025dc:	83 e2 0f             	and    $0xf,%edx
+  8025df:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8025e4:	83 fa 06             	cmp    $0x6,%edx
+  8025e7:	74 0e                	je     8025f7 <sys_shm_attach+0x72>
+  8025e9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8025ec:	0f b6 c9             	movzbl %cl,%ecx
+  8025ef:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8025f5:	eb 9d                	jmp    802594 <sys_shm_attach+0xf>
+  8025f7:	89 c2                	mov    %eax,%edx
+  8025f9:	c1 ea 04             	shr    $0x4,%edx
+  8025fc:	83 e2 0f             	and    $0xf,%edx
+  8025ff:	83 fa 02             	cmp    $0x2,%edx
+  802602:	77 e5                	ja     8025e9 <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  802604:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802607:	83 f8 02             	cmp    $0x2,%eax
+  80260a:	0f 97 c1             	seta   %cl
+  80260d:	0f b6 c9             	movzbl %cl,%ecx
+  802610:	eb d7                	jmp    8025e9 <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  802612:	b8 16 00 00 00       	mov    $0x16,%eax
+  802617:	be 00 00 00 00       	mov    $0x0,%esi
+  80261c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80261f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802622:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802625:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802628:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  80262a:	eb 95                	jmp    8025c1 <sys_shm_attach+0x3c>
+
+0080262c <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  80262c:	55                   	push   %ebp
+  80262d:	89 e5                	mov    %esp,%ebp
+  80262f:	57                   	push   %edi
+  802630:	56                   	push   %esi
+  802631:	53                   	push   %ebx
+  802632:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802635:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80263c:	78 38                	js     802676 <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  80263e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802645:	74 7b                	je     8026c2 <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  802647:	be 00 00 00 00       	mov    $0x0,%esi
+  80264c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80264f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802652:	b8 17 00 00 00       	mov    $0x17,%eax
+  802657:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80265a:	89 f7                	mov    %esi,%edi
+  80265c:	55                   	push   %ebp
+  80265d:	68 66 26 80 00       	push   $0x802666
+  802662:	89 e5                	mov    %esp,%ebp
+  802664:	0f 34                	sysenter
+  802666:	83 c4 04             	add    $0x4,%esp
+  802669:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80266a:	85 c0                	test   %eax,%eax
+  80266c:	7f 6d                	jg     8026db <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  80266e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802671:	5b                   	pop    %ebx
+  802672:	5e                   	pop    %esi
+  802673:	5f                   	pop    %edi
+  802674:	5d                   	pop    %ebp
+  802675:	c3                   	ret
+  802676:	b8 01 00 00 00       	mov    $0x1,%eax
+  80267b:	0f a2                	cpuid
+		return 0;
+  80267d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802682:	f6 c6 08             	test   $0x8,%dh
+  802685:	74 15                	je     80269c <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802687:	89 c2                	mov    %eax,%edx
+  802689:	c1 ea 08             	shr    $0x8,%edx
+  80268c:	83 e2 0f             	and    $0xf,%edx
+  80268f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802694:	83 fa 06             	cmp    $0x6,%edx
+  802697:	74 0e                	je     8026a7 <sys_shm_detach+0x7b>
+  802699:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80269c:	0f b6 c9             	movzbl %cl,%ecx
+  80269f:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8026a5:	eb 97                	jmp    80263e <sys_shm_detach+0x12>
+  8026a7:	89 c2                	mov    %eax,%edx
+  8026a9:	c1 ea 04             	shr    $0x4,%edx
+  8026ac:	83 e2 0f             	and    $0xf,%edx
+  8026af:	83 fa 02             	cmp    $0x2,%edx
+  8026b2:	77 e5                	ja     802699 <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  8026b4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8026b7:	83 f8 02             	cmp    $0x2,%eax
+  8026ba:	0f 97 c1             	seta   %cl
+  8026bd:	0f b6 c9             	movzbl %cl,%ecx
+  8026c0:	eb d7                	jmp    802699 <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  8026c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8026c7:	b8 17 00 00 00       	mov    $0x17,%eax
+  8026cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8026cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026d2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8026d5:	89 f7                	mov    %esi,%edi
+  8026d7:	cd 30                	int    $0x30
+  8026d9:	eb 8f                	jmp    80266a <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8026db:	83 ec 0c             	sub    $0xc,%esp
+  8026de:	50                   	push   %eax
+  8026df:	6a 17                	push   $0x17
+  8026e1:	68 39 38 80 00       	push   $0x803839
+  8026e6:	6a 4a                	push   $0x4a
+  8026e8:	68 56 38 80 00       	push   $0x803856
+  8026ed:	e8 78 e0 ff ff       	call   80076a <_panic>
+
+008026f2 <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  8026f2:	55                   	push   %ebp
+  8026f3:	89 e5                	mov    %esp,%ebp
+  8026f5:	57                   	push   %edi
+  8026f6:	56                   	push   %esi
+  8026f7:	53                   	push   %ebx
+  8026f8:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8026fb:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802702:	78 36                	js     80273a <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  802704:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80270b:	74 79                	je     802786 <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  80270d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802710:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802715:	b8 18 00 00 00       	mov    $0x18,%eax
+  80271a:	89 cb                	mov    %ecx,%ebx
+  80271c:	89 cf                	mov    %ecx,%edi
+  80271e:	89 ce                	mov    %ecx,%esi
+  802720:	55                   	push   %ebp
+  802721:	68 2a 27 80 00       	push   $0x80272a
+  802726:	89 e5                	mov    %esp,%ebp
+  802728:	0f 34                	sysenter
+  80272a:	83 c4 04             	add    $0x4,%esp
+  80272d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80272e:	85 c0                	test   %eax,%eax
+  802730:	7f 6b                	jg     80279d <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  802732:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802735:	5b                   	pop    %ebx
+  802736:	5e                   	pop    %esi
+  802737:	5f                   	pop    %edi
+  802738:	5d                   	pop    %ebp
+  802739:	c3                   	ret
+  80273a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80273f:	0f a2                	cpuid
+		return 0;
+  802741:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802746:	f6 c6 08             	test   $0x8,%dh
+  802749:	74 15                	je     802760 <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80274b:	89 c2                	mov    %eax,%edx
+  80274d:	c1 ea 08             	shr    $0x8,%edx
+  802750:	83 e2 0f             	and    $0xf,%edx
+  802753:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802758:	83 fa 06             	cmp    $0x6,%edx
+  80275b:	74 0e                	je     80276b <sys_shm_remove+0x79>
+  80275d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802760:	0f b6 c9             	movzbl %cl,%ecx
+  802763:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802769:	eb 99                	jmp    802704 <sys_shm_remove+0x12>
+  80276b:	89 c2                	mov    %eax,%edx
+  80276d:	c1 ea 04             	shr    $0x4,%edx
+  802770:	83 e2 0f             	and    $0xf,%edx
+  802773:	83 fa 02             	cmp    $0x2,%edx
+  802776:	77 e5                	ja     80275d <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  802778:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80277b:	83 f8 02             	cmp    $0x2,%eax
+  80277e:	0f 97 c1             	seta   %cl
+  802781:	0f b6 c9             	movzbl %cl,%ecx
+  802784:	eb d7                	jmp    80275d <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  802786:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80278b:	b8 18 00 00 00       	mov    $0x18,%eax
+  802790:	8b 55 08             	mov    0x8(%ebp),%edx
+  802793:	89 cb                	mov    %ecx,%ebx
+  802795:	89 cf                	mov    %ecx,%edi
+  802797:	89 ce                	mov    %ecx,%esi
+  802799:	cd 30                	int    $0x30
+  80279b:	eb 91                	jmp    80272e <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80279d:	83 ec 0c             	sub    $0xc,%esp
+  8027a0:	50                   	push   %eax
+  8027a1:	6a 18                	push   $0x18
+  8027a3:	68 39 38 80 00       	push   $0x803839
+  8027a8:	6a 4a                	push   $0x4a
+  8027aa:	68 56 38 80 00       	push   $0x803856
+  8027af:	e8 b6 df ff ff       	call   80076a <_panic>
+
+008027b4 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  8027b4:	55                   	push   %ebp
+  8027b5:	89 e5                	mov    %esp,%ebp
+  8027b7:	57                   	push   %edi
+  8027b8:	56                   	push   %esi
+  8027b9:	53                   	push   %ebx
+  8027ba:	83 ec 0c             	sub    $0xc,%esp
+  8027bd:	8b 45 10             	mov    0x10(%ebp),%eax
+  8027c0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8027c3:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  8027c6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8027cd:	78 32                	js     802801 <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  8027cf:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8027d6:	74 75                	je     80284d <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  8027d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8027db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027de:	b8 20 00 00 00       	mov    $0x20,%eax
+  8027e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8027e8:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8027eb:	55                   	push   %ebp
+  8027ec:	68 f5 27 80 00       	push   $0x8027f5
+  8027f1:	89 e5                	mov    %esp,%ebp
+  8027f3:	0f 34                	sysenter
+  8027f5:	83 c4 04             	add    $0x4,%esp
+  8027f8:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  8027f9:	83 c4 0c             	add    $0xc,%esp
+  8027fc:	5b                   	pop    %ebx
+  8027fd:	5e                   	pop    %esi
+  8027fe:	5f                   	pop    %edi
+  8027ff:	5d                   	pop    %ebp
+  802800:	c3                   	ret
+  802801:	b8 01 00 00 00       	mov    $0x1,%eax
+  802806:	0f a2                	cpuid
+		return 0;
+  802808:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80280d:	f6 c6 08             	test   $0x8,%dh
+  802810:	74 15                	je     802827 <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802812:	89 c2                	mov    %eax,%edx
+  802814:	c1 ea 08             	shr    $0x8,%edx
+  802817:	83 e2 0f             	and    $0xf,%edx
+  80281a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80281f:	83 fa 06             	cmp    $0x6,%edx
+  802822:	74 0e                	je     802832 <sys_futex_wait+0x7e>
+  802824:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802827:	0f b6 c9             	movzbl %cl,%ecx
+  80282a:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802830:	eb 9d                	jmp    8027cf <sys_futex_wait+0x1b>
+  802832:	89 c2                	mov    %eax,%edx
+  802834:	c1 ea 04             	shr    $0x4,%edx
+  802837:	83 e2 0f             	and    $0xf,%edx
+  80283a:	83 fa 02             	cmp    $0x2,%edx
+  80283d:	77 e5                	ja     802824 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  80283f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802842:	83 f8 02             	cmp    $0x2,%eax
+  802845:	0f 97 c1             	seta   %cl
+  802848:	0f b6 c9             	movzbl %cl,%ecx
+  80284b:	eb d7                	jmp    802824 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  80284d:	b8 20 00 00 00       	mov    $0x20,%eax
+  802852:	be 00 00 00 00       	mov    $0x0,%esi
+  802857:	8b 55 08             	mov    0x8(%ebp),%edx
+  80285a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80285d:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802860:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  802862:	eb 95                	jmp    8027f9 <sys_futex_wait+0x45>
+
+00802864 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  802864:	55                   	push   %ebp
+  802865:	89 e5                	mov    %esp,%ebp
+  802867:	57                   	push   %edi
+  802868:	56                   	push   %esi
+  802869:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80286a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802871:	78 30                	js     8028a3 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  802873:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80287a:	74 73                	je     8028ef <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  80287c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802881:	8b 55 08             	mov    0x8(%ebp),%edx
+  802884:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802887:	b8 21 00 00 00       	mov    $0x21,%eax
+  80288c:	89 df                	mov    %ebx,%edi
+  80288e:	89 de                	mov    %ebx,%esi
+  802890:	55                   	push   %ebp
+  802891:	68 9a 28 80 00       	push   $0x80289a
+  802896:	89 e5                	mov    %esp,%ebp
+  802898:	0f 34                	sysenter
+  80289a:	83 c4 04             	add    $0x4,%esp
+  80289d:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80289e:	5b                   	pop    %ebx
+  80289f:	5e                   	pop    %esi
+  8028a0:	5f                   	pop    %edi
+  8028a1:	5d                   	pop    %ebp
+  8028a2:	c3                   	ret
+  8028a3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028a8:	0f a2                	cpuid
+		return 0;
+  8028aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8028af:	f6 c6 08             	test   $0x8,%dh
+  8028b2:	74 15                	je     8028c9 <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8028b4:	89 c2                	mov    %eax,%edx
+  8028b6:	c1 ea 08             	shr    $0x8,%edx
+  8028b9:	83 e2 0f             	and    $0xf,%edx
+  8028bc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8028c1:	83 fa 06             	cmp    $0x6,%edx
+  8028c4:	74 0e                	je     8028d4 <sys_futex_wake+0x70>
+  8028c6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8028c9:	0f b6 c9             	movzbl %cl,%ecx
+  8028cc:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  8028d2:	eb 9f                	jmp    802873 <sys_futex_wake+0xf>
+  8028d4:	89 c2                	mov    %eax,%edx
+  8028d6:	c1 ea 04             	shr    $0x4,%edx
+  8028d9:	83 e2 0f             	and    $0xf,%edx
+  8028dc:	83 fa 02             	cmp    $0x2,%edx
+  8028df:	77 e5                	ja     8028c6 <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  8028e1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8028e4:	83 f8 02             	cmp    $0x2,%eax
+  8028e7:	0f 97 c1             	seta   %cl
+  8028ea:	0f b6 c9             	movzbl %cl,%ecx
+  8028ed:	eb d7                	jmp    8028c6 <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  8028ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028f4:	b8 21 00 00 00       	mov    $0x21,%eax
+  8028f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8028fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8028ff:	89 df                	mov    %ebx,%edi
+  802901:	89 de                	mov    %ebx,%esi
+  802903:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  802905:	eb 97                	jmp    80289e <sys_futex_wake+0x3a>
+
+00802907 <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  802907:	55                   	push   %ebp
+  802908:	89 e5                	mov    %esp,%ebp
+  80290a:	57                   	push   %edi
+  80290b:	56                   	push   %esi
+  80290c:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80290d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802914:	78 2e                	js     802944 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  802916:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80291d:	74 71                	je     802990 <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  80291f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802924:	b8 22 00 00 00       	mov    $0x22,%eax
+  802929:	89 d1                	mov    %edx,%ecx
+  80292b:	89 d3                	mov    %edx,%ebx
+  80292d:	89 d7                	mov    %edx,%edi
+  80292f:	89 d6                	mov    %edx,%esi
+  802931:	55                   	push   %ebp
+  802932:	68 3b 29 80 00       	push   $0x80293b
+  802937:	89 e5                	mov    %esp,%ebp
+  802939:	0f 34                	sysenter
+  80293b:	83 c4 04             	add    $0x4,%esp
+  80293e:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  80293f:	5b                   	pop    %ebx
+  802940:	5e                   	pop    %esi
+  802941:	5f                   	pop    %edi
+  802942:	5d                   	pop    %ebp
+  802943:	c3                   	ret
+  802944:	b8 01 00 00 00       	mov    $0x1,%eax
+  802949:	0f a2                	cpuid
+		return 0;
+  80294b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802950:	f6 c6 08             	test   $0x8,%dh
+  802953:	74 15                	je     80296a <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802955:	89 c2                	mov    %eax,%edx
+  802957:	c1 ea 08             	shr    $0x8,%edx
+  80295a:	83 e2 0f             	and    $0xf,%edx
+  80295d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802962:	83 fa 06             	cmp    $0x6,%edx
+  802965:	74 0e                	je     802975 <sys_ep_create+0x6e>
+  802967:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80296a:	0f b6 c9             	movzbl %cl,%ecx
+  80296d:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802973:	eb a1                	jmp    802916 <sys_ep_create+0xf>
+  802975:	89 c2                	mov    %eax,%edx
+  802977:	c1 ea 04             	shr    $0x4,%edx
+  80297a:	83 e2 0f             	and    $0xf,%edx
+  80297d:	83 fa 02             	cmp    $0x2,%edx
+  802980:	77 e5                	ja     802967 <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  802982:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802985:	83 f8 02             	cmp    $0x2,%eax
+  802988:	0f 97 c1             	seta   %cl
+  80298b:	0f b6 c9             	movzbl %cl,%ecx
+  80298e:	eb d7                	jmp    802967 <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  802990:	ba 00 00 00 00       	mov    $0x0,%edx
+  802995:	b8 22 00 00 00       	mov    $0x22,%eax
+  80299a:	89 d1                	mov    %edx,%ecx
+  80299c:	89 d3                	mov    %edx,%ebx
+  80299e:	89 d7                	mov    %edx,%edi
+  8029a0:	89 d6                	mov    %edx,%esi
+  8029a2:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  8029a4:	eb 99                	jmp    80293f <sys_ep_create+0x38>
+
+008029a6 <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  8029a6:	55                   	push   %ebp
+  8029a7:	89 e5                	mov    %esp,%ebp
+  8029a9:	57                   	push   %edi
+  8029aa:	56                   	push   %esi
+  8029ab:	53                   	push   %ebx
+  8029ac:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8029af:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8029b6:	78 36                	js     8029ee <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  8029b8:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8029bf:	74 79                	je     802a3a <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  8029c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8029c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029c9:	b8 23 00 00 00       	mov    $0x23,%eax
+  8029ce:	89 cb                	mov    %ecx,%ebx
+  8029d0:	89 cf                	mov    %ecx,%edi
+  8029d2:	89 ce                	mov    %ecx,%esi
+  8029d4:	55                   	push   %ebp
+  8029d5:	68 de 29 80 00       	push   $0x8029de
+  8029da:	89 e5                	mov    %esp,%ebp
+  8029dc:	0f 34                	sysenter
+  8029de:	83 c4 04             	add    $0x4,%esp
+  8029e1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8029e2:	85 c0                	test   %eax,%eax
+  8029e4:	7f 6b                	jg     802a51 <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  8029e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029e9:	5b                   	pop    %ebx
+  8029ea:	5e                   	pop    %esi
+  8029eb:	5f                   	pop    %edi
+  8029ec:	5d                   	pop    %ebp
+  8029ed:	c3                   	ret
+  8029ee:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029f3:	0f a2                	cpuid
+		return 0;
+  8029f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8029fa:	f6 c6 08             	test   $0x8,%dh
+  8029fd:	74 15                	je     802a14 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8029ff:	89 c2                	mov    %eax,%edx
+  802a01:	c1 ea 08             	shr    $0x8,%edx
+  802a04:	83 e2 0f             	and    $0xf,%edx
+  802a07:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802a0c:	83 fa 06             	cmp    $0x6,%edx
+  802a0f:	74 0e                	je     802a1f <sys_ep_destroy+0x79>
+  802a11:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802a14:	0f b6 c9             	movzbl %cl,%ecx
+  802a17:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802a1d:	eb 99                	jmp    8029b8 <sys_ep_destroy+0x12>
+  802a1f:	89 c2                	mov    %eax,%edx
+  802a21:	c1 ea 04             	shr    $0x4,%edx
+  802a24:	83 e2 0f             	and    $0xf,%edx
+  802a27:	83 fa 02             	cmp    $0x2,%edx
+  802a2a:	77 e5                	ja     802a11 <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  802a2c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802a2f:	83 f8 02             	cmp    $0x2,%eax
+  802a32:	0f 97 c1             	seta   %cl
+  802a35:	0f b6 c9             	movzbl %cl,%ecx
+  802a38:	eb d7                	jmp    802a11 <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  802a3a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a3f:	b8 23 00 00 00       	mov    $0x23,%eax
+  802a44:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a47:	89 cb                	mov    %ecx,%ebx
+  802a49:	89 cf                	mov    %ecx,%edi
+  802a4b:	89 ce                	mov    %ecx,%esi
+  802a4d:	cd 30                	int    $0x30
+  802a4f:	eb 91                	jmp    8029e2 <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802a51:	83 ec 0c             	sub    $0xc,%esp
+  802a54:	50                   	push   %eax
+  802a55:	6a 23                	push   $0x23
+  802a57:	68 39 38 80 00       	push   $0x803839
+  802a5c:	6a 4a                	push   $0x4a
+  802a5e:	68 56 38 80 00       	push   $0x803856
+  802a63:	e8 02 dd ff ff       	call   80076a <_panic>
+
+00802a68 <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  802a68:	55                   	push   %ebp
+  802a69:	89 e5                	mov    %esp,%ebp
+  802a6b:	57                   	push   %edi
+  802a6c:	56                   	push   %esi
+  802a6d:	53                   	push   %ebx
+  802a6e:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802a71:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802a78:	78 37                	js     802ab1 <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  802a7a:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802a81:	74 7a                	je     802afd <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  802a83:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a88:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a8b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a8e:	b8 24 00 00 00       	mov    $0x24,%eax
+  802a93:	89 df                	mov    %ebx,%edi
+  802a95:	89 de                	mov    %ebx,%esi
+  802a97:	55                   	push   %ebp
+  802a98:	68 a1 2a 80 00       	push   $0x802aa1
+  802a9d:	89 e5                	mov    %esp,%ebp
+  802a9f:	0f 34                	sysenter
+  802aa1:	83 c4 04             	add    $0x4,%esp
+  802aa4:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802aa5:	85 c0                	test   %eax,%eax
+  802aa7:	7f 6c                	jg     802b15 <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  802aa9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802aac:	5b                   	pop    %ebx
+  802aad:	5e                   	pop    %esi
+  802aae:	5f                   	pop    %edi
+  802aaf:	5d                   	pop    %ebp
+  802ab0:	c3                   	ret
+  802ab1:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ab6:	0f a2                	cpuid
+		return 0;
+  802ab8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802abd:	f6 c6 08             	test   $0x8,%dh
+  802ac0:	74 15                	je     802ad7 <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802ac2:	89 c2                	mov    %eax,%edx
+  802ac4:	c1 ea 08             	shr    $0x8,%edx
+  802ac7:	83 e2 0f             	and    $0xf,%edx
+  802aca:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802acf:	83 fa 06             	cmp    $0x6,%edx
+  802ad2:	74 0e                	je     802ae2 <sys_ep_grant+0x7a>
+  802ad4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802ad7:	0f b6 c9             	movzbl %cl,%ecx
+  802ada:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802ae0:	eb 98                	jmp    802a7a <sys_ep_grant+0x12>
+  802ae2:	89 c2                	mov    %eax,%edx
+  802ae4:	c1 ea 04             	shr    $0x4,%edx
+  802ae7:	83 e2 0f             	and    $0xf,%edx
+  802aea:	83 fa 02             	cmp    $0x2,%edx
+  802aed:	77 e5                	ja     802ad4 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  802aef:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802af2:	83 f8 02             	cmp    $0x2,%eax
+  802af5:	0f 97 c1             	seta   %cl
+  802af8:	0f b6 c9             	movzbl %cl,%ecx
+  802afb:	eb d7                	jmp    802ad4 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  802afd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b02:	b8 24 00 00 00       	mov    $0x24,%eax
+  802b07:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b0a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802b0d:	89 df                	mov    %ebx,%edi
+  802b0f:	89 de                	mov    %ebx,%esi
+  802b11:	cd 30                	int    $0x30
+  802b13:	eb 90                	jmp    802aa5 <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802b15:	83 ec 0c             	sub    $0xc,%esp
+  802b18:	50                   	push   %eax
+  802b19:	6a 24                	push   $0x24
+  802b1b:	68 39 38 80 00       	push   $0x803839
+  802b20:	6a 4a                	push   $0x4a
+  802b22:	68 56 38 80 00       	push   $0x803856
+  802b27:	e8 3e dc ff ff       	call   80076a <_panic>
+
+00802b2c <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  802b2c:	55                   	push   %ebp
+  802b2d:	89 e5                	mov    %esp,%ebp
+  802b2f:	57                   	push   %edi
+  802b30:	56                   	push   %esi
+  802b31:	53                   	push   %ebx
+  802b32:	83 ec 20             	sub    $0x20,%esp
+  802b35:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  802b38:	8b 10                	mov    (%eax),%edx
+  802b3a:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802b3d:	8b 50 04             	mov    0x4(%eax),%edx
+  802b40:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802b43:	8b 50 08             	mov    0x8(%eax),%edx
+  802b46:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  802b49:	8b 50 0c             	mov    0xc(%eax),%edx
+  802b4c:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  802b4f:	8b 40 10             	mov    0x10(%eax),%eax
+  802b52:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  802b55:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  802b58:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b5b:	b8 25 00 00 00       	mov    $0x25,%eax
+  802b60:	55                   	push   %ebp
+  802b61:	56                   	push   %esi
+  802b62:	8b 0e                	mov    (%esi),%ecx
+  802b64:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802b67:	8b 7e 08             	mov    0x8(%esi),%edi
+  802b6a:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802b6d:	8b 76 0c             	mov    0xc(%esi),%esi
+  802b70:	cd 30                	int    $0x30
+  802b72:	87 34 24             	xchg   %esi,(%esp)
+  802b75:	89 0e                	mov    %ecx,(%esi)
+  802b77:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802b7a:	89 7e 08             	mov    %edi,0x8(%esi)
+  802b7d:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802b80:	8f 46 0c             	pop    0xc(%esi)
+  802b83:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  802b84:	83 c4 20             	add    $0x20,%esp
+  802b87:	5b                   	pop    %ebx
+  802b88:	5e                   	pop    %esi
+  802b89:	5f                   	pop    %edi
+  802b8a:	5d                   	pop    %ebp
+  802b8b:	c3                   	ret
+
+00802b8c <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  802b8c:	55                   	push   %ebp
+  802b8d:	89 e5                	mov    %esp,%ebp
+  802b8f:	57                   	push   %edi
+  802b90:	56                   	push   %esi
+  802b91:	53                   	push   %ebx
+  802b92:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  802b95:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b98:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  802b9a:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b9d:	b8 26 00 00 00       	mov    $0x26,%eax
+  802ba2:	55                   	push   %ebp
+  802ba3:	56                   	push   %esi
+  802ba4:	8b 0e                	mov    (%esi),%ecx
+  802ba6:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802ba9:	8b 7e 08             	mov    0x8(%esi),%edi
+  802bac:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802baf:	8b 76 0c             	mov    0xc(%esi),%esi
+  802bb2:	cd 30                	int    $0x30
+  802bb4:	87 34 24             	xchg   %esi,(%esp)
+  802bb7:	89 0e                	mov    %ecx,(%esi)
+  802bb9:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802bbc:	89 7e 08             	mov    %edi,0x8(%esi)
+  802bbf:	89 6e 10             	mov    %ebp,0x10(%esi)
+  802bc2:	8f 46 0c             	pop    0xc(%esi)
+  802bc5:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  802bc6:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  802bca:	74 0f                	je     802bdb <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  802bcc:	85 c0                	test   %eax,%eax
+  802bce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802bd3:	0f 48 d1             	cmovs  %ecx,%edx
+  802bd6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  802bd9:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  802bdb:	5b                   	pop    %ebx
+  802bdc:	5e                   	pop    %esi
+  802bdd:	5f                   	pop    %edi
+  802bde:	5d                   	pop    %ebp
+  802bdf:	c3                   	ret
+
+00802be0 <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  802be0:	55                   	push   %ebp
+  802be1:	89 e5                	mov    %esp,%ebp
+  802be3:	57                   	push   %edi
+  802be4:	56                   	push   %esi
+  802be5:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802be6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802bed:	78 2f                	js     802c1e <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  802bef:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802bf6:	74 72                	je     802c6a <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  802bf8:	8b 55 08             	mov    0x8(%ebp),%edx
+  802bfb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c00:	b8 27 00 00 00       	mov    $0x27,%eax
+  802c05:	89 cb                	mov    %ecx,%ebx
+  802c07:	89 cf                	mov    %ecx,%edi
+  802c09:	89 ce                	mov    %ecx,%esi
+  802c0b:	55                   	push   %ebp
+  802c0c:	68 15 2c 80 00       	push   $0x802c15
+  802c11:	89 e5                	mov    %esp,%ebp
+  802c13:	0f 34                	sysenter
+  802c15:	83 c4 04             	add    $0x4,%esp
+  802c18:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  802c19:	5b                   	pop    %ebx
+  802c1a:	5e                   	pop    %esi
+  802c1b:	5f                   	pop    %edi
+  802c1c:	5d                   	pop    %ebp
+  802c1d:	c3                   	ret
+  802c1e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c23:	0f a2                	cpuid
+		return 0;
+  802c25:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802c2a:	f6 c6 08             	test   $0x8,%dh
+  802c2d:	74 15                	je     802c44 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802c2f:	89 c2                	mov    %eax,%edx
+  802c31:	c1 ea 08             	shr    $0x8,%edx
+  802c34:	83 e2 0f             	and    $0xf,%edx
+  802c37:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802c3c:	83 fa 06             	cmp    $0x6,%edx
+  802c3f:	74 0e                	je     802c4f <sys_sysring_setup+0x6f>
+  802c41:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802c44:	0f b6 c9             	movzbl %cl,%ecx
+  802c47:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802c4d:	eb a0                	jmp    802bef <sys_sysring_setup+0xf>
+  802c4f:	89 c2                	mov    %eax,%edx
+  802c51:	c1 ea 04             	shr    $0x4,%edx
+  802c54:	83 e2 0f             	and    $0xf,%edx
+  802c57:	83 fa 02             	cmp    $0x2,%edx
+  802c5a:	77 e5                	ja     802c41 <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  802c5c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802c5f:	83 f8 02             	cmp    $0x2,%eax
+  802c62:	0f 97 c1             	seta   %cl
+  802c65:	0f b6 c9             	movzbl %cl,%ecx
+  802c68:	eb d7                	jmp    802c41 <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  802c6a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c6f:	b8 27 00 00 00       	mov    $0x27,%eax
+  802c74:	8b 55 08             	mov    0x8(%ebp),%edx
+  802c77:	89 cb                	mov    %ecx,%ebx
+  802c79:	89 cf                	mov    %ecx,%edi
+  802c7b:	89 ce                	mov    %ecx,%esi
+  802c7d:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  802c7f:	eb 98                	jmp    802c19 <sys_sysring_setup+0x39>
+
+00802c81 <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  802c81:	55                   	push   %ebp
+  802c82:	89 e5                	mov    %esp,%ebp
+  802c84:	57                   	push   %edi
+  802c85:	56                   	push   %esi
+  802c86:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802c87:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802c8e:	78 2e                	js     802cbe <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  802c90:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  802c97:	74 71                	je     802d0a <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  802c99:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c9e:	b8 28 00 00 00       	mov    $0x28,%eax
+  802ca3:	89 d1                	mov    %edx,%ecx
+  802ca5:	89 d3                	mov    %edx,%ebx
+  802ca7:	89 d7                	mov    %edx,%edi
+  802ca9:	89 d6                	mov    %edx,%esi
+  802cab:	55                   	push   %ebp
+  802cac:	68 b5 2c 80 00       	push   $0x802cb5
+  802cb1:	89 e5                	mov    %esp,%ebp
+  802cb3:	0f 34                	sysenter
+  802cb5:	83 c4 04             	add    $0x4,%esp
+  802cb8:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  802cb9:	5b                   	pop    %ebx
+  802cba:	5e                   	pop    %esi
+  802cbb:	5f                   	pop    %edi
+  802cbc:	5d                   	pop    %ebp
+  802cbd:	c3                   	ret
+  802cbe:	b8 01 00 00 00       	mov    $0x1,%eax
+  802cc3:	0f a2                	cpuid
+		return 0;
+  802cc5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802cca:	f6 c6 08             	test   $0x8,%dh
+  802ccd:	74 15                	je     802ce4 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802ccf:	89 c2                	mov    %eax,%edx
+  802cd1:	c1 ea 08             	shr    $0x8,%edx
+  802cd4:	83 e2 0f             	and    $0xf,%edx
+  802cd7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802cdc:	83 fa 06             	cmp    $0x6,%edx
+  802cdf:	74 0e                	je     802cef <sys_sysring_enter+0x6e>
+  802ce1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802ce4:	0f b6 c9             	movzbl %cl,%ecx
+  802ce7:	89 0d 04 40 80 00    	mov    %ecx,0x804004
+  802ced:	eb a1                	jmp    802c90 <sys_sysring_enter+0xf>
+  802cef:	89 c2                	mov    %eax,%edx
+  802cf1:	c1 ea 04             	shr    $0x4,%edx
+  802cf4:	83 e2 0f             	and    $0xf,%edx
+  802cf7:	83 fa 02             	cmp    $0x2,%edx
+  802cfa:	77 e5                	ja     802ce1 <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  802cfc:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802cff:	83 f8 02             	cmp    $0x2,%eax
+  802d02:	0f 97 c1             	seta   %cl
+  802d05:	0f b6 c9             	movzbl %cl,%ecx
+  802d08:	eb d7                	jmp    802ce1 <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  802d0a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d0f:	b8 28 00 00 00       	mov    $0x28,%eax
+  802d14:	89 d1                	mov    %edx,%ecx
+  802d16:	89 d3                	mov    %edx,%ebx
+  802d18:	89 d7                	mov    %edx,%edi
+  802d1a:	89 d6                	mov    %edx,%esi
+  802d1c:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  802d1e:	eb 99                	jmp    802cb9 <sys_sysring_enter+0x38>
+
+00802d20 <dm>:
+  802d20:	55                   	push   %ebp
+  802d21:	57                   	push   %edi
+  802d22:	56                   	push   %esi
+  802d23:	53                   	push   %ebx
+  802d24:	83 ec 24             	sub    $0x24,%esp
+  802d27:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802d2b:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802d2f:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802d33:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802d37:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802d3b:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802d3f:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802d43:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d48:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d4d:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802d52:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802d59:	00 
+  802d5a:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802d61:	00 
+  802d62:	89 fb                	mov    %edi,%ebx
+  802d64:	eb 08                	jmp    802d6e <dm+0x4e>
+  802d66:	83 e9 01             	sub    $0x1,%ecx
+  802d69:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802d6c:	74 68                	je     802dd6 <dm+0xb6>
+  802d6e:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802d72:	01 c0                	add    %eax,%eax
+  802d74:	89 c6                	mov    %eax,%esi
+  802d76:	89 d7                	mov    %edx,%edi
+  802d78:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802d7c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802d80:	0f ad d0             	shrd   %cl,%edx,%eax
+  802d83:	d3 ea                	shr    %cl,%edx
+  802d85:	f6 c1 20             	test   $0x20,%cl
+  802d88:	74 04                	je     802d8e <dm+0x6e>
+  802d8a:	89 d0                	mov    %edx,%eax
+  802d8c:	31 d2                	xor    %edx,%edx
+  802d8e:	83 e0 01             	and    $0x1,%eax
+  802d91:	89 04 24             	mov    %eax,(%esp)
+  802d94:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802d9b:	00 
+  802d9c:	8b 04 24             	mov    (%esp),%eax
+  802d9f:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802da3:	09 f0                	or     %esi,%eax
+  802da5:	09 fa                	or     %edi,%edx
+  802da7:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802dab:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802daf:	39 f0                	cmp    %esi,%eax
+  802db1:	89 d5                	mov    %edx,%ebp
+  802db3:	19 fd                	sbb    %edi,%ebp
+  802db5:	72 af                	jb     802d66 <dm+0x46>
+  802db7:	29 f0                	sub    %esi,%eax
+  802db9:	19 fa                	sbb    %edi,%edx
+  802dbb:	89 cf                	mov    %ecx,%edi
+  802dbd:	c1 ef 05             	shr    $0x5,%edi
+  802dc0:	83 e7 01             	and    $0x1,%edi
+  802dc3:	89 fe                	mov    %edi,%esi
+  802dc5:	83 f6 01             	xor    $0x1,%esi
+  802dc8:	d3 e6                	shl    %cl,%esi
+  802dca:	d3 e7                	shl    %cl,%edi
+  802dcc:	09 74 24 18          	or     %esi,0x18(%esp)
+  802dd0:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802dd4:	eb 90                	jmp    802d66 <dm+0x46>
+  802dd6:	85 db                	test   %ebx,%ebx
+  802dd8:	74 05                	je     802ddf <dm+0xbf>
+  802dda:	89 03                	mov    %eax,(%ebx)
+  802ddc:	89 53 04             	mov    %edx,0x4(%ebx)
+  802ddf:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802de3:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802de7:	83 c4 24             	add    $0x24,%esp
+  802dea:	5b                   	pop    %ebx
+  802deb:	5e                   	pop    %esi
+  802dec:	5f                   	pop    %edi
+  802ded:	5d                   	pop    %ebp
+  802dee:	c3                   	ret
+
+00802def <__udivdi3>:
+  802def:	83 ec 08             	sub    $0x8,%esp
+  802df2:	6a 00                	push   $0x0
+  802df4:	ff 74 24 1c          	push   0x1c(%esp)
+  802df8:	ff 74 24 1c          	push   0x1c(%esp)
+  802dfc:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802e00:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802e04:	e8 17 ff ff ff       	call   802d20 <dm>
+  802e09:	83 c4 14             	add    $0x14,%esp
+  802e0c:	c3                   	ret
+
+00802e0d <__umoddi3>:
+  802e0d:	83 ec 18             	sub    $0x18,%esp
+  802e10:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802e14:	50                   	push   %eax
+  802e15:	ff 74 24 2c          	push   0x2c(%esp)
+  802e19:	ff 74 24 2c          	push   0x2c(%esp)
+  802e1d:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e21:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e25:	e8 f6 fe ff ff       	call   802d20 <dm>
+  802e2a:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802e2e:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802e32:	83 c4 24             	add    $0x24,%esp
+  802e35:	c3                   	ret
+
+00802e36 <__divdi3>:
+  802e36:	53                   	push   %ebx
+  802e37:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802e3b:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802e3f:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  802e43:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  802e47:	85 d2                	test   %edx,%edx
+  802e49:	78 15                	js     802e60 <__divdi3+0x2a>
+  802e4b:	85 db                	test   %ebx,%ebx
+  802e4d:	78 34                	js     802e83 <__divdi3+0x4d>
+  802e4f:	83 ec 04             	sub    $0x4,%esp
+  802e52:	6a 00                	push   $0x0
+  802e54:	53                   	push   %ebx
+  802e55:	51                   	push   %ecx
+  802e56:	e8 c5 fe ff ff       	call   802d20 <dm>
+  802e5b:	83 c4 10             	add    $0x10,%esp
+  802e5e:	eb 21                	jmp    802e81 <__divdi3+0x4b>
+  802e60:	f7 d8                	neg    %eax
+  802e62:	83 d2 00             	adc    $0x0,%edx
+  802e65:	f7 da                	neg    %edx
+  802e67:	85 db                	test   %ebx,%ebx
+  802e69:	78 30                	js     802e9b <__divdi3+0x65>
+  802e6b:	83 ec 04             	sub    $0x4,%esp
+  802e6e:	6a 00                	push   $0x0
+  802e70:	53                   	push   %ebx
+  802e71:	51                   	push   %ecx
+  802e72:	e8 a9 fe ff ff       	call   802d20 <dm>
+  802e77:	83 c4 10             	add    $0x10,%esp
+  802e7a:	f7 d8                	neg    %eax
+  802e7c:	83 d2 00             	adc    $0x0,%edx
+  802e7f:	f7 da                	neg    %edx
+  802e81:	5b                   	pop    %ebx
+  802e82:	c3                   	ret
+  802e83:	83 ec 04             	sub    $0x4,%esp
+  802e86:	6a 00                	push   $0x0
+  802e88:	f7 d9                	neg    %ecx
+  802e8a:	83 d3 00             	adc    $0x0,%ebx
+  802e8d:	f7 db                	neg    %ebx
+  802e8f:	53                   	push   %ebx
+  802e90:	51                   	push   %ecx
+  802e91:	e8 8a fe ff ff       	call   802d20 <dm>
+  802e96:	83 c4 10             	add    $0x10,%esp
+  802e99:	eb df                	jmp    802e7a <__divdi3+0x44>
+  802e9b:	83 ec 04             	sub    $0x4,%esp
+  802e9e:	6a 00                	push   $0x0
+  802ea0:	f7 d9                	neg    %ecx
+  802ea2:	83 d3 00             	adc    $0x0,%ebx
+  802ea5:	f7 db                	neg    %ebx
+  802ea7:	53                   	push   %ebx
+  802ea8:	51                   	push   %ecx
+  802ea9:	e8 72 fe ff ff       	call   802d20 <dm>
+  802eae:	83 c4 10             	add    $0x10,%esp
+  802eb1:	eb ce                	jmp    802e81 <__divdi3+0x4b>
+
+00802eb3 <__moddi3>:
+  802eb3:	55                   	push   %ebp
+  802eb4:	57                   	push   %edi
+  802eb5:	56                   	push   %esi
+  802eb6:	53                   	push   %ebx
+  802eb7:	83 ec 18             	sub    $0x18,%esp
+  802eba:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802ebe:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802ec2:	89 f1                	mov    %esi,%ecx
+  802ec4:	f7 d9                	neg    %ecx
+  802ec6:	89 da                	mov    %ebx,%edx
+  802ec8:	83 d2 00             	adc    $0x0,%edx
+  802ecb:	f7 da                	neg    %edx
+  802ecd:	0f 48 ce             	cmovs  %esi,%ecx
+  802ed0:	0f 48 d3             	cmovs  %ebx,%edx
+  802ed3:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802ed7:	50                   	push   %eax
+  802ed8:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802edc:	f7 de                	neg    %esi
+  802ede:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802ee2:	83 d0 00             	adc    $0x0,%eax
+  802ee5:	f7 d8                	neg    %eax
+  802ee7:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802eec:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802ef1:	50                   	push   %eax
+  802ef2:	56                   	push   %esi
+  802ef3:	89 c8                	mov    %ecx,%eax
+  802ef5:	e8 26 fe ff ff       	call   802d20 <dm>
+  802efa:	83 c4 10             	add    $0x10,%esp
+  802efd:	85 db                	test   %ebx,%ebx
+  802eff:	78 10                	js     802f11 <__moddi3+0x5e>
+  802f01:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802f05:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802f09:	83 c4 14             	add    $0x14,%esp
+  802f0c:	5b                   	pop    %ebx
+  802f0d:	5e                   	pop    %esi
+  802f0e:	5f                   	pop    %edi
+  802f0f:	5d                   	pop    %ebp
+  802f10:	c3                   	ret
+  802f11:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802f15:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802f19:	f7 d8                	neg    %eax
+  802f1b:	83 d2 00             	adc    $0x0,%edx
+  802f1e:	f7 da                	neg    %edx
+  802f20:	eb e7                	jmp    802f09 <__moddi3+0x56>
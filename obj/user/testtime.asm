@@ -0,0 +1,5618 @@
+
+obj/user/testtime:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 6a 00 00 00       	call   80009b <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+	int i;
+
+	// Wait for the console to calm down
+	for (i = 0; i < 50; i++)
+  80003a:	bb 33 00 00 00       	mov    $0x33,%ebx
+  80003f:	eb 05                	jmp    800046 <umain+0x13>
+		sys_yield();
+  800041:	e8 7a 12 00 00       	call   8012c0 <sys_yield>
+	for (i = 0; i < 50; i++)
+  800046:	83 eb 01             	sub    $0x1,%ebx
+  800049:	75 f6                	jne    800041 <umain+0xe>
+
+	cprintf("starting count down: ");
+  80004b:	83 ec 0c             	sub    $0xc,%esp
+  80004e:	68 40 2c 80 00       	push   $0x802c40
+  800053:	e8 33 01 00 00       	call   80018b <cprintf>
+  800058:	83 c4 10             	add    $0x10,%esp
+	for (i = 5; i >= 0; i--) {
+  80005b:	bb 05 00 00 00       	mov    $0x5,%ebx
+		cprintf("%d ", i);
+  800060:	83 ec 08             	sub    $0x8,%esp
+  800063:	53                   	push   %ebx
+  800064:	68 56 2c 80 00       	push   $0x802c56
+  800069:	e8 1d 01 00 00       	call   80018b <cprintf>
+		sleep(1);
+  80006e:	83 c4 08             	add    $0x8,%esp
+  800071:	6a 00                	push   $0x0
+  800073:	6a 01                	push   $0x1
+  800075:	e8 25 27 00 00       	call   80279f <sleep>
+	for (i = 5; i >= 0; i--) {
+  80007a:	83 eb 01             	sub    $0x1,%ebx
+  80007d:	83 c4 10             	add    $0x10,%esp
+  800080:	83 fb ff             	cmp    $0xffffffff,%ebx
+  800083:	75 db                	jne    800060 <umain+0x2d>
+	}
+	cprintf("\n");
+  800085:	83 ec 0c             	sub    $0xc,%esp
+  800088:	68 5a 2c 80 00       	push   $0x802c5a
+  80008d:	e8 f9 00 00 00       	call   80018b <cprintf>
+#include <inc/types.h>
+
+static inline void
+breakpoint(void)
+{
+	asm volatile("int3");
+  800092:	cc                   	int3
+	breakpoint();
+}
+  800093:	83 c4 10             	add    $0x10,%esp
+  800096:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800099:	c9                   	leave
+  80009a:	c3                   	ret
+
+0080009b <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80009b:	55                   	push   %ebp
+  80009c:	89 e5                	mov    %esp,%ebp
+  80009e:	56                   	push   %esi
+  80009f:	53                   	push   %ebx
+  8000a0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000a3:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  8000a6:	e8 64 0e 00 00       	call   800f0f <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  8000ab:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000b0:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  8000b6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000bb:	a3 08 30 80 00       	mov    %eax,0x803008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000c0:	85 db                	test   %ebx,%ebx
+  8000c2:	7e 07                	jle    8000cb <libmain+0x30>
+		binaryname = argv[0];
+  8000c4:	8b 06                	mov    (%esi),%eax
+  8000c6:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  8000cb:	83 ec 08             	sub    $0x8,%esp
+  8000ce:	56                   	push   %esi
+  8000cf:	53                   	push   %ebx
+  8000d0:	e8 5e ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000d5:	e8 0a 00 00 00       	call   8000e4 <exit>
+}
+  8000da:	83 c4 10             	add    $0x10,%esp
+  8000dd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000e0:	5b                   	pop    %ebx
+  8000e1:	5e                   	pop    %esi
+  8000e2:	5d                   	pop    %ebp
+  8000e3:	c3                   	ret
+
+008000e4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000e4:	55                   	push   %ebp
+  8000e5:	89 e5                	mov    %esp,%ebp
+  8000e7:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  8000ea:	6a 00                	push   $0x0
+  8000ec:	e8 5c 0d 00 00       	call   800e4d <sys_env_destroy>
+}
+  8000f1:	83 c4 10             	add    $0x10,%esp
+  8000f4:	c9                   	leave
+  8000f5:	c3                   	ret
+
+008000f6 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000f6:	55                   	push   %ebp
+  8000f7:	89 e5                	mov    %esp,%ebp
+  8000f9:	53                   	push   %ebx
+  8000fa:	83 ec 04             	sub    $0x4,%esp
+  8000fd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800100:	8b 13                	mov    (%ebx),%edx
+  800102:	8d 42 01             	lea    0x1(%edx),%eax
+  800105:	89 03                	mov    %eax,(%ebx)
+  800107:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80010a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80010e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800113:	74 09                	je     80011e <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800115:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800119:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80011c:	c9                   	leave
+  80011d:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80011e:	83 ec 08             	sub    $0x8,%esp
+  800121:	68 ff 00 00 00       	push   $0xff
+  800126:	8d 43 08             	lea    0x8(%ebx),%eax
+  800129:	50                   	push   %eax
+  80012a:	e8 e2 0b 00 00       	call   800d11 <sys_cputs>
+		b->idx = 0;
+  80012f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800135:	83 c4 10             	add    $0x10,%esp
+  800138:	eb db                	jmp    800115 <putch+0x1f>
+
+0080013a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80013a:	55                   	push   %ebp
+  80013b:	89 e5                	mov    %esp,%ebp
+  80013d:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800143:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80014a:	00 00 00 
+	b.cnt = 0;
+  80014d:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800154:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800157:	ff 75 0c             	push   0xc(%ebp)
+  80015a:	ff 75 08             	push   0x8(%ebp)
+  80015d:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800163:	50                   	push   %eax
+  800164:	68 f6 00 80 00       	push   $0x8000f6
+  800169:	e8 14 01 00 00       	call   800282 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80016e:	83 c4 08             	add    $0x8,%esp
+  800171:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800177:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80017d:	50                   	push   %eax
+  80017e:	e8 8e 0b 00 00       	call   800d11 <sys_cputs>
+
+	return b.cnt;
+}
+  800183:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800189:	c9                   	leave
+  80018a:	c3                   	ret
+
+0080018b <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80018b:	55                   	push   %ebp
+  80018c:	89 e5                	mov    %esp,%ebp
+  80018e:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800191:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800194:	50                   	push   %eax
+  800195:	ff 75 08             	push   0x8(%ebp)
+  800198:	e8 9d ff ff ff       	call   80013a <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80019d:	c9                   	leave
+  80019e:	c3                   	ret
+
+0080019f <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80019f:	55                   	push   %ebp
+  8001a0:	89 e5                	mov    %esp,%ebp
+  8001a2:	57                   	push   %edi
+  8001a3:	56                   	push   %esi
+  8001a4:	53                   	push   %ebx
+  8001a5:	83 ec 1c             	sub    $0x1c,%esp
+  8001a8:	89 c7                	mov    %eax,%edi
+  8001aa:	89 d6                	mov    %edx,%esi
+  8001ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001af:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001b2:	89 d1                	mov    %edx,%ecx
+  8001b4:	89 c2                	mov    %eax,%edx
+  8001b6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001b9:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001bc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001bf:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001c2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001c5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001cc:	39 c2                	cmp    %eax,%edx
+  8001ce:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001d1:	72 3e                	jb     800211 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001d3:	83 ec 0c             	sub    $0xc,%esp
+  8001d6:	ff 75 18             	push   0x18(%ebp)
+  8001d9:	83 eb 01             	sub    $0x1,%ebx
+  8001dc:	53                   	push   %ebx
+  8001dd:	50                   	push   %eax
+  8001de:	83 ec 08             	sub    $0x8,%esp
+  8001e1:	ff 75 e4             	push   -0x1c(%ebp)
+  8001e4:	ff 75 e0             	push   -0x20(%ebp)
+  8001e7:	ff 75 dc             	push   -0x24(%ebp)
+  8001ea:	ff 75 d8             	push   -0x28(%ebp)
+  8001ed:	e8 0e 29 00 00       	call   802b00 <__udivdi3>
+  8001f2:	83 c4 18             	add    $0x18,%esp
+  8001f5:	52                   	push   %edx
+  8001f6:	50                   	push   %eax
+  8001f7:	89 f2                	mov    %esi,%edx
+  8001f9:	89 f8                	mov    %edi,%eax
+  8001fb:	e8 9f ff ff ff       	call   80019f <printnum>
+  800200:	83 c4 20             	add    $0x20,%esp
+  800203:	eb 13                	jmp    800218 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800205:	83 ec 08             	sub    $0x8,%esp
+  800208:	56                   	push   %esi
+  800209:	ff 75 18             	push   0x18(%ebp)
+  80020c:	ff d7                	call   *%edi
+  80020e:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800211:	83 eb 01             	sub    $0x1,%ebx
+  800214:	85 db                	test   %ebx,%ebx
+  800216:	7f ed                	jg     800205 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800218:	83 ec 08             	sub    $0x8,%esp
+  80021b:	56                   	push   %esi
+  80021c:	83 ec 04             	sub    $0x4,%esp
+  80021f:	ff 75 e4             	push   -0x1c(%ebp)
+  800222:	ff 75 e0             	push   -0x20(%ebp)
+  800225:	ff 75 dc             	push   -0x24(%ebp)
+  800228:	ff 75 d8             	push   -0x28(%ebp)
+  80022b:	e8 ee 28 00 00       	call   802b1e <__umoddi3>
+  800230:	83 c4 14             	add    $0x14,%esp
+  800233:	0f be 80 66 2c 80 00 	movsbl 0x802c66(%eax),%eax
+  80023a:	50                   	push   %eax
+  80023b:	ff d7                	call   *%edi
+}
+  80023d:	83 c4 10             	add    $0x10,%esp
+  800240:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800243:	5b                   	pop    %ebx
+  800244:	5e                   	pop    %esi
+  800245:	5f                   	pop    %edi
+  800246:	5d                   	pop    %ebp
+  800247:	c3                   	ret
+
+00800248 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800248:	55                   	push   %ebp
+  800249:	89 e5                	mov    %esp,%ebp
+  80024b:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80024e:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800252:	8b 10                	mov    (%eax),%edx
+  800254:	3b 50 04             	cmp    0x4(%eax),%edx
+  800257:	73 0a                	jae    800263 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800259:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80025c:	89 08                	mov    %ecx,(%eax)
+  80025e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800261:	88 02                	mov    %al,(%edx)
+}
+  800263:	5d                   	pop    %ebp
+  800264:	c3                   	ret
+
+00800265 <printfmt>:
+{
+  800265:	55                   	push   %ebp
+  800266:	89 e5                	mov    %esp,%ebp
+  800268:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80026b:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80026e:	50                   	push   %eax
+  80026f:	ff 75 10             	push   0x10(%ebp)
+  800272:	ff 75 0c             	push   0xc(%ebp)
+  800275:	ff 75 08             	push   0x8(%ebp)
+  800278:	e8 05 00 00 00       	call   800282 <vprintfmt>
+}
+  80027d:	83 c4 10             	add    $0x10,%esp
+  800280:	c9                   	leave
+  800281:	c3                   	ret
+
+00800282 <vprintfmt>:
+{
+  800282:	55                   	push   %ebp
+  800283:	89 e5                	mov    %esp,%ebp
+  800285:	57                   	push   %edi
+  800286:	56                   	push   %esi
+  800287:	53                   	push   %ebx
+  800288:	83 ec 2c             	sub    $0x2c,%esp
+  80028b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80028e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800291:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800294:	eb 0a                	jmp    8002a0 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800296:	83 ec 08             	sub    $0x8,%esp
+  800299:	53                   	push   %ebx
+  80029a:	50                   	push   %eax
+  80029b:	ff d6                	call   *%esi
+  80029d:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002a0:	83 c7 01             	add    $0x1,%edi
+  8002a3:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002a7:	83 f8 25             	cmp    $0x25,%eax
+  8002aa:	74 0c                	je     8002b8 <vprintfmt+0x36>
+			if (ch == '\0')
+  8002ac:	85 c0                	test   %eax,%eax
+  8002ae:	75 e6                	jne    800296 <vprintfmt+0x14>
+}
+  8002b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002b3:	5b                   	pop    %ebx
+  8002b4:	5e                   	pop    %esi
+  8002b5:	5f                   	pop    %edi
+  8002b6:	5d                   	pop    %ebp
+  8002b7:	c3                   	ret
+		padc = ' ';
+  8002b8:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002bc:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002c3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002ca:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8002d6:	8d 47 01             	lea    0x1(%edi),%eax
+  8002d9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002dc:	0f b6 17             	movzbl (%edi),%edx
+  8002df:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002e2:	3c 55                	cmp    $0x55,%al
+  8002e4:	0f 87 cf 03 00 00    	ja     8006b9 <vprintfmt+0x437>
+  8002ea:	0f b6 c0             	movzbl %al,%eax
+  8002ed:	ff 24 85 40 2d 80 00 	jmp    *0x802d40(,%eax,4)
+  8002f4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8002f7:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002fb:	eb d9                	jmp    8002d6 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8002fd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800300:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800304:	eb d0                	jmp    8002d6 <vprintfmt+0x54>
+  800306:	0f b6 d2             	movzbl %dl,%edx
+  800309:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80030c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800311:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800314:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800317:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80031b:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80031e:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800321:	83 f9 09             	cmp    $0x9,%ecx
+  800324:	77 55                	ja     80037b <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800326:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800329:	eb e9                	jmp    800314 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80032b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80032e:	8b 00                	mov    (%eax),%eax
+  800330:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800333:	8b 45 14             	mov    0x14(%ebp),%eax
+  800336:	8d 40 04             	lea    0x4(%eax),%eax
+  800339:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80033c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80033f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800343:	79 91                	jns    8002d6 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800345:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800348:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80034b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800352:	eb 82                	jmp    8002d6 <vprintfmt+0x54>
+			if (width < 0)
+  800354:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800357:	85 d2                	test   %edx,%edx
+  800359:	b8 00 00 00 00       	mov    $0x0,%eax
+  80035e:	0f 49 c2             	cmovns %edx,%eax
+  800361:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800364:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800367:	e9 6a ff ff ff       	jmp    8002d6 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80036c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80036f:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800376:	e9 5b ff ff ff       	jmp    8002d6 <vprintfmt+0x54>
+  80037b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80037e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800381:	eb bc                	jmp    80033f <vprintfmt+0xbd>
+			lflag++;
+  800383:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800386:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800389:	e9 48 ff ff ff       	jmp    8002d6 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80038e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800391:	8d 78 04             	lea    0x4(%eax),%edi
+  800394:	83 ec 08             	sub    $0x8,%esp
+  800397:	53                   	push   %ebx
+  800398:	ff 30                	push   (%eax)
+  80039a:	ff d6                	call   *%esi
+			break;
+  80039c:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80039f:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003a2:	e9 b1 02 00 00       	jmp    800658 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8003a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003aa:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003ad:	8b 10                	mov    (%eax),%edx
+  8003af:	89 d0                	mov    %edx,%eax
+  8003b1:	f7 d8                	neg    %eax
+  8003b3:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003b6:	83 f8 0d             	cmp    $0xd,%eax
+  8003b9:	7f 23                	jg     8003de <vprintfmt+0x15c>
+  8003bb:	8b 14 85 a0 2e 80 00 	mov    0x802ea0(,%eax,4),%edx
+  8003c2:	85 d2                	test   %edx,%edx
+  8003c4:	74 18                	je     8003de <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003c6:	52                   	push   %edx
+  8003c7:	68 87 2c 80 00       	push   $0x802c87
+  8003cc:	53                   	push   %ebx
+  8003cd:	56                   	push   %esi
+  8003ce:	e8 92 fe ff ff       	call   800265 <printfmt>
+  8003d3:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003d6:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003d9:	e9 7a 02 00 00       	jmp    800658 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8003de:	50                   	push   %eax
+  8003df:	68 7e 2c 80 00       	push   $0x802c7e
+  8003e4:	53                   	push   %ebx
+  8003e5:	56                   	push   %esi
+  8003e6:	e8 7a fe ff ff       	call   800265 <printfmt>
+  8003eb:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003ee:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003f1:	e9 62 02 00 00       	jmp    800658 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f9:	83 c0 04             	add    $0x4,%eax
+  8003fc:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800402:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800404:	85 c9                	test   %ecx,%ecx
+  800406:	b8 77 2c 80 00       	mov    $0x802c77,%eax
+  80040b:	0f 45 c1             	cmovne %ecx,%eax
+  80040e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800411:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800415:	7e 06                	jle    80041d <vprintfmt+0x19b>
+  800417:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80041b:	75 0b                	jne    800428 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80041d:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800420:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800423:	89 75 08             	mov    %esi,0x8(%ebp)
+  800426:	eb 5c                	jmp    800484 <vprintfmt+0x202>
+  800428:	83 ec 08             	sub    $0x8,%esp
+  80042b:	ff 75 d0             	push   -0x30(%ebp)
+  80042e:	ff 75 cc             	push   -0x34(%ebp)
+  800431:	e8 20 03 00 00       	call   800756 <strnlen>
+  800436:	89 c2                	mov    %eax,%edx
+  800438:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80043b:	29 d0                	sub    %edx,%eax
+  80043d:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800440:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800444:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800447:	89 75 08             	mov    %esi,0x8(%ebp)
+  80044a:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80044c:	eb 0e                	jmp    80045c <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80044e:	83 ec 08             	sub    $0x8,%esp
+  800451:	53                   	push   %ebx
+  800452:	57                   	push   %edi
+  800453:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800456:	83 ee 01             	sub    $0x1,%esi
+  800459:	83 c4 10             	add    $0x10,%esp
+  80045c:	85 f6                	test   %esi,%esi
+  80045e:	7f ee                	jg     80044e <vprintfmt+0x1cc>
+  800460:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800463:	8b 75 08             	mov    0x8(%ebp),%esi
+  800466:	85 c0                	test   %eax,%eax
+  800468:	ba 00 00 00 00       	mov    $0x0,%edx
+  80046d:	0f 49 d0             	cmovns %eax,%edx
+  800470:	29 d0                	sub    %edx,%eax
+  800472:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800475:	eb a6                	jmp    80041d <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800477:	83 ec 08             	sub    $0x8,%esp
+  80047a:	53                   	push   %ebx
+  80047b:	52                   	push   %edx
+  80047c:	ff 55 08             	call   *0x8(%ebp)
+  80047f:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800482:	89 f1                	mov    %esi,%ecx
+  800484:	8d 71 01             	lea    0x1(%ecx),%esi
+  800487:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80048b:	0f be d0             	movsbl %al,%edx
+  80048e:	85 d2                	test   %edx,%edx
+  800490:	74 28                	je     8004ba <vprintfmt+0x238>
+  800492:	85 ff                	test   %edi,%edi
+  800494:	78 05                	js     80049b <vprintfmt+0x219>
+  800496:	83 ef 01             	sub    $0x1,%edi
+  800499:	78 30                	js     8004cb <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80049b:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80049f:	74 d6                	je     800477 <vprintfmt+0x1f5>
+  8004a1:	0f be c0             	movsbl %al,%eax
+  8004a4:	83 e8 20             	sub    $0x20,%eax
+  8004a7:	83 f8 5e             	cmp    $0x5e,%eax
+  8004aa:	76 cb                	jbe    800477 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004ac:	83 ec 08             	sub    $0x8,%esp
+  8004af:	53                   	push   %ebx
+  8004b0:	6a 3f                	push   $0x3f
+  8004b2:	ff 55 08             	call   *0x8(%ebp)
+  8004b5:	83 c4 10             	add    $0x10,%esp
+  8004b8:	eb c8                	jmp    800482 <vprintfmt+0x200>
+  8004ba:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004bd:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004c0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004c3:	01 d0                	add    %edx,%eax
+  8004c5:	29 c8                	sub    %ecx,%eax
+  8004c7:	89 c7                	mov    %eax,%edi
+  8004c9:	eb 13                	jmp    8004de <vprintfmt+0x25c>
+  8004cb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004ce:	eb ed                	jmp    8004bd <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004d0:	83 ec 08             	sub    $0x8,%esp
+  8004d3:	53                   	push   %ebx
+  8004d4:	6a 20                	push   $0x20
+  8004d6:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004d8:	83 ef 01             	sub    $0x1,%edi
+  8004db:	83 c4 10             	add    $0x10,%esp
+  8004de:	85 ff                	test   %edi,%edi
+  8004e0:	7f ee                	jg     8004d0 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004e2:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004e5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004e8:	e9 6b 01 00 00       	jmp    800658 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8004ed:	83 f9 01             	cmp    $0x1,%ecx
+  8004f0:	7f 1f                	jg     800511 <vprintfmt+0x28f>
+	else if (lflag)
+  8004f2:	85 c9                	test   %ecx,%ecx
+  8004f4:	74 67                	je     80055d <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8004f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f9:	8b 00                	mov    (%eax),%eax
+  8004fb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004fe:	89 c1                	mov    %eax,%ecx
+  800500:	c1 f9 1f             	sar    $0x1f,%ecx
+  800503:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800506:	8b 45 14             	mov    0x14(%ebp),%eax
+  800509:	8d 40 04             	lea    0x4(%eax),%eax
+  80050c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80050f:	eb 17                	jmp    800528 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800511:	8b 45 14             	mov    0x14(%ebp),%eax
+  800514:	8b 50 04             	mov    0x4(%eax),%edx
+  800517:	8b 00                	mov    (%eax),%eax
+  800519:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80051c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80051f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800522:	8d 40 08             	lea    0x8(%eax),%eax
+  800525:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800528:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80052b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80052e:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800533:	85 c9                	test   %ecx,%ecx
+  800535:	0f 89 03 01 00 00    	jns    80063e <vprintfmt+0x3bc>
+				putch('-', putdat);
+  80053b:	83 ec 08             	sub    $0x8,%esp
+  80053e:	53                   	push   %ebx
+  80053f:	6a 2d                	push   $0x2d
+  800541:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800543:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800546:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800549:	f7 da                	neg    %edx
+  80054b:	83 d1 00             	adc    $0x0,%ecx
+  80054e:	f7 d9                	neg    %ecx
+  800550:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800553:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800558:	e9 e1 00 00 00       	jmp    80063e <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80055d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800560:	8b 00                	mov    (%eax),%eax
+  800562:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800565:	89 c1                	mov    %eax,%ecx
+  800567:	c1 f9 1f             	sar    $0x1f,%ecx
+  80056a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80056d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800570:	8d 40 04             	lea    0x4(%eax),%eax
+  800573:	89 45 14             	mov    %eax,0x14(%ebp)
+  800576:	eb b0                	jmp    800528 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800578:	83 f9 01             	cmp    $0x1,%ecx
+  80057b:	7f 1e                	jg     80059b <vprintfmt+0x319>
+	else if (lflag)
+  80057d:	85 c9                	test   %ecx,%ecx
+  80057f:	74 32                	je     8005b3 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800581:	8b 45 14             	mov    0x14(%ebp),%eax
+  800584:	8b 10                	mov    (%eax),%edx
+  800586:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80058b:	8d 40 04             	lea    0x4(%eax),%eax
+  80058e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800591:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800596:	e9 a3 00 00 00       	jmp    80063e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80059b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059e:	8b 10                	mov    (%eax),%edx
+  8005a0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005a3:	8d 40 08             	lea    0x8(%eax),%eax
+  8005a6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005a9:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005ae:	e9 8b 00 00 00       	jmp    80063e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b6:	8b 10                	mov    (%eax),%edx
+  8005b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005bd:	8d 40 04             	lea    0x4(%eax),%eax
+  8005c0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005c3:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005c8:	eb 74                	jmp    80063e <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8005ca:	83 f9 01             	cmp    $0x1,%ecx
+  8005cd:	7f 1b                	jg     8005ea <vprintfmt+0x368>
+	else if (lflag)
+  8005cf:	85 c9                	test   %ecx,%ecx
+  8005d1:	74 2c                	je     8005ff <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8005d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d6:	8b 10                	mov    (%eax),%edx
+  8005d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005dd:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005e3:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8005e8:	eb 54                	jmp    80063e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ed:	8b 10                	mov    (%eax),%edx
+  8005ef:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005f2:	8d 40 08             	lea    0x8(%eax),%eax
+  8005f5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005f8:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8005fd:	eb 3f                	jmp    80063e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800602:	8b 10                	mov    (%eax),%edx
+  800604:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800609:	8d 40 04             	lea    0x4(%eax),%eax
+  80060c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80060f:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800614:	eb 28                	jmp    80063e <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800616:	83 ec 08             	sub    $0x8,%esp
+  800619:	53                   	push   %ebx
+  80061a:	6a 30                	push   $0x30
+  80061c:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80061e:	83 c4 08             	add    $0x8,%esp
+  800621:	53                   	push   %ebx
+  800622:	6a 78                	push   $0x78
+  800624:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800626:	8b 45 14             	mov    0x14(%ebp),%eax
+  800629:	8b 10                	mov    (%eax),%edx
+  80062b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800630:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800633:	8d 40 04             	lea    0x4(%eax),%eax
+  800636:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800639:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80063e:	83 ec 0c             	sub    $0xc,%esp
+  800641:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800645:	50                   	push   %eax
+  800646:	ff 75 e0             	push   -0x20(%ebp)
+  800649:	57                   	push   %edi
+  80064a:	51                   	push   %ecx
+  80064b:	52                   	push   %edx
+  80064c:	89 da                	mov    %ebx,%edx
+  80064e:	89 f0                	mov    %esi,%eax
+  800650:	e8 4a fb ff ff       	call   80019f <printnum>
+			break;
+  800655:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800658:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80065b:	e9 40 fc ff ff       	jmp    8002a0 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800660:	83 f9 01             	cmp    $0x1,%ecx
+  800663:	7f 1b                	jg     800680 <vprintfmt+0x3fe>
+	else if (lflag)
+  800665:	85 c9                	test   %ecx,%ecx
+  800667:	74 2c                	je     800695 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800669:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066c:	8b 10                	mov    (%eax),%edx
+  80066e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800673:	8d 40 04             	lea    0x4(%eax),%eax
+  800676:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800679:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80067e:	eb be                	jmp    80063e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800680:	8b 45 14             	mov    0x14(%ebp),%eax
+  800683:	8b 10                	mov    (%eax),%edx
+  800685:	8b 48 04             	mov    0x4(%eax),%ecx
+  800688:	8d 40 08             	lea    0x8(%eax),%eax
+  80068b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80068e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800693:	eb a9                	jmp    80063e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800695:	8b 45 14             	mov    0x14(%ebp),%eax
+  800698:	8b 10                	mov    (%eax),%edx
+  80069a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80069f:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006a5:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006aa:	eb 92                	jmp    80063e <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8006ac:	83 ec 08             	sub    $0x8,%esp
+  8006af:	53                   	push   %ebx
+  8006b0:	6a 25                	push   $0x25
+  8006b2:	ff d6                	call   *%esi
+			break;
+  8006b4:	83 c4 10             	add    $0x10,%esp
+  8006b7:	eb 9f                	jmp    800658 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8006b9:	83 ec 08             	sub    $0x8,%esp
+  8006bc:	53                   	push   %ebx
+  8006bd:	6a 25                	push   $0x25
+  8006bf:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006c1:	83 c4 10             	add    $0x10,%esp
+  8006c4:	89 f8                	mov    %edi,%eax
+  8006c6:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006ca:	74 05                	je     8006d1 <vprintfmt+0x44f>
+  8006cc:	83 e8 01             	sub    $0x1,%eax
+  8006cf:	eb f5                	jmp    8006c6 <vprintfmt+0x444>
+  8006d1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006d4:	eb 82                	jmp    800658 <vprintfmt+0x3d6>
+
+008006d6 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006d6:	55                   	push   %ebp
+  8006d7:	89 e5                	mov    %esp,%ebp
+  8006d9:	83 ec 18             	sub    $0x18,%esp
+  8006dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006df:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006e2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006e5:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006e9:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006ec:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006f3:	85 c0                	test   %eax,%eax
+  8006f5:	74 26                	je     80071d <vsnprintf+0x47>
+  8006f7:	85 d2                	test   %edx,%edx
+  8006f9:	7e 22                	jle    80071d <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006fb:	ff 75 14             	push   0x14(%ebp)
+  8006fe:	ff 75 10             	push   0x10(%ebp)
+  800701:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800704:	50                   	push   %eax
+  800705:	68 48 02 80 00       	push   $0x800248
+  80070a:	e8 73 fb ff ff       	call   800282 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80070f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800712:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800715:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800718:	83 c4 10             	add    $0x10,%esp
+}
+  80071b:	c9                   	leave
+  80071c:	c3                   	ret
+		return -E_INVAL;
+  80071d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800722:	eb f7                	jmp    80071b <vsnprintf+0x45>
+
+00800724 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800724:	55                   	push   %ebp
+  800725:	89 e5                	mov    %esp,%ebp
+  800727:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80072a:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80072d:	50                   	push   %eax
+  80072e:	ff 75 10             	push   0x10(%ebp)
+  800731:	ff 75 0c             	push   0xc(%ebp)
+  800734:	ff 75 08             	push   0x8(%ebp)
+  800737:	e8 9a ff ff ff       	call   8006d6 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80073c:	c9                   	leave
+  80073d:	c3                   	ret
+
+0080073e <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80073e:	55                   	push   %ebp
+  80073f:	89 e5                	mov    %esp,%ebp
+  800741:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800744:	b8 00 00 00 00       	mov    $0x0,%eax
+  800749:	eb 03                	jmp    80074e <strlen+0x10>
+		n++;
+  80074b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80074e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800752:	75 f7                	jne    80074b <strlen+0xd>
+	return n;
+}
+  800754:	5d                   	pop    %ebp
+  800755:	c3                   	ret
+
+00800756 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800756:	55                   	push   %ebp
+  800757:	89 e5                	mov    %esp,%ebp
+  800759:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80075c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80075f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800764:	eb 03                	jmp    800769 <strnlen+0x13>
+		n++;
+  800766:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800769:	39 d0                	cmp    %edx,%eax
+  80076b:	74 08                	je     800775 <strnlen+0x1f>
+  80076d:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800771:	75 f3                	jne    800766 <strnlen+0x10>
+  800773:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800775:	89 d0                	mov    %edx,%eax
+  800777:	5d                   	pop    %ebp
+  800778:	c3                   	ret
+
+00800779 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800779:	55                   	push   %ebp
+  80077a:	89 e5                	mov    %esp,%ebp
+  80077c:	53                   	push   %ebx
+  80077d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800780:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800783:	b8 00 00 00 00       	mov    $0x0,%eax
+  800788:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80078c:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80078f:	83 c0 01             	add    $0x1,%eax
+  800792:	84 d2                	test   %dl,%dl
+  800794:	75 f2                	jne    800788 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800796:	89 c8                	mov    %ecx,%eax
+  800798:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80079b:	c9                   	leave
+  80079c:	c3                   	ret
+
+0080079d <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80079d:	55                   	push   %ebp
+  80079e:	89 e5                	mov    %esp,%ebp
+  8007a0:	53                   	push   %ebx
+  8007a1:	83 ec 10             	sub    $0x10,%esp
+  8007a4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007a7:	53                   	push   %ebx
+  8007a8:	e8 91 ff ff ff       	call   80073e <strlen>
+  8007ad:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007b0:	ff 75 0c             	push   0xc(%ebp)
+  8007b3:	01 d8                	add    %ebx,%eax
+  8007b5:	50                   	push   %eax
+  8007b6:	e8 be ff ff ff       	call   800779 <strcpy>
+	return dst;
+}
+  8007bb:	89 d8                	mov    %ebx,%eax
+  8007bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007c0:	c9                   	leave
+  8007c1:	c3                   	ret
+
+008007c2 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007c2:	55                   	push   %ebp
+  8007c3:	89 e5                	mov    %esp,%ebp
+  8007c5:	56                   	push   %esi
+  8007c6:	53                   	push   %ebx
+  8007c7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007ca:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007cd:	89 f3                	mov    %esi,%ebx
+  8007cf:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007d2:	89 f0                	mov    %esi,%eax
+  8007d4:	eb 0f                	jmp    8007e5 <strncpy+0x23>
+		*dst++ = *src;
+  8007d6:	83 c0 01             	add    $0x1,%eax
+  8007d9:	0f b6 0a             	movzbl (%edx),%ecx
+  8007dc:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007df:	80 f9 01             	cmp    $0x1,%cl
+  8007e2:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007e5:	39 d8                	cmp    %ebx,%eax
+  8007e7:	75 ed                	jne    8007d6 <strncpy+0x14>
+	}
+	return ret;
+}
+  8007e9:	89 f0                	mov    %esi,%eax
+  8007eb:	5b                   	pop    %ebx
+  8007ec:	5e                   	pop    %esi
+  8007ed:	5d                   	pop    %ebp
+  8007ee:	c3                   	ret
+
+008007ef <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007ef:	55                   	push   %ebp
+  8007f0:	89 e5                	mov    %esp,%ebp
+  8007f2:	56                   	push   %esi
+  8007f3:	53                   	push   %ebx
+  8007f4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007fa:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8007fd:	89 f0                	mov    %esi,%eax
+  8007ff:	85 d2                	test   %edx,%edx
+  800801:	74 21                	je     800824 <strlcpy+0x35>
+  800803:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800807:	89 f2                	mov    %esi,%edx
+  800809:	eb 09                	jmp    800814 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80080b:	83 c1 01             	add    $0x1,%ecx
+  80080e:	83 c2 01             	add    $0x1,%edx
+  800811:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800814:	39 c2                	cmp    %eax,%edx
+  800816:	74 09                	je     800821 <strlcpy+0x32>
+  800818:	0f b6 19             	movzbl (%ecx),%ebx
+  80081b:	84 db                	test   %bl,%bl
+  80081d:	75 ec                	jne    80080b <strlcpy+0x1c>
+  80081f:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800821:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800824:	29 f0                	sub    %esi,%eax
+}
+  800826:	5b                   	pop    %ebx
+  800827:	5e                   	pop    %esi
+  800828:	5d                   	pop    %ebp
+  800829:	c3                   	ret
+
+0080082a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80082a:	55                   	push   %ebp
+  80082b:	89 e5                	mov    %esp,%ebp
+  80082d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800830:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800833:	eb 06                	jmp    80083b <strcmp+0x11>
+		p++, q++;
+  800835:	83 c1 01             	add    $0x1,%ecx
+  800838:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80083b:	0f b6 01             	movzbl (%ecx),%eax
+  80083e:	84 c0                	test   %al,%al
+  800840:	74 04                	je     800846 <strcmp+0x1c>
+  800842:	3a 02                	cmp    (%edx),%al
+  800844:	74 ef                	je     800835 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800846:	0f b6 c0             	movzbl %al,%eax
+  800849:	0f b6 12             	movzbl (%edx),%edx
+  80084c:	29 d0                	sub    %edx,%eax
+}
+  80084e:	5d                   	pop    %ebp
+  80084f:	c3                   	ret
+
+00800850 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800850:	55                   	push   %ebp
+  800851:	89 e5                	mov    %esp,%ebp
+  800853:	53                   	push   %ebx
+  800854:	8b 45 08             	mov    0x8(%ebp),%eax
+  800857:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80085a:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80085d:	eb 09                	jmp    800868 <strncmp+0x18>
+		n--, p++, q++;
+  80085f:	83 ea 01             	sub    $0x1,%edx
+  800862:	83 c0 01             	add    $0x1,%eax
+  800865:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800868:	85 d2                	test   %edx,%edx
+  80086a:	74 18                	je     800884 <strncmp+0x34>
+  80086c:	0f b6 18             	movzbl (%eax),%ebx
+  80086f:	84 db                	test   %bl,%bl
+  800871:	74 04                	je     800877 <strncmp+0x27>
+  800873:	3a 19                	cmp    (%ecx),%bl
+  800875:	74 e8                	je     80085f <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800877:	0f b6 00             	movzbl (%eax),%eax
+  80087a:	0f b6 11             	movzbl (%ecx),%edx
+  80087d:	29 d0                	sub    %edx,%eax
+}
+  80087f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800882:	c9                   	leave
+  800883:	c3                   	ret
+		return 0;
+  800884:	b8 00 00 00 00       	mov    $0x0,%eax
+  800889:	eb f4                	jmp    80087f <strncmp+0x2f>
+
+0080088b <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80088b:	55                   	push   %ebp
+  80088c:	89 e5                	mov    %esp,%ebp
+  80088e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800891:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800895:	eb 03                	jmp    80089a <strchr+0xf>
+  800897:	83 c0 01             	add    $0x1,%eax
+  80089a:	0f b6 10             	movzbl (%eax),%edx
+  80089d:	84 d2                	test   %dl,%dl
+  80089f:	74 06                	je     8008a7 <strchr+0x1c>
+		if (*s == c)
+  8008a1:	38 ca                	cmp    %cl,%dl
+  8008a3:	75 f2                	jne    800897 <strchr+0xc>
+  8008a5:	eb 05                	jmp    8008ac <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008ac:	5d                   	pop    %ebp
+  8008ad:	c3                   	ret
+
+008008ae <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008ae:	55                   	push   %ebp
+  8008af:	89 e5                	mov    %esp,%ebp
+  8008b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008b4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008b8:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008bb:	38 ca                	cmp    %cl,%dl
+  8008bd:	74 09                	je     8008c8 <strfind+0x1a>
+  8008bf:	84 d2                	test   %dl,%dl
+  8008c1:	74 05                	je     8008c8 <strfind+0x1a>
+	for (; *s; s++)
+  8008c3:	83 c0 01             	add    $0x1,%eax
+  8008c6:	eb f0                	jmp    8008b8 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008c8:	5d                   	pop    %ebp
+  8008c9:	c3                   	ret
+
+008008ca <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008ca:	55                   	push   %ebp
+  8008cb:	89 e5                	mov    %esp,%ebp
+  8008cd:	57                   	push   %edi
+  8008ce:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008d1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008d4:	85 c9                	test   %ecx,%ecx
+  8008d6:	74 20                	je     8008f8 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008d8:	89 f8                	mov    %edi,%eax
+  8008da:	09 c8                	or     %ecx,%eax
+  8008dc:	a8 03                	test   $0x3,%al
+  8008de:	75 12                	jne    8008f2 <memset+0x28>
+		c &= 0xFF;
+  8008e0:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008e4:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008ea:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008ed:	fc                   	cld
+  8008ee:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008f0:	eb 06                	jmp    8008f8 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008f2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008f5:	fc                   	cld
+  8008f6:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008f8:	89 f8                	mov    %edi,%eax
+  8008fa:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008fd:	c9                   	leave
+  8008fe:	c3                   	ret
+
+008008ff <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008ff:	55                   	push   %ebp
+  800900:	89 e5                	mov    %esp,%ebp
+  800902:	57                   	push   %edi
+  800903:	56                   	push   %esi
+  800904:	8b 45 08             	mov    0x8(%ebp),%eax
+  800907:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80090a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80090d:	39 c6                	cmp    %eax,%esi
+  80090f:	73 32                	jae    800943 <memmove+0x44>
+  800911:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800914:	39 d0                	cmp    %edx,%eax
+  800916:	73 2b                	jae    800943 <memmove+0x44>
+		s += n;
+		d += n;
+  800918:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80091b:	89 d6                	mov    %edx,%esi
+  80091d:	09 fe                	or     %edi,%esi
+  80091f:	09 ce                	or     %ecx,%esi
+  800921:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800927:	75 0e                	jne    800937 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800929:	83 ef 04             	sub    $0x4,%edi
+  80092c:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80092f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800932:	fd                   	std
+  800933:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800935:	eb 09                	jmp    800940 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800937:	83 ef 01             	sub    $0x1,%edi
+  80093a:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80093d:	fd                   	std
+  80093e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800940:	fc                   	cld
+  800941:	eb 1a                	jmp    80095d <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800943:	89 f2                	mov    %esi,%edx
+  800945:	09 c2                	or     %eax,%edx
+  800947:	09 ca                	or     %ecx,%edx
+  800949:	f6 c2 03             	test   $0x3,%dl
+  80094c:	75 0a                	jne    800958 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80094e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800951:	89 c7                	mov    %eax,%edi
+  800953:	fc                   	cld
+  800954:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800956:	eb 05                	jmp    80095d <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800958:	89 c7                	mov    %eax,%edi
+  80095a:	fc                   	cld
+  80095b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80095d:	5e                   	pop    %esi
+  80095e:	5f                   	pop    %edi
+  80095f:	5d                   	pop    %ebp
+  800960:	c3                   	ret
+
+00800961 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800961:	55                   	push   %ebp
+  800962:	89 e5                	mov    %esp,%ebp
+  800964:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800967:	ff 75 10             	push   0x10(%ebp)
+  80096a:	ff 75 0c             	push   0xc(%ebp)
+  80096d:	ff 75 08             	push   0x8(%ebp)
+  800970:	e8 8a ff ff ff       	call   8008ff <memmove>
+}
+  800975:	c9                   	leave
+  800976:	c3                   	ret
+
+00800977 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800977:	55                   	push   %ebp
+  800978:	89 e5                	mov    %esp,%ebp
+  80097a:	56                   	push   %esi
+  80097b:	53                   	push   %ebx
+  80097c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80097f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800982:	89 c6                	mov    %eax,%esi
+  800984:	03 75 10             	add    0x10(%ebp),%esi
+  800987:	eb 06                	jmp    80098f <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800989:	83 c0 01             	add    $0x1,%eax
+  80098c:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  80098f:	39 f0                	cmp    %esi,%eax
+  800991:	74 14                	je     8009a7 <memcmp+0x30>
+		if (*s1 != *s2)
+  800993:	0f b6 08             	movzbl (%eax),%ecx
+  800996:	0f b6 1a             	movzbl (%edx),%ebx
+  800999:	38 d9                	cmp    %bl,%cl
+  80099b:	74 ec                	je     800989 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  80099d:	0f b6 c1             	movzbl %cl,%eax
+  8009a0:	0f b6 db             	movzbl %bl,%ebx
+  8009a3:	29 d8                	sub    %ebx,%eax
+  8009a5:	eb 05                	jmp    8009ac <memcmp+0x35>
+	}
+
+	return 0;
+  8009a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009ac:	5b                   	pop    %ebx
+  8009ad:	5e                   	pop    %esi
+  8009ae:	5d                   	pop    %ebp
+  8009af:	c3                   	ret
+
+008009b0 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009b0:	55                   	push   %ebp
+  8009b1:	89 e5                	mov    %esp,%ebp
+  8009b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009b9:	89 c2                	mov    %eax,%edx
+  8009bb:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009be:	eb 03                	jmp    8009c3 <memfind+0x13>
+  8009c0:	83 c0 01             	add    $0x1,%eax
+  8009c3:	39 d0                	cmp    %edx,%eax
+  8009c5:	73 04                	jae    8009cb <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009c7:	38 08                	cmp    %cl,(%eax)
+  8009c9:	75 f5                	jne    8009c0 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009cb:	5d                   	pop    %ebp
+  8009cc:	c3                   	ret
+
+008009cd <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009cd:	55                   	push   %ebp
+  8009ce:	89 e5                	mov    %esp,%ebp
+  8009d0:	57                   	push   %edi
+  8009d1:	56                   	push   %esi
+  8009d2:	53                   	push   %ebx
+  8009d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009d6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009d9:	eb 03                	jmp    8009de <strtol+0x11>
+		s++;
+  8009db:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8009de:	0f b6 02             	movzbl (%edx),%eax
+  8009e1:	3c 20                	cmp    $0x20,%al
+  8009e3:	74 f6                	je     8009db <strtol+0xe>
+  8009e5:	3c 09                	cmp    $0x9,%al
+  8009e7:	74 f2                	je     8009db <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009e9:	3c 2b                	cmp    $0x2b,%al
+  8009eb:	74 2a                	je     800a17 <strtol+0x4a>
+	int neg = 0;
+  8009ed:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009f2:	3c 2d                	cmp    $0x2d,%al
+  8009f4:	74 2b                	je     800a21 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009f6:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009fc:	75 0f                	jne    800a0d <strtol+0x40>
+  8009fe:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a01:	74 28                	je     800a2b <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a03:	85 db                	test   %ebx,%ebx
+  800a05:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a0a:	0f 44 d8             	cmove  %eax,%ebx
+  800a0d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a12:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a15:	eb 46                	jmp    800a5d <strtol+0x90>
+		s++;
+  800a17:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a1f:	eb d5                	jmp    8009f6 <strtol+0x29>
+		s++, neg = 1;
+  800a21:	83 c2 01             	add    $0x1,%edx
+  800a24:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a29:	eb cb                	jmp    8009f6 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a2b:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a2f:	74 0e                	je     800a3f <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a31:	85 db                	test   %ebx,%ebx
+  800a33:	75 d8                	jne    800a0d <strtol+0x40>
+		s++, base = 8;
+  800a35:	83 c2 01             	add    $0x1,%edx
+  800a38:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a3d:	eb ce                	jmp    800a0d <strtol+0x40>
+		s += 2, base = 16;
+  800a3f:	83 c2 02             	add    $0x2,%edx
+  800a42:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a47:	eb c4                	jmp    800a0d <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a49:	0f be c0             	movsbl %al,%eax
+  800a4c:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a4f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a52:	7d 3a                	jge    800a8e <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a54:	83 c2 01             	add    $0x1,%edx
+  800a57:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a5b:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a5d:	0f b6 02             	movzbl (%edx),%eax
+  800a60:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a63:	89 f3                	mov    %esi,%ebx
+  800a65:	80 fb 09             	cmp    $0x9,%bl
+  800a68:	76 df                	jbe    800a49 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a6a:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a6d:	89 f3                	mov    %esi,%ebx
+  800a6f:	80 fb 19             	cmp    $0x19,%bl
+  800a72:	77 08                	ja     800a7c <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a74:	0f be c0             	movsbl %al,%eax
+  800a77:	83 e8 57             	sub    $0x57,%eax
+  800a7a:	eb d3                	jmp    800a4f <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a7c:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a7f:	89 f3                	mov    %esi,%ebx
+  800a81:	80 fb 19             	cmp    $0x19,%bl
+  800a84:	77 08                	ja     800a8e <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a86:	0f be c0             	movsbl %al,%eax
+  800a89:	83 e8 37             	sub    $0x37,%eax
+  800a8c:	eb c1                	jmp    800a4f <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a8e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a92:	74 05                	je     800a99 <strtol+0xcc>
+		*endptr = (char *) s;
+  800a94:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a97:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a99:	89 c8                	mov    %ecx,%eax
+  800a9b:	f7 d8                	neg    %eax
+  800a9d:	85 ff                	test   %edi,%edi
+  800a9f:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800aa2:	89 c8                	mov    %ecx,%eax
+  800aa4:	5b                   	pop    %ebx
+  800aa5:	5e                   	pop    %esi
+  800aa6:	5f                   	pop    %edi
+  800aa7:	5d                   	pop    %ebp
+  800aa8:	c3                   	ret
+
+00800aa9 <atoi>:
+
+int
+atoi(const char *s)
+{
+  800aa9:	55                   	push   %ebp
+  800aaa:	89 e5                	mov    %esp,%ebp
+  800aac:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800aaf:	6a 0a                	push   $0xa
+  800ab1:	6a 00                	push   $0x0
+  800ab3:	ff 75 08             	push   0x8(%ebp)
+  800ab6:	e8 12 ff ff ff       	call   8009cd <strtol>
+}
+  800abb:	c9                   	leave
+  800abc:	c3                   	ret
+
+00800abd <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800abd:	55                   	push   %ebp
+  800abe:	89 e5                	mov    %esp,%ebp
+  800ac0:	57                   	push   %edi
+  800ac1:	56                   	push   %esi
+  800ac2:	53                   	push   %ebx
+  800ac3:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800ac9:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800acf:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800ad5:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800adb:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800ae2:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800ae5:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800aec:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800aef:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800af6:	74 76                	je     800b6e <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800af8:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800afe:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b01:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800b07:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b0e:	0f 88 06 01 00 00    	js     800c1a <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800b14:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b1b:	0f 84 48 01 00 00    	je     800c69 <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800b21:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800b27:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800b2d:	be 00 00 00 00       	mov    $0x0,%esi
+  800b32:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800b38:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b3b:	55                   	push   %ebp
+  800b3c:	68 45 0b 80 00       	push   $0x800b45
+  800b41:	89 e5                	mov    %esp,%ebp
+  800b43:	0f 34                	sysenter
+  800b45:	83 c4 04             	add    $0x4,%esp
+  800b48:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800b49:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800b4f:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800b55:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800b58:	0f 85 9a 01 00 00    	jne    800cf8 <page_vec_call+0x23b>
+  800b5e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b63:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b66:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b69:	e9 29 01 00 00       	jmp    800c97 <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800b6e:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800b74:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b77:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800b79:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b80:	78 2f                	js     800bb1 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800b82:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b89:	74 72                	je     800bfd <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800b8b:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800b91:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800b97:	b8 10 00 00 00       	mov    $0x10,%eax
+  800b9c:	89 fb                	mov    %edi,%ebx
+  800b9e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800ba1:	55                   	push   %ebp
+  800ba2:	68 ab 0b 80 00       	push   $0x800bab
+  800ba7:	89 e5                	mov    %esp,%ebp
+  800ba9:	0f 34                	sysenter
+  800bab:	83 c4 04             	add    $0x4,%esp
+  800bae:	5d                   	pop    %ebp
+	return ret;
+  800baf:	eb 98                	jmp    800b49 <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800bb1:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bb6:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800bb8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800bbd:	f6 c6 08             	test   $0x8,%dh
+  800bc0:	74 15                	je     800bd7 <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800bc2:	89 c2                	mov    %eax,%edx
+  800bc4:	c1 ea 08             	shr    $0x8,%edx
+  800bc7:	83 e2 0f             	and    $0xf,%edx
+  800bca:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800bcf:	83 fa 06             	cmp    $0x6,%edx
+  800bd2:	74 0e                	je     800be2 <page_vec_call+0x125>
+  800bd4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800bd7:	0f b6 c9             	movzbl %cl,%ecx
+  800bda:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800be0:	eb a0                	jmp    800b82 <page_vec_call+0xc5>
+  800be2:	89 c2                	mov    %eax,%edx
+  800be4:	c1 ea 04             	shr    $0x4,%edx
+  800be7:	83 e2 0f             	and    $0xf,%edx
+  800bea:	83 fa 02             	cmp    $0x2,%edx
+  800bed:	77 e5                	ja     800bd4 <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800bef:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800bf2:	83 f8 02             	cmp    $0x2,%eax
+  800bf5:	0f 97 c1             	seta   %cl
+  800bf8:	0f b6 c9             	movzbl %cl,%ecx
+  800bfb:	eb d7                	jmp    800bd4 <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800bfd:	b8 10 00 00 00       	mov    $0x10,%eax
+  800c02:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800c08:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800c0e:	89 fb                	mov    %edi,%ebx
+  800c10:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c13:	cd 30                	int    $0x30
+  800c15:	e9 2f ff ff ff       	jmp    800b49 <page_vec_call+0x8c>
+  800c1a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c1f:	0f a2                	cpuid
+		return 0;
+  800c21:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800c26:	f6 c6 08             	test   $0x8,%dh
+  800c29:	74 15                	je     800c40 <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c2b:	89 c2                	mov    %eax,%edx
+  800c2d:	c1 ea 08             	shr    $0x8,%edx
+  800c30:	83 e2 0f             	and    $0xf,%edx
+  800c33:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800c38:	83 fa 06             	cmp    $0x6,%edx
+  800c3b:	74 11                	je     800c4e <page_vec_call+0x191>
+  800c3d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800c40:	0f b6 c9             	movzbl %cl,%ecx
+  800c43:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800c49:	e9 c6 fe ff ff       	jmp    800b14 <page_vec_call+0x57>
+  800c4e:	89 c2                	mov    %eax,%edx
+  800c50:	c1 ea 04             	shr    $0x4,%edx
+  800c53:	83 e2 0f             	and    $0xf,%edx
+  800c56:	83 fa 02             	cmp    $0x2,%edx
+  800c59:	77 e2                	ja     800c3d <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800c5b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c5e:	83 f8 02             	cmp    $0x2,%eax
+  800c61:	0f 97 c1             	seta   %cl
+  800c64:	0f b6 c9             	movzbl %cl,%ecx
+  800c67:	eb d4                	jmp    800c3d <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800c69:	be 00 00 00 00       	mov    $0x0,%esi
+  800c6e:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800c74:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800c7a:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800c80:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c83:	cd 30                	int    $0x30
+  800c85:	e9 bf fe ff ff       	jmp    800b49 <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800c8a:	29 da                	sub    %ebx,%edx
+			vec++;
+  800c8c:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800c8f:	83 e8 01             	sub    $0x1,%eax
+  800c92:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800c97:	85 c0                	test   %eax,%eax
+  800c99:	74 58                	je     800cf3 <page_vec_call+0x236>
+  800c9b:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800c9e:	39 da                	cmp    %ebx,%edx
+  800ca0:	73 e8                	jae    800c8a <page_vec_call+0x1cd>
+  800ca2:	89 75 08             	mov    %esi,0x8(%ebp)
+  800ca5:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800ca8:	84 c9                	test   %cl,%cl
+  800caa:	74 06                	je     800cb2 <page_vec_call+0x1f5>
+  800cac:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800cb2:	83 ec 04             	sub    $0x4,%esp
+  800cb5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cb8:	c1 e0 04             	shl    $0x4,%eax
+  800cbb:	50                   	push   %eax
+  800cbc:	ff 75 08             	push   0x8(%ebp)
+  800cbf:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800cc5:	53                   	push   %ebx
+  800cc6:	e8 34 fc ff ff       	call   8008ff <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800ccb:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800cd1:	89 c2                	mov    %eax,%edx
+  800cd3:	c1 e2 0c             	shl    $0xc,%edx
+  800cd6:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  800cdc:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  800ce2:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  800ce8:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  800ceb:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  800cee:	e9 f2 fd ff ff       	jmp    800ae5 <page_vec_call+0x28>
+			r = 0;
+  800cf3:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  800cf8:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800cfc:	74 0b                	je     800d09 <page_vec_call+0x24c>
+		*done = total;
+  800cfe:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800d01:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  800d07:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  800d09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d0c:	5b                   	pop    %ebx
+  800d0d:	5e                   	pop    %esi
+  800d0e:	5f                   	pop    %edi
+  800d0f:	5d                   	pop    %ebp
+  800d10:	c3                   	ret
+
+00800d11 <sys_cputs>:
+{
+  800d11:	55                   	push   %ebp
+  800d12:	89 e5                	mov    %esp,%ebp
+  800d14:	57                   	push   %edi
+  800d15:	56                   	push   %esi
+  800d16:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800d17:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d1e:	78 2d                	js     800d4d <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800d20:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d27:	74 70                	je     800d99 <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800d29:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d2e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d34:	89 c3                	mov    %eax,%ebx
+  800d36:	89 c7                	mov    %eax,%edi
+  800d38:	89 c6                	mov    %eax,%esi
+  800d3a:	55                   	push   %ebp
+  800d3b:	68 44 0d 80 00       	push   $0x800d44
+  800d40:	89 e5                	mov    %esp,%ebp
+  800d42:	0f 34                	sysenter
+  800d44:	83 c4 04             	add    $0x4,%esp
+  800d47:	5d                   	pop    %ebp
+}
+  800d48:	5b                   	pop    %ebx
+  800d49:	5e                   	pop    %esi
+  800d4a:	5f                   	pop    %edi
+  800d4b:	5d                   	pop    %ebp
+  800d4c:	c3                   	ret
+  800d4d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d52:	0f a2                	cpuid
+		return 0;
+  800d54:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800d59:	f6 c6 08             	test   $0x8,%dh
+  800d5c:	74 15                	je     800d73 <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d5e:	89 c2                	mov    %eax,%edx
+  800d60:	c1 ea 08             	shr    $0x8,%edx
+  800d63:	83 e2 0f             	and    $0xf,%edx
+  800d66:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d6b:	83 fa 06             	cmp    $0x6,%edx
+  800d6e:	74 0e                	je     800d7e <sys_cputs+0x6d>
+  800d70:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800d73:	0f b6 c9             	movzbl %cl,%ecx
+  800d76:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800d7c:	eb a2                	jmp    800d20 <sys_cputs+0xf>
+  800d7e:	89 c2                	mov    %eax,%edx
+  800d80:	c1 ea 04             	shr    $0x4,%edx
+  800d83:	83 e2 0f             	and    $0xf,%edx
+  800d86:	83 fa 02             	cmp    $0x2,%edx
+  800d89:	77 e5                	ja     800d70 <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800d8b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d8e:	83 f8 02             	cmp    $0x2,%eax
+  800d91:	0f 97 c1             	seta   %cl
+  800d94:	0f b6 c9             	movzbl %cl,%ecx
+  800d97:	eb d7                	jmp    800d70 <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800d99:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d9e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da4:	89 c3                	mov    %eax,%ebx
+  800da6:	89 c7                	mov    %eax,%edi
+  800da8:	89 c6                	mov    %eax,%esi
+  800daa:	cd 30                	int    $0x30
+}
+  800dac:	eb 9a                	jmp    800d48 <sys_cputs+0x37>
+
+00800dae <sys_cgetc>:
+{
+  800dae:	55                   	push   %ebp
+  800daf:	89 e5                	mov    %esp,%ebp
+  800db1:	57                   	push   %edi
+  800db2:	56                   	push   %esi
+  800db3:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800db4:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800dbb:	78 2e                	js     800deb <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  800dbd:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800dc4:	74 71                	je     800e37 <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  800dc6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dcb:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dd0:	89 d1                	mov    %edx,%ecx
+  800dd2:	89 d3                	mov    %edx,%ebx
+  800dd4:	89 d7                	mov    %edx,%edi
+  800dd6:	89 d6                	mov    %edx,%esi
+  800dd8:	55                   	push   %ebp
+  800dd9:	68 e2 0d 80 00       	push   $0x800de2
+  800dde:	89 e5                	mov    %esp,%ebp
+  800de0:	0f 34                	sysenter
+  800de2:	83 c4 04             	add    $0x4,%esp
+  800de5:	5d                   	pop    %ebp
+}
+  800de6:	5b                   	pop    %ebx
+  800de7:	5e                   	pop    %esi
+  800de8:	5f                   	pop    %edi
+  800de9:	5d                   	pop    %ebp
+  800dea:	c3                   	ret
+  800deb:	b8 01 00 00 00       	mov    $0x1,%eax
+  800df0:	0f a2                	cpuid
+		return 0;
+  800df2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800df7:	f6 c6 08             	test   $0x8,%dh
+  800dfa:	74 15                	je     800e11 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800dfc:	89 c2                	mov    %eax,%edx
+  800dfe:	c1 ea 08             	shr    $0x8,%edx
+  800e01:	83 e2 0f             	and    $0xf,%edx
+  800e04:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e09:	83 fa 06             	cmp    $0x6,%edx
+  800e0c:	74 0e                	je     800e1c <sys_cgetc+0x6e>
+  800e0e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e11:	0f b6 c9             	movzbl %cl,%ecx
+  800e14:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800e1a:	eb a1                	jmp    800dbd <sys_cgetc+0xf>
+  800e1c:	89 c2                	mov    %eax,%edx
+  800e1e:	c1 ea 04             	shr    $0x4,%edx
+  800e21:	83 e2 0f             	and    $0xf,%edx
+  800e24:	83 fa 02             	cmp    $0x2,%edx
+  800e27:	77 e5                	ja     800e0e <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  800e29:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e2c:	83 f8 02             	cmp    $0x2,%eax
+  800e2f:	0f 97 c1             	seta   %cl
+  800e32:	0f b6 c9             	movzbl %cl,%ecx
+  800e35:	eb d7                	jmp    800e0e <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  800e37:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e3c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e41:	89 d1                	mov    %edx,%ecx
+  800e43:	89 d3                	mov    %edx,%ebx
+  800e45:	89 d7                	mov    %edx,%edi
+  800e47:	89 d6                	mov    %edx,%esi
+  800e49:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800e4b:	eb 99                	jmp    800de6 <sys_cgetc+0x38>
+
+00800e4d <sys_env_destroy>:
+{
+  800e4d:	55                   	push   %ebp
+  800e4e:	89 e5                	mov    %esp,%ebp
+  800e50:	57                   	push   %edi
+  800e51:	56                   	push   %esi
+  800e52:	53                   	push   %ebx
+  800e53:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800e56:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e5d:	78 36                	js     800e95 <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  800e5f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e66:	74 79                	je     800ee1 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  800e68:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e70:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e75:	89 cb                	mov    %ecx,%ebx
+  800e77:	89 cf                	mov    %ecx,%edi
+  800e79:	89 ce                	mov    %ecx,%esi
+  800e7b:	55                   	push   %ebp
+  800e7c:	68 85 0e 80 00       	push   $0x800e85
+  800e81:	89 e5                	mov    %esp,%ebp
+  800e83:	0f 34                	sysenter
+  800e85:	83 c4 04             	add    $0x4,%esp
+  800e88:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e89:	85 c0                	test   %eax,%eax
+  800e8b:	7f 6b                	jg     800ef8 <sys_env_destroy+0xab>
+}
+  800e8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e90:	5b                   	pop    %ebx
+  800e91:	5e                   	pop    %esi
+  800e92:	5f                   	pop    %edi
+  800e93:	5d                   	pop    %ebp
+  800e94:	c3                   	ret
+  800e95:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e9a:	0f a2                	cpuid
+		return 0;
+  800e9c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800ea1:	f6 c6 08             	test   $0x8,%dh
+  800ea4:	74 15                	je     800ebb <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ea6:	89 c2                	mov    %eax,%edx
+  800ea8:	c1 ea 08             	shr    $0x8,%edx
+  800eab:	83 e2 0f             	and    $0xf,%edx
+  800eae:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800eb3:	83 fa 06             	cmp    $0x6,%edx
+  800eb6:	74 0e                	je     800ec6 <sys_env_destroy+0x79>
+  800eb8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800ebb:	0f b6 c9             	movzbl %cl,%ecx
+  800ebe:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800ec4:	eb 99                	jmp    800e5f <sys_env_destroy+0x12>
+  800ec6:	89 c2                	mov    %eax,%edx
+  800ec8:	c1 ea 04             	shr    $0x4,%edx
+  800ecb:	83 e2 0f             	and    $0xf,%edx
+  800ece:	83 fa 02             	cmp    $0x2,%edx
+  800ed1:	77 e5                	ja     800eb8 <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  800ed3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ed6:	83 f8 02             	cmp    $0x2,%eax
+  800ed9:	0f 97 c1             	seta   %cl
+  800edc:	0f b6 c9             	movzbl %cl,%ecx
+  800edf:	eb d7                	jmp    800eb8 <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  800ee1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ee6:	b8 03 00 00 00       	mov    $0x3,%eax
+  800eeb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eee:	89 cb                	mov    %ecx,%ebx
+  800ef0:	89 cf                	mov    %ecx,%edi
+  800ef2:	89 ce                	mov    %ecx,%esi
+  800ef4:	cd 30                	int    $0x30
+  800ef6:	eb 91                	jmp    800e89 <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef8:	83 ec 0c             	sub    $0xc,%esp
+  800efb:	50                   	push   %eax
+  800efc:	6a 03                	push   $0x3
+  800efe:	68 19 2f 80 00       	push   $0x802f19
+  800f03:	6a 4a                	push   $0x4a
+  800f05:	68 36 2f 80 00       	push   $0x802f36
+  800f0a:	e8 a3 1a 00 00       	call   8029b2 <_panic>
+
+00800f0f <sys_getenvid>:
+{
+  800f0f:	55                   	push   %ebp
+  800f10:	89 e5                	mov    %esp,%ebp
+  800f12:	57                   	push   %edi
+  800f13:	56                   	push   %esi
+  800f14:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800f15:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f1c:	78 2e                	js     800f4c <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  800f1e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f25:	74 71                	je     800f98 <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  800f27:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f2c:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f31:	89 d1                	mov    %edx,%ecx
+  800f33:	89 d3                	mov    %edx,%ebx
+  800f35:	89 d7                	mov    %edx,%edi
+  800f37:	89 d6                	mov    %edx,%esi
+  800f39:	55                   	push   %ebp
+  800f3a:	68 43 0f 80 00       	push   $0x800f43
+  800f3f:	89 e5                	mov    %esp,%ebp
+  800f41:	0f 34                	sysenter
+  800f43:	83 c4 04             	add    $0x4,%esp
+  800f46:	5d                   	pop    %ebp
+}
+  800f47:	5b                   	pop    %ebx
+  800f48:	5e                   	pop    %esi
+  800f49:	5f                   	pop    %edi
+  800f4a:	5d                   	pop    %ebp
+  800f4b:	c3                   	ret
+  800f4c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f51:	0f a2                	cpuid
+		return 0;
+  800f53:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f58:	f6 c6 08             	test   $0x8,%dh
+  800f5b:	74 15                	je     800f72 <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f5d:	89 c2                	mov    %eax,%edx
+  800f5f:	c1 ea 08             	shr    $0x8,%edx
+  800f62:	83 e2 0f             	and    $0xf,%edx
+  800f65:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f6a:	83 fa 06             	cmp    $0x6,%edx
+  800f6d:	74 0e                	je     800f7d <sys_getenvid+0x6e>
+  800f6f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f72:	0f b6 c9             	movzbl %cl,%ecx
+  800f75:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800f7b:	eb a1                	jmp    800f1e <sys_getenvid+0xf>
+  800f7d:	89 c2                	mov    %eax,%edx
+  800f7f:	c1 ea 04             	shr    $0x4,%edx
+  800f82:	83 e2 0f             	and    $0xf,%edx
+  800f85:	83 fa 02             	cmp    $0x2,%edx
+  800f88:	77 e5                	ja     800f6f <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  800f8a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f8d:	83 f8 02             	cmp    $0x2,%eax
+  800f90:	0f 97 c1             	seta   %cl
+  800f93:	0f b6 c9             	movzbl %cl,%ecx
+  800f96:	eb d7                	jmp    800f6f <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  800f98:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f9d:	b8 02 00 00 00       	mov    $0x2,%eax
+  800fa2:	89 d1                	mov    %edx,%ecx
+  800fa4:	89 d3                	mov    %edx,%ebx
+  800fa6:	89 d7                	mov    %edx,%edi
+  800fa8:	89 d6                	mov    %edx,%esi
+  800faa:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  800fac:	eb 99                	jmp    800f47 <sys_getenvid+0x38>
+
+00800fae <sys_page_alloc>:
+{
+  800fae:	55                   	push   %ebp
+  800faf:	89 e5                	mov    %esp,%ebp
+  800fb1:	57                   	push   %edi
+  800fb2:	56                   	push   %esi
+  800fb3:	53                   	push   %ebx
+  800fb4:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800fb7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fbe:	78 38                	js     800ff8 <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  800fc0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fc7:	74 7b                	je     801044 <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  800fc9:	be 00 00 00 00       	mov    $0x0,%esi
+  800fce:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd4:	b8 04 00 00 00       	mov    $0x4,%eax
+  800fd9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fdc:	89 f7                	mov    %esi,%edi
+  800fde:	55                   	push   %ebp
+  800fdf:	68 e8 0f 80 00       	push   $0x800fe8
+  800fe4:	89 e5                	mov    %esp,%ebp
+  800fe6:	0f 34                	sysenter
+  800fe8:	83 c4 04             	add    $0x4,%esp
+  800feb:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800fec:	85 c0                	test   %eax,%eax
+  800fee:	7f 6d                	jg     80105d <sys_page_alloc+0xaf>
+}
+  800ff0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff3:	5b                   	pop    %ebx
+  800ff4:	5e                   	pop    %esi
+  800ff5:	5f                   	pop    %edi
+  800ff6:	5d                   	pop    %ebp
+  800ff7:	c3                   	ret
+  800ff8:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ffd:	0f a2                	cpuid
+		return 0;
+  800fff:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801004:	f6 c6 08             	test   $0x8,%dh
+  801007:	74 15                	je     80101e <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801009:	89 c2                	mov    %eax,%edx
+  80100b:	c1 ea 08             	shr    $0x8,%edx
+  80100e:	83 e2 0f             	and    $0xf,%edx
+  801011:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801016:	83 fa 06             	cmp    $0x6,%edx
+  801019:	74 0e                	je     801029 <sys_page_alloc+0x7b>
+  80101b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80101e:	0f b6 c9             	movzbl %cl,%ecx
+  801021:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801027:	eb 97                	jmp    800fc0 <sys_page_alloc+0x12>
+  801029:	89 c2                	mov    %eax,%edx
+  80102b:	c1 ea 04             	shr    $0x4,%edx
+  80102e:	83 e2 0f             	and    $0xf,%edx
+  801031:	83 fa 02             	cmp    $0x2,%edx
+  801034:	77 e5                	ja     80101b <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  801036:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801039:	83 f8 02             	cmp    $0x2,%eax
+  80103c:	0f 97 c1             	seta   %cl
+  80103f:	0f b6 c9             	movzbl %cl,%ecx
+  801042:	eb d7                	jmp    80101b <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  801044:	be 00 00 00 00       	mov    $0x0,%esi
+  801049:	b8 04 00 00 00       	mov    $0x4,%eax
+  80104e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801051:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801054:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801057:	89 f7                	mov    %esi,%edi
+  801059:	cd 30                	int    $0x30
+  80105b:	eb 8f                	jmp    800fec <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80105d:	83 ec 0c             	sub    $0xc,%esp
+  801060:	50                   	push   %eax
+  801061:	6a 04                	push   $0x4
+  801063:	68 19 2f 80 00       	push   $0x802f19
+  801068:	6a 4a                	push   $0x4a
+  80106a:	68 36 2f 80 00       	push   $0x802f36
+  80106f:	e8 3e 19 00 00       	call   8029b2 <_panic>
+
+00801074 <sys_page_map>:
+{
+  801074:	55                   	push   %ebp
+  801075:	89 e5                	mov    %esp,%ebp
+  801077:	57                   	push   %edi
+  801078:	56                   	push   %esi
+  801079:	53                   	push   %ebx
+  80107a:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80107d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801084:	78 37                	js     8010bd <sys_page_map+0x49>
+	if (syscall_sysenter)
+  801086:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80108d:	74 7a                	je     801109 <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  80108f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801092:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801095:	b8 05 00 00 00       	mov    $0x5,%eax
+  80109a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80109d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010a0:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010a3:	55                   	push   %ebp
+  8010a4:	68 ad 10 80 00       	push   $0x8010ad
+  8010a9:	89 e5                	mov    %esp,%ebp
+  8010ab:	0f 34                	sysenter
+  8010ad:	83 c4 04             	add    $0x4,%esp
+  8010b0:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8010b1:	85 c0                	test   %eax,%eax
+  8010b3:	7f 6c                	jg     801121 <sys_page_map+0xad>
+}
+  8010b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010b8:	5b                   	pop    %ebx
+  8010b9:	5e                   	pop    %esi
+  8010ba:	5f                   	pop    %edi
+  8010bb:	5d                   	pop    %ebp
+  8010bc:	c3                   	ret
+  8010bd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010c2:	0f a2                	cpuid
+		return 0;
+  8010c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8010c9:	f6 c6 08             	test   $0x8,%dh
+  8010cc:	74 15                	je     8010e3 <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010ce:	89 c2                	mov    %eax,%edx
+  8010d0:	c1 ea 08             	shr    $0x8,%edx
+  8010d3:	83 e2 0f             	and    $0xf,%edx
+  8010d6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8010db:	83 fa 06             	cmp    $0x6,%edx
+  8010de:	74 0e                	je     8010ee <sys_page_map+0x7a>
+  8010e0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8010e3:	0f b6 c9             	movzbl %cl,%ecx
+  8010e6:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8010ec:	eb 98                	jmp    801086 <sys_page_map+0x12>
+  8010ee:	89 c2                	mov    %eax,%edx
+  8010f0:	c1 ea 04             	shr    $0x4,%edx
+  8010f3:	83 e2 0f             	and    $0xf,%edx
+  8010f6:	83 fa 02             	cmp    $0x2,%edx
+  8010f9:	77 e5                	ja     8010e0 <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  8010fb:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010fe:	83 f8 02             	cmp    $0x2,%eax
+  801101:	0f 97 c1             	seta   %cl
+  801104:	0f b6 c9             	movzbl %cl,%ecx
+  801107:	eb d7                	jmp    8010e0 <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  801109:	b8 05 00 00 00       	mov    $0x5,%eax
+  80110e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801111:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801114:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801117:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80111a:	8b 75 18             	mov    0x18(%ebp),%esi
+  80111d:	cd 30                	int    $0x30
+  80111f:	eb 90                	jmp    8010b1 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801121:	83 ec 0c             	sub    $0xc,%esp
+  801124:	50                   	push   %eax
+  801125:	6a 05                	push   $0x5
+  801127:	68 19 2f 80 00       	push   $0x802f19
+  80112c:	6a 4a                	push   $0x4a
+  80112e:	68 36 2f 80 00       	push   $0x802f36
+  801133:	e8 7a 18 00 00       	call   8029b2 <_panic>
+
+00801138 <sys_page_unmap>:
+{
+  801138:	55                   	push   %ebp
+  801139:	89 e5                	mov    %esp,%ebp
+  80113b:	57                   	push   %edi
+  80113c:	56                   	push   %esi
+  80113d:	53                   	push   %ebx
+  80113e:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801141:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801148:	78 37                	js     801181 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  80114a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801151:	74 7a                	je     8011cd <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  801153:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801158:	8b 55 08             	mov    0x8(%ebp),%edx
+  80115b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115e:	b8 06 00 00 00       	mov    $0x6,%eax
+  801163:	89 df                	mov    %ebx,%edi
+  801165:	89 de                	mov    %ebx,%esi
+  801167:	55                   	push   %ebp
+  801168:	68 71 11 80 00       	push   $0x801171
+  80116d:	89 e5                	mov    %esp,%ebp
+  80116f:	0f 34                	sysenter
+  801171:	83 c4 04             	add    $0x4,%esp
+  801174:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801175:	85 c0                	test   %eax,%eax
+  801177:	7f 6c                	jg     8011e5 <sys_page_unmap+0xad>
+}
+  801179:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80117c:	5b                   	pop    %ebx
+  80117d:	5e                   	pop    %esi
+  80117e:	5f                   	pop    %edi
+  80117f:	5d                   	pop    %ebp
+  801180:	c3                   	ret
+  801181:	b8 01 00 00 00       	mov    $0x1,%eax
+  801186:	0f a2                	cpuid
+		return 0;
+  801188:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80118d:	f6 c6 08             	test   $0x8,%dh
+  801190:	74 15                	je     8011a7 <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801192:	89 c2                	mov    %eax,%edx
+  801194:	c1 ea 08             	shr    $0x8,%edx
+  801197:	83 e2 0f             	and    $0xf,%edx
+  80119a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80119f:	83 fa 06             	cmp    $0x6,%edx
+  8011a2:	74 0e                	je     8011b2 <sys_page_unmap+0x7a>
+  8011a4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8011a7:	0f b6 c9             	movzbl %cl,%ecx
+  8011aa:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8011b0:	eb 98                	jmp    80114a <sys_page_unmap+0x12>
+  8011b2:	89 c2                	mov    %eax,%edx
+  8011b4:	c1 ea 04             	shr    $0x4,%edx
+  8011b7:	83 e2 0f             	and    $0xf,%edx
+  8011ba:	83 fa 02             	cmp    $0x2,%edx
+  8011bd:	77 e5                	ja     8011a4 <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  8011bf:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011c2:	83 f8 02             	cmp    $0x2,%eax
+  8011c5:	0f 97 c1             	seta   %cl
+  8011c8:	0f b6 c9             	movzbl %cl,%ecx
+  8011cb:	eb d7                	jmp    8011a4 <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  8011cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d2:	b8 06 00 00 00       	mov    $0x6,%eax
+  8011d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011dd:	89 df                	mov    %ebx,%edi
+  8011df:	89 de                	mov    %ebx,%esi
+  8011e1:	cd 30                	int    $0x30
+  8011e3:	eb 90                	jmp    801175 <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011e5:	83 ec 0c             	sub    $0xc,%esp
+  8011e8:	50                   	push   %eax
+  8011e9:	6a 06                	push   $0x6
+  8011eb:	68 19 2f 80 00       	push   $0x802f19
+  8011f0:	6a 4a                	push   $0x4a
+  8011f2:	68 36 2f 80 00       	push   $0x802f36
+  8011f7:	e8 b6 17 00 00       	call   8029b2 <_panic>
+
+008011fc <sys_page_copy>:
+{
+  8011fc:	55                   	push   %ebp
+  8011fd:	89 e5                	mov    %esp,%ebp
+  8011ff:	57                   	push   %edi
+  801200:	56                   	push   %esi
+  801201:	53                   	push   %ebx
+  801202:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801205:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80120c:	78 37                	js     801245 <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  80120e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801215:	74 7a                	je     801291 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  801217:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80121d:	b8 29 00 00 00       	mov    $0x29,%eax
+  801222:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801225:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801228:	8b 75 18             	mov    0x18(%ebp),%esi
+  80122b:	55                   	push   %ebp
+  80122c:	68 35 12 80 00       	push   $0x801235
+  801231:	89 e5                	mov    %esp,%ebp
+  801233:	0f 34                	sysenter
+  801235:	83 c4 04             	add    $0x4,%esp
+  801238:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801239:	85 c0                	test   %eax,%eax
+  80123b:	7f 6c                	jg     8012a9 <sys_page_copy+0xad>
+}
+  80123d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801240:	5b                   	pop    %ebx
+  801241:	5e                   	pop    %esi
+  801242:	5f                   	pop    %edi
+  801243:	5d                   	pop    %ebp
+  801244:	c3                   	ret
+  801245:	b8 01 00 00 00       	mov    $0x1,%eax
+  80124a:	0f a2                	cpuid
+		return 0;
+  80124c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801251:	f6 c6 08             	test   $0x8,%dh
+  801254:	74 15                	je     80126b <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801256:	89 c2                	mov    %eax,%edx
+  801258:	c1 ea 08             	shr    $0x8,%edx
+  80125b:	83 e2 0f             	and    $0xf,%edx
+  80125e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801263:	83 fa 06             	cmp    $0x6,%edx
+  801266:	74 0e                	je     801276 <sys_page_copy+0x7a>
+  801268:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80126b:	0f b6 c9             	movzbl %cl,%ecx
+  80126e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801274:	eb 98                	jmp    80120e <sys_page_copy+0x12>
+  801276:	89 c2                	mov    %eax,%edx
+  801278:	c1 ea 04             	shr    $0x4,%edx
+  80127b:	83 e2 0f             	and    $0xf,%edx
+  80127e:	83 fa 02             	cmp    $0x2,%edx
+  801281:	77 e5                	ja     801268 <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  801283:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801286:	83 f8 02             	cmp    $0x2,%eax
+  801289:	0f 97 c1             	seta   %cl
+  80128c:	0f b6 c9             	movzbl %cl,%ecx
+  80128f:	eb d7                	jmp    801268 <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  801291:	b8 29 00 00 00       	mov    $0x29,%eax
+  801296:	8b 55 08             	mov    0x8(%ebp),%edx
+  801299:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80129c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80129f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012a2:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012a5:	cd 30                	int    $0x30
+  8012a7:	eb 90                	jmp    801239 <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012a9:	83 ec 0c             	sub    $0xc,%esp
+  8012ac:	50                   	push   %eax
+  8012ad:	6a 29                	push   $0x29
+  8012af:	68 19 2f 80 00       	push   $0x802f19
+  8012b4:	6a 4a                	push   $0x4a
+  8012b6:	68 36 2f 80 00       	push   $0x802f36
+  8012bb:	e8 f2 16 00 00       	call   8029b2 <_panic>
+
+008012c0 <sys_yield>:
+{
+  8012c0:	55                   	push   %ebp
+  8012c1:	89 e5                	mov    %esp,%ebp
+  8012c3:	57                   	push   %edi
+  8012c4:	56                   	push   %esi
+  8012c5:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8012c6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8012cd:	78 2e                	js     8012fd <sys_yield+0x3d>
+	if (syscall_sysenter)
+  8012cf:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8012d6:	74 71                	je     801349 <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  8012d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012dd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8012e2:	89 d1                	mov    %edx,%ecx
+  8012e4:	89 d3                	mov    %edx,%ebx
+  8012e6:	89 d7                	mov    %edx,%edi
+  8012e8:	89 d6                	mov    %edx,%esi
+  8012ea:	55                   	push   %ebp
+  8012eb:	68 f4 12 80 00       	push   $0x8012f4
+  8012f0:	89 e5                	mov    %esp,%ebp
+  8012f2:	0f 34                	sysenter
+  8012f4:	83 c4 04             	add    $0x4,%esp
+  8012f7:	5d                   	pop    %ebp
+}
+  8012f8:	5b                   	pop    %ebx
+  8012f9:	5e                   	pop    %esi
+  8012fa:	5f                   	pop    %edi
+  8012fb:	5d                   	pop    %ebp
+  8012fc:	c3                   	ret
+  8012fd:	b8 01 00 00 00       	mov    $0x1,%eax
+  801302:	0f a2                	cpuid
+		return 0;
+  801304:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801309:	f6 c6 08             	test   $0x8,%dh
+  80130c:	74 15                	je     801323 <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80130e:	89 c2                	mov    %eax,%edx
+  801310:	c1 ea 08             	shr    $0x8,%edx
+  801313:	83 e2 0f             	and    $0xf,%edx
+  801316:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80131b:	83 fa 06             	cmp    $0x6,%edx
+  80131e:	74 0e                	je     80132e <sys_yield+0x6e>
+  801320:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801323:	0f b6 c9             	movzbl %cl,%ecx
+  801326:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80132c:	eb a1                	jmp    8012cf <sys_yield+0xf>
+  80132e:	89 c2                	mov    %eax,%edx
+  801330:	c1 ea 04             	shr    $0x4,%edx
+  801333:	83 e2 0f             	and    $0xf,%edx
+  801336:	83 fa 02             	cmp    $0x2,%edx
+  801339:	77 e5                	ja     801320 <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  80133b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80133e:	83 f8 02             	cmp    $0x2,%eax
+  801341:	0f 97 c1             	seta   %cl
+  801344:	0f b6 c9             	movzbl %cl,%ecx
+  801347:	eb d7                	jmp    801320 <sys_yield+0x60>
+		asm volatile("int %1\n"
+  801349:	ba 00 00 00 00       	mov    $0x0,%edx
+  80134e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801353:	89 d1                	mov    %edx,%ecx
+  801355:	89 d3                	mov    %edx,%ebx
+  801357:	89 d7                	mov    %edx,%edi
+  801359:	89 d6                	mov    %edx,%esi
+  80135b:	cd 30                	int    $0x30
+}
+  80135d:	eb 99                	jmp    8012f8 <sys_yield+0x38>
+
+0080135f <sys_env_set_status>:
+{
+  80135f:	55                   	push   %ebp
+  801360:	89 e5                	mov    %esp,%ebp
+  801362:	57                   	push   %edi
+  801363:	56                   	push   %esi
+  801364:	53                   	push   %ebx
+  801365:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801368:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80136f:	78 37                	js     8013a8 <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  801371:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801378:	74 7a                	je     8013f4 <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  80137a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80137f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801382:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801385:	b8 08 00 00 00       	mov    $0x8,%eax
+  80138a:	89 df                	mov    %ebx,%edi
+  80138c:	89 de                	mov    %ebx,%esi
+  80138e:	55                   	push   %ebp
+  80138f:	68 98 13 80 00       	push   $0x801398
+  801394:	89 e5                	mov    %esp,%ebp
+  801396:	0f 34                	sysenter
+  801398:	83 c4 04             	add    $0x4,%esp
+  80139b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80139c:	85 c0                	test   %eax,%eax
+  80139e:	7f 6c                	jg     80140c <sys_env_set_status+0xad>
+}
+  8013a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013a3:	5b                   	pop    %ebx
+  8013a4:	5e                   	pop    %esi
+  8013a5:	5f                   	pop    %edi
+  8013a6:	5d                   	pop    %ebp
+  8013a7:	c3                   	ret
+  8013a8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013ad:	0f a2                	cpuid
+		return 0;
+  8013af:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8013b4:	f6 c6 08             	test   $0x8,%dh
+  8013b7:	74 15                	je     8013ce <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013b9:	89 c2                	mov    %eax,%edx
+  8013bb:	c1 ea 08             	shr    $0x8,%edx
+  8013be:	83 e2 0f             	and    $0xf,%edx
+  8013c1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8013c6:	83 fa 06             	cmp    $0x6,%edx
+  8013c9:	74 0e                	je     8013d9 <sys_env_set_status+0x7a>
+  8013cb:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8013ce:	0f b6 c9             	movzbl %cl,%ecx
+  8013d1:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8013d7:	eb 98                	jmp    801371 <sys_env_set_status+0x12>
+  8013d9:	89 c2                	mov    %eax,%edx
+  8013db:	c1 ea 04             	shr    $0x4,%edx
+  8013de:	83 e2 0f             	and    $0xf,%edx
+  8013e1:	83 fa 02             	cmp    $0x2,%edx
+  8013e4:	77 e5                	ja     8013cb <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  8013e6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013e9:	83 f8 02             	cmp    $0x2,%eax
+  8013ec:	0f 97 c1             	seta   %cl
+  8013ef:	0f b6 c9             	movzbl %cl,%ecx
+  8013f2:	eb d7                	jmp    8013cb <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  8013f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013f9:	b8 08 00 00 00       	mov    $0x8,%eax
+  8013fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801401:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801404:	89 df                	mov    %ebx,%edi
+  801406:	89 de                	mov    %ebx,%esi
+  801408:	cd 30                	int    $0x30
+  80140a:	eb 90                	jmp    80139c <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80140c:	83 ec 0c             	sub    $0xc,%esp
+  80140f:	50                   	push   %eax
+  801410:	6a 08                	push   $0x8
+  801412:	68 19 2f 80 00       	push   $0x802f19
+  801417:	6a 4a                	push   $0x4a
+  801419:	68 36 2f 80 00       	push   $0x802f36
+  80141e:	e8 8f 15 00 00       	call   8029b2 <_panic>
+
+00801423 <sys_sysinfo>:
+{
+  801423:	55                   	push   %ebp
+  801424:	89 e5                	mov    %esp,%ebp
+  801426:	57                   	push   %edi
+  801427:	56                   	push   %esi
+  801428:	53                   	push   %ebx
+  801429:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80142c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801433:	78 36                	js     80146b <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  801435:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80143c:	74 79                	je     8014b7 <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  80143e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801441:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801446:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80144b:	89 cb                	mov    %ecx,%ebx
+  80144d:	89 cf                	mov    %ecx,%edi
+  80144f:	89 ce                	mov    %ecx,%esi
+  801451:	55                   	push   %ebp
+  801452:	68 5b 14 80 00       	push   $0x80145b
+  801457:	89 e5                	mov    %esp,%ebp
+  801459:	0f 34                	sysenter
+  80145b:	83 c4 04             	add    $0x4,%esp
+  80145e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80145f:	85 c0                	test   %eax,%eax
+  801461:	7f 6b                	jg     8014ce <sys_sysinfo+0xab>
+}
+  801463:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801466:	5b                   	pop    %ebx
+  801467:	5e                   	pop    %esi
+  801468:	5f                   	pop    %edi
+  801469:	5d                   	pop    %ebp
+  80146a:	c3                   	ret
+  80146b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801470:	0f a2                	cpuid
+		return 0;
+  801472:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801477:	f6 c6 08             	test   $0x8,%dh
+  80147a:	74 15                	je     801491 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80147c:	89 c2                	mov    %eax,%edx
+  80147e:	c1 ea 08             	shr    $0x8,%edx
+  801481:	83 e2 0f             	and    $0xf,%edx
+  801484:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801489:	83 fa 06             	cmp    $0x6,%edx
+  80148c:	74 0e                	je     80149c <sys_sysinfo+0x79>
+  80148e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801491:	0f b6 c9             	movzbl %cl,%ecx
+  801494:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80149a:	eb 99                	jmp    801435 <sys_sysinfo+0x12>
+  80149c:	89 c2                	mov    %eax,%edx
+  80149e:	c1 ea 04             	shr    $0x4,%edx
+  8014a1:	83 e2 0f             	and    $0xf,%edx
+  8014a4:	83 fa 02             	cmp    $0x2,%edx
+  8014a7:	77 e5                	ja     80148e <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  8014a9:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014ac:	83 f8 02             	cmp    $0x2,%eax
+  8014af:	0f 97 c1             	seta   %cl
+  8014b2:	0f b6 c9             	movzbl %cl,%ecx
+  8014b5:	eb d7                	jmp    80148e <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  8014b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014bc:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8014c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c4:	89 cb                	mov    %ecx,%ebx
+  8014c6:	89 cf                	mov    %ecx,%edi
+  8014c8:	89 ce                	mov    %ecx,%esi
+  8014ca:	cd 30                	int    $0x30
+  8014cc:	eb 91                	jmp    80145f <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014ce:	83 ec 0c             	sub    $0xc,%esp
+  8014d1:	50                   	push   %eax
+  8014d2:	6a 0b                	push   $0xb
+  8014d4:	68 19 2f 80 00       	push   $0x802f19
+  8014d9:	6a 4a                	push   $0x4a
+  8014db:	68 36 2f 80 00       	push   $0x802f36
+  8014e0:	e8 cd 14 00 00       	call   8029b2 <_panic>
+
+008014e5 <sys_env_set_trapframe>:
+{
+  8014e5:	55                   	push   %ebp
+  8014e6:	89 e5                	mov    %esp,%ebp
+  8014e8:	57                   	push   %edi
+  8014e9:	56                   	push   %esi
+  8014ea:	53                   	push   %ebx
+  8014eb:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8014ee:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8014f5:	78 37                	js     80152e <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  8014f7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8014fe:	74 7a                	je     80157a <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  801500:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801505:	8b 55 08             	mov    0x8(%ebp),%edx
+  801508:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80150b:	b8 13 00 00 00       	mov    $0x13,%eax
+  801510:	89 df                	mov    %ebx,%edi
+  801512:	89 de                	mov    %ebx,%esi
+  801514:	55                   	push   %ebp
+  801515:	68 1e 15 80 00       	push   $0x80151e
+  80151a:	89 e5                	mov    %esp,%ebp
+  80151c:	0f 34                	sysenter
+  80151e:	83 c4 04             	add    $0x4,%esp
+  801521:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801522:	85 c0                	test   %eax,%eax
+  801524:	7f 6c                	jg     801592 <sys_env_set_trapframe+0xad>
+}
+  801526:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801529:	5b                   	pop    %ebx
+  80152a:	5e                   	pop    %esi
+  80152b:	5f                   	pop    %edi
+  80152c:	5d                   	pop    %ebp
+  80152d:	c3                   	ret
+  80152e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801533:	0f a2                	cpuid
+		return 0;
+  801535:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80153a:	f6 c6 08             	test   $0x8,%dh
+  80153d:	74 15                	je     801554 <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80153f:	89 c2                	mov    %eax,%edx
+  801541:	c1 ea 08             	shr    $0x8,%edx
+  801544:	83 e2 0f             	and    $0xf,%edx
+  801547:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80154c:	83 fa 06             	cmp    $0x6,%edx
+  80154f:	74 0e                	je     80155f <sys_env_set_trapframe+0x7a>
+  801551:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801554:	0f b6 c9             	movzbl %cl,%ecx
+  801557:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80155d:	eb 98                	jmp    8014f7 <sys_env_set_trapframe+0x12>
+  80155f:	89 c2                	mov    %eax,%edx
+  801561:	c1 ea 04             	shr    $0x4,%edx
+  801564:	83 e2 0f             	and    $0xf,%edx
+  801567:	83 fa 02             	cmp    $0x2,%edx
+  80156a:	77 e5                	ja     801551 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  80156c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80156f:	83 f8 02             	cmp    $0x2,%eax
+  801572:	0f 97 c1             	seta   %cl
+  801575:	0f b6 c9             	movzbl %cl,%ecx
+  801578:	eb d7                	jmp    801551 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  80157a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80157f:	b8 13 00 00 00       	mov    $0x13,%eax
+  801584:	8b 55 08             	mov    0x8(%ebp),%edx
+  801587:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80158a:	89 df                	mov    %ebx,%edi
+  80158c:	89 de                	mov    %ebx,%esi
+  80158e:	cd 30                	int    $0x30
+  801590:	eb 90                	jmp    801522 <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801592:	83 ec 0c             	sub    $0xc,%esp
+  801595:	50                   	push   %eax
+  801596:	6a 13                	push   $0x13
+  801598:	68 19 2f 80 00       	push   $0x802f19
+  80159d:	6a 4a                	push   $0x4a
+  80159f:	68 36 2f 80 00       	push   $0x802f36
+  8015a4:	e8 09 14 00 00       	call   8029b2 <_panic>
+
+008015a9 <sys_env_set_stack_limit>:
+{
+  8015a9:	55                   	push   %ebp
+  8015aa:	89 e5                	mov    %esp,%ebp
+  8015ac:	57                   	push   %edi
+  8015ad:	56                   	push   %esi
+  8015ae:	53                   	push   %ebx
+  8015af:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8015b2:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8015b9:	78 37                	js     8015f2 <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  8015bb:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8015c2:	74 7a                	je     80163e <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  8015c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015cf:	b8 19 00 00 00       	mov    $0x19,%eax
+  8015d4:	89 df                	mov    %ebx,%edi
+  8015d6:	89 de                	mov    %ebx,%esi
+  8015d8:	55                   	push   %ebp
+  8015d9:	68 e2 15 80 00       	push   $0x8015e2
+  8015de:	89 e5                	mov    %esp,%ebp
+  8015e0:	0f 34                	sysenter
+  8015e2:	83 c4 04             	add    $0x4,%esp
+  8015e5:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8015e6:	85 c0                	test   %eax,%eax
+  8015e8:	7f 6c                	jg     801656 <sys_env_set_stack_limit+0xad>
+}
+  8015ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015ed:	5b                   	pop    %ebx
+  8015ee:	5e                   	pop    %esi
+  8015ef:	5f                   	pop    %edi
+  8015f0:	5d                   	pop    %ebp
+  8015f1:	c3                   	ret
+  8015f2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015f7:	0f a2                	cpuid
+		return 0;
+  8015f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8015fe:	f6 c6 08             	test   $0x8,%dh
+  801601:	74 15                	je     801618 <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801603:	89 c2                	mov    %eax,%edx
+  801605:	c1 ea 08             	shr    $0x8,%edx
+  801608:	83 e2 0f             	and    $0xf,%edx
+  80160b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801610:	83 fa 06             	cmp    $0x6,%edx
+  801613:	74 0e                	je     801623 <sys_env_set_stack_limit+0x7a>
+  801615:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801618:	0f b6 c9             	movzbl %cl,%ecx
+  80161b:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801621:	eb 98                	jmp    8015bb <sys_env_set_stack_limit+0x12>
+  801623:	89 c2                	mov    %eax,%edx
+  801625:	c1 ea 04             	shr    $0x4,%edx
+  801628:	83 e2 0f             	and    $0xf,%edx
+  80162b:	83 fa 02             	cmp    $0x2,%edx
+  80162e:	77 e5                	ja     801615 <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  801630:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801633:	83 f8 02             	cmp    $0x2,%eax
+  801636:	0f 97 c1             	seta   %cl
+  801639:	0f b6 c9             	movzbl %cl,%ecx
+  80163c:	eb d7                	jmp    801615 <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  80163e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801643:	b8 19 00 00 00       	mov    $0x19,%eax
+  801648:	8b 55 08             	mov    0x8(%ebp),%edx
+  80164b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80164e:	89 df                	mov    %ebx,%edi
+  801650:	89 de                	mov    %ebx,%esi
+  801652:	cd 30                	int    $0x30
+  801654:	eb 90                	jmp    8015e6 <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801656:	83 ec 0c             	sub    $0xc,%esp
+  801659:	50                   	push   %eax
+  80165a:	6a 19                	push   $0x19
+  80165c:	68 19 2f 80 00       	push   $0x802f19
+  801661:	6a 4a                	push   $0x4a
+  801663:	68 36 2f 80 00       	push   $0x802f36
+  801668:	e8 45 13 00 00       	call   8029b2 <_panic>
+
+0080166d <sys_env_set_pgfault_upcall>:
+{
+  80166d:	55                   	push   %ebp
+  80166e:	89 e5                	mov    %esp,%ebp
+  801670:	57                   	push   %edi
+  801671:	56                   	push   %esi
+  801672:	53                   	push   %ebx
+  801673:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801676:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80167d:	78 37                	js     8016b6 <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  80167f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801686:	74 7a                	je     801702 <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  801688:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80168d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801690:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801693:	b8 09 00 00 00       	mov    $0x9,%eax
+  801698:	89 df                	mov    %ebx,%edi
+  80169a:	89 de                	mov    %ebx,%esi
+  80169c:	55                   	push   %ebp
+  80169d:	68 a6 16 80 00       	push   $0x8016a6
+  8016a2:	89 e5                	mov    %esp,%ebp
+  8016a4:	0f 34                	sysenter
+  8016a6:	83 c4 04             	add    $0x4,%esp
+  8016a9:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8016aa:	85 c0                	test   %eax,%eax
+  8016ac:	7f 6c                	jg     80171a <sys_env_set_pgfault_upcall+0xad>
+}
+  8016ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016b1:	5b                   	pop    %ebx
+  8016b2:	5e                   	pop    %esi
+  8016b3:	5f                   	pop    %edi
+  8016b4:	5d                   	pop    %ebp
+  8016b5:	c3                   	ret
+  8016b6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016bb:	0f a2                	cpuid
+		return 0;
+  8016bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8016c2:	f6 c6 08             	test   $0x8,%dh
+  8016c5:	74 15                	je     8016dc <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016c7:	89 c2                	mov    %eax,%edx
+  8016c9:	c1 ea 08             	shr    $0x8,%edx
+  8016cc:	83 e2 0f             	and    $0xf,%edx
+  8016cf:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8016d4:	83 fa 06             	cmp    $0x6,%edx
+  8016d7:	74 0e                	je     8016e7 <sys_env_set_pgfault_upcall+0x7a>
+  8016d9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8016dc:	0f b6 c9             	movzbl %cl,%ecx
+  8016df:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8016e5:	eb 98                	jmp    80167f <sys_env_set_pgfault_upcall+0x12>
+  8016e7:	89 c2                	mov    %eax,%edx
+  8016e9:	c1 ea 04             	shr    $0x4,%edx
+  8016ec:	83 e2 0f             	and    $0xf,%edx
+  8016ef:	83 fa 02             	cmp    $0x2,%edx
+  8016f2:	77 e5                	ja     8016d9 <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  8016f4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016f7:	83 f8 02             	cmp    $0x2,%eax
+  8016fa:	0f 97 c1             	seta   %cl
+  8016fd:	0f b6 c9             	movzbl %cl,%ecx
+  801700:	eb d7                	jmp    8016d9 <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  801702:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801707:	b8 09 00 00 00       	mov    $0x9,%eax
+  80170c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80170f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801712:	89 df                	mov    %ebx,%edi
+  801714:	89 de                	mov    %ebx,%esi
+  801716:	cd 30                	int    $0x30
+  801718:	eb 90                	jmp    8016aa <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80171a:	83 ec 0c             	sub    $0xc,%esp
+  80171d:	50                   	push   %eax
+  80171e:	6a 09                	push   $0x9
+  801720:	68 19 2f 80 00       	push   $0x802f19
+  801725:	6a 4a                	push   $0x4a
+  801727:	68 36 2f 80 00       	push   $0x802f36
+  80172c:	e8 81 12 00 00       	call   8029b2 <_panic>
+
+00801731 <sys_ipc_try_send>:
+{
+  801731:	55                   	push   %ebp
+  801732:	89 e5                	mov    %esp,%ebp
+  801734:	57                   	push   %edi
+  801735:	56                   	push   %esi
+  801736:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801737:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80173e:	78 32                	js     801772 <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  801740:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801747:	74 75                	je     8017be <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801749:	8b 55 08             	mov    0x8(%ebp),%edx
+  80174c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80174f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801754:	be 00 00 00 00       	mov    $0x0,%esi
+  801759:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80175c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80175f:	55                   	push   %ebp
+  801760:	68 69 17 80 00       	push   $0x801769
+  801765:	89 e5                	mov    %esp,%ebp
+  801767:	0f 34                	sysenter
+  801769:	83 c4 04             	add    $0x4,%esp
+  80176c:	5d                   	pop    %ebp
+}
+  80176d:	5b                   	pop    %ebx
+  80176e:	5e                   	pop    %esi
+  80176f:	5f                   	pop    %edi
+  801770:	5d                   	pop    %ebp
+  801771:	c3                   	ret
+  801772:	b8 01 00 00 00       	mov    $0x1,%eax
+  801777:	0f a2                	cpuid
+		return 0;
+  801779:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80177e:	f6 c6 08             	test   $0x8,%dh
+  801781:	74 15                	je     801798 <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801783:	89 c2                	mov    %eax,%edx
+  801785:	c1 ea 08             	shr    $0x8,%edx
+  801788:	83 e2 0f             	and    $0xf,%edx
+  80178b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801790:	83 fa 06             	cmp    $0x6,%edx
+  801793:	74 0e                	je     8017a3 <sys_ipc_try_send+0x72>
+  801795:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801798:	0f b6 c9             	movzbl %cl,%ecx
+  80179b:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8017a1:	eb 9d                	jmp    801740 <sys_ipc_try_send+0xf>
+  8017a3:	89 c2                	mov    %eax,%edx
+  8017a5:	c1 ea 04             	shr    $0x4,%edx
+  8017a8:	83 e2 0f             	and    $0xf,%edx
+  8017ab:	83 fa 02             	cmp    $0x2,%edx
+  8017ae:	77 e5                	ja     801795 <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  8017b0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017b3:	83 f8 02             	cmp    $0x2,%eax
+  8017b6:	0f 97 c1             	seta   %cl
+  8017b9:	0f b6 c9             	movzbl %cl,%ecx
+  8017bc:	eb d7                	jmp    801795 <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  8017be:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8017c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8017c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017ce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017d1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8017d4:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  8017d6:	eb 95                	jmp    80176d <sys_ipc_try_send+0x3c>
+
+008017d8 <sys_ipc_send>:
+{
+  8017d8:	55                   	push   %ebp
+  8017d9:	89 e5                	mov    %esp,%ebp
+  8017db:	57                   	push   %edi
+  8017dc:	56                   	push   %esi
+  8017dd:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8017de:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8017e5:	78 32                	js     801819 <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  8017e7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8017ee:	74 75                	je     801865 <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  8017f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017f6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8017fb:	be 00 00 00 00       	mov    $0x0,%esi
+  801800:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801803:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801806:	55                   	push   %ebp
+  801807:	68 10 18 80 00       	push   $0x801810
+  80180c:	89 e5                	mov    %esp,%ebp
+  80180e:	0f 34                	sysenter
+  801810:	83 c4 04             	add    $0x4,%esp
+  801813:	5d                   	pop    %ebp
+}
+  801814:	5b                   	pop    %ebx
+  801815:	5e                   	pop    %esi
+  801816:	5f                   	pop    %edi
+  801817:	5d                   	pop    %ebp
+  801818:	c3                   	ret
+  801819:	b8 01 00 00 00       	mov    $0x1,%eax
+  80181e:	0f a2                	cpuid
+		return 0;
+  801820:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801825:	f6 c6 08             	test   $0x8,%dh
+  801828:	74 15                	je     80183f <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80182a:	89 c2                	mov    %eax,%edx
+  80182c:	c1 ea 08             	shr    $0x8,%edx
+  80182f:	83 e2 0f             	and    $0xf,%edx
+  801832:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801837:	83 fa 06             	cmp    $0x6,%edx
+  80183a:	74 0e                	je     80184a <sys_ipc_send+0x72>
+  80183c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80183f:	0f b6 c9             	movzbl %cl,%ecx
+  801842:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801848:	eb 9d                	jmp    8017e7 <sys_ipc_send+0xf>
+  80184a:	89 c2                	mov    %eax,%edx
+  80184c:	c1 ea 04             	shr    $0x4,%edx
+  80184f:	83 e2 0f             	and    $0xf,%edx
+  801852:	83 fa 02             	cmp    $0x2,%edx
+  801855:	77 e5                	ja     80183c <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  801857:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80185a:	83 f8 02             	cmp    $0x2,%eax
+  80185d:	0f 97 c1             	seta   %cl
+  801860:	0f b6 c9             	movzbl %cl,%ecx
+  801863:	eb d7                	jmp    80183c <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  801865:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80186a:	be 00 00 00 00       	mov    $0x0,%esi
+  80186f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801872:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801875:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801878:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80187b:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  80187d:	eb 95                	jmp    801814 <sys_ipc_send+0x3c>
+
+0080187f <sys_ipc_recv>:
+{
+  80187f:	55                   	push   %ebp
+  801880:	89 e5                	mov    %esp,%ebp
+  801882:	57                   	push   %edi
+  801883:	56                   	push   %esi
+  801884:	53                   	push   %ebx
+  801885:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801888:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80188f:	78 36                	js     8018c7 <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  801891:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801898:	74 79                	je     801913 <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  80189a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80189d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018a2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8018a7:	89 cb                	mov    %ecx,%ebx
+  8018a9:	89 cf                	mov    %ecx,%edi
+  8018ab:	89 ce                	mov    %ecx,%esi
+  8018ad:	55                   	push   %ebp
+  8018ae:	68 b7 18 80 00       	push   $0x8018b7
+  8018b3:	89 e5                	mov    %esp,%ebp
+  8018b5:	0f 34                	sysenter
+  8018b7:	83 c4 04             	add    $0x4,%esp
+  8018ba:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8018bb:	85 c0                	test   %eax,%eax
+  8018bd:	7f 6b                	jg     80192a <sys_ipc_recv+0xab>
+}
+  8018bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018c2:	5b                   	pop    %ebx
+  8018c3:	5e                   	pop    %esi
+  8018c4:	5f                   	pop    %edi
+  8018c5:	5d                   	pop    %ebp
+  8018c6:	c3                   	ret
+  8018c7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018cc:	0f a2                	cpuid
+		return 0;
+  8018ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018d3:	f6 c6 08             	test   $0x8,%dh
+  8018d6:	74 15                	je     8018ed <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018d8:	89 c2                	mov    %eax,%edx
+  8018da:	c1 ea 08             	shr    $0x8,%edx
+  8018dd:	83 e2 0f             	and    $0xf,%edx
+  8018e0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018e5:	83 fa 06             	cmp    $0x6,%edx
+  8018e8:	74 0e                	je     8018f8 <sys_ipc_recv+0x79>
+  8018ea:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8018ed:	0f b6 c9             	movzbl %cl,%ecx
+  8018f0:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8018f6:	eb 99                	jmp    801891 <sys_ipc_recv+0x12>
+  8018f8:	89 c2                	mov    %eax,%edx
+  8018fa:	c1 ea 04             	shr    $0x4,%edx
+  8018fd:	83 e2 0f             	and    $0xf,%edx
+  801900:	83 fa 02             	cmp    $0x2,%edx
+  801903:	77 e5                	ja     8018ea <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  801905:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801908:	83 f8 02             	cmp    $0x2,%eax
+  80190b:	0f 97 c1             	seta   %cl
+  80190e:	0f b6 c9             	movzbl %cl,%ecx
+  801911:	eb d7                	jmp    8018ea <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  801913:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801918:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80191d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801920:	89 cb                	mov    %ecx,%ebx
+  801922:	89 cf                	mov    %ecx,%edi
+  801924:	89 ce                	mov    %ecx,%esi
+  801926:	cd 30                	int    $0x30
+  801928:	eb 91                	jmp    8018bb <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80192a:	83 ec 0c             	sub    $0xc,%esp
+  80192d:	50                   	push   %eax
+  80192e:	6a 0d                	push   $0xd
+  801930:	68 19 2f 80 00       	push   $0x802f19
+  801935:	6a 4a                	push   $0x4a
+  801937:	68 36 2f 80 00       	push   $0x802f36
+  80193c:	e8 71 10 00 00       	call   8029b2 <_panic>
+
+00801941 <sys_ipc_send_range>:
+{
+  801941:	55                   	push   %ebp
+  801942:	89 e5                	mov    %esp,%ebp
+  801944:	57                   	push   %edi
+  801945:	56                   	push   %esi
+  801946:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801947:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80194e:	78 30                	js     801980 <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  801950:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801957:	74 73                	je     8019cc <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801959:	8b 55 08             	mov    0x8(%ebp),%edx
+  80195c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80195f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801964:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801967:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80196a:	8b 75 18             	mov    0x18(%ebp),%esi
+  80196d:	55                   	push   %ebp
+  80196e:	68 77 19 80 00       	push   $0x801977
+  801973:	89 e5                	mov    %esp,%ebp
+  801975:	0f 34                	sysenter
+  801977:	83 c4 04             	add    $0x4,%esp
+  80197a:	5d                   	pop    %ebp
+}
+  80197b:	5b                   	pop    %ebx
+  80197c:	5e                   	pop    %esi
+  80197d:	5f                   	pop    %edi
+  80197e:	5d                   	pop    %ebp
+  80197f:	c3                   	ret
+  801980:	b8 01 00 00 00       	mov    $0x1,%eax
+  801985:	0f a2                	cpuid
+		return 0;
+  801987:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80198c:	f6 c6 08             	test   $0x8,%dh
+  80198f:	74 15                	je     8019a6 <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801991:	89 c2                	mov    %eax,%edx
+  801993:	c1 ea 08             	shr    $0x8,%edx
+  801996:	83 e2 0f             	and    $0xf,%edx
+  801999:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80199e:	83 fa 06             	cmp    $0x6,%edx
+  8019a1:	74 0e                	je     8019b1 <sys_ipc_send_range+0x70>
+  8019a3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8019a6:	0f b6 c9             	movzbl %cl,%ecx
+  8019a9:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8019af:	eb 9f                	jmp    801950 <sys_ipc_send_range+0xf>
+  8019b1:	89 c2                	mov    %eax,%edx
+  8019b3:	c1 ea 04             	shr    $0x4,%edx
+  8019b6:	83 e2 0f             	and    $0xf,%edx
+  8019b9:	83 fa 02             	cmp    $0x2,%edx
+  8019bc:	77 e5                	ja     8019a3 <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  8019be:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019c1:	83 f8 02             	cmp    $0x2,%eax
+  8019c4:	0f 97 c1             	seta   %cl
+  8019c7:	0f b6 c9             	movzbl %cl,%ecx
+  8019ca:	eb d7                	jmp    8019a3 <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  8019cc:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8019d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019d7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019da:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8019dd:	8b 75 18             	mov    0x18(%ebp),%esi
+  8019e0:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  8019e2:	eb 97                	jmp    80197b <sys_ipc_send_range+0x3a>
+
+008019e4 <sys_ipc_recv_range>:
+{
+  8019e4:	55                   	push   %ebp
+  8019e5:	89 e5                	mov    %esp,%ebp
+  8019e7:	57                   	push   %edi
+  8019e8:	56                   	push   %esi
+  8019e9:	53                   	push   %ebx
+  8019ea:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8019ed:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8019f4:	78 37                	js     801a2d <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  8019f6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8019fd:	74 7a                	je     801a79 <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  8019ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a04:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a07:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a0a:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801a0f:	89 df                	mov    %ebx,%edi
+  801a11:	89 de                	mov    %ebx,%esi
+  801a13:	55                   	push   %ebp
+  801a14:	68 1d 1a 80 00       	push   $0x801a1d
+  801a19:	89 e5                	mov    %esp,%ebp
+  801a1b:	0f 34                	sysenter
+  801a1d:	83 c4 04             	add    $0x4,%esp
+  801a20:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801a21:	85 c0                	test   %eax,%eax
+  801a23:	7f 6c                	jg     801a91 <sys_ipc_recv_range+0xad>
+}
+  801a25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a28:	5b                   	pop    %ebx
+  801a29:	5e                   	pop    %esi
+  801a2a:	5f                   	pop    %edi
+  801a2b:	5d                   	pop    %ebp
+  801a2c:	c3                   	ret
+  801a2d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a32:	0f a2                	cpuid
+		return 0;
+  801a34:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801a39:	f6 c6 08             	test   $0x8,%dh
+  801a3c:	74 15                	je     801a53 <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a3e:	89 c2                	mov    %eax,%edx
+  801a40:	c1 ea 08             	shr    $0x8,%edx
+  801a43:	83 e2 0f             	and    $0xf,%edx
+  801a46:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a4b:	83 fa 06             	cmp    $0x6,%edx
+  801a4e:	74 0e                	je     801a5e <sys_ipc_recv_range+0x7a>
+  801a50:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a53:	0f b6 c9             	movzbl %cl,%ecx
+  801a56:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801a5c:	eb 98                	jmp    8019f6 <sys_ipc_recv_range+0x12>
+  801a5e:	89 c2                	mov    %eax,%edx
+  801a60:	c1 ea 04             	shr    $0x4,%edx
+  801a63:	83 e2 0f             	and    $0xf,%edx
+  801a66:	83 fa 02             	cmp    $0x2,%edx
+  801a69:	77 e5                	ja     801a50 <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801a6b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a6e:	83 f8 02             	cmp    $0x2,%eax
+  801a71:	0f 97 c1             	seta   %cl
+  801a74:	0f b6 c9             	movzbl %cl,%ecx
+  801a77:	eb d7                	jmp    801a50 <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801a79:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a7e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801a83:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a89:	89 df                	mov    %ebx,%edi
+  801a8b:	89 de                	mov    %ebx,%esi
+  801a8d:	cd 30                	int    $0x30
+  801a8f:	eb 90                	jmp    801a21 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a91:	83 ec 0c             	sub    $0xc,%esp
+  801a94:	50                   	push   %eax
+  801a95:	6a 1f                	push   $0x1f
+  801a97:	68 19 2f 80 00       	push   $0x802f19
+  801a9c:	6a 4a                	push   $0x4a
+  801a9e:	68 36 2f 80 00       	push   $0x802f36
+  801aa3:	e8 0a 0f 00 00       	call   8029b2 <_panic>
+
+00801aa8 <sys_ipc_call>:
+{
+  801aa8:	55                   	push   %ebp
+  801aa9:	89 e5                	mov    %esp,%ebp
+  801aab:	57                   	push   %edi
+  801aac:	56                   	push   %esi
+  801aad:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801aae:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ab1:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801ab6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801ab9:	55                   	push   %ebp
+  801aba:	56                   	push   %esi
+  801abb:	8b 0e                	mov    (%esi),%ecx
+  801abd:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801ac0:	8b 7e 08             	mov    0x8(%esi),%edi
+  801ac3:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801ac6:	8b 76 0c             	mov    0xc(%esi),%esi
+  801ac9:	cd 30                	int    $0x30
+  801acb:	87 34 24             	xchg   %esi,(%esp)
+  801ace:	89 0e                	mov    %ecx,(%esi)
+  801ad0:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801ad3:	89 7e 08             	mov    %edi,0x8(%esi)
+  801ad6:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801ad9:	8f 46 0c             	pop    0xc(%esi)
+  801adc:	5d                   	pop    %ebp
+}
+  801add:	5b                   	pop    %ebx
+  801ade:	5e                   	pop    %esi
+  801adf:	5f                   	pop    %edi
+  801ae0:	5d                   	pop    %ebp
+  801ae1:	c3                   	ret
+
+00801ae2 <sys_ipc_reply_wait>:
+{
+  801ae2:	55                   	push   %ebp
+  801ae3:	89 e5                	mov    %esp,%ebp
+  801ae5:	57                   	push   %edi
+  801ae6:	56                   	push   %esi
+  801ae7:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801ae8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aeb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801af0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801af3:	55                   	push   %ebp
+  801af4:	56                   	push   %esi
+  801af5:	8b 0e                	mov    (%esi),%ecx
+  801af7:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801afa:	8b 7e 08             	mov    0x8(%esi),%edi
+  801afd:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801b00:	8b 76 0c             	mov    0xc(%esi),%esi
+  801b03:	cd 30                	int    $0x30
+  801b05:	87 34 24             	xchg   %esi,(%esp)
+  801b08:	89 0e                	mov    %ecx,(%esi)
+  801b0a:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801b0d:	89 7e 08             	mov    %edi,0x8(%esi)
+  801b10:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801b13:	8f 46 0c             	pop    0xc(%esi)
+  801b16:	5d                   	pop    %ebp
+}
+  801b17:	5b                   	pop    %ebx
+  801b18:	5e                   	pop    %esi
+  801b19:	5f                   	pop    %edi
+  801b1a:	5d                   	pop    %ebp
+  801b1b:	c3                   	ret
+
+00801b1c <sys_ipc_send_msg>:
+{
+  801b1c:	55                   	push   %ebp
+  801b1d:	89 e5                	mov    %esp,%ebp
+  801b1f:	57                   	push   %edi
+  801b20:	56                   	push   %esi
+  801b21:	53                   	push   %ebx
+  801b22:	83 ec 20             	sub    $0x20,%esp
+  801b25:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801b28:	8b 10                	mov    (%eax),%edx
+  801b2a:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801b2d:	8b 50 04             	mov    0x4(%eax),%edx
+  801b30:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801b33:	8b 50 08             	mov    0x8(%eax),%edx
+  801b36:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801b39:	8b 50 0c             	mov    0xc(%eax),%edx
+  801b3c:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801b3f:	8b 40 10             	mov    0x10(%eax),%eax
+  801b42:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801b45:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801b48:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b4b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801b50:	55                   	push   %ebp
+  801b51:	56                   	push   %esi
+  801b52:	8b 0e                	mov    (%esi),%ecx
+  801b54:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801b57:	8b 7e 08             	mov    0x8(%esi),%edi
+  801b5a:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801b5d:	8b 76 0c             	mov    0xc(%esi),%esi
+  801b60:	cd 30                	int    $0x30
+  801b62:	87 34 24             	xchg   %esi,(%esp)
+  801b65:	89 0e                	mov    %ecx,(%esi)
+  801b67:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801b6a:	89 7e 08             	mov    %edi,0x8(%esi)
+  801b6d:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801b70:	8f 46 0c             	pop    0xc(%esi)
+  801b73:	5d                   	pop    %ebp
+}
+  801b74:	83 c4 20             	add    $0x20,%esp
+  801b77:	5b                   	pop    %ebx
+  801b78:	5e                   	pop    %esi
+  801b79:	5f                   	pop    %edi
+  801b7a:	5d                   	pop    %ebp
+  801b7b:	c3                   	ret
+
+00801b7c <sys_fork>:
+{
+  801b7c:	55                   	push   %ebp
+  801b7d:	89 e5                	mov    %esp,%ebp
+  801b7f:	57                   	push   %edi
+  801b80:	56                   	push   %esi
+  801b81:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801b82:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b89:	78 2e                	js     801bb9 <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801b8b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b92:	74 71                	je     801c05 <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801b94:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b99:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801b9e:	89 d1                	mov    %edx,%ecx
+  801ba0:	89 d3                	mov    %edx,%ebx
+  801ba2:	89 d7                	mov    %edx,%edi
+  801ba4:	89 d6                	mov    %edx,%esi
+  801ba6:	55                   	push   %ebp
+  801ba7:	68 b0 1b 80 00       	push   $0x801bb0
+  801bac:	89 e5                	mov    %esp,%ebp
+  801bae:	0f 34                	sysenter
+  801bb0:	83 c4 04             	add    $0x4,%esp
+  801bb3:	5d                   	pop    %ebp
+}
+  801bb4:	5b                   	pop    %ebx
+  801bb5:	5e                   	pop    %esi
+  801bb6:	5f                   	pop    %edi
+  801bb7:	5d                   	pop    %ebp
+  801bb8:	c3                   	ret
+  801bb9:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bbe:	0f a2                	cpuid
+		return 0;
+  801bc0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801bc5:	f6 c6 08             	test   $0x8,%dh
+  801bc8:	74 15                	je     801bdf <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bca:	89 c2                	mov    %eax,%edx
+  801bcc:	c1 ea 08             	shr    $0x8,%edx
+  801bcf:	83 e2 0f             	and    $0xf,%edx
+  801bd2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801bd7:	83 fa 06             	cmp    $0x6,%edx
+  801bda:	74 0e                	je     801bea <sys_fork+0x6e>
+  801bdc:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801bdf:	0f b6 c9             	movzbl %cl,%ecx
+  801be2:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801be8:	eb a1                	jmp    801b8b <sys_fork+0xf>
+  801bea:	89 c2                	mov    %eax,%edx
+  801bec:	c1 ea 04             	shr    $0x4,%edx
+  801bef:	83 e2 0f             	and    $0xf,%edx
+  801bf2:	83 fa 02             	cmp    $0x2,%edx
+  801bf5:	77 e5                	ja     801bdc <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801bf7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bfa:	83 f8 02             	cmp    $0x2,%eax
+  801bfd:	0f 97 c1             	seta   %cl
+  801c00:	0f b6 c9             	movzbl %cl,%ecx
+  801c03:	eb d7                	jmp    801bdc <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801c05:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c0a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801c0f:	89 d1                	mov    %edx,%ecx
+  801c11:	89 d3                	mov    %edx,%ebx
+  801c13:	89 d7                	mov    %edx,%edi
+  801c15:	89 d6                	mov    %edx,%esi
+  801c17:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801c19:	eb 99                	jmp    801bb4 <sys_fork+0x38>
+
+00801c1b <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801c1b:	55                   	push   %ebp
+  801c1c:	89 e5                	mov    %esp,%ebp
+  801c1e:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801c21:	ff 75 14             	push   0x14(%ebp)
+  801c24:	ff 75 10             	push   0x10(%ebp)
+  801c27:	ff 75 0c             	push   0xc(%ebp)
+  801c2a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c2f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c32:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801c37:	e8 81 ee ff ff       	call   800abd <page_vec_call>
+}
+  801c3c:	c9                   	leave
+  801c3d:	c3                   	ret
+
+00801c3e <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801c3e:	55                   	push   %ebp
+  801c3f:	89 e5                	mov    %esp,%ebp
+  801c41:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801c44:	ff 75 18             	push   0x18(%ebp)
+  801c47:	ff 75 14             	push   0x14(%ebp)
+  801c4a:	ff 75 10             	push   0x10(%ebp)
+  801c4d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c50:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c53:	b8 10 00 00 00       	mov    $0x10,%eax
+  801c58:	e8 60 ee ff ff       	call   800abd <page_vec_call>
+}
+  801c5d:	c9                   	leave
+  801c5e:	c3                   	ret
+
+00801c5f <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801c5f:	55                   	push   %ebp
+  801c60:	89 e5                	mov    %esp,%ebp
+  801c62:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801c65:	ff 75 14             	push   0x14(%ebp)
+  801c68:	ff 75 10             	push   0x10(%ebp)
+  801c6b:	ff 75 0c             	push   0xc(%ebp)
+  801c6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c73:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c76:	b8 11 00 00 00       	mov    $0x11,%eax
+  801c7b:	e8 3d ee ff ff       	call   800abd <page_vec_call>
+}
+  801c80:	c9                   	leave
+  801c81:	c3                   	ret
+
+00801c82 <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801c82:	55                   	push   %ebp
+  801c83:	89 e5                	mov    %esp,%ebp
+  801c85:	57                   	push   %edi
+  801c86:	56                   	push   %esi
+  801c87:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801c88:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801c8f:	78 32                	js     801cc3 <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801c91:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801c98:	74 75                	je     801d0f <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801c9a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c9d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ca0:	b8 12 00 00 00       	mov    $0x12,%eax
+  801ca5:	be 00 00 00 00       	mov    $0x0,%esi
+  801caa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801cad:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801cb0:	55                   	push   %ebp
+  801cb1:	68 ba 1c 80 00       	push   $0x801cba
+  801cb6:	89 e5                	mov    %esp,%ebp
+  801cb8:	0f 34                	sysenter
+  801cba:	83 c4 04             	add    $0x4,%esp
+  801cbd:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801cbe:	5b                   	pop    %ebx
+  801cbf:	5e                   	pop    %esi
+  801cc0:	5f                   	pop    %edi
+  801cc1:	5d                   	pop    %ebp
+  801cc2:	c3                   	ret
+  801cc3:	b8 01 00 00 00       	mov    $0x1,%eax
+  801cc8:	0f a2                	cpuid
+		return 0;
+  801cca:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801ccf:	f6 c6 08             	test   $0x8,%dh
+  801cd2:	74 15                	je     801ce9 <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801cd4:	89 c2                	mov    %eax,%edx
+  801cd6:	c1 ea 08             	shr    $0x8,%edx
+  801cd9:	83 e2 0f             	and    $0xf,%edx
+  801cdc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ce1:	83 fa 06             	cmp    $0x6,%edx
+  801ce4:	74 0e                	je     801cf4 <sys_vm_ranges+0x72>
+  801ce6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801ce9:	0f b6 c9             	movzbl %cl,%ecx
+  801cec:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801cf2:	eb 9d                	jmp    801c91 <sys_vm_ranges+0xf>
+  801cf4:	89 c2                	mov    %eax,%edx
+  801cf6:	c1 ea 04             	shr    $0x4,%edx
+  801cf9:	83 e2 0f             	and    $0xf,%edx
+  801cfc:	83 fa 02             	cmp    $0x2,%edx
+  801cff:	77 e5                	ja     801ce6 <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  801d01:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d04:	83 f8 02             	cmp    $0x2,%eax
+  801d07:	0f 97 c1             	seta   %cl
+  801d0a:	0f b6 c9             	movzbl %cl,%ecx
+  801d0d:	eb d7                	jmp    801ce6 <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801d0f:	b8 12 00 00 00       	mov    $0x12,%eax
+  801d14:	be 00 00 00 00       	mov    $0x0,%esi
+  801d19:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d1c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d1f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d22:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801d25:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801d27:	eb 95                	jmp    801cbe <sys_vm_ranges+0x3c>
+
+00801d29 <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801d29:	55                   	push   %ebp
+  801d2a:	89 e5                	mov    %esp,%ebp
+  801d2c:	57                   	push   %edi
+  801d2d:	56                   	push   %esi
+  801d2e:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801d2f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801d36:	78 31                	js     801d69 <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801d38:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801d3f:	74 74                	je     801db5 <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801d41:	be 00 00 00 00       	mov    $0x0,%esi
+  801d46:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d49:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d4c:	b8 14 00 00 00       	mov    $0x14,%eax
+  801d51:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d54:	89 f7                	mov    %esi,%edi
+  801d56:	55                   	push   %ebp
+  801d57:	68 60 1d 80 00       	push   $0x801d60
+  801d5c:	89 e5                	mov    %esp,%ebp
+  801d5e:	0f 34                	sysenter
+  801d60:	83 c4 04             	add    $0x4,%esp
+  801d63:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801d64:	5b                   	pop    %ebx
+  801d65:	5e                   	pop    %esi
+  801d66:	5f                   	pop    %edi
+  801d67:	5d                   	pop    %ebp
+  801d68:	c3                   	ret
+  801d69:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d6e:	0f a2                	cpuid
+		return 0;
+  801d70:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801d75:	f6 c6 08             	test   $0x8,%dh
+  801d78:	74 15                	je     801d8f <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d7a:	89 c2                	mov    %eax,%edx
+  801d7c:	c1 ea 08             	shr    $0x8,%edx
+  801d7f:	83 e2 0f             	and    $0xf,%edx
+  801d82:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d87:	83 fa 06             	cmp    $0x6,%edx
+  801d8a:	74 0e                	je     801d9a <sys_spawn+0x71>
+  801d8c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801d8f:	0f b6 c9             	movzbl %cl,%ecx
+  801d92:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801d98:	eb 9e                	jmp    801d38 <sys_spawn+0xf>
+  801d9a:	89 c2                	mov    %eax,%edx
+  801d9c:	c1 ea 04             	shr    $0x4,%edx
+  801d9f:	83 e2 0f             	and    $0xf,%edx
+  801da2:	83 fa 02             	cmp    $0x2,%edx
+  801da5:	77 e5                	ja     801d8c <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  801da7:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801daa:	83 f8 02             	cmp    $0x2,%eax
+  801dad:	0f 97 c1             	seta   %cl
+  801db0:	0f b6 c9             	movzbl %cl,%ecx
+  801db3:	eb d7                	jmp    801d8c <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  801db5:	be 00 00 00 00       	mov    $0x0,%esi
+  801dba:	b8 14 00 00 00       	mov    $0x14,%eax
+  801dbf:	8b 55 08             	mov    0x8(%ebp),%edx
+  801dc2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801dc5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801dc8:	89 f7                	mov    %esi,%edi
+  801dca:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  801dcc:	eb 96                	jmp    801d64 <sys_spawn+0x3b>
+
+00801dce <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  801dce:	55                   	push   %ebp
+  801dcf:	89 e5                	mov    %esp,%ebp
+  801dd1:	57                   	push   %edi
+  801dd2:	56                   	push   %esi
+  801dd3:	53                   	push   %ebx
+  801dd4:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801dd7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801dde:	78 37                	js     801e17 <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  801de0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801de7:	74 7a                	je     801e63 <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  801de9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dee:	8b 55 08             	mov    0x8(%ebp),%edx
+  801df1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801df4:	b8 15 00 00 00       	mov    $0x15,%eax
+  801df9:	89 df                	mov    %ebx,%edi
+  801dfb:	89 de                	mov    %ebx,%esi
+  801dfd:	55                   	push   %ebp
+  801dfe:	68 07 1e 80 00       	push   $0x801e07
+  801e03:	89 e5                	mov    %esp,%ebp
+  801e05:	0f 34                	sysenter
+  801e07:	83 c4 04             	add    $0x4,%esp
+  801e0a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801e0b:	85 c0                	test   %eax,%eax
+  801e0d:	7f 6c                	jg     801e7b <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  801e0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e12:	5b                   	pop    %ebx
+  801e13:	5e                   	pop    %esi
+  801e14:	5f                   	pop    %edi
+  801e15:	5d                   	pop    %ebp
+  801e16:	c3                   	ret
+  801e17:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e1c:	0f a2                	cpuid
+		return 0;
+  801e1e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801e23:	f6 c6 08             	test   $0x8,%dh
+  801e26:	74 15                	je     801e3d <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e28:	89 c2                	mov    %eax,%edx
+  801e2a:	c1 ea 08             	shr    $0x8,%edx
+  801e2d:	83 e2 0f             	and    $0xf,%edx
+  801e30:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e35:	83 fa 06             	cmp    $0x6,%edx
+  801e38:	74 0e                	je     801e48 <sys_shm_create+0x7a>
+  801e3a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801e3d:	0f b6 c9             	movzbl %cl,%ecx
+  801e40:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801e46:	eb 98                	jmp    801de0 <sys_shm_create+0x12>
+  801e48:	89 c2                	mov    %eax,%edx
+  801e4a:	c1 ea 04             	shr    $0x4,%edx
+  801e4d:	83 e2 0f             	and    $0xf,%edx
+  801e50:	83 fa 02             	cmp    $0x2,%edx
+  801e53:	77 e5                	ja     801e3a <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  801e55:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e58:	83 f8 02             	cmp    $0x2,%eax
+  801e5b:	0f 97 c1             	seta   %cl
+  801e5e:	0f b6 c9             	movzbl %cl,%ecx
+  801e61:	eb d7                	jmp    801e3a <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  801e63:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e68:	b8 15 00 00 00       	mov    $0x15,%eax
+  801e6d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e70:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e73:	89 df                	mov    %ebx,%edi
+  801e75:	89 de                	mov    %ebx,%esi
+  801e77:	cd 30                	int    $0x30
+  801e79:	eb 90                	jmp    801e0b <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801e7b:	83 ec 0c             	sub    $0xc,%esp
+  801e7e:	50                   	push   %eax
+  801e7f:	6a 15                	push   $0x15
+  801e81:	68 19 2f 80 00       	push   $0x802f19
+  801e86:	6a 4a                	push   $0x4a
+  801e88:	68 36 2f 80 00       	push   $0x802f36
+  801e8d:	e8 20 0b 00 00       	call   8029b2 <_panic>
+
+00801e92 <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  801e92:	55                   	push   %ebp
+  801e93:	89 e5                	mov    %esp,%ebp
+  801e95:	57                   	push   %edi
+  801e96:	56                   	push   %esi
+  801e97:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801e98:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801e9f:	78 32                	js     801ed3 <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  801ea1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801ea8:	74 75                	je     801f1f <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801eaa:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ead:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801eb0:	b8 16 00 00 00       	mov    $0x16,%eax
+  801eb5:	be 00 00 00 00       	mov    $0x0,%esi
+  801eba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ebd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ec0:	55                   	push   %ebp
+  801ec1:	68 ca 1e 80 00       	push   $0x801eca
+  801ec6:	89 e5                	mov    %esp,%ebp
+  801ec8:	0f 34                	sysenter
+  801eca:	83 c4 04             	add    $0x4,%esp
+  801ecd:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  801ece:	5b                   	pop    %ebx
+  801ecf:	5e                   	pop    %esi
+  801ed0:	5f                   	pop    %edi
+  801ed1:	5d                   	pop    %ebp
+  801ed2:	c3                   	ret
+  801ed3:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ed8:	0f a2                	cpuid
+		return 0;
+  801eda:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801edf:	f6 c6 08             	test   $0x8,%dh
+  801ee2:	74 15                	je     801ef9 <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ee4:	89 c2                	mov    %eax,%edx
+  801ee6:	c1 ea 08             	shr    $0x8,%edx
+  801ee9:	83 e2 0f             	and    $0xf,%edx
+  801eec:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ef1:	83 fa 06             	cmp    $0x6,%edx
+  801ef4:	74 0e                	je     801f04 <sys_shm_attach+0x72>
+  801ef6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801ef9:	0f b6 c9             	movzbl %cl,%ecx
+  801efc:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801f02:	eb 9d                	jmp    801ea1 <sys_shm_attach+0xf>
+  801f04:	89 c2                	mov    %eax,%edx
+  801f06:	c1 ea 04             	shr    $0x4,%edx
+  801f09:	83 e2 0f             	and    $0xf,%edx
+  801f0c:	83 fa 02             	cmp    $0x2,%edx
+  801f0f:	77 e5                	ja     801ef6 <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  801f11:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f14:	83 f8 02             	cmp    $0x2,%eax
+  801f17:	0f 97 c1             	seta   %cl
+  801f1a:	0f b6 c9             	movzbl %cl,%ecx
+  801f1d:	eb d7                	jmp    801ef6 <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  801f1f:	b8 16 00 00 00       	mov    $0x16,%eax
+  801f24:	be 00 00 00 00       	mov    $0x0,%esi
+  801f29:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f2c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f2f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f32:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801f35:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  801f37:	eb 95                	jmp    801ece <sys_shm_attach+0x3c>
+
+00801f39 <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  801f39:	55                   	push   %ebp
+  801f3a:	89 e5                	mov    %esp,%ebp
+  801f3c:	57                   	push   %edi
+  801f3d:	56                   	push   %esi
+  801f3e:	53                   	push   %ebx
+  801f3f:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801f42:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801f49:	78 38                	js     801f83 <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  801f4b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801f52:	74 7b                	je     801fcf <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  801f54:	be 00 00 00 00       	mov    $0x0,%esi
+  801f59:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f5c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f5f:	b8 17 00 00 00       	mov    $0x17,%eax
+  801f64:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f67:	89 f7                	mov    %esi,%edi
+  801f69:	55                   	push   %ebp
+  801f6a:	68 73 1f 80 00       	push   $0x801f73
+  801f6f:	89 e5                	mov    %esp,%ebp
+  801f71:	0f 34                	sysenter
+  801f73:	83 c4 04             	add    $0x4,%esp
+  801f76:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801f77:	85 c0                	test   %eax,%eax
+  801f79:	7f 6d                	jg     801fe8 <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  801f7b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f7e:	5b                   	pop    %ebx
+  801f7f:	5e                   	pop    %esi
+  801f80:	5f                   	pop    %edi
+  801f81:	5d                   	pop    %ebp
+  801f82:	c3                   	ret
+  801f83:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f88:	0f a2                	cpuid
+		return 0;
+  801f8a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801f8f:	f6 c6 08             	test   $0x8,%dh
+  801f92:	74 15                	je     801fa9 <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f94:	89 c2                	mov    %eax,%edx
+  801f96:	c1 ea 08             	shr    $0x8,%edx
+  801f99:	83 e2 0f             	and    $0xf,%edx
+  801f9c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801fa1:	83 fa 06             	cmp    $0x6,%edx
+  801fa4:	74 0e                	je     801fb4 <sys_shm_detach+0x7b>
+  801fa6:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801fa9:	0f b6 c9             	movzbl %cl,%ecx
+  801fac:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801fb2:	eb 97                	jmp    801f4b <sys_shm_detach+0x12>
+  801fb4:	89 c2                	mov    %eax,%edx
+  801fb6:	c1 ea 04             	shr    $0x4,%edx
+  801fb9:	83 e2 0f             	and    $0xf,%edx
+  801fbc:	83 fa 02             	cmp    $0x2,%edx
+  801fbf:	77 e5                	ja     801fa6 <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  801fc1:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fc4:	83 f8 02             	cmp    $0x2,%eax
+  801fc7:	0f 97 c1             	seta   %cl
+  801fca:	0f b6 c9             	movzbl %cl,%ecx
+  801fcd:	eb d7                	jmp    801fa6 <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  801fcf:	be 00 00 00 00       	mov    $0x0,%esi
+  801fd4:	b8 17 00 00 00       	mov    $0x17,%eax
+  801fd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fdc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fdf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801fe2:	89 f7                	mov    %esi,%edi
+  801fe4:	cd 30                	int    $0x30
+  801fe6:	eb 8f                	jmp    801f77 <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801fe8:	83 ec 0c             	sub    $0xc,%esp
+  801feb:	50                   	push   %eax
+  801fec:	6a 17                	push   $0x17
+  801fee:	68 19 2f 80 00       	push   $0x802f19
+  801ff3:	6a 4a                	push   $0x4a
+  801ff5:	68 36 2f 80 00       	push   $0x802f36
+  801ffa:	e8 b3 09 00 00       	call   8029b2 <_panic>
+
+00801fff <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  801fff:	55                   	push   %ebp
+  802000:	89 e5                	mov    %esp,%ebp
+  802002:	57                   	push   %edi
+  802003:	56                   	push   %esi
+  802004:	53                   	push   %ebx
+  802005:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802008:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80200f:	78 36                	js     802047 <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  802011:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802018:	74 79                	je     802093 <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  80201a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80201d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802022:	b8 18 00 00 00       	mov    $0x18,%eax
+  802027:	89 cb                	mov    %ecx,%ebx
+  802029:	89 cf                	mov    %ecx,%edi
+  80202b:	89 ce                	mov    %ecx,%esi
+  80202d:	55                   	push   %ebp
+  80202e:	68 37 20 80 00       	push   $0x802037
+  802033:	89 e5                	mov    %esp,%ebp
+  802035:	0f 34                	sysenter
+  802037:	83 c4 04             	add    $0x4,%esp
+  80203a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80203b:	85 c0                	test   %eax,%eax
+  80203d:	7f 6b                	jg     8020aa <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  80203f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802042:	5b                   	pop    %ebx
+  802043:	5e                   	pop    %esi
+  802044:	5f                   	pop    %edi
+  802045:	5d                   	pop    %ebp
+  802046:	c3                   	ret
+  802047:	b8 01 00 00 00       	mov    $0x1,%eax
+  80204c:	0f a2                	cpuid
+		return 0;
+  80204e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802053:	f6 c6 08             	test   $0x8,%dh
+  802056:	74 15                	je     80206d <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802058:	89 c2                	mov    %eax,%edx
+  80205a:	c1 ea 08             	shr    $0x8,%edx
+  80205d:	83 e2 0f             	and    $0xf,%edx
+  802060:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802065:	83 fa 06             	cmp    $0x6,%edx
+  802068:	74 0e                	je     802078 <sys_shm_remove+0x79>
+  80206a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80206d:	0f b6 c9             	movzbl %cl,%ecx
+  802070:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802076:	eb 99                	jmp    802011 <sys_shm_remove+0x12>
+  802078:	89 c2                	mov    %eax,%edx
+  80207a:	c1 ea 04             	shr    $0x4,%edx
+  80207d:	83 e2 0f             	and    $0xf,%edx
+  802080:	83 fa 02             	cmp    $0x2,%edx
+  802083:	77 e5                	ja     80206a <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  802085:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802088:	83 f8 02             	cmp    $0x2,%eax
+  80208b:	0f 97 c1             	seta   %cl
+  80208e:	0f b6 c9             	movzbl %cl,%ecx
+  802091:	eb d7                	jmp    80206a <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  802093:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802098:	b8 18 00 00 00       	mov    $0x18,%eax
+  80209d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020a0:	89 cb                	mov    %ecx,%ebx
+  8020a2:	89 cf                	mov    %ecx,%edi
+  8020a4:	89 ce                	mov    %ecx,%esi
+  8020a6:	cd 30                	int    $0x30
+  8020a8:	eb 91                	jmp    80203b <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8020aa:	83 ec 0c             	sub    $0xc,%esp
+  8020ad:	50                   	push   %eax
+  8020ae:	6a 18                	push   $0x18
+  8020b0:	68 19 2f 80 00       	push   $0x802f19
+  8020b5:	6a 4a                	push   $0x4a
+  8020b7:	68 36 2f 80 00       	push   $0x802f36
+  8020bc:	e8 f1 08 00 00       	call   8029b2 <_panic>
+
+008020c1 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  8020c1:	55                   	push   %ebp
+  8020c2:	89 e5                	mov    %esp,%ebp
+  8020c4:	57                   	push   %edi
+  8020c5:	56                   	push   %esi
+  8020c6:	53                   	push   %ebx
+  8020c7:	83 ec 0c             	sub    $0xc,%esp
+  8020ca:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020cd:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8020d0:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  8020d3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8020da:	78 32                	js     80210e <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  8020dc:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8020e3:	74 75                	je     80215a <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  8020e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020eb:	b8 20 00 00 00       	mov    $0x20,%eax
+  8020f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8020f5:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8020f8:	55                   	push   %ebp
+  8020f9:	68 02 21 80 00       	push   $0x802102
+  8020fe:	89 e5                	mov    %esp,%ebp
+  802100:	0f 34                	sysenter
+  802102:	83 c4 04             	add    $0x4,%esp
+  802105:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  802106:	83 c4 0c             	add    $0xc,%esp
+  802109:	5b                   	pop    %ebx
+  80210a:	5e                   	pop    %esi
+  80210b:	5f                   	pop    %edi
+  80210c:	5d                   	pop    %ebp
+  80210d:	c3                   	ret
+  80210e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802113:	0f a2                	cpuid
+		return 0;
+  802115:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80211a:	f6 c6 08             	test   $0x8,%dh
+  80211d:	74 15                	je     802134 <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80211f:	89 c2                	mov    %eax,%edx
+  802121:	c1 ea 08             	shr    $0x8,%edx
+  802124:	83 e2 0f             	and    $0xf,%edx
+  802127:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80212c:	83 fa 06             	cmp    $0x6,%edx
+  80212f:	74 0e                	je     80213f <sys_futex_wait+0x7e>
+  802131:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802134:	0f b6 c9             	movzbl %cl,%ecx
+  802137:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80213d:	eb 9d                	jmp    8020dc <sys_futex_wait+0x1b>
+  80213f:	89 c2                	mov    %eax,%edx
+  802141:	c1 ea 04             	shr    $0x4,%edx
+  802144:	83 e2 0f             	and    $0xf,%edx
+  802147:	83 fa 02             	cmp    $0x2,%edx
+  80214a:	77 e5                	ja     802131 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  80214c:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80214f:	83 f8 02             	cmp    $0x2,%eax
+  802152:	0f 97 c1             	seta   %cl
+  802155:	0f b6 c9             	movzbl %cl,%ecx
+  802158:	eb d7                	jmp    802131 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  80215a:	b8 20 00 00 00       	mov    $0x20,%eax
+  80215f:	be 00 00 00 00       	mov    $0x0,%esi
+  802164:	8b 55 08             	mov    0x8(%ebp),%edx
+  802167:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80216a:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  80216d:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  80216f:	eb 95                	jmp    802106 <sys_futex_wait+0x45>
+
+00802171 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  802171:	55                   	push   %ebp
+  802172:	89 e5                	mov    %esp,%ebp
+  802174:	57                   	push   %edi
+  802175:	56                   	push   %esi
+  802176:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802177:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80217e:	78 30                	js     8021b0 <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  802180:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802187:	74 73                	je     8021fc <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  802189:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80218e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802191:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802194:	b8 21 00 00 00       	mov    $0x21,%eax
+  802199:	89 df                	mov    %ebx,%edi
+  80219b:	89 de                	mov    %ebx,%esi
+  80219d:	55                   	push   %ebp
+  80219e:	68 a7 21 80 00       	push   $0x8021a7
+  8021a3:	89 e5                	mov    %esp,%ebp
+  8021a5:	0f 34                	sysenter
+  8021a7:	83 c4 04             	add    $0x4,%esp
+  8021aa:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8021ab:	5b                   	pop    %ebx
+  8021ac:	5e                   	pop    %esi
+  8021ad:	5f                   	pop    %edi
+  8021ae:	5d                   	pop    %ebp
+  8021af:	c3                   	ret
+  8021b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021b5:	0f a2                	cpuid
+		return 0;
+  8021b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8021bc:	f6 c6 08             	test   $0x8,%dh
+  8021bf:	74 15                	je     8021d6 <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021c1:	89 c2                	mov    %eax,%edx
+  8021c3:	c1 ea 08             	shr    $0x8,%edx
+  8021c6:	83 e2 0f             	and    $0xf,%edx
+  8021c9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8021ce:	83 fa 06             	cmp    $0x6,%edx
+  8021d1:	74 0e                	je     8021e1 <sys_futex_wake+0x70>
+  8021d3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8021d6:	0f b6 c9             	movzbl %cl,%ecx
+  8021d9:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8021df:	eb 9f                	jmp    802180 <sys_futex_wake+0xf>
+  8021e1:	89 c2                	mov    %eax,%edx
+  8021e3:	c1 ea 04             	shr    $0x4,%edx
+  8021e6:	83 e2 0f             	and    $0xf,%edx
+  8021e9:	83 fa 02             	cmp    $0x2,%edx
+  8021ec:	77 e5                	ja     8021d3 <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  8021ee:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021f1:	83 f8 02             	cmp    $0x2,%eax
+  8021f4:	0f 97 c1             	seta   %cl
+  8021f7:	0f b6 c9             	movzbl %cl,%ecx
+  8021fa:	eb d7                	jmp    8021d3 <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  8021fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802201:	b8 21 00 00 00       	mov    $0x21,%eax
+  802206:	8b 55 08             	mov    0x8(%ebp),%edx
+  802209:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80220c:	89 df                	mov    %ebx,%edi
+  80220e:	89 de                	mov    %ebx,%esi
+  802210:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  802212:	eb 97                	jmp    8021ab <sys_futex_wake+0x3a>
+
+00802214 <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  802214:	55                   	push   %ebp
+  802215:	89 e5                	mov    %esp,%ebp
+  802217:	57                   	push   %edi
+  802218:	56                   	push   %esi
+  802219:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80221a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802221:	78 2e                	js     802251 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  802223:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80222a:	74 71                	je     80229d <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  80222c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802231:	b8 22 00 00 00       	mov    $0x22,%eax
+  802236:	89 d1                	mov    %edx,%ecx
+  802238:	89 d3                	mov    %edx,%ebx
+  80223a:	89 d7                	mov    %edx,%edi
+  80223c:	89 d6                	mov    %edx,%esi
+  80223e:	55                   	push   %ebp
+  80223f:	68 48 22 80 00       	push   $0x802248
+  802244:	89 e5                	mov    %esp,%ebp
+  802246:	0f 34                	sysenter
+  802248:	83 c4 04             	add    $0x4,%esp
+  80224b:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  80224c:	5b                   	pop    %ebx
+  80224d:	5e                   	pop    %esi
+  80224e:	5f                   	pop    %edi
+  80224f:	5d                   	pop    %ebp
+  802250:	c3                   	ret
+  802251:	b8 01 00 00 00       	mov    $0x1,%eax
+  802256:	0f a2                	cpuid
+		return 0;
+  802258:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80225d:	f6 c6 08             	test   $0x8,%dh
+  802260:	74 15                	je     802277 <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802262:	89 c2                	mov    %eax,%edx
+  802264:	c1 ea 08             	shr    $0x8,%edx
+  802267:	83 e2 0f             	and    $0xf,%edx
+  80226a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80226f:	83 fa 06             	cmp    $0x6,%edx
+  802272:	74 0e                	je     802282 <sys_ep_create+0x6e>
+  802274:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802277:	0f b6 c9             	movzbl %cl,%ecx
+  80227a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802280:	eb a1                	jmp    802223 <sys_ep_create+0xf>
+  802282:	89 c2                	mov    %eax,%edx
+  802284:	c1 ea 04             	shr    $0x4,%edx
+  802287:	83 e2 0f             	and    $0xf,%edx
+  80228a:	83 fa 02             	cmp    $0x2,%edx
+  80228d:	77 e5                	ja     802274 <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  80228f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802292:	83 f8 02             	cmp    $0x2,%eax
+  802295:	0f 97 c1             	seta   %cl
+  802298:	0f b6 c9             	movzbl %cl,%ecx
+  80229b:	eb d7                	jmp    802274 <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  80229d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022a2:	b8 22 00 00 00       	mov    $0x22,%eax
+  8022a7:	89 d1                	mov    %edx,%ecx
+  8022a9:	89 d3                	mov    %edx,%ebx
+  8022ab:	89 d7                	mov    %edx,%edi
+  8022ad:	89 d6                	mov    %edx,%esi
+  8022af:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  8022b1:	eb 99                	jmp    80224c <sys_ep_create+0x38>
+
+008022b3 <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  8022b3:	55                   	push   %ebp
+  8022b4:	89 e5                	mov    %esp,%ebp
+  8022b6:	57                   	push   %edi
+  8022b7:	56                   	push   %esi
+  8022b8:	53                   	push   %ebx
+  8022b9:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8022bc:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8022c3:	78 36                	js     8022fb <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  8022c5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8022cc:	74 79                	je     802347 <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  8022ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022d6:	b8 23 00 00 00       	mov    $0x23,%eax
+  8022db:	89 cb                	mov    %ecx,%ebx
+  8022dd:	89 cf                	mov    %ecx,%edi
+  8022df:	89 ce                	mov    %ecx,%esi
+  8022e1:	55                   	push   %ebp
+  8022e2:	68 eb 22 80 00       	push   $0x8022eb
+  8022e7:	89 e5                	mov    %esp,%ebp
+  8022e9:	0f 34                	sysenter
+  8022eb:	83 c4 04             	add    $0x4,%esp
+  8022ee:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8022ef:	85 c0                	test   %eax,%eax
+  8022f1:	7f 6b                	jg     80235e <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  8022f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022f6:	5b                   	pop    %ebx
+  8022f7:	5e                   	pop    %esi
+  8022f8:	5f                   	pop    %edi
+  8022f9:	5d                   	pop    %ebp
+  8022fa:	c3                   	ret
+  8022fb:	b8 01 00 00 00       	mov    $0x1,%eax
+  802300:	0f a2                	cpuid
+		return 0;
+  802302:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802307:	f6 c6 08             	test   $0x8,%dh
+  80230a:	74 15                	je     802321 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80230c:	89 c2                	mov    %eax,%edx
+  80230e:	c1 ea 08             	shr    $0x8,%edx
+  802311:	83 e2 0f             	and    $0xf,%edx
+  802314:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802319:	83 fa 06             	cmp    $0x6,%edx
+  80231c:	74 0e                	je     80232c <sys_ep_destroy+0x79>
+  80231e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802321:	0f b6 c9             	movzbl %cl,%ecx
+  802324:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80232a:	eb 99                	jmp    8022c5 <sys_ep_destroy+0x12>
+  80232c:	89 c2                	mov    %eax,%edx
+  80232e:	c1 ea 04             	shr    $0x4,%edx
+  802331:	83 e2 0f             	and    $0xf,%edx
+  802334:	83 fa 02             	cmp    $0x2,%edx
+  802337:	77 e5                	ja     80231e <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  802339:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80233c:	83 f8 02             	cmp    $0x2,%eax
+  80233f:	0f 97 c1             	seta   %cl
+  802342:	0f b6 c9             	movzbl %cl,%ecx
+  802345:	eb d7                	jmp    80231e <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  802347:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80234c:	b8 23 00 00 00       	mov    $0x23,%eax
+  802351:	8b 55 08             	mov    0x8(%ebp),%edx
+  802354:	89 cb                	mov    %ecx,%ebx
+  802356:	89 cf                	mov    %ecx,%edi
+  802358:	89 ce                	mov    %ecx,%esi
+  80235a:	cd 30                	int    $0x30
+  80235c:	eb 91                	jmp    8022ef <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80235e:	83 ec 0c             	sub    $0xc,%esp
+  802361:	50                   	push   %eax
+  802362:	6a 23                	push   $0x23
+  802364:	68 19 2f 80 00       	push   $0x802f19
+  802369:	6a 4a                	push   $0x4a
+  80236b:	68 36 2f 80 00       	push   $0x802f36
+  802370:	e8 3d 06 00 00       	call   8029b2 <_panic>
+
+00802375 <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  802375:	55                   	push   %ebp
+  802376:	89 e5                	mov    %esp,%ebp
+  802378:	57                   	push   %edi
+  802379:	56                   	push   %esi
+  80237a:	53                   	push   %ebx
+  80237b:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80237e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802385:	78 37                	js     8023be <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  802387:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80238e:	74 7a                	je     80240a <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  802390:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802395:	8b 55 08             	mov    0x8(%ebp),%edx
+  802398:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80239b:	b8 24 00 00 00       	mov    $0x24,%eax
+  8023a0:	89 df                	mov    %ebx,%edi
+  8023a2:	89 de                	mov    %ebx,%esi
+  8023a4:	55                   	push   %ebp
+  8023a5:	68 ae 23 80 00       	push   $0x8023ae
+  8023aa:	89 e5                	mov    %esp,%ebp
+  8023ac:	0f 34                	sysenter
+  8023ae:	83 c4 04             	add    $0x4,%esp
+  8023b1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8023b2:	85 c0                	test   %eax,%eax
+  8023b4:	7f 6c                	jg     802422 <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  8023b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023b9:	5b                   	pop    %ebx
+  8023ba:	5e                   	pop    %esi
+  8023bb:	5f                   	pop    %edi
+  8023bc:	5d                   	pop    %ebp
+  8023bd:	c3                   	ret
+  8023be:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023c3:	0f a2                	cpuid
+		return 0;
+  8023c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8023ca:	f6 c6 08             	test   $0x8,%dh
+  8023cd:	74 15                	je     8023e4 <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023cf:	89 c2                	mov    %eax,%edx
+  8023d1:	c1 ea 08             	shr    $0x8,%edx
+  8023d4:	83 e2 0f             	and    $0xf,%edx
+  8023d7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8023dc:	83 fa 06             	cmp    $0x6,%edx
+  8023df:	74 0e                	je     8023ef <sys_ep_grant+0x7a>
+  8023e1:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8023e4:	0f b6 c9             	movzbl %cl,%ecx
+  8023e7:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8023ed:	eb 98                	jmp    802387 <sys_ep_grant+0x12>
+  8023ef:	89 c2                	mov    %eax,%edx
+  8023f1:	c1 ea 04             	shr    $0x4,%edx
+  8023f4:	83 e2 0f             	and    $0xf,%edx
+  8023f7:	83 fa 02             	cmp    $0x2,%edx
+  8023fa:	77 e5                	ja     8023e1 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  8023fc:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023ff:	83 f8 02             	cmp    $0x2,%eax
+  802402:	0f 97 c1             	seta   %cl
+  802405:	0f b6 c9             	movzbl %cl,%ecx
+  802408:	eb d7                	jmp    8023e1 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  80240a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80240f:	b8 24 00 00 00       	mov    $0x24,%eax
+  802414:	8b 55 08             	mov    0x8(%ebp),%edx
+  802417:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80241a:	89 df                	mov    %ebx,%edi
+  80241c:	89 de                	mov    %ebx,%esi
+  80241e:	cd 30                	int    $0x30
+  802420:	eb 90                	jmp    8023b2 <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802422:	83 ec 0c             	sub    $0xc,%esp
+  802425:	50                   	push   %eax
+  802426:	6a 24                	push   $0x24
+  802428:	68 19 2f 80 00       	push   $0x802f19
+  80242d:	6a 4a                	push   $0x4a
+  80242f:	68 36 2f 80 00       	push   $0x802f36
+  802434:	e8 79 05 00 00       	call   8029b2 <_panic>
+
+00802439 <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  802439:	55                   	push   %ebp
+  80243a:	89 e5                	mov    %esp,%ebp
+  80243c:	57                   	push   %edi
+  80243d:	56                   	push   %esi
+  80243e:	53                   	push   %ebx
+  80243f:	83 ec 20             	sub    $0x20,%esp
+  802442:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  802445:	8b 10                	mov    (%eax),%edx
+  802447:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  80244a:	8b 50 04             	mov    0x4(%eax),%edx
+  80244d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802450:	8b 50 08             	mov    0x8(%eax),%edx
+  802453:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  802456:	8b 50 0c             	mov    0xc(%eax),%edx
+  802459:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  80245c:	8b 40 10             	mov    0x10(%eax),%eax
+  80245f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  802462:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  802465:	8b 55 08             	mov    0x8(%ebp),%edx
+  802468:	b8 25 00 00 00       	mov    $0x25,%eax
+  80246d:	55                   	push   %ebp
+  80246e:	56                   	push   %esi
+  80246f:	8b 0e                	mov    (%esi),%ecx
+  802471:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802474:	8b 7e 08             	mov    0x8(%esi),%edi
+  802477:	8b 6e 10             	mov    0x10(%esi),%ebp
+  80247a:	8b 76 0c             	mov    0xc(%esi),%esi
+  80247d:	cd 30                	int    $0x30
+  80247f:	87 34 24             	xchg   %esi,(%esp)
+  802482:	89 0e                	mov    %ecx,(%esi)
+  802484:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802487:	89 7e 08             	mov    %edi,0x8(%esi)
+  80248a:	89 6e 10             	mov    %ebp,0x10(%esi)
+  80248d:	8f 46 0c             	pop    0xc(%esi)
+  802490:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  802491:	83 c4 20             	add    $0x20,%esp
+  802494:	5b                   	pop    %ebx
+  802495:	5e                   	pop    %esi
+  802496:	5f                   	pop    %edi
+  802497:	5d                   	pop    %ebp
+  802498:	c3                   	ret
+
+00802499 <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  802499:	55                   	push   %ebp
+  80249a:	89 e5                	mov    %esp,%ebp
+  80249c:	57                   	push   %edi
+  80249d:	56                   	push   %esi
+  80249e:	53                   	push   %ebx
+  80249f:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  8024a2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024a5:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  8024a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024aa:	b8 26 00 00 00       	mov    $0x26,%eax
+  8024af:	55                   	push   %ebp
+  8024b0:	56                   	push   %esi
+  8024b1:	8b 0e                	mov    (%esi),%ecx
+  8024b3:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8024b6:	8b 7e 08             	mov    0x8(%esi),%edi
+  8024b9:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8024bc:	8b 76 0c             	mov    0xc(%esi),%esi
+  8024bf:	cd 30                	int    $0x30
+  8024c1:	87 34 24             	xchg   %esi,(%esp)
+  8024c4:	89 0e                	mov    %ecx,(%esi)
+  8024c6:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8024c9:	89 7e 08             	mov    %edi,0x8(%esi)
+  8024cc:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8024cf:	8f 46 0c             	pop    0xc(%esi)
+  8024d2:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  8024d3:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  8024d7:	74 0f                	je     8024e8 <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  8024d9:	85 c0                	test   %eax,%eax
+  8024db:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024e0:	0f 48 d1             	cmovs  %ecx,%edx
+  8024e3:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8024e6:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  8024e8:	5b                   	pop    %ebx
+  8024e9:	5e                   	pop    %esi
+  8024ea:	5f                   	pop    %edi
+  8024eb:	5d                   	pop    %ebp
+  8024ec:	c3                   	ret
+
+008024ed <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  8024ed:	55                   	push   %ebp
+  8024ee:	89 e5                	mov    %esp,%ebp
+  8024f0:	57                   	push   %edi
+  8024f1:	56                   	push   %esi
+  8024f2:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8024f3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8024fa:	78 2f                	js     80252b <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  8024fc:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802503:	74 72                	je     802577 <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  802505:	8b 55 08             	mov    0x8(%ebp),%edx
+  802508:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80250d:	b8 27 00 00 00       	mov    $0x27,%eax
+  802512:	89 cb                	mov    %ecx,%ebx
+  802514:	89 cf                	mov    %ecx,%edi
+  802516:	89 ce                	mov    %ecx,%esi
+  802518:	55                   	push   %ebp
+  802519:	68 22 25 80 00       	push   $0x802522
+  80251e:	89 e5                	mov    %esp,%ebp
+  802520:	0f 34                	sysenter
+  802522:	83 c4 04             	add    $0x4,%esp
+  802525:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  802526:	5b                   	pop    %ebx
+  802527:	5e                   	pop    %esi
+  802528:	5f                   	pop    %edi
+  802529:	5d                   	pop    %ebp
+  80252a:	c3                   	ret
+  80252b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802530:	0f a2                	cpuid
+		return 0;
+  802532:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802537:	f6 c6 08             	test   $0x8,%dh
+  80253a:	74 15                	je     802551 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80253c:	89 c2                	mov    %eax,%edx
+  80253e:	c1 ea 08             	shr    $0x8,%edx
+  802541:	83 e2 0f             	and    $0xf,%edx
+  802544:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802549:	83 fa 06             	cmp    $0x6,%edx
+  80254c:	74 0e                	je     80255c <sys_sysring_setup+0x6f>
+  80254e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802551:	0f b6 c9             	movzbl %cl,%ecx
+  802554:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80255a:	eb a0                	jmp    8024fc <sys_sysring_setup+0xf>
+  80255c:	89 c2                	mov    %eax,%edx
+  80255e:	c1 ea 04             	shr    $0x4,%edx
+  802561:	83 e2 0f             	and    $0xf,%edx
+  802564:	83 fa 02             	cmp    $0x2,%edx
+  802567:	77 e5                	ja     80254e <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  802569:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80256c:	83 f8 02             	cmp    $0x2,%eax
+  80256f:	0f 97 c1             	seta   %cl
+  802572:	0f b6 c9             	movzbl %cl,%ecx
+  802575:	eb d7                	jmp    80254e <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  802577:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80257c:	b8 27 00 00 00       	mov    $0x27,%eax
+  802581:	8b 55 08             	mov    0x8(%ebp),%edx
+  802584:	89 cb                	mov    %ecx,%ebx
+  802586:	89 cf                	mov    %ecx,%edi
+  802588:	89 ce                	mov    %ecx,%esi
+  80258a:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  80258c:	eb 98                	jmp    802526 <sys_sysring_setup+0x39>
+
+0080258e <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  80258e:	55                   	push   %ebp
+  80258f:	89 e5                	mov    %esp,%ebp
+  802591:	57                   	push   %edi
+  802592:	56                   	push   %esi
+  802593:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802594:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80259b:	78 2e                	js     8025cb <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  80259d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8025a4:	74 71                	je     802617 <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  8025a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025ab:	b8 28 00 00 00       	mov    $0x28,%eax
+  8025b0:	89 d1                	mov    %edx,%ecx
+  8025b2:	89 d3                	mov    %edx,%ebx
+  8025b4:	89 d7                	mov    %edx,%edi
+  8025b6:	89 d6                	mov    %edx,%esi
+  8025b8:	55                   	push   %ebp
+  8025b9:	68 c2 25 80 00       	push   $0x8025c2
+  8025be:	89 e5                	mov    %esp,%ebp
+  8025c0:	0f 34                	sysenter
+  8025c2:	83 c4 04             	add    $0x4,%esp
+  8025c5:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8025c6:	5b                   	pop    %ebx
+  8025c7:	5e                   	pop    %esi
+  8025c8:	5f                   	pop    %edi
+  8025c9:	5d                   	pop    %ebp
+  8025ca:	c3                   	ret
+  8025cb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025d0:	0f a2                	cpuid
+		return 0;
+  8025d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8025d7:	f6 c6 08             	test   $0x8,%dh
+  8025da:	74 15                	je     8025f1 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025dc:	89 c2                	mov    %eax,%edx
+  8025de:	c1 ea 08             	shr    $0x8,%edx
+  8025e1:	83 e2 0f             	and    $0xf,%edx
+  8025e4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8025e9:	83 fa 06             	cmp    $0x6,%edx
+  8025ec:	74 0e                	je     8025fc <sys_sysring_enter+0x6e>
+  8025ee:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8025f1:	0f b6 c9             	movzbl %cl,%ecx
+  8025f4:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8025fa:	eb a1                	jmp    80259d <sys_sysring_enter+0xf>
+  8025fc:	89 c2                	mov    %eax,%edx
+  8025fe:	c1 ea 04             	shr    $0x4,%edx
+  802601:	83 e2 0f             	and    $0xf,%edx
+  802604:	83 fa 02             	cmp    $0x2,%edx
+  802607:	77 e5                	ja     8025ee <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  802609:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80260c:	83 f8 02             	cmp    $0x2,%eax
+  80260f:	0f 97 c1             	seta   %cl
+  802612:	0f b6 c9             	movzbl %cl,%ecx
+  802615:	eb d7                	jmp    8025ee <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  802617:	ba 00 00 00 00       	mov    $0x0,%edx
+  80261c:	b8 28 00 00 00       	mov    $0x28,%eax
+  802621:	89 d1                	mov    %edx,%ecx
+  802623:	89 d3                	mov    %edx,%ebx
+  802625:	89 d7                	mov    %edx,%edi
+  802627:	89 d6                	mov    %edx,%esi
+  802629:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  80262b:	eb 99                	jmp    8025c6 <sys_sysring_enter+0x38>
+
+0080262d <uptime>:
+// with the TSC however long it is, as time_now() does in the kernel.
+// The kernel advances vd_uptime by the TSC too, so the result does not
+// go backwards when the next refresh comes.
+nanoseconds_t
+uptime(void)
+{
+  80262d:	55                   	push   %ebp
+  80262e:	89 e5                	mov    %esp,%ebp
+  802630:	57                   	push   %edi
+  802631:	56                   	push   %esi
+  802632:	53                   	push   %ebx
+  802633:	83 ec 2c             	sub    $0x2c,%esp
+  802636:	eb 02                	jmp    80263a <uptime+0xd>
+vdso_begin(const volatile struct vdso *vd)
+{
+	uint32_t seq;
+
+	while ((seq = vd->vd_seq) & 1)
+		asm volatile("pause");
+  802638:	f3 90                	pause
+	while ((seq = vd->vd_seq) & 1)
+  80263a:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  80263f:	a8 01                	test   $0x1,%al
+  802641:	75 f5                	jne    802638 <uptime+0xb>
+	uint64_t tick_tsc, tsc_per_tick, delta;
+	uint32_t seq;
+
+	do {
+		seq = vdso_begin(&vdso);
+		now = vdso.vd_uptime;
+  802643:	8b 1d 04 f0 ff ee    	mov    0xeefff004,%ebx
+  802649:	8b 35 08 f0 ff ee    	mov    0xeefff008,%esi
+  80264f:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802652:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+		ns_per_tick = vdso.vd_ns_per_tick;
+  802655:	8b 0d 0c f0 ff ee    	mov    0xeefff00c,%ecx
+  80265b:	8b 1d 10 f0 ff ee    	mov    0xeefff010,%ebx
+  802661:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  802664:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		tick_tsc = vdso.vd_tick_tsc;
+  802667:	8b 0d 14 f0 ff ee    	mov    0xeefff014,%ecx
+  80266d:	8b 1d 18 f0 ff ee    	mov    0xeefff018,%ebx
+		tsc_per_tick = vdso.vd_tsc_per_tick;
+  802673:	8b 35 1c f0 ff ee    	mov    0xeefff01c,%esi
+  802679:	8b 3d 20 f0 ff ee    	mov    0xeefff020,%edi
+
+static inline bool
+vdso_retry(const volatile struct vdso *vd, uint32_t seq)
+{
+	asm volatile("" : : : "memory");
+	return vd->vd_seq != seq;
+  80267f:	8b 15 00 f0 ff ee    	mov    0xeefff000,%edx
+	} while (vdso_retry(&vdso, seq));
+  802685:	39 c2                	cmp    %eax,%edx
+  802687:	75 b1                	jne    80263a <uptime+0xd>
+
+	if (tsc_per_tick) {
+  802689:	89 75 d0             	mov    %esi,-0x30(%ebp)
+  80268c:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  80268f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802692:	0b 45 d0             	or     -0x30(%ebp),%eax
+  802695:	74 7e                	je     802715 <uptime+0xe8>
+
+static inline uint64_t
+read_tsc(void)
+{
+	uint64_t tsc;
+	asm volatile("rdtsc" : "=A" (tsc));
+  802697:	0f 31                	rdtsc
+		delta = read_tsc() - tick_tsc;
+  802699:	29 c8                	sub    %ecx,%eax
+  80269b:	19 da                	sbb    %ebx,%edx
+		now += delta / tsc_per_tick * ns_per_tick
+  80269d:	57                   	push   %edi
+  80269e:	56                   	push   %esi
+  80269f:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8026a2:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8026a5:	52                   	push   %edx
+  8026a6:	50                   	push   %eax
+  8026a7:	e8 54 04 00 00       	call   802b00 <__udivdi3>
+  8026ac:	83 c4 10             	add    $0x10,%esp
+  8026af:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8026b2:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  8026b5:	0f af d1             	imul   %ecx,%edx
+  8026b8:	89 ce                	mov    %ecx,%esi
+  8026ba:	89 df                	mov    %ebx,%edi
+  8026bc:	0f af d8             	imul   %eax,%ebx
+  8026bf:	89 d9                	mov    %ebx,%ecx
+  8026c1:	01 d1                	add    %edx,%ecx
+  8026c3:	f7 e6                	mul    %esi
+  8026c5:	01 ca                	add    %ecx,%edx
+  8026c7:	89 d1                	mov    %edx,%ecx
+  8026c9:	89 c2                	mov    %eax,%edx
+  8026cb:	03 55 e0             	add    -0x20(%ebp),%edx
+  8026ce:	13 4d e4             	adc    -0x1c(%ebp),%ecx
+  8026d1:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8026d4:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+			+ delta % tsc_per_tick * ns_per_tick / tsc_per_tick;
+  8026d7:	ff 75 d4             	push   -0x2c(%ebp)
+  8026da:	ff 75 d0             	push   -0x30(%ebp)
+  8026dd:	ff 75 cc             	push   -0x34(%ebp)
+  8026e0:	ff 75 c8             	push   -0x38(%ebp)
+  8026e3:	e8 36 04 00 00       	call   802b1e <__umoddi3>
+  8026e8:	83 c4 10             	add    $0x10,%esp
+  8026eb:	0f af d6             	imul   %esi,%edx
+  8026ee:	89 f9                	mov    %edi,%ecx
+  8026f0:	0f af c8             	imul   %eax,%ecx
+  8026f3:	01 d1                	add    %edx,%ecx
+  8026f5:	f7 e6                	mul    %esi
+  8026f7:	01 ca                	add    %ecx,%edx
+  8026f9:	ff 75 d4             	push   -0x2c(%ebp)
+  8026fc:	ff 75 d0             	push   -0x30(%ebp)
+  8026ff:	52                   	push   %edx
+  802700:	50                   	push   %eax
+  802701:	e8 fa 03 00 00       	call   802b00 <__udivdi3>
+  802706:	83 c4 10             	add    $0x10,%esp
+		now += delta / tsc_per_tick * ns_per_tick
+  802709:	03 45 e0             	add    -0x20(%ebp),%eax
+  80270c:	13 55 e4             	adc    -0x1c(%ebp),%edx
+  80270f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802712:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	}
+	return now;
+}
+  802715:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802718:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80271b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80271e:	5b                   	pop    %ebx
+  80271f:	5e                   	pop    %esi
+  802720:	5f                   	pop    %edi
+  802721:	5d                   	pop    %ebp
+  802722:	c3                   	ret
+
+00802723 <nanosleep>:
+
+// Sleep in the kernel, on a futex word nobody wakes, until the timeout
+// runs out, rather than spinning through sys_yield.
+void
+nanosleep(nanoseconds_t nanoseconds)
+{
+  802723:	55                   	push   %ebp
+  802724:	89 e5                	mov    %esp,%ebp
+  802726:	57                   	push   %edi
+  802727:	56                   	push   %esi
+  802728:	53                   	push   %ebx
+  802729:	83 ec 1c             	sub    $0x1c,%esp
+  80272c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80272f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	volatile uint32_t word = 0;
+  802732:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	nanoseconds_t now, end;
+	int r;
+
+	now = uptime();
+  802739:	e8 ef fe ff ff       	call   80262d <uptime>
+	end = now + nanoseconds;
+  80273e:	01 c6                	add    %eax,%esi
+  802740:	11 d7                	adc    %edx,%edi
+	if (end < now)
+  802742:	39 c6                	cmp    %eax,%esi
+  802744:	89 fb                	mov    %edi,%ebx
+  802746:	19 d3                	sbb    %edx,%ebx
+  802748:	72 39                	jb     802783 <nanosleep+0x60>
+		panic("nanosleep: wrap");
+
+	while ((now = uptime()) < end)
+  80274a:	e8 de fe ff ff       	call   80262d <uptime>
+  80274f:	89 c1                	mov    %eax,%ecx
+  802751:	89 d3                	mov    %edx,%ebx
+  802753:	39 f0                	cmp    %esi,%eax
+  802755:	89 d0                	mov    %edx,%eax
+  802757:	19 f8                	sbb    %edi,%eax
+  802759:	73 3c                	jae    802797 <nanosleep+0x74>
+		if ((r = sys_futex_wait(&word, 0, end - now)) < 0
+  80275b:	89 f0                	mov    %esi,%eax
+  80275d:	89 fa                	mov    %edi,%edx
+  80275f:	29 c8                	sub    %ecx,%eax
+  802761:	19 da                	sbb    %ebx,%edx
+  802763:	52                   	push   %edx
+  802764:	50                   	push   %eax
+  802765:	6a 00                	push   $0x0
+  802767:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80276a:	50                   	push   %eax
+  80276b:	e8 51 f9 ff ff       	call   8020c1 <sys_futex_wait>
+		    && r != -E_TIMEOUT)
+  802770:	83 c4 10             	add    $0x10,%esp
+  802773:	83 f8 f3             	cmp    $0xfffffff3,%eax
+  802776:	74 d2                	je     80274a <nanosleep+0x27>
+  802778:	85 c0                	test   %eax,%eax
+  80277a:	79 ce                	jns    80274a <nanosleep+0x27>
+			sys_yield();
+  80277c:	e8 3f eb ff ff       	call   8012c0 <sys_yield>
+  802781:	eb c7                	jmp    80274a <nanosleep+0x27>
+		panic("nanosleep: wrap");
+  802783:	83 ec 04             	sub    $0x4,%esp
+  802786:	68 44 2f 80 00       	push   $0x802f44
+  80278b:	6a 2d                	push   $0x2d
+  80278d:	68 54 2f 80 00       	push   $0x802f54
+  802792:	e8 1b 02 00 00       	call   8029b2 <_panic>
+}
+  802797:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80279a:	5b                   	pop    %ebx
+  80279b:	5e                   	pop    %esi
+  80279c:	5f                   	pop    %edi
+  80279d:	5d                   	pop    %ebp
+  80279e:	c3                   	ret
+
+0080279f <sleep>:
+
+void
+sleep(seconds_t seconds)
+{
+  80279f:	55                   	push   %ebp
+  8027a0:	89 e5                	mov    %esp,%ebp
+  8027a2:	83 ec 10             	sub    $0x10,%esp
+	nanosleep(seconds * NANOSECONDS_PER_SECOND);
+  8027a5:	69 4d 0c 00 ca 9a 3b 	imul   $0x3b9aca00,0xc(%ebp),%ecx
+  8027ac:	b8 00 ca 9a 3b       	mov    $0x3b9aca00,%eax
+  8027b1:	f7 65 08             	mull   0x8(%ebp)
+  8027b4:	01 ca                	add    %ecx,%edx
+  8027b6:	52                   	push   %edx
+  8027b7:	50                   	push   %eax
+  8027b8:	e8 66 ff ff ff       	call   802723 <nanosleep>
+}
+  8027bd:	83 c4 10             	add    $0x10,%esp
+  8027c0:	c9                   	leave
+  8027c1:	c3                   	ret
+
+008027c2 <epoch_to_tm>:
+	return days[month];
+}
+
+// ignore leap seconds
+void epoch_to_tm(seconds_t epoch, struct tm *tm)
+{
+  8027c2:	55                   	push   %ebp
+  8027c3:	89 e5                	mov    %esp,%ebp
+  8027c5:	57                   	push   %edi
+  8027c6:	56                   	push   %esi
+  8027c7:	53                   	push   %ebx
+  8027c8:	83 ec 4c             	sub    $0x4c,%esp
+  8027cb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8027ce:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	int year, month, days, dsec;
+
+	days = epoch / 86400;
+  8027d1:	6a 00                	push   $0x0
+  8027d3:	68 80 51 01 00       	push   $0x15180
+  8027d8:	57                   	push   %edi
+  8027d9:	56                   	push   %esi
+  8027da:	e8 21 03 00 00       	call   802b00 <__udivdi3>
+  8027df:	83 c4 10             	add    $0x10,%esp
+  8027e2:	89 c3                	mov    %eax,%ebx
+	dsec = epoch % 86400;
+  8027e4:	6a 00                	push   $0x0
+  8027e6:	68 80 51 01 00       	push   $0x15180
+  8027eb:	57                   	push   %edi
+  8027ec:	56                   	push   %esi
+  8027ed:	e8 2c 03 00 00       	call   802b1e <__umoddi3>
+  8027f2:	83 c4 10             	add    $0x10,%esp
+  8027f5:	89 c1                	mov    %eax,%ecx
+
+	tm->tm_sec = dsec % 60;
+  8027f7:	b8 89 88 88 88       	mov    $0x88888889,%eax
+  8027fc:	f7 e9                	imul   %ecx
+  8027fe:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802801:	c1 f8 05             	sar    $0x5,%eax
+  802804:	89 cf                	mov    %ecx,%edi
+  802806:	c1 ff 1f             	sar    $0x1f,%edi
+  802809:	29 f8                	sub    %edi,%eax
+  80280b:	6b c0 3c             	imul   $0x3c,%eax,%eax
+  80280e:	89 ca                	mov    %ecx,%edx
+  802810:	29 c2                	sub    %eax,%edx
+  802812:	8b 45 10             	mov    0x10(%ebp),%eax
+  802815:	89 10                	mov    %edx,(%eax)
+	tm->tm_min = (dsec % 3600) / 60;
+  802817:	ba c5 b3 a2 91       	mov    $0x91a2b3c5,%edx
+  80281c:	89 c8                	mov    %ecx,%eax
+  80281e:	f7 ea                	imul   %edx
+  802820:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+  802823:	c1 fe 0b             	sar    $0xb,%esi
+  802826:	29 fe                	sub    %edi,%esi
+  802828:	69 c6 10 0e 00 00    	imul   $0xe10,%esi,%eax
+  80282e:	29 c1                	sub    %eax,%ecx
+  802830:	b8 89 88 88 88       	mov    $0x88888889,%eax
+  802835:	f7 e9                	imul   %ecx
+  802837:	01 ca                	add    %ecx,%edx
+  802839:	c1 fa 05             	sar    $0x5,%edx
+  80283c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80283f:	29 ca                	sub    %ecx,%edx
+  802841:	8b 45 10             	mov    0x10(%ebp),%eax
+  802844:	89 50 04             	mov    %edx,0x4(%eax)
+	tm->tm_hour = dsec / 3600;
+  802847:	89 70 08             	mov    %esi,0x8(%eax)
+	tm->tm_wday = (days + 4) % 7;
+  80284a:	8d 4b 04             	lea    0x4(%ebx),%ecx
+  80284d:	ba 93 24 49 92       	mov    $0x92492493,%edx
+  802852:	89 c8                	mov    %ecx,%eax
+  802854:	f7 ea                	imul   %edx
+  802856:	01 ca                	add    %ecx,%edx
+  802858:	c1 fa 02             	sar    $0x2,%edx
+  80285b:	89 c8                	mov    %ecx,%eax
+  80285d:	c1 f8 1f             	sar    $0x1f,%eax
+  802860:	29 c2                	sub    %eax,%edx
+  802862:	8d 04 d5 00 00 00 00 	lea    0x0(,%edx,8),%eax
+  802869:	29 d0                	sub    %edx,%eax
+  80286b:	29 c1                	sub    %eax,%ecx
+  80286d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802870:	89 48 18             	mov    %ecx,0x18(%eax)
+
+	for (year = 1970; days >= days_per_year(year); ++year)
+  802873:	b9 b2 07 00 00       	mov    $0x7b2,%ecx
+	return (year % 4 == 0) && !((year % 100 == 0) && (year % 400 != 0));
+  802878:	bf 00 00 00 00       	mov    $0x0,%edi
+	for (year = 1970; days >= days_per_year(year); ++year)
+  80287d:	eb 0e                	jmp    80288d <epoch_to_tm+0xcb>
+  80287f:	05 6d 01 00 00       	add    $0x16d,%eax
+  802884:	39 c3                	cmp    %eax,%ebx
+  802886:	7c 4c                	jl     8028d4 <epoch_to_tm+0x112>
+		days -= days_per_year(year);
+  802888:	29 c3                	sub    %eax,%ebx
+	for (year = 1970; days >= days_per_year(year); ++year)
+  80288a:	83 c1 01             	add    $0x1,%ecx
+	return (year % 4 == 0) && !((year % 100 == 0) && (year % 400 != 0));
+  80288d:	89 f8                	mov    %edi,%eax
+  80288f:	89 ce                	mov    %ecx,%esi
+  802891:	83 e6 03             	and    $0x3,%esi
+  802894:	75 e9                	jne    80287f <epoch_to_tm+0xbd>
+  802896:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+  80289b:	f7 e9                	imul   %ecx
+  80289d:	c1 fa 05             	sar    $0x5,%edx
+  8028a0:	89 c8                	mov    %ecx,%eax
+  8028a2:	c1 f8 1f             	sar    $0x1f,%eax
+  8028a5:	29 c2                	sub    %eax,%edx
+  8028a7:	6b d2 64             	imul   $0x64,%edx,%edx
+  8028aa:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028af:	39 d1                	cmp    %edx,%ecx
+  8028b1:	75 cc                	jne    80287f <epoch_to_tm+0xbd>
+  8028b3:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+  8028b8:	f7 e9                	imul   %ecx
+  8028ba:	c1 fa 07             	sar    $0x7,%edx
+  8028bd:	89 c8                	mov    %ecx,%eax
+  8028bf:	c1 f8 1f             	sar    $0x1f,%eax
+  8028c2:	29 c2                	sub    %eax,%edx
+  8028c4:	69 d2 90 01 00 00    	imul   $0x190,%edx,%edx
+  8028ca:	39 d1                	cmp    %edx,%ecx
+  8028cc:	0f 94 c0             	sete   %al
+  8028cf:	0f b6 c0             	movzbl %al,%eax
+  8028d2:	eb ab                	jmp    80287f <epoch_to_tm+0xbd>
+	tm->tm_year = year - 1900;
+  8028d4:	8d 81 94 f8 ff ff    	lea    -0x76c(%ecx),%eax
+  8028da:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8028dd:	89 47 14             	mov    %eax,0x14(%edi)
+	tm->tm_yday = days;
+  8028e0:	89 5f 1c             	mov    %ebx,0x1c(%edi)
+	return (year % 4 == 0) && !((year % 100 == 0) && (year % 400 != 0));
+  8028e3:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+  8028e8:	89 c8                	mov    %ecx,%eax
+  8028ea:	f7 ea                	imul   %edx
+  8028ec:	89 d7                	mov    %edx,%edi
+  8028ee:	c1 ff 07             	sar    $0x7,%edi
+  8028f1:	89 c8                	mov    %ecx,%eax
+  8028f3:	c1 f8 1f             	sar    $0x1f,%eax
+  8028f6:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  8028f9:	29 c7                	sub    %eax,%edi
+  8028fb:	69 ff 90 01 00 00    	imul   $0x190,%edi,%edi
+  802901:	39 f9                	cmp    %edi,%ecx
+  802903:	0f 94 c0             	sete   %al
+  802906:	0f b6 c0             	movzbl %al,%eax
+  802909:	89 c7                	mov    %eax,%edi
+  80290b:	c1 fa 05             	sar    $0x5,%edx
+  80290e:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  802911:	29 c2                	sub    %eax,%edx
+  802913:	6b d2 64             	imul   $0x64,%edx,%edx
+  802916:	39 d1                	cmp    %edx,%ecx
+  802918:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80291d:	0f 44 cf             	cmove  %edi,%ecx
+
+	for (month = 0; days >= days_per_month(year, month); ++month)
+  802920:	b8 00 00 00 00       	mov    $0x0,%eax
+		return 29;
+  802925:	bf 1d 00 00 00       	mov    $0x1d,%edi
+	for (month = 0; days >= days_per_month(year, month); ++month)
+  80292a:	eb 0d                	jmp    802939 <epoch_to_tm+0x177>
+	return days[month];
+  80292c:	8b 54 85 b8          	mov    -0x48(%ebp,%eax,4),%edx
+	for (month = 0; days >= days_per_month(year, month); ++month)
+  802930:	39 d3                	cmp    %edx,%ebx
+  802932:	7c 6a                	jl     80299e <epoch_to_tm+0x1dc>
+		days -= days_per_month(year, month);
+  802934:	29 d3                	sub    %edx,%ebx
+	for (month = 0; days >= days_per_month(year, month); ++month)
+  802936:	83 c0 01             	add    $0x1,%eax
+	int days[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  802939:	c7 45 b8 1f 00 00 00 	movl   $0x1f,-0x48(%ebp)
+  802940:	c7 45 bc 1c 00 00 00 	movl   $0x1c,-0x44(%ebp)
+  802947:	c7 45 c0 1f 00 00 00 	movl   $0x1f,-0x40(%ebp)
+  80294e:	c7 45 c4 1e 00 00 00 	movl   $0x1e,-0x3c(%ebp)
+  802955:	c7 45 c8 1f 00 00 00 	movl   $0x1f,-0x38(%ebp)
+  80295c:	c7 45 cc 1e 00 00 00 	movl   $0x1e,-0x34(%ebp)
+  802963:	c7 45 d0 1f 00 00 00 	movl   $0x1f,-0x30(%ebp)
+  80296a:	c7 45 d4 1f 00 00 00 	movl   $0x1f,-0x2c(%ebp)
+  802971:	c7 45 d8 1e 00 00 00 	movl   $0x1e,-0x28(%ebp)
+  802978:	c7 45 dc 1f 00 00 00 	movl   $0x1f,-0x24(%ebp)
+  80297f:	c7 45 e0 1e 00 00 00 	movl   $0x1e,-0x20(%ebp)
+  802986:	c7 45 e4 1f 00 00 00 	movl   $0x1f,-0x1c(%ebp)
+	return (year % 4 == 0) && !((year % 100 == 0) && (year % 400 != 0));
+  80298d:	85 f6                	test   %esi,%esi
+  80298f:	75 9b                	jne    80292c <epoch_to_tm+0x16a>
+	if (isleap(year) && month == 1)
+  802991:	83 f8 01             	cmp    $0x1,%eax
+  802994:	75 96                	jne    80292c <epoch_to_tm+0x16a>
+		return 29;
+  802996:	89 fa                	mov    %edi,%edx
+	if (isleap(year) && month == 1)
+  802998:	84 c9                	test   %cl,%cl
+  80299a:	74 90                	je     80292c <epoch_to_tm+0x16a>
+  80299c:	eb 92                	jmp    802930 <epoch_to_tm+0x16e>
+	tm->tm_mon = month;
+  80299e:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8029a1:	89 47 10             	mov    %eax,0x10(%edi)
+	tm->tm_mday = days + 1;
+  8029a4:	83 c3 01             	add    $0x1,%ebx
+  8029a7:	89 5f 0c             	mov    %ebx,0xc(%edi)
+}
+  8029aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029ad:	5b                   	pop    %ebx
+  8029ae:	5e                   	pop    %esi
+  8029af:	5f                   	pop    %edi
+  8029b0:	5d                   	pop    %ebp
+  8029b1:	c3                   	ret
+
+008029b2 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8029b2:	55                   	push   %ebp
+  8029b3:	89 e5                	mov    %esp,%ebp
+  8029b5:	57                   	push   %edi
+  8029b6:	56                   	push   %esi
+  8029b7:	53                   	push   %ebx
+  8029b8:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  8029be:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  8029c1:	8b 1d 00 30 80 00    	mov    0x803000,%ebx
+  8029c7:	e8 43 e5 ff ff       	call   800f0f <sys_getenvid>
+  8029cc:	83 ec 04             	sub    $0x4,%esp
+  8029cf:	ff 75 0c             	push   0xc(%ebp)
+  8029d2:	ff 75 08             	push   0x8(%ebp)
+  8029d5:	53                   	push   %ebx
+  8029d6:	50                   	push   %eax
+  8029d7:	68 60 2f 80 00       	push   $0x802f60
+  8029dc:	68 00 01 00 00       	push   $0x100
+  8029e1:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  8029e7:	56                   	push   %esi
+  8029e8:	e8 37 dd ff ff       	call   800724 <snprintf>
+  8029ed:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  8029ef:	83 c4 20             	add    $0x20,%esp
+  8029f2:	57                   	push   %edi
+  8029f3:	ff 75 10             	push   0x10(%ebp)
+  8029f6:	bf 00 01 00 00       	mov    $0x100,%edi
+  8029fb:	89 f8                	mov    %edi,%eax
+  8029fd:	29 d8                	sub    %ebx,%eax
+  8029ff:	50                   	push   %eax
+  802a00:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  802a03:	50                   	push   %eax
+  802a04:	e8 cd dc ff ff       	call   8006d6 <vsnprintf>
+  802a09:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  802a0b:	83 c4 0c             	add    $0xc,%esp
+  802a0e:	68 5a 2c 80 00       	push   $0x802c5a
+  802a13:	29 df                	sub    %ebx,%edi
+  802a15:	57                   	push   %edi
+  802a16:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  802a19:	50                   	push   %eax
+  802a1a:	e8 05 dd ff ff       	call   800724 <snprintf>
+	sys_cputs(buf, r);
+  802a1f:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  802a22:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  802a24:	53                   	push   %ebx
+  802a25:	56                   	push   %esi
+  802a26:	e8 e6 e2 ff ff       	call   800d11 <sys_cputs>
+  802a2b:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802a2e:	cc                   	int3
+	while (1)
+  802a2f:	eb fd                	jmp    802a2e <_panic+0x7c>
+
+00802a31 <dm>:
+  802a31:	55                   	push   %ebp
+  802a32:	57                   	push   %edi
+  802a33:	56                   	push   %esi
+  802a34:	53                   	push   %ebx
+  802a35:	83 ec 24             	sub    $0x24,%esp
+  802a38:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802a3c:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802a40:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802a44:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802a48:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802a4c:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802a50:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802a54:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a59:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a5e:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802a63:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802a6a:	00 
+  802a6b:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802a72:	00 
+  802a73:	89 fb                	mov    %edi,%ebx
+  802a75:	eb 08                	jmp    802a7f <dm+0x4e>
+  802a77:	83 e9 01             	sub    $0x1,%ecx
+  802a7a:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802a7d:	74 68                	je     802ae7 <dm+0xb6>
+  802a7f:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802a83:	01 c0                	add    %eax,%eax
+  802a85:	89 c6                	mov    %eax,%esi
+  802a87:	89 d7                	mov    %edx,%edi
+  802a89:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802a8d:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802a91:	0f ad d0             	shrd   %cl,%edx,%eax
+  802a94:	d3 ea                	shr    %cl,%edx
+  802a96:	f6 c1 20             	test   $0x20,%cl
+  802a99:	74 04                	je     802a9f <dm+0x6e>
+  802a9b:	89 d0                	mov    %edx,%eax
+  802a9d:	31 d2                	xor    %edx,%edx
+  802a9f:	83 e0 01             	and    $0x1,%eax
+  802aa2:	89 04 24             	mov    %eax,(%esp)
+  802aa5:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802aac:	00 
+  802aad:	8b 04 24             	mov    (%esp),%eax
+  802ab0:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802ab4:	09 f0                	or     %esi,%eax
+  802ab6:	09 fa                	or     %edi,%edx
+  802ab8:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802abc:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802ac0:	39 f0                	cmp    %esi,%eax
+  802ac2:	89 d5                	mov    %edx,%ebp
+  802ac4:	19 fd                	sbb    %edi,%ebp
+  802ac6:	72 af                	jb     802a77 <dm+0x46>
+  802ac8:	29 f0                	sub    %esi,%eax
+  802aca:	19 fa                	sbb    %edi,%edx
+  802acc:	89 cf                	mov    %ecx,%edi
+  802ace:	c1 ef 05             	shr    $0x5,%edi
+  802ad1:	83 e7 01             	and    $0x1,%edi
+  802ad4:	89 fe                	mov    %edi,%esi
+  802ad6:	83 f6 01             	xor    $0x1,%esi
+  802ad9:	d3 e6                	shl    %cl,%esi
+  802adb:	d3 e7                	shl    %cl,%edi
+  802add:	09 74 24 18          	or     %esi,0x18(%esp)
+  802ae1:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802ae5:	eb 90                	jmp    802a77 <dm+0x46>
+  802ae7:	85 db                	test   %ebx,%ebx
+  802ae9:	74 05                	je     802af0 <dm+0xbf>
+  802aeb:	89 03                	mov    %eax,(%ebx)
+  802aed:	89 53 04             	mov    %edx,0x4(%ebx)
+  802af0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802af4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802af8:	83 c4 24             	add    $0x24,%esp
+  802afb:	5b                   	pop    %ebx
+  802afc:	5e                   	pop    %esi
+  802afd:	5f                   	pop    %edi
+  802afe:	5d                   	pop    %ebp
+  802aff:	c3                   	ret
+
+00802b00 <__udivdi3>:
+  802b00:	83 ec 08             	sub    $0x8,%esp
+  802b03:	6a 00                	push   $0x0
+  802b05:	ff 74 24 1c          	push   0x1c(%esp)
+  802b09:	ff 74 24 1c          	push   0x1c(%esp)
+  802b0d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802b11:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802b15:	e8 17 ff ff ff       	call   802a31 <dm>
+  802b1a:	83 c4 14             	add    $0x14,%esp
+  802b1d:	c3                   	ret
+
+00802b1e <__umoddi3>:
+  802b1e:	83 ec 18             	sub    $0x18,%esp
+  802b21:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802b25:	50                   	push   %eax
+  802b26:	ff 74 24 2c          	push   0x2c(%esp)
+  802b2a:	ff 74 24 2c          	push   0x2c(%esp)
+  802b2e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802b32:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802b36:	e8 f6 fe ff ff       	call   802a31 <dm>
+  802b3b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802b3f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802b43:	83 c4 24             	add    $0x24,%esp
+  802b46:	c3                   	ret
+
+00802b47 <__divdi3>:
+  802b47:	53                   	push   %ebx
+  802b48:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802b4c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802b50:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  802b54:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  802b58:	85 d2                	test   %edx,%edx
+  802b5a:	78 15                	js     802b71 <__divdi3+0x2a>
+  802b5c:	85 db                	test   %ebx,%ebx
+  802b5e:	78 34                	js     802b94 <__divdi3+0x4d>
+  802b60:	83 ec 04             	sub    $0x4,%esp
+  802b63:	6a 00                	push   $0x0
+  802b65:	53                   	push   %ebx
+  802b66:	51                   	push   %ecx
+  802b67:	e8 c5 fe ff ff       	call   802a31 <dm>
+  802b6c:	83 c4 10             	add    $0x10,%esp
+  802b6f:	eb 21                	jmp    802b92 <__divdi3+0x4b>
+  802b71:	f7 d8                	neg    %eax
+  802b73:	83 d2 00             	adc    $0x0,%edx
+  802b76:	f7 da                	neg    %edx
+  802b78:	85 db                	test   %ebx,%ebx
+  802b7a:	78 30                	js     802bac <__divdi3+0x65>
+  802b7c:	83 ec 04             	sub    $0x4,%esp
+  802b7f:	6a 00                	push   $0x0
+  802b81:	53                   	push   %ebx
+  802b82:	51                   	push   %ecx
+  802b83:	e8 a9 fe ff ff       	call   802a31 <dm>
+  802b88:	83 c4 10             	add    $0x10,%esp
+  802b8b:	f7 d8                	neg    %eax
+  802b8d:	83 d2 00             	adc    $0x0,%edx
+  802b90:	f7 da                	neg    %edx
+  802b92:	5b                   	pop    %ebx
+  802b93:	c3                   	ret
+  802b94:	83 ec 04             	sub    $0x4,%esp
+  802b97:	6a 00                	push   $0x0
+  802b99:	f7 d9                	neg    %ecx
+  802b9b:	83 d3 00             	adc    $0x0,%ebx
+  802b9e:	f7 db                	neg    %ebx
+  802ba0:	53                   	push   %ebx
+  802ba1:	51                   	push   %ecx
+  802ba2:	e8 8a fe ff ff       	call   802a31 <dm>
+  802ba7:	83 c4 10             	add    $0x10,%esp
+  802baa:	eb df                	jmp    802b8b <__divdi3+0x44>
+  802bac:	83 ec 04             	sub    $0x4,%esp
+  802baf:	6a 00                	push   $0x0
+  802bb1:	f7 d9                	neg    %ecx
+  802bb3:	83 d3 00             	adc    $0x0,%ebx
+  802bb6:	f7 db                	neg    %ebx
+  802bb8:	53                   	push   %ebx
+  802bb9:	51                   	push   %ecx
+  802bba:	e8 72 fe ff ff       	call   802a31 <dm>
+  802bbf:	83 c4 10             	add    $0x10,%esp
+  802bc2:	eb ce                	jmp    802b92 <__divdi3+0x4b>
+
+00802bc4 <__moddi3>:
+  802bc4:	55                   	push   %ebp
+  802bc5:	57                   	push   %edi
+  802bc6:	56                   	push   %esi
+  802bc7:	53                   	push   %ebx
+  802bc8:	83 ec 18             	sub    $0x18,%esp
+  802bcb:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802bcf:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802bd3:	89 f1                	mov    %esi,%ecx
+  802bd5:	f7 d9                	neg    %ecx
+  802bd7:	89 da                	mov    %ebx,%edx
+  802bd9:	83 d2 00             	adc    $0x0,%edx
+  802bdc:	f7 da                	neg    %edx
+  802bde:	0f 48 ce             	cmovs  %esi,%ecx
+  802be1:	0f 48 d3             	cmovs  %ebx,%edx
+  802be4:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802be8:	50                   	push   %eax
+  802be9:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802bed:	f7 de                	neg    %esi
+  802bef:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802bf3:	83 d0 00             	adc    $0x0,%eax
+  802bf6:	f7 d8                	neg    %eax
+  802bf8:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802bfd:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802c02:	50                   	push   %eax
+  802c03:	56                   	push   %esi
+  802c04:	89 c8                	mov    %ecx,%eax
+  802c06:	e8 26 fe ff ff       	call   802a31 <dm>
+  802c0b:	83 c4 10             	add    $0x10,%esp
+  802c0e:	85 db                	test   %ebx,%ebx
+  802c10:	78 10                	js     802c22 <__moddi3+0x5e>
+  802c12:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802c16:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802c1a:	83 c4 14             	add    $0x14,%esp
+  802c1d:	5b                   	pop    %ebx
+  802c1e:	5e                   	pop    %esi
+  802c1f:	5f                   	pop    %edi
+  802c20:	5d                   	pop    %ebp
+  802c21:	c3                   	ret
+  802c22:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802c26:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802c2a:	f7 d8                	neg    %eax
+  802c2c:	83 d2 00             	adc    $0x0,%edx
+  802c2f:	f7 da                	neg    %edx
+  802c31:	eb e7                	jmp    802c1a <__moddi3+0x56>
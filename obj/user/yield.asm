@@ -0,0 +1,5174 @@
+
+obj/user/yield:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 69 00 00 00       	call   80009a <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+	int i;
+
+	cprintf("Hello, I am environment %08x.\n", thisenv->env_id);
+  80003a:	a1 08 30 80 00       	mov    0x803008,%eax
+  80003f:	8b 40 48             	mov    0x48(%eax),%eax
+  800042:	50                   	push   %eax
+  800043:	68 c0 28 80 00       	push   $0x8028c0
+  800048:	e8 3d 01 00 00       	call   80018a <cprintf>
+  80004d:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < 5; i++) {
+  800050:	bb 00 00 00 00       	mov    $0x0,%ebx
+		sys_yield();
+  800055:	e8 65 12 00 00       	call   8012bf <sys_yield>
+		cprintf("Back in environment %08x, iteration %d.\n",
+			thisenv->env_id, i);
+  80005a:	a1 08 30 80 00       	mov    0x803008,%eax
+  80005f:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("Back in environment %08x, iteration %d.\n",
+  800062:	83 ec 04             	sub    $0x4,%esp
+  800065:	53                   	push   %ebx
+  800066:	50                   	push   %eax
+  800067:	68 e0 28 80 00       	push   $0x8028e0
+  80006c:	e8 19 01 00 00       	call   80018a <cprintf>
+	for (i = 0; i < 5; i++) {
+  800071:	83 c3 01             	add    $0x1,%ebx
+  800074:	83 c4 10             	add    $0x10,%esp
+  800077:	83 fb 05             	cmp    $0x5,%ebx
+  80007a:	75 d9                	jne    800055 <umain+0x22>
+	}
+	cprintf("All done in environment %08x.\n", thisenv->env_id);
+  80007c:	a1 08 30 80 00       	mov    0x803008,%eax
+  800081:	8b 40 48             	mov    0x48(%eax),%eax
+  800084:	83 ec 08             	sub    $0x8,%esp
+  800087:	50                   	push   %eax
+  800088:	68 0c 29 80 00       	push   $0x80290c
+  80008d:	e8 f8 00 00 00       	call   80018a <cprintf>
+}
+  800092:	83 c4 10             	add    $0x10,%esp
+  800095:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800098:	c9                   	leave
+  800099:	c3                   	ret
+
+0080009a <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80009a:	55                   	push   %ebp
+  80009b:	89 e5                	mov    %esp,%ebp
+  80009d:	56                   	push   %esi
+  80009e:	53                   	push   %ebx
+  80009f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000a2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  8000a5:	e8 64 0e 00 00       	call   800f0e <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  8000aa:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000af:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  8000b5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000ba:	a3 08 30 80 00       	mov    %eax,0x803008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000bf:	85 db                	test   %ebx,%ebx
+  8000c1:	7e 07                	jle    8000ca <libmain+0x30>
+		binaryname = argv[0];
+  8000c3:	8b 06                	mov    (%esi),%eax
+  8000c5:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  8000ca:	83 ec 08             	sub    $0x8,%esp
+  8000cd:	56                   	push   %esi
+  8000ce:	53                   	push   %ebx
+  8000cf:	e8 5f ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000d4:	e8 0a 00 00 00       	call   8000e3 <exit>
+}
+  8000d9:	83 c4 10             	add    $0x10,%esp
+  8000dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000df:	5b                   	pop    %ebx
+  8000e0:	5e                   	pop    %esi
+  8000e1:	5d                   	pop    %ebp
+  8000e2:	c3                   	ret
+
+008000e3 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000e3:	55                   	push   %ebp
+  8000e4:	89 e5                	mov    %esp,%ebp
+  8000e6:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  8000e9:	6a 00                	push   $0x0
+  8000eb:	e8 5c 0d 00 00       	call   800e4c <sys_env_destroy>
+}
+  8000f0:	83 c4 10             	add    $0x10,%esp
+  8000f3:	c9                   	leave
+  8000f4:	c3                   	ret
+
+008000f5 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000f5:	55                   	push   %ebp
+  8000f6:	89 e5                	mov    %esp,%ebp
+  8000f8:	53                   	push   %ebx
+  8000f9:	83 ec 04             	sub    $0x4,%esp
+  8000fc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8000ff:	8b 13                	mov    (%ebx),%edx
+  800101:	8d 42 01             	lea    0x1(%edx),%eax
+  800104:	89 03                	mov    %eax,(%ebx)
+  800106:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800109:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80010d:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800112:	74 09                	je     80011d <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800114:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800118:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80011b:	c9                   	leave
+  80011c:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80011d:	83 ec 08             	sub    $0x8,%esp
+  800120:	68 ff 00 00 00       	push   $0xff
+  800125:	8d 43 08             	lea    0x8(%ebx),%eax
+  800128:	50                   	push   %eax
+  800129:	e8 e2 0b 00 00       	call   800d10 <sys_cputs>
+		b->idx = 0;
+  80012e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800134:	83 c4 10             	add    $0x10,%esp
+  800137:	eb db                	jmp    800114 <putch+0x1f>
+
+00800139 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800139:	55                   	push   %ebp
+  80013a:	89 e5                	mov    %esp,%ebp
+  80013c:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800142:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800149:	00 00 00 
+	b.cnt = 0;
+  80014c:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800153:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800156:	ff 75 0c             	push   0xc(%ebp)
+  800159:	ff 75 08             	push   0x8(%ebp)
+  80015c:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800162:	50                   	push   %eax
+  800163:	68 f5 00 80 00       	push   $0x8000f5
+  800168:	e8 14 01 00 00       	call   800281 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80016d:	83 c4 08             	add    $0x8,%esp
+  800170:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800176:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80017c:	50                   	push   %eax
+  80017d:	e8 8e 0b 00 00       	call   800d10 <sys_cputs>
+
+	return b.cnt;
+}
+  800182:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800188:	c9                   	leave
+  800189:	c3                   	ret
+
+0080018a <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80018a:	55                   	push   %ebp
+  80018b:	89 e5                	mov    %esp,%ebp
+  80018d:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800190:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800193:	50                   	push   %eax
+  800194:	ff 75 08             	push   0x8(%ebp)
+  800197:	e8 9d ff ff ff       	call   800139 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80019c:	c9                   	leave
+  80019d:	c3                   	ret
+
+0080019e <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80019e:	55                   	push   %ebp
+  80019f:	89 e5                	mov    %esp,%ebp
+  8001a1:	57                   	push   %edi
+  8001a2:	56                   	push   %esi
+  8001a3:	53                   	push   %ebx
+  8001a4:	83 ec 1c             	sub    $0x1c,%esp
+  8001a7:	89 c7                	mov    %eax,%edi
+  8001a9:	89 d6                	mov    %edx,%esi
+  8001ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001ae:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001b1:	89 d1                	mov    %edx,%ecx
+  8001b3:	89 c2                	mov    %eax,%edx
+  8001b5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001b8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001bb:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001be:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001c1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001c4:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001cb:	39 c2                	cmp    %eax,%edx
+  8001cd:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001d0:	72 3e                	jb     800210 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001d2:	83 ec 0c             	sub    $0xc,%esp
+  8001d5:	ff 75 18             	push   0x18(%ebp)
+  8001d8:	83 eb 01             	sub    $0x1,%ebx
+  8001db:	53                   	push   %ebx
+  8001dc:	50                   	push   %eax
+  8001dd:	83 ec 08             	sub    $0x8,%esp
+  8001e0:	ff 75 e4             	push   -0x1c(%ebp)
+  8001e3:	ff 75 e0             	push   -0x20(%ebp)
+  8001e6:	ff 75 dc             	push   -0x24(%ebp)
+  8001e9:	ff 75 d8             	push   -0x28(%ebp)
+  8001ec:	e8 89 25 00 00       	call   80277a <__udivdi3>
+  8001f1:	83 c4 18             	add    $0x18,%esp
+  8001f4:	52                   	push   %edx
+  8001f5:	50                   	push   %eax
+  8001f6:	89 f2                	mov    %esi,%edx
+  8001f8:	89 f8                	mov    %edi,%eax
+  8001fa:	e8 9f ff ff ff       	call   80019e <printnum>
+  8001ff:	83 c4 20             	add    $0x20,%esp
+  800202:	eb 13                	jmp    800217 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800204:	83 ec 08             	sub    $0x8,%esp
+  800207:	56                   	push   %esi
+  800208:	ff 75 18             	push   0x18(%ebp)
+  80020b:	ff d7                	call   *%edi
+  80020d:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800210:	83 eb 01             	sub    $0x1,%ebx
+  800213:	85 db                	test   %ebx,%ebx
+  800215:	7f ed                	jg     800204 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800217:	83 ec 08             	sub    $0x8,%esp
+  80021a:	56                   	push   %esi
+  80021b:	83 ec 04             	sub    $0x4,%esp
+  80021e:	ff 75 e4             	push   -0x1c(%ebp)
+  800221:	ff 75 e0             	push   -0x20(%ebp)
+  800224:	ff 75 dc             	push   -0x24(%ebp)
+  800227:	ff 75 d8             	push   -0x28(%ebp)
+  80022a:	e8 69 25 00 00       	call   802798 <__umoddi3>
+  80022f:	83 c4 14             	add    $0x14,%esp
+  800232:	0f be 80 35 29 80 00 	movsbl 0x802935(%eax),%eax
+  800239:	50                   	push   %eax
+  80023a:	ff d7                	call   *%edi
+}
+  80023c:	83 c4 10             	add    $0x10,%esp
+  80023f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800242:	5b                   	pop    %ebx
+  800243:	5e                   	pop    %esi
+  800244:	5f                   	pop    %edi
+  800245:	5d                   	pop    %ebp
+  800246:	c3                   	ret
+
+00800247 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800247:	55                   	push   %ebp
+  800248:	89 e5                	mov    %esp,%ebp
+  80024a:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80024d:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800251:	8b 10                	mov    (%eax),%edx
+  800253:	3b 50 04             	cmp    0x4(%eax),%edx
+  800256:	73 0a                	jae    800262 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800258:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80025b:	89 08                	mov    %ecx,(%eax)
+  80025d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800260:	88 02                	mov    %al,(%edx)
+}
+  800262:	5d                   	pop    %ebp
+  800263:	c3                   	ret
+
+00800264 <printfmt>:
+{
+  800264:	55                   	push   %ebp
+  800265:	89 e5                	mov    %esp,%ebp
+  800267:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80026a:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80026d:	50                   	push   %eax
+  80026e:	ff 75 10             	push   0x10(%ebp)
+  800271:	ff 75 0c             	push   0xc(%ebp)
+  800274:	ff 75 08             	push   0x8(%ebp)
+  800277:	e8 05 00 00 00       	call   800281 <vprintfmt>
+}
+  80027c:	83 c4 10             	add    $0x10,%esp
+  80027f:	c9                   	leave
+  800280:	c3                   	ret
+
+00800281 <vprintfmt>:
+{
+  800281:	55                   	push   %ebp
+  800282:	89 e5                	mov    %esp,%ebp
+  800284:	57                   	push   %edi
+  800285:	56                   	push   %esi
+  800286:	53                   	push   %ebx
+  800287:	83 ec 2c             	sub    $0x2c,%esp
+  80028a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80028d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800290:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800293:	eb 0a                	jmp    80029f <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800295:	83 ec 08             	sub    $0x8,%esp
+  800298:	53                   	push   %ebx
+  800299:	50                   	push   %eax
+  80029a:	ff d6                	call   *%esi
+  80029c:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80029f:	83 c7 01             	add    $0x1,%edi
+  8002a2:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002a6:	83 f8 25             	cmp    $0x25,%eax
+  8002a9:	74 0c                	je     8002b7 <vprintfmt+0x36>
+			if (ch == '\0')
+  8002ab:	85 c0                	test   %eax,%eax
+  8002ad:	75 e6                	jne    800295 <vprintfmt+0x14>
+}
+  8002af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002b2:	5b                   	pop    %ebx
+  8002b3:	5e                   	pop    %esi
+  8002b4:	5f                   	pop    %edi
+  8002b5:	5d                   	pop    %ebp
+  8002b6:	c3                   	ret
+		padc = ' ';
+  8002b7:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002bb:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002c2:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002c9:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8002d5:	8d 47 01             	lea    0x1(%edi),%eax
+  8002d8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002db:	0f b6 17             	movzbl (%edi),%edx
+  8002de:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002e1:	3c 55                	cmp    $0x55,%al
+  8002e3:	0f 87 cf 03 00 00    	ja     8006b8 <vprintfmt+0x437>
+  8002e9:	0f b6 c0             	movzbl %al,%eax
+  8002ec:	ff 24 85 20 2a 80 00 	jmp    *0x802a20(,%eax,4)
+  8002f3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8002f6:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002fa:	eb d9                	jmp    8002d5 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8002fc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002ff:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800303:	eb d0                	jmp    8002d5 <vprintfmt+0x54>
+  800305:	0f b6 d2             	movzbl %dl,%edx
+  800308:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80030b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800310:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800313:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800316:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80031a:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80031d:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800320:	83 f9 09             	cmp    $0x9,%ecx
+  800323:	77 55                	ja     80037a <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800325:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800328:	eb e9                	jmp    800313 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80032a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80032d:	8b 00                	mov    (%eax),%eax
+  80032f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800332:	8b 45 14             	mov    0x14(%ebp),%eax
+  800335:	8d 40 04             	lea    0x4(%eax),%eax
+  800338:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80033b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80033e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800342:	79 91                	jns    8002d5 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800344:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800347:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80034a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800351:	eb 82                	jmp    8002d5 <vprintfmt+0x54>
+			if (width < 0)
+  800353:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800356:	85 d2                	test   %edx,%edx
+  800358:	b8 00 00 00 00       	mov    $0x0,%eax
+  80035d:	0f 49 c2             	cmovns %edx,%eax
+  800360:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800363:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800366:	e9 6a ff ff ff       	jmp    8002d5 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80036b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80036e:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800375:	e9 5b ff ff ff       	jmp    8002d5 <vprintfmt+0x54>
+  80037a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80037d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800380:	eb bc                	jmp    80033e <vprintfmt+0xbd>
+			lflag++;
+  800382:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800385:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800388:	e9 48 ff ff ff       	jmp    8002d5 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80038d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800390:	8d 78 04             	lea    0x4(%eax),%edi
+  800393:	83 ec 08             	sub    $0x8,%esp
+  800396:	53                   	push   %ebx
+  800397:	ff 30                	push   (%eax)
+  800399:	ff d6                	call   *%esi
+			break;
+  80039b:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80039e:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003a1:	e9 b1 02 00 00       	jmp    800657 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8003a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003a9:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003ac:	8b 10                	mov    (%eax),%edx
+  8003ae:	89 d0                	mov    %edx,%eax
+  8003b0:	f7 d8                	neg    %eax
+  8003b2:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003b5:	83 f8 0d             	cmp    $0xd,%eax
+  8003b8:	7f 23                	jg     8003dd <vprintfmt+0x15c>
+  8003ba:	8b 14 85 80 2b 80 00 	mov    0x802b80(,%eax,4),%edx
+  8003c1:	85 d2                	test   %edx,%edx
+  8003c3:	74 18                	je     8003dd <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003c5:	52                   	push   %edx
+  8003c6:	68 56 29 80 00       	push   $0x802956
+  8003cb:	53                   	push   %ebx
+  8003cc:	56                   	push   %esi
+  8003cd:	e8 92 fe ff ff       	call   800264 <printfmt>
+  8003d2:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003d5:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003d8:	e9 7a 02 00 00       	jmp    800657 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8003dd:	50                   	push   %eax
+  8003de:	68 4d 29 80 00       	push   $0x80294d
+  8003e3:	53                   	push   %ebx
+  8003e4:	56                   	push   %esi
+  8003e5:	e8 7a fe ff ff       	call   800264 <printfmt>
+  8003ea:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003ed:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003f0:	e9 62 02 00 00       	jmp    800657 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f8:	83 c0 04             	add    $0x4,%eax
+  8003fb:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800401:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800403:	85 c9                	test   %ecx,%ecx
+  800405:	b8 46 29 80 00       	mov    $0x802946,%eax
+  80040a:	0f 45 c1             	cmovne %ecx,%eax
+  80040d:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800410:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800414:	7e 06                	jle    80041c <vprintfmt+0x19b>
+  800416:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80041a:	75 0b                	jne    800427 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80041c:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80041f:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800422:	89 75 08             	mov    %esi,0x8(%ebp)
+  800425:	eb 5c                	jmp    800483 <vprintfmt+0x202>
+  800427:	83 ec 08             	sub    $0x8,%esp
+  80042a:	ff 75 d0             	push   -0x30(%ebp)
+  80042d:	ff 75 cc             	push   -0x34(%ebp)
+  800430:	e8 20 03 00 00       	call   800755 <strnlen>
+  800435:	89 c2                	mov    %eax,%edx
+  800437:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80043a:	29 d0                	sub    %edx,%eax
+  80043c:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80043f:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800443:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800446:	89 75 08             	mov    %esi,0x8(%ebp)
+  800449:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80044b:	eb 0e                	jmp    80045b <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80044d:	83 ec 08             	sub    $0x8,%esp
+  800450:	53                   	push   %ebx
+  800451:	57                   	push   %edi
+  800452:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800455:	83 ee 01             	sub    $0x1,%esi
+  800458:	83 c4 10             	add    $0x10,%esp
+  80045b:	85 f6                	test   %esi,%esi
+  80045d:	7f ee                	jg     80044d <vprintfmt+0x1cc>
+  80045f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800462:	8b 75 08             	mov    0x8(%ebp),%esi
+  800465:	85 c0                	test   %eax,%eax
+  800467:	ba 00 00 00 00       	mov    $0x0,%edx
+  80046c:	0f 49 d0             	cmovns %eax,%edx
+  80046f:	29 d0                	sub    %edx,%eax
+  800471:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800474:	eb a6                	jmp    80041c <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800476:	83 ec 08             	sub    $0x8,%esp
+  800479:	53                   	push   %ebx
+  80047a:	52                   	push   %edx
+  80047b:	ff 55 08             	call   *0x8(%ebp)
+  80047e:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800481:	89 f1                	mov    %esi,%ecx
+  800483:	8d 71 01             	lea    0x1(%ecx),%esi
+  800486:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80048a:	0f be d0             	movsbl %al,%edx
+  80048d:	85 d2                	test   %edx,%edx
+  80048f:	74 28                	je     8004b9 <vprintfmt+0x238>
+  800491:	85 ff                	test   %edi,%edi
+  800493:	78 05                	js     80049a <vprintfmt+0x219>
+  800495:	83 ef 01             	sub    $0x1,%edi
+  800498:	78 30                	js     8004ca <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80049a:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80049e:	74 d6                	je     800476 <vprintfmt+0x1f5>
+  8004a0:	0f be c0             	movsbl %al,%eax
+  8004a3:	83 e8 20             	sub    $0x20,%eax
+  8004a6:	83 f8 5e             	cmp    $0x5e,%eax
+  8004a9:	76 cb                	jbe    800476 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004ab:	83 ec 08             	sub    $0x8,%esp
+  8004ae:	53                   	push   %ebx
+  8004af:	6a 3f                	push   $0x3f
+  8004b1:	ff 55 08             	call   *0x8(%ebp)
+  8004b4:	83 c4 10             	add    $0x10,%esp
+  8004b7:	eb c8                	jmp    800481 <vprintfmt+0x200>
+  8004b9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004bc:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004bf:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004c2:	01 d0                	add    %edx,%eax
+  8004c4:	29 c8                	sub    %ecx,%eax
+  8004c6:	89 c7                	mov    %eax,%edi
+  8004c8:	eb 13                	jmp    8004dd <vprintfmt+0x25c>
+  8004ca:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004cd:	eb ed                	jmp    8004bc <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004cf:	83 ec 08             	sub    $0x8,%esp
+  8004d2:	53                   	push   %ebx
+  8004d3:	6a 20                	push   $0x20
+  8004d5:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004d7:	83 ef 01             	sub    $0x1,%edi
+  8004da:	83 c4 10             	add    $0x10,%esp
+  8004dd:	85 ff                	test   %edi,%edi
+  8004df:	7f ee                	jg     8004cf <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004e1:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004e4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004e7:	e9 6b 01 00 00       	jmp    800657 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8004ec:	83 f9 01             	cmp    $0x1,%ecx
+  8004ef:	7f 1f                	jg     800510 <vprintfmt+0x28f>
+	else if (lflag)
+  8004f1:	85 c9                	test   %ecx,%ecx
+  8004f3:	74 67                	je     80055c <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8004f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f8:	8b 00                	mov    (%eax),%eax
+  8004fa:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004fd:	89 c1                	mov    %eax,%ecx
+  8004ff:	c1 f9 1f             	sar    $0x1f,%ecx
+  800502:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800505:	8b 45 14             	mov    0x14(%ebp),%eax
+  800508:	8d 40 04             	lea    0x4(%eax),%eax
+  80050b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80050e:	eb 17                	jmp    800527 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800510:	8b 45 14             	mov    0x14(%ebp),%eax
+  800513:	8b 50 04             	mov    0x4(%eax),%edx
+  800516:	8b 00                	mov    (%eax),%eax
+  800518:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80051b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80051e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800521:	8d 40 08             	lea    0x8(%eax),%eax
+  800524:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800527:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80052a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80052d:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800532:	85 c9                	test   %ecx,%ecx
+  800534:	0f 89 03 01 00 00    	jns    80063d <vprintfmt+0x3bc>
+				putch('-', putdat);
+  80053a:	83 ec 08             	sub    $0x8,%esp
+  80053d:	53                   	push   %ebx
+  80053e:	6a 2d                	push   $0x2d
+  800540:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800542:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800545:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800548:	f7 da                	neg    %edx
+  80054a:	83 d1 00             	adc    $0x0,%ecx
+  80054d:	f7 d9                	neg    %ecx
+  80054f:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800552:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800557:	e9 e1 00 00 00       	jmp    80063d <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80055c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80055f:	8b 00                	mov    (%eax),%eax
+  800561:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800564:	89 c1                	mov    %eax,%ecx
+  800566:	c1 f9 1f             	sar    $0x1f,%ecx
+  800569:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80056c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056f:	8d 40 04             	lea    0x4(%eax),%eax
+  800572:	89 45 14             	mov    %eax,0x14(%ebp)
+  800575:	eb b0                	jmp    800527 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800577:	83 f9 01             	cmp    $0x1,%ecx
+  80057a:	7f 1e                	jg     80059a <vprintfmt+0x319>
+	else if (lflag)
+  80057c:	85 c9                	test   %ecx,%ecx
+  80057e:	74 32                	je     8005b2 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800580:	8b 45 14             	mov    0x14(%ebp),%eax
+  800583:	8b 10                	mov    (%eax),%edx
+  800585:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80058a:	8d 40 04             	lea    0x4(%eax),%eax
+  80058d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800590:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800595:	e9 a3 00 00 00       	jmp    80063d <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80059a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059d:	8b 10                	mov    (%eax),%edx
+  80059f:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005a2:	8d 40 08             	lea    0x8(%eax),%eax
+  8005a5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005a8:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005ad:	e9 8b 00 00 00       	jmp    80063d <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b5:	8b 10                	mov    (%eax),%edx
+  8005b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005bc:	8d 40 04             	lea    0x4(%eax),%eax
+  8005bf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005c2:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005c7:	eb 74                	jmp    80063d <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8005c9:	83 f9 01             	cmp    $0x1,%ecx
+  8005cc:	7f 1b                	jg     8005e9 <vprintfmt+0x368>
+	else if (lflag)
+  8005ce:	85 c9                	test   %ecx,%ecx
+  8005d0:	74 2c                	je     8005fe <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8005d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d5:	8b 10                	mov    (%eax),%edx
+  8005d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005dc:	8d 40 04             	lea    0x4(%eax),%eax
+  8005df:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005e2:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8005e7:	eb 54                	jmp    80063d <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ec:	8b 10                	mov    (%eax),%edx
+  8005ee:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005f1:	8d 40 08             	lea    0x8(%eax),%eax
+  8005f4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005f7:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8005fc:	eb 3f                	jmp    80063d <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800601:	8b 10                	mov    (%eax),%edx
+  800603:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800608:	8d 40 04             	lea    0x4(%eax),%eax
+  80060b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80060e:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800613:	eb 28                	jmp    80063d <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800615:	83 ec 08             	sub    $0x8,%esp
+  800618:	53                   	push   %ebx
+  800619:	6a 30                	push   $0x30
+  80061b:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80061d:	83 c4 08             	add    $0x8,%esp
+  800620:	53                   	push   %ebx
+  800621:	6a 78                	push   $0x78
+  800623:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800625:	8b 45 14             	mov    0x14(%ebp),%eax
+  800628:	8b 10                	mov    (%eax),%edx
+  80062a:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80062f:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800632:	8d 40 04             	lea    0x4(%eax),%eax
+  800635:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800638:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80063d:	83 ec 0c             	sub    $0xc,%esp
+  800640:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800644:	50                   	push   %eax
+  800645:	ff 75 e0             	push   -0x20(%ebp)
+  800648:	57                   	push   %edi
+  800649:	51                   	push   %ecx
+  80064a:	52                   	push   %edx
+  80064b:	89 da                	mov    %ebx,%edx
+  80064d:	89 f0                	mov    %esi,%eax
+  80064f:	e8 4a fb ff ff       	call   80019e <printnum>
+			break;
+  800654:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800657:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80065a:	e9 40 fc ff ff       	jmp    80029f <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80065f:	83 f9 01             	cmp    $0x1,%ecx
+  800662:	7f 1b                	jg     80067f <vprintfmt+0x3fe>
+	else if (lflag)
+  800664:	85 c9                	test   %ecx,%ecx
+  800666:	74 2c                	je     800694 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800668:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066b:	8b 10                	mov    (%eax),%edx
+  80066d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800672:	8d 40 04             	lea    0x4(%eax),%eax
+  800675:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800678:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80067d:	eb be                	jmp    80063d <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80067f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800682:	8b 10                	mov    (%eax),%edx
+  800684:	8b 48 04             	mov    0x4(%eax),%ecx
+  800687:	8d 40 08             	lea    0x8(%eax),%eax
+  80068a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80068d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800692:	eb a9                	jmp    80063d <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800694:	8b 45 14             	mov    0x14(%ebp),%eax
+  800697:	8b 10                	mov    (%eax),%edx
+  800699:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80069e:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006a4:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006a9:	eb 92                	jmp    80063d <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8006ab:	83 ec 08             	sub    $0x8,%esp
+  8006ae:	53                   	push   %ebx
+  8006af:	6a 25                	push   $0x25
+  8006b1:	ff d6                	call   *%esi
+			break;
+  8006b3:	83 c4 10             	add    $0x10,%esp
+  8006b6:	eb 9f                	jmp    800657 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8006b8:	83 ec 08             	sub    $0x8,%esp
+  8006bb:	53                   	push   %ebx
+  8006bc:	6a 25                	push   $0x25
+  8006be:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006c0:	83 c4 10             	add    $0x10,%esp
+  8006c3:	89 f8                	mov    %edi,%eax
+  8006c5:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006c9:	74 05                	je     8006d0 <vprintfmt+0x44f>
+  8006cb:	83 e8 01             	sub    $0x1,%eax
+  8006ce:	eb f5                	jmp    8006c5 <vprintfmt+0x444>
+  8006d0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006d3:	eb 82                	jmp    800657 <vprintfmt+0x3d6>
+
+008006d5 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006d5:	55                   	push   %ebp
+  8006d6:	89 e5                	mov    %esp,%ebp
+  8006d8:	83 ec 18             	sub    $0x18,%esp
+  8006db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006de:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006e1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006e4:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006e8:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006eb:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006f2:	85 c0                	test   %eax,%eax
+  8006f4:	74 26                	je     80071c <vsnprintf+0x47>
+  8006f6:	85 d2                	test   %edx,%edx
+  8006f8:	7e 22                	jle    80071c <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006fa:	ff 75 14             	push   0x14(%ebp)
+  8006fd:	ff 75 10             	push   0x10(%ebp)
+  800700:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800703:	50                   	push   %eax
+  800704:	68 47 02 80 00       	push   $0x800247
+  800709:	e8 73 fb ff ff       	call   800281 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80070e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800711:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800714:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800717:	83 c4 10             	add    $0x10,%esp
+}
+  80071a:	c9                   	leave
+  80071b:	c3                   	ret
+		return -E_INVAL;
+  80071c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800721:	eb f7                	jmp    80071a <vsnprintf+0x45>
+
+00800723 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800723:	55                   	push   %ebp
+  800724:	89 e5                	mov    %esp,%ebp
+  800726:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800729:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80072c:	50                   	push   %eax
+  80072d:	ff 75 10             	push   0x10(%ebp)
+  800730:	ff 75 0c             	push   0xc(%ebp)
+  800733:	ff 75 08             	push   0x8(%ebp)
+  800736:	e8 9a ff ff ff       	call   8006d5 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80073b:	c9                   	leave
+  80073c:	c3                   	ret
+
+0080073d <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80073d:	55                   	push   %ebp
+  80073e:	89 e5                	mov    %esp,%ebp
+  800740:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800743:	b8 00 00 00 00       	mov    $0x0,%eax
+  800748:	eb 03                	jmp    80074d <strlen+0x10>
+		n++;
+  80074a:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80074d:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800751:	75 f7                	jne    80074a <strlen+0xd>
+	return n;
+}
+  800753:	5d                   	pop    %ebp
+  800754:	c3                   	ret
+
+00800755 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800755:	55                   	push   %ebp
+  800756:	89 e5                	mov    %esp,%ebp
+  800758:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80075b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80075e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800763:	eb 03                	jmp    800768 <strnlen+0x13>
+		n++;
+  800765:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800768:	39 d0                	cmp    %edx,%eax
+  80076a:	74 08                	je     800774 <strnlen+0x1f>
+  80076c:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800770:	75 f3                	jne    800765 <strnlen+0x10>
+  800772:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800774:	89 d0                	mov    %edx,%eax
+  800776:	5d                   	pop    %ebp
+  800777:	c3                   	ret
+
+00800778 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800778:	55                   	push   %ebp
+  800779:	89 e5                	mov    %esp,%ebp
+  80077b:	53                   	push   %ebx
+  80077c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80077f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800782:	b8 00 00 00 00       	mov    $0x0,%eax
+  800787:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80078b:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80078e:	83 c0 01             	add    $0x1,%eax
+  800791:	84 d2                	test   %dl,%dl
+  800793:	75 f2                	jne    800787 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800795:	89 c8                	mov    %ecx,%eax
+  800797:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80079a:	c9                   	leave
+  80079b:	c3                   	ret
+
+0080079c <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80079c:	55                   	push   %ebp
+  80079d:	89 e5                	mov    %esp,%ebp
+  80079f:	53                   	push   %ebx
+  8007a0:	83 ec 10             	sub    $0x10,%esp
+  8007a3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007a6:	53                   	push   %ebx
+  8007a7:	e8 91 ff ff ff       	call   80073d <strlen>
+  8007ac:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007af:	ff 75 0c             	push   0xc(%ebp)
+  8007b2:	01 d8                	add    %ebx,%eax
+  8007b4:	50                   	push   %eax
+  8007b5:	e8 be ff ff ff       	call   800778 <strcpy>
+	return dst;
+}
+  8007ba:	89 d8                	mov    %ebx,%eax
+  8007bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007bf:	c9                   	leave
+  8007c0:	c3                   	ret
+
+008007c1 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007c1:	55                   	push   %ebp
+  8007c2:	89 e5                	mov    %esp,%ebp
+  8007c4:	56                   	push   %esi
+  8007c5:	53                   	push   %ebx
+  8007c6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007c9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007cc:	89 f3                	mov    %esi,%ebx
+  8007ce:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007d1:	89 f0                	mov    %esi,%eax
+  8007d3:	eb 0f                	jmp    8007e4 <strncpy+0x23>
+		*dst++ = *src;
+  8007d5:	83 c0 01             	add    $0x1,%eax
+  8007d8:	0f b6 0a             	movzbl (%edx),%ecx
+  8007db:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007de:	80 f9 01             	cmp    $0x1,%cl
+  8007e1:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007e4:	39 d8                	cmp    %ebx,%eax
+  8007e6:	75 ed                	jne    8007d5 <strncpy+0x14>
+	}
+	return ret;
+}
+  8007e8:	89 f0                	mov    %esi,%eax
+  8007ea:	5b                   	pop    %ebx
+  8007eb:	5e                   	pop    %esi
+  8007ec:	5d                   	pop    %ebp
+  8007ed:	c3                   	ret
+
+008007ee <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007ee:	55                   	push   %ebp
+  8007ef:	89 e5                	mov    %esp,%ebp
+  8007f1:	56                   	push   %esi
+  8007f2:	53                   	push   %ebx
+  8007f3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007f9:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8007fc:	89 f0                	mov    %esi,%eax
+  8007fe:	85 d2                	test   %edx,%edx
+  800800:	74 21                	je     800823 <strlcpy+0x35>
+  800802:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800806:	89 f2                	mov    %esi,%edx
+  800808:	eb 09                	jmp    800813 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80080a:	83 c1 01             	add    $0x1,%ecx
+  80080d:	83 c2 01             	add    $0x1,%edx
+  800810:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800813:	39 c2                	cmp    %eax,%edx
+  800815:	74 09                	je     800820 <strlcpy+0x32>
+  800817:	0f b6 19             	movzbl (%ecx),%ebx
+  80081a:	84 db                	test   %bl,%bl
+  80081c:	75 ec                	jne    80080a <strlcpy+0x1c>
+  80081e:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800820:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800823:	29 f0                	sub    %esi,%eax
+}
+  800825:	5b                   	pop    %ebx
+  800826:	5e                   	pop    %esi
+  800827:	5d                   	pop    %ebp
+  800828:	c3                   	ret
+
+00800829 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800829:	55                   	push   %ebp
+  80082a:	89 e5                	mov    %esp,%ebp
+  80082c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80082f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800832:	eb 06                	jmp    80083a <strcmp+0x11>
+		p++, q++;
+  800834:	83 c1 01             	add    $0x1,%ecx
+  800837:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80083a:	0f b6 01             	movzbl (%ecx),%eax
+  80083d:	84 c0                	test   %al,%al
+  80083f:	74 04                	je     800845 <strcmp+0x1c>
+  800841:	3a 02                	cmp    (%edx),%al
+  800843:	74 ef                	je     800834 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800845:	0f b6 c0             	movzbl %al,%eax
+  800848:	0f b6 12             	movzbl (%edx),%edx
+  80084b:	29 d0                	sub    %edx,%eax
+}
+  80084d:	5d                   	pop    %ebp
+  80084e:	c3                   	ret
+
+0080084f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80084f:	55                   	push   %ebp
+  800850:	89 e5                	mov    %esp,%ebp
+  800852:	53                   	push   %ebx
+  800853:	8b 45 08             	mov    0x8(%ebp),%eax
+  800856:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800859:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80085c:	eb 09                	jmp    800867 <strncmp+0x18>
+		n--, p++, q++;
+  80085e:	83 ea 01             	sub    $0x1,%edx
+  800861:	83 c0 01             	add    $0x1,%eax
+  800864:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800867:	85 d2                	test   %edx,%edx
+  800869:	74 18                	je     800883 <strncmp+0x34>
+  80086b:	0f b6 18             	movzbl (%eax),%ebx
+  80086e:	84 db                	test   %bl,%bl
+  800870:	74 04                	je     800876 <strncmp+0x27>
+  800872:	3a 19                	cmp    (%ecx),%bl
+  800874:	74 e8                	je     80085e <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800876:	0f b6 00             	movzbl (%eax),%eax
+  800879:	0f b6 11             	movzbl (%ecx),%edx
+  80087c:	29 d0                	sub    %edx,%eax
+}
+  80087e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800881:	c9                   	leave
+  800882:	c3                   	ret
+		return 0;
+  800883:	b8 00 00 00 00       	mov    $0x0,%eax
+  800888:	eb f4                	jmp    80087e <strncmp+0x2f>
+
+0080088a <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80088a:	55                   	push   %ebp
+  80088b:	89 e5                	mov    %esp,%ebp
+  80088d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800890:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800894:	eb 03                	jmp    800899 <strchr+0xf>
+  800896:	83 c0 01             	add    $0x1,%eax
+  800899:	0f b6 10             	movzbl (%eax),%edx
+  80089c:	84 d2                	test   %dl,%dl
+  80089e:	74 06                	je     8008a6 <strchr+0x1c>
+		if (*s == c)
+  8008a0:	38 ca                	cmp    %cl,%dl
+  8008a2:	75 f2                	jne    800896 <strchr+0xc>
+  8008a4:	eb 05                	jmp    8008ab <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008a6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008ab:	5d                   	pop    %ebp
+  8008ac:	c3                   	ret
+
+008008ad <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008ad:	55                   	push   %ebp
+  8008ae:	89 e5                	mov    %esp,%ebp
+  8008b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008b3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008b7:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008ba:	38 ca                	cmp    %cl,%dl
+  8008bc:	74 09                	je     8008c7 <strfind+0x1a>
+  8008be:	84 d2                	test   %dl,%dl
+  8008c0:	74 05                	je     8008c7 <strfind+0x1a>
+	for (; *s; s++)
+  8008c2:	83 c0 01             	add    $0x1,%eax
+  8008c5:	eb f0                	jmp    8008b7 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008c7:	5d                   	pop    %ebp
+  8008c8:	c3                   	ret
+
+008008c9 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008c9:	55                   	push   %ebp
+  8008ca:	89 e5                	mov    %esp,%ebp
+  8008cc:	57                   	push   %edi
+  8008cd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008d0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008d3:	85 c9                	test   %ecx,%ecx
+  8008d5:	74 20                	je     8008f7 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008d7:	89 f8                	mov    %edi,%eax
+  8008d9:	09 c8                	or     %ecx,%eax
+  8008db:	a8 03                	test   $0x3,%al
+  8008dd:	75 12                	jne    8008f1 <memset+0x28>
+		c &= 0xFF;
+  8008df:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008e3:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008e9:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008ec:	fc                   	cld
+  8008ed:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008ef:	eb 06                	jmp    8008f7 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008f4:	fc                   	cld
+  8008f5:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008f7:	89 f8                	mov    %edi,%eax
+  8008f9:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008fc:	c9                   	leave
+  8008fd:	c3                   	ret
+
+008008fe <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008fe:	55                   	push   %ebp
+  8008ff:	89 e5                	mov    %esp,%ebp
+  800901:	57                   	push   %edi
+  800902:	56                   	push   %esi
+  800903:	8b 45 08             	mov    0x8(%ebp),%eax
+  800906:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800909:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80090c:	39 c6                	cmp    %eax,%esi
+  80090e:	73 32                	jae    800942 <memmove+0x44>
+  800910:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800913:	39 d0                	cmp    %edx,%eax
+  800915:	73 2b                	jae    800942 <memmove+0x44>
+		s += n;
+		d += n;
+  800917:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80091a:	89 d6                	mov    %edx,%esi
+  80091c:	09 fe                	or     %edi,%esi
+  80091e:	09 ce                	or     %ecx,%esi
+  800920:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800926:	75 0e                	jne    800936 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800928:	83 ef 04             	sub    $0x4,%edi
+  80092b:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80092e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800931:	fd                   	std
+  800932:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800934:	eb 09                	jmp    80093f <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800936:	83 ef 01             	sub    $0x1,%edi
+  800939:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80093c:	fd                   	std
+  80093d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80093f:	fc                   	cld
+  800940:	eb 1a                	jmp    80095c <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800942:	89 f2                	mov    %esi,%edx
+  800944:	09 c2                	or     %eax,%edx
+  800946:	09 ca                	or     %ecx,%edx
+  800948:	f6 c2 03             	test   $0x3,%dl
+  80094b:	75 0a                	jne    800957 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80094d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800950:	89 c7                	mov    %eax,%edi
+  800952:	fc                   	cld
+  800953:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800955:	eb 05                	jmp    80095c <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800957:	89 c7                	mov    %eax,%edi
+  800959:	fc                   	cld
+  80095a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80095c:	5e                   	pop    %esi
+  80095d:	5f                   	pop    %edi
+  80095e:	5d                   	pop    %ebp
+  80095f:	c3                   	ret
+
+00800960 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800960:	55                   	push   %ebp
+  800961:	89 e5                	mov    %esp,%ebp
+  800963:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800966:	ff 75 10             	push   0x10(%ebp)
+  800969:	ff 75 0c             	push   0xc(%ebp)
+  80096c:	ff 75 08             	push   0x8(%ebp)
+  80096f:	e8 8a ff ff ff       	call   8008fe <memmove>
+}
+  800974:	c9                   	leave
+  800975:	c3                   	ret
+
+00800976 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800976:	55                   	push   %ebp
+  800977:	89 e5                	mov    %esp,%ebp
+  800979:	56                   	push   %esi
+  80097a:	53                   	push   %ebx
+  80097b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80097e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800981:	89 c6                	mov    %eax,%esi
+  800983:	03 75 10             	add    0x10(%ebp),%esi
+  800986:	eb 06                	jmp    80098e <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800988:	83 c0 01             	add    $0x1,%eax
+  80098b:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  80098e:	39 f0                	cmp    %esi,%eax
+  800990:	74 14                	je     8009a6 <memcmp+0x30>
+		if (*s1 != *s2)
+  800992:	0f b6 08             	movzbl (%eax),%ecx
+  800995:	0f b6 1a             	movzbl (%edx),%ebx
+  800998:	38 d9                	cmp    %bl,%cl
+  80099a:	74 ec                	je     800988 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  80099c:	0f b6 c1             	movzbl %cl,%eax
+  80099f:	0f b6 db             	movzbl %bl,%ebx
+  8009a2:	29 d8                	sub    %ebx,%eax
+  8009a4:	eb 05                	jmp    8009ab <memcmp+0x35>
+	}
+
+	return 0;
+  8009a6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009ab:	5b                   	pop    %ebx
+  8009ac:	5e                   	pop    %esi
+  8009ad:	5d                   	pop    %ebp
+  8009ae:	c3                   	ret
+
+008009af <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009af:	55                   	push   %ebp
+  8009b0:	89 e5                	mov    %esp,%ebp
+  8009b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009b8:	89 c2                	mov    %eax,%edx
+  8009ba:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009bd:	eb 03                	jmp    8009c2 <memfind+0x13>
+  8009bf:	83 c0 01             	add    $0x1,%eax
+  8009c2:	39 d0                	cmp    %edx,%eax
+  8009c4:	73 04                	jae    8009ca <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009c6:	38 08                	cmp    %cl,(%eax)
+  8009c8:	75 f5                	jne    8009bf <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009ca:	5d                   	pop    %ebp
+  8009cb:	c3                   	ret
+
+008009cc <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009cc:	55                   	push   %ebp
+  8009cd:	89 e5                	mov    %esp,%ebp
+  8009cf:	57                   	push   %edi
+  8009d0:	56                   	push   %esi
+  8009d1:	53                   	push   %ebx
+  8009d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009d5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009d8:	eb 03                	jmp    8009dd <strtol+0x11>
+		s++;
+  8009da:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8009dd:	0f b6 02             	movzbl (%edx),%eax
+  8009e0:	3c 20                	cmp    $0x20,%al
+  8009e2:	74 f6                	je     8009da <strtol+0xe>
+  8009e4:	3c 09                	cmp    $0x9,%al
+  8009e6:	74 f2                	je     8009da <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009e8:	3c 2b                	cmp    $0x2b,%al
+  8009ea:	74 2a                	je     800a16 <strtol+0x4a>
+	int neg = 0;
+  8009ec:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009f1:	3c 2d                	cmp    $0x2d,%al
+  8009f3:	74 2b                	je     800a20 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009f5:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009fb:	75 0f                	jne    800a0c <strtol+0x40>
+  8009fd:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a00:	74 28                	je     800a2a <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a02:	85 db                	test   %ebx,%ebx
+  800a04:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a09:	0f 44 d8             	cmove  %eax,%ebx
+  800a0c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a11:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a14:	eb 46                	jmp    800a5c <strtol+0x90>
+		s++;
+  800a16:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a19:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a1e:	eb d5                	jmp    8009f5 <strtol+0x29>
+		s++, neg = 1;
+  800a20:	83 c2 01             	add    $0x1,%edx
+  800a23:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a28:	eb cb                	jmp    8009f5 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a2a:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a2e:	74 0e                	je     800a3e <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a30:	85 db                	test   %ebx,%ebx
+  800a32:	75 d8                	jne    800a0c <strtol+0x40>
+		s++, base = 8;
+  800a34:	83 c2 01             	add    $0x1,%edx
+  800a37:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a3c:	eb ce                	jmp    800a0c <strtol+0x40>
+		s += 2, base = 16;
+  800a3e:	83 c2 02             	add    $0x2,%edx
+  800a41:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a46:	eb c4                	jmp    800a0c <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a48:	0f be c0             	movsbl %al,%eax
+  800a4b:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a4e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a51:	7d 3a                	jge    800a8d <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a53:	83 c2 01             	add    $0x1,%edx
+  800a56:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a5a:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a5c:	0f b6 02             	movzbl (%edx),%eax
+  800a5f:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a62:	89 f3                	mov    %esi,%ebx
+  800a64:	80 fb 09             	cmp    $0x9,%bl
+  800a67:	76 df                	jbe    800a48 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a69:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a6c:	89 f3                	mov    %esi,%ebx
+  800a6e:	80 fb 19             	cmp    $0x19,%bl
+  800a71:	77 08                	ja     800a7b <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a73:	0f be c0             	movsbl %al,%eax
+  800a76:	83 e8 57             	sub    $0x57,%eax
+  800a79:	eb d3                	jmp    800a4e <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a7b:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a7e:	89 f3                	mov    %esi,%ebx
+  800a80:	80 fb 19             	cmp    $0x19,%bl
+  800a83:	77 08                	ja     800a8d <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a85:	0f be c0             	movsbl %al,%eax
+  800a88:	83 e8 37             	sub    $0x37,%eax
+  800a8b:	eb c1                	jmp    800a4e <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a8d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a91:	74 05                	je     800a98 <strtol+0xcc>
+		*endptr = (char *) s;
+  800a93:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a96:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a98:	89 c8                	mov    %ecx,%eax
+  800a9a:	f7 d8                	neg    %eax
+  800a9c:	85 ff                	test   %edi,%edi
+  800a9e:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800aa1:	89 c8                	mov    %ecx,%eax
+  800aa3:	5b                   	pop    %ebx
+  800aa4:	5e                   	pop    %esi
+  800aa5:	5f                   	pop    %edi
+  800aa6:	5d                   	pop    %ebp
+  800aa7:	c3                   	ret
+
+00800aa8 <atoi>:
+
+int
+atoi(const char *s)
+{
+  800aa8:	55                   	push   %ebp
+  800aa9:	89 e5                	mov    %esp,%ebp
+  800aab:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800aae:	6a 0a                	push   $0xa
+  800ab0:	6a 00                	push   $0x0
+  800ab2:	ff 75 08             	push   0x8(%ebp)
+  800ab5:	e8 12 ff ff ff       	call   8009cc <strtol>
+}
+  800aba:	c9                   	leave
+  800abb:	c3                   	ret
+
+00800abc <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800abc:	55                   	push   %ebp
+  800abd:	89 e5                	mov    %esp,%ebp
+  800abf:	57                   	push   %edi
+  800ac0:	56                   	push   %esi
+  800ac1:	53                   	push   %ebx
+  800ac2:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800ac8:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800ace:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800ad4:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800ada:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800ae1:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800ae4:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800aeb:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800aee:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800af5:	74 76                	je     800b6d <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800af7:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800afd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b00:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800b06:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b0d:	0f 88 06 01 00 00    	js     800c19 <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800b13:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b1a:	0f 84 48 01 00 00    	je     800c68 <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800b20:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800b26:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800b2c:	be 00 00 00 00       	mov    $0x0,%esi
+  800b31:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800b37:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b3a:	55                   	push   %ebp
+  800b3b:	68 44 0b 80 00       	push   $0x800b44
+  800b40:	89 e5                	mov    %esp,%ebp
+  800b42:	0f 34                	sysenter
+  800b44:	83 c4 04             	add    $0x4,%esp
+  800b47:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800b48:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800b4e:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800b54:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800b57:	0f 85 9a 01 00 00    	jne    800cf7 <page_vec_call+0x23b>
+  800b5d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b62:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b65:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b68:	e9 29 01 00 00       	jmp    800c96 <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800b6d:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800b73:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b76:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800b78:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b7f:	78 2f                	js     800bb0 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800b81:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800b88:	74 72                	je     800bfc <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800b8a:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800b90:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800b96:	b8 10 00 00 00       	mov    $0x10,%eax
+  800b9b:	89 fb                	mov    %edi,%ebx
+  800b9d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800ba0:	55                   	push   %ebp
+  800ba1:	68 aa 0b 80 00       	push   $0x800baa
+  800ba6:	89 e5                	mov    %esp,%ebp
+  800ba8:	0f 34                	sysenter
+  800baa:	83 c4 04             	add    $0x4,%esp
+  800bad:	5d                   	pop    %ebp
+	return ret;
+  800bae:	eb 98                	jmp    800b48 <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800bb0:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bb5:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800bb7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800bbc:	f6 c6 08             	test   $0x8,%dh
+  800bbf:	74 15                	je     800bd6 <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800bc1:	89 c2                	mov    %eax,%edx
+  800bc3:	c1 ea 08             	shr    $0x8,%edx
+  800bc6:	83 e2 0f             	and    $0xf,%edx
+  800bc9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800bce:	83 fa 06             	cmp    $0x6,%edx
+  800bd1:	74 0e                	je     800be1 <page_vec_call+0x125>
+  800bd3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800bd6:	0f b6 c9             	movzbl %cl,%ecx
+  800bd9:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800bdf:	eb a0                	jmp    800b81 <page_vec_call+0xc5>
+  800be1:	89 c2                	mov    %eax,%edx
+  800be3:	c1 ea 04             	shr    $0x4,%edx
+  800be6:	83 e2 0f             	and    $0xf,%edx
+  800be9:	83 fa 02             	cmp    $0x2,%edx
+  800bec:	77 e5                	ja     800bd3 <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800bee:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800bf1:	83 f8 02             	cmp    $0x2,%eax
+  800bf4:	0f 97 c1             	seta   %cl
+  800bf7:	0f b6 c9             	movzbl %cl,%ecx
+  800bfa:	eb d7                	jmp    800bd3 <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800bfc:	b8 10 00 00 00       	mov    $0x10,%eax
+  800c01:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800c07:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800c0d:	89 fb                	mov    %edi,%ebx
+  800c0f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c12:	cd 30                	int    $0x30
+  800c14:	e9 2f ff ff ff       	jmp    800b48 <page_vec_call+0x8c>
+  800c19:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c1e:	0f a2                	cpuid
+		return 0;
+  800c20:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800c25:	f6 c6 08             	test   $0x8,%dh
+  800c28:	74 15                	je     800c3f <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c2a:	89 c2                	mov    %eax,%edx
+  800c2c:	c1 ea 08             	shr    $0x8,%edx
+  800c2f:	83 e2 0f             	and    $0xf,%edx
+  800c32:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800c37:	83 fa 06             	cmp    $0x6,%edx
+  800c3a:	74 11                	je     800c4d <page_vec_call+0x191>
+  800c3c:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800c3f:	0f b6 c9             	movzbl %cl,%ecx
+  800c42:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800c48:	e9 c6 fe ff ff       	jmp    800b13 <page_vec_call+0x57>
+  800c4d:	89 c2                	mov    %eax,%edx
+  800c4f:	c1 ea 04             	shr    $0x4,%edx
+  800c52:	83 e2 0f             	and    $0xf,%edx
+  800c55:	83 fa 02             	cmp    $0x2,%edx
+  800c58:	77 e2                	ja     800c3c <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800c5a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800c5d:	83 f8 02             	cmp    $0x2,%eax
+  800c60:	0f 97 c1             	seta   %cl
+  800c63:	0f b6 c9             	movzbl %cl,%ecx
+  800c66:	eb d4                	jmp    800c3c <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800c68:	be 00 00 00 00       	mov    $0x0,%esi
+  800c6d:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800c73:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800c79:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800c7f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c82:	cd 30                	int    $0x30
+  800c84:	e9 bf fe ff ff       	jmp    800b48 <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800c89:	29 da                	sub    %ebx,%edx
+			vec++;
+  800c8b:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800c8e:	83 e8 01             	sub    $0x1,%eax
+  800c91:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800c96:	85 c0                	test   %eax,%eax
+  800c98:	74 58                	je     800cf2 <page_vec_call+0x236>
+  800c9a:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800c9d:	39 da                	cmp    %ebx,%edx
+  800c9f:	73 e8                	jae    800c89 <page_vec_call+0x1cd>
+  800ca1:	89 75 08             	mov    %esi,0x8(%ebp)
+  800ca4:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800ca7:	84 c9                	test   %cl,%cl
+  800ca9:	74 06                	je     800cb1 <page_vec_call+0x1f5>
+  800cab:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800cb1:	83 ec 04             	sub    $0x4,%esp
+  800cb4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cb7:	c1 e0 04             	shl    $0x4,%eax
+  800cba:	50                   	push   %eax
+  800cbb:	ff 75 08             	push   0x8(%ebp)
+  800cbe:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800cc4:	53                   	push   %ebx
+  800cc5:	e8 34 fc ff ff       	call   8008fe <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800cca:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800cd0:	89 c2                	mov    %eax,%edx
+  800cd2:	c1 e2 0c             	shl    $0xc,%edx
+  800cd5:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  800cdb:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  800ce1:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  800ce7:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  800cea:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  800ced:	e9 f2 fd ff ff       	jmp    800ae4 <page_vec_call+0x28>
+			r = 0;
+  800cf2:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  800cf7:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800cfb:	74 0b                	je     800d08 <page_vec_call+0x24c>
+		*done = total;
+  800cfd:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800d00:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  800d06:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  800d08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d0b:	5b                   	pop    %ebx
+  800d0c:	5e                   	pop    %esi
+  800d0d:	5f                   	pop    %edi
+  800d0e:	5d                   	pop    %ebp
+  800d0f:	c3                   	ret
+
+00800d10 <sys_cputs>:
+{
+  800d10:	55                   	push   %ebp
+  800d11:	89 e5                	mov    %esp,%ebp
+  800d13:	57                   	push   %edi
+  800d14:	56                   	push   %esi
+  800d15:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800d16:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d1d:	78 2d                	js     800d4c <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800d1f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d26:	74 70                	je     800d98 <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800d28:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d33:	89 c3                	mov    %eax,%ebx
+  800d35:	89 c7                	mov    %eax,%edi
+  800d37:	89 c6                	mov    %eax,%esi
+  800d39:	55                   	push   %ebp
+  800d3a:	68 43 0d 80 00       	push   $0x800d43
+  800d3f:	89 e5                	mov    %esp,%ebp
+  800d41:	0f 34                	sysenter
+  800d43:	83 c4 04             	add    $0x4,%esp
+  800d46:	5d                   	pop    %ebp
+}
+  800d47:	5b                   	pop    %ebx
+  800d48:	5e                   	pop    %esi
+  800d49:	5f                   	pop    %edi
+  800d4a:	5d                   	pop    %ebp
+  800d4b:	c3                   	ret
+  800d4c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d51:	0f a2                	cpuid
+		return 0;
+  800d53:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800d58:	f6 c6 08             	test   $0x8,%dh
+  800d5b:	74 15                	je     800d72 <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d5d:	89 c2                	mov    %eax,%edx
+  800d5f:	c1 ea 08             	shr    $0x8,%edx
+  800d62:	83 e2 0f             	and    $0xf,%edx
+  800d65:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d6a:	83 fa 06             	cmp    $0x6,%edx
+  800d6d:	74 0e                	je     800d7d <sys_cputs+0x6d>
+  800d6f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800d72:	0f b6 c9             	movzbl %cl,%ecx
+  800d75:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800d7b:	eb a2                	jmp    800d1f <sys_cputs+0xf>
+  800d7d:	89 c2                	mov    %eax,%edx
+  800d7f:	c1 ea 04             	shr    $0x4,%edx
+  800d82:	83 e2 0f             	and    $0xf,%edx
+  800d85:	83 fa 02             	cmp    $0x2,%edx
+  800d88:	77 e5                	ja     800d6f <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800d8a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d8d:	83 f8 02             	cmp    $0x2,%eax
+  800d90:	0f 97 c1             	seta   %cl
+  800d93:	0f b6 c9             	movzbl %cl,%ecx
+  800d96:	eb d7                	jmp    800d6f <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800d98:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da3:	89 c3                	mov    %eax,%ebx
+  800da5:	89 c7                	mov    %eax,%edi
+  800da7:	89 c6                	mov    %eax,%esi
+  800da9:	cd 30                	int    $0x30
+}
+  800dab:	eb 9a                	jmp    800d47 <sys_cputs+0x37>
+
+00800dad <sys_cgetc>:
+{
+  800dad:	55                   	push   %ebp
+  800dae:	89 e5                	mov    %esp,%ebp
+  800db0:	57                   	push   %edi
+  800db1:	56                   	push   %esi
+  800db2:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800db3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800dba:	78 2e                	js     800dea <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  800dbc:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800dc3:	74 71                	je     800e36 <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  800dc5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dca:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dcf:	89 d1                	mov    %edx,%ecx
+  800dd1:	89 d3                	mov    %edx,%ebx
+  800dd3:	89 d7                	mov    %edx,%edi
+  800dd5:	89 d6                	mov    %edx,%esi
+  800dd7:	55                   	push   %ebp
+  800dd8:	68 e1 0d 80 00       	push   $0x800de1
+  800ddd:	89 e5                	mov    %esp,%ebp
+  800ddf:	0f 34                	sysenter
+  800de1:	83 c4 04             	add    $0x4,%esp
+  800de4:	5d                   	pop    %ebp
+}
+  800de5:	5b                   	pop    %ebx
+  800de6:	5e                   	pop    %esi
+  800de7:	5f                   	pop    %edi
+  800de8:	5d                   	pop    %ebp
+  800de9:	c3                   	ret
+  800dea:	b8 01 00 00 00       	mov    $0x1,%eax
+  800def:	0f a2                	cpuid
+		return 0;
+  800df1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800df6:	f6 c6 08             	test   $0x8,%dh
+  800df9:	74 15                	je     800e10 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800dfb:	89 c2                	mov    %eax,%edx
+  800dfd:	c1 ea 08             	shr    $0x8,%edx
+  800e00:	83 e2 0f             	and    $0xf,%edx
+  800e03:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e08:	83 fa 06             	cmp    $0x6,%edx
+  800e0b:	74 0e                	je     800e1b <sys_cgetc+0x6e>
+  800e0d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800e10:	0f b6 c9             	movzbl %cl,%ecx
+  800e13:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800e19:	eb a1                	jmp    800dbc <sys_cgetc+0xf>
+  800e1b:	89 c2                	mov    %eax,%edx
+  800e1d:	c1 ea 04             	shr    $0x4,%edx
+  800e20:	83 e2 0f             	and    $0xf,%edx
+  800e23:	83 fa 02             	cmp    $0x2,%edx
+  800e26:	77 e5                	ja     800e0d <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  800e28:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e2b:	83 f8 02             	cmp    $0x2,%eax
+  800e2e:	0f 97 c1             	seta   %cl
+  800e31:	0f b6 c9             	movzbl %cl,%ecx
+  800e34:	eb d7                	jmp    800e0d <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  800e36:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e3b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e40:	89 d1                	mov    %edx,%ecx
+  800e42:	89 d3                	mov    %edx,%ebx
+  800e44:	89 d7                	mov    %edx,%edi
+  800e46:	89 d6                	mov    %edx,%esi
+  800e48:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800e4a:	eb 99                	jmp    800de5 <sys_cgetc+0x38>
+
+00800e4c <sys_env_destroy>:
+{
+  800e4c:	55                   	push   %ebp
+  800e4d:	89 e5                	mov    %esp,%ebp
+  800e4f:	57                   	push   %edi
+  800e50:	56                   	push   %esi
+  800e51:	53                   	push   %ebx
+  800e52:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800e55:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e5c:	78 36                	js     800e94 <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  800e5e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800e65:	74 79                	je     800ee0 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  800e67:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e6f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e74:	89 cb                	mov    %ecx,%ebx
+  800e76:	89 cf                	mov    %ecx,%edi
+  800e78:	89 ce                	mov    %ecx,%esi
+  800e7a:	55                   	push   %ebp
+  800e7b:	68 84 0e 80 00       	push   $0x800e84
+  800e80:	89 e5                	mov    %esp,%ebp
+  800e82:	0f 34                	sysenter
+  800e84:	83 c4 04             	add    $0x4,%esp
+  800e87:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e88:	85 c0                	test   %eax,%eax
+  800e8a:	7f 6b                	jg     800ef7 <sys_env_destroy+0xab>
+}
+  800e8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e8f:	5b                   	pop    %ebx
+  800e90:	5e                   	pop    %esi
+  800e91:	5f                   	pop    %edi
+  800e92:	5d                   	pop    %ebp
+  800e93:	c3                   	ret
+  800e94:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e99:	0f a2                	cpuid
+		return 0;
+  800e9b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800ea0:	f6 c6 08             	test   $0x8,%dh
+  800ea3:	74 15                	je     800eba <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ea5:	89 c2                	mov    %eax,%edx
+  800ea7:	c1 ea 08             	shr    $0x8,%edx
+  800eaa:	83 e2 0f             	and    $0xf,%edx
+  800ead:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800eb2:	83 fa 06             	cmp    $0x6,%edx
+  800eb5:	74 0e                	je     800ec5 <sys_env_destroy+0x79>
+  800eb7:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800eba:	0f b6 c9             	movzbl %cl,%ecx
+  800ebd:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800ec3:	eb 99                	jmp    800e5e <sys_env_destroy+0x12>
+  800ec5:	89 c2                	mov    %eax,%edx
+  800ec7:	c1 ea 04             	shr    $0x4,%edx
+  800eca:	83 e2 0f             	and    $0xf,%edx
+  800ecd:	83 fa 02             	cmp    $0x2,%edx
+  800ed0:	77 e5                	ja     800eb7 <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  800ed2:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800ed5:	83 f8 02             	cmp    $0x2,%eax
+  800ed8:	0f 97 c1             	seta   %cl
+  800edb:	0f b6 c9             	movzbl %cl,%ecx
+  800ede:	eb d7                	jmp    800eb7 <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  800ee0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ee5:	b8 03 00 00 00       	mov    $0x3,%eax
+  800eea:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eed:	89 cb                	mov    %ecx,%ebx
+  800eef:	89 cf                	mov    %ecx,%edi
+  800ef1:	89 ce                	mov    %ecx,%esi
+  800ef3:	cd 30                	int    $0x30
+  800ef5:	eb 91                	jmp    800e88 <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef7:	83 ec 0c             	sub    $0xc,%esp
+  800efa:	50                   	push   %eax
+  800efb:	6a 03                	push   $0x3
+  800efd:	68 f9 2b 80 00       	push   $0x802bf9
+  800f02:	6a 4a                	push   $0x4a
+  800f04:	68 16 2c 80 00       	push   $0x802c16
+  800f09:	e8 1e 17 00 00       	call   80262c <_panic>
+
+00800f0e <sys_getenvid>:
+{
+  800f0e:	55                   	push   %ebp
+  800f0f:	89 e5                	mov    %esp,%ebp
+  800f11:	57                   	push   %edi
+  800f12:	56                   	push   %esi
+  800f13:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800f14:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f1b:	78 2e                	js     800f4b <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  800f1d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f24:	74 71                	je     800f97 <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  800f26:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f2b:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f30:	89 d1                	mov    %edx,%ecx
+  800f32:	89 d3                	mov    %edx,%ebx
+  800f34:	89 d7                	mov    %edx,%edi
+  800f36:	89 d6                	mov    %edx,%esi
+  800f38:	55                   	push   %ebp
+  800f39:	68 42 0f 80 00       	push   $0x800f42
+  800f3e:	89 e5                	mov    %esp,%ebp
+  800f40:	0f 34                	sysenter
+  800f42:	83 c4 04             	add    $0x4,%esp
+  800f45:	5d                   	pop    %ebp
+}
+  800f46:	5b                   	pop    %ebx
+  800f47:	5e                   	pop    %esi
+  800f48:	5f                   	pop    %edi
+  800f49:	5d                   	pop    %ebp
+  800f4a:	c3                   	ret
+  800f4b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f50:	0f a2                	cpuid
+		return 0;
+  800f52:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f57:	f6 c6 08             	test   $0x8,%dh
+  800f5a:	74 15                	je     800f71 <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f5c:	89 c2                	mov    %eax,%edx
+  800f5e:	c1 ea 08             	shr    $0x8,%edx
+  800f61:	83 e2 0f             	and    $0xf,%edx
+  800f64:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f69:	83 fa 06             	cmp    $0x6,%edx
+  800f6c:	74 0e                	je     800f7c <sys_getenvid+0x6e>
+  800f6e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f71:	0f b6 c9             	movzbl %cl,%ecx
+  800f74:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800f7a:	eb a1                	jmp    800f1d <sys_getenvid+0xf>
+  800f7c:	89 c2                	mov    %eax,%edx
+  800f7e:	c1 ea 04             	shr    $0x4,%edx
+  800f81:	83 e2 0f             	and    $0xf,%edx
+  800f84:	83 fa 02             	cmp    $0x2,%edx
+  800f87:	77 e5                	ja     800f6e <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  800f89:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f8c:	83 f8 02             	cmp    $0x2,%eax
+  800f8f:	0f 97 c1             	seta   %cl
+  800f92:	0f b6 c9             	movzbl %cl,%ecx
+  800f95:	eb d7                	jmp    800f6e <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  800f97:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f9c:	b8 02 00 00 00       	mov    $0x2,%eax
+  800fa1:	89 d1                	mov    %edx,%ecx
+  800fa3:	89 d3                	mov    %edx,%ebx
+  800fa5:	89 d7                	mov    %edx,%edi
+  800fa7:	89 d6                	mov    %edx,%esi
+  800fa9:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  800fab:	eb 99                	jmp    800f46 <sys_getenvid+0x38>
+
+00800fad <sys_page_alloc>:
+{
+  800fad:	55                   	push   %ebp
+  800fae:	89 e5                	mov    %esp,%ebp
+  800fb0:	57                   	push   %edi
+  800fb1:	56                   	push   %esi
+  800fb2:	53                   	push   %ebx
+  800fb3:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  800fb6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fbd:	78 38                	js     800ff7 <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  800fbf:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800fc6:	74 7b                	je     801043 <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  800fc8:	be 00 00 00 00       	mov    $0x0,%esi
+  800fcd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd3:	b8 04 00 00 00       	mov    $0x4,%eax
+  800fd8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fdb:	89 f7                	mov    %esi,%edi
+  800fdd:	55                   	push   %ebp
+  800fde:	68 e7 0f 80 00       	push   $0x800fe7
+  800fe3:	89 e5                	mov    %esp,%ebp
+  800fe5:	0f 34                	sysenter
+  800fe7:	83 c4 04             	add    $0x4,%esp
+  800fea:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800feb:	85 c0                	test   %eax,%eax
+  800fed:	7f 6d                	jg     80105c <sys_page_alloc+0xaf>
+}
+  800fef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff2:	5b                   	pop    %ebx
+  800ff3:	5e                   	pop    %esi
+  800ff4:	5f                   	pop    %edi
+  800ff5:	5d                   	pop    %ebp
+  800ff6:	c3                   	ret
+  800ff7:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ffc:	0f a2                	cpuid
+		return 0;
+  800ffe:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801003:	f6 c6 08             	test   $0x8,%dh
+  801006:	74 15                	je     80101d <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801008:	89 c2                	mov    %eax,%edx
+  80100a:	c1 ea 08             	shr    $0x8,%edx
+  80100d:	83 e2 0f             	and    $0xf,%edx
+  801010:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801015:	83 fa 06             	cmp    $0x6,%edx
+  801018:	74 0e                	je     801028 <sys_page_alloc+0x7b>
+  80101a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80101d:	0f b6 c9             	movzbl %cl,%ecx
+  801020:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801026:	eb 97                	jmp    800fbf <sys_page_alloc+0x12>
+  801028:	89 c2                	mov    %eax,%edx
+  80102a:	c1 ea 04             	shr    $0x4,%edx
+  80102d:	83 e2 0f             	and    $0xf,%edx
+  801030:	83 fa 02             	cmp    $0x2,%edx
+  801033:	77 e5                	ja     80101a <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  801035:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801038:	83 f8 02             	cmp    $0x2,%eax
+  80103b:	0f 97 c1             	seta   %cl
+  80103e:	0f b6 c9             	movzbl %cl,%ecx
+  801041:	eb d7                	jmp    80101a <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  801043:	be 00 00 00 00       	mov    $0x0,%esi
+  801048:	b8 04 00 00 00       	mov    $0x4,%eax
+  80104d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801050:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801053:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801056:	89 f7                	mov    %esi,%edi
+  801058:	cd 30                	int    $0x30
+  80105a:	eb 8f                	jmp    800feb <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80105c:	83 ec 0c             	sub    $0xc,%esp
+  80105f:	50                   	push   %eax
+  801060:	6a 04                	push   $0x4
+  801062:	68 f9 2b 80 00       	push   $0x802bf9
+  801067:	6a 4a                	push   $0x4a
+  801069:	68 16 2c 80 00       	push   $0x802c16
+  80106e:	e8 b9 15 00 00       	call   80262c <_panic>
+
+00801073 <sys_page_map>:
+{
+  801073:	55                   	push   %ebp
+  801074:	89 e5                	mov    %esp,%ebp
+  801076:	57                   	push   %edi
+  801077:	56                   	push   %esi
+  801078:	53                   	push   %ebx
+  801079:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80107c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801083:	78 37                	js     8010bc <sys_page_map+0x49>
+	if (syscall_sysenter)
+  801085:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80108c:	74 7a                	je     801108 <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  80108e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801091:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801094:	b8 05 00 00 00       	mov    $0x5,%eax
+  801099:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80109c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80109f:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010a2:	55                   	push   %ebp
+  8010a3:	68 ac 10 80 00       	push   $0x8010ac
+  8010a8:	89 e5                	mov    %esp,%ebp
+  8010aa:	0f 34                	sysenter
+  8010ac:	83 c4 04             	add    $0x4,%esp
+  8010af:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8010b0:	85 c0                	test   %eax,%eax
+  8010b2:	7f 6c                	jg     801120 <sys_page_map+0xad>
+}
+  8010b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010b7:	5b                   	pop    %ebx
+  8010b8:	5e                   	pop    %esi
+  8010b9:	5f                   	pop    %edi
+  8010ba:	5d                   	pop    %ebp
+  8010bb:	c3                   	ret
+  8010bc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010c1:	0f a2                	cpuid
+		return 0;
+  8010c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8010c8:	f6 c6 08             	test   $0x8,%dh
+  8010cb:	74 15                	je     8010e2 <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010cd:	89 c2                	mov    %eax,%edx
+  8010cf:	c1 ea 08             	shr    $0x8,%edx
+  8010d2:	83 e2 0f             	and    $0xf,%edx
+  8010d5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8010da:	83 fa 06             	cmp    $0x6,%edx
+  8010dd:	74 0e                	je     8010ed <sys_page_map+0x7a>
+  8010df:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8010e2:	0f b6 c9             	movzbl %cl,%ecx
+  8010e5:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8010eb:	eb 98                	jmp    801085 <sys_page_map+0x12>
+  8010ed:	89 c2                	mov    %eax,%edx
+  8010ef:	c1 ea 04             	shr    $0x4,%edx
+  8010f2:	83 e2 0f             	and    $0xf,%edx
+  8010f5:	83 fa 02             	cmp    $0x2,%edx
+  8010f8:	77 e5                	ja     8010df <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  8010fa:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8010fd:	83 f8 02             	cmp    $0x2,%eax
+  801100:	0f 97 c1             	seta   %cl
+  801103:	0f b6 c9             	movzbl %cl,%ecx
+  801106:	eb d7                	jmp    8010df <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  801108:	b8 05 00 00 00       	mov    $0x5,%eax
+  80110d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801110:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801113:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801116:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801119:	8b 75 18             	mov    0x18(%ebp),%esi
+  80111c:	cd 30                	int    $0x30
+  80111e:	eb 90                	jmp    8010b0 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801120:	83 ec 0c             	sub    $0xc,%esp
+  801123:	50                   	push   %eax
+  801124:	6a 05                	push   $0x5
+  801126:	68 f9 2b 80 00       	push   $0x802bf9
+  80112b:	6a 4a                	push   $0x4a
+  80112d:	68 16 2c 80 00       	push   $0x802c16
+  801132:	e8 f5 14 00 00       	call   80262c <_panic>
+
+00801137 <sys_page_unmap>:
+{
+  801137:	55                   	push   %ebp
+  801138:	89 e5                	mov    %esp,%ebp
+  80113a:	57                   	push   %edi
+  80113b:	56                   	push   %esi
+  80113c:	53                   	push   %ebx
+  80113d:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801140:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801147:	78 37                	js     801180 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  801149:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801150:	74 7a                	je     8011cc <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  801152:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801157:	8b 55 08             	mov    0x8(%ebp),%edx
+  80115a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115d:	b8 06 00 00 00       	mov    $0x6,%eax
+  801162:	89 df                	mov    %ebx,%edi
+  801164:	89 de                	mov    %ebx,%esi
+  801166:	55                   	push   %ebp
+  801167:	68 70 11 80 00       	push   $0x801170
+  80116c:	89 e5                	mov    %esp,%ebp
+  80116e:	0f 34                	sysenter
+  801170:	83 c4 04             	add    $0x4,%esp
+  801173:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801174:	85 c0                	test   %eax,%eax
+  801176:	7f 6c                	jg     8011e4 <sys_page_unmap+0xad>
+}
+  801178:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80117b:	5b                   	pop    %ebx
+  80117c:	5e                   	pop    %esi
+  80117d:	5f                   	pop    %edi
+  80117e:	5d                   	pop    %ebp
+  80117f:	c3                   	ret
+  801180:	b8 01 00 00 00       	mov    $0x1,%eax
+  801185:	0f a2                	cpuid
+		return 0;
+  801187:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80118c:	f6 c6 08             	test   $0x8,%dh
+  80118f:	74 15                	je     8011a6 <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801191:	89 c2                	mov    %eax,%edx
+  801193:	c1 ea 08             	shr    $0x8,%edx
+  801196:	83 e2 0f             	and    $0xf,%edx
+  801199:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80119e:	83 fa 06             	cmp    $0x6,%edx
+  8011a1:	74 0e                	je     8011b1 <sys_page_unmap+0x7a>
+  8011a3:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8011a6:	0f b6 c9             	movzbl %cl,%ecx
+  8011a9:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8011af:	eb 98                	jmp    801149 <sys_page_unmap+0x12>
+  8011b1:	89 c2                	mov    %eax,%edx
+  8011b3:	c1 ea 04             	shr    $0x4,%edx
+  8011b6:	83 e2 0f             	and    $0xf,%edx
+  8011b9:	83 fa 02             	cmp    $0x2,%edx
+  8011bc:	77 e5                	ja     8011a3 <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  8011be:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011c1:	83 f8 02             	cmp    $0x2,%eax
+  8011c4:	0f 97 c1             	seta   %cl
+  8011c7:	0f b6 c9             	movzbl %cl,%ecx
+  8011ca:	eb d7                	jmp    8011a3 <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  8011cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d1:	b8 06 00 00 00       	mov    $0x6,%eax
+  8011d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011dc:	89 df                	mov    %ebx,%edi
+  8011de:	89 de                	mov    %ebx,%esi
+  8011e0:	cd 30                	int    $0x30
+  8011e2:	eb 90                	jmp    801174 <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011e4:	83 ec 0c             	sub    $0xc,%esp
+  8011e7:	50                   	push   %eax
+  8011e8:	6a 06                	push   $0x6
+  8011ea:	68 f9 2b 80 00       	push   $0x802bf9
+  8011ef:	6a 4a                	push   $0x4a
+  8011f1:	68 16 2c 80 00       	push   $0x802c16
+  8011f6:	e8 31 14 00 00       	call   80262c <_panic>
+
+008011fb <sys_page_copy>:
+{
+  8011fb:	55                   	push   %ebp
+  8011fc:	89 e5                	mov    %esp,%ebp
+  8011fe:	57                   	push   %edi
+  8011ff:	56                   	push   %esi
+  801200:	53                   	push   %ebx
+  801201:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801204:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80120b:	78 37                	js     801244 <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  80120d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801214:	74 7a                	je     801290 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  801216:	8b 55 08             	mov    0x8(%ebp),%edx
+  801219:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80121c:	b8 29 00 00 00       	mov    $0x29,%eax
+  801221:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801224:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801227:	8b 75 18             	mov    0x18(%ebp),%esi
+  80122a:	55                   	push   %ebp
+  80122b:	68 34 12 80 00       	push   $0x801234
+  801230:	89 e5                	mov    %esp,%ebp
+  801232:	0f 34                	sysenter
+  801234:	83 c4 04             	add    $0x4,%esp
+  801237:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801238:	85 c0                	test   %eax,%eax
+  80123a:	7f 6c                	jg     8012a8 <sys_page_copy+0xad>
+}
+  80123c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80123f:	5b                   	pop    %ebx
+  801240:	5e                   	pop    %esi
+  801241:	5f                   	pop    %edi
+  801242:	5d                   	pop    %ebp
+  801243:	c3                   	ret
+  801244:	b8 01 00 00 00       	mov    $0x1,%eax
+  801249:	0f a2                	cpuid
+		return 0;
+  80124b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801250:	f6 c6 08             	test   $0x8,%dh
+  801253:	74 15                	je     80126a <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801255:	89 c2                	mov    %eax,%edx
+  801257:	c1 ea 08             	shr    $0x8,%edx
+  80125a:	83 e2 0f             	and    $0xf,%edx
+  80125d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801262:	83 fa 06             	cmp    $0x6,%edx
+  801265:	74 0e                	je     801275 <sys_page_copy+0x7a>
+  801267:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80126a:	0f b6 c9             	movzbl %cl,%ecx
+  80126d:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801273:	eb 98                	jmp    80120d <sys_page_copy+0x12>
+  801275:	89 c2                	mov    %eax,%edx
+  801277:	c1 ea 04             	shr    $0x4,%edx
+  80127a:	83 e2 0f             	and    $0xf,%edx
+  80127d:	83 fa 02             	cmp    $0x2,%edx
+  801280:	77 e5                	ja     801267 <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  801282:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801285:	83 f8 02             	cmp    $0x2,%eax
+  801288:	0f 97 c1             	seta   %cl
+  80128b:	0f b6 c9             	movzbl %cl,%ecx
+  80128e:	eb d7                	jmp    801267 <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  801290:	b8 29 00 00 00       	mov    $0x29,%eax
+  801295:	8b 55 08             	mov    0x8(%ebp),%edx
+  801298:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80129b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80129e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012a1:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012a4:	cd 30                	int    $0x30
+  8012a6:	eb 90                	jmp    801238 <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012a8:	83 ec 0c             	sub    $0xc,%esp
+  8012ab:	50                   	push   %eax
+  8012ac:	6a 29                	push   $0x29
+  8012ae:	68 f9 2b 80 00       	push   $0x802bf9
+  8012b3:	6a 4a                	push   $0x4a
+  8012b5:	68 16 2c 80 00       	push   $0x802c16
+  8012ba:	e8 6d 13 00 00       	call   80262c <_panic>
+
+008012bf <sys_yield>:
+{
+  8012bf:	55                   	push   %ebp
+  8012c0:	89 e5                	mov    %esp,%ebp
+  8012c2:	57                   	push   %edi
+  8012c3:	56                   	push   %esi
+  8012c4:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8012c5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8012cc:	78 2e                	js     8012fc <sys_yield+0x3d>
+	if (syscall_sysenter)
+  8012ce:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8012d5:	74 71                	je     801348 <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  8012d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012dc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8012e1:	89 d1                	mov    %edx,%ecx
+  8012e3:	89 d3                	mov    %edx,%ebx
+  8012e5:	89 d7                	mov    %edx,%edi
+  8012e7:	89 d6                	mov    %edx,%esi
+  8012e9:	55                   	push   %ebp
+  8012ea:	68 f3 12 80 00       	push   $0x8012f3
+  8012ef:	89 e5                	mov    %esp,%ebp
+  8012f1:	0f 34                	sysenter
+  8012f3:	83 c4 04             	add    $0x4,%esp
+  8012f6:	5d                   	pop    %ebp
+}
+  8012f7:	5b                   	pop    %ebx
+  8012f8:	5e                   	pop    %esi
+  8012f9:	5f                   	pop    %edi
+  8012fa:	5d                   	pop    %ebp
+  8012fb:	c3                   	ret
+  8012fc:	b8 01 00 00 00       	mov    $0x1,%eax
+  801301:	0f a2                	cpuid
+		return 0;
+  801303:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801308:	f6 c6 08             	test   $0x8,%dh
+  80130b:	74 15                	je     801322 <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80130d:	89 c2                	mov    %eax,%edx
+  80130f:	c1 ea 08             	shr    $0x8,%edx
+  801312:	83 e2 0f             	and    $0xf,%edx
+  801315:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80131a:	83 fa 06             	cmp    $0x6,%edx
+  80131d:	74 0e                	je     80132d <sys_yield+0x6e>
+  80131f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801322:	0f b6 c9             	movzbl %cl,%ecx
+  801325:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80132b:	eb a1                	jmp    8012ce <sys_yield+0xf>
+  80132d:	89 c2                	mov    %eax,%edx
+  80132f:	c1 ea 04             	shr    $0x4,%edx
+  801332:	83 e2 0f             	and    $0xf,%edx
+  801335:	83 fa 02             	cmp    $0x2,%edx
+  801338:	77 e5                	ja     80131f <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  80133a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80133d:	83 f8 02             	cmp    $0x2,%eax
+  801340:	0f 97 c1             	seta   %cl
+  801343:	0f b6 c9             	movzbl %cl,%ecx
+  801346:	eb d7                	jmp    80131f <sys_yield+0x60>
+		asm volatile("int %1\n"
+  801348:	ba 00 00 00 00       	mov    $0x0,%edx
+  80134d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801352:	89 d1                	mov    %edx,%ecx
+  801354:	89 d3                	mov    %edx,%ebx
+  801356:	89 d7                	mov    %edx,%edi
+  801358:	89 d6                	mov    %edx,%esi
+  80135a:	cd 30                	int    $0x30
+}
+  80135c:	eb 99                	jmp    8012f7 <sys_yield+0x38>
+
+0080135e <sys_env_set_status>:
+{
+  80135e:	55                   	push   %ebp
+  80135f:	89 e5                	mov    %esp,%ebp
+  801361:	57                   	push   %edi
+  801362:	56                   	push   %esi
+  801363:	53                   	push   %ebx
+  801364:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801367:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80136e:	78 37                	js     8013a7 <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  801370:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801377:	74 7a                	je     8013f3 <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  801379:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80137e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801381:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801384:	b8 08 00 00 00       	mov    $0x8,%eax
+  801389:	89 df                	mov    %ebx,%edi
+  80138b:	89 de                	mov    %ebx,%esi
+  80138d:	55                   	push   %ebp
+  80138e:	68 97 13 80 00       	push   $0x801397
+  801393:	89 e5                	mov    %esp,%ebp
+  801395:	0f 34                	sysenter
+  801397:	83 c4 04             	add    $0x4,%esp
+  80139a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80139b:	85 c0                	test   %eax,%eax
+  80139d:	7f 6c                	jg     80140b <sys_env_set_status+0xad>
+}
+  80139f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013a2:	5b                   	pop    %ebx
+  8013a3:	5e                   	pop    %esi
+  8013a4:	5f                   	pop    %edi
+  8013a5:	5d                   	pop    %ebp
+  8013a6:	c3                   	ret
+  8013a7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013ac:	0f a2                	cpuid
+		return 0;
+  8013ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8013b3:	f6 c6 08             	test   $0x8,%dh
+  8013b6:	74 15                	je     8013cd <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013b8:	89 c2                	mov    %eax,%edx
+  8013ba:	c1 ea 08             	shr    $0x8,%edx
+  8013bd:	83 e2 0f             	and    $0xf,%edx
+  8013c0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8013c5:	83 fa 06             	cmp    $0x6,%edx
+  8013c8:	74 0e                	je     8013d8 <sys_env_set_status+0x7a>
+  8013ca:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8013cd:	0f b6 c9             	movzbl %cl,%ecx
+  8013d0:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8013d6:	eb 98                	jmp    801370 <sys_env_set_status+0x12>
+  8013d8:	89 c2                	mov    %eax,%edx
+  8013da:	c1 ea 04             	shr    $0x4,%edx
+  8013dd:	83 e2 0f             	and    $0xf,%edx
+  8013e0:	83 fa 02             	cmp    $0x2,%edx
+  8013e3:	77 e5                	ja     8013ca <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  8013e5:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8013e8:	83 f8 02             	cmp    $0x2,%eax
+  8013eb:	0f 97 c1             	seta   %cl
+  8013ee:	0f b6 c9             	movzbl %cl,%ecx
+  8013f1:	eb d7                	jmp    8013ca <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  8013f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013f8:	b8 08 00 00 00       	mov    $0x8,%eax
+  8013fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801400:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801403:	89 df                	mov    %ebx,%edi
+  801405:	89 de                	mov    %ebx,%esi
+  801407:	cd 30                	int    $0x30
+  801409:	eb 90                	jmp    80139b <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80140b:	83 ec 0c             	sub    $0xc,%esp
+  80140e:	50                   	push   %eax
+  80140f:	6a 08                	push   $0x8
+  801411:	68 f9 2b 80 00       	push   $0x802bf9
+  801416:	6a 4a                	push   $0x4a
+  801418:	68 16 2c 80 00       	push   $0x802c16
+  80141d:	e8 0a 12 00 00       	call   80262c <_panic>
+
+00801422 <sys_sysinfo>:
+{
+  801422:	55                   	push   %ebp
+  801423:	89 e5                	mov    %esp,%ebp
+  801425:	57                   	push   %edi
+  801426:	56                   	push   %esi
+  801427:	53                   	push   %ebx
+  801428:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80142b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801432:	78 36                	js     80146a <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  801434:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80143b:	74 79                	je     8014b6 <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  80143d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801440:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801445:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80144a:	89 cb                	mov    %ecx,%ebx
+  80144c:	89 cf                	mov    %ecx,%edi
+  80144e:	89 ce                	mov    %ecx,%esi
+  801450:	55                   	push   %ebp
+  801451:	68 5a 14 80 00       	push   $0x80145a
+  801456:	89 e5                	mov    %esp,%ebp
+  801458:	0f 34                	sysenter
+  80145a:	83 c4 04             	add    $0x4,%esp
+  80145d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80145e:	85 c0                	test   %eax,%eax
+  801460:	7f 6b                	jg     8014cd <sys_sysinfo+0xab>
+}
+  801462:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801465:	5b                   	pop    %ebx
+  801466:	5e                   	pop    %esi
+  801467:	5f                   	pop    %edi
+  801468:	5d                   	pop    %ebp
+  801469:	c3                   	ret
+  80146a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80146f:	0f a2                	cpuid
+		return 0;
+  801471:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801476:	f6 c6 08             	test   $0x8,%dh
+  801479:	74 15                	je     801490 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80147b:	89 c2                	mov    %eax,%edx
+  80147d:	c1 ea 08             	shr    $0x8,%edx
+  801480:	83 e2 0f             	and    $0xf,%edx
+  801483:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801488:	83 fa 06             	cmp    $0x6,%edx
+  80148b:	74 0e                	je     80149b <sys_sysinfo+0x79>
+  80148d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801490:	0f b6 c9             	movzbl %cl,%ecx
+  801493:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801499:	eb 99                	jmp    801434 <sys_sysinfo+0x12>
+  80149b:	89 c2                	mov    %eax,%edx
+  80149d:	c1 ea 04             	shr    $0x4,%edx
+  8014a0:	83 e2 0f             	and    $0xf,%edx
+  8014a3:	83 fa 02             	cmp    $0x2,%edx
+  8014a6:	77 e5                	ja     80148d <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  8014a8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014ab:	83 f8 02             	cmp    $0x2,%eax
+  8014ae:	0f 97 c1             	seta   %cl
+  8014b1:	0f b6 c9             	movzbl %cl,%ecx
+  8014b4:	eb d7                	jmp    80148d <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  8014b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014bb:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8014c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c3:	89 cb                	mov    %ecx,%ebx
+  8014c5:	89 cf                	mov    %ecx,%edi
+  8014c7:	89 ce                	mov    %ecx,%esi
+  8014c9:	cd 30                	int    $0x30
+  8014cb:	eb 91                	jmp    80145e <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014cd:	83 ec 0c             	sub    $0xc,%esp
+  8014d0:	50                   	push   %eax
+  8014d1:	6a 0b                	push   $0xb
+  8014d3:	68 f9 2b 80 00       	push   $0x802bf9
+  8014d8:	6a 4a                	push   $0x4a
+  8014da:	68 16 2c 80 00       	push   $0x802c16
+  8014df:	e8 48 11 00 00       	call   80262c <_panic>
+
+008014e4 <sys_env_set_trapframe>:
+{
+  8014e4:	55                   	push   %ebp
+  8014e5:	89 e5                	mov    %esp,%ebp
+  8014e7:	57                   	push   %edi
+  8014e8:	56                   	push   %esi
+  8014e9:	53                   	push   %ebx
+  8014ea:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8014ed:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8014f4:	78 37                	js     80152d <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  8014f6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8014fd:	74 7a                	je     801579 <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  8014ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801504:	8b 55 08             	mov    0x8(%ebp),%edx
+  801507:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80150a:	b8 13 00 00 00       	mov    $0x13,%eax
+  80150f:	89 df                	mov    %ebx,%edi
+  801511:	89 de                	mov    %ebx,%esi
+  801513:	55                   	push   %ebp
+  801514:	68 1d 15 80 00       	push   $0x80151d
+  801519:	89 e5                	mov    %esp,%ebp
+  80151b:	0f 34                	sysenter
+  80151d:	83 c4 04             	add    $0x4,%esp
+  801520:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801521:	85 c0                	test   %eax,%eax
+  801523:	7f 6c                	jg     801591 <sys_env_set_trapframe+0xad>
+}
+  801525:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801528:	5b                   	pop    %ebx
+  801529:	5e                   	pop    %esi
+  80152a:	5f                   	pop    %edi
+  80152b:	5d                   	pop    %ebp
+  80152c:	c3                   	ret
+  80152d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801532:	0f a2                	cpuid
+		return 0;
+  801534:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801539:	f6 c6 08             	test   $0x8,%dh
+  80153c:	74 15                	je     801553 <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80153e:	89 c2                	mov    %eax,%edx
+  801540:	c1 ea 08             	shr    $0x8,%edx
+  801543:	83 e2 0f             	and    $0xf,%edx
+  801546:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80154b:	83 fa 06             	cmp    $0x6,%edx
+  80154e:	74 0e                	je     80155e <sys_env_set_trapframe+0x7a>
+  801550:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801553:	0f b6 c9             	movzbl %cl,%ecx
+  801556:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80155c:	eb 98                	jmp    8014f6 <sys_env_set_trapframe+0x12>
+  80155e:	89 c2                	mov    %eax,%edx
+  801560:	c1 ea 04             	shr    $0x4,%edx
+  801563:	83 e2 0f             	and    $0xf,%edx
+  801566:	83 fa 02             	cmp    $0x2,%edx
+  801569:	77 e5                	ja     801550 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  80156b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80156e:	83 f8 02             	cmp    $0x2,%eax
+  801571:	0f 97 c1             	seta   %cl
+  801574:	0f b6 c9             	movzbl %cl,%ecx
+  801577:	eb d7                	jmp    801550 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  801579:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80157e:	b8 13 00 00 00       	mov    $0x13,%eax
+  801583:	8b 55 08             	mov    0x8(%ebp),%edx
+  801586:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801589:	89 df                	mov    %ebx,%edi
+  80158b:	89 de                	mov    %ebx,%esi
+  80158d:	cd 30                	int    $0x30
+  80158f:	eb 90                	jmp    801521 <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801591:	83 ec 0c             	sub    $0xc,%esp
+  801594:	50                   	push   %eax
+  801595:	6a 13                	push   $0x13
+  801597:	68 f9 2b 80 00       	push   $0x802bf9
+  80159c:	6a 4a                	push   $0x4a
+  80159e:	68 16 2c 80 00       	push   $0x802c16
+  8015a3:	e8 84 10 00 00       	call   80262c <_panic>
+
+008015a8 <sys_env_set_stack_limit>:
+{
+  8015a8:	55                   	push   %ebp
+  8015a9:	89 e5                	mov    %esp,%ebp
+  8015ab:	57                   	push   %edi
+  8015ac:	56                   	push   %esi
+  8015ad:	53                   	push   %ebx
+  8015ae:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8015b1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8015b8:	78 37                	js     8015f1 <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  8015ba:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8015c1:	74 7a                	je     80163d <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  8015c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015ce:	b8 19 00 00 00       	mov    $0x19,%eax
+  8015d3:	89 df                	mov    %ebx,%edi
+  8015d5:	89 de                	mov    %ebx,%esi
+  8015d7:	55                   	push   %ebp
+  8015d8:	68 e1 15 80 00       	push   $0x8015e1
+  8015dd:	89 e5                	mov    %esp,%ebp
+  8015df:	0f 34                	sysenter
+  8015e1:	83 c4 04             	add    $0x4,%esp
+  8015e4:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8015e5:	85 c0                	test   %eax,%eax
+  8015e7:	7f 6c                	jg     801655 <sys_env_set_stack_limit+0xad>
+}
+  8015e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015ec:	5b                   	pop    %ebx
+  8015ed:	5e                   	pop    %esi
+  8015ee:	5f                   	pop    %edi
+  8015ef:	5d                   	pop    %ebp
+  8015f0:	c3                   	ret
+  8015f1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015f6:	0f a2                	cpuid
+		return 0;
+  8015f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8015fd:	f6 c6 08             	test   $0x8,%dh
+  801600:	74 15                	je     801617 <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801602:	89 c2                	mov    %eax,%edx
+  801604:	c1 ea 08             	shr    $0x8,%edx
+  801607:	83 e2 0f             	and    $0xf,%edx
+  80160a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80160f:	83 fa 06             	cmp    $0x6,%edx
+  801612:	74 0e                	je     801622 <sys_env_set_stack_limit+0x7a>
+  801614:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801617:	0f b6 c9             	movzbl %cl,%ecx
+  80161a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801620:	eb 98                	jmp    8015ba <sys_env_set_stack_limit+0x12>
+  801622:	89 c2                	mov    %eax,%edx
+  801624:	c1 ea 04             	shr    $0x4,%edx
+  801627:	83 e2 0f             	and    $0xf,%edx
+  80162a:	83 fa 02             	cmp    $0x2,%edx
+  80162d:	77 e5                	ja     801614 <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  80162f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801632:	83 f8 02             	cmp    $0x2,%eax
+  801635:	0f 97 c1             	seta   %cl
+  801638:	0f b6 c9             	movzbl %cl,%ecx
+  80163b:	eb d7                	jmp    801614 <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  80163d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801642:	b8 19 00 00 00       	mov    $0x19,%eax
+  801647:	8b 55 08             	mov    0x8(%ebp),%edx
+  80164a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80164d:	89 df                	mov    %ebx,%edi
+  80164f:	89 de                	mov    %ebx,%esi
+  801651:	cd 30                	int    $0x30
+  801653:	eb 90                	jmp    8015e5 <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801655:	83 ec 0c             	sub    $0xc,%esp
+  801658:	50                   	push   %eax
+  801659:	6a 19                	push   $0x19
+  80165b:	68 f9 2b 80 00       	push   $0x802bf9
+  801660:	6a 4a                	push   $0x4a
+  801662:	68 16 2c 80 00       	push   $0x802c16
+  801667:	e8 c0 0f 00 00       	call   80262c <_panic>
+
+0080166c <sys_env_set_pgfault_upcall>:
+{
+  80166c:	55                   	push   %ebp
+  80166d:	89 e5                	mov    %esp,%ebp
+  80166f:	57                   	push   %edi
+  801670:	56                   	push   %esi
+  801671:	53                   	push   %ebx
+  801672:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801675:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80167c:	78 37                	js     8016b5 <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  80167e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801685:	74 7a                	je     801701 <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  801687:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80168c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80168f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801692:	b8 09 00 00 00       	mov    $0x9,%eax
+  801697:	89 df                	mov    %ebx,%edi
+  801699:	89 de                	mov    %ebx,%esi
+  80169b:	55                   	push   %ebp
+  80169c:	68 a5 16 80 00       	push   $0x8016a5
+  8016a1:	89 e5                	mov    %esp,%ebp
+  8016a3:	0f 34                	sysenter
+  8016a5:	83 c4 04             	add    $0x4,%esp
+  8016a8:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8016a9:	85 c0                	test   %eax,%eax
+  8016ab:	7f 6c                	jg     801719 <sys_env_set_pgfault_upcall+0xad>
+}
+  8016ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016b0:	5b                   	pop    %ebx
+  8016b1:	5e                   	pop    %esi
+  8016b2:	5f                   	pop    %edi
+  8016b3:	5d                   	pop    %ebp
+  8016b4:	c3                   	ret
+  8016b5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016ba:	0f a2                	cpuid
+		return 0;
+  8016bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8016c1:	f6 c6 08             	test   $0x8,%dh
+  8016c4:	74 15                	je     8016db <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016c6:	89 c2                	mov    %eax,%edx
+  8016c8:	c1 ea 08             	shr    $0x8,%edx
+  8016cb:	83 e2 0f             	and    $0xf,%edx
+  8016ce:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8016d3:	83 fa 06             	cmp    $0x6,%edx
+  8016d6:	74 0e                	je     8016e6 <sys_env_set_pgfault_upcall+0x7a>
+  8016d8:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8016db:	0f b6 c9             	movzbl %cl,%ecx
+  8016de:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8016e4:	eb 98                	jmp    80167e <sys_env_set_pgfault_upcall+0x12>
+  8016e6:	89 c2                	mov    %eax,%edx
+  8016e8:	c1 ea 04             	shr    $0x4,%edx
+  8016eb:	83 e2 0f             	and    $0xf,%edx
+  8016ee:	83 fa 02             	cmp    $0x2,%edx
+  8016f1:	77 e5                	ja     8016d8 <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  8016f3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016f6:	83 f8 02             	cmp    $0x2,%eax
+  8016f9:	0f 97 c1             	seta   %cl
+  8016fc:	0f b6 c9             	movzbl %cl,%ecx
+  8016ff:	eb d7                	jmp    8016d8 <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  801701:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801706:	b8 09 00 00 00       	mov    $0x9,%eax
+  80170b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80170e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801711:	89 df                	mov    %ebx,%edi
+  801713:	89 de                	mov    %ebx,%esi
+  801715:	cd 30                	int    $0x30
+  801717:	eb 90                	jmp    8016a9 <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801719:	83 ec 0c             	sub    $0xc,%esp
+  80171c:	50                   	push   %eax
+  80171d:	6a 09                	push   $0x9
+  80171f:	68 f9 2b 80 00       	push   $0x802bf9
+  801724:	6a 4a                	push   $0x4a
+  801726:	68 16 2c 80 00       	push   $0x802c16
+  80172b:	e8 fc 0e 00 00       	call   80262c <_panic>
+
+00801730 <sys_ipc_try_send>:
+{
+  801730:	55                   	push   %ebp
+  801731:	89 e5                	mov    %esp,%ebp
+  801733:	57                   	push   %edi
+  801734:	56                   	push   %esi
+  801735:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801736:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80173d:	78 32                	js     801771 <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  80173f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801746:	74 75                	je     8017bd <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801748:	8b 55 08             	mov    0x8(%ebp),%edx
+  80174b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80174e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801753:	be 00 00 00 00       	mov    $0x0,%esi
+  801758:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80175b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80175e:	55                   	push   %ebp
+  80175f:	68 68 17 80 00       	push   $0x801768
+  801764:	89 e5                	mov    %esp,%ebp
+  801766:	0f 34                	sysenter
+  801768:	83 c4 04             	add    $0x4,%esp
+  80176b:	5d                   	pop    %ebp
+}
+  80176c:	5b                   	pop    %ebx
+  80176d:	5e                   	pop    %esi
+  80176e:	5f                   	pop    %edi
+  80176f:	5d                   	pop    %ebp
+  801770:	c3                   	ret
+  801771:	b8 01 00 00 00       	mov    $0x1,%eax
+  801776:	0f a2                	cpuid
+		return 0;
+  801778:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80177d:	f6 c6 08             	test   $0x8,%dh
+  801780:	74 15                	je     801797 <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801782:	89 c2                	mov    %eax,%edx
+  801784:	c1 ea 08             	shr    $0x8,%edx
+  801787:	83 e2 0f             	and    $0xf,%edx
+  80178a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80178f:	83 fa 06             	cmp    $0x6,%edx
+  801792:	74 0e                	je     8017a2 <sys_ipc_try_send+0x72>
+  801794:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801797:	0f b6 c9             	movzbl %cl,%ecx
+  80179a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8017a0:	eb 9d                	jmp    80173f <sys_ipc_try_send+0xf>
+  8017a2:	89 c2                	mov    %eax,%edx
+  8017a4:	c1 ea 04             	shr    $0x4,%edx
+  8017a7:	83 e2 0f             	and    $0xf,%edx
+  8017aa:	83 fa 02             	cmp    $0x2,%edx
+  8017ad:	77 e5                	ja     801794 <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  8017af:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017b2:	83 f8 02             	cmp    $0x2,%eax
+  8017b5:	0f 97 c1             	seta   %cl
+  8017b8:	0f b6 c9             	movzbl %cl,%ecx
+  8017bb:	eb d7                	jmp    801794 <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  8017bd:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8017c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8017c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017cd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017d0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8017d3:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  8017d5:	eb 95                	jmp    80176c <sys_ipc_try_send+0x3c>
+
+008017d7 <sys_ipc_send>:
+{
+  8017d7:	55                   	push   %ebp
+  8017d8:	89 e5                	mov    %esp,%ebp
+  8017da:	57                   	push   %edi
+  8017db:	56                   	push   %esi
+  8017dc:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8017dd:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8017e4:	78 32                	js     801818 <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  8017e6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8017ed:	74 75                	je     801864 <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  8017ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017f5:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8017fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8017ff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801802:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801805:	55                   	push   %ebp
+  801806:	68 0f 18 80 00       	push   $0x80180f
+  80180b:	89 e5                	mov    %esp,%ebp
+  80180d:	0f 34                	sysenter
+  80180f:	83 c4 04             	add    $0x4,%esp
+  801812:	5d                   	pop    %ebp
+}
+  801813:	5b                   	pop    %ebx
+  801814:	5e                   	pop    %esi
+  801815:	5f                   	pop    %edi
+  801816:	5d                   	pop    %ebp
+  801817:	c3                   	ret
+  801818:	b8 01 00 00 00       	mov    $0x1,%eax
+  80181d:	0f a2                	cpuid
+		return 0;
+  80181f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801824:	f6 c6 08             	test   $0x8,%dh
+  801827:	74 15                	je     80183e <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801829:	89 c2                	mov    %eax,%edx
+  80182b:	c1 ea 08             	shr    $0x8,%edx
+  80182e:	83 e2 0f             	and    $0xf,%edx
+  801831:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801836:	83 fa 06             	cmp    $0x6,%edx
+  801839:	74 0e                	je     801849 <sys_ipc_send+0x72>
+  80183b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80183e:	0f b6 c9             	movzbl %cl,%ecx
+  801841:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801847:	eb 9d                	jmp    8017e6 <sys_ipc_send+0xf>
+  801849:	89 c2                	mov    %eax,%edx
+  80184b:	c1 ea 04             	shr    $0x4,%edx
+  80184e:	83 e2 0f             	and    $0xf,%edx
+  801851:	83 fa 02             	cmp    $0x2,%edx
+  801854:	77 e5                	ja     80183b <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  801856:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801859:	83 f8 02             	cmp    $0x2,%eax
+  80185c:	0f 97 c1             	seta   %cl
+  80185f:	0f b6 c9             	movzbl %cl,%ecx
+  801862:	eb d7                	jmp    80183b <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  801864:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801869:	be 00 00 00 00       	mov    $0x0,%esi
+  80186e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801871:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801874:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801877:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80187a:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  80187c:	eb 95                	jmp    801813 <sys_ipc_send+0x3c>
+
+0080187e <sys_ipc_recv>:
+{
+  80187e:	55                   	push   %ebp
+  80187f:	89 e5                	mov    %esp,%ebp
+  801881:	57                   	push   %edi
+  801882:	56                   	push   %esi
+  801883:	53                   	push   %ebx
+  801884:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801887:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80188e:	78 36                	js     8018c6 <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  801890:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801897:	74 79                	je     801912 <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  801899:	8b 55 08             	mov    0x8(%ebp),%edx
+  80189c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018a1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8018a6:	89 cb                	mov    %ecx,%ebx
+  8018a8:	89 cf                	mov    %ecx,%edi
+  8018aa:	89 ce                	mov    %ecx,%esi
+  8018ac:	55                   	push   %ebp
+  8018ad:	68 b6 18 80 00       	push   $0x8018b6
+  8018b2:	89 e5                	mov    %esp,%ebp
+  8018b4:	0f 34                	sysenter
+  8018b6:	83 c4 04             	add    $0x4,%esp
+  8018b9:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8018ba:	85 c0                	test   %eax,%eax
+  8018bc:	7f 6b                	jg     801929 <sys_ipc_recv+0xab>
+}
+  8018be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018c1:	5b                   	pop    %ebx
+  8018c2:	5e                   	pop    %esi
+  8018c3:	5f                   	pop    %edi
+  8018c4:	5d                   	pop    %ebp
+  8018c5:	c3                   	ret
+  8018c6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018cb:	0f a2                	cpuid
+		return 0;
+  8018cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8018d2:	f6 c6 08             	test   $0x8,%dh
+  8018d5:	74 15                	je     8018ec <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018d7:	89 c2                	mov    %eax,%edx
+  8018d9:	c1 ea 08             	shr    $0x8,%edx
+  8018dc:	83 e2 0f             	and    $0xf,%edx
+  8018df:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018e4:	83 fa 06             	cmp    $0x6,%edx
+  8018e7:	74 0e                	je     8018f7 <sys_ipc_recv+0x79>
+  8018e9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8018ec:	0f b6 c9             	movzbl %cl,%ecx
+  8018ef:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8018f5:	eb 99                	jmp    801890 <sys_ipc_recv+0x12>
+  8018f7:	89 c2                	mov    %eax,%edx
+  8018f9:	c1 ea 04             	shr    $0x4,%edx
+  8018fc:	83 e2 0f             	and    $0xf,%edx
+  8018ff:	83 fa 02             	cmp    $0x2,%edx
+  801902:	77 e5                	ja     8018e9 <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  801904:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801907:	83 f8 02             	cmp    $0x2,%eax
+  80190a:	0f 97 c1             	seta   %cl
+  80190d:	0f b6 c9             	movzbl %cl,%ecx
+  801910:	eb d7                	jmp    8018e9 <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  801912:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801917:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80191c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80191f:	89 cb                	mov    %ecx,%ebx
+  801921:	89 cf                	mov    %ecx,%edi
+  801923:	89 ce                	mov    %ecx,%esi
+  801925:	cd 30                	int    $0x30
+  801927:	eb 91                	jmp    8018ba <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801929:	83 ec 0c             	sub    $0xc,%esp
+  80192c:	50                   	push   %eax
+  80192d:	6a 0d                	push   $0xd
+  80192f:	68 f9 2b 80 00       	push   $0x802bf9
+  801934:	6a 4a                	push   $0x4a
+  801936:	68 16 2c 80 00       	push   $0x802c16
+  80193b:	e8 ec 0c 00 00       	call   80262c <_panic>
+
+00801940 <sys_ipc_send_range>:
+{
+  801940:	55                   	push   %ebp
+  801941:	89 e5                	mov    %esp,%ebp
+  801943:	57                   	push   %edi
+  801944:	56                   	push   %esi
+  801945:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801946:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80194d:	78 30                	js     80197f <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  80194f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801956:	74 73                	je     8019cb <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801958:	8b 55 08             	mov    0x8(%ebp),%edx
+  80195b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80195e:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801963:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801966:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801969:	8b 75 18             	mov    0x18(%ebp),%esi
+  80196c:	55                   	push   %ebp
+  80196d:	68 76 19 80 00       	push   $0x801976
+  801972:	89 e5                	mov    %esp,%ebp
+  801974:	0f 34                	sysenter
+  801976:	83 c4 04             	add    $0x4,%esp
+  801979:	5d                   	pop    %ebp
+}
+  80197a:	5b                   	pop    %ebx
+  80197b:	5e                   	pop    %esi
+  80197c:	5f                   	pop    %edi
+  80197d:	5d                   	pop    %ebp
+  80197e:	c3                   	ret
+  80197f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801984:	0f a2                	cpuid
+		return 0;
+  801986:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80198b:	f6 c6 08             	test   $0x8,%dh
+  80198e:	74 15                	je     8019a5 <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801990:	89 c2                	mov    %eax,%edx
+  801992:	c1 ea 08             	shr    $0x8,%edx
+  801995:	83 e2 0f             	and    $0xf,%edx
+  801998:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80199d:	83 fa 06             	cmp    $0x6,%edx
+  8019a0:	74 0e                	je     8019b0 <sys_ipc_send_range+0x70>
+  8019a2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8019a5:	0f b6 c9             	movzbl %cl,%ecx
+  8019a8:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8019ae:	eb 9f                	jmp    80194f <sys_ipc_send_range+0xf>
+  8019b0:	89 c2                	mov    %eax,%edx
+  8019b2:	c1 ea 04             	shr    $0x4,%edx
+  8019b5:	83 e2 0f             	and    $0xf,%edx
+  8019b8:	83 fa 02             	cmp    $0x2,%edx
+  8019bb:	77 e5                	ja     8019a2 <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  8019bd:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019c0:	83 f8 02             	cmp    $0x2,%eax
+  8019c3:	0f 97 c1             	seta   %cl
+  8019c6:	0f b6 c9             	movzbl %cl,%ecx
+  8019c9:	eb d7                	jmp    8019a2 <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  8019cb:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8019d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019d6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019d9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8019dc:	8b 75 18             	mov    0x18(%ebp),%esi
+  8019df:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  8019e1:	eb 97                	jmp    80197a <sys_ipc_send_range+0x3a>
+
+008019e3 <sys_ipc_recv_range>:
+{
+  8019e3:	55                   	push   %ebp
+  8019e4:	89 e5                	mov    %esp,%ebp
+  8019e6:	57                   	push   %edi
+  8019e7:	56                   	push   %esi
+  8019e8:	53                   	push   %ebx
+  8019e9:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8019ec:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8019f3:	78 37                	js     801a2c <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  8019f5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8019fc:	74 7a                	je     801a78 <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  8019fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a03:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a09:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801a0e:	89 df                	mov    %ebx,%edi
+  801a10:	89 de                	mov    %ebx,%esi
+  801a12:	55                   	push   %ebp
+  801a13:	68 1c 1a 80 00       	push   $0x801a1c
+  801a18:	89 e5                	mov    %esp,%ebp
+  801a1a:	0f 34                	sysenter
+  801a1c:	83 c4 04             	add    $0x4,%esp
+  801a1f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801a20:	85 c0                	test   %eax,%eax
+  801a22:	7f 6c                	jg     801a90 <sys_ipc_recv_range+0xad>
+}
+  801a24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a27:	5b                   	pop    %ebx
+  801a28:	5e                   	pop    %esi
+  801a29:	5f                   	pop    %edi
+  801a2a:	5d                   	pop    %ebp
+  801a2b:	c3                   	ret
+  801a2c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a31:	0f a2                	cpuid
+		return 0;
+  801a33:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801a38:	f6 c6 08             	test   $0x8,%dh
+  801a3b:	74 15                	je     801a52 <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a3d:	89 c2                	mov    %eax,%edx
+  801a3f:	c1 ea 08             	shr    $0x8,%edx
+  801a42:	83 e2 0f             	and    $0xf,%edx
+  801a45:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a4a:	83 fa 06             	cmp    $0x6,%edx
+  801a4d:	74 0e                	je     801a5d <sys_ipc_recv_range+0x7a>
+  801a4f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a52:	0f b6 c9             	movzbl %cl,%ecx
+  801a55:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801a5b:	eb 98                	jmp    8019f5 <sys_ipc_recv_range+0x12>
+  801a5d:	89 c2                	mov    %eax,%edx
+  801a5f:	c1 ea 04             	shr    $0x4,%edx
+  801a62:	83 e2 0f             	and    $0xf,%edx
+  801a65:	83 fa 02             	cmp    $0x2,%edx
+  801a68:	77 e5                	ja     801a4f <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801a6a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a6d:	83 f8 02             	cmp    $0x2,%eax
+  801a70:	0f 97 c1             	seta   %cl
+  801a73:	0f b6 c9             	movzbl %cl,%ecx
+  801a76:	eb d7                	jmp    801a4f <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801a78:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a7d:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801a82:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a85:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a88:	89 df                	mov    %ebx,%edi
+  801a8a:	89 de                	mov    %ebx,%esi
+  801a8c:	cd 30                	int    $0x30
+  801a8e:	eb 90                	jmp    801a20 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a90:	83 ec 0c             	sub    $0xc,%esp
+  801a93:	50                   	push   %eax
+  801a94:	6a 1f                	push   $0x1f
+  801a96:	68 f9 2b 80 00       	push   $0x802bf9
+  801a9b:	6a 4a                	push   $0x4a
+  801a9d:	68 16 2c 80 00       	push   $0x802c16
+  801aa2:	e8 85 0b 00 00       	call   80262c <_panic>
+
+00801aa7 <sys_ipc_call>:
+{
+  801aa7:	55                   	push   %ebp
+  801aa8:	89 e5                	mov    %esp,%ebp
+  801aaa:	57                   	push   %edi
+  801aab:	56                   	push   %esi
+  801aac:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801aad:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ab0:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801ab5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801ab8:	55                   	push   %ebp
+  801ab9:	56                   	push   %esi
+  801aba:	8b 0e                	mov    (%esi),%ecx
+  801abc:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801abf:	8b 7e 08             	mov    0x8(%esi),%edi
+  801ac2:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801ac5:	8b 76 0c             	mov    0xc(%esi),%esi
+  801ac8:	cd 30                	int    $0x30
+  801aca:	87 34 24             	xchg   %esi,(%esp)
+  801acd:	89 0e                	mov    %ecx,(%esi)
+  801acf:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801ad2:	89 7e 08             	mov    %edi,0x8(%esi)
+  801ad5:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801ad8:	8f 46 0c             	pop    0xc(%esi)
+  801adb:	5d                   	pop    %ebp
+}
+  801adc:	5b                   	pop    %ebx
+  801add:	5e                   	pop    %esi
+  801ade:	5f                   	pop    %edi
+  801adf:	5d                   	pop    %ebp
+  801ae0:	c3                   	ret
+
+00801ae1 <sys_ipc_reply_wait>:
+{
+  801ae1:	55                   	push   %ebp
+  801ae2:	89 e5                	mov    %esp,%ebp
+  801ae4:	57                   	push   %edi
+  801ae5:	56                   	push   %esi
+  801ae6:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801ae7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aea:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801aef:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801af2:	55                   	push   %ebp
+  801af3:	56                   	push   %esi
+  801af4:	8b 0e                	mov    (%esi),%ecx
+  801af6:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801af9:	8b 7e 08             	mov    0x8(%esi),%edi
+  801afc:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801aff:	8b 76 0c             	mov    0xc(%esi),%esi
+  801b02:	cd 30                	int    $0x30
+  801b04:	87 34 24             	xchg   %esi,(%esp)
+  801b07:	89 0e                	mov    %ecx,(%esi)
+  801b09:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801b0c:	89 7e 08             	mov    %edi,0x8(%esi)
+  801b0f:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801b12:	8f 46 0c             	pop    0xc(%esi)
+  801b15:	5d                   	pop    %ebp
+}
+  801b16:	5b                   	pop    %ebx
+  801b17:	5e                   	pop    %esi
+  801b18:	5f                   	pop    %edi
+  801b19:	5d                   	pop    %ebp
+  801b1a:	c3                   	ret
+
+00801b1b <sys_ipc_send_msg>:
+{
+  801b1b:	55                   	push   %ebp
+  801b1c:	89 e5                	mov    %esp,%ebp
+  801b1e:	57                   	push   %edi
+  801b1f:	56                   	push   %esi
+  801b20:	53                   	push   %ebx
+  801b21:	83 ec 20             	sub    $0x20,%esp
+  801b24:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801b27:	8b 10                	mov    (%eax),%edx
+  801b29:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801b2c:	8b 50 04             	mov    0x4(%eax),%edx
+  801b2f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801b32:	8b 50 08             	mov    0x8(%eax),%edx
+  801b35:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801b38:	8b 50 0c             	mov    0xc(%eax),%edx
+  801b3b:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801b3e:	8b 40 10             	mov    0x10(%eax),%eax
+  801b41:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801b44:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801b47:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b4a:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801b4f:	55                   	push   %ebp
+  801b50:	56                   	push   %esi
+  801b51:	8b 0e                	mov    (%esi),%ecx
+  801b53:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801b56:	8b 7e 08             	mov    0x8(%esi),%edi
+  801b59:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801b5c:	8b 76 0c             	mov    0xc(%esi),%esi
+  801b5f:	cd 30                	int    $0x30
+  801b61:	87 34 24             	xchg   %esi,(%esp)
+  801b64:	89 0e                	mov    %ecx,(%esi)
+  801b66:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801b69:	89 7e 08             	mov    %edi,0x8(%esi)
+  801b6c:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801b6f:	8f 46 0c             	pop    0xc(%esi)
+  801b72:	5d                   	pop    %ebp
+}
+  801b73:	83 c4 20             	add    $0x20,%esp
+  801b76:	5b                   	pop    %ebx
+  801b77:	5e                   	pop    %esi
+  801b78:	5f                   	pop    %edi
+  801b79:	5d                   	pop    %ebp
+  801b7a:	c3                   	ret
+
+00801b7b <sys_fork>:
+{
+  801b7b:	55                   	push   %ebp
+  801b7c:	89 e5                	mov    %esp,%ebp
+  801b7e:	57                   	push   %edi
+  801b7f:	56                   	push   %esi
+  801b80:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801b81:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b88:	78 2e                	js     801bb8 <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801b8a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b91:	74 71                	je     801c04 <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801b93:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b98:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801b9d:	89 d1                	mov    %edx,%ecx
+  801b9f:	89 d3                	mov    %edx,%ebx
+  801ba1:	89 d7                	mov    %edx,%edi
+  801ba3:	89 d6                	mov    %edx,%esi
+  801ba5:	55                   	push   %ebp
+  801ba6:	68 af 1b 80 00       	push   $0x801baf
+  801bab:	89 e5                	mov    %esp,%ebp
+  801bad:	0f 34                	sysenter
+  801baf:	83 c4 04             	add    $0x4,%esp
+  801bb2:	5d                   	pop    %ebp
+}
+  801bb3:	5b                   	pop    %ebx
+  801bb4:	5e                   	pop    %esi
+  801bb5:	5f                   	pop    %edi
+  801bb6:	5d                   	pop    %ebp
+  801bb7:	c3                   	ret
+  801bb8:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bbd:	0f a2                	cpuid
+		return 0;
+  801bbf:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801bc4:	f6 c6 08             	test   $0x8,%dh
+  801bc7:	74 15                	je     801bde <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bc9:	89 c2                	mov    %eax,%edx
+  801bcb:	c1 ea 08             	shr    $0x8,%edx
+  801bce:	83 e2 0f             	and    $0xf,%edx
+  801bd1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801bd6:	83 fa 06             	cmp    $0x6,%edx
+  801bd9:	74 0e                	je     801be9 <sys_fork+0x6e>
+  801bdb:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801bde:	0f b6 c9             	movzbl %cl,%ecx
+  801be1:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801be7:	eb a1                	jmp    801b8a <sys_fork+0xf>
+  801be9:	89 c2                	mov    %eax,%edx
+  801beb:	c1 ea 04             	shr    $0x4,%edx
+  801bee:	83 e2 0f             	and    $0xf,%edx
+  801bf1:	83 fa 02             	cmp    $0x2,%edx
+  801bf4:	77 e5                	ja     801bdb <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801bf6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bf9:	83 f8 02             	cmp    $0x2,%eax
+  801bfc:	0f 97 c1             	seta   %cl
+  801bff:	0f b6 c9             	movzbl %cl,%ecx
+  801c02:	eb d7                	jmp    801bdb <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801c04:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c09:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801c0e:	89 d1                	mov    %edx,%ecx
+  801c10:	89 d3                	mov    %edx,%ebx
+  801c12:	89 d7                	mov    %edx,%edi
+  801c14:	89 d6                	mov    %edx,%esi
+  801c16:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801c18:	eb 99                	jmp    801bb3 <sys_fork+0x38>
+
+00801c1a <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801c1a:	55                   	push   %ebp
+  801c1b:	89 e5                	mov    %esp,%ebp
+  801c1d:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801c20:	ff 75 14             	push   0x14(%ebp)
+  801c23:	ff 75 10             	push   0x10(%ebp)
+  801c26:	ff 75 0c             	push   0xc(%ebp)
+  801c29:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c2e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c31:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801c36:	e8 81 ee ff ff       	call   800abc <page_vec_call>
+}
+  801c3b:	c9                   	leave
+  801c3c:	c3                   	ret
+
+00801c3d <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801c3d:	55                   	push   %ebp
+  801c3e:	89 e5                	mov    %esp,%ebp
+  801c40:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801c43:	ff 75 18             	push   0x18(%ebp)
+  801c46:	ff 75 14             	push   0x14(%ebp)
+  801c49:	ff 75 10             	push   0x10(%ebp)
+  801c4c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c52:	b8 10 00 00 00       	mov    $0x10,%eax
+  801c57:	e8 60 ee ff ff       	call   800abc <page_vec_call>
+}
+  801c5c:	c9                   	leave
+  801c5d:	c3                   	ret
+
+00801c5e <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801c5e:	55                   	push   %ebp
+  801c5f:	89 e5                	mov    %esp,%ebp
+  801c61:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801c64:	ff 75 14             	push   0x14(%ebp)
+  801c67:	ff 75 10             	push   0x10(%ebp)
+  801c6a:	ff 75 0c             	push   0xc(%ebp)
+  801c6d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c72:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c75:	b8 11 00 00 00       	mov    $0x11,%eax
+  801c7a:	e8 3d ee ff ff       	call   800abc <page_vec_call>
+}
+  801c7f:	c9                   	leave
+  801c80:	c3                   	ret
+
+00801c81 <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801c81:	55                   	push   %ebp
+  801c82:	89 e5                	mov    %esp,%ebp
+  801c84:	57                   	push   %edi
+  801c85:	56                   	push   %esi
+  801c86:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801c87:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801c8e:	78 32                	js     801cc2 <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801c90:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801c97:	74 75                	je     801d0e <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801c99:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c9c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c9f:	b8 12 00 00 00       	mov    $0x12,%eax
+  801ca4:	be 00 00 00 00       	mov    $0x0,%esi
+  801ca9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801cac:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801caf:	55                   	push   %ebp
+  801cb0:	68 b9 1c 80 00       	push   $0x801cb9
+  801cb5:	89 e5                	mov    %esp,%ebp
+  801cb7:	0f 34                	sysenter
+  801cb9:	83 c4 04             	add    $0x4,%esp
+  801cbc:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801cbd:	5b                   	pop    %ebx
+  801cbe:	5e                   	pop    %esi
+  801cbf:	5f                   	pop    %edi
+  801cc0:	5d                   	pop    %ebp
+  801cc1:	c3                   	ret
+  801cc2:	b8 01 00 00 00       	mov    $0x1,%eax
+  801cc7:	0f a2                	cpuid
+		return 0;
+  801cc9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801cce:	f6 c6 08             	test   $0x8,%dh
+  801cd1:	74 15                	je     801ce8 <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801cd3:	89 c2                	mov    %eax,%edx
+  801cd5:	c1 ea 08             	shr    $0x8,%edx
+  801cd8:	83 e2 0f             	and    $0xf,%edx
+  801cdb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ce0:	83 fa 06             	cmp    $0x6,%edx
+  801ce3:	74 0e                	je     801cf3 <sys_vm_ranges+0x72>
+  801ce5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801ce8:	0f b6 c9             	movzbl %cl,%ecx
+  801ceb:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801cf1:	eb 9d                	jmp    801c90 <sys_vm_ranges+0xf>
+  801cf3:	89 c2                	mov    %eax,%edx
+  801cf5:	c1 ea 04             	shr    $0x4,%edx
+  801cf8:	83 e2 0f             	and    $0xf,%edx
+  801cfb:	83 fa 02             	cmp    $0x2,%edx
+  801cfe:	77 e5                	ja     801ce5 <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  801d00:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d03:	83 f8 02             	cmp    $0x2,%eax
+  801d06:	0f 97 c1             	seta   %cl
+  801d09:	0f b6 c9             	movzbl %cl,%ecx
+  801d0c:	eb d7                	jmp    801ce5 <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801d0e:	b8 12 00 00 00       	mov    $0x12,%eax
+  801d13:	be 00 00 00 00       	mov    $0x0,%esi
+  801d18:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d1b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d1e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d21:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801d24:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801d26:	eb 95                	jmp    801cbd <sys_vm_ranges+0x3c>
+
+00801d28 <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801d28:	55                   	push   %ebp
+  801d29:	89 e5                	mov    %esp,%ebp
+  801d2b:	57                   	push   %edi
+  801d2c:	56                   	push   %esi
+  801d2d:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801d2e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801d35:	78 31                	js     801d68 <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801d37:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801d3e:	74 74                	je     801db4 <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801d40:	be 00 00 00 00       	mov    $0x0,%esi
+  801d45:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d48:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d4b:	b8 14 00 00 00       	mov    $0x14,%eax
+  801d50:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d53:	89 f7                	mov    %esi,%edi
+  801d55:	55                   	push   %ebp
+  801d56:	68 5f 1d 80 00       	push   $0x801d5f
+  801d5b:	89 e5                	mov    %esp,%ebp
+  801d5d:	0f 34                	sysenter
+  801d5f:	83 c4 04             	add    $0x4,%esp
+  801d62:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801d63:	5b                   	pop    %ebx
+  801d64:	5e                   	pop    %esi
+  801d65:	5f                   	pop    %edi
+  801d66:	5d                   	pop    %ebp
+  801d67:	c3                   	ret
+  801d68:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d6d:	0f a2                	cpuid
+		return 0;
+  801d6f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801d74:	f6 c6 08             	test   $0x8,%dh
+  801d77:	74 15                	je     801d8e <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d79:	89 c2                	mov    %eax,%edx
+  801d7b:	c1 ea 08             	shr    $0x8,%edx
+  801d7e:	83 e2 0f             	and    $0xf,%edx
+  801d81:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d86:	83 fa 06             	cmp    $0x6,%edx
+  801d89:	74 0e                	je     801d99 <sys_spawn+0x71>
+  801d8b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801d8e:	0f b6 c9             	movzbl %cl,%ecx
+  801d91:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801d97:	eb 9e                	jmp    801d37 <sys_spawn+0xf>
+  801d99:	89 c2                	mov    %eax,%edx
+  801d9b:	c1 ea 04             	shr    $0x4,%edx
+  801d9e:	83 e2 0f             	and    $0xf,%edx
+  801da1:	83 fa 02             	cmp    $0x2,%edx
+  801da4:	77 e5                	ja     801d8b <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  801da6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801da9:	83 f8 02             	cmp    $0x2,%eax
+  801dac:	0f 97 c1             	seta   %cl
+  801daf:	0f b6 c9             	movzbl %cl,%ecx
+  801db2:	eb d7                	jmp    801d8b <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  801db4:	be 00 00 00 00       	mov    $0x0,%esi
+  801db9:	b8 14 00 00 00       	mov    $0x14,%eax
+  801dbe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801dc1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801dc4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801dc7:	89 f7                	mov    %esi,%edi
+  801dc9:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  801dcb:	eb 96                	jmp    801d63 <sys_spawn+0x3b>
+
+00801dcd <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  801dcd:	55                   	push   %ebp
+  801dce:	89 e5                	mov    %esp,%ebp
+  801dd0:	57                   	push   %edi
+  801dd1:	56                   	push   %esi
+  801dd2:	53                   	push   %ebx
+  801dd3:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801dd6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801ddd:	78 37                	js     801e16 <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  801ddf:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801de6:	74 7a                	je     801e62 <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  801de8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ded:	8b 55 08             	mov    0x8(%ebp),%edx
+  801df0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801df3:	b8 15 00 00 00       	mov    $0x15,%eax
+  801df8:	89 df                	mov    %ebx,%edi
+  801dfa:	89 de                	mov    %ebx,%esi
+  801dfc:	55                   	push   %ebp
+  801dfd:	68 06 1e 80 00       	push   $0x801e06
+  801e02:	89 e5                	mov    %esp,%ebp
+  801e04:	0f 34                	sysenter
+  801e06:	83 c4 04             	add    $0x4,%esp
+  801e09:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801e0a:	85 c0                	test   %eax,%eax
+  801e0c:	7f 6c                	jg     801e7a <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  801e0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e11:	5b                   	pop    %ebx
+  801e12:	5e                   	pop    %esi
+  801e13:	5f                   	pop    %edi
+  801e14:	5d                   	pop    %ebp
+  801e15:	c3                   	ret
+  801e16:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e1b:	0f a2                	cpuid
+		return 0;
+  801e1d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801e22:	f6 c6 08             	test   $0x8,%dh
+  801e25:	74 15                	je     801e3c <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e27:	89 c2                	mov    %eax,%edx
+  801e29:	c1 ea 08             	shr    $0x8,%edx
+  801e2c:	83 e2 0f             	and    $0xf,%edx
+  801e2f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e34:	83 fa 06             	cmp    $0x6,%edx
+  801e37:	74 0e                	je     801e47 <sys_shm_create+0x7a>
+  801e39:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801e3c:	0f b6 c9             	movzbl %cl,%ecx
+  801e3f:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801e45:	eb 98                	jmp    801ddf <sys_shm_create+0x12>
+  801e47:	89 c2                	mov    %eax,%edx
+  801e49:	c1 ea 04             	shr    $0x4,%edx
+  801e4c:	83 e2 0f             	and    $0xf,%edx
+  801e4f:	83 fa 02             	cmp    $0x2,%edx
+  801e52:	77 e5                	ja     801e39 <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  801e54:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e57:	83 f8 02             	cmp    $0x2,%eax
+  801e5a:	0f 97 c1             	seta   %cl
+  801e5d:	0f b6 c9             	movzbl %cl,%ecx
+  801e60:	eb d7                	jmp    801e39 <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  801e62:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e67:	b8 15 00 00 00       	mov    $0x15,%eax
+  801e6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e72:	89 df                	mov    %ebx,%edi
+  801e74:	89 de                	mov    %ebx,%esi
+  801e76:	cd 30                	int    $0x30
+  801e78:	eb 90                	jmp    801e0a <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801e7a:	83 ec 0c             	sub    $0xc,%esp
+  801e7d:	50                   	push   %eax
+  801e7e:	6a 15                	push   $0x15
+  801e80:	68 f9 2b 80 00       	push   $0x802bf9
+  801e85:	6a 4a                	push   $0x4a
+  801e87:	68 16 2c 80 00       	push   $0x802c16
+  801e8c:	e8 9b 07 00 00       	call   80262c <_panic>
+
+00801e91 <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  801e91:	55                   	push   %ebp
+  801e92:	89 e5                	mov    %esp,%ebp
+  801e94:	57                   	push   %edi
+  801e95:	56                   	push   %esi
+  801e96:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801e97:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801e9e:	78 32                	js     801ed2 <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  801ea0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801ea7:	74 75                	je     801f1e <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801ea9:	8b 55 08             	mov    0x8(%ebp),%edx
+  801eac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801eaf:	b8 16 00 00 00       	mov    $0x16,%eax
+  801eb4:	be 00 00 00 00       	mov    $0x0,%esi
+  801eb9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ebc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ebf:	55                   	push   %ebp
+  801ec0:	68 c9 1e 80 00       	push   $0x801ec9
+  801ec5:	89 e5                	mov    %esp,%ebp
+  801ec7:	0f 34                	sysenter
+  801ec9:	83 c4 04             	add    $0x4,%esp
+  801ecc:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  801ecd:	5b                   	pop    %ebx
+  801ece:	5e                   	pop    %esi
+  801ecf:	5f                   	pop    %edi
+  801ed0:	5d                   	pop    %ebp
+  801ed1:	c3                   	ret
+  801ed2:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ed7:	0f a2                	cpuid
+		return 0;
+  801ed9:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801ede:	f6 c6 08             	test   $0x8,%dh
+  801ee1:	74 15                	je     801ef8 <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ee3:	89 c2                	mov    %eax,%edx
+  801ee5:	c1 ea 08             	shr    $0x8,%edx
+  801ee8:	83 e2 0f             	and    $0xf,%edx
+  801eeb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ef0:	83 fa 06             	cmp    $0x6,%edx
+  801ef3:	74 0e                	je     801f03 <sys_shm_attach+0x72>
+  801ef5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801ef8:	0f b6 c9             	movzbl %cl,%ecx
+  801efb:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801f01:	eb 9d                	jmp    801ea0 <sys_shm_attach+0xf>
+  801f03:	89 c2                	mov    %eax,%edx
+  801f05:	c1 ea 04             	shr    $0x4,%edx
+  801f08:	83 e2 0f             	and    $0xf,%edx
+  801f0b:	83 fa 02             	cmp    $0x2,%edx
+  801f0e:	77 e5                	ja     801ef5 <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  801f10:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f13:	83 f8 02             	cmp    $0x2,%eax
+  801f16:	0f 97 c1             	seta   %cl
+  801f19:	0f b6 c9             	movzbl %cl,%ecx
+  801f1c:	eb d7                	jmp    801ef5 <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  801f1e:	b8 16 00 00 00       	mov    $0x16,%eax
+  801f23:	be 00 00 00 00       	mov    $0x0,%esi
+  801f28:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f2b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f2e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f31:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801f34:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  801f36:	eb 95                	jmp    801ecd <sys_shm_attach+0x3c>
+
+00801f38 <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  801f38:	55                   	push   %ebp
+  801f39:	89 e5                	mov    %esp,%ebp
+  801f3b:	57                   	push   %edi
+  801f3c:	56                   	push   %esi
+  801f3d:	53                   	push   %ebx
+  801f3e:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801f41:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801f48:	78 38                	js     801f82 <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  801f4a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801f51:	74 7b                	je     801fce <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  801f53:	be 00 00 00 00       	mov    $0x0,%esi
+  801f58:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f5b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f5e:	b8 17 00 00 00       	mov    $0x17,%eax
+  801f63:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f66:	89 f7                	mov    %esi,%edi
+  801f68:	55                   	push   %ebp
+  801f69:	68 72 1f 80 00       	push   $0x801f72
+  801f6e:	89 e5                	mov    %esp,%ebp
+  801f70:	0f 34                	sysenter
+  801f72:	83 c4 04             	add    $0x4,%esp
+  801f75:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801f76:	85 c0                	test   %eax,%eax
+  801f78:	7f 6d                	jg     801fe7 <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  801f7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f7d:	5b                   	pop    %ebx
+  801f7e:	5e                   	pop    %esi
+  801f7f:	5f                   	pop    %edi
+  801f80:	5d                   	pop    %ebp
+  801f81:	c3                   	ret
+  801f82:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f87:	0f a2                	cpuid
+		return 0;
+  801f89:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801f8e:	f6 c6 08             	test   $0x8,%dh
+  801f91:	74 15                	je     801fa8 <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f93:	89 c2                	mov    %eax,%edx
+  801f95:	c1 ea 08             	shr    $0x8,%edx
+  801f98:	83 e2 0f             	and    $0xf,%edx
+  801f9b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801fa0:	83 fa 06             	cmp    $0x6,%edx
+  801fa3:	74 0e                	je     801fb3 <sys_shm_detach+0x7b>
+  801fa5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801fa8:	0f b6 c9             	movzbl %cl,%ecx
+  801fab:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801fb1:	eb 97                	jmp    801f4a <sys_shm_detach+0x12>
+  801fb3:	89 c2                	mov    %eax,%edx
+  801fb5:	c1 ea 04             	shr    $0x4,%edx
+  801fb8:	83 e2 0f             	and    $0xf,%edx
+  801fbb:	83 fa 02             	cmp    $0x2,%edx
+  801fbe:	77 e5                	ja     801fa5 <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  801fc0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fc3:	83 f8 02             	cmp    $0x2,%eax
+  801fc6:	0f 97 c1             	seta   %cl
+  801fc9:	0f b6 c9             	movzbl %cl,%ecx
+  801fcc:	eb d7                	jmp    801fa5 <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  801fce:	be 00 00 00 00       	mov    $0x0,%esi
+  801fd3:	b8 17 00 00 00       	mov    $0x17,%eax
+  801fd8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fdb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fde:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801fe1:	89 f7                	mov    %esi,%edi
+  801fe3:	cd 30                	int    $0x30
+  801fe5:	eb 8f                	jmp    801f76 <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801fe7:	83 ec 0c             	sub    $0xc,%esp
+  801fea:	50                   	push   %eax
+  801feb:	6a 17                	push   $0x17
+  801fed:	68 f9 2b 80 00       	push   $0x802bf9
+  801ff2:	6a 4a                	push   $0x4a
+  801ff4:	68 16 2c 80 00       	push   $0x802c16
+  801ff9:	e8 2e 06 00 00       	call   80262c <_panic>
+
+00801ffe <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  801ffe:	55                   	push   %ebp
+  801fff:	89 e5                	mov    %esp,%ebp
+  802001:	57                   	push   %edi
+  802002:	56                   	push   %esi
+  802003:	53                   	push   %ebx
+  802004:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  802007:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80200e:	78 36                	js     802046 <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  802010:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802017:	74 79                	je     802092 <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  802019:	8b 55 08             	mov    0x8(%ebp),%edx
+  80201c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802021:	b8 18 00 00 00       	mov    $0x18,%eax
+  802026:	89 cb                	mov    %ecx,%ebx
+  802028:	89 cf                	mov    %ecx,%edi
+  80202a:	89 ce                	mov    %ecx,%esi
+  80202c:	55                   	push   %ebp
+  80202d:	68 36 20 80 00       	push   $0x802036
+  802032:	89 e5                	mov    %esp,%ebp
+  802034:	0f 34                	sysenter
+  802036:	83 c4 04             	add    $0x4,%esp
+  802039:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80203a:	85 c0                	test   %eax,%eax
+  80203c:	7f 6b                	jg     8020a9 <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  80203e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802041:	5b                   	pop    %ebx
+  802042:	5e                   	pop    %esi
+  802043:	5f                   	pop    %edi
+  802044:	5d                   	pop    %ebp
+  802045:	c3                   	ret
+  802046:	b8 01 00 00 00       	mov    $0x1,%eax
+  80204b:	0f a2                	cpuid
+		return 0;
+  80204d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802052:	f6 c6 08             	test   $0x8,%dh
+  802055:	74 15                	je     80206c <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802057:	89 c2                	mov    %eax,%edx
+  802059:	c1 ea 08             	shr    $0x8,%edx
+  80205c:	83 e2 0f             	and    $0xf,%edx
+  80205f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802064:	83 fa 06             	cmp    $0x6,%edx
+  802067:	74 0e                	je     802077 <sys_shm_remove+0x79>
+  802069:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80206c:	0f b6 c9             	movzbl %cl,%ecx
+  80206f:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802075:	eb 99                	jmp    802010 <sys_shm_remove+0x12>
+  802077:	89 c2                	mov    %eax,%edx
+  802079:	c1 ea 04             	shr    $0x4,%edx
+  80207c:	83 e2 0f             	and    $0xf,%edx
+  80207f:	83 fa 02             	cmp    $0x2,%edx
+  802082:	77 e5                	ja     802069 <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  802084:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802087:	83 f8 02             	cmp    $0x2,%eax
+  80208a:	0f 97 c1             	seta   %cl
+  80208d:	0f b6 c9             	movzbl %cl,%ecx
+  802090:	eb d7                	jmp    802069 <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  802092:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802097:	b8 18 00 00 00       	mov    $0x18,%eax
+  80209c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80209f:	89 cb                	mov    %ecx,%ebx
+  8020a1:	89 cf                	mov    %ecx,%edi
+  8020a3:	89 ce                	mov    %ecx,%esi
+  8020a5:	cd 30                	int    $0x30
+  8020a7:	eb 91                	jmp    80203a <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8020a9:	83 ec 0c             	sub    $0xc,%esp
+  8020ac:	50                   	push   %eax
+  8020ad:	6a 18                	push   $0x18
+  8020af:	68 f9 2b 80 00       	push   $0x802bf9
+  8020b4:	6a 4a                	push   $0x4a
+  8020b6:	68 16 2c 80 00       	push   $0x802c16
+  8020bb:	e8 6c 05 00 00       	call   80262c <_panic>
+
+008020c0 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  8020c0:	55                   	push   %ebp
+  8020c1:	89 e5                	mov    %esp,%ebp
+  8020c3:	57                   	push   %edi
+  8020c4:	56                   	push   %esi
+  8020c5:	53                   	push   %ebx
+  8020c6:	83 ec 0c             	sub    $0xc,%esp
+  8020c9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020cc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8020cf:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  8020d2:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8020d9:	78 32                	js     80210d <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  8020db:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8020e2:	74 75                	je     802159 <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  8020e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020ea:	b8 20 00 00 00       	mov    $0x20,%eax
+  8020ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8020f4:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8020f7:	55                   	push   %ebp
+  8020f8:	68 01 21 80 00       	push   $0x802101
+  8020fd:	89 e5                	mov    %esp,%ebp
+  8020ff:	0f 34                	sysenter
+  802101:	83 c4 04             	add    $0x4,%esp
+  802104:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  802105:	83 c4 0c             	add    $0xc,%esp
+  802108:	5b                   	pop    %ebx
+  802109:	5e                   	pop    %esi
+  80210a:	5f                   	pop    %edi
+  80210b:	5d                   	pop    %ebp
+  80210c:	c3                   	ret
+  80210d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802112:	0f a2                	cpuid
+		return 0;
+  802114:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802119:	f6 c6 08             	test   $0x8,%dh
+  80211c:	74 15                	je     802133 <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80211e:	89 c2                	mov    %eax,%edx
+  802120:	c1 ea 08             	shr    $0x8,%edx
+  802123:	83 e2 0f             	and    $0xf,%edx
+  802126:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80212b:	83 fa 06             	cmp    $0x6,%edx
+  80212e:	74 0e                	je     80213e <sys_futex_wait+0x7e>
+  802130:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802133:	0f b6 c9             	movzbl %cl,%ecx
+  802136:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80213c:	eb 9d                	jmp    8020db <sys_futex_wait+0x1b>
+  80213e:	89 c2                	mov    %eax,%edx
+  802140:	c1 ea 04             	shr    $0x4,%edx
+  802143:	83 e2 0f             	and    $0xf,%edx
+  802146:	83 fa 02             	cmp    $0x2,%edx
+  802149:	77 e5                	ja     802130 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  80214b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80214e:	83 f8 02             	cmp    $0x2,%eax
+  802151:	0f 97 c1             	seta   %cl
+  802154:	0f b6 c9             	movzbl %cl,%ecx
+  802157:	eb d7                	jmp    802130 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  802159:	b8 20 00 00 00       	mov    $0x20,%eax
+  80215e:	be 00 00 00 00       	mov    $0x0,%esi
+  802163:	8b 55 08             	mov    0x8(%ebp),%edx
+  802166:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802169:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  80216c:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  80216e:	eb 95                	jmp    802105 <sys_futex_wait+0x45>
+
+00802170 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  802170:	55                   	push   %ebp
+  802171:	89 e5                	mov    %esp,%ebp
+  802173:	57                   	push   %edi
+  802174:	56                   	push   %esi
+  802175:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802176:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80217d:	78 30                	js     8021af <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  80217f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802186:	74 73                	je     8021fb <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  802188:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80218d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802190:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802193:	b8 21 00 00 00       	mov    $0x21,%eax
+  802198:	89 df                	mov    %ebx,%edi
+  80219a:	89 de                	mov    %ebx,%esi
+  80219c:	55                   	push   %ebp
+  80219d:	68 a6 21 80 00       	push   $0x8021a6
+  8021a2:	89 e5                	mov    %esp,%ebp
+  8021a4:	0f 34                	sysenter
+  8021a6:	83 c4 04             	add    $0x4,%esp
+  8021a9:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8021aa:	5b                   	pop    %ebx
+  8021ab:	5e                   	pop    %esi
+  8021ac:	5f                   	pop    %edi
+  8021ad:	5d                   	pop    %ebp
+  8021ae:	c3                   	ret
+  8021af:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021b4:	0f a2                	cpuid
+		return 0;
+  8021b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8021bb:	f6 c6 08             	test   $0x8,%dh
+  8021be:	74 15                	je     8021d5 <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021c0:	89 c2                	mov    %eax,%edx
+  8021c2:	c1 ea 08             	shr    $0x8,%edx
+  8021c5:	83 e2 0f             	and    $0xf,%edx
+  8021c8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8021cd:	83 fa 06             	cmp    $0x6,%edx
+  8021d0:	74 0e                	je     8021e0 <sys_futex_wake+0x70>
+  8021d2:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8021d5:	0f b6 c9             	movzbl %cl,%ecx
+  8021d8:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8021de:	eb 9f                	jmp    80217f <sys_futex_wake+0xf>
+  8021e0:	89 c2                	mov    %eax,%edx
+  8021e2:	c1 ea 04             	shr    $0x4,%edx
+  8021e5:	83 e2 0f             	and    $0xf,%edx
+  8021e8:	83 fa 02             	cmp    $0x2,%edx
+  8021eb:	77 e5                	ja     8021d2 <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  8021ed:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8021f0:	83 f8 02             	cmp    $0x2,%eax
+  8021f3:	0f 97 c1             	seta   %cl
+  8021f6:	0f b6 c9             	movzbl %cl,%ecx
+  8021f9:	eb d7                	jmp    8021d2 <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  8021fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802200:	b8 21 00 00 00       	mov    $0x21,%eax
+  802205:	8b 55 08             	mov    0x8(%ebp),%edx
+  802208:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80220b:	89 df                	mov    %ebx,%edi
+  80220d:	89 de                	mov    %ebx,%esi
+  80220f:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  802211:	eb 97                	jmp    8021aa <sys_futex_wake+0x3a>
+
+00802213 <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  802213:	55                   	push   %ebp
+  802214:	89 e5                	mov    %esp,%ebp
+  802216:	57                   	push   %edi
+  802217:	56                   	push   %esi
+  802218:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802219:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802220:	78 2e                	js     802250 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  802222:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802229:	74 71                	je     80229c <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  80222b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802230:	b8 22 00 00 00       	mov    $0x22,%eax
+  802235:	89 d1                	mov    %edx,%ecx
+  802237:	89 d3                	mov    %edx,%ebx
+  802239:	89 d7                	mov    %edx,%edi
+  80223b:	89 d6                	mov    %edx,%esi
+  80223d:	55                   	push   %ebp
+  80223e:	68 47 22 80 00       	push   $0x802247
+  802243:	89 e5                	mov    %esp,%ebp
+  802245:	0f 34                	sysenter
+  802247:	83 c4 04             	add    $0x4,%esp
+  80224a:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  80224b:	5b                   	pop    %ebx
+  80224c:	5e                   	pop    %esi
+  80224d:	5f                   	pop    %edi
+  80224e:	5d                   	pop    %ebp
+  80224f:	c3                   	ret
+  802250:	b8 01 00 00 00       	mov    $0x1,%eax
+  802255:	0f a2                	cpuid
+		return 0;
+  802257:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80225c:	f6 c6 08             	test   $0x8,%dh
+  80225f:	74 15                	je     802276 <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802261:	89 c2                	mov    %eax,%edx
+  802263:	c1 ea 08             	shr    $0x8,%edx
+  802266:	83 e2 0f             	and    $0xf,%edx
+  802269:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80226e:	83 fa 06             	cmp    $0x6,%edx
+  802271:	74 0e                	je     802281 <sys_ep_create+0x6e>
+  802273:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802276:	0f b6 c9             	movzbl %cl,%ecx
+  802279:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80227f:	eb a1                	jmp    802222 <sys_ep_create+0xf>
+  802281:	89 c2                	mov    %eax,%edx
+  802283:	c1 ea 04             	shr    $0x4,%edx
+  802286:	83 e2 0f             	and    $0xf,%edx
+  802289:	83 fa 02             	cmp    $0x2,%edx
+  80228c:	77 e5                	ja     802273 <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  80228e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802291:	83 f8 02             	cmp    $0x2,%eax
+  802294:	0f 97 c1             	seta   %cl
+  802297:	0f b6 c9             	movzbl %cl,%ecx
+  80229a:	eb d7                	jmp    802273 <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  80229c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022a1:	b8 22 00 00 00       	mov    $0x22,%eax
+  8022a6:	89 d1                	mov    %edx,%ecx
+  8022a8:	89 d3                	mov    %edx,%ebx
+  8022aa:	89 d7                	mov    %edx,%edi
+  8022ac:	89 d6                	mov    %edx,%esi
+  8022ae:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  8022b0:	eb 99                	jmp    80224b <sys_ep_create+0x38>
+
+008022b2 <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  8022b2:	55                   	push   %ebp
+  8022b3:	89 e5                	mov    %esp,%ebp
+  8022b5:	57                   	push   %edi
+  8022b6:	56                   	push   %esi
+  8022b7:	53                   	push   %ebx
+  8022b8:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8022bb:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8022c2:	78 36                	js     8022fa <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  8022c4:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8022cb:	74 79                	je     802346 <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  8022cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022d5:	b8 23 00 00 00       	mov    $0x23,%eax
+  8022da:	89 cb                	mov    %ecx,%ebx
+  8022dc:	89 cf                	mov    %ecx,%edi
+  8022de:	89 ce                	mov    %ecx,%esi
+  8022e0:	55                   	push   %ebp
+  8022e1:	68 ea 22 80 00       	push   $0x8022ea
+  8022e6:	89 e5                	mov    %esp,%ebp
+  8022e8:	0f 34                	sysenter
+  8022ea:	83 c4 04             	add    $0x4,%esp
+  8022ed:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8022ee:	85 c0                	test   %eax,%eax
+  8022f0:	7f 6b                	jg     80235d <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  8022f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022f5:	5b                   	pop    %ebx
+  8022f6:	5e                   	pop    %esi
+  8022f7:	5f                   	pop    %edi
+  8022f8:	5d                   	pop    %ebp
+  8022f9:	c3                   	ret
+  8022fa:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022ff:	0f a2                	cpuid
+		return 0;
+  802301:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802306:	f6 c6 08             	test   $0x8,%dh
+  802309:	74 15                	je     802320 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80230b:	89 c2                	mov    %eax,%edx
+  80230d:	c1 ea 08             	shr    $0x8,%edx
+  802310:	83 e2 0f             	and    $0xf,%edx
+  802313:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802318:	83 fa 06             	cmp    $0x6,%edx
+  80231b:	74 0e                	je     80232b <sys_ep_destroy+0x79>
+  80231d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802320:	0f b6 c9             	movzbl %cl,%ecx
+  802323:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802329:	eb 99                	jmp    8022c4 <sys_ep_destroy+0x12>
+  80232b:	89 c2                	mov    %eax,%edx
+  80232d:	c1 ea 04             	shr    $0x4,%edx
+  802330:	83 e2 0f             	and    $0xf,%edx
+  802333:	83 fa 02             	cmp    $0x2,%edx
+  802336:	77 e5                	ja     80231d <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  802338:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80233b:	83 f8 02             	cmp    $0x2,%eax
+  80233e:	0f 97 c1             	seta   %cl
+  802341:	0f b6 c9             	movzbl %cl,%ecx
+  802344:	eb d7                	jmp    80231d <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  802346:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80234b:	b8 23 00 00 00       	mov    $0x23,%eax
+  802350:	8b 55 08             	mov    0x8(%ebp),%edx
+  802353:	89 cb                	mov    %ecx,%ebx
+  802355:	89 cf                	mov    %ecx,%edi
+  802357:	89 ce                	mov    %ecx,%esi
+  802359:	cd 30                	int    $0x30
+  80235b:	eb 91                	jmp    8022ee <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80235d:	83 ec 0c             	sub    $0xc,%esp
+  802360:	50                   	push   %eax
+  802361:	6a 23                	push   $0x23
+  802363:	68 f9 2b 80 00       	push   $0x802bf9
+  802368:	6a 4a                	push   $0x4a
+  80236a:	68 16 2c 80 00       	push   $0x802c16
+  80236f:	e8 b8 02 00 00       	call   80262c <_panic>
+
+00802374 <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  802374:	55                   	push   %ebp
+  802375:	89 e5                	mov    %esp,%ebp
+  802377:	57                   	push   %edi
+  802378:	56                   	push   %esi
+  802379:	53                   	push   %ebx
+  80237a:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80237d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802384:	78 37                	js     8023bd <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  802386:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80238d:	74 7a                	je     802409 <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  80238f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802394:	8b 55 08             	mov    0x8(%ebp),%edx
+  802397:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80239a:	b8 24 00 00 00       	mov    $0x24,%eax
+  80239f:	89 df                	mov    %ebx,%edi
+  8023a1:	89 de                	mov    %ebx,%esi
+  8023a3:	55                   	push   %ebp
+  8023a4:	68 ad 23 80 00       	push   $0x8023ad
+  8023a9:	89 e5                	mov    %esp,%ebp
+  8023ab:	0f 34                	sysenter
+  8023ad:	83 c4 04             	add    $0x4,%esp
+  8023b0:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8023b1:	85 c0                	test   %eax,%eax
+  8023b3:	7f 6c                	jg     802421 <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  8023b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023b8:	5b                   	pop    %ebx
+  8023b9:	5e                   	pop    %esi
+  8023ba:	5f                   	pop    %edi
+  8023bb:	5d                   	pop    %ebp
+  8023bc:	c3                   	ret
+  8023bd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023c2:	0f a2                	cpuid
+		return 0;
+  8023c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8023c9:	f6 c6 08             	test   $0x8,%dh
+  8023cc:	74 15                	je     8023e3 <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023ce:	89 c2                	mov    %eax,%edx
+  8023d0:	c1 ea 08             	shr    $0x8,%edx
+  8023d3:	83 e2 0f             	and    $0xf,%edx
+  8023d6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8023db:	83 fa 06             	cmp    $0x6,%edx
+  8023de:	74 0e                	je     8023ee <sys_ep_grant+0x7a>
+  8023e0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8023e3:	0f b6 c9             	movzbl %cl,%ecx
+  8023e6:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8023ec:	eb 98                	jmp    802386 <sys_ep_grant+0x12>
+  8023ee:	89 c2                	mov    %eax,%edx
+  8023f0:	c1 ea 04             	shr    $0x4,%edx
+  8023f3:	83 e2 0f             	and    $0xf,%edx
+  8023f6:	83 fa 02             	cmp    $0x2,%edx
+  8023f9:	77 e5                	ja     8023e0 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  8023fb:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023fe:	83 f8 02             	cmp    $0x2,%eax
+  802401:	0f 97 c1             	seta   %cl
+  802404:	0f b6 c9             	movzbl %cl,%ecx
+  802407:	eb d7                	jmp    8023e0 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  802409:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80240e:	b8 24 00 00 00       	mov    $0x24,%eax
+  802413:	8b 55 08             	mov    0x8(%ebp),%edx
+  802416:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802419:	89 df                	mov    %ebx,%edi
+  80241b:	89 de                	mov    %ebx,%esi
+  80241d:	cd 30                	int    $0x30
+  80241f:	eb 90                	jmp    8023b1 <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802421:	83 ec 0c             	sub    $0xc,%esp
+  802424:	50                   	push   %eax
+  802425:	6a 24                	push   $0x24
+  802427:	68 f9 2b 80 00       	push   $0x802bf9
+  80242c:	6a 4a                	push   $0x4a
+  80242e:	68 16 2c 80 00       	push   $0x802c16
+  802433:	e8 f4 01 00 00       	call   80262c <_panic>
+
+00802438 <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  802438:	55                   	push   %ebp
+  802439:	89 e5                	mov    %esp,%ebp
+  80243b:	57                   	push   %edi
+  80243c:	56                   	push   %esi
+  80243d:	53                   	push   %ebx
+  80243e:	83 ec 20             	sub    $0x20,%esp
+  802441:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  802444:	8b 10                	mov    (%eax),%edx
+  802446:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802449:	8b 50 04             	mov    0x4(%eax),%edx
+  80244c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80244f:	8b 50 08             	mov    0x8(%eax),%edx
+  802452:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  802455:	8b 50 0c             	mov    0xc(%eax),%edx
+  802458:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  80245b:	8b 40 10             	mov    0x10(%eax),%eax
+  80245e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  802461:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  802464:	8b 55 08             	mov    0x8(%ebp),%edx
+  802467:	b8 25 00 00 00       	mov    $0x25,%eax
+  80246c:	55                   	push   %ebp
+  80246d:	56                   	push   %esi
+  80246e:	8b 0e                	mov    (%esi),%ecx
+  802470:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802473:	8b 7e 08             	mov    0x8(%esi),%edi
+  802476:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802479:	8b 76 0c             	mov    0xc(%esi),%esi
+  80247c:	cd 30                	int    $0x30
+  80247e:	87 34 24             	xchg   %esi,(%esp)
+  802481:	89 0e                	mov    %ecx,(%esi)
+  802483:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802486:	89 7e 08             	mov    %edi,0x8(%esi)
+  802489:	89 6e 10             	mov    %ebp,0x10(%esi)
+  80248c:	8f 46 0c             	pop    0xc(%esi)
+  80248f:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  802490:	83 c4 20             	add    $0x20,%esp
+  802493:	5b                   	pop    %ebx
+  802494:	5e                   	pop    %esi
+  802495:	5f                   	pop    %edi
+  802496:	5d                   	pop    %ebp
+  802497:	c3                   	ret
+
+00802498 <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  802498:	55                   	push   %ebp
+  802499:	89 e5                	mov    %esp,%ebp
+  80249b:	57                   	push   %edi
+  80249c:	56                   	push   %esi
+  80249d:	53                   	push   %ebx
+  80249e:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  8024a1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024a4:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  8024a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024a9:	b8 26 00 00 00       	mov    $0x26,%eax
+  8024ae:	55                   	push   %ebp
+  8024af:	56                   	push   %esi
+  8024b0:	8b 0e                	mov    (%esi),%ecx
+  8024b2:	8b 5e 04             	mov    0x4(%esi),%ebx
+  8024b5:	8b 7e 08             	mov    0x8(%esi),%edi
+  8024b8:	8b 6e 10             	mov    0x10(%esi),%ebp
+  8024bb:	8b 76 0c             	mov    0xc(%esi),%esi
+  8024be:	cd 30                	int    $0x30
+  8024c0:	87 34 24             	xchg   %esi,(%esp)
+  8024c3:	89 0e                	mov    %ecx,(%esi)
+  8024c5:	89 5e 04             	mov    %ebx,0x4(%esi)
+  8024c8:	89 7e 08             	mov    %edi,0x8(%esi)
+  8024cb:	89 6e 10             	mov    %ebp,0x10(%esi)
+  8024ce:	8f 46 0c             	pop    0xc(%esi)
+  8024d1:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  8024d2:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  8024d6:	74 0f                	je     8024e7 <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  8024d8:	85 c0                	test   %eax,%eax
+  8024da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024df:	0f 48 d1             	cmovs  %ecx,%edx
+  8024e2:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8024e5:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  8024e7:	5b                   	pop    %ebx
+  8024e8:	5e                   	pop    %esi
+  8024e9:	5f                   	pop    %edi
+  8024ea:	5d                   	pop    %ebp
+  8024eb:	c3                   	ret
+
+008024ec <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  8024ec:	55                   	push   %ebp
+  8024ed:	89 e5                	mov    %esp,%ebp
+  8024ef:	57                   	push   %edi
+  8024f0:	56                   	push   %esi
+  8024f1:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8024f2:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8024f9:	78 2f                	js     80252a <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  8024fb:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802502:	74 72                	je     802576 <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  802504:	8b 55 08             	mov    0x8(%ebp),%edx
+  802507:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80250c:	b8 27 00 00 00       	mov    $0x27,%eax
+  802511:	89 cb                	mov    %ecx,%ebx
+  802513:	89 cf                	mov    %ecx,%edi
+  802515:	89 ce                	mov    %ecx,%esi
+  802517:	55                   	push   %ebp
+  802518:	68 21 25 80 00       	push   $0x802521
+  80251d:	89 e5                	mov    %esp,%ebp
+  80251f:	0f 34                	sysenter
+  802521:	83 c4 04             	add    $0x4,%esp
+  802524:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  802525:	5b                   	pop    %ebx
+  802526:	5e                   	pop    %esi
+  802527:	5f                   	pop    %edi
+  802528:	5d                   	pop    %ebp
+  802529:	c3                   	ret
+  80252a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80252f:	0f a2                	cpuid
+		return 0;
+  802531:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802536:	f6 c6 08             	test   $0x8,%dh
+  802539:	74 15                	je     802550 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80253b:	89 c2                	mov    %eax,%edx
+  80253d:	c1 ea 08             	shr    $0x8,%edx
+  802540:	83 e2 0f             	and    $0xf,%edx
+  802543:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802548:	83 fa 06             	cmp    $0x6,%edx
+  80254b:	74 0e                	je     80255b <sys_sysring_setup+0x6f>
+  80254d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802550:	0f b6 c9             	movzbl %cl,%ecx
+  802553:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802559:	eb a0                	jmp    8024fb <sys_sysring_setup+0xf>
+  80255b:	89 c2                	mov    %eax,%edx
+  80255d:	c1 ea 04             	shr    $0x4,%edx
+  802560:	83 e2 0f             	and    $0xf,%edx
+  802563:	83 fa 02             	cmp    $0x2,%edx
+  802566:	77 e5                	ja     80254d <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  802568:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80256b:	83 f8 02             	cmp    $0x2,%eax
+  80256e:	0f 97 c1             	seta   %cl
+  802571:	0f b6 c9             	movzbl %cl,%ecx
+  802574:	eb d7                	jmp    80254d <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  802576:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80257b:	b8 27 00 00 00       	mov    $0x27,%eax
+  802580:	8b 55 08             	mov    0x8(%ebp),%edx
+  802583:	89 cb                	mov    %ecx,%ebx
+  802585:	89 cf                	mov    %ecx,%edi
+  802587:	89 ce                	mov    %ecx,%esi
+  802589:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  80258b:	eb 98                	jmp    802525 <sys_sysring_setup+0x39>
+
+0080258d <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  80258d:	55                   	push   %ebp
+  80258e:	89 e5                	mov    %esp,%ebp
+  802590:	57                   	push   %edi
+  802591:	56                   	push   %esi
+  802592:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802593:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80259a:	78 2e                	js     8025ca <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  80259c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8025a3:	74 71                	je     802616 <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  8025a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025aa:	b8 28 00 00 00       	mov    $0x28,%eax
+  8025af:	89 d1                	mov    %edx,%ecx
+  8025b1:	89 d3                	mov    %edx,%ebx
+  8025b3:	89 d7                	mov    %edx,%edi
+  8025b5:	89 d6                	mov    %edx,%esi
+  8025b7:	55                   	push   %ebp
+  8025b8:	68 c1 25 80 00       	push   $0x8025c1
+  8025bd:	89 e5                	mov    %esp,%ebp
+  8025bf:	0f 34                	sysenter
+  8025c1:	83 c4 04             	add    $0x4,%esp
+  8025c4:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8025c5:	5b                   	pop    %ebx
+  8025c6:	5e                   	pop    %esi
+  8025c7:	5f                   	pop    %edi
+  8025c8:	5d                   	pop    %ebp
+  8025c9:	c3                   	ret
+  8025ca:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025cf:	0f a2                	cpuid
+		return 0;
+  8025d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8025d6:	f6 c6 08             	test   $0x8,%dh
+  8025d9:	74 15                	je     8025f0 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025db:	89 c2                	mov    %eax,%edx
+  8025dd:	c1 ea 08             	shr    $0x8,%edx
+  8025e0:	83 e2 0f             	and    $0xf,%edx
+  8025e3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8025e8:	83 fa 06             	cmp    $0x6,%edx
+  8025eb:	74 0e                	je     8025fb <sys_sysring_enter+0x6e>
+  8025ed:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8025f0:	0f b6 c9             	movzbl %cl,%ecx
+  8025f3:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8025f9:	eb a1                	jmp    80259c <sys_sysring_enter+0xf>
+  8025fb:	89 c2                	mov    %eax,%edx
+  8025fd:	c1 ea 04             	shr    $0x4,%edx
+  802600:	83 e2 0f             	and    $0xf,%edx
+  802603:	83 fa 02             	cmp    $0x2,%edx
+  802606:	77 e5                	ja     8025ed <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  802608:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80260b:	83 f8 02             	cmp    $0x2,%eax
+  80260e:	0f 97 c1             	seta   %cl
+  802611:	0f b6 c9             	movzbl %cl,%ecx
+  802614:	eb d7                	jmp    8025ed <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  802616:	ba 00 00 00 00       	mov    $0x0,%edx
+  80261b:	b8 28 00 00 00       	mov    $0x28,%eax
+  802620:	89 d1                	mov    %edx,%ecx
+  802622:	89 d3                	mov    %edx,%ebx
+  802624:	89 d7                	mov    %edx,%edi
+  802626:	89 d6                	mov    %edx,%esi
+  802628:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  80262a:	eb 99                	jmp    8025c5 <sys_sysring_enter+0x38>
+
+0080262c <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80262c:	55                   	push   %ebp
+  80262d:	89 e5                	mov    %esp,%ebp
+  80262f:	57                   	push   %edi
+  802630:	56                   	push   %esi
+  802631:	53                   	push   %ebx
+  802632:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  802638:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  80263b:	8b 1d 00 30 80 00    	mov    0x803000,%ebx
+  802641:	e8 c8 e8 ff ff       	call   800f0e <sys_getenvid>
+  802646:	83 ec 04             	sub    $0x4,%esp
+  802649:	ff 75 0c             	push   0xc(%ebp)
+  80264c:	ff 75 08             	push   0x8(%ebp)
+  80264f:	53                   	push   %ebx
+  802650:	50                   	push   %eax
+  802651:	68 24 2c 80 00       	push   $0x802c24
+  802656:	68 00 01 00 00       	push   $0x100
+  80265b:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  802661:	56                   	push   %esi
+  802662:	e8 bc e0 ff ff       	call   800723 <snprintf>
+  802667:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  802669:	83 c4 20             	add    $0x20,%esp
+  80266c:	57                   	push   %edi
+  80266d:	ff 75 10             	push   0x10(%ebp)
+  802670:	bf 00 01 00 00       	mov    $0x100,%edi
+  802675:	89 f8                	mov    %edi,%eax
+  802677:	29 d8                	sub    %ebx,%eax
+  802679:	50                   	push   %eax
+  80267a:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  80267d:	50                   	push   %eax
+  80267e:	e8 52 e0 ff ff       	call   8006d5 <vsnprintf>
+  802683:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  802685:	83 c4 0c             	add    $0xc,%esp
+  802688:	68 47 2c 80 00       	push   $0x802c47
+  80268d:	29 df                	sub    %ebx,%edi
+  80268f:	57                   	push   %edi
+  802690:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  802693:	50                   	push   %eax
+  802694:	e8 8a e0 ff ff       	call   800723 <snprintf>
+	sys_cputs(buf, r);
+  802699:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  80269c:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  80269e:	53                   	push   %ebx
+  80269f:	56                   	push   %esi
+  8026a0:	e8 6b e6 ff ff       	call   800d10 <sys_cputs>
+  8026a5:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8026a8:	cc                   	int3
+	while (1)
+  8026a9:	eb fd                	jmp    8026a8 <_panic+0x7c>
+
+008026ab <dm>:
+  8026ab:	55                   	push   %ebp
+  8026ac:	57                   	push   %edi
+  8026ad:	56                   	push   %esi
+  8026ae:	53                   	push   %ebx
+  8026af:	83 ec 24             	sub    $0x24,%esp
+  8026b2:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8026b6:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8026ba:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8026be:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8026c2:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8026c6:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8026ca:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8026ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026d8:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8026dd:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8026e4:	00 
+  8026e5:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8026ec:	00 
+  8026ed:	89 fb                	mov    %edi,%ebx
+  8026ef:	eb 08                	jmp    8026f9 <dm+0x4e>
+  8026f1:	83 e9 01             	sub    $0x1,%ecx
+  8026f4:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8026f7:	74 68                	je     802761 <dm+0xb6>
+  8026f9:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8026fd:	01 c0                	add    %eax,%eax
+  8026ff:	89 c6                	mov    %eax,%esi
+  802701:	89 d7                	mov    %edx,%edi
+  802703:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802707:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80270b:	0f ad d0             	shrd   %cl,%edx,%eax
+  80270e:	d3 ea                	shr    %cl,%edx
+  802710:	f6 c1 20             	test   $0x20,%cl
+  802713:	74 04                	je     802719 <dm+0x6e>
+  802715:	89 d0                	mov    %edx,%eax
+  802717:	31 d2                	xor    %edx,%edx
+  802719:	83 e0 01             	and    $0x1,%eax
+  80271c:	89 04 24             	mov    %eax,(%esp)
+  80271f:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802726:	00 
+  802727:	8b 04 24             	mov    (%esp),%eax
+  80272a:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80272e:	09 f0                	or     %esi,%eax
+  802730:	09 fa                	or     %edi,%edx
+  802732:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802736:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80273a:	39 f0                	cmp    %esi,%eax
+  80273c:	89 d5                	mov    %edx,%ebp
+  80273e:	19 fd                	sbb    %edi,%ebp
+  802740:	72 af                	jb     8026f1 <dm+0x46>
+  802742:	29 f0                	sub    %esi,%eax
+  802744:	19 fa                	sbb    %edi,%edx
+  802746:	89 cf                	mov    %ecx,%edi
+  802748:	c1 ef 05             	shr    $0x5,%edi
+  80274b:	83 e7 01             	and    $0x1,%edi
+  80274e:	89 fe                	mov    %edi,%esi
+  802750:	83 f6 01             	xor    $0x1,%esi
+  802753:	d3 e6                	shl    %cl,%esi
+  802755:	d3 e7                	shl    %cl,%edi
+  802757:	09 74 24 18          	or     %esi,0x18(%esp)
+  80275b:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80275f:	eb 90                	jmp    8026f1 <dm+0x46>
+  802761:	85 db                	test   %ebx,%ebx
+  802763:	74 05                	je     80276a <dm+0xbf>
+  802765:	89 03                	mov    %eax,(%ebx)
+  802767:	89 53 04             	mov    %edx,0x4(%ebx)
+  80276a:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80276e:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802772:	83 c4 24             	add    $0x24,%esp
+  802775:	5b                   	pop    %ebx
+  802776:	5e                   	pop    %esi
+  802777:	5f                   	pop    %edi
+  802778:	5d                   	pop    %ebp
+  802779:	c3                   	ret
+
+0080277a <__udivdi3>:
+  80277a:	83 ec 08             	sub    $0x8,%esp
+  80277d:	6a 00                	push   $0x0
+  80277f:	ff 74 24 1c          	push   0x1c(%esp)
+  802783:	ff 74 24 1c          	push   0x1c(%esp)
+  802787:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80278b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80278f:	e8 17 ff ff ff       	call   8026ab <dm>
+  802794:	83 c4 14             	add    $0x14,%esp
+  802797:	c3                   	ret
+
+00802798 <__umoddi3>:
+  802798:	83 ec 18             	sub    $0x18,%esp
+  80279b:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80279f:	50                   	push   %eax
+  8027a0:	ff 74 24 2c          	push   0x2c(%esp)
+  8027a4:	ff 74 24 2c          	push   0x2c(%esp)
+  8027a8:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8027ac:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8027b0:	e8 f6 fe ff ff       	call   8026ab <dm>
+  8027b5:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8027b9:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8027bd:	83 c4 24             	add    $0x24,%esp
+  8027c0:	c3                   	ret
+
+008027c1 <__divdi3>:
+  8027c1:	53                   	push   %ebx
+  8027c2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8027c6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8027ca:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8027ce:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8027d2:	85 d2                	test   %edx,%edx
+  8027d4:	78 15                	js     8027eb <__divdi3+0x2a>
+  8027d6:	85 db                	test   %ebx,%ebx
+  8027d8:	78 34                	js     80280e <__divdi3+0x4d>
+  8027da:	83 ec 04             	sub    $0x4,%esp
+  8027dd:	6a 00                	push   $0x0
+  8027df:	53                   	push   %ebx
+  8027e0:	51                   	push   %ecx
+  8027e1:	e8 c5 fe ff ff       	call   8026ab <dm>
+  8027e6:	83 c4 10             	add    $0x10,%esp
+  8027e9:	eb 21                	jmp    80280c <__divdi3+0x4b>
+  8027eb:	f7 d8                	neg    %eax
+  8027ed:	83 d2 00             	adc    $0x0,%edx
+  8027f0:	f7 da                	neg    %edx
+  8027f2:	85 db                	test   %ebx,%ebx
+  8027f4:	78 30                	js     802826 <__divdi3+0x65>
+  8027f6:	83 ec 04             	sub    $0x4,%esp
+  8027f9:	6a 00                	push   $0x0
+  8027fb:	53                   	push   %ebx
+  8027fc:	51                   	push   %ecx
+  8027fd:	e8 a9 fe ff ff       	call   8026ab <dm>
+  802802:	83 c4 10             	add    $0x10,%esp
+  802805:	f7 d8                	neg    %eax
+  802807:	83 d2 00             	adc    $0x0,%edx
+  80280a:	f7 da                	neg    %edx
+  80280c:	5b                   	pop    %ebx
+  80280d:	c3                   	ret
+  80280e:	83 ec 04             	sub    $0x4,%esp
+  802811:	6a 00                	push   $0x0
+  802813:	f7 d9                	neg    %ecx
+  802815:	83 d3 00             	adc    $0x0,%ebx
+  802818:	f7 db                	neg    %ebx
+  80281a:	53                   	push   %ebx
+  80281b:	51                   	push   %ecx
+  80281c:	e8 8a fe ff ff       	call   8026ab <dm>
+  802821:	83 c4 10             	add    $0x10,%esp
+  802824:	eb df                	jmp    802805 <__divdi3+0x44>
+  802826:	83 ec 04             	sub    $0x4,%esp
+  802829:	6a 00                	push   $0x0
+  80282b:	f7 d9                	neg    %ecx
+  80282d:	83 d3 00             	adc    $0x0,%ebx
+  802830:	f7 db                	neg    %ebx
+  802832:	53                   	push   %ebx
+  802833:	51                   	push   %ecx
+  802834:	e8 72 fe ff ff       	call   8026ab <dm>
+  802839:	83 c4 10             	add    $0x10,%esp
+  80283c:	eb ce                	jmp    80280c <__divdi3+0x4b>
+
+0080283e <__moddi3>:
+  80283e:	55                   	push   %ebp
+  80283f:	57                   	push   %edi
+  802840:	56                   	push   %esi
+  802841:	53                   	push   %ebx
+  802842:	83 ec 18             	sub    $0x18,%esp
+  802845:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802849:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80284d:	89 f1                	mov    %esi,%ecx
+  80284f:	f7 d9                	neg    %ecx
+  802851:	89 da                	mov    %ebx,%edx
+  802853:	83 d2 00             	adc    $0x0,%edx
+  802856:	f7 da                	neg    %edx
+  802858:	0f 48 ce             	cmovs  %esi,%ecx
+  80285b:	0f 48 d3             	cmovs  %ebx,%edx
+  80285e:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802862:	50                   	push   %eax
+  802863:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802867:	f7 de                	neg    %esi
+  802869:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  80286d:	83 d0 00             	adc    $0x0,%eax
+  802870:	f7 d8                	neg    %eax
+  802872:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802877:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  80287c:	50                   	push   %eax
+  80287d:	56                   	push   %esi
+  80287e:	89 c8                	mov    %ecx,%eax
+  802880:	e8 26 fe ff ff       	call   8026ab <dm>
+  802885:	83 c4 10             	add    $0x10,%esp
+  802888:	85 db                	test   %ebx,%ebx
+  80288a:	78 10                	js     80289c <__moddi3+0x5e>
+  80288c:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802890:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802894:	83 c4 14             	add    $0x14,%esp
+  802897:	5b                   	pop    %ebx
+  802898:	5e                   	pop    %esi
+  802899:	5f                   	pop    %edi
+  80289a:	5d                   	pop    %ebp
+  80289b:	c3                   	ret
+  80289c:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8028a0:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8028a4:	f7 d8                	neg    %eax
+  8028a6:	83 d2 00             	adc    $0x0,%edx
+  8028a9:	f7 da                	neg    %edx
+  8028ab:	eb e7                	jmp    802894 <__moddi3+0x56>
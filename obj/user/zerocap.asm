@@ -0,0 +1,5290 @@
+
+obj/user/zerocap:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 9a 01 00 00       	call   8001cb <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#define DST	((char *) 0x20000000)
+#define MAXMAP	0x10000		// more than a 16-bit pp_ref can count
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+	int i, n, r;
+
+	if ((r = sys_page_alloc(0, SRC, PTE_P | PTE_U | PTE_W
+  800038:	83 ec 04             	sub    $0x4,%esp
+  80003b:	68 07 10 00 00       	push   $0x1007
+  800040:	68 00 00 00 10       	push   $0x10000000
+  800045:	6a 00                	push   $0x0
+  800047:	e8 11 11 00 00       	call   80115d <sys_page_alloc>
+  80004c:	83 c4 10             	add    $0x10,%esp
+  80004f:	85 c0                	test   %eax,%eax
+  800051:	78 4f                	js     8000a2 <umain+0x6f>
+				| PAGE_ZERO_FILL)) < 0)
+		panic("sys_page_alloc: %e", r);
+
+	for (n = 0; n < MAXMAP; n++)
+  800053:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if ((r = sys_page_map(0, SRC, 0, DST + n * PGSIZE,
+  800058:	83 ec 0c             	sub    $0xc,%esp
+  80005b:	6a 05                	push   $0x5
+  80005d:	89 d8                	mov    %ebx,%eax
+  80005f:	c1 e0 0c             	shl    $0xc,%eax
+  800062:	05 00 00 00 20       	add    $0x20000000,%eax
+  800067:	50                   	push   %eax
+  800068:	6a 00                	push   $0x0
+  80006a:	68 00 00 00 10       	push   $0x10000000
+  80006f:	6a 00                	push   $0x0
+  800071:	e8 ad 11 00 00       	call   801223 <sys_page_map>
+  800076:	83 c4 20             	add    $0x20,%esp
+  800079:	85 c0                	test   %eax,%eax
+  80007b:	0f 88 08 01 00 00    	js     800189 <umain+0x156>
+	for (n = 0; n < MAXMAP; n++)
+  800081:	83 c3 01             	add    $0x1,%ebx
+  800084:	81 fb 00 00 01 00    	cmp    $0x10000,%ebx
+  80008a:	75 cc                	jne    800058 <umain+0x25>
+				      PTE_P | PTE_U)) < 0)
+			break;
+	if (n == MAXMAP)
+		panic("mapped the zero page %d times without an error", n);
+  80008c:	68 00 00 01 00       	push   $0x10000
+  800091:	68 cc 2a 80 00       	push   $0x802acc
+  800096:	6a 1b                	push   $0x1b
+  800098:	68 f3 29 80 00       	push   $0x8029f3
+  80009d:	e8 84 01 00 00       	call   800226 <_panic>
+		panic("sys_page_alloc: %e", r);
+  8000a2:	50                   	push   %eax
+  8000a3:	68 e0 29 80 00       	push   $0x8029e0
+  8000a8:	6a 14                	push   $0x14
+  8000aa:	68 f3 29 80 00       	push   $0x8029f3
+  8000af:	e8 72 01 00 00       	call   800226 <_panic>
+	if (r != -E_NO_MEM)
+		panic("sys_page_map: %e, want -E_NO_MEM", r);
+  8000b4:	50                   	push   %eax
+  8000b5:	68 2c 2a 80 00       	push   $0x802a2c
+  8000ba:	6a 1d                	push   $0x1d
+  8000bc:	68 f3 29 80 00       	push   $0x8029f3
+  8000c1:	e8 60 01 00 00       	call   800226 <_panic>
+	cprintf("zero page refused after %d more mappings\n", n);
+
+	for (i = 0; i < n; i++)
+		if (DST[i * PGSIZE] != 0)
+			panic("mapping %d does not read as zero", i);
+  8000c6:	50                   	push   %eax
+  8000c7:	68 7c 2a 80 00       	push   $0x802a7c
+  8000cc:	6a 22                	push   $0x22
+  8000ce:	68 f3 29 80 00       	push   $0x8029f3
+  8000d3:	e8 4e 01 00 00       	call   800226 <_panic>
+	for (i = 0; i < n; i++)
+  8000d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8000dd:	eb 1b                	jmp    8000fa <umain+0xc7>
+		sys_page_unmap(0, DST + i * PGSIZE);
+  8000df:	83 ec 08             	sub    $0x8,%esp
+  8000e2:	89 f0                	mov    %esi,%eax
+  8000e4:	c1 e0 0c             	shl    $0xc,%eax
+  8000e7:	05 00 00 00 20       	add    $0x20000000,%eax
+  8000ec:	50                   	push   %eax
+  8000ed:	6a 00                	push   $0x0
+  8000ef:	e8 f3 11 00 00       	call   8012e7 <sys_page_unmap>
+	for (i = 0; i < n; i++)
+  8000f4:	83 c6 01             	add    $0x1,%esi
+  8000f7:	83 c4 10             	add    $0x10,%esp
+  8000fa:	39 f3                	cmp    %esi,%ebx
+  8000fc:	7f e1                	jg     8000df <umain+0xac>
+
+	// The zero page must still be there and still be zero.
+	if (SRC[0] != 0 || SRC[PGSIZE - 1] != 0)
+  8000fe:	80 3d 00 00 00 10 00 	cmpb   $0x0,0x10000000
+  800105:	75 48                	jne    80014f <umain+0x11c>
+  800107:	80 3d ff 0f 00 10 00 	cmpb   $0x0,0x10000fff
+  80010e:	75 3f                	jne    80014f <umain+0x11c>
+		panic("zero page is no longer zero");
+	SRC[0] = 1;
+  800110:	c6 05 00 00 00 10 01 	movb   $0x1,0x10000000
+	if ((r = sys_page_alloc(0, DST, PTE_P | PTE_U | PTE_W
+  800117:	83 ec 04             	sub    $0x4,%esp
+  80011a:	68 07 10 00 00       	push   $0x1007
+  80011f:	68 00 00 00 20       	push   $0x20000000
+  800124:	6a 00                	push   $0x0
+  800126:	e8 32 10 00 00       	call   80115d <sys_page_alloc>
+  80012b:	83 c4 10             	add    $0x10,%esp
+  80012e:	85 c0                	test   %eax,%eax
+  800130:	78 31                	js     800163 <umain+0x130>
+				| PAGE_ZERO_FILL)) < 0)
+		panic("sys_page_alloc: %e", r);
+	if (DST[0] != 0)
+  800132:	80 3d 00 00 00 20 00 	cmpb   $0x0,0x20000000
+  800139:	75 3a                	jne    800175 <umain+0x142>
+		panic("write to a copy-on-write zero page leaked");
+	cprintf("zerocap OK\n");
+  80013b:	83 ec 0c             	sub    $0xc,%esp
+  80013e:	68 1e 2a 80 00       	push   $0x802a1e
+  800143:	e8 f2 01 00 00       	call   80033a <cprintf>
+}
+  800148:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80014b:	5b                   	pop    %ebx
+  80014c:	5e                   	pop    %esi
+  80014d:	5d                   	pop    %ebp
+  80014e:	c3                   	ret
+		panic("zero page is no longer zero");
+  80014f:	83 ec 04             	sub    $0x4,%esp
+  800152:	68 02 2a 80 00       	push   $0x802a02
+  800157:	6a 28                	push   $0x28
+  800159:	68 f3 29 80 00       	push   $0x8029f3
+  80015e:	e8 c3 00 00 00       	call   800226 <_panic>
+		panic("sys_page_alloc: %e", r);
+  800163:	50                   	push   %eax
+  800164:	68 e0 29 80 00       	push   $0x8029e0
+  800169:	6a 2c                	push   $0x2c
+  80016b:	68 f3 29 80 00       	push   $0x8029f3
+  800170:	e8 b1 00 00 00       	call   800226 <_panic>
+		panic("write to a copy-on-write zero page leaked");
+  800175:	83 ec 04             	sub    $0x4,%esp
+  800178:	68 a0 2a 80 00       	push   $0x802aa0
+  80017d:	6a 2e                	push   $0x2e
+  80017f:	68 f3 29 80 00       	push   $0x8029f3
+  800184:	e8 9d 00 00 00       	call   800226 <_panic>
+	if (r != -E_NO_MEM)
+  800189:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  80018c:	0f 85 22 ff ff ff    	jne    8000b4 <umain+0x81>
+	cprintf("zero page refused after %d more mappings\n", n);
+  800192:	83 ec 08             	sub    $0x8,%esp
+  800195:	53                   	push   %ebx
+  800196:	68 50 2a 80 00       	push   $0x802a50
+  80019b:	e8 9a 01 00 00       	call   80033a <cprintf>
+	for (i = 0; i < n; i++)
+  8001a0:	83 c4 10             	add    $0x10,%esp
+  8001a3:	ba 00 00 00 20       	mov    $0x20000000,%edx
+  8001a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ad:	39 c3                	cmp    %eax,%ebx
+  8001af:	0f 8e 23 ff ff ff    	jle    8000d8 <umain+0xa5>
+		if (DST[i * PGSIZE] != 0)
+  8001b5:	0f b6 0a             	movzbl (%edx),%ecx
+  8001b8:	81 c2 00 10 00 00    	add    $0x1000,%edx
+  8001be:	84 c9                	test   %cl,%cl
+  8001c0:	0f 85 00 ff ff ff    	jne    8000c6 <umain+0x93>
+	for (i = 0; i < n; i++)
+  8001c6:	83 c0 01             	add    $0x1,%eax
+  8001c9:	eb e2                	jmp    8001ad <umain+0x17a>
+
+008001cb <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001cb:	55                   	push   %ebp
+  8001cc:	89 e5                	mov    %esp,%ebp
+  8001ce:	56                   	push   %esi
+  8001cf:	53                   	push   %ebx
+  8001d0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001d3:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+  envid_t id = sys_getenvid();
+  8001d6:	e8 e3 0e 00 00       	call   8010be <sys_getenvid>
+  thisenv = &envs[ENVX(id)];
+  8001db:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001e0:	69 c0 68 01 00 00    	imul   $0x168,%eax,%eax
+  8001e6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001eb:	a3 08 30 80 00       	mov    %eax,0x803008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001f0:	85 db                	test   %ebx,%ebx
+  8001f2:	7e 07                	jle    8001fb <libmain+0x30>
+		binaryname = argv[0];
+  8001f4:	8b 06                	mov    (%esi),%eax
+  8001f6:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  8001fb:	83 ec 08             	sub    $0x8,%esp
+  8001fe:	56                   	push   %esi
+  8001ff:	53                   	push   %ebx
+  800200:	e8 2e fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800205:	e8 0a 00 00 00       	call   800214 <exit>
+}
+  80020a:	83 c4 10             	add    $0x10,%esp
+  80020d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800210:	5b                   	pop    %ebx
+  800211:	5e                   	pop    %esi
+  800212:	5d                   	pop    %ebp
+  800213:	c3                   	ret
+
+00800214 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800214:	55                   	push   %ebp
+  800215:	89 e5                	mov    %esp,%ebp
+  800217:	83 ec 14             	sub    $0x14,%esp
+	sys_env_destroy(0);
+  80021a:	6a 00                	push   $0x0
+  80021c:	e8 db 0d 00 00       	call   800ffc <sys_env_destroy>
+}
+  800221:	83 c4 10             	add    $0x10,%esp
+  800224:	c9                   	leave
+  800225:	c3                   	ret
+
+00800226 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800226:	55                   	push   %ebp
+  800227:	89 e5                	mov    %esp,%ebp
+  800229:	57                   	push   %edi
+  80022a:	56                   	push   %esi
+  80022b:	53                   	push   %ebx
+  80022c:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+	va_list ap;
+	char buf[256];
+	int r = 0;
+
+	va_start(ap, fmt);
+  800232:	8d 7d 14             	lea    0x14(%ebp),%edi
+
+	// Print the panic message
+	r = snprintf(buf, sizeof(buf), "[%08x] user panic in %s at %s:%d: ",
+  800235:	8b 1d 00 30 80 00    	mov    0x803000,%ebx
+  80023b:	e8 7e 0e 00 00       	call   8010be <sys_getenvid>
+  800240:	83 ec 04             	sub    $0x4,%esp
+  800243:	ff 75 0c             	push   0xc(%ebp)
+  800246:	ff 75 08             	push   0x8(%ebp)
+  800249:	53                   	push   %ebx
+  80024a:	50                   	push   %eax
+  80024b:	68 08 2b 80 00       	push   $0x802b08
+  800250:	68 00 01 00 00       	push   $0x100
+  800255:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  80025b:	56                   	push   %esi
+  80025c:	e8 72 06 00 00       	call   8008d3 <snprintf>
+  800261:	89 c3                	mov    %eax,%ebx
+		     sys_getenvid(), binaryname, file, line);
+	r += vsnprintf(buf + r, sizeof(buf) - r, fmt, ap);
+  800263:	83 c4 20             	add    $0x20,%esp
+  800266:	57                   	push   %edi
+  800267:	ff 75 10             	push   0x10(%ebp)
+  80026a:	bf 00 01 00 00       	mov    $0x100,%edi
+  80026f:	89 f8                	mov    %edi,%eax
+  800271:	29 d8                	sub    %ebx,%eax
+  800273:	50                   	push   %eax
+  800274:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  800277:	50                   	push   %eax
+  800278:	e8 08 06 00 00       	call   800885 <vsnprintf>
+  80027d:	01 c3                	add    %eax,%ebx
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  80027f:	83 c4 0c             	add    $0xc,%esp
+  800282:	68 28 2a 80 00       	push   $0x802a28
+  800287:	29 df                	sub    %ebx,%edi
+  800289:	57                   	push   %edi
+  80028a:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  80028d:	50                   	push   %eax
+  80028e:	e8 40 06 00 00       	call   8008d3 <snprintf>
+	sys_cputs(buf, r);
+  800293:	83 c4 08             	add    $0x8,%esp
+	r += snprintf(buf + r, sizeof(buf) - r, "\n");
+  800296:	01 c3                	add    %eax,%ebx
+	sys_cputs(buf, r);
+  800298:	53                   	push   %ebx
+  800299:	56                   	push   %esi
+  80029a:	e8 21 0c 00 00       	call   800ec0 <sys_cputs>
+  80029f:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002a2:	cc                   	int3
+	while (1)
+  8002a3:	eb fd                	jmp    8002a2 <_panic+0x7c>
+
+008002a5 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002a5:	55                   	push   %ebp
+  8002a6:	89 e5                	mov    %esp,%ebp
+  8002a8:	53                   	push   %ebx
+  8002a9:	83 ec 04             	sub    $0x4,%esp
+  8002ac:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8002af:	8b 13                	mov    (%ebx),%edx
+  8002b1:	8d 42 01             	lea    0x1(%edx),%eax
+  8002b4:	89 03                	mov    %eax,(%ebx)
+  8002b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002b9:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8002bd:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002c2:	74 09                	je     8002cd <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002c4:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002cb:	c9                   	leave
+  8002cc:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002cd:	83 ec 08             	sub    $0x8,%esp
+  8002d0:	68 ff 00 00 00       	push   $0xff
+  8002d5:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002d8:	50                   	push   %eax
+  8002d9:	e8 e2 0b 00 00       	call   800ec0 <sys_cputs>
+		b->idx = 0;
+  8002de:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002e4:	83 c4 10             	add    $0x10,%esp
+  8002e7:	eb db                	jmp    8002c4 <putch+0x1f>
+
+008002e9 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002e9:	55                   	push   %ebp
+  8002ea:	89 e5                	mov    %esp,%ebp
+  8002ec:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002f2:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002f9:	00 00 00 
+	b.cnt = 0;
+  8002fc:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800303:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800306:	ff 75 0c             	push   0xc(%ebp)
+  800309:	ff 75 08             	push   0x8(%ebp)
+  80030c:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800312:	50                   	push   %eax
+  800313:	68 a5 02 80 00       	push   $0x8002a5
+  800318:	e8 14 01 00 00       	call   800431 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80031d:	83 c4 08             	add    $0x8,%esp
+  800320:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800326:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80032c:	50                   	push   %eax
+  80032d:	e8 8e 0b 00 00       	call   800ec0 <sys_cputs>
+
+	return b.cnt;
+}
+  800332:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800338:	c9                   	leave
+  800339:	c3                   	ret
+
+0080033a <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80033a:	55                   	push   %ebp
+  80033b:	89 e5                	mov    %esp,%ebp
+  80033d:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800340:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800343:	50                   	push   %eax
+  800344:	ff 75 08             	push   0x8(%ebp)
+  800347:	e8 9d ff ff ff       	call   8002e9 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80034c:	c9                   	leave
+  80034d:	c3                   	ret
+
+0080034e <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80034e:	55                   	push   %ebp
+  80034f:	89 e5                	mov    %esp,%ebp
+  800351:	57                   	push   %edi
+  800352:	56                   	push   %esi
+  800353:	53                   	push   %ebx
+  800354:	83 ec 1c             	sub    $0x1c,%esp
+  800357:	89 c7                	mov    %eax,%edi
+  800359:	89 d6                	mov    %edx,%esi
+  80035b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80035e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800361:	89 d1                	mov    %edx,%ecx
+  800363:	89 c2                	mov    %eax,%edx
+  800365:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800368:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80036b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80036e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800371:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800374:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80037b:	39 c2                	cmp    %eax,%edx
+  80037d:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800380:	72 3e                	jb     8003c0 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800382:	83 ec 0c             	sub    $0xc,%esp
+  800385:	ff 75 18             	push   0x18(%ebp)
+  800388:	83 eb 01             	sub    $0x1,%ebx
+  80038b:	53                   	push   %ebx
+  80038c:	50                   	push   %eax
+  80038d:	83 ec 08             	sub    $0x8,%esp
+  800390:	ff 75 e4             	push   -0x1c(%ebp)
+  800393:	ff 75 e0             	push   -0x20(%ebp)
+  800396:	ff 75 dc             	push   -0x24(%ebp)
+  800399:	ff 75 d8             	push   -0x28(%ebp)
+  80039c:	e8 0a 25 00 00       	call   8028ab <__udivdi3>
+  8003a1:	83 c4 18             	add    $0x18,%esp
+  8003a4:	52                   	push   %edx
+  8003a5:	50                   	push   %eax
+  8003a6:	89 f2                	mov    %esi,%edx
+  8003a8:	89 f8                	mov    %edi,%eax
+  8003aa:	e8 9f ff ff ff       	call   80034e <printnum>
+  8003af:	83 c4 20             	add    $0x20,%esp
+  8003b2:	eb 13                	jmp    8003c7 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8003b4:	83 ec 08             	sub    $0x8,%esp
+  8003b7:	56                   	push   %esi
+  8003b8:	ff 75 18             	push   0x18(%ebp)
+  8003bb:	ff d7                	call   *%edi
+  8003bd:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8003c0:	83 eb 01             	sub    $0x1,%ebx
+  8003c3:	85 db                	test   %ebx,%ebx
+  8003c5:	7f ed                	jg     8003b4 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8003c7:	83 ec 08             	sub    $0x8,%esp
+  8003ca:	56                   	push   %esi
+  8003cb:	83 ec 04             	sub    $0x4,%esp
+  8003ce:	ff 75 e4             	push   -0x1c(%ebp)
+  8003d1:	ff 75 e0             	push   -0x20(%ebp)
+  8003d4:	ff 75 dc             	push   -0x24(%ebp)
+  8003d7:	ff 75 d8             	push   -0x28(%ebp)
+  8003da:	e8 ea 24 00 00       	call   8028c9 <__umoddi3>
+  8003df:	83 c4 14             	add    $0x14,%esp
+  8003e2:	0f be 80 2b 2b 80 00 	movsbl 0x802b2b(%eax),%eax
+  8003e9:	50                   	push   %eax
+  8003ea:	ff d7                	call   *%edi
+}
+  8003ec:	83 c4 10             	add    $0x10,%esp
+  8003ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003f2:	5b                   	pop    %ebx
+  8003f3:	5e                   	pop    %esi
+  8003f4:	5f                   	pop    %edi
+  8003f5:	5d                   	pop    %ebp
+  8003f6:	c3                   	ret
+
+008003f7 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003f7:	55                   	push   %ebp
+  8003f8:	89 e5                	mov    %esp,%ebp
+  8003fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003fd:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800401:	8b 10                	mov    (%eax),%edx
+  800403:	3b 50 04             	cmp    0x4(%eax),%edx
+  800406:	73 0a                	jae    800412 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800408:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80040b:	89 08                	mov    %ecx,(%eax)
+  80040d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800410:	88 02                	mov    %al,(%edx)
+}
+  800412:	5d                   	pop    %ebp
+  800413:	c3                   	ret
+
+00800414 <printfmt>:
+{
+  800414:	55                   	push   %ebp
+  800415:	89 e5                	mov    %esp,%ebp
+  800417:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80041a:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80041d:	50                   	push   %eax
+  80041e:	ff 75 10             	push   0x10(%ebp)
+  800421:	ff 75 0c             	push   0xc(%ebp)
+  800424:	ff 75 08             	push   0x8(%ebp)
+  800427:	e8 05 00 00 00       	call   800431 <vprintfmt>
+}
+  80042c:	83 c4 10             	add    $0x10,%esp
+  80042f:	c9                   	leave
+  800430:	c3                   	ret
+
+00800431 <vprintfmt>:
+{
+  800431:	55                   	push   %ebp
+  800432:	89 e5                	mov    %esp,%ebp
+  800434:	57                   	push   %edi
+  800435:	56                   	push   %esi
+  800436:	53                   	push   %ebx
+  800437:	83 ec 2c             	sub    $0x2c,%esp
+  80043a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80043d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800440:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800443:	eb 0a                	jmp    80044f <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800445:	83 ec 08             	sub    $0x8,%esp
+  800448:	53                   	push   %ebx
+  800449:	50                   	push   %eax
+  80044a:	ff d6                	call   *%esi
+  80044c:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80044f:	83 c7 01             	add    $0x1,%edi
+  800452:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800456:	83 f8 25             	cmp    $0x25,%eax
+  800459:	74 0c                	je     800467 <vprintfmt+0x36>
+			if (ch == '\0')
+  80045b:	85 c0                	test   %eax,%eax
+  80045d:	75 e6                	jne    800445 <vprintfmt+0x14>
+}
+  80045f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800462:	5b                   	pop    %ebx
+  800463:	5e                   	pop    %esi
+  800464:	5f                   	pop    %edi
+  800465:	5d                   	pop    %ebp
+  800466:	c3                   	ret
+		padc = ' ';
+  800467:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80046b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800472:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800479:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800480:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800485:	8d 47 01             	lea    0x1(%edi),%eax
+  800488:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80048b:	0f b6 17             	movzbl (%edi),%edx
+  80048e:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800491:	3c 55                	cmp    $0x55,%al
+  800493:	0f 87 cf 03 00 00    	ja     800868 <vprintfmt+0x437>
+  800499:	0f b6 c0             	movzbl %al,%eax
+  80049c:	ff 24 85 20 2c 80 00 	jmp    *0x802c20(,%eax,4)
+  8004a3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8004a6:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8004aa:	eb d9                	jmp    800485 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ac:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8004af:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8004b3:	eb d0                	jmp    800485 <vprintfmt+0x54>
+  8004b5:	0f b6 d2             	movzbl %dl,%edx
+  8004b8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8004bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c0:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8004c3:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8004c6:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8004ca:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8004cd:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8004d0:	83 f9 09             	cmp    $0x9,%ecx
+  8004d3:	77 55                	ja     80052a <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8004d5:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8004d8:	eb e9                	jmp    8004c3 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8004da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004dd:	8b 00                	mov    (%eax),%eax
+  8004df:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e5:	8d 40 04             	lea    0x4(%eax),%eax
+  8004e8:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004eb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8004ee:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004f2:	79 91                	jns    800485 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8004f4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004f7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004fa:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800501:	eb 82                	jmp    800485 <vprintfmt+0x54>
+			if (width < 0)
+  800503:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800506:	85 d2                	test   %edx,%edx
+  800508:	b8 00 00 00 00       	mov    $0x0,%eax
+  80050d:	0f 49 c2             	cmovns %edx,%eax
+  800510:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800513:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800516:	e9 6a ff ff ff       	jmp    800485 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80051b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80051e:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800525:	e9 5b ff ff ff       	jmp    800485 <vprintfmt+0x54>
+  80052a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80052d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800530:	eb bc                	jmp    8004ee <vprintfmt+0xbd>
+			lflag++;
+  800532:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800535:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800538:	e9 48 ff ff ff       	jmp    800485 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80053d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800540:	8d 78 04             	lea    0x4(%eax),%edi
+  800543:	83 ec 08             	sub    $0x8,%esp
+  800546:	53                   	push   %ebx
+  800547:	ff 30                	push   (%eax)
+  800549:	ff d6                	call   *%esi
+			break;
+  80054b:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80054e:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800551:	e9 b1 02 00 00       	jmp    800807 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800556:	8b 45 14             	mov    0x14(%ebp),%eax
+  800559:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80055c:	8b 10                	mov    (%eax),%edx
+  80055e:	89 d0                	mov    %edx,%eax
+  800560:	f7 d8                	neg    %eax
+  800562:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800565:	83 f8 0d             	cmp    $0xd,%eax
+  800568:	7f 23                	jg     80058d <vprintfmt+0x15c>
+  80056a:	8b 14 85 80 2d 80 00 	mov    0x802d80(,%eax,4),%edx
+  800571:	85 d2                	test   %edx,%edx
+  800573:	74 18                	je     80058d <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800575:	52                   	push   %edx
+  800576:	68 4c 2b 80 00       	push   $0x802b4c
+  80057b:	53                   	push   %ebx
+  80057c:	56                   	push   %esi
+  80057d:	e8 92 fe ff ff       	call   800414 <printfmt>
+  800582:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800585:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800588:	e9 7a 02 00 00       	jmp    800807 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80058d:	50                   	push   %eax
+  80058e:	68 43 2b 80 00       	push   $0x802b43
+  800593:	53                   	push   %ebx
+  800594:	56                   	push   %esi
+  800595:	e8 7a fe ff ff       	call   800414 <printfmt>
+  80059a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80059d:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8005a0:	e9 62 02 00 00       	jmp    800807 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a8:	83 c0 04             	add    $0x4,%eax
+  8005ab:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8005ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b1:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8005b3:	85 c9                	test   %ecx,%ecx
+  8005b5:	b8 3c 2b 80 00       	mov    $0x802b3c,%eax
+  8005ba:	0f 45 c1             	cmovne %ecx,%eax
+  8005bd:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8005c0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005c4:	7e 06                	jle    8005cc <vprintfmt+0x19b>
+  8005c6:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8005ca:	75 0b                	jne    8005d7 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005cc:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8005cf:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005d2:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005d5:	eb 5c                	jmp    800633 <vprintfmt+0x202>
+  8005d7:	83 ec 08             	sub    $0x8,%esp
+  8005da:	ff 75 d0             	push   -0x30(%ebp)
+  8005dd:	ff 75 cc             	push   -0x34(%ebp)
+  8005e0:	e8 20 03 00 00       	call   800905 <strnlen>
+  8005e5:	89 c2                	mov    %eax,%edx
+  8005e7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005ea:	29 d0                	sub    %edx,%eax
+  8005ec:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005ef:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005f3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005f6:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005f9:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005fb:	eb 0e                	jmp    80060b <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8005fd:	83 ec 08             	sub    $0x8,%esp
+  800600:	53                   	push   %ebx
+  800601:	57                   	push   %edi
+  800602:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800605:	83 ee 01             	sub    $0x1,%esi
+  800608:	83 c4 10             	add    $0x10,%esp
+  80060b:	85 f6                	test   %esi,%esi
+  80060d:	7f ee                	jg     8005fd <vprintfmt+0x1cc>
+  80060f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800612:	8b 75 08             	mov    0x8(%ebp),%esi
+  800615:	85 c0                	test   %eax,%eax
+  800617:	ba 00 00 00 00       	mov    $0x0,%edx
+  80061c:	0f 49 d0             	cmovns %eax,%edx
+  80061f:	29 d0                	sub    %edx,%eax
+  800621:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800624:	eb a6                	jmp    8005cc <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800626:	83 ec 08             	sub    $0x8,%esp
+  800629:	53                   	push   %ebx
+  80062a:	52                   	push   %edx
+  80062b:	ff 55 08             	call   *0x8(%ebp)
+  80062e:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800631:	89 f1                	mov    %esi,%ecx
+  800633:	8d 71 01             	lea    0x1(%ecx),%esi
+  800636:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80063a:	0f be d0             	movsbl %al,%edx
+  80063d:	85 d2                	test   %edx,%edx
+  80063f:	74 28                	je     800669 <vprintfmt+0x238>
+  800641:	85 ff                	test   %edi,%edi
+  800643:	78 05                	js     80064a <vprintfmt+0x219>
+  800645:	83 ef 01             	sub    $0x1,%edi
+  800648:	78 30                	js     80067a <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80064a:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80064e:	74 d6                	je     800626 <vprintfmt+0x1f5>
+  800650:	0f be c0             	movsbl %al,%eax
+  800653:	83 e8 20             	sub    $0x20,%eax
+  800656:	83 f8 5e             	cmp    $0x5e,%eax
+  800659:	76 cb                	jbe    800626 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80065b:	83 ec 08             	sub    $0x8,%esp
+  80065e:	53                   	push   %ebx
+  80065f:	6a 3f                	push   $0x3f
+  800661:	ff 55 08             	call   *0x8(%ebp)
+  800664:	83 c4 10             	add    $0x10,%esp
+  800667:	eb c8                	jmp    800631 <vprintfmt+0x200>
+  800669:	8b 75 08             	mov    0x8(%ebp),%esi
+  80066c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80066f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800672:	01 d0                	add    %edx,%eax
+  800674:	29 c8                	sub    %ecx,%eax
+  800676:	89 c7                	mov    %eax,%edi
+  800678:	eb 13                	jmp    80068d <vprintfmt+0x25c>
+  80067a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80067d:	eb ed                	jmp    80066c <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80067f:	83 ec 08             	sub    $0x8,%esp
+  800682:	53                   	push   %ebx
+  800683:	6a 20                	push   $0x20
+  800685:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800687:	83 ef 01             	sub    $0x1,%edi
+  80068a:	83 c4 10             	add    $0x10,%esp
+  80068d:	85 ff                	test   %edi,%edi
+  80068f:	7f ee                	jg     80067f <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800691:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800694:	89 45 14             	mov    %eax,0x14(%ebp)
+  800697:	e9 6b 01 00 00       	jmp    800807 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80069c:	83 f9 01             	cmp    $0x1,%ecx
+  80069f:	7f 1f                	jg     8006c0 <vprintfmt+0x28f>
+	else if (lflag)
+  8006a1:	85 c9                	test   %ecx,%ecx
+  8006a3:	74 67                	je     80070c <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8006a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a8:	8b 00                	mov    (%eax),%eax
+  8006aa:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006ad:	89 c1                	mov    %eax,%ecx
+  8006af:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006b2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b8:	8d 40 04             	lea    0x4(%eax),%eax
+  8006bb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006be:	eb 17                	jmp    8006d7 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8006c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c3:	8b 50 04             	mov    0x4(%eax),%edx
+  8006c6:	8b 00                	mov    (%eax),%eax
+  8006c8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006cb:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d1:	8d 40 08             	lea    0x8(%eax),%eax
+  8006d4:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006d7:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006da:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8006dd:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8006e2:	85 c9                	test   %ecx,%ecx
+  8006e4:	0f 89 03 01 00 00    	jns    8007ed <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8006ea:	83 ec 08             	sub    $0x8,%esp
+  8006ed:	53                   	push   %ebx
+  8006ee:	6a 2d                	push   $0x2d
+  8006f0:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8006f2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006f5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006f8:	f7 da                	neg    %edx
+  8006fa:	83 d1 00             	adc    $0x0,%ecx
+  8006fd:	f7 d9                	neg    %ecx
+  8006ff:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800702:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800707:	e9 e1 00 00 00       	jmp    8007ed <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80070c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070f:	8b 00                	mov    (%eax),%eax
+  800711:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800714:	89 c1                	mov    %eax,%ecx
+  800716:	c1 f9 1f             	sar    $0x1f,%ecx
+  800719:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80071c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071f:	8d 40 04             	lea    0x4(%eax),%eax
+  800722:	89 45 14             	mov    %eax,0x14(%ebp)
+  800725:	eb b0                	jmp    8006d7 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800727:	83 f9 01             	cmp    $0x1,%ecx
+  80072a:	7f 1e                	jg     80074a <vprintfmt+0x319>
+	else if (lflag)
+  80072c:	85 c9                	test   %ecx,%ecx
+  80072e:	74 32                	je     800762 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800730:	8b 45 14             	mov    0x14(%ebp),%eax
+  800733:	8b 10                	mov    (%eax),%edx
+  800735:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80073a:	8d 40 04             	lea    0x4(%eax),%eax
+  80073d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800740:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800745:	e9 a3 00 00 00       	jmp    8007ed <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80074a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074d:	8b 10                	mov    (%eax),%edx
+  80074f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800752:	8d 40 08             	lea    0x8(%eax),%eax
+  800755:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800758:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80075d:	e9 8b 00 00 00       	jmp    8007ed <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800762:	8b 45 14             	mov    0x14(%ebp),%eax
+  800765:	8b 10                	mov    (%eax),%edx
+  800767:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80076c:	8d 40 04             	lea    0x4(%eax),%eax
+  80076f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800772:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800777:	eb 74                	jmp    8007ed <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800779:	83 f9 01             	cmp    $0x1,%ecx
+  80077c:	7f 1b                	jg     800799 <vprintfmt+0x368>
+	else if (lflag)
+  80077e:	85 c9                	test   %ecx,%ecx
+  800780:	74 2c                	je     8007ae <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800782:	8b 45 14             	mov    0x14(%ebp),%eax
+  800785:	8b 10                	mov    (%eax),%edx
+  800787:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80078c:	8d 40 04             	lea    0x4(%eax),%eax
+  80078f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800792:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800797:	eb 54                	jmp    8007ed <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800799:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079c:	8b 10                	mov    (%eax),%edx
+  80079e:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007a1:	8d 40 08             	lea    0x8(%eax),%eax
+  8007a4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007a7:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8007ac:	eb 3f                	jmp    8007ed <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8007ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b1:	8b 10                	mov    (%eax),%edx
+  8007b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007b8:	8d 40 04             	lea    0x4(%eax),%eax
+  8007bb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007be:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8007c3:	eb 28                	jmp    8007ed <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8007c5:	83 ec 08             	sub    $0x8,%esp
+  8007c8:	53                   	push   %ebx
+  8007c9:	6a 30                	push   $0x30
+  8007cb:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8007cd:	83 c4 08             	add    $0x8,%esp
+  8007d0:	53                   	push   %ebx
+  8007d1:	6a 78                	push   $0x78
+  8007d3:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8007d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d8:	8b 10                	mov    (%eax),%edx
+  8007da:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007df:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007e2:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007e8:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8007ed:	83 ec 0c             	sub    $0xc,%esp
+  8007f0:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8007f4:	50                   	push   %eax
+  8007f5:	ff 75 e0             	push   -0x20(%ebp)
+  8007f8:	57                   	push   %edi
+  8007f9:	51                   	push   %ecx
+  8007fa:	52                   	push   %edx
+  8007fb:	89 da                	mov    %ebx,%edx
+  8007fd:	89 f0                	mov    %esi,%eax
+  8007ff:	e8 4a fb ff ff       	call   80034e <printnum>
+			break;
+  800804:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800807:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80080a:	e9 40 fc ff ff       	jmp    80044f <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80080f:	83 f9 01             	cmp    $0x1,%ecx
+  800812:	7f 1b                	jg     80082f <vprintfmt+0x3fe>
+	else if (lflag)
+  800814:	85 c9                	test   %ecx,%ecx
+  800816:	74 2c                	je     800844 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800818:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081b:	8b 10                	mov    (%eax),%edx
+  80081d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800822:	8d 40 04             	lea    0x4(%eax),%eax
+  800825:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800828:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80082d:	eb be                	jmp    8007ed <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80082f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800832:	8b 10                	mov    (%eax),%edx
+  800834:	8b 48 04             	mov    0x4(%eax),%ecx
+  800837:	8d 40 08             	lea    0x8(%eax),%eax
+  80083a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80083d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800842:	eb a9                	jmp    8007ed <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800844:	8b 45 14             	mov    0x14(%ebp),%eax
+  800847:	8b 10                	mov    (%eax),%edx
+  800849:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80084e:	8d 40 04             	lea    0x4(%eax),%eax
+  800851:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800854:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800859:	eb 92                	jmp    8007ed <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  80085b:	83 ec 08             	sub    $0x8,%esp
+  80085e:	53                   	push   %ebx
+  80085f:	6a 25                	push   $0x25
+  800861:	ff d6                	call   *%esi
+			break;
+  800863:	83 c4 10             	add    $0x10,%esp
+  800866:	eb 9f                	jmp    800807 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800868:	83 ec 08             	sub    $0x8,%esp
+  80086b:	53                   	push   %ebx
+  80086c:	6a 25                	push   $0x25
+  80086e:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800870:	83 c4 10             	add    $0x10,%esp
+  800873:	89 f8                	mov    %edi,%eax
+  800875:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800879:	74 05                	je     800880 <vprintfmt+0x44f>
+  80087b:	83 e8 01             	sub    $0x1,%eax
+  80087e:	eb f5                	jmp    800875 <vprintfmt+0x444>
+  800880:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800883:	eb 82                	jmp    800807 <vprintfmt+0x3d6>
+
+00800885 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800885:	55                   	push   %ebp
+  800886:	89 e5                	mov    %esp,%ebp
+  800888:	83 ec 18             	sub    $0x18,%esp
+  80088b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80088e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800891:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800894:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800898:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80089b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8008a2:	85 c0                	test   %eax,%eax
+  8008a4:	74 26                	je     8008cc <vsnprintf+0x47>
+  8008a6:	85 d2                	test   %edx,%edx
+  8008a8:	7e 22                	jle    8008cc <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008aa:	ff 75 14             	push   0x14(%ebp)
+  8008ad:	ff 75 10             	push   0x10(%ebp)
+  8008b0:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008b3:	50                   	push   %eax
+  8008b4:	68 f7 03 80 00       	push   $0x8003f7
+  8008b9:	e8 73 fb ff ff       	call   800431 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008be:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008c1:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008c7:	83 c4 10             	add    $0x10,%esp
+}
+  8008ca:	c9                   	leave
+  8008cb:	c3                   	ret
+		return -E_INVAL;
+  8008cc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008d1:	eb f7                	jmp    8008ca <vsnprintf+0x45>
+
+008008d3 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008d3:	55                   	push   %ebp
+  8008d4:	89 e5                	mov    %esp,%ebp
+  8008d6:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8008d9:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008dc:	50                   	push   %eax
+  8008dd:	ff 75 10             	push   0x10(%ebp)
+  8008e0:	ff 75 0c             	push   0xc(%ebp)
+  8008e3:	ff 75 08             	push   0x8(%ebp)
+  8008e6:	e8 9a ff ff ff       	call   800885 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008eb:	c9                   	leave
+  8008ec:	c3                   	ret
+
+008008ed <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008ed:	55                   	push   %ebp
+  8008ee:	89 e5                	mov    %esp,%ebp
+  8008f0:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f8:	eb 03                	jmp    8008fd <strlen+0x10>
+		n++;
+  8008fa:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008fd:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800901:	75 f7                	jne    8008fa <strlen+0xd>
+	return n;
+}
+  800903:	5d                   	pop    %ebp
+  800904:	c3                   	ret
+
+00800905 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800905:	55                   	push   %ebp
+  800906:	89 e5                	mov    %esp,%ebp
+  800908:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80090b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80090e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800913:	eb 03                	jmp    800918 <strnlen+0x13>
+		n++;
+  800915:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800918:	39 d0                	cmp    %edx,%eax
+  80091a:	74 08                	je     800924 <strnlen+0x1f>
+  80091c:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800920:	75 f3                	jne    800915 <strnlen+0x10>
+  800922:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800924:	89 d0                	mov    %edx,%eax
+  800926:	5d                   	pop    %ebp
+  800927:	c3                   	ret
+
+00800928 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800928:	55                   	push   %ebp
+  800929:	89 e5                	mov    %esp,%ebp
+  80092b:	53                   	push   %ebx
+  80092c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80092f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800932:	b8 00 00 00 00       	mov    $0x0,%eax
+  800937:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80093b:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80093e:	83 c0 01             	add    $0x1,%eax
+  800941:	84 d2                	test   %dl,%dl
+  800943:	75 f2                	jne    800937 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800945:	89 c8                	mov    %ecx,%eax
+  800947:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80094a:	c9                   	leave
+  80094b:	c3                   	ret
+
+0080094c <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80094c:	55                   	push   %ebp
+  80094d:	89 e5                	mov    %esp,%ebp
+  80094f:	53                   	push   %ebx
+  800950:	83 ec 10             	sub    $0x10,%esp
+  800953:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800956:	53                   	push   %ebx
+  800957:	e8 91 ff ff ff       	call   8008ed <strlen>
+  80095c:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80095f:	ff 75 0c             	push   0xc(%ebp)
+  800962:	01 d8                	add    %ebx,%eax
+  800964:	50                   	push   %eax
+  800965:	e8 be ff ff ff       	call   800928 <strcpy>
+	return dst;
+}
+  80096a:	89 d8                	mov    %ebx,%eax
+  80096c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80096f:	c9                   	leave
+  800970:	c3                   	ret
+
+00800971 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800971:	55                   	push   %ebp
+  800972:	89 e5                	mov    %esp,%ebp
+  800974:	56                   	push   %esi
+  800975:	53                   	push   %ebx
+  800976:	8b 75 08             	mov    0x8(%ebp),%esi
+  800979:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80097c:	89 f3                	mov    %esi,%ebx
+  80097e:	03 5d 10             	add    0x10(%ebp),%ebx
+  800981:	89 f0                	mov    %esi,%eax
+  800983:	eb 0f                	jmp    800994 <strncpy+0x23>
+		*dst++ = *src;
+  800985:	83 c0 01             	add    $0x1,%eax
+  800988:	0f b6 0a             	movzbl (%edx),%ecx
+  80098b:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80098e:	80 f9 01             	cmp    $0x1,%cl
+  800991:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800994:	39 d8                	cmp    %ebx,%eax
+  800996:	75 ed                	jne    800985 <strncpy+0x14>
+	}
+	return ret;
+}
+  800998:	89 f0                	mov    %esi,%eax
+  80099a:	5b                   	pop    %ebx
+  80099b:	5e                   	pop    %esi
+  80099c:	5d                   	pop    %ebp
+  80099d:	c3                   	ret
+
+0080099e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80099e:	55                   	push   %ebp
+  80099f:	89 e5                	mov    %esp,%ebp
+  8009a1:	56                   	push   %esi
+  8009a2:	53                   	push   %ebx
+  8009a3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009a9:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8009ac:	89 f0                	mov    %esi,%eax
+  8009ae:	85 d2                	test   %edx,%edx
+  8009b0:	74 21                	je     8009d3 <strlcpy+0x35>
+  8009b2:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8009b6:	89 f2                	mov    %esi,%edx
+  8009b8:	eb 09                	jmp    8009c3 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8009ba:	83 c1 01             	add    $0x1,%ecx
+  8009bd:	83 c2 01             	add    $0x1,%edx
+  8009c0:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8009c3:	39 c2                	cmp    %eax,%edx
+  8009c5:	74 09                	je     8009d0 <strlcpy+0x32>
+  8009c7:	0f b6 19             	movzbl (%ecx),%ebx
+  8009ca:	84 db                	test   %bl,%bl
+  8009cc:	75 ec                	jne    8009ba <strlcpy+0x1c>
+  8009ce:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8009d0:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009d3:	29 f0                	sub    %esi,%eax
+}
+  8009d5:	5b                   	pop    %ebx
+  8009d6:	5e                   	pop    %esi
+  8009d7:	5d                   	pop    %ebp
+  8009d8:	c3                   	ret
+
+008009d9 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009d9:	55                   	push   %ebp
+  8009da:	89 e5                	mov    %esp,%ebp
+  8009dc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009df:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009e2:	eb 06                	jmp    8009ea <strcmp+0x11>
+		p++, q++;
+  8009e4:	83 c1 01             	add    $0x1,%ecx
+  8009e7:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009ea:	0f b6 01             	movzbl (%ecx),%eax
+  8009ed:	84 c0                	test   %al,%al
+  8009ef:	74 04                	je     8009f5 <strcmp+0x1c>
+  8009f1:	3a 02                	cmp    (%edx),%al
+  8009f3:	74 ef                	je     8009e4 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009f5:	0f b6 c0             	movzbl %al,%eax
+  8009f8:	0f b6 12             	movzbl (%edx),%edx
+  8009fb:	29 d0                	sub    %edx,%eax
+}
+  8009fd:	5d                   	pop    %ebp
+  8009fe:	c3                   	ret
+
+008009ff <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009ff:	55                   	push   %ebp
+  800a00:	89 e5                	mov    %esp,%ebp
+  800a02:	53                   	push   %ebx
+  800a03:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a09:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800a0c:	eb 09                	jmp    800a17 <strncmp+0x18>
+		n--, p++, q++;
+  800a0e:	83 ea 01             	sub    $0x1,%edx
+  800a11:	83 c0 01             	add    $0x1,%eax
+  800a14:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800a17:	85 d2                	test   %edx,%edx
+  800a19:	74 18                	je     800a33 <strncmp+0x34>
+  800a1b:	0f b6 18             	movzbl (%eax),%ebx
+  800a1e:	84 db                	test   %bl,%bl
+  800a20:	74 04                	je     800a26 <strncmp+0x27>
+  800a22:	3a 19                	cmp    (%ecx),%bl
+  800a24:	74 e8                	je     800a0e <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a26:	0f b6 00             	movzbl (%eax),%eax
+  800a29:	0f b6 11             	movzbl (%ecx),%edx
+  800a2c:	29 d0                	sub    %edx,%eax
+}
+  800a2e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a31:	c9                   	leave
+  800a32:	c3                   	ret
+		return 0;
+  800a33:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a38:	eb f4                	jmp    800a2e <strncmp+0x2f>
+
+00800a3a <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a3a:	55                   	push   %ebp
+  800a3b:	89 e5                	mov    %esp,%ebp
+  800a3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a40:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a44:	eb 03                	jmp    800a49 <strchr+0xf>
+  800a46:	83 c0 01             	add    $0x1,%eax
+  800a49:	0f b6 10             	movzbl (%eax),%edx
+  800a4c:	84 d2                	test   %dl,%dl
+  800a4e:	74 06                	je     800a56 <strchr+0x1c>
+		if (*s == c)
+  800a50:	38 ca                	cmp    %cl,%dl
+  800a52:	75 f2                	jne    800a46 <strchr+0xc>
+  800a54:	eb 05                	jmp    800a5b <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a56:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a5b:	5d                   	pop    %ebp
+  800a5c:	c3                   	ret
+
+00800a5d <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a5d:	55                   	push   %ebp
+  800a5e:	89 e5                	mov    %esp,%ebp
+  800a60:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a63:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a67:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a6a:	38 ca                	cmp    %cl,%dl
+  800a6c:	74 09                	je     800a77 <strfind+0x1a>
+  800a6e:	84 d2                	test   %dl,%dl
+  800a70:	74 05                	je     800a77 <strfind+0x1a>
+	for (; *s; s++)
+  800a72:	83 c0 01             	add    $0x1,%eax
+  800a75:	eb f0                	jmp    800a67 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a77:	5d                   	pop    %ebp
+  800a78:	c3                   	ret
+
+00800a79 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a79:	55                   	push   %ebp
+  800a7a:	89 e5                	mov    %esp,%ebp
+  800a7c:	57                   	push   %edi
+  800a7d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a80:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a83:	85 c9                	test   %ecx,%ecx
+  800a85:	74 20                	je     800aa7 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a87:	89 f8                	mov    %edi,%eax
+  800a89:	09 c8                	or     %ecx,%eax
+  800a8b:	a8 03                	test   $0x3,%al
+  800a8d:	75 12                	jne    800aa1 <memset+0x28>
+		c &= 0xFF;
+  800a8f:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a93:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a99:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a9c:	fc                   	cld
+  800a9d:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a9f:	eb 06                	jmp    800aa7 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800aa1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800aa4:	fc                   	cld
+  800aa5:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800aa7:	89 f8                	mov    %edi,%eax
+  800aa9:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800aac:	c9                   	leave
+  800aad:	c3                   	ret
+
+00800aae <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800aae:	55                   	push   %ebp
+  800aaf:	89 e5                	mov    %esp,%ebp
+  800ab1:	57                   	push   %edi
+  800ab2:	56                   	push   %esi
+  800ab3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ab6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ab9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800abc:	39 c6                	cmp    %eax,%esi
+  800abe:	73 32                	jae    800af2 <memmove+0x44>
+  800ac0:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800ac3:	39 d0                	cmp    %edx,%eax
+  800ac5:	73 2b                	jae    800af2 <memmove+0x44>
+		s += n;
+		d += n;
+  800ac7:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800aca:	89 d6                	mov    %edx,%esi
+  800acc:	09 fe                	or     %edi,%esi
+  800ace:	09 ce                	or     %ecx,%esi
+  800ad0:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ad6:	75 0e                	jne    800ae6 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ad8:	83 ef 04             	sub    $0x4,%edi
+  800adb:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ade:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ae1:	fd                   	std
+  800ae2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ae4:	eb 09                	jmp    800aef <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ae6:	83 ef 01             	sub    $0x1,%edi
+  800ae9:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800aec:	fd                   	std
+  800aed:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800aef:	fc                   	cld
+  800af0:	eb 1a                	jmp    800b0c <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800af2:	89 f2                	mov    %esi,%edx
+  800af4:	09 c2                	or     %eax,%edx
+  800af6:	09 ca                	or     %ecx,%edx
+  800af8:	f6 c2 03             	test   $0x3,%dl
+  800afb:	75 0a                	jne    800b07 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800afd:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b00:	89 c7                	mov    %eax,%edi
+  800b02:	fc                   	cld
+  800b03:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b05:	eb 05                	jmp    800b0c <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b07:	89 c7                	mov    %eax,%edi
+  800b09:	fc                   	cld
+  800b0a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b0c:	5e                   	pop    %esi
+  800b0d:	5f                   	pop    %edi
+  800b0e:	5d                   	pop    %ebp
+  800b0f:	c3                   	ret
+
+00800b10 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b10:	55                   	push   %ebp
+  800b11:	89 e5                	mov    %esp,%ebp
+  800b13:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b16:	ff 75 10             	push   0x10(%ebp)
+  800b19:	ff 75 0c             	push   0xc(%ebp)
+  800b1c:	ff 75 08             	push   0x8(%ebp)
+  800b1f:	e8 8a ff ff ff       	call   800aae <memmove>
+}
+  800b24:	c9                   	leave
+  800b25:	c3                   	ret
+
+00800b26 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b26:	55                   	push   %ebp
+  800b27:	89 e5                	mov    %esp,%ebp
+  800b29:	56                   	push   %esi
+  800b2a:	53                   	push   %ebx
+  800b2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b2e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b31:	89 c6                	mov    %eax,%esi
+  800b33:	03 75 10             	add    0x10(%ebp),%esi
+  800b36:	eb 06                	jmp    800b3e <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b38:	83 c0 01             	add    $0x1,%eax
+  800b3b:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b3e:	39 f0                	cmp    %esi,%eax
+  800b40:	74 14                	je     800b56 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b42:	0f b6 08             	movzbl (%eax),%ecx
+  800b45:	0f b6 1a             	movzbl (%edx),%ebx
+  800b48:	38 d9                	cmp    %bl,%cl
+  800b4a:	74 ec                	je     800b38 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b4c:	0f b6 c1             	movzbl %cl,%eax
+  800b4f:	0f b6 db             	movzbl %bl,%ebx
+  800b52:	29 d8                	sub    %ebx,%eax
+  800b54:	eb 05                	jmp    800b5b <memcmp+0x35>
+	}
+
+	return 0;
+  800b56:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b5b:	5b                   	pop    %ebx
+  800b5c:	5e                   	pop    %esi
+  800b5d:	5d                   	pop    %ebp
+  800b5e:	c3                   	ret
+
+00800b5f <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b5f:	55                   	push   %ebp
+  800b60:	89 e5                	mov    %esp,%ebp
+  800b62:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b65:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b68:	89 c2                	mov    %eax,%edx
+  800b6a:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b6d:	eb 03                	jmp    800b72 <memfind+0x13>
+  800b6f:	83 c0 01             	add    $0x1,%eax
+  800b72:	39 d0                	cmp    %edx,%eax
+  800b74:	73 04                	jae    800b7a <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b76:	38 08                	cmp    %cl,(%eax)
+  800b78:	75 f5                	jne    800b6f <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b7a:	5d                   	pop    %ebp
+  800b7b:	c3                   	ret
+
+00800b7c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b7c:	55                   	push   %ebp
+  800b7d:	89 e5                	mov    %esp,%ebp
+  800b7f:	57                   	push   %edi
+  800b80:	56                   	push   %esi
+  800b81:	53                   	push   %ebx
+  800b82:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b85:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b88:	eb 03                	jmp    800b8d <strtol+0x11>
+		s++;
+  800b8a:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b8d:	0f b6 02             	movzbl (%edx),%eax
+  800b90:	3c 20                	cmp    $0x20,%al
+  800b92:	74 f6                	je     800b8a <strtol+0xe>
+  800b94:	3c 09                	cmp    $0x9,%al
+  800b96:	74 f2                	je     800b8a <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b98:	3c 2b                	cmp    $0x2b,%al
+  800b9a:	74 2a                	je     800bc6 <strtol+0x4a>
+	int neg = 0;
+  800b9c:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800ba1:	3c 2d                	cmp    $0x2d,%al
+  800ba3:	74 2b                	je     800bd0 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ba5:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800bab:	75 0f                	jne    800bbc <strtol+0x40>
+  800bad:	80 3a 30             	cmpb   $0x30,(%edx)
+  800bb0:	74 28                	je     800bda <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800bb2:	85 db                	test   %ebx,%ebx
+  800bb4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bb9:	0f 44 d8             	cmove  %eax,%ebx
+  800bbc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bc1:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bc4:	eb 46                	jmp    800c0c <strtol+0x90>
+		s++;
+  800bc6:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800bc9:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bce:	eb d5                	jmp    800ba5 <strtol+0x29>
+		s++, neg = 1;
+  800bd0:	83 c2 01             	add    $0x1,%edx
+  800bd3:	bf 01 00 00 00       	mov    $0x1,%edi
+  800bd8:	eb cb                	jmp    800ba5 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bda:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800bde:	74 0e                	je     800bee <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800be0:	85 db                	test   %ebx,%ebx
+  800be2:	75 d8                	jne    800bbc <strtol+0x40>
+		s++, base = 8;
+  800be4:	83 c2 01             	add    $0x1,%edx
+  800be7:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bec:	eb ce                	jmp    800bbc <strtol+0x40>
+		s += 2, base = 16;
+  800bee:	83 c2 02             	add    $0x2,%edx
+  800bf1:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bf6:	eb c4                	jmp    800bbc <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800bf8:	0f be c0             	movsbl %al,%eax
+  800bfb:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800bfe:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c01:	7d 3a                	jge    800c3d <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800c03:	83 c2 01             	add    $0x1,%edx
+  800c06:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c0a:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800c0c:	0f b6 02             	movzbl (%edx),%eax
+  800c0f:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c12:	89 f3                	mov    %esi,%ebx
+  800c14:	80 fb 09             	cmp    $0x9,%bl
+  800c17:	76 df                	jbe    800bf8 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800c19:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c1c:	89 f3                	mov    %esi,%ebx
+  800c1e:	80 fb 19             	cmp    $0x19,%bl
+  800c21:	77 08                	ja     800c2b <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800c23:	0f be c0             	movsbl %al,%eax
+  800c26:	83 e8 57             	sub    $0x57,%eax
+  800c29:	eb d3                	jmp    800bfe <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c2b:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c2e:	89 f3                	mov    %esi,%ebx
+  800c30:	80 fb 19             	cmp    $0x19,%bl
+  800c33:	77 08                	ja     800c3d <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800c35:	0f be c0             	movsbl %al,%eax
+  800c38:	83 e8 37             	sub    $0x37,%eax
+  800c3b:	eb c1                	jmp    800bfe <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c3d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c41:	74 05                	je     800c48 <strtol+0xcc>
+		*endptr = (char *) s;
+  800c43:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c46:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c48:	89 c8                	mov    %ecx,%eax
+  800c4a:	f7 d8                	neg    %eax
+  800c4c:	85 ff                	test   %edi,%edi
+  800c4e:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c51:	89 c8                	mov    %ecx,%eax
+  800c53:	5b                   	pop    %ebx
+  800c54:	5e                   	pop    %esi
+  800c55:	5f                   	pop    %edi
+  800c56:	5d                   	pop    %ebp
+  800c57:	c3                   	ret
+
+00800c58 <atoi>:
+
+int
+atoi(const char *s)
+{
+  800c58:	55                   	push   %ebp
+  800c59:	89 e5                	mov    %esp,%ebp
+  800c5b:	83 ec 0c             	sub    $0xc,%esp
+	return (int)strtol(s, NULL, 10);
+  800c5e:	6a 0a                	push   $0xa
+  800c60:	6a 00                	push   $0x0
+  800c62:	ff 75 08             	push   0x8(%ebp)
+  800c65:	e8 12 ff ff ff       	call   800b7c <strtol>
+}
+  800c6a:	c9                   	leave
+  800c6b:	c3                   	ret
+
+00800c6c <page_vec_call>:
+// trap and then fails it with -E_AGAIN; resubmit whatever is left until
+// the call finishes or really fails.  'done' gets the total.
+static int
+page_vec_call(int num, envid_t env, envid_t dstenv,
+	      const struct page_range *vec, size_t n, size_t *done)
+{
+  800c6c:	55                   	push   %ebp
+  800c6d:	89 e5                	mov    %esp,%ebp
+  800c6f:	57                   	push   %edi
+  800c70:	56                   	push   %esi
+  800c71:	53                   	push   %ebx
+  800c72:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  800c78:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  800c7e:	89 95 cc fd ff ff    	mov    %edx,-0x234(%ebp)
+  800c84:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+	struct page_range rest[PAGE_VEC_MAX];
+	size_t ndone, total = 0;
+  800c8a:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+  800c91:	00 00 00 
+	int r;
+
+	while (1) {
+		ndone = 0;
+  800c94:	c7 85 e4 fd ff ff 00 	movl   $0x0,-0x21c(%ebp)
+  800c9b:	00 00 00 
+		if (num == SYS_page_map_vec)
+  800c9e:	83 bd d4 fd ff ff 10 	cmpl   $0x10,-0x22c(%ebp)
+  800ca5:	74 76                	je     800d1d <page_vec_call+0xb1>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+				    (uint32_t) &ndone);
+		else
+			r = syscall(num, 0, env, (uint32_t) vec, n,
+  800ca7:	8d bd e4 fd ff ff    	lea    -0x21c(%ebp),%edi
+  800cad:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cb0:	89 85 c8 fd ff ff    	mov    %eax,-0x238(%ebp)
+	if (syscall_sysenter < 0)
+  800cb6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800cbd:	0f 88 06 01 00 00    	js     800dc9 <page_vec_call+0x15d>
+	if (syscall_sysenter)
+  800cc3:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800cca:	0f 84 48 01 00 00    	je     800e18 <page_vec_call+0x1ac>
+	asm volatile("pushl %%ebp\n"
+  800cd0:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800cd6:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800cdc:	be 00 00 00 00       	mov    $0x0,%esi
+  800ce1:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800ce7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800cea:	55                   	push   %ebp
+  800ceb:	68 f4 0c 80 00       	push   $0x800cf4
+  800cf0:	89 e5                	mov    %esp,%ebp
+  800cf2:	0f 34                	sysenter
+  800cf4:	83 c4 04             	add    $0x4,%esp
+  800cf7:	5d                   	pop    %ebp
+				    (uint32_t) &ndone, 0);
+		total += ndone;
+  800cf8:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+  800cfe:	01 95 d0 fd ff ff    	add    %edx,-0x230(%ebp)
+		if (r != -E_AGAIN)
+  800d04:	83 f8 f4             	cmp    $0xfffffff4,%eax
+  800d07:	0f 85 9a 01 00 00    	jne    800ea7 <page_vec_call+0x23b>
+  800d0d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d12:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d15:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d18:	e9 29 01 00 00       	jmp    800e46 <page_vec_call+0x1da>
+			r = syscall(num, 0, env, dstenv, (uint32_t) vec, n,
+  800d1d:	8d b5 e4 fd ff ff    	lea    -0x21c(%ebp),%esi
+  800d23:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d26:	89 c7                	mov    %eax,%edi
+	if (syscall_sysenter < 0)
+  800d28:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d2f:	78 2f                	js     800d60 <page_vec_call+0xf4>
+	if (syscall_sysenter)
+  800d31:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800d38:	74 72                	je     800dac <page_vec_call+0x140>
+	asm volatile("pushl %%ebp\n"
+  800d3a:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800d40:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800d46:	b8 10 00 00 00       	mov    $0x10,%eax
+  800d4b:	89 fb                	mov    %edi,%ebx
+  800d4d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800d50:	55                   	push   %ebp
+  800d51:	68 5a 0d 80 00       	push   $0x800d5a
+  800d56:	89 e5                	mov    %esp,%ebp
+  800d58:	0f 34                	sysenter
+  800d5a:	83 c4 04             	add    $0x4,%esp
+  800d5d:	5d                   	pop    %ebp
+	return ret;
+  800d5e:	eb 98                	jmp    800cf8 <page_vec_call+0x8c>
+
+static inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800d60:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d65:	0f a2                	cpuid
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+		return 0;
+  800d67:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800d6c:	f6 c6 08             	test   $0x8,%dh
+  800d6f:	74 15                	je     800d86 <page_vec_call+0x11a>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800d71:	89 c2                	mov    %eax,%edx
+  800d73:	c1 ea 08             	shr    $0x8,%edx
+  800d76:	83 e2 0f             	and    $0xf,%edx
+  800d79:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d7e:	83 fa 06             	cmp    $0x6,%edx
+  800d81:	74 0e                	je     800d91 <page_vec_call+0x125>
+  800d83:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800d86:	0f b6 c9             	movzbl %cl,%ecx
+  800d89:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800d8f:	eb a0                	jmp    800d31 <page_vec_call+0xc5>
+  800d91:	89 c2                	mov    %eax,%edx
+  800d93:	c1 ea 04             	shr    $0x4,%edx
+  800d96:	83 e2 0f             	and    $0xf,%edx
+  800d99:	83 fa 02             	cmp    $0x2,%edx
+  800d9c:	77 e5                	ja     800d83 <page_vec_call+0x117>
+		 && (eax & 0xf) < 3);
+  800d9e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800da1:	83 f8 02             	cmp    $0x2,%eax
+  800da4:	0f 97 c1             	seta   %cl
+  800da7:	0f b6 c9             	movzbl %cl,%ecx
+  800daa:	eb d7                	jmp    800d83 <page_vec_call+0x117>
+		asm volatile("int %1\n"
+  800dac:	b8 10 00 00 00       	mov    $0x10,%eax
+  800db1:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800db7:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  800dbd:	89 fb                	mov    %edi,%ebx
+  800dbf:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800dc2:	cd 30                	int    $0x30
+  800dc4:	e9 2f ff ff ff       	jmp    800cf8 <page_vec_call+0x8c>
+  800dc9:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dce:	0f a2                	cpuid
+		return 0;
+  800dd0:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800dd5:	f6 c6 08             	test   $0x8,%dh
+  800dd8:	74 15                	je     800def <page_vec_call+0x183>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800dda:	89 c2                	mov    %eax,%edx
+  800ddc:	c1 ea 08             	shr    $0x8,%edx
+  800ddf:	83 e2 0f             	and    $0xf,%edx
+  800de2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800de7:	83 fa 06             	cmp    $0x6,%edx
+  800dea:	74 11                	je     800dfd <page_vec_call+0x191>
+  800dec:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800def:	0f b6 c9             	movzbl %cl,%ecx
+  800df2:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800df8:	e9 c6 fe ff ff       	jmp    800cc3 <page_vec_call+0x57>
+  800dfd:	89 c2                	mov    %eax,%edx
+  800dff:	c1 ea 04             	shr    $0x4,%edx
+  800e02:	83 e2 0f             	and    $0xf,%edx
+  800e05:	83 fa 02             	cmp    $0x2,%edx
+  800e08:	77 e2                	ja     800dec <page_vec_call+0x180>
+		 && (eax & 0xf) < 3);
+  800e0a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800e0d:	83 f8 02             	cmp    $0x2,%eax
+  800e10:	0f 97 c1             	seta   %cl
+  800e13:	0f b6 c9             	movzbl %cl,%ecx
+  800e16:	eb d4                	jmp    800dec <page_vec_call+0x180>
+		asm volatile("int %1\n"
+  800e18:	be 00 00 00 00       	mov    $0x0,%esi
+  800e1d:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  800e23:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  800e29:	8b 8d c8 fd ff ff    	mov    -0x238(%ebp),%ecx
+  800e2f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800e32:	cd 30                	int    $0x30
+  800e34:	e9 bf fe ff ff       	jmp    800cf8 <page_vec_call+0x8c>
+			break;
+
+		// Drop the ranges that are finished and the finished
+		// part of the one that was cut short.
+		while (n > 0 && ndone >= vec->pr_npages) {
+			ndone -= vec->pr_npages;
+  800e39:	29 da                	sub    %ebx,%edx
+			vec++;
+  800e3b:	83 c6 10             	add    $0x10,%esi
+			n--;
+  800e3e:	83 e8 01             	sub    $0x1,%eax
+  800e41:	b9 01 00 00 00       	mov    $0x1,%ecx
+		while (n > 0 && ndone >= vec->pr_npages) {
+  800e46:	85 c0                	test   %eax,%eax
+  800e48:	74 58                	je     800ea2 <page_vec_call+0x236>
+  800e4a:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800e4d:	39 da                	cmp    %ebx,%edx
+  800e4f:	73 e8                	jae    800e39 <page_vec_call+0x1cd>
+  800e51:	89 75 08             	mov    %esi,0x8(%ebp)
+  800e54:	89 45 0c             	mov    %eax,0xc(%ebp)
+  800e57:	84 c9                	test   %cl,%cl
+  800e59:	74 06                	je     800e61 <page_vec_call+0x1f5>
+  800e5b:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+		if (n == 0) {
+			// Nothing is left after all.
+			r = 0;
+			break;
+		}
+		memmove(rest, vec, n * sizeof(*vec));
+  800e61:	83 ec 04             	sub    $0x4,%esp
+  800e64:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e67:	c1 e0 04             	shl    $0x4,%eax
+  800e6a:	50                   	push   %eax
+  800e6b:	ff 75 08             	push   0x8(%ebp)
+  800e6e:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800e74:	53                   	push   %ebx
+  800e75:	e8 34 fc ff ff       	call   800aae <memmove>
+		rest[0].pr_va += ndone * PGSIZE;
+  800e7a:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+  800e80:	89 c2                	mov    %eax,%edx
+  800e82:	c1 e2 0c             	shl    $0xc,%edx
+  800e85:	01 95 e8 fd ff ff    	add    %edx,-0x218(%ebp)
+		rest[0].pr_dstva += ndone * PGSIZE;
+  800e8b:	01 95 f4 fd ff ff    	add    %edx,-0x20c(%ebp)
+		rest[0].pr_npages -= ndone;
+  800e91:	29 85 ec fd ff ff    	sub    %eax,-0x214(%ebp)
+		ndone = 0;
+  800e97:	83 c4 10             	add    $0x10,%esp
+		vec = rest;
+  800e9a:	89 5d 08             	mov    %ebx,0x8(%ebp)
+		ndone = 0;
+  800e9d:	e9 f2 fd ff ff       	jmp    800c94 <page_vec_call+0x28>
+			r = 0;
+  800ea2:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (done)
+  800ea7:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800eab:	74 0b                	je     800eb8 <page_vec_call+0x24c>
+		*done = total;
+  800ead:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800eb0:	8b 8d d0 fd ff ff    	mov    -0x230(%ebp),%ecx
+  800eb6:	89 0f                	mov    %ecx,(%edi)
+	return r;
+}
+  800eb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ebb:	5b                   	pop    %ebx
+  800ebc:	5e                   	pop    %esi
+  800ebd:	5f                   	pop    %edi
+  800ebe:	5d                   	pop    %ebp
+  800ebf:	c3                   	ret
+
+00800ec0 <sys_cputs>:
+{
+  800ec0:	55                   	push   %ebp
+  800ec1:	89 e5                	mov    %esp,%ebp
+  800ec3:	57                   	push   %edi
+  800ec4:	56                   	push   %esi
+  800ec5:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800ec6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ecd:	78 2d                	js     800efc <sys_cputs+0x3c>
+	if (syscall_sysenter)
+  800ecf:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800ed6:	74 70                	je     800f48 <sys_cputs+0x88>
+	asm volatile("pushl %%ebp\n"
+  800ed8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800edd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee3:	89 c3                	mov    %eax,%ebx
+  800ee5:	89 c7                	mov    %eax,%edi
+  800ee7:	89 c6                	mov    %eax,%esi
+  800ee9:	55                   	push   %ebp
+  800eea:	68 f3 0e 80 00       	push   $0x800ef3
+  800eef:	89 e5                	mov    %esp,%ebp
+  800ef1:	0f 34                	sysenter
+  800ef3:	83 c4 04             	add    $0x4,%esp
+  800ef6:	5d                   	pop    %ebp
+}
+  800ef7:	5b                   	pop    %ebx
+  800ef8:	5e                   	pop    %esi
+  800ef9:	5f                   	pop    %edi
+  800efa:	5d                   	pop    %ebp
+  800efb:	c3                   	ret
+  800efc:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f01:	0f a2                	cpuid
+		return 0;
+  800f03:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800f08:	f6 c6 08             	test   $0x8,%dh
+  800f0b:	74 15                	je     800f22 <sys_cputs+0x62>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f0d:	89 c2                	mov    %eax,%edx
+  800f0f:	c1 ea 08             	shr    $0x8,%edx
+  800f12:	83 e2 0f             	and    $0xf,%edx
+  800f15:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f1a:	83 fa 06             	cmp    $0x6,%edx
+  800f1d:	74 0e                	je     800f2d <sys_cputs+0x6d>
+  800f1f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800f22:	0f b6 c9             	movzbl %cl,%ecx
+  800f25:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800f2b:	eb a2                	jmp    800ecf <sys_cputs+0xf>
+  800f2d:	89 c2                	mov    %eax,%edx
+  800f2f:	c1 ea 04             	shr    $0x4,%edx
+  800f32:	83 e2 0f             	and    $0xf,%edx
+  800f35:	83 fa 02             	cmp    $0x2,%edx
+  800f38:	77 e5                	ja     800f1f <sys_cputs+0x5f>
+		 && (eax & 0xf) < 3);
+  800f3a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800f3d:	83 f8 02             	cmp    $0x2,%eax
+  800f40:	0f 97 c1             	seta   %cl
+  800f43:	0f b6 c9             	movzbl %cl,%ecx
+  800f46:	eb d7                	jmp    800f1f <sys_cputs+0x5f>
+		asm volatile("int %1\n"
+  800f48:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f4d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f50:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f53:	89 c3                	mov    %eax,%ebx
+  800f55:	89 c7                	mov    %eax,%edi
+  800f57:	89 c6                	mov    %eax,%esi
+  800f59:	cd 30                	int    $0x30
+}
+  800f5b:	eb 9a                	jmp    800ef7 <sys_cputs+0x37>
+
+00800f5d <sys_cgetc>:
+{
+  800f5d:	55                   	push   %ebp
+  800f5e:	89 e5                	mov    %esp,%ebp
+  800f60:	57                   	push   %edi
+  800f61:	56                   	push   %esi
+  800f62:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  800f63:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f6a:	78 2e                	js     800f9a <sys_cgetc+0x3d>
+	if (syscall_sysenter)
+  800f6c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  800f73:	74 71                	je     800fe6 <sys_cgetc+0x89>
+	asm volatile("pushl %%ebp\n"
+  800f75:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f7a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f7f:	89 d1                	mov    %edx,%ecx
+  800f81:	89 d3                	mov    %edx,%ebx
+  800f83:	89 d7                	mov    %edx,%edi
+  800f85:	89 d6                	mov    %edx,%esi
+  800f87:	55                   	push   %ebp
+  800f88:	68 91 0f 80 00       	push   $0x800f91
+  800f8d:	89 e5                	mov    %esp,%ebp
+  800f8f:	0f 34                	sysenter
+  800f91:	83 c4 04             	add    $0x4,%esp
+  800f94:	5d                   	pop    %ebp
+}
+  800f95:	5b                   	pop    %ebx
+  800f96:	5e                   	pop    %esi
+  800f97:	5f                   	pop    %edi
+  800f98:	5d                   	pop    %ebp
+  800f99:	c3                   	ret
+  800f9a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f9f:	0f a2                	cpuid
+		return 0;
+  800fa1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  800fa6:	f6 c6 08             	test   $0x8,%dh
+  800fa9:	74 15                	je     800fc0 <sys_cgetc+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800fab:	89 c2                	mov    %eax,%edx
+  800fad:	c1 ea 08             	shr    $0x8,%edx
+  800fb0:	83 e2 0f             	and    $0xf,%edx
+  800fb3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800fb8:	83 fa 06             	cmp    $0x6,%edx
+  800fbb:	74 0e                	je     800fcb <sys_cgetc+0x6e>
+  800fbd:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  800fc0:	0f b6 c9             	movzbl %cl,%ecx
+  800fc3:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  800fc9:	eb a1                	jmp    800f6c <sys_cgetc+0xf>
+  800fcb:	89 c2                	mov    %eax,%edx
+  800fcd:	c1 ea 04             	shr    $0x4,%edx
+  800fd0:	83 e2 0f             	and    $0xf,%edx
+  800fd3:	83 fa 02             	cmp    $0x2,%edx
+  800fd6:	77 e5                	ja     800fbd <sys_cgetc+0x60>
+		 && (eax & 0xf) < 3);
+  800fd8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  800fdb:	83 f8 02             	cmp    $0x2,%eax
+  800fde:	0f 97 c1             	seta   %cl
+  800fe1:	0f b6 c9             	movzbl %cl,%ecx
+  800fe4:	eb d7                	jmp    800fbd <sys_cgetc+0x60>
+		asm volatile("int %1\n"
+  800fe6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800feb:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ff0:	89 d1                	mov    %edx,%ecx
+  800ff2:	89 d3                	mov    %edx,%ebx
+  800ff4:	89 d7                	mov    %edx,%edi
+  800ff6:	89 d6                	mov    %edx,%esi
+  800ff8:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800ffa:	eb 99                	jmp    800f95 <sys_cgetc+0x38>
+
+00800ffc <sys_env_destroy>:
+{
+  800ffc:	55                   	push   %ebp
+  800ffd:	89 e5                	mov    %esp,%ebp
+  800fff:	57                   	push   %edi
+  801000:	56                   	push   %esi
+  801001:	53                   	push   %ebx
+  801002:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801005:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80100c:	78 36                	js     801044 <sys_env_destroy+0x48>
+	if (syscall_sysenter)
+  80100e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801015:	74 79                	je     801090 <sys_env_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  801017:	8b 55 08             	mov    0x8(%ebp),%edx
+  80101a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80101f:	b8 03 00 00 00       	mov    $0x3,%eax
+  801024:	89 cb                	mov    %ecx,%ebx
+  801026:	89 cf                	mov    %ecx,%edi
+  801028:	89 ce                	mov    %ecx,%esi
+  80102a:	55                   	push   %ebp
+  80102b:	68 34 10 80 00       	push   $0x801034
+  801030:	89 e5                	mov    %esp,%ebp
+  801032:	0f 34                	sysenter
+  801034:	83 c4 04             	add    $0x4,%esp
+  801037:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801038:	85 c0                	test   %eax,%eax
+  80103a:	7f 6b                	jg     8010a7 <sys_env_destroy+0xab>
+}
+  80103c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80103f:	5b                   	pop    %ebx
+  801040:	5e                   	pop    %esi
+  801041:	5f                   	pop    %edi
+  801042:	5d                   	pop    %ebp
+  801043:	c3                   	ret
+  801044:	b8 01 00 00 00       	mov    $0x1,%eax
+  801049:	0f a2                	cpuid
+		return 0;
+  80104b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801050:	f6 c6 08             	test   $0x8,%dh
+  801053:	74 15                	je     80106a <sys_env_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801055:	89 c2                	mov    %eax,%edx
+  801057:	c1 ea 08             	shr    $0x8,%edx
+  80105a:	83 e2 0f             	and    $0xf,%edx
+  80105d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801062:	83 fa 06             	cmp    $0x6,%edx
+  801065:	74 0e                	je     801075 <sys_env_destroy+0x79>
+  801067:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80106a:	0f b6 c9             	movzbl %cl,%ecx
+  80106d:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801073:	eb 99                	jmp    80100e <sys_env_destroy+0x12>
+  801075:	89 c2                	mov    %eax,%edx
+  801077:	c1 ea 04             	shr    $0x4,%edx
+  80107a:	83 e2 0f             	and    $0xf,%edx
+  80107d:	83 fa 02             	cmp    $0x2,%edx
+  801080:	77 e5                	ja     801067 <sys_env_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  801082:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801085:	83 f8 02             	cmp    $0x2,%eax
+  801088:	0f 97 c1             	seta   %cl
+  80108b:	0f b6 c9             	movzbl %cl,%ecx
+  80108e:	eb d7                	jmp    801067 <sys_env_destroy+0x6b>
+		asm volatile("int %1\n"
+  801090:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801095:	b8 03 00 00 00       	mov    $0x3,%eax
+  80109a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109d:	89 cb                	mov    %ecx,%ebx
+  80109f:	89 cf                	mov    %ecx,%edi
+  8010a1:	89 ce                	mov    %ecx,%esi
+  8010a3:	cd 30                	int    $0x30
+  8010a5:	eb 91                	jmp    801038 <sys_env_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010a7:	83 ec 0c             	sub    $0xc,%esp
+  8010aa:	50                   	push   %eax
+  8010ab:	6a 03                	push   $0x3
+  8010ad:	68 f9 2d 80 00       	push   $0x802df9
+  8010b2:	6a 4a                	push   $0x4a
+  8010b4:	68 16 2e 80 00       	push   $0x802e16
+  8010b9:	e8 68 f1 ff ff       	call   800226 <_panic>
+
+008010be <sys_getenvid>:
+{
+  8010be:	55                   	push   %ebp
+  8010bf:	89 e5                	mov    %esp,%ebp
+  8010c1:	57                   	push   %edi
+  8010c2:	56                   	push   %esi
+  8010c3:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8010c4:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8010cb:	78 2e                	js     8010fb <sys_getenvid+0x3d>
+	if (syscall_sysenter)
+  8010cd:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8010d4:	74 71                	je     801147 <sys_getenvid+0x89>
+	asm volatile("pushl %%ebp\n"
+  8010d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010db:	b8 02 00 00 00       	mov    $0x2,%eax
+  8010e0:	89 d1                	mov    %edx,%ecx
+  8010e2:	89 d3                	mov    %edx,%ebx
+  8010e4:	89 d7                	mov    %edx,%edi
+  8010e6:	89 d6                	mov    %edx,%esi
+  8010e8:	55                   	push   %ebp
+  8010e9:	68 f2 10 80 00       	push   $0x8010f2
+  8010ee:	89 e5                	mov    %esp,%ebp
+  8010f0:	0f 34                	sysenter
+  8010f2:	83 c4 04             	add    $0x4,%esp
+  8010f5:	5d                   	pop    %ebp
+}
+  8010f6:	5b                   	pop    %ebx
+  8010f7:	5e                   	pop    %esi
+  8010f8:	5f                   	pop    %edi
+  8010f9:	5d                   	pop    %ebp
+  8010fa:	c3                   	ret
+  8010fb:	b8 01 00 00 00       	mov    $0x1,%eax
+  801100:	0f a2                	cpuid
+		return 0;
+  801102:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801107:	f6 c6 08             	test   $0x8,%dh
+  80110a:	74 15                	je     801121 <sys_getenvid+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80110c:	89 c2                	mov    %eax,%edx
+  80110e:	c1 ea 08             	shr    $0x8,%edx
+  801111:	83 e2 0f             	and    $0xf,%edx
+  801114:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801119:	83 fa 06             	cmp    $0x6,%edx
+  80111c:	74 0e                	je     80112c <sys_getenvid+0x6e>
+  80111e:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801121:	0f b6 c9             	movzbl %cl,%ecx
+  801124:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80112a:	eb a1                	jmp    8010cd <sys_getenvid+0xf>
+  80112c:	89 c2                	mov    %eax,%edx
+  80112e:	c1 ea 04             	shr    $0x4,%edx
+  801131:	83 e2 0f             	and    $0xf,%edx
+  801134:	83 fa 02             	cmp    $0x2,%edx
+  801137:	77 e5                	ja     80111e <sys_getenvid+0x60>
+		 && (eax & 0xf) < 3);
+  801139:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80113c:	83 f8 02             	cmp    $0x2,%eax
+  80113f:	0f 97 c1             	seta   %cl
+  801142:	0f b6 c9             	movzbl %cl,%ecx
+  801145:	eb d7                	jmp    80111e <sys_getenvid+0x60>
+		asm volatile("int %1\n"
+  801147:	ba 00 00 00 00       	mov    $0x0,%edx
+  80114c:	b8 02 00 00 00       	mov    $0x2,%eax
+  801151:	89 d1                	mov    %edx,%ecx
+  801153:	89 d3                	mov    %edx,%ebx
+  801155:	89 d7                	mov    %edx,%edi
+  801157:	89 d6                	mov    %edx,%esi
+  801159:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80115b:	eb 99                	jmp    8010f6 <sys_getenvid+0x38>
+
+0080115d <sys_page_alloc>:
+{
+  80115d:	55                   	push   %ebp
+  80115e:	89 e5                	mov    %esp,%ebp
+  801160:	57                   	push   %edi
+  801161:	56                   	push   %esi
+  801162:	53                   	push   %ebx
+  801163:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801166:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80116d:	78 38                	js     8011a7 <sys_page_alloc+0x4a>
+	if (syscall_sysenter)
+  80116f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801176:	74 7b                	je     8011f3 <sys_page_alloc+0x96>
+	asm volatile("pushl %%ebp\n"
+  801178:	be 00 00 00 00       	mov    $0x0,%esi
+  80117d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801180:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801183:	b8 04 00 00 00       	mov    $0x4,%eax
+  801188:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80118b:	89 f7                	mov    %esi,%edi
+  80118d:	55                   	push   %ebp
+  80118e:	68 97 11 80 00       	push   $0x801197
+  801193:	89 e5                	mov    %esp,%ebp
+  801195:	0f 34                	sysenter
+  801197:	83 c4 04             	add    $0x4,%esp
+  80119a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80119b:	85 c0                	test   %eax,%eax
+  80119d:	7f 6d                	jg     80120c <sys_page_alloc+0xaf>
+}
+  80119f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a2:	5b                   	pop    %ebx
+  8011a3:	5e                   	pop    %esi
+  8011a4:	5f                   	pop    %edi
+  8011a5:	5d                   	pop    %ebp
+  8011a6:	c3                   	ret
+  8011a7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011ac:	0f a2                	cpuid
+		return 0;
+  8011ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8011b3:	f6 c6 08             	test   $0x8,%dh
+  8011b6:	74 15                	je     8011cd <sys_page_alloc+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011b8:	89 c2                	mov    %eax,%edx
+  8011ba:	c1 ea 08             	shr    $0x8,%edx
+  8011bd:	83 e2 0f             	and    $0xf,%edx
+  8011c0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011c5:	83 fa 06             	cmp    $0x6,%edx
+  8011c8:	74 0e                	je     8011d8 <sys_page_alloc+0x7b>
+  8011ca:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8011cd:	0f b6 c9             	movzbl %cl,%ecx
+  8011d0:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8011d6:	eb 97                	jmp    80116f <sys_page_alloc+0x12>
+  8011d8:	89 c2                	mov    %eax,%edx
+  8011da:	c1 ea 04             	shr    $0x4,%edx
+  8011dd:	83 e2 0f             	and    $0xf,%edx
+  8011e0:	83 fa 02             	cmp    $0x2,%edx
+  8011e3:	77 e5                	ja     8011ca <sys_page_alloc+0x6d>
+		 && (eax & 0xf) < 3);
+  8011e5:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8011e8:	83 f8 02             	cmp    $0x2,%eax
+  8011eb:	0f 97 c1             	seta   %cl
+  8011ee:	0f b6 c9             	movzbl %cl,%ecx
+  8011f1:	eb d7                	jmp    8011ca <sys_page_alloc+0x6d>
+		asm volatile("int %1\n"
+  8011f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f8:	b8 04 00 00 00       	mov    $0x4,%eax
+  8011fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801200:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801203:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801206:	89 f7                	mov    %esi,%edi
+  801208:	cd 30                	int    $0x30
+  80120a:	eb 8f                	jmp    80119b <sys_page_alloc+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80120c:	83 ec 0c             	sub    $0xc,%esp
+  80120f:	50                   	push   %eax
+  801210:	6a 04                	push   $0x4
+  801212:	68 f9 2d 80 00       	push   $0x802df9
+  801217:	6a 4a                	push   $0x4a
+  801219:	68 16 2e 80 00       	push   $0x802e16
+  80121e:	e8 03 f0 ff ff       	call   800226 <_panic>
+
+00801223 <sys_page_map>:
+{
+  801223:	55                   	push   %ebp
+  801224:	89 e5                	mov    %esp,%ebp
+  801226:	57                   	push   %edi
+  801227:	56                   	push   %esi
+  801228:	53                   	push   %ebx
+  801229:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80122c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801233:	78 37                	js     80126c <sys_page_map+0x49>
+	if (syscall_sysenter)
+  801235:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80123c:	74 7a                	je     8012b8 <sys_page_map+0x95>
+	asm volatile("pushl %%ebp\n"
+  80123e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801241:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801244:	b8 05 00 00 00       	mov    $0x5,%eax
+  801249:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80124c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80124f:	8b 75 18             	mov    0x18(%ebp),%esi
+  801252:	55                   	push   %ebp
+  801253:	68 5c 12 80 00       	push   $0x80125c
+  801258:	89 e5                	mov    %esp,%ebp
+  80125a:	0f 34                	sysenter
+  80125c:	83 c4 04             	add    $0x4,%esp
+  80125f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801260:	85 c0                	test   %eax,%eax
+  801262:	7f 6c                	jg     8012d0 <sys_page_map+0xad>
+}
+  801264:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801267:	5b                   	pop    %ebx
+  801268:	5e                   	pop    %esi
+  801269:	5f                   	pop    %edi
+  80126a:	5d                   	pop    %ebp
+  80126b:	c3                   	ret
+  80126c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801271:	0f a2                	cpuid
+		return 0;
+  801273:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801278:	f6 c6 08             	test   $0x8,%dh
+  80127b:	74 15                	je     801292 <sys_page_map+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80127d:	89 c2                	mov    %eax,%edx
+  80127f:	c1 ea 08             	shr    $0x8,%edx
+  801282:	83 e2 0f             	and    $0xf,%edx
+  801285:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80128a:	83 fa 06             	cmp    $0x6,%edx
+  80128d:	74 0e                	je     80129d <sys_page_map+0x7a>
+  80128f:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801292:	0f b6 c9             	movzbl %cl,%ecx
+  801295:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80129b:	eb 98                	jmp    801235 <sys_page_map+0x12>
+  80129d:	89 c2                	mov    %eax,%edx
+  80129f:	c1 ea 04             	shr    $0x4,%edx
+  8012a2:	83 e2 0f             	and    $0xf,%edx
+  8012a5:	83 fa 02             	cmp    $0x2,%edx
+  8012a8:	77 e5                	ja     80128f <sys_page_map+0x6c>
+		 && (eax & 0xf) < 3);
+  8012aa:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8012ad:	83 f8 02             	cmp    $0x2,%eax
+  8012b0:	0f 97 c1             	seta   %cl
+  8012b3:	0f b6 c9             	movzbl %cl,%ecx
+  8012b6:	eb d7                	jmp    80128f <sys_page_map+0x6c>
+		asm volatile("int %1\n"
+  8012b8:	b8 05 00 00 00       	mov    $0x5,%eax
+  8012bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012c3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012c6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012c9:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012cc:	cd 30                	int    $0x30
+  8012ce:	eb 90                	jmp    801260 <sys_page_map+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012d0:	83 ec 0c             	sub    $0xc,%esp
+  8012d3:	50                   	push   %eax
+  8012d4:	6a 05                	push   $0x5
+  8012d6:	68 f9 2d 80 00       	push   $0x802df9
+  8012db:	6a 4a                	push   $0x4a
+  8012dd:	68 16 2e 80 00       	push   $0x802e16
+  8012e2:	e8 3f ef ff ff       	call   800226 <_panic>
+
+008012e7 <sys_page_unmap>:
+{
+  8012e7:	55                   	push   %ebp
+  8012e8:	89 e5                	mov    %esp,%ebp
+  8012ea:	57                   	push   %edi
+  8012eb:	56                   	push   %esi
+  8012ec:	53                   	push   %ebx
+  8012ed:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8012f0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8012f7:	78 37                	js     801330 <sys_page_unmap+0x49>
+	if (syscall_sysenter)
+  8012f9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801300:	74 7a                	je     80137c <sys_page_unmap+0x95>
+	asm volatile("pushl %%ebp\n"
+  801302:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801307:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80130d:	b8 06 00 00 00       	mov    $0x6,%eax
+  801312:	89 df                	mov    %ebx,%edi
+  801314:	89 de                	mov    %ebx,%esi
+  801316:	55                   	push   %ebp
+  801317:	68 20 13 80 00       	push   $0x801320
+  80131c:	89 e5                	mov    %esp,%ebp
+  80131e:	0f 34                	sysenter
+  801320:	83 c4 04             	add    $0x4,%esp
+  801323:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801324:	85 c0                	test   %eax,%eax
+  801326:	7f 6c                	jg     801394 <sys_page_unmap+0xad>
+}
+  801328:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80132b:	5b                   	pop    %ebx
+  80132c:	5e                   	pop    %esi
+  80132d:	5f                   	pop    %edi
+  80132e:	5d                   	pop    %ebp
+  80132f:	c3                   	ret
+  801330:	b8 01 00 00 00       	mov    $0x1,%eax
+  801335:	0f a2                	cpuid
+		return 0;
+  801337:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80133c:	f6 c6 08             	test   $0x8,%dh
+  80133f:	74 15                	je     801356 <sys_page_unmap+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801341:	89 c2                	mov    %eax,%edx
+  801343:	c1 ea 08             	shr    $0x8,%edx
+  801346:	83 e2 0f             	and    $0xf,%edx
+  801349:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80134e:	83 fa 06             	cmp    $0x6,%edx
+  801351:	74 0e                	je     801361 <sys_page_unmap+0x7a>
+  801353:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801356:	0f b6 c9             	movzbl %cl,%ecx
+  801359:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80135f:	eb 98                	jmp    8012f9 <sys_page_unmap+0x12>
+  801361:	89 c2                	mov    %eax,%edx
+  801363:	c1 ea 04             	shr    $0x4,%edx
+  801366:	83 e2 0f             	and    $0xf,%edx
+  801369:	83 fa 02             	cmp    $0x2,%edx
+  80136c:	77 e5                	ja     801353 <sys_page_unmap+0x6c>
+		 && (eax & 0xf) < 3);
+  80136e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801371:	83 f8 02             	cmp    $0x2,%eax
+  801374:	0f 97 c1             	seta   %cl
+  801377:	0f b6 c9             	movzbl %cl,%ecx
+  80137a:	eb d7                	jmp    801353 <sys_page_unmap+0x6c>
+		asm volatile("int %1\n"
+  80137c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801381:	b8 06 00 00 00       	mov    $0x6,%eax
+  801386:	8b 55 08             	mov    0x8(%ebp),%edx
+  801389:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80138c:	89 df                	mov    %ebx,%edi
+  80138e:	89 de                	mov    %ebx,%esi
+  801390:	cd 30                	int    $0x30
+  801392:	eb 90                	jmp    801324 <sys_page_unmap+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801394:	83 ec 0c             	sub    $0xc,%esp
+  801397:	50                   	push   %eax
+  801398:	6a 06                	push   $0x6
+  80139a:	68 f9 2d 80 00       	push   $0x802df9
+  80139f:	6a 4a                	push   $0x4a
+  8013a1:	68 16 2e 80 00       	push   $0x802e16
+  8013a6:	e8 7b ee ff ff       	call   800226 <_panic>
+
+008013ab <sys_page_copy>:
+{
+  8013ab:	55                   	push   %ebp
+  8013ac:	89 e5                	mov    %esp,%ebp
+  8013ae:	57                   	push   %edi
+  8013af:	56                   	push   %esi
+  8013b0:	53                   	push   %ebx
+  8013b1:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8013b4:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8013bb:	78 37                	js     8013f4 <sys_page_copy+0x49>
+	if (syscall_sysenter)
+  8013bd:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8013c4:	74 7a                	je     801440 <sys_page_copy+0x95>
+	asm volatile("pushl %%ebp\n"
+  8013c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013cc:	b8 29 00 00 00       	mov    $0x29,%eax
+  8013d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013d4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013d7:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013da:	55                   	push   %ebp
+  8013db:	68 e4 13 80 00       	push   $0x8013e4
+  8013e0:	89 e5                	mov    %esp,%ebp
+  8013e2:	0f 34                	sysenter
+  8013e4:	83 c4 04             	add    $0x4,%esp
+  8013e7:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8013e8:	85 c0                	test   %eax,%eax
+  8013ea:	7f 6c                	jg     801458 <sys_page_copy+0xad>
+}
+  8013ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013ef:	5b                   	pop    %ebx
+  8013f0:	5e                   	pop    %esi
+  8013f1:	5f                   	pop    %edi
+  8013f2:	5d                   	pop    %ebp
+  8013f3:	c3                   	ret
+  8013f4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013f9:	0f a2                	cpuid
+		return 0;
+  8013fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801400:	f6 c6 08             	test   $0x8,%dh
+  801403:	74 15                	je     80141a <sys_page_copy+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801405:	89 c2                	mov    %eax,%edx
+  801407:	c1 ea 08             	shr    $0x8,%edx
+  80140a:	83 e2 0f             	and    $0xf,%edx
+  80140d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801412:	83 fa 06             	cmp    $0x6,%edx
+  801415:	74 0e                	je     801425 <sys_page_copy+0x7a>
+  801417:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80141a:	0f b6 c9             	movzbl %cl,%ecx
+  80141d:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801423:	eb 98                	jmp    8013bd <sys_page_copy+0x12>
+  801425:	89 c2                	mov    %eax,%edx
+  801427:	c1 ea 04             	shr    $0x4,%edx
+  80142a:	83 e2 0f             	and    $0xf,%edx
+  80142d:	83 fa 02             	cmp    $0x2,%edx
+  801430:	77 e5                	ja     801417 <sys_page_copy+0x6c>
+		 && (eax & 0xf) < 3);
+  801432:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801435:	83 f8 02             	cmp    $0x2,%eax
+  801438:	0f 97 c1             	seta   %cl
+  80143b:	0f b6 c9             	movzbl %cl,%ecx
+  80143e:	eb d7                	jmp    801417 <sys_page_copy+0x6c>
+		asm volatile("int %1\n"
+  801440:	b8 29 00 00 00       	mov    $0x29,%eax
+  801445:	8b 55 08             	mov    0x8(%ebp),%edx
+  801448:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80144b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80144e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801451:	8b 75 18             	mov    0x18(%ebp),%esi
+  801454:	cd 30                	int    $0x30
+  801456:	eb 90                	jmp    8013e8 <sys_page_copy+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801458:	83 ec 0c             	sub    $0xc,%esp
+  80145b:	50                   	push   %eax
+  80145c:	6a 29                	push   $0x29
+  80145e:	68 f9 2d 80 00       	push   $0x802df9
+  801463:	6a 4a                	push   $0x4a
+  801465:	68 16 2e 80 00       	push   $0x802e16
+  80146a:	e8 b7 ed ff ff       	call   800226 <_panic>
+
+0080146f <sys_yield>:
+{
+  80146f:	55                   	push   %ebp
+  801470:	89 e5                	mov    %esp,%ebp
+  801472:	57                   	push   %edi
+  801473:	56                   	push   %esi
+  801474:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801475:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80147c:	78 2e                	js     8014ac <sys_yield+0x3d>
+	if (syscall_sysenter)
+  80147e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801485:	74 71                	je     8014f8 <sys_yield+0x89>
+	asm volatile("pushl %%ebp\n"
+  801487:	ba 00 00 00 00       	mov    $0x0,%edx
+  80148c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801491:	89 d1                	mov    %edx,%ecx
+  801493:	89 d3                	mov    %edx,%ebx
+  801495:	89 d7                	mov    %edx,%edi
+  801497:	89 d6                	mov    %edx,%esi
+  801499:	55                   	push   %ebp
+  80149a:	68 a3 14 80 00       	push   $0x8014a3
+  80149f:	89 e5                	mov    %esp,%ebp
+  8014a1:	0f 34                	sysenter
+  8014a3:	83 c4 04             	add    $0x4,%esp
+  8014a6:	5d                   	pop    %ebp
+}
+  8014a7:	5b                   	pop    %ebx
+  8014a8:	5e                   	pop    %esi
+  8014a9:	5f                   	pop    %edi
+  8014aa:	5d                   	pop    %ebp
+  8014ab:	c3                   	ret
+  8014ac:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014b1:	0f a2                	cpuid
+		return 0;
+  8014b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8014b8:	f6 c6 08             	test   $0x8,%dh
+  8014bb:	74 15                	je     8014d2 <sys_yield+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014bd:	89 c2                	mov    %eax,%edx
+  8014bf:	c1 ea 08             	shr    $0x8,%edx
+  8014c2:	83 e2 0f             	and    $0xf,%edx
+  8014c5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8014ca:	83 fa 06             	cmp    $0x6,%edx
+  8014cd:	74 0e                	je     8014dd <sys_yield+0x6e>
+  8014cf:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8014d2:	0f b6 c9             	movzbl %cl,%ecx
+  8014d5:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8014db:	eb a1                	jmp    80147e <sys_yield+0xf>
+  8014dd:	89 c2                	mov    %eax,%edx
+  8014df:	c1 ea 04             	shr    $0x4,%edx
+  8014e2:	83 e2 0f             	and    $0xf,%edx
+  8014e5:	83 fa 02             	cmp    $0x2,%edx
+  8014e8:	77 e5                	ja     8014cf <sys_yield+0x60>
+		 && (eax & 0xf) < 3);
+  8014ea:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8014ed:	83 f8 02             	cmp    $0x2,%eax
+  8014f0:	0f 97 c1             	seta   %cl
+  8014f3:	0f b6 c9             	movzbl %cl,%ecx
+  8014f6:	eb d7                	jmp    8014cf <sys_yield+0x60>
+		asm volatile("int %1\n"
+  8014f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014fd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801502:	89 d1                	mov    %edx,%ecx
+  801504:	89 d3                	mov    %edx,%ebx
+  801506:	89 d7                	mov    %edx,%edi
+  801508:	89 d6                	mov    %edx,%esi
+  80150a:	cd 30                	int    $0x30
+}
+  80150c:	eb 99                	jmp    8014a7 <sys_yield+0x38>
+
+0080150e <sys_env_set_status>:
+{
+  80150e:	55                   	push   %ebp
+  80150f:	89 e5                	mov    %esp,%ebp
+  801511:	57                   	push   %edi
+  801512:	56                   	push   %esi
+  801513:	53                   	push   %ebx
+  801514:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801517:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80151e:	78 37                	js     801557 <sys_env_set_status+0x49>
+	if (syscall_sysenter)
+  801520:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801527:	74 7a                	je     8015a3 <sys_env_set_status+0x95>
+	asm volatile("pushl %%ebp\n"
+  801529:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80152e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801531:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801534:	b8 08 00 00 00       	mov    $0x8,%eax
+  801539:	89 df                	mov    %ebx,%edi
+  80153b:	89 de                	mov    %ebx,%esi
+  80153d:	55                   	push   %ebp
+  80153e:	68 47 15 80 00       	push   $0x801547
+  801543:	89 e5                	mov    %esp,%ebp
+  801545:	0f 34                	sysenter
+  801547:	83 c4 04             	add    $0x4,%esp
+  80154a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80154b:	85 c0                	test   %eax,%eax
+  80154d:	7f 6c                	jg     8015bb <sys_env_set_status+0xad>
+}
+  80154f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801552:	5b                   	pop    %ebx
+  801553:	5e                   	pop    %esi
+  801554:	5f                   	pop    %edi
+  801555:	5d                   	pop    %ebp
+  801556:	c3                   	ret
+  801557:	b8 01 00 00 00       	mov    $0x1,%eax
+  80155c:	0f a2                	cpuid
+		return 0;
+  80155e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801563:	f6 c6 08             	test   $0x8,%dh
+  801566:	74 15                	je     80157d <sys_env_set_status+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801568:	89 c2                	mov    %eax,%edx
+  80156a:	c1 ea 08             	shr    $0x8,%edx
+  80156d:	83 e2 0f             	and    $0xf,%edx
+  801570:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801575:	83 fa 06             	cmp    $0x6,%edx
+  801578:	74 0e                	je     801588 <sys_env_set_status+0x7a>
+  80157a:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80157d:	0f b6 c9             	movzbl %cl,%ecx
+  801580:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801586:	eb 98                	jmp    801520 <sys_env_set_status+0x12>
+  801588:	89 c2                	mov    %eax,%edx
+  80158a:	c1 ea 04             	shr    $0x4,%edx
+  80158d:	83 e2 0f             	and    $0xf,%edx
+  801590:	83 fa 02             	cmp    $0x2,%edx
+  801593:	77 e5                	ja     80157a <sys_env_set_status+0x6c>
+		 && (eax & 0xf) < 3);
+  801595:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801598:	83 f8 02             	cmp    $0x2,%eax
+  80159b:	0f 97 c1             	seta   %cl
+  80159e:	0f b6 c9             	movzbl %cl,%ecx
+  8015a1:	eb d7                	jmp    80157a <sys_env_set_status+0x6c>
+		asm volatile("int %1\n"
+  8015a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015a8:	b8 08 00 00 00       	mov    $0x8,%eax
+  8015ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b3:	89 df                	mov    %ebx,%edi
+  8015b5:	89 de                	mov    %ebx,%esi
+  8015b7:	cd 30                	int    $0x30
+  8015b9:	eb 90                	jmp    80154b <sys_env_set_status+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015bb:	83 ec 0c             	sub    $0xc,%esp
+  8015be:	50                   	push   %eax
+  8015bf:	6a 08                	push   $0x8
+  8015c1:	68 f9 2d 80 00       	push   $0x802df9
+  8015c6:	6a 4a                	push   $0x4a
+  8015c8:	68 16 2e 80 00       	push   $0x802e16
+  8015cd:	e8 54 ec ff ff       	call   800226 <_panic>
+
+008015d2 <sys_sysinfo>:
+{
+  8015d2:	55                   	push   %ebp
+  8015d3:	89 e5                	mov    %esp,%ebp
+  8015d5:	57                   	push   %edi
+  8015d6:	56                   	push   %esi
+  8015d7:	53                   	push   %ebx
+  8015d8:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8015db:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8015e2:	78 36                	js     80161a <sys_sysinfo+0x48>
+	if (syscall_sysenter)
+  8015e4:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8015eb:	74 79                	je     801666 <sys_sysinfo+0x94>
+	asm volatile("pushl %%ebp\n"
+  8015ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015f5:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8015fa:	89 cb                	mov    %ecx,%ebx
+  8015fc:	89 cf                	mov    %ecx,%edi
+  8015fe:	89 ce                	mov    %ecx,%esi
+  801600:	55                   	push   %ebp
+  801601:	68 0a 16 80 00       	push   $0x80160a
+  801606:	89 e5                	mov    %esp,%ebp
+  801608:	0f 34                	sysenter
+  80160a:	83 c4 04             	add    $0x4,%esp
+  80160d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80160e:	85 c0                	test   %eax,%eax
+  801610:	7f 6b                	jg     80167d <sys_sysinfo+0xab>
+}
+  801612:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801615:	5b                   	pop    %ebx
+  801616:	5e                   	pop    %esi
+  801617:	5f                   	pop    %edi
+  801618:	5d                   	pop    %ebp
+  801619:	c3                   	ret
+  80161a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80161f:	0f a2                	cpuid
+		return 0;
+  801621:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801626:	f6 c6 08             	test   $0x8,%dh
+  801629:	74 15                	je     801640 <sys_sysinfo+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80162b:	89 c2                	mov    %eax,%edx
+  80162d:	c1 ea 08             	shr    $0x8,%edx
+  801630:	83 e2 0f             	and    $0xf,%edx
+  801633:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801638:	83 fa 06             	cmp    $0x6,%edx
+  80163b:	74 0e                	je     80164b <sys_sysinfo+0x79>
+  80163d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801640:	0f b6 c9             	movzbl %cl,%ecx
+  801643:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801649:	eb 99                	jmp    8015e4 <sys_sysinfo+0x12>
+  80164b:	89 c2                	mov    %eax,%edx
+  80164d:	c1 ea 04             	shr    $0x4,%edx
+  801650:	83 e2 0f             	and    $0xf,%edx
+  801653:	83 fa 02             	cmp    $0x2,%edx
+  801656:	77 e5                	ja     80163d <sys_sysinfo+0x6b>
+		 && (eax & 0xf) < 3);
+  801658:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80165b:	83 f8 02             	cmp    $0x2,%eax
+  80165e:	0f 97 c1             	seta   %cl
+  801661:	0f b6 c9             	movzbl %cl,%ecx
+  801664:	eb d7                	jmp    80163d <sys_sysinfo+0x6b>
+		asm volatile("int %1\n"
+  801666:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80166b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801670:	8b 55 08             	mov    0x8(%ebp),%edx
+  801673:	89 cb                	mov    %ecx,%ebx
+  801675:	89 cf                	mov    %ecx,%edi
+  801677:	89 ce                	mov    %ecx,%esi
+  801679:	cd 30                	int    $0x30
+  80167b:	eb 91                	jmp    80160e <sys_sysinfo+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80167d:	83 ec 0c             	sub    $0xc,%esp
+  801680:	50                   	push   %eax
+  801681:	6a 0b                	push   $0xb
+  801683:	68 f9 2d 80 00       	push   $0x802df9
+  801688:	6a 4a                	push   $0x4a
+  80168a:	68 16 2e 80 00       	push   $0x802e16
+  80168f:	e8 92 eb ff ff       	call   800226 <_panic>
+
+00801694 <sys_env_set_trapframe>:
+{
+  801694:	55                   	push   %ebp
+  801695:	89 e5                	mov    %esp,%ebp
+  801697:	57                   	push   %edi
+  801698:	56                   	push   %esi
+  801699:	53                   	push   %ebx
+  80169a:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80169d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8016a4:	78 37                	js     8016dd <sys_env_set_trapframe+0x49>
+	if (syscall_sysenter)
+  8016a6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8016ad:	74 7a                	je     801729 <sys_env_set_trapframe+0x95>
+	asm volatile("pushl %%ebp\n"
+  8016af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016ba:	b8 13 00 00 00       	mov    $0x13,%eax
+  8016bf:	89 df                	mov    %ebx,%edi
+  8016c1:	89 de                	mov    %ebx,%esi
+  8016c3:	55                   	push   %ebp
+  8016c4:	68 cd 16 80 00       	push   $0x8016cd
+  8016c9:	89 e5                	mov    %esp,%ebp
+  8016cb:	0f 34                	sysenter
+  8016cd:	83 c4 04             	add    $0x4,%esp
+  8016d0:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8016d1:	85 c0                	test   %eax,%eax
+  8016d3:	7f 6c                	jg     801741 <sys_env_set_trapframe+0xad>
+}
+  8016d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016d8:	5b                   	pop    %ebx
+  8016d9:	5e                   	pop    %esi
+  8016da:	5f                   	pop    %edi
+  8016db:	5d                   	pop    %ebp
+  8016dc:	c3                   	ret
+  8016dd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016e2:	0f a2                	cpuid
+		return 0;
+  8016e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8016e9:	f6 c6 08             	test   $0x8,%dh
+  8016ec:	74 15                	je     801703 <sys_env_set_trapframe+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8016ee:	89 c2                	mov    %eax,%edx
+  8016f0:	c1 ea 08             	shr    $0x8,%edx
+  8016f3:	83 e2 0f             	and    $0xf,%edx
+  8016f6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8016fb:	83 fa 06             	cmp    $0x6,%edx
+  8016fe:	74 0e                	je     80170e <sys_env_set_trapframe+0x7a>
+  801700:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801703:	0f b6 c9             	movzbl %cl,%ecx
+  801706:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80170c:	eb 98                	jmp    8016a6 <sys_env_set_trapframe+0x12>
+  80170e:	89 c2                	mov    %eax,%edx
+  801710:	c1 ea 04             	shr    $0x4,%edx
+  801713:	83 e2 0f             	and    $0xf,%edx
+  801716:	83 fa 02             	cmp    $0x2,%edx
+  801719:	77 e5                	ja     801700 <sys_env_set_trapframe+0x6c>
+		 && (eax & 0xf) < 3);
+  80171b:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80171e:	83 f8 02             	cmp    $0x2,%eax
+  801721:	0f 97 c1             	seta   %cl
+  801724:	0f b6 c9             	movzbl %cl,%ecx
+  801727:	eb d7                	jmp    801700 <sys_env_set_trapframe+0x6c>
+		asm volatile("int %1\n"
+  801729:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80172e:	b8 13 00 00 00       	mov    $0x13,%eax
+  801733:	8b 55 08             	mov    0x8(%ebp),%edx
+  801736:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801739:	89 df                	mov    %ebx,%edi
+  80173b:	89 de                	mov    %ebx,%esi
+  80173d:	cd 30                	int    $0x30
+  80173f:	eb 90                	jmp    8016d1 <sys_env_set_trapframe+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801741:	83 ec 0c             	sub    $0xc,%esp
+  801744:	50                   	push   %eax
+  801745:	6a 13                	push   $0x13
+  801747:	68 f9 2d 80 00       	push   $0x802df9
+  80174c:	6a 4a                	push   $0x4a
+  80174e:	68 16 2e 80 00       	push   $0x802e16
+  801753:	e8 ce ea ff ff       	call   800226 <_panic>
+
+00801758 <sys_env_set_stack_limit>:
+{
+  801758:	55                   	push   %ebp
+  801759:	89 e5                	mov    %esp,%ebp
+  80175b:	57                   	push   %edi
+  80175c:	56                   	push   %esi
+  80175d:	53                   	push   %ebx
+  80175e:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801761:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801768:	78 37                	js     8017a1 <sys_env_set_stack_limit+0x49>
+	if (syscall_sysenter)
+  80176a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801771:	74 7a                	je     8017ed <sys_env_set_stack_limit+0x95>
+	asm volatile("pushl %%ebp\n"
+  801773:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801778:	8b 55 08             	mov    0x8(%ebp),%edx
+  80177b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80177e:	b8 19 00 00 00       	mov    $0x19,%eax
+  801783:	89 df                	mov    %ebx,%edi
+  801785:	89 de                	mov    %ebx,%esi
+  801787:	55                   	push   %ebp
+  801788:	68 91 17 80 00       	push   $0x801791
+  80178d:	89 e5                	mov    %esp,%ebp
+  80178f:	0f 34                	sysenter
+  801791:	83 c4 04             	add    $0x4,%esp
+  801794:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801795:	85 c0                	test   %eax,%eax
+  801797:	7f 6c                	jg     801805 <sys_env_set_stack_limit+0xad>
+}
+  801799:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80179c:	5b                   	pop    %ebx
+  80179d:	5e                   	pop    %esi
+  80179e:	5f                   	pop    %edi
+  80179f:	5d                   	pop    %ebp
+  8017a0:	c3                   	ret
+  8017a1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8017a6:	0f a2                	cpuid
+		return 0;
+  8017a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8017ad:	f6 c6 08             	test   $0x8,%dh
+  8017b0:	74 15                	je     8017c7 <sys_env_set_stack_limit+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017b2:	89 c2                	mov    %eax,%edx
+  8017b4:	c1 ea 08             	shr    $0x8,%edx
+  8017b7:	83 e2 0f             	and    $0xf,%edx
+  8017ba:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017bf:	83 fa 06             	cmp    $0x6,%edx
+  8017c2:	74 0e                	je     8017d2 <sys_env_set_stack_limit+0x7a>
+  8017c4:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8017c7:	0f b6 c9             	movzbl %cl,%ecx
+  8017ca:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8017d0:	eb 98                	jmp    80176a <sys_env_set_stack_limit+0x12>
+  8017d2:	89 c2                	mov    %eax,%edx
+  8017d4:	c1 ea 04             	shr    $0x4,%edx
+  8017d7:	83 e2 0f             	and    $0xf,%edx
+  8017da:	83 fa 02             	cmp    $0x2,%edx
+  8017dd:	77 e5                	ja     8017c4 <sys_env_set_stack_limit+0x6c>
+		 && (eax & 0xf) < 3);
+  8017df:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8017e2:	83 f8 02             	cmp    $0x2,%eax
+  8017e5:	0f 97 c1             	seta   %cl
+  8017e8:	0f b6 c9             	movzbl %cl,%ecx
+  8017eb:	eb d7                	jmp    8017c4 <sys_env_set_stack_limit+0x6c>
+		asm volatile("int %1\n"
+  8017ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017f2:	b8 19 00 00 00       	mov    $0x19,%eax
+  8017f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017fd:	89 df                	mov    %ebx,%edi
+  8017ff:	89 de                	mov    %ebx,%esi
+  801801:	cd 30                	int    $0x30
+  801803:	eb 90                	jmp    801795 <sys_env_set_stack_limit+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801805:	83 ec 0c             	sub    $0xc,%esp
+  801808:	50                   	push   %eax
+  801809:	6a 19                	push   $0x19
+  80180b:	68 f9 2d 80 00       	push   $0x802df9
+  801810:	6a 4a                	push   $0x4a
+  801812:	68 16 2e 80 00       	push   $0x802e16
+  801817:	e8 0a ea ff ff       	call   800226 <_panic>
+
+0080181c <sys_env_set_pgfault_upcall>:
+{
+  80181c:	55                   	push   %ebp
+  80181d:	89 e5                	mov    %esp,%ebp
+  80181f:	57                   	push   %edi
+  801820:	56                   	push   %esi
+  801821:	53                   	push   %ebx
+  801822:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801825:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80182c:	78 37                	js     801865 <sys_env_set_pgfault_upcall+0x49>
+	if (syscall_sysenter)
+  80182e:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801835:	74 7a                	je     8018b1 <sys_env_set_pgfault_upcall+0x95>
+	asm volatile("pushl %%ebp\n"
+  801837:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80183c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80183f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801842:	b8 09 00 00 00       	mov    $0x9,%eax
+  801847:	89 df                	mov    %ebx,%edi
+  801849:	89 de                	mov    %ebx,%esi
+  80184b:	55                   	push   %ebp
+  80184c:	68 55 18 80 00       	push   $0x801855
+  801851:	89 e5                	mov    %esp,%ebp
+  801853:	0f 34                	sysenter
+  801855:	83 c4 04             	add    $0x4,%esp
+  801858:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801859:	85 c0                	test   %eax,%eax
+  80185b:	7f 6c                	jg     8018c9 <sys_env_set_pgfault_upcall+0xad>
+}
+  80185d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801860:	5b                   	pop    %ebx
+  801861:	5e                   	pop    %esi
+  801862:	5f                   	pop    %edi
+  801863:	5d                   	pop    %ebp
+  801864:	c3                   	ret
+  801865:	b8 01 00 00 00       	mov    $0x1,%eax
+  80186a:	0f a2                	cpuid
+		return 0;
+  80186c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801871:	f6 c6 08             	test   $0x8,%dh
+  801874:	74 15                	je     80188b <sys_env_set_pgfault_upcall+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801876:	89 c2                	mov    %eax,%edx
+  801878:	c1 ea 08             	shr    $0x8,%edx
+  80187b:	83 e2 0f             	and    $0xf,%edx
+  80187e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801883:	83 fa 06             	cmp    $0x6,%edx
+  801886:	74 0e                	je     801896 <sys_env_set_pgfault_upcall+0x7a>
+  801888:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80188b:	0f b6 c9             	movzbl %cl,%ecx
+  80188e:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801894:	eb 98                	jmp    80182e <sys_env_set_pgfault_upcall+0x12>
+  801896:	89 c2                	mov    %eax,%edx
+  801898:	c1 ea 04             	shr    $0x4,%edx
+  80189b:	83 e2 0f             	and    $0xf,%edx
+  80189e:	83 fa 02             	cmp    $0x2,%edx
+  8018a1:	77 e5                	ja     801888 <sys_env_set_pgfault_upcall+0x6c>
+		 && (eax & 0xf) < 3);
+  8018a3:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8018a6:	83 f8 02             	cmp    $0x2,%eax
+  8018a9:	0f 97 c1             	seta   %cl
+  8018ac:	0f b6 c9             	movzbl %cl,%ecx
+  8018af:	eb d7                	jmp    801888 <sys_env_set_pgfault_upcall+0x6c>
+		asm volatile("int %1\n"
+  8018b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018b6:	b8 09 00 00 00       	mov    $0x9,%eax
+  8018bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018c1:	89 df                	mov    %ebx,%edi
+  8018c3:	89 de                	mov    %ebx,%esi
+  8018c5:	cd 30                	int    $0x30
+  8018c7:	eb 90                	jmp    801859 <sys_env_set_pgfault_upcall+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8018c9:	83 ec 0c             	sub    $0xc,%esp
+  8018cc:	50                   	push   %eax
+  8018cd:	6a 09                	push   $0x9
+  8018cf:	68 f9 2d 80 00       	push   $0x802df9
+  8018d4:	6a 4a                	push   $0x4a
+  8018d6:	68 16 2e 80 00       	push   $0x802e16
+  8018db:	e8 46 e9 ff ff       	call   800226 <_panic>
+
+008018e0 <sys_ipc_try_send>:
+{
+  8018e0:	55                   	push   %ebp
+  8018e1:	89 e5                	mov    %esp,%ebp
+  8018e3:	57                   	push   %edi
+  8018e4:	56                   	push   %esi
+  8018e5:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8018e6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8018ed:	78 32                	js     801921 <sys_ipc_try_send+0x41>
+	if (syscall_sysenter)
+  8018ef:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8018f6:	74 75                	je     80196d <sys_ipc_try_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  8018f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018fe:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801903:	be 00 00 00 00       	mov    $0x0,%esi
+  801908:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80190b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80190e:	55                   	push   %ebp
+  80190f:	68 18 19 80 00       	push   $0x801918
+  801914:	89 e5                	mov    %esp,%ebp
+  801916:	0f 34                	sysenter
+  801918:	83 c4 04             	add    $0x4,%esp
+  80191b:	5d                   	pop    %ebp
+}
+  80191c:	5b                   	pop    %ebx
+  80191d:	5e                   	pop    %esi
+  80191e:	5f                   	pop    %edi
+  80191f:	5d                   	pop    %ebp
+  801920:	c3                   	ret
+  801921:	b8 01 00 00 00       	mov    $0x1,%eax
+  801926:	0f a2                	cpuid
+		return 0;
+  801928:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80192d:	f6 c6 08             	test   $0x8,%dh
+  801930:	74 15                	je     801947 <sys_ipc_try_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801932:	89 c2                	mov    %eax,%edx
+  801934:	c1 ea 08             	shr    $0x8,%edx
+  801937:	83 e2 0f             	and    $0xf,%edx
+  80193a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80193f:	83 fa 06             	cmp    $0x6,%edx
+  801942:	74 0e                	je     801952 <sys_ipc_try_send+0x72>
+  801944:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801947:	0f b6 c9             	movzbl %cl,%ecx
+  80194a:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801950:	eb 9d                	jmp    8018ef <sys_ipc_try_send+0xf>
+  801952:	89 c2                	mov    %eax,%edx
+  801954:	c1 ea 04             	shr    $0x4,%edx
+  801957:	83 e2 0f             	and    $0xf,%edx
+  80195a:	83 fa 02             	cmp    $0x2,%edx
+  80195d:	77 e5                	ja     801944 <sys_ipc_try_send+0x64>
+		 && (eax & 0xf) < 3);
+  80195f:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801962:	83 f8 02             	cmp    $0x2,%eax
+  801965:	0f 97 c1             	seta   %cl
+  801968:	0f b6 c9             	movzbl %cl,%ecx
+  80196b:	eb d7                	jmp    801944 <sys_ipc_try_send+0x64>
+		asm volatile("int %1\n"
+  80196d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801972:	be 00 00 00 00       	mov    $0x0,%esi
+  801977:	8b 55 08             	mov    0x8(%ebp),%edx
+  80197a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80197d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801980:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801983:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801985:	eb 95                	jmp    80191c <sys_ipc_try_send+0x3c>
+
+00801987 <sys_ipc_send>:
+{
+  801987:	55                   	push   %ebp
+  801988:	89 e5                	mov    %esp,%ebp
+  80198a:	57                   	push   %edi
+  80198b:	56                   	push   %esi
+  80198c:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  80198d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801994:	78 32                	js     8019c8 <sys_ipc_send+0x41>
+	if (syscall_sysenter)
+  801996:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80199d:	74 75                	je     801a14 <sys_ipc_send+0x8d>
+	asm volatile("pushl %%ebp\n"
+  80199f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019a5:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8019aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8019af:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019b2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8019b5:	55                   	push   %ebp
+  8019b6:	68 bf 19 80 00       	push   $0x8019bf
+  8019bb:	89 e5                	mov    %esp,%ebp
+  8019bd:	0f 34                	sysenter
+  8019bf:	83 c4 04             	add    $0x4,%esp
+  8019c2:	5d                   	pop    %ebp
+}
+  8019c3:	5b                   	pop    %ebx
+  8019c4:	5e                   	pop    %esi
+  8019c5:	5f                   	pop    %edi
+  8019c6:	5d                   	pop    %ebp
+  8019c7:	c3                   	ret
+  8019c8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019cd:	0f a2                	cpuid
+		return 0;
+  8019cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8019d4:	f6 c6 08             	test   $0x8,%dh
+  8019d7:	74 15                	je     8019ee <sys_ipc_send+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8019d9:	89 c2                	mov    %eax,%edx
+  8019db:	c1 ea 08             	shr    $0x8,%edx
+  8019de:	83 e2 0f             	and    $0xf,%edx
+  8019e1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019e6:	83 fa 06             	cmp    $0x6,%edx
+  8019e9:	74 0e                	je     8019f9 <sys_ipc_send+0x72>
+  8019eb:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8019ee:	0f b6 c9             	movzbl %cl,%ecx
+  8019f1:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8019f7:	eb 9d                	jmp    801996 <sys_ipc_send+0xf>
+  8019f9:	89 c2                	mov    %eax,%edx
+  8019fb:	c1 ea 04             	shr    $0x4,%edx
+  8019fe:	83 e2 0f             	and    $0xf,%edx
+  801a01:	83 fa 02             	cmp    $0x2,%edx
+  801a04:	77 e5                	ja     8019eb <sys_ipc_send+0x64>
+		 && (eax & 0xf) < 3);
+  801a06:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a09:	83 f8 02             	cmp    $0x2,%eax
+  801a0c:	0f 97 c1             	seta   %cl
+  801a0f:	0f b6 c9             	movzbl %cl,%ecx
+  801a12:	eb d7                	jmp    8019eb <sys_ipc_send+0x64>
+		asm volatile("int %1\n"
+  801a14:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801a19:	be 00 00 00 00       	mov    $0x0,%esi
+  801a1e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a21:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a24:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a27:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a2a:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+  801a2c:	eb 95                	jmp    8019c3 <sys_ipc_send+0x3c>
+
+00801a2e <sys_ipc_recv>:
+{
+  801a2e:	55                   	push   %ebp
+  801a2f:	89 e5                	mov    %esp,%ebp
+  801a31:	57                   	push   %edi
+  801a32:	56                   	push   %esi
+  801a33:	53                   	push   %ebx
+  801a34:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801a37:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801a3e:	78 36                	js     801a76 <sys_ipc_recv+0x48>
+	if (syscall_sysenter)
+  801a40:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801a47:	74 79                	je     801ac2 <sys_ipc_recv+0x94>
+	asm volatile("pushl %%ebp\n"
+  801a49:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a4c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a51:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801a56:	89 cb                	mov    %ecx,%ebx
+  801a58:	89 cf                	mov    %ecx,%edi
+  801a5a:	89 ce                	mov    %ecx,%esi
+  801a5c:	55                   	push   %ebp
+  801a5d:	68 66 1a 80 00       	push   $0x801a66
+  801a62:	89 e5                	mov    %esp,%ebp
+  801a64:	0f 34                	sysenter
+  801a66:	83 c4 04             	add    $0x4,%esp
+  801a69:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801a6a:	85 c0                	test   %eax,%eax
+  801a6c:	7f 6b                	jg     801ad9 <sys_ipc_recv+0xab>
+}
+  801a6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a71:	5b                   	pop    %ebx
+  801a72:	5e                   	pop    %esi
+  801a73:	5f                   	pop    %edi
+  801a74:	5d                   	pop    %ebp
+  801a75:	c3                   	ret
+  801a76:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a7b:	0f a2                	cpuid
+		return 0;
+  801a7d:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801a82:	f6 c6 08             	test   $0x8,%dh
+  801a85:	74 15                	je     801a9c <sys_ipc_recv+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801a87:	89 c2                	mov    %eax,%edx
+  801a89:	c1 ea 08             	shr    $0x8,%edx
+  801a8c:	83 e2 0f             	and    $0xf,%edx
+  801a8f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a94:	83 fa 06             	cmp    $0x6,%edx
+  801a97:	74 0e                	je     801aa7 <sys_ipc_recv+0x79>
+  801a99:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801a9c:	0f b6 c9             	movzbl %cl,%ecx
+  801a9f:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801aa5:	eb 99                	jmp    801a40 <sys_ipc_recv+0x12>
+  801aa7:	89 c2                	mov    %eax,%edx
+  801aa9:	c1 ea 04             	shr    $0x4,%edx
+  801aac:	83 e2 0f             	and    $0xf,%edx
+  801aaf:	83 fa 02             	cmp    $0x2,%edx
+  801ab2:	77 e5                	ja     801a99 <sys_ipc_recv+0x6b>
+		 && (eax & 0xf) < 3);
+  801ab4:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801ab7:	83 f8 02             	cmp    $0x2,%eax
+  801aba:	0f 97 c1             	seta   %cl
+  801abd:	0f b6 c9             	movzbl %cl,%ecx
+  801ac0:	eb d7                	jmp    801a99 <sys_ipc_recv+0x6b>
+		asm volatile("int %1\n"
+  801ac2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ac7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801acc:	8b 55 08             	mov    0x8(%ebp),%edx
+  801acf:	89 cb                	mov    %ecx,%ebx
+  801ad1:	89 cf                	mov    %ecx,%edi
+  801ad3:	89 ce                	mov    %ecx,%esi
+  801ad5:	cd 30                	int    $0x30
+  801ad7:	eb 91                	jmp    801a6a <sys_ipc_recv+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801ad9:	83 ec 0c             	sub    $0xc,%esp
+  801adc:	50                   	push   %eax
+  801add:	6a 0d                	push   $0xd
+  801adf:	68 f9 2d 80 00       	push   $0x802df9
+  801ae4:	6a 4a                	push   $0x4a
+  801ae6:	68 16 2e 80 00       	push   $0x802e16
+  801aeb:	e8 36 e7 ff ff       	call   800226 <_panic>
+
+00801af0 <sys_ipc_send_range>:
+{
+  801af0:	55                   	push   %ebp
+  801af1:	89 e5                	mov    %esp,%ebp
+  801af3:	57                   	push   %edi
+  801af4:	56                   	push   %esi
+  801af5:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801af6:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801afd:	78 30                	js     801b2f <sys_ipc_send_range+0x3f>
+	if (syscall_sysenter)
+  801aff:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801b06:	74 73                	je     801b7b <sys_ipc_send_range+0x8b>
+	asm volatile("pushl %%ebp\n"
+  801b08:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b0b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b0e:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801b13:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b16:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801b19:	8b 75 18             	mov    0x18(%ebp),%esi
+  801b1c:	55                   	push   %ebp
+  801b1d:	68 26 1b 80 00       	push   $0x801b26
+  801b22:	89 e5                	mov    %esp,%ebp
+  801b24:	0f 34                	sysenter
+  801b26:	83 c4 04             	add    $0x4,%esp
+  801b29:	5d                   	pop    %ebp
+}
+  801b2a:	5b                   	pop    %ebx
+  801b2b:	5e                   	pop    %esi
+  801b2c:	5f                   	pop    %edi
+  801b2d:	5d                   	pop    %ebp
+  801b2e:	c3                   	ret
+  801b2f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b34:	0f a2                	cpuid
+		return 0;
+  801b36:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801b3b:	f6 c6 08             	test   $0x8,%dh
+  801b3e:	74 15                	je     801b55 <sys_ipc_send_range+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b40:	89 c2                	mov    %eax,%edx
+  801b42:	c1 ea 08             	shr    $0x8,%edx
+  801b45:	83 e2 0f             	and    $0xf,%edx
+  801b48:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b4d:	83 fa 06             	cmp    $0x6,%edx
+  801b50:	74 0e                	je     801b60 <sys_ipc_send_range+0x70>
+  801b52:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801b55:	0f b6 c9             	movzbl %cl,%ecx
+  801b58:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801b5e:	eb 9f                	jmp    801aff <sys_ipc_send_range+0xf>
+  801b60:	89 c2                	mov    %eax,%edx
+  801b62:	c1 ea 04             	shr    $0x4,%edx
+  801b65:	83 e2 0f             	and    $0xf,%edx
+  801b68:	83 fa 02             	cmp    $0x2,%edx
+  801b6b:	77 e5                	ja     801b52 <sys_ipc_send_range+0x62>
+		 && (eax & 0xf) < 3);
+  801b6d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801b70:	83 f8 02             	cmp    $0x2,%eax
+  801b73:	0f 97 c1             	seta   %cl
+  801b76:	0f b6 c9             	movzbl %cl,%ecx
+  801b79:	eb d7                	jmp    801b52 <sys_ipc_send_range+0x62>
+		asm volatile("int %1\n"
+  801b7b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801b80:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b83:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b86:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b89:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801b8c:	8b 75 18             	mov    0x18(%ebp),%esi
+  801b8f:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send_range, 0, envid, value, (uint32_t) srcva,
+  801b91:	eb 97                	jmp    801b2a <sys_ipc_send_range+0x3a>
+
+00801b93 <sys_ipc_recv_range>:
+{
+  801b93:	55                   	push   %ebp
+  801b94:	89 e5                	mov    %esp,%ebp
+  801b96:	57                   	push   %edi
+  801b97:	56                   	push   %esi
+  801b98:	53                   	push   %ebx
+  801b99:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801b9c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801ba3:	78 37                	js     801bdc <sys_ipc_recv_range+0x49>
+	if (syscall_sysenter)
+  801ba5:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801bac:	74 7a                	je     801c28 <sys_ipc_recv_range+0x95>
+	asm volatile("pushl %%ebp\n"
+  801bae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bb3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bb6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bb9:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801bbe:	89 df                	mov    %ebx,%edi
+  801bc0:	89 de                	mov    %ebx,%esi
+  801bc2:	55                   	push   %ebp
+  801bc3:	68 cc 1b 80 00       	push   $0x801bcc
+  801bc8:	89 e5                	mov    %esp,%ebp
+  801bca:	0f 34                	sysenter
+  801bcc:	83 c4 04             	add    $0x4,%esp
+  801bcf:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801bd0:	85 c0                	test   %eax,%eax
+  801bd2:	7f 6c                	jg     801c40 <sys_ipc_recv_range+0xad>
+}
+  801bd4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bd7:	5b                   	pop    %ebx
+  801bd8:	5e                   	pop    %esi
+  801bd9:	5f                   	pop    %edi
+  801bda:	5d                   	pop    %ebp
+  801bdb:	c3                   	ret
+  801bdc:	b8 01 00 00 00       	mov    $0x1,%eax
+  801be1:	0f a2                	cpuid
+		return 0;
+  801be3:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801be8:	f6 c6 08             	test   $0x8,%dh
+  801beb:	74 15                	je     801c02 <sys_ipc_recv_range+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801bed:	89 c2                	mov    %eax,%edx
+  801bef:	c1 ea 08             	shr    $0x8,%edx
+  801bf2:	83 e2 0f             	and    $0xf,%edx
+  801bf5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801bfa:	83 fa 06             	cmp    $0x6,%edx
+  801bfd:	74 0e                	je     801c0d <sys_ipc_recv_range+0x7a>
+  801bff:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801c02:	0f b6 c9             	movzbl %cl,%ecx
+  801c05:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801c0b:	eb 98                	jmp    801ba5 <sys_ipc_recv_range+0x12>
+  801c0d:	89 c2                	mov    %eax,%edx
+  801c0f:	c1 ea 04             	shr    $0x4,%edx
+  801c12:	83 e2 0f             	and    $0xf,%edx
+  801c15:	83 fa 02             	cmp    $0x2,%edx
+  801c18:	77 e5                	ja     801bff <sys_ipc_recv_range+0x6c>
+		 && (eax & 0xf) < 3);
+  801c1a:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801c1d:	83 f8 02             	cmp    $0x2,%eax
+  801c20:	0f 97 c1             	seta   %cl
+  801c23:	0f b6 c9             	movzbl %cl,%ecx
+  801c26:	eb d7                	jmp    801bff <sys_ipc_recv_range+0x6c>
+		asm volatile("int %1\n"
+  801c28:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c2d:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801c32:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c35:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c38:	89 df                	mov    %ebx,%edi
+  801c3a:	89 de                	mov    %ebx,%esi
+  801c3c:	cd 30                	int    $0x30
+  801c3e:	eb 90                	jmp    801bd0 <sys_ipc_recv_range+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801c40:	83 ec 0c             	sub    $0xc,%esp
+  801c43:	50                   	push   %eax
+  801c44:	6a 1f                	push   $0x1f
+  801c46:	68 f9 2d 80 00       	push   $0x802df9
+  801c4b:	6a 4a                	push   $0x4a
+  801c4d:	68 16 2e 80 00       	push   $0x802e16
+  801c52:	e8 cf e5 ff ff       	call   800226 <_panic>
+
+00801c57 <sys_ipc_call>:
+{
+  801c57:	55                   	push   %ebp
+  801c58:	89 e5                	mov    %esp,%ebp
+  801c5a:	57                   	push   %edi
+  801c5b:	56                   	push   %esi
+  801c5c:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801c5d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c60:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801c65:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801c68:	55                   	push   %ebp
+  801c69:	56                   	push   %esi
+  801c6a:	8b 0e                	mov    (%esi),%ecx
+  801c6c:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801c6f:	8b 7e 08             	mov    0x8(%esi),%edi
+  801c72:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801c75:	8b 76 0c             	mov    0xc(%esi),%esi
+  801c78:	cd 30                	int    $0x30
+  801c7a:	87 34 24             	xchg   %esi,(%esp)
+  801c7d:	89 0e                	mov    %ecx,(%esi)
+  801c7f:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801c82:	89 7e 08             	mov    %edi,0x8(%esi)
+  801c85:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801c88:	8f 46 0c             	pop    0xc(%esi)
+  801c8b:	5d                   	pop    %ebp
+}
+  801c8c:	5b                   	pop    %ebx
+  801c8d:	5e                   	pop    %esi
+  801c8e:	5f                   	pop    %edi
+  801c8f:	5d                   	pop    %ebp
+  801c90:	c3                   	ret
+
+00801c91 <sys_ipc_reply_wait>:
+{
+  801c91:	55                   	push   %ebp
+  801c92:	89 e5                	mov    %esp,%ebp
+  801c94:	57                   	push   %edi
+  801c95:	56                   	push   %esi
+  801c96:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801c97:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c9a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801c9f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801ca2:	55                   	push   %ebp
+  801ca3:	56                   	push   %esi
+  801ca4:	8b 0e                	mov    (%esi),%ecx
+  801ca6:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801ca9:	8b 7e 08             	mov    0x8(%esi),%edi
+  801cac:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801caf:	8b 76 0c             	mov    0xc(%esi),%esi
+  801cb2:	cd 30                	int    $0x30
+  801cb4:	87 34 24             	xchg   %esi,(%esp)
+  801cb7:	89 0e                	mov    %ecx,(%esi)
+  801cb9:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801cbc:	89 7e 08             	mov    %edi,0x8(%esi)
+  801cbf:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801cc2:	8f 46 0c             	pop    0xc(%esi)
+  801cc5:	5d                   	pop    %ebp
+}
+  801cc6:	5b                   	pop    %ebx
+  801cc7:	5e                   	pop    %esi
+  801cc8:	5f                   	pop    %edi
+  801cc9:	5d                   	pop    %ebp
+  801cca:	c3                   	ret
+
+00801ccb <sys_ipc_send_msg>:
+{
+  801ccb:	55                   	push   %ebp
+  801ccc:	89 e5                	mov    %esp,%ebp
+  801cce:	57                   	push   %edi
+  801ccf:	56                   	push   %esi
+  801cd0:	53                   	push   %ebx
+  801cd1:	83 ec 20             	sub    $0x20,%esp
+  801cd4:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  801cd7:	8b 10                	mov    (%eax),%edx
+  801cd9:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801cdc:	8b 50 04             	mov    0x4(%eax),%edx
+  801cdf:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801ce2:	8b 50 08             	mov    0x8(%eax),%edx
+  801ce5:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  801ce8:	8b 50 0c             	mov    0xc(%eax),%edx
+  801ceb:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801cee:	8b 40 10             	mov    0x10(%eax),%eax
+  801cf1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  801cf4:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  801cf7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cfa:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801cff:	55                   	push   %ebp
+  801d00:	56                   	push   %esi
+  801d01:	8b 0e                	mov    (%esi),%ecx
+  801d03:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801d06:	8b 7e 08             	mov    0x8(%esi),%edi
+  801d09:	8b 6e 10             	mov    0x10(%esi),%ebp
+  801d0c:	8b 76 0c             	mov    0xc(%esi),%esi
+  801d0f:	cd 30                	int    $0x30
+  801d11:	87 34 24             	xchg   %esi,(%esp)
+  801d14:	89 0e                	mov    %ecx,(%esi)
+  801d16:	89 5e 04             	mov    %ebx,0x4(%esi)
+  801d19:	89 7e 08             	mov    %edi,0x8(%esi)
+  801d1c:	89 6e 10             	mov    %ebp,0x10(%esi)
+  801d1f:	8f 46 0c             	pop    0xc(%esi)
+  801d22:	5d                   	pop    %ebp
+}
+  801d23:	83 c4 20             	add    $0x20,%esp
+  801d26:	5b                   	pop    %ebx
+  801d27:	5e                   	pop    %esi
+  801d28:	5f                   	pop    %edi
+  801d29:	5d                   	pop    %ebp
+  801d2a:	c3                   	ret
+
+00801d2b <sys_fork>:
+{
+  801d2b:	55                   	push   %ebp
+  801d2c:	89 e5                	mov    %esp,%ebp
+  801d2e:	57                   	push   %edi
+  801d2f:	56                   	push   %esi
+  801d30:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801d31:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801d38:	78 2e                	js     801d68 <sys_fork+0x3d>
+	if (syscall_sysenter)
+  801d3a:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801d41:	74 71                	je     801db4 <sys_fork+0x89>
+	asm volatile("pushl %%ebp\n"
+  801d43:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d48:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801d4d:	89 d1                	mov    %edx,%ecx
+  801d4f:	89 d3                	mov    %edx,%ebx
+  801d51:	89 d7                	mov    %edx,%edi
+  801d53:	89 d6                	mov    %edx,%esi
+  801d55:	55                   	push   %ebp
+  801d56:	68 5f 1d 80 00       	push   $0x801d5f
+  801d5b:	89 e5                	mov    %esp,%ebp
+  801d5d:	0f 34                	sysenter
+  801d5f:	83 c4 04             	add    $0x4,%esp
+  801d62:	5d                   	pop    %ebp
+}
+  801d63:	5b                   	pop    %ebx
+  801d64:	5e                   	pop    %esi
+  801d65:	5f                   	pop    %edi
+  801d66:	5d                   	pop    %ebp
+  801d67:	c3                   	ret
+  801d68:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d6d:	0f a2                	cpuid
+		return 0;
+  801d6f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801d74:	f6 c6 08             	test   $0x8,%dh
+  801d77:	74 15                	je     801d8e <sys_fork+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801d79:	89 c2                	mov    %eax,%edx
+  801d7b:	c1 ea 08             	shr    $0x8,%edx
+  801d7e:	83 e2 0f             	and    $0xf,%edx
+  801d81:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d86:	83 fa 06             	cmp    $0x6,%edx
+  801d89:	74 0e                	je     801d99 <sys_fork+0x6e>
+  801d8b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801d8e:	0f b6 c9             	movzbl %cl,%ecx
+  801d91:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801d97:	eb a1                	jmp    801d3a <sys_fork+0xf>
+  801d99:	89 c2                	mov    %eax,%edx
+  801d9b:	c1 ea 04             	shr    $0x4,%edx
+  801d9e:	83 e2 0f             	and    $0xf,%edx
+  801da1:	83 fa 02             	cmp    $0x2,%edx
+  801da4:	77 e5                	ja     801d8b <sys_fork+0x60>
+		 && (eax & 0xf) < 3);
+  801da6:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801da9:	83 f8 02             	cmp    $0x2,%eax
+  801dac:	0f 97 c1             	seta   %cl
+  801daf:	0f b6 c9             	movzbl %cl,%ecx
+  801db2:	eb d7                	jmp    801d8b <sys_fork+0x60>
+		asm volatile("int %1\n"
+  801db4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801db9:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801dbe:	89 d1                	mov    %edx,%ecx
+  801dc0:	89 d3                	mov    %edx,%ebx
+  801dc2:	89 d7                	mov    %edx,%edi
+  801dc4:	89 d6                	mov    %edx,%esi
+  801dc6:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  801dc8:	eb 99                	jmp    801d63 <sys_fork+0x38>
+
+00801dca <sys_page_alloc_vec>:
+
+int
+sys_page_alloc_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801dca:	55                   	push   %ebp
+  801dcb:	89 e5                	mov    %esp,%ebp
+  801dcd:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_alloc_vec, envid, 0, vec, n, done);
+  801dd0:	ff 75 14             	push   0x14(%ebp)
+  801dd3:	ff 75 10             	push   0x10(%ebp)
+  801dd6:	ff 75 0c             	push   0xc(%ebp)
+  801dd9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801dde:	8b 55 08             	mov    0x8(%ebp),%edx
+  801de1:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801de6:	e8 81 ee ff ff       	call   800c6c <page_vec_call>
+}
+  801deb:	c9                   	leave
+  801dec:	c3                   	ret
+
+00801ded <sys_page_map_vec>:
+
+int
+sys_page_map_vec(envid_t srcenv, envid_t dstenv, const struct page_range *vec,
+		 size_t n, size_t *done)
+{
+  801ded:	55                   	push   %ebp
+  801dee:	89 e5                	mov    %esp,%ebp
+  801df0:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_map_vec, srcenv, dstenv, vec, n, done);
+  801df3:	ff 75 18             	push   0x18(%ebp)
+  801df6:	ff 75 14             	push   0x14(%ebp)
+  801df9:	ff 75 10             	push   0x10(%ebp)
+  801dfc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801dff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e02:	b8 10 00 00 00       	mov    $0x10,%eax
+  801e07:	e8 60 ee ff ff       	call   800c6c <page_vec_call>
+}
+  801e0c:	c9                   	leave
+  801e0d:	c3                   	ret
+
+00801e0e <sys_page_unmap_vec>:
+
+int
+sys_page_unmap_vec(envid_t envid, const struct page_range *vec, size_t n,
+		   size_t *done)
+{
+  801e0e:	55                   	push   %ebp
+  801e0f:	89 e5                	mov    %esp,%ebp
+  801e11:	83 ec 0c             	sub    $0xc,%esp
+	return page_vec_call(SYS_page_unmap_vec, envid, 0, vec, n, done);
+  801e14:	ff 75 14             	push   0x14(%ebp)
+  801e17:	ff 75 10             	push   0x10(%ebp)
+  801e1a:	ff 75 0c             	push   0xc(%ebp)
+  801e1d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e22:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e25:	b8 11 00 00 00       	mov    $0x11,%eax
+  801e2a:	e8 3d ee ff ff       	call   800c6c <page_vec_call>
+}
+  801e2f:	c9                   	leave
+  801e30:	c3                   	ret
+
+00801e31 <sys_vm_ranges>:
+
+int
+sys_vm_ranges(envid_t envid, void *va, struct page_range *ranges, size_t n)
+{
+  801e31:	55                   	push   %ebp
+  801e32:	89 e5                	mov    %esp,%ebp
+  801e34:	57                   	push   %edi
+  801e35:	56                   	push   %esi
+  801e36:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801e37:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801e3e:	78 32                	js     801e72 <sys_vm_ranges+0x41>
+	if (syscall_sysenter)
+  801e40:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801e47:	74 75                	je     801ebe <sys_vm_ranges+0x8d>
+	asm volatile("pushl %%ebp\n"
+  801e49:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e4c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e4f:	b8 12 00 00 00       	mov    $0x12,%eax
+  801e54:	be 00 00 00 00       	mov    $0x0,%esi
+  801e59:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e5c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801e5f:	55                   	push   %ebp
+  801e60:	68 69 1e 80 00       	push   $0x801e69
+  801e65:	89 e5                	mov    %esp,%ebp
+  801e67:	0f 34                	sysenter
+  801e69:	83 c4 04             	add    $0x4,%esp
+  801e6c:	5d                   	pop    %ebp
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+		       (uint32_t) ranges, n, 0);
+}
+  801e6d:	5b                   	pop    %ebx
+  801e6e:	5e                   	pop    %esi
+  801e6f:	5f                   	pop    %edi
+  801e70:	5d                   	pop    %ebp
+  801e71:	c3                   	ret
+  801e72:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e77:	0f a2                	cpuid
+		return 0;
+  801e79:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801e7e:	f6 c6 08             	test   $0x8,%dh
+  801e81:	74 15                	je     801e98 <sys_vm_ranges+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801e83:	89 c2                	mov    %eax,%edx
+  801e85:	c1 ea 08             	shr    $0x8,%edx
+  801e88:	83 e2 0f             	and    $0xf,%edx
+  801e8b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e90:	83 fa 06             	cmp    $0x6,%edx
+  801e93:	74 0e                	je     801ea3 <sys_vm_ranges+0x72>
+  801e95:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801e98:	0f b6 c9             	movzbl %cl,%ecx
+  801e9b:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801ea1:	eb 9d                	jmp    801e40 <sys_vm_ranges+0xf>
+  801ea3:	89 c2                	mov    %eax,%edx
+  801ea5:	c1 ea 04             	shr    $0x4,%edx
+  801ea8:	83 e2 0f             	and    $0xf,%edx
+  801eab:	83 fa 02             	cmp    $0x2,%edx
+  801eae:	77 e5                	ja     801e95 <sys_vm_ranges+0x64>
+		 && (eax & 0xf) < 3);
+  801eb0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801eb3:	83 f8 02             	cmp    $0x2,%eax
+  801eb6:	0f 97 c1             	seta   %cl
+  801eb9:	0f b6 c9             	movzbl %cl,%ecx
+  801ebc:	eb d7                	jmp    801e95 <sys_vm_ranges+0x64>
+		asm volatile("int %1\n"
+  801ebe:	b8 12 00 00 00       	mov    $0x12,%eax
+  801ec3:	be 00 00 00 00       	mov    $0x0,%esi
+  801ec8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ecb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ece:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ed1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ed4:	cd 30                	int    $0x30
+	return syscall(SYS_vm_ranges, 0, envid, (uint32_t) va,
+  801ed6:	eb 95                	jmp    801e6d <sys_vm_ranges+0x3c>
+
+00801ed8 <sys_spawn>:
+
+envid_t
+sys_spawn(const void *binary, size_t size, const char **argv)
+{
+  801ed8:	55                   	push   %ebp
+  801ed9:	89 e5                	mov    %esp,%ebp
+  801edb:	57                   	push   %edi
+  801edc:	56                   	push   %esi
+  801edd:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  801ede:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801ee5:	78 31                	js     801f18 <sys_spawn+0x40>
+	if (syscall_sysenter)
+  801ee7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801eee:	74 74                	je     801f64 <sys_spawn+0x8c>
+	asm volatile("pushl %%ebp\n"
+  801ef0:	be 00 00 00 00       	mov    $0x0,%esi
+  801ef5:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ef8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801efb:	b8 14 00 00 00       	mov    $0x14,%eax
+  801f00:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f03:	89 f7                	mov    %esi,%edi
+  801f05:	55                   	push   %ebp
+  801f06:	68 0f 1f 80 00       	push   $0x801f0f
+  801f0b:	89 e5                	mov    %esp,%ebp
+  801f0d:	0f 34                	sysenter
+  801f0f:	83 c4 04             	add    $0x4,%esp
+  801f12:	5d                   	pop    %ebp
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+		       0, 0);
+}
+  801f13:	5b                   	pop    %ebx
+  801f14:	5e                   	pop    %esi
+  801f15:	5f                   	pop    %edi
+  801f16:	5d                   	pop    %ebp
+  801f17:	c3                   	ret
+  801f18:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f1d:	0f a2                	cpuid
+		return 0;
+  801f1f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801f24:	f6 c6 08             	test   $0x8,%dh
+  801f27:	74 15                	je     801f3e <sys_spawn+0x66>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f29:	89 c2                	mov    %eax,%edx
+  801f2b:	c1 ea 08             	shr    $0x8,%edx
+  801f2e:	83 e2 0f             	and    $0xf,%edx
+  801f31:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f36:	83 fa 06             	cmp    $0x6,%edx
+  801f39:	74 0e                	je     801f49 <sys_spawn+0x71>
+  801f3b:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801f3e:	0f b6 c9             	movzbl %cl,%ecx
+  801f41:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801f47:	eb 9e                	jmp    801ee7 <sys_spawn+0xf>
+  801f49:	89 c2                	mov    %eax,%edx
+  801f4b:	c1 ea 04             	shr    $0x4,%edx
+  801f4e:	83 e2 0f             	and    $0xf,%edx
+  801f51:	83 fa 02             	cmp    $0x2,%edx
+  801f54:	77 e5                	ja     801f3b <sys_spawn+0x63>
+		 && (eax & 0xf) < 3);
+  801f56:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801f59:	83 f8 02             	cmp    $0x2,%eax
+  801f5c:	0f 97 c1             	seta   %cl
+  801f5f:	0f b6 c9             	movzbl %cl,%ecx
+  801f62:	eb d7                	jmp    801f3b <sys_spawn+0x63>
+		asm volatile("int %1\n"
+  801f64:	be 00 00 00 00       	mov    $0x0,%esi
+  801f69:	b8 14 00 00 00       	mov    $0x14,%eax
+  801f6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f71:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f74:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f77:	89 f7                	mov    %esi,%edi
+  801f79:	cd 30                	int    $0x30
+	return syscall(SYS_spawn, 0, (uint32_t) binary, size, (uint32_t) argv,
+  801f7b:	eb 96                	jmp    801f13 <sys_spawn+0x3b>
+
+00801f7d <sys_shm_create>:
+
+int
+sys_shm_create(const char *name, size_t npages)
+{
+  801f7d:	55                   	push   %ebp
+  801f7e:	89 e5                	mov    %esp,%ebp
+  801f80:	57                   	push   %edi
+  801f81:	56                   	push   %esi
+  801f82:	53                   	push   %ebx
+  801f83:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  801f86:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801f8d:	78 37                	js     801fc6 <sys_shm_create+0x49>
+	if (syscall_sysenter)
+  801f8f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  801f96:	74 7a                	je     802012 <sys_shm_create+0x95>
+	asm volatile("pushl %%ebp\n"
+  801f98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fa0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fa3:	b8 15 00 00 00       	mov    $0x15,%eax
+  801fa8:	89 df                	mov    %ebx,%edi
+  801faa:	89 de                	mov    %ebx,%esi
+  801fac:	55                   	push   %ebp
+  801fad:	68 b6 1f 80 00       	push   $0x801fb6
+  801fb2:	89 e5                	mov    %esp,%ebp
+  801fb4:	0f 34                	sysenter
+  801fb6:	83 c4 04             	add    $0x4,%esp
+  801fb9:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801fba:	85 c0                	test   %eax,%eax
+  801fbc:	7f 6c                	jg     80202a <sys_shm_create+0xad>
+	return syscall(SYS_shm_create, 1, (uint32_t) name, npages, 0, 0, 0);
+}
+  801fbe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fc1:	5b                   	pop    %ebx
+  801fc2:	5e                   	pop    %esi
+  801fc3:	5f                   	pop    %edi
+  801fc4:	5d                   	pop    %ebp
+  801fc5:	c3                   	ret
+  801fc6:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fcb:	0f a2                	cpuid
+		return 0;
+  801fcd:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  801fd2:	f6 c6 08             	test   $0x8,%dh
+  801fd5:	74 15                	je     801fec <sys_shm_create+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  801fd7:	89 c2                	mov    %eax,%edx
+  801fd9:	c1 ea 08             	shr    $0x8,%edx
+  801fdc:	83 e2 0f             	and    $0xf,%edx
+  801fdf:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801fe4:	83 fa 06             	cmp    $0x6,%edx
+  801fe7:	74 0e                	je     801ff7 <sys_shm_create+0x7a>
+  801fe9:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  801fec:	0f b6 c9             	movzbl %cl,%ecx
+  801fef:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  801ff5:	eb 98                	jmp    801f8f <sys_shm_create+0x12>
+  801ff7:	89 c2                	mov    %eax,%edx
+  801ff9:	c1 ea 04             	shr    $0x4,%edx
+  801ffc:	83 e2 0f             	and    $0xf,%edx
+  801fff:	83 fa 02             	cmp    $0x2,%edx
+  802002:	77 e5                	ja     801fe9 <sys_shm_create+0x6c>
+		 && (eax & 0xf) < 3);
+  802004:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802007:	83 f8 02             	cmp    $0x2,%eax
+  80200a:	0f 97 c1             	seta   %cl
+  80200d:	0f b6 c9             	movzbl %cl,%ecx
+  802010:	eb d7                	jmp    801fe9 <sys_shm_create+0x6c>
+		asm volatile("int %1\n"
+  802012:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802017:	b8 15 00 00 00       	mov    $0x15,%eax
+  80201c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80201f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802022:	89 df                	mov    %ebx,%edi
+  802024:	89 de                	mov    %ebx,%esi
+  802026:	cd 30                	int    $0x30
+  802028:	eb 90                	jmp    801fba <sys_shm_create+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80202a:	83 ec 0c             	sub    $0xc,%esp
+  80202d:	50                   	push   %eax
+  80202e:	6a 15                	push   $0x15
+  802030:	68 f9 2d 80 00       	push   $0x802df9
+  802035:	6a 4a                	push   $0x4a
+  802037:	68 16 2e 80 00       	push   $0x802e16
+  80203c:	e8 e5 e1 ff ff       	call   800226 <_panic>
+
+00802041 <sys_shm_attach>:
+
+int
+sys_shm_attach(envid_t envid, const char *name, void *va, int perm)
+{
+  802041:	55                   	push   %ebp
+  802042:	89 e5                	mov    %esp,%ebp
+  802044:	57                   	push   %edi
+  802045:	56                   	push   %esi
+  802046:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802047:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80204e:	78 32                	js     802082 <sys_shm_attach+0x41>
+	if (syscall_sysenter)
+  802050:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802057:	74 75                	je     8020ce <sys_shm_attach+0x8d>
+	asm volatile("pushl %%ebp\n"
+  802059:	8b 55 08             	mov    0x8(%ebp),%edx
+  80205c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80205f:	b8 16 00 00 00       	mov    $0x16,%eax
+  802064:	be 00 00 00 00       	mov    $0x0,%esi
+  802069:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80206c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80206f:	55                   	push   %ebp
+  802070:	68 79 20 80 00       	push   $0x802079
+  802075:	89 e5                	mov    %esp,%ebp
+  802077:	0f 34                	sysenter
+  802079:	83 c4 04             	add    $0x4,%esp
+  80207c:	5d                   	pop    %ebp
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+		       perm, 0);
+}
+  80207d:	5b                   	pop    %ebx
+  80207e:	5e                   	pop    %esi
+  80207f:	5f                   	pop    %edi
+  802080:	5d                   	pop    %ebp
+  802081:	c3                   	ret
+  802082:	b8 01 00 00 00       	mov    $0x1,%eax
+  802087:	0f a2                	cpuid
+		return 0;
+  802089:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80208e:	f6 c6 08             	test   $0x8,%dh
+  802091:	74 15                	je     8020a8 <sys_shm_attach+0x67>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802093:	89 c2                	mov    %eax,%edx
+  802095:	c1 ea 08             	shr    $0x8,%edx
+  802098:	83 e2 0f             	and    $0xf,%edx
+  80209b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8020a0:	83 fa 06             	cmp    $0x6,%edx
+  8020a3:	74 0e                	je     8020b3 <sys_shm_attach+0x72>
+  8020a5:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8020a8:	0f b6 c9             	movzbl %cl,%ecx
+  8020ab:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8020b1:	eb 9d                	jmp    802050 <sys_shm_attach+0xf>
+  8020b3:	89 c2                	mov    %eax,%edx
+  8020b5:	c1 ea 04             	shr    $0x4,%edx
+  8020b8:	83 e2 0f             	and    $0xf,%edx
+  8020bb:	83 fa 02             	cmp    $0x2,%edx
+  8020be:	77 e5                	ja     8020a5 <sys_shm_attach+0x64>
+		 && (eax & 0xf) < 3);
+  8020c0:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8020c3:	83 f8 02             	cmp    $0x2,%eax
+  8020c6:	0f 97 c1             	seta   %cl
+  8020c9:	0f b6 c9             	movzbl %cl,%ecx
+  8020cc:	eb d7                	jmp    8020a5 <sys_shm_attach+0x64>
+		asm volatile("int %1\n"
+  8020ce:	b8 16 00 00 00       	mov    $0x16,%eax
+  8020d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8020d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020de:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8020e1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8020e4:	cd 30                	int    $0x30
+	return syscall(SYS_shm_attach, 0, envid, (uint32_t) name, (uint32_t) va,
+  8020e6:	eb 95                	jmp    80207d <sys_shm_attach+0x3c>
+
+008020e8 <sys_shm_detach>:
+
+int
+sys_shm_detach(envid_t envid, const char *name, void *va)
+{
+  8020e8:	55                   	push   %ebp
+  8020e9:	89 e5                	mov    %esp,%ebp
+  8020eb:	57                   	push   %edi
+  8020ec:	56                   	push   %esi
+  8020ed:	53                   	push   %ebx
+  8020ee:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8020f1:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8020f8:	78 38                	js     802132 <sys_shm_detach+0x4a>
+	if (syscall_sysenter)
+  8020fa:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802101:	74 7b                	je     80217e <sys_shm_detach+0x96>
+	asm volatile("pushl %%ebp\n"
+  802103:	be 00 00 00 00       	mov    $0x0,%esi
+  802108:	8b 55 08             	mov    0x8(%ebp),%edx
+  80210b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80210e:	b8 17 00 00 00       	mov    $0x17,%eax
+  802113:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802116:	89 f7                	mov    %esi,%edi
+  802118:	55                   	push   %ebp
+  802119:	68 22 21 80 00       	push   $0x802122
+  80211e:	89 e5                	mov    %esp,%ebp
+  802120:	0f 34                	sysenter
+  802122:	83 c4 04             	add    $0x4,%esp
+  802125:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802126:	85 c0                	test   %eax,%eax
+  802128:	7f 6d                	jg     802197 <sys_shm_detach+0xaf>
+	return syscall(SYS_shm_detach, 1, envid, (uint32_t) name, (uint32_t) va,
+		       0, 0);
+}
+  80212a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80212d:	5b                   	pop    %ebx
+  80212e:	5e                   	pop    %esi
+  80212f:	5f                   	pop    %edi
+  802130:	5d                   	pop    %ebp
+  802131:	c3                   	ret
+  802132:	b8 01 00 00 00       	mov    $0x1,%eax
+  802137:	0f a2                	cpuid
+		return 0;
+  802139:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80213e:	f6 c6 08             	test   $0x8,%dh
+  802141:	74 15                	je     802158 <sys_shm_detach+0x70>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802143:	89 c2                	mov    %eax,%edx
+  802145:	c1 ea 08             	shr    $0x8,%edx
+  802148:	83 e2 0f             	and    $0xf,%edx
+  80214b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802150:	83 fa 06             	cmp    $0x6,%edx
+  802153:	74 0e                	je     802163 <sys_shm_detach+0x7b>
+  802155:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802158:	0f b6 c9             	movzbl %cl,%ecx
+  80215b:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802161:	eb 97                	jmp    8020fa <sys_shm_detach+0x12>
+  802163:	89 c2                	mov    %eax,%edx
+  802165:	c1 ea 04             	shr    $0x4,%edx
+  802168:	83 e2 0f             	and    $0xf,%edx
+  80216b:	83 fa 02             	cmp    $0x2,%edx
+  80216e:	77 e5                	ja     802155 <sys_shm_detach+0x6d>
+		 && (eax & 0xf) < 3);
+  802170:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802173:	83 f8 02             	cmp    $0x2,%eax
+  802176:	0f 97 c1             	seta   %cl
+  802179:	0f b6 c9             	movzbl %cl,%ecx
+  80217c:	eb d7                	jmp    802155 <sys_shm_detach+0x6d>
+		asm volatile("int %1\n"
+  80217e:	be 00 00 00 00       	mov    $0x0,%esi
+  802183:	b8 17 00 00 00       	mov    $0x17,%eax
+  802188:	8b 55 08             	mov    0x8(%ebp),%edx
+  80218b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80218e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802191:	89 f7                	mov    %esi,%edi
+  802193:	cd 30                	int    $0x30
+  802195:	eb 8f                	jmp    802126 <sys_shm_detach+0x3e>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802197:	83 ec 0c             	sub    $0xc,%esp
+  80219a:	50                   	push   %eax
+  80219b:	6a 17                	push   $0x17
+  80219d:	68 f9 2d 80 00       	push   $0x802df9
+  8021a2:	6a 4a                	push   $0x4a
+  8021a4:	68 16 2e 80 00       	push   $0x802e16
+  8021a9:	e8 78 e0 ff ff       	call   800226 <_panic>
+
+008021ae <sys_shm_remove>:
+
+int
+sys_shm_remove(const char *name)
+{
+  8021ae:	55                   	push   %ebp
+  8021af:	89 e5                	mov    %esp,%ebp
+  8021b1:	57                   	push   %edi
+  8021b2:	56                   	push   %esi
+  8021b3:	53                   	push   %ebx
+  8021b4:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  8021b7:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8021be:	78 36                	js     8021f6 <sys_shm_remove+0x48>
+	if (syscall_sysenter)
+  8021c0:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8021c7:	74 79                	je     802242 <sys_shm_remove+0x94>
+	asm volatile("pushl %%ebp\n"
+  8021c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021d1:	b8 18 00 00 00       	mov    $0x18,%eax
+  8021d6:	89 cb                	mov    %ecx,%ebx
+  8021d8:	89 cf                	mov    %ecx,%edi
+  8021da:	89 ce                	mov    %ecx,%esi
+  8021dc:	55                   	push   %ebp
+  8021dd:	68 e6 21 80 00       	push   $0x8021e6
+  8021e2:	89 e5                	mov    %esp,%ebp
+  8021e4:	0f 34                	sysenter
+  8021e6:	83 c4 04             	add    $0x4,%esp
+  8021e9:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8021ea:	85 c0                	test   %eax,%eax
+  8021ec:	7f 6b                	jg     802259 <sys_shm_remove+0xab>
+	return syscall(SYS_shm_remove, 1, (uint32_t) name, 0, 0, 0, 0);
+}
+  8021ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021f1:	5b                   	pop    %ebx
+  8021f2:	5e                   	pop    %esi
+  8021f3:	5f                   	pop    %edi
+  8021f4:	5d                   	pop    %ebp
+  8021f5:	c3                   	ret
+  8021f6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021fb:	0f a2                	cpuid
+		return 0;
+  8021fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802202:	f6 c6 08             	test   $0x8,%dh
+  802205:	74 15                	je     80221c <sys_shm_remove+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802207:	89 c2                	mov    %eax,%edx
+  802209:	c1 ea 08             	shr    $0x8,%edx
+  80220c:	83 e2 0f             	and    $0xf,%edx
+  80220f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802214:	83 fa 06             	cmp    $0x6,%edx
+  802217:	74 0e                	je     802227 <sys_shm_remove+0x79>
+  802219:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  80221c:	0f b6 c9             	movzbl %cl,%ecx
+  80221f:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802225:	eb 99                	jmp    8021c0 <sys_shm_remove+0x12>
+  802227:	89 c2                	mov    %eax,%edx
+  802229:	c1 ea 04             	shr    $0x4,%edx
+  80222c:	83 e2 0f             	and    $0xf,%edx
+  80222f:	83 fa 02             	cmp    $0x2,%edx
+  802232:	77 e5                	ja     802219 <sys_shm_remove+0x6b>
+		 && (eax & 0xf) < 3);
+  802234:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802237:	83 f8 02             	cmp    $0x2,%eax
+  80223a:	0f 97 c1             	seta   %cl
+  80223d:	0f b6 c9             	movzbl %cl,%ecx
+  802240:	eb d7                	jmp    802219 <sys_shm_remove+0x6b>
+		asm volatile("int %1\n"
+  802242:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802247:	b8 18 00 00 00       	mov    $0x18,%eax
+  80224c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80224f:	89 cb                	mov    %ecx,%ebx
+  802251:	89 cf                	mov    %ecx,%edi
+  802253:	89 ce                	mov    %ecx,%esi
+  802255:	cd 30                	int    $0x30
+  802257:	eb 91                	jmp    8021ea <sys_shm_remove+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802259:	83 ec 0c             	sub    $0xc,%esp
+  80225c:	50                   	push   %eax
+  80225d:	6a 18                	push   $0x18
+  80225f:	68 f9 2d 80 00       	push   $0x802df9
+  802264:	6a 4a                	push   $0x4a
+  802266:	68 16 2e 80 00       	push   $0x802e16
+  80226b:	e8 b6 df ff ff       	call   800226 <_panic>
+
+00802270 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected,
+	       nanoseconds_t timeout)
+{
+  802270:	55                   	push   %ebp
+  802271:	89 e5                	mov    %esp,%ebp
+  802273:	57                   	push   %edi
+  802274:	56                   	push   %esi
+  802275:	53                   	push   %ebx
+  802276:	83 ec 0c             	sub    $0xc,%esp
+  802279:	8b 45 10             	mov    0x10(%ebp),%eax
+  80227c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80227f:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (syscall_sysenter < 0)
+  802282:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802289:	78 32                	js     8022bd <sys_futex_wait+0x4d>
+	if (syscall_sysenter)
+  80228b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802292:	74 75                	je     802309 <sys_futex_wait+0x99>
+	asm volatile("pushl %%ebp\n"
+  802294:	8b 55 08             	mov    0x8(%ebp),%edx
+  802297:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80229a:	b8 20 00 00 00       	mov    $0x20,%eax
+  80229f:	be 00 00 00 00       	mov    $0x0,%esi
+  8022a4:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8022a7:	55                   	push   %ebp
+  8022a8:	68 b1 22 80 00       	push   $0x8022b1
+  8022ad:	89 e5                	mov    %esp,%ebp
+  8022af:	0f 34                	sysenter
+  8022b1:	83 c4 04             	add    $0x4,%esp
+  8022b4:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+		       (uint32_t) timeout, (uint32_t) (timeout >> 32), 0);
+}
+  8022b5:	83 c4 0c             	add    $0xc,%esp
+  8022b8:	5b                   	pop    %ebx
+  8022b9:	5e                   	pop    %esi
+  8022ba:	5f                   	pop    %edi
+  8022bb:	5d                   	pop    %ebp
+  8022bc:	c3                   	ret
+  8022bd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022c2:	0f a2                	cpuid
+		return 0;
+  8022c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8022c9:	f6 c6 08             	test   $0x8,%dh
+  8022cc:	74 15                	je     8022e3 <sys_futex_wait+0x73>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022ce:	89 c2                	mov    %eax,%edx
+  8022d0:	c1 ea 08             	shr    $0x8,%edx
+  8022d3:	83 e2 0f             	and    $0xf,%edx
+  8022d6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8022db:	83 fa 06             	cmp    $0x6,%edx
+  8022de:	74 0e                	je     8022ee <sys_futex_wait+0x7e>
+  8022e0:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8022e3:	0f b6 c9             	movzbl %cl,%ecx
+  8022e6:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8022ec:	eb 9d                	jmp    80228b <sys_futex_wait+0x1b>
+  8022ee:	89 c2                	mov    %eax,%edx
+  8022f0:	c1 ea 04             	shr    $0x4,%edx
+  8022f3:	83 e2 0f             	and    $0xf,%edx
+  8022f6:	83 fa 02             	cmp    $0x2,%edx
+  8022f9:	77 e5                	ja     8022e0 <sys_futex_wait+0x70>
+		 && (eax & 0xf) < 3);
+  8022fb:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8022fe:	83 f8 02             	cmp    $0x2,%eax
+  802301:	0f 97 c1             	seta   %cl
+  802304:	0f b6 c9             	movzbl %cl,%ecx
+  802307:	eb d7                	jmp    8022e0 <sys_futex_wait+0x70>
+		asm volatile("int %1\n"
+  802309:	b8 20 00 00 00       	mov    $0x20,%eax
+  80230e:	be 00 00 00 00       	mov    $0x0,%esi
+  802313:	8b 55 08             	mov    0x8(%ebp),%edx
+  802316:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802319:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  80231c:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, expected,
+  80231e:	eb 95                	jmp    8022b5 <sys_futex_wait+0x45>
+
+00802320 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  802320:	55                   	push   %ebp
+  802321:	89 e5                	mov    %esp,%ebp
+  802323:	57                   	push   %edi
+  802324:	56                   	push   %esi
+  802325:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802326:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80232d:	78 30                	js     80235f <sys_futex_wake+0x3f>
+	if (syscall_sysenter)
+  80232f:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802336:	74 73                	je     8023ab <sys_futex_wake+0x8b>
+	asm volatile("pushl %%ebp\n"
+  802338:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80233d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802340:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802343:	b8 21 00 00 00       	mov    $0x21,%eax
+  802348:	89 df                	mov    %ebx,%edi
+  80234a:	89 de                	mov    %ebx,%esi
+  80234c:	55                   	push   %ebp
+  80234d:	68 56 23 80 00       	push   $0x802356
+  802352:	89 e5                	mov    %esp,%ebp
+  802354:	0f 34                	sysenter
+  802356:	83 c4 04             	add    $0x4,%esp
+  802359:	5d                   	pop    %ebp
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80235a:	5b                   	pop    %ebx
+  80235b:	5e                   	pop    %esi
+  80235c:	5f                   	pop    %edi
+  80235d:	5d                   	pop    %ebp
+  80235e:	c3                   	ret
+  80235f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802364:	0f a2                	cpuid
+		return 0;
+  802366:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80236b:	f6 c6 08             	test   $0x8,%dh
+  80236e:	74 15                	je     802385 <sys_futex_wake+0x65>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802370:	89 c2                	mov    %eax,%edx
+  802372:	c1 ea 08             	shr    $0x8,%edx
+  802375:	83 e2 0f             	and    $0xf,%edx
+  802378:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80237d:	83 fa 06             	cmp    $0x6,%edx
+  802380:	74 0e                	je     802390 <sys_futex_wake+0x70>
+  802382:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802385:	0f b6 c9             	movzbl %cl,%ecx
+  802388:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80238e:	eb 9f                	jmp    80232f <sys_futex_wake+0xf>
+  802390:	89 c2                	mov    %eax,%edx
+  802392:	c1 ea 04             	shr    $0x4,%edx
+  802395:	83 e2 0f             	and    $0xf,%edx
+  802398:	83 fa 02             	cmp    $0x2,%edx
+  80239b:	77 e5                	ja     802382 <sys_futex_wake+0x62>
+		 && (eax & 0xf) < 3);
+  80239d:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8023a0:	83 f8 02             	cmp    $0x2,%eax
+  8023a3:	0f 97 c1             	seta   %cl
+  8023a6:	0f b6 c9             	movzbl %cl,%ecx
+  8023a9:	eb d7                	jmp    802382 <sys_futex_wake+0x62>
+		asm volatile("int %1\n"
+  8023ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023b0:	b8 21 00 00 00       	mov    $0x21,%eax
+  8023b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023bb:	89 df                	mov    %ebx,%edi
+  8023bd:	89 de                	mov    %ebx,%esi
+  8023bf:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+  8023c1:	eb 97                	jmp    80235a <sys_futex_wake+0x3a>
+
+008023c3 <sys_ep_create>:
+
+epid_t
+sys_ep_create(void)
+{
+  8023c3:	55                   	push   %ebp
+  8023c4:	89 e5                	mov    %esp,%ebp
+  8023c6:	57                   	push   %edi
+  8023c7:	56                   	push   %esi
+  8023c8:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8023c9:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8023d0:	78 2e                	js     802400 <sys_ep_create+0x3d>
+	if (syscall_sysenter)
+  8023d2:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8023d9:	74 71                	je     80244c <sys_ep_create+0x89>
+	asm volatile("pushl %%ebp\n"
+  8023db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023e0:	b8 22 00 00 00       	mov    $0x22,%eax
+  8023e5:	89 d1                	mov    %edx,%ecx
+  8023e7:	89 d3                	mov    %edx,%ebx
+  8023e9:	89 d7                	mov    %edx,%edi
+  8023eb:	89 d6                	mov    %edx,%esi
+  8023ed:	55                   	push   %ebp
+  8023ee:	68 f7 23 80 00       	push   $0x8023f7
+  8023f3:	89 e5                	mov    %esp,%ebp
+  8023f5:	0f 34                	sysenter
+  8023f7:	83 c4 04             	add    $0x4,%esp
+  8023fa:	5d                   	pop    %ebp
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+}
+  8023fb:	5b                   	pop    %ebx
+  8023fc:	5e                   	pop    %esi
+  8023fd:	5f                   	pop    %edi
+  8023fe:	5d                   	pop    %ebp
+  8023ff:	c3                   	ret
+  802400:	b8 01 00 00 00       	mov    $0x1,%eax
+  802405:	0f a2                	cpuid
+		return 0;
+  802407:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  80240c:	f6 c6 08             	test   $0x8,%dh
+  80240f:	74 15                	je     802426 <sys_ep_create+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802411:	89 c2                	mov    %eax,%edx
+  802413:	c1 ea 08             	shr    $0x8,%edx
+  802416:	83 e2 0f             	and    $0xf,%edx
+  802419:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80241e:	83 fa 06             	cmp    $0x6,%edx
+  802421:	74 0e                	je     802431 <sys_ep_create+0x6e>
+  802423:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802426:	0f b6 c9             	movzbl %cl,%ecx
+  802429:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80242f:	eb a1                	jmp    8023d2 <sys_ep_create+0xf>
+  802431:	89 c2                	mov    %eax,%edx
+  802433:	c1 ea 04             	shr    $0x4,%edx
+  802436:	83 e2 0f             	and    $0xf,%edx
+  802439:	83 fa 02             	cmp    $0x2,%edx
+  80243c:	77 e5                	ja     802423 <sys_ep_create+0x60>
+		 && (eax & 0xf) < 3);
+  80243e:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  802441:	83 f8 02             	cmp    $0x2,%eax
+  802444:	0f 97 c1             	seta   %cl
+  802447:	0f b6 c9             	movzbl %cl,%ecx
+  80244a:	eb d7                	jmp    802423 <sys_ep_create+0x60>
+		asm volatile("int %1\n"
+  80244c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802451:	b8 22 00 00 00       	mov    $0x22,%eax
+  802456:	89 d1                	mov    %edx,%ecx
+  802458:	89 d3                	mov    %edx,%ebx
+  80245a:	89 d7                	mov    %edx,%edi
+  80245c:	89 d6                	mov    %edx,%esi
+  80245e:	cd 30                	int    $0x30
+	return syscall(SYS_ep_create, 0, 0, 0, 0, 0, 0);
+  802460:	eb 99                	jmp    8023fb <sys_ep_create+0x38>
+
+00802462 <sys_ep_destroy>:
+
+int
+sys_ep_destroy(epid_t epid)
+{
+  802462:	55                   	push   %ebp
+  802463:	89 e5                	mov    %esp,%ebp
+  802465:	57                   	push   %edi
+  802466:	56                   	push   %esi
+  802467:	53                   	push   %ebx
+  802468:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80246b:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802472:	78 36                	js     8024aa <sys_ep_destroy+0x48>
+	if (syscall_sysenter)
+  802474:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80247b:	74 79                	je     8024f6 <sys_ep_destroy+0x94>
+	asm volatile("pushl %%ebp\n"
+  80247d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802480:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802485:	b8 23 00 00 00       	mov    $0x23,%eax
+  80248a:	89 cb                	mov    %ecx,%ebx
+  80248c:	89 cf                	mov    %ecx,%edi
+  80248e:	89 ce                	mov    %ecx,%esi
+  802490:	55                   	push   %ebp
+  802491:	68 9a 24 80 00       	push   $0x80249a
+  802496:	89 e5                	mov    %esp,%ebp
+  802498:	0f 34                	sysenter
+  80249a:	83 c4 04             	add    $0x4,%esp
+  80249d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80249e:	85 c0                	test   %eax,%eax
+  8024a0:	7f 6b                	jg     80250d <sys_ep_destroy+0xab>
+	return syscall(SYS_ep_destroy, 1, epid, 0, 0, 0, 0);
+}
+  8024a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024a5:	5b                   	pop    %ebx
+  8024a6:	5e                   	pop    %esi
+  8024a7:	5f                   	pop    %edi
+  8024a8:	5d                   	pop    %ebp
+  8024a9:	c3                   	ret
+  8024aa:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024af:	0f a2                	cpuid
+		return 0;
+  8024b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8024b6:	f6 c6 08             	test   $0x8,%dh
+  8024b9:	74 15                	je     8024d0 <sys_ep_destroy+0x6e>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8024bb:	89 c2                	mov    %eax,%edx
+  8024bd:	c1 ea 08             	shr    $0x8,%edx
+  8024c0:	83 e2 0f             	and    $0xf,%edx
+  8024c3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8024c8:	83 fa 06             	cmp    $0x6,%edx
+  8024cb:	74 0e                	je     8024db <sys_ep_destroy+0x79>
+  8024cd:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8024d0:	0f b6 c9             	movzbl %cl,%ecx
+  8024d3:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8024d9:	eb 99                	jmp    802474 <sys_ep_destroy+0x12>
+  8024db:	89 c2                	mov    %eax,%edx
+  8024dd:	c1 ea 04             	shr    $0x4,%edx
+  8024e0:	83 e2 0f             	and    $0xf,%edx
+  8024e3:	83 fa 02             	cmp    $0x2,%edx
+  8024e6:	77 e5                	ja     8024cd <sys_ep_destroy+0x6b>
+		 && (eax & 0xf) < 3);
+  8024e8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8024eb:	83 f8 02             	cmp    $0x2,%eax
+  8024ee:	0f 97 c1             	seta   %cl
+  8024f1:	0f b6 c9             	movzbl %cl,%ecx
+  8024f4:	eb d7                	jmp    8024cd <sys_ep_destroy+0x6b>
+		asm volatile("int %1\n"
+  8024f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024fb:	b8 23 00 00 00       	mov    $0x23,%eax
+  802500:	8b 55 08             	mov    0x8(%ebp),%edx
+  802503:	89 cb                	mov    %ecx,%ebx
+  802505:	89 cf                	mov    %ecx,%edi
+  802507:	89 ce                	mov    %ecx,%esi
+  802509:	cd 30                	int    $0x30
+  80250b:	eb 91                	jmp    80249e <sys_ep_destroy+0x3c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80250d:	83 ec 0c             	sub    $0xc,%esp
+  802510:	50                   	push   %eax
+  802511:	6a 23                	push   $0x23
+  802513:	68 f9 2d 80 00       	push   $0x802df9
+  802518:	6a 4a                	push   $0x4a
+  80251a:	68 16 2e 80 00       	push   $0x802e16
+  80251f:	e8 02 dd ff ff       	call   800226 <_panic>
+
+00802524 <sys_ep_grant>:
+
+int
+sys_ep_grant(epid_t epid, envid_t envid)
+{
+  802524:	55                   	push   %ebp
+  802525:	89 e5                	mov    %esp,%ebp
+  802527:	57                   	push   %edi
+  802528:	56                   	push   %esi
+  802529:	53                   	push   %ebx
+  80252a:	83 ec 0c             	sub    $0xc,%esp
+	if (syscall_sysenter < 0)
+  80252d:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802534:	78 37                	js     80256d <sys_ep_grant+0x49>
+	if (syscall_sysenter)
+  802536:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80253d:	74 7a                	je     8025b9 <sys_ep_grant+0x95>
+	asm volatile("pushl %%ebp\n"
+  80253f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802544:	8b 55 08             	mov    0x8(%ebp),%edx
+  802547:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80254a:	b8 24 00 00 00       	mov    $0x24,%eax
+  80254f:	89 df                	mov    %ebx,%edi
+  802551:	89 de                	mov    %ebx,%esi
+  802553:	55                   	push   %ebp
+  802554:	68 5d 25 80 00       	push   $0x80255d
+  802559:	89 e5                	mov    %esp,%ebp
+  80255b:	0f 34                	sysenter
+  80255d:	83 c4 04             	add    $0x4,%esp
+  802560:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  802561:	85 c0                	test   %eax,%eax
+  802563:	7f 6c                	jg     8025d1 <sys_ep_grant+0xad>
+	return syscall(SYS_ep_grant, 1, epid, envid, 0, 0, 0);
+}
+  802565:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802568:	5b                   	pop    %ebx
+  802569:	5e                   	pop    %esi
+  80256a:	5f                   	pop    %edi
+  80256b:	5d                   	pop    %ebp
+  80256c:	c3                   	ret
+  80256d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802572:	0f a2                	cpuid
+		return 0;
+  802574:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802579:	f6 c6 08             	test   $0x8,%dh
+  80257c:	74 15                	je     802593 <sys_ep_grant+0x6f>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80257e:	89 c2                	mov    %eax,%edx
+  802580:	c1 ea 08             	shr    $0x8,%edx
+  802583:	83 e2 0f             	and    $0xf,%edx
+  802586:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80258b:	83 fa 06             	cmp    $0x6,%edx
+  80258e:	74 0e                	je     80259e <sys_ep_grant+0x7a>
+  802590:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802593:	0f b6 c9             	movzbl %cl,%ecx
+  802596:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  80259c:	eb 98                	jmp    802536 <sys_ep_grant+0x12>
+  80259e:	89 c2                	mov    %eax,%edx
+  8025a0:	c1 ea 04             	shr    $0x4,%edx
+  8025a3:	83 e2 0f             	and    $0xf,%edx
+  8025a6:	83 fa 02             	cmp    $0x2,%edx
+  8025a9:	77 e5                	ja     802590 <sys_ep_grant+0x6c>
+		 && (eax & 0xf) < 3);
+  8025ab:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8025ae:	83 f8 02             	cmp    $0x2,%eax
+  8025b1:	0f 97 c1             	seta   %cl
+  8025b4:	0f b6 c9             	movzbl %cl,%ecx
+  8025b7:	eb d7                	jmp    802590 <sys_ep_grant+0x6c>
+		asm volatile("int %1\n"
+  8025b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025be:	b8 24 00 00 00       	mov    $0x24,%eax
+  8025c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025c9:	89 df                	mov    %ebx,%edi
+  8025cb:	89 de                	mov    %ebx,%esi
+  8025cd:	cd 30                	int    $0x30
+  8025cf:	eb 90                	jmp    802561 <sys_ep_grant+0x3d>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8025d1:	83 ec 0c             	sub    $0xc,%esp
+  8025d4:	50                   	push   %eax
+  8025d5:	6a 24                	push   $0x24
+  8025d7:	68 f9 2d 80 00       	push   $0x802df9
+  8025dc:	6a 4a                	push   $0x4a
+  8025de:	68 16 2e 80 00       	push   $0x802e16
+  8025e3:	e8 3e dc ff ff       	call   800226 <_panic>
+
+008025e8 <sys_ep_send>:
+
+int
+sys_ep_send(epid_t epid, const struct ipc_msg *msg)
+{
+  8025e8:	55                   	push   %ebp
+  8025e9:	89 e5                	mov    %esp,%ebp
+  8025eb:	57                   	push   %edi
+  8025ec:	56                   	push   %esi
+  8025ed:	53                   	push   %ebx
+  8025ee:	83 ec 20             	sub    $0x20,%esp
+  8025f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct ipc_msg m = *msg;
+  8025f4:	8b 10                	mov    (%eax),%edx
+  8025f6:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8025f9:	8b 50 04             	mov    0x4(%eax),%edx
+  8025fc:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8025ff:	8b 50 08             	mov    0x8(%eax),%edx
+  802602:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  802605:	8b 50 0c             	mov    0xc(%eax),%edx
+  802608:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  80260b:	8b 40 10             	mov    0x10(%eax),%eax
+  80260e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	asm volatile("pushl %%ebp\n"
+  802611:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  802614:	8b 55 08             	mov    0x8(%ebp),%edx
+  802617:	b8 25 00 00 00       	mov    $0x25,%eax
+  80261c:	55                   	push   %ebp
+  80261d:	56                   	push   %esi
+  80261e:	8b 0e                	mov    (%esi),%ecx
+  802620:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802623:	8b 7e 08             	mov    0x8(%esi),%edi
+  802626:	8b 6e 10             	mov    0x10(%esi),%ebp
+  802629:	8b 76 0c             	mov    0xc(%esi),%esi
+  80262c:	cd 30                	int    $0x30
+  80262e:	87 34 24             	xchg   %esi,(%esp)
+  802631:	89 0e                	mov    %ecx,(%esi)
+  802633:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802636:	89 7e 08             	mov    %edi,0x8(%esi)
+  802639:	89 6e 10             	mov    %ebp,0x10(%esi)
+  80263c:	8f 46 0c             	pop    0xc(%esi)
+  80263f:	5d                   	pop    %ebp
+
+	return syscall_msg(SYS_ep_send, epid, &m, NULL);
+}
+  802640:	83 c4 20             	add    $0x20,%esp
+  802643:	5b                   	pop    %ebx
+  802644:	5e                   	pop    %esi
+  802645:	5f                   	pop    %edi
+  802646:	5d                   	pop    %ebp
+  802647:	c3                   	ret
+
+00802648 <sys_ep_recv>:
+// The count of endpoints goes in CX, where the first message word
+// would be: the kernel reads it before it writes the message there.
+epid_t
+sys_ep_recv(const epid_t *epids, size_t n, struct ipc_msg *msg,
+	    envid_t *from_env_store)
+{
+  802648:	55                   	push   %ebp
+  802649:	89 e5                	mov    %esp,%ebp
+  80264b:	57                   	push   %edi
+  80264c:	56                   	push   %esi
+  80264d:	53                   	push   %ebx
+  80264e:	8b 75 10             	mov    0x10(%ebp),%esi
+	uint32_t from;
+	int r;
+
+	msg->m_w[0] = n;
+  802651:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802654:	89 06                	mov    %eax,(%esi)
+	asm volatile("pushl %%ebp\n"
+  802656:	8b 55 08             	mov    0x8(%ebp),%edx
+  802659:	b8 26 00 00 00       	mov    $0x26,%eax
+  80265e:	55                   	push   %ebp
+  80265f:	56                   	push   %esi
+  802660:	8b 0e                	mov    (%esi),%ecx
+  802662:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802665:	8b 7e 08             	mov    0x8(%esi),%edi
+  802668:	8b 6e 10             	mov    0x10(%esi),%ebp
+  80266b:	8b 76 0c             	mov    0xc(%esi),%esi
+  80266e:	cd 30                	int    $0x30
+  802670:	87 34 24             	xchg   %esi,(%esp)
+  802673:	89 0e                	mov    %ecx,(%esi)
+  802675:	89 5e 04             	mov    %ebx,0x4(%esi)
+  802678:	89 7e 08             	mov    %edi,0x8(%esi)
+  80267b:	89 6e 10             	mov    %ebp,0x10(%esi)
+  80267e:	8f 46 0c             	pop    0xc(%esi)
+  802681:	5d                   	pop    %ebp
+	r = syscall_msg(SYS_ep_recv, (uint32_t) epids, msg, &from);
+	if (from_env_store)
+  802682:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  802686:	74 0f                	je     802697 <sys_ep_recv+0x4f>
+		*from_env_store = r < 0 ? 0 : from;
+  802688:	85 c0                	test   %eax,%eax
+  80268a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80268f:	0f 48 d1             	cmovs  %ecx,%edx
+  802692:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  802695:	89 13                	mov    %edx,(%ebx)
+	return r;
+}
+  802697:	5b                   	pop    %ebx
+  802698:	5e                   	pop    %esi
+  802699:	5f                   	pop    %edi
+  80269a:	5d                   	pop    %ebp
+  80269b:	c3                   	ret
+
+0080269c <sys_sysring_setup>:
+
+int
+sys_sysring_setup(struct sysring *ring)
+{
+  80269c:	55                   	push   %ebp
+  80269d:	89 e5                	mov    %esp,%ebp
+  80269f:	57                   	push   %edi
+  8026a0:	56                   	push   %esi
+  8026a1:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  8026a2:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8026a9:	78 2f                	js     8026da <sys_sysring_setup+0x3e>
+	if (syscall_sysenter)
+  8026ab:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  8026b2:	74 72                	je     802726 <sys_sysring_setup+0x8a>
+	asm volatile("pushl %%ebp\n"
+  8026b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8026b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026bc:	b8 27 00 00 00       	mov    $0x27,%eax
+  8026c1:	89 cb                	mov    %ecx,%ebx
+  8026c3:	89 cf                	mov    %ecx,%edi
+  8026c5:	89 ce                	mov    %ecx,%esi
+  8026c7:	55                   	push   %ebp
+  8026c8:	68 d1 26 80 00       	push   $0x8026d1
+  8026cd:	89 e5                	mov    %esp,%ebp
+  8026cf:	0f 34                	sysenter
+  8026d1:	83 c4 04             	add    $0x4,%esp
+  8026d4:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+}
+  8026d5:	5b                   	pop    %ebx
+  8026d6:	5e                   	pop    %esi
+  8026d7:	5f                   	pop    %edi
+  8026d8:	5d                   	pop    %ebp
+  8026d9:	c3                   	ret
+  8026da:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026df:	0f a2                	cpuid
+		return 0;
+  8026e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  8026e6:	f6 c6 08             	test   $0x8,%dh
+  8026e9:	74 15                	je     802700 <sys_sysring_setup+0x64>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8026eb:	89 c2                	mov    %eax,%edx
+  8026ed:	c1 ea 08             	shr    $0x8,%edx
+  8026f0:	83 e2 0f             	and    $0xf,%edx
+  8026f3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8026f8:	83 fa 06             	cmp    $0x6,%edx
+  8026fb:	74 0e                	je     80270b <sys_sysring_setup+0x6f>
+  8026fd:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  802700:	0f b6 c9             	movzbl %cl,%ecx
+  802703:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  802709:	eb a0                	jmp    8026ab <sys_sysring_setup+0xf>
+  80270b:	89 c2                	mov    %eax,%edx
+  80270d:	c1 ea 04             	shr    $0x4,%edx
+  802710:	83 e2 0f             	and    $0xf,%edx
+  802713:	83 fa 02             	cmp    $0x2,%edx
+  802716:	77 e5                	ja     8026fd <sys_sysring_setup+0x61>
+		 && (eax & 0xf) < 3);
+  802718:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80271b:	83 f8 02             	cmp    $0x2,%eax
+  80271e:	0f 97 c1             	seta   %cl
+  802721:	0f b6 c9             	movzbl %cl,%ecx
+  802724:	eb d7                	jmp    8026fd <sys_sysring_setup+0x61>
+		asm volatile("int %1\n"
+  802726:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80272b:	b8 27 00 00 00       	mov    $0x27,%eax
+  802730:	8b 55 08             	mov    0x8(%ebp),%edx
+  802733:	89 cb                	mov    %ecx,%ebx
+  802735:	89 cf                	mov    %ecx,%edi
+  802737:	89 ce                	mov    %ecx,%esi
+  802739:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_setup, 0, (uint32_t) ring, 0, 0, 0, 0);
+  80273b:	eb 98                	jmp    8026d5 <sys_sysring_setup+0x39>
+
+0080273d <sys_sysring_enter>:
+
+int
+sys_sysring_enter(void)
+{
+  80273d:	55                   	push   %ebp
+  80273e:	89 e5                	mov    %esp,%ebp
+  802740:	57                   	push   %edi
+  802741:	56                   	push   %esi
+  802742:	53                   	push   %ebx
+	if (syscall_sysenter < 0)
+  802743:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  80274a:	78 2e                	js     80277a <sys_sysring_enter+0x3d>
+	if (syscall_sysenter)
+  80274c:	83 3d 04 30 80 00 00 	cmpl   $0x0,0x803004
+  802753:	74 71                	je     8027c6 <sys_sysring_enter+0x89>
+	asm volatile("pushl %%ebp\n"
+  802755:	ba 00 00 00 00       	mov    $0x0,%edx
+  80275a:	b8 28 00 00 00       	mov    $0x28,%eax
+  80275f:	89 d1                	mov    %edx,%ecx
+  802761:	89 d3                	mov    %edx,%ebx
+  802763:	89 d7                	mov    %edx,%edi
+  802765:	89 d6                	mov    %edx,%esi
+  802767:	55                   	push   %ebp
+  802768:	68 71 27 80 00       	push   $0x802771
+  80276d:	89 e5                	mov    %esp,%ebp
+  80276f:	0f 34                	sysenter
+  802771:	83 c4 04             	add    $0x4,%esp
+  802774:	5d                   	pop    %ebp
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+}
+  802775:	5b                   	pop    %ebx
+  802776:	5e                   	pop    %esi
+  802777:	5f                   	pop    %edi
+  802778:	5d                   	pop    %ebp
+  802779:	c3                   	ret
+  80277a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80277f:	0f a2                	cpuid
+		return 0;
+  802781:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (!(edx & BIT(CPUID_FEATURE_SEP % 32)))
+  802786:	f6 c6 08             	test   $0x8,%dh
+  802789:	74 15                	je     8027a0 <sys_sysring_enter+0x63>
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  80278b:	89 c2                	mov    %eax,%edx
+  80278d:	c1 ea 08             	shr    $0x8,%edx
+  802790:	83 e2 0f             	and    $0xf,%edx
+  802793:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802798:	83 fa 06             	cmp    $0x6,%edx
+  80279b:	74 0e                	je     8027ab <sys_sysring_enter+0x6e>
+  80279d:	83 e1 01             	and    $0x1,%ecx
+		syscall_sysenter = cpuid_sysenter();
+  8027a0:	0f b6 c9             	movzbl %cl,%ecx
+  8027a3:	89 0d 04 30 80 00    	mov    %ecx,0x803004
+  8027a9:	eb a1                	jmp    80274c <sys_sysring_enter+0xf>
+  8027ab:	89 c2                	mov    %eax,%edx
+  8027ad:	c1 ea 04             	shr    $0x4,%edx
+  8027b0:	83 e2 0f             	and    $0xf,%edx
+  8027b3:	83 fa 02             	cmp    $0x2,%edx
+  8027b6:	77 e5                	ja     80279d <sys_sysring_enter+0x60>
+		 && (eax & 0xf) < 3);
+  8027b8:	83 e0 0f             	and    $0xf,%eax
+	return !(((eax >> 8) & 0xf) == 6 && ((eax >> 4) & 0xf) < 3
+  8027bb:	83 f8 02             	cmp    $0x2,%eax
+  8027be:	0f 97 c1             	seta   %cl
+  8027c1:	0f b6 c9             	movzbl %cl,%ecx
+  8027c4:	eb d7                	jmp    80279d <sys_sysring_enter+0x60>
+		asm volatile("int %1\n"
+  8027c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027cb:	b8 28 00 00 00       	mov    $0x28,%eax
+  8027d0:	89 d1                	mov    %edx,%ecx
+  8027d2:	89 d3                	mov    %edx,%ebx
+  8027d4:	89 d7                	mov    %edx,%edi
+  8027d6:	89 d6                	mov    %edx,%esi
+  8027d8:	cd 30                	int    $0x30
+	return syscall(SYS_sysring_enter, 0, 0, 0, 0, 0, 0);
+  8027da:	eb 99                	jmp    802775 <sys_sysring_enter+0x38>
+
+008027dc <dm>:
+  8027dc:	55                   	push   %ebp
+  8027dd:	57                   	push   %edi
+  8027de:	56                   	push   %esi
+  8027df:	53                   	push   %ebx
+  8027e0:	83 ec 24             	sub    $0x24,%esp
+  8027e3:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8027e7:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8027eb:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8027ef:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8027f3:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8027f7:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8027fb:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8027ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802804:	ba 00 00 00 00       	mov    $0x0,%edx
+  802809:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80280e:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802815:	00 
+  802816:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80281d:	00 
+  80281e:	89 fb                	mov    %edi,%ebx
+  802820:	eb 08                	jmp    80282a <dm+0x4e>
+  802822:	83 e9 01             	sub    $0x1,%ecx
+  802825:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802828:	74 68                	je     802892 <dm+0xb6>
+  80282a:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80282e:	01 c0                	add    %eax,%eax
+  802830:	89 c6                	mov    %eax,%esi
+  802832:	89 d7                	mov    %edx,%edi
+  802834:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802838:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80283c:	0f ad d0             	shrd   %cl,%edx,%eax
+  80283f:	d3 ea                	shr    %cl,%edx
+  802841:	f6 c1 20             	test   $0x20,%cl
+  802844:	74 04                	je     80284a <dm+0x6e>
+  802846:	89 d0                	mov    %edx,%eax
+  802848:	31 d2                	xor    %edx,%edx
+  80284a:	83 e0 01             	and    $0x1,%eax
+  80284d:	89 04 24             	mov    %eax,(%esp)
+  802850:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802857:	00 
+  802858:	8b 04 24             	mov    (%esp),%eax
+  80285b:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80285f:	09 f0                	or     %esi,%eax
+  802861:	09 fa                	or     %edi,%edx
+  802863:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802867:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80286b:	39 f0                	cmp    %esi,%eax
+  80286d:	89 d5                	mov    %edx,%ebp
+  80286f:	19 fd                	sbb    %edi,%ebp
+  802871:	72 af                	jb     802822 <dm+0x46>
+  802873:	29 f0                	sub    %esi,%eax
+  802875:	19 fa                	sbb    %edi,%edx
+  802877:	89 cf                	mov    %ecx,%edi
+  802879:	c1 ef 05             	shr    $0x5,%edi
+  80287c:	83 e7 01             	and    $0x1,%edi
+  80287f:	89 fe                	mov    %edi,%esi
+  802881:	83 f6 01             	xor    $0x1,%esi
+  802884:	d3 e6                	shl    %cl,%esi
+  802886:	d3 e7                	shl    %cl,%edi
+  802888:	09 74 24 18          	or     %esi,0x18(%esp)
+  80288c:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802890:	eb 90                	jmp    802822 <dm+0x46>
+  802892:	85 db                	test   %ebx,%ebx
+  802894:	74 05                	je     80289b <dm+0xbf>
+  802896:	89 03                	mov    %eax,(%ebx)
+  802898:	89 53 04             	mov    %edx,0x4(%ebx)
+  80289b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80289f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8028a3:	83 c4 24             	add    $0x24,%esp
+  8028a6:	5b                   	pop    %ebx
+  8028a7:	5e                   	pop    %esi
+  8028a8:	5f                   	pop    %edi
+  8028a9:	5d                   	pop    %ebp
+  8028aa:	c3                   	ret
+
+008028ab <__udivdi3>:
+  8028ab:	83 ec 08             	sub    $0x8,%esp
+  8028ae:	6a 00                	push   $0x0
+  8028b0:	ff 74 24 1c          	push   0x1c(%esp)
+  8028b4:	ff 74 24 1c          	push   0x1c(%esp)
+  8028b8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8028bc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8028c0:	e8 17 ff ff ff       	call   8027dc <dm>
+  8028c5:	83 c4 14             	add    $0x14,%esp
+  8028c8:	c3                   	ret
+
+008028c9 <__umoddi3>:
+  8028c9:	83 ec 18             	sub    $0x18,%esp
+  8028cc:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8028d0:	50                   	push   %eax
+  8028d1:	ff 74 24 2c          	push   0x2c(%esp)
+  8028d5:	ff 74 24 2c          	push   0x2c(%esp)
+  8028d9:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8028dd:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8028e1:	e8 f6 fe ff ff       	call   8027dc <dm>
+  8028e6:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8028ea:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8028ee:	83 c4 24             	add    $0x24,%esp
+  8028f1:	c3                   	ret
+
+008028f2 <__divdi3>:
+  8028f2:	53                   	push   %ebx
+  8028f3:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8028f7:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8028fb:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8028ff:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  802903:	85 d2                	test   %edx,%edx
+  802905:	78 15                	js     80291c <__divdi3+0x2a>
+  802907:	85 db                	test   %ebx,%ebx
+  802909:	78 34                	js     80293f <__divdi3+0x4d>
+  80290b:	83 ec 04             	sub    $0x4,%esp
+  80290e:	6a 00                	push   $0x0
+  802910:	53                   	push   %ebx
+  802911:	51                   	push   %ecx
+  802912:	e8 c5 fe ff ff       	call   8027dc <dm>
+  802917:	83 c4 10             	add    $0x10,%esp
+  80291a:	eb 21                	jmp    80293d <__divdi3+0x4b>
+  80291c:	f7 d8                	neg    %eax
+  80291e:	83 d2 00             	adc    $0x0,%edx
+  802921:	f7 da                	neg    %edx
+  802923:	85 db                	test   %ebx,%ebx
+  802925:	78 30                	js     802957 <__divdi3+0x65>
+  802927:	83 ec 04             	sub    $0x4,%esp
+  80292a:	6a 00                	push   $0x0
+  80292c:	53                   	push   %ebx
+  80292d:	51                   	push   %ecx
+  80292e:	e8 a9 fe ff ff       	call   8027dc <dm>
+  802933:	83 c4 10             	add    $0x10,%esp
+  802936:	f7 d8                	neg    %eax
+  802938:	83 d2 00             	adc    $0x0,%edx
+  80293b:	f7 da                	neg    %edx
+  80293d:	5b                   	pop    %ebx
+  80293e:	c3                   	ret
+  80293f:	83 ec 04             	sub    $0x4,%esp
+  802942:	6a 00                	push   $0x0
+  802944:	f7 d9                	neg    %ecx
+  802946:	83 d3 00             	adc    $0x0,%ebx
+  802949:	f7 db                	neg    %ebx
+  80294b:	53                   	push   %ebx
+  80294c:	51                   	push   %ecx
+  80294d:	e8 8a fe ff ff       	call   8027dc <dm>
+  802952:	83 c4 10             	add    $0x10,%esp
+  802955:	eb df                	jmp    802936 <__divdi3+0x44>
+  802957:	83 ec 04             	sub    $0x4,%esp
+  80295a:	6a 00                	push   $0x0
+  80295c:	f7 d9                	neg    %ecx
+  80295e:	83 d3 00             	adc    $0x0,%ebx
+  802961:	f7 db                	neg    %ebx
+  802963:	53                   	push   %ebx
+  802964:	51                   	push   %ecx
+  802965:	e8 72 fe ff ff       	call   8027dc <dm>
+  80296a:	83 c4 10             	add    $0x10,%esp
+  80296d:	eb ce                	jmp    80293d <__divdi3+0x4b>
+
+0080296f <__moddi3>:
+  80296f:	55                   	push   %ebp
+  802970:	57                   	push   %edi
+  802971:	56                   	push   %esi
+  802972:	53                   	push   %ebx
+  802973:	83 ec 18             	sub    $0x18,%esp
+  802976:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  80297a:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80297e:	89 f1                	mov    %esi,%ecx
+  802980:	f7 d9                	neg    %ecx
+  802982:	89 da                	mov    %ebx,%edx
+  802984:	83 d2 00             	adc    $0x0,%edx
+  802987:	f7 da                	neg    %edx
+  802989:	0f 48 ce             	cmovs  %esi,%ecx
+  80298c:	0f 48 d3             	cmovs  %ebx,%edx
+  80298f:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802993:	50                   	push   %eax
+  802994:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802998:	f7 de                	neg    %esi
+  80299a:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  80299e:	83 d0 00             	adc    $0x0,%eax
+  8029a1:	f7 d8                	neg    %eax
+  8029a3:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  8029a8:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  8029ad:	50                   	push   %eax
+  8029ae:	56                   	push   %esi
+  8029af:	89 c8                	mov    %ecx,%eax
+  8029b1:	e8 26 fe ff ff       	call   8027dc <dm>
+  8029b6:	83 c4 10             	add    $0x10,%esp
+  8029b9:	85 db                	test   %ebx,%ebx
+  8029bb:	78 10                	js     8029cd <__moddi3+0x5e>
+  8029bd:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8029c1:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8029c5:	83 c4 14             	add    $0x14,%esp
+  8029c8:	5b                   	pop    %ebx
+  8029c9:	5e                   	pop    %esi
+  8029ca:	5f                   	pop    %edi
+  8029cb:	5d                   	pop    %ebp
+  8029cc:	c3                   	ret
+  8029cd:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8029d1:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8029d5:	f7 d8                	neg    %eax
+  8029d7:	83 d2 00             	adc    $0x0,%edx
+  8029da:	f7 da                	neg    %edx
+  8029dc:	eb e7                	jmp    8029c5 <__moddi3+0x56>
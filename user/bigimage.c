@@ -0,0 +1,57 @@
+// Start-up cost of a large binary under demand loading.
+//
+// The 2MB table below makes this binary mostly rodata that is never
+// read.  The kernel maps the pages of a binary as they are touched
+// (kern/elfcache.c), so load_icode's time and the resident set should
+// not depend on the table.  Prints both, then touches every 16th page
+// of the table and counts again.
+
+#include <inc/lib.h>
+
+#define TABLE_SIZE	(2 * 1024 * 1024)
+#define STRIDE		(16 * PGSIZE)
+
+// Initialized, so that it is file data rather than bss.
+static const char table[TABLE_SIZE] = { 1 };
+
+extern char etext[], end[];
+
+// Count the pages mapped in [UTEXT, end).
+static size_t
+resident(void)
+{
+	struct page_range ranges[PAGE_VEC_MAX];
+	uintptr_t va = UTEXT, lo, hi;
+	size_t n = 0;
+	int i, r;
+
+	while ((r = sys_vm_ranges(0, (void *) va, ranges, PAGE_VEC_MAX)) > 0) {
+		for (i = 0; i < r; i++) {
+			lo = (uintptr_t) ranges[i].pr_va;
+			hi = lo + ranges[i].pr_npages * PGSIZE;
+			if (lo >= (uintptr_t) end)
+				return n;
+			n += (MIN(hi, ROUNDUP((uintptr_t) end, PGSIZE)) - lo) / PGSIZE;
+			va = hi;
+		}
+	}
+	if (r < 0)
+		panic("sys_vm_ranges: %e", r);
+	return n;
+}
+
+void
+umain(int argc, char **argv)
+{
+	size_t image = (ROUNDUP((uintptr_t) end, PGSIZE) - UTEXT) / PGSIZE;
+	uint32_t sum = 0;
+	int i;
+
+	cprintf("image: %d pages, load_icode: %llu cycles\n",
+		image, thisenv->env_load_cycles);
+	cprintf("resident at start: %d pages\n", resident());
+	for (i = 0; i < TABLE_SIZE; i += STRIDE)
+		sum += table[i];
+	cprintf("resident after reading %d table pages: %d pages (sum %d)\n",
+		TABLE_SIZE / STRIDE, resident(), sum);
+}
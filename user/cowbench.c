@@ -0,0 +1,106 @@
+// Measure the latency of a copy-on-write fault, resolved either by the
+// kernel or by a user-level page fault handler.
+//
+// The kernel path writes to pages mapped PTE_COW.  The upcall path
+// writes to read-only pages and copies them in a handler that makes
+// the same sys_page_copy call the user-level fork's handler makes.
+// Latency is the cycles taken by the faulting write, read with rdtsc.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NPAGES	256
+#define SRC	((char *) 0x20000000)
+#define DST	((char *) 0x30000000)
+
+static void
+handler(struct UTrapframe *utf)
+{
+	void *addr = ROUNDDOWN((void *) utf->utf_fault_va, PGSIZE);
+	int r;
+
+	if (!(utf->utf_err & FEC_WR) || (char *) addr < DST
+	    || (char *) addr >= DST + NPAGES * PGSIZE)
+		panic("cowbench: unexpected fault va %08x err %x",
+		      utf->utf_fault_va, utf->utf_err);
+
+	if ((r = sys_page_copy(0, addr, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+		panic("sys_page_copy: %e", r);
+}
+
+// Map NPAGES pages at SRC and map them again at DST with 'perm'.
+static void
+setup(int perm)
+{
+	struct page_range range;
+	int i, r;
+
+	range.pr_va = SRC;
+	range.pr_npages = NPAGES;
+	range.pr_perm = PTE_P | PTE_U | PTE_W;
+	if ((r = sys_page_alloc_vec(0, &range, 1, 0)) < 0)
+		panic("sys_page_alloc_vec: %e", r);
+	for (i = 0; i < NPAGES; i++)
+		SRC[i * PGSIZE] = i;
+
+	range.pr_perm = perm;
+	range.pr_dstva = DST;
+	if ((r = sys_page_map_vec(0, 0, &range, 1, 0)) < 0)
+		panic("sys_page_map_vec: %e", r);
+}
+
+static void
+teardown(void)
+{
+	struct page_range range[2];
+
+	range[0].pr_va = SRC;
+	range[0].pr_npages = NPAGES;
+	range[1].pr_va = DST;
+	range[1].pr_npages = NPAGES;
+	sys_page_unmap_vec(0, range, 2, 0);
+}
+
+// Write to every page at DST; return the average cycles per write.
+static uint64_t
+touch(void)
+{
+	uint64_t start, total = 0;
+	int i;
+
+	for (i = 0; i < NPAGES; i++) {
+		start = read_tsc();
+		DST[i * PGSIZE] = -i;
+		total += read_tsc() - start;
+		if (SRC[i * PGSIZE] != (char) i)
+			panic("cowbench: write to %08x leaked to the original",
+			      DST + i * PGSIZE);
+	}
+	return total / NPAGES;
+}
+
+void
+umain(int argc, char **argv)
+{
+	struct sysinfo before, after;
+	uint64_t cycles;
+
+	setup(PTE_P | PTE_U | PTE_COW);
+	sys_sysinfo(&before);
+	cycles = touch();
+	sys_sysinfo(&after);
+	teardown();
+	cprintf("kernel: %llu faults, %llu cycles/fault (%llu in the kernel handler)\n",
+		after.kfaults - before.kfaults, cycles,
+		(after.kfault_cycles - before.kfault_cycles)
+		/ (after.kfaults - before.kfaults ? after.kfaults - before.kfaults : 1));
+
+	set_pgfault_handler(handler);
+	setup(PTE_P | PTE_U);
+	sys_sysinfo(&before);
+	cycles = touch();
+	sys_sysinfo(&after);
+	teardown();
+	cprintf("upcall: %llu faults, %llu cycles/fault\n",
+		after.upcalls - before.upcalls, cycles);
+}
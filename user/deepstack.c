@@ -0,0 +1,60 @@
+// Let a child with a small stack limit recurse until it hits the guard
+// page, which should kill it.  Then recurse far past one page of stack
+// ourselves, and count the stack pages that got mapped for it.
+
+#include <inc/lib.h>
+
+#define FRAME		512
+#define DEPTH		400		// 200KB of stack
+
+static int
+recurse(int depth)
+{
+	volatile char frame[FRAME];
+
+	frame[0] = depth;
+	if (depth == 0)
+		return frame[0];
+	return recurse(depth - 1) + frame[0];
+}
+
+// Count the pages mapped in the stack region.
+static size_t
+stack_pages(void)
+{
+	struct page_range r;
+	uintptr_t va = USTACKTOP - USTACKSIZE;
+	size_t n = 0;
+
+	while (sys_vm_ranges(0, (void *) va, &r, 1) > 0
+	       && (uintptr_t) r.pr_va < USTACKTOP) {
+		va = (uintptr_t) r.pr_va + r.pr_npages * PGSIZE;
+		n += (MIN(va, USTACKTOP) - (uintptr_t) r.pr_va) / PGSIZE;
+	}
+	return n;
+}
+
+void
+umain(int argc, char **argv)
+{
+	envid_t envid;
+	int r;
+
+	if ((envid = fork()) < 0)
+		panic("fork: %e", envid);
+	if (envid == 0) {
+		if ((r = sys_env_set_stack_limit(0, 16 * PGSIZE)) < 0)
+			panic("sys_env_set_stack_limit: %e", r);
+		cprintf("child: recursing past a 16 page limit\n");
+		recurse(DEPTH);
+		panic("child survived its stack overflow");
+	}
+	while (envs[ENVX(envid)].env_id == envid
+	       && envs[ENVX(envid)].env_status != ENV_FREE)
+		sys_yield();
+	cprintf("stack pages at start: %d\n", stack_pages());
+	recurse(DEPTH);
+	cprintf("stack pages after %d frames of %d bytes: %d\n",
+		DEPTH, FRAME, stack_pages());
+	cprintf("deepstack done\n");
+}
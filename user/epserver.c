@@ -0,0 +1,96 @@
+// One server env serves several independent channels through IPC
+// endpoints.  It creates one endpoint per service, forks clients, and
+// hands each client the capability for just its own service with
+// sys_ep_grant, then the endpoint ID with ipc_send.  The server waits
+// on all its endpoints at once with sys_ep_recv, which says which one
+// fired.  A client also checks that it cannot send on a service it
+// was not granted.
+
+#include <inc/lib.h>
+
+#define NSERVICES	3
+#define NCLIENTS	6
+#define NREQUESTS	100
+
+static const char *service_names[NSERVICES] = { "add", "mul", "xor" };
+
+static uint32_t
+serve(int service, const struct ipc_msg *msg)
+{
+	switch (service) {
+	case 0:
+		return msg->m_w[0] + msg->m_w[1];
+	case 1:
+		return msg->m_w[0] * msg->m_w[1];
+	default:
+		return msg->m_w[0] ^ msg->m_w[1];
+	}
+}
+
+static void
+client(int service, epid_t other)
+{
+	struct ipc_msg msg;
+	envid_t server;
+	epid_t epid;
+	uint32_t reply;
+	int i, r;
+
+	epid = ipc_recv(&server, 0, 0);
+	memset(&msg, 0, sizeof(msg));
+	if ((r = sys_ep_send(other, &msg)) != -E_NOT_FOUND)
+		panic("sent on an endpoint we were not granted: %e", r);
+
+	for (i = 0; i < NREQUESTS; i++) {
+		msg.m_w[0] = i;
+		msg.m_w[1] = i + 3;
+		if ((r = ep_send(epid, &msg)) < 0)
+			panic("ep_send: %e", r);
+		reply = ipc_recv(0, 0, 0);
+		if (reply != serve(service, &msg))
+			panic("%s(%d, %d) = %d", service_names[service],
+			      msg.m_w[0], msg.m_w[1], reply);
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+	epid_t eps[NSERVICES], epid;
+	uint32_t count[NSERVICES];
+	struct ipc_msg msg;
+	envid_t kid, from;
+	int i, x, r;
+
+	for (i = 0; i < NSERVICES; i++) {
+		if ((eps[i] = sys_ep_create()) < 0)
+			panic("sys_ep_create: %e", eps[i]);
+		count[i] = 0;
+	}
+
+	for (i = 0; i < NCLIENTS; i++) {
+		if ((kid = fork()) < 0)
+			panic("fork: %e", kid);
+		if (kid == 0) {
+			client(i % NSERVICES, eps[(i + 1) % NSERVICES]);
+			return;
+		}
+		if ((r = sys_ep_grant(eps[i % NSERVICES], kid)) < 0)
+			panic("sys_ep_grant: %e", r);
+		ipc_send(kid, eps[i % NSERVICES], 0, 0);
+	}
+
+	for (i = 0; i < NCLIENTS * NREQUESTS; i++) {
+		if ((epid = sys_ep_recv(eps, NSERVICES, &msg, &from)) < 0)
+			panic("sys_ep_recv: %e", epid);
+		for (x = 0; x < NSERVICES && eps[x] != epid; x++)
+			;
+		if (x == NSERVICES)
+			panic("sys_ep_recv: unknown endpoint %x", epid);
+		count[x]++;
+		ipc_send(from, serve(x, &msg), 0, 0);
+	}
+
+	for (i = 0; i < NSERVICES; i++)
+		cprintf("%s: %d requests\n", service_names[i], count[i]);
+}
@@ -0,0 +1,48 @@
+// Stream writes through demand-zero memory and report how many page
+// faults it took and how well the kernel's fault-around guessed.
+
+#include <inc/lib.h>
+
+#define NPAGES	192	// malloc's limit is 1MB
+
+static void
+report(const char *name, uint32_t faults, uint32_t prefaults, uint32_t hits)
+{
+	cprintf("%-10s %4d faults, %4d pages prefaulted, %3d%% hit, window %d\n",
+		name, faults, prefaults, prefaults ? 100 * hits / prefaults : 0,
+		thisenv->env_fault_around);
+}
+
+static void
+run(const char *name, char *mem, int stride)
+{
+	uint32_t faults, prefaults, hits;
+	int i;
+
+	faults = thisenv->env_faults;
+	prefaults = thisenv->env_prefaults;
+	hits = thisenv->env_prefault_hits;
+	for (i = 0; i < NPAGES; i += stride)
+		mem[i * PGSIZE] = i;
+	// The kernel scores a window at the next fault, so the last one
+	// of this run counts toward the next.
+	report(name, thisenv->env_faults - faults,
+	       thisenv->env_prefaults - prefaults,
+	       thisenv->env_prefault_hits - hits);
+}
+
+void
+umain(int argc, char **argv)
+{
+	char *mem;
+
+	if (!(mem = malloc(NPAGES * PGSIZE)))
+		panic("malloc failed");
+	run("sequential", mem, 1);
+	free(mem);
+
+	if (!(mem = malloc(NPAGES * PGSIZE)))
+		panic("malloc failed");
+	run("stride 8", mem, 8);
+	free(mem);
+}
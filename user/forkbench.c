@@ -0,0 +1,138 @@
+// Compare the kernel fork (sys_fork) with the user-level fork (ufork).
+//
+// Each workload is run once with each implementation:
+//   forktree    - the process tree from user/forktree.c, depth 4
+//   stresssched - the 20 back-to-back forks from user/stresssched.c
+//   bigfork     - forks of an env with 4MB of touched heap
+// Times are cycles spent inside the fork call, summed over every
+// process that forks, read with rdtsc.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define TREE_DEPTH	4
+#define NSTRESS		20
+#define NBIG		10
+#define BIGSIZE		(4 * 1024 * 1024)
+
+struct result {
+	uint64_t cycles;
+	uint32_t forks;
+};
+
+// Shared with every child through PTE_SHARE, so that descendants can
+// add in their own fork times.
+static struct result *res = (struct result *) UTEMP;
+
+static void
+wait_env(envid_t envid)
+{
+	while (envs[ENVX(envid)].env_id == envid
+	       && envs[ENVX(envid)].env_status != ENV_FREE)
+		sys_yield();
+}
+
+static envid_t
+timed_fork(envid_t (*forkfn)(void))
+{
+	uint64_t start;
+	envid_t envid;
+
+	start = read_tsc();
+	envid = forkfn();
+	if (envid < 0)
+		panic("fork: %e", envid);
+	if (envid > 0) {
+		__sync_fetch_and_add(&res->cycles, read_tsc() - start);
+		__sync_fetch_and_add(&res->forks, 1);
+	}
+	return envid;
+}
+
+static void
+forktree(envid_t (*forkfn)(void), int depth)
+{
+	envid_t kids[2];
+	int i;
+
+	if (depth == TREE_DEPTH)
+		return;
+	for (i = 0; i < 2; i++)
+		if ((kids[i] = timed_fork(forkfn)) == 0) {
+			forktree(forkfn, depth + 1);
+			exit();
+		}
+	for (i = 0; i < 2; i++)
+		wait_env(kids[i]);
+}
+
+static void
+stresssched(envid_t (*forkfn)(void))
+{
+	envid_t kids[NSTRESS];
+	int i;
+
+	for (i = 0; i < NSTRESS; i++)
+		if ((kids[i] = timed_fork(forkfn)) == 0)
+			exit();
+	for (i = 0; i < NSTRESS; i++)
+		wait_env(kids[i]);
+}
+
+static void
+bigfork(envid_t (*forkfn)(void))
+{
+	static char *big;
+	envid_t envid;
+	int i;
+
+	if (!big && !(big = malloc(BIGSIZE)))
+		panic("bigfork: out of memory");
+	for (i = 0; i < BIGSIZE; i += PGSIZE)
+		big[i] = i / PGSIZE;
+	for (i = 0; i < NBIG; i++) {
+		if ((envid = timed_fork(forkfn)) == 0)
+			exit();
+		wait_env(envid);
+	}
+}
+
+static void
+run(const char *name, void (*workload)(envid_t (*)(void)))
+{
+	static const struct {
+		const char *name;
+		envid_t (*fn)(void);
+	} impls[] = {
+		{ "ufork", ufork },
+		{ "fork", fork },
+	};
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(impls); i++) {
+		memset(res, 0, sizeof(*res));
+		workload(impls[i].fn);
+		cprintf("%-12s %-6s %3d forks %10llu cycles/fork\n",
+			name, impls[i].name, res->forks,
+			res->forks ? res->cycles / res->forks : 0);
+	}
+}
+
+static void
+forktree_top(envid_t (*forkfn)(void))
+{
+	forktree(forkfn, 0);
+}
+
+void
+umain(int argc, char **argv)
+{
+	int r;
+
+	if ((r = sys_page_alloc(0, res, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+		panic("sys_page_alloc: %e", r);
+
+	run("forktree", forktree_top);
+	run("stresssched", stresssched);
+	run("bigfork", bigfork);
+}
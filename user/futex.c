@@ -0,0 +1,74 @@
+// Several envs bump a counter in a shared page under a struct mutex,
+// then tell the parent they are done through a struct cond, so nobody
+// spins or yields in a loop.  Finally the parent checks that a
+// condition wait with nobody to signal it times out.
+
+#include <inc/lib.h>
+
+#define NCHILD		8
+#define NITER		1000
+#define TIMEOUT		(50 * NANOSECONDS_PER_MILLISECOND)
+
+struct shared {
+	struct mutex mu;
+	struct cond done_cv;
+	uint32_t counter;
+	uint32_t done;
+};
+
+static struct shared *sh = (struct shared *) UTEMP;
+
+static void
+child(void)
+{
+	int i;
+
+	for (i = 0; i < NITER; i++) {
+		mutex_lock(&sh->mu);
+		sh->counter++;
+		mutex_unlock(&sh->mu);
+	}
+	mutex_lock(&sh->mu);
+	sh->done++;
+	cond_signal(&sh->done_cv);
+	mutex_unlock(&sh->mu);
+}
+
+void
+umain(int argc, char **argv)
+{
+	nanoseconds_t start;
+	envid_t envid;
+	int i, r;
+
+	if ((r = sys_page_alloc(0, sh, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+		panic("sys_page_alloc: %e", r);
+	mutex_init(&sh->mu);
+	cond_init(&sh->done_cv);
+
+	for (i = 0; i < NCHILD; i++) {
+		if ((envid = fork()) < 0)
+			panic("fork: %e", envid);
+		if (envid == 0) {
+			child();
+			return;
+		}
+	}
+
+	mutex_lock(&sh->mu);
+	while (sh->done < NCHILD)
+		cond_wait(&sh->done_cv, &sh->mu);
+	if (sh->counter != NCHILD * NITER)
+		panic("counter is %d, expected %d", sh->counter,
+		      NCHILD * NITER);
+	cprintf("%d envs x %d increments: counter %d\n", NCHILD, NITER,
+		sh->counter);
+
+	start = uptime();
+	r = cond_timedwait(&sh->done_cv, &sh->mu, TIMEOUT);
+	mutex_unlock(&sh->mu);
+	if (r != -E_TIMEOUT)
+		panic("cond_timedwait: got %e, expected a timeout", r);
+	cprintf("timed wait gave up after %llu ms\n",
+		(uptime() - start) / NANOSECONDS_PER_MILLISECOND);
+}
@@ -0,0 +1,47 @@
+// Several senders hammer one receiver, as in user/fairness.  Senders
+// wait in the receiver's kernel queue instead of spinning, and are
+// served in arrival order, so every sender should get through at about
+// the same rate.  Prints per-sender counts and the queue statistics
+// the kernel keeps in the receiver's struct Env.
+
+#include <inc/lib.h>
+
+#define NSENDERS	6
+#define NMSGS		200
+
+void
+umain(int argc, char **argv)
+{
+	envid_t kids[NSENDERS], who, parent = thisenv->env_id;
+	uint32_t got[NSENDERS];
+	const volatile struct Env *e;
+	int i, j, v;
+
+	for (i = 0; i < NSENDERS; i++) {
+		if ((kids[i] = fork()) < 0)
+			panic("fork: %e", kids[i]);
+		if (kids[i] == 0) {
+			for (j = 0; j < NMSGS; j++)
+				ipc_send(parent, i, 0, 0);
+			return;
+		}
+		got[i] = 0;
+	}
+
+	for (j = 0; j < NSENDERS * NMSGS; j++) {
+		v = ipc_recv(&who, 0, 0);
+		if (v < 0 || v >= NSENDERS || kids[v] != who)
+			panic("bad message %d from %08x", v, who);
+		got[v]++;
+		// Halfway through, everyone should have had a fair share.
+		if (j == NSENDERS * NMSGS / 2)
+			for (i = 0; i < NSENDERS; i++)
+				cprintf("halfway: sender %08x %d messages\n",
+					kids[i], got[i]);
+	}
+
+	e = thisenv;
+	cprintf("received %d messages; queue now %d, %d senders queued, "
+		"%d refused\n", NSENDERS * NMSGS, e->env_ipc_qlen,
+		e->env_ipc_queued, e->env_ipc_drops);
+}
@@ -0,0 +1,94 @@
+// Hand a 1MB buffer to another env, first one page per message with
+// ipc_send, then in one message with ipc_send_range.  The receiver
+// checks every page and answers when it has them all.  Times are in
+// cycles per transfer of the whole buffer, read with rdtsc.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NPAGES		256
+#define NROUNDS		20
+#define PERM		(PTE_P | PTE_U | PTE_W)
+
+static uint8_t *buf = (uint8_t *) 0x10000000;
+static uint8_t *win = (uint8_t *) 0x20000000;
+
+static void
+check(const char *name, int round)
+{
+	int i;
+
+	for (i = 0; i < NPAGES; i++)
+		if (win[i * PGSIZE] != (uint8_t) (round + i))
+			panic("%s: page %d holds %d in round %d", name, i,
+			      win[i * PGSIZE], round);
+}
+
+static void
+receiver(envid_t parent)
+{
+	size_t n;
+	int round, i;
+
+	for (round = 0; round < NROUNDS; round++) {
+		for (i = 0; i < NPAGES; i++)
+			ipc_recv(0, win + i * PGSIZE, 0);
+		check("per page", round);
+		ipc_send(parent, 0, 0, 0);
+	}
+	for (round = 0; round < NROUNDS; round++) {
+		n = NPAGES;
+		ipc_recv_range(0, win, &n, 0);
+		if (n != NPAGES)
+			panic("range: got %d pages", n);
+		check("range", round);
+		ipc_send(parent, 0, 0, 0);
+	}
+}
+
+static void
+fill(int round)
+{
+	int i;
+
+	for (i = 0; i < NPAGES; i++)
+		buf[i * PGSIZE] = round + i;
+}
+
+void
+umain(int argc, char **argv)
+{
+	envid_t child, parent = thisenv->env_id;
+	uint64_t start;
+	int round, i, r;
+
+	if ((child = fork()) < 0)
+		panic("fork: %e", child);
+	if (child == 0) {
+		receiver(parent);
+		return;
+	}
+
+	for (i = 0; i < NPAGES; i++)
+		if ((r = sys_page_alloc(0, buf + i * PGSIZE, PERM)) < 0)
+			panic("sys_page_alloc: %e", r);
+
+	start = read_tsc();
+	for (round = 0; round < NROUNDS; round++) {
+		fill(round);
+		for (i = 0; i < NPAGES; i++)
+			ipc_send(child, 0, buf + i * PGSIZE, PERM);
+		ipc_recv(0, 0, 0);
+	}
+	cprintf("per page  %d pages %10llu cycles/transfer\n",
+		NPAGES, (read_tsc() - start) / NROUNDS);
+
+	start = read_tsc();
+	for (round = 0; round < NROUNDS; round++) {
+		fill(round);
+		ipc_send_range(child, 0, buf, NPAGES, PERM);
+		ipc_recv(0, 0, 0);
+	}
+	cprintf("range     %d pages %10llu cycles/transfer\n",
+		NPAGES, (read_tsc() - start) / NROUNDS);
+}
@@ -0,0 +1,42 @@
+// A child queues a writable page send to its parent, which is not
+// receiving yet.  While the send waits, the parent maps one of its own
+// read-only text pages over the child's page, then receives.  The
+// kernel must refuse the send when it is delivered, or the parent
+// would get a writable mapping of text shared by every instance of
+// this binary.
+
+#include <inc/lib.h>
+
+#define SRC	((char *) 0x10000000)
+#define DST	((char *) 0x20000000)
+
+void
+umain(int argc, char **argv)
+{
+	envid_t child, who, parent = thisenv->env_id;
+	void *text = ROUNDDOWN((void *) umain, PGSIZE);
+	int perm, r, v;
+
+	if ((child = fork()) < 0)
+		panic("fork: %e", child);
+	if (child == 0) {
+		if ((r = sys_page_alloc(0, SRC, PTE_P | PTE_U | PTE_W)) < 0)
+			panic("sys_page_alloc: %e", r);
+		r = sys_ipc_send(parent, 1, SRC, PTE_P | PTE_U | PTE_W);
+		cprintf("queued send returned %e\n", r);
+		ipc_send(parent, 2, 0, 0);
+		return;
+	}
+
+	while (envs[ENVX(child)].env_ipc_sendto != parent)
+		sys_yield();
+	if ((r = sys_page_map(0, text, child, SRC, PTE_P | PTE_U)) < 0)
+		panic("sys_page_map: %e", r);
+
+	v = ipc_recv(&who, DST, &perm);
+	if (v != 2 || who != child)
+		panic("got message %d from %08x", v, who);
+	if (perm || ((uvpd[PDX(DST)] & PTE_P) && (uvpt[PGNUM(DST)] & PTE_P)))
+		panic("read-only page delivered with perm %x", perm);
+	cprintf("ipcremap OK\n");
+}
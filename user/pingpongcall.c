@@ -0,0 +1,122 @@
+// Ping-pong a counter between two processes, as in user/pingpong, and
+// time the round trips three ways:
+//   send/recv  - ipc_send and ipc_recv in each direction; every hop
+//                goes through the scheduler
+//   msg        - the same with ipc_send_msg and ipc_recv_msg, carrying
+//                a whole struct ipc_msg in registers
+//   call/reply - ipc_call from the client, ipc_reply_wait in the
+//                server; the kernel switches directly between the two
+// The server adds 1 to every word, and the client checks them all.
+// Times are in cycles per round trip, read with rdtsc.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NROUNDS		10000
+
+static void
+bump(struct ipc_msg *msg)
+{
+	int i;
+
+	for (i = 0; i < IPC_MSG_WORDS; i++)
+		msg->m_w[i]++;
+}
+
+static void
+fill(struct ipc_msg *msg, uint32_t n)
+{
+	int i;
+
+	for (i = 0; i < IPC_MSG_WORDS; i++)
+		msg->m_w[i] = n * IPC_MSG_WORDS + i;
+}
+
+static void
+check(const char *name, const struct ipc_msg *msg, uint32_t n)
+{
+	int i;
+
+	for (i = 0; i < IPC_MSG_WORDS; i++)
+		if (msg->m_w[i] != n * IPC_MSG_WORDS + i + 1)
+			panic("%s: word %d is %d in round %d", name, i,
+			      msg->m_w[i], n);
+}
+
+static void
+server(void)
+{
+	struct ipc_msg msg;
+	envid_t who;
+	uint32_t i;
+	int n;
+
+	for (n = 0; n < NROUNDS; n++) {
+		i = ipc_recv(&who, 0, 0);
+		ipc_send(who, i + 1, 0, 0);
+	}
+
+	for (n = 0; n < NROUNDS; n++) {
+		if ((who = ipc_recv_msg(&msg)) < 0)
+			panic("ipc_recv_msg: %e", who);
+		bump(&msg);
+		ipc_send_msg(who, &msg);
+	}
+
+	who = ipc_reply_wait(0, &msg);
+	for (;;) {
+		if (who < 0)
+			panic("ipc_reply_wait: %e", who);
+		bump(&msg);
+		who = ipc_reply_wait(who, &msg);
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+	struct ipc_msg msg;
+	envid_t who, from;
+	uint64_t start;
+	uint32_t i, reply;
+	int r;
+
+	if ((who = fork()) < 0)
+		panic("fork: %e", who);
+	if (who == 0) {
+		server();
+		return;
+	}
+
+	start = read_tsc();
+	for (i = 0; i < NROUNDS; i++) {
+		ipc_send(who, i, 0, 0);
+		if ((reply = ipc_recv(&from, 0, 0)) != i + 1 || from != who)
+			panic("send/recv: got %d from %x", reply, from);
+	}
+	cprintf("send/recv  %6d rounds %8llu cycles/round trip\n",
+		NROUNDS, (read_tsc() - start) / NROUNDS);
+
+	start = read_tsc();
+	for (i = 0; i < NROUNDS; i++) {
+		fill(&msg, i);
+		ipc_send_msg(who, &msg);
+		if ((from = ipc_recv_msg(&msg)) != who)
+			panic("ipc_recv_msg: reply from %x", from);
+		check("msg", &msg, i);
+	}
+	cprintf("msg        %6d rounds %8llu cycles/round trip\n",
+		NROUNDS, (read_tsc() - start) / NROUNDS);
+
+	start = read_tsc();
+	for (i = 0; i < NROUNDS; i++) {
+		fill(&msg, i);
+		if ((r = ipc_call(who, &msg)) < 0)
+			panic("ipc_call: %e", r);
+		check("call/reply", &msg, i);
+	}
+	cprintf("call/reply %6d rounds %8llu cycles/round trip\n",
+		NROUNDS, (read_tsc() - start) / NROUNDS);
+
+	sys_env_destroy(who);
+}
@@ -0,0 +1,63 @@
+// Compare the kernel spawn (sys_spawn) with loading a child from user
+// space after exofork (uspawn), the way fork-then-load works without
+// kernel help.
+//
+// Each implementation starts user/hello NSPAWN times, one at a time,
+// from the copy of its ELF image linked into this program (see
+// user/Makefrag).  Times are cycles spent inside the spawn call, and
+// cycles until the child has exited, read with rdtsc.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NSPAWN		10
+
+extern const uint8_t _binary_obj_user_hello_start[];
+extern const uint8_t _binary_obj_user_hello_end[];
+
+static void
+wait_env(envid_t envid)
+{
+	while (envs[ENVX(envid)].env_id == envid
+	       && envs[ENVX(envid)].env_status != ENV_FREE)
+		sys_yield();
+}
+
+void
+umain(int argc, char **argv)
+{
+	static const struct {
+		const char *name;
+		envid_t (*fn)(const void *, size_t, const char **);
+	} impls[] = {
+		{ "uspawn", uspawn },
+		{ "spawn", spawn },
+	};
+	const char *args[] = { "hello", "from", "spawnbench", NULL };
+	const uint8_t *binary = _binary_obj_user_hello_start;
+	size_t size = _binary_obj_user_hello_end - _binary_obj_user_hello_start;
+	uint64_t start, spawned, total;
+	uint64_t spawn_cycles[ARRAY_SIZE(impls)], total_cycles[ARRAY_SIZE(impls)];
+	envid_t envid;
+	int i, j;
+
+	for (i = 0; i < ARRAY_SIZE(impls); i++) {
+		spawn_cycles[i] = total_cycles[i] = 0;
+		for (j = 0; j < NSPAWN; j++) {
+			start = read_tsc();
+			if ((envid = impls[i].fn(binary, size, args)) < 0)
+				panic("%s: %e", impls[i].name, envid);
+			spawned = read_tsc();
+			wait_env(envid);
+			total = read_tsc();
+			spawn_cycles[i] += spawned - start;
+			total_cycles[i] += total - start;
+		}
+	}
+
+	// Print after the children are done, so their output stays apart.
+	for (i = 0; i < ARRAY_SIZE(impls); i++)
+		cprintf("%-6s %3d spawns %10llu cycles/spawn %10llu cycles/run\n",
+			impls[i].name, NSPAWN, spawn_cycles[i] / NSPAWN,
+			total_cycles[i] / NSPAWN);
+}
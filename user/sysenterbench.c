@@ -0,0 +1,38 @@
+// Measure null system call latency (sys_getenvid) entering the kernel
+// with int $T_SYSCALL and, where the CPU has it, with sysenter.
+// Latency is the average cycles per call, read with rdtsc.
+
+#include <inc/lib.h>
+#include <inc/cpuid.h>
+#include <inc/x86.h>
+
+#define NCALLS	100000
+
+static uint64_t
+measure(void)
+{
+	uint64_t start;
+	int i;
+
+	// Once untimed, to warm the caches and TLB.
+	sys_getenvid();
+
+	start = read_tsc();
+	for (i = 0; i < NCALLS; i++)
+		sys_getenvid();
+	return (read_tsc() - start) / NCALLS;
+}
+
+void
+umain(int argc, char **argv)
+{
+	syscall_sysenter = 0;
+	cprintf("int       %6llu cycles/call\n", measure());
+
+	if (!cpuid_sysenter()) {
+		cprintf("sysenter  not supported by this CPU\n");
+		return;
+	}
+	syscall_sysenter = 1;
+	cprintf("sysenter  %6llu cycles/call\n", measure());
+}
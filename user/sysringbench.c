@@ -0,0 +1,103 @@
+// Compare page system calls made one trap each with the same calls
+// queued in a struct sysring and run a batch per sys_sysring_enter.
+//
+// Each round allocates NPAGES pages and unmaps them again, 2 * NPAGES
+// system calls in all.  Times are read with rdtsc; calls per second
+// are shown once the kernel has calibrated the TSC.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NPAGES	512
+#define NROUNDS	8
+#define BUF	((char *) 0x20000000)
+
+static struct sysring *ring = (struct sysring *) UTEMP;
+
+static void
+direct_round(void)
+{
+	int i, r;
+
+	for (i = 0; i < NPAGES; i++)
+		if ((r = sys_page_alloc(0, BUF + i * PGSIZE,
+					PTE_P | PTE_U | PTE_W)) < 0)
+			panic("sys_page_alloc: %e", r);
+	for (i = 0; i < NPAGES; i++)
+		if ((r = sys_page_unmap(0, BUF + i * PGSIZE)) < 0)
+			panic("sys_page_unmap: %e", r);
+}
+
+// Run 'num' on each of the NPAGES pages through the ring, a full ring
+// per trap.
+static void
+ring_pass(uint32_t num)
+{
+	struct sysring_sqe sqe;
+	struct sysring_cqe cqe;
+	int i = 0, r;
+
+	memset(&sqe, 0, sizeof(sqe));
+	sqe.se_num = num;
+	sqe.se_args[2] = PTE_P | PTE_U | PTE_W;
+	while (i < NPAGES) {
+		for (; i < NPAGES; i++) {
+			sqe.se_args[1] = (uint32_t) (BUF + i * PGSIZE);
+			sqe.se_data = i;
+			if (!sysring_push(ring, &sqe))
+				break;
+		}
+		if ((r = sysring_submit(ring)) < 0)
+			panic("sysring_submit: %e", r);
+		while (sysring_reap(ring, &cqe))
+			if (cqe.ce_result < 0)
+				panic("page %d: %e", cqe.ce_data, cqe.ce_result);
+	}
+}
+
+static void
+ring_round(void)
+{
+	ring_pass(SYS_page_alloc);
+	ring_pass(SYS_page_unmap);
+}
+
+static void
+run(const char *name, void (*round)(void))
+{
+	uint64_t start, cycles, tsc_per_tick, ns_per_tick;
+	uint32_t ncalls = 2 * NPAGES * NROUNDS;
+	int i;
+
+	start = read_tsc();
+	for (i = 0; i < NROUNDS; i++)
+		round();
+	cycles = read_tsc() - start;
+
+	cprintf("%-8s %6d calls %8llu cycles/call", name, ncalls,
+		cycles / ncalls);
+	tsc_per_tick = vdso.vd_tsc_per_tick;
+	ns_per_tick = vdso.vd_ns_per_tick;
+	if (tsc_per_tick && ns_per_tick)
+		cprintf(" %10llu calls/s",
+			(uint64_t) ncalls * tsc_per_tick
+			* (NANOSECONDS_PER_SECOND / ns_per_tick) / cycles);
+	cprintf("\n");
+}
+
+void
+umain(int argc, char **argv)
+{
+	int r;
+
+	if ((r = sys_page_alloc(0, ring, PTE_P | PTE_U | PTE_W)) < 0)
+		panic("sys_page_alloc: %e", r);
+	if ((r = sysring_init(ring)) < 0)
+		panic("sysring_init: %e", r);
+
+	// Once untimed, so both runs find the page tables in place.
+	direct_round();
+
+	run("direct", direct_round);
+	run("sysring", ring_round);
+}
@@ -0,0 +1,48 @@
+// Map the shared zero page again and again with sys_page_map until the
+// kernel refuses, then check that the zero page survived: its 16-bit
+// reference count must never wrap (PAGE_MAXREF in kern/pmap.h).  If
+// other envs have already filled the zero page, SRC is a private page,
+// and the same limit applies to it.
+
+#include <inc/lib.h>
+
+#define SRC	((char *) 0x10000000)
+#define DST	((char *) 0x20000000)
+#define MAXMAP	0x10000		// more than a 16-bit pp_ref can count
+
+void
+umain(int argc, char **argv)
+{
+	int i, n, r;
+
+	if ((r = sys_page_alloc(0, SRC, PTE_P | PTE_U | PTE_W
+				| PAGE_ZERO_FILL)) < 0)
+		panic("sys_page_alloc: %e", r);
+
+	for (n = 0; n < MAXMAP; n++)
+		if ((r = sys_page_map(0, SRC, 0, DST + n * PGSIZE,
+				      PTE_P | PTE_U)) < 0)
+			break;
+	if (n == MAXMAP)
+		panic("mapped the zero page %d times without an error", n);
+	if (r != -E_NO_MEM)
+		panic("sys_page_map: %e, want -E_NO_MEM", r);
+	cprintf("zero page refused after %d more mappings\n", n);
+
+	for (i = 0; i < n; i++)
+		if (DST[i * PGSIZE] != 0)
+			panic("mapping %d does not read as zero", i);
+	for (i = 0; i < n; i++)
+		sys_page_unmap(0, DST + i * PGSIZE);
+
+	// The zero page must still be there and still be zero.
+	if (SRC[0] != 0 || SRC[PGSIZE - 1] != 0)
+		panic("zero page is no longer zero");
+	SRC[0] = 1;
+	if ((r = sys_page_alloc(0, DST, PTE_P | PTE_U | PTE_W
+				| PAGE_ZERO_FILL)) < 0)
+		panic("sys_page_alloc: %e", r);
+	if (DST[0] != 0)
+		panic("write to a copy-on-write zero page leaked");
+	cprintf("zerocap OK\n");
+}